@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.348528385f, 0.321979702f},
-std::array<float,2>{0.604355872f, 0.744243324f},
-std::array<float,2>{0.827609122f, 0.223612055f},
-std::array<float,2>{0.064042978f, 0.78095144f},
-std::array<float,2>{0.21890381f, 0.0276009198f},
-std::array<float,2>{0.9313609f, 0.986131787f},
-std::array<float,2>{0.699628651f, 0.389098942f},
-std::array<float,2>{0.437113166f, 0.555805802f},
-std::array<float,2>{0.027224483f, 0.439615667f},
-std::array<float,2>{0.781693757f, 0.615554452f},
-std::array<float,2>{0.542516232f, 0.0928062573f},
-std::array<float,2>{0.26855433f, 0.905651212f},
-std::array<float,2>{0.476905048f, 0.17926684f},
-std::array<float,2>{0.651050568f, 0.870526552f},
-std::array<float,2>{0.981695235f, 0.257264495f},
-std::array<float,2>{0.1440382f, 0.679868519f},
-std::array<float,2>{0.376274347f, 0.429603308f},
-std::array<float,2>{0.725419641f, 0.529377043f},
-std::array<float,2>{0.895512521f, 0.0402073823f},
-std::array<float,2>{0.200952664f, 0.96589613f},
-std::array<float,2>{0.124543622f, 0.217234522f},
-std::array<float,2>{0.859590888f, 0.800077438f},
-std::array<float,2>{0.585305631f, 0.360938549f},
-std::array<float,2>{0.328059822f, 0.703176439f},
-std::array<float,2>{0.174991578f, 0.304053694f},
-std::array<float,2>{0.958432972f, 0.638509095f},
-std::array<float,2>{0.67236495f, 0.130802691f},
-std::array<float,2>{0.450805575f, 0.84179467f},
-std::array<float,2>{0.305599362f, 0.121932119f},
-std::array<float,2>{0.523388743f, 0.913178504f},
-std::array<float,2>{0.779182971f, 0.494004041f},
-std::array<float,2>{0.0549869463f, 0.5794276f},
-std::array<float,2>{0.462807119f, 0.268919677f},
-std::array<float,2>{0.660811186f, 0.667909086f},
-std::array<float,2>{0.951654136f, 0.167944476f},
-std::array<float,2>{0.167220339f, 0.855088592f},
-std::array<float,2>{0.0346211977f, 0.0764767751f},
-std::array<float,2>{0.758449256f, 0.880243897f},
-std::array<float,2>{0.514042079f, 0.465978891f},
-std::array<float,2>{0.287908077f, 0.59533751f},
-std::array<float,2>{0.213528723f, 0.402948588f},
-std::array<float,2>{0.88193053f, 0.533277631f},
-std::array<float,2>{0.73838532f, 0.0147499982f},
-std::array<float,2>{0.390771449f, 0.982647061f},
-std::array<float,2>{0.335823357f, 0.247378871f},
-std::array<float,2>{0.566138148f, 0.752754033f},
-std::array<float,2>{0.845850408f, 0.336099565f},
-std::array<float,2>{0.102574669f, 0.720205009f},
-std::array<float,2>{0.261222482f, 0.473238319f},
-std::array<float,2>{0.54876101f, 0.564576209f},
-std::array<float,2>{0.803102076f, 0.0950843543f},
-std::array<float,2>{0.00519648241f, 0.933187485f},
-std::array<float,2>{0.138150334f, 0.151551962f},
-std::array<float,2>{0.99658519f, 0.826760411f},
-std::array<float,2>{0.634286702f, 0.285565048f},
-std::array<float,2>{0.496372461f, 0.655840397f},
-std::array<float,2>{0.0807826146f, 0.345395982f},
-std::array<float,2>{0.842768371f, 0.695146441f},
-std::array<float,2>{0.613686204f, 0.196016595f},
-std::array<float,2>{0.359840184f, 0.784656882f},
-std::array<float,2>{0.413349569f, 0.0497139432f},
-std::array<float,2>{0.713773668f, 0.950232923f},
-std::array<float,2>{0.912343204f, 0.406987041f},
-std::array<float,2>{0.248935431f, 0.506305993f},
-std::array<float,2>{0.294073343f, 0.290437639f},
-std::array<float,2>{0.502385676f, 0.646903515f},
-std::array<float,2>{0.752182484f, 0.143148169f},
-std::array<float,2>{0.0408859327f, 0.818465233f},
-std::array<float,2>{0.15816775f, 0.101937577f},
-std::array<float,2>{0.94008857f, 0.928923905f},
-std::array<float,2>{0.668047488f, 0.483152181f},
-std::array<float,2>{0.459944487f, 0.5745157f},
-std::array<float,2>{0.101553984f, 0.419482321f},
-std::array<float,2>{0.857787549f, 0.511916876f},
-std::array<float,2>{0.577001274f, 0.057506673f},
-std::array<float,2>{0.336090207f, 0.937646329f},
-std::array<float,2>{0.398977995f, 0.194512099f},
-std::array<float,2>{0.74623698f, 0.790755093f},
-std::array<float,2>{0.888085186f, 0.353773624f},
-std::array<float,2>{0.203440666f, 0.695445895f},
-std::array<float,2>{0.487532914f, 0.45538643f},
-std::array<float,2>{0.628450215f, 0.607324958f},
-std::array<float,2>{0.986698329f, 0.0644057989f},
-std::array<float,2>{0.125954404f, 0.890173018f},
-std::array<float,2>{0.0105929552f, 0.156591117f},
-std::array<float,2>{0.812068343f, 0.845904469f},
-std::array<float,2>{0.557251513f, 0.27880612f},
-std::array<float,2>{0.257557631f, 0.659970045f},
-std::array<float,2>{0.240083009f, 0.334256142f},
-std::array<float,2>{0.916444778f, 0.734284401f},
-std::array<float,2>{0.70879215f, 0.241679758f},
-std::array<float,2>{0.420331925f, 0.75896728f},
-std::array<float,2>{0.367880613f, 0.00537683815f},
-std::array<float,2>{0.624681115f, 0.974519253f},
-std::array<float,2>{0.829731584f, 0.397515684f},
-std::array<float,2>{0.0897644237f, 0.540489912f},
-std::array<float,2>{0.42249909f, 0.373557866f},
-std::array<float,2>{0.689011514f, 0.712121308f},
-std::array<float,2>{0.928863525f, 0.203545779f},
-std::array<float,2>{0.226618096f, 0.808244407f},
-std::array<float,2>{0.0723081902f, 0.0384352095f},
-std::array<float,2>{0.818882883f, 0.957142055f},
-std::array<float,2>{0.600993752f, 0.432431906f},
-std::array<float,2>{0.359114528f, 0.518910408f},
-std::array<float,2>{0.154642239f, 0.490955621f},
-std::array<float,2>{0.97385174f, 0.589807034f},
-std::array<float,2>{0.644662619f, 0.114457674f},
-std::array<float,2>{0.475563675f, 0.915869176f},
-std::array<float,2>{0.277317435f, 0.132905453f},
-std::array<float,2>{0.537432313f, 0.834449053f},
-std::array<float,2>{0.796608627f, 0.305232525f},
-std::array<float,2>{0.0207873993f, 0.630024374f},
-std::array<float,2>{0.317109108f, 0.382024705f},
-std::array<float,2>{0.591778338f, 0.551514626f},
-std::array<float,2>{0.873002231f, 0.0165261272f},
-std::array<float,2>{0.111136377f, 0.994112372f},
-std::array<float,2>{0.189016953f, 0.227680102f},
-std::array<float,2>{0.899781048f, 0.772295654f},
-std::array<float,2>{0.734108806f, 0.31756261f},
-std::array<float,2>{0.383274376f, 0.741051674f},
-std::array<float,2>{0.0508711711f, 0.258214831f},
-std::array<float,2>{0.773136258f, 0.672933757f},
-std::array<float,2>{0.527685285f, 0.185658544f},
-std::array<float,2>{0.297678441f, 0.863599956f},
-std::array<float,2>{0.437881082f, 0.0798156708f},
-std::array<float,2>{0.679694176f, 0.897140026f},
-std::array<float,2>{0.961008489f, 0.450925201f},
-std::array<float,2>{0.187344238f, 0.621838033f},
-std::array<float,2>{0.272697598f, 0.357940823f},
-std::array<float,2>{0.544527292f, 0.699712992f},
-std::array<float,2>{0.788538098f, 0.191035986f},
-std::array<float,2>{0.0291930139f, 0.796602368f},
-std::array<float,2>{0.148154363f, 0.0599857233f},
-std::array<float,2>{0.979237318f, 0.9429847f},
-std::array<float,2>{0.652627587f, 0.415930301f},
-std::array<float,2>{0.483073264f, 0.507989287f},
-std::array<float,2>{0.0666560382f, 0.478835166f},
-std::array<float,2>{0.820582986f, 0.571774721f},
-std::array<float,2>{0.609157622f, 0.108128294f},
-std::array<float,2>{0.344371527f, 0.92508167f},
-std::array<float,2>{0.430218339f, 0.146579117f},
-std::array<float,2>{0.698621511f, 0.814506114f},
-std::array<float,2>{0.934156716f, 0.29375115f},
-std::array<float,2>{0.226240784f, 0.64320749f},
-std::array<float,2>{0.447796762f, 0.390680939f},
-std::array<float,2>{0.677531183f, 0.543403566f},
-std::array<float,2>{0.954409122f, 0.00255177473f},
-std::array<float,2>{0.17666389f, 0.970012188f},
-std::array<float,2>{0.0604523942f, 0.235185802f},
-std::array<float,2>{0.77606374f, 0.76399368f},
-std::array<float,2>{0.517262459f, 0.329243064f},
-std::array<float,2>{0.311516553f, 0.72844708f},
-std::array<float,2>{0.196136743f, 0.274172097f},
-std::array<float,2>{0.892252982f, 0.663099945f},
-std::array<float,2>{0.721049786f, 0.160233796f},
-std::array<float,2>{0.380247861f, 0.848693788f},
-std::array<float,2>{0.320593357f, 0.0675402209f},
-std::array<float,2>{0.578175604f, 0.88667345f},
-std::array<float,2>{0.863438249f, 0.460382581f},
-std::array<float,2>{0.119327947f, 0.603723168f},
-std::array<float,2>{0.39698866f, 0.309377491f},
-std::array<float,2>{0.736830711f, 0.625773191f},
-std::array<float,2>{0.876738429f, 0.137950137f},
-std::array<float,2>{0.217057839f, 0.831297159f},
-std::array<float,2>{0.107374884f, 0.110648498f},
-std::array<float,2>{0.849476218f, 0.919885933f},
-std::array<float,2>{0.569485962f, 0.488090962f},
-std::array<float,2>{0.329020977f, 0.592819512f},
-std::array<float,2>{0.171362966f, 0.435646832f},
-std::array<float,2>{0.946956635f, 0.521695733f},
-std::array<float,2>{0.658727646f, 0.0339045487f},
-std::array<float,2>{0.465162754f, 0.955560923f},
-std::array<float,2>{0.28280282f, 0.210008889f},
-std::array<float,2>{0.509664595f, 0.811905026f},
-std::array<float,2>{0.763909817f, 0.368193209f},
-std::array<float,2>{0.0389086008f, 0.716665268f},
-std::array<float,2>{0.367128074f, 0.445968896f},
-std::array<float,2>{0.612669766f, 0.618633866f},
-std::array<float,2>{0.836317718f, 0.0851552039f},
-std::array<float,2>{0.0846264586f, 0.891793132f},
-std::array<float,2>{0.243376523f, 0.18251738f},
-std::array<float,2>{0.906780303f, 0.861837804f},
-std::array<float,2>{0.718676805f, 0.264328778f},
-std::array<float,2>{0.409727305f, 0.675849199f},
-std::array<float,2>{0.00182827935f, 0.313687563f},
-std::array<float,2>{0.798067689f, 0.735050857f},
-std::array<float,2>{0.554590046f, 0.232495725f},
-std::array<float,2>{0.262632042f, 0.768973351f},
-std::array<float,2>{0.493691266f, 0.0222675093f},
-std::array<float,2>{0.636815369f, 0.99714762f},
-std::array<float,2>{0.993769765f, 0.376785398f},
-std::array<float,2>{0.134315908f, 0.550145447f},
-std::array<float,2>{0.340344995f, 0.250991434f},
-std::array<float,2>{0.57039088f, 0.686169147f},
-std::array<float,2>{0.853398263f, 0.175709575f},
-std::array<float,2>{0.0969878435f, 0.871508539f},
-std::array<float,2>{0.207489088f, 0.0865057558f},
-std::array<float,2>{0.885284424f, 0.898482203f},
-std::array<float,2>{0.743503928f, 0.443145305f},
-std::array<float,2>{0.405827612f, 0.612603068f},
-std::array<float,2>{0.043805737f, 0.385780245f},
-std::array<float,2>{0.75674051f, 0.560994089f},
-std::array<float,2>{0.507233918f, 0.026318863f},
-std::array<float,2>{0.289119005f, 0.989774287f},
-std::array<float,2>{0.454603583f, 0.222142011f},
-std::array<float,2>{0.665212214f, 0.775165021f},
-std::array<float,2>{0.941591918f, 0.32624355f},
-std::array<float,2>{0.163724095f, 0.74828285f},
-std::array<float,2>{0.417373806f, 0.498860568f},
-std::array<float,2>{0.703368843f, 0.5845474f},
-std::array<float,2>{0.919073105f, 0.119615279f},
-std::array<float,2>{0.234548211f, 0.909129322f},
-std::array<float,2>{0.0901999623f, 0.125318155f},
-std::array<float,2>{0.832839251f, 0.835938931f},
-std::array<float,2>{0.618639529f, 0.299330175f},
-std::array<float,2>{0.372617513f, 0.636467636f},
-std::array<float,2>{0.132351458f, 0.365547121f},
-std::array<float,2>{0.989840686f, 0.710381448f},
-std::array<float,2>{0.63047713f, 0.211095616f},
-std::array<float,2>{0.488901466f, 0.804197073f},
-std::array<float,2>{0.253828824f, 0.0433750823f},
-std::array<float,2>{0.560889304f, 0.963957489f},
-std::array<float,2>{0.805937946f, 0.425227553f},
-std::array<float,2>{0.0151161803f, 0.523604572f},
-std::array<float,2>{0.469151407f, 0.340892047f},
-std::array<float,2>{0.643620551f, 0.723844349f},
-std::array<float,2>{0.969345212f, 0.245131195f},
-std::array<float,2>{0.149850026f, 0.756758988f},
-std::array<float,2>{0.01680981f, 0.0115625737f},
-std::array<float,2>{0.789769769f, 0.980404377f},
-std::array<float,2>{0.535149336f, 0.39948687f},
-std::array<float,2>{0.28049913f, 0.535308659f},
-std::array<float,2>{0.231347412f, 0.462735891f},
-std::array<float,2>{0.923769712f, 0.598829746f},
-std::array<float,2>{0.692334592f, 0.0710142702f},
-std::array<float,2>{0.427445114f, 0.876284957f},
-std::array<float,2>{0.355340868f, 0.170122787f},
-std::array<float,2>{0.594665647f, 0.855679393f},
-std::array<float,2>{0.814464748f, 0.26976186f},
-std::array<float,2>{0.0757134557f, 0.668145239f},
-std::array<float,2>{0.302987874f, 0.412494987f},
-std::array<float,2>{0.527283967f, 0.502773225f},
-std::array<float,2>{0.767256916f, 0.0514926761f},
-std::array<float,2>{0.050142765f, 0.945388675f},
-std::array<float,2>{0.181536719f, 0.199377552f},
-std::array<float,2>{0.966870248f, 0.78692472f},
-std::array<float,2>{0.683875978f, 0.350043148f},
-std::array<float,2>{0.444057286f, 0.690436184f},
-std::array<float,2>{0.113875605f, 0.285085768f},
-std::array<float,2>{0.868334293f, 0.652064085f},
-std::array<float,2>{0.587100804f, 0.15453814f},
-std::array<float,2>{0.313728601f, 0.823059559f},
-std::array<float,2>{0.387696505f, 0.101518847f},
-std::array<float,2>{0.727492988f, 0.935191095f},
-std::array<float,2>{0.903786123f, 0.468809098f},
-std::array<float,2>{0.193316326f, 0.567947686f},
-std::array<float,2>{0.325196385f, 0.363058418f},
-std::array<float,2>{0.583209813f, 0.705903947f},
-std::array<float,2>{0.863250434f, 0.214945838f},
-std::array<float,2>{0.121842779f, 0.798774183f},
-std::array<float,2>{0.201694027f, 0.0415230505f},
-std::array<float,2>{0.898300111f, 0.967191517f},
-std::array<float,2>{0.722864032f, 0.426448911f},
-std::array<float,2>{0.377961248f, 0.529287994f},
-std::array<float,2>{0.0574797019f, 0.494822294f},
-std::array<float,2>{0.779863596f, 0.580236793f},
-std::array<float,2>{0.520451486f, 0.123398833f},
-std::array<float,2>{0.307032704f, 0.911477506f},
-std::array<float,2>{0.452786237f, 0.131235436f},
-std::array<float,2>{0.674512863f, 0.84188658f},
-std::array<float,2>{0.960498273f, 0.301030725f},
-std::array<float,2>{0.173389018f, 0.640370309f},
-std::array<float,2>{0.433889747f, 0.388005763f},
-std::array<float,2>{0.703056335f, 0.558358908f},
-std::array<float,2>{0.933069468f, 0.0295446068f},
-std::array<float,2>{0.222261876f, 0.987203538f},
-std::array<float,2>{0.0657292157f, 0.224745318f},
-std::array<float,2>{0.82540834f, 0.777585924f},
-std::array<float,2>{0.601581216f, 0.323739022f},
-std::array<float,2>{0.349675506f, 0.743835747f},
-std::array<float,2>{0.142032847f, 0.254973352f},
-std::array<float,2>{0.98244381f, 0.683175087f},
-std::array<float,2>{0.650250673f, 0.177733749f},
-std::array<float,2>{0.47894612f, 0.868086934f},
-std::array<float,2>{0.266473979f, 0.0907197967f},
-std::array<float,2>{0.540835261f, 0.903334379f},
-std::array<float,2>{0.784799576f, 0.437817425f},
-std::array<float,2>{0.0246734489f, 0.613760769f},
-std::array<float,2>{0.498202801f, 0.288679838f},
-std::array<float,2>{0.635178864f, 0.6533674f},
-std::array<float,2>{0.998437107f, 0.150061235f},
-std::array<float,2>{0.14045006f, 0.825429559f},
-std::array<float,2>{0.00598542532f, 0.0957289413f},
-std::array<float,2>{0.802538395f, 0.930607617f},
-std::array<float,2>{0.549114227f, 0.475527763f},
-std::array<float,2>{0.259439766f, 0.563686848f},
-std::array<float,2>{0.247897744f, 0.410063893f},
-std::array<float,2>{0.911418796f, 0.503932893f},
-std::array<float,2>{0.711034298f, 0.048312556f},
-std::array<float,2>{0.410606772f, 0.952082396f},
-std::array<float,2>{0.362336308f, 0.198672995f},
-std::array<float,2>{0.615734994f, 0.783179641f},
-std::array<float,2>{0.83996588f, 0.346786082f},
-std::array<float,2>{0.0794967785f, 0.692083538f},
-std::array<float,2>{0.286701471f, 0.46779573f},
-std::array<float,2>{0.51330173f, 0.596023738f},
-std::array<float,2>{0.761117995f, 0.0760405511f},
-std::array<float,2>{0.0328493416f, 0.882685423f},
-std::array<float,2>{0.164242372f, 0.165657535f},
-std::array<float,2>{0.95029217f, 0.853282392f},
-std::array<float,2>{0.663922429f, 0.265877664f},
-std::array<float,2>{0.463289887f, 0.664319217f},
-std::array<float,2>{0.103728071f, 0.338848978f},
-std::array<float,2>{0.844051361f, 0.72161603f},
-std::array<float,2>{0.563342392f, 0.248472363f},
-std::array<float,2>{0.332987487f, 0.751629531f},
-std::array<float,2>{0.394191474f, 0.0132632554f},
-std::array<float,2>{0.740836799f, 0.980490148f},
-std::array<float,2>{0.878969073f, 0.404752791f},
-std::array<float,2>{0.211393297f, 0.532410741f},
-std::array<float,2>{0.25430873f, 0.281219125f},
-std::array<float,2>{0.555894554f, 0.657434106f},
-std::array<float,2>{0.810061693f, 0.159539446f},
-std::array<float,2>{0.00825993344f, 0.84446919f},
-std::array<float,2>{0.128047124f, 0.0653592721f},
-std::array<float,2>{0.985903919f, 0.887765229f},
-std::array<float,2>{0.625666618f, 0.454383165f},
-std::array<float,2>{0.485318184f, 0.60884428f},
-std::array<float,2>{0.0865000635f, 0.394772947f},
-std::array<float,2>{0.830214262f, 0.542421103f},
-std::array<float,2>{0.622122586f, 0.00611755624f},
-std::array<float,2>{0.370929003f, 0.976276755f},
-std::array<float,2>{0.419810504f, 0.240009353f},
-std::array<float,2>{0.709586918f, 0.760999143f},
-std::array<float,2>{0.915669024f, 0.332470566f},
-std::array<float,2>{0.242021903f, 0.732012928f},
-std::array<float,2>{0.45860076f, 0.481522977f},
-std::array<float,2>{0.670295358f, 0.577967286f},
-std::array<float,2>{0.938425124f, 0.10450805f},
-std::array<float,2>{0.158857316f, 0.927340209f},
-std::array<float,2>{0.0427672341f, 0.141349837f},
-std::array<float,2>{0.750552475f, 0.817587554f},
-std::array<float,2>{0.500751913f, 0.292199194f},
-std::array<float,2>{0.295903027f, 0.645380676f},
-std::array<float,2>{0.206313074f, 0.353301167f},
-std::array<float,2>{0.888699591f, 0.697301149f},
-std::array<float,2>{0.749696314f, 0.191506535f},
-std::array<float,2>{0.400666296f, 0.791160405f},
-std::array<float,2>{0.339094073f, 0.0562413968f},
-std::array<float,2>{0.575499475f, 0.940896332f},
-std::array<float,2>{0.856595755f, 0.42004779f},
-std::array<float,2>{0.0988690928f, 0.514001966f},
-std::array<float,2>{0.385867596f, 0.318570584f},
-std::array<float,2>{0.731193304f, 0.739402056f},
-std::array<float,2>{0.901931822f, 0.230317399f},
-std::array<float,2>{0.190551832f, 0.769637704f},
-std::array<float,2>{0.111676164f, 0.0192078929f},
-std::array<float,2>{0.87446177f, 0.995765626f},
-std::array<float,2>{0.592387438f, 0.378993332f},
-std::array<float,2>{0.318656623f, 0.553679585f},
-std::array<float,2>{0.183856085f, 0.452403247f},
-std::array<float,2>{0.964034617f, 0.623322487f},
-std::array<float,2>{0.682641506f, 0.0801135972f},
-std::array<float,2>{0.439765155f, 0.895811081f},
-std::array<float,2>{0.299790621f, 0.184297383f},
-std::array<float,2>{0.530303836f, 0.86642164f},
-std::array<float,2>{0.770324945f, 0.26017046f},
-std::array<float,2>{0.0545830913f, 0.674965143f},
-std::array<float,2>{0.355468988f, 0.431482732f},
-std::array<float,2>{0.597860396f, 0.516885877f},
-std::array<float,2>{0.816907585f, 0.0367467478f},
-std::array<float,2>{0.0707577765f, 0.959774911f},
-std::array<float,2>{0.230224207f, 0.20630154f},
-std::array<float,2>{0.926928759f, 0.806106091f},
-std::array<float,2>{0.690751195f, 0.371329606f},
-std::array<float,2>{0.425185949f, 0.71310091f},
-std::array<float,2>{0.0234225094f, 0.307085514f},
-std::array<float,2>{0.793514371f, 0.632429421f},
-std::array<float,2>{0.536639035f, 0.136593476f},
-std::array<float,2>{0.274802536f, 0.833200216f},
-std::array<float,2>{0.472718686f, 0.116428114f},
-std::array<float,2>{0.648009002f, 0.916133821f},
-std::array<float,2>{0.976552725f, 0.488528937f},
-std::array<float,2>{0.152448803f, 0.587474823f},
-std::array<float,2>{0.310418516f, 0.330718279f},
-std::array<float,2>{0.517951488f, 0.729665577f},
-std::array<float,2>{0.773480058f, 0.236974731f},
-std::array<float,2>{0.0615832768f, 0.763476551f},
-std::array<float,2>{0.179288566f, 0.00119723461f},
-std::array<float,2>{0.956207275f, 0.972310483f},
-std::array<float,2>{0.679332256f, 0.392931163f},
-std::array<float,2>{0.445691556f, 0.546369851f},
-std::array<float,2>{0.118905768f, 0.457772315f},
-std::array<float,2>{0.866054416f, 0.602901638f},
-std::array<float,2>{0.580913782f, 0.0686031505f},
-std::array<float,2>{0.324028701f, 0.883820057f},
-std::array<float,2>{0.382057786f, 0.162265643f},
-std::array<float,2>{0.719243705f, 0.850881279f},
-std::array<float,2>{0.893565059f, 0.275832176f},
-std::array<float,2>{0.197512478f, 0.660521626f},
-std::array<float,2>{0.481746435f, 0.417371094f},
-std::array<float,2>{0.655963719f, 0.510014951f},
-std::array<float,2>{0.977986336f, 0.0607439317f},
-std::array<float,2>{0.144931272f, 0.944059849f},
-std::array<float,2>{0.0309952237f, 0.189302742f},
-std::array<float,2>{0.785969019f, 0.793985903f},
-std::array<float,2>{0.546263218f, 0.357084781f},
-std::array<float,2>{0.269595176f, 0.701618731f},
-std::array<float,2>{0.222764015f, 0.295503139f},
-std::array<float,2>{0.936622977f, 0.642350256f},
-std::array<float,2>{0.697213352f, 0.144719288f},
-std::array<float,2>{0.432813764f, 0.813905418f},
-std::array<float,2>{0.346080661f, 0.105745383f},
-std::array<float,2>{0.606478274f, 0.923770726f},
-std::array<float,2>{0.823227644f, 0.476700127f},
-std::array<float,2>{0.0689623803f, 0.574038208f},
-std::array<float,2>{0.40661478f, 0.262357533f},
-std::array<float,2>{0.716344118f, 0.678265631f},
-std::array<float,2>{0.9097175f, 0.180789992f},
-std::array<float,2>{0.244907692f, 0.860255361f},
-std::array<float,2>{0.0835854337f, 0.0835378021f},
-std::array<float,2>{0.838194907f, 0.894474447f},
-std::array<float,2>{0.61048311f, 0.448013663f},
-std::array<float,2>{0.365038782f, 0.619187772f},
-std::array<float,2>{0.136027068f, 0.378063679f},
-std::array<float,2>{0.996089637f, 0.547689617f},
-std::array<float,2>{0.640243649f, 0.0195931513f},
-std::array<float,2>{0.495527625f, 0.998785257f},
-std::array<float,2>{0.264411688f, 0.23127608f},
-std::array<float,2>{0.551657856f, 0.765946746f},
-std::array<float,2>{0.799179912f, 0.314770788f},
-std::array<float,2>{0.00248343451f, 0.73802942f},
-std::array<float,2>{0.330535531f, 0.484458417f},
-std::array<float,2>{0.567905188f, 0.589897156f},
-std::array<float,2>{0.851039708f, 0.111543775f},
-std::array<float,2>{0.107592866f, 0.920352042f},
-std::array<float,2>{0.215935424f, 0.139474452f},
-std::array<float,2>{0.877102017f, 0.828265548f},
-std::array<float,2>{0.7348333f, 0.311905265f},
-std::array<float,2>{0.394627392f, 0.628773034f},
-std::array<float,2>{0.0362444595f, 0.369499683f},
-std::array<float,2>{0.761984408f, 0.717023492f},
-std::array<float,2>{0.510987401f, 0.2084454f},
-std::array<float,2>{0.283901244f, 0.809340954f},
-std::array<float,2>{0.468450695f, 0.0318793096f},
-std::array<float,2>{0.656344235f, 0.95416683f},
-std::array<float,2>{0.94831717f, 0.434705377f},
-std::array<float,2>{0.169261515f, 0.520844519f},
-std::array<float,2>{0.373170376f, 0.298340082f},
-std::array<float,2>{0.620492399f, 0.633940458f},
-std::array<float,2>{0.834019601f, 0.12707594f},
-std::array<float,2>{0.0929341242f, 0.839545667f},
-std::array<float,2>{0.237584233f, 0.118591823f},
-std::array<float,2>{0.920195937f, 0.908006787f},
-std::array<float,2>{0.705943823f, 0.49710241f},
-std::array<float,2>{0.415317714f, 0.583215773f},
-std::array<float,2>{0.0127687883f, 0.422824264f},
-std::array<float,2>{0.808121562f, 0.527263403f},
-std::array<float,2>{0.558765292f, 0.0467395559f},
-std::array<float,2>{0.250346363f, 0.96275419f},
-std::array<float,2>{0.490499109f, 0.21478954f},
-std::array<float,2>{0.631883442f, 0.801889896f},
-std::array<float,2>{0.990710676f, 0.365182787f},
-std::array<float,2>{0.129767194f, 0.707577527f},
-std::array<float,2>{0.40293318f, 0.444597661f},
-std::array<float,2>{0.745030999f, 0.609388053f},
-std::array<float,2>{0.883962274f, 0.0897777826f},
-std::array<float,2>{0.210052028f, 0.9022246f},
-std::array<float,2>{0.0939028114f, 0.172387764f},
-std::array<float,2>{0.854150593f, 0.873583376f},
-std::array<float,2>{0.573451817f, 0.253264546f},
-std::array<float,2>{0.341982394f, 0.684526861f},
-std::array<float,2>{0.16132988f, 0.325685561f},
-std::array<float,2>{0.944488287f, 0.74643451f},
-std::array<float,2>{0.667862415f, 0.218904674f},
-std::array<float,2>{0.456192344f, 0.776879847f},
-std::array<float,2>{0.29127872f, 0.0244581439f},
-std::array<float,2>{0.505604446f, 0.991414309f},
-std::array<float,2>{0.754214346f, 0.383514524f},
-std::array<float,2>{0.045824945f, 0.559229553f},
-std::array<float,2>{0.443168193f, 0.349067569f},
-std::array<float,2>{0.686967194f, 0.689085782f},
-std::array<float,2>{0.966253459f, 0.201283336f},
-std::array<float,2>{0.182762131f, 0.788925648f},
-std::array<float,2>{0.0469630621f, 0.0529570729f},
-std::array<float,2>{0.768079698f, 0.947309494f},
-std::array<float,2>{0.525383353f, 0.410418302f},
-std::array<float,2>{0.301023215f, 0.501066983f},
-std::array<float,2>{0.193638206f, 0.472128451f},
-std::array<float,2>{0.904545784f, 0.569181442f},
-std::array<float,2>{0.730104387f, 0.0978213176f},
-std::array<float,2>{0.388754874f, 0.936777651f},
-std::array<float,2>{0.314909607f, 0.152373627f},
-std::array<float,2>{0.588866651f, 0.821022451f},
-std::array<float,2>{0.869152009f, 0.281327426f},
-std::array<float,2>{0.115928762f, 0.650246918f},
-std::array<float,2>{0.279218674f, 0.40180105f},
-std::array<float,2>{0.532914102f, 0.53711319f},
-std::array<float,2>{0.791746736f, 0.00944876764f},
-std::array<float,2>{0.0190106966f, 0.977626562f},
-std::array<float,2>{0.151613891f, 0.243215755f},
-std::array<float,2>{0.971709371f, 0.755350649f},
-std::array<float,2>{0.642326713f, 0.342961252f},
-std::array<float,2>{0.47229898f, 0.726251841f},
-std::array<float,2>{0.0768810958f, 0.273038f},
-std::array<float,2>{0.812538087f, 0.670759201f},
-std::array<float,2>{0.597375095f, 0.168543607f},
-std::array<float,2>{0.353269547f, 0.859207571f},
-std::array<float,2>{0.428546935f, 0.0737495944f},
-std::array<float,2>{0.695177197f, 0.877724469f},
-std::array<float,2>{0.924245775f, 0.463582367f},
-std::array<float,2>{0.233700037f, 0.601396859f},
-std::array<float,2>{0.333761662f, 0.337822318f},
-std::array<float,2>{0.563720167f, 0.719457448f},
-std::array<float,2>{0.84521687f, 0.246597543f},
-std::array<float,2>{0.105308555f, 0.753595889f},
-std::array<float,2>{0.21280238f, 0.0137649365f},
-std::array<float,2>{0.880393267f, 0.98392719f},
-std::array<float,2>{0.741809666f, 0.403938174f},
-std::array<float,2>{0.393151581f, 0.535002947f},
-std::array<float,2>{0.0313917622f, 0.46578759f},
-std::array<float,2>{0.759857237f, 0.594237149f},
-std::array<float,2>{0.512197316f, 0.0773060545f},
-std::array<float,2>{0.285176575f, 0.879880369f},
-std::array<float,2>{0.464245319f, 0.16629748f},
-std::array<float,2>{0.662379861f, 0.853649616f},
-std::array<float,2>{0.950031996f, 0.268433958f},
-std::array<float,2>{0.165954515f, 0.666273355f},
-std::array<float,2>{0.411595583f, 0.408025742f},
-std::array<float,2>{0.712156415f, 0.507545233f},
-std::array<float,2>{0.910993457f, 0.0499233417f},
-std::array<float,2>{0.246435985f, 0.949583948f},
-std::array<float,2>{0.0782540515f, 0.197166249f},
-std::array<float,2>{0.841560125f, 0.783552825f},
-std::array<float,2>{0.616212785f, 0.344498634f},
-std::array<float,2>{0.361554116f, 0.694105089f},
-std::array<float,2>{0.139483437f, 0.286442518f},
-std::array<float,2>{0.999460459f, 0.654906034f},
-std::array<float,2>{0.636137605f, 0.150789559f},
-std::array<float,2>{0.499549419f, 0.827526391f},
-std::array<float,2>{0.258583933f, 0.0945715159f},
-std::array<float,2>{0.550225198f, 0.931744277f},
-std::array<float,2>{0.800847232f, 0.473928452f},
-std::array<float,2>{0.00767335109f, 0.566074014f},
-std::array<float,2>{0.480363309f, 0.256521255f},
-std::array<float,2>{0.648515821f, 0.680924118f},
-std::array<float,2>{0.98344785f, 0.177973226f},
-std::array<float,2>{0.140736148f, 0.869677722f},
-std::array<float,2>{0.0235732254f, 0.0923459977f},
-std::array<float,2>{0.783247232f, 0.90441525f},
-std::array<float,2>{0.53913784f, 0.44052732f},
-std::array<float,2>{0.267201215f, 0.616934001f},
-std::array<float,2>{0.221024007f, 0.390372992f},
-std::array<float,2>{0.932543397f, 0.554751754f},
-std::array<float,2>{0.701799214f, 0.0288057402f},
-std::array<float,2>{0.434750319f, 0.984861493f},
-std::array<float,2>{0.350634456f, 0.224487126f},
-std::array<float,2>{0.603426695f, 0.779438674f},
-std::array<float,2>{0.824436009f, 0.32051152f},
-std::array<float,2>{0.0649883971f, 0.74592185f},
-std::array<float,2>{0.308484405f, 0.492557615f},
-std::array<float,2>{0.52071321f, 0.578635871f},
-std::array<float,2>{0.780731678f, 0.122324966f},
-std::array<float,2>{0.0584897622f, 0.912809253f},
-std::array<float,2>{0.171906963f, 0.129639357f},
-std::array<float,2>{0.959585071f, 0.840138197f},
-std::array<float,2>{0.675418854f, 0.303640485f},
-std::array<float,2>{0.451686442f, 0.637160957f},
-std::array<float,2>{0.122899875f, 0.359852314f},
-std::array<float,2>{0.862282753f, 0.704325259f},
-std::array<float,2>{0.582433999f, 0.218703777f},
-std::array<float,2>{0.324331194f, 0.79890883f},
-std::array<float,2>{0.377926052f, 0.0396378487f},
-std::array<float,2>{0.724352062f, 0.964887917f},
-std::array<float,2>{0.897402406f, 0.427775979f},
-std::array<float,2>{0.202559173f, 0.531105638f},
-std::array<float,2>{0.273596644f, 0.306467295f},
-std::array<float,2>{0.535522819f, 0.629439354f},
-std::array<float,2>{0.794499755f, 0.134188935f},
-std::array<float,2>{0.0216558445f, 0.835243642f},
-std::array<float,2>{0.153363809f, 0.11400459f},
-std::array<float,2>{0.975252092f, 0.914094031f},
-std::array<float,2>{0.647321999f, 0.491959333f},
-std::array<float,2>{0.47381863f, 0.588835418f},
-std::array<float,2>{0.0722310469f, 0.432641983f},
-std::array<float,2>{0.818346322f, 0.517929494f},
-std::array<float,2>{0.599072099f, 0.0379914232f},
-std::array<float,2>{0.356906831f, 0.958346784f},
-std::array<float,2>{0.42459774f, 0.204324245f},
-std::array<float,2>{0.689967453f, 0.807121933f},
-std::array<float,2>{0.926087976f, 0.37495634f},
-std::array<float,2>{0.228632465f, 0.711447477f},
-std::array<float,2>{0.440563619f, 0.449354142f},
-std::array<float,2>{0.681870103f, 0.622993588f},
-std::array<float,2>{0.963796556f, 0.0789989233f},
-std::array<float,2>{0.184997931f, 0.897554874f},
-std::array<float,2>{0.0536190718f, 0.186542988f},
-std::array<float,2>{0.771321833f, 0.864597976f},
-std::array<float,2>{0.529650092f, 0.259526253f},
-std::array<float,2>{0.300583184f, 0.672586858f},
-std::array<float,2>{0.189733401f, 0.316534221f},
-std::array<float,2>{0.901222885f, 0.741591275f},
-std::array<float,2>{0.731574535f, 0.2267382f},
-std::array<float,2>{0.385279834f, 0.772926688f},
-std::array<float,2>{0.320001096f, 0.017133195f},
-std::array<float,2>{0.593090355f, 0.992992938f},
-std::array<float,2>{0.873160064f, 0.380956978f},
-std::array<float,2>{0.112521589f, 0.551909924f},
-std::array<float,2>{0.401566386f, 0.355129898f},
-std::array<float,2>{0.748203874f, 0.697209895f},
-std::array<float,2>{0.890035152f, 0.193786681f},
-std::array<float,2>{0.205487832f, 0.789914072f},
-std::array<float,2>{0.0982270911f, 0.0579138398f},
-std::array<float,2>{0.855600059f, 0.939374983f},
-std::array<float,2>{0.574648201f, 0.418186456f},
-std::array<float,2>{0.338090956f, 0.513113737f},
-std::array<float,2>{0.160044774f, 0.484208047f},
-std::array<float,2>{0.938660741f, 0.576060355f},
-std::array<float,2>{0.671606302f, 0.102801897f},
-std::array<float,2>{0.457844436f, 0.928382993f},
-std::array<float,2>{0.29497239f, 0.143827915f},
-std::array<float,2>{0.501786411f, 0.820114374f},
-std::array<float,2>{0.751057625f, 0.289723843f},
-std::array<float,2>{0.041393403f, 0.647992134f},
-std::array<float,2>{0.369234413f, 0.39743641f},
-std::array<float,2>{0.621769249f, 0.539513886f},
-std::array<float,2>{0.831329405f, 0.00434432738f},
-std::array<float,2>{0.0871410221f, 0.972984314f},
-std::array<float,2>{0.241032973f, 0.240955681f},
-std::array<float,2>{0.914238513f, 0.758261442f},
-std::array<float,2>{0.710493207f, 0.335199833f},
-std::array<float,2>{0.418081999f, 0.733219624f},
-std::array<float,2>{0.00954086892f, 0.278310597f},
-std::array<float,2>{0.809085846f, 0.658602178f},
-std::array<float,2>{0.555556715f, 0.1576408f},
-std::array<float,2>{0.255439043f, 0.847094357f},
-std::array<float,2>{0.48619622f, 0.0629438311f},
-std::array<float,2>{0.626099825f, 0.889345229f},
-std::array<float,2>{0.984892607f, 0.456504792f},
-std::array<float,2>{0.127472982f, 0.605866492f},
-std::array<float,2>{0.28438732f, 0.367602408f},
-std::array<float,2>{0.510348737f, 0.715240479f},
-std::array<float,2>{0.76350522f, 0.209824562f},
-std::array<float,2>{0.0360093564f, 0.810649216f},
-std::array<float,2>{0.168913677f, 0.034329094f},
-std::array<float,2>{0.947268426f, 0.956564128f},
-std::array<float,2>{0.657758534f, 0.436564744f},
-std::array<float,2>{0.466856092f, 0.522989988f},
-std::array<float,2>{0.108885884f, 0.486580074f},
-std::array<float,2>{0.850562751f, 0.592125475f},
-std::array<float,2>{0.567243457f, 0.109922171f},
-std::array<float,2>{0.331506282f, 0.918447435f},
-std::array<float,2>{0.396432668f, 0.137179881f},
-std::array<float,2>{0.735679209f, 0.830629051f},
-std::array<float,2>{0.878554583f, 0.309990674f},
-std::array<float,2>{0.215517014f, 0.626428306f},
-std::array<float,2>{0.494810373f, 0.375760853f},
-std::array<float,2>{0.639364302f, 0.549488902f},
-std::array<float,2>{0.994263947f, 0.0230503883f},
-std::array<float,2>{0.135433137f, 0.996430039f},
-std::array<float,2>{0.00335980253f, 0.233928636f},
-std::array<float,2>{0.799880981f, 0.767599165f},
-std::array<float,2>{0.552403092f, 0.312669754f},
-std::array<float,2>{0.264900059f, 0.736076713f},
-std::array<float,2>{0.24597083f, 0.265077829f},
-std::array<float,2>{0.908216894f, 0.677400768f},
-std::array<float,2>{0.715167642f, 0.182935074f},
-std::array<float,2>{0.408017337f, 0.862454295f},
-std::array<float,2>{0.363306999f, 0.0842652917f},
-std::array<float,2>{0.609399855f, 0.891358256f},
-std::array<float,2>{0.839240193f, 0.447109461f},
-std::array<float,2>{0.0824270993f, 0.617997348f},
-std::array<float,2>{0.43200171f, 0.29410854f},
-std::array<float,2>{0.695412993f, 0.64443922f},
-std::array<float,2>{0.936077416f, 0.147639066f},
-std::array<float,2>{0.224011779f, 0.81611681f},
-std::array<float,2>{0.0702858791f, 0.108818009f},
-std::array<float,2>{0.823556602f, 0.923882127f},
-std::array<float,2>{0.605545998f, 0.479679585f},
-std::array<float,2>{0.347340524f, 0.570818603f},
-std::array<float,2>{0.145838872f, 0.414224684f},
-std::array<float,2>{0.976581812f, 0.509444296f},
-std::array<float,2>{0.65520215f, 0.0588417649f},
-std::array<float,2>{0.480650574f, 0.942202568f},
-std::array<float,2>{0.270945102f, 0.189502686f},
-std::array<float,2>{0.545091867f, 0.79575032f},
-std::array<float,2>{0.786806047f, 0.358455122f},
-std::array<float,2>{0.029369697f, 0.700648606f},
-std::array<float,2>{0.323113471f, 0.458996922f},
-std::array<float,2>{0.5816679f, 0.605373859f},
-std::array<float,2>{0.866709709f, 0.0669371411f},
-std::array<float,2>{0.117721125f, 0.885639608f},
-std::array<float,2>{0.198983788f, 0.162023604f},
-std::array<float,2>{0.893429339f, 0.84778291f},
-std::array<float,2>{0.720086634f, 0.274849355f},
-std::array<float,2>{0.381202549f, 0.662624061f},
-std::array<float,2>{0.0610062331f, 0.328927547f},
-std::array<float,2>{0.775291741f, 0.726949692f},
-std::array<float,2>{0.519300818f, 0.235769168f},
-std::array<float,2>{0.309494764f, 0.765575886f},
-std::array<float,2>{0.447066396f, 0.00371336518f},
-std::array<float,2>{0.677995205f, 0.969505548f},
-std::array<float,2>{0.955081105f, 0.392298907f},
-std::array<float,2>{0.178532392f, 0.544786751f},
-std::array<float,2>{0.352250367f, 0.270719171f},
-std::array<float,2>{0.596560001f, 0.669235826f},
-std::array<float,2>{0.813564956f, 0.171564221f},
-std::array<float,2>{0.0779599994f, 0.85664916f},
-std::array<float,2>{0.232566819f, 0.0720331594f},
-std::array<float,2>{0.925610542f, 0.875869453f},
-std::array<float,2>{0.694318652f, 0.461294502f},
-std::array<float,2>{0.429436773f, 0.598630607f},
-std::array<float,2>{0.0178199746f, 0.398920327f},
-std::array<float,2>{0.792521536f, 0.537065446f},
-std::array<float,2>{0.531499207f, 0.0103156557f},
-std::array<float,2>{0.278305203f, 0.979066014f},
-std::array<float,2>{0.471243471f, 0.244995803f},
-std::array<float,2>{0.641313076f, 0.757108212f},
-std::array<float,2>{0.97120899f, 0.340157449f},
-std::array<float,2>{0.151037171f, 0.72278744f},
-std::array<float,2>{0.390244991f, 0.470515788f},
-std::array<float,2>{0.728997648f, 0.566764057f},
-std::array<float,2>{0.906071424f, 0.100253329f},
-std::array<float,2>{0.19515124f, 0.933937907f},
-std::array<float,2>{0.11681962f, 0.155703112f},
-std::array<float,2>{0.870788515f, 0.82379967f},
-std::array<float,2>{0.589183271f, 0.283621639f},
-std::array<float,2>{0.316081285f, 0.650942445f},
-std::array<float,2>{0.182318375f, 0.350669652f},
-std::array<float,2>{0.965673983f, 0.689529479f},
-std::array<float,2>{0.685704112f, 0.200345829f},
-std::array<float,2>{0.44159925f, 0.785731554f},
-std::array<float,2>{0.302358001f, 0.0519377477f},
-std::array<float,2>{0.52406615f, 0.946766078f},
-std::array<float,2>{0.768903792f, 0.413773507f},
-std::array<float,2>{0.0488207079f, 0.503127873f},
-std::array<float,2>{0.455273241f, 0.327771366f},
-std::array<float,2>{0.666070461f, 0.749292552f},
-std::array<float,2>{0.943402231f, 0.220784426f},
-std::array<float,2>{0.161049262f, 0.774134278f},
-std::array<float,2>{0.0459125303f, 0.0271575917f},
-std::array<float,2>{0.755417883f, 0.988456905f},
-std::array<float,2>{0.504608393f, 0.385561496f},
-std::array<float,2>{0.292258352f, 0.5617401f},
-std::array<float,2>{0.20937416f, 0.441886157f},
-std::array<float,2>{0.883715153f, 0.611348271f},
-std::array<float,2>{0.745157242f, 0.0877512321f},
-std::array<float,2>{0.403981566f, 0.900050581f},
-std::array<float,2>{0.34359175f, 0.174726099f},
-std::array<float,2>{0.572707593f, 0.87240231f},
-std::array<float,2>{0.854986191f, 0.25030899f},
-std::array<float,2>{0.09511327f, 0.687313914f},
-std::array<float,2>{0.25157702f, 0.424766898f},
-std::array<float,2>{0.560376942f, 0.524820447f},
-std::array<float,2>{0.807093084f, 0.0445273817f},
-std::array<float,2>{0.0117958337f, 0.963348329f},
-std::array<float,2>{0.130726844f, 0.212176353f},
-std::array<float,2>{0.991441607f, 0.803414822f},
-std::array<float,2>{0.631522894f, 0.36680606f},
-std::array<float,2>{0.491746515f, 0.709559739f},
-std::array<float,2>{0.0924465507f, 0.30068621f},
-std::array<float,2>{0.835792005f, 0.635590792f},
-std::array<float,2>{0.619835496f, 0.126814455f},
-std::array<float,2>{0.37499547f, 0.837560058f},
-std::array<float,2>{0.414701879f, 0.12013381f},
-std::array<float,2>{0.706262589f, 0.909818709f},
-std::array<float,2>{0.920900822f, 0.499810457f},
-std::array<float,2>{0.237043619f, 0.58496964f},
-std::array<float,2>{0.360709965f, 0.346147805f},
-std::array<float,2>{0.614939332f, 0.692498624f},
-std::array<float,2>{0.842874527f, 0.19734551f},
-std::array<float,2>{0.0817029998f, 0.781773925f},
-std::array<float,2>{0.249595627f, 0.0476002321f},
-std::array<float,2>{0.913162053f, 0.952552676f},
-std::array<float,2>{0.714308619f, 0.40892455f},
-std::array<float,2>{0.412407637f, 0.505565524f},
-std::array<float,2>{0.00441903062f, 0.475830287f},
-std::array<float,2>{0.804426849f, 0.562514961f},
-std::array<float,2>{0.54736793f, 0.0969034508f},
-std::array<float,2>{0.259980291f, 0.931550801f},
-std::array<float,2>{0.497983128f, 0.148863316f},
-std::array<float,2>{0.63338685f, 0.824372172f},
-std::array<float,2>{0.99799639f, 0.287849009f},
-std::array<float,2>{0.137608826f, 0.652677774f},
-std::array<float,2>{0.391938597f, 0.405571759f},
-std::array<float,2>{0.739777565f, 0.53154099f},
-std::array<float,2>{0.881789267f, 0.0123462472f},
-std::array<float,2>{0.214254707f, 0.981698751f},
-std::array<float,2>{0.101770237f, 0.249565974f},
-std::array<float,2>{0.846856833f, 0.750898719f},
-std::array<float,2>{0.565130055f, 0.339231938f},
-std::array<float,2>{0.334238261f, 0.722580016f},
-std::array<float,2>{0.1663481f, 0.267100453f},
-std::array<float,2>{0.952385724f, 0.665640891f},
-std::array<float,2>{0.661608696f, 0.164902702f},
-std::array<float,2>{0.461770266f, 0.851580083f},
-std::array<float,2>{0.288107485f, 0.0749248415f},
-std::array<float,2>{0.515217483f, 0.881521165f},
-std::array<float,2>{0.759482682f, 0.46748662f},
-std::array<float,2>{0.0335654877f, 0.596936285f},
-std::array<float,2>{0.449454695f, 0.302456379f},
-std::array<float,2>{0.673476338f, 0.639498234f},
-std::array<float,2>{0.95776695f, 0.132288113f},
-std::array<float,2>{0.174023688f, 0.843478441f},
-std::array<float,2>{0.0559215881f, 0.124676637f},
-std::array<float,2>{0.777595639f, 0.910618305f},
-std::array<float,2>{0.522341073f, 0.496027321f},
-std::array<float,2>{0.306335777f, 0.581340313f},
-std::array<float,2>{0.199544683f, 0.427307576f},
-std::array<float,2>{0.895194232f, 0.527605236f},
-std::array<float,2>{0.725860536f, 0.0420959666f},
-std::array<float,2>{0.37596032f, 0.968079865f},
-std::array<float,2>{0.326871991f, 0.216581151f},
-std::array<float,2>{0.584022343f, 0.797425687f},
-std::array<float,2>{0.861044943f, 0.362084061f},
-std::array<float,2>{0.123977184f, 0.706100404f},
-std::array<float,2>{0.269027948f, 0.439360291f},
-std::array<float,2>{0.541267157f, 0.614622772f},
-std::array<float,2>{0.78264612f, 0.0911250561f},
-std::array<float,2>{0.0258155819f, 0.902681828f},
-std::array<float,2>{0.142919734f, 0.176163271f},
-std::array<float,2>{0.980707467f, 0.868664503f},
-std::array<float,2>{0.651794374f, 0.254389971f},
-std::array<float,2>{0.478327483f, 0.682431936f},
-std::array<float,2>{0.0627929196f, 0.322328061f},
-std::array<float,2>{0.826479137f, 0.742378712f},
-std::array<float,2>{0.605254352f, 0.22637473f},
-std::array<float,2>{0.348818004f, 0.779066741f},
-std::array<float,2>{0.436239898f, 0.030922411f},
-std::array<float,2>{0.700677097f, 0.988205016f},
-std::array<float,2>{0.930651188f, 0.387404501f},
-std::array<float,2>{0.220224351f, 0.557183862f},
-std::array<float,2>{0.298331559f, 0.261440665f},
-std::array<float,2>{0.528905034f, 0.674621522f},
-std::array<float,2>{0.772186279f, 0.185524926f},
-std::array<float,2>{0.0518592373f, 0.865579903f},
-std::array<float,2>{0.185885787f, 0.0811721087f},
-std::array<float,2>{0.962457359f, 0.894657075f},
-std::array<float,2>{0.681560397f, 0.45161742f},
-std::array<float,2>{0.439077377f, 0.624305308f},
-std::array<float,2>{0.110152319f, 0.380151153f},
-std::array<float,2>{0.871986687f, 0.553751349f},
-std::array<float,2>{0.59054631f, 0.0182869341f},
-std::array<float,2>{0.318047106f, 0.99477005f},
-std::array<float,2>{0.384261072f, 0.229294658f},
-std::array<float,2>{0.733110487f, 0.77130425f},
-std::array<float,2>{0.898701906f, 0.31965524f},
-std::array<float,2>{0.18798174f, 0.739238918f},
-std::array<float,2>{0.475997508f, 0.490090311f},
-std::array<float,2>{0.646348894f, 0.586328566f},
-std::array<float,2>{0.973020852f, 0.115627147f},
-std::array<float,2>{0.155523419f, 0.917349279f},
-std::array<float,2>{0.0198381227f, 0.135379717f},
-std::array<float,2>{0.795826972f, 0.832730293f},
-std::array<float,2>{0.538147748f, 0.308302104f},
-std::array<float,2>{0.275963247f, 0.631445467f},
-std::array<float,2>{0.227885053f, 0.372247279f},
-std::array<float,2>{0.928092659f, 0.714146435f},
-std::array<float,2>{0.688237369f, 0.205179706f},
-std::array<float,2>{0.423493296f, 0.805179119f},
-std::array<float,2>{0.3583377f, 0.035991665f},
-std::array<float,2>{0.599709928f, 0.960320413f},
-std::array<float,2>{0.819704413f, 0.430080026f},
-std::array<float,2>{0.0736948401f, 0.516065836f},
-std::array<float,2>{0.421815485f, 0.333429754f},
-std::array<float,2>{0.707092345f, 0.731304824f},
-std::array<float,2>{0.917771876f, 0.238599896f},
-std::array<float,2>{0.238700196f, 0.76002264f},
-std::array<float,2>{0.0879524723f, 0.00761497673f},
-std::array<float,2>{0.828856409f, 0.975405753f},
-std::array<float,2>{0.623129666f, 0.395911187f},
-std::array<float,2>{0.36884889f, 0.541242361f},
-std::array<float,2>{0.126605093f, 0.453231961f},
-std::array<float,2>{0.987651229f, 0.607879579f},
-std::array<float,2>{0.627357602f, 0.0660797879f},
-std::array<float,2>{0.486985266f, 0.887028813f},
-std::array<float,2>{0.2562069f, 0.158225f},
-std::array<float,2>{0.558404148f, 0.844905972f},
-std::array<float,2>{0.810834587f, 0.279363632f},
-std::array<float,2>{0.0115177073f, 0.656865478f},
-std::array<float,2>{0.336927861f, 0.421867818f},
-std::array<float,2>{0.577744126f, 0.515606046f},
-std::array<float,2>{0.858974934f, 0.0549673066f},
-std::array<float,2>{0.100167915f, 0.939836919f},
-std::array<float,2>{0.204873413f, 0.19292821f},
-std::array<float,2>{0.887270808f, 0.792963624f},
-std::array<float,2>{0.747113764f, 0.352306306f},
-std::array<float,2>{0.399589688f, 0.698708773f},
-std::array<float,2>{0.0392581969f, 0.291479796f},
-std::array<float,2>{0.752952218f, 0.646219552f},
-std::array<float,2>{0.503346086f, 0.142329276f},
-std::array<float,2>{0.293173015f, 0.816787004f},
-std::array<float,2>{0.460502654f, 0.103756987f},
-std::array<float,2>{0.669900298f, 0.926142514f},
-std::array<float,2>{0.94088155f, 0.480605841f},
-std::array<float,2>{0.157086417f, 0.576182187f},
-std::array<float,2>{0.263567865f, 0.316022009f},
-std::array<float,2>{0.553264558f, 0.736500144f},
-std::array<float,2>{0.797726214f, 0.231744006f},
-std::array<float,2>{0.000579729793f, 0.766986191f},
-std::array<float,2>{0.133364603f, 0.0209283996f},
-std::array<float,2>{0.992273748f, 0.999265909f},
-std::array<float,2>{0.63856405f, 0.377485782f},
-std::array<float,2>{0.492703944f, 0.548300564f},
-std::array<float,2>{0.0852750689f, 0.448916912f},
-std::array<float,2>{0.837592363f, 0.620179653f},
-std::array<float,2>{0.611395717f, 0.0821620002f},
-std::array<float,2>{0.366166472f, 0.893020689f},
-std::array<float,2>{0.408655107f, 0.180174053f},
-std::array<float,2>{0.71732825f, 0.861051023f},
-std::array<float,2>{0.907848835f, 0.262807518f},
-std::array<float,2>{0.242746577f, 0.679580569f},
-std::array<float,2>{0.466731459f, 0.43370086f},
-std::array<float,2>{0.659862518f, 0.52044028f},
-std::array<float,2>{0.945404053f, 0.032789506f},
-std::array<float,2>{0.170438185f, 0.953532338f},
-std::array<float,2>{0.0374144539f, 0.207289368f},
-std::array<float,2>{0.764886081f, 0.809677839f},
-std::array<float,2>{0.508149445f, 0.370151728f},
-std::array<float,2>{0.282154292f, 0.718473434f},
-std::array<float,2>{0.217915744f, 0.311514646f},
-std::array<float,2>{0.875256598f, 0.627006888f},
-std::array<float,2>{0.737699389f, 0.140093535f},
-std::array<float,2>{0.397941321f, 0.829760253f},
-std::array<float,2>{0.329830319f, 0.112951711f},
-std::array<float,2>{0.569002688f, 0.921400607f},
-std::array<float,2>{0.848282456f, 0.485373527f},
-std::array<float,2>{0.105679058f, 0.590866327f},
-std::array<float,2>{0.379313707f, 0.276663572f},
-std::array<float,2>{0.722529948f, 0.66194135f},
-std::array<float,2>{0.890936375f, 0.163146615f},
-std::array<float,2>{0.196660727f, 0.850406766f},
-std::array<float,2>{0.121009365f, 0.069521606f},
-std::array<float,2>{0.864276946f, 0.883452296f},
-std::array<float,2>{0.57956934f, 0.458479255f},
-std::array<float,2>{0.321309596f, 0.602407753f},
-std::array<float,2>{0.176780313f, 0.394217253f},
-std::array<float,2>{0.953247428f, 0.545351446f},
-std::array<float,2>{0.676012039f, 0.000120516823f},
-std::array<float,2>{0.449084103f, 0.97156316f},
-std::array<float,2>{0.312222242f, 0.237910554f},
-std::array<float,2>{0.516231298f, 0.762535393f},
-std::array<float,2>{0.777279675f, 0.331340253f},
-std::array<float,2>{0.0590352155f, 0.729290247f},
-std::array<float,2>{0.345386267f, 0.477768034f},
-std::array<float,2>{0.608163953f, 0.572518766f},
-std::array<float,2>{0.821308017f, 0.106629185f},
-std::array<float,2>{0.068060793f, 0.922225058f},
-std::array<float,2>{0.225418687f, 0.145532638f},
-std::array<float,2>{0.934799194f, 0.81331712f},
-std::array<float,2>{0.697731614f, 0.296819955f},
-std::array<float,2>{0.43096441f, 0.641361177f},
-std::array<float,2>{0.0280337948f, 0.355888814f},
-std::array<float,2>{0.787168145f, 0.702429354f},
-std::array<float,2>{0.543584585f, 0.188054189f},
-std::array<float,2>{0.272142798f, 0.793271959f},
-std::array<float,2>{0.483907521f, 0.0619962849f},
-std::array<float,2>{0.653621256f, 0.945309401f},
-std::array<float,2>{0.979684949f, 0.416219115f},
-std::array<float,2>{0.146559939f, 0.511542618f},
-std::array<float,2>{0.31269899f, 0.282559991f},
-std::array<float,2>{0.586105168f, 0.649063587f},
-std::array<float,2>{0.868056655f, 0.153970599f},
-std::array<float,2>{0.114955358f, 0.821805298f},
-std::array<float,2>{0.192331538f, 0.0990501344f},
-std::array<float,2>{0.902718008f, 0.936236501f},
-std::array<float,2>{0.728135467f, 0.471635282f},
-std::array<float,2>{0.387325823f, 0.570243597f},
-std::array<float,2>{0.0495375805f, 0.411829144f},
-std::array<float,2>{0.765771866f, 0.500708163f},
-std::array<float,2>{0.52602005f, 0.0540030114f},
-std::array<float,2>{0.304456562f, 0.948620737f},
-std::array<float,2>{0.445099741f, 0.203051165f},
-std::array<float,2>{0.685018718f, 0.78733933f},
-std::array<float,2>{0.968161404f, 0.348375618f},
-std::array<float,2>{0.179968238f, 0.688394368f},
-std::array<float,2>{0.426220983f, 0.464614421f},
-std::array<float,2>{0.693035722f, 0.60024941f},
-std::array<float,2>{0.922284424f, 0.072787106f},
-std::array<float,2>{0.231956258f, 0.87860781f},
-std::array<float,2>{0.0748755485f, 0.169862807f},
-std::array<float,2>{0.815628529f, 0.857489765f},
-std::array<float,2>{0.594941795f, 0.271665603f},
-std::array<float,2>{0.354489207f, 0.670956433f},
-std::array<float,2>{0.148941487f, 0.342324674f},
-std::array<float,2>{0.969883204f, 0.724981308f},
-std::array<float,2>{0.643063962f, 0.243005112f},
-std::array<float,2>{0.469818175f, 0.754230022f},
-std::array<float,2>{0.279841661f, 0.00848872028f},
-std::array<float,2>{0.533677101f, 0.977190137f},
-std::array<float,2>{0.790119052f, 0.401088864f},
-std::array<float,2>{0.015730178f, 0.538749456f},
-std::array<float,2>{0.489423811f, 0.36335367f},
-std::array<float,2>{0.629454911f, 0.708539307f},
-std::array<float,2>{0.988642156f, 0.213708505f},
-std::array<float,2>{0.131336257f, 0.800859153f},
-std::array<float,2>{0.0141120758f, 0.0455487333f},
-std::array<float,2>{0.805185139f, 0.96162647f},
-std::array<float,2>{0.562470436f, 0.423322827f},
-std::array<float,2>{0.252151757f, 0.526270568f},
-std::array<float,2>{0.235524163f, 0.496449172f},
-std::array<float,2>{0.918330193f, 0.582463264f},
-std::array<float,2>{0.704394042f, 0.117243566f},
-std::array<float,2>{0.416953862f, 0.906658769f},
-std::array<float,2>{0.371316403f, 0.128844813f},
-std::array<float,2>{0.617662549f, 0.838575184f},
-std::array<float,2>{0.833144665f, 0.297556996f},
-std::array<float,2>{0.0913379714f, 0.632882833f},
-std::array<float,2>{0.290205598f, 0.384186238f},
-std::array<float,2>{0.506770194f, 0.560272038f},
-std::array<float,2>{0.757476926f, 0.0236450788f},
-std::array<float,2>{0.0441796631f, 0.990631878f},
-std::array<float,2>{0.162644833f, 0.220558941f},
-std::array<float,2>{0.943197489f, 0.775993288f},
-std::array<float,2>{0.664629519f, 0.324772269f},
-std::array<float,2>{0.453945875f, 0.747803688f},
-std::array<float,2>{0.0963585228f, 0.252457261f},
-std::array<float,2>{0.851861954f, 0.685369074f},
-std::array<float,2>{0.571308196f, 0.173561946f},
-std::array<float,2>{0.341395408f, 0.874158323f},
-std::array<float,2>{0.404819846f, 0.0883298144f},
-std::array<float,2>{0.742695093f, 0.90119952f},
-std::array<float,2>{0.885763347f, 0.444062114f},
-std::array<float,2>{0.208659545f, 0.6110304f},
-std::array<float,2>{0.368269652f, 0.335888952f},
-std::array<float,2>{0.623718023f, 0.732617795f},
-std::array<float,2>{0.828476787f, 0.240510032f},
-std::array<float,2>{0.0884205624f, 0.758401394f},
-std::array<float,2>{0.239219785f, 0.00479932735f},
-std::array<float,2>{0.917163193f, 0.973356903f},
-std::array<float,2>{0.707973301f, 0.396699756f},
-std::array<float,2>{0.420976758f, 0.539926171f},
-std::array<float,2>{0.0108538829f, 0.456739455f},
-std::array<float,2>{0.811118186f, 0.606132925f},
-std::array<float,2>{0.557915747f, 0.0631257221f},
-std::array<float,2>{0.256443322f, 0.888931453f},
-std::array<float,2>{0.486352026f, 0.157892585f},
-std::array<float,2>{0.627855778f, 0.8472628f},
-std::array<float,2>{0.988218546f, 0.277639955f},
-std::array<float,2>{0.126110762f, 0.658718646f},
-std::array<float,2>{0.400066763f, 0.418712169f},
-std::array<float,2>{0.747588873f, 0.513349056f},
-std::array<float,2>{0.887173831f, 0.0585244671f},
-std::array<float,2>{0.204277217f, 0.938942671f},
-std::array<float,2>{0.099931702f, 0.194164455f},
-std::array<float,2>{0.85869205f, 0.789461672f},
-std::array<float,2>{0.577471972f, 0.354594022f},
-std::array<float,2>{0.337830812f, 0.696650505f},
-std::array<float,2>{0.156444982f, 0.289277911f},
-std::array<float,2>{0.941198945f, 0.647742391f},
-std::array<float,2>{0.669251919f, 0.144187242f},
-std::array<float,2>{0.460074395f, 0.819674611f},
-std::array<float,2>{0.293591708f, 0.103331856f},
-std::array<float,2>{0.503866792f, 0.928047895f},
-std::array<float,2>{0.75362891f, 0.483423382f},
-std::array<float,2>{0.0395658948f, 0.575485945f},
-std::array<float,2>{0.438799262f, 0.259013653f},
-std::array<float,2>{0.680706561f, 0.672239661f},
-std::array<float,2>{0.962020576f, 0.187113687f},
-std::array<float,2>{0.186508119f, 0.865033448f},
-std::array<float,2>{0.0524440967f, 0.0785779431f},
-std::array<float,2>{0.771712899f, 0.898024857f},
-std::array<float,2>{0.528493941f, 0.449988335f},
-std::array<float,2>{0.298342258f, 0.622190773f},
-std::array<float,2>{0.188128963f, 0.381699085f},
-std::array<float,2>{0.899311244f, 0.552610874f},
-std::array<float,2>{0.732585251f, 0.0166043844f},
-std::array<float,2>{0.384341121f, 0.992578268f},
-std::array<float,2>{0.317597866f, 0.227062538f},
-std::array<float,2>{0.589891374f, 0.773025811f},
-std::array<float,2>{0.87138164f, 0.317102939f},
-std::array<float,2>{0.109729014f, 0.742021561f},
-std::array<float,2>{0.27550596f, 0.491491288f},
-std::array<float,2>{0.538888216f, 0.588155925f},
-std::array<float,2>{0.795149565f, 0.113350071f},
-std::array<float,2>{0.020345293f, 0.914556444f},
-std::array<float,2>{0.155800834f, 0.134538129f},
-std::array<float,2>{0.973515868f, 0.835877001f},
-std::array<float,2>{0.645850897f, 0.306046993f},
-std::array<float,2>{0.476508558f, 0.629385471f},
-std::array<float,2>{0.0741605759f, 0.374210954f},
-std::array<float,2>{0.819913864f, 0.711254895f},
-std::array<float,2>{0.600551367f, 0.205050439f},
-std::array<float,2>{0.357770771f, 0.807266057f},
-std::array<float,2>{0.423233032f, 0.0373758525f},
-std::array<float,2>{0.687732875f, 0.958784461f},
-std::array<float,2>{0.928298771f, 0.433332175f},
-std::array<float,2>{0.228507563f, 0.518292665f},
-std::array<float,2>{0.30585444f, 0.302812308f},
-std::array<float,2>{0.521723211f, 0.637629211f},
-std::array<float,2>{0.778107941f, 0.128919974f},
-std::array<float,2>{0.0565361604f, 0.840792477f},
-std::array<float,2>{0.174753994f, 0.122818433f},
-std::array<float,2>{0.957303226f, 0.912382841f},
-std::array<float,2>{0.672952294f, 0.49295187f},
-std::array<float,2>{0.449808836f, 0.578133166f},
-std::array<float,2>{0.12338236f, 0.428522319f},
-std::array<float,2>{0.860610425f, 0.530593157f},
-std::array<float,2>{0.584786534f, 0.0392191596f},
-std::array<float,2>{0.326412708f, 0.965384305f},
-std::array<float,2>{0.375001073f, 0.218174785f},
-std::array<float,2>{0.726235151f, 0.799587429f},
-std::array<float,2>{0.894981921f, 0.360277504f},
-std::array<float,2>{0.199795619f, 0.704675078f},
-std::array<float,2>{0.4776344f, 0.441210926f},
-std::array<float,2>{0.652148068f, 0.616580069f},
-std::array<float,2>{0.981069148f, 0.0920766965f},
-std::array<float,2>{0.143305704f, 0.90498668f},
-std::array<float,2>{0.0260708071f, 0.178590119f},
-std::array<float,2>{0.7829656f, 0.869146824f},
-std::array<float,2>{0.541811407f, 0.256123006f},
-std::array<float,2>{0.269120514f, 0.681344569f},
-std::array<float,2>{0.220053956f, 0.321257412f},
-std::array<float,2>{0.929767907f, 0.745265543f},
-std::array<float,2>{0.700923562f, 0.224051952f},
-std::array<float,2>{0.435666233f, 0.779868782f},
-std::array<float,2>{0.34940505f, 0.0290599503f},
-std::array<float,2>{0.604831398f, 0.985145569f},
-std::array<float,2>{0.827001393f, 0.389756918f},
-std::array<float,2>{0.0632983372f, 0.555374086f},
-std::array<float,2>{0.412711263f, 0.34407261f},
-std::array<float,2>{0.714465976f, 0.693780303f},
-std::array<float,2>{0.913712144f, 0.196427047f},
-std::array<float,2>{0.249369815f, 0.783711076f},
-std::array<float,2>{0.0812522173f, 0.0506528951f},
-std::array<float,2>{0.843393564f, 0.949718595f},
-std::array<float,2>{0.614607394f, 0.407351077f},
-std::array<float,2>{0.36120522f, 0.506914258f},
-std::array<float,2>{0.137131274f, 0.474471241f},
-std::array<float,2>{0.997339368f, 0.565496981f},
-std::array<float,2>{0.633264065f, 0.0942336544f},
-std::array<float,2>{0.497428626f, 0.932490766f},
-std::array<float,2>{0.260530829f, 0.151278555f},
-std::array<float,2>{0.54709661f, 0.82782793f},
-std::array<float,2>{0.804022908f, 0.286969781f},
-std::array<float,2>{0.00392075954f, 0.654389918f},
-std::array<float,2>{0.334916979f, 0.403481334f},
-std::array<float,2>{0.564890921f, 0.534301639f},
-std::array<float,2>{0.847310185f, 0.0144280503f},
-std::array<float,2>{0.102269463f, 0.983811259f},
-std::array<float,2>{0.214778543f, 0.246130556f},
-std::array<float,2>{0.880893648f, 0.753026903f},
-std::array<float,2>{0.739369571f, 0.337304145f},
-std::array<float,2>{0.392135292f, 0.719125271f},
-std::array<float,2>{0.0338943191f, 0.267925411f},
-std::array<float,2>{0.758913815f, 0.666934311f},
-std::array<float,2>{0.515057564f, 0.166689828f},
-std::array<float,2>{0.288636148f, 0.854092836f},
-std::array<float,2>{0.461111575f, 0.0778530985f},
-std::array<float,2>{0.661833405f, 0.879230142f},
-std::array<float,2>{0.952756166f, 0.465019584f},
-std::array<float,2>{0.166781977f, 0.594650209f},
-std::array<float,2>{0.252915561f, 0.366249532f},
-std::array<float,2>{0.561726391f, 0.709161282f},
-std::array<float,2>{0.805107951f, 0.212666377f},
-std::array<float,2>{0.0143876551f, 0.802971065f},
-std::array<float,2>{0.131676719f, 0.0444180369f},
-std::array<float,2>{0.989207625f, 0.963711798f},
-std::array<float,2>{0.628959417f, 0.424107105f},
-std::array<float,2>{0.490039438f, 0.524921775f},
-std::array<float,2>{0.0908564404f, 0.499159902f},
-std::array<float,2>{0.833516061f, 0.585675001f},
-std::array<float,2>{0.617696285f, 0.121040635f},
-std::array<float,2>{0.37165913f, 0.909545124f},
-std::array<float,2>{0.416097879f, 0.126283377f},
-std::array<float,2>{0.704869747f, 0.837219119f},
-std::array<float,2>{0.918511629f, 0.300235897f},
-std::array<float,2>{0.236122563f, 0.635237694f},
-std::array<float,2>{0.453245312f, 0.385243446f},
-std::array<float,2>{0.664534152f, 0.562168479f},
-std::array<float,2>{0.94286561f, 0.0264174771f},
-std::array<float,2>{0.162126392f, 0.988822401f},
-std::array<float,2>{0.0448331982f, 0.221387938f},
-std::array<float,2>{0.757162452f, 0.77360338f},
-std::array<float,2>{0.506197393f, 0.32733053f},
-std::array<float,2>{0.290949911f, 0.749606788f},
-std::array<float,2>{0.208403721f, 0.250544816f},
-std::array<float,2>{0.886321604f, 0.68698293f},
-std::array<float,2>{0.742242694f, 0.174286082f},
-std::array<float,2>{0.404529482f, 0.872628629f},
-std::array<float,2>{0.341072708f, 0.0871116668f},
-std::array<float,2>{0.572206378f, 0.899721682f},
-std::array<float,2>{0.852360606f, 0.442002684f},
-std::array<float,2>{0.0959700644f, 0.611982644f},
-std::array<float,2>{0.386856496f, 0.283762962f},
-std::array<float,2>{0.727787197f, 0.650491774f},
-std::array<float,2>{0.903161347f, 0.155865774f},
-std::array<float,2>{0.191845953f, 0.823450863f},
-std::array<float,2>{0.114461079f, 0.0999595225f},
-std::array<float,2>{0.867592692f, 0.934287071f},
-std::array<float,2>{0.586588979f, 0.470045686f},
-std::array<float,2>{0.313066453f, 0.56703043f},
-std::array<float,2>{0.180237845f, 0.413353205f},
-std::array<float,2>{0.968666852f, 0.503427148f},
-std::array<float,2>{0.68536967f, 0.0525702797f},
-std::array<float,2>{0.444694042f, 0.946889579f},
-std::array<float,2>{0.304117799f, 0.201057509f},
-std::array<float,2>{0.525798917f, 0.785310149f},
-std::array<float,2>{0.766242504f, 0.351079434f},
-std::array<float,2>{0.0491517298f, 0.690108657f},
-std::array<float,2>{0.353731573f, 0.461443663f},
-std::array<float,2>{0.595669091f, 0.597695589f},
-std::array<float,2>{0.816138327f, 0.0713101327f},
-std::array<float,2>{0.0743267164f, 0.875138581f},
-std::array<float,2>{0.231815055f, 0.171339378f},
-std::array<float,2>{0.922507763f, 0.857019722f},
-std::array<float,2>{0.692496359f, 0.271215796f},
-std::array<float,2>{0.426616967f, 0.669803619f},
-std::array<float,2>{0.0161399804f, 0.340816766f},
-std::array<float,2>{0.7905671f, 0.723588347f},
-std::array<float,2>{0.533911228f, 0.244433627f},
-std::array<float,2>{0.279362381f, 0.757652462f},
-std::array<float,2>{0.470599383f, 0.0102163749f},
-std::array<float,2>{0.643345952f, 0.978885412f},
-std::array<float,2>{0.970285475f, 0.398971736f},
-std::array<float,2>{0.148515075f, 0.536217034f},
-std::array<float,2>{0.322110176f, 0.27525717f},
-std::array<float,2>{0.579891086f, 0.662299156f},
-std::array<float,2>{0.865043104f, 0.161579773f},
-std::array<float,2>{0.120300792f, 0.848261535f},
-std::array<float,2>{0.196912259f, 0.0666369051f},
-std::array<float,2>{0.891186357f, 0.884966612f},
-std::array<float,2>{0.721877992f, 0.459668308f},
-std::array<float,2>{0.379419595f, 0.604615092f},
-std::array<float,2>{0.0593345314f, 0.392080426f},
-std::array<float,2>{0.776583612f, 0.544191957f},
-std::array<float,2>{0.516031563f, 0.00326527632f},
-std::array<float,2>{0.311617136f, 0.969155133f},
-std::array<float,2>{0.448364973f, 0.235956311f},
-std::array<float,2>{0.676338136f, 0.764685929f},
-std::array<float,2>{0.953903615f, 0.328211695f},
-std::array<float,2>{0.177401379f, 0.727062881f},
-std::array<float,2>{0.431382f, 0.480056435f},
-std::array<float,2>{0.698152006f, 0.570425332f},
-std::array<float,2>{0.935150743f, 0.109254643f},
-std::array<float,2>{0.224972412f, 0.924322486f},
-std::array<float,2>{0.067866303f, 0.147977039f},
-std::array<float,2>{0.821833432f, 0.815645635f},
-std::array<float,2>{0.607665658f, 0.294600338f},
-std::array<float,2>{0.345142722f, 0.643799603f},
-std::array<float,2>{0.147328779f, 0.359057307f},
-std::array<float,2>{0.980199158f, 0.700885653f},
-std::array<float,2>{0.653891385f, 0.190265656f},
-std::array<float,2>{0.483769834f, 0.795194745f},
-std::array<float,2>{0.27180323f, 0.0594570227f},
-std::array<float,2>{0.543431878f, 0.941459596f},
-std::array<float,2>{0.787840843f, 0.414981306f},
-std::array<float,2>{0.0277006961f, 0.509266913f},
-std::array<float,2>{0.492222846f, 0.313113749f},
-std::array<float,2>{0.638034523f, 0.735650361f},
-std::array<float,2>{0.992947161f, 0.233705238f},
-std::array<float,2>{0.133136168f, 0.768545032f},
-std::array<float,2>{0.000339175516f, 0.0226226728f},
-std::array<float,2>{0.796980023f, 0.996896625f},
-std::array<float,2>{0.553136945f, 0.375052392f},
-std::array<float,2>{0.262769222f, 0.548833966f},
-std::array<float,2>{0.242405072f, 0.446343482f},
-std::array<float,2>{0.907274663f, 0.6175735f},
-std::array<float,2>{0.717082739f, 0.0847974569f},
-std::array<float,2>{0.408905804f, 0.890695333f},
-std::array<float,2>{0.365596175f, 0.183159247f},
-std::array<float,2>{0.611877739f, 0.862944663f},
-std::array<float,2>{0.837267876f, 0.265148997f},
-std::array<float,2>{0.0856828466f, 0.677085936f},
-std::array<float,2>{0.281621456f, 0.4370251f},
-std::array<float,2>{0.508310676f, 0.522539258f},
-std::array<float,2>{0.765352905f, 0.0350852385f},
-std::array<float,2>{0.0379383639f, 0.95608288f},
-std::array<float,2>{0.169961482f, 0.209133357f},
-std::array<float,2>{0.946259797f, 0.811147451f},
-std::array<float,2>{0.659419298f, 0.368072599f},
-std::array<float,2>{0.46610114f, 0.715605438f},
-std::array<float,2>{0.106205896f, 0.310244381f},
-std::array<float,2>{0.848079026f, 0.626944005f},
-std::array<float,2>{0.568826258f, 0.137532428f},
-std::array<float,2>{0.329185754f, 0.830148578f},
-std::array<float,2>{0.39814803f, 0.10968823f},
-std::array<float,2>{0.738115489f, 0.918727815f},
-std::array<float,2>{0.875669301f, 0.487075567f},
-std::array<float,2>{0.218601361f, 0.59259522f},
-std::array<float,2>{0.338476717f, 0.352009058f},
-std::array<float,2>{0.57501179f, 0.698824644f},
-std::array<float,2>{0.856236041f, 0.192438602f},
-std::array<float,2>{0.0979275778f, 0.792242229f},
-std::array<float,2>{0.205969155f, 0.0556018092f},
-std::array<float,2>{0.890215993f, 0.939983249f},
-std::array<float,2>{0.748800278f, 0.421192944f},
-std::array<float,2>{0.401961684f, 0.51510781f},
-std::array<float,2>{0.0417541601f, 0.481074274f},
-std::array<float,2>{0.751649678f, 0.576924682f},
-std::array<float,2>{0.501111865f, 0.104095615f},
-std::array<float,2>{0.295449883f, 0.926478326f},
-std::array<float,2>{0.457189858f, 0.141761616f},
-std::array<float,2>{0.67110163f, 0.817041337f},
-std::array<float,2>{0.93933171f, 0.291979253f},
-std::array<float,2>{0.159290627f, 0.645875216f},
-std::array<float,2>{0.418587238f, 0.396398276f},
-std::array<float,2>{0.709975362f, 0.541568398f},
-std::array<float,2>{0.914900959f, 0.00691411179f},
-std::array<float,2>{0.240451306f, 0.974993169f},
-std::array<float,2>{0.0874172449f, 0.238782257f},
-std::array<float,2>{0.831589997f, 0.76071471f},
-std::array<float,2>{0.621126115f, 0.333534032f},
-std::array<float,2>{0.369908124f, 0.73079735f},
-std::array<float,2>{0.127246827f, 0.280148059f},
-std::array<float,2>{0.984448671f, 0.656414986f},
-std::array<float,2>{0.62646842f, 0.158968911f},
-std::array<float,2>{0.485748947f, 0.845219553f},
-std::array<float,2>{0.25505808f, 0.0654685721f},
-std::array<float,2>{0.554919958f, 0.887575328f},
-std::array<float,2>{0.808617294f, 0.453855276f},
-std::array<float,2>{0.00899551995f, 0.60824126f},
-std::array<float,2>{0.474412501f, 0.307959437f},
-std::array<float,2>{0.646685958f, 0.631012797f},
-std::array<float,2>{0.974781513f, 0.134803861f},
-std::array<float,2>{0.154129848f, 0.832440555f},
-std::array<float,2>{0.0223847255f, 0.116163127f},
-std::array<float,2>{0.79403156f, 0.91748184f},
-std::array<float,2>{0.535933554f, 0.489300787f},
-std::array<float,2>{0.274241865f, 0.58665055f},
-std::array<float,2>{0.229071558f, 0.430360109f},
-std::array<float,2>{0.92640835f, 0.516126812f},
-std::array<float,2>{0.689816475f, 0.0354489312f},
-std::array<float,2>{0.424094856f, 0.960779071f},
-std::array<float,2>{0.357417762f, 0.205570653f},
-std::array<float,2>{0.599366009f, 0.80512625f},
-std::array<float,2>{0.817730486f, 0.372931182f},
-std::array<float,2>{0.0715418532f, 0.714372993f},
-std::array<float,2>{0.300155401f, 0.451907128f},
-std::array<float,2>{0.529839933f, 0.624880612f},
-std::array<float,2>{0.770887673f, 0.0817556083f},
-std::array<float,2>{0.0529909506f, 0.895405114f},
-std::array<float,2>{0.185543939f, 0.18468295f},
-std::array<float,2>{0.963238657f, 0.865902424f},
-std::array<float,2>{0.682240307f, 0.260856837f},
-std::array<float,2>{0.441166669f, 0.67418021f},
-std::array<float,2>{0.112824231f, 0.320246011f},
-std::array<float,2>{0.873757362f, 0.738405287f},
-std::array<float,2>{0.593564987f, 0.228664547f},
-std::array<float,2>{0.319496423f, 0.770663679f},
-std::array<float,2>{0.385202557f, 0.017591903f},
-std::array<float,2>{0.732136965f, 0.994535208f},
-std::array<float,2>{0.900445461f, 0.380832702f},
-std::array<float,2>{0.189997271f, 0.554504454f},
-std::array<float,2>{0.266804338f, 0.254609138f},
-std::array<float,2>{0.539894998f, 0.681730151f},
-std::array<float,2>{0.784136713f, 0.176532954f},
-std::array<float,2>{0.0239907559f, 0.868614316f},
-std::array<float,2>{0.141307727f, 0.0916856527f},
-std::array<float,2>{0.984249473f, 0.903184414f},
-std::array<float,2>{0.64937216f, 0.438901514f},
-std::array<float,2>{0.479685724f, 0.615109205f},
-std::array<float,2>{0.0645970851f, 0.387174696f},
-std::array<float,2>{0.825040758f, 0.556955695f},
-std::array<float,2>{0.6029706f, 0.0307252426f},
-std::array<float,2>{0.351533622f, 0.987353384f},
-std::array<float,2>{0.435070068f, 0.225618333f},
-std::array<float,2>{0.701560557f, 0.778720915f},
-std::array<float,2>{0.931779683f, 0.323114723f},
-std::array<float,2>{0.221396953f, 0.743151426f},
-std::array<float,2>{0.451262891f, 0.495598435f},
-std::array<float,2>{0.675116241f, 0.58168453f},
-std::array<float,2>{0.959122658f, 0.124232344f},
-std::array<float,2>{0.172413558f, 0.910868943f},
-std::array<float,2>{0.0580016747f, 0.132476598f},
-std::array<float,2>{0.780981243f, 0.843260229f},
-std::array<float,2>{0.521376073f, 0.301970422f},
-std::array<float,2>{0.307912767f, 0.638703048f},
-std::array<float,2>{0.202744767f, 0.36180985f},
-std::array<float,2>{0.896615446f, 0.706688225f},
-std::array<float,2>{0.724008918f, 0.216039091f},
-std::array<float,2>{0.377385885f, 0.796910644f},
-std::array<float,2>{0.325124979f, 0.042879127f},
-std::array<float,2>{0.58252275f, 0.968449116f},
-std::array<float,2>{0.861723661f, 0.426824063f},
-std::array<float,2>{0.122206435f, 0.528122306f},
-std::array<float,2>{0.392839402f, 0.339624763f},
-std::array<float,2>{0.741683245f, 0.721787393f},
-std::array<float,2>{0.879942179f, 0.249424219f},
-std::array<float,2>{0.211923614f, 0.75039041f},
-std::array<float,2>{0.104942925f, 0.0118436785f},
-std::array<float,2>{0.845207214f, 0.982325554f},
-std::array<float,2>{0.564139068f, 0.406238973f},
-std::array<float,2>{0.33345741f, 0.532008886f},
-std::array<float,2>{0.165480971f, 0.466909438f},
-std::array<float,2>{0.949482143f, 0.597227812f},
-std::array<float,2>{0.662918448f, 0.0742980763f},
-std::array<float,2>{0.464438379f, 0.881142378f},
-std::array<float,2>{0.285966843f, 0.164112508f},
-std::array<float,2>{0.512244284f, 0.852100074f},
-std::array<float,2>{0.760647714f, 0.267039299f},
-std::array<float,2>{0.0318584777f, 0.665116906f},
-std::array<float,2>{0.361951828f, 0.408211648f},
-std::array<float,2>{0.616908908f, 0.505058944f},
-std::array<float,2>{0.841077805f, 0.0471222624f},
-std::array<float,2>{0.0786324665f, 0.952650368f},
-std::array<float,2>{0.246674418f, 0.198181167f},
-std::array<float,2>{0.91055876f, 0.781460166f},
-std::array<float,2>{0.712732852f, 0.34666723f},
-std::array<float,2>{0.412032664f, 0.693010151f},
-std::array<float,2>{0.00704391068f, 0.287266135f},
-std::array<float,2>{0.80152601f, 0.652949452f},
-std::array<float,2>{0.550411165f, 0.148978338f},
-std::array<float,2>{0.258146286f, 0.824787617f},
-std::array<float,2>{0.499396443f, 0.0975921229f},
-std::array<float,2>{0.636486769f, 0.93108964f},
-std::array<float,2>{0.999672651f, 0.476559639f},
-std::array<float,2>{0.138915002f, 0.563207805f},
-std::array<float,2>{0.292853773f, 0.324307114f},
-std::array<float,2>{0.504164338f, 0.747372806f},
-std::array<float,2>{0.755091906f, 0.220080107f},
-std::array<float,2>{0.0466513485f, 0.775515318f},
-std::array<float,2>{0.16033569f, 0.0242202859f},
-std::array<float,2>{0.943944573f, 0.990773618f},
-std::array<float,2>{0.66660291f, 0.384336323f},
-std::array<float,2>{0.455846071f, 0.559773803f},
-std::array<float,2>{0.0953347757f, 0.443577737f},
-std::array<float,2>{0.854972243f, 0.610419333f},
-std::array<float,2>{0.573177099f, 0.0886496678f},
-std::array<float,2>{0.342773616f, 0.900474548f},
-std::array<float,2>{0.40336886f, 0.172979936f},
-std::array<float,2>{0.745789111f, 0.874800682f},
-std::array<float,2>{0.882941246f, 0.252328843f},
-std::array<float,2>{0.209718108f, 0.684985399f},
-std::array<float,2>{0.491284549f, 0.42338267f},
-std::array<float,2>{0.631163359f, 0.525681913f},
-std::array<float,2>{0.992124021f, 0.0450570732f},
-std::array<float,2>{0.129921749f, 0.960968256f},
-std::array<float,2>{0.0123225385f, 0.213005498f},
-std::array<float,2>{0.807264984f, 0.801282048f},
-std::array<float,2>{0.559644639f, 0.364119649f},
-std::array<float,2>{0.251226068f, 0.708292007f},
-std::array<float,2>{0.236750841f, 0.297168553f},
-std::array<float,2>{0.921630383f, 0.633512378f},
-std::array<float,2>{0.706636488f, 0.128095463f},
-std::array<float,2>{0.414217383f, 0.838123322f},
-std::array<float,2>{0.374025285f, 0.117868267f},
-std::array<float,2>{0.619244099f, 0.906925082f},
-std::array<float,2>{0.835273266f, 0.496982247f},
-std::array<float,2>{0.0921918005f, 0.58279711f},
-std::array<float,2>{0.429156154f, 0.272248209f},
-std::array<float,2>{0.693379223f, 0.671572149f},
-std::array<float,2>{0.925172031f, 0.169368312f},
-std::array<float,2>{0.233304694f, 0.857969701f},
-std::array<float,2>{0.0775332153f, 0.0726149306f},
-std::array<float,2>{0.814369082f, 0.878273606f},
-std::array<float,2>{0.596083343f, 0.46432966f},
-std::array<float,2>{0.35202089f, 0.599715114f},
-std::array<float,2>{0.15044117f, 0.400822312f},
-std::array<float,2>{0.971180856f, 0.538203895f},
-std::array<float,2>{0.640728533f, 0.00785344746f},
-std::array<float,2>{0.470756769f, 0.976585865f},
-std::array<float,2>{0.277781636f, 0.242642984f},
-std::array<float,2>{0.53206712f, 0.754713655f},
-std::array<float,2>{0.792419195f, 0.341832072f},
-std::array<float,2>{0.018536903f, 0.725265563f},
-std::array<float,2>{0.315491974f, 0.471126825f},
-std::array<float,2>{0.589793086f, 0.569613218f},
-std::array<float,2>{0.870203972f, 0.0991358906f},
-std::array<float,2>{0.116409868f, 0.935552657f},
-std::array<float,2>{0.194437414f, 0.153657362f},
-std::array<float,2>{0.90549016f, 0.821461916f},
-std::array<float,2>{0.729422092f, 0.282979071f},
-std::array<float,2>{0.389969617f, 0.648681223f},
-std::array<float,2>{0.0483087637f, 0.348017365f},
-std::array<float,2>{0.769127846f, 0.68765974f},
-std::array<float,2>{0.523857772f, 0.202279419f},
-std::array<float,2>{0.302206606f, 0.787919283f},
-std::array<float,2>{0.442367285f, 0.054386884f},
-std::array<float,2>{0.68608278f, 0.948778272f},
-std::array<float,2>{0.965295792f, 0.411299646f},
-std::array<float,2>{0.181670904f, 0.500270247f},
-std::array<float,2>{0.346911997f, 0.296204448f},
-std::array<float,2>{0.606259763f, 0.640779197f},
-std::array<float,2>{0.823893487f, 0.146307454f},
-std::array<float,2>{0.0697070286f, 0.812815487f},
-std::array<float,2>{0.224317446f, 0.107369527f},
-std::array<float,2>{0.935623586f, 0.92247963f},
-std::array<float,2>{0.696234465f, 0.478418887f},
-std::array<float,2>{0.432603419f, 0.573090315f},
-std::array<float,2>{0.0301623642f, 0.416860074f},
-std::array<float,2>{0.786429286f, 0.510900199f},
-std::array<float,2>{0.545578182f, 0.0622577257f},
-std::array<float,2>{0.271344513f, 0.944684565f},
-std::array<float,2>{0.48096624f, 0.187556878f},
-std::array<float,2>{0.654338717f, 0.793559968f},
-std::array<float,2>{0.977313876f, 0.35609901f},
-std::array<float,2>{0.14647691f, 0.703056395f},
-std::array<float,2>{0.38152945f, 0.458618939f},
-std::array<float,2>{0.720304549f, 0.601945996f},
-std::array<float,2>{0.893045604f, 0.0700387359f},
-std::array<float,2>{0.198475212f, 0.883069038f},
-std::array<float,2>{0.117428064f, 0.163946956f},
-std::array<float,2>{0.866244256f, 0.849711895f},
-std::array<float,2>{0.58126694f, 0.277282715f},
-std::array<float,2>{0.32253319f, 0.661574781f},
-std::array<float,2>{0.17806755f, 0.331576645f},
-std::array<float,2>{0.955830753f, 0.728556573f},
-std::array<float,2>{0.678325534f, 0.237346306f},
-std::array<float,2>{0.446483612f, 0.761884332f},
-std::array<float,2>{0.309046149f, 0.00074570498f},
-std::array<float,2>{0.518589258f, 0.971072912f},
-std::array<float,2>{0.774494529f, 0.393648386f},
-std::array<float,2>{0.0613473356f, 0.545775712f},
-std::array<float,2>{0.467617899f, 0.370700926f},
-std::array<float,2>{0.657588542f, 0.717773736f},
-std::array<float,2>{0.947927415f, 0.207849637f},
-std::array<float,2>{0.16831179f, 0.810194194f},
-std::array<float,2>{0.0355871059f, 0.032352034f},
-std::array<float,2>{0.762763143f, 0.953952491f},
-std::array<float,2>{0.510036767f, 0.434294015f},
-std::array<float,2>{0.284788847f, 0.519817948f},
-std::array<float,2>{0.215003535f, 0.486071467f},
-std::array<float,2>{0.877983391f, 0.591642559f},
-std::array<float,2>{0.735886276f, 0.112368055f},
-std::array<float,2>{0.39564985f, 0.920961261f},
-std::array<float,2>{0.331713289f, 0.140161589f},
-std::array<float,2>{0.566827476f, 0.829285622f},
-std::array<float,2>{0.849677384f, 0.310618073f},
-std::array<float,2>{0.108978584f, 0.627473056f},
-std::array<float,2>{0.265396684f, 0.377106637f},
-std::array<float,2>{0.551815808f, 0.548624098f},
-std::array<float,2>{0.800730884f, 0.0211575143f},
-std::array<float,2>{0.00368584297f, 0.999878883f},
-std::array<float,2>{0.134769842f, 0.232087746f},
-std::array<float,2>{0.994671464f, 0.767281234f},
-std::array<float,2>{0.638985932f, 0.315582871f},
-std::array<float,2>{0.494484782f, 0.736896932f},
-std::array<float,2>{0.0826032832f, 0.263513833f},
-std::array<float,2>{0.839808762f, 0.67905128f},
-std::array<float,2>{0.610050619f, 0.180263251f},
-std::array<float,2>{0.363941401f, 0.860379219f},
-std::array<float,2>{0.407453418f, 0.0828085169f},
-std::array<float,2>{0.715439439f, 0.893183708f},
-std::array<float,2>{0.909012079f, 0.448590934f},
-std::array<float,2>{0.24516125f, 0.620715439f},
-std::array<float,2>{0.31924808f, 0.3180224f},
-std::array<float,2>{0.591939747f, 0.740314722f},
-std::array<float,2>{0.874604225f, 0.228269666f},
-std::array<float,2>{0.11197941f, 0.771716833f},
-std::array<float,2>{0.191106886f, 0.015798578f},
-std::array<float,2>{0.901667774f, 0.993316352f},
-std::array<float,2>{0.730741382f, 0.38279894f},
-std::array<float,2>{0.386653304f, 0.550958753f},
-std::array<float,2>{0.0538963079f, 0.450268507f},
-std::array<float,2>{0.769718111f, 0.6214149f},
-std::array<float,2>{0.531072199f, 0.0792577118f},
-std::array<float,2>{0.298940063f, 0.896649718f},
-std::array<float,2>{0.440088421f, 0.186203152f},
-std::array<float,2>{0.683273852f, 0.864054739f},
-std::array<float,2>{0.964477241f, 0.25863114f},
-std::array<float,2>{0.18450813f, 0.673736453f},
-std::array<float,2>{0.425514221f, 0.431640923f},
-std::array<float,2>{0.691404402f, 0.519466519f},
-std::array<float,2>{0.927465737f, 0.0389271341f},
-std::array<float,2>{0.22991699f, 0.957932413f},
-std::array<float,2>{0.0710286573f, 0.203919411f},
-std::array<float,2>{0.816476941f, 0.807967544f},
-std::array<float,2>{0.598275721f, 0.373481601f},
-std::array<float,2>{0.356128722f, 0.712738216f},
-std::array<float,2>{0.153000727f, 0.304962218f},
-std::array<float,2>{0.975842834f, 0.630783558f},
-std::array<float,2>{0.647618115f, 0.133726165f},
-std::array<float,2>{0.473276854f, 0.834815741f},
-std::array<float,2>{0.27530694f, 0.114927851f},
-std::array<float,2>{0.536290586f, 0.915100455f},
-std::array<float,2>{0.793001473f, 0.490676761f},
-std::array<float,2>{0.0226758402f, 0.589119673f},
-std::array<float,2>{0.484485328f, 0.279012948f},
-std::array<float,2>{0.625354409f, 0.65938127f},
-std::array<float,2>{0.98564893f, 0.157035127f},
-std::array<float,2>{0.128893301f, 0.84659946f},
-std::array<float,2>{0.00871696137f, 0.0636698306f},
-std::array<float,2>{0.809992194f, 0.890043795f},
-std::array<float,2>{0.556420684f, 0.455794364f},
-std::array<float,2>{0.25477618f, 0.606730044f},
-std::array<float,2>{0.241405934f, 0.398150116f},
-std::array<float,2>{0.915111601f, 0.540760636f},
-std::array<float,2>{0.709127426f, 0.00518627418f},
-std::array<float,2>{0.41908434f, 0.973757863f},
-std::array<float,2>{0.370166361f, 0.241826013f},
-std::array<float,2>{0.622974873f, 0.759420216f},
-std::array<float,2>{0.830756128f, 0.334561825f},
-std::array<float,2>{0.0861055925f, 0.733710766f},
-std::array<float,2>{0.296652317f, 0.482664198f},
-std::array<float,2>{0.500050008f, 0.574716032f},
-std::array<float,2>{0.750358462f, 0.102138385f},
-std::array<float,2>{0.0421625674f, 0.929376841f},
-std::array<float,2>{0.158206344f, 0.142849207f},
-std::array<float,2>{0.937515438f, 0.819124818f},
-std::array<float,2>{0.670682967f, 0.290828526f},
-std::array<float,2>{0.458027482f, 0.647112191f},
-std::array<float,2>{0.099310413f, 0.354007989f},
-std::array<float,2>{0.857058167f, 0.695964694f},
-std::array<float,2>{0.576049149f, 0.195061713f},
-std::array<float,2>{0.339662552f, 0.790202916f},
-std::array<float,2>{0.400984019f, 0.0569332652f},
-std::array<float,2>{0.749328375f, 0.938474774f},
-std::array<float,2>{0.889647365f, 0.418973505f},
-std::array<float,2>{0.207014829f, 0.512294471f},
-std::array<float,2>{0.258804739f, 0.285675466f},
-std::array<float,2>{0.549520552f, 0.655339539f},
-std::array<float,2>{0.80185324f, 0.152280584f},
-std::array<float,2>{0.00666978071f, 0.826404989f},
-std::array<float,2>{0.139749542f, 0.0956571549f},
-std::array<float,2>{0.99885112f, 0.932857931f},
-std::array<float,2>{0.635378122f, 0.472947299f},
-std::array<float,2>{0.498620123f, 0.565379977f},
-std::array<float,2>{0.0799569786f, 0.406416357f},
-std::array<float,2>{0.840436339f, 0.506380439f},
-std::array<float,2>{0.615305543f, 0.0491040573f},
-std::array<float,2>{0.363135785f, 0.951124489f},
-std::array<float,2>{0.410793424f, 0.195716843f},
-std::array<float,2>{0.711628437f, 0.784710288f},
-std::array<float,2>{0.911758065f, 0.344925195f},
-std::array<float,2>{0.247129381f, 0.694553256f},
-std::array<float,2>{0.463430792f, 0.466579884f},
-std::array<float,2>{0.663170636f, 0.595027745f},
-std::array<float,2>{0.95090723f, 0.077083379f},
-std::array<float,2>{0.164646983f, 0.88075f},
-std::array<float,2>{0.0323664472f, 0.167272389f},
-std::array<float,2>{0.761605263f, 0.854516864f},
-std::array<float,2>{0.513166666f, 0.269465774f},
-std::array<float,2>{0.286141574f, 0.667284608f},
-std::array<float,2>{0.211513072f, 0.336567938f},
-std::array<float,2>{0.8796615f, 0.720335662f},
-std::array<float,2>{0.740610182f, 0.247614324f},
-std::array<float,2>{0.393906862f, 0.752057612f},
-std::array<float,2>{0.332480699f, 0.0155689968f},
-std::array<float,2>{0.562620223f, 0.983216286f},
-std::array<float,2>{0.844701052f, 0.402596444f},
-std::array<float,2>{0.104231946f, 0.534139335f},
-std::array<float,2>{0.378688902f, 0.360521138f},
-std::array<float,2>{0.72337383f, 0.70373857f},
-std::array<float,2>{0.897917688f, 0.217345953f},
-std::array<float,2>{0.201366469f, 0.800340652f},
-std::array<float,2>{0.121510029f, 0.0407553613f},
-std::array<float,2>{0.862756371f, 0.966662943f},
-std::array<float,2>{0.583724141f, 0.428964615f},
-std::array<float,2>{0.325772464f, 0.530056834f},
-std::array<float,2>{0.173050821f, 0.493391931f},
-std::array<float,2>{0.960112751f, 0.579698503f},
-std::array<float,2>{0.67388314f, 0.121157072f},
-std::array<float,2>{0.452360421f, 0.913823068f},
-std::array<float,2>{0.307547987f, 0.130097777f},
-std::array<float,2>{0.51990056f, 0.841271341f},
-std::array<float,2>{0.779744506f, 0.304617971f},
-std::array<float,2>{0.0568950176f, 0.637923002f},
-std::array<float,2>{0.350222081f, 0.389185846f},
-std::array<float,2>{0.602164924f, 0.556497753f},
-std::array<float,2>{0.825895786f, 0.0280080475f},
-std::array<float,2>{0.065981254f, 0.985521376f},
-std::array<float,2>{0.221999645f, 0.222999722f},
-std::array<float,2>{0.933156848f, 0.780453742f},
-std::array<float,2>{0.702544332f, 0.321369946f},
-std::array<float,2>{0.434386581f, 0.744686663f},
-std::array<float,2>{0.0252232868f, 0.257784814f},
-std::array<float,2>{0.784641206f, 0.680332482f},
-std::array<float,2>{0.540516973f, 0.178771049f},
-std::array<float,2>{0.266110659f, 0.871000171f},
-std::array<float,2>{0.47924152f, 0.0933955535f},
-std::array<float,2>{0.649610817f, 0.905954003f},
-std::array<float,2>{0.982991397f, 0.440362096f},
-std::array<float,2>{0.142426476f, 0.615781903f},
-std::array<float,2>{0.301629603f, 0.350331396f},
-std::array<float,2>{0.524795651f, 0.69119662f},
-std::array<float,2>{0.76768893f, 0.200160474f},
-std::array<float,2>{0.0476180725f, 0.786310613f},
-std::array<float,2>{0.18323113f, 0.0508995615f},
-std::array<float,2>{0.966348886f, 0.945964038f},
-std::array<float,2>{0.687282681f, 0.412693799f},
-std::array<float,2>{0.442758888f, 0.50202924f},
-std::array<float,2>{0.115571998f, 0.469665378f},
-std::array<float,2>{0.870112419f, 0.567759871f},
-std::array<float,2>{0.588219941f, 0.100952208f},
-std::array<float,2>{0.315279126f, 0.934792936f},
-std::array<float,2>{0.389503866f, 0.155263916f},
-std::array<float,2>{0.729556739f, 0.822667718f},
-std::array<float,2>{0.904932797f, 0.284653783f},
-std::array<float,2>{0.193930224f, 0.651680231f},
-std::array<float,2>{0.471743375f, 0.400322884f},
-std::array<float,2>{0.641627252f, 0.536097288f},
-std::array<float,2>{0.97259295f, 0.0111425677f},
-std::array<float,2>{0.151962847f, 0.979685664f},
-std::array<float,2>{0.0193845481f, 0.246033013f},
-std::array<float,2>{0.791379869f, 0.755972266f},
-std::array<float,2>{0.532386184f, 0.341738939f},
-std::array<float,2>{0.278687984f, 0.724563718f},
-std::array<float,2>{0.234165177f, 0.270219266f},
-std::array<float,2>{0.924785674f, 0.668505669f},
-std::array<float,2>{0.6943537f, 0.170467988f},
-std::array<float,2>{0.42783612f, 0.856334805f},
-std::array<float,2>{0.352811813f, 0.0705908611f},
-std::array<float,2>{0.596691251f, 0.876694798f},
-std::array<float,2>{0.813370228f, 0.462361187f},
-std::array<float,2>{0.0762813091f, 0.59954524f},
-std::array<float,2>{0.415710241f, 0.299290836f},
-std::array<float,2>{0.705335677f, 0.636160076f},
-std::array<float,2>{0.920669675f, 0.125511155f},
-std::array<float,2>{0.238010973f, 0.836524427f},
-std::array<float,2>{0.09344621f, 0.119817577f},
-std::array<float,2>{0.834844589f, 0.908397019f},
-std::array<float,2>{0.620709062f, 0.498356342f},
-std::array<float,2>{0.373573363f, 0.583999872f},
-std::array<float,2>{0.128998145f, 0.425685346f},
-std::array<float,2>{0.990991056f, 0.524266362f},
-std::array<float,2>{0.632523298f, 0.0436672196f},
-std::array<float,2>{0.490844071f, 0.964676619f},
-std::array<float,2>{0.250648588f, 0.211484313f},
-std::array<float,2>{0.559157431f, 0.80462116f},
-std::array<float,2>{0.808099926f, 0.366178513f},
-std::array<float,2>{0.0135339461f, 0.710546434f},
-std::array<float,2>{0.342757255f, 0.442588687f},
-std::array<float,2>{0.574097335f, 0.612809241f},
-std::array<float,2>{0.853916824f, 0.086074248f},
-std::array<float,2>{0.0946499035f, 0.899066865f},
-std::array<float,2>{0.210858807f, 0.175277159f},
-std::array<float,2>{0.884514272f, 0.871638358f},
-std::array<float,2>{0.744148195f, 0.251535267f},
-std::array<float,2>{0.402391583f, 0.68586427f},
-std::array<float,2>{0.0450196601f, 0.326788574f},
-std::array<float,2>{0.754799187f, 0.748740911f},
-std::array<float,2>{0.50534004f, 0.222543463f},
-std::array<float,2>{0.291930556f, 0.774803996f},
-std::array<float,2>{0.45701021f, 0.0254557543f},
-std::array<float,2>{0.667230129f, 0.989737332f},
-std::array<float,2>{0.944827735f, 0.386500031f},
-std::array<float,2>{0.161629692f, 0.561149955f},
-std::array<float,2>{0.364654362f, 0.263948828f},
-std::array<float,2>{0.611131489f, 0.676532328f},
-std::array<float,2>{0.838832974f, 0.181745067f},
-std::array<float,2>{0.0831288248f, 0.86156702f},
-std::array<float,2>{0.244240195f, 0.0855725706f},
-std::array<float,2>{0.909625828f, 0.892267704f},
-std::array<float,2>{0.716156423f, 0.445423037f},
-std::array<float,2>{0.406940699f, 0.618809164f},
-std::array<float,2>{0.00242437329f, 0.376337498f},
-std::array<float,2>{0.799624085f, 0.550704241f},
-std::array<float,2>{0.551050365f, 0.0217325166f},
-std::array<float,2>{0.264061451f, 0.997612476f},
-std::array<float,2>{0.495793581f, 0.233176008f},
-std::array<float,2>{0.639960408f, 0.769269228f},
-std::array<float,2>{0.995331049f, 0.314182431f},
-std::array<float,2>{0.136340931f, 0.734536469f},
-std::array<float,2>{0.395381778f, 0.487357974f},
-std::array<float,2>{0.735022128f, 0.593552649f},
-std::array<float,2>{0.877753139f, 0.110888131f},
-std::array<float,2>{0.216465622f, 0.919037879f},
-std::array<float,2>{0.108174495f, 0.138264924f},
-std::array<float,2>{0.851423621f, 0.831710041f},
-std::array<float,2>{0.567574322f, 0.309042811f},
-std::array<float,2>{0.330884188f, 0.625417173f},
-std::array<float,2>{0.169873178f, 0.368808985f},
-std::array<float,2>{0.949093521f, 0.716080487f},
-std::array<float,2>{0.657002091f, 0.210575387f},
-std::array<float,2>{0.467874527f, 0.812457502f},
-std::array<float,2>{0.283416182f, 0.0333041102f},
-std::array<float,2>{0.511460781f, 0.955990553f},
-std::array<float,2>{0.762257457f, 0.436060131f},
-std::array<float,2>{0.0370373353f, 0.522320509f},
-std::array<float,2>{0.445995301f, 0.329890281f},
-std::array<float,2>{0.679003179f, 0.727627516f},
-std::array<float,2>{0.956729829f, 0.234407514f},
-std::array<float,2>{0.179091156f, 0.764386714f},
-std::array<float,2>{0.0622104406f, 0.00200870889f},
-std::array<float,2>{0.774357677f, 0.970223308f},
-std::array<float,2>{0.518483996f, 0.391463727f},
-std::array<float,2>{0.30961287f, 0.543899417f},
-std::array<float,2>{0.198110595f, 0.460707337f},
-std::array<float,2>{0.894083619f, 0.60448879f},
-std::array<float,2>{0.719186723f, 0.0682341754f},
-std::array<float,2>{0.382645488f, 0.886072576f},
-std::array<float,2>{0.323474288f, 0.160755217f},
-std::array<float,2>{0.580339551f, 0.849281847f},
-std::array<float,2>{0.865718424f, 0.273493379f},
-std::array<float,2>{0.118205309f, 0.664051652f},
-std::array<float,2>{0.270179152f, 0.415096581f},
-std::array<float,2>{0.546752274f, 0.508631468f},
-std::array<float,2>{0.785348296f, 0.0604366474f},
-std::array<float,2>{0.030396726f, 0.94242698f},
-std::array<float,2>{0.145322874f, 0.190450892f},
-std::array<float,2>{0.978482306f, 0.795960784f},
-std::array<float,2>{0.655391753f, 0.357844919f},
-std::array<float,2>{0.482076764f, 0.699320495f},
-std::array<float,2>{0.0686338022f, 0.293094695f},
-std::array<float,2>{0.822486639f, 0.642585099f},
-std::array<float,2>{0.60701561f, 0.147171751f},
-std::array<float,2>{0.346416116f, 0.815341115f},
-std::array<float,2>{0.433200061f, 0.10752926f},
-std::array<float,2>{0.696354628f, 0.925694227f},
-std::array<float,2>{0.937283754f, 0.479176223f},
-std::array<float,2>{0.223285958f, 0.572156131f},
-std::array<float,2>{0.358414084f, 0.371985555f},
-std::array<float,2>{0.601149023f, 0.713800788f},
-std::array<float,2>{0.818765342f, 0.206822157f},
-std::array<float,2>{0.0732137561f, 0.806287646f},
-std::array<float,2>{0.227311283f, 0.0364347547f},
-std::array<float,2>{0.929308355f, 0.959378183f},
-std::array<float,2>{0.688701212f, 0.431044787f},
-std::array<float,2>{0.422269642f, 0.517131388f},
-std::array<float,2>{0.0212905761f, 0.488899767f},
-std::array<float,2>{0.796228588f, 0.586958647f},
-std::array<float,2>{0.537684202f, 0.116894215f},
-std::array<float,2>{0.276535273f, 0.916721284f},
-std::array<float,2>{0.474698395f, 0.135993361f},
-std::array<float,2>{0.645215034f, 0.833766937f},
-std::array<float,2>{0.974204779f, 0.307151169f},
-std::array<float,2>{0.155137032f, 0.632296026f},
-std::array<float,2>{0.383618683f, 0.379878104f},
-std::array<float,2>{0.733654261f, 0.552825868f},
-std::array<float,2>{0.900058031f, 0.0189231578f},
-std::array<float,2>{0.188893154f, 0.995152175f},
-std::array<float,2>{0.110446416f, 0.229841635f},
-std::array<float,2>{0.87225008f, 0.770134211f},
-std::array<float,2>{0.590877652f, 0.319013774f},
-std::array<float,2>{0.316773862f, 0.740170956f},
-std::array<float,2>{0.186704934f, 0.260309994f},
-std::array<float,2>{0.961608171f, 0.675666273f},
-std::array<float,2>{0.680390775f, 0.183932185f},
-std::array<float,2>{0.438103318f, 0.866764963f},
-std::array<float,2>{0.297019452f, 0.0807433426f},
-std::array<float,2>{0.528263211f, 0.896298945f},
-std::array<float,2>{0.772890747f, 0.452803493f},
-std::array<float,2>{0.051450938f, 0.623546422f},
-std::array<float,2>{0.458985537f, 0.292866886f},
-std::array<float,2>{0.668488979f, 0.644582689f},
-std::array<float,2>{0.939880967f, 0.14102377f},
-std::array<float,2>{0.157232031f, 0.818348169f},
-std::array<float,2>{0.0401945673f, 0.105176374f},
-std::array<float,2>{0.752482533f, 0.926823974f},
-std::array<float,2>{0.502822399f, 0.482343286f},
-std::array<float,2>{0.294608086f, 0.577159286f},
-std::array<float,2>{0.20396547f, 0.420686007f},
-std::array<float,2>{0.888267219f, 0.514458001f},
-std::array<float,2>{0.746878088f, 0.055795487f},
-std::array<float,2>{0.398552895f, 0.94119525f},
-std::array<float,2>{0.33651185f, 0.192298532f},
-std::array<float,2>{0.576318622f, 0.791823506f},
-std::array<float,2>{0.858261168f, 0.352816641f},
-std::array<float,2>{0.100835755f, 0.698018491f},
-std::array<float,2>{0.257019252f, 0.454666764f},
-std::array<float,2>{0.556879044f, 0.609297335f},
-std::array<float,2>{0.811873853f, 0.0647940636f},
-std::array<float,2>{0.0100277578f, 0.888333917f},
-std::array<float,2>{0.125428692f, 0.159799859f},
-std::array<float,2>{0.98689878f, 0.844171464f},
-std::array<float,2>{0.628060997f, 0.280560493f},
-std::array<float,2>{0.488240421f, 0.658171594f},
-std::array<float,2>{0.0891682059f, 0.332550257f},
-std::array<float,2>{0.829499781f, 0.731910288f},
-std::array<float,2>{0.624079347f, 0.239270955f},
-std::array<float,2>{0.367599696f, 0.761488736f},
-std::array<float,2>{0.420775115f, 0.00660861796f},
-std::array<float,2>{0.708068132f, 0.975926042f},
-std::array<float,2>{0.91680938f, 0.395479143f},
-std::array<float,2>{0.239574045f, 0.542737365f},
-std::array<float,2>{0.287151247f, 0.266139388f},
-std::array<float,2>{0.514548182f, 0.664868236f},
-std::array<float,2>{0.757904589f, 0.165153638f},
-std::array<float,2>{0.0348725803f, 0.852896094f},
-std::array<float,2>{0.167588413f, 0.0752820298f},
-std::array<float,2>{0.951856673f, 0.881899297f},
-std::array<float,2>{0.660338938f, 0.468442768f},
-std::array<float,2>{0.462310553f, 0.596584678f},
-std::array<float,2>{0.10348513f, 0.404930472f},
-std::array<float,2>{0.846262813f, 0.53294462f},
-std::array<float,2>{0.565595388f, 0.0129962489f},
-std::array<float,2>{0.335442752f, 0.981334507f},
-std::array<float,2>{0.391189337f, 0.248596787f},
-std::array<float,2>{0.738809109f, 0.751284599f},
-std::array<float,2>{0.882810533f, 0.338165969f},
-std::array<float,2>{0.213298976f, 0.720837355f},
-std::array<float,2>{0.496632516f, 0.474858016f},
-std::array<float,2>{0.633933485f, 0.564183176f},
-std::array<float,2>{0.996135473f, 0.0964278579f},
-std::array<float,2>{0.138571411f, 0.929825902f},
-std::array<float,2>{0.00554110855f, 0.149718165f},
-std::array<float,2>{0.803495467f, 0.826064229f},
-std::array<float,2>{0.548176408f, 0.288275301f},
-std::array<float,2>{0.261484742f, 0.653818667f},
-std::array<float,2>{0.248445168f, 0.347625047f},
-std::array<float,2>{0.912882388f, 0.691487432f},
-std::array<float,2>{0.712966084f, 0.19898437f},
-std::array<float,2>{0.413584381f, 0.782672822f},
-std::array<float,2>{0.360113055f, 0.0483443663f},
-std::array<float,2>{0.613817513f, 0.951372921f},
-std::array<float,2>{0.841851234f, 0.409472764f},
-std::array<float,2>{0.0803200528f, 0.50460124f},
-std::array<float,2>{0.436878115f, 0.323261112f},
-std::array<float,2>{0.69975394f, 0.743258178f},
-std::array<float,2>{0.931029737f, 0.225487679f},
-std::array<float,2>{0.219721019f, 0.778154254f},
-std::array<float,2>{0.0639190599f, 0.0300370902f},
-std::array<float,2>{0.82779634f, 0.98646909f},
-std::array<float,2>{0.603636444f, 0.388286769f},
-std::array<float,2>{0.348089039f, 0.558023214f},
-std::array<float,2>{0.14409782f, 0.43816191f},
-std::array<float,2>{0.982218981f, 0.613886535f},
-std::array<float,2>{0.650401175f, 0.0900852308f},
-std::array<float,2>{0.477445066f, 0.904212713f},
-std::array<float,2>{0.267733067f, 0.176841721f},
-std::array<float,2>{0.542236686f, 0.867612064f},
-std::array<float,2>{0.782035947f, 0.255841285f},
-std::array<float,2>{0.0264744796f, 0.682946503f},
-std::array<float,2>{0.327229291f, 0.425872028f},
-std::array<float,2>{0.585568786f, 0.528622806f},
-std::array<float,2>{0.859973431f, 0.0414571874f},
-std::array<float,2>{0.124222875f, 0.967525184f},
-std::array<float,2>{0.200455353f, 0.215522572f},
-std::array<float,2>{0.8964082f, 0.797955573f},
-std::array<float,2>{0.724704921f, 0.362323999f},
-std::array<float,2>{0.376894593f, 0.705312431f},
-std::array<float,2>{0.055449158f, 0.301554084f},
-std::array<float,2>{0.77880466f, 0.639820516f},
-std::array<float,2>{0.522490561f, 0.131704226f},
-std::array<float,2>{0.304935753f, 0.842762291f},
-std::array<float,2>{0.450408936f, 0.123880073f},
-std::array<float,2>{0.671898901f, 0.911885679f},
-std::array<float,2>{0.958870411f, 0.494220048f},
-std::array<float,2>{0.175450206f, 0.580781937f},
-std::array<float,2>{0.281186968f, 0.343330592f},
-std::array<float,2>{0.534410238f, 0.725746155f},
-std::array<float,2>{0.789450765f, 0.243964538f},
-std::array<float,2>{0.0174905341f, 0.755515575f},
-std::array<float,2>{0.150073156f, 0.00913169608f},
-std::array<float,2>{0.968876302f, 0.978064775f},
-std::array<float,2>{0.6442132f, 0.402047604f},
-std::array<float,2>{0.469326973f, 0.537925541f},
-std::array<float,2>{0.0755812228f, 0.463339597f},
-std::array<float,2>{0.815117538f, 0.600590825f},
-std::array<float,2>{0.593959749f, 0.073429659f},
-std::array<float,2>{0.354854882f, 0.877302408f},
-std::array<float,2>{0.427023172f, 0.16812399f},
-std::array<float,2>{0.691798925f, 0.858843446f},
-std::array<float,2>{0.92290765f, 0.272617906f},
-std::array<float,2>{0.230710596f, 0.669969261f},
-std::array<float,2>{0.443632454f, 0.410746843f},
-std::array<float,2>{0.684517086f, 0.501491547f},
-std::array<float,2>{0.967699945f, 0.0536663942f},
-std::array<float,2>{0.180701047f, 0.947877049f},
-std::array<float,2>{0.0503074415f, 0.201916054f},
-std::array<float,2>{0.766854465f, 0.788496614f},
-std::array<float,2>{0.526599526f, 0.349424183f},
-std::array<float,2>{0.303682566f, 0.688510299f},
-std::array<float,2>{0.192634135f, 0.282013565f},
-std::array<float,2>{0.904042006f, 0.649782777f},
-std::array<float,2>{0.726831675f, 0.153161272f},
-std::array<float,2>{0.388623744f, 0.820592225f},
-std::array<float,2>{0.314358473f, 0.0982874706f},
-std::array<float,2>{0.587624013f, 0.937116504f},
-std::array<float,2>{0.868673682f, 0.472475201f},
-std::array<float,2>{0.1134395f, 0.56845969f},
-std::array<float,2>{0.405546337f, 0.25371182f},
-std::array<float,2>{0.743688464f, 0.683679163f},
-std::array<float,2>{0.884782851f, 0.172018051f},
-std::array<float,2>{0.207841158f, 0.873478711f},
-std::array<float,2>{0.0974295214f, 0.0891272649f},
-std::array<float,2>{0.852564335f, 0.901718557f},
-std::array<float,2>{0.571271479f, 0.44520992f},
-std::array<float,2>{0.340299308f, 0.610068321f},
-std::array<float,2>{0.163109362f, 0.383214772f},
-std::array<float,2>{0.941982687f, 0.558694303f},
-std::array<float,2>{0.665794075f, 0.0253684558f},
-std::array<float,2>{0.454329908f, 0.991772413f},
-std::array<float,2>{0.2897695f, 0.219403177f},
-std::array<float,2>{0.507788718f, 0.776833951f},
-std::array<float,2>{0.756191254f, 0.32529828f},
-std::array<float,2>{0.0433685482f, 0.746815801f},
-std::array<float,2>{0.372112483f, 0.497693419f},
-std::array<float,2>{0.619025409f, 0.583906412f},
-std::array<float,2>{0.832077563f, 0.118966796f},
-std::array<float,2>{0.0906735808f, 0.907574475f},
-std::array<float,2>{0.234941572f, 0.127906188f},
-std::array<float,2>{0.91967696f, 0.839301944f},
-std::array<float,2>{0.704070449f, 0.298163533f},
-std::array<float,2>{0.417858601f, 0.63471818f},
-std::array<float,2>{0.0156109761f, 0.364536881f},
-std::array<float,2>{0.806218386f, 0.707244158f},
-std::array<float,2>{0.561322093f, 0.214136258f},
-std::array<float,2>{0.253125489f, 0.802291572f},
-std::array<float,2>{0.48833099f, 0.0463049822f},
-std::array<float,2>{0.630095065f, 0.961955369f},
-std::array<float,2>{0.989713907f, 0.422361284f},
-std::array<float,2>{0.131877869f, 0.526402056f},
-std::array<float,2>{0.328377575f, 0.312065125f},
-std::array<float,2>{0.570183277f, 0.628312767f},
-std::array<float,2>{0.849066734f, 0.138921708f},
-std::array<float,2>{0.106703393f, 0.828806043f},
-std::array<float,2>{0.217375785f, 0.112062111f},
-std::array<float,2>{0.876139641f, 0.920623302f},
-std::array<float,2>{0.736735463f, 0.484939426f},
-std::array<float,2>{0.396651506f, 0.590612888f},
-std::array<float,2>{0.0384812318f, 0.435335368f},
-std::array<float,2>{0.764573395f, 0.5210343f},
-std::array<float,2>{0.509211659f, 0.0314275995f},
-std::array<float,2>{0.282667518f, 0.95498997f},
-std::array<float,2>{0.465419322f, 0.208741829f},
-std::array<float,2>{0.658635736f, 0.808900774f},
-std::array<float,2>{0.946611345f, 0.369710296f},
-std::array<float,2>{0.171438128f, 0.717540383f},
-std::array<float,2>{0.409550577f, 0.447603494f},
-std::array<float,2>{0.718185604f, 0.62003988f},
-std::array<float,2>{0.90646559f, 0.0830855221f},
-std::array<float,2>{0.243910477f, 0.893978179f},
-std::array<float,2>{0.0841051862f, 0.18126522f},
-std::array<float,2>{0.836760283f, 0.85962975f},
-std::array<float,2>{0.613006055f, 0.261969298f},
-std::array<float,2>{0.366324127f, 0.678009331f},
-std::array<float,2>{0.133848861f, 0.315165669f},
-std::array<float,2>{0.993181884f, 0.737353861f},
-std::array<float,2>{0.637694061f, 0.230815351f},
-std::array<float,2>{0.493460357f, 0.766540468f},
-std::array<float,2>{0.26200667f, 0.0202101879f},
-std::array<float,2>{0.553968191f, 0.99816978f},
-std::array<float,2>{0.798506796f, 0.378565729f},
-std::array<float,2>{0.00112847472f, 0.547248721f},
-std::array<float,2>{0.482555717f, 0.356861919f},
-std::array<float,2>{0.652872086f, 0.701669455f},
-std::array<float,2>{0.978906453f, 0.188714534f},
-std::array<float,2>{0.147465378f, 0.794739187f},
-std::array<float,2>{0.0284670219f, 0.0611948967f},
-std::array<float,2>{0.788727224f, 0.943723142f},
-std::array<float,2>{0.544401467f, 0.417586625f},
-std::array<float,2>{0.273332447f, 0.510318398f},
-std::array<float,2>{0.225714952f, 0.477476388f},
-std::array<float,2>{0.933848202f, 0.573385179f},
-std::array<float,2>{0.69886452f, 0.105985112f},
-std::array<float,2>{0.429989815f, 0.923234165f},
-std::array<float,2>{0.344069421f, 0.145294487f},
-std::array<float,2>{0.608486891f, 0.81440866f},
-std::array<float,2>{0.820896208f, 0.295225263f},
-std::array<float,2>{0.0671476349f, 0.64160198f},
-std::array<float,2>{0.31077832f, 0.393227756f},
-std::array<float,2>{0.516758382f, 0.546656251f},
-std::array<float,2>{0.775667012f, 0.00192662596f},
-std::array<float,2>{0.0596593954f, 0.971843839f},
-std::array<float,2>{0.176098585f, 0.236673668f},
-std::array<float,2>{0.954778433f, 0.762864649f},
-std::array<float,2>{0.676972806f, 0.330253005f},
-std::array<float,2>{0.447351992f, 0.730209649f},
-std::array<float,2>{0.119664386f, 0.276125103f},
-std::array<float,2>{0.8638376f, 0.660767972f},
-std::array<float,2>{0.578982055f, 0.163071021f},
-std::array<float,2>{0.320929915f, 0.851535022f},
-std::array<float,2>{0.38047719f, 0.068974331f},
-std::array<float,2>{0.721455514f, 0.884616733f},
-std::array<float,2>{0.892043352f, 0.457350612f},
-std::array<float,2>{0.195313051f, 0.603095055f},
-std::array<float,2>{0.365853667f, 0.314342946f},
-std::array<float,2>{0.611785114f, 0.734667659f},
-std::array<float,2>{0.837855339f, 0.233045042f},
-std::array<float,2>{0.0851735547f, 0.769375563f},
-std::array<float,2>{0.243146494f, 0.0216677058f},
-std::array<float,2>{0.908096492f, 0.998005569f},
-std::array<float,2>{0.717576444f, 0.376146823f},
-std::array<float,2>{0.408224612f, 0.550425351f},
-std::array<float,2>{0.000859650609f, 0.445597291f},
-std::array<float,2>{0.797585309f, 0.618946731f},
-std::array<float,2>{0.553585947f, 0.0858512223f},
-std::array<float,2>{0.26335752f, 0.892377555f},
-std::array<float,2>{0.492949307f, 0.181907803f},
-std::array<float,2>{0.638241649f, 0.861638248f},
-std::array<float,2>{0.992667854f, 0.263799846f},
-std::array<float,2>{0.13375026f, 0.676368594f},
-std::array<float,2>{0.397601426f, 0.436341465f},
-std::array<float,2>{0.737466514f, 0.522086799f},
-std::array<float,2>{0.875006616f, 0.0336685814f},
-std::array<float,2>{0.218037173f, 0.955803156f},
-std::array<float,2>{0.105937257f, 0.210899502f},
-std::array<float,2>{0.848583698f, 0.81218791f},
-std::array<float,2>{0.569218576f, 0.369124889f},
-std::array<float,2>{0.329907447f, 0.716010034f},
-std::array<float,2>{0.170796901f, 0.30876413f},
-std::array<float,2>{0.945710778f, 0.625134468f},
-std::array<float,2>{0.659988225f, 0.138483509f},
-std::array<float,2>{0.46644941f, 0.831982851f},
-std::array<float,2>{0.281906575f, 0.111284167f},
-std::array<float,2>{0.507956147f, 0.919399261f},
-std::array<float,2>{0.765103757f, 0.487683773f},
-std::array<float,2>{0.0373436734f, 0.593448102f},
-std::array<float,2>{0.4489564f, 0.273834914f},
-std::array<float,2>{0.676230907f, 0.66378808f},
-std::array<float,2>{0.953517199f, 0.161095336f},
-std::array<float,2>{0.177189022f, 0.84938097f},
-std::array<float,2>{0.0588343404f, 0.0679415092f},
-std::array<float,2>{0.776859462f, 0.885838211f},
-std::array<float,2>{0.516390502f, 0.460551351f},
-std::array<float,2>{0.312404901f, 0.604013026f},
-std::array<float,2>{0.19651024f, 0.391251892f},
-std::array<float,2>{0.890757918f, 0.543531537f},
-std::array<float,2>{0.722169101f, 0.00220965547f},
-std::array<float,2>{0.378996402f, 0.970595956f},
-std::array<float,2>{0.321767777f, 0.234769046f},
-std::array<float,2>{0.579308093f, 0.764488637f},
-std::array<float,2>{0.864668012f, 0.329712719f},
-std::array<float,2>{0.12076728f, 0.72789526f},
-std::array<float,2>{0.27232179f, 0.479416698f},
-std::array<float,2>{0.543759823f, 0.571996152f},
-std::array<float,2>{0.787526965f, 0.107681394f},
-std::array<float,2>{0.0281817093f, 0.925357044f},
-std::array<float,2>{0.146785557f, 0.147312f},
-std::array<float,2>{0.979862392f, 0.815088093f},
-std::array<float,2>{0.653470397f, 0.293287873f},
-std::array<float,2>{0.484143198f, 0.64299798f},
-std::array<float,2>{0.0682111382f, 0.357595444f},
-std::array<float,2>{0.821642458f, 0.69948101f},
-std::array<float,2>{0.608076096f, 0.190689072f},
-std::array<float,2>{0.345514208f, 0.796163857f},
-std::array<float,2>{0.430743873f, 0.0602792948f},
-std::array<float,2>{0.697398663f, 0.942737579f},
-std::array<float,2>{0.934963584f, 0.415353477f},
-std::array<float,2>{0.225235462f, 0.50846076f},
-std::array<float,2>{0.304241836f, 0.284394234f},
-std::array<float,2>{0.52629602f, 0.651506186f},
-std::array<float,2>{0.765907407f, 0.154882476f},
-std::array<float,2>{0.0496121049f, 0.822435498f},
-std::array<float,2>{0.179707378f, 0.10071969f},
-std::array<float,2>{0.967891335f, 0.935028434f},
-std::array<float,2>{0.684668005f, 0.469356388f},
-std::array<float,2>{0.444979161f, 0.567522109f},
-std::array<float,2>{0.11523091f, 0.413052291f},
-std::array<float,2>{0.867682815f, 0.5023489f},
-std::array<float,2>{0.586305439f, 0.0511871725f},
-std::array<float,2>{0.312821269f, 0.94619596f},
-std::array<float,2>{0.387492746f, 0.199775189f},
-std::array<float,2>{0.728501141f, 0.786444128f},
-std::array<float,2>{0.90236336f, 0.350385338f},
-std::array<float,2>{0.192109674f, 0.691019416f},
-std::array<float,2>{0.470094442f, 0.462091476f},
-std::array<float,2>{0.642808437f, 0.599246025f},
-std::array<float,2>{0.970158577f, 0.0703570396f},
-std::array<float,2>{0.149366751f, 0.876937151f},
-std::array<float,2>{0.0160777494f, 0.170713365f},
-std::array<float,2>{0.790388465f, 0.856094837f},
-std::array<float,2>{0.533280909f, 0.270437121f},
-std::array<float,2>{0.280126274f, 0.668754995f},
-std::array<float,2>{0.232312262f, 0.341337502f},
-std::array<float,2>{0.921944618f, 0.72434926f},
-std::array<float,2>{0.693288445f, 0.245740891f},
-std::array<float,2>{0.42579177f, 0.756110191f},
-std::array<float,2>{0.354194224f, 0.0108188977f},
-std::array<float,2>{0.595155835f, 0.979815364f},
-std::array<float,2>{0.815789104f, 0.399909705f},
-std::array<float,2>{0.0750301033f, 0.535848975f},
-std::array<float,2>{0.416698277f, 0.365724206f},
-std::array<float,2>{0.704151392f, 0.710828245f},
-std::array<float,2>{0.918188214f, 0.211890906f},
-std::array<float,2>{0.235690817f, 0.804261863f},
-std::array<float,2>{0.091734387f, 0.0437918641f},
-std::array<float,2>{0.833410382f, 0.964515746f},
-std::array<float,2>{0.617357135f, 0.425303638f},
-std::array<float,2>{0.371433049f, 0.524057746f},
-std::array<float,2>{0.130898967f, 0.498064637f},
-std::array<float,2>{0.988309264f, 0.584335148f},
-std::array<float,2>{0.629644513f, 0.119906828f},
-std::array<float,2>{0.489580333f, 0.908654869f},
-std::array<float,2>{0.252341002f, 0.125961274f},
-std::array<float,2>{0.562169135f, 0.836675882f},
-std::array<float,2>{0.805627644f, 0.298879623f},
-std::array<float,2>{0.0139061948f, 0.635756195f},
-std::array<float,2>{0.341579199f, 0.386316568f},
-std::array<float,2>{0.571732223f, 0.561416328f},
-std::array<float,2>{0.851761758f, 0.0257525668f},
-std::array<float,2>{0.0965955779f, 0.989320576f},
-std::array<float,2>{0.208777174f, 0.222394466f},
-std::array<float,2>{0.886221051f, 0.774543464f},
-std::array<float,2>{0.743121624f, 0.327125579f},
-std::array<float,2>{0.405091792f, 0.748838365f},
-std::array<float,2>{0.0444044545f, 0.251902252f},
-std::array<float,2>{0.757667124f, 0.685716867f},
-std::array<float,2>{0.506540716f, 0.174831823f},
-std::array<float,2>{0.290522784f, 0.871827066f},
-std::array<float,2>{0.453780472f, 0.086306639f},
-std::array<float,2>{0.664980233f, 0.899245262f},
-std::array<float,2>{0.943042219f, 0.442763895f},
-std::array<float,2>{0.162909657f, 0.613235176f},
-std::array<float,2>{0.260088056f, 0.344995439f},
-std::array<float,2>{0.547713697f, 0.694725156f},
-std::array<float,2>{0.804567575f, 0.195455417f},
-std::array<float,2>{0.00479333242f, 0.78492856f},
-std::array<float,2>{0.13743946f, 0.0490699001f},
-std::array<float,2>{0.997717083f, 0.950871468f},
-std::array<float,2>{0.633736849f, 0.406718552f},
-std::array<float,2>{0.497732311f, 0.506794333f},
-std::array<float,2>{0.0818411931f, 0.472660482f},
-std::array<float,2>{0.843097329f, 0.56508863f},
-std::array<float,2>{0.615160048f, 0.0954410732f},
-std::array<float,2>{0.360412389f, 0.932961464f},
-std::array<float,2>{0.412224382f, 0.151964679f},
-std::array<float,2>{0.714059293f, 0.826603234f},
-std::array<float,2>{0.913566411f, 0.286043227f},
-std::array<float,2>{0.249996915f, 0.655669093f},
-std::array<float,2>{0.46155861f, 0.402361363f},
-std::array<float,2>{0.661368728f, 0.533722878f},
-std::array<float,2>{0.952454925f, 0.0151853189f},
-std::array<float,2>{0.166168913f, 0.983115613f},
-std::array<float,2>{0.033271715f, 0.247829124f},
-std::array<float,2>{0.759616554f, 0.752260387f},
-std::array<float,2>{0.51550895f, 0.336721361f},
-std::array<float,2>{0.288540483f, 0.72057879f},
-std::array<float,2>{0.214040264f, 0.269188434f},
-std::array<float,2>{0.881537199f, 0.667011857f},
-std::array<float,2>{0.740065396f, 0.166992262f},
-std::array<float,2>{0.39182654f, 0.854832292f},
-std::array<float,2>{0.333990008f, 0.0768350586f},
-std::array<float,2>{0.565319717f, 0.880530834f},
-std::array<float,2>{0.84695971f, 0.466320753f},
-std::array<float,2>{0.101973318f, 0.594936252f},
-std::array<float,2>{0.375532836f, 0.304359317f},
-std::array<float,2>{0.725638986f, 0.637951612f},
-std::array<float,2>{0.895431578f, 0.130222157f},
-std::array<float,2>{0.1992874f, 0.840911984f},
-std::array<float,2>{0.123665959f, 0.12149772f},
-std::array<float,2>{0.861105442f, 0.913800836f},
-std::array<float,2>{0.584427357f, 0.493567318f},
-std::array<float,2>{0.326999754f, 0.57991755f},
-std::array<float,2>{0.174295723f, 0.428948075f},
-std::array<float,2>{0.957563937f, 0.529926479f},
-std::array<float,2>{0.673725128f, 0.0409549586f},
-std::array<float,2>{0.449588686f, 0.966377974f},
-std::array<float,2>{0.306488633f, 0.217604563f},
-std::array<float,2>{0.522182167f, 0.800596118f},
-std::array<float,2>{0.777369499f, 0.360834688f},
-std::array<float,2>{0.0557788573f, 0.704034746f},
-std::array<float,2>{0.349062115f, 0.439983368f},
-std::array<float,2>{0.605072081f, 0.616040289f},
-std::array<float,2>{0.826271355f, 0.0936108232f},
-std::array<float,2>{0.0626399741f, 0.906009018f},
-std::array<float,2>{0.220529377f, 0.179049477f},
-std::array<float,2>{0.930419266f, 0.870688319f},
-std::array<float,2>{0.700207651f, 0.257455349f},
-std::array<float,2>{0.436447173f, 0.68047601f},
-std::array<float,2>{0.0254134797f, 0.321640432f},
-std::array<float,2>{0.782432318f, 0.745115697f},
-std::array<float,2>{0.541056097f, 0.222721219f},
-std::array<float,2>{0.268692255f, 0.780742526f},
-std::array<float,2>{0.478263944f, 0.0281563476f},
-std::array<float,2>{0.651394486f, 0.985749483f},
-std::array<float,2>{0.980713606f, 0.389542878f},
-std::array<float,2>{0.142742977f, 0.556297779f},
-std::array<float,2>{0.318146348f, 0.258509368f},
-std::array<float,2>{0.590582848f, 0.673358977f},
-std::array<float,2>{0.871774316f, 0.18647255f},
-std::array<float,2>{0.109976478f, 0.864000261f},
-std::array<float,2>{0.187711537f, 0.0793510824f},
-std::array<float,2>{0.898548424f, 0.896919608f},
-std::array<float,2>{0.733255208f, 0.45060423f},
-std::array<float,2>{0.383854389f, 0.621112347f},
-std::array<float,2>{0.052067399f, 0.382397771f},
-std::array<float,2>{0.772453725f, 0.551037371f},
-std::array<float,2>{0.529267848f, 0.0160116218f},
-std::array<float,2>{0.298086822f, 0.993528843f},
-std::array<float,2>{0.439427078f, 0.228375345f},
-std::array<float,2>{0.681248307f, 0.771808743f},
-std::array<float,2>{0.962859154f, 0.318136305f},
-std::array<float,2>{0.185699821f, 0.740542471f},
-std::array<float,2>{0.423633903f, 0.490253925f},
-std::array<float,2>{0.687997162f, 0.588966191f},
-std::array<float,2>{0.927741528f, 0.115061216f},
-std::array<float,2>{0.227670193f, 0.915325761f},
-std::array<float,2>{0.0734340698f, 0.133406296f},
-std::array<float,2>{0.819487691f, 0.834502101f},
-std::array<float,2>{0.600085139f, 0.30472064f},
-std::array<float,2>{0.357938766f, 0.630536556f},
-std::array<float,2>{0.155306235f, 0.373100489f},
-std::array<float,2>{0.97281456f, 0.712513387f},
-std::array<float,2>{0.646107018f, 0.203637823f},
-std::array<float,2>{0.475592673f, 0.807759702f},
-std::array<float,2>{0.276199728f, 0.0387342647f},
-std::array<float,2>{0.538388908f, 0.957520485f},
-std::array<float,2>{0.795634389f, 0.431955695f},
-std::array<float,2>{0.0197115224f, 0.519183218f},
-std::array<float,2>{0.487062424f, 0.334765434f},
-std::array<float,2>{0.62702632f, 0.733519375f},
-std::array<float,2>{0.987530053f, 0.241947442f},
-std::array<float,2>{0.126886472f, 0.759623528f},
-std::array<float,2>{0.0112796472f, 0.00503104273f},
-std::array<float,2>{0.810559332f, 0.974057078f},
-std::array<float,2>{0.558319926f, 0.398354977f},
-std::array<float,2>{0.25597465f, 0.54095155f},
-std::array<float,2>{0.238297462f, 0.456039995f},
-std::array<float,2>{0.917624712f, 0.606633782f},
-std::array<float,2>{0.707286417f, 0.0638457313f},
-std::array<float,2>{0.421458811f, 0.889766753f},
-std::array<float,2>{0.369111866f, 0.156785354f},
-std::array<float,2>{0.623316646f, 0.846379876f},
-std::array<float,2>{0.829043925f, 0.279215753f},
-std::array<float,2>{0.0882293358f, 0.659659386f},
-std::array<float,2>{0.293438256f, 0.419195682f},
-std::array<float,2>{0.503064632f, 0.512617886f},
-std::array<float,2>{0.75333488f, 0.0568554103f},
-std::array<float,2>{0.0395200402f, 0.938020527f},
-std::array<float,2>{0.156940952f, 0.195176825f},
-std::array<float,2>{0.940580308f, 0.790507793f},
-std::array<float,2>{0.669451654f, 0.354325086f},
-std::array<float,2>{0.460784018f, 0.696264446f},
-std::array<float,2>{0.100524642f, 0.290556967f},
-std::array<float,2>{0.859325171f, 0.647299707f},
-std::array<float,2>{0.578042448f, 0.142732322f},
-std::array<float,2>{0.337159991f, 0.819004536f},
-std::array<float,2>{0.399704427f, 0.102331772f},
-std::array<float,2>{0.747418463f, 0.929669499f},
-std::array<float,2>{0.887633145f, 0.482765138f},
-std::array<float,2>{0.204629287f, 0.575161159f},
-std::array<float,2>{0.331140339f, 0.370052725f},
-std::array<float,2>{0.567038596f, 0.717403352f},
-std::array<float,2>{0.8501302f, 0.208525047f},
-std::array<float,2>{0.108460821f, 0.808824778f},
-std::array<float,2>{0.215746f, 0.0316986032f},
-std::array<float,2>{0.878822267f, 0.954604805f},
-std::array<float,2>{0.735392749f, 0.435211569f},
-std::array<float,2>{0.39600575f, 0.521305442f},
-std::array<float,2>{0.0357999615f, 0.485205144f},
-std::array<float,2>{0.763293028f, 0.590458751f},
-std::array<float,2>{0.51059705f, 0.111913383f},
-std::array<float,2>{0.284441829f, 0.9207865f},
-std::array<float,2>{0.467095226f, 0.138795853f},
-std::array<float,2>{0.658177674f, 0.828993678f},
-std::array<float,2>{0.947741568f, 0.312404245f},
-std::array<float,2>{0.168695554f, 0.627962291f},
-std::array<float,2>{0.407857418f, 0.378664374f},
-std::array<float,2>{0.714999318f, 0.547028303f},
-std::array<float,2>{0.908656597f, 0.0204984937f},
-std::array<float,2>{0.24579072f, 0.998460472f},
-std::array<float,2>{0.0822619796f, 0.230536714f},
-std::array<float,2>{0.839038312f, 0.766342521f},
-std::array<float,2>{0.609845579f, 0.315324873f},
-std::array<float,2>{0.363559604f, 0.737690985f},
-std::array<float,2>{0.135734856f, 0.261916369f},
-std::array<float,2>{0.994574308f, 0.677940905f},
-std::array<float,2>{0.639506698f, 0.181597754f},
-std::array<float,2>{0.494940519f, 0.859611571f},
-std::array<float,2>{0.264693558f, 0.0833279341f},
-std::array<float,2>{0.552597463f, 0.893662393f},
-std::array<float,2>{0.800097525f, 0.447295755f},
-std::array<float,2>{0.00308529381f, 0.619832158f},
-std::array<float,2>{0.480791867f, 0.295081586f},
-std::array<float,2>{0.65483743f, 0.641931474f},
-std::array<float,2>{0.97701025f, 0.145151019f},
-std::array<float,2>{0.145531148f, 0.814146459f},
-std::array<float,2>{0.0296847504f, 0.106305443f},
-std::array<float,2>{0.787108481f, 0.922964275f},
-std::array<float,2>{0.545352221f, 0.477059096f},
-std::array<float,2>{0.270625859f, 0.573525548f},
-std::array<float,2>{0.223713547f, 0.417810529f},
-std::array<float,2>{0.936299324f, 0.510579288f},
-std::array<float,2>{0.695771158f, 0.061511647f},
-std::array<float,2>{0.431780636f, 0.943404913f},
-std::array<float,2>{0.347458512f, 0.18890743f},
-std::array<float,2>{0.605826259f, 0.794603944f},
-std::array<float,2>{0.823258638f, 0.35653016f},
-std::array<float,2>{0.0699305758f, 0.702028573f},
-std::array<float,2>{0.309133142f, 0.457230151f},
-std::array<float,2>{0.519096851f, 0.603472054f},
-std::array<float,2>{0.775000691f, 0.0693221539f},
-std::array<float,2>{0.0605537854f, 0.884478211f},
-std::array<float,2>{0.178344309f, 0.162795395f},
-std::array<float,2>{0.955512881f, 0.851280093f},
-std::array<float,2>{0.677868903f, 0.276051611f},
-std::array<float,2>{0.446920246f, 0.661045372f},
-std::array<float,2>{0.118131526f, 0.330465645f},
-std::array<float,2>{0.867006302f, 0.730348229f},
-std::array<float,2>{0.581866264f, 0.236448482f},
-std::array<float,2>{0.32280916f, 0.763110459f},
-std::array<float,2>{0.380872756f, 0.00169718522f},
-std::array<float,2>{0.719730616f, 0.972070158f},
-std::array<float,2>{0.893095315f, 0.393514633f},
-std::array<float,2>{0.198796302f, 0.54654038f},
-std::array<float,2>{0.27805391f, 0.272890091f},
-std::array<float,2>{0.531312943f, 0.670396924f},
-std::array<float,2>{0.79278487f, 0.168264598f},
-std::array<float,2>{0.0179437883f, 0.858448684f},
-std::array<float,2>{0.151264176f, 0.0735272393f},
-std::array<float,2>{0.971468389f, 0.87697494f},
-std::array<float,2>{0.641473413f, 0.463026673f},
-std::array<float,2>{0.471549422f, 0.601045072f},
-std::array<float,2>{0.0778589323f, 0.402183414f},
-std::array<float,2>{0.813758194f, 0.537707746f},
-std::array<float,2>{0.596206248f, 0.00889519695f},
-std::array<float,2>{0.3525033f, 0.978451252f},
-std::array<float,2>{0.429466993f, 0.243686959f},
-std::array<float,2>{0.694090664f, 0.755833983f},
-std::array<float,2>{0.925443888f, 0.343741745f},
-std::array<float,2>{0.232726261f, 0.7260409f},
-std::array<float,2>{0.441683173f, 0.472216904f},
-std::array<float,2>{0.685826421f, 0.568634748f},
-std::array<float,2>{0.965388954f, 0.0984471068f},
-std::array<float,2>{0.182573199f, 0.937395632f},
-std::array<float,2>{0.0485212095f, 0.153005511f},
-std::array<float,2>{0.768697321f, 0.820336163f},
-std::array<float,2>{0.524304628f, 0.281871349f},
-std::array<float,2>{0.302559614f, 0.649468601f},
-std::array<float,2>{0.194903955f, 0.349128157f},
-std::array<float,2>{0.905809164f, 0.688778579f},
-std::array<float,2>{0.728574336f, 0.201766148f},
-std::array<float,2>{0.390444607f, 0.78823173f},
-std::array<float,2>{0.316325903f, 0.0533313565f},
-std::array<float,2>{0.58899492f, 0.948208392f},
-std::array<float,2>{0.870983183f, 0.410960972f},
-std::array<float,2>{0.116963699f, 0.501871228f},
-std::array<float,2>{0.404290289f, 0.325675368f},
-std::array<float,2>{0.745425642f, 0.74695909f},
-std::array<float,2>{0.883373797f, 0.21962063f},
-std::array<float,2>{0.209119618f, 0.776422501f},
-std::array<float,2>{0.094865486f, 0.0251061358f},
-std::array<float,2>{0.855291009f, 0.992082536f},
-std::array<float,2>{0.572398663f, 0.383044511f},
-std::array<float,2>{0.343396872f, 0.559014916f},
-std::array<float,2>{0.160648018f, 0.444923937f},
-std::array<float,2>{0.943741381f, 0.610323727f},
-std::array<float,2>{0.66632086f, 0.0889633521f},
-std::array<float,2>{0.455408096f, 0.901367962f},
-std::array<float,2>{0.292192698f, 0.172279149f},
-std::array<float,2>{0.504824817f, 0.873184323f},
-std::array<float,2>{0.755621552f, 0.253656447f},
-std::array<float,2>{0.0461815968f, 0.683863342f},
-std::array<float,2>{0.374665499f, 0.422069997f},
-std::array<float,2>{0.620007277f, 0.526778102f},
-std::array<float,2>{0.835453808f, 0.0459613912f},
-std::array<float,2>{0.0926731825f, 0.962345541f},
-std::array<float,2>{0.237076297f, 0.214055866f},
-std::array<float,2>{0.921234608f, 0.802601993f},
-std::array<float,2>{0.706462502f, 0.364361286f},
-std::array<float,2>{0.414973348f, 0.707338393f},
-std::array<float,2>{0.0121053588f, 0.297964603f},
-std::array<float,2>{0.806648433f, 0.634460747f},
-std::array<float,2>{0.560078323f, 0.127644122f},
-std::array<float,2>{0.251784116f, 0.838998139f},
-std::array<float,2>{0.492065519f, 0.118723206f},
-std::array<float,2>{0.631713986f, 0.907264709f},
-std::array<float,2>{0.991497576f, 0.497808844f},
-std::array<float,2>{0.130430892f, 0.583609104f},
-std::array<float,2>{0.285459936f, 0.338096112f},
-std::array<float,2>{0.511947095f, 0.721054494f},
-std::array<float,2>{0.760133922f, 0.248935685f},
-std::array<float,2>{0.0315627269f, 0.751106918f},
-std::array<float,2>{0.165568903f, 0.0127303489f},
-std::array<float,2>{0.949732959f, 0.981143415f},
-std::array<float,2>{0.662242353f, 0.405134916f},
-std::array<float,2>{0.46398893f, 0.533154726f},
-std::array<float,2>{0.10498485f, 0.46851784f},
-std::array<float,2>{0.845658839f, 0.596374989f},
-std::array<float,2>{0.563749313f, 0.0756711587f},
-std::array<float,2>{0.333730787f, 0.882140756f},
-std::array<float,2>{0.393408418f, 0.165333003f},
-std::array<float,2>{0.742010415f, 0.852684736f},
-std::array<float,2>{0.880851388f, 0.266591936f},
-std::array<float,2>{0.212550491f, 0.664555371f},
-std::array<float,2>{0.499923199f, 0.409218818f},
-std::array<float,2>{0.635768712f, 0.504791617f},
-std::array<float,2>{0.999077559f, 0.0487689748f},
-std::array<float,2>{0.139169186f, 0.951417565f},
-std::array<float,2>{0.00737814f, 0.198902845f},
-std::array<float,2>{0.801166773f, 0.782323241f},
-std::array<float,2>{0.549901187f, 0.347283155f},
-std::array<float,2>{0.258520722f, 0.691792905f},
-std::array<float,2>{0.246181428f, 0.288542777f},
-std::array<float,2>{0.910681903f, 0.654294848f},
-std::array<float,2>{0.712305307f, 0.149510875f},
-std::array<float,2>{0.411216319f, 0.825762451f},
-std::array<float,2>{0.36157766f, 0.0965840742f},
-std::array<float,2>{0.616494179f, 0.930085599f},
-std::array<float,2>{0.841545284f, 0.474797487f},
-std::array<float,2>{0.0785601214f, 0.564301968f},
-std::array<float,2>{0.434895754f, 0.255525768f},
-std::array<float,2>{0.701919734f, 0.682832479f},
-std::array<float,2>{0.932148159f, 0.177059367f},
-std::array<float,2>{0.220809191f, 0.867387652f},
-std::array<float,2>{0.0652943626f, 0.090181686f},
-std::array<float,2>{0.824496686f, 0.90397799f},
-std::array<float,2>{0.603045225f, 0.438449204f},
-std::array<float,2>{0.351011097f, 0.614084244f},
-std::array<float,2>{0.140926495f, 0.388648927f},
-std::array<float,2>{0.983763099f, 0.557831526f},
-std::array<float,2>{0.648813844f, 0.029930668f},
-std::array<float,2>{0.48009488f, 0.986706674f},
-std::array<float,2>{0.267513961f, 0.225320041f},
-std::array<float,2>{0.539393306f, 0.777870059f},
-std::array<float,2>{0.783582211f, 0.323717743f},
-std::array<float,2>{0.0236972887f, 0.743527293f},
-std::array<float,2>{0.32449764f, 0.494606942f},
-std::array<float,2>{0.582271516f, 0.580832839f},
-std::array<float,2>{0.861911595f, 0.123681031f},
-std::array<float,2>{0.122619152f, 0.911744416f},
-std::array<float,2>{0.202300102f, 0.131480902f},
-std::array<float,2>{0.897063375f, 0.842295885f},
-std::array<float,2>{0.72439003f, 0.301319182f},
-std::array<float,2>{0.377578795f, 0.63992101f},
-std::array<float,2>{0.0582923852f, 0.362636954f},
-std::array<float,2>{0.780465186f, 0.705427766f},
-std::array<float,2>{0.520880818f, 0.215611234f},
-std::array<float,2>{0.308118641f, 0.798113167f},
-std::array<float,2>{0.451910853f, 0.0412359126f},
-std::array<float,2>{0.675612926f, 0.967767417f},
-std::array<float,2>{0.95995611f, 0.426185489f},
-std::array<float,2>{0.172323942f, 0.528540969f},
-std::array<float,2>{0.3566643f, 0.30737713f},
-std::array<float,2>{0.598696113f, 0.632027626f},
-std::array<float,2>{0.817932725f, 0.135899603f},
-std::array<float,2>{0.0719208419f, 0.833541334f},
-std::array<float,2>{0.22878097f, 0.117022119f},
-std::array<float,2>{0.925886035f, 0.916917443f},
-std::array<float,2>{0.690247357f, 0.489125311f},
-std::array<float,2>{0.424333572f, 0.587398827f},
-std::array<float,2>{0.0218132902f, 0.430838674f},
-std::array<float,2>{0.794709504f, 0.517451644f},
-std::array<float,2>{0.535197377f, 0.0361370109f},
-std::array<float,2>{0.273788422f, 0.959212124f},
-std::array<float,2>{0.473990321f, 0.206553489f},
-std::array<float,2>{0.646977246f, 0.806471407f},
-std::array<float,2>{0.975357771f, 0.371804148f},
-std::array<float,2>{0.153730825f, 0.713430941f},
-std::array<float,2>{0.385510087f, 0.453124881f},
-std::array<float,2>{0.73175472f, 0.62381649f},
-std::array<float,2>{0.900984645f, 0.0809286758f},
-std::array<float,2>{0.189472482f, 0.896012545f},
-std::array<float,2>{0.112655498f, 0.183763117f},
-std::array<float,2>{0.873414397f, 0.866973281f},
-std::array<float,2>{0.592968762f, 0.260586768f},
-std::array<float,2>{0.320141912f, 0.675485134f},
-std::array<float,2>{0.184667617f, 0.319190234f},
-std::array<float,2>{0.963464856f, 0.739747405f},
-std::array<float,2>{0.681884885f, 0.229724437f},
-std::array<float,2>{0.440907449f, 0.770418942f},
-std::array<float,2>{0.300495744f, 0.0187619682f},
-std::array<float,2>{0.529443264f, 0.995403171f},
-std::array<float,2>{0.771058261f, 0.379556894f},
-std::array<float,2>{0.0534313582f, 0.553192139f},
-std::array<float,2>{0.457566381f, 0.352719277f},
-std::array<float,2>{0.671695352f, 0.697814345f},
-std::array<float,2>{0.938889921f, 0.191965923f},
-std::array<float,2>{0.159903064f, 0.791513324f},
-std::array<float,2>{0.0410750583f, 0.0560139082f},
-std::array<float,2>{0.751401007f, 0.941161633f},
-std::array<float,2>{0.501702189f, 0.420509934f},
-std::array<float,2>{0.295383573f, 0.51425457f},
-std::array<float,2>{0.20526813f, 0.481958658f},
-std::array<float,2>{0.889669418f, 0.577392638f},
-std::array<float,2>{0.748348832f, 0.105281234f},
-std::array<float,2>{0.401787579f, 0.92723f},
-std::array<float,2>{0.338234931f, 0.140741974f},
-std::array<float,2>{0.574403584f, 0.817893505f},
-std::array<float,2>{0.855877638f, 0.29255107f},
-std::array<float,2>{0.0984522626f, 0.644836783f},
-std::array<float,2>{0.255818427f, 0.395123214f},
-std::array<float,2>{0.555299461f, 0.542499125f},
-std::array<float,2>{0.809404314f, 0.00641539879f},
-std::array<float,2>{0.00933930837f, 0.975711107f},
-std::array<float,2>{0.127815038f, 0.239654779f},
-std::array<float,2>{0.985170066f, 0.761360109f},
-std::array<float,2>{0.626297057f, 0.332947791f},
-std::array<float,2>{0.485939115f, 0.731677175f},
-std::array<float,2>{0.0872952789f, 0.280369669f},
-std::array<float,2>{0.831212699f, 0.657911003f},
-std::array<float,2>{0.621896088f, 0.16008468f},
-std::array<float,2>{0.369509608f, 0.843966067f},
-std::array<float,2>{0.418244869f, 0.0644643009f},
-std::array<float,2>{0.710909188f, 0.888478339f},
-std::array<float,2>{0.91452843f, 0.454998881f},
-std::array<float,2>{0.240797594f, 0.609090984f},
-std::array<float,2>{0.323915124f, 0.328551471f},
-std::array<float,2>{0.58057493f, 0.727437198f},
-std::array<float,2>{0.865742147f, 0.236095026f},
-std::array<float,2>{0.118655413f, 0.764951169f},
-std::array<float,2>{0.197276846f, 0.00296606193f},
-std::array<float,2>{0.893972576f, 0.968770802f},
-std::array<float,2>{0.719613075f, 0.391745478f},
-std::array<float,2>{0.382091671f, 0.543949783f},
-std::array<float,2>{0.0618491583f, 0.459866911f},
-std::array<float,2>{0.773842871f, 0.604870021f},
-std::array<float,2>{0.517798543f, 0.0666958094f},
-std::array<float,2>{0.310281128f, 0.885115981f},
-std::array<float,2>{0.445357382f, 0.161183536f},
-std::array<float,2>{0.679587603f, 0.84847039f},
-std::array<float,2>{0.956514001f, 0.274989396f},
-std::array<float,2>{0.179530859f, 0.66256851f},
-std::array<float,2>{0.433016121f, 0.414560556f},
-std::array<float,2>{0.69690305f, 0.509016752f},
-std::array<float,2>{0.93694663f, 0.0592074282f},
-std::array<float,2>{0.222912192f, 0.941746831f},
-std::array<float,2>{0.0692267194f, 0.189989194f},
-std::array<float,2>{0.822931767f, 0.795153201f},
-std::array<float,2>{0.606852889f, 0.35928598f},
-std::array<float,2>{0.345752925f, 0.70094794f},
-std::array<float,2>{0.144672588f, 0.294906467f},
-std::array<float,2>{0.97775197f, 0.643709481f},
-std::array<float,2>{0.656058669f, 0.148400798f},
-std::array<float,2>{0.481638551f, 0.815807998f},
-std::array<float,2>{0.269926518f, 0.108946905f},
-std::array<float,2>{0.545953035f, 0.924737871f},
-std::array<float,2>{0.785798609f, 0.480405182f},
-std::array<float,2>{0.031140063f, 0.570800006f},
-std::array<float,2>{0.495277405f, 0.265471369f},
-std::array<float,2>{0.640501857f, 0.676859021f},
-std::array<float,2>{0.995722115f, 0.1835583f},
-std::array<float,2>{0.135766387f, 0.863075912f},
-std::array<float,2>{0.00286090071f, 0.0846044794f},
-std::array<float,2>{0.798967004f, 0.890933037f},
-std::array<float,2>{0.551286757f, 0.446736008f},
-std::array<float,2>{0.264239013f, 0.617358625f},
-std::array<float,2>{0.244642958f, 0.375439644f},
-std::array<float,2>{0.909914672f, 0.549285769f},
-std::array<float,2>{0.716734529f, 0.0227425769f},
-std::array<float,2>{0.406342119f, 0.996791899f},
-std::array<float,2>{0.364924341f, 0.233399749f},
-std::array<float,2>{0.610815465f, 0.768125296f},
-std::array<float,2>{0.837922394f, 0.313374549f},
-std::array<float,2>{0.083778657f, 0.735525072f},
-std::array<float,2>{0.283970743f, 0.486914039f},
-std::array<float,2>{0.510801613f, 0.592367291f},
-std::array<float,2>{0.761954963f, 0.109457538f},
-std::array<float,2>{0.036469657f, 0.918604612f},
-std::array<float,2>{0.169064626f, 0.137271047f},
-std::array<float,2>{0.948651552f, 0.830505073f},
-std::array<float,2>{0.656677008f, 0.310305148f},
-std::array<float,2>{0.468710601f, 0.62666893f},
-std::array<float,2>{0.107723325f, 0.367721438f},
-std::array<float,2>{0.850684166f, 0.715505958f},
-std::array<float,2>{0.568249702f, 0.209446535f},
-std::array<float,2>{0.330275416f, 0.811381936f},
-std::array<float,2>{0.394804627f, 0.0348916166f},
-std::array<float,2>{0.734577417f, 0.956399202f},
-std::array<float,2>{0.877298355f, 0.437412173f},
-std::array<float,2>{0.216167063f, 0.522903919f},
-std::array<float,2>{0.25016737f, 0.299824834f},
-std::array<float,2>{0.558958173f, 0.634836376f},
-std::array<float,2>{0.80846405f, 0.126038134f},
-std::array<float,2>{0.0130342375f, 0.836926103f},
-std::array<float,2>{0.129546136f, 0.12070895f},
-std::array<float,2>{0.990277529f, 0.909193933f},
-std::array<float,2>{0.632124841f, 0.499501169f},
-std::array<float,2>{0.490361691f, 0.585847318f},
-std::array<float,2>{0.093109183f, 0.423947632f},
-std::array<float,2>{0.834322631f, 0.525338233f},
-std::array<float,2>{0.620271981f, 0.0439573526f},
-std::array<float,2>{0.373340964f, 0.963458359f},
-std::array<float,2>{0.415190518f, 0.212413907f},
-std::array<float,2>{0.705589652f, 0.803217351f},
-std::array<float,2>{0.919996321f, 0.366457283f},
-std::array<float,2>{0.237450972f, 0.709290981f},
-std::array<float,2>{0.456481218f, 0.442303896f},
-std::array<float,2>{0.667619526f, 0.612297297f},
-std::array<float,2>{0.944644988f, 0.0873468593f},
-std::array<float,2>{0.161450982f, 0.899565816f},
-std::array<float,2>{0.0455340557f, 0.1738839f},
-std::array<float,2>{0.754073262f, 0.872887969f},
-std::array<float,2>{0.505735695f, 0.250913322f},
-std::array<float,2>{0.2910707f, 0.686633825f},
-std::array<float,2>{0.210347146f, 0.327404171f},
-std::array<float,2>{0.884094298f, 0.74976927f},
-std::array<float,2>{0.744850457f, 0.22148712f},
-std::array<float,2>{0.403144509f, 0.77379775f},
-std::array<float,2>{0.342053384f, 0.0266611539f},
-std::array<float,2>{0.573552132f, 0.989216447f},
-std::array<float,2>{0.854375362f, 0.384841204f},
-std::array<float,2>{0.0940739438f, 0.56235379f},
-std::array<float,2>{0.389020026f, 0.351330161f},
-std::array<float,2>{0.730457246f, 0.690292299f},
-std::array<float,2>{0.904459894f, 0.20073843f},
-std::array<float,2>{0.193392262f, 0.785431147f},
-std::array<float,2>{0.116191499f, 0.052327387f},
-std::array<float,2>{0.869578063f, 0.947159886f},
-std::array<float,2>{0.588474035f, 0.413299054f},
-std::array<float,2>{0.314617217f, 0.503673971f},
-std::array<float,2>{0.183002189f, 0.469919562f},
-std::array<float,2>{0.965828598f, 0.567370176f},
-std::array<float,2>{0.686733067f, 0.0997910202f},
-std::array<float,2>{0.442921698f, 0.934509516f},
-std::array<float,2>{0.301234543f, 0.156012908f},
-std::array<float,2>{0.52505821f, 0.823507011f},
-std::array<float,2>{0.768528521f, 0.284010857f},
-std::array<float,2>{0.0473350473f, 0.650681496f},
-std::array<float,2>{0.353379875f, 0.399173528f},
-std::array<float,2>{0.597606301f, 0.536618292f},
-std::array<float,2>{0.812773168f, 0.00988111272f},
-std::array<float,2>{0.0769404545f, 0.978745997f},
-std::array<float,2>{0.23362872f, 0.244252905f},
-std::array<float,2>{0.923932493f, 0.757497787f},
-std::array<float,2>{0.694933355f, 0.34051773f},
-std::array<float,2>{0.428288519f, 0.723227918f},
-std::array<float,2>{0.0187642425f, 0.271349728f},
-std::array<float,2>{0.791927755f, 0.669553876f},
-std::array<float,2>{0.532975078f, 0.170903638f},
-std::array<float,2>{0.278903604f, 0.85721755f},
-std::array<float,2>{0.472501636f, 0.0716405064f},
-std::array<float,2>{0.642345428f, 0.875311375f},
-std::array<float,2>{0.971969962f, 0.461726606f},
-std::array<float,2>{0.151458442f, 0.597902f},
-std::array<float,2>{0.306790143f, 0.359940737f},
-std::array<float,2>{0.520253897f, 0.704995334f},
-std::array<float,2>{0.780116737f, 0.217876971f},
-std::array<float,2>{0.0573111922f, 0.799517751f},
-std::array<float,2>{0.173797503f, 0.0394391082f},
-std::array<float,2>{0.960857272f, 0.96581918f},
-std::array<float,2>{0.674697995f, 0.428383946f},
-std::array<float,2>{0.452920377f, 0.530330837f},
-std::array<float,2>{0.121593483f, 0.492760628f},
-std::array<float,2>{0.86296165f, 0.578449368f},
-std::array<float,2>{0.583427668f, 0.122578576f},
-std::array<float,2>{0.325513989f, 0.912337959f},
-std::array<float,2>{0.378277332f, 0.129380703f},
-std::array<float,2>{0.72310245f, 0.84037739f},
-std::array<float,2>{0.897958934f, 0.302993894f},
-std::array<float,2>{0.2020915f, 0.637414515f},
-std::array<float,2>{0.478562504f, 0.390128434f},
-std::array<float,2>{0.650060117f, 0.555426657f},
-std::array<float,2>{0.982821345f, 0.028960539f},
-std::array<float,2>{0.141740501f, 0.985033989f},
-std::array<float,2>{0.0246198792f, 0.22371012f},
-std::array<float,2>{0.78511107f, 0.780258954f},
-std::array<float,2>{0.540683031f, 0.320991039f},
-std::array<float,2>{0.266258359f, 0.745462298f},
-std::array<float,2>{0.222434551f, 0.255993187f},
-std::array<float,2>{0.932739079f, 0.681596398f},
-std::array<float,2>{0.702677846f, 0.178456217f},
-std::array<float,2>{0.433643579f, 0.869509518f},
-std::array<float,2>{0.350044042f, 0.0918487906f},
-std::array<float,2>{0.602015138f, 0.905170023f},
-std::array<float,2>{0.825454354f, 0.440962106f},
-std::array<float,2>{0.0655630305f, 0.616240978f},
-std::array<float,2>{0.410303473f, 0.286748022f},
-std::array<float,2>{0.711304486f, 0.65471226f},
-std::array<float,2>{0.911361814f, 0.151117504f},
-std::array<float,2>{0.247753948f, 0.828042328f},
-std::array<float,2>{0.079191491f, 0.0937749743f},
-std::array<float,2>{0.840088844f, 0.932149291f},
-std::array<float,2>{0.616103292f, 0.474311888f},
-std::array<float,2>{0.362757027f, 0.565708637f},
-std::array<float,2>{0.140287876f, 0.407661438f},
-std::array<float,2>{0.998068511f, 0.507104099f},
-std::array<float,2>{0.634858489f, 0.0504010469f},
-std::array<float,2>{0.49853152f, 0.950076818f},
-std::array<float,2>{0.259597689f, 0.196762815f},
-std::array<float,2>{0.548980534f, 0.783984125f},
-std::array<float,2>{0.802371681f, 0.343817115f},
-std::array<float,2>{0.00616017962f, 0.69338125f},
-std::array<float,2>{0.332582772f, 0.465175569f},
-std::array<float,2>{0.56311506f, 0.594457686f},
-std::array<float,2>{0.843858957f, 0.0781073794f},
-std::array<float,2>{0.103797868f, 0.879143655f},
-std::array<float,2>{0.211166784f, 0.166756421f},
-std::array<float,2>{0.879322052f, 0.854463518f},
-std::array<float,2>{0.741140425f, 0.26776886f},
-std::array<float,2>{0.394305468f, 0.666640639f},
-std::array<float,2>{0.0330269933f, 0.337038457f},
-std::array<float,2>{0.760972738f, 0.718771994f},
-std::array<float,2>{0.513667107f, 0.246476516f},
-std::array<float,2>{0.286967516f, 0.753356814f},
-std::array<float,2>{0.4630844f, 0.0141752725f},
-std::array<float,2>{0.663747609f, 0.983552873f},
-std::array<float,2>{0.95056957f, 0.403685033f},
-std::array<float,2>{0.164462447f, 0.534429312f},
-std::array<float,2>{0.370643377f, 0.277429134f},
-std::array<float,2>{0.622400522f, 0.659169376f},
-std::array<float,2>{0.83041203f, 0.158029705f},
-std::array<float,2>{0.0867941231f, 0.847470105f},
-std::array<float,2>{0.241872832f, 0.063298583f},
-std::array<float,2>{0.915871322f, 0.888781905f},
-std::array<float,2>{0.709903359f, 0.456846684f},
-std::array<float,2>{0.419546694f, 0.606286526f},
-std::array<float,2>{0.00781808794f, 0.396797508f},
-std::array<float,2>{0.810539424f, 0.539605618f},
-std::array<float,2>{0.556128085f, 0.00443692505f},
-std::array<float,2>{0.254084438f, 0.97353369f},
-std::array<float,2>{0.485055089f, 0.240353569f},
-std::array<float,2>{0.625891745f, 0.758677006f},
-std::array<float,2>{0.986238539f, 0.335599452f},
-std::array<float,2>{0.128314987f, 0.732708037f},
-std::array<float,2>{0.400445819f, 0.48372525f},
-std::array<float,2>{0.749887764f, 0.575410724f},
-std::array<float,2>{0.889063299f, 0.103220768f},
-std::array<float,2>{0.206147522f, 0.927765369f},
-std::array<float,2>{0.0989666656f, 0.144396633f},
-std::array<float,2>{0.856813729f, 0.81940341f},
-std::array<float,2>{0.575326562f, 0.289491534f},
-std::array<float,2>{0.339257389f, 0.647685349f},
-std::array<float,2>{0.15896517f, 0.354946613f},
-std::array<float,2>{0.937989354f, 0.696527719f},
-std::array<float,2>{0.670116186f, 0.194013119f},
-std::array<float,2>{0.458924115f, 0.789293826f},
-std::array<float,2>{0.296335429f, 0.0582924895f},
-std::array<float,2>{0.50071013f, 0.938575387f},
-std::array<float,2>{0.750915527f, 0.418476522f},
-std::array<float,2>{0.0427078679f, 0.51344198f},
-std::array<float,2>{0.439494401f, 0.317282975f},
-std::array<float,2>{0.683054209f, 0.741878271f},
-std::array<float,2>{0.964300632f, 0.227451056f},
-std::array<float,2>{0.183699712f, 0.773222804f},
-std::array<float,2>{0.0544235632f, 0.0169612039f},
-std::array<float,2>{0.77009809f, 0.992410898f},
-std::array<float,2>{0.530742049f, 0.38156271f},
-std::array<float,2>{0.299467564f, 0.552313864f},
-std::array<float,2>{0.190904021f, 0.449728459f},
-std::array<float,2>{0.902157128f, 0.622455955f},
-std::array<float,2>{0.731267333f, 0.0782141387f},
-std::array<float,2>{0.38602224f, 0.898197174f},
-std::array<float,2>{0.31844157f, 0.187281489f},
-std::array<float,2>{0.592730582f, 0.86481607f},
-std::array<float,2>{0.874264359f, 0.259146243f},
-std::array<float,2>{0.111344449f, 0.672032773f},
-std::array<float,2>{0.274417222f, 0.433479965f},
-std::array<float,2>{0.537077248f, 0.518477082f},
-std::array<float,2>{0.793932438f, 0.0372745655f},
-std::array<float,2>{0.0229707733f, 0.958605111f},
-std::array<float,2>{0.152790725f, 0.204717726f},
-std::array<float,2>{0.976188838f, 0.807570159f},
-std::array<float,2>{0.648302138f, 0.374284089f},
-std::array<float,2>{0.473104805f, 0.711072385f},
-std::array<float,2>{0.0705048293f, 0.305732429f},
-std::array<float,2>{0.817322552f, 0.629079878f},
-std::array<float,2>{0.598120153f, 0.134309635f},
-std::array<float,2>{0.355926514f, 0.835487843f},
-std::array<float,2>{0.424811393f, 0.113554947f},
-std::array<float,2>{0.690510213f, 0.914795816f},
-std::array<float,2>{0.927171528f, 0.491362929f},
-std::array<float,2>{0.230249286f, 0.588052273f},
-std::array<float,2>{0.344632059f, 0.356350154f},
-std::array<float,2>{0.609075487f, 0.702669561f},
-std::array<float,2>{0.820442677f, 0.187766507f},
-std::array<float,2>{0.0665252283f, 0.793898106f},
-std::array<float,2>{0.226492316f, 0.0620509349f},
-std::array<float,2>{0.934331954f, 0.944488883f},
-std::array<float,2>{0.698481202f, 0.416597009f},
-std::array<float,2>{0.430559278f, 0.511173308f},
-std::array<float,2>{0.0290347785f, 0.478227913f},
-std::array<float,2>{0.788122058f, 0.572803319f},
-std::array<float,2>{0.544819474f, 0.107017837f},
-std::array<float,2>{0.27290535f, 0.922685862f},
-std::array<float,2>{0.483274162f, 0.146162391f},
-std::array<float,2>{0.652492166f, 0.812710822f},
-std::array<float,2>{0.97938633f, 0.296061516f},
-std::array<float,2>{0.148194253f, 0.641103208f},
-std::array<float,2>{0.380080909f, 0.393897772f},
-std::array<float,2>{0.720747769f, 0.545416176f},
-std::array<float,2>{0.892537594f, 0.000676594616f},
-std::array<float,2>{0.195876226f, 0.970784128f},
-std::array<float,2>{0.119413331f, 0.237566456f},
-std::array<float,2>{0.863555968f, 0.762133598f},
-std::array<float,2>{0.578537345f, 0.331842363f},
-std::array<float,2>{0.320521653f, 0.728840292f},
-std::array<float,2>{0.176441208f, 0.277061343f},
-std::array<float,2>{0.954320908f, 0.661167085f},
-std::array<float,2>{0.677324653f, 0.163772851f},
-std::array<float,2>{0.448221654f, 0.850041449f},
-std::array<float,2>{0.311225891f, 0.0701488405f},
-std::array<float,2>{0.517468035f, 0.882815123f},
-std::array<float,2>{0.776171386f, 0.458786696f},
-std::array<float,2>{0.0602455735f, 0.601563811f},
-std::array<float,2>{0.465086579f, 0.310928196f},
-std::array<float,2>{0.659105241f, 0.627713859f},
-std::array<float,2>{0.947185516f, 0.14057368f},
-std::array<float,2>{0.171073958f, 0.829415679f},
-std::array<float,2>{0.0386878774f, 0.112634085f},
-std::array<float,2>{0.764146626f, 0.921343267f},
-std::array<float,2>{0.509463966f, 0.486310452f},
-std::array<float,2>{0.283146262f, 0.591478229f},
-std::array<float,2>{0.216927215f, 0.434455603f},
-std::array<float,2>{0.876670659f, 0.519647181f},
-std::array<float,2>{0.737221956f, 0.0326772854f},
-std::array<float,2>{0.397217512f, 0.953678071f},
-std::array<float,2>{0.328838468f, 0.207590222f},
-std::array<float,2>{0.569644153f, 0.810445607f},
-std::array<float,2>{0.849157751f, 0.370863944f},
-std::array<float,2>{0.107063979f, 0.71813947f},
-std::array<float,2>{0.262265533f, 0.448296815f},
-std::array<float,2>{0.554214299f, 0.620993495f},
-std::array<float,2>{0.798254669f, 0.0825513378f},
-std::array<float,2>{0.00146915985f, 0.893540382f},
-std::array<float,2>{0.134731144f, 0.180581778f},
-std::array<float,2>{0.994049966f, 0.860639334f},
-std::array<float,2>{0.637173533f, 0.263302207f},
-std::array<float,2>{0.494019777f, 0.678789556f},
-std::array<float,2>{0.0847784728f, 0.315839946f},
-std::array<float,2>{0.8361606f, 0.73706913f},
-std::array<float,2>{0.612331569f, 0.232207641f},
-std::array<float,2>{0.366892785f, 0.767497897f},
-std::array<float,2>{0.409952253f, 0.0214092974f},
-std::array<float,2>{0.718371987f, 0.999592304f},
-std::array<float,2>{0.907024086f, 0.37743783f},
-std::array<float,2>{0.243601024f, 0.548507214f},
-std::array<float,2>{0.289524913f, 0.252185911f},
-std::array<float,2>{0.506951869f, 0.684598863f},
-std::array<float,2>{0.756557584f, 0.173144758f},
-std::array<float,2>{0.0435700789f, 0.874714494f},
-std::array<float,2>{0.163931802f, 0.088489078f},
-std::array<float,2>{0.941831946f, 0.900677562f},
-std::array<float,2>{0.665359199f, 0.443678766f},
-std::array<float,2>{0.455024302f, 0.610838175f},
-std::array<float,2>{0.0967841595f, 0.384682804f},
-std::array<float,2>{0.85325253f, 0.560001135f},
-std::array<float,2>{0.570739508f, 0.0240315534f},
-std::array<float,2>{0.340662479f, 0.991059005f},
-std::array<float,2>{0.406013697f, 0.219944045f},
-std::array<float,2>{0.743352711f, 0.775679648f},
-std::array<float,2>{0.885551751f, 0.324670613f},
-std::array<float,2>{0.207178444f, 0.747142076f},
-std::array<float,2>{0.489192069f, 0.496783197f},
-std::array<float,2>{0.630675137f, 0.582529843f},
-std::array<float,2>{0.990025997f, 0.118098803f},
-std::array<float,2>{0.132683843f, 0.90708214f},
-std::array<float,2>{0.0146712922f, 0.128224671f},
-std::array<float,2>{0.805776119f, 0.838144898f},
-std::array<float,2>{0.560637295f, 0.297104716f},
-std::array<float,2>{0.253660351f, 0.633732855f},
-std::array<float,2>{0.234636486f, 0.363837004f},
-std::array<float,2>{0.919338048f, 0.708112121f},
-std::array<float,2>{0.703411102f, 0.21337685f},
-std::array<float,2>{0.41704917f, 0.801694036f},
-std::array<float,2>{0.372888416f, 0.045293387f},
-std::array<float,2>{0.618227124f, 0.961423218f},
-std::array<float,2>{0.8326298f, 0.423826814f},
-std::array<float,2>{0.0900194198f, 0.52539587f},
-std::array<float,2>{0.427613139f, 0.342224091f},
-std::array<float,2>{0.69199568f, 0.725377977f},
-std::array<float,2>{0.923554361f, 0.242328793f},
-std::array<float,2>{0.231143743f, 0.754473329f},
-std::array<float,2>{0.0760444254f, 0.00805666298f},
-std::array<float,2>{0.814938784f, 0.976956367f},
-std::array<float,2>{0.594469905f, 0.400505543f},
-std::array<float,2>{0.355092078f, 0.538365841f},
-std::array<float,2>{0.149551064f, 0.463984251f},
-std::array<float,2>{0.969667196f, 0.599931479f},
-std::array<float,2>{0.644024372f, 0.0723383352f},
-std::array<float,2>{0.468863726f, 0.878167212f},
-std::array<float,2>{0.280597717f, 0.169105351f},
-std::array<float,2>{0.534697413f, 0.858332515f},
-std::array<float,2>{0.790019631f, 0.272063196f},
-std::array<float,2>{0.0170897786f, 0.67182076f},
-std::array<float,2>{0.313542396f, 0.41155231f},
-std::array<float,2>{0.587309778f, 0.500077546f},
-std::array<float,2>{0.868505538f, 0.0545606203f},
-std::array<float,2>{0.114020877f, 0.949054301f},
-std::array<float,2>{0.193024755f, 0.202508345f},
-std::array<float,2>{0.903406382f, 0.787612855f},
-std::array<float,2>{0.727077246f, 0.347789377f},
-std::array<float,2>{0.387947947f, 0.687925041f},
-std::array<float,2>{0.0498489216f, 0.282932401f},
-std::array<float,2>{0.767338693f, 0.648868382f},
-std::array<float,2>{0.527032673f, 0.153422743f},
-std::array<float,2>{0.302926153f, 0.821604073f},
-std::array<float,2>{0.444249302f, 0.0993910506f},
-std::array<float,2>{0.683701038f, 0.93597579f},
-std::array<float,2>{0.967082322f, 0.47071895f},
-std::array<float,2>{0.181162685f, 0.569413245f},
-std::array<float,2>{0.268080682f, 0.322904289f},
-std::array<float,2>{0.54296267f, 0.742681086f},
-std::array<float,2>{0.781450152f, 0.225946352f},
-std::array<float,2>{0.0269196816f, 0.778522253f},
-std::array<float,2>{0.143655047f, 0.0303122494f},
-std::array<float,2>{0.981522143f, 0.987577856f},
-std::array<float,2>{0.651154816f, 0.386748314f},
-std::array<float,2>{0.476686835f, 0.556819141f},
-std::array<float,2>{0.0644178316f, 0.438631803f},
-std::array<float,2>{0.827201605f, 0.614889026f},
-std::array<float,2>{0.604194045f, 0.0914542302f},
-std::array<float,2>{0.348268628f, 0.90288341f},
-std::array<float,2>{0.437300712f, 0.176282123f},
-std::array<float,2>{0.69943738f, 0.86826992f},
-std::array<float,2>{0.93156302f, 0.254702926f},
-std::array<float,2>{0.219116583f, 0.682015836f},
-std::array<float,2>{0.451064199f, 0.42716229f},
-std::array<float,2>{0.672663212f, 0.527941883f},
-std::array<float,2>{0.958048046f, 0.0426930413f},
-std::array<float,2>{0.175262988f, 0.968741298f},
-std::array<float,2>{0.0548740365f, 0.216267347f},
-std::array<float,2>{0.778976381f, 0.797320783f},
-std::array<float,2>{0.523047566f, 0.361500859f},
-std::array<float,2>{0.305177331f, 0.706826329f},
-std::array<float,2>{0.200842723f, 0.302149624f},
-std::array<float,2>{0.895935535f, 0.638933301f},
-std::array<float,2>{0.725255847f, 0.132797211f},
-std::array<float,2>{0.376040548f, 0.842931688f},
-std::array<float,2>{0.327729464f, 0.124339573f},
-std::array<float,2>{0.585205019f, 0.911076128f},
-std::array<float,2>{0.859757483f, 0.495248169f},
-std::array<float,2>{0.124809831f, 0.581791103f},
-std::array<float,2>{0.391065657f, 0.266693562f},
-std::array<float,2>{0.738684833f, 0.665288329f},
-std::array<float,2>{0.882293165f, 0.164438531f},
-std::array<float,2>{0.213845819f, 0.852369189f},
-std::array<float,2>{0.10296569f, 0.0746991783f},
-std::array<float,2>{0.846186638f, 0.880943f},
-std::array<float,2>{0.566257775f, 0.467233628f},
-std::array<float,2>{0.335617959f, 0.597576737f},
-std::array<float,2>{0.167296067f, 0.405829638f},
-std::array<float,2>{0.951327562f, 0.531932533f},
-std::array<float,2>{0.660942018f, 0.0120800119f},
-std::array<float,2>{0.462473094f, 0.982054293f},
-std::array<float,2>{0.28779009f, 0.249248058f},
-std::array<float,2>{0.513682425f, 0.750045359f},
-std::array<float,2>{0.75855577f, 0.339455426f},
-std::array<float,2>{0.0342309922f, 0.72210139f},
-std::array<float,2>{0.359441787f, 0.476104885f},
-std::array<float,2>{0.613350391f, 0.563448668f},
-std::array<float,2>{0.842293739f, 0.0973351523f},
-std::array<float,2>{0.0809504017f, 0.930759251f},
-std::array<float,2>{0.248748496f, 0.149181321f},
-std::array<float,2>{0.912468791f, 0.825143993f},
-std::array<float,2>{0.713418424f, 0.287545711f},
-std::array<float,2>{0.413194388f, 0.653120399f},
-std::array<float,2>{0.00495277345f, 0.346258998f},
-std::array<float,2>{0.802789569f, 0.69331181f},
-std::array<float,2>{0.548379123f, 0.197966665f},
-std::array<float,2>{0.260902643f, 0.781662703f},
-std::array<float,2>{0.496284992f, 0.0469961651f},
-std::array<float,2>{0.634606659f, 0.953064024f},
-std::array<float,2>{0.996980309f, 0.408512831f},
-std::array<float,2>{0.137904078f, 0.505201399f},
-std::array<float,2>{0.336416811f, 0.291561604f},
-std::array<float,2>{0.576894641f, 0.64574641f},
-std::array<float,2>{0.857472241f, 0.141858876f},
-std::array<float,2>{0.101191305f, 0.817252159f},
-std::array<float,2>{0.203346685f, 0.104372121f},
-std::array<float,2>{0.887797356f, 0.926731288f},
-std::array<float,2>{0.746463835f, 0.481391609f},
-std::array<float,2>{0.399287999f, 0.576735437f},
-std::array<float,2>{0.0407107137f, 0.420941859f},
-std::array<float,2>{0.752260923f, 0.514783263f},
-std::array<float,2>{0.502189398f, 0.0552380905f},
-std::array<float,2>{0.294411719f, 0.940265298f},
-std::array<float,2>{0.45948258f, 0.192852199f},
-std::array<float,2>{0.668268085f, 0.792176962f},
-std::array<float,2>{0.94020021f, 0.351651996f},
-std::array<float,2>{0.157805309f, 0.69904846f},
-std::array<float,2>{0.419947803f, 0.453905314f},
-std::array<float,2>{0.708697259f, 0.607972324f},
-std::array<float,2>{0.916230083f, 0.065859586f},
-std::array<float,2>{0.239859566f, 0.88731581f},
-std::array<float,2>{0.0895414054f, 0.15871042f},
-std::array<float,2>{0.829839766f, 0.845647752f},
-std::array<float,2>{0.624967158f, 0.279985636f},
-std::array<float,2>{0.368118346f, 0.65650034f},
-std::array<float,2>{0.125527561f, 0.333984047f},
-std::array<float,2>{0.986515403f, 0.730608761f},
-std::array<float,2>{0.628860176f, 0.239042282f},
-std::array<float,2>{0.48760134f, 0.760268986f},
-std::array<float,2>{0.257790953f, 0.00725766225f},
-std::array<float,2>{0.557525873f, 0.974798203f},
-std::array<float,2>{0.812472522f, 0.396189868f},
-std::array<float,2>{0.0103419889f, 0.541929185f},
-std::array<float,2>{0.475293756f, 0.372771084f},
-std::array<float,2>{0.644809544f, 0.714603841f},
-std::array<float,2>{0.974076867f, 0.206012115f},
-std::array<float,2>{0.154396698f, 0.804715633f},
-std::array<float,2>{0.020705726f, 0.0353936888f},
-std::array<float,2>{0.796656311f, 0.960683644f},
-std::array<float,2>{0.537120163f, 0.430500746f},
-std::array<float,2>{0.276890486f, 0.516408324f},
-std::array<float,2>{0.226907998f, 0.489662021f},
-std::array<float,2>{0.929154694f, 0.58676827f},
-std::array<float,2>{0.689331055f, 0.11585962f},
-std::array<float,2>{0.422838688f, 0.917735934f},
-std::array<float,2>{0.359315842f, 0.135193154f},
-std::array<float,2>{0.600783169f, 0.832221091f},
-std::array<float,2>{0.819304645f, 0.307782799f},
-std::array<float,2>{0.072710149f, 0.63124758f},
-std::array<float,2>{0.297395587f, 0.380499631f},
-std::array<float,2>{0.527465045f, 0.554341614f},
-std::array<float,2>{0.773411632f, 0.0178882349f},
-std::array<float,2>{0.0510609411f, 0.994299769f},
-std::array<float,2>{0.187185571f, 0.228818476f},
-std::array<float,2>{0.961274505f, 0.770774841f},
-std::array<float,2>{0.680162907f, 0.319979548f},
-std::array<float,2>{0.437555134f, 0.738597333f},
-std::array<float,2>{0.110862724f, 0.261015326f},
-std::array<float,2>{0.872676373f, 0.67397368f},
-std::array<float,2>{0.591512144f, 0.184907287f},
-std::array<float,2>{0.317329586f, 0.866147041f},
-std::array<float,2>{0.382888228f, 0.0819339082f},
-std::array<float,2>{0.734354138f, 0.895136595f},
-std::array<float,2>{0.899643958f, 0.451840073f},
-std::array<float,2>{0.189257294f, 0.624672413f},
-std::array<float,2>{0.354513735f, 0.339931548f},
-std::array<float,2>{0.594209552f, 0.72293514f},
-std::array<float,2>{0.815382957f, 0.244648874f},
-std::array<float,2>{0.0754238889f, 0.756911278f},
-std::array<float,2>{0.230882064f, 0.0107155507f},
-std::array<float,2>{0.923125029f, 0.979304671f},
-std::array<float,2>{0.691526175f, 0.398598164f},
-std::array<float,2>{0.426902324f, 0.536836624f},
-std::array<float,2>{0.0171028152f, 0.461058974f},
-std::array<float,2>{0.789253891f, 0.598164678f},
-std::array<float,2>{0.534557462f, 0.0718451813f},
-std::array<float,2>{0.280909181f, 0.87570107f},
-std::array<float,2>{0.469694048f, 0.171744242f},
-std::array<float,2>{0.644514382f, 0.856823564f},
-std::array<float,2>{0.969120145f, 0.270811051f},
-std::array<float,2>{0.150226265f, 0.669130445f},
-std::array<float,2>{0.388212174f, 0.41399911f},
-std::array<float,2>{0.726617038f, 0.503207922f},
-std::array<float,2>{0.904205859f, 0.0522382446f},
-std::array<float,2>{0.192429379f, 0.94629389f},
-std::array<float,2>{0.113647811f, 0.200466335f},
-std::array<float,2>{0.868943214f, 0.786070764f},
-std::array<float,2>{0.587751865f, 0.350993961f},
-std::array<float,2>{0.314114422f, 0.689763367f},
-std::array<float,2>{0.181110755f, 0.283236265f},
-std::array<float,2>{0.967468977f, 0.651266754f},
-std::array<float,2>{0.684312105f, 0.155440196f},
-std::array<float,2>{0.443588942f, 0.824041843f},
-std::array<float,2>{0.303416222f, 0.100394763f},
-std::array<float,2>{0.526796699f, 0.93380183f},
-std::array<float,2>{0.766622961f, 0.470299631f},
-std::array<float,2>{0.0505412966f, 0.566485763f},
-std::array<float,2>{0.454576969f, 0.250178844f},
-std::array<float,2>{0.665595412f, 0.687140942f},
-std::array<float,2>{0.942206144f, 0.174426675f},
-std::array<float,2>{0.163519949f, 0.872195482f},
-std::array<float,2>{0.0431740545f, 0.0874662772f},
-std::array<float,2>{0.756056011f, 0.900260985f},
-std::array<float,2>{0.507485271f, 0.441424102f},
-std::array<float,2>{0.289809138f, 0.611618698f},
-std::array<float,2>{0.207734644f, 0.385302305f},
-std::array<float,2>{0.885070145f, 0.561782539f},
-std::array<float,2>{0.743996978f, 0.026867805f},
-std::array<float,2>{0.405281872f, 0.988637924f},
-std::array<float,2>{0.339857548f, 0.221162632f},
-std::array<float,2>{0.570983887f, 0.774291039f},
-std::array<float,2>{0.852863908f, 0.327912748f},
-std::array<float,2>{0.0973594263f, 0.749246836f},
-std::array<float,2>{0.253367215f, 0.499516129f},
-std::array<float,2>{0.561097682f, 0.585218191f},
-std::array<float,2>{0.806497455f, 0.120592229f},
-std::array<float,2>{0.0151966102f, 0.910022259f},
-std::array<float,2>{0.132237822f, 0.12651974f},
-std::array<float,2>{0.989411533f, 0.837767959f},
-std::array<float,2>{0.630337715f, 0.300454825f},
-std::array<float,2>{0.488568634f, 0.63540256f},
-std::array<float,2>{0.090530619f, 0.367130876f},
-std::array<float,2>{0.832489848f, 0.709958375f},
-std::array<float,2>{0.61868602f, 0.21212393f},
-std::array<float,2>{0.372401297f, 0.803676844f},
-std::array<float,2>{0.417562366f, 0.0447023287f},
-std::array<float,2>{0.703690469f, 0.962919891f},
-std::array<float,2>{0.919765353f, 0.424382269f},
-std::array<float,2>{0.235143274f, 0.524473727f},
-std::array<float,2>{0.282385796f, 0.309667856f},
-std::array<float,2>{0.508802056f, 0.626129985f},
-std::array<float,2>{0.764302671f, 0.136893153f},
-std::array<float,2>{0.0382686593f, 0.831007957f},
-std::array<float,2>{0.171776935f, 0.110290579f},
-std::array<float,2>{0.946314514f, 0.918168128f},
-std::array<float,2>{0.658226132f, 0.486392587f},
-std::array<float,2>{0.465717882f, 0.591949105f},
-std::array<float,2>{0.106604546f, 0.436811924f},
-std::array<float,2>{0.8488276f, 0.523369312f},
-std::array<float,2>{0.570059955f, 0.0345639996f},
-std::array<float,2>{0.328240097f, 0.956887424f},
-std::array<float,2>{0.396827251f, 0.209592357f},
-std::array<float,2>{0.7365309f, 0.810971916f},
-std::array<float,2>{0.876363993f, 0.367302507f},
-std::array<float,2>{0.21776098f, 0.714869559f},
-std::array<float,2>{0.493277788f, 0.446840674f},
-std::array<float,2>{0.637361586f, 0.617722273f},
-std::array<float,2>{0.993608475f, 0.0839964002f},
-std::array<float,2>{0.134124205f, 0.891117752f},
-std::array<float,2>{0.00127063401f, 0.182778716f},
-std::array<float,2>{0.798593879f, 0.862672091f},
-std::array<float,2>{0.553762913f, 0.264689177f},
-std::array<float,2>{0.26173076f, 0.677670956f},
-std::array<float,2>{0.243754387f, 0.312986642f},
-std::array<float,2>{0.906606913f, 0.736239314f},
-std::array<float,2>{0.717992544f, 0.23415111f},
-std::array<float,2>{0.409211963f, 0.767927468f},
-std::array<float,2>{0.366528124f, 0.0232255924f},
-std::array<float,2>{0.613169611f, 0.996202946f},
-std::array<float,2>{0.836509228f, 0.375729173f},
-std::array<float,2>{0.0843181685f, 0.549763024f},
-std::array<float,2>{0.429736167f, 0.358678073f},
-std::array<float,2>{0.699174881f, 0.700242043f},
-std::array<float,2>{0.933734655f, 0.189773157f},
-std::array<float,2>{0.226060927f, 0.795437694f},
-std::array<float,2>{0.0669128522f, 0.0587001629f},
-std::array<float,2>{0.821125209f, 0.942063034f},
-std::array<float,2>{0.608677506f, 0.414498478f},
-std::array<float,2>{0.343847215f, 0.509683549f},
-std::array<float,2>{0.147748888f, 0.479939401f},
-std::array<float,2>{0.978557229f, 0.571267605f},
-std::array<float,2>{0.65330857f, 0.108587407f},
-std::array<float,2>{0.48279357f, 0.924279094f},
-std::array<float,2>{0.273078769f, 0.147848964f},
-std::array<float,2>{0.544033885f, 0.816371858f},
-std::array<float,2>{0.78896004f, 0.294191241f},
-std::array<float,2>{0.0288014039f, 0.644067407f},
-std::array<float,2>{0.321268141f, 0.392547488f},
-std::array<float,2>{0.578673244f, 0.544464529f},
-std::array<float,2>{0.864201069f, 0.00361689529f},
-std::array<float,2>{0.120101355f, 0.969420195f},
-std::array<float,2>{0.195621952f, 0.235523954f},
-std::array<float,2>{0.891768038f, 0.765192568f},
-std::array<float,2>{0.721261263f, 0.328678757f},
-std::array<float,2>{0.380673975f, 0.726804674f},
-std::array<float,2>{0.0598750189f, 0.274435312f},
-std::array<float,2>{0.775567055f, 0.662948608f},
-std::array<float,2>{0.517028153f, 0.161691308f},
-std::array<float,2>{0.310900956f, 0.848111272f},
-std::array<float,2>{0.447519481f, 0.0673797578f},
-std::array<float,2>{0.67723918f, 0.885478139f},
-std::array<float,2>{0.955049217f, 0.459464282f},
-std::array<float,2>{0.175917849f, 0.605120003f},
-std::array<float,2>{0.276646942f, 0.374650538f},
-std::array<float,2>{0.537957966f, 0.711857796f},
-std::array<float,2>{0.796011686f, 0.204412654f},
-std::array<float,2>{0.0211350378f, 0.806782484f},
-std::array<float,2>{0.154950678f, 0.0377848782f},
-std::array<float,2>{0.974442303f, 0.958225667f},
-std::array<float,2>{0.645305276f, 0.432970166f},
-std::array<float,2>{0.475090176f, 0.517806649f},
-std::array<float,2>{0.072912842f, 0.491861403f},
-std::array<float,2>{0.818525136f, 0.588500619f},
-std::array<float,2>{0.601546228f, 0.11421299f},
-std::array<float,2>{0.358738929f, 0.914531946f},
-std::array<float,2>{0.422097117f, 0.133916989f},
-std::array<float,2>{0.68880403f, 0.835074186f},
-std::array<float,2>{0.929513156f, 0.306270778f},
-std::array<float,2>{0.227239341f, 0.629701853f},
-std::array<float,2>{0.438270122f, 0.381253004f},
-std::array<float,2>{0.680554271f, 0.552185059f},
-std::array<float,2>{0.961865127f, 0.0174417067f},
-std::array<float,2>{0.186780497f, 0.992911935f},
-std::array<float,2>{0.0515774861f, 0.22684826f},
-std::array<float,2>{0.772473931f, 0.772484064f},
-std::array<float,2>{0.528057337f, 0.316653937f},
-std::array<float,2>{0.297340214f, 0.741269946f},
-std::array<float,2>{0.188567489f, 0.259515375f},
-std::array<float,2>{0.900381088f, 0.672837377f},
-std::array<float,2>{0.733449161f, 0.186946094f},
-std::array<float,2>{0.383498043f, 0.864477336f},
-std::array<float,2>{0.316531092f, 0.0788230374f},
-std::array<float,2>{0.59110254f, 0.897834599f},
-std::array<float,2>{0.872343779f, 0.449552208f},
-std::array<float,2>{0.110647954f, 0.6227929f},
-std::array<float,2>{0.398878008f, 0.289985359f},
-std::array<float,2>{0.746822357f, 0.648250222f},
-std::array<float,2>{0.888510466f, 0.143577248f},
-std::array<float,2>{0.203641519f, 0.819904983f},
-std::array<float,2>{0.100772418f, 0.102566816f},
-std::array<float,2>{0.858076334f, 0.928524435f},
-std::array<float,2>{0.576608062f, 0.48397541f},
-std::array<float,2>{0.336732388f, 0.575808346f},
-std::array<float,2>{0.157706544f, 0.418437034f},
-std::array<float,2>{0.939588666f, 0.512834311f},
-std::array<float,2>{0.668719947f, 0.0577979907f},
-std::array<float,2>{0.459421992f, 0.93912667f},
-std::array<float,2>{0.294846267f, 0.19345434f},
-std::array<float,2>{0.502548933f, 0.789633036f},
-std::array<float,2>{0.752687454f, 0.355416268f},
-std::array<float,2>{0.0402893499f, 0.696943045f},
-std::array<float,2>{0.367240906f, 0.45621562f},
-std::array<float,2>{0.62449193f, 0.605692267f},
-std::array<float,2>{0.8292467f, 0.0627046376f},
-std::array<float,2>{0.0890835375f, 0.889507115f},
-std::array<float,2>{0.239327386f, 0.157350406f},
-std::array<float,2>{0.916578591f, 0.8468768f},
-std::array<float,2>{0.708366334f, 0.277934909f},
-std::array<float,2>{0.420511156f, 0.658303261f},
-std::array<float,2>{0.00992839597f, 0.335305542f},
-std::array<float,2>{0.811621249f, 0.733000875f},
-std::array<float,2>{0.557017922f, 0.240990087f},
-std::array<float,2>{0.257243395f, 0.757913411f},
-std::array<float,2>{0.487931073f, 0.00396362878f},
-std::array<float,2>{0.628252268f, 0.972672105f},
-std::array<float,2>{0.987134993f, 0.39704591f},
-std::array<float,2>{0.125231281f, 0.539066255f},
-std::array<float,2>{0.335053384f, 0.268301338f},
-std::array<float,2>{0.565708637f, 0.666086316f},
-std::array<float,2>{0.846645534f, 0.166148067f},
-std::array<float,2>{0.103251711f, 0.853954315f},
-std::array<float,2>{0.213021293f, 0.0775312558f},
-std::array<float,2>{0.88255477f, 0.879615545f},
-std::array<float,2>{0.739220321f, 0.465389878f},
-std::array<float,2>{0.39154315f, 0.593759f},
-std::array<float,2>{0.0349918902f, 0.404129416f},
-std::array<float,2>{0.758136511f, 0.534725249f},
-std::array<float,2>{0.514360607f, 0.0139350975f},
-std::array<float,2>{0.287428558f, 0.98433584f},
-std::array<float,2>{0.462061882f, 0.246899605f},
-std::array<float,2>{0.660580456f, 0.753748715f},
-std::array<float,2>{0.952030122f, 0.337611079f},
-std::array<float,2>{0.167814881f, 0.719493449f},
-std::array<float,2>{0.413956285f, 0.473699987f},
-std::array<float,2>{0.713211298f, 0.566389263f},
-std::array<float,2>{0.912767351f, 0.0943072513f},
-std::array<float,2>{0.248207107f, 0.931922734f},
-std::array<float,2>{0.0804707184f, 0.150453553f},
-std::array<float,2>{0.842280567f, 0.82735312f},
-std::array<float,2>{0.614250362f, 0.286283851f},
-std::array<float,2>{0.360095054f, 0.655223131f},
-std::array<float,2>{0.138400331f, 0.344385386f},
-std::array<float,2>{0.996451318f, 0.69389385f},
-std::array<float,2>{0.634059608f, 0.197012037f},
-std::array<float,2>{0.497027636f, 0.783321023f},
-std::array<float,2>{0.261289328f, 0.0501902439f},
-std::array<float,2>{0.548019886f, 0.949273407f},
-std::array<float,2>{0.803274632f, 0.407747567f},
-std::array<float,2>{0.00572467875f, 0.507781982f},
-std::array<float,2>{0.477096826f, 0.320726156f},
-std::array<float,2>{0.650804639f, 0.745836198f},
-std::array<float,2>{0.982031167f, 0.224156931f},
-std::array<float,2>{0.144440114f, 0.779618084f},
-std::array<float,2>{0.0266763065f, 0.0283985715f},
-std::array<float,2>{0.781954885f, 0.984603703f},
-std::array<float,2>{0.54220444f, 0.390527368f},
-std::array<float,2>{0.267938554f, 0.555164874f},
-std::array<float,2>{0.219454721f, 0.440714568f},
-std::array<float,2>{0.930787683f, 0.616966009f},
-std::array<float,2>{0.700172901f, 0.0926462561f},
-std::array<float,2>{0.436575353f, 0.904578686f},
-std::array<float,2>{0.347725004f, 0.17816025f},
-std::array<float,2>{0.603811085f, 0.869992375f},
-std::array<float,2>{0.827969909f, 0.256745607f},
-std::array<float,2>{0.063526094f, 0.680698574f},
-std::array<float,2>{0.30490315f, 0.428066313f},
-std::array<float,2>{0.522801876f, 0.530772924f},
-std::array<float,2>{0.778370619f, 0.0398269035f},
-std::array<float,2>{0.0554011688f, 0.965145469f},
-std::array<float,2>{0.17555669f, 0.218471974f},
-std::array<float,2>{0.958724797f, 0.799258947f},
-std::array<float,2>{0.672355592f, 0.35958159f},
-std::array<float,2>{0.450586289f, 0.704527974f},
-std::array<float,2>{0.124448024f, 0.303388447f},
-std::array<float,2>{0.860313237f, 0.636768401f},
-std::array<float,2>{0.585719585f, 0.129440933f},
-std::array<float,2>{0.327395409f, 0.840016425f},
-std::array<float,2>{0.376641214f, 0.12223614f},
-std::array<float,2>{0.724899113f, 0.912844718f},
-std::array<float,2>{0.896169603f, 0.492305487f},
-std::array<float,2>{0.200422943f, 0.579028368f},
-std::array<float,2>{0.315160602f, 0.348612577f},
-std::array<float,2>{0.588114202f, 0.687995553f},
-std::array<float,2>{0.869693577f, 0.202824205f},
-std::array<float,2>{0.115352213f, 0.787430763f},
-std::array<float,2>{0.194271713f, 0.0539006665f},
-std::array<float,2>{0.905236185f, 0.948263228f},
-std::array<float,2>{0.729976594f, 0.411866426f},
-std::array<float,2>{0.389276564f, 0.500773072f},
-std::array<float,2>{0.0475271866f, 0.471324027f},
-std::array<float,2>{0.767983794f, 0.569932461f},
-std::array<float,2>{0.524533868f, 0.0986608341f},
-std::array<float,2>{0.301468968f, 0.93636632f},
-std::array<float,2>{0.442498296f, 0.154262349f},
-std::array<float,2>{0.687248886f, 0.822253048f},
-std::array<float,2>{0.966781795f, 0.282411307f},
-std::array<float,2>{0.183391854f, 0.649236619f},
-std::array<float,2>{0.42802161f, 0.401365876f},
-std::array<float,2>{0.694786489f, 0.538863063f},
-std::array<float,2>{0.924380243f, 0.00864330214f},
-std::array<float,2>{0.234102324f, 0.977438033f},
-std::array<float,2>{0.0764689967f, 0.242900312f},
-std::array<float,2>{0.813127637f, 0.754137635f},
-std::array<float,2>{0.59713608f, 0.342706263f},
-std::array<float,2>{0.352582753f, 0.724674046f},
-std::array<float,2>{0.152218834f, 0.271885455f},
-std::array<float,2>{0.97228545f, 0.671194732f},
-std::array<float,2>{0.642022729f, 0.169494689f},
-std::array<float,2>{0.472132444f, 0.857800305f},
-std::array<float,2>{0.278417915f, 0.0731245577f},
-std::array<float,2>{0.532697201f, 0.8788293f},
-std::array<float,2>{0.791031539f, 0.464591116f},
-std::array<float,2>{0.0191027597f, 0.600506842f},
-std::array<float,2>{0.491110414f, 0.297742426f},
-std::array<float,2>{0.632674456f, 0.633196294f},
-std::array<float,2>{0.990959704f, 0.128461748f},
-std::array<float,2>{0.12924476f, 0.838775218f},
-std::array<float,2>{0.0132930288f, 0.117640495f},
-std::array<float,2>{0.807855487f, 0.906320035f},
-std::array<float,2>{0.55948782f, 0.496182531f},
-std::array<float,2>{0.250931948f, 0.582242489f},
-std::array<float,2>{0.238061383f, 0.422963619f},
-std::array<float,2>{0.920453966f, 0.526000321f},
-std::array<float,2>{0.705156028f, 0.0458754115f},
-std::array<float,2>{0.415811002f, 0.961729944f},
-std::array<float,2>{0.37400353f, 0.213440239f},
-std::array<float,2>{0.621072412f, 0.801025927f},
-std::array<float,2>{0.83471024f, 0.363591641f},
-std::array<float,2>{0.0937330499f, 0.708790064f},
-std::array<float,2>{0.291513592f, 0.444318295f},
-std::array<float,2>{0.50497061f, 0.611290097f},
-std::array<float,2>{0.754609108f, 0.0879911706f},
-std::array<float,2>{0.0453479774f, 0.901096702f},
-std::array<float,2>{0.161913529f, 0.173664242f},
-std::array<float,2>{0.945114255f, 0.874295712f},
-std::array<float,2>{0.667343974f, 0.252757043f},
-std::array<float,2>{0.456681401f, 0.685130358f},
-std::array<float,2>{0.0942698643f, 0.325092882f},
-std::array<float,2>{0.853628576f, 0.747594595f},
-std::array<float,2>{0.573763311f, 0.220267266f},
-std::array<float,2>{0.342336208f, 0.776144505f},
-std::array<float,2>{0.402758926f, 0.0237491596f},
-std::array<float,2>{0.744555831f, 0.990350485f},
-std::array<float,2>{0.884656966f, 0.383874476f},
-std::array<float,2>{0.210689142f, 0.560538888f},
-std::array<float,2>{0.263708681f, 0.263034225f},
-std::array<float,2>{0.55099082f, 0.67927736f},
-std::array<float,2>{0.799389541f, 0.179693624f},
-std::array<float,2>{0.00202706177f, 0.861128926f},
-std::array<float,2>{0.136540011f, 0.0824043304f},
-std::array<float,2>{0.995598614f, 0.892781556f},
-std::array<float,2>{0.639751911f, 0.449048817f},
-std::array<float,2>{0.496038109f, 0.620362401f},
-std::array<float,2>{0.0833196789f, 0.377833396f},
-std::array<float,2>{0.838406384f, 0.547961414f},
-std::array<float,2>{0.610951006f, 0.0205337554f},
-std::array<float,2>{0.36441347f, 0.999292254f},
-std::array<float,2>{0.407069385f, 0.231486633f},
-std::array<float,2>{0.715954065f, 0.766707838f},
-std::array<float,2>{0.909382164f, 0.316239029f},
-std::array<float,2>{0.244444326f, 0.736752272f},
-std::array<float,2>{0.468059689f, 0.485601068f},
-std::array<float,2>{0.656838596f, 0.591098905f},
-std::array<float,2>{0.948927701f, 0.113226928f},
-std::array<float,2>{0.169658333f, 0.921774626f},
-std::array<float,2>{0.0367791876f, 0.139651462f},
-std::array<float,2>{0.762551904f, 0.829934835f},
-std::array<float,2>{0.51156193f, 0.311238319f},
-std::array<float,2>{0.283676952f, 0.627220273f},
-std::array<float,2>{0.216557473f, 0.370558351f},
-std::array<float,2>{0.877670169f, 0.718576491f},
-std::array<float,2>{0.735197246f, 0.207136363f},
-std::array<float,2>{0.395060182f, 0.809838474f},
-std::array<float,2>{0.330792904f, 0.0331162624f},
-std::array<float,2>{0.567833543f, 0.953210771f},
-std::array<float,2>{0.851128459f, 0.433842987f},
-std::array<float,2>{0.108075872f, 0.520070255f},
-std::array<float,2>{0.382420838f, 0.331250489f},
-std::array<float,2>{0.71899116f, 0.729243755f},
-std::array<float,2>{0.894468307f, 0.238096967f},
-std::array<float,2>{0.197832868f, 0.762294173f},
-std::array<float,2>{0.118559331f, 0.00042068708f},
-std::array<float,2>{0.865435958f, 0.971344769f},
-std::array<float,2>{0.580301821f, 0.394454956f},
-std::array<float,2>{0.323722959f, 0.544986367f},
-std::array<float,2>{0.178716183f, 0.458069354f},
-std::array<float,2>{0.95694226f, 0.602107406f},
-std::array<float,2>{0.678724229f, 0.0696100742f},
-std::array<float,2>{0.446084559f, 0.883663714f},
-std::array<float,2>{0.309966564f, 0.163561076f},
-std::array<float,2>{0.518299162f, 0.850117087f},
-std::array<float,2>{0.774039507f, 0.27659598f},
-std::array<float,2>{0.0622844882f, 0.661663353f},
-std::array<float,2>{0.34647882f, 0.416470528f},
-std::array<float,2>{0.607207477f, 0.511232972f},
-std::array<float,2>{0.822751641f, 0.0616027601f},
-std::array<float,2>{0.0685298517f, 0.944901824f},
-std::array<float,2>{0.223510861f, 0.188407004f},
-std::array<float,2>{0.937032998f, 0.793052256f},
-std::array<float,2>{0.696549058f, 0.355690002f},
-std::array<float,2>{0.433476299f, 0.7023592f},
-std::array<float,2>{0.0305479076f, 0.296576917f},
-std::array<float,2>{0.785430491f, 0.641244888f},
-std::array<float,2>{0.54652971f, 0.145757601f},
-std::array<float,2>{0.27040863f, 0.813003957f},
-std::array<float,2>{0.482349813f, 0.106907889f},
-std::array<float,2>{0.655674994f, 0.921993077f},
-std::array<float,2>{0.978187442f, 0.477963358f},
-std::array<float,2>{0.145151675f, 0.572328269f},
-std::array<float,2>{0.299146712f, 0.319535851f},
-std::array<float,2>{0.530877531f, 0.738887429f},
-std::array<float,2>{0.769825161f, 0.229169428f},
-std::array<float,2>{0.0540665165f, 0.771023512f},
-std::array<float,2>{0.184113652f, 0.0183542427f},
-std::array<float,2>{0.964830697f, 0.994896591f},
-std::array<float,2>{0.683434427f, 0.380016357f},
-std::array<float,2>{0.440308005f, 0.553956628f},
-std::array<float,2>{0.112272844f, 0.451303035f},
-std::array<float,2>{0.874810517f, 0.62418741f},
-std::array<float,2>{0.592079103f, 0.0815035999f},
-std::array<float,2>{0.319070369f, 0.895018578f},
-std::array<float,2>{0.386310816f, 0.185171038f},
-std::array<float,2>{0.730684578f, 0.865262985f},
-std::array<float,2>{0.901605248f, 0.261665583f},
-std::array<float,2>{0.191290721f, 0.674350798f},
-std::array<float,2>{0.473394364f, 0.429856747f},
-std::array<float,2>{0.647947133f, 0.515792489f},
-std::array<float,2>{0.975591958f, 0.0358442478f},
-std::array<float,2>{0.153242171f, 0.960091531f},
-std::array<float,2>{0.0228873398f, 0.205496415f},
-std::array<float,2>{0.793399036f, 0.805661976f},
-std::array<float,2>{0.536530316f, 0.372316867f},
-std::array<float,2>{0.274928927f, 0.714065433f},
-std::array<float,2>{0.229657963f, 0.30855903f},
-std::array<float,2>{0.927522779f, 0.631746113f},
-std::array<float,2>{0.69096601f, 0.135609999f},
-std::array<float,2>{0.42555058f, 0.832977474f},
-std::array<float,2>{0.356265128f, 0.115270406f},
-std::array<float,2>{0.598435581f, 0.917003751f},
-std::array<float,2>{0.816825867f, 0.489855617f},
-std::array<float,2>{0.0712399557f, 0.586164892f},
-std::array<float,2>{0.419368476f, 0.27961868f},
-std::array<float,2>{0.7093153f, 0.657034516f},
-std::array<float,2>{0.915520012f, 0.158595785f},
-std::array<float,2>{0.241677836f, 0.845018983f},
-std::array<float,2>{0.0862957165f, 0.0661890805f},
-std::array<float,2>{0.830863178f, 0.886898339f},
-std::array<float,2>{0.6227355f, 0.453409433f},
-std::array<float,2>{0.370438397f, 0.607655466f},
-std::array<float,2>{0.128492504f, 0.395508945f},
-std::array<float,2>{0.98552531f, 0.541467309f},
-std::array<float,2>{0.625199676f, 0.00741666974f},
-std::array<float,2>{0.484820873f, 0.975222349f},
-std::array<float,2>{0.254463285f, 0.238454238f},
-std::array<float,2>{0.556179047f, 0.759978652f},
-std::array<float,2>{0.80973208f, 0.333185047f},
-std::array<float,2>{0.00847349688f, 0.73106885f},
-std::array<float,2>{0.33948639f, 0.480806112f},
-std::array<float,2>{0.575726807f, 0.576439261f},
-std::array<float,2>{0.857195795f, 0.103923522f},
-std::array<float,2>{0.0994112641f, 0.925942481f},
-std::array<float,2>{0.206690699f, 0.142575383f},
-std::array<float,2>{0.889383554f, 0.816504598f},
-std::array<float,2>{0.749093771f, 0.291038156f},
-std::array<float,2>{0.401233435f, 0.646461964f},
-std::array<float,2>{0.0422431566f, 0.352290213f},
-std::array<float,2>{0.750119388f, 0.698462784f},
-std::array<float,2>{0.500452399f, 0.19319877f},
-std::array<float,2>{0.296548754f, 0.792639971f},
-std::array<float,2>{0.458304852f, 0.0546925217f},
-std::array<float,2>{0.670641422f, 0.939560235f},
-std::array<float,2>{0.937939644f, 0.421459585f},
-std::array<float,2>{0.158552676f, 0.515150428f},
-std::array<float,2>{0.362956136f, 0.287727833f},
-std::array<float,2>{0.615557969f, 0.652395725f},
-std::array<float,2>{0.840580344f, 0.148455232f},
-std::array<float,2>{0.0797514319f, 0.824517667f},
-std::array<float,2>{0.247420281f, 0.097155571f},
-std::array<float,2>{0.911948085f, 0.931161165f},
-std::array<float,2>{0.71190995f, 0.475680798f},
-std::array<float,2>{0.410995036f, 0.562847376f},
-std::array<float,2>{0.00650612265f, 0.408936113f},
-std::array<float,2>{0.802043736f, 0.505695701f},
-std::array<float,2>{0.549779177f, 0.0478460491f},
-std::array<float,2>{0.259198338f, 0.952324867f},
-std::array<float,2>{0.498954087f, 0.197631001f},
-std::array<float,2>{0.635675192f, 0.782024264f},
-std::array<float,2>{0.998711824f, 0.345710725f},
-std::array<float,2>{0.139945388f, 0.692707956f},
-std::array<float,2>{0.393608689f, 0.467623889f},
-std::array<float,2>{0.740300059f, 0.596741259f},
-std::array<float,2>{0.879631877f, 0.0751695186f},
-std::array<float,2>{0.211803719f, 0.881711006f},
-std::array<float,2>{0.104451455f, 0.164693788f},
-std::array<float,2>{0.844288886f, 0.852031827f},
-std::array<float,2>{0.562968671f, 0.267473072f},
-std::array<float,2>{0.33216399f, 0.665963352f},
-std::array<float,2>{0.164814159f, 0.338898093f},
-std::array<float,2>{0.951065004f, 0.722316086f},
-std::array<float,2>{0.663539231f, 0.249870881f},
-std::array<float,2>{0.463750899f, 0.750532687f},
-std::array<float,2>{0.286419332f, 0.0125158895f},
-std::array<float,2>{0.512781322f, 0.981504977f},
-std::array<float,2>{0.761401057f, 0.405441284f},
-std::array<float,2>{0.0326588117f, 0.531474531f},
-std::array<float,2>{0.452435732f, 0.361821562f},
-std::array<float,2>{0.674085677f, 0.706540942f},
-std::array<float,2>{0.960304499f, 0.216324225f},
-std::array<float,2>{0.173158765f, 0.797722399f},
-std::array<float,2>{0.0566965342f, 0.0422658622f},
-std::array<float,2>{0.779367089f, 0.967875242f},
-std::array<float,2>{0.519684017f, 0.427691489f},
-std::array<float,2>{0.307273835f, 0.527451932f},
-std::array<float,2>{0.201656371f, 0.495655239f},
-std::array<float,2>{0.897698879f, 0.581195951f},
-std::array<float,2>{0.723587275f, 0.124978118f},
-std::array<float,2>{0.37863946f, 0.910334527f},
-std::array<float,2>{0.326116055f, 0.132071331f},
-std::array<float,2>{0.58382082f, 0.84367156f},
-std::array<float,2>{0.862380266f, 0.302567899f},
-std::array<float,2>{0.121252492f, 0.639166415f},
-std::array<float,2>{0.265684485f, 0.387669295f},
-std::array<float,2>{0.540152788f, 0.557497203f},
-std::array<float,2>{0.784317136f, 0.0310739186f},
-std::array<float,2>{0.0250654891f, 0.987903059f},
-std::array<float,2>{0.142291233f, 0.226206735f},
-std::array<float,2>{0.983326912f, 0.77903378f},
-std::array<float,2>{0.64970994f, 0.322634518f},
-std::array<float,2>{0.479293555f, 0.742469192f},
-std::array<float,2>{0.0663606375f, 0.253996164f},
-std::array<float,2>{0.82600981f, 0.682342887f},
-std::array<float,2>{0.602318764f, 0.175893858f},
-std::array<float,2>{0.350519329f, 0.868966639f},
-std::array<float,2>{0.434133977f, 0.0909404382f},
-std::array<float,2>{0.70226109f, 0.90250957f},
-std::array<float,2>{0.933549166f, 0.438993961f},
-std::array<float,2>{0.221770585f, 0.614441097f},
-std::array<float,2>{0.343068153f, 0.326432824f},
-std::array<float,2>{0.572834432f, 0.74846375f},
-std::array<float,2>{0.854502738f, 0.221769571f},
-std::array<float,2>{0.0955291092f, 0.774973512f},
-std::array<float,2>{0.209592104f, 0.0261214338f},
-std::array<float,2>{0.883207798f, 0.989997089f},
-std::array<float,2>{0.746077478f, 0.386170328f},
-std::array<float,2>{0.403716296f, 0.560766399f},
-std::array<float,2>{0.0466277078f, 0.443015128f},
-std::array<float,2>{0.755366087f, 0.612482786f},
-std::array<float,2>{0.504032314f, 0.0867560804f},
-std::array<float,2>{0.292641431f, 0.898698866f},
-std::array<float,2>{0.455591857f, 0.175324231f},
-std::array<float,2>{0.666749895f, 0.871098876f},
-std::array<float,2>{0.944167733f, 0.251338661f},
-std::array<float,2>{0.160531238f, 0.686338067f},
-std::array<float,2>{0.414446205f, 0.425046027f},
-std::array<float,2>{0.706895173f, 0.523803771f},
-std::array<float,2>{0.921753347f, 0.0431259647f},
-std::array<float,2>{0.236549377f, 0.964285672f},
-std::array<float,2>{0.0918387547f, 0.211234808f},
-std::array<float,2>{0.835185826f, 0.803916335f},
-std::array<float,2>{0.619623482f, 0.365412593f},
-std::array<float,2>{0.374290586f, 0.709972858f},
-std::array<float,2>{0.130264848f, 0.299601555f},
-std::array<float,2>{0.991893232f, 0.636486888f},
-std::array<float,2>{0.630882919f, 0.125002936f},
-std::array<float,2>{0.491595238f, 0.836356759f},
-std::array<float,2>{0.250987411f, 0.119333707f},
-std::array<float,2>{0.560057104f, 0.908824503f},
-std::array<float,2>{0.807614684f, 0.498570979f},
-std::array<float,2>{0.0126046035f, 0.584808171f},
-std::array<float,2>{0.47114408f, 0.270017743f},
-std::array<float,2>{0.641011715f, 0.668222904f},
-std::array<float,2>{0.970806181f, 0.170295984f},
-std::array<float,2>{0.150771454f, 0.85590142f},
-std::array<float,2>{0.0182561316f, 0.0711588562f},
-std::array<float,2>{0.792192221f, 0.876200616f},
-std::array<float,2>{0.531957984f, 0.46262899f},
-std::array<float,2>{0.2775006f, 0.599117994f},
-std::array<float,2>{0.233048618f, 0.39969638f},
-std::array<float,2>{0.924949646f, 0.53555125f},
-std::array<float,2>{0.693664134f, 0.0112939337f},
-std::array<float,2>{0.42871812f, 0.980061233f},
-std::array<float,2>{0.351585686f, 0.245540097f},
-std::array<float,2>{0.595734775f, 0.75652492f},
-std::array<float,2>{0.814006984f, 0.341170579f},
-std::array<float,2>{0.0771757737f, 0.724094629f},
-std::array<float,2>{0.301767409f, 0.469132692f},
-std::array<float,2>{0.523581564f, 0.56827718f},
-std::array<float,2>{0.769432187f, 0.10123904f},
-std::array<float,2>{0.0479667038f, 0.935321927f},
-std::array<float,2>{0.181987017f, 0.154774293f},
-std::array<float,2>{0.964978278f, 0.822841823f},
-std::array<float,2>{0.686365962f, 0.284732729f},
-std::array<float,2>{0.441992998f, 0.652280867f},
-std::array<float,2>{0.116456725f, 0.349622756f},
-std::array<float,2>{0.870497584f, 0.690893948f},
-std::array<float,2>{0.589582205f, 0.199704215f},
-std::array<float,2>{0.315895855f, 0.786838591f},
-std::array<float,2>{0.389671922f, 0.0516428351f},
-std::array<float,2>{0.729173303f, 0.945698977f},
-std::array<float,2>{0.905757368f, 0.412325293f},
-std::array<float,2>{0.194749206f, 0.502563179f},
-std::array<float,2>{0.271220297f, 0.293678671f},
-std::array<float,2>{0.545849442f, 0.643553376f},
-std::array<float,2>{0.786184549f, 0.146841899f},
-std::array<float,2>{0.0297913458f, 0.814734042f},
-std::array<float,2>{0.146118313f, 0.108218424f},
-std::array<float,2>{0.977177858f, 0.924887538f},
-std::array<float,2>{0.65460515f, 0.478657424f},
-std::array<float,2>{0.481249064f, 0.571336925f},
-std::array<float,2>{0.0694218352f, 0.415695846f},
-std::array<float,2>{0.824026167f, 0.508064985f},
-std::array<float,2>{0.605965972f, 0.0598124713f},
-std::array<float,2>{0.347093254f, 0.943179011f},
-std::array<float,2>{0.43221274f, 0.191388294f},
-std::array<float,2>{0.695986092f, 0.796815217f},
-std::array<float,2>{0.936010182f, 0.35831058f},
-std::array<float,2>{0.224391207f, 0.699955463f},
-std::array<float,2>{0.446662992f, 0.460063487f},
-std::array<float,2>{0.678585052f, 0.603759944f},
-std::array<float,2>{0.955664396f, 0.0677279457f},
-std::array<float,2>{0.177762583f, 0.886411548f},
-std::array<float,2>{0.0612052232f, 0.160445526f},
-std::array<float,2>{0.774803162f, 0.848937094f},
-std::array<float,2>{0.519023597f, 0.273960561f},
-std::array<float,2>{0.308831841f, 0.663393557f},
-std::array<float,2>{0.198598668f, 0.32940495f},
-std::array<float,2>{0.892624259f, 0.728214085f},
-std::array<float,2>{0.720621228f, 0.235002324f},
-std::array<float,2>{0.381827086f, 0.763867855f},
-std::array<float,2>{0.322376162f, 0.00271839532f},
-std::array<float,2>{0.581462383f, 0.969817638f},
-std::array<float,2>{0.866489768f, 0.390901893f},
-std::array<float,2>{0.117494367f, 0.542980254f},
-std::array<float,2>{0.395844728f, 0.368417144f},
-std::array<float,2>{0.736325324f, 0.71648711f},
-std::array<float,2>{0.878343165f, 0.210247442f},
-std::array<float,2>{0.215280756f, 0.811544597f},
-std::array<float,2>{0.109317183f, 0.0340945646f},
-std::array<float,2>{0.84991467f, 0.95525676f},
-std::array<float,2>{0.566587806f, 0.435814828f},
-std::array<float,2>{0.331958026f, 0.521871805f},
-std::array<float,2>{0.168010697f, 0.487889409f},
-std::array<float,2>{0.948187828f, 0.593260825f},
-std::array<float,2>{0.657417476f, 0.110458553f},
-std::array<float,2>{0.46731624f, 0.919525146f},
-std::array<float,2>{0.285155177f, 0.137837857f},
-std::array<float,2>{0.509832263f, 0.8313272f},
-std::array<float,2>{0.763088346f, 0.309175342f},
-std::array<float,2>{0.0352769867f, 0.625500321f},
-std::array<float,2>{0.364193976f, 0.376637697f},
-std::array<float,2>{0.610341728f, 0.549917996f},
-std::array<float,2>{0.839425087f, 0.0220049359f},
-std::array<float,2>{0.0828751996f, 0.997483253f},
-std::array<float,2>{0.245489463f, 0.232736796f},
-std::array<float,2>{0.908699811f, 0.768583536f},
-std::array<float,2>{0.715794683f, 0.313893378f},
-std::array<float,2>{0.407491922f, 0.735331178f},
-std::array<float,2>{0.00364969438f, 0.26460126f},
-std::array<float,2>{0.800309658f, 0.676151335f},
-std::array<float,2>{0.552132308f, 0.18225424f},
-std::array<float,2>{0.265353531f, 0.862292945f},
-std::array<float,2>{0.494264632f, 0.0853090957f},
-std::array<float,2>{0.638736486f, 0.891885817f},
-std::array<float,2>{0.994911611f, 0.446160078f},
-std::array<float,2>{0.135111511f, 0.618341923f},
-std::array<float,2>{0.295775324f, 0.353524595f},
-std::array<float,2>{0.501383364f, 0.695644617f},
-std::array<float,2>{0.751744688f, 0.19472076f},
-std::array<float,2>{0.0416001715f, 0.790871799f},
-std::array<float,2>{0.159585044f, 0.0572204366f},
-std::array<float,2>{0.93899864f, 0.937784672f},
-std::array<float,2>{0.671353996f, 0.419705898f},
-std::array<float,2>{0.457410038f, 0.512070477f},
-std::array<float,2>{0.097756505f, 0.48316741f},
-std::array<float,2>{0.856028914f, 0.574341655f},
-std::array<float,2>{0.574744642f, 0.101600587f},
-std::array<float,2>{0.338756889f, 0.928968012f},
-std::array<float,2>{0.402288288f, 0.143354818f},
-std::array<float,2>{0.748703539f, 0.818720579f},
-std::array<float,2>{0.890540659f, 0.290040284f},
-std::array<float,2>{0.205695778f, 0.646583259f},
-std::array<float,2>{0.485449016f, 0.397839576f},
-std::array<float,2>{0.626887143f, 0.540086269f},
-std::array<float,2>{0.984760106f, 0.00582187949f},
-std::array<float,2>{0.127088904f, 0.974191308f},
-std::array<float,2>{0.00905949995f, 0.241394013f},
-std::array<float,2>{0.80889082f, 0.759138167f},
-std::array<float,2>{0.555073261f, 0.334155798f},
-std::array<float,2>{0.255296677f, 0.734129846f},
-std::array<float,2>{0.240554616f, 0.278549939f},
-std::array<float,2>{0.914641619f, 0.659748733f},
-std::array<float,2>{0.710264862f, 0.15646711f},
-std::array<float,2>{0.41890198f, 0.846044362f},
-std::array<float,2>{0.369798005f, 0.0641460121f},
-std::array<float,2>{0.62136966f, 0.890390873f},
-std::array<float,2>{0.831989765f, 0.45513615f},
-std::array<float,2>{0.0877378806f, 0.606962323f},
-std::array<float,2>{0.424037546f, 0.305583f},
-std::array<float,2>{0.689502597f, 0.630305648f},
-std::array<float,2>{0.926671505f, 0.133149669f},
-std::array<float,2>{0.229270503f, 0.834135771f},
-std::array<float,2>{0.0715313405f, 0.11467614f},
-std::array<float,2>{0.817550123f, 0.915696919f},
-std::array<float,2>{0.599273562f, 0.491021454f},
-std::array<float,2>{0.356983066f, 0.58954376f},
-std::array<float,2>{0.153928295f, 0.432223052f},
-std::array<float,2>{0.974913597f, 0.518725634f},
-std::array<float,2>{0.646882415f, 0.0382070169f},
-std::array<float,2>{0.474250346f, 0.957377732f},
-std::array<float,2>{0.274020046f, 0.20320043f},
-std::array<float,2>{0.535727978f, 0.808380842f},
-std::array<float,2>{0.794395685f, 0.373907f},
-std::array<float,2>{0.0220124666f, 0.712222815f},
-std::array<float,2>{0.319628716f, 0.451095432f},
-std::array<float,2>{0.593367696f, 0.621783674f},
-std::array<float,2>{0.873930871f, 0.0799687281f},
-std::array<float,2>{0.113158777f, 0.897262454f},
-std::array<float,2>{0.190265656f, 0.185873494f},
-std::array<float,2>{0.900830388f, 0.86336112f},
-std::array<float,2>{0.732359648f, 0.257934928f},
-std::array<float,2>{0.384991825f, 0.673197925f},
-std::array<float,2>{0.0529657714f, 0.317708284f},
-std::array<float,2>{0.770602047f, 0.740743101f},
-std::array<float,2>{0.530128717f, 0.227902159f},
-std::array<float,2>{0.299940705f, 0.771974921f},
-std::array<float,2>{0.441161096f, 0.0162948258f},
-std::array<float,2>{0.682564974f, 0.993696094f},
-std::array<float,2>{0.963049233f, 0.382186681f},
-std::array<float,2>{0.185250863f, 0.551387072f},
-std::array<float,2>{0.351223797f, 0.257017672f},
-std::array<float,2>{0.602711678f, 0.68016088f},
-std::array<float,2>{0.824935913f, 0.179467544f},
-std::array<float,2>{0.0647041649f, 0.870193183f},
-std::array<float,2>{0.221599802f, 0.0930685773f},
-std::array<float,2>{0.932064116f, 0.905278325f},
-std::array<float,2>{0.701271117f, 0.439810961f},
-std::array<float,2>{0.435375363f, 0.61530906f},
-std::array<float,2>{0.0241989605f, 0.388811201f},
-std::array<float,2>{0.783930957f, 0.555947304f},
-std::array<float,2>{0.539576888f, 0.0273536239f},
-std::array<float,2>{0.266893804f, 0.985891283f},
-std::array<float,2>{0.47996515f, 0.223149151f},
-std::array<float,2>{0.649045169f, 0.781101286f},
-std::array<float,2>{0.984070718f, 0.322215885f},
-std::array<float,2>{0.141396761f, 0.74459964f},
-std::array<float,2>{0.377156079f, 0.493893266f},
-std::array<float,2>{0.723653495f, 0.579298973f},
-std::array<float,2>{0.896813989f, 0.121744938f},
-std::array<float,2>{0.203010172f, 0.913357377f},
-std::array<float,2>{0.122424245f, 0.130456015f},
-std::array<float,2>{0.861511588f, 0.841357589f},
-std::array<float,2>{0.582890749f, 0.30373162f},
-std::array<float,2>{0.324857205f, 0.638314784f},
-std::array<float,2>{0.172737166f, 0.361239195f},
-std::array<float,2>{0.959377408f, 0.703441024f},
-std::array<float,2>{0.674814105f, 0.216804251f},
-std::array<float,2>{0.451512754f, 0.799914241f},
-std::array<float,2>{0.307830334f, 0.0403635167f},
-std::array<float,2>{0.52115351f, 0.966237783f},
-std::array<float,2>{0.781181335f, 0.429322839f},
-std::array<float,2>{0.0578515306f, 0.529783726f},
-std::array<float,2>{0.464809597f, 0.336376578f},
-std::array<float,2>{0.662728667f, 0.719745398f},
-std::array<float,2>{0.949452221f, 0.247077867f},
-std::array<float,2>{0.16522339f, 0.752647281f},
-std::array<float,2>{0.0322083943f, 0.0151256798f},
-std::array<float,2>{0.760412157f, 0.98278445f},
-std::array<float,2>{0.51260066f, 0.403177083f},
-std::array<float,2>{0.285714149f, 0.533568561f},
-std::array<float,2>{0.212381676f, 0.466264904f},
-std::array<float,2>{0.880159795f, 0.595540106f},
-std::array<float,2>{0.741255939f, 0.0763001665f},
-std::array<float,2>{0.392625242f, 0.879903197f},
-std::array<float,2>{0.333015949f, 0.167695701f},
-std::array<float,2>{0.564417183f, 0.85530442f},
-std::array<float,2>{0.844829738f, 0.268714666f},
-std::array<float,2>{0.104685403f, 0.667562783f},
-std::array<float,2>{0.257909685f, 0.406784773f},
-std::array<float,2>{0.550653934f, 0.505938411f},
-std::array<float,2>{0.801274061f, 0.0494135916f},
-std::array<float,2>{0.00725835329f, 0.950652957f},
-std::array<float,2>{0.139066383f, 0.196224153f},
-std::array<float,2>{0.999994159f, 0.784362793f},
-std::array<float,2>{0.636458218f, 0.345502168f},
-std::array<float,2>{0.499179065f, 0.694874406f},
-std::array<float,2>{0.078877911f, 0.285276711f},
-std::array<float,2>{0.841013908f, 0.656190753f},
-std::array<float,2>{0.617014885f, 0.151705012f},
-std::array<float,2>{0.36209321f, 0.827080846f},
-std::array<float,2>{0.411669463f, 0.0947706923f},
-std::array<float,2>{0.712556601f, 0.933458447f},
-std::array<float,2>{0.910193443f, 0.473586798f},
-std::array<float,2>{0.246930063f, 0.564906776f},
-std::array<float,2>{0.371940881f, 0.364907026f},
-std::array<float,2>{0.617935956f, 0.707939804f},
-std::array<float,2>{0.833750725f, 0.214488477f},
-std::array<float,2>{0.0911217034f, 0.802063406f},
-std::array<float,2>{0.236034364f, 0.0465816781f},
-std::array<float,2>{0.91885215f, 0.962469816f},
-std::array<float,2>{0.704736531f, 0.42239821f},
-std::array<float,2>{0.416443557f, 0.527066469f},
-std::array<float,2>{0.0145725124f, 0.497376204f},
-std::array<float,2>{0.804787338f, 0.583443165f},
-std::array<float,2>{0.561806679f, 0.118288487f},
-std::array<float,2>{0.252667338f, 0.907949269f},
-std::array<float,2>{0.489809483f, 0.127299219f},
-std::array<float,2>{0.629381537f, 0.839694798f},
-std::array<float,2>{0.98895067f, 0.298752069f},
-std::array<float,2>{0.131548241f, 0.634116888f},
-std::array<float,2>{0.404706329f, 0.383610487f},
-std::array<float,2>{0.742474616f, 0.559434056f},
-std::array<float,2>{0.88668704f, 0.0248144791f},
-std::array<float,2>{0.208150893f, 0.991577804f},
-std::array<float,2>{0.0958291367f, 0.21910736f},
-std::array<float,2>{0.852139831f, 0.77727896f},
-std::array<float,2>{0.571953952f, 0.326089889f},
-std::array<float,2>{0.341046602f, 0.746322751f},
-std::array<float,2>{0.162417069f, 0.253005803f},
-std::array<float,2>{0.942503035f, 0.684202909f},
-std::array<float,2>{0.664106727f, 0.172732413f},
-std::array<float,2>{0.45347327f, 0.873905599f},
-std::array<float,2>{0.290626287f, 0.0894683152f},
-std::array<float,2>{0.505971551f, 0.901924551f},
-std::array<float,2>{0.757004976f, 0.444370091f},
-std::array<float,2>{0.0446670391f, 0.609702945f},
-std::array<float,2>{0.444444388f, 0.281737179f},
-std::array<float,2>{0.685291409f, 0.650056601f},
-std::array<float,2>{0.968440354f, 0.152713344f},
-std::array<float,2>{0.180489942f, 0.821115673f},
-std::array<float,2>{0.0490491837f, 0.0979170054f},
-std::array<float,2>{0.766415358f, 0.936751068f},
-std::array<float,2>{0.525568902f, 0.471796155f},
-std::array<float,2>{0.303852081f, 0.568851352f},
-std::array<float,2>{0.191409975f, 0.410239518f},
-std::array<float,2>{0.903016567f, 0.501359224f},
-std::array<float,2>{0.727710128f, 0.0531694666f},
-std::array<float,2>{0.3870731f, 0.947698653f},
-std::array<float,2>{0.313428998f, 0.201587051f},
-std::array<float,2>{0.586828887f, 0.788709998f},
-std::array<float,2>{0.867324412f, 0.348766357f},
-std::array<float,2>{0.114631772f, 0.689258277f},
-std::array<float,2>{0.279712081f, 0.463848293f},
-std::array<float,2>{0.533971786f, 0.601185799f},
-std::array<float,2>{0.790851116f, 0.0739978179f},
-std::array<float,2>{0.0165605247f, 0.877634227f},
-std::array<float,2>{0.148695663f, 0.168822631f},
-std::array<float,2>{0.970528126f, 0.859061658f},
-std::array<float,2>{0.643305182f, 0.273211509f},
-std::array<float,2>{0.470320612f, 0.670411408f},
-std::array<float,2>{0.0744898841f, 0.343028218f},
-std::array<float,2>{0.816320419f, 0.726400256f},
-std::array<float,2>{0.595216453f, 0.243471995f},
-std::array<float,2>{0.353875607f, 0.755086422f},
-std::array<float,2>{0.426482767f, 0.00966611411f},
-std::array<float,2>{0.69284749f, 0.977947235f},
-std::array<float,2>{0.922825038f, 0.401476711f},
-std::array<float,2>{0.231553972f, 0.537357807f},
-std::array<float,2>{0.311933845f, 0.275462121f},
-std::array<float,2>{0.515809059f, 0.660305858f},
-std::array<float,2>{0.776705384f, 0.16244714f},
-std::array<float,2>{0.0590825528f, 0.85080272f},
-std::array<float,2>{0.177590966f, 0.0686217323f},
-std::array<float,2>{0.953745961f, 0.884212077f},
-std::array<float,2>{0.676679194f, 0.457749546f},
-std::array<float,2>{0.448581696f, 0.602645695f},
-std::array<float,2>{0.120452888f, 0.392625213f},
-std::array<float,2>{0.864858449f, 0.545999765f},
-std::array<float,2>{0.579622567f, 0.00142522121f},
-std::array<float,2>{0.321937561f, 0.972462595f},
-std::array<float,2>{0.379862875f, 0.237212509f},
-std::array<float,2>{0.721927404f, 0.763190567f},
-std::array<float,2>{0.891473293f, 0.331020534f},
-std::array<float,2>{0.197059825f, 0.72984153f},
-std::array<float,2>{0.483523577f, 0.476920962f},
-std::array<float,2>{0.65423727f, 0.573902965f},
-std::array<float,2>{0.980242908f, 0.105617769f},
-std::array<float,2>{0.147140935f, 0.923534095f},
-std::array<float,2>{0.0274572745f, 0.144837782f},
-std::array<float,2>{0.788015664f, 0.813711882f},
-std::array<float,2>{0.543106139f, 0.295806348f},
-std::array<float,2>{0.271560013f, 0.642236471f},
-std::array<float,2>{0.224794731f, 0.357345968f},
-std::array<float,2>{0.935400546f, 0.701305211f},
-std::array<float,2>{0.697886884f, 0.188994959f},
-std::array<float,2>{0.431533158f, 0.794366598f},
-std::array<float,2>{0.344960719f, 0.0608175397f},
-std::array<float,2>{0.607865751f, 0.944291353f},
-std::array<float,2>{0.822201192f, 0.417071879f},
-std::array<float,2>{0.0675619245f, 0.509890079f},
-std::array<float,2>{0.40902102f, 0.314505816f},
-std::array<float,2>{0.717025638f, 0.738055527f},
-std::array<float,2>{0.907679677f, 0.231144726f},
-std::array<float,2>{0.24248822f, 0.765800893f},
-std::array<float,2>{0.0857747942f, 0.0198521055f},
-std::array<float,2>{0.836926937f, 0.998535573f},
-std::array<float,2>{0.612168014f, 0.378341973f},
-std::array<float,2>{0.365341604f, 0.547458887f},
-std::array<float,2>{0.13283734f, 0.447936386f},
-std::array<float,2>{0.992833436f, 0.619397461f},
-std::array<float,2>{0.637704194f, 0.0838413611f},
-std::array<float,2>{0.492622107f, 0.894233942f},
-std::array<float,2>{0.263087571f, 0.181069806f},
-std::array<float,2>{0.552811444f, 0.860067666f},
-std::array<float,2>{0.797185302f, 0.262694538f},
-std::array<float,2>{4.26838487e-05f, 0.678579271f},
-std::array<float,2>{0.329357475f, 0.434967339f},
-std::array<float,2>{0.568392217f, 0.520683467f},
-std::array<float,2>{0.847762406f, 0.0320316777f},
-std::array<float,2>{0.106162861f, 0.954346895f},
-std::array<float,2>{0.218453795f, 0.208214f},
-std::array<float,2>{0.875802934f, 0.80919522f},
-std::array<float,2>{0.738005161f, 0.369242191f},
-std::array<float,2>{0.398264945f, 0.717208445f},
-std::array<float,2>{0.037827149f, 0.311658889f},
-std::array<float,2>{0.765389442f, 0.628608346f},
-std::array<float,2>{0.508737147f, 0.139317513f},
-std::array<float,2>{0.281427294f, 0.828444481f},
-std::array<float,2>{0.46593675f, 0.111738935f},
-std::array<float,2>{0.659424484f, 0.920158207f},
-std::array<float,2>{0.945975184f, 0.484765977f},
-std::array<float,2>{0.170226365f, 0.590135515f},
-std::array<float,2>{0.256812692f, 0.332161039f},
-std::array<float,2>{0.557676315f, 0.732185543f},
-std::array<float,2>{0.811485589f, 0.239919364f},
-std::array<float,2>{0.0110250181f, 0.760859489f},
-std::array<float,2>{0.126387745f, 0.00588780083f},
-std::array<float,2>{0.988036811f, 0.976403773f},
-std::array<float,2>{0.627561927f, 0.394874394f},
-std::array<float,2>{0.486593753f, 0.542068541f},
-std::array<float,2>{0.0888621882f, 0.454110742f},
-std::array<float,2>{0.828174531f, 0.608577132f},
-std::array<float,2>{0.623944938f, 0.0650674477f},
-std::array<float,2>{0.368622839f, 0.887959123f},
-std::array<float,2>{0.421336889f, 0.159192145f},
-std::array<float,2>{0.707746029f, 0.844570637f},
-std::array<float,2>{0.917311966f, 0.280806154f},
-std::array<float,2>{0.238975301f, 0.657513857f},
-std::array<float,2>{0.460233927f, 0.420194f},
-std::array<float,2>{0.669030368f, 0.513908982f},
-std::array<float,2>{0.941150725f, 0.0564327724f},
-std::array<float,2>{0.156615898f, 0.940615475f},
-std::array<float,2>{0.039965231f, 0.191873372f},
-std::array<float,2>{0.753699183f, 0.791475892f},
-std::array<float,2>{0.503573477f, 0.353238344f},
-std::array<float,2>{0.293798506f, 0.697647452f},
-std::array<float,2>{0.204577476f, 0.292456269f},
-std::array<float,2>{0.886838317f, 0.645193994f},
-std::array<float,2>{0.747889638f, 0.141585067f},
-std::array<float,2>{0.400378942f, 0.817792714f},
-std::array<float,2>{0.337414175f, 0.104752235f},
-std::array<float,2>{0.577234566f, 0.927699804f},
-std::array<float,2>{0.858577192f, 0.481923312f},
-std::array<float,2>{0.0996713787f, 0.577854097f},
-std::array<float,2>{0.384567529f, 0.259943873f},
-std::array<float,2>{0.732830405f, 0.675235152f},
-std::array<float,2>{0.899067342f, 0.184547603f},
-std::array<float,2>{0.188430786f, 0.86664325f},
-std::array<float,2>{0.109431319f, 0.0804430321f},
-std::array<float,2>{0.871293664f, 0.895610571f},
-std::array<float,2>{0.590310633f, 0.452217251f},
-std::array<float,2>{0.317713916f, 0.623090506f},
-std::array<float,2>{0.186256617f, 0.37920627f},
-std::array<float,2>{0.962400556f, 0.55345732f},
-std::array<float,2>{0.681001425f, 0.0193577874f},
-std::array<float,2>{0.438705713f, 0.995949686f},
-std::array<float,2>{0.298639148f, 0.230004936f},
-std::array<float,2>{0.528789461f, 0.769871056f},
-std::array<float,2>{0.771864116f, 0.318795711f},
-std::array<float,2>{0.0527016185f, 0.739552081f},
-std::array<float,2>{0.35756278f, 0.488440901f},
-std::array<float,2>{0.600099087f, 0.587798595f},
-std::array<float,2>{0.820147872f, 0.116550371f},
-std::array<float,2>{0.0738964006f, 0.916319191f},
-std::array<float,2>{0.228085652f, 0.136336386f},
-std::array<float,2>{0.928500414f, 0.833415866f},
-std::array<float,2>{0.687907159f, 0.306765169f},
-std::array<float,2>{0.422926575f, 0.632764578f},
-std::array<float,2>{0.0200286172f, 0.371480614f},
-std::array<float,2>{0.795195758f, 0.713161826f},
-std::array<float,2>{0.538639247f, 0.206070691f},
-std::array<float,2>{0.275725633f, 0.805861115f},
-std::array<float,2>{0.476247728f, 0.0368803442f},
-std::array<float,2>{0.645582139f, 0.959477663f},
-std::array<float,2>{0.973338842f, 0.431208372f},
-std::array<float,2>{0.156101644f, 0.516794443f},
-std::array<float,2>{0.326598197f, 0.300920874f},
-std::array<float,2>{0.584658265f, 0.640617967f},
-std::array<float,2>{0.860544086f, 0.131067976f},
-std::array<float,2>{0.123214811f, 0.84205687f},
-std::array<float,2>{0.199963257f, 0.123159446f},
-std::array<float,2>{0.894682884f, 0.911222875f},
-std::array<float,2>{0.726507723f, 0.494918853f},
-std::array<float,2>{0.375246435f, 0.580344558f},
-std::array<float,2>{0.0563192405f, 0.42653653f},
-std::array<float,2>{0.777925193f, 0.528951108f},
-std::array<float,2>{0.521771073f, 0.0419302173f},
-std::array<float,2>{0.305912226f, 0.966937184f},
-std::array<float,2>{0.450054169f, 0.215302914f},
-std::array<float,2>{0.673121989f, 0.798497498f},
-std::array<float,2>{0.957141936f, 0.362823904f},
-std::array<float,2>{0.174509063f, 0.705600381f},
-std::array<float,2>{0.436024904f, 0.437644511f},
-std::array<float,2>{0.700996459f, 0.613289654f},
-std::array<float,2>{0.929989159f, 0.0904210508f},
-std::array<float,2>{0.219788f, 0.903580546f},
-std::array<float,2>{0.063117899f, 0.177271515f},
-std::array<float,2>{0.826700449f, 0.867773116f},
-std::array<float,2>{0.604622781f, 0.255170017f},
-std::array<float,2>{0.349153936f, 0.68359226f},
-std::array<float,2>{0.143438548f, 0.324118048f},
-std::array<float,2>{0.981409431f, 0.743996322f},
-std::array<float,2>{0.652097106f, 0.225044534f},
-std::array<float,2>{0.477869749f, 0.777831674f},
-std::array<float,2>{0.269319624f, 0.029451739f},
-std::array<float,2>{0.541691065f, 0.986975729f},
-std::array<float,2>{0.782790005f, 0.387740701f},
-std::array<float,2>{0.0261734668f, 0.558324993f},
-std::array<float,2>{0.497089148f, 0.347097754f},
-std::array<float,2>{0.632976472f, 0.692295969f},
-std::array<float,2>{0.997216523f, 0.198272899f},
-std::array<float,2>{0.13684988f, 0.782721937f},
-std::array<float,2>{0.00430896413f, 0.0479447991f},
-std::array<float,2>{0.803795576f, 0.951880455f},
-std::array<float,2>{0.547226846f, 0.409861863f},
-std::array<float,2>{0.260464221f, 0.504253328f},
-std::array<float,2>{0.249053881f, 0.475260824f},
-std::array<float,2>{0.913965642f, 0.563818514f},
-std::array<float,2>{0.7146703f, 0.0960200354f},
-std::array<float,2>{0.41297242f, 0.930288315f},
-std::array<float,2>{0.360962003f, 0.150341436f},
-std::array<float,2>{0.614413202f, 0.825622976f},
-std::array<float,2>{0.843743145f, 0.288961947f},
-std::array<float,2>{0.0813147724f, 0.653748393f},
-std::array<float,2>{0.28888157f, 0.404491931f},
-std::array<float,2>{0.514872551f, 0.532478929f},
-std::array<float,2>{0.759220421f, 0.0134392073f},
-std::array<float,2>{0.0340432972f, 0.980847895f},
-std::array<float,2>{0.166740417f, 0.24808529f},
-std::array<float,2>{0.953088403f, 0.751856446f},
-std::array<float,2>{0.661873043f, 0.338475853f},
-std::array<float,2>{0.461400956f, 0.721248448f},
-std::array<float,2>{0.102321073f, 0.265671492f},
-std::array<float,2>{0.847412705f, 0.664178908f},
-std::array<float,2>{0.564558566f, 0.165982559f},
-std::array<float,2>{0.334519118f, 0.853131592f},
-std::array<float,2>{0.392527312f, 0.0758231059f},
-std::array<float,2>{0.739592612f, 0.88235873f},
-std::array<float,2>{0.881149769f, 0.46813345f},
-std::array<float,2>{0.214520201f, 0.595867276f}}
\ No newline at end of file
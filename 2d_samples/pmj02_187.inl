@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.0114608975f, 0.880180538f},
-std::array<float,2>{0.600116849f, 0.254693806f},
-std::array<float,2>{0.473947972f, 0.207845598f},
-std::array<float,2>{0.791402042f, 0.701540172f},
-std::array<float,2>{0.312192589f, 0.544100761f},
-std::array<float,2>{0.968820274f, 0.110397384f},
-std::array<float,2>{0.244647518f, 0.40554744f},
-std::array<float,2>{0.70158118f, 0.811607718f},
-std::array<float,2>{0.387259632f, 0.868447661f},
-std::array<float,2>{0.832107246f, 0.480024427f},
-std::array<float,2>{0.0913029462f, 0.039293766f},
-std::array<float,2>{0.554784f, 0.569993913f},
-std::array<float,2>{0.152738854f, 0.657168746f},
-std::array<float,2>{0.681696236f, 0.177119464f},
-std::array<float,2>{0.337051779f, 0.330871582f},
-std::array<float,2>{0.909638464f, 0.955985665f},
-std::array<float,2>{0.208251774f, 0.762064815f},
-std::array<float,2>{0.739163697f, 0.436800122f},
-std::array<float,2>{0.252204418f, 0.0643035546f},
-std::array<float,2>{0.950967312f, 0.515866458f},
-std::array<float,2>{0.440085769f, 0.740730703f},
-std::array<float,2>{0.770372868f, 0.220759988f},
-std::array<float,2>{0.0591425225f, 0.298607022f},
-std::array<float,2>{0.563230395f, 0.92441684f},
-std::array<float,2>{0.349065512f, 0.970447838f},
-std::array<float,2>{0.880276263f, 0.347260535f},
-std::array<float,2>{0.182849154f, 0.137999386f},
-std::array<float,2>{0.634612262f, 0.638260663f},
-std::array<float,2>{0.106833607f, 0.604995072f},
-std::array<float,2>{0.529145718f, 0.0266977791f},
-std::array<float,2>{0.41222474f, 0.456343561f},
-std::array<float,2>{0.867471218f, 0.829229891f},
-std::array<float,2>{0.0754692852f, 0.817314088f},
-std::array<float,2>{0.538790286f, 0.444211036f},
-std::array<float,2>{0.395161659f, 0.00572035415f},
-std::array<float,2>{0.82110852f, 0.620010853f},
-std::array<float,2>{0.316731721f, 0.647937238f},
-std::array<float,2>{0.926850021f, 0.155227527f},
-std::array<float,2>{0.138153598f, 0.373196006f},
-std::array<float,2>{0.670158565f, 0.986308038f},
-std::array<float,2>{0.493995249f, 0.910559058f},
-std::array<float,2>{0.79727608f, 0.284921765f},
-std::array<float,2>{0.0280638915f, 0.240009636f},
-std::array<float,2>{0.615692317f, 0.729620695f},
-std::array<float,2>{0.226964071f, 0.505311728f},
-std::array<float,2>{0.717066824f, 0.0924038887f},
-std::array<float,2>{0.29675743f, 0.421056032f},
-std::array<float,2>{0.98983109f, 0.774229884f},
-std::array<float,2>{0.157866105f, 0.94207263f},
-std::array<float,2>{0.643133938f, 0.315756917f},
-std::array<float,2>{0.370221913f, 0.170004711f},
-std::array<float,2>{0.897453368f, 0.672718048f},
-std::array<float,2>{0.428840935f, 0.581876159f},
-std::array<float,2>{0.844485998f, 0.0553014874f},
-std::array<float,2>{0.119325511f, 0.490948379f},
-std::array<float,2>{0.513437152f, 0.845727026f},
-std::array<float,2>{0.280757517f, 0.790950596f},
-std::array<float,2>{0.958240867f, 0.379758149f},
-std::array<float,2>{0.201544121f, 0.10844174f},
-std::array<float,2>{0.726473451f, 0.558511376f},
-std::array<float,2>{0.0416633077f, 0.711453378f},
-std::array<float,2>{0.583413482f, 0.187755346f},
-std::array<float,2>{0.465892136f, 0.272856206f},
-std::array<float,2>{0.761911154f, 0.905410886f},
-std::array<float,2>{0.109584071f, 0.995078802f},
-std::array<float,2>{0.504701078f, 0.3669191f},
-std::array<float,2>{0.433338255f, 0.147676155f},
-std::array<float,2>{0.856851041f, 0.654897332f},
-std::array<float,2>{0.363126576f, 0.613837361f},
-std::array<float,2>{0.905492604f, 0.0145413429f},
-std::array<float,2>{0.171787947f, 0.451014787f},
-std::array<float,2>{0.654748857f, 0.827659249f},
-std::array<float,2>{0.458694458f, 0.771748662f},
-std::array<float,2>{0.757689655f, 0.411589414f},
-std::array<float,2>{0.0356632099f, 0.0846558586f},
-std::array<float,2>{0.593566477f, 0.512567699f},
-std::array<float,2>{0.187660873f, 0.721014559f},
-std::array<float,2>{0.733859062f, 0.244797006f},
-std::array<float,2>{0.267836332f, 0.293159276f},
-std::array<float,2>{0.961633444f, 0.916808963f},
-std::array<float,2>{0.125185028f, 0.852112293f},
-std::array<float,2>{0.657780588f, 0.496372283f},
-std::array<float,2>{0.32784155f, 0.0502535924f},
-std::array<float,2>{0.931155562f, 0.5895257f},
-std::array<float,2>{0.405314505f, 0.680796683f},
-std::array<float,2>{0.813580811f, 0.161464483f},
-std::array<float,2>{0.0662944242f, 0.32297954f},
-std::array<float,2>{0.542437196f, 0.948791206f},
-std::array<float,2>{0.282799661f, 0.893736839f},
-std::array<float,2>{0.993716598f, 0.278945506f},
-std::array<float,2>{0.219356045f, 0.198310748f},
-std::array<float,2>{0.70778656f, 0.70685041f},
-std::array<float,2>{0.0208451301f, 0.551899433f},
-std::array<float,2>{0.619560003f, 0.0968133509f},
-std::array<float,2>{0.485668987f, 0.384481132f},
-std::array<float,2>{0.809856057f, 0.781705618f},
-std::array<float,2>{0.0495546088f, 0.800142169f},
-std::array<float,2>{0.571869671f, 0.39429f},
-std::array<float,2>{0.446676642f, 0.118662111f},
-std::array<float,2>{0.777738094f, 0.535686553f},
-std::array<float,2>{0.261619151f, 0.688627243f},
-std::array<float,2>{0.941058099f, 0.214634895f},
-std::array<float,2>{0.21425499f, 0.259276599f},
-std::array<float,2>{0.74409759f, 0.888994217f},
-std::array<float,2>{0.420509279f, 0.96129775f},
-std::array<float,2>{0.862427235f, 0.337652236f},
-std::array<float,2>{0.101368323f, 0.180224329f},
-std::array<float,2>{0.520885229f, 0.670194089f},
-std::array<float,2>{0.174597576f, 0.575713217f},
-std::array<float,2>{0.625973761f, 0.0345102958f},
-std::array<float,2>{0.355366766f, 0.471320689f},
-std::array<float,2>{0.888515413f, 0.861428142f},
-std::array<float,2>{0.237015992f, 0.930226445f},
-std::array<float,2>{0.69345206f, 0.31221801f},
-std::array<float,2>{0.304609567f, 0.227976173f},
-std::array<float,2>{0.979915977f, 0.743614316f},
-std::array<float,2>{0.480390161f, 0.527998209f},
-std::array<float,2>{0.787698209f, 0.0767942369f},
-std::array<float,2>{0.00588768255f, 0.426241457f},
-std::array<float,2>{0.603160679f, 0.750582814f},
-std::array<float,2>{0.328757942f, 0.836379468f},
-std::array<float,2>{0.921851814f, 0.462358236f},
-std::array<float,2>{0.147659421f, 0.0215042233f},
-std::array<float,2>{0.674941123f, 0.600041211f},
-std::array<float,2>{0.0813250244f, 0.629713953f},
-std::array<float,2>{0.547114968f, 0.127752125f},
-std::array<float,2>{0.377195954f, 0.354059756f},
-std::array<float,2>{0.841387987f, 0.978940845f},
-std::array<float,2>{0.0328392275f, 0.959657252f},
-std::array<float,2>{0.587638319f, 0.334485203f},
-std::array<float,2>{0.455569953f, 0.173008487f},
-std::array<float,2>{0.751458347f, 0.661084473f},
-std::array<float,2>{0.271749884f, 0.566265583f},
-std::array<float,2>{0.967518985f, 0.0437123664f},
-std::array<float,2>{0.192168415f, 0.48095265f},
-std::array<float,2>{0.727171481f, 0.873447359f},
-std::array<float,2>{0.435745895f, 0.806768835f},
-std::array<float,2>{0.855194807f, 0.398556381f},
-std::array<float,2>{0.115913071f, 0.114872612f},
-std::array<float,2>{0.500173151f, 0.542433023f},
-std::array<float,2>{0.165291891f, 0.69861567f},
-std::array<float,2>{0.650251567f, 0.20412074f},
-std::array<float,2>{0.364042372f, 0.251267701f},
-std::array<float,2>{0.899235129f, 0.87557584f},
-std::array<float,2>{0.223468408f, 0.833376765f},
-std::array<float,2>{0.706183434f, 0.458258182f},
-std::array<float,2>{0.286773354f, 0.0289848931f},
-std::array<float,2>{0.999261975f, 0.608712673f},
-std::array<float,2>{0.48887372f, 0.635351241f},
-std::array<float,2>{0.808122158f, 0.133601695f},
-std::array<float,2>{0.0166193042f, 0.348912507f},
-std::array<float,2>{0.621425569f, 0.974211395f},
-std::array<float,2>{0.322012872f, 0.925781488f},
-std::array<float,2>{0.93466711f, 0.303815275f},
-std::array<float,2>{0.132268116f, 0.224145904f},
-std::array<float,2>{0.660607934f, 0.737889528f},
-std::array<float,2>{0.0691121295f, 0.522129655f},
-std::array<float,2>{0.543741345f, 0.0694515631f},
-std::array<float,2>{0.400623411f, 0.43232739f},
-std::array<float,2>{0.81885618f, 0.758972526f},
-std::array<float,2>{0.0963924602f, 0.780483365f},
-std::array<float,2>{0.516828537f, 0.417523474f},
-std::array<float,2>{0.416772634f, 0.0896847248f},
-std::array<float,2>{0.863780499f, 0.503877938f},
-std::array<float,2>{0.356866181f, 0.732968271f},
-std::array<float,2>{0.885958731f, 0.237405166f},
-std::array<float,2>{0.177989885f, 0.287439823f},
-std::array<float,2>{0.630480349f, 0.907517672f},
-std::array<float,2>{0.452804267f, 0.991875291f},
-std::array<float,2>{0.776452839f, 0.368606985f},
-std::array<float,2>{0.0513855219f, 0.149980798f},
-std::array<float,2>{0.575787902f, 0.643446743f},
-std::array<float,2>{0.218342453f, 0.621365488f},
-std::array<float,2>{0.746675849f, 0.000850144366f},
-std::array<float,2>{0.264589459f, 0.438655138f},
-std::array<float,2>{0.943967581f, 0.81339401f},
-std::array<float,2>{0.142703936f, 0.899730444f},
-std::array<float,2>{0.676755309f, 0.268191844f},
-std::array<float,2>{0.332647681f, 0.191786021f},
-std::array<float,2>{0.915417254f, 0.71861577f},
-std::array<float,2>{0.382479578f, 0.560311019f},
-std::array<float,2>{0.83864361f, 0.10307847f},
-std::array<float,2>{0.0835663155f, 0.376494825f},
-std::array<float,2>{0.554576159f, 0.793887675f},
-std::array<float,2>{0.299324334f, 0.848726273f},
-std::array<float,2>{0.983595073f, 0.485922545f},
-std::array<float,2>{0.239674211f, 0.0618010536f},
-std::array<float,2>{0.688517153f, 0.585392654f},
-std::array<float,2>{0.00337933865f, 0.676761985f},
-std::array<float,2>{0.607141078f, 0.167261824f},
-std::array<float,2>{0.481098622f, 0.3203004f},
-std::array<float,2>{0.783746004f, 0.939351439f},
-std::array<float,2>{0.0864910558f, 0.919415772f},
-std::array<float,2>{0.560746014f, 0.290163845f},
-std::array<float,2>{0.383358002f, 0.249330997f},
-std::array<float,2>{0.829631925f, 0.724280417f},
-std::array<float,2>{0.339931101f, 0.511160016f},
-std::array<float,2>{0.91360724f, 0.0813736841f},
-std::array<float,2>{0.151447892f, 0.410035998f},
-std::array<float,2>{0.686026812f, 0.767299771f},
-std::array<float,2>{0.472225249f, 0.82348305f},
-std::array<float,2>{0.796376228f, 0.448541403f},
-std::array<float,2>{0.0142148165f, 0.00820785481f},
-std::array<float,2>{0.597289264f, 0.61272645f},
-std::array<float,2>{0.249407187f, 0.652000308f},
-std::array<float,2>{0.698136151f, 0.141542733f},
-std::array<float,2>{0.305156887f, 0.360618263f},
-std::array<float,2>{0.973633051f, 0.999716341f},
-std::array<float,2>{0.184554011f, 0.786590457f},
-std::array<float,2>{0.638389051f, 0.38800326f},
-std::array<float,2>{0.346097976f, 0.0986083224f},
-std::array<float,2>{0.875836372f, 0.547384262f},
-std::array<float,2>{0.40893057f, 0.709192455f},
-std::array<float,2>{0.872967899f, 0.200952798f},
-std::array<float,2>{0.102040276f, 0.277032763f},
-std::array<float,2>{0.525799811f, 0.897679448f},
-std::array<float,2>{0.254136175f, 0.952023208f},
-std::array<float,2>{0.945612252f, 0.326940119f},
-std::array<float,2>{0.20404765f, 0.159838974f},
-std::array<float,2>{0.734458506f, 0.684741199f},
-std::array<float,2>{0.0580272488f, 0.592033565f},
-std::array<float,2>{0.568518519f, 0.054495357f},
-std::array<float,2>{0.442000061f, 0.4951922f},
-std::array<float,2>{0.767457008f, 0.855636537f},
-std::array<float,2>{0.0267028417f, 0.865212381f},
-std::array<float,2>{0.611844003f, 0.474515378f},
-std::array<float,2>{0.498739392f, 0.0370080508f},
-std::array<float,2>{0.802106023f, 0.570416272f},
-std::array<float,2>{0.292117655f, 0.665961266f},
-std::array<float,2>{0.986902773f, 0.183976173f},
-std::array<float,2>{0.233713135f, 0.341275156f},
-std::array<float,2>{0.711513281f, 0.966072261f},
-std::array<float,2>{0.393755645f, 0.883113205f},
-std::array<float,2>{0.826419473f, 0.2640692f},
-std::array<float,2>{0.0731724575f, 0.217131704f},
-std::array<float,2>{0.533335626f, 0.693258822f},
-std::array<float,2>{0.133090779f, 0.533522069f},
-std::array<float,2>{0.665243924f, 0.124358319f},
-std::array<float,2>{0.313155979f, 0.397575915f},
-std::array<float,2>{0.923110425f, 0.801197588f},
-std::array<float,2>{0.19875963f, 0.98088783f},
-std::array<float,2>{0.719849229f, 0.357657284f},
-std::array<float,2>{0.274095625f, 0.130661488f},
-std::array<float,2>{0.953359485f, 0.62622714f},
-std::array<float,2>{0.462149501f, 0.595891416f},
-std::array<float,2>{0.758224308f, 0.019393038f},
-std::array<float,2>{0.0452816002f, 0.465537578f},
-std::array<float,2>{0.579326332f, 0.839879811f},
-std::array<float,2>{0.373511851f, 0.755309105f},
-std::array<float,2>{0.891096294f, 0.425290257f},
-std::array<float,2>{0.163284302f, 0.0737509504f},
-std::array<float,2>{0.646390855f, 0.526254654f},
-std::array<float,2>{0.121412002f, 0.746407866f},
-std::array<float,2>{0.509318352f, 0.233311936f},
-std::array<float,2>{0.423327744f, 0.305945516f},
-std::array<float,2>{0.850256085f, 0.934454083f},
-std::array<float,2>{0.0613448061f, 0.922681391f},
-std::array<float,2>{0.565407872f, 0.300399572f},
-std::array<float,2>{0.439342916f, 0.220441774f},
-std::array<float,2>{0.771994412f, 0.740211129f},
-std::array<float,2>{0.251065493f, 0.518162072f},
-std::array<float,2>{0.952708185f, 0.0649317056f},
-std::array<float,2>{0.209780648f, 0.435045838f},
-std::array<float,2>{0.740656376f, 0.764672756f},
-std::array<float,2>{0.4115749f, 0.830211282f},
-std::array<float,2>{0.870970368f, 0.453141749f},
-std::array<float,2>{0.10897164f, 0.0251884274f},
-std::array<float,2>{0.530998588f, 0.601670921f},
-std::array<float,2>{0.180679172f, 0.640179574f},
-std::array<float,2>{0.635256648f, 0.13903977f},
-std::array<float,2>{0.349958628f, 0.344868749f},
-std::array<float,2>{0.881200135f, 0.970968962f},
-std::array<float,2>{0.243763775f, 0.809757471f},
-std::array<float,2>{0.699679434f, 0.403428495f},
-std::array<float,2>{0.3102777f, 0.111774713f},
-std::array<float,2>{0.971364677f, 0.545275927f},
-std::array<float,2>{0.476251364f, 0.70082438f},
-std::array<float,2>{0.789425135f, 0.210604399f},
-std::array<float,2>{0.00873039942f, 0.25762102f},
-std::array<float,2>{0.598903954f, 0.882735133f},
-std::array<float,2>{0.339777887f, 0.953950107f},
-std::array<float,2>{0.906330824f, 0.328144908f},
-std::array<float,2>{0.155063957f, 0.178793162f},
-std::array<float,2>{0.681164861f, 0.658229828f},
-std::array<float,2>{0.0924765542f, 0.567048788f},
-std::array<float,2>{0.558440983f, 0.0425229818f},
-std::array<float,2>{0.390142083f, 0.47774896f},
-std::array<float,2>{0.835601687f, 0.870073199f},
-std::array<float,2>{0.118705459f, 0.844068587f},
-std::array<float,2>{0.514445603f, 0.489250302f},
-std::array<float,2>{0.426357567f, 0.057370659f},
-std::array<float,2>{0.846863806f, 0.578244984f},
-std::array<float,2>{0.368149638f, 0.675708413f},
-std::array<float,2>{0.895558059f, 0.168023184f},
-std::array<float,2>{0.15993309f, 0.312683195f},
-std::array<float,2>{0.641644001f, 0.944461644f},
-std::array<float,2>{0.467505991f, 0.902426183f},
-std::array<float,2>{0.763991177f, 0.270155311f},
-std::array<float,2>{0.0398841277f, 0.190048218f},
-std::array<float,2>{0.584979832f, 0.714800954f},
-std::array<float,2>{0.19997716f, 0.554706752f},
-std::array<float,2>{0.723727226f, 0.106191657f},
-std::array<float,2>{0.278133839f, 0.382381529f},
-std::array<float,2>{0.960802019f, 0.792111754f},
-std::array<float,2>{0.138851956f, 0.987466455f},
-std::array<float,2>{0.669442058f, 0.372593015f},
-std::array<float,2>{0.318404585f, 0.152791008f},
-std::array<float,2>{0.928649426f, 0.644874334f},
-std::array<float,2>{0.396806031f, 0.619107306f},
-std::array<float,2>{0.82318294f, 0.0068724486f},
-std::array<float,2>{0.0772268772f, 0.443087041f},
-std::array<float,2>{0.53550297f, 0.819634736f},
-std::array<float,2>{0.293709904f, 0.776339293f},
-std::array<float,2>{0.991724551f, 0.419041723f},
-std::array<float,2>{0.229538992f, 0.0914787501f},
-std::array<float,2>{0.715675235f, 0.506095707f},
-std::array<float,2>{0.0300723091f, 0.727330327f},
-std::array<float,2>{0.615031719f, 0.240357339f},
-std::array<float,2>{0.495216548f, 0.281783909f},
-std::array<float,2>{0.800008833f, 0.912997782f},
-std::array<float,2>{0.0637760609f, 0.947159886f},
-std::array<float,2>{0.539258957f, 0.321315527f},
-std::array<float,2>{0.402536094f, 0.163964614f},
-std::array<float,2>{0.815366983f, 0.68215698f},
-std::array<float,2>{0.32580778f, 0.586023033f},
-std::array<float,2>{0.932466626f, 0.0473806225f},
-std::array<float,2>{0.127429411f, 0.499208719f},
-std::array<float,2>{0.658956587f, 0.854082465f},
-std::array<float,2>{0.486597896f, 0.784949481f},
-std::array<float,2>{0.810895681f, 0.386332303f},
-std::array<float,2>{0.0217366405f, 0.0941616148f},
-std::array<float,2>{0.618821442f, 0.553449869f},
-std::array<float,2>{0.221586913f, 0.703806579f},
-std::array<float,2>{0.710079551f, 0.196320474f},
-std::array<float,2>{0.283526897f, 0.279969871f},
-std::array<float,2>{0.994759023f, 0.891828418f},
-std::array<float,2>{0.168249115f, 0.825922966f},
-std::array<float,2>{0.652626991f, 0.452403277f},
-std::array<float,2>{0.359708577f, 0.0133751277f},
-std::array<float,2>{0.903528333f, 0.616124511f},
-std::array<float,2>{0.43069011f, 0.653266549f},
-std::array<float,2>{0.858511984f, 0.145941511f},
-std::array<float,2>{0.112293527f, 0.363912374f},
-std::array<float,2>{0.507259369f, 0.993356586f},
-std::array<float,2>{0.265840024f, 0.914438426f},
-std::array<float,2>{0.96311897f, 0.295174479f},
-std::array<float,2>{0.190226004f, 0.24391678f},
-std::array<float,2>{0.73072654f, 0.718787611f},
-std::array<float,2>{0.0381577797f, 0.514168918f},
-std::array<float,2>{0.591146946f, 0.0824732706f},
-std::array<float,2>{0.459893465f, 0.412913322f},
-std::array<float,2>{0.75516814f, 0.771320343f},
-std::array<float,2>{0.00401778659f, 0.753626823f},
-std::array<float,2>{0.604112744f, 0.42858851f},
-std::array<float,2>{0.478319198f, 0.0742374733f},
-std::array<float,2>{0.786059439f, 0.530575216f},
-std::array<float,2>{0.302279145f, 0.744172573f},
-std::array<float,2>{0.976727188f, 0.230268851f},
-std::array<float,2>{0.235182911f, 0.308961719f},
-std::array<float,2>{0.691635966f, 0.933448613f},
-std::array<float,2>{0.376743257f, 0.977844536f},
-std::array<float,2>{0.841934204f, 0.352040052f},
-std::array<float,2>{0.0796179548f, 0.126694307f},
-std::array<float,2>{0.54890728f, 0.631186306f},
-std::array<float,2>{0.145715401f, 0.598795891f},
-std::array<float,2>{0.672756851f, 0.0205168091f},
-std::array<float,2>{0.330993801f, 0.46359989f},
-std::array<float,2>{0.918575287f, 0.838844121f},
-std::array<float,2>{0.212221041f, 0.887047231f},
-std::array<float,2>{0.745109379f, 0.261678457f},
-std::array<float,2>{0.25847441f, 0.212565303f},
-std::array<float,2>{0.938347816f, 0.689746916f},
-std::array<float,2>{0.448612452f, 0.539039612f},
-std::array<float,2>{0.7799896f, 0.120549731f},
-std::array<float,2>{0.0469663888f, 0.391696185f},
-std::array<float,2>{0.572815418f, 0.798333764f},
-std::array<float,2>{0.352888316f, 0.859410703f},
-std::array<float,2>{0.889072955f, 0.469365597f},
-std::array<float,2>{0.172103047f, 0.0314889885f},
-std::array<float,2>{0.627242148f, 0.576706111f},
-std::array<float,2>{0.099278003f, 0.669422686f},
-std::array<float,2>{0.521731317f, 0.183402136f},
-std::array<float,2>{0.419839889f, 0.33851251f},
-std::array<float,2>{0.860310674f, 0.963971317f},
-std::array<float,2>{0.0184077397f, 0.975721061f},
-std::array<float,2>{0.623086154f, 0.3499026f},
-std::array<float,2>{0.491479278f, 0.135506988f},
-std::array<float,2>{0.805209994f, 0.633628786f},
-std::array<float,2>{0.28786853f, 0.605795562f},
-std::array<float,2>{0.997028708f, 0.029897606f},
-std::array<float,2>{0.226387635f, 0.45965293f},
-std::array<float,2>{0.703657329f, 0.835332692f},
-std::array<float,2>{0.399142146f, 0.760987401f},
-std::array<float,2>{0.81760323f, 0.429745704f},
-std::array<float,2>{0.0679179654f, 0.0671196878f},
-std::array<float,2>{0.546793699f, 0.520108461f},
-std::array<float,2>{0.129010931f, 0.735294402f},
-std::array<float,2>{0.662787139f, 0.226332605f},
-std::array<float,2>{0.323952109f, 0.301969349f},
-std::array<float,2>{0.93634057f, 0.928351641f},
-std::array<float,2>{0.194553643f, 0.873034954f},
-std::array<float,2>{0.729272962f, 0.482594937f},
-std::array<float,2>{0.26976499f, 0.0456147455f},
-std::array<float,2>{0.965923667f, 0.564092994f},
-std::array<float,2>{0.454784036f, 0.663216472f},
-std::array<float,2>{0.753000736f, 0.174211711f},
-std::array<float,2>{0.0340520479f, 0.332711369f},
-std::array<float,2>{0.587920487f, 0.958716929f},
-std::array<float,2>{0.365971804f, 0.877760112f},
-std::array<float,2>{0.902121723f, 0.25279364f},
-std::array<float,2>{0.166585863f, 0.206187636f},
-std::array<float,2>{0.651631951f, 0.695404768f},
-std::array<float,2>{0.114097752f, 0.540008783f},
-std::array<float,2>{0.502795815f, 0.115859956f},
-std::array<float,2>{0.434876889f, 0.40049246f},
-std::array<float,2>{0.852227926f, 0.805085361f},
-std::array<float,2>{0.0846951008f, 0.796644032f},
-std::array<float,2>{0.552459776f, 0.378182352f},
-std::array<float,2>{0.380502254f, 0.104931727f},
-std::array<float,2>{0.837102056f, 0.561752379f},
-std::array<float,2>{0.334213287f, 0.715210736f},
-std::array<float,2>{0.916029751f, 0.193837568f},
-std::array<float,2>{0.141935676f, 0.266407162f},
-std::array<float,2>{0.678263247f, 0.902336776f},
-std::array<float,2>{0.484000236f, 0.939725161f},
-std::array<float,2>{0.78291744f, 0.318062335f},
-std::array<float,2>{0.000288056268f, 0.16550158f},
-std::array<float,2>{0.60864073f, 0.678401351f},
-std::array<float,2>{0.240330741f, 0.582078576f},
-std::array<float,2>{0.691266775f, 0.0586218908f},
-std::array<float,2>{0.298325628f, 0.486894935f},
-std::array<float,2>{0.981494188f, 0.849630475f},
-std::array<float,2>{0.176847011f, 0.91002214f},
-std::array<float,2>{0.631564617f, 0.285449654f},
-std::array<float,2>{0.357627153f, 0.235976025f},
-std::array<float,2>{0.884467244f, 0.731746852f},
-std::array<float,2>{0.41544795f, 0.501447797f},
-std::array<float,2>{0.865858078f, 0.0862510949f},
-std::array<float,2>{0.0952633694f, 0.414222389f},
-std::array<float,2>{0.518406272f, 0.778706193f},
-std::array<float,2>{0.263494045f, 0.81515193f},
-std::array<float,2>{0.942512751f, 0.439565808f},
-std::array<float,2>{0.216436669f, 0.00267629744f},
-std::array<float,2>{0.749629617f, 0.624900401f},
-std::array<float,2>{0.0535397865f, 0.641502202f},
-std::array<float,2>{0.577729404f, 0.151101083f},
-std::array<float,2>{0.450199962f, 0.369452804f},
-std::array<float,2>{0.774282098f, 0.989805818f},
-std::array<float,2>{0.104553312f, 0.894658566f},
-std::array<float,2>{0.524996996f, 0.274351001f},
-std::array<float,2>{0.407245785f, 0.202930823f},
-std::array<float,2>{0.873145342f, 0.708044112f},
-std::array<float,2>{0.345573485f, 0.549901187f},
-std::array<float,2>{0.878739476f, 0.101502545f},
-std::array<float,2>{0.186635867f, 0.389066607f},
-std::array<float,2>{0.639206231f, 0.788908601f},
-std::array<float,2>{0.444336414f, 0.858224809f},
-std::array<float,2>{0.769199669f, 0.492939055f},
-std::array<float,2>{0.0547762029f, 0.0513617881f},
-std::array<float,2>{0.568348229f, 0.5908131f},
-std::array<float,2>{0.205799073f, 0.687140822f},
-std::array<float,2>{0.736922622f, 0.158048913f},
-std::array<float,2>{0.256541282f, 0.324963063f},
-std::array<float,2>{0.948293447f, 0.951114535f},
-std::array<float,2>{0.149004593f, 0.768935502f},
-std::array<float,2>{0.68532604f, 0.408043504f},
-std::array<float,2>{0.342382908f, 0.0794409737f},
-std::array<float,2>{0.91061312f, 0.508143485f},
-std::array<float,2>{0.386589527f, 0.725378692f},
-std::array<float,2>{0.831636012f, 0.247612923f},
-std::array<float,2>{0.088746421f, 0.291134447f},
-std::array<float,2>{0.559135497f, 0.921829343f},
-std::array<float,2>{0.30746454f, 0.996636212f},
-std::array<float,2>{0.974918127f, 0.362184793f},
-std::array<float,2>{0.246998966f, 0.142833158f},
-std::array<float,2>{0.696157515f, 0.649084687f},
-std::array<float,2>{0.0131091699f, 0.609727383f},
-std::array<float,2>{0.595508099f, 0.0100822607f},
-std::array<float,2>{0.468874961f, 0.447221309f},
-std::array<float,2>{0.793854952f, 0.821838558f},
-std::array<float,2>{0.0442704596f, 0.842272043f},
-std::array<float,2>{0.580792546f, 0.468265295f},
-std::array<float,2>{0.464350551f, 0.0172186606f},
-std::array<float,2>{0.761181176f, 0.595383942f},
-std::array<float,2>{0.276187122f, 0.628899872f},
-std::array<float,2>{0.95680666f, 0.131088421f},
-std::array<float,2>{0.196886316f, 0.356227249f},
-std::array<float,2>{0.721362412f, 0.984288752f},
-std::array<float,2>{0.423862606f, 0.936450899f},
-std::array<float,2>{0.84849906f, 0.308087736f},
-std::array<float,2>{0.124523096f, 0.232067019f},
-std::array<float,2>{0.511490166f, 0.748876929f},
-std::array<float,2>{0.16127111f, 0.523938239f},
-std::array<float,2>{0.646529555f, 0.0706555173f},
-std::array<float,2>{0.37236318f, 0.422994137f},
-std::array<float,2>{0.893150032f, 0.755903602f},
-std::array<float,2>{0.230552465f, 0.967414141f},
-std::array<float,2>{0.713376045f, 0.343329906f},
-std::array<float,2>{0.290830404f, 0.18597126f},
-std::array<float,2>{0.985161006f, 0.667502522f},
-std::array<float,2>{0.496766061f, 0.573639512f},
-std::array<float,2>{0.804429173f, 0.0382165276f},
-std::array<float,2>{0.024794532f, 0.476440549f},
-std::array<float,2>{0.610725641f, 0.865696192f},
-std::array<float,2>{0.314913511f, 0.803121805f},
-std::array<float,2>{0.925348699f, 0.394941002f},
-std::array<float,2>{0.13582696f, 0.122898921f},
-std::array<float,2>{0.666837931f, 0.533129334f},
-std::array<float,2>{0.0718386248f, 0.69449532f},
-std::array<float,2>{0.53158772f, 0.21624954f},
-std::array<float,2>{0.391482383f, 0.263201803f},
-std::array<float,2>{0.82527411f, 0.886276782f},
-std::array<float,2>{0.0284738392f, 0.913166463f},
-std::array<float,2>{0.617015302f, 0.282582492f},
-std::array<float,2>{0.492615074f, 0.241943702f},
-std::array<float,2>{0.798365891f, 0.728192449f},
-std::array<float,2>{0.295203179f, 0.507512212f},
-std::array<float,2>{0.988421798f, 0.0900691077f},
-std::array<float,2>{0.227673396f, 0.418765366f},
-std::array<float,2>{0.717774689f, 0.776885748f},
-std::array<float,2>{0.395836115f, 0.819057405f},
-std::array<float,2>{0.822074115f, 0.441952199f},
-std::array<float,2>{0.0746823251f, 0.00624887226f},
-std::array<float,2>{0.537993729f, 0.617683411f},
-std::array<float,2>{0.136914641f, 0.645608127f},
-std::array<float,2>{0.671801329f, 0.154020622f},
-std::array<float,2>{0.318274826f, 0.371901929f},
-std::array<float,2>{0.926403046f, 0.987178504f},
-std::array<float,2>{0.203079522f, 0.791977048f},
-std::array<float,2>{0.725375772f, 0.381204873f},
-std::array<float,2>{0.280017614f, 0.107127443f},
-std::array<float,2>{0.957956195f, 0.55581969f},
-std::array<float,2>{0.465031266f, 0.713155925f},
-std::array<float,2>{0.763125896f, 0.19050011f},
-std::array<float,2>{0.0425614342f, 0.271052808f},
-std::array<float,2>{0.582967401f, 0.903475523f},
-std::array<float,2>{0.369255692f, 0.94381398f},
-std::array<float,2>{0.898075223f, 0.313869536f},
-std::array<float,2>{0.156869292f, 0.169857278f},
-std::array<float,2>{0.643818974f, 0.67471838f},
-std::array<float,2>{0.120845795f, 0.579818368f},
-std::array<float,2>{0.511909068f, 0.0576905347f},
-std::array<float,2>{0.427950442f, 0.489806533f},
-std::array<float,2>{0.845556259f, 0.844814777f},
-std::array<float,2>{0.0906018838f, 0.870399594f},
-std::array<float,2>{0.556121171f, 0.476701677f},
-std::array<float,2>{0.388223141f, 0.041334983f},
-std::array<float,2>{0.833057046f, 0.567881167f},
-std::array<float,2>{0.336623996f, 0.659931064f},
-std::array<float,2>{0.908765256f, 0.178330556f},
-std::array<float,2>{0.153390467f, 0.329839766f},
-std::array<float,2>{0.683532417f, 0.955049753f},
-std::array<float,2>{0.472979307f, 0.881475508f},
-std::array<float,2>{0.79203403f, 0.256088674f},
-std::array<float,2>{0.0102260076f, 0.209722459f},
-std::array<float,2>{0.600885749f, 0.699884534f},
-std::array<float,2>{0.24550958f, 0.546028554f},
-std::array<float,2>{0.702381492f, 0.112318583f},
-std::array<float,2>{0.310559452f, 0.403194636f},
-std::array<float,2>{0.970052481f, 0.808628201f},
-std::array<float,2>{0.182522744f, 0.972281516f},
-std::array<float,2>{0.633260667f, 0.344098359f},
-std::array<float,2>{0.348280251f, 0.139875263f},
-std::array<float,2>{0.878933311f, 0.639398873f},
-std::array<float,2>{0.41325748f, 0.603104651f},
-std::array<float,2>{0.869037151f, 0.0236399807f},
-std::array<float,2>{0.105669484f, 0.454624295f},
-std::array<float,2>{0.527915657f, 0.831687152f},
-std::array<float,2>{0.253346354f, 0.764196396f},
-std::array<float,2>{0.949602962f, 0.433991522f},
-std::array<float,2>{0.207576871f, 0.0655229241f},
-std::array<float,2>{0.740170419f, 0.518967032f},
-std::array<float,2>{0.0600397177f, 0.738911211f},
-std::array<float,2>{0.56418401f, 0.219585031f},
-std::array<float,2>{0.440969378f, 0.299278259f},
-std::array<float,2>{0.77130425f, 0.923718572f},
-std::array<float,2>{0.100092687f, 0.963581145f},
-std::array<float,2>{0.519976139f, 0.339111209f},
-std::array<float,2>{0.420982718f, 0.182146236f},
-std::array<float,2>{0.862232804f, 0.66844821f},
-std::array<float,2>{0.354105175f, 0.577837467f},
-std::array<float,2>{0.887657583f, 0.0327862017f},
-std::array<float,2>{0.175215811f, 0.470439464f},
-std::array<float,2>{0.626273632f, 0.861043632f},
-std::array<float,2>{0.445708752f, 0.797152877f},
-std::array<float,2>{0.778540909f, 0.390810132f},
-std::array<float,2>{0.0503637567f, 0.119973637f},
-std::array<float,2>{0.570814133f, 0.537468612f},
-std::array<float,2>{0.213052481f, 0.690916181f},
-std::array<float,2>{0.742979884f, 0.211776853f},
-std::array<float,2>{0.260180444f, 0.260254949f},
-std::array<float,2>{0.939889014f, 0.888612509f},
-std::array<float,2>{0.147075221f, 0.839662254f},
-std::array<float,2>{0.674662113f, 0.464387774f},
-std::array<float,2>{0.329384148f, 0.0197034646f},
-std::array<float,2>{0.920675695f, 0.598238885f},
-std::array<float,2>{0.378857106f, 0.632471383f},
-std::array<float,2>{0.839917064f, 0.125035524f},
-std::array<float,2>{0.0801674724f, 0.352594346f},
-std::array<float,2>{0.548036635f, 0.97711128f},
-std::array<float,2>{0.303193092f, 0.932261169f},
-std::array<float,2>{0.978794873f, 0.310064316f},
-std::array<float,2>{0.237428382f, 0.229112417f},
-std::array<float,2>{0.694622517f, 0.745764077f},
-std::array<float,2>{0.00760873128f, 0.529969454f},
-std::array<float,2>{0.602028549f, 0.0752580985f},
-std::array<float,2>{0.479220092f, 0.42967394f},
-std::array<float,2>{0.788337231f, 0.752248168f},
-std::array<float,2>{0.0362298712f, 0.77040571f},
-std::array<float,2>{0.592750669f, 0.413437337f},
-std::array<float,2>{0.457542002f, 0.0832113773f},
-std::array<float,2>{0.756003022f, 0.514740884f},
-std::array<float,2>{0.269116044f, 0.720134795f},
-std::array<float,2>{0.962770641f, 0.242951214f},
-std::array<float,2>{0.188529536f, 0.296615869f},
-std::array<float,2>{0.732605457f, 0.915315926f},
-std::array<float,2>{0.432194978f, 0.992525935f},
-std::array<float,2>{0.855943799f, 0.364632547f},
-std::array<float,2>{0.110456795f, 0.144866154f},
-std::array<float,2>{0.505197287f, 0.653540075f},
-std::array<float,2>{0.170438021f, 0.616309404f},
-std::array<float,2>{0.656132281f, 0.0126762772f},
-std::array<float,2>{0.362146914f, 0.451764792f},
-std::array<float,2>{0.904604256f, 0.824503422f},
-std::array<float,2>{0.219795391f, 0.891190231f},
-std::array<float,2>{0.708355308f, 0.280723691f},
-std::array<float,2>{0.282042801f, 0.195471659f},
-std::array<float,2>{0.992500305f, 0.70461297f},
-std::array<float,2>{0.485159367f, 0.554496408f},
-std::array<float,2>{0.809246957f, 0.0954941511f},
-std::array<float,2>{0.0203310307f, 0.38505283f},
-std::array<float,2>{0.620556951f, 0.783714294f},
-std::array<float,2>{0.326881319f, 0.855212569f},
-std::array<float,2>{0.930071175f, 0.498434991f},
-std::array<float,2>{0.126823708f, 0.048035156f},
-std::array<float,2>{0.656968713f, 0.587023079f},
-std::array<float,2>{0.0645522624f, 0.682764351f},
-std::array<float,2>{0.541725397f, 0.162914664f},
-std::array<float,2>{0.404979736f, 0.321189761f},
-std::array<float,2>{0.81337297f, 0.945658505f},
-std::array<float,2>{0.0526950471f, 0.989205956f},
-std::array<float,2>{0.574233234f, 0.371043622f},
-std::array<float,2>{0.451518595f, 0.152246818f},
-std::array<float,2>{0.776085019f, 0.641662836f},
-std::array<float,2>{0.265566766f, 0.623869598f},
-std::array<float,2>{0.944854915f, 0.00384909776f},
-std::array<float,2>{0.217583746f, 0.441388726f},
-std::array<float,2>{0.74770081f, 0.81620568f},
-std::array<float,2>{0.417240411f, 0.77762121f},
-std::array<float,2>{0.864997327f, 0.415238917f},
-std::array<float,2>{0.0970021486f, 0.0872207955f},
-std::array<float,2>{0.51636982f, 0.500584066f},
-std::array<float,2>{0.179372624f, 0.731399834f},
-std::array<float,2>{0.629423499f, 0.23466599f},
-std::array<float,2>{0.355824798f, 0.286666214f},
-std::array<float,2>{0.88484776f, 0.908422172f},
-std::array<float,2>{0.238989785f, 0.850647688f},
-std::array<float,2>{0.687755525f, 0.487952143f},
-std::array<float,2>{0.299918592f, 0.0601416826f},
-std::array<float,2>{0.982761204f, 0.583161414f},
-std::array<float,2>{0.48146528f, 0.67878902f},
-std::array<float,2>{0.784460545f, 0.164984956f},
-std::array<float,2>{0.00211675698f, 0.317310363f},
-std::array<float,2>{0.606405497f, 0.940452039f},
-std::array<float,2>{0.333449334f, 0.90110594f},
-std::array<float,2>{0.914881408f, 0.267561704f},
-std::array<float,2>{0.143905595f, 0.195081785f},
-std::array<float,2>{0.677524149f, 0.716379106f},
-std::array<float,2>{0.0829455778f, 0.560778201f},
-std::array<float,2>{0.553549528f, 0.103700735f},
-std::array<float,2>{0.381562889f, 0.377434313f},
-std::array<float,2>{0.839273632f, 0.795775235f},
-std::array<float,2>{0.116801068f, 0.80632925f},
-std::array<float,2>{0.501568198f, 0.402306795f},
-std::array<float,2>{0.43709442f, 0.116430938f},
-std::array<float,2>{0.853600204f, 0.540629745f},
-std::array<float,2>{0.364343166f, 0.696320534f},
-std::array<float,2>{0.899937928f, 0.205792889f},
-std::array<float,2>{0.164914504f, 0.252972186f},
-std::array<float,2>{0.648742616f, 0.878402174f},
-std::array<float,2>{0.456198692f, 0.957756758f},
-std::array<float,2>{0.750506163f, 0.33358568f},
-std::array<float,2>{0.0321279205f, 0.174979776f},
-std::array<float,2>{0.586018085f, 0.662709475f},
-std::array<float,2>{0.192616001f, 0.563334227f},
-std::array<float,2>{0.727911651f, 0.0463978648f},
-std::array<float,2>{0.273057073f, 0.484187335f},
-std::array<float,2>{0.968323052f, 0.871968389f},
-std::array<float,2>{0.13129127f, 0.929515362f},
-std::array<float,2>{0.661193371f, 0.301548451f},
-std::array<float,2>{0.320313722f, 0.225121379f},
-std::array<float,2>{0.934102178f, 0.735458851f},
-std::array<float,2>{0.40191716f, 0.52094388f},
-std::array<float,2>{0.820125282f, 0.0678363517f},
-std::array<float,2>{0.0698114336f, 0.430948317f},
-std::array<float,2>{0.544351518f, 0.760659039f},
-std::array<float,2>{0.285809308f, 0.834086955f},
-std::array<float,2>{0.998285472f, 0.460608184f},
-std::array<float,2>{0.223813608f, 0.0308795702f},
-std::array<float,2>{0.705258548f, 0.606854439f},
-std::array<float,2>{0.0163324978f, 0.634402871f},
-std::array<float,2>{0.62263f, 0.136533514f},
-std::array<float,2>{0.489631742f, 0.351256192f},
-std::array<float,2>{0.807583511f, 0.975248516f},
-std::array<float,2>{0.0740563795f, 0.884885073f},
-std::array<float,2>{0.534312606f, 0.26207605f},
-std::array<float,2>{0.3931171f, 0.215650439f},
-std::array<float,2>{0.827810884f, 0.693935752f},
-std::array<float,2>{0.313836783f, 0.532048702f},
-std::array<float,2>{0.922418058f, 0.121781342f},
-std::array<float,2>{0.134017691f, 0.395835191f},
-std::array<float,2>{0.664808631f, 0.804322541f},
-std::array<float,2>{0.499243736f, 0.866941988f},
-std::array<float,2>{0.80087167f, 0.475544423f},
-std::array<float,2>{0.0255035814f, 0.0372978859f},
-std::array<float,2>{0.613004446f, 0.573003709f},
-std::array<float,2>{0.233272821f, 0.666497946f},
-std::array<float,2>{0.712544918f, 0.187284589f},
-std::array<float,2>{0.291103303f, 0.342384964f},
-std::array<float,2>{0.987787008f, 0.968320608f},
-std::array<float,2>{0.162236944f, 0.75746578f},
-std::array<float,2>{0.645375967f, 0.422787577f},
-std::array<float,2>{0.374896199f, 0.0713021383f},
-std::array<float,2>{0.891711235f, 0.524690032f},
-std::array<float,2>{0.421912074f, 0.749990821f},
-std::array<float,2>{0.851330459f, 0.230779171f},
-std::array<float,2>{0.122356035f, 0.307271332f},
-std::array<float,2>{0.508347809f, 0.936946154f},
-std::array<float,2>{0.275210261f, 0.983353615f},
-std::array<float,2>{0.95413661f, 0.356651008f},
-std::array<float,2>{0.197270989f, 0.132417604f},
-std::array<float,2>{0.718824267f, 0.627108216f},
-std::array<float,2>{0.0459694378f, 0.594067216f},
-std::array<float,2>{0.578882456f, 0.0162415411f},
-std::array<float,2>{0.461425126f, 0.46740067f},
-std::array<float,2>{0.759607136f, 0.843702495f},
-std::array<float,2>{0.0149059175f, 0.820417285f},
-std::array<float,2>{0.596455395f, 0.44579047f},
-std::array<float,2>{0.471120656f, 0.0114109125f},
-std::array<float,2>{0.79583025f, 0.610603392f},
-std::array<float,2>{0.306540042f, 0.64984268f},
-std::array<float,2>{0.973028362f, 0.143833116f},
-std::array<float,2>{0.248106912f, 0.362911284f},
-std::array<float,2>{0.69865036f, 0.99765861f},
-std::array<float,2>{0.384375632f, 0.920507312f},
-std::array<float,2>{0.82871902f, 0.292914301f},
-std::array<float,2>{0.08744362f, 0.246271804f},
-std::array<float,2>{0.562175333f, 0.726527214f},
-std::array<float,2>{0.150784358f, 0.509352803f},
-std::array<float,2>{0.687139392f, 0.0790651366f},
-std::array<float,2>{0.341114342f, 0.406847835f},
-std::array<float,2>{0.912399769f, 0.768523157f},
-std::array<float,2>{0.20422262f, 0.949627221f},
-std::array<float,2>{0.736105859f, 0.325869828f},
-std::array<float,2>{0.255034983f, 0.156853035f},
-std::array<float,2>{0.946536422f, 0.686036408f},
-std::array<float,2>{0.443175405f, 0.59118104f},
-std::array<float,2>{0.766255915f, 0.0523026921f},
-std::array<float,2>{0.0569455177f, 0.494067043f},
-std::array<float,2>{0.569921434f, 0.858625591f},
-std::array<float,2>{0.347247243f, 0.787255645f},
-std::array<float,2>{0.876248837f, 0.389872164f},
-std::array<float,2>{0.185018629f, 0.100505747f},
-std::array<float,2>{0.637143493f, 0.549494028f},
-std::array<float,2>{0.10262803f, 0.707383037f},
-std::array<float,2>{0.526917458f, 0.201354861f},
-std::array<float,2>{0.409721226f, 0.275101691f},
-std::array<float,2>{0.871865094f, 0.896384537f},
-std::array<float,2>{0.0405854993f, 0.904496789f},
-std::array<float,2>{0.584606528f, 0.271692634f},
-std::array<float,2>{0.468182623f, 0.189351425f},
-std::array<float,2>{0.76524359f, 0.712361276f},
-std::array<float,2>{0.278335303f, 0.557569206f},
-std::array<float,2>{0.959187567f, 0.107740946f},
-std::array<float,2>{0.200814322f, 0.379972726f},
-std::array<float,2>{0.723212838f, 0.789383352f},
-std::array<float,2>{0.427406102f, 0.84686321f},
-std::array<float,2>{0.84616977f, 0.491761148f},
-std::array<float,2>{0.118144438f, 0.0561296679f},
-std::array<float,2>{0.51481086f, 0.580986917f},
-std::array<float,2>{0.15852949f, 0.67307955f},
-std::array<float,2>{0.641541302f, 0.171456754f},
-std::array<float,2>{0.368451536f, 0.315203696f},
-std::array<float,2>{0.895364404f, 0.942758322f},
-std::array<float,2>{0.229486644f, 0.77488023f},
-std::array<float,2>{0.716369629f, 0.420433968f},
-std::array<float,2>{0.294246256f, 0.093420051f},
-std::array<float,2>{0.990989745f, 0.504625261f},
-std::array<float,2>{0.495089173f, 0.729453146f},
-std::array<float,2>{0.799614668f, 0.239162609f},
-std::array<float,2>{0.0307434537f, 0.2838144f},
-std::array<float,2>{0.614230394f, 0.911973f},
-std::array<float,2>{0.320229501f, 0.985018253f},
-std::array<float,2>{0.928756297f, 0.374723613f},
-std::array<float,2>{0.14045082f, 0.155863002f},
-std::array<float,2>{0.668118298f, 0.647452235f},
-std::array<float,2>{0.0762995631f, 0.620810211f},
-std::array<float,2>{0.536860228f, 0.00444624666f},
-std::array<float,2>{0.398431957f, 0.445203722f},
-std::array<float,2>{0.82414794f, 0.81797117f},
-std::array<float,2>{0.107697286f, 0.828940153f},
-std::array<float,2>{0.529932976f, 0.455989778f},
-std::array<float,2>{0.411114454f, 0.0257812571f},
-std::array<float,2>{0.869630158f, 0.604392111f},
-std::array<float,2>{0.350664675f, 0.637261868f},
-std::array<float,2>{0.88274169f, 0.136944622f},
-std::array<float,2>{0.179983452f, 0.346295148f},
-std::array<float,2>{0.636398613f, 0.969227195f},
-std::array<float,2>{0.437562943f, 0.925197065f},
-std::array<float,2>{0.772862256f, 0.297031999f},
-std::array<float,2>{0.0624727719f, 0.221836209f},
-std::array<float,2>{0.566231191f, 0.742003202f},
-std::array<float,2>{0.210169673f, 0.516655087f},
-std::array<float,2>{0.74205029f, 0.0628634691f},
-std::array<float,2>{0.250073671f, 0.435592234f},
-std::array<float,2>{0.951656401f, 0.763451397f},
-std::array<float,2>{0.155910775f, 0.95648098f},
-std::array<float,2>{0.680622756f, 0.331098855f},
-std::array<float,2>{0.338787615f, 0.175832704f},
-std::array<float,2>{0.90772754f, 0.657377124f},
-std::array<float,2>{0.389071971f, 0.568748832f},
-std::array<float,2>{0.834032834f, 0.0403384715f},
-std::array<float,2>{0.0929348692f, 0.478604257f},
-std::array<float,2>{0.557194471f, 0.868158281f},
-std::array<float,2>{0.309484154f, 0.810690045f},
-std::array<float,2>{0.972055197f, 0.404431403f},
-std::array<float,2>{0.242890924f, 0.109915808f},
-std::array<float,2>{0.700236201f, 0.543549001f},
-std::array<float,2>{0.00913225766f, 0.702723801f},
-std::array<float,2>{0.598151147f, 0.208135173f},
-std::array<float,2>{0.474668354f, 0.255000561f},
-std::array<float,2>{0.790244162f, 0.879388511f},
-std::array<float,2>{0.0788414776f, 0.980283618f},
-std::array<float,2>{0.550050378f, 0.355088472f},
-std::array<float,2>{0.375186473f, 0.128019705f},
-std::array<float,2>{0.843198895f, 0.63009131f},
-std::array<float,2>{0.331638873f, 0.601546347f},
-std::array<float,2>{0.919793189f, 0.0231527667f},
-std::array<float,2>{0.144889787f, 0.461176187f},
-std::array<float,2>{0.673340619f, 0.837468684f},
-std::array<float,2>{0.476573884f, 0.751524925f},
-std::array<float,2>{0.78633064f, 0.427277774f},
-std::array<float,2>{0.00554461591f, 0.0772007182f},
-std::array<float,2>{0.605214119f, 0.528916061f},
-std::array<float,2>{0.235592842f, 0.742189109f},
-std::array<float,2>{0.693098843f, 0.227069691f},
-std::array<float,2>{0.301541924f, 0.31093356f},
-std::array<float,2>{0.978473902f, 0.931125283f},
-std::array<float,2>{0.173594609f, 0.863010526f},
-std::array<float,2>{0.628202498f, 0.47202754f},
-std::array<float,2>{0.352472305f, 0.0336144902f},
-std::array<float,2>{0.890299678f, 0.574916422f},
-std::array<float,2>{0.418880761f, 0.671570122f},
-std::array<float,2>{0.861184478f, 0.180751547f},
-std::array<float,2>{0.098382853f, 0.336616278f},
-std::array<float,2>{0.522636056f, 0.962003589f},
-std::array<float,2>{0.259247184f, 0.890342534f},
-std::array<float,2>{0.938726068f, 0.258136868f},
-std::array<float,2>{0.211391583f, 0.213640094f},
-std::array<float,2>{0.74575007f, 0.68778199f},
-std::array<float,2>{0.0479313843f, 0.537104309f},
-std::array<float,2>{0.573532701f, 0.117664158f},
-std::array<float,2>{0.447863907f, 0.393226206f},
-std::array<float,2>{0.780712962f, 0.7994349f},
-std::array<float,2>{0.0225293264f, 0.782902658f},
-std::array<float,2>{0.617257416f, 0.38343963f},
-std::array<float,2>{0.488164425f, 0.0961382389f},
-std::array<float,2>{0.812437892f, 0.551630139f},
-std::array<float,2>{0.284364253f, 0.705431521f},
-std::array<float,2>{0.996030629f, 0.197894514f},
-std::array<float,2>{0.222110584f, 0.277989835f},
-std::array<float,2>{0.70924145f, 0.892972708f},
-std::array<float,2>{0.403598219f, 0.947475314f},
-std::array<float,2>{0.816006005f, 0.323365211f},
-std::array<float,2>{0.0629741699f, 0.160274714f},
-std::array<float,2>{0.540536702f, 0.680198073f},
-std::array<float,2>{0.128587693f, 0.587991595f},
-std::array<float,2>{0.659583807f, 0.0495922379f},
-std::array<float,2>{0.324488908f, 0.498008907f},
-std::array<float,2>{0.932887375f, 0.853083432f},
-std::array<float,2>{0.19102855f, 0.917329848f},
-std::array<float,2>{0.731854141f, 0.294009507f},
-std::array<float,2>{0.267294973f, 0.245556146f},
-std::array<float,2>{0.964532852f, 0.72198236f},
-std::array<float,2>{0.460220158f, 0.51327908f},
-std::array<float,2>{0.754103124f, 0.0852541924f},
-std::array<float,2>{0.0376816392f, 0.410720587f},
-std::array<float,2>{0.590031087f, 0.77289176f},
-std::array<float,2>{0.361241877f, 0.82653451f},
-std::array<float,2>{0.903291583f, 0.450087279f},
-std::array<float,2>{0.169856384f, 0.015079625f},
-std::array<float,2>{0.653799713f, 0.61486721f},
-std::array<float,2>{0.113197528f, 0.656125367f},
-std::array<float,2>{0.50673008f, 0.146533474f},
-std::array<float,2>{0.43051964f, 0.365744472f},
-std::array<float,2>{0.858006418f, 0.995170951f},
-std::array<float,2>{0.00121798099f, 0.93753463f},
-std::array<float,2>{0.608058929f, 0.318997115f},
-std::array<float,2>{0.483015478f, 0.166637912f},
-std::array<float,2>{0.782197356f, 0.676004052f},
-std::array<float,2>{0.296984285f, 0.584407985f},
-std::array<float,2>{0.98093915f, 0.0607781559f},
-std::array<float,2>{0.241415888f, 0.485339969f},
-std::array<float,2>{0.689805865f, 0.847901106f},
-std::array<float,2>{0.37906763f, 0.794377625f},
-std::array<float,2>{0.836117208f, 0.375123113f},
-std::array<float,2>{0.0852652267f, 0.101588279f},
-std::array<float,2>{0.551437557f, 0.559418499f},
-std::array<float,2>{0.141193986f, 0.71756351f},
-std::array<float,2>{0.678882599f, 0.192442119f},
-std::array<float,2>{0.335935175f, 0.268753499f},
-std::array<float,2>{0.917036533f, 0.899389029f},
-std::array<float,2>{0.215705976f, 0.813582361f},
-std::array<float,2>{0.74893868f, 0.438137561f},
-std::array<float,2>{0.262160152f, 0.00128657476f},
-std::array<float,2>{0.942128181f, 0.622911274f},
-std::array<float,2>{0.449737191f, 0.64371711f},
-std::array<float,2>{0.774899006f, 0.148645952f},
-std::array<float,2>{0.0542652868f, 0.367783695f},
-std::array<float,2>{0.576640666f, 0.990628541f},
-std::array<float,2>{0.359337419f, 0.906547487f},
-std::array<float,2>{0.883721769f, 0.289037168f},
-std::array<float,2>{0.176724687f, 0.237122089f},
-std::array<float,2>{0.632540286f, 0.733643353f},
-std::array<float,2>{0.0945416912f, 0.502649963f},
-std::array<float,2>{0.518769562f, 0.0884701759f},
-std::array<float,2>{0.414954692f, 0.416376293f},
-std::array<float,2>{0.866421878f, 0.779476166f},
-std::array<float,2>{0.0669249892f, 0.757983506f},
-std::array<float,2>{0.54575789f, 0.432651728f},
-std::array<float,2>{0.399601966f, 0.0690760836f},
-std::array<float,2>{0.816740036f, 0.523080468f},
-std::array<float,2>{0.322856128f, 0.737187862f},
-std::array<float,2>{0.936986327f, 0.223182902f},
-std::array<float,2>{0.130546883f, 0.302881837f},
-std::array<float,2>{0.663856685f, 0.927609444f},
-std::array<float,2>{0.490309507f, 0.973628223f},
-std::array<float,2>{0.805926442f, 0.348519444f},
-std::array<float,2>{0.0192376282f, 0.13422519f},
-std::array<float,2>{0.624859869f, 0.63600111f},
-std::array<float,2>{0.225309834f, 0.607507527f},
-std::array<float,2>{0.704109967f, 0.0274868011f},
-std::array<float,2>{0.289001584f, 0.457482189f},
-std::array<float,2>{0.997742772f, 0.832085133f},
-std::array<float,2>{0.167620406f, 0.876297355f},
-std::array<float,2>{0.651235998f, 0.250030696f},
-std::array<float,2>{0.366345406f, 0.203142107f},
-std::array<float,2>{0.900763392f, 0.697311759f},
-std::array<float,2>{0.433847874f, 0.541774571f},
-std::array<float,2>{0.852967203f, 0.11401733f},
-std::array<float,2>{0.114599578f, 0.399626464f},
-std::array<float,2>{0.503574669f, 0.808288991f},
-std::array<float,2>{0.270611614f, 0.874908745f},
-std::array<float,2>{0.96577853f, 0.481569469f},
-std::array<float,2>{0.193943381f, 0.0441725254f},
-std::array<float,2>{0.730464935f, 0.564812362f},
-std::array<float,2>{0.0343026295f, 0.661694288f},
-std::array<float,2>{0.589410245f, 0.172177956f},
-std::array<float,2>{0.453319192f, 0.335480511f},
-std::array<float,2>{0.752519965f, 0.96080333f},
-std::array<float,2>{0.123844914f, 0.934810996f},
-std::array<float,2>{0.509900689f, 0.304899544f},
-std::array<float,2>{0.425329268f, 0.233942717f},
-std::array<float,2>{0.848648489f, 0.747840583f},
-std::array<float,2>{0.371910542f, 0.527072012f},
-std::array<float,2>{0.893934309f, 0.0724402592f},
-std::array<float,2>{0.160631999f, 0.424495697f},
-std::array<float,2>{0.648301244f, 0.75487411f},
-std::array<float,2>{0.463521957f, 0.841089725f},
-std::array<float,2>{0.760520875f, 0.466348171f},
-std::array<float,2>{0.043046765f, 0.0178920999f},
-std::array<float,2>{0.58165884f, 0.596994817f},
-std::array<float,2>{0.196091846f, 0.62501049f},
-std::array<float,2>{0.721977055f, 0.129174143f},
-std::array<float,2>{0.276408494f, 0.359152853f},
-std::array<float,2>{0.955239177f, 0.982358575f},
-std::array<float,2>{0.135233968f, 0.802366614f},
-std::array<float,2>{0.667402089f, 0.396567315f},
-std::array<float,2>{0.316023052f, 0.123677805f},
-std::array<float,2>{0.924023986f, 0.535136521f},
-std::array<float,2>{0.392567724f, 0.691714287f},
-std::array<float,2>{0.824456513f, 0.217777655f},
-std::array<float,2>{0.0709660575f, 0.265381396f},
-std::array<float,2>{0.533010542f, 0.884203851f},
-std::array<float,2>{0.289406687f, 0.965692401f},
-std::array<float,2>{0.985668957f, 0.340082765f},
-std::array<float,2>{0.232373923f, 0.185304821f},
-std::array<float,2>{0.714604735f, 0.664529026f},
-std::array<float,2>{0.0239362177f, 0.571685135f},
-std::array<float,2>{0.609625459f, 0.0359228998f},
-std::array<float,2>{0.497719079f, 0.473303378f},
-std::array<float,2>{0.803302526f, 0.86336571f},
-std::array<float,2>{0.0559918545f, 0.856623828f},
-std::array<float,2>{0.567117929f, 0.494224012f},
-std::array<float,2>{0.444335073f, 0.0531774797f},
-std::array<float,2>{0.767867982f, 0.593180656f},
-std::array<float,2>{0.257691979f, 0.684531569f},
-std::array<float,2>{0.947973073f, 0.158615008f},
-std::array<float,2>{0.206106052f, 0.327307492f},
-std::array<float,2>{0.737332404f, 0.952494025f},
-std::array<float,2>{0.406872898f, 0.896816671f},
-std::array<float,2>{0.87451601f, 0.275838852f},
-std::array<float,2>{0.104344264f, 0.200166181f},
-std::array<float,2>{0.524340153f, 0.710692644f},
-std::array<float,2>{0.185712695f, 0.548372328f},
-std::array<float,2>{0.639885843f, 0.0990112647f},
-std::array<float,2>{0.344468296f, 0.387528688f},
-std::array<float,2>{0.877061665f, 0.785810649f},
-std::array<float,2>{0.247994959f, 0.998445749f},
-std::array<float,2>{0.697199047f, 0.359589249f},
-std::array<float,2>{0.308418214f, 0.142339185f},
-std::array<float,2>{0.975758135f, 0.65085572f},
-std::array<float,2>{0.469977438f, 0.612042248f},
-std::array<float,2>{0.794492364f, 0.00944333337f},
-std::array<float,2>{0.012522039f, 0.447553068f},
-std::array<float,2>{0.594013393f, 0.823114395f},
-std::array<float,2>{0.343271822f, 0.766031682f},
-std::array<float,2>{0.911467612f, 0.408237189f},
-std::array<float,2>{0.150231108f, 0.08029975f},
-std::array<float,2>{0.684487522f, 0.509807408f},
-std::array<float,2>{0.0891254097f, 0.72338146f},
-std::array<float,2>{0.560461283f, 0.248300374f},
-std::array<float,2>{0.385674447f, 0.289128602f},
-std::array<float,2>{0.830437362f, 0.91803211f},
-std::array<float,2>{0.0195860174f, 0.893428087f},
-std::array<float,2>{0.620739102f, 0.277362376f},
-std::array<float,2>{0.484645844f, 0.197451025f},
-std::array<float,2>{0.808898807f, 0.705711842f},
-std::array<float,2>{0.28131327f, 0.550789177f},
-std::array<float,2>{0.992749035f, 0.0962752998f},
-std::array<float,2>{0.22048761f, 0.382828206f},
-std::array<float,2>{0.708796442f, 0.782684803f},
-std::array<float,2>{0.404576182f, 0.852615297f},
-std::array<float,2>{0.812520146f, 0.497271389f},
-std::array<float,2>{0.0650625974f, 0.0490207225f},
-std::array<float,2>{0.541062653f, 0.588821471f},
-std::array<float,2>{0.126092359f, 0.679857492f},
-std::array<float,2>{0.656631172f, 0.160966963f},
-std::array<float,2>{0.326229662f, 0.324078709f},
-std::array<float,2>{0.930321932f, 0.947819591f},
-std::array<float,2>{0.189153478f, 0.773318946f},
-std::array<float,2>{0.733047187f, 0.410223573f},
-std::array<float,2>{0.268914223f, 0.0854897499f},
-std::array<float,2>{0.962222815f, 0.512758195f},
-std::array<float,2>{0.457155138f, 0.722655714f},
-std::array<float,2>{0.756514609f, 0.245969996f},
-std::array<float,2>{0.0368486978f, 0.294471622f},
-std::array<float,2>{0.592069983f, 0.917927802f},
-std::array<float,2>{0.361355811f, 0.99571234f},
-std::array<float,2>{0.905249536f, 0.365649104f},
-std::array<float,2>{0.170207053f, 0.147025123f},
-std::array<float,2>{0.655757129f, 0.655544877f},
-std::array<float,2>{0.111206859f, 0.614585519f},
-std::array<float,2>{0.505650461f, 0.0152113382f},
-std::array<float,2>{0.432006091f, 0.449444592f},
-std::array<float,2>{0.856433988f, 0.82692039f},
-std::array<float,2>{0.0810382739f, 0.837264121f},
-std::array<float,2>{0.548823893f, 0.461878926f},
-std::array<float,2>{0.378337115f, 0.0228064172f},
-std::array<float,2>{0.840768337f, 0.600934029f},
-std::array<float,2>{0.329636812f, 0.630569458f},
-std::array<float,2>{0.920116067f, 0.128468707f},
-std::array<float,2>{0.146914721f, 0.354933381f},
-std::array<float,2>{0.674221039f, 0.979956985f},
-std::array<float,2>{0.478945851f, 0.931303501f},
-std::array<float,2>{0.788895845f, 0.31144917f},
-std::array<float,2>{0.00721581047f, 0.226850569f},
-std::array<float,2>{0.602110565f, 0.742821276f},
-std::array<float,2>{0.238205194f, 0.52867204f},
-std::array<float,2>{0.695014119f, 0.0776526555f},
-std::array<float,2>{0.303647637f, 0.427065492f},
-std::array<float,2>{0.979420304f, 0.751332343f},
-std::array<float,2>{0.175343037f, 0.962868989f},
-std::array<float,2>{0.626476407f, 0.336368829f},
-std::array<float,2>{0.353626579f, 0.181199685f},
-std::array<float,2>{0.886814237f, 0.671341002f},
-std::array<float,2>{0.421691537f, 0.57439661f},
-std::array<float,2>{0.861379921f, 0.033928059f},
-std::array<float,2>{0.10050112f, 0.472361684f},
-std::array<float,2>{0.520262897f, 0.862520278f},
-std::array<float,2>{0.260336697f, 0.799006641f},
-std::array<float,2>{0.940279961f, 0.392766714f},
-std::array<float,2>{0.213777274f, 0.11792051f},
-std::array<float,2>{0.742285848f, 0.536310792f},
-std::array<float,2>{0.0501671247f, 0.688245595f},
-std::array<float,2>{0.570370615f, 0.213000163f},
-std::array<float,2>{0.446071029f, 0.258753508f},
-std::array<float,2>{0.778904378f, 0.889863014f},
-std::array<float,2>{0.106163524f, 0.96947211f},
-std::array<float,2>{0.527487099f, 0.34572494f},
-std::array<float,2>{0.414006114f, 0.137486741f},
-std::array<float,2>{0.868634701f, 0.637055755f},
-std::array<float,2>{0.347676218f, 0.603824794f},
-std::array<float,2>{0.879804671f, 0.0262015872f},
-std::array<float,2>{0.18211627f, 0.45525369f},
-std::array<float,2>{0.633624017f, 0.828555644f},
-std::array<float,2>{0.440840542f, 0.762832999f},
-std::array<float,2>{0.77096045f, 0.436069906f},
-std::array<float,2>{0.0601513386f, 0.0632605255f},
-std::array<float,2>{0.563805938f, 0.517358184f},
-std::array<float,2>{0.207115114f, 0.741250753f},
-std::array<float,2>{0.739590585f, 0.222649068f},
-std::array<float,2>{0.253804386f, 0.297748476f},
-std::array<float,2>{0.949820757f, 0.925338566f},
-std::array<float,2>{0.154133141f, 0.867356777f},
-std::array<float,2>{0.682823956f, 0.479340822f},
-std::array<float,2>{0.335939229f, 0.0408436731f},
-std::array<float,2>{0.908521056f, 0.568915188f},
-std::array<float,2>{0.387818784f, 0.657879233f},
-std::array<float,2>{0.833663583f, 0.176723212f},
-std::array<float,2>{0.0898987055f, 0.331990957f},
-std::array<float,2>{0.556473911f, 0.956734359f},
-std::array<float,2>{0.311257303f, 0.879580796f},
-std::array<float,2>{0.970651448f, 0.255640447f},
-std::array<float,2>{0.245658338f, 0.208864808f},
-std::array<float,2>{0.702938676f, 0.702400863f},
-std::array<float,2>{0.0106456755f, 0.543339312f},
-std::array<float,2>{0.601237476f, 0.109551154f},
-std::array<float,2>{0.473219991f, 0.4050183f},
-std::array<float,2>{0.792873442f, 0.811314285f},
-std::array<float,2>{0.0422618091f, 0.789734006f},
-std::array<float,2>{0.582050085f, 0.380448163f},
-std::array<float,2>{0.46545893f, 0.108199917f},
-std::array<float,2>{0.763226688f, 0.55676198f},
-std::array<float,2>{0.279507577f, 0.712662637f},
-std::array<float,2>{0.957098484f, 0.188731f},
-std::array<float,2>{0.202199519f, 0.272040397f},
-std::array<float,2>{0.725032449f, 0.905214369f},
-std::array<float,2>{0.428684175f, 0.942890108f},
-std::array<float,2>{0.844749451f, 0.31471014f},
-std::array<float,2>{0.12024267f, 0.171034709f},
-std::array<float,2>{0.51259762f, 0.673673332f},
-std::array<float,2>{0.156637341f, 0.580307662f},
-std::array<float,2>{0.644344807f, 0.0564442389f},
-std::array<float,2>{0.369939268f, 0.491399318f},
-std::array<float,2>{0.897596002f, 0.847597301f},
-std::array<float,2>{0.228210777f, 0.911614895f},
-std::array<float,2>{0.718539f, 0.283211201f},
-std::array<float,2>{0.295558721f, 0.238570824f},
-std::array<float,2>{0.98903209f, 0.728731394f},
-std::array<float,2>{0.493120819f, 0.504064322f},
-std::array<float,2>{0.798189998f, 0.0927894264f},
-std::array<float,2>{0.0291457418f, 0.419972092f},
-std::array<float,2>{0.616455972f, 0.775018334f},
-std::array<float,2>{0.317777902f, 0.817470908f},
-std::array<float,2>{0.925925612f, 0.4445149f},
-std::array<float,2>{0.137228593f, 0.00404513068f},
-std::array<float,2>{0.671027303f, 0.620553851f},
-std::array<float,2>{0.0751950592f, 0.646491826f},
-std::array<float,2>{0.537417471f, 0.155278593f},
-std::array<float,2>{0.396381915f, 0.374441922f},
-std::array<float,2>{0.821496606f, 0.984609425f},
-std::array<float,2>{0.0576107837f, 0.952744782f},
-std::array<float,2>{0.569366872f, 0.328013867f},
-std::array<float,2>{0.44266215f, 0.159109935f},
-std::array<float,2>{0.765717626f, 0.683781862f},
-std::array<float,2>{0.255473495f, 0.593565643f},
-std::array<float,2>{0.947109878f, 0.0536630489f},
-std::array<float,2>{0.204698756f, 0.494714648f},
-std::array<float,2>{0.735751808f, 0.856998205f},
-std::array<float,2>{0.409336597f, 0.785483658f},
-std::array<float,2>{0.871468306f, 0.386880785f},
-std::array<float,2>{0.103251629f, 0.0992244706f},
-std::array<float,2>{0.526821792f, 0.548020124f},
-std::array<float,2>{0.18508552f, 0.710404277f},
-std::array<float,2>{0.637666821f, 0.199540123f},
-std::array<float,2>{0.346694589f, 0.276068777f},
-std::array<float,2>{0.876939654f, 0.897365868f},
-std::array<float,2>{0.24871777f, 0.822370589f},
-std::array<float,2>{0.698882222f, 0.44811815f},
-std::array<float,2>{0.305760443f, 0.00893033389f},
-std::array<float,2>{0.973221838f, 0.61166966f},
-std::array<float,2>{0.471323401f, 0.651044011f},
-std::array<float,2>{0.79531461f, 0.141870216f},
-std::array<float,2>{0.0155078005f, 0.360240221f},
-std::array<float,2>{0.595739782f, 0.998693705f},
-std::array<float,2>{0.341410428f, 0.918789208f},
-std::array<float,2>{0.912693381f, 0.289605707f},
-std::array<float,2>{0.151111215f, 0.248791546f},
-std::array<float,2>{0.686689019f, 0.722775996f},
-std::array<float,2>{0.0869390219f, 0.510287225f},
-std::array<float,2>{0.561753631f, 0.0806002542f},
-std::array<float,2>{0.384237409f, 0.409146369f},
-std::array<float,2>{0.828489244f, 0.766317248f},
-std::array<float,2>{0.12287049f, 0.754391313f},
-std::array<float,2>{0.507956088f, 0.424274921f},
-std::array<float,2>{0.422612101f, 0.0728115141f},
-std::array<float,2>{0.850848734f, 0.526536822f},
-std::array<float,2>{0.374214023f, 0.747141659f},
-std::array<float,2>{0.892089903f, 0.233718947f},
-std::array<float,2>{0.162652284f, 0.305286229f},
-std::array<float,2>{0.644804597f, 0.935101986f},
-std::array<float,2>{0.461896062f, 0.981562793f},
-std::array<float,2>{0.758801281f, 0.358687639f},
-std::array<float,2>{0.0465443954f, 0.129828677f},
-std::array<float,2>{0.578161657f, 0.625966251f},
-std::array<float,2>{0.197937384f, 0.59762311f},
-std::array<float,2>{0.719435871f, 0.0182740632f},
-std::array<float,2>{0.274433166f, 0.466182292f},
-std::array<float,2>{0.954741597f, 0.8413589f},
-std::array<float,2>{0.134483337f, 0.88459605f},
-std::array<float,2>{0.664502978f, 0.264740765f},
-std::array<float,2>{0.313967019f, 0.218393728f},
-std::array<float,2>{0.922251523f, 0.692327321f},
-std::array<float,2>{0.392608136f, 0.534529626f},
-std::array<float,2>{0.827304661f, 0.123370007f},
-std::array<float,2>{0.0734313503f, 0.397289485f},
-std::array<float,2>{0.534789324f, 0.802059829f},
-std::array<float,2>{0.291738451f, 0.863957942f},
-std::array<float,2>{0.988060772f, 0.473115355f},
-std::array<float,2>{0.232722849f, 0.0354033411f},
-std::array<float,2>{0.712009132f, 0.572202027f},
-std::array<float,2>{0.025928881f, 0.664683759f},
-std::array<float,2>{0.612606943f, 0.184941068f},
-std::array<float,2>{0.499998689f, 0.340472639f},
-std::array<float,2>{0.801540673f, 0.965103924f},
-std::array<float,2>{0.0698359385f, 0.926900268f},
-std::array<float,2>{0.544917941f, 0.303482085f},
-std::array<float,2>{0.401694804f, 0.223132759f},
-std::array<float,2>{0.819467902f, 0.736373663f},
-std::array<float,2>{0.320902139f, 0.522868335f},
-std::array<float,2>{0.933908582f, 0.0685982928f},
-std::array<float,2>{0.131758198f, 0.43354854f},
-std::array<float,2>{0.661903501f, 0.758638382f},
-std::array<float,2>{0.489787221f, 0.83259207f},
-std::array<float,2>{0.806647599f, 0.457585573f},
-std::array<float,2>{0.015932804f, 0.027960157f},
-std::array<float,2>{0.622226477f, 0.608253598f},
-std::array<float,2>{0.224159181f, 0.636680365f},
-std::array<float,2>{0.705765128f, 0.134553999f},
-std::array<float,2>{0.285494953f, 0.348033279f},
-std::array<float,2>{0.998995602f, 0.972925127f},
-std::array<float,2>{0.164335474f, 0.807633102f},
-std::array<float,2>{0.649106383f, 0.400376737f},
-std::array<float,2>{0.364817351f, 0.113565288f},
-std::array<float,2>{0.899653316f, 0.541122317f},
-std::array<float,2>{0.436986238f, 0.698072672f},
-std::array<float,2>{0.854407012f, 0.203619495f},
-std::array<float,2>{0.116231091f, 0.250722289f},
-std::array<float,2>{0.50102061f, 0.876711667f},
-std::array<float,2>{0.272711307f, 0.960043609f},
-std::array<float,2>{0.968131304f, 0.33537966f},
-std::array<float,2>{0.19305709f, 0.172527224f},
-std::array<float,2>{0.728490353f, 0.661290765f},
-std::array<float,2>{0.031732358f, 0.56512779f},
-std::array<float,2>{0.586471796f, 0.0446095802f},
-std::array<float,2>{0.45686698f, 0.482153565f},
-std::array<float,2>{0.750414431f, 0.874375522f},
-std::array<float,2>{0.00285188598f, 0.848332524f},
-std::array<float,2>{0.60551393f, 0.484725416f},
-std::array<float,2>{0.482163042f, 0.0611519925f},
-std::array<float,2>{0.785131812f, 0.584546804f},
-std::array<float,2>{0.300781012f, 0.676701486f},
-std::array<float,2>{0.983313918f, 0.166332692f},
-std::array<float,2>{0.238348261f, 0.318594933f},
-std::array<float,2>{0.688328385f, 0.938455224f},
-std::array<float,2>{0.380893856f, 0.898566604f},
-std::array<float,2>{0.839744747f, 0.269528091f},
-std::array<float,2>{0.0822825134f, 0.193143725f},
-std::array<float,2>{0.552927017f, 0.716849327f},
-std::array<float,2>{0.144120231f, 0.55881381f},
-std::array<float,2>{0.677096128f, 0.102530569f},
-std::array<float,2>{0.333881885f, 0.375759274f},
-std::array<float,2>{0.914304733f, 0.794793129f},
-std::array<float,2>{0.216953605f, 0.990987301f},
-std::array<float,2>{0.7474913f, 0.367672145f},
-std::array<float,2>{0.264841884f, 0.149368986f},
-std::array<float,2>{0.944593847f, 0.644194007f},
-std::array<float,2>{0.451879233f, 0.622235835f},
-std::array<float,2>{0.775551021f, 0.00195016433f},
-std::array<float,2>{0.0517650619f, 0.437550575f},
-std::array<float,2>{0.574907422f, 0.814100981f},
-std::array<float,2>{0.356047004f, 0.779823005f},
-std::array<float,2>{0.885436356f, 0.416517496f},
-std::array<float,2>{0.179152966f, 0.0882251859f},
-std::array<float,2>{0.629015148f, 0.502291799f},
-std::array<float,2>{0.0975842476f, 0.734323084f},
-std::array<float,2>{0.515989363f, 0.236344635f},
-std::array<float,2>{0.417729497f, 0.2882469f},
-std::array<float,2>{0.864723086f, 0.906941473f},
-std::array<float,2>{0.0375118442f, 0.915783405f},
-std::array<float,2>{0.590657055f, 0.296035469f},
-std::array<float,2>{0.460893929f, 0.242420897f},
-std::array<float,2>{0.75462985f, 0.720694542f},
-std::array<float,2>{0.267087281f, 0.515545547f},
-std::array<float,2>{0.964087248f, 0.0839434639f},
-std::array<float,2>{0.190640271f, 0.413629144f},
-std::array<float,2>{0.731973946f, 0.769611537f},
-std::array<float,2>{0.429956317f, 0.824887156f},
-std::array<float,2>{0.85775274f, 0.451392084f},
-std::array<float,2>{0.112501211f, 0.0119308634f},
-std::array<float,2>{0.506251335f, 0.616703093f},
-std::array<float,2>{0.169296369f, 0.654054463f},
-std::array<float,2>{0.653968811f, 0.145068839f},
-std::array<float,2>{0.360482365f, 0.364891708f},
-std::array<float,2>{0.902717352f, 0.993124425f},
-std::array<float,2>{0.222454205f, 0.783508301f},
-std::array<float,2>{0.709897339f, 0.385350496f},
-std::array<float,2>{0.285102308f, 0.0951605812f},
-std::array<float,2>{0.995421946f, 0.553728044f},
-std::array<float,2>{0.487775058f, 0.704270363f},
-std::array<float,2>{0.811685026f, 0.196106523f},
-std::array<float,2>{0.0232654829f, 0.28084141f},
-std::array<float,2>{0.617870748f, 0.890843153f},
-std::array<float,2>{0.324835062f, 0.945882738f},
-std::array<float,2>{0.933127165f, 0.32037136f},
-std::array<float,2>{0.128050134f, 0.162364334f},
-std::array<float,2>{0.659797251f, 0.683302104f},
-std::array<float,2>{0.0630167276f, 0.587720215f},
-std::array<float,2>{0.540215552f, 0.0484369136f},
-std::array<float,2>{0.404120624f, 0.498585433f},
-std::array<float,2>{0.815713584f, 0.854654133f},
-std::array<float,2>{0.0979777575f, 0.860719979f},
-std::array<float,2>{0.523289144f, 0.469750911f},
-std::array<float,2>{0.418010145f, 0.0325636379f},
-std::array<float,2>{0.860596657f, 0.577587724f},
-std::array<float,2>{0.351943225f, 0.668801904f},
-std::array<float,2>{0.889951587f, 0.182054028f},
-std::array<float,2>{0.173150167f, 0.339584291f},
-std::array<float,2>{0.6286726f, 0.963046014f},
-std::array<float,2>{0.447654337f, 0.887794852f},
-std::array<float,2>{0.78105408f, 0.259800166f},
-std::array<float,2>{0.0487566404f, 0.2112782f},
-std::array<float,2>{0.573824346f, 0.691369236f},
-std::array<float,2>{0.211597592f, 0.538049698f},
-std::array<float,2>{0.745488882f, 0.1191452f},
-std::array<float,2>{0.259416968f, 0.391321808f},
-std::array<float,2>{0.939304113f, 0.797516465f},
-std::array<float,2>{0.145026177f, 0.976888776f},
-std::array<float,2>{0.673044384f, 0.35342437f},
-std::array<float,2>{0.331178576f, 0.12572521f},
-std::array<float,2>{0.918951452f, 0.632091165f},
-std::array<float,2>{0.375843316f, 0.59784776f},
-std::array<float,2>{0.843501627f, 0.0200223569f},
-std::array<float,2>{0.0781954378f, 0.464062482f},
-std::array<float,2>{0.55045712f, 0.839131892f},
-std::array<float,2>{0.301013619f, 0.752575874f},
-std::array<float,2>{0.977999032f, 0.428752542f},
-std::array<float,2>{0.236206725f, 0.0760762021f},
-std::array<float,2>{0.692866087f, 0.529354274f},
-std::array<float,2>{0.00519647542f, 0.745409548f},
-std::array<float,2>{0.604818285f, 0.228884295f},
-std::array<float,2>{0.477240562f, 0.309707254f},
-std::array<float,2>{0.787011147f, 0.931753993f},
-std::array<float,2>{0.0936769843f, 0.954507113f},
-std::array<float,2>{0.55710274f, 0.32922262f},
-std::array<float,2>{0.389237195f, 0.177790374f},
-std::array<float,2>{0.834542751f, 0.659401834f},
-std::array<float,2>{0.338342369f, 0.567443728f},
-std::array<float,2>{0.907544792f, 0.0417684056f},
-std::array<float,2>{0.155428916f, 0.477534801f},
-std::array<float,2>{0.679709971f, 0.870918989f},
-std::array<float,2>{0.475362122f, 0.809513092f},
-std::array<float,2>{0.790886104f, 0.402416319f},
-std::array<float,2>{0.00968057103f, 0.112926044f},
-std::array<float,2>{0.597816229f, 0.546444297f},
-std::array<float,2>{0.242431372f, 0.69922328f},
-std::array<float,2>{0.70116055f, 0.209391207f},
-std::array<float,2>{0.308931202f, 0.256802171f},
-std::array<float,2>{0.972421467f, 0.881291509f},
-std::array<float,2>{0.180315435f, 0.831433594f},
-std::array<float,2>{0.636061251f, 0.454494089f},
-std::array<float,2>{0.351350546f, 0.0242292937f},
-std::array<float,2>{0.882145405f, 0.602837563f},
-std::array<float,2>{0.410412252f, 0.638819396f},
-std::array<float,2>{0.86948806f, 0.140183121f},
-std::array<float,2>{0.108043619f, 0.344660312f},
-std::array<float,2>{0.529443204f, 0.971922517f},
-std::array<float,2>{0.250946015f, 0.923049808f},
-std::array<float,2>{0.951853812f, 0.29952246f},
-std::array<float,2>{0.21049431f, 0.219097748f},
-std::array<float,2>{0.741339266f, 0.738724589f},
-std::array<float,2>{0.0616901293f, 0.519394934f},
-std::array<float,2>{0.565535784f, 0.0661223233f},
-std::array<float,2>{0.438304514f, 0.434451491f},
-std::array<float,2>{0.773053586f, 0.76382941f},
-std::array<float,2>{0.0307731163f, 0.776507139f},
-std::array<float,2>{0.613575876f, 0.418152153f},
-std::array<float,2>{0.494496852f, 0.0903811231f},
-std::array<float,2>{0.79913944f, 0.506972492f},
-std::array<float,2>{0.294475257f, 0.727844715f},
-std::array<float,2>{0.990306675f, 0.241340399f},
-std::array<float,2>{0.228825644f, 0.282742977f},
-std::array<float,2>{0.71613282f, 0.913926005f},
-std::array<float,2>{0.397696257f, 0.986601532f},
-std::array<float,2>{0.82348758f, 0.371177763f},
-std::array<float,2>{0.0769962892f, 0.153506443f},
-std::array<float,2>{0.536203146f, 0.646345258f},
-std::array<float,2>{0.140068308f, 0.617565334f},
-std::array<float,2>{0.668531418f, 0.00648872368f},
-std::array<float,2>{0.319530427f, 0.441788316f},
-std::array<float,2>{0.929658234f, 0.818726599f},
-std::array<float,2>{0.2004309f, 0.904266477f},
-std::array<float,2>{0.722666383f, 0.270851195f},
-std::array<float,2>{0.279073864f, 0.191165894f},
-std::array<float,2>{0.959777594f, 0.713423073f},
-std::array<float,2>{0.468390882f, 0.556254506f},
-std::array<float,2>{0.764732659f, 0.106473222f},
-std::array<float,2>{0.0401596725f, 0.381773293f},
-std::array<float,2>{0.584040225f, 0.791335583f},
-std::array<float,2>{0.369134635f, 0.845388293f},
-std::array<float,2>{0.894709647f, 0.489542782f},
-std::array<float,2>{0.159039214f, 0.0582571179f},
-std::array<float,2>{0.640739083f, 0.579342604f},
-std::array<float,2>{0.117284968f, 0.674205363f},
-std::array<float,2>{0.515598893f, 0.169202998f},
-std::array<float,2>{0.427095622f, 0.314074993f},
-std::array<float,2>{0.846668661f, 0.943964958f},
-std::array<float,2>{0.0118443472f, 0.997109056f},
-std::array<float,2>{0.594541073f, 0.362721145f},
-std::array<float,2>{0.470336258f, 0.144213781f},
-std::array<float,2>{0.794073761f, 0.649959385f},
-std::array<float,2>{0.307753026f, 0.610923946f},
-std::array<float,2>{0.976215065f, 0.0110891666f},
-std::array<float,2>{0.247491583f, 0.446213961f},
-std::array<float,2>{0.696740985f, 0.821086586f},
-std::array<float,2>{0.384766012f, 0.767731369f},
-std::array<float,2>{0.830930412f, 0.406581312f},
-std::array<float,2>{0.0894345045f, 0.0781657025f},
-std::array<float,2>{0.559717953f, 0.508960545f},
-std::array<float,2>{0.149711221f, 0.725745916f},
-std::array<float,2>{0.683928251f, 0.246863946f},
-std::array<float,2>{0.342840731f, 0.292113453f},
-std::array<float,2>{0.911790609f, 0.920261621f},
-std::array<float,2>{0.206866294f, 0.859008014f},
-std::array<float,2>{0.738183498f, 0.493326873f},
-std::array<float,2>{0.256952733f, 0.0520554036f},
-std::array<float,2>{0.947389245f, 0.591634333f},
-std::array<float,2>{0.443747699f, 0.686031222f},
-std::array<float,2>{0.76836431f, 0.156679288f},
-std::array<float,2>{0.0561639033f, 0.325584739f},
-std::array<float,2>{0.566865385f, 0.949958324f},
-std::array<float,2>{0.343817741f, 0.895601571f},
-std::array<float,2>{0.877576947f, 0.274537414f},
-std::array<float,2>{0.186289862f, 0.201831922f},
-std::array<float,2>{0.640550315f, 0.707753897f},
-std::array<float,2>{0.103782743f, 0.548929214f},
-std::array<float,2>{0.523881078f, 0.0999119431f},
-std::array<float,2>{0.406281263f, 0.390624762f},
-std::array<float,2>{0.874377668f, 0.7878986f},
-std::array<float,2>{0.0707892105f, 0.804196f},
-std::array<float,2>{0.532678366f, 0.396166325f},
-std::array<float,2>{0.391881108f, 0.121411353f},
-std::array<float,2>{0.824789166f, 0.531292737f},
-std::array<float,2>{0.315850794f, 0.693372488f},
-std::array<float,2>{0.924632013f, 0.215031162f},
-std::array<float,2>{0.135256752f, 0.262250006f},
-std::array<float,2>{0.667565823f, 0.885616362f},
-std::array<float,2>{0.49724111f, 0.968088329f},
-std::array<float,2>{0.8031739f, 0.341873765f},
-std::array<float,2>{0.0238156226f, 0.186600089f},
-std::array<float,2>{0.610096455f, 0.666761458f},
-std::array<float,2>{0.231897727f, 0.572321236f},
-std::array<float,2>{0.713970244f, 0.0377238058f},
-std::array<float,2>{0.289710402f, 0.474850714f},
-std::array<float,2>{0.985893726f, 0.866596222f},
-std::array<float,2>{0.160687864f, 0.937498331f},
-std::array<float,2>{0.6474666f, 0.306966513f},
-std::array<float,2>{0.371109694f, 0.231435016f},
-std::array<float,2>{0.894396305f, 0.749425292f},
-std::array<float,2>{0.424862146f, 0.524903893f},
-std::array<float,2>{0.849242449f, 0.0720605776f},
-std::array<float,2>{0.123439729f, 0.421981156f},
-std::array<float,2>{0.510509372f, 0.756918371f},
-std::array<float,2>{0.277038157f, 0.842852652f},
-std::array<float,2>{0.955966353f, 0.467166185f},
-std::array<float,2>{0.195567518f, 0.0156359952f},
-std::array<float,2>{0.722514927f, 0.594482005f},
-std::array<float,2>{0.0439307392f, 0.62773335f},
-std::array<float,2>{0.581109405f, 0.131945103f},
-std::array<float,2>{0.463318139f, 0.357149184f},
-std::array<float,2>{0.760149121f, 0.982684493f},
-std::array<float,2>{0.114991792f, 0.878686428f},
-std::array<float,2>{0.50302422f, 0.253896922f},
-std::array<float,2>{0.434432566f, 0.205400512f},
-std::array<float,2>{0.853190303f, 0.697069228f},
-std::array<float,2>{0.36710766f, 0.540232241f},
-std::array<float,2>{0.901114404f, 0.116959944f},
-std::array<float,2>{0.167327777f, 0.401467383f},
-std::array<float,2>{0.650575697f, 0.805689275f},
-std::array<float,2>{0.453887254f, 0.871512711f},
-std::array<float,2>{0.752168715f, 0.483468622f},
-std::array<float,2>{0.0347335152f, 0.0461323597f},
-std::array<float,2>{0.589006841f, 0.562596321f},
-std::array<float,2>{0.19339785f, 0.662254572f},
-std::array<float,2>{0.729790866f, 0.175523862f},
-std::array<float,2>{0.271267474f, 0.333174258f},
-std::array<float,2>{0.965282619f, 0.957437694f},
-std::array<float,2>{0.13010101f, 0.760174274f},
-std::array<float,2>{0.663184345f, 0.431572169f},
-std::array<float,2>{0.322365165f, 0.0680471137f},
-std::array<float,2>{0.937343299f, 0.521336555f},
-std::array<float,2>{0.40017727f, 0.736020982f},
-std::array<float,2>{0.817214906f, 0.224699676f},
-std::array<float,2>{0.0665026605f, 0.301258296f},
-std::array<float,2>{0.544991612f, 0.929041684f},
-std::array<float,2>{0.288559824f, 0.974910855f},
-std::array<float,2>{0.997336805f, 0.350652039f},
-std::array<float,2>{0.224989384f, 0.13577874f},
-std::array<float,2>{0.704834938f, 0.634017766f},
-std::array<float,2>{0.0190018453f, 0.606962502f},
-std::array<float,2>{0.624189138f, 0.030338807f},
-std::array<float,2>{0.491203129f, 0.460246056f},
-std::array<float,2>{0.806394696f, 0.834827006f},
-std::array<float,2>{0.0538448468f, 0.815904379f},
-std::array<float,2>{0.576770544f, 0.440447211f},
-std::array<float,2>{0.449387997f, 0.00305319251f},
-std::array<float,2>{0.77516681f, 0.623089194f},
-std::array<float,2>{0.26257363f, 0.642299891f},
-std::array<float,2>{0.941680789f, 0.151412353f},
-std::array<float,2>{0.215296745f, 0.370189071f},
-std::array<float,2>{0.748300791f, 0.988610864f},
-std::array<float,2>{0.414438456f, 0.908747077f},
-std::array<float,2>{0.866877496f, 0.286444128f},
-std::array<float,2>{0.0939102173f, 0.235204384f},
-std::array<float,2>{0.519329965f, 0.730537355f},
-std::array<float,2>{0.17592831f, 0.500383914f},
-std::array<float,2>{0.631941915f, 0.0877684802f},
-std::array<float,2>{0.358520091f, 0.415747941f},
-std::array<float,2>{0.882975578f, 0.777985215f},
-std::array<float,2>{0.242181346f, 0.941086292f},
-std::array<float,2>{0.689958692f, 0.316788018f},
-std::array<float,2>{0.297561616f, 0.164372414f},
-std::array<float,2>{0.981200695f, 0.679250181f},
-std::array<float,2>{0.482893378f, 0.583968937f},
-std::array<float,2>{0.781508386f, 0.0596842058f},
-std::array<float,2>{0.00165593298f, 0.487713069f},
-std::array<float,2>{0.607803702f, 0.851244271f},
-std::array<float,2>{0.335001975f, 0.795222282f},
-std::array<float,2>{0.917956233f, 0.377893448f},
-std::array<float,2>{0.140740737f, 0.104192153f},
-std::array<float,2>{0.67964083f, 0.561040163f},
-std::array<float,2>{0.0854918808f, 0.716002107f},
-std::array<float,2>{0.550985336f, 0.194756135f},
-std::array<float,2>{0.379435301f, 0.266828954f},
-std::array<float,2>{0.836839139f, 0.900630295f},
-std::array<float,2>{0.00657278858f, 0.933038533f},
-std::array<float,2>{0.602557898f, 0.309352666f},
-std::array<float,2>{0.479757547f, 0.229586601f},
-std::array<float,2>{0.787416995f, 0.745006025f},
-std::array<float,2>{0.303783029f, 0.531084895f},
-std::array<float,2>{0.979996383f, 0.0748169273f},
-std::array<float,2>{0.236529946f, 0.428014427f},
-std::array<float,2>{0.69409734f, 0.753091931f},
-std::array<float,2>{0.377861917f, 0.838265598f},
-std::array<float,2>{0.841173828f, 0.463244021f},
-std::array<float,2>{0.0816259012f, 0.0212423522f},
-std::array<float,2>{0.547553539f, 0.599364042f},
-std::array<float,2>{0.148262545f, 0.631414354f},
-std::array<float,2>{0.675665081f, 0.126314372f},
-std::array<float,2>{0.328382999f, 0.352532864f},
-std::array<float,2>{0.920908749f, 0.97847265f},
-std::array<float,2>{0.214379027f, 0.79874897f},
-std::array<float,2>{0.74332422f, 0.392228395f},
-std::array<float,2>{0.26123035f, 0.120863304f},
-std::array<float,2>{0.940612495f, 0.538564444f},
-std::array<float,2>{0.447119325f, 0.690158069f},
-std::array<float,2>{0.777906239f, 0.211927399f},
-std::array<float,2>{0.0489271209f, 0.260800809f},
-std::array<float,2>{0.571417928f, 0.887322307f},
-std::array<float,2>{0.354574412f, 0.964797795f},
-std::array<float,2>{0.887828529f, 0.338197172f},
-std::array<float,2>{0.174236193f, 0.183034614f},
-std::array<float,2>{0.625397623f, 0.669713914f},
-std::array<float,2>{0.10098803f, 0.576186657f},
-std::array<float,2>{0.521140516f, 0.0321408957f},
-std::array<float,2>{0.420190096f, 0.469170392f},
-std::array<float,2>{0.862821639f, 0.860042453f},
-std::array<float,2>{0.0656650886f, 0.853786886f},
-std::array<float,2>{0.542567432f, 0.499582171f},
-std::array<float,2>{0.406031728f, 0.0468815416f},
-std::array<float,2>{0.814286411f, 0.586692095f},
-std::array<float,2>{0.32720986f, 0.681671143f},
-std::array<float,2>{0.93114078f, 0.163374111f},
-std::array<float,2>{0.125846535f, 0.322179675f},
-std::array<float,2>{0.657702684f, 0.946357608f},
-std::array<float,2>{0.486077815f, 0.892183125f},
-std::array<float,2>{0.810091197f, 0.27974391f},
-std::array<float,2>{0.0214441791f, 0.197073996f},
-std::array<float,2>{0.61966449f, 0.70324111f},
-std::array<float,2>{0.219194844f, 0.552858114f},
-std::array<float,2>{0.707284033f, 0.0944787636f},
-std::array<float,2>{0.28252846f, 0.386116564f},
-std::array<float,2>{0.993330181f, 0.784308374f},
-std::array<float,2>{0.171182871f, 0.994071066f},
-std::array<float,2>{0.655249357f, 0.363526165f},
-std::array<float,2>{0.362618744f, 0.146480918f},
-std::array<float,2>{0.906071663f, 0.652734637f},
-std::array<float,2>{0.432780147f, 0.615237713f},
-std::array<float,2>{0.857181728f, 0.0129863732f},
-std::array<float,2>{0.110345691f, 0.452729017f},
-std::array<float,2>{0.503929198f, 0.825573683f},
-std::array<float,2>{0.268232822f, 0.770835757f},
-std::array<float,2>{0.961102903f, 0.412585765f},
-std::array<float,2>{0.188130096f, 0.0826645941f},
-std::array<float,2>{0.734023809f, 0.513898015f},
-std::array<float,2>{0.035388235f, 0.719617903f},
-std::array<float,2>{0.593260109f, 0.24334082f},
-std::array<float,2>{0.458302408f, 0.29548195f},
-std::array<float,2>{0.757197022f, 0.914992332f},
-std::array<float,2>{0.119772486f, 0.945241451f},
-std::array<float,2>{0.512761295f, 0.313215792f},
-std::array<float,2>{0.42930299f, 0.168564871f},
-std::array<float,2>{0.844065905f, 0.675144553f},
-std::array<float,2>{0.370924115f, 0.578851521f},
-std::array<float,2>{0.896628201f, 0.0567179993f},
-std::array<float,2>{0.157327831f, 0.488608062f},
-std::array<float,2>{0.642722368f, 0.844309509f},
-std::array<float,2>{0.466718286f, 0.792502046f},
-std::array<float,2>{0.762316465f, 0.382041425f},
-std::array<float,2>{0.0412697531f, 0.105802938f},
-std::array<float,2>{0.583613396f, 0.555442154f},
-std::array<float,2>{0.201736435f, 0.714049459f},
-std::array<float,2>{0.725730956f, 0.189561829f},
-std::array<float,2>{0.281043559f, 0.269876003f},
-std::array<float,2>{0.958898127f, 0.903137326f},
-std::array<float,2>{0.138203517f, 0.819880068f},
-std::array<float,2>{0.670782387f, 0.442803264f},
-std::array<float,2>{0.317354828f, 0.00773017807f},
-std::array<float,2>{0.927652776f, 0.61849314f},
-std::array<float,2>{0.394659191f, 0.645151377f},
-std::array<float,2>{0.820380926f, 0.153087452f},
-std::array<float,2>{0.0758974627f, 0.372493565f},
-std::array<float,2>{0.538199663f, 0.988102674f},
-std::array<float,2>{0.296240687f, 0.912130356f},
-std::array<float,2>{0.989635766f, 0.281301737f},
-std::array<float,2>{0.227160007f, 0.241024405f},
-std::array<float,2>{0.717514098f, 0.726803124f},
-std::array<float,2>{0.0275715217f, 0.506771207f},
-std::array<float,2>{0.616054833f, 0.0911994576f},
-std::array<float,2>{0.493326455f, 0.419460267f},
-std::array<float,2>{0.797459185f, 0.775850296f},
-std::array<float,2>{0.0588991828f, 0.765151262f},
-std::array<float,2>{0.562694788f, 0.435502231f},
-std::array<float,2>{0.439712435f, 0.0652388409f},
-std::array<float,2>{0.76968807f, 0.517625809f},
-std::array<float,2>{0.252616674f, 0.739588261f},
-std::array<float,2>{0.95055145f, 0.219864354f},
-std::array<float,2>{0.208544672f, 0.299934417f},
-std::array<float,2>{0.73839283f, 0.921925604f},
-std::array<float,2>{0.412613094f, 0.97131741f},
-std::array<float,2>{0.867746234f, 0.345219731f},
-std::array<float,2>{0.107239023f, 0.139548391f},
-std::array<float,2>{0.528754473f, 0.639822602f},
-std::array<float,2>{0.183468282f, 0.602261424f},
-std::array<float,2>{0.63398838f, 0.0248841755f},
-std::array<float,2>{0.349274963f, 0.453997433f},
-std::array<float,2>{0.880472004f, 0.83071965f},
-std::array<float,2>{0.244155675f, 0.881844401f},
-std::array<float,2>{0.701745331f, 0.257087618f},
-std::array<float,2>{0.311540186f, 0.210034639f},
-std::array<float,2>{0.969716907f, 0.700413942f},
-std::array<float,2>{0.474252671f, 0.545662582f},
-std::array<float,2>{0.791965544f, 0.111891001f},
-std::array<float,2>{0.0111499876f, 0.403952271f},
-std::array<float,2>{0.59962672f, 0.810428202f},
-std::array<float,2>{0.337417722f, 0.869610667f},
-std::array<float,2>{0.910119534f, 0.478385776f},
-std::array<float,2>{0.15303275f, 0.0420457236f},
-std::array<float,2>{0.682512462f, 0.566640258f},
-std::array<float,2>{0.0913098752f, 0.659095824f},
-std::array<float,2>{0.555313647f, 0.179535747f},
-std::array<float,2>{0.38711673f, 0.329047978f},
-std::array<float,2>{0.832722723f, 0.953546107f},
-std::array<float,2>{0.0454860106f, 0.983808279f},
-std::array<float,2>{0.579927206f, 0.355695039f},
-std::array<float,2>{0.46288991f, 0.131802455f},
-std::array<float,2>{0.758313417f, 0.628315151f},
-std::array<float,2>{0.273541451f, 0.595186353f},
-std::array<float,2>{0.953974545f, 0.0167017225f},
-std::array<float,2>{0.198596284f, 0.467811018f},
-std::array<float,2>{0.720265329f, 0.84252429f},
-std::array<float,2>{0.42338708f, 0.756766081f},
-std::array<float,2>{0.849622071f, 0.423412025f},
-std::array<float,2>{0.121817619f, 0.0708987638f},
-std::array<float,2>{0.5089463f, 0.523655236f},
-std::array<float,2>{0.163616017f, 0.748138726f},
-std::array<float,2>{0.6455369f, 0.231834412f},
-std::array<float,2>{0.373653144f, 0.308486074f},
-std::array<float,2>{0.891442001f, 0.935978115f},
-std::array<float,2>{0.234302536f, 0.865803659f},
-std::array<float,2>{0.711326361f, 0.475926161f},
-std::array<float,2>{0.292913705f, 0.0389484577f},
-std::array<float,2>{0.986395359f, 0.573857009f},
-std::array<float,2>{0.498267353f, 0.667176783f},
-std::array<float,2>{0.802711964f, 0.186506316f},
-std::array<float,2>{0.0270517711f, 0.343154818f},
-std::array<float,2>{0.611390889f, 0.967189968f},
-std::array<float,2>{0.312905729f, 0.885914326f},
-std::array<float,2>{0.923605204f, 0.263069957f},
-std::array<float,2>{0.133657262f, 0.216708437f},
-std::array<float,2>{0.665769398f, 0.695219338f},
-std::array<float,2>{0.0726436004f, 0.532568216f},
-std::array<float,2>{0.534140527f, 0.122152567f},
-std::array<float,2>{0.394084364f, 0.395488977f},
-std::array<float,2>{0.826784194f, 0.803298473f},
-std::array<float,2>{0.102120847f, 0.788413286f},
-std::array<float,2>{0.525951087f, 0.389332741f},
-std::array<float,2>{0.408324778f, 0.10104461f},
-std::array<float,2>{0.872507572f, 0.5506953f},
-std::array<float,2>{0.346271485f, 0.708951473f},
-std::array<float,2>{0.875004172f, 0.202528983f},
-std::array<float,2>{0.183798566f, 0.273446649f},
-std::array<float,2>{0.637748778f, 0.895400643f},
-std::array<float,2>{0.441529423f, 0.950663328f},
-std::array<float,2>{0.766840577f, 0.324377984f},
-std::array<float,2>{0.0581821203f, 0.157426625f},
-std::array<float,2>{0.56920439f, 0.686877012f},
-std::array<float,2>{0.203467414f, 0.59003979f},
-std::array<float,2>{0.734906375f, 0.0510478094f},
-std::array<float,2>{0.254482716f, 0.492401004f},
-std::array<float,2>{0.945984066f, 0.857834756f},
-std::array<float,2>{0.15215084f, 0.921298206f},
-std::array<float,2>{0.686410666f, 0.29172796f},
-std::array<float,2>{0.340752155f, 0.247083858f},
-std::array<float,2>{0.913242459f, 0.724658549f},
-std::array<float,2>{0.383162469f, 0.508508682f},
-std::array<float,2>{0.82918644f, 0.0798165053f},
-std::array<float,2>{0.086290203f, 0.407345384f},
-std::array<float,2>{0.561119854f, 0.769044638f},
-std::array<float,2>{0.305521578f, 0.821623862f},
-std::array<float,2>{0.974421561f, 0.446343243f},
-std::array<float,2>{0.249755755f, 0.0105313025f},
-std::array<float,2>{0.697412133f, 0.609874904f},
-std::array<float,2>{0.0138974646f, 0.648446083f},
-std::array<float,2>{0.596806109f, 0.143489882f},
-std::array<float,2>{0.471681178f, 0.361696422f},
-std::array<float,2>{0.796728969f, 0.996290863f},
-std::array<float,2>{0.0833136737f, 0.901606679f},
-std::array<float,2>{0.553876698f, 0.265796036f},
-std::array<float,2>{0.38221696f, 0.194290549f},
-std::array<float,2>{0.837904394f, 0.715414166f},
-std::array<float,2>{0.332379818f, 0.562456787f},
-std::array<float,2>{0.91595763f, 0.105283476f},
-std::array<float,2>{0.143382385f, 0.378616512f},
-std::array<float,2>{0.675956488f, 0.796245992f},
-std::array<float,2>{0.480480254f, 0.850109935f},
-std::array<float,2>{0.783592343f, 0.486368239f},
-std::array<float,2>{0.0036683185f, 0.0592882559f},
-std::array<float,2>{0.606727302f, 0.582526505f},
-std::array<float,2>{0.240023449f, 0.677735567f},
-std::array<float,2>{0.689164519f, 0.165714562f},
-std::array<float,2>{0.299000889f, 0.31750688f},
-std::array<float,2>{0.984089017f, 0.940031946f},
-std::array<float,2>{0.178226084f, 0.779074132f},
-std::array<float,2>{0.630312026f, 0.414984941f},
-std::array<float,2>{0.357224047f, 0.0864348784f},
-std::array<float,2>{0.886301637f, 0.501600444f},
-std::array<float,2>{0.41615966f, 0.7319839f},
-std::array<float,2>{0.863298893f, 0.235667735f},
-std::array<float,2>{0.0959901512f, 0.28568536f},
-std::array<float,2>{0.517513573f, 0.909225464f},
-std::array<float,2>{0.263795912f, 0.989613414f},
-std::array<float,2>{0.94348222f, 0.369784415f},
-std::array<float,2>{0.217855498f, 0.150684595f},
-std::array<float,2>{0.746542454f, 0.640984118f},
-std::array<float,2>{0.0511992201f, 0.624250352f},
-std::array<float,2>{0.575680375f, 0.00199280819f},
-std::array<float,2>{0.452210397f, 0.440391064f},
-std::array<float,2>{0.776885271f, 0.81483084f},
-std::array<float,2>{0.0172980055f, 0.83579725f},
-std::array<float,2>{0.62191999f, 0.459228426f},
-std::array<float,2>{0.488546401f, 0.0293314494f},
-std::array<float,2>{0.807996988f, 0.606237531f},
-std::array<float,2>{0.286283612f, 0.633219838f},
-std::array<float,2>{0.999561965f, 0.135110125f},
-std::array<float,2>{0.222678423f, 0.350557297f},
-std::array<float,2>{0.706775248f, 0.976185203f},
-std::array<float,2>{0.401323736f, 0.928150713f},
-std::array<float,2>{0.818366647f, 0.302358538f},
-std::array<float,2>{0.0685272738f, 0.22600916f},
-std::array<float,2>{0.543056369f, 0.734717786f},
-std::array<float,2>{0.132507622f, 0.519829273f},
-std::array<float,2>{0.660820186f, 0.0665641055f},
-std::array<float,2>{0.321585178f, 0.430272609f},
-std::array<float,2>{0.935331821f, 0.761484325f},
-std::array<float,2>{0.191835701f, 0.958321154f},
-std::array<float,2>{0.726998031f, 0.332279176f},
-std::array<float,2>{0.272314847f, 0.174637705f},
-std::array<float,2>{0.967216551f, 0.66361022f},
-std::array<float,2>{0.455258578f, 0.563885272f},
-std::array<float,2>{0.751847267f, 0.0452776067f},
-std::array<float,2>{0.032270588f, 0.483283997f},
-std::array<float,2>{0.587338448f, 0.872109473f},
-std::array<float,2>{0.363619298f, 0.805261493f},
-std::array<float,2>{0.898865283f, 0.400902838f},
-std::array<float,2>{0.166000232f, 0.115720592f},
-std::array<float,2>{0.649700582f, 0.539206028f},
-std::array<float,2>{0.115621798f, 0.696149945f},
-std::array<float,2>{0.500653565f, 0.207029939f},
-std::array<float,2>{0.436506957f, 0.252380788f},
-std::array<float,2>{0.854533494f, 0.877037287f},
-std::array<float,2>{0.0474458374f, 0.889224231f},
-std::array<float,2>{0.572580636f, 0.25960061f},
-std::array<float,2>{0.449080139f, 0.214143261f},
-std::array<float,2>{0.77941978f, 0.689014018f},
-std::array<float,2>{0.258079916f, 0.535589635f},
-std::array<float,2>{0.937703967f, 0.118454017f},
-std::array<float,2>{0.212853655f, 0.394040734f},
-std::array<float,2>{0.744254947f, 0.800379992f},
-std::array<float,2>{0.418965816f, 0.86187458f},
-std::array<float,2>{0.859638393f, 0.471016914f},
-std::array<float,2>{0.0988370776f, 0.0351048708f},
-std::array<float,2>{0.522419631f, 0.575506747f},
-std::array<float,2>{0.172817767f, 0.67061305f},
-std::array<float,2>{0.627918899f, 0.180026516f},
-std::array<float,2>{0.353052258f, 0.337180287f},
-std::array<float,2>{0.889413297f, 0.961437404f},
-std::array<float,2>{0.234791026f, 0.750078022f},
-std::array<float,2>{0.692212939f, 0.426272988f},
-std::array<float,2>{0.301872313f, 0.0764371678f},
-std::array<float,2>{0.977487445f, 0.527443647f},
-std::array<float,2>{0.477681726f, 0.744117737f},
-std::array<float,2>{0.785203338f, 0.228360504f},
-std::array<float,2>{0.0044073686f, 0.311637759f},
-std::array<float,2>{0.603954256f, 0.930090308f},
-std::array<float,2>{0.330402642f, 0.979455471f},
-std::array<float,2>{0.918363452f, 0.353556812f},
-std::array<float,2>{0.146460354f, 0.127224267f},
-std::array<float,2>{0.672165215f, 0.629141212f},
-std::array<float,2>{0.0793706775f, 0.600246966f},
-std::array<float,2>{0.549612641f, 0.0224568695f},
-std::array<float,2>{0.375978857f, 0.46267122f},
-std::array<float,2>{0.842314005f, 0.836552203f},
-std::array<float,2>{0.111368515f, 0.827539384f},
-std::array<float,2>{0.507603884f, 0.450257897f},
-std::array<float,2>{0.431393623f, 0.0139238648f},
-std::array<float,2>{0.859156609f, 0.613600194f},
-std::array<float,2>{0.360243857f, 0.654484332f},
-std::array<float,2>{0.903951764f, 0.148157641f},
-std::array<float,2>{0.168781087f, 0.366575718f},
-std::array<float,2>{0.652867794f, 0.994300246f},
-std::array<float,2>{0.459308535f, 0.916089118f},
-std::array<float,2>{0.755505204f, 0.293859869f},
-std::array<float,2>{0.0388070717f, 0.244201764f},
-std::array<float,2>{0.591677725f, 0.721641958f},
-std::array<float,2>{0.189880624f, 0.512042463f},
-std::array<float,2>{0.731285691f, 0.0840243325f},
-std::array<float,2>{0.266425192f, 0.412031233f},
-std::array<float,2>{0.963401437f, 0.77204746f},
-std::array<float,2>{0.127913132f, 0.948652685f},
-std::array<float,2>{0.658261836f, 0.322335452f},
-std::array<float,2>{0.325440347f, 0.161688834f},
-std::array<float,2>{0.931643605f, 0.681507409f},
-std::array<float,2>{0.403015494f, 0.589298487f},
-std::array<float,2>{0.814553678f, 0.0504112877f},
-std::array<float,2>{0.0643882304f, 0.497032404f},
-std::array<float,2>{0.539811075f, 0.851592243f},
-std::array<float,2>{0.283823788f, 0.781980395f},
-std::array<float,2>{0.994192302f, 0.383996218f},
-std::array<float,2>{0.220998868f, 0.0971780047f},
-std::array<float,2>{0.710645556f, 0.552602053f},
-std::array<float,2>{0.0223375373f, 0.706317961f},
-std::array<float,2>{0.618471086f, 0.199040338f},
-std::array<float,2>{0.487274885f, 0.278424203f},
-std::array<float,2>{0.811521232f, 0.894393146f},
-std::array<float,2>{0.0776880905f, 0.985615849f},
-std::array<float,2>{0.535712183f, 0.373824209f},
-std::array<float,2>{0.397424161f, 0.154709771f},
-std::array<float,2>{0.822398186f, 0.648280442f},
-std::array<float,2>{0.318970919f, 0.619210303f},
-std::array<float,2>{0.927886307f, 0.00519166281f},
-std::array<float,2>{0.139638349f, 0.443750292f},
-std::array<float,2>{0.668953657f, 0.81687659f},
-std::array<float,2>{0.495681196f, 0.773850739f},
-std::array<float,2>{0.800385177f, 0.421638042f},
-std::array<float,2>{0.0293472968f, 0.0919308215f},
-std::array<float,2>{0.61451453f, 0.505662382f},
-std::array<float,2>{0.230266318f, 0.730327368f},
-std::array<float,2>{0.715198874f, 0.239670619f},
-std::array<float,2>{0.293094456f, 0.284225702f},
-std::array<float,2>{0.99129343f, 0.910855055f},
-std::array<float,2>{0.159469843f, 0.84635663f},
-std::array<float,2>{0.642176926f, 0.490376562f},
-std::array<float,2>{0.367208779f, 0.0547697283f},
-std::array<float,2>{0.896147668f, 0.58131516f},
-std::array<float,2>{0.426120162f, 0.672252357f},
-std::array<float,2>{0.847231209f, 0.170754328f},
-std::array<float,2>{0.118408523f, 0.316189975f},
-std::array<float,2>{0.513817668f, 0.941674352f},
-std::array<float,2>{0.277517349f, 0.905849636f},
-std::array<float,2>{0.96032393f, 0.273330182f},
-std::array<float,2>{0.199636936f, 0.188337311f},
-std::array<float,2>{0.724293172f, 0.710974574f},
-std::array<float,2>{0.0391611494f, 0.55779022f},
-std::array<float,2>{0.585737824f, 0.109050199f},
-std::array<float,2>{0.466799468f, 0.379358351f},
-std::array<float,2>{0.764290631f, 0.790113032f},
-std::array<float,2>{0.0080428496f, 0.812286794f},
-std::array<float,2>{0.599345088f, 0.405975997f},
-std::array<float,2>{0.475769818f, 0.111040212f},
-std::array<float,2>{0.789970636f, 0.544815183f},
-std::array<float,2>{0.309916288f, 0.701755702f},
-std::array<float,2>{0.970744073f, 0.207292512f},
-std::array<float,2>{0.243553042f, 0.254379034f},
-std::array<float,2>{0.69992286f, 0.880465865f},
-std::array<float,2>{0.389900178f, 0.955539167f},
-std::array<float,2>{0.835048556f, 0.330216408f},
-std::array<float,2>{0.0920855105f, 0.17736353f},
-std::array<float,2>{0.55771327f, 0.656634212f},
-std::array<float,2>{0.15451771f, 0.56943953f},
-std::array<float,2>{0.680895448f, 0.0397007801f},
-std::array<float,2>{0.339155495f, 0.479543f},
-std::array<float,2>{0.907084107f, 0.868662477f},
-std::array<float,2>{0.209014505f, 0.924122155f},
-std::array<float,2>{0.740922451f, 0.29785651f},
-std::array<float,2>{0.251582772f, 0.221468672f},
-std::array<float,2>{0.952487946f, 0.740447581f},
-std::array<float,2>{0.438781172f, 0.516531825f},
-std::array<float,2>{0.771910667f, 0.0638589934f},
-std::array<float,2>{0.0609562062f, 0.437090665f},
-std::array<float,2>{0.564549685f, 0.76236105f},
-std::array<float,2>{0.35021466f, 0.829705775f},
-std::array<float,2>{0.881599963f, 0.456719577f},
-std::array<float,2>{0.18131423f, 0.0273170322f},
-std::array<float,2>{0.634778559f, 0.604516685f},
-std::array<float,2>{0.108776249f, 0.63790977f},
-std::array<float,2>{0.530644774f, 0.138281122f},
-std::array<float,2>{0.41182518f, 0.347099155f},
-std::array<float,2>{0.870260656f, 0.96991998f},
-std::array<float,2>{0.0250698924f, 0.966719806f},
-std::array<float,2>{0.611059844f, 0.341663003f},
-std::array<float,2>{0.496451706f, 0.184132054f},
-std::array<float,2>{0.804119527f, 0.665384352f},
-std::array<float,2>{0.29009518f, 0.570983171f},
-std::array<float,2>{0.98481822f, 0.0364876054f},
-std::array<float,2>{0.231036097f, 0.473760277f},
-std::array<float,2>{0.713755369f, 0.864576101f},
-std::array<float,2>{0.390754431f, 0.801745534f},
-std::array<float,2>{0.826072514f, 0.397972673f},
-std::array<float,2>{0.0715738982f, 0.124721415f},
-std::array<float,2>{0.532148302f, 0.533811033f},
-std::array<float,2>{0.13647005f, 0.692577064f},
-std::array<float,2>{0.666344881f, 0.217722043f},
-std::array<float,2>{0.315080792f, 0.264538825f},
-std::array<float,2>{0.925021827f, 0.883538961f},
-std::array<float,2>{0.196314856f, 0.840381384f},
-std::array<float,2>{0.721045911f, 0.465281963f},
-std::array<float,2>{0.275720388f, 0.0187809132f},
-std::array<float,2>{0.956523955f, 0.596659184f},
-std::array<float,2>{0.464626402f, 0.62681818f},
-std::array<float,2>{0.761354566f, 0.130023256f},
-std::array<float,2>{0.0445163473f, 0.357962966f},
-std::array<float,2>{0.580256402f, 0.981220245f},
-std::array<float,2>{0.372916073f, 0.93360275f},
-std::array<float,2>{0.892777264f, 0.306603402f},
-std::array<float,2>{0.161786407f, 0.232845783f},
-std::array<float,2>{0.647239566f, 0.746685386f},
-std::array<float,2>{0.124425121f, 0.525768578f},
-std::array<float,2>{0.510863483f, 0.0735956579f},
-std::array<float,2>{0.42468071f, 0.425696075f},
-std::array<float,2>{0.84774518f, 0.75540334f},
-std::array<float,2>{0.0882171541f, 0.766770601f},
-std::array<float,2>{0.558828712f, 0.409291625f},
-std::array<float,2>{0.386157662f, 0.0819731206f},
-std::array<float,2>{0.83115232f, 0.511376977f},
-std::array<float,2>{0.341984242f, 0.723705769f},
-std::array<float,2>{0.910814464f, 0.249940008f},
-std::array<float,2>{0.148763791f, 0.290858954f},
-std::array<float,2>{0.684804618f, 0.919759333f},
-std::array<float,2>{0.469702065f, 0.999495208f},
-std::array<float,2>{0.793317616f, 0.361024678f},
-std::array<float,2>{0.0135609563f, 0.140944034f},
-std::array<float,2>{0.594734013f, 0.651607633f},
-std::array<float,2>{0.246213168f, 0.613222837f},
-std::array<float,2>{0.69541806f, 0.00834686123f},
-std::array<float,2>{0.306801856f, 0.448861063f},
-std::array<float,2>{0.975285709f, 0.824075103f},
-std::array<float,2>{0.187324822f, 0.898292542f},
-std::array<float,2>{0.638954103f, 0.276564658f},
-std::array<float,2>{0.344777316f, 0.200668439f},
-std::array<float,2>{0.878063738f, 0.709513009f},
-std::array<float,2>{0.407725006f, 0.546918988f},
-std::array<float,2>{0.873621523f, 0.0978628844f},
-std::array<float,2>{0.105115749f, 0.388264328f},
-std::array<float,2>{0.524873793f, 0.786979973f},
-std::array<float,2>{0.255925f, 0.85618788f},
-std::array<float,2>{0.949169278f, 0.496030182f},
-std::array<float,2>{0.205296412f, 0.0539566763f},
-std::array<float,2>{0.736794472f, 0.592437267f},
-std::array<float,2>{0.0555414222f, 0.685161412f},
-std::array<float,2>{0.567486882f, 0.15930216f},
-std::array<float,2>{0.444904f, 0.326192528f},
-std::array<float,2>{0.768764853f, 0.951358557f},
-std::array<float,2>{0.0950187221f, 0.908069551f},
-std::array<float,2>{0.517835736f, 0.287926257f},
-std::array<float,2>{0.41598019f, 0.237905324f},
-std::array<float,2>{0.86548084f, 0.732515633f},
-std::array<float,2>{0.358189225f, 0.50297302f},
-std::array<float,2>{0.883946061f, 0.0890269205f},
-std::array<float,2>{0.177718416f, 0.417064667f},
-std::array<float,2>{0.631045938f, 0.780923128f},
-std::array<float,2>{0.45090735f, 0.812877893f},
-std::array<float,2>{0.773868859f, 0.439006954f},
-std::array<float,2>{0.0531235673f, 0.000310887466f},
-std::array<float,2>{0.577219129f, 0.621696949f},
-std::array<float,2>{0.216092274f, 0.642811418f},
-std::array<float,2>{0.749077857f, 0.14948909f},
-std::array<float,2>{0.263039142f, 0.368946463f},
-std::array<float,2>{0.943214715f, 0.991488457f},
-std::array<float,2>{0.142261669f, 0.793233395f},
-std::array<float,2>{0.678109765f, 0.37601313f},
-std::array<float,2>{0.334837884f, 0.102662787f},
-std::array<float,2>{0.916662991f, 0.559814453f},
-std::array<float,2>{0.380001992f, 0.718131721f},
-std::array<float,2>{0.837470353f, 0.192201257f},
-std::array<float,2>{0.0844367296f, 0.267688423f},
-std::array<float,2>{0.551771402f, 0.900036573f},
-std::array<float,2>{0.298358113f, 0.938619435f},
-std::array<float,2>{0.982393086f, 0.319636434f},
-std::array<float,2>{0.240756005f, 0.167641461f},
-std::array<float,2>{0.690710366f, 0.67725575f},
-std::array<float,2>{0.000915013603f, 0.58565098f},
-std::array<float,2>{0.608896911f, 0.0624284372f},
-std::array<float,2>{0.483504146f, 0.485715628f},
-std::array<float,2>{0.78237623f, 0.849598408f},
-std::array<float,2>{0.0335252024f, 0.873746097f},
-std::array<float,2>{0.588822961f, 0.481014043f},
-std::array<float,2>{0.454398602f, 0.0430214554f},
-std::array<float,2>{0.753747344f, 0.565879822f},
-std::array<float,2>{0.27025488f, 0.660405159f},
-std::array<float,2>{0.966572881f, 0.173610285f},
-std::array<float,2>{0.19529371f, 0.334181249f},
-std::array<float,2>{0.72895366f, 0.959440231f},
-std::array<float,2>{0.435256839f, 0.8752563f},
-std::array<float,2>{0.8519907f, 0.251709789f},
-std::array<float,2>{0.113481149f, 0.204596758f},
-std::array<float,2>{0.502044857f, 0.69916296f},
-std::array<float,2>{0.166078329f, 0.542528689f},
-std::array<float,2>{0.651939392f, 0.114298202f},
-std::array<float,2>{0.365331173f, 0.39927274f},
-std::array<float,2>{0.901853085f, 0.807482243f},
-std::array<float,2>{0.225755304f, 0.973644257f},
-std::array<float,2>{0.703605115f, 0.349210262f},
-std::array<float,2>{0.28711164f, 0.133298159f},
-std::array<float,2>{0.996228456f, 0.634967387f},
-std::array<float,2>{0.491931468f, 0.609114885f},
-std::array<float,2>{0.805094838f, 0.0286943037f},
-std::array<float,2>{0.0176886469f, 0.458718538f},
-std::array<float,2>{0.623589098f, 0.833972454f},
-std::array<float,2>{0.323459357f, 0.759474576f},
-std::array<float,2>{0.935661197f, 0.431733876f},
-std::array<float,2>{0.129518569f, 0.0699618831f},
-std::array<float,2>{0.6624524f, 0.521662056f},
-std::array<float,2>{0.067743063f, 0.737585723f},
-std::array<float,2>{0.545927644f, 0.224070594f},
-std::array<float,2>{0.398907363f, 0.30456236f},
-std::array<float,2>{0.817981243f, 0.926534951f},
-std::array<float,2>{0.00355095579f, 0.899000704f},
-std::array<float,2>{0.606461883f, 0.268856496f},
-std::array<float,2>{0.480849355f, 0.192639381f},
-std::array<float,2>{0.783299804f, 0.717346966f},
-std::array<float,2>{0.299243063f, 0.559110284f},
-std::array<float,2>{0.984342694f, 0.101953454f},
-std::array<float,2>{0.239780918f, 0.37526834f},
-std::array<float,2>{0.689303398f, 0.794160306f},
-std::array<float,2>{0.3819094f, 0.847698212f},
-std::array<float,2>{0.838306606f, 0.484916836f},
-std::array<float,2>{0.0832416564f, 0.060812261f},
-std::array<float,2>{0.553977072f, 0.584043562f},
-std::array<float,2>{0.143202901f, 0.676193058f},
-std::array<float,2>{0.676183403f, 0.166769981f},
-std::array<float,2>{0.332176715f, 0.319301039f},
-std::array<float,2>{0.915614367f, 0.93777144f},
-std::array<float,2>{0.218159556f, 0.779781699f},
-std::array<float,2>{0.746227562f, 0.416027069f},
-std::array<float,2>{0.264028281f, 0.0888040364f},
-std::array<float,2>{0.943787456f, 0.502784908f},
-std::array<float,2>{0.452399284f, 0.733443737f},
-std::array<float,2>{0.777159274f, 0.237018973f},
-std::array<float,2>{0.0510142818f, 0.288723558f},
-std::array<float,2>{0.575356901f, 0.906255424f},
-std::array<float,2>{0.357040107f, 0.990398467f},
-std::array<float,2>{0.886576533f, 0.367951006f},
-std::array<float,2>{0.178533226f, 0.148866385f},
-std::array<float,2>{0.629903913f, 0.644014418f},
-std::array<float,2>{0.0957274064f, 0.622573137f},
-std::array<float,2>{0.517113328f, 0.000982740661f},
-std::array<float,2>{0.416330129f, 0.438271344f},
-std::array<float,2>{0.863725245f, 0.813839972f},
-std::array<float,2>{0.0686251521f, 0.832444668f},
-std::array<float,2>{0.543331742f, 0.457201093f},
-std::array<float,2>{0.400957584f, 0.0277675614f},
-std::array<float,2>{0.818696499f, 0.6077829f},
-std::array<float,2>{0.321445853f, 0.635914803f},
-std::array<float,2>{0.93529886f, 0.133856863f},
-std::array<float,2>{0.132739574f, 0.348345667f},
-std::array<float,2>{0.660912097f, 0.973254442f},
-std::array<float,2>{0.48835364f, 0.92739439f},
-std::array<float,2>{0.807658255f, 0.303208172f},
-std::array<float,2>{0.0175238997f, 0.223392561f},
-std::array<float,2>{0.621702492f, 0.73686409f},
-std::array<float,2>{0.222941473f, 0.523362577f},
-std::array<float,2>{0.706999779f, 0.0692533031f},
-std::array<float,2>{0.286599725f, 0.432995319f},
-std::array<float,2>{0.99983871f, 0.758108199f},
-std::array<float,2>{0.16570279f, 0.960481346f},
-std::array<float,2>{0.649435461f, 0.335924059f},
-std::array<float,2>{0.363515228f, 0.172007784f},
-std::array<float,2>{0.898590386f, 0.661951602f},
-std::array<float,2>{0.436275423f, 0.564546824f},
-std::array<float,2>{0.854880154f, 0.0442828871f},
-std::array<float,2>{0.115429074f, 0.481928587f},
-std::array<float,2>{0.500787973f, 0.874705374f},
-std::array<float,2>{0.271990359f, 0.808469713f},
-std::array<float,2>{0.966974914f, 0.399777979f},
-std::array<float,2>{0.191459894f, 0.11397513f},
-std::array<float,2>{0.726713359f, 0.541593373f},
-std::array<float,2>{0.0325954743f, 0.697534919f},
-std::array<float,2>{0.587054431f, 0.203475788f},
-std::array<float,2>{0.455539763f, 0.250457823f},
-std::array<float,2>{0.751526356f, 0.876156569f},
-std::array<float,2>{0.121914834f, 0.98211211f},
-std::array<float,2>{0.509210467f, 0.359125674f},
-std::array<float,2>{0.423764437f, 0.12892063f},
-std::array<float,2>{0.849948227f, 0.625313401f},
-std::array<float,2>{0.373907745f, 0.59677124f},
-std::array<float,2>{0.891323626f, 0.0176865589f},
-std::array<float,2>{0.163940012f, 0.466775119f},
-std::array<float,2>{0.645813107f, 0.840924203f},
-std::array<float,2>{0.462569296f, 0.754463315f},
-std::array<float,2>{0.758707166f, 0.424697608f},
-std::array<float,2>{0.0456762724f, 0.0726002827f},
-std::array<float,2>{0.579612494f, 0.527121425f},
-std::array<float,2>{0.198332652f, 0.747731507f},
-std::array<float,2>{0.720462263f, 0.234281659f},
-std::array<float,2>{0.273850769f, 0.30514273f},
-std::array<float,2>{0.953764796f, 0.934909701f},
-std::array<float,2>{0.133508667f, 0.863716006f},
-std::array<float,2>{0.665980339f, 0.473612279f},
-std::array<float,2>{0.31268993f, 0.0357810557f},
-std::array<float,2>{0.923382521f, 0.571470857f},
-std::array<float,2>{0.394495487f, 0.664127886f},
-std::array<float,2>{0.827049136f, 0.185063496f},
-std::array<float,2>{0.0724360049f, 0.340289444f},
-std::array<float,2>{0.533716321f, 0.965334535f},
-std::array<float,2>{0.292674214f, 0.883887827f},
-std::array<float,2>{0.986582637f, 0.265318394f},
-std::array<float,2>{0.233925343f, 0.218142703f},
-std::array<float,2>{0.710957348f, 0.6914469f},
-std::array<float,2>{0.0272347741f, 0.534692168f},
-std::array<float,2>{0.61171639f, 0.123858087f},
-std::array<float,2>{0.498529494f, 0.396903604f},
-std::array<float,2>{0.802293181f, 0.802614748f},
-std::array<float,2>{0.0584064387f, 0.786115229f},
-std::array<float,2>{0.5688622f, 0.387285113f},
-std::array<float,2>{0.441859126f, 0.0986664817f},
-std::array<float,2>{0.766966164f, 0.548673511f},
-std::array<float,2>{0.254760712f, 0.710935414f},
-std::array<float,2>{0.946140647f, 0.19986482f},
-std::array<float,2>{0.203300953f, 0.27562502f},
-std::array<float,2>{0.735210419f, 0.896600127f},
-std::array<float,2>{0.408497095f, 0.952171922f},
-std::array<float,2>{0.872266769f, 0.327581584f},
-std::array<float,2>{0.102353781f, 0.158248633f},
-std::array<float,2>{0.526207626f, 0.684252441f},
-std::array<float,2>{0.183921084f, 0.592932522f},
-std::array<float,2>{0.637991667f, 0.0528358221f},
-std::array<float,2>{0.346605152f, 0.49440816f},
-std::array<float,2>{0.875356019f, 0.856873393f},
-std::array<float,2>{0.249772191f, 0.918455064f},
-std::array<float,2>{0.697708726f, 0.289502949f},
-std::array<float,2>{0.305408329f, 0.248071119f},
-std::array<float,2>{0.97421205f, 0.723404586f},
-std::array<float,2>{0.471976578f, 0.510247946f},
-std::array<float,2>{0.796583891f, 0.0804752484f},
-std::array<float,2>{0.0141557055f, 0.408616692f},
-std::array<float,2>{0.596968591f, 0.765862286f},
-std::array<float,2>{0.340346962f, 0.822992802f},
-std::array<float,2>{0.913435102f, 0.447427571f},
-std::array<float,2>{0.151929796f, 0.00961295329f},
-std::array<float,2>{0.686152518f, 0.61209321f},
-std::array<float,2>{0.0860999972f, 0.65053457f},
-std::array<float,2>{0.561460733f, 0.142219588f},
-std::array<float,2>{0.382826746f, 0.359799951f},
-std::array<float,2>{0.82938534f, 0.998069406f},
-std::array<float,2>{0.0410322212f, 0.942460239f},
-std::array<float,2>{0.583919048f, 0.31500259f},
-std::array<float,2>{0.466376364f, 0.171661034f},
-std::array<float,2>{0.762605071f, 0.673305213f},
-std::array<float,2>{0.280815363f, 0.580785632f},
-std::array<float,2>{0.958529949f, 0.0556759723f},
-std::array<float,2>{0.202070355f, 0.492167562f},
-std::array<float,2>{0.726023495f, 0.846966147f},
-std::array<float,2>{0.429509878f, 0.789183319f},
-std::array<float,2>{0.843817294f, 0.380127609f},
-std::array<float,2>{0.119921602f, 0.10765411f},
-std::array<float,2>{0.513125479f, 0.557164609f},
-std::array<float,2>{0.157516748f, 0.712101519f},
-std::array<float,2>{0.642828822f, 0.189192802f},
-std::array<float,2>{0.370740592f, 0.271946341f},
-std::array<float,2>{0.896746516f, 0.90463984f},
-std::array<float,2>{0.227313042f, 0.818171024f},
-std::array<float,2>{0.717675626f, 0.445029527f},
-std::array<float,2>{0.296040595f, 0.00485090073f},
-std::array<float,2>{0.989471376f, 0.621090889f},
-std::array<float,2>{0.493462056f, 0.647211552f},
-std::array<float,2>{0.797718465f, 0.156045958f},
-std::array<float,2>{0.0277697314f, 0.37493962f},
-std::array<float,2>{0.615922272f, 0.985170007f},
-std::array<float,2>{0.316940069f, 0.911736488f},
-std::array<float,2>{0.927420557f, 0.283979893f},
-std::array<float,2>{0.138569742f, 0.238785282f},
-std::array<float,2>{0.670420349f, 0.729049325f},
-std::array<float,2>{0.0761346221f, 0.504721463f},
-std::array<float,2>{0.538436651f, 0.0936817676f},
-std::array<float,2>{0.394978642f, 0.420737803f},
-std::array<float,2>{0.820785165f, 0.774446785f},
-std::array<float,2>{0.107045874f, 0.763260007f},
-std::array<float,2>{0.528508902f, 0.435974091f},
-std::array<float,2>{0.412895799f, 0.0625565276f},
-std::array<float,2>{0.867985845f, 0.516967833f},
-std::array<float,2>{0.349439591f, 0.741782188f},
-std::array<float,2>{0.880629659f, 0.22213462f},
-std::array<float,2>{0.183348089f, 0.297310919f},
-std::array<float,2>{0.634134531f, 0.924887538f},
-std::array<float,2>{0.439563245f, 0.968890667f},
-std::array<float,2>{0.769860327f, 0.346574485f},
-std::array<float,2>{0.0586430542f, 0.136970937f},
-std::array<float,2>{0.562974393f, 0.637486935f},
-std::array<float,2>{0.208930939f, 0.604093671f},
-std::array<float,2>{0.738586485f, 0.0254635755f},
-std::array<float,2>{0.252895504f, 0.455731094f},
-std::array<float,2>{0.950248361f, 0.828817308f},
-std::array<float,2>{0.153107211f, 0.879105926f},
-std::array<float,2>{0.682255805f, 0.255267382f},
-std::array<float,2>{0.337807924f, 0.208358914f},
-std::array<float,2>{0.909773767f, 0.702961385f},
-std::array<float,2>{0.386959404f, 0.543822169f},
-std::array<float,2>{0.832831442f, 0.110198013f},
-std::array<float,2>{0.0916495174f, 0.40475291f},
-std::array<float,2>{0.555628002f, 0.81086719f},
-std::array<float,2>{0.31192705f, 0.867787719f},
-std::array<float,2>{0.969304204f, 0.478847682f},
-std::array<float,2>{0.244534343f, 0.0400426202f},
-std::array<float,2>{0.702052832f, 0.568365753f},
-std::array<float,2>{0.0108923791f, 0.657583177f},
-std::array<float,2>{0.599868655f, 0.176235184f},
-std::array<float,2>{0.47439149f, 0.331339121f},
-std::array<float,2>{0.791515291f, 0.95606029f},
-std::array<float,2>{0.081886217f, 0.930881083f},
-std::array<float,2>{0.547810793f, 0.31066072f},
-std::array<float,2>{0.377615869f, 0.22729896f},
-std::array<float,2>{0.840893209f, 0.742475092f},
-std::array<float,2>{0.328196526f, 0.529256284f},
-std::array<float,2>{0.921332598f, 0.0775876641f},
-std::array<float,2>{0.148172334f, 0.427683026f},
-std::array<float,2>{0.675493598f, 0.751922011f},
-std::array<float,2>{0.479563326f, 0.837831378f},
-std::array<float,2>{0.787246168f, 0.461388856f},
-std::array<float,2>{0.00660284795f, 0.0233676769f},
-std::array<float,2>{0.602867484f, 0.601172209f},
-std::array<float,2>{0.236592427f, 0.630216718f},
-std::array<float,2>{0.694050372f, 0.128402188f},
-std::array<float,2>{0.304114491f, 0.355239511f},
-std::array<float,2>{0.980245769f, 0.98017478f},
-std::array<float,2>{0.174039274f, 0.799658775f},
-std::array<float,2>{0.625208676f, 0.393409282f},
-std::array<float,2>{0.35495013f, 0.117344223f},
-std::array<float,2>{0.888175488f, 0.536836505f},
-std::array<float,2>{0.420009643f, 0.687609136f},
-std::array<float,2>{0.863252163f, 0.213469952f},
-std::array<float,2>{0.100664236f, 0.257834703f},
-std::array<float,2>{0.521314621f, 0.890385926f},
-std::array<float,2>{0.260789394f, 0.962165296f},
-std::array<float,2>{0.940745652f, 0.336874604f},
-std::array<float,2>{0.214781389f, 0.181140065f},
-std::array<float,2>{0.7435233f, 0.671739399f},
-std::array<float,2>{0.0491295941f, 0.574987292f},
-std::array<float,2>{0.571680427f, 0.0334201306f},
-std::array<float,2>{0.446965724f, 0.471775264f},
-std::array<float,2>{0.778250992f, 0.863251805f},
-std::array<float,2>{0.0211079083f, 0.853475451f},
-std::array<float,2>{0.619875789f, 0.497579545f},
-std::array<float,2>{0.486121893f, 0.0494436547f},
-std::array<float,2>{0.810503125f, 0.588347435f},
-std::array<float,2>{0.282320648f, 0.680581868f},
-std::array<float,2>{0.99362725f, 0.160418972f},
-std::array<float,2>{0.218915373f, 0.32349062f},
-std::array<float,2>{0.707225621f, 0.947537482f},
-std::array<float,2>{0.405891836f, 0.892649412f},
-std::array<float,2>{0.813971937f, 0.278187811f},
-std::array<float,2>{0.0658235103f, 0.198019624f},
-std::array<float,2>{0.542749882f, 0.705114722f},
-std::array<float,2>{0.125709787f, 0.551305711f},
-std::array<float,2>{0.657444954f, 0.0958058015f},
-std::array<float,2>{0.327534735f, 0.383610249f},
-std::array<float,2>{0.930802047f, 0.783033311f},
-std::array<float,2>{0.188465968f, 0.99537617f},
-std::array<float,2>{0.734258294f, 0.366092473f},
-std::array<float,2>{0.268359333f, 0.146967977f},
-std::array<float,2>{0.961256206f, 0.655799568f},
-std::array<float,2>{0.458099753f, 0.615143836f},
-std::array<float,2>{0.756981432f, 0.0147895729f},
-std::array<float,2>{0.0355842412f, 0.449815273f},
-std::array<float,2>{0.592934847f, 0.82630831f},
-std::array<float,2>{0.362369388f, 0.77270031f},
-std::array<float,2>{0.905819476f, 0.410927236f},
-std::array<float,2>{0.170962423f, 0.0851814672f},
-std::array<float,2>{0.655022144f, 0.513664365f},
-std::array<float,2>{0.110091284f, 0.721732974f},
-std::array<float,2>{0.504287124f, 0.245301664f},
-std::array<float,2>{0.432904065f, 0.294326693f},
-std::array<float,2>{0.856980681f, 0.917228401f},
-std::array<float,2>{0.0528842807f, 0.908682525f},
-std::array<float,2>{0.577491939f, 0.287109047f},
-std::array<float,2>{0.450982392f, 0.23457849f},
-std::array<float,2>{0.773675263f, 0.731001437f},
-std::array<float,2>{0.26278013f, 0.500941694f},
-std::array<float,2>{0.942972243f, 0.0869259536f},
-std::array<float,2>{0.215853691f, 0.41533792f},
-std::array<float,2>{0.749274313f, 0.777537405f},
-std::array<float,2>{0.415557265f, 0.816108346f},
-std::array<float,2>{0.865353942f, 0.441089898f},
-std::array<float,2>{0.094931066f, 0.00354810315f},
-std::array<float,2>{0.517810225f, 0.623666644f},
-std::array<float,2>{0.177370921f, 0.642006695f},
-std::array<float,2>{0.631112576f, 0.15204367f},
-std::array<float,2>{0.357982576f, 0.370781779f},
-std::array<float,2>{0.884184003f, 0.988921344f},
-std::array<float,2>{0.241080865f, 0.795517921f},
-std::array<float,2>{0.690581918f, 0.377069056f},
-std::array<float,2>{0.298603296f, 0.10379263f},
-std::array<float,2>{0.982098341f, 0.560812891f},
-std::array<float,2>{0.483767569f, 0.71671313f},
-std::array<float,2>{0.782705545f, 0.194907144f},
-std::array<float,2>{0.000577977975f, 0.26726532f},
-std::array<float,2>{0.609299779f, 0.901135862f},
-std::array<float,2>{0.334500015f, 0.940816462f},
-std::array<float,2>{0.916811764f, 0.317043871f},
-std::array<float,2>{0.142500266f, 0.164793417f},
-std::array<float,2>{0.677813768f, 0.67907846f},
-std::array<float,2>{0.0842005536f, 0.583342969f},
-std::array<float,2>{0.552195907f, 0.0604852997f},
-std::array<float,2>{0.38033852f, 0.48816359f},
-std::array<float,2>{0.837713242f, 0.851002753f},
-std::array<float,2>{0.11373958f, 0.871609271f},
-std::array<float,2>{0.502262652f, 0.484110713f},
-std::array<float,2>{0.43545413f, 0.0468738489f},
-std::array<float,2>{0.851801157f, 0.563224912f},
-std::array<float,2>{0.365693361f, 0.662989259f},
-std::array<float,2>{0.901453793f, 0.175135419f},
-std::array<float,2>{0.166302964f, 0.333768517f},
-std::array<float,2>{0.652293384f, 0.957938373f},
-std::array<float,2>{0.454322189f, 0.878119051f},
-std::array<float,2>{0.75360471f, 0.253331691f},
-std::array<float,2>{0.0334322974f, 0.205815494f},
-std::array<float,2>{0.588487566f, 0.696546018f},
-std::array<float,2>{0.194903135f, 0.54081583f},
-std::array<float,2>{0.728662431f, 0.116554067f},
-std::array<float,2>{0.270406127f, 0.401996404f},
-std::array<float,2>{0.966482937f, 0.806482852f},
-std::array<float,2>{0.129787222f, 0.975515723f},
-std::array<float,2>{0.662169516f, 0.351344079f},
-std::array<float,2>{0.323674738f, 0.136351541f},
-std::array<float,2>{0.935868263f, 0.634686589f},
-std::array<float,2>{0.39861545f, 0.606486738f},
-std::array<float,2>{0.818220437f, 0.0310744606f},
-std::array<float,2>{0.0676229969f, 0.46071744f},
-std::array<float,2>{0.54625386f, 0.834350407f},
-std::array<float,2>{0.287481338f, 0.760320306f},
-std::array<float,2>{0.996561825f, 0.430884629f},
-std::array<float,2>{0.225917295f, 0.0674524084f},
-std::array<float,2>{0.703329384f, 0.520698786f},
-std::array<float,2>{0.0179175697f, 0.735712707f},
-std::array<float,2>{0.623823464f, 0.225503355f},
-std::array<float,2>{0.49205777f, 0.301368564f},
-std::array<float,2>{0.80486542f, 0.929231226f},
-std::array<float,2>{0.0715281814f, 0.968646228f},
-std::array<float,2>{0.531956255f, 0.342552751f},
-std::array<float,2>{0.391004354f, 0.187049493f},
-std::array<float,2>{0.825720429f, 0.66618979f},
-std::array<float,2>{0.315220624f, 0.572904587f},
-std::array<float,2>{0.925150871f, 0.0374089144f},
-std::array<float,2>{0.136580452f, 0.475115359f},
-std::array<float,2>{0.666088104f, 0.86705488f},
-std::array<float,2>{0.496205151f, 0.804637253f},
-std::array<float,2>{0.803941965f, 0.395666063f},
-std::array<float,2>{0.0252301302f, 0.122061975f},
-std::array<float,2>{0.611096263f, 0.531982124f},
-std::array<float,2>{0.231293768f, 0.694235861f},
-std::array<float,2>{0.713600814f, 0.215375379f},
-std::array<float,2>{0.29032284f, 0.261721939f},
-std::array<float,2>{0.984399021f, 0.885195732f},
-std::array<float,2>{0.161937401f, 0.843271196f},
-std::array<float,2>{0.647175848f, 0.467637986f},
-std::array<float,2>{0.372781664f, 0.0163741689f},
-std::array<float,2>{0.893002391f, 0.593894958f},
-std::array<float,2>{0.424440742f, 0.627437234f},
-std::array<float,2>{0.84808296f, 0.132593393f},
-std::array<float,2>{0.124041684f, 0.356796443f},
-std::array<float,2>{0.511029243f, 0.983144045f},
-std::array<float,2>{0.275426656f, 0.936682999f},
-std::array<float,2>{0.956292331f, 0.307438374f},
-std::array<float,2>{0.196711436f, 0.230643898f},
-std::array<float,2>{0.720788956f, 0.749598086f},
-std::array<float,2>{0.0449188948f, 0.524540782f},
-std::array<float,2>{0.580373943f, 0.0715378374f},
-std::array<float,2>{0.464473784f, 0.422481447f},
-std::array<float,2>{0.761656404f, 0.757576406f},
-std::array<float,2>{0.0134145394f, 0.768086076f},
-std::array<float,2>{0.595154583f, 0.40699333f},
-std::array<float,2>{0.469447285f, 0.0788060352f},
-std::array<float,2>{0.793116212f, 0.509644866f},
-std::array<float,2>{0.307029307f, 0.726200342f},
-std::array<float,2>{0.975479186f, 0.246443346f},
-std::array<float,2>{0.246357024f, 0.292711794f},
-std::array<float,2>{0.695679128f, 0.920879304f},
-std::array<float,2>{0.385965437f, 0.997812629f},
-std::array<float,2>{0.831479728f, 0.363072395f},
-std::array<float,2>{0.0879703835f, 0.143796563f},
-std::array<float,2>{0.559004426f, 0.649491668f},
-std::array<float,2>{0.148598716f, 0.610483706f},
-std::array<float,2>{0.684848726f, 0.0114937192f},
-std::array<float,2>{0.342085272f, 0.445355266f},
-std::array<float,2>{0.910906255f, 0.820745528f},
-std::array<float,2>{0.205472544f, 0.896029055f},
-std::array<float,2>{0.736375988f, 0.275309056f},
-std::array<float,2>{0.256159782f, 0.201518849f},
-std::array<float,2>{0.948822558f, 0.707197249f},
-std::array<float,2>{0.445269525f, 0.54968518f},
-std::array<float,2>{0.768882334f, 0.100284465f},
-std::array<float,2>{0.0553360358f, 0.390013307f},
-std::array<float,2>{0.567688286f, 0.787449241f},
-std::array<float,2>{0.345170885f, 0.858660638f},
-std::array<float,2>{0.878372192f, 0.493772f},
-std::array<float,2>{0.187244102f, 0.0525762811f},
-std::array<float,2>{0.638693392f, 0.590857327f},
-std::array<float,2>{0.105384722f, 0.686377048f},
-std::array<float,2>{0.52445513f, 0.157036915f},
-std::array<float,2>{0.407999009f, 0.326111585f},
-std::array<float,2>{0.873877466f, 0.949317813f},
-std::array<float,2>{0.0297553446f, 0.986855507f},
-std::array<float,2>{0.614388049f, 0.371662319f},
-std::array<float,2>{0.49595499f, 0.154163152f},
-std::array<float,2>{0.800675869f, 0.645760894f},
-std::array<float,2>{0.293367445f, 0.618163228f},
-std::array<float,2>{0.991520882f, 0.0060229334f},
-std::array<float,2>{0.230011538f, 0.442257315f},
-std::array<float,2>{0.714987099f, 0.819223046f},
-std::array<float,2>{0.397190511f, 0.777321696f},
-std::array<float,2>{0.822694361f, 0.41860947f},
-std::array<float,2>{0.0780965537f, 0.0901243538f},
-std::array<float,2>{0.536112785f, 0.507730365f},
-std::array<float,2>{0.139269814f, 0.728450179f},
-std::array<float,2>{0.669280529f, 0.241712853f},
-std::array<float,2>{0.319323868f, 0.282265395f},
-std::array<float,2>{0.928110123f, 0.913340986f},
-std::array<float,2>{0.199446857f, 0.845194697f},
-std::array<float,2>{0.724424064f, 0.490192473f},
-std::array<float,2>{0.27781114f, 0.0580611378f},
-std::array<float,2>{0.960188448f, 0.579894006f},
-std::array<float,2>{0.46723634f, 0.674497843f},
-std::array<float,2>{0.764481723f, 0.16963166f},
-std::array<float,2>{0.0394261517f, 0.313649446f},
-std::array<float,2>{0.585553169f, 0.943565905f},
-std::array<float,2>{0.367510974f, 0.903734505f},
-std::array<float,2>{0.896259964f, 0.271279573f},
-std::array<float,2>{0.159378096f, 0.190725267f},
-std::array<float,2>{0.642533004f, 0.712900639f},
-std::array<float,2>{0.118202142f, 0.556009412f},
-std::array<float,2>{0.513994634f, 0.10737887f},
-std::array<float,2>{0.426003724f, 0.380953461f},
-std::array<float,2>{0.847578108f, 0.791671813f},
-std::array<float,2>{0.0918213576f, 0.809022188f},
-std::array<float,2>{0.55807215f, 0.403027594f},
-std::array<float,2>{0.389666736f, 0.112616599f},
-std::array<float,2>{0.835223913f, 0.546271086f},
-std::array<float,2>{0.339104563f, 0.700088799f},
-std::array<float,2>{0.906885564f, 0.209501877f},
-std::array<float,2>{0.154770523f, 0.256130874f},
-std::array<float,2>{0.681120038f, 0.881652951f},
-std::array<float,2>{0.475997239f, 0.954729736f},
-std::array<float,2>{0.789752245f, 0.329710633f},
-std::array<float,2>{0.0081574358f, 0.178544655f},
-std::array<float,2>{0.599460721f, 0.659835875f},
-std::array<float,2>{0.243272573f, 0.568334222f},
-std::array<float,2>{0.700187087f, 0.0410844907f},
-std::array<float,2>{0.30959639f, 0.47703442f},
-std::array<float,2>{0.971107483f, 0.870165408f},
-std::array<float,2>{0.181452304f, 0.923395872f},
-std::array<float,2>{0.635040998f, 0.298948973f},
-std::array<float,2>{0.350446194f, 0.219305858f},
-std::array<float,2>{0.881446481f, 0.739164472f},
-std::array<float,2>{0.412021965f, 0.518593729f},
-std::array<float,2>{0.87052691f, 0.065836221f},
-std::array<float,2>{0.108571626f, 0.433770359f},
-std::array<float,2>{0.530274034f, 0.764638603f},
-std::array<float,2>{0.25171724f, 0.831852555f},
-std::array<float,2>{0.952251256f, 0.454976827f},
-std::array<float,2>{0.20939216f, 0.0238826517f},
-std::array<float,2>{0.741073072f, 0.603297412f},
-std::array<float,2>{0.0607317723f, 0.639639378f},
-std::array<float,2>{0.564807117f, 0.139950722f},
-std::array<float,2>{0.438682616f, 0.343765914f},
-std::array<float,2>{0.771559715f, 0.972628176f},
-std::array<float,2>{0.0989195853f, 0.888195217f},
-std::array<float,2>{0.522032559f, 0.260612339f},
-std::array<float,2>{0.419327587f, 0.211585596f},
-std::array<float,2>{0.859602153f, 0.690610409f},
-std::array<float,2>{0.353415996f, 0.537127972f},
-std::array<float,2>{0.889302135f, 0.119838297f},
-std::array<float,2>{0.172418475f, 0.390877068f},
-std::array<float,2>{0.62759316f, 0.79694742f},
-std::array<float,2>{0.44878158f, 0.861099303f},
-std::array<float,2>{0.779755116f, 0.470659763f},
-std::array<float,2>{0.0476137549f, 0.0331985652f},
-std::array<float,2>{0.572456002f, 0.578008771f},
-std::array<float,2>{0.212482855f, 0.668198228f},
-std::array<float,2>{0.744433343f, 0.182579041f},
-std::array<float,2>{0.257851481f, 0.339154452f},
-std::array<float,2>{0.937760174f, 0.963730037f},
-std::array<float,2>{0.146153018f, 0.752013505f},
-std::array<float,2>{0.671979129f, 0.429234982f},
-std::array<float,2>{0.330081135f, 0.0755655617f},
-std::array<float,2>{0.918156862f, 0.530130446f},
-std::array<float,2>{0.376425952f, 0.745894432f},
-std::array<float,2>{0.842636585f, 0.22942248f},
-std::array<float,2>{0.0792182535f, 0.310314775f},
-std::array<float,2>{0.549550533f, 0.932548523f},
-std::array<float,2>{0.302011967f, 0.977444708f},
-std::array<float,2>{0.97726959f, 0.353002131f},
-std::array<float,2>{0.234435946f, 0.125274792f},
-std::array<float,2>{0.692130387f, 0.632773697f},
-std::array<float,2>{0.00476055034f, 0.598541081f},
-std::array<float,2>{0.603659868f, 0.0200125445f},
-std::array<float,2>{0.477898329f, 0.464835495f},
-std::array<float,2>{0.785484791f, 0.83944571f},
-std::array<float,2>{0.0389600806f, 0.824416339f},
-std::array<float,2>{0.591334164f, 0.452094913f},
-std::array<float,2>{0.458997965f, 0.0122987023f},
-std::array<float,2>{0.755781054f, 0.616549492f},
-std::array<float,2>{0.266286045f, 0.653706908f},
-std::array<float,2>{0.96382153f, 0.144695207f},
-std::array<float,2>{0.189552367f, 0.364423692f},
-std::array<float,2>{0.730999887f, 0.992320776f},
-std::array<float,2>{0.431475371f, 0.915057838f},
-std::array<float,2>{0.859071851f, 0.296839982f},
-std::array<float,2>{0.11157883f, 0.24285537f},
-std::array<float,2>{0.507359684f, 0.71989733f},
-std::array<float,2>{0.168679938f, 0.515083253f},
-std::array<float,2>{0.653188705f, 0.0833479986f},
-std::array<float,2>{0.360006511f, 0.413194209f},
-std::array<float,2>{0.904274046f, 0.770184457f},
-std::array<float,2>{0.220717847f, 0.945333123f},
-std::array<float,2>{0.710881233f, 0.320847362f},
-std::array<float,2>{0.284127325f, 0.162748501f},
-std::array<float,2>{0.994460583f, 0.682944834f},
-std::array<float,2>{0.486825049f, 0.587308049f},
-std::array<float,2>{0.811193764f, 0.0482778512f},
-std::array<float,2>{0.0221027173f, 0.498186827f},
-std::array<float,2>{0.618272543f, 0.855270028f},
-std::array<float,2>{0.325287789f, 0.784001291f},
-std::array<float,2>{0.931937575f, 0.384956032f},
-std::array<float,2>{0.127466291f, 0.0953123197f},
-std::array<float,2>{0.658645391f, 0.554440618f},
-std::array<float,2>{0.0641173348f, 0.704911649f},
-std::array<float,2>{0.539775193f, 0.195672885f},
-std::array<float,2>{0.403120965f, 0.280399114f},
-std::array<float,2>{0.814748466f, 0.891545534f},
-std::array<float,2>{0.0158196371f, 0.928708851f},
-std::array<float,2>{0.622373044f, 0.302214444f},
-std::array<float,2>{0.489993393f, 0.226198077f},
-std::array<float,2>{0.806912422f, 0.734873652f},
-std::array<float,2>{0.285262227f, 0.52030611f},
-std::array<float,2>{0.998647451f, 0.0671670437f},
-std::array<float,2>{0.224548027f, 0.429993689f},
-std::array<float,2>{0.705920756f, 0.760884762f},
-std::array<float,2>{0.401480585f, 0.835151732f},
-std::array<float,2>{0.819655597f, 0.459732085f},
-std::array<float,2>{0.0700965822f, 0.0302610528f},
-std::array<float,2>{0.544593215f, 0.60557276f},
-std::array<float,2>{0.131516814f, 0.633342564f},
-std::array<float,2>{0.661686122f, 0.13537319f},
-std::array<float,2>{0.321088254f, 0.349702746f},
-std::array<float,2>{0.933594286f, 0.976069808f},
-std::array<float,2>{0.193124056f, 0.804827631f},
-std::array<float,2>{0.728205144f, 0.400860459f},
-std::array<float,2>{0.272480309f, 0.116096675f},
-std::array<float,2>{0.96784538f, 0.539646089f},
-std::array<float,2>{0.456731617f, 0.695623875f},
-std::array<float,2>{0.750047326f, 0.206304833f},
-std::array<float,2>{0.0312685817f, 0.252644837f},
-std::array<float,2>{0.586692333f, 0.877627969f},
-std::array<float,2>{0.365190148f, 0.958973169f},
-std::array<float,2>{0.899722815f, 0.332924396f},
-std::array<float,2>{0.164148867f, 0.174021184f},
-std::array<float,2>{0.649405003f, 0.66344285f},
-std::array<float,2>{0.116457246f, 0.564282179f},
-std::array<float,2>{0.501228571f, 0.0458577722f},
-std::array<float,2>{0.43669337f, 0.482905746f},
-std::array<float,2>{0.85400492f, 0.872694492f},
-std::array<float,2>{0.0820926949f, 0.8500911f},
-std::array<float,2>{0.553190649f, 0.487153947f},
-std::array<float,2>{0.381306738f, 0.0589408837f},
-std::array<float,2>{0.83953464f, 0.582480133f},
-std::array<float,2>{0.333686382f, 0.678599775f},
-std::array<float,2>{0.914347649f, 0.165107891f},
-std::array<float,2>{0.144433036f, 0.318147421f},
-std::array<float,2>{0.676847398f, 0.939483166f},
-std::array<float,2>{0.482234299f, 0.901990294f},
-std::array<float,2>{0.784821689f, 0.26615715f},
-std::array<float,2>{0.00260544196f, 0.193523765f},
-std::array<float,2>{0.605876327f, 0.715036809f},
-std::array<float,2>{0.238537118f, 0.561994612f},
-std::array<float,2>{0.688085616f, 0.104581095f},
-std::array<float,2>{0.300530195f, 0.378020376f},
-std::array<float,2>{0.982985318f, 0.796476364f},
-std::array<float,2>{0.178793505f, 0.990066946f},
-std::array<float,2>{0.629384339f, 0.369331002f},
-std::array<float,2>{0.356291473f, 0.151192561f},
-std::array<float,2>{0.885742009f, 0.6413185f},
-std::array<float,2>{0.417528063f, 0.624599755f},
-std::array<float,2>{0.86442703f, 0.00280155567f},
-std::array<float,2>{0.0972386599f, 0.439915985f},
-std::array<float,2>{0.515805721f, 0.815386117f},
-std::array<float,2>{0.265051246f, 0.778514683f},
-std::array<float,2>{0.944571793f, 0.414528042f},
-std::array<float,2>{0.217097148f, 0.0860378817f},
-std::array<float,2>{0.747162461f, 0.501086235f},
-std::array<float,2>{0.0521923788f, 0.731505096f},
-std::array<float,2>{0.575144708f, 0.236261845f},
-std::array<float,2>{0.452034056f, 0.285382777f},
-std::array<float,2>{0.775674224f, 0.909873247f},
-std::array<float,2>{0.103487112f, 0.950778365f},
-std::array<float,2>{0.526590526f, 0.324917942f},
-std::array<float,2>{0.409472495f, 0.157822892f},
-std::array<float,2>{0.871295154f, 0.687480867f},
-std::array<float,2>{0.346960366f, 0.590512156f},
-std::array<float,2>{0.876479864f, 0.0517174415f},
-std::array<float,2>{0.185464233f, 0.492806405f},
-std::array<float,2>{0.637300014f, 0.85795182f},
-std::array<float,2>{0.44245705f, 0.788662016f},
-std::array<float,2>{0.766066432f, 0.388884723f},
-std::array<float,2>{0.0571544133f, 0.101170361f},
-std::array<float,2>{0.569642127f, 0.550166309f},
-std::array<float,2>{0.204865664f, 0.708395839f},
-std::array<float,2>{0.735394299f, 0.202780217f},
-std::array<float,2>{0.255685121f, 0.274123043f},
-std::array<float,2>{0.946905077f, 0.894886494f},
-std::array<float,2>{0.151336119f, 0.822187841f},
-std::array<float,2>{0.68694973f, 0.446917593f},
-std::array<float,2>{0.341626853f, 0.00983250141f},
-std::array<float,2>{0.912846148f, 0.609454274f},
-std::array<float,2>{0.384007603f, 0.649178505f},
-std::array<float,2>{0.828275502f, 0.142646745f},
-std::array<float,2>{0.0873959437f, 0.362042218f},
-std::array<float,2>{0.561956167f, 0.996920407f},
-std::array<float,2>{0.306109548f, 0.921582282f},
-std::array<float,2>{0.973632753f, 0.291417927f},
-std::array<float,2>{0.249018937f, 0.24788554f},
-std::array<float,2>{0.69903481f, 0.725153327f},
-std::array<float,2>{0.0153759653f, 0.507878482f},
-std::array<float,2>{0.596129775f, 0.0792701989f},
-std::array<float,2>{0.471512914f, 0.407757789f},
-std::array<float,2>{0.795030594f, 0.768712044f},
-std::array<float,2>{0.0466966517f, 0.756194115f},
-std::array<float,2>{0.578542888f, 0.423171401f},
-std::array<float,2>{0.461515725f, 0.070485428f},
-std::array<float,2>{0.759201944f, 0.524248242f},
-std::array<float,2>{0.274885416f, 0.748631954f},
-std::array<float,2>{0.954968154f, 0.232212111f},
-std::array<float,2>{0.198051438f, 0.307731718f},
-std::array<float,2>{0.719629884f, 0.936035633f},
-std::array<float,2>{0.422505617f, 0.983916223f},
-std::array<float,2>{0.850809157f, 0.356190801f},
-std::array<float,2>{0.122789189f, 0.131158486f},
-std::array<float,2>{0.508110464f, 0.628535271f},
-std::array<float,2>{0.162970811f, 0.59561646f},
-std::array<float,2>{0.644556344f, 0.017425498f},
-std::array<float,2>{0.374356538f, 0.468708366f},
-std::array<float,2>{0.892421842f, 0.841813147f},
-std::array<float,2>{0.232649267f, 0.886678219f},
-std::array<float,2>{0.712388754f, 0.263616771f},
-std::array<float,2>{0.291806668f, 0.215964243f},
-std::array<float,2>{0.987985075f, 0.69458127f},
-std::array<float,2>{0.499673188f, 0.53272444f},
-std::array<float,2>{0.80131644f, 0.122759819f},
-std::array<float,2>{0.0263212584f, 0.394534737f},
-std::array<float,2>{0.612342536f, 0.802897096f},
-std::array<float,2>{0.314386636f, 0.865258992f},
-std::array<float,2>{0.922034979f, 0.476209879f},
-std::array<float,2>{0.134585544f, 0.0384545438f},
-std::array<float,2>{0.664254606f, 0.573302805f},
-std::array<float,2>{0.0736306533f, 0.667870581f},
-std::array<float,2>{0.535066605f, 0.185678333f},
-std::array<float,2>{0.392842114f, 0.343719602f},
-std::array<float,2>{0.827412546f, 0.967689455f},
-std::array<float,2>{0.0604841597f, 0.970905721f},
-std::array<float,2>{0.563679218f, 0.345097989f},
-std::array<float,2>{0.440535933f, 0.138814792f},
-std::array<float,2>{0.770666838f, 0.640398204f},
-std::array<float,2>{0.253437817f, 0.601903737f},
-std::array<float,2>{0.950095057f, 0.0251234844f},
-std::array<float,2>{0.207332924f, 0.453533143f},
-std::array<float,2>{0.739412487f, 0.830564857f},
-std::array<float,2>{0.413800001f, 0.765100658f},
-std::array<float,2>{0.868399382f, 0.434688807f},
-std::array<float,2>{0.106438227f, 0.0644803122f},
-std::array<float,2>{0.527750969f, 0.518393159f},
-std::array<float,2>{0.181644395f, 0.739798248f},
-std::array<float,2>{0.633426249f, 0.220626116f},
-std::array<float,2>{0.34797889f, 0.300703079f},
-std::array<float,2>{0.879395306f, 0.922443211f},
-std::array<float,2>{0.245874122f, 0.86980325f},
-std::array<float,2>{0.702822089f, 0.47794649f},
-std::array<float,2>{0.311386406f, 0.0428447723f},
-std::array<float,2>{0.970329285f, 0.567175508f},
-std::array<float,2>{0.473402053f, 0.658502102f},
-std::array<float,2>{0.79266423f, 0.179114223f},
-std::array<float,2>{0.0102875475f, 0.328515023f},
-std::array<float,2>{0.601547897f, 0.953733742f},
-std::array<float,2>{0.336337477f, 0.882357657f},
-std::array<float,2>{0.908232391f, 0.25742498f},
-std::array<float,2>{0.153848574f, 0.210798815f},
-std::array<float,2>{0.682974458f, 0.701000512f},
-std::array<float,2>{0.090201728f, 0.545000553f},
-std::array<float,2>{0.55636996f, 0.111510389f},
-std::array<float,2>{0.388128936f, 0.403680474f},
-std::array<float,2>{0.833925068f, 0.809899807f},
-std::array<float,2>{0.120504148f, 0.792404711f},
-std::array<float,2>{0.512251616f, 0.382682294f},
-std::array<float,2>{0.428456217f, 0.106265187f},
-std::array<float,2>{0.845167279f, 0.554989874f},
-std::array<float,2>{0.369856417f, 0.714520454f},
-std::array<float,2>{0.89773035f, 0.190247908f},
-std::array<float,2>{0.156349301f, 0.270297319f},
-std::array<float,2>{0.644283473f, 0.902762771f},
-std::array<float,2>{0.465701014f, 0.944741368f},
-std::array<float,2>{0.763593018f, 0.312815934f},
-std::array<float,2>{0.0419976972f, 0.168408409f},
-std::array<float,2>{0.582285464f, 0.675483465f},
-std::array<float,2>{0.20243369f, 0.578388929f},
-std::array<float,2>{0.724729657f, 0.057433106f},
-std::array<float,2>{0.279648662f, 0.488935173f},
-std::array<float,2>{0.957361817f, 0.843938112f},
-std::array<float,2>{0.13758491f, 0.912816525f},
-std::array<float,2>{0.671235502f, 0.28207016f},
-std::array<float,2>{0.317522556f, 0.240654379f},
-std::array<float,2>{0.926245511f, 0.727208853f},
-std::array<float,2>{0.396156758f, 0.506283224f},
-std::array<float,2>{0.821597517f, 0.0917330459f},
-std::array<float,2>{0.0747897774f, 0.419261038f},
-std::array<float,2>{0.537141025f, 0.776014149f},
-std::array<float,2>{0.295887411f, 0.819549561f},
-std::array<float,2>{0.988782287f, 0.443146199f},
-std::array<float,2>{0.22844927f, 0.00720447488f},
-std::array<float,2>{0.718492389f, 0.618729651f},
-std::array<float,2>{0.0289584287f, 0.644681513f},
-std::array<float,2>{0.616326869f, 0.1523996f},
-std::array<float,2>{0.492789358f, 0.373005182f},
-std::array<float,2>{0.797921956f, 0.987659931f},
-std::array<float,2>{0.0652884543f, 0.892055929f},
-std::array<float,2>{0.541390896f, 0.280058295f},
-std::array<float,2>{0.404310107f, 0.196558759f},
-std::array<float,2>{0.812864304f, 0.704048216f},
-std::array<float,2>{0.326577574f, 0.553613007f},
-std::array<float,2>{0.930477083f, 0.0937947258f},
-std::array<float,2>{0.126444742f, 0.386528879f},
-std::array<float,2>{0.656446815f, 0.784783363f},
-std::array<float,2>{0.484429508f, 0.8542642f},
-std::array<float,2>{0.808750927f, 0.499325991f},
-std::array<float,2>{0.0198958963f, 0.047653079f},
-std::array<float,2>{0.621021569f, 0.586242378f},
-std::array<float,2>{0.220402509f, 0.682420969f},
-std::array<float,2>{0.708694816f, 0.163622335f},
-std::array<float,2>{0.281728119f, 0.321772963f},
-std::array<float,2>{0.993141949f, 0.946883559f},
-std::array<float,2>{0.169976309f, 0.771209478f},
-std::array<float,2>{0.655506074f, 0.412619054f},
-std::array<float,2>{0.361815184f, 0.082075499f},
-std::array<float,2>{0.90488106f, 0.514638364f},
-std::array<float,2>{0.43182826f, 0.718994915f},
-std::array<float,2>{0.856006384f, 0.243827894f},
-std::array<float,2>{0.110969283f, 0.295042962f},
-std::array<float,2>{0.505568683f, 0.914182007f},
-std::array<float,2>{0.26859796f, 0.993460953f},
-std::array<float,2>{0.961948395f, 0.364142716f},
-std::array<float,2>{0.189447239f, 0.145674631f},
-std::array<float,2>{0.733217359f, 0.652836025f},
-std::array<float,2>{0.0370254964f, 0.615768492f},
-std::array<float,2>{0.591972649f, 0.013617008f},
-std::array<float,2>{0.457490325f, 0.452231944f},
-std::array<float,2>{0.756827891f, 0.826023817f},
-std::array<float,2>{0.00703491736f, 0.838566601f},
-std::array<float,2>{0.602457762f, 0.463794172f},
-std::array<float,2>{0.478582084f, 0.0209960658f},
-std::array<float,2>{0.788736403f, 0.59902209f},
-std::array<float,2>{0.303320259f, 0.630964577f},
-std::array<float,2>{0.979111671f, 0.126719981f},
-std::array<float,2>{0.237853333f, 0.351567924f},
-std::array<float,2>{0.695236027f, 0.977566957f},
-std::array<float,2>{0.378161818f, 0.933271706f},
-std::array<float,2>{0.840574682f, 0.308760494f},
-std::array<float,2>{0.0807152465f, 0.230217353f},
-std::array<float,2>{0.548523903f, 0.744494081f},
-std::array<float,2>{0.146665335f, 0.530375898f},
-std::array<float,2>{0.674028933f, 0.0745551735f},
-std::array<float,2>{0.32993722f, 0.428249031f},
-std::array<float,2>{0.920198739f, 0.753848433f},
-std::array<float,2>{0.213613063f, 0.964309216f},
-std::array<float,2>{0.742608607f, 0.338779151f},
-std::array<float,2>{0.260636896f, 0.183174625f},
-std::array<float,2>{0.940066755f, 0.669099331f},
-std::array<float,2>{0.445814639f, 0.576994002f},
-std::array<float,2>{0.779151082f, 0.0317130089f},
-std::array<float,2>{0.0499011204f, 0.469542712f},
-std::array<float,2>{0.570775211f, 0.85983175f},
-std::array<float,2>{0.353924125f, 0.798080802f},
-std::array<float,2>{0.887134492f, 0.391954958f},
-std::array<float,2>{0.175705373f, 0.120214745f},
-std::array<float,2>{0.626712382f, 0.538704634f},
-std::array<float,2>{0.100221008f, 0.689527333f},
-std::array<float,2>{0.520393312f, 0.212888852f},
-std::array<float,2>{0.421570718f, 0.261379898f},
-std::array<float,2>{0.861613393f, 0.886874259f},
-std::array<float,2>{0.0349234901f, 0.875770688f},
-std::array<float,2>{0.589291155f, 0.251159519f},
-std::array<float,2>{0.453665525f, 0.204558671f},
-std::array<float,2>{0.752307057f, 0.698311269f},
-std::array<float,2>{0.271065891f, 0.542037368f},
-std::array<float,2>{0.965044618f, 0.115160324f},
-std::array<float,2>{0.193847403f, 0.398882568f},
-std::array<float,2>{0.729612887f, 0.806893289f},
-std::array<float,2>{0.434144616f, 0.873155296f},
-std::array<float,2>{0.853295624f, 0.480608642f},
-std::array<float,2>{0.114793725f, 0.0436174534f},
-std::array<float,2>{0.503329098f, 0.566013694f},
-std::array<float,2>{0.167044893f, 0.660692453f},
-std::array<float,2>{0.65070641f, 0.173287198f},
-std::array<float,2>{0.366829067f, 0.334840238f},
-std::array<float,2>{0.901309371f, 0.95975405f},
-std::array<float,2>{0.224613219f, 0.759257197f},
-std::array<float,2>{0.704765081f, 0.432432115f},
-std::array<float,2>{0.288281381f, 0.0696524158f},
-std::array<float,2>{0.997093499f, 0.522373199f},
-std::array<float,2>{0.49084124f, 0.738102019f},
-std::array<float,2>{0.806574643f, 0.224540845f},
-std::array<float,2>{0.0186513867f, 0.304036915f},
-std::array<float,2>{0.624431491f, 0.926203549f},
-std::array<float,2>{0.322717249f, 0.974578083f},
-std::array<float,2>{0.937211037f, 0.348856449f},
-std::array<float,2>{0.130171508f, 0.133347049f},
-std::array<float,2>{0.663546622f, 0.635730326f},
-std::array<float,2>{0.0667382181f, 0.60847038f},
-std::array<float,2>{0.545356333f, 0.0290666409f},
-std::array<float,2>{0.400078386f, 0.458069682f},
-std::array<float,2>{0.817091703f, 0.833108783f},
-std::array<float,2>{0.0941638499f, 0.813011467f},
-std::array<float,2>{0.519125938f, 0.438867003f},
-std::array<float,2>{0.414099485f, 0.000545074407f},
-std::array<float,2>{0.866998911f, 0.621227264f},
-std::array<float,2>{0.35886386f, 0.643173635f},
-std::array<float,2>{0.88320142f, 0.150264695f},
-std::array<float,2>{0.17616725f, 0.368320793f},
-std::array<float,2>{0.632081628f, 0.992157221f},
-std::array<float,2>{0.449559659f, 0.907361448f},
-std::array<float,2>{0.775042534f, 0.287337124f},
-std::array<float,2>{0.0539785177f, 0.237569034f},
-std::array<float,2>{0.577057838f, 0.733277261f},
-std::array<float,2>{0.214967042f, 0.503456891f},
-std::array<float,2>{0.748062491f, 0.089432314f},
-std::array<float,2>{0.262278736f, 0.417731673f},
-std::array<float,2>{0.941412985f, 0.78066051f},
-std::array<float,2>{0.141095623f, 0.939034998f},
-std::array<float,2>{0.679429531f, 0.319883466f},
-std::array<float,2>{0.335352749f, 0.167155161f},
-std::array<float,2>{0.917510092f, 0.677092075f},
-std::array<float,2>{0.379706264f, 0.585041702f},
-std::array<float,2>{0.836635411f, 0.0615339912f},
-std::array<float,2>{0.085843198f, 0.486254036f},
-std::array<float,2>{0.55121702f, 0.848887563f},
-std::array<float,2>{0.297813296f, 0.793478608f},
-std::array<float,2>{0.981396377f, 0.376861513f},
-std::array<float,2>{0.241859689f, 0.103428058f},
-std::array<float,2>{0.690291703f, 0.560245812f},
-std::array<float,2>{0.00180652202f, 0.718349934f},
-std::array<float,2>{0.607486963f, 0.191466779f},
-std::array<float,2>{0.482446313f, 0.268392563f},
-std::array<float,2>{0.781330407f, 0.899598718f},
-std::array<float,2>{0.0896993056f, 0.999968946f},
-std::array<float,2>{0.559881926f, 0.360508353f},
-std::array<float,2>{0.38509047f, 0.141250744f},
-std::array<float,2>{0.830808818f, 0.652240992f},
-std::array<float,2>{0.343244225f, 0.612328947f},
-std::array<float,2>{0.911964774f, 0.00799643621f},
-std::array<float,2>{0.149539515f, 0.448320687f},
-std::array<float,2>{0.683597088f, 0.823656499f},
-std::array<float,2>{0.470539033f, 0.767356336f},
-std::array<float,2>{0.794404685f, 0.409880459f},
-std::array<float,2>{0.0121223973f, 0.0812457949f},
-std::array<float,2>{0.594459772f, 0.510907054f},
-std::array<float,2>{0.247095048f, 0.724475145f},
-std::array<float,2>{0.696495891f, 0.249137223f},
-std::array<float,2>{0.30800426f, 0.290415138f},
-std::array<float,2>{0.976433516f, 0.919170141f},
-std::array<float,2>{0.186103985f, 0.855744779f},
-std::array<float,2>{0.640380442f, 0.495506376f},
-std::array<float,2>{0.34409219f, 0.0543602332f},
-std::array<float,2>{0.877731681f, 0.592191696f},
-std::array<float,2>{0.406686038f, 0.684992969f},
-std::array<float,2>{0.874119639f, 0.160069466f},
-std::array<float,2>{0.10355141f, 0.326728225f},
-std::array<float,2>{0.523560762f, 0.951671839f},
-std::array<float,2>{0.257120967f, 0.897920251f},
-std::array<float,2>{0.947653234f, 0.277114511f},
-std::array<float,2>{0.20658727f, 0.200878531f},
-std::array<float,2>{0.737868547f, 0.709449351f},
-std::array<float,2>{0.0566291437f, 0.547643423f},
-std::array<float,2>{0.566462994f, 0.0982326418f},
-std::array<float,2>{0.443601131f, 0.387722194f},
-std::array<float,2>{0.768162012f, 0.78614682f},
-std::array<float,2>{0.0236236136f, 0.800839961f},
-std::array<float,2>{0.610228539f, 0.397767693f},
-std::array<float,2>{0.497521728f, 0.124172352f},
-std::array<float,2>{0.802940488f, 0.533433676f},
-std::array<float,2>{0.289808154f, 0.692948043f},
-std::array<float,2>{0.986178041f, 0.21694921f},
-std::array<float,2>{0.231458351f, 0.263689339f},
-std::array<float,2>{0.71423912f, 0.883041382f},
-std::array<float,2>{0.391640127f, 0.965901136f},
-std::array<float,2>{0.825119376f, 0.340958774f},
-std::array<float,2>{0.0703777671f, 0.183684602f},
-std::array<float,2>{0.532342255f, 0.665705979f},
-std::array<float,2>{0.135680914f, 0.57055968f},
-std::array<float,2>{0.667966366f, 0.0367635451f},
-std::array<float,2>{0.31550926f, 0.474177152f},
-std::array<float,2>{0.924481869f, 0.864956319f},
-std::array<float,2>{0.195393205f, 0.934097052f},
-std::array<float,2>{0.722363293f, 0.30566448f},
-std::array<float,2>{0.277109027f, 0.233081073f},
-std::array<float,2>{0.955703497f, 0.746317923f},
-std::array<float,2>{0.463076085f, 0.525962055f},
-std::array<float,2>{0.759981453f, 0.0739834756f},
-std::array<float,2>{0.0435226597f, 0.424999237f},
-std::array<float,2>{0.581510127f, 0.755016267f},
-std::array<float,2>{0.371479988f, 0.840187848f},
-std::array<float,2>{0.894167304f, 0.465649009f},
-std::array<float,2>{0.161129326f, 0.0192665569f},
-std::array<float,2>{0.647803307f, 0.595982134f},
-std::array<float,2>{0.123112522f, 0.626187921f},
-std::array<float,2>{0.510383844f, 0.13057144f},
-std::array<float,2>{0.425135374f, 0.357787728f},
-std::array<float,2>{0.849371374f, 0.980623186f},
-std::array<float,2>{0.00933868811f, 0.955715835f},
-std::array<float,2>{0.597991168f, 0.33076939f},
-std::array<float,2>{0.475191385f, 0.176813096f},
-std::array<float,2>{0.790594876f, 0.656810224f},
-std::array<float,2>{0.308637738f, 0.570180833f},
-std::array<float,2>{0.972352743f, 0.0394263379f},
-std::array<float,2>{0.242488518f, 0.480365485f},
-std::array<float,2>{0.700728416f, 0.868255734f},
-std::array<float,2>{0.389549166f, 0.812002361f},
-std::array<float,2>{0.834877968f, 0.405417234f},
-std::array<float,2>{0.0934958458f, 0.110632576f},
-std::array<float,2>{0.556798339f, 0.544298828f},
-std::array<float,2>{0.155594721f, 0.701248288f},
-std::array<float,2>{0.680012524f, 0.20774889f},
-std::array<float,2>{0.337966949f, 0.254595816f},
-std::array<float,2>{0.907326341f, 0.879913151f},
-std::array<float,2>{0.210743368f, 0.829583406f},
-std::array<float,2>{0.741559267f, 0.456230551f},
-std::array<float,2>{0.250714719f, 0.0265926216f},
-std::array<float,2>{0.952023625f, 0.605423391f},
-std::array<float,2>{0.438228905f, 0.638669848f},
-std::array<float,2>{0.77343303f, 0.137921929f},
-std::array<float,2>{0.0619581863f, 0.347502738f},
-std::array<float,2>{0.565743923f, 0.970589936f},
-std::array<float,2>{0.351099402f, 0.924650908f},
-std::array<float,2>{0.881950021f, 0.29842186f},
-std::array<float,2>{0.180641696f, 0.221036971f},
-std::array<float,2>{0.635901272f, 0.741167307f},
-std::array<float,2>{0.108187936f, 0.516024113f},
-std::array<float,2>{0.529671788f, 0.0641291365f},
-std::array<float,2>{0.410393745f, 0.436762601f},
-std::array<float,2>{0.869317949f, 0.761935949f},
-std::array<float,2>{0.0767065734f, 0.773927093f},
-std::array<float,2>{0.536564231f, 0.421381354f},
-std::array<float,2>{0.397719979f, 0.0926438048f},
-std::array<float,2>{0.823469698f, 0.505005956f},
-std::array<float,2>{0.319635123f, 0.729822814f},
-std::array<float,2>{0.929231346f, 0.23979111f},
-std::array<float,2>{0.139745042f, 0.284805804f},
-std::array<float,2>{0.6688959f, 0.910309255f},
-std::array<float,2>{0.494271249f, 0.985875249f},
-std::array<float,2>{0.798915744f, 0.373334259f},
-std::array<float,2>{0.0310898554f, 0.154828697f},
-std::array<float,2>{0.613371849f, 0.64750737f},
-std::array<float,2>{0.228744581f, 0.619682193f},
-std::array<float,2>{0.715982974f, 0.00541428616f},
-std::array<float,2>{0.294772357f, 0.444028437f},
-std::array<float,2>{0.990551293f, 0.816976786f},
-std::array<float,2>{0.158869341f, 0.905722022f},
-std::array<float,2>{0.641047597f, 0.272501111f},
-std::array<float,2>{0.368665338f, 0.187506482f},
-std::array<float,2>{0.89491868f, 0.711690247f},
-std::array<float,2>{0.426948696f, 0.558273911f},
-std::array<float,2>{0.846330523f, 0.108712912f},
-std::array<float,2>{0.117520876f, 0.379439861f},
-std::array<float,2>{0.515361607f, 0.790580034f},
-std::array<float,2>{0.278998733f, 0.84615469f},
-std::array<float,2>{0.959562004f, 0.491039723f},
-std::array<float,2>{0.200598598f, 0.055639565f},
-std::array<float,2>{0.722989023f, 0.581553936f},
-std::array<float,2>{0.0404708721f, 0.67247659f},
-std::array<float,2>{0.584413469f, 0.170258448f},
-std::array<float,2>{0.468506813f, 0.315523982f},
-std::array<float,2>{0.765023589f, 0.942238092f},
-std::array<float,2>{0.112764619f, 0.916691184f},
-std::array<float,2>{0.505951345f, 0.293400615f},
-std::array<float,2>{0.429748178f, 0.24489966f},
-std::array<float,2>{0.857509971f, 0.720882952f},
-std::array<float,2>{0.360600531f, 0.512263119f},
-std::array<float,2>{0.902455211f, 0.0848326534f},
-std::array<float,2>{0.169133782f, 0.411259472f},
-std::array<float,2>{0.654115975f, 0.771616399f},
-std::array<float,2>{0.460677087f, 0.828062952f},
-std::array<float,2>{0.75467515f, 0.450710505f},
-std::array<float,2>{0.0371795595f, 0.0142513765f},
-std::array<float,2>{0.59036833f, 0.614121139f},
-std::array<float,2>{0.190917298f, 0.655166805f},
-std::array<float,2>{0.732413769f, 0.147712573f},
-std::array<float,2>{0.266697288f, 0.367045552f},
-std::array<float,2>{0.964333951f, 0.994758666f},
-std::array<float,2>{0.128292993f, 0.781381607f},
-std::array<float,2>{0.660072327f, 0.384747595f},
-std::array<float,2>{0.324965388f, 0.0970873907f},
-std::array<float,2>{0.933440089f, 0.552167177f},
-std::array<float,2>{0.403977424f, 0.706591368f},
-std::array<float,2>{0.815614879f, 0.198605165f},
-std::array<float,2>{0.063319698f, 0.279157937f},
-std::array<float,2>{0.540324271f, 0.893907607f},
-std::array<float,2>{0.284792662f, 0.949196756f},
-std::array<float,2>{0.995138109f, 0.323210686f},
-std::array<float,2>{0.222239166f, 0.161247447f},
-std::array<float,2>{0.709520876f, 0.68099916f},
-std::array<float,2>{0.023173688f, 0.589727938f},
-std::array<float,2>{0.618047893f, 0.0499685109f},
-std::array<float,2>{0.487536252f, 0.496224493f},
-std::array<float,2>{0.812001348f, 0.852385104f},
-std::array<float,2>{0.0484419055f, 0.861811876f},
-std::array<float,2>{0.574003577f, 0.471453607f},
-std::array<float,2>{0.44739747f, 0.0342081338f},
-std::array<float,2>{0.780902088f, 0.57597661f},
-std::array<float,2>{0.259599149f, 0.669927657f},
-std::array<float,2>{0.939201057f, 0.180452451f},
-std::array<float,2>{0.211738065f, 0.337549984f},
-std::array<float,2>{0.745265961f, 0.961100996f},
-std::array<float,2>{0.418385416f, 0.888722539f},
-std::array<float,2>{0.860522568f, 0.25883773f},
-std::array<float,2>{0.0978188589f, 0.214580327f},
-std::array<float,2>{0.523011208f, 0.688830495f},
-std::array<float,2>{0.172884956f, 0.53591603f},
-std::array<float,2>{0.628633857f, 0.119117878f},
-std::array<float,2>{0.351596743f, 0.39427191f},
-std::array<float,2>{0.889766634f, 0.799924731f},
-std::array<float,2>{0.235974312f, 0.978608191f},
-std::array<float,2>{0.692488909f, 0.354468107f},
-std::array<float,2>{0.301196098f, 0.127616063f},
-std::array<float,2>{0.977656007f, 0.629615903f},
-std::array<float,2>{0.4773193f, 0.599738359f},
-std::array<float,2>{0.78675276f, 0.021963492f},
-std::array<float,2>{0.00501899002f, 0.46211344f},
-std::array<float,2>{0.604697227f, 0.836169183f},
-std::array<float,2>{0.331372559f, 0.750885844f},
-std::array<float,2>{0.919342935f, 0.426014781f},
-std::array<float,2>{0.145487577f, 0.0771416128f},
-std::array<float,2>{0.673213363f, 0.528243542f},
-std::array<float,2>{0.0784441754f, 0.743346334f},
-std::array<float,2>{0.550746918f, 0.227714434f},
-std::array<float,2>{0.375608861f, 0.312302649f},
-std::array<float,2>{0.843721807f, 0.930657744f},
-std::array<float,2>{0.0258521102f, 0.883695006f},
-std::array<float,2>{0.613227308f, 0.264390677f},
-std::array<float,2>{0.499270588f, 0.217456773f},
-std::array<float,2>{0.801106811f, 0.692806959f},
-std::array<float,2>{0.29139927f, 0.53403008f},
-std::array<float,2>{0.987547934f, 0.124798059f},
-std::array<float,2>{0.232978463f, 0.398403436f},
-std::array<float,2>{0.712809861f, 0.801503599f},
-std::array<float,2>{0.393521935f, 0.864446938f},
-std::array<float,2>{0.828071177f, 0.473983258f},
-std::array<float,2>{0.073856391f, 0.0363633335f},
-std::array<float,2>{0.534487128f, 0.571180999f},
-std::array<float,2>{0.134233013f, 0.665282309f},
-std::array<float,2>{0.664734483f, 0.184501007f},
-std::array<float,2>{0.313719332f, 0.341412425f},
-std::array<float,2>{0.922815144f, 0.966469526f},
-std::array<float,2>{0.197603106f, 0.755629063f},
-std::array<float,2>{0.71905756f, 0.425329715f},
-std::array<float,2>{0.274963558f, 0.0733478814f},
-std::array<float,2>{0.954433441f, 0.525460303f},
-std::array<float,2>{0.461152792f, 0.746848404f},
-std::array<float,2>{0.759337425f, 0.23262915f},
-std::array<float,2>{0.0462971404f, 0.306331217f},
-std::array<float,2>{0.578803301f, 0.93407166f},
-std::array<float,2>{0.374596238f, 0.981195807f},
-std::array<float,2>{0.89196223f, 0.358382523f},
-std::array<float,2>{0.162520632f, 0.130291834f},
-std::array<float,2>{0.645093858f, 0.626707494f},
-std::array<float,2>{0.122274987f, 0.596289933f},
-std::array<float,2>{0.508745849f, 0.0189089328f},
-std::array<float,2>{0.422245264f, 0.465022296f},
-std::array<float,2>{0.851204574f, 0.840584874f},
-std::array<float,2>{0.0878377035f, 0.823737204f},
-std::array<float,2>{0.562423468f, 0.44918257f},
-std::array<float,2>{0.384586394f, 0.00874347892f},
-std::array<float,2>{0.829041958f, 0.612984717f},
-std::array<float,2>{0.341061264f, 0.651624382f},
-std::array<float,2>{0.912224174f, 0.140685394f},
-std::array<float,2>{0.150477916f, 0.361118406f},
-std::array<float,2>{0.687384248f, 0.999213994f},
-std::array<float,2>{0.470743358f, 0.91947037f},
-std::array<float,2>{0.795643866f, 0.29072082f},
-std::array<float,2>{0.0148092713f, 0.249639049f},
-std::array<float,2>{0.596322358f, 0.724090159f},
-std::array<float,2>{0.248345181f, 0.511581659f},
-std::array<float,2>{0.698465645f, 0.0816622302f},
-std::array<float,2>{0.306385368f, 0.409440935f},
-std::array<float,2>{0.972840011f, 0.76708883f},
-std::array<float,2>{0.184772491f, 0.951576531f},
-std::array<float,2>{0.636889935f, 0.326431155f},
-std::array<float,2>{0.347561568f, 0.15958184f},
-std::array<float,2>{0.876053154f, 0.685369611f},
-std::array<float,2>{0.410054684f, 0.592731416f},
-std::array<float,2>{0.871699989f, 0.0537582077f},
-std::array<float,2>{0.102825448f, 0.495681643f},
-std::array<float,2>{0.527225912f, 0.856432736f},
-std::array<float,2>{0.2551274f, 0.786660075f},
-std::array<float,2>{0.946434677f, 0.388530999f},
-std::array<float,2>{0.204544246f, 0.09797813f},
-std::array<float,2>{0.736074448f, 0.547251225f},
-std::array<float,2>{0.0568020195f, 0.70973134f},
-std::array<float,2>{0.570201516f, 0.200329036f},
-std::array<float,2>{0.442952275f, 0.27669704f},
-std::array<float,2>{0.766437531f, 0.898032606f},
-std::array<float,2>{0.0969092995f, 0.991420388f},
-std::array<float,2>{0.516117871f, 0.368783027f},
-std::array<float,2>{0.417059422f, 0.149890915f},
-std::array<float,2>{0.864944875f, 0.642944276f},
-std::array<float,2>{0.355552137f, 0.622037649f},
-std::array<float,2>{0.885191977f, 0.000194258391f},
-std::array<float,2>{0.179552525f, 0.439338326f},
-std::array<float,2>{0.629683018f, 0.812690616f},
-std::array<float,2>{0.451325059f, 0.781224847f},
-std::array<float,2>{0.776203394f, 0.41731739f},
-std::array<float,2>{0.0523864143f, 0.0891545117f},
-std::array<float,2>{0.574508369f, 0.503401518f},
-std::array<float,2>{0.217394859f, 0.732758641f},
-std::array<float,2>{0.747971177f, 0.238158017f},
-std::array<float,2>{0.265322059f, 0.287657589f},
-std::array<float,2>{0.945236921f, 0.9077847f},
-std::array<float,2>{0.143776387f, 0.849204242f},
-std::array<float,2>{0.677263618f, 0.48555854f},
-std::array<float,2>{0.333017319f, 0.0621130727f},
-std::array<float,2>{0.914722443f, 0.585890591f},
-std::array<float,2>{0.381653279f, 0.677652478f},
-std::array<float,2>{0.839060128f, 0.167868838f},
-std::array<float,2>{0.0826277956f, 0.319570839f},
-std::array<float,2>{0.553341568f, 0.938744009f},
-std::array<float,2>{0.300122201f, 0.900317311f},
-std::array<float,2>{0.982480645f, 0.268022448f},
-std::array<float,2>{0.239132032f, 0.192064419f},
-std::array<float,2>{0.687572122f, 0.717976332f},
-std::array<float,2>{0.00224196794f, 0.560005903f},
-std::array<float,2>{0.606136441f, 0.102892756f},
-std::array<float,2>{0.481874526f, 0.376263112f},
-std::array<float,2>{0.784362853f, 0.793184102f},
-std::array<float,2>{0.0319371484f, 0.807257771f},
-std::array<float,2>{0.586211145f, 0.399144799f},
-std::array<float,2>{0.456446826f, 0.114561528f},
-std::array<float,2>{0.750852227f, 0.542930901f},
-std::array<float,2>{0.273426652f, 0.698934317f},
-std::array<float,2>{0.968511939f, 0.204875022f},
-std::array<float,2>{0.192745507f, 0.251550198f},
-std::array<float,2>{0.727594316f, 0.875119388f},
-std::array<float,2>{0.43726182f, 0.959167719f},
-std::array<float,2>{0.853809416f, 0.334250003f},
-std::array<float,2>{0.117051922f, 0.173349172f},
-std::array<float,2>{0.501821637f, 0.660283804f},
-std::array<float,2>{0.164672077f, 0.565464139f},
-std::array<float,2>{0.648447275f, 0.043343965f},
-std::array<float,2>{0.364566773f, 0.481208265f},
-std::array<float,2>{0.900273323f, 0.873835504f},
-std::array<float,2>{0.224073887f, 0.926363647f},
-std::array<float,2>{0.705396056f, 0.304256111f},
-std::array<float,2>{0.285909712f, 0.223765671f},
-std::array<float,2>{0.998416424f, 0.737341762f},
-std::array<float,2>{0.489311516f, 0.521847129f},
-std::array<float,2>{0.807308078f, 0.0701741427f},
-std::array<float,2>{0.0165864993f, 0.432019472f},
-std::array<float,2>{0.622824848f, 0.759693801f},
-std::array<float,2>{0.320658386f, 0.833631456f},
-std::array<float,2>{0.934361398f, 0.458772808f},
-std::array<float,2>{0.130901694f, 0.0283760186f},
-std::array<float,2>{0.661402524f, 0.609175384f},
-std::array<float,2>{0.069348827f, 0.635093689f},
-std::array<float,2>{0.544031799f, 0.132968515f},
-std::array<float,2>{0.402206868f, 0.349602014f},
-std::array<float,2>{0.82001847f, 0.973962605f},
-std::array<float,2>{0.0505692847f, 0.961908698f},
-std::array<float,2>{0.571145952f, 0.337145209f},
-std::array<float,2>{0.445553333f, 0.17984347f},
-std::array<float,2>{0.778755903f, 0.670880973f},
-std::array<float,2>{0.259786099f, 0.575299501f},
-std::array<float,2>{0.939498246f, 0.0346810855f},
-std::array<float,2>{0.213272676f, 0.470917255f},
-std::array<float,2>{0.742689192f, 0.862240076f},
-std::array<float,2>{0.421222329f, 0.800610065f},
-std::array<float,2>{0.861833274f, 0.393695235f},
-std::array<float,2>{0.0997712314f, 0.118254274f},
-std::array<float,2>{0.519535542f, 0.53525269f},
-std::array<float,2>{0.175020486f, 0.689304888f},
-std::array<float,2>{0.62604624f, 0.214017481f},
-std::array<float,2>{0.354365885f, 0.259434283f},
-std::array<float,2>{0.887429833f, 0.889629543f},
-std::array<float,2>{0.237594828f, 0.836791515f},
-std::array<float,2>{0.694553733f, 0.462439895f},
-std::array<float,2>{0.302893281f, 0.0222038645f},
-std::array<float,2>{0.978687346f, 0.600408316f},
-std::array<float,2>{0.479423314f, 0.629347146f},
-std::array<float,2>{0.788310468f, 0.127030239f},
-std::array<float,2>{0.00754520437f, 0.353955477f},
-std::array<float,2>{0.601678431f, 0.979123592f},
-std::array<float,2>{0.329256088f, 0.929708481f},
-std::array<float,2>{0.920563817f, 0.311854094f},
-std::array<float,2>{0.147379458f, 0.228076264f},
-std::array<float,2>{0.674492598f, 0.74368459f},
-std::array<float,2>{0.080366008f, 0.527798712f},
-std::array<float,2>{0.548255682f, 0.0763695315f},
-std::array<float,2>{0.378648609f, 0.426734239f},
-std::array<float,2>{0.840180397f, 0.750326216f},
-std::array<float,2>{0.110727191f, 0.772232711f},
-std::array<float,2>{0.505000234f, 0.411766827f},
-std::array<float,2>{0.432501793f, 0.0842740983f},
-std::array<float,2>{0.855637729f, 0.511821032f},
-std::array<float,2>{0.361906767f, 0.721376181f},
-std::array<float,2>{0.90444082f, 0.244572118f},
-std::array<float,2>{0.170811057f, 0.293637544f},
-std::array<float,2>{0.655891478f, 0.916445315f},
-std::array<float,2>{0.457941145f, 0.994435251f},
-std::array<float,2>{0.756114125f, 0.366453469f},
-std::array<float,2>{0.0365161709f, 0.148236156f},
-std::array<float,2>{0.592504084f, 0.65462482f},
-std::array<float,2>{0.188921392f, 0.61349386f},
-std::array<float,2>{0.732809126f, 0.0138127785f},
-std::array<float,2>{0.269391954f, 0.450650215f},
-std::array<float,2>{0.962546051f, 0.827343464f},
-std::array<float,2>{0.126474962f, 0.894071937f},
-std::array<float,2>{0.657112658f, 0.278689653f},
-std::array<float,2>{0.32713902f, 0.198781878f},
-std::array<float,2>{0.929830313f, 0.706160724f},
-std::array<float,2>{0.405084491f, 0.552305281f},
-std::array<float,2>{0.813040733f, 0.0974513143f},
-std::array<float,2>{0.0647834092f, 0.384114206f},
-std::array<float,2>{0.541925848f, 0.782219708f},
-std::array<float,2>{0.281805933f, 0.851834595f},
-std::array<float,2>{0.992263138f, 0.496819586f},
-std::array<float,2>{0.220021039f, 0.0507159196f},
-std::array<float,2>{0.708192587f, 0.588990092f},
-std::array<float,2>{0.0200915728f, 0.681192636f},
-std::array<float,2>{0.620143473f, 0.161877275f},
-std::array<float,2>{0.485010237f, 0.32275027f},
-std::array<float,2>{0.809405088f, 0.948449194f},
-std::array<float,2>{0.0743225068f, 0.910927236f},
-std::array<float,2>{0.537631869f, 0.284599304f},
-std::array<float,2>{0.395508587f, 0.239412948f},
-std::array<float,2>{0.821813464f, 0.730022073f},
-std::array<float,2>{0.317922145f, 0.505437493f},
-std::array<float,2>{0.926546395f, 0.0922537297f},
-std::array<float,2>{0.136997953f, 0.421440244f},
-std::array<float,2>{0.671479404f, 0.773624241f},
-std::array<float,2>{0.492321223f, 0.816409647f},
-std::array<float,2>{0.798661053f, 0.443415821f},
-std::array<float,2>{0.0287683643f, 0.00509184506f},
-std::array<float,2>{0.616866767f, 0.619410217f},
-std::array<float,2>{0.227840081f, 0.647955298f},
-std::array<float,2>{0.718149424f, 0.154527873f},
-std::array<float,2>{0.295154601f, 0.373712331f},
-std::array<float,2>{0.988655925f, 0.9854514f},
-std::array<float,2>{0.157064974f, 0.790431738f},
-std::array<float,2>{0.643759012f, 0.379093766f},
-std::array<float,2>{0.369429082f, 0.109239615f},
-std::array<float,2>{0.898269773f, 0.557995141f},
-std::array<float,2>{0.428110152f, 0.711373329f},
-std::array<float,2>{0.84537971f, 0.188183308f},
-std::array<float,2>{0.12096525f, 0.273163557f},
-std::array<float,2>{0.512025297f, 0.906054556f},
-std::array<float,2>{0.280214041f, 0.941621959f},
-std::array<float,2>{0.957657874f, 0.316131026f},
-std::array<float,2>{0.202823579f, 0.170420676f},
-std::array<float,2>{0.72530061f, 0.672079146f},
-std::array<float,2>{0.0427820534f, 0.581121981f},
-std::array<float,2>{0.582674682f, 0.0551229976f},
-std::array<float,2>{0.465153903f, 0.490517646f},
-std::array<float,2>{0.762911797f, 0.84654969f},
-std::array<float,2>{0.00976632535f, 0.868896663f},
-std::array<float,2>{0.600767314f, 0.479952842f},
-std::array<float,2>{0.472864687f, 0.0398501009f},
-std::array<float,2>{0.792270601f, 0.569586694f},
-std::array<float,2>{0.31090042f, 0.656467617f},
-std::array<float,2>{0.969848573f, 0.177690938f},
-std::array<float,2>{0.245337635f, 0.330329329f},
-std::array<float,2>{0.702519596f, 0.955178976f},
-std::array<float,2>{0.388651043f, 0.880628109f},
-std::array<float,2>{0.833273888f, 0.25413835f},
-std::array<float,2>{0.0904413313f, 0.207172334f},
-std::array<float,2>{0.555738747f, 0.701929867f},
-std::array<float,2>{0.153702527f, 0.54454869f},
-std::array<float,2>{0.683301091f, 0.111257546f},
-std::array<float,2>{0.336689711f, 0.406241864f},
-std::array<float,2>{0.909050047f, 0.812173128f},
-std::array<float,2>{0.207820475f, 0.970148802f},
-std::array<float,2>{0.739956558f, 0.346868217f},
-std::array<float,2>{0.253089458f, 0.138437033f},
-std::array<float,2>{0.949450672f, 0.638020456f},
-std::array<float,2>{0.441403568f, 0.604850829f},
-std::array<float,2>{0.771218121f, 0.0269004945f},
-std::array<float,2>{0.0597931743f, 0.456986874f},
-std::array<float,2>{0.564249516f, 0.829969168f},
-std::array<float,2>{0.348503202f, 0.762496412f},
-std::array<float,2>{0.879285097f, 0.437300354f},
-std::array<float,2>{0.182365254f, 0.0636674091f},
-std::array<float,2>{0.63299495f, 0.516138971f},
-std::array<float,2>{0.105836712f, 0.740503669f},
-std::array<float,2>{0.528265893f, 0.221274123f},
-std::array<float,2>{0.41345796f, 0.298254848f},
-std::array<float,2>{0.868729711f, 0.924050272f},
-std::array<float,2>{0.0433046073f, 0.935642958f},
-std::array<float,2>{0.581942976f, 0.30830121f},
-std::array<float,2>{0.463848859f, 0.231449723f},
-std::array<float,2>{0.760287464f, 0.748351693f},
-std::array<float,2>{0.276709855f, 0.523718476f},
-std::array<float,2>{0.95538038f, 0.0712445676f},
-std::array<float,2>{0.195937589f, 0.423628896f},
-std::array<float,2>{0.721875072f, 0.7564767f},
-std::array<float,2>{0.425561547f, 0.842724204f},
-std::array<float,2>{0.848924339f, 0.468128413f},
-std::array<float,2>{0.123581797f, 0.0170631297f},
-std::array<float,2>{0.510071814f, 0.594736278f},
-std::array<float,2>{0.160393476f, 0.628168225f},
-std::array<float,2>{0.648038328f, 0.131354094f},
-std::array<float,2>{0.371762156f, 0.355917484f},
-std::array<float,2>{0.893629849f, 0.983433127f},
-std::array<float,2>{0.232176289f, 0.803606331f},
-std::array<float,2>{0.714381397f, 0.395202518f},
-std::array<float,2>{0.289127409f, 0.122338392f},
-std::array<float,2>{0.98550272f, 0.53232342f},
-std::array<float,2>{0.497884095f, 0.694995224f},
-std::array<float,2>{0.803668499f, 0.216463104f},
-std::array<float,2>{0.0242731646f, 0.262764364f},
-std::array<float,2>{0.609463513f, 0.886163592f},
-std::array<float,2>{0.316201538f, 0.966890991f},
-std::array<float,2>{0.924315631f, 0.342962265f},
-std::array<float,2>{0.134870902f, 0.186208516f},
-std::array<float,2>{0.667109728f, 0.667360663f},
-std::array<float,2>{0.0712713078f, 0.574185848f},
-std::array<float,2>{0.53279686f, 0.0386255346f},
-std::array<float,2>{0.392276049f, 0.475634575f},
-std::array<float,2>{0.824528515f, 0.866053402f},
-std::array<float,2>{0.10404104f, 0.857460439f},
-std::array<float,2>{0.524084568f, 0.49243629f},
-std::array<float,2>{0.40713653f, 0.0508692525f},
-std::array<float,2>{0.874993801f, 0.590160072f},
-std::array<float,2>{0.344668448f, 0.686645985f},
-std::array<float,2>{0.877239823f, 0.157532007f},
-std::array<float,2>{0.185963154f, 0.32450524f},
-std::array<float,2>{0.63997376f, 0.950205445f},
-std::array<float,2>{0.44407931f, 0.895221651f},
-std::array<float,2>{0.767670453f, 0.273814619f},
-std::array<float,2>{0.055793412f, 0.202287927f},
-std::array<float,2>{0.567168772f, 0.708646953f},
-std::array<float,2>{0.206520215f, 0.550431728f},
-std::array<float,2>{0.737778068f, 0.100593828f},
-std::array<float,2>{0.257454634f, 0.389513135f},
-std::array<float,2>{0.948101938f, 0.788143635f},
-std::array<float,2>{0.149984166f, 0.996468842f},
-std::array<float,2>{0.684136331f, 0.361381859f},
-std::array<float,2>{0.343551129f, 0.143267021f},
-std::array<float,2>{0.911222398f, 0.64880532f},
-std::array<float,2>{0.385377407f, 0.610150278f},
-std::array<float,2>{0.830093861f, 0.0104537383f},
-std::array<float,2>{0.0890307352f, 0.44668743f},
-std::array<float,2>{0.56019628f, 0.821509182f},
-std::array<float,2>{0.308181763f, 0.769443333f},
-std::array<float,2>{0.976029336f, 0.407689333f},
-std::array<float,2>{0.247671425f, 0.0798971802f},
-std::array<float,2>{0.696894228f, 0.50873363f},
-std::array<float,2>{0.0124355098f, 0.725095034f},
-std::array<float,2>{0.593988121f, 0.247336015f},
-std::array<float,2>{0.469942957f, 0.291767091f},
-std::array<float,2>{0.794696152f, 0.920980513f},
-std::array<float,2>{0.085198015f, 0.940270126f},
-std::array<float,2>{0.551707745f, 0.317758054f},
-std::array<float,2>{0.37927109f, 0.165845022f},
-std::array<float,2>{0.836368918f, 0.678199232f},
-std::array<float,2>{0.335600585f, 0.582920432f},
-std::array<float,2>{0.917480052f, 0.0593929701f},
-std::array<float,2>{0.141406059f, 0.486637443f},
-std::array<float,2>{0.679086506f, 0.850583255f},
-std::array<float,2>{0.48316887f, 0.796097815f},
-std::array<float,2>{0.781908393f, 0.378891349f},
-std::array<float,2>{0.00146305293f, 0.105217762f},
-std::array<float,2>{0.608296692f, 0.56223309f},
-std::array<float,2>{0.241501629f, 0.715797722f},
-std::array<float,2>{0.689483523f, 0.194012105f},
-std::array<float,2>{0.297302842f, 0.266048312f},
-std::array<float,2>{0.980602801f, 0.901832461f},
-std::array<float,2>{0.176391751f, 0.814571977f},
-std::array<float,2>{0.632811606f, 0.440031052f},
-std::array<float,2>{0.358887315f, 0.00242180564f},
-std::array<float,2>{0.883496583f, 0.624409199f},
-std::array<float,2>{0.414636016f, 0.640706778f},
-std::array<float,2>{0.866526902f, 0.15060924f},
-std::array<float,2>{0.0943797603f, 0.3699148f},
-std::array<float,2>{0.518991232f, 0.989345312f},
-std::array<float,2>{0.261954308f, 0.909498096f},
-std::array<float,2>{0.942177534f, 0.286054343f},
-std::array<float,2>{0.215427071f, 0.235439032f},
-std::array<float,2>{0.748731434f, 0.732406676f},
-std::array<float,2>{0.0544586666f, 0.501751423f},
-std::array<float,2>{0.57637918f, 0.0869070888f},
-std::array<float,2>{0.450192481f, 0.414757997f},
-std::array<float,2>{0.77453959f, 0.778946221f},
-std::array<float,2>{0.019449776f, 0.761316597f},
-std::array<float,2>{0.624571919f, 0.430453777f},
-std::array<float,2>{0.490650415f, 0.0667942911f},
-std::array<float,2>{0.805880845f, 0.519671917f},
-std::array<float,2>{0.288689524f, 0.734413028f},
-std::array<float,2>{0.99789536f, 0.225710064f},
-std::array<float,2>{0.22554931f, 0.302637219f},
-std::array<float,2>{0.704452038f, 0.927838385f},
-std::array<float,2>{0.399884939f, 0.976323307f},
-std::array<float,2>{0.816445649f, 0.35010004f},
-std::array<float,2>{0.0671432689f, 0.134915918f},
-std::array<float,2>{0.54545939f, 0.633011222f},
-std::array<float,2>{0.130792528f, 0.606062651f},
-std::array<float,2>{0.663781464f, 0.0296717416f},
-std::array<float,2>{0.323156506f, 0.459465384f},
-std::array<float,2>{0.936582029f, 0.835625589f},
-std::array<float,2>{0.19413434f, 0.877289414f},
-std::array<float,2>{0.730112612f, 0.252189696f},
-std::array<float,2>{0.270785093f, 0.206615835f},
-std::array<float,2>{0.965359926f, 0.695877969f},
-std::array<float,2>{0.453610271f, 0.539519727f},
-std::array<float,2>{0.75281924f, 0.115242705f},
-std::array<float,2>{0.0345905423f, 0.401283622f},
-std::array<float,2>{0.589605331f, 0.80554229f},
-std::array<float,2>{0.36655125f, 0.87246722f},
-std::array<float,2>{0.900568247f, 0.48310867f},
-std::array<float,2>{0.167772159f, 0.0450129025f},
-std::array<float,2>{0.651071727f, 0.563577473f},
-std::array<float,2>{0.114292242f, 0.663842142f},
-std::array<float,2>{0.503895104f, 0.174540192f},
-std::array<float,2>{0.433835149f, 0.332057923f},
-std::array<float,2>{0.852597117f, 0.958174288f},
-std::array<float,2>{0.00574059691f, 0.978152454f},
-std::array<float,2>{0.605467021f, 0.352168471f},
-std::array<float,2>{0.476883709f, 0.126092091f},
-std::array<float,2>{0.786610901f, 0.631758809f},
-std::array<float,2>{0.301486969f, 0.59940052f},
-std::array<float,2>{0.978210688f, 0.0211309828f},
-std::array<float,2>{0.235781759f, 0.463025063f},
-std::array<float,2>{0.693169713f, 0.838107347f},
-std::array<float,2>{0.375268459f, 0.753276944f},
-std::array<float,2>{0.84290117f, 0.427759975f},
-std::array<float,2>{0.0789783597f, 0.0749933124f},
-std::array<float,2>{0.549886942f, 0.530906856f},
-std::array<float,2>{0.144720525f, 0.744864821f},
-std::array<float,2>{0.673811376f, 0.22986351f},
-std::array<float,2>{0.331881404f, 0.309087276f},
-std::array<float,2>{0.919532835f, 0.932655692f},
-std::array<float,2>{0.211167306f, 0.86023587f},
-std::array<float,2>{0.746050656f, 0.46875307f},
-std::array<float,2>{0.258817285f, 0.0317965709f},
-std::array<float,2>{0.938550949f, 0.57652241f},
-std::array<float,2>{0.448153347f, 0.66960001f},
-std::array<float,2>{0.780304492f, 0.18274039f},
-std::array<float,2>{0.0483272821f, 0.338108152f},
-std::array<float,2>{0.573375642f, 0.964556813f},
-std::array<float,2>{0.35219267f, 0.887524366f},
-std::array<float,2>{0.890485168f, 0.261020571f},
-std::array<float,2>{0.173404574f, 0.212345913f},
-std::array<float,2>{0.628122032f, 0.690345049f},
-std::array<float,2>{0.098402217f, 0.538217306f},
-std::array<float,2>{0.522726476f, 0.120751828f},
-std::array<float,2>{0.418485582f, 0.392444104f},
-std::array<float,2>{0.860897839f, 0.798563302f},
-std::array<float,2>{0.0626990125f, 0.784585595f},
-std::array<float,2>{0.54087466f, 0.385908186f},
-std::array<float,2>{0.403389871f, 0.0945362076f},
-std::array<float,2>{0.816360056f, 0.553045511f},
-std::array<float,2>{0.324235439f, 0.70356375f},
-std::array<float,2>{0.932754517f, 0.19682318f},
-std::array<float,2>{0.128748581f, 0.27946192f},
-std::array<float,2>{0.659411848f, 0.892376482f},
-std::array<float,2>{0.488015711f, 0.946550548f},
-std::array<float,2>{0.8120538f, 0.321913928f},
-std::array<float,2>{0.022728581f, 0.163303226f},
-std::array<float,2>{0.617563009f, 0.682008922f},
-std::array<float,2>{0.221727073f, 0.586652577f},
-std::array<float,2>{0.709115207f, 0.0472711809f},
-std::array<float,2>{0.28445372f, 0.499999821f},
-std::array<float,2>{0.995758593f, 0.853515923f},
-std::array<float,2>{0.16962263f, 0.914598584f},
-std::array<float,2>{0.653451264f, 0.295875639f},
-std::array<float,2>{0.360960126f, 0.243545353f},
-std::array<float,2>{0.902991414f, 0.719357014f},
-std::array<float,2>{0.430261582f, 0.514086604f},
-std::array<float,2>{0.858195305f, 0.0829272717f},
-std::array<float,2>{0.112848587f, 0.412117302f},
-std::array<float,2>{0.506355286f, 0.77063638f},
-std::array<float,2>{0.267396152f, 0.825285733f},
-std::array<float,2>{0.964775383f, 0.452958345f},
-std::array<float,2>{0.191191465f, 0.0128967706f},
-std::array<float,2>{0.731574833f, 0.615693867f},
-std::array<float,2>{0.038081225f, 0.652547359f},
-std::array<float,2>{0.59014076f, 0.146093562f},
-std::array<float,2>{0.459973186f, 0.363419712f},
-std::array<float,2>{0.754249156f, 0.993733764f},
-std::array<float,2>{0.117788382f, 0.903040111f},
-std::array<float,2>{0.514997005f, 0.269735128f},
-std::array<float,2>{0.427667737f, 0.189741045f},
-std::array<float,2>{0.845897079f, 0.714241564f},
-std::array<float,2>{0.368249476f, 0.55526948f},
-std::array<float,2>{0.895254314f, 0.105672792f},
-std::array<float,2>{0.158384964f, 0.382207096f},
-std::array<float,2>{0.641140461f, 0.792834163f},
-std::array<float,2>{0.467799783f, 0.844671607f},
-std::array<float,2>{0.76553297f, 0.488367051f},
-std::array<float,2>{0.0408320278f, 0.0569994189f},
-std::array<float,2>{0.584909439f, 0.5789904f},
-std::array<float,2>{0.201053992f, 0.674807131f},
-std::array<float,2>{0.723576307f, 0.168721184f},
-std::array<float,2>{0.278692305f, 0.313269019f},
-std::array<float,2>{0.959367394f, 0.944953084f},
-std::array<float,2>{0.140357107f, 0.775558591f},
-std::array<float,2>{0.668393254f, 0.419755876f},
-std::array<float,2>{0.319945693f, 0.0909526944f},
-std::array<float,2>{0.929081559f, 0.506457746f},
-std::array<float,2>{0.39801991f, 0.726890385f},
-std::array<float,2>{0.823974431f, 0.24086915f},
-std::array<float,2>{0.0766156837f, 0.281541169f},
-std::array<float,2>{0.536866188f, 0.912507832f},
-std::array<float,2>{0.294131845f, 0.987929344f},
-std::array<float,2>{0.990772128f, 0.372247875f},
-std::array<float,2>{0.229125515f, 0.15302512f},
-std::array<float,2>{0.716737688f, 0.645425379f},
-std::array<float,2>{0.0304763019f, 0.61823827f},
-std::array<float,2>{0.613982856f, 0.0074805934f},
-std::array<float,2>{0.494845212f, 0.442597628f},
-std::array<float,2>{0.799437106f, 0.820230365f},
-std::array<float,2>{0.0620299689f, 0.830817699f},
-std::array<float,2>{0.565933466f, 0.453684539f},
-std::array<float,2>{0.437909424f, 0.0244503394f},
-std::array<float,2>{0.772558987f, 0.6025365f},
-std::array<float,2>{0.250273496f, 0.639940679f},
-std::array<float,2>{0.951212466f, 0.139266878f},
-std::array<float,2>{0.210250735f, 0.345653415f},
-std::array<float,2>{0.741884172f, 0.971626878f},
-std::array<float,2>{0.410726935f, 0.922293305f},
-std::array<float,2>{0.869988084f, 0.300286263f},
-std::array<float,2>{0.107608274f, 0.220041379f},
-std::array<float,2>{0.530084491f, 0.739455581f},
-std::array<float,2>{0.179811686f, 0.517990708f},
-std::array<float,2>{0.636714458f, 0.0651288107f},
-std::array<float,2>{0.350913078f, 0.435074717f},
-std::array<float,2>{0.882369936f, 0.7655195f},
-std::array<float,2>{0.24306871f, 0.953267097f},
-std::array<float,2>{0.700515747f, 0.328620702f},
-std::array<float,2>{0.309195727f, 0.179331973f},
-std::array<float,2>{0.971891165f, 0.658746004f},
-std::array<float,2>{0.47490108f, 0.566798091f},
-std::array<float,2>{0.790376365f, 0.0424237736f},
-std::array<float,2>{0.00886099786f, 0.478125602f},
-std::array<float,2>{0.598503113f, 0.869251966f},
-std::array<float,2>{0.33839798f, 0.810171127f},
-std::array<float,2>{0.907979906f, 0.40410161f},
-std::array<float,2>{0.15615277f, 0.112231843f},
-std::array<float,2>{0.68039465f, 0.545605898f},
-std::array<float,2>{0.0931059122f, 0.700592399f},
-std::array<float,2>{0.55739224f, 0.210372701f},
-std::array<float,2>{0.388899833f, 0.257022709f},
-std::array<float,2>{0.834433079f, 0.88231504f},
-std::array<float,2>{0.0146073774f, 0.919933081f},
-std::array<float,2>{0.597465098f, 0.292423189f},
-std::array<float,2>{0.472488582f, 0.246640801f},
-std::array<float,2>{0.796038032f, 0.725942433f},
-std::array<float,2>{0.304854602f, 0.509164512f},
-std::array<float,2>{0.974090338f, 0.0784660131f},
-std::array<float,2>{0.249029934f, 0.406373978f},
-std::array<float,2>{0.697939157f, 0.767896533f},
-std::array<float,2>{0.383746237f, 0.820933521f},
-std::array<float,2>{0.830043137f, 0.445908308f},
-std::array<float,2>{0.0867987648f, 0.0108896298f},
-std::array<float,2>{0.560803056f, 0.61119473f},
-std::array<float,2>{0.151743263f, 0.650388837f},
-std::array<float,2>{0.685655713f, 0.144527674f},
-std::array<float,2>{0.340246767f, 0.362449318f},
-std::array<float,2>{0.914027095f, 0.997343481f},
-std::array<float,2>{0.203857332f, 0.787628829f},
-std::array<float,2>{0.734814703f, 0.390266448f},
-std::array<float,2>{0.254326403f, 0.0996554792f},
-std::array<float,2>{0.945549786f, 0.549094319f},
-std::array<float,2>{0.442206055f, 0.707943082f},
-std::array<float,2>{0.767286777f, 0.202117532f},
-std::array<float,2>{0.0576926433f, 0.274824589f},
-std::array<float,2>{0.568751156f, 0.895868123f},
-std::array<float,2>{0.345761061f, 0.949736059f},
-std::array<float,2>{0.875547945f, 0.325412512f},
-std::array<float,2>{0.18419975f, 0.156444475f},
-std::array<float,2>{0.638499022f, 0.685769737f},
-std::array<float,2>{0.101732552f, 0.591340303f},
-std::array<float,2>{0.525479496f, 0.0518061556f},
-std::array<float,2>{0.409033805f, 0.493598551f},
-std::array<float,2>{0.872671723f, 0.859177351f},
-std::array<float,2>{0.0729808658f, 0.866220236f},
-std::array<float,2>{0.533602238f, 0.475049078f},
-std::array<float,2>{0.393835217f, 0.0378966033f},
-std::array<float,2>{0.826198697f, 0.572615921f},
-std::array<float,2>{0.313459843f, 0.66662389f},
-std::array<float,2>{0.923092365f, 0.186903596f},
-std::array<float,2>{0.132817373f, 0.342278659f},
-std::array<float,2>{0.665413797f, 0.96789211f},
-std::array<float,2>{0.498938173f, 0.885255933f},
-std::array<float,2>{0.801825285f, 0.26253736f},
-std::array<float,2>{0.0264126584f, 0.215197191f},
-std::array<float,2>{0.612257361f, 0.693836033f},
-std::array<float,2>{0.233603761f, 0.531700075f},
-std::array<float,2>{0.711779475f, 0.121213593f},
-std::array<float,2>{0.292337f, 0.396433502f},
-std::array<float,2>{0.987219214f, 0.803791404f},
-std::array<float,2>{0.163483039f, 0.982597828f},
-std::array<float,2>{0.646088779f, 0.357401043f},
-std::array<float,2>{0.373129696f, 0.132220954f},
-std::array<float,2>{0.890659869f, 0.627629042f},
-std::array<float,2>{0.42285198f, 0.594493687f},
-std::array<float,2>{0.85044992f, 0.01607625f},
-std::array<float,2>{0.121130839f, 0.467001736f},
-std::array<float,2>{0.509539723f, 0.843063891f},
-std::array<float,2>{0.274405301f, 0.757117271f},
-std::array<float,2>{0.953598976f, 0.422194749f},
-std::array<float,2>{0.199015722f, 0.072001867f},
-std::array<float,2>{0.720025778f, 0.525169075f},
-std::array<float,2>{0.0450301766f, 0.749076247f},
-std::array<float,2>{0.579424798f, 0.231088027f},
-std::array<float,2>{0.462282419f, 0.306720853f},
-std::array<float,2>{0.75782162f, 0.937061965f},
-std::array<float,2>{0.116010107f, 0.957244515f},
-std::array<float,2>{0.50025326f, 0.333337814f},
-std::array<float,2>{0.435952663f, 0.175763473f},
-std::array<float,2>{0.855394006f, 0.662385941f},
-std::array<float,2>{0.363921851f, 0.562771618f},
-std::array<float,2>{0.89893049f, 0.0462066047f},
-std::array<float,2>{0.165125862f, 0.483866751f},
-std::array<float,2>{0.649962068f, 0.871137977f},
-std::array<float,2>{0.456022143f, 0.805976152f},
-std::array<float,2>{0.751072824f, 0.401633114f},
-std::array<float,2>{0.0330437757f, 0.116797149f},
-std::array<float,2>{0.587837696f, 0.540381491f},
-std::array<float,2>{0.192079186f, 0.696920514f},
-std::array<float,2>{0.727388978f, 0.205305964f},
-std::array<float,2>{0.271485686f, 0.253437281f},
-std::array<float,2>{0.967740059f, 0.878432453f},
-std::array<float,2>{0.13187626f, 0.834672093f},
-std::array<float,2>{0.66034925f, 0.460087508f},
-std::array<float,2>{0.322126716f, 0.0305487271f},
-std::array<float,2>{0.934967279f, 0.607264638f},
-std::array<float,2>{0.400723696f, 0.63411206f},
-std::array<float,2>{0.819108069f, 0.135995582f},
-std::array<float,2>{0.0688836128f, 0.351018608f},
-std::array<float,2>{0.543625236f, 0.974638999f},
-std::array<float,2>{0.287103027f, 0.928735614f},
-std::array<float,2>{0.99941659f, 0.300877422f},
-std::array<float,2>{0.223155707f, 0.224898517f},
-std::array<float,2>{0.70646584f, 0.736217082f},
-std::array<float,2>{0.0170031078f, 0.52118957f},
-std::array<float,2>{0.621198952f, 0.0682530999f},
-std::array<float,2>{0.489051551f, 0.431230068f},
-std::array<float,2>{0.808394551f, 0.759992301f},
-std::array<float,2>{0.0517503731f, 0.778140187f},
-std::array<float,2>{0.576001644f, 0.415833652f},
-std::array<float,2>{0.45301035f, 0.0874027312f},
-std::array<float,2>{0.776691198f, 0.500002146f},
-std::array<float,2>{0.264247388f, 0.730840802f},
-std::array<float,2>{0.944204152f, 0.235073105f},
-std::array<float,2>{0.218535617f, 0.286356091f},
-std::array<float,2>{0.747062862f, 0.908983648f},
-std::array<float,2>{0.416709304f, 0.988517702f},
-std::array<float,2>{0.864083171f, 0.370472997f},
-std::array<float,2>{0.0965442434f, 0.151840702f},
-std::array<float,2>{0.517089605f, 0.64246279f},
-std::array<float,2>{0.177785501f, 0.623308957f},
-std::array<float,2>{0.63065809f, 0.00326529401f},
-std::array<float,2>{0.356503487f, 0.440737337f},
-std::array<float,2>{0.886224329f, 0.815484107f},
-std::array<float,2>{0.239282727f, 0.900739372f},
-std::array<float,2>{0.688869238f, 0.266942173f},
-std::array<float,2>{0.299726814f, 0.194571376f},
-std::array<float,2>{0.983833909f, 0.716290355f},
-std::array<float,2>{0.481241196f, 0.561481655f},
-std::array<float,2>{0.784068704f, 0.104331218f},
-std::array<float,2>{0.00306887436f, 0.377617925f},
-std::array<float,2>{0.607195854f, 0.795075357f},
-std::array<float,2>{0.333005786f, 0.851410985f},
-std::array<float,2>{0.915132701f, 0.48735851f},
-std::array<float,2>{0.142869264f, 0.0600351393f},
-std::array<float,2>{0.676479995f, 0.583639443f},
-std::array<float,2>{0.0839219168f, 0.67951268f},
-std::array<float,2>{0.554329276f, 0.164141759f},
-std::array<float,2>{0.38271445f, 0.316424072f},
-std::array<float,2>{0.838561714f, 0.941403866f},
-std::array<float,2>{0.0359692499f, 0.992712677f},
-std::array<float,2>{0.593492031f, 0.3651779f},
-std::array<float,2>{0.458836019f, 0.145457178f},
-std::array<float,2>{0.757528365f, 0.65392518f},
-std::array<float,2>{0.267759651f, 0.617043436f},
-std::array<float,2>{0.961859643f, 0.0121008251f},
-std::array<float,2>{0.187960461f, 0.451576173f},
-std::array<float,2>{0.733412802f, 0.825000405f},
-std::array<float,2>{0.433487475f, 0.769863665f},
-std::array<float,2>{0.856446683f, 0.414027572f},
-std::array<float,2>{0.109717436f, 0.0835430324f},
-std::array<float,2>{0.504512131f, 0.515285373f},
-std::array<float,2>{0.171534106f, 0.720345259f},
-std::array<float,2>{0.65434736f, 0.24251844f},
-std::array<float,2>{0.362881154f, 0.296382815f},
-std::array<float,2>{0.905588031f, 0.915633023f},
-std::array<float,2>{0.219691187f, 0.854835331f},
-std::array<float,2>{0.707531631f, 0.498955607f},
-std::array<float,2>{0.283168763f, 0.0487821847f},
-std::array<float,2>{0.994097054f, 0.587510228f},
-std::array<float,2>{0.48541829f, 0.683546424f},
-std::array<float,2>{0.80971384f, 0.162169158f},
-std::array<float,2>{0.0205988083f, 0.320685267f},
-std::array<float,2>{0.619179666f, 0.946094751f},
-std::array<float,2>{0.328098744f, 0.891052365f},
-std::array<float,2>{0.931570113f, 0.281104654f},
-std::array<float,2>{0.125410721f, 0.195821419f},
-std::array<float,2>{0.658003569f, 0.704578519f},
-std::array<float,2>{0.0661400631f, 0.554069936f},
-std::array<float,2>{0.54220897f, 0.0948896334f},
-std::array<float,2>{0.405590087f, 0.385626495f},
-std::array<float,2>{0.813720763f, 0.783234298f},
-std::array<float,2>{0.101178765f, 0.797651291f},
-std::array<float,2>{0.520529509f, 0.391367286f},
-std::array<float,2>{0.420858592f, 0.119398154f},
-std::array<float,2>{0.862551451f, 0.537700534f},
-std::array<float,2>{0.355028182f, 0.691123068f},
-std::array<float,2>{0.888371527f, 0.210946396f},
-std::array<float,2>{0.174529329f, 0.2600618f},
-std::array<float,2>{0.625586927f, 0.88800621f},
-std::array<float,2>{0.446529478f, 0.963321388f},
-std::array<float,2>{0.777417779f, 0.33983314f},
-std::array<float,2>{0.0496643037f, 0.18180263f},
-std::array<float,2>{0.572086275f, 0.668679476f},
-std::array<float,2>{0.214027956f, 0.577243328f},
-std::array<float,2>{0.743654191f, 0.0323205143f},
-std::array<float,2>{0.261232138f, 0.470007122f},
-std::array<float,2>{0.94119364f, 0.860509515f},
-std::array<float,2>{0.147834063f, 0.932123423f},
-std::array<float,2>{0.675185621f, 0.309960097f},
-std::array<float,2>{0.328916252f, 0.228754982f},
-std::array<float,2>{0.921537995f, 0.745359421f},
-std::array<float,2>{0.377370536f, 0.52959609f},
-std::array<float,2>{0.841574907f, 0.0759069175f},
-std::array<float,2>{0.0811635777f, 0.429034561f},
-std::array<float,2>{0.547126591f, 0.752758622f},
-std::array<float,2>{0.304366887f, 0.838904023f},
-std::array<float,2>{0.979565084f, 0.464266539f},
-std::array<float,2>{0.237223044f, 0.0203917678f},
-std::array<float,2>{0.69373256f, 0.598077834f},
-std::array<float,2>{0.00623787334f, 0.631969631f},
-std::array<float,2>{0.603311479f, 0.125763506f},
-std::array<float,2>{0.480042845f, 0.353095591f},
-std::array<float,2>{0.788021266f, 0.976712048f},
-std::array<float,2>{0.0909108818f, 0.881090045f},
-std::array<float,2>{0.555116951f, 0.25657934f},
-std::array<float,2>{0.387625188f, 0.209023878f},
-std::array<float,2>{0.832476199f, 0.699689031f},
-std::array<float,2>{0.337346941f, 0.546837091f},
-std::array<float,2>{0.909320712f, 0.113156237f},
-std::array<float,2>{0.152380541f, 0.402633071f},
-std::array<float,2>{0.681986272f, 0.809142411f},
-std::array<float,2>{0.47382912f, 0.870650947f},
-std::array<float,2>{0.791089177f, 0.477200657f},
-std::array<float,2>{0.011475563f, 0.0417004786f},
-std::array<float,2>{0.600423515f, 0.567772031f},
-std::array<float,2>{0.244878203f, 0.6595577f},
-std::array<float,2>{0.701367557f, 0.178211406f},
-std::array<float,2>{0.312459797f, 0.329346061f},
-std::array<float,2>{0.969058514f, 0.954225123f},
-std::array<float,2>{0.182901844f, 0.763954282f},
-std::array<float,2>{0.634405315f, 0.434239149f},
-std::array<float,2>{0.34878853f, 0.066219151f},
-std::array<float,2>{0.880036473f, 0.519280791f},
-std::array<float,2>{0.412401378f, 0.738290012f},
-std::array<float,2>{0.867299736f, 0.218785614f},
-std::array<float,2>{0.106465474f, 0.299596488f},
-std::array<float,2>{0.528876483f, 0.923173964f},
-std::array<float,2>{0.252160609f, 0.972104132f},
-std::array<float,2>{0.950737715f, 0.344454288f},
-std::array<float,2>{0.20846419f, 0.140607893f},
-std::array<float,2>{0.738965809f, 0.639088273f},
-std::array<float,2>{0.059460517f, 0.602589786f},
-std::array<float,2>{0.56328845f, 0.0240133833f},
-std::array<float,2>{0.440372497f, 0.454245925f},
-std::array<float,2>{0.770065069f, 0.831072748f},
-std::array<float,2>{0.0282025225f, 0.818596482f},
-std::array<float,2>{0.61525619f, 0.441430241f},
-std::array<float,2>{0.493701488f, 0.00661020633f},
-std::array<float,2>{0.79701668f, 0.617398679f},
-std::array<float,2>{0.296510249f, 0.646120369f},
-std::array<float,2>{0.990102828f, 0.153766423f},
-std::array<float,2>{0.226576462f, 0.371555746f},
-std::array<float,2>{0.716944516f, 0.986487508f},
-std::array<float,2>{0.395501494f, 0.913652301f},
-std::array<float,2>{0.82087034f, 0.283016205f},
-std::array<float,2>{0.0753602982f, 0.241672814f},
-std::array<float,2>{0.538876534f, 0.727729082f},
-std::array<float,2>{0.137771517f, 0.507221282f},
-std::array<float,2>{0.670390725f, 0.0907966271f},
-std::array<float,2>{0.316598505f, 0.418283731f},
-std::array<float,2>{0.927154124f, 0.776635826f},
-std::array<float,2>{0.201369703f, 0.94409889f},
-std::array<float,2>{0.726268649f, 0.314315587f},
-std::array<float,2>{0.280372888f, 0.168987274f},
-std::array<float,2>{0.958486974f, 0.674007297f},
-std::array<float,2>{0.466157854f, 0.579538286f},
-std::array<float,2>{0.762151003f, 0.0583832264f},
-std::array<float,2>{0.041952543f, 0.489303499f},
-std::array<float,2>{0.583124697f, 0.845670879f},
-std::array<float,2>{0.370398134f, 0.791047335f},
-std::array<float,2>{0.897099853f, 0.381448627f},
-std::array<float,2>{0.157996804f, 0.106840424f},
-std::array<float,2>{0.643480659f, 0.556608498f},
-std::array<float,2>{0.119609095f, 0.713862777f},
-std::array<float,2>{0.513334095f, 0.190981209f},
-std::array<float,2>{0.429034144f, 0.270593673f},
-std::array<float,2>{0.844311237f, 0.90391922f},
-std::array<float,2>{0.0550790578f, 0.897114575f},
-std::array<float,2>{0.568088114f, 0.276328504f},
-std::array<float,2>{0.444773197f, 0.199303046f},
-std::array<float,2>{0.769452214f, 0.710015535f},
-std::array<float,2>{0.256729573f, 0.548318923f},
-std::array<float,2>{0.948728621f, 0.0995577425f},
-std::array<float,2>{0.205953583f, 0.386967778f},
-std::array<float,2>{0.737255633f, 0.785325408f},
-std::array<float,2>{0.407483935f, 0.857334733f},
-std::array<float,2>{0.873359323f, 0.495067209f},
-std::array<float,2>{0.104970925f, 0.0532693192f},
-std::array<float,2>{0.525361896f, 0.593476355f},
-std::array<float,2>{0.18677102f, 0.683901846f},
-std::array<float,2>{0.639553666f, 0.158932924f},
-std::array<float,2>{0.345399201f, 0.327788889f},
-std::array<float,2>{0.878621101f, 0.952904165f},
-std::array<float,2>{0.2466214f, 0.766540766f},
-std::array<float,2>{0.695988417f, 0.40885514f},
-std::array<float,2>{0.307324648f, 0.0809872895f},
-std::array<float,2>{0.974759758f, 0.51050818f},
-std::array<float,2>{0.469198823f, 0.723073542f},
-std::array<float,2>{0.793584228f, 0.248644099f},
-std::array<float,2>{0.0127432384f, 0.290026724f},
-std::array<float,2>{0.595432341f, 0.918461263f},
-std::array<float,2>{0.342748314f, 0.998872399f},
-std::array<float,2>{0.910342395f, 0.359886646f},
-std::array<float,2>{0.149227738f, 0.141666412f},
-std::array<float,2>{0.685127854f, 0.651326656f},
-std::array<float,2>{0.0885173306f, 0.611411929f},
-std::array<float,2>{0.559404135f, 0.00913544558f},
-std::array<float,2>{0.386239618f, 0.447806418f},
-std::array<float,2>{0.831831038f, 0.822587669f},
-std::array<float,2>{0.124809973f, 0.841719806f},
-std::array<float,2>{0.511380255f, 0.465990692f},
-std::array<float,2>{0.424133807f, 0.0183317624f},
-std::array<float,2>{0.848348081f, 0.597283661f},
-std::array<float,2>{0.372095972f, 0.625579417f},
-std::array<float,2>{0.89344573f, 0.12952292f},
-std::array<float,2>{0.161526859f, 0.358597934f},
-std::array<float,2>{0.646747053f, 0.981778204f},
-std::array<float,2>{0.464005142f, 0.935517609f},
-std::array<float,2>{0.760935783f, 0.305578977f},
-std::array<float,2>{0.0440433174f, 0.233637989f},
-std::array<float,2>{0.580974936f, 0.747415423f},
-std::array<float,2>{0.197216049f, 0.526854753f},
-std::array<float,2>{0.721638024f, 0.0731545538f},
-std::array<float,2>{0.27606833f, 0.423947215f},
-std::array<float,2>{0.95668143f, 0.753930151f},
-std::array<float,2>{0.136157468f, 0.964954913f},
-std::array<float,2>{0.666627347f, 0.340692639f},
-std::array<float,2>{0.314680308f, 0.184592694f},
-std::array<float,2>{0.925685942f, 0.665037572f},
-std::array<float,2>{0.391213387f, 0.572016537f},
-std::array<float,2>{0.825547397f, 0.0351918787f},
-std::array<float,2>{0.0720678344f, 0.472678542f},
-std::array<float,2>{0.531314731f, 0.86402905f},
-std::array<float,2>{0.290602952f, 0.801829517f},
-std::array<float,2>{0.985080123f, 0.397066653f},
-std::array<float,2>{0.230765402f, 0.123175189f},
-std::array<float,2>{0.712952495f, 0.534287572f},
-std::array<float,2>{0.0245641023f, 0.692051113f},
-std::array<float,2>{0.610588729f, 0.218540311f},
-std::array<float,2>{0.49694854f, 0.265006602f},
-std::array<float,2>{0.804575861f, 0.884460628f},
-std::array<float,2>{0.0682266131f, 0.972676992f},
-std::array<float,2>{0.546417654f, 0.347760975f},
-std::array<float,2>{0.399188787f, 0.134406507f},
-std::array<float,2>{0.81781435f, 0.636437714f},
-std::array<float,2>{0.324074447f, 0.608132839f},
-std::array<float,2>{0.936106682f, 0.0281070713f},
-std::array<float,2>{0.129204139f, 0.457845777f},
-std::array<float,2>{0.663024664f, 0.832952023f},
-std::array<float,2>{0.491351873f, 0.758442223f},
-std::array<float,2>{0.805629671f, 0.433242023f},
-std::array<float,2>{0.0181490202f, 0.0686571747f},
-std::array<float,2>{0.623473883f, 0.522676587f},
-std::array<float,2>{0.226217717f, 0.736713886f},
-std::array<float,2>{0.704051971f, 0.222865328f},
-std::array<float,2>{0.28771919f, 0.303381383f},
-std::array<float,2>{0.996784866f, 0.927040577f},
-std::array<float,2>{0.166822523f, 0.874165833f},
-std::array<float,2>{0.651501536f, 0.482299566f},
-std::array<float,2>{0.365781933f, 0.0448984019f},
-std::array<float,2>{0.901984453f, 0.565205574f},
-std::array<float,2>{0.434778363f, 0.66139406f},
-std::array<float,2>{0.852457643f, 0.172695249f},
-std::array<float,2>{0.113981672f, 0.335118413f},
-std::array<float,2>{0.502541721f, 0.960270166f},
-std::array<float,2>{0.269894898f, 0.876600087f},
-std::array<float,2>{0.966203451f, 0.250923336f},
-std::array<float,2>{0.194747984f, 0.203921035f},
-std::array<float,2>{0.729017258f, 0.697951615f},
-std::array<float,2>{0.0338886008f, 0.541428566f},
-std::array<float,2>{0.58819145f, 0.113397837f},
-std::array<float,2>{0.45489186f, 0.400001436f},
-std::array<float,2>{0.753255248f, 0.807929337f},
-std::array<float,2>{9.35751523e-05f, 0.794585228f},
-std::array<float,2>{0.60874325f, 0.375688463f},
-std::array<float,2>{0.484169841f, 0.102253765f},
-std::array<float,2>{0.783077121f, 0.559023023f},
-std::array<float,2>{0.297918171f, 0.717124403f},
-std::array<float,2>{0.981725454f, 0.192890823f},
-std::array<float,2>{0.240505904f, 0.269067645f},
-std::array<float,2>{0.691027224f, 0.898881853f},
-std::array<float,2>{0.380753219f, 0.938149869f},
-std::array<float,2>{0.837298095f, 0.31880787f},
-std::array<float,2>{0.0848719776f, 0.166020125f},
-std::array<float,2>{0.552589357f, 0.676441252f},
-std::array<float,2>{0.141836658f, 0.584791541f},
-std::array<float,2>{0.678708136f, 0.0613177866f},
-std::array<float,2>{0.334272385f, 0.484475046f},
-std::array<float,2>{0.91643852f, 0.848514557f},
-std::array<float,2>{0.216573894f, 0.907035768f},
-std::array<float,2>{0.749833405f, 0.288389862f},
-std::array<float,2>{0.263259888f, 0.236796424f},
-std::array<float,2>{0.942729294f, 0.734059215f},
-std::array<float,2>{0.450476289f, 0.501977384f},
-std::array<float,2>{0.773979902f, 0.0881031677f},
-std::array<float,2>{0.0532850623f, 0.416847974f},
-std::array<float,2>{0.578007042f, 0.780269265f},
-std::array<float,2>{0.357832551f, 0.814261258f},
-std::array<float,2>{0.884684682f, 0.437755466f},
-std::array<float,2>{0.177237093f, 0.00168522436f},
-std::array<float,2>{0.631682038f, 0.622345448f},
-std::array<float,2>{0.095546864f, 0.644460022f},
-std::array<float,2>{0.518205464f, 0.148960188f},
-std::array<float,2>{0.415097773f, 0.367364049f},
-std::array<float,2>{0.866173208f, 0.990794063f},
-std::array<float,2>{0.0215159357f, 0.948207617f},
-std::array<float,2>{0.61903286f, 0.32377401f},
-std::array<float,2>{0.48641932f, 0.160670862f},
-std::array<float,2>{0.810770214f, 0.680121601f},
-std::array<float,2>{0.283307552f, 0.588403106f},
-std::array<float,2>{0.99490273f, 0.0492779166f},
-std::array<float,2>{0.221266761f, 0.497393489f},
-std::array<float,2>{0.710309446f, 0.8529073f},
-std::array<float,2>{0.402590007f, 0.782293618f},
-std::array<float,2>{0.815053284f, 0.38328442f},
-std::array<float,2>{0.0635085478f, 0.0965557173f},
-std::array<float,2>{0.539319932f, 0.5511567f},
-std::array<float,2>{0.127070665f, 0.705921769f},
-std::array<float,2>{0.658750117f, 0.197608665f},
-std::array<float,2>{0.326070219f, 0.277623266f},
-std::array<float,2>{0.932221174f, 0.893106103f},
-std::array<float,2>{0.190063f, 0.826817214f},
-std::array<float,2>{0.730481207f, 0.449592829f},
-std::array<float,2>{0.266018093f, 0.0155546255f},
-std::array<float,2>{0.963173211f, 0.614477515f},
-std::array<float,2>{0.459708154f, 0.655421734f},
-std::array<float,2>{0.755091429f, 0.147388041f},
-std::array<float,2>{0.0384200923f, 0.365472883f},
-std::array<float,2>{0.591050923f, 0.995960593f},
-std::array<float,2>{0.359482408f, 0.917594969f},
-std::array<float,2>{0.903665841f, 0.294902086f},
-std::array<float,2>{0.168083906f, 0.245792016f},
-std::array<float,2>{0.652482688f, 0.722341657f},
-std::array<float,2>{0.112020157f, 0.513156533f},
-std::array<float,2>{0.50690037f, 0.0857301205f},
-std::array<float,2>{0.43110621f, 0.410433888f},
-std::array<float,2>{0.858767331f, 0.773085594f},
-std::array<float,2>{0.0799486935f, 0.751066327f},
-std::array<float,2>{0.549196839f, 0.426831812f},
-std::array<float,2>{0.37670365f, 0.078107737f},
-std::array<float,2>{0.84216845f, 0.528359413f},
-std::array<float,2>{0.33073613f, 0.742979407f},
-std::array<float,2>{0.91877079f, 0.226711243f},
-std::array<float,2>{0.145858839f, 0.311053365f},
-std::array<float,2>{0.672582746f, 0.93141371f},
-std::array<float,2>{0.478251815f, 0.979644656f},
-std::array<float,2>{0.785700798f, 0.354510486f},
-std::array<float,2>{0.00429723319f, 0.128735602f},
-std::array<float,2>{0.604434371f, 0.630843103f},
-std::array<float,2>{0.235022947f, 0.600624561f},
-std::array<float,2>{0.6918571f, 0.022658797f},
-std::array<float,2>{0.302703738f, 0.461652607f},
-std::array<float,2>{0.976833642f, 0.836958885f},
-std::array<float,2>{0.172134593f, 0.890035868f},
-std::array<float,2>{0.627125442f, 0.258432806f},
-std::array<float,2>{0.352593362f, 0.213209659f},
-std::array<float,2>{0.888808846f, 0.688196242f},
-std::array<float,2>{0.419438094f, 0.536581337f},
-std::array<float,2>{0.860096872f, 0.117784202f},
-std::array<float,2>{0.0994520932f, 0.392993361f},
-std::array<float,2>{0.521516442f, 0.799132526f},
-std::array<float,2>{0.258743942f, 0.862569332f},
-std::array<float,2>{0.938110352f, 0.472418785f},
-std::array<float,2>{0.211958185f, 0.0339588299f},
-std::array<float,2>{0.74482882f, 0.574494362f},
-std::array<float,2>{0.0471867621f, 0.671049237f},
-std::array<float,2>{0.573126376f, 0.181465909f},
-std::array<float,2>{0.44833076f, 0.336154044f},
-std::array<float,2>{0.780084491f, 0.962495387f},
-std::array<float,2>{0.109228365f, 0.92575115f},
-std::array<float,2>{0.531148374f, 0.297390759f},
-std::array<float,2>{0.411194682f, 0.222314283f},
-std::array<float,2>{0.870608151f, 0.741460323f},
-std::array<float,2>{0.349685282f, 0.517298162f},
-std::array<float,2>{0.881055772f, 0.063173756f},
-std::array<float,2>{0.180937469f, 0.436523408f},
-std::array<float,2>{0.635721862f, 0.763174891f},
-std::array<float,2>{0.439006627f, 0.828272223f},
-std::array<float,2>{0.772285044f, 0.455360025f},
-std::array<float,2>{0.0610580891f, 0.0260410476f},
-std::array<float,2>{0.565121651f, 0.603720784f},
-std::array<float,2>{0.209621668f, 0.636776328f},
-std::array<float,2>{0.740407884f, 0.137399524f},
-std::array<float,2>{0.251274526f, 0.346154839f},
-std::array<float,2>{0.952902377f, 0.969718993f},
-std::array<float,2>{0.154915005f, 0.811213255f},
-std::array<float,2>{0.681574106f, 0.405193061f},
-std::array<float,2>{0.339563906f, 0.10973271f},
-std::array<float,2>{0.906628966f, 0.543108761f},
-std::array<float,2>{0.390509337f, 0.702328861f},
-std::array<float,2>{0.835926414f, 0.208718166f},
-std::array<float,2>{0.0927717984f, 0.255460322f},
-std::array<float,2>{0.558155656f, 0.879832149f},
-std::array<float,2>{0.310427934f, 0.95699501f},
-std::array<float,2>{0.97164309f, 0.331589639f},
-std::array<float,2>{0.244071901f, 0.176384896f},
-std::array<float,2>{0.699304938f, 0.65796572f},
-std::array<float,2>{0.00845590141f, 0.569163203f},
-std::array<float,2>{0.598672867f, 0.0407375731f},
-std::array<float,2>{0.476472378f, 0.479030669f},
-std::array<float,2>{0.789114773f, 0.867627084f},
-std::array<float,2>{0.039744772f, 0.84732753f},
-std::array<float,2>{0.585360289f, 0.491539448f},
-std::array<float,2>{0.467678994f, 0.0561694652f},
-std::array<float,2>{0.763900399f, 0.580478072f},
-std::array<float,2>{0.278005838f, 0.673417449f},
-std::array<float,2>{0.960678339f, 0.171220213f},
-std::array<float,2>{0.199717849f, 0.314546347f},
-std::array<float,2>{0.723955572f, 0.943227291f},
-std::array<float,2>{0.426706761f, 0.904889703f},
-std::array<float,2>{0.846924961f, 0.272255152f},
-std::array<float,2>{0.118912071f, 0.188481793f},
-std::array<float,2>{0.514191568f, 0.712575257f},
-std::array<float,2>{0.159841865f, 0.557025135f},
-std::array<float,2>{0.641909838f, 0.10802345f},
-std::array<float,2>{0.367709368f, 0.380736828f},
-std::array<float,2>{0.895777643f, 0.79002279f},
-std::array<float,2>{0.229832232f, 0.984782755f},
-std::array<float,2>{0.715381384f, 0.374197185f},
-std::array<float,2>{0.293555081f, 0.15575707f},
-std::array<float,2>{0.991953015f, 0.64697063f},
-std::array<float,2>{0.495377541f, 0.620147824f},
-std::array<float,2>{0.800051808f, 0.00415222207f},
-std::array<float,2>{0.0300054681f, 0.444783539f},
-std::array<float,2>{0.614925146f, 0.817689061f},
-std::array<float,2>{0.318710268f, 0.775244415f},
-std::array<float,2>{0.928267419f, 0.420269817f},
-std::array<float,2>{0.139018968f, 0.0932149887f},
-std::array<float,2>{0.669836283f, 0.504384398f},
-std::array<float,2>{0.0774159506f, 0.728882551f},
-std::array<float,2>{0.535184145f, 0.238395229f},
-std::array<float,2>{0.396512479f, 0.283508569f},
-std::array<float,2>{0.822851717f, 0.911279857f}}
\ No newline at end of file
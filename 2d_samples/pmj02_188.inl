@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.331852853f, 0.963501453f},
-std::array<float,2>{0.965140581f, 0.1526694f},
-std::array<float,2>{0.739104211f, 0.665131569f},
-std::array<float,2>{0.162247941f, 0.486216307f},
-std::array<float,2>{0.0254985187f, 0.513570964f},
-std::array<float,2>{0.528457761f, 0.322773039f},
-std::array<float,2>{0.795529127f, 0.803953111f},
-std::array<float,2>{0.466958463f, 0.0223899204f},
-std::array<float,2>{0.424093962f, 0.703181565f},
-std::array<float,2>{0.842215776f, 0.382311225f},
-std::array<float,2>{0.606682837f, 0.918531537f},
-std::array<float,2>{0.101262078f, 0.221479014f},
-std::array<float,2>{0.229479492f, 0.820153713f},
-std::array<float,2>{0.626355648f, 0.0913143009f},
-std::array<float,2>{0.920387506f, 0.622450769f},
-std::array<float,2>{0.27219069f, 0.301808f},
-std::array<float,2>{0.490579009f, 0.756242573f},
-std::array<float,2>{0.769309103f, 0.0508053862f},
-std::array<float,2>{0.558475673f, 0.55893904f},
-std::array<float,2>{0.0548281185f, 0.344132751f},
-std::array<float,2>{0.143132463f, 0.633276939f},
-std::array<float,2>{0.688982904f, 0.46408391f},
-std::array<float,2>{0.9723472f, 0.971833527f},
-std::array<float,2>{0.348676533f, 0.161577761f},
-std::array<float,2>{0.286444664f, 0.579971075f},
-std::array<float,2>{0.88980037f, 0.260321528f},
-std::array<float,2>{0.659508348f, 0.868031859f},
-std::array<float,2>{0.192156509f, 0.116798788f},
-std::array<float,2>{0.0869505927f, 0.885380149f},
-std::array<float,2>{0.576357484f, 0.208112985f},
-std::array<float,2>{0.857189476f, 0.721290886f},
-std::array<float,2>{0.397981822f, 0.418215096f},
-std::array<float,2>{0.258599937f, 0.848487675f},
-std::array<float,2>{0.934739411f, 0.109072261f},
-std::array<float,2>{0.646879613f, 0.574206531f},
-std::array<float,2>{0.248759806f, 0.278959394f},
-std::array<float,2>{0.11107599f, 0.74984014f},
-std::array<float,2>{0.615805686f, 0.426575929f},
-std::array<float,2>{0.816569388f, 0.900872588f},
-std::array<float,2>{0.420817345f, 0.191094205f},
-std::array<float,2>{0.444465816f, 0.546077073f},
-std::array<float,2>{0.797608078f, 0.373838991f},
-std::array<float,2>{0.502424002f, 0.767365396f},
-std::array<float,2>{0.00313993054f, 0.0419016257f},
-std::array<float,2>{0.180313885f, 0.993139386f},
-std::array<float,2>{0.72630918f, 0.183975473f},
-std::array<float,2>{0.949853957f, 0.64664346f},
-std::array<float,2>{0.325982869f, 0.450701803f},
-std::array<float,2>{0.383877158f, 0.93004179f},
-std::array<float,2>{0.868098855f, 0.247303724f},
-std::array<float,2>{0.585607052f, 0.702494264f},
-std::array<float,2>{0.0647960305f, 0.395667166f},
-std::array<float,2>{0.21558626f, 0.602116346f},
-std::array<float,2>{0.672797501f, 0.29161945f},
-std::array<float,2>{0.903328717f, 0.831000745f},
-std::array<float,2>{0.304436117f, 0.0639364943f},
-std::array<float,2>{0.368249834f, 0.684378803f},
-std::array<float,2>{0.991083324f, 0.478952765f},
-std::array<float,2>{0.71653825f, 0.944282472f},
-std::array<float,2>{0.136065587f, 0.131210744f},
-std::array<float,2>{0.0443375967f, 0.785758913f},
-std::array<float,2>{0.531968236f, 0.00379014993f},
-std::array<float,2>{0.757432818f, 0.51674509f},
-std::array<float,2>{0.475573659f, 0.334804803f},
-std::array<float,2>{0.306431532f, 0.896185815f},
-std::array<float,2>{0.897634268f, 0.199166372f},
-std::array<float,2>{0.680567443f, 0.740496814f},
-std::array<float,2>{0.20641008f, 0.436337888f},
-std::array<float,2>{0.0772570968f, 0.569135249f},
-std::array<float,2>{0.589510381f, 0.266551077f},
-std::array<float,2>{0.864086151f, 0.858896494f},
-std::array<float,2>{0.380655915f, 0.100059867f},
-std::array<float,2>{0.481359214f, 0.652499259f},
-std::array<float,2>{0.761191249f, 0.443052262f},
-std::array<float,2>{0.542369962f, 0.989146769f},
-std::array<float,2>{0.0359189659f, 0.174655929f},
-std::array<float,2>{0.130480632f, 0.780629277f},
-std::array<float,2>{0.705699861f, 0.0358986594f},
-std::array<float,2>{0.997320473f, 0.53784287f},
-std::array<float,2>{0.361921936f, 0.366238475f},
-std::array<float,2>{0.406799942f, 0.841204107f},
-std::array<float,2>{0.825662613f, 0.0716330037f},
-std::array<float,2>{0.621790409f, 0.60013628f},
-std::array<float,2>{0.124235921f, 0.28677699f},
-std::array<float,2>{0.241314143f, 0.689284682f},
-std::array<float,2>{0.651121616f, 0.401010633f},
-std::array<float,2>{0.922043681f, 0.924625754f},
-std::array<float,2>{0.25698033f, 0.238817513f},
-std::array<float,2>{0.31305021f, 0.530758858f},
-std::array<float,2>{0.943965793f, 0.336098671f},
-std::array<float,2>{0.732475281f, 0.790441692f},
-std::array<float,2>{0.172015727f, 0.0117005333f},
-std::array<float,2>{0.00877258554f, 0.948640347f},
-std::array<float,2>{0.508776605f, 0.13356857f},
-std::array<float,2>{0.809573889f, 0.673068643f},
-std::array<float,2>{0.452534169f, 0.471269608f},
-std::array<float,2>{0.358932734f, 0.811347723f},
-std::array<float,2>{0.977248251f, 0.0305064339f},
-std::array<float,2>{0.701265037f, 0.507415295f},
-std::array<float,2>{0.151615337f, 0.314694762f},
-std::array<float,2>{0.0517010689f, 0.657372713f},
-std::array<float,2>{0.547602654f, 0.49231708f},
-std::array<float,2>{0.775478721f, 0.960679293f},
-std::array<float,2>{0.497295618f, 0.145110622f},
-std::array<float,2>{0.399875134f, 0.609695017f},
-std::array<float,2>{0.846733153f, 0.30976066f},
-std::array<float,2>{0.56895268f, 0.820548952f},
-std::array<float,2>{0.0856442377f, 0.0814342648f},
-std::array<float,2>{0.200802207f, 0.910352111f},
-std::array<float,2>{0.668543279f, 0.230419278f},
-std::array<float,2>{0.877990305f, 0.713465214f},
-std::array<float,2>{0.295127392f, 0.389487773f},
-std::array<float,2>{0.45730716f, 0.977521718f},
-std::array<float,2>{0.783037484f, 0.167641267f},
-std::array<float,2>{0.518509746f, 0.631154954f},
-std::array<float,2>{0.0207356829f, 0.460629016f},
-std::array<float,2>{0.165910572f, 0.548238218f},
-std::array<float,2>{0.746738732f, 0.352490813f},
-std::array<float,2>{0.958594918f, 0.761360884f},
-std::array<float,2>{0.340553492f, 0.0549865961f},
-std::array<float,2>{0.278673798f, 0.730999053f},
-std::array<float,2>{0.9102301f, 0.409062386f},
-std::array<float,2>{0.638457775f, 0.876027167f},
-std::array<float,2>{0.218820989f, 0.216613993f},
-std::array<float,2>{0.105789557f, 0.866989136f},
-std::array<float,2>{0.594803393f, 0.117631942f},
-std::array<float,2>{0.829178274f, 0.592784464f},
-std::array<float,2>{0.434705824f, 0.251885504f},
-std::array<float,2>{0.267979473f, 0.987742424f},
-std::array<float,2>{0.916033387f, 0.177619919f},
-std::array<float,2>{0.632479191f, 0.650228739f},
-std::array<float,2>{0.23253943f, 0.43811667f},
-std::array<float,2>{0.094126679f, 0.534811258f},
-std::array<float,2>{0.603744328f, 0.360450506f},
-std::array<float,2>{0.836259604f, 0.776944041f},
-std::array<float,2>{0.429444671f, 0.0332087949f},
-std::array<float,2>{0.464137942f, 0.734793127f},
-std::array<float,2>{0.792048991f, 0.431370884f},
-std::array<float,2>{0.527089953f, 0.894012749f},
-std::array<float,2>{0.0283215232f, 0.200739533f},
-std::array<float,2>{0.158438116f, 0.854534745f},
-std::array<float,2>{0.736194134f, 0.0937944427f},
-std::array<float,2>{0.964013517f, 0.566151321f},
-std::array<float,2>{0.333680123f, 0.270924151f},
-std::array<float,2>{0.39072898f, 0.794367433f},
-std::array<float,2>{0.855271459f, 0.0124782734f},
-std::array<float,2>{0.572543681f, 0.527022123f},
-std::array<float,2>{0.0925207287f, 0.341431826f},
-std::array<float,2>{0.189809367f, 0.678028762f},
-std::array<float,2>{0.661773086f, 0.473997086f},
-std::array<float,2>{0.88300842f, 0.950748444f},
-std::array<float,2>{0.283346862f, 0.139026493f},
-std::array<float,2>{0.345538914f, 0.597065806f},
-std::array<float,2>{0.974751055f, 0.281869948f},
-std::array<float,2>{0.694716871f, 0.838389039f},
-std::array<float,2>{0.146815658f, 0.0769842789f},
-std::array<float,2>{0.0595293045f, 0.926665068f},
-std::array<float,2>{0.559443533f, 0.234634101f},
-std::array<float,2>{0.7702896f, 0.691471338f},
-std::array<float,2>{0.484481156f, 0.405214787f},
-std::array<float,2>{0.321551979f, 0.825921893f},
-std::array<float,2>{0.948138773f, 0.0852509886f},
-std::array<float,2>{0.721776426f, 0.614012182f},
-std::array<float,2>{0.186356947f, 0.30735898f},
-std::array<float,2>{0.00769120082f, 0.717079341f},
-std::array<float,2>{0.506342411f, 0.385709941f},
-std::array<float,2>{0.801883101f, 0.906305909f},
-std::array<float,2>{0.438575983f, 0.233803526f},
-std::array<float,2>{0.41776967f, 0.501356661f},
-std::array<float,2>{0.812820613f, 0.317160219f},
-std::array<float,2>{0.609691918f, 0.806042552f},
-std::array<float,2>{0.115488887f, 0.0266285669f},
-std::array<float,2>{0.245244861f, 0.95459646f},
-std::array<float,2>{0.640748084f, 0.14261964f},
-std::array<float,2>{0.931345761f, 0.660781085f},
-std::array<float,2>{0.263283014f, 0.499289304f},
-std::array<float,2>{0.468843371f, 0.882279754f},
-std::array<float,2>{0.751539767f, 0.211269468f},
-std::array<float,2>{0.536740422f, 0.729290485f},
-std::array<float,2>{0.0409974195f, 0.412687063f},
-std::array<float,2>{0.13752532f, 0.588489771f},
-std::array<float,2>{0.712966859f, 0.25766325f},
-std::array<float,2>{0.986832142f, 0.862486541f},
-std::array<float,2>{0.373313487f, 0.121377319f},
-std::array<float,2>{0.297039151f, 0.625196517f},
-std::array<float,2>{0.898921371f, 0.454943001f},
-std::array<float,2>{0.677847207f, 0.980719924f},
-std::array<float,2>{0.212035328f, 0.170704722f},
-std::array<float,2>{0.0690248981f, 0.764195025f},
-std::array<float,2>{0.578290343f, 0.0602852404f},
-std::array<float,2>{0.874336421f, 0.55182308f},
-std::array<float,2>{0.387712717f, 0.358422875f},
-std::array<float,2>{0.364089191f, 0.91713661f},
-std::array<float,2>{0.995425463f, 0.224454671f},
-std::array<float,2>{0.708150923f, 0.710197866f},
-std::array<float,2>{0.127157852f, 0.375687957f},
-std::array<float,2>{0.0344854333f, 0.619949937f},
-std::array<float,2>{0.543905497f, 0.299958467f},
-std::array<float,2>{0.762741983f, 0.813832223f},
-std::array<float,2>{0.476863861f, 0.0893349573f},
-std::array<float,2>{0.376744896f, 0.670502424f},
-std::array<float,2>{0.862482369f, 0.488610387f},
-std::array<float,2>{0.592835486f, 0.967156351f},
-std::array<float,2>{0.0714578182f, 0.15216428f},
-std::array<float,2>{0.207936883f, 0.799764514f},
-std::array<float,2>{0.685399652f, 0.0185407382f},
-std::array<float,2>{0.894018292f, 0.509611487f},
-std::array<float,2>{0.310377985f, 0.324510366f},
-std::array<float,2>{0.447744697f, 0.873508692f},
-std::array<float,2>{0.806392908f, 0.112346388f},
-std::array<float,2>{0.51183188f, 0.585690737f},
-std::array<float,2>{0.012326288f, 0.262526631f},
-std::array<float,2>{0.17900911f, 0.724816501f},
-std::array<float,2>{0.727611244f, 0.414515495f},
-std::array<float,2>{0.940458477f, 0.887672007f},
-std::array<float,2>{0.31970191f, 0.205934986f},
-std::array<float,2>{0.250753999f, 0.557775915f},
-std::array<float,2>{0.927368999f, 0.350408822f},
-std::array<float,2>{0.653857768f, 0.752333641f},
-std::array<float,2>{0.23465082f, 0.0479771383f},
-std::array<float,2>{0.118200995f, 0.973257899f},
-std::array<float,2>{0.618552089f, 0.158250734f},
-std::array<float,2>{0.823086381f, 0.639002621f},
-std::array<float,2>{0.411792159f, 0.464958042f},
-std::array<float,2>{0.291441232f, 0.77334398f},
-std::array<float,2>{0.881826699f, 0.0461699665f},
-std::array<float,2>{0.664960563f, 0.542756379f},
-std::array<float,2>{0.199027106f, 0.367808729f},
-std::array<float,2>{0.0797529072f, 0.640696406f},
-std::array<float,2>{0.565619946f, 0.448830307f},
-std::array<float,2>{0.849450946f, 0.999589086f},
-std::array<float,2>{0.40270713f, 0.182488963f},
-std::array<float,2>{0.496091127f, 0.57503742f},
-std::array<float,2>{0.77903384f, 0.275673598f},
-std::array<float,2>{0.553764999f, 0.844168901f},
-std::array<float,2>{0.0505310297f, 0.10419859f},
-std::array<float,2>{0.154229179f, 0.903093874f},
-std::array<float,2>{0.695893705f, 0.195003584f},
-std::array<float,2>{0.981135368f, 0.742198586f},
-std::array<float,2>{0.353853524f, 0.42255792f},
-std::array<float,2>{0.433220625f, 0.939994633f},
-std::array<float,2>{0.833726346f, 0.126057193f},
-std::array<float,2>{0.60072422f, 0.682849646f},
-std::array<float,2>{0.103662558f, 0.481396198f},
-std::array<float,2>{0.224137887f, 0.519766212f},
-std::array<float,2>{0.635460556f, 0.331749439f},
-std::array<float,2>{0.909299195f, 0.784217596f},
-std::array<float,2>{0.276745141f, 0.00488505932f},
-std::array<float,2>{0.336180747f, 0.696949303f},
-std::array<float,2>{0.954965413f, 0.393666804f},
-std::array<float,2>{0.743277133f, 0.935027957f},
-std::array<float,2>{0.168881565f, 0.245268717f},
-std::array<float,2>{0.0163140185f, 0.833188951f},
-std::array<float,2>{0.522950172f, 0.0691631958f},
-std::array<float,2>{0.787680864f, 0.607983351f},
-std::array<float,2>{0.456448883f, 0.29488042f},
-std::array<float,2>{0.350063622f, 0.969275475f},
-std::array<float,2>{0.968893528f, 0.162706375f},
-std::array<float,2>{0.690720737f, 0.635991871f},
-std::array<float,2>{0.140917674f, 0.461869329f},
-std::array<float,2>{0.0569167398f, 0.562114537f},
-std::array<float,2>{0.556607962f, 0.346946895f},
-std::array<float,2>{0.767233849f, 0.7549842f},
-std::array<float,2>{0.488963962f, 0.0543355234f},
-std::array<float,2>{0.395633191f, 0.718916357f},
-std::array<float,2>{0.857623279f, 0.421114981f},
-std::array<float,2>{0.575584888f, 0.883652151f},
-std::array<float,2>{0.0882756561f, 0.209246084f},
-std::array<float,2>{0.193610206f, 0.87000227f},
-std::array<float,2>{0.657097757f, 0.113352202f},
-std::array<float,2>{0.887851715f, 0.581741035f},
-std::array<float,2>{0.287388772f, 0.258146137f},
-std::array<float,2>{0.466606379f, 0.802387774f},
-std::array<float,2>{0.793130159f, 0.0214245655f},
-std::array<float,2>{0.530061066f, 0.51507026f},
-std::array<float,2>{0.0249999538f, 0.320775867f},
-std::array<float,2>{0.161916047f, 0.667660415f},
-std::array<float,2>{0.741044939f, 0.486501485f},
-std::array<float,2>{0.967579782f, 0.962759972f},
-std::array<float,2>{0.329257429f, 0.155405611f},
-std::array<float,2>{0.270636827f, 0.624399722f},
-std::array<float,2>{0.918688595f, 0.304018408f},
-std::array<float,2>{0.627285242f, 0.81701386f},
-std::array<float,2>{0.228392318f, 0.0931291878f},
-std::array<float,2>{0.0995600969f, 0.920115054f},
-std::array<float,2>{0.608416677f, 0.220619485f},
-std::array<float,2>{0.841379583f, 0.705868185f},
-std::array<float,2>{0.422431856f, 0.380550295f},
-std::array<float,2>{0.302250028f, 0.828986943f},
-std::array<float,2>{0.904582143f, 0.0649941117f},
-std::array<float,2>{0.675420046f, 0.605440617f},
-std::array<float,2>{0.218743131f, 0.290365398f},
-std::array<float,2>{0.064093098f, 0.700688362f},
-std::array<float,2>{0.582332909f, 0.396570444f},
-std::array<float,2>{0.869313836f, 0.932168245f},
-std::array<float,2>{0.38620019f, 0.249531671f},
-std::array<float,2>{0.47326085f, 0.517738163f},
-std::array<float,2>{0.755202115f, 0.33292374f},
-std::array<float,2>{0.533690691f, 0.78880018f},
-std::array<float,2>{0.0457943231f, 0.000828034943f},
-std::array<float,2>{0.132851273f, 0.941558182f},
-std::array<float,2>{0.718316436f, 0.12900269f},
-std::array<float,2>{0.988768399f, 0.687432289f},
-std::array<float,2>{0.369619995f, 0.476795703f},
-std::array<float,2>{0.418020159f, 0.898906171f},
-std::array<float,2>{0.818668187f, 0.188999444f},
-std::array<float,2>{0.613457859f, 0.746376634f},
-std::array<float,2>{0.113048948f, 0.428522229f},
-std::array<float,2>{0.247642264f, 0.570534647f},
-std::array<float,2>{0.646366298f, 0.281099886f},
-std::array<float,2>{0.936506152f, 0.850242555f},
-std::array<float,2>{0.260421127f, 0.106174231f},
-std::array<float,2>{0.326919049f, 0.64625603f},
-std::array<float,2>{0.952182293f, 0.452021301f},
-std::array<float,2>{0.723720312f, 0.995161772f},
-std::array<float,2>{0.182011425f, 0.186886892f},
-std::array<float,2>{0.0008543242f, 0.769310772f},
-std::array<float,2>{0.500403464f, 0.0409422293f},
-std::array<float,2>{0.800737917f, 0.542981327f},
-std::array<float,2>{0.442370117f, 0.371515363f},
-std::array<float,2>{0.255485833f, 0.92255795f},
-std::array<float,2>{0.923930049f, 0.240398735f},
-std::array<float,2>{0.649962366f, 0.691259265f},
-std::array<float,2>{0.239455864f, 0.400325388f},
-std::array<float,2>{0.121438332f, 0.59952122f},
-std::array<float,2>{0.623101532f, 0.28724578f},
-std::array<float,2>{0.826427579f, 0.842114806f},
-std::array<float,2>{0.410121441f, 0.073408626f},
-std::array<float,2>{0.450568587f, 0.673906147f},
-std::array<float,2>{0.811345935f, 0.469730914f},
-std::array<float,2>{0.510806859f, 0.946023643f},
-std::array<float,2>{0.0113535589f, 0.135016501f},
-std::array<float,2>{0.174900755f, 0.792367995f},
-std::array<float,2>{0.731814921f, 0.00890853442f},
-std::array<float,2>{0.941947043f, 0.529215515f},
-std::array<float,2>{0.31455183f, 0.339692354f},
-std::array<float,2>{0.382473946f, 0.856604874f},
-std::array<float,2>{0.865456879f, 0.0987800583f},
-std::array<float,2>{0.586735904f, 0.567824721f},
-std::array<float,2>{0.075094603f, 0.267746538f},
-std::array<float,2>{0.203380793f, 0.738652945f},
-std::array<float,2>{0.683279872f, 0.434550464f},
-std::array<float,2>{0.896041751f, 0.897273064f},
-std::array<float,2>{0.307445765f, 0.195679888f},
-std::array<float,2>{0.360982925f, 0.535279453f},
-std::array<float,2>{0.999857485f, 0.363832325f},
-std::array<float,2>{0.704673111f, 0.778059602f},
-std::array<float,2>{0.131976828f, 0.038683366f},
-std::array<float,2>{0.0373041891f, 0.991706133f},
-std::array<float,2>{0.540348768f, 0.172572434f},
-std::array<float,2>{0.759339929f, 0.654325306f},
-std::array<float,2>{0.483084857f, 0.444314301f},
-std::array<float,2>{0.343552053f, 0.758136868f},
-std::array<float,2>{0.958996177f, 0.0574958324f},
-std::array<float,2>{0.749909937f, 0.550407052f},
-std::array<float,2>{0.167137206f, 0.355457634f},
-std::array<float,2>{0.0232127514f, 0.62923193f},
-std::array<float,2>{0.515874803f, 0.457473755f},
-std::array<float,2>{0.783717871f, 0.979502022f},
-std::array<float,2>{0.460244328f, 0.165433764f},
-std::array<float,2>{0.437242985f, 0.591533065f},
-std::array<float,2>{0.831620455f, 0.253239453f},
-std::array<float,2>{0.596937537f, 0.864323497f},
-std::array<float,2>{0.108422004f, 0.120443314f},
-std::array<float,2>{0.221082583f, 0.877857924f},
-std::array<float,2>{0.640211403f, 0.218678936f},
-std::array<float,2>{0.912746191f, 0.733788788f},
-std::array<float,2>{0.280703872f, 0.4076702f},
-std::array<float,2>{0.499287099f, 0.958298981f},
-std::array<float,2>{0.775338173f, 0.14842318f},
-std::array<float,2>{0.549518168f, 0.658981621f},
-std::array<float,2>{0.0540646687f, 0.495827377f},
-std::array<float,2>{0.148612514f, 0.505625963f},
-std::array<float,2>{0.699407518f, 0.313448638f},
-std::array<float,2>{0.978761852f, 0.809417903f},
-std::array<float,2>{0.356140614f, 0.0280951299f},
-std::array<float,2>{0.293814212f, 0.711097836f},
-std::array<float,2>{0.876906633f, 0.388597935f},
-std::array<float,2>{0.671821833f, 0.912739694f},
-std::array<float,2>{0.201571763f, 0.227937847f},
-std::array<float,2>{0.083660543f, 0.823854804f},
-std::array<float,2>{0.567044854f, 0.07832627f},
-std::array<float,2>{0.844073117f, 0.612846136f},
-std::array<float,2>{0.401526928f, 0.311983049f},
-std::array<float,2>{0.282921284f, 0.952193856f},
-std::array<float,2>{0.884877264f, 0.137071684f},
-std::array<float,2>{0.663734317f, 0.676060498f},
-std::array<float,2>{0.187933207f, 0.476235896f},
-std::array<float,2>{0.0910039619f, 0.525002182f},
-std::array<float,2>{0.571076035f, 0.342004597f},
-std::array<float,2>{0.852567732f, 0.796260417f},
-std::array<float,2>{0.39351204f, 0.0139209507f},
-std::array<float,2>{0.487547189f, 0.694743872f},
-std::array<float,2>{0.772550285f, 0.402717203f},
-std::array<float,2>{0.56177628f, 0.928430736f},
-std::array<float,2>{0.0613179468f, 0.236662611f},
-std::array<float,2>{0.144614086f, 0.837552667f},
-std::array<float,2>{0.692787051f, 0.0745680183f},
-std::array<float,2>{0.972780049f, 0.594137907f},
-std::array<float,2>{0.346281171f, 0.283931494f},
-std::array<float,2>{0.425860763f, 0.775054693f},
-std::array<float,2>{0.838172197f, 0.0320072286f},
-std::array<float,2>{0.602055073f, 0.532519042f},
-std::array<float,2>{0.0961173922f, 0.361702502f},
-std::array<float,2>{0.231387675f, 0.652136981f},
-std::array<float,2>{0.629594624f, 0.440367848f},
-std::array<float,2>{0.91596967f, 0.984656572f},
-std::array<float,2>{0.266795307f, 0.17837818f},
-std::array<float,2>{0.334335029f, 0.562866032f},
-std::array<float,2>{0.96165514f, 0.273293793f},
-std::array<float,2>{0.736881971f, 0.852736652f},
-std::array<float,2>{0.157490522f, 0.096570611f},
-std::array<float,2>{0.0306405593f, 0.891091526f},
-std::array<float,2>{0.524487019f, 0.201410323f},
-std::array<float,2>{0.789801836f, 0.736920893f},
-std::array<float,2>{0.462612063f, 0.431718737f},
-std::array<float,2>{0.371740401f, 0.860309601f},
-std::array<float,2>{0.986214042f, 0.124841496f},
-std::array<float,2>{0.712640107f, 0.587730885f},
-std::array<float,2>{0.140253827f, 0.254051954f},
-std::array<float,2>{0.0427804776f, 0.726951838f},
-std::array<float,2>{0.537664711f, 0.411670089f},
-std::array<float,2>{0.752772987f, 0.879207492f},
-std::array<float,2>{0.470878541f, 0.213159457f},
-std::array<float,2>{0.389794528f, 0.554507196f},
-std::array<float,2>{0.871970356f, 0.357328206f},
-std::array<float,2>{0.580954015f, 0.762661636f},
-std::array<float,2>{0.0670271739f, 0.0619940683f},
-std::array<float,2>{0.213113338f, 0.9830001f},
-std::array<float,2>{0.676674068f, 0.16807507f},
-std::array<float,2>{0.90067625f, 0.627142191f},
-std::array<float,2>{0.299597204f, 0.455625117f},
-std::array<float,2>{0.440520227f, 0.908267975f},
-std::array<float,2>{0.803828418f, 0.231730327f},
-std::array<float,2>{0.504248202f, 0.715052545f},
-std::array<float,2>{0.00423064781f, 0.384558648f},
-std::array<float,2>{0.18530339f, 0.616485596f},
-std::array<float,2>{0.719997704f, 0.305938572f},
-std::array<float,2>{0.946375728f, 0.826250196f},
-std::array<float,2>{0.323893547f, 0.0822401345f},
-std::array<float,2>{0.265360326f, 0.663847148f},
-std::array<float,2>{0.932459891f, 0.497797877f},
-std::array<float,2>{0.642808139f, 0.956927299f},
-std::array<float,2>{0.242472887f, 0.141074419f},
-std::array<float,2>{0.114238948f, 0.808072567f},
-std::array<float,2>{0.61179471f, 0.0247714277f},
-std::array<float,2>{0.816168845f, 0.502715886f},
-std::array<float,2>{0.414909452f, 0.318985075f},
-std::array<float,2>{0.317243636f, 0.888704479f},
-std::array<float,2>{0.939251423f, 0.204803541f},
-std::array<float,2>{0.730311573f, 0.724112451f},
-std::array<float,2>{0.176136851f, 0.41711995f},
-std::array<float,2>{0.0142755052f, 0.582793832f},
-std::array<float,2>{0.515334547f, 0.264343262f},
-std::array<float,2>{0.807604015f, 0.871407866f},
-std::array<float,2>{0.446227819f, 0.110447697f},
-std::array<float,2>{0.413280338f, 0.638076901f},
-std::array<float,2>{0.82168299f, 0.467833698f},
-std::array<float,2>{0.620367646f, 0.976437032f},
-std::array<float,2>{0.120298102f, 0.156887129f},
-std::array<float,2>{0.237624094f, 0.751520574f},
-std::array<float,2>{0.655370295f, 0.0506016649f},
-std::array<float,2>{0.928751886f, 0.554699004f},
-std::array<float,2>{0.252192855f, 0.347764373f},
-std::array<float,2>{0.478952587f, 0.814899087f},
-std::array<float,2>{0.765075684f, 0.0877405703f},
-std::array<float,2>{0.546045542f, 0.618998826f},
-std::array<float,2>{0.0326904841f, 0.298417836f},
-std::array<float,2>{0.126856893f, 0.707108736f},
-std::array<float,2>{0.710909903f, 0.378816754f},
-std::array<float,2>{0.992744744f, 0.914282441f},
-std::array<float,2>{0.366202354f, 0.225352824f},
-std::array<float,2>{0.311277568f, 0.511654615f},
-std::array<float,2>{0.891276538f, 0.32662791f},
-std::array<float,2>{0.686275303f, 0.798369348f},
-std::array<float,2>{0.209051058f, 0.0166420005f},
-std::array<float,2>{0.0728029758f, 0.966519475f},
-std::array<float,2>{0.591486752f, 0.149156675f},
-std::array<float,2>{0.859680772f, 0.668747067f},
-std::array<float,2>{0.378560007f, 0.49042657f},
-std::array<float,2>{0.273454487f, 0.782884777f},
-std::array<float,2>{0.907728434f, 0.00665034633f},
-std::array<float,2>{0.634239435f, 0.522918701f},
-std::array<float,2>{0.224651396f, 0.328573674f},
-std::array<float,2>{0.101911731f, 0.68116647f},
-std::array<float,2>{0.597880244f, 0.483643025f},
-std::array<float,2>{0.833996773f, 0.937936008f},
-std::array<float,2>{0.431316078f, 0.128379777f},
-std::array<float,2>{0.453592151f, 0.606486917f},
-std::array<float,2>{0.787005186f, 0.295580477f},
-std::array<float,2>{0.521481574f, 0.835383713f},
-std::array<float,2>{0.0186918583f, 0.0678786635f},
-std::array<float,2>{0.170085579f, 0.935593665f},
-std::array<float,2>{0.744316697f, 0.243038401f},
-std::array<float,2>{0.955988705f, 0.698576033f},
-std::array<float,2>{0.339739352f, 0.391183496f},
-std::array<float,2>{0.405459791f, 0.996379316f},
-std::array<float,2>{0.849664748f, 0.180910572f},
-std::array<float,2>{0.562532008f, 0.643167555f},
-std::array<float,2>{0.0812886953f, 0.445814312f},
-std::array<float,2>{0.196344584f, 0.539915144f},
-std::array<float,2>{0.667503834f, 0.369491726f},
-std::array<float,2>{0.880467117f, 0.77066046f},
-std::array<float,2>{0.289082646f, 0.0433985963f},
-std::array<float,2>{0.352336109f, 0.744347215f},
-std::array<float,2>{0.983002901f, 0.424959987f},
-std::array<float,2>{0.697344422f, 0.904531956f},
-std::array<float,2>{0.155981287f, 0.191905484f},
-std::array<float,2>{0.0486600697f, 0.846756935f},
-std::array<float,2>{0.55233264f, 0.101825066f},
-std::array<float,2>{0.779335499f, 0.576956928f},
-std::array<float,2>{0.493616223f, 0.273947328f},
-std::array<float,2>{0.325175762f, 0.994784653f},
-std::array<float,2>{0.950922132f, 0.186410651f},
-std::array<float,2>{0.72530663f, 0.645391345f},
-std::array<float,2>{0.18137829f, 0.452897102f},
-std::array<float,2>{0.00223975698f, 0.544122338f},
-std::array<float,2>{0.503150344f, 0.372887075f},
-std::array<float,2>{0.798327684f, 0.768463075f},
-std::array<float,2>{0.444078982f, 0.0400152542f},
-std::array<float,2>{0.420941889f, 0.747800767f},
-std::array<float,2>{0.817862868f, 0.4287512f},
-std::array<float,2>{0.616949677f, 0.899955034f},
-std::array<float,2>{0.109767184f, 0.188197777f},
-std::array<float,2>{0.249479294f, 0.851259828f},
-std::array<float,2>{0.647888303f, 0.106887445f},
-std::array<float,2>{0.934494257f, 0.572219789f},
-std::array<float,2>{0.259528846f, 0.279668927f},
-std::array<float,2>{0.476004124f, 0.787715495f},
-std::array<float,2>{0.756538808f, 0.00154053071f},
-std::array<float,2>{0.532730162f, 0.518704891f},
-std::array<float,2>{0.043202851f, 0.333388478f},
-std::array<float,2>{0.135172114f, 0.685803533f},
-std::array<float,2>{0.715099216f, 0.477610976f},
-std::array<float,2>{0.991650641f, 0.942814469f},
-std::array<float,2>{0.367860407f, 0.130283117f},
-std::array<float,2>{0.302815229f, 0.603775203f},
-std::array<float,2>{0.903039873f, 0.289313287f},
-std::array<float,2>{0.673421323f, 0.829867065f},
-std::array<float,2>{0.216190964f, 0.0655031428f},
-std::array<float,2>{0.0657846183f, 0.932735503f},
-std::array<float,2>{0.584592462f, 0.248180628f},
-std::array<float,2>{0.868498385f, 0.70005095f},
-std::array<float,2>{0.383507252f, 0.398338646f},
-std::array<float,2>{0.272846401f, 0.81767565f},
-std::array<float,2>{0.921056747f, 0.0922973379f},
-std::array<float,2>{0.625703812f, 0.623411596f},
-std::array<float,2>{0.2300255f, 0.302735507f},
-std::array<float,2>{0.0998104289f, 0.706282973f},
-std::array<float,2>{0.605685413f, 0.379572302f},
-std::array<float,2>{0.843319833f, 0.921512246f},
-std::array<float,2>{0.424849898f, 0.219214186f},
-std::array<float,2>{0.46841687f, 0.513737619f},
-std::array<float,2>{0.796827197f, 0.322134763f},
-std::array<float,2>{0.527934432f, 0.800978184f},
-std::array<float,2>{0.0270543192f, 0.01994491f},
-std::array<float,2>{0.163584799f, 0.96177268f},
-std::array<float,2>{0.739840686f, 0.15444614f},
-std::array<float,2>{0.966484249f, 0.666234374f},
-std::array<float,2>{0.3306638f, 0.487562031f},
-std::array<float,2>{0.397272229f, 0.88432461f},
-std::array<float,2>{0.855866969f, 0.210318878f},
-std::array<float,2>{0.577552378f, 0.71980226f},
-std::array<float,2>{0.0867522135f, 0.420321763f},
-std::array<float,2>{0.192798257f, 0.580814958f},
-std::array<float,2>{0.659014046f, 0.259665132f},
-std::array<float,2>{0.889377117f, 0.871047199f},
-std::array<float,2>{0.285566092f, 0.115220234f},
-std::array<float,2>{0.347920805f, 0.635414124f},
-std::array<float,2>{0.971265316f, 0.462034196f},
-std::array<float,2>{0.688316941f, 0.969839513f},
-std::array<float,2>{0.143586203f, 0.163502559f},
-std::array<float,2>{0.056184236f, 0.753925383f},
-std::array<float,2>{0.556969583f, 0.053390123f},
-std::array<float,2>{0.768372715f, 0.560902953f},
-std::array<float,2>{0.492178857f, 0.345899791f},
-std::array<float,2>{0.296584278f, 0.913939714f},
-std::array<float,2>{0.877510667f, 0.22743392f},
-std::array<float,2>{0.669028044f, 0.712653816f},
-std::array<float,2>{0.199971631f, 0.387362629f},
-std::array<float,2>{0.0841668621f, 0.611888885f},
-std::array<float,2>{0.5693928f, 0.311392158f},
-std::array<float,2>{0.846053481f, 0.822621703f},
-std::array<float,2>{0.398579299f, 0.0795855299f},
-std::array<float,2>{0.496556729f, 0.659746289f},
-std::array<float,2>{0.776548624f, 0.494933724f},
-std::array<float,2>{0.548612535f, 0.957568049f},
-std::array<float,2>{0.0521657132f, 0.146869019f},
-std::array<float,2>{0.150953308f, 0.809864104f},
-std::array<float,2>{0.702245295f, 0.0285860132f},
-std::array<float,2>{0.978092968f, 0.504414856f},
-std::array<float,2>{0.358238876f, 0.314091623f},
-std::array<float,2>{0.434102237f, 0.863559306f},
-std::array<float,2>{0.828683019f, 0.119801238f},
-std::array<float,2>{0.594265819f, 0.58995527f},
-std::array<float,2>{0.106594451f, 0.252022475f},
-std::array<float,2>{0.220658571f, 0.73280412f},
-std::array<float,2>{0.637629986f, 0.406332076f},
-std::array<float,2>{0.911268413f, 0.878785133f},
-std::array<float,2>{0.278285682f, 0.217586637f},
-std::array<float,2>{0.341380358f, 0.549097478f},
-std::array<float,2>{0.957930028f, 0.354115665f},
-std::array<float,2>{0.748004436f, 0.759736955f},
-std::array<float,2>{0.164705917f, 0.05851781f},
-std::array<float,2>{0.0199525356f, 0.97907871f},
-std::array<float,2>{0.518874705f, 0.164872617f},
-std::array<float,2>{0.781515896f, 0.63038975f},
-std::array<float,2>{0.45871979f, 0.458320439f},
-std::array<float,2>{0.362677723f, 0.778675854f},
-std::array<float,2>{0.996878862f, 0.0377641656f},
-std::array<float,2>{0.706064165f, 0.536981523f},
-std::array<float,2>{0.129382282f, 0.364506483f},
-std::array<float,2>{0.0369747467f, 0.656070054f},
-std::array<float,2>{0.541870594f, 0.445029587f},
-std::array<float,2>{0.76027149f, 0.990279138f},
-std::array<float,2>{0.48156938f, 0.173782066f},
-std::array<float,2>{0.378932893f, 0.56686908f},
-std::array<float,2>{0.864257932f, 0.269033521f},
-std::array<float,2>{0.588707805f, 0.856387913f},
-std::array<float,2>{0.0766437575f, 0.0984745398f},
-std::array<float,2>{0.205881059f, 0.897482276f},
-std::array<float,2>{0.681597888f, 0.196979851f},
-std::array<float,2>{0.897039115f, 0.74017477f},
-std::array<float,2>{0.30483973f, 0.434918582f},
-std::array<float,2>{0.451853722f, 0.946558654f},
-std::array<float,2>{0.808609605f, 0.136203751f},
-std::array<float,2>{0.509515226f, 0.674815178f},
-std::array<float,2>{0.00969045982f, 0.46877721f},
-std::array<float,2>{0.173014209f, 0.527511835f},
-std::array<float,2>{0.73397851f, 0.338578969f},
-std::array<float,2>{0.944434226f, 0.791482329f},
-std::array<float,2>{0.313590556f, 0.00820533559f},
-std::array<float,2>{0.25667569f, 0.690097988f},
-std::array<float,2>{0.923724294f, 0.399359107f},
-std::array<float,2>{0.652128518f, 0.923320413f},
-std::array<float,2>{0.240438893f, 0.241256341f},
-std::array<float,2>{0.12338841f, 0.8434484f},
-std::array<float,2>{0.622840166f, 0.0730626658f},
-std::array<float,2>{0.82498759f, 0.598191977f},
-std::array<float,2>{0.407613844f, 0.288923234f},
-std::array<float,2>{0.262475044f, 0.955447614f},
-std::array<float,2>{0.930289626f, 0.141765773f},
-std::array<float,2>{0.64252454f, 0.662756503f},
-std::array<float,2>{0.245063558f, 0.49690184f},
-std::array<float,2>{0.116777569f, 0.50350523f},
-std::array<float,2>{0.611260593f, 0.320079744f},
-std::array<float,2>{0.814109564f, 0.807443321f},
-std::array<float,2>{0.416031033f, 0.0235031974f},
-std::array<float,2>{0.43838045f, 0.716060877f},
-std::array<float,2>{0.801229537f, 0.383129597f},
-std::array<float,2>{0.507282674f, 0.909472466f},
-std::array<float,2>{0.00665041106f, 0.230481252f},
-std::array<float,2>{0.187194347f, 0.82785511f},
-std::array<float,2>{0.721552551f, 0.0837862566f},
-std::array<float,2>{0.949136257f, 0.615901232f},
-std::array<float,2>{0.320974201f, 0.304702193f},
-std::array<float,2>{0.38728404f, 0.763359964f},
-std::array<float,2>{0.873608828f, 0.0613919236f},
-std::array<float,2>{0.580074847f, 0.553587079f},
-std::array<float,2>{0.0696812123f, 0.355555773f},
-std::array<float,2>{0.211624488f, 0.628787935f},
-std::array<float,2>{0.679571331f, 0.456503391f},
-std::array<float,2>{0.899746299f, 0.983930349f},
-std::array<float,2>{0.298206955f, 0.169106185f},
-std::array<float,2>{0.374986172f, 0.586729407f},
-std::array<float,2>{0.988221526f, 0.255848914f},
-std::array<float,2>{0.714800775f, 0.860739529f},
-std::array<float,2>{0.138102502f, 0.12376111f},
-std::array<float,2>{0.0393425263f, 0.880461454f},
-std::array<float,2>{0.535175502f, 0.214168891f},
-std::array<float,2>{0.750747144f, 0.728462577f},
-std::array<float,2>{0.469793051f, 0.411027372f},
-std::array<float,2>{0.332638502f, 0.852059901f},
-std::array<float,2>{0.963766873f, 0.0970051512f},
-std::array<float,2>{0.735197604f, 0.563965857f},
-std::array<float,2>{0.159304768f, 0.272247434f},
-std::array<float,2>{0.0278017949f, 0.737846851f},
-std::array<float,2>{0.525710225f, 0.433226585f},
-std::array<float,2>{0.791732609f, 0.891752064f},
-std::array<float,2>{0.463592321f, 0.202156439f},
-std::array<float,2>{0.428579777f, 0.531734407f},
-std::array<float,2>{0.837227762f, 0.362986565f},
-std::array<float,2>{0.604714334f, 0.773613393f},
-std::array<float,2>{0.0952782407f, 0.0323994756f},
-std::array<float,2>{0.23412104f, 0.985614598f},
-std::array<float,2>{0.631170154f, 0.179343954f},
-std::array<float,2>{0.917223454f, 0.650725126f},
-std::array<float,2>{0.269024044f, 0.440550208f},
-std::array<float,2>{0.485353023f, 0.929047763f},
-std::array<float,2>{0.771440148f, 0.237488061f},
-std::array<float,2>{0.560492575f, 0.693674386f},
-std::array<float,2>{0.0596135035f, 0.403915286f},
-std::array<float,2>{0.147626758f, 0.595531702f},
-std::array<float,2>{0.69368732f, 0.284493148f},
-std::array<float,2>{0.975617349f, 0.835949659f},
-std::array<float,2>{0.343816847f, 0.076121226f},
-std::array<float,2>{0.285016894f, 0.677401364f},
-std::array<float,2>{0.884190261f, 0.475491315f},
-std::array<float,2>{0.661094487f, 0.951264977f},
-std::array<float,2>{0.190904647f, 0.138643637f},
-std::array<float,2>{0.0928307399f, 0.795357943f},
-std::array<float,2>{0.574160874f, 0.0150965014f},
-std::array<float,2>{0.854438484f, 0.523585021f},
-std::array<float,2>{0.392350346f, 0.34336713f},
-std::array<float,2>{0.35449928f, 0.905562818f},
-std::array<float,2>{0.981771588f, 0.192757428f},
-std::array<float,2>{0.697100937f, 0.745758533f},
-std::array<float,2>{0.153091326f, 0.424333155f},
-std::array<float,2>{0.0494046472f, 0.577455044f},
-std::array<float,2>{0.553002715f, 0.274546862f},
-std::array<float,2>{0.778271377f, 0.846137583f},
-std::array<float,2>{0.495100886f, 0.102938965f},
-std::array<float,2>{0.403584927f, 0.644230962f},
-std::array<float,2>{0.848316133f, 0.446911186f},
-std::array<float,2>{0.564879179f, 0.997630179f},
-std::array<float,2>{0.0788326934f, 0.180215344f},
-std::array<float,2>{0.197845042f, 0.769761741f},
-std::array<float,2>{0.665577352f, 0.0444511808f},
-std::array<float,2>{0.882192016f, 0.540588617f},
-std::array<float,2>{0.292950958f, 0.370625675f},
-std::array<float,2>{0.455972999f, 0.834752917f},
-std::array<float,2>{0.788780451f, 0.0670103878f},
-std::array<float,2>{0.52222538f, 0.606231809f},
-std::array<float,2>{0.0175693221f, 0.296340138f},
-std::array<float,2>{0.169486225f, 0.697296858f},
-std::array<float,2>{0.74245441f, 0.392015755f},
-std::array<float,2>{0.953251481f, 0.93706435f},
-std::array<float,2>{0.336917192f, 0.244042516f},
-std::array<float,2>{0.275572002f, 0.52195859f},
-std::array<float,2>{0.908930063f, 0.329832673f},
-std::array<float,2>{0.635766864f, 0.781459391f},
-std::array<float,2>{0.223616049f, 0.0070550302f},
-std::array<float,2>{0.104968391f, 0.939042866f},
-std::array<float,2>{0.60013622f, 0.127494201f},
-std::array<float,2>{0.832837343f, 0.680081367f},
-std::array<float,2>{0.432465583f, 0.482815862f},
-std::array<float,2>{0.309300452f, 0.797738612f},
-std::array<float,2>{0.893115342f, 0.0162353013f},
-std::array<float,2>{0.684044659f, 0.509817183f},
-std::array<float,2>{0.208633468f, 0.327567548f},
-std::array<float,2>{0.0709737167f, 0.669407845f},
-std::array<float,2>{0.591817558f, 0.49181205f},
-std::array<float,2>{0.861732781f, 0.964970827f},
-std::array<float,2>{0.375918388f, 0.14941588f},
-std::array<float,2>{0.478399277f, 0.617924869f},
-std::array<float,2>{0.762109756f, 0.297029287f},
-std::array<float,2>{0.54474324f, 0.815822124f},
-std::array<float,2>{0.0334396549f, 0.0864035189f},
-std::array<float,2>{0.128296465f, 0.915544152f},
-std::array<float,2>{0.707036793f, 0.225763634f},
-std::array<float,2>{0.994330287f, 0.708521962f},
-std::array<float,2>{0.364379734f, 0.377058864f},
-std::array<float,2>{0.411101252f, 0.974818408f},
-std::array<float,2>{0.823383152f, 0.157584786f},
-std::array<float,2>{0.617518306f, 0.637352407f},
-std::array<float,2>{0.117901675f, 0.466850638f},
-std::array<float,2>{0.236040711f, 0.555967867f},
-std::array<float,2>{0.652444899f, 0.348727524f},
-std::array<float,2>{0.926165223f, 0.750136018f},
-std::array<float,2>{0.251383007f, 0.0493860878f},
-std::array<float,2>{0.318937004f, 0.723595798f},
-std::array<float,2>{0.940158367f, 0.416172117f},
-std::array<float,2>{0.727360904f, 0.890185416f},
-std::array<float,2>{0.178287908f, 0.203149766f},
-std::array<float,2>{0.0133533776f, 0.872213125f},
-std::array<float,2>{0.513271928f, 0.109670036f},
-std::array<float,2>{0.805597186f, 0.583568156f},
-std::array<float,2>{0.448820829f, 0.265115678f},
-std::array<float,2>{0.370533139f, 0.944510639f},
-std::array<float,2>{0.989540935f, 0.132406384f},
-std::array<float,2>{0.716894984f, 0.68488574f},
-std::array<float,2>{0.134154022f, 0.479678929f},
-std::array<float,2>{0.0468426459f, 0.515996993f},
-std::array<float,2>{0.534278035f, 0.335252225f},
-std::array<float,2>{0.754327416f, 0.786646485f},
-std::array<float,2>{0.474075794f, 0.00212196284f},
-std::array<float,2>{0.385048866f, 0.702009499f},
-std::array<float,2>{0.871072352f, 0.39498356f},
-std::array<float,2>{0.583268225f, 0.931479692f},
-std::array<float,2>{0.0632381961f, 0.247005269f},
-std::array<float,2>{0.216872036f, 0.831328332f},
-std::array<float,2>{0.674731672f, 0.0630658939f},
-std::array<float,2>{0.905798316f, 0.602942705f},
-std::array<float,2>{0.30163756f, 0.29247582f},
-std::array<float,2>{0.443320066f, 0.766561687f},
-std::array<float,2>{0.799565494f, 0.0424067825f},
-std::array<float,2>{0.501875877f, 0.545753956f},
-std::array<float,2>{0.000979258097f, 0.374046624f},
-std::array<float,2>{0.183449283f, 0.647532225f},
-std::array<float,2>{0.723511159f, 0.449544728f},
-std::array<float,2>{0.952072799f, 0.993539035f},
-std::array<float,2>{0.328100473f, 0.185117766f},
-std::array<float,2>{0.261124462f, 0.572601557f},
-std::array<float,2>{0.937269032f, 0.27824682f},
-std::array<float,2>{0.645241737f, 0.84874469f},
-std::array<float,2>{0.246747538f, 0.108375356f},
-std::array<float,2>{0.111606173f, 0.901768863f},
-std::array<float,2>{0.614569604f, 0.189454436f},
-std::array<float,2>{0.819411576f, 0.748166382f},
-std::array<float,2>{0.419608831f, 0.427290469f},
-std::array<float,2>{0.288890183f, 0.869018972f},
-std::array<float,2>{0.887121558f, 0.115385517f},
-std::array<float,2>{0.657641709f, 0.578527808f},
-std::array<float,2>{0.194546238f, 0.261031866f},
-std::array<float,2>{0.0892108083f, 0.722523808f},
-std::array<float,2>{0.574312031f, 0.419651598f},
-std::array<float,2>{0.858700454f, 0.886570215f},
-std::array<float,2>{0.394771516f, 0.207223147f},
-std::array<float,2>{0.490053773f, 0.559652925f},
-std::array<float,2>{0.76573056f, 0.345159799f},
-std::array<float,2>{0.555254936f, 0.757022023f},
-std::array<float,2>{0.0577762164f, 0.0523715541f},
-std::array<float,2>{0.142200083f, 0.971463203f},
-std::array<float,2>{0.689879954f, 0.160843179f},
-std::array<float,2>{0.970395029f, 0.634520411f},
-std::array<float,2>{0.351279676f, 0.463628709f},
-std::array<float,2>{0.423223466f, 0.919857442f},
-std::array<float,2>{0.84039402f, 0.222196534f},
-std::array<float,2>{0.608034015f, 0.704634309f},
-std::array<float,2>{0.0978170782f, 0.38163811f},
-std::array<float,2>{0.22712177f, 0.621801078f},
-std::array<float,2>{0.628774941f, 0.301281154f},
-std::array<float,2>{0.919450581f, 0.81883502f},
-std::array<float,2>{0.270328492f, 0.0906327516f},
-std::array<float,2>{0.328949273f, 0.664555728f},
-std::array<float,2>{0.967776239f, 0.484777331f},
-std::array<float,2>{0.741269231f, 0.964785457f},
-std::array<float,2>{0.160834119f, 0.153359175f},
-std::array<float,2>{0.0234395843f, 0.803696513f},
-std::array<float,2>{0.530642211f, 0.0228844304f},
-std::array<float,2>{0.794752419f, 0.511922061f},
-std::array<float,2>{0.465321809f, 0.323836029f},
-std::array<float,2>{0.279689014f, 0.875057817f},
-std::array<float,2>{0.913833678f, 0.214894667f},
-std::array<float,2>{0.638957322f, 0.731621087f},
-std::array<float,2>{0.222171918f, 0.409775794f},
-std::array<float,2>{0.107488185f, 0.59253329f},
-std::array<float,2>{0.596130311f, 0.250635415f},
-std::array<float,2>{0.830955267f, 0.865370035f},
-std::array<float,2>{0.436384171f, 0.118986771f},
-std::array<float,2>{0.459275037f, 0.631872714f},
-std::array<float,2>{0.784587622f, 0.459261596f},
-std::array<float,2>{0.517568111f, 0.978200257f},
-std::array<float,2>{0.0215710122f, 0.16656135f},
-std::array<float,2>{0.166503385f, 0.760262251f},
-std::array<float,2>{0.748744309f, 0.0564574748f},
-std::array<float,2>{0.959981799f, 0.547682047f},
-std::array<float,2>{0.342244089f, 0.35282284f},
-std::array<float,2>{0.400875121f, 0.82145673f},
-std::array<float,2>{0.845005035f, 0.0808426365f},
-std::array<float,2>{0.568170071f, 0.611114681f},
-std::array<float,2>{0.0829032063f, 0.309220314f},
-std::array<float,2>{0.202306315f, 0.714107454f},
-std::array<float,2>{0.669988036f, 0.39053899f},
-std::array<float,2>{0.875973403f, 0.911629796f},
-std::array<float,2>{0.294234484f, 0.229104087f},
-std::array<float,2>{0.357181877f, 0.506508946f},
-std::array<float,2>{0.979687154f, 0.315847337f},
-std::array<float,2>{0.700831831f, 0.812397599f},
-std::array<float,2>{0.149696365f, 0.0296310615f},
-std::array<float,2>{0.0528610051f, 0.959206998f},
-std::array<float,2>{0.550415695f, 0.145811379f},
-std::array<float,2>{0.774134517f, 0.657116294f},
-std::array<float,2>{0.49808532f, 0.493853241f},
-std::array<float,2>{0.315811783f, 0.789338768f},
-std::array<float,2>{0.942959905f, 0.0104646906f},
-std::array<float,2>{0.730989277f, 0.529467225f},
-std::array<float,2>{0.174534529f, 0.33732456f},
-std::array<float,2>{0.0101533979f, 0.672259629f},
-std::array<float,2>{0.510607123f, 0.47237584f},
-std::array<float,2>{0.812132239f, 0.947993934f},
-std::array<float,2>{0.449608445f, 0.13416338f},
-std::array<float,2>{0.409157842f, 0.601456583f},
-std::array<float,2>{0.827436447f, 0.285884261f},
-std::array<float,2>{0.624325275f, 0.839960158f},
-std::array<float,2>{0.122597307f, 0.0708534643f},
-std::array<float,2>{0.238373443f, 0.924850225f},
-std::array<float,2>{0.648587883f, 0.239990979f},
-std::array<float,2>{0.925400436f, 0.68762213f},
-std::array<float,2>{0.254624188f, 0.40217191f},
-std::array<float,2>{0.483605683f, 0.990015924f},
-std::array<float,2>{0.758291423f, 0.175653234f},
-std::array<float,2>{0.539116979f, 0.653953195f},
-std::array<float,2>{0.0390505306f, 0.441452682f},
-std::array<float,2>{0.131651759f, 0.538173974f},
-std::array<float,2>{0.703845441f, 0.36563465f},
-std::array<float,2>{0.99834466f, 0.779612482f},
-std::array<float,2>{0.359976888f, 0.0367397554f},
-std::array<float,2>{0.307742864f, 0.74148792f},
-std::array<float,2>{0.895484924f, 0.437095374f},
-std::array<float,2>{0.682147861f, 0.895178318f},
-std::array<float,2>{0.204180568f, 0.197983444f},
-std::array<float,2>{0.0754930824f, 0.858103871f},
-std::array<float,2>{0.587885439f, 0.101249442f},
-std::array<float,2>{0.866302311f, 0.569686055f},
-std::array<float,2>{0.381246328f, 0.267013282f},
-std::array<float,2>{0.30031544f, 0.981644988f},
-std::array<float,2>{0.901378989f, 0.171184927f},
-std::array<float,2>{0.677493274f, 0.626199186f},
-std::array<float,2>{0.214123428f, 0.453996599f},
-std::array<float,2>{0.0682292059f, 0.550949931f},
-std::array<float,2>{0.581382155f, 0.357973844f},
-std::array<float,2>{0.872286856f, 0.765581489f},
-std::array<float,2>{0.388736635f, 0.0592947863f},
-std::array<float,2>{0.471965551f, 0.729977727f},
-std::array<float,2>{0.75363946f, 0.414054841f},
-std::array<float,2>{0.538513422f, 0.881233394f},
-std::array<float,2>{0.0412130952f, 0.212119475f},
-std::array<float,2>{0.139586091f, 0.862223208f},
-std::array<float,2>{0.71101737f, 0.122524157f},
-std::array<float,2>{0.985218525f, 0.58891809f},
-std::array<float,2>{0.372240841f, 0.256419957f},
-std::array<float,2>{0.415622145f, 0.805273414f},
-std::array<float,2>{0.815129459f, 0.0257877726f},
-std::array<float,2>{0.613010943f, 0.500363588f},
-std::array<float,2>{0.114477813f, 0.318180561f},
-std::array<float,2>{0.243336618f, 0.662018061f},
-std::array<float,2>{0.644202232f, 0.498459637f},
-std::array<float,2>{0.932981968f, 0.95351404f},
-std::array<float,2>{0.264336854f, 0.144515902f},
-std::array<float,2>{0.322481364f, 0.614894807f},
-std::array<float,2>{0.945667863f, 0.308364719f},
-std::array<float,2>{0.718758106f, 0.824795127f},
-std::array<float,2>{0.183597505f, 0.0842754915f},
-std::array<float,2>{0.00577881979f, 0.907250643f},
-std::array<float,2>{0.505654097f, 0.233098403f},
-std::array<float,2>{0.803156614f, 0.718219042f},
-std::array<float,2>{0.43994388f, 0.385932207f},
-std::array<float,2>{0.346847355f, 0.839457512f},
-std::array<float,2>{0.973963916f, 0.0777724162f},
-std::array<float,2>{0.691692531f, 0.596471906f},
-std::array<float,2>{0.145667225f, 0.282727629f},
-std::array<float,2>{0.0621700436f, 0.692958236f},
-std::array<float,2>{0.561057806f, 0.405691773f},
-std::array<float,2>{0.771784484f, 0.927047551f},
-std::array<float,2>{0.486336023f, 0.2360612f},
-std::array<float,2>{0.393818349f, 0.526272118f},
-std::array<float,2>{0.851913273f, 0.34022662f},
-std::array<float,2>{0.57219559f, 0.793357849f},
-std::array<float,2>{0.0903849751f, 0.0129746497f},
-std::array<float,2>{0.188890144f, 0.950003505f},
-std::array<float,2>{0.662430108f, 0.139692426f},
-std::array<float,2>{0.886687696f, 0.678828418f},
-std::array<float,2>{0.281704158f, 0.472808033f},
-std::array<float,2>{0.461428642f, 0.893103123f},
-std::array<float,2>{0.790403843f, 0.199444234f},
-std::array<float,2>{0.52434063f, 0.736282229f},
-std::array<float,2>{0.0297718737f, 0.430378467f},
-std::array<float,2>{0.156623676f, 0.565382719f},
-std::array<float,2>{0.738048255f, 0.270302355f},
-std::array<float,2>{0.962674379f, 0.854346335f},
-std::array<float,2>{0.33544758f, 0.0948788226f},
-std::array<float,2>{0.265854329f, 0.649382234f},
-std::array<float,2>{0.914536297f, 0.438621432f},
-std::array<float,2>{0.629977167f, 0.986479759f},
-std::array<float,2>{0.232254401f, 0.176178291f},
-std::array<float,2>{0.0971312523f, 0.776332021f},
-std::array<float,2>{0.603434503f, 0.0347608291f},
-std::array<float,2>{0.839194477f, 0.534129262f},
-std::array<float,2>{0.426781267f, 0.360246032f},
-std::array<float,2>{0.338773429f, 0.934166789f},
-std::array<float,2>{0.956311464f, 0.244859263f},
-std::array<float,2>{0.74549669f, 0.695385575f},
-std::array<float,2>{0.170912862f, 0.392731607f},
-std::array<float,2>{0.0180554558f, 0.608685911f},
-std::array<float,2>{0.519604325f, 0.293525785f},
-std::array<float,2>{0.785830557f, 0.832896709f},
-std::array<float,2>{0.454553902f, 0.0693829656f},
-std::array<float,2>{0.430356294f, 0.6819278f},
-std::array<float,2>{0.835909069f, 0.482046187f},
-std::array<float,2>{0.598928392f, 0.941110313f},
-std::array<float,2>{0.10301809f, 0.125851482f},
-std::array<float,2>{0.226559147f, 0.783935905f},
-std::array<float,2>{0.632928431f, 0.00445912406f},
-std::array<float,2>{0.906266689f, 0.520935774f},
-std::array<float,2>{0.2744295f, 0.33076486f},
-std::array<float,2>{0.492289066f, 0.844895184f},
-std::array<float,2>{0.780789554f, 0.105120748f},
-std::array<float,2>{0.551431656f, 0.576097429f},
-std::array<float,2>{0.0472538099f, 0.277002513f},
-std::array<float,2>{0.155079737f, 0.743228376f},
-std::array<float,2>{0.698393464f, 0.423058033f},
-std::array<float,2>{0.984121203f, 0.904122651f},
-std::array<float,2>{0.353280902f, 0.194118023f},
-std::array<float,2>{0.290540993f, 0.541802526f},
-std::array<float,2>{0.879168868f, 0.368594527f},
-std::array<float,2>{0.666268408f, 0.772044003f},
-std::array<float,2>{0.195756063f, 0.0453901626f},
-std::array<float,2>{0.080976218f, 0.998112202f},
-std::array<float,2>{0.564411879f, 0.182780027f},
-std::array<float,2>{0.850781977f, 0.642577946f},
-std::array<float,2>{0.404468775f, 0.447966218f},
-std::array<float,2>{0.253854454f, 0.753719985f},
-std::array<float,2>{0.928494632f, 0.0477520525f},
-std::array<float,2>{0.655070901f, 0.557409823f},
-std::array<float,2>{0.236832976f, 0.350847453f},
-std::array<float,2>{0.120069407f, 0.639730215f},
-std::array<float,2>{0.61994189f, 0.466239542f},
-std::array<float,2>{0.821079791f, 0.974566579f},
-std::array<float,2>{0.412601501f, 0.16010882f},
-std::array<float,2>{0.447117716f, 0.584058285f},
-std::array<float,2>{0.808074236f, 0.262728751f},
-std::array<float,2>{0.514591575f, 0.87435925f},
-std::array<float,2>{0.0150920674f, 0.11169409f},
-std::array<float,2>{0.17700091f, 0.887804687f},
-std::array<float,2>{0.728948593f, 0.206987068f},
-std::array<float,2>{0.937974453f, 0.725691259f},
-std::array<float,2>{0.317875803f, 0.415224433f},
-std::array<float,2>{0.377122819f, 0.968362212f},
-std::array<float,2>{0.860759556f, 0.150960162f},
-std::array<float,2>{0.590442121f, 0.671398222f},
-std::array<float,2>{0.0739656091f, 0.489959091f},
-std::array<float,2>{0.210781485f, 0.508660853f},
-std::array<float,2>{0.686568975f, 0.326001406f},
-std::array<float,2>{0.891672671f, 0.800123692f},
-std::array<float,2>{0.311809242f, 0.0187636297f},
-std::array<float,2>{0.367123872f, 0.709120512f},
-std::array<float,2>{0.993644297f, 0.376806706f},
-std::array<float,2>{0.709458828f, 0.916119695f},
-std::array<float,2>{0.125294194f, 0.223049864f},
-std::array<float,2>{0.0321882293f, 0.813017964f},
-std::array<float,2>{0.545383096f, 0.0883672014f},
-std::array<float,2>{0.764532089f, 0.620281219f},
-std::array<float,2>{0.479664415f, 0.299493819f},
-std::array<float,2>{0.314178318f, 0.947742641f},
-std::array<float,2>{0.944924414f, 0.134541586f},
-std::array<float,2>{0.733703315f, 0.672405303f},
-std::array<float,2>{0.173820049f, 0.472023964f},
-std::array<float,2>{0.00895115361f, 0.529822886f},
-std::array<float,2>{0.509040773f, 0.33740294f},
-std::array<float,2>{0.809189796f, 0.78981173f},
-std::array<float,2>{0.451524734f, 0.0101420637f},
-std::array<float,2>{0.408202291f, 0.688208461f},
-std::array<float,2>{0.824243426f, 0.401816905f},
-std::array<float,2>{0.62231642f, 0.925647676f},
-std::array<float,2>{0.123940744f, 0.239356875f},
-std::array<float,2>{0.241156116f, 0.840355337f},
-std::array<float,2>{0.651373446f, 0.0705778003f},
-std::array<float,2>{0.923037827f, 0.600952923f},
-std::array<float,2>{0.256025404f, 0.285516024f},
-std::array<float,2>{0.482200772f, 0.780088961f},
-std::array<float,2>{0.760195315f, 0.0362932757f},
-std::array<float,2>{0.541125476f, 0.538840711f},
-std::array<float,2>{0.0364774279f, 0.365944415f},
-std::array<float,2>{0.129640117f, 0.653740287f},
-std::array<float,2>{0.706646264f, 0.442084372f},
-std::array<float,2>{0.996283054f, 0.989423215f},
-std::array<float,2>{0.362879962f, 0.175027639f},
-std::array<float,2>{0.305285662f, 0.570070624f},
-std::array<float,2>{0.896950006f, 0.267186165f},
-std::array<float,2>{0.680892885f, 0.857858777f},
-std::array<float,2>{0.205200896f, 0.100846335f},
-std::array<float,2>{0.0768140182f, 0.894684732f},
-std::array<float,2>{0.587989509f, 0.197606534f},
-std::array<float,2>{0.864909947f, 0.742037058f},
-std::array<float,2>{0.379455566f, 0.436987847f},
-std::array<float,2>{0.277366966f, 0.865788996f},
-std::array<float,2>{0.911888301f, 0.118326135f},
-std::array<float,2>{0.636748731f, 0.591976762f},
-std::array<float,2>{0.220139802f, 0.250385731f},
-std::array<float,2>{0.107281849f, 0.732249439f},
-std::array<float,2>{0.593771517f, 0.409224331f},
-std::array<float,2>{0.828204632f, 0.875940382f},
-std::array<float,2>{0.433824658f, 0.215488479f},
-std::array<float,2>{0.458155513f, 0.54693228f},
-std::array<float,2>{0.781746089f, 0.353223115f},
-std::array<float,2>{0.519451261f, 0.760016263f},
-std::array<float,2>{0.0200211015f, 0.0560560636f},
-std::array<float,2>{0.164329678f, 0.977955997f},
-std::array<float,2>{0.747541368f, 0.166456565f},
-std::array<float,2>{0.957484841f, 0.632765353f},
-std::array<float,2>{0.340909541f, 0.459758759f},
-std::array<float,2>{0.399413854f, 0.911432922f},
-std::array<float,2>{0.846649945f, 0.228700787f},
-std::array<float,2>{0.570036054f, 0.714534044f},
-std::array<float,2>{0.0849284753f, 0.389944941f},
-std::array<float,2>{0.199285641f, 0.610834062f},
-std::array<float,2>{0.669481874f, 0.308702439f},
-std::array<float,2>{0.877186298f, 0.82205832f},
-std::array<float,2>{0.296038806f, 0.0801074207f},
-std::array<float,2>{0.357899368f, 0.656570375f},
-std::array<float,2>{0.977840781f, 0.493226975f},
-std::array<float,2>{0.703016996f, 0.959843695f},
-std::array<float,2>{0.150761217f, 0.146130532f},
-std::array<float,2>{0.0523161143f, 0.811644375f},
-std::array<float,2>{0.548244655f, 0.0299694091f},
-std::array<float,2>{0.776871383f, 0.506048858f},
-std::array<float,2>{0.4969019f, 0.316131026f},
-std::array<float,2>{0.285957992f, 0.88583535f},
-std::array<float,2>{0.888915122f, 0.207912832f},
-std::array<float,2>{0.658219039f, 0.721740603f},
-std::array<float,2>{0.193110496f, 0.419165701f},
-std::array<float,2>{0.0861153901f, 0.578766048f},
-std::array<float,2>{0.577687144f, 0.261502743f},
-std::array<float,2>{0.855974436f, 0.86859113f},
-std::array<float,2>{0.396943986f, 0.116071604f},
-std::array<float,2>{0.491479874f, 0.633865774f},
-std::array<float,2>{0.768059909f, 0.462929696f},
-std::array<float,2>{0.557423592f, 0.97100842f},
-std::array<float,2>{0.0556809492f, 0.160559818f},
-std::array<float,2>{0.144441232f, 0.757682443f},
-std::array<float,2>{0.687760174f, 0.0519492216f},
-std::array<float,2>{0.971055865f, 0.560429096f},
-std::array<float,2>{0.348513365f, 0.345596582f},
-std::array<float,2>{0.425643951f, 0.819068611f},
-std::array<float,2>{0.842992783f, 0.0903182477f},
-std::array<float,2>{0.606400728f, 0.621163666f},
-std::array<float,2>{0.10033001f, 0.301172137f},
-std::array<float,2>{0.229544863f, 0.704578519f},
-std::array<float,2>{0.625044644f, 0.381138861f},
-std::array<float,2>{0.921797752f, 0.919188678f},
-std::array<float,2>{0.273302644f, 0.221816421f},
-std::array<float,2>{0.330280811f, 0.512238026f},
-std::array<float,2>{0.966005027f, 0.323308766f},
-std::array<float,2>{0.739554465f, 0.802742839f},
-std::array<float,2>{0.163408026f, 0.0231221262f},
-std::array<float,2>{0.0265965201f, 0.963973582f},
-std::array<float,2>{0.527664244f, 0.153814659f},
-std::array<float,2>{0.796069324f, 0.664416432f},
-std::array<float,2>{0.468166262f, 0.485295355f},
-std::array<float,2>{0.367468983f, 0.786411583f},
-std::array<float,2>{0.992043853f, 0.00280224415f},
-std::array<float,2>{0.715364754f, 0.516228437f},
-std::array<float,2>{0.135368511f, 0.335684448f},
-std::array<float,2>{0.0435106792f, 0.685417831f},
-std::array<float,2>{0.532684863f, 0.480047554f},
-std::array<float,2>{0.756023526f, 0.945131421f},
-std::array<float,2>{0.476515919f, 0.132227868f},
-std::array<float,2>{0.382863313f, 0.603158355f},
-std::array<float,2>{0.869021833f, 0.292760193f},
-std::array<float,2>{0.584338129f, 0.831551135f},
-std::array<float,2>{0.0660171956f, 0.0628471971f},
-std::array<float,2>{0.216331542f, 0.930708051f},
-std::array<float,2>{0.673334241f, 0.246324569f},
-std::array<float,2>{0.902794957f, 0.701298892f},
-std::array<float,2>{0.303508043f, 0.395272315f},
-std::array<float,2>{0.443561107f, 0.994100273f},
-std::array<float,2>{0.798638225f, 0.184811711f},
-std::array<float,2>{0.503509104f, 0.648365676f},
-std::array<float,2>{0.00275129522f, 0.450146347f},
-std::array<float,2>{0.180825546f, 0.545069218f},
-std::array<float,2>{0.725042522f, 0.374591976f},
-std::array<float,2>{0.950534701f, 0.766017497f},
-std::array<float,2>{0.324438363f, 0.0428965092f},
-std::array<float,2>{0.259233892f, 0.748967707f},
-std::array<float,2>{0.934019268f, 0.427138209f},
-std::array<float,2>{0.648017585f, 0.902272701f},
-std::array<float,2>{0.249561161f, 0.190138578f},
-std::array<float,2>{0.110088311f, 0.849233031f},
-std::array<float,2>{0.616675675f, 0.107685059f},
-std::array<float,2>{0.818255663f, 0.572797716f},
-std::array<float,2>{0.421817899f, 0.277828574f},
-std::array<float,2>{0.251614004f, 0.97368598f},
-std::array<float,2>{0.92668432f, 0.159203023f},
-std::array<float,2>{0.652838826f, 0.640304744f},
-std::array<float,2>{0.235720024f, 0.466572225f},
-std::array<float,2>{0.117529154f, 0.556803167f},
-std::array<float,2>{0.617952943f, 0.351431936f},
-std::array<float,2>{0.824042618f, 0.753130019f},
-std::array<float,2>{0.410319388f, 0.0470265336f},
-std::array<float,2>{0.448583394f, 0.726135135f},
-std::array<float,2>{0.804792941f, 0.415900499f},
-std::array<float,2>{0.512700438f, 0.888227642f},
-std::array<float,2>{0.0131503828f, 0.206195816f},
-std::array<float,2>{0.177794084f, 0.874550641f},
-std::array<float,2>{0.726707816f, 0.11188978f},
-std::array<float,2>{0.939774454f, 0.584942758f},
-std::array<float,2>{0.318439424f, 0.263616472f},
-std::array<float,2>{0.375454515f, 0.800715744f},
-std::array<float,2>{0.862124681f, 0.0195176881f},
-std::array<float,2>{0.592576087f, 0.508052588f},
-std::array<float,2>{0.0707913935f, 0.325369596f},
-std::array<float,2>{0.208023846f, 0.67130357f},
-std::array<float,2>{0.684384763f, 0.489721805f},
-std::array<float,2>{0.893026412f, 0.967928231f},
-std::array<float,2>{0.30907312f, 0.150790483f},
-std::array<float,2>{0.365198255f, 0.621019125f},
-std::array<float,2>{0.995064735f, 0.298889428f},
-std::array<float,2>{0.707984984f, 0.812858045f},
-std::array<float,2>{0.128830075f, 0.0887862071f},
-std::array<float,2>{0.0338310599f, 0.916508675f},
-std::array<float,2>{0.544340909f, 0.223574191f},
-std::array<float,2>{0.762497663f, 0.70983547f},
-std::array<float,2>{0.477809727f, 0.376289576f},
-std::array<float,2>{0.337468505f, 0.832128644f},
-std::array<float,2>{0.953995109f, 0.0702738687f},
-std::array<float,2>{0.742698491f, 0.609104633f},
-std::array<float,2>{0.16927202f, 0.293187559f},
-std::array<float,2>{0.0166279394f, 0.696214855f},
-std::array<float,2>{0.521943092f, 0.39328298f},
-std::array<float,2>{0.788174808f, 0.934018612f},
-std::array<float,2>{0.455261827f, 0.244172156f},
-std::array<float,2>{0.431950212f, 0.521396816f},
-std::array<float,2>{0.832372665f, 0.330512851f},
-std::array<float,2>{0.600060105f, 0.783685148f},
-std::array<float,2>{0.1052927f, 0.00396518828f},
-std::array<float,2>{0.222860903f, 0.940506935f},
-std::array<float,2>{0.636369586f, 0.125116125f},
-std::array<float,2>{0.908560097f, 0.682347357f},
-std::array<float,2>{0.276022613f, 0.481782079f},
-std::array<float,2>{0.494187087f, 0.903426409f},
-std::array<float,2>{0.777559996f, 0.193573982f},
-std::array<float,2>{0.553706586f, 0.743780553f},
-std::array<float,2>{0.049207706f, 0.423467964f},
-std::array<float,2>{0.152398407f, 0.575677693f},
-std::array<float,2>{0.696518719f, 0.276631057f},
-std::array<float,2>{0.982390881f, 0.845302284f},
-std::array<float,2>{0.355249494f, 0.104596972f},
-std::array<float,2>{0.292365551f, 0.642056644f},
-std::array<float,2>{0.882416725f, 0.447475165f},
-std::array<float,2>{0.66504693f, 0.998928726f},
-std::array<float,2>{0.197340339f, 0.183137298f},
-std::array<float,2>{0.0785634741f, 0.771682799f},
-std::array<float,2>{0.565405309f, 0.0458141305f},
-std::array<float,2>{0.847751737f, 0.541192412f},
-std::array<float,2>{0.404212803f, 0.368954331f},
-std::array<float,2>{0.344516963f, 0.927669644f},
-std::array<float,2>{0.976427138f, 0.235415578f},
-std::array<float,2>{0.694230676f, 0.692581475f},
-std::array<float,2>{0.148132265f, 0.406064183f},
-std::array<float,2>{0.0601828434f, 0.595746577f},
-std::array<float,2>{0.559681833f, 0.282303751f},
-std::array<float,2>{0.770940423f, 0.839193702f},
-std::array<float,2>{0.486002058f, 0.0773048997f},
-std::array<float,2>{0.391670942f, 0.679503441f},
-std::array<float,2>{0.853685439f, 0.473304778f},
-std::array<float,2>{0.57341212f, 0.949549437f},
-std::array<float,2>{0.0936612785f, 0.140411481f},
-std::array<float,2>{0.191389427f, 0.79363811f},
-std::array<float,2>{0.660273433f, 0.0136079332f},
-std::array<float,2>{0.884552002f, 0.525507331f},
-std::array<float,2>{0.284259081f, 0.340634167f},
-std::array<float,2>{0.463186145f, 0.853991389f},
-std::array<float,2>{0.791104674f, 0.0956121609f},
-std::array<float,2>{0.526333392f, 0.5644871f},
-std::array<float,2>{0.0278361719f, 0.269692928f},
-std::array<float,2>{0.160040602f, 0.735580683f},
-std::array<float,2>{0.734619856f, 0.430084348f},
-std::array<float,2>{0.963349581f, 0.892838836f},
-std::array<float,2>{0.332090467f, 0.200143114f},
-std::array<float,2>{0.269342393f, 0.533420086f},
-std::array<float,2>{0.91782099f, 0.359413087f},
-std::array<float,2>{0.631566107f, 0.775859416f},
-std::array<float,2>{0.233760566f, 0.0345449671f},
-std::array<float,2>{0.0950538442f, 0.986835539f},
-std::array<float,2>{0.605228782f, 0.17658481f},
-std::array<float,2>{0.837797403f, 0.648621559f},
-std::array<float,2>{0.428213f, 0.438994586f},
-std::array<float,2>{0.298467427f, 0.764993668f},
-std::array<float,2>{0.900335789f, 0.0589235574f},
-std::array<float,2>{0.679183066f, 0.551339388f},
-std::array<float,2>{0.211272344f, 0.357726097f},
-std::array<float,2>{0.0698525533f, 0.626499355f},
-std::array<float,2>{0.579398751f, 0.453137308f},
-std::array<float,2>{0.873099923f, 0.982223928f},
-std::array<float,2>{0.387093306f, 0.171607703f},
-std::array<float,2>{0.470243216f, 0.589396298f},
-std::array<float,2>{0.750054538f, 0.256330401f},
-std::array<float,2>{0.535981894f, 0.861417055f},
-std::array<float,2>{0.0396738015f, 0.12296471f},
-std::array<float,2>{0.138256818f, 0.881637752f},
-std::array<float,2>{0.714190841f, 0.212883592f},
-std::array<float,2>{0.987791955f, 0.730383873f},
-std::array<float,2>{0.37421748f, 0.413442105f},
-std::array<float,2>{0.416687042f, 0.953810692f},
-std::array<float,2>{0.81382364f, 0.143724948f},
-std::array<float,2>{0.610561371f, 0.661266565f},
-std::array<float,2>{0.116668031f, 0.498710245f},
-std::array<float,2>{0.244165316f, 0.50082016f},
-std::array<float,2>{0.64166522f, 0.317648888f},
-std::array<float,2>{0.930013895f, 0.804957926f},
-std::array<float,2>{0.261861444f, 0.0262398962f},
-std::array<float,2>{0.320541918f, 0.718524873f},
-std::array<float,2>{0.948586464f, 0.386712134f},
-std::array<float,2>{0.720704496f, 0.907971382f},
-std::array<float,2>{0.186889544f, 0.232492343f},
-std::array<float,2>{0.00629591336f, 0.824230075f},
-std::array<float,2>{0.507748544f, 0.0849001855f},
-std::array<float,2>{0.801319778f, 0.614592373f},
-std::array<float,2>{0.43793872f, 0.307738185f},
-std::array<float,2>{0.359750956f, 0.990970314f},
-std::array<float,2>{0.998930454f, 0.173186213f},
-std::array<float,2>{0.703537285f, 0.655464947f},
-std::array<float,2>{0.131051242f, 0.444501728f},
-std::array<float,2>{0.038241636f, 0.536278903f},
-std::array<float,2>{0.540001452f, 0.36476928f},
-std::array<float,2>{0.758653581f, 0.778862476f},
-std::array<float,2>{0.484195471f, 0.0372827314f},
-std::array<float,2>{0.381640047f, 0.739424825f},
-std::array<float,2>{0.866870463f, 0.435064912f},
-std::array<float,2>{0.587360501f, 0.898364007f},
-std::array<float,2>{0.0759409666f, 0.196307629f},
-std::array<float,2>{0.204831809f, 0.855621159f},
-std::array<float,2>{0.681738675f, 0.0979766846f},
-std::array<float,2>{0.894549131f, 0.567308068f},
-std::array<float,2>{0.308410048f, 0.269355237f},
-std::array<float,2>{0.450126976f, 0.791866124f},
-std::array<float,2>{0.811920166f, 0.00852801837f},
-std::array<float,2>{0.510159135f, 0.528188229f},
-std::array<float,2>{0.0103184115f, 0.33836931f},
-std::array<float,2>{0.174177647f, 0.675368547f},
-std::array<float,2>{0.730473518f, 0.469625086f},
-std::array<float,2>{0.942692637f, 0.946963727f},
-std::array<float,2>{0.315979272f, 0.136692539f},
-std::array<float,2>{0.25411129f, 0.597739935f},
-std::array<float,2>{0.924852669f, 0.288107216f},
-std::array<float,2>{0.649380803f, 0.842892468f},
-std::array<float,2>{0.238772228f, 0.0723637417f},
-std::array<float,2>{0.122283593f, 0.923666418f},
-std::array<float,2>{0.624971032f, 0.241850495f},
-std::array<float,2>{0.828006506f, 0.689587235f},
-std::array<float,2>{0.408636719f, 0.398594737f},
-std::array<float,2>{0.294653654f, 0.823223054f},
-std::array<float,2>{0.87511456f, 0.0796853006f},
-std::array<float,2>{0.670762181f, 0.611424387f},
-std::array<float,2>{0.202909902f, 0.310653448f},
-std::array<float,2>{0.0823212415f, 0.712112963f},
-std::array<float,2>{0.567616642f, 0.386768073f},
-std::array<float,2>{0.84563148f, 0.913117945f},
-std::array<float,2>{0.401064187f, 0.226979405f},
-std::array<float,2>{0.498560786f, 0.504283309f},
-std::array<float,2>{0.773562074f, 0.313487291f},
-std::array<float,2>{0.549813628f, 0.81014061f},
-std::array<float,2>{0.0533273779f, 0.0291753467f},
-std::array<float,2>{0.150019333f, 0.957049191f},
-std::array<float,2>{0.700507581f, 0.147340596f},
-std::array<float,2>{0.980291486f, 0.659459412f},
-std::array<float,2>{0.356560141f, 0.494427085f},
-std::array<float,2>{0.435896456f, 0.878308892f},
-std::array<float,2>{0.830553234f, 0.216841996f},
-std::array<float,2>{0.596592844f, 0.733095884f},
-std::array<float,2>{0.10823106f, 0.406836838f},
-std::array<float,2>{0.222082287f, 0.590437055f},
-std::array<float,2>{0.639517665f, 0.252730012f},
-std::array<float,2>{0.913273275f, 0.864048779f},
-std::array<float,2>{0.279788882f, 0.119450867f},
-std::array<float,2>{0.342594862f, 0.630309105f},
-std::array<float,2>{0.960624397f, 0.458929241f},
-std::array<float,2>{0.748514056f, 0.978737056f},
-std::array<float,2>{0.166829497f, 0.164291844f},
-std::array<float,2>{0.0220513325f, 0.759049952f},
-std::array<float,2>{0.517058969f, 0.0578109883f},
-std::array<float,2>{0.784758627f, 0.54956919f},
-std::array<float,2>{0.459778637f, 0.353733182f},
-std::array<float,2>{0.269980371f, 0.921089947f},
-std::array<float,2>{0.919354379f, 0.21928291f},
-std::array<float,2>{0.628030717f, 0.706801355f},
-std::array<float,2>{0.226613343f, 0.379192054f},
-std::array<float,2>{0.0984803215f, 0.62373364f},
-std::array<float,2>{0.60756278f, 0.303541213f},
-std::array<float,2>{0.839977801f, 0.818006575f},
-std::array<float,2>{0.423621267f, 0.0922429562f},
-std::array<float,2>{0.465497047f, 0.666978478f},
-std::array<float,2>{0.794291377f, 0.488218665f},
-std::array<float,2>{0.531042814f, 0.961065292f},
-std::array<float,2>{0.0242157206f, 0.154930338f},
-std::array<float,2>{0.160439089f, 0.801532567f},
-std::array<float,2>{0.742115259f, 0.020258788f},
-std::array<float,2>{0.968331695f, 0.514163435f},
-std::array<float,2>{0.328292638f, 0.321515024f},
-std::array<float,2>{0.395380408f, 0.87026149f},
-std::array<float,2>{0.858904064f, 0.114701465f},
-std::array<float,2>{0.574804366f, 0.580451131f},
-std::array<float,2>{0.089472197f, 0.259062439f},
-std::array<float,2>{0.195272028f, 0.720276356f},
-std::array<float,2>{0.657813311f, 0.420475751f},
-std::array<float,2>{0.88742578f, 0.884176612f},
-std::array<float,2>{0.28823489f, 0.210762918f},
-std::array<float,2>{0.350886285f, 0.56114614f},
-std::array<float,2>{0.970003009f, 0.346601218f},
-std::array<float,2>{0.690311193f, 0.75459224f},
-std::array<float,2>{0.141838208f, 0.0527462699f},
-std::array<float,2>{0.0584328137f, 0.970217526f},
-std::array<float,2>{0.555089593f, 0.164037004f},
-std::array<float,2>{0.76617682f, 0.63494581f},
-std::array<float,2>{0.489310622f, 0.462649137f},
-std::array<float,2>{0.327400416f, 0.76805532f},
-std::array<float,2>{0.951504171f, 0.0391314775f},
-std::array<float,2>{0.722894609f, 0.544484854f},
-std::array<float,2>{0.182970837f, 0.372387469f},
-std::array<float,2>{0.00179276185f, 0.64475143f},
-std::array<float,2>{0.501217604f, 0.45242703f},
-std::array<float,2>{0.798987687f, 0.994581997f},
-std::array<float,2>{0.442405641f, 0.185974076f},
-std::array<float,2>{0.419428766f, 0.571620107f},
-std::array<float,2>{0.820214629f, 0.279860407f},
-std::array<float,2>{0.615050614f, 0.85058862f},
-std::array<float,2>{0.112021983f, 0.107418872f},
-std::array<float,2>{0.246202588f, 0.899880528f},
-std::array<float,2>{0.64495641f, 0.187725186f},
-std::array<float,2>{0.936787844f, 0.747533858f},
-std::array<float,2>{0.261576116f, 0.429521024f},
-std::array<float,2>{0.474334329f, 0.943252265f},
-std::array<float,2>{0.754424512f, 0.13045758f},
-std::array<float,2>{0.535125136f, 0.686296046f},
-std::array<float,2>{0.0460695773f, 0.478237033f},
-std::array<float,2>{0.134372368f, 0.519390047f},
-std::array<float,2>{0.717433453f, 0.333812684f},
-std::array<float,2>{0.989971817f, 0.787588954f},
-std::array<float,2>{0.371035784f, 0.000993558555f},
-std::array<float,2>{0.301162601f, 0.699647844f},
-std::array<float,2>{0.905329525f, 0.397869527f},
-std::array<float,2>{0.67408067f, 0.933327854f},
-std::array<float,2>{0.217696026f, 0.248907641f},
-std::array<float,2>{0.0628286302f, 0.82957828f},
-std::array<float,2>{0.583557546f, 0.0659341067f},
-std::array<float,2>{0.870596349f, 0.604303062f},
-std::array<float,2>{0.385628104f, 0.289672256f},
-std::array<float,2>{0.312259465f, 0.965563238f},
-std::array<float,2>{0.892491281f, 0.149983853f},
-std::array<float,2>{0.687267661f, 0.669444084f},
-std::array<float,2>{0.210438833f, 0.491538048f},
-std::array<float,2>{0.0735368431f, 0.510498166f},
-std::array<float,2>{0.590117395f, 0.327982813f},
-std::array<float,2>{0.86113292f, 0.797299981f},
-std::array<float,2>{0.377750099f, 0.016071938f},
-std::array<float,2>{0.480267256f, 0.708079636f},
-std::array<float,2>{0.763683081f, 0.377643615f},
-std::array<float,2>{0.545684993f, 0.915428758f},
-std::array<float,2>{0.0316529237f, 0.226372406f},
-std::array<float,2>{0.125941798f, 0.816057682f},
-std::array<float,2>{0.70952332f, 0.0867839307f},
-std::array<float,2>{0.993982255f, 0.617283762f},
-std::array<float,2>{0.366672218f, 0.297476828f},
-std::array<float,2>{0.412546784f, 0.750724614f},
-std::array<float,2>{0.820676625f, 0.0489134267f},
-std::array<float,2>{0.619267046f, 0.556568921f},
-std::array<float,2>{0.119582377f, 0.349351853f},
-std::array<float,2>{0.236702904f, 0.636873066f},
-std::array<float,2>{0.6544258f, 0.467380077f},
-std::array<float,2>{0.928090215f, 0.975509942f},
-std::array<float,2>{0.253078163f, 0.158142015f},
-std::array<float,2>{0.317499965f, 0.583114266f},
-std::array<float,2>{0.938302875f, 0.265394062f},
-std::array<float,2>{0.729119658f, 0.872908175f},
-std::array<float,2>{0.177321151f, 0.10986381f},
-std::array<float,2>{0.0155446669f, 0.889860511f},
-std::array<float,2>{0.514119983f, 0.203666225f},
-std::array<float,2>{0.808420002f, 0.722940326f},
-std::array<float,2>{0.446497172f, 0.416656613f},
-std::array<float,2>{0.352904826f, 0.846498668f},
-std::array<float,2>{0.983659923f, 0.103470318f},
-std::array<float,2>{0.699191809f, 0.577770174f},
-std::array<float,2>{0.154471382f, 0.275317371f},
-std::array<float,2>{0.0473897606f, 0.745281875f},
-std::array<float,2>{0.550936341f, 0.424149245f},
-std::array<float,2>{0.780669212f, 0.906053007f},
-std::array<float,2>{0.493115813f, 0.193162486f},
-std::array<float,2>{0.405251503f, 0.54004699f},
-std::array<float,2>{0.85119319f, 0.370369315f},
-std::array<float,2>{0.563793838f, 0.770144701f},
-std::array<float,2>{0.0804182664f, 0.0441285111f},
-std::array<float,2>{0.196233496f, 0.99755764f},
-std::array<float,2>{0.666680038f, 0.180109158f},
-std::array<float,2>{0.879855573f, 0.643841445f},
-std::array<float,2>{0.2901178f, 0.446427941f},
-std::array<float,2>{0.454969496f, 0.936775565f},
-std::array<float,2>{0.785544276f, 0.243294537f},
-std::array<float,2>{0.520388603f, 0.698091686f},
-std::array<float,2>{0.0181386471f, 0.392233342f},
-std::array<float,2>{0.171474531f, 0.605773568f},
-std::array<float,2>{0.746039271f, 0.296610504f},
-std::array<float,2>{0.956865609f, 0.834470689f},
-std::array<float,2>{0.338278145f, 0.0664341152f},
-std::array<float,2>{0.275079548f, 0.680517495f},
-std::array<float,2>{0.907178164f, 0.483144611f},
-std::array<float,2>{0.633469522f, 0.938525558f},
-std::array<float,2>{0.225633651f, 0.127384499f},
-std::array<float,2>{0.10305278f, 0.782157958f},
-std::array<float,2>{0.599497736f, 0.00750400731f},
-std::array<float,2>{0.835037529f, 0.522096694f},
-std::array<float,2>{0.429812431f, 0.329303324f},
-std::array<float,2>{0.335554868f, 0.89248997f},
-std::array<float,2>{0.96209842f, 0.202893078f},
-std::array<float,2>{0.737467349f, 0.737386525f},
-std::array<float,2>{0.157100871f, 0.433042616f},
-std::array<float,2>{0.0299184993f, 0.563740671f},
-std::array<float,2>{0.52366662f, 0.271511286f},
-std::array<float,2>{0.790748715f, 0.851590872f},
-std::array<float,2>{0.461117685f, 0.0973373502f},
-std::array<float,2>{0.427696943f, 0.6512959f},
-std::array<float,2>{0.839672327f, 0.441310853f},
-std::array<float,2>{0.602790952f, 0.986146033f},
-std::array<float,2>{0.0974294618f, 0.178967401f},
-std::array<float,2>{0.231667861f, 0.773976743f},
-std::array<float,2>{0.630508125f, 0.0331799537f},
-std::array<float,2>{0.914584279f, 0.531847417f},
-std::array<float,2>{0.266244709f, 0.362325519f},
-std::array<float,2>{0.487046957f, 0.836471379f},
-std::array<float,2>{0.772043228f, 0.0755580887f},
-std::array<float,2>{0.560587943f, 0.595158935f},
-std::array<float,2>{0.0615832247f, 0.284909457f},
-std::array<float,2>{0.146314651f, 0.693895698f},
-std::array<float,2>{0.692295671f, 0.403643847f},
-std::array<float,2>{0.974154234f, 0.929339409f},
-std::array<float,2>{0.347648144f, 0.237798557f},
-std::array<float,2>{0.281798273f, 0.524047732f},
-std::array<float,2>{0.885860324f, 0.343105167f},
-std::array<float,2>{0.662800848f, 0.795565426f},
-std::array<float,2>{0.189073354f, 0.0153704174f},
-std::array<float,2>{0.0901656151f, 0.951883554f},
-std::array<float,2>{0.571442664f, 0.137811795f},
-std::array<float,2>{0.852259874f, 0.676890254f},
-std::array<float,2>{0.394295245f, 0.474852115f},
-std::array<float,2>{0.263793528f, 0.806977093f},
-std::array<float,2>{0.933522761f, 0.0240569711f},
-std::array<float,2>{0.644002974f, 0.503091931f},
-std::array<float,2>{0.244096249f, 0.319820702f},
-std::array<float,2>{0.115071885f, 0.662404716f},
-std::array<float,2>{0.612309217f, 0.496529073f},
-std::array<float,2>{0.814896524f, 0.955988586f},
-std::array<float,2>{0.4153139f, 0.142094195f},
-std::array<float,2>{0.439694256f, 0.615718186f},
-std::array<float,2>{0.803411186f, 0.305659205f},
-std::array<float,2>{0.504908621f, 0.827386975f},
-std::array<float,2>{0.0053286883f, 0.0833745599f},
-std::array<float,2>{0.184092298f, 0.909845352f},
-std::array<float,2>{0.719712257f, 0.231244206f},
-std::array<float,2>{0.946265757f, 0.716643929f},
-std::array<float,2>{0.322834283f, 0.383492142f},
-std::array<float,2>{0.389534563f, 0.983801067f},
-std::array<float,2>{0.872871399f, 0.169488862f},
-std::array<float,2>{0.581711888f, 0.628221393f},
-std::array<float,2>{0.0678483918f, 0.456732124f},
-std::array<float,2>{0.21446231f, 0.553111911f},
-std::array<float,2>{0.676947951f, 0.356020361f},
-std::array<float,2>{0.901971221f, 0.762962103f},
-std::array<float,2>{0.300269097f, 0.0608269647f},
-std::array<float,2>{0.372739464f, 0.727696896f},
-std::array<float,2>{0.984522283f, 0.410533071f},
-std::array<float,2>{0.711862743f, 0.880331993f},
-std::array<float,2>{0.138933674f, 0.214421883f},
-std::array<float,2>{0.0418062881f, 0.861008108f},
-std::array<float,2>{0.538589537f, 0.12344873f},
-std::array<float,2>{0.753006816f, 0.586234033f},
-std::array<float,2>{0.472221702f, 0.25488776f},
-std::array<float,2>{0.340033919f, 0.980217934f},
-std::array<float,2>{0.95823741f, 0.165651545f},
-std::array<float,2>{0.746236384f, 0.629792213f},
-std::array<float,2>{0.165447727f, 0.457613796f},
-std::array<float,2>{0.0211946648f, 0.550131023f},
-std::array<float,2>{0.517617047f, 0.354593873f},
-std::array<float,2>{0.782533407f, 0.75835526f},
-std::array<float,2>{0.457953334f, 0.0568098202f},
-std::array<float,2>{0.435193241f, 0.733935833f},
-std::array<float,2>{0.829809964f, 0.407889396f},
-std::array<float,2>{0.595220804f, 0.877267659f},
-std::array<float,2>{0.106167629f, 0.21801123f},
-std::array<float,2>{0.219387904f, 0.864845335f},
-std::array<float,2>{0.637871563f, 0.120790988f},
-std::array<float,2>{0.911119163f, 0.59084332f},
-std::array<float,2>{0.279022872f, 0.253439844f},
-std::array<float,2>{0.497639656f, 0.809063911f},
-std::array<float,2>{0.776317775f, 0.0275276825f},
-std::array<float,2>{0.547215283f, 0.505361259f},
-std::array<float,2>{0.0512610674f, 0.312748194f},
-std::array<float,2>{0.152112424f, 0.658635616f},
-std::array<float,2>{0.702032089f, 0.495586455f},
-std::array<float,2>{0.976904929f, 0.958951533f},
-std::array<float,2>{0.358470887f, 0.147796795f},
-std::array<float,2>{0.295590937f, 0.61248076f},
-std::array<float,2>{0.878604174f, 0.312415272f},
-std::array<float,2>{0.668057799f, 0.82327354f},
-std::array<float,2>{0.200377345f, 0.0787441283f},
-std::array<float,2>{0.0854076073f, 0.912480533f},
-std::array<float,2>{0.568521023f, 0.228335589f},
-std::array<float,2>{0.847589433f, 0.711891294f},
-std::array<float,2>{0.400347561f, 0.387971401f},
-std::array<float,2>{0.257574618f, 0.842736363f},
-std::array<float,2>{0.922647059f, 0.0738391578f},
-std::array<float,2>{0.650574148f, 0.599028528f},
-std::array<float,2>{0.24215056f, 0.288040549f},
-std::array<float,2>{0.124738842f, 0.690551341f},
-std::array<float,2>{0.621176958f, 0.399645865f},
-std::array<float,2>{0.825687647f, 0.922046542f},
-std::array<float,2>{0.40628323f, 0.240804762f},
-std::array<float,2>{0.453070581f, 0.528706372f},
-std::array<float,2>{0.810105801f, 0.339340836f},
-std::array<float,2>{0.507936358f, 0.792847931f},
-std::array<float,2>{0.0081091281f, 0.00967535563f},
-std::array<float,2>{0.172703922f, 0.945395648f},
-std::array<float,2>{0.733105719f, 0.135491535f},
-std::array<float,2>{0.943825662f, 0.674349785f},
-std::array<float,2>{0.312676013f, 0.470583051f},
-std::array<float,2>{0.380218744f, 0.896745265f},
-std::array<float,2>{0.863482893f, 0.196280017f},
-std::array<float,2>{0.589304209f, 0.739187777f},
-std::array<float,2>{0.0780181885f, 0.433929384f},
-std::array<float,2>{0.206828266f, 0.568347931f},
-std::array<float,2>{0.67988193f, 0.268364936f},
-std::array<float,2>{0.898166716f, 0.857396245f},
-std::array<float,2>{0.305879593f, 0.0994747579f},
-std::array<float,2>{0.361765176f, 0.654825747f},
-std::array<float,2>{0.997685015f, 0.443806708f},
-std::array<float,2>{0.70538944f, 0.991595626f},
-std::array<float,2>{0.130220965f, 0.171955675f},
-std::array<float,2>{0.0354580767f, 0.777806818f},
-std::array<float,2>{0.54281199f, 0.038306471f},
-std::array<float,2>{0.76132983f, 0.535737991f},
-std::array<float,2>{0.480724931f, 0.363411188f},
-std::array<float,2>{0.304086894f, 0.931709766f},
-std::array<float,2>{0.903970897f, 0.249222949f},
-std::array<float,2>{0.67219317f, 0.700207472f},
-std::array<float,2>{0.21528028f, 0.397218466f},
-std::array<float,2>{0.0650651082f, 0.604961097f},
-std::array<float,2>{0.585294366f, 0.29069984f},
-std::array<float,2>{0.867422163f, 0.828255951f},
-std::array<float,2>{0.384664953f, 0.0645123646f},
-std::array<float,2>{0.474755764f, 0.686859131f},
-std::array<float,2>{0.757193506f, 0.477278024f},
-std::array<float,2>{0.531693995f, 0.942185938f},
-std::array<float,2>{0.0447072238f, 0.129485235f},
-std::array<float,2>{0.136325002f, 0.788294733f},
-std::array<float,2>{0.715976655f, 5.47153395e-05f},
-std::array<float,2>{0.990368426f, 0.518299222f},
-std::array<float,2>{0.368774414f, 0.3323901f},
-std::array<float,2>{0.420322031f, 0.849742174f},
-std::array<float,2>{0.817165256f, 0.10558603f},
-std::array<float,2>{0.615674675f, 0.571084261f},
-std::array<float,2>{0.11075037f, 0.280453235f},
-std::array<float,2>{0.248423845f, 0.746643305f},
-std::array<float,2>{0.64728868f, 0.42792967f},
-std::array<float,2>{0.935162842f, 0.899117768f},
-std::array<float,2>{0.258179903f, 0.188519865f},
-std::array<float,2>{0.32543239f, 0.543830037f},
-std::array<float,2>{0.949652612f, 0.371646225f},
-std::array<float,2>{0.725788534f, 0.768892765f},
-std::array<float,2>{0.179789722f, 0.0404137112f},
-std::array<float,2>{0.00349599333f, 0.996022522f},
-std::array<float,2>{0.502873123f, 0.187377706f},
-std::array<float,2>{0.796960533f, 0.645894945f},
-std::array<float,2>{0.445224136f, 0.451569706f},
-std::array<float,2>{0.349347323f, 0.755473554f},
-std::array<float,2>{0.971966207f, 0.0540238507f},
-std::array<float,2>{0.688518226f, 0.561560631f},
-std::array<float,2>{0.142909095f, 0.347587615f},
-std::array<float,2>{0.0556465685f, 0.636619508f},
-std::array<float,2>{0.557875335f, 0.461024284f},
-std::array<float,2>{0.76879859f, 0.968786538f},
-std::array<float,2>{0.490969181f, 0.162321135f},
-std::array<float,2>{0.397666782f, 0.581334174f},
-std::array<float,2>{0.85655576f, 0.258619845f},
-std::array<float,2>{0.576947689f, 0.869369626f},
-std::array<float,2>{0.0877037272f, 0.113925323f},
-std::array<float,2>{0.191700518f, 0.883180797f},
-std::array<float,2>{0.659768462f, 0.209700316f},
-std::array<float,2>{0.890413463f, 0.719495475f},
-std::array<float,2>{0.286872029f, 0.421438068f},
-std::array<float,2>{0.467750639f, 0.962027133f},
-std::array<float,2>{0.795080721f, 0.155894801f},
-std::array<float,2>{0.529207885f, 0.667299926f},
-std::array<float,2>{0.0259048361f, 0.486965895f},
-std::array<float,2>{0.162751123f, 0.515279591f},
-std::array<float,2>{0.738354266f, 0.321245342f},
-std::array<float,2>{0.9658041f, 0.801855028f},
-std::array<float,2>{0.331374794f, 0.0205504764f},
-std::array<float,2>{0.271644413f, 0.705083013f},
-std::array<float,2>{0.920432985f, 0.380238712f},
-std::array<float,2>{0.62665987f, 0.920648158f},
-std::array<float,2>{0.228688389f, 0.219850793f},
-std::array<float,2>{0.100631319f, 0.816791058f},
-std::array<float,2>{0.60698843f, 0.0937470198f},
-std::array<float,2>{0.842403471f, 0.624884903f},
-std::array<float,2>{0.424634039f, 0.304354131f},
-std::array<float,2>{0.277306288f, 0.938418508f},
-std::array<float,2>{0.909882486f, 0.128610775f},
-std::array<float,2>{0.634820938f, 0.681100368f},
-std::array<float,2>{0.223981217f, 0.484136671f},
-std::array<float,2>{0.104395196f, 0.523001254f},
-std::array<float,2>{0.601407051f, 0.32879743f},
-std::array<float,2>{0.833116055f, 0.782375395f},
-std::array<float,2>{0.432769209f, 0.00603979407f},
-std::array<float,2>{0.456601083f, 0.698930383f},
-std::array<float,2>{0.787174284f, 0.390720844f},
-std::array<float,2>{0.522556782f, 0.936277151f},
-std::array<float,2>{0.0159376729f, 0.242283285f},
-std::array<float,2>{0.168304473f, 0.835674942f},
-std::array<float,2>{0.744010746f, 0.0677127838f},
-std::array<float,2>{0.954278111f, 0.607052803f},
-std::array<float,2>{0.336541176f, 0.294928372f},
-std::array<float,2>{0.403142929f, 0.771159291f},
-std::array<float,2>{0.848699212f, 0.0434886366f},
-std::array<float,2>{0.566149294f, 0.539184809f},
-std::array<float,2>{0.0794426352f, 0.369879633f},
-std::array<float,2>{0.198564887f, 0.643064916f},
-std::array<float,2>{0.664347172f, 0.445443988f},
-std::array<float,2>{0.8811692f, 0.996954203f},
-std::array<float,2>{0.291685253f, 0.181468993f},
-std::array<float,2>{0.354368865f, 0.576361656f},
-std::array<float,2>{0.980886042f, 0.273808926f},
-std::array<float,2>{0.695462048f, 0.847254813f},
-std::array<float,2>{0.153463736f, 0.102247208f},
-std::array<float,2>{0.0501098633f, 0.905233562f},
-std::array<float,2>{0.554680824f, 0.19163318f},
-std::array<float,2>{0.778361738f, 0.745058179f},
-std::array<float,2>{0.495332599f, 0.425448328f},
-std::array<float,2>{0.319936186f, 0.87196523f},
-std::array<float,2>{0.940945983f, 0.110888742f},
-std::array<float,2>{0.728504181f, 0.582204282f},
-std::array<float,2>{0.179544926f, 0.263827264f},
-std::array<float,2>{0.0118993642f, 0.724196732f},
-std::array<float,2>{0.512689769f, 0.417686075f},
-std::array<float,2>{0.805793703f, 0.889595747f},
-std::array<float,2>{0.447836518f, 0.204474986f},
-std::array<float,2>{0.411354452f, 0.555582047f},
-std::array<float,2>{0.822428584f, 0.348625094f},
-std::array<float,2>{0.619062424f, 0.751334548f},
-std::array<float,2>{0.118731931f, 0.0500574186f},
-std::array<float,2>{0.234871686f, 0.97563237f},
-std::array<float,2>{0.653498948f, 0.156282365f},
-std::array<float,2>{0.927150488f, 0.638604283f},
-std::array<float,2>{0.250313789f, 0.468286633f},
-std::array<float,2>{0.477098912f, 0.91499716f},
-std::array<float,2>{0.763223112f, 0.224777445f},
-std::array<float,2>{0.543002546f, 0.707894146f},
-std::array<float,2>{0.0348146185f, 0.37799719f},
-std::array<float,2>{0.127593905f, 0.618400693f},
-std::array<float,2>{0.708680153f, 0.298112869f},
-std::array<float,2>{0.995635509f, 0.815156579f},
-std::array<float,2>{0.363436341f, 0.087113522f},
-std::array<float,2>{0.309742153f, 0.668189526f},
-std::array<float,2>{0.894397199f, 0.490876585f},
-std::array<float,2>{0.684925079f, 0.966111004f},
-std::array<float,2>{0.207172737f, 0.148813114f},
-std::array<float,2>{0.0720403567f, 0.79802829f},
-std::array<float,2>{0.593619227f, 0.0175543465f},
-std::array<float,2>{0.863088787f, 0.510926962f},
-std::array<float,2>{0.376050562f, 0.326795131f},
-std::array<float,2>{0.373827517f, 0.879712522f},
-std::array<float,2>{0.986789644f, 0.213763148f},
-std::array<float,2>{0.713663101f, 0.727340877f},
-std::array<float,2>{0.136759698f, 0.411179155f},
-std::array<float,2>{0.0403363407f, 0.587147593f},
-std::array<float,2>{0.536172628f, 0.254686922f},
-std::array<float,2>{0.751123011f, 0.859455049f},
-std::array<float,2>{0.469556451f, 0.124040619f},
-std::array<float,2>{0.38849467f, 0.627563894f},
-std::array<float,2>{0.87494266f, 0.455533624f},
-std::array<float,2>{0.579015851f, 0.982619941f},
-std::array<float,2>{0.0686424375f, 0.168584913f},
-std::array<float,2>{0.212750807f, 0.761980355f},
-std::array<float,2>{0.678596735f, 0.0624813884f},
-std::array<float,2>{0.899037063f, 0.553739429f},
-std::array<float,2>{0.297734022f, 0.356718957f},
-std::array<float,2>{0.439101994f, 0.827080369f},
-std::array<float,2>{0.802505314f, 0.0829729959f},
-std::array<float,2>{0.506385326f, 0.617149889f},
-std::array<float,2>{0.00685993629f, 0.306273341f},
-std::array<float,2>{0.185857862f, 0.715802431f},
-std::array<float,2>{0.72232455f, 0.383830875f},
-std::array<float,2>{0.947724402f, 0.909025431f},
-std::array<float,2>{0.322218418f, 0.232099697f},
-std::array<float,2>{0.262918264f, 0.50200361f},
-std::array<float,2>{0.930958748f, 0.31837669f},
-std::array<float,2>{0.641359687f, 0.80832088f},
-std::array<float,2>{0.245811492f, 0.0252874158f},
-std::array<float,2>{0.116032898f, 0.95607245f},
-std::array<float,2>{0.609925687f, 0.141304269f},
-std::array<float,2>{0.813048363f, 0.663442016f},
-std::array<float,2>{0.417446345f, 0.497384399f},
-std::array<float,2>{0.284143567f, 0.796838105f},
-std::array<float,2>{0.883378983f, 0.0143841766f},
-std::array<float,2>{0.661291242f, 0.524744272f},
-std::array<float,2>{0.189960286f, 0.342747748f},
-std::array<float,2>{0.0921954736f, 0.676473975f},
-std::array<float,2>{0.572993398f, 0.476056308f},
-std::array<float,2>{0.854798317f, 0.952828825f},
-std::array<float,2>{0.391400039f, 0.137224957f},
-std::array<float,2>{0.485089034f, 0.594626844f},
-std::array<float,2>{0.769962192f, 0.283623636f},
-std::array<float,2>{0.558706343f, 0.83727169f},
-std::array<float,2>{0.0587616675f, 0.0751770586f},
-std::array<float,2>{0.14722985f, 0.928076029f},
-std::array<float,2>{0.695070446f, 0.23681806f},
-std::array<float,2>{0.975464106f, 0.695296466f},
-std::array<float,2>{0.344997853f, 0.403037876f},
-std::array<float,2>{0.428993285f, 0.984952867f},
-std::array<float,2>{0.836503744f, 0.178194061f},
-std::array<float,2>{0.604053497f, 0.651731431f},
-std::array<float,2>{0.0945721567f, 0.439642817f},
-std::array<float,2>{0.233149767f, 0.532781124f},
-std::array<float,2>{0.632283032f, 0.362247437f},
-std::array<float,2>{0.916639149f, 0.774807751f},
-std::array<float,2>{0.268357784f, 0.031662792f},
-std::array<float,2>{0.333462805f, 0.736748278f},
-std::array<float,2>{0.964699566f, 0.432519823f},
-std::array<float,2>{0.735490799f, 0.891175091f},
-std::array<float,2>{0.159151122f, 0.202110603f},
-std::array<float,2>{0.0291816816f, 0.85349977f},
-std::array<float,2>{0.526536107f, 0.0960728675f},
-std::array<float,2>{0.792660713f, 0.563295662f},
-std::array<float,2>{0.46465084f, 0.272940904f},
-std::array<float,2>{0.355528265f, 0.960346043f},
-std::array<float,2>{0.979193866f, 0.144572765f},
-std::array<float,2>{0.700002372f, 0.657910228f},
-std::array<float,2>{0.14906013f, 0.493154287f},
-std::array<float,2>{0.0544059277f, 0.506979525f},
-std::array<float,2>{0.548861206f, 0.31502223f},
-std::array<float,2>{0.774803638f, 0.810602367f},
-std::array<float,2>{0.499866575f, 0.0309590567f},
-std::array<float,2>{0.402215362f, 0.713255465f},
-std::array<float,2>{0.844652414f, 0.388926625f},
-std::array<float,2>{0.566568911f, 0.911132574f},
-std::array<float,2>{0.0833666176f, 0.229924813f},
-std::array<float,2>{0.201867104f, 0.821167529f},
-std::array<float,2>{0.670930862f, 0.081970714f},
-std::array<float,2>{0.876121938f, 0.60995096f},
-std::array<float,2>{0.293046862f, 0.310479999f},
-std::array<float,2>{0.460619718f, 0.761143923f},
-std::array<float,2>{0.783640563f, 0.0556500815f},
-std::array<float,2>{0.516594529f, 0.548549891f},
-std::array<float,2>{0.0226118676f, 0.351711333f},
-std::array<float,2>{0.167822778f, 0.631531477f},
-std::array<float,2>{0.749478996f, 0.460368752f},
-std::array<float,2>{0.959815562f, 0.976984799f},
-std::array<float,2>{0.343212306f, 0.167014688f},
-std::array<float,2>{0.281066447f, 0.593414307f},
-std::array<float,2>{0.912465215f, 0.251425743f},
-std::array<float,2>{0.639948547f, 0.86623311f},
-std::array<float,2>{0.221632853f, 0.118092492f},
-std::array<float,2>{0.109002307f, 0.876797199f},
-std::array<float,2>{0.597498894f, 0.216101751f},
-std::array<float,2>{0.831334591f, 0.730755448f},
-std::array<float,2>{0.43664211f, 0.408434331f},
-std::array<float,2>{0.3067635f, 0.858567655f},
-std::array<float,2>{0.89574188f, 0.100413568f},
-std::array<float,2>{0.68270123f, 0.568740487f},
-std::array<float,2>{0.204043999f, 0.265637934f},
-std::array<float,2>{0.0743829757f, 0.740978479f},
-std::array<float,2>{0.586040914f, 0.435895681f},
-std::array<float,2>{0.865956903f, 0.895770252f},
-std::array<float,2>{0.382208407f, 0.198351189f},
-std::array<float,2>{0.482563913f, 0.537322581f},
-std::array<float,2>{0.759111762f, 0.366960675f},
-std::array<float,2>{0.54076004f, 0.780966878f},
-std::array<float,2>{0.0379506536f, 0.0353872627f},
-std::array<float,2>{0.132611647f, 0.988465071f},
-std::array<float,2>{0.704505444f, 0.173974007f},
-std::array<float,2>{0.999467432f, 0.653155625f},
-std::array<float,2>{0.360758305f, 0.442851633f},
-std::array<float,2>{0.40946734f, 0.924300134f},
-std::array<float,2>{0.826861084f, 0.238690704f},
-std::array<float,2>{0.623971403f, 0.688794255f},
-std::array<float,2>{0.121619627f, 0.400760978f},
-std::array<float,2>{0.240219221f, 0.599807143f},
-std::array<float,2>{0.649500072f, 0.286149293f},
-std::array<float,2>{0.924508274f, 0.841320574f},
-std::array<float,2>{0.255109608f, 0.0720617473f},
-std::array<float,2>{0.31534645f, 0.673380315f},
-std::array<float,2>{0.941451669f, 0.471061707f},
-std::array<float,2>{0.732264161f, 0.949038267f},
-std::array<float,2>{0.175475016f, 0.133280069f},
-std::array<float,2>{0.0108141201f, 0.79085815f},
-std::array<float,2>{0.511307418f, 0.010783365f},
-std::array<float,2>{0.81072861f, 0.530857682f},
-std::array<float,2>{0.451155841f, 0.336752236f},
-std::array<float,2>{0.260117292f, 0.901004851f},
-std::array<float,2>{0.936021447f, 0.190433308f},
-std::array<float,2>{0.645841181f, 0.749456763f},
-std::array<float,2>{0.24729f, 0.425909638f},
-std::array<float,2>{0.112314776f, 0.573323309f},
-std::array<float,2>{0.614244103f, 0.278479666f},
-std::array<float,2>{0.818909228f, 0.84799242f},
-std::array<float,2>{0.418605596f, 0.108648613f},
-std::array<float,2>{0.441771388f, 0.647138059f},
-std::array<float,2>{0.799933612f, 0.450289696f},
-std::array<float,2>{0.500598609f, 0.992588878f},
-std::array<float,2>{0.000374952302f, 0.184203357f},
-std::array<float,2>{0.182451501f, 0.766667128f},
-std::array<float,2>{0.724417746f, 0.0413682871f},
-std::array<float,2>{0.953099251f, 0.546805859f},
-std::array<float,2>{0.326516062f, 0.373281181f},
-std::array<float,2>{0.386518568f, 0.830343008f},
-std::array<float,2>{0.869727612f, 0.0643158779f},
-std::array<float,2>{0.582909763f, 0.601630509f},
-std::array<float,2>{0.063534461f, 0.291424185f},
-std::array<float,2>{0.217804506f, 0.702859759f},
-std::array<float,2>{0.674963713f, 0.396351367f},
-std::array<float,2>{0.905139863f, 0.930374384f},
-std::array<float,2>{0.301810622f, 0.247781277f},
-std::array<float,2>{0.369646043f, 0.51726675f},
-std::array<float,2>{0.989104748f, 0.334085584f},
-std::array<float,2>{0.717908919f, 0.785303771f},
-std::array<float,2>{0.133673981f, 0.00332108047f},
-std::array<float,2>{0.0450386219f, 0.943523824f},
-std::array<float,2>{0.534122467f, 0.131427959f},
-std::array<float,2>{0.755656123f, 0.684024274f},
-std::array<float,2>{0.472850859f, 0.47934714f},
-std::array<float,2>{0.329855293f, 0.804480612f},
-std::array<float,2>{0.967049181f, 0.021776434f},
-std::array<float,2>{0.740409136f, 0.512790084f},
-std::array<float,2>{0.161404639f, 0.322600365f},
-std::array<float,2>{0.0244514886f, 0.665930331f},
-std::array<float,2>{0.529416919f, 0.485711843f},
-std::array<float,2>{0.7938447f, 0.963147402f},
-std::array<float,2>{0.46583724f, 0.153167024f},
-std::array<float,2>{0.422260076f, 0.622722924f},
-std::array<float,2>{0.841299474f, 0.302330822f},
-std::array<float,2>{0.609324396f, 0.819405019f},
-std::array<float,2>{0.0986587554f, 0.0911900103f},
-std::array<float,2>{0.227826819f, 0.918361306f},
-std::array<float,2>{0.627475083f, 0.220799312f},
-std::array<float,2>{0.917990148f, 0.703725874f},
-std::array<float,2>{0.271324933f, 0.382616073f},
-std::array<float,2>{0.488681972f, 0.972462952f},
-std::array<float,2>{0.766608715f, 0.162014022f},
-std::array<float,2>{0.555859149f, 0.633588731f},
-std::array<float,2>{0.0573166534f, 0.464774013f},
-std::array<float,2>{0.141167536f, 0.559478641f},
-std::array<float,2>{0.691204846f, 0.344451874f},
-std::array<float,2>{0.969329f, 0.756678045f},
-std::array<float,2>{0.350260139f, 0.0516355783f},
-std::array<float,2>{0.287725389f, 0.720847428f},
-std::array<float,2>{0.888503671f, 0.418706715f},
-std::array<float,2>{0.656493723f, 0.88525027f},
-std::array<float,2>{0.194032207f, 0.208929047f},
-std::array<float,2>{0.0884424374f, 0.867528021f},
-std::array<float,2>{0.575898111f, 0.116343006f},
-std::array<float,2>{0.857992291f, 0.57943821f},
-std::array<float,2>{0.396024287f, 0.259821743f},
-std::array<float,2>{0.289656848f, 0.999265134f},
-std::array<float,2>{0.880322993f, 0.181843415f},
-std::array<float,2>{0.66717726f, 0.641325355f},
-std::array<float,2>{0.1969762f, 0.448355615f},
-std::array<float,2>{0.0818989128f, 0.542451799f},
-std::array<float,2>{0.56340158f, 0.367355019f},
-std::array<float,2>{0.850315392f, 0.772660911f},
-std::array<float,2>{0.40623647f, 0.0463902503f},
-std::array<float,2>{0.493973136f, 0.743120313f},
-std::array<float,2>{0.780068994f, 0.422345549f},
-std::array<float,2>{0.551890373f, 0.902690828f},
-std::array<float,2>{0.0480036438f, 0.194345891f},
-std::array<float,2>{0.155728355f, 0.844663143f},
-std::array<float,2>{0.698223829f, 0.103537068f},
-std::array<float,2>{0.982589304f, 0.574259937f},
-std::array<float,2>{0.351945609f, 0.275906414f},
-std::array<float,2>{0.430727214f, 0.784791529f},
-std::array<float,2>{0.834943652f, 0.00537304487f},
-std::array<float,2>{0.598506927f, 0.520027578f},
-std::array<float,2>{0.102207176f, 0.331166625f},
-std::array<float,2>{0.22558324f, 0.683162451f},
-std::array<float,2>{0.63470161f, 0.480916351f},
-std::array<float,2>{0.907353699f, 0.939606786f},
-std::array<float,2>{0.273947895f, 0.12689732f},
-std::array<float,2>{0.339322597f, 0.607608974f},
-std::array<float,2>{0.955161333f, 0.293965459f},
-std::array<float,2>{0.745016813f, 0.833670616f},
-std::array<float,2>{0.170567885f, 0.0683626682f},
-std::array<float,2>{0.0193645675f, 0.935479045f},
-std::array<float,2>{0.520864248f, 0.245757565f},
-std::array<float,2>{0.786525965f, 0.696293712f},
-std::array<float,2>{0.453881741f, 0.394075513f},
-std::array<float,2>{0.365424812f, 0.81436342f},
-std::array<float,2>{0.992668211f, 0.0894469395f},
-std::array<float,2>{0.710136235f, 0.61955905f},
-std::array<float,2>{0.126080498f, 0.300642222f},
-std::array<float,2>{0.0328860618f, 0.710725963f},
-std::array<float,2>{0.546403766f, 0.375144333f},
-std::array<float,2>{0.76531893f, 0.917541027f},
-std::array<float,2>{0.479359031f, 0.223848641f},
-std::array<float,2>{0.378086388f, 0.509038031f},
-std::array<float,2>{0.859967411f, 0.325175792f},
-std::array<float,2>{0.590949774f, 0.799236476f},
-std::array<float,2>{0.0724052861f, 0.0177479759f},
-std::array<float,2>{0.209850609f, 0.967611611f},
-std::array<float,2>{0.685743988f, 0.151796326f},
-std::array<float,2>{0.890737295f, 0.669932306f},
-std::array<float,2>{0.310741276f, 0.489230782f},
-std::array<float,2>{0.44559443f, 0.886739492f},
-std::array<float,2>{0.807114959f, 0.205313221f},
-std::array<float,2>{0.515031159f, 0.725214243f},
-std::array<float,2>{0.0138741052f, 0.414551526f},
-std::array<float,2>{0.176493555f, 0.585189223f},
-std::array<float,2>{0.729516447f, 0.261853397f},
-std::array<float,2>{0.938705564f, 0.873844743f},
-std::array<float,2>{0.316630542f, 0.11318364f},
-std::array<float,2>{0.252928525f, 0.639419377f},
-std::array<float,2>{0.929305255f, 0.465453029f},
-std::array<float,2>{0.655763447f, 0.972784638f},
-std::array<float,2>{0.238099113f, 0.158752635f},
-std::array<float,2>{0.121020913f, 0.75276202f},
-std::array<float,2>{0.620907366f, 0.0484058671f},
-std::array<float,2>{0.822194755f, 0.558443248f},
-std::array<float,2>{0.413658768f, 0.349834532f},
-std::array<float,2>{0.323578f, 0.90681833f},
-std::array<float,2>{0.946849465f, 0.234092027f},
-std::array<float,2>{0.720416069f, 0.717559576f},
-std::array<float,2>{0.184820995f, 0.385045528f},
-std::array<float,2>{0.00441038003f, 0.613730252f},
-std::array<float,2>{0.504771709f, 0.307033658f},
-std::array<float,2>{0.804587007f, 0.825591087f},
-std::array<float,2>{0.441305071f, 0.0859042183f},
-std::array<float,2>{0.414420068f, 0.660640478f},
-std::array<float,2>{0.815574348f, 0.499913037f},
-std::array<float,2>{0.612079918f, 0.954157829f},
-std::array<float,2>{0.113767542f, 0.14343141f},
-std::array<float,2>{0.242828771f, 0.806358218f},
-std::array<float,2>{0.643214226f, 0.0269130114f},
-std::array<float,2>{0.931932747f, 0.501875043f},
-std::array<float,2>{0.264828056f, 0.316557229f},
-std::array<float,2>{0.471483439f, 0.863206565f},
-std::array<float,2>{0.752061784f, 0.121927947f},
-std::array<float,2>{0.537442267f, 0.588136554f},
-std::array<float,2>{0.0424359515f, 0.256980956f},
-std::array<float,2>{0.139776409f, 0.728860497f},
-std::array<float,2>{0.712158978f, 0.412370622f},
-std::array<float,2>{0.985753f, 0.882435024f},
-std::array<float,2>{0.371095687f, 0.211458698f},
-std::array<float,2>{0.298910469f, 0.552375615f},
-std::array<float,2>{0.900933385f, 0.359065503f},
-std::array<float,2>{0.675882339f, 0.76378572f},
-std::array<float,2>{0.21339801f, 0.0598141737f},
-std::array<float,2>{0.0668249503f, 0.981286943f},
-std::array<float,2>{0.580319285f, 0.170275822f},
-std::array<float,2>{0.871325612f, 0.62579596f},
-std::array<float,2>{0.390525609f, 0.454219013f},
-std::array<float,2>{0.267307431f, 0.776550412f},
-std::array<float,2>{0.915299058f, 0.0338262878f},
-std::array<float,2>{0.629103541f, 0.534412503f},
-std::array<float,2>{0.230595902f, 0.361133516f},
-std::array<float,2>{0.0965950266f, 0.649766982f},
-std::array<float,2>{0.601745546f, 0.43768549f},
-std::array<float,2>{0.838695705f, 0.988135219f},
-std::array<float,2>{0.426607102f, 0.176867813f},
-std::array<float,2>{0.462188482f, 0.5654338f},
-std::array<float,2>{0.789177716f, 0.271425158f},
-std::array<float,2>{0.525074661f, 0.855460823f},
-std::array<float,2>{0.0310433749f, 0.0943557993f},
-std::array<float,2>{0.157921195f, 0.894195437f},
-std::array<float,2>{0.736594856f, 0.200286627f},
-std::array<float,2>{0.961190164f, 0.735101819f},
-std::array<float,2>{0.334732026f, 0.430714995f},
-std::array<float,2>{0.39304626f, 0.950375378f},
-std::array<float,2>{0.853378892f, 0.139433473f},
-std::array<float,2>{0.570343256f, 0.678460002f},
-std::array<float,2>{0.0915439352f, 0.474447489f},
-std::array<float,2>{0.188203394f, 0.526834249f},
-std::array<float,2>{0.663494706f, 0.3411825f},
-std::array<float,2>{0.885634601f, 0.79458499f},
-std::array<float,2>{0.282236338f, 0.0120013813f},
-std::array<float,2>{0.346009374f, 0.692011058f},
-std::array<float,2>{0.973585367f, 0.404643327f},
-std::array<float,2>{0.693181455f, 0.925978124f},
-std::array<float,2>{0.145102739f, 0.235011488f},
-std::array<float,2>{0.0607159622f, 0.838112116f},
-std::array<float,2>{0.562413692f, 0.0763163418f},
-std::array<float,2>{0.773032784f, 0.597337961f},
-std::array<float,2>{0.487806708f, 0.281387538f},
-std::array<float,2>{0.336777061f, 0.94137454f},
-std::array<float,2>{0.954482138f, 0.125580102f},
-std::array<float,2>{0.743857265f, 0.681776285f},
-std::array<float,2>{0.168090701f, 0.482318223f},
-std::array<float,2>{0.0156380981f, 0.520693004f},
-std::array<float,2>{0.522737682f, 0.330822587f},
-std::array<float,2>{0.787576795f, 0.783858657f},
-std::array<float,2>{0.45702225f, 0.00468889391f},
-std::array<float,2>{0.433050513f, 0.695591927f},
-std::array<float,2>{0.833326876f, 0.392965734f},
-std::array<float,2>{0.601092041f, 0.93438828f},
-std::array<float,2>{0.104060434f, 0.244987532f},
-std::array<float,2>{0.223693147f, 0.832758188f},
-std::array<float,2>{0.63507694f, 0.0697233379f},
-std::array<float,2>{0.91002214f, 0.608416915f},
-std::array<float,2>{0.277079344f, 0.293861181f},
-std::array<float,2>{0.49547863f, 0.772379279f},
-std::array<float,2>{0.778573811f, 0.0451064371f},
-std::array<float,2>{0.554386914f, 0.541693449f},
-std::array<float,2>{0.0498644374f, 0.36822027f},
-std::array<float,2>{0.153727785f, 0.642160773f},
-std::array<float,2>{0.695625722f, 0.448137969f},
-std::array<float,2>{0.980516315f, 0.998371303f},
-std::array<float,2>{0.354171723f, 0.183093756f},
-std::array<float,2>{0.291848451f, 0.575707316f},
-std::array<float,2>{0.881067336f, 0.277111202f},
-std::array<float,2>{0.664226353f, 0.845179558f},
-std::array<float,2>{0.198336348f, 0.105420642f},
-std::array<float,2>{0.0792670995f, 0.904029727f},
-std::array<float,2>{0.566319823f, 0.193951532f},
-std::array<float,2>{0.849054396f, 0.74364078f},
-std::array<float,2>{0.402916789f, 0.423314661f},
-std::array<float,2>{0.250075817f, 0.874213636f},
-std::array<float,2>{0.926859081f, 0.111335382f},
-std::array<float,2>{0.653733373f, 0.58441925f},
-std::array<float,2>{0.235314623f, 0.263139397f},
-std::array<float,2>{0.11913953f, 0.726039112f},
-std::array<float,2>{0.618745744f, 0.415389299f},
-std::array<float,2>{0.822611392f, 0.888142765f},
-std::array<float,2>{0.411447287f, 0.206610084f},
-std::array<float,2>{0.448093534f, 0.557358265f},
-std::array<float,2>{0.806112945f, 0.350777745f},
-std::array<float,2>{0.512256503f, 0.753546119f},
-std::array<float,2>{0.0121432403f, 0.0475569665f},
-std::array<float,2>{0.179380998f, 0.974308431f},
-std::array<float,2>{0.7282058f, 0.159880385f},
-std::array<float,2>{0.941169024f, 0.639974475f},
-std::array<float,2>{0.320253074f, 0.465852708f},
-std::array<float,2>{0.376306444f, 0.916260123f},
-std::array<float,2>{0.862919807f, 0.222730651f},
-std::array<float,2>{0.593498766f, 0.709471643f},
-std::array<float,2>{0.071952112f, 0.376585007f},
-std::array<float,2>{0.207280695f, 0.620543957f},
-std::array<float,2>{0.684654415f, 0.299631357f},
-std::array<float,2>{0.89411068f, 0.813378155f},
-std::array<float,2>{0.310024291f, 0.0880494937f},
-std::array<float,2>{0.363601804f, 0.671671152f},
-std::array<float,2>{0.995998204f, 0.490124464f},
-std::array<float,2>{0.708856642f, 0.968704879f},
-std::array<float,2>{0.127912968f, 0.15123798f},
-std::array<float,2>{0.0351492539f, 0.799806178f},
-std::array<float,2>{0.543318748f, 0.0188350342f},
-std::array<float,2>{0.763543844f, 0.508419156f},
-std::array<float,2>{0.47729516f, 0.325814098f},
-std::array<float,2>{0.297484517f, 0.881014645f},
-std::array<float,2>{0.899233997f, 0.21227099f},
-std::array<float,2>{0.678295553f, 0.729681373f},
-std::array<float,2>{0.212609887f, 0.413626075f},
-std::array<float,2>{0.0684321076f, 0.589118719f},
-std::array<float,2>{0.578699112f, 0.256712973f},
-std::array<float,2>{0.874516785f, 0.862023115f},
-std::array<float,2>{0.388312668f, 0.122205496f},
-std::array<float,2>{0.469417304f, 0.626444399f},
-std::array<float,2>{0.751294196f, 0.453617781f},
-std::array<float,2>{0.536458194f, 0.981850505f},
-std::array<float,2>{0.0402568579f, 0.171061009f},
-std::array<float,2>{0.137051374f, 0.765334368f},
-std::array<float,2>{0.71344924f, 0.0595399626f},
-std::array<float,2>{0.986417294f, 0.551194847f},
-std::array<float,2>{0.373723209f, 0.358333886f},
-std::array<float,2>{0.417028308f, 0.825174153f},
-std::array<float,2>{0.813239992f, 0.0841936246f},
-std::array<float,2>{0.610234678f, 0.614995658f},
-std::array<float,2>{0.115771726f, 0.308204234f},
-std::array<float,2>{0.24593769f, 0.717839241f},
-std::array<float,2>{0.641233027f, 0.38621372f},
-std::array<float,2>{0.930810392f, 0.90765059f},
-std::array<float,2>{0.263085693f, 0.233329833f},
-std::array<float,2>{0.321849316f, 0.500137687f},
-std::array<float,2>{0.947300136f, 0.318082958f},
-std::array<float,2>{0.722627223f, 0.805580854f},
-std::array<float,2>{0.185689047f, 0.0254155789f},
-std::array<float,2>{0.00725331716f, 0.953357458f},
-std::array<float,2>{0.506809533f, 0.144135058f},
-std::array<float,2>{0.802406847f, 0.661653221f},
-std::array<float,2>{0.439356595f, 0.498198688f},
-std::array<float,2>{0.344913602f, 0.793082952f},
-std::array<float,2>{0.975239813f, 0.0127406511f},
-std::array<float,2>{0.695001483f, 0.526019573f},
-std::array<float,2>{0.146977291f, 0.339925617f},
-std::array<float,2>{0.0590074174f, 0.679072261f},
-std::array<float,2>{0.558986604f, 0.473034829f},
-std::array<float,2>{0.769657731f, 0.949709415f},
-std::array<float,2>{0.48529771f, 0.140101388f},
-std::array<float,2>{0.39125669f, 0.596244812f},
-std::array<float,2>{0.854643881f, 0.283130497f},
-std::array<float,2>{0.573228478f, 0.839600742f},
-std::array<float,2>{0.0917993858f, 0.0780613422f},
-std::array<float,2>{0.190344259f, 0.926806808f},
-std::array<float,2>{0.661465228f, 0.236109376f},
-std::array<float,2>{0.883724034f, 0.693129241f},
-std::array<float,2>{0.283756793f, 0.405295014f},
-std::array<float,2>{0.464376986f, 0.986584783f},
-std::array<float,2>{0.792910993f, 0.175965905f},
-std::array<float,2>{0.526789188f, 0.649041474f},
-std::array<float,2>{0.0289105121f, 0.438949674f},
-std::array<float,2>{0.158841357f, 0.533732831f},
-std::array<float,2>{0.735669374f, 0.360030115f},
-std::array<float,2>{0.964538991f, 0.776118636f},
-std::array<float,2>{0.33324042f, 0.0349493809f},
-std::array<float,2>{0.268105686f, 0.735858262f},
-std::array<float,2>{0.916766107f, 0.430597961f},
-std::array<float,2>{0.631954789f, 0.893330455f},
-std::array<float,2>{0.233191773f, 0.199586853f},
-std::array<float,2>{0.0943556428f, 0.854079604f},
-std::array<float,2>{0.604453683f, 0.0950959921f},
-std::array<float,2>{0.836871028f, 0.564960003f},
-std::array<float,2>{0.428872079f, 0.270246089f},
-std::array<float,2>{0.279070526f, 0.978355348f},
-std::array<float,2>{0.91075772f, 0.166928813f},
-std::array<float,2>{0.637968421f, 0.632236481f},
-std::array<float,2>{0.219507292f, 0.459145576f},
-std::array<float,2>{0.106419779f, 0.547429204f},
-std::array<float,2>{0.595641553f, 0.352562189f},
-std::array<float,2>{0.829979956f, 0.760722637f},
-std::array<float,2>{0.435308605f, 0.0563715585f},
-std::array<float,2>{0.457661748f, 0.731865048f},
-std::array<float,2>{0.782415867f, 0.410125315f},
-std::array<float,2>{0.518050432f, 0.875393867f},
-std::array<float,2>{0.021397993f, 0.215265363f},
-std::array<float,2>{0.165142119f, 0.865521193f},
-std::array<float,2>{0.746342242f, 0.118868038f},
-std::array<float,2>{0.958339572f, 0.592452288f},
-std::array<float,2>{0.34024474f, 0.250863492f},
-std::array<float,2>{0.400088876f, 0.812092781f},
-std::array<float,2>{0.847234249f, 0.0293216016f},
-std::array<float,2>{0.568652093f, 0.506823301f},
-std::array<float,2>{0.0850205943f, 0.315636903f},
-std::array<float,2>{0.200510144f, 0.656756341f},
-std::array<float,2>{0.668284357f, 0.493920296f},
-std::array<float,2>{0.878790081f, 0.959366679f},
-std::array<float,2>{0.295811355f, 0.145574495f},
-std::array<float,2>{0.358647287f, 0.610894144f},
-std::array<float,2>{0.976714313f, 0.309523523f},
-std::array<float,2>{0.701853871f, 0.821665227f},
-std::array<float,2>{0.151917875f, 0.0807742923f},
-std::array<float,2>{0.0508030728f, 0.91187191f},
-std::array<float,2>{0.547037423f, 0.22933884f},
-std::array<float,2>{0.77593559f, 0.714333951f},
-std::array<float,2>{0.497903287f, 0.390242785f},
-std::array<float,2>{0.312745541f, 0.840089142f},
-std::array<float,2>{0.943459332f, 0.0710905194f},
-std::array<float,2>{0.733311534f, 0.60118854f},
-std::array<float,2>{0.172368616f, 0.286017358f},
-std::array<float,2>{0.00803174824f, 0.687977254f},
-std::array<float,2>{0.508064389f, 0.402052402f},
-std::array<float,2>{0.810308397f, 0.925244868f},
-std::array<float,2>{0.452733666f, 0.239843667f},
-std::array<float,2>{0.406703413f, 0.529694259f},
-std::array<float,2>{0.826143861f, 0.337042421f},
-std::array<float,2>{0.621480346f, 0.789246619f},
-std::array<float,2>{0.1247788f, 0.0105485227f},
-std::array<float,2>{0.241862833f, 0.948179543f},
-std::array<float,2>{0.650696695f, 0.133891404f},
-std::array<float,2>{0.922487855f, 0.672101498f},
-std::array<float,2>{0.257404f, 0.472540766f},
-std::array<float,2>{0.480531573f, 0.895354331f},
-std::array<float,2>{0.761567116f, 0.198047042f},
-std::array<float,2>{0.542552412f, 0.741321146f},
-std::array<float,2>{0.035249304f, 0.437337577f},
-std::array<float,2>{0.129933581f, 0.569557488f},
-std::array<float,2>{0.705135822f, 0.266798109f},
-std::array<float,2>{0.997843742f, 0.858331561f},
-std::array<float,2>{0.361548662f, 0.101504453f},
-std::array<float,2>{0.306107491f, 0.654268324f},
-std::array<float,2>{0.898271799f, 0.441656649f},
-std::array<float,2>{0.680162549f, 0.989759862f},
-std::array<float,2>{0.206650317f, 0.175366282f},
-std::array<float,2>{0.0776940584f, 0.779414594f},
-std::array<float,2>{0.588952243f, 0.0370503739f},
-std::array<float,2>{0.86371392f, 0.538525641f},
-std::array<float,2>{0.380066216f, 0.365342617f},
-std::array<float,2>{0.368919134f, 0.93128711f},
-std::array<float,2>{0.99051559f, 0.246652335f},
-std::array<float,2>{0.716262281f, 0.701684415f},
-std::array<float,2>{0.13663201f, 0.394613147f},
-std::array<float,2>{0.0446341f, 0.602621436f},
-std::array<float,2>{0.531352818f, 0.291998744f},
-std::array<float,2>{0.757016778f, 0.831198335f},
-std::array<float,2>{0.475050658f, 0.063302584f},
-std::array<float,2>{0.38441059f, 0.684658468f},
-std::array<float,2>{0.867564917f, 0.479853481f},
-std::array<float,2>{0.585160553f, 0.944802165f},
-std::array<float,2>{0.0651931912f, 0.132745743f},
-std::array<float,2>{0.215056583f, 0.787038147f},
-std::array<float,2>{0.671915054f, 0.00233665062f},
-std::array<float,2>{0.904170275f, 0.515787184f},
-std::array<float,2>{0.3038131f, 0.334983855f},
-std::array<float,2>{0.444977731f, 0.848917842f},
-std::array<float,2>{0.797219276f, 0.108105548f},
-std::array<float,2>{0.50264442f, 0.572276115f},
-std::array<float,2>{0.003710035f, 0.277926981f},
-std::array<float,2>{0.180164769f, 0.748526931f},
-std::array<float,2>{0.726027906f, 0.427534878f},
-std::array<float,2>{0.94942975f, 0.901374817f},
-std::array<float,2>{0.325609863f, 0.189744934f},
-std::array<float,2>{0.257891238f, 0.545540273f},
-std::array<float,2>{0.93546629f, 0.374398023f},
-std::array<float,2>{0.647027433f, 0.766271472f},
-std::array<float,2>{0.248199269f, 0.0421781689f},
-std::array<float,2>{0.110550158f, 0.993311584f},
-std::array<float,2>{0.615249872f, 0.185526863f},
-std::array<float,2>{0.817081571f, 0.647709906f},
-std::array<float,2>{0.41995126f, 0.449307531f},
-std::array<float,2>{0.286687046f, 0.757264853f},
-std::array<float,2>{0.890341699f, 0.0525222123f},
-std::array<float,2>{0.659939587f, 0.559937358f},
-std::array<float,2>{0.191612989f, 0.344741285f},
-std::array<float,2>{0.0875290036f, 0.634632885f},
-std::array<float,2>{0.576865554f, 0.46358946f},
-std::array<float,2>{0.856858492f, 0.971262336f},
-std::array<float,2>{0.397780269f, 0.160933524f},
-std::array<float,2>{0.490779191f, 0.578206182f},
-std::array<float,2>{0.768972635f, 0.260920346f},
-std::array<float,2>{0.557745218f, 0.868865252f},
-std::array<float,2>{0.0552797057f, 0.115510091f},
-std::array<float,2>{0.142727062f, 0.886383414f},
-std::array<float,2>{0.688918173f, 0.207356706f},
-std::array<float,2>{0.971687436f, 0.722381771f},
-std::array<float,2>{0.349551022f, 0.419707179f},
-std::array<float,2>{0.424342334f, 0.964460433f},
-std::array<float,2>{0.842756927f, 0.153639182f},
-std::array<float,2>{0.607366741f, 0.664922714f},
-std::array<float,2>{0.100920185f, 0.484432667f},
-std::array<float,2>{0.228831157f, 0.511981845f},
-std::array<float,2>{0.62688601f, 0.324216306f},
-std::array<float,2>{0.920807123f, 0.803235352f},
-std::array<float,2>{0.271754861f, 0.0225223266f},
-std::array<float,2>{0.331235439f, 0.704954207f},
-std::array<float,2>{0.965548515f, 0.381360501f},
-std::array<float,2>{0.738699794f, 0.919557989f},
-std::array<float,2>{0.163045093f, 0.222582534f},
-std::array<float,2>{0.0261803921f, 0.818495095f},
-std::array<float,2>{0.528840065f, 0.0904333144f},
-std::array<float,2>{0.79534179f, 0.622005343f},
-std::array<float,2>{0.4674519f, 0.301549524f},
-std::array<float,2>{0.351706713f, 0.997823358f},
-std::array<float,2>{0.982691526f, 0.180650294f},
-std::array<float,2>{0.697896302f, 0.644447446f},
-std::array<float,2>{0.155312195f, 0.447156817f},
-std::array<float,2>{0.0482684933f, 0.540871739f},
-std::array<float,2>{0.552227914f, 0.371058017f},
-std::array<float,2>{0.779989898f, 0.769828081f},
-std::array<float,2>{0.493709356f, 0.0448121056f},
-std::array<float,2>{0.405947357f, 0.746091843f},
-std::array<float,2>{0.850557506f, 0.424691677f},
-std::array<float,2>{0.563167274f, 0.905330181f},
-std::array<float,2>{0.0815929547f, 0.192470789f},
-std::array<float,2>{0.197196409f, 0.84575665f},
-std::array<float,2>{0.66745168f, 0.102750458f},
-std::array<float,2>{0.880123496f, 0.57717526f},
-std::array<float,2>{0.289907306f, 0.274731994f},
-std::array<float,2>{0.45384866f, 0.781578422f},
-std::array<float,2>{0.78617847f, 0.00716603361f},
-std::array<float,2>{0.520531118f, 0.521653056f},
-std::array<float,2>{0.0191900972f, 0.330005616f},
-std::array<float,2>{0.170766398f, 0.679776669f},
-std::array<float,2>{0.744633853f, 0.48250249f},
-std::array<float,2>{0.955451846f, 0.939404368f},
-std::array<float,2>{0.33905673f, 0.127758518f},
-std::array<float,2>{0.274266571f, 0.606121182f},
-std::array<float,2>{0.907609344f, 0.296010941f},
-std::array<float,2>{0.634337962f, 0.834536254f},
-std::array<float,2>{0.225308284f, 0.067378141f},
-std::array<float,2>{0.102494232f, 0.937432408f},
-std::array<float,2>{0.598228037f, 0.243779242f},
-std::array<float,2>{0.834490359f, 0.697717965f},
-std::array<float,2>{0.430953443f, 0.391773582f},
-std::array<float,2>{0.310803741f, 0.81548816f},
-std::array<float,2>{0.891113102f, 0.0861002058f},
-std::array<float,2>{0.685992777f, 0.617870212f},
-std::array<float,2>{0.20958674f, 0.297196686f},
-std::array<float,2>{0.0726336092f, 0.708814859f},
-std::array<float,2>{0.591308475f, 0.377397776f},
-std::array<float,2>{0.860181868f, 0.916010559f},
-std::array<float,2>{0.378215909f, 0.225868449f},
-std::array<float,2>{0.479104489f, 0.510010481f},
-std::array<float,2>{0.765532732f, 0.327278376f},
-std::array<float,2>{0.546653032f, 0.797463059f},
-std::array<float,2>{0.0330167338f, 0.016423855f},
-std::array<float,2>{0.126333997f, 0.965175807f},
-std::array<float,2>{0.710448563f, 0.149754286f},
-std::array<float,2>{0.99227941f, 0.669135094f},
-std::array<float,2>{0.365537316f, 0.492120057f},
-std::array<float,2>{0.413842261f, 0.89038527f},
-std::array<float,2>{0.821931303f, 0.203571856f},
-std::array<float,2>{0.620729566f, 0.723349333f},
-std::array<float,2>{0.120811403f, 0.416476637f},
-std::array<float,2>{0.237854913f, 0.583800018f},
-std::array<float,2>{0.656080246f, 0.264860779f},
-std::array<float,2>{0.929594994f, 0.872460485f},
-std::array<float,2>{0.252634913f, 0.109616667f},
-std::array<float,2>{0.31685546f, 0.637580335f},
-std::array<float,2>{0.938830853f, 0.467278451f},
-std::array<float,2>{0.729844332f, 0.97504878f},
-std::array<float,2>{0.17667523f, 0.157462254f},
-std::array<float,2>{0.0139962509f, 0.75047946f},
-std::array<float,2>{0.514656484f, 0.0495815054f},
-std::array<float,2>{0.806685925f, 0.555752456f},
-std::array<float,2>{0.445421636f, 0.349033386f},
-std::array<float,2>{0.264967293f, 0.909306705f},
-std::array<float,2>{0.931647122f, 0.23081395f},
-std::array<float,2>{0.643551171f, 0.716092706f},
-std::array<float,2>{0.242942855f, 0.382902354f},
-std::array<float,2>{0.113380969f, 0.616172016f},
-std::array<float,2>{0.612041712f, 0.304932028f},
-std::array<float,2>{0.815860331f, 0.82794559f},
-std::array<float,2>{0.414285749f, 0.0836446658f},
-std::array<float,2>{0.441079229f, 0.662997246f},
-std::array<float,2>{0.804390371f, 0.496731073f},
-std::array<float,2>{0.504551411f, 0.955262542f},
-std::array<float,2>{0.00465973653f, 0.141953066f},
-std::array<float,2>{0.184586897f, 0.807227135f},
-std::array<float,2>{0.72059691f, 0.0238507334f},
-std::array<float,2>{0.94706136f, 0.503700376f},
-std::array<float,2>{0.323475122f, 0.319847107f},
-std::array<float,2>{0.390320152f, 0.860421658f},
-std::array<float,2>{0.871373773f, 0.123858817f},
-std::array<float,2>{0.580433667f, 0.586441159f},
-std::array<float,2>{0.0665526912f, 0.255530655f},
-std::array<float,2>{0.213653743f, 0.728208005f},
-std::array<float,2>{0.676234484f, 0.410853893f},
-std::array<float,2>{0.901289225f, 0.880837262f},
-std::array<float,2>{0.299167573f, 0.214013472f},
-std::array<float,2>{0.371518373f, 0.553249657f},
-std::array<float,2>{0.985397458f, 0.355900317f},
-std::array<float,2>{0.711981595f, 0.763546765f},
-std::array<float,2>{0.140054509f, 0.0612540841f},
-std::array<float,2>{0.04221173f, 0.984182537f},
-std::array<float,2>{0.537343025f, 0.169369683f},
-std::array<float,2>{0.752422512f, 0.628517568f},
-std::array<float,2>{0.471199244f, 0.456234336f},
-std::array<float,2>{0.334656417f, 0.773901105f},
-std::array<float,2>{0.961083829f, 0.0324740186f},
-std::array<float,2>{0.736371875f, 0.531444371f},
-std::array<float,2>{0.158133954f, 0.363195628f},
-std::array<float,2>{0.0308254939f, 0.650615931f},
-std::array<float,2>{0.525354207f, 0.440758914f},
-std::array<float,2>{0.789496422f, 0.9854967f},
-std::array<float,2>{0.462136954f, 0.17963104f},
-std::array<float,2>{0.426468074f, 0.56426692f},
-std::array<float,2>{0.838582993f, 0.272062004f},
-std::array<float,2>{0.602029562f, 0.852428675f},
-std::array<float,2>{0.0963453799f, 0.0966905728f},
-std::array<float,2>{0.230727747f, 0.892078161f},
-std::array<float,2>{0.629321516f, 0.202392772f},
-std::array<float,2>{0.915200174f, 0.738078892f},
-std::array<float,2>{0.26748085f, 0.43341279f},
-std::array<float,2>{0.488096654f, 0.951568842f},
-std::array<float,2>{0.77341783f, 0.138214454f},
-std::array<float,2>{0.56211406f, 0.6777156f},
-std::array<float,2>{0.0608006082f, 0.475306779f},
-std::array<float,2>{0.145477355f, 0.523711741f},
-std::array<float,2>{0.693049192f, 0.343636334f},
-std::array<float,2>{0.973357797f, 0.795021236f},
-std::array<float,2>{0.345932692f, 0.0147232153f},
-std::array<float,2>{0.282631099f, 0.693518698f},
-std::array<float,2>{0.885440409f, 0.404240429f},
-std::array<float,2>{0.663295329f, 0.928816617f},
-std::array<float,2>{0.188415363f, 0.237710819f},
-std::array<float,2>{0.0917714387f, 0.836242616f},
-std::array<float,2>{0.570718646f, 0.0756871328f},
-std::array<float,2>{0.853121698f, 0.595441997f},
-std::array<float,2>{0.392758191f, 0.284292847f},
-std::array<float,2>{0.293348342f, 0.957803071f},
-std::array<float,2>{0.8762604f, 0.146635041f},
-std::array<float,2>{0.671330869f, 0.660060942f},
-std::array<float,2>{0.202147827f, 0.494787604f},
-std::array<float,2>{0.0831636339f, 0.504721284f},
-std::array<float,2>{0.566724002f, 0.314352125f},
-std::array<float,2>{0.844431221f, 0.809677303f},
-std::array<float,2>{0.402091503f, 0.0285596251f},
-std::array<float,2>{0.499535054f, 0.712580204f},
-std::array<float,2>{0.774434626f, 0.387493253f},
-std::array<float,2>{0.54926604f, 0.913687766f},
-std::array<float,2>{0.0546517149f, 0.227083147f},
-std::array<float,2>{0.149413288f, 0.82242316f},
-std::array<float,2>{0.699780941f, 0.0792675614f},
-std::array<float,2>{0.979460597f, 0.612198114f},
-std::array<float,2>{0.355886757f, 0.311065704f},
-std::array<float,2>{0.436837882f, 0.759469926f},
-std::array<float,2>{0.831225157f, 0.0581058487f},
-std::array<float,2>{0.597169459f, 0.548944175f},
-std::array<float,2>{0.109196208f, 0.354321033f},
-std::array<float,2>{0.221194282f, 0.630706012f},
-std::array<float,2>{0.639858961f, 0.458129674f},
-std::array<float,2>{0.912116528f, 0.979400277f},
-std::array<float,2>{0.280898005f, 0.164711863f},
-std::array<float,2>{0.342809975f, 0.590228736f},
-std::array<float,2>{0.959571064f, 0.252437264f},
-std::array<float,2>{0.74920845f, 0.863337755f},
-std::array<float,2>{0.167714626f, 0.119893476f},
-std::array<float,2>{0.0227982365f, 0.878492057f},
-std::array<float,2>{0.516126513f, 0.217371196f},
-std::array<float,2>{0.78342098f, 0.73247391f},
-std::array<float,2>{0.460699409f, 0.406710058f},
-std::array<float,2>{0.360489666f, 0.856012285f},
-std::array<float,2>{0.99911648f, 0.0982222781f},
-std::array<float,2>{0.704213858f, 0.566444695f},
-std::array<float,2>{0.132525131f, 0.268713742f},
-std::array<float,2>{0.0376722328f, 0.739928961f},
-std::array<float,2>{0.540982783f, 0.43466264f},
-std::array<float,2>{0.758791566f, 0.897779047f},
-std::array<float,2>{0.482895792f, 0.197248146f},
-std::array<float,2>{0.381963074f, 0.536824048f},
-std::array<float,2>{0.866043091f, 0.36435461f},
-std::array<float,2>{0.586282909f, 0.778444231f},
-std::array<float,2>{0.0746230558f, 0.0379299335f},
-std::array<float,2>{0.203789458f, 0.990517735f},
-std::array<float,2>{0.683027327f, 0.17337279f},
-std::array<float,2>{0.895806193f, 0.655769646f},
-std::array<float,2>{0.307090223f, 0.445250332f},
-std::array<float,2>{0.450749129f, 0.923078179f},
-std::array<float,2>{0.811022162f, 0.241659924f},
-std::array<float,2>{0.511527956f, 0.690412164f},
-std::array<float,2>{0.0110860793f, 0.39908278f},
-std::array<float,2>{0.175652146f, 0.598451316f},
-std::array<float,2>{0.732140303f, 0.288763762f},
-std::array<float,2>{0.941851377f, 0.843700051f},
-std::array<float,2>{0.315168589f, 0.0728664026f},
-std::array<float,2>{0.255241305f, 0.675218821f},
-std::array<float,2>{0.9247877f, 0.469067901f},
-std::array<float,2>{0.649877667f, 0.946290791f},
-std::array<float,2>{0.239766881f, 0.135934442f},
-std::array<float,2>{0.121987678f, 0.791019142f},
-std::array<float,2>{0.623700321f, 0.00800967403f},
-std::array<float,2>{0.826974928f, 0.527688324f},
-std::array<float,2>{0.409249544f, 0.338802576f},
-std::array<float,2>{0.326274782f, 0.900209606f},
-std::array<float,2>{0.952700734f, 0.188424066f},
-std::array<float,2>{0.724296331f, 0.747977197f},
-std::array<float,2>{0.182315633f, 0.429004759f},
-std::array<float,2>{0.000193471336f, 0.571992517f},
-std::array<float,2>{0.500861168f, 0.279504389f},
-std::array<float,2>{0.800267875f, 0.8513695f},
-std::array<float,2>{0.441556513f, 0.106586814f},
-std::array<float,2>{0.418728977f, 0.645127475f},
-std::array<float,2>{0.819221675f, 0.452666074f},
-std::array<float,2>{0.613902628f, 0.994945765f},
-std::array<float,2>{0.11258661f, 0.186072364f},
-std::array<float,2>{0.247344777f, 0.768280089f},
-std::array<float,2>{0.645638883f, 0.0397864841f},
-std::array<float,2>{0.935670316f, 0.544299304f},
-std::array<float,2>{0.259898841f, 0.372744083f},
-std::array<float,2>{0.473100066f, 0.829703033f},
-std::array<float,2>{0.755541682f, 0.0658352375f},
-std::array<float,2>{0.533731759f, 0.603717387f},
-std::array<float,2>{0.0452736765f, 0.289084136f},
-std::array<float,2>{0.133304074f, 0.699863315f},
-std::array<float,2>{0.718244433f, 0.398097277f},
-std::array<float,2>{0.988788545f, 0.933096349f},
-std::array<float,2>{0.369971037f, 0.248459414f},
-std::array<float,2>{0.302080184f, 0.518843114f},
-std::array<float,2>{0.90497762f, 0.33306101f},
-std::array<float,2>{0.675224125f, 0.7878564f},
-std::array<float,2>{0.218217388f, 0.00185514463f},
-std::array<float,2>{0.0637746826f, 0.942391157f},
-std::array<float,2>{0.582655787f, 0.129959494f},
-std::array<float,2>{0.870094538f, 0.685752213f},
-std::array<float,2>{0.386316895f, 0.477957994f},
-std::array<float,2>{0.271025479f, 0.801058233f},
-std::array<float,2>{0.918257654f, 0.0196909346f},
-std::array<float,2>{0.627929032f, 0.514014125f},
-std::array<float,2>{0.227683082f, 0.321996212f},
-std::array<float,2>{0.0990837142f, 0.666273773f},
-std::array<float,2>{0.609092474f, 0.487370074f},
-std::array<float,2>{0.840958893f, 0.961632669f},
-std::array<float,2>{0.422030985f, 0.154672369f},
-std::array<float,2>{0.466195375f, 0.62316525f},
-std::array<float,2>{0.793476582f, 0.303013265f},
-std::array<float,2>{0.529701293f, 0.81743896f},
-std::array<float,2>{0.0248769298f, 0.0926640183f},
-std::array<float,2>{0.161281794f, 0.921705306f},
-std::array<float,2>{0.7405954f, 0.218920514f},
-std::array<float,2>{0.967027247f, 0.706320107f},
-std::array<float,2>{0.329812199f, 0.379735172f},
-std::array<float,2>{0.396372229f, 0.970212221f},
-std::array<float,2>{0.858273447f, 0.163147107f},
-std::array<float,2>{0.575988352f, 0.635626435f},
-std::array<float,2>{0.0887774676f, 0.462220013f},
-std::array<float,2>{0.194140449f, 0.560568571f},
-std::array<float,2>{0.656662822f, 0.34599781f},
-std::array<float,2>{0.888260305f, 0.754232645f},
-std::array<float,2>{0.287871093f, 0.0535227433f},
-std::array<float,2>{0.350482672f, 0.72004503f},
-std::array<float,2>{0.969657242f, 0.420114875f},
-std::array<float,2>{0.690948427f, 0.884741127f},
-std::array<float,2>{0.141535044f, 0.210155696f},
-std::array<float,2>{0.0574458167f, 0.870770752f},
-std::array<float,2>{0.556092739f, 0.114972085f},
-std::array<float,2>{0.766854405f, 0.58074379f},
-std::array<float,2>{0.488500953f, 0.259374619f},
-std::array<float,2>{0.318828732f, 0.976134598f},
-std::array<float,2>{0.939474344f, 0.157151923f},
-std::array<float,2>{0.726834357f, 0.637734234f},
-std::array<float,2>{0.178048417f, 0.468223125f},
-std::array<float,2>{0.0129130017f, 0.554994285f},
-std::array<float,2>{0.513060451f, 0.347927302f},
-std::array<float,2>{0.804991126f, 0.751939714f},
-std::array<float,2>{0.44832629f, 0.0504417345f},
-std::array<float,2>{0.410512865f, 0.723866403f},
-std::array<float,2>{0.82378751f, 0.417453706f},
-std::array<float,2>{0.617779851f, 0.88891679f},
-std::array<float,2>{0.117372438f, 0.205063865f},
-std::array<float,2>{0.235512555f, 0.871137142f},
-std::array<float,2>{0.653235793f, 0.110714369f},
-std::array<float,2>{0.926346064f, 0.582656622f},
-std::array<float,2>{0.251807809f, 0.264481574f},
-std::array<float,2>{0.477539092f, 0.798662305f},
-std::array<float,2>{0.762258649f, 0.0169908628f},
-std::array<float,2>{0.544062376f, 0.511466205f},
-std::array<float,2>{0.0341793709f, 0.326372236f},
-std::array<float,2>{0.128598347f, 0.668561876f},
-std::array<float,2>{0.707760513f, 0.490541846f},
-std::array<float,2>{0.994636178f, 0.966762722f},
-std::array<float,2>{0.364937693f, 0.149391696f},
-std::array<float,2>{0.308607757f, 0.618764341f},
-std::array<float,2>{0.892731726f, 0.29878518f},
-std::array<float,2>{0.684284925f, 0.814510643f},
-std::array<float,2>{0.208479002f, 0.087439023f},
-std::array<float,2>{0.0704574361f, 0.914506674f},
-std::array<float,2>{0.592501938f, 0.225206524f},
-std::array<float,2>{0.86182791f, 0.707342744f},
-std::array<float,2>{0.37519908f, 0.378653914f},
-std::array<float,2>{0.276266336f, 0.835038424f},
-std::array<float,2>{0.908322632f, 0.0683485195f},
-std::array<float,2>{0.636483669f, 0.606886804f},
-std::array<float,2>{0.222983748f, 0.295793325f},
-std::array<float,2>{0.105162621f, 0.698401392f},
-std::array<float,2>{0.599745691f, 0.391487569f},
-std::array<float,2>{0.83211422f, 0.935955226f},
-std::array<float,2>{0.431792796f, 0.24281393f},
-std::array<float,2>{0.455402762f, 0.522589087f},
-std::array<float,2>{0.788493156f, 0.328271627f},
-std::array<float,2>{0.521719635f, 0.783076286f},
-std::array<float,2>{0.0169183314f, 0.00642303145f},
-std::array<float,2>{0.16913189f, 0.937568665f},
-std::array<float,2>{0.743053675f, 0.128150687f},
-std::array<float,2>{0.95364964f, 0.68149358f},
-std::array<float,2>{0.337663144f, 0.483470857f},
-std::array<float,2>{0.403915077f, 0.904759824f},
-std::array<float,2>{0.848019421f, 0.192357615f},
-std::array<float,2>{0.564991713f, 0.744472563f},
-std::array<float,2>{0.0781800747f, 0.425195068f},
-std::array<float,2>{0.197516575f, 0.576665401f},
-std::array<float,2>{0.665411949f, 0.27428335f},
-std::array<float,2>{0.882795274f, 0.847089887f},
-std::array<float,2>{0.292053431f, 0.101793483f},
-std::array<float,2>{0.355193764f, 0.64335382f},
-std::array<float,2>{0.98210752f, 0.446045309f},
-std::array<float,2>{0.696688116f, 0.996119261f},
-std::array<float,2>{0.152682304f, 0.180693507f},
-std::array<float,2>{0.0489237197f, 0.770795465f},
-std::array<float,2>{0.553251743f, 0.0429940224f},
-std::array<float,2>{0.777665079f, 0.539555252f},
-std::array<float,2>{0.494418859f, 0.369150639f},
-std::array<float,2>{0.284661084f, 0.928534806f},
-std::array<float,2>{0.884436131f, 0.236391798f},
-std::array<float,2>{0.660437226f, 0.694395721f},
-std::array<float,2>{0.190955937f, 0.4025231f},
-std::array<float,2>{0.0933774933f, 0.593943238f},
-std::array<float,2>{0.573589683f, 0.284134358f},
-std::array<float,2>{0.8539536f, 0.837842941f},
-std::array<float,2>{0.392014384f, 0.0744615197f},
-std::array<float,2>{0.486325175f, 0.675788462f},
-std::array<float,2>{0.770575881f, 0.47650674f},
-std::array<float,2>{0.559975445f, 0.952533782f},
-std::array<float,2>{0.0604721755f, 0.136755139f},
-std::array<float,2>{0.148318604f, 0.795921087f},
-std::array<float,2>{0.693865776f, 0.0138457008f},
-std::array<float,2>{0.976268709f, 0.525296628f},
-std::array<float,2>{0.344391018f, 0.342042178f},
-std::array<float,2>{0.427820951f, 0.852987289f},
-std::array<float,2>{0.837568521f, 0.0962222442f},
-std::array<float,2>{0.605145454f, 0.562565923f},
-std::array<float,2>{0.0948733613f, 0.273034215f},
-std::array<float,2>{0.233495161f, 0.737212718f},
-std::array<float,2>{0.631729424f, 0.431892961f},
-std::array<float,2>{0.917648971f, 0.890641391f},
-std::array<float,2>{0.269272953f, 0.201620534f},
-std::array<float,2>{0.332355767f, 0.532278001f},
-std::array<float,2>{0.962904096f, 0.361532211f},
-std::array<float,2>{0.734450161f, 0.775248826f},
-std::array<float,2>{0.159805954f, 0.0318404473f},
-std::array<float,2>{0.0281341802f, 0.984379947f},
-std::array<float,2>{0.525973916f, 0.178605497f},
-std::array<float,2>{0.79142338f, 0.651898026f},
-std::array<float,2>{0.463126808f, 0.4400962f},
-std::array<float,2>{0.374345958f, 0.7622087f},
-std::array<float,2>{0.9873299f, 0.0617152527f},
-std::array<float,2>{0.714086354f, 0.554394662f},
-std::array<float,2>{0.138521865f, 0.357056201f},
-std::array<float,2>{0.0399543419f, 0.627399266f},
-std::array<float,2>{0.535687685f, 0.455859661f},
-std::array<float,2>{0.750384092f, 0.983308613f},
-std::array<float,2>{0.470658571f, 0.168329835f},
-std::array<float,2>{0.386916578f, 0.587574005f},
-std::array<float,2>{0.873327613f, 0.254200339f},
-std::array<float,2>{0.579254448f, 0.859918475f},
-std::array<float,2>{0.0701590255f, 0.124621607f},
-std::array<float,2>{0.211075082f, 0.879066944f},
-std::array<float,2>{0.6788643f, 0.213111743f},
-std::array<float,2>{0.89991045f, 0.726646006f},
-std::array<float,2>{0.298653334f, 0.412001878f},
-std::array<float,2>{0.437684536f, 0.956710994f},
-std::array<float,2>{0.801548064f, 0.140811279f},
-std::array<float,2>{0.507387042f, 0.663591743f},
-std::array<float,2>{0.00588905765f, 0.49781701f},
-std::array<float,2>{0.186576858f, 0.502528608f},
-std::array<float,2>{0.721181452f, 0.319261134f},
-std::array<float,2>{0.948296249f, 0.807834148f},
-std::array<float,2>{0.32072109f, 0.0244741682f},
-std::array<float,2>{0.262013823f, 0.715318501f},
-std::array<float,2>{0.929929614f, 0.384379566f},
-std::array<float,2>{0.64200449f, 0.908482492f},
-std::array<float,2>{0.244600862f, 0.231627271f},
-std::array<float,2>{0.116383672f, 0.826473176f},
-std::array<float,2>{0.610609472f, 0.0824278817f},
-std::array<float,2>{0.813717127f, 0.61643374f},
-std::array<float,2>{0.416927189f, 0.305820733f},
-std::array<float,2>{0.256228656f, 0.946145296f},
-std::array<float,2>{0.923198044f, 0.134781107f},
-std::array<float,2>{0.651703894f, 0.674147069f},
-std::array<float,2>{0.240899459f, 0.470005006f},
-std::array<float,2>{0.123647444f, 0.528891385f},
-std::array<float,2>{0.622163534f, 0.339495242f},
-std::array<float,2>{0.824562728f, 0.791994095f},
-std::array<float,2>{0.40772596f, 0.00915449858f},
-std::array<float,2>{0.451284468f, 0.691016078f},
-std::array<float,2>{0.809409797f, 0.400008768f},
-std::array<float,2>{0.508987963f, 0.922640145f},
-std::array<float,2>{0.00924126152f, 0.240583375f},
-std::array<float,2>{0.173500761f, 0.841888189f},
-std::array<float,2>{0.733513117f, 0.0735930726f},
-std::array<float,2>{0.94530195f, 0.599320233f},
-std::array<float,2>{0.314405918f, 0.287503958f},
-std::array<float,2>{0.379811466f, 0.778188884f},
-std::array<float,2>{0.865175724f, 0.039014142f},
-std::array<float,2>{0.588335752f, 0.535593867f},
-std::array<float,2>{0.0771427453f, 0.36411795f},
-std::array<float,2>{0.205336034f, 0.654784262f},
-std::array<float,2>{0.68108356f, 0.443945944f},
-std::array<float,2>{0.896704197f, 0.992037416f},
-std::array<float,2>{0.305505365f, 0.17283234f},
-std::array<float,2>{0.3631953f, 0.567469776f},
-std::array<float,2>{0.996548235f, 0.267914623f},
-std::array<float,2>{0.707009971f, 0.856709898f},
-std::array<float,2>{0.129530638f, 0.0988983586f},
-std::array<float,2>{0.0363008082f, 0.89706248f},
-std::array<float,2>{0.541318238f, 0.19537273f},
-std::array<float,2>{0.759991229f, 0.738353074f},
-std::array<float,2>{0.48216185f, 0.434298545f},
-std::array<float,2>{0.341288179f, 0.864549279f},
-std::array<float,2>{0.95723623f, 0.12020839f},
-std::array<float,2>{0.74713546f, 0.591687679f},
-std::array<float,2>{0.164229348f, 0.252934694f},
-std::array<float,2>{0.0204717778f, 0.733641446f},
-std::array<float,2>{0.519201159f, 0.407371759f},
-std::array<float,2>{0.782041609f, 0.877585292f},
-std::array<float,2>{0.458264649f, 0.218280047f},
-std::array<float,2>{0.433950454f, 0.550735176f},
-std::array<float,2>{0.828607023f, 0.355207026f},
-std::array<float,2>{0.594072878f, 0.757984459f},
-std::array<float,2>{0.106983423f, 0.0571335405f},
-std::array<float,2>{0.219922259f, 0.979850829f},
-std::array<float,2>{0.636971116f, 0.165205911f},
-std::array<float,2>{0.911630869f, 0.629036367f},
-std::array<float,2>{0.277718782f, 0.457149893f},
-std::array<float,2>{0.496704966f, 0.91303134f},
-std::array<float,2>{0.777260363f, 0.227579102f},
-std::array<float,2>{0.547896385f, 0.711268008f},
-std::array<float,2>{0.0527064279f, 0.388244063f},
-std::array<float,2>{0.150407538f, 0.613139451f},
-std::array<float,2>{0.702749372f, 0.311635673f},
-std::array<float,2>{0.977723479f, 0.82409209f},
-std::array<float,2>{0.357548267f, 0.0785977691f},
-std::array<float,2>{0.296186268f, 0.65877378f},
-std::array<float,2>{0.877302527f, 0.495864868f},
-std::array<float,2>{0.669683576f, 0.958184898f},
-std::array<float,2>{0.199504435f, 0.148082599f},
-std::array<float,2>{0.0846851096f, 0.8093009f},
-std::array<float,2>{0.570123672f, 0.0279999319f},
-std::array<float,2>{0.846297324f, 0.505510867f},
-std::array<float,2>{0.39916566f, 0.313092083f},
-std::array<float,2>{0.348175317f, 0.883334219f},
-std::array<float,2>{0.970932305f, 0.209176213f},
-std::array<float,2>{0.687616646f, 0.719085455f},
-std::array<float,2>{0.144247398f, 0.421174049f},
-std::array<float,2>{0.0560877621f, 0.581876457f},
-std::array<float,2>{0.557249069f, 0.258020878f},
-std::array<float,2>{0.767760038f, 0.869752347f},
-std::array<float,2>{0.491331369f, 0.113608673f},
-std::array<float,2>{0.396517873f, 0.63589406f},
-std::array<float,2>{0.856318533f, 0.461607426f},
-std::array<float,2>{0.57790637f, 0.969577432f},
-std::array<float,2>{0.0864096582f, 0.162886441f},
-std::array<float,2>{0.193224192f, 0.755142927f},
-std::array<float,2>{0.65855068f, 0.0544587672f},
-std::array<float,2>{0.888972402f, 0.562427104f},
-std::array<float,2>{0.285754383f, 0.346880019f},
-std::array<float,2>{0.467822582f, 0.817295015f},
-std::array<float,2>{0.796203852f, 0.0929729864f},
-std::array<float,2>{0.52750957f, 0.624198914f},
-std::array<float,2>{0.0266869701f, 0.303716272f},
-std::array<float,2>{0.163295493f, 0.7056427f},
-std::array<float,2>{0.73930043f, 0.380701572f},
-std::array<float,2>{0.966135621f, 0.92027998f},
-std::array<float,2>{0.33047536f, 0.220321104f},
-std::array<float,2>{0.273130298f, 0.514786541f},
-std::array<float,2>{0.921576023f, 0.320386529f},
-std::array<float,2>{0.625336766f, 0.802577078f},
-std::array<float,2>{0.229828477f, 0.0210814327f},
-std::array<float,2>{0.100462928f, 0.962622762f},
-std::array<float,2>{0.606066048f, 0.155551225f},
-std::array<float,2>{0.843113542f, 0.667788029f},
-std::array<float,2>{0.425412655f, 0.486600727f},
-std::array<float,2>{0.303441465f, 0.788951516f},
-std::array<float,2>{0.902420819f, 0.000532964244f},
-std::array<float,2>{0.672938287f, 0.518027723f},
-std::array<float,2>{0.216760054f, 0.332618773f},
-std::array<float,2>{0.0662515759f, 0.687208712f},
-std::array<float,2>{0.584025383f, 0.476996154f},
-std::array<float,2>{0.868676245f, 0.941661298f},
-std::array<float,2>{0.383131474f, 0.129386559f},
-std::array<float,2>{0.476118386f, 0.605154455f},
-std::array<float,2>{0.756211936f, 0.290181667f},
-std::array<float,2>{0.532313228f, 0.828614175f},
-std::array<float,2>{0.0437746905f, 0.0652273893f},
-std::array<float,2>{0.13562797f, 0.932504773f},
-std::array<float,2>{0.715593338f, 0.249999508f},
-std::array<float,2>{0.991753936f, 0.701124549f},
-std::array<float,2>{0.367234498f, 0.396929204f},
-std::array<float,2>{0.421396583f, 0.995460331f},
-std::array<float,2>{0.817927897f, 0.186681405f},
-std::array<float,2>{0.616384268f, 0.646028757f},
-std::array<float,2>{0.110153206f, 0.451886564f},
-std::array<float,2>{0.249921337f, 0.543247283f},
-std::array<float,2>{0.648361444f, 0.3712731f},
-std::array<float,2>{0.933797121f, 0.769134998f},
-std::array<float,2>{0.258800447f, 0.0407457314f},
-std::array<float,2>{0.324611187f, 0.746233463f},
-std::array<float,2>{0.950256884f, 0.428306758f},
-std::array<float,2>{0.724644721f, 0.898598671f},
-std::array<float,2>{0.181019515f, 0.189411819f},
-std::array<float,2>{0.00258946721f, 0.85052979f},
-std::array<float,2>{0.503813088f, 0.106333688f},
-std::array<float,2>{0.798488617f, 0.570628762f},
-std::array<float,2>{0.44365266f, 0.280878842f},
-std::array<float,2>{0.366453409f, 0.966973424f},
-std::array<float,2>{0.993833661f, 0.151899472f},
-std::array<float,2>{0.709739387f, 0.670816123f},
-std::array<float,2>{0.125674963f, 0.488435566f},
-std::array<float,2>{0.0314000137f, 0.50946331f},
-std::array<float,2>{0.545475006f, 0.324321091f},
-std::array<float,2>{0.763986409f, 0.799554527f},
-std::array<float,2>{0.480161726f, 0.0180975571f},
-std::array<float,2>{0.377519011f, 0.710284948f},
-std::array<float,2>{0.860867381f, 0.375905633f},
-std::array<float,2>{0.590025842f, 0.91735214f},
-std::array<float,2>{0.0733639449f, 0.224230647f},
-std::array<float,2>{0.210096285f, 0.813593328f},
-std::array<float,2>{0.687056839f, 0.088894859f},
-std::array<float,2>{0.892107069f, 0.619855583f},
-std::array<float,2>{0.312152088f, 0.300074995f},
-std::array<float,2>{0.446608365f, 0.752026081f},
-std::array<float,2>{0.808167279f, 0.0482406728f},
-std::array<float,2>{0.513677776f, 0.557964623f},
-std::array<float,2>{0.0151818311f, 0.350182444f},
-std::array<float,2>{0.177643642f, 0.638830006f},
-std::array<float,2>{0.729312658f, 0.465101898f},
-std::array<float,2>{0.938158453f, 0.973560572f},
-std::array<float,2>{0.317742646f, 0.158500493f},
-std::array<float,2>{0.253409714f, 0.585788906f},
-std::array<float,2>{0.927735686f, 0.262418568f},
-std::array<float,2>{0.654550552f, 0.873061419f},
-std::array<float,2>{0.236424953f, 0.112747304f},
-std::array<float,2>{0.1192315f, 0.887436152f},
-std::array<float,2>{0.619540691f, 0.20580177f},
-std::array<float,2>{0.820411265f, 0.72489959f},
-std::array<float,2>{0.412265182f, 0.414208472f},
-std::array<float,2>{0.290374845f, 0.843765914f},
-std::array<float,2>{0.879621029f, 0.104404606f},
-std::array<float,2>{0.66675514f, 0.574934721f},
-std::array<float,2>{0.19587566f, 0.275563866f},
-std::array<float,2>{0.0800895467f, 0.742611229f},
-std::array<float,2>{0.563545108f, 0.422769427f},
-std::array<float,2>{0.85135603f, 0.903030872f},
-std::array<float,2>{0.404975682f, 0.195265025f},
-std::array<float,2>{0.49286899f, 0.542576373f},
-std::array<float,2>{0.780300915f, 0.368129164f},
-std::array<float,2>{0.551238954f, 0.773104966f},
-std::array<float,2>{0.0477453321f, 0.0460787527f},
-std::array<float,2>{0.154593274f, 0.999862313f},
-std::array<float,2>{0.698924243f, 0.182287723f},
-std::array<float,2>{0.983575165f, 0.640912712f},
-std::array<float,2>{0.352640659f, 0.44911319f},
-std::array<float,2>{0.43009904f, 0.934593678f},
-std::array<float,2>{0.835256815f, 0.245418146f},
-std::array<float,2>{0.599140942f, 0.697246313f},
-std::array<float,2>{0.10345339f, 0.393832415f},
-std::array<float,2>{0.225917503f, 0.608222604f},
-std::array<float,2>{0.63362515f, 0.294656873f},
-std::array<float,2>{0.906853795f, 0.833488286f},
-std::array<float,2>{0.275232136f, 0.069042787f},
-std::array<float,2>{0.337941587f, 0.682911038f},
-std::array<float,2>{0.956632137f, 0.48099646f},
-std::array<float,2>{0.745745242f, 0.940277874f},
-std::array<float,2>{0.17170532f, 0.126309812f},
-std::array<float,2>{0.0183351096f, 0.784634769f},
-std::array<float,2>{0.520134807f, 0.00527711352f},
-std::array<float,2>{0.785185158f, 0.519888699f},
-std::array<float,2>{0.454802662f, 0.331873477f},
-std::array<float,2>{0.266506612f, 0.893752277f},
-std::array<float,2>{0.914874911f, 0.201113179f},
-std::array<float,2>{0.630728424f, 0.734448314f},
-std::array<float,2>{0.231897309f, 0.4315826f},
-std::array<float,2>{0.0972186103f, 0.566253066f},
-std::array<float,2>{0.602633834f, 0.270558566f},
-std::array<float,2>{0.839467406f, 0.854976773f},
-std::array<float,2>{0.427476734f, 0.0941878185f},
-std::array<float,2>{0.461371839f, 0.650120914f},
-std::array<float,2>{0.790906727f, 0.438258559f},
-std::array<float,2>{0.523716509f, 0.987398863f},
-std::array<float,2>{0.0302499365f, 0.177414417f},
-std::array<float,2>{0.156879693f, 0.777277529f},
-std::array<float,2>{0.737620652f, 0.033674527f},
-std::array<float,2>{0.962189734f, 0.535085857f},
-std::array<float,2>{0.335781038f, 0.360791028f},
-std::array<float,2>{0.394077361f, 0.83886379f},
-std::array<float,2>{0.852419913f, 0.0768472254f},
-std::array<float,2>{0.571587384f, 0.596737325f},
-std::array<float,2>{0.090057224f, 0.282178223f},
-std::array<float,2>{0.189219877f, 0.691823721f},
-std::array<float,2>{0.662847579f, 0.40488705f},
-std::array<float,2>{0.886195719f, 0.926312506f},
-std::array<float,2>{0.28211987f, 0.234567791f},
-std::array<float,2>{0.347260475f, 0.527273655f},
-std::array<float,2>{0.974426925f, 0.341774851f},
-std::array<float,2>{0.691897035f, 0.794000387f},
-std::array<float,2>{0.14611198f, 0.0122687006f},
-std::array<float,2>{0.0619755946f, 0.951130927f},
-std::array<float,2>{0.561031938f, 0.138860017f},
-std::array<float,2>{0.772372663f, 0.677901924f},
-std::array<float,2>{0.487161547f, 0.473760575f},
-std::array<float,2>{0.323193789f, 0.805834115f},
-std::array<float,2>{0.94597429f, 0.0263945647f},
-std::array<float,2>{0.719390273f, 0.501217425f},
-std::array<float,2>{0.184448659f, 0.317021787f},
-std::array<float,2>{0.00508440565f, 0.660974801f},
-std::array<float,2>{0.505226552f, 0.499085605f},
-std::array<float,2>{0.803623259f, 0.954920948f},
-std::array<float,2>{0.439893872f, 0.142853051f},
-std::array<float,2>{0.415253133f, 0.614141166f},
-std::array<float,2>{0.814514756f, 0.307582259f},
-std::array<float,2>{0.6126526f, 0.82596308f},
-std::array<float,2>{0.11489208f, 0.0852014124f},
-std::array<float,2>{0.243793473f, 0.906617165f},
-std::array<float,2>{0.643711746f, 0.23343195f},
-std::array<float,2>{0.933338761f, 0.716986239f},
-std::array<float,2>{0.264105201f, 0.38544926f},
-std::array<float,2>{0.472542048f, 0.980631471f},
-std::array<float,2>{0.753271699f, 0.170532137f},
-std::array<float,2>{0.538922787f, 0.625345588f},
-std::array<float,2>{0.0417306535f, 0.454622775f},
-std::array<float,2>{0.138775751f, 0.552042425f},
-std::array<float,2>{0.711519778f, 0.358698756f},
-std::array<float,2>{0.984734178f, 0.764594674f},
-std::array<float,2>{0.373020589f, 0.0603373237f},
-std::array<float,2>{0.299976647f, 0.729111612f},
-std::array<float,2>{0.902178407f, 0.413013816f},
-std::array<float,2>{0.677088559f, 0.881918192f},
-std::array<float,2>{0.214835361f, 0.210978076f},
-std::array<float,2>{0.0674191266f, 0.862782478f},
-std::array<float,2>{0.581837296f, 0.12110538f},
-std::array<float,2>{0.872736573f, 0.588777184f},
-std::array<float,2>{0.389252663f, 0.257382572f},
-std::array<float,2>{0.308232576f, 0.988785744f},
-std::array<float,2>{0.894999802f, 0.174525172f},
-std::array<float,2>{0.68205601f, 0.652829409f},
-std::array<float,2>{0.204868525f, 0.443345428f},
-std::array<float,2>{0.0758861899f, 0.537599921f},
-std::array<float,2>{0.5871315f, 0.366682172f},
-std::array<float,2>{0.867084324f, 0.780288875f},
-std::array<float,2>{0.381533623f, 0.0358116403f},
-std::array<float,2>{0.484067976f, 0.74029088f},
-std::array<float,2>{0.758513033f, 0.436122119f},
-std::array<float,2>{0.539630175f, 0.896248817f},
-std::array<float,2>{0.0384143181f, 0.19892925f},
-std::array<float,2>{0.13124086f, 0.859280705f},
-std::array<float,2>{0.703172028f, 0.0997737721f},
-std::array<float,2>{0.998581171f, 0.568966508f},
-std::array<float,2>{0.35941112f, 0.266310006f},
-std::array<float,2>{0.408414274f, 0.790219307f},
-std::array<float,2>{0.827689886f, 0.0113855489f},
-std::array<float,2>{0.624519289f, 0.53030616f},
-std::array<float,2>{0.122417614f, 0.336295962f},
-std::array<float,2>{0.239027351f, 0.673233092f},
-std::array<float,2>{0.649021804f, 0.471623719f},
-std::array<float,2>{0.925177634f, 0.94827497f},
-std::array<float,2>{0.254220933f, 0.133305565f},
-std::array<float,2>{0.316176265f, 0.600468755f},
-std::array<float,2>{0.942555189f, 0.287049621f},
-std::array<float,2>{0.730748355f, 0.840963125f},
-std::array<float,2>{0.173918888f, 0.0714167207f},
-std::array<float,2>{0.0107132932f, 0.924498022f},
-std::array<float,2>{0.510000587f, 0.239244834f},
-std::array<float,2>{0.811571717f, 0.6891011f},
-std::array<float,2>{0.449767739f, 0.401202857f},
-std::array<float,2>{0.356752843f, 0.820601046f},
-std::array<float,2>{0.980066538f, 0.0810838789f},
-std::array<float,2>{0.700393379f, 0.609555244f},
-std::array<float,2>{0.150278002f, 0.309984416f},
-std::array<float,2>{0.0536145493f, 0.713680148f},
-std::array<float,2>{0.550115705f, 0.389365047f},
-std::array<float,2>{0.7738024f, 0.910488605f},
-std::array<float,2>{0.498797715f, 0.230011582f},
-std::array<float,2>{0.401160687f, 0.507747769f},
-std::array<float,2>{0.845258892f, 0.314861327f},
-std::array<float,2>{0.567720413f, 0.811057091f},
-std::array<float,2>{0.0821094587f, 0.0306500979f},
-std::array<float,2>{0.202681363f, 0.960802615f},
-std::array<float,2>{0.670574844f, 0.14537105f},
-std::array<float,2>{0.875354767f, 0.657575548f},
-std::array<float,2>{0.294887275f, 0.492508173f},
-std::array<float,2>{0.45957461f, 0.876455843f},
-std::array<float,2>{0.785109639f, 0.216445431f},
-std::array<float,2>{0.51667881f, 0.731411934f},
-std::array<float,2>{0.0223418381f, 0.408711672f},
-std::array<float,2>{0.166717738f, 0.593260765f},
-std::array<float,2>{0.748214543f, 0.251679659f},
-std::array<float,2>{0.960811794f, 0.866802752f},
-std::array<float,2>{0.342501789f, 0.117192455f},
-std::array<float,2>{0.280268252f, 0.63096422f},
-std::array<float,2>{0.913357377f, 0.460901052f},
-std::array<float,2>{0.639278531f, 0.977293909f},
-std::array<float,2>{0.2218685f, 0.167862177f},
-std::array<float,2>{0.108147763f, 0.761569798f},
-std::array<float,2>{0.596265376f, 0.0547882877f},
-std::array<float,2>{0.830315471f, 0.547926247f},
-std::array<float,2>{0.43578285f, 0.352282524f},
-std::array<float,2>{0.328371793f, 0.9188658f},
-std::array<float,2>{0.968726516f, 0.221256718f},
-std::array<float,2>{0.74173671f, 0.703461409f},
-std::array<float,2>{0.160160303f, 0.381956339f},
-std::array<float,2>{0.02408861f, 0.622073591f},
-std::array<float,2>{0.530781448f, 0.302027881f},
-std::array<float,2>{0.794056594f, 0.81997925f},
-std::array<float,2>{0.465654999f, 0.0917213112f},
-std::array<float,2>{0.423486382f, 0.665398359f},
-std::array<float,2>{0.840266168f, 0.485891342f},
-std::array<float,2>{0.607901871f, 0.963840544f},
-std::array<float,2>{0.0981645584f, 0.152501702f},
-std::array<float,2>{0.227031738f, 0.803999066f},
-std::array<float,2>{0.628300071f, 0.0220107622f},
-std::array<float,2>{0.919094265f, 0.513301611f},
-std::array<float,2>{0.269570082f, 0.323057801f},
-std::array<float,2>{0.489677012f, 0.86779654f},
-std::array<float,2>{0.766463876f, 0.1170047f},
-std::array<float,2>{0.554705977f, 0.579766452f},
-std::array<float,2>{0.0582887642f, 0.260733515f},
-std::array<float,2>{0.141959518f, 0.721533597f},
-std::array<float,2>{0.69001174f, 0.418166041f},
-std::array<float,2>{0.969832838f, 0.885712504f},
-std::array<float,2>{0.35075292f, 0.208375558f},
-std::array<float,2>{0.288416058f, 0.558804512f},
-std::array<float,2>{0.887550831f, 0.343981206f},
-std::array<float,2>{0.65816319f, 0.755990624f},
-std::array<float,2>{0.194905832f, 0.0510482974f},
-std::array<float,2>{0.0897447914f, 0.971984804f},
-std::array<float,2>{0.575006187f, 0.161253378f},
-std::array<float,2>{0.859357595f, 0.633033097f},
-std::array<float,2>{0.39519304f, 0.464323878f},
-std::array<float,2>{0.261460185f, 0.767179549f},
-std::array<float,2>{0.936569154f, 0.041743353f},
-std::array<float,2>{0.644610345f, 0.546179116f},
-std::array<float,2>{0.246464401f, 0.3735511f},
-std::array<float,2>{0.112159654f, 0.646928012f},
-std::array<float,2>{0.614822745f, 0.451065987f},
-std::array<float,2>{0.820035994f, 0.992798448f},
-std::array<float,2>{0.419044226f, 0.183674634f},
-std::array<float,2>{0.442708313f, 0.573921204f},
-std::array<float,2>{0.79912591f, 0.279190779f},
-std::array<float,2>{0.501412809f, 0.848163664f},
-std::array<float,2>{0.00168444053f, 0.109331675f},
-std::array<float,2>{0.182821676f, 0.900545001f},
-std::array<float,2>{0.723070443f, 0.191314116f},
-std::array<float,2>{0.951342881f, 0.749519706f},
-std::array<float,2>{0.327179372f, 0.426424891f},
-std::array<float,2>{0.385369837f, 0.943905294f},
-std::array<float,2>{0.870320201f, 0.131011665f},
-std::array<float,2>{0.583976328f, 0.684318006f},
-std::array<float,2>{0.0625349879f, 0.478552163f},
-std::array<float,2>{0.217326567f, 0.517059207f},
-std::array<float,2>{0.673961937f, 0.334509313f},
-std::array<float,2>{0.905749202f, 0.785933971f},
-std::array<float,2>{0.301008999f, 0.00353491749f},
-std::array<float,2>{0.370736271f, 0.702263474f},
-std::array<float,2>{0.990000606f, 0.395972341f},
-std::array<float,2>{0.717769206f, 0.92972213f},
-std::array<float,2>{0.134660229f, 0.247490257f},
-std::array<float,2>{0.0461774431f, 0.830685139f},
-std::array<float,2>{0.534888208f, 0.0635914579f},
-std::array<float,2>{0.754836023f, 0.602440596f},
-std::array<float,2>{0.474514037f, 0.291938007f},
-std::array<float,2>{0.321264684f, 0.954545438f},
-std::array<float,2>{0.948775411f, 0.143228114f},
-std::array<float,2>{0.721415401f, 0.660292447f},
-std::array<float,2>{0.187279761f, 0.499700695f},
-std::array<float,2>{0.00653036498f, 0.501599967f},
-std::array<float,2>{0.50690335f, 0.316853881f},
-std::array<float,2>{0.800973177f, 0.806555212f},
-std::array<float,2>{0.43816486f, 0.0272554159f},
-std::array<float,2>{0.416267335f, 0.717511117f},
-std::array<float,2>{0.814291298f, 0.384789884f},
-std::array<float,2>{0.611041427f, 0.907083452f},
-std::array<float,2>{0.117104359f, 0.234366745f},
-std::array<float,2>{0.244793996f, 0.825421214f},
-std::array<float,2>{0.642280042f, 0.0855264887f},
-std::array<float,2>{0.930601895f, 0.613293588f},
-std::array<float,2>{0.262385666f, 0.306657046f},
-std::array<float,2>{0.470202386f, 0.764127433f},
-std::array<float,2>{0.750519693f, 0.0599680133f},
-std::array<float,2>{0.535574198f, 0.552622437f},
-std::array<float,2>{0.0390915051f, 0.359370679f},
-std::array<float,2>{0.13786158f, 0.625591874f},
-std::array<float,2>{0.714474678f, 0.454475284f},
-std::array<float,2>{0.98785603f, 0.980969965f},
-std::array<float,2>{0.374637574f, 0.170081124f},
-std::array<float,2>{0.297923148f, 0.587990284f},
-std::array<float,2>{0.899553418f, 0.257116973f},
-std::array<float,2>{0.679207742f, 0.862962723f},
-std::array<float,2>{0.2117825f, 0.121598765f},
-std::array<float,2>{0.0693689585f, 0.882734895f},
-std::array<float,2>{0.579639316f, 0.211798906f},
-std::array<float,2>{0.873878419f, 0.728671193f},
-std::array<float,2>{0.38755399f, 0.412117004f},
-std::array<float,2>{0.268567383f, 0.85514766f},
-std::array<float,2>{0.917397916f, 0.0945980996f},
-std::array<float,2>{0.630865395f, 0.565912902f},
-std::array<float,2>{0.234267443f, 0.271206647f},
-std::array<float,2>{0.095473066f, 0.735251904f},
-std::array<float,2>{0.604881465f, 0.430920124f},
-std::array<float,2>{0.837050498f, 0.894416749f},
-std::array<float,2>{0.428270072f, 0.200452879f},
-std::array<float,2>{0.463864535f, 0.534474492f},
-std::array<float,2>{0.791841984f, 0.360981435f},
-std::array<float,2>{0.525535405f, 0.776759088f},
-std::array<float,2>{0.0275231525f, 0.0340412334f},
-std::array<float,2>{0.159442589f, 0.987973213f},
-std::array<float,2>{0.73506391f, 0.177203536f},
-std::array<float,2>{0.963568628f, 0.649475157f},
-std::array<float,2>{0.332770377f, 0.437795341f},
-std::array<float,2>{0.392215163f, 0.926121414f},
-std::array<float,2>{0.854052961f, 0.23519057f},
-std::array<float,2>{0.573821127f, 0.692267478f},
-std::array<float,2>{0.0930355862f, 0.404478401f},
-std::array<float,2>{0.190499306f, 0.597499073f},
-std::array<float,2>{0.66073662f, 0.28171739f},
-std::array<float,2>{0.883955419f, 0.838213503f},
-std::array<float,2>{0.284811229f, 0.0766248927f},
-std::array<float,2>{0.344047666f, 0.678676009f},
-std::array<float,2>{0.975996196f, 0.474277526f},
-std::array<float,2>{0.693466067f, 0.950554848f},
-std::array<float,2>{0.147934511f, 0.139335677f},
-std::array<float,2>{0.0599326566f, 0.794744372f},
-std::array<float,2>{0.560275793f, 0.0118056424f},
-std::array<float,2>{0.771186233f, 0.526474297f},
-std::array<float,2>{0.48569715f, 0.34098655f},
-std::array<float,2>{0.292556792f, 0.902539194f},
-std::array<float,2>{0.881890655f, 0.194683075f},
-std::array<float,2>{0.665983737f, 0.742780983f},
-std::array<float,2>{0.198131591f, 0.422060043f},
-std::array<float,2>{0.0789586008f, 0.574666321f},
-std::array<float,2>{0.564465523f, 0.276272118f},
-std::array<float,2>{0.848614872f, 0.844429791f},
-std::array<float,2>{0.403351009f, 0.103851154f},
-std::array<float,2>{0.494691312f, 0.641576469f},
-std::array<float,2>{0.77789849f, 0.448568076f},
-std::array<float,2>{0.552811921f, 0.999484181f},
-std::array<float,2>{0.0496852063f, 0.182035312f},
-std::array<float,2>{0.153071865f, 0.772800744f},
-std::array<float,2>{0.696797848f, 0.0466462038f},
-std::array<float,2>{0.981645405f, 0.542233169f},
-std::array<float,2>{0.354906082f, 0.36751911f},
-std::array<float,2>{0.432130694f, 0.833930075f},
-std::array<float,2>{0.832567155f, 0.068756789f},
-std::array<float,2>{0.600435913f, 0.607809663f},
-std::array<float,2>{0.104715236f, 0.294316053f},
-std::array<float,2>{0.223195791f, 0.696551681f},
-std::array<float,2>{0.636030972f, 0.394522041f},
-std::array<float,2>{0.908955991f, 0.935245812f},
-std::array<float,2>{0.275681049f, 0.246088937f},
-std::array<float,2>{0.33723098f, 0.520371854f},
-std::array<float,2>{0.953588545f, 0.331535876f},
-std::array<float,2>{0.742193043f, 0.784966469f},
-std::array<float,2>{0.169891894f, 0.00561637292f},
-std::array<float,2>{0.0171867348f, 0.939736843f},
-std::array<float,2>{0.522075117f, 0.126685739f},
-std::array<float,2>{0.788878739f, 0.683352292f},
-std::array<float,2>{0.455681562f, 0.480669588f},
-std::array<float,2>{0.364622235f, 0.798914075f},
-std::array<float,2>{0.994454205f, 0.0180522818f},
-std::array<float,2>{0.707366705f, 0.508980691f},
-std::array<float,2>{0.127977729f, 0.3248263f},
-std::array<float,2>{0.0336628668f, 0.670316815f},
-std::array<float,2>{0.544496417f, 0.488928288f},
-std::array<float,2>{0.761867285f, 0.967495203f},
-std::array<float,2>{0.478150249f, 0.151498869f},
-std::array<float,2>{0.375668228f, 0.619243979f},
-std::array<float,2>{0.86152935f, 0.300323159f},
-std::array<float,2>{0.5920614f, 0.814118683f},
-std::array<float,2>{0.0710699037f, 0.0898158252f},
-std::array<float,2>{0.208747432f, 0.917758584f},
-std::array<float,2>{0.683600187f, 0.224054694f},
-std::array<float,2>{0.893349707f, 0.710595965f},
-std::array<float,2>{0.309439361f, 0.375285447f},
-std::array<float,2>{0.449122697f, 0.972919405f},
-std::array<float,2>{0.805263162f, 0.159072667f},
-std::array<float,2>{0.513649225f, 0.639161885f},
-std::array<float,2>{0.0136695579f, 0.465811521f},
-std::array<float,2>{0.178545207f, 0.558253586f},
-std::array<float,2>{0.727174997f, 0.350084662f},
-std::array<float,2>{0.940364599f, 0.752606571f},
-std::array<float,2>{0.319270164f, 0.0487606712f},
-std::array<float,2>{0.251134813f, 0.725562572f},
-std::array<float,2>{0.925922275f, 0.414964199f},
-std::array<float,2>{0.652740717f, 0.887191594f},
-std::array<float,2>{0.23631151f, 0.205524564f},
-std::array<float,2>{0.118043341f, 0.873613656f},
-std::array<float,2>{0.617344022f, 0.112867728f},
-std::array<float,2>{0.823595703f, 0.585259557f},
-std::array<float,2>{0.410781235f, 0.262029469f},
-std::array<float,2>{0.259360194f, 0.992336094f},
-std::array<float,2>{0.934205413f, 0.184482306f},
-std::array<float,2>{0.647670627f, 0.64725554f},
-std::array<float,2>{0.249149874f, 0.450538069f},
-std::array<float,2>{0.109457649f, 0.546438932f},
-std::array<float,2>{0.616762757f, 0.373508632f},
-std::array<float,2>{0.817515552f, 0.766885042f},
-std::array<float,2>{0.421169341f, 0.0412412845f},
-std::array<float,2>{0.444109023f, 0.749211133f},
-std::array<float,2>{0.798004508f, 0.426044762f},
-std::array<float,2>{0.503208458f, 0.901212215f},
-std::array<float,2>{0.00195561582f, 0.190769851f},
-std::array<float,2>{0.181577638f, 0.847849965f},
-std::array<float,2>{0.725461006f, 0.108537167f},
-std::array<float,2>{0.951108277f, 0.573641777f},
-std::array<float,2>{0.324745297f, 0.278732598f},
-std::array<float,2>{0.383755475f, 0.785537839f},
-std::array<float,2>{0.868226647f, 0.00308709359f},
-std::array<float,2>{0.584932566f, 0.51754427f},
-std::array<float,2>{0.0654479265f, 0.334266543f},
-std::array<float,2>{0.215851799f, 0.683599234f},
-std::array<float,2>{0.673777282f, 0.479167044f},
-std::array<float,2>{0.90318495f, 0.9437837f},
-std::array<float,2>{0.303001821f, 0.131640464f},
-std::array<float,2>{0.368095964f, 0.601990223f},
-std::array<float,2>{0.991413772f, 0.291220605f},
-std::array<float,2>{0.715047777f, 0.830267787f},
-std::array<float,2>{0.134854898f, 0.0640803725f},
-std::array<float,2>{0.0432232618f, 0.930565715f},
-std::array<float,2>{0.533129573f, 0.247978821f},
-std::array<float,2>{0.756794453f, 0.70300591f},
-std::array<float,2>{0.475649625f, 0.396101445f},
-std::array<float,2>{0.330839396f, 0.819622159f},
-std::array<float,2>{0.96668458f, 0.0909453183f},
-std::array<float,2>{0.740182459f, 0.623022258f},
-std::array<float,2>{0.16398713f, 0.302495092f},
-std::array<float,2>{0.0272422656f, 0.704089165f},
-std::array<float,2>{0.528234124f, 0.382530212f},
-std::array<float,2>{0.796423912f, 0.918140173f},
-std::array<float,2>{0.468507618f, 0.220964462f},
-std::array<float,2>{0.425192446f, 0.513001621f},
-std::array<float,2>{0.843602002f, 0.322301745f},
-std::array<float,2>{0.605807841f, 0.80428195f},
-std::array<float,2>{0.100077324f, 0.0216378644f},
-std::array<float,2>{0.230447784f, 0.96301496f},
-std::array<float,2>{0.625955462f, 0.153022736f},
-std::array<float,2>{0.921193123f, 0.665554285f},
-std::array<float,2>{0.272467017f, 0.485496849f},
-std::array<float,2>{0.491783887f, 0.884820163f},
-std::array<float,2>{0.768188179f, 0.208732963f},
-std::array<float,2>{0.556724429f, 0.721083879f},
-std::array<float,2>{0.0564800762f, 0.418660641f},
-std::array<float,2>{0.144033864f, 0.579242349f},
-std::array<float,2>{0.688058138f, 0.260104299f},
-std::array<float,2>{0.971601367f, 0.867341101f},
-std::array<float,2>{0.347893596f, 0.116576932f},
-std::array<float,2>{0.285373747f, 0.633445859f},
-std::array<float,2>{0.889414847f, 0.464574128f},
-std::array<float,2>{0.658848643f, 0.972351849f},
-std::array<float,2>{0.192437708f, 0.161822632f},
-std::array<float,2>{0.0865454897f, 0.756564975f},
-std::array<float,2>{0.577351868f, 0.0514592417f},
-std::array<float,2>{0.855687797f, 0.55919075f},
-std::array<float,2>{0.397167981f, 0.344692886f},
-std::array<float,2>{0.358102322f, 0.910842836f},
-std::array<float,2>{0.97842139f, 0.229602993f},
-std::array<float,2>{0.70260483f, 0.712901711f},
-std::array<float,2>{0.151196748f, 0.38873753f},
-std::array<float,2>{0.0519054867f, 0.610248685f},
-std::array<float,2>{0.548563421f, 0.310265213f},
-std::array<float,2>{0.776772618f, 0.820823669f},
-std::array<float,2>{0.496169239f, 0.0817187354f},
-std::array<float,2>{0.398777008f, 0.658083677f},
-std::array<float,2>{0.845826089f, 0.49288398f},
-std::array<float,2>{0.56977284f, 0.960183263f},
-std::array<float,2>{0.0843554288f, 0.144869417f},
-std::array<float,2>{0.199761674f, 0.810940504f},
-std::array<float,2>{0.669334173f, 0.0311358161f},
-std::array<float,2>{0.877921879f, 0.507190168f},
-std::array<float,2>{0.296712697f, 0.315340936f},
-std::array<float,2>{0.45891127f, 0.866525829f},
-std::array<float,2>{0.781416953f, 0.11781273f},
-std::array<float,2>{0.518710494f, 0.5936023f},
-std::array<float,2>{0.0197665319f, 0.251063526f},
-std::array<float,2>{0.164998278f, 0.730502009f},
-std::array<float,2>{0.747632504f, 0.408546209f},
-std::array<float,2>{0.957696259f, 0.876697004f},
-std::array<float,2>{0.341733366f, 0.215826318f},
-std::array<float,2>{0.278026462f, 0.548756242f},
-std::array<float,2>{0.911501527f, 0.352012932f},
-std::array<float,2>{0.637338817f, 0.760912001f},
-std::array<float,2>{0.220379248f, 0.055239778f},
-std::array<float,2>{0.106875412f, 0.976582408f},
-std::array<float,2>{0.594619036f, 0.16732426f},
-std::array<float,2>{0.828885734f, 0.631653726f},
-std::array<float,2>{0.434413046f, 0.460039467f},
-std::array<float,2>{0.304944903f, 0.781036139f},
-std::array<float,2>{0.897349f, 0.0356018543f},
-std::array<float,2>{0.681382716f, 0.537442684f},
-std::array<float,2>{0.205800503f, 0.366769373f},
-std::array<float,2>{0.0762547776f, 0.652975321f},
-std::array<float,2>{0.588486731f, 0.442468017f},
-std::array<float,2>{0.864666879f, 0.988721192f},
-std::array<float,2>{0.379238784f, 0.17412746f},
-std::array<float,2>{0.481885076f, 0.56848526f},
-std::array<float,2>{0.760549784f, 0.265953928f},
-std::array<float,2>{0.541524827f, 0.858804643f},
-std::array<float,2>{0.0366436802f, 0.100151233f},
-std::array<float,2>{0.129086331f, 0.895651817f},
-std::array<float,2>{0.706354618f, 0.198568434f},
-std::array<float,2>{0.996616006f, 0.740895748f},
-std::array<float,2>{0.362520337f, 0.435677826f},
-std::array<float,2>{0.407271892f, 0.948730648f},
-std::array<float,2>{0.824910223f, 0.132978112f},
-std::array<float,2>{0.622770309f, 0.673636556f},
-std::array<float,2>{0.123238742f, 0.470759034f},
-std::array<float,2>{0.240484476f, 0.531222224f},
-std::array<float,2>{0.651985049f, 0.336625874f},
-std::array<float,2>{0.923469365f, 0.790731609f},
-std::array<float,2>{0.25654459f, 0.011164193f},
-std::array<float,2>{0.313816696f, 0.688530624f},
-std::array<float,2>{0.944590867f, 0.40057829f},
-std::array<float,2>{0.734344661f, 0.923852563f},
-std::array<float,2>{0.173148453f, 0.238463655f},
-std::array<float,2>{0.00930811279f, 0.841736734f},
-std::array<float,2>{0.509639561f, 0.0718319789f},
-std::array<float,2>{0.808936357f, 0.599940002f},
-std::array<float,2>{0.451966077f, 0.286491811f},
-std::array<float,2>{0.372480094f, 0.982736945f},
-std::array<float,2>{0.984944344f, 0.168773025f},
-std::array<float,2>{0.711341798f, 0.627831578f},
-std::array<float,2>{0.139326736f, 0.455247968f},
-std::array<float,2>{0.041475147f, 0.554177046f},
-std::array<float,2>{0.538096726f, 0.35651961f},
-std::array<float,2>{0.753898978f, 0.761783361f},
-std::array<float,2>{0.471803844f, 0.0620847382f},
-std::array<float,2>{0.389155298f, 0.72717303f},
-std::array<float,2>{0.872414291f, 0.411531061f},
-std::array<float,2>{0.581059277f, 0.87954092f},
-std::array<float,2>{0.0680260509f, 0.213616803f},
-std::array<float,2>{0.213987008f, 0.859663725f},
-std::array<float,2>{0.677453279f, 0.124409124f},
-std::array<float,2>{0.901830196f, 0.587246776f},
-std::array<float,2>{0.300684065f, 0.254488677f},
-std::array<float,2>{0.440396875f, 0.808577299f},
-std::array<float,2>{0.802735329f, 0.024921678f},
-std::array<float,2>{0.505382061f, 0.502346933f},
-std::array<float,2>{0.0054318402f, 0.318617284f},
-std::array<float,2>{0.183905005f, 0.663087189f},
-std::array<float,2>{0.719030857f, 0.497240931f},
-std::array<float,2>{0.94542861f, 0.956528842f},
-std::array<float,2>{0.32264176f, 0.14147003f},
-std::array<float,2>{0.264457732f, 0.616854489f},
-std::array<float,2>{0.932849288f, 0.306414485f},
-std::array<float,2>{0.644414425f, 0.826895237f},
-std::array<float,2>{0.24351038f, 0.0825529099f},
-std::array<float,2>{0.114580274f, 0.908917546f},
-std::array<float,2>{0.613139331f, 0.232189462f},
-std::array<float,2>{0.815344989f, 0.71549356f},
-std::array<float,2>{0.416005671f, 0.384040177f},
-std::array<float,2>{0.281287223f, 0.836948514f},
-std::array<float,2>{0.886286438f, 0.0747200102f},
-std::array<float,2>{0.662266672f, 0.5944314f},
-std::array<float,2>{0.188543677f, 0.283210725f},
-std::array<float,2>{0.0907443762f, 0.694940865f},
-std::array<float,2>{0.571954727f, 0.403265953f},
-std::array<float,2>{0.851747274f, 0.927762091f},
-std::array<float,2>{0.393738329f, 0.237157419f},
-std::array<float,2>{0.486674339f, 0.524622321f},
-std::array<float,2>{0.771547556f, 0.342480808f},
-std::array<float,2>{0.561412334f, 0.796497643f},
-std::array<float,2>{0.062495634f, 0.0144173466f},
-std::array<float,2>{0.145916626f, 0.95299077f},
-std::array<float,2>{0.69164449f, 0.137559563f},
-std::array<float,2>{0.973634064f, 0.676601827f},
-std::array<float,2>{0.347156495f, 0.475747406f},
-std::array<float,2>{0.427144587f, 0.891504884f},
-std::array<float,2>{0.838997185f, 0.201752514f},
-std::array<float,2>{0.603027999f, 0.736345887f},
-std::array<float,2>{0.096732825f, 0.432242006f},
-std::array<float,2>{0.232069775f, 0.56317091f},
-std::array<float,2>{0.630133748f, 0.272607684f},
-std::array<float,2>{0.914094031f, 0.853140354f},
-std::array<float,2>{0.265884787f, 0.0959240422f},
-std::array<float,2>{0.335061103f, 0.651509523f},
-std::array<float,2>{0.962501228f, 0.43973881f},
-std::array<float,2>{0.737830579f, 0.985188603f},
-std::array<float,2>{0.15646781f, 0.177751377f},
-std::array<float,2>{0.029310789f, 0.774508059f},
-std::array<float,2>{0.524141371f, 0.0313694663f},
-std::array<float,2>{0.790124357f, 0.533045173f},
-std::array<float,2>{0.461787045f, 0.362021387f},
-std::array<float,2>{0.274876565f, 0.936316729f},
-std::array<float,2>{0.9064973f, 0.242664114f},
-std::array<float,2>{0.63316977f, 0.699176133f},
-std::array<float,2>{0.226268709f, 0.390877753f},
-std::array<float,2>{0.102629811f, 0.607214928f},
-std::array<float,2>{0.598723114f, 0.295309365f},
-std::array<float,2>{0.835555494f, 0.835782349f},
-std::array<float,2>{0.430495739f, 0.0676238313f},
-std::array<float,2>{0.454329014f, 0.68082583f},
-std::array<float,2>{0.785902858f, 0.483994782f},
-std::array<float,2>{0.519902945f, 0.938092172f},
-std::array<float,2>{0.0176887717f, 0.128721148f},
-std::array<float,2>{0.171256572f, 0.78271091f},
-std::array<float,2>{0.745256901f, 0.00614084909f},
-std::array<float,2>{0.956240714f, 0.523261666f},
-std::array<float,2>{0.338611126f, 0.329047322f},
-std::array<float,2>{0.404598892f, 0.847635686f},
-std::array<float,2>{0.850950301f, 0.102443337f},
-std::array<float,2>{0.564074218f, 0.576645374f},
-std::array<float,2>{0.0807754025f, 0.273474872f},
-std::array<float,2>{0.195440575f, 0.744755685f},
-std::array<float,2>{0.666214108f, 0.425721467f},
-std::array<float,2>{0.87893647f, 0.904801667f},
-std::array<float,2>{0.291010618f, 0.191882342f},
-std::array<float,2>{0.353204429f, 0.539413333f},
-std::array<float,2>{0.984242618f, 0.369708121f},
-std::array<float,2>{0.698499382f, 0.771351695f},
-std::array<float,2>{0.154857561f, 0.0438817218f},
-std::array<float,2>{0.0469654091f, 0.99678123f},
-std::array<float,2>{0.551708043f, 0.181301668f},
-std::array<float,2>{0.781079233f, 0.642586529f},
-std::array<float,2>{0.492578834f, 0.445666552f},
-std::array<float,2>{0.318233192f, 0.751208901f},
-std::array<float,2>{0.937599361f, 0.050007809f},
-std::array<float,2>{0.728586912f, 0.555229962f},
-std::array<float,2>{0.177165583f, 0.348245472f},
-std::array<float,2>{0.0147905638f, 0.638245225f},
-std::array<float,2>{0.514196455f, 0.468690008f},
-std::array<float,2>{0.807720661f, 0.975837648f},
-std::array<float,2>{0.447000176f, 0.156531721f},
-std::array<float,2>{0.413021445f, 0.582446337f},
-std::array<float,2>{0.820833087f, 0.264003277f},
-std::array<float,2>{0.619712651f, 0.871807516f},
-std::array<float,2>{0.119747929f, 0.11112497f},
-std::array<float,2>{0.237145975f, 0.88920182f},
-std::array<float,2>{0.654962778f, 0.204343483f},
-std::array<float,2>{0.928341508f, 0.724450707f},
-std::array<float,2>{0.253650397f, 0.417867899f},
-std::array<float,2>{0.479898512f, 0.965859532f},
-std::array<float,2>{0.764330268f, 0.148459285f},
-std::array<float,2>{0.545011282f, 0.668234468f},
-std::array<float,2>{0.0317990109f, 0.491009861f},
-std::array<float,2>{0.125167966f, 0.511107028f},
-std::array<float,2>{0.709173858f, 0.327129155f},
-std::array<float,2>{0.993337572f, 0.798323691f},
-std::array<float,2>{0.366748691f, 0.0172702428f},
-std::array<float,2>{0.311630905f, 0.707692862f},
-std::array<float,2>{0.891956687f, 0.378369153f},
-std::array<float,2>{0.686992168f, 0.914589584f},
-std::array<float,2>{0.210509107f, 0.22485891f},
-std::array<float,2>{0.0741185769f, 0.815198064f},
-std::array<float,2>{0.590700567f, 0.0871846974f},
-std::array<float,2>{0.860544741f, 0.618585944f},
-std::array<float,2>{0.37732932f, 0.298075199f},
-std::array<float,2>{0.301431775f, 0.942121029f},
-std::array<float,2>{0.906063855f, 0.129831851f},
-std::array<float,2>{0.674435258f, 0.686576962f},
-std::array<float,2>{0.217227638f, 0.477326483f},
-std::array<float,2>{0.0631780177f, 0.518321753f},
-std::array<float,2>{0.583131015f, 0.332039505f},
-std::array<float,2>{0.870610476f, 0.788498402f},
-std::array<float,2>{0.384967655f, 0.000378696335f},
-std::array<float,2>{0.47376436f, 0.700589776f},
-std::array<float,2>{0.754110754f, 0.397009224f},
-std::array<float,2>{0.534528792f, 0.931955814f},
-std::array<float,2>{0.0465259887f, 0.249329999f},
-std::array<float,2>{0.133958936f, 0.828534365f},
-std::array<float,2>{0.717226565f, 0.0648964792f},
-std::array<float,2>{0.989269912f, 0.604583204f},
-std::array<float,2>{0.370183289f, 0.290925145f},
-std::array<float,2>{0.41991961f, 0.768667161f},
-std::array<float,2>{0.819812357f, 0.0400437862f},
-std::array<float,2>{0.614287794f, 0.543549359f},
-std::array<float,2>{0.111558333f, 0.371868938f},
-std::array<float,2>{0.246909961f, 0.645653129f},
-std::array<float,2>{0.645320237f, 0.451186955f},
-std::array<float,2>{0.937202096f, 0.995680451f},
-std::array<float,2>{0.260963798f, 0.1871714f},
-std::array<float,2>{0.327841908f, 0.570853829f},
-std::array<float,2>{0.951750815f, 0.280735821f},
-std::array<float,2>{0.723362923f, 0.849953234f},
-std::array<float,2>{0.183279857f, 0.10580533f},
-std::array<float,2>{0.00130174449f, 0.899243593f},
-std::array<float,2>{0.501551986f, 0.188862041f},
-std::array<float,2>{0.799503982f, 0.746954262f},
-std::array<float,2>{0.443063349f, 0.428184241f},
-std::array<float,2>{0.351378173f, 0.869446635f},
-std::array<float,2>{0.970598698f, 0.114094846f},
-std::array<float,2>{0.689497828f, 0.58108592f},
-std::array<float,2>{0.142375365f, 0.258502275f},
-std::array<float,2>{0.0580938607f, 0.719251335f},
-std::array<float,2>{0.555558681f, 0.421724051f},
-std::array<float,2>{0.765971899f, 0.882984996f},
-std::array<float,2>{0.489857018f, 0.20976375f},
-std::array<float,2>{0.394892037f, 0.561782122f},
-std::array<float,2>{0.85852778f, 0.347380936f},
-std::array<float,2>{0.574616194f, 0.755848706f},
-std::array<float,2>{0.0889120996f, 0.0537565015f},
-std::array<float,2>{0.194659323f, 0.969168782f},
-std::array<float,2>{0.657439828f, 0.162536621f},
-std::array<float,2>{0.886753261f, 0.636269808f},
-std::array<float,2>{0.288783252f, 0.461386591f},
-std::array<float,2>{0.464948535f, 0.920750558f},
-std::array<float,2>{0.794559538f, 0.220012039f},
-std::array<float,2>{0.530393898f, 0.705428123f},
-std::array<float,2>{0.0237864144f, 0.379898459f},
-std::array<float,2>{0.161023766f, 0.624566853f},
-std::array<float,2>{0.741629004f, 0.304539561f},
-std::array<float,2>{0.968105614f, 0.816618562f},
-std::array<float,2>{0.328677088f, 0.0934464484f},
-std::array<float,2>{0.270153701f, 0.667041183f},
-std::array<float,2>{0.919711649f, 0.487300009f},
-std::array<float,2>{0.62860322f, 0.962267399f},
-std::array<float,2>{0.227368981f, 0.156175584f},
-std::array<float,2>{0.0979514048f, 0.802095294f},
-std::array<float,2>{0.608347416f, 0.0209114179f},
-std::array<float,2>{0.840673208f, 0.515578628f},
-std::array<float,2>{0.42303285f, 0.320916504f},
-std::array<float,2>{0.341922075f, 0.877143919f},
-std::array<float,2>{0.960437834f, 0.218082935f},
-std::array<float,2>{0.74882108f, 0.734362364f},
-std::array<float,2>{0.166230068f, 0.408079922f},
-std::array<float,2>{0.0217765756f, 0.591209769f},
-std::array<float,2>{0.517274916f, 0.253687114f},
-std::array<float,2>{0.784401834f, 0.865132987f},
-std::array<float,2>{0.459002167f, 0.120962836f},
-std::array<float,2>{0.43617934f, 0.629620433f},
-std::array<float,2>{0.830737829f, 0.457883358f},
-std::array<float,2>{0.595876396f, 0.980277002f},
-std::array<float,2>{0.10790354f, 0.165872902f},
-std::array<float,2>{0.222456023f, 0.758633852f},
-std::array<float,2>{0.63871032f, 0.0570441447f},
-std::array<float,2>{0.913646519f, 0.549871981f},
-std::array<float,2>{0.279323041f, 0.354911745f},
-std::array<float,2>{0.498524129f, 0.823561788f},
-std::array<float,2>{0.774409235f, 0.0790219679f},
-std::array<float,2>{0.550698936f, 0.612764835f},
-std::array<float,2>{0.0529999323f, 0.312201649f},
-std::array<float,2>{0.149487197f, 0.711500227f},
-std::array<float,2>{0.700948179f, 0.387884885f},
-std::array<float,2>{0.979941249f, 0.912271678f},
-std::array<float,2>{0.356979311f, 0.228245139f},
-std::array<float,2>{0.294174284f, 0.505022943f},
-std::array<float,2>{0.875721633f, 0.312624753f},
-std::array<float,2>{0.670296431f, 0.808701515f},
-std::array<float,2>{0.202565685f, 0.0277752262f},
-std::array<float,2>{0.0826094523f, 0.958661497f},
-std::array<float,2>{0.568003118f, 0.147602841f},
-std::array<float,2>{0.844942331f, 0.658229411f},
-std::array<float,2>{0.400427848f, 0.495268047f},
-std::array<float,2>{0.254858911f, 0.792724311f},
-std::array<float,2>{0.925748587f, 0.00944342092f},
-std::array<float,2>{0.64874357f, 0.528477192f},
-std::array<float,2>{0.238690823f, 0.339028448f},
-std::array<float,2>{0.122969367f, 0.674655318f},
-std::array<float,2>{0.624125242f, 0.47043258f},
-std::array<float,2>{0.827179193f, 0.945677996f},
-std::array<float,2>{0.408903688f, 0.135725066f},
-std::array<float,2>{0.449343055f, 0.598653615f},
-std::array<float,2>{0.812346756f, 0.287734687f},
-std::array<float,2>{0.510398924f, 0.842446983f},
-std::array<float,2>{0.00999026466f, 0.0739956498f},
-std::array<float,2>{0.174619541f, 0.922249019f},
-std::array<float,2>{0.731280744f, 0.240982175f},
-std::array<float,2>{0.943189859f, 0.690837264f},
-std::array<float,2>{0.315614074f, 0.399781853f},
-std::array<float,2>{0.380880535f, 0.991292953f},
-std::array<float,2>{0.866676092f, 0.172328234f},
-std::array<float,2>{0.587431312f, 0.655063808f},
-std::array<float,2>{0.0753305778f, 0.44358784f},
-std::array<float,2>{0.204428792f, 0.535895824f},
-std::array<float,2>{0.682471633f, 0.363683611f},
-std::array<float,2>{0.895217657f, 0.777554035f},
-std::array<float,2>{0.30796963f, 0.038453497f},
-std::array<float,2>{0.360171199f, 0.738977194f},
-std::array<float,2>{0.998167515f, 0.433645427f},
-std::array<float,2>{0.703985631f, 0.896645308f},
-std::array<float,2>{0.131477758f, 0.195926398f},
-std::array<float,2>{0.0386648364f, 0.857177496f},
-std::array<float,2>{0.539343596f, 0.0992788523f},
-std::array<float,2>{0.757939219f, 0.567911863f},
-std::array<float,2>{0.483669877f, 0.268123955f},
-std::array<float,2>{0.33388716f, 0.985892236f},
-std::array<float,2>{0.964278221f, 0.17875506f},
-std::array<float,2>{0.735903382f, 0.65104115f},
-std::array<float,2>{0.158648312f, 0.440961987f},
-std::array<float,2>{0.0287525821f, 0.532130241f},
-std::array<float,2>{0.527252674f, 0.362733305f},
-std::array<float,2>{0.792379558f, 0.774346828f},
-std::array<float,2>{0.464051217f, 0.032850109f},
-std::array<float,2>{0.429359168f, 0.737754226f},
-std::array<float,2>{0.83595854f, 0.43268314f},
-std::array<float,2>{0.603849411f, 0.892186701f},
-std::array<float,2>{0.0938670188f, 0.20287396f},
-std::array<float,2>{0.232857034f, 0.851884484f},
-std::array<float,2>{0.63272804f, 0.0975484923f},
-std::array<float,2>{0.916399896f, 0.563607156f},
-std::array<float,2>{0.26759845f, 0.271874458f},
-std::array<float,2>{0.48476851f, 0.795835972f},
-std::array<float,2>{0.770086229f, 0.0154758245f},
-std::array<float,2>{0.559107304f, 0.524336576f},
-std::array<float,2>{0.0591377467f, 0.342847496f},
-std::array<float,2>{0.146547809f, 0.67702949f},
-std::array<float,2>{0.694536746f, 0.474972934f},
-std::array<float,2>{0.975096881f, 0.952030063f},
-std::array<float,2>{0.345294684f, 0.138053685f},
-std::array<float,2>{0.283471763f, 0.594777584f},
-std::array<float,2>{0.883284628f, 0.285023183f},
-std::array<float,2>{0.661872923f, 0.836900115f},
-std::array<float,2>{0.189464644f, 0.0753274336f},
-std::array<float,2>{0.092589438f, 0.929522276f},
-std::array<float,2>{0.572292566f, 0.23816441f},
-std::array<float,2>{0.855205238f, 0.694177926f},
-std::array<float,2>{0.390876859f, 0.403441012f},
-std::array<float,2>{0.263443619f, 0.827394426f},
-std::array<float,2>{0.931411088f, 0.0830994248f},
-std::array<float,2>{0.641085744f, 0.615321815f},
-std::array<float,2>{0.245367631f, 0.305285722f},
-std::array<float,2>{0.115286328f, 0.71642071f},
-std::array<float,2>{0.609600127f, 0.38370499f},
-std::array<float,2>{0.812669873f, 0.910015643f},
-std::array<float,2>{0.417698532f, 0.231078476f},
-std::array<float,2>{0.438791752f, 0.503347218f},
-std::array<float,2>{0.802199006f, 0.319441676f},
-std::array<float,2>{0.506099939f, 0.806725562f},
-std::array<float,2>{0.00735701201f, 0.0243210215f},
-std::array<float,2>{0.186271831f, 0.955616772f},
-std::array<float,2>{0.72201997f, 0.142544091f},
-std::array<float,2>{0.947993636f, 0.662240922f},
-std::array<float,2>{0.321447223f, 0.496203154f},
-std::array<float,2>{0.387960672f, 0.880006373f},
-std::array<float,2>{0.874145746f, 0.214713901f},
-std::array<float,2>{0.578452229f, 0.727879226f},
-std::array<float,2>{0.0691333637f, 0.41024363f},
-std::array<float,2>{0.21224156f, 0.585988462f},
-std::array<float,2>{0.678212821f, 0.255331755f},
-std::array<float,2>{0.898438036f, 0.861144602f},
-std::array<float,2>{0.297131181f, 0.123130232f},
-std::array<float,2>{0.373125494f, 0.628038883f},
-std::array<float,2>{0.987153709f, 0.456859082f},
-std::array<float,2>{0.713156164f, 0.983579874f},
-std::array<float,2>{0.137325555f, 0.169850543f},
-std::array<float,2>{0.0407439433f, 0.762797296f},
-std::array<float,2>{0.536877751f, 0.0606337748f},
-std::array<float,2>{0.751765549f, 0.55282557f},
-std::array<float,2>{0.469093591f, 0.356358826f},
-std::array<float,2>{0.310129285f, 0.915089011f},
-std::array<float,2>{0.893642843f, 0.22619307f},
-std::array<float,2>{0.685141861f, 0.708344877f},
-std::array<float,2>{0.20758301f, 0.37786746f},
-std::array<float,2>{0.0716946572f, 0.617534757f},
-std::array<float,2>{0.593227088f, 0.297615081f},
-std::array<float,2>{0.862755477f, 0.816298366f},
-std::array<float,2>{0.376662374f, 0.0864563659f},
-std::array<float,2>{0.476632416f, 0.669690192f},
-std::array<float,2>{0.762941539f, 0.491417646f},
-std::array<float,2>{0.543544471f, 0.965619922f},
-std::array<float,2>{0.0343732908f, 0.150332272f},
-std::array<float,2>{0.127387807f, 0.797106028f},
-std::array<float,2>{0.708313167f, 0.0158195216f},
-std::array<float,2>{0.995294213f, 0.510311961f},
-std::array<float,2>{0.363878101f, 0.327801138f},
-std::array<float,2>{0.412001371f, 0.872669518f},
-std::array<float,2>{0.822887003f, 0.110291734f},
-std::array<float,2>{0.618198097f, 0.583291054f},
-std::array<float,2>{0.118641734f, 0.265291244f},
-std::array<float,2>{0.23448129f, 0.722797394f},
-std::array<float,2>{0.65425688f, 0.416868776f},
-std::array<float,2>{0.927564025f, 0.890078723f},
-std::array<float,2>{0.250646234f, 0.204016134f},
-std::array<float,2>{0.319505364f, 0.556309283f},
-std::array<float,2>{0.940814614f, 0.349465817f},
-std::array<float,2>{0.727848887f, 0.750967741f},
-std::array<float,2>{0.178888589f, 0.0492537469f},
-std::array<float,2>{0.0125896819f, 0.975329578f},
-std::array<float,2>{0.512154102f, 0.157915667f},
-std::array<float,2>{0.806419134f, 0.637152016f},
-std::array<float,2>{0.447413206f, 0.467671365f},
-std::array<float,2>{0.353584737f, 0.770430446f},
-std::array<float,2>{0.981354356f, 0.0443547033f},
-std::array<float,2>{0.696159303f, 0.540344596f},
-std::array<float,2>{0.153847158f, 0.370235741f},
-std::array<float,2>{0.0507058464f, 0.643664062f},
-std::array<float,2>{0.554011226f, 0.446663648f},
-std::array<float,2>{0.779138803f, 0.997172058f},
-std::array<float,2>{0.495771348f, 0.179867998f},
-std::array<float,2>{0.402418971f, 0.578075647f},
-std::array<float,2>{0.849219978f, 0.274945319f},
-std::array<float,2>{0.565858722f, 0.846388161f},
-std::array<float,2>{0.0799127519f, 0.103114858f},
-std::array<float,2>{0.198741585f, 0.905831695f},
-std::array<float,2>{0.664656222f, 0.193066821f},
-std::array<float,2>{0.881515145f, 0.745400608f},
-std::array<float,2>{0.291134059f, 0.424053043f},
-std::array<float,2>{0.456208915f, 0.938720822f},
-std::array<float,2>{0.788043082f, 0.126999572f},
-std::array<float,2>{0.523348272f, 0.680418134f},
-std::array<float,2>{0.016494425f, 0.483339697f},
-std::array<float,2>{0.168477491f, 0.522370338f},
-std::array<float,2>{0.743543983f, 0.329428613f},
-std::array<float,2>{0.954638302f, 0.781768739f},
-std::array<float,2>{0.336350828f, 0.00765261939f},
-std::array<float,2>{0.276436299f, 0.697804153f},
-std::array<float,2>{0.909488022f, 0.392382115f},
-std::array<float,2>{0.635708094f, 0.936701834f},
-std::array<float,2>{0.224562794f, 0.243517488f},
-std::array<float,2>{0.103985906f, 0.834140122f},
-std::array<float,2>{0.60096693f, 0.0667244792f},
-std::array<float,2>{0.833849311f, 0.6056422f},
-std::array<float,2>{0.43358171f, 0.296778291f},
-std::array<float,2>{0.272403806f, 0.961188912f},
-std::array<float,2>{0.920111001f, 0.155184314f},
-std::array<float,2>{0.626182377f, 0.666659176f},
-std::array<float,2>{0.229041293f, 0.487877876f},
-std::array<float,2>{0.101471655f, 0.51454103f},
-std::array<float,2>{0.606825352f, 0.321574748f},
-std::array<float,2>{0.841817617f, 0.801283956f},
-std::array<float,2>{0.424066782f, 0.0203591473f},
-std::array<float,2>{0.467226386f, 0.706628919f},
-std::array<float,2>{0.795868695f, 0.379107356f},
-std::array<float,2>{0.528773904f, 0.921160579f},
-std::array<float,2>{0.0257423446f, 0.219638318f},
-std::array<float,2>{0.162581131f, 0.818345249f},
-std::array<float,2>{0.738771319f, 0.0920234099f},
-std::array<float,2>{0.964879334f, 0.623980761f},
-std::array<float,2>{0.331668049f, 0.303246289f},
-std::array<float,2>{0.39824304f, 0.754697502f},
-std::array<float,2>{0.857029557f, 0.053151153f},
-std::array<float,2>{0.576525927f, 0.561440289f},
-std::array<float,2>{0.0873391107f, 0.346286178f},
-std::array<float,2>{0.192070276f, 0.635234356f},
-std::array<float,2>{0.659322321f, 0.462531269f},
-std::array<float,2>{0.890124261f, 0.970669746f},
-std::array<float,2>{0.28614229f, 0.163750812f},
-std::array<float,2>{0.349054843f, 0.580103159f},
-std::array<float,2>{0.972443938f, 0.258855402f},
-std::array<float,2>{0.689326882f, 0.870564818f},
-std::array<float,2>{0.143427476f, 0.114450738f},
-std::array<float,2>{0.0550084747f, 0.883803785f},
-std::array<float,2>{0.558175206f, 0.210689217f},
-std::array<float,2>{0.769262731f, 0.720533967f},
-std::array<float,2>{0.490423024f, 0.420809537f},
-std::array<float,2>{0.325882047f, 0.851011932f},
-std::array<float,2>{0.950055778f, 0.107045703f},
-std::array<float,2>{0.726511359f, 0.571355641f},
-std::array<float,2>{0.180501938f, 0.280267626f},
-std::array<float,2>{0.00333458534f, 0.747284472f},
-std::array<float,2>{0.502154529f, 0.429305613f},
-std::array<float,2>{0.797603011f, 0.899417043f},
-std::array<float,2>{0.444774985f, 0.18789646f},
-std::array<float,2>{0.420418143f, 0.544728458f},
-std::array<float,2>{0.816700995f, 0.372310132f},
-std::array<float,2>{0.61619544f, 0.767610013f},
-std::array<float,2>{0.111319676f, 0.0395382792f},
-std::array<float,2>{0.24898231f, 0.994184375f},
-std::array<float,2>{0.646488786f, 0.185748681f},
-std::array<float,2>{0.934922159f, 0.644803941f},
-std::array<float,2>{0.258478135f, 0.452200651f},
-std::array<float,2>{0.475228548f, 0.933482349f},
-std::array<float,2>{0.757772565f, 0.24866879f},
-std::array<float,2>{0.532015204f, 0.699270129f},
-std::array<float,2>{0.0441783667f, 0.397542089f},
-std::array<float,2>{0.135770351f, 0.604180396f},
-std::array<float,2>{0.716612875f, 0.289881676f},
-std::array<float,2>{0.990938246f, 0.829159558f},
-std::array<float,2>{0.36847347f, 0.0663162917f},
-std::array<float,2>{0.304650277f, 0.686116159f},
-std::array<float,2>{0.903784871f, 0.478474826f},
-std::array<float,2>{0.672595263f, 0.942913055f},
-std::array<float,2>{0.215484023f, 0.130620837f},
-std::array<float,2>{0.0644636974f, 0.787221789f},
-std::array<float,2>{0.585870266f, 0.00138995284f},
-std::array<float,2>{0.867835879f, 0.519193113f},
-std::array<float,2>{0.384164959f, 0.33359322f},
-std::array<float,2>{0.362153798f, 0.898067534f},
-std::array<float,2>{0.997124493f, 0.196687549f},
-std::array<float,2>{0.705813587f, 0.739644766f},
-std::array<float,2>{0.130678907f, 0.435426623f},
-std::array<float,2>{0.0358610936f, 0.566946447f},
-std::array<float,2>{0.542194128f, 0.26920715f},
-std::array<float,2>{0.760775626f, 0.855852962f},
-std::array<float,2>{0.481167853f, 0.0977120772f},
-std::array<float,2>{0.380390048f, 0.655575931f},
-std::array<float,2>{0.86382401f, 0.444797397f},
-std::array<float,2>{0.589699626f, 0.990737498f},
-std::array<float,2>{0.0776340589f, 0.172965989f},
-std::array<float,2>{0.206076652f, 0.77911067f},
-std::array<float,2>{0.68038553f, 0.0373866186f},
-std::array<float,2>{0.897824287f, 0.536524951f},
-std::array<float,2>{0.306360096f, 0.365185142f},
-std::array<float,2>{0.452336401f, 0.843216896f},
-std::array<float,2>{0.810004532f, 0.0725961626f},
-std::array<float,2>{0.508524716f, 0.598032057f},
-std::array<float,2>{0.00833519176f, 0.288335383f},
-std::array<float,2>{0.172319308f, 0.689742148f},
-std::array<float,2>{0.732696712f, 0.398897439f},
-std::array<float,2>{0.944328487f, 0.923410237f},
-std::array<float,2>{0.3134754f, 0.242018893f},
-std::array<float,2>{0.257082731f, 0.527893245f},
-std::array<float,2>{0.922330201f, 0.337960154f},
-std::array<float,2>{0.651165426f, 0.79167515f},
-std::array<float,2>{0.241667002f, 0.00864696316f},
-std::array<float,2>{0.124268986f, 0.947149694f},
-std::array<float,2>{0.621857107f, 0.136382788f},
-std::array<float,2>{0.825368166f, 0.675539911f},
-std::array<float,2>{0.406984985f, 0.469298393f},
-std::array<float,2>{0.295263201f, 0.810365081f},
-std::array<float,2>{0.878176272f, 0.0290309098f},
-std::array<float,2>{0.668768525f, 0.503963292f},
-std::array<float,2>{0.201017424f, 0.313884735f},
-std::array<float,2>{0.0859163404f, 0.65930593f},
-std::array<float,2>{0.569193184f, 0.494263947f},
-std::array<float,2>{0.847129107f, 0.957359076f},
-std::array<float,2>{0.399612069f, 0.147141069f},
-std::array<float,2>{0.49747172f, 0.611626267f},
-std::array<float,2>{0.77566731f, 0.310903907f},
-std::array<float,2>{0.547770619f, 0.82276535f},
-std::array<float,2>{0.0512723923f, 0.0800255612f},
-std::array<float,2>{0.151546627f, 0.913347661f},
-std::array<float,2>{0.701639712f, 0.226786152f},
-std::array<float,2>{0.977430105f, 0.712207496f},
-std::array<float,2>{0.359267414f, 0.387192637f},
-std::array<float,2>{0.43484351f, 0.978936553f},
-std::array<float,2>{0.829570591f, 0.164424911f},
-std::array<float,2>{0.595092356f, 0.629986882f},
-std::array<float,2>{0.10564179f, 0.458623141f},
-std::array<float,2>{0.21911107f, 0.549521804f},
-std::array<float,2>{0.638409317f, 0.353893131f},
-std::array<float,2>{0.910482347f, 0.758982122f},
-std::array<float,2>{0.278394282f, 0.0579064041f},
-std::array<float,2>{0.340592265f, 0.733175039f},
-std::array<float,2>{0.958945513f, 0.407140315f},
-std::array<float,2>{0.746979117f, 0.878029764f},
-std::array<float,2>{0.165603548f, 0.217249349f},
-std::array<float,2>{0.0209759809f, 0.863971293f},
-std::array<float,2>{0.51811868f, 0.119239971f},
-std::array<float,2>{0.782731414f, 0.590618551f},
-std::array<float,2>{0.457103878f, 0.252572477f},
-std::array<float,2>{0.34652707f, 0.949245691f},
-std::array<float,2>{0.972927034f, 0.140242711f},
-std::array<float,2>{0.692473054f, 0.679363072f},
-std::array<float,2>{0.144837171f, 0.473511517f},
-std::array<float,2>{0.0611259639f, 0.525750935f},
-std::array<float,2>{0.561615348f, 0.340446055f},
-std::array<float,2>{0.772880912f, 0.793731093f},
-std::array<float,2>{0.487710476f, 0.0133843785f},
-std::array<float,2>{0.393072039f, 0.692670345f},
-std::array<float,2>{0.852809966f, 0.4059816f},
-std::array<float,2>{0.570875049f, 0.927336514f},
-std::array<float,2>{0.0912315175f, 0.235691071f},
-std::array<float,2>{0.187615111f, 0.839105189f},
-std::array<float,2>{0.66394186f, 0.0776277632f},
-std::array<float,2>{0.885062099f, 0.596145809f},
-std::array<float,2>{0.283098429f, 0.282678574f},
-std::array<float,2>{0.462810636f, 0.775436461f},
-std::array<float,2>{0.78979069f, 0.0344195627f},
-std::array<float,2>{0.524822354f, 0.533521414f},
-std::array<float,2>{0.0304672942f, 0.359702557f},
-std::array<float,2>{0.15745838f, 0.648711681f},
-std::array<float,2>{0.737106681f, 0.43936345f},
-std::array<float,2>{0.96175164f, 0.987129152f},
-std::array<float,2>{0.334052265f, 0.176307589f},
-std::array<float,2>{0.266928196f, 0.564886332f},
-std::array<float,2>{0.915623367f, 0.269984454f},
-std::array<float,2>{0.629751384f, 0.853539586f},
-std::array<float,2>{0.23115693f, 0.0952793136f},
-std::array<float,2>{0.0959356353f, 0.892699003f},
-std::array<float,2>{0.602480829f, 0.199721426f},
-std::array<float,2>{0.838042498f, 0.735832095f},
-std::array<float,2>{0.426095814f, 0.429729313f},
-std::array<float,2>{0.299359292f, 0.861756265f},
-std::array<float,2>{0.900418341f, 0.122794963f},
-std::array<float,2>{0.676410854f, 0.589788198f},
-std::array<float,2>{0.213277623f, 0.256073087f},
-std::array<float,2>{0.0671990737f, 0.73003906f},
-std::array<float,2>{0.580695391f, 0.413167298f},
-std::array<float,2>{0.871660411f, 0.88156116f},
-std::array<float,2>{0.389907181f, 0.212597996f},
-std::array<float,2>{0.471009314f, 0.55164212f},
-std::array<float,2>{0.752660632f, 0.357563287f},
-std::array<float,2>{0.538076341f, 0.76475662f},
-std::array<float,2>{0.0425501838f, 0.0588304773f},
-std::array<float,2>{0.140400261f, 0.98213923f},
-std::array<float,2>{0.712772489f, 0.17181541f},
-std::array<float,2>{0.98605597f, 0.626932859f},
-std::array<float,2>{0.37186709f, 0.453537256f},
-std::array<float,2>{0.414592296f, 0.907790661f},
-std::array<float,2>{0.816139042f, 0.232778564f},
-std::array<float,2>{0.61141175f, 0.718305409f},
-std::array<float,2>{0.113938913f, 0.386461377f},
-std::array<float,2>{0.242236733f, 0.614325345f},
-std::array<float,2>{0.642823517f, 0.308033407f},
-std::array<float,2>{0.932268798f, 0.824600458f},
-std::array<float,2>{0.265405715f, 0.0845446214f},
-std::array<float,2>{0.324026138f, 0.661423802f},
-std::array<float,2>{0.94661957f, 0.499019474f},
-std::array<float,2>{0.719848514f, 0.953926027f},
-std::array<float,2>{0.185145274f, 0.14402768f},
-std::array<float,2>{0.00404656678f, 0.80472225f},
-std::array<float,2>{0.504067123f, 0.0259723328f},
-std::array<float,2>{0.804008782f, 0.500498772f},
-std::array<float,2>{0.440755129f, 0.317441344f},
-std::array<float,2>{0.252214909f, 0.888518989f},
-std::array<float,2>{0.929095864f, 0.206539676f},
-std::array<float,2>{0.655592799f, 0.726540923f},
-std::array<float,2>{0.237522736f, 0.415756047f},
-std::array<float,2>{0.120563015f, 0.58461988f},
-std::array<float,2>{0.620212972f, 0.263270199f},
-std::array<float,2>{0.821364939f, 0.874850392f},
-std::array<float,2>{0.413365245f, 0.112075709f},
-std::array<float,2>{0.445817411f, 0.640385032f},
-std::array<float,2>{0.807252407f, 0.466458678f},
-std::array<float,2>{0.51547128f, 0.974066496f},
-std::array<float,2>{0.0146347089f, 0.159494817f},
-std::array<float,2>{0.175783888f, 0.753339946f},
-std::array<float,2>{0.730214f, 0.0472189635f},
-std::array<float,2>{0.939057112f, 0.557093322f},
-std::array<float,2>{0.317014128f, 0.351076543f},
-std::array<float,2>{0.378883183f, 0.812731981f},
-std::array<float,2>{0.859535754f, 0.0885413736f},
-std::array<float,2>{0.59167999f, 0.62060672f},
-std::array<float,2>{0.0730409548f, 0.299248904f},
-std::array<float,2>{0.209463865f, 0.709709883f},
-std::array<float,2>{0.686390877f, 0.376009166f},
-std::array<float,2>{0.891599655f, 0.916984558f},
-std::array<float,2>{0.311429441f, 0.223213956f},
-std::array<float,2>{0.36582467f, 0.508260667f},
-std::array<float,2>{0.992947638f, 0.325507909f},
-std::array<float,2>{0.710618019f, 0.800471067f},
-std::array<float,2>{0.126671165f, 0.0191350803f},
-std::array<float,2>{0.0324224681f, 0.968208134f},
-std::array<float,2>{0.546252787f, 0.150433779f},
-std::array<float,2>{0.764724076f, 0.670938432f},
-std::array<float,2>{0.478574008f, 0.489484519f},
-std::array<float,2>{0.339455545f, 0.783271074f},
-std::array<float,2>{0.955789566f, 0.00434701052f},
-std::array<float,2>{0.744493663f, 0.521232188f},
-std::array<float,2>{0.170398131f, 0.330122262f},
-std::array<float,2>{0.01893875f, 0.682526529f},
-std::array<float,2>{0.521190643f, 0.48147729f},
-std::array<float,2>{0.786844134f, 0.940894961f},
-std::array<float,2>{0.453152448f, 0.125392094f},
-std::array<float,2>{0.431563228f, 0.60935235f},
-std::array<float,2>{0.834453881f, 0.293421566f},
-std::array<float,2>{0.598012567f, 0.832374811f},
-std::array<float,2>{0.101799898f, 0.0699605793f},
-std::array<float,2>{0.224970922f, 0.933724403f},
-std::array<float,2>{0.634017527f, 0.244611979f},
-std::array<float,2>{0.908002734f, 0.696038783f},
-std::array<float,2>{0.273781866f, 0.393313646f},
-std::array<float,2>{0.493166268f, 0.998675585f},
-std::array<float,2>{0.779698908f, 0.183448091f},
-std::array<float,2>{0.552688837f, 0.641603649f},
-std::array<float,2>{0.0485325642f, 0.447684228f},
-std::array<float,2>{0.156248435f, 0.541394889f},
-std::array<float,2>{0.697734356f, 0.368660659f},
-std::array<float,2>{0.983292103f, 0.771969914f},
-std::array<float,2>{0.352262229f, 0.0455341786f},
-std::array<float,2>{0.289373428f, 0.744012833f},
-std::array<float,2>{0.880818665f, 0.423790514f},
-std::array<float,2>{0.667899966f, 0.903779507f},
-std::array<float,2>{0.196654081f, 0.193708166f},
-std::array<float,2>{0.08151564f, 0.845560968f},
-std::array<float,2>{0.562974453f, 0.104960494f},
-std::array<float,2>{0.849965096f, 0.575373173f},
-std::array<float,2>{0.405621201f, 0.276417464f},
-std::array<float,2>{0.287238896f, 0.970821679f},
-std::array<float,2>{0.888036489f, 0.160183787f},
-std::array<float,2>{0.656898975f, 0.634096205f},
-std::array<float,2>{0.193465889f, 0.463330626f},
-std::array<float,2>{0.0879941508f, 0.56025815f},
-std::array<float,2>{0.575378299f, 0.345307916f},
-std::array<float,2>{0.857879877f, 0.757555783f},
-std::array<float,2>{0.395814538f, 0.0521286055f},
-std::array<float,2>{0.489111304f, 0.722118795f},
-std::array<float,2>{0.767359674f, 0.419263929f},
-std::array<float,2>{0.556189418f, 0.885991991f},
-std::array<float,2>{0.0568678305f, 0.207719222f},
-std::array<float,2>{0.140686616f, 0.868309021f},
-std::array<float,2>{0.690602839f, 0.115952566f},
-std::array<float,2>{0.969096899f, 0.578913808f},
-std::array<float,2>{0.349707961f, 0.261284947f},
-std::array<float,2>{0.422743052f, 0.803017676f},
-std::array<float,2>{0.841789484f, 0.0233338121f},
-std::array<float,2>{0.608681738f, 0.512482584f},
-std::array<float,2>{0.099213995f, 0.323498756f},
-std::array<float,2>{0.228044584f, 0.66409266f},
-std::array<float,2>{0.62702167f, 0.484951884f},
-std::array<float,2>{0.91893059f, 0.964228809f},
-std::array<float,2>{0.270882785f, 0.154278904f},
-std::array<float,2>{0.329356253f, 0.621365547f},
-std::array<float,2>{0.967324078f, 0.300806195f},
-std::array<float,2>{0.740801573f, 0.819329977f},
-std::array<float,2>{0.161714152f, 0.089995712f},
-std::array<float,2>{0.0251880959f, 0.919314444f},
-std::array<float,2>{0.529806733f, 0.221995071f},
-std::array<float,2>{0.793224812f, 0.704193354f},
-std::array<float,2>{0.466550112f, 0.380998552f},
-std::array<float,2>{0.369182825f, 0.831966996f},
-std::array<float,2>{0.988337636f, 0.0626894608f},
-std::array<float,2>{0.718548238f, 0.603507102f},
-std::array<float,2>{0.133215353f, 0.292492568f},
-std::array<float,2>{0.0456480198f, 0.701492429f},
-std::array<float,2>{0.533413589f, 0.395253003f},
-std::array<float,2>{0.755117118f, 0.930989742f},
-std::array<float,2>{0.47339648f, 0.24657242f},
-std::array<float,2>{0.385801196f, 0.516532123f},
-std::array<float,2>{0.869592726f, 0.335722715f},
-std::array<float,2>{0.582112253f, 0.786303818f},
-std::array<float,2>{0.0642915219f, 0.00263329176f},
-std::array<float,2>{0.218317911f, 0.944924295f},
-std::array<float,2>{0.675721645f, 0.131895542f},
-std::array<float,2>{0.904508531f, 0.685151875f},
-std::array<float,2>{0.302710444f, 0.480397671f},
-std::array<float,2>{0.442034036f, 0.901922703f},
-std::array<float,2>{0.800381958f, 0.190379873f},
-std::array<float,2>{0.500048637f, 0.748732865f},
-std::array<float,2>{0.000594502315f, 0.426952809f},
-std::array<float,2>{0.181848243f, 0.573198915f},
-std::array<float,2>{0.723995805f, 0.277439058f},
-std::array<float,2>{0.952573001f, 0.849384665f},
-std::array<float,2>{0.326738119f, 0.107596919f},
-std::array<float,2>{0.260528922f, 0.648111284f},
-std::array<float,2>{0.936253726f, 0.449833632f},
-std::array<float,2>{0.646168888f, 0.993876457f},
-std::array<float,2>{0.24785839f, 0.185044363f},
-std::array<float,2>{0.112959847f, 0.765674174f},
-std::array<float,2>{0.613598943f, 0.0424996205f},
-std::array<float,2>{0.818596601f, 0.545255899f},
-std::array<float,2>{0.418418765f, 0.3749291f},
-std::array<float,2>{0.314872533f, 0.925509453f},
-std::array<float,2>{0.942196846f, 0.239617974f},
-std::array<float,2>{0.731660247f, 0.688430667f},
-std::array<float,2>{0.175224185f, 0.40151301f},
-std::array<float,2>{0.0114763072f, 0.600690126f},
-std::array<float,2>{0.511086524f, 0.28524074f},
-std::array<float,2>{0.811244845f, 0.840599477f},
-std::array<float,2>{0.450338483f, 0.0704667643f},
-std::array<float,2>{0.409865558f, 0.672698259f},
-std::array<float,2>{0.826181412f, 0.471746147f},
-std::array<float,2>{0.623322308f, 0.947385967f},
-std::array<float,2>{0.1211733f, 0.134294093f},
-std::array<float,2>{0.239687204f, 0.78972429f},
-std::array<float,2>{0.650321066f, 0.00980510376f},
-std::array<float,2>{0.924127042f, 0.530178607f},
-std::array<float,2>{0.255632132f, 0.337647796f},
-std::array<float,2>{0.483383864f, 0.857426524f},
-std::array<float,2>{0.759654522f, 0.100673512f},
-std::array<float,2>{0.540128469f, 0.569897056f},
-std::array<float,2>{0.037580546f, 0.267522782f},
-std::array<float,2>{0.132315114f, 0.741749704f},
-std::array<float,2>{0.70499301f, 0.436594218f},
-std::array<float,2>{0.999722064f, 0.894894898f},
-std::array<float,2>{0.361160994f, 0.197428808f},
-std::array<float,2>{0.307152063f, 0.53864491f},
-std::array<float,2>{0.896363139f, 0.366039753f},
-std::array<float,2>{0.683590233f, 0.779873252f},
-std::array<float,2>{0.203303188f, 0.0365913622f},
-std::array<float,2>{0.0747965276f, 0.989664912f},
-std::array<float,2>{0.586468995f, 0.175066635f},
-std::array<float,2>{0.865614235f, 0.653378904f},
-std::array<float,2>{0.382772058f, 0.442290694f},
-std::array<float,2>{0.280377507f, 0.759993911f},
-std::array<float,2>{0.912921131f, 0.0558986478f},
-std::array<float,2>{0.640446484f, 0.54734093f},
-std::array<float,2>{0.220902994f, 0.353349835f},
-std::array<float,2>{0.108778633f, 0.632326722f},
-std::array<float,2>{0.596772492f, 0.459615052f},
-std::array<float,2>{0.832017899f, 0.977678001f},
-std::array<float,2>{0.437479824f, 0.166158304f},
-std::array<float,2>{0.460180968f, 0.592148006f},
-std::array<float,2>{0.784031987f, 0.250101298f},
-std::array<float,2>{0.515849769f, 0.866065145f},
-std::array<float,2>{0.0231808554f, 0.118607774f},
-std::array<float,2>{0.167263299f, 0.875603139f},
-std::array<float,2>{0.749517739f, 0.215713546f},
-std::array<float,2>{0.959457874f, 0.732010305f},
-std::array<float,2>{0.343270272f, 0.409592986f},
-std::array<float,2>{0.401655793f, 0.959666431f},
-std::array<float,2>{0.843767107f, 0.146399364f},
-std::array<float,2>{0.567354321f, 0.65637362f},
-std::array<float,2>{0.0838781446f, 0.493422955f},
-std::array<float,2>{0.201181233f, 0.506327927f},
-std::array<float,2>{0.671399057f, 0.316212177f},
-std::array<float,2>{0.876612544f, 0.811953127f},
-std::array<float,2>{0.293665498f, 0.0300969407f},
-std::array<float,2>{0.356277943f, 0.714761317f},
-std::array<float,2>{0.978681326f, 0.389833122f},
-std::array<float,2>{0.699630976f, 0.911202073f},
-std::array<float,2>{0.148683473f, 0.228890017f},
-std::array<float,2>{0.0539358184f, 0.821971536f},
-std::array<float,2>{0.549564242f, 0.0803602114f},
-std::array<float,2>{0.775128007f, 0.6104635f},
-std::array<float,2>{0.499241322f, 0.309037477f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.996148825f, 0.951484084f},
-std::array<float,2>{0.187012553f, 0.442068487f},
-std::array<float,2>{0.629077375f, 0.049740389f},
-std::array<float,2>{0.277736485f, 0.611093521f},
-std::array<float,2>{0.577403843f, 0.697941542f},
-std::array<float,2>{0.485971957f, 0.195566893f},
-std::array<float,2>{0.83161366f, 0.26860857f},
-std::array<float,2>{0.0639279187f, 0.806381345f},
-std::array<float,2>{0.770500243f, 0.555186689f},
-std::array<float,2>{0.0310570057f, 0.0791145936f},
-std::array<float,2>{0.50624609f, 0.380001426f},
-std::array<float,2>{0.408719659f, 0.93013823f},
-std::array<float,2>{0.746564209f, 0.861255467f},
-std::array<float,2>{0.350733548f, 0.371358752f},
-std::array<float,2>{0.889196098f, 0.152589053f},
-std::array<float,2>{0.193328962f, 0.664080799f},
-std::array<float,2>{0.869330287f, 0.758210003f},
-std::array<float,2>{0.100610115f, 0.305204332f},
-std::array<float,2>{0.610225797f, 0.22009483f},
-std::array<float,2>{0.457376689f, 0.729034483f},
-std::array<float,2>{0.666393101f, 0.593433022f},
-std::array<float,2>{0.312303543f, 0.019182872f},
-std::array<float,2>{0.964327037f, 0.494858146f},
-std::array<float,2>{0.127202362f, 0.974143445f},
-std::array<float,2>{0.918604851f, 0.641947091f},
-std::array<float,2>{0.232263073f, 0.178138793f},
-std::array<float,2>{0.688240111f, 0.32481584f},
-std::array<float,2>{0.342908531f, 0.826632321f},
-std::array<float,2>{0.546117425f, 0.889085472f},
-std::array<float,2>{0.40428251f, 0.417353839f},
-std::array<float,2>{0.804025471f, 0.118603855f},
-std::array<float,2>{0.0601562262f, 0.520856023f},
-std::array<float,2>{0.899356961f, 0.843349278f},
-std::array<float,2>{0.20486109f, 0.331728101f},
-std::array<float,2>{0.720841229f, 0.16672495f},
-std::array<float,2>{0.362630039f, 0.634577692f},
-std::array<float,2>{0.520874143f, 0.508891761f},
-std::array<float,2>{0.436558038f, 0.0954686105f},
-std::array<float,2>{0.758976698f, 0.42569536f},
-std::array<float,2>{0.00766110886f, 0.90245527f},
-std::array<float,2>{0.816366076f, 0.749184012f},
-std::array<float,2>{0.0845771432f, 0.242550373f},
-std::array<float,2>{0.593581855f, 0.289416075f},
-std::array<float,2>{0.469052166f, 0.772648513f},
-std::array<float,2>{0.654644072f, 0.995441437f},
-std::array<float,2>{0.250347733f, 0.470345795f},
-std::array<float,2>{0.976386011f, 0.0134968609f},
-std::array<float,2>{0.156586826f, 0.570717156f},
-std::array<float,2>{0.794774175f, 0.90788871f},
-std::array<float,2>{0.0434537567f, 0.393332332f},
-std::array<float,2>{0.54905659f, 0.0707481727f},
-std::array<float,2>{0.38043195f, 0.537593484f},
-std::array<float,2>{0.707376003f, 0.67892772f},
-std::array<float,2>{0.323802888f, 0.139995173f},
-std::array<float,2>{0.930007339f, 0.347230017f},
-std::array<float,2>{0.237291068f, 0.849002898f},
-std::array<float,2>{0.945677996f, 0.599224806f},
-std::array<float,2>{0.148885921f, 0.0387847126f},
-std::array<float,2>{0.674948394f, 0.460462809f},
-std::array<float,2>{0.281683147f, 0.959617972f},
-std::array<float,2>{0.600538194f, 0.796391189f},
-std::array<float,2>{0.449256241f, 0.255140543f},
-std::array<float,2>{0.845115423f, 0.207497522f},
-std::array<float,2>{0.112584323f, 0.715731859f},
-std::array<float,2>{0.926130891f, 0.895908713f},
-std::array<float,2>{0.246330976f, 0.435685754f},
-std::array<float,2>{0.717155516f, 0.101860605f},
-std::array<float,2>{0.319709361f, 0.500000119f},
-std::array<float,2>{0.557409167f, 0.626597166f},
-std::array<float,2>{0.383772731f, 0.158584028f},
-std::array<float,2>{0.785759687f, 0.33966729f},
-std::array<float,2>{0.0319113061f, 0.832232177f},
-std::array<float,2>{0.856095374f, 0.569905698f},
-std::array<float,2>{0.122606687f, 0.000764956174f},
-std::array<float,2>{0.601659238f, 0.482044816f},
-std::array<float,2>{0.444366425f, 0.990153849f},
-std::array<float,2>{0.681005418f, 0.77437222f},
-std::array<float,2>{0.29244712f, 0.28381446f},
-std::array<float,2>{0.940026343f, 0.241822943f},
-std::array<float,2>{0.146472022f, 0.739922106f},
-std::array<float,2>{0.753357172f, 0.856284499f},
-std::array<float,2>{0.0125642465f, 0.353660256f},
-std::array<float,2>{0.526072741f, 0.12892884f},
-std::array<float,2>{0.428418845f, 0.684822083f},
-std::array<float,2>{0.732009411f, 0.541296363f},
-std::array<float,2>{0.371584624f, 0.0629998595f},
-std::array<float,2>{0.896516204f, 0.40247795f},
-std::array<float,2>{0.215714321f, 0.918928981f},
-std::array<float,2>{0.981063724f, 0.710571766f},
-std::array<float,2>{0.1667514f, 0.215380654f},
-std::array<float,2>{0.642405331f, 0.26281178f},
-std::array<float,2>{0.262056887f, 0.788490474f},
-std::array<float,2>{0.585797131f, 0.967278719f},
-std::array<float,2>{0.479975522f, 0.462035328f},
-std::array<float,2>{0.823320687f, 0.0432331674f},
-std::array<float,2>{0.0873886421f, 0.608310878f},
-std::array<float,2>{0.957887709f, 0.801764905f},
-std::array<float,2>{0.134233996f, 0.279007792f},
-std::array<float,2>{0.657228947f, 0.191416055f},
-std::array<float,2>{0.30171904f, 0.694022179f},
-std::array<float,2>{0.619129598f, 0.624462068f},
-std::array<float,2>{0.463058263f, 0.0620747171f},
-std::array<float,2>{0.86651361f, 0.452282518f},
-std::array<float,2>{0.105739631f, 0.94470042f},
-std::array<float,2>{0.806043506f, 0.656343222f},
-std::array<float,2>{0.0536624752f, 0.141913891f},
-std::array<float,2>{0.538614333f, 0.360768586f},
-std::array<float,2>{0.392424405f, 0.869423687f},
-std::array<float,2>{0.700760424f, 0.923337877f},
-std::array<float,2>{0.331585467f, 0.389285624f},
-std::array<float,2>{0.90691179f, 0.088995181f},
-std::array<float,2>{0.21980235f, 0.552721739f},
-std::array<float,2>{0.841362417f, 0.978404164f},
-std::array<float,2>{0.073717922f, 0.48825863f},
-std::array<float,2>{0.569270134f, 0.0245178938f},
-std::array<float,2>{0.496536642f, 0.585301757f},
-std::array<float,2>{0.633667946f, 0.721565664f},
-std::array<float,2>{0.2720927f, 0.227074593f},
-std::array<float,2>{0.989067554f, 0.302429885f},
-std::array<float,2>{0.176399723f, 0.752071142f},
-std::array<float,2>{0.882372975f, 0.530248404f},
-std::array<float,2>{0.199555933f, 0.11009898f},
-std::array<float,2>{0.73861599f, 0.410273731f},
-std::array<float,2>{0.358299345f, 0.880472481f},
-std::array<float,2>{0.514758289f, 0.816736758f},
-std::array<float,2>{0.414518267f, 0.316639453f},
-std::array<float,2>{0.777158022f, 0.180979431f},
-std::array<float,2>{0.0170662105f, 0.652535737f},
-std::array<float,2>{0.885357976f, 0.988018155f},
-std::array<float,2>{0.188613862f, 0.477652788f},
-std::array<float,2>{0.743871987f, 0.00717156287f},
-std::array<float,2>{0.34545505f, 0.564515352f},
-std::array<float,2>{0.502222359f, 0.73764056f},
-std::array<float,2>{0.412253231f, 0.235597298f},
-std::array<float,2>{0.766298294f, 0.287355512f},
-std::array<float,2>{0.0254765209f, 0.779729187f},
-std::array<float,2>{0.834168494f, 0.507728517f},
-std::array<float,2>{0.0681021139f, 0.107610144f},
-std::array<float,2>{0.573310018f, 0.430753797f},
-std::array<float,2>{0.490410209f, 0.893755436f},
-std::array<float,2>{0.628014326f, 0.82854259f},
-std::array<float,2>{0.277114153f, 0.343197584f},
-std::array<float,2>{0.994041681f, 0.161010206f},
-std::array<float,2>{0.180544794f, 0.63237679f},
-std::array<float,2>{0.800364196f, 0.785021007f},
-std::array<float,2>{0.0567063242f, 0.257870883f},
-std::array<float,2>{0.540733397f, 0.212093547f},
-std::array<float,2>{0.398697317f, 0.706388354f},
-std::array<float,2>{0.692334831f, 0.602900207f},
-std::array<float,2>{0.336739212f, 0.0413773358f},
-std::array<float,2>{0.914152384f, 0.465004355f},
-std::array<float,2>{0.228047147f, 0.964552402f},
-std::array<float,2>{0.966410875f, 0.681667864f},
-std::array<float,2>{0.130962566f, 0.125875145f},
-std::array<float,2>{0.669445395f, 0.357380897f},
-std::array<float,2>{0.304894626f, 0.852171361f},
-std::array<float,2>{0.613961101f, 0.917345345f},
-std::array<float,2>{0.454091698f, 0.401356012f},
-std::array<float,2>{0.871414781f, 0.0684292614f},
-std::array<float,2>{0.0939405859f, 0.543432891f},
-std::array<float,2>{0.96878612f, 0.873930871f},
-std::array<float,2>{0.161995068f, 0.366470903f},
-std::array<float,2>{0.651919425f, 0.145231143f},
-std::array<float,2>{0.257185757f, 0.660857797f},
-std::array<float,2>{0.589060962f, 0.548012257f},
-std::array<float,2>{0.474312097f, 0.089939639f},
-std::array<float,2>{0.81742537f, 0.385931134f},
-std::array<float,2>{0.0817972124f, 0.927602053f},
-std::array<float,2>{0.764013946f, 0.688468516f},
-std::array<float,2>{0.00316562899f, 0.189648792f},
-std::array<float,2>{0.518874109f, 0.273992598f},
-std::array<float,2>{0.429964572f, 0.799443185f},
-std::array<float,2>{0.723430514f, 0.939522028f},
-std::array<float,2>{0.366155773f, 0.448687851f},
-std::array<float,2>{0.904084444f, 0.0547156855f},
-std::array<float,2>{0.208341807f, 0.61864531f},
-std::array<float,2>{0.849562168f, 0.875647545f},
-std::array<float,2>{0.117054798f, 0.407764226f},
-std::array<float,2>{0.595668972f, 0.115450665f},
-std::array<float,2>{0.447917581f, 0.525623918f},
-std::array<float,2>{0.67809546f, 0.648459554f},
-std::array<float,2>{0.286474824f, 0.186337262f},
-std::array<float,2>{0.951889098f, 0.31278348f},
-std::array<float,2>{0.153207093f, 0.813342154f},
-std::array<float,2>{0.934619069f, 0.578885853f},
-std::array<float,2>{0.238688573f, 0.0282805972f},
-std::array<float,2>{0.706432283f, 0.489060372f},
-std::array<float,2>{0.326535821f, 0.981552899f},
-std::array<float,2>{0.552224815f, 0.754701197f},
-std::array<float,2>{0.375744164f, 0.299070269f},
-std::array<float,2>{0.791027188f, 0.232140332f},
-std::array<float,2>{0.0396599472f, 0.723269463f},
-std::array<float,2>{0.944227576f, 0.937074363f},
-std::array<float,2>{0.144052967f, 0.376496106f},
-std::array<float,2>{0.685584903f, 0.0831731632f},
-std::array<float,2>{0.295705259f, 0.562037647f},
-std::array<float,2>{0.608598351f, 0.67065239f},
-std::array<float,2>{0.440277338f, 0.151323229f},
-std::array<float,2>{0.854728222f, 0.368388295f},
-std::array<float,2>{0.119111091f, 0.865051925f},
-std::array<float,2>{0.783610761f, 0.616990805f},
-std::array<float,2>{0.0362034775f, 0.0520004369f},
-std::array<float,2>{0.562363565f, 0.440432131f},
-std::array<float,2>{0.389160365f, 0.946879447f},
-std::array<float,2>{0.71299547f, 0.812156558f},
-std::array<float,2>{0.316020191f, 0.27147311f},
-std::array<float,2>{0.923034132f, 0.202263981f},
-std::array<float,2>{0.244110689f, 0.701262593f},
-std::array<float,2>{0.825469255f, 0.824073851f},
-std::array<float,2>{0.0923340172f, 0.323955834f},
-std::array<float,2>{0.580380321f, 0.1728964f},
-std::array<float,2>{0.483508617f, 0.645788491f},
-std::array<float,2>{0.647519767f, 0.517295539f},
-std::array<float,2>{0.259963393f, 0.122537546f},
-std::array<float,2>{0.978713155f, 0.421019793f},
-std::array<float,2>{0.170547143f, 0.882941604f},
-std::array<float,2>{0.891792953f, 0.730871916f},
-std::array<float,2>{0.213129535f, 0.223666251f},
-std::array<float,2>{0.730027735f, 0.309294134f},
-std::array<float,2>{0.368930399f, 0.764385521f},
-std::array<float,2>{0.52796191f, 0.971145809f},
-std::array<float,2>{0.422513872f, 0.499699056f},
-std::array<float,2>{0.753907919f, 0.0198817402f},
-std::array<float,2>{0.00965437479f, 0.586193442f},
-std::array<float,2>{0.91051501f, 0.767397344f},
-std::array<float,2>{0.225663051f, 0.29368192f},
-std::array<float,2>{0.696071267f, 0.248617977f},
-std::array<float,2>{0.33294493f, 0.745661259f},
-std::array<float,2>{0.534738779f, 0.575736582f},
-std::array<float,2>{0.395341367f, 0.00823672581f},
-std::array<float,2>{0.809893548f, 0.474008799f},
-std::array<float,2>{0.0488163307f, 0.997731984f},
-std::array<float,2>{0.859565318f, 0.639087141f},
-std::array<float,2>{0.104530819f, 0.17033428f},
-std::array<float,2>{0.623942375f, 0.335921675f},
-std::array<float,2>{0.465606332f, 0.837844312f},
-std::array<float,2>{0.662092984f, 0.900583982f},
-std::array<float,2>{0.299936146f, 0.427104324f},
-std::array<float,2>{0.956126273f, 0.099616304f},
-std::array<float,2>{0.13690789f, 0.515374541f},
-std::array<float,2>{0.779231727f, 0.955627918f},
-std::array<float,2>{0.0233714879f, 0.454329789f},
-std::array<float,2>{0.510096252f, 0.0321132317f},
-std::array<float,2>{0.421168149f, 0.597335756f},
-std::array<float,2>{0.735238969f, 0.712098718f},
-std::array<float,2>{0.351857573f, 0.2033602f},
-std::array<float,2>{0.876874864f, 0.252353996f},
-std::array<float,2>{0.197894618f, 0.789575934f},
-std::array<float,2>{0.987276673f, 0.531446934f},
-std::array<float,2>{0.172987953f, 0.0754505843f},
-std::array<float,2>{0.639002979f, 0.394778997f},
-std::array<float,2>{0.269359052f, 0.910972536f},
-std::array<float,2>{0.563886046f, 0.845204532f},
-std::array<float,2>{0.494323164f, 0.351392359f},
-std::array<float,2>{0.83911562f, 0.135920852f},
-std::array<float,2>{0.0778165832f, 0.673514307f},
-std::array<float,2>{0.961998999f, 0.974676847f},
-std::array<float,2>{0.125428587f, 0.493867308f},
-std::array<float,2>{0.664785802f, 0.0166643802f},
-std::array<float,2>{0.309332848f, 0.591398537f},
-std::array<float,2>{0.612359166f, 0.727182865f},
-std::array<float,2>{0.460034519f, 0.220709041f},
-std::array<float,2>{0.867836773f, 0.308580369f},
-std::array<float,2>{0.0989414528f, 0.76012218f},
-std::array<float,2>{0.801998138f, 0.522340477f},
-std::array<float,2>{0.0624882057f, 0.120439142f},
-std::array<float,2>{0.543738127f, 0.414909989f},
-std::array<float,2>{0.405127108f, 0.887224257f},
-std::array<float,2>{0.690954745f, 0.82437098f},
-std::array<float,2>{0.340242416f, 0.327333361f},
-std::array<float,2>{0.921504676f, 0.177057877f},
-std::array<float,2>{0.234288082f, 0.644100547f},
-std::array<float,2>{0.828842998f, 0.808062673f},
-std::array<float,2>{0.0645542666f, 0.267054379f},
-std::array<float,2>{0.576110542f, 0.197839618f},
-std::array<float,2>{0.487622529f, 0.696896911f},
-std::array<float,2>{0.631304383f, 0.612759888f},
-std::array<float,2>{0.280894369f, 0.0482025482f},
-std::array<float,2>{0.99972707f, 0.444904447f},
-std::array<float,2>{0.184726521f, 0.949746668f},
-std::array<float,2>{0.887764394f, 0.666209996f},
-std::array<float,2>{0.193816438f, 0.155991837f},
-std::array<float,2>{0.748126566f, 0.373996824f},
-std::array<float,2>{0.3494322f, 0.863136351f},
-std::array<float,2>{0.504005194f, 0.932783127f},
-std::array<float,2>{0.406534255f, 0.381075859f},
-std::array<float,2>{0.773087442f, 0.0812853351f},
-std::array<float,2>{0.0281840283f, 0.558113873f},
-std::array<float,2>{0.933155537f, 0.850358307f},
-std::array<float,2>{0.235643566f, 0.344986588f},
-std::array<float,2>{0.710912943f, 0.137528971f},
-std::array<float,2>{0.320670605f, 0.67734772f},
-std::array<float,2>{0.548508823f, 0.53597188f},
-std::array<float,2>{0.382529765f, 0.0723309591f},
-std::array<float,2>{0.795721352f, 0.391758293f},
-std::array<float,2>{0.0468147732f, 0.909022033f},
-std::array<float,2>{0.845715523f, 0.717663348f},
-std::array<float,2>{0.110163502f, 0.210726187f},
-std::array<float,2>{0.59857142f, 0.257681042f},
-std::array<float,2>{0.452766418f, 0.793148756f},
-std::array<float,2>{0.672214985f, 0.957955778f},
-std::array<float,2>{0.283862472f, 0.45849359f},
-std::array<float,2>{0.947978437f, 0.0367491059f},
-std::array<float,2>{0.151808113f, 0.601420105f},
-std::array<float,2>{0.761418045f, 0.90501833f},
-std::array<float,2>{0.00415878091f, 0.422331899f},
-std::array<float,2>{0.521801054f, 0.0965657979f},
-std::array<float,2>{0.433980256f, 0.510940254f},
-std::array<float,2>{0.719685197f, 0.635213792f},
-std::array<float,2>{0.359606147f, 0.165450558f},
-std::array<float,2>{0.901341558f, 0.328493029f},
-std::array<float,2>{0.206734136f, 0.841678977f},
-std::array<float,2>{0.973021388f, 0.574076056f},
-std::array<float,2>{0.160125852f, 0.0137967765f},
-std::array<float,2>{0.653377116f, 0.472361714f},
-std::array<float,2>{0.252748221f, 0.992892206f},
-std::array<float,2>{0.590132713f, 0.771215439f},
-std::array<float,2>{0.47106117f, 0.291194618f},
-std::array<float,2>{0.813598454f, 0.244532481f},
-std::array<float,2>{0.0823967904f, 0.746736407f},
-std::array<float,2>{0.89563185f, 0.921065688f},
-std::array<float,2>{0.216879606f, 0.405925661f},
-std::array<float,2>{0.733339071f, 0.0647343025f},
-std::array<float,2>{0.373096406f, 0.539150357f},
-std::array<float,2>{0.525288999f, 0.687061906f},
-std::array<float,2>{0.427577287f, 0.131232843f},
-std::array<float,2>{0.751521885f, 0.352904856f},
-std::array<float,2>{0.0149238668f, 0.857791901f},
-std::array<float,2>{0.820676744f, 0.606353521f},
-std::array<float,2>{0.0889919847f, 0.0461251251f},
-std::array<float,2>{0.583311915f, 0.463060379f},
-std::array<float,2>{0.478019923f, 0.965512455f},
-std::array<float,2>{0.644339204f, 0.785273373f},
-std::array<float,2>{0.264321536f, 0.265113384f},
-std::array<float,2>{0.982889891f, 0.216996655f},
-std::array<float,2>{0.165490702f, 0.708237648f},
-std::array<float,2>{0.788778424f, 0.834391057f},
-std::array<float,2>{0.0341097675f, 0.336507529f},
-std::array<float,2>{0.554784f, 0.156589553f},
-std::array<float,2>{0.386000454f, 0.628658056f},
-std::array<float,2>{0.716601908f, 0.50363481f},
-std::array<float,2>{0.317170799f, 0.104804821f},
-std::array<float,2>{0.928280413f, 0.434454411f},
-std::array<float,2>{0.248877332f, 0.896660745f},
-std::array<float,2>{0.93840152f, 0.742186904f},
-std::array<float,2>{0.148046762f, 0.239579558f},
-std::array<float,2>{0.682097077f, 0.282260239f},
-std::array<float,2>{0.290217519f, 0.775930643f},
-std::array<float,2>{0.604459822f, 0.991824329f},
-std::array<float,2>{0.441740245f, 0.48435691f},
-std::array<float,2>{0.857605398f, 0.00381235383f},
-std::array<float,2>{0.123951018f, 0.566729605f},
-std::array<float,2>{0.991315782f, 0.751384497f},
-std::array<float,2>{0.179649755f, 0.303203434f},
-std::array<float,2>{0.63633275f, 0.229342625f},
-std::array<float,2>{0.269578964f, 0.719974935f},
-std::array<float,2>{0.567402124f, 0.583667696f},
-std::array<float,2>{0.499811739f, 0.0263401438f},
-std::array<float,2>{0.842380881f, 0.484914958f},
-std::array<float,2>{0.0715340897f, 0.979018092f},
-std::array<float,2>{0.773790836f, 0.65566963f},
-std::array<float,2>{0.0185866319f, 0.1817469f},
-std::array<float,2>{0.512358546f, 0.320058525f},
-std::array<float,2>{0.416217089f, 0.819182277f},
-std::array<float,2>{0.740961671f, 0.881500065f},
-std::array<float,2>{0.357089132f, 0.413838357f},
-std::array<float,2>{0.880769491f, 0.111410685f},
-std::array<float,2>{0.201283604f, 0.529180229f},
-std::array<float,2>{0.863644421f, 0.942054391f},
-std::array<float,2>{0.107858285f, 0.450473577f},
-std::array<float,2>{0.619496286f, 0.0590295866f},
-std::array<float,2>{0.462242723f, 0.622681379f},
-std::array<float,2>{0.659399092f, 0.693274558f},
-std::array<float,2>{0.303554565f, 0.194225118f},
-std::array<float,2>{0.960637748f, 0.280131012f},
-std::array<float,2>{0.134913012f, 0.804590821f},
-std::array<float,2>{0.908864021f, 0.552795649f},
-std::array<float,2>{0.221287474f, 0.0873014852f},
-std::array<float,2>{0.701487541f, 0.387422383f},
-std::array<float,2>{0.328892469f, 0.924153328f},
-std::array<float,2>{0.536221802f, 0.8673383f},
-std::array<float,2>{0.392672598f, 0.362090051f},
-std::array<float,2>{0.808237851f, 0.143431708f},
-std::array<float,2>{0.0515828021f, 0.65888685f},
-std::array<float,2>{0.916365027f, 0.96198535f},
-std::array<float,2>{0.228590116f, 0.467909098f},
-std::array<float,2>{0.693399608f, 0.0408749953f},
-std::array<float,2>{0.338263154f, 0.603936434f},
-std::array<float,2>{0.541507065f, 0.704137444f},
-std::array<float,2>{0.401828915f, 0.212948233f},
-std::array<float,2>{0.797922373f, 0.260872275f},
-std::array<float,2>{0.0565174595f, 0.782064915f},
-std::array<float,2>{0.873086452f, 0.545008361f},
-std::array<float,2>{0.0971255377f, 0.0672469139f},
-std::array<float,2>{0.61597836f, 0.398475677f},
-std::array<float,2>{0.456997454f, 0.914335608f},
-std::array<float,2>{0.670891285f, 0.853942215f},
-std::array<float,2>{0.308237195f, 0.358832955f},
-std::array<float,2>{0.967692375f, 0.128071666f},
-std::array<float,2>{0.130261019f, 0.680573702f},
-std::array<float,2>{0.768098772f, 0.779184818f},
-std::array<float,2>{0.0237755384f, 0.28567028f},
-std::array<float,2>{0.501113415f, 0.238012061f},
-std::array<float,2>{0.411548436f, 0.735545695f},
-std::array<float,2>{0.745508254f, 0.564019203f},
-std::array<float,2>{0.347007155f, 0.00405501993f},
-std::array<float,2>{0.883200645f, 0.478913188f},
-std::array<float,2>{0.189758509f, 0.986117184f},
-std::array<float,2>{0.995423317f, 0.630072355f},
-std::array<float,2>{0.18202889f, 0.163599327f},
-std::array<float,2>{0.626065314f, 0.341065377f},
-std::array<float,2>{0.274464577f, 0.83135587f},
-std::array<float,2>{0.570772707f, 0.890916765f},
-std::array<float,2>{0.489542603f, 0.432808727f},
-std::array<float,2>{0.833849788f, 0.106548458f},
-std::array<float,2>{0.0696569085f, 0.503912449f},
-std::array<float,2>{0.950959027f, 0.815638483f},
-std::array<float,2>{0.15519993f, 0.316132694f},
-std::array<float,2>{0.675798059f, 0.18401964f},
-std::array<float,2>{0.287390292f, 0.650994182f},
-std::array<float,2>{0.596168518f, 0.524942636f},
-std::array<float,2>{0.446547598f, 0.115210727f},
-std::array<float,2>{0.849647045f, 0.410044909f},
-std::array<float,2>{0.113978766f, 0.877340019f},
-std::array<float,2>{0.790039957f, 0.725955129f},
-std::array<float,2>{0.0416991897f, 0.232629761f},
-std::array<float,2>{0.553143978f, 0.297028601f},
-std::array<float,2>{0.377803624f, 0.756534815f},
-std::array<float,2>{0.703370333f, 0.984291434f},
-std::array<float,2>{0.325725734f, 0.490665585f},
-std::array<float,2>{0.937150598f, 0.0296383258f},
-std::array<float,2>{0.241565526f, 0.580943763f},
-std::array<float,2>{0.818791389f, 0.929114163f},
-std::array<float,2>{0.0799720436f, 0.384213805f},
-std::array<float,2>{0.587089479f, 0.0922854543f},
-std::array<float,2>{0.476343513f, 0.549934328f},
-std::array<float,2>{0.648769319f, 0.663538039f},
-std::array<float,2>{0.255755723f, 0.148383141f},
-std::array<float,2>{0.971603036f, 0.363724083f},
-std::array<float,2>{0.163843974f, 0.872062922f},
-std::array<float,2>{0.905012071f, 0.619167089f},
-std::array<float,2>{0.210757419f, 0.0573928803f},
-std::array<float,2>{0.72568047f, 0.44565466f},
-std::array<float,2>{0.364672422f, 0.938165605f},
-std::array<float,2>{0.516158462f, 0.79809314f},
-std::array<float,2>{0.431797355f, 0.276267648f},
-std::array<float,2>{0.762180448f, 0.188979149f},
-std::array<float,2>{0.00129335921f, 0.690832198f},
-std::array<float,2>{0.978000045f, 0.885328233f},
-std::array<float,2>{0.168899611f, 0.41900596f},
-std::array<float,2>{0.645335019f, 0.123753697f},
-std::array<float,2>{0.258140922f, 0.519435346f},
-std::array<float,2>{0.578651667f, 0.647786558f},
-std::array<float,2>{0.480937004f, 0.175604075f},
-std::array<float,2>{0.827008307f, 0.320993543f},
-std::array<float,2>{0.0917286798f, 0.821758986f},
-std::array<float,2>{0.757418752f, 0.588937163f},
-std::array<float,2>{0.0115462309f, 0.0222719684f},
-std::array<float,2>{0.530730069f, 0.497105122f},
-std::array<float,2>{0.425307125f, 0.969373584f},
-std::array<float,2>{0.72806704f, 0.763491511f},
-std::array<float,2>{0.370956481f, 0.31176278f},
-std::array<float,2>{0.893107772f, 0.225936055f},
-std::array<float,2>{0.212144837f, 0.733719289f},
-std::array<float,2>{0.852846742f, 0.866809845f},
-std::array<float,2>{0.120535679f, 0.370721906f},
-std::array<float,2>{0.606229663f, 0.150260106f},
-std::array<float,2>{0.439190835f, 0.66951257f},
-std::array<float,2>{0.685009181f, 0.558619797f},
-std::array<float,2>{0.294755906f, 0.0847205743f},
-std::array<float,2>{0.943204939f, 0.377218634f},
-std::array<float,2>{0.14229846f, 0.934718132f},
-std::array<float,2>{0.924096882f, 0.700773358f},
-std::array<float,2>{0.244958445f, 0.200867653f},
-std::array<float,2>{0.711020708f, 0.272731185f},
-std::array<float,2>{0.312555581f, 0.810438871f},
-std::array<float,2>{0.558630943f, 0.948788404f},
-std::array<float,2>{0.387260735f, 0.437636793f},
-std::array<float,2>{0.782232881f, 0.0545548797f},
-std::array<float,2>{0.0380906686f, 0.615200758f},
-std::array<float,2>{0.878011227f, 0.791609049f},
-std::array<float,2>{0.195822686f, 0.250598669f},
-std::array<float,2>{0.736882329f, 0.206540585f},
-std::array<float,2>{0.354063123f, 0.714097977f},
-std::array<float,2>{0.508777976f, 0.594317973f},
-std::array<float,2>{0.41841957f, 0.0333442837f},
-std::array<float,2>{0.780271411f, 0.455761194f},
-std::array<float,2>{0.0199067034f, 0.953860402f},
-std::array<float,2>{0.837740123f, 0.674889922f},
-std::array<float,2>{0.0756028146f, 0.133285493f},
-std::array<float,2>{0.565638363f, 0.348412007f},
-std::array<float,2>{0.493997395f, 0.846403301f},
-std::array<float,2>{0.63809824f, 0.912993014f},
-std::array<float,2>{0.267183781f, 0.397589058f},
-std::array<float,2>{0.985886693f, 0.0770836025f},
-std::array<float,2>{0.174209237f, 0.533341646f},
-std::array<float,2>{0.811825931f, 0.999072552f},
-std::array<float,2>{0.0495185815f, 0.476298779f},
-std::array<float,2>{0.533097148f, 0.0103054037f},
-std::array<float,2>{0.397561014f, 0.577327907f},
-std::array<float,2>{0.698908865f, 0.742907345f},
-std::array<float,2>{0.334884822f, 0.248031944f},
-std::array<float,2>{0.912531614f, 0.295331061f},
-std::array<float,2>{0.223524913f, 0.769012153f},
-std::array<float,2>{0.953526378f, 0.51237601f},
-std::array<float,2>{0.140359253f, 0.09894339f},
-std::array<float,2>{0.662194192f, 0.428641975f},
-std::array<float,2>{0.297014803f, 0.899938643f},
-std::array<float,2>{0.621202886f, 0.837973535f},
-std::array<float,2>{0.467367679f, 0.332717538f},
-std::array<float,2>{0.862375021f, 0.169506773f},
-std::array<float,2>{0.102680854f, 0.636956036f},
-std::array<float,2>{0.975025415f, 0.994125903f},
-std::array<float,2>{0.157802418f, 0.471234441f},
-std::array<float,2>{0.656026125f, 0.0149259176f},
-std::array<float,2>{0.251399934f, 0.572984397f},
-std::array<float,2>{0.59276849f, 0.747387409f},
-std::array<float,2>{0.470199019f, 0.24536711f},
-std::array<float,2>{0.815403581f, 0.292855561f},
-std::array<float,2>{0.0854916573f, 0.770422757f},
-std::array<float,2>{0.758684635f, 0.510368884f},
-std::array<float,2>{0.00588458171f, 0.097122997f},
-std::array<float,2>{0.520077229f, 0.423624545f},
-std::array<float,2>{0.435934901f, 0.905696452f},
-std::array<float,2>{0.722308755f, 0.840587318f},
-std::array<float,2>{0.361682624f, 0.329380542f},
-std::array<float,2>{0.89942801f, 0.164428994f},
-std::array<float,2>{0.203145176f, 0.636123121f},
-std::array<float,2>{0.844483852f, 0.794145405f},
-std::array<float,2>{0.111654416f, 0.2563366f},
-std::array<float,2>{0.601115346f, 0.209157616f},
-std::array<float,2>{0.450692803f, 0.718164325f},
-std::array<float,2>{0.674661279f, 0.599760711f},
-std::array<float,2>{0.28287971f, 0.0354998894f},
-std::array<float,2>{0.94715476f, 0.457159907f},
-std::array<float,2>{0.149775803f, 0.958243012f},
-std::array<float,2>{0.931235731f, 0.676742136f},
-std::array<float,2>{0.237546533f, 0.138429627f},
-std::array<float,2>{0.708474755f, 0.344102532f},
-std::array<float,2>{0.322761267f, 0.851127803f},
-std::array<float,2>{0.550373137f, 0.909702301f},
-std::array<float,2>{0.379286498f, 0.391144276f},
-std::array<float,2>{0.793201745f, 0.0733413175f},
-std::array<float,2>{0.0442477651f, 0.536382914f},
-std::array<float,2>{0.89001596f, 0.86164391f},
-std::array<float,2>{0.192252576f, 0.374237388f},
-std::array<float,2>{0.747727394f, 0.155167654f},
-std::array<float,2>{0.34963724f, 0.667514205f},
-std::array<float,2>{0.507294953f, 0.557287514f},
-std::array<float,2>{0.409990728f, 0.080455184f},
-std::array<float,2>{0.770872116f, 0.382473975f},
-std::array<float,2>{0.0294102617f, 0.932460606f},
-std::array<float,2>{0.830226958f, 0.695736945f},
-std::array<float,2>{0.0634570494f, 0.198995188f},
-std::array<float,2>{0.576715529f, 0.265931904f},
-std::array<float,2>{0.485098422f, 0.806883693f},
-std::array<float,2>{0.630163789f, 0.951151609f},
-std::array<float,2>{0.278994828f, 0.444088161f},
-std::array<float,2>{0.997789562f, 0.0473784246f},
-std::array<float,2>{0.18561995f, 0.611662924f},
-std::array<float,2>{0.803561211f, 0.887939572f},
-std::array<float,2>{0.0589552559f, 0.41601485f},
-std::array<float,2>{0.545304239f, 0.11922244f},
-std::array<float,2>{0.402973682f, 0.522747338f},
-std::array<float,2>{0.689137578f, 0.643369436f},
-std::array<float,2>{0.342563659f, 0.176231563f},
-std::array<float,2>{0.919695735f, 0.327122837f},
-std::array<float,2>{0.230606124f, 0.825473189f},
-std::array<float,2>{0.963193178f, 0.590243936f},
-std::array<float,2>{0.127984956f, 0.0157149918f},
-std::array<float,2>{0.667452216f, 0.492830694f},
-std::array<float,2>{0.311362028f, 0.976088166f},
-std::array<float,2>{0.610554218f, 0.760969818f},
-std::array<float,2>{0.458658069f, 0.306896597f},
-std::array<float,2>{0.87063694f, 0.222132549f},
-std::array<float,2>{0.0997018889f, 0.727580011f},
-std::array<float,2>{0.907645404f, 0.925747633f},
-std::array<float,2>{0.219245598f, 0.388664156f},
-std::array<float,2>{0.699262917f, 0.0868420973f},
-std::array<float,2>{0.330712229f, 0.554384291f},
-std::array<float,2>{0.537227035f, 0.659416795f},
-std::array<float,2>{0.390825003f, 0.144098029f},
-std::array<float,2>{0.804816604f, 0.362596422f},
-std::array<float,2>{0.0539564751f, 0.868572533f},
-std::array<float,2>{0.865671217f, 0.621415079f},
-std::array<float,2>{0.106562302f, 0.0599792488f},
-std::array<float,2>{0.618160367f, 0.450039446f},
-std::array<float,2>{0.464067698f, 0.94321245f},
-std::array<float,2>{0.656575561f, 0.803207278f},
-std::array<float,2>{0.302544743f, 0.280989379f},
-std::array<float,2>{0.958642483f, 0.194467843f},
-std::array<float,2>{0.133639291f, 0.691831052f},
-std::array<float,2>{0.775668085f, 0.81991905f},
-std::array<float,2>{0.0161790401f, 0.319210231f},
-std::array<float,2>{0.514165878f, 0.183287963f},
-std::array<float,2>{0.415757537f, 0.654548764f},
-std::array<float,2>{0.740032434f, 0.528298259f},
-std::array<float,2>{0.358518809f, 0.113156363f},
-std::array<float,2>{0.881383479f, 0.412312329f},
-std::array<float,2>{0.201118961f, 0.882732034f},
-std::array<float,2>{0.989971876f, 0.718778312f},
-std::array<float,2>{0.177260384f, 0.23026605f},
-std::array<float,2>{0.63409102f, 0.303881347f},
-std::array<float,2>{0.273268461f, 0.750697851f},
-std::array<float,2>{0.56959796f, 0.979657471f},
-std::array<float,2>{0.497283787f, 0.485950202f},
-std::array<float,2>{0.839886069f, 0.0266625248f},
-std::array<float,2>{0.0724310204f, 0.582582474f},
-std::array<float,2>{0.94112277f, 0.777339101f},
-std::array<float,2>{0.144899413f, 0.281465024f},
-std::array<float,2>{0.679842532f, 0.238964081f},
-std::array<float,2>{0.291104198f, 0.740317523f},
-std::array<float,2>{0.603228688f, 0.568200231f},
-std::array<float,2>{0.444032937f, 0.00262985541f},
-std::array<float,2>{0.856573761f, 0.483009636f},
-std::array<float,2>{0.121165693f, 0.99031508f},
-std::array<float,2>{0.786823869f, 0.627804577f},
-std::array<float,2>{0.0322658159f, 0.157384455f},
-std::array<float,2>{0.55825603f, 0.337102056f},
-std::array<float,2>{0.384262264f, 0.835070848f},
-std::array<float,2>{0.71781081f, 0.897745609f},
-std::array<float,2>{0.318393201f, 0.435315877f},
-std::array<float,2>{0.926946163f, 0.103793755f},
-std::array<float,2>{0.247899443f, 0.502446532f},
-std::array<float,2>{0.822921216f, 0.966486275f},
-std::array<float,2>{0.0863937289f, 0.46450159f},
-std::array<float,2>{0.584151566f, 0.0454938412f},
-std::array<float,2>{0.478664547f, 0.606509805f},
-std::array<float,2>{0.640976429f, 0.707120597f},
-std::array<float,2>{0.263545036f, 0.218413636f},
-std::array<float,2>{0.982127786f, 0.263869077f},
-std::array<float,2>{0.167559177f, 0.786164522f},
-std::array<float,2>{0.897794843f, 0.540834308f},
-std::array<float,2>{0.216233492f, 0.0659452826f},
-std::array<float,2>{0.731048882f, 0.404917181f},
-std::array<float,2>{0.372454882f, 0.920572877f},
-std::array<float,2>{0.526929975f, 0.858514845f},
-std::array<float,2>{0.429195374f, 0.351617008f},
-std::array<float,2>{0.752717018f, 0.132565424f},
-std::array<float,2>{0.0130610596f, 0.686442435f},
-std::array<float,2>{0.902996302f, 0.939348519f},
-std::array<float,2>{0.20791389f, 0.446898639f},
-std::array<float,2>{0.723842621f, 0.0579859242f},
-std::array<float,2>{0.366219372f, 0.6202811f},
-std::array<float,2>{0.518108964f, 0.690203309f},
-std::array<float,2>{0.431584299f, 0.188427985f},
-std::array<float,2>{0.764947295f, 0.276985258f},
-std::array<float,2>{0.00239451579f, 0.797590375f},
-std::array<float,2>{0.817177594f, 0.548899233f},
-std::array<float,2>{0.0805982128f, 0.0931068733f},
-std::array<float,2>{0.588383317f, 0.383482039f},
-std::array<float,2>{0.472729713f, 0.928699255f},
-std::array<float,2>{0.651160121f, 0.872427225f},
-std::array<float,2>{0.256686151f, 0.364587575f},
-std::array<float,2>{0.969913363f, 0.147290066f},
-std::array<float,2>{0.16075857f, 0.662445784f},
-std::array<float,2>{0.792369664f, 0.757324219f},
-std::array<float,2>{0.040901158f, 0.29870683f},
-std::array<float,2>{0.551107585f, 0.233762085f},
-std::array<float,2>{0.376315981f, 0.72520256f},
-std::array<float,2>{0.705753386f, 0.581937969f},
-std::array<float,2>{0.327400982f, 0.0312302709f},
-std::array<float,2>{0.934213638f, 0.491311312f},
-std::array<float,2>{0.239570275f, 0.983376265f},
-std::array<float,2>{0.952281773f, 0.652316153f},
-std::array<float,2>{0.153786957f, 0.184681937f},
-std::array<float,2>{0.679047942f, 0.314790964f},
-std::array<float,2>{0.285356104f, 0.814754963f},
-std::array<float,2>{0.59396565f, 0.878251135f},
-std::array<float,2>{0.448755056f, 0.409047306f},
-std::array<float,2>{0.848261952f, 0.113822825f},
-std::array<float,2>{0.115730427f, 0.524348497f},
-std::array<float,2>{0.992569268f, 0.831012964f},
-std::array<float,2>{0.181611463f, 0.340293944f},
-std::array<float,2>{0.627559066f, 0.162624866f},
-std::array<float,2>{0.276251107f, 0.629484355f},
-std::array<float,2>{0.5724985f, 0.505438745f},
-std::array<float,2>{0.492103249f, 0.105760954f},
-std::array<float,2>{0.835118115f, 0.432000965f},
-std::array<float,2>{0.0670010746f, 0.891923308f},
-std::array<float,2>{0.76666224f, 0.734948218f},
-std::array<float,2>{0.0263783615f, 0.236976445f},
-std::array<float,2>{0.503139436f, 0.286930799f},
-std::array<float,2>{0.413948268f, 0.778185487f},
-std::array<float,2>{0.742853105f, 0.985268354f},
-std::array<float,2>{0.344188899f, 0.480397463f},
-std::array<float,2>{0.886077762f, 0.00510293851f},
-std::array<float,2>{0.187929213f, 0.563325167f},
-std::array<float,2>{0.873021364f, 0.91598922f},
-std::array<float,2>{0.0951755121f, 0.399611354f},
-std::array<float,2>{0.615100861f, 0.0676195696f},
-std::array<float,2>{0.454556555f, 0.546551347f},
-std::array<float,2>{0.668903589f, 0.680791676f},
-std::array<float,2>{0.306513131f, 0.127726227f},
-std::array<float,2>{0.964924335f, 0.357773721f},
-std::array<float,2>{0.13259849f, 0.855393529f},
-std::array<float,2>{0.915745854f, 0.604680061f},
-std::array<float,2>{0.226565734f, 0.0393942185f},
-std::array<float,2>{0.693083405f, 0.467179775f},
-std::array<float,2>{0.337698042f, 0.961402595f},
-std::array<float,2>{0.539473355f, 0.782446027f},
-std::array<float,2>{0.400388628f, 0.260329664f},
-std::array<float,2>{0.798936486f, 0.214014202f},
-std::array<float,2>{0.0583790094f, 0.703393757f},
-std::array<float,2>{0.955676138f, 0.898448706f},
-std::array<float,2>{0.138303652f, 0.429436445f},
-std::array<float,2>{0.660263121f, 0.0980113223f},
-std::array<float,2>{0.299131006f, 0.512958705f},
-std::array<float,2>{0.624655485f, 0.637917399f},
-std::array<float,2>{0.466116965f, 0.168372601f},
-std::array<float,2>{0.860950351f, 0.333622009f},
-std::array<float,2>{0.104043528f, 0.839484453f},
-std::array<float,2>{0.809264123f, 0.576959372f},
-std::array<float,2>{0.0469171479f, 0.0115209492f},
-std::array<float,2>{0.53330642f, 0.474790424f},
-std::array<float,2>{0.396191984f, 0.998406887f},
-std::array<float,2>{0.696367562f, 0.768325269f},
-std::array<float,2>{0.333071917f, 0.296105206f},
-std::array<float,2>{0.911475122f, 0.246625066f},
-std::array<float,2>{0.225289583f, 0.743306816f},
-std::array<float,2>{0.838455617f, 0.846949756f},
-std::array<float,2>{0.0765065253f, 0.348775387f},
-std::array<float,2>{0.563038468f, 0.134744704f},
-std::array<float,2>{0.49517256f, 0.674785137f},
-std::array<float,2>{0.640351713f, 0.534388006f},
-std::array<float,2>{0.268246025f, 0.0773080438f},
-std::array<float,2>{0.98769331f, 0.396962643f},
-std::array<float,2>{0.172799513f, 0.913194478f},
-std::array<float,2>{0.875053346f, 0.712906659f},
-std::array<float,2>{0.198458835f, 0.205386892f},
-std::array<float,2>{0.735453248f, 0.251589656f},
-std::array<float,2>{0.353253692f, 0.792031765f},
-std::array<float,2>{0.511620045f, 0.954804897f},
-std::array<float,2>{0.420648664f, 0.456461161f},
-std::array<float,2>{0.777523577f, 0.0350271165f},
-std::array<float,2>{0.0218852311f, 0.595562756f},
-std::array<float,2>{0.921914458f, 0.809027314f},
-std::array<float,2>{0.24263142f, 0.272004396f},
-std::array<float,2>{0.714644551f, 0.200010046f},
-std::array<float,2>{0.315377831f, 0.699574292f},
-std::array<float,2>{0.561429858f, 0.613939524f},
-std::array<float,2>{0.389890134f, 0.0536657274f},
-std::array<float,2>{0.78498739f, 0.439089537f},
-std::array<float,2>{0.0354861021f, 0.947480559f},
-std::array<float,2>{0.854176939f, 0.668007553f},
-std::array<float,2>{0.117971607f, 0.148471475f},
-std::array<float,2>{0.608384371f, 0.369666517f},
-std::array<float,2>{0.440855712f, 0.865682006f},
-std::array<float,2>{0.687433362f, 0.933914483f},
-std::array<float,2>{0.296776682f, 0.378653944f},
-std::array<float,2>{0.944829404f, 0.0856013671f},
-std::array<float,2>{0.14330776f, 0.559929013f},
-std::array<float,2>{0.755064845f, 0.970436215f},
-std::array<float,2>{0.0080581801f, 0.496694952f},
-std::array<float,2>{0.528398573f, 0.0224731453f},
-std::array<float,2>{0.42351222f, 0.588172376f},
-std::array<float,2>{0.729173601f, 0.732767105f},
-std::array<float,2>{0.367282957f, 0.225575954f},
-std::array<float,2>{0.891155839f, 0.31078878f},
-std::array<float,2>{0.214052379f, 0.762268126f},
-std::array<float,2>{0.979646206f, 0.517896295f},
-std::array<float,2>{0.171790645f, 0.124372013f},
-std::array<float,2>{0.646510124f, 0.418007761f},
-std::array<float,2>{0.260909647f, 0.885777593f},
-std::array<float,2>{0.581132531f, 0.820761442f},
-std::array<float,2>{0.482998908f, 0.322147429f},
-std::array<float,2>{0.824958146f, 0.174307287f},
-std::array<float,2>{0.0931911394f, 0.646670103f},
-std::array<float,2>{0.948270738f, 0.960534632f},
-std::array<float,2>{0.151357785f, 0.459794253f},
-std::array<float,2>{0.67307359f, 0.0374967754f},
-std::array<float,2>{0.284587979f, 0.598477662f},
-std::array<float,2>{0.599161148f, 0.7161569f},
-std::array<float,2>{0.451936007f, 0.208091378f},
-std::array<float,2>{0.846907735f, 0.25409919f},
-std::array<float,2>{0.110650115f, 0.795530677f},
-std::array<float,2>{0.795975327f, 0.538316488f},
-std::array<float,2>{0.045858413f, 0.0714044794f},
-std::array<float,2>{0.547714949f, 0.394475698f},
-std::array<float,2>{0.381305307f, 0.906510293f},
-std::array<float,2>{0.709930539f, 0.848224521f},
-std::array<float,2>{0.322119832f, 0.346198291f},
-std::array<float,2>{0.932258368f, 0.139357418f},
-std::array<float,2>{0.234479666f, 0.678312778f},
-std::array<float,2>{0.812904119f, 0.771503687f},
-std::array<float,2>{0.0830549002f, 0.29016304f},
-std::array<float,2>{0.591208041f, 0.243886888f},
-std::array<float,2>{0.47178176f, 0.748345852f},
-std::array<float,2>{0.653226793f, 0.571874261f},
-std::array<float,2>{0.253492773f, 0.0121571003f},
-std::array<float,2>{0.974274516f, 0.469223201f},
-std::array<float,2>{0.158817276f, 0.994390726f},
-std::array<float,2>{0.901400506f, 0.633452654f},
-std::array<float,2>{0.20537363f, 0.167588741f},
-std::array<float,2>{0.720389545f, 0.331018388f},
-std::array<float,2>{0.360413939f, 0.842773378f},
-std::array<float,2>{0.52317369f, 0.903518736f},
-std::array<float,2>{0.435214877f, 0.424241751f},
-std::array<float,2>{0.759960473f, 0.0946898982f},
-std::array<float,2>{0.00503402157f, 0.508221209f},
-std::array<float,2>{0.920137584f, 0.82789129f},
-std::array<float,2>{0.232535601f, 0.325219244f},
-std::array<float,2>{0.690267444f, 0.178847373f},
-std::array<float,2>{0.341581047f, 0.641190648f},
-std::array<float,2>{0.544270396f, 0.5196262f},
-std::array<float,2>{0.405582279f, 0.117304824f},
-std::array<float,2>{0.800792217f, 0.416025013f},
-std::array<float,2>{0.0612209141f, 0.88997227f},
-std::array<float,2>{0.868166208f, 0.729660094f},
-std::array<float,2>{0.0983083323f, 0.219013378f},
-std::array<float,2>{0.611805975f, 0.305941641f},
-std::array<float,2>{0.459658086f, 0.759597778f},
-std::array<float,2>{0.665156305f, 0.973064363f},
-std::array<float,2>{0.309863448f, 0.495819837f},
-std::array<float,2>{0.961069584f, 0.0183476023f},
-std::array<float,2>{0.126649648f, 0.592230499f},
-std::array<float,2>{0.771921158f, 0.930993974f},
-std::array<float,2>{0.0291832779f, 0.379728258f},
-std::array<float,2>{0.505221486f, 0.0786223859f},
-std::array<float,2>{0.407950819f, 0.556451142f},
-std::array<float,2>{0.7497105f, 0.665711939f},
-std::array<float,2>{0.348601431f, 0.153393358f},
-std::array<float,2>{0.88738513f, 0.372773081f},
-std::array<float,2>{0.194457486f, 0.860081971f},
-std::array<float,2>{0.998081446f, 0.609967589f},
-std::array<float,2>{0.183986783f, 0.0498241745f},
-std::array<float,2>{0.63273865f, 0.442736298f},
-std::array<float,2>{0.279587924f, 0.952618122f},
-std::array<float,2>{0.574658334f, 0.805383384f},
-std::array<float,2>{0.487214386f, 0.267711669f},
-std::array<float,2>{0.829825819f, 0.19712536f},
-std::array<float,2>{0.0663331449f, 0.698833883f},
-std::array<float,2>{0.879303396f, 0.879539907f},
-std::array<float,2>{0.202229783f, 0.411918223f},
-std::array<float,2>{0.741821527f, 0.110948697f},
-std::array<float,2>{0.355642587f, 0.531029344f},
-std::array<float,2>{0.513079762f, 0.653895915f},
-std::array<float,2>{0.417934477f, 0.180048317f},
-std::array<float,2>{0.774830937f, 0.318340302f},
-std::array<float,2>{0.0179763418f, 0.817777038f},
-std::array<float,2>{0.843122065f, 0.584377885f},
-std::array<float,2>{0.0706236362f, 0.0236605927f},
-std::array<float,2>{0.567329884f, 0.486432314f},
-std::array<float,2>{0.498069137f, 0.976738572f},
-std::array<float,2>{0.635544777f, 0.753200591f},
-std::array<float,2>{0.271419913f, 0.301676661f},
-std::array<float,2>{0.991152585f, 0.227615431f},
-std::array<float,2>{0.178007424f, 0.722155929f},
-std::array<float,2>{0.807583988f, 0.870455265f},
-std::array<float,2>{0.0520015992f, 0.359438419f},
-std::array<float,2>{0.535751104f, 0.141343474f},
-std::array<float,2>{0.394140393f, 0.657799363f},
-std::array<float,2>{0.702980638f, 0.551137865f},
-std::array<float,2>{0.329398394f, 0.0879709423f},
-std::array<float,2>{0.909418941f, 0.390232503f},
-std::array<float,2>{0.221859127f, 0.92260474f},
-std::array<float,2>{0.959311664f, 0.694974482f},
-std::array<float,2>{0.13638261f, 0.193037152f},
-std::array<float,2>{0.658270478f, 0.277897865f},
-std::array<float,2>{0.30460602f, 0.801235139f},
-std::array<float,2>{0.620733976f, 0.943688989f},
-std::array<float,2>{0.461551249f, 0.451759368f},
-std::array<float,2>{0.86447084f, 0.0610425621f},
-std::array<float,2>{0.108700491f, 0.624014735f},
-std::array<float,2>{0.983628511f, 0.78805846f},
-std::array<float,2>{0.164429456f, 0.262455314f},
-std::array<float,2>{0.643436372f, 0.216697246f},
-std::array<float,2>{0.265058726f, 0.709372759f},
-std::array<float,2>{0.582920671f, 0.608873904f},
-std::array<float,2>{0.477396637f, 0.0447753519f},
-std::array<float,2>{0.82149142f, 0.461014181f},
-std::array<float,2>{0.0879443362f, 0.967823148f},
-std::array<float,2>{0.750014067f, 0.684243798f},
-std::array<float,2>{0.0145350583f, 0.130401596f},
-std::array<float,2>{0.52393055f, 0.355018675f},
-std::array<float,2>{0.426633537f, 0.856970191f},
-std::array<float,2>{0.733577371f, 0.919521809f},
-std::array<float,2>{0.374513358f, 0.403928757f},
-std::array<float,2>{0.895164609f, 0.0638779923f},
-std::array<float,2>{0.218065962f, 0.542856753f},
-std::array<float,2>{0.859094143f, 0.988653004f},
-std::array<float,2>{0.124473706f, 0.481349796f},
-std::array<float,2>{0.604652345f, 0.00121857726f},
-std::array<float,2>{0.442963272f, 0.569080651f},
-std::array<float,2>{0.683493197f, 0.738964319f},
-std::array<float,2>{0.289176494f, 0.240784347f},
-std::array<float,2>{0.93926084f, 0.284995377f},
-std::array<float,2>{0.147112027f, 0.774611592f},
-std::array<float,2>{0.92907387f, 0.501083434f},
-std::array<float,2>{0.249276638f, 0.103162877f},
-std::array<float,2>{0.715175807f, 0.436718196f},
-std::array<float,2>{0.317398071f, 0.894676924f},
-std::array<float,2>{0.556034505f, 0.833019018f},
-std::array<float,2>{0.38503176f, 0.338700354f},
-std::array<float,2>{0.787207425f, 0.159434199f},
-std::array<float,2>{0.0348960869f, 0.625051975f},
-std::array<float,2>{0.935633421f, 0.981437325f},
-std::array<float,2>{0.240805566f, 0.489596009f},
-std::array<float,2>{0.704947948f, 0.0285867099f},
-std::array<float,2>{0.324354798f, 0.579706013f},
-std::array<float,2>{0.554002464f, 0.724291861f},
-std::array<float,2>{0.378172547f, 0.230805561f},
-std::array<float,2>{0.789333284f, 0.299948484f},
-std::array<float,2>{0.0427445099f, 0.755253494f},
-std::array<float,2>{0.850762129f, 0.527209222f},
-std::array<float,2>{0.114719108f, 0.116962522f},
-std::array<float,2>{0.596690357f, 0.406605661f},
-std::array<float,2>{0.445592254f, 0.876579165f},
-std::array<float,2>{0.677198172f, 0.813930213f},
-std::array<float,2>{0.288453758f, 0.313830525f},
-std::array<float,2>{0.949323416f, 0.186796874f},
-std::array<float,2>{0.156058133f, 0.649775684f},
-std::array<float,2>{0.763535976f, 0.799881577f},
-std::array<float,2>{0.000333132921f, 0.274751842f},
-std::array<float,2>{0.51700294f, 0.19134815f},
-std::array<float,2>{0.432915628f, 0.689403951f},
-std::array<float,2>{0.724926174f, 0.617853761f},
-std::array<float,2>{0.363585532f, 0.0564664192f},
-std::array<float,2>{0.905784309f, 0.448066443f},
-std::array<float,2>{0.209540889f, 0.941243947f},
-std::array<float,2>{0.9718647f, 0.661406696f},
-std::array<float,2>{0.162957549f, 0.145991623f},
-std::array<float,2>{0.649906039f, 0.365674227f},
-std::array<float,2>{0.25477469f, 0.874042869f},
-std::array<float,2>{0.586497486f, 0.926101148f},
-std::array<float,2>{0.474852055f, 0.385139704f},
-std::array<float,2>{0.819968939f, 0.0916367918f},
-std::array<float,2>{0.0788172632f, 0.547828496f},
-std::array<float,2>{0.968479037f, 0.853184938f},
-std::array<float,2>{0.129510581f, 0.356054932f},
-std::array<float,2>{0.671660185f, 0.126439676f},
-std::array<float,2>{0.306945205f, 0.683435798f},
-std::array<float,2>{0.616635442f, 0.544745386f},
-std::array<float,2>{0.455496341f, 0.0701815784f},
-std::array<float,2>{0.874193013f, 0.401447594f},
-std::array<float,2>{0.096476987f, 0.916721523f},
-std::array<float,2>{0.797303319f, 0.705266058f},
-std::array<float,2>{0.0549279787f, 0.211148486f},
-std::array<float,2>{0.542127132f, 0.25902757f},
-std::array<float,2>{0.400465131f, 0.783252895f},
-std::array<float,2>{0.695049405f, 0.963668585f},
-std::array<float,2>{0.338996887f, 0.466124564f},
-std::array<float,2>{0.917704284f, 0.0422523469f},
-std::array<float,2>{0.230326325f, 0.60222733f},
-std::array<float,2>{0.832147956f, 0.893544972f},
-std::array<float,2>{0.0685626939f, 0.430074304f},
-std::array<float,2>{0.57152313f, 0.108659424f},
-std::array<float,2>{0.488437176f, 0.506312311f},
-std::array<float,2>{0.625680685f, 0.631543398f},
-std::array<float,2>{0.27426368f, 0.161325023f},
-std::array<float,2>{0.994720817f, 0.341942191f},
-std::array<float,2>{0.18303515f, 0.829476953f},
-std::array<float,2>{0.884222806f, 0.565522373f},
-std::array<float,2>{0.191078573f, 0.00646746112f},
-std::array<float,2>{0.744207501f, 0.477255464f},
-std::array<float,2>{0.346061349f, 0.986784577f},
-std::array<float,2>{0.500706851f, 0.780285954f},
-std::array<float,2>{0.410174042f, 0.288420051f},
-std::array<float,2>{0.768865883f, 0.234655485f},
-std::array<float,2>{0.0247084294f, 0.737064719f},
-std::array<float,2>{0.984896123f, 0.91151911f},
-std::array<float,2>{0.175441518f, 0.395830035f},
-std::array<float,2>{0.637314737f, 0.0751556531f},
-std::array<float,2>{0.26612705f, 0.53301537f},
-std::array<float,2>{0.564485073f, 0.67236805f},
-std::array<float,2>{0.492609411f, 0.13520062f},
-std::array<float,2>{0.836905897f, 0.350080669f},
-std::array<float,2>{0.0748901963f, 0.843774319f},
-std::array<float,2>{0.780998111f, 0.595926225f},
-std::array<float,2>{0.0212634522f, 0.032428205f},
-std::array<float,2>{0.509353638f, 0.454077691f},
-std::array<float,2>{0.419228733f, 0.956589401f},
-std::array<float,2>{0.737734616f, 0.79023546f},
-std::array<float,2>{0.354587823f, 0.253529578f},
-std::array<float,2>{0.877351165f, 0.204184055f},
-std::array<float,2>{0.196561277f, 0.711336672f},
-std::array<float,2>{0.861667097f, 0.836894929f},
-std::array<float,2>{0.102415442f, 0.333989888f},
-std::array<float,2>{0.622359395f, 0.171832502f},
-std::array<float,2>{0.46827057f, 0.640498102f},
-std::array<float,2>{0.663559079f, 0.514178455f},
-std::array<float,2>{0.298246026f, 0.10115508f},
-std::array<float,2>{0.954615653f, 0.42665872f},
-std::array<float,2>{0.139347792f, 0.901791871f},
-std::array<float,2>{0.914030612f, 0.744324982f},
-std::array<float,2>{0.224452034f, 0.249242112f},
-std::array<float,2>{0.697646201f, 0.294377834f},
-std::array<float,2>{0.335355341f, 0.766239762f},
-std::array<float,2>{0.531581998f, 0.996720076f},
-std::array<float,2>{0.397019625f, 0.473269343f},
-std::array<float,2>{0.810676813f, 0.00927552767f},
-std::array<float,2>{0.0500861667f, 0.574947f},
-std::array<float,2>{0.894361556f, 0.764750123f},
-std::array<float,2>{0.211138919f, 0.310010552f},
-std::array<float,2>{0.726671696f, 0.223587781f},
-std::array<float,2>{0.369652987f, 0.73208797f},
-std::array<float,2>{0.530129254f, 0.587413609f},
-std::array<float,2>{0.424082905f, 0.0211997237f},
-std::array<float,2>{0.756046772f, 0.498254448f},
-std::array<float,2>{0.010192764f, 0.971972525f},
-std::array<float,2>{0.827806592f, 0.644690275f},
-std::array<float,2>{0.0905786157f, 0.172486871f},
-std::array<float,2>{0.579381168f, 0.322985888f},
-std::array<float,2>{0.482353717f, 0.822638988f},
-std::array<float,2>{0.646282971f, 0.884392977f},
-std::array<float,2>{0.259671271f, 0.420237601f},
-std::array<float,2>{0.977177143f, 0.122063987f},
-std::array<float,2>{0.1690602f, 0.516275942f},
-std::array<float,2>{0.781322539f, 0.946153343f},
-std::array<float,2>{0.0375972316f, 0.440166354f},
-std::array<float,2>{0.560408235f, 0.0516852438f},
-std::array<float,2>{0.388102502f, 0.616082907f},
-std::array<float,2>{0.712627232f, 0.702266574f},
-std::array<float,2>{0.313586354f, 0.201548889f},
-std::array<float,2>{0.925620973f, 0.27015996f},
-std::array<float,2>{0.245586589f, 0.81094569f},
-std::array<float,2>{0.941635907f, 0.560665369f},
-std::array<float,2>{0.140873253f, 0.0824152678f},
-std::array<float,2>{0.684333324f, 0.375672162f},
-std::array<float,2>{0.293768108f, 0.936391354f},
-std::array<float,2>{0.606665313f, 0.863866925f},
-std::array<float,2>{0.437815279f, 0.367675155f},
-std::array<float,2>{0.852477551f, 0.152048364f},
-std::array<float,2>{0.119243339f, 0.671235144f},
-std::array<float,2>{0.981445312f, 0.968561828f},
-std::array<float,2>{0.167367384f, 0.461586028f},
-std::array<float,2>{0.641193688f, 0.044428736f},
-std::array<float,2>{0.262761563f, 0.609098911f},
-std::array<float,2>{0.584587514f, 0.709955692f},
-std::array<float,2>{0.479393125f, 0.216102287f},
-std::array<float,2>{0.82231319f, 0.261744946f},
-std::array<float,2>{0.0867479593f, 0.787417531f},
-std::array<float,2>{0.752386391f, 0.542321563f},
-std::array<float,2>{0.0133064389f, 0.0644202381f},
-std::array<float,2>{0.526570439f, 0.403427094f},
-std::array<float,2>{0.429371566f, 0.91923672f},
-std::array<float,2>{0.73093152f, 0.856904507f},
-std::array<float,2>{0.373005539f, 0.354562849f},
-std::array<float,2>{0.898372769f, 0.130348474f},
-std::array<float,2>{0.216315866f, 0.683607817f},
-std::array<float,2>{0.857255876f, 0.775090575f},
-std::array<float,2>{0.121816531f, 0.284297824f},
-std::array<float,2>{0.602721274f, 0.240616232f},
-std::array<float,2>{0.443603843f, 0.738495588f},
-std::array<float,2>{0.680187166f, 0.568424225f},
-std::array<float,2>{0.291804194f, 0.00154750992f},
-std::array<float,2>{0.940904737f, 0.480844498f},
-std::array<float,2>{0.145297617f, 0.989141703f},
-std::array<float,2>{0.927519321f, 0.625850797f},
-std::array<float,2>{0.247262523f, 0.160103366f},
-std::array<float,2>{0.718642175f, 0.338199079f},
-std::array<float,2>{0.319192529f, 0.833881795f},
-std::array<float,2>{0.557767451f, 0.895123959f},
-std::array<float,2>{0.384478241f, 0.437461644f},
-std::array<float,2>{0.786546767f, 0.102819979f},
-std::array<float,2>{0.0331370458f, 0.501721978f},
-std::array<float,2>{0.880946279f, 0.818040431f},
-std::array<float,2>{0.20053488f, 0.317491084f},
-std::array<float,2>{0.739361525f, 0.180232823f},
-std::array<float,2>{0.359094471f, 0.6535061f},
-std::array<float,2>{0.513901651f, 0.530755043f},
-std::array<float,2>{0.41520527f, 0.11045038f},
-std::array<float,2>{0.776049316f, 0.411415219f},
-std::array<float,2>{0.0156420879f, 0.878947616f},
-std::array<float,2>{0.840790153f, 0.722311437f},
-std::array<float,2>{0.0731087625f, 0.228470728f},
-std::array<float,2>{0.569945633f, 0.300931543f},
-std::array<float,2>{0.49794969f, 0.753435612f},
-std::array<float,2>{0.634524524f, 0.977459431f},
-std::array<float,2>{0.272533953f, 0.487289369f},
-std::array<float,2>{0.989330947f, 0.024118837f},
-std::array<float,2>{0.177193552f, 0.584514976f},
-std::array<float,2>{0.805560529f, 0.922036827f},
-std::array<float,2>{0.0545875579f, 0.389748096f},
-std::array<float,2>{0.53760314f, 0.0884288773f},
-std::array<float,2>{0.39112395f, 0.551491082f},
-std::array<float,2>{0.700005472f, 0.657354176f},
-std::array<float,2>{0.330351263f, 0.140906334f},
-std::array<float,2>{0.908133924f, 0.360013694f},
-std::array<float,2>{0.219233707f, 0.870988607f},
-std::array<float,2>{0.95820868f, 0.623177767f},
-std::array<float,2>{0.132906288f, 0.0608840026f},
-std::array<float,2>{0.657123744f, 0.45146063f},
-std::array<float,2>{0.302210093f, 0.943921804f},
-std::array<float,2>{0.617626309f, 0.801625669f},
-std::array<float,2>{0.464362681f, 0.277701974f},
-std::array<float,2>{0.865864813f, 0.192588165f},
-std::array<float,2>{0.107285224f, 0.694615602f},
-std::array<float,2>{0.919054031f, 0.890573621f},
-std::array<float,2>{0.230986103f, 0.41659525f},
-std::array<float,2>{0.688481271f, 0.118043505f},
-std::array<float,2>{0.341905475f, 0.520262837f},
-std::array<float,2>{0.545575798f, 0.641096234f},
-std::array<float,2>{0.402471542f, 0.179277152f},
-std::array<float,2>{0.8031075f, 0.32600522f},
-std::array<float,2>{0.0594210885f, 0.827448249f},
-std::array<float,2>{0.870591223f, 0.592663586f},
-std::array<float,2>{0.100243941f, 0.0179440454f},
-std::array<float,2>{0.611225605f, 0.495197415f},
-std::array<float,2>{0.458132714f, 0.973237336f},
-std::array<float,2>{0.66771549f, 0.75883472f},
-std::array<float,2>{0.310587287f, 0.306555778f},
-std::array<float,2>{0.963826895f, 0.219270185f},
-std::array<float,2>{0.128557697f, 0.730110407f},
-std::array<float,2>{0.771435559f, 0.859732807f},
-std::array<float,2>{0.0299349613f, 0.372089565f},
-std::array<float,2>{0.507644951f, 0.154270634f},
-std::array<float,2>{0.409291059f, 0.665183961f},
-std::array<float,2>{0.747087181f, 0.555917978f},
-std::array<float,2>{0.350255877f, 0.0785140172f},
-std::array<float,2>{0.890199959f, 0.379036963f},
-std::array<float,2>{0.191484734f, 0.931622922f},
-std::array<float,2>{0.997344136f, 0.698503494f},
-std::array<float,2>{0.186417624f, 0.196419537f},
-std::array<float,2>{0.630483866f, 0.268204927f},
-std::array<float,2>{0.278510004f, 0.804788053f},
-std::array<float,2>{0.57619971f, 0.952956676f},
-std::array<float,2>{0.484512806f, 0.443002462f},
-std::array<float,2>{0.831032395f, 0.0504204035f},
-std::array<float,2>{0.0625069886f, 0.609492779f},
-std::array<float,2>{0.94633764f, 0.79523021f},
-std::array<float,2>{0.150358781f, 0.25454849f},
-std::array<float,2>{0.67408973f, 0.208929673f},
-std::array<float,2>{0.282481343f, 0.716360629f},
-std::array<float,2>{0.600613713f, 0.598050892f},
-std::array<float,2>{0.450520605f, 0.0380384885f},
-std::array<float,2>{0.843783796f, 0.459119678f},
-std::array<float,2>{0.111918196f, 0.960086286f},
-std::array<float,2>{0.793548584f, 0.678031147f},
-std::array<float,2>{0.0445327237f, 0.138729885f},
-std::array<float,2>{0.549903274f, 0.345979124f},
-std::array<float,2>{0.379536331f, 0.847750485f},
-std::array<float,2>{0.708579004f, 0.907177627f},
-std::array<float,2>{0.322376758f, 0.39370206f},
-std::array<float,2>{0.930961788f, 0.072134003f},
-std::array<float,2>{0.237884551f, 0.539005101f},
-std::array<float,2>{0.814701438f, 0.994876981f},
-std::array<float,2>{0.0850792527f, 0.469262987f},
-std::array<float,2>{0.591975212f, 0.0126171624f},
-std::array<float,2>{0.470644891f, 0.571670115f},
-std::array<float,2>{0.655318677f, 0.748708665f},
-std::array<float,2>{0.251496941f, 0.243195638f},
-std::array<float,2>{0.975214601f, 0.290910423f},
-std::array<float,2>{0.157367378f, 0.772232115f},
-std::array<float,2>{0.900128782f, 0.508364975f},
-std::array<float,2>{0.204012319f, 0.0937777087f},
-std::array<float,2>{0.721955299f, 0.424625874f},
-std::array<float,2>{0.362027317f, 0.904276073f},
-std::array<float,2>{0.519999146f, 0.84193629f},
-std::array<float,2>{0.436481357f, 0.330403805f},
-std::array<float,2>{0.75817436f, 0.167241797f},
-std::array<float,2>{0.00660532387f, 0.633200288f},
-std::array<float,2>{0.890761793f, 0.972345531f},
-std::array<float,2>{0.214781597f, 0.49858892f},
-std::array<float,2>{0.72857815f, 0.0209349133f},
-std::array<float,2>{0.368051887f, 0.586941719f},
-std::array<float,2>{0.529033601f, 0.731459796f},
-std::array<float,2>{0.422927052f, 0.222672865f},
-std::array<float,2>{0.75541532f, 0.310342938f},
-std::array<float,2>{0.00852717552f, 0.765502274f},
-std::array<float,2>{0.824617326f, 0.515935063f},
-std::array<float,2>{0.093584463f, 0.121237934f},
-std::array<float,2>{0.581968069f, 0.42049548f},
-std::array<float,2>{0.482887745f, 0.884254873f},
-std::array<float,2>{0.647326469f, 0.823118925f},
-std::array<float,2>{0.261634409f, 0.322604299f},
-std::array<float,2>{0.980063617f, 0.172077358f},
-std::array<float,2>{0.171289623f, 0.645406425f},
-std::array<float,2>{0.784641623f, 0.811377168f},
-std::array<float,2>{0.0360043682f, 0.269610882f},
-std::array<float,2>{0.560807288f, 0.202098742f},
-std::array<float,2>{0.390620321f, 0.702976584f},
-std::array<float,2>{0.714044988f, 0.615531206f},
-std::array<float,2>{0.314691901f, 0.0509266108f},
-std::array<float,2>{0.922771215f, 0.439699978f},
-std::array<float,2>{0.242953375f, 0.945386231f},
-std::array<float,2>{0.94463408f, 0.671870649f},
-std::array<float,2>{0.142754734f, 0.151526138f},
-std::array<float,2>{0.686635554f, 0.367698193f},
-std::array<float,2>{0.296027988f, 0.86374557f},
-std::array<float,2>{0.607426047f, 0.935743093f},
-std::array<float,2>{0.441027641f, 0.375139296f},
-std::array<float,2>{0.853590965f, 0.0825411528f},
-std::array<float,2>{0.117189802f, 0.561165333f},
-std::array<float,2>{0.98781997f, 0.844316661f},
-std::array<float,2>{0.171884626f, 0.350345522f},
-std::array<float,2>{0.639864504f, 0.135565951f},
-std::array<float,2>{0.267954022f, 0.672094464f},
-std::array<float,2>{0.562823057f, 0.532497048f},
-std::array<float,2>{0.496093005f, 0.0742643103f},
-std::array<float,2>{0.837997258f, 0.396009356f},
-std::array<float,2>{0.0766861215f, 0.911721289f},
-std::array<float,2>{0.777840078f, 0.711630166f},
-std::array<float,2>{0.0221511871f, 0.205030382f},
-std::array<float,2>{0.510975361f, 0.253122419f},
-std::array<float,2>{0.420251906f, 0.790701389f},
-std::array<float,2>{0.736243904f, 0.956405044f},
-std::array<float,2>{0.353009552f, 0.453343391f},
-std::array<float,2>{0.875826061f, 0.033188913f},
-std::array<float,2>{0.198807508f, 0.596429944f},
-std::array<float,2>{0.860470474f, 0.902320683f},
-std::array<float,2>{0.103656366f, 0.425948292f},
-std::array<float,2>{0.624429882f, 0.100729071f},
-std::array<float,2>{0.466449231f, 0.513810158f},
-std::array<float,2>{0.660885751f, 0.639798045f},
-std::array<float,2>{0.299565494f, 0.170943931f},
-std::array<float,2>{0.955263913f, 0.334692508f},
-std::array<float,2>{0.137809157f, 0.836417973f},
-std::array<float,2>{0.912033975f, 0.574610174f},
-std::array<float,2>{0.224889964f, 0.00953136384f},
-std::array<float,2>{0.696839452f, 0.472825319f},
-std::array<float,2>{0.333578259f, 0.996365607f},
-std::array<float,2>{0.534053326f, 0.766008914f},
-std::array<float,2>{0.395641625f, 0.294680983f},
-std::array<float,2>{0.808846235f, 0.24965103f},
-std::array<float,2>{0.0477050394f, 0.74484086f},
-std::array<float,2>{0.965522766f, 0.916415632f},
-std::array<float,2>{0.132320553f, 0.402108431f},
-std::array<float,2>{0.668031991f, 0.0693425834f},
-std::array<float,2>{0.305777162f, 0.543988645f},
-std::array<float,2>{0.614370584f, 0.682664037f},
-std::array<float,2>{0.455054939f, 0.126804441f},
-std::array<float,2>{0.872478962f, 0.355598897f},
-std::array<float,2>{0.0955512673f, 0.852903664f},
-std::array<float,2>{0.799515009f, 0.601821959f},
-std::array<float,2>{0.0580055155f, 0.0426337868f},
-std::array<float,2>{0.539958715f, 0.466311365f},
-std::array<float,2>{0.399873525f, 0.962978899f},
-std::array<float,2>{0.692524314f, 0.783921659f},
-std::array<float,2>{0.337004811f, 0.259584129f},
-std::array<float,2>{0.915418923f, 0.211895451f},
-std::array<float,2>{0.227068216f, 0.705963194f},
-std::array<float,2>{0.835691154f, 0.829738319f},
-std::array<float,2>{0.0668089688f, 0.342732728f},
-std::array<float,2>{0.57304877f, 0.161791101f},
-std::array<float,2>{0.491613954f, 0.631263912f},
-std::array<float,2>{0.6271981f, 0.506712615f},
-std::array<float,2>{0.275809616f, 0.109200835f},
-std::array<float,2>{0.992734015f, 0.430528432f},
-std::array<float,2>{0.180754274f, 0.893037319f},
-std::array<float,2>{0.886702597f, 0.736380458f},
-std::array<float,2>{0.188465178f, 0.23513788f},
-std::array<float,2>{0.74242866f, 0.288864404f},
-std::array<float,2>{0.344260365f, 0.780841529f},
-std::array<float,2>{0.503685832f, 0.986947477f},
-std::array<float,2>{0.413529456f, 0.476795316f},
-std::array<float,2>{0.767091751f, 0.00587778585f},
-std::array<float,2>{0.0270799622f, 0.566206992f},
-std::array<float,2>{0.933684766f, 0.755450904f},
-std::array<float,2>{0.239925027f, 0.300294667f},
-std::array<float,2>{0.705546081f, 0.231253773f},
-std::array<float,2>{0.327687651f, 0.723918915f},
-std::array<float,2>{0.551513314f, 0.579482675f},
-std::array<float,2>{0.376529127f, 0.0291557126f},
-std::array<float,2>{0.792845666f, 0.490030348f},
-std::array<float,2>{0.0403406247f, 0.980684757f},
-std::array<float,2>{0.847945213f, 0.650109649f},
-std::array<float,2>{0.115611717f, 0.187143072f},
-std::array<float,2>{0.594539464f, 0.314180791f},
-std::array<float,2>{0.44856891f, 0.814152479f},
-std::array<float,2>{0.679609537f, 0.876290977f},
-std::array<float,2>{0.285931766f, 0.406976014f},
-std::array<float,2>{0.95289433f, 0.11645025f},
-std::array<float,2>{0.153882533f, 0.526711464f},
-std::array<float,2>{0.765241206f, 0.940730393f},
-std::array<float,2>{0.00252702879f, 0.447595716f},
-std::array<float,2>{0.5178895f, 0.0557639748f},
-std::array<float,2>{0.430853456f, 0.617369413f},
-std::array<float,2>{0.724474013f, 0.688816309f},
-std::array<float,2>{0.367016017f, 0.190597415f},
-std::array<float,2>{0.902722299f, 0.275062442f},
-std::array<float,2>{0.207242131f, 0.800726295f},
-std::array<float,2>{0.970279276f, 0.547128916f},
-std::array<float,2>{0.160454035f, 0.0908302665f},
-std::array<float,2>{0.650664926f, 0.385583878f},
-std::array<float,2>{0.256314427f, 0.926292539f},
-std::array<float,2>{0.587896645f, 0.874601185f},
-std::array<float,2>{0.473327279f, 0.365864903f},
-std::array<float,2>{0.816477835f, 0.146477729f},
-std::array<float,2>{0.0804016292f, 0.661919296f},
-std::array<float,2>{0.938768089f, 0.991074562f},
-std::array<float,2>{0.146566287f, 0.482712388f},
-std::array<float,2>{0.682953298f, 0.00233615446f},
-std::array<float,2>{0.289691061f, 0.567487836f},
-std::array<float,2>{0.6051386f, 0.74117434f},
-std::array<float,2>{0.442781746f, 0.238743305f},
-std::array<float,2>{0.85845387f, 0.282224685f},
-std::array<float,2>{0.124658018f, 0.77681613f},
-std::array<float,2>{0.787794292f, 0.50216645f},
-std::array<float,2>{0.0342823751f, 0.104232065f},
-std::array<float,2>{0.556561649f, 0.434917957f},
-std::array<float,2>{0.385489821f, 0.898407638f},
-std::array<float,2>{0.715582132f, 0.835613847f},
-std::array<float,2>{0.318150192f, 0.337503314f},
-std::array<float,2>{0.929322898f, 0.157818645f},
-std::array<float,2>{0.249855086f, 0.626997232f},
-std::array<float,2>{0.821892977f, 0.786991477f},
-std::array<float,2>{0.0883977264f, 0.264635056f},
-std::array<float,2>{0.582365513f, 0.217799678f},
-std::array<float,2>{0.476826221f, 0.707537174f},
-std::array<float,2>{0.643041134f, 0.607158601f},
-std::array<float,2>{0.26534301f, 0.0452676415f},
-std::array<float,2>{0.98406148f, 0.463916004f},
-std::array<float,2>{0.164776355f, 0.965938628f},
-std::array<float,2>{0.894638479f, 0.685797572f},
-std::array<float,2>{0.218564868f, 0.131857648f},
-std::array<float,2>{0.734053314f, 0.352079451f},
-std::array<float,2>{0.374305159f, 0.859126925f},
-std::array<float,2>{0.523460031f, 0.920001924f},
-std::array<float,2>{0.426052511f, 0.404379696f},
-std::array<float,2>{0.750855386f, 0.0655703172f},
-std::array<float,2>{0.0140929632f, 0.540300846f},
-std::array<float,2>{0.910022318f, 0.86888057f},
-std::array<float,2>{0.222316831f, 0.362855226f},
-std::array<float,2>{0.702532589f, 0.143957421f},
-std::array<float,2>{0.329614073f, 0.659818113f},
-std::array<float,2>{0.535439551f, 0.553910375f},
-std::array<float,2>{0.393766403f, 0.0862568542f},
-std::array<float,2>{0.806733847f, 0.388032049f},
-std::array<float,2>{0.0524407439f, 0.925150275f},
-std::array<float,2>{0.864821911f, 0.692156792f},
-std::array<float,2>{0.109039351f, 0.194849521f},
-std::array<float,2>{0.620380223f, 0.280304968f},
-std::array<float,2>{0.461103499f, 0.803415537f},
-std::array<float,2>{0.658860862f, 0.942562401f},
-std::array<float,2>{0.304119974f, 0.449403226f},
-std::array<float,2>{0.959914029f, 0.060305275f},
-std::array<float,2>{0.136052415f, 0.621775329f},
-std::array<float,2>{0.775066495f, 0.882091343f},
-std::array<float,2>{0.0180961769f, 0.412860841f},
-std::array<float,2>{0.513224542f, 0.11242868f},
-std::array<float,2>{0.417044789f, 0.527822733f},
-std::array<float,2>{0.741319299f, 0.65515554f},
-std::array<float,2>{0.356210053f, 0.182998583f},
-std::array<float,2>{0.879560709f, 0.318787605f},
-std::array<float,2>{0.20270665f, 0.819662869f},
-std::array<float,2>{0.990454316f, 0.582312167f},
-std::array<float,2>{0.1782711f, 0.0271910317f},
-std::array<float,2>{0.634989917f, 0.485762388f},
-std::array<float,2>{0.270734161f, 0.980216622f},
-std::array<float,2>{0.566508472f, 0.750410497f},
-std::array<float,2>{0.498699486f, 0.304531842f},
-std::array<float,2>{0.843317986f, 0.229500711f},
-std::array<float,2>{0.0708189011f, 0.719536424f},
-std::array<float,2>{0.886993885f, 0.932106793f},
-std::array<float,2>{0.195096284f, 0.38189435f},
-std::array<float,2>{0.749166012f, 0.080729425f},
-std::array<float,2>{0.34780395f, 0.556970775f},
-std::array<float,2>{0.505544901f, 0.66717124f},
-std::array<float,2>{0.407542378f, 0.154571161f},
-std::array<float,2>{0.772079945f, 0.374674827f},
-std::array<float,2>{0.0287514441f, 0.862018645f},
-std::array<float,2>{0.829283953f, 0.611996412f},
-std::array<float,2>{0.0655385777f, 0.047129795f},
-std::array<float,2>{0.574944079f, 0.443674177f},
-std::array<float,2>{0.486396879f, 0.950334609f},
-std::array<float,2>{0.631910205f, 0.807256758f},
-std::array<float,2>{0.28008154f, 0.266318709f},
-std::array<float,2>{0.99900192f, 0.198417291f},
-std::array<float,2>{0.184461147f, 0.696121156f},
-std::array<float,2>{0.801325202f, 0.82617116f},
-std::array<float,2>{0.0609311722f, 0.32649067f},
-std::array<float,2>{0.544799447f, 0.176465467f},
-std::array<float,2>{0.406211466f, 0.642692566f},
-std::array<float,2>{0.689758182f, 0.523419976f},
-std::array<float,2>{0.341145813f, 0.119911551f},
-std::array<float,2>{0.92088443f, 0.415467441f},
-std::array<float,2>{0.233377233f, 0.888295472f},
-std::array<float,2>{0.961811304f, 0.728473127f},
-std::array<float,2>{0.126009658f, 0.222315982f},
-std::array<float,2>{0.665819526f, 0.3076123f},
-std::array<float,2>{0.310448438f, 0.761618674f},
-std::array<float,2>{0.612301946f, 0.975696683f},
-std::array<float,2>{0.459213138f, 0.492417932f},
-std::array<float,2>{0.868921757f, 0.0162154734f},
-std::array<float,2>{0.0977146402f, 0.590551436f},
-std::array<float,2>{0.97401154f, 0.769789636f},
-std::array<float,2>{0.158498898f, 0.292244285f},
-std::array<float,2>{0.65234828f, 0.24579075f},
-std::array<float,2>{0.253238708f, 0.747919142f},
-std::array<float,2>{0.591548443f, 0.572466731f},
-std::array<float,2>{0.472326428f, 0.0152176963f},
-std::array<float,2>{0.813234746f, 0.47112605f},
-std::array<float,2>{0.0835520402f, 0.993218541f},
-std::array<float,2>{0.760407984f, 0.636248171f},
-std::array<float,2>{0.0058450331f, 0.164952949f},
-std::array<float,2>{0.522942662f, 0.329852074f},
-std::array<float,2>{0.434749544f, 0.839906514f},
-std::array<float,2>{0.72021383f, 0.906021535f},
-std::array<float,2>{0.361123055f, 0.423191965f},
-std::array<float,2>{0.902332962f, 0.097550638f},
-std::array<float,2>{0.205771416f, 0.509976387f},
-std::array<float,2>{0.847600758f, 0.958533049f},
-std::array<float,2>{0.110966288f, 0.457842082f},
-std::array<float,2>{0.599111617f, 0.0359789841f},
-std::array<float,2>{0.451644033f, 0.600430191f},
-std::array<float,2>{0.673370957f, 0.718592525f},
-std::array<float,2>{0.284941941f, 0.209746197f},
-std::array<float,2>{0.949111402f, 0.256390035f},
-std::array<float,2>{0.150553972f, 0.794694662f},
-std::array<float,2>{0.931907117f, 0.536664665f},
-std::array<float,2>{0.23500751f, 0.0741155967f},
-std::array<float,2>{0.709278047f, 0.390990913f},
-std::array<float,2>{0.321386427f, 0.909545839f},
-std::array<float,2>{0.547255695f, 0.850683987f},
-std::array<float,2>{0.381617606f, 0.344668359f},
-std::array<float,2>{0.796835303f, 0.137896389f},
-std::array<float,2>{0.045386076f, 0.675903022f},
-std::array<float,2>{0.924863577f, 0.948216915f},
-std::array<float,2>{0.245998964f, 0.438894778f},
-std::array<float,2>{0.712202072f, 0.0527389087f},
-std::array<float,2>{0.31440118f, 0.613648415f},
-std::array<float,2>{0.559956014f, 0.700184882f},
-std::array<float,2>{0.388223112f, 0.199487478f},
-std::array<float,2>{0.782064676f, 0.271513671f},
-std::array<float,2>{0.0377264805f, 0.809332669f},
-std::array<float,2>{0.851624787f, 0.560285389f},
-std::array<float,2>{0.120011531f, 0.0852274522f},
-std::array<float,2>{0.60713917f, 0.378002495f},
-std::array<float,2>{0.438356549f, 0.934448123f},
-std::array<float,2>{0.683785677f, 0.865766466f},
-std::array<float,2>{0.293328494f, 0.369384497f},
-std::array<float,2>{0.942379534f, 0.148943201f},
-std::array<float,2>{0.141427875f, 0.668697357f},
-std::array<float,2>{0.756539226f, 0.762031615f},
-std::array<float,2>{0.0103759784f, 0.311216891f},
-std::array<float,2>{0.529314399f, 0.22496593f},
-std::array<float,2>{0.424346536f, 0.733387053f},
-std::array<float,2>{0.727275908f, 0.588545322f},
-std::array<float,2>{0.369483858f, 0.0229554214f},
-std::array<float,2>{0.893749952f, 0.496541828f},
-std::array<float,2>{0.211629182f, 0.969929218f},
-std::array<float,2>{0.9770028f, 0.647191226f},
-std::array<float,2>{0.169460416f, 0.174365848f},
-std::array<float,2>{0.645745575f, 0.321676493f},
-std::array<float,2>{0.259039253f, 0.820947468f},
-std::array<float,2>{0.579845369f, 0.88641268f},
-std::array<float,2>{0.481737345f, 0.41893962f},
-std::array<float,2>{0.827481508f, 0.124985248f},
-std::array<float,2>{0.0901005715f, 0.518296301f},
-std::array<float,2>{0.954110801f, 0.839014292f},
-std::array<float,2>{0.138749242f, 0.333293706f},
-std::array<float,2>{0.663956344f, 0.168683141f},
-std::array<float,2>{0.298549235f, 0.638582408f},
-std::array<float,2>{0.623024523f, 0.513390243f},
-std::array<float,2>{0.468061656f, 0.0984255224f},
-std::array<float,2>{0.861901343f, 0.429021031f},
-std::array<float,2>{0.101892099f, 0.898955226f},
-std::array<float,2>{0.811330914f, 0.74372828f},
-std::array<float,2>{0.0503178388f, 0.246512651f},
-std::array<float,2>{0.532093644f, 0.296820074f},
-std::array<float,2>{0.396782577f, 0.768049657f},
-std::array<float,2>{0.698134542f, 0.999020815f},
-std::array<float,2>{0.335557699f, 0.475266397f},
-std::array<float,2>{0.913364828f, 0.0108987447f},
-std::array<float,2>{0.224002838f, 0.576593161f},
-std::array<float,2>{0.835995317f, 0.913957715f},
-std::array<float,2>{0.0744722858f, 0.39729315f},
-std::array<float,2>{0.565010786f, 0.0777850822f},
-std::array<float,2>{0.492715061f, 0.535139084f},
-std::array<float,2>{0.636862636f, 0.674237251f},
-std::array<float,2>{0.265827745f, 0.133862406f},
-std::array<float,2>{0.98466593f, 0.349199772f},
-std::array<float,2>{0.175086737f, 0.847212017f},
-std::array<float,2>{0.877468407f, 0.594899297f},
-std::array<float,2>{0.197167531f, 0.0342181139f},
-std::array<float,2>{0.737829328f, 0.45692578f},
-std::array<float,2>{0.355205864f, 0.954207897f},
-std::array<float,2>{0.509029031f, 0.792631209f},
-std::array<float,2>{0.419611782f, 0.251300573f},
-std::array<float,2>{0.780442595f, 0.205926508f},
-std::array<float,2>{0.0208235495f, 0.713559449f},
-std::array<float,2>{0.994506598f, 0.892480969f},
-std::array<float,2>{0.183378935f, 0.432322681f},
-std::array<float,2>{0.625455141f, 0.105996147f},
-std::array<float,2>{0.273597449f, 0.505190492f},
-std::array<float,2>{0.571901739f, 0.629043579f},
-std::array<float,2>{0.489037901f, 0.16254288f},
-std::array<float,2>{0.832693577f, 0.340705931f},
-std::array<float,2>{0.0693314299f, 0.830198467f},
-std::array<float,2>{0.769100308f, 0.562606037f},
-std::array<float,2>{0.0250821691f, 0.00576203363f},
-std::array<float,2>{0.50044328f, 0.479543f},
-std::array<float,2>{0.411094397f, 0.984389484f},
-std::array<float,2>{0.744921803f, 0.777592242f},
-std::array<float,2>{0.346466124f, 0.286571532f},
-std::array<float,2>{0.884679019f, 0.236631021f},
-std::array<float,2>{0.190806285f, 0.734388292f},
-std::array<float,2>{0.874946833f, 0.854631722f},
-std::array<float,2>{0.0961355492f, 0.358203709f},
-std::array<float,2>{0.616901577f, 0.127277657f},
-std::array<float,2>{0.456030399f, 0.681371093f},
-std::array<float,2>{0.670913339f, 0.546159446f},
-std::array<float,2>{0.307560772f, 0.068063125f},
-std::array<float,2>{0.968122244f, 0.400226831f},
-std::array<float,2>{0.129139751f, 0.915082216f},
-std::array<float,2>{0.917212129f, 0.704096973f},
-std::array<float,2>{0.229668617f, 0.214495674f},
-std::array<float,2>{0.694504976f, 0.259858519f},
-std::array<float,2>{0.33952406f, 0.782896698f},
-std::array<float,2>{0.542921305f, 0.961722612f},
-std::array<float,2>{0.401105881f, 0.467382312f},
-std::array<float,2>{0.797426164f, 0.0398909375f},
-std::array<float,2>{0.0553519577f, 0.605250955f},
-std::array<float,2>{0.905274153f, 0.797270477f},
-std::array<float,2>{0.209039032f, 0.276844382f},
-std::array<float,2>{0.725472033f, 0.187800586f},
-std::array<float,2>{0.36406824f, 0.689564347f},
-std::array<float,2>{0.517164648f, 0.620847166f},
-std::array<float,2>{0.433449298f, 0.0581601709f},
-std::array<float,2>{0.763088644f, 0.446616739f},
-std::array<float,2>{0.000710068329f, 0.938556612f},
-std::array<float,2>{0.819786966f, 0.662725866f},
-std::array<float,2>{0.0786087662f, 0.146640509f},
-std::array<float,2>{0.586158514f, 0.365202814f},
-std::array<float,2>{0.475573242f, 0.872748971f},
-std::array<float,2>{0.649457574f, 0.92814362f},
-std::array<float,2>{0.254105568f, 0.383077323f},
-std::array<float,2>{0.972370446f, 0.0934948325f},
-std::array<float,2>{0.162240535f, 0.549357891f},
-std::array<float,2>{0.789888203f, 0.98266989f},
-std::array<float,2>{0.0422246307f, 0.491714001f},
-std::array<float,2>{0.554241121f, 0.0306846295f},
-std::array<float,2>{0.378569722f, 0.581080198f},
-std::array<float,2>{0.704164803f, 0.724947274f},
-std::array<float,2>{0.324964106f, 0.234215707f},
-std::array<float,2>{0.936056733f, 0.298262447f},
-std::array<float,2>{0.24055028f, 0.757176459f},
-std::array<float,2>{0.949757278f, 0.523806691f},
-std::array<float,2>{0.155393198f, 0.113565527f},
-std::array<float,2>{0.677263796f, 0.408627361f},
-std::array<float,2>{0.288854003f, 0.878636897f},
-std::array<float,2>{0.597488701f, 0.815053046f},
-std::array<float,2>{0.446126491f, 0.315270334f},
-std::array<float,2>{0.85118252f, 0.185545266f},
-std::array<float,2>{0.114769556f, 0.651755571f},
-std::array<float,2>{0.988443255f, 0.978900671f},
-std::array<float,2>{0.176186293f, 0.484743923f},
-std::array<float,2>{0.633133233f, 0.0256019793f},
-std::array<float,2>{0.271675974f, 0.583025336f},
-std::array<float,2>{0.568735778f, 0.720476985f},
-std::array<float,2>{0.496593148f, 0.228562042f},
-std::array<float,2>{0.840970993f, 0.30340144f},
-std::array<float,2>{0.0737562403f, 0.751929998f},
-std::array<float,2>{0.776627123f, 0.528527856f},
-std::array<float,2>{0.0173118282f, 0.112232648f},
-std::array<float,2>{0.515600324f, 0.413298398f},
-std::array<float,2>{0.414813906f, 0.88133961f},
-std::array<float,2>{0.739165068f, 0.81871736f},
-std::array<float,2>{0.357509732f, 0.319456547f},
-std::array<float,2>{0.882316649f, 0.182373792f},
-std::array<float,2>{0.199767947f, 0.655823231f},
-std::array<float,2>{0.867046654f, 0.803741932f},
-std::array<float,2>{0.106384754f, 0.27968058f},
-std::array<float,2>{0.618302405f, 0.193491608f},
-std::array<float,2>{0.463436007f, 0.692778349f},
-std::array<float,2>{0.658022761f, 0.622475386f},
-std::array<float,2>{0.3008551f, 0.059391357f},
-std::array<float,2>{0.95734024f, 0.451166153f},
-std::array<float,2>{0.134534776f, 0.941647768f},
-std::array<float,2>{0.906344414f, 0.658336163f},
-std::array<float,2>{0.22024703f, 0.142769247f},
-std::array<float,2>{0.70044136f, 0.361526459f},
-std::array<float,2>{0.331389427f, 0.867693782f},
-std::array<float,2>{0.538183451f, 0.924373031f},
-std::array<float,2>{0.39188242f, 0.387096852f},
-std::array<float,2>{0.806546211f, 0.087728329f},
-std::array<float,2>{0.0529240109f, 0.553706706f},
-std::array<float,2>{0.897337198f, 0.858179152f},
-std::array<float,2>{0.215227216f, 0.353034258f},
-std::array<float,2>{0.731881499f, 0.131434396f},
-std::array<float,2>{0.371533304f, 0.686861098f},
-std::array<float,2>{0.525878727f, 0.539972425f},
-std::array<float,2>{0.428092092f, 0.0653018802f},
-std::array<float,2>{0.753651619f, 0.405489296f},
-std::array<float,2>{0.0117526306f, 0.921558559f},
-std::array<float,2>{0.823992372f, 0.708552957f},
-std::array<float,2>{0.087424852f, 0.217649207f},
-std::array<float,2>{0.585087955f, 0.265208781f},
-std::array<float,2>{0.480429202f, 0.7859115f},
-std::array<float,2>{0.641834319f, 0.96507138f},
-std::array<float,2>{0.26233992f, 0.463484496f},
-std::array<float,2>{0.980831146f, 0.0466828942f},
-std::array<float,2>{0.166420192f, 0.605634093f},
-std::array<float,2>{0.785405278f, 0.897035658f},
-std::array<float,2>{0.0312633812f, 0.433976263f},
-std::array<float,2>{0.557127059f, 0.10536775f},
-std::array<float,2>{0.383231521f, 0.503211915f},
-std::array<float,2>{0.717662334f, 0.628377795f},
-std::array<float,2>{0.319983155f, 0.156868219f},
-std::array<float,2>{0.92645812f, 0.335941166f},
-std::array<float,2>{0.24694328f, 0.834959507f},
-std::array<float,2>{0.939636528f, 0.567156851f},
-std::array<float,2>{0.145967275f, 0.00316760014f},
-std::array<float,2>{0.681159556f, 0.483433992f},
-std::array<float,2>{0.292652607f, 0.991630375f},
-std::array<float,2>{0.602515757f, 0.77571404f},
-std::array<float,2>{0.444958448f, 0.282879978f},
-std::array<float,2>{0.855503321f, 0.239944115f},
-std::array<float,2>{0.122129127f, 0.741467595f},
-std::array<float,2>{0.930447102f, 0.908300877f},
-std::array<float,2>{0.23642005f, 0.392251849f},
-std::array<float,2>{0.70798409f, 0.0728503689f},
-std::array<float,2>{0.323608369f, 0.535364926f},
-std::array<float,2>{0.549416959f, 0.677114308f},
-std::array<float,2>{0.380036116f, 0.13718304f},
-std::array<float,2>{0.794103146f, 0.34559527f},
-std::array<float,2>{0.0439174995f, 0.849865139f},
-std::array<float,2>{0.845702052f, 0.600770116f},
-std::array<float,2>{0.112833895f, 0.0366052687f},
-std::array<float,2>{0.600022733f, 0.458913803f},
-std::array<float,2>{0.449956179f, 0.957466125f},
-std::array<float,2>{0.675333858f, 0.793496251f},
-std::array<float,2>{0.282107711f, 0.257292479f},
-std::array<float,2>{0.946269929f, 0.210064724f},
-std::array<float,2>{0.148933962f, 0.716970742f},
-std::array<float,2>{0.759717941f, 0.8412956f},
-std::array<float,2>{0.00722012995f, 0.328878254f},
-std::array<float,2>{0.521002054f, 0.165751711f},
-std::array<float,2>{0.437376261f, 0.635656238f},
-std::array<float,2>{0.721407235f, 0.511561692f},
-std::array<float,2>{0.362977862f, 0.0958236307f},
-std::array<float,2>{0.898573756f, 0.422496915f},
-std::array<float,2>{0.204574078f, 0.904482663f},
-std::array<float,2>{0.976023138f, 0.746127009f},
-std::array<float,2>{0.156965077f, 0.244879678f},
-std::array<float,2>{0.655094802f, 0.291815728f},
-std::array<float,2>{0.250823259f, 0.770912528f},
-std::array<float,2>{0.593090236f, 0.992210507f},
-std::array<float,2>{0.469451398f, 0.471741289f},
-std::array<float,2>{0.815876663f, 0.0143142603f},
-std::array<float,2>{0.0844299942f, 0.573286414f},
-std::array<float,2>{0.96448344f, 0.760280609f},
-std::array<float,2>{0.127588391f, 0.307808101f},
-std::array<float,2>{0.666540444f, 0.221293524f},
-std::array<float,2>{0.311581761f, 0.726725221f},
-std::array<float,2>{0.60938108f, 0.590915382f},
-std::array<float,2>{0.457745194f, 0.0171170812f},
-std::array<float,2>{0.869936824f, 0.493324012f},
-std::array<float,2>{0.101234436f, 0.975331068f},
-std::array<float,2>{0.804575741f, 0.643797696f},
-std::array<float,2>{0.0597334392f, 0.177257612f},
-std::array<float,2>{0.546613216f, 0.328071564f},
-std::array<float,2>{0.403578043f, 0.825066507f},
-std::array<float,2>{0.687652946f, 0.886802197f},
-std::array<float,2>{0.343587101f, 0.414156288f},
-std::array<float,2>{0.918232322f, 0.120733604f},
-std::array<float,2>{0.231770977f, 0.521937013f},
-std::array<float,2>{0.831274331f, 0.94934082f},
-std::array<float,2>{0.0641940013f, 0.444434583f},
-std::array<float,2>{0.577761829f, 0.0485254414f},
-std::array<float,2>{0.485656738f, 0.612827241f},
-std::array<float,2>{0.629458964f, 0.696339965f},
-std::array<float,2>{0.278236121f, 0.197611764f},
-std::array<float,2>{0.997043073f, 0.267186582f},
-std::array<float,2>{0.186526477f, 0.808202922f},
-std::array<float,2>{0.888674676f, 0.5578565f},
-std::array<float,2>{0.192475289f, 0.0816547051f},
-std::array<float,2>{0.747065127f, 0.381596118f},
-std::array<float,2>{0.351519883f, 0.933451653f},
-std::array<float,2>{0.506376922f, 0.862760246f},
-std::array<float,2>{0.408296645f, 0.373298794f},
-std::array<float,2>{0.769785345f, 0.155346021f},
-std::array<float,2>{0.0304392297f, 0.666682303f},
-std::array<float,2>{0.876020968f, 0.953281283f},
-std::array<float,2>{0.197642475f, 0.455116928f},
-std::array<float,2>{0.734743237f, 0.0338087715f},
-std::array<float,2>{0.352227569f, 0.59376502f},
-std::array<float,2>{0.510532796f, 0.714755297f},
-std::array<float,2>{0.421580881f, 0.206636876f},
-std::array<float,2>{0.778332472f, 0.250355095f},
-std::array<float,2>{0.0225006957f, 0.79150331f},
-std::array<float,2>{0.839650154f, 0.533801854f},
-std::array<float,2>{0.0773421526f, 0.076314874f},
-std::array<float,2>{0.564026654f, 0.398110807f},
-std::array<float,2>{0.495087892f, 0.912404478f},
-std::array<float,2>{0.639601409f, 0.84581089f},
-std::array<float,2>{0.268782943f, 0.347735524f},
-std::array<float,2>{0.986393988f, 0.133441418f},
-std::array<float,2>{0.173606008f, 0.675575018f},
-std::array<float,2>{0.810396969f, 0.769527733f},
-std::array<float,2>{0.0480517708f, 0.295656532f},
-std::array<float,2>{0.534474134f, 0.247346207f},
-std::array<float,2>{0.394605875f, 0.742366195f},
-std::array<float,2>{0.695595086f, 0.577725828f},
-std::array<float,2>{0.332044989f, 0.0101834387f},
-std::array<float,2>{0.9110865f, 0.47597909f},
-std::array<float,2>{0.226117983f, 0.9997949f},
-std::array<float,2>{0.956896484f, 0.637278855f},
-std::array<float,2>{0.137304753f, 0.169084504f},
-std::array<float,2>{0.661396742f, 0.332439661f},
-std::array<float,2>{0.300545812f, 0.838528097f},
-std::array<float,2>{0.62323314f, 0.899636805f},
-std::array<float,2>{0.465160847f, 0.42798686f},
-std::array<float,2>{0.860185862f, 0.0995198488f},
-std::array<float,2>{0.105250321f, 0.511888504f},
-std::array<float,2>{0.979460895f, 0.821986794f},
-std::array<float,2>{0.170175686f, 0.320346117f},
-std::array<float,2>{0.64843452f, 0.17500031f},
-std::array<float,2>{0.26071164f, 0.64840287f},
-std::array<float,2>{0.580958605f, 0.518976927f},
-std::array<float,2>{0.484084189f, 0.123298556f},
-std::array<float,2>{0.82596463f, 0.419715941f},
-std::array<float,2>{0.0918526724f, 0.884960949f},
-std::array<float,2>{0.75486356f, 0.734347939f},
-std::array<float,2>{0.00923751201f, 0.226136297f},
-std::array<float,2>{0.52746135f, 0.312025517f},
-std::array<float,2>{0.422026545f, 0.763013601f},
-std::array<float,2>{0.729739785f, 0.968968391f},
-std::array<float,2>{0.368177235f, 0.498014212f},
-std::array<float,2>{0.892246068f, 0.0216652676f},
-std::array<float,2>{0.213417292f, 0.589703143f},
-std::array<float,2>{0.855430365f, 0.935231626f},
-std::array<float,2>{0.118481979f, 0.377636105f},
-std::array<float,2>{0.609371424f, 0.0841524079f},
-std::array<float,2>{0.439715117f, 0.559563994f},
-std::array<float,2>{0.686070025f, 0.669024587f},
-std::array<float,2>{0.294974774f, 0.149661377f},
-std::array<float,2>{0.943461359f, 0.370185673f},
-std::array<float,2>{0.143889248f, 0.866448283f},
-std::array<float,2>{0.923792064f, 0.614646018f},
-std::array<float,2>{0.243635386f, 0.0537806079f},
-std::array<float,2>{0.713715911f, 0.438042104f},
-std::array<float,2>{0.315782398f, 0.948333383f},
-std::array<float,2>{0.561865568f, 0.809808731f},
-std::array<float,2>{0.388887107f, 0.273263067f},
-std::array<float,2>{0.784118176f, 0.200510159f},
-std::array<float,2>{0.0367652141f, 0.700528681f},
-std::array<float,2>{0.951511562f, 0.877811611f},
-std::array<float,2>{0.152528405f, 0.409213006f},
-std::array<float,2>{0.678505778f, 0.114513442f},
-std::array<float,2>{0.286957085f, 0.524752855f},
-std::array<float,2>{0.595006466f, 0.650598586f},
-std::array<float,2>{0.447464734f, 0.184297428f},
-std::array<float,2>{0.848936498f, 0.315909743f},
-std::array<float,2>{0.11666473f, 0.816007674f},
-std::array<float,2>{0.791817844f, 0.580347896f},
-std::array<float,2>{0.0390932895f, 0.0299454331f},
-std::array<float,2>{0.552268445f, 0.491019577f},
-std::array<float,2>{0.375275791f, 0.983709335f},
-std::array<float,2>{0.706665039f, 0.755931377f},
-std::array<float,2>{0.326787263f, 0.297716677f},
-std::array<float,2>{0.935094655f, 0.233122095f},
-std::array<float,2>{0.23897326f, 0.726246119f},
-std::array<float,2>{0.818220973f, 0.871285319f},
-std::array<float,2>{0.0815253556f, 0.363970309f},
-std::array<float,2>{0.589700222f, 0.147813573f},
-std::array<float,2>{0.473894209f, 0.663827062f},
-std::array<float,2>{0.651520193f, 0.550725758f},
-std::array<float,2>{0.257735938f, 0.0918684155f},
-std::array<float,2>{0.969444811f, 0.384417355f},
-std::array<float,2>{0.161552235f, 0.92943877f},
-std::array<float,2>{0.903372765f, 0.691306889f},
-std::array<float,2>{0.20888485f, 0.188836381f},
-std::array<float,2>{0.722795844f, 0.275713742f},
-std::array<float,2>{0.365585953f, 0.798390985f},
-std::array<float,2>{0.519118786f, 0.937734842f},
-std::array<float,2>{0.430573016f, 0.446115971f},
-std::array<float,2>{0.764281154f, 0.0567293949f},
-std::array<float,2>{0.00383862271f, 0.619700909f},
-std::array<float,2>{0.914953291f, 0.781561196f},
-std::array<float,2>{0.227848321f, 0.261461198f},
-std::array<float,2>{0.691414595f, 0.213652268f},
-std::array<float,2>{0.336409986f, 0.704614758f},
-std::array<float,2>{0.540060222f, 0.604418159f},
-std::array<float,2>{0.399002254f, 0.0400502346f},
-std::array<float,2>{0.800004303f, 0.468305618f},
-std::array<float,2>{0.0575974546f, 0.962889791f},
-std::array<float,2>{0.8719666f, 0.680133045f},
-std::array<float,2>{0.094464615f, 0.128642589f},
-std::array<float,2>{0.613626719f, 0.359116346f},
-std::array<float,2>{0.453397661f, 0.854215026f},
-std::array<float,2>{0.669107854f, 0.914831638f},
-std::array<float,2>{0.305302024f, 0.399132729f},
-std::array<float,2>{0.965823174f, 0.0666107163f},
-std::array<float,2>{0.131658018f, 0.545469403f},
-std::array<float,2>{0.766105056f, 0.98578161f},
-std::array<float,2>{0.0260125566f, 0.479405224f},
-std::array<float,2>{0.502695739f, 0.00471816072f},
-std::array<float,2>{0.413026154f, 0.563918591f},
-std::array<float,2>{0.743331552f, 0.736096799f},
-std::array<float,2>{0.345103264f, 0.237648278f},
-std::array<float,2>{0.885017335f, 0.285594761f},
-std::array<float,2>{0.189319968f, 0.778552294f},
-std::array<float,2>{0.993358314f, 0.504781008f},
-std::array<float,2>{0.179927617f, 0.10735973f},
-std::array<float,2>{0.62880522f, 0.433541119f},
-std::array<float,2>{0.276706725f, 0.891561031f},
-std::array<float,2>{0.573764622f, 0.831925631f},
-std::array<float,2>{0.49099645f, 0.341335416f},
-std::array<float,2>{0.834817946f, 0.163388699f},
-std::array<float,2>{0.0677749738f, 0.630618691f},
-std::array<float,2>{0.960308909f, 0.944863439f},
-std::array<float,2>{0.135439396f, 0.452747077f},
-std::array<float,2>{0.659839094f, 0.0615432747f},
-std::array<float,2>{0.302841991f, 0.624773502f},
-std::array<float,2>{0.619975567f, 0.693616152f},
-std::array<float,2>{0.462753564f, 0.192365795f},
-std::array<float,2>{0.863964915f, 0.278627157f},
-std::array<float,2>{0.108258583f, 0.802508235f},
-std::array<float,2>{0.807649553f, 0.552147448f},
-std::array<float,2>{0.051126875f, 0.0897697508f},
-std::array<float,2>{0.536981046f, 0.388737231f},
-std::array<float,2>{0.393151164f, 0.923827946f},
-std::array<float,2>{0.702067137f, 0.869718254f},
-std::array<float,2>{0.328371882f, 0.361092299f},
-std::array<float,2>{0.908222198f, 0.142569214f},
-std::array<float,2>{0.220780984f, 0.656787276f},
-std::array<float,2>{0.842029512f, 0.752773046f},
-std::array<float,2>{0.0722242743f, 0.301893234f},
-std::array<float,2>{0.568296492f, 0.226674601f},
-std::array<float,2>{0.499346018f, 0.720809758f},
-std::array<float,2>{0.635810554f, 0.585609496f},
-std::array<float,2>{0.270191967f, 0.024951851f},
-std::array<float,2>{0.991723955f, 0.487374067f},
-std::array<float,2>{0.178822711f, 0.977926075f},
-std::array<float,2>{0.880326092f, 0.653194129f},
-std::array<float,2>{0.201731801f, 0.181489229f},
-std::array<float,2>{0.740691483f, 0.317179203f},
-std::array<float,2>{0.356637895f, 0.817170441f},
-std::array<float,2>{0.512085259f, 0.88036561f},
-std::array<float,2>{0.416617334f, 0.411021411f},
-std::array<float,2>{0.774301112f, 0.109384619f},
-std::array<float,2>{0.0192293562f, 0.529585004f},
-std::array<float,2>{0.927886307f, 0.832884967f},
-std::array<float,2>{0.248121023f, 0.33898297f},
-std::array<float,2>{0.716174364f, 0.159150437f},
-std::array<float,2>{0.316636026f, 0.626251817f},
-std::array<float,2>{0.55540067f, 0.500835538f},
-std::array<float,2>{0.386670202f, 0.102275148f},
-std::array<float,2>{0.788354456f, 0.436284482f},
-std::array<float,2>{0.0334996507f, 0.89641422f},
-std::array<float,2>{0.857944667f, 0.739705801f},
-std::array<float,2>{0.12347874f, 0.241280377f},
-std::array<float,2>{0.603869975f, 0.283206075f},
-std::array<float,2>{0.442180663f, 0.773488402f},
-std::array<float,2>{0.682402968f, 0.989316225f},
-std::array<float,2>{0.290754288f, 0.481548905f},
-std::array<float,2>{0.937875032f, 0.000178430841f},
-std::array<float,2>{0.147825286f, 0.569563806f},
-std::array<float,2>{0.751368463f, 0.918441832f},
-std::array<float,2>{0.0152865797f, 0.403134793f},
-std::array<float,2>{0.524678588f, 0.0625584573f},
-std::array<float,2>{0.426811397f, 0.541643798f},
-std::array<float,2>{0.732632339f, 0.685319304f},
-std::array<float,2>{0.373705417f, 0.129880503f},
-std::array<float,2>{0.89640379f, 0.354380786f},
-std::array<float,2>{0.2176525f, 0.85594213f},
-std::array<float,2>{0.983141303f, 0.607856214f},
-std::array<float,2>{0.165752843f, 0.0435844585f},
-std::array<float,2>{0.644006014f, 0.462596476f},
-std::array<float,2>{0.263808489f, 0.967299104f},
-std::array<float,2>{0.583536208f, 0.788728833f},
-std::array<float,2>{0.478431374f, 0.263299227f},
-std::array<float,2>{0.820988774f, 0.215153873f},
-std::array<float,2>{0.0898240134f, 0.710036278f},
-std::array<float,2>{0.900606811f, 0.902953088f},
-std::array<float,2>{0.206266165f, 0.42523548f},
-std::array<float,2>{0.718758047f, 0.0951489434f},
-std::array<float,2>{0.360307902f, 0.509339571f},
-std::array<float,2>{0.52219522f, 0.634070992f},
-std::array<float,2>{0.434473068f, 0.166284323f},
-std::array<float,2>{0.76076293f, 0.331461847f},
-std::array<float,2>{0.00470140157f, 0.843223035f},
-std::array<float,2>{0.814010441f, 0.571010649f},
-std::array<float,2>{0.0827789456f, 0.0128610162f},
-std::array<float,2>{0.590548158f, 0.470173448f},
-std::array<float,2>{0.47127822f, 0.996074736f},
-std::array<float,2>{0.654054105f, 0.773186922f},
-std::array<float,2>{0.252435684f, 0.289582342f},
-std::array<float,2>{0.973164499f, 0.24292013f},
-std::array<float,2>{0.159650326f, 0.749901354f},
-std::array<float,2>{0.79540813f, 0.849229038f},
-std::array<float,2>{0.0461376645f, 0.346904457f},
-std::array<float,2>{0.548247337f, 0.140225694f},
-std::array<float,2>{0.381991178f, 0.679422319f},
-std::array<float,2>{0.710158885f, 0.537941277f},
-std::array<float,2>{0.320930332f, 0.0710309669f},
-std::array<float,2>{0.933064222f, 0.393042594f},
-std::array<float,2>{0.235984206f, 0.907260656f},
-std::array<float,2>{0.947401226f, 0.715181172f},
-std::array<float,2>{0.15226163f, 0.207552493f},
-std::array<float,2>{0.67238009f, 0.255595744f},
-std::array<float,2>{0.283423871f, 0.796049595f},
-std::array<float,2>{0.59770906f, 0.959072828f},
-std::array<float,2>{0.452371389f, 0.460267901f},
-std::array<float,2>{0.846360564f, 0.038089823f},
-std::array<float,2>{0.109524406f, 0.598851621f},
-std::array<float,2>{0.999055922f, 0.805813015f},
-std::array<float,2>{0.185179994f, 0.269092649f},
-std::array<float,2>{0.63143754f, 0.195896879f},
-std::array<float,2>{0.2803303f, 0.697447836f},
-std::array<float,2>{0.575356185f, 0.610422313f},
-std::array<float,2>{0.488067955f, 0.0488770492f},
-std::array<float,2>{0.828523636f, 0.441446304f},
-std::array<float,2>{0.0651346445f, 0.951969087f},
-std::array<float,2>{0.772878826f, 0.664843142f},
-std::array<float,2>{0.0274481531f, 0.152868837f},
-std::array<float,2>{0.504524767f, 0.371759951f},
-std::array<float,2>{0.406979054f, 0.860528708f},
-std::array<float,2>{0.748902142f, 0.930295229f},
-std::array<float,2>{0.349057645f, 0.380816936f},
-std::array<float,2>{0.888562381f, 0.0800548792f},
-std::array<float,2>{0.1942292f, 0.554812849f},
-std::array<float,2>{0.867311537f, 0.974051833f},
-std::array<float,2>{0.0995222926f, 0.494273543f},
-std::array<float,2>{0.612857699f, 0.018662326f},
-std::array<float,2>{0.460561782f, 0.593133569f},
-std::array<float,2>{0.664083779f, 0.728822291f},
-std::array<float,2>{0.309078306f, 0.220273346f},
-std::array<float,2>{0.962883353f, 0.304889917f},
-std::array<float,2>{0.125760019f, 0.75874579f},
-std::array<float,2>{0.921230912f, 0.521405399f},
-std::array<float,2>{0.233568475f, 0.119085453f},
-std::array<float,2>{0.690589845f, 0.417645067f},
-std::array<float,2>{0.340617478f, 0.889443696f},
-std::array<float,2>{0.543354273f, 0.827036321f},
-std::array<float,2>{0.404419124f, 0.324264348f},
-std::array<float,2>{0.802548051f, 0.178453565f},
-std::array<float,2>{0.061600443f, 0.642297089f},
-std::array<float,2>{0.912745357f, 0.997185349f},
-std::array<float,2>{0.222658679f, 0.474371612f},
-std::array<float,2>{0.698503196f, 0.00837476458f},
-std::array<float,2>{0.33405593f, 0.575379074f},
-std::array<float,2>{0.532348454f, 0.745446324f},
-std::array<float,2>{0.398421973f, 0.248257816f},
-std::array<float,2>{0.812398911f, 0.293150783f},
-std::array<float,2>{0.0492521189f, 0.766831398f},
-std::array<float,2>{0.863279462f, 0.515070498f},
-std::array<float,2>{0.103422396f, 0.100404069f},
-std::array<float,2>{0.621801138f, 0.427249968f},
-std::array<float,2>{0.467003316f, 0.901153445f},
-std::array<float,2>{0.662955523f, 0.837200999f},
-std::array<float,2>{0.297632009f, 0.335103631f},
-std::array<float,2>{0.95371449f, 0.170851126f},
-std::array<float,2>{0.139899164f, 0.63924706f},
-std::array<float,2>{0.779434979f, 0.789407134f},
-std::array<float,2>{0.0201013125f, 0.252559125f},
-std::array<float,2>{0.508267939f, 0.204007849f},
-std::array<float,2>{0.418757707f, 0.712889194f},
-std::array<float,2>{0.736349404f, 0.597139895f},
-std::array<float,2>{0.353524625f, 0.0315856747f},
-std::array<float,2>{0.878513575f, 0.454765111f},
-std::array<float,2>{0.195427656f, 0.955289841f},
-std::array<float,2>{0.98582828f, 0.673072338f},
-std::array<float,2>{0.174784705f, 0.136695817f},
-std::array<float,2>{0.638297677f, 0.350842714f},
-std::array<float,2>{0.266944945f, 0.845627666f},
-std::array<float,2>{0.566398382f, 0.910380483f},
-std::array<float,2>{0.49346742f, 0.395421028f},
-std::array<float,2>{0.837221742f, 0.0761066973f},
-std::array<float,2>{0.0758774951f, 0.531812727f},
-std::array<float,2>{0.942629755f, 0.86429584f},
-std::array<float,2>{0.142034888f, 0.368742913f},
-std::array<float,2>{0.685453296f, 0.150839269f},
-std::array<float,2>{0.294245422f, 0.670005679f},
-std::array<float,2>{0.605632365f, 0.561658382f},
-std::array<float,2>{0.438929439f, 0.0836255923f},
-std::array<float,2>{0.853340089f, 0.37599799f},
-std::array<float,2>{0.121042229f, 0.936808527f},
-std::array<float,2>{0.782854736f, 0.702016413f},
-std::array<float,2>{0.0389505588f, 0.202896401f},
-std::array<float,2>{0.559123456f, 0.270636886f},
-std::array<float,2>{0.38683641f, 0.811947644f},
-std::array<float,2>{0.711766064f, 0.946628869f},
-std::array<float,2>{0.31320399f, 0.441354901f},
-std::array<float,2>{0.924429417f, 0.0522583425f},
-std::array<float,2>{0.244329482f, 0.616350293f},
-std::array<float,2>{0.826253891f, 0.883383989f},
-std::array<float,2>{0.0908747539f, 0.421665967f},
-std::array<float,2>{0.578423798f, 0.12294846f},
-std::array<float,2>{0.481372267f, 0.516955972f},
-std::array<float,2>{0.644794762f, 0.646208644f},
-std::array<float,2>{0.258356482f, 0.173476145f},
-std::array<float,2>{0.978053153f, 0.32366392f},
-std::array<float,2>{0.168065935f, 0.823481023f},
-std::array<float,2>{0.892661572f, 0.586701334f},
-std::array<float,2>{0.212447345f, 0.0203080513f},
-std::array<float,2>{0.727770388f, 0.499042004f},
-std::array<float,2>{0.370342016f, 0.971580386f},
-std::array<float,2>{0.530850947f, 0.763949871f},
-std::array<float,2>{0.424916834f, 0.308950812f},
-std::array<float,2>{0.757038891f, 0.224466145f},
-std::array<float,2>{0.0108848512f, 0.731411636f},
-std::array<float,2>{0.970768213f, 0.92684108f},
-std::array<float,2>{0.163360313f, 0.386444807f},
-std::array<float,2>{0.649174333f, 0.0907081887f},
-std::array<float,2>{0.255354971f, 0.548645794f},
-std::array<float,2>{0.587695837f, 0.660557747f},
-std::array<float,2>{0.475835592f, 0.144862011f},
-std::array<float,2>{0.818943143f, 0.366738588f},
-std::array<float,2>{0.0794252753f, 0.873151779f},
-std::array<float,2>{0.762354255f, 0.619051874f},
-std::array<float,2>{0.00193526736f, 0.0554702915f},
-std::array<float,2>{0.51564151f, 0.448910058f},
-std::array<float,2>{0.432195634f, 0.939965069f},
-std::array<float,2>{0.726261795f, 0.799078524f},
-std::array<float,2>{0.36477229f, 0.273703635f},
-std::array<float,2>{0.904755175f, 0.189954624f},
-std::array<float,2>{0.210430175f, 0.687761784f},
-std::array<float,2>{0.850364983f, 0.812830508f},
-std::array<float,2>{0.113461927f, 0.313331991f},
-std::array<float,2>{0.596638978f, 0.18602626f},
-std::array<float,2>{0.446824044f, 0.649172544f},
-std::array<float,2>{0.67673701f, 0.526313961f},
-std::array<float,2>{0.287773818f, 0.115888029f},
-std::array<float,2>{0.950442255f, 0.407328427f},
-std::array<float,2>{0.154664725f, 0.875189662f},
-std::array<float,2>{0.936801255f, 0.723094285f},
-std::array<float,2>{0.242006823f, 0.231510445f},
-std::array<float,2>{0.704019964f, 0.29971227f},
-std::array<float,2>{0.325281471f, 0.754338324f},
-std::array<float,2>{0.553551376f, 0.98199898f},
-std::array<float,2>{0.377047062f, 0.488622934f},
-std::array<float,2>{0.790669203f, 0.0275883023f},
-std::array<float,2>{0.0412229188f, 0.578202009f},
-std::array<float,2>{0.883729994f, 0.780101895f},
-std::array<float,2>{0.190383136f, 0.288043112f},
-std::array<float,2>{0.74583298f, 0.23611936f},
-std::array<float,2>{0.347461432f, 0.738247573f},
-std::array<float,2>{0.501910031f, 0.564971209f},
-std::array<float,2>{0.411825806f, 0.0077197901f},
-std::array<float,2>{0.767963827f, 0.478503793f},
-std::array<float,2>{0.0243515614f, 0.987586081f},
-std::array<float,2>{0.833308041f, 0.631992698f},
-std::array<float,2>{0.0701659396f, 0.160263345f},
-std::array<float,2>{0.570910931f, 0.343591064f},
-std::array<float,2>{0.490033865f, 0.828810096f},
-std::array<float,2>{0.626650929f, 0.894187093f},
-std::array<float,2>{0.274970442f, 0.431437075f},
-std::array<float,2>{0.996052802f, 0.108090736f},
-std::array<float,2>{0.182446092f, 0.507312357f},
-std::array<float,2>{0.798414528f, 0.964023054f},
-std::array<float,2>{0.0558096841f, 0.465442032f},
-std::array<float,2>{0.541480482f, 0.0416926481f},
-std::array<float,2>{0.401977509f, 0.603045583f},
-std::array<float,2>{0.694223881f, 0.706615806f},
-std::array<float,2>{0.338540196f, 0.212616414f},
-std::array<float,2>{0.916690409f, 0.258700222f},
-std::array<float,2>{0.229372531f, 0.784360468f},
-std::array<float,2>{0.966895878f, 0.543540418f},
-std::array<float,2>{0.130672872f, 0.0688664764f},
-std::array<float,2>{0.670240104f, 0.400402784f},
-std::array<float,2>{0.307871044f, 0.917721987f},
-std::array<float,2>{0.615498781f, 0.851865888f},
-std::array<float,2>{0.45642367f, 0.356628627f},
-std::array<float,2>{0.873961627f, 0.125440016f},
-std::array<float,2>{0.0972410142f, 0.682345033f},
-std::array<float,2>{0.986726224f, 0.956822515f},
-std::array<float,2>{0.17339617f, 0.453748941f},
-std::array<float,2>{0.639303148f, 0.032561399f},
-std::array<float,2>{0.26887235f, 0.596065879f},
-std::array<float,2>{0.564413011f, 0.710953772f},
-std::array<float,2>{0.494806141f, 0.204483315f},
-std::array<float,2>{0.839550376f, 0.253864229f},
-std::array<float,2>{0.0776206404f, 0.790285051f},
-std::array<float,2>{0.778700531f, 0.532942474f},
-std::array<float,2>{0.02276255f, 0.0747535452f},
-std::array<float,2>{0.510464966f, 0.395552635f},
-std::array<float,2>{0.421751052f, 0.911311269f},
-std::array<float,2>{0.734582484f, 0.844157636f},
-std::array<float,2>{0.352307826f, 0.349655509f},
-std::array<float,2>{0.876395881f, 0.134875655f},
-std::array<float,2>{0.197278529f, 0.672820449f},
-std::array<float,2>{0.860067308f, 0.766451359f},
-std::array<float,2>{0.105114087f, 0.294005275f},
-std::array<float,2>{0.623433769f, 0.249432087f},
-std::array<float,2>{0.465034813f, 0.744588494f},
-std::array<float,2>{0.661189377f, 0.575099528f},
-std::array<float,2>{0.300325334f, 0.00890087988f},
-std::array<float,2>{0.956587672f, 0.473587304f},
-std::array<float,2>{0.137534633f, 0.997000635f},
-std::array<float,2>{0.910728991f, 0.640161514f},
-std::array<float,2>{0.226502955f, 0.17156364f},
-std::array<float,2>{0.695456743f, 0.334266067f},
-std::array<float,2>{0.332453072f, 0.836588264f},
-std::array<float,2>{0.534325957f, 0.901582181f},
-std::array<float,2>{0.394823432f, 0.426491857f},
-std::array<float,2>{0.810121059f, 0.101398602f},
-std::array<float,2>{0.0481582545f, 0.514604926f},
-std::array<float,2>{0.892347634f, 0.822272241f},
-std::array<float,2>{0.213682055f, 0.323090732f},
-std::array<float,2>{0.729558706f, 0.172823712f},
-std::array<float,2>{0.368443906f, 0.644806385f},
-std::array<float,2>{0.527590454f, 0.516477287f},
-std::array<float,2>{0.422336012f, 0.121813588f},
-std::array<float,2>{0.754551411f, 0.419924587f},
-std::array<float,2>{0.00895441882f, 0.884758651f},
-std::array<float,2>{0.825740635f, 0.732284904f},
-std::array<float,2>{0.0920650586f, 0.223359481f},
-std::array<float,2>{0.580571532f, 0.30978176f},
-std::array<float,2>{0.484202117f, 0.764964223f},
-std::array<float,2>{0.648186803f, 0.971755385f},
-std::array<float,2>{0.26035127f, 0.498458356f},
-std::array<float,2>{0.979045451f, 0.0214579999f},
-std::array<float,2>{0.170102105f, 0.58782661f},
-std::array<float,2>{0.783903897f, 0.936170042f},
-std::array<float,2>{0.0370800868f, 0.37574321f},
-std::array<float,2>{0.561613917f, 0.0820645541f},
-std::array<float,2>{0.38896203f, 0.560826361f},
-std::array<float,2>{0.713481307f, 0.670991421f},
-std::array<float,2>{0.315475583f, 0.152336657f},
-std::array<float,2>{0.923433661f, 0.3672719f},
-std::array<float,2>{0.243234783f, 0.864243329f},
-std::array<float,2>{0.943846047f, 0.615834534f},
-std::array<float,2>{0.143744007f, 0.0512890555f},
-std::array<float,2>{0.686455965f, 0.440189987f},
-std::array<float,2>{0.295316577f, 0.945884585f},
-std::array<float,2>{0.608977556f, 0.810566962f},
-std::array<float,2>{0.439636648f, 0.270360023f},
-std::array<float,2>{0.855156064f, 0.201315582f},
-std::array<float,2>{0.118227221f, 0.702453494f},
-std::array<float,2>{0.935424924f, 0.876767457f},
-std::array<float,2>{0.239236668f, 0.406390399f},
-std::array<float,2>{0.706938624f, 0.116909958f},
-std::array<float,2>{0.327062786f, 0.526937962f},
-std::array<float,2>{0.55255717f, 0.649450123f},
-std::array<float,2>{0.375007808f, 0.186752185f},
-std::array<float,2>{0.791563034f, 0.313635945f},
-std::array<float,2>{0.0393423475f, 0.813555896f},
-std::array<float,2>{0.848644674f, 0.57993269f},
-std::array<float,2>{0.116403617f, 0.028339142f},
-std::array<float,2>{0.594741881f, 0.489383191f},
-std::array<float,2>{0.447695673f, 0.981105089f},
-std::array<float,2>{0.67831254f, 0.754887223f},
-std::array<float,2>{0.286812425f, 0.300206214f},
-std::array<float,2>{0.951356769f, 0.230535567f},
-std::array<float,2>{0.152623862f, 0.724370182f},
-std::array<float,2>{0.764405727f, 0.874345899f},
-std::array<float,2>{0.00342881167f, 0.365457445f},
-std::array<float,2>{0.519331098f, 0.145546302f},
-std::array<float,2>{0.430383146f, 0.661173105f},
-std::array<float,2>{0.722952485f, 0.547422826f},
-std::array<float,2>{0.365278661f, 0.0913368538f},
-std::array<float,2>{0.90365541f, 0.38494581f},
-std::array<float,2>{0.208708078f, 0.925845802f},
-std::array<float,2>{0.969698727f, 0.688979983f},
-std::array<float,2>{0.161363259f, 0.191030607f},
-std::array<float,2>{0.651821792f, 0.274652243f},
-std::array<float,2>{0.257506013f, 0.800134182f},
-std::array<float,2>{0.589392066f, 0.940988064f},
-std::array<float,2>{0.473651946f, 0.447966665f},
-std::array<float,2>{0.818004847f, 0.0562113449f},
-std::array<float,2>{0.0812981874f, 0.617952287f},
-std::array<float,2>{0.966258526f, 0.783643425f},
-std::array<float,2>{0.131394103f, 0.259131044f},
-std::array<float,2>{0.669413626f, 0.211357594f},
-std::array<float,2>{0.30542472f, 0.705548108f},
-std::array<float,2>{0.613409579f, 0.602424264f},
-std::array<float,2>{0.453318447f, 0.0420818105f},
-std::array<float,2>{0.871672213f, 0.465964645f},
-std::array<float,2>{0.0946245193f, 0.963486373f},
-std::array<float,2>{0.800130188f, 0.683146536f},
-std::array<float,2>{0.0573146716f, 0.126015872f},
-std::array<float,2>{0.540435672f, 0.356269389f},
-std::array<float,2>{0.399237841f, 0.85339725f},
-std::array<float,2>{0.691727877f, 0.916957319f},
-std::array<float,2>{0.336111546f, 0.401725352f},
-std::array<float,2>{0.91455102f, 0.0698475987f},
-std::array<float,2>{0.227640465f, 0.544677138f},
-std::array<float,2>{0.834510446f, 0.986366749f},
-std::array<float,2>{0.0675615221f, 0.477530301f},
-std::array<float,2>{0.574002087f, 0.00663125794f},
-std::array<float,2>{0.490842879f, 0.565831125f},
-std::array<float,2>{0.628553152f, 0.736823261f},
-std::array<float,2>{0.276595533f, 0.234509468f},
-std::array<float,2>{0.993544519f, 0.288199246f},
-std::array<float,2>{0.180059358f, 0.780725658f},
-std::array<float,2>{0.884783566f, 0.506080747f},
-std::array<float,2>{0.189020231f, 0.108450167f},
-std::array<float,2>{0.743603051f, 0.429710001f},
-std::array<float,2>{0.344764769f, 0.893085122f},
-std::array<float,2>{0.502448499f, 0.829124272f},
-std::array<float,2>{0.412709713f, 0.342175931f},
-std::array<float,2>{0.765841603f, 0.161430344f},
-std::array<float,2>{0.0261702631f, 0.631747544f},
-std::array<float,2>{0.881847024f, 0.97704488f},
-std::array<float,2>{0.200138971f, 0.486627728f},
-std::array<float,2>{0.738936424f, 0.0236863382f},
-std::array<float,2>{0.357786864f, 0.584212124f},
-std::array<float,2>{0.515186906f, 0.721706092f},
-std::array<float,2>{0.414788991f, 0.227995694f},
-std::array<float,2>{0.776376247f, 0.301346302f},
-std::array<float,2>{0.0175674148f, 0.753172755f},
-std::array<float,2>{0.841168165f, 0.530826151f},
-std::array<float,2>{0.0740845725f, 0.111159928f},
-std::array<float,2>{0.568493724f, 0.411831677f},
-std::array<float,2>{0.496831656f, 0.879778683f},
-std::array<float,2>{0.633008063f, 0.81740427f},
-std::array<float,2>{0.271752626f, 0.318025768f},
-std::array<float,2>{0.988526642f, 0.179754406f},
-std::array<float,2>{0.175802737f, 0.65414983f},
-std::array<float,2>{0.806374311f, 0.800882459f},
-std::array<float,2>{0.0529904999f, 0.278209537f},
-std::array<float,2>{0.538402975f, 0.193329513f},
-std::array<float,2>{0.391687542f, 0.695218801f},
-std::array<float,2>{0.700249016f, 0.623720944f},
-std::array<float,2>{0.331198812f, 0.0612822697f},
-std::array<float,2>{0.906595826f, 0.452010721f},
-std::array<float,2>{0.220512882f, 0.94353193f},
-std::array<float,2>{0.957114577f, 0.658196747f},
-std::array<float,2>{0.13445273f, 0.141368285f},
-std::array<float,2>{0.6579175f, 0.359705687f},
-std::array<float,2>{0.301210612f, 0.870312452f},
-std::array<float,2>{0.618574858f, 0.922706306f},
-std::array<float,2>{0.463850558f, 0.390584648f},
-std::array<float,2>{0.866701066f, 0.0881666616f},
-std::array<float,2>{0.106118031f, 0.551018119f},
-std::array<float,2>{0.980567873f, 0.857264161f},
-std::array<float,2>{0.166134849f, 0.355428219f},
-std::array<float,2>{0.641884148f, 0.130839691f},
-std::array<float,2>{0.26260525f, 0.68439889f},
-std::array<float,2>{0.585407078f, 0.542572677f},
-std::array<float,2>{0.480086416f, 0.0635169968f},
-std::array<float,2>{0.823882103f, 0.404270411f},
-std::array<float,2>{0.0877802372f, 0.919756591f},
-std::array<float,2>{0.753881276f, 0.709218621f},
-std::array<float,2>{0.0121863242f, 0.216426492f},
-std::array<float,2>{0.525512815f, 0.262269825f},
-std::array<float,2>{0.427833587f, 0.78764981f},
-std::array<float,2>{0.73148495f, 0.968038857f},
-std::array<float,2>{0.371332079f, 0.46123305f},
-std::array<float,2>{0.897078931f, 0.0445164293f},
-std::array<float,2>{0.214990392f, 0.608457804f},
-std::array<float,2>{0.855775595f, 0.894997776f},
-std::array<float,2>{0.122328147f, 0.436838716f},
-std::array<float,2>{0.602155685f, 0.103302471f},
-std::array<float,2>{0.445136368f, 0.50146395f},
-std::array<float,2>{0.681613326f, 0.625267625f},
-std::array<float,2>{0.29278186f, 0.159340709f},
-std::array<float,2>{0.939822197f, 0.338548273f},
-std::array<float,2>{0.145666197f, 0.833303273f},
-std::array<float,2>{0.926733017f, 0.569268048f},
-std::array<float,2>{0.24671106f, 0.0012449139f},
-std::array<float,2>{0.717323184f, 0.48107475f},
-std::array<float,2>{0.32028681f, 0.988380373f},
-std::array<float,2>{0.556720018f, 0.774716198f},
-std::array<float,2>{0.382818699f, 0.284743428f},
-std::array<float,2>{0.78533566f, 0.241181612f},
-std::array<float,2>{0.031558875f, 0.739129126f},
-std::array<float,2>{0.945813656f, 0.906318605f},
-std::array<float,2>{0.149232343f, 0.394197077f},
-std::array<float,2>{0.67576617f, 0.0715468079f},
-std::array<float,2>{0.281865895f, 0.538544416f},
-std::array<float,2>{0.599813402f, 0.678558707f},
-std::array<float,2>{0.44971329f, 0.139572486f},
-std::array<float,2>{0.845416605f, 0.3465451f},
-std::array<float,2>{0.113069192f, 0.848557055f},
-std::array<float,2>{0.794420898f, 0.598243594f},
-std::array<float,2>{0.0435652882f, 0.0373498686f},
-std::array<float,2>{0.549642622f, 0.459684759f},
-std::array<float,2>{0.380201072f, 0.960760474f},
-std::array<float,2>{0.707552016f, 0.795781493f},
-std::array<float,2>{0.323424131f, 0.254169375f},
-std::array<float,2>{0.930419385f, 0.208297879f},
-std::array<float,2>{0.236792564f, 0.715987027f},
-std::array<float,2>{0.815626085f, 0.842366457f},
-std::array<float,2>{0.0840304121f, 0.33076787f},
-std::array<float,2>{0.592927814f, 0.167771429f},
-std::array<float,2>{0.469506145f, 0.633561134f},
-std::array<float,2>{0.65483433f, 0.507964313f},
-std::array<float,2>{0.250582844f, 0.0942764506f},
-std::array<float,2>{0.975818396f, 0.423913509f},
-std::array<float,2>{0.157223046f, 0.903613329f},
-std::array<float,2>{0.898702323f, 0.748252869f},
-std::array<float,2>{0.204208314f, 0.244045109f},
-std::array<float,2>{0.721441865f, 0.290328294f},
-std::array<float,2>{0.363069922f, 0.771939397f},
-std::array<float,2>{0.521409631f, 0.994222462f},
-std::array<float,2>{0.437054813f, 0.468797475f},
-std::array<float,2>{0.759405255f, 0.0118352361f},
-std::array<float,2>{0.00686524715f, 0.572069466f},
-std::array<float,2>{0.918033957f, 0.759330034f},
-std::array<float,2>{0.23166649f, 0.305751413f},
-std::array<float,2>{0.687872112f, 0.218971416f},
-std::array<float,2>{0.343304962f, 0.729763985f},
-std::array<float,2>{0.546707094f, 0.591859043f},
-std::array<float,2>{0.403511286f, 0.0182883348f},
-std::array<float,2>{0.804405391f, 0.495877534f},
-std::array<float,2>{0.0600472316f, 0.97284615f},
-std::array<float,2>{0.869647264f, 0.641439736f},
-std::array<float,2>{0.101391979f, 0.179144204f},
-std::array<float,2>{0.609689653f, 0.325569749f},
-std::array<float,2>{0.457817316f, 0.827788711f},
-std::array<float,2>{0.666938424f, 0.889722884f},
-std::array<float,2>{0.311986715f, 0.416502476f},
-std::array<float,2>{0.964751661f, 0.117445633f},
-std::array<float,2>{0.12773791f, 0.519881308f},
-std::array<float,2>{0.769619524f, 0.952354252f},
-std::array<float,2>{0.030604044f, 0.442476571f},
-std::array<float,2>{0.506733418f, 0.0501802005f},
-std::array<float,2>{0.408507228f, 0.610257983f},
-std::array<float,2>{0.746708035f, 0.699015021f},
-std::array<float,2>{0.351087749f, 0.196912363f},
-std::array<float,2>{0.889044344f, 0.267954081f},
-std::array<float,2>{0.192830741f, 0.805505395f},
-std::array<float,2>{0.99666059f, 0.556181073f},
-std::array<float,2>{0.18685481f, 0.0789748728f},
-std::array<float,2>{0.629818738f, 0.379546583f},
-std::array<float,2>{0.277931184f, 0.93076092f},
-std::array<float,2>{0.577914178f, 0.860152125f},
-std::array<float,2>{0.485394984f, 0.372977465f},
-std::array<float,2>{0.831404924f, 0.153801218f},
-std::array<float,2>{0.0644456074f, 0.665789902f},
-std::array<float,2>{0.953867912f, 0.998049498f},
-std::array<float,2>{0.13986364f, 0.474885762f},
-std::array<float,2>{0.6628111f, 0.0113614639f},
-std::array<float,2>{0.297548503f, 0.576764405f},
-std::array<float,2>{0.622046053f, 0.743478954f},
-std::array<float,2>{0.467156976f, 0.246947318f},
-std::array<float,2>{0.862990677f, 0.296337038f},
-std::array<float,2>{0.103213504f, 0.768091202f},
-std::array<float,2>{0.812250316f, 0.512753904f},
-std::array<float,2>{0.0490488298f, 0.0977966487f},
-std::array<float,2>{0.532568336f, 0.429521352f},
-std::array<float,2>{0.398079187f, 0.898819804f},
-std::array<float,2>{0.698475003f, 0.839828253f},
-std::array<float,2>{0.334252477f, 0.333843619f},
-std::array<float,2>{0.912937701f, 0.168047026f},
-std::array<float,2>{0.223082304f, 0.63813138f},
-std::array<float,2>{0.837157428f, 0.792439282f},
-std::array<float,2>{0.0760487244f, 0.251885653f},
-std::array<float,2>{0.566001296f, 0.205144539f},
-std::array<float,2>{0.493182629f, 0.71319598f},
-std::array<float,2>{0.638467133f, 0.595419347f},
-std::array<float,2>{0.266813248f, 0.0348210372f},
-std::array<float,2>{0.985522866f, 0.456175953f},
-std::array<float,2>{0.17442289f, 0.954945743f},
-std::array<float,2>{0.878775418f, 0.674406946f},
-std::array<float,2>{0.195740759f, 0.134476453f},
-std::array<float,2>{0.736623943f, 0.349018842f},
-std::array<float,2>{0.353806913f, 0.846910059f},
-std::array<float,2>{0.507959425f, 0.913538814f},
-std::array<float,2>{0.418484837f, 0.396505296f},
-std::array<float,2>{0.779589355f, 0.0775472671f},
-std::array<float,2>{0.0203821119f, 0.534544826f},
-std::array<float,2>{0.924785554f, 0.865273297f},
-std::array<float,2>{0.24442859f, 0.370014369f},
-std::array<float,2>{0.711550534f, 0.148778096f},
-std::array<float,2>{0.313328803f, 0.668421626f},
-std::array<float,2>{0.559486866f, 0.559681058f},
-std::array<float,2>{0.386994332f, 0.0857173204f},
-std::array<float,2>{0.783035457f, 0.378745437f},
-std::array<float,2>{0.0386478305f, 0.933711886f},
-std::array<float,2>{0.853100002f, 0.699248552f},
-std::array<float,2>{0.120743901f, 0.199865893f},
-std::array<float,2>{0.605808914f, 0.272403926f},
-std::array<float,2>{0.438601285f, 0.808754444f},
-std::array<float,2>{0.685208142f, 0.947626889f},
-std::array<float,2>{0.293997705f, 0.439354897f},
-std::array<float,2>{0.942514181f, 0.0534369349f},
-std::array<float,2>{0.141809106f, 0.614122272f},
-std::array<float,2>{0.757080138f, 0.886012852f},
-std::array<float,2>{0.0112251155f, 0.418298393f},
-std::array<float,2>{0.531098247f, 0.124031186f},
-std::array<float,2>{0.425093651f, 0.517710924f},
-std::array<float,2>{0.727998793f, 0.646848977f},
-std::array<float,2>{0.370517135f, 0.173933178f},
-std::array<float,2>{0.892951906f, 0.321885616f},
-std::array<float,2>{0.21284917f, 0.820475221f},
-std::array<float,2>{0.978389561f, 0.588117898f},
-std::array<float,2>{0.16827552f, 0.0227839593f},
-std::array<float,2>{0.644601822f, 0.49687466f},
-std::array<float,2>{0.25874573f, 0.970685363f},
-std::array<float,2>{0.578220308f, 0.762536287f},
-std::array<float,2>{0.481079191f, 0.311031282f},
-std::array<float,2>{0.826423645f, 0.22515586f},
-std::array<float,2>{0.0912045836f, 0.732539833f},
-std::array<float,2>{0.904352129f, 0.928411365f},
-std::array<float,2>{0.210105538f, 0.383788764f},
-std::array<float,2>{0.726427436f, 0.0928804725f},
-std::array<float,2>{0.36507833f, 0.549099505f},
-std::array<float,2>{0.516112566f, 0.662266672f},
-std::array<float,2>{0.432558835f, 0.147148609f},
-std::array<float,2>{0.762627721f, 0.364496887f},
-std::array<float,2>{0.00162431144f, 0.872157216f},
-std::array<float,2>{0.819334209f, 0.620400786f},
-std::array<float,2>{0.0792358667f, 0.0577887371f},
-std::array<float,2>{0.587527812f, 0.447052181f},
-std::array<float,2>{0.47580725f, 0.93919456f},
-std::array<float,2>{0.649122059f, 0.797728002f},
-std::array<float,2>{0.255026966f, 0.277146876f},
-std::array<float,2>{0.970976889f, 0.188037694f},
-std::array<float,2>{0.163113087f, 0.689982653f},
-std::array<float,2>{0.790795445f, 0.814478755f},
-std::array<float,2>{0.0414970107f, 0.314584643f},
-std::array<float,2>{0.553392112f, 0.18484351f},
-std::array<float,2>{0.377395719f, 0.652041972f},
-std::array<float,2>{0.703795493f, 0.523989379f},
-std::array<float,2>{0.325607508f, 0.114092506f},
-std::array<float,2>{0.936690211f, 0.408855855f},
-std::array<float,2>{0.241817594f, 0.877951562f},
-std::array<float,2>{0.950325549f, 0.725542128f},
-std::array<float,2>{0.154400125f, 0.233492225f},
-std::array<float,2>{0.676451325f, 0.298452437f},
-std::array<float,2>{0.28805089f, 0.75770992f},
-std::array<float,2>{0.596268535f, 0.98293972f},
-std::array<float,2>{0.447152197f, 0.491558164f},
-std::array<float,2>{0.85019809f, 0.0309636351f},
-std::array<float,2>{0.113539167f, 0.581566691f},
-std::array<float,2>{0.995796561f, 0.77798152f},
-std::array<float,2>{0.182353735f, 0.286691159f},
-std::array<float,2>{0.626764297f, 0.237260789f},
-std::array<float,2>{0.27528882f, 0.735304713f},
-std::array<float,2>{0.571221173f, 0.563172519f},
-std::array<float,2>{0.489970416f, 0.0052354834f},
-std::array<float,2>{0.833211362f, 0.480148762f},
-std::array<float,2>{0.0700537488f, 0.985052705f},
-std::array<float,2>{0.767691612f, 0.629721582f},
-std::array<float,2>{0.0241682883f, 0.162957326f},
-std::array<float,2>{0.501485765f, 0.339992017f},
-std::array<float,2>{0.412054211f, 0.830777824f},
-std::array<float,2>{0.745945513f, 0.891607523f},
-std::array<float,2>{0.347185612f, 0.431675136f},
-std::array<float,2>{0.883544445f, 0.105613217f},
-std::array<float,2>{0.190160394f, 0.505679965f},
-std::array<float,2>{0.873561859f, 0.961090744f},
-std::array<float,2>{0.0974937603f, 0.466984272f},
-std::array<float,2>{0.615285218f, 0.0391746052f},
-std::array<float,2>{0.456280351f, 0.604872525f},
-std::array<float,2>{0.670154095f, 0.703357995f},
-std::array<float,2>{0.307625711f, 0.21416387f},
-std::array<float,2>{0.967215776f, 0.260719359f},
-std::array<float,2>{0.130401477f, 0.782679796f},
-std::array<float,2>{0.916918933f, 0.546650708f},
-std::array<float,2>{0.229124889f, 0.0678673238f},
-std::array<float,2>{0.693902016f, 0.399747819f},
-std::array<float,2>{0.338657975f, 0.915574014f},
-std::array<float,2>{0.541073978f, 0.8551687f},
-std::array<float,2>{0.402237207f, 0.357505977f},
-std::array<float,2>{0.798605323f, 0.127647012f},
-std::array<float,2>{0.056004405f, 0.681008875f},
-std::array<float,2>{0.908667743f, 0.943104506f},
-std::array<float,2>{0.220994726f, 0.449898094f},
-std::array<float,2>{0.70186311f, 0.0597814061f},
-std::array<float,2>{0.328233659f, 0.621281862f},
-std::array<float,2>{0.536812305f, 0.691440523f},
-std::array<float,2>{0.393310994f, 0.194654256f},
-std::array<float,2>{0.808063686f, 0.281203091f},
-std::array<float,2>{0.0509988926f, 0.802754343f},
-std::array<float,2>{0.86411643f, 0.554546714f},
-std::array<float,2>{0.107976228f, 0.0866172239f},
-std::array<float,2>{0.619724989f, 0.388207763f},
-std::array<float,2>{0.462617487f, 0.925524116f},
-std::array<float,2>{0.659962416f, 0.868357241f},
-std::array<float,2>{0.303149939f, 0.362372428f},
-std::array<float,2>{0.960169673f, 0.144467011f},
-std::array<float,2>{0.135619417f, 0.659458339f},
-std::array<float,2>{0.774108887f, 0.750827432f},
-std::array<float,2>{0.0194005426f, 0.304168999f},
-std::array<float,2>{0.511821866f, 0.230174676f},
-std::array<float,2>{0.416827142f, 0.719238222f},
-std::array<float,2>{0.740255773f, 0.582905114f},
-std::array<float,2>{0.356691808f, 0.0264740158f},
-std::array<float,2>{0.879899442f, 0.486279994f},
-std::array<float,2>{0.202147827f, 0.979930878f},
-std::array<float,2>{0.991990805f, 0.654340565f},
-std::array<float,2>{0.179155201f, 0.183583602f},
-std::array<float,2>{0.636014521f, 0.31899029f},
-std::array<float,2>{0.270410091f, 0.82029438f},
-std::array<float,2>{0.567937136f, 0.882361233f},
-std::array<float,2>{0.499149173f, 0.412472069f},
-std::array<float,2>{0.842159092f, 0.112993881f},
-std::array<float,2>{0.0718756765f, 0.527929604f},
-std::array<float,2>{0.937512517f, 0.835210979f},
-std::array<float,2>{0.147465035f, 0.337371916f},
-std::array<float,2>{0.682215571f, 0.157598883f},
-std::array<float,2>{0.290882617f, 0.62745595f},
-std::array<float,2>{0.603655457f, 0.502749443f},
-std::array<float,2>{0.442045242f, 0.103690863f},
-std::array<float,2>{0.858276486f, 0.435236633f},
-std::array<float,2>{0.12313842f, 0.897675455f},
-std::array<float,2>{0.788274765f, 0.740636885f},
-std::array<float,2>{0.0333193354f, 0.239042565f},
-std::array<float,2>{0.555458605f, 0.281645983f},
-std::array<float,2>{0.386389345f, 0.776894033f},
-std::array<float,2>{0.715891778f, 0.990543067f},
-std::array<float,2>{0.316806912f, 0.483353823f},
-std::array<float,2>{0.928119361f, 0.00287820166f},
-std::array<float,2>{0.248384044f, 0.567991614f},
-std::array<float,2>{0.821252882f, 0.920772433f},
-std::array<float,2>{0.0895451754f, 0.40503937f},
-std::array<float,2>{0.58384645f, 0.0661769137f},
-std::array<float,2>{0.478230804f, 0.540599823f},
-std::array<float,2>{0.643659592f, 0.686066508f},
-std::array<float,2>{0.264142454f, 0.132744461f},
-std::array<float,2>{0.983262479f, 0.351931751f},
-std::array<float,2>{0.165998667f, 0.858819425f},
-std::array<float,2>{0.896058261f, 0.60670346f},
-std::array<float,2>{0.217370838f, 0.0458822697f},
-std::array<float,2>{0.732755959f, 0.464839995f},
-std::array<float,2>{0.373783112f, 0.966727197f},
-std::array<float,2>{0.52460593f, 0.786570549f},
-std::array<float,2>{0.427127331f, 0.263961256f},
-std::array<float,2>{0.75112325f, 0.218621999f},
-std::array<float,2>{0.0155548379f, 0.707371473f},
-std::array<float,2>{0.973544478f, 0.905482769f},
-std::array<float,2>{0.159220651f, 0.423548609f},
-std::array<float,2>{0.653849661f, 0.0967722237f},
-std::array<float,2>{0.252065957f, 0.510678828f},
-std::array<float,2>{0.590672076f, 0.635867715f},
-std::array<float,2>{0.471435666f, 0.164251342f},
-std::array<float,2>{0.814374506f, 0.329245627f},
-std::array<float,2>{0.082751289f, 0.840541184f},
-std::array<float,2>{0.761006534f, 0.573159099f},
-std::array<float,2>{0.00445136009f, 0.0148488712f},
-std::array<float,2>{0.522317767f, 0.471658319f},
-std::array<float,2>{0.434150934f, 0.993867099f},
-std::array<float,2>{0.719083846f, 0.770032942f},
-std::array<float,2>{0.360076874f, 0.292508841f},
-std::array<float,2>{0.900638282f, 0.245317966f},
-std::array<float,2>{0.206459567f, 0.747263789f},
-std::array<float,2>{0.84662509f, 0.851525307f},
-std::array<float,2>{0.109691739f, 0.343868256f},
-std::array<float,2>{0.597935259f, 0.138341755f},
-std::array<float,2>{0.452577978f, 0.676424921f},
-std::array<float,2>{0.672741175f, 0.536249757f},
-std::array<float,2>{0.283554345f, 0.0736569762f},
-std::array<float,2>{0.947556555f, 0.391381532f},
-std::array<float,2>{0.152044028f, 0.909992635f},
-std::array<float,2>{0.932719171f, 0.717975795f},
-std::array<float,2>{0.236286774f, 0.209368974f},
-std::array<float,2>{0.710336268f, 0.255927086f},
-std::array<float,2>{0.321148723f, 0.794271708f},
-std::array<float,2>{0.548030615f, 0.958326042f},
-std::array<float,2>{0.382087886f, 0.457452714f},
-std::array<float,2>{0.794965148f, 0.0351811573f},
-std::array<float,2>{0.0462416038f, 0.599923372f},
-std::array<float,2>{0.888224959f, 0.807015419f},
-std::array<float,2>{0.193922192f, 0.265848577f},
-std::array<float,2>{0.748741508f, 0.198761865f},
-std::array<float,2>{0.348816961f, 0.695402026f},
-std::array<float,2>{0.504750609f, 0.611358643f},
-std::array<float,2>{0.407003492f, 0.0477714837f},
-std::array<float,2>{0.772635996f, 0.444331914f},
-std::array<float,2>{0.0277541857f, 0.95085305f},
-std::array<float,2>{0.828360915f, 0.667930067f},
-std::array<float,2>{0.0652259737f, 0.154801533f},
-std::array<float,2>{0.575635195f, 0.374357194f},
-std::array<float,2>{0.487879962f, 0.861470938f},
-std::array<float,2>{0.631650925f, 0.932139218f},
-std::array<float,2>{0.28070733f, 0.382770091f},
-std::array<float,2>{0.99947989f, 0.0800889507f},
-std::array<float,2>{0.185340926f, 0.557490289f},
-std::array<float,2>{0.802426994f, 0.976398766f},
-std::array<float,2>{0.0619597286f, 0.492966652f},
-std::array<float,2>{0.543118179f, 0.0158872288f},
-std::array<float,2>{0.404614806f, 0.590008616f},
-std::array<float,2>{0.690876603f, 0.727855682f},
-std::array<float,2>{0.340538532f, 0.221893504f},
-std::array<float,2>{0.920989633f, 0.3067545f},
-std::array<float,2>{0.233746618f, 0.760990679f},
-std::array<float,2>{0.962624252f, 0.522636831f},
-std::array<float,2>{0.125513494f, 0.119413555f},
-std::array<float,2>{0.664445937f, 0.415596306f},
-std::array<float,2>{0.308683515f, 0.887715936f},
-std::array<float,2>{0.613276482f, 0.825401843f},
-std::array<float,2>{0.460917026f, 0.32676357f},
-std::array<float,2>{0.867600858f, 0.175972596f},
-std::array<float,2>{0.0993369818f, 0.643236876f},
-std::array<float,2>{0.980436862f, 0.969493032f},
-std::array<float,2>{0.17112565f, 0.497444272f},
-std::array<float,2>{0.647206128f, 0.0220363308f},
-std::array<float,2>{0.261435181f, 0.589345694f},
-std::array<float,2>{0.581601799f, 0.733518064f},
-std::array<float,2>{0.482480675f, 0.225601405f},
-std::array<float,2>{0.82436955f, 0.31184724f},
-std::array<float,2>{0.0933802873f, 0.763292253f},
-std::array<float,2>{0.75569284f, 0.519239068f},
-std::array<float,2>{0.0086880764f, 0.123890445f},
-std::array<float,2>{0.529159784f, 0.419365525f},
-std::array<float,2>{0.423292547f, 0.885639369f},
-std::array<float,2>{0.728855848f, 0.821309924f},
-std::array<float,2>{0.367829323f, 0.321133018f},
-std::array<float,2>{0.891011119f, 0.175491348f},
-std::array<float,2>{0.214427426f, 0.647626698f},
-std::array<float,2>{0.85378027f, 0.810211539f},
-std::array<float,2>{0.117517702f, 0.272637635f},
-std::array<float,2>{0.607718527f, 0.201157972f},
-std::array<float,2>{0.441389501f, 0.7011621f},
-std::array<float,2>{0.686895669f, 0.614962459f},
-std::array<float,2>{0.296258926f, 0.0542377494f},
-std::array<float,2>{0.944530427f, 0.43786189f},
-std::array<float,2>{0.142989069f, 0.9491418f},
-std::array<float,2>{0.922393382f, 0.669723213f},
-std::array<float,2>{0.242730334f, 0.150140166f},
-std::array<float,2>{0.71425873f, 0.371005118f},
-std::array<float,2>{0.314753145f, 0.867093205f},
-std::array<float,2>{0.560737848f, 0.934877157f},
-std::array<float,2>{0.390144378f, 0.377182335f},
-std::array<float,2>{0.784340918f, 0.0846575797f},
-std::array<float,2>{0.0358516499f, 0.559035897f},
-std::array<float,2>{0.875573754f, 0.846579015f},
-std::array<float,2>{0.19920592f, 0.348272711f},
-std::array<float,2>{0.735953927f, 0.132845119f},
-std::array<float,2>{0.352774411f, 0.675227106f},
-std::array<float,2>{0.510988414f, 0.533490896f},
-std::array<float,2>{0.42002961f, 0.076790683f},
-std::array<float,2>{0.778253436f, 0.39794597f},
-std::array<float,2>{0.0223566368f, 0.912823558f},
-std::array<float,2>{0.838261306f, 0.714271903f},
-std::array<float,2>{0.0769720674f, 0.206076831f},
-std::array<float,2>{0.562565267f, 0.250798881f},
-std::array<float,2>{0.495824963f, 0.791897655f},
-std::array<float,2>{0.640132725f, 0.953748941f},
-std::array<float,2>{0.267745703f, 0.455863506f},
-std::array<float,2>{0.988209724f, 0.0335092098f},
-std::array<float,2>{0.172160894f, 0.594561875f},
-std::array<float,2>{0.808757842f, 0.900289476f},
-std::array<float,2>{0.0474833287f, 0.428345382f},
-std::array<float,2>{0.533822536f, 0.0987350941f},
-std::array<float,2>{0.395931333f, 0.512456894f},
-std::array<float,2>{0.697104156f, 0.637017429f},
-std::array<float,2>{0.333943188f, 0.169695616f},
-std::array<float,2>{0.911765695f, 0.333003223f},
-std::array<float,2>{0.224638954f, 0.838352799f},
-std::array<float,2>{0.955327809f, 0.577525973f},
-std::array<float,2>{0.138003364f, 0.0106431553f},
-std::array<float,2>{0.66098249f, 0.476471126f},
-std::array<float,2>{0.299489409f, 0.99943459f},
-std::array<float,2>{0.624205947f, 0.768630385f},
-std::array<float,2>{0.466685116f, 0.295023799f},
-std::array<float,2>{0.860788584f, 0.247692198f},
-std::array<float,2>{0.10393966f, 0.743104875f},
-std::array<float,2>{0.915255368f, 0.914279699f},
-std::array<float,2>{0.22732915f, 0.398832679f},
-std::array<float,2>{0.692751944f, 0.0670494214f},
-std::array<float,2>{0.337248176f, 0.545227051f},
-std::array<float,2>{0.539778113f, 0.680378973f},
-std::array<float,2>{0.399647385f, 0.128262222f},
-std::array<float,2>{0.799667776f, 0.358614475f},
-std::array<float,2>{0.0577747151f, 0.85360235f},
-std::array<float,2>{0.872097135f, 0.603558421f},
-std::array<float,2>{0.0954402983f, 0.0406698585f},
-std::array<float,2>{0.614601731f, 0.46821332f},
-std::array<float,2>{0.454828799f, 0.962183595f},
-std::array<float,2>{0.668355525f, 0.781906068f},
-std::array<float,2>{0.30609712f, 0.261071831f},
-std::array<float,2>{0.965761125f, 0.213345513f},
-std::array<float,2>{0.132045388f, 0.704457641f},
-std::array<float,2>{0.767418385f, 0.831197023f},
-std::array<float,2>{0.0271640867f, 0.340898931f},
-std::array<float,2>{0.503456175f, 0.163852155f},
-std::array<float,2>{0.413256764f, 0.630334914f},
-std::array<float,2>{0.742630064f, 0.504303098f},
-std::array<float,2>{0.344695896f, 0.106835261f},
-std::array<float,2>{0.886414766f, 0.432944566f},
-std::array<float,2>{0.188003525f, 0.890682042f},
-std::array<float,2>{0.99305588f, 0.735674679f},
-std::array<float,2>{0.181120932f, 0.238279611f},
-std::array<float,2>{0.627156436f, 0.285992771f},
-std::array<float,2>{0.275442868f, 0.778975904f},
-std::array<float,2>{0.572977901f, 0.985981584f},
-std::array<float,2>{0.491218418f, 0.478678018f},
-std::array<float,2>{0.835873365f, 0.00431270758f},
-std::array<float,2>{0.0664536357f, 0.564321637f},
-std::array<float,2>{0.95275557f, 0.756713569f},
-std::array<float,2>{0.154108331f, 0.297167093f},
-std::array<float,2>{0.679363847f, 0.232883319f},
-std::array<float,2>{0.285712272f, 0.725743175f},
-std::array<float,2>{0.594327509f, 0.580737114f},
-std::array<float,2>{0.448472142f, 0.0293252841f},
-std::array<float,2>{0.847820401f, 0.490376085f},
-std::array<float,2>{0.115298748f, 0.984049499f},
-std::array<float,2>{0.792587161f, 0.651167572f},
-std::array<float,2>{0.0402201153f, 0.183682442f},
-std::array<float,2>{0.551724076f, 0.316197276f},
-std::array<float,2>{0.376817286f, 0.815913916f},
-std::array<float,2>{0.705247164f, 0.877110481f},
-std::array<float,2>{0.328024209f, 0.409870505f},
-std::array<float,2>{0.934008598f, 0.114842832f},
-std::array<float,2>{0.240049392f, 0.52515167f},
-std::array<float,2>{0.81683439f, 0.938466549f},
-std::array<float,2>{0.080114156f, 0.445543259f},
-std::array<float,2>{0.588156402f, 0.0571826585f},
-std::array<float,2>{0.473591328f, 0.619502664f},
-std::array<float,2>{0.650598586f, 0.690609574f},
-std::array<float,2>{0.255967081f, 0.189251333f},
-std::array<float,2>{0.970492542f, 0.27609548f},
-std::array<float,2>{0.160326138f, 0.798335671f},
-std::array<float,2>{0.902414799f, 0.550189316f},
-std::array<float,2>{0.207460299f, 0.0926558673f},
-std::array<float,2>{0.724261761f, 0.383973926f},
-std::array<float,2>{0.366753906f, 0.928926051f},
-std::array<float,2>{0.51768136f, 0.871792257f},
-std::array<float,2>{0.430968136f, 0.363451809f},
-std::array<float,2>{0.765558958f, 0.148169607f},
-std::array<float,2>{0.00285764085f, 0.663236678f},
-std::array<float,2>{0.898017645f, 0.965711057f},
-std::array<float,2>{0.216560692f, 0.463170737f},
-std::array<float,2>{0.73065269f, 0.046372503f},
-std::array<float,2>{0.372577369f, 0.606033146f},
-std::array<float,2>{0.526838481f, 0.708304882f},
-std::array<float,2>{0.42961973f, 0.2170773f},
-std::array<float,2>{0.752075553f, 0.26480028f},
-std::array<float,2>{0.0134663023f, 0.785534322f},
-std::array<float,2>{0.822670341f, 0.539383113f},
-std::array<float,2>{0.0865751207f, 0.0645882413f},
-std::array<float,2>{0.584859252f, 0.406182498f},
-std::array<float,2>{0.47911498f, 0.921380997f},
-std::array<float,2>{0.641485572f, 0.857481837f},
-std::array<float,2>{0.263092786f, 0.352770716f},
-std::array<float,2>{0.98180306f, 0.131020337f},
-std::array<float,2>{0.167190522f, 0.687450588f},
-std::array<float,2>{0.786368012f, 0.776360512f},
-std::array<float,2>{0.0329005271f, 0.282697141f},
-std::array<float,2>{0.557992578f, 0.239373937f},
-std::array<float,2>{0.38471657f, 0.741750002f},
-std::array<float,2>{0.718366265f, 0.56662035f},
-std::array<float,2>{0.318887651f, 0.00345913856f},
-std::array<float,2>{0.92734158f, 0.484041274f},
-std::array<float,2>{0.247315332f, 0.992020965f},
-std::array<float,2>{0.940623701f, 0.628743112f},
-std::array<float,2>{0.145083308f, 0.156351492f},
-std::array<float,2>{0.680625796f, 0.33685708f},
-std::array<float,2>{0.291700125f, 0.834062219f},
-std::array<float,2>{0.602964997f, 0.89687115f},
-std::array<float,2>{0.443415046f, 0.434257269f},
-std::array<float,2>{0.857055366f, 0.104724221f},
-std::array<float,2>{0.122065656f, 0.503809988f},
-std::array<float,2>{0.989631653f, 0.819014311f},
-std::array<float,2>{0.176951513f, 0.320145637f},
-std::array<float,2>{0.634315073f, 0.182060122f},
-std::array<float,2>{0.272889376f, 0.65529561f},
-std::array<float,2>{0.570129573f, 0.528958321f},
-std::array<float,2>{0.497710586f, 0.111812897f},
-std::array<float,2>{0.840490878f, 0.413688272f},
-std::array<float,2>{0.0728628784f, 0.881759465f},
-std::array<float,2>{0.776281893f, 0.719884872f},
-std::array<float,2>{0.0160296559f, 0.229123592f},
-std::array<float,2>{0.513932049f, 0.302834004f},
-std::array<float,2>{0.415441275f, 0.751077294f},
-std::array<float,2>{0.739557505f, 0.979488492f},
-std::array<float,2>{0.359131962f, 0.485322505f},
-std::array<float,2>{0.881152809f, 0.0259343013f},
-std::array<float,2>{0.200280339f, 0.583906353f},
-std::array<float,2>{0.866025269f, 0.923998177f},
-std::array<float,2>{0.107004628f, 0.387551397f},
-std::array<float,2>{0.617237747f, 0.087127544f},
-std::array<float,2>{0.464651257f, 0.55300808f},
-std::array<float,2>{0.656868279f, 0.659118056f},
-std::array<float,2>{0.30187881f, 0.143086523f},
-std::array<float,2>{0.958291471f, 0.361992359f},
-std::array<float,2>{0.13308008f, 0.867649019f},
-std::array<float,2>{0.907855749f, 0.622876704f},
-std::array<float,2>{0.21875903f, 0.0587092601f},
-std::array<float,2>{0.699842751f, 0.450262904f},
-std::array<float,2>{0.330147475f, 0.942379177f},
-std::array<float,2>{0.537948072f, 0.804211795f},
-std::array<float,2>{0.391376615f, 0.279810637f},
-std::array<float,2>{0.805266023f, 0.193914607f},
-std::array<float,2>{0.0542938262f, 0.692956507f},
-std::array<float,2>{0.96362108f, 0.887504756f},
-std::array<float,2>{0.128742546f, 0.414780587f},
-std::array<float,2>{0.667951763f, 0.12034063f},
-std::array<float,2>{0.310867697f, 0.521973133f},
-std::array<float,2>{0.610903144f, 0.644320071f},
-std::array<float,2>{0.458316594f, 0.17684941f},
-std::array<float,2>{0.870257735f, 0.32754904f},
-std::array<float,2>{0.100508876f, 0.824520826f},
-std::array<float,2>{0.802936316f, 0.591563106f},
-std::array<float,2>{0.0592478178f, 0.0169314053f},
-std::array<float,2>{0.545865774f, 0.494017243f},
-std::array<float,2>{0.402694374f, 0.974911273f},
-std::array<float,2>{0.688851833f, 0.759766698f},
-std::array<float,2>{0.342117697f, 0.308228523f},
-std::array<float,2>{0.919339716f, 0.220965818f},
-std::array<float,2>{0.231422439f, 0.727438867f},
-std::array<float,2>{0.830634594f, 0.86295253f},
-std::array<float,2>{0.0628769621f, 0.373708606f},
-std::array<float,2>{0.576515615f, 0.156164587f},
-std::array<float,2>{0.484827608f, 0.666489422f},
-std::array<float,2>{0.630828023f, 0.558394969f},
-std::array<float,2>{0.278749436f, 0.0815394446f},
-std::array<float,2>{0.997168243f, 0.381212741f},
-std::array<float,2>{0.186192825f, 0.932957113f},
-std::array<float,2>{0.890566289f, 0.697180629f},
-std::array<float,2>{0.191800907f, 0.198213667f},
-std::array<float,2>{0.747515023f, 0.266785324f},
-std::array<float,2>{0.350558311f, 0.807759881f},
-std::array<float,2>{0.507341385f, 0.950171053f},
-std::array<float,2>{0.409623682f, 0.44530794f},
-std::array<float,2>{0.771226704f, 0.0479727536f},
-std::array<float,2>{0.0300333761f, 0.612312317f},
-std::array<float,2>{0.930804133f, 0.79324317f},
-std::array<float,2>{0.238259733f, 0.257440358f},
-std::array<float,2>{0.708838761f, 0.210594028f},
-std::array<float,2>{0.322509795f, 0.717313707f},
-std::array<float,2>{0.550126672f, 0.601317525f},
-std::array<float,2>{0.37987268f, 0.0369514264f},
-std::array<float,2>{0.793938577f, 0.458170712f},
-std::array<float,2>{0.044892922f, 0.957743824f},
-std::array<float,2>{0.844033062f, 0.677651405f},
-std::array<float,2>{0.112135313f, 0.137386695f},
-std::array<float,2>{0.601069629f, 0.344914764f},
-std::array<float,2>{0.450356543f, 0.850169241f},
-std::array<float,2>{0.673904479f, 0.908753633f},
-std::array<float,2>{0.282446891f, 0.392000645f},
-std::array<float,2>{0.946776032f, 0.0726574436f},
-std::array<float,2>{0.149980724f, 0.53571862f},
-std::array<float,2>{0.757842004f, 0.993063986f},
-std::array<float,2>{0.00647448422f, 0.472612858f},
-std::array<float,2>{0.519767582f, 0.0141129857f},
-std::array<float,2>{0.436048925f, 0.57375288f},
-std::array<float,2>{0.72173214f, 0.746847987f},
-std::array<float,2>{0.362200856f, 0.244326651f},
-std::array<float,2>{0.900338769f, 0.291400164f},
-std::array<float,2>{0.203685969f, 0.771295965f},
-std::array<float,2>{0.975529313f, 0.511022449f},
-std::array<float,2>{0.157491595f, 0.0962299928f},
-std::array<float,2>{0.65566659f, 0.42204079f},
-std::array<float,2>{0.251734227f, 0.90515697f},
-std::array<float,2>{0.5920856f, 0.841391742f},
-std::array<float,2>{0.470247447f, 0.328222185f},
-std::array<float,2>{0.814522207f, 0.165078834f},
-std::array<float,2>{0.0853938237f, 0.634946048f},
-std::array<float,2>{0.941946924f, 0.94708395f},
-std::array<float,2>{0.141192615f, 0.440842718f},
-std::array<float,2>{0.683966517f, 0.0520782992f},
-std::array<float,2>{0.293132931f, 0.616825402f},
-std::array<float,2>{0.607223392f, 0.701651216f},
-std::array<float,2>{0.438055545f, 0.2025581f},
-std::array<float,2>{0.852034092f, 0.27101025f},
-std::array<float,2>{0.119702481f, 0.812407076f},
-std::array<float,2>{0.781885445f, 0.562424779f},
-std::array<float,2>{0.0378616676f, 0.0833625421f},
-std::array<float,2>{0.559749842f, 0.37691313f},
-std::array<float,2>{0.388615191f, 0.937377512f},
-std::array<float,2>{0.711943269f, 0.864779353f},
-std::array<float,2>{0.313968509f, 0.368552297f},
-std::array<float,2>{0.925223589f, 0.150939479f},
-std::array<float,2>{0.245742768f, 0.670749605f},
-std::array<float,2>{0.827307343f, 0.764415503f},
-std::array<float,2>{0.0899481177f, 0.309380651f},
-std::array<float,2>{0.579784453f, 0.224038109f},
-std::array<float,2>{0.48162359f, 0.730645418f},
-std::array<float,2>{0.645830333f, 0.586001694f},
-std::array<float,2>{0.259013534f, 0.0196588729f},
-std::array<float,2>{0.976787865f, 0.499818325f},
-std::array<float,2>{0.169693217f, 0.97077769f},
-std::array<float,2>{0.893847048f, 0.645655811f},
-std::array<float,2>{0.211901471f, 0.173141748f},
-std::array<float,2>{0.727511227f, 0.324155569f},
-std::array<float,2>{0.369277626f, 0.823741257f},
-std::array<float,2>{0.529718459f, 0.883180499f},
-std::array<float,2>{0.424663097f, 0.421157569f},
-std::array<float,2>{0.756823301f, 0.122108415f},
-std::array<float,2>{0.0106040901f, 0.517464995f},
-std::array<float,2>{0.913187444f, 0.837463856f},
-std::array<float,2>{0.223702073f, 0.33548516f},
-std::array<float,2>{0.697936058f, 0.170064986f},
-std::array<float,2>{0.335840464f, 0.638803959f},
-std::array<float,2>{0.531907618f, 0.515570343f},
-std::array<float,2>{0.396526009f, 0.100017525f},
-std::array<float,2>{0.811082959f, 0.426781356f},
-std::array<float,2>{0.0506061651f, 0.900804281f},
-std::array<float,2>{0.862259686f, 0.745931208f},
-std::array<float,2>{0.101801291f, 0.24880138f},
-std::array<float,2>{0.622638226f, 0.29390353f},
-std::array<float,2>{0.467999101f, 0.767156661f},
-std::array<float,2>{0.663710892f, 0.997810006f},
-std::array<float,2>{0.298653752f, 0.473715395f},
-std::array<float,2>{0.954440355f, 0.00787126832f},
-std::array<float,2>{0.138987273f, 0.576109111f},
-std::array<float,2>{0.780652046f, 0.910661995f},
-std::array<float,2>{0.0206615534f, 0.394579351f},
-std::array<float,2>{0.509163797f, 0.0753465816f},
-std::array<float,2>{0.419905454f, 0.531735063f},
-std::array<float,2>{0.738108397f, 0.673782706f},
-std::array<float,2>{0.355313748f, 0.136109889f},
-std::array<float,2>{0.877883196f, 0.351293564f},
-std::array<float,2>{0.196790025f, 0.844845831f},
-std::array<float,2>{0.984471619f, 0.597432494f},
-std::array<float,2>{0.174853757f, 0.0318385474f},
-std::array<float,2>{0.636998236f, 0.454505205f},
-std::array<float,2>{0.26589331f, 0.955840826f},
-std::array<float,2>{0.565295458f, 0.789956033f},
-std::array<float,2>{0.493025661f, 0.252150387f},
-std::array<float,2>{0.836376846f, 0.20351924f},
-std::array<float,2>{0.0742720366f, 0.712305188f},
-std::array<float,2>{0.884400845f, 0.894004345f},
-std::array<float,2>{0.190534666f, 0.431044579f},
-std::array<float,2>{0.744832873f, 0.107869767f},
-std::array<float,2>{0.346346676f, 0.507478297f},
-std::array<float,2>{0.500005841f, 0.632791281f},
-std::array<float,2>{0.410804421f, 0.16088064f},
-std::array<float,2>{0.769510984f, 0.342946142f},
-std::array<float,2>{0.0251708888f, 0.828148603f},
-std::array<float,2>{0.832969308f, 0.564831793f},
-std::array<float,2>{0.0689082593f, 0.00687900605f},
-std::array<float,2>{0.572085917f, 0.478007317f},
-std::array<float,2>{0.488807976f, 0.98827374f},
-std::array<float,2>{0.625173628f, 0.779327869f},
-std::array<float,2>{0.273777485f, 0.287126273f},
-std::array<float,2>{0.994315505f, 0.235488713f},
-std::array<float,2>{0.183319137f, 0.737347722f},
-std::array<float,2>{0.797621727f, 0.852515519f},
-std::array<float,2>{0.0555961765f, 0.35705778f},
-std::array<float,2>{0.542562127f, 0.12571907f},
-std::array<float,2>{0.401253879f, 0.681986153f},
-std::array<float,2>{0.694734454f, 0.543206155f},
-std::array<float,2>{0.339782238f, 0.0686895996f},
-std::array<float,2>{0.917460442f, 0.400954127f},
-std::array<float,2>{0.229786113f, 0.917161405f},
-std::array<float,2>{0.967995107f, 0.706267059f},
-std::array<float,2>{0.129350975f, 0.21223703f},
-std::array<float,2>{0.67121613f, 0.258178115f},
-std::array<float,2>{0.307224274f, 0.784679055f},
-std::array<float,2>{0.617048383f, 0.964643836f},
-std::array<float,2>{0.455799162f, 0.465125442f},
-std::array<float,2>{0.874750495f, 0.0411849432f},
-std::array<float,2>{0.0958693326f, 0.602638781f},
-std::array<float,2>{0.972418606f, 0.799790621f},
-std::array<float,2>{0.162382543f, 0.274379462f},
-std::array<float,2>{0.649858415f, 0.189717084f},
-std::array<float,2>{0.254331887f, 0.688066363f},
-std::array<float,2>{0.586304724f, 0.618404448f},
-std::array<float,2>{0.475307614f, 0.0550956577f},
-std::array<float,2>{0.819550812f, 0.448379606f},
-std::array<float,2>{0.0782990158f, 0.939932704f},
-std::array<float,2>{0.762789011f, 0.660916269f},
-std::array<float,2>{0.00076581724f, 0.145394847f},
-std::array<float,2>{0.517454386f, 0.366266161f},
-std::array<float,2>{0.43313995f, 0.873617649f},
-std::array<float,2>{0.725106716f, 0.927331507f},
-std::array<float,2>{0.363816738f, 0.38607648f},
-std::array<float,2>{0.905613244f, 0.0903248191f},
-std::array<float,2>{0.209469259f, 0.548206329f},
-std::array<float,2>{0.851532578f, 0.981728673f},
-std::array<float,2>{0.115037523f, 0.488919318f},
-std::array<float,2>{0.597344756f, 0.02799966f},
-std::array<float,2>{0.445898145f, 0.57880199f},
-std::array<float,2>{0.67772156f, 0.723463953f},
-std::array<float,2>{0.28881231f, 0.232311264f},
-std::array<float,2>{0.95009619f, 0.29927063f},
-std::array<float,2>{0.15563108f, 0.754435539f},
-std::array<float,2>{0.936360121f, 0.525810063f},
-std::array<float,2>{0.240383074f, 0.115514807f},
-std::array<float,2>{0.704471827f, 0.408069998f},
-std::array<float,2>{0.32480976f, 0.875774622f},
-std::array<float,2>{0.554585338f, 0.813041627f},
-std::array<float,2>{0.378675848f, 0.312562287f},
-std::array<float,2>{0.789591312f, 0.186043203f},
-std::array<float,2>{0.0423627757f, 0.648764789f},
-std::array<float,2>{0.929638505f, 0.989961624f},
-std::array<float,2>{0.249649063f, 0.482309788f},
-std::array<float,2>{0.715458632f, 0.000491019862f},
-std::array<float,2>{0.31793499f, 0.57013154f},
-std::array<float,2>{0.556231737f, 0.740015388f},
-std::array<float,2>{0.385559976f, 0.242001876f},
-std::array<float,2>{0.787955046f, 0.28417334f},
-std::array<float,2>{0.0345492288f, 0.774141133f},
-std::array<float,2>{0.858821571f, 0.50045383f},
-std::array<float,2>{0.124924541f, 0.101597965f},
-std::array<float,2>{0.605381787f, 0.435932159f},
-std::array<float,2>{0.442569911f, 0.895545959f},
-std::array<float,2>{0.682761192f, 0.832501471f},
-std::array<float,2>{0.289832681f, 0.339376867f},
-std::array<float,2>{0.938502848f, 0.158359826f},
-std::array<float,2>{0.146957949f, 0.626880229f},
-std::array<float,2>{0.750515223f, 0.788257539f},
-std::array<float,2>{0.0137739023f, 0.263044924f},
-std::array<float,2>{0.523688316f, 0.215612695f},
-std::array<float,2>{0.426015198f, 0.710861385f},
-std::array<float,2>{0.734357655f, 0.608129084f},
-std::array<float,2>{0.374098092f, 0.0429748371f},
-std::array<float,2>{0.894859493f, 0.462393045f},
-std::array<float,2>{0.218322709f, 0.966956615f},
-std::array<float,2>{0.984183133f, 0.684795558f},
-std::array<float,2>{0.165000916f, 0.129344165f},
-std::array<float,2>{0.642765403f, 0.353854686f},
-std::array<float,2>{0.265399843f, 0.856089771f},
-std::array<float,2>{0.582159162f, 0.918484926f},
-std::array<float,2>{0.476721019f, 0.402760655f},
-std::array<float,2>{0.822039008f, 0.0634157956f},
-std::array<float,2>{0.0887132958f, 0.54109019f},
-std::array<float,2>{0.959525466f, 0.869309604f},
-std::array<float,2>{0.135777369f, 0.360585541f},
-std::array<float,2>{0.658957481f, 0.141684398f},
-std::array<float,2>{0.303784877f, 0.656661153f},
-std::array<float,2>{0.620319724f, 0.552472413f},
-std::array<float,2>{0.461360574f, 0.0893323049f},
-std::array<float,2>{0.865131497f, 0.38962847f},
-std::array<float,2>{0.109366059f, 0.923072815f},
-std::array<float,2>{0.806987643f, 0.694296598f},
-std::array<float,2>{0.0526506901f, 0.191855267f},
-std::array<float,2>{0.535371721f, 0.279243708f},
-std::array<float,2>{0.394009948f, 0.802003503f},
-std::array<float,2>{0.702300727f, 0.944437504f},
-std::array<float,2>{0.329870939f, 0.452614039f},
-std::array<float,2>{0.909800112f, 0.062403921f},
-std::array<float,2>{0.222443208f, 0.624123216f},
-std::array<float,2>{0.84374851f, 0.880668998f},
-std::array<float,2>{0.0712750703f, 0.410641223f},
-std::array<float,2>{0.566809177f, 0.110296011f},
-std::array<float,2>{0.498981088f, 0.529851317f},
-std::array<float,2>{0.635244787f, 0.652712524f},
-std::array<float,2>{0.270827115f, 0.180755809f},
-std::array<float,2>{0.990534604f, 0.316687107f},
-std::array<float,2>{0.178705141f, 0.81652832f},
-std::array<float,2>{0.879690945f, 0.585147023f},
-std::array<float,2>{0.202932447f, 0.0248547271f},
-std::array<float,2>{0.741558909f, 0.487902343f},
-std::array<float,2>{0.356120378f, 0.978163958f},
-std::array<float,2>{0.513438106f, 0.752371967f},
-std::array<float,2>{0.417423636f, 0.302544385f},
-std::array<float,2>{0.775161743f, 0.227500677f},
-std::array<float,2>{0.0184804201f, 0.721261442f},
-std::array<float,2>{0.998677254f, 0.929896116f},
-std::array<float,2>{0.184141308f, 0.380170375f},
-std::array<float,2>{0.632222235f, 0.0794719681f},
-std::array<float,2>{0.279975057f, 0.555593371f},
-std::array<float,2>{0.575029194f, 0.664463162f},
-std::array<float,2>{0.486736119f, 0.152453035f},
-std::array<float,2>{0.82941705f, 0.37116304f},
-std::array<float,2>{0.0658668429f, 0.861016989f},
-std::array<float,2>{0.772320092f, 0.610980511f},
-std::array<float,2>{0.0285362583f, 0.049412813f},
-std::array<float,2>{0.505726516f, 0.442311883f},
-std::array<float,2>{0.407433629f, 0.951264203f},
-std::array<float,2>{0.749376178f, 0.806613445f},
-std::array<float,2>{0.348043531f, 0.269004226f},
-std::array<float,2>{0.886885703f, 0.195328996f},
-std::array<float,2>{0.195031151f, 0.698100567f},
-std::array<float,2>{0.868669093f, 0.82637167f},
-std::array<float,2>{0.0980953202f, 0.325003624f},
-std::array<float,2>{0.611901343f, 0.177752912f},
-std::array<float,2>{0.459331214f, 0.641637146f},
-std::array<float,2>{0.66566658f, 0.520510197f},
-std::array<float,2>{0.310127705f, 0.118164107f},
-std::array<float,2>{0.96145457f, 0.417003095f},
-std::array<float,2>{0.126237229f, 0.888680935f},
-std::array<float,2>{0.920414329f, 0.72933197f},
-std::array<float,2>{0.233049899f, 0.219817132f},
-std::array<float,2>{0.689495087f, 0.305477232f},
-std::array<float,2>{0.340865582f, 0.757924557f},
-std::array<float,2>{0.544522226f, 0.974421859f},
-std::array<float,2>{0.405891269f, 0.495114058f},
-std::array<float,2>{0.801518023f, 0.0193419345f},
-std::array<float,2>{0.060603518f, 0.593585432f},
-std::array<float,2>{0.901974618f, 0.772898972f},
-std::array<float,2>{0.205836385f, 0.28915289f},
-std::array<float,2>{0.719812155f, 0.24238871f},
-std::array<float,2>{0.361031622f, 0.749310613f},
-std::array<float,2>{0.522534728f, 0.570386827f},
-std::array<float,2>{0.434927821f, 0.0132079385f},
-std::array<float,2>{0.76059866f, 0.470564812f},
-std::array<float,2>{0.00556614064f, 0.995180726f},
-std::array<float,2>{0.813020289f, 0.63437438f},
-std::array<float,2>{0.0838604495f, 0.166753635f},
-std::array<float,2>{0.591594815f, 0.331855744f},
-std::array<float,2>{0.47255519f, 0.843575299f},
-std::array<float,2>{0.652675152f, 0.90273571f},
-std::array<float,2>{0.252932936f, 0.425369143f},
-std::array<float,2>{0.973749757f, 0.0953966528f},
-std::array<float,2>{0.158421367f, 0.509148777f},
-std::array<float,2>{0.796563625f, 0.959827662f},
-std::array<float,2>{0.0449244641f, 0.460792094f},
-std::array<float,2>{0.547045469f, 0.0389266983f},
-std::array<float,2>{0.381424367f, 0.599485219f},
-std::array<float,2>{0.709005594f, 0.715336144f},
-std::array<float,2>{0.32170099f, 0.207101867f},
-std::array<float,2>{0.931783557f, 0.255075127f},
-std::array<float,2>{0.235277161f, 0.796644866f},
-std::array<float,2>{0.948879957f, 0.537211895f},
-std::array<float,2>{0.150748491f, 0.0705342963f},
-std::array<float,2>{0.673593521f, 0.393294692f},
-std::array<float,2>{0.284779221f, 0.908041596f},
-std::array<float,2>{0.59867394f, 0.848726869f},
-std::array<float,2>{0.451364428f, 0.347655684f},
-std::array<float,2>{0.847241998f, 0.139851481f},
-std::array<float,2>{0.111303307f, 0.679148376f},
-std::array<float,2>{0.970084131f, 0.940391898f},
-std::array<float,2>{0.16089052f, 0.448981375f},
-std::array<float,2>{0.650906563f, 0.0552419238f},
-std::array<float,2>{0.256543547f, 0.618678808f},
-std::array<float,2>{0.5888592f, 0.687676787f},
-std::array<float,2>{0.472988337f, 0.190194592f},
-std::array<float,2>{0.817058802f, 0.273583978f},
-std::array<float,2>{0.0808592737f, 0.79904449f},
-std::array<float,2>{0.76474911f, 0.548405647f},
-std::array<float,2>{0.00218683691f, 0.0904394835f},
-std::array<float,2>{0.51843363f, 0.386506677f},
-std::array<float,2>{0.431391537f, 0.927191377f},
-std::array<float,2>{0.724093139f, 0.873517811f},
-std::array<float,2>{0.366591781f, 0.366954803f},
-std::array<float,2>{0.903087735f, 0.144717455f},
-std::array<float,2>{0.207521275f, 0.660211325f},
-std::array<float,2>{0.848624289f, 0.754122913f},
-std::array<float,2>{0.116209343f, 0.299389392f},
-std::array<float,2>{0.594238043f, 0.231840283f},
-std::array<float,2>{0.449008405f, 0.722714186f},
-std::array<float,2>{0.678833902f, 0.578424394f},
-std::array<float,2>{0.285458267f, 0.0275070015f},
-std::array<float,2>{0.952475488f, 0.488407016f},
-std::array<float,2>{0.153333604f, 0.982322156f},
-std::array<float,2>{0.934557617f, 0.648970425f},
-std::array<float,2>{0.239382461f, 0.185680017f},
-std::array<float,2>{0.705899f, 0.313190281f},
-std::array<float,2>{0.327349812f, 0.812725484f},
-std::array<float,2>{0.55099988f, 0.875334322f},
-std::array<float,2>{0.376004696f, 0.407606155f},
-std::array<float,2>{0.792219281f, 0.115978204f},
-std::array<float,2>{0.0405733213f, 0.525999248f},
-std::array<float,2>{0.885911703f, 0.829079628f},
-std::array<float,2>{0.187637836f, 0.343485624f},
-std::array<float,2>{0.743031681f, 0.160488322f},
-std::array<float,2>{0.343838125f, 0.632321358f},
-std::array<float,2>{0.503297567f, 0.506914973f},
-std::array<float,2>{0.413623363f, 0.108314157f},
-std::array<float,2>{0.767081559f, 0.431362271f},
-std::array<float,2>{0.026760269f, 0.894446433f},
-std::array<float,2>{0.835387886f, 0.737977326f},
-std::array<float,2>{0.0673689395f, 0.23597157f},
-std::array<float,2>{0.572618604f, 0.287633896f},
-std::array<float,2>{0.491760015f, 0.780009151f},
-std::array<float,2>{0.627751768f, 0.987360299f},
-std::array<float,2>{0.276015371f, 0.478100359f},
-std::array<float,2>{0.992318571f, 0.00732785976f},
-std::array<float,2>{0.181388929f, 0.565312147f},
-std::array<float,2>{0.799099982f, 0.91787231f},
-std::array<float,2>{0.0581112951f, 0.400737941f},
-std::array<float,2>{0.539179385f, 0.0691466257f},
-std::array<float,2>{0.400117487f, 0.543858528f},
-std::array<float,2>{0.693138719f, 0.682406545f},
-std::array<float,2>{0.337611884f, 0.125169545f},
-std::array<float,2>{0.915964723f, 0.356917918f},
-std::array<float,2>{0.226815388f, 0.851663888f},
-std::array<float,2>{0.96531266f, 0.603288591f},
-std::array<float,2>{0.132478535f, 0.0419775881f},
-std::array<float,2>{0.668501496f, 0.465710968f},
-std::array<float,2>{0.306171775f, 0.964284539f},
-std::array<float,2>{0.614922762f, 0.78442651f},
-std::array<float,2>{0.454319566f, 0.258377671f},
-std::array<float,2>{0.872563779f, 0.212693796f},
-std::array<float,2>{0.0948680192f, 0.706952453f},
-std::array<float,2>{0.911156893f, 0.900890589f},
-std::array<float,2>{0.225459456f, 0.427585721f},
-std::array<float,2>{0.696571112f, 0.100226581f},
-std::array<float,2>{0.333265305f, 0.514838874f},
-std::array<float,2>{0.533452034f, 0.639558017f},
-std::array<float,2>{0.396428943f, 0.170552358f},
-std::array<float,2>{0.809351742f, 0.33542344f},
-std::array<float,2>{0.0472390465f, 0.837042212f},
-std::array<float,2>{0.861311257f, 0.575535774f},
-std::array<float,2>{0.104366928f, 0.00872238167f},
-std::array<float,2>{0.624857306f, 0.474147052f},
-std::array<float,2>{0.465990484f, 0.997475028f},
-std::array<float,2>{0.66047138f, 0.766858697f},
-std::array<float,2>{0.298848152f, 0.293283641f},
-std::array<float,2>{0.955856144f, 0.248338133f},
-std::array<float,2>{0.13856566f, 0.745346367f},
-std::array<float,2>{0.777677834f, 0.845250547f},
-std::array<float,2>{0.0216556229f, 0.350600094f},
-std::array<float,2>{0.51144284f, 0.136272654f},
-std::array<float,2>{0.42065838f, 0.673251629f},
-std::array<float,2>{0.735700488f, 0.531995833f},
-std::array<float,2>{0.353428662f, 0.0759242475f},
-std::array<float,2>{0.875253022f, 0.395263404f},
-std::array<float,2>{0.19872354f, 0.910541892f},
-std::array<float,2>{0.987540424f, 0.712486446f},
-std::array<float,2>{0.172522649f, 0.203664109f},
-std::array<float,2>{0.640611887f, 0.252797544f},
-std::array<float,2>{0.268405765f, 0.789247692f},
-std::array<float,2>{0.56325388f, 0.955359519f},
-std::array<float,2>{0.495458037f, 0.455033362f},
-std::array<float,2>{0.838847637f, 0.0314452648f},
-std::array<float,2>{0.0761938766f, 0.59677422f},
-std::array<float,2>{0.945107996f, 0.811546385f},
-std::array<float,2>{0.143532798f, 0.270995647f},
-std::array<float,2>{0.687024653f, 0.202804774f},
-std::array<float,2>{0.296527952f, 0.701687872f},
-std::array<float,2>{0.608056307f, 0.616693258f},
-std::array<float,2>{0.440514684f, 0.0526529141f},
-std::array<float,2>{0.854472816f, 0.441112369f},
-std::array<float,2>{0.117720179f, 0.946370721f},
-std::array<float,2>{0.784905553f, 0.670306802f},
-std::array<float,2>{0.0352773778f, 0.150467247f},
-std::array<float,2>{0.561199903f, 0.369043201f},
-std::array<float,2>{0.390105098f, 0.864512622f},
-std::array<float,2>{0.714547813f, 0.936739862f},
-std::array<float,2>{0.31494689f, 0.37634325f},
-std::array<float,2>{0.922146022f, 0.0838573501f},
-std::array<float,2>{0.242407873f, 0.561902642f},
-std::array<float,2>{0.824834406f, 0.971267641f},
-std::array<float,2>{0.0929894075f, 0.499339044f},
-std::array<float,2>{0.581302762f, 0.0202369317f},
-std::array<float,2>{0.483388394f, 0.586645782f},
-std::array<float,2>{0.646800995f, 0.73106128f},
-std::array<float,2>{0.261097759f, 0.224205106f},
-std::array<float,2>{0.979883254f, 0.308735192f},
-std::array<float,2>{0.171468899f, 0.763681114f},
-std::array<float,2>{0.891362846f, 0.516810417f},
-std::array<float,2>{0.214137316f, 0.122755803f},
-std::array<float,2>{0.729456782f, 0.421493739f},
-std::array<float,2>{0.367518276f, 0.883592665f},
-std::array<float,2>{0.528692424f, 0.823568642f},
-std::array<float,2>{0.423687518f, 0.323276848f},
-std::array<float,2>{0.755215883f, 0.173714533f},
-std::array<float,2>{0.00800615083f, 0.646334946f},
-std::array<float,2>{0.899778366f, 0.995806217f},
-std::array<float,2>{0.203547537f, 0.469882309f},
-std::array<float,2>{0.722416461f, 0.0131326085f},
-std::array<float,2>{0.361454189f, 0.571267128f},
-std::array<float,2>{0.520352423f, 0.749570966f},
-std::array<float,2>{0.435703337f, 0.242905691f},
-std::array<float,2>{0.758431315f, 0.289804429f},
-std::array<float,2>{0.00625599176f, 0.773195446f},
-std::array<float,2>{0.814984977f, 0.509765506f},
-std::array<float,2>{0.0858147219f, 0.0949659124f},
-std::array<float,2>{0.592416048f, 0.424983561f},
-std::array<float,2>{0.469965309f, 0.903141201f},
-std::array<float,2>{0.655992866f, 0.842788517f},
-std::array<float,2>{0.251154393f, 0.331164241f},
-std::array<float,2>{0.974815428f, 0.166241005f},
-std::array<float,2>{0.158140257f, 0.633970559f},
-std::array<float,2>{0.793363333f, 0.796218753f},
-std::array<float,2>{0.0441313908f, 0.255814373f},
-std::array<float,2>{0.550537586f, 0.20785895f},
-std::array<float,2>{0.379094988f, 0.714990854f},
-std::array<float,2>{0.708219886f, 0.598969042f},
-std::array<float,2>{0.323158205f, 0.0384688824f},
-std::array<float,2>{0.931599736f, 0.4601264f},
-std::array<float,2>{0.237550914f, 0.959344208f},
-std::array<float,2>{0.946994424f, 0.679443896f},
-std::array<float,2>{0.149493858f, 0.140450388f},
-std::array<float,2>{0.67449975f, 0.347032934f},
-std::array<float,2>{0.283188581f, 0.849467874f},
-std::array<float,2>{0.601394773f, 0.907566428f},
-std::array<float,2>{0.451105893f, 0.392648429f},
-std::array<float,2>{0.844429433f, 0.0712644383f},
-std::array<float,2>{0.111469612f, 0.537649393f},
-std::array<float,2>{0.998007774f, 0.86077553f},
-std::array<float,2>{0.185794845f, 0.372042686f},
-std::array<float,2>{0.629886925f, 0.153117701f},
-std::array<float,2>{0.279186398f, 0.664598346f},
-std::array<float,2>{0.576948881f, 0.555110455f},
-std::array<float,2>{0.485317141f, 0.0796924084f},
-std::array<float,2>{0.830379009f, 0.380407482f},
-std::array<float,2>{0.0630192831f, 0.930455387f},
-std::array<float,2>{0.770642161f, 0.697660744f},
-std::array<float,2>{0.029575251f, 0.196117327f},
-std::array<float,2>{0.506974757f, 0.269307286f},
-std::array<float,2>{0.409678072f, 0.806004703f},
-std::array<float,2>{0.747918606f, 0.951823115f},
-std::array<float,2>{0.350052297f, 0.441761106f},
-std::array<float,2>{0.889801145f, 0.0492958501f},
-std::array<float,2>{0.191914633f, 0.610832572f},
-std::array<float,2>{0.870878398f, 0.889237046f},
-std::array<float,2>{0.0999944508f, 0.417863518f},
-std::array<float,2>{0.610731602f, 0.118720122f},
-std::array<float,2>{0.458904803f, 0.521019816f},
-std::array<float,2>{0.66719228f, 0.642465651f},
-std::array<float,2>{0.311068535f, 0.178585693f},
-std::array<float,2>{0.962960064f, 0.324521691f},
-std::array<float,2>{0.128413901f, 0.826890886f},
-std::array<float,2>{0.919590533f, 0.592972815f},
-std::array<float,2>{0.230813757f, 0.0189966615f},
-std::array<float,2>{0.689254224f, 0.494584948f},
-std::array<float,2>{0.34230867f, 0.973759711f},
-std::array<float,2>{0.544949889f, 0.758530796f},
-std::array<float,2>{0.403083444f, 0.305023611f},
-std::array<float,2>{0.803274632f, 0.220517546f},
-std::array<float,2>{0.0587423705f, 0.728740454f},
-std::array<float,2>{0.958974123f, 0.923425615f},
-std::array<float,2>{0.133540854f, 0.389006197f},
-std::array<float,2>{0.656344533f, 0.089392215f},
-std::array<float,2>{0.302430093f, 0.551846445f},
-std::array<float,2>{0.617913663f, 0.657109499f},
-std::array<float,2>{0.464119822f, 0.142166808f},
-std::array<float,2>{0.865331113f, 0.360907376f},
-std::array<float,2>{0.106930114f, 0.86996299f},
-std::array<float,2>{0.805006981f, 0.624714971f},
-std::array<float,2>{0.053788323f, 0.0618846789f},
-std::array<float,2>{0.537426949f, 0.452898681f},
-std::array<float,2>{0.391097486f, 0.945089817f},
-std::array<float,2>{0.699585855f, 0.802405834f},
-std::array<float,2>{0.330989599f, 0.278465122f},
-std::array<float,2>{0.907461166f, 0.192036465f},
-std::array<float,2>{0.219545573f, 0.693431973f},
-std::array<float,2>{0.840191662f, 0.817004204f},
-std::array<float,2>{0.0725506321f, 0.317130536f},
-std::array<float,2>{0.569441736f, 0.181258425f},
-std::array<float,2>{0.497399479f, 0.65283519f},
-std::array<float,2>{0.633945286f, 0.529465735f},
-std::array<float,2>{0.272999287f, 0.10983035f},
-std::array<float,2>{0.990033388f, 0.410804331f},
-std::array<float,2>{0.177702099f, 0.880100369f},
-std::array<float,2>{0.881708205f, 0.721027017f},
-std::array<float,2>{0.200825334f, 0.226989359f},
-std::array<float,2>{0.739873827f, 0.302088767f},
-std::array<float,2>{0.358884275f, 0.752681255f},
-std::array<float,2>{0.514419019f, 0.977737427f},
-std::array<float,2>{0.415926188f, 0.487788379f},
-std::array<float,2>{0.775623977f, 0.02522639f},
-std::array<float,2>{0.0165477935f, 0.585775137f},
-std::array<float,2>{0.927017748f, 0.77381283f},
-std::array<float,2>{0.247600332f, 0.283638924f},
-std::array<float,2>{0.718215883f, 0.241500109f},
-std::array<float,2>{0.318645954f, 0.739278078f},
-std::array<float,2>{0.558393836f, 0.56962347f},
-std::array<float,2>{0.383970469f, 0.000363681291f},
-std::array<float,2>{0.786990285f, 0.4818497f},
-std::array<float,2>{0.0326443389f, 0.989540279f},
-std::array<float,2>{0.856845498f, 0.625976741f},
-std::array<float,2>{0.12153282f, 0.158931121f},
-std::array<float,2>{0.603458166f, 0.33916226f},
-std::array<float,2>{0.444246203f, 0.832520902f},
-std::array<float,2>{0.679992259f, 0.896103323f},
-std::array<float,2>{0.291364372f, 0.436046273f},
-std::array<float,2>{0.94121176f, 0.102358602f},
-std::array<float,2>{0.144669414f, 0.500587463f},
-std::array<float,2>{0.752560079f, 0.967567384f},
-std::array<float,2>{0.0127723617f, 0.462814808f},
-std::array<float,2>{0.527204096f, 0.0437626168f},
-std::array<float,2>{0.428822637f, 0.607538998f},
-std::array<float,2>{0.731384695f, 0.710316956f},
-std::array<float,2>{0.372150719f, 0.21507895f},
-std::array<float,2>{0.897679031f, 0.263559878f},
-std::array<float,2>{0.2158411f, 0.788997471f},
-std::array<float,2>{0.982271612f, 0.541880369f},
-std::array<float,2>{0.167769f, 0.0628228188f},
-std::array<float,2>{0.64065069f, 0.402999967f},
-std::array<float,2>{0.263247758f, 0.918044746f},
-std::array<float,2>{0.584246874f, 0.855497777f},
-std::array<float,2>{0.478788286f, 0.35401696f},
-std::array<float,2>{0.823089719f, 0.129577249f},
-std::array<float,2>{0.0861723572f, 0.685205102f},
-std::array<float,2>{0.949537516f, 0.983443141f},
-std::array<float,2>{0.155881301f, 0.49074778f},
-std::array<float,2>{0.676986873f, 0.0301987901f},
-std::array<float,2>{0.288128912f, 0.58027035f},
-std::array<float,2>{0.597001791f, 0.726389587f},
-std::array<float,2>{0.445347488f, 0.233264118f},
-std::array<float,2>{0.850949466f, 0.297538072f},
-std::array<float,2>{0.114493035f, 0.756209612f},
-std::array<float,2>{0.78911078f, 0.524471045f},
-std::array<float,2>{0.0425792411f, 0.114316054f},
-std::array<float,2>{0.553718507f, 0.409541011f},
-std::array<float,2>{0.378231972f, 0.877577066f},
-std::array<float,2>{0.704617798f, 0.816217005f},
-std::array<float,2>{0.324484676f, 0.315517128f},
-std::array<float,2>{0.935829222f, 0.184409976f},
-std::array<float,2>{0.241181478f, 0.650721252f},
-std::array<float,2>{0.820198417f, 0.798790693f},
-std::array<float,2>{0.0790703446f, 0.275579274f},
-std::array<float,2>{0.586861432f, 0.18863824f},
-std::array<float,2>{0.47491616f, 0.690935135f},
-std::array<float,2>{0.65029484f, 0.61997205f},
-std::array<float,2>{0.254489064f, 0.0569032244f},
-std::array<float,2>{0.972116053f, 0.445914626f},
-std::array<float,2>{0.162656203f, 0.937891543f},
-std::array<float,2>{0.906045496f, 0.663662195f},
-std::array<float,2>{0.209801346f, 0.147628129f},
-std::array<float,2>{0.724654615f, 0.364251077f},
-std::array<float,2>{0.363302797f, 0.871518731f},
-std::array<float,2>{0.51681149f, 0.92967391f},
-std::array<float,2>{0.43280074f, 0.38466838f},
-std::array<float,2>{0.763332605f, 0.092138961f},
-std::array<float,2>{0.00013828995f, 0.550327301f},
-std::array<float,2>{0.917794287f, 0.854378402f},
-std::array<float,2>{0.230212808f, 0.359216839f},
-std::array<float,2>{0.695099413f, 0.128683731f},
-std::array<float,2>{0.339176506f, 0.67977494f},
-std::array<float,2>{0.542394519f, 0.545876145f},
-std::array<float,2>{0.400737792f, 0.0667908713f},
-std::array<float,2>{0.796938539f, 0.39937672f},
-std::array<float,2>{0.0551565774f, 0.91479212f},
-std::array<float,2>{0.874426067f, 0.705028117f},
-std::array<float,2>{0.0964170024f, 0.213608578f},
-std::array<float,2>{0.616453946f, 0.261694252f},
-std::array<float,2>{0.455135077f, 0.781479895f},
-std::array<float,2>{0.671394348f, 0.962643623f},
-std::array<float,2>{0.306877196f, 0.468695909f},
-std::array<float,2>{0.968701184f, 0.0403113589f},
-std::array<float,2>{0.129811257f, 0.604157209f},
-std::array<float,2>{0.768770337f, 0.891349852f},
-std::array<float,2>{0.0246307552f, 0.433286637f},
-std::array<float,2>{0.500915706f, 0.107030936f},
-std::array<float,2>{0.410527706f, 0.50451076f},
-std::array<float,2>{0.744432867f, 0.630412817f},
-std::array<float,2>{0.345854968f, 0.163137972f},
-std::array<float,2>{0.883894324f, 0.341700256f},
-std::array<float,2>{0.191247985f, 0.831772804f},
-std::array<float,2>{0.995084226f, 0.563593328f},
-std::array<float,2>{0.182631806f, 0.00443874206f},
-std::array<float,2>{0.625897408f, 0.479201317f},
-std::array<float,2>{0.274119735f, 0.985503018f},
-std::array<float,2>{0.571655512f, 0.778796792f},
-std::array<float,2>{0.488691121f, 0.285253316f},
-std::array<float,2>{0.832484245f, 0.237497434f},
-std::array<float,2>{0.0687011257f, 0.736029327f},
-std::array<float,2>{0.87713933f, 0.912213445f},
-std::array<float,2>{0.196510062f, 0.398274392f},
-std::array<float,2>{0.737502873f, 0.0766300857f},
-std::array<float,2>{0.354932636f, 0.534047306f},
-std::array<float,2>{0.509631336f, 0.675512075f},
-std::array<float,2>{0.419160843f, 0.133713558f},
-std::array<float,2>{0.781086862f, 0.347945333f},
-std::array<float,2>{0.0211935472f, 0.846140146f},
-std::array<float,2>{0.83649087f, 0.594072938f},
-std::array<float,2>{0.0750479624f, 0.0341665596f},
-std::array<float,2>{0.564720273f, 0.455443621f},
-std::array<float,2>{0.49241358f, 0.953420758f},
-std::array<float,2>{0.637580991f, 0.791090846f},
-std::array<float,2>{0.266481698f, 0.250022739f},
-std::array<float,2>{0.98518461f, 0.206858888f},
-std::array<float,2>{0.175772861f, 0.714599431f},
-std::array<float,2>{0.811028957f, 0.838739991f},
-std::array<float,2>{0.0498802289f, 0.332235187f},
-std::array<float,2>{0.531269193f, 0.169241861f},
-std::array<float,2>{0.397223353f, 0.637681127f},
-std::array<float,2>{0.697347343f, 0.511963964f},
-std::array<float,2>{0.335112035f, 0.099261716f},
-std::array<float,2>{0.913592577f, 0.427749068f},
-std::array<float,2>{0.224181101f, 0.899698913f},
-std::array<float,2>{0.954958737f, 0.742650867f},
-std::array<float,2>{0.139551282f, 0.247277826f},
-std::array<float,2>{0.663251758f, 0.295491695f},
-std::array<float,2>{0.297995538f, 0.769218028f},
-std::array<float,2>{0.622108519f, 0.999677777f},
-std::array<float,2>{0.468657702f, 0.475783587f},
-std::array<float,2>{0.861499488f, 0.00996615551f},
-std::array<float,2>{0.102196641f, 0.577933073f},
-std::array<float,2>{0.977327943f, 0.762885511f},
-std::array<float,2>{0.169377699f, 0.312465668f},
-std::array<float,2>{0.646038532f, 0.226365089f},
-std::array<float,2>{0.259463429f, 0.734036684f},
-std::array<float,2>{0.579324424f, 0.58948642f},
-std::array<float,2>{0.482168347f, 0.0218432359f},
-std::array<float,2>{0.828042865f, 0.497687578f},
-std::array<float,2>{0.0904562324f, 0.969080269f},
-std::array<float,2>{0.75617069f, 0.648048222f},
-std::array<float,2>{0.0097713219f, 0.175114453f},
-std::array<float,2>{0.529900253f, 0.320755482f},
-std::array<float,2>{0.423979133f, 0.822029829f},
-std::array<float,2>{0.726863086f, 0.885213256f},
-std::array<float,2>{0.370070994f, 0.419549018f},
-std::array<float,2>{0.894113183f, 0.123198442f},
-std::array<float,2>{0.211338222f, 0.518608451f},
-std::array<float,2>{0.85220629f, 0.948535085f},
-std::array<float,2>{0.119463019f, 0.438375443f},
-std::array<float,2>{0.606741846f, 0.0541731417f},
-std::array<float,2>{0.437726796f, 0.614496112f},
-std::array<float,2>{0.684257865f, 0.700349867f},
-std::array<float,2>{0.293561935f, 0.200306088f},
-std::array<float,2>{0.941694736f, 0.273109078f},
-std::array<float,2>{0.140664369f, 0.809907377f},
-std::array<float,2>{0.925484836f, 0.559221208f},
-std::array<float,2>{0.245264262f, 0.0842337832f},
-std::array<float,2>{0.712769806f, 0.377775103f},
-std::array<float,2>{0.313958198f, 0.935432434f},
-std::array<float,2>{0.560121953f, 0.866600394f},
-std::array<float,2>{0.387782514f, 0.370530367f},
-std::array<float,2>{0.78150624f, 0.149539158f},
-std::array<float,2>{0.0371377617f, 0.669280529f},
-std::array<float,2>{0.932480276f, 0.957061887f},
-std::array<float,2>{0.234646261f, 0.458740026f},
-std::array<float,2>{0.709681511f, 0.0361600816f},
-std::array<float,2>{0.321845025f, 0.601014793f},
-std::array<float,2>{0.547492683f, 0.717244446f},
-std::array<float,2>{0.380942553f, 0.210306093f},
-std::array<float,2>{0.796311736f, 0.256983221f},
-std::array<float,2>{0.0455400869f, 0.793828547f},
-std::array<float,2>{0.846934676f, 0.535540462f},
-std::array<float,2>{0.110571846f, 0.0732076243f},
-std::array<float,2>{0.5994519f, 0.392433584f},
-std::array<float,2>{0.451843053f, 0.908477247f},
-std::array<float,2>{0.673247397f, 0.849704146f},
-std::array<float,2>{0.284353316f, 0.345342129f},
-std::array<float,2>{0.948557496f, 0.136746764f},
-std::array<float,2>{0.151033998f, 0.676885486f},
-std::array<float,2>{0.760069191f, 0.770561457f},
-std::array<float,2>{0.0051349299f, 0.291582942f},
-std::array<float,2>{0.523278475f, 0.244642332f},
-std::array<float,2>{0.435362309f, 0.746526837f},
-std::array<float,2>{0.720460296f, 0.573638558f},
-std::array<float,2>{0.360698789f, 0.014504699f},
-std::array<float,2>{0.901729763f, 0.472041965f},
-std::array<float,2>{0.205211744f, 0.992488623f},
-std::array<float,2>{0.974468172f, 0.635321975f},
-std::array<float,2>{0.159101099f, 0.165801227f},
-std::array<float,2>{0.653010905f, 0.328804255f},
-std::array<float,2>{0.25384587f, 0.840969622f},
-std::array<float,2>{0.590856433f, 0.904765248f},
-std::array<float,2>{0.471979707f, 0.422632009f},
-std::array<float,2>{0.812648296f, 0.0959599763f},
-std::array<float,2>{0.0833610296f, 0.511307836f},
-std::array<float,2>{0.961356819f, 0.824728251f},
-std::array<float,2>{0.126929492f, 0.327862203f},
-std::array<float,2>{0.665357232f, 0.177705988f},
-std::array<float,2>{0.309596598f, 0.643884122f},
-std::array<float,2>{0.611405671f, 0.5217278f},
-std::array<float,2>{0.459722221f, 0.120963678f},
-std::array<float,2>{0.868555665f, 0.414384782f},
-std::array<float,2>{0.0985982269f, 0.886983812f},
-std::array<float,2>{0.801181555f, 0.727025926f},
-std::array<float,2>{0.0613466389f, 0.221669689f},
-std::array<float,2>{0.543956101f, 0.308041006f},
-std::array<float,2>{0.405382514f, 0.7607283f},
-std::array<float,2>{0.690023363f, 0.975345314f},
-std::array<float,2>{0.341540515f, 0.493451566f},
-std::array<float,2>{0.920222044f, 0.0174170416f},
-std::array<float,2>{0.232722759f, 0.591193736f},
-std::array<float,2>{0.829878747f, 0.933250129f},
-std::array<float,2>{0.0659429953f, 0.381391823f},
-std::array<float,2>{0.574292421f, 0.0818004832f},
-std::array<float,2>{0.486943245f, 0.558027267f},
-std::array<float,2>{0.632392228f, 0.666750491f},
-std::array<float,2>{0.27947849f, 0.155670375f},
-std::array<float,2>{0.998506367f, 0.373105407f},
-std::array<float,2>{0.183770716f, 0.862434208f},
-std::array<float,2>{0.887547016f, 0.613125503f},
-std::array<float,2>{0.19463481f, 0.048747614f},
-std::array<float,2>{0.749821782f, 0.444727927f},
-std::array<float,2>{0.348348439f, 0.949632168f},
-std::array<float,2>{0.505017102f, 0.808469892f},
-std::array<float,2>{0.408007413f, 0.267388046f},
-std::array<float,2>{0.771535158f, 0.197337225f},
-std::array<float,2>{0.0290154424f, 0.696739256f},
-std::array<float,2>{0.990914464f, 0.881013751f},
-std::array<float,2>{0.17785576f, 0.413382381f},
-std::array<float,2>{0.635334909f, 0.111994959f},
-std::array<float,2>{0.271136791f, 0.52862066f},
-std::array<float,2>{0.567125678f, 0.656168222f},
-std::array<float,2>{0.498401642f, 0.182204023f},
-std::array<float,2>{0.842823744f, 0.319601327f},
-std::array<float,2>{0.0704332665f, 0.81858027f},
-std::array<float,2>{0.774433315f, 0.58345145f},
-std::array<float,2>{0.0177390613f, 0.025759114f},
-std::array<float,2>{0.512779176f, 0.48456338f},
-std::array<float,2>{0.417674989f, 0.978657901f},
-std::array<float,2>{0.742171109f, 0.751602232f},
-std::array<float,2>{0.35577035f, 0.30354321f},
-std::array<float,2>{0.879008889f, 0.228813037f},
-std::array<float,2>{0.202485368f, 0.720375478f},
-std::array<float,2>{0.864523411f, 0.868140519f},
-std::array<float,2>{0.108508982f, 0.36179471f},
-std::array<float,2>{0.620873451f, 0.142859697f},
-std::array<float,2>{0.461759597f, 0.65860939f},
-std::array<float,2>{0.658486009f, 0.553260148f},
-std::array<float,2>{0.304229856f, 0.0875879228f},
-std::array<float,2>{0.959012926f, 0.386782527f},
-std::array<float,2>{0.136568889f, 0.924651504f},
-std::array<float,2>{0.909488559f, 0.692490518f},
-std::array<float,2>{0.222038582f, 0.193768814f},
-std::array<float,2>{0.702860355f, 0.279441833f},
-std::array<float,2>{0.329164356f, 0.803990722f},
-std::array<float,2>{0.535891593f, 0.941785455f},
-std::array<float,2>{0.394518107f, 0.450872868f},
-std::array<float,2>{0.807243645f, 0.059178587f},
-std::array<float,2>{0.0521250926f, 0.622243285f},
-std::array<float,2>{0.895324767f, 0.785826504f},
-std::array<float,2>{0.217863604f, 0.265605658f},
-std::array<float,2>{0.733801186f, 0.217474982f},
-std::array<float,2>{0.374994725f, 0.708905399f},
-std::array<float,2>{0.524315f, 0.605901241f},
-std::array<float,2>{0.426322132f, 0.0464121886f},
-std::array<float,2>{0.750259459f, 0.46368894f},
-std::array<float,2>{0.0142607698f, 0.96510911f},
-std::array<float,2>{0.821644068f, 0.686586797f},
-std::array<float,2>{0.0882600099f, 0.131657511f},
-std::array<float,2>{0.582636714f, 0.353410721f},
-std::array<float,2>{0.477096796f, 0.858013272f},
-std::array<float,2>{0.643092275f, 0.921741366f},
-std::array<float,2>{0.264802456f, 0.405703455f},
-std::array<float,2>{0.983792245f, 0.0650394335f},
-std::array<float,2>{0.164098203f, 0.539712846f},
-std::array<float,2>{0.787448108f, 0.991441607f},
-std::array<float,2>{0.0349693708f, 0.483691841f},
-std::array<float,2>{0.555778742f, 0.00329291564f},
-std::array<float,2>{0.384842634f, 0.566951513f},
-std::array<float,2>{0.714950025f, 0.741367817f},
-std::array<float,2>{0.31785962f, 0.240141839f},
-std::array<float,2>{0.92893672f, 0.283086985f},
-std::array<float,2>{0.249156475f, 0.775603771f},
-std::array<float,2>{0.939179897f, 0.502934396f},
-std::array<float,2>{0.147346348f, 0.10517405f},
-std::array<float,2>{0.683146298f, 0.433777422f},
-std::array<float,2>{0.289412022f, 0.897376359f},
-std::array<float,2>{0.60490644f, 0.834646702f},
-std::array<float,2>{0.443298101f, 0.336218417f},
-std::array<float,2>{0.859184206f, 0.157190338f},
-std::array<float,2>{0.124099903f, 0.62814343f},
-std::array<float,2>{0.993818521f, 0.984732985f},
-std::array<float,2>{0.18036671f, 0.479918659f},
-std::array<float,2>{0.628281236f, 0.00551820965f},
-std::array<float,2>{0.276986003f, 0.562811732f},
-std::array<float,2>{0.573647678f, 0.734633744f},
-std::array<float,2>{0.490648091f, 0.236379027f},
-std::array<float,2>{0.834330261f, 0.286342204f},
-std::array<float,2>{0.0682741553f, 0.77750802f},
-std::array<float,2>{0.766543984f, 0.504960656f},
-std::array<float,2>{0.0256783944f, 0.106209785f},
-std::array<float,2>{0.502091706f, 0.43237406f},
-std::array<float,2>{0.412408292f, 0.892194867f},
-std::array<float,2>{0.744073689f, 0.830371618f},
-std::array<float,2>{0.345501482f, 0.340521932f},
-std::array<float,2>{0.885735571f, 0.162183031f},
-std::array<float,2>{0.188911155f, 0.629197657f},
-std::array<float,2>{0.871204019f, 0.78317523f},
-std::array<float,2>{0.0941871628f, 0.260123879f},
-std::array<float,2>{0.614171147f, 0.214649394f},
-std::array<float,2>{0.453802496f, 0.703647017f},
-std::array<float,2>{0.669833362f, 0.605147839f},
-std::array<float,2>{0.305139393f, 0.0397782139f},
-std::array<float,2>{0.96671921f, 0.467655152f},
-std::array<float,2>{0.131234005f, 0.961503804f},
-std::array<float,2>{0.914527118f, 0.681461155f},
-std::array<float,2>{0.228324205f, 0.127003223f},
-std::array<float,2>{0.692014039f, 0.357962459f},
-std::array<float,2>{0.336656094f, 0.854818583f},
-std::array<float,2>{0.540782094f, 0.91541189f},
-std::array<float,2>{0.398602664f, 0.400100917f},
-std::array<float,2>{0.800557017f, 0.0681772754f},
-std::array<float,2>{0.0570796989f, 0.54604876f},
-std::array<float,2>{0.903989434f, 0.872917891f},
-std::array<float,2>{0.208118618f, 0.364766419f},
-std::array<float,2>{0.723249018f, 0.146946788f},
-std::array<float,2>{0.365924805f, 0.663030326f},
-std::array<float,2>{0.518641829f, 0.549749315f},
-std::array<float,2>{0.429715931f, 0.0936741531f},
-std::array<float,2>{0.763797641f, 0.38282752f},
-std::array<float,2>{0.00330495718f, 0.92778039f},
-std::array<float,2>{0.817797661f, 0.689715385f},
-std::array<float,2>{0.0817687735f, 0.187612489f},
-std::array<float,2>{0.589285791f, 0.276554078f},
-std::array<float,2>{0.474551708f, 0.79707092f},
-std::array<float,2>{0.652182579f, 0.938951313f},
-std::array<float,2>{0.256926775f, 0.44649294f},
-std::array<float,2>{0.969034791f, 0.0584216341f},
-std::array<float,2>{0.161685735f, 0.620868742f},
-std::array<float,2>{0.791407883f, 0.878872335f},
-std::array<float,2>{0.0398427807f, 0.408343345f},
-std::array<float,2>{0.55182147f, 0.113519751f},
-std::array<float,2>{0.375575215f, 0.523677826f},
-std::array<float,2>{0.706102788f, 0.651419759f},
-std::array<float,2>{0.32628113f, 0.185170382f},
-std::array<float,2>{0.934970975f, 0.315095991f},
-std::array<float,2>{0.238370031f, 0.815411925f},
-std::array<float,2>{0.952006996f, 0.581463635f},
-std::array<float,2>{0.152986646f, 0.0303767435f},
-std::array<float,2>{0.677865267f, 0.492174029f},
-std::array<float,2>{0.286370516f, 0.982450426f},
-std::array<float,2>{0.595418096f, 0.756847084f},
-std::array<float,2>{0.448046058f, 0.297894269f},
-std::array<float,2>{0.849359453f, 0.234124959f},
-std::array<float,2>{0.116784371f, 0.724753976f},
-std::array<float,2>{0.923106551f, 0.934299409f},
-std::array<float,2>{0.243851408f, 0.378244162f},
-std::array<float,2>{0.713198483f, 0.0850509107f},
-std::array<float,2>{0.316229373f, 0.560516715f},
-std::array<float,2>{0.56202811f, 0.668887675f},
-std::array<float,2>{0.389500558f, 0.149198115f},
-std::array<float,2>{0.783412993f, 0.369455278f},
-std::array<float,2>{0.0363795534f, 0.866063952f},
-std::array<float,2>{0.854793787f, 0.613392889f},
-std::array<float,2>{0.118798949f, 0.0531857684f},
-std::array<float,2>{0.608855665f, 0.438529968f},
-std::array<float,2>{0.440136105f, 0.947974026f},
-std::array<float,2>{0.685865045f, 0.809114635f},
-std::array<float,2>{0.295525908f, 0.271736175f},
-std::array<float,2>{0.944069862f, 0.199460745f},
-std::array<float,2>{0.144407347f, 0.699712813f},
-std::array<float,2>{0.754389524f, 0.821054697f},
-std::array<float,2>{0.00934665836f, 0.321395427f},
-std::array<float,2>{0.528279483f, 0.174711332f},
-std::array<float,2>{0.422752708f, 0.647432804f},
-std::array<float,2>{0.730457127f, 0.51853466f},
-std::array<float,2>{0.368677676f, 0.124548167f},
-std::array<float,2>{0.891881168f, 0.418568343f},
-std::array<float,2>{0.213199422f, 0.886697114f},
-std::array<float,2>{0.9789837f, 0.732945383f},
-std::array<float,2>{0.170885324f, 0.224786848f},
-std::array<float,2>{0.647730649f, 0.31148988f},
-std::array<float,2>{0.260022879f, 0.761933744f},
-std::array<float,2>{0.580245316f, 0.970092058f},
-std::array<float,2>{0.483671516f, 0.496138155f},
-std::array<float,2>{0.825421572f, 0.0233949311f},
-std::array<float,2>{0.0926739573f, 0.588647127f},
-std::array<float,2>{0.956453681f, 0.767728746f},
-std::array<float,2>{0.13699545f, 0.296398431f},
-std::array<float,2>{0.661710739f, 0.246211365f},
-std::array<float,2>{0.300061554f, 0.743896663f},
-std::array<float,2>{0.623693764f, 0.576371908f},
-std::array<float,2>{0.465353459f, 0.0110201752f},
-std::array<float,2>{0.859824002f, 0.475497276f},
-std::array<float,2>{0.104956567f, 0.998708487f},
-std::array<float,2>{0.809630513f, 0.63840127f},
-std::array<float,2>{0.0485700332f, 0.168713868f},
-std::array<float,2>{0.535066485f, 0.33316794f},
-std::array<float,2>{0.395140648f, 0.839113116f},
-std::array<float,2>{0.695838034f, 0.899215341f},
-std::array<float,2>{0.332705051f, 0.428869426f},
-std::array<float,2>{0.910208702f, 0.0983145237f},
-std::array<float,2>{0.226056471f, 0.513584495f},
-std::array<float,2>{0.838994622f, 0.954585314f},
-std::array<float,2>{0.0780340061f, 0.456755728f},
-std::array<float,2>{0.563678086f, 0.0345747136f},
-std::array<float,2>{0.494559258f, 0.594980955f},
-std::array<float,2>{0.638734281f, 0.713693678f},
-std::array<float,2>{0.269140363f, 0.205810547f},
-std::array<float,2>{0.987042904f, 0.251147956f},
-std::array<float,2>{0.173176989f, 0.792821825f},
-std::array<float,2>{0.876691282f, 0.53478545f},
-std::array<float,2>{0.198186263f, 0.078078635f},
-std::array<float,2>{0.73508513f, 0.397142112f},
-std::array<float,2>{0.351588249f, 0.913744569f},
-std::array<float,2>{0.509841323f, 0.847606242f},
-std::array<float,2>{0.421109915f, 0.349515676f},
-std::array<float,2>{0.778846264f, 0.134041592f},
-std::array<float,2>{0.0229540132f, 0.673952699f},
-std::array<float,2>{0.889420271f, 0.950520098f},
-std::array<float,2>{0.19300124f, 0.443508804f},
-std::array<float,2>{0.74613297f, 0.047071781f},
-std::array<float,2>{0.350909859f, 0.612249851f},
-std::array<float,2>{0.505925417f, 0.695976615f},
-std::array<float,2>{0.409175038f, 0.198621154f},
-std::array<float,2>{0.770076334f, 0.266585469f},
-std::array<float,2>{0.0308643542f, 0.807592452f},
-std::array<float,2>{0.831843615f, 0.556764066f},
-std::array<float,2>{0.0636896789f, 0.0810004175f},
-std::array<float,2>{0.57716924f, 0.382107735f},
-std::array<float,2>{0.486212969f, 0.931879699f},
-std::array<float,2>{0.629379928f, 0.862226188f},
-std::array<float,2>{0.277462602f, 0.37476787f},
-std::array<float,2>{0.996442676f, 0.154496133f},
-std::array<float,2>{0.187321186f, 0.667331517f},
-std::array<float,2>{0.803721309f, 0.761453807f},
-std::array<float,2>{0.060318917f, 0.307165176f},
-std::array<float,2>{0.546176493f, 0.222592831f},
-std::array<float,2>{0.403894126f, 0.728034616f},
-std::array<float,2>{0.688115358f, 0.590687275f},
-std::array<float,2>{0.343052715f, 0.0164440721f},
-std::array<float,2>{0.91889447f, 0.492491007f},
-std::array<float,2>{0.231991664f, 0.975845158f},
-std::array<float,2>{0.964051485f, 0.642975569f},
-std::array<float,2>{0.127108544f, 0.176579386f},
-std::array<float,2>{0.666210413f, 0.326312631f},
-std::array<float,2>{0.312194884f, 0.825891137f},
-std::array<float,2>{0.609894097f, 0.888591945f},
-std::array<float,2>{0.45719853f, 0.41523543f},
-std::array<float,2>{0.869536221f, 0.119860761f},
-std::array<float,2>{0.101019897f, 0.522949457f},
-std::array<float,2>{0.976195037f, 0.840103388f},
-std::array<float,2>{0.156331897f, 0.329700589f},
-std::array<float,2>{0.65434742f, 0.164605752f},
-std::array<float,2>{0.250165194f, 0.636615455f},
-std::array<float,2>{0.593359172f, 0.510112762f},
-std::array<float,2>{0.468985885f, 0.0971954763f},
-std::array<float,2>{0.816068769f, 0.422928631f},
-std::array<float,2>{0.0848280564f, 0.905920506f},
-std::array<float,2>{0.759209335f, 0.747755885f},
-std::array<float,2>{0.00732752681f, 0.245934933f},
-std::array<float,2>{0.520525038f, 0.292011827f},
-std::array<float,2>{0.436882228f, 0.769662082f},
-std::array<float,2>{0.721157432f, 0.993636072f},
-std::array<float,2>{0.362338573f, 0.470879972f},
-std::array<float,2>{0.899066508f, 0.0154478773f},
-std::array<float,2>{0.204779506f, 0.572637975f},
-std::array<float,2>{0.844923854f, 0.909239233f},
-std::array<float,2>{0.112357482f, 0.390714169f},
-std::array<float,2>{0.600222111f, 0.0737444758f},
-std::array<float,2>{0.44956854f, 0.536947906f},
-std::array<float,2>{0.675140083f, 0.676114976f},
-std::array<float,2>{0.281284958f, 0.138048589f},
-std::array<float,2>{0.945544302f, 0.344300956f},
-std::array<float,2>{0.148557842f, 0.851011872f},
-std::array<float,2>{0.929799914f, 0.600161314f},
-std::array<float,2>{0.236996084f, 0.0358085968f},
-std::array<float,2>{0.707056522f, 0.45770824f},
-std::array<float,2>{0.324065745f, 0.958855152f},
-std::array<float,2>{0.549223244f, 0.79444474f},
-std::array<float,2>{0.380784452f, 0.256739944f},
-std::array<float,2>{0.794435203f, 0.209509969f},
-std::array<float,2>{0.0431836806f, 0.718375504f},
-std::array<float,2>{0.940288723f, 0.898038149f},
-std::array<float,2>{0.146105319f, 0.434645265f},
-std::array<float,2>{0.680717409f, 0.104430862f},
-std::array<float,2>{0.292148322f, 0.502355695f},
-std::array<float,2>{0.601831794f, 0.627254128f},
-std::array<float,2>{0.444633126f, 0.158145368f},
-std::array<float,2>{0.856343091f, 0.337722629f},
-std::array<float,2>{0.122848049f, 0.835705161f},
-std::array<float,2>{0.786120713f, 0.567839921f},
-std::array<float,2>{0.032067474f, 0.00197890936f},
-std::array<float,2>{0.557355404f, 0.48252061f},
-std::array<float,2>{0.383502394f, 0.990845501f},
-std::array<float,2>{0.716809213f, 0.776370704f},
-std::array<float,2>{0.31948626f, 0.281975865f},
-std::array<float,2>{0.925827384f, 0.238514066f},
-std::array<float,2>{0.246512055f, 0.740959167f},
-std::array<float,2>{0.823720992f, 0.859321356f},
-std::array<float,2>{0.0871407017f, 0.352396905f},
-std::array<float,2>{0.585672915f, 0.132173479f},
-std::array<float,2>{0.479492903f, 0.685636878f},
-std::array<float,2>{0.642323673f, 0.540121198f},
-std::array<float,2>{0.261766642f, 0.0658266097f},
-std::array<float,2>{0.98130852f, 0.404561728f},
-std::array<float,2>{0.166739136f, 0.92024982f},
-std::array<float,2>{0.896954179f, 0.707992733f},
-std::array<float,2>{0.2155554f, 0.218037531f},
-std::array<float,2>{0.732366264f, 0.264380813f},
-std::array<float,2>{0.371967554f, 0.786824107f},
-std::array<float,2>{0.526267886f, 0.966128588f},
-std::array<float,2>{0.428540438f, 0.46424377f},
-std::array<float,2>{0.753108561f, 0.0449604765f},
-std::array<float,2>{0.0123564135f, 0.60731405f},
-std::array<float,2>{0.907114029f, 0.803491414f},
-std::array<float,2>{0.220202327f, 0.280654967f},
-std::array<float,2>{0.70114392f, 0.195152879f},
-std::array<float,2>{0.332006484f, 0.692080975f},
-std::array<float,2>{0.538917243f, 0.622017264f},
-std::array<float,2>{0.392170578f, 0.0601329952f},
-std::array<float,2>{0.805720866f, 0.44964686f},
-std::array<float,2>{0.0532825217f, 0.942854345f},
-std::array<float,2>{0.866355956f, 0.660052061f},
-std::array<float,2>{0.105638839f, 0.143593594f},
-std::array<float,2>{0.618888497f, 0.363188505f},
-std::array<float,2>{0.46319133f, 0.869122863f},
-std::array<float,2>{0.657714605f, 0.92481339f},
-std::array<float,2>{0.301466733f, 0.387795568f},
-std::array<float,2>{0.957718909f, 0.0861133561f},
-std::array<float,2>{0.133791476f, 0.554137647f},
-std::array<float,2>{0.776976705f, 0.980461419f},
-std::array<float,2>{0.0166776367f, 0.485396028f},
-std::array<float,2>{0.515079975f, 0.02701311f},
-std::array<float,2>{0.414188743f, 0.582045197f},
-std::array<float,2>{0.738451421f, 0.719278276f},
-std::array<float,2>{0.35815379f, 0.229931414f},
-std::array<float,2>{0.882708907f, 0.304388523f},
-std::array<float,2>{0.199310809f, 0.750196338f},
-std::array<float,2>{0.988832355f, 0.527421713f},
-std::array<float,2>{0.176612049f, 0.112623893f},
-std::array<float,2>{0.633350849f, 0.412696779f},
-std::array<float,2>{0.272455871f, 0.882031441f},
-std::array<float,2>{0.569033623f, 0.819369435f},
-std::array<float,2>{0.496293992f, 0.31854099f},
-std::array<float,2>{0.841692626f, 0.182732627f},
-std::array<float,2>{0.0733445585f, 0.654969513f},
-std::array<float,2>{0.967380106f, 0.963160396f},
-std::array<float,2>{0.130053267f, 0.466726273f},
-std::array<float,2>{0.670599878f, 0.0429160483f},
-std::array<float,2>{0.308522046f, 0.601639032f},
-std::array<float,2>{0.615726113f, 0.705721498f},
-std::array<float,2>{0.456780225f, 0.211652458f},
-std::array<float,2>{0.873437107f, 0.259484947f},
-std::array<float,2>{0.0968326926f, 0.783979833f},
-std::array<float,2>{0.798162639f, 0.544315994f},
-std::array<float,2>{0.0561850294f, 0.0696059391f},
-std::array<float,2>{0.541872978f, 0.402015418f},
-std::array<float,2>{0.401570469f, 0.916157961f},
-std::array<float,2>{0.693754375f, 0.852729857f},
-std::array<float,2>{0.337948203f, 0.355793566f},
-std::array<float,2>{0.916259348f, 0.126619086f},
-std::array<float,2>{0.229000941f, 0.683009923f},
-std::array<float,2>{0.833552957f, 0.781163394f},
-std::array<float,2>{0.0694326162f, 0.28872636f},
-std::array<float,2>{0.570434928f, 0.234938011f},
-std::array<float,2>{0.489474893f, 0.736669898f},
-std::array<float,2>{0.62631619f, 0.566101611f},
-std::array<float,2>{0.274894297f, 0.00617234129f},
-std::array<float,2>{0.995213568f, 0.476997077f},
-std::array<float,2>{0.181755751f, 0.987261713f},
-std::array<float,2>{0.883035123f, 0.630922019f},
-std::array<float,2>{0.189656913f, 0.161873117f},
-std::array<float,2>{0.745343626f, 0.342515081f},
-std::array<float,2>{0.346873373f, 0.830035806f},
-std::array<float,2>{0.501311243f, 0.892645061f},
-std::array<float,2>{0.411323786f, 0.43020153f},
-std::array<float,2>{0.768550515f, 0.108909108f},
-std::array<float,2>{0.0234642848f, 0.506419718f},
-std::array<float,2>{0.937300265f, 0.814215183f},
-std::array<float,2>{0.241313055f, 0.314326853f},
-std::array<float,2>{0.703214049f, 0.187299058f},
-std::array<float,2>{0.326025873f, 0.650352895f},
-std::array<float,2>{0.552905142f, 0.52641958f},
-std::array<float,2>{0.37753731f, 0.116506189f},
-std::array<float,2>{0.790508866f, 0.407201529f},
-std::array<float,2>{0.0417642035f, 0.876165926f},
-std::array<float,2>{0.849968493f, 0.723686755f},
-std::array<float,2>{0.114156887f, 0.231078535f},
-std::array<float,2>{0.595790923f, 0.300645292f},
-std::array<float,2>{0.446432561f, 0.755753458f},
-std::array<float,2>{0.676225007f, 0.980869889f},
-std::array<float,2>{0.287264347f, 0.489956677f},
-std::array<float,2>{0.950694323f, 0.0289173592f},
-std::array<float,2>{0.154882342f, 0.579169095f},
-std::array<float,2>{0.761781991f, 0.926725864f},
-std::array<float,2>{0.00111101859f, 0.385452867f},
-std::array<float,2>{0.516563416f, 0.0911120176f},
-std::array<float,2>{0.431956023f, 0.54706651f},
-std::array<float,2>{0.72594291f, 0.661856115f},
-std::array<float,2>{0.364493132f, 0.146028683f},
-std::array<float,2>{0.905180275f, 0.365968615f},
-std::array<float,2>{0.210554689f, 0.874975264f},
-std::array<float,2>{0.971341848f, 0.617542744f},
-std::array<float,2>{0.163666308f, 0.0560782626f},
-std::array<float,2>{0.648475945f, 0.44742614f},
-std::array<float,2>{0.255457163f, 0.940535069f},
-std::array<float,2>{0.587236345f, 0.800504386f},
-std::array<float,2>{0.476094246f, 0.275276631f},
-std::array<float,2>{0.818381429f, 0.190890774f},
-std::array<float,2>{0.0796981603f, 0.688547432f},
-std::array<float,2>{0.893463075f, 0.884009898f},
-std::array<float,2>{0.212203875f, 0.420749575f},
-std::array<float,2>{0.728274703f, 0.121549875f},
-std::array<float,2>{0.370846808f, 0.515706062f},
-std::array<float,2>{0.530284762f, 0.645154357f},
-std::array<float,2>{0.425678372f, 0.172188237f},
-std::array<float,2>{0.757723093f, 0.322341293f},
-std::array<float,2>{0.011379269f, 0.822782815f},
-std::array<float,2>{0.826890886f, 0.58723402f},
-std::array<float,2>{0.0913444534f, 0.020727424f},
-std::array<float,2>{0.578932881f, 0.498960525f},
-std::array<float,2>{0.480594963f, 0.972506344f},
-std::array<float,2>{0.645195305f, 0.765249729f},
-std::array<float,2>{0.257821381f, 0.310093403f},
-std::array<float,2>{0.977617919f, 0.222943231f},
-std::array<float,2>{0.168672442f, 0.731890023f},
-std::array<float,2>{0.782506883f, 0.863453448f},
-std::array<float,2>{0.0384170227f, 0.367973387f},
-std::array<float,2>{0.558953524f, 0.151636481f},
-std::array<float,2>{0.387566417f, 0.671515942f},
-std::array<float,2>{0.711411417f, 0.56148982f},
-std::array<float,2>{0.312832743f, 0.0828951299f},
-std::array<float,2>{0.923902214f, 0.375421703f},
-std::array<float,2>{0.244781405f, 0.93597424f},
-std::array<float,2>{0.942909837f, 0.702787638f},
-std::array<float,2>{0.142340571f, 0.201871619f},
-std::array<float,2>{0.684661269f, 0.269986689f},
-std::array<float,2>{0.294628412f, 0.811274469f},
-std::array<float,2>{0.606118381f, 0.945661366f},
-std::array<float,2>{0.439392537f, 0.43954286f},
-std::array<float,2>{0.852671206f, 0.0510674827f},
-std::array<float,2>{0.120355234f, 0.615331829f},
-std::array<float,2>{0.986114442f, 0.790790081f},
-std::array<float,2>{0.173940316f, 0.253302246f},
-std::array<float,2>{0.637930095f, 0.204718754f},
-std::array<float,2>{0.267434359f, 0.711855412f},
-std::array<float,2>{0.565824986f, 0.596551001f},
-std::array<float,2>{0.493844062f, 0.0329488702f},
-std::array<float,2>{0.837491155f, 0.453405946f},
-std::array<float,2>{0.0752279982f, 0.956085205f},
-std::array<float,2>{0.779797316f, 0.672165394f},
-std::array<float,2>{0.019583229f, 0.135390162f},
-std::array<float,2>{0.508440256f, 0.350301027f},
-std::array<float,2>{0.418063045f, 0.844602823f},
-std::array<float,2>{0.737160683f, 0.912088811f},
-std::array<float,2>{0.354346871f, 0.396304995f},
-std::array<float,2>{0.878255129f, 0.0746113732f},
-std::array<float,2>{0.196093455f, 0.532248676f},
-std::array<float,2>{0.862741172f, 0.996323884f},
-std::array<float,2>{0.102925606f, 0.473083496f},
-std::array<float,2>{0.621462107f, 0.00951322541f},
-std::array<float,2>{0.467692375f, 0.574277043f},
-std::array<float,2>{0.662506342f, 0.745024443f},
-std::array<float,2>{0.297136664f, 0.249765337f},
-std::array<float,2>{0.953339398f, 0.294586688f},
-std::array<float,2>{0.140412405f, 0.765645504f},
-std::array<float,2>{0.912241697f, 0.514087141f},
-std::array<float,2>{0.223150983f, 0.100968465f},
-std::array<float,2>{0.699130416f, 0.426149189f},
-std::array<float,2>{0.334674001f, 0.902018547f},
-std::array<float,2>{0.53276974f, 0.836047232f},
-std::array<float,2>{0.397806495f, 0.33491838f},
-std::array<float,2>{0.811549067f, 0.171283469f},
-std::array<float,2>{0.0496995337f, 0.640117586f},
-std::array<float,2>{0.921791315f, 0.973528743f},
-std::array<float,2>{0.233987316f, 0.495543331f},
-std::array<float,2>{0.691358626f, 0.0176256448f},
-std::array<float,2>{0.340065569f, 0.592460275f},
-std::array<float,2>{0.543509424f, 0.730440438f},
-std::array<float,2>{0.404866159f, 0.219702899f},
-std::array<float,2>{0.802160203f, 0.306389928f},
-std::array<float,2>{0.0621779822f, 0.759204984f},
-std::array<float,2>{0.868142426f, 0.52027148f},
-std::array<float,2>{0.0988588631f, 0.117730983f},
-std::array<float,2>{0.612729609f, 0.416824609f},
-std::array<float,2>{0.460428566f, 0.890314817f},
-std::array<float,2>{0.664922297f, 0.827206016f},
-std::array<float,2>{0.309116721f, 0.325718671f},
-std::array<float,2>{0.962341905f, 0.179582506f},
-std::array<float,2>{0.125084594f, 0.640626967f},
-std::array<float,2>{0.773301423f, 0.804947078f},
-std::array<float,2>{0.027969474f, 0.268479943f},
-std::array<float,2>{0.504352748f, 0.196662351f},
-std::array<float,2>{0.40626654f, 0.698408306f},
-std::array<float,2>{0.748295426f, 0.609636605f},
-std::array<float,2>{0.349214196f, 0.0506258756f},
-std::array<float,2>{0.888146043f, 0.443253279f},
-std::array<float,2>{0.193526909f, 0.952769458f},
-std::array<float,2>{0.999798179f, 0.665354073f},
-std::array<float,2>{0.184872508f, 0.153940499f},
-std::array<float,2>{0.630976915f, 0.372506231f},
-std::array<float,2>{0.281209111f, 0.859419823f},
-std::array<float,2>{0.575784028f, 0.93130511f},
-std::array<float,2>{0.487546235f, 0.37924239f},
-std::array<float,2>{0.828877211f, 0.0783688203f},
-std::array<float,2>{0.0649401546f, 0.555882752f},
-std::array<float,2>{0.948203504f, 0.848060787f},
-std::array<float,2>{0.151561186f, 0.345826477f},
-std::array<float,2>{0.672106087f, 0.139136896f},
-std::array<float,2>{0.284078807f, 0.677973747f},
-std::array<float,2>{0.598311663f, 0.538762867f},
-std::array<float,2>{0.452897191f, 0.0718180016f},
-std::array<float,2>{0.84596318f, 0.393809319f},
-std::array<float,2>{0.10987135f, 0.906886399f},
-std::array<float,2>{0.795503795f, 0.71672076f},
-std::array<float,2>{0.0466155559f, 0.208567262f},
-std::array<float,2>{0.548729241f, 0.254849941f},
-std::array<float,2>{0.382763952f, 0.795035779f},
-std::array<float,2>{0.710567534f, 0.960231483f},
-std::array<float,2>{0.320455492f, 0.459464073f},
-std::array<float,2>{0.933481097f, 0.0376662463f},
-std::array<float,2>{0.235384643f, 0.597887397f},
-std::array<float,2>{0.813840926f, 0.903975368f},
-std::array<float,2>{0.0822141767f, 0.42432183f},
-std::array<float,2>{0.590087354f, 0.0940887183f},
-std::array<float,2>{0.470844865f, 0.508574069f},
-std::array<float,2>{0.653669775f, 0.632944405f},
-std::array<float,2>{0.252449334f, 0.16711086f},
-std::array<float,2>{0.972758234f, 0.330192f},
-std::array<float,2>{0.159692541f, 0.842142701f},
-std::array<float,2>{0.900939524f, 0.571516097f},
-std::array<float,2>{0.206983164f, 0.0122668352f},
-std::array<float,2>{0.719444215f, 0.46955961f},
-std::array<float,2>{0.359725803f, 0.994685233f},
-std::array<float,2>{0.52171272f, 0.771990657f},
-std::array<float,2>{0.433754086f, 0.290641904f},
-std::array<float,2>{0.761641383f, 0.243594766f},
-std::array<float,2>{0.00402345695f, 0.748945832f},
-std::array<float,2>{0.982581317f, 0.919117689f},
-std::array<float,2>{0.165279016f, 0.403770626f},
-std::array<float,2>{0.644109666f, 0.0639889762f},
-std::array<float,2>{0.26461044f, 0.542054832f},
-std::array<float,2>{0.58322382f, 0.684008241f},
-std::array<float,2>{0.477552503f, 0.130028605f},
-std::array<float,2>{0.820487142f, 0.35493651f},
-std::array<float,2>{0.0892433748f, 0.856507182f},
-std::array<float,2>{0.751821399f, 0.609345734f},
-std::array<float,2>{0.0148723414f, 0.0440962948f},
-std::array<float,2>{0.525089502f, 0.461709172f},
-std::array<float,2>{0.427382499f, 0.968325913f},
-std::array<float,2>{0.733005643f, 0.787190497f},
-std::array<float,2>{0.373339534f, 0.262200296f},
-std::array<float,2>{0.895949185f, 0.21582827f},
-std::array<float,2>{0.2172153f, 0.709582329f},
-std::array<float,2>{0.857821703f, 0.833569109f},
-std::array<float,2>{0.123536937f, 0.337925404f},
-std::array<float,2>{0.604115188f, 0.159678653f},
-std::array<float,2>{0.441483378f, 0.625558674f},
-std::array<float,2>{0.681640744f, 0.501630068f},
-std::array<float,2>{0.290460616f, 0.102760158f},
-std::array<float,2>{0.938201249f, 0.437063545f},
-std::array<float,2>{0.148213416f, 0.895303071f},
-std::array<float,2>{0.928619742f, 0.738535583f},
-std::array<float,2>{0.248678297f, 0.240452662f},
-std::array<float,2>{0.716473043f, 0.284578949f},
-std::array<float,2>{0.316929549f, 0.775218904f},
-std::array<float,2>{0.555000305f, 0.98889643f},
-std::array<float,2>{0.385900766f, 0.480670989f},
-std::array<float,2>{0.788898349f, 0.00194775534f},
-std::array<float,2>{0.033749748f, 0.568827987f},
-std::array<float,2>{0.880420029f, 0.753669739f},
-std::array<float,2>{0.201545015f, 0.30120343f},
-std::array<float,2>{0.741185367f, 0.228123471f},
-std::array<float,2>{0.357370347f, 0.72255981f},
-std::array<float,2>{0.512596607f, 0.584810674f},
-std::array<float,2>{0.416464001f, 0.0242606141f},
-std::array<float,2>{0.773642421f, 0.487051189f},
-std::array<float,2>{0.0189767927f, 0.977084339f},
-std::array<float,2>{0.842710495f, 0.653703213f},
-std::array<float,2>{0.0713663176f, 0.180522352f},
-std::array<float,2>{0.567853928f, 0.317684621f},
-std::array<float,2>{0.49973309f, 0.818179786f},
-std::array<float,2>{0.636598289f, 0.879278064f},
-std::array<float,2>{0.269874752f, 0.411252499f},
-std::array<float,2>{0.991660416f, 0.11078041f},
-std::array<float,2>{0.179306209f, 0.530338764f},
-std::array<float,2>{0.808506727f, 0.944204688f},
-std::array<float,2>{0.0514779501f, 0.45120427f},
-std::array<float,2>{0.536596835f, 0.0606644675f},
-std::array<float,2>{0.393000275f, 0.623297334f},
-std::array<float,2>{0.70119679f, 0.694514811f},
-std::array<float,2>{0.328694314f, 0.192793235f},
-std::array<float,2>{0.908991039f, 0.277535677f},
-std::array<float,2>{0.221565858f, 0.801294744f},
-std::array<float,2>{0.960695386f, 0.551599026f},
-std::array<float,2>{0.135166988f, 0.0888161883f},
-std::array<float,2>{0.659658551f, 0.389943093f},
-std::array<float,2>{0.303223878f, 0.922253907f},
-std::array<float,2>{0.619212449f, 0.870677531f},
-std::array<float,2>{0.462009162f, 0.360173404f},
-std::array<float,2>{0.863295376f, 0.140848011f},
-std::array<float,2>{0.107589774f, 0.657513559f}}
\ No newline at end of file
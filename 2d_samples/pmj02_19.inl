@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.375474513f, 0.298906773f},
-std::array<float,2>{0.637009442f, 0.986099184f},
-std::array<float,2>{0.927254975f, 0.197736472f},
-std::array<float,2>{0.174563751f, 0.584915578f},
-std::array<float,2>{0.121253729f, 0.0329853967f},
-std::array<float,2>{0.759508193f, 0.679350376f},
-std::array<float,2>{0.5859285f, 0.469016582f},
-std::array<float,2>{0.265625149f, 0.780537009f},
-std::array<float,2>{0.23405984f, 0.431153268f},
-std::array<float,2>{0.980935156f, 0.852307379f},
-std::array<float,2>{0.710478067f, 0.113016382f},
-std::array<float,2>{0.446034253f, 0.717734098f},
-std::array<float,2>{0.328459173f, 0.159256309f},
-std::array<float,2>{0.530586421f, 0.524789393f},
-std::array<float,2>{0.867064595f, 0.330022216f},
-std::array<float,2>{0.0207367875f, 0.933188379f},
-std::array<float,2>{0.307926565f, 0.465032905f},
-std::array<float,2>{0.598279953f, 0.800939143f},
-std::array<float,2>{0.792768598f, 0.0175562315f},
-std::array<float,2>{0.0714267343f, 0.649947941f},
-std::array<float,2>{0.143011555f, 0.241296664f},
-std::array<float,2>{0.885602295f, 0.602139533f},
-std::array<float,2>{0.679724991f, 0.251192629f},
-std::array<float,2>{0.425688177f, 0.96013248f},
-std::array<float,2>{0.0321113877f, 0.352201313f},
-std::array<float,2>{0.815196931f, 0.890690982f},
-std::array<float,2>{0.535340011f, 0.139361143f},
-std::array<float,2>{0.374434948f, 0.55759263f},
-std::array<float,2>{0.496457934f, 0.0929099992f},
-std::array<float,2>{0.749589503f, 0.74884212f},
-std::array<float,2>{0.961144447f, 0.385747373f},
-std::array<float,2>{0.191711456f, 0.835017562f},
-std::array<float,2>{0.460387558f, 0.392527699f},
-std::array<float,2>{0.698270977f, 0.82273674f},
-std::array<float,2>{0.99438411f, 0.0631995723f},
-std::array<float,2>{0.237763196f, 0.727838874f},
-std::array<float,2>{0.00528118992f, 0.148683891f},
-std::array<float,2>{0.855495155f, 0.535026252f},
-std::array<float,2>{0.50963968f, 0.369434595f},
-std::array<float,2>{0.313135087f, 0.885914564f},
-std::array<float,2>{0.170865133f, 0.271385729f},
-std::array<float,2>{0.921099842f, 0.949613512f},
-std::array<float,2>{0.646267951f, 0.227887541f},
-std::array<float,2>{0.391767412f, 0.623948038f},
-std::array<float,2>{0.250178486f, 0.0109492699f},
-std::array<float,2>{0.568751872f, 0.627367437f},
-std::array<float,2>{0.777000606f, 0.445913643f},
-std::array<float,2>{0.102297105f, 0.782969236f},
-std::array<float,2>{0.356634378f, 0.313274592f},
-std::array<float,2>{0.561600864f, 0.918909669f},
-std::array<float,2>{0.841852963f, 0.177121937f},
-std::array<float,2>{0.0494550169f, 0.505237401f},
-std::array<float,2>{0.207803383f, 0.104627512f},
-std::array<float,2>{0.951641679f, 0.689135373f},
-std::array<float,2>{0.720795751f, 0.417479098f},
-std::array<float,2>{0.480773151f, 0.861880481f},
-std::array<float,2>{0.0898462757f, 0.487768382f},
-std::array<float,2>{0.810653329f, 0.757960916f},
-std::array<float,2>{0.616870344f, 0.0473321453f},
-std::array<float,2>{0.286846489f, 0.669847786f},
-std::array<float,2>{0.419953316f, 0.212339029f},
-std::array<float,2>{0.659658432f, 0.5726825f},
-std::array<float,2>{0.891518176f, 0.290858537f},
-std::array<float,2>{0.135428578f, 0.97453618f},
-std::array<float,2>{0.471417814f, 0.361986279f},
-std::array<float,2>{0.729989469f, 0.87835288f},
-std::array<float,2>{0.942146182f, 0.145354137f},
-std::array<float,2>{0.21475108f, 0.539682508f},
-std::array<float,2>{0.0610942319f, 0.0717042834f},
-std::array<float,2>{0.834722221f, 0.723052859f},
-std::array<float,2>{0.549676716f, 0.399993569f},
-std::array<float,2>{0.347246557f, 0.813662589f},
-std::array<float,2>{0.125708237f, 0.438705951f},
-std::array<float,2>{0.901386797f, 0.794513285f},
-std::array<float,2>{0.665202022f, 0.00165803661f},
-std::array<float,2>{0.413450539f, 0.637108803f},
-std::array<float,2>{0.296262562f, 0.223023176f},
-std::array<float,2>{0.622889698f, 0.611201227f},
-std::array<float,2>{0.800072074f, 0.277500629f},
-std::array<float,2>{0.0827031881f, 0.94080162f},
-std::array<float,2>{0.320964068f, 0.410671115f},
-std::array<float,2>{0.50725013f, 0.871125996f},
-std::array<float,2>{0.851428092f, 0.0953410268f},
-std::array<float,2>{0.00871633179f, 0.700631917f},
-std::array<float,2>{0.249799207f, 0.182931453f},
-std::array<float,2>{0.988902688f, 0.512661397f},
-std::array<float,2>{0.695212722f, 0.324186593f},
-std::array<float,2>{0.463583648f, 0.910698175f},
-std::array<float,2>{0.0984258801f, 0.282311589f},
-std::array<float,2>{0.769665897f, 0.978784442f},
-std::array<float,2>{0.576568961f, 0.205009148f},
-std::array<float,2>{0.262274295f, 0.56920135f},
-std::array<float,2>{0.40221107f, 0.0571883358f},
-std::array<float,2>{0.655048728f, 0.660947978f},
-std::array<float,2>{0.912504435f, 0.499819517f},
-std::array<float,2>{0.16288881f, 0.753430605f},
-std::array<float,2>{0.429717749f, 0.479863763f},
-std::array<float,2>{0.674450219f, 0.769087434f},
-std::array<float,2>{0.880200803f, 0.0419218615f},
-std::array<float,2>{0.152390838f, 0.683798909f},
-std::array<float,2>{0.0636909902f, 0.188010097f},
-std::array<float,2>{0.788840592f, 0.590018749f},
-std::array<float,2>{0.603585184f, 0.307983398f},
-std::array<float,2>{0.302319497f, 0.995383382f},
-std::array<float,2>{0.201469913f, 0.33961609f},
-std::array<float,2>{0.956692517f, 0.922497094f},
-std::array<float,2>{0.736064672f, 0.165208548f},
-std::array<float,2>{0.485257536f, 0.516110361f},
-std::array<float,2>{0.366726011f, 0.11965625f},
-std::array<float,2>{0.546705186f, 0.70531708f},
-std::array<float,2>{0.825801671f, 0.426439285f},
-std::array<float,2>{0.0394037627f, 0.848394692f},
-std::array<float,2>{0.279832572f, 0.265089959f},
-std::array<float,2>{0.587561369f, 0.962483525f},
-std::array<float,2>{0.753562748f, 0.245378613f},
-std::array<float,2>{0.110993251f, 0.596176147f},
-std::array<float,2>{0.182534233f, 0.0308205709f},
-std::array<float,2>{0.936597943f, 0.643582046f},
-std::array<float,2>{0.62688452f, 0.458054721f},
-std::array<float,2>{0.389905572f, 0.804780483f},
-std::array<float,2>{0.0262238812f, 0.37578553f},
-std::array<float,2>{0.87077558f, 0.842965245f},
-std::array<float,2>{0.520299137f, 0.0832440108f},
-std::array<float,2>{0.338380575f, 0.73813343f},
-std::array<float,2>{0.443597943f, 0.130964637f},
-std::array<float,2>{0.71705687f, 0.551523864f},
-std::array<float,2>{0.970935583f, 0.348567367f},
-std::array<float,2>{0.22045882f, 0.904710948f},
-std::array<float,2>{0.409640789f, 0.335591286f},
-std::array<float,2>{0.671749771f, 0.934853554f},
-std::array<float,2>{0.904990435f, 0.162751749f},
-std::array<float,2>{0.129173696f, 0.528907835f},
-std::array<float,2>{0.0797984153f, 0.114362963f},
-std::array<float,2>{0.802180469f, 0.711468399f},
-std::array<float,2>{0.618287504f, 0.43380934f},
-std::array<float,2>{0.291867763f, 0.8555305f},
-std::array<float,2>{0.217778802f, 0.473557442f},
-std::array<float,2>{0.93884331f, 0.774263024f},
-std::array<float,2>{0.732285976f, 0.0356744267f},
-std::array<float,2>{0.476364523f, 0.672485173f},
-std::array<float,2>{0.351308733f, 0.200895622f},
-std::array<float,2>{0.551548004f, 0.579073429f},
-std::array<float,2>{0.830596864f, 0.302863836f},
-std::array<float,2>{0.0585176758f, 0.990495861f},
-std::array<float,2>{0.261546135f, 0.388309211f},
-std::array<float,2>{0.573413193f, 0.828293622f},
-std::array<float,2>{0.767245054f, 0.0892590806f},
-std::array<float,2>{0.0954622403f, 0.742289782f},
-std::array<float,2>{0.159508109f, 0.134493366f},
-std::array<float,2>{0.909655571f, 0.560707152f},
-std::array<float,2>{0.648793161f, 0.358427703f},
-std::array<float,2>{0.406240135f, 0.894831538f},
-std::array<float,2>{0.0148388278f, 0.255656034f},
-std::array<float,2>{0.847254038f, 0.955552697f},
-std::array<float,2>{0.502901912f, 0.235295132f},
-std::array<float,2>{0.325823486f, 0.606200278f},
-std::array<float,2>{0.466168225f, 0.0198759884f},
-std::array<float,2>{0.691228569f, 0.654947698f},
-std::array<float,2>{0.98585999f, 0.463128507f},
-std::array<float,2>{0.242393583f, 0.797827125f},
-std::array<float,2>{0.488898426f, 0.449781775f},
-std::array<float,2>{0.740356088f, 0.788122296f},
-std::array<float,2>{0.95866096f, 0.0127134509f},
-std::array<float,2>{0.197576344f, 0.630176187f},
-std::array<float,2>{0.0442651212f, 0.231911674f},
-std::array<float,2>{0.821502507f, 0.620864332f},
-std::array<float,2>{0.540159225f, 0.268916726f},
-std::array<float,2>{0.361672223f, 0.948190093f},
-std::array<float,2>{0.148624733f, 0.372843951f},
-std::array<float,2>{0.87880224f, 0.887160897f},
-std::array<float,2>{0.67580229f, 0.155453339f},
-std::array<float,2>{0.436850727f, 0.538331151f},
-std::array<float,2>{0.296889693f, 0.0677099004f},
-std::array<float,2>{0.608309984f, 0.733843863f},
-std::array<float,2>{0.781534314f, 0.39738512f},
-std::array<float,2>{0.0693844259f, 0.825942576f},
-std::array<float,2>{0.343368053f, 0.296565324f},
-std::array<float,2>{0.51902926f, 0.972118556f},
-std::array<float,2>{0.872702777f, 0.216032833f},
-std::array<float,2>{0.0295445416f, 0.576032639f},
-std::array<float,2>{0.223095834f, 0.0532014556f},
-std::array<float,2>{0.975157201f, 0.667918444f},
-std::array<float,2>{0.713579416f, 0.488763362f},
-std::array<float,2>{0.441279113f, 0.764305174f},
-std::array<float,2>{0.113738589f, 0.421143472f},
-std::array<float,2>{0.753917873f, 0.864045739f},
-std::array<float,2>{0.591476917f, 0.108064637f},
-std::array<float,2>{0.276477754f, 0.691946626f},
-std::array<float,2>{0.384420484f, 0.175642416f},
-std::array<float,2>{0.631120205f, 0.503782511f},
-std::array<float,2>{0.932897389f, 0.317437768f},
-std::array<float,2>{0.185706377f, 0.915480733f},
-std::array<float,2>{0.451018333f, 0.27430135f},
-std::array<float,2>{0.70561409f, 0.944357097f},
-std::array<float,2>{0.979567885f, 0.219262168f},
-std::array<float,2>{0.226982459f, 0.617079735f},
-std::array<float,2>{0.018547358f, 0.00523716724f},
-std::array<float,2>{0.860157073f, 0.636138201f},
-std::array<float,2>{0.525161624f, 0.442672342f},
-std::array<float,2>{0.332653314f, 0.789117277f},
-std::array<float,2>{0.177550003f, 0.404281855f},
-std::array<float,2>{0.923453629f, 0.817537427f},
-std::array<float,2>{0.634158492f, 0.0773538128f},
-std::array<float,2>{0.380223244f, 0.720557868f},
-std::array<float,2>{0.272756696f, 0.143814206f},
-std::array<float,2>{0.579743803f, 0.546473324f},
-std::array<float,2>{0.763784766f, 0.366573453f},
-std::array<float,2>{0.118912734f, 0.8796134f},
-std::array<float,2>{0.369797826f, 0.494931728f},
-std::array<float,2>{0.532054842f, 0.755858839f},
-std::array<float,2>{0.818993688f, 0.0624369606f},
-std::array<float,2>{0.0384259634f, 0.659452975f},
-std::array<float,2>{0.189664945f, 0.208574355f},
-std::array<float,2>{0.966325819f, 0.566375136f},
-std::array<float,2>{0.742715895f, 0.285471529f},
-std::array<float,2>{0.492768556f, 0.982530773f},
-std::array<float,2>{0.0769870281f, 0.325814039f},
-std::array<float,2>{0.795484543f, 0.907782853f},
-std::array<float,2>{0.59411937f, 0.185920775f},
-std::array<float,2>{0.309516758f, 0.509660602f},
-std::array<float,2>{0.427198678f, 0.098499231f},
-std::array<float,2>{0.684017777f, 0.696177423f},
-std::array<float,2>{0.887432575f, 0.406449467f},
-std::array<float,2>{0.14562659f, 0.867530167f},
-std::array<float,2>{0.398346901f, 0.42531094f},
-std::array<float,2>{0.64287138f, 0.847109675f},
-std::array<float,2>{0.914375305f, 0.122784346f},
-std::array<float,2>{0.165901884f, 0.708831429f},
-std::array<float,2>{0.108681984f, 0.16978009f},
-std::array<float,2>{0.780736804f, 0.521356165f},
-std::array<float,2>{0.563510895f, 0.343212664f},
-std::array<float,2>{0.257379264f, 0.927679181f},
-std::array<float,2>{0.241532654f, 0.310532331f},
-std::array<float,2>{0.999791086f, 0.997944236f},
-std::array<float,2>{0.70049423f, 0.192042142f},
-std::array<float,2>{0.45359236f, 0.588769317f},
-std::array<float,2>{0.318395257f, 0.043623399f},
-std::array<float,2>{0.514818609f, 0.68298018f},
-std::array<float,2>{0.853007734f, 0.480940461f},
-std::array<float,2>{0.000306758826f, 0.771553636f},
-std::array<float,2>{0.284090519f, 0.345568568f},
-std::array<float,2>{0.609971642f, 0.900757372f},
-std::array<float,2>{0.804772258f, 0.12512821f},
-std::array<float,2>{0.0886425599f, 0.54946202f},
-std::array<float,2>{0.137773618f, 0.0805029124f},
-std::array<float,2>{0.897303104f, 0.739603877f},
-std::array<float,2>{0.661828518f, 0.380860418f},
-std::array<float,2>{0.414527178f, 0.839214861f},
-std::array<float,2>{0.052519761f, 0.45333299f},
-std::array<float,2>{0.83938694f, 0.810833395f},
-std::array<float,2>{0.558079183f, 0.023991555f},
-std::array<float,2>{0.355122447f, 0.647803485f},
-std::array<float,2>{0.48034969f, 0.248503178f},
-std::array<float,2>{0.723245144f, 0.599696994f},
-std::array<float,2>{0.947481871f, 0.260219932f},
-std::array<float,2>{0.203834757f, 0.965413392f},
-std::array<float,2>{0.423361123f, 0.253487349f},
-std::array<float,2>{0.682197988f, 0.957117498f},
-std::array<float,2>{0.884019136f, 0.23918283f},
-std::array<float,2>{0.141878054f, 0.604207337f},
-std::array<float,2>{0.0737266168f, 0.0177711677f},
-std::array<float,2>{0.790245473f, 0.650769234f},
-std::array<float,2>{0.601311803f, 0.466992646f},
-std::array<float,2>{0.304987282f, 0.804170549f},
-std::array<float,2>{0.19512035f, 0.382864982f},
-std::array<float,2>{0.963665128f, 0.833595455f},
-std::array<float,2>{0.747870147f, 0.0906682834f},
-std::array<float,2>{0.499058098f, 0.747332215f},
-std::array<float,2>{0.37110886f, 0.138139412f},
-std::array<float,2>{0.537446856f, 0.556522012f},
-std::array<float,2>{0.814330876f, 0.353776902f},
-std::array<float,2>{0.0349763595f, 0.893738329f},
-std::array<float,2>{0.269015014f, 0.472561955f},
-std::array<float,2>{0.582577765f, 0.778836846f},
-std::array<float,2>{0.76140964f, 0.0347953998f},
-std::array<float,2>{0.123507842f, 0.677585721f},
-std::array<float,2>{0.173618183f, 0.196839318f},
-std::array<float,2>{0.929641187f, 0.582975328f},
-std::array<float,2>{0.639350593f, 0.298495263f},
-std::array<float,2>{0.377775371f, 0.987138271f},
-std::array<float,2>{0.021975169f, 0.331123143f},
-std::array<float,2>{0.864664197f, 0.930327356f},
-std::array<float,2>{0.528768063f, 0.158102393f},
-std::array<float,2>{0.330374718f, 0.525522053f},
-std::array<float,2>{0.44805342f, 0.11024259f},
-std::array<float,2>{0.708857954f, 0.715142012f},
-std::array<float,2>{0.98294723f, 0.433185786f},
-std::array<float,2>{0.231342882f, 0.854684711f},
-std::array<float,2>{0.483349264f, 0.415882081f},
-std::array<float,2>{0.7194947f, 0.860762715f},
-std::array<float,2>{0.949573815f, 0.102218509f},
-std::array<float,2>{0.209011361f, 0.691127479f},
-std::array<float,2>{0.0472445525f, 0.178042367f},
-std::array<float,2>{0.840435386f, 0.506811261f},
-std::array<float,2>{0.559375823f, 0.314567894f},
-std::array<float,2>{0.359083593f, 0.921064436f},
-std::array<float,2>{0.133926779f, 0.291365266f},
-std::array<float,2>{0.893905938f, 0.975190759f},
-std::array<float,2>{0.657233179f, 0.214292839f},
-std::array<float,2>{0.418509036f, 0.571533561f},
-std::array<float,2>{0.288377345f, 0.0494111888f},
-std::array<float,2>{0.61385572f, 0.670729876f},
-std::array<float,2>{0.808739841f, 0.485413313f},
-std::array<float,2>{0.0923589543f, 0.759942353f},
-std::array<float,2>{0.314842016f, 0.368101418f},
-std::array<float,2>{0.509888887f, 0.884445488f},
-std::array<float,2>{0.858318627f, 0.150987625f},
-std::array<float,2>{0.00698427856f, 0.531708658f},
-std::array<float,2>{0.235205203f, 0.0663453564f},
-std::array<float,2>{0.993785024f, 0.728690326f},
-std::array<float,2>{0.695337355f, 0.394297659f},
-std::array<float,2>{0.45803085f, 0.820376694f},
-std::array<float,2>{0.103897035f, 0.44784233f},
-std::array<float,2>{0.774356067f, 0.783671916f},
-std::array<float,2>{0.567068577f, 0.00877424423f},
-std::array<float,2>{0.253901005f, 0.625479221f},
-std::array<float,2>{0.393275231f, 0.229955286f},
-std::array<float,2>{0.647443116f, 0.622551799f},
-std::array<float,2>{0.919799089f, 0.271721363f},
-std::array<float,2>{0.169920862f, 0.95166719f},
-std::array<float,2>{0.462069482f, 0.32073155f},
-std::array<float,2>{0.693102241f, 0.913449347f},
-std::array<float,2>{0.991376221f, 0.181221738f},
-std::array<float,2>{0.248012945f, 0.513847888f},
-std::array<float,2>{0.0116106654f, 0.0967960656f},
-std::array<float,2>{0.849388123f, 0.702826679f},
-std::array<float,2>{0.505250871f, 0.412940532f},
-std::array<float,2>{0.322481126f, 0.873641193f},
-std::array<float,2>{0.160191745f, 0.496162564f},
-std::array<float,2>{0.911091387f, 0.750677764f},
-std::array<float,2>{0.653352439f, 0.0548191592f},
-std::array<float,2>{0.399448961f, 0.663587332f},
-std::array<float,2>{0.264429569f, 0.205488294f},
-std::array<float,2>{0.576079845f, 0.567421556f},
-std::array<float,2>{0.771709681f, 0.283700883f},
-std::array<float,2>{0.0999336466f, 0.976582289f},
-std::array<float,2>{0.344445407f, 0.401395917f},
-std::array<float,2>{0.547849476f, 0.815447032f},
-std::array<float,2>{0.833527386f, 0.0735398978f},
-std::array<float,2>{0.0594765581f, 0.725563288f},
-std::array<float,2>{0.21136789f, 0.148141861f},
-std::array<float,2>{0.944526792f, 0.541279078f},
-std::array<float,2>{0.727249205f, 0.360614657f},
-std::array<float,2>{0.469435304f, 0.876020074f},
-std::array<float,2>{0.0856509954f, 0.28022334f},
-std::array<float,2>{0.797990203f, 0.939274251f},
-std::array<float,2>{0.623158216f, 0.226503387f},
-std::array<float,2>{0.293200642f, 0.612464488f},
-std::array<float,2>{0.410917491f, 0.00302822166f},
-std::array<float,2>{0.666208863f, 0.640243232f},
-std::array<float,2>{0.900334477f, 0.441226989f},
-std::array<float,2>{0.127918899f, 0.796474159f},
-std::array<float,2>{0.387739509f, 0.460518956f},
-std::array<float,2>{0.62824738f, 0.806645811f},
-std::array<float,2>{0.93363905f, 0.0283342972f},
-std::array<float,2>{0.181238607f, 0.640678227f},
-std::array<float,2>{0.112125993f, 0.242582262f},
-std::array<float,2>{0.750620961f, 0.593978107f},
-std::array<float,2>{0.588698626f, 0.263102859f},
-std::array<float,2>{0.278931707f, 0.963060081f},
-std::array<float,2>{0.220856234f, 0.350131094f},
-std::array<float,2>{0.969375014f, 0.903270781f},
-std::array<float,2>{0.715636015f, 0.129450709f},
-std::array<float,2>{0.441795647f, 0.554513872f},
-std::array<float,2>{0.33771503f, 0.0854284912f},
-std::array<float,2>{0.52158922f, 0.736238897f},
-std::array<float,2>{0.867906868f, 0.377379984f},
-std::array<float,2>{0.023644479f, 0.840495527f},
-std::array<float,2>{0.303832322f, 0.305475563f},
-std::array<float,2>{0.60185349f, 0.993133843f},
-std::array<float,2>{0.785490513f, 0.191093221f},
-std::array<float,2>{0.0644917488f, 0.591990829f},
-std::array<float,2>{0.15543367f, 0.0408729017f},
-std::array<float,2>{0.881668031f, 0.687088549f},
-std::array<float,2>{0.672873616f, 0.477815539f},
-std::array<float,2>{0.432221353f, 0.766896248f},
-std::array<float,2>{0.041048754f, 0.42802152f},
-std::array<float,2>{0.826967478f, 0.850869179f},
-std::array<float,2>{0.544453979f, 0.117755957f},
-std::array<float,2>{0.364846647f, 0.703165114f},
-std::array<float,2>{0.486376315f, 0.167022303f},
-std::array<float,2>{0.73809576f, 0.51776427f},
-std::array<float,2>{0.954631984f, 0.337744385f},
-std::array<float,2>{0.200402781f, 0.924832225f},
-std::array<float,2>{0.403539807f, 0.356767774f},
-std::array<float,2>{0.650616586f, 0.89672178f},
-std::array<float,2>{0.90754813f, 0.134902686f},
-std::array<float,2>{0.156727374f, 0.559093595f},
-std::array<float,2>{0.0961758494f, 0.0867015049f},
-std::array<float,2>{0.769530952f, 0.745036602f},
-std::array<float,2>{0.572055817f, 0.389402658f},
-std::array<float,2>{0.257850409f, 0.8312096f},
-std::array<float,2>{0.246008828f, 0.461012065f},
-std::array<float,2>{0.987848401f, 0.800767243f},
-std::array<float,2>{0.688071966f, 0.0223843381f},
-std::array<float,2>{0.46819967f, 0.653981566f},
-std::array<float,2>{0.326794475f, 0.237824917f},
-std::array<float,2>{0.500908077f, 0.608186245f},
-std::array<float,2>{0.844077289f, 0.257745892f},
-std::array<float,2>{0.0127887558f, 0.953239799f},
-std::array<float,2>{0.290044874f, 0.436125904f},
-std::array<float,2>{0.61992389f, 0.858774424f},
-std::array<float,2>{0.803560495f, 0.115493573f},
-std::array<float,2>{0.080779992f, 0.714403629f},
-std::array<float,2>{0.131736547f, 0.161473304f},
-std::array<float,2>{0.904211998f, 0.529622912f},
-std::array<float,2>{0.668923318f, 0.333156884f},
-std::array<float,2>{0.407699615f, 0.935818493f},
-std::array<float,2>{0.0552034304f, 0.302686572f},
-std::array<float,2>{0.82863605f, 0.989631057f},
-std::array<float,2>{0.553845346f, 0.203075215f},
-std::array<float,2>{0.348728776f, 0.58092761f},
-std::array<float,2>{0.473361313f, 0.038503971f},
-std::array<float,2>{0.732799053f, 0.674756944f},
-std::array<float,2>{0.939954937f, 0.475550354f},
-std::array<float,2>{0.215669811f, 0.77719301f},
-std::array<float,2>{0.438557655f, 0.491333455f},
-std::array<float,2>{0.712261617f, 0.762838006f},
-std::array<float,2>{0.973634362f, 0.0515052862f},
-std::array<float,2>{0.225496411f, 0.665111423f},
-std::array<float,2>{0.0287653506f, 0.217795342f},
-std::array<float,2>{0.874135971f, 0.57651794f},
-std::array<float,2>{0.517440617f, 0.29438898f},
-std::array<float,2>{0.341080636f, 0.969357193f},
-std::array<float,2>{0.184154451f, 0.320158839f},
-std::array<float,2>{0.93008244f, 0.91632098f},
-std::array<float,2>{0.629410386f, 0.173439458f},
-std::array<float,2>{0.386575311f, 0.500294268f},
-std::array<float,2>{0.273850322f, 0.107330203f},
-std::array<float,2>{0.592855394f, 0.694185972f},
-std::array<float,2>{0.75660032f, 0.418589622f},
-std::array<float,2>{0.116210438f, 0.866675735f},
-std::array<float,2>{0.360038608f, 0.267470658f},
-std::array<float,2>{0.541810751f, 0.947070241f},
-std::array<float,2>{0.823354483f, 0.234365791f},
-std::array<float,2>{0.0459969118f, 0.617358387f},
-std::array<float,2>{0.195487261f, 0.0141453138f},
-std::array<float,2>{0.960744619f, 0.631953776f},
-std::array<float,2>{0.73939836f, 0.453062832f},
-std::array<float,2>{0.491639614f, 0.786127448f},
-std::array<float,2>{0.0678149834f, 0.396117359f},
-std::array<float,2>{0.784258366f, 0.827551186f},
-std::array<float,2>{0.605528176f, 0.0697230548f},
-std::array<float,2>{0.298860133f, 0.730951309f},
-std::array<float,2>{0.435225636f, 0.152630866f},
-std::array<float,2>{0.678422272f, 0.535971642f},
-std::array<float,2>{0.875001073f, 0.373203009f},
-std::array<float,2>{0.150936916f, 0.889440298f},
-std::array<float,2>{0.495300382f, 0.288952112f},
-std::array<float,2>{0.745991409f, 0.980726004f},
-std::array<float,2>{0.966971457f, 0.210044488f},
-std::array<float,2>{0.188868806f, 0.563569367f},
-std::array<float,2>{0.0361103788f, 0.0599808358f},
-std::array<float,2>{0.817313492f, 0.65733403f},
-std::array<float,2>{0.534732997f, 0.493767947f},
-std::array<float,2>{0.369001597f, 0.757381141f},
-std::array<float,2>{0.147154689f, 0.409439594f},
-std::array<float,2>{0.889530718f, 0.869673312f},
-std::array<float,2>{0.686835527f, 0.099906832f},
-std::array<float,2>{0.429406911f, 0.699068666f},
-std::array<float,2>{0.311840147f, 0.185365647f},
-std::array<float,2>{0.596419334f, 0.510297f},
-std::array<float,2>{0.794268072f, 0.326442599f},
-std::array<float,2>{0.0758974403f, 0.909550428f},
-std::array<float,2>{0.335124612f, 0.444957525f},
-std::array<float,2>{0.526862025f, 0.791474581f},
-std::array<float,2>{0.861438632f, 0.0060687107f},
-std::array<float,2>{0.0174267478f, 0.633625329f},
-std::array<float,2>{0.22954452f, 0.221988544f},
-std::array<float,2>{0.977660775f, 0.614520073f},
-std::array<float,2>{0.704510152f, 0.276876062f},
-std::array<float,2>{0.452071726f, 0.942653239f},
-std::array<float,2>{0.119489215f, 0.36456728f},
-std::array<float,2>{0.762076318f, 0.882787943f},
-std::array<float,2>{0.580141246f, 0.141722336f},
-std::array<float,2>{0.269843191f, 0.544672847f},
-std::array<float,2>{0.381717086f, 0.0743891522f},
-std::array<float,2>{0.634876251f, 0.721107006f},
-std::array<float,2>{0.925728559f, 0.404480517f},
-std::array<float,2>{0.177948296f, 0.81863755f},
-std::array<float,2>{0.416187465f, 0.379681468f},
-std::array<float,2>{0.662765563f, 0.836339593f},
-std::array<float,2>{0.896109223f, 0.0792284533f},
-std::array<float,2>{0.14003925f, 0.741051674f},
-std::array<float,2>{0.0871007442f, 0.128268555f},
-std::array<float,2>{0.806765616f, 0.548279285f},
-std::array<float,2>{0.611950934f, 0.345822483f},
-std::array<float,2>{0.28237915f, 0.899751723f},
-std::array<float,2>{0.205783159f, 0.25966084f},
-std::array<float,2>{0.946372151f, 0.968623877f},
-std::array<float,2>{0.725305915f, 0.247784674f},
-std::array<float,2>{0.477203429f, 0.599553883f},
-std::array<float,2>{0.352865994f, 0.0268043503f},
-std::array<float,2>{0.555322707f, 0.645735621f},
-std::array<float,2>{0.837506354f, 0.4554618f},
-std::array<float,2>{0.0540729128f, 0.809735835f},
-std::array<float,2>{0.254272938f, 0.340129822f},
-std::array<float,2>{0.566346943f, 0.928961098f},
-std::array<float,2>{0.777362287f, 0.170609355f},
-std::array<float,2>{0.106890373f, 0.522841692f},
-std::array<float,2>{0.167907655f, 0.124517083f},
-std::array<float,2>{0.91712743f, 0.710719287f},
-std::array<float,2>{0.642411768f, 0.423087448f},
-std::array<float,2>{0.395134985f, 0.844851851f},
-std::array<float,2>{0.00375078898f, 0.484013677f},
-std::array<float,2>{0.853836179f, 0.769879103f},
-std::array<float,2>{0.511869311f, 0.0452776961f},
-std::array<float,2>{0.316663712f, 0.679826796f},
-std::array<float,2>{0.455803871f, 0.195151418f},
-std::array<float,2>{0.701397002f, 0.587843001f},
-std::array<float,2>{0.996657848f, 0.31098789f},
-std::array<float,2>{0.239744708f, 0.998529017f},
-std::array<float,2>{0.419863731f, 0.289208829f},
-std::array<float,2>{0.656983078f, 0.972899199f},
-std::array<float,2>{0.892942309f, 0.211489335f},
-std::array<float,2>{0.133194253f, 0.573554695f},
-std::array<float,2>{0.0930361599f, 0.048087623f},
-std::array<float,2>{0.810026169f, 0.668385148f},
-std::array<float,2>{0.615065932f, 0.486845106f},
-std::array<float,2>{0.287404835f, 0.759503305f},
-std::array<float,2>{0.210558742f, 0.416175306f},
-std::array<float,2>{0.950605631f, 0.862647235f},
-std::array<float,2>{0.719735265f, 0.103665635f},
-std::array<float,2>{0.484018743f, 0.688112438f},
-std::array<float,2>{0.357888162f, 0.176348671f},
-std::array<float,2>{0.560353875f, 0.504827321f},
-std::array<float,2>{0.840864599f, 0.314370126f},
-std::array<float,2>{0.0478929393f, 0.919767916f},
-std::array<float,2>{0.252465069f, 0.446763933f},
-std::array<float,2>{0.567932963f, 0.782220483f},
-std::array<float,2>{0.774521112f, 0.010216618f},
-std::array<float,2>{0.104817949f, 0.628402531f},
-std::array<float,2>{0.168467909f, 0.226672605f},
-std::array<float,2>{0.918429732f, 0.624500513f},
-std::array<float,2>{0.64766705f, 0.270252883f},
-std::array<float,2>{0.393982917f, 0.950285137f},
-std::array<float,2>{0.00646722317f, 0.370438904f},
-std::array<float,2>{0.858705342f, 0.885526061f},
-std::array<float,2>{0.51167202f, 0.150223702f},
-std::array<float,2>{0.315768749f, 0.533602059f},
-std::array<float,2>{0.457646132f, 0.0638115853f},
-std::array<float,2>{0.697203219f, 0.727104843f},
-std::array<float,2>{0.992776573f, 0.3908512f},
-std::array<float,2>{0.23557429f, 0.823312938f},
-std::array<float,2>{0.498291224f, 0.384930611f},
-std::array<float,2>{0.746815383f, 0.834475458f},
-std::array<float,2>{0.964212239f, 0.0921302736f},
-std::array<float,2>{0.193394676f, 0.749788046f},
-std::array<float,2>{0.0334389172f, 0.14031747f},
-std::array<float,2>{0.81272006f, 0.558531046f},
-std::array<float,2>{0.538842022f, 0.352852106f},
-std::array<float,2>{0.372514784f, 0.89181602f},
-std::array<float,2>{0.140747055f, 0.25011605f},
-std::array<float,2>{0.883300662f, 0.959293306f},
-std::array<float,2>{0.683411539f, 0.241030708f},
-std::array<float,2>{0.42227605f, 0.603418827f},
-std::array<float,2>{0.305985153f, 0.0157946255f},
-std::array<float,2>{0.600031853f, 0.649407983f},
-std::array<float,2>{0.789612591f, 0.466415495f},
-std::array<float,2>{0.0729429275f, 0.802602589f},
-std::array<float,2>{0.331378818f, 0.329003334f},
-std::array<float,2>{0.527471185f, 0.932439804f},
-std::array<float,2>{0.863818526f, 0.158616647f},
-std::array<float,2>{0.0230831075f, 0.523659348f},
-std::array<float,2>{0.232415095f, 0.112047374f},
-std::array<float,2>{0.983750165f, 0.718333006f},
-std::array<float,2>{0.707616806f, 0.430315435f},
-std::array<float,2>{0.449049652f, 0.852834046f},
-std::array<float,2>{0.124951854f, 0.470229775f},
-std::array<float,2>{0.759981811f, 0.779846728f},
-std::array<float,2>{0.583825648f, 0.0319915786f},
-std::array<float,2>{0.26821503f, 0.678070307f},
-std::array<float,2>{0.378716499f, 0.198414132f},
-std::array<float,2>{0.640046537f, 0.585621595f},
-std::array<float,2>{0.928409755f, 0.300709635f},
-std::array<float,2>{0.172836229f, 0.984470487f},
-std::array<float,2>{0.443245828f, 0.349558353f},
-std::array<float,2>{0.716174126f, 0.905743361f},
-std::array<float,2>{0.969834745f, 0.132213444f},
-std::array<float,2>{0.222600058f, 0.552144468f},
-std::array<float,2>{0.0251113717f, 0.0824078619f},
-std::array<float,2>{0.868849635f, 0.737246215f},
-std::array<float,2>{0.523236632f, 0.376826763f},
-std::array<float,2>{0.33687523f, 0.842588663f},
-std::array<float,2>{0.179998085f, 0.457863122f},
-std::array<float,2>{0.93473053f, 0.805808544f},
-std::array<float,2>{0.627110183f, 0.0301269088f},
-std::array<float,2>{0.38747403f, 0.643104196f},
-std::array<float,2>{0.277725965f, 0.245035529f},
-std::array<float,2>{0.589382291f, 0.596971571f},
-std::array<float,2>{0.751775503f, 0.26430124f},
-std::array<float,2>{0.112909496f, 0.961497724f},
-std::array<float,2>{0.364115626f, 0.427522957f},
-std::array<float,2>{0.54348588f, 0.849570215f},
-std::array<float,2>{0.827156782f, 0.120426185f},
-std::array<float,2>{0.0424260981f, 0.706638038f},
-std::array<float,2>{0.200052589f, 0.16427128f},
-std::array<float,2>{0.953546286f, 0.517495155f},
-std::array<float,2>{0.736604333f, 0.338157803f},
-std::array<float,2>{0.487776786f, 0.923734188f},
-std::array<float,2>{0.0660862997f, 0.307385564f},
-std::array<float,2>{0.786627352f, 0.994676471f},
-std::array<float,2>{0.603238285f, 0.188914552f},
-std::array<float,2>{0.30281952f, 0.591079831f},
-std::array<float,2>{0.433117062f, 0.0420039147f},
-std::array<float,2>{0.671904802f, 0.684763432f},
-std::array<float,2>{0.881940007f, 0.479340643f},
-std::array<float,2>{0.154973388f, 0.768078625f},
-std::array<float,2>{0.399163365f, 0.4989838f},
-std::array<float,2>{0.653066099f, 0.752250791f},
-std::array<float,2>{0.911536932f, 0.0585019216f},
-std::array<float,2>{0.161981121f, 0.661806047f},
-std::array<float,2>{0.100755602f, 0.204002112f},
-std::array<float,2>{0.77266115f, 0.570168138f},
-std::array<float,2>{0.574967027f, 0.281284124f},
-std::array<float,2>{0.264746636f, 0.979665399f},
-std::array<float,2>{0.246377096f, 0.323028058f},
-std::array<float,2>{0.991182446f, 0.911551356f},
-std::array<float,2>{0.691999376f, 0.182117522f},
-std::array<float,2>{0.461636007f, 0.512815773f},
-std::array<float,2>{0.323821843f, 0.0942478776f},
-std::array<float,2>{0.504015625f, 0.700074255f},
-std::array<float,2>{0.848152518f, 0.411683738f},
-std::array<float,2>{0.00989479385f, 0.872305453f},
-std::array<float,2>{0.294343472f, 0.278343171f},
-std::array<float,2>{0.624768734f, 0.939994931f},
-std::array<float,2>{0.797696531f, 0.223666906f},
-std::array<float,2>{0.0842534378f, 0.609877408f},
-std::array<float,2>{0.128400743f, 0.000523751543f},
-std::array<float,2>{0.899157703f, 0.638116002f},
-std::array<float,2>{0.667799056f, 0.438362211f},
-std::array<float,2>{0.411392272f, 0.793229461f},
-std::array<float,2>{0.060251426f, 0.398825705f},
-std::array<float,2>{0.832673609f, 0.813431799f},
-std::array<float,2>{0.547914386f, 0.0707788318f},
-std::array<float,2>{0.345043719f, 0.723901391f},
-std::array<float,2>{0.47037071f, 0.14589566f},
-std::array<float,2>{0.727752864f, 0.540237546f},
-std::array<float,2>{0.943971992f, 0.363238752f},
-std::array<float,2>{0.212363467f, 0.877430618f},
-std::array<float,2>{0.385439128f, 0.316549003f},
-std::array<float,2>{0.630836189f, 0.91436255f},
-std::array<float,2>{0.93090409f, 0.17449151f},
-std::array<float,2>{0.185282469f, 0.502592802f},
-std::array<float,2>{0.117131837f, 0.108727545f},
-std::array<float,2>{0.756933391f, 0.693342149f},
-std::array<float,2>{0.59204334f, 0.420295626f},
-std::array<float,2>{0.275236547f, 0.864360034f},
-std::array<float,2>{0.225936949f, 0.489780009f},
-std::array<float,2>{0.973230124f, 0.765237153f},
-std::array<float,2>{0.711770296f, 0.0542434864f},
-std::array<float,2>{0.437508762f, 0.66689986f},
-std::array<float,2>{0.339900821f, 0.21485807f},
-std::array<float,2>{0.516004264f, 0.574448884f},
-std::array<float,2>{0.873381436f, 0.295433313f},
-std::array<float,2>{0.0282963421f, 0.971334875f},
-std::array<float,2>{0.300120533f, 0.398416728f},
-std::array<float,2>{0.607271791f, 0.824380577f},
-std::array<float,2>{0.783675849f, 0.0664094314f},
-std::array<float,2>{0.0664766952f, 0.732659996f},
-std::array<float,2>{0.151678652f, 0.154491931f},
-std::array<float,2>{0.876902103f, 0.53713727f},
-std::array<float,2>{0.678927541f, 0.371557236f},
-std::array<float,2>{0.434242308f, 0.887919128f},
-std::array<float,2>{0.0449753851f, 0.267728597f},
-std::array<float,2>{0.822851479f, 0.948397577f},
-std::array<float,2>{0.542314827f, 0.230782136f},
-std::array<float,2>{0.360396147f, 0.619436622f},
-std::array<float,2>{0.491046607f, 0.0121149085f},
-std::array<float,2>{0.739208579f, 0.629236639f},
-std::array<float,2>{0.959407926f, 0.450217903f},
-std::array<float,2>{0.19678086f, 0.787768364f},
-std::array<float,2>{0.467634916f, 0.463989228f},
-std::array<float,2>{0.688569486f, 0.798149824f},
-std::array<float,2>{0.986676872f, 0.0208284073f},
-std::array<float,2>{0.24507454f, 0.655319273f},
-std::array<float,2>{0.0123254461f, 0.236248538f},
-std::array<float,2>{0.845199347f, 0.607186139f},
-std::array<float,2>{0.501252115f, 0.254325569f},
-std::array<float,2>{0.327802598f, 0.956525266f},
-std::array<float,2>{0.157860011f, 0.358061314f},
-std::array<float,2>{0.906513512f, 0.896382034f},
-std::array<float,2>{0.651441336f, 0.133622661f},
-std::array<float,2>{0.402873397f, 0.561874866f},
-std::array<float,2>{0.259369314f, 0.0881610736f},
-std::array<float,2>{0.57075274f, 0.743323505f},
-std::array<float,2>{0.768514812f, 0.387681246f},
-std::array<float,2>{0.0972409025f, 0.830056906f},
-std::array<float,2>{0.34854877f, 0.304308355f},
-std::array<float,2>{0.553574204f, 0.991693974f},
-std::array<float,2>{0.829934359f, 0.199678853f},
-std::array<float,2>{0.0565880835f, 0.579899251f},
-std::array<float,2>{0.216102362f, 0.037076883f},
-std::array<float,2>{0.940452695f, 0.673604786f},
-std::array<float,2>{0.733433008f, 0.473925889f},
-std::array<float,2>{0.474010289f, 0.775041044f},
-std::array<float,2>{0.0813851953f, 0.434829175f},
-std::array<float,2>{0.804646671f, 0.856525421f},
-std::array<float,2>{0.62037456f, 0.114194706f},
-std::array<float,2>{0.289856046f, 0.712248504f},
-std::array<float,2>{0.406627476f, 0.163527906f},
-std::array<float,2>{0.669442415f, 0.528179348f},
-std::array<float,2>{0.902849674f, 0.334355086f},
-std::array<float,2>{0.132412136f, 0.933974862f},
-std::array<float,2>{0.477740288f, 0.26149267f},
-std::array<float,2>{0.726173937f, 0.966106772f},
-std::array<float,2>{0.94595933f, 0.249967411f},
-std::array<float,2>{0.207018986f, 0.601260602f},
-std::array<float,2>{0.0529932678f, 0.0248473808f},
-std::array<float,2>{0.83633399f, 0.646784008f},
-std::array<float,2>{0.556318343f, 0.454705685f},
-std::array<float,2>{0.352465391f, 0.81175077f},
-std::array<float,2>{0.139577255f, 0.382546037f},
-std::array<float,2>{0.894545853f, 0.838609874f},
-std::array<float,2>{0.663346827f, 0.0816562995f},
-std::array<float,2>{0.41767931f, 0.738543689f},
-std::array<float,2>{0.281677634f, 0.126885325f},
-std::array<float,2>{0.612985849f, 0.549852908f},
-std::array<float,2>{0.807853281f, 0.343940228f},
-std::array<float,2>{0.0859823525f, 0.901596963f},
-std::array<float,2>{0.318040013f, 0.48197341f},
-std::array<float,2>{0.512934744f, 0.773349643f},
-std::array<float,2>{0.854514956f, 0.0442968719f},
-std::array<float,2>{0.00224166969f, 0.682071984f},
-std::array<float,2>{0.23858811f, 0.19238624f},
-std::array<float,2>{0.997075438f, 0.589643598f},
-std::array<float,2>{0.702910125f, 0.309152812f},
-std::array<float,2>{0.456609577f, 0.996905625f},
-std::array<float,2>{0.105828851f, 0.342526823f},
-std::array<float,2>{0.77924335f, 0.925975561f},
-std::array<float,2>{0.564487875f, 0.168085888f},
-std::array<float,2>{0.255520016f, 0.520394325f},
-std::array<float,2>{0.396084875f, 0.121906675f},
-std::array<float,2>{0.641404569f, 0.707800925f},
-std::array<float,2>{0.916482508f, 0.424665391f},
-std::array<float,2>{0.166553617f, 0.846595049f},
-std::array<float,2>{0.428241313f, 0.407483786f},
-std::array<float,2>{0.685552597f, 0.86884141f},
-std::array<float,2>{0.890348077f, 0.0987915546f},
-std::array<float,2>{0.147847414f, 0.696810246f},
-std::array<float,2>{0.0749455616f, 0.187326327f},
-std::array<float,2>{0.793406665f, 0.508434832f},
-std::array<float,2>{0.596931934f, 0.324980468f},
-std::array<float,2>{0.311493099f, 0.907084525f},
-std::array<float,2>{0.187547922f, 0.2864272f},
-std::array<float,2>{0.96825695f, 0.983638763f},
-std::array<float,2>{0.744852364f, 0.207669482f},
-std::array<float,2>{0.494775593f, 0.564637065f},
-std::array<float,2>{0.367321491f, 0.0612821467f},
-std::array<float,2>{0.533412755f, 0.658988774f},
-std::array<float,2>{0.818111181f, 0.495578527f},
-std::array<float,2>{0.0370188206f, 0.754861891f},
-std::array<float,2>{0.27092132f, 0.365464449f},
-std::array<float,2>{0.58154422f, 0.880735099f},
-std::array<float,2>{0.763014495f, 0.14294371f},
-std::array<float,2>{0.120901249f, 0.545460105f},
-std::array<float,2>{0.179256901f, 0.0769821182f},
-std::array<float,2>{0.923907578f, 0.718809009f},
-std::array<float,2>{0.636302114f, 0.402559012f},
-std::array<float,2>{0.381907791f, 0.817304254f},
-std::array<float,2>{0.0163549967f, 0.442087889f},
-std::array<float,2>{0.863092244f, 0.790789366f},
-std::array<float,2>{0.526021659f, 0.00419892091f},
-std::array<float,2>{0.334278286f, 0.635632873f},
-std::array<float,2>{0.45285809f, 0.220575765f},
-std::array<float,2>{0.703271568f, 0.615449429f},
-std::array<float,2>{0.976794004f, 0.274905801f},
-std::array<float,2>{0.228570789f, 0.943973303f},
-std::array<float,2>{0.39092356f, 0.272694588f},
-std::array<float,2>{0.645389438f, 0.952776134f},
-std::array<float,2>{0.920886517f, 0.229115754f},
-std::array<float,2>{0.171241641f, 0.621443212f},
-std::array<float,2>{0.102714896f, 0.0093233129f},
-std::array<float,2>{0.776363015f, 0.626860678f},
-std::array<float,2>{0.569714844f, 0.448748976f},
-std::array<float,2>{0.251029581f, 0.784391165f},
-std::array<float,2>{0.236329004f, 0.39293009f},
-std::array<float,2>{0.995332122f, 0.821783006f},
-std::array<float,2>{0.697420359f, 0.0645651817f},
-std::array<float,2>{0.459521949f, 0.729853928f},
-std::array<float,2>{0.314268261f, 0.151417345f},
-std::array<float,2>{0.508701682f, 0.532375038f},
-std::array<float,2>{0.85715729f, 0.368874669f},
-std::array<float,2>{0.00462014647f, 0.883505166f},
-std::array<float,2>{0.285181999f, 0.485305756f},
-std::array<float,2>{0.61606282f, 0.761484623f},
-std::array<float,2>{0.811536729f, 0.0501286611f},
-std::array<float,2>{0.0916898176f, 0.671381533f},
-std::array<float,2>{0.135962009f, 0.212998688f},
-std::array<float,2>{0.892029524f, 0.570554912f},
-std::array<float,2>{0.658968627f, 0.292649895f},
-std::array<float,2>{0.42123726f, 0.97560674f},
-std::array<float,2>{0.0505571216f, 0.315758258f},
-std::array<float,2>{0.843487144f, 0.920896769f},
-std::array<float,2>{0.561052561f, 0.179143488f},
-std::array<float,2>{0.356248498f, 0.507066488f},
-std::array<float,2>{0.481920809f, 0.102703102f},
-std::array<float,2>{0.722123206f, 0.690199792f},
-std::array<float,2>{0.952874541f, 0.414898008f},
-std::array<float,2>{0.208983973f, 0.860148728f},
-std::array<float,2>{0.447082818f, 0.431691855f},
-std::array<float,2>{0.709182322f, 0.854185104f},
-std::array<float,2>{0.981687069f, 0.110447735f},
-std::array<float,2>{0.233272225f, 0.716309309f},
-std::array<float,2>{0.0200838037f, 0.157205492f},
-std::array<float,2>{0.86557287f, 0.526932955f},
-std::array<float,2>{0.529954195f, 0.330993146f},
-std::array<float,2>{0.329502076f, 0.930983603f},
-std::array<float,2>{0.174988359f, 0.297507137f},
-std::array<float,2>{0.926464975f, 0.987924516f},
-std::array<float,2>{0.63797456f, 0.196151987f},
-std::array<float,2>{0.376764268f, 0.583049536f},
-std::array<float,2>{0.266786724f, 0.0341488943f},
-std::array<float,2>{0.584228516f, 0.676159263f},
-std::array<float,2>{0.758215308f, 0.471400887f},
-std::array<float,2>{0.122426786f, 0.777671397f},
-std::array<float,2>{0.373556972f, 0.355227172f},
-std::array<float,2>{0.536566496f, 0.893168986f},
-std::array<float,2>{0.815829694f, 0.136948094f},
-std::array<float,2>{0.032640297f, 0.555277467f},
-std::array<float,2>{0.193237752f, 0.0916428939f},
-std::array<float,2>{0.962560892f, 0.746883631f},
-std::array<float,2>{0.748524904f, 0.384559274f},
-std::array<float,2>{0.497345328f, 0.83253926f},
-std::array<float,2>{0.0708319992f, 0.468041569f},
-std::array<float,2>{0.791571259f, 0.803178549f},
-std::array<float,2>{0.599605143f, 0.0187960993f},
-std::array<float,2>{0.307365179f, 0.651415288f},
-std::array<float,2>{0.424146503f, 0.239825547f},
-std::array<float,2>{0.681291997f, 0.604516268f},
-std::array<float,2>{0.886302352f, 0.252911031f},
-std::array<float,2>{0.143814161f, 0.958233416f},
-std::array<float,2>{0.486179262f, 0.336906642f},
-std::array<float,2>{0.734516799f, 0.924067616f},
-std::array<float,2>{0.955260158f, 0.166546375f},
-std::array<float,2>{0.202345908f, 0.519395053f},
-std::array<float,2>{0.0408168323f, 0.118807428f},
-std::array<float,2>{0.824335635f, 0.704122365f},
-std::array<float,2>{0.545139134f, 0.428968579f},
-std::array<float,2>{0.365932792f, 0.850407422f},
-std::array<float,2>{0.154082522f, 0.476733983f},
-std::array<float,2>{0.879701197f, 0.765821993f},
-std::array<float,2>{0.675107181f, 0.0396916382f},
-std::array<float,2>{0.431634158f, 0.685832739f},
-std::array<float,2>{0.301025152f, 0.18988423f},
-std::array<float,2>{0.605165243f, 0.59292829f},
-std::array<float,2>{0.787498355f, 0.305999726f},
-std::array<float,2>{0.0634593219f, 0.993942857f},
-std::array<float,2>{0.339443654f, 0.378751248f},
-std::array<float,2>{0.520535111f, 0.841570616f},
-std::array<float,2>{0.870086849f, 0.0845820457f},
-std::array<float,2>{0.0271334127f, 0.734751821f},
-std::array<float,2>{0.219157472f, 0.130198583f},
-std::array<float,2>{0.971769691f, 0.553161442f},
-std::array<float,2>{0.717950761f, 0.351543933f},
-std::array<float,2>{0.444565862f, 0.903324604f},
-std::array<float,2>{0.109846354f, 0.262471497f},
-std::array<float,2>{0.752870619f, 0.964287996f},
-std::array<float,2>{0.586089253f, 0.243391305f},
-std::array<float,2>{0.280797303f, 0.594877303f},
-std::array<float,2>{0.388842911f, 0.0277869422f},
-std::array<float,2>{0.62529248f, 0.641956985f},
-std::array<float,2>{0.936367214f, 0.45916158f},
-std::array<float,2>{0.182927191f, 0.808247268f},
-std::array<float,2>{0.412349582f, 0.440110028f},
-std::array<float,2>{0.664495111f, 0.795890629f},
-std::array<float,2>{0.901097119f, 0.00211711368f},
-std::array<float,2>{0.126439229f, 0.639249802f},
-std::array<float,2>{0.0830719471f, 0.224612921f},
-std::array<float,2>{0.799487472f, 0.611347854f},
-std::array<float,2>{0.62202704f, 0.280433178f},
-std::array<float,2>{0.295493752f, 0.938236058f},
-std::array<float,2>{0.213029817f, 0.359753639f},
-std::array<float,2>{0.94311142f, 0.8753618f},
-std::array<float,2>{0.729394376f, 0.146646917f},
-std::array<float,2>{0.472260863f, 0.542891443f},
-std::array<float,2>{0.345798135f, 0.0730754212f},
-std::array<float,2>{0.55028075f, 0.726140916f},
-std::array<float,2>{0.8358621f, 0.401106894f},
-std::array<float,2>{0.0615366921f, 0.814631104f},
-std::array<float,2>{0.263088703f, 0.284804314f},
-std::array<float,2>{0.577244282f, 0.97814548f},
-std::array<float,2>{0.770941198f, 0.206355527f},
-std::array<float,2>{0.0993117169f, 0.566904068f},
-std::array<float,2>{0.163948938f, 0.0565590262f},
-std::array<float,2>{0.913473427f, 0.662620962f},
-std::array<float,2>{0.655724645f, 0.497323155f},
-std::array<float,2>{0.400978357f, 0.751533926f},
-std::array<float,2>{0.00923638046f, 0.413216025f},
-std::array<float,2>{0.849887729f, 0.874332786f},
-std::array<float,2>{0.506121933f, 0.0965642035f},
-std::array<float,2>{0.321643919f, 0.701955616f},
-std::array<float,2>{0.463926256f, 0.179809436f},
-std::array<float,2>{0.693993688f, 0.515516639f},
-std::array<float,2>{0.990184426f, 0.32139799f},
-std::array<float,2>{0.248342142f, 0.912497401f},
-std::array<float,2>{0.436354548f, 0.374595374f},
-std::array<float,2>{0.677169621f, 0.89048481f},
-std::array<float,2>{0.877896488f, 0.153915524f},
-std::array<float,2>{0.149590969f, 0.536509454f},
-std::array<float,2>{0.0684798285f, 0.0688548461f},
-std::array<float,2>{0.782599509f, 0.732352436f},
-std::array<float,2>{0.609184146f, 0.394859791f},
-std::array<float,2>{0.298059762f, 0.827053487f},
-std::array<float,2>{0.199200347f, 0.451985329f},
-std::array<float,2>{0.957879663f, 0.786435544f},
-std::array<float,2>{0.742014945f, 0.0151808485f},
-std::array<float,2>{0.490174234f, 0.63165617f},
-std::array<float,2>{0.362352818f, 0.232927918f},
-std::array<float,2>{0.539171159f, 0.618556738f},
-std::array<float,2>{0.820320129f, 0.266447395f},
-std::array<float,2>{0.0429996178f, 0.946018159f},
-std::array<float,2>{0.275577277f, 0.419019222f},
-std::array<float,2>{0.590795696f, 0.865760982f},
-std::array<float,2>{0.755482018f, 0.105790347f},
-std::array<float,2>{0.114414871f, 0.694788575f},
-std::array<float,2>{0.186987221f, 0.172553867f},
-std::array<float,2>{0.932460487f, 0.50119406f},
-std::array<float,2>{0.632126868f, 0.318423361f},
-std::array<float,2>{0.383012921f, 0.917747617f},
-std::array<float,2>{0.0310093723f, 0.293762743f},
-std::array<float,2>{0.871680379f, 0.96988678f},
-std::array<float,2>{0.518194377f, 0.217550725f},
-std::array<float,2>{0.34210673f, 0.577355504f},
-std::array<float,2>{0.439613521f, 0.0524205044f},
-std::array<float,2>{0.713915169f, 0.664367139f},
-std::array<float,2>{0.975659788f, 0.490598649f},
-std::array<float,2>{0.224151731f, 0.762168944f},
-std::array<float,2>{0.475330412f, 0.476249516f},
-std::array<float,2>{0.73126477f, 0.776141763f},
-std::array<float,2>{0.937803388f, 0.0372032411f},
-std::array<float,2>{0.217010081f, 0.675132811f},
-std::array<float,2>{0.0569159165f, 0.201591045f},
-std::array<float,2>{0.831910312f, 0.581554532f},
-std::array<float,2>{0.55221045f, 0.301046282f},
-std::array<float,2>{0.349942684f, 0.988674939f},
-std::array<float,2>{0.129998267f, 0.33276242f},
-std::array<float,2>{0.906205893f, 0.937316656f},
-std::array<float,2>{0.670651019f, 0.160466343f},
-std::array<float,2>{0.408228099f, 0.53110522f},
-std::array<float,2>{0.292062879f, 0.116251044f},
-std::array<float,2>{0.617884755f, 0.713273644f},
-std::array<float,2>{0.801092803f, 0.436609566f},
-std::array<float,2>{0.0785457417f, 0.858389318f},
-std::array<float,2>{0.32496044f, 0.256718785f},
-std::array<float,2>{0.503194749f, 0.954108894f},
-std::array<float,2>{0.845766008f, 0.2371061f},
-std::array<float,2>{0.014052243f, 0.608839929f},
-std::array<float,2>{0.243805468f, 0.0228518564f},
-std::array<float,2>{0.984395146f, 0.652446747f},
-std::array<float,2>{0.6902861f, 0.462402761f},
-std::array<float,2>{0.464975893f, 0.799476922f},
-std::array<float,2>{0.0939225033f, 0.389750153f},
-std::array<float,2>{0.765707195f, 0.830751419f},
-std::array<float,2>{0.572835505f, 0.0875167698f},
-std::array<float,2>{0.260508567f, 0.745509863f},
-std::array<float,2>{0.404346138f, 0.135952175f},
-std::array<float,2>{0.649439335f, 0.559928596f},
-std::array<float,2>{0.908850968f, 0.355517417f},
-std::array<float,2>{0.158217907f, 0.89841187f},
-std::array<float,2>{0.454247355f, 0.312044978f},
-std::array<float,2>{0.699959457f, 0.999489784f},
-std::array<float,2>{0.99853152f, 0.193569794f},
-std::array<float,2>{0.240845427f, 0.586337149f},
-std::array<float,2>{0.0011111754f, 0.046737317f},
-std::array<float,2>{0.852412522f, 0.681011975f},
-std::array<float,2>{0.514417946f, 0.482505769f},
-std::array<float,2>{0.319353223f, 0.770704508f},
-std::array<float,2>{0.164672703f, 0.422423542f},
-std::array<float,2>{0.915864944f, 0.843824804f},
-std::array<float,2>{0.644100428f, 0.123547032f},
-std::array<float,2>{0.396750897f, 0.709259391f},
-std::array<float,2>{0.256451577f, 0.170975372f},
-std::array<float,2>{0.562995911f, 0.522427201f},
-std::array<float,2>{0.780191958f, 0.340980053f},
-std::array<float,2>{0.107536636f, 0.928624392f},
-std::array<float,2>{0.354325205f, 0.456623256f},
-std::array<float,2>{0.556929827f, 0.808858216f},
-std::array<float,2>{0.838034689f, 0.0259880144f},
-std::array<float,2>{0.0507900789f, 0.645389974f},
-std::array<float,2>{0.204966247f, 0.247000352f},
-std::array<float,2>{0.948939025f, 0.598110735f},
-std::array<float,2>{0.72367686f, 0.258388996f},
-std::array<float,2>{0.47928527f, 0.967656791f},
-std::array<float,2>{0.0892037898f, 0.346817255f},
-std::array<float,2>{0.806625128f, 0.8988958f},
-std::array<float,2>{0.611215532f, 0.127255529f},
-std::array<float,2>{0.284620613f, 0.547309577f},
-std::array<float,2>{0.415338486f, 0.0789477229f},
-std::array<float,2>{0.66093272f, 0.741391897f},
-std::array<float,2>{0.898038805f, 0.380616039f},
-std::array<float,2>{0.136736795f, 0.83761251f},
-std::array<float,2>{0.379852891f, 0.405415744f},
-std::array<float,2>{0.633136868f, 0.819591045f},
-std::array<float,2>{0.922806203f, 0.0754014626f},
-std::array<float,2>{0.17657119f, 0.721860707f},
-std::array<float,2>{0.117720179f, 0.141092256f},
-std::array<float,2>{0.764670551f, 0.543411613f},
-std::array<float,2>{0.579097748f, 0.363323659f},
-std::array<float,2>{0.271811485f, 0.881820142f},
-std::array<float,2>{0.228357419f, 0.275840551f},
-std::array<float,2>{0.979139626f, 0.941863716f},
-std::array<float,2>{0.706374168f, 0.221060529f},
-std::array<float,2>{0.449674875f, 0.613677382f},
-std::array<float,2>{0.333806098f, 0.00730393594f},
-std::array<float,2>{0.523979306f, 0.634645641f},
-std::array<float,2>{0.861147404f, 0.443459183f},
-std::array<float,2>{0.0185648631f, 0.792172015f},
-std::array<float,2>{0.31024161f, 0.328057498f},
-std::array<float,2>{0.595143259f, 0.908365846f},
-std::array<float,2>{0.796622038f, 0.184478596f},
-std::array<float,2>{0.0772294775f, 0.51101625f},
-std::array<float,2>{0.145246938f, 0.101346582f},
-std::array<float,2>{0.888282418f, 0.698137164f},
-std::array<float,2>{0.685076594f, 0.408547938f},
-std::array<float,2>{0.426442832f, 0.870733321f},
-std::array<float,2>{0.0377975665f, 0.492257327f},
-std::array<float,2>{0.819514275f, 0.756193161f},
-std::array<float,2>{0.532616198f, 0.0586197637f},
-std::array<float,2>{0.370706707f, 0.657069445f},
-std::array<float,2>{0.493169427f, 0.209250107f},
-std::array<float,2>{0.743679762f, 0.562672973f},
-std::array<float,2>{0.965695441f, 0.287665099f},
-std::array<float,2>{0.191313565f, 0.982417762f},
-std::array<float,2>{0.400398731f, 0.282050371f},
-std::array<float,2>{0.656048834f, 0.980372727f},
-std::array<float,2>{0.913696468f, 0.203561231f},
-std::array<float,2>{0.163523301f, 0.569767475f},
-std::array<float,2>{0.0989343822f, 0.0576737188f},
-std::array<float,2>{0.771306872f, 0.661138654f},
-std::array<float,2>{0.578083217f, 0.498428673f},
-std::array<float,2>{0.263337433f, 0.752757609f},
-std::array<float,2>{0.248935118f, 0.411403388f},
-std::array<float,2>{0.989507794f, 0.872956097f},
-std::array<float,2>{0.69360739f, 0.0939497426f},
-std::array<float,2>{0.464478791f, 0.699421227f},
-std::array<float,2>{0.321797937f, 0.182302326f},
-std::array<float,2>{0.506538033f, 0.513418972f},
-std::array<float,2>{0.850395083f, 0.322557241f},
-std::array<float,2>{0.00957917329f, 0.912081301f},
-std::array<float,2>{0.295102924f, 0.437736422f},
-std::array<float,2>{0.621408343f, 0.793756187f},
-std::array<float,2>{0.799040854f, 0.000345672219f},
-std::array<float,2>{0.0839099139f, 0.638518333f},
-std::array<float,2>{0.126766637f, 0.224295765f},
-std::array<float,2>{0.900731862f, 0.609695017f},
-std::array<float,2>{0.664595127f, 0.279008329f},
-std::array<float,2>{0.41276288f, 0.939785004f},
-std::array<float,2>{0.0624029934f, 0.362614661f},
-std::array<float,2>{0.835367203f, 0.877822518f},
-std::array<float,2>{0.550625443f, 0.146017149f},
-std::array<float,2>{0.346380383f, 0.540549338f},
-std::array<float,2>{0.471728265f, 0.0709598809f},
-std::array<float,2>{0.728646398f, 0.724454999f},
-std::array<float,2>{0.942508101f, 0.39892748f},
-std::array<float,2>{0.213593826f, 0.812581837f},
-std::array<float,2>{0.445128918f, 0.376181126f},
-std::array<float,2>{0.718711257f, 0.84188813f},
-std::array<float,2>{0.972176015f, 0.082823433f},
-std::array<float,2>{0.219241783f, 0.736469328f},
-std::array<float,2>{0.0267621484f, 0.132720813f},
-std::array<float,2>{0.869181991f, 0.55261749f},
-std::array<float,2>{0.521220922f, 0.348957509f},
-std::array<float,2>{0.339079529f, 0.906169057f},
-std::array<float,2>{0.183292165f, 0.26407069f},
-std::array<float,2>{0.935855329f, 0.961300492f},
-std::array<float,2>{0.625932753f, 0.244588718f},
-std::array<float,2>{0.389400482f, 0.597421885f},
-std::array<float,2>{0.280391932f, 0.0294167921f},
-std::array<float,2>{0.586430669f, 0.642590523f},
-std::array<float,2>{0.752339542f, 0.457268625f},
-std::array<float,2>{0.110164262f, 0.806418419f},
-std::array<float,2>{0.365265816f, 0.338808507f},
-std::array<float,2>{0.545696557f, 0.922914445f},
-std::array<float,2>{0.825063586f, 0.164880753f},
-std::array<float,2>{0.0402240567f, 0.516848862f},
-std::array<float,2>{0.202753529f, 0.120626181f},
-std::array<float,2>{0.955617785f, 0.706465125f},
-std::array<float,2>{0.734953284f, 0.426926702f},
-std::array<float,2>{0.485407889f, 0.849006951f},
-std::array<float,2>{0.0629002154f, 0.478956521f},
-std::array<float,2>{0.787623584f, 0.767954886f},
-std::array<float,2>{0.604518294f, 0.0427907892f},
-std::array<float,2>{0.301665157f, 0.685515583f},
-std::array<float,2>{0.43108651f, 0.189069554f},
-std::array<float,2>{0.67555356f, 0.591436207f},
-std::array<float,2>{0.879265368f, 0.306731731f},
-std::array<float,2>{0.153778777f, 0.99461776f},
-std::array<float,2>{0.497907192f, 0.353271276f},
-std::array<float,2>{0.748765528f, 0.892280221f},
-std::array<float,2>{0.962285161f, 0.139713243f},
-std::array<float,2>{0.192704543f, 0.558081865f},
-std::array<float,2>{0.0330607705f, 0.0923480466f},
-std::array<float,2>{0.816350222f, 0.749479234f},
-std::array<float,2>{0.536930144f, 0.385731459f},
-std::array<float,2>{0.373193324f, 0.834410131f},
-std::array<float,2>{0.14434135f, 0.466307849f},
-std::array<float,2>{0.8860811f, 0.802091837f},
-std::array<float,2>{0.680730224f, 0.0163917542f},
-std::array<float,2>{0.424692184f, 0.64867872f},
-std::array<float,2>{0.306944788f, 0.240548015f},
-std::array<float,2>{0.598788202f, 0.602726519f},
-std::array<float,2>{0.79115361f, 0.250559241f},
-std::array<float,2>{0.0707672536f, 0.959562004f},
-std::array<float,2>{0.329656333f, 0.430140972f},
-std::array<float,2>{0.529568255f, 0.853344381f},
-std::array<float,2>{0.866034448f, 0.11167416f},
-std::array<float,2>{0.020008035f, 0.71783936f},
-std::array<float,2>{0.232681066f, 0.158844128f},
-std::array<float,2>{0.982146204f, 0.524124682f},
-std::array<float,2>{0.709665537f, 0.328160524f},
-std::array<float,2>{0.446516037f, 0.931867599f},
-std::array<float,2>{0.122724496f, 0.299891531f},
-std::array<float,2>{0.758610189f, 0.985068023f},
-std::array<float,2>{0.584651709f, 0.199131712f},
-std::array<float,2>{0.267424822f, 0.585388958f},
-std::array<float,2>{0.376336098f, 0.031622652f},
-std::array<float,2>{0.638286352f, 0.678587139f},
-std::array<float,2>{0.925803661f, 0.469773263f},
-std::array<float,2>{0.175690234f, 0.77934283f},
-std::array<float,2>{0.42144978f, 0.486785501f},
-std::array<float,2>{0.658363819f, 0.759049773f},
-std::array<float,2>{0.892227054f, 0.0486705229f},
-std::array<float,2>{0.136566728f, 0.668933153f},
-std::array<float,2>{0.0913060904f, 0.211090297f},
-std::array<float,2>{0.812056541f, 0.574112952f},
-std::array<float,2>{0.615619659f, 0.289792657f},
-std::array<float,2>{0.285989165f, 0.973533094f},
-std::array<float,2>{0.208032697f, 0.313603759f},
-std::array<float,2>{0.95234561f, 0.91909951f},
-std::array<float,2>{0.722472012f, 0.175905466f},
-std::array<float,2>{0.482136041f, 0.504015982f},
-std::array<float,2>{0.355548829f, 0.104241662f},
-std::array<float,2>{0.560558498f, 0.687906027f},
-std::array<float,2>{0.842969418f, 0.416814417f},
-std::array<float,2>{0.0500861853f, 0.863034487f},
-std::array<float,2>{0.251500666f, 0.269754052f},
-std::array<float,2>{0.569846034f, 0.951112211f},
-std::array<float,2>{0.775842488f, 0.227180511f},
-std::array<float,2>{0.103475466f, 0.624925315f},
-std::array<float,2>{0.171580553f, 0.0107113281f},
-std::array<float,2>{0.92019099f, 0.628770053f},
-std::array<float,2>{0.644635081f, 0.446781307f},
-std::array<float,2>{0.391401112f, 0.781265616f},
-std::array<float,2>{0.00396512775f, 0.391297668f},
-std::array<float,2>{0.856573939f, 0.824059129f},
-std::array<float,2>{0.50799334f, 0.0640756562f},
-std::array<float,2>{0.313688576f, 0.726593018f},
-std::array<float,2>{0.45900175f, 0.149608478f},
-std::array<float,2>{0.697803378f, 0.533951819f},
-std::array<float,2>{0.995779753f, 0.370700926f},
-std::array<float,2>{0.237283304f, 0.885065794f},
-std::array<float,2>{0.426139712f, 0.324467391f},
-std::array<float,2>{0.684801936f, 0.906647265f},
-std::array<float,2>{0.887845397f, 0.186925471f},
-std::array<float,2>{0.144735143f, 0.508286536f},
-std::array<float,2>{0.077662386f, 0.0993235111f},
-std::array<float,2>{0.796242476f, 0.696688056f},
-std::array<float,2>{0.59544158f, 0.407769471f},
-std::array<float,2>{0.309584588f, 0.868218482f},
-std::array<float,2>{0.190841079f, 0.495638549f},
-std::array<float,2>{0.964899004f, 0.753969729f},
-std::array<float,2>{0.743174553f, 0.0607664473f},
-std::array<float,2>{0.493763924f, 0.658304214f},
-std::array<float,2>{0.370416701f, 0.207474545f},
-std::array<float,2>{0.533121169f, 0.564950824f},
-std::array<float,2>{0.820164144f, 0.286895245f},
-std::array<float,2>{0.0375732258f, 0.984361053f},
-std::array<float,2>{0.272013783f, 0.402993351f},
-std::array<float,2>{0.578226626f, 0.816528082f},
-std::array<float,2>{0.765552223f, 0.0764256939f},
-std::array<float,2>{0.117600128f, 0.719604731f},
-std::array<float,2>{0.176251695f, 0.143250525f},
-std::array<float,2>{0.92236197f, 0.545091748f},
-std::array<float,2>{0.633776009f, 0.366082489f},
-std::array<float,2>{0.378958076f, 0.880021214f},
-std::array<float,2>{0.0191470832f, 0.274882466f},
-std::array<float,2>{0.860710919f, 0.943809927f},
-std::array<float,2>{0.523792148f, 0.220157027f},
-std::array<float,2>{0.33323127f, 0.616114974f},
-std::array<float,2>{0.449730814f, 0.00450636586f},
-std::array<float,2>{0.706709087f, 0.635021508f},
-std::array<float,2>{0.978587031f, 0.441614926f},
-std::array<float,2>{0.227706715f, 0.790112078f},
-std::array<float,2>{0.478651375f, 0.454334825f},
-std::array<float,2>{0.724200249f, 0.812137604f},
-std::array<float,2>{0.948559642f, 0.0251029357f},
-std::array<float,2>{0.204268903f, 0.647304475f},
-std::array<float,2>{0.0513947755f, 0.249498799f},
-std::array<float,2>{0.838662684f, 0.600616217f},
-std::array<float,2>{0.557240307f, 0.26102668f},
-std::array<float,2>{0.353627473f, 0.966470301f},
-std::array<float,2>{0.137475997f, 0.344515264f},
-std::array<float,2>{0.897821665f, 0.901986957f},
-std::array<float,2>{0.660546839f, 0.126078621f},
-std::array<float,2>{0.415542066f, 0.550421357f},
-std::array<float,2>{0.284729838f, 0.0814910457f},
-std::array<float,2>{0.610638201f, 0.738808453f},
-std::array<float,2>{0.806096137f, 0.381848365f},
-std::array<float,2>{0.0897893608f, 0.838231504f},
-std::array<float,2>{0.320264548f, 0.308819771f},
-std::array<float,2>{0.513740778f, 0.996119142f},
-std::array<float,2>{0.851707101f, 0.193328083f},
-std::array<float,2>{0.00156856934f, 0.589174807f},
-std::array<float,2>{0.240235031f, 0.0445451662f},
-std::array<float,2>{0.998884559f, 0.682342231f},
-std::array<float,2>{0.699585795f, 0.481566548f},
-std::array<float,2>{0.455031067f, 0.772554994f},
-std::array<float,2>{0.108375721f, 0.424282759f},
-std::array<float,2>{0.779699922f, 0.845901668f},
-std::array<float,2>{0.562948108f, 0.121340625f},
-std::array<float,2>{0.255959898f, 0.707463086f},
-std::array<float,2>{0.397137642f, 0.168509662f},
-std::array<float,2>{0.643634796f, 0.51995796f},
-std::array<float,2>{0.915312886f, 0.342137545f},
-std::array<float,2>{0.164446741f, 0.926754475f},
-std::array<float,2>{0.465439975f, 0.254659265f},
-std::array<float,2>{0.689880133f, 0.9565804f},
-std::array<float,2>{0.985331059f, 0.235672876f},
-std::array<float,2>{0.243277624f, 0.60664624f},
-std::array<float,2>{0.0145198032f, 0.0211688392f},
-std::array<float,2>{0.846536279f, 0.656087637f},
-std::array<float,2>{0.503518283f, 0.464636981f},
-std::array<float,2>{0.324594527f, 0.798352361f},
-std::array<float,2>{0.159096032f, 0.387012333f},
-std::array<float,2>{0.908610046f, 0.829117954f},
-std::array<float,2>{0.649971306f, 0.0886034295f},
-std::array<float,2>{0.4049972f, 0.743962884f},
-std::array<float,2>{0.259997398f, 0.133002266f},
-std::array<float,2>{0.57264179f, 0.562167585f},
-std::array<float,2>{0.766474605f, 0.357733876f},
-std::array<float,2>{0.0945248753f, 0.895603299f},
-std::array<float,2>{0.350218058f, 0.474526882f},
-std::array<float,2>{0.552577376f, 0.77454412f},
-std::array<float,2>{0.831322253f, 0.0363729671f},
-std::array<float,2>{0.0571561828f, 0.672966003f},
-std::array<float,2>{0.217513174f, 0.199947551f},
-std::array<float,2>{0.938132048f, 0.579116762f},
-std::array<float,2>{0.730883956f, 0.30391556f},
-std::array<float,2>{0.475017816f, 0.991753042f},
-std::array<float,2>{0.07901638f, 0.334951669f},
-std::array<float,2>{0.801570952f, 0.934400439f},
-std::array<float,2>{0.617587209f, 0.163990632f},
-std::array<float,2>{0.292683125f, 0.527745664f},
-std::array<float,2>{0.409055322f, 0.113406584f},
-std::array<float,2>{0.670356512f, 0.712406456f},
-std::array<float,2>{0.905397594f, 0.435218513f},
-std::array<float,2>{0.130599394f, 0.857057154f},
-std::array<float,2>{0.383637697f, 0.420556843f},
-std::array<float,2>{0.632516205f, 0.865076542f},
-std::array<float,2>{0.931789398f, 0.109078258f},
-std::array<float,2>{0.187046438f, 0.692672372f},
-std::array<float,2>{0.115166537f, 0.174149528f},
-std::array<float,2>{0.75519079f, 0.502039611f},
-std::array<float,2>{0.590303481f, 0.317104518f},
-std::array<float,2>{0.276281536f, 0.91457355f},
-std::array<float,2>{0.224038154f, 0.295354217f},
-std::array<float,2>{0.976119101f, 0.970856726f},
-std::array<float,2>{0.714664817f, 0.215585709f},
-std::array<float,2>{0.440214038f, 0.57504952f},
-std::array<float,2>{0.342504382f, 0.0537987165f},
-std::array<float,2>{0.517635047f, 0.666292429f},
-std::array<float,2>{0.871241808f, 0.489474326f},
-std::array<float,2>{0.0304430127f, 0.764840662f},
-std::array<float,2>{0.298652887f, 0.371616453f},
-std::array<float,2>{0.608404398f, 0.888595641f},
-std::array<float,2>{0.782716691f, 0.155099556f},
-std::array<float,2>{0.0690311268f, 0.538026512f},
-std::array<float,2>{0.149988279f, 0.0673718303f},
-std::array<float,2>{0.87728411f, 0.733210325f},
-std::array<float,2>{0.67731595f, 0.397762954f},
-std::array<float,2>{0.435780793f, 0.824768662f},
-std::array<float,2>{0.0439086817f, 0.451005071f},
-std::array<float,2>{0.821226478f, 0.787543893f},
-std::array<float,2>{0.539796472f, 0.0125218881f},
-std::array<float,2>{0.363181472f, 0.629424632f},
-std::array<float,2>{0.489383042f, 0.231204033f},
-std::array<float,2>{0.741472781f, 0.619954765f},
-std::array<float,2>{0.957414746f, 0.268370867f},
-std::array<float,2>{0.198247239f, 0.949152827f},
-std::array<float,2>{0.4119789f, 0.28106457f},
-std::array<float,2>{0.667319715f, 0.937561512f},
-std::array<float,2>{0.898555815f, 0.225430146f},
-std::array<float,2>{0.128671587f, 0.61191982f},
-std::array<float,2>{0.0846726596f, 0.00246736151f},
-std::array<float,2>{0.796924889f, 0.638709366f},
-std::array<float,2>{0.624505579f, 0.439713717f},
-std::array<float,2>{0.294838488f, 0.795039415f},
-std::array<float,2>{0.212774441f, 0.400670588f},
-std::array<float,2>{0.943663538f, 0.81542629f},
-std::array<float,2>{0.728178084f, 0.0726611018f},
-std::array<float,2>{0.470181018f, 0.725679398f},
-std::array<float,2>{0.34524703f, 0.147426844f},
-std::array<float,2>{0.548729718f, 0.542089939f},
-std::array<float,2>{0.832243323f, 0.360144794f},
-std::array<float,2>{0.060002666f, 0.875595391f},
-std::array<float,2>{0.265265763f, 0.497759402f},
-std::array<float,2>{0.574576616f, 0.751324296f},
-std::array<float,2>{0.773419142f, 0.056011118f},
-std::array<float,2>{0.101114847f, 0.662390828f},
-std::array<float,2>{0.161419496f, 0.206664056f},
-std::array<float,2>{0.912076533f, 0.566687763f},
-std::array<float,2>{0.652816117f, 0.284257293f},
-std::array<float,2>{0.398853779f, 0.977827668f},
-std::array<float,2>{0.0102634663f, 0.322079539f},
-std::array<float,2>{0.847982645f, 0.913037241f},
-std::array<float,2>{0.504791498f, 0.180262625f},
-std::array<float,2>{0.323676229f, 0.514686167f},
-std::array<float,2>{0.460957766f, 0.0958003327f},
-std::array<float,2>{0.691850185f, 0.701192141f},
-std::array<float,2>{0.990560234f, 0.413735837f},
-std::array<float,2>{0.246863797f, 0.874862313f},
-std::array<float,2>{0.488192677f, 0.429219484f},
-std::array<float,2>{0.736937642f, 0.849660456f},
-std::array<float,2>{0.953811347f, 0.118269816f},
-std::array<float,2>{0.199588746f, 0.704702139f},
-std::array<float,2>{0.0427910537f, 0.16618298f},
-std::array<float,2>{0.827834487f, 0.518978298f},
-std::array<float,2>{0.543100119f, 0.335950404f},
-std::array<float,2>{0.363611311f, 0.924472153f},
-std::array<float,2>{0.154588744f, 0.306264907f},
-std::array<float,2>{0.882424474f, 0.993490934f},
-std::array<float,2>{0.672365308f, 0.190045327f},
-std::array<float,2>{0.432850301f, 0.593705833f},
-std::array<float,2>{0.303431958f, 0.0391671434f},
-std::array<float,2>{0.602816761f, 0.686199784f},
-std::array<float,2>{0.786288679f, 0.477128655f},
-std::array<float,2>{0.0658591092f, 0.766471028f},
-std::array<float,2>{0.336114794f, 0.350838155f},
-std::array<float,2>{0.522885561f, 0.903885484f},
-std::array<float,2>{0.868252635f, 0.130809978f},
-std::array<float,2>{0.0248094387f, 0.553275168f},
-std::array<float,2>{0.221953794f, 0.0841823816f},
-std::array<float,2>{0.970597148f, 0.735208452f},
-std::array<float,2>{0.716411352f, 0.378097326f},
-std::array<float,2>{0.442836493f, 0.840988398f},
-std::array<float,2>{0.112600073f, 0.459652901f},
-std::array<float,2>{0.75133878f, 0.807631612f},
-std::array<float,2>{0.589275181f, 0.0279925168f},
-std::array<float,2>{0.278062046f, 0.642460167f},
-std::array<float,2>{0.387125194f, 0.243922025f},
-std::array<float,2>{0.62769115f, 0.595435202f},
-std::array<float,2>{0.93514508f, 0.261959523f},
-std::array<float,2>{0.180478096f, 0.964382589f},
-std::array<float,2>{0.448384941f, 0.330117285f},
-std::array<float,2>{0.70707202f, 0.931471288f},
-std::array<float,2>{0.983996689f, 0.156628266f},
-std::array<float,2>{0.23179625f, 0.526638329f},
-std::array<float,2>{0.0226284526f, 0.111294508f},
-std::array<float,2>{0.863754332f, 0.715967476f},
-std::array<float,2>{0.528147817f, 0.432196349f},
-std::array<float,2>{0.331684858f, 0.85362196f},
-std::array<float,2>{0.171945408f, 0.471045047f},
-std::array<float,2>{0.927992165f, 0.778305888f},
-std::array<float,2>{0.640246034f, 0.0334514491f},
-std::array<float,2>{0.378360868f, 0.676568389f},
-std::array<float,2>{0.267764181f, 0.195705071f},
-std::array<float,2>{0.583211243f, 0.583681822f},
-std::array<float,2>{0.76069057f, 0.297242135f},
-std::array<float,2>{0.124181896f, 0.987454712f},
-std::array<float,2>{0.37286815f, 0.384046942f},
-std::array<float,2>{0.538200736f, 0.83212465f},
-std::array<float,2>{0.813240469f, 0.0908248425f},
-std::array<float,2>{0.0341215283f, 0.746229291f},
-std::array<float,2>{0.19395116f, 0.137263626f},
-std::array<float,2>{0.964360237f, 0.554829776f},
-std::array<float,2>{0.746199965f, 0.354589522f},
-std::array<float,2>{0.49879548f, 0.892756104f},
-std::array<float,2>{0.0726433843f, 0.252102435f},
-std::array<float,2>{0.789182007f, 0.9588238f},
-std::array<float,2>{0.600559294f, 0.239369303f},
-std::array<float,2>{0.306268662f, 0.605363607f},
-std::array<float,2>{0.422614545f, 0.0191728994f},
-std::array<float,2>{0.683067441f, 0.652319074f},
-std::array<float,2>{0.883714616f, 0.468645066f},
-std::array<float,2>{0.141340807f, 0.803637385f},
-std::array<float,2>{0.394153029f, 0.448390335f},
-std::array<float,2>{0.64795661f, 0.784990907f},
-std::array<float,2>{0.918857932f, 0.00901332498f},
-std::array<float,2>{0.168047518f, 0.62644434f},
-std::array<float,2>{0.105143234f, 0.228815079f},
-std::array<float,2>{0.77531147f, 0.621860981f},
-std::array<float,2>{0.567493021f, 0.273412913f},
-std::array<float,2>{0.252231151f, 0.952473402f},
-std::array<float,2>{0.235876411f, 0.36835286f},
-std::array<float,2>{0.992599308f, 0.88303715f},
-std::array<float,2>{0.69629097f, 0.1523166f},
-std::array<float,2>{0.457123667f, 0.532992363f},
-std::array<float,2>{0.316289127f, 0.0649550408f},
-std::array<float,2>{0.511209726f, 0.730233788f},
-std::array<float,2>{0.859124422f, 0.393382192f},
-std::array<float,2>{0.00593696954f, 0.82160455f},
-std::array<float,2>{0.287627578f, 0.292401046f},
-std::array<float,2>{0.614684641f, 0.976246476f},
-std::array<float,2>{0.810152948f, 0.213715777f},
-std::array<float,2>{0.0934268609f, 0.571118772f},
-std::array<float,2>{0.133597836f, 0.0507398434f},
-std::array<float,2>{0.893419921f, 0.67157501f},
-std::array<float,2>{0.656458139f, 0.484594047f},
-std::array<float,2>{0.418976396f, 0.760882199f},
-std::array<float,2>{0.0486192219f, 0.414116472f},
-std::array<float,2>{0.841710687f, 0.859812915f},
-std::array<float,2>{0.559783518f, 0.103400975f},
-std::array<float,2>{0.357945383f, 0.689531922f},
-std::array<float,2>{0.483441085f, 0.179283664f},
-std::array<float,2>{0.720677197f, 0.507434309f},
-std::array<float,2>{0.951004922f, 0.315918922f},
-std::array<float,2>{0.210254952f, 0.920230865f},
-std::array<float,2>{0.382460535f, 0.363871992f},
-std::array<float,2>{0.636134148f, 0.880901694f},
-std::array<float,2>{0.924497545f, 0.141373917f},
-std::array<float,2>{0.17875506f, 0.543466866f},
-std::array<float,2>{0.120249249f, 0.0759414062f},
-std::array<float,2>{0.763336241f, 0.722386718f},
-std::array<float,2>{0.581542373f, 0.406244099f},
-std::array<float,2>{0.271179646f, 0.820015788f},
-std::array<float,2>{0.229321957f, 0.444289148f},
-std::array<float,2>{0.977263451f, 0.792524517f},
-std::array<float,2>{0.703773379f, 0.00757317897f},
-std::array<float,2>{0.452196091f, 0.63403517f},
-std::array<float,2>{0.334937602f, 0.221597493f},
-std::array<float,2>{0.525391161f, 0.61399585f},
-std::array<float,2>{0.862692058f, 0.276288718f},
-std::array<float,2>{0.0159719381f, 0.942309618f},
-std::array<float,2>{0.310846031f, 0.409120083f},
-std::array<float,2>{0.597465992f, 0.870260477f},
-std::array<float,2>{0.793504f, 0.100739054f},
-std::array<float,2>{0.0743563026f, 0.697314203f},
-std::array<float,2>{0.148246869f, 0.183999911f},
-std::array<float,2>{0.88990283f, 0.511575758f},
-std::array<float,2>{0.686219156f, 0.3272852f},
-std::array<float,2>{0.427871704f, 0.90894115f},
-std::array<float,2>{0.0364298746f, 0.287257463f},
-std::array<float,2>{0.817755759f, 0.981579125f},
-std::array<float,2>{0.533861339f, 0.209683701f},
-std::array<float,2>{0.36781615f, 0.563192427f},
-std::array<float,2>{0.494340867f, 0.0593435839f},
-std::array<float,2>{0.744153678f, 0.656511128f},
-std::array<float,2>{0.968355834f, 0.492886871f},
-std::array<float,2>{0.188054904f, 0.756621063f},
-std::array<float,2>{0.456109464f, 0.483053267f},
-std::array<float,2>{0.702366292f, 0.771251738f},
-std::array<float,2>{0.997813821f, 0.0461404398f},
-std::array<float,2>{0.23902674f, 0.681335211f},
-std::array<float,2>{0.00253996789f, 0.193869784f},
-std::array<float,2>{0.855419457f, 0.586787164f},
-std::array<float,2>{0.513517618f, 0.311687857f},
-std::array<float,2>{0.317456037f, 0.999668658f},
-std::array<float,2>{0.166326359f, 0.341747791f},
-std::array<float,2>{0.916740417f, 0.928148568f},
-std::array<float,2>{0.640803516f, 0.171769142f},
-std::array<float,2>{0.395694464f, 0.521625102f},
-std::array<float,2>{0.255349874f, 0.123053335f},
-std::array<float,2>{0.565222263f, 0.709542572f},
-std::array<float,2>{0.77850306f, 0.422164619f},
-std::array<float,2>{0.106196061f, 0.844456732f},
-std::array<float,2>{0.351581097f, 0.258160979f},
-std::array<float,2>{0.556022048f, 0.96702081f},
-std::array<float,2>{0.836801767f, 0.246306852f},
-std::array<float,2>{0.0533240847f, 0.598345041f},
-std::array<float,2>{0.206511885f, 0.0258748401f},
-std::array<float,2>{0.94544816f, 0.644620121f},
-std::array<float,2>{0.725880384f, 0.456198663f},
-std::array<float,2>{0.478119969f, 0.809295297f},
-std::array<float,2>{0.0868131593f, 0.379988879f},
-std::array<float,2>{0.808450997f, 0.837338746f},
-std::array<float,2>{0.612738669f, 0.0782576203f},
-std::array<float,2>{0.282126397f, 0.742058754f},
-std::array<float,2>{0.417358071f, 0.127896875f},
-std::array<float,2>{0.663653374f, 0.547503173f},
-std::array<float,2>{0.895504117f, 0.347554266f},
-std::array<float,2>{0.138933063f, 0.899209559f},
-std::array<float,2>{0.474528372f, 0.301708609f},
-std::array<float,2>{0.73424226f, 0.98890686f},
-std::array<float,2>{0.941364944f, 0.201805606f},
-std::array<float,2>{0.216780126f, 0.58113724f},
-std::array<float,2>{0.0560453832f, 0.0379569903f},
-std::array<float,2>{0.829341352f, 0.675591469f},
-std::array<float,2>{0.553107619f, 0.475799382f},
-std::array<float,2>{0.347914845f, 0.775877059f},
-std::array<float,2>{0.131876722f, 0.437464356f},
-std::array<float,2>{0.902742326f, 0.857775867f},
-std::array<float,2>{0.669373155f, 0.117071889f},
-std::array<float,2>{0.406855941f, 0.713573754f},
-std::array<float,2>{0.289345741f, 0.161035016f},
-std::array<float,2>{0.620934427f, 0.53035742f},
-std::array<float,2>{0.803988814f, 0.332354009f},
-std::array<float,2>{0.0817647055f, 0.936618865f},
-std::array<float,2>{0.327518076f, 0.462007642f},
-std::array<float,2>{0.501868546f, 0.799066842f},
-std::array<float,2>{0.845452726f, 0.0234116632f},
-std::array<float,2>{0.0121721914f, 0.65328455f},
-std::array<float,2>{0.244461507f, 0.236541152f},
-std::array<float,2>{0.986882746f, 0.609038174f},
-std::array<float,2>{0.689412117f, 0.256238461f},
-std::array<float,2>{0.467006564f, 0.955000758f},
-std::array<float,2>{0.0969658792f, 0.356183738f},
-std::array<float,2>{0.767711222f, 0.897608519f},
-std::array<float,2>{0.570996284f, 0.136291742f},
-std::array<float,2>{0.258898973f, 0.560419202f},
-std::array<float,2>{0.402754784f, 0.0871659145f},
-std::array<float,2>{0.652286112f, 0.745963097f},
-std::array<float,2>{0.907006681f, 0.390610218f},
-std::array<float,2>{0.157481387f, 0.830255806f},
-std::array<float,2>{0.433691472f, 0.39502719f},
-std::array<float,2>{0.67925781f, 0.826483428f},
-std::array<float,2>{0.87610662f, 0.0683844909f},
-std::array<float,2>{0.152171895f, 0.731706202f},
-std::array<float,2>{0.0671333969f, 0.153473243f},
-std::array<float,2>{0.784115851f, 0.536963999f},
-std::array<float,2>{0.606832147f, 0.374067754f},
-std::array<float,2>{0.300566554f, 0.889861584f},
-std::array<float,2>{0.196328342f, 0.265956342f},
-std::array<float,2>{0.959899902f, 0.94571352f},
-std::array<float,2>{0.738441885f, 0.232891113f},
-std::array<float,2>{0.490645587f, 0.618918002f},
-std::array<float,2>{0.360962629f, 0.0150270863f},
-std::array<float,2>{0.542554617f, 0.63126862f},
-std::array<float,2>{0.822443724f, 0.45135057f},
-std::array<float,2>{0.0455207452f, 0.78700316f},
-std::array<float,2>{0.274786383f, 0.319054306f},
-std::array<float,2>{0.592543006f, 0.91723305f},
-std::array<float,2>{0.757406235f, 0.17204693f},
-std::array<float,2>{0.116269663f, 0.501487553f},
-std::array<float,2>{0.184669226f, 0.10610757f},
-std::array<float,2>{0.9315328f, 0.694876254f},
-std::array<float,2>{0.630107939f, 0.419682562f},
-std::array<float,2>{0.3849774f, 0.865602136f},
-std::array<float,2>{0.0274745077f, 0.490848988f},
-std::array<float,2>{0.87353754f, 0.762222648f},
-std::array<float,2>{0.516317427f, 0.0517974682f},
-std::array<float,2>{0.340457767f, 0.664717853f},
-std::array<float,2>{0.438225508f, 0.217104852f},
-std::array<float,2>{0.711262047f, 0.577710509f},
-std::array<float,2>{0.973021567f, 0.292995572f},
-std::array<float,2>{0.226487905f, 0.970287681f},
-std::array<float,2>{0.432050705f, 0.308218896f},
-std::array<float,2>{0.673452497f, 0.995652437f},
-std::array<float,2>{0.880894125f, 0.187928796f},
-std::array<float,2>{0.155866116f, 0.590577662f},
-std::array<float,2>{0.0649416372f, 0.0413489565f},
-std::array<float,2>{0.785805643f, 0.684267163f},
-std::array<float,2>{0.602198601f, 0.480225146f},
-std::array<float,2>{0.30423373f, 0.768585443f},
-std::array<float,2>{0.200769141f, 0.425954163f},
-std::array<float,2>{0.954552352f, 0.847999036f},
-std::array<float,2>{0.737636149f, 0.119490728f},
-std::array<float,2>{0.487246484f, 0.70563668f},
-std::array<float,2>{0.364302993f, 0.165897414f},
-std::array<float,2>{0.544346035f, 0.516599417f},
-std::array<float,2>{0.826216877f, 0.339210033f},
-std::array<float,2>{0.041968286f, 0.922068298f},
-std::array<float,2>{0.278509051f, 0.458878696f},
-std::array<float,2>{0.588032961f, 0.805414736f},
-std::array<float,2>{0.75013566f, 0.0306404494f},
-std::array<float,2>{0.11139667f, 0.644115388f},
-std::array<float,2>{0.181054905f, 0.245673388f},
-std::array<float,2>{0.934167206f, 0.596521854f},
-std::array<float,2>{0.628513396f, 0.265218526f},
-std::array<float,2>{0.388275534f, 0.962300479f},
-std::array<float,2>{0.024282461f, 0.348007292f},
-std::array<float,2>{0.867188096f, 0.905200303f},
-std::array<float,2>{0.522426426f, 0.13137807f},
-std::array<float,2>{0.337126791f, 0.550966144f},
-std::array<float,2>{0.442279667f, 0.0837646797f},
-std::array<float,2>{0.715235353f, 0.737395942f},
-std::array<float,2>{0.968817413f, 0.375464529f},
-std::array<float,2>{0.221455812f, 0.843412161f},
-std::array<float,2>{0.468939036f, 0.39984253f},
-std::array<float,2>{0.726960421f, 0.814025462f},
-std::array<float,2>{0.945263028f, 0.0722278655f},
-std::array<float,2>{0.21179837f, 0.723603964f},
-std::array<float,2>{0.0588488765f, 0.144644469f},
-std::array<float,2>{0.83307445f, 0.539208174f},
-std::array<float,2>{0.547056377f, 0.361662656f},
-std::array<float,2>{0.34379676f, 0.878529966f},
-std::array<float,2>{0.127060309f, 0.278157145f},
-std::array<float,2>{0.899652958f, 0.941202104f},
-std::array<float,2>{0.666929066f, 0.223561272f},
-std::array<float,2>{0.410510421f, 0.610762239f},
-std::array<float,2>{0.293593913f, 0.00105971273f},
-std::array<float,2>{0.623802602f, 0.637552619f},
-std::array<float,2>{0.798402607f, 0.439398527f},
-std::array<float,2>{0.0853639618f, 0.794356942f},
-std::array<float,2>{0.3230277f, 0.323343009f},
-std::array<float,2>{0.505608857f, 0.910502732f},
-std::array<float,2>{0.848993123f, 0.183440194f},
-std::array<float,2>{0.0111117363f, 0.511851847f},
-std::array<float,2>{0.247513294f, 0.0949623883f},
-std::array<float,2>{0.992119372f, 0.701113403f},
-std::array<float,2>{0.69252795f, 0.41024828f},
-std::array<float,2>{0.462766856f, 0.871675372f},
-std::array<float,2>{0.100497551f, 0.499458551f},
-std::array<float,2>{0.772126973f, 0.753039718f},
-std::array<float,2>{0.575240016f, 0.0570917428f},
-std::array<float,2>{0.263672233f, 0.660471857f},
-std::array<float,2>{0.399997085f, 0.204442516f},
-std::array<float,2>{0.653910875f, 0.568797231f},
-std::array<float,2>{0.910297632f, 0.282895744f},
-std::array<float,2>{0.160813108f, 0.979489803f},
-std::array<float,2>{0.45898363f, 0.370002598f},
-std::array<float,2>{0.695915759f, 0.886360109f},
-std::array<float,2>{0.993546247f, 0.148952961f},
-std::array<float,2>{0.234420553f, 0.534320712f},
-std::array<float,2>{0.00766903209f, 0.0626882166f},
-std::array<float,2>{0.857432723f, 0.728458583f},
-std::array<float,2>{0.510326624f, 0.391717672f},
-std::array<float,2>{0.315068573f, 0.82305336f},
-std::array<float,2>{0.169052035f, 0.445407867f},
-std::array<float,2>{0.919218302f, 0.782601893f},
-std::array<float,2>{0.64672184f, 0.0116299344f},
-std::array<float,2>{0.392838597f, 0.62772584f},
-std::array<float,2>{0.253019542f, 0.228098914f},
-std::array<float,2>{0.566490412f, 0.623249888f},
-std::array<float,2>{0.773601353f, 0.27060163f},
-std::array<float,2>{0.104031727f, 0.949958563f},
-std::array<float,2>{0.35877043f, 0.417854667f},
-std::array<float,2>{0.558671474f, 0.861780465f},
-std::array<float,2>{0.840313256f, 0.105167933f},
-std::array<float,2>{0.0474654548f, 0.68889302f},
-std::array<float,2>{0.209593862f, 0.177724421f},
-std::array<float,2>{0.949871421f, 0.505601287f},
-std::array<float,2>{0.71906966f, 0.312519133f},
-std::array<float,2>{0.482879966f, 0.918401659f},
-std::array<float,2>{0.0920694172f, 0.29032585f},
-std::array<float,2>{0.809331536f, 0.974055409f},
-std::array<float,2>{0.613555014f, 0.212655723f},
-std::array<float,2>{0.288810939f, 0.572844267f},
-std::array<float,2>{0.41826731f, 0.0475183316f},
-std::array<float,2>{0.657720029f, 0.669357181f},
-std::array<float,2>{0.894389153f, 0.488230258f},
-std::array<float,2>{0.134627417f, 0.758515894f},
-std::array<float,2>{0.377262831f, 0.469459027f},
-std::array<float,2>{0.639016092f, 0.780860305f},
-std::array<float,2>{0.928967118f, 0.0327097438f},
-std::array<float,2>{0.173178867f, 0.678757727f},
-std::array<float,2>{0.123586372f, 0.198166192f},
-std::array<float,2>{0.760884762f, 0.584290624f},
-std::array<float,2>{0.582175434f, 0.299513161f},
-std::array<float,2>{0.269350141f, 0.985716462f},
-std::array<float,2>{0.230692253f, 0.329405606f},
-std::array<float,2>{0.982422471f, 0.932946742f},
-std::array<float,2>{0.708188593f, 0.159981817f},
-std::array<float,2>{0.447401315f, 0.525063455f},
-std::array<float,2>{0.330599397f, 0.11250782f},
-std::array<float,2>{0.528832912f, 0.71688056f},
-std::array<float,2>{0.864826441f, 0.430720121f},
-std::array<float,2>{0.0217022598f, 0.851710379f},
-std::array<float,2>{0.305178523f, 0.251940459f},
-std::array<float,2>{0.600867212f, 0.960561156f},
-std::array<float,2>{0.790696561f, 0.242100582f},
-std::array<float,2>{0.0738590732f, 0.60197103f},
-std::array<float,2>{0.142122254f, 0.0167139266f},
-std::array<float,2>{0.884636581f, 0.649708092f},
-std::array<float,2>{0.681980252f, 0.465484142f},
-std::array<float,2>{0.423077524f, 0.801600575f},
-std::array<float,2>{0.034496244f, 0.386612415f},
-std::array<float,2>{0.813528419f, 0.835703015f},
-std::array<float,2>{0.537914753f, 0.0933573619f},
-std::array<float,2>{0.371837825f, 0.748114228f},
-std::array<float,2>{0.499624074f, 0.138955429f},
-std::array<float,2>{0.747407496f, 0.556947649f},
-std::array<float,2>{0.962978303f, 0.351749003f},
-std::array<float,2>{0.194812432f, 0.891303599f},
-std::array<float,2>{0.394884437f, 0.343464911f},
-std::array<float,2>{0.6416412f, 0.927090943f},
-std::array<float,2>{0.917901397f, 0.169247612f},
-std::array<float,2>{0.167063639f, 0.520915508f},
-std::array<float,2>{0.107385799f, 0.12209218f},
-std::array<float,2>{0.778299391f, 0.708462f},
-std::array<float,2>{0.565858185f, 0.425147414f},
-std::array<float,2>{0.254395247f, 0.847225606f},
-std::array<float,2>{0.240082204f, 0.481196225f},
-std::array<float,2>{0.996359646f, 0.772020876f},
-std::array<float,2>{0.701700985f, 0.0432144925f},
-std::array<float,2>{0.45521453f, 0.683129787f},
-std::array<float,2>{0.317367584f, 0.191670179f},
-std::array<float,2>{0.512495816f, 0.588120162f},
-std::array<float,2>{0.854076445f, 0.309955716f},
-std::array<float,2>{0.00298325508f, 0.997231126f},
-std::array<float,2>{0.28308031f, 0.381542027f},
-std::array<float,2>{0.611792982f, 0.839765906f},
-std::array<float,2>{0.807356119f, 0.0809400454f},
-std::array<float,2>{0.0874646157f, 0.740181088f},
-std::array<float,2>{0.140307158f, 0.125571549f},
-std::array<float,2>{0.895945907f, 0.548960209f},
-std::array<float,2>{0.662289739f, 0.345018923f},
-std::array<float,2>{0.416612178f, 0.901105821f},
-std::array<float,2>{0.0542015918f, 0.260477036f},
-std::array<float,2>{0.837228179f, 0.964992225f},
-std::array<float,2>{0.554699361f, 0.248536304f},
-std::array<float,2>{0.353308171f, 0.600565076f},
-std::array<float,2>{0.476991087f, 0.0237786844f},
-std::array<float,2>{0.724878073f, 0.64808476f},
-std::array<float,2>{0.946798027f, 0.453763247f},
-std::array<float,2>{0.205124691f, 0.81152004f},
-std::array<float,2>{0.451218396f, 0.443218023f},
-std::array<float,2>{0.704888761f, 0.789569557f},
-std::array<float,2>{0.978390336f, 0.0053939377f},
-std::array<float,2>{0.230340466f, 0.636452198f},
-std::array<float,2>{0.0166666489f, 0.219062582f},
-std::array<float,2>{0.861913204f, 0.616359234f},
-std::array<float,2>{0.52640754f, 0.273912162f},
-std::array<float,2>{0.335873604f, 0.944986939f},
-std::array<float,2>{0.178302139f, 0.366857141f},
-std::array<float,2>{0.92497623f, 0.87909019f},
-std::array<float,2>{0.63549906f, 0.144080982f},
-std::array<float,2>{0.381028116f, 0.546288729f},
-std::array<float,2>{0.270248711f, 0.0780573189f},
-std::array<float,2>{0.580839574f, 0.719743013f},
-std::array<float,2>{0.762603581f, 0.403715461f},
-std::array<float,2>{0.119948372f, 0.818259239f},
-std::array<float,2>{0.368444622f, 0.286038429f},
-std::array<float,2>{0.534543395f, 0.983366191f},
-std::array<float,2>{0.816487074f, 0.208337381f},
-std::array<float,2>{0.0352040939f, 0.565732956f},
-std::array<float,2>{0.189103976f, 0.0617828332f},
-std::array<float,2>{0.967591405f, 0.659729004f},
-std::array<float,2>{0.745263875f, 0.494312882f},
-std::array<float,2>{0.496032089f, 0.755273402f},
-std::array<float,2>{0.075226292f, 0.407219321f},
-std::array<float,2>{0.794794977f, 0.867809236f},
-std::array<float,2>{0.59602356f, 0.0979109183f},
-std::array<float,2>{0.312406242f, 0.69552362f},
-std::array<float,2>{0.429180026f, 0.186118484f},
-std::array<float,2>{0.68706727f, 0.50924015f},
-std::array<float,2>{0.888902426f, 0.325549096f},
-std::array<float,2>{0.146568194f, 0.907443762f},
-std::array<float,2>{0.492124289f, 0.269412577f},
-std::array<float,2>{0.740052879f, 0.947417617f},
-std::array<float,2>{0.960164189f, 0.232091054f},
-std::array<float,2>{0.196274564f, 0.620213449f},
-std::array<float,2>{0.0467381887f, 0.0135320127f},
-std::array<float,2>{0.823992014f, 0.630648255f},
-std::array<float,2>{0.541109204f, 0.449365675f},
-std::array<float,2>{0.359735787f, 0.788637161f},
-std::array<float,2>{0.150699258f, 0.396712631f},
-std::array<float,2>{0.875747144f, 0.825591743f},
-std::array<float,2>{0.678215921f, 0.0679707006f},
-std::array<float,2>{0.434727639f, 0.734358788f},
-std::array<float,2>{0.299683124f, 0.156061664f},
-std::array<float,2>{0.606183231f, 0.538958669f},
-std::array<float,2>{0.784806669f, 0.372182876f},
-std::array<float,2>{0.0679190382f, 0.887302756f},
-std::array<float,2>{0.341789693f, 0.488975018f},
-std::array<float,2>{0.516682148f, 0.764034808f},
-std::array<float,2>{0.87460041f, 0.0535568148f},
-std::array<float,2>{0.0288765021f, 0.667332709f},
-std::array<float,2>{0.224619225f, 0.2163672f},
-std::array<float,2>{0.974281907f, 0.575435519f},
-std::array<float,2>{0.712778807f, 0.296121895f},
-std::array<float,2>{0.43919751f, 0.972336173f},
-std::array<float,2>{0.115285061f, 0.318349242f},
-std::array<float,2>{0.755897999f, 0.915911198f},
-std::array<float,2>{0.59329319f, 0.17509903f},
-std::array<float,2>{0.274092436f, 0.503059626f},
-std::array<float,2>{0.385828704f, 0.10760998f},
-std::array<float,2>{0.628987551f, 0.691784739f},
-std::array<float,2>{0.930524886f, 0.4217453f},
-std::array<float,2>{0.183958143f, 0.863758206f},
-std::array<float,2>{0.408105016f, 0.434412956f},
-std::array<float,2>{0.668234885f, 0.856334567f},
-std::array<float,2>{0.903775334f, 0.115181401f},
-std::array<float,2>{0.130885467f, 0.711424351f},
-std::array<float,2>{0.0805352852f, 0.162308529f},
-std::array<float,2>{0.802834809f, 0.528471947f},
-std::array<float,2>{0.619407237f, 0.335204482f},
-std::array<float,2>{0.291000068f, 0.935360372f},
-std::array<float,2>{0.215197995f, 0.303280175f},
-std::array<float,2>{0.939759374f, 0.991007388f},
-std::array<float,2>{0.733010828f, 0.200530633f},
-std::array<float,2>{0.472966611f, 0.578143418f},
-std::array<float,2>{0.349487573f, 0.0352799781f},
-std::array<float,2>{0.554255903f, 0.672257125f},
-std::array<float,2>{0.828424335f, 0.47295177f},
-std::array<float,2>{0.0547987446f, 0.773745477f},
-std::array<float,2>{0.258784324f, 0.358959436f},
-std::array<float,2>{0.571577907f, 0.895345092f},
-std::array<float,2>{0.769028425f, 0.134269774f},
-std::array<float,2>{0.0964436382f, 0.561134815f},
-std::array<float,2>{0.156844065f, 0.089479439f},
-std::array<float,2>{0.907999933f, 0.74306798f},
-std::array<float,2>{0.650927424f, 0.38783747f},
-std::array<float,2>{0.403959125f, 0.82867533f},
-std::array<float,2>{0.013655467f, 0.463625342f},
-std::array<float,2>{0.844403982f, 0.79711622f},
-std::array<float,2>{0.500315726f, 0.0204375964f},
-std::array<float,2>{0.326467365f, 0.654402733f},
-std::array<float,2>{0.468481928f, 0.234598979f},
-std::array<float,2>{0.687724948f, 0.605877042f},
-std::array<float,2>{0.987489879f, 0.254976749f},
-std::array<float,2>{0.245561823f, 0.955703735f},
-std::array<float,2>{0.39038381f, 0.263489008f},
-std::array<float,2>{0.626301348f, 0.963615716f},
-std::array<float,2>{0.937205791f, 0.24306114f},
-std::array<float,2>{0.181999892f, 0.594424665f},
-std::array<float,2>{0.110757083f, 0.0291230548f},
-std::array<float,2>{0.753106534f, 0.641385019f},
-std::array<float,2>{0.587343276f, 0.460294813f},
-std::array<float,2>{0.279445529f, 0.80757153f},
-std::array<float,2>{0.219853252f, 0.377658218f},
-std::array<float,2>{0.97128427f, 0.840153396f},
-std::array<float,2>{0.717607558f, 0.0856135115f},
-std::array<float,2>{0.444049954f, 0.735826612f},
-std::array<float,2>{0.338235915f, 0.129387274f},
-std::array<float,2>{0.519674361f, 0.554129839f},
-std::array<float,2>{0.870583296f, 0.349630237f},
-std::array<float,2>{0.0255592447f, 0.902658582f},
-std::array<float,2>{0.301871598f, 0.478293329f},
-std::array<float,2>{0.604222059f, 0.767401457f},
-std::array<float,2>{0.788472891f, 0.0404901877f},
-std::array<float,2>{0.0640224591f, 0.686565816f},
-std::array<float,2>{0.152959794f, 0.190549776f},
-std::array<float,2>{0.880794108f, 0.592509151f},
-std::array<float,2>{0.674000502f, 0.304769129f},
-std::array<float,2>{0.430303246f, 0.992279768f},
-std::array<float,2>{0.0399528444f, 0.33723852f},
-std::array<float,2>{0.825414181f, 0.925479829f},
-std::array<float,2>{0.546095371f, 0.167937025f},
-std::array<float,2>{0.366261095f, 0.518335283f},
-std::array<float,2>{0.484720528f, 0.117237739f},
-std::array<float,2>{0.735702634f, 0.703916192f},
-std::array<float,2>{0.956211269f, 0.428333879f},
-std::array<float,2>{0.202126339f, 0.851370931f},
-std::array<float,2>{0.463165253f, 0.412206948f},
-std::array<float,2>{0.694414198f, 0.873399913f},
-std::array<float,2>{0.988318622f, 0.0974477604f},
-std::array<float,2>{0.249133319f, 0.702204585f},
-std::array<float,2>{0.00798064005f, 0.181138709f},
-std::array<float,2>{0.850842714f, 0.514251649f},
-std::array<float,2>{0.5076285f, 0.321103066f},
-std::array<float,2>{0.320554584f, 0.913763523f},
-std::array<float,2>{0.162595883f, 0.283434361f},
-std::array<float,2>{0.912617385f, 0.977495492f},
-std::array<float,2>{0.654772699f, 0.205929205f},
-std::array<float,2>{0.401431203f, 0.567942858f},
-std::array<float,2>{0.262003601f, 0.0554736964f},
-std::array<float,2>{0.576682627f, 0.663367152f},
-std::array<float,2>{0.770277679f, 0.496906221f},
-std::array<float,2>{0.0977177918f, 0.75027138f},
-std::array<float,2>{0.346720874f, 0.360953599f},
-std::array<float,2>{0.548863053f, 0.876498044f},
-std::array<float,2>{0.834429741f, 0.147725344f},
-std::array<float,2>{0.0608924516f, 0.541805208f},
-std::array<float,2>{0.214106202f, 0.0737564415f},
-std::array<float,2>{0.941869974f, 0.724811196f},
-std::array<float,2>{0.729511261f, 0.40226683f},
-std::array<float,2>{0.471097261f, 0.816129863f},
-std::array<float,2>{0.0824267864f, 0.440748692f},
-std::array<float,2>{0.800419152f, 0.796317756f},
-std::array<float,2>{0.622289777f, 0.00344839878f},
-std::array<float,2>{0.296462715f, 0.639999032f},
-std::array<float,2>{0.413658082f, 0.225589976f},
-std::array<float,2>{0.665924489f, 0.613028049f},
-std::array<float,2>{0.902053595f, 0.279529244f},
-std::array<float,2>{0.125264242f, 0.938875914f},
-std::array<float,2>{0.480980277f, 0.31530416f},
-std::array<float,2>{0.721467674f, 0.921762228f},
-std::array<float,2>{0.951813161f, 0.178274944f},
-std::array<float,2>{0.207420185f, 0.506056845f},
-std::array<float,2>{0.0492610075f, 0.101776414f},
-std::array<float,2>{0.842379093f, 0.690809131f},
-std::array<float,2>{0.562359571f, 0.415525258f},
-std::array<float,2>{0.357284427f, 0.861122131f},
-std::array<float,2>{0.135087326f, 0.485855967f},
-std::array<float,2>{0.890868485f, 0.760297537f},
-std::array<float,2>{0.660041153f, 0.0491456464f},
-std::array<float,2>{0.420722753f, 0.669998765f},
-std::array<float,2>{0.286194354f, 0.214789912f},
-std::array<float,2>{0.616407216f, 0.572124362f},
-std::array<float,2>{0.811111629f, 0.291612566f},
-std::array<float,2>{0.0904304311f, 0.975087762f},
-std::array<float,2>{0.312749684f, 0.39384684f},
-std::array<float,2>{0.508890986f, 0.821222782f},
-std::array<float,2>{0.856197894f, 0.0659071878f},
-std::array<float,2>{0.00542748393f, 0.729464531f},
-std::array<float,2>{0.238206759f, 0.150820524f},
-std::array<float,2>{0.994879365f, 0.532218039f},
-std::array<float,2>{0.698931932f, 0.36739707f},
-std::array<float,2>{0.460793018f, 0.883814991f},
-std::array<float,2>{0.101562716f, 0.272146344f},
-std::array<float,2>{0.776440203f, 0.95154351f},
-std::array<float,2>{0.569133222f, 0.230271176f},
-std::array<float,2>{0.250793248f, 0.622877359f},
-std::array<float,2>{0.392401457f, 0.0080343727f},
-std::array<float,2>{0.645586312f, 0.625529468f},
-std::array<float,2>{0.921634555f, 0.447535634f},
-std::array<float,2>{0.169977471f, 0.784112751f},
-std::array<float,2>{0.425185859f, 0.467496544f},
-std::array<float,2>{0.680598021f, 0.804242849f},
-std::array<float,2>{0.885228813f, 0.0183133259f},
-std::array<float,2>{0.143502042f, 0.650993049f},
-std::array<float,2>{0.0718785301f, 0.238539308f},
-std::array<float,2>{0.792165816f, 0.603862464f},
-std::array<float,2>{0.597671986f, 0.252999127f},
-std::array<float,2>{0.308542013f, 0.957875013f},
-std::array<float,2>{0.191971049f, 0.354189366f},
-std::array<float,2>{0.961590886f, 0.894505441f},
-std::array<float,2>{0.749429762f, 0.138563424f},
-std::array<float,2>{0.496885836f, 0.555908799f},
-std::array<float,2>{0.374904364f, 0.0903026313f},
-std::array<float,2>{0.53583324f, 0.747879863f},
-std::array<float,2>{0.814819694f, 0.383328766f},
-std::array<float,2>{0.0315320157f, 0.833394051f},
-std::array<float,2>{0.266315758f, 0.298326403f},
-std::array<float,2>{0.585312903f, 0.986733735f},
-std::array<float,2>{0.759144962f, 0.196572214f},
-std::array<float,2>{0.122045495f, 0.582480609f},
-std::array<float,2>{0.174181417f, 0.0344298892f},
-std::array<float,2>{0.927038372f, 0.676944733f},
-std::array<float,2>{0.637211621f, 0.47207126f},
-std::array<float,2>{0.375807583f, 0.778544843f},
-std::array<float,2>{0.0212799553f, 0.43302092f},
-std::array<float,2>{0.86640048f, 0.85520494f},
-std::array<float,2>{0.530849099f, 0.109737858f},
-std::array<float,2>{0.328834325f, 0.715371072f},
-std::array<float,2>{0.445598572f, 0.157295793f},
-std::array<float,2>{0.710424542f, 0.526121855f},
-std::array<float,2>{0.981248915f, 0.331694961f},
-std::array<float,2>{0.233776852f, 0.929706872f},
-std::array<float,2>{0.414633334f, 0.346395671f},
-std::array<float,2>{0.661298037f, 0.900276423f},
-std::array<float,2>{0.896497607f, 0.128475815f},
-std::array<float,2>{0.138528377f, 0.548604012f},
-std::array<float,2>{0.0881566778f, 0.0797524154f},
-std::array<float,2>{0.805211961f, 0.740290582f},
-std::array<float,2>{0.609728217f, 0.379016519f},
-std::array<float,2>{0.28338173f, 0.836431324f},
-std::array<float,2>{0.203556299f, 0.455633134f},
-std::array<float,2>{0.948227525f, 0.810372651f},
-std::array<float,2>{0.723025799f, 0.0270444937f},
-std::array<float,2>{0.479823083f, 0.646326125f},
-std::array<float,2>{0.354858965f, 0.247457162f},
-std::array<float,2>{0.558496058f, 0.59909451f},
-std::array<float,2>{0.839268148f, 0.25926891f},
-std::array<float,2>{0.0518396161f, 0.968017936f},
-std::array<float,2>{0.25728032f, 0.423455924f},
-std::array<float,2>{0.564202309f, 0.845450342f},
-std::array<float,2>{0.780797541f, 0.124226905f},
-std::array<float,2>{0.108920239f, 0.710387349f},
-std::array<float,2>{0.165244222f, 0.170265734f},
-std::array<float,2>{0.914891362f, 0.523403227f},
-std::array<float,2>{0.64312923f, 0.340666175f},
-std::array<float,2>{0.397787362f, 0.929305196f},
-std::array<float,2>{0.000915901386f, 0.311110318f},
-std::array<float,2>{0.85330683f, 0.998831987f},
-std::array<float,2>{0.515212297f, 0.194790751f},
-std::array<float,2>{0.31931603f, 0.587026f},
-std::array<float,2>{0.453705102f, 0.0457227789f},
-std::array<float,2>{0.700829387f, 0.680540502f},
-std::array<float,2>{0.999392033f, 0.483481854f},
-std::array<float,2>{0.241735935f, 0.770051956f},
-std::array<float,2>{0.492283851f, 0.493478358f},
-std::array<float,2>{0.742345273f, 0.75720191f},
-std::array<float,2>{0.965842128f, 0.0603493676f},
-std::array<float,2>{0.190086603f, 0.657968581f},
-std::array<float,2>{0.0388908759f, 0.210829616f},
-std::array<float,2>{0.818526506f, 0.564270854f},
-std::array<float,2>{0.531594694f, 0.288190573f},
-std::array<float,2>{0.369223803f, 0.981369555f},
-std::array<float,2>{0.146208823f, 0.32697612f},
-std::array<float,2>{0.887052894f, 0.909943521f},
-std::array<float,2>{0.684543848f, 0.184970036f},
-std::array<float,2>{0.427387297f, 0.51008451f},
-std::array<float,2>{0.308606237f, 0.100325599f},
-std::array<float,2>{0.594429493f, 0.698515058f},
-std::array<float,2>{0.795076489f, 0.410049349f},
-std::array<float,2>{0.0764209703f, 0.869568765f},
-std::array<float,2>{0.332460821f, 0.276620597f},
-std::array<float,2>{0.524543822f, 0.943024933f},
-std::array<float,2>{0.859653115f, 0.222584575f},
-std::array<float,2>{0.0177374575f, 0.61481601f},
-std::array<float,2>{0.22711274f, 0.00642805919f},
-std::array<float,2>{0.980109692f, 0.63303113f},
-std::array<float,2>{0.705348253f, 0.444466829f},
-std::array<float,2>{0.450383842f, 0.791925311f},
-std::array<float,2>{0.11817278f, 0.404970109f},
-std::array<float,2>{0.764293909f, 0.819294572f},
-std::array<float,2>{0.57932049f, 0.0747271702f},
-std::array<float,2>{0.273433834f, 0.721208692f},
-std::array<float,2>{0.380420059f, 0.142126888f},
-std::array<float,2>{0.634432137f, 0.544073224f},
-std::array<float,2>{0.922923267f, 0.365081608f},
-std::array<float,2>{0.177227035f, 0.881913543f},
-std::array<float,2>{0.440819085f, 0.294919908f},
-std::array<float,2>{0.71292156f, 0.968870997f},
-std::array<float,2>{0.974685311f, 0.218560517f},
-std::array<float,2>{0.223579988f, 0.576664209f},
-std::array<float,2>{0.0299220216f, 0.0510063209f},
-std::array<float,2>{0.87220639f, 0.665928066f},
-std::array<float,2>{0.519076824f, 0.491828024f},
-std::array<float,2>{0.34280175f, 0.76322186f},
-std::array<float,2>{0.18647483f, 0.418410122f},
-std::array<float,2>{0.933413267f, 0.8671422f},
-std::array<float,2>{0.631706774f, 0.106797136f},
-std::array<float,2>{0.383931607f, 0.693406582f},
-std::array<float,2>{0.277166247f, 0.173223421f},
-std::array<float,2>{0.590982199f, 0.500604987f},
-std::array<float,2>{0.7546193f, 0.319817364f},
-std::array<float,2>{0.114226937f, 0.91666007f},
-std::array<float,2>{0.362103403f, 0.452434152f},
-std::array<float,2>{0.540786982f, 0.785456598f},
-std::array<float,2>{0.822175741f, 0.0142810978f},
-std::array<float,2>{0.0445904844f, 0.632449746f},
-std::array<float,2>{0.197983846f, 0.233445585f},
-std::array<float,2>{0.958060801f, 0.617923796f},
-std::array<float,2>{0.741173863f, 0.266758949f},
-std::array<float,2>{0.488522023f, 0.946490824f},
-std::array<float,2>{0.0702672377f, 0.373823375f},
-std::array<float,2>{0.782104075f, 0.888691247f},
-std::array<float,2>{0.607497871f, 0.153297856f},
-std::array<float,2>{0.297373921f, 0.535625994f},
-std::array<float,2>{0.437163532f, 0.0698830187f},
-std::array<float,2>{0.676681876f, 0.73102206f},
-std::array<float,2>{0.878027618f, 0.395769179f},
-std::array<float,2>{0.148943484f, 0.827854574f},
-std::array<float,2>{0.405317098f, 0.388734281f},
-std::array<float,2>{0.649165928f, 0.831760168f},
-std::array<float,2>{0.909722745f, 0.0860418826f},
-std::array<float,2>{0.159735009f, 0.744221985f},
-std::array<float,2>{0.0949869379f, 0.13528268f},
-std::array<float,2>{0.767040968f, 0.558964193f},
-std::array<float,2>{0.573953807f, 0.356985629f},
-std::array<float,2>{0.261000186f, 0.897038162f},
-std::array<float,2>{0.243155509f, 0.256896973f},
-std::array<float,2>{0.985683084f, 0.954044223f},
-std::array<float,2>{0.690847635f, 0.237524495f},
-std::array<float,2>{0.466758251f, 0.607814968f},
-std::array<float,2>{0.325451046f, 0.021782076f},
-std::array<float,2>{0.502036989f, 0.653618872f},
-std::array<float,2>{0.846852064f, 0.461767942f},
-std::array<float,2>{0.0152041363f, 0.800240338f},
-std::array<float,2>{0.291355878f, 0.333648801f},
-std::array<float,2>{0.618919015f, 0.936458528f},
-std::array<float,2>{0.802339911f, 0.16169697f},
-std::array<float,2>{0.0793897584f, 0.530233741f},
-std::array<float,2>{0.129620552f, 0.115817696f},
-std::array<float,2>{0.904562473f, 0.713971615f},
-std::array<float,2>{0.671177268f, 0.435703933f},
-std::array<float,2>{0.410025299f, 0.859291494f},
-std::array<float,2>{0.0577766821f, 0.474869102f},
-std::array<float,2>{0.830235422f, 0.776779115f},
-std::array<float,2>{0.551136494f, 0.0388780385f},
-std::array<float,2>{0.350796074f, 0.674284279f},
-std::array<float,2>{0.47595337f, 0.202598691f},
-std::array<float,2>{0.731515765f, 0.580102682f},
-std::array<float,2>{0.938974857f, 0.30217123f},
-std::array<float,2>{0.218609795f, 0.989952087f},
-std::array<float,2>{0.396615416f, 0.309573352f},
-std::array<float,2>{0.644382298f, 0.99737221f},
-std::array<float,2>{0.915609956f, 0.191624478f},
-std::array<float,2>{0.164927468f, 0.588163376f},
-std::array<float,2>{0.107854359f, 0.0430870056f},
-std::array<float,2>{0.77988714f, 0.683418214f},
-std::array<float,2>{0.563312232f, 0.481303722f},
-std::array<float,2>{0.256615222f, 0.772393823f},
-std::array<float,2>{0.241077289f, 0.42487976f},
-std::array<float,2>{0.998208702f, 0.847520053f},
-std::array<float,2>{0.699903786f, 0.122473866f},
-std::array<float,2>{0.454468697f, 0.708112061f},
-std::array<float,2>{0.319615573f, 0.1691017f},
-std::array<float,2>{0.514266253f, 0.520561814f},
-std::array<float,2>{0.852080345f, 0.343529731f},
-std::array<float,2>{0.00138839043f, 0.926955521f},
-std::array<float,2>{0.28433305f, 0.453901529f},
-std::array<float,2>{0.611053765f, 0.811060429f},
-std::array<float,2>{0.806344748f, 0.0234860647f},
-std::array<float,2>{0.0890174434f, 0.648313105f},
-std::array<float,2>{0.137100697f, 0.248902023f},
-std::array<float,2>{0.898246527f, 0.600281f},
-std::array<float,2>{0.66084373f, 0.260679841f},
-std::array<float,2>{0.415147543f, 0.965298176f},
-std::array<float,2>{0.0510677919f, 0.344751835f},
-std::array<float,2>{0.838270724f, 0.901347756f},
-std::array<float,2>{0.556656957f, 0.12583223f},
-std::array<float,2>{0.354059637f, 0.549178898f},
-std::array<float,2>{0.4791179f, 0.0806440562f},
-std::array<float,2>{0.723986685f, 0.739786327f},
-std::array<float,2>{0.949189961f, 0.381734461f},
-std::array<float,2>{0.204596743f, 0.839479446f},
-std::array<float,2>{0.449314594f, 0.403563589f},
-std::array<float,2>{0.706251025f, 0.81802249f},
-std::array<float,2>{0.979257762f, 0.0778649002f},
-std::array<float,2>{0.228179902f, 0.719971359f},
-std::array<float,2>{0.0189469699f, 0.144476414f},
-std::array<float,2>{0.860879004f, 0.545920074f},
-std::array<float,2>{0.524191141f, 0.367070585f},
-std::array<float,2>{0.333713591f, 0.879216194f},
-std::array<float,2>{0.176420361f, 0.273680925f},
-std::array<float,2>{0.922485888f, 0.945304811f},
-std::array<float,2>{0.632955015f, 0.218867406f},
-std::array<float,2>{0.379536867f, 0.61654979f},
-std::array<float,2>{0.271721631f, 0.00582948839f},
-std::array<float,2>{0.57872349f, 0.636681974f},
-std::array<float,2>{0.76497674f, 0.443067878f},
-std::array<float,2>{0.118072905f, 0.789905787f},
-std::array<float,2>{0.370857328f, 0.325429946f},
-std::array<float,2>{0.532309115f, 0.90765053f},
-std::array<float,2>{0.819740534f, 0.186367348f},
-std::array<float,2>{0.0379981212f, 0.508911133f},
-std::array<float,2>{0.191069797f, 0.0977522954f},
-std::array<float,2>{0.965390742f, 0.695561886f},
-std::array<float,2>{0.743940771f, 0.40679267f},
-std::array<float,2>{0.49355039f, 0.86801976f},
-std::array<float,2>{0.0776191726f, 0.494510859f},
-std::array<float,2>{0.796761215f, 0.75495857f},
-std::array<float,2>{0.594872952f, 0.0615333989f},
-std::array<float,2>{0.31053108f, 0.659927905f},
-std::array<float,2>{0.426720768f, 0.208219066f},
-std::array<float,2>{0.685536563f, 0.565555871f},
-std::array<float,2>{0.88852483f, 0.285762727f},
-std::array<float,2>{0.145288229f, 0.983119428f},
-std::array<float,2>{0.489960194f, 0.37249586f},
-std::array<float,2>{0.741787136f, 0.887518704f},
-std::array<float,2>{0.957717657f, 0.155950576f},
-std::array<float,2>{0.198856562f, 0.53870672f},
-std::array<float,2>{0.0432731211f, 0.0682302639f},
-std::array<float,2>{0.820601523f, 0.734124243f},
-std::array<float,2>{0.539388716f, 0.396905065f},
-std::array<float,2>{0.362728238f, 0.82524848f},
-std::array<float,2>{0.149852842f, 0.449497133f},
-std::array<float,2>{0.877561927f, 0.788896024f},
-std::array<float,2>{0.676868021f, 0.0132423695f},
-std::array<float,2>{0.436203837f, 0.630483627f},
-std::array<float,2>{0.298289537f, 0.232310593f},
-std::array<float,2>{0.609046876f, 0.62047869f},
-std::array<float,2>{0.782451928f, 0.269106805f},
-std::array<float,2>{0.0687061325f, 0.947554529f},
-std::array<float,2>{0.34193936f, 0.421535015f},
-std::array<float,2>{0.518388093f, 0.863435864f},
-std::array<float,2>{0.871989608f, 0.107774951f},
-std::array<float,2>{0.0308403783f, 0.691630661f},
-std::array<float,2>{0.224500328f, 0.174812451f},
-std::array<float,2>{0.975939453f, 0.503223777f},
-std::array<float,2>{0.714318991f, 0.318059921f},
-std::array<float,2>{0.439827919f, 0.915702462f},
-std::array<float,2>{0.114689045f, 0.296164334f},
-std::array<float,2>{0.755651593f, 0.972523928f},
-std::array<float,2>{0.590429306f, 0.216712266f},
-std::array<float,2>{0.275654376f, 0.575563431f},
-std::array<float,2>{0.383288324f, 0.0534064583f},
-std::array<float,2>{0.631873012f, 0.667049587f},
-std::array<float,2>{0.932318509f, 0.489043474f},
-std::array<float,2>{0.186611503f, 0.763673663f},
-std::array<float,2>{0.408591479f, 0.472824514f},
-std::array<float,2>{0.67088604f, 0.773552597f},
-std::array<float,2>{0.905803859f, 0.0354875065f},
-std::array<float,2>{0.130329743f, 0.672090769f},
-std::array<float,2>{0.0782377869f, 0.200388983f},
-std::array<float,2>{0.800924003f, 0.578462541f},
-std::array<float,2>{0.618080854f, 0.303570062f},
-std::array<float,2>{0.292291939f, 0.990760326f},
-std::array<float,2>{0.21708101f, 0.335396677f},
-std::array<float,2>{0.937590837f, 0.935290515f},
-std::array<float,2>{0.73100841f, 0.162528813f},
-std::array<float,2>{0.475378036f, 0.52875191f},
-std::array<float,2>{0.349675298f, 0.114861526f},
-std::array<float,2>{0.551767111f, 0.711018801f},
-std::array<float,2>{0.831643701f, 0.434322059f},
-std::array<float,2>{0.0566537715f, 0.856063008f},
-std::array<float,2>{0.26029247f, 0.255298883f},
-std::array<float,2>{0.573061466f, 0.955847502f},
-std::array<float,2>{0.765886426f, 0.234649211f},
-std::array<float,2>{0.0940766856f, 0.605619609f},
-std::array<float,2>{0.158536047f, 0.020179376f},
-std::array<float,2>{0.909069419f, 0.65472424f},
-std::array<float,2>{0.649668574f, 0.463604182f},
-std::array<float,2>{0.404562861f, 0.797185004f},
-std::array<float,2>{0.0136827473f, 0.388127208f},
-std::array<float,2>{0.846117258f, 0.829029441f},
-std::array<float,2>{0.503015101f, 0.0897510499f},
-std::array<float,2>{0.324852496f, 0.742832839f},
-std::array<float,2>{0.465196222f, 0.133951262f},
-std::array<float,2>{0.689994693f, 0.561368525f},
-std::array<float,2>{0.984625399f, 0.359206557f},
-std::array<float,2>{0.244130999f, 0.89522177f},
-std::array<float,2>{0.431164473f, 0.338999361f},
-std::array<float,2>{0.674804986f, 0.92224431f},
-std::array<float,2>{0.879547596f, 0.165579945f},
-std::array<float,2>{0.15405266f, 0.5162763f},
-std::array<float,2>{0.06316787f, 0.119347766f},
-std::array<float,2>{0.787157178f, 0.7060076f},
-std::array<float,2>{0.605244458f, 0.42611137f},
-std::array<float,2>{0.301188052f, 0.847658992f},
-std::array<float,2>{0.202539563f, 0.480148673f},
-std::array<float,2>{0.955382049f, 0.769029498f},
-std::array<float,2>{0.734770656f, 0.0410601161f},
-std::array<float,2>{0.485858142f, 0.684470773f},
-std::array<float,2>{0.36613825f, 0.187575281f},
-std::array<float,2>{0.545350194f, 0.590396881f},
-std::array<float,2>{0.824549377f, 0.308407038f},
-std::array<float,2>{0.0406566299f, 0.995889306f},
-std::array<float,2>{0.281141758f, 0.375191182f},
-std::array<float,2>{0.586377919f, 0.843726754f},
-std::array<float,2>{0.752592802f, 0.0835448578f},
-std::array<float,2>{0.109617777f, 0.737791479f},
-std::array<float,2>{0.18274942f, 0.131609827f},
-std::array<float,2>{0.936220467f, 0.55102545f},
-std::array<float,2>{0.625215292f, 0.34772858f},
-std::array<float,2>{0.388968349f, 0.904985487f},
-std::array<float,2>{0.0270262808f, 0.265470356f},
-std::array<float,2>{0.86973685f, 0.962081373f},
-std::array<float,2>{0.520774782f, 0.245867446f},
-std::array<float,2>{0.339795113f, 0.596392751f},
-std::array<float,2>{0.444791883f, 0.0303202122f},
-std::array<float,2>{0.71813339f, 0.644503176f},
-std::array<float,2>{0.972023427f, 0.458598495f},
-std::array<float,2>{0.218962714f, 0.805574f},
-std::array<float,2>{0.472591996f, 0.439133137f},
-std::array<float,2>{0.729163945f, 0.793996453f},
-std::array<float,2>{0.943142712f, 0.0012505129f},
-std::array<float,2>{0.213138238f, 0.637288153f},
-std::array<float,2>{0.0620058328f, 0.223147675f},
-std::array<float,2>{0.835501969f, 0.610470533f},
-std::array<float,2>{0.54981941f, 0.278011143f},
-std::array<float,2>{0.346008331f, 0.941090941f},
-std::array<float,2>{0.126174182f, 0.361497045f},
-std::array<float,2>{0.90122062f, 0.878832638f},
-std::array<float,2>{0.664287508f, 0.14498435f},
-std::array<float,2>{0.412556469f, 0.539533794f},
-std::array<float,2>{0.295726269f, 0.0719300881f},
-std::array<float,2>{0.621738315f, 0.723368704f},
-std::array<float,2>{0.799776793f, 0.399454564f},
-std::array<float,2>{0.0834911019f, 0.814298272f},
-std::array<float,2>{0.321295768f, 0.283106089f},
-std::array<float,2>{0.505999565f, 0.979088008f},
-std::array<float,2>{0.849727273f, 0.204173401f},
-std::array<float,2>{0.00896310154f, 0.568406999f},
-std::array<float,2>{0.248208493f, 0.0568394214f},
-std::array<float,2>{0.98995024f, 0.660353363f},
-std::array<float,2>{0.694277048f, 0.499265939f},
-std::array<float,2>{0.464315593f, 0.753386378f},
-std::array<float,2>{0.0996017903f, 0.410493672f},
-std::array<float,2>{0.77072525f, 0.871954143f},
-std::array<float,2>{0.577606738f, 0.095078893f},
-std::array<float,2>{0.26271832f, 0.700883329f},
-std::array<float,2>{0.401269495f, 0.183204383f},
-std::array<float,2>{0.655294478f, 0.51211977f},
-std::array<float,2>{0.91332984f, 0.323505819f},
-std::array<float,2>{0.163687855f, 0.910321414f},
-std::array<float,2>{0.459748387f, 0.27075851f},
-std::array<float,2>{0.697550297f, 0.949771404f},
-std::array<float,2>{0.995480359f, 0.228446946f},
-std::array<float,2>{0.236731753f, 0.623339355f},
-std::array<float,2>{0.00479932688f, 0.011417402f},
-std::array<float,2>{0.857198894f, 0.627443314f},
-std::array<float,2>{0.508534491f, 0.445630431f},
-std::array<float,2>{0.313966632f, 0.782252371f},
-std::array<float,2>{0.170990348f, 0.392052323f},
-std::array<float,2>{0.920473695f, 0.822932243f},
-std::array<float,2>{0.645191371f, 0.0628695264f},
-std::array<float,2>{0.390706718f, 0.728186905f},
-std::array<float,2>{0.251348227f, 0.149173081f},
-std::array<float,2>{0.569491684f, 0.534642458f},
-std::array<float,2>{0.776011288f, 0.369723558f},
-std::array<float,2>{0.102994502f, 0.886659205f},
-std::array<float,2>{0.356072873f, 0.487924129f},
-std::array<float,2>{0.561386108f, 0.758691013f},
-std::array<float,2>{0.843553424f, 0.047786288f},
-std::array<float,2>{0.0504969545f, 0.669171035f},
-std::array<float,2>{0.20855768f, 0.212583512f},
-std::array<float,2>{0.952894211f, 0.573233902f},
-std::array<float,2>{0.721862614f, 0.290085047f},
-std::array<float,2>{0.481561422f, 0.973842442f},
-std::array<float,2>{0.0914827436f, 0.312794566f},
-std::array<float,2>{0.811809957f, 0.918034494f},
-std::array<float,2>{0.615782559f, 0.177255064f},
-std::array<float,2>{0.285439432f, 0.505620122f},
-std::array<float,2>{0.420908242f, 0.105460465f},
-std::array<float,2>{0.658735693f, 0.688658118f},
-std::array<float,2>{0.89169544f, 0.41759038f},
-std::array<float,2>{0.136188552f, 0.861546814f},
-std::array<float,2>{0.37650308f, 0.430954278f},
-std::array<float,2>{0.637917042f, 0.852011025f},
-std::array<float,2>{0.9267506f, 0.112553254f},
-std::array<float,2>{0.175114453f, 0.717072845f},
-std::array<float,2>{0.122200966f, 0.159887657f},
-std::array<float,2>{0.757878184f, 0.525240242f},
-std::array<float,2>{0.584093451f, 0.329164237f},
-std::array<float,2>{0.267000526f, 0.932668865f},
-std::array<float,2>{0.233153492f, 0.299722463f},
-std::array<float,2>{0.981866539f, 0.985383809f},
-std::array<float,2>{0.70940125f, 0.197859496f},
-std::array<float,2>{0.446782231f, 0.584136248f},
-std::array<float,2>{0.329279602f, 0.032432247f},
-std::array<float,2>{0.530127108f, 0.678985238f},
-std::array<float,2>{0.865282774f, 0.46955654f},
-std::array<float,2>{0.0204063822f, 0.781102061f},
-std::array<float,2>{0.307433724f, 0.351983279f},
-std::array<float,2>{0.599218249f, 0.89155817f},
-std::array<float,2>{0.791943491f, 0.138794795f},
-std::array<float,2>{0.0710973293f, 0.556763291f},
-std::array<float,2>{0.143655196f, 0.0935927704f},
-std::array<float,2>{0.886506081f, 0.748444021f},
-std::array<float,2>{0.681401253f, 0.386336714f},
-std::array<float,2>{0.423837185f, 0.8355937f},
-std::array<float,2>{0.0323952325f, 0.465598553f},
-std::array<float,2>{0.815429986f, 0.801370382f},
-std::array<float,2>{0.536302567f, 0.0169936586f},
-std::array<float,2>{0.373898238f, 0.64953208f},
-std::array<float,2>{0.497262061f, 0.241862595f},
-std::array<float,2>{0.748113453f, 0.601699412f},
-std::array<float,2>{0.962870896f, 0.251666993f},
-std::array<float,2>{0.192929909f, 0.960720837f},
-std::array<float,2>{0.417864829f, 0.258911222f},
-std::array<float,2>{0.663158476f, 0.967872679f},
-std::array<float,2>{0.894958615f, 0.247070819f},
-std::array<float,2>{0.139295489f, 0.598821461f},
-std::array<float,2>{0.0863553211f, 0.0271548554f},
-std::array<float,2>{0.807929754f, 0.646061838f},
-std::array<float,2>{0.61309588f, 0.45588246f},
-std::array<float,2>{0.281447113f, 0.810158432f},
-std::array<float,2>{0.20663099f, 0.379201174f},
-std::array<float,2>{0.946117043f, 0.836841643f},
-std::array<float,2>{0.726465166f, 0.0798862949f},
-std::array<float,2>{0.477810025f, 0.740492642f},
-std::array<float,2>{0.352261782f, 0.128696918f},
-std::array<float,2>{0.55645436f, 0.548436284f},
-std::array<float,2>{0.836024463f, 0.346465737f},
-std::array<float,2>{0.05275039f, 0.900120199f},
-std::array<float,2>{0.255823731f, 0.4837026f},
-std::array<float,2>{0.564778268f, 0.77027446f},
-std::array<float,2>{0.778881073f, 0.0455575138f},
-std::array<float,2>{0.105616979f, 0.680239797f},
-std::array<float,2>{0.166834027f, 0.194420844f},
-std::array<float,2>{0.916129231f, 0.587180436f},
-std::array<float,2>{0.641209722f, 0.311428964f},
-std::array<float,2>{0.396381795f, 0.99873203f},
-std::array<float,2>{0.00202617934f, 0.340487391f},
-std::array<float,2>{0.854819655f, 0.92945683f},
-std::array<float,2>{0.513003349f, 0.170049697f},
-std::array<float,2>{0.318352431f, 0.523124993f},
-std::array<float,2>{0.45700258f, 0.124481201f},
-std::array<float,2>{0.702871859f, 0.710074246f},
-std::array<float,2>{0.997429013f, 0.423681378f},
-std::array<float,2>{0.238386303f, 0.845534205f},
-std::array<float,2>{0.495084345f, 0.40975377f},
-std::array<float,2>{0.74506551f, 0.869250238f},
-std::array<float,2>{0.967824161f, 0.100378297f},
-std::array<float,2>{0.187842533f, 0.698252559f},
-std::array<float,2>{0.0367091335f, 0.184623495f},
-std::array<float,2>{0.818222523f, 0.509823382f},
-std::array<float,2>{0.533608198f, 0.326764941f},
-std::array<float,2>{0.367475539f, 0.909794211f},
-std::array<float,2>{0.147624329f, 0.288500875f},
-std::array<float,2>{0.890400052f, 0.981040776f},
-std::array<float,2>{0.685939729f, 0.210511446f},
-std::array<float,2>{0.428682834f, 0.563975871f},
-std::array<float,2>{0.311112523f, 0.0601131022f},
-std::array<float,2>{0.596746266f, 0.657729924f},
-std::array<float,2>{0.793049693f, 0.493260533f},
-std::array<float,2>{0.0751191676f, 0.757028103f},
-std::array<float,2>{0.334038675f, 0.364764005f},
-std::array<float,2>{0.526291788f, 0.882281005f},
-std::array<float,2>{0.86302644f, 0.142514214f},
-std::array<float,2>{0.0164715368f, 0.544303656f},
-std::array<float,2>{0.228762969f, 0.075061135f},
-std::array<float,2>{0.976923287f, 0.721447647f},
-std::array<float,2>{0.703395545f, 0.405121952f},
-std::array<float,2>{0.452911407f, 0.818876982f},
-std::array<float,2>{0.120658994f, 0.444635719f},
-std::array<float,2>{0.762713194f, 0.791647077f},
-std::array<float,2>{0.581817865f, 0.00667508226f},
-std::array<float,2>{0.270701051f, 0.633221507f},
-std::array<float,2>{0.382080317f, 0.222388133f},
-std::array<float,2>{0.636683583f, 0.615063965f},
-std::array<float,2>{0.924261153f, 0.276453078f},
-std::array<float,2>{0.179469302f, 0.943257153f},
-std::array<float,2>{0.437915802f, 0.319383234f},
-std::array<float,2>{0.711640596f, 0.916837037f},
-std::array<float,2>{0.973423064f, 0.172979027f},
-std::array<float,2>{0.225775883f, 0.500881493f},
-std::array<float,2>{0.0279301442f, 0.106659465f},
-std::array<float,2>{0.873192012f, 0.69384408f},
-std::array<float,2>{0.515707195f, 0.418208539f},
-std::array<float,2>{0.340147913f, 0.866783977f},
-std::array<float,2>{0.185449794f, 0.492160648f},
-std::array<float,2>{0.930913508f, 0.763588846f},
-std::array<float,2>{0.630441785f, 0.051039245f},
-std::array<float,2>{0.385586828f, 0.665668964f},
-std::array<float,2>{0.275073498f, 0.21848689f},
-std::array<float,2>{0.591889203f, 0.576979041f},
-std::array<float,2>{0.757273555f, 0.294652879f},
-std::array<float,2>{0.11686974f, 0.969086051f},
-std::array<float,2>{0.360615462f, 0.395681351f},
-std::array<float,2>{0.542047262f, 0.827975988f},
-std::array<float,2>{0.823125839f, 0.0702161863f},
-std::array<float,2>{0.0454049408f, 0.731399417f},
-std::array<float,2>{0.197065994f, 0.152999848f},
-std::array<float,2>{0.959156871f, 0.535293519f},
-std::array<float,2>{0.738971174f, 0.373639345f},
-std::array<float,2>{0.490755826f, 0.888954341f},
-std::array<float,2>{0.066651158f, 0.266866803f},
-std::array<float,2>{0.783443987f, 0.946764052f},
-std::array<float,2>{0.607083917f, 0.233777449f},
-std::array<float,2>{0.29998368f, 0.617880762f},
-std::array<float,2>{0.434373081f, 0.0145101817f},
-std::array<float,2>{0.679093719f, 0.632720768f},
-std::array<float,2>{0.876600802f, 0.452255279f},
-std::array<float,2>{0.151483923f, 0.785384953f},
-std::array<float,2>{0.403144151f, 0.461538076f},
-std::array<float,2>{0.651756644f, 0.799955428f},
-std::array<float,2>{0.906275868f, 0.0216134861f},
-std::array<float,2>{0.158020079f, 0.65334779f},
-std::array<float,2>{0.0974986628f, 0.237689987f},
-std::array<float,2>{0.768176019f, 0.607502043f},
-std::array<float,2>{0.570522189f, 0.257203341f},
-std::array<float,2>{0.259726584f, 0.953707457f},
-std::array<float,2>{0.244666353f, 0.357363194f},
-std::array<float,2>{0.986506224f, 0.89727509f},
-std::array<float,2>{0.688961148f, 0.135648489f},
-std::array<float,2>{0.467320025f, 0.558733344f},
-std::array<float,2>{0.328058243f, 0.0862924159f},
-std::array<float,2>{0.501169503f, 0.74461478f},
-std::array<float,2>{0.84484005f, 0.389092684f},
-std::array<float,2>{0.0124692861f, 0.832030773f},
-std::array<float,2>{0.289791644f, 0.301955789f},
-std::array<float,2>{0.620289862f, 0.990202129f},
-std::array<float,2>{0.804435015f, 0.202281475f},
-std::array<float,2>{0.0812647343f, 0.580423713f},
-std::array<float,2>{0.132657364f, 0.0387496687f},
-std::array<float,2>{0.903098285f, 0.673889935f},
-std::array<float,2>{0.669709921f, 0.474668115f},
-std::array<float,2>{0.406308353f, 0.776433885f},
-std::array<float,2>{0.0562694371f, 0.435963243f},
-std::array<float,2>{0.829701543f, 0.858952641f},
-std::array<float,2>{0.553259134f, 0.116055675f},
-std::array<float,2>{0.348363101f, 0.714326084f},
-std::array<float,2>{0.473643899f, 0.162062168f},
-std::array<float,2>{0.733866036f, 0.529953301f},
-std::array<float,2>{0.940745473f, 0.333870679f},
-std::array<float,2>{0.215966061f, 0.936056495f},
-std::array<float,2>{0.387281865f, 0.350017309f},
-std::array<float,2>{0.62731576f, 0.902383566f},
-std::array<float,2>{0.935046077f, 0.129076809f},
-std::array<float,2>{0.179919243f, 0.553904474f},
-std::array<float,2>{0.113219135f, 0.0858818069f},
-std::array<float,2>{0.751627445f, 0.735511959f},
-std::array<float,2>{0.589644849f, 0.377845854f},
-std::array<float,2>{0.277562082f, 0.839932919f},
-std::array<float,2>{0.222407684f, 0.460002065f},
-std::array<float,2>{0.970068514f, 0.807206929f},
-std::array<float,2>{0.715996981f, 0.0288974177f},
-std::array<float,2>{0.442993611f, 0.641319692f},
-std::array<float,2>{0.336608618f, 0.242913142f},
-std::array<float,2>{0.523178399f, 0.59449774f},
-std::array<float,2>{0.869020224f, 0.263240516f},
-std::array<float,2>{0.0252343491f, 0.963705599f},
-std::array<float,2>{0.302997053f, 0.428561568f},
-std::array<float,2>{0.603362143f, 0.851273417f},
-std::array<float,2>{0.78698808f, 0.117562063f},
-std::array<float,2>{0.0663808137f, 0.703769982f},
-std::array<float,2>{0.155035034f, 0.167564452f},
-std::array<float,2>{0.882265627f, 0.518274307f},
-std::array<float,2>{0.672161281f, 0.336950839f},
-std::array<float,2>{0.433482558f, 0.925666392f},
-std::array<float,2>{0.0421116166f, 0.305000126f},
-std::array<float,2>{0.827621579f, 0.992489636f},
-std::array<float,2>{0.543906033f, 0.190894604f},
-std::array<float,2>{0.363985598f, 0.59270364f},
-std::array<float,2>{0.487450331f, 0.0401164629f},
-std::array<float,2>{0.736404777f, 0.68685472f},
-std::array<float,2>{0.953206062f, 0.478203744f},
-std::array<float,2>{0.199818343f, 0.767174065f},
-std::array<float,2>{0.461745739f, 0.496764153f},
-std::array<float,2>{0.692381442f, 0.750053048f},
-std::array<float,2>{0.990822434f, 0.0553710163f},
-std::array<float,2>{0.246192619f, 0.663129985f},
-std::array<float,2>{0.0102245053f, 0.205696598f},
-std::array<float,2>{0.848411918f, 0.568347991f},
-std::array<float,2>{0.504197717f, 0.283592165f},
-std::array<float,2>{0.3241705f, 0.97709924f},
-std::array<float,2>{0.161755994f, 0.320915878f},
-std::array<float,2>{0.911374629f, 0.914003015f},
-std::array<float,2>{0.653196216f, 0.180854127f},
-std::array<float,2>{0.399188727f, 0.514422119f},
-std::array<float,2>{0.265062362f, 0.0973758176f},
-std::array<float,2>{0.574797451f, 0.702480674f},
-std::array<float,2>{0.772747695f, 0.412575871f},
-std::array<float,2>{0.100994684f, 0.873140633f},
-std::array<float,2>{0.344735682f, 0.279568523f},
-std::array<float,2>{0.548118114f, 0.938596129f},
-std::array<float,2>{0.832822502f, 0.226065367f},
-std::array<float,2>{0.060510166f, 0.613063693f},
-std::array<float,2>{0.211959571f, 0.00379710854f},
-std::array<float,2>{0.94432354f, 0.63976562f},
-std::array<float,2>{0.727940857f, 0.440646708f},
-std::array<float,2>{0.470570147f, 0.796081543f},
-std::array<float,2>{0.0840080306f, 0.402026057f},
-std::array<float,2>{0.797555685f, 0.816329837f},
-std::array<float,2>{0.624750793f, 0.0740446672f},
-std::array<float,2>{0.293960422f, 0.725036144f},
-std::array<float,2>{0.411164045f, 0.147582889f},
-std::array<float,2>{0.667492211f, 0.541646063f},
-std::array<float,2>{0.89936471f, 0.361284792f},
-std::array<float,2>{0.128065199f, 0.876945317f},
-std::array<float,2>{0.484277278f, 0.291976362f},
-std::array<float,2>{0.720181465f, 0.974758148f},
-std::array<float,2>{0.950303137f, 0.214413643f},
-std::array<float,2>{0.210750535f, 0.571845829f},
-std::array<float,2>{0.0481478237f, 0.0488443337f},
-std::array<float,2>{0.841188014f, 0.670385599f},
-std::array<float,2>{0.560109377f, 0.486184239f},
-std::array<float,2>{0.357524753f, 0.760653913f},
-std::array<float,2>{0.13296324f, 0.415188104f},
-std::array<float,2>{0.89266634f, 0.860899568f},
-std::array<float,2>{0.656743169f, 0.102046266f},
-std::array<float,2>{0.41946891f, 0.690619111f},
-std::array<float,2>{0.28724125f, 0.178632066f},
-std::array<float,2>{0.614978373f, 0.506278574f},
-std::array<float,2>{0.809660614f, 0.314959019f},
-std::array<float,2>{0.0927924737f, 0.921607852f},
-std::array<float,2>{0.315543473f, 0.447406143f},
-std::array<float,2>{0.511469305f, 0.78387928f},
-std::array<float,2>{0.858534098f, 0.0081996629f},
-std::array<float,2>{0.00661694678f, 0.625786483f},
-std::array<float,2>{0.235604823f, 0.230118379f},
-std::array<float,2>{0.993158102f, 0.622597754f},
-std::array<float,2>{0.696895957f, 0.272459775f},
-std::array<float,2>{0.457781971f, 0.9512344f},
-std::array<float,2>{0.104546957f, 0.367611945f},
-std::array<float,2>{0.774897695f, 0.884110689f},
-std::array<float,2>{0.568129241f, 0.150564209f},
-std::array<float,2>{0.252882808f, 0.531848729f},
-std::array<float,2>{0.39378953f, 0.0654412061f},
-std::array<float,2>{0.647825658f, 0.72922796f},
-std::array<float,2>{0.918144763f, 0.393690974f},
-std::array<float,2>{0.168802902f, 0.820819199f},
-std::array<float,2>{0.421896189f, 0.383699536f},
-std::array<float,2>{0.683185697f, 0.833197355f},
-std::array<float,2>{0.8830024f, 0.0899623185f},
-std::array<float,2>{0.140904143f, 0.747772753f},
-std::array<float,2>{0.0731729046f, 0.138217717f},
-std::array<float,2>{0.789805651f, 0.555802524f},
-std::array<float,2>{0.599847496f, 0.354426235f},
-std::array<float,2>{0.305857718f, 0.894077718f},
-std::array<float,2>{0.193844631f, 0.253312707f},
-std::array<float,2>{0.963915706f, 0.957676411f},
-std::array<float,2>{0.746958435f, 0.238339439f},
-std::array<float,2>{0.498160303f, 0.603747189f},
-std::array<float,2>{0.372299165f, 0.0182674415f},
-std::array<float,2>{0.538806379f, 0.651185691f},
-std::array<float,2>{0.812936306f, 0.467712373f},
-std::array<float,2>{0.0334946774f, 0.80445528f},
-std::array<float,2>{0.26842615f, 0.331929028f},
-std::array<float,2>{0.583591819f, 0.930095494f},
-std::array<float,2>{0.760098696f, 0.157537967f},
-std::array<float,2>{0.124586254f, 0.526169896f},
-std::array<float,2>{0.172520757f, 0.109422758f},
-std::array<float,2>{0.928645909f, 0.715753734f},
-std::array<float,2>{0.639741302f, 0.432841331f},
-std::array<float,2>{0.378587872f, 0.855419159f},
-std::array<float,2>{0.0234346762f, 0.471814245f},
-std::array<float,2>{0.864193976f, 0.778786838f},
-std::array<float,2>{0.52763021f, 0.0343266726f},
-std::array<float,2>{0.331169218f, 0.677174926f},
-std::array<float,2>{0.44887203f, 0.196289316f},
-std::array<float,2>{0.707866967f, 0.582113922f},
-std::array<float,2>{0.983431339f, 0.297974885f},
-std::array<float,2>{0.231985733f, 0.986440241f},
-std::array<float,2>{0.429466754f, 0.286842495f},
-std::array<float,2>{0.686723113f, 0.983946323f},
-std::array<float,2>{0.889291823f, 0.207080632f},
-std::array<float,2>{0.147377223f, 0.565226495f},
-std::array<float,2>{0.0761357993f, 0.0609336384f},
-std::array<float,2>{0.794041216f, 0.65856868f},
-std::array<float,2>{0.596634865f, 0.495926678f},
-std::array<float,2>{0.311575472f, 0.754371941f},
-std::array<float,2>{0.188557744f, 0.408079863f},
-std::array<float,2>{0.967273593f, 0.868449092f},
-std::array<float,2>{0.745813012f, 0.0993927047f},
-std::array<float,2>{0.495526075f, 0.696505606f},
-std::array<float,2>{0.368762851f, 0.186689615f},
-std::array<float,2>{0.535083234f, 0.50787133f},
-std::array<float,2>{0.817097068f, 0.324384809f},
-std::array<float,2>{0.0358538851f, 0.90643847f},
-std::array<float,2>{0.26968503f, 0.44169718f},
-std::array<float,2>{0.580554187f, 0.790389597f},
-std::array<float,2>{0.761927128f, 0.00474525848f},
-std::array<float,2>{0.119168073f, 0.634856522f},
-std::array<float,2>{0.178144664f, 0.21996896f},
-std::array<float,2>{0.925492346f, 0.615774095f},
-std::array<float,2>{0.635040104f, 0.274572402f},
-std::array<float,2>{0.381451368f, 0.94346416f},
-std::array<float,2>{0.0170968212f, 0.365894437f},
-std::array<float,2>{0.86161381f, 0.880352736f},
-std::array<float,2>{0.527341604f, 0.143422142f},
-std::array<float,2>{0.33543697f, 0.545379639f},
-std::array<float,2>{0.451838881f, 0.0763818771f},
-std::array<float,2>{0.704273045f, 0.719326854f},
-std::array<float,2>{0.97800827f, 0.403226256f},
-std::array<float,2>{0.229866445f, 0.81674999f},
-std::array<float,2>{0.477347314f, 0.382281542f},
-std::array<float,2>{0.725488782f, 0.837950826f},
-std::array<float,2>{0.946637094f, 0.0811569542f},
-std::array<float,2>{0.206030175f, 0.739178002f},
-std::array<float,2>{0.0538642481f, 0.12637268f},
-std::array<float,2>{0.837819338f, 0.550736785f},
-std::array<float,2>{0.555631101f, 0.344296753f},
-std::array<float,2>{0.352603734f, 0.902196169f},
-std::array<float,2>{0.139793769f, 0.26093924f},
-std::array<float,2>{0.896341801f, 0.966789484f},
-std::array<float,2>{0.663057804f, 0.249105498f},
-std::array<float,2>{0.416452199f, 0.601020694f},
-std::array<float,2>{0.282574803f, 0.0252664164f},
-std::array<float,2>{0.61211282f, 0.647203028f},
-std::array<float,2>{0.807047129f, 0.454433709f},
-std::array<float,2>{0.0871889964f, 0.812430441f},
-std::array<float,2>{0.316603601f, 0.342026651f},
-std::array<float,2>{0.511980295f, 0.926427305f},
-std::array<float,2>{0.85358274f, 0.168890148f},
-std::array<float,2>{0.00343835587f, 0.519660294f},
-std::array<float,2>{0.239362717f, 0.12115714f},
-std::array<float,2>{0.996974766f, 0.70706594f},
-std::array<float,2>{0.701612711f, 0.423908591f},
-std::array<float,2>{0.456027687f, 0.846188605f},
-std::array<float,2>{0.106614217f, 0.481780708f},
-std::array<float,2>{0.777656019f, 0.772913873f},
-std::array<float,2>{0.566063821f, 0.0448206104f},
-std::array<float,2>{0.254070759f, 0.68250531f},
-std::array<float,2>{0.39545542f, 0.192982003f},
-std::array<float,2>{0.642304301f, 0.588984728f},
-std::array<float,2>{0.917286277f, 0.308947861f},
-std::array<float,2>{0.16763036f, 0.996370494f},
-std::array<float,2>{0.467801839f, 0.357500136f},
-std::array<float,2>{0.688341141f, 0.895954192f},
-std::array<float,2>{0.988125801f, 0.133124679f},
-std::array<float,2>{0.245827302f, 0.56244266f},
-std::array<float,2>{0.0131219048f, 0.0887544751f},
-std::array<float,2>{0.843859315f, 0.743864f},
-std::array<float,2>{0.500617504f, 0.38689521f},
-std::array<float,2>{0.327049077f, 0.829523206f},
-std::array<float,2>{0.156473696f, 0.464502275f},
-std::array<float,2>{0.907231688f, 0.798764646f},
-std::array<float,2>{0.650779366f, 0.0212677848f},
-std::array<float,2>{0.403727144f, 0.655869544f},
-std::array<float,2>{0.258255303f, 0.235504061f},
-std::array<float,2>{0.571885884f, 0.606701016f},
-std::array<float,2>{0.769194782f, 0.254632145f},
-std::array<float,2>{0.0957916528f, 0.956965685f},
-std::array<float,2>{0.348888308f, 0.435443431f},
-std::array<float,2>{0.554146886f, 0.857178867f},
-std::array<float,2>{0.829046071f, 0.113631614f},
-std::array<float,2>{0.0554277934f, 0.712691903f},
-std::array<float,2>{0.21533224f, 0.163770586f},
-std::array<float,2>{0.940193295f, 0.527413964f},
-std::array<float,2>{0.732529044f, 0.33449921f},
-std::array<float,2>{0.473537415f, 0.934323192f},
-std::array<float,2>{0.080872722f, 0.30411607f},
-std::array<float,2>{0.803343236f, 0.992008746f},
-std::array<float,2>{0.619715273f, 0.20016925f},
-std::array<float,2>{0.290322483f, 0.579384208f},
-std::array<float,2>{0.407282889f, 0.0366169102f},
-std::array<float,2>{0.668481231f, 0.673119962f},
-std::array<float,2>{0.903912067f, 0.474363059f},
-std::array<float,2>{0.131406382f, 0.774658263f},
-std::array<float,2>{0.386401117f, 0.489648402f},
-std::array<float,2>{0.629771531f, 0.76506865f},
-std::array<float,2>{0.929892361f, 0.0539765507f},
-std::array<float,2>{0.184353217f, 0.666202247f},
-std::array<float,2>{0.115945555f, 0.215494901f},
-std::array<float,2>{0.756527066f, 0.57479322f},
-std::array<float,2>{0.593166351f, 0.29507637f},
-std::array<float,2>{0.273492634f, 0.971064806f},
-std::array<float,2>{0.225168675f, 0.317321599f},
-std::array<float,2>{0.974032462f, 0.914974332f},
-std::array<float,2>{0.712029278f, 0.173857331f},
-std::array<float,2>{0.438778758f, 0.502332807f},
-std::array<float,2>{0.340950102f, 0.109350562f},
-std::array<float,2>{0.517300844f, 0.692504585f},
-std::array<float,2>{0.874340236f, 0.420813352f},
-std::array<float,2>{0.0284236576f, 0.864782333f},
-std::array<float,2>{0.299105972f, 0.268073946f},
-std::array<float,2>{0.60572052f, 0.948870897f},
-std::array<float,2>{0.78455919f, 0.231010228f},
-std::array<float,2>{0.067457065f, 0.619814813f},
-std::array<float,2>{0.151349738f, 0.0123627903f},
-std::array<float,2>{0.875317752f, 0.629831553f},
-std::array<float,2>{0.678538978f, 0.450707048f},
-std::array<float,2>{0.435423553f, 0.787127078f},
-std::array<float,2>{0.0461885147f, 0.397547066f},
-std::array<float,2>{0.823636234f, 0.825192273f},
-std::array<float,2>{0.54151392f, 0.0669846088f},
-std::array<float,2>{0.36019364f, 0.733047783f},
-std::array<float,2>{0.49129352f, 0.154970437f},
-std::array<float,2>{0.739636302f, 0.53773725f},
-std::array<float,2>{0.960471928f, 0.371827066f},
-std::array<float,2>{0.195619136f, 0.888359368f},
-std::array<float,2>{0.399902105f, 0.322395772f},
-std::array<float,2>{0.653613269f, 0.911746979f},
-std::array<float,2>{0.910659254f, 0.182534412f},
-std::array<float,2>{0.160616353f, 0.513517976f},
-std::array<float,2>{0.0997871757f, 0.0940964147f},
-std::array<float,2>{0.771910906f, 0.699594259f},
-std::array<float,2>{0.575790524f, 0.411350965f},
-std::array<float,2>{0.264236718f, 0.872621596f},
-std::array<float,2>{0.247752085f, 0.498175263f},
-std::array<float,2>{0.991531551f, 0.752484083f},
-std::array<float,2>{0.693318486f, 0.0579485223f},
-std::array<float,2>{0.462344229f, 0.66156888f},
-std::array<float,2>{0.322645783f, 0.203334779f},
-std::array<float,2>{0.504960597f, 0.56952548f},
-std::array<float,2>{0.849280298f, 0.281847715f},
-std::array<float,2>{0.011357503f, 0.980119348f},
-std::array<float,2>{0.293303668f, 0.399369419f},
-std::array<float,2>{0.623327255f, 0.812852561f},
-std::array<float,2>{0.798133194f, 0.0712292269f},
-std::array<float,2>{0.0859309956f, 0.724143028f},
-std::array<float,2>{0.127559021f, 0.146276757f},
-std::array<float,2>{0.899945676f, 0.540925622f},
-std::array<float,2>{0.666377604f, 0.362402976f},
-std::array<float,2>{0.410666525f, 0.87763381f},
-std::array<float,2>{0.0592519045f, 0.279256433f},
-std::array<float,2>{0.83395803f, 0.939494193f},
-std::array<float,2>{0.547418237f, 0.224522725f},
-std::array<float,2>{0.344649881f, 0.609612763f},
-std::array<float,2>{0.469688028f, 0.000113939466f},
-std::array<float,2>{0.727402806f, 0.638294578f},
-std::array<float,2>{0.94462204f, 0.43794772f},
-std::array<float,2>{0.211032003f, 0.793653548f},
-std::array<float,2>{0.441534221f, 0.457411736f},
-std::array<float,2>{0.715382397f, 0.8062585f},
-std::array<float,2>{0.969581068f, 0.0297289453f},
-std::array<float,2>{0.221030474f, 0.642865121f},
-std::array<float,2>{0.0238128975f, 0.244258672f},
-std::array<float,2>{0.86815083f, 0.597171068f},
-std::array<float,2>{0.521862626f, 0.263699502f},
-std::array<float,2>{0.337422758f, 0.961113095f},
-std::array<float,2>{0.181490138f, 0.348865509f},
-std::array<float,2>{0.933940709f, 0.905832052f},
-std::array<float,2>{0.628026664f, 0.13240613f},
-std::array<float,2>{0.387999713f, 0.552342653f},
-std::array<float,2>{0.279057354f, 0.0826776698f},
-std::array<float,2>{0.588490963f, 0.736643374f},
-std::array<float,2>{0.750908017f, 0.376239359f},
-std::array<float,2>{0.111855246f, 0.842205882f},
-std::array<float,2>{0.365121216f, 0.307126224f},
-std::array<float,2>{0.544874072f, 0.994351268f},
-std::array<float,2>{0.826875269f, 0.189220041f},
-std::array<float,2>{0.0413747057f, 0.591577291f},
-std::array<float,2>{0.200627923f, 0.0425975844f},
-std::array<float,2>{0.954926848f, 0.685138881f},
-std::array<float,2>{0.737944365f, 0.478650331f},
-std::array<float,2>{0.486759186f, 0.76764828f},
-std::array<float,2>{0.0649082437f, 0.427107215f},
-std::array<float,2>{0.785310447f, 0.848871589f},
-std::array<float,2>{0.601759672f, 0.120921776f},
-std::array<float,2>{0.304191023f, 0.706123412f},
-std::array<float,2>{0.432459325f, 0.164686784f},
-std::array<float,2>{0.673135281f, 0.516836524f},
-std::array<float,2>{0.88148731f, 0.338468045f},
-std::array<float,2>{0.155705571f, 0.923166573f},
-std::array<float,2>{0.499446124f, 0.250931621f},
-std::array<float,2>{0.747603476f, 0.959936142f},
-std::array<float,2>{0.963570356f, 0.240304381f},
-std::array<float,2>{0.19497928f, 0.602874696f},
-std::array<float,2>{0.0348300412f, 0.0162987541f},
-std::array<float,2>{0.814100146f, 0.648714066f},
-std::array<float,2>{0.537142634f, 0.465873808f},
-std::array<float,2>{0.371455193f, 0.801940084f},
-std::array<float,2>{0.141798452f, 0.385396272f},
-std::array<float,2>{0.884164512f, 0.834222257f},
-std::array<float,2>{0.682610571f, 0.0927617028f},
-std::array<float,2>{0.423762918f, 0.749085903f},
-std::array<float,2>{0.304761887f, 0.139969766f},
-std::array<float,2>{0.601427615f, 0.557742238f},
-std::array<float,2>{0.790446222f, 0.353427172f},
-std::array<float,2>{0.0733871683f, 0.89254576f},
-std::array<float,2>{0.330271274f, 0.470035493f},
-std::array<float,2>{0.528348684f, 0.779735982f},
-std::array<float,2>{0.864295304f, 0.0314199887f},
-std::array<float,2>{0.0222675689f, 0.67833364f},
-std::array<float,2>{0.231131166f, 0.198817f},
-std::array<float,2>{0.983184159f, 0.585025847f},
-std::array<float,2>{0.708510399f, 0.30006659f},
-std::array<float,2>{0.447939783f, 0.985247195f},
-std::array<float,2>{0.123058565f, 0.32842806f},
-std::array<float,2>{0.761546493f, 0.932025075f},
-std::array<float,2>{0.582831085f, 0.158970296f},
-std::array<float,2>{0.268600315f, 0.524312079f},
-std::array<float,2>{0.377668947f, 0.111400791f},
-std::array<float,2>{0.639579773f, 0.718117595f},
-std::array<float,2>{0.929307759f, 0.42972666f},
-std::array<float,2>{0.173486993f, 0.853050947f},
-std::array<float,2>{0.418884248f, 0.416746706f},
-std::array<float,2>{0.657602251f, 0.863085032f},
-std::array<float,2>{0.893690169f, 0.104332142f},
-std::array<float,2>{0.134134412f, 0.687636375f},
-std::array<float,2>{0.0925564542f, 0.176220596f},
-std::array<float,2>{0.808875859f, 0.504254758f},
-std::array<float,2>{0.614070714f, 0.313743621f},
-std::array<float,2>{0.288249791f, 0.919277906f},
-std::array<float,2>{0.209368572f, 0.289901793f},
-std::array<float,2>{0.949364722f, 0.973266304f},
-std::array<float,2>{0.7192716f, 0.211343423f},
-std::array<float,2>{0.483079523f, 0.57375133f},
-std::array<float,2>{0.359351128f, 0.0485709235f},
-std::array<float,2>{0.559095025f, 0.668528616f},
-std::array<float,2>{0.840743184f, 0.486529738f},
-std::array<float,2>{0.0470198281f, 0.7588709f},
-std::array<float,2>{0.253524929f, 0.371080697f},
-std::array<float,2>{0.567261338f, 0.884806752f},
-std::array<float,2>{0.774019957f, 0.149770126f},
-std::array<float,2>{0.103676051f, 0.533786356f},
-std::array<float,2>{0.169660524f, 0.0643025041f},
-std::array<float,2>{0.919507682f, 0.726914644f},
-std::array<float,2>{0.647037029f, 0.391466528f},
-std::array<float,2>{0.393526584f, 0.82383424f},
-std::array<float,2>{0.00712163886f, 0.447174549f},
-std::array<float,2>{0.858041227f, 0.781543374f},
-std::array<float,2>{0.510095596f, 0.0104185473f},
-std::array<float,2>{0.314597487f, 0.62855345f},
-std::array<float,2>{0.458379507f, 0.227411076f},
-std::array<float,2>{0.69572252f, 0.624700665f},
-std::array<float,2>{0.993908942f, 0.269889027f},
-std::array<float,2>{0.235100433f, 0.950812995f},
-std::array<float,2>{0.380059123f, 0.275908947f},
-std::array<float,2>{0.634002507f, 0.941949308f},
-std::array<float,2>{0.923604131f, 0.221241802f},
-std::array<float,2>{0.17728357f, 0.614207506f},
-std::array<float,2>{0.118749529f, 0.00732884323f},
-std::array<float,2>{0.76412493f, 0.6338498f},
-std::array<float,2>{0.579853058f, 0.44398123f},
-std::array<float,2>{0.272645652f, 0.792911351f},
-std::array<float,2>{0.226705566f, 0.405815303f},
-std::array<float,2>{0.979973376f, 0.82009095f},
-std::array<float,2>{0.705848694f, 0.0758185759f},
-std::array<float,2>{0.450900972f, 0.722574413f},
-std::array<float,2>{0.332968205f, 0.141206846f},
-std::array<float,2>{0.524998248f, 0.543829501f},
-std::array<float,2>{0.859897673f, 0.364084959f},
-std::array<float,2>{0.0182488672f, 0.881136179f},
-std::array<float,2>{0.3091712f, 0.493068427f},
-std::array<float,2>{0.593753994f, 0.756576896f},
-std::array<float,2>{0.795866966f, 0.0593072996f},
-std::array<float,2>{0.0767077357f, 0.656320095f},
-std::array<float,2>{0.145768285f, 0.209956124f},
-std::array<float,2>{0.887515783f, 0.563339949f},
-std::array<float,2>{0.683689833f, 0.287448555f},
-std::array<float,2>{0.426810473f, 0.981697202f},
-std::array<float,2>{0.0382401198f, 0.32745254f},
-std::array<float,2>{0.819205225f, 0.90879637f},
-std::array<float,2>{0.531749189f, 0.183755711f},
-std::array<float,2>{0.370007187f, 0.511346638f},
-std::array<float,2>{0.493055284f, 0.100880906f},
-std::array<float,2>{0.743061244f, 0.697611809f},
-std::array<float,2>{0.966786444f, 0.408774525f},
-std::array<float,2>{0.189869359f, 0.870495677f},
-std::array<float,2>{0.453193337f, 0.422009349f},
-std::array<float,2>{0.700254261f, 0.84461993f},
-std::array<float,2>{0.999740779f, 0.123417027f},
-std::array<float,2>{0.241390184f, 0.70978117f},
-std::array<float,2>{9.26723587e-05f, 0.171520486f},
-std::array<float,2>{0.852547169f, 0.521828115f},
-std::array<float,2>{0.514927328f, 0.34148708f},
-std::array<float,2>{0.318786234f, 0.927915096f},
-std::array<float,2>{0.165535465f, 0.311983377f},
-std::array<float,2>{0.914225876f, 0.999756455f},
-std::array<float,2>{0.642678976f, 0.194169119f},
-std::array<float,2>{0.398100406f, 0.586472929f},
-std::array<float,2>{0.257770717f, 0.0463413596f},
-std::array<float,2>{0.563887835f, 0.681559443f},
-std::array<float,2>{0.780483007f, 0.483387083f},
-std::array<float,2>{0.108494624f, 0.77114588f},
-std::array<float,2>{0.355290383f, 0.347390592f},
-std::array<float,2>{0.557670653f, 0.899157763f},
-std::array<float,2>{0.839695096f, 0.127501056f},
-std::array<float,2>{0.0522790477f, 0.547703743f},
-std::array<float,2>{0.203929901f, 0.0784337223f},
-std::array<float,2>{0.947710752f, 0.74189043f},
-std::array<float,2>{0.723526597f, 0.380341679f},
-std::array<float,2>{0.4800556f, 0.836950064f},
-std::array<float,2>{0.0885815397f, 0.456534773f},
-std::array<float,2>{0.805023193f, 0.80944699f},
-std::array<float,2>{0.6101228f, 0.0254611913f},
-std::array<float,2>{0.283820361f, 0.644890964f},
-std::array<float,2>{0.414229125f, 0.246484458f},
-std::array<float,2>{0.66205734f, 0.598572075f},
-std::array<float,2>{0.897149324f, 0.258012623f},
-std::array<float,2>{0.138004139f, 0.967195749f},
-std::array<float,2>{0.476134956f, 0.332154542f},
-std::array<float,2>{0.732085645f, 0.936789274f},
-std::array<float,2>{0.938511908f, 0.160717294f},
-std::array<float,2>{0.218056098f, 0.530711234f},
-std::array<float,2>{0.0582727492f, 0.116826527f},
-std::array<float,2>{0.830926776f, 0.713677108f},
-std::array<float,2>{0.55132556f, 0.437169909f},
-std::array<float,2>{0.351350158f, 0.857529163f},
-std::array<float,2>{0.129115179f, 0.475982815f},
-std::array<float,2>{0.905080795f, 0.775532544f},
-std::array<float,2>{0.671477616f, 0.0376735851f},
-std::array<float,2>{0.409181297f, 0.675416172f},
-std::array<float,2>{0.291728556f, 0.202030569f},
-std::array<float,2>{0.618496358f, 0.58130008f},
-std::array<float,2>{0.801987886f, 0.301483929f},
-std::array<float,2>{0.0799680054f, 0.989159167f},
-std::array<float,2>{0.326041132f, 0.390287668f},
-std::array<float,2>{0.502623379f, 0.83033675f},
-std::array<float,2>{0.847452462f, 0.0871315673f},
-std::array<float,2>{0.0150331846f, 0.74576354f},
-std::array<float,2>{0.242616147f, 0.136609912f},
-std::array<float,2>{0.986107469f, 0.560136914f},
-std::array<float,2>{0.690972984f, 0.356439173f},
-std::array<float,2>{0.466003299f, 0.897847176f},
-std::array<float,2>{0.0952234641f, 0.255891412f},
-std::array<float,2>{0.767466068f, 0.954692364f},
-std::array<float,2>{0.573506832f, 0.236585483f},
-std::array<float,2>{0.261247218f, 0.609251797f},
-std::array<float,2>{0.405914485f, 0.023161808f},
-std::array<float,2>{0.648554087f, 0.652922988f},
-std::array<float,2>{0.909312844f, 0.462341726f},
-std::array<float,2>{0.159218609f, 0.799136579f},
-std::array<float,2>{0.436763346f, 0.451555222f},
-std::array<float,2>{0.676076651f, 0.786761701f},
-std::array<float,2>{0.878514767f, 0.0147009939f},
-std::array<float,2>{0.14885132f, 0.631069958f},
-std::array<float,2>{0.0696851611f, 0.2325975f},
-std::array<float,2>{0.781328976f, 0.618807375f},
-std::array<float,2>{0.607976198f, 0.265761435f},
-std::array<float,2>{0.297277331f, 0.9455145f},
-std::array<float,2>{0.197430566f, 0.374273539f},
-std::array<float,2>{0.958830416f, 0.890034556f},
-std::array<float,2>{0.740706086f, 0.15374893f},
-std::array<float,2>{0.489122093f, 0.536796689f},
-std::array<float,2>{0.361504316f, 0.068739742f},
-std::array<float,2>{0.540452003f, 0.731687248f},
-std::array<float,2>{0.821684837f, 0.395282835f},
-std::array<float,2>{0.0439466126f, 0.826233387f},
-std::array<float,2>{0.27679792f, 0.293382406f},
-std::array<float,2>{0.591725409f, 0.970587254f},
-std::array<float,2>{0.754151165f, 0.216970861f},
-std::array<float,2>{0.113402091f, 0.578098655f},
-std::array<float,2>{0.18581894f, 0.0522234887f},
-std::array<float,2>{0.932768643f, 0.664859951f},
-std::array<float,2>{0.63096571f, 0.491086453f},
-std::array<float,2>{0.384706855f, 0.762691677f},
-std::array<float,2>{0.0294214338f, 0.419632047f},
-std::array<float,2>{0.872985721f, 0.865339994f},
-std::array<float,2>{0.518774569f, 0.106419593f},
-std::array<float,2>{0.343735605f, 0.695166051f},
-std::array<float,2>{0.441050261f, 0.17218025f},
-std::array<float,2>{0.713747323f, 0.501748264f},
-std::array<float,2>{0.9755041f, 0.319164902f},
-std::array<float,2>{0.222690076f, 0.917271972f},
-std::array<float,2>{0.413145423f, 0.360046029f},
-std::array<float,2>{0.665459394f, 0.875917196f},
-std::array<float,2>{0.901697099f, 0.147006303f},
-std::array<float,2>{0.12595132f, 0.542369902f},
-std::array<float,2>{0.0827735141f, 0.0723761842f},
-std::array<float,2>{0.799972057f, 0.725871563f},
-std::array<float,2>{0.62264812f, 0.400575072f},
-std::array<float,2>{0.296135902f, 0.815131605f},
-std::array<float,2>{0.214390665f, 0.439645439f},
-std::array<float,2>{0.941984057f, 0.795249701f},
-std::array<float,2>{0.730438292f, 0.00289501017f},
-std::array<float,2>{0.471589208f, 0.639077842f},
-std::array<float,2>{0.347599357f, 0.225135252f},
-std::array<float,2>{0.549482942f, 0.612204015f},
-std::array<float,2>{0.834577441f, 0.280943125f},
-std::array<float,2>{0.0614681542f, 0.937962651f},
-std::array<float,2>{0.262541205f, 0.414048076f},
-std::array<float,2>{0.576245546f, 0.874719441f},
-std::array<float,2>{0.769806862f, 0.0960702077f},
-std::array<float,2>{0.0981779322f, 0.7016083f},
-std::array<float,2>{0.162830234f, 0.180657029f},
-std::array<float,2>{0.912225068f, 0.515101492f},
-std::array<float,2>{0.654934049f, 0.321864188f},
-std::array<float,2>{0.402034909f, 0.91279161f},
-std::array<float,2>{0.0083203325f, 0.284496576f},
-std::array<float,2>{0.851155579f, 0.97774452f},
-std::array<float,2>{0.507017493f, 0.207008451f},
-std::array<float,2>{0.321205616f, 0.566452324f},
-std::array<float,2>{0.4637914f, 0.0557330474f},
-std::array<float,2>{0.695040524f, 0.662219167f},
-std::array<float,2>{0.989111781f, 0.497997195f},
-std::array<float,2>{0.249742523f, 0.751031935f},
-std::array<float,2>{0.485018969f, 0.477315485f},
-std::array<float,2>{0.736106694f, 0.766164243f},
-std::array<float,2>{0.956846297f, 0.0393368751f},
-std::array<float,2>{0.20121707f, 0.6863572f},
-std::array<float,2>{0.0390949436f, 0.190364882f},
-std::array<float,2>{0.826115251f, 0.593357384f},
-std::array<float,2>{0.546533763f, 0.306584656f},
-std::array<float,2>{0.3671211f, 0.993187666f},
-std::array<float,2>{0.152823687f, 0.336357683f},
-std::array<float,2>{0.879942417f, 0.924594879f},
-std::array<float,2>{0.67471838f, 0.166261494f},
-std::array<float,2>{0.430002868f, 0.518614113f},
-std::array<float,2>{0.302647889f, 0.118435919f},
-std::array<float,2>{0.603857994f, 0.704975367f},
-std::array<float,2>{0.788755f, 0.429625005f},
-std::array<float,2>{0.0637592226f, 0.849888504f},
-std::array<float,2>{0.338727683f, 0.262111485f},
-std::array<float,2>{0.520057321f, 0.964680195f},
-std::array<float,2>{0.871079266f, 0.243730947f},
-std::array<float,2>{0.0259627085f, 0.595602751f},
-std::array<float,2>{0.220588639f, 0.0282704737f},
-std::array<float,2>{0.970985651f, 0.64224869f},
-std::array<float,2>{0.716817021f, 0.459877431f},
-std::array<float,2>{0.443712592f, 0.808006585f},
-std::array<float,2>{0.111247249f, 0.378184587f},
-std::array<float,2>{0.753843248f, 0.841245174f},
-std::array<float,2>{0.587880909f, 0.0844376311f},
-std::array<float,2>{0.280174196f, 0.734980226f},
-std::array<float,2>{0.389802575f, 0.130502194f},
-std::array<float,2>{0.626644909f, 0.553561449f},
-std::array<float,2>{0.936969221f, 0.350753576f},
-std::array<float,2>{0.182154551f, 0.904083908f},
-std::array<float,2>{0.446281672f, 0.297090828f},
-std::array<float,2>{0.710827172f, 0.987580478f},
-std::array<float,2>{0.980544031f, 0.195441648f},
-std::array<float,2>{0.234314397f, 0.583754003f},
-std::array<float,2>{0.0209149215f, 0.0332263969f},
-std::array<float,2>{0.866889775f, 0.676305473f},
-std::array<float,2>{0.530401587f, 0.470780909f},
-std::array<float,2>{0.328278333f, 0.777977347f},
-std::array<float,2>{0.17455329f, 0.432584792f},
-std::array<float,2>{0.92762357f, 0.853818178f},
-std::array<float,2>{0.636743486f, 0.111069478f},
-std::array<float,2>{0.375192761f, 0.716225207f},
-std::array<float,2>{0.265909314f, 0.156355843f},
-std::array<float,2>{0.585595369f, 0.526447058f},
-std::array<float,2>{0.759629071f, 0.330409497f},
-std::array<float,2>{0.121371537f, 0.931324065f},
-std::array<float,2>{0.374192208f, 0.468368471f},
-std::array<float,2>{0.535606325f, 0.803290367f},
-std::array<float,2>{0.815056324f, 0.019328963f},
-std::array<float,2>{0.0317832641f, 0.65197742f},
-std::array<float,2>{0.191531524f, 0.239520147f},
-std::array<float,2>{0.961215973f, 0.605163634f},
-std::array<float,2>{0.749769986f, 0.25243035f},
-std::array<float,2>{0.496227115f, 0.958607197f},
-std::array<float,2>{0.0716899261f, 0.354877979f},
-std::array<float,2>{0.792664707f, 0.892922878f},
-std::array<float,2>{0.598498166f, 0.13753961f},
-std::array<float,2>{0.307779849f, 0.554987609f},
-std::array<float,2>{0.425452799f, 0.0911646485f},
-std::array<float,2>{0.680128634f, 0.746398628f},
-std::array<float,2>{0.885326207f, 0.38380608f},
-std::array<float,2>{0.142608568f, 0.832320929f},
-std::array<float,2>{0.392087162f, 0.393256962f},
-std::array<float,2>{0.646055043f, 0.82132113f},
-std::array<float,2>{0.921320856f, 0.065330863f},
-std::array<float,2>{0.170537844f, 0.730183601f},
-std::array<float,2>{0.102058627f, 0.151968837f},
-std::array<float,2>{0.77725029f, 0.532848358f},
-std::array<float,2>{0.568359733f, 0.368483722f},
-std::array<float,2>{0.250290185f, 0.883241653f},
-std::array<float,2>{0.237463281f, 0.273128957f},
-std::array<float,2>{0.99456352f, 0.952287793f},
-std::array<float,2>{0.698581815f, 0.2285254f},
-std::array<float,2>{0.460015774f, 0.621677935f},
-std::array<float,2>{0.313261211f, 0.00927169248f},
-std::array<float,2>{0.509338856f, 0.626176059f},
-std::array<float,2>{0.85586524f, 0.448711097f},
-std::array<float,2>{0.00508149341f, 0.784824967f},
-std::array<float,2>{0.287082464f, 0.316260844f},
-std::array<float,2>{0.617176652f, 0.920041084f},
-std::array<float,2>{0.810907602f, 0.179682851f},
-std::array<float,2>{0.0902859643f, 0.507662356f},
-std::array<float,2>{0.135647625f, 0.103155799f},
-std::array<float,2>{0.89133215f, 0.689752519f},
-std::array<float,2>{0.659359396f, 0.414465994f},
-std::array<float,2>{0.420336366f, 0.859440148f},
-std::array<float,2>{0.0497572683f, 0.484730005f},
-std::array<float,2>{0.842278123f, 0.7611835f},
-std::array<float,2>{0.561973631f, 0.0503319204f},
-std::array<float,2>{0.356797725f, 0.671849072f},
-std::array<float,2>{0.480532527f, 0.213386372f},
-std::array<float,2>{0.721049368f, 0.570827782f},
-std::array<float,2>{0.951352835f, 0.292189986f},
-std::array<float,2>{0.207654178f, 0.976419628f},
-std::array<float,2>{0.384121299f, 0.295841128f},
-std::array<float,2>{0.631382287f, 0.971649706f},
-std::array<float,2>{0.93314606f, 0.21519801f},
-std::array<float,2>{0.186216667f, 0.574484944f},
-std::array<float,2>{0.113789544f, 0.0546410903f},
-std::array<float,2>{0.754862547f, 0.666640997f},
-std::array<float,2>{0.5912866f, 0.49015221f},
-std::array<float,2>{0.27694428f, 0.765482605f},
-std::array<float,2>{0.223369613f, 0.420089602f},
-std::array<float,2>{0.975044906f, 0.864573598f},
-std::array<float,2>{0.713225305f, 0.108570673f},
-std::array<float,2>{0.440595031f, 0.692899466f},
-std::array<float,2>{0.343179941f, 0.174594253f},
-std::array<float,2>{0.519290209f, 0.502739906f},
-std::array<float,2>{0.872531295f, 0.316792578f},
-std::array<float,2>{0.0300952923f, 0.914121687f},
-std::array<float,2>{0.29776746f, 0.450441748f},
-std::array<float,2>{0.607723534f, 0.787932456f},
-std::array<float,2>{0.781872928f, 0.011852067f},
-std::array<float,2>{0.0700011551f, 0.629032731f},
-std::array<float,2>{0.149184987f, 0.230709985f},
-std::array<float,2>{0.878228188f, 0.619198084f},
-std::array<float,2>{0.676492989f, 0.267897993f},
-std::array<float,2>{0.437473267f, 0.948583722f},
-std::array<float,2>{0.0447469316f, 0.371184409f},
-std::array<float,2>{0.821805477f, 0.888083816f},
-std::array<float,2>{0.540737212f, 0.154711336f},
-std::array<float,2>{0.361930341f, 0.537470877f},
-std::array<float,2>{0.488624007f, 0.0666735172f},
-std::array<float,2>{0.740808666f, 0.732753158f},
-std::array<float,2>{0.958488762f, 0.398155361f},
-std::array<float,2>{0.198157206f, 0.824560344f},
-std::array<float,2>{0.466315985f, 0.38738364f},
-std::array<float,2>{0.690450966f, 0.829606533f},
-std::array<float,2>{0.985581398f, 0.0879043192f},
-std::array<float,2>{0.242742881f, 0.743651152f},
-std::array<float,2>{0.0156200873f, 0.133402601f},
-std::array<float,2>{0.846963525f, 0.56159693f},
-std::array<float,2>{0.502244473f, 0.358215779f},
-std::array<float,2>{0.325242221f, 0.896013319f},
-std::array<float,2>{0.160048664f, 0.254120409f},
-std::array<float,2>{0.909962058f, 0.956239104f},
-std::array<float,2>{0.649387956f, 0.235859782f},
-std::array<float,2>{0.405634195f, 0.606942117f},
-std::array<float,2>{0.2609348f, 0.0206596367f},
-std::array<float,2>{0.574166059f, 0.655629277f},
-std::array<float,2>{0.766710579f, 0.464346051f},
-std::array<float,2>{0.0948374793f, 0.798001885f},
-std::array<float,2>{0.350907832f, 0.334127307f},
-std::array<float,2>{0.551002324f, 0.933729529f},
-std::array<float,2>{0.830544293f, 0.163126573f},
-std::array<float,2>{0.0579540618f, 0.527981937f},
-std::array<float,2>{0.218358025f, 0.113930307f},
-std::array<float,2>{0.939354062f, 0.712002873f},
-std::array<float,2>{0.731852531f, 0.434644103f},
-std::array<float,2>{0.475643575f, 0.856932342f},
-std::array<float,2>{0.0792739987f, 0.473713487f},
-std::array<float,2>{0.802603245f, 0.775176108f},
-std::array<float,2>{0.618798912f, 0.0366335586f},
-std::array<float,2>{0.291040868f, 0.673378944f},
-std::array<float,2>{0.409785777f, 0.199442551f},
-std::array<float,2>{0.671051443f, 0.579753637f},
-std::array<float,2>{0.904508829f, 0.304650873f},
-std::array<float,2>{0.129662991f, 0.991418481f},
-std::array<float,2>{0.479649574f, 0.344054937f},
-std::array<float,2>{0.72266072f, 0.901800036f},
-std::array<float,2>{0.947774827f, 0.126471579f},
-std::array<float,2>{0.203145549f, 0.550088644f},
-std::array<float,2>{0.0521456636f, 0.0819905475f},
-std::array<float,2>{0.839016795f, 0.738516569f},
-std::array<float,2>{0.55821389f, 0.38265729f},
-std::array<float,2>{0.354638755f, 0.83863771f},
-std::array<float,2>{0.138348043f, 0.454980165f},
-std::array<float,2>{0.896876454f, 0.811788797f},
-std::array<float,2>{0.661580622f, 0.0244197473f},
-std::array<float,2>{0.414828092f, 0.646511972f},
-std::array<float,2>{0.283473521f, 0.249643788f},
-std::array<float,2>{0.609561801f, 0.601471007f},
-std::array<float,2>{0.805627108f, 0.261435211f},
-std::array<float,2>{0.087948814f, 0.966029286f},
-std::array<float,2>{0.318952709f, 0.424370706f},
-std::array<float,2>{0.515562952f, 0.84640193f},
-std::array<float,2>{0.853255689f, 0.121678106f},
-std::array<float,2>{0.00059882697f, 0.707729578f},
-std::array<float,2>{0.242090523f, 0.16821444f},
-std::array<float,2>{0.999251842f, 0.520095766f},
-std::array<float,2>{0.701073527f, 0.34258163f},
-std::array<float,2>{0.454066724f, 0.926246464f},
-std::array<float,2>{0.109172687f, 0.309496433f},
-std::array<float,2>{0.781076968f, 0.996671319f},
-std::array<float,2>{0.564369738f, 0.192749828f},
-std::array<float,2>{0.256982774f, 0.589417577f},
-std::array<float,2>{0.397559404f, 0.0440887772f},
-std::array<float,2>{0.643321276f, 0.681883931f},
-std::array<float,2>{0.914770484f, 0.482363462f},
-std::array<float,2>{0.165476993f, 0.773104548f},
-std::array<float,2>{0.427494556f, 0.49519968f},
-std::array<float,2>{0.684158742f, 0.754631639f},
-std::array<float,2>{0.886845529f, 0.0611007735f},
-std::array<float,2>{0.146281451f, 0.658869565f},
-std::array<float,2>{0.0763289779f, 0.20778285f},
-std::array<float,2>{0.795384765f, 0.564796329f},
-std::array<float,2>{0.594609857f, 0.286235809f},
-std::array<float,2>{0.30886367f, 0.983704209f},
-std::array<float,2>{0.190408185f, 0.324710935f},
-std::array<float,2>{0.966267526f, 0.906951487f},
-std::array<float,2>{0.742663682f, 0.18711859f},
-std::array<float,2>{0.492479235f, 0.508659005f},
-std::array<float,2>{0.369492263f, 0.099010475f},
-std::array<float,2>{0.531317055f, 0.697211683f},
-std::array<float,2>{0.818822503f, 0.407447278f},
-std::array<float,2>{0.0387927778f, 0.86899966f},
-std::array<float,2>{0.273159832f, 0.275202125f},
-std::array<float,2>{0.579387665f, 0.944092333f},
-std::array<float,2>{0.764597595f, 0.220386699f},
-std::array<float,2>{0.118550278f, 0.615559816f},
-std::array<float,2>{0.176841646f, 0.00399030885f},
-std::array<float,2>{0.923215389f, 0.635442019f},
-std::array<float,2>{0.634599268f, 0.442318767f},
-std::array<float,2>{0.380655766f, 0.790657878f},
-std::array<float,2>{0.0178882536f, 0.402698338f},
-std::array<float,2>{0.859551787f, 0.817000031f},
-std::array<float,2>{0.524706125f, 0.0768231675f},
-std::array<float,2>{0.332183748f, 0.719016552f},
-std::array<float,2>{0.45067966f, 0.142607599f},
-std::array<float,2>{0.705183685f, 0.545856476f},
-std::array<float,2>{0.980459511f, 0.36555469f},
-std::array<float,2>{0.227435812f, 0.88040936f},
-std::array<float,2>{0.420545906f, 0.314029098f},
-std::array<float,2>{0.659828603f, 0.919501007f},
-std::array<float,2>{0.891062617f, 0.176708341f},
-std::array<float,2>{0.134767577f, 0.504437387f},
-std::array<float,2>{0.0907647088f, 0.103795864f},
-std::array<float,2>{0.811346769f, 0.688346863f},
-std::array<float,2>{0.616502821f, 0.416386843f},
-std::array<float,2>{0.286563098f, 0.862332582f},
-std::array<float,2>{0.207104236f, 0.487154156f},
-std::array<float,2>{0.952054441f, 0.759569168f},
-std::array<float,2>{0.721376538f, 0.048103001f},
-std::array<float,2>{0.481337458f, 0.668200374f},
-std::array<float,2>{0.357094526f, 0.211791798f},
-std::array<float,2>{0.562127113f, 0.573391378f},
-std::array<float,2>{0.842651367f, 0.289443105f},
-std::array<float,2>{0.0489461683f, 0.973141909f},
-std::array<float,2>{0.250560105f, 0.391005784f},
-std::array<float,2>{0.568953156f, 0.823500454f},
-std::array<float,2>{0.776848137f, 0.0636923388f},
-std::array<float,2>{0.101835236f, 0.727485299f},
-std::array<float,2>{0.170245886f, 0.150038376f},
-std::array<float,2>{0.921582043f, 0.533344865f},
-std::array<float,2>{0.645927429f, 0.370228976f},
-std::array<float,2>{0.392239183f, 0.885283709f},
-std::array<float,2>{0.00565001369f, 0.270506769f},
-std::array<float,2>{0.856375039f, 0.950445592f},
-std::array<float,2>{0.509058774f, 0.226861656f},
-std::array<float,2>{0.312517345f, 0.624260843f},
-std::array<float,2>{0.460604101f, 0.00999277364f},
-std::array<float,2>{0.699081063f, 0.628167629f},
-std::array<float,2>{0.994840324f, 0.446487129f},
-std::array<float,2>{0.237861827f, 0.781845152f},
-std::array<float,2>{0.49677819f, 0.466632515f},
-std::array<float,2>{0.749030113f, 0.802302837f},
-std::array<float,2>{0.961782038f, 0.0159218051f},
-std::array<float,2>{0.192253634f, 0.649080396f},
-std::array<float,2>{0.0313222557f, 0.240895271f},
-std::array<float,2>{0.814574003f, 0.603252113f},
-std::array<float,2>{0.536065817f, 0.250471443f},
-std::array<float,2>{0.374541461f, 0.959110141f},
-std::array<float,2>{0.143286005f, 0.352699369f},
-std::array<float,2>{0.884787917f, 0.89194423f},
-std::array<float,2>{0.680407226f, 0.140442282f},
-std::array<float,2>{0.424886703f, 0.558278859f},
-std::array<float,2>{0.308229834f, 0.0918549299f},
-std::array<float,2>{0.598061502f, 0.749554217f},
-std::array<float,2>{0.792456865f, 0.385116816f},
-std::array<float,2>{0.0722182095f, 0.834790528f},
-std::array<float,2>{0.328868598f, 0.30051294f},
-std::array<float,2>{0.531148374f, 0.984681368f},
-std::array<float,2>{0.866588533f, 0.198576197f},
-std::array<float,2>{0.0211934634f, 0.585831583f},
-std::array<float,2>{0.233440787f, 0.0318896435f},
-std::array<float,2>{0.981080174f, 0.677788138f},
-std::array<float,2>{0.710064471f, 0.470544398f},
-std::array<float,2>{0.445507079f, 0.780104101f},
-std::array<float,2>{0.121642649f, 0.430630624f},
-std::array<float,2>{0.758871078f, 0.852755308f},
-std::array<float,2>{0.584976554f, 0.112070836f},
-std::array<float,2>{0.266521603f, 0.718582869f},
-std::array<float,2>{0.375641227f, 0.158271492f},
-std::array<float,2>{0.637475252f, 0.523769975f},
-std::array<float,2>{0.926816106f, 0.328725129f},
-std::array<float,2>{0.174029514f, 0.932260454f},
-std::array<float,2>{0.444166899f, 0.264426976f},
-std::array<float,2>{0.71734035f, 0.961884975f},
-std::array<float,2>{0.97160244f, 0.244706064f},
-std::array<float,2>{0.220190406f, 0.596817136f},
-std::array<float,2>{0.0257601347f, 0.0299594644f},
-std::array<float,2>{0.870301783f, 0.643396378f},
-std::array<float,2>{0.519909382f, 0.457672268f},
-std::array<float,2>{0.337952226f, 0.806102097f},
-std::array<float,2>{0.181765437f, 0.376682341f},
-std::array<float,2>{0.937264025f, 0.842469454f},
-std::array<float,2>{0.62613225f, 0.0820434317f},
-std::array<float,2>{0.390266269f, 0.73695451f},
-std::array<float,2>{0.279580206f, 0.13198486f},
-std::array<float,2>{0.587113917f, 0.551849604f},
-std::array<float,2>{0.753194869f, 0.349192858f},
-std::array<float,2>{0.110405602f, 0.905395508f},
-std::array<float,2>{0.366477311f, 0.479156971f},
-std::array<float,2>{0.546326399f, 0.768371582f},
-std::array<float,2>{0.82548362f, 0.0422908515f},
-std::array<float,2>{0.0397842526f, 0.684909523f},
-std::array<float,2>{0.201703727f, 0.188568905f},
-std::array<float,2>{0.956478775f, 0.590969145f},
-std::array<float,2>{0.735432029f, 0.30718264f},
-std::array<float,2>{0.484582931f, 0.994906604f},
-std::array<float,2>{0.0642994493f, 0.337939113f},
-std::array<float,2>{0.788259029f, 0.923420072f},
-std::array<float,2>{0.604378462f, 0.164405882f},
-std::array<float,2>{0.302212954f, 0.517258823f},
-std::array<float,2>{0.43053335f, 0.120129049f},
-std::array<float,2>{0.674253285f, 0.707001269f},
-std::array<float,2>{0.880377829f, 0.427484334f},
-std::array<float,2>{0.153312847f, 0.849213123f},
-std::array<float,2>{0.401654989f, 0.412035823f},
-std::array<float,2>{0.654423118f, 0.872550964f},
-std::array<float,2>{0.912874699f, 0.0945191458f},
-std::array<float,2>{0.162264287f, 0.69991082f},
-std::array<float,2>{0.0979931802f, 0.181796744f},
-std::array<float,2>{0.770226955f, 0.51302439f},
-std::array<float,2>{0.576982617f, 0.32278803f},
-std::array<float,2>{0.261860907f, 0.911305308f},
-std::array<float,2>{0.249317884f, 0.281610548f},
-std::array<float,2>{0.98854965f, 0.979861975f},
-std::array<float,2>{0.694793999f, 0.203763992f},
-std::array<float,2>{0.462961227f, 0.569856226f},
-std::array<float,2>{0.320728391f, 0.0582867265f},
-std::array<float,2>{0.507378519f, 0.661994159f},
-std::array<float,2>{0.850677192f, 0.498687148f},
-std::array<float,2>{0.00824348815f, 0.75203675f},
-std::array<float,2>{0.296756774f, 0.362946063f},
-std::array<float,2>{0.622388124f, 0.877191186f},
-std::array<float,2>{0.800781012f, 0.145735964f},
-std::array<float,2>{0.082129851f, 0.540380776f},
-std::array<float,2>{0.125059411f, 0.0704573765f},
-std::array<float,2>{0.902331948f, 0.723855317f},
-std::array<float,2>{0.66565764f, 0.398527503f},
-std::array<float,2>{0.413955659f, 0.813111365f},
-std::array<float,2>{0.0607152544f, 0.438022226f},
-std::array<float,2>{0.834155858f, 0.793172002f},
-std::array<float,2>{0.549165547f, 0.000742611766f},
-std::array<float,2>{0.346998453f, 0.637744069f},
-std::array<float,2>{0.470896661f, 0.224065393f},
-std::array<float,2>{0.729795277f, 0.610129535f},
-std::array<float,2>{0.941608429f, 0.278750867f},
-std::array<float,2>{0.214172289f, 0.94038564f},
-std::array<float,2>{0.4350003f, 0.26634559f},
-std::array<float,2>{0.677749813f, 0.946172476f},
-std::array<float,2>{0.875600636f, 0.233210385f},
-std::array<float,2>{0.150523826f, 0.618253589f},
-std::array<float,2>{0.06831716f, 0.0155793354f},
-std::array<float,2>{0.785016716f, 0.631591499f},
-std::array<float,2>{0.606342554f, 0.45187673f},
-std::array<float,2>{0.299509734f, 0.786329269f},
-std::array<float,2>{0.195959732f, 0.394569844f},
-std::array<float,2>{0.960329413f, 0.826697648f},
-std::array<float,2>{0.739835203f, 0.0693266392f},
-std::array<float,2>{0.491873294f, 0.731969178f},
-std::array<float,2>{0.359571993f, 0.154099226f},
-std::array<float,2>{0.541291595f, 0.536263287f},
-std::array<float,2>{0.823882043f, 0.374807745f},
-std::array<float,2>{0.046452526f, 0.890296757f},
-std::array<float,2>{0.274387747f, 0.490378261f},
-std::array<float,2>{0.593544304f, 0.761733711f},
-std::array<float,2>{0.756335378f, 0.0525357015f},
-std::array<float,2>{0.115542367f, 0.664217532f},
-std::array<float,2>{0.183717206f, 0.217387408f},
-std::array<float,2>{0.930194795f, 0.577513397f},
-std::array<float,2>{0.629173994f, 0.293672413f},
-std::array<float,2>{0.386196047f, 0.970139086f},
-std::array<float,2>{0.0292186458f, 0.31862697f},
-std::array<float,2>{0.874910593f, 0.917682052f},
-std::array<float,2>{0.516982675f, 0.172678351f},
-std::array<float,2>{0.341436058f, 0.501344979f},
-std::array<float,2>{0.439431071f, 0.105577566f},
-std::array<float,2>{0.712613702f, 0.694513798f},
-std::array<float,2>{0.974501073f, 0.419326723f},
-std::array<float,2>{0.225008294f, 0.86615181f},
-std::array<float,2>{0.472761929f, 0.436988205f},
-std::array<float,2>{0.733282447f, 0.857995808f},
-std::array<float,2>{0.939577818f, 0.116498493f},
-std::array<float,2>{0.214980006f, 0.712917149f},
-std::array<float,2>{0.0550940037f, 0.160340235f},
-std::array<float,2>{0.828271747f, 0.530820549f},
-std::array<float,2>{0.554451108f, 0.332984596f},
-std::array<float,2>{0.349337846f, 0.937070489f},
-std::array<float,2>{0.131150648f, 0.301001012f},
-std::array<float,2>{0.903428257f, 0.988315165f},
-std::array<float,2>{0.668203175f, 0.201394483f},
-std::array<float,2>{0.40773508f, 0.582016647f},
-std::array<float,2>{0.290568411f, 0.0374590829f},
-std::array<float,2>{0.619174719f, 0.674832225f},
-std::array<float,2>{0.803130567f, 0.47636193f},
-std::array<float,2>{0.080285348f, 0.775941491f},
-std::array<float,2>{0.326324821f, 0.355768144f},
-std::array<float,2>{0.500131726f, 0.898026049f},
-std::array<float,2>{0.844519973f, 0.136094749f},
-std::array<float,2>{0.0133662056f, 0.559575975f},
-std::array<float,2>{0.245209649f, 0.0876809359f},
-std::array<float,2>{0.987596035f, 0.745117426f},
-std::array<float,2>{0.68788743f, 0.390016735f},
-std::array<float,2>{0.46872589f, 0.830965102f},
-std::array<float,2>{0.096381627f, 0.462748021f},
-std::array<float,2>{0.768658698f, 0.79967016f},
-std::array<float,2>{0.571302354f, 0.022474708f},
-std::array<float,2>{0.258369535f, 0.652660131f},
-std::array<float,2>{0.404254645f, 0.236892551f},
-std::array<float,2>{0.651249468f, 0.608606815f},
-std::array<float,2>{0.907839656f, 0.25649482f},
-std::array<float,2>{0.157074928f, 0.95452404f},
-std::array<float,2>{0.455494612f, 0.341276437f},
-std::array<float,2>{0.701908171f, 0.928428233f},
-std::array<float,2>{0.996220171f, 0.171343654f},
-std::array<float,2>{0.239763394f, 0.522140324f},
-std::array<float,2>{0.00319082709f, 0.12397743f},
-std::array<float,2>{0.854367137f, 0.709040999f},
-std::array<float,2>{0.512289941f, 0.422802269f},
-std::array<float,2>{0.317099005f, 0.844053268f},
-std::array<float,2>{0.167252183f, 0.482758373f},
-std::array<float,2>{0.917713523f, 0.77093327f},
-std::array<float,2>{0.642078936f, 0.0465373397f},
-std::array<float,2>{0.394558758f, 0.680885136f},
-std::array<float,2>{0.254682302f, 0.193655938f},
-std::array<float,2>{0.565576434f, 0.585943937f},
-std::array<float,2>{0.778016746f, 0.312474072f},
-std::array<float,2>{0.106993042f, 0.999063253f},
-std::array<float,2>{0.353061914f, 0.380494297f},
-std::array<float,2>{0.555099607f, 0.837685108f},
-std::array<float,2>{0.836985707f, 0.0787929669f},
-std::array<float,2>{0.054636728f, 0.741474152f},
-std::array<float,2>{0.205543786f, 0.127178267f},
-std::array<float,2>{0.947084785f, 0.546885669f},
-std::array<float,2>{0.724628747f, 0.347115427f},
-std::array<float,2>{0.476747006f, 0.898547471f},
-std::array<float,2>{0.0878236294f, 0.258594215f},
-std::array<float,2>{0.807419658f, 0.967420161f},
-std::array<float,2>{0.611331224f, 0.24664633f},
-std::array<float,2>{0.282777548f, 0.597837567f},
-std::array<float,2>{0.416765273f, 0.0262372661f},
-std::array<float,2>{0.66239059f, 0.645100892f},
-std::array<float,2>{0.89572233f, 0.457019895f},
-std::array<float,2>{0.140471697f, 0.808705568f},
-std::array<float,2>{0.38123107f, 0.443786889f},
-std::array<float,2>{0.635436356f, 0.792417228f},
-std::array<float,2>{0.925150037f, 0.00696371403f},
-std::array<float,2>{0.178704932f, 0.634508729f},
-std::array<float,2>{0.119832203f, 0.220930755f},
-std::array<float,2>{0.762272656f, 0.61345005f},
-std::array<float,2>{0.580778241f, 0.27562958f},
-std::array<float,2>{0.270476311f, 0.941529274f},
-std::array<float,2>{0.230179504f, 0.363624036f},
-std::array<float,2>{0.978106201f, 0.88136059f},
-std::array<float,2>{0.704601824f, 0.140826985f},
-std::array<float,2>{0.451615125f, 0.543007016f},
-std::array<float,2>{0.335503757f, 0.0755580217f},
-std::array<float,2>{0.526764512f, 0.722121358f},
-std::array<float,2>{0.862105906f, 0.405606866f},
-std::array<float,2>{0.0169750452f, 0.819510818f},
-std::array<float,2>{0.312012672f, 0.288082212f},
-std::array<float,2>{0.595853269f, 0.981957495f},
-std::array<float,2>{0.794504642f, 0.209073067f},
-std::array<float,2>{0.0754888877f, 0.562748849f},
-std::array<float,2>{0.146813631f, 0.0590056218f},
-std::array<float,2>{0.88897264f, 0.656862974f},
-std::array<float,2>{0.687431455f, 0.492446303f},
-std::array<float,2>{0.428887784f, 0.756070256f},
-std::array<float,2>{0.0354281962f, 0.408373445f},
-std::array<float,2>{0.816677213f, 0.871025503f},
-std::array<float,2>{0.534284651f, 0.101111636f},
-std::array<float,2>{0.368330479f, 0.697946489f},
-std::array<float,2>{0.495669216f, 0.184144542f},
-std::array<float,2>{0.745590448f, 0.510778368f},
-std::array<float,2>{0.967437983f, 0.327840984f},
-std::array<float,2>{0.189335853f, 0.908527911f},
-std::array<float,2>{0.392716527f, 0.368903756f},
-std::array<float,2>{0.646823943f, 0.883667231f},
-std::array<float,2>{0.919006467f, 0.151666164f},
-std::array<float,2>{0.169403598f, 0.53268069f},
-std::array<float,2>{0.104412809f, 0.0648300201f},
-std::array<float,2>{0.773759246f, 0.72956121f},
-std::array<float,2>{0.566834629f, 0.39271602f},
-std::array<float,2>{0.25328353f, 0.822213173f},
-std::array<float,2>{0.234677806f, 0.449113488f},
-std::array<float,2>{0.993322551f, 0.784556091f},
-std::array<float,2>{0.696105003f, 0.00955417845f},
-std::array<float,2>{0.458517343f, 0.626523912f},
-std::array<float,2>{0.31532231f, 0.229269549f},
-std::array<float,2>{0.510684848f, 0.62126416f},
-std::array<float,2>{0.857806563f, 0.272739381f},
-std::array<float,2>{0.00743255205f, 0.952966332f},
-std::array<float,2>{0.288883656f, 0.414662331f},
-std::array<float,2>{0.613500237f, 0.859915614f},
-std::array<float,2>{0.809286773f, 0.103013419f},
-std::array<float,2>{0.092001237f, 0.689986527f},
-std::array<float,2>{0.134518281f, 0.178837702f},
-std::array<float,2>{0.894203842f, 0.50714308f},
-std::array<float,2>{0.658157229f, 0.315516114f},
-std::array<float,2>{0.418190688f, 0.920510352f},
-std::array<float,2>{0.0477863252f, 0.292956263f},
-std::array<float,2>{0.839991629f, 0.976005971f},
-std::array<float,2>{0.558987081f, 0.213148937f},
-std::array<float,2>{0.358634382f, 0.570574045f},
-std::array<float,2>{0.4826397f, 0.0500087179f},
-std::array<float,2>{0.718783736f, 0.671042085f},
-std::array<float,2>{0.950137317f, 0.484956443f},
-std::array<float,2>{0.209726483f, 0.761357725f},
-std::array<float,2>{0.447600693f, 0.47147873f},
-std::array<float,2>{0.708311558f, 0.777471423f},
-std::array<float,2>{0.982707858f, 0.0336944386f},
-std::array<float,2>{0.230748549f, 0.676017642f},
-std::array<float,2>{0.0218371861f, 0.195930496f},
-std::array<float,2>{0.865111113f, 0.583319724f},
-std::array<float,2>{0.529086709f, 0.297769397f},
-std::array<float,2>{0.331041873f, 0.988182664f},
-std::array<float,2>{0.173086986f, 0.330786198f},
-std::array<float,2>{0.928882122f, 0.930841208f},
-std::array<float,2>{0.638823986f, 0.156876907f},
-std::array<float,2>{0.377109051f, 0.527230084f},
-std::array<float,2>{0.269168794f, 0.110656992f},
-std::array<float,2>{0.582395017f, 0.716621459f},
-std::array<float,2>{0.761072993f, 0.432125002f},
-std::array<float,2>{0.123821318f, 0.854463339f},
-std::array<float,2>{0.371700287f, 0.252562106f},
-std::array<float,2>{0.537723064f, 0.958409011f},
-std::array<float,2>{0.813754201f, 0.240091801f},
-std::array<float,2>{0.0344013497f, 0.604785144f},
-std::array<float,2>{0.194432706f, 0.0189063512f},
-std::array<float,2>{0.963231444f, 0.651844025f},
-std::array<float,2>{0.747134089f, 0.467788905f},
-std::array<float,2>{0.499905705f, 0.802881658f},
-std::array<float,2>{0.074184157f, 0.384383917f},
-std::array<float,2>{0.790799558f, 0.832784474f},
-std::array<float,2>{0.600725174f, 0.091398932f},
-std::array<float,2>{0.305584222f, 0.746773779f},
-std::array<float,2>{0.423134476f, 0.13706252f},
-std::array<float,2>{0.681857407f, 0.55548954f},
-std::array<float,2>{0.884318411f, 0.355149269f},
-std::array<float,2>{0.142438814f, 0.893490672f},
-std::array<float,2>{0.486952871f, 0.305877984f},
-std::array<float,2>{0.737363994f, 0.993884087f},
-std::array<float,2>{0.954242945f, 0.189548224f},
-std::array<float,2>{0.200965151f, 0.59304297f},
-std::array<float,2>{0.0415925048f, 0.0400218815f},
-std::array<float,2>{0.826419711f, 0.685565114f},
-std::array<float,2>{0.544035196f, 0.477027714f},
-std::array<float,2>{0.364673287f, 0.766078353f},
-std::array<float,2>{0.156239718f, 0.428805053f},
-std::array<float,2>{0.881255984f, 0.850251317f},
-std::array<float,2>{0.673734486f, 0.118952587f},
-std::array<float,2>{0.431856394f, 0.704417288f},
-std::array<float,2>{0.304497421f, 0.166777492f},
-std::array<float,2>{0.602520943f, 0.519266009f},
-std::array<float,2>{0.785917044f, 0.336660445f},
-std::array<float,2>{0.0652003065f, 0.924163342f},
-std::array<float,2>{0.337385535f, 0.459471524f},
-std::array<float,2>{0.522013366f, 0.80853194f},
-std::array<float,2>{0.867642224f, 0.0274593048f},
-std::array<float,2>{0.0239918903f, 0.641845047f},
-std::array<float,2>{0.221317902f, 0.243643329f},
-std::array<float,2>{0.969138503f, 0.59502393f},
-std::array<float,2>{0.714923382f, 0.262359202f},
-std::array<float,2>{0.441959083f, 0.964054644f},
-std::array<float,2>{0.111598358f, 0.351260871f},
-std::array<float,2>{0.750305653f, 0.903609395f},
-std::array<float,2>{0.588345766f, 0.130009383f},
-std::array<float,2>{0.278626621f, 0.552791238f},
-std::array<float,2>{0.388457537f, 0.084869951f},
-std::array<float,2>{0.62868768f, 0.734441042f},
-std::array<float,2>{0.934539676f, 0.378640801f},
-std::array<float,2>{0.180787221f, 0.841442764f},
-std::array<float,2>{0.410396725f, 0.401316613f},
-std::array<float,2>{0.666671336f, 0.814924538f},
-std::array<float,2>{0.899733424f, 0.0729280636f},
-std::array<float,2>{0.12722531f, 0.726431787f},
-std::array<float,2>{0.0850599259f, 0.146846682f},
-std::array<float,2>{0.798727036f, 0.542526066f},
-std::array<float,2>{0.623625517f, 0.359430462f},
-std::array<float,2>{0.293927491f, 0.875061989f},
-std::array<float,2>{0.21145615f, 0.280755281f},
-std::array<float,2>{0.944907248f, 0.938097417f},
-std::array<float,2>{0.726779103f, 0.224953711f},
-std::array<float,2>{0.469020456f, 0.611689568f},
-std::array<float,2>{0.344016552f, 0.00234945351f},
-std::array<float,2>{0.547337174f, 0.639458418f},
-std::array<float,2>{0.83328253f, 0.440201372f},
-std::array<float,2>{0.0587300546f, 0.795640647f},
-std::array<float,2>{0.264131069f, 0.321579218f},
-std::array<float,2>{0.575536668f, 0.912145615f},
-std::array<float,2>{0.772346616f, 0.180049345f},
-std::array<float,2>{0.100244179f, 0.515307069f},
-std::array<float,2>{0.160912365f, 0.0963940918f},
-std::array<float,2>{0.910608709f, 0.701682091f},
-std::array<float,2>{0.654118478f, 0.413551658f},
-std::array<float,2>{0.400329232f, 0.874070108f},
-std::array<float,2>{0.0109314751f, 0.497219145f},
-std::array<float,2>{0.848830283f, 0.751846969f},
-std::array<float,2>{0.505854428f, 0.0563492849f},
-std::array<float,2>{0.322877675f, 0.662991285f},
-std::array<float,2>{0.462470442f, 0.206165969f},
-std::array<float,2>{0.692790091f, 0.567233682f},
-std::array<float,2>{0.991912186f, 0.28496325f},
-std::array<float,2>{0.247256622f, 0.978349805f},
-std::array<float,2>{0.407063395f, 0.303061604f},
-std::array<float,2>{0.669120908f, 0.99045974f},
-std::array<float,2>{0.902370512f, 0.201018125f},
-std::array<float,2>{0.132225886f, 0.578785181f},
-std::array<float,2>{0.0818489566f, 0.0360164829f},
-std::array<float,2>{0.803822696f, 0.672631562f},
-std::array<float,2>{0.620693624f, 0.473317981f},
-std::array<float,2>{0.289077848f, 0.773961604f},
-std::array<float,2>{0.216506898f, 0.434029639f},
-std::array<float,2>{0.941002548f, 0.855784774f},
-std::array<float,2>{0.734061778f, 0.114531271f},
-std::array<float,2>{0.474256724f, 0.711851358f},
-std::array<float,2>{0.347722143f, 0.163032517f},
-std::array<float,2>{0.552825212f, 0.529284894f},
-std::array<float,2>{0.829379022f, 0.335826486f},
-std::array<float,2>{0.0558878258f, 0.934623778f},
-std::array<float,2>{0.259111524f, 0.463151455f},
-std::array<float,2>{0.571123958f, 0.797388911f},
-std::array<float,2>{0.767839611f, 0.019667659f},
-std::array<float,2>{0.0967675671f, 0.655266404f},
-std::array<float,2>{0.157461777f, 0.234912962f},
-std::array<float,2>{0.906884253f, 0.606268883f},
-std::array<float,2>{0.651996791f, 0.255574286f},
-std::array<float,2>{0.402487427f, 0.955229282f},
-std::array<float,2>{0.0118883923f, 0.358681142f},
-std::array<float,2>{0.845461547f, 0.894576848f},
-std::array<float,2>{0.501532078f, 0.134622723f},
-std::array<float,2>{0.327155948f, 0.560843587f},
-std::array<float,2>{0.467161715f, 0.0888959467f},
-std::array<float,2>{0.689167976f, 0.742613494f},
-std::array<float,2>{0.987067759f, 0.388450891f},
-std::array<float,2>{0.244257495f, 0.828449368f},
-std::array<float,2>{0.490256041f, 0.39703539f},
-std::array<float,2>{0.738674462f, 0.825764298f},
-std::array<float,2>{0.959540486f, 0.0675791726f},
-std::array<float,2>{0.196623057f, 0.733641505f},
-std::array<float,2>{0.0456554964f, 0.155524775f},
-std::array<float,2>{0.822753429f, 0.538226604f},
-std::array<float,2>{0.542859018f, 0.372562468f},
-std::array<float,2>{0.361227572f, 0.886935771f},
-std::array<float,2>{0.151972756f, 0.268587619f},
-std::array<float,2>{0.876387537f, 0.947989583f},
-std::array<float,2>{0.679672778f, 0.231623381f},
-std::array<float,2>{0.434052557f, 0.620818973f},
-std::array<float,2>{0.300383031f, 0.0130254617f},
-std::array<float,2>{0.606446862f, 0.630033195f},
-std::array<float,2>{0.783776522f, 0.4501867f},
-std::array<float,2>{0.0672510713f, 0.788469195f},
-std::array<float,2>{0.340764403f, 0.317849547f},
-std::array<float,2>{0.51653713f, 0.915128767f},
-std::array<float,2>{0.873814046f, 0.175350547f},
-std::array<float,2>{0.0276806243f, 0.503445387f},
-std::array<float,2>{0.226313829f, 0.108239308f},
-std::array<float,2>{0.972710431f, 0.692148268f},
-std::array<float,2>{0.710990191f, 0.420926034f},
-std::array<float,2>{0.438270926f, 0.863785088f},
-std::array<float,2>{0.116668202f, 0.488469303f},
-std::array<float,2>{0.757672787f, 0.764536619f},
-std::array<float,2>{0.592390239f, 0.0528812818f},
-std::array<float,2>{0.274426997f, 0.667649269f},
-std::array<float,2>{0.385231197f, 0.21607466f},
-std::array<float,2>{0.63022846f, 0.575702608f},
-std::array<float,2>{0.931335866f, 0.2966775f},
-std::array<float,2>{0.184889391f, 0.971713006f},
-std::array<float,2>{0.452450871f, 0.366234004f},
-std::array<float,2>{0.704094291f, 0.879662097f},
-std::array<float,2>{0.977452695f, 0.143628374f},
-std::array<float,2>{0.22917141f, 0.546710968f},
-std::array<float,2>{0.0156354345f, 0.077513583f},
-std::array<float,2>{0.862490714f, 0.720447481f},
-std::array<float,2>{0.525863886f, 0.403842419f},
-std::array<float,2>{0.334574252f, 0.817805707f},
-std::array<float,2>{0.179175317f, 0.442545831f},
-std::array<float,2>{0.924676716f, 0.789425671f},
-std::array<float,2>{0.63582164f, 0.00506878411f},
-std::array<float,2>{0.382647306f, 0.635832906f},
-std::array<float,2>{0.271400332f, 0.219487399f},
-std::array<float,2>{0.581270278f, 0.616869748f},
-std::array<float,2>{0.763557613f, 0.274051368f},
-std::array<float,2>{0.120581545f, 0.944666982f},
-std::array<float,2>{0.368033409f, 0.406506926f},
-std::array<float,2>{0.534108758f, 0.867302537f},
-std::array<float,2>{0.817465603f, 0.0982838348f},
-std::array<float,2>{0.0361954272f, 0.695823073f},
-std::array<float,2>{0.188320979f, 0.185672671f},
-std::array<float,2>{0.968626261f, 0.509494841f},
-std::array<float,2>{0.744441628f, 0.325960249f},
-std::array<float,2>{0.494566947f, 0.908106089f},
-std::array<float,2>{0.0744689181f, 0.285231113f},
-std::array<float,2>{0.793830216f, 0.982897878f},
-std::array<float,2>{0.597197771f, 0.208962411f},
-std::array<float,2>{0.31071946f, 0.565920651f},
-std::array<float,2>{0.428177148f, 0.0620616153f},
-std::array<float,2>{0.686300278f, 0.659356833f},
-std::array<float,2>{0.889719903f, 0.494825631f},
-std::array<float,2>{0.148145944f, 0.755534589f},
-std::array<float,2>{0.395878911f, 0.480689973f},
-std::array<float,2>{0.641043246f, 0.771875203f},
-std::array<float,2>{0.91679579f, 0.0437287018f},
-std::array<float,2>{0.166183218f, 0.682651818f},
-std::array<float,2>{0.106405698f, 0.192209974f},
-std::array<float,2>{0.778661311f, 0.588425279f},
-std::array<float,2>{0.56496489f, 0.310243309f},
-std::array<float,2>{0.254976392f, 0.997572601f},
-std::array<float,2>{0.238806754f, 0.342884749f},
-std::array<float,2>{0.997656465f, 0.927352965f},
-std::array<float,2>{0.702436626f, 0.169546336f},
-std::array<float,2>{0.456495851f, 0.521212637f},
-std::array<float,2>{0.31784907f, 0.12287575f},
-std::array<float,2>{0.513201237f, 0.708616793f},
-std::array<float,2>{0.855181336f, 0.425595701f},
-std::array<float,2>{0.0029203631f, 0.846694648f},
-std::array<float,2>{0.281756967f, 0.259783834f},
-std::array<float,2>{0.612452984f, 0.965807438f},
-std::array<float,2>{0.808107734f, 0.248053312f},
-std::array<float,2>{0.0866617858f, 0.600093126f},
-std::array<float,2>{0.138867438f, 0.0243987106f},
-std::array<float,2>{0.895184696f, 0.647615969f},
-std::array<float,2>{0.664056242f, 0.453383595f},
-std::array<float,2>{0.417000562f, 0.810694098f},
-std::array<float,2>{0.0535336584f, 0.381129444f},
-std::array<float,2>{0.836614251f, 0.83889854f},
-std::array<float,2>{0.555754781f, 0.0802277997f},
-std::array<float,2>{0.351958185f, 0.73944509f},
-std::array<float,2>{0.478472203f, 0.125263721f},
-std::array<float,2>{0.725668371f, 0.549648523f},
-std::array<float,2>{0.945656538f, 0.345442057f},
-std::array<float,2>{0.206172675f, 0.900523245f},
-std::array<float,2>{0.37815237f, 0.329788178f},
-std::array<float,2>{0.64050591f, 0.933502614f},
-std::array<float,2>{0.927841485f, 0.159477547f},
-std::array<float,2>{0.172174558f, 0.5246104f},
-std::array<float,2>{0.124374002f, 0.113236204f},
-std::array<float,2>{0.760413349f, 0.717434764f},
-std::array<float,2>{0.583296835f, 0.431555331f},
-std::array<float,2>{0.267874122f, 0.852086663f},
-std::array<float,2>{0.231670663f, 0.468877673f},
-std::array<float,2>{0.984312117f, 0.780420303f},
-std::array<float,2>{0.707482278f, 0.0329551175f},
-std::array<float,2>{0.448522329f, 0.679502904f},
-std::array<float,2>{0.332011133f, 0.197321177f},
-std::array<float,2>{0.527847946f, 0.584636807f},
-std::array<float,2>{0.863458037f, 0.299227566f},
-std::array<float,2>{0.0229278263f, 0.986069858f},
-std::array<float,2>{0.306555539f, 0.386042684f},
-std::array<float,2>{0.600200713f, 0.835416675f},
-std::array<float,2>{0.789449871f, 0.0930982754f},
-std::array<float,2>{0.0724303573f, 0.748618484f},
-std::array<float,2>{0.141475409f, 0.139557183f},
-std::array<float,2>{0.883461833f, 0.557329416f},
-std::array<float,2>{0.682810485f, 0.352469414f},
-std::array<float,2>{0.422439516f, 0.89087075f},
-std::array<float,2>{0.0339168422f, 0.251396954f},
-std::array<float,2>{0.813028634f, 0.960263729f},
-std::array<float,2>{0.538476706f, 0.241593316f},
-std::array<float,2>{0.372582912f, 0.602427125f},
-std::array<float,2>{0.498753935f, 0.0171315446f},
-std::array<float,2>{0.746498942f, 0.650179982f},
-std::array<float,2>{0.964717746f, 0.465251058f},
-std::array<float,2>{0.194289744f, 0.801121175f},
-std::array<float,2>{0.457285047f, 0.446168274f},
-std::array<float,2>{0.696680367f, 0.782751679f},
-std::array<float,2>{0.992420077f, 0.0110929776f},
-std::array<float,2>{0.236223117f, 0.62708652f},
-std::array<float,2>{0.00616440969f, 0.227708727f},
-std::array<float,2>{0.859331012f, 0.623679459f},
-std::array<float,2>{0.510782719f, 0.271217227f},
-std::array<float,2>{0.316002518f, 0.949369133f},
-std::array<float,2>{0.168374926f, 0.369301319f},
-std::array<float,2>{0.918557048f, 0.886179626f},
-std::array<float,2>{0.648353636f, 0.148675531f},
-std::array<float,2>{0.394411176f, 0.534899771f},
-std::array<float,2>{0.252057046f, 0.0634166002f},
-std::array<float,2>{0.567712605f, 0.727694571f},
-std::array<float,2>{0.775125563f, 0.39222613f},
-std::array<float,2>{0.105270416f, 0.822417736f},
-std::array<float,2>{0.35826689f, 0.290717244f},
-std::array<float,2>{0.55990237f, 0.97418797f},
-std::array<float,2>{0.841450274f, 0.21206975f},
-std::array<float,2>{0.0485574678f, 0.572462857f},
-std::array<float,2>{0.210126892f, 0.0468849763f},
-std::array<float,2>{0.950840414f, 0.669663727f},
-std::array<float,2>{0.72037226f, 0.487305909f},
-std::array<float,2>{0.483858675f, 0.758126259f},
-std::array<float,2>{0.093667917f, 0.417194128f},
-std::array<float,2>{0.810402691f, 0.862103403f},
-std::array<float,2>{0.614461303f, 0.104898274f},
-std::array<float,2>{0.288081735f, 0.689406097f},
-std::array<float,2>{0.419220507f, 0.176901147f},
-std::array<float,2>{0.656568289f, 0.505029678f},
-std::array<float,2>{0.893252671f, 0.313192189f},
-std::array<float,2>{0.133476198f, 0.918615282f},
-std::array<float,2>{0.469885856f, 0.277805537f},
-std::array<float,2>{0.728273034f, 0.940526068f},
-std::array<float,2>{0.943490088f, 0.222731486f},
-std::array<float,2>{0.212407276f, 0.610840142f},
-std::array<float,2>{0.0598017387f, 0.00172884273f},
-std::array<float,2>{0.832277715f, 0.636899889f},
-std::array<float,2>{0.548485577f, 0.438802004f},
-std::array<float,2>{0.345686048f, 0.794920087f},
-std::array<float,2>{0.128439322f, 0.400258362f},
-std::array<float,2>{0.89868176f, 0.813924491f},
-std::array<float,2>{0.667164266f, 0.0715218708f},
-std::array<float,2>{0.411708206f, 0.722801089f},
-std::array<float,2>{0.294544011f, 0.145069182f},
-std::array<float,2>{0.624101043f, 0.539903104f},
-std::array<float,2>{0.797218859f, 0.362291008f},
-std::array<float,2>{0.084955059f, 0.878075004f},
-std::array<float,2>{0.323272437f, 0.49960807f},
-std::array<float,2>{0.504445493f, 0.753778934f},
-std::array<float,2>{0.847722173f, 0.0575598106f},
-std::array<float,2>{0.0105430083f, 0.660796165f},
-std::array<float,2>{0.246692255f, 0.204737574f},
-std::array<float,2>{0.990260184f, 0.568891883f},
-std::array<float,2>{0.691507697f, 0.282503694f},
-std::array<float,2>{0.461374015f, 0.978745461f},
-std::array<float,2>{0.10146483f, 0.323900431f},
-std::array<float,2>{0.773139179f, 0.911088526f},
-std::array<float,2>{0.574298978f, 0.182738692f},
-std::array<float,2>{0.265434146f, 0.512262344f},
-std::array<float,2>{0.398489028f, 0.095679149f},
-std::array<float,2>{0.652453899f, 0.7002002f},
-std::array<float,2>{0.911728919f, 0.411114633f},
-std::array<float,2>{0.16115056f, 0.871473551f},
-std::array<float,2>{0.433079839f, 0.426649362f},
-std::array<float,2>{0.67263937f, 0.848267436f},
-std::array<float,2>{0.882695317f, 0.119910829f},
-std::array<float,2>{0.154403314f, 0.705545902f},
-std::array<float,2>{0.0655037835f, 0.165343732f},
-std::array<float,2>{0.786441147f, 0.515757442f},
-std::array<float,2>{0.602688909f, 0.339384496f},
-std::array<float,2>{0.303595752f, 0.922831953f},
-std::array<float,2>{0.199412897f, 0.307817042f},
-std::array<float,2>{0.954029381f, 0.995305538f},
-std::array<float,2>{0.737086058f, 0.188377753f},
-std::array<float,2>{0.487839222f, 0.590102315f},
-std::array<float,2>{0.363455057f, 0.0415791348f},
-std::array<float,2>{0.543227315f, 0.684036374f},
-std::array<float,2>{0.827917576f, 0.479640365f},
-std::array<float,2>{0.0425146818f, 0.769518554f},
-std::array<float,2>{0.27824989f, 0.348172456f},
-std::array<float,2>{0.588899672f, 0.904456377f},
-std::array<float,2>{0.751173437f, 0.131252125f},
-std::array<float,2>{0.112321183f, 0.551404119f},
-std::array<float,2>{0.180272192f, 0.0833617151f},
-std::array<float,2>{0.935467958f, 0.737793446f},
-std::array<float,2>{0.627635777f, 0.37557444f},
-std::array<float,2>{0.386738747f, 0.843100369f},
-std::array<float,2>{0.0244865306f, 0.458436817f},
-std::array<float,2>{0.868630946f, 0.804992855f},
-std::array<float,2>{0.522670448f, 0.0310843252f},
-std::array<float,2>{0.336223602f, 0.643906474f},
-std::array<float,2>{0.442481846f, 0.245176271f},
-std::array<float,2>{0.716742218f, 0.595775664f},
-std::array<float,2>{0.97025305f, 0.264660448f},
-std::array<float,2>{0.221820623f, 0.962783456f},
-std::array<float,2>{0.405148715f, 0.257534474f},
-std::array<float,2>{0.650167704f, 0.953504264f},
-std::array<float,2>{0.908249855f, 0.238103151f},
-std::array<float,2>{0.158912525f, 0.60791719f},
-std::array<float,2>{0.0943765491f, 0.0220721606f},
-std::array<float,2>{0.766189396f, 0.654074728f},
-std::array<float,2>{0.572279811f, 0.46133855f},
-std::array<float,2>{0.260248065f, 0.800383627f},
-std::array<float,2>{0.243575215f, 0.389453888f},
-std::array<float,2>{0.984923482f, 0.831534863f},
-std::array<float,2>{0.689569771f, 0.0865930021f},
-std::array<float,2>{0.465632558f, 0.744643569f},
-std::array<float,2>{0.324323446f, 0.135048896f},
-std::array<float,2>{0.503807604f, 0.559472978f},
-std::array<float,2>{0.846432149f, 0.35649386f},
-std::array<float,2>{0.0143045606f, 0.896957397f},
-std::array<float,2>{0.292940646f, 0.475307763f},
-std::array<float,2>{0.617360115f, 0.776936889f},
-std::array<float,2>{0.80146414f, 0.0381645337f},
-std::array<float,2>{0.0787701905f, 0.674377799f},
-std::array<float,2>{0.130687788f, 0.202861249f},
-std::array<float,2>{0.905681193f, 0.580631495f},
-std::array<float,2>{0.67004329f, 0.302332938f},
-std::array<float,2>{0.408765256f, 0.989380419f},
-std::array<float,2>{0.0574516952f, 0.333493322f},
-std::array<float,2>{0.831256926f, 0.935723126f},
-std::array<float,2>{0.552397668f, 0.161227748f},
-std::array<float,2>{0.350515276f, 0.529445112f},
-std::array<float,2>{0.474642754f, 0.115374535f},
-std::array<float,2>{0.730626762f, 0.714647651f},
-std::array<float,2>{0.938375413f, 0.436445504f},
-std::array<float,2>{0.217682421f, 0.858521104f},
-std::array<float,2>{0.440158069f, 0.418829948f},
-std::array<float,2>{0.714516699f, 0.866217613f},
-std::array<float,2>{0.976442158f, 0.106969304f},
-std::array<float,2>{0.223813981f, 0.693955541f},
-std::array<float,2>{0.0307206847f, 0.173733801f},
-std::array<float,2>{0.871346474f, 0.500179589f},
-std::array<float,2>{0.517852902f, 0.319982708f},
-std::array<float,2>{0.34276402f, 0.916054249f},
-std::array<float,2>{0.18739906f, 0.294072717f},
-std::array<float,2>{0.931966066f, 0.969632506f},
-std::array<float,2>{0.632634223f, 0.218144894f},
-std::array<float,2>{0.383389562f, 0.57621038f},
-std::array<float,2>{0.276090205f, 0.0516910031f},
-std::array<float,2>{0.589993f, 0.665454626f},
-std::array<float,2>{0.755026758f, 0.491679251f},
-std::array<float,2>{0.114933863f, 0.762996078f},
-std::array<float,2>{0.362961709f, 0.373355687f},
-std::array<float,2>{0.539765835f, 0.889320791f},
-std::array<float,2>{0.820813596f, 0.152452528f},
-std::array<float,2>{0.0435119309f, 0.535848677f},
-std::array<float,2>{0.198674604f, 0.0695546567f},
-std::array<float,2>{0.957182467f, 0.730704844f},
-std::array<float,2>{0.741232276f, 0.396313578f},
-std::array<float,2>{0.489597738f, 0.82716459f},
-std::array<float,2>{0.0692089871f, 0.452653229f},
-std::array<float,2>{0.783002853f, 0.78586036f},
-std::array<float,2>{0.608810842f, 0.013809694f},
-std::array<float,2>{0.298348904f, 0.632081985f},
-std::array<float,2>{0.435848475f, 0.233916923f},
-std::array<float,2>{0.677663624f, 0.6176458f},
-std::array<float,2>{0.876955628f, 0.26715225f},
-std::array<float,2>{0.150388137f, 0.947007239f},
-std::array<float,2>{0.494030774f, 0.326302797f},
-std::array<float,2>{0.743529856f, 0.909276426f},
-std::array<float,2>{0.965238512f, 0.185213909f},
-std::array<float,2>{0.190432832f, 0.510732949f},
-std::array<float,2>{0.0373252891f, 0.0997149646f},
-std::array<float,2>{0.819972217f, 0.69892776f},
-std::array<float,2>{0.532732546f, 0.409292907f},
-std::array<float,2>{0.370322436f, 0.869962096f},
-std::array<float,2>{0.144898728f, 0.4940328f},
-std::array<float,2>{0.888134599f, 0.757731736f},
-std::array<float,2>{0.684969783f, 0.0596377589f},
-std::array<float,2>{0.425825417f, 0.657506406f},
-std::array<float,2>{0.309928834f, 0.210283995f},
-std::array<float,2>{0.595538259f, 0.563845277f},
-std::array<float,2>{0.796127021f, 0.288608909f},
-std::array<float,2>{0.0779969022f, 0.980678916f},
-std::array<float,2>{0.333366096f, 0.404578745f},
-std::array<float,2>{0.523526132f, 0.818423688f},
-std::array<float,2>{0.860479116f, 0.0746599957f},
-std::array<float,2>{0.0193428695f, 0.720877707f},
-std::array<float,2>{0.227926224f, 0.141907692f},
-std::array<float,2>{0.978804946f, 0.544849575f},
-std::array<float,2>{0.70688355f, 0.364264429f},
-std::array<float,2>{0.449970424f, 0.88234508f},
-std::array<float,2>{0.117416494f, 0.277285814f},
-std::array<float,2>{0.765256286f, 0.942518771f},
-std::array<float,2>{0.578581929f, 0.221886575f},
-std::array<float,2>{0.27244699f, 0.614257872f},
-std::array<float,2>{0.37925905f, 0.00616009627f},
-std::array<float,2>{0.633484602f, 0.633392215f},
-std::array<float,2>{0.921976805f, 0.445118219f},
-std::array<float,2>{0.175788894f, 0.791174948f},
-std::array<float,2>{0.415998071f, 0.455246121f},
-std::array<float,2>{0.660269678f, 0.81001538f},
-std::array<float,2>{0.897629917f, 0.0265584085f},
-std::array<float,2>{0.137406036f, 0.645768881f},
-std::array<float,2>{0.0894103795f, 0.24794066f},
-std::array<float,2>{0.805791318f, 0.599352479f},
-std::array<float,2>{0.610431671f, 0.259388804f},
-std::array<float,2>{0.284926653f, 0.968491197f},
-std::array<float,2>{0.204586044f, 0.345965177f},
-std::array<float,2>{0.948363364f, 0.899463296f},
-std::array<float,2>{0.724545658f, 0.128055632f},
-std::array<float,2>{0.47878167f, 0.548082352f},
-std::array<float,2>{0.353852957f, 0.0794621035f},
-std::array<float,2>{0.557455838f, 0.740959406f},
-std::array<float,2>{0.83846724f, 0.379571557f},
-std::array<float,2>{0.0517493039f, 0.836000383f},
-std::array<float,2>{0.256308496f, 0.310738415f},
-std::array<float,2>{0.562671363f, 0.998274267f},
-std::array<float,2>{0.779460192f, 0.194942504f},
-std::array<float,2>{0.10802868f, 0.587627172f},
-std::array<float,2>{0.164208278f, 0.045122426f},
-std::array<float,2>{0.915069997f, 0.680066764f},
-std::array<float,2>{0.643948495f, 0.484284967f},
-std::array<float,2>{0.397426486f, 0.769709349f},
-std::array<float,2>{0.00172271009f, 0.423305154f},
-std::array<float,2>{0.851832569f, 0.845007896f},
-std::array<float,2>{0.51415664f, 0.124984331f},
-std::array<float,2>{0.319975436f, 0.710482657f},
-std::array<float,2>{0.454830647f, 0.170868441f},
-std::array<float,2>{0.6993137f, 0.522635758f},
-std::array<float,2>{0.998648465f, 0.33987385f},
-std::array<float,2>{0.240518704f, 0.928742468f},
-std::array<float,2>{0.424334317f, 0.353672057f},
-std::array<float,2>{0.680973351f, 0.894028723f},
-std::array<float,2>{0.88591671f, 0.137798294f},
-std::array<float,2>{0.144142747f, 0.556351125f},
-std::array<float,2>{0.070478417f, 0.0905168876f},
-std::array<float,2>{0.791466236f, 0.747220993f},
-std::array<float,2>{0.598955512f, 0.383295506f},
-std::array<float,2>{0.306794554f, 0.833964884f},
-std::array<float,2>{0.192545399f, 0.467088461f},
-std::array<float,2>{0.962050319f, 0.803797066f},
-std::array<float,2>{0.748859107f, 0.017894933f},
-std::array<float,2>{0.497644275f, 0.650469065f},
-std::array<float,2>{0.373408914f, 0.238962159f},
-std::array<float,2>{0.536644101f, 0.604467034f},
-std::array<float,2>{0.816104233f, 0.253892809f},
-std::array<float,2>{0.0328979492f, 0.957361579f},
-std::array<float,2>{0.267278612f, 0.433438033f},
-std::array<float,2>{0.584786236f, 0.854835868f},
-std::array<float,2>{0.758487642f, 0.110103004f},
-std::array<float,2>{0.122975476f, 0.714975059f},
-std::array<float,2>{0.175504759f, 0.157899871f},
-std::array<float,2>{0.926262081f, 0.525662661f},
-std::array<float,2>{0.638487279f, 0.331394464f},
-std::array<float,2>{0.376092762f, 0.930420697f},
-std::array<float,2>{0.0196344368f, 0.298774213f},
-std::array<float,2>{0.865890503f, 0.987005234f},
-std::array<float,2>{0.529539883f, 0.197162792f},
-std::array<float,2>{0.329893112f, 0.582539082f},
-std::array<float,2>{0.446541518f, 0.0351434499f},
-std::array<float,2>{0.709857523f, 0.677322268f},
-std::array<float,2>{0.982271791f, 0.472323239f},
-std::array<float,2>{0.232525289f, 0.77911818f},
-std::array<float,2>{0.482380182f, 0.485691816f},
-std::array<float,2>{0.722230613f, 0.760243952f},
-std::array<float,2>{0.952556729f, 0.0495691448f},
-std::array<float,2>{0.20826903f, 0.670446754f},
-std::array<float,2>{0.0499173291f, 0.214109868f},
-std::array<float,2>{0.843106329f, 0.571386337f},
-std::array<float,2>{0.560867608f, 0.291216731f},
-std::array<float,2>{0.355940074f, 0.975476027f},
-std::array<float,2>{0.136459559f, 0.314757615f},
-std::array<float,2>{0.892507493f, 0.921381593f},
-std::array<float,2>{0.658529401f, 0.177802399f},
-std::array<float,2>{0.421639144f, 0.506400526f},
-std::array<float,2>{0.285867363f, 0.102453455f},
-std::array<float,2>{0.61541158f, 0.691334009f},
-std::array<float,2>{0.81233573f, 0.415685266f},
-std::array<float,2>{0.0910314918f, 0.860502005f},
-std::array<float,2>{0.313871682f, 0.271740377f},
-std::array<float,2>{0.508151054f, 0.951987743f},
-std::array<float,2>{0.856861949f, 0.229554862f},
-std::array<float,2>{0.00437954953f, 0.622085512f},
-std::array<float,2>{0.23690778f, 0.0083856415f},
-std::array<float,2>{0.995926619f, 0.625193715f},
-std::array<float,2>{0.698054135f, 0.448145986f},
-std::array<float,2>{0.459269106f, 0.783431888f},
-std::array<float,2>{0.103199326f, 0.394262731f},
-std::array<float,2>{0.775595009f, 0.820639789f},
-std::array<float,2>{0.570119679f, 0.066097036f},
-std::array<float,2>{0.251772642f, 0.728901744f},
-std::array<float,2>{0.391269833f, 0.151361823f},
-std::array<float,2>{0.644958794f, 0.531436861f},
-std::array<float,2>{0.920002818f, 0.367796808f},
-std::array<float,2>{0.171641454f, 0.884745121f},
-std::array<float,2>{0.464704692f, 0.283997834f},
-std::array<float,2>{0.693406463f, 0.976916909f},
-std::array<float,2>{0.989486158f, 0.205146119f},
-std::array<float,2>{0.248754337f, 0.567853451f},
-std::array<float,2>{0.00947692804f, 0.0550599769f},
-std::array<float,2>{0.850219846f, 0.66397661f},
-std::array<float,2>{0.506709874f, 0.49639982f},
-std::array<float,2>{0.322139204f, 0.750807345f},
-std::array<float,2>{0.163192898f, 0.412638724f},
-std::array<float,2>{0.913992226f, 0.873987556f},
-std::array<float,2>{0.655844986f, 0.0971553847f},
-std::array<float,2>{0.400866807f, 0.70295471f},
-std::array<float,2>{0.263624549f, 0.181586817f},
-std::array<float,2>{0.577866197f, 0.513966918f},
-std::array<float,2>{0.771217406f, 0.320503503f},
-std::array<float,2>{0.0986815616f, 0.91323179f},
-std::array<float,2>{0.346578598f, 0.441055924f},
-std::array<float,2>{0.550326705f, 0.796672225f},
-std::array<float,2>{0.834991038f, 0.00341098988f},
-std::array<float,2>{0.0622486323f, 0.640411317f},
-std::array<float,2>{0.213752672f, 0.226209834f},
-std::array<float,2>{0.942671001f, 0.612635374f},
-std::array<float,2>{0.728922665f, 0.27991128f},
-std::array<float,2>{0.472134203f, 0.939047456f},
-std::array<float,2>{0.0835398883f, 0.360589355f},
-std::array<float,2>{0.799098194f, 0.876329899f},
-std::array<float,2>{0.621112525f, 0.148423165f},
-std::array<float,2>{0.295394182f, 0.541060746f},
-std::array<float,2>{0.412900895f, 0.0733068511f},
-std::array<float,2>{0.66488862f, 0.725194335f},
-std::array<float,2>{0.900530219f, 0.40162161f},
-std::array<float,2>{0.126577184f, 0.815782547f},
-std::array<float,2>{0.38956815f, 0.377114296f},
-std::array<float,2>{0.625601649f, 0.840681016f},
-std::array<float,2>{0.935719967f, 0.0851332396f},
-std::array<float,2>{0.183534041f, 0.735847473f},
-std::array<float,2>{0.110069081f, 0.129704162f},
-std::array<float,2>{0.752062798f, 0.554326653f},
-std::array<float,2>{0.586790502f, 0.350558549f},
-std::array<float,2>{0.280704319f, 0.902958393f},
-std::array<float,2>{0.219497204f, 0.262807101f},
-std::array<float,2>{0.972436249f, 0.96329391f},
-std::array<float,2>{0.718486726f, 0.242327839f},
-std::array<float,2>{0.444847077f, 0.594002128f},
-std::array<float,2>{0.339171857f, 0.028751906f},
-std::array<float,2>{0.521328747f, 0.641081214f},
-std::array<float,2>{0.869430065f, 0.460818082f},
-std::array<float,2>{0.0264855772f, 0.807121754f},
-std::array<float,2>{0.301368982f, 0.337459952f},
-std::array<float,2>{0.604979575f, 0.925237f},
-std::array<float,2>{0.787959218f, 0.167356372f},
-std::array<float,2>{0.0625895262f, 0.517849743f},
-std::array<float,2>{0.153432906f, 0.117989428f},
-std::array<float,2>{0.878993809f, 0.703528762f},
-std::array<float,2>{0.675469995f, 0.427874953f},
-std::array<float,2>{0.430856258f, 0.850606918f},
-std::array<float,2>{0.0403376929f, 0.477743298f},
-std::array<float,2>{0.824742734f, 0.766700566f},
-std::array<float,2>{0.545524538f, 0.0405830517f},
-std::array<float,2>{0.36552164f, 0.687429786f},
-std::array<float,2>{0.485677958f, 0.191257671f},
-std::array<float,2>{0.735291958f, 0.592211545f},
-std::array<float,2>{0.955973625f, 0.30529955f},
-std::array<float,2>{0.203089863f, 0.992910922f}}
\ No newline at end of file
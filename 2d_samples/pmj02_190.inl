@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.576945961f, 0.303045243f},
-std::array<float,2>{0.359656632f, 0.959742367f},
-std::array<float,2>{0.876811683f, 0.704996407f},
-std::array<float,2>{0.214463249f, 0.239685312f},
-std::array<float,2>{0.825444102f, 0.0164104681f},
-std::array<float,2>{0.0695985779f, 0.616585255f},
-std::array<float,2>{0.709927678f, 0.808952868f},
-std::array<float,2>{0.390828073f, 0.417093903f},
-std::array<float,2>{0.984881461f, 0.482072771f},
-std::array<float,2>{0.164736241f, 0.839456916f},
-std::array<float,2>{0.514425874f, 0.508596778f},
-std::array<float,2>{0.275613278f, 0.0814763829f},
-std::array<float,2>{0.639489472f, 0.131762609f},
-std::array<float,2>{0.455599576f, 0.639217734f},
-std::array<float,2>{0.797297359f, 0.928928196f},
-std::array<float,2>{0.00613711588f, 0.370275825f},
-std::array<float,2>{0.747914016f, 0.38083148f},
-std::array<float,2>{0.423533052f, 0.767977893f},
-std::array<float,2>{0.850527763f, 0.580402136f},
-std::array<float,2>{0.109759606f, 0.0390925743f},
-std::array<float,2>{0.915417373f, 0.217783213f},
-std::array<float,2>{0.243555546f, 0.726544678f},
-std::array<float,2>{0.596527696f, 0.997384667f},
-std::array<float,2>{0.337204874f, 0.255819499f},
-std::array<float,2>{0.779460192f, 0.324982882f},
-std::array<float,2>{0.0493956842f, 0.889306724f},
-std::array<float,2>{0.667791665f, 0.666359365f},
-std::array<float,2>{0.484708935f, 0.182673112f},
-std::array<float,2>{0.550635576f, 0.116022639f},
-std::array<float,2>{0.307054341f, 0.552121997f},
-std::array<float,2>{0.941296875f, 0.863340139f},
-std::array<float,2>{0.149560943f, 0.440252572f},
-std::array<float,2>{0.522339523f, 0.460384756f},
-std::array<float,2>{0.252478361f, 0.856400728f},
-std::array<float,2>{0.976233423f, 0.532961011f},
-std::array<float,2>{0.177253112f, 0.0960029513f},
-std::array<float,2>{0.787974358f, 0.16888687f},
-std::array<float,2>{0.0264406465f, 0.680025041f},
-std::array<float,2>{0.65060091f, 0.900168478f},
-std::array<float,2>{0.43835777f, 0.333251864f},
-std::array<float,2>{0.890690327f, 0.276597887f},
-std::array<float,2>{0.189093038f, 0.979989946f},
-std::array<float,2>{0.579711914f, 0.737946391f},
-std::array<float,2>{0.354891449f, 0.192598045f},
-std::array<float,2>{0.693834186f, 0.0619140752f},
-std::array<float,2>{0.390620708f, 0.567056477f},
-std::array<float,2>{0.832321525f, 0.755355716f},
-std::array<float,2>{0.0880640075f, 0.392436802f},
-std::array<float,2>{0.68058461f, 0.349365592f},
-std::array<float,2>{0.483685046f, 0.917499363f},
-std::array<float,2>{0.752947152f, 0.647379637f},
-std::array<float,2>{0.0390107445f, 0.1479256f},
-std::array<float,2>{0.959787726f, 0.0676180124f},
-std::array<float,2>{0.133851096f, 0.530703664f},
-std::array<float,2>{0.539015949f, 0.815304935f},
-std::array<float,2>{0.288787305f, 0.485015184f},
-std::array<float,2>{0.867614031f, 0.432719082f},
-std::array<float,2>{0.0960790664f, 0.791695833f},
-std::array<float,2>{0.720900834f, 0.597188652f},
-std::array<float,2>{0.410039812f, 0.00885331072f},
-std::array<float,2>{0.623705566f, 0.23255378f},
-std::array<float,2>{0.314205974f, 0.701985061f},
-std::array<float,2>{0.933111787f, 0.944330156f},
-std::array<float,2>{0.222785428f, 0.289707154f},
-std::array<float,2>{0.542109966f, 0.33650437f},
-std::array<float,2>{0.29686752f, 0.893603504f},
-std::array<float,2>{0.968660057f, 0.674256086f},
-std::array<float,2>{0.130920812f, 0.159247771f},
-std::array<float,2>{0.760628879f, 0.104739763f},
-std::array<float,2>{0.0444608405f, 0.54548496f},
-std::array<float,2>{0.677445233f, 0.845648825f},
-std::array<float,2>{0.470754951f, 0.463362783f},
-std::array<float,2>{0.922342181f, 0.401366651f},
-std::array<float,2>{0.233801395f, 0.759225249f},
-std::array<float,2>{0.611955166f, 0.573996723f},
-std::array<float,2>{0.327785701f, 0.0530634299f},
-std::array<float,2>{0.734069288f, 0.20179148f},
-std::array<float,2>{0.415872425f, 0.742815852f},
-std::array<float,2>{0.865606666f, 0.969763041f},
-std::array<float,2>{0.105916865f, 0.269534409f},
-std::array<float,2>{0.646483064f, 0.494610012f},
-std::array<float,2>{0.446941167f, 0.821334004f},
-std::array<float,2>{0.7910164f, 0.516779661f},
-std::array<float,2>{0.0233408585f, 0.0721623003f},
-std::array<float,2>{0.976608992f, 0.150831297f},
-std::array<float,2>{0.180162042f, 0.649325848f},
-std::array<float,2>{0.528384626f, 0.913592815f},
-std::array<float,2>{0.263970494f, 0.358114272f},
-std::array<float,2>{0.841594756f, 0.282571048f},
-std::array<float,2>{0.0846676752f, 0.951661289f},
-std::array<float,2>{0.698644996f, 0.692589462f},
-std::array<float,2>{0.382781863f, 0.223604783f},
-std::array<float,2>{0.590253413f, 0.00222728588f},
-std::array<float,2>{0.348293453f, 0.607104242f},
-std::array<float,2>{0.906175315f, 0.788974702f},
-std::array<float,2>{0.201884419f, 0.423737198f},
-std::array<float,2>{0.602942705f, 0.409820259f},
-std::array<float,2>{0.332817167f, 0.803907096f},
-std::array<float,2>{0.910126746f, 0.621264398f},
-std::array<float,2>{0.240795448f, 0.0308929291f},
-std::array<float,2>{0.859192789f, 0.243826345f},
-std::array<float,2>{0.119285129f, 0.712190092f},
-std::array<float,2>{0.738685608f, 0.961914361f},
-std::array<float,2>{0.434789181f, 0.307926714f},
-std::array<float,2>{0.952574313f, 0.365107119f},
-std::array<float,2>{0.142820328f, 0.937007964f},
-std::array<float,2>{0.559615672f, 0.627433538f},
-std::array<float,2>{0.296975583f, 0.137662575f},
-std::array<float,2>{0.657124996f, 0.0903890878f},
-std::array<float,2>{0.495933145f, 0.500876606f},
-std::array<float,2>{0.769508898f, 0.832412899f},
-std::array<float,2>{0.0593855605f, 0.469076782f},
-std::array<float,2>{0.716872096f, 0.262596995f},
-std::array<float,2>{0.404375255f, 0.99088186f},
-std::array<float,2>{0.813123703f, 0.730896831f},
-std::array<float,2>{0.0742665753f, 0.21014151f},
-std::array<float,2>{0.885049999f, 0.0328011848f},
-std::array<float,2>{0.209363863f, 0.586676478f},
-std::array<float,2>{0.566913307f, 0.775839269f},
-std::array<float,2>{0.371367931f, 0.386160761f},
-std::array<float,2>{0.805798233f, 0.450666368f},
-std::array<float,2>{0.0132252639f, 0.87468791f},
-std::array<float,2>{0.627774596f, 0.557471156f},
-std::array<float,2>{0.464332134f, 0.118525229f},
-std::array<float,2>{0.507062018f, 0.177872553f},
-std::array<float,2>{0.272904307f, 0.661453187f},
-std::array<float,2>{0.996105194f, 0.880545378f},
-std::array<float,2>{0.163732618f, 0.320189059f},
-std::array<float,2>{0.616034746f, 0.372982651f},
-std::array<float,2>{0.323901176f, 0.923156738f},
-std::array<float,2>{0.926762044f, 0.634405077f},
-std::array<float,2>{0.229463905f, 0.12747173f},
-std::array<float,2>{0.860970616f, 0.0833610296f},
-std::array<float,2>{0.101837367f, 0.514944971f},
-std::array<float,2>{0.728842318f, 0.841121376f},
-std::array<float,2>{0.420289755f, 0.477718472f},
-std::array<float,2>{0.962976098f, 0.419855803f},
-std::array<float,2>{0.125466198f, 0.807361126f},
-std::array<float,2>{0.543119133f, 0.611606658f},
-std::array<float,2>{0.289822578f, 0.0229124594f},
-std::array<float,2>{0.673105001f, 0.237231284f},
-std::array<float,2>{0.473648012f, 0.708913922f},
-std::array<float,2>{0.761845827f, 0.955570638f},
-std::array<float,2>{0.0420046262f, 0.298161983f},
-std::array<float,2>{0.700257123f, 0.441420317f},
-std::array<float,2>{0.377752185f, 0.859846652f},
-std::array<float,2>{0.83878547f, 0.549384236f},
-std::array<float,2>{0.0791381747f, 0.110721312f},
-std::array<float,2>{0.900669515f, 0.183896601f},
-std::array<float,2>{0.1970516f, 0.67168349f},
-std::array<float,2>{0.587377131f, 0.886644781f},
-std::array<float,2>{0.346055835f, 0.323748976f},
-std::array<float,2>{0.794804633f, 0.251510441f},
-std::array<float,2>{0.0177244749f, 0.993021548f},
-std::array<float,2>{0.641211331f, 0.719440281f},
-std::array<float,2>{0.452998728f, 0.214088529f},
-std::array<float,2>{0.524823606f, 0.045139987f},
-std::array<float,2>{0.258404285f, 0.584048033f},
-std::array<float,2>{0.983126581f, 0.771310985f},
-std::array<float,2>{0.185669735f, 0.376302779f},
-std::array<float,2>{0.557296395f, 0.396949708f},
-std::array<float,2>{0.301139385f, 0.750662267f},
-std::array<float,2>{0.946048319f, 0.562959373f},
-std::array<float,2>{0.148346052f, 0.0548862852f},
-std::array<float,2>{0.76971513f, 0.189910889f},
-std::array<float,2>{0.058032658f, 0.740572929f},
-std::array<float,2>{0.661443472f, 0.981629193f},
-std::array<float,2>{0.49877739f, 0.279155016f},
-std::array<float,2>{0.912815869f, 0.331950128f},
-std::array<float,2>{0.234999374f, 0.902436435f},
-std::array<float,2>{0.608492374f, 0.68407917f},
-std::array<float,2>{0.329463989f, 0.164472938f},
-std::array<float,2>{0.73644805f, 0.101422518f},
-std::array<float,2>{0.43127504f, 0.538011074f},
-std::array<float,2>{0.852100551f, 0.854548931f},
-std::array<float,2>{0.121901549f, 0.454262257f},
-std::array<float,2>{0.630271375f, 0.293839723f},
-std::array<float,2>{0.465111315f, 0.940088332f},
-std::array<float,2>{0.812491834f, 0.698905349f},
-std::array<float,2>{0.00892459322f, 0.228569359f},
-std::array<float,2>{0.99530834f, 0.0132271852f},
-std::array<float,2>{0.157016471f, 0.598712981f},
-std::array<float,2>{0.501465797f, 0.796703696f},
-std::array<float,2>{0.268266827f, 0.433831871f},
-std::array<float,2>{0.81897527f, 0.488763452f},
-std::array<float,2>{0.0740722567f, 0.817621589f},
-std::array<float,2>{0.712485731f, 0.524511576f},
-std::array<float,2>{0.401717156f, 0.065768227f},
-std::array<float,2>{0.564529657f, 0.144271672f},
-std::array<float,2>{0.36868766f, 0.641439855f},
-std::array<float,2>{0.888937771f, 0.920072436f},
-std::array<float,2>{0.204300687f, 0.344605595f},
-std::array<float,2>{0.511023045f, 0.267797172f},
-std::array<float,2>{0.278153241f, 0.974183619f},
-std::array<float,2>{0.990983665f, 0.747847617f},
-std::array<float,2>{0.169753924f, 0.195859864f},
-std::array<float,2>{0.801629186f, 0.0495144539f},
-std::array<float,2>{0.00164093508f, 0.577786148f},
-std::array<float,2>{0.632894933f, 0.763420761f},
-std::array<float,2>{0.458981752f, 0.404036134f},
-std::array<float,2>{0.881067932f, 0.46557948f},
-std::array<float,2>{0.215369776f, 0.850629508f},
-std::array<float,2>{0.572079957f, 0.539514005f},
-std::array<float,2>{0.365858376f, 0.105951138f},
-std::array<float,2>{0.705871701f, 0.163718387f},
-std::array<float,2>{0.396687061f, 0.67811358f},
-std::array<float,2>{0.820780456f, 0.897100806f},
-std::array<float,2>{0.0631296039f, 0.343379796f},
-std::array<float,2>{0.67010051f, 0.427132994f},
-std::array<float,2>{0.491816372f, 0.783076048f},
-std::array<float,2>{0.774806261f, 0.601996005f},
-std::array<float,2>{0.0511009172f, 0.0053377999f},
-std::array<float,2>{0.94298774f, 0.222159237f},
-std::array<float,2>{0.153063908f, 0.690662444f},
-std::array<float,2>{0.552651584f, 0.948268294f},
-std::array<float,2>{0.311275512f, 0.287903666f},
-std::array<float,2>{0.847171664f, 0.353937477f},
-std::array<float,2>{0.113486961f, 0.907225192f},
-std::array<float,2>{0.743629336f, 0.653033435f},
-std::array<float,2>{0.426289856f, 0.154519454f},
-std::array<float,2>{0.598475397f, 0.0769028291f},
-std::array<float,2>{0.342033327f, 0.522010446f},
-std::array<float,2>{0.920431077f, 0.828075349f},
-std::array<float,2>{0.247542426f, 0.499237001f},
-std::array<float,2>{0.585096836f, 0.473294556f},
-std::array<float,2>{0.359290779f, 0.830985785f},
-std::array<float,2>{0.895652056f, 0.504538834f},
-std::array<float,2>{0.194271728f, 0.0878353566f},
-std::array<float,2>{0.831523418f, 0.133287013f},
-std::array<float,2>{0.0899891928f, 0.631871283f},
-std::array<float,2>{0.690674245f, 0.932873189f},
-std::array<float,2>{0.384030968f, 0.361026943f},
-std::array<float,2>{0.971075773f, 0.30913493f},
-std::array<float,2>{0.172187552f, 0.96593076f},
-std::array<float,2>{0.517575741f, 0.715070367f},
-std::array<float,2>{0.256121725f, 0.248326451f},
-std::array<float,2>{0.652348518f, 0.0241306778f},
-std::array<float,2>{0.442300111f, 0.620112479f},
-std::array<float,2>{0.782124281f, 0.799157858f},
-std::array<float,2>{0.0305092987f, 0.412279457f},
-std::array<float,2>{0.722823501f, 0.313616186f},
-std::array<float,2>{0.410490096f, 0.878793716f},
-std::array<float,2>{0.874254107f, 0.657552361f},
-std::array<float,2>{0.0997612327f, 0.174436763f},
-std::array<float,2>{0.934416592f, 0.121359318f},
-std::array<float,2>{0.219311044f, 0.561865091f},
-std::array<float,2>{0.619238198f, 0.870716155f},
-std::array<float,2>{0.319901466f, 0.445513606f},
-std::array<float,2>{0.755512774f, 0.388274848f},
-std::array<float,2>{0.0329717025f, 0.778307974f},
-std::array<float,2>{0.686950386f, 0.592421055f},
-std::array<float,2>{0.478910744f, 0.0352696888f},
-std::array<float,2>{0.531804442f, 0.203872293f},
-std::array<float,2>{0.284341186f, 0.728029609f},
-std::array<float,2>{0.954272211f, 0.985179901f},
-std::array<float,2>{0.137862638f, 0.261549443f},
-std::array<float,2>{0.594927549f, 0.256735504f},
-std::array<float,2>{0.339158773f, 0.999193251f},
-std::array<float,2>{0.916449368f, 0.723961473f},
-std::array<float,2>{0.246092498f, 0.215802312f},
-std::array<float,2>{0.849537373f, 0.0423216373f},
-std::array<float,2>{0.112518139f, 0.578557551f},
-std::array<float,2>{0.74924612f, 0.767425358f},
-std::array<float,2>{0.42495966f, 0.381299704f},
-std::array<float,2>{0.939210355f, 0.438346148f},
-std::array<float,2>{0.15218015f, 0.866642416f},
-std::array<float,2>{0.547438323f, 0.553539157f},
-std::array<float,2>{0.306430638f, 0.114470005f},
-std::array<float,2>{0.664157569f, 0.179882243f},
-std::array<float,2>{0.487402648f, 0.665419459f},
-std::array<float,2>{0.779162347f, 0.887637377f},
-std::array<float,2>{0.048761107f, 0.327660173f},
-std::array<float,2>{0.70833993f, 0.415092945f},
-std::array<float,2>{0.393377304f, 0.812360942f},
-std::array<float,2>{0.8263219f, 0.614673376f},
-std::array<float,2>{0.0672091022f, 0.0181978047f},
-std::array<float,2>{0.877783895f, 0.240336925f},
-std::array<float,2>{0.21222496f, 0.705170095f},
-std::array<float,2>{0.57563585f, 0.958116233f},
-std::array<float,2>{0.362796336f, 0.302570581f},
-std::array<float,2>{0.800465941f, 0.3677136f},
-std::array<float,2>{0.00417969469f, 0.927456439f},
-std::array<float,2>{0.637308478f, 0.638513684f},
-std::array<float,2>{0.454317421f, 0.129453912f},
-std::array<float,2>{0.511811495f, 0.0791851357f},
-std::array<float,2>{0.27408585f, 0.511074901f},
-std::array<float,2>{0.988030493f, 0.835951686f},
-std::array<float,2>{0.166716695f, 0.482672274f},
-std::array<float,2>{0.536180675f, 0.487314612f},
-std::array<float,2>{0.28662017f, 0.813830018f},
-std::array<float,2>{0.957713962f, 0.527527392f},
-std::array<float,2>{0.135473981f, 0.0697154179f},
-std::array<float,2>{0.751355052f, 0.144821927f},
-std::array<float,2>{0.0365956202f, 0.645838499f},
-std::array<float,2>{0.682256699f, 0.914877594f},
-std::array<float,2>{0.482173562f, 0.351497501f},
-std::array<float,2>{0.931343555f, 0.291422576f},
-std::array<float,2>{0.22555396f, 0.94254756f},
-std::array<float,2>{0.622634113f, 0.700242877f},
-std::array<float,2>{0.314743638f, 0.232278228f},
-std::array<float,2>{0.719727635f, 0.0102467136f},
-std::array<float,2>{0.406296879f, 0.59509021f},
-std::array<float,2>{0.870571077f, 0.790401876f},
-std::array<float,2>{0.0941702053f, 0.430890352f},
-std::array<float,2>{0.649060786f, 0.334415406f},
-std::array<float,2>{0.440310925f, 0.902112782f},
-std::array<float,2>{0.786231518f, 0.683548808f},
-std::array<float,2>{0.0249014851f, 0.170395866f},
-std::array<float,2>{0.973431051f, 0.0949452594f},
-std::array<float,2>{0.179389715f, 0.53338182f},
-std::array<float,2>{0.519998491f, 0.858349919f},
-std::array<float,2>{0.251026541f, 0.458775163f},
-std::array<float,2>{0.834386349f, 0.393752098f},
-std::array<float,2>{0.08621227f, 0.757582903f},
-std::array<float,2>{0.69161272f, 0.569664896f},
-std::array<float,2>{0.387972206f, 0.0597136095f},
-std::array<float,2>{0.581765294f, 0.193648905f},
-std::array<float,2>{0.351807892f, 0.735158503f},
-std::array<float,2>{0.893442094f, 0.977847755f},
-std::array<float,2>{0.18975234f, 0.2752662f},
-std::array<float,2>{0.530128717f, 0.357398689f},
-std::array<float,2>{0.26191923f, 0.910598159f},
-std::array<float,2>{0.979540169f, 0.65052855f},
-std::array<float,2>{0.181971759f, 0.148983836f},
-std::array<float,2>{0.790165663f, 0.0736230463f},
-std::array<float,2>{0.0197925474f, 0.517789364f},
-std::array<float,2>{0.646824181f, 0.822595894f},
-std::array<float,2>{0.449024022f, 0.493685305f},
-std::array<float,2>{0.904024959f, 0.42454356f},
-std::array<float,2>{0.20039621f, 0.785519779f},
-std::array<float,2>{0.592941761f, 0.609338164f},
-std::array<float,2>{0.351211309f, 0.00114830618f},
-std::array<float,2>{0.696709514f, 0.226467058f},
-std::array<float,2>{0.379674882f, 0.694329262f},
-std::array<float,2>{0.842731535f, 0.94960922f},
-std::array<float,2>{0.0824255869f, 0.283886909f},
-std::array<float,2>{0.679037035f, 0.461286396f},
-std::array<float,2>{0.469030738f, 0.846210539f},
-std::array<float,2>{0.759222865f, 0.543090582f},
-std::array<float,2>{0.0464568362f, 0.10327433f},
-std::array<float,2>{0.9664042f, 0.157133505f},
-std::array<float,2>{0.128979072f, 0.673400581f},
-std::array<float,2>{0.540302575f, 0.892544508f},
-std::array<float,2>{0.294585675f, 0.339815378f},
-std::array<float,2>{0.864590228f, 0.271720231f},
-std::array<float,2>{0.107842073f, 0.971656978f},
-std::array<float,2>{0.731840253f, 0.745229542f},
-std::array<float,2>{0.417893797f, 0.199830994f},
-std::array<float,2>{0.610638857f, 0.051285468f},
-std::array<float,2>{0.325930625f, 0.570677042f},
-std::array<float,2>{0.924815238f, 0.760967851f},
-std::array<float,2>{0.232189506f, 0.399163902f},
-std::array<float,2>{0.569708228f, 0.383869797f},
-std::array<float,2>{0.374598324f, 0.774231911f},
-std::array<float,2>{0.883926213f, 0.588030696f},
-std::array<float,2>{0.207413867f, 0.0344241522f},
-std::array<float,2>{0.814578116f, 0.208127737f},
-std::array<float,2>{0.0780077651f, 0.732865989f},
-std::array<float,2>{0.716142297f, 0.98837775f},
-std::array<float,2>{0.402465701f, 0.26464355f},
-std::array<float,2>{0.998330712f, 0.318302214f},
-std::array<float,2>{0.161352962f, 0.881410956f},
-std::array<float,2>{0.504373491f, 0.662411988f},
-std::array<float,2>{0.270240784f, 0.175910279f},
-std::array<float,2>{0.626532912f, 0.120398641f},
-std::array<float,2>{0.462817013f, 0.55647862f},
-std::array<float,2>{0.806897402f, 0.872365534f},
-std::array<float,2>{0.0149438195f, 0.452630818f},
-std::array<float,2>{0.742126167f, 0.305709928f},
-std::array<float,2>{0.436100304f, 0.963755488f},
-std::array<float,2>{0.85698247f, 0.714522958f},
-std::array<float,2>{0.118467256f, 0.245008662f},
-std::array<float,2>{0.907567501f, 0.0281245112f},
-std::array<float,2>{0.240090206f, 0.623506546f},
-std::array<float,2>{0.605303168f, 0.801471055f},
-std::array<float,2>{0.334261715f, 0.407601088f},
-std::array<float,2>{0.766263783f, 0.472205132f},
-std::array<float,2>{0.0619621091f, 0.834964037f},
-std::array<float,2>{0.66010654f, 0.502806365f},
-std::array<float,2>{0.492688775f, 0.0934699774f},
-std::array<float,2>{0.562247992f, 0.139444679f},
-std::array<float,2>{0.300439f, 0.626690328f},
-std::array<float,2>{0.950368702f, 0.934550107f},
-std::array<float,2>{0.141919851f, 0.365914404f},
-std::array<float,2>{0.589640975f, 0.321971595f},
-std::array<float,2>{0.344290257f, 0.884497583f},
-std::array<float,2>{0.898665965f, 0.669167221f},
-std::array<float,2>{0.199113503f, 0.185810953f},
-std::array<float,2>{0.837761998f, 0.111740112f},
-std::array<float,2>{0.0800957009f, 0.547279537f},
-std::array<float,2>{0.702265143f, 0.862044513f},
-std::array<float,2>{0.375270694f, 0.444648474f},
-std::array<float,2>{0.982027471f, 0.377300471f},
-std::array<float,2>{0.184219196f, 0.773166299f},
-std::array<float,2>{0.526491702f, 0.583327293f},
-std::array<float,2>{0.260734469f, 0.0438197553f},
-std::array<float,2>{0.64275229f, 0.212007582f},
-std::array<float,2>{0.450946659f, 0.720875442f},
-std::array<float,2>{0.796693861f, 0.994983852f},
-std::array<float,2>{0.0159680489f, 0.253166258f},
-std::array<float,2>{0.728239059f, 0.479678929f},
-std::array<float,2>{0.41806677f, 0.842430294f},
-std::array<float,2>{0.861764848f, 0.512765408f},
-std::array<float,2>{0.104236998f, 0.0848943293f},
-std::array<float,2>{0.929329813f, 0.126065865f},
-std::array<float,2>{0.227927074f, 0.635622263f},
-std::array<float,2>{0.614638507f, 0.925753772f},
-std::array<float,2>{0.321370929f, 0.373859584f},
-std::array<float,2>{0.763722777f, 0.299716324f},
-std::array<float,2>{0.0392619707f, 0.953921854f},
-std::array<float,2>{0.675047934f, 0.709390283f},
-std::array<float,2>{0.475576669f, 0.235298514f},
-std::array<float,2>{0.546874464f, 0.0214191526f},
-std::array<float,2>{0.291397154f, 0.60999918f},
-std::array<float,2>{0.961125076f, 0.804983258f},
-std::array<float,2>{0.128055647f, 0.420966744f},
-std::array<float,2>{0.503697932f, 0.43658632f},
-std::array<float,2>{0.26601994f, 0.793441951f},
-std::array<float,2>{0.994069874f, 0.600728691f},
-std::array<float,2>{0.158339843f, 0.0152000673f},
-std::array<float,2>{0.808654964f, 0.227117226f},
-std::array<float,2>{0.0115542337f, 0.696420729f},
-std::array<float,2>{0.632708251f, 0.9388147f},
-std::array<float,2>{0.467683852f, 0.295443535f},
-std::array<float,2>{0.88777411f, 0.345937073f},
-std::array<float,2>{0.206714422f, 0.91883409f},
-std::array<float,2>{0.563024998f, 0.644027472f},
-std::array<float,2>{0.370340019f, 0.141059399f},
-std::array<float,2>{0.71325326f, 0.0627228171f},
-std::array<float,2>{0.398942083f, 0.526835978f},
-std::array<float,2>{0.817571104f, 0.819965184f},
-std::array<float,2>{0.0703685209f, 0.49183324f},
-std::array<float,2>{0.663680911f, 0.27977711f},
-std::array<float,2>{0.496700138f, 0.983652711f},
-std::array<float,2>{0.772805631f, 0.739884973f},
-std::array<float,2>{0.0558732711f, 0.188833714f},
-std::array<float,2>{0.948782861f, 0.0568322763f},
-std::array<float,2>{0.145675585f, 0.565024614f},
-std::array<float,2>{0.555689216f, 0.753371894f},
-std::array<float,2>{0.303262234f, 0.396137148f},
-std::array<float,2>{0.854310811f, 0.456160367f},
-std::array<float,2>{0.123335093f, 0.851887286f},
-std::array<float,2>{0.734956384f, 0.535471737f},
-std::array<float,2>{0.43332085f, 0.0982872099f},
-std::array<float,2>{0.606135011f, 0.166082069f},
-std::array<float,2>{0.331315756f, 0.685654938f},
-std::array<float,2>{0.910442054f, 0.905915916f},
-std::array<float,2>{0.236751676f, 0.328973055f},
-std::array<float,2>{0.554174662f, 0.286177129f},
-std::array<float,2>{0.309219003f, 0.946812987f},
-std::array<float,2>{0.944276452f, 0.689326465f},
-std::array<float,2>{0.154497042f, 0.219329149f},
-std::array<float,2>{0.776453912f, 0.00740624126f},
-std::array<float,2>{0.053201437f, 0.605367005f},
-std::array<float,2>{0.668650627f, 0.784093022f},
-std::array<float,2>{0.49014625f, 0.428924173f},
-std::array<float,2>{0.919663846f, 0.496863633f},
-std::array<float,2>{0.249434814f, 0.824356198f},
-std::array<float,2>{0.601282716f, 0.519638956f},
-std::array<float,2>{0.340354145f, 0.0756340697f},
-std::array<float,2>{0.744247854f, 0.152987912f},
-std::array<float,2>{0.42955181f, 0.655052543f},
-std::array<float,2>{0.843948901f, 0.90968138f},
-std::array<float,2>{0.116586722f, 0.353111148f},
-std::array<float,2>{0.636527777f, 0.404807985f},
-std::array<float,2>{0.459010899f, 0.76395905f},
-std::array<float,2>{0.803841174f, 0.575994253f},
-std::array<float,2>{0.00349927344f, 0.0483266674f},
-std::array<float,2>{0.989016831f, 0.198323399f},
-std::array<float,2>{0.171830788f, 0.749880016f},
-std::array<float,2>{0.508953154f, 0.974646389f},
-std::array<float,2>{0.280314207f, 0.267309368f},
-std::array<float,2>{0.822662532f, 0.340977818f},
-std::array<float,2>{0.0657709166f, 0.896191537f},
-std::array<float,2>{0.70449847f, 0.676165819f},
-std::array<float,2>{0.39585048f, 0.161146551f},
-std::array<float,2>{0.572613478f, 0.109181188f},
-std::array<float,2>{0.364591897f, 0.542175531f},
-std::array<float,2>{0.880191445f, 0.847903132f},
-std::array<float,2>{0.21798557f, 0.468345731f},
-std::array<float,2>{0.617870033f, 0.447552741f},
-std::array<float,2>{0.317206502f, 0.868142009f},
-std::array<float,2>{0.937406421f, 0.560003519f},
-std::array<float,2>{0.221168384f, 0.124055184f},
-std::array<float,2>{0.87165761f, 0.173149407f},
-std::array<float,2>{0.0977631062f, 0.659043491f},
-std::array<float,2>{0.726146936f, 0.875101745f},
-std::array<float,2>{0.414054394f, 0.314971209f},
-std::array<float,2>{0.955400884f, 0.258345425f},
-std::array<float,2>{0.13974531f, 0.987455904f},
-std::array<float,2>{0.534138441f, 0.730110526f},
-std::array<float,2>{0.282375187f, 0.206517667f},
-std::array<float,2>{0.684225559f, 0.0386391617f},
-std::array<float,2>{0.478050023f, 0.590680957f},
-std::array<float,2>{0.757350326f, 0.781226933f},
-std::array<float,2>{0.0338360257f, 0.389984637f},
-std::array<float,2>{0.688144088f, 0.361373425f},
-std::array<float,2>{0.38593486f, 0.931067824f},
-std::array<float,2>{0.828690112f, 0.629469573f},
-std::array<float,2>{0.0918458849f, 0.135448322f},
-std::array<float,2>{0.896822512f, 0.0887796208f},
-std::array<float,2>{0.192155749f, 0.507667959f},
-std::array<float,2>{0.582110047f, 0.829463899f},
-std::array<float,2>{0.355580807f, 0.475876808f},
-std::array<float,2>{0.78372997f, 0.411566079f},
-std::array<float,2>{0.0281660166f, 0.798697054f},
-std::array<float,2>{0.655884624f, 0.617876291f},
-std::array<float,2>{0.444259405f, 0.0265055411f},
-std::array<float,2>{0.518063486f, 0.247739673f},
-std::array<float,2>{0.254095405f, 0.718277574f},
-std::array<float,2>{0.969211876f, 0.967796326f},
-std::array<float,2>{0.174876541f, 0.312426507f},
-std::array<float,2>{0.578713477f, 0.273906082f},
-std::array<float,2>{0.354390651f, 0.976901889f},
-std::array<float,2>{0.891674221f, 0.735544503f},
-std::array<float,2>{0.188188359f, 0.195130065f},
-std::array<float,2>{0.833558142f, 0.0593226217f},
-std::array<float,2>{0.0892163217f, 0.568510532f},
-std::array<float,2>{0.69469589f, 0.756229162f},
-std::array<float,2>{0.389190823f, 0.393114626f},
-std::array<float,2>{0.974769413f, 0.457107276f},
-std::array<float,2>{0.176447302f, 0.858735085f},
-std::array<float,2>{0.523365319f, 0.534965634f},
-std::array<float,2>{0.253771454f, 0.0940514281f},
-std::array<float,2>{0.651676834f, 0.17178753f},
-std::array<float,2>{0.439106375f, 0.682513833f},
-std::array<float,2>{0.788261116f, 0.901108801f},
-std::array<float,2>{0.0257337131f, 0.335183144f},
-std::array<float,2>{0.721900463f, 0.430284232f},
-std::array<float,2>{0.408304513f, 0.789534628f},
-std::array<float,2>{0.868504584f, 0.594079852f},
-std::array<float,2>{0.0973209664f, 0.0109957922f},
-std::array<float,2>{0.931805909f, 0.230722979f},
-std::array<float,2>{0.224032313f, 0.699832499f},
-std::array<float,2>{0.624384105f, 0.941562176f},
-std::array<float,2>{0.313101768f, 0.29236868f},
-std::array<float,2>{0.752650917f, 0.349785656f},
-std::array<float,2>{0.0374010131f, 0.915907562f},
-std::array<float,2>{0.680951893f, 0.644942462f},
-std::array<float,2>{0.483017802f, 0.146447465f},
-std::array<float,2>{0.538030505f, 0.0688620284f},
-std::array<float,2>{0.287664801f, 0.528485119f},
-std::array<float,2>{0.960548997f, 0.812591314f},
-std::array<float,2>{0.13302502f, 0.486545682f},
-std::array<float,2>{0.515220284f, 0.483463943f},
-std::array<float,2>{0.277107298f, 0.837272584f},
-std::array<float,2>{0.98588115f, 0.510252714f},
-std::array<float,2>{0.165072411f, 0.0788971782f},
-std::array<float,2>{0.798393667f, 0.130438715f},
-std::array<float,2>{0.00720314961f, 0.637672007f},
-std::array<float,2>{0.639761329f, 0.925992966f},
-std::array<float,2>{0.456371099f, 0.368532687f},
-std::array<float,2>{0.875727952f, 0.301560432f},
-std::array<float,2>{0.213606566f, 0.957623243f},
-std::array<float,2>{0.577217758f, 0.706355691f},
-std::array<float,2>{0.360959828f, 0.24147135f},
-std::array<float,2>{0.710142553f, 0.0186175425f},
-std::array<float,2>{0.391728848f, 0.61403501f},
-std::array<float,2>{0.824795783f, 0.811362505f},
-std::array<float,2>{0.0693302229f, 0.414873838f},
-std::array<float,2>{0.666260421f, 0.326577038f},
-std::array<float,2>{0.485457301f, 0.888335764f},
-std::array<float,2>{0.78095752f, 0.664770246f},
-std::array<float,2>{0.0500626154f, 0.181464419f},
-std::array<float,2>{0.940092623f, 0.113652676f},
-std::array<float,2>{0.149153024f, 0.554600656f},
-std::array<float,2>{0.549078465f, 0.865507126f},
-std::array<float,2>{0.307704359f, 0.439371735f},
-std::array<float,2>{0.851014972f, 0.381916344f},
-std::array<float,2>{0.111061938f, 0.766314864f},
-std::array<float,2>{0.746543527f, 0.579328656f},
-std::array<float,2>{0.421958715f, 0.0417104289f},
-std::array<float,2>{0.597647429f, 0.216373384f},
-std::array<float,2>{0.336357087f, 0.723260581f},
-std::array<float,2>{0.914090097f, 0.998832881f},
-std::array<float,2>{0.242575288f, 0.25754571f},
-std::array<float,2>{0.558961749f, 0.366256803f},
-std::array<float,2>{0.298003793f, 0.935211539f},
-std::array<float,2>{0.951378286f, 0.625099361f},
-std::array<float,2>{0.144198075f, 0.139898241f},
-std::array<float,2>{0.767891943f, 0.0924439281f},
-std::array<float,2>{0.0600557104f, 0.503641784f},
-std::array<float,2>{0.658023357f, 0.834796548f},
-std::array<float,2>{0.494825751f, 0.471256018f},
-std::array<float,2>{0.90886724f, 0.407015681f},
-std::array<float,2>{0.241441697f, 0.801974237f},
-std::array<float,2>{0.601893187f, 0.624615908f},
-std::array<float,2>{0.333136827f, 0.0287828036f},
-std::array<float,2>{0.739984274f, 0.245628387f},
-std::array<float,2>{0.43371129f, 0.71316433f},
-std::array<float,2>{0.857437372f, 0.964700818f},
-std::array<float,2>{0.120902151f, 0.304842919f},
-std::array<float,2>{0.628384531f, 0.452106416f},
-std::array<float,2>{0.463221043f, 0.871969402f},
-std::array<float,2>{0.805025935f, 0.555389345f},
-std::array<float,2>{0.0124147227f, 0.11967843f},
-std::array<float,2>{0.997831106f, 0.177299187f},
-std::array<float,2>{0.163027897f, 0.663943887f},
-std::array<float,2>{0.506167769f, 0.882481515f},
-std::array<float,2>{0.271925628f, 0.316706032f},
-std::array<float,2>{0.814225137f, 0.264934659f},
-std::array<float,2>{0.07607124f, 0.990105212f},
-std::array<float,2>{0.717980862f, 0.733645618f},
-std::array<float,2>{0.405587941f, 0.207608804f},
-std::array<float,2>{0.567720354f, 0.0341035612f},
-std::array<float,2>{0.372607321f, 0.589084685f},
-std::array<float,2>{0.886057734f, 0.775387645f},
-std::array<float,2>{0.21005106f, 0.383100003f},
-std::array<float,2>{0.613112092f, 0.399803519f},
-std::array<float,2>{0.326945186f, 0.760091126f},
-std::array<float,2>{0.922907412f, 0.571528256f},
-std::array<float,2>{0.232944459f, 0.0523248613f},
-std::array<float,2>{0.866793334f, 0.200828239f},
-std::array<float,2>{0.10671971f, 0.744867861f},
-std::array<float,2>{0.732449651f, 0.972440004f},
-std::array<float,2>{0.414393306f, 0.272580206f},
-std::array<float,2>{0.966883302f, 0.338033736f},
-std::array<float,2>{0.131991863f, 0.891301572f},
-std::array<float,2>{0.541157663f, 0.672623456f},
-std::array<float,2>{0.295715302f, 0.157370105f},
-std::array<float,2>{0.676075637f, 0.102372818f},
-std::array<float,2>{0.471772552f, 0.544704139f},
-std::array<float,2>{0.76123625f, 0.846836388f},
-std::array<float,2>{0.0437697768f, 0.462756306f},
-std::array<float,2>{0.697440743f, 0.284405738f},
-std::array<float,2>{0.381649017f, 0.950491369f},
-std::array<float,2>{0.840695977f, 0.695081055f},
-std::array<float,2>{0.0856009126f, 0.225198656f},
-std::array<float,2>{0.904543877f, 0.000284008682f},
-std::array<float,2>{0.202734858f, 0.607507288f},
-std::array<float,2>{0.591235459f, 0.786379039f},
-std::array<float,2>{0.349211216f, 0.425191015f},
-std::array<float,2>{0.792512238f, 0.492504478f},
-std::array<float,2>{0.0217025299f, 0.823528051f},
-std::array<float,2>{0.645166218f, 0.519066691f},
-std::array<float,2>{0.446166784f, 0.0731232986f},
-std::array<float,2>{0.52810055f, 0.150096759f},
-std::array<float,2>{0.265032023f, 0.65203476f},
-std::array<float,2>{0.9785074f, 0.911926448f},
-std::array<float,2>{0.180915818f, 0.355983675f},
-std::array<float,2>{0.608097255f, 0.329860181f},
-std::array<float,2>{0.328756094f, 0.905206859f},
-std::array<float,2>{0.913381279f, 0.686954916f},
-std::array<float,2>{0.235756546f, 0.167530209f},
-std::array<float,2>{0.85324496f, 0.0994839817f},
-std::array<float,2>{0.122428745f, 0.53652072f},
-std::array<float,2>{0.73753202f, 0.852878571f},
-std::array<float,2>{0.429957509f, 0.455619037f},
-std::array<float,2>{0.94659245f, 0.39494434f},
-std::array<float,2>{0.14739427f, 0.752675474f},
-std::array<float,2>{0.558378577f, 0.565487087f},
-std::array<float,2>{0.302571088f, 0.0580697581f},
-std::array<float,2>{0.660283923f, 0.187756047f},
-std::array<float,2>{0.499166518f, 0.739231646f},
-std::array<float,2>{0.770775139f, 0.982682705f},
-std::array<float,2>{0.0573320128f, 0.281190962f},
-std::array<float,2>{0.711640716f, 0.49075973f},
-std::array<float,2>{0.401305974f, 0.818704844f},
-std::array<float,2>{0.819522381f, 0.526082158f},
-std::array<float,2>{0.0732400864f, 0.0638093129f},
-std::array<float,2>{0.890349925f, 0.142056704f},
-std::array<float,2>{0.203856081f, 0.643481553f},
-std::array<float,2>{0.566002488f, 0.919228673f},
-std::array<float,2>{0.367292404f, 0.34735921f},
-std::array<float,2>{0.811149776f, 0.296807885f},
-std::array<float,2>{0.00837128237f, 0.938431144f},
-std::array<float,2>{0.629693627f, 0.696175456f},
-std::array<float,2>{0.466679096f, 0.228466004f},
-std::array<float,2>{0.500486672f, 0.0144094257f},
-std::array<float,2>{0.268809438f, 0.600352943f},
-std::array<float,2>{0.994666636f, 0.794070601f},
-std::array<float,2>{0.15792197f, 0.436025649f},
-std::array<float,2>{0.5440166f, 0.420552492f},
-std::array<float,2>{0.290831387f, 0.806322217f},
-std::array<float,2>{0.964717984f, 0.610583425f},
-std::array<float,2>{0.126734748f, 0.020175213f},
-std::array<float,2>{0.763535857f, 0.235576987f},
-std::array<float,2>{0.0419897884f, 0.710555911f},
-std::array<float,2>{0.672228575f, 0.954587817f},
-std::array<float,2>{0.472965032f, 0.300033927f},
-std::array<float,2>{0.926359534f, 0.374948889f},
-std::array<float,2>{0.230279014f, 0.924403012f},
-std::array<float,2>{0.617099881f, 0.636689544f},
-std::array<float,2>{0.32257691f, 0.125707239f},
-std::array<float,2>{0.730260432f, 0.0852609649f},
-std::array<float,2>{0.421254963f, 0.512255251f},
-std::array<float,2>{0.859899402f, 0.843366861f},
-std::array<float,2>{0.102680407f, 0.479003936f},
-std::array<float,2>{0.642350554f, 0.252303243f},
-std::array<float,2>{0.451393932f, 0.995881677f},
-std::array<float,2>{0.793677032f, 0.721708238f},
-std::array<float,2>{0.0192285683f, 0.211708516f},
-std::array<float,2>{0.984125376f, 0.0441958122f},
-std::array<float,2>{0.187484995f, 0.582645535f},
-std::array<float,2>{0.523491025f, 0.772194922f},
-std::array<float,2>{0.258964658f, 0.378412187f},
-std::array<float,2>{0.839792848f, 0.443690866f},
-std::array<float,2>{0.0788507462f, 0.863104463f},
-std::array<float,2>{0.699243128f, 0.547924519f},
-std::array<float,2>{0.378385186f, 0.112717539f},
-std::array<float,2>{0.586604476f, 0.187121063f},
-std::array<float,2>{0.347165048f, 0.668616354f},
-std::array<float,2>{0.902086914f, 0.882853091f},
-std::array<float,2>{0.195833206f, 0.320825964f},
-std::array<float,2>{0.516521096f, 0.31119287f},
-std::array<float,2>{0.257538855f, 0.967763245f},
-std::array<float,2>{0.972329795f, 0.71702528f},
-std::array<float,2>{0.173725232f, 0.24662976f},
-std::array<float,2>{0.782783031f, 0.0263214745f},
-std::array<float,2>{0.0295193084f, 0.618181288f},
-std::array<float,2>{0.65415746f, 0.79758662f},
-std::array<float,2>{0.442390174f, 0.410984308f},
-std::array<float,2>{0.894785106f, 0.475015491f},
-std::array<float,2>{0.194846809f, 0.8290025f},
-std::array<float,2>{0.584480524f, 0.506023586f},
-std::array<float,2>{0.358392477f, 0.0894259214f},
-std::array<float,2>{0.689939678f, 0.135900721f},
-std::array<float,2>{0.383433342f, 0.629992247f},
-std::array<float,2>{0.830167174f, 0.929870367f},
-std::array<float,2>{0.0908436403f, 0.362808019f},
-std::array<float,2>{0.68568033f, 0.388883471f},
-std::array<float,2>{0.480236173f, 0.780056119f},
-std::array<float,2>{0.754065275f, 0.591630697f},
-std::array<float,2>{0.0317720212f, 0.0376357324f},
-std::array<float,2>{0.953168869f, 0.205251172f},
-std::array<float,2>{0.13700965f, 0.729272723f},
-std::array<float,2>{0.532298267f, 0.987182438f},
-std::array<float,2>{0.283578336f, 0.258979529f},
-std::array<float,2>{0.873476326f, 0.315939426f},
-std::array<float,2>{0.101157673f, 0.876475751f},
-std::array<float,2>{0.723879099f, 0.659649372f},
-std::array<float,2>{0.41150403f, 0.172643259f},
-std::array<float,2>{0.620303094f, 0.123953208f},
-std::array<float,2>{0.319075763f, 0.558672428f},
-std::array<float,2>{0.935390353f, 0.868905663f},
-std::array<float,2>{0.220583901f, 0.448819846f},
-std::array<float,2>{0.570606351f, 0.467701823f},
-std::array<float,2>{0.366646677f, 0.849069774f},
-std::array<float,2>{0.881995618f, 0.541448295f},
-std::array<float,2>{0.216306016f, 0.108197212f},
-std::array<float,2>{0.821340978f, 0.160824016f},
-std::array<float,2>{0.0639398247f, 0.67755729f},
-std::array<float,2>{0.706978202f, 0.895051539f},
-std::array<float,2>{0.397918701f, 0.340674609f},
-std::array<float,2>{0.99170959f, 0.265659422f},
-std::array<float,2>{0.168661699f, 0.976108491f},
-std::array<float,2>{0.510043502f, 0.748928666f},
-std::array<float,2>{0.278989285f, 0.198073968f},
-std::array<float,2>{0.634432435f, 0.0478021465f},
-std::array<float,2>{0.45712319f, 0.574954867f},
-std::array<float,2>{0.802009463f, 0.764692187f},
-std::array<float,2>{0.000139057651f, 0.406235218f},
-std::array<float,2>{0.742414773f, 0.352111995f},
-std::array<float,2>{0.427455604f, 0.908244967f},
-std::array<float,2>{0.845716298f, 0.655519545f},
-std::array<float,2>{0.114820994f, 0.153970003f},
-std::array<float,2>{0.921736956f, 0.0743947923f},
-std::array<float,2>{0.246360481f, 0.520870209f},
-std::array<float,2>{0.599293351f, 0.825796306f},
-std::array<float,2>{0.343013644f, 0.497584939f},
-std::array<float,2>{0.774368942f, 0.428050011f},
-std::array<float,2>{0.0526579283f, 0.784648001f},
-std::array<float,2>{0.67140013f, 0.603626847f},
-std::array<float,2>{0.490508646f, 0.00675610686f},
-std::array<float,2>{0.550940454f, 0.220639974f},
-std::array<float,2>{0.312378943f, 0.688011169f},
-std::array<float,2>{0.941849589f, 0.945522547f},
-std::array<float,2>{0.153488025f, 0.286034822f},
-std::array<float,2>{0.621311843f, 0.290862262f},
-std::array<float,2>{0.315827012f, 0.944425285f},
-std::array<float,2>{0.930487752f, 0.702244163f},
-std::array<float,2>{0.225638196f, 0.234031022f},
-std::array<float,2>{0.869983554f, 0.00826610811f},
-std::array<float,2>{0.0954378918f, 0.596645057f},
-std::array<float,2>{0.719462693f, 0.792392254f},
-std::array<float,2>{0.407669216f, 0.432185531f},
-std::array<float,2>{0.958615243f, 0.485764176f},
-std::array<float,2>{0.136561513f, 0.816377997f},
-std::array<float,2>{0.535774887f, 0.530152857f},
-std::array<float,2>{0.285722435f, 0.0673757493f},
-std::array<float,2>{0.683050096f, 0.147235945f},
-std::array<float,2>{0.481431067f, 0.647794306f},
-std::array<float,2>{0.750337303f, 0.916760266f},
-std::array<float,2>{0.036117129f, 0.348164022f},
-std::array<float,2>{0.692387402f, 0.391285479f},
-std::array<float,2>{0.387485206f, 0.754229128f},
-std::array<float,2>{0.835364163f, 0.567879796f},
-std::array<float,2>{0.0877881125f, 0.0614945367f},
-std::array<float,2>{0.894080043f, 0.191607147f},
-std::array<float,2>{0.19069235f, 0.736384034f},
-std::array<float,2>{0.58016628f, 0.978711843f},
-std::array<float,2>{0.352651656f, 0.276265442f},
-std::array<float,2>{0.785377443f, 0.332512736f},
-std::array<float,2>{0.023697095f, 0.898999095f},
-std::array<float,2>{0.649909794f, 0.681113482f},
-std::array<float,2>{0.441301107f, 0.16953826f},
-std::array<float,2>{0.520911038f, 0.0969785452f},
-std::array<float,2>{0.250269711f, 0.531699181f},
-std::array<float,2>{0.973868847f, 0.857379854f},
-std::array<float,2>{0.17865558f, 0.459694386f},
-std::array<float,2>{0.548734248f, 0.441231132f},
-std::array<float,2>{0.304727167f, 0.864552975f},
-std::array<float,2>{0.938347161f, 0.551646948f},
-std::array<float,2>{0.151119024f, 0.116473719f},
-std::array<float,2>{0.777590752f, 0.182146057f},
-std::array<float,2>{0.0469168797f, 0.667209983f},
-std::array<float,2>{0.665650308f, 0.890513718f},
-std::array<float,2>{0.487184584f, 0.325450867f},
-std::array<float,2>{0.917329431f, 0.25464493f},
-std::array<float,2>{0.244167849f, 0.996511638f},
-std::array<float,2>{0.593796194f, 0.725505471f},
-std::array<float,2>{0.338226616f, 0.21708262f},
-std::array<float,2>{0.748374283f, 0.0403977893f},
-std::array<float,2>{0.423882544f, 0.581668913f},
-std::array<float,2>{0.848142564f, 0.769080043f},
-std::array<float,2>{0.111879461f, 0.379368991f},
-std::array<float,2>{0.638477206f, 0.369724065f},
-std::array<float,2>{0.453354418f, 0.927791059f},
-std::array<float,2>{0.799387991f, 0.640572608f},
-std::array<float,2>{0.00559033733f, 0.132791236f},
-std::array<float,2>{0.987256587f, 0.0804175362f},
-std::array<float,2>{0.167239919f, 0.508929193f},
-std::array<float,2>{0.512907922f, 0.838516414f},
-std::array<float,2>{0.275192559f, 0.480579972f},
-std::array<float,2>{0.827512681f, 0.416978329f},
-std::array<float,2>{0.0677363649f, 0.810227692f},
-std::array<float,2>{0.707171738f, 0.615636528f},
-std::array<float,2>{0.393911988f, 0.0168750696f},
-std::array<float,2>{0.574364543f, 0.238589868f},
-std::array<float,2>{0.361393481f, 0.703938961f},
-std::array<float,2>{0.878286183f, 0.96002847f},
-std::array<float,2>{0.211787775f, 0.304636985f},
-std::array<float,2>{0.505834579f, 0.31865558f},
-std::array<float,2>{0.270792931f, 0.879439473f},
-std::array<float,2>{0.999314368f, 0.660782218f},
-std::array<float,2>{0.160691902f, 0.178991094f},
-std::array<float,2>{0.808448195f, 0.117812946f},
-std::array<float,2>{0.0142300678f, 0.557651877f},
-std::array<float,2>{0.625792563f, 0.873093545f},
-std::array<float,2>{0.461856335f, 0.449358433f},
-std::array<float,2>{0.882935107f, 0.385420084f},
-std::array<float,2>{0.208294928f, 0.776596189f},
-std::array<float,2>{0.569186807f, 0.587538481f},
-std::array<float,2>{0.373862416f, 0.0313130543f},
-std::array<float,2>{0.714930296f, 0.209233806f},
-std::array<float,2>{0.403527945f, 0.732242465f},
-std::array<float,2>{0.816320777f, 0.99178046f},
-std::array<float,2>{0.0764545873f, 0.263359636f},
-std::array<float,2>{0.658678234f, 0.469950408f},
-std::array<float,2>{0.493800819f, 0.833071172f},
-std::array<float,2>{0.766712368f, 0.501007259f},
-std::array<float,2>{0.060967654f, 0.0909728408f},
-std::array<float,2>{0.949785471f, 0.137719408f},
-std::array<float,2>{0.140797913f, 0.628493369f},
-std::array<float,2>{0.560724914f, 0.935683131f},
-std::array<float,2>{0.299224049f, 0.363860637f},
-std::array<float,2>{0.855899155f, 0.307334691f},
-std::array<float,2>{0.117934227f, 0.961560428f},
-std::array<float,2>{0.740309477f, 0.71180737f},
-std::array<float,2>{0.437253654f, 0.24265182f},
-std::array<float,2>{0.604455471f, 0.0300827343f},
-std::array<float,2>{0.335672379f, 0.622413814f},
-std::array<float,2>{0.906885087f, 0.803098023f},
-std::array<float,2>{0.238352552f, 0.408843011f},
-std::array<float,2>{0.592509985f, 0.421876699f},
-std::array<float,2>{0.349677324f, 0.787142277f},
-std::array<float,2>{0.903029203f, 0.605960131f},
-std::array<float,2>{0.20017451f, 0.00363117852f},
-std::array<float,2>{0.843169034f, 0.224384248f},
-std::array<float,2>{0.083519496f, 0.691936433f},
-std::array<float,2>{0.695940971f, 0.952326119f},
-std::array<float,2>{0.380715162f, 0.282177746f},
-std::array<float,2>{0.979116082f, 0.359212607f},
-std::array<float,2>{0.182976067f, 0.912738323f},
-std::array<float,2>{0.530625403f, 0.649754941f},
-std::array<float,2>{0.263178468f, 0.152017623f},
-std::array<float,2>{0.648177385f, 0.0708840638f},
-std::array<float,2>{0.447329968f, 0.516366184f},
-std::array<float,2>{0.789759457f, 0.820686817f},
-std::array<float,2>{0.0211435016f, 0.496038109f},
-std::array<float,2>{0.731406868f, 0.271398783f},
-std::array<float,2>{0.416726112f, 0.968854427f},
-std::array<float,2>{0.863770425f, 0.744038641f},
-std::array<float,2>{0.10867703f, 0.202385306f},
-std::array<float,2>{0.924473107f, 0.0546502247f},
-std::array<float,2>{0.23068963f, 0.573157251f},
-std::array<float,2>{0.609807193f, 0.758022487f},
-std::array<float,2>{0.324484617f, 0.401950181f},
-std::array<float,2>{0.75786984f, 0.464211494f},
-std::array<float,2>{0.0450124778f, 0.84423548f},
-std::array<float,2>{0.678540587f, 0.546084404f},
-std::array<float,2>{0.46975112f, 0.103534095f},
-std::array<float,2>{0.53916049f, 0.158972487f},
-std::array<float,2>{0.293095559f, 0.675134361f},
-std::array<float,2>{0.964969456f, 0.89340353f},
-std::array<float,2>{0.130077899f, 0.337442666f},
-std::array<float,2>{0.564262927f, 0.345185369f},
-std::array<float,2>{0.370068789f, 0.921700656f},
-std::array<float,2>{0.886734307f, 0.642167151f},
-std::array<float,2>{0.205393165f, 0.142790928f},
-std::array<float,2>{0.816716552f, 0.0645753443f},
-std::array<float,2>{0.0714877322f, 0.523571432f},
-std::array<float,2>{0.714349449f, 0.816925883f},
-std::array<float,2>{0.399499834f, 0.489607006f},
-std::array<float,2>{0.992409885f, 0.434739441f},
-std::array<float,2>{0.159658164f, 0.794965744f},
-std::array<float,2>{0.502122879f, 0.598327875f},
-std::array<float,2>{0.266626805f, 0.0124077313f},
-std::array<float,2>{0.631183982f, 0.229677469f},
-std::array<float,2>{0.467953235f, 0.698228419f},
-std::array<float,2>{0.810024858f, 0.940956593f},
-std::array<float,2>{0.0100571318f, 0.294462651f},
-std::array<float,2>{0.735956013f, 0.453309566f},
-std::array<float,2>{0.432381719f, 0.854309201f},
-std::array<float,2>{0.854527295f, 0.538865268f},
-std::array<float,2>{0.124742784f, 0.100441478f},
-std::array<float,2>{0.912017167f, 0.165557772f},
-std::array<float,2>{0.23744829f, 0.685222983f},
-std::array<float,2>{0.606562018f, 0.903964639f},
-std::array<float,2>{0.330705166f, 0.330686688f},
-std::array<float,2>{0.772209167f, 0.277893275f},
-std::array<float,2>{0.0547083542f, 0.980843306f},
-std::array<float,2>{0.662745535f, 0.742030084f},
-std::array<float,2>{0.497875392f, 0.190681309f},
-std::array<float,2>{0.554985046f, 0.0560503863f},
-std::array<float,2>{0.304324925f, 0.563921988f},
-std::array<float,2>{0.948232114f, 0.750999212f},
-std::array<float,2>{0.145422682f, 0.398400754f},
-std::array<float,2>{0.526067972f, 0.37543413f},
-std::array<float,2>{0.261150837f, 0.770174503f},
-std::array<float,2>{0.981358826f, 0.585359514f},
-std::array<float,2>{0.184769362f, 0.0462526046f},
-std::array<float,2>{0.795134902f, 0.213294283f},
-std::array<float,2>{0.0167075973f, 0.720127881f},
-std::array<float,2>{0.64413017f, 0.993692696f},
-std::array<float,2>{0.449396402f, 0.250028193f},
-std::array<float,2>{0.899846613f, 0.322812825f},
-std::array<float,2>{0.197962344f, 0.885564566f},
-std::array<float,2>{0.588060081f, 0.670009017f},
-std::array<float,2>{0.345040381f, 0.184704974f},
-std::array<float,2>{0.702093601f, 0.110223562f},
-std::array<float,2>{0.375997573f, 0.549869001f},
-std::array<float,2>{0.836124837f, 0.861306012f},
-std::array<float,2>{0.0814393982f, 0.442596883f},
-std::array<float,2>{0.674004853f, 0.297472179f},
-std::array<float,2>{0.476098627f, 0.956380904f},
-std::array<float,2>{0.765066504f, 0.707267404f},
-std::array<float,2>{0.0407590941f, 0.237927049f},
-std::array<float,2>{0.962518573f, 0.0216128882f},
-std::array<float,2>{0.127924666f, 0.61295265f},
-std::array<float,2>{0.545036733f, 0.807912707f},
-std::array<float,2>{0.292275161f, 0.418670714f},
-std::array<float,2>{0.863134742f, 0.476787746f},
-std::array<float,2>{0.104563639f, 0.839942336f},
-std::array<float,2>{0.727261126f, 0.514487624f},
-std::array<float,2>{0.419707984f, 0.0824999958f},
-std::array<float,2>{0.613768518f, 0.128355995f},
-std::array<float,2>{0.321228713f, 0.633370817f},
-std::array<float,2>{0.928249717f, 0.922297776f},
-std::array<float,2>{0.227164641f, 0.37157312f},
-std::array<float,2>{0.534772515f, 0.260139555f},
-std::array<float,2>{0.281842858f, 0.98613596f},
-std::array<float,2>{0.956980407f, 0.727127254f},
-std::array<float,2>{0.139502808f, 0.204743311f},
-std::array<float,2>{0.756252825f, 0.0369871818f},
-std::array<float,2>{0.0349115282f, 0.59302783f},
-std::array<float,2>{0.68467319f, 0.778679907f},
-std::array<float,2>{0.477272153f, 0.387044013f},
-std::array<float,2>{0.935716987f, 0.446688831f},
-std::array<float,2>{0.222218066f, 0.869217694f},
-std::array<float,2>{0.618845403f, 0.561061978f},
-std::array<float,2>{0.317653328f, 0.122757867f},
-std::array<float,2>{0.72514534f, 0.175372794f},
-std::array<float,2>{0.412285835f, 0.657042146f},
-std::array<float,2>{0.872547626f, 0.877109945f},
-std::array<float,2>{0.0995530188f, 0.31277439f},
-std::array<float,2>{0.654512107f, 0.413485497f},
-std::array<float,2>{0.444659352f, 0.800780892f},
-std::array<float,2>{0.784552932f, 0.62109077f},
-std::array<float,2>{0.0289528538f, 0.0244886149f},
-std::array<float,2>{0.969968796f, 0.249881834f},
-std::array<float,2>{0.174360424f, 0.716412127f},
-std::array<float,2>{0.519466579f, 0.965675116f},
-std::array<float,2>{0.255818605f, 0.309760511f},
-std::array<float,2>{0.829697251f, 0.360108644f},
-std::array<float,2>{0.0935313031f, 0.932295501f},
-std::array<float,2>{0.689255416f, 0.631632388f},
-std::array<float,2>{0.385375172f, 0.133974403f},
-std::array<float,2>{0.583641291f, 0.0863714218f},
-std::array<float,2>{0.356976777f, 0.505025148f},
-std::array<float,2>{0.898328066f, 0.831070065f},
-std::array<float,2>{0.1932078f, 0.47405085f},
-std::array<float,2>{0.59974426f, 0.498305529f},
-std::array<float,2>{0.340939492f, 0.826250076f},
-std::array<float,2>{0.917992294f, 0.523331881f},
-std::array<float,2>{0.248245761f, 0.0778399184f},
-std::array<float,2>{0.844999433f, 0.155618429f},
-std::array<float,2>{0.115514033f, 0.654014468f},
-std::array<float,2>{0.745215178f, 0.908173263f},
-std::array<float,2>{0.428605318f, 0.354815125f},
-std::array<float,2>{0.945294559f, 0.288089663f},
-std::array<float,2>{0.15551284f, 0.948064148f},
-std::array<float,2>{0.552910924f, 0.690025032f},
-std::array<float,2>{0.309586555f, 0.22084716f},
-std::array<float,2>{0.669131935f, 0.0045050811f},
-std::array<float,2>{0.488543391f, 0.603254616f},
-std::array<float,2>{0.775591373f, 0.781867921f},
-std::array<float,2>{0.0542015284f, 0.426740259f},
-std::array<float,2>{0.703687787f, 0.342435479f},
-std::array<float,2>{0.394715458f, 0.898275495f},
-std::array<float,2>{0.823719978f, 0.679512084f},
-std::array<float,2>{0.0653867498f, 0.162766144f},
-std::array<float,2>{0.879199207f, 0.106502786f},
-std::array<float,2>{0.216816634f, 0.540920854f},
-std::array<float,2>{0.57365936f, 0.849668145f},
-std::array<float,2>{0.364171296f, 0.466185272f},
-std::array<float,2>{0.802921772f, 0.402394295f},
-std::array<float,2>{0.00228757062f, 0.762413979f},
-std::array<float,2>{0.635016978f, 0.577004969f},
-std::array<float,2>{0.460793555f, 0.050269831f},
-std::array<float,2>{0.508197725f, 0.19666566f},
-std::array<float,2>{0.28014794f, 0.746218979f},
-std::array<float,2>{0.989866018f, 0.973423421f},
-std::array<float,2>{0.170738503f, 0.268876702f},
-std::array<float,2>{0.591541946f, 0.281558275f},
-std::array<float,2>{0.348737478f, 0.953069508f},
-std::array<float,2>{0.905100584f, 0.691538572f},
-std::array<float,2>{0.202424854f, 0.223721102f},
-std::array<float,2>{0.839848518f, 0.00313152838f},
-std::array<float,2>{0.0850158259f, 0.605555594f},
-std::array<float,2>{0.698116124f, 0.788051844f},
-std::array<float,2>{0.381178319f, 0.422611505f},
-std::array<float,2>{0.977914512f, 0.49530232f},
-std::array<float,2>{0.181281582f, 0.821105301f},
-std::array<float,2>{0.527521491f, 0.515938282f},
-std::array<float,2>{0.265458316f, 0.0706819221f},
-std::array<float,2>{0.644609749f, 0.151796103f},
-std::array<float,2>{0.445768982f, 0.649906635f},
-std::array<float,2>{0.792190254f, 0.912555754f},
-std::array<float,2>{0.0220911503f, 0.358497709f},
-std::array<float,2>{0.733242095f, 0.401409745f},
-std::array<float,2>{0.414618552f, 0.758323193f},
-std::array<float,2>{0.866464615f, 0.572738707f},
-std::array<float,2>{0.107359476f, 0.0540982634f},
-std::array<float,2>{0.923693657f, 0.202851593f},
-std::array<float,2>{0.232643634f, 0.743217945f},
-std::array<float,2>{0.612487137f, 0.969442129f},
-std::array<float,2>{0.326530665f, 0.270821899f},
-std::array<float,2>{0.761058688f, 0.337073237f},
-std::array<float,2>{0.0430111848f, 0.89265728f},
-std::array<float,2>{0.67670387f, 0.675737679f},
-std::array<float,2>{0.472372979f, 0.158424675f},
-std::array<float,2>{0.541613281f, 0.10423924f},
-std::array<float,2>{0.294984609f, 0.546805739f},
-std::array<float,2>{0.967559159f, 0.84441638f},
-std::array<float,2>{0.132349804f, 0.464696139f},
-std::array<float,2>{0.506637096f, 0.450113952f},
-std::array<float,2>{0.272453159f, 0.873681128f},
-std::array<float,2>{0.997321308f, 0.55812794f},
-std::array<float,2>{0.162528172f, 0.117199846f},
-std::array<float,2>{0.805319667f, 0.179231957f},
-std::array<float,2>{0.0120007265f, 0.660601616f},
-std::array<float,2>{0.628671944f, 0.879266977f},
-std::array<float,2>{0.463700116f, 0.319010764f},
-std::array<float,2>{0.886297822f, 0.262995154f},
-std::array<float,2>{0.210484132f, 0.991376877f},
-std::array<float,2>{0.568010688f, 0.731460214f},
-std::array<float,2>{0.372288138f, 0.209922507f},
-std::array<float,2>{0.718569875f, 0.0318644196f},
-std::array<float,2>{0.405968904f, 0.587267816f},
-std::array<float,2>{0.813934624f, 0.777343273f},
-std::array<float,2>{0.0754195601f, 0.384992629f},
-std::array<float,2>{0.657291293f, 0.363696218f},
-std::array<float,2>{0.494248629f, 0.936468959f},
-std::array<float,2>{0.768353939f, 0.62817359f},
-std::array<float,2>{0.0603536479f, 0.138522997f},
-std::array<float,2>{0.952098548f, 0.0914199799f},
-std::array<float,2>{0.143918574f, 0.501861155f},
-std::array<float,2>{0.559461892f, 0.833742619f},
-std::array<float,2>{0.298730731f, 0.47044915f},
-std::array<float,2>{0.857991576f, 0.408405721f},
-std::array<float,2>{0.12039683f, 0.803321302f},
-std::array<float,2>{0.739662886f, 0.622603357f},
-std::array<float,2>{0.434272587f, 0.0297015421f},
-std::array<float,2>{0.60229528f, 0.242718071f},
-std::array<float,2>{0.33382991f, 0.710987747f},
-std::array<float,2>{0.908412278f, 0.961095929f},
-std::array<float,2>{0.241718799f, 0.306930482f},
-std::array<float,2>{0.549438417f, 0.326142281f},
-std::array<float,2>{0.308291942f, 0.889710903f},
-std::array<float,2>{0.939738035f, 0.667749822f},
-std::array<float,2>{0.148710415f, 0.181968525f},
-std::array<float,2>{0.780562341f, 0.117000557f},
-std::array<float,2>{0.0505340882f, 0.551262021f},
-std::array<float,2>{0.666830003f, 0.864832759f},
-std::array<float,2>{0.485841841f, 0.440792739f},
-std::array<float,2>{0.914591432f, 0.37983942f},
-std::array<float,2>{0.242894232f, 0.768777549f},
-std::array<float,2>{0.5969491f, 0.581270635f},
-std::array<float,2>{0.336837798f, 0.0408501625f},
-std::array<float,2>{0.746832192f, 0.21772559f},
-std::array<float,2>{0.422481596f, 0.72468704f},
-std::array<float,2>{0.851282477f, 0.996788204f},
-std::array<float,2>{0.110620983f, 0.254045337f},
-std::array<float,2>{0.640155256f, 0.481044322f},
-std::array<float,2>{0.456840038f, 0.838219464f},
-std::array<float,2>{0.797852576f, 0.509375393f},
-std::array<float,2>{0.00775502715f, 0.0806821287f},
-std::array<float,2>{0.985358417f, 0.131901637f},
-std::array<float,2>{0.165995911f, 0.639762163f},
-std::array<float,2>{0.514855981f, 0.928651154f},
-std::array<float,2>{0.276815951f, 0.369477034f},
-std::array<float,2>{0.824671984f, 0.303772479f},
-std::array<float,2>{0.0685762763f, 0.960489273f},
-std::array<float,2>{0.710900366f, 0.703266323f},
-std::array<float,2>{0.392222106f, 0.238853484f},
-std::array<float,2>{0.577897966f, 0.017352365f},
-std::array<float,2>{0.36079517f, 0.616024852f},
-std::array<float,2>{0.875353754f, 0.809736729f},
-std::array<float,2>{0.213350102f, 0.416408688f},
-std::array<float,2>{0.624636054f, 0.431683153f},
-std::array<float,2>{0.312985301f, 0.792497993f},
-std::array<float,2>{0.932487249f, 0.596064329f},
-std::array<float,2>{0.224528894f, 0.00872131716f},
-std::array<float,2>{0.86894834f, 0.23364386f},
-std::array<float,2>{0.0967680886f, 0.702817321f},
-std::array<float,2>{0.722474158f, 0.945171654f},
-std::array<float,2>{0.408732057f, 0.290341884f},
-std::array<float,2>{0.9601385f, 0.348010242f},
-std::array<float,2>{0.133341819f, 0.916306973f},
-std::array<float,2>{0.53718698f, 0.648090541f},
-std::array<float,2>{0.287423611f, 0.146667689f},
-std::array<float,2>{0.681443572f, 0.0666151866f},
-std::array<float,2>{0.482614368f, 0.52968806f},
-std::array<float,2>{0.751977384f, 0.815783501f},
-std::array<float,2>{0.0380031541f, 0.486100972f},
-std::array<float,2>{0.695033252f, 0.275705159f},
-std::array<float,2>{0.389135927f, 0.979287446f},
-std::array<float,2>{0.833429098f, 0.737298787f},
-std::array<float,2>{0.0897825062f, 0.191933706f},
-std::array<float,2>{0.892513871f, 0.0606150739f},
-std::array<float,2>{0.187933639f, 0.567503154f},
-std::array<float,2>{0.578354955f, 0.754528999f},
-std::array<float,2>{0.353997767f, 0.390874565f},
-std::array<float,2>{0.788721561f, 0.459337026f},
-std::array<float,2>{0.0263112858f, 0.856510997f},
-std::array<float,2>{0.652298629f, 0.531926572f},
-std::array<float,2>{0.43891418f, 0.0973109156f},
-std::array<float,2>{0.52265656f, 0.169355392f},
-std::array<float,2>{0.253155828f, 0.681552768f},
-std::array<float,2>{0.97527796f, 0.898911655f},
-std::array<float,2>{0.175918311f, 0.332908422f},
-std::array<float,2>{0.599112093f, 0.355354935f},
-std::array<float,2>{0.34371677f, 0.907481253f},
-std::array<float,2>{0.921232045f, 0.653773427f},
-std::array<float,2>{0.246719971f, 0.156107441f},
-std::array<float,2>{0.84640485f, 0.0773574635f},
-std::array<float,2>{0.114490084f, 0.522674441f},
-std::array<float,2>{0.74287039f, 0.82688731f},
-std::array<float,2>{0.426788241f, 0.498751998f},
-std::array<float,2>{0.942329288f, 0.426089734f},
-std::array<float,2>{0.153919876f, 0.781404257f},
-std::array<float,2>{0.551432788f, 0.602973163f},
-std::array<float,2>{0.311573416f, 0.00424540881f},
-std::array<float,2>{0.670999944f, 0.221422732f},
-std::array<float,2>{0.49073562f, 0.689717054f},
-std::array<float,2>{0.773864746f, 0.947465122f},
-std::array<float,2>{0.0519568324f, 0.288807452f},
-std::array<float,2>{0.706117332f, 0.466713458f},
-std::array<float,2>{0.398425668f, 0.850266933f},
-std::array<float,2>{0.82220763f, 0.540149033f},
-std::array<float,2>{0.0642587617f, 0.107324682f},
-std::array<float,2>{0.882416725f, 0.162292168f},
-std::array<float,2>{0.216796145f, 0.678726435f},
-std::array<float,2>{0.57090497f, 0.897919774f},
-std::array<float,2>{0.366955012f, 0.341992706f},
-std::array<float,2>{0.802434564f, 0.269220591f},
-std::array<float,2>{0.000556274317f, 0.972738922f},
-std::array<float,2>{0.633936524f, 0.746935308f},
-std::array<float,2>{0.457974166f, 0.197224557f},
-std::array<float,2>{0.510468364f, 0.0503907613f},
-std::array<float,2>{0.278704345f, 0.576230049f},
-std::array<float,2>{0.991294265f, 0.761797905f},
-std::array<float,2>{0.168449342f, 0.402838409f},
-std::array<float,2>{0.533023715f, 0.38729167f},
-std::array<float,2>{0.283994913f, 0.778865755f},
-std::array<float,2>{0.954030216f, 0.593701303f},
-std::array<float,2>{0.137463406f, 0.036210414f},
-std::array<float,2>{0.754427493f, 0.204237849f},
-std::array<float,2>{0.0313397087f, 0.726846278f},
-std::array<float,2>{0.686408639f, 0.985772848f},
-std::array<float,2>{0.479837894f, 0.26060012f},
-std::array<float,2>{0.9345842f, 0.312990814f},
-std::array<float,2>{0.219834775f, 0.877794683f},
-std::array<float,2>{0.620729625f, 0.656557798f},
-std::array<float,2>{0.318680018f, 0.174935147f},
-std::array<float,2>{0.72441715f, 0.122118503f},
-std::array<float,2>{0.411633015f, 0.560586452f},
-std::array<float,2>{0.87385273f, 0.87001586f},
-std::array<float,2>{0.101011693f, 0.44699353f},
-std::array<float,2>{0.653332174f, 0.310068011f},
-std::array<float,2>{0.443280578f, 0.965236127f},
-std::array<float,2>{0.782654524f, 0.715856373f},
-std::array<float,2>{0.0300091133f, 0.24947314f},
-std::array<float,2>{0.972135723f, 0.0252251867f},
-std::array<float,2>{0.172938153f, 0.620526493f},
-std::array<float,2>{0.515998423f, 0.800236702f},
-std::array<float,2>{0.257247388f, 0.413595378f},
-std::array<float,2>{0.830638945f, 0.474269062f},
-std::array<float,2>{0.0917659849f, 0.831662893f},
-std::array<float,2>{0.690144002f, 0.505678773f},
-std::array<float,2>{0.383066833f, 0.0867210031f},
-std::array<float,2>{0.584056675f, 0.134329215f},
-std::array<float,2>{0.357593805f, 0.631132066f},
-std::array<float,2>{0.895278394f, 0.931954086f},
-std::array<float,2>{0.194402158f, 0.359693319f},
-std::array<float,2>{0.524149895f, 0.250818253f},
-std::array<float,2>{0.259659737f, 0.993553579f},
-std::array<float,2>{0.983671308f, 0.720429718f},
-std::array<float,2>{0.186654806f, 0.213751569f},
-std::array<float,2>{0.793398976f, 0.0466861613f},
-std::array<float,2>{0.0188378841f, 0.585863113f},
-std::array<float,2>{0.641603291f, 0.769899547f},
-std::array<float,2>{0.452116936f, 0.375842363f},
-std::array<float,2>{0.901596546f, 0.443255544f},
-std::array<float,2>{0.195675939f, 0.860448301f},
-std::array<float,2>{0.58601892f, 0.550409973f},
-std::array<float,2>{0.347510189f, 0.109731331f},
-std::array<float,2>{0.699889839f, 0.185177863f},
-std::array<float,2>{0.378791362f, 0.670657873f},
-std::array<float,2>{0.839327395f, 0.885219812f},
-std::array<float,2>{0.078306213f, 0.322369784f},
-std::array<float,2>{0.67252183f, 0.418090671f},
-std::array<float,2>{0.473547935f, 0.808578908f},
-std::array<float,2>{0.762855709f, 0.612424016f},
-std::array<float,2>{0.0410408191f, 0.0224264599f},
-std::array<float,2>{0.963966906f, 0.237321913f},
-std::array<float,2>{0.126244873f, 0.707626462f},
-std::array<float,2>{0.544651926f, 0.956951678f},
-std::array<float,2>{0.290479809f, 0.297123998f},
-std::array<float,2>{0.859655261f, 0.372006893f},
-std::array<float,2>{0.103178419f, 0.922537208f},
-std::array<float,2>{0.729511082f, 0.632940054f},
-std::array<float,2>{0.421683788f, 0.128700629f},
-std::array<float,2>{0.616217136f, 0.0825935006f},
-std::array<float,2>{0.323188186f, 0.513864219f},
-std::array<float,2>{0.925856411f, 0.840750515f},
-std::array<float,2>{0.229885742f, 0.477110118f},
-std::array<float,2>{0.56571728f, 0.489865631f},
-std::array<float,2>{0.367699921f, 0.816824794f},
-std::array<float,2>{0.890010417f, 0.524221241f},
-std::array<float,2>{0.203401178f, 0.0653791428f},
-std::array<float,2>{0.820248067f, 0.143087253f},
-std::array<float,2>{0.0724966154f, 0.641750753f},
-std::array<float,2>{0.711054265f, 0.920933366f},
-std::array<float,2>{0.400734037f, 0.345656455f},
-std::array<float,2>{0.99460119f, 0.29440245f},
-std::array<float,2>{0.157640994f, 0.940772712f},
-std::array<float,2>{0.500758886f, 0.697658598f},
-std::array<float,2>{0.26944676f, 0.230267331f},
-std::array<float,2>{0.629364371f, 0.0119889285f},
-std::array<float,2>{0.466166139f, 0.597689033f},
-std::array<float,2>{0.810825765f, 0.795721173f},
-std::array<float,2>{0.00808832888f, 0.4351345f},
-std::array<float,2>{0.737907827f, 0.330384463f},
-std::array<float,2>{0.430408567f, 0.903504908f},
-std::array<float,2>{0.852834284f, 0.684965312f},
-std::array<float,2>{0.122809857f, 0.165123776f},
-std::array<float,2>{0.913998067f, 0.0999935567f},
-std::array<float,2>{0.236173615f, 0.538240731f},
-std::array<float,2>{0.607650936f, 0.853536367f},
-std::array<float,2>{0.32827279f, 0.454028994f},
-std::array<float,2>{0.771299064f, 0.39754191f},
-std::array<float,2>{0.0569466278f, 0.751935482f},
-std::array<float,2>{0.660793662f, 0.564341843f},
-std::array<float,2>{0.499897212f, 0.0566038117f},
-std::array<float,2>{0.557813525f, 0.19124186f},
-std::array<float,2>{0.301819682f, 0.741513133f},
-std::array<float,2>{0.946818054f, 0.981015265f},
-std::array<float,2>{0.146940261f, 0.277642161f},
-std::array<float,2>{0.609966099f, 0.273356169f},
-std::array<float,2>{0.324954152f, 0.972105682f},
-std::array<float,2>{0.92386204f, 0.744469941f},
-std::array<float,2>{0.231286138f, 0.200388536f},
-std::array<float,2>{0.863537848f, 0.0521234013f},
-std::array<float,2>{0.109301604f, 0.572037399f},
-std::array<float,2>{0.730882347f, 0.760699093f},
-std::array<float,2>{0.416050792f, 0.400346756f},
-std::array<float,2>{0.965756357f, 0.462252825f},
-std::array<float,2>{0.130395502f, 0.847614944f},
-std::array<float,2>{0.539856613f, 0.54405421f},
-std::array<float,2>{0.29373005f, 0.101822443f},
-std::array<float,2>{0.677971959f, 0.157870054f},
-std::array<float,2>{0.470341027f, 0.672057331f},
-std::array<float,2>{0.758378088f, 0.890874326f},
-std::array<float,2>{0.0458538346f, 0.338811636f},
-std::array<float,2>{0.69556123f, 0.425670832f},
-std::array<float,2>{0.380068392f, 0.786768317f},
-std::array<float,2>{0.843272686f, 0.607995272f},
-std::array<float,2>{0.0830120891f, 0.000680013502f},
-std::array<float,2>{0.902581513f, 0.224977285f},
-std::array<float,2>{0.199622631f, 0.69444102f},
-std::array<float,2>{0.591897249f, 0.950728297f},
-std::array<float,2>{0.350099236f, 0.285058975f},
-std::array<float,2>{0.789285958f, 0.355862111f},
-std::array<float,2>{0.0206118952f, 0.911157489f},
-std::array<float,2>{0.647695601f, 0.651446104f},
-std::array<float,2>{0.44818756f, 0.149491444f},
-std::array<float,2>{0.531220734f, 0.0725015104f},
-std::array<float,2>{0.263308734f, 0.518782616f},
-std::array<float,2>{0.97896558f, 0.824022293f},
-std::array<float,2>{0.183565825f, 0.493069351f},
-std::array<float,2>{0.561157644f, 0.470870584f},
-std::array<float,2>{0.299440712f, 0.83426255f},
-std::array<float,2>{0.949436545f, 0.503365636f},
-std::array<float,2>{0.1412047f, 0.0919569284f},
-std::array<float,2>{0.767151654f, 0.140202403f},
-std::array<float,2>{0.061067339f, 0.625808179f},
-std::array<float,2>{0.659136415f, 0.934640229f},
-std::array<float,2>{0.493285596f, 0.366905421f},
-std::array<float,2>{0.906613171f, 0.305577666f},
-std::array<float,2>{0.238983959f, 0.964052022f},
-std::array<float,2>{0.603762805f, 0.713617265f},
-std::array<float,2>{0.335082322f, 0.245405689f},
-std::array<float,2>{0.740846336f, 0.0289071612f},
-std::array<float,2>{0.43662414f, 0.624063134f},
-std::array<float,2>{0.85616225f, 0.802484095f},
-std::array<float,2>{0.117664181f, 0.406449378f},
-std::array<float,2>{0.625218272f, 0.317140669f},
-std::array<float,2>{0.461057752f, 0.882297695f},
-std::array<float,2>{0.807812393f, 0.66340977f},
-std::array<float,2>{0.0141204074f, 0.177206039f},
-std::array<float,2>{0.999518752f, 0.119363971f},
-std::array<float,2>{0.160595655f, 0.555021524f},
-std::array<float,2>{0.505331337f, 0.871387482f},
-std::array<float,2>{0.271342576f, 0.451402545f},
-std::array<float,2>{0.815847516f, 0.383445233f},
-std::array<float,2>{0.0768848658f, 0.774426818f},
-std::array<float,2>{0.715564787f, 0.589572906f},
-std::array<float,2>{0.404205024f, 0.0335580185f},
-std::array<float,2>{0.568756819f, 0.207245007f},
-std::array<float,2>{0.373055935f, 0.734066308f},
-std::array<float,2>{0.883715391f, 0.989568114f},
-std::array<float,2>{0.208549798f, 0.265321761f},
-std::array<float,2>{0.513186276f, 0.36886549f},
-std::array<float,2>{0.27475825f, 0.926303327f},
-std::array<float,2>{0.986621022f, 0.636824369f},
-std::array<float,2>{0.167902961f, 0.130144119f},
-std::array<float,2>{0.799146771f, 0.0783867463f},
-std::array<float,2>{0.0050781155f, 0.510389864f},
-std::array<float,2>{0.638007522f, 0.83787334f},
-std::array<float,2>{0.454087257f, 0.484247327f},
-std::array<float,2>{0.878820062f, 0.414304554f},
-std::array<float,2>{0.211307406f, 0.810648382f},
-std::array<float,2>{0.575080574f, 0.613410711f},
-std::array<float,2>{0.361846834f, 0.0194739513f},
-std::array<float,2>{0.707965851f, 0.241776168f},
-std::array<float,2>{0.394374907f, 0.706962883f},
-std::array<float,2>{0.827806711f, 0.957474113f},
-std::array<float,2>{0.0683286414f, 0.301158428f},
-std::array<float,2>{0.66510421f, 0.438517243f},
-std::array<float,2>{0.486739367f, 0.865788579f},
-std::array<float,2>{0.778285027f, 0.554063022f},
-std::array<float,2>{0.0477520414f, 0.113847315f},
-std::array<float,2>{0.937948704f, 0.180991873f},
-std::array<float,2>{0.150600955f, 0.664488435f},
-std::array<float,2>{0.548221171f, 0.888159573f},
-std::array<float,2>{0.305468142f, 0.326720893f},
-std::array<float,2>{0.848462105f, 0.256847829f},
-std::array<float,2>{0.111418888f, 0.998511732f},
-std::array<float,2>{0.748554528f, 0.722968459f},
-std::array<float,2>{0.424411207f, 0.215915948f},
-std::array<float,2>{0.594599068f, 0.0412609652f},
-std::array<float,2>{0.338731974f, 0.579962611f},
-std::array<float,2>{0.91751188f, 0.76596272f},
-std::array<float,2>{0.245065629f, 0.38234821f},
-std::array<float,2>{0.580688536f, 0.392839283f},
-std::array<float,2>{0.353205979f, 0.75650686f},
-std::array<float,2>{0.89371264f, 0.568983793f},
-std::array<float,2>{0.190977544f, 0.0588855669f},
-std::array<float,2>{0.835894167f, 0.194744244f},
-std::array<float,2>{0.087062031f, 0.736008346f},
-std::array<float,2>{0.692953885f, 0.977059364f},
-std::array<float,2>{0.387135983f, 0.274271339f},
-std::array<float,2>{0.974247456f, 0.335692257f},
-std::array<float,2>{0.177901447f, 0.900764525f},
-std::array<float,2>{0.521415889f, 0.681847632f},
-std::array<float,2>{0.250601798f, 0.171327308f},
-std::array<float,2>{0.649524093f, 0.0943361819f},
-std::array<float,2>{0.440742582f, 0.534507096f},
-std::array<float,2>{0.785921156f, 0.859267533f},
-std::array<float,2>{0.0240382403f, 0.457989812f},
-std::array<float,2>{0.719130695f, 0.292863071f},
-std::array<float,2>{0.40781945f, 0.94197464f},
-std::array<float,2>{0.869414628f, 0.699410021f},
-std::array<float,2>{0.0950328037f, 0.23104015f},
-std::array<float,2>{0.930104017f, 0.0112706181f},
-std::array<float,2>{0.226344794f, 0.594347656f},
-std::array<float,2>{0.622067869f, 0.789577067f},
-std::array<float,2>{0.316081733f, 0.430092663f},
-std::array<float,2>{0.750647545f, 0.487102002f},
-std::array<float,2>{0.0351984017f, 0.813130796f},
-std::array<float,2>{0.683109879f, 0.529072046f},
-std::array<float,2>{0.480718046f, 0.0686982945f},
-std::array<float,2>{0.535282671f, 0.14596051f},
-std::array<float,2>{0.285295099f, 0.645187199f},
-std::array<float,2>{0.958147764f, 0.915042281f},
-std::array<float,2>{0.135872737f, 0.350337505f},
-std::array<float,2>{0.573984802f, 0.340240955f},
-std::array<float,2>{0.363444805f, 0.895018101f},
-std::array<float,2>{0.879505038f, 0.677206337f},
-std::array<float,2>{0.217692733f, 0.160247102f},
-std::array<float,2>{0.823979855f, 0.107800558f},
-std::array<float,2>{0.0646667555f, 0.541740775f},
-std::array<float,2>{0.703240335f, 0.849497616f},
-std::array<float,2>{0.395029157f, 0.467117935f},
-std::array<float,2>{0.989630342f, 0.405399621f},
-std::array<float,2>{0.17037347f, 0.765559912f},
-std::array<float,2>{0.508595884f, 0.574531436f},
-std::array<float,2>{0.279397696f, 0.0470330939f},
-std::array<float,2>{0.635291636f, 0.197621986f},
-std::array<float,2>{0.460243553f, 0.748479366f},
-std::array<float,2>{0.803488135f, 0.975994587f},
-std::array<float,2>{0.00247227214f, 0.266360879f},
-std::array<float,2>{0.745614052f, 0.497469157f},
-std::array<float,2>{0.427954465f, 0.825670838f},
-std::array<float,2>{0.845314801f, 0.521166682f},
-std::array<float,2>{0.115978166f, 0.0747367591f},
-std::array<float,2>{0.918717682f, 0.153347611f},
-std::array<float,2>{0.248806432f, 0.656165361f},
-std::array<float,2>{0.600579679f, 0.908774137f},
-std::array<float,2>{0.341394603f, 0.351735979f},
-std::array<float,2>{0.776141882f, 0.285598248f},
-std::array<float,2>{0.0540117249f, 0.946136177f},
-std::array<float,2>{0.669603169f, 0.687885404f},
-std::array<float,2>{0.489001483f, 0.219797477f},
-std::array<float,2>{0.553480566f, 0.00614932133f},
-std::array<float,2>{0.310398012f, 0.604096413f},
-std::array<float,2>{0.944666624f, 0.785055876f},
-std::array<float,2>{0.155905426f, 0.428248018f},
-std::array<float,2>{0.518555462f, 0.410497785f},
-std::array<float,2>{0.254993141f, 0.797002196f},
-std::array<float,2>{0.970313132f, 0.619024456f},
-std::array<float,2>{0.174008891f, 0.0255167019f},
-std::array<float,2>{0.785069406f, 0.246119738f},
-std::array<float,2>{0.0285789203f, 0.717394352f},
-std::array<float,2>{0.654973328f, 0.967077851f},
-std::array<float,2>{0.444970936f, 0.310894847f},
-std::array<float,2>{0.897649646f, 0.362561375f},
-std::array<float,2>{0.192575604f, 0.930618167f},
-std::array<float,2>{0.583168924f, 0.630752563f},
-std::array<float,2>{0.356585234f, 0.136479303f},
-std::array<float,2>{0.688478053f, 0.0891878605f},
-std::array<float,2>{0.384851724f, 0.506596863f},
-std::array<float,2>{0.829252064f, 0.828547299f},
-std::array<float,2>{0.0931349173f, 0.475289375f},
-std::array<float,2>{0.685262442f, 0.259367675f},
-std::array<float,2>{0.476584494f, 0.986380756f},
-std::array<float,2>{0.756754756f, 0.728865266f},
-std::array<float,2>{0.034579467f, 0.205614835f},
-std::array<float,2>{0.95614922f, 0.0371336788f},
-std::array<float,2>{0.138767242f, 0.591152012f},
-std::array<float,2>{0.534341276f, 0.779312491f},
-std::array<float,2>{0.281619936f, 0.389536649f},
-std::array<float,2>{0.872716963f, 0.448678255f},
-std::array<float,2>{0.0989285409f, 0.868314087f},
-std::array<float,2>{0.724890232f, 0.559141338f},
-std::array<float,2>{0.412757635f, 0.123517357f},
-std::array<float,2>{0.618183196f, 0.171931654f},
-std::array<float,2>{0.318175286f, 0.660025537f},
-std::array<float,2>{0.936325788f, 0.876315236f},
-std::array<float,2>{0.222051084f, 0.315904915f},
-std::array<float,2>{0.545822322f, 0.300520867f},
-std::array<float,2>{0.292806089f, 0.95504427f},
-std::array<float,2>{0.962050974f, 0.710184336f},
-std::array<float,2>{0.127391383f, 0.235977039f},
-std::array<float,2>{0.76534909f, 0.0197130796f},
-std::array<float,2>{0.0402167849f, 0.611181974f},
-std::array<float,2>{0.674732089f, 0.806102514f},
-std::array<float,2>{0.475659966f, 0.420344263f},
-std::array<float,2>{0.927964628f, 0.478931963f},
-std::array<float,2>{0.22699222f, 0.843080103f},
-std::array<float,2>{0.613923371f, 0.512009203f},
-std::array<float,2>{0.320594728f, 0.0858836249f},
-std::array<float,2>{0.726725221f, 0.125331447f},
-std::array<float,2>{0.419147372f, 0.635893881f},
-std::array<float,2>{0.862498224f, 0.924260974f},
-std::array<float,2>{0.104994461f, 0.374035984f},
-std::array<float,2>{0.643885493f, 0.378723681f},
-std::array<float,2>{0.449950516f, 0.77166456f},
-std::array<float,2>{0.795504093f, 0.582336009f},
-std::array<float,2>{0.0174242388f, 0.0448360071f},
-std::array<float,2>{0.98090291f, 0.211334109f},
-std::array<float,2>{0.1852476f, 0.722241938f},
-std::array<float,2>{0.525799692f, 0.995212674f},
-std::array<float,2>{0.261437386f, 0.252553433f},
-std::array<float,2>{0.836494565f, 0.320400178f},
-std::array<float,2>{0.0818572491f, 0.883334994f},
-std::array<float,2>{0.701507568f, 0.66835326f},
-std::array<float,2>{0.3768332f, 0.186552331f},
-std::array<float,2>{0.588683069f, 0.113253213f},
-std::array<float,2>{0.345319748f, 0.548489332f},
-std::array<float,2>{0.899980128f, 0.862631083f},
-std::array<float,2>{0.197740629f, 0.444026589f},
-std::array<float,2>{0.607001781f, 0.455113411f},
-std::array<float,2>{0.330254018f, 0.853103101f},
-std::array<float,2>{0.911541939f, 0.536694169f},
-std::array<float,2>{0.238134235f, 0.0990890563f},
-std::array<float,2>{0.85540998f, 0.16728662f},
-std::array<float,2>{0.124307692f, 0.687459767f},
-std::array<float,2>{0.735812962f, 0.904304266f},
-std::array<float,2>{0.432031304f, 0.329148591f},
-std::array<float,2>{0.947324455f, 0.280307204f},
-std::array<float,2>{0.144711629f, 0.983220279f},
-std::array<float,2>{0.555624068f, 0.738501608f},
-std::array<float,2>{0.303964704f, 0.188153476f},
-std::array<float,2>{0.662470818f, 0.0583902225f},
-std::array<float,2>{0.497444987f, 0.56599772f},
-std::array<float,2>{0.771702945f, 0.752209663f},
-std::array<float,2>{0.0552203804f, 0.39511171f},
-std::array<float,2>{0.714668989f, 0.347052008f},
-std::array<float,2>{0.400382996f, 0.919610739f},
-std::array<float,2>{0.817112565f, 0.642796338f},
-std::array<float,2>{0.0717799142f, 0.142373204f},
-std::array<float,2>{0.887492299f, 0.0644286126f},
-std::array<float,2>{0.205789953f, 0.52560854f},
-std::array<float,2>{0.56377393f, 0.819157064f},
-std::array<float,2>{0.36960575f, 0.490273565f},
-std::array<float,2>{0.810091913f, 0.436074704f},
-std::array<float,2>{0.0103967246f, 0.794516742f},
-std::array<float,2>{0.631704569f, 0.5996719f},
-std::array<float,2>{0.468582302f, 0.0137506202f},
-std::array<float,2>{0.502484679f, 0.227939054f},
-std::array<float,2>{0.267374367f, 0.695335329f},
-std::array<float,2>{0.993121266f, 0.937958598f},
-std::array<float,2>{0.160105497f, 0.29621774f},
-std::array<float,2>{0.56670624f, 0.26374957f},
-std::array<float,2>{0.371700019f, 0.988914192f},
-std::array<float,2>{0.885322988f, 0.733291268f},
-std::array<float,2>{0.209781513f, 0.20864214f},
-std::array<float,2>{0.81282872f, 0.0347524025f},
-std::array<float,2>{0.0750793219f, 0.58866632f},
-std::array<float,2>{0.71765542f, 0.773798764f},
-std::array<float,2>{0.40509668f, 0.384491324f},
-std::array<float,2>{0.996667504f, 0.452663571f},
-std::array<float,2>{0.163176522f, 0.872746885f},
-std::array<float,2>{0.507636905f, 0.555999935f},
-std::array<float,2>{0.273065805f, 0.121002972f},
-std::array<float,2>{0.627264977f, 0.176422805f},
-std::array<float,2>{0.464666426f, 0.662971854f},
-std::array<float,2>{0.806355119f, 0.881306231f},
-std::array<float,2>{0.0128490981f, 0.317718118f},
-std::array<float,2>{0.739193976f, 0.408002287f},
-std::array<float,2>{0.435293406f, 0.801030636f},
-std::array<float,2>{0.858504653f, 0.623876691f},
-std::array<float,2>{0.119696729f, 0.0273723546f},
-std::array<float,2>{0.909285307f, 0.244576514f},
-std::array<float,2>{0.240567192f, 0.714296579f},
-std::array<float,2>{0.60329026f, 0.963097274f},
-std::array<float,2>{0.33234784f, 0.306427062f},
-std::array<float,2>{0.768593192f, 0.365277916f},
-std::array<float,2>{0.0590595305f, 0.933835745f},
-std::array<float,2>{0.656367779f, 0.626194835f},
-std::array<float,2>{0.495561868f, 0.138746843f},
-std::array<float,2>{0.560266912f, 0.0929507539f},
-std::array<float,2>{0.297418326f, 0.502220571f},
-std::array<float,2>{0.95263803f, 0.83589083f},
-std::array<float,2>{0.143287256f, 0.47186166f},
-std::array<float,2>{0.529180944f, 0.493593484f},
-std::array<float,2>{0.264274478f, 0.823199451f},
-std::array<float,2>{0.977508307f, 0.518444777f},
-std::array<float,2>{0.18020308f, 0.0741679147f},
-std::array<float,2>{0.791807592f, 0.148884267f},
-std::array<float,2>{0.0226193909f, 0.651176274f},
-std::array<float,2>{0.645610392f, 0.910963595f},
-std::array<float,2>{0.446471721f, 0.356640965f},
-std::array<float,2>{0.905403018f, 0.283521861f},
-std::array<float,2>{0.201429591f, 0.949901283f},
-std::array<float,2>{0.590513229f, 0.693680823f},
-std::array<float,2>{0.348015726f, 0.226068735f},
-std::array<float,2>{0.699024975f, 0.00164605374f},
-std::array<float,2>{0.381964386f, 0.608433127f},
-std::array<float,2>{0.841051698f, 0.785883188f},
-std::array<float,2>{0.0842252076f, 0.424043745f},
-std::array<float,2>{0.677006662f, 0.339068323f},
-std::array<float,2>{0.471397251f, 0.892065883f},
-std::array<float,2>{0.759935141f, 0.672956109f},
-std::array<float,2>{0.0440977477f, 0.156570524f},
-std::array<float,2>{0.968220472f, 0.10283526f},
-std::array<float,2>{0.131505162f, 0.54379487f},
-std::array<float,2>{0.542481184f, 0.846164048f},
-std::array<float,2>{0.295976996f, 0.461498469f},
-std::array<float,2>{0.865845084f, 0.398709178f},
-std::array<float,2>{0.106307603f, 0.761401057f},
-std::array<float,2>{0.733406007f, 0.570959747f},
-std::array<float,2>{0.415149003f, 0.0510009304f},
-std::array<float,2>{0.611785173f, 0.199425295f},
-std::array<float,2>{0.327406704f, 0.745981097f},
-std::array<float,2>{0.92279166f, 0.970960915f},
-std::array<float,2>{0.234253436f, 0.272388071f},
-std::array<float,2>{0.538157344f, 0.350832731f},
-std::array<float,2>{0.288481295f, 0.914451659f},
-std::array<float,2>{0.959221363f, 0.646484137f},
-std::array<float,2>{0.134650409f, 0.145119622f},
-std::array<float,2>{0.75368619f, 0.0698458105f},
-std::array<float,2>{0.0385044776f, 0.52827692f},
-std::array<float,2>{0.679968774f, 0.814313531f},
-std::array<float,2>{0.483944058f, 0.488116264f},
-std::array<float,2>{0.932997942f, 0.431415886f},
-std::array<float,2>{0.223478913f, 0.790774226f},
-std::array<float,2>{0.623464763f, 0.59563297f},
-std::array<float,2>{0.313487381f, 0.0102872625f},
-std::array<float,2>{0.721607208f, 0.231594145f},
-std::array<float,2>{0.409561932f, 0.701080739f},
-std::array<float,2>{0.868039906f, 0.942939997f},
-std::array<float,2>{0.0963552967f, 0.2919873f},
-std::array<float,2>{0.651183486f, 0.458197027f},
-std::array<float,2>{0.437510043f, 0.857868671f},
-std::array<float,2>{0.787223697f, 0.5341205f},
-std::array<float,2>{0.0270622782f, 0.0956540853f},
-std::array<float,2>{0.975601912f, 0.170600906f},
-std::array<float,2>{0.176794797f, 0.683021009f},
-std::array<float,2>{0.521505058f, 0.901650727f},
-std::array<float,2>{0.252275318f, 0.334567726f},
-std::array<float,2>{0.833006561f, 0.274654418f},
-std::array<float,2>{0.0884925723f, 0.978396535f},
-std::array<float,2>{0.693912566f, 0.734637022f},
-std::array<float,2>{0.389753193f, 0.193964511f},
-std::array<float,2>{0.579271436f, 0.0600620434f},
-std::array<float,2>{0.355372071f, 0.570261955f},
-std::array<float,2>{0.891568065f, 0.756972373f},
-std::array<float,2>{0.18885909f, 0.394484878f},
-std::array<float,2>{0.596158564f, 0.381467819f},
-std::array<float,2>{0.337630481f, 0.767068982f},
-std::array<float,2>{0.915974021f, 0.57877636f},
-std::array<float,2>{0.244092911f, 0.042783998f},
-std::array<float,2>{0.850040674f, 0.21495156f},
-std::array<float,2>{0.110291488f, 0.724191248f},
-std::array<float,2>{0.747347593f, 0.999527633f},
-std::array<float,2>{0.422956407f, 0.256329805f},
-std::array<float,2>{0.940809429f, 0.327519864f},
-std::array<float,2>{0.150306374f, 0.887139678f},
-std::array<float,2>{0.549879014f, 0.665719867f},
-std::array<float,2>{0.307285249f, 0.180569172f},
-std::array<float,2>{0.667419851f, 0.115110129f},
-std::array<float,2>{0.485036612f, 0.553001881f},
-std::array<float,2>{0.78018558f, 0.867166817f},
-std::array<float,2>{0.0491320975f, 0.437761396f},
-std::array<float,2>{0.709120691f, 0.302130848f},
-std::array<float,2>{0.391353428f, 0.958627403f},
-std::array<float,2>{0.825723231f, 0.705618799f},
-std::array<float,2>{0.070010893f, 0.240892634f},
-std::array<float,2>{0.876359522f, 0.0176782887f},
-std::array<float,2>{0.214313969f, 0.615095139f},
-std::array<float,2>{0.576560736f, 0.811686635f},
-std::array<float,2>{0.360010833f, 0.415860146f},
-std::array<float,2>{0.797484934f, 0.483392596f},
-std::array<float,2>{0.00677639712f, 0.83642745f},
-std::array<float,2>{0.638821065f, 0.511557877f},
-std::array<float,2>{0.455524534f, 0.0796446875f},
-std::array<float,2>{0.514123499f, 0.129311517f},
-std::array<float,2>{0.276027769f, 0.638042033f},
-std::array<float,2>{0.984701335f, 0.927168429f},
-std::array<float,2>{0.16414775f, 0.367291242f},
-std::array<float,2>{0.620050192f, 0.314786822f},
-std::array<float,2>{0.31957528f, 0.875848711f},
-std::array<float,2>{0.933907688f, 0.658670187f},
-std::array<float,2>{0.21913068f, 0.173357949f},
-std::array<float,2>{0.874878347f, 0.124873355f},
-std::array<float,2>{0.10050191f, 0.560426474f},
-std::array<float,2>{0.723496974f, 0.867335975f},
-std::array<float,2>{0.411023378f, 0.448209524f},
-std::array<float,2>{0.954719484f, 0.390568465f},
-std::array<float,2>{0.138400972f, 0.78070271f},
-std::array<float,2>{0.531675458f, 0.590018094f},
-std::array<float,2>{0.284971386f, 0.0382314846f},
-std::array<float,2>{0.687165797f, 0.206557065f},
-std::array<float,2>{0.479217023f, 0.729516745f},
-std::array<float,2>{0.755083501f, 0.987941086f},
-std::array<float,2>{0.032612063f, 0.257993191f},
-std::array<float,2>{0.691308916f, 0.476234555f},
-std::array<float,2>{0.384694546f, 0.829797566f},
-std::array<float,2>{0.831812203f, 0.507013321f},
-std::array<float,2>{0.0905951858f, 0.0878932327f},
-std::array<float,2>{0.896246731f, 0.135171875f},
-std::array<float,2>{0.193664879f, 0.62915504f},
-std::array<float,2>{0.585685432f, 0.931591988f},
-std::array<float,2>{0.358669966f, 0.361883283f},
-std::array<float,2>{0.781606138f, 0.311601937f},
-std::array<float,2>{0.0308467876f, 0.96858716f},
-std::array<float,2>{0.653097868f, 0.718190491f},
-std::array<float,2>{0.441738665f, 0.24737747f},
-std::array<float,2>{0.516905844f, 0.0272716265f},
-std::array<float,2>{0.256642342f, 0.617527306f},
-std::array<float,2>{0.971663654f, 0.798137844f},
-std::array<float,2>{0.172431931f, 0.411662698f},
-std::array<float,2>{0.552158773f, 0.42931062f},
-std::array<float,2>{0.310646981f, 0.783466697f},
-std::array<float,2>{0.942491174f, 0.604959309f},
-std::array<float,2>{0.152574658f, 0.00711750938f},
-std::array<float,2>{0.775026977f, 0.218979239f},
-std::array<float,2>{0.051532086f, 0.688596249f},
-std::array<float,2>{0.670456231f, 0.946652234f},
-std::array<float,2>{0.49142161f, 0.286652952f},
-std::array<float,2>{0.920029521f, 0.352802515f},
-std::array<float,2>{0.247719407f, 0.9092924f},
-std::array<float,2>{0.598122895f, 0.654752851f},
-std::array<float,2>{0.342758358f, 0.152759552f},
-std::array<float,2>{0.74367547f, 0.0757465139f},
-std::array<float,2>{0.426095188f, 0.520142019f},
-std::array<float,2>{0.847052932f, 0.824786365f},
-std::array<float,2>{0.113941297f, 0.496103525f},
-std::array<float,2>{0.633647799f, 0.266842216f},
-std::array<float,2>{0.458031893f, 0.975390136f},
-std::array<float,2>{0.800784767f, 0.749337018f},
-std::array<float,2>{0.00119354227f, 0.198775038f},
-std::array<float,2>{0.990267396f, 0.0488111675f},
-std::array<float,2>{0.168992653f, 0.5755862f},
-std::array<float,2>{0.511262178f, 0.764173865f},
-std::array<float,2>{0.277739257f, 0.404302984f},
-std::array<float,2>{0.821101665f, 0.468105376f},
-std::array<float,2>{0.0629555881f, 0.848562479f},
-std::array<float,2>{0.705252051f, 0.542645812f},
-std::array<float,2>{0.396999121f, 0.108746864f},
-std::array<float,2>{0.571661592f, 0.162054345f},
-std::array<float,2>{0.365474582f, 0.676442981f},
-std::array<float,2>{0.881682634f, 0.895556986f},
-std::array<float,2>{0.215237707f, 0.341512889f},
-std::array<float,2>{0.50138557f, 0.295123428f},
-std::array<float,2>{0.26779744f, 0.939189017f},
-std::array<float,2>{0.995860636f, 0.696976244f},
-std::array<float,2>{0.156366169f, 0.226851165f},
-std::array<float,2>{0.811929405f, 0.0150676472f},
-std::array<float,2>{0.00969918817f, 0.601298153f},
-std::array<float,2>{0.630822361f, 0.793870926f},
-std::array<float,2>{0.465340018f, 0.437274694f},
-std::array<float,2>{0.889609158f, 0.491570234f},
-std::array<float,2>{0.204615057f, 0.819750667f},
-std::array<float,2>{0.565051496f, 0.527060747f},
-std::array<float,2>{0.368189454f, 0.0630290061f},
-std::array<float,2>{0.712006509f, 0.141251773f},
-std::array<float,2>{0.401973009f, 0.64444977f},
-std::array<float,2>{0.818510294f, 0.917970836f},
-std::array<float,2>{0.0733939558f, 0.346431285f},
-std::array<float,2>{0.661904693f, 0.395805478f},
-std::array<float,2>{0.498483419f, 0.753648818f},
-std::array<float,2>{0.770412028f, 0.564934134f},
-std::array<float,2>{0.0582582131f, 0.0573781766f},
-std::array<float,2>{0.945532084f, 0.189334393f},
-std::array<float,2>{0.147545025f, 0.739350617f},
-std::array<float,2>{0.557049096f, 0.984152675f},
-std::array<float,2>{0.301443964f, 0.279959768f},
-std::array<float,2>{0.85169369f, 0.328463048f},
-std::array<float,2>{0.121109024f, 0.90537101f},
-std::array<float,2>{0.737233579f, 0.686477184f},
-std::array<float,2>{0.430768013f, 0.166772544f},
-std::array<float,2>{0.609048843f, 0.0980021358f},
-std::array<float,2>{0.329809606f, 0.53583169f},
-std::array<float,2>{0.912203193f, 0.852310598f},
-std::array<float,2>{0.234829202f, 0.456911325f},
-std::array<float,2>{0.587539136f, 0.44506076f},
-std::array<float,2>{0.34646681f, 0.861475527f},
-std::array<float,2>{0.900939286f, 0.547542989f},
-std::array<float,2>{0.196632922f, 0.111896485f},
-std::array<float,2>{0.838014185f, 0.186227471f},
-std::array<float,2>{0.080033876f, 0.669625461f},
-std::array<float,2>{0.70108068f, 0.884056389f},
-std::array<float,2>{0.377327293f, 0.32175532f},
-std::array<float,2>{0.982717991f, 0.253575891f},
-std::array<float,2>{0.186249524f, 0.994145572f},
-std::array<float,2>{0.525003612f, 0.721278131f},
-std::array<float,2>{0.258298397f, 0.212404758f},
-std::array<float,2>{0.640685618f, 0.0432622582f},
-std::array<float,2>{0.452425003f, 0.583812535f},
-std::array<float,2>{0.794221699f, 0.772629857f},
-std::array<float,2>{0.0185147952f, 0.377639294f},
-std::array<float,2>{0.729226589f, 0.373109221f},
-std::array<float,2>{0.420712739f, 0.92521733f},
-std::array<float,2>{0.86073643f, 0.63511759f},
-std::array<float,2>{0.102274358f, 0.126931086f},
-std::array<float,2>{0.927698195f, 0.0840524435f},
-std::array<float,2>{0.228969008f, 0.513450742f},
-std::array<float,2>{0.615601063f, 0.841988683f},
-std::array<float,2>{0.323531628f, 0.48042196f},
-std::array<float,2>{0.762637436f, 0.421858162f},
-std::array<float,2>{0.0429621376f, 0.805283308f},
-std::array<float,2>{0.673406482f, 0.609459817f},
-std::array<float,2>{0.474324912f, 0.0206440333f},
-std::array<float,2>{0.543755352f, 0.234616607f},
-std::array<float,2>{0.289239705f, 0.709544897f},
-std::array<float,2>{0.963704765f, 0.953562558f},
-std::array<float,2>{0.12558344f, 0.298843026f},
-std::array<float,2>{0.604840338f, 0.308586448f},
-std::array<float,2>{0.334512889f, 0.962777138f},
-std::array<float,2>{0.908040524f, 0.712784767f},
-std::array<float,2>{0.239344731f, 0.243184835f},
-std::array<float,2>{0.856487632f, 0.030477237f},
-std::array<float,2>{0.118677974f, 0.621662557f},
-std::array<float,2>{0.741687834f, 0.804283202f},
-std::array<float,2>{0.435911983f, 0.409617513f},
-std::array<float,2>{0.950866342f, 0.469473153f},
-std::array<float,2>{0.142480463f, 0.832987368f},
-std::array<float,2>{0.56167078f, 0.500440955f},
-std::array<float,2>{0.300266832f, 0.0900906995f},
-std::array<float,2>{0.659595668f, 0.136968628f},
-std::array<float,2>{0.492204726f, 0.627728999f},
-std::array<float,2>{0.765711725f, 0.937135339f},
-std::array<float,2>{0.0621606484f, 0.364432782f},
-std::array<float,2>{0.716469347f, 0.386501074f},
-std::array<float,2>{0.403277814f, 0.77588743f},
-std::array<float,2>{0.815299869f, 0.58599788f},
-std::array<float,2>{0.0775657594f, 0.0324365422f},
-std::array<float,2>{0.884322643f, 0.210530311f},
-std::array<float,2>{0.20756416f, 0.731240869f},
-std::array<float,2>{0.570019007f, 0.990237176f},
-std::array<float,2>{0.374299914f, 0.261850029f},
-std::array<float,2>{0.807429671f, 0.319758117f},
-std::array<float,2>{0.0155886412f, 0.879917324f},
-std::array<float,2>{0.626308322f, 0.661958754f},
-std::array<float,2>{0.462245405f, 0.178268626f},
-std::array<float,2>{0.50440532f, 0.118893757f},
-std::array<float,2>{0.269943357f, 0.556922913f},
-std::array<float,2>{0.998657107f, 0.874287009f},
-std::array<float,2>{0.161768779f, 0.450927526f},
-std::array<float,2>{0.540679336f, 0.46366486f},
-std::array<float,2>{0.294280142f, 0.845171869f},
-std::array<float,2>{0.966142595f, 0.545074582f},
-std::array<float,2>{0.129635409f, 0.105237827f},
-std::array<float,2>{0.759350121f, 0.160036802f},
-std::array<float,2>{0.0462761298f, 0.674584389f},
-std::array<float,2>{0.679495156f, 0.894283891f},
-std::array<float,2>{0.469493181f, 0.336159706f},
-std::array<float,2>{0.92551142f, 0.270238221f},
-std::array<float,2>{0.231468603f, 0.970425844f},
-std::array<float,2>{0.611089826f, 0.74244374f},
-std::array<float,2>{0.325618148f, 0.201465473f},
-std::array<float,2>{0.732001185f, 0.0533406623f},
-std::array<float,2>{0.417213827f, 0.573362052f},
-std::array<float,2>{0.865068674f, 0.759617925f},
-std::array<float,2>{0.108348556f, 0.400735825f},
-std::array<float,2>{0.647061229f, 0.357878745f},
-std::array<float,2>{0.448476434f, 0.913185f},
-std::array<float,2>{0.790553093f, 0.648655772f},
-std::array<float,2>{0.0200892072f, 0.150978759f},
-std::array<float,2>{0.980290711f, 0.0716110095f},
-std::array<float,2>{0.182227403f, 0.517222941f},
-std::array<float,2>{0.529304445f, 0.822198808f},
-std::array<float,2>{0.262619644f, 0.494879544f},
-std::array<float,2>{0.842187405f, 0.423227578f},
-std::array<float,2>{0.0825417414f, 0.788415074f},
-std::array<float,2>{0.696916997f, 0.606595397f},
-std::array<float,2>{0.378932059f, 0.00280620973f},
-std::array<float,2>{0.59341228f, 0.223032206f},
-std::array<float,2>{0.350986987f, 0.693129778f},
-std::array<float,2>{0.903383553f, 0.951512098f},
-std::array<float,2>{0.200783238f, 0.282815337f},
-std::array<float,2>{0.520214796f, 0.333858728f},
-std::array<float,2>{0.251879305f, 0.899731874f},
-std::array<float,2>{0.972727835f, 0.680492103f},
-std::array<float,2>{0.179004565f, 0.167983219f},
-std::array<float,2>{0.786912382f, 0.0962975472f},
-std::array<float,2>{0.0252224412f, 0.532285273f},
-std::array<float,2>{0.648721039f, 0.855824888f},
-std::array<float,2>{0.439514786f, 0.460474432f},
-std::array<float,2>{0.892700911f, 0.39174974f},
-std::array<float,2>{0.190276146f, 0.755605817f},
-std::array<float,2>{0.581458151f, 0.566532195f},
-std::array<float,2>{0.35216102f, 0.0620219149f},
-std::array<float,2>{0.69202584f, 0.193173081f},
-std::array<float,2>{0.388607502f, 0.737411261f},
-std::array<float,2>{0.834501565f, 0.979667664f},
-std::array<float,2>{0.0865944773f, 0.277153283f},
-std::array<float,2>{0.682112217f, 0.484587938f},
-std::array<float,2>{0.481785983f, 0.814605236f},
-std::array<float,2>{0.751489043f, 0.53076309f},
-std::array<float,2>{0.0369015671f, 0.0682081878f},
-std::array<float,2>{0.957063138f, 0.148299426f},
-std::array<float,2>{0.134769469f, 0.646850944f},
-std::array<float,2>{0.536984921f, 0.917234421f},
-std::array<float,2>{0.286826432f, 0.348992914f},
-std::array<float,2>{0.870951831f, 0.289263546f},
-std::array<float,2>{0.0943525508f, 0.94349438f},
-std::array<float,2>{0.720558345f, 0.701408565f},
-std::array<float,2>{0.407024384f, 0.233028978f},
-std::array<float,2>{0.622137666f, 0.00939861964f},
-std::array<float,2>{0.314973414f, 0.596683025f},
-std::array<float,2>{0.931037724f, 0.791398048f},
-std::array<float,2>{0.224692792f, 0.433197647f},
-std::array<float,2>{0.575739324f, 0.417691886f},
-std::array<float,2>{0.362423956f, 0.809151351f},
-std::array<float,2>{0.877297461f, 0.617050767f},
-std::array<float,2>{0.212453291f, 0.0157419462f},
-std::array<float,2>{0.826925099f, 0.239986002f},
-std::array<float,2>{0.0668422803f, 0.704213858f},
-std::array<float,2>{0.708592534f, 0.959450066f},
-std::array<float,2>{0.392833292f, 0.303701997f},
-std::array<float,2>{0.987327754f, 0.370956242f},
-std::array<float,2>{0.166500047f, 0.929553688f},
-std::array<float,2>{0.512685597f, 0.638771296f},
-std::array<float,2>{0.273626387f, 0.131032377f},
-std::array<float,2>{0.636728466f, 0.0815839618f},
-std::array<float,2>{0.45484075f, 0.508011997f},
-std::array<float,2>{0.800158381f, 0.83925736f},
-std::array<float,2>{0.00443365192f, 0.481837541f},
-std::array<float,2>{0.749892533f, 0.255093396f},
-std::array<float,2>{0.425436378f, 0.997660995f},
-std::array<float,2>{0.848708272f, 0.725843728f},
-std::array<float,2>{0.113003738f, 0.218682185f},
-std::array<float,2>{0.916554391f, 0.0398544595f},
-std::array<float,2>{0.245430753f, 0.580694854f},
-std::array<float,2>{0.595238745f, 0.768463075f},
-std::array<float,2>{0.339455694f, 0.380186737f},
-std::array<float,2>{0.778546512f, 0.439920396f},
-std::array<float,2>{0.0481881537f, 0.864181757f},
-std::array<float,2>{0.664853215f, 0.55231607f},
-std::array<float,2>{0.487891942f, 0.115365177f},
-std::array<float,2>{0.546903491f, 0.183140054f},
-std::array<float,2>{0.305692852f, 0.666730702f},
-std::array<float,2>{0.938617766f, 0.88911581f},
-std::array<float,2>{0.151747957f, 0.324395537f},
-std::array<float,2>{0.58267051f, 0.360552013f},
-std::array<float,2>{0.356302559f, 0.933176935f},
-std::array<float,2>{0.897203684f, 0.632362425f},
-std::array<float,2>{0.191732779f, 0.133625761f},
-std::array<float,2>{0.828419566f, 0.0872231275f},
-std::array<float,2>{0.092680946f, 0.50418967f},
-std::array<float,2>{0.687641799f, 0.830247879f},
-std::array<float,2>{0.38658765f, 0.47281f},
-std::array<float,2>{0.969348311f, 0.412897497f},
-std::array<float,2>{0.175427854f, 0.799661696f},
-std::array<float,2>{0.518295884f, 0.61948669f},
-std::array<float,2>{0.254599094f, 0.0238884278f},
-std::array<float,2>{0.655453861f, 0.248743936f},
-std::array<float,2>{0.44342646f, 0.715592563f},
-std::array<float,2>{0.783649743f, 0.966741621f},
-std::array<float,2>{0.0278234966f, 0.308908463f},
-std::array<float,2>{0.725716829f, 0.445824862f},
-std::array<float,2>{0.41309607f, 0.870290935f},
-std::array<float,2>{0.87112385f, 0.562028527f},
-std::array<float,2>{0.0982803628f, 0.122064002f},
-std::array<float,2>{0.936587811f, 0.174004227f},
-std::array<float,2>{0.221387327f, 0.657984018f},
-std::array<float,2>{0.617634535f, 0.878287315f},
-std::array<float,2>{0.316442847f, 0.314214945f},
-std::array<float,2>{0.757122517f, 0.260780454f},
-std::array<float,2>{0.0335743949f, 0.984736979f},
-std::array<float,2>{0.683845818f, 0.727663338f},
-std::array<float,2>{0.478019476f, 0.203126013f},
-std::array<float,2>{0.533393681f, 0.0357514247f},
-std::array<float,2>{0.283082694f, 0.592197895f},
-std::array<float,2>{0.955995739f, 0.777384281f},
-std::array<float,2>{0.140337005f, 0.387903363f},
-std::array<float,2>{0.509548426f, 0.403442353f},
-std::array<float,2>{0.281152576f, 0.762780845f},
-std::array<float,2>{0.988725603f, 0.577385724f},
-std::array<float,2>{0.170905635f, 0.048862379f},
-std::array<float,2>{0.804213345f, 0.195509419f},
-std::array<float,2>{0.00317979441f, 0.747096539f},
-std::array<float,2>{0.635942221f, 0.973669291f},
-std::array<float,2>{0.459495813f, 0.268156528f},
-std::array<float,2>{0.880758703f, 0.34309268f},
-std::array<float,2>{0.218590617f, 0.896720052f},
-std::array<float,2>{0.572937608f, 0.678429544f},
-std::array<float,2>{0.364826083f, 0.163256854f},
-std::array<float,2>{0.704849482f, 0.106079131f},
-std::array<float,2>{0.396344543f, 0.5399037f},
-std::array<float,2>{0.823127687f, 0.851503253f},
-std::array<float,2>{0.0662613809f, 0.465261012f},
-std::array<float,2>{0.668132007f, 0.287134141f},
-std::array<float,2>{0.489724398f, 0.948794425f},
-std::array<float,2>{0.777097404f, 0.691168129f},
-std::array<float,2>{0.053281974f, 0.222566634f},
-std::array<float,2>{0.943597436f, 0.00541234482f},
-std::array<float,2>{0.155221164f, 0.602090299f},
-std::array<float,2>{0.554509461f, 0.78231585f},
-std::array<float,2>{0.308710277f, 0.427389324f},
-std::array<float,2>{0.844384491f, 0.499881655f},
-std::array<float,2>{0.116945736f, 0.827548623f},
-std::array<float,2>{0.744896412f, 0.521899521f},
-std::array<float,2>{0.428807288f, 0.0762668923f},
-std::array<float,2>{0.600922048f, 0.155087233f},
-std::array<float,2>{0.339884281f, 0.652819335f},
-std::array<float,2>{0.919035137f, 0.906550467f},
-std::array<float,2>{0.249626651f, 0.354038954f},
-std::array<float,2>{0.55647856f, 0.278521806f},
-std::array<float,2>{0.302910507f, 0.982306004f},
-std::array<float,2>{0.948518991f, 0.740881205f},
-std::array<float,2>{0.146407872f, 0.190226436f},
-std::array<float,2>{0.773435831f, 0.0553857684f},
-std::array<float,2>{0.0561784469f, 0.563317537f},
-std::array<float,2>{0.663357615f, 0.75012809f},
-std::array<float,2>{0.496159106f, 0.3973943f},
-std::array<float,2>{0.91067934f, 0.454737276f},
-std::array<float,2>{0.237282127f, 0.855102658f},
-std::array<float,2>{0.605789721f, 0.537502527f},
-std::array<float,2>{0.331955433f, 0.100813419f},
-std::array<float,2>{0.734696746f, 0.16480884f},
-std::array<float,2>{0.432763427f, 0.684435606f},
-std::array<float,2>{0.853943884f, 0.903002083f},
-std::array<float,2>{0.123941138f, 0.331317723f},
-std::array<float,2>{0.632135689f, 0.43446511f},
-std::array<float,2>{0.466828763f, 0.796147764f},
-std::array<float,2>{0.809120119f, 0.59912169f},
-std::array<float,2>{0.0111456048f, 0.0130113596f},
-std::array<float,2>{0.993240237f, 0.229373857f},
-std::array<float,2>{0.158893064f, 0.698638797f},
-std::array<float,2>{0.503354073f, 0.939750969f},
-std::array<float,2>{0.266133875f, 0.293279409f},
-std::array<float,2>{0.817918181f, 0.343757838f},
-std::array<float,2>{0.0709255636f, 0.920469463f},
-std::array<float,2>{0.713681817f, 0.641088665f},
-std::array<float,2>{0.398627877f, 0.143640086f},
-std::array<float,2>{0.562894821f, 0.0661521778f},
-std::array<float,2>{0.370672673f, 0.525037587f},
-std::array<float,2>{0.888231814f, 0.817958117f},
-std::array<float,2>{0.206259146f, 0.489094883f},
-std::array<float,2>{0.614899516f, 0.478478909f},
-std::array<float,2>{0.32194984f, 0.841682017f},
-std::array<float,2>{0.92871958f, 0.515455723f},
-std::array<float,2>{0.228303537f, 0.0837898478f},
-std::array<float,2>{0.862217367f, 0.127059653f},
-std::array<float,2>{0.10377571f, 0.634197295f},
-std::array<float,2>{0.727797568f, 0.923791647f},
-std::array<float,2>{0.418891907f, 0.3724944f},
-std::array<float,2>{0.961806357f, 0.298719376f},
-std::array<float,2>{0.128629789f, 0.955382764f},
-std::array<float,2>{0.546245813f, 0.70848608f},
-std::array<float,2>{0.291624248f, 0.236447677f},
-std::array<float,2>{0.675740838f, 0.0230696648f},
-std::array<float,2>{0.474841177f, 0.611827195f},
-std::array<float,2>{0.764184713f, 0.806852102f},
-std::array<float,2>{0.0395653136f, 0.419032156f},
-std::array<float,2>{0.702831388f, 0.323697001f},
-std::array<float,2>{0.375688732f, 0.886218131f},
-std::array<float,2>{0.837079108f, 0.671327829f},
-std::array<float,2>{0.0810539126f, 0.184143409f},
-std::array<float,2>{0.898979306f, 0.111292019f},
-std::array<float,2>{0.198621452f, 0.549179912f},
-std::array<float,2>{0.588937402f, 0.85995698f},
-std::array<float,2>{0.34381181f, 0.442175508f},
-std::array<float,2>{0.796325862f, 0.376649648f},
-std::array<float,2>{0.0164289325f, 0.770546138f},
-std::array<float,2>{0.64310509f, 0.584912598f},
-std::array<float,2>{0.45024839f, 0.0458552502f},
-std::array<float,2>{0.527303815f, 0.214364782f},
-std::array<float,2>{0.259816736f, 0.719064593f},
-std::array<float,2>{0.981830657f, 0.992619753f},
-std::array<float,2>{0.183859527f, 0.251443267f},
-std::array<float,2>{0.565241814f, 0.294762433f},
-std::array<float,2>{0.368527949f, 0.941169202f},
-std::array<float,2>{0.889368951f, 0.697966933f},
-std::array<float,2>{0.204907551f, 0.229751185f},
-std::array<float,2>{0.818669856f, 0.0126777813f},
-std::array<float,2>{0.073510699f, 0.59856981f},
-std::array<float,2>{0.712351382f, 0.795217574f},
-std::array<float,2>{0.402215272f, 0.434976041f},
-std::array<float,2>{0.995738268f, 0.489409953f},
-std::array<float,2>{0.156696573f, 0.817307293f},
-std::array<float,2>{0.501030564f, 0.52371186f},
-std::array<float,2>{0.267826021f, 0.0648903698f},
-std::array<float,2>{0.6305269f, 0.143047586f},
-std::array<float,2>{0.465655506f, 0.642432809f},
-std::array<float,2>{0.811585009f, 0.921483994f},
-std::array<float,2>{0.00938676298f, 0.344941705f},
-std::array<float,2>{0.736866713f, 0.398130476f},
-std::array<float,2>{0.430924714f, 0.751280248f},
-std::array<float,2>{0.852017403f, 0.563714683f},
-std::array<float,2>{0.121461272f, 0.0558309518f},
-std::array<float,2>{0.912453771f, 0.190499917f},
-std::array<float,2>{0.234385118f, 0.7418437f},
-std::array<float,2>{0.60935688f, 0.98063904f},
-std::array<float,2>{0.3298994f, 0.278264076f},
-std::array<float,2>{0.770174921f, 0.331003755f},
-std::array<float,2>{0.0583508797f, 0.904252768f},
-std::array<float,2>{0.661751211f, 0.685305476f},
-std::array<float,2>{0.498234302f, 0.165981844f},
-std::array<float,2>{0.556715965f, 0.100319296f},
-std::array<float,2>{0.301721632f, 0.538601696f},
-std::array<float,2>{0.945776165f, 0.854120374f},
-std::array<float,2>{0.147916988f, 0.453427911f},
-std::array<float,2>{0.52537775f, 0.442643911f},
-std::array<float,2>{0.258046776f, 0.860874712f},
-std::array<float,2>{0.982504308f, 0.550249636f},
-std::array<float,2>{0.186332077f, 0.109989226f},
-std::array<float,2>{0.794094265f, 0.185010061f},
-std::array<float,2>{0.0181487091f, 0.67026788f},
-std::array<float,2>{0.640930295f, 0.885270476f},
-std::array<float,2>{0.45237565f, 0.323215485f},
-std::array<float,2>{0.901136339f, 0.250407457f},
-std::array<float,2>{0.196363151f, 0.993950367f},
-std::array<float,2>{0.587781131f, 0.719837606f},
-std::array<float,2>{0.346400619f, 0.213008136f},
-std::array<float,2>{0.700775802f, 0.0460369401f},
-std::array<float,2>{0.377058238f, 0.585040808f},
-std::array<float,2>{0.838214099f, 0.770329297f},
-std::array<float,2>{0.0795950294f, 0.375209659f},
-std::array<float,2>{0.673681021f, 0.371146023f},
-std::array<float,2>{0.474451452f, 0.921886206f},
-std::array<float,2>{0.762311697f, 0.633739114f},
-std::array<float,2>{0.0426385701f, 0.128015697f},
-std::array<float,2>{0.963539958f, 0.0820884481f},
-std::array<float,2>{0.125767812f, 0.51423806f},
-std::array<float,2>{0.543553174f, 0.840288162f},
-std::array<float,2>{0.289472401f, 0.477031589f},
-std::array<float,2>{0.860582471f, 0.418748319f},
-std::array<float,2>{0.102511607f, 0.807760358f},
-std::array<float,2>{0.729306877f, 0.613252044f},
-std::array<float,2>{0.420624346f, 0.0219190046f},
-std::array<float,2>{0.615415215f, 0.238063917f},
-std::array<float,2>{0.323289871f, 0.707452536f},
-std::array<float,2>{0.927256584f, 0.956116438f},
-std::array<float,2>{0.228752345f, 0.297791153f},
-std::array<float,2>{0.531474471f, 0.31261301f},
-std::array<float,2>{0.284797639f, 0.877420545f},
-std::array<float,2>{0.954966605f, 0.656903446f},
-std::array<float,2>{0.138669297f, 0.175605729f},
-std::array<float,2>{0.755206168f, 0.123022214f},
-std::array<float,2>{0.0323002562f, 0.5615201f},
-std::array<float,2>{0.687381327f, 0.869469643f},
-std::array<float,2>{0.479462504f, 0.446373492f},
-std::array<float,2>{0.933801413f, 0.386955619f},
-std::array<float,2>{0.218816608f, 0.778542221f},
-std::array<float,2>{0.619749486f, 0.592862368f},
-std::array<float,2>{0.319659978f, 0.0368016325f},
-std::array<float,2>{0.723342121f, 0.205028862f},
-std::array<float,2>{0.410701782f, 0.727445722f},
-std::array<float,2>{0.874595881f, 0.985868931f},
-std::array<float,2>{0.100280255f, 0.259908408f},
-std::array<float,2>{0.652992964f, 0.473711759f},
-std::array<float,2>{0.441514105f, 0.831422031f},
-std::array<float,2>{0.781431913f, 0.505307734f},
-std::array<float,2>{0.0311851855f, 0.085970588f},
-std::array<float,2>{0.971266925f, 0.134159148f},
-std::array<float,2>{0.172795698f, 0.631417394f},
-std::array<float,2>{0.516783178f, 0.932478368f},
-std::array<float,2>{0.256441355f, 0.36002025f},
-std::array<float,2>{0.831671476f, 0.309979975f},
-std::array<float,2>{0.0903929621f, 0.965527534f},
-std::array<float,2>{0.691091835f, 0.716739535f},
-std::array<float,2>{0.384280503f, 0.249595329f},
-std::array<float,2>{0.585760653f, 0.0246812403f},
-std::array<float,2>{0.358405083f, 0.620645821f},
-std::array<float,2>{0.896030605f, 0.800426185f},
-std::array<float,2>{0.193417236f, 0.413169682f},
-std::array<float,2>{0.597797453f, 0.426465213f},
-std::array<float,2>{0.34250167f, 0.782171845f},
-std::array<float,2>{0.920179486f, 0.603498459f},
-std::array<float,2>{0.247941911f, 0.00487884646f},
-std::array<float,2>{0.846701026f, 0.221158773f},
-std::array<float,2>{0.114057183f, 0.690237999f},
-std::array<float,2>{0.74401933f, 0.947831988f},
-std::array<float,2>{0.425881267f, 0.288570732f},
-std::array<float,2>{0.942729235f, 0.354673475f},
-std::array<float,2>{0.152743876f, 0.907874882f},
-std::array<float,2>{0.551981628f, 0.654124737f},
-std::array<float,2>{0.310958207f, 0.15542528f},
-std::array<float,2>{0.670701087f, 0.0780411437f},
-std::array<float,2>{0.491572708f, 0.523159206f},
-std::array<float,2>{0.775152504f, 0.826464772f},
-std::array<float,2>{0.0513085984f, 0.498169392f},
-std::array<float,2>{0.705565035f, 0.268621385f},
-std::array<float,2>{0.397332937f, 0.973193109f},
-std::array<float,2>{0.820955813f, 0.746557832f},
-std::array<float,2>{0.0626499355f, 0.196377605f},
-std::array<float,2>{0.881427586f, 0.0500470623f},
-std::array<float,2>{0.214891687f, 0.576862395f},
-std::array<float,2>{0.571465731f, 0.762551069f},
-std::array<float,2>{0.365686625f, 0.402654856f},
-std::array<float,2>{0.801041603f, 0.465972543f},
-std::array<float,2>{0.00135080516f, 0.849919081f},
-std::array<float,2>{0.633481145f, 0.540643334f},
-std::array<float,2>{0.458427787f, 0.106692716f},
-std::array<float,2>{0.511522233f, 0.162872165f},
-std::array<float,2>{0.277420551f, 0.67928493f},
-std::array<float,2>{0.990516961f, 0.898056746f},
-std::array<float,2>{0.16938214f, 0.342752784f},
-std::array<float,2>{0.623124957f, 0.348619044f},
-std::array<float,2>{0.313895285f, 0.916633427f},
-std::array<float,2>{0.932757914f, 0.647563338f},
-std::array<float,2>{0.223347932f, 0.147081003f},
-std::array<float,2>{0.867828131f, 0.0669238567f},
-std::array<float,2>{0.0965889245f, 0.529982626f},
-std::array<float,2>{0.721269488f, 0.816146731f},
-std::array<float,2>{0.40920794f, 0.485578358f},
-std::array<float,2>{0.959317863f, 0.432467759f},
-std::array<float,2>{0.134286791f, 0.792045534f},
-std::array<float,2>{0.538537741f, 0.596252203f},
-std::array<float,2>{0.288194448f, 0.00792388339f},
-std::array<float,2>{0.679698944f, 0.234299868f},
-std::array<float,2>{0.484162718f, 0.702401161f},
-std::array<float,2>{0.753545642f, 0.944590271f},
-std::array<float,2>{0.0381351709f, 0.290689915f},
-std::array<float,2>{0.694164276f, 0.459815592f},
-std::array<float,2>{0.390097976f, 0.85717243f},
-std::array<float,2>{0.832589686f, 0.531435668f},
-std::array<float,2>{0.0888333321f, 0.0968892574f},
-std::array<float,2>{0.891233027f, 0.169742927f},
-std::array<float,2>{0.18864046f, 0.680710673f},
-std::array<float,2>{0.579427481f, 0.899254143f},
-std::array<float,2>{0.355123311f, 0.332141459f},
-std::array<float,2>{0.787570953f, 0.276057601f},
-std::array<float,2>{0.0273129642f, 0.978848696f},
-std::array<float,2>{0.651057065f, 0.736657858f},
-std::array<float,2>{0.437800169f, 0.191663295f},
-std::array<float,2>{0.521784782f, 0.0610601306f},
-std::array<float,2>{0.251959652f, 0.568135858f},
-std::array<float,2>{0.975946784f, 0.753954649f},
-std::array<float,2>{0.177045226f, 0.391375303f},
-std::array<float,2>{0.550201893f, 0.378947616f},
-std::array<float,2>{0.307486415f, 0.769440293f},
-std::array<float,2>{0.940490663f, 0.582013369f},
-std::array<float,2>{0.150080308f, 0.0401888564f},
-std::array<float,2>{0.779971302f, 0.217020735f},
-std::array<float,2>{0.0490144528f, 0.725252688f},
-std::array<float,2>{0.666996717f, 0.996119797f},
-std::array<float,2>{0.485199511f, 0.254551381f},
-std::array<float,2>{0.915675581f, 0.325428456f},
-std::array<float,2>{0.243863478f, 0.890177906f},
-std::array<float,2>{0.595941246f, 0.667306602f},
-std::array<float,2>{0.337717623f, 0.182407677f},
-std::array<float,2>{0.747300088f, 0.116296947f},
-std::array<float,2>{0.423143178f, 0.551299155f},
-std::array<float,2>{0.849784255f, 0.864259779f},
-std::array<float,2>{0.11002063f, 0.44112885f},
-std::array<float,2>{0.639153123f, 0.304407954f},
-std::array<float,2>{0.455123812f, 0.960376382f},
-std::array<float,2>{0.797742307f, 0.703763843f},
-std::array<float,2>{0.00634946255f, 0.238489389f},
-std::array<float,2>{0.984375715f, 0.0167562049f},
-std::array<float,2>{0.164488584f, 0.615279257f},
-std::array<float,2>{0.513785839f, 0.810438752f},
-std::array<float,2>{0.276249349f, 0.416575849f},
-std::array<float,2>{0.82599175f, 0.480786055f},
-std::array<float,2>{0.070142433f, 0.838712215f},
-std::array<float,2>{0.709471583f, 0.509088814f},
-std::array<float,2>{0.391557723f, 0.0801803023f},
-std::array<float,2>{0.576345563f, 0.132535711f},
-std::array<float,2>{0.360162586f, 0.640244484f},
-std::array<float,2>{0.876219153f, 0.928070247f},
-std::array<float,2>{0.214037746f, 0.369897604f},
-std::array<float,2>{0.50740695f, 0.26361233f},
-std::array<float,2>{0.273413599f, 0.992136002f},
-std::array<float,2>{0.996863842f, 0.732081354f},
-std::array<float,2>{0.163396448f, 0.209145501f},
-std::array<float,2>{0.806589544f, 0.0317129679f},
-std::array<float,2>{0.0130935526f, 0.587700009f},
-std::array<float,2>{0.62711221f, 0.776769876f},
-std::array<float,2>{0.464456588f, 0.385723561f},
-std::array<float,2>{0.885655403f, 0.449627459f},
-std::array<float,2>{0.209641725f, 0.873480916f},
-std::array<float,2>{0.566638947f, 0.558059514f},
-std::array<float,2>{0.371922404f, 0.11803145f},
-std::array<float,2>{0.717458725f, 0.178870633f},
-std::array<float,2>{0.405023932f, 0.661065102f},
-std::array<float,2>{0.812704682f, 0.879640281f},
-std::array<float,2>{0.0749073997f, 0.31852603f},
-std::array<float,2>{0.656650424f, 0.408956647f},
-std::array<float,2>{0.495338529f, 0.802754581f},
-std::array<float,2>{0.76882565f, 0.622152507f},
-std::array<float,2>{0.0587004311f, 0.0298664719f},
-std::array<float,2>{0.95299083f, 0.242322192f},
-std::array<float,2>{0.14346388f, 0.711619854f},
-std::array<float,2>{0.560397565f, 0.961880505f},
-std::array<float,2>{0.29777655f, 0.30747965f},
-std::array<float,2>{0.858723462f, 0.36407885f},
-std::array<float,2>{0.119978406f, 0.935902834f},
-std::array<float,2>{0.738830745f, 0.628665209f},
-std::array<float,2>{0.43552348f, 0.138162702f},
-std::array<float,2>{0.603097081f, 0.0911147371f},
-std::array<float,2>{0.332191616f, 0.501296163f},
-std::array<float,2>{0.909654737f, 0.83331722f},
-std::array<float,2>{0.240470588f, 0.470052749f},
-std::array<float,2>{0.590757728f, 0.495838255f},
-std::array<float,2>{0.347896218f, 0.820420206f},
-std::array<float,2>{0.905626774f, 0.51617837f},
-std::array<float,2>{0.201372817f, 0.0712430403f},
-std::array<float,2>{0.841094375f, 0.152226597f},
-std::array<float,2>{0.0843762979f, 0.649531305f},
-std::array<float,2>{0.698846519f, 0.913082302f},
-std::array<float,2>{0.382198036f, 0.359019786f},
-std::array<float,2>{0.977227449f, 0.281742036f},
-std::array<float,2>{0.180450603f, 0.952586532f},
-std::array<float,2>{0.528986394f, 0.692337573f},
-std::array<float,2>{0.26447624f, 0.224196464f},
-std::array<float,2>{0.645974517f, 0.00372825912f},
-std::array<float,2>{0.446625471f, 0.606290638f},
-std::array<float,2>{0.791628301f, 0.787429094f},
-std::array<float,2>{0.02286187f, 0.42222774f},
-std::array<float,2>{0.733694315f, 0.337756008f},
-std::array<float,2>{0.415458649f, 0.893215299f},
-std::array<float,2>{0.866205394f, 0.674953341f},
-std::array<float,2>{0.106121659f, 0.158859104f},
-std::array<float,2>{0.922499299f, 0.103909142f},
-std::array<float,2>{0.23399052f, 0.546200931f},
-std::array<float,2>{0.611339211f, 0.843761384f},
-std::array<float,2>{0.32738331f, 0.463936925f},
-std::array<float,2>{0.760185659f, 0.402335674f},
-std::array<float,2>{0.044418294f, 0.758074224f},
-std::array<float,2>{0.676937282f, 0.572882771f},
-std::array<float,2>{0.471511066f, 0.0543030314f},
-std::array<float,2>{0.542918384f, 0.202451095f},
-std::array<float,2>{0.296154916f, 0.743807197f},
-std::array<float,2>{0.967975736f, 0.969000578f},
-std::array<float,2>{0.131635174f, 0.271075398f},
-std::array<float,2>{0.605707586f, 0.280864269f},
-std::array<float,2>{0.331567168f, 0.982555151f},
-std::array<float,2>{0.910984278f, 0.738802612f},
-std::array<float,2>{0.237001345f, 0.187730506f},
-std::array<float,2>{0.853523254f, 0.057777863f},
-std::array<float,2>{0.123590641f, 0.565784574f},
-std::array<float,2>{0.734422565f, 0.752701223f},
-std::array<float,2>{0.432985485f, 0.394637465f},
-std::array<float,2>{0.948412061f, 0.456006229f},
-std::array<float,2>{0.146021992f, 0.852701008f},
-std::array<float,2>{0.556241691f, 0.536278963f},
-std::array<float,2>{0.303057462f, 0.099271588f},
-std::array<float,2>{0.663178802f, 0.167761058f},
-std::array<float,2>{0.496500432f, 0.686531305f},
-std::array<float,2>{0.772967339f, 0.904895663f},
-std::array<float,2>{0.0564878434f, 0.329615325f},
-std::array<float,2>{0.713536382f, 0.435732931f},
-std::array<float,2>{0.398709595f, 0.794277549f},
-std::array<float,2>{0.818242908f, 0.60011816f},
-std::array<float,2>{0.0711092204f, 0.0143668493f},
-std::array<float,2>{0.888509154f, 0.22816436f},
-std::array<float,2>{0.206375927f, 0.696035385f},
-std::array<float,2>{0.562518358f, 0.938232183f},
-std::array<float,2>{0.371008396f, 0.296396166f},
-std::array<float,2>{0.809516072f, 0.347460121f},
-std::array<float,2>{0.0108516738f, 0.919050157f},
-std::array<float,2>{0.631914854f, 0.643237472f},
-std::array<float,2>{0.467148721f, 0.141827568f},
-std::array<float,2>{0.503102124f, 0.063498944f},
-std::array<float,2>{0.266585022f, 0.526211917f},
-std::array<float,2>{0.993575156f, 0.818478942f},
-std::array<float,2>{0.159085199f, 0.491078585f},
-std::array<float,2>{0.546042979f, 0.479380995f},
-std::array<float,2>{0.291920453f, 0.843627453f},
-std::array<float,2>{0.961531878f, 0.512517154f},
-std::array<float,2>{0.128826216f, 0.0849642232f},
-std::array<float,2>{0.764573395f, 0.125741035f},
-std::array<float,2>{0.0399399623f, 0.636404216f},
-std::array<float,2>{0.675482273f, 0.924740791f},
-std::array<float,2>{0.474953353f, 0.374580622f},
-std::array<float,2>{0.929000914f, 0.300176382f},
-std::array<float,2>{0.228210405f, 0.954119205f},
-std::array<float,2>{0.615126908f, 0.710914433f},
-std::array<float,2>{0.322124064f, 0.235723287f},
-std::array<float,2>{0.727603972f, 0.0203945599f},
-std::array<float,2>{0.418701023f, 0.610696614f},
-std::array<float,2>{0.861946344f, 0.80663377f},
-std::array<float,2>{0.10363435f, 0.420767456f},
-std::array<float,2>{0.643447697f, 0.321199f},
-std::array<float,2>{0.450669825f, 0.883135855f},
-std::array<float,2>{0.796080112f, 0.66879952f},
-std::array<float,2>{0.0163009781f, 0.187445208f},
-std::array<float,2>{0.981510282f, 0.112463102f},
-std::array<float,2>{0.183670774f, 0.548251152f},
-std::array<float,2>{0.526973128f, 0.862815738f},
-std::array<float,2>{0.260046393f, 0.443372726f},
-std::array<float,2>{0.837294221f, 0.378101408f},
-std::array<float,2>{0.080590643f, 0.772287965f},
-std::array<float,2>{0.703003466f, 0.583000183f},
-std::array<float,2>{0.375836283f, 0.0440893136f},
-std::array<float,2>{0.589162171f, 0.211442053f},
-std::array<float,2>{0.344153434f, 0.722158551f},
-std::array<float,2>{0.899343014f, 0.995721817f},
-std::array<float,2>{0.198394492f, 0.252135605f},
-std::array<float,2>{0.518463373f, 0.363271654f},
-std::array<float,2>{0.254731566f, 0.93009603f},
-std::array<float,2>{0.969558477f, 0.630185723f},
-std::array<float,2>{0.175572515f, 0.136125326f},
-std::array<float,2>{0.783424377f, 0.0896496773f},
-std::array<float,2>{0.0274146106f, 0.506275713f},
-std::array<float,2>{0.655647695f, 0.828791678f},
-std::array<float,2>{0.443840086f, 0.474820614f},
-std::array<float,2>{0.897236109f, 0.410668015f},
-std::array<float,2>{0.191428602f, 0.797666252f},
-std::array<float,2>{0.582837343f, 0.618593574f},
-std::array<float,2>{0.355961412f, 0.0260813106f},
-std::array<float,2>{0.687859833f, 0.247020498f},
-std::array<float,2>{0.386412919f, 0.717274487f},
-std::array<float,2>{0.828182638f, 0.96731174f},
-std::array<float,2>{0.0925079137f, 0.31140542f},
-std::array<float,2>{0.683823586f, 0.449069709f},
-std::array<float,2>{0.477728814f, 0.868714631f},
-std::array<float,2>{0.756949008f, 0.559016824f},
-std::array<float,2>{0.0333272256f, 0.123641811f},
-std::array<float,2>{0.955580473f, 0.172473386f},
-std::array<float,2>{0.140437573f, 0.659321249f},
-std::array<float,2>{0.533668637f, 0.876936316f},
-std::array<float,2>{0.282939613f, 0.316197544f},
-std::array<float,2>{0.871566832f, 0.25918901f},
-std::array<float,2>{0.0985032618f, 0.986985803f},
-std::array<float,2>{0.725862741f, 0.729150832f},
-std::array<float,2>{0.413525701f, 0.205505863f},
-std::array<float,2>{0.617329657f, 0.0378448777f},
-std::array<float,2>{0.316727012f, 0.591413915f},
-std::array<float,2>{0.936908007f, 0.779989183f},
-std::array<float,2>{0.221608937f, 0.388972968f},
-std::array<float,2>{0.573064864f, 0.405904353f},
-std::array<float,2>{0.365187079f, 0.765104055f},
-std::array<float,2>{0.880490184f, 0.574910283f},
-std::array<float,2>{0.218408287f, 0.0475445911f},
-std::array<float,2>{0.822877049f, 0.197907314f},
-std::array<float,2>{0.066138044f, 0.748742938f},
-std::array<float,2>{0.704739273f, 0.97638917f},
-std::array<float,2>{0.396044672f, 0.266086757f},
-std::array<float,2>{0.988376021f, 0.340389937f},
-std::array<float,2>{0.171334952f, 0.895334721f},
-std::array<float,2>{0.509298742f, 0.677270472f},
-std::array<float,2>{0.280979037f, 0.160946861f},
-std::array<float,2>{0.636202097f, 0.107949488f},
-std::array<float,2>{0.459922791f, 0.541184902f},
-std::array<float,2>{0.804638624f, 0.848869979f},
-std::array<float,2>{0.00299052778f, 0.467287451f},
-std::array<float,2>{0.744747043f, 0.285720199f},
-std::array<float,2>{0.429091603f, 0.945694685f},
-std::array<float,2>{0.844623268f, 0.688334167f},
-std::array<float,2>{0.116824038f, 0.220344499f},
-std::array<float,2>{0.919423103f, 0.00653452566f},
-std::array<float,2>{0.249955848f, 0.603792787f},
-std::array<float,2>{0.600688219f, 0.784209192f},
-std::array<float,2>{0.340209872f, 0.427958429f},
-std::array<float,2>{0.777326226f, 0.498019099f},
-std::array<float,2>{0.0536692254f, 0.826075733f},
-std::array<float,2>{0.66842401f, 0.520741105f},
-std::array<float,2>{0.489358008f, 0.0746967643f},
-std::array<float,2>{0.55434972f, 0.154057786f},
-std::array<float,2>{0.308986455f, 0.655471683f},
-std::array<float,2>{0.943843782f, 0.908625603f},
-std::array<float,2>{0.154799074f, 0.352339208f},
-std::array<float,2>{0.581283629f, 0.335266501f},
-std::array<float,2>{0.352429092f, 0.901238859f},
-std::array<float,2>{0.892929435f, 0.682166636f},
-std::array<float,2>{0.190062776f, 0.171579346f},
-std::array<float,2>{0.834725559f, 0.09386345f},
-std::array<float,2>{0.086883001f, 0.53482151f},
-std::array<float,2>{0.692211449f, 0.858641207f},
-std::array<float,2>{0.388334125f, 0.457387358f},
-std::array<float,2>{0.973043978f, 0.393327862f},
-std::array<float,2>{0.178763688f, 0.755917192f},
-std::array<float,2>{0.520388842f, 0.568672836f},
-std::array<float,2>{0.251525372f, 0.0593809411f},
-std::array<float,2>{0.648666203f, 0.194859684f},
-std::array<float,2>{0.439901173f, 0.735605121f},
-std::array<float,2>{0.786713481f, 0.976722181f},
-std::array<float,2>{0.0249770433f, 0.273554295f},
-std::array<float,2>{0.720305264f, 0.486685365f},
-std::array<float,2>{0.406809866f, 0.812797427f},
-std::array<float,2>{0.870693862f, 0.528655946f},
-std::array<float,2>{0.0946807936f, 0.069115445f},
-std::array<float,2>{0.930678248f, 0.146151572f},
-std::array<float,2>{0.225043461f, 0.644597292f},
-std::array<float,2>{0.6224038f, 0.915670633f},
-std::array<float,2>{0.315298021f, 0.349874467f},
-std::array<float,2>{0.751762033f, 0.292164057f},
-std::array<float,2>{0.0368331373f, 0.941762447f},
-std::array<float,2>{0.681753933f, 0.700178981f},
-std::array<float,2>{0.481535584f, 0.230485767f},
-std::array<float,2>{0.536758006f, 0.0108559281f},
-std::array<float,2>{0.287060261f, 0.593864262f},
-std::array<float,2>{0.957466781f, 0.789282739f},
-std::array<float,2>{0.135114729f, 0.430523217f},
-std::array<float,2>{0.512358963f, 0.4147214f},
-std::array<float,2>{0.273741037f, 0.811191142f},
-std::array<float,2>{0.987723649f, 0.613776624f},
-std::array<float,2>{0.166039899f, 0.0190347861f},
-std::array<float,2>{0.799894452f, 0.2414525f},
-std::array<float,2>{0.00475362688f, 0.70607549f},
-std::array<float,2>{0.637009919f, 0.95787394f},
-std::array<float,2>{0.454782486f, 0.301403165f},
-std::array<float,2>{0.877055049f, 0.368325412f},
-std::array<float,2>{0.212884948f, 0.926236808f},
-std::array<float,2>{0.576151729f, 0.637427151f},
-std::array<float,2>{0.362632662f, 0.130806029f},
-std::array<float,2>{0.7089504f, 0.0788187981f},
-std::array<float,2>{0.392764539f, 0.50977093f},
-std::array<float,2>{0.826843143f, 0.837119818f},
-std::array<float,2>{0.0665730685f, 0.483779788f},
-std::array<float,2>{0.664757013f, 0.257630348f},
-std::array<float,2>{0.488171101f, 0.998555183f},
-std::array<float,2>{0.778740346f, 0.723616719f},
-std::array<float,2>{0.0479422957f, 0.216625974f},
-std::array<float,2>{0.938808143f, 0.041847229f},
-std::array<float,2>{0.151502177f, 0.5794487f},
-std::array<float,2>{0.547279239f, 0.766570449f},
-std::array<float,2>{0.306146979f, 0.382107288f},
-std::array<float,2>{0.849049568f, 0.439191848f},
-std::array<float,2>{0.113114886f, 0.86541748f},
-std::array<float,2>{0.749530792f, 0.554374695f},
-std::array<float,2>{0.42558229f, 0.113518022f},
-std::array<float,2>{0.595606923f, 0.181276426f},
-std::array<float,2>{0.33968547f, 0.665027082f},
-std::array<float,2>{0.916822076f, 0.88861686f},
-std::array<float,2>{0.245132774f, 0.326283246f},
-std::array<float,2>{0.561972916f, 0.305174559f},
-std::array<float,2>{0.299936891f, 0.964482188f},
-std::array<float,2>{0.951010227f, 0.713093817f},
-std::array<float,2>{0.142300382f, 0.245936692f},
-std::array<float,2>{0.766049981f, 0.0284350179f},
-std::array<float,2>{0.0624770895f, 0.624761403f},
-std::array<float,2>{0.659249365f, 0.802027047f},
-std::array<float,2>{0.492471337f, 0.406855047f},
-std::array<float,2>{0.907772064f, 0.471474797f},
-std::array<float,2>{0.239729717f, 0.834585667f},
-std::array<float,2>{0.604718029f, 0.50371635f},
-std::array<float,2>{0.334916741f, 0.0925784335f},
-std::array<float,2>{0.741446376f, 0.139706939f},
-std::array<float,2>{0.43559444f, 0.625285864f},
-std::array<float,2>{0.85691309f, 0.935502887f},
-std::array<float,2>{0.119002655f, 0.366551787f},
-std::array<float,2>{0.626176059f, 0.38285172f},
-std::array<float,2>{0.462110013f, 0.775079191f},
-std::array<float,2>{0.807288468f, 0.589214027f},
-std::array<float,2>{0.0152317174f, 0.0338844173f},
-std::array<float,2>{0.998874724f, 0.207846671f},
-std::array<float,2>{0.161953807f, 0.733505368f},
-std::array<float,2>{0.50480032f, 0.989817858f},
-std::array<float,2>{0.269622684f, 0.26469636f},
-std::array<float,2>{0.814948618f, 0.316541135f},
-std::array<float,2>{0.0772616416f, 0.882615626f},
-std::array<float,2>{0.716590047f, 0.663720906f},
-std::array<float,2>{0.402844042f, 0.177712843f},
-std::array<float,2>{0.570193291f, 0.119876005f},
-std::array<float,2>{0.374041557f, 0.555568159f},
-std::array<float,2>{0.884544611f, 0.871654391f},
-std::array<float,2>{0.207937196f, 0.451772243f},
-std::array<float,2>{0.610928774f, 0.462622344f},
-std::array<float,2>{0.325275451f, 0.847078681f},
-std::array<float,2>{0.925676823f, 0.544564426f},
-std::array<float,2>{0.231768176f, 0.1021083f},
-std::array<float,2>{0.864963293f, 0.157535732f},
-std::array<float,2>{0.108053252f, 0.672604978f},
-std::array<float,2>{0.732384861f, 0.891366959f},
-std::array<float,2>{0.417292446f, 0.338149428f},
-std::array<float,2>{0.966020048f, 0.272803038f},
-std::array<float,2>{0.129778907f, 0.972326159f},
-std::array<float,2>{0.540853024f, 0.744906247f},
-std::array<float,2>{0.294114977f, 0.201045334f},
-std::array<float,2>{0.679243088f, 0.0526231974f},
-std::array<float,2>{0.469389379f, 0.571758807f},
-std::array<float,2>{0.759759724f, 0.759907365f},
-std::array<float,2>{0.0461207516f, 0.399603009f},
-std::array<float,2>{0.69718188f, 0.356429368f},
-std::array<float,2>{0.379166543f, 0.911750615f},
-std::array<float,2>{0.841930747f, 0.652226746f},
-std::array<float,2>{0.0829816982f, 0.150203839f},
-std::array<float,2>{0.903616786f, 0.0728240013f},
-std::array<float,2>{0.201032922f, 0.519313455f},
-std::array<float,2>{0.593611002f, 0.823390961f},
-std::array<float,2>{0.350601465f, 0.492374748f},
-std::array<float,2>{0.79082644f, 0.425037295f},
-std::array<float,2>{0.0202683825f, 0.786339998f},
-std::array<float,2>{0.647373319f, 0.607758522f},
-std::array<float,2>{0.448608518f, 0.000152205917f},
-std::array<float,2>{0.529699802f, 0.225508645f},
-std::array<float,2>{0.262408078f, 0.695052326f},
-std::array<float,2>{0.980078757f, 0.950222135f},
-std::array<float,2>{0.182460889f, 0.284561247f},
-std::array<float,2>{0.586218476f, 0.253327698f},
-std::array<float,2>{0.347334534f, 0.994851708f},
-std::array<float,2>{0.901655436f, 0.721072137f},
-std::array<float,2>{0.195358202f, 0.212334767f},
-std::array<float,2>{0.838912308f, 0.0436210036f},
-std::array<float,2>{0.0784952044f, 0.583050251f},
-std::array<float,2>{0.700181425f, 0.773361325f},
-std::array<float,2>{0.378553033f, 0.377171218f},
-std::array<float,2>{0.983561695f, 0.444546163f},
-std::array<float,2>{0.186946318f, 0.86222297f},
-std::array<float,2>{0.524221838f, 0.546902001f},
-std::array<float,2>{0.259355605f, 0.111453481f},
-std::array<float,2>{0.641875565f, 0.185738385f},
-std::array<float,2>{0.451865405f, 0.669306815f},
-std::array<float,2>{0.79302448f, 0.884601355f},
-std::array<float,2>{0.0187288504f, 0.322133422f},
-std::array<float,2>{0.729850352f, 0.421235144f},
-std::array<float,2>{0.421572953f, 0.804862857f},
-std::array<float,2>{0.859381139f, 0.610292256f},
-std::array<float,2>{0.103342004f, 0.0210293066f},
-std::array<float,2>{0.926231146f, 0.234888241f},
-std::array<float,2>{0.229557201f, 0.709148228f},
-std::array<float,2>{0.616586626f, 0.953722477f},
-std::array<float,2>{0.3229146f, 0.299434721f},
-std::array<float,2>{0.763108671f, 0.373635828f},
-std::array<float,2>{0.0413333997f, 0.925449252f},
-std::array<float,2>{0.672649801f, 0.635481834f},
-std::array<float,2>{0.473375022f, 0.126378849f},
-std::array<float,2>{0.544705212f, 0.0845047683f},
-std::array<float,2>{0.290251791f, 0.513139188f},
-std::array<float,2>{0.964127541f, 0.842579424f},
-std::array<float,2>{0.126185223f, 0.479954362f},
-std::array<float,2>{0.500633955f, 0.492100507f},
-std::array<float,2>{0.269207746f, 0.820075154f},
-std::array<float,2>{0.994383812f, 0.526598036f},
-std::array<float,2>{0.157281324f, 0.06294135f},
-std::array<float,2>{0.810602903f, 0.140688196f},
-std::array<float,2>{0.00805048551f, 0.643669188f},
-std::array<float,2>{0.629001617f, 0.918587863f},
-std::array<float,2>{0.465903759f, 0.346165895f},
-std::array<float,2>{0.889849901f, 0.295843959f},
-std::array<float,2>{0.203147888f, 0.938648641f},
-std::array<float,2>{0.565658987f, 0.696538568f},
-std::array<float,2>{0.3680453f, 0.2274753f},
-std::array<float,2>{0.711267471f, 0.0155376876f},
-std::array<float,2>{0.400463581f, 0.601070404f},
-std::array<float,2>{0.819989502f, 0.79312855f},
-std::array<float,2>{0.0725975633f, 0.436998606f},
-std::array<float,2>{0.661084831f, 0.32882753f},
-std::array<float,2>{0.499749571f, 0.906200588f},
-std::array<float,2>{0.771021485f, 0.685971737f},
-std::array<float,2>{0.0566768162f, 0.166298121f},
-std::array<float,2>{0.947234869f, 0.0984716117f},
-std::array<float,2>{0.146706656f, 0.535274267f},
-std::array<float,2>{0.557919562f, 0.851803899f},
-std::array<float,2>{0.302180082f, 0.456516176f},
-std::array<float,2>{0.852772534f, 0.396441758f},
-std::array<float,2>{0.122699909f, 0.753009558f},
-std::array<float,2>{0.738215923f, 0.565411985f},
-std::array<float,2>{0.430561662f, 0.0569674112f},
-std::array<float,2>{0.607806981f, 0.188520998f},
-std::array<float,2>{0.328507423f, 0.740209937f},
-std::array<float,2>{0.913753867f, 0.983586907f},
-std::array<float,2>{0.235893622f, 0.279511571f},
-std::array<float,2>{0.551696181f, 0.353512883f},
-std::array<float,2>{0.311939746f, 0.910122097f},
-std::array<float,2>{0.942012668f, 0.654882252f},
-std::array<float,2>{0.154147774f, 0.153221041f},
-std::array<float,2>{0.773591638f, 0.0751989558f},
-std::array<float,2>{0.0521301739f, 0.519932628f},
-std::array<float,2>{0.671192527f, 0.824598372f},
-std::array<float,2>{0.491015941f, 0.496825904f},
-std::array<float,2>{0.920924366f, 0.429070652f},
-std::array<float,2>{0.247035712f, 0.783806682f},
-std::array<float,2>{0.598747849f, 0.605109215f},
-std::array<float,2>{0.343410045f, 0.00766028278f},
-std::array<float,2>{0.743111372f, 0.219607145f},
-std::array<float,2>{0.427048296f, 0.689185798f},
-std::array<float,2>{0.846495152f, 0.947199106f},
-std::array<float,2>{0.114547804f, 0.286413878f},
-std::array<float,2>{0.634061098f, 0.468597293f},
-std::array<float,2>{0.457662404f, 0.847785532f},
-std::array<float,2>{0.802592576f, 0.542262435f},
-std::array<float,2>{0.000947800931f, 0.109021813f},
-std::array<float,2>{0.991670549f, 0.161470518f},
-std::array<float,2>{0.1680886f, 0.675931394f},
-std::array<float,2>{0.51059705f, 0.896335363f},
-std::array<float,2>{0.278364897f, 0.341167063f},
-std::array<float,2>{0.821940303f, 0.267568439f},
-std::array<float,2>{0.0639970154f, 0.974857986f},
-std::array<float,2>{0.706431746f, 0.749748588f},
-std::array<float,2>{0.398106962f, 0.19855082f},
-std::array<float,2>{0.571076572f, 0.0478724539f},
-std::array<float,2>{0.366777211f, 0.575832665f},
-std::array<float,2>{0.88272351f, 0.763711214f},
-std::array<float,2>{0.216350153f, 0.405123949f},
-std::array<float,2>{0.621086657f, 0.389768958f},
-std::array<float,2>{0.318445027f, 0.780846953f},
-std::array<float,2>{0.93494904f, 0.590379894f},
-std::array<float,2>{0.220060661f, 0.0389089733f},
-std::array<float,2>{0.873626947f, 0.206152335f},
-std::array<float,2>{0.100694679f, 0.730246663f},
-std::array<float,2>{0.724128366f, 0.987757981f},
-std::array<float,2>{0.412059426f, 0.258770525f},
-std::array<float,2>{0.953750253f, 0.315428466f},
-std::array<float,2>{0.137418762f, 0.875309646f},
-std::array<float,2>{0.532853723f, 0.658906519f},
-std::array<float,2>{0.283889651f, 0.172871783f},
-std::array<float,2>{0.686134756f, 0.124356873f},
-std::array<float,2>{0.479628593f, 0.559614182f},
-std::array<float,2>{0.754808664f, 0.867910922f},
-std::array<float,2>{0.03154248f, 0.447302401f},
-std::array<float,2>{0.690417171f, 0.312201619f},
-std::array<float,2>{0.382948577f, 0.968111634f},
-std::array<float,2>{0.830824733f, 0.718692005f},
-std::array<float,2>{0.0915348381f, 0.247866541f},
-std::array<float,2>{0.895076871f, 0.0266250875f},
-std::array<float,2>{0.194821879f, 0.618113399f},
-std::array<float,2>{0.584406555f, 0.798342168f},
-std::array<float,2>{0.357733309f, 0.41122213f},
-std::array<float,2>{0.782414854f, 0.47582081f},
-std::array<float,2>{0.0301760696f, 0.829302311f},
-std::array<float,2>{0.653636634f, 0.507460892f},
-std::array<float,2>{0.443080664f, 0.0883942842f},
-std::array<float,2>{0.515638411f, 0.135535434f},
-std::array<float,2>{0.25694257f, 0.629839778f},
-std::array<float,2>{0.971689522f, 0.93090409f},
-std::array<float,2>{0.173318371f, 0.361768663f},
-std::array<float,2>{0.596826971f, 0.327905625f},
-std::array<float,2>{0.336481005f, 0.887450576f},
-std::array<float,2>{0.915019035f, 0.665149331f},
-std::array<float,2>{0.243151218f, 0.180109873f},
-std::array<float,2>{0.851478517f, 0.114706576f},
-std::array<float,2>{0.110476814f, 0.553293228f},
-std::array<float,2>{0.7466501f, 0.866274536f},
-std::array<float,2>{0.422732562f, 0.438129872f},
-std::array<float,2>{0.939637065f, 0.381048828f},
-std::array<float,2>{0.148616165f, 0.767267108f},
-std::array<float,2>{0.549766123f, 0.578289688f},
-std::array<float,2>{0.308551341f, 0.0420414507f},
-std::array<float,2>{0.666624367f, 0.215564027f},
-std::array<float,2>{0.486136377f, 0.723786473f},
-std::array<float,2>{0.780463099f, 0.999283493f},
-std::array<float,2>{0.0506571792f, 0.256433129f},
-std::array<float,2>{0.710571647f, 0.482614368f},
-std::array<float,2>{0.392334342f, 0.836320758f},
-std::array<float,2>{0.824364841f, 0.510754824f},
-std::array<float,2>{0.0688019544f, 0.0795825645f},
-std::array<float,2>{0.875011206f, 0.129744127f},
-std::array<float,2>{0.213045761f, 0.638203263f},
-std::array<float,2>{0.577783346f, 0.927494466f},
-std::array<float,2>{0.360548317f, 0.367990285f},
-std::array<float,2>{0.79821527f, 0.302366376f},
-std::array<float,2>{0.00755679701f, 0.95832324f},
-std::array<float,2>{0.640437305f, 0.705363095f},
-std::array<float,2>{0.456579626f, 0.240533814f},
-std::array<float,2>{0.514953792f, 0.018483391f},
-std::array<float,2>{0.276530683f, 0.614293754f},
-std::array<float,2>{0.985668778f, 0.812028825f},
-std::array<float,2>{0.165737122f, 0.415468067f},
-std::array<float,2>{0.537526131f, 0.431087047f},
-std::array<float,2>{0.28720057f, 0.790258646f},
-std::array<float,2>{0.960429013f, 0.594754338f},
-std::array<float,2>{0.133756638f, 0.00998945441f},
-std::array<float,2>{0.752365232f, 0.232074812f},
-std::array<float,2>{0.0377148464f, 0.700524747f},
-std::array<float,2>{0.681340873f, 0.942792833f},
-std::array<float,2>{0.48287946f, 0.291227728f},
-std::array<float,2>{0.932261229f, 0.351235688f},
-std::array<float,2>{0.22432059f, 0.914770007f},
-std::array<float,2>{0.624846101f, 0.645712733f},
-std::array<float,2>{0.312742144f, 0.144737601f},
-std::array<float,2>{0.722390652f, 0.0695600957f},
-std::array<float,2>{0.409153551f, 0.527686894f},
-std::array<float,2>{0.868820965f, 0.813672364f},
-std::array<float,2>{0.0969532877f, 0.487691104f},
-std::array<float,2>{0.652037978f, 0.275090188f},
-std::array<float,2>{0.438594699f, 0.977675617f},
-std::array<float,2>{0.789030254f, 0.734896302f},
-std::array<float,2>{0.0260043237f, 0.193518311f},
-std::array<float,2>{0.975446522f, 0.0598864034f},
-std::array<float,2>{0.176130265f, 0.569461048f},
-std::array<float,2>{0.522794127f, 0.757497132f},
-std::array<float,2>{0.253327608f, 0.394034743f},
-std::array<float,2>{0.833199739f, 0.458706111f},
-std::array<float,2>{0.0894176066f, 0.858071327f},
-std::array<float,2>{0.695084631f, 0.533591509f},
-std::array<float,2>{0.388892025f, 0.0951686949f},
-std::array<float,2>{0.578490078f, 0.17015858f},
-std::array<float,2>{0.35356611f, 0.683245718f},
-std::array<float,2>{0.892230809f, 0.902081609f},
-std::array<float,2>{0.187703654f, 0.334018111f},
-std::array<float,2>{0.527814567f, 0.284042805f},
-std::array<float,2>{0.265163153f, 0.949456036f},
-std::array<float,2>{0.977672577f, 0.694052756f},
-std::array<float,2>{0.181563824f, 0.226240918f},
-std::array<float,2>{0.792323291f, 0.00132687844f},
-std::array<float,2>{0.0222739261f, 0.609030724f},
-std::array<float,2>{0.644830644f, 0.785191476f},
-std::array<float,2>{0.445450962f, 0.424682081f},
-std::array<float,2>{0.905022919f, 0.493906111f},
-std::array<float,2>{0.202281117f, 0.822379053f},
-std::array<float,2>{0.591652513f, 0.518011868f},
-std::array<float,2>{0.349064142f, 0.0732549727f},
-std::array<float,2>{0.697958171f, 0.149287596f},
-std::array<float,2>{0.380925953f, 0.65064764f},
-std::array<float,2>{0.840194106f, 0.91017741f},
-std::array<float,2>{0.0852766111f, 0.357073516f},
-std::array<float,2>{0.676474631f, 0.39925164f},
-std::array<float,2>{0.472440451f, 0.761166811f},
-std::array<float,2>{0.760985255f, 0.570498645f},
-std::array<float,2>{0.0433047526f, 0.051655706f},
-std::array<float,2>{0.967510283f, 0.20008567f},
-std::array<float,2>{0.132623821f, 0.745549262f},
-std::array<float,2>{0.541929126f, 0.971205592f},
-std::array<float,2>{0.295389026f, 0.271894753f},
-std::array<float,2>{0.866332829f, 0.339409202f},
-std::array<float,2>{0.107060991f, 0.892219186f},
-std::array<float,2>{0.733137906f, 0.673688293f},
-std::array<float,2>{0.415013283f, 0.156924859f},
-std::array<float,2>{0.612636805f, 0.10307005f},
-std::array<float,2>{0.326358467f, 0.543274641f},
-std::array<float,2>{0.923508406f, 0.846470475f},
-std::array<float,2>{0.232869864f, 0.461046726f},
-std::array<float,2>{0.568243444f, 0.452305168f},
-std::array<float,2>{0.372373641f, 0.872078598f},
-std::array<float,2>{0.886578083f, 0.556185067f},
-std::array<float,2>{0.210864678f, 0.120264933f},
-std::array<float,2>{0.81362915f, 0.176136017f},
-std::array<float,2>{0.075635381f, 0.662335575f},
-std::array<float,2>{0.718263507f, 0.881630838f},
-std::array<float,2>{0.406151474f, 0.318102896f},
-std::array<float,2>{0.997076213f, 0.264185965f},
-std::array<float,2>{0.162143394f, 0.988540173f},
-std::array<float,2>{0.506381691f, 0.732573092f},
-std::array<float,2>{0.272123069f, 0.208300814f},
-std::array<float,2>{0.628643334f, 0.0343352929f},
-std::array<float,2>{0.46355468f, 0.588280261f},
-std::array<float,2>{0.805649281f, 0.774081945f},
-std::array<float,2>{0.0117797265f, 0.384229422f},
-std::array<float,2>{0.739403248f, 0.366123229f},
-std::array<float,2>{0.434370488f, 0.934122264f},
-std::array<float,2>{0.858201325f, 0.626781464f},
-std::array<float,2>{0.120161898f, 0.139364526f},
-std::array<float,2>{0.90862751f, 0.0937093943f},
-std::array<float,2>{0.241950229f, 0.502513468f},
-std::array<float,2>{0.602107763f, 0.835396051f},
-std::array<float,2>{0.333536804f, 0.472612649f},
-std::array<float,2>{0.76824075f, 0.407234132f},
-std::array<float,2>{0.0601530708f, 0.80162549f},
-std::array<float,2>{0.657604814f, 0.623286068f},
-std::array<float,2>{0.494535208f, 0.0278845821f},
-std::array<float,2>{0.559092939f, 0.244795233f},
-std::array<float,2>{0.298433036f, 0.714823186f},
-std::array<float,2>{0.951818645f, 0.963539362f},
-std::array<float,2>{0.143576086f, 0.305963874f},
-std::array<float,2>{0.614049375f, 0.298017949f},
-std::array<float,2>{0.320352137f, 0.955849171f},
-std::array<float,2>{0.928068042f, 0.708729088f},
-std::array<float,2>{0.226730928f, 0.236853629f},
-std::array<float,2>{0.862642109f, 0.0226935595f},
-std::array<float,2>{0.105393156f, 0.611496329f},
-std::array<float,2>{0.727030933f, 0.80760622f},
-std::array<float,2>{0.419309348f, 0.419544488f},
-std::array<float,2>{0.962367535f, 0.477854073f},
-std::array<float,2>{0.127005264f, 0.840855122f},
-std::array<float,2>{0.54560858f, 0.514696777f},
-std::array<float,2>{0.292639613f, 0.0832003281f},
-std::array<float,2>{0.674516559f, 0.127713799f},
-std::array<float,2>{0.47589913f, 0.634528756f},
-std::array<float,2>{0.765534103f, 0.922943234f},
-std::array<float,2>{0.0404529646f, 0.372603446f},
-std::array<float,2>{0.701349199f, 0.375991374f},
-std::array<float,2>{0.376564264f, 0.771203697f},
-std::array<float,2>{0.836758554f, 0.584367692f},
-std::array<float,2>{0.0816142336f, 0.0453099385f},
-std::array<float,2>{0.900334477f, 0.214239284f},
-std::array<float,2>{0.197340414f, 0.719530284f},
-std::array<float,2>{0.588526964f, 0.992889106f},
-std::array<float,2>{0.345682144f, 0.251925886f},
-std::array<float,2>{0.795716584f, 0.32420218f},
-std::array<float,2>{0.0172472466f, 0.886427999f},
-std::array<float,2>{0.643669307f, 0.671436906f},
-std::array<float,2>{0.450023055f, 0.183660835f},
-std::array<float,2>{0.52562207f, 0.110585041f},
-std::array<float,2>{0.261517137f, 0.549694061f},
-std::array<float,2>{0.98070085f, 0.859451234f},
-std::array<float,2>{0.185329333f, 0.441672266f},
-std::array<float,2>{0.555191875f, 0.454542994f},
-std::array<float,2>{0.303847611f, 0.854932904f},
-std::array<float,2>{0.947638631f, 0.537812114f},
-std::array<float,2>{0.144977078f, 0.101266302f},
-std::array<float,2>{0.771790266f, 0.164208502f},
-std::array<float,2>{0.0556016676f, 0.683773398f},
-std::array<float,2>{0.662331641f, 0.902828753f},
-std::array<float,2>{0.497260749f, 0.331612349f},
-std::array<float,2>{0.91124624f, 0.278814673f},
-std::array<float,2>{0.237875134f, 0.981797338f},
-std::array<float,2>{0.607228935f, 0.740358412f},
-std::array<float,2>{0.330440342f, 0.189467877f},
-std::array<float,2>{0.735435009f, 0.0550924055f},
-std::array<float,2>{0.431732267f, 0.562711358f},
-std::array<float,2>{0.855004847f, 0.750893116f},
-std::array<float,2>{0.124175951f, 0.396522284f},
-std::array<float,2>{0.631561518f, 0.344255418f},
-std::array<float,2>{0.468422145f, 0.920324385f},
-std::array<float,2>{0.810410142f, 0.641259372f},
-std::array<float,2>{0.0107309399f, 0.144446164f},
-std::array<float,2>{0.992872059f, 0.0655426085f},
-std::array<float,2>{0.159683913f, 0.524829566f},
-std::array<float,2>{0.502792358f, 0.817852736f},
-std::array<float,2>{0.267329782f, 0.488293976f},
-std::array<float,2>{0.817258358f, 0.434021711f},
-std::array<float,2>{0.0722564086f, 0.796561122f},
-std::array<float,2>{0.714384854f, 0.59904772f},
-std::array<float,2>{0.400030166f, 0.0134294527f},
-std::array<float,2>{0.563585699f, 0.228936553f},
-std::array<float,2>{0.369269848f, 0.698989213f},
-std::array<float,2>{0.887368619f, 0.940198302f},
-std::array<float,2>{0.205897734f, 0.293608308f},
-std::array<float,2>{0.508525729f, 0.343644351f},
-std::array<float,2>{0.27960217f, 0.897229075f},
-std::array<float,2>{0.989290416f, 0.67786026f},
-std::array<float,2>{0.170007482f, 0.164043039f},
-std::array<float,2>{0.803242266f, 0.105571233f},
-std::array<float,2>{0.00289197033f, 0.539183319f},
-std::array<float,2>{0.635523617f, 0.851039886f},
-std::array<float,2>{0.460107952f, 0.465369731f},
-std::array<float,2>{0.879723012f, 0.404113948f},
-std::array<float,2>{0.217384115f, 0.7635324f},
-std::array<float,2>{0.573769033f, 0.578047276f},
-std::array<float,2>{0.36358586f, 0.0497734323f},
-std::array<float,2>{0.703502893f, 0.196122885f},
-std::array<float,2>{0.395295054f, 0.747731447f},
-std::array<float,2>{0.823950529f, 0.974595726f},
-std::array<float,2>{0.0647814125f, 0.267835796f},
-std::array<float,2>{0.669792056f, 0.499465197f},
-std::array<float,2>{0.48919636f, 0.82786113f},
-std::array<float,2>{0.776066005f, 0.522226989f},
-std::array<float,2>{0.0537743941f, 0.07695283f},
-std::array<float,2>{0.944391787f, 0.154547274f},
-std::array<float,2>{0.156205341f, 0.653220952f},
-std::array<float,2>{0.553347945f, 0.906936109f},
-std::array<float,2>{0.3100999f, 0.35373345f},
-std::array<float,2>{0.845648348f, 0.287839115f},
-std::array<float,2>{0.115952194f, 0.948692024f},
-std::array<float,2>{0.746055603f, 0.690700293f},
-std::array<float,2>{0.428078592f, 0.221854806f},
-std::array<float,2>{0.600167453f, 0.00496448576f},
-std::array<float,2>{0.341621011f, 0.601580501f},
-std::array<float,2>{0.918559253f, 0.782725215f},
-std::array<float,2>{0.248651713f, 0.426899344f},
-std::array<float,2>{0.583360493f, 0.412596375f},
-std::array<float,2>{0.35691154f, 0.798917234f},
-std::array<float,2>{0.897830009f, 0.619745135f},
-std::array<float,2>{0.192804858f, 0.0242613219f},
-std::array<float,2>{0.829438686f, 0.248281956f},
-std::array<float,2>{0.0929441005f, 0.715330541f},
-std::array<float,2>{0.68879658f, 0.966251671f},
-std::array<float,2>{0.385109067f, 0.309464782f},
-std::array<float,2>{0.970677912f, 0.361248344f},
-std::array<float,2>{0.174185246f, 0.932753801f},
-std::array<float,2>{0.518857539f, 0.63219738f},
-std::array<float,2>{0.255205333f, 0.133047879f},
-std::array<float,2>{0.655037284f, 0.0875007361f},
-std::array<float,2>{0.445076197f, 0.504713476f},
-std::array<float,2>{0.784823895f, 0.830716133f},
-std::array<float,2>{0.0285213646f, 0.473599792f},
-std::array<float,2>{0.724744737f, 0.261247158f},
-std::array<float,2>{0.412885159f, 0.985103428f},
-std::array<float,2>{0.872859478f, 0.728346169f},
-std::array<float,2>{0.0986884013f, 0.203680739f},
-std::array<float,2>{0.936057985f, 0.0356373861f},
-std::array<float,2>{0.221860319f, 0.592683017f},
-std::array<float,2>{0.61861217f, 0.778066635f},
-std::array<float,2>{0.317932606f, 0.388597071f},
-std::array<float,2>{0.756431818f, 0.445616484f},
-std::array<float,2>{0.0342319682f, 0.870874286f},
-std::array<float,2>{0.685352147f, 0.56154424f},
-std::array<float,2>{0.47690773f, 0.121254869f},
-std::array<float,2>{0.534527838f, 0.174635291f},
-std::array<float,2>{0.281301528f, 0.657466769f},
-std::array<float,2>{0.95647943f, 0.878519535f},
-std::array<float,2>{0.13895829f, 0.313925415f},
-std::array<float,2>{0.574801028f, 0.370411396f},
-std::array<float,2>{0.362103403f, 0.92910409f},
-std::array<float,2>{0.878456712f, 0.639501989f},
-std::array<float,2>{0.210980818f, 0.131400585f},
-std::array<float,2>{0.828017592f, 0.0811673254f},
-std::array<float,2>{0.0681122169f, 0.508361936f},
-std::array<float,2>{0.707650363f, 0.83980757f},
-std::array<float,2>{0.394074708f, 0.482351989f},
-std::array<float,2>{0.98655653f, 0.417245597f},
-std::array<float,2>{0.16748178f, 0.808720946f},
-std::array<float,2>{0.51361686f, 0.61622256f},
-std::array<float,2>{0.274528652f, 0.0162630156f},
-std::array<float,2>{0.63793844f, 0.239343926f},
-std::array<float,2>{0.453614265f, 0.704747379f},
-std::array<float,2>{0.798877239f, 0.959698915f},
-std::array<float,2>{0.00518193049f, 0.302946091f},
-std::array<float,2>{0.749014139f, 0.439962655f},
-std::array<float,2>{0.424704343f, 0.863767207f},
-std::array<float,2>{0.848216891f, 0.551860273f},
-std::array<float,2>{0.111624122f, 0.115863279f},
-std::array<float,2>{0.917738974f, 0.182882041f},
-std::array<float,2>{0.244725689f, 0.666182339f},
-std::array<float,2>{0.59428978f, 0.889453351f},
-std::array<float,2>{0.338512033f, 0.324901998f},
-std::array<float,2>{0.778019011f, 0.255421102f},
-std::array<float,2>{0.0475188233f, 0.997075081f},
-std::array<float,2>{0.665472686f, 0.726094365f},
-std::array<float,2>{0.486387253f, 0.218045771f},
-std::array<float,2>{0.547940373f, 0.0394631661f},
-std::array<float,2>{0.305263251f, 0.58029592f},
-std::array<float,2>{0.937553525f, 0.767727315f},
-std::array<float,2>{0.150691643f, 0.380555809f},
-std::array<float,2>{0.521151304f, 0.392233223f},
-std::array<float,2>{0.250784218f, 0.754966497f},
-std::array<float,2>{0.9745242f, 0.567326546f},
-std::array<float,2>{0.178153291f, 0.0617405139f},
-std::array<float,2>{0.785876215f, 0.19280839f},
-std::array<float,2>{0.0243731476f, 0.738073707f},
-std::array<float,2>{0.649807394f, 0.980361462f},
-std::array<float,2>{0.440486014f, 0.276717663f},
-std::array<float,2>{0.893956006f, 0.333453655f},
-std::array<float,2>{0.191246986f, 0.899996102f},
-std::array<float,2>{0.581011772f, 0.679731131f},
-std::array<float,2>{0.353421062f, 0.168652236f},
-std::array<float,2>{0.693270743f, 0.0959145054f},
-std::array<float,2>{0.386825979f, 0.532921016f},
-std::array<float,2>{0.835606039f, 0.856138885f},
-std::array<float,2>{0.08718694f, 0.460107714f},
-std::array<float,2>{0.683565915f, 0.290026277f},
-std::array<float,2>{0.480472416f, 0.943939805f},
-std::array<float,2>{0.750878096f, 0.701841354f},
-std::array<float,2>{0.0356256329f, 0.23283115f},
-std::array<float,2>{0.958333254f, 0.00906313863f},
-std::array<float,2>{0.135988504f, 0.59746176f},
-std::array<float,2>{0.535633087f, 0.791927695f},
-std::array<float,2>{0.2856327f, 0.432931244f},
-std::array<float,2>{0.869310439f, 0.485238612f},
-std::array<float,2>{0.0949227214f, 0.815047443f},
-std::array<float,2>{0.718987644f, 0.530424416f},
-std::array<float,2>{0.408027381f, 0.0677923858f},
-std::array<float,2>{0.621590555f, 0.147595137f},
-std::array<float,2>{0.316384315f, 0.647108853f},
-std::array<float,2>{0.929742634f, 0.917819798f},
-std::array<float,2>{0.226307541f, 0.349270612f},
-std::array<float,2>{0.539560437f, 0.270013273f},
-std::array<float,2>{0.293683171f, 0.969996452f},
-std::array<float,2>{0.965575457f, 0.742981791f},
-std::array<float,2>{0.13062197f, 0.20192802f},
-std::array<float,2>{0.758569658f, 0.0529521033f},
-std::array<float,2>{0.0455007479f, 0.573883891f},
-std::array<float,2>{0.678028166f, 0.758972943f},
-std::array<float,2>{0.470575899f, 0.401020139f},
-std::array<float,2>{0.924254537f, 0.463037461f},
-std::array<float,2>{0.23103407f, 0.845276952f},
-std::array<float,2>{0.610150754f, 0.545826793f},
-std::array<float,2>{0.324822128f, 0.104569934f},
-std::array<float,2>{0.730621994f, 0.159493938f},
-std::array<float,2>{0.416286945f, 0.674046457f},
-std::array<float,2>{0.863399625f, 0.893838823f},
-std::array<float,2>{0.109002084f, 0.336724967f},
-std::array<float,2>{0.647943616f, 0.42339471f},
-std::array<float,2>{0.447884709f, 0.788586318f},
-std::array<float,2>{0.78930676f, 0.607336044f},
-std::array<float,2>{0.020981282f, 0.00206159311f},
-std::array<float,2>{0.978654742f, 0.22327964f},
-std::array<float,2>{0.183177277f, 0.692684293f},
-std::array<float,2>{0.530852556f, 0.952140152f},
-std::array<float,2>{0.263601333f, 0.282251149f},
-std::array<float,2>{0.843537807f, 0.358278036f},
-std::array<float,2>{0.0834924877f, 0.913988769f},
-std::array<float,2>{0.695495486f, 0.649025202f},
-std::array<float,2>{0.380197108f, 0.150439441f},
-std::array<float,2>{0.592171192f, 0.0718667582f},
-std::array<float,2>{0.35048151f, 0.516986668f},
-std::array<float,2>{0.902728796f, 0.821693718f},
-std::array<float,2>{0.199274525f, 0.494206965f},
-std::array<float,2>{0.603658557f, 0.468984485f},
-std::array<float,2>{0.33521837f, 0.832203329f},
-std::array<float,2>{0.906383157f, 0.500504673f},
-std::array<float,2>{0.239232302f, 0.0907360613f},
-std::array<float,2>{0.856428444f, 0.137422994f},
-std::array<float,2>{0.1172041f, 0.627193511f},
-std::array<float,2>{0.741047859f, 0.936585784f},
-std::array<float,2>{0.4368563f, 0.36490941f},
-std::array<float,2>{0.949623883f, 0.307636201f},
-std::array<float,2>{0.141495004f, 0.962189496f},
-std::array<float,2>{0.561326802f, 0.712028742f},
-std::array<float,2>{0.299705863f, 0.243958086f},
-std::array<float,2>{0.658796668f, 0.0311372895f},
-std::array<float,2>{0.49350059f, 0.621436179f},
-std::array<float,2>{0.767527461f, 0.80407548f},
-std::array<float,2>{0.0614263341f, 0.410020292f},
-std::array<float,2>{0.715664506f, 0.319847584f},
-std::array<float,2>{0.403977752f, 0.880717278f},
-std::array<float,2>{0.815526724f, 0.661242187f},
-std::array<float,2>{0.0770168826f, 0.178030148f},
-std::array<float,2>{0.883454919f, 0.118284784f},
-std::array<float,2>{0.208810508f, 0.557249844f},
-std::array<float,2>{0.568459451f, 0.87497139f},
-std::array<float,2>{0.373332173f, 0.450273693f},
-std::array<float,2>{0.807932913f, 0.385802537f},
-std::array<float,2>{0.0138729196f, 0.775591671f},
-std::array<float,2>{0.625262439f, 0.586498618f},
-std::array<float,2>{0.461233199f, 0.0329946168f},
-std::array<float,2>{0.505036354f, 0.210373223f},
-std::array<float,2>{0.271054298f, 0.730640709f},
-std::array<float,2>{0.999827504f, 0.991158426f},
-std::array<float,2>{0.160359427f, 0.262297362f},
-std::array<float,2>{0.584888816f, 0.30869624f},
-std::array<float,2>{0.358085364f, 0.966350019f},
-std::array<float,2>{0.89465028f, 0.71547091f},
-std::array<float,2>{0.195271224f, 0.248817563f},
-std::array<float,2>{0.830352485f, 0.0236714669f},
-std::array<float,2>{0.0912863016f, 0.619243801f},
-std::array<float,2>{0.689526439f, 0.799547136f},
-std::array<float,2>{0.383651346f, 0.412836552f},
-std::array<float,2>{0.972603679f, 0.473049104f},
-std::array<float,2>{0.17335774f, 0.83045572f},
-std::array<float,2>{0.516246617f, 0.504030108f},
-std::array<float,2>{0.257707447f, 0.0870236456f},
-std::array<float,2>{0.653982162f, 0.133324891f},
-std::array<float,2>{0.442830563f, 0.632728755f},
-std::array<float,2>{0.782966852f, 0.933374465f},
-std::array<float,2>{0.0297123231f, 0.360806316f},
-std::array<float,2>{0.723727822f, 0.387976289f},
-std::array<float,2>{0.411305159f, 0.777673841f},
-std::array<float,2>{0.873050511f, 0.591800869f},
-std::array<float,2>{0.101364456f, 0.0360236689f},
-std::array<float,2>{0.935113192f, 0.203524888f},
-std::array<float,2>{0.220451131f, 0.727798283f},
-std::array<float,2>{0.620550334f, 0.98447448f},
-std::array<float,2>{0.319196731f, 0.261099607f},
-std::array<float,2>{0.754235327f, 0.314015418f},
-std::array<float,2>{0.0319878869f, 0.877973139f},
-std::array<float,2>{0.68588841f, 0.657747626f},
-std::array<float,2>{0.48021248f, 0.174312115f},
-std::array<float,2>{0.532664478f, 0.121703915f},
-std::array<float,2>{0.283275485f, 0.562456429f},
-std::array<float,2>{0.95344609f, 0.87055558f},
-std::array<float,2>{0.136921316f, 0.446140707f},
-std::array<float,2>{0.509871304f, 0.464954525f},
-std::array<float,2>{0.279149503f, 0.851171792f},
-std::array<float,2>{0.992148936f, 0.539616048f},
-std::array<float,2>{0.168734834f, 0.106207736f},
-std::array<float,2>{0.801820517f, 0.1635658f},
-std::array<float,2>{0.000358979334f, 0.67849654f},
-std::array<float,2>{0.634605944f, 0.896887422f},
-std::array<float,2>{0.457482159f, 0.342959791f},
-std::array<float,2>{0.882197142f, 0.268437147f},
-std::array<float,2>{0.215847075f, 0.973955452f},
-std::array<float,2>{0.570515335f, 0.747443378f},
-std::array<float,2>{0.366245657f, 0.195768282f},
-std::array<float,2>{0.706646502f, 0.04918826f},
-std::array<float,2>{0.397583216f, 0.577452362f},
-std::array<float,2>{0.821647584f, 0.762952268f},
-std::array<float,2>{0.0635690913f, 0.403630465f},
-std::array<float,2>{0.6717152f, 0.354413867f},
-std::array<float,2>{0.490385622f, 0.906433165f},
-std::array<float,2>{0.774103403f, 0.652524889f},
-std::array<float,2>{0.0524499342f, 0.154811293f},
-std::array<float,2>{0.941465437f, 0.0766284615f},
-std::array<float,2>{0.153655022f, 0.521675527f},
-std::array<float,2>{0.551128209f, 0.82733196f},
-std::array<float,2>{0.312201828f, 0.499696851f},
-std::array<float,2>{0.846004248f, 0.427575231f},
-std::array<float,2>{0.11501725f, 0.782708824f},
-std::array<float,2>{0.742533863f, 0.602427006f},
-std::array<float,2>{0.427654356f, 0.005817445f},
-std::array<float,2>{0.599424005f, 0.222211719f},
-std::array<float,2>{0.343081385f, 0.691090465f},
-std::array<float,2>{0.921598077f, 0.949106932f},
-std::array<float,2>{0.246302977f, 0.287505895f},
-std::array<float,2>{0.55820477f, 0.33109504f},
-std::array<float,2>{0.302318305f, 0.903080583f},
-std::array<float,2>{0.946494043f, 0.684095681f},
-std::array<float,2>{0.147192135f, 0.164609268f},
-std::array<float,2>{0.770674169f, 0.101008028f},
-std::array<float,2>{0.057494849f, 0.537292421f},
-std::array<float,2>{0.660513937f, 0.855459154f},
-std::array<float,2>{0.499502152f, 0.454963684f},
-std::array<float,2>{0.913131535f, 0.397198975f},
-std::array<float,2>{0.235538036f, 0.750352859f},
-std::array<float,2>{0.608240545f, 0.563198388f},
-std::array<float,2>{0.328988522f, 0.0555076227f},
-std::array<float,2>{0.737559378f, 0.190078333f},
-std::array<float,2>{0.429883271f, 0.741205335f},
-std::array<float,2>{0.85344857f, 0.981960952f},
-std::array<float,2>{0.122285821f, 0.278779149f},
-std::array<float,2>{0.629427254f, 0.488794386f},
-std::array<float,2>{0.466325343f, 0.81821686f},
-std::array<float,2>{0.811488926f, 0.525268912f},
-std::array<float,2>{0.00856862962f, 0.0664055422f},
-std::array<float,2>{0.995044351f, 0.143941313f},
-std::array<float,2>{0.158102274f, 0.640659094f},
-std::array<float,2>{0.50011909f, 0.920866489f},
-std::array<float,2>{0.268701345f, 0.344100922f},
-std::array<float,2>{0.819755733f, 0.293104798f},
-std::array<float,2>{0.0727954954f, 0.939545929f},
-std::array<float,2>{0.711675525f, 0.698249876f},
-std::array<float,2>{0.401007593f, 0.229045138f},
-std::array<float,2>{0.566348255f, 0.0127339456f},
-std::array<float,2>{0.367583483f, 0.599478364f},
-std::array<float,2>{0.890507936f, 0.795943379f},
-std::array<float,2>{0.204035908f, 0.434301913f},
-std::array<float,2>{0.616938591f, 0.419312507f},
-std::array<float,2>{0.32248354f, 0.807005048f},
-std::array<float,2>{0.926549077f, 0.612135351f},
-std::array<float,2>{0.230017424f, 0.0232092701f},
-std::array<float,2>{0.860229969f, 0.236814842f},
-std::array<float,2>{0.10299781f, 0.708194494f},
-std::array<float,2>{0.730132639f, 0.955094218f},
-std::array<float,2>{0.420955747f, 0.298450798f},
-std::array<float,2>{0.964461327f, 0.372251302f},
-std::array<float,2>{0.126473203f, 0.923505187f},
-std::array<float,2>{0.544237137f, 0.63402456f},
-std::array<float,2>{0.290747017f, 0.12741217f},
-std::array<float,2>{0.671913564f, 0.083583422f},
-std::array<float,2>{0.472799003f, 0.515271306f},
-std::array<float,2>{0.763361573f, 0.84133482f},
-std::array<float,2>{0.0416056179f, 0.478060097f},
-std::array<float,2>{0.699558973f, 0.251067013f},
-std::array<float,2>{0.377932787f, 0.992326498f},
-std::array<float,2>{0.839441359f, 0.718909085f},
-std::array<float,2>{0.079091467f, 0.214763373f},
-std::array<float,2>{0.902158976f, 0.0454212092f},
-std::array<float,2>{0.196270317f, 0.584577441f},
-std::array<float,2>{0.586722791f, 0.77094245f},
-std::array<float,2>{0.346813381f, 0.376763493f},
-std::array<float,2>{0.793907881f, 0.44199118f},
-std::array<float,2>{0.0194431562f, 0.860335708f},
-std::array<float,2>{0.642263412f, 0.549034953f},
-std::array<float,2>{0.451659888f, 0.110941663f},
-std::array<float,2>{0.523715258f, 0.184557006f},
-std::array<float,2>{0.259178102f, 0.671056271f},
-std::array<float,2>{0.984343767f, 0.885822594f},
-std::array<float,2>{0.187040657f, 0.323412478f},
-std::array<float,2>{0.601636112f, 0.364697903f},
-std::array<float,2>{0.333350003f, 0.937285602f},
-std::array<float,2>{0.90914762f, 0.627606213f},
-std::array<float,2>{0.241684258f, 0.136719108f},
-std::array<float,2>{0.85785526f, 0.0899355039f},
-std::array<float,2>{0.120806523f, 0.500076056f},
-std::array<float,2>{0.740138173f, 0.832565427f},
-std::array<float,2>{0.434060633f, 0.469494671f},
-std::array<float,2>{0.951447904f, 0.409243107f},
-std::array<float,2>{0.144349292f, 0.804599285f},
-std::array<float,2>{0.558642924f, 0.622011006f},
-std::array<float,2>{0.298174471f, 0.0306266584f},
-std::array<float,2>{0.657765269f, 0.243568584f},
-std::array<float,2>{0.494905949f, 0.712631166f},
-std::array<float,2>{0.767679036f, 0.962627292f},
-std::array<float,2>{0.0596687123f, 0.308264315f},
-std::array<float,2>{0.718187749f, 0.450936913f},
-std::array<float,2>{0.40541935f, 0.874231935f},
-std::array<float,2>{0.814109445f, 0.556753159f},
-std::array<float,2>{0.0757875368f, 0.119075164f},
-std::array<float,2>{0.885946453f, 0.178695232f},
-std::array<float,2>{0.210208029f, 0.661710024f},
-std::array<float,2>{0.567564189f, 0.880179286f},
-std::array<float,2>{0.372936964f, 0.319565535f},
-std::array<float,2>{0.804795861f, 0.262000561f},
-std::array<float,2>{0.0126806861f, 0.990714788f},
-std::array<float,2>{0.628147125f, 0.731125951f},
-std::array<float,2>{0.463120461f, 0.210916013f},
-std::array<float,2>{0.506098866f, 0.0326304361f},
-std::array<float,2>{0.271603316f, 0.586209357f},
-std::array<float,2>{0.997724533f, 0.77627641f},
-std::array<float,2>{0.162788793f, 0.386303961f},
-std::array<float,2>{0.541269183f, 0.400608808f},
-std::array<float,2>{0.295628995f, 0.759349167f},
-std::array<float,2>{0.967278957f, 0.573679626f},
-std::array<float,2>{0.132233739f, 0.0535769537f},
-std::array<float,2>{0.76166302f, 0.20118323f},
-std::array<float,2>{0.0436331704f, 0.742249489f},
-std::array<float,2>{0.675967991f, 0.970613539f},
-std::array<float,2>{0.472003251f, 0.270350814f},
-std::array<float,2>{0.923190892f, 0.336405337f},
-std::array<float,2>{0.233397275f, 0.894325376f},
-std::array<float,2>{0.6130234f, 0.674379051f},
-std::array<float,2>{0.326838553f, 0.159789458f},
-std::array<float,2>{0.732704639f, 0.10509941f},
-std::array<float,2>{0.414103627f, 0.545251608f},
-std::array<float,2>{0.86697489f, 0.844835877f},
-std::array<float,2>{0.106621787f, 0.463382274f},
-std::array<float,2>{0.645497918f, 0.283057004f},
-std::array<float,2>{0.445887029f, 0.951280773f},
-std::array<float,2>{0.792913258f, 0.692946553f},
-std::array<float,2>{0.0218055509f, 0.222740382f},
-std::array<float,2>{0.978262007f, 0.00266377302f},
-std::array<float,2>{0.180836394f, 0.606696844f},
-std::array<float,2>{0.527908683f, 0.788166761f},
-std::array<float,2>{0.264759302f, 0.422886312f},
-std::array<float,2>{0.840491295f, 0.494698465f},
-std::array<float,2>{0.0859161839f, 0.821815431f},
-std::array<float,2>{0.697615504f, 0.517409027f},
-std::array<float,2>{0.381360501f, 0.071464546f},
-std::array<float,2>{0.590965688f, 0.151170939f},
-std::array<float,2>{0.349417597f, 0.648826301f},
-std::array<float,2>{0.904387414f, 0.913357437f},
-std::array<float,2>{0.202995867f, 0.357589126f},
-std::array<float,2>{0.523136199f, 0.276999921f},
-std::array<float,2>{0.253545344f, 0.979771912f},
-std::array<float,2>{0.975004435f, 0.737634838f},
-std::array<float,2>{0.176644713f, 0.192966476f},
-std::array<float,2>{0.788464427f, 0.062407244f},
-std::array<float,2>{0.0254800394f, 0.566675425f},
-std::array<float,2>{0.65151f, 0.7557953f},
-std::array<float,2>{0.439338386f, 0.391991138f},
-std::array<float,2>{0.89202863f, 0.460794687f},
-std::array<float,2>{0.18843396f, 0.855633378f},
-std::array<float,2>{0.578881621f, 0.532706678f},
-std::array<float,2>{0.354042977f, 0.0965093374f},
-std::array<float,2>{0.694476604f, 0.168280751f},
-std::array<float,2>{0.389484614f, 0.680176139f},
-std::array<float,2>{0.833839118f, 0.899554312f},
-std::array<float,2>{0.0891045183f, 0.333633572f},
-std::array<float,2>{0.680722952f, 0.43345055f},
-std::array<float,2>{0.483371764f, 0.791074514f},
-std::array<float,2>{0.752900124f, 0.597060621f},
-std::array<float,2>{0.0371907577f, 0.00968470704f},
-std::array<float,2>{0.960891604f, 0.233348027f},
-std::array<float,2>{0.133156478f, 0.701467276f},
-std::array<float,2>{0.537711322f, 0.943772733f},
-std::array<float,2>{0.288066775f, 0.289324194f},
-std::array<float,2>{0.86822778f, 0.348860413f},
-std::array<float,2>{0.0975664333f, 0.917307079f},
-std::array<float,2>{0.721946478f, 0.646697998f},
-std::array<float,2>{0.408625543f, 0.148166582f},
-std::array<float,2>{0.62414217f, 0.0680026338f},
-std::array<float,2>{0.313473284f, 0.531102896f},
-std::array<float,2>{0.931958258f, 0.814884305f},
-std::array<float,2>{0.223724052f, 0.484833658f},
-std::array<float,2>{0.577526927f, 0.481620044f},
-std::array<float,2>{0.361118287f, 0.839049995f},
-std::array<float,2>{0.875904381f, 0.508236229f},
-std::array<float,2>{0.213833615f, 0.081969969f},
-std::array<float,2>{0.825157583f, 0.13131322f},
-std::array<float,2>{0.0690033957f, 0.63913697f},
-std::array<float,2>{0.710295081f, 0.929295778f},
-std::array<float,2>{0.39190647f, 0.37077114f},
-std::array<float,2>{0.98610884f, 0.303356379f},
-std::array<float,2>{0.165301099f, 0.959202945f},
-std::array<float,2>{0.515616953f, 0.704526186f},
-std::array<float,2>{0.277091086f, 0.24003534f},
-std::array<float,2>{0.640112519f, 0.0158921536f},
-std::array<float,2>{0.456203967f, 0.616763532f},
-std::array<float,2>{0.798817873f, 0.809529662f},
-std::array<float,2>{0.0068722209f, 0.417768329f},
-std::array<float,2>{0.746306956f, 0.324637741f},
-std::array<float,2>{0.422269017f, 0.888814211f},
-std::array<float,2>{0.85062629f, 0.666754365f},
-std::array<float,2>{0.111169033f, 0.183461919f},
-std::array<float,2>{0.91453898f, 0.115505345f},
-std::array<float,2>{0.242346615f, 0.5526191f},
-std::array<float,2>{0.597223878f, 0.863992095f},
-std::array<float,2>{0.336167425f, 0.439670891f},
-std::array<float,2>{0.781116128f, 0.380003184f},
-std::array<float,2>{0.049845133f, 0.768155932f},
-std::array<float,2>{0.666060209f, 0.580857635f},
-std::array<float,2>{0.485753834f, 0.0397672355f},
-std::array<float,2>{0.54888618f, 0.218398273f},
-std::array<float,2>{0.308087647f, 0.725830078f},
-std::array<float,2>{0.940282702f, 0.997872293f},
-std::array<float,2>{0.149186119f, 0.255333066f},
-std::array<float,2>{0.619057059f, 0.258141845f},
-std::array<float,2>{0.317592263f, 0.98806864f},
-std::array<float,2>{0.935883641f, 0.729923725f},
-std::array<float,2>{0.222476318f, 0.206793204f},
-std::array<float,2>{0.872288585f, 0.0383954123f},
-std::array<float,2>{0.099275507f, 0.590317726f},
-std::array<float,2>{0.725463092f, 0.780511916f},
-std::array<float,2>{0.412578225f, 0.390349478f},
-std::array<float,2>{0.956665099f, 0.44777298f},
-std::array<float,2>{0.139367193f, 0.867635846f},
-std::array<float,2>{0.534983575f, 0.560085475f},
-std::array<float,2>{0.28215149f, 0.124589682f},
-std::array<float,2>{0.685014188f, 0.17371653f},
-std::array<float,2>{0.477373242f, 0.658436656f},
-std::array<float,2>{0.75589484f, 0.875518918f},
-std::array<float,2>{0.0349697806f, 0.314584792f},
-std::array<float,2>{0.689049006f, 0.41188255f},
-std::array<float,2>{0.385575354f, 0.797968924f},
-std::array<float,2>{0.829992354f, 0.617199183f},
-std::array<float,2>{0.093470566f, 0.0268977713f},
-std::array<float,2>{0.89800632f, 0.247270361f},
-std::array<float,2>{0.193097159f, 0.717841446f},
-std::array<float,2>{0.583973408f, 0.968317747f},
-std::array<float,2>{0.357382536f, 0.311874658f},
-std::array<float,2>{0.784262359f, 0.362203151f},
-std::array<float,2>{0.02924232f, 0.93131429f},
-std::array<float,2>{0.654593825f, 0.629065156f},
-std::array<float,2>{0.444578856f, 0.134957954f},
-std::array<float,2>{0.519249737f, 0.0882297456f},
-std::array<float,2>{0.255519629f, 0.507104039f},
-std::array<float,2>{0.970172405f, 0.83002454f},
-std::array<float,2>{0.174801916f, 0.476335078f},
-std::array<float,2>{0.553133488f, 0.496358782f},
-std::array<float,2>{0.309951961f, 0.824964285f},
-std::array<float,2>{0.944911063f, 0.520497501f},
-std::array<float,2>{0.15553388f, 0.0761498287f},
-std::array<float,2>{0.775669575f, 0.152447686f},
-std::array<float,2>{0.0545150042f, 0.654390335f},
-std::array<float,2>{0.669270635f, 0.909481645f},
-std::array<float,2>{0.488458335f, 0.352570206f},
-std::array<float,2>{0.918444037f, 0.287028402f},
-std::array<float,2>{0.248381764f, 0.94634968f},
-std::array<float,2>{0.600040436f, 0.688869536f},
-std::array<float,2>{0.341234714f, 0.219022572f},
-std::array<float,2>{0.745536506f, 0.00704838755f},
-std::array<float,2>{0.42845732f, 0.604683459f},
-std::array<float,2>{0.844835401f, 0.783377707f},
-std::array<float,2>{0.115433425f, 0.429462016f},
-std::array<float,2>{0.634945571f, 0.341602743f},
-std::array<float,2>{0.460690171f, 0.89591372f},
-std::array<float,2>{0.803131521f, 0.676698565f},
-std::array<float,2>{0.00207386538f, 0.161643326f},
-std::array<float,2>{0.990219951f, 0.108490191f},
-std::array<float,2>{0.170584247f, 0.542789757f},
-std::array<float,2>{0.507942915f, 0.848197877f},
-std::array<float,2>{0.280005723f, 0.467982173f},
-std::array<float,2>{0.823332191f, 0.404693305f},
-std::array<float,2>{0.0649672747f, 0.764429569f},
-std::array<float,2>{0.704030156f, 0.575284302f},
-std::array<float,2>{0.394998372f, 0.0484925769f},
-std::array<float,2>{0.573466063f, 0.199109688f},
-std::array<float,2>{0.363885909f, 0.749193609f},
-std::array<float,2>{0.879142761f, 0.975151777f},
-std::array<float,2>{0.217244849f, 0.26702407f},
-std::array<float,2>{0.502271354f, 0.34660098f},
-std::array<float,2>{0.266897976f, 0.918291509f},
-std::array<float,2>{0.992643952f, 0.644052505f},
-std::array<float,2>{0.159383655f, 0.141464546f},
-std::array<float,2>{0.809602618f, 0.0632703975f},
-std::array<float,2>{0.00982216373f, 0.527111948f},
-std::array<float,2>{0.631072462f, 0.819446504f},
-std::array<float,2>{0.468164474f, 0.491263807f},
-std::array<float,2>{0.88697201f, 0.437102377f},
-std::array<float,2>{0.205195919f, 0.793675184f},
-std::array<float,2>{0.564183593f, 0.601372778f},
-std::array<float,2>{0.36963141f, 0.0148742683f},
-std::array<float,2>{0.714106143f, 0.226590857f},
-std::array<float,2>{0.399756819f, 0.697156131f},
-std::array<float,2>{0.816619515f, 0.939451635f},
-std::array<float,2>{0.0716164112f, 0.295191914f},
-std::array<float,2>{0.662971437f, 0.456677467f},
-std::array<float,2>{0.497653574f, 0.852078199f},
-std::array<float,2>{0.772292912f, 0.536101699f},
-std::array<float,2>{0.0551481098f, 0.0978296474f},
-std::array<float,2>{0.947894394f, 0.166590288f},
-std::array<float,2>{0.145257086f, 0.686206281f},
-std::array<float,2>{0.554784358f, 0.905599892f},
-std::array<float,2>{0.304676712f, 0.328227401f},
-std::array<float,2>{0.854958117f, 0.280130267f},
-std::array<float,2>{0.124850027f, 0.983936548f},
-std::array<float,2>{0.736308873f, 0.739651501f},
-std::array<float,2>{0.43216151f, 0.18905741f},
-std::array<float,2>{0.606820703f, 0.0573308654f},
-std::array<float,2>{0.330857247f, 0.564458072f},
-std::array<float,2>{0.911782682f, 0.753760159f},
-std::array<float,2>{0.237688228f, 0.395729363f},
-std::array<float,2>{0.588219464f, 0.377721161f},
-std::array<float,2>{0.344819605f, 0.772756815f},
-std::array<float,2>{0.899465561f, 0.583658159f},
-std::array<float,2>{0.198110014f, 0.0430610701f},
-std::array<float,2>{0.836404741f, 0.212687477f},
-std::array<float,2>{0.0810964704f, 0.721588135f},
-std::array<float,2>{0.701758087f, 0.994520843f},
-std::array<float,2>{0.376448482f, 0.253852695f},
-std::array<float,2>{0.981066108f, 0.321487099f},
-std::array<float,2>{0.184826776f, 0.884010494f},
-std::array<float,2>{0.526279032f, 0.669704378f},
-std::array<float,2>{0.260903507f, 0.186333403f},
-std::array<float,2>{0.644320786f, 0.11222098f},
-std::array<float,2>{0.449571937f, 0.547684669f},
-std::array<float,2>{0.795299053f, 0.861727476f},
-std::array<float,2>{0.0169993062f, 0.445241094f},
-std::array<float,2>{0.72751689f, 0.299109519f},
-std::array<float,2>{0.419477522f, 0.953315914f},
-std::array<float,2>{0.862879813f, 0.709932268f},
-std::array<float,2>{0.104965106f, 0.234777674f},
-std::array<float,2>{0.928627014f, 0.0209213961f},
-std::array<float,2>{0.227432474f, 0.609680295f},
-std::array<float,2>{0.613324523f, 0.805457234f},
-std::array<float,2>{0.320916414f, 0.421578258f},
-std::array<float,2>{0.764797509f, 0.480049223f},
-std::array<float,2>{0.0409973823f, 0.842125356f},
-std::array<float,2>{0.67430824f, 0.513369799f},
-std::array<float,2>{0.476539582f, 0.0843173116f},
-std::array<float,2>{0.545303762f, 0.12646547f},
-std::array<float,2>{0.29219088f, 0.634880781f},
-std::array<float,2>{0.962656975f, 0.925016344f},
-std::array<float,2>{0.12746112f, 0.373503029f},
-std::array<float,2>{0.568887591f, 0.31759569f},
-std::array<float,2>{0.373725235f, 0.880936384f},
-std::array<float,2>{0.883252203f, 0.662818611f},
-std::array<float,2>{0.208044633f, 0.176611409f},
-std::array<float,2>{0.816007197f, 0.120637611f},
-std::array<float,2>{0.076196745f, 0.555876493f},
-std::array<float,2>{0.715327561f, 0.872861207f},
-std::array<float,2>{0.403597414f, 0.452998012f},
-std::array<float,2>{0.999188483f, 0.384597003f},
-std::array<float,2>{0.161001757f, 0.773629189f},
-std::array<float,2>{0.505534589f, 0.588587761f},
-std::array<float,2>{0.27062273f, 0.0349871665f},
-std::array<float,2>{0.62560904f, 0.208844647f},
-std::array<float,2>{0.461449653f, 0.733016133f},
-std::array<float,2>{0.808175087f, 0.989191592f},
-std::array<float,2>{0.0145162316f, 0.263980776f},
-std::array<float,2>{0.740591168f, 0.47197631f},
-std::array<float,2>{0.437358022f, 0.83549273f},
-std::array<float,2>{0.855571568f, 0.501998663f},
-std::array<float,2>{0.117879555f, 0.0931581929f},
-std::array<float,2>{0.906998813f, 0.139004126f},
-std::array<float,2>{0.238550171f, 0.626446843f},
-std::array<float,2>{0.60421145f, 0.933875382f},
-std::array<float,2>{0.335766405f, 0.365656912f},
-std::array<float,2>{0.767045796f, 0.30629757f},
-std::array<float,2>{0.0606330708f, 0.963275254f},
-std::array<float,2>{0.658217788f, 0.714097917f},
-std::array<float,2>{0.494083196f, 0.24433215f},
-std::array<float,2>{0.560931563f, 0.0277110916f},
-std::array<float,2>{0.298902243f, 0.623572052f},
-std::array<float,2>{0.950195074f, 0.800977826f},
-std::array<float,2>{0.140927553f, 0.407879829f},
-std::array<float,2>{0.530425549f, 0.424129367f},
-std::array<float,2>{0.262788773f, 0.786108017f},
-std::array<float,2>{0.979379416f, 0.608813524f},
-std::array<float,2>{0.182736233f, 0.00177765288f},
-std::array<float,2>{0.789827347f, 0.225727573f},
-std::array<float,2>{0.021346584f, 0.693581939f},
-std::array<float,2>{0.648416996f, 0.950127244f},
-std::array<float,2>{0.447739273f, 0.283295989f},
-std::array<float,2>{0.903088212f, 0.356828362f},
-std::array<float,2>{0.199919596f, 0.910785437f},
-std::array<float,2>{0.59267664f, 0.65103358f},
-std::array<float,2>{0.349971026f, 0.148586422f},
-std::array<float,2>{0.696090102f, 0.0737728402f},
-std::array<float,2>{0.380588502f, 0.51820004f},
-std::array<float,2>{0.842945337f, 0.822767258f},
-std::array<float,2>{0.0838685781f, 0.493261039f},
-std::array<float,2>{0.678342044f, 0.272209436f},
-std::array<float,2>{0.470143348f, 0.970894575f},
-std::array<float,2>{0.75810653f, 0.745815814f},
-std::array<float,2>{0.0452575199f, 0.199584097f},
-std::array<float,2>{0.965254009f, 0.0512120686f},
-std::array<float,2>{0.130368486f, 0.571165144f},
-std::array<float,2>{0.539511502f, 0.761712611f},
-std::array<float,2>{0.29322952f, 0.398632616f},
-std::array<float,2>{0.864115715f, 0.461865276f},
-std::array<float,2>{0.10863179f, 0.845775187f},
-std::array<float,2>{0.731020153f, 0.543631732f},
-std::array<float,2>{0.416894794f, 0.10266532f},
-std::array<float,2>{0.609432817f, 0.156334102f},
-std::array<float,2>{0.324457914f, 0.67316252f},
-std::array<float,2>{0.924638033f, 0.891775846f},
-std::array<float,2>{0.230795875f, 0.339256644f},
-std::array<float,2>{0.535938978f, 0.291671425f},
-std::array<float,2>{0.285932839f, 0.943118095f},
-std::array<float,2>{0.958956599f, 0.70080781f},
-std::array<float,2>{0.136432871f, 0.231752768f},
-std::array<float,2>{0.750190318f, 0.0106226206f},
-std::array<float,2>{0.0357859507f, 0.595404267f},
-std::array<float,2>{0.682850122f, 0.790589631f},
-std::array<float,2>{0.481198072f, 0.431171149f},
-std::array<float,2>{0.930357337f, 0.487903893f},
-std::array<float,2>{0.225881532f, 0.814026952f},
-std::array<float,2>{0.62157172f, 0.527894795f},
-std::array<float,2>{0.315463543f, 0.0701576173f},
-std::array<float,2>{0.719563782f, 0.145485029f},
-std::array<float,2>{0.407279849f, 0.646026433f},
-std::array<float,2>{0.869674027f, 0.91428566f},
-std::array<float,2>{0.0956001431f, 0.350806445f},
-std::array<float,2>{0.650381982f, 0.394232035f},
-std::array<float,2>{0.441061646f, 0.757226408f},
-std::array<float,2>{0.785642862f, 0.569922566f},
-std::array<float,2>{0.0235953759f, 0.060500592f},
-std::array<float,2>{0.974102676f, 0.194144756f},
-std::array<float,2>{0.17843537f, 0.734471917f},
-std::array<float,2>{0.520674109f, 0.978095174f},
-std::array<float,2>{0.250009388f, 0.274832249f},
-std::array<float,2>{0.835015297f, 0.334927529f},
-std::array<float,2>{0.0874080136f, 0.901412547f},
-std::array<float,2>{0.692730486f, 0.682784259f},
-std::array<float,2>{0.387285769f, 0.170734569f},
-std::array<float,2>{0.580434561f, 0.095315218f},
-std::array<float,2>{0.352790236f, 0.533872783f},
-std::array<float,2>{0.894325018f, 0.857460856f},
-std::array<float,2>{0.190621808f, 0.458455384f},
-std::array<float,2>{0.594034791f, 0.437592119f},
-std::array<float,2>{0.338115036f, 0.866705179f},
-std::array<float,2>{0.917027831f, 0.552838266f},
-std::array<float,2>{0.244620889f, 0.114968598f},
-std::array<float,2>{0.847849369f, 0.180221975f},
-std::array<float,2>{0.11226137f, 0.665876806f},
-std::array<float,2>{0.748288691f, 0.886840761f},
-std::array<float,2>{0.424271554f, 0.327277482f},
-std::array<float,2>{0.938175857f, 0.255923808f},
-std::array<float,2>{0.151316389f, 0.999792874f},
-std::array<float,2>{0.548458219f, 0.724488914f},
-std::array<float,2>{0.30504331f, 0.215106681f},
-std::array<float,2>{0.665807068f, 0.0425611883f},
-std::array<float,2>{0.486896724f, 0.579093277f},
-std::array<float,2>{0.777347028f, 0.766611099f},
-std::array<float,2>{0.0471392758f, 0.381684363f},
-std::array<float,2>{0.707304776f, 0.36743173f},
-std::array<float,2>{0.393676728f, 0.926800549f},
-std::array<float,2>{0.827170253f, 0.637823761f},
-std::array<float,2>{0.0674810857f, 0.1290268f},
-std::array<float,2>{0.878010392f, 0.0798879936f},
-std::array<float,2>{0.211623669f, 0.511443198f},
-std::array<float,2>{0.574539125f, 0.836727858f},
-std::array<float,2>{0.361594588f, 0.483046085f},
-std::array<float,2>{0.799712718f, 0.415661097f},
-std::array<float,2>{0.00575277628f, 0.811927795f},
-std::array<float,2>{0.638216078f, 0.614892364f},
-std::array<float,2>{0.45348534f, 0.0180061907f},
-std::array<float,2>{0.513029516f, 0.241003379f},
-std::array<float,2>{0.274998158f, 0.705951691f},
-std::array<float,2>{0.986921251f, 0.958791435f},
-std::array<float,2>{0.167156503f, 0.301880121f},
-std::array<float,2>{0.572008669f, 0.266272187f},
-std::array<float,2>{0.366062433f, 0.975747585f},
-std::array<float,2>{0.881322861f, 0.748152077f},
-std::array<float,2>{0.215624511f, 0.19748199f},
-std::array<float,2>{0.820544541f, 0.047188811f},
-std::array<float,2>{0.0633121431f, 0.574445784f},
-std::array<float,2>{0.705788732f, 0.765320361f},
-std::array<float,2>{0.396759331f, 0.405622512f},
-std::array<float,2>{0.990884483f, 0.467016041f},
-std::array<float,2>{0.169654071f, 0.849337041f},
-std::array<float,2>{0.510860801f, 0.54190129f},
-std::array<float,2>{0.277883053f, 0.107591681f},
-std::array<float,2>{0.633290231f, 0.160635933f},
-std::array<float,2>{0.458593726f, 0.676941156f},
-std::array<float,2>{0.801365256f, 0.894649327f},
-std::array<float,2>{0.00190014683f, 0.340040386f},
-std::array<float,2>{0.743406117f, 0.428628713f},
-std::array<float,2>{0.426694125f, 0.784743249f},
-std::array<float,2>{0.847452164f, 0.604480863f},
-std::array<float,2>{0.113617271f, 0.00609104801f},
-std::array<float,2>{0.920784354f, 0.220047295f},
-std::array<float,2>{0.247221991f, 0.687724173f},
-std::array<float,2>{0.598249733f, 0.945864618f},
-std::array<float,2>{0.342229396f, 0.285297096f},
-std::array<float,2>{0.774442255f, 0.352046251f},
-std::array<float,2>{0.0508313589f, 0.909091294f},
-std::array<float,2>{0.67020762f, 0.655858874f},
-std::array<float,2>{0.492174834f, 0.153729722f},
-std::array<float,2>{0.552277863f, 0.0750867054f},
-std::array<float,2>{0.311482787f, 0.521349847f},
-std::array<float,2>{0.943133175f, 0.825279832f},
-std::array<float,2>{0.153147161f, 0.497109592f},
-std::array<float,2>{0.517263472f, 0.47555995f},
-std::array<float,2>{0.255922437f, 0.82812798f},
-std::array<float,2>{0.970822811f, 0.506353199f},
-std::array<float,2>{0.171996519f, 0.0889286175f},
-std::array<float,2>{0.781980038f, 0.136330545f},
-std::array<float,2>{0.0305415858f, 0.630582809f},
-std::array<float,2>{0.652742207f, 0.930303335f},
-std::array<float,2>{0.441992879f, 0.362429738f},
-std::array<float,2>{0.895880222f, 0.310608655f},
-std::array<float,2>{0.194005787f, 0.966859043f},
-std::array<float,2>{0.585223079f, 0.717623293f},
-std::array<float,2>{0.358987361f, 0.246375337f},
-std::array<float,2>{0.690618098f, 0.0256523825f},
-std::array<float,2>{0.384158969f, 0.618889928f},
-std::array<float,2>{0.831215262f, 0.797242939f},
-std::array<float,2>{0.0903059617f, 0.410254836f},
-std::array<float,2>{0.686725259f, 0.315635979f},
-std::array<float,2>{0.478740692f, 0.876028419f},
-std::array<float,2>{0.755787969f, 0.659738898f},
-std::array<float,2>{0.0328752138f, 0.172254071f},
-std::array<float,2>{0.954570353f, 0.123048492f},
-std::array<float,2>{0.13813062f, 0.559479654f},
-std::array<float,2>{0.532118917f, 0.868421912f},
-std::array<float,2>{0.284446269f, 0.448260456f},
-std::array<float,2>{0.87436682f, 0.389344603f},
-std::array<float,2>{0.100067973f, 0.779544652f},
-std::array<float,2>{0.722912729f, 0.591013134f},
-std::array<float,2>{0.410177469f, 0.0374629237f},
-std::array<float,2>{0.619613945f, 0.205996633f},
-std::array<float,2>{0.320203364f, 0.728536248f},
-std::array<float,2>{0.934209108f, 0.986601233f},
-std::array<float,2>{0.219664499f, 0.259535968f},
-std::array<float,2>{0.543272853f, 0.374279976f},
-std::array<float,2>{0.289671987f, 0.923942089f},
-std::array<float,2>{0.963275254f, 0.636018276f},
-std::array<float,2>{0.125102267f, 0.125216141f},
-std::array<float,2>{0.762031198f, 0.0855815336f},
-std::array<float,2>{0.0423345938f, 0.511801422f},
-std::array<float,2>{0.673031628f, 0.84291625f},
-std::array<float,2>{0.473921031f, 0.47867167f},
-std::array<float,2>{0.927204669f, 0.419982731f},
-std::array<float,2>{0.229058698f, 0.805811226f},
-std::array<float,2>{0.615828395f, 0.611082852f},
-std::array<float,2>{0.324037403f, 0.0198733564f},
-std::array<float,2>{0.728592932f, 0.236309379f},
-std::array<float,2>{0.420126468f, 0.710413337f},
-std::array<float,2>{0.86128813f, 0.954633176f},
-std::array<float,2>{0.101775855f, 0.300566912f},
-std::array<float,2>{0.641564608f, 0.444221586f},
-std::array<float,2>{0.452730924f, 0.862517118f},
-std::array<float,2>{0.79444766f, 0.548685968f},
-std::array<float,2>{0.0180633795f, 0.112870954f},
-std::array<float,2>{0.983332813f, 0.186839893f},
-std::array<float,2>{0.185922116f, 0.668119907f},
-std::array<float,2>{0.524649322f, 0.883696556f},
-std::array<float,2>{0.258774847f, 0.32064268f},
-std::array<float,2>{0.838380516f, 0.252785504f},
-std::array<float,2>{0.0795200914f, 0.995509565f},
-std::array<float,2>{0.700465322f, 0.722532868f},
-std::array<float,2>{0.377605021f, 0.211162806f},
-std::array<float,2>{0.587120712f, 0.0446717814f},
-std::array<float,2>{0.345722079f, 0.582163393f},
-std::array<float,2>{0.900544941f, 0.771918893f},
-std::array<float,2>{0.19691816f, 0.378466249f},
-std::array<float,2>{0.608810186f, 0.395326734f},
-std::array<float,2>{0.329310596f, 0.752056718f},
-std::array<float,2>{0.912942827f, 0.566229403f},
-std::array<float,2>{0.235196918f, 0.0581473671f},
-std::array<float,2>{0.85241574f, 0.188390926f},
-std::array<float,2>{0.121650748f, 0.738587797f},
-std::array<float,2>{0.736737907f, 0.98311913f},
-std::array<float,2>{0.431576818f, 0.280536115f},
-std::array<float,2>{0.946019769f, 0.329578698f},
-std::array<float,2>{0.147993833f, 0.904763341f},
-std::array<float,2>{0.557583332f, 0.687072635f},
-std::array<float,2>{0.300926238f, 0.167033687f},
-std::array<float,2>{0.661267817f, 0.0988216698f},
-std::array<float,2>{0.498977095f, 0.536964178f},
-std::array<float,2>{0.76984936f, 0.853423417f},
-std::array<float,2>{0.0577400401f, 0.455437183f},
-std::array<float,2>{0.712834597f, 0.295905322f},
-std::array<float,2>{0.4013758f, 0.937601864f},
-std::array<float,2>{0.819255292f, 0.695717692f},
-std::array<float,2>{0.0739138573f, 0.227631152f},
-std::array<float,2>{0.888832271f, 0.0140171032f},
-std::array<float,2>{0.204346806f, 0.600081503f},
-std::array<float,2>{0.564907551f, 0.794725418f},
-std::array<float,2>{0.369121194f, 0.436442763f},
-std::array<float,2>{0.812144279f, 0.490568072f},
-std::array<float,2>{0.00907126907f, 0.818993807f},
-std::array<float,2>{0.629914522f, 0.525739074f},
-std::array<float,2>{0.464859873f, 0.0640790686f},
-std::array<float,2>{0.501814425f, 0.142109543f},
-std::array<float,2>{0.268377036f, 0.642863393f},
-std::array<float,2>{0.995525539f, 0.919756591f},
-std::array<float,2>{0.156780794f, 0.346892238f},
-std::array<float,2>{0.612218857f, 0.338584065f},
-std::array<float,2>{0.327902108f, 0.890726447f},
-std::array<float,2>{0.922002733f, 0.672222257f},
-std::array<float,2>{0.233556345f, 0.158104613f},
-std::array<float,2>{0.865384579f, 0.101743527f},
-std::array<float,2>{0.105711132f, 0.544398308f},
-std::array<float,2>{0.734298885f, 0.847279787f},
-std::array<float,2>{0.415622354f, 0.461921185f},
-std::array<float,2>{0.968366206f, 0.399935156f},
-std::array<float,2>{0.131299794f, 0.760326445f},
-std::array<float,2>{0.542330503f, 0.571969628f},
-std::array<float,2>{0.296429068f, 0.0519167706f},
-std::array<float,2>{0.677598476f, 0.200544208f},
-std::array<float,2>{0.471146822f, 0.744153142f},
-std::array<float,2>{0.760463953f, 0.97177285f},
-std::array<float,2>{0.0447467268f, 0.272975355f},
-std::array<float,2>{0.698291779f, 0.492739379f},
-std::array<float,2>{0.382452518f, 0.823963523f},
-std::array<float,2>{0.841446102f, 0.518901706f},
-std::array<float,2>{0.0848397613f, 0.072532475f},
-std::array<float,2>{0.905987382f, 0.149709985f},
-std::array<float,2>{0.202054814f, 0.651802778f},
-std::array<float,2>{0.59005475f, 0.91141063f},
-std::array<float,2>{0.348399431f, 0.35562107f},
-std::array<float,2>{0.791417718f, 0.284811378f},
-std::array<float,2>{0.0230366401f, 0.950986624f},
-std::array<float,2>{0.646206081f, 0.694713771f},
-std::array<float,2>{0.447180003f, 0.224838957f},
-std::array<float,2>{0.528737307f, 0.00079546799f},
-std::array<float,2>{0.263778448f, 0.608328044f},
-std::array<float,2>{0.976941586f, 0.787059188f},
-std::array<float,2>{0.179818988f, 0.425480098f},
-std::array<float,2>{0.559852004f, 0.406496912f},
-std::array<float,2>{0.297283083f, 0.802584767f},
-std::array<float,2>{0.952161908f, 0.624272048f},
-std::array<float,2>{0.142907217f, 0.0290807784f},
-std::array<float,2>{0.769235373f, 0.245324284f},
-std::array<float,2>{0.05932175f, 0.713723719f},
-std::array<float,2>{0.656956851f, 0.96429944f},
-std::array<float,2>{0.495671302f, 0.3053675f},
-std::array<float,2>{0.909756184f, 0.367164791f},
-std::array<float,2>{0.24100858f, 0.934944272f},
-std::array<float,2>{0.602772117f, 0.625511765f},
-std::array<float,2>{0.332691848f, 0.140438229f},
-std::array<float,2>{0.738455534f, 0.0921792835f},
-std::array<float,2>{0.43497473f, 0.50300014f},
-std::array<float,2>{0.858949244f, 0.834183276f},
-std::array<float,2>{0.119449794f, 0.471051663f},
-std::array<float,2>{0.62752223f, 0.265391469f},
-std::array<float,2>{0.463886529f, 0.989278674f},
-std::array<float,2>{0.805972934f, 0.734229505f},
-std::array<float,2>{0.0134638688f, 0.207453042f},
-std::array<float,2>{0.99647814f, 0.033332143f},
-std::array<float,2>{0.164016455f, 0.589727402f},
-std::array<float,2>{0.507263958f, 0.77488941f},
-std::array<float,2>{0.272569776f, 0.383665085f},
-std::array<float,2>{0.813471437f, 0.451583475f},
-std::array<float,2>{0.0744702369f, 0.871308863f},
-std::array<float,2>{0.71717298f, 0.554880261f},
-std::array<float,2>{0.404675305f, 0.119482689f},
-std::array<float,2>{0.567285836f, 0.17694968f},
-std::array<float,2>{0.371313155f, 0.663314581f},
-std::array<float,2>{0.884801626f, 0.881964564f},
-std::array<float,2>{0.209105968f, 0.317063481f},
-std::array<float,2>{0.514190912f, 0.300788939f},
-std::array<float,2>{0.275773108f, 0.957110167f},
-std::array<float,2>{0.985195637f, 0.706559062f},
-std::array<float,2>{0.165027365f, 0.242092088f},
-std::array<float,2>{0.797042251f, 0.0192345362f},
-std::array<float,2>{0.00605884893f, 0.613682687f},
-std::array<float,2>{0.639235377f, 0.81101954f},
-std::array<float,2>{0.456017882f, 0.414415896f},
-std::array<float,2>{0.876654088f, 0.484016836f},
-std::array<float,2>{0.214647844f, 0.837566614f},
-std::array<float,2>{0.576694906f, 0.510575593f},
-std::array<float,2>{0.359539211f, 0.0781830624f},
-std::array<float,2>{0.709512949f, 0.129908472f},
-std::array<float,2>{0.390934646f, 0.63704437f},
-std::array<float,2>{0.825238049f, 0.926702201f},
-std::array<float,2>{0.0694064125f, 0.368902504f},
-std::array<float,2>{0.667608261f, 0.382751375f},
-std::array<float,2>{0.484380275f, 0.765854955f},
-std::array<float,2>{0.77965951f, 0.579784155f},
-std::array<float,2>{0.0497001708f, 0.0411342271f},
-std::array<float,2>{0.940920889f, 0.216263235f},
-std::array<float,2>{0.149885997f, 0.722685933f},
-std::array<float,2>{0.550447524f, 0.998142362f},
-std::array<float,2>{0.306857109f, 0.257086545f},
-std::array<float,2>{0.850134075f, 0.327144057f},
-std::array<float,2>{0.109454699f, 0.887801886f},
-std::array<float,2>{0.747739613f, 0.664099932f},
-std::array<float,2>{0.423675269f, 0.180821687f},
-std::array<float,2>{0.596363008f, 0.114186049f},
-std::array<float,2>{0.337129325f, 0.553767622f},
-std::array<float,2>{0.915224135f, 0.866177857f},
-std::array<float,2>{0.243179381f, 0.438941032f},
-std::array<float,2>{0.57998991f, 0.457726091f},
-std::array<float,2>{0.354492605f, 0.858974516f},
-std::array<float,2>{0.890925348f, 0.53431052f},
-std::array<float,2>{0.189281508f, 0.0946126953f},
-std::array<float,2>{0.832226276f, 0.171125263f},
-std::array<float,2>{0.0881757215f, 0.682093143f},
-std::array<float,2>{0.693494797f, 0.900573015f},
-std::array<float,2>{0.390322208f, 0.335815847f},
-std::array<float,2>{0.976490796f, 0.273959309f},
-std::array<float,2>{0.177640975f, 0.977533937f},
-std::array<float,2>{0.522072494f, 0.736195922f},
-std::array<float,2>{0.252780914f, 0.194411337f},
-std::array<float,2>{0.65073055f, 0.0588329658f},
-std::array<float,2>{0.438030958f, 0.56913954f},
-std::array<float,2>{0.787786067f, 0.756697059f},
-std::array<float,2>{0.0267416146f, 0.392820507f},
-std::array<float,2>{0.721090972f, 0.350360274f},
-std::array<float,2>{0.409890652f, 0.915304422f},
-std::array<float,2>{0.867353797f, 0.645361543f},
-std::array<float,2>{0.0959430188f, 0.145585105f},
-std::array<float,2>{0.933525741f, 0.0683652163f},
-std::array<float,2>{0.222964644f, 0.52886045f},
-std::array<float,2>{0.623929799f, 0.813468754f},
-std::array<float,2>{0.314352542f, 0.487003446f},
-std::array<float,2>{0.753413379f, 0.429830015f},
-std::array<float,2>{0.0387775823f, 0.789815605f},
-std::array<float,2>{0.68022126f, 0.594488502f},
-std::array<float,2>{0.483622402f, 0.0115379291f},
-std::array<float,2>{0.538711786f, 0.23129566f},
-std::array<float,2>{0.28898707f, 0.699465454f},
-std::array<float,2>{0.959482312f, 0.942292511f},
-std::array<float,2>{0.134072408f, 0.292574823f},
-std::array<float,2>{0.60135597f, 0.289022535f},
-std::array<float,2>{0.340697348f, 0.947741687f},
-std::array<float,2>{0.919879138f, 0.689641893f},
-std::array<float,2>{0.249109969f, 0.221474573f},
-std::array<float,2>{0.844054222f, 0.00405914383f},
-std::array<float,2>{0.116416276f, 0.60269469f},
-std::array<float,2>{0.744568527f, 0.781530499f},
-std::array<float,2>{0.429243624f, 0.425951928f},
-std::array<float,2>{0.944043517f, 0.498992085f},
-std::array<float,2>{0.15455541f, 0.827127635f},
-std::array<float,2>{0.553779721f, 0.522946417f},
-std::array<float,2>{0.309540331f, 0.0775228515f},
-std::array<float,2>{0.668933868f, 0.155928031f},
-std::array<float,2>{0.48996979f, 0.653556049f},
-std::array<float,2>{0.776691854f, 0.907305479f},
-std::array<float,2>{0.05283802f, 0.355123311f},
-std::array<float,2>{0.704157531f, 0.403288662f},
-std::array<float,2>{0.395631671f, 0.762008965f},
-std::array<float,2>{0.822400689f, 0.576488614f},
-std::array<float,2>{0.0655205548f, 0.0506930053f},
-std::array<float,2>{0.879920959f, 0.196927831f},
-std::array<float,2>{0.218132138f, 0.746747017f},
-std::array<float,2>{0.572283149f, 0.972983718f},
-std::array<float,2>{0.364429176f, 0.269525647f},
-std::array<float,2>{0.804182351f, 0.342112929f},
-std::array<float,2>{0.00390099618f, 0.897476792f},
-std::array<float,2>{0.636451006f, 0.678994238f},
-std::array<float,2>{0.459394097f, 0.162358791f},
-std::array<float,2>{0.509207249f, 0.107082695f},
-std::array<float,2>{0.28060028f, 0.540496707f},
-std::array<float,2>{0.988856852f, 0.850397885f},
-std::array<float,2>{0.171479404f, 0.466419995f},
-std::array<float,2>{0.533847809f, 0.447032362f},
-std::array<float,2>{0.28261289f, 0.869695842f},
-std::array<float,2>{0.955301285f, 0.560932815f},
-std::array<float,2>{0.140056267f, 0.12254899f},
-std::array<float,2>{0.75780344f, 0.175204635f},
-std::array<float,2>{0.0340647772f, 0.656406224f},
-std::array<float,2>{0.684524059f, 0.877566099f},
-std::array<float,2>{0.478388071f, 0.313329935f},
-std::array<float,2>{0.937109828f, 0.260476857f},
-std::array<float,2>{0.220780432f, 0.985590219f},
-std::array<float,2>{0.617964268f, 0.726718724f},
-std::array<float,2>{0.3170937f, 0.204531297f},
-std::array<float,2>{0.726533949f, 0.0365099721f},
-std::array<float,2>{0.413773566f, 0.593420982f},
-std::array<float,2>{0.871934831f, 0.779233098f},
-std::array<float,2>{0.0979719982f, 0.38763234f},
-std::array<float,2>{0.656047463f, 0.35942471f},
-std::array<float,2>{0.444021016f, 0.931733072f},
-std::array<float,2>{0.784092665f, 0.630932331f},
-std::array<float,2>{0.028038213f, 0.134568125f},
-std::array<float,2>{0.968898535f, 0.0864452124f},
-std::array<float,2>{0.175268739f, 0.505438864f},
-std::array<float,2>{0.517615736f, 0.831810534f},
-std::array<float,2>{0.254156202f, 0.474566936f},
-std::array<float,2>{0.828908265f, 0.413820177f},
-std::array<float,2>{0.0921961665f, 0.799895525f},
-std::array<float,2>{0.688434005f, 0.620321393f},
-std::array<float,2>{0.38602224f, 0.0249062907f},
-std::array<float,2>{0.582346976f, 0.249158412f},
-std::array<float,2>{0.355729491f, 0.716167331f},
-std::array<float,2>{0.896608591f, 0.964962184f},
-std::array<float,2>{0.191979825f, 0.310514629f},
-std::array<float,2>{0.526702642f, 0.322708338f},
-std::array<float,2>{0.260490865f, 0.88479799f},
-std::array<float,2>{0.982229292f, 0.670417905f},
-std::array<float,2>{0.184515342f, 0.185395017f},
-std::array<float,2>{0.796474993f, 0.109437533f},
-std::array<float,2>{0.0158117618f, 0.550561726f},
-std::array<float,2>{0.642899752f, 0.860623002f},
-std::array<float,2>{0.450818837f, 0.443019807f},
-std::array<float,2>{0.898730338f, 0.375510573f},
-std::array<float,2>{0.198784694f, 0.769616663f},
-std::array<float,2>{0.589513958f, 0.58563298f},
-std::array<float,2>{0.344689667f, 0.0466169119f},
-std::array<float,2>{0.702632964f, 0.213500559f},
-std::array<float,2>{0.375119179f, 0.720644593f},
-std::array<float,2>{0.837583542f, 0.99318105f},
-std::array<float,2>{0.0804605111f, 0.250577688f},
-std::array<float,2>{0.675183177f, 0.477476954f},
-std::array<float,2>{0.475220054f, 0.840399504f},
-std::array<float,2>{0.764033079f, 0.514150918f},
-std::array<float,2>{0.0394992903f, 0.0827889442f},
-std::array<float,2>{0.961367249f, 0.128427938f},
-std::array<float,2>{0.128324941f, 0.633141935f},
-std::array<float,2>{0.54649508f, 0.922743022f},
-std::array<float,2>{0.291250736f, 0.371811897f},
-std::array<float,2>{0.861546755f, 0.297050923f},
-std::array<float,2>{0.10428375f, 0.956648529f},
-std::array<float,2>{0.728393793f, 0.707965672f},
-std::array<float,2>{0.418245792f, 0.237753063f},
-std::array<float,2>{0.6144678f, 0.0220266543f},
-std::array<float,2>{0.321602583f, 0.612680674f},
-std::array<float,2>{0.929587901f, 0.808152139f},
-std::array<float,2>{0.227767095f, 0.418360353f},
-std::array<float,2>{0.563465655f, 0.435467958f},
-std::array<float,2>{0.370472491f, 0.795520186f},
-std::array<float,2>{0.887983084f, 0.597987771f},
-std::array<float,2>{0.206851766f, 0.0119183501f},
-std::array<float,2>{0.817807317f, 0.230122879f},
-std::array<float,2>{0.0705818385f, 0.697480202f},
-std::array<float,2>{0.71300143f, 0.940488875f},
-std::array<float,2>{0.399209172f, 0.294176459f},
-std::array<float,2>{0.993756115f, 0.345239729f},
-std::array<float,2>{0.158557624f, 0.92137289f},
-std::array<float,2>{0.503571868f, 0.641885102f},
-std::array<float,2>{0.265707701f, 0.143459827f},
-std::array<float,2>{0.632334828f, 0.0650770739f},
-std::array<float,2>{0.467420965f, 0.524070919f},
-std::array<float,2>{0.808886468f, 0.816598296f},
-std::array<float,2>{0.0114464713f, 0.490081877f},
-std::array<float,2>{0.735223949f, 0.277523905f},
-std::array<float,2>{0.433585078f, 0.981208563f},
-std::array<float,2>{0.854004681f, 0.74140805f},
-std::array<float,2>{0.123209186f, 0.191153795f},
-std::array<float,2>{0.910300791f, 0.0562965609f},
-std::array<float,2>{0.236347407f, 0.564188898f},
-std::array<float,2>{0.60622412f, 0.7514714f},
-std::array<float,2>{0.331075549f, 0.397862732f},
-std::array<float,2>{0.772605002f, 0.453733683f},
-std::array<float,2>{0.0560725965f, 0.853995383f},
-std::array<float,2>{0.663907468f, 0.538552225f},
-std::array<float,2>{0.49686417f, 0.099717319f},
-std::array<float,2>{0.556104481f, 0.165298447f},
-std::array<float,2>{0.30351606f, 0.684623957f},
-std::array<float,2>{0.949209929f, 0.903675199f},
-std::array<float,2>{0.145859733f, 0.330086172f},
-std::array<float,2>{0.593090892f, 0.358796537f},
-std::array<float,2>{0.351467967f, 0.912227273f},
-std::array<float,2>{0.904131711f, 0.65028429f},
-std::array<float,2>{0.200502768f, 0.151411653f},
-std::array<float,2>{0.842328012f, 0.0705347657f},
-std::array<float,2>{0.0821835026f, 0.515674114f},
-std::array<float,2>{0.696456671f, 0.820957303f},
-std::array<float,2>{0.379424214f, 0.495574743f},
-std::array<float,2>{0.979853809f, 0.422376513f},
-std::array<float,2>{0.181839868f, 0.787817955f},
-std::array<float,2>{0.529840052f, 0.605767548f},
-std::array<float,2>{0.262070477f, 0.00332501321f},
-std::array<float,2>{0.646627903f, 0.223972678f},
-std::array<float,2>{0.448939025f, 0.6917606f},
-std::array<float,2>{0.790410459f, 0.952728927f},
-std::array<float,2>{0.0196446013f, 0.281463832f},
-std::array<float,2>{0.731676161f, 0.464503825f},
-std::array<float,2>{0.41769734f, 0.844545662f},
-std::array<float,2>{0.864452541f, 0.546611249f},
-std::array<float,2>{0.107552953f, 0.104272999f},
-std::array<float,2>{0.925274014f, 0.158538222f},
-std::array<float,2>{0.231970564f, 0.675494194f},
-std::array<float,2>{0.610369027f, 0.892930388f},
-std::array<float,2>{0.325924337f, 0.337159574f},
-std::array<float,2>{0.758857191f, 0.270649612f},
-std::array<float,2>{0.0467463695f, 0.969724596f},
-std::array<float,2>{0.67883414f, 0.743413985f},
-std::array<float,2>{0.468954325f, 0.202997103f},
-std::array<float,2>{0.540096045f, 0.0538888127f},
-std::array<float,2>{0.294722885f, 0.57247436f},
-std::array<float,2>{0.966574788f, 0.758607328f},
-std::array<float,2>{0.129175439f, 0.401630312f},
-std::array<float,2>{0.503943384f, 0.385110348f},
-std::array<float,2>{0.270481586f, 0.777058721f},
-std::array<float,2>{0.998279274f, 0.587075651f},
-std::array<float,2>{0.161614671f, 0.0321538746f},
-std::array<float,2>{0.806821942f, 0.209475413f},
-std::array<float,2>{0.0148658426f, 0.731928349f},
-std::array<float,2>{0.626763821f, 0.991496801f},
-std::array<float,2>{0.462598264f, 0.262705356f},
-std::array<float,2>{0.884082198f, 0.319158196f},
-std::array<float,2>{0.207037538f, 0.879058301f},
-std::array<float,2>{0.569515228f, 0.660333812f},
-std::array<float,2>{0.374922395f, 0.179557636f},
-std::array<float,2>{0.715863943f, 0.117610291f},
-std::array<float,2>{0.402638286f, 0.558453202f},
-std::array<float,2>{0.814874828f, 0.873896301f},
-std::array<float,2>{0.0778722242f, 0.449881345f},
-std::array<float,2>{0.659834266f, 0.306680083f},
-std::array<float,2>{0.493136644f, 0.961316526f},
-std::array<float,2>{0.766453326f, 0.711381555f},
-std::array<float,2>{0.0616324991f, 0.243153647f},
-std::array<float,2>{0.950442195f, 0.0293888841f},
-std::array<float,2>{0.141685694f, 0.622925758f},
-std::array<float,2>{0.562349737f, 0.803655207f},
-std::array<float,2>{0.300628662f, 0.408549696f},
-std::array<float,2>{0.857414186f, 0.470488757f},
-std::array<float,2>{0.118382454f, 0.833720505f},
-std::array<float,2>{0.741934061f, 0.501502872f},
-std::array<float,2>{0.436521381f, 0.0916104466f},
-std::array<float,2>{0.605201364f, 0.138200402f},
-std::array<float,2>{0.334189475f, 0.62840867f},
-std::array<float,2>{0.907372773f, 0.936166465f},
-std::array<float,2>{0.239842772f, 0.363507658f},
-std::array<float,2>{0.547688127f, 0.254356265f},
-std::array<float,2>{0.306282073f, 0.996893764f},
-std::array<float,2>{0.939073741f, 0.724930406f},
-std::array<float,2>{0.151858866f, 0.2173637f},
-std::array<float,2>{0.778824329f, 0.0406252146f},
-std::array<float,2>{0.0485831313f, 0.581476748f},
-std::array<float,2>{0.664501667f, 0.768936455f},
-std::array<float,2>{0.487745494f, 0.379618078f},
-std::array<float,2>{0.916254938f, 0.440633774f},
-std::array<float,2>{0.245630413f, 0.865137696f},
-std::array<float,2>{0.595133245f, 0.550877154f},
-std::array<float,2>{0.338979363f, 0.116851263f},
-std::array<float,2>{0.749333441f, 0.181777447f},
-std::array<float,2>{0.425162852f, 0.667655706f},
-std::array<float,2>{0.849317968f, 0.890076339f},
-std::array<float,2>{0.112695143f, 0.325725496f},
-std::array<float,2>{0.637645543f, 0.416202843f},
-std::array<float,2>{0.454533786f, 0.81002754f},
-std::array<float,2>{0.800710618f, 0.615854144f},
-std::array<float,2>{0.00406629965f, 0.0172635242f},
-std::array<float,2>{0.988254726f, 0.239253506f},
-std::array<float,2>{0.166795507f, 0.703444302f},
-std::array<float,2>{0.512179434f, 0.960910618f},
-std::array<float,2>{0.274302691f, 0.304095775f},
-std::array<float,2>{0.826497078f, 0.369346738f},
-std::array<float,2>{0.0669973716f, 0.92834717f},
-std::array<float,2>{0.70806253f, 0.640055299f},
-std::array<float,2>{0.39328444f, 0.132274255f},
-std::array<float,2>{0.575354695f, 0.0809681863f},
-std::array<float,2>{0.363181233f, 0.509707034f},
-std::array<float,2>{0.877643526f, 0.838090837f},
-std::array<float,2>{0.212117225f, 0.481278151f},
-std::array<float,2>{0.622943521f, 0.486057967f},
-std::array<float,2>{0.314659059f, 0.815434158f},
-std::array<float,2>{0.93152988f, 0.529355228f},
-std::array<float,2>{0.225298896f, 0.0668620095f},
-std::array<float,2>{0.870126426f, 0.146753103f},
-std::array<float,2>{0.0938803256f, 0.648335278f},
-std::array<float,2>{0.720198512f, 0.916041672f},
-std::array<float,2>{0.406545997f, 0.347683489f},
-std::array<float,2>{0.957983851f, 0.290076345f},
-std::array<float,2>{0.135694802f, 0.945062518f},
-std::array<float,2>{0.536421776f, 0.703015447f},
-std::array<float,2>{0.286246449f, 0.233469576f},
-std::array<float,2>{0.682457805f, 0.00830634218f},
-std::array<float,2>{0.482208163f, 0.595810831f},
-std::array<float,2>{0.751002908f, 0.792912066f},
-std::array<float,2>{0.036274001f, 0.432082921f},
-std::array<float,2>{0.691820264f, 0.332542628f},
-std::array<float,2>{0.387754917f, 0.898522913f},
-std::array<float,2>{0.834163249f, 0.681181431f},
-std::array<float,2>{0.0860466436f, 0.168955609f},
-std::array<float,2>{0.893111229f, 0.0975425541f},
-std::array<float,2>{0.189682111f, 0.532056332f},
-std::array<float,2>{0.582001448f, 0.856755674f},
-std::array<float,2>{0.351707071f, 0.45910573f},
-std::array<float,2>{0.786443114f, 0.390752405f},
-std::array<float,2>{0.0244638696f, 0.754818678f},
-std::array<float,2>{0.649387658f, 0.567628384f},
-std::array<float,2>{0.440040559f, 0.060955327f},
-std::array<float,2>{0.519685686f, 0.1922362f},
-std::array<float,2>{0.251388848f, 0.73696655f},
-std::array<float,2>{0.973321378f, 0.979121506f},
-std::array<float,2>{0.1796422f, 0.275581926f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.0530059151f, 0.0832452849f},
-std::array<float,2>{0.895413399f, 0.977474391f},
-std::array<float,2>{0.346364886f, 0.571603298f},
-std::array<float,2>{0.628373027f, 0.457728565f},
-std::array<float,2>{0.483990669f, 0.284535944f},
-std::array<float,2>{0.594737291f, 0.634863198f},
-std::array<float,2>{0.169910952f, 0.787977576f},
-std::array<float,2>{0.808493137f, 0.224077433f},
-std::array<float,2>{0.287286937f, 0.130849659f},
-std::array<float,2>{0.690911889f, 0.824376762f},
-std::array<float,2>{0.115913309f, 0.690692604f},
-std::array<float,2>{0.953877568f, 0.352432549f},
-std::array<float,2>{0.241385043f, 0.413141906f},
-std::array<float,2>{0.841367781f, 0.550021887f},
-std::array<float,2>{0.381845087f, 0.879265964f},
-std::array<float,2>{0.544529796f, 0.0159735903f},
-std::array<float,2>{0.133403808f, 0.198724002f},
-std::array<float,2>{0.766834676f, 0.778538227f},
-std::array<float,2>{0.45583722f, 0.657938182f},
-std::array<float,2>{0.583361924f, 0.269236028f},
-std::array<float,2>{0.314711392f, 0.497991592f},
-std::array<float,2>{0.674947798f, 0.601773083f},
-std::array<float,2>{0.0210977942f, 0.962650299f},
-std::array<float,2>{0.916353047f, 0.123349436f},
-std::array<float,2>{0.42907986f, 0.0555050746f},
-std::array<float,2>{0.511392951f, 0.913811803f},
-std::array<float,2>{0.215017885f, 0.52476728f},
-std::array<float,2>{0.86493969f, 0.399495095f},
-std::array<float,2>{0.0629854649f, 0.327343941f},
-std::array<float,2>{0.990062177f, 0.744591713f},
-std::array<float,2>{0.261118442f, 0.863830805f},
-std::array<float,2>{0.734749556f, 0.166070282f},
-std::array<float,2>{0.0949777886f, 0.186670601f},
-std::array<float,2>{0.947543323f, 0.848352134f},
-std::array<float,2>{0.301942796f, 0.730472624f},
-std::array<float,2>{0.715301991f, 0.342117608f},
-std::array<float,2>{0.402597487f, 0.379168689f},
-std::array<float,2>{0.553351402f, 0.510728657f},
-std::array<float,2>{0.223524466f, 0.928139508f},
-std::array<float,2>{0.81759882f, 0.0440759771f},
-std::array<float,2>{0.366715044f, 0.108078204f},
-std::array<float,2>{0.655932486f, 0.952589452f},
-std::array<float,2>{0.0425599515f, 0.61781776f},
-std::array<float,2>{0.887954235f, 0.470106721f},
-std::array<float,2>{0.187397555f, 0.253346622f},
-std::array<float,2>{0.791490912f, 0.680055678f},
-std::array<float,2>{0.493480265f, 0.765612781f},
-std::array<float,2>{0.624194443f, 0.217294529f},
-std::array<float,2>{0.192774996f, 0.00376617489f},
-std::array<float,2>{0.844650805f, 0.894608736f},
-std::array<float,2>{0.414122671f, 0.538244545f},
-std::array<float,2>{0.519373178f, 0.430938452f},
-std::array<float,2>{0.274295568f, 0.370916963f},
-std::array<float,2>{0.726129055f, 0.70907563f},
-std::array<float,2>{0.0796582326f, 0.830400705f},
-std::array<float,2>{0.970423639f, 0.141168132f},
-std::array<float,2>{0.448919177f, 0.238094032f},
-std::array<float,2>{0.573383272f, 0.799723625f},
-std::array<float,2>{0.146014333f, 0.649434566f},
-std::array<float,2>{0.763581991f, 0.301855087f},
-std::array<float,2>{0.00630438793f, 0.452901989f},
-std::array<float,2>{0.933420658f, 0.592622161f},
-std::array<float,2>{0.34033066f, 0.996102571f},
-std::array<float,2>{0.669673324f, 0.066864863f},
-std::array<float,2>{0.0932193249f, 0.0353275165f},
-std::array<float,2>{0.981113493f, 0.930853188f},
-std::array<float,2>{0.270027906f, 0.501145303f},
-std::array<float,2>{0.731800973f, 0.385193467f},
-std::array<float,2>{0.411219031f, 0.328417122f},
-std::array<float,2>{0.527792394f, 0.720181286f},
-std::array<float,2>{0.195653662f, 0.858004332f},
-std::array<float,2>{0.85368818f, 0.174433008f},
-std::array<float,2>{0.334243119f, 0.204906985f},
-std::array<float,2>{0.658138394f, 0.752495408f},
-std::array<float,2>{0.00891224761f, 0.679577589f},
-std::array<float,2>{0.922704995f, 0.26178056f},
-std::array<float,2>{0.151689559f, 0.480469882f},
-std::array<float,2>{0.753185391f, 0.610421777f},
-std::array<float,2>{0.445123404f, 0.937712729f},
-std::array<float,2>{0.565402985f, 0.101527922f},
-std::array<float,2>{0.234032184f, 0.152481452f},
-std::array<float,2>{0.827353418f, 0.837109685f},
-std::array<float,2>{0.394862711f, 0.717338562f},
-std::array<float,2>{0.555297673f, 0.361657888f},
-std::array<float,2>{0.311179161f, 0.428719074f},
-std::array<float,2>{0.709242284f, 0.54667443f},
-std::array<float,2>{0.102111101f, 0.902731657f},
-std::array<float,2>{0.943413496f, 0.0127011109f},
-std::array<float,2>{0.48958075f, 0.0737941563f},
-std::array<float,2>{0.609834552f, 0.986659288f},
-std::array<float,2>{0.175839305f, 0.579686821f},
-std::array<float,2>{0.785466671f, 0.441718072f},
-std::array<float,2>{0.0329075716f, 0.310690641f},
-std::array<float,2>{0.876961529f, 0.646439791f},
-std::array<float,2>{0.368121654f, 0.808891475f},
-std::array<float,2>{0.646638036f, 0.247373268f},
-std::array<float,2>{0.0260687675f, 0.231088743f},
-std::array<float,2>{0.911600947f, 0.791297913f},
-std::array<float,2>{0.325548112f, 0.629176736f},
-std::array<float,2>{0.687125146f, 0.289427966f},
-std::array<float,2>{0.462887764f, 0.466387868f},
-std::array<float,2>{0.591570199f, 0.562604308f},
-std::array<float,2>{0.130943567f, 0.975130796f},
-std::array<float,2>{0.775532246f, 0.0911122262f},
-std::array<float,2>{0.257808477f, 0.0282380655f},
-std::array<float,2>{0.747835517f, 0.885748208f},
-std::array<float,2>{0.0734637305f, 0.556910574f},
-std::array<float,2>{0.99266845f, 0.421079278f},
-std::array<float,2>{0.206966639f, 0.34877035f},
-std::array<float,2>{0.871077895f, 0.698338985f},
-std::array<float,2>{0.43355304f, 0.81412524f},
-std::array<float,2>{0.504714847f, 0.138976544f},
-std::array<float,2>{0.15913707f, 0.115252405f},
-std::array<float,2>{0.802236855f, 0.954029739f},
-std::array<float,2>{0.470876098f, 0.600616097f},
-std::array<float,2>{0.603103817f, 0.491133064f},
-std::array<float,2>{0.354207724f, 0.278957307f},
-std::array<float,2>{0.639435291f, 0.671382248f},
-std::array<float,2>{0.0582634471f, 0.767288506f},
-std::array<float,2>{0.904208302f, 0.193118453f},
-std::array<float,2>{0.384352833f, 0.16341956f},
-std::array<float,2>{0.533710063f, 0.87075901f},
-std::array<float,2>{0.243509635f, 0.738817871f},
-std::array<float,2>{0.831247509f, 0.318090796f},
-std::array<float,2>{0.117879428f, 0.395725757f},
-std::array<float,2>{0.965336561f, 0.520218074f},
-std::array<float,2>{0.290396452f, 0.920240223f},
-std::array<float,2>{0.698210001f, 0.0506022088f},
-std::array<float,2>{0.0148180705f, 0.0210072398f},
-std::array<float,2>{0.929053843f, 0.877152205f},
-std::array<float,2>{0.328741461f, 0.553745151f},
-std::array<float,2>{0.66290766f, 0.408493489f},
-std::array<float,2>{0.437504023f, 0.35880366f},
-std::array<float,2>{0.568960369f, 0.69192487f},
-std::array<float,2>{0.15263547f, 0.821636319f},
-std::array<float,2>{0.755463064f, 0.126993477f},
-std::array<float,2>{0.267803758f, 0.222448736f},
-std::array<float,2>{0.728938937f, 0.782654166f},
-std::array<float,2>{0.0893388689f, 0.637653232f},
-std::array<float,2>{0.979716599f, 0.288374364f},
-std::array<float,2>{0.201445088f, 0.453892469f},
-std::array<float,2>{0.856895268f, 0.575247169f},
-std::array<float,2>{0.407002628f, 0.981445611f},
-std::array<float,2>{0.523986161f, 0.0787475556f},
-std::array<float,2>{0.174104631f, 0.169446349f},
-std::array<float,2>{0.785093427f, 0.862208605f},
-std::array<float,2>{0.486009061f, 0.748383999f},
-std::array<float,2>{0.614036441f, 0.321516305f},
-std::array<float,2>{0.374325961f, 0.403149039f},
-std::array<float,2>{0.64317733f, 0.527676582f},
-std::array<float,2>{0.0390599445f, 0.909307897f},
-std::array<float,2>{0.880933523f, 0.0622829385f},
-std::array<float,2>{0.394163668f, 0.11884103f},
-std::array<float,2>{0.561979413f, 0.968679547f},
-std::array<float,2>{0.228845328f, 0.609154999f},
-std::array<float,2>{0.820932627f, 0.494957864f},
-std::array<float,2>{0.106797673f, 0.272928208f},
-std::array<float,2>{0.940859318f, 0.660574675f},
-std::array<float,2>{0.304939568f, 0.775533974f},
-std::array<float,2>{0.703668654f, 0.201867715f},
-std::array<float,2>{0.0761196911f, 0.211722657f},
-std::array<float,2>{0.996462166f, 0.75946945f},
-std::array<float,2>{0.25318706f, 0.686322689f},
-std::array<float,2>{0.745255649f, 0.254443586f},
-std::array<float,2>{0.435438365f, 0.476462871f},
-std::array<float,2>{0.502016902f, 0.624417484f},
-std::array<float,2>{0.209315836f, 0.948509872f},
-std::array<float,2>{0.872498453f, 0.103042305f},
-std::array<float,2>{0.323956758f, 0.0396609716f},
-std::array<float,2>{0.681939423f, 0.922603965f},
-std::array<float,2>{0.0311092734f, 0.512336314f},
-std::array<float,2>{0.908151925f, 0.377620757f},
-std::array<float,2>{0.128683954f, 0.337690055f},
-std::array<float,2>{0.779927135f, 0.727348447f},
-std::array<float,2>{0.465193242f, 0.845921099f},
-std::array<float,2>{0.588988304f, 0.181905583f},
-std::array<float,2>{0.248172194f, 0.0645952523f},
-std::array<float,2>{0.834929526f, 0.992459893f},
-std::array<float,2>{0.388308555f, 0.588686228f},
-std::array<float,2>{0.538238287f, 0.446473718f},
-std::array<float,2>{0.295523703f, 0.297129571f},
-std::array<float,2>{0.699905574f, 0.65580833f},
-std::array<float,2>{0.123878278f, 0.803182125f},
-std::array<float,2>{0.961083472f, 0.241951033f},
-std::array<float,2>{0.47525993f, 0.146147311f},
-std::array<float,2>{0.607485473f, 0.833135068f},
-std::array<float,2>{0.163511202f, 0.70433861f},
-std::array<float,2>{0.797384799f, 0.372101009f},
-std::array<float,2>{0.0597710274f, 0.434842646f},
-std::array<float,2>{0.899425328f, 0.532147944f},
-std::array<float,2>{0.356212914f, 0.892518818f},
-std::array<float,2>{0.632871747f, 0.00531951431f},
-std::array<float,2>{0.110543929f, 0.0948788971f},
-std::array<float,2>{0.960630774f, 0.943061113f},
-std::array<float,2>{0.281340569f, 0.613374472f},
-std::array<float,2>{0.691897154f, 0.477771461f},
-std::array<float,2>{0.377706915f, 0.261510193f},
-std::array<float,2>{0.541462541f, 0.672522247f},
-std::array<float,2>{0.235957578f, 0.754090667f},
-std::array<float,2>{0.838015914f, 0.210426614f},
-std::array<float,2>{0.348488033f, 0.17620562f},
-std::array<float,2>{0.629913747f, 0.851951241f},
-std::array<float,2>{0.0481221005f, 0.724303424f},
-std::array<float,2>{0.89427197f, 0.332564324f},
-std::array<float,2>{0.167718798f, 0.387731701f},
-std::array<float,2>{0.812036097f, 0.506995261f},
-std::array<float,2>{0.479332924f, 0.9349491f},
-std::array<float,2>{0.598075449f, 0.0319396853f},
-std::array<float,2>{0.214317292f, 0.243196562f},
-std::array<float,2>{0.862841427f, 0.807887375f},
-std::array<float,2>{0.42323482f, 0.642365396f},
-std::array<float,2>{0.515324533f, 0.30563736f},
-std::array<float,2>{0.261862487f, 0.440109521f},
-std::array<float,2>{0.739678681f, 0.584750533f},
-std::array<float,2>{0.0683183894f, 0.99149096f},
-std::array<float,2>{0.986274421f, 0.0750583559f},
-std::array<float,2>{0.458898365f, 0.00874412712f},
-std::array<float,2>{0.579706311f, 0.898561478f},
-std::array<float,2>{0.137683347f, 0.541312099f},
-std::array<float,2>{0.769946158f, 0.425430596f},
-std::array<float,2>{0.0172918364f, 0.364286095f},
-std::array<float,2>{0.920294404f, 0.711539209f},
-std::array<float,2>{0.317399174f, 0.843490899f},
-std::array<float,2>{0.679602802f, 0.1490895f},
-std::array<float,2>{0.0451845527f, 0.134538606f},
-std::array<float,2>{0.884772956f, 0.817451119f},
-std::array<float,2>{0.360160619f, 0.699498534f},
-std::array<float,2>{0.650279164f, 0.347369403f},
-std::array<float,2>{0.497055501f, 0.416725188f},
-std::array<float,2>{0.620545924f, 0.55875206f},
-std::array<float,2>{0.180901229f, 0.89057678f},
-std::array<float,2>{0.795406878f, 0.0272189286f},
-std::array<float,2>{0.300121188f, 0.0867226571f},
-std::array<float,2>{0.71257937f, 0.969323874f},
-std::array<float,2>{0.100744702f, 0.568638861f},
-std::array<float,2>{0.951311707f, 0.461071759f},
-std::array<float,2>{0.220859826f, 0.295659572f},
-std::array<float,2>{0.814133823f, 0.628761232f},
-std::array<float,2>{0.402119815f, 0.793929458f},
-std::array<float,2>{0.547691524f, 0.226610735f},
-std::array<float,2>{0.143009067f, 0.0540580824f},
-std::array<float,2>{0.759839892f, 0.917051733f},
-std::array<float,2>{0.451440185f, 0.51777488f},
-std::array<float,2>{0.577602029f, 0.390847862f},
-std::array<float,2>{0.337636262f, 0.315240383f},
-std::array<float,2>{0.66572988f, 0.736584127f},
-std::array<float,2>{0.000466207188f, 0.874658465f},
-std::array<float,2>{0.935338318f, 0.157086506f},
-std::array<float,2>{0.4207021f, 0.18968071f},
-std::array<float,2>{0.523180544f, 0.771462679f},
-std::array<float,2>{0.188650668f, 0.664151788f},
-std::array<float,2>{0.851488948f, 0.275789768f},
-std::array<float,2>{0.0844598711f, 0.488173634f},
-std::array<float,2>{0.974704921f, 0.596127868f},
-std::array<float,2>{0.281047344f, 0.957388937f},
-std::array<float,2>{0.718886614f, 0.113084935f},
-std::array<float,2>{0.0224798862f, 0.122847281f},
-std::array<float,2>{0.914509118f, 0.963837326f},
-std::array<float,2>{0.314204842f, 0.604161799f},
-std::array<float,2>{0.672430515f, 0.498446524f},
-std::array<float,2>{0.455045462f, 0.265835613f},
-std::array<float,2>{0.585272551f, 0.659128845f},
-std::array<float,2>{0.13610211f, 0.779785573f},
-std::array<float,2>{0.768901885f, 0.195785269f},
-std::array<float,2>{0.25921461f, 0.165724993f},
-std::array<float,2>{0.73633033f, 0.86543262f},
-std::array<float,2>{0.0662372634f, 0.742393911f},
-std::array<float,2>{0.990591049f, 0.325108021f},
-std::array<float,2>{0.21812439f, 0.400641888f},
-std::array<float,2>{0.865701556f, 0.5259884f},
-std::array<float,2>{0.427608579f, 0.911126614f},
-std::array<float,2>{0.50837183f, 0.0576026998f},
-std::array<float,2>{0.17161499f, 0.225269109f},
-std::array<float,2>{0.804983914f, 0.785396576f},
-std::array<float,2>{0.481335223f, 0.63299799f},
-std::array<float,2>{0.597480476f, 0.28212294f},
-std::array<float,2>{0.345168561f, 0.46068424f},
-std::array<float,2>{0.625894725f, 0.573494911f},
-std::array<float,2>{0.0525932051f, 0.980308235f},
-std::array<float,2>{0.896950662f, 0.0856343508f},
-std::array<float,2>{0.380420744f, 0.0180398151f},
-std::array<float,2>{0.546307564f, 0.882442117f},
-std::array<float,2>{0.239339203f, 0.547342241f},
-std::array<float,2>{0.842051566f, 0.411088109f},
-std::array<float,2>{0.115221664f, 0.354840755f},
-std::array<float,2>{0.956733644f, 0.688572109f},
-std::array<float,2>{0.285206467f, 0.827897072f},
-std::array<float,2>{0.689424813f, 0.131336614f},
-std::array<float,2>{0.0815962702f, 0.143197671f},
-std::array<float,2>{0.972479105f, 0.828182042f},
-std::array<float,2>{0.277202338f, 0.708478212f},
-std::array<float,2>{0.724032283f, 0.368809074f},
-std::array<float,2>{0.417560458f, 0.433062404f},
-std::array<float,2>{0.515853882f, 0.53559643f},
-std::array<float,2>{0.194803357f, 0.896561325f},
-std::array<float,2>{0.846683562f, 0.00123430917f},
-std::array<float,2>{0.342690378f, 0.0701186433f},
-std::array<float,2>{0.671324611f, 0.998430073f},
-std::array<float,2>{0.00402119104f, 0.590285361f},
-std::array<float,2>{0.931238472f, 0.449418694f},
-std::array<float,2>{0.14833501f, 0.303836852f},
-std::array<float,2>{0.764391541f, 0.651103258f},
-std::array<float,2>{0.445469797f, 0.797864437f},
-std::array<float,2>{0.572139323f, 0.234583363f},
-std::array<float,2>{0.225405157f, 0.0466426089f},
-std::array<float,2>{0.819706857f, 0.927017987f},
-std::array<float,2>{0.405923873f, 0.508499801f},
-std::array<float,2>{0.552255988f, 0.381747097f},
-std::array<float,2>{0.303370982f, 0.341161549f},
-std::array<float,2>{0.717694402f, 0.733916342f},
-std::array<float,2>{0.095821701f, 0.849651515f},
-std::array<float,2>{0.945687056f, 0.185173109f},
-std::array<float,2>{0.494472295f, 0.215572447f},
-std::array<float,2>{0.62122947f, 0.762020051f},
-std::array<float,2>{0.184980586f, 0.682572484f},
-std::array<float,2>{0.790476024f, 0.251668394f},
-std::array<float,2>{0.0409719609f, 0.472088337f},
-std::array<float,2>{0.890236795f, 0.620415151f},
-std::array<float,2>{0.364922464f, 0.950504005f},
-std::array<float,2>{0.653469741f, 0.107230648f},
-std::array<float,2>{0.103944875f, 0.0148735065f},
-std::array<float,2>{0.941817939f, 0.904929876f},
-std::array<float,2>{0.308911592f, 0.544231534f},
-std::array<float,2>{0.707616746f, 0.426286101f},
-std::array<float,2>{0.397339821f, 0.359399289f},
-std::array<float,2>{0.558360398f, 0.715223014f},
-std::array<float,2>{0.232182369f, 0.837993503f},
-std::array<float,2>{0.824322879f, 0.155273616f},
-std::array<float,2>{0.370607376f, 0.248195484f},
-std::array<float,2>{0.645902157f, 0.811789811f},
-std::array<float,2>{0.0342712179f, 0.646486342f},
-std::array<float,2>{0.875904381f, 0.309771121f},
-std::array<float,2>{0.178378806f, 0.443434566f},
-std::array<float,2>{0.787561238f, 0.580586374f},
-std::array<float,2>{0.491899729f, 0.985155344f},
-std::array<float,2>{0.612316906f, 0.0711318105f},
-std::array<float,2>{0.197817251f, 0.17203401f},
-std::array<float,2>{0.851870477f, 0.856560349f},
-std::array<float,2>{0.412219912f, 0.722184479f},
-std::array<float,2>{0.530956388f, 0.330722958f},
-std::array<float,2>{0.272033751f, 0.384567261f},
-std::array<float,2>{0.732980907f, 0.502956808f},
-std::array<float,2>{0.0900348797f, 0.933328032f},
-std::array<float,2>{0.983021498f, 0.038187772f},
-std::array<float,2>{0.442677945f, 0.097903572f},
-std::array<float,2>{0.563140571f, 0.939606369f},
-std::array<float,2>{0.149177685f, 0.612923086f},
-std::array<float,2>{0.751493037f, 0.482927352f},
-std::array<float,2>{0.0111060143f, 0.26551491f},
-std::array<float,2>{0.925371289f, 0.676349401f},
-std::array<float,2>{0.333932906f, 0.751289546f},
-std::array<float,2>{0.65847528f, 0.206446037f},
-std::array<float,2>{0.0556186624f, 0.194037259f},
-std::array<float,2>{0.905287623f, 0.768963099f},
-std::array<float,2>{0.35302034f, 0.668263257f},
-std::array<float,2>{0.637666821f, 0.280850768f},
-std::array<float,2>{0.470521092f, 0.489649028f},
-std::array<float,2>{0.605235934f, 0.59884578f},
-std::array<float,2>{0.157891437f, 0.955948055f},
-std::array<float,2>{0.802887857f, 0.114789598f},
-std::array<float,2>{0.29242751f, 0.0481543057f},
-std::array<float,2>{0.697201967f, 0.918223441f},
-std::array<float,2>{0.120464079f, 0.52207762f},
-std::array<float,2>{0.966857612f, 0.397219151f},
-std::array<float,2>{0.245473877f, 0.319916159f},
-std::array<float,2>{0.829004169f, 0.740342379f},
-std::array<float,2>{0.386241674f, 0.867916346f},
-std::array<float,2>{0.532058299f, 0.161276415f},
-std::array<float,2>{0.129175946f, 0.0919823498f},
-std::array<float,2>{0.774484158f, 0.973742306f},
-std::array<float,2>{0.463525116f, 0.564532816f},
-std::array<float,2>{0.592038929f, 0.468436986f},
-std::array<float,2>{0.326368511f, 0.291502208f},
-std::array<float,2>{0.684065044f, 0.632202446f},
-std::array<float,2>{0.0251539852f, 0.789267778f},
-std::array<float,2>{0.912587345f, 0.233893111f},
-std::array<float,2>{0.431573302f, 0.138411865f},
-std::array<float,2>{0.506550431f, 0.815261602f},
-std::array<float,2>{0.20352447f, 0.695941746f},
-std::array<float,2>{0.868746698f, 0.349914312f},
-std::array<float,2>{0.0718804896f, 0.418307543f},
-std::array<float,2>{0.994403481f, 0.55522579f},
-std::array<float,2>{0.254143238f, 0.884762049f},
-std::array<float,2>{0.748404682f, 0.0305089466f},
-std::array<float,2>{0.0361188576f, 0.0600166321f},
-std::array<float,2>{0.879679084f, 0.907673359f},
-std::array<float,2>{0.372213244f, 0.531007349f},
-std::array<float,2>{0.641801536f, 0.406178772f},
-std::array<float,2>{0.487989366f, 0.322931767f},
-std::array<float,2>{0.615958214f, 0.746774316f},
-std::array<float,2>{0.172483563f, 0.860395968f},
-std::array<float,2>{0.781795859f, 0.1706101f},
-std::array<float,2>{0.308007807f, 0.200333267f},
-std::array<float,2>{0.706207454f, 0.775013208f},
-std::array<float,2>{0.107981928f, 0.662734509f},
-std::array<float,2>{0.938485265f, 0.270961672f},
-std::array<float,2>{0.226861611f, 0.493669838f},
-std::array<float,2>{0.823843479f, 0.607418656f},
-std::array<float,2>{0.392383695f, 0.966006339f},
-std::array<float,2>{0.559309304f, 0.120293021f},
-std::array<float,2>{0.154342368f, 0.125878572f},
-std::array<float,2>{0.756219625f, 0.822343349f},
-std::array<float,2>{0.440259457f, 0.693719029f},
-std::array<float,2>{0.56729728f, 0.355966151f},
-std::array<float,2>{0.330901861f, 0.406594247f},
-std::array<float,2>{0.660854042f, 0.551784813f},
-std::array<float,2>{0.0130504109f, 0.875036716f},
-std::array<float,2>{0.927031636f, 0.0229775067f},
-std::array<float,2>{0.409801483f, 0.0809706002f},
-std::array<float,2>{0.526137173f, 0.983214438f},
-std::array<float,2>{0.201038629f, 0.577052295f},
-std::array<float,2>{0.85755384f, 0.456934124f},
-std::array<float,2>{0.0873182341f, 0.287107557f},
-std::array<float,2>{0.978100181f, 0.639500737f},
-std::array<float,2>{0.266558677f, 0.783987939f},
-std::array<float,2>{0.727292836f, 0.219546109f},
-std::array<float,2>{0.121698566f, 0.238880545f},
-std::array<float,2>{0.963645875f, 0.8021667f},
-std::array<float,2>{0.294242293f, 0.652745545f},
-std::array<float,2>{0.702617407f, 0.299860299f},
-std::array<float,2>{0.389154345f, 0.447648078f},
-std::array<float,2>{0.536605537f, 0.587661564f},
-std::array<float,2>{0.247957155f, 0.994901836f},
-std::array<float,2>{0.832163453f, 0.0634174421f},
-std::array<float,2>{0.359101921f, 0.00647490285f},
-std::array<float,2>{0.635024369f, 0.893334806f},
-std::array<float,2>{0.061337322f, 0.533623874f},
-std::array<float,2>{0.902225912f, 0.437188327f},
-std::array<float,2>{0.161411613f, 0.374094814f},
-std::array<float,2>{0.799486697f, 0.706468344f},
-std::array<float,2>{0.474106342f, 0.835885406f},
-std::array<float,2>{0.607385278f, 0.146713719f},
-std::array<float,2>{0.208934441f, 0.105109341f},
-std::array<float,2>{0.873483598f, 0.945533395f},
-std::array<float,2>{0.437311321f, 0.622445226f},
-std::array<float,2>{0.500152409f, 0.47431758f},
-std::array<float,2>{0.250290185f, 0.257466018f},
-std::array<float,2>{0.743731081f, 0.684453905f},
-std::array<float,2>{0.077624321f, 0.761671424f},
-std::array<float,2>{0.999120712f, 0.214418411f},
-std::array<float,2>{0.468023866f, 0.181107059f},
-std::array<float,2>{0.586488545f, 0.84521836f},
-std::array<float,2>{0.126120716f, 0.728927732f},
-std::array<float,2>{0.778654933f, 0.338843852f},
-std::array<float,2>{0.0292629488f, 0.376420498f},
-std::array<float,2>{0.908552229f, 0.514774382f},
-std::array<float,2>{0.321914494f, 0.925141573f},
-std::array<float,2>{0.680180848f, 0.0410735272f},
-std::array<float,2>{0.0687040091f, 0.0766275227f},
-std::array<float,2>{0.987036288f, 0.988522351f},
-std::array<float,2>{0.264069825f, 0.583436549f},
-std::array<float,2>{0.740435302f, 0.437675029f},
-std::array<float,2>{0.425012499f, 0.307835996f},
-std::array<float,2>{0.513433158f, 0.644313574f},
-std::array<float,2>{0.211602107f, 0.806375802f},
-std::array<float,2>{0.859722614f, 0.246070802f},
-std::array<float,2>{0.318408489f, 0.150791615f},
-std::array<float,2>{0.677076399f, 0.840060234f},
-std::array<float,2>{0.019259017f, 0.713947773f},
-std::array<float,2>{0.919307768f, 0.365827262f},
-std::array<float,2>{0.138674915f, 0.422563434f},
-std::array<float,2>{0.772491038f, 0.540448725f},
-std::array<float,2>{0.460498542f, 0.902309656f},
-std::array<float,2>{0.581834078f, 0.00999600813f},
-std::array<float,2>{0.237477973f, 0.207102731f},
-std::array<float,2>{0.837131023f, 0.757502615f},
-std::array<float,2>{0.376020759f, 0.674822628f},
-std::array<float,2>{0.540342808f, 0.258353174f},
-std::array<float,2>{0.284395844f, 0.480110705f},
-std::array<float,2>{0.694790602f, 0.616138041f},
-std::array<float,2>{0.111898102f, 0.943930209f},
-std::array<float,2>{0.957673848f, 0.0958154052f},
-std::array<float,2>{0.476993859f, 0.0346932746f},
-std::array<float,2>{0.599633574f, 0.935719669f},
-std::array<float,2>{0.164762229f, 0.504870057f},
-std::array<float,2>{0.81034863f, 0.390072376f},
-std::array<float,2>{0.049853716f, 0.335122973f},
-std::array<float,2>{0.891057968f, 0.725782871f},
-std::array<float,2>{0.351136625f, 0.854909539f},
-std::array<float,2>{0.632333755f, 0.179445952f},
-std::array<float,2>{0.00272309198f, 0.159749702f},
-std::array<float,2>{0.935673535f, 0.872706175f},
-std::array<float,2>{0.338031948f, 0.73494333f},
-std::array<float,2>{0.666956127f, 0.313901126f},
-std::array<float,2>{0.45033589f, 0.394357532f},
-std::array<float,2>{0.574940681f, 0.517427146f},
-std::array<float,2>{0.142078698f, 0.914700627f},
-std::array<float,2>{0.758922935f, 0.0517574362f},
-std::array<float,2>{0.277939051f, 0.110259987f},
-std::array<float,2>{0.722168148f, 0.960622907f},
-std::array<float,2>{0.0831645429f, 0.595499814f},
-std::array<float,2>{0.974238515f, 0.485399425f},
-std::array<float,2>{0.190893769f, 0.274472862f},
-std::array<float,2>{0.849170506f, 0.666091681f},
-std::array<float,2>{0.418368042f, 0.77253896f},
-std::array<float,2>{0.520805538f, 0.188321576f},
-std::array<float,2>{0.183126345f, 0.0243846476f},
-std::array<float,2>{0.794810593f, 0.887300551f},
-std::array<float,2>{0.499425411f, 0.561584532f},
-std::array<float,2>{0.618331075f, 0.415143907f},
-std::array<float,2>{0.363189161f, 0.344891071f},
-std::array<float,2>{0.652316153f, 0.702706277f},
-std::array<float,2>{0.0444225147f, 0.819305301f},
-std::array<float,2>{0.884052157f, 0.135314092f},
-std::array<float,2>{0.400235623f, 0.229058206f},
-std::array<float,2>{0.549109876f, 0.795117974f},
-std::array<float,2>{0.219084635f, 0.626405776f},
-std::array<float,2>{0.814872921f, 0.293075711f},
-std::array<float,2>{0.0992544517f, 0.463431984f},
-std::array<float,2>{0.949701071f, 0.568312585f},
-std::array<float,2>{0.296996683f, 0.972094297f},
-std::array<float,2>{0.714287579f, 0.0890668258f},
-std::array<float,2>{0.0410219133f, 0.105702356f},
-std::array<float,2>{0.886959493f, 0.949617624f},
-std::array<float,2>{0.36577329f, 0.619427502f},
-std::array<float,2>{0.654650211f, 0.470724344f},
-std::array<float,2>{0.492858797f, 0.250542849f},
-std::array<float,2>{0.623623252f, 0.682711244f},
-std::array<float,2>{0.185922816f, 0.763566911f},
-std::array<float,2>{0.792427957f, 0.216691867f},
-std::array<float,2>{0.301661342f, 0.183644548f},
-std::array<float,2>{0.716353536f, 0.850819468f},
-std::array<float,2>{0.0939088985f, 0.733297527f},
-std::array<float,2>{0.948441386f, 0.340037793f},
-std::array<float,2>{0.223815799f, 0.382054716f},
-std::array<float,2>{0.816796482f, 0.509329557f},
-std::array<float,2>{0.404048711f, 0.926741183f},
-std::array<float,2>{0.553957045f, 0.0455964245f},
-std::array<float,2>{0.144573495f, 0.236280501f},
-std::array<float,2>{0.762056231f, 0.797351956f},
-std::array<float,2>{0.447597831f, 0.652302921f},
-std::array<float,2>{0.57229495f, 0.303397804f},
-std::array<float,2>{0.341402858f, 0.450204879f},
-std::array<float,2>{0.668104351f, 0.591157138f},
-std::array<float,2>{0.00727181369f, 0.999662519f},
-std::array<float,2>{0.932610035f, 0.0687634498f},
-std::array<float,2>{0.415720075f, 7.94093794e-05f},
-std::array<float,2>{0.518116236f, 0.897988558f},
-std::array<float,2>{0.192315504f, 0.536150575f},
-std::array<float,2>{0.845185041f, 0.432536453f},
-std::array<float,2>{0.0782337785f, 0.367265463f},
-std::array<float,2>{0.969122827f, 0.707967043f},
-std::array<float,2>{0.274557769f, 0.829662263f},
-std::array<float,2>{0.725231588f, 0.143936172f},
-std::array<float,2>{0.11630746f, 0.132546321f},
-std::array<float,2>{0.954999387f, 0.826848328f},
-std::array<float,2>{0.288535535f, 0.688349009f},
-std::array<float,2>{0.690367103f, 0.35423252f},
-std::array<float,2>{0.381833017f, 0.411707103f},
-std::array<float,2>{0.543228626f, 0.547894418f},
-std::array<float,2>{0.241097912f, 0.881777704f},
-std::array<float,2>{0.840731323f, 0.0192905124f},
-std::array<float,2>{0.346825242f, 0.0840193331f},
-std::array<float,2>{0.627391219f, 0.979357064f},
-std::array<float,2>{0.0543165728f, 0.572360992f},
-std::array<float,2>{0.896199882f, 0.459424466f},
-std::array<float,2>{0.168829888f, 0.282237083f},
-std::array<float,2>{0.807550907f, 0.633947492f},
-std::array<float,2>{0.482455939f, 0.786343634f},
-std::array<float,2>{0.593821287f, 0.225695074f},
-std::array<float,2>{0.216147602f, 0.0583559722f},
-std::array<float,2>{0.863697708f, 0.911944866f},
-std::array<float,2>{0.428327054f, 0.526935339f},
-std::array<float,2>{0.510525167f, 0.40192759f},
-std::array<float,2>{0.260187298f, 0.325951904f},
-std::array<float,2>{0.735735714f, 0.743420959f},
-std::array<float,2>{0.064272441f, 0.866407275f},
-std::array<float,2>{0.989213586f, 0.164909795f},
-std::array<float,2>{0.456297964f, 0.196982563f},
-std::array<float,2>{0.582854867f, 0.781180203f},
-std::array<float,2>{0.134258702f, 0.659489751f},
-std::array<float,2>{0.765850961f, 0.266809225f},
-std::array<float,2>{0.0205066744f, 0.499251515f},
-std::array<float,2>{0.917176783f, 0.60543859f},
-std::array<float,2>{0.315457791f, 0.964701474f},
-std::array<float,2>{0.673908114f, 0.121274769f},
-std::array<float,2>{0.072760649f, 0.0293044485f},
-std::array<float,2>{0.99390626f, 0.883703232f},
-std::array<float,2>{0.256501198f, 0.556317568f},
-std::array<float,2>{0.746202588f, 0.419549406f},
-std::array<float,2>{0.432163656f, 0.350984126f},
-std::array<float,2>{0.505808175f, 0.697149634f},
-std::array<float,2>{0.205086365f, 0.815841556f},
-std::array<float,2>{0.869360745f, 0.136988327f},
-std::array<float,2>{0.325040251f, 0.233373672f},
-std::array<float,2>{0.686513066f, 0.790481269f},
-std::array<float,2>{0.0268746708f, 0.631288767f},
-std::array<float,2>{0.910701454f, 0.292157054f},
-std::array<float,2>{0.132111251f, 0.467090189f},
-std::array<float,2>{0.777325034f, 0.565711558f},
-std::array<float,2>{0.461312711f, 0.973481953f},
-std::array<float,2>{0.590037942f, 0.0933591425f},
-std::array<float,2>{0.242393717f, 0.160588652f},
-std::array<float,2>{0.830644786f, 0.869064331f},
-std::array<float,2>{0.383105874f, 0.741483152f},
-std::array<float,2>{0.535014749f, 0.318365693f},
-std::array<float,2>{0.290014952f, 0.397902519f},
-std::array<float,2>{0.69888407f, 0.522854507f},
-std::array<float,2>{0.118897215f, 0.919522405f},
-std::array<float,2>{0.966294229f, 0.0478244312f},
-std::array<float,2>{0.47265166f, 0.114151143f},
-std::array<float,2>{0.602373123f, 0.956748366f},
-std::array<float,2>{0.159588039f, 0.598059952f},
-std::array<float,2>{0.800868392f, 0.488868237f},
-std::array<float,2>{0.0571639426f, 0.279880673f},
-std::array<float,2>{0.902905703f, 0.669661343f},
-std::array<float,2>{0.354502678f, 0.767579377f},
-std::array<float,2>{0.640005648f, 0.194897026f},
-std::array<float,2>{0.0085629113f, 0.205809385f},
-std::array<float,2>{0.922941089f, 0.750046849f},
-std::array<float,2>{0.335282236f, 0.676845372f},
-std::array<float,2>{0.6570822f, 0.263914943f},
-std::array<float,2>{0.444059819f, 0.483467937f},
-std::array<float,2>{0.566011369f, 0.611924946f},
-std::array<float,2>{0.150774598f, 0.940530181f},
-std::array<float,2>{0.752669334f, 0.0990253165f},
-std::array<float,2>{0.270557523f, 0.037427377f},
-std::array<float,2>{0.731343687f, 0.931718767f},
-std::array<float,2>{0.0923590511f, 0.50202018f},
-std::array<float,2>{0.981746078f, 0.383485556f},
-std::array<float,2>{0.196701899f, 0.331148744f},
-std::array<float,2>{0.855397522f, 0.721611738f},
-std::array<float,2>{0.410551667f, 0.855634212f},
-std::array<float,2>{0.528792739f, 0.173035771f},
-std::array<float,2>{0.177432403f, 0.0715891048f},
-std::array<float,2>{0.786291063f, 0.98613286f},
-std::array<float,2>{0.488461971f, 0.581445336f},
-std::array<float,2>{0.611110806f, 0.44519344f},
-std::array<float,2>{0.368478298f, 0.308967113f},
-std::array<float,2>{0.648200035f, 0.648063123f},
-std::array<float,2>{0.0318639316f, 0.811432481f},
-std::array<float,2>{0.877951145f, 0.249787554f},
-std::array<float,2>{0.396041483f, 0.155020997f},
-std::array<float,2>{0.556271017f, 0.838883579f},
-std::array<float,2>{0.232977882f, 0.716616154f},
-std::array<float,2>{0.826419771f, 0.361248434f},
-std::array<float,2>{0.102661103f, 0.427729279f},
-std::array<float,2>{0.945144713f, 0.543303013f},
-std::array<float,2>{0.311670452f, 0.905464768f},
-std::array<float,2>{0.710924923f, 0.0138124069f},
-std::array<float,2>{0.0296056028f, 0.0421670713f},
-std::array<float,2>{0.906633794f, 0.924336016f},
-std::array<float,2>{0.323010772f, 0.514560223f},
-std::array<float,2>{0.683466494f, 0.37531957f},
-std::array<float,2>{0.466587067f, 0.339813888f},
-std::array<float,2>{0.588803887f, 0.729538381f},
-std::array<float,2>{0.127583876f, 0.843864977f},
-std::array<float,2>{0.78041172f, 0.179780781f},
-std::array<float,2>{0.252902359f, 0.213537678f},
-std::array<float,2>{0.744244456f, 0.760318279f},
-std::array<float,2>{0.074365519f, 0.68546325f},
-std::array<float,2>{0.997601509f, 0.255868375f},
-std::array<float,2>{0.210171223f, 0.473028749f},
-std::array<float,2>{0.871299684f, 0.62128675f},
-std::array<float,2>{0.433598489f, 0.94687134f},
-std::array<float,2>{0.50329119f, 0.104360461f},
-std::array<float,2>{0.16220291f, 0.147881553f},
-std::array<float,2>{0.798264861f, 0.833985567f},
-std::array<float,2>{0.476257116f, 0.70564878f},
-std::array<float,2>{0.608766735f, 0.373703033f},
-std::array<float,2>{0.357416034f, 0.436023295f},
-std::array<float,2>{0.634736598f, 0.534347236f},
-std::array<float,2>{0.0589600988f, 0.894312859f},
-std::array<float,2>{0.899163723f, 0.00763426535f},
-std::array<float,2>{0.38754335f, 0.0636925921f},
-std::array<float,2>{0.537315905f, 0.995579422f},
-std::array<float,2>{0.249285638f, 0.586863339f},
-std::array<float,2>{0.835904002f, 0.448498249f},
-std::array<float,2>{0.124047749f, 0.298838675f},
-std::array<float,2>{0.962560654f, 0.653633416f},
-std::array<float,2>{0.296773583f, 0.800948858f},
-std::array<float,2>{0.700956464f, 0.240184337f},
-std::array<float,2>{0.0883586258f, 0.220330253f},
-std::array<float,2>{0.978701591f, 0.784757614f},
-std::array<float,2>{0.268972158f, 0.639862359f},
-std::array<float,2>{0.729897738f, 0.285524696f},
-std::array<float,2>{0.407393336f, 0.455256164f},
-std::array<float,2>{0.525217712f, 0.577411175f},
-std::array<float,2>{0.202330232f, 0.983400464f},
-std::array<float,2>{0.856266499f, 0.0814350173f},
-std::array<float,2>{0.329763323f, 0.0220246911f},
-std::array<float,2>{0.663981855f, 0.876867592f},
-std::array<float,2>{0.0144277392f, 0.551107049f},
-std::array<float,2>{0.928148806f, 0.407814443f},
-std::array<float,2>{0.153848395f, 0.357280791f},
-std::array<float,2>{0.754830301f, 0.695174873f},
-std::array<float,2>{0.438685387f, 0.823762059f},
-std::array<float,2>{0.569886446f, 0.126502946f},
-std::array<float,2>{0.230400026f, 0.119976118f},
-std::array<float,2>{0.821572781f, 0.965231597f},
-std::array<float,2>{0.392798781f, 0.606198311f},
-std::array<float,2>{0.560736001f, 0.492961854f},
-std::array<float,2>{0.306403935f, 0.270223439f},
-std::array<float,2>{0.705010772f, 0.663316965f},
-std::array<float,2>{0.10592296f, 0.773700595f},
-std::array<float,2>{0.940373778f, 0.199486107f},
-std::array<float,2>{0.48467657f, 0.171551779f},
-std::array<float,2>{0.615213215f, 0.8600685f},
-std::array<float,2>{0.175460294f, 0.747959375f},
-std::array<float,2>{0.783911884f, 0.323831439f},
-std::array<float,2>{0.0372370072f, 0.404584557f},
-std::array<float,2>{0.882543921f, 0.530097008f},
-std::array<float,2>{0.373730332f, 0.907210529f},
-std::array<float,2>{0.644463778f, 0.059106987f},
-std::array<float,2>{0.100268491f, 0.0879593119f},
-std::array<float,2>{0.953121126f, 0.970980942f},
-std::array<float,2>{0.298977733f, 0.566758394f},
-std::array<float,2>{0.711344838f, 0.464651942f},
-std::array<float,2>{0.400567293f, 0.294072449f},
-std::array<float,2>{0.548043966f, 0.625854969f},
-std::array<float,2>{0.222318217f, 0.795931518f},
-std::array<float,2>{0.812597394f, 0.229665428f},
-std::array<float,2>{0.360478133f, 0.136192352f},
-std::array<float,2>{0.6485641f, 0.820107162f},
-std::array<float,2>{0.0468436666f, 0.701498926f},
-std::array<float,2>{0.885810316f, 0.344721079f},
-std::array<float,2>{0.180160537f, 0.414429218f},
-std::array<float,2>{0.796685636f, 0.560901165f},
-std::array<float,2>{0.49717173f, 0.88833648f},
-std::array<float,2>{0.619974077f, 0.0251975358f},
-std::array<float,2>{0.188393921f, 0.189094961f},
-std::array<float,2>{0.850050449f, 0.77181673f},
-std::array<float,2>{0.42111966f, 0.667759299f},
-std::array<float,2>{0.522183955f, 0.2738837f},
-std::array<float,2>{0.280214876f, 0.484563708f},
-std::array<float,2>{0.720097899f, 0.593995631f},
-std::array<float,2>{0.0850770324f, 0.959637165f},
-std::array<float,2>{0.976501644f, 0.110522032f},
-std::array<float,2>{0.452922612f, 0.0525047667f},
-std::array<float,2>{0.576441467f, 0.915956199f},
-std::array<float,2>{0.144345701f, 0.515703976f},
-std::array<float,2>{0.761715174f, 0.393463314f},
-std::array<float,2>{0.00169748184f, 0.313400954f},
-std::array<float,2>{0.934024334f, 0.73595655f},
-std::array<float,2>{0.335987508f, 0.871838689f},
-std::array<float,2>{0.664370775f, 0.159128353f},
-std::array<float,2>{0.0474030301f, 0.178553209f},
-std::array<float,2>{0.893003821f, 0.854034483f},
-std::array<float,2>{0.34909901f, 0.725396514f},
-std::array<float,2>{0.62966007f, 0.334757149f},
-std::array<float,2>{0.479972839f, 0.389201909f},
-std::array<float,2>{0.599565566f, 0.505277157f},
-std::array<float,2>{0.166520059f, 0.936730266f},
-std::array<float,2>{0.810647666f, 0.0339453295f},
-std::array<float,2>{0.28319636f, 0.097112596f},
-std::array<float,2>{0.693227708f, 0.944861889f},
-std::array<float,2>{0.10962297f, 0.617000639f},
-std::array<float,2>{0.959489048f, 0.47860831f},
-std::array<float,2>{0.235292464f, 0.259469211f},
-std::array<float,2>{0.839203f, 0.674506605f},
-std::array<float,2>{0.377935529f, 0.756286502f},
-std::array<float,2>{0.542966187f, 0.208359867f},
-std::array<float,2>{0.13801825f, 0.0115814619f},
-std::array<float,2>{0.770862162f, 0.900531888f},
-std::array<float,2>{0.457856804f, 0.539067268f},
-std::array<float,2>{0.579006195f, 0.423071891f},
-std::array<float,2>{0.316936284f, 0.366456658f},
-std::array<float,2>{0.678324759f, 0.713388562f},
-std::array<float,2>{0.01572573f, 0.841530323f},
-std::array<float,2>{0.920997262f, 0.152149722f},
-std::array<float,2>{0.422086477f, 0.244505286f},
-std::array<float,2>{0.513986766f, 0.805096805f},
-std::array<float,2>{0.212960556f, 0.64346391f},
-std::array<float,2>{0.862221003f, 0.307508379f},
-std::array<float,2>{0.0666518062f, 0.43856293f},
-std::array<float,2>{0.985240281f, 0.582059205f},
-std::array<float,2>{0.263671219f, 0.989460826f},
-std::array<float,2>{0.738668144f, 0.0771693066f},
-std::array<float,2>{0.00539330253f, 0.0674875379f},
-std::array<float,2>{0.929728568f, 0.997493565f},
-std::array<float,2>{0.343390107f, 0.593536615f},
-std::array<float,2>{0.670106173f, 0.451451808f},
-std::array<float,2>{0.446890354f, 0.301018596f},
-std::array<float,2>{0.570787668f, 0.64864403f},
-std::array<float,2>{0.147143006f, 0.800454438f},
-std::array<float,2>{0.765551865f, 0.236760303f},
-std::array<float,2>{0.275985867f, 0.142559826f},
-std::array<float,2>{0.723017097f, 0.831679225f},
-std::array<float,2>{0.080990918f, 0.71086657f},
-std::array<float,2>{0.970894814f, 0.369998217f},
-std::array<float,2>{0.1939293f, 0.430181146f},
-std::array<float,2>{0.846616447f, 0.53714931f},
-std::array<float,2>{0.416740894f, 0.896157682f},
-std::array<float,2>{0.517053664f, 0.00254191947f},
-std::array<float,2>{0.184126601f, 0.217925996f},
-std::array<float,2>{0.789617717f, 0.763943255f},
-std::array<float,2>{0.495566994f, 0.681114435f},
-std::array<float,2>{0.62243253f, 0.252357244f},
-std::array<float,2>{0.363482088f, 0.469435066f},
-std::array<float,2>{0.65261662f, 0.61828351f},
-std::array<float,2>{0.0396385826f, 0.951860845f},
-std::array<float,2>{0.888679326f, 0.109224051f},
-std::array<float,2>{0.404703945f, 0.0439372174f},
-std::array<float,2>{0.551052213f, 0.929502845f},
-std::array<float,2>{0.225979432f, 0.511290967f},
-std::array<float,2>{0.818692863f, 0.380800724f},
-std::array<float,2>{0.0974046886f, 0.343329996f},
-std::array<float,2>{0.947003901f, 0.731914401f},
-std::array<float,2>{0.304415315f, 0.849166036f},
-std::array<float,2>{0.718740284f, 0.185960636f},
-std::array<float,2>{0.0646532476f, 0.167585731f},
-std::array<float,2>{0.991669357f, 0.864548564f},
-std::array<float,2>{0.258040607f, 0.74521333f},
-std::array<float,2>{0.737786829f, 0.327117354f},
-std::array<float,2>{0.426103264f, 0.39884311f},
-std::array<float,2>{0.509617567f, 0.523603261f},
-std::array<float,2>{0.21720852f, 0.912350774f},
-std::array<float,2>{0.86636436f, 0.0560153164f},
-std::array<float,2>{0.312988997f, 0.124363609f},
-std::array<float,2>{0.673201621f, 0.961073935f},
-std::array<float,2>{0.021698216f, 0.602706194f},
-std::array<float,2>{0.915353715f, 0.496426195f},
-std::array<float,2>{0.134792015f, 0.268115133f},
-std::array<float,2>{0.768190742f, 0.656654954f},
-std::array<float,2>{0.45389536f, 0.778068423f},
-std::array<float,2>{0.584951401f, 0.197407499f},
-std::array<float,2>{0.2391316f, 0.0170311816f},
-std::array<float,2>{0.842861235f, 0.880668461f},
-std::array<float,2>{0.379274338f, 0.549063921f},
-std::array<float,2>{0.545272529f, 0.412839204f},
-std::array<float,2>{0.286658913f, 0.352777481f},
-std::array<float,2>{0.688381076f, 0.689915419f},
-std::array<float,2>{0.113483585f, 0.825890005f},
-std::array<float,2>{0.955206633f, 0.129136071f},
-std::array<float,2>{0.481760651f, 0.223357841f},
-std::array<float,2>{0.595986545f, 0.788223326f},
-std::array<float,2>{0.17074272f, 0.636232734f},
-std::array<float,2>{0.806560218f, 0.283909172f},
-std::array<float,2>{0.0512612425f, 0.458410829f},
-std::array<float,2>{0.897882462f, 0.571222365f},
-std::array<float,2>{0.344641f, 0.97822082f},
-std::array<float,2>{0.626710594f, 0.0824289694f},
-std::array<float,2>{0.119886309f, 0.0495826341f},
-std::array<float,2>{0.968285859f, 0.921141028f},
-std::array<float,2>{0.291957319f, 0.520947576f},
-std::array<float,2>{0.695793927f, 0.39490813f},
-std::array<float,2>{0.385175943f, 0.317348659f},
-std::array<float,2>{0.533131659f, 0.739424706f},
-std::array<float,2>{0.244478136f, 0.869727492f},
-std::array<float,2>{0.829746068f, 0.162134275f},
-std::array<float,2>{0.352283448f, 0.19197388f},
-std::array<float,2>{0.638408482f, 0.766209602f},
-std::array<float,2>{0.0556956008f, 0.670576751f},
-std::array<float,2>{0.904323518f, 0.277803242f},
-std::array<float,2>{0.157112285f, 0.491301715f},
-std::array<float,2>{0.804368258f, 0.600025654f},
-std::array<float,2>{0.469153672f, 0.954844773f},
-std::array<float,2>{0.604216933f, 0.117097504f},
-std::array<float,2>{0.204853386f, 0.140521631f},
-std::array<float,2>{0.867615879f, 0.813462555f},
-std::array<float,2>{0.430030853f, 0.697812319f},
-std::array<float,2>{0.506905973f, 0.348215669f},
-std::array<float,2>{0.255685002f, 0.420662999f},
-std::array<float,2>{0.749798954f, 0.558365405f},
-std::array<float,2>{0.0705087855f, 0.884997189f},
-std::array<float,2>{0.996073365f, 0.0284499396f},
-std::array<float,2>{0.464024574f, 0.0902237296f},
-std::array<float,2>{0.593563735f, 0.976121664f},
-std::array<float,2>{0.130605385f, 0.564098418f},
-std::array<float,2>{0.773819685f, 0.464853764f},
-std::array<float,2>{0.0241266843f, 0.290878803f},
-std::array<float,2>{0.913731635f, 0.630363882f},
-std::array<float,2>{0.327412218f, 0.792181551f},
-std::array<float,2>{0.685300171f, 0.232145846f},
-std::array<float,2>{0.0339740515f, 0.246440515f},
-std::array<float,2>{0.876635849f, 0.810112298f},
-std::array<float,2>{0.369864047f, 0.644786835f},
-std::array<float,2>{0.644636333f, 0.312207878f},
-std::array<float,2>{0.49025616f, 0.443336278f},
-std::array<float,2>{0.612167895f, 0.578835011f},
-std::array<float,2>{0.179347277f, 0.987889469f},
-std::array<float,2>{0.788906038f, 0.0726448447f},
-std::array<float,2>{0.310233116f, 0.0123341018f},
-std::array<float,2>{0.708827436f, 0.903864086f},
-std::array<float,2>{0.105393872f, 0.545014739f},
-std::array<float,2>{0.9431144f, 0.428472698f},
-std::array<float,2>{0.231137812f, 0.362791628f},
-std::array<float,2>{0.826143026f, 0.718729556f},
-std::array<float,2>{0.397686779f, 0.836075783f},
-std::array<float,2>{0.556790948f, 0.153633818f},
-std::array<float,2>{0.149708986f, 0.100583583f},
-std::array<float,2>{0.750488639f, 0.93905288f},
-std::array<float,2>{0.442107856f, 0.609839559f},
-std::array<float,2>{0.564399838f, 0.481541157f},
-std::array<float,2>{0.33293277f, 0.263448507f},
-std::array<float,2>{0.659366965f, 0.678404927f},
-std::array<float,2>{0.0107053043f, 0.753263533f},
-std::array<float,2>{0.924378335f, 0.203896239f},
-std::array<float,2>{0.413990378f, 0.174889877f},
-std::array<float,2>{0.529681027f, 0.858403683f},
-std::array<float,2>{0.198554069f, 0.71900475f},
-std::array<float,2>{0.85319066f, 0.32981056f},
-std::array<float,2>{0.0916638672f, 0.386178643f},
-std::array<float,2>{0.984038532f, 0.50016892f},
-std::array<float,2>{0.272807032f, 0.929974318f},
-std::array<float,2>{0.733780861f, 0.0369600765f},
-std::array<float,2>{0.0621016733f, 0.00419516908f},
-std::array<float,2>{0.901261091f, 0.89135623f},
-std::array<float,2>{0.357622087f, 0.532543778f},
-std::array<float,2>{0.63580209f, 0.434010983f},
-std::array<float,2>{0.472866237f, 0.37145412f},
-std::array<float,2>{0.605961978f, 0.703167439f},
-std::array<float,2>{0.161039978f, 0.832710326f},
-std::array<float,2>{0.80035156f, 0.144821256f},
-std::array<float,2>{0.293928474f, 0.240299523f},
-std::array<float,2>{0.701325238f, 0.804463685f},
-std::array<float,2>{0.122812226f, 0.65457952f},
-std::array<float,2>{0.96439755f, 0.298040658f},
-std::array<float,2>{0.246609345f, 0.445641011f},
-std::array<float,2>{0.833348513f, 0.589755833f},
-std::array<float,2>{0.390111238f, 0.99331975f},
-std::array<float,2>{0.535382688f, 0.0655467659f},
-std::array<float,2>{0.125622422f, 0.18301253f},
-std::array<float,2>{0.77759707f, 0.847399056f},
-std::array<float,2>{0.4674353f, 0.727976084f},
-std::array<float,2>{0.587279022f, 0.336182505f},
-std::array<float,2>{0.321200073f, 0.378094435f},
-std::array<float,2>{0.680794597f, 0.513355672f},
-std::array<float,2>{0.0282134712f, 0.923426986f},
-std::array<float,2>{0.909772575f, 0.0405144691f},
-std::array<float,2>{0.436480343f, 0.102193385f},
-std::array<float,2>{0.501078248f, 0.947331667f},
-std::array<float,2>{0.207860202f, 0.623522222f},
-std::array<float,2>{0.874338508f, 0.474974811f},
-std::array<float,2>{0.0765630528f, 0.255715102f},
-std::array<float,2>{0.998133481f, 0.687318683f},
-std::array<float,2>{0.251512289f, 0.75786382f},
-std::array<float,2>{0.742452264f, 0.212683439f},
-std::array<float,2>{0.109152205f, 0.202701598f},
-std::array<float,2>{0.937640131f, 0.77654773f},
-std::array<float,2>{0.30757606f, 0.661588132f},
-std::array<float,2>{0.705482781f, 0.27219975f},
-std::array<float,2>{0.390882552f, 0.495469064f},
-std::array<float,2>{0.559913039f, 0.607913911f},
-std::array<float,2>{0.22767967f, 0.967749f},
-std::array<float,2>{0.823014438f, 0.117204085f},
-std::array<float,2>{0.371404201f, 0.0609563924f},
-std::array<float,2>{0.641024292f, 0.909063578f},
-std::array<float,2>{0.0363969132f, 0.529101491f},
-std::array<float,2>{0.880703807f, 0.403416693f},
-std::array<float,2>{0.173495963f, 0.321064115f},
-std::array<float,2>{0.782326818f, 0.749871731f},
-std::array<float,2>{0.486513376f, 0.863265097f},
-std::array<float,2>{0.617141366f, 0.168204352f},
-std::array<float,2>{0.200183094f, 0.0792158097f},
-std::array<float,2>{0.858985722f, 0.980599165f},
-std::array<float,2>{0.408760577f, 0.574380517f},
-std::array<float,2>{0.526764214f, 0.45430389f},
-std::array<float,2>{0.266979933f, 0.288021147f},
-std::array<float,2>{0.728181899f, 0.638508439f},
-std::array<float,2>{0.0865046754f, 0.781251311f},
-std::array<float,2>{0.97723186f, 0.220767617f},
-std::array<float,2>{0.440735459f, 0.128338635f},
-std::array<float,2>{0.568054438f, 0.821288764f},
-std::array<float,2>{0.155318111f, 0.692677379f},
-std::array<float,2>{0.756907403f, 0.358105332f},
-std::array<float,2>{0.0125456117f, 0.409202337f},
-std::array<float,2>{0.926463485f, 0.553641379f},
-std::array<float,2>{0.331913352f, 0.878112674f},
-std::array<float,2>{0.661603272f, 0.0196940713f},
-std::array<float,2>{0.0825177878f, 0.11201591f},
-std::array<float,2>{0.973089635f, 0.958470702f},
-std::array<float,2>{0.278600723f, 0.597243071f},
-std::array<float,2>{0.721396148f, 0.487119138f},
-std::array<float,2>{0.419117421f, 0.276928753f},
-std::array<float,2>{0.519546628f, 0.665907562f},
-std::array<float,2>{0.190233052f, 0.770154476f},
-std::array<float,2>{0.848026097f, 0.191154659f},
-std::array<float,2>{0.339125872f, 0.157761842f},
-std::array<float,2>{0.667685986f, 0.873853564f},
-std::array<float,2>{0.00359681924f, 0.737417817f},
-std::array<float,2>{0.93741852f, 0.316200793f},
-std::array<float,2>{0.141179845f, 0.392329782f},
-std::array<float,2>{0.758468807f, 0.518727899f},
-std::array<float,2>{0.449834734f, 0.916899145f},
-std::array<float,2>{0.575671911f, 0.0534133762f},
-std::array<float,2>{0.220039502f, 0.22799176f},
-std::array<float,2>{0.816266418f, 0.794364929f},
-std::array<float,2>{0.399367362f, 0.627908111f},
-std::array<float,2>{0.549888074f, 0.29650107f},
-std::array<float,2>{0.298549324f, 0.462345183f},
-std::array<float,2>{0.712898433f, 0.569605649f},
-std::array<float,2>{0.0976688042f, 0.970503211f},
-std::array<float,2>{0.950290859f, 0.0876763463f},
-std::array<float,2>{0.498433679f, 0.0255659893f},
-std::array<float,2>{0.617792845f, 0.888890266f},
-std::array<float,2>{0.182223514f, 0.55968219f},
-std::array<float,2>{0.793532372f, 0.417389631f},
-std::array<float,2>{0.0435389243f, 0.346569389f},
-std::array<float,2>{0.883420825f, 0.70087415f},
-std::array<float,2>{0.362192541f, 0.816438019f},
-std::array<float,2>{0.650429428f, 0.133067086f},
-std::array<float,2>{0.0184926614f, 0.149433687f},
-std::array<float,2>{0.918475628f, 0.842701495f},
-std::array<float,2>{0.320160627f, 0.711961508f},
-std::array<float,2>{0.676231086f, 0.363545388f},
-std::array<float,2>{0.459176898f, 0.424680769f},
-std::array<float,2>{0.580668032f, 0.542669952f},
-std::array<float,2>{0.139986202f, 0.899814129f},
-std::array<float,2>{0.772157252f, 0.00947211031f},
-std::array<float,2>{0.265287459f, 0.0760617033f},
-std::array<float,2>{0.741330087f, 0.99030757f},
-std::array<float,2>{0.0694849044f, 0.585466921f},
-std::array<float,2>{0.987684608f, 0.441134542f},
-std::array<float,2>{0.212117791f, 0.306471735f},
-std::array<float,2>{0.860582769f, 0.641322255f},
-std::array<float,2>{0.424453557f, 0.806896627f},
-std::array<float,2>{0.511873662f, 0.242864743f},
-std::array<float,2>{0.165755674f, 0.032429032f},
-std::array<float,2>{0.808906376f, 0.934410095f},
-std::array<float,2>{0.477852076f, 0.506101787f},
-std::array<float,2>{0.600925803f, 0.38759467f},
-std::array<float,2>{0.34991464f, 0.333210677f},
-std::array<float,2>{0.631719887f, 0.722995341f},
-std::array<float,2>{0.0488399863f, 0.852557123f},
-std::array<float,2>{0.892335713f, 0.177319512f},
-std::array<float,2>{0.375374734f, 0.209894478f},
-std::array<float,2>{0.539734185f, 0.75532645f},
-std::array<float,2>{0.236493483f, 0.67329371f},
-std::array<float,2>{0.83646512f, 0.259978086f},
-std::array<float,2>{0.112667292f, 0.477088153f},
-std::array<float,2>{0.958414078f, 0.614946485f},
-std::array<float,2>{0.283677459f, 0.941490531f},
-std::array<float,2>{0.693935812f, 0.0942969695f},
-std::array<float,2>{0.0312864445f, 0.0731215328f},
-std::array<float,2>{0.878703535f, 0.987664342f},
-std::array<float,2>{0.369091362f, 0.578259051f},
-std::array<float,2>{0.647877157f, 0.44271189f},
-std::array<float,2>{0.489098787f, 0.31172961f},
-std::array<float,2>{0.610566258f, 0.645044446f},
-std::array<float,2>{0.176818445f, 0.809806466f},
-std::array<float,2>{0.786778629f, 0.246803209f},
-std::array<float,2>{0.312235266f, 0.153933153f},
-std::array<float,2>{0.710431337f, 0.836624086f},
-std::array<float,2>{0.103395388f, 0.717921317f},
-std::array<float,2>{0.944388151f, 0.363109648f},
-std::array<float,2>{0.232499421f, 0.427800804f},
-std::array<float,2>{0.826997161f, 0.545524418f},
-std::array<float,2>{0.395620525f, 0.90370959f},
-std::array<float,2>{0.555962801f, 0.0118617257f},
-std::array<float,2>{0.150882214f, 0.20323354f},
-std::array<float,2>{0.752334595f, 0.753489912f},
-std::array<float,2>{0.443790764f, 0.677836657f},
-std::array<float,2>{0.565615296f, 0.262774885f},
-std::array<float,2>{0.335553139f, 0.482050091f},
-std::array<float,2>{0.656677902f, 0.609901309f},
-std::array<float,2>{0.00801621098f, 0.93867135f},
-std::array<float,2>{0.923467517f, 0.0997937992f},
-std::array<float,2>{0.410744131f, 0.0362892039f},
-std::array<float,2>{0.528930366f, 0.930389762f},
-std::array<float,2>{0.197060645f, 0.50058192f},
-std::array<float,2>{0.854822755f, 0.386249661f},
-std::array<float,2>{0.092117615f, 0.329263687f},
-std::array<float,2>{0.982405663f, 0.719603896f},
-std::array<float,2>{0.271152079f, 0.859119833f},
-std::array<float,2>{0.730578959f, 0.175668776f},
-std::array<float,2>{0.11840184f, 0.163025215f},
-std::array<float,2>{0.966544986f, 0.869587064f},
-std::array<float,2>{0.289309353f, 0.740060389f},
-std::array<float,2>{0.698374927f, 0.316799462f},
-std::array<float,2>{0.383534074f, 0.395155668f},
-std::array<float,2>{0.534234405f, 0.521118283f},
-std::array<float,2>{0.243005246f, 0.921570539f},
-std::array<float,2>{0.830556691f, 0.0490993559f},
-std::array<float,2>{0.355182379f, 0.116442397f},
-std::array<float,2>{0.640467465f, 0.954366982f},
-std::array<float,2>{0.0566417128f, 0.600306809f},
-std::array<float,2>{0.902507007f, 0.49185434f},
-std::array<float,2>{0.160141081f, 0.278201073f},
-std::array<float,2>{0.801426232f, 0.670225322f},
-std::array<float,2>{0.472150326f, 0.765892565f},
-std::array<float,2>{0.601652384f, 0.191699594f},
-std::array<float,2>{0.205837652f, 0.0288684033f},
-std::array<float,2>{0.869916797f, 0.885574281f},
-std::array<float,2>{0.432095438f, 0.557967365f},
-std::array<float,2>{0.505293906f, 0.420247436f},
-std::array<float,2>{0.255861968f, 0.347842366f},
-std::array<float,2>{0.747046173f, 0.697604597f},
-std::array<float,2>{0.072366111f, 0.812899172f},
-std::array<float,2>{0.993315995f, 0.139753118f},
-std::array<float,2>{0.4615964f, 0.231664941f},
-std::array<float,2>{0.590336263f, 0.79272002f},
-std::array<float,2>{0.13238579f, 0.63041991f},
-std::array<float,2>{0.77640152f, 0.290153116f},
-std::array<float,2>{0.0265537463f, 0.46549806f},
-std::array<float,2>{0.910454333f, 0.563850582f},
-std::array<float,2>{0.324631453f, 0.976068795f},
-std::array<float,2>{0.685710609f, 0.0905205011f},
-std::array<float,2>{0.063626647f, 0.0561531708f},
-std::array<float,2>{0.988576353f, 0.912868261f},
-std::array<float,2>{0.260425121f, 0.523984134f},
-std::array<float,2>{0.736065984f, 0.399152547f},
-std::array<float,2>{0.428177655f, 0.326625347f},
-std::array<float,2>{0.510148942f, 0.745863914f},
-std::array<float,2>{0.216787457f, 0.864854276f},
-std::array<float,2>{0.863793373f, 0.167299256f},
-std::array<float,2>{0.316181004f, 0.197861701f},
-std::array<float,2>{0.674555063f, 0.777682304f},
-std::array<float,2>{0.0199180078f, 0.656978726f},
-std::array<float,2>{0.91792649f, 0.268057257f},
-std::array<float,2>{0.134447098f, 0.49663946f},
-std::array<float,2>{0.766242743f, 0.603366256f},
-std::array<float,2>{0.457010806f, 0.961607218f},
-std::array<float,2>{0.582430422f, 0.124516681f},
-std::array<float,2>{0.240622818f, 0.129429638f},
-std::array<float,2>{0.840308011f, 0.825362742f},
-std::array<float,2>{0.381024718f, 0.690047681f},
-std::array<float,2>{0.543772817f, 0.353412777f},
-std::array<float,2>{0.288695544f, 0.41240713f},
-std::array<float,2>{0.689749002f, 0.549419284f},
-std::array<float,2>{0.116827786f, 0.880002618f},
-std::array<float,2>{0.954352021f, 0.0171997473f},
-std::array<float,2>{0.483096629f, 0.0829290226f},
-std::array<float,2>{0.594682992f, 0.977668881f},
-std::array<float,2>{0.168328881f, 0.57042402f},
-std::array<float,2>{0.807124972f, 0.458550841f},
-std::array<float,2>{0.0541328192f, 0.283489704f},
-std::array<float,2>{0.895656228f, 0.636217952f},
-std::array<float,2>{0.347417116f, 0.788937032f},
-std::array<float,2>{0.627449334f, 0.223082423f},
-std::array<float,2>{0.00737543404f, 0.236906901f},
-std::array<float,2>{0.931798816f, 0.79982686f},
-std::array<float,2>{0.340922266f, 0.648947775f},
-std::array<float,2>{0.668727636f, 0.30144003f},
-std::array<float,2>{0.447783083f, 0.451694101f},
-std::array<float,2>{0.573235571f, 0.592859685f},
-std::array<float,2>{0.145161092f, 0.997751951f},
-std::array<float,2>{0.762331247f, 0.068343468f},
-std::array<float,2>{0.275226653f, 0.00226381049f},
-std::array<float,2>{0.724918306f, 0.895789444f},
-std::array<float,2>{0.0790536925f, 0.537655234f},
-std::array<float,2>{0.969486117f, 0.429933488f},
-std::array<float,2>{0.19142285f, 0.369575679f},
-std::array<float,2>{0.845433116f, 0.710120916f},
-std::array<float,2>{0.415098906f, 0.831377923f},
-std::array<float,2>{0.517870128f, 0.141789317f},
-std::array<float,2>{0.186196908f, 0.108526491f},
-std::array<float,2>{0.792794824f, 0.951200962f},
-std::array<float,2>{0.492506772f, 0.618725181f},
-std::array<float,2>{0.623241842f, 0.468888611f},
-std::array<float,2>{0.365517557f, 0.252851188f},
-std::array<float,2>{0.655248463f, 0.681353509f},
-std::array<float,2>{0.0416979864f, 0.764539242f},
-std::array<float,2>{0.887357473f, 0.218311161f},
-std::array<float,2>{0.403481603f, 0.18647711f},
-std::array<float,2>{0.55441153f, 0.849030375f},
-std::array<float,2>{0.224545836f, 0.732143879f},
-std::array<float,2>{0.817065299f, 0.343241364f},
-std::array<float,2>{0.0946728885f, 0.379898161f},
-std::array<float,2>{0.949206889f, 0.511078f},
-std::array<float,2>{0.301173359f, 0.929090321f},
-std::array<float,2>{0.715954244f, 0.0432034135f},
-std::array<float,2>{0.0165095627f, 0.00893511716f},
-std::array<float,2>{0.921844959f, 0.899904072f},
-std::array<float,2>{0.316819698f, 0.542476416f},
-std::array<float,2>{0.67795682f, 0.423833936f},
-std::array<float,2>{0.457414865f, 0.363983572f},
-std::array<float,2>{0.578245282f, 0.712813437f},
-std::array<float,2>{0.138572261f, 0.842226565f},
-std::array<float,2>{0.771055043f, 0.150092632f},
-std::array<float,2>{0.26301989f, 0.242301449f},
-std::array<float,2>{0.738807023f, 0.807137072f},
-std::array<float,2>{0.0672892034f, 0.640983105f},
-std::array<float,2>{0.984716833f, 0.306069642f},
-std::array<float,2>{0.213493258f, 0.44083938f},
-std::array<float,2>{0.861456335f, 0.58508563f},
-std::array<float,2>{0.422801495f, 0.990762532f},
-std::array<float,2>{0.514286637f, 0.0753141865f},
-std::array<float,2>{0.166411027f, 0.177220225f},
-std::array<float,2>{0.811282456f, 0.853214502f},
-std::array<float,2>{0.480271459f, 0.72317785f},
-std::array<float,2>{0.599051952f, 0.333565474f},
-std::array<float,2>{0.349492282f, 0.387051076f},
-std::array<float,2>{0.629252732f, 0.506638467f},
-std::array<float,2>{0.0471666157f, 0.93394202f},
-std::array<float,2>{0.893507302f, 0.0328860469f},
-std::array<float,2>{0.378474265f, 0.0942195132f},
-std::array<float,2>{0.542412162f, 0.942062914f},
-std::array<float,2>{0.234420061f, 0.614390492f},
-std::array<float,2>{0.839609146f, 0.476861894f},
-std::array<float,2>{0.11005751f, 0.260654032f},
-std::array<float,2>{0.959447265f, 0.673824012f},
-std::array<float,2>{0.282444656f, 0.755377769f},
-std::array<float,2>{0.692758799f, 0.2090801f},
-std::array<float,2>{0.0857686549f, 0.190878585f},
-std::array<float,2>{0.975953579f, 0.769860923f},
-std::array<float,2>{0.279377013f, 0.665252566f},
-std::array<float,2>{0.72039181f, 0.276460916f},
-std::array<float,2>{0.42183727f, 0.486748874f},
-std::array<float,2>{0.521859109f, 0.596834898f},
-std::array<float,2>{0.187797189f, 0.958585441f},
-std::array<float,2>{0.850157201f, 0.111687414f},
-std::array<float,2>{0.336476654f, 0.0527398027f},
-std::array<float,2>{0.664764583f, 0.91641283f},
-std::array<float,2>{0.00105613051f, 0.51949954f},
-std::array<float,2>{0.934543967f, 0.392003953f},
-std::array<float,2>{0.143782049f, 0.315676957f},
-std::array<float,2>{0.761194766f, 0.738099456f},
-std::array<float,2>{0.452227801f, 0.873354375f},
-std::array<float,2>{0.576950848f, 0.157256201f},
-std::array<float,2>{0.222061068f, 0.0872675255f},
-std::array<float,2>{0.813230395f, 0.969821811f},
-std::array<float,2>{0.401150852f, 0.570042431f},
-std::array<float,2>{0.548772573f, 0.462715209f},
-std::array<float,2>{0.299447507f, 0.296156466f},
-std::array<float,2>{0.711432219f, 0.626980543f},
-std::array<float,2>{0.0999673605f, 0.794514477f},
-std::array<float,2>{0.952203155f, 0.228464723f},
-std::array<float,2>{0.497725606f, 0.13347052f},
-std::array<float,2>{0.619291425f, 0.817175686f},
-std::array<float,2>{0.180207387f, 0.700212181f},
-std::array<float,2>{0.796007812f, 0.345746368f},
-std::array<float,2>{0.04614418f, 0.417919964f},
-std::array<float,2>{0.886653781f, 0.560433269f},
-std::array<float,2>{0.361027777f, 0.88939321f},
-std::array<float,2>{0.649067223f, 0.0261444412f},
-std::array<float,2>{0.106010884f, 0.118046023f},
-std::array<float,2>{0.939926326f, 0.967155755f},
-std::array<float,2>{0.305992156f, 0.607738614f},
-std::array<float,2>{0.704417467f, 0.496021152f},
-std::array<float,2>{0.39321655f, 0.271956027f},
-std::array<float,2>{0.561050951f, 0.662106633f},
-std::array<float,2>{0.22996892f, 0.77690202f},
-std::array<float,2>{0.822140634f, 0.202479213f},
-std::array<float,2>{0.373052806f, 0.16867055f},
-std::array<float,2>{0.64380151f, 0.862532735f},
-std::array<float,2>{0.0380075499f, 0.749120235f},
-std::array<float,2>{0.882241488f, 0.320334584f},
-std::array<float,2>{0.174977794f, 0.403834134f},
-std::array<float,2>{0.783289492f, 0.52853632f},
-std::array<float,2>{0.485106379f, 0.908218563f},
-std::array<float,2>{0.614687085f, 0.0610371269f},
-std::array<float,2>{0.202727124f, 0.221213102f},
-std::array<float,2>{0.855851352f, 0.78219521f},
-std::array<float,2>{0.408075958f, 0.637917459f},
-std::array<float,2>{0.524662852f, 0.287195921f},
-std::array<float,2>{0.269236326f, 0.454723746f},
-std::array<float,2>{0.73023057f, 0.574872017f},
-std::array<float,2>{0.0886863098f, 0.98104322f},
-std::array<float,2>{0.97907269f, 0.0798626915f},
-std::array<float,2>{0.439353526f, 0.0204355214f},
-std::array<float,2>{0.569357038f, 0.87885493f},
-std::array<float,2>{0.153744251f, 0.552909255f},
-std::array<float,2>{0.754359126f, 0.409671873f},
-std::array<float,2>{0.0138137322f, 0.357871443f},
-std::array<float,2>{0.928677976f, 0.692953348f},
-std::array<float,2>{0.329469711f, 0.820703089f},
-std::array<float,2>{0.663334131f, 0.128898352f},
-std::array<float,2>{0.0594204478f, 0.145454779f},
-std::array<float,2>{0.898711562f, 0.832246542f},
-std::array<float,2>{0.356631458f, 0.70369041f},
-std::array<float,2>{0.634086072f, 0.3716833f},
-std::array<float,2>{0.475774139f, 0.434527665f},
-std::array<float,2>{0.609286487f, 0.533059359f},
-std::array<float,2>{0.162900984f, 0.890982211f},
-std::array<float,2>{0.798720658f, 0.00456445618f},
-std::array<float,2>{0.296229452f, 0.066085577f},
-std::array<float,2>{0.700680852f, 0.993815899f},
-std::array<float,2>{0.124804772f, 0.588984728f},
-std::array<float,2>{0.962367058f, 0.445834279f},
-std::array<float,2>{0.249552801f, 0.298656374f},
-std::array<float,2>{0.834979534f, 0.654919922f},
-std::array<float,2>{0.38683328f, 0.803767979f},
-std::array<float,2>{0.537805557f, 0.240974054f},
-std::array<float,2>{0.127332106f, 0.0408265702f},
-std::array<float,2>{0.78114152f, 0.923319817f},
-std::array<float,2>{0.465888232f, 0.512697995f},
-std::array<float,2>{0.587913096f, 0.378564656f},
-std::array<float,2>{0.322705626f, 0.336505175f},
-std::array<float,2>{0.682972431f, 0.728197157f},
-std::array<float,2>{0.0299280081f, 0.846935391f},
-std::array<float,2>{0.907035708f, 0.183183178f},
-std::array<float,2>{0.434533775f, 0.212340519f},
-std::array<float,2>{0.503844917f, 0.75850296f},
-std::array<float,2>{0.210488111f, 0.686813772f},
-std::array<float,2>{0.871821582f, 0.254989654f},
-std::array<float,2>{0.0751598403f, 0.475114286f},
-std::array<float,2>{0.997083604f, 0.6236673f},
-std::array<float,2>{0.251999229f, 0.948209286f},
-std::array<float,2>{0.744908869f, 0.101889685f},
-std::array<float,2>{0.0101202643f, 0.0993429571f},
-std::array<float,2>{0.924007416f, 0.941403627f},
-std::array<float,2>{0.332258165f, 0.611565053f},
-std::array<float,2>{0.659737706f, 0.484108835f},
-std::array<float,2>{0.441719443f, 0.264163643f},
-std::array<float,2>{0.563617408f, 0.677616715f},
-std::array<float,2>{0.150082678f, 0.750785828f},
-std::array<float,2>{0.750008762f, 0.205424502f},
-std::array<float,2>{0.27301982f, 0.17347756f},
-std::array<float,2>{0.73405242f, 0.856375456f},
-std::array<float,2>{0.0910970792f, 0.720709443f},
-std::array<float,2>{0.983688653f, 0.331967294f},
-std::array<float,2>{0.1989609f, 0.382873923f},
-std::array<float,2>{0.852762818f, 0.502771139f},
-std::array<float,2>{0.413404793f, 0.932177067f},
-std::array<float,2>{0.52987951f, 0.0378344245f},
-std::array<float,2>{0.178760216f, 0.24904117f},
-std::array<float,2>{0.788199484f, 0.81100291f},
-std::array<float,2>{0.490807414f, 0.647664666f},
-std::array<float,2>{0.611569226f, 0.309157461f},
-std::array<float,2>{0.36962381f, 0.444664747f},
-std::array<float,2>{0.645282924f, 0.581618428f},
-std::array<float,2>{0.0333373211f, 0.98575747f},
-std::array<float,2>{0.876416206f, 0.0719323158f},
-std::array<float,2>{0.398255259f, 0.0141705265f},
-std::array<float,2>{0.557163f, 0.906155705f},
-std::array<float,2>{0.230664641f, 0.543693125f},
-std::array<float,2>{0.825250447f, 0.426974624f},
-std::array<float,2>{0.104962364f, 0.360483706f},
-std::array<float,2>{0.942790449f, 0.716260612f},
-std::array<float,2>{0.309667379f, 0.839472473f},
-std::array<float,2>{0.708116412f, 0.154443651f},
-std::array<float,2>{0.0708983168f, 0.137396082f},
-std::array<float,2>{0.995580375f, 0.816116214f},
-std::array<float,2>{0.255035758f, 0.696477294f},
-std::array<float,2>{0.749506772f, 0.351185441f},
-std::array<float,2>{0.430330873f, 0.419286489f},
-std::array<float,2>{0.50768292f, 0.555938363f},
-std::array<float,2>{0.204240486f, 0.882875144f},
-std::array<float,2>{0.867922425f, 0.0302669946f},
-std::array<float,2>{0.327910095f, 0.0930631682f},
-std::array<float,2>{0.685039103f, 0.972805321f},
-std::array<float,2>{0.0237057153f, 0.565977335f},
-std::array<float,2>{0.913473845f, 0.467600107f},
-std::array<float,2>{0.129992038f, 0.292856246f},
-std::array<float,2>{0.774122477f, 0.631711006f},
-std::array<float,2>{0.464513659f, 0.790782869f},
-std::array<float,2>{0.592924595f, 0.232538998f},
-std::array<float,2>{0.245079875f, 0.0469138846f},
-std::array<float,2>{0.829259992f, 0.919323981f},
-std::array<float,2>{0.385600507f, 0.523075283f},
-std::array<float,2>{0.532527745f, 0.397952527f},
-std::array<float,2>{0.291155607f, 0.319257528f},
-std::array<float,2>{0.696046352f, 0.741699755f},
-std::array<float,2>{0.119571455f, 0.868252456f},
-std::array<float,2>{0.96820575f, 0.161080748f},
-std::array<float,2>{0.469541937f, 0.194779649f},
-std::array<float,2>{0.603712738f, 0.76836437f},
-std::array<float,2>{0.156301379f, 0.668980539f},
-std::array<float,2>{0.804171324f, 0.279321492f},
-std::array<float,2>{0.0564197414f, 0.48832041f},
-std::array<float,2>{0.904844522f, 0.598461211f},
-std::array<float,2>{0.351680875f, 0.956399143f},
-std::array<float,2>{0.63809973f, 0.113447763f},
-std::array<float,2>{0.114201955f, 0.0187759306f},
-std::array<float,2>{0.955742002f, 0.881118774f},
-std::array<float,2>{0.286302626f, 0.548483074f},
-std::array<float,2>{0.687919974f, 0.411596686f},
-std::array<float,2>{0.379830807f, 0.353636503f},
-std::array<float,2>{0.545582235f, 0.687718809f},
-std::array<float,2>{0.238570184f, 0.826255441f},
-std::array<float,2>{0.843742549f, 0.132126838f},
-std::array<float,2>{0.343978077f, 0.226475626f},
-std::array<float,2>{0.626314878f, 0.787037909f},
-std::array<float,2>{0.0517150275f, 0.634706259f},
-std::array<float,2>{0.898360848f, 0.282909751f},
-std::array<float,2>{0.170011386f, 0.45975709f},
-std::array<float,2>{0.805729985f, 0.573228061f},
-std::array<float,2>{0.482294053f, 0.97866863f},
-std::array<float,2>{0.596209764f, 0.0847792998f},
-std::array<float,2>{0.217371315f, 0.16428785f},
-std::array<float,2>{0.866707742f, 0.866820216f},
-std::array<float,2>{0.426487595f, 0.744025111f},
-std::array<float,2>{0.509084761f, 0.325662702f},
-std::array<float,2>{0.258394927f, 0.401421696f},
-std::array<float,2>{0.73783195f, 0.526373386f},
-std::array<float,2>{0.0650628358f, 0.91155684f},
-std::array<float,2>{0.991844058f, 0.0579206049f},
-std::array<float,2>{0.453431696f, 0.121672556f},
-std::array<float,2>{0.584392309f, 0.964025676f},
-std::array<float,2>{0.13527371f, 0.604768217f},
-std::array<float,2>{0.76779598f, 0.499799162f},
-std::array<float,2>{0.0223306455f, 0.267368555f},
-std::array<float,2>{0.915811896f, 0.660021305f},
-std::array<float,2>{0.31272766f, 0.780451715f},
-std::array<float,2>{0.673355818f, 0.196373522f},
-std::array<float,2>{0.0393449925f, 0.216264889f},
-std::array<float,2>{0.889191091f, 0.762979984f},
-std::array<float,2>{0.363788009f, 0.683571219f},
-std::array<float,2>{0.65313518f, 0.250191867f},
-std::array<float,2>{0.495818257f, 0.471396863f},
-std::array<float,2>{0.622900724f, 0.61971885f},
-std::array<float,2>{0.183623627f, 0.950084627f},
-std::array<float,2>{0.789075017f, 0.106423542f},
-std::array<float,2>{0.304064929f, 0.0452805795f},
-std::array<float,2>{0.717938781f, 0.92594862f},
-std::array<float,2>{0.0971430466f, 0.508886158f},
-std::array<float,2>{0.94634521f, 0.382767051f},
-std::array<float,2>{0.22652176f, 0.340611488f},
-std::array<float,2>{0.818923235f, 0.73281461f},
-std::array<float,2>{0.405229896f, 0.8512218f},
-std::array<float,2>{0.55155009f, 0.184355229f},
-std::array<float,2>{0.146706671f, 0.0689580441f},
-std::array<float,2>{0.764782906f, 0.999481618f},
-std::array<float,2>{0.446586698f, 0.591417849f},
-std::array<float,2>{0.570989847f, 0.450719535f},
-std::array<float,2>{0.342907637f, 0.302977949f},
-std::array<float,2>{0.670873821f, 0.651850581f},
-std::array<float,2>{0.00513013313f, 0.797731519f},
-std::array<float,2>{0.930460751f, 0.23566474f},
-std::array<float,2>{0.416227937f, 0.144208074f},
-std::array<float,2>{0.517289698f, 0.829402506f},
-std::array<float,2>{0.193817452f, 0.707467198f},
-std::array<float,2>{0.845990777f, 0.367896795f},
-std::array<float,2>{0.0804966465f, 0.43184045f},
-std::array<float,2>{0.971335411f, 0.536887825f},
-std::array<float,2>{0.275812805f, 0.897574604f},
-std::array<float,2>{0.723324955f, 0.000740483229f},
-std::array<float,2>{0.0493785441f, 0.0336614922f},
-std::array<float,2>{0.891696215f, 0.937063515f},
-std::array<float,2>{0.350548804f, 0.505813539f},
-std::array<float,2>{0.631165326f, 0.388789445f},
-std::array<float,2>{0.478212267f, 0.334436774f},
-std::array<float,2>{0.601559341f, 0.724926233f},
-std::array<float,2>{0.165051043f, 0.853652179f},
-std::array<float,2>{0.809280932f, 0.178161278f},
-std::array<float,2>{0.283743978f, 0.208834261f},
-std::array<float,2>{0.693533063f, 0.756516457f},
-std::array<float,2>{0.113135435f, 0.674035966f},
-std::array<float,2>{0.958960891f, 0.259148836f},
-std::array<float,2>{0.236970037f, 0.479244888f},
-std::array<float,2>{0.836368322f, 0.616372287f},
-std::array<float,2>{0.375954211f, 0.944608748f},
-std::array<float,2>{0.539385855f, 0.0974028111f},
-std::array<float,2>{0.140588313f, 0.151528805f},
-std::array<float,2>{0.771681905f, 0.840929985f},
-std::array<float,2>{0.459872097f, 0.713240564f},
-std::array<float,2>{0.580526531f, 0.366991282f},
-std::array<float,2>{0.319556057f, 0.423808157f},
-std::array<float,2>{0.676443875f, 0.539756477f},
-std::array<float,2>{0.0178456176f, 0.901163101f},
-std::array<float,2>{0.918090284f, 0.0110061103f},
-std::array<float,2>{0.423957914f, 0.0779886693f},
-std::array<float,2>{0.51265496f, 0.990107715f},
-std::array<float,2>{0.212480515f, 0.582814038f},
-std::array<float,2>{0.86087954f, 0.439210027f},
-std::array<float,2>{0.0699704438f, 0.306974292f},
-std::array<float,2>{0.987819552f, 0.643020034f},
-std::array<float,2>{0.264693409f, 0.805282474f},
-std::array<float,2>{0.742009103f, 0.244899184f},
-std::array<float,2>{0.0982777774f, 0.230150446f},
-std::array<float,2>{0.950798929f, 0.796415269f},
-std::array<float,2>{0.297907263f, 0.625197589f},
-std::array<float,2>{0.713737488f, 0.29474622f},
-std::array<float,2>{0.398851424f, 0.464200407f},
-std::array<float,2>{0.550396025f, 0.56729126f},
-std::array<float,2>{0.220573395f, 0.971673608f},
-std::array<float,2>{0.815880716f, 0.0888170898f},
-std::array<float,2>{0.3616952f, 0.0245018955f},
-std::array<float,2>{0.651074409f, 0.887777388f},
-std::array<float,2>{0.0432744622f, 0.561387002f},
-std::array<float,2>{0.883023024f, 0.414988935f},
-std::array<float,2>{0.181903392f, 0.344068676f},
-std::array<float,2>{0.793147087f, 0.701834857f},
-std::array<float,2>{0.498632669f, 0.819748998f},
-std::array<float,2>{0.617460728f, 0.136274993f},
-std::array<float,2>{0.189665899f, 0.11108382f},
-std::array<float,2>{0.848299563f, 0.959043622f},
-std::array<float,2>{0.419907689f, 0.594489753f},
-std::array<float,2>{0.520028591f, 0.48510617f},
-std::array<float,2>{0.279254198f, 0.274265081f},
-std::array<float,2>{0.720858455f, 0.66704762f},
-std::array<float,2>{0.0827850476f, 0.772303998f},
-std::array<float,2>{0.973183751f, 0.188958272f},
-std::array<float,2>{0.449294895f, 0.158663094f},
-std::array<float,2>{0.575948417f, 0.871421158f},
-std::array<float,2>{0.140698418f, 0.735756218f},
-std::array<float,2>{0.758286536f, 0.312559932f},
-std::array<float,2>{0.00298652123f, 0.392721951f},
-std::array<float,2>{0.93663919f, 0.51643008f},
-std::array<float,2>{0.339763671f, 0.91520071f},
-std::array<float,2>{0.667285919f, 0.0518281199f},
-std::array<float,2>{0.0860352069f, 0.0816420615f},
-std::array<float,2>{0.976580024f, 0.984100044f},
-std::array<float,2>{0.267458886f, 0.57778877f},
-std::array<float,2>{0.727635384f, 0.45561415f},
-std::array<float,2>{0.408556402f, 0.285701662f},
-std::array<float,2>{0.526870906f, 0.640178084f},
-std::array<float,2>{0.199664369f, 0.784628034f},
-std::array<float,2>{0.858460963f, 0.220025733f},
-std::array<float,2>{0.331165671f, 0.126055866f},
-std::array<float,2>{0.662006617f, 0.823280334f},
-std::array<float,2>{0.0121652791f, 0.69455725f},
-std::array<float,2>{0.926188588f, 0.356609434f},
-std::array<float,2>{0.155951902f, 0.407359332f},
-std::array<float,2>{0.757591724f, 0.55169034f},
-std::array<float,2>{0.441003263f, 0.876077533f},
-std::array<float,2>{0.567498922f, 0.0219403394f},
-std::array<float,2>{0.228115961f, 0.199959382f},
-std::array<float,2>{0.82271266f, 0.774202108f},
-std::array<float,2>{0.391295016f, 0.663982213f},
-std::array<float,2>{0.560348928f, 0.269810766f},
-std::array<float,2>{0.307067245f, 0.492381305f},
-std::array<float,2>{0.70586735f, 0.605778456f},
-std::array<float,2>{0.108792856f, 0.965654671f},
-std::array<float,2>{0.938163936f, 0.119425364f},
-std::array<float,2>{0.486976743f, 0.0589852594f},
-std::array<float,2>{0.616257429f, 0.906690776f},
-std::array<float,2>{0.172994897f, 0.529332995f},
-std::array<float,2>{0.782840908f, 0.404870301f},
-std::array<float,2>{0.0370060429f, 0.32349205f},
-std::array<float,2>{0.880094707f, 0.747348785f},
-std::array<float,2>{0.37186116f, 0.859378874f},
-std::array<float,2>{0.641572952f, 0.171001822f},
-std::array<float,2>{0.0276257936f, 0.18046768f},
-std::array<float,2>{0.909236252f, 0.844449639f},
-std::array<float,2>{0.320450842f, 0.730081499f},
-std::array<float,2>{0.681541622f, 0.339096159f},
-std::array<float,2>{0.467036247f, 0.375856578f},
-std::array<float,2>{0.587855458f, 0.513780057f},
-std::array<float,2>{0.125207424f, 0.924198389f},
-std::array<float,2>{0.778251052f, 0.0429219715f},
-std::array<float,2>{0.251306027f, 0.103922449f},
-std::array<float,2>{0.74300462f, 0.946728826f},
-std::array<float,2>{0.0767252967f, 0.621729434f},
-std::array<float,2>{0.998606682f, 0.473540217f},
-std::array<float,2>{0.207326457f, 0.256772399f},
-std::array<float,2>{0.874947965f, 0.684771657f},
-std::array<float,2>{0.435975343f, 0.759933352f},
-std::array<float,2>{0.501807213f, 0.213076636f},
-std::array<float,2>{0.160351083f, 0.00731396675f},
-std::array<float,2>{0.799889028f, 0.893843889f},
-std::array<float,2>{0.473255306f, 0.534952641f},
-std::array<float,2>{0.60570401f, 0.436432838f},
-std::array<float,2>{0.35803932f, 0.373443097f},
-std::array<float,2>{0.636253119f, 0.705443263f},
-std::array<float,2>{0.0619742088f, 0.834684074f},
-std::array<float,2>{0.900572896f, 0.148367986f},
-std::array<float,2>{0.390257597f, 0.239426717f},
-std::array<float,2>{0.535742402f, 0.801647604f},
-std::array<float,2>{0.246428445f, 0.653997183f},
-std::array<float,2>{0.833683074f, 0.299768418f},
-std::array<float,2>{0.122213729f, 0.44877097f},
-std::array<float,2>{0.964319289f, 0.586149335f},
-std::array<float,2>{0.293244779f, 0.995862544f},
-std::array<float,2>{0.701758742f, 0.0643046647f},
-std::array<float,2>{0.0578913763f, 0.114633113f},
-std::array<float,2>{0.903341234f, 0.955347002f},
-std::array<float,2>{0.353733212f, 0.599259794f},
-std::array<float,2>{0.638865113f, 0.490037203f},
-std::array<float,2>{0.471392065f, 0.280619502f},
-std::array<float,2>{0.602823198f, 0.668678045f},
-std::array<float,2>{0.158228189f, 0.769278407f},
-std::array<float,2>{0.802614868f, 0.193416148f},
-std::array<float,2>{0.290973186f, 0.161671892f},
-std::array<float,2>{0.697534442f, 0.867434263f},
-std::array<float,2>{0.11726778f, 0.741051853f},
-std::array<float,2>{0.964853466f, 0.319721818f},
-std::array<float,2>{0.244048536f, 0.396833628f},
-std::array<float,2>{0.832004607f, 0.521794319f},
-std::array<float,2>{0.384096891f, 0.918859661f},
-std::array<float,2>{0.533330858f, 0.0487438627f},
-std::array<float,2>{0.131688803f, 0.233813345f},
-std::array<float,2>{0.775970519f, 0.789783716f},
-std::array<float,2>{0.462003529f, 0.632636666f},
-std::array<float,2>{0.590923727f, 0.291588366f},
-std::array<float,2>{0.326149404f, 0.46807012f},
-std::array<float,2>{0.686713278f, 0.565404594f},
-std::array<float,2>{0.0254092738f, 0.97456193f},
-std::array<float,2>{0.91183126f, 0.0927090868f},
-std::array<float,2>{0.433036625f, 0.0310827419f},
-std::array<float,2>{0.504052341f, 0.884189963f},
-std::array<float,2>{0.206112564f, 0.554706037f},
-std::array<float,2>{0.870576739f, 0.418907374f},
-std::array<float,2>{0.0738535225f, 0.350432813f},
-std::array<float,2>{0.992703974f, 0.695722163f},
-std::array<float,2>{0.256869882f, 0.814590871f},
-std::array<float,2>{0.747447371f, 0.137733698f},
-std::array<float,2>{0.101827733f, 0.156135842f},
-std::array<float,2>{0.944156051f, 0.838573039f},
-std::array<float,2>{0.310881555f, 0.715687692f},
-std::array<float,2>{0.709897161f, 0.360030115f},
-std::array<float,2>{0.395317376f, 0.426265925f},
-std::array<float,2>{0.554889679f, 0.544863403f},
-std::array<float,2>{0.233458862f, 0.904726863f},
-std::array<float,2>{0.827689409f, 0.015354678f},
-std::array<float,2>{0.367635399f, 0.0706503615f},
-std::array<float,2>{0.647065759f, 0.98454839f},
-std::array<float,2>{0.0323343277f, 0.580539882f},
-std::array<float,2>{0.877636909f, 0.444287986f},
-std::array<float,2>{0.176401153f, 0.310264826f},
-std::array<float,2>{0.786051214f, 0.647121906f},
-std::array<float,2>{0.489902377f, 0.812161744f},
-std::array<float,2>{0.610285938f, 0.248657688f},
-std::array<float,2>{0.196042627f, 0.0385974087f},
-std::array<float,2>{0.854394913f, 0.932927251f},
-std::array<float,2>{0.41184184f, 0.503661752f},
-std::array<float,2>{0.528195262f, 0.384085119f},
-std::array<float,2>{0.269858181f, 0.330484539f},
-std::array<float,2>{0.732271075f, 0.722143114f},
-std::array<float,2>{0.0936573073f, 0.856972814f},
-std::array<float,2>{0.980809033f, 0.172760502f},
-std::array<float,2>{0.444425434f, 0.206924975f},
-std::array<float,2>{0.56458354f, 0.751788199f},
-std::array<float,2>{0.15226692f, 0.675848842f},
-std::array<float,2>{0.753730714f, 0.264901012f},
-std::array<float,2>{0.00939163007f, 0.482484728f},
-std::array<float,2>{0.922028422f, 0.612315714f},
-std::array<float,2>{0.33486709f, 0.940115929f},
-std::array<float,2>{0.657384872f, 0.0986267328f},
-std::array<float,2>{0.0793015957f, 0.00187067187f},
-std::array<float,2>{0.969846129f, 0.897047579f},
-std::array<float,2>{0.2735973f, 0.536097288f},
-std::array<float,2>{0.725804687f, 0.433347136f},
-std::array<float,2>{0.414800197f, 0.368575484f},
-std::array<float,2>{0.518817961f, 0.708570182f},
-std::array<float,2>{0.193085745f, 0.829091907f},
-std::array<float,2>{0.844172537f, 0.142995089f},
-std::array<float,2>{0.3406865f, 0.234891474f},
-std::array<float,2>{0.669430852f, 0.798355877f},
-std::array<float,2>{0.00643236097f, 0.65078342f},
-std::array<float,2>{0.932780504f, 0.304610819f},
-std::array<float,2>{0.145694345f, 0.449714214f},
-std::array<float,2>{0.762740195f, 0.590724826f},
-std::array<float,2>{0.448712528f, 0.998867512f},
-std::array<float,2>{0.574019492f, 0.0696250051f},
-std::array<float,2>{0.222770423f, 0.184958085f},
-std::array<float,2>{0.818105519f, 0.850428224f},
-std::array<float,2>{0.40319863f, 0.73381561f},
-std::array<float,2>{0.552959502f, 0.341595769f},
-std::array<float,2>{0.302339375f, 0.380945981f},
-std::array<float,2>{0.715768695f, 0.508128285f},
-std::array<float,2>{0.0955918804f, 0.927576959f},
-std::array<float,2>{0.947883189f, 0.0463702679f},
-std::array<float,2>{0.493794739f, 0.106575429f},
-std::array<float,2>{0.624934018f, 0.950764716f},
-std::array<float,2>{0.186848298f, 0.620922506f},
-std::array<float,2>{0.791907012f, 0.472547829f},
-std::array<float,2>{0.0421613716f, 0.251116991f},
-std::array<float,2>{0.888511837f, 0.681923926f},
-std::array<float,2>{0.366212577f, 0.762386739f},
-std::array<float,2>{0.655627429f, 0.215130016f},
-std::array<float,2>{0.0207947213f, 0.195830122f},
-std::array<float,2>{0.916901767f, 0.779543638f},
-std::array<float,2>{0.315222919f, 0.658497751f},
-std::array<float,2>{0.675629854f, 0.26652512f},
-std::array<float,2>{0.455224007f, 0.498871297f},
-std::array<float,2>{0.58394742f, 0.603874862f},
-std::array<float,2>{0.132877707f, 0.963354886f},
-std::array<float,2>{0.767406881f, 0.122309551f},
-std::array<float,2>{0.261328131f, 0.0570996031f},
-std::array<float,2>{0.735344529f, 0.910598218f},
-std::array<float,2>{0.0631851107f, 0.52579397f},
-std::array<float,2>{0.989443183f, 0.40094766f},
-std::array<float,2>{0.215806127f, 0.324272513f},
-std::array<float,2>{0.864691019f, 0.742905736f},
-std::array<float,2>{0.429365754f, 0.866163254f},
-std::array<float,2>{0.511120975f, 0.165260658f},
-std::array<float,2>{0.168973535f, 0.0854257569f},
-std::array<float,2>{0.807680547f, 0.979879797f},
-std::array<float,2>{0.483737081f, 0.573747158f},
-std::array<float,2>{0.595374584f, 0.460287124f},
-std::array<float,2>{0.345782399f, 0.281542689f},
-std::array<float,2>{0.628430963f, 0.633783519f},
-std::array<float,2>{0.0536519848f, 0.785695314f},
-std::array<float,2>{0.894612134f, 0.224815235f},
-std::array<float,2>{0.38249734f, 0.131410539f},
-std::array<float,2>{0.544194341f, 0.827387452f},
-std::array<float,2>{0.24179545f, 0.689372957f},
-std::array<float,2>{0.841091156f, 0.355093539f},
-std::array<float,2>{0.115269668f, 0.410386741f},
-std::array<float,2>{0.953417838f, 0.54751724f},
-std::array<float,2>{0.287831426f, 0.882194102f},
-std::array<float,2>{0.691307306f, 0.0182443075f},
-std::array<float,2>{0.000802466937f, 0.0509578548f},
-std::array<float,2>{0.934869468f, 0.914355218f},
-std::array<float,2>{0.337102473f, 0.516653419f},
-std::array<float,2>{0.665168226f, 0.393905938f},
-std::array<float,2>{0.451886743f, 0.314097703f},
-std::array<float,2>{0.577810705f, 0.73473382f},
-std::array<float,2>{0.143263742f, 0.872446537f},
-std::array<float,2>{0.76052618f, 0.159629956f},
-std::array<float,2>{0.28051424f, 0.187604755f},
-std::array<float,2>{0.719541967f, 0.773114264f},
-std::array<float,2>{0.0849017724f, 0.666979194f},
-std::array<float,2>{0.975249946f, 0.275087178f},
-std::array<float,2>{0.189203262f, 0.48593986f},
-std::array<float,2>{0.851061165f, 0.595109522f},
-std::array<float,2>{0.420341074f, 0.960413873f},
-std::array<float,2>{0.522893786f, 0.109471865f},
-std::array<float,2>{0.181356892f, 0.134965971f},
-std::array<float,2>{0.795546055f, 0.818525672f},
-std::array<float,2>{0.496356845f, 0.702367187f},
-std::array<float,2>{0.621092677f, 0.34528482f},
-std::array<float,2>{0.359608233f, 0.415636599f},
-std::array<float,2>{0.649425447f, 0.562278569f},
-std::array<float,2>{0.045461446f, 0.886838973f},
-std::array<float,2>{0.885636091f, 0.0237101708f},
-std::array<float,2>{0.401584715f, 0.0895301625f},
-std::array<float,2>{0.546937287f, 0.97233516f},
-std::array<float,2>{0.221451104f, 0.567489922f},
-std::array<float,2>{0.813590527f, 0.463022262f},
-std::array<float,2>{0.101410277f, 0.293830931f},
-std::array<float,2>{0.951982975f, 0.626927674f},
-std::array<float,2>{0.300689578f, 0.795657396f},
-std::array<float,2>{0.712324083f, 0.228845373f},
-std::array<float,2>{0.0674137548f, 0.245317802f},
-std::array<float,2>{0.985500395f, 0.805739701f},
-std::array<float,2>{0.262308329f, 0.644039571f},
-std::array<float,2>{0.740048349f, 0.308430284f},
-std::array<float,2>{0.423391223f, 0.438003451f},
-std::array<float,2>{0.515016794f, 0.583524048f},
-std::array<float,2>{0.214355648f, 0.988822579f},
-std::array<float,2>{0.862638354f, 0.077016525f},
-std::array<float,2>{0.317968965f, 0.0104419831f},
-std::array<float,2>{0.678978503f, 0.901781201f},
-std::array<float,2>{0.0166198183f, 0.541009903f},
-std::array<float,2>{0.920748651f, 0.422308803f},
-std::array<float,2>{0.136884436f, 0.365495771f},
-std::array<float,2>{0.7700423f, 0.714471519f},
-std::array<float,2>{0.458026201f, 0.840508819f},
-std::array<float,2>{0.579474092f, 0.15126662f},
-std::array<float,2>{0.235687733f, 0.0964580551f},
-std::array<float,2>{0.838613272f, 0.943477213f},
-std::array<float,2>{0.377386421f, 0.615425885f},
-std::array<float,2>{0.541619122f, 0.479668289f},
-std::array<float,2>{0.281963348f, 0.258089244f},
-std::array<float,2>{0.691455305f, 0.675346673f},
-std::array<float,2>{0.111325271f, 0.757024765f},
-std::array<float,2>{0.960261285f, 0.207554117f},
-std::array<float,2>{0.478822589f, 0.178746f},
-std::array<float,2>{0.598616064f, 0.855404079f},
-std::array<float,2>{0.167354763f, 0.726498425f},
-std::array<float,2>{0.811771989f, 0.335751653f},
-std::array<float,2>{0.0483712368f, 0.390427947f},
-std::array<float,2>{0.89373821f, 0.50394839f},
-std::array<float,2>{0.347996831f, 0.936145246f},
-std::array<float,2>{0.630463481f, 0.034269236f},
-std::array<float,2>{0.123444803f, 0.062752746f},
-std::array<float,2>{0.961619198f, 0.99436897f},
-std::array<float,2>{0.295307517f, 0.587151945f},
-std::array<float,2>{0.699649453f, 0.44820863f},
-std::array<float,2>{0.387987077f, 0.300697386f},
-std::array<float,2>{0.538660586f, 0.653066397f},
-std::array<float,2>{0.248875469f, 0.802265882f},
-std::array<float,2>{0.834438562f, 0.238531142f},
-std::array<float,2>{0.35588932f, 0.147171497f},
-std::array<float,2>{0.633575916f, 0.835401237f},
-std::array<float,2>{0.0604989603f, 0.706972957f},
-std::array<float,2>{0.899986267f, 0.374603778f},
-std::array<float,2>{0.163932249f, 0.436841249f},
-std::array<float,2>{0.79695791f, 0.53407377f},
-std::array<float,2>{0.475012511f, 0.892613769f},
-std::array<float,2>{0.608085215f, 0.00630110363f},
-std::array<float,2>{0.209694058f, 0.214324087f},
-std::array<float,2>{0.873030961f, 0.760973632f},
-std::array<float,2>{0.435038239f, 0.68379122f},
-std::array<float,2>{0.502927721f, 0.25724709f},
-std::array<float,2>{0.253505647f, 0.473961473f},
-std::array<float,2>{0.745983124f, 0.622957528f},
-std::array<float,2>{0.0752679929f, 0.946234941f},
-std::array<float,2>{0.996649861f, 0.104793392f},
-std::array<float,2>{0.465403467f, 0.0415103957f},
-std::array<float,2>{0.58935684f, 0.925664902f},
-std::array<float,2>{0.127936527f, 0.51546514f},
-std::array<float,2>{0.779459476f, 0.376793057f},
-std::array<float,2>{0.0306557026f, 0.338115096f},
-std::array<float,2>{0.907271624f, 0.729227543f},
-std::array<float,2>{0.323581398f, 0.844780385f},
-std::array<float,2>{0.682344913f, 0.181366846f},
-std::array<float,2>{0.0382358693f, 0.170055315f},
-std::array<float,2>{0.881416082f, 0.861219704f},
-std::array<float,2>{0.374620318f, 0.746350288f},
-std::array<float,2>{0.642770588f, 0.322550476f},
-std::array<float,2>{0.485362887f, 0.405696332f},
-std::array<float,2>{0.613686681f, 0.530563295f},
-std::array<float,2>{0.174690276f, 0.90813446f},
-std::array<float,2>{0.784346521f, 0.0603729188f},
-std::array<float,2>{0.30539465f, 0.120873615f},
-std::array<float,2>{0.703413248f, 0.966546357f},
-std::array<float,2>{0.106957063f, 0.606620133f},
-std::array<float,2>{0.941320598f, 0.493213981f},
-std::array<float,2>{0.22943753f, 0.271036536f},
-std::array<float,2>{0.820553184f, 0.662449956f},
-std::array<float,2>{0.393601388f, 0.774630189f},
-std::array<float,2>{0.562377334f, 0.200691789f},
-std::array<float,2>{0.153133988f, 0.0226865448f},
-std::array<float,2>{0.755336761f, 0.875516891f},
-std::array<float,2>{0.438376516f, 0.552398324f},
-std::array<float,2>{0.56876415f, 0.406830817f},
-std::array<float,2>{0.328360379f, 0.355859846f},
-std::array<float,2>{0.662403882f, 0.693852186f},
-std::array<float,2>{0.0154057471f, 0.822908342f},
-std::array<float,2>{0.929610848f, 0.125398606f},
-std::array<float,2>{0.406453133f, 0.218829229f},
-std::array<float,2>{0.523780942f, 0.783629179f},
-std::array<float,2>{0.20190078f, 0.638847888f},
-std::array<float,2>{0.857090771f, 0.286437303f},
-std::array<float,2>{0.0894429609f, 0.456400663f},
-std::array<float,2>{0.980282068f, 0.576649487f},
-std::array<float,2>{0.268504769f, 0.982899129f},
-std::array<float,2>{0.729467988f, 0.0805638507f},
-std::array<float,2>{0.0245823581f, 0.0916044787f},
-std::array<float,2>{0.912978709f, 0.974697948f},
-std::array<float,2>{0.326794952f, 0.5632056f},
-std::array<float,2>{0.684130132f, 0.46613133f},
-std::array<float,2>{0.463087589f, 0.289782524f},
-std::array<float,2>{0.592507482f, 0.629548013f},
-std::array<float,2>{0.129562512f, 0.791986704f},
-std::array<float,2>{0.775145292f, 0.230705798f},
-std::array<float,2>{0.254793048f, 0.139160588f},
-std::array<float,2>{0.748882174f, 0.81349498f},
-std::array<float,2>{0.0714743361f, 0.699157f},
-std::array<float,2>{0.994749725f, 0.349430203f},
-std::array<float,2>{0.204034463f, 0.421637982f},
-std::array<float,2>{0.868455052f, 0.557424664f},
-std::array<float,2>{0.430938393f, 0.886388361f},
-std::array<float,2>{0.50615716f, 0.027619103f},
-std::array<float,2>{0.157349586f, 0.192591384f},
-std::array<float,2>{0.803440511f, 0.767069995f},
-std::array<float,2>{0.46972996f, 0.671605527f},
-std::array<float,2>{0.604590535f, 0.278462946f},
-std::array<float,2>{0.353389919f, 0.490594774f},
-std::array<float,2>{0.637131691f, 0.601368487f},
-std::array<float,2>{0.0548631772f, 0.953346848f},
-std::array<float,2>{0.906231344f, 0.11603263f},
-std::array<float,2>{0.385910034f, 0.0499789231f},
-std::array<float,2>{0.531702876f, 0.920491755f},
-std::array<float,2>{0.245997325f, 0.519704521f},
-std::array<float,2>{0.828297734f, 0.396244913f},
-std::array<float,2>{0.121083401f, 0.317855686f},
-std::array<float,2>{0.967733204f, 0.73835659f},
-std::array<float,2>{0.292546511f, 0.870276749f},
-std::array<float,2>{0.696401715f, 0.163925529f},
-std::array<float,2>{0.0907879844f, 0.173939809f},
-std::array<float,2>{0.982642949f, 0.857446074f},
-std::array<float,2>{0.271768391f, 0.720266044f},
-std::array<float,2>{0.732871771f, 0.329100847f},
-std::array<float,2>{0.412752658f, 0.385629594f},
-std::array<float,2>{0.530353785f, 0.501527429f},
-std::array<float,2>{0.197677508f, 0.931622446f},
-std::array<float,2>{0.852065623f, 0.0356588066f},
-std::array<float,2>{0.333023518f, 0.100852124f},
-std::array<float,2>{0.658866525f, 0.938293636f},
-std::array<float,2>{0.0114820702f, 0.610879421f},
-std::array<float,2>{0.925116956f, 0.481313199f},
-std::array<float,2>{0.148677617f, 0.262545407f},
-std::array<float,2>{0.751076281f, 0.678742766f},
-std::array<float,2>{0.443154305f, 0.752024949f},
-std::array<float,2>{0.562743545f, 0.204187512f},
-std::array<float,2>{0.231894568f, 0.0135904541f},
-std::array<float,2>{0.824952424f, 0.903137982f},
-std::array<float,2>{0.396599025f, 0.546118915f},
-std::array<float,2>{0.557690322f, 0.429684579f},
-std::array<float,2>{0.309371054f, 0.36189127f},
-std::array<float,2>{0.707196236f, 0.717129588f},
-std::array<float,2>{0.104343615f, 0.837492287f},
-std::array<float,2>{0.941916406f, 0.153006554f},
-std::array<float,2>{0.491439581f, 0.247690365f},
-std::array<float,2>{0.612955987f, 0.809235156f},
-std::array<float,2>{0.177745223f, 0.645777404f},
-std::array<float,2>{0.787692666f, 0.311472565f},
-std::array<float,2>{0.0347420648f, 0.442224145f},
-std::array<float,2>{0.875038266f, 0.579258859f},
-std::array<float,2>{0.370469272f, 0.986985087f},
-std::array<float,2>{0.646279037f, 0.0733126029f},
-std::array<float,2>{0.0962095708f, 0.0446523726f},
-std::array<float,2>{0.946242034f, 0.928537726f},
-std::array<float,2>{0.302863747f, 0.510250747f},
-std::array<float,2>{0.717278302f, 0.379732996f},
-std::array<float,2>{0.405707359f, 0.342665285f},
-std::array<float,2>{0.55179441f, 0.731350183f},
-std::array<float,2>{0.224995553f, 0.847820401f},
-std::array<float,2>{0.820159614f, 0.187358141f},
-std::array<float,2>{0.364580542f, 0.217169568f},
-std::array<float,2>{0.653831899f, 0.764926374f},
-std::array<float,2>{0.0404043235f, 0.680368364f},
-std::array<float,2>{0.889904976f, 0.25358811f},
-std::array<float,2>{0.185092598f, 0.470297009f},
-std::array<float,2>{0.79070282f, 0.617664397f},
-std::array<float,2>{0.494900614f, 0.95303607f},
-std::array<float,2>{0.621640325f, 0.107440494f},
-std::array<float,2>{0.195069715f, 0.141057238f},
-std::array<float,2>{0.847535908f, 0.830641568f},
-std::array<float,2>{0.417073071f, 0.709652305f},
-std::array<float,2>{0.51627171f, 0.370184511f},
-std::array<float,2>{0.276734859f, 0.431325883f},
-std::array<float,2>{0.72455883f, 0.538679957f},
-std::array<float,2>{0.0810923949f, 0.89539367f},
-std::array<float,2>{0.972157955f, 0.00316429697f},
-std::array<float,2>{0.446042061f, 0.0673558339f},
-std::array<float,2>{0.571775615f, 0.996970356f},
-std::array<float,2>{0.147633716f, 0.59217298f},
-std::array<float,2>{0.76368314f, 0.452426672f},
-std::array<float,2>{0.00464092894f, 0.302403957f},
-std::array<float,2>{0.930922985f, 0.650131285f},
-std::array<float,2>{0.341859877f, 0.799201965f},
-std::array<float,2>{0.67178762f, 0.237750053f},
-std::array<float,2>{0.0518875234f, 0.22422798f},
-std::array<float,2>{0.897115409f, 0.787185669f},
-std::array<float,2>{0.345317066f, 0.635274172f},
-std::array<float,2>{0.625239849f, 0.284789503f},
-std::array<float,2>{0.480593115f, 0.457036734f},
-std::array<float,2>{0.597032785f, 0.572057486f},
-std::array<float,2>{0.170931414f, 0.976654887f},
-std::array<float,2>{0.80529815f, 0.0838319734f},
-std::array<float,2>{0.286125392f, 0.0161949005f},
-std::array<float,2>{0.688952684f, 0.879714549f},
-std::array<float,2>{0.114738777f, 0.550345898f},
-std::array<float,2>{0.956135869f, 0.413816571f},
-std::array<float,2>{0.240196094f, 0.352014303f},
-std::array<float,2>{0.842459619f, 0.691323996f},
-std::array<float,2>{0.380203724f, 0.824709475f},
-std::array<float,2>{0.546444118f, 0.130127668f},
-std::array<float,2>{0.136578023f, 0.123821348f},
-std::array<float,2>{0.769148827f, 0.962248862f},
-std::array<float,2>{0.454344362f, 0.602101445f},
-std::array<float,2>{0.585514009f, 0.497107476f},
-std::array<float,2>{0.313486427f, 0.268805921f},
-std::array<float,2>{0.672137141f, 0.657646835f},
-std::array<float,2>{0.0232106205f, 0.778991163f},
-std::array<float,2>{0.914558053f, 0.199184746f},
-std::array<float,2>{0.426858038f, 0.166960746f},
-std::array<float,2>{0.508272469f, 0.863438129f},
-std::array<float,2>{0.21874465f, 0.744913936f},
-std::array<float,2>{0.865807354f, 0.327802896f},
-std::array<float,2>{0.065565899f, 0.400113612f},
-std::array<float,2>{0.990935326f, 0.525155962f},
-std::array<float,2>{0.259587497f, 0.913522601f},
-std::array<float,2>{0.737015307f, 0.0547304824f},
-std::array<float,2>{0.0447469801f, 0.0266191848f},
-std::array<float,2>{0.884698212f, 0.889999807f},
-std::array<float,2>{0.36245048f, 0.559517562f},
-std::array<float,2>{0.651555002f, 0.416175157f},
-std::array<float,2>{0.499801576f, 0.346875519f},
-std::array<float,2>{0.619107306f, 0.699817002f},
-std::array<float,2>{0.182991669f, 0.818242013f},
-std::array<float,2>{0.794243872f, 0.134196281f},
-std::array<float,2>{0.297442019f, 0.227156028f},
-std::array<float,2>{0.714753628f, 0.793328285f},
-std::array<float,2>{0.0987065807f, 0.628158271f},
-std::array<float,2>{0.949873209f, 0.29492873f},
-std::array<float,2>{0.219363362f, 0.46178773f},
-std::array<float,2>{0.815228403f, 0.568934858f},
-std::array<float,2>{0.399765998f, 0.968938172f},
-std::array<float,2>{0.549796045f, 0.0863129497f},
-std::array<float,2>{0.142124772f, 0.15631713f},
-std::array<float,2>{0.759444118f, 0.874215484f},
-std::array<float,2>{0.451075792f, 0.736952543f},
-std::array<float,2>{0.574675083f, 0.314530343f},
-std::array<float,2>{0.338679105f, 0.391131967f},
-std::array<float,2>{0.666278362f, 0.518527627f},
-std::array<float,2>{0.00207588705f, 0.917594194f},
-std::array<float,2>{0.936142564f, 0.0546559021f},
-std::array<float,2>{0.418809325f, 0.112393849f},
-std::array<float,2>{0.521204531f, 0.957833588f},
-std::array<float,2>{0.191238359f, 0.596555889f},
-std::array<float,2>{0.84880805f, 0.487349033f},
-std::array<float,2>{0.0836527571f, 0.276309073f},
-std::array<float,2>{0.973902941f, 0.6646806f},
-std::array<float,2>{0.277673423f, 0.770722032f},
-std::array<float,2>{0.721739948f, 0.190318629f},
-std::array<float,2>{0.11169482f, 0.210665926f},
-std::array<float,2>{0.957138836f, 0.754851937f},
-std::array<float,2>{0.28484264f, 0.672295928f},
-std::array<float,2>{0.695016682f, 0.261201918f},
-std::array<float,2>{0.376762509f, 0.478470355f},
-std::array<float,2>{0.54060638f, 0.614002466f},
-std::array<float,2>{0.238166332f, 0.942774892f},
-std::array<float,2>{0.837784588f, 0.0955548808f},
-std::array<float,2>{0.350603104f, 0.0315375961f},
-std::array<float,2>{0.631952643f, 0.935160756f},
-std::array<float,2>{0.0506442711f, 0.507762969f},
-std::array<float,2>{0.891285181f, 0.388351917f},
-std::array<float,2>{0.164411113f, 0.33215028f},
-std::array<float,2>{0.809589446f, 0.723998725f},
-std::array<float,2>{0.477523863f, 0.85225457f},
-std::array<float,2>{0.600314796f, 0.176601604f},
-std::array<float,2>{0.211227253f, 0.0746055767f},
-std::array<float,2>{0.859994352f, 0.992086172f},
-std::array<float,2>{0.425494134f, 0.584203422f},
-std::array<float,2>{0.513036788f, 0.439843684f},
-std::array<float,2>{0.264611214f, 0.305012375f},
-std::array<float,2>{0.740755796f, 0.641792595f},
-std::array<float,2>{0.0689087063f, 0.808131218f},
-std::array<float,2>{0.986365974f, 0.24413842f},
-std::array<float,2>{0.460273623f, 0.148782328f},
-std::array<float,2>{0.581412315f, 0.842868984f},
-std::array<float,2>{0.139211744f, 0.711029112f},
-std::array<float,2>{0.773324251f, 0.364870667f},
-std::array<float,2>{0.0186818838f, 0.425108165f},
-std::array<float,2>{0.919683099f, 0.5419029f},
-std::array<float,2>{0.318850487f, 0.899282813f},
-std::array<float,2>{0.677372515f, 0.00815539435f},
-std::array<float,2>{0.0778571516f, 0.1025929f},
-std::array<float,2>{0.99967593f, 0.949105263f},
-std::array<float,2>{0.250944793f, 0.624686062f},
-std::array<float,2>{0.743365347f, 0.475865036f},
-std::array<float,2>{0.436863631f, 0.254359901f},
-std::array<float,2>{0.500681043f, 0.685622931f},
-std::array<float,2>{0.208294049f, 0.759080529f},
-std::array<float,2>{0.873846591f, 0.211201787f},
-std::array<float,2>{0.321372211f, 0.18239072f},
-std::array<float,2>{0.680121899f, 0.846560121f},
-std::array<float,2>{0.0285067912f, 0.726935983f},
-std::array<float,2>{0.909152985f, 0.337387502f},
-std::array<float,2>{0.126542926f, 0.37722069f},
-std::array<float,2>{0.779034972f, 0.512081146f},
-std::array<float,2>{0.468457967f, 0.92220372f},
-std::array<float,2>{0.585976899f, 0.0390681066f},
-std::array<float,2>{0.247398779f, 0.241511628f},
-std::array<float,2>{0.832590282f, 0.803449214f},
-std::array<float,2>{0.389556378f, 0.655616283f},
-std::array<float,2>{0.536923289f, 0.297372431f},
-std::array<float,2>{0.294698477f, 0.447124332f},
-std::array<float,2>{0.702814877f, 0.588308513f},
-std::array<float,2>{0.121245034f, 0.992845595f},
-std::array<float,2>{0.963257611f, 0.0649541095f},
-std::array<float,2>{0.474459738f, 0.005688834f},
-std::array<float,2>{0.60681951f, 0.892018914f},
-std::array<float,2>{0.162105471f, 0.531506121f},
-std::array<float,2>{0.79889524f, 0.435520321f},
-std::array<float,2>{0.0608494543f, 0.372807324f},
-std::array<float,2>{0.901579142f, 0.704927742f},
-std::array<float,2>{0.358462751f, 0.833886862f},
-std::array<float,2>{0.635616541f, 0.145732328f},
-std::array<float,2>{0.0133172385f, 0.127517238f},
-std::array<float,2>{0.927281022f, 0.822239995f},
-std::array<float,2>{0.330319464f, 0.691689372f},
-std::array<float,2>{0.660500526f, 0.35932678f},
-std::array<float,2>{0.439802796f, 0.409082204f},
-std::array<float,2>{0.566857815f, 0.554207206f},
-std::array<float,2>{0.154827848f, 0.877871215f},
-std::array<float,2>{0.756439567f, 0.0209502447f},
-std::array<float,2>{0.265660912f, 0.0783093348f},
-std::array<float,2>{0.726664066f, 0.981979311f},
-std::array<float,2>{0.0875129253f, 0.576007068f},
-std::array<float,2>{0.977823615f, 0.453417182f},
-std::array<float,2>{0.200520441f, 0.288758546f},
-std::array<float,2>{0.858176589f, 0.636848688f},
-std::array<float,2>{0.409425259f, 0.78273809f},
-std::array<float,2>{0.525693834f, 0.22175324f},
-std::array<float,2>{0.172047168f, 0.0616705082f},
-std::array<float,2>{0.78149128f, 0.909779668f},
-std::array<float,2>{0.487573683f, 0.5279423f},
-std::array<float,2>{0.615538538f, 0.402771413f},
-std::array<float,2>{0.372885078f, 0.321994275f},
-std::array<float,2>{0.642353058f, 0.748908937f},
-std::array<float,2>{0.0352445021f, 0.86172688f},
-std::array<float,2>{0.879321158f, 0.169320256f},
-std::array<float,2>{0.391982585f, 0.201233357f},
-std::array<float,2>{0.558751822f, 0.77612257f},
-std::array<float,2>{0.227438226f, 0.66079551f},
-std::array<float,2>{0.82336235f, 0.273406297f},
-std::array<float,2>{0.107650116f, 0.494393677f},
-std::array<float,2>{0.939329088f, 0.608826578f},
-std::array<float,2>{0.308504969f, 0.967975974f},
-std::array<float,2>{0.706680059f, 0.118416376f},
-std::array<float,2>{0.046437867f, 0.0860105306f},
-std::array<float,2>{0.886227369f, 0.96901238f},
-std::array<float,2>{0.360653192f, 0.569144607f},
-std::array<float,2>{0.648772597f, 0.461544037f},
-std::array<float,2>{0.497323245f, 0.295238286f},
-std::array<float,2>{0.619642258f, 0.628400087f},
-std::array<float,2>{0.1798549f, 0.793050945f},
-std::array<float,2>{0.796516716f, 0.227518827f},
-std::array<float,2>{0.299251258f, 0.133964196f},
-std::array<float,2>{0.711129427f, 0.818101943f},
-std::array<float,2>{0.100453518f, 0.700016439f},
-std::array<float,2>{0.952857852f, 0.346968383f},
-std::array<float,2>{0.222578734f, 0.416266352f},
-std::array<float,2>{0.812923789f, 0.559197366f},
-std::array<float,2>{0.400740713f, 0.889814734f},
-std::array<float,2>{0.548179626f, 0.0263707321f},
-std::array<float,2>{0.144166723f, 0.190020114f},
-std::array<float,2>{0.761241674f, 0.770969868f},
-std::array<float,2>{0.452853173f, 0.664830625f},
-std::array<float,2>{0.576338053f, 0.276073366f},
-std::array<float,2>{0.336205393f, 0.487624228f},
-std::array<float,2>{0.664245069f, 0.596218765f},
-std::array<float,2>{0.00172251393f, 0.957667887f},
-std::array<float,2>{0.93371141f, 0.112636238f},
-std::array<float,2>{0.421230465f, 0.0544275828f},
-std::array<float,2>{0.522381127f, 0.917805791f},
-std::array<float,2>{0.188017681f, 0.518241823f},
-std::array<float,2>{0.849728644f, 0.391403764f},
-std::array<float,2>{0.0854047462f, 0.314771563f},
-std::array<float,2>{0.976177812f, 0.737212121f},
-std::array<float,2>{0.280019373f, 0.874373913f},
-std::array<float,2>{0.719864011f, 0.156609058f},
-std::array<float,2>{0.109454982f, 0.176355734f},
-std::array<float,2>{0.959772885f, 0.852331877f},
-std::array<float,2>{0.282831788f, 0.723760307f},
-std::array<float,2>{0.693054259f, 0.332370251f},
-std::array<float,2>{0.378366828f, 0.388644695f},
-std::array<float,2>{0.5425933f, 0.50738591f},
-std::array<float,2>{0.235097393f, 0.935404599f},
-std::array<float,2>{0.838987172f, 0.0313077942f},
-std::array<float,2>{0.348635912f, 0.0952425599f},
-std::array<float,2>{0.629584491f, 0.942439497f},
-std::array<float,2>{0.0477394462f, 0.614191711f},
-std::array<float,2>{0.892795384f, 0.478108078f},
-std::array<float,2>{0.166974664f, 0.26082772f},
-std::array<float,2>{0.810984433f, 0.672045112f},
-std::array<float,2>{0.479735404f, 0.754535437f},
-std::array<float,2>{0.599259973f, 0.210701898f},
-std::array<float,2>{0.213303298f, 0.0079156952f},
-std::array<float,2>{0.862041831f, 0.899105012f},
-std::array<float,2>{0.422198176f, 0.541508794f},
-std::array<float,2>{0.513808548f, 0.424895376f},
-std::array<float,2>{0.263330191f, 0.365008384f},
-std::array<float,2>{0.738480568f, 0.711196601f},
-std::array<float,2>{0.0666294247f, 0.843201399f},
-std::array<float,2>{0.985044599f, 0.148574427f},
-std::array<float,2>{0.457746327f, 0.243716568f},
-std::array<float,2>{0.578742146f, 0.80843091f},
-std::array<float,2>{0.13780126f, 0.642044246f},
-std::array<float,2>{0.770672143f, 0.304789364f},
-std::array<float,2>{0.0159910396f, 0.439674288f},
-std::array<float,2>{0.921361506f, 0.584376276f},
-std::array<float,2>{0.317232072f, 0.991775274f},
-std::array<float,2>{0.67863369f, 0.0743694976f},
-std::array<float,2>{0.0746275187f, 0.0393769331f},
-std::array<float,2>{0.997808814f, 0.921955407f},
-std::array<float,2>{0.252644569f, 0.511936426f},
-std::array<float,2>{0.744569719f, 0.377110243f},
-std::array<float,2>{0.43392235f, 0.33697921f},
-std::array<float,2>{0.502930641f, 0.726688921f},
-std::array<float,2>{0.210324004f, 0.846271634f},
-std::array<float,2>{0.871530116f, 0.182255328f},
-std::array<float,2>{0.322939962f, 0.210996702f},
-std::array<float,2>{0.683294535f, 0.758981466f},
-std::array<float,2>{0.029538393f, 0.686032832f},
-std::array<float,2>{0.906337738f, 0.253991753f},
-std::array<float,2>{0.12773709f, 0.475678086f},
-std::array<float,2>{0.78055191f, 0.624978483f},
-std::array<float,2>{0.466536373f, 0.948893368f},
-std::array<float,2>{0.588552773f, 0.102887258f},
-std::array<float,2>{0.249139607f, 0.145836204f},
-std::array<float,2>{0.835504413f, 0.833734691f},
-std::array<float,2>{0.387390912f, 0.704669416f},
-std::array<float,2>{0.537383318f, 0.372767985f},
-std::array<float,2>{0.296456456f, 0.435102433f},
-std::array<float,2>{0.700776875f, 0.53144902f},
-std::array<float,2>{0.124495514f, 0.891655803f},
-std::array<float,2>{0.962850451f, 0.00537492521f},
-std::array<float,2>{0.476379842f, 0.0654104725f},
-std::array<float,2>{0.608607948f, 0.992988765f},
-std::array<float,2>{0.162495971f, 0.5879547f},
-std::array<float,2>{0.797994733f, 0.446841896f},
-std::array<float,2>{0.0587777868f, 0.29774332f},
-std::array<float,2>{0.899413168f, 0.655479431f},
-std::array<float,2>{0.357166141f, 0.80370301f},
-std::array<float,2>{0.63433522f, 0.241334021f},
-std::array<float,2>{0.0143268155f, 0.22204034f},
-std::array<float,2>{0.927935958f, 0.783077776f},
-std::array<float,2>{0.329954028f, 0.637117565f},
-std::array<float,2>{0.663643599f, 0.288918674f},
-std::array<float,2>{0.438881099f, 0.453195333f},
-std::array<float,2>{0.570146084f, 0.57582289f},
-std::array<float,2>{0.154181868f, 0.982317388f},
-std::array<float,2>{0.75454247f, 0.0785663053f},
-std::array<float,2>{0.268632442f, 0.0205571484f},
-std::array<float,2>{0.72965169f, 0.877457559f},
-std::array<float,2>{0.0880333111f, 0.554454684f},
-std::array<float,2>{0.978921115f, 0.408719033f},
-std::array<float,2>{0.202456608f, 0.359033257f},
-std::array<float,2>{0.855981171f, 0.691558361f},
-std::array<float,2>{0.407583058f, 0.8218081f},
-std::array<float,2>{0.525105298f, 0.127888486f},
-std::array<float,2>{0.175560251f, 0.118227221f},
-std::array<float,2>{0.784060478f, 0.968127489f},
-std::array<float,2>{0.484451473f, 0.608494461f},
-std::array<float,2>{0.614905298f, 0.494206935f},
-std::array<float,2>{0.373972774f, 0.273088366f},
-std::array<float,2>{0.644082069f, 0.66108638f},
-std::array<float,2>{0.0374090038f, 0.776185334f},
-std::array<float,2>{0.882629097f, 0.201565757f},
-std::array<float,2>{0.392868876f, 0.169090301f},
-std::array<float,2>{0.560799241f, 0.86136806f},
-std::array<float,2>{0.230127051f, 0.748548687f},
-std::array<float,2>{0.821512938f, 0.322159201f},
-std::array<float,2>{0.105568752f, 0.402479678f},
-std::array<float,2>{0.940089047f, 0.528182447f},
-std::array<float,2>{0.306179523f, 0.910085618f},
-std::array<float,2>{0.704768002f, 0.06180951f},
-std::array<float,2>{0.0271325596f, 0.0275712851f},
-std::array<float,2>{0.911014557f, 0.8866418f},
-std::array<float,2>{0.324713498f, 0.557202578f},
-std::array<float,2>{0.686184824f, 0.421486497f},
-std::array<float,2>{0.460963607f, 0.34916994f},
-std::array<float,2>{0.590151429f, 0.698906302f},
-std::array<float,2>{0.13195549f, 0.813921452f},
-std::array<float,2>{0.776863635f, 0.139541224f},
-std::array<float,2>{0.256630182f, 0.230922118f},
-std::array<float,2>{0.746579587f, 0.791598678f},
-std::array<float,2>{0.0731353611f, 0.629849017f},
-std::array<float,2>{0.993747592f, 0.290019214f},
-std::array<float,2>{0.205443189f, 0.466048807f},
-std::array<float,2>{0.869599164f, 0.563315094f},
-std::array<float,2>{0.432417989f, 0.974894702f},
-std::array<float,2>{0.505587041f, 0.0914835557f},
-std::array<float,2>{0.159328684f, 0.163767636f},
-std::array<float,2>{0.801227689f, 0.8705616f},
-std::array<float,2>{0.472225338f, 0.738647819f},
-std::array<float,2>{0.602053225f, 0.317621142f},
-std::array<float,2>{0.354826212f, 0.396236211f},
-std::array<float,2>{0.639716387f, 0.51986593f},
-std::array<float,2>{0.0574722588f, 0.920866668f},
-std::array<float,2>{0.903205395f, 0.0501107574f},
-std::array<float,2>{0.382855862f, 0.115805253f},
-std::array<float,2>{0.534851074f, 0.953607023f},
-std::array<float,2>{0.242560789f, 0.601075053f},
-std::array<float,2>{0.830820024f, 0.490253061f},
-std::array<float,2>{0.118690774f, 0.278678209f},
-std::array<float,2>{0.965968013f, 0.67182529f},
-std::array<float,2>{0.289742172f, 0.766800225f},
-std::array<float,2>{0.699044466f, 0.192801192f},
-std::array<float,2>{0.0926885456f, 0.20448938f},
-std::array<float,2>{0.981508017f, 0.752215564f},
-std::array<float,2>{0.270800143f, 0.679011941f},
-std::array<float,2>{0.730974853f, 0.262209564f},
-std::array<float,2>{0.410324484f, 0.481171668f},
-std::array<float,2>{0.52838397f, 0.611147642f},
-std::array<float,2>{0.196451083f, 0.938216209f},
-std::array<float,2>{0.855158329f, 0.10082268f},
-std::array<float,2>{0.335012108f, 0.0359443352f},
-std::array<float,2>{0.656769931f, 0.931180835f},
-std::array<float,2>{0.00848651212f, 0.501739979f},
-std::array<float,2>{0.923120499f, 0.385331124f},
-std::array<float,2>{0.150569499f, 0.328761935f},
-std::array<float,2>{0.752742887f, 0.720511615f},
-std::array<float,2>{0.444240332f, 0.857754767f},
-std::array<float,2>{0.566391587f, 0.174186841f},
-std::array<float,2>{0.233171254f, 0.073624596f},
-std::array<float,2>{0.82621181f, 0.987061262f},
-std::array<float,2>{0.396311611f, 0.579502702f},
-std::array<float,2>{0.55663079f, 0.441909999f},
-std::array<float,2>{0.311894029f, 0.311240703f},
-std::array<float,2>{0.710453749f, 0.645593643f},
-std::array<float,2>{0.102899373f, 0.809516668f},
-std::array<float,2>{0.944849074f, 0.247955993f},
-std::array<float,2>{0.48860696f, 0.15309687f},
-std::array<float,2>{0.610853195f, 0.837745011f},
-std::array<float,2>{0.177518502f, 0.716926336f},
-std::array<float,2>{0.786491334f, 0.362133503f},
-std::array<float,2>{0.032119818f, 0.429411501f},
-std::array<float,2>{0.878395438f, 0.546331644f},
-std::array<float,2>{0.368228257f, 0.903025925f},
-std::array<float,2>{0.648075998f, 0.0133098131f},
-std::array<float,2>{0.0941567719f, 0.107898869f},
-std::array<float,2>{0.948534846f, 0.952815294f},
-std::array<float,2>{0.301285177f, 0.61732018f},
-std::array<float,2>{0.71675545f, 0.470661134f},
-std::array<float,2>{0.404083312f, 0.253901154f},
-std::array<float,2>{0.55387181f, 0.680465758f},
-std::array<float,2>{0.224001512f, 0.764662564f},
-std::array<float,2>{0.816467106f, 0.216849014f},
-std::array<float,2>{0.365980357f, 0.187108442f},
-std::array<float,2>{0.654511452f, 0.848069251f},
-std::array<float,2>{0.0413160697f, 0.730979681f},
-std::array<float,2>{0.887012899f, 0.342454046f},
-std::array<float,2>{0.185605422f, 0.379439265f},
-std::array<float,2>{0.792126f, 0.50985235f},
-std::array<float,2>{0.493029892f, 0.928424954f},
-std::array<float,2>{0.623894691f, 0.0448975042f},
-std::array<float,2>{0.192132398f, 0.237399399f},
-std::array<float,2>{0.844897628f, 0.798935533f},
-std::array<float,2>{0.415778011f, 0.650195181f},
-std::array<float,2>{0.518456221f, 0.302586555f},
-std::array<float,2>{0.274767965f, 0.452282161f},
-std::array<float,2>{0.725484312f, 0.591984987f},
-std::array<float,2>{0.0785177127f, 0.996653378f},
-std::array<float,2>{0.968828142f, 0.067087546f},
-std::array<float,2>{0.44738853f, 0.00329362345f},
-std::array<float,2>{0.57263273f, 0.895027578f},
-std::array<float,2>{0.144895732f, 0.538864911f},
-std::array<float,2>{0.761855483f, 0.431530178f},
-std::array<float,2>{0.00692683319f, 0.370486081f},
-std::array<float,2>{0.932245553f, 0.709960222f},
-std::array<float,2>{0.34169367f, 0.830949008f},
-std::array<float,2>{0.668248415f, 0.140828133f},
-std::array<float,2>{0.0544501469f, 0.130052432f},
-std::array<float,2>{0.896419525f, 0.825115383f},
-std::array<float,2>{0.347143024f, 0.691005409f},
-std::array<float,2>{0.626953781f, 0.351736486f},
-std::array<float,2>{0.482774645f, 0.413897604f},
-std::array<float,2>{0.594044864f, 0.550609052f},
-std::array<float,2>{0.168590859f, 0.879501343f},
-std::array<float,2>{0.807185709f, 0.0164032038f},
-std::array<float,2>{0.288251847f, 0.0836220011f},
-std::array<float,2>{0.6899544f, 0.976866722f},
-std::array<float,2>{0.116472855f, 0.571877897f},
-std::array<float,2>{0.954726994f, 0.457371175f},
-std::array<float,2>{0.240804106f, 0.28495574f},
-std::array<float,2>{0.840403676f, 0.635534406f},
-std::array<float,2>{0.381588548f, 0.787546754f},
-std::array<float,2>{0.543118656f, 0.224466473f},
-std::array<float,2>{0.133958876f, 0.0550115146f},
-std::array<float,2>{0.76589781f, 0.913175046f},
-std::array<float,2>{0.456377357f, 0.525002956f},
-std::array<float,2>{0.582731068f, 0.400158048f},
-std::array<float,2>{0.315801024f, 0.328094423f},
-std::array<float,2>{0.674088657f, 0.744809628f},
-std::array<float,2>{0.0201308671f, 0.863527536f},
-std::array<float,2>{0.917375147f, 0.166512161f},
-std::array<float,2>{0.428649992f, 0.198948368f},
-std::array<float,2>{0.510372937f, 0.779290676f},
-std::array<float,2>{0.216000557f, 0.657367766f},
-std::array<float,2>{0.863523543f, 0.268693447f},
-std::array<float,2>{0.0641237274f, 0.497327089f},
-std::array<float,2>{0.988937259f, 0.602363348f},
-std::array<float,2>{0.259894937f, 0.96211344f},
-std::array<float,2>{0.73548311f, 0.123631641f},
-std::array<float,2>{0.00375549216f, 0.109733909f},
-std::array<float,2>{0.937155068f, 0.960143924f},
-std::array<float,2>{0.338867664f, 0.594841361f},
-std::array<float,2>{0.66788125f, 0.486169666f},
-std::array<float,2>{0.44998166f, 0.275280803f},
-std::array<float,2>{0.575344384f, 0.666612506f},
-std::array<float,2>{0.141560689f, 0.773408055f},
-std::array<float,2>{0.758769929f, 0.187961414f},
-std::array<float,2>{0.278539985f, 0.159356669f},
-std::array<float,2>{0.72148627f, 0.872161508f},
-std::array<float,2>{0.0822694749f, 0.734376311f},
-std::array<float,2>{0.972671032f, 0.314291477f},
-std::array<float,2>{0.190024853f, 0.393736869f},
-std::array<float,2>{0.847802222f, 0.516899526f},
-std::array<float,2>{0.419355154f, 0.914260566f},
-std::array<float,2>{0.519799471f, 0.0511193648f},
-std::array<float,2>{0.182488233f, 0.228567794f},
-std::array<float,2>{0.793885589f, 0.795634151f},
-std::array<float,2>{0.498273283f, 0.626702428f},
-std::array<float,2>{0.618089974f, 0.2934708f},
-std::array<float,2>{0.361869723f, 0.463314116f},
-std::array<float,2>{0.650774419f, 0.567833304f},
-std::array<float,2>{0.0439152345f, 0.972513556f},
-std::array<float,2>{0.883756399f, 0.0898102075f},
-std::array<float,2>{0.399138451f, 0.0235398319f},
-std::array<float,2>{0.550137162f, 0.887043238f},
-std::array<float,2>{0.219780117f, 0.562235355f},
-std::array<float,2>{0.816029012f, 0.41588822f},
-std::array<float,2>{0.097908847f, 0.345606744f},
-std::array<float,2>{0.95050472f, 0.702634513f},
-std::array<float,2>{0.298815876f, 0.818683326f},
-std::array<float,2>{0.713147342f, 0.135137707f},
-std::array<float,2>{0.0697107017f, 0.151062161f},
-std::array<float,2>{0.987505138f, 0.840627193f},
-std::array<float,2>{0.265589863f, 0.714691103f},
-std::array<float,2>{0.741680562f, 0.365374267f},
-std::array<float,2>{0.42476815f, 0.422079235f},
-std::array<float,2>{0.51214546f, 0.54059875f},
-std::array<float,2>{0.212280065f, 0.901448369f},
-std::array<float,2>{0.860775173f, 0.0106382631f},
-std::array<float,2>{0.319862932f, 0.0766960457f},
-std::array<float,2>{0.675828934f, 0.989178121f},
-std::array<float,2>{0.0181859955f, 0.583808303f},
-std::array<float,2>{0.918803334f, 0.438346803f},
-std::array<float,2>{0.139825419f, 0.308299184f},
-std::array<float,2>{0.772351801f, 0.643740296f},
-std::array<float,2>{0.459428251f, 0.805936992f},
-std::array<float,2>{0.580905914f, 0.245419845f},
-std::array<float,2>{0.236633241f, 0.0344666317f},
-std::array<float,2>{0.836681306f, 0.936415076f},
-std::array<float,2>{0.375185013f, 0.504243076f},
-std::array<float,2>{0.53982842f, 0.390140384f},
-std::array<float,2>{0.283326715f, 0.335596204f},
-std::array<float,2>{0.694222212f, 0.726114571f},
-std::array<float,2>{0.112369582f, 0.855020165f},
-std::array<float,2>{0.9581725f, 0.179093555f},
-std::array<float,2>{0.477671266f, 0.207988799f},
-std::array<float,2>{0.600757122f, 0.757096052f},
-std::array<float,2>{0.165968925f, 0.675642788f},
-std::array<float,2>{0.808596551f, 0.257930011f},
-std::array<float,2>{0.0493030846f, 0.479781866f},
-std::array<float,2>{0.892174959f, 0.615519941f},
-std::array<float,2>{0.34962371f, 0.943667531f},
-std::array<float,2>{0.631488681f, 0.096203737f},
-std::array<float,2>{0.122609146f, 0.00604550773f},
-std::array<float,2>{0.964834332f, 0.892961025f},
-std::array<float,2>{0.293496609f, 0.533786058f},
-std::array<float,2>{0.701424599f, 0.436700404f},
-std::array<float,2>{0.389813781f, 0.374890238f},
-std::array<float,2>{0.535637617f, 0.706618488f},
-std::array<float,2>{0.247022569f, 0.83516705f},
-std::array<float,2>{0.833241343f, 0.147293448f},
-std::array<float,2>{0.357671559f, 0.238343522f},
-std::array<float,2>{0.636154532f, 0.802616f},
-std::array<float,2>{0.062399026f, 0.653316677f},
-std::array<float,2>{0.900941253f, 0.300389737f},
-std::array<float,2>{0.160704762f, 0.447954595f},
-std::array<float,2>{0.800578654f, 0.587321639f},
-std::array<float,2>{0.473030329f, 0.994610667f},
-std::array<float,2>{0.606234193f, 0.0625780821f},
-std::array<float,2>{0.207710147f, 0.181593522f},
-std::array<float,2>{0.874089181f, 0.84501493f},
-std::array<float,2>{0.436207324f, 0.729451716f},
-std::array<float,2>{0.501344979f, 0.338350207f},
-std::array<float,2>{0.251861662f, 0.376648456f},
-std::array<float,2>{0.742416263f, 0.515209794f},
-std::array<float,2>{0.0761773884f, 0.925436437f},
-std::array<float,2>{0.998396635f, 0.041758053f},
-std::array<float,2>{0.467652649f, 0.104616329f},
-std::array<float,2>{0.586948752f, 0.945986092f},
-std::array<float,2>{0.12588124f, 0.622643054f},
-std::array<float,2>{0.777369618f, 0.473782837f},
-std::array<float,2>{0.0279986709f, 0.256995767f},
-std::array<float,2>{0.910035431f, 0.68394345f},
-std::array<float,2>{0.320827216f, 0.761182845f},
-std::array<float,2>{0.68102181f, 0.214033678f},
-std::array<float,2>{0.036280334f, 0.201011777f},
-std::array<float,2>{0.880372047f, 0.774866045f},
-std::array<float,2>{0.371182621f, 0.662227333f},
-std::array<float,2>{0.640789986f, 0.271297872f},
-std::array<float,2>{0.486645281f, 0.493409097f},
-std::array<float,2>{0.616705656f, 0.606861711f},
-std::array<float,2>{0.173669741f, 0.966648817f},
-std::array<float,2>{0.782639205f, 0.120670199f},
-std::array<float,2>{0.307192951f, 0.0601381324f},
-std::array<float,2>{0.705278397f, 0.907926738f},
-std::array<float,2>{0.108976655f, 0.530305326f},
-std::array<float,2>{0.937816799f, 0.405415505f},
-std::array<float,2>{0.227877468f, 0.32244575f},
-std::array<float,2>{0.822967291f, 0.746303797f},
-std::array<float,2>{0.390815973f, 0.861069202f},
-std::array<float,2>{0.559681892f, 0.170311481f},
-std::array<float,2>{0.155723497f, 0.0802854374f},
-std::array<float,2>{0.757183433f, 0.982435882f},
-std::array<float,2>{0.440460205f, 0.576180279f},
-std::array<float,2>{0.568177164f, 0.456058234f},
-std::array<float,2>{0.331652761f, 0.286363512f},
-std::array<float,2>{0.661301792f, 0.639081001f},
-std::array<float,2>{0.012274012f, 0.783216774f},
-std::array<float,2>{0.926639736f, 0.21918349f},
-std::array<float,2>{0.408974618f, 0.125012711f},
-std::array<float,2>{0.526367724f, 0.82322681f},
-std::array<float,2>{0.199781075f, 0.6942572f},
-std::array<float,2>{0.859324932f, 0.355528921f},
-std::array<float,2>{0.0866918117f, 0.406996608f},
-std::array<float,2>{0.977318883f, 0.552629888f},
-std::array<float,2>{0.266738892f, 0.875926018f},
-std::array<float,2>{0.72850728f, 0.0228019785f},
-std::array<float,2>{0.0559103042f, 0.0484263338f},
-std::array<float,2>{0.904665887f, 0.91857028f},
-std::array<float,2>{0.3524867f, 0.521686137f},
-std::array<float,2>{0.638443708f, 0.396511674f},
-std::array<float,2>{0.468882322f, 0.31954959f},
-std::array<float,2>{0.604363859f, 0.740849495f},
-std::array<float,2>{0.156835437f, 0.867274642f},
-std::array<float,2>{0.804662764f, 0.16199708f},
-std::array<float,2>{0.291681468f, 0.193679646f},
-std::array<float,2>{0.695424795f, 0.769477427f},
-std::array<float,2>{0.119831435f, 0.668817222f},
-std::array<float,2>{0.968698263f, 0.280306578f},
-std::array<float,2>{0.24417752f, 0.489973843f},
-std::array<float,2>{0.829896331f, 0.599594057f},
-std::array<float,2>{0.384884268f, 0.955222249f},
-std::array<float,2>{0.532780766f, 0.114498347f},
-std::array<float,2>{0.130766064f, 0.137952432f},
-std::array<float,2>{0.773651779f, 0.814866006f},
-std::array<float,2>{0.464272261f, 0.695350647f},
-std::array<float,2>{0.593380809f, 0.350283116f},
-std::array<float,2>{0.327229351f, 0.418567628f},
-std::array<float,2>{0.685471237f, 0.554949462f},
-std::array<float,2>{0.0242385939f, 0.883830309f},
-std::array<float,2>{0.913888931f, 0.0307917539f},
-std::array<float,2>{0.429789931f, 0.0923918113f},
-std::array<float,2>{0.507302582f, 0.974326074f},
-std::array<float,2>{0.204738691f, 0.565184891f},
-std::array<float,2>{0.867213964f, 0.467819184f},
-std::array<float,2>{0.0706833601f, 0.291929573f},
-std::array<float,2>{0.995797455f, 0.632555902f},
-std::array<float,2>{0.255512625f, 0.789835334f},
-std::array<float,2>{0.749733388f, 0.233561605f},
-std::array<float,2>{0.10498403f, 0.248789981f},
-std::array<float,2>{0.943134725f, 0.812474012f},
-std::array<float,2>{0.310321897f, 0.647458196f},
-std::array<float,2>{0.708542109f, 0.310423106f},
-std::array<float,2>{0.397725165f, 0.443999469f},
-std::array<float,2>{0.557115257f, 0.580215931f},
-std::array<float,2>{0.231425673f, 0.984664142f},
-std::array<float,2>{0.825744569f, 0.0704068542f},
-std::array<float,2>{0.36998108f, 0.0154905859f},
-std::array<float,2>{0.644811332f, 0.904530227f},
-std::array<float,2>{0.0338695385f, 0.544563413f},
-std::array<float,2>{0.876870215f, 0.425953001f},
-std::array<float,2>{0.1795495f, 0.36028406f},
-std::array<float,2>{0.788661838f, 0.715506196f},
-std::array<float,2>{0.490523249f, 0.838714361f},
-std::array<float,2>{0.611953199f, 0.155816898f},
-std::array<float,2>{0.198417068f, 0.0983623564f},
-std::array<float,2>{0.853469551f, 0.940241337f},
-std::array<float,2>{0.413773417f, 0.612573981f},
-std::array<float,2>{0.529309869f, 0.482891053f},
-std::array<float,2>{0.272536248f, 0.264787436f},
-std::array<float,2>{0.733422577f, 0.676261961f},
-std::array<float,2>{0.0913210437f, 0.751676083f},
-std::array<float,2>{0.984194815f, 0.206704319f},
-std::array<float,2>{0.44218415f, 0.172411963f},
-std::array<float,2>{0.564052045f, 0.857361615f},
-std::array<float,2>{0.149516448f, 0.721813798f},
-std::array<float,2>{0.750804842f, 0.330222756f},
-std::array<float,2>{0.0102989133f, 0.383858204f},
-std::array<float,2>{0.924804509f, 0.503713846f},
-std::array<float,2>{0.332737356f, 0.93283695f},
-std::array<float,2>{0.659613132f, 0.0389294103f},
-std::array<float,2>{0.0807073712f, 0.0695189014f},
-std::array<float,2>{0.971119523f, 0.998628378f},
-std::array<float,2>{0.276306063f, 0.590494871f},
-std::array<float,2>{0.722896159f, 0.449964553f},
-std::array<float,2>{0.41694662f, 0.304278046f},
-std::array<float,2>{0.516774654f, 0.650453985f},
-std::array<float,2>{0.194267988f, 0.798661053f},
-std::array<float,2>{0.846378505f, 0.235321477f},
-std::array<float,2>{0.343529284f, 0.142671078f},
-std::array<float,2>{0.670300364f, 0.828850925f},
-std::array<float,2>{0.00569419237f, 0.708895564f},
-std::array<float,2>{0.930101156f, 0.368183255f},
-std::array<float,2>{0.147300646f, 0.433550984f},
-std::array<float,2>{0.765192211f, 0.535760164f},
-std::array<float,2>{0.447125345f, 0.897430599f},
-std::array<float,2>{0.570361376f, 0.00163366972f},
-std::array<float,2>{0.225786895f, 0.21506241f},
-std::array<float,2>{0.818534434f, 0.762687504f},
-std::array<float,2>{0.404325902f, 0.681720436f},
-std::array<float,2>{0.550807595f, 0.251241505f},
-std::array<float,2>{0.30461514f, 0.472258955f},
-std::array<float,2>{0.718362331f, 0.620820045f},
-std::array<float,2>{0.0975216031f, 0.950960994f},
-std::array<float,2>{0.947033346f, 0.106786884f},
-std::array<float,2>{0.495258301f, 0.0459024273f},
-std::array<float,2>{0.622070849f, 0.927304387f},
-std::array<float,2>{0.184386f, 0.507933438f},
-std::array<float,2>{0.789919436f, 0.381230652f},
-std::array<float,2>{0.0399798341f, 0.341411263f},
-std::array<float,2>{0.888938248f, 0.733566105f},
-std::array<float,2>{0.36357671f, 0.850165188f},
-std::array<float,2>{0.652482271f, 0.184627995f},
-std::array<float,2>{0.0219534487f, 0.165319875f},
-std::array<float,2>{0.915107965f, 0.865844429f},
-std::array<float,2>{0.313410461f, 0.742933154f},
-std::array<float,2>{0.672969759f, 0.32466343f},
-std::array<float,2>{0.453740686f, 0.401285976f},
-std::array<float,2>{0.58467108f, 0.525559604f},
-std::array<float,2>{0.135131866f, 0.910363138f},
-std::array<float,2>{0.768532515f, 0.0568692163f},
-std::array<float,2>{0.258092314f, 0.12233036f},
-std::array<float,2>{0.737453222f, 0.963010192f},
-std::array<float,2>{0.0647340193f, 0.603554547f},
-std::array<float,2>{0.991278768f, 0.498590291f},
-std::array<float,2>{0.216923892f, 0.266141683f},
-std::array<float,2>{0.866525769f, 0.658371508f},
-std::array<float,2>{0.425854355f, 0.779399395f},
-std::array<float,2>{0.509292305f, 0.196226195f},
-std::array<float,2>{0.17052494f, 0.0185164008f},
-std::array<float,2>{0.806290448f, 0.882024705f},
-std::array<float,2>{0.481625706f, 0.547802567f},
-std::array<float,2>{0.595787168f, 0.410497367f},
-std::array<float,2>{0.344336599f, 0.355317026f},
-std::array<float,2>{0.626598358f, 0.689023316f},
-std::array<float,2>{0.0508806333f, 0.827439368f},
-std::array<float,2>{0.897525132f, 0.131826207f},
-std::array<float,2>{0.379002124f, 0.224920183f},
-std::array<float,2>{0.545016825f, 0.785964966f},
-std::array<float,2>{0.238917723f, 0.63352716f},
-std::array<float,2>{0.843198955f, 0.281335503f},
-std::array<float,2>{0.11353416f, 0.460063607f},
-std::array<float,2>{0.955355465f, 0.574184656f},
-std::array<float,2>{0.28690055f, 0.979506552f},
-std::array<float,2>{0.68809396f, 0.0850362331f},
-std::array<float,2>{0.0480020419f, 0.0976102203f},
-std::array<float,2>{0.894495308f, 0.944409013f},
-std::array<float,2>{0.348279417f, 0.616655111f},
-std::array<float,2>{0.6302315f, 0.479441375f},
-std::array<float,2>{0.479098737f, 0.259021789f},
-std::array<float,2>{0.597770452f, 0.674144566f},
-std::array<float,2>{0.167961061f, 0.756647348f},
-std::array<float,2>{0.812349916f, 0.208633855f},
-std::array<float,2>{0.281605273f, 0.177905336f},
-std::array<float,2>{0.692184627f, 0.853928685f},
-std::array<float,2>{0.110810168f, 0.724730968f},
-std::array<float,2>{0.960698903f, 0.334071875f},
-std::array<float,2>{0.236150101f, 0.388956279f},
-std::array<float,2>{0.838201702f, 0.505613863f},
-std::array<float,2>{0.377520978f, 0.937295556f},
-std::array<float,2>{0.541090727f, 0.0333097763f},
-std::array<float,2>{0.137331843f, 0.244767696f},
-std::array<float,2>{0.769612312f, 0.805471718f},
-std::array<float,2>{0.458659947f, 0.642591059f},
-std::array<float,2>{0.579936326f, 0.30670014f},
-std::array<float,2>{0.317676246f, 0.439096868f},
-std::array<float,2>{0.679328144f, 0.582682252f},
-std::array<float,2>{0.0174433459f, 0.989860475f},
-std::array<float,2>{0.920105278f, 0.077780202f},
-std::array<float,2>{0.423066556f, 0.010923258f},
-std::array<float,2>{0.515579402f, 0.900966167f},
-std::array<float,2>{0.213946253f, 0.539948344f},
-std::array<float,2>{0.863263547f, 0.423475325f},
-std::array<float,2>{0.0679099634f, 0.366705447f},
-std::array<float,2>{0.985845923f, 0.712923765f},
-std::array<float,2>{0.262168258f, 0.841292024f},
-std::array<float,2>{0.739316523f, 0.151690647f},
-std::array<float,2>{0.101020619f, 0.136494622f},
-std::array<float,2>{0.951657236f, 0.819427133f},
-std::array<float,2>{0.299878001f, 0.701953709f},
-std::array<float,2>{0.712776065f, 0.343789399f},
-std::array<float,2>{0.401881129f, 0.414791405f},
-std::array<float,2>{0.54742533f, 0.561055124f},
-std::array<float,2>{0.221168309f, 0.888156056f},
-std::array<float,2>{0.814331591f, 0.0247913394f},
-std::array<float,2>{0.359952241f, 0.0884597301f},
-std::array<float,2>{0.649987817f, 0.971303165f},
-std::array<float,2>{0.045108635f, 0.566991508f},
-std::array<float,2>{0.8850559f, 0.463891357f},
-std::array<float,2>{0.181115776f, 0.294654489f},
-std::array<float,2>{0.79514879f, 0.62525934f},
-std::array<float,2>{0.496752948f, 0.796730161f},
-std::array<float,2>{0.620349765f, 0.230466321f},
-std::array<float,2>{0.188889205f, 0.052034948f},
-std::array<float,2>{0.8512851f, 0.915330708f},
-std::array<float,2>{0.420535028f, 0.516296923f},
-std::array<float,2>{0.52328676f, 0.392967761f},
-std::array<float,2>{0.280901641f, 0.312773436f},
-std::array<float,2>{0.719004929f, 0.735540688f},
-std::array<float,2>{0.0840131715f, 0.871214926f},
-std::array<float,2>{0.974906147f, 0.158417583f},
-std::array<float,2>{0.451219231f, 0.188532442f},
-std::array<float,2>{0.577184021f, 0.77209419f},
-std::array<float,2>{0.142585933f, 0.667358398f},
-std::array<float,2>{0.760067701f, 0.273957849f},
-std::array<float,2>{0.000124316808f, 0.485276431f},
-std::array<float,2>{0.935284138f, 0.594429672f},
-std::array<float,2>{0.337799251f, 0.959259093f},
-std::array<float,2>{0.665864468f, 0.11114309f},
-std::array<float,2>{0.0890002772f, 0.0215855539f},
-std::array<float,2>{0.979862571f, 0.876391888f},
-std::array<float,2>{0.268027127f, 0.55129236f},
-std::array<float,2>{0.728756607f, 0.407619774f},
-std::array<float,2>{0.406763822f, 0.356725365f},
-std::array<float,2>{0.524253905f, 0.69461441f},
-std::array<float,2>{0.20117721f, 0.823669195f},
-std::array<float,2>{0.856546879f, 0.126239479f},
-std::array<float,2>{0.328891397f, 0.219772473f},
-std::array<float,2>{0.662652075f, 0.784328878f},
-std::array<float,2>{0.0150440671f, 0.64062041f},
-std::array<float,2>{0.928723633f, 0.285929501f},
-std::array<float,2>{0.152510315f, 0.455861717f},
-std::array<float,2>{0.755642176f, 0.577995241f},
-std::array<float,2>{0.43783471f, 0.984219968f},
-std::array<float,2>{0.569093645f, 0.0818858072f},
-std::array<float,2>{0.228711113f, 0.171232149f},
-std::array<float,2>{0.821063519f, 0.859695017f},
-std::array<float,2>{0.394442737f, 0.747080028f},
-std::array<float,2>{0.561596274f, 0.323350102f},
-std::array<float,2>{0.304868102f, 0.405118436f},
-std::array<float,2>{0.703902483f, 0.529718876f},
-std::array<float,2>{0.106561951f, 0.906286836f},
-std::array<float,2>{0.940636516f, 0.058706671f},
-std::array<float,2>{0.48627907f, 0.119293988f},
-std::array<float,2>{0.613946497f, 0.965419173f},
-std::array<float,2>{0.173922181f, 0.605647564f},
-std::array<float,2>{0.784829378f, 0.492494315f},
-std::array<float,2>{0.0388057791f, 0.269631505f},
-std::array<float,2>{0.881319463f, 0.66379267f},
-std::array<float,2>{0.37423414f, 0.774156928f},
-std::array<float,2>{0.643478155f, 0.199944511f},
-std::array<float,2>{0.0307652447f, 0.21319133f},
-std::array<float,2>{0.907889128f, 0.760247827f},
-std::array<float,2>{0.32402578f, 0.684889257f},
-std::array<float,2>{0.681734562f, 0.256404579f},
-std::array<float,2>{0.464920551f, 0.473159492f},
-std::array<float,2>{0.58920157f, 0.622025311f},
-std::array<float,2>{0.128503308f, 0.946292996f},
-std::array<float,2>{0.780243814f, 0.103637755f},
-std::array<float,2>{0.25294441f, 0.042611897f},
-std::array<float,2>{0.745393157f, 0.924042523f},
-std::array<float,2>{0.0757412836f, 0.514037967f},
-std::array<float,2>{0.996250451f, 0.37559548f},
-std::array<float,2>{0.209124178f, 0.339138269f},
-std::array<float,2>{0.872082293f, 0.730228603f},
-std::array<float,2>{0.435168684f, 0.844659328f},
-std::array<float,2>{0.502247214f, 0.18020092f},
-std::array<float,2>{0.163191408f, 0.0641556531f},
-std::array<float,2>{0.797799408f, 0.995809197f},
-std::array<float,2>{0.475393146f, 0.586331964f},
-std::array<float,2>{0.607831478f, 0.449117452f},
-std::array<float,2>{0.356196344f, 0.299478084f},
-std::array<float,2>{0.633206725f, 0.654255033f},
-std::array<float,2>{0.0599613041f, 0.801396906f},
-std::array<float,2>{0.899814904f, 0.239603981f},
-std::array<float,2>{0.388605684f, 0.14807725f},
-std::array<float,2>{0.538546562f, 0.834743083f},
-std::array<float,2>{0.248334303f, 0.705132365f},
-std::array<float,2>{0.834500551f, 0.373087704f},
-std::array<float,2>{0.123622939f, 0.436164737f},
-std::array<float,2>{0.96135354f, 0.534887254f},
-std::array<float,2>{0.295877457f, 0.893704534f},
-std::array<float,2>{0.700018525f, 0.00693671219f},
-std::array<float,2>{0.00924708322f, 0.0379314721f},
-std::array<float,2>{0.922502339f, 0.932603717f},
-std::array<float,2>{0.334201843f, 0.502493858f},
-std::array<float,2>{0.657723546f, 0.383102477f},
-std::array<float,2>{0.444992393f, 0.331719309f},
-std::array<float,2>{0.564980388f, 0.721006811f},
-std::array<float,2>{0.151471451f, 0.856083453f},
-std::array<float,2>{0.753140807f, 0.173825487f},
-std::array<float,2>{0.270303279f, 0.205321908f},
-std::array<float,2>{0.731504321f, 0.750635505f},
-std::array<float,2>{0.092780672f, 0.677428067f},
-std::array<float,2>{0.9813357f, 0.264488488f},
-std::array<float,2>{0.195484653f, 0.484143287f},
-std::array<float,2>{0.853785932f, 0.611720264f},
-std::array<float,2>{0.411568552f, 0.941110432f},
-std::array<float,2>{0.52735585f, 0.0994487852f},
-std::array<float,2>{0.176053703f, 0.154608056f},
-std::array<float,2>{0.785351217f, 0.839664161f},
-std::array<float,2>{0.489393622f, 0.715870142f},
-std::array<float,2>{0.609459639f, 0.360828161f},
-std::array<float,2>{0.367779434f, 0.427142143f},
-std::array<float,2>{0.646767497f, 0.543797791f},
-std::array<float,2>{0.033050444f, 0.90590483f},
-std::array<float,2>{0.877367318f, 0.01462158f},
-std::array<float,2>{0.394546419f, 0.0721828043f},
-std::array<float,2>{0.555501401f, 0.985426784f},
-std::array<float,2>{0.234319165f, 0.581985176f},
-std::array<float,2>{0.82753849f, 0.444339186f},
-std::array<float,2>{0.102380723f, 0.309390217f},
-std::array<float,2>{0.943671405f, 0.647824168f},
-std::array<float,2>{0.311330318f, 0.810755849f},
-std::array<float,2>{0.709166944f, 0.24947378f},
-std::array<float,2>{0.0735146999f, 0.232669204f},
-std::array<float,2>{0.992216825f, 0.790621102f},
-std::array<float,2>{0.257325888f, 0.631488502f},
-std::array<float,2>{0.747703731f, 0.292531192f},
-std::array<float,2>{0.433288395f, 0.467458576f},
-std::array<float,2>{0.504513919f, 0.566225529f},
-std::array<float,2>{0.206552044f, 0.972969353f},
-std::array<float,2>{0.870836437f, 0.0929896384f},
-std::array<float,2>{0.325405955f, 0.0297937077f},
-std::array<float,2>{0.687326074f, 0.883282006f},
-std::array<float,2>{0.0263645053f, 0.555701613f},
-std::array<float,2>{0.911227882f, 0.419139743f},
-std::array<float,2>{0.131346434f, 0.351461172f},
-std::array<float,2>{0.775678694f, 0.6967417f},
-std::array<float,2>{0.462445945f, 0.816281855f},
-std::array<float,2>{0.591426849f, 0.13750273f},
-std::array<float,2>{0.243340284f, 0.113718398f},
-std::array<float,2>{0.831345499f, 0.956270278f},
-std::array<float,2>{0.384568244f, 0.598168015f},
-std::array<float,2>{0.534121454f, 0.48875168f},
-std::array<float,2>{0.290106207f, 0.279545635f},
-std::array<float,2>{0.697966278f, 0.669311345f},
-std::array<float,2>{0.117998064f, 0.768114567f},
-std::array<float,2>{0.965682983f, 0.194462448f},
-std::array<float,2>{0.471157104f, 0.16080457f},
-std::array<float,2>{0.603284299f, 0.868539751f},
-std::array<float,2>{0.158709005f, 0.741956711f},
-std::array<float,2>{0.801993549f, 0.318898112f},
-std::array<float,2>{0.0584855415f, 0.398422837f},
-std::array<float,2>{0.903884351f, 0.523265183f},
-std::array<float,2>{0.354484648f, 0.919015646f},
-std::array<float,2>{0.639174998f, 0.0473620296f},
-std::array<float,2>{0.116180971f, 0.0846276209f},
-std::array<float,2>{0.953765035f, 0.978935659f},
-std::array<float,2>{0.287513047f, 0.572883904f},
-std::array<float,2>{0.6904971f, 0.459498972f},
-std::array<float,2>{0.382107705f, 0.283063889f},
-std::array<float,2>{0.544909298f, 0.634519637f},
-std::array<float,2>{0.241596863f, 0.786722124f},
-std::array<float,2>{0.84158355f, 0.22620064f},
-std::array<float,2>{0.346638799f, 0.1319855f},
-std::array<float,2>{0.627979338f, 0.826604307f},
-std::array<float,2>{0.0529652126f, 0.687823653f},
-std::array<float,2>{0.895084262f, 0.35400036f},
-std::array<float,2>{0.169654652f, 0.411217153f},
-std::array<float,2>{0.808110476f, 0.548596978f},
-std::array<float,2>{0.484238327f, 0.88109988f},
-std::array<float,2>{0.595175624f, 0.0189329423f},
-std::array<float,2>{0.215095863f, 0.196743041f},
-std::array<float,2>{0.865207016f, 0.780584037f},
-std::array<float,2>{0.428756148f, 0.659815967f},
-std::array<float,2>{0.511559069f, 0.267258972f},
-std::array<float,2>{0.260883301f, 0.49963066f},
-std::array<float,2>{0.734511852f, 0.604541302f},
-std::array<float,2>{0.0625329316f, 0.964185655f},
-std::array<float,2>{0.989924073f, 0.121869653f},
-std::array<float,2>{0.455792457f, 0.0576389357f},
-std::array<float,2>{0.583126605f, 0.911351919f},
-std::array<float,2>{0.133747473f, 0.526829541f},
-std::array<float,2>{0.766988695f, 0.401724964f},
-std::array<float,2>{0.0212540478f, 0.325226516f},
-std::array<float,2>{0.916049838f, 0.743689835f},
-std::array<float,2>{0.314494461f, 0.867021382f},
-std::array<float,2>{0.675103307f, 0.164342239f},
-std::array<float,2>{0.0428474247f, 0.184301764f},
-std::array<float,2>{0.887750864f, 0.851552486f},
-std::array<float,2>{0.366973281f, 0.73256135f},
-std::array<float,2>{0.656236887f, 0.340410858f},
-std::array<float,2>{0.493216872f, 0.382432967f},
-std::array<float,2>{0.624511659f, 0.509077609f},
-std::array<float,2>{0.187214807f, 0.926090181f},
-std::array<float,2>{0.791114032f, 0.0451593809f},
-std::array<float,2>{0.302020669f, 0.106036566f},
-std::array<float,2>{0.714950621f, 0.949881554f},
-std::array<float,2>{0.0948551968f, 0.620041311f},
-std::array<float,2>{0.947396636f, 0.471664131f},
-std::array<float,2>{0.22337772f, 0.250400245f},
-std::array<float,2>{0.817757249f, 0.683203399f},
-std::array<float,2>{0.402483553f, 0.762810409f},
-std::array<float,2>{0.553584814f, 0.216053307f},
-std::array<float,2>{0.146339163f, 0.000534489402f},
-std::array<float,2>{0.763390362f, 0.897928238f},
-std::array<float,2>{0.44919154f, 0.536764085f},
-std::array<float,2>{0.573696136f, 0.431971461f},
-std::array<float,2>{0.340058059f, 0.368108273f},
-std::array<float,2>{0.669691682f, 0.707237959f},
-std::array<float,2>{0.00604620483f, 0.829315484f},
-std::array<float,2>{0.93318516f, 0.144500315f},
-std::array<float,2>{0.414531797f, 0.235378996f},
-std::array<float,2>{0.519241154f, 0.797531366f},
-std::array<float,2>{0.192419842f, 0.651388288f},
-std::array<float,2>{0.844474494f, 0.303183913f},
-std::array<float,2>{0.0800482333f, 0.45104751f},
-std::array<float,2>{0.970516503f, 0.591783524f},
-std::array<float,2>{0.273935318f, 0.9991256f},
-std::array<float,2>{0.72650367f, 0.0691526383f},
-std::array<float,2>{0.0192873739f, 0.0755955651f},
-std::array<float,2>{0.919149756f, 0.991180956f},
-std::array<float,2>{0.318785757f, 0.585412621f},
-std::array<float,2>{0.676847696f, 0.440498799f},
-std::array<float,2>{0.460770458f, 0.305826604f},
-std::array<float,2>{0.581712186f, 0.640650094f},
-std::array<float,2>{0.139064774f, 0.807419002f},
-std::array<float,2>{0.772856593f, 0.242616698f},
-std::array<float,2>{0.263741881f, 0.15035376f},
-std::array<float,2>{0.740569711f, 0.841871142f},
-std::array<float,2>{0.0685906336f, 0.712553322f},
-std::array<float,2>{0.98725456f, 0.364135265f},
-std::array<float,2>{0.211830929f, 0.424193978f},
-std::array<float,2>{0.859482944f, 0.542031586f},
-std::array<float,2>{0.425110936f, 0.900333524f},
-std::array<float,2>{0.513231456f, 0.00909980386f},
-std::array<float,2>{0.164861023f, 0.209261313f},
-std::array<float,2>{0.810182452f, 0.755701005f},
-std::array<float,2>{0.476687789f, 0.67348969f},
-std::array<float,2>{0.59994483f, 0.260362685f},
-std::array<float,2>{0.351470739f, 0.476694465f},
-std::array<float,2>{0.632751286f, 0.61468184f},
-std::array<float,2>{0.0501546897f, 0.942176342f},
-std::array<float,2>{0.890704513f, 0.093857415f},
-std::array<float,2>{0.376262009f, 0.033001624f},
-std::array<float,2>{0.540129066f, 0.933750451f},
-std::array<float,2>{0.23763597f, 0.506526649f},
-std::array<float,2>{0.837375224f, 0.386897177f},
-std::array<float,2>{0.112279117f, 0.333900154f},
-std::array<float,2>{0.957982242f, 0.723609746f},
-std::array<float,2>{0.284551322f, 0.85345304f},
-std::array<float,2>{0.694350183f, 0.176982492f},
-std::array<float,2>{0.0833063647f, 0.157653496f},
-std::array<float,2>{0.974499226f, 0.873112917f},
-std::array<float,2>{0.278269321f, 0.737941742f},
-std::array<float,2>{0.722472489f, 0.315480977f},
-std::array<float,2>{0.418108553f, 0.391645104f},
-std::array<float,2>{0.520668507f, 0.51912123f},
-std::array<float,2>{0.190511674f, 0.916129768f},
-std::array<float,2>{0.849518478f, 0.053143464f},
-std::array<float,2>{0.338352352f, 0.111411504f},
-std::array<float,2>{0.666730046f, 0.958773851f},
-std::array<float,2>{0.00246153446f, 0.596929312f},
-std::array<float,2>{0.935954988f, 0.486370772f},
-std::array<float,2>{0.141802162f, 0.276835114f},
-std::array<float,2>{0.759036839f, 0.66542834f},
-std::array<float,2>{0.450545132f, 0.769678414f},
-std::array<float,2>{0.575005472f, 0.190506056f},
-std::array<float,2>{0.218895629f, 0.0259600282f},
-std::array<float,2>{0.814577579f, 0.88947469f},
-std::array<float,2>{0.400070608f, 0.560245097f},
-std::array<float,2>{0.548875749f, 0.417652428f},
-std::array<float,2>{0.297282696f, 0.346124291f},
-std::array<float,2>{0.714059114f, 0.700659275f},
-std::array<float,2>{0.0995130092f, 0.816996217f},
-std::array<float,2>{0.949269772f, 0.133579358f},
-std::array<float,2>{0.499231756f, 0.228106022f},
-std::array<float,2>{0.618421614f, 0.794703066f},
-std::array<float,2>{0.183437765f, 0.627339184f},
-std::array<float,2>{0.794472337f, 0.296074599f},
-std::array<float,2>{0.0441659987f, 0.462407738f},
-std::array<float,2>{0.884016514f, 0.570211172f},
-std::array<float,2>{0.362980485f, 0.969992697f},
-std::array<float,2>{0.651940405f, 0.0871338323f},
-std::array<float,2>{0.108328968f, 0.0612850264f},
-std::array<float,2>{0.938816845f, 0.908489048f},
-std::array<float,2>{0.307725847f, 0.52878052f},
-std::array<float,2>{0.70645988f, 0.404167563f},
-std::array<float,2>{0.39225632f, 0.320638299f},
-std::array<float,2>{0.559546053f, 0.749413311f},
-std::array<float,2>{0.226794258f, 0.862730443f},
-std::array<float,2>{0.823979139f, 0.168803334f},
-std::array<float,2>{0.372524291f, 0.202153698f},
-std::array<float,2>{0.642064333f, 0.777188838f},
-std::array<float,2>{0.0356622934f, 0.661638975f},
-std::array<float,2>{0.879619956f, 0.271662712f},
-std::array<float,2>{0.17282027f, 0.495712072f},
-std::array<float,2>{0.782223821f, 0.607553422f},
-std::array<float,2>{0.488121897f, 0.966882944f},
-std::array<float,2>{0.616001964f, 0.117859855f},
-std::array<float,2>{0.200834826f, 0.128641948f},
-std::array<float,2>{0.857762516f, 0.820357144f},
-std::array<float,2>{0.409962505f, 0.693120599f},
-std::array<float,2>{0.526039898f, 0.357542872f},
-std::array<float,2>{0.266312152f, 0.410155684f},
-std::array<float,2>{0.727322757f, 0.553005278f},
-std::array<float,2>{0.0869528204f, 0.878603399f},
-std::array<float,2>{0.978412926f, 0.0201008525f},
-std::array<float,2>{0.440118432f, 0.0797778144f},
-std::array<float,2>{0.56700933f, 0.981314778f},
-std::array<float,2>{0.154741183f, 0.575158715f},
-std::array<float,2>{0.755943775f, 0.454996169f},
-std::array<float,2>{0.0127053745f, 0.287439227f},
-std::array<float,2>{0.92694205f, 0.638103962f},
-std::array<float,2>{0.330737382f, 0.781855404f},
-std::array<float,2>{0.661112845f, 0.221512347f},
-std::array<float,2>{0.0612132102f, 0.240794137f},
-std::array<float,2>{0.901883781f, 0.804014444f},
-std::array<float,2>{0.359338522f, 0.655237734f},
-std::array<float,2>{0.634847105f, 0.298380136f},
-std::array<float,2>{0.473635465f, 0.44628194f},
-std::array<float,2>{0.60701865f, 0.589259326f},
-std::array<float,2>{0.161244944f, 0.993913174f},
-std::array<float,2>{0.799757004f, 0.0663952008f},
-std::array<float,2>{0.294188946f, 0.00484608999f},
-std::array<float,2>{0.702292621f, 0.890814602f},
-std::array<float,2>{0.121901304f, 0.532885313f},
-std::array<float,2>{0.963457763f, 0.434142739f},
-std::array<float,2>{0.247578323f, 0.372051895f},
-std::array<float,2>{0.832338274f, 0.704078555f},
-std::array<float,2>{0.388905525f, 0.832403719f},
-std::array<float,2>{0.536151528f, 0.145051792f},
-std::array<float,2>{0.126314789f, 0.101757653f},
-std::array<float,2>{0.778465629f, 0.947956622f},
-std::array<float,2>{0.468004942f, 0.624013901f},
-std::array<float,2>{0.586703718f, 0.475407392f},
-std::array<float,2>{0.322031677f, 0.255285501f},
-std::array<float,2>{0.680469215f, 0.686554611f},
-std::array<float,2>{0.028924441f, 0.758589685f},
-std::array<float,2>{0.908296585f, 0.211980507f},
-std::array<float,2>{0.437229842f, 0.18335551f},
-std::array<float,2>{0.50028944f, 0.846826434f},
-std::array<float,2>{0.208722979f, 0.728362679f},
-std::array<float,2>{0.873068631f, 0.336846381f},
-std::array<float,2>{0.0772707015f, 0.378876239f},
-std::array<float,2>{0.99946183f, 0.513083577f},
-std::array<float,2>{0.250157565f, 0.923079073f},
-std::array<float,2>{0.744098902f, 0.0405442715f},
-std::array<float,2>{0.0344912447f, 0.0119905584f},
-std::array<float,2>{0.875531971f, 0.903449893f},
-std::array<float,2>{0.371073097f, 0.54568541f},
-std::array<float,2>{0.645699322f, 0.428017646f},
-std::array<float,2>{0.492178291f, 0.363030046f},
-std::array<float,2>{0.612566888f, 0.718211591f},
-std::array<float,2>{0.17870371f, 0.836792231f},
-std::array<float,2>{0.78723371f, 0.15419209f},
-std::array<float,2>{0.308750421f, 0.247030482f},
-std::array<float,2>{0.707998693f, 0.809951663f},
-std::array<float,2>{0.103721574f, 0.645466685f},
-std::array<float,2>{0.941605508f, 0.311968476f},
-std::array<float,2>{0.232150838f, 0.442383856f},
-std::array<float,2>{0.82468003f, 0.578569293f},
-std::array<float,2>{0.397204041f, 0.987469137f},
-std::array<float,2>{0.558268726f, 0.0729627758f},
-std::array<float,2>{0.14899379f, 0.175473183f},
-std::array<float,2>{0.751845658f, 0.859226525f},
-std::array<float,2>{0.442607164f, 0.719382405f},
-std::array<float,2>{0.563275874f, 0.329415083f},
-std::array<float,2>{0.333579451f, 0.386569291f},
-std::array<float,2>{0.658294976f, 0.500756919f},
-std::array<float,2>{0.0108732488f, 0.93063128f},
-std::array<float,2>{0.925656855f, 0.0365882367f},
-std::array<float,2>{0.412552595f, 0.0999640822f},
-std::array<float,2>{0.531079531f, 0.938815594f},
-std::array<float,2>{0.198103487f, 0.610299051f},
-std::array<float,2>{0.851623833f, 0.482297868f},
-std::array<float,2>{0.090290688f, 0.262950063f},
-std::array<float,2>{0.983251333f, 0.678195715f},
-std::array<float,2>{0.272331476f, 0.753695011f},
-std::array<float,2>{0.733372927f, 0.203386724f},
-std::array<float,2>{0.120309927f, 0.191517457f},
-std::array<float,2>{0.967266679f, 0.765758574f},
-std::array<float,2>{0.292031139f, 0.670001149f},
-std::array<float,2>{0.696787238f, 0.27790466f},
-std::array<float,2>{0.38647899f, 0.492101103f},
-std::array<float,2>{0.531748354f, 0.600537539f},
-std::array<float,2>{0.245229781f, 0.954211175f},
-std::array<float,2>{0.828797758f, 0.116523139f},
-std::array<float,2>{0.352767378f, 0.0488642789f},
-std::array<float,2>{0.637293339f, 0.921869993f},
-std::array<float,2>{0.0552205145f, 0.521407127f},
-std::array<float,2>{0.905679226f, 0.395454139f},
-std::array<float,2>{0.158162504f, 0.316548854f},
-std::array<float,2>{0.803077519f, 0.739915252f},
-std::array<float,2>{0.470342278f, 0.869352221f},
-std::array<float,2>{0.60499382f, 0.162693426f},
-std::array<float,2>{0.203274906f, 0.0905880481f},
-std::array<float,2>{0.868963599f, 0.975716293f},
-std::array<float,2>{0.431387246f, 0.563487291f},
-std::array<float,2>{0.50666678f, 0.465601891f},
-std::array<float,2>{0.254208714f, 0.290482283f},
-std::array<float,2>{0.748255789f, 0.630839288f},
-std::array<float,2>{0.0722226948f, 0.792745054f},
-std::array<float,2>{0.994294763f, 0.231740519f},
-std::array<float,2>{0.46375683f, 0.140066013f},
-std::array<float,2>{0.592052579f, 0.812709212f},
-std::array<float,2>{0.129112884f, 0.69747138f},
-std::array<float,2>{0.774777174f, 0.347924054f},
-std::array<float,2>{0.0249030069f, 0.420153916f},
-std::array<float,2>{0.912296832f, 0.557755291f},
-std::array<float,2>{0.326528162f, 0.885483325f},
-std::array<float,2>{0.683681369f, 0.0291502345f},
-std::array<float,2>{0.0660919324f, 0.124905095f},
-std::array<float,2>{0.990462124f, 0.96181345f},
-std::array<float,2>{0.258811176f, 0.603031397f},
-std::array<float,2>{0.7366184f, 0.496852934f},
-std::array<float,2>{0.427415729f, 0.267620623f},
-std::array<float,2>{0.508594394f, 0.657042563f},
-std::array<float,2>{0.21787411f, 0.777392268f},
-std::array<float,2>{0.865374923f, 0.198217347f},
-std::array<float,2>{0.314228147f, 0.167152286f},
-std::array<float,2>{0.67272234f, 0.865227699f},
-std::array<float,2>{0.0228256043f, 0.745819032f},
-std::array<float,2>{0.914191961f, 0.326253831f},
-std::array<float,2>{0.135765195f, 0.399207592f},
-std::array<float,2>{0.768612385f, 0.52438134f},
-std::array<float,2>{0.454647034f, 0.912820399f},
-std::array<float,2>{0.585111201f, 0.0565234907f},
-std::array<float,2>{0.239728868f, 0.222841695f},
-std::array<float,2>{0.841905534f, 0.788774729f},
-std::array<float,2>{0.380731583f, 0.635923862f},
-std::array<float,2>{0.545907676f, 0.283361286f},
-std::array<float,2>{0.285463274f, 0.458889693f},
-std::array<float,2>{0.689117432f, 0.570800185f},
-std::array<float,2>{0.114807375f, 0.977911711f},
-std::array<float,2>{0.956883013f, 0.0827150643f},
-std::array<float,2>{0.481148928f, 0.0174169932f},
-std::array<float,2>{0.597307682f, 0.880232096f},
-std::array<float,2>{0.171670362f, 0.549599946f},
-std::array<float,2>{0.804848313f, 0.412141651f},
-std::array<float,2>{0.0523863807f, 0.353243887f},
-std::array<float,2>{0.896724582f, 0.690392435f},
-std::array<float,2>{0.344818115f, 0.825538754f},
-std::array<float,2>{0.625612736f, 0.129755288f},
-std::array<float,2>{0.00439302111f, 0.142052397f},
-std::array<float,2>{0.931581855f, 0.831145167f},
-std::array<float,2>{0.342358708f, 0.710209668f},
-std::array<float,2>{0.671049774f, 0.369285315f},
-std::array<float,2>{0.445691556f, 0.429871053f},
-std::array<float,2>{0.57179141f, 0.537966371f},
-std::array<float,2>{0.148031563f, 0.895721197f},
-std::array<float,2>{0.764516532f, 0.00208442239f},
-std::array<float,2>{0.277025759f, 0.0679729134f},
-std::array<float,2>{0.723704398f, 0.99787128f},
-std::array<float,2>{0.0819425434f, 0.59321779f},
-std::array<float,2>{0.972195923f, 0.452007085f},
-std::array<float,2>{0.194495872f, 0.301726043f},
-std::array<float,2>{0.847167134f, 0.649299145f},
-std::array<float,2>{0.417771399f, 0.800097525f},
-std::array<float,2>{0.516009986f, 0.237091482f},
-std::array<float,2>{0.184672743f, 0.0432612598f},
-std::array<float,2>{0.790238559f, 0.928910792f},
-std::array<float,2>{0.494190931f, 0.510850132f},
-std::array<float,2>{0.621361375f, 0.380260855f},
-std::array<float,2>{0.365136176f, 0.342936307f},
-std::array<float,2>{0.653606057f, 0.732302427f},
-std::array<float,2>{0.0405529663f, 0.848690927f},
-std::array<float,2>{0.890458584f, 0.186090916f},
-std::array<float,2>{0.406164497f, 0.218708277f},
-std::array<float,2>{0.552677035f, 0.76424396f},
-std::array<float,2>{0.225188047f, 0.68155247f},
-std::array<float,2>{0.819518209f, 0.252528816f},
-std::array<float,2>{0.096182242f, 0.469211668f},
-std::array<float,2>{0.945435762f, 0.618937433f},
-std::array<float,2>{0.303645164f, 0.951646805f},
-std::array<float,2>{0.717395604f, 0.108723253f},
-std::array<float,2>{0.0602361746f, 0.0657830536f},
-std::array<float,2>{0.900257051f, 0.993452728f},
-std::array<float,2>{0.355649352f, 0.58948791f},
-std::array<float,2>{0.633420408f, 0.445475012f},
-std::array<float,2>{0.474702775f, 0.298335761f},
-std::array<float,2>{0.608178973f, 0.654481411f},
-std::array<float,2>{0.163608193f, 0.804276645f},
-std::array<float,2>{0.79730618f, 0.240712643f},
-std::array<float,2>{0.294945776f, 0.144674554f},
-std::array<float,2>{0.699352145f, 0.832873642f},
-std::array<float,2>{0.123228639f, 0.703418195f},
-std::array<float,2>{0.961818814f, 0.371252328f},
-std::array<float,2>{0.248755977f, 0.433765143f},
-std::array<float,2>{0.834003687f, 0.532406867f},
-std::array<float,2>{0.387761831f, 0.891425431f},
-std::array<float,2>{0.538850546f, 0.00400864193f},
-std::array<float,2>{0.128225192f, 0.212547883f},
-std::array<float,2>{0.779705167f, 0.758295655f},
-std::array<float,2>{0.465612322f, 0.687213004f},
-std::array<float,2>{0.589753866f, 0.255456537f},
-std::array<float,2>{0.32340765f, 0.474679321f},
-std::array<float,2>{0.682451844f, 0.623163402f},
-std::array<float,2>{0.0302820411f, 0.947544396f},
-std::array<float,2>{0.907484174f, 0.102316856f},
-std::array<float,2>{0.434724987f, 0.0401246473f},
-std::array<float,2>{0.502654254f, 0.92364651f},
-std::array<float,2>{0.209780917f, 0.513514102f},
-std::array<float,2>{0.872756422f, 0.378306627f},
-std::array<float,2>{0.0754854605f, 0.335962594f},
-std::array<float,2>{0.996926486f, 0.727709353f},
-std::array<float,2>{0.253823668f, 0.847574949f},
-std::array<float,2>{0.745718837f, 0.182827964f},
-std::array<float,2>{0.107408538f, 0.168388397f},
-std::array<float,2>{0.940992117f, 0.862982213f},
-std::array<float,2>{0.305570304f, 0.749585688f},
-std::array<float,2>{0.703212619f, 0.320943445f},
-std::array<float,2>{0.393893808f, 0.403763533f},
-std::array<float,2>{0.562229812f, 0.528912365f},
-std::array<float,2>{0.229151472f, 0.908901274f},
-std::array<float,2>{0.820684671f, 0.0607113577f},
-std::array<float,2>{0.374990284f, 0.117604963f},
-std::array<float,2>{0.642941117f, 0.96735996f},
-std::array<float,2>{0.0385515057f, 0.608240366f},
-std::array<float,2>{0.881810784f, 0.49532631f},
-std::array<float,2>{0.174531966f, 0.272306025f},
-std::array<float,2>{0.784465492f, 0.661244214f},
-std::array<float,2>{0.485741943f, 0.776821077f},
-std::array<float,2>{0.613518953f, 0.203114659f},
-std::array<float,2>{0.201980293f, 0.0199032575f},
-std::array<float,2>{0.857239485f, 0.878279507f},
-std::array<float,2>{0.406546623f, 0.553284585f},
-std::array<float,2>{0.52346611f, 0.409508437f},
-std::array<float,2>{0.268088758f, 0.358224422f},
-std::array<float,2>{0.72904706f, 0.692501605f},
-std::array<float,2>{0.0897826925f, 0.820810378f},
-std::array<float,2>{0.980074763f, 0.128069937f},
-std::array<float,2>{0.438201815f, 0.221165091f},
-std::array<float,2>{0.568531632f, 0.781494617f},
-std::array<float,2>{0.152936801f, 0.638195515f},
-std::array<float,2>{0.755004466f, 0.287753612f},
-std::array<float,2>{0.0152108744f, 0.454488575f},
-std::array<float,2>{0.929427743f, 0.574605167f},
-std::array<float,2>{0.328482538f, 0.980924249f},
-std::array<float,2>{0.662295461f, 0.0794140995f},
-std::array<float,2>{0.0847137421f, 0.0535888411f},
-std::array<float,2>{0.975514591f, 0.91670078f},
-std::array<float,2>{0.280656785f, 0.518935382f},
-std::array<float,2>{0.71930486f, 0.392425388f},
-std::array<float,2>{0.420066953f, 0.316109478f},
-std::array<float,2>{0.522563219f, 0.737774074f},
-std::array<float,2>{0.189362407f, 0.873593748f},
-std::array<float,2>{0.850829899f, 0.158161625f},
-std::array<float,2>{0.337270617f, 0.191395923f},
-std::array<float,2>{0.665444613f, 0.770325601f},
-std::array<float,2>{0.000703212165f, 0.665718019f},
-std::array<float,2>{0.934760571f, 0.27719447f},
-std::array<float,2>{0.143460318f, 0.486993462f},
-std::array<float,2>{0.760338664f, 0.597478271f},
-std::array<float,2>{0.452105612f, 0.958215714f},
-std::array<float,2>{0.578056455f, 0.112123325f},
-std::array<float,2>{0.221276313f, 0.132924706f},
-std::array<float,2>{0.813756883f, 0.816691041f},
-std::array<float,2>{0.401672632f, 0.701093733f},
-std::array<float,2>{0.547241211f, 0.346244693f},
-std::array<float,2>{0.300385982f, 0.417086095f},
-std::array<float,2>{0.712079048f, 0.559951842f},
-std::array<float,2>{0.101193301f, 0.888935685f},
-std::array<float,2>{0.951818407f, 0.0257077403f},
-std::array<float,2>{0.49615863f, 0.0874252394f},
-std::array<float,2>{0.620748281f, 0.970306218f},
-std::array<float,2>{0.181452751f, 0.569353461f},
-std::array<float,2>{0.795893073f, 0.462125659f},
-std::array<float,2>{0.0456726067f, 0.296660334f},
-std::array<float,2>{0.885339558f, 0.627512157f},
-std::array<float,2>{0.35982281f, 0.794095159f},
-std::array<float,2>{0.649705827f, 0.22763963f},
-std::array<float,2>{0.0168605894f, 0.243152395f},
-std::array<float,2>{0.920649171f, 0.806847215f},
-std::array<float,2>{0.318310082f, 0.641566396f},
-std::array<float,2>{0.678896606f, 0.306251436f},
-std::array<float,2>{0.458366901f, 0.44129613f},
-std::array<float,2>{0.579224408f, 0.58588928f},
-std::array<float,2>{0.13705498f, 0.990498424f},
-std::array<float,2>{0.770318806f, 0.0759193376f},
-std::array<float,2>{0.262557626f, 0.00967444573f},
-std::array<float,2>{0.739825845f, 0.899476051f},
-std::array<float,2>{0.0678079724f, 0.542737246f},
-std::array<float,2>{0.98580128f, 0.424405307f},
-std::array<float,2>{0.214655861f, 0.363511145f},
-std::array<float,2>{0.862542868f, 0.712379396f},
-std::array<float,2>{0.423596084f, 0.842368186f},
-std::array<float,2>{0.514720559f, 0.149870515f},
-std::array<float,2>{0.167079151f, 0.0946677998f},
-std::array<float,2>{0.811766148f, 0.941821992f},
-std::array<float,2>{0.478573531f, 0.615166962f},
-std::array<float,2>{0.598172724f, 0.477335483f},
-std::array<float,2>{0.347736031f, 0.260235101f},
-std::array<float,2>{0.630674064f, 0.673093915f},
-std::array<float,2>{0.0487481616f, 0.755009949f},
-std::array<float,2>{0.89393872f, 0.209710836f},
-std::array<float,2>{0.37702316f, 0.177505642f},
-std::array<float,2>{0.541788042f, 0.852953374f},
-std::array<float,2>{0.235525742f, 0.722838044f},
-std::array<float,2>{0.838821232f, 0.333403915f},
-std::array<float,2>{0.110952236f, 0.387236923f},
-std::array<float,2>{0.960079432f, 0.506197453f},
-std::array<float,2>{0.282058805f, 0.934215009f},
-std::array<float,2>{0.691852391f, 0.0326563194f},
-std::array<float,2>{0.00674415054f, 0.00291904714f},
-std::array<float,2>{0.933009386f, 0.896440804f},
-std::array<float,2>{0.340439409f, 0.53745532f},
-std::array<float,2>{0.66907829f, 0.430487514f},
-std::array<float,2>{0.448358864f, 0.369817823f},
-std::array<float,2>{0.573845744f, 0.710586429f},
-std::array<float,2>{0.145896211f, 0.831942916f},
-std::array<float,2>{0.763041735f, 0.142153248f},
-std::array<float,2>{0.273767024f, 0.236402571f},
-std::array<float,2>{0.726070166f, 0.800765514f},
-std::array<float,2>{0.0795192569f, 0.648817718f},
-std::array<float,2>{0.970198691f, 0.301228672f},
-std::array<float,2>{0.193177015f, 0.451275587f},
-std::array<float,2>{0.843812943f, 0.593433499f},
-std::array<float,2>{0.414739043f, 0.997257173f},
-std::array<float,2>{0.518741786f, 0.0677967593f},
-std::array<float,2>{0.186671808f, 0.185669795f},
-std::array<float,2>{0.791597545f, 0.849525332f},
-std::array<float,2>{0.494068027f, 0.731655717f},
-std::array<float,2>{0.624723315f, 0.343574494f},
-std::array<float,2>{0.366640121f, 0.380398124f},
-std::array<float,2>{0.65527755f, 0.511640847f},
-std::array<float,2>{0.0422842503f, 0.929349422f},
-std::array<float,2>{0.88830632f, 0.0435780473f},
-std::array<float,2>{0.403045744f, 0.108956426f},
-std::array<float,2>{0.553201616f, 0.95198077f},
-std::array<float,2>{0.223098114f, 0.618648171f},
-std::array<float,2>{0.818297982f, 0.46953848f},
-std::array<float,2>{0.0954443067f, 0.25201866f},
-std::array<float,2>{0.948225677f, 0.680797219f},
-std::array<float,2>{0.302600205f, 0.763695776f},
-std::array<float,2>{0.715481222f, 0.218145475f},
-std::array<float,2>{0.0633875951f, 0.197537452f},
-std::array<float,2>{0.989634097f, 0.778215289f},
-std::array<float,2>{0.261543304f, 0.656463802f},
-std::array<float,2>{0.735034525f, 0.268498242f},
-std::array<float,2>{0.42950654f, 0.49627167f},
-std::array<float,2>{0.510816157f, 0.602978349f},
-std::array<float,2>{0.215360448f, 0.961422801f},
-std::array<float,2>{0.864403248f, 0.124063842f},
-std::array<float,2>{0.315101385f, 0.0558194742f},
-std::array<float,2>{0.675403535f, 0.912443936f},
-std::array<float,2>{0.0206057727f, 0.523716807f},
-std::array<float,2>{0.916568041f, 0.398568481f},
-std::array<float,2>{0.133150429f, 0.326847762f},
-std::array<float,2>{0.767118216f, 0.745582581f},
-std::array<float,2>{0.455436975f, 0.864318192f},
-std::array<float,2>{0.583735883f, 0.167840585f},
-std::array<float,2>{0.24212262f, 0.082092531f},
-std::array<float,2>{0.840929091f, 0.978327751f},
-std::array<float,2>{0.382570386f, 0.5708915f},
-std::array<float,2>{0.544184983f, 0.458056003f},
-std::array<float,2>{0.288044631f, 0.284034312f},
-std::array<float,2>{0.691060901f, 0.636531174f},
-std::array<float,2>{0.115571178f, 0.788406193f},
-std::array<float,2>{0.953349292f, 0.223492727f},
-std::array<float,2>{0.483515829f, 0.129309624f},
-std::array<float,2>{0.595561922f, 0.825960636f},
-std::array<float,2>{0.169347703f, 0.68967855f},
-std::array<float,2>{0.808034837f, 0.352991968f},
-std::array<float,2>{0.0534409173f, 0.412900239f},
-std::array<float,2>{0.894942045f, 0.549282134f},
-std::array<float,2>{0.34603706f, 0.880408406f},
-std::array<float,2>{0.628681362f, 0.0166952163f},
-std::array<float,2>{0.117632918f, 0.116705351f},
-std::array<float,2>{0.965124249f, 0.954814434f},
-std::array<float,2>{0.290711969f, 0.599748731f},
-std::array<float,2>{0.697366536f, 0.491596282f},
-std::array<float,2>{0.384006172f, 0.277525157f},
-std::array<float,2>{0.533496201f, 0.670666933f},
-std::array<float,2>{0.243659183f, 0.766367495f},
-std::array<float,2>{0.831574202f, 0.192281187f},
-std::array<float,2>{0.353843421f, 0.162575364f},
-std::array<float,2>{0.638988078f, 0.869885683f},
-std::array<float,2>{0.057687968f, 0.739607513f},
-std::array<float,2>{0.903743804f, 0.317126602f},
-std::array<float,2>{0.158483535f, 0.394637823f},
-std::array<float,2>{0.802455485f, 0.520543635f},
-std::array<float,2>{0.471679628f, 0.921370447f},
-std::array<float,2>{0.602729261f, 0.0493741669f},
-std::array<float,2>{0.206363484f, 0.232181072f},
-std::array<float,2>{0.870325923f, 0.792368531f},
-std::array<float,2>{0.432728559f, 0.630081475f},
-std::array<float,2>{0.504154682f, 0.290728867f},
-std::array<float,2>{0.257259399f, 0.465149194f},
-std::array<float,2>{0.747083545f, 0.564345896f},
-std::array<float,2>{0.0741121769f, 0.976320207f},
-std::array<float,2>{0.992996514f, 0.0898493901f},
-std::array<float,2>{0.462359488f, 0.0285898782f},
-std::array<float,2>{0.591284752f, 0.885125041f},
-std::array<float,2>{0.131387323f, 0.558276713f},
-std::array<float,2>{0.776363909f, 0.420543849f},
-std::array<float,2>{0.0258693062f, 0.348434299f},
-std::array<float,2>{0.911885142f, 0.698125184f},
-std::array<float,2>{0.325848341f, 0.813168883f},
-std::array<float,2>{0.686859488f, 0.140168115f},
-std::array<float,2>{0.0325810276f, 0.153500989f},
-std::array<float,2>{0.877797902f, 0.836322129f},
-std::array<float,2>{0.367410004f, 0.718481541f},
-std::array<float,2>{0.647314072f, 0.362359345f},
-std::array<float,2>{0.490081936f, 0.428301781f},
-std::array<float,2>{0.610043347f, 0.545195401f},
-std::array<float,2>{0.176626951f, 0.904094934f},
-std::array<float,2>{0.78569448f, 0.0125470124f},
-std::array<float,2>{0.310646772f, 0.0724270567f},
-std::array<float,2>{0.709472954f, 0.988132f},
-std::array<float,2>{0.101622589f, 0.578861833f},
-std::array<float,2>{0.944032252f, 0.443094313f},
-std::array<float,2>{0.23375915f, 0.31244871f},
-std::array<float,2>{0.827912688f, 0.644546926f},
-std::array<float,2>{0.395156592f, 0.810442209f},
-std::array<float,2>{0.555157602f, 0.246119693f},
-std::array<float,2>{0.151914671f, 0.0366331488f},
-std::array<float,2>{0.753472626f, 0.929878116f},
-std::array<float,2>{0.444694519f, 0.500335693f},
-std::array<float,2>{0.564867675f, 0.385826558f},
-std::array<float,2>{0.334642589f, 0.329992563f},
-std::array<float,2>{0.6575526f, 0.718946278f},
-std::array<float,2>{0.00969765522f, 0.858699918f},
-std::array<float,2>{0.922186434f, 0.175051063f},
-std::array<float,2>{0.412053645f, 0.203809604f},
-std::array<float,2>{0.52800703f, 0.753113091f},
-std::array<float,2>{0.196217239f, 0.678526103f},
-std::array<float,2>{0.854145169f, 0.263378024f},
-std::array<float,2>{0.0933075175f, 0.48193267f},
-std::array<float,2>{0.980537832f, 0.609514892f},
-std::array<float,2>{0.269617498f, 0.939262688f},
-std::array<float,2>{0.731948733f, 0.100164391f},
-std::array<float,2>{0.0287428163f, 0.104007147f},
-std::array<float,2>{0.908836484f, 0.947124064f},
-std::array<float,2>{0.321628928f, 0.62156105f},
-std::array<float,2>{0.679781854f, 0.47272861f},
-std::array<float,2>{0.468586236f, 0.256150752f},
-std::array<float,2>{0.586345851f, 0.685283542f},
-std::array<float,2>{0.126767293f, 0.760679722f},
-std::array<float,2>{0.779072583f, 0.213669851f},
-std::array<float,2>{0.250645041f, 0.180045679f},
-std::array<float,2>{0.743438065f, 0.844072402f},
-std::array<float,2>{0.0781016275f, 0.729770184f},
-std::array<float,2>{0.999841809f, 0.339387625f},
-std::array<float,2>{0.208210975f, 0.375032157f},
-std::array<float,2>{0.873685241f, 0.51440078f},
-std::array<float,2>{0.436767042f, 0.924571455f},
-std::array<float,2>{0.500915408f, 0.0423690751f},
-std::array<float,2>{0.161741227f, 0.23995322f},
-std::array<float,2>{0.799209058f, 0.801072598f},
-std::array<float,2>{0.47428906f, 0.653440595f},
-std::array<float,2>{0.606664538f, 0.299135983f},
-std::array<float,2>{0.358848721f, 0.448304474f},
-std::array<float,2>{0.635407209f, 0.586526811f},
-std::array<float,2>{0.0606278032f, 0.995281279f},
-std::array<float,2>{0.901663899f, 0.0637754872f},
-std::array<float,2>{0.389249414f, 0.00754214171f},
-std::array<float,2>{0.536815584f, 0.894127548f},
-std::array<float,2>{0.247164607f, 0.534563959f},
-std::array<float,2>{0.832888901f, 0.435564399f},
-std::array<float,2>{0.121423237f, 0.373826772f},
-std::array<float,2>{0.963062584f, 0.705812037f},
-std::array<float,2>{0.294660032f, 0.834249437f},
-std::array<float,2>{0.703117251f, 0.147485122f},
-std::array<float,2>{0.0878401324f, 0.1267768f},
-std::array<float,2>{0.977707386f, 0.824022233f},
-std::array<float,2>{0.266037554f, 0.695030153f},
-std::array<float,2>{0.726825714f, 0.356950641f},
-std::array<float,2>{0.409362465f, 0.408141404f},
-std::array<float,2>{0.525454938f, 0.551012993f},
-std::array<float,2>{0.200328276f, 0.876510859f},
-std::array<float,2>{0.858110011f, 0.0224183146f},
-std::array<float,2>{0.330358535f, 0.0812540352f},
-std::array<float,2>{0.66018033f, 0.983734488f},
-std::array<float,2>{0.0136597157f, 0.577308834f},
-std::array<float,2>{0.92773366f, 0.455491304f},
-std::array<float,2>{0.15509674f, 0.285358518f},
-std::array<float,2>{0.756692588f, 0.640101194f},
-std::array<float,2>{0.439582348f, 0.784976006f},
-std::array<float,2>{0.566583276f, 0.220678836f},
-std::array<float,2>{0.227255479f, 0.0595644079f},
-std::array<float,2>{0.82364583f, 0.906807184f},
-std::array<float,2>{0.391811579f, 0.529973686f},
-std::array<float,2>{0.559025586f, 0.404385597f},
-std::array<float,2>{0.308201641f, 0.324202448f},
-std::array<float,2>{0.70694828f, 0.747785747f},
-std::array<float,2>{0.107672483f, 0.86023432f},
-std::array<float,2>{0.939122021f, 0.171839356f},
-std::array<float,2>{0.487497777f, 0.199358255f},
-std::array<float,2>{0.615282476f, 0.773466527f},
-std::array<float,2>{0.172285333f, 0.663458824f},
-std::array<float,2>{0.78161639f, 0.270427912f},
-std::array<float,2>{0.0355701745f, 0.492785126f},
-std::array<float,2>{0.879149854f, 0.606427193f},
-std::array<float,2>{0.372656047f, 0.964965045f},
-std::array<float,2>{0.642121851f, 0.119742729f},
-std::array<float,2>{0.0991104245f, 0.0249572117f},
-std::array<float,2>{0.949998856f, 0.888542593f},
-std::array<float,2>{0.297665179f, 0.560659409f},
-std::array<float,2>{0.714525998f, 0.414131999f},
-std::array<float,2>{0.399491698f, 0.344282746f},
-std::array<float,2>{0.549490392f, 0.701263249f},
-std::array<float,2>{0.219539076f, 0.819937944f},
-std::array<float,2>{0.815162838f, 0.135931417f},
-std::array<float,2>{0.362611562f, 0.229856804f},
-std::array<float,2>{0.65181458f, 0.796372533f},
-std::array<float,2>{0.0444706827f, 0.625498116f},
-std::array<float,2>{0.884404361f, 0.294319838f},
-std::array<float,2>{0.182744831f, 0.464358509f},
-std::array<float,2>{0.794138849f, 0.566643357f},
-std::array<float,2>{0.499663055f, 0.970802188f},
-std::array<float,2>{0.618759394f, 0.0882210508f},
-std::array<float,2>{0.190965772f, 0.158897549f},
-std::array<float,2>{0.848989487f, 0.871683121f},
-std::array<float,2>{0.418619037f, 0.73628819f},
-std::array<float,2>{0.521386862f, 0.313013762f},
-std::array<float,2>{0.277443022f, 0.393194258f},
-std::array<float,2>{0.721924007f, 0.515928209f},
-std::array<float,2>{0.0838740021f, 0.915570259f},
-std::array<float,2>{0.973683953f, 0.0522751696f},
-std::array<float,2>{0.45069474f, 0.110749356f},
-std::array<float,2>{0.574363589f, 0.959955215f},
-std::array<float,2>{0.142419204f, 0.593930721f},
-std::array<float,2>{0.759733021f, 0.484678984f},
-std::array<float,2>{0.00228215312f, 0.273535103f},
-std::array<float,2>{0.936299503f, 0.667650163f},
-std::array<float,2>{0.338379532f, 0.771507442f},
-std::array<float,2>{0.666129649f, 0.189277142f},
-std::array<float,2>{0.0503086857f, 0.20823139f},
-std::array<float,2>{0.89136821f, 0.755882025f},
-std::array<float,2>{0.350930512f, 0.6747787f},
-std::array<float,2>{0.63209492f, 0.259758651f},
-std::array<float,2>{0.477244645f, 0.47887063f},
-std::array<float,2>{0.600568831f, 0.616794169f},
-std::array<float,2>{0.164146602f, 0.945143938f},
-std::array<float,2>{0.809884489f, 0.0969073102f},
-std::array<float,2>{0.284947187f, 0.0337725282f},
-std::array<float,2>{0.695075691f, 0.93683809f},
-std::array<float,2>{0.11137972f, 0.504977942f},
-std::array<float,2>{0.957494855f, 0.389604479f},
-std::array<float,2>{0.237943918f, 0.334660798f},
-std::array<float,2>{0.837468922f, 0.725312114f},
-std::array<float,2>{0.37654981f, 0.854299664f},
-std::array<float,2>{0.541006863f, 0.178437695f},
-std::array<float,2>{0.139571935f, 0.0776096582f},
-std::array<float,2>{0.773071349f, 0.989725471f},
-std::array<float,2>{0.46012193f, 0.582390308f},
-std::array<float,2>{0.581218958f, 0.438746125f},
-std::array<float,2>{0.319240719f, 0.30731988f},
-std::array<float,2>{0.677722871f, 0.643105209f},
-std::array<float,2>{0.0188231748f, 0.80481118f},
-std::array<float,2>{0.91950649f, 0.244253621f},
-std::array<float,2>{0.425582767f, 0.152080819f},
-std::array<float,2>{0.512898386f, 0.841727555f},
-std::array<float,2>{0.211006135f, 0.713762283f},
-std::array<float,2>{0.860299706f, 0.366364121f},
-std::array<float,2>{0.069282338f, 0.423099577f},
-std::array<float,2>{0.986722171f, 0.539325476f},
-std::array<float,2>{0.264223844f, 0.900745153f},
-std::array<float,2>{0.74117887f, 0.011400233f},
-std::array<float,2>{0.0402740277f, 0.045873329f},
-std::array<float,2>{0.889882505f, 0.926501989f},
-std::array<float,2>{0.364408046f, 0.509582639f},
-std::array<float,2>{0.654148936f, 0.382134318f},
-std::array<float,2>{0.494769365f, 0.340114981f},
-std::array<float,2>{0.622046351f, 0.733125985f},
-std::array<float,2>{0.185510904f, 0.851037502f},
-std::array<float,2>{0.790865242f, 0.183876887f},
-std::array<float,2>{0.303164452f, 0.216503099f},
-std::array<float,2>{0.71703136f, 0.76340121f},
-std::array<float,2>{0.0964941978f, 0.683101356f},
-std::array<float,2>{0.94595319f, 0.250790298f},
-std::array<float,2>{0.224837407f, 0.47116068f},
-std::array<float,2>{0.820067704f, 0.619167149f},
-std::array<float,2>{0.405293316f, 0.949229717f},
-std::array<float,2>{0.55213058f, 0.105951689f},
-std::array<float,2>{0.147769079f, 0.143765107f},
-std::array<float,2>{0.763929486f, 0.8299191f},
-std::array<float,2>{0.446081012f, 0.707626462f},
-std::array<float,2>{0.571470261f, 0.36760807f},
-std::array<float,2>{0.342284411f, 0.432140052f},
-std::array<float,2>{0.671573699f, 0.536440969f},
-std::array<float,2>{0.00454314472f, 0.898402274f},
-std::array<float,2>{0.930807889f, 0.000338136568f},
-std::array<float,2>{0.417371243f, 0.0685300156f},
-std::array<float,2>{0.516553581f, 0.999979138f},
-std::array<float,2>{0.195038468f, 0.59095639f},
-std::array<float,2>{0.847255588f, 0.450656265f},
-std::array<float,2>{0.0813283026f, 0.30360359f},
-std::array<float,2>{0.971763551f, 0.652083635f},
-std::array<float,2>{0.276568055f, 0.796955049f},
-std::array<float,2>{0.724298418f, 0.235938385f},
-std::array<float,2>{0.114322357f, 0.22590059f},
-std::array<float,2>{0.956509829f, 0.786529481f},
-std::array<float,2>{0.285834283f, 0.634273648f},
-std::array<float,2>{0.688706279f, 0.282508612f},
-std::array<float,2>{0.379975855f, 0.459078372f},
-std::array<float,2>{0.546682954f, 0.572710156f},
-std::array<float,2>{0.23990348f, 0.979076684f},
-std::array<float,2>{0.842699468f, 0.0842533335f},
-std::array<float,2>{0.345644265f, 0.0191172268f},
-std::array<float,2>{0.625331521f, 0.881400168f},
-std::array<float,2>{0.0520824566f, 0.548151255f},
-std::array<float,2>{0.897290587f, 0.4120588f},
-std::array<float,2>{0.171376988f, 0.354466796f},
-std::array<float,2>{0.80548358f, 0.688027442f},
-std::array<float,2>{0.480783969f, 0.826939344f},
-std::array<float,2>{0.596871972f, 0.132754579f},
-std::array<float,2>{0.218497813f, 0.121436268f},
-std::array<float,2>{0.86615026f, 0.964512467f},
-std::array<float,2>{0.427073121f, 0.60512352f},
-std::array<float,2>{0.507861972f, 0.499435425f},
-std::array<float,2>{0.259512246f, 0.26693517f},
-std::array<float,2>{0.737188458f, 0.659396291f},
-std::array<float,2>{0.065810293f, 0.780870974f},
-std::array<float,2>{0.991082251f, 0.197250307f},
-std::array<float,2>{0.454524666f, 0.164785028f},
-std::array<float,2>{0.585753977f, 0.866595447f},
-std::array<float,2>{0.136282876f, 0.74329412f},
-std::array<float,2>{0.769434929f, 0.325841725f},
-std::array<float,2>{0.023176834f, 0.402290225f},
-std::array<float,2>{0.915013313f, 0.527328134f},
-std::array<float,2>{0.313738078f, 0.911826253f},
-std::array<float,2>{0.67189151f, 0.0581381731f},
-std::array<float,2>{0.0715889037f, 0.0936135426f},
-std::array<float,2>{0.995036185f, 0.973278344f},
-std::array<float,2>{0.25440982f, 0.565524638f},
-std::array<float,2>{0.748549342f, 0.466925174f},
-std::array<float,2>{0.430756778f, 0.292337686f},
-std::array<float,2>{0.50592792f, 0.630915225f},
-std::array<float,2>{0.203705922f, 0.790234387f},
-std::array<float,2>{0.868200719f, 0.232957616f},
-std::array<float,2>{0.326944709f, 0.136948019f},
-std::array<float,2>{0.68433243f, 0.815446734f},
-std::array<float,2>{0.0247995518f, 0.69678843f},
-std::array<float,2>{0.912650228f, 0.350779057f},
-std::array<float,2>{0.129755259f, 0.419893265f},
-std::array<float,2>{0.775300264f, 0.556436837f},
-std::array<float,2>{0.463151187f, 0.883394301f},
-std::array<float,2>{0.592693567f, 0.0297565125f},
-std::array<float,2>{0.245648503f, 0.1951956f},
-std::array<float,2>{0.828553796f, 0.768057525f},
-std::array<float,2>{0.386164576f, 0.669736683f},
-std::array<float,2>{0.531298697f, 0.28023991f},
-std::array<float,2>{0.292827547f, 0.48911342f},
-std::array<float,2>{0.696552932f, 0.597896099f},
-std::array<float,2>{0.120725922f, 0.956968188f},
-std::array<float,2>{0.967400551f, 0.113962673f},
-std::array<float,2>{0.47010532f, 0.0476037897f},
-std::array<float,2>{0.604900837f, 0.919709027f},
-std::array<float,2>{0.157557786f, 0.522542357f},
-std::array<float,2>{0.803584754f, 0.397517741f},
-std::array<float,2>{0.0550174192f, 0.318761081f},
-std::array<float,2>{0.905968487f, 0.741396427f},
-std::array<float,2>{0.353096515f, 0.868803382f},
-std::array<float,2>{0.63674444f, 0.160199657f},
-std::array<float,2>{0.0114095137f, 0.17329514f},
-std::array<float,2>{0.924818695f, 0.855772018f},
-std::array<float,2>{0.333304703f, 0.721372128f},
-std::array<float,2>{0.659009159f, 0.331529975f},
-std::array<float,2>{0.442972153f, 0.383733809f},
-std::array<float,2>{0.562857509f, 0.502322614f},
-std::array<float,2>{0.148875147f, 0.932014108f},
-std::array<float,2>{0.751235545f, 0.0371460505f},
-std::array<float,2>{0.271720707f, 0.0988680124f},
-std::array<float,2>{0.732465565f, 0.94079566f},
-std::array<float,2>{0.0904874057f, 0.612151921f},
-std::array<float,2>{0.982888997f, 0.483785152f},
-std::array<float,2>{0.197488576f, 0.263999611f},
-std::array<float,2>{0.852374911f, 0.677218437f},
-std::array<float,2>{0.412985086f, 0.75024426f},
-std::array<float,2>{0.530725956f, 0.20596388f},
-std::array<float,2>{0.178062528f, 0.014131533f},
-std::array<float,2>{0.787883222f, 0.905602217f},
-std::array<float,2>{0.491660863f, 0.543136001f},
-std::array<float,2>{0.613240123f, 0.427439183f},
-std::array<float,2>{0.370265573f, 0.361028582f},
-std::array<float,2>{0.646134377f, 0.716448903f},
-std::array<float,2>{0.0349232107f, 0.839136302f},
-std::array<float,2>{0.875485659f, 0.155030519f},
-std::array<float,2>{0.396829635f, 0.249531209f},
-std::array<float,2>{0.55795604f, 0.811181605f},
-std::array<float,2>{0.231451437f, 0.648249507f},
-std::array<float,2>{0.824908733f, 0.308690101f},
-std::array<float,2>{0.104138084f, 0.445004344f},
-std::array<float,2>{0.942228138f, 0.58123672f},
-std::array<float,2>{0.309218615f, 0.986014843f},
-std::array<float,2>{0.707295835f, 0.0713286102f},
-std::array<float,2>{0.037633393f, 0.120604374f},
-std::array<float,2>{0.881861448f, 0.966247678f},
-std::array<float,2>{0.373378813f, 0.607123077f},
-std::array<float,2>{0.643750787f, 0.494086683f},
-std::array<float,2>{0.485188872f, 0.270736456f},
-std::array<float,2>{0.614391923f, 0.663072526f},
-std::array<float,2>{0.175204962f, 0.775390029f},
-std::array<float,2>{0.783452511f, 0.200477868f},
-std::array<float,2>{0.305795938f, 0.170665443f},
-std::array<float,2>{0.704168022f, 0.860635042f},
-std::array<float,2>{0.106380187f, 0.746869385f},
-std::array<float,2>{0.939571798f, 0.323233485f},
-std::array<float,2>{0.229704157f, 0.40577668f},
-std::array<float,2>{0.82192421f, 0.530976653f},
-std::array<float,2>{0.393511534f, 0.907456994f},
-std::array<float,2>{0.561323166f, 0.0596488304f},
-std::array<float,2>{0.153374791f, 0.219482288f},
-std::array<float,2>{0.753963351f, 0.783717453f},
-std::array<float,2>{0.439130008f, 0.639308929f},
-std::array<float,2>{0.569635868f, 0.286738008f},
-std::array<float,2>{0.32924363f, 0.456548899f},
-std::array<float,2>{0.663197756f, 0.576819122f},
-std::array<float,2>{0.0140710706f, 0.983092308f},
-std::array<float,2>{0.928255975f, 0.0807986259f},
-std::array<float,2>{0.407717019f, 0.0232617874f},
-std::array<float,2>{0.524614155f, 0.875348151f},
-std::array<float,2>{0.203042552f, 0.552099764f},
-std::array<float,2>{0.855571747f, 0.406317145f},
-std::array<float,2>{0.0885557532f, 0.356229603f},
-std::array<float,2>{0.97943902f, 0.693495929f},
-std::array<float,2>{0.269351631f, 0.822605193f},
-std::array<float,2>{0.729986966f, 0.125606522f},
-std::array<float,2>{0.124565825f, 0.146933749f},
-std::array<float,2>{0.961961448f, 0.835477889f},
-std::array<float,2>{0.295914233f, 0.706130445f},
-std::array<float,2>{0.700290382f, 0.374474645f},
-std::array<float,2>{0.386977226f, 0.437335342f},
-std::array<float,2>{0.538014531f, 0.533271372f},
-std::array<float,2>{0.249838993f, 0.89321202f},
-std::array<float,2>{0.835217237f, 0.00660468219f},
-std::array<float,2>{0.356699944f, 0.0630168691f},
-std::array<float,2>{0.633960783f, 0.994658113f},
-std::array<float,2>{0.0590859726f, 0.587553322f},
-std::array<float,2>{0.898600757f, 0.447395056f},
-std::array<float,2>{0.16273056f, 0.300209701f},
-std::array<float,2>{0.798422992f, 0.652359843f},
-std::array<float,2>{0.475968629f, 0.801937222f},
-std::array<float,2>{0.608945251f, 0.239033774f},
-std::array<float,2>{0.210765153f, 0.0414771847f},
-std::array<float,2>{0.871986032f, 0.924871027f},
-std::array<float,2>{0.434082389f, 0.51490289f},
-std::array<float,2>{0.503568292f, 0.376122743f},
-std::array<float,2>{0.252389908f, 0.338495374f},
-std::array<float,2>{0.744653821f, 0.728649318f},
-std::array<float,2>{0.0747907013f, 0.845562577f},
-std::array<float,2>{0.997551143f, 0.18070069f},
-std::array<float,2>{0.466092646f, 0.214617416f},
-std::array<float,2>{0.588346362f, 0.761387825f},
-std::array<float,2>{0.126962781f, 0.684131384f},
-std::array<float,2>{0.780924976f, 0.257587194f},
-std::array<float,2>{0.0301948078f, 0.474530637f},
-std::array<float,2>{0.906809151f, 0.622201324f},
-std::array<float,2>{0.322462648f, 0.945669591f},
-std::array<float,2>{0.682733953f, 0.105228968f},
-std::array<float,2>{0.0669016168f, 0.0101905297f},
-std::array<float,2>{0.984604001f, 0.902032912f},
-std::array<float,2>{0.262897789f, 0.540138364f},
-std::array<float,2>{0.739046454f, 0.422801107f},
-std::array<float,2>{0.422524333f, 0.365972936f},
-std::array<float,2>{0.514586449f, 0.714148998f},
-std::array<float,2>{0.213852778f, 0.84014231f},
-std::array<float,2>{0.861630023f, 0.150467113f},
-std::array<float,2>{0.316553771f, 0.245685697f},
-std::array<float,2>{0.67807889f, 0.806398034f},
-std::array<float,2>{0.0163082145f, 0.644154549f},
-std::array<float,2>{0.921436131f, 0.307897061f},
-std::array<float,2>{0.138185799f, 0.43796441f},
-std::array<float,2>{0.77135402f, 0.583238304f},
-std::array<float,2>{0.457055807f, 0.988710165f},
-std::array<float,2>{0.578446031f, 0.0763423294f},
-std::array<float,2>{0.234776378f, 0.179300457f},
-std::array<float,2>{0.839593291f, 0.854733765f},
-std::array<float,2>{0.378836602f, 0.726008773f},
-std::array<float,2>{0.542169511f, 0.335288942f},
-std::array<float,2>{0.282560021f, 0.389661402f},
-std::array<float,2>{0.69252634f, 0.50442189f},
-std::array<float,2>{0.110301733f, 0.936010659f},
-std::array<float,2>{0.959107637f, 0.0350633971f},
-std::array<float,2>{0.480066925f, 0.0960247442f},
-std::array<float,2>{0.598873317f, 0.944278777f},
-std::array<float,2>{0.166210607f, 0.615793824f},
-std::array<float,2>{0.811143517f, 0.480402648f},
-std::array<float,2>{0.0470958129f, 0.258789003f},
-std::array<float,2>{0.893285871f, 0.675216436f},
-std::array<float,2>{0.3492302f, 0.757701278f},
-std::array<float,2>{0.62895298f, 0.207383722f},
-std::array<float,2>{0.00140046212f, 0.188104838f},
-std::array<float,2>{0.934180558f, 0.772890925f},
-std::array<float,2>{0.336793274f, 0.666481674f},
-std::array<float,2>{0.664893091f, 0.274723917f},
-std::array<float,2>{0.452538639f, 0.485775977f},
-std::array<float,2>{0.576688886f, 0.595389783f},
-std::array<float,2>{0.143804327f, 0.960827112f},
-std::array<float,2>{0.760973036f, 0.10999193f},
-std::array<float,2>{0.279565036f, 0.0513075702f},
-std::array<float,2>{0.720495701f, 0.914987624f},
-std::array<float,2>{0.0854662508f, 0.51730752f},
-std::array<float,2>{0.975830078f, 0.39416948f},
-std::array<float,2>{0.187575758f, 0.313652575f},
-std::array<float,2>{0.850554168f, 0.735347807f},
-std::array<float,2>{0.421542406f, 0.872924149f},
-std::array<float,2>{0.521713853f, 0.160101622f},
-std::array<float,2>{0.180615038f, 0.0892676041f},
-std::array<float,2>{0.796315312f, 0.97185725f},
-std::array<float,2>{0.497803956f, 0.568018794f},
-std::array<float,2>{0.619521916f, 0.46379596f},
-std::array<float,2>{0.361285061f, 0.293415964f},
-std::array<float,2>{0.649274707f, 0.626162589f},
-std::array<float,2>{0.0460853577f, 0.795339882f},
-std::array<float,2>{0.886398494f, 0.229250699f},
-std::array<float,2>{0.401059061f, 0.135695696f},
-std::array<float,2>{0.54844445f, 0.818907857f},
-std::array<float,2>{0.221818864f, 0.702905893f},
-std::array<float,2>{0.813301742f, 0.345126301f},
-std::array<float,2>{0.0996850207f, 0.415327907f},
-std::array<float,2>{0.952584505f, 0.561929882f},
-std::array<float,2>{0.299711734f, 0.887595415f},
-std::array<float,2>{0.711704075f, 0.024112111f},
-std::array<float,2>{0.0196870882f, 0.0573373735f},
-std::array<float,2>{0.917528331f, 0.910746455f},
-std::array<float,2>{0.31594196f, 0.526124001f},
-std::array<float,2>{0.674732685f, 0.400397569f},
-std::array<float,2>{0.456618816f, 0.324815512f},
-std::array<float,2>{0.58217752f, 0.742432177f},
-std::array<float,2>{0.134630814f, 0.865599096f},
-std::array<float,2>{0.766483963f, 0.1659078f},
-std::array<float,2>{0.260624528f, 0.195358768f},
-std::array<float,2>{0.736109316f, 0.780188978f},
-std::array<float,2>{0.0638522431f, 0.658825338f},
-std::array<float,2>{0.988355517f, 0.265957534f},
-std::array<float,2>{0.216518283f, 0.498286903f},
-std::array<float,2>{0.864073455f, 0.6043185f},
-std::array<float,2>{0.427788794f, 0.963510156f},
-std::array<float,2>{0.509806216f, 0.122606084f},
-std::array<float,2>{0.168060571f, 0.13092725f},
-std::array<float,2>{0.806866586f, 0.827854514f},
-std::array<float,2>{0.483378828f, 0.688905478f},
-std::array<float,2>{0.59432888f, 0.354734927f},
-std::array<float,2>{0.347218066f, 0.410731584f},
-std::array<float,2>{0.62781924f, 0.54711473f},
-std::array<float,2>{0.0537811741f, 0.882736564f},
-std::array<float,2>{0.895789504f, 0.0176940896f},
-std::array<float,2>{0.381165713f, 0.0857482776f},
-std::array<float,2>{0.54363066f, 0.980146527f},
-std::array<float,2>{0.240359589f, 0.573402822f},
-std::array<float,2>{0.839924455f, 0.46070835f},
-std::array<float,2>{0.117081746f, 0.281820655f},
-std::array<float,2>{0.954168737f, 0.633201599f},
-std::array<float,2>{0.289050013f, 0.78540349f},
-std::array<float,2>{0.689627707f, 0.225356877f},
-std::array<float,2>{0.0786729157f, 0.234648466f},
-std::array<float,2>{0.969285011f, 0.798309565f},
-std::array<float,2>{0.275008261f, 0.651277304f},
-std::array<float,2>{0.724765122f, 0.303967625f},
-std::array<float,2>{0.41549933f, 0.44959864f},
-std::array<float,2>{0.517634511f, 0.589951932f},
-std::array<float,2>{0.191685349f, 0.9981426f},
-std::array<float,2>{0.845645487f, 0.069947198f},
-std::array<float,2>{0.34122467f, 0.0011955176f},
-std::array<float,2>{0.668513298f, 0.896920264f},
-std::array<float,2>{0.00771656632f, 0.535341918f},
-std::array<float,2>{0.932083845f, 0.432703584f},
-std::array<float,2>{0.145477906f, 0.369033068f},
-std::array<float,2>{0.762541294f, 0.708141565f},
-std::array<float,2>{0.448080659f, 0.828545034f},
-std::array<float,2>{0.572876036f, 0.143406868f},
-std::array<float,2>{0.224207982f, 0.107151702f},
-std::array<float,2>{0.817159772f, 0.950292528f},
-std::array<float,2>{0.403568417f, 0.620130002f},
-std::array<float,2>{0.554681599f, 0.471823007f},
-std::array<float,2>{0.300788432f, 0.251792967f},
-std::array<float,2>{0.716228724f, 0.682237506f},
-std::array<float,2>{0.0942628235f, 0.76174283f},
-std::array<float,2>{0.948962629f, 0.215772271f},
-std::array<float,2>{0.492311031f, 0.18537797f},
-std::array<float,2>{0.623415351f, 0.849962413f},
-std::array<float,2>{0.18651706f, 0.734310269f},
-std::array<float,2>{0.792607427f, 0.340869129f},
-std::array<float,2>{0.0418979786f, 0.381531f},
-std::array<float,2>{0.887592494f, 0.508610725f},
-std::array<float,2>{0.36523518f, 0.926998496f},
-std::array<float,2>{0.654985666f, 0.0466203578f},
-std::array<float,2>{0.10324125f, 0.0708225295f},
-std::array<float,2>{0.944602072f, 0.985062838f},
-std::array<float,2>{0.312357783f, 0.580952585f},
-std::array<float,2>{0.710172474f, 0.443839341f},
-std::array<float,2>{0.395881921f, 0.309926093f},
-std::array<float,2>{0.555806577f, 0.646736026f},
-std::array<float,2>{0.232808024f, 0.811758816f},
-std::array<float,2>{0.826727808f, 0.248524144f},
-std::array<float,2>{0.368670672f, 0.1556741f},
-std::array<float,2>{0.647704601f, 0.838238835f},
-std::array<float,2>{0.0317105949f, 0.715055108f},
-std::array<float,2>{0.878522575f, 0.359717518f},
-std::array<float,2>{0.177153751f, 0.426627398f},
-std::array<float,2>{0.787052929f, 0.544184804f},
-std::array<float,2>{0.488791287f, 0.905190647f},
-std::array<float,2>{0.610666096f, 0.0149244964f},
-std::array<float,2>{0.19698076f, 0.206166074f},
-std::array<float,2>{0.85470587f, 0.751002312f},
-std::array<float,2>{0.410912037f, 0.676648259f},
-std::array<float,2>{0.529146254f, 0.26536876f},
-std::array<float,2>{0.27131319f, 0.483242542f},
-std::array<float,2>{0.730940759f, 0.613128066f},
-std::array<float,2>{0.0918434709f, 0.939868152f},
-std::array<float,2>{0.982128382f, 0.0976657122f},
-std::array<float,2>{0.443380505f, 0.0384222046f},
-std::array<float,2>{0.565740824f, 0.933563054f},
-std::array<float,2>{0.151159823f, 0.503406525f},
-std::array<float,2>{0.752097309f, 0.384333134f},
-std::array<float,2>{0.00827321224f, 0.330999732f},
-std::array<float,2>{0.923626542f, 0.722453415f},
-std::array<float,2>{0.335905761f, 0.85673207f},
-std::array<float,2>{0.656456769f, 0.172158137f},
-std::array<float,2>{0.057093624f, 0.161483958f},
-std::array<float,2>{0.902701735f, 0.868095517f},
-std::array<float,2>{0.355430961f, 0.740598202f},
-std::array<float,2>{0.640263498f, 0.320254266f},
-std::array<float,2>{0.471769571f, 0.396988183f},
-std::array<float,2>{0.601850092f, 0.522334695f},
-std::array<float,2>{0.159683391f, 0.91806066f},
-std::array<float,2>{0.801699102f, 0.0478937216f},
-std::array<float,2>{0.28927213f, 0.115113378f},
-std::array<float,2>{0.698728859f, 0.955790639f},
-std::array<float,2>{0.118519954f, 0.599004805f},
-std::array<float,2>{0.966612935f, 0.489317954f},
-std::array<float,2>{0.242818296f, 0.28113243f},
-std::array<float,2>{0.830189407f, 0.668097436f},
-std::array<float,2>{0.383728296f, 0.768638074f},
-std::array<float,2>{0.534656405f, 0.194293439f},
-std::array<float,2>{0.132767931f, 0.0307497978f},
-std::array<float,2>{0.776815474f, 0.8844226f},
-std::array<float,2>{0.46184653f, 0.555532873f},
-std::array<float,2>{0.590677381f, 0.418036938f},
-std::array<float,2>{0.324271679f, 0.349695891f},
-std::array<float,2>{0.685990214f, 0.696077764f},
-std::array<float,2>{0.0268030055f, 0.815021753f},
-std::array<float,2>{0.91027844f, 0.138556436f},
-std::array<float,2>{0.431778014f, 0.234189764f},
-std::array<float,2>{0.505000412f, 0.789425671f},
-std::array<float,2>{0.205654681f, 0.63187325f},
-std::array<float,2>{0.869817734f, 0.291128755f},
-std::array<float,2>{0.0726005509f, 0.468633413f},
-std::array<float,2>{0.993477166f, 0.564826608f},
-std::array<float,2>{0.256199002f, 0.973923147f},
-std::array<float,2>{0.746612787f, 0.092276603f},
-std::array<float,2>{0.011951779f, 0.0790747702f},
-std::array<float,2>{0.925825536f, 0.981864154f},
-std::array<float,2>{0.331332773f, 0.575677812f},
-std::array<float,2>{0.661653996f, 0.453686059f},
-std::array<float,2>{0.441199094f, 0.288259268f},
-std::array<float,2>{0.567828536f, 0.637347817f},
-std::array<float,2>{0.156242982f, 0.782258213f},
-std::array<float,2>{0.757524073f, 0.222186312f},
-std::array<float,2>{0.267131627f, 0.127217293f},
-std::array<float,2>{0.728025675f, 0.821347237f},
-std::array<float,2>{0.0862404034f, 0.692378759f},
-std::array<float,2>{0.977022767f, 0.35847342f},
-std::array<float,2>{0.199226707f, 0.408348948f},
-std::array<float,2>{0.858808458f, 0.554127574f},
-std::array<float,2>{0.408371478f, 0.877291501f},
-std::array<float,2>{0.527282536f, 0.021432694f},
-std::array<float,2>{0.173336551f, 0.201970458f},
-std::array<float,2>{0.78311646f, 0.775668383f},
-std::array<float,2>{0.487261593f, 0.660369992f},
-std::array<float,2>{0.616563261f, 0.272615433f},
-std::array<float,2>{0.371614337f, 0.494795531f},
-std::array<float,2>{0.641168654f, 0.609055638f},
-std::array<float,2>{0.0366827026f, 0.968378305f},
-std::array<float,2>{0.880309582f, 0.118905291f},
-std::array<float,2>{0.391446859f, 0.0622171834f},
-std::array<float,2>{0.56016165f, 0.909656644f},
-std::array<float,2>{0.228409678f, 0.527390182f},
-std::array<float,2>{0.822276115f, 0.402914315f},
-std::array<float,2>{0.108399406f, 0.321723729f},
-std::array<float,2>{0.938404441f, 0.748070359f},
-std::array<float,2>{0.306667984f, 0.861834884f},
-std::array<float,2>{0.705720544f, 0.169690743f},
-std::array<float,2>{0.0770038366f, 0.181818426f},
-std::array<float,2>{0.998959482f, 0.845948815f},
-std::array<float,2>{0.251166761f, 0.727172375f},
-std::array<float,2>{0.742750227f, 0.337611616f},
-std::array<float,2>{0.435675889f, 0.377780646f},
-std::array<float,2>{0.501560807f, 0.512605488f},
-std::array<float,2>{0.207119152f, 0.922626734f},
-std::array<float,2>{0.874704838f, 0.0398594029f},
-std::array<float,2>{0.320623457f, 0.103293233f},
-std::array<float,2>{0.681243002f, 0.948432922f},
-std::array<float,2>{0.027388433f, 0.624215245f},
-std::array<float,2>{0.909635723f, 0.476086199f},
-std::array<float,2>{0.12530911f, 0.254856288f},
-std::array<float,2>{0.777997196f, 0.686182022f},
-std::array<float,2>{0.467242837f, 0.759700596f},
-std::array<float,2>{0.587602317f, 0.211608678f},
-std::array<float,2>{0.246139303f, 0.0050551747f},
-std::array<float,2>{0.833920717f, 0.892152786f},
-std::array<float,2>{0.390444279f, 0.5319103f},
-std::array<float,2>{0.535981476f, 0.434590071f},
-std::array<float,2>{0.292977124f, 0.372487545f},
-std::array<float,2>{0.701998532f, 0.704376817f},
-std::array<float,2>{0.12241406f, 0.833356082f},
-std::array<float,2>{0.964024127f, 0.146435127f},
-std::array<float,2>{0.473517507f, 0.241912425f},
-std::array<float,2>{0.605854511f, 0.802860975f},
-std::array<float,2>{0.160408467f, 0.656056941f},
-std::array<float,2>{0.800166607f, 0.297017664f},
-std::array<float,2>{0.0616389066f, 0.446599483f},
-std::array<float,2>{0.900878489f, 0.58854568f},
-std::array<float,2>{0.358336896f, 0.992316127f},
-std::array<float,2>{0.636658609f, 0.0647184178f},
-std::array<float,2>{0.112951621f, 0.0320133679f},
-std::array<float,2>{0.958539963f, 0.934794605f},
-std::array<float,2>{0.284041077f, 0.507136762f},
-std::array<float,2>{0.693750858f, 0.388027787f},
-std::array<float,2>{0.375537127f, 0.332871288f},
-std::array<float,2>{0.539126396f, 0.724546671f},
-std::array<float,2>{0.237072051f, 0.851605296f},
-std::array<float,2>{0.836111188f, 0.176009282f},
-std::array<float,2>{0.350161612f, 0.210057184f},
-std::array<float,2>{0.631071568f, 0.754327118f},
-std::array<float,2>{0.0495760068f, 0.672652006f},
-std::array<float,2>{0.892076433f, 0.26136151f},
-std::array<float,2>{0.16548726f, 0.477944136f},
-std::array<float,2>{0.809330046f, 0.613559842f},
-std::array<float,2>{0.47830689f, 0.943209887f},
-std::array<float,2>{0.601116896f, 0.0951391682f},
-std::array<float,2>{0.212681785f, 0.149369344f},
-std::array<float,2>{0.861205816f, 0.843713284f},
-std::array<float,2>{0.424192846f, 0.711758435f},
-std::array<float,2>{0.512369454f, 0.364522219f},
-std::array<float,2>{0.265130252f, 0.425586104f},
-std::array<float,2>{0.741829038f, 0.541015983f},
-std::array<float,2>{0.0702834874f, 0.898785889f},
-std::array<float,2>{0.988063872f, 0.00850694813f},
-std::array<float,2>{0.459494054f, 0.0748106465f},
-std::array<float,2>{0.580243409f, 0.991235375f},
-std::array<float,2>{0.140173346f, 0.584513366f},
-std::array<float,2>{0.771891952f, 0.440212846f},
-std::array<float,2>{0.0176694989f, 0.305386573f},
-std::array<float,2>{0.918334067f, 0.642281711f},
-std::array<float,2>{0.319778234f, 0.807649016f},
-std::array<float,2>{0.676531196f, 0.24350369f},
-std::array<float,2>{0.0430682227f, 0.227029234f},
-std::array<float,2>{0.883078873f, 0.793599546f},
-std::array<float,2>{0.361345112f, 0.628622055f},
-std::array<float,2>{0.651310921f, 0.295587599f},
-std::array<float,2>{0.498990983f, 0.461354554f},
-std::array<float,2>{0.617322683f, 0.568432391f},
-std::array<float,2>{0.18174389f, 0.969672441f},
-std::array<float,2>{0.793397963f, 0.0866670683f},
-std::array<float,2>{0.298135221f, 0.0269557741f},
-std::array<float,2>{0.713619471f, 0.890169501f},
-std::array<float,2>{0.0985426977f, 0.558904648f},
-std::array<float,2>{0.950969338f, 0.416773051f},
-std::array<float,2>{0.220412135f, 0.347604841f},
-std::array<float,2>{0.815539479f, 0.69935596f},
-std::array<float,2>{0.398442745f, 0.817835331f},
-std::array<float,2>{0.550560176f, 0.134425044f},
-std::array<float,2>{0.141080126f, 0.112798877f},
-std::array<float,2>{0.75784719f, 0.957066834f},
-std::array<float,2>{0.449674964f, 0.595792651f},
-std::array<float,2>{0.575769842f, 0.487863004f},
-std::array<float,2>{0.339396566f, 0.275526166f},
-std::array<float,2>{0.667011559f, 0.664338291f},
-std::array<float,2>{0.003280784f, 0.771218061f},
-std::array<float,2>{0.936966419f, 0.189860642f},
-std::array<float,2>{0.419491321f, 0.156919405f},
-std::array<float,2>{0.520447373f, 0.874775112f},
-std::array<float,2>{0.189800054f, 0.736479282f},
-std::array<float,2>{0.848477721f, 0.31509009f},
-std::array<float,2>{0.0826749429f, 0.390994877f},
-std::array<float,2>{0.973429143f, 0.517839909f},
-std::array<float,2>{0.278812855f, 0.917246819f},
-std::array<float,2>{0.721084476f, 0.0538981967f},
-std::array<float,2>{0.051454287f, 0.0157338642f},
-std::array<float,2>{0.897972345f, 0.878974497f},
-std::array<float,2>{0.344159275f, 0.550182581f},
-std::array<float,2>{0.626141846f, 0.413522601f},
-std::array<float,2>{0.48200646f, 0.352112174f},
-std::array<float,2>{0.596446872f, 0.690638661f},
-std::array<float,2>{0.170355812f, 0.824522018f},
-std::array<float,2>{0.80598253f, 0.130394444f},
-std::array<float,2>{0.286454439f, 0.223643869f},
-std::array<float,2>{0.687504053f, 0.787829399f},
-std::array<float,2>{0.113869213f, 0.635138154f},
-std::array<float,2>{0.955982029f, 0.284352183f},
-std::array<float,2>{0.238379151f, 0.457805723f},
-std::array<float,2>{0.843286633f, 0.57150054f},
-std::array<float,2>{0.379535794f, 0.977189064f},
-std::array<float,2>{0.545749664f, 0.0832689181f},
-std::array<float,2>{0.135669678f, 0.166375488f},
-std::array<float,2>{0.76798141f, 0.864191055f},
-std::array<float,2>{0.453227997f, 0.744346678f},
-std::array<float,2>{0.5842278f, 0.327413201f},
-std::array<float,2>{0.312987596f, 0.399715662f},
-std::array<float,2>{0.673636973f, 0.524641931f},
-std::array<float,2>{0.0221887231f, 0.913910031f},
-std::array<float,2>{0.91567415f, 0.0552507937f},
-std::array<float,2>{0.426726878f, 0.123120412f},
-std::array<float,2>{0.508994341f, 0.962483108f},
-std::array<float,2>{0.217677891f, 0.601921916f},
-std::array<float,2>{0.867000759f, 0.497677594f},
-std::array<float,2>{0.0654029399f, 0.269361377f},
-std::array<float,2>{0.992004335f, 0.657965541f},
-std::array<float,2>{0.258652568f, 0.778621376f},
-std::array<float,2>{0.738212287f, 0.19844386f},
-std::array<float,2>{0.0969021842f, 0.217547923f},
-std::array<float,2>{0.946606815f, 0.765360653f},
-std::array<float,2>{0.303824008f, 0.679709792f},
-std::array<float,2>{0.718061209f, 0.253040344f},
-std::array<float,2>{0.404933333f, 0.469838113f},
-std::array<float,2>{0.55146414f, 0.618022263f},
-std::array<float,2>{0.226243094f, 0.952298343f},
-std::array<float,2>{0.819155157f, 0.108397231f},
-std::array<float,2>{0.364201993f, 0.0443131961f},
-std::array<float,2>{0.653010011f, 0.927928746f},
-std::array<float,2>{0.039104715f, 0.510443807f},
-std::array<float,2>{0.889633596f, 0.37905845f},
-std::array<float,2>{0.183891565f, 0.341913849f},
-std::array<float,2>{0.789451182f, 0.730946898f},
-std::array<float,2>{0.49595359f, 0.848485231f},
-std::array<float,2>{0.62261939f, 0.186861619f},
-std::array<float,2>{0.193528011f, 0.0665324479f},
-std::array<float,2>{0.845802486f, 0.996499181f},
-std::array<float,2>{0.416490912f, 0.592311144f},
-std::array<float,2>{0.517376661f, 0.452681601f},
-std::array<float,2>{0.2755135f, 0.302158743f},
-std::array<float,2>{0.723526597f, 0.649856329f},
-std::array<float,2>{0.0801573768f, 0.799520135f},
-std::array<float,2>{0.971492469f, 0.238008931f},
-std::array<float,2>{0.446295083f, 0.141588002f},
-std::array<float,2>{0.571288228f, 0.830166519f},
-std::array<float,2>{0.146910191f, 0.7093485f},
-std::array<float,2>{0.765060544f, 0.370638907f},
-std::array<float,2>{0.00503137894f, 0.430890352f},
-std::array<float,2>{0.930346131f, 0.538465381f},
-std::array<float,2>{0.343070567f, 0.895015478f},
-std::array<float,2>{0.670579135f, 0.00362109276f},
-std::array<float,2>{0.0909193084f, 0.101271421f},
-std::array<float,2>{0.983529091f, 0.937942266f},
-std::array<float,2>{0.273249775f, 0.610793889f},
-std::array<float,2>{0.734195769f, 0.480777591f},
-std::array<float,2>{0.413138807f, 0.2621288f},
-std::array<float,2>{0.53014195f, 0.679379284f},
-std::array<float,2>{0.199206039f, 0.752822638f},
-std::array<float,2>{0.852788985f, 0.204723448f},
-std::array<float,2>{0.332499266f, 0.174684078f},
-std::array<float,2>{0.659990013f, 0.858320415f},
-std::array<float,2>{0.00981029775f, 0.71980226f},
-std::array<float,2>{0.924304008f, 0.3281793f},
-std::array<float,2>{0.150259614f, 0.384982198f},
-std::array<float,2>{0.750282824f, 0.501335621f},
-std::array<float,2>{0.441621095f, 0.930974185f},
-std::array<float,2>{0.56376636f, 0.0355037637f},
-std::array<float,2>{0.230925143f, 0.247200027f},
-std::array<float,2>{0.825461745f, 0.808656275f},
-std::array<float,2>{0.398121178f, 0.646144152f},
-std::array<float,2>{0.557588696f, 0.310925454f},
-std::array<float,2>{0.309948325f, 0.441482067f},
-std::array<float,2>{0.708478868f, 0.579884291f},
-std::array<float,2>{0.104520939f, 0.986440301f},
-std::array<float,2>{0.942412674f, 0.0742134079f},
-std::array<float,2>{0.491081715f, 0.0130279846f},
-std::array<float,2>{0.611649036f, 0.902462959f},
-std::array<float,2>{0.179042548f, 0.546439648f},
-std::array<float,2>{0.788475633f, 0.429073513f},
-std::array<float,2>{0.0335062034f, 0.36137265f},
-std::array<float,2>{0.87604022f, 0.717698455f},
-std::array<float,2>{0.369150162f, 0.837389529f},
-std::array<float,2>{0.645054519f, 0.152602553f},
-std::array<float,2>{0.0234738253f, 0.138704598f},
-std::array<float,2>{0.913166523f, 0.814227164f},
-std::array<float,2>{0.327748001f, 0.698623002f},
-std::array<float,2>{0.684758365f, 0.349001706f},
-std::array<float,2>{0.464740098f, 0.421381563f},
-std::array<float,2>{0.593211114f, 0.556692898f},
-std::array<float,2>{0.130210623f, 0.886032999f},
-std::array<float,2>{0.774203956f, 0.0280276425f},
-std::array<float,2>{0.255270898f, 0.0909622759f},
-std::array<float,2>{0.749184906f, 0.975578547f},
-std::array<float,2>{0.0712009594f, 0.562814653f},
-std::array<float,2>{0.995239496f, 0.466588199f},
-std::array<float,2>{0.204378992f, 0.28922987f},
-std::array<float,2>{0.867895365f, 0.628984571f},
-std::array<float,2>{0.430466503f, 0.791204095f},
-std::array<float,2>{0.507536054f, 0.231232509f},
-std::array<float,2>{0.156584844f, 0.0503638685f},
-std::array<float,2>{0.803765416f, 0.919940174f},
-std::array<float,2>{0.469317406f, 0.52039659f},
-std::array<float,2>{0.603969276f, 0.395830005f},
-std::array<float,2>{0.351859093f, 0.318183184f},
-std::array<float,2>{0.637865841f, 0.739241779f},
-std::array<float,2>{0.0561948083f, 0.870932043f},
-std::array<float,2>{0.905045569f, 0.163208172f},
-std::array<float,2>{0.385331184f, 0.192886636f},
-std::array<float,2>{0.532437742f, 0.767395079f},
-std::array<float,2>{0.244723573f, 0.670995116f},
-std::array<float,2>{0.82951659f, 0.279233247f},
-std::array<float,2>{0.119275145f, 0.490858465f},
-std::array<float,2>{0.967899263f, 0.600956738f},
-std::array<float,2>{0.291366667f, 0.95366025f},
-std::array<float,2>{0.696008861f, 0.115535147f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.249583334f, 0.76927191f},
-std::array<float,2>{0.767518997f, 0.209746018f},
-std::array<float,2>{0.51025331f, 0.55343312f},
-std::array<float,2>{0.463145375f, 0.311838627f},
-std::array<float,2>{0.315399349f, 0.675059378f},
-std::array<float,2>{0.670800209f, 0.427103281f},
-std::array<float,2>{0.963509083f, 0.905025542f},
-std::array<float,2>{0.0876195282f, 0.0401425995f},
-std::array<float,2>{0.00393814314f, 0.603203297f},
-std::array<float,2>{0.902167201f, 0.372223347f},
-std::array<float,2>{0.716602027f, 0.838833034f},
-std::array<float,2>{0.312323093f, 0.140667915f},
-std::array<float,2>{0.394775987f, 0.98846817f},
-std::array<float,2>{0.623449802f, 0.106203631f},
-std::array<float,2>{0.831748247f, 0.699264884f},
-std::array<float,2>{0.129484534f, 0.467822403f},
-std::array<float,2>{0.121697798f, 0.931127369f},
-std::array<float,2>{0.993113101f, 0.0120895877f},
-std::array<float,2>{0.652831197f, 0.656199098f},
-std::array<float,2>{0.368437022f, 0.381149977f},
-std::array<float,2>{0.480098248f, 0.502885342f},
-std::array<float,2>{0.538604319f, 0.271560192f},
-std::array<float,2>{0.783814192f, 0.790895283f},
-std::array<float,2>{0.197616026f, 0.221378237f},
-std::array<float,2>{0.165150478f, 0.721411467f},
-std::array<float,2>{0.87041676f, 0.494445473f},
-std::array<float,2>{0.570076287f, 0.952935219f},
-std::array<float,2>{0.419072628f, 0.0723239705f},
-std::array<float,2>{0.26207006f, 0.854937077f},
-std::array<float,2>{0.734002888f, 0.173651189f},
-std::array<float,2>{0.919729114f, 0.566856146f},
-std::array<float,2>{0.0371990465f, 0.325705051f},
-std::array<float,2>{0.0522107929f, 0.822713494f},
-std::array<float,2>{0.936211765f, 0.127824843f},
-std::array<float,2>{0.742707908f, 0.619040012f},
-std::array<float,2>{0.277577668f, 0.357944369f},
-std::array<float,2>{0.427744478f, 0.715273201f},
-std::array<float,2>{0.583236575f, 0.451335251f},
-std::array<float,2>{0.859288096f, 0.980164409f},
-std::array<float,2>{0.185539395f, 0.121581882f},
-std::array<float,2>{0.209510595f, 0.54169625f},
-std::array<float,2>{0.812308967f, 0.295345485f},
-std::array<float,2>{0.562307894f, 0.751446784f},
-std::array<float,2>{0.496255666f, 0.202971309f},
-std::array<float,2>{0.35471186f, 0.87763983f},
-std::array<float,2>{0.627603471f, 0.0547833368f},
-std::array<float,2>{0.975907743f, 0.668521643f},
-std::array<float,2>{0.108434379f, 0.415642858f},
-std::array<float,2>{0.143550396f, 0.96219939f},
-std::array<float,2>{0.816732407f, 0.0845716447f},
-std::array<float,2>{0.597959876f, 0.749049544f},
-std::array<float,2>{0.379217029f, 0.481861502f},
-std::array<float,2>{0.292194903f, 0.579795837f},
-std::array<float,2>{0.694796383f, 0.338819116f},
-std::array<float,2>{0.885771871f, 0.873519659f},
-std::array<float,2>{0.0170506127f, 0.165433973f},
-std::array<float,2>{0.0737558901f, 0.636905015f},
-std::array<float,2>{0.947472572f, 0.400240213f},
-std::array<float,2>{0.675805569f, 0.920982599f},
-std::array<float,2>{0.335501879f, 0.0159193892f},
-std::array<float,2>{0.441868782f, 0.80262661f},
-std::array<float,2>{0.531150937f, 0.237190485f},
-std::array<float,2>{0.762822807f, 0.519987583f},
-std::array<float,2>{0.220724523f, 0.256581306f},
-std::array<float,2>{0.175699234f, 0.862286925f},
-std::array<float,2>{0.851469576f, 0.161712214f},
-std::array<float,2>{0.586037457f, 0.585982025f},
-std::array<float,2>{0.436498016f, 0.332458436f},
-std::array<float,2>{0.271230787f, 0.737126708f},
-std::array<float,2>{0.73698169f, 0.471832484f},
-std::array<float,2>{0.922917068f, 0.953314662f},
-std::array<float,2>{0.056836199f, 0.0867117047f},
-std::array<float,2>{0.0979038551f, 0.5260306f},
-std::array<float,2>{0.977095127f, 0.263204187f},
-std::array<float,2>{0.633256137f, 0.806556165f},
-std::array<float,2>{0.344035774f, 0.246772498f},
-std::array<float,2>{0.491213411f, 0.908495426f},
-std::array<float,2>{0.547416031f, 0.0307244789f},
-std::array<float,2>{0.797821701f, 0.627210319f},
-std::array<float,2>{0.21264039f, 0.391049922f},
-std::array<float,2>{0.0273035485f, 0.97560966f},
-std::array<float,2>{0.875605106f, 0.11392045f},
-std::array<float,2>{0.696105957f, 0.708741426f},
-std::array<float,2>{0.28199923f, 0.445191681f},
-std::array<float,2>{0.39022997f, 0.614887238f},
-std::array<float,2>{0.604211271f, 0.346924692f},
-std::array<float,2>{0.820902705f, 0.816170454f},
-std::array<float,2>{0.149867237f, 0.133001357f},
-std::array<float,2>{0.232804283f, 0.66176945f},
-std::array<float,2>{0.757172346f, 0.411184102f},
-std::array<float,2>{0.52211982f, 0.883305728f},
-std::array<float,2>{0.450331509f, 0.0493597798f},
-std::array<float,2>{0.34362337f, 0.75968951f},
-std::array<float,2>{0.683949649f, 0.190145686f},
-std::array<float,2>{0.940153956f, 0.533830643f},
-std::array<float,2>{0.0654240996f, 0.285497516f},
-std::array<float,2>{0.0799127296f, 0.785666227f},
-std::array<float,2>{0.957238615f, 0.232068017f},
-std::array<float,2>{0.657254577f, 0.507889748f},
-std::array<float,2>{0.321360588f, 0.277646065f},
-std::array<float,2>{0.456867129f, 0.642156303f},
-std::array<float,2>{0.502355218f, 0.389611751f},
-std::array<float,2>{0.7788167f, 0.924105287f},
-std::array<float,2>{0.241670549f, 0.00170425512f},
-std::array<float,2>{0.14000769f, 0.576820314f},
-std::array<float,2>{0.840671062f, 0.318123102f},
-std::array<float,2>{0.610261679f, 0.846827984f},
-std::array<float,2>{0.402348399f, 0.179703385f},
-std::array<float,2>{0.297775269f, 0.942661524f},
-std::array<float,2>{0.705037951f, 0.0644858256f},
-std::array<float,2>{0.897504747f, 0.731464207f},
-std::array<float,2>{0.0122417025f, 0.489106447f},
-std::array<float,2>{0.192310542f, 0.89600718f},
-std::array<float,2>{0.790646493f, 0.03438925f},
-std::array<float,2>{0.539661169f, 0.68565917f},
-std::array<float,2>{0.475279838f, 0.430743605f},
-std::array<float,2>{0.362374544f, 0.559652925f},
-std::array<float,2>{0.646418929f, 0.301402092f},
-std::array<float,2>{0.985762477f, 0.776840508f},
-std::array<float,2>{0.115477234f, 0.218005151f},
-std::array<float,2>{0.0419671796f, 0.69473958f},
-std::array<float,2>{0.913057089f, 0.459574163f},
-std::array<float,2>{0.722099662f, 0.99430126f},
-std::array<float,2>{0.250635207f, 0.0981297716f},
-std::array<float,2>{0.410815299f, 0.83036834f},
-std::array<float,2>{0.575223267f, 0.149836212f},
-std::array<float,2>{0.862398803f, 0.600990832f},
-std::array<float,2>{0.161622062f, 0.361676365f},
-std::array<float,2>{0.126110688f, 0.810037673f},
-std::array<float,2>{0.834240556f, 0.243085414f},
-std::array<float,2>{0.620044649f, 0.528828621f},
-std::array<float,2>{0.392137408f, 0.260854959f},
-std::array<float,2>{0.306662172f, 0.631382227f},
-std::array<float,2>{0.712711334f, 0.395085841f},
-std::array<float,2>{0.90504545f, 0.910576284f},
-std::array<float,2>{0.000848306983f, 0.0241301134f},
-std::array<float,2>{0.0905351266f, 0.592344046f},
-std::array<float,2>{0.965200305f, 0.331611156f},
-std::array<float,2>{0.664575636f, 0.866611481f},
-std::array<float,2>{0.316870868f, 0.157127813f},
-std::array<float,2>{0.467333168f, 0.960556269f},
-std::array<float,2>{0.513335347f, 0.0920391604f},
-std::array<float,2>{0.77339375f, 0.739744008f},
-std::array<float,2>{0.244677618f, 0.475291878f},
-std::array<float,2>{0.0337361544f, 0.888214588f},
-std::array<float,2>{0.914643764f, 0.0540489778f},
-std::array<float,2>{0.729020357f, 0.657011271f},
-std::array<float,2>{0.259186f, 0.408571333f},
-std::array<float,2>{0.415180713f, 0.535429835f},
-std::array<float,2>{0.565442562f, 0.282408535f},
-std::array<float,2>{0.872057021f, 0.764977753f},
-std::array<float,2>{0.168288231f, 0.195187047f},
-std::array<float,2>{0.202163249f, 0.704606712f},
-std::array<float,2>{0.788097084f, 0.440423489f},
-std::array<float,2>{0.531857193f, 0.971636593f},
-std::array<float,2>{0.481524199f, 0.111909509f},
-std::array<float,2>{0.374703586f, 0.817834616f},
-std::array<float,2>{0.651433945f, 0.139551982f},
-std::array<float,2>{0.999039888f, 0.61160332f},
-std::array<float,2>{0.1207093f, 0.347871542f},
-std::array<float,2>{0.104740016f, 0.848035514f},
-std::array<float,2>{0.969760418f, 0.185634345f},
-std::array<float,2>{0.63222152f, 0.572579622f},
-std::array<float,2>{0.357630253f, 0.31519261f},
-std::array<float,2>{0.495426089f, 0.730090082f},
-std::array<float,2>{0.556600928f, 0.48562023f},
-std::array<float,2>{0.805471897f, 0.939408779f},
-std::array<float,2>{0.203136504f, 0.0697505176f},
-std::array<float,2>{0.181423143f, 0.512005568f},
-std::array<float,2>{0.855406523f, 0.275112301f},
-std::array<float,2>{0.578591168f, 0.781613231f},
-std::array<float,2>{0.42451036f, 0.22976999f},
-std::array<float,2>{0.275843561f, 0.928737879f},
-std::array<float,2>{0.746581614f, 0.00642354181f},
-std::array<float,2>{0.933407009f, 0.645974636f},
-std::array<float,2>{0.0485443696f, 0.384932071f},
-std::array<float,2>{0.224335536f, 0.998779833f},
-std::array<float,2>{0.761321127f, 0.0943390429f},
-std::array<float,2>{0.527027249f, 0.690295577f},
-std::array<float,2>{0.440461397f, 0.455230206f},
-std::array<float,2>{0.329477221f, 0.595194519f},
-std::array<float,2>{0.675178707f, 0.365659952f},
-std::array<float,2>{0.951777935f, 0.833389759f},
-std::array<float,2>{0.0760621801f, 0.154760152f},
-std::array<float,2>{0.0233053584f, 0.680985868f},
-std::array<float,2>{0.886847377f, 0.435382694f},
-std::array<float,2>{0.689572632f, 0.894523203f},
-std::array<float,2>{0.294788897f, 0.0364189819f},
-std::array<float,2>{0.375866473f, 0.778026879f},
-std::array<float,2>{0.594804883f, 0.212780952f},
-std::array<float,2>{0.814384401f, 0.557308435f},
-std::array<float,2>{0.146865666f, 0.297229111f},
-std::array<float,2>{0.216641292f, 0.843041778f},
-std::array<float,2>{0.803052008f, 0.144710526f},
-std::array<float,2>{0.553985834f, 0.607053041f},
-std::array<float,2>{0.487324119f, 0.369256109f},
-std::array<float,2>{0.34921065f, 0.698526084f},
-std::array<float,2>{0.637851298f, 0.463816434f},
-std::array<float,2>{0.981398702f, 0.985785246f},
-std::array<float,2>{0.0954853371f, 0.105154753f},
-std::array<float,2>{0.0607097149f, 0.550544858f},
-std::array<float,2>{0.927435815f, 0.307293504f},
-std::array<float,2>{0.738764405f, 0.771080375f},
-std::array<float,2>{0.26930064f, 0.204269901f},
-std::array<float,2>{0.431052148f, 0.899375916f},
-std::array<float,2>{0.590555072f, 0.0466173626f},
-std::array<float,2>{0.846709728f, 0.676748157f},
-std::array<float,2>{0.179227456f, 0.423827231f},
-std::array<float,2>{0.0672238469f, 0.948203981f},
-std::array<float,2>{0.944190323f, 0.0773227364f},
-std::array<float,2>{0.680825353f, 0.72481221f},
-std::array<float,2>{0.339503706f, 0.497612268f},
-std::array<float,2>{0.446015894f, 0.56471318f},
-std::array<float,2>{0.515836f, 0.320902914f},
-std::array<float,2>{0.751949131f, 0.857901573f},
-std::array<float,2>{0.226763949f, 0.176667899f},
-std::array<float,2>{0.154158413f, 0.650191665f},
-std::array<float,2>{0.826909244f, 0.37630707f},
-std::array<float,2>{0.608277261f, 0.93581897f},
-std::array<float,2>{0.383111954f, 0.00895210169f},
-std::array<float,2>{0.287939906f, 0.794730961f},
-std::array<float,2>{0.701634526f, 0.222695604f},
-std::array<float,2>{0.879361808f, 0.505592763f},
-std::array<float,2>{0.0292464122f, 0.266489804f},
-std::array<float,2>{0.00844944455f, 0.755416214f},
-std::array<float,2>{0.890888631f, 0.198894039f},
-std::array<float,2>{0.708544374f, 0.546739697f},
-std::array<float,2>{0.301652402f, 0.2890791f},
-std::array<float,2>{0.40156588f, 0.667525887f},
-std::array<float,2>{0.613662601f, 0.419861257f},
-std::array<float,2>{0.839309514f, 0.879327476f},
-std::array<float,2>{0.13352716f, 0.0589436479f},
-std::array<float,2>{0.237440169f, 0.622787595f},
-std::array<float,2>{0.774790585f, 0.352141798f},
-std::array<float,2>{0.505825937f, 0.827094853f},
-std::array<float,2>{0.460908949f, 0.13220638f},
-std::array<float,2>{0.325757623f, 0.98295027f},
-std::array<float,2>{0.662612498f, 0.119508639f},
-std::array<float,2>{0.956901848f, 0.711251497f},
-std::array<float,2>{0.0848065466f, 0.446926236f},
-std::array<float,2>{0.156558931f, 0.915235877f},
-std::array<float,2>{0.865802348f, 0.0225810315f},
-std::array<float,2>{0.571074367f, 0.635924816f},
-std::array<float,2>{0.408854842f, 0.404926419f},
-std::array<float,2>{0.257764101f, 0.518250525f},
-std::array<float,2>{0.723881006f, 0.250304908f},
-std::array<float,2>{0.906286597f, 0.800669789f},
-std::array<float,2>{0.0431473404f, 0.239282787f},
-std::array<float,2>{0.109876283f, 0.744255006f},
-std::array<float,2>{0.989589274f, 0.476984143f},
-std::array<float,2>{0.642855823f, 0.966370523f},
-std::array<float,2>{0.366079241f, 0.0805786476f},
-std::array<float,2>{0.471771479f, 0.870755613f},
-std::array<float,2>{0.544065356f, 0.170416027f},
-std::array<float,2>{0.793602169f, 0.584291458f},
-std::array<float,2>{0.189333096f, 0.34204784f},
-std::array<float,2>{0.197247684f, 0.791316509f},
-std::array<float,2>{0.781365573f, 0.219384894f},
-std::array<float,2>{0.536625564f, 0.500954568f},
-std::array<float,2>{0.47690782f, 0.270804942f},
-std::array<float,2>{0.369765311f, 0.654244125f},
-std::array<float,2>{0.65449661f, 0.380760044f},
-std::array<float,2>{0.994873166f, 0.932589293f},
-std::array<float,2>{0.124017417f, 0.0148042496f},
-std::array<float,2>{0.036829643f, 0.568646491f},
-std::array<float,2>{0.920330465f, 0.327915847f},
-std::array<float,2>{0.730855286f, 0.851743877f},
-std::array<float,2>{0.265270412f, 0.174205124f},
-std::array<float,2>{0.420190871f, 0.949560523f},
-std::array<float,2>{0.568141341f, 0.0708867684f},
-std::array<float,2>{0.868829966f, 0.719632447f},
-std::array<float,2>{0.166103229f, 0.493600667f},
-std::array<float,2>{0.0890413299f, 0.904183209f},
-std::array<float,2>{0.961860836f, 0.0410489552f},
-std::array<float,2>{0.668239892f, 0.672310531f},
-std::array<float,2>{0.313938439f, 0.428350717f},
-std::array<float,2>{0.461746067f, 0.551944435f},
-std::array<float,2>{0.508621812f, 0.309658557f},
-std::array<float,2>{0.769513667f, 0.766041994f},
-std::array<float,2>{0.247817442f, 0.208847955f},
-std::array<float,2>{0.1316569f, 0.702402592f},
-std::array<float,2>{0.828759074f, 0.466365993f},
-std::array<float,2>{0.622168243f, 0.991091967f},
-std::array<float,2>{0.396993518f, 0.108496681f},
-std::array<float,2>{0.309113026f, 0.836001813f},
-std::array<float,2>{0.718447149f, 0.14269127f},
-std::array<float,2>{0.899980724f, 0.604213834f},
-std::array<float,2>{0.00593703706f, 0.3737818f},
-std::array<float,2>{0.0180829987f, 0.871378362f},
-std::array<float,2>{0.88432169f, 0.167748004f},
-std::array<float,2>{0.691810131f, 0.581593692f},
-std::array<float,2>{0.289908409f, 0.33616364f},
-std::array<float,2>{0.382582575f, 0.74641484f},
-std::array<float,2>{0.600626409f, 0.483169198f},
-std::array<float,2>{0.818771362f, 0.964665473f},
-std::array<float,2>{0.141532585f, 0.0824141353f},
-std::array<float,2>{0.219908714f, 0.523372889f},
-std::array<float,2>{0.764340281f, 0.255288869f},
-std::array<float,2>{0.529293716f, 0.803676605f},
-std::array<float,2>{0.443597823f, 0.234405041f},
-std::array<float,2>{0.333871096f, 0.919868708f},
-std::array<float,2>{0.679180026f, 0.0176954716f},
-std::array<float,2>{0.945560455f, 0.639005065f},
-std::array<float,2>{0.0716382936f, 0.401469141f},
-std::array<float,2>{0.187308162f, 0.978448272f},
-std::array<float,2>{0.855554581f, 0.123932064f},
-std::array<float,2>{0.58578819f, 0.718174398f},
-std::array<float,2>{0.426244736f, 0.449905515f},
-std::array<float,2>{0.280070186f, 0.620382488f},
-std::array<float,2>{0.745903671f, 0.357105464f},
-std::array<float,2>{0.933855534f, 0.821704328f},
-std::array<float,2>{0.0528149903f, 0.126454085f},
-std::array<float,2>{0.106942236f, 0.670950294f},
-std::array<float,2>{0.97421819f, 0.416952491f},
-std::array<float,2>{0.626517653f, 0.875312984f},
-std::array<float,2>{0.352383047f, 0.0572278574f},
-std::array<float,2>{0.498655468f, 0.753276825f},
-std::array<float,2>{0.55933392f, 0.199268773f},
-std::array<float,2>{0.810263038f, 0.53925848f},
-std::array<float,2>{0.207604632f, 0.294113636f},
-std::array<float,2>{0.150512189f, 0.813196778f},
-std::array<float,2>{0.82263267f, 0.136696517f},
-std::array<float,2>{0.602303922f, 0.615804315f},
-std::array<float,2>{0.388484985f, 0.344957471f},
-std::array<float,2>{0.284803897f, 0.709915936f},
-std::array<float,2>{0.697590292f, 0.442870349f},
-std::array<float,2>{0.878286362f, 0.974539459f},
-std::array<float,2>{0.024528075f, 0.117113188f},
-std::array<float,2>{0.0626799911f, 0.531519532f},
-std::array<float,2>{0.9375844f, 0.288881302f},
-std::array<float,2>{0.685995638f, 0.760175824f},
-std::array<float,2>{0.341086298f, 0.188892573f},
-std::array<float,2>{0.452454716f, 0.885959685f},
-std::array<float,2>{0.521050096f, 0.0470235534f},
-std::array<float,2>{0.755221069f, 0.662566781f},
-std::array<float,2>{0.2317352f, 0.413296074f},
-std::array<float,2>{0.0551120564f, 0.955554724f},
-std::array<float,2>{0.925181568f, 0.0896672383f},
-std::array<float,2>{0.735737562f, 0.735525072f},
-std::array<float,2>{0.271828234f, 0.470028341f},
-std::array<float,2>{0.434158087f, 0.588412583f},
-std::array<float,2>{0.588363767f, 0.335613161f},
-std::array<float,2>{0.849085748f, 0.859420061f},
-std::array<float,2>{0.173572004f, 0.163216054f},
-std::array<float,2>{0.214786008f, 0.626220107f},
-std::array<float,2>{0.800024271f, 0.394157499f},
-std::array<float,2>{0.549688339f, 0.908142209f},
-std::array<float,2>{0.488918066f, 0.0275800489f},
-std::array<float,2>{0.346606612f, 0.806645989f},
-std::array<float,2>{0.635605693f, 0.248326138f},
-std::array<float,2>{0.979557991f, 0.524520755f},
-std::array<float,2>{0.100025065f, 0.264989138f},
-std::array<float,2>{0.114957772f, 0.774849176f},
-std::array<float,2>{0.986365616f, 0.216528997f},
-std::array<float,2>{0.647076309f, 0.562352002f},
-std::array<float,2>{0.361173749f, 0.304111153f},
-std::array<float,2>{0.473700672f, 0.68538332f},
-std::array<float,2>{0.541923821f, 0.431922793f},
-std::array<float,2>{0.792137027f, 0.897279978f},
-std::array<float,2>{0.193729147f, 0.0329314284f},
-std::array<float,2>{0.162856638f, 0.598863363f},
-std::array<float,2>{0.860818148f, 0.360972643f},
-std::array<float,2>{0.577274799f, 0.828918159f},
-std::array<float,2>{0.412321329f, 0.150510177f},
-std::array<float,2>{0.252065241f, 0.993832886f},
-std::array<float,2>{0.719508648f, 0.0997934714f},
-std::array<float,2>{0.911338985f, 0.691997707f},
-std::array<float,2>{0.0404029563f, 0.457145452f},
-std::array<float,2>{0.238903448f, 0.922802508f},
-std::array<float,2>{0.78028065f, 0.00334897125f},
-std::array<float,2>{0.500580132f, 0.643778026f},
-std::array<float,2>{0.453844845f, 0.387303352f},
-std::array<float,2>{0.322915345f, 0.509880781f},
-std::array<float,2>{0.659015f, 0.280475885f},
-std::array<float,2>{0.959684134f, 0.787902117f},
-std::array<float,2>{0.0817258731f, 0.233088225f},
-std::array<float,2>{0.0153186386f, 0.732719541f},
-std::array<float,2>{0.895709813f, 0.491877168f},
-std::array<float,2>{0.706544518f, 0.94339478f},
-std::array<float,2>{0.300563395f, 0.0641284361f},
-std::array<float,2>{0.406009108f, 0.844596386f},
-std::array<float,2>{0.613148153f, 0.183528885f},
-std::array<float,2>{0.843220949f, 0.576121986f},
-std::array<float,2>{0.137662679f, 0.318446666f},
-std::array<float,2>{0.170806378f, 0.762765169f},
-std::array<float,2>{0.874125004f, 0.191410735f},
-std::array<float,2>{0.562888265f, 0.538926244f},
-std::array<float,2>{0.416303247f, 0.284170091f},
-std::array<float,2>{0.26042515f, 0.658440471f},
-std::array<float,2>{0.727796376f, 0.407601118f},
-std::array<float,2>{0.917634785f, 0.889903426f},
-std::array<float,2>{0.0323013254f, 0.0507926978f},
-std::array<float,2>{0.117335938f, 0.609952748f},
-std::array<float,2>{0.996610641f, 0.351365685f},
-std::array<float,2>{0.649909496f, 0.820045948f},
-std::array<float,2>{0.371383846f, 0.138575867f},
-std::array<float,2>{0.483089f, 0.969511092f},
-std::array<float,2>{0.534947813f, 0.110708736f},
-std::array<float,2>{0.787055314f, 0.705833554f},
-std::array<float,2>{0.199500948f, 0.438992471f},
-std::array<float,2>{0.00202659215f, 0.912992537f},
-std::array<float,2>{0.903970242f, 0.0259811133f},
-std::array<float,2>{0.714775562f, 0.630137563f},
-std::array<float,2>{0.306236774f, 0.397895068f},
-std::array<float,2>{0.394169033f, 0.530805767f},
-std::array<float,2>{0.617564082f, 0.258371472f},
-std::array<float,2>{0.833682477f, 0.811505079f},
-std::array<float,2>{0.128286898f, 0.24416174f},
-std::array<float,2>{0.24377577f, 0.742074311f},
-std::array<float,2>{0.770116329f, 0.473257601f},
-std::array<float,2>{0.515525758f, 0.957460463f},
-std::array<float,2>{0.46657896f, 0.0904976055f},
-std::array<float,2>{0.319991201f, 0.864459693f},
-std::array<float,2>{0.66627574f, 0.159394428f},
-std::array<float,2>{0.967106223f, 0.590405941f},
-std::array<float,2>{0.0927905813f, 0.328578383f},
-std::array<float,2>{0.0767876431f, 0.834875524f},
-std::array<float,2>{0.950023055f, 0.15330416f},
-std::array<float,2>{0.673662424f, 0.59592545f},
-std::array<float,2>{0.330901623f, 0.364886999f},
-std::array<float,2>{0.438288122f, 0.689387441f},
-std::array<float,2>{0.523631632f, 0.454827666f},
-std::array<float,2>{0.759290755f, 0.997195601f},
-std::array<float,2>{0.225263834f, 0.0966568366f},
-std::array<float,2>{0.14503476f, 0.55555582f},
-std::array<float,2>{0.815824091f, 0.300310463f},
-std::array<float,2>{0.595714986f, 0.781223238f},
-std::array<float,2>{0.377116889f, 0.214477152f},
-std::array<float,2>{0.295967758f, 0.892175734f},
-std::array<float,2>{0.688418746f, 0.0374747477f},
-std::array<float,2>{0.889638066f, 0.683367729f},
-std::array<float,2>{0.0210844353f, 0.436540306f},
-std::array<float,2>{0.205970675f, 0.940235198f},
-std::array<float,2>{0.807933092f, 0.0667520911f},
-std::array<float,2>{0.558090806f, 0.727072537f},
-std::array<float,2>{0.492344588f, 0.486986578f},
-std::array<float,2>{0.356099427f, 0.571663022f},
-std::array<float,2>{0.630243599f, 0.312871307f},
-std::array<float,2>{0.972408235f, 0.851530135f},
-std::array<float,2>{0.10221909f, 0.184380278f},
-std::array<float,2>{0.0490431376f, 0.648030698f},
-std::array<float,2>{0.930276096f, 0.38440311f},
-std::array<float,2>{0.749656022f, 0.926145792f},
-std::array<float,2>{0.273567915f, 0.00443443982f},
-std::array<float,2>{0.422897875f, 0.78489536f},
-std::array<float,2>{0.581517875f, 0.22850576f},
-std::array<float,2>{0.852383733f, 0.514741004f},
-std::array<float,2>{0.183082968f, 0.277177185f},
-std::array<float,2>{0.230313227f, 0.856819689f},
-std::array<float,2>{0.753733158f, 0.178224862f},
-std::array<float,2>{0.519009173f, 0.562629819f},
-std::array<float,2>{0.448675126f, 0.323246986f},
-std::array<float,2>{0.336038798f, 0.722846925f},
-std::array<float,2>{0.682838917f, 0.499120057f},
-std::array<float,2>{0.942875922f, 0.947072029f},
-std::array<float,2>{0.0694971085f, 0.0742951035f},
-std::array<float,2>{0.0301724225f, 0.50677067f},
-std::array<float,2>{0.881508112f, 0.268967927f},
-std::array<float,2>{0.70076555f, 0.795173228f},
-std::array<float,2>{0.287077338f, 0.226326957f},
-std::array<float,2>{0.385946035f, 0.934527278f},
-std::array<float,2>{0.605796099f, 0.0107511524f},
-std::array<float,2>{0.824676991f, 0.650964618f},
-std::array<float,2>{0.154459432f, 0.377592355f},
-std::array<float,2>{0.0962554663f, 0.98684597f},
-std::array<float,2>{0.983749509f, 0.103071094f},
-std::array<float,2>{0.639304757f, 0.695330322f},
-std::array<float,2>{0.351488918f, 0.462132841f},
-std::array<float,2>{0.485403419f, 0.608825862f},
-std::array<float,2>{0.552171052f, 0.367290109f},
-std::array<float,2>{0.802175581f, 0.841779828f},
-std::array<float,2>{0.217452556f, 0.148036048f},
-std::array<float,2>{0.177660152f, 0.678846896f},
-std::array<float,2>{0.845387757f, 0.425119609f},
-std::array<float,2>{0.593151391f, 0.900725543f},
-std::array<float,2>{0.433403403f, 0.0436308086f},
-std::array<float,2>{0.266356438f, 0.77260077f},
-std::array<float,2>{0.740506828f, 0.206743807f},
-std::array<float,2>{0.929321527f, 0.548798025f},
-std::array<float,2>{0.0604496673f, 0.306335121f},
-std::array<float,2>{0.0461881012f, 0.798058271f},
-std::array<float,2>{0.908925831f, 0.240355626f},
-std::array<float,2>{0.72565192f, 0.516603529f},
-std::array<float,2>{0.254168749f, 0.253239989f},
-std::array<float,2>{0.408140272f, 0.633261442f},
-std::array<float,2>{0.573637545f, 0.402352482f},
-std::array<float,2>{0.864736617f, 0.917111814f},
-std::array<float,2>{0.159099832f, 0.019735191f},
-std::array<float,2>{0.19026646f, 0.582411408f},
-std::array<float,2>{0.796696365f, 0.340783864f},
-std::array<float,2>{0.546081245f, 0.868877113f},
-std::array<float,2>{0.469034553f, 0.168997332f},
-std::array<float,2>{0.363453388f, 0.967922449f},
-std::array<float,2>{0.641381681f, 0.0794148669f},
-std::array<float,2>{0.99113214f, 0.742540777f},
-std::array<float,2>{0.112278342f, 0.480216563f},
-std::array<float,2>{0.135788396f, 0.880929828f},
-std::array<float,2>{0.836275637f, 0.0607162639f},
-std::array<float,2>{0.616501868f, 0.665556192f},
-std::array<float,2>{0.400326669f, 0.420228481f},
-std::array<float,2>{0.304129303f, 0.544203818f},
-std::array<float,2>{0.709846139f, 0.291687638f},
-std::array<float,2>{0.894413769f, 0.756390452f},
-std::array<float,2>{0.0110494401f, 0.196292028f},
-std::array<float,2>{0.0835599452f, 0.713128328f},
-std::array<float,2>{0.954072177f, 0.44752261f},
-std::array<float,2>{0.660492122f, 0.98090744f},
-std::array<float,2>{0.327517867f, 0.117564522f},
-std::array<float,2>{0.45795235f, 0.825411499f},
-std::array<float,2>{0.506391525f, 0.128982574f},
-std::array<float,2>{0.77629745f, 0.623417199f},
-std::array<float,2>{0.235479698f, 0.353632033f},
-std::array<float,2>{0.208868086f, 0.750263155f},
-std::array<float,2>{0.809380114f, 0.202049032f},
-std::array<float,2>{0.560419798f, 0.542502463f},
-std::array<float,2>{0.499421656f, 0.296868205f},
-std::array<float,2>{0.352806926f, 0.669684529f},
-std::array<float,2>{0.62516278f, 0.414229393f},
-std::array<float,2>{0.973145485f, 0.878584266f},
-std::array<float,2>{0.106271587f, 0.0560853817f},
-std::array<float,2>{0.0544319153f, 0.617804289f},
-std::array<float,2>{0.935104191f, 0.358538002f},
-std::array<float,2>{0.744490981f, 0.823800921f},
-std::array<float,2>{0.280493706f, 0.128451779f},
-std::array<float,2>{0.426851124f, 0.979149461f},
-std::array<float,2>{0.584805965f, 0.122448005f},
-std::array<float,2>{0.856800795f, 0.716285169f},
-std::array<float,2>{0.185788661f, 0.452734053f},
-std::array<float,2>{0.0708132163f, 0.920789599f},
-std::array<float,2>{0.946306407f, 0.0175575931f},
-std::array<float,2>{0.677868426f, 0.637754202f},
-std::array<float,2>{0.332239926f, 0.398807526f},
-std::array<float,2>{0.445147067f, 0.520635188f},
-std::array<float,2>{0.527389109f, 0.256982237f},
-std::array<float,2>{0.764760017f, 0.801018536f},
-std::array<float,2>{0.219245225f, 0.237495154f},
-std::array<float,2>{0.142429888f, 0.74834466f},
-std::array<float,2>{0.819520473f, 0.48101446f},
-std::array<float,2>{0.600111902f, 0.961859882f},
-std::array<float,2>{0.381634921f, 0.0855618715f},
-std::array<float,2>{0.290158451f, 0.874774754f},
-std::array<float,2>{0.693313479f, 0.165026128f},
-std::array<float,2>{0.882835269f, 0.578297913f},
-std::array<float,2>{0.019414559f, 0.339837998f},
-std::array<float,2>{0.0072796708f, 0.839438379f},
-std::array<float,2>{0.898954749f, 0.142391458f},
-std::array<float,2>{0.717756569f, 0.602039456f},
-std::array<float,2>{0.310250878f, 0.371794432f},
-std::array<float,2>{0.398174256f, 0.700716197f},
-std::array<float,2>{0.621135175f, 0.467005908f},
-std::array<float,2>{0.82924509f, 0.98936522f},
-std::array<float,2>{0.132313192f, 0.107201904f},
-std::array<float,2>{0.246722728f, 0.553998828f},
-std::array<float,2>{0.768457353f, 0.31084162f},
-std::array<float,2>{0.509415746f, 0.768295884f},
-std::array<float,2>{0.462571144f, 0.210243583f},
-std::array<float,2>{0.31321463f, 0.906176507f},
-std::array<float,2>{0.669194579f, 0.0393943973f},
-std::array<float,2>{0.962269664f, 0.674139917f},
-std::array<float,2>{0.0885205269f, 0.425826877f},
-std::array<float,2>{0.167568475f, 0.951314628f},
-std::array<float,2>{0.867366254f, 0.0733858347f},
-std::array<float,2>{0.56681776f, 0.721733809f},
-std::array<float,2>{0.421182215f, 0.495757848f},
-std::array<float,2>{0.264545351f, 0.568355501f},
-std::array<float,2>{0.73240912f, 0.324938416f},
-std::array<float,2>{0.920973718f, 0.854171813f},
-std::array<float,2>{0.0360843018f, 0.172580883f},
-std::array<float,2>{0.124515124f, 0.654313385f},
-std::array<float,2>{0.995242715f, 0.382360786f},
-std::array<float,2>{0.65564543f, 0.929818332f},
-std::array<float,2>{0.371067762f, 0.0127593968f},
-std::array<float,2>{0.47838819f, 0.789116561f},
-std::array<float,2>{0.53606087f, 0.222493857f},
-std::array<float,2>{0.783063591f, 0.50323689f},
-std::array<float,2>{0.196040958f, 0.273401141f},
-std::array<float,2>{0.138512284f, 0.845937133f},
-std::array<float,2>{0.842501581f, 0.181589156f},
-std::array<float,2>{0.611935318f, 0.577859163f},
-std::array<float,2>{0.405044109f, 0.316672206f},
-std::array<float,2>{0.298834264f, 0.73109746f},
-std::array<float,2>{0.705807865f, 0.490206242f},
-std::array<float,2>{0.894978762f, 0.942315936f},
-std::array<float,2>{0.013958036f, 0.0658183545f},
-std::array<float,2>{0.0804858878f, 0.509306908f},
-std::array<float,2>{0.960404992f, 0.278397888f},
-std::array<float,2>{0.660014391f, 0.786187112f},
-std::array<float,2>{0.323738128f, 0.230517387f},
-std::array<float,2>{0.454931796f, 0.925207675f},
-std::array<float,2>{0.501156032f, 0.000960077043f},
-std::array<float,2>{0.779925048f, 0.641230464f},
-std::array<float,2>{0.239789516f, 0.389890313f},
-std::array<float,2>{0.0397702381f, 0.995875835f},
-std::array<float,2>{0.910550773f, 0.0989913419f},
-std::array<float,2>{0.720453382f, 0.693491876f},
-std::array<float,2>{0.252987921f, 0.460827351f},
-std::array<float,2>{0.413674295f, 0.599672318f},
-std::array<float,2>{0.576532304f, 0.363118917f},
-std::array<float,2>{0.85969758f, 0.831391811f},
-std::array<float,2>{0.163741171f, 0.148758575f},
-std::array<float,2>{0.194691211f, 0.686899126f},
-std::array<float,2>{0.791583598f, 0.430642307f},
-std::array<float,2>{0.542478919f, 0.894704163f},
-std::array<float,2>{0.472948104f, 0.0334826484f},
-std::array<float,2>{0.359501958f, 0.776349723f},
-std::array<float,2>{0.648414433f, 0.216808468f},
-std::array<float,2>{0.987541854f, 0.558879495f},
-std::array<float,2>{0.11351423f, 0.301869363f},
-std::array<float,2>{0.101538375f, 0.805484533f},
-std::array<float,2>{0.979282439f, 0.247144535f},
-std::array<float,2>{0.636137664f, 0.526522934f},
-std::array<float,2>{0.346861273f, 0.262089372f},
-std::array<float,2>{0.489651859f, 0.628592134f},
-std::array<float,2>{0.550557673f, 0.392301947f},
-std::array<float,2>{0.798922777f, 0.909595847f},
-std::array<float,2>{0.213862672f, 0.0294441581f},
-std::array<float,2>{0.172775745f, 0.58738178f},
-std::array<float,2>{0.848541915f, 0.333354354f},
-std::array<float,2>{0.589805007f, 0.862317979f},
-std::array<float,2>{0.435167074f, 0.160525501f},
-std::array<float,2>{0.273322225f, 0.954508364f},
-std::array<float,2>{0.734937012f, 0.0873451531f},
-std::array<float,2>{0.92425108f, 0.737743616f},
-std::array<float,2>{0.055850558f, 0.471132964f},
-std::array<float,2>{0.231227294f, 0.883984089f},
-std::array<float,2>{0.754128754f, 0.0502349362f},
-std::array<float,2>{0.519752502f, 0.660598993f},
-std::array<float,2>{0.45164004f, 0.410962343f},
-std::array<float,2>{0.340603113f, 0.534720302f},
-std::array<float,2>{0.686784029f, 0.28676644f},
-std::array<float,2>{0.939031363f, 0.758194029f},
-std::array<float,2>{0.0639108121f, 0.190959439f},
-std::array<float,2>{0.02424182f, 0.707415879f},
-std::array<float,2>{0.877835989f, 0.444015324f},
-std::array<float,2>{0.698404431f, 0.974965155f},
-std::array<float,2>{0.284159601f, 0.114709802f},
-std::array<float,2>{0.387068063f, 0.815203547f},
-std::array<float,2>{0.603261888f, 0.134591341f},
-std::array<float,2>{0.824169159f, 0.613312185f},
-std::array<float,2>{0.151649609f, 0.346153021f},
-std::array<float,2>{0.182484031f, 0.782616854f},
-std::array<float,2>{0.853205442f, 0.229404464f},
-std::array<float,2>{0.580571651f, 0.512759864f},
-std::array<float,2>{0.422693849f, 0.273787051f},
-std::array<float,2>{0.275327653f, 0.645054102f},
-std::array<float,2>{0.748465598f, 0.386708617f},
-std::array<float,2>{0.931073248f, 0.92804873f},
-std::array<float,2>{0.0504096374f, 0.00710730301f},
-std::array<float,2>{0.10342624f, 0.573990285f},
-std::array<float,2>{0.97145468f, 0.3159464f},
-std::array<float,2>{0.629677176f, 0.849582255f},
-std::array<float,2>{0.356785536f, 0.186669081f},
-std::array<float,2>{0.493416935f, 0.938420951f},
-std::array<float,2>{0.55726099f, 0.0685347319f},
-std::array<float,2>{0.807120621f, 0.728686869f},
-std::array<float,2>{0.20644106f, 0.485095501f},
-std::array<float,2>{0.0201445855f, 0.892651796f},
-std::array<float,2>{0.890011907f, 0.0356432423f},
-std::array<float,2>{0.689015925f, 0.680660069f},
-std::array<float,2>{0.295593917f, 0.434379756f},
-std::array<float,2>{0.378899723f, 0.558161318f},
-std::array<float,2>{0.597042322f, 0.298566163f},
-std::array<float,2>{0.814884961f, 0.779060364f},
-std::array<float,2>{0.146343097f, 0.211506322f},
-std::array<float,2>{0.225747481f, 0.690852225f},
-std::array<float,2>{0.758252263f, 0.456510097f},
-std::array<float,2>{0.524613976f, 0.999467611f},
-std::array<float,2>{0.438541949f, 0.0950643197f},
-std::array<float,2>{0.331353337f, 0.832877517f},
-std::array<float,2>{0.672623754f, 0.156068295f},
-std::array<float,2>{0.95068413f, 0.594191432f},
-std::array<float,2>{0.0776448697f, 0.366835862f},
-std::array<float,2>{0.0918726847f, 0.865824759f},
-std::array<float,2>{0.967957973f, 0.157868534f},
-std::array<float,2>{0.667676628f, 0.593395412f},
-std::array<float,2>{0.319059104f, 0.330324411f},
-std::array<float,2>{0.465707064f, 0.738646805f},
-std::array<float,2>{0.514527082f, 0.475817949f},
-std::array<float,2>{0.771186411f, 0.959344566f},
-std::array<float,2>{0.242257088f, 0.0927814841f},
-std::array<float,2>{0.127504006f, 0.527939141f},
-std::array<float,2>{0.832202911f, 0.260194898f},
-std::array<float,2>{0.618456542f, 0.809252501f},
-std::array<float,2>{0.393502682f, 0.243228003f},
-std::array<float,2>{0.304730058f, 0.91154021f},
-std::array<float,2>{0.713787615f, 0.0247725099f},
-std::array<float,2>{0.902749479f, 0.63187319f},
-std::array<float,2>{0.00332505722f, 0.395640403f},
-std::array<float,2>{0.200346917f, 0.972610295f},
-std::array<float,2>{0.785446763f, 0.11284139f},
-std::array<float,2>{0.533410609f, 0.703494668f},
-std::array<float,2>{0.484245121f, 0.44116497f},
-std::array<float,2>{0.372556508f, 0.613014221f},
-std::array<float,2>{0.648447037f, 0.34867543f},
-std::array<float,2>{0.997149944f, 0.817294955f},
-std::array<float,2>{0.118789725f, 0.140093178f},
-std::array<float,2>{0.0313146561f, 0.657776713f},
-std::array<float,2>{0.916725039f, 0.409635693f},
-std::array<float,2>{0.727132618f, 0.887473226f},
-std::array<float,2>{0.26149708f, 0.052845519f},
-std::array<float,2>{0.417441875f, 0.764090002f},
-std::array<float,2>{0.563716114f, 0.193575963f},
-std::array<float,2>{0.873144865f, 0.536490679f},
-std::array<float,2>{0.1713586f, 0.281425625f},
-std::array<float,2>{0.23468706f, 0.828015149f},
-std::array<float,2>{0.77701658f, 0.131744355f},
-std::array<float,2>{0.507212877f, 0.621738851f},
-std::array<float,2>{0.458569646f, 0.352698624f},
-std::array<float,2>{0.326182038f, 0.712561369f},
-std::array<float,2>{0.66209662f, 0.445742071f},
-std::array<float,2>{0.954718769f, 0.983863175f},
-std::array<float,2>{0.0824344382f, 0.120552704f},
-std::array<float,2>{0.00993672386f, 0.545494735f},
-std::array<float,2>{0.893451095f, 0.290564328f},
-std::array<float,2>{0.710860729f, 0.754740894f},
-std::array<float,2>{0.3035748f, 0.198166296f},
-std::array<float,2>{0.398585826f, 0.880464852f},
-std::array<float,2>{0.615276635f, 0.0596495531f},
-std::array<float,2>{0.837322176f, 0.666747808f},
-std::array<float,2>{0.135134056f, 0.417998344f},
-std::array<float,2>{0.113125764f, 0.965652049f},
-std::array<float,2>{0.991224349f, 0.0816905126f},
-std::array<float,2>{0.642117321f, 0.745139778f},
-std::array<float,2>{0.364484042f, 0.478035837f},
-std::array<float,2>{0.47001797f, 0.585586905f},
-std::array<float,2>{0.545764148f, 0.343746901f},
-std::array<float,2>{0.795144796f, 0.869755626f},
-std::array<float,2>{0.190691471f, 0.171059757f},
-std::array<float,2>{0.160116747f, 0.635002255f},
-std::array<float,2>{0.863586783f, 0.406095207f},
-std::array<float,2>{0.572965741f, 0.914210558f},
-std::array<float,2>{0.406814814f, 0.022389736f},
-std::array<float,2>{0.255743295f, 0.799419105f},
-std::array<float,2>{0.724610686f, 0.239181325f},
-std::array<float,2>{0.909682274f, 0.518964171f},
-std::array<float,2>{0.0454451032f, 0.251370966f},
-std::array<float,2>{0.0595383421f, 0.769655526f},
-std::array<float,2>{0.928518295f, 0.20387958f},
-std::array<float,2>{0.741659999f, 0.549126089f},
-std::array<float,2>{0.267087847f, 0.308136731f},
-std::array<float,2>{0.432062954f, 0.677679777f},
-std::array<float,2>{0.591838181f, 0.422293633f},
-std::array<float,2>{0.844209015f, 0.899667919f},
-std::array<float,2>{0.176341087f, 0.0450659394f},
-std::array<float,2>{0.218210638f, 0.605744183f},
-std::array<float,2>{0.801713228f, 0.370926648f},
-std::array<float,2>{0.551757693f, 0.842094362f},
-std::array<float,2>{0.484487742f, 0.146190181f},
-std::array<float,2>{0.35050413f, 0.985191226f},
-std::array<float,2>{0.639865339f, 0.104461521f},
-std::array<float,2>{0.98294425f, 0.697593391f},
-std::array<float,2>{0.0970791206f, 0.463900626f},
-std::array<float,2>{0.155986488f, 0.93747896f},
-std::array<float,2>{0.825909138f, 0.00783877354f},
-std::array<float,2>{0.607105017f, 0.648505211f},
-std::array<float,2>{0.384818375f, 0.375442922f},
-std::array<float,2>{0.285871089f, 0.503979266f},
-std::array<float,2>{0.699626625f, 0.267533094f},
-std::array<float,2>{0.882654071f, 0.79343617f},
-std::array<float,2>{0.0307935663f, 0.224476919f},
-std::array<float,2>{0.0691760257f, 0.725932717f},
-std::array<float,2>{0.942381442f, 0.49609983f},
-std::array<float,2>{0.682429016f, 0.948287606f},
-std::array<float,2>{0.337223977f, 0.0762800425f},
-std::array<float,2>{0.447281152f, 0.85888046f},
-std::array<float,2>{0.518369973f, 0.17703858f},
-std::array<float,2>{0.752571523f, 0.56599462f},
-std::array<float,2>{0.228762135f, 0.321659088f},
-std::array<float,2>{0.221802667f, 0.804192424f},
-std::array<float,2>{0.762328506f, 0.235607535f},
-std::array<float,2>{0.529732645f, 0.522395253f},
-std::array<float,2>{0.442826748f, 0.254877627f},
-std::array<float,2>{0.334711283f, 0.640259504f},
-std::array<float,2>{0.677456617f, 0.401287287f},
-std::array<float,2>{0.949128628f, 0.918944001f},
-std::array<float,2>{0.072586827f, 0.0193694513f},
-std::array<float,2>{0.0156261288f, 0.580347657f},
-std::array<float,2>{0.884835184f, 0.336938173f},
-std::array<float,2>{0.693797112f, 0.872157097f},
-std::array<float,2>{0.291398764f, 0.166912571f},
-std::array<float,2>{0.380349934f, 0.963311911f},
-std::array<float,2>{0.598718524f, 0.0835760906f},
-std::array<float,2>{0.817454517f, 0.747539401f},
-std::array<float,2>{0.144032717f, 0.484256774f},
-std::array<float,2>{0.108371869f, 0.876371622f},
-std::array<float,2>{0.975538492f, 0.0577271655f},
-std::array<float,2>{0.62886411f, 0.670571685f},
-std::array<float,2>{0.354351848f, 0.417289644f},
-std::array<float,2>{0.497337997f, 0.540055394f},
-std::array<float,2>{0.561263561f, 0.293678731f},
-std::array<float,2>{0.810957551f, 0.752453268f},
-std::array<float,2>{0.210338861f, 0.201118276f},
-std::array<float,2>{0.183847919f, 0.716971576f},
-std::array<float,2>{0.857752442f, 0.450963885f},
-std::array<float,2>{0.582094371f, 0.977235079f},
-std::array<float,2>{0.428804368f, 0.124949753f},
-std::array<float,2>{0.278464288f, 0.820741534f},
-std::array<float,2>{0.743424475f, 0.125969425f},
-std::array<float,2>{0.937451005f, 0.619265079f},
-std::array<float,2>{0.051133085f, 0.355621189f},
-std::array<float,2>{0.0386984833f, 0.852892518f},
-std::array<float,2>{0.918916523f, 0.175778106f},
-std::array<float,2>{0.732763767f, 0.570089161f},
-std::array<float,2>{0.263656288f, 0.326373041f},
-std::array<float,2>{0.418654144f, 0.720597923f},
-std::array<float,2>{0.568412423f, 0.492592543f},
-std::array<float,2>{0.869768441f, 0.950296164f},
-std::array<float,2>{0.164880455f, 0.0715814829f},
-std::array<float,2>{0.198875502f, 0.501467705f},
-std::array<float,2>{0.784558833f, 0.269919962f},
-std::array<float,2>{0.537894428f, 0.79235971f},
-std::array<float,2>{0.479163527f, 0.220488906f},
-std::array<float,2>{0.367932022f, 0.933353722f},
-std::array<float,2>{0.654096484f, 0.0136740878f},
-std::array<float,2>{0.994024217f, 0.652368724f},
-std::array<float,2>{0.122950085f, 0.379355013f},
-std::array<float,2>{0.129947364f, 0.991719842f},
-std::array<float,2>{0.830417454f, 0.108025767f},
-std::array<float,2>{0.624125481f, 0.702060521f},
-std::array<float,2>{0.395894438f, 0.465479732f},
-std::array<float,2>{0.310944557f, 0.604582727f},
-std::array<float,2>{0.71517247f, 0.374715835f},
-std::array<float,2>{0.901318908f, 0.837544978f},
-std::array<float,2>{0.00511831557f, 0.143595636f},
-std::array<float,2>{0.0867457092f, 0.67299968f},
-std::array<float,2>{0.964832604f, 0.429618597f},
-std::array<float,2>{0.671471357f, 0.902468026f},
-std::array<float,2>{0.3160128f, 0.0420658588f},
-std::array<float,2>{0.464717597f, 0.767371953f},
-std::array<float,2>{0.511047721f, 0.207346439f},
-std::array<float,2>{0.765716016f, 0.551401198f},
-std::array<float,2>{0.248521581f, 0.309075981f},
-std::array<float,2>{0.16067864f, 0.829398632f},
-std::array<float,2>{0.861885965f, 0.151845649f},
-std::array<float,2>{0.574950099f, 0.598537087f},
-std::array<float,2>{0.41181466f, 0.360080719f},
-std::array<float,2>{0.251231939f, 0.692945838f},
-std::array<float,2>{0.721392035f, 0.458570331f},
-std::array<float,2>{0.913232565f, 0.992759466f},
-std::array<float,2>{0.0422811694f, 0.101051077f},
-std::array<float,2>{0.117046706f, 0.560685635f},
-std::array<float,2>{0.984956443f, 0.303225994f},
-std::array<float,2>{0.64544487f, 0.773751616f},
-std::array<float,2>{0.361638159f, 0.214927047f},
-std::array<float,2>{0.476026773f, 0.898153603f},
-std::array<float,2>{0.540263414f, 0.0319100916f},
-std::array<float,2>{0.789984286f, 0.684367299f},
-std::array<float,2>{0.192560151f, 0.432738632f},
-std::array<float,2>{0.0134142926f, 0.944618523f},
-std::array<float,2>{0.897407234f, 0.062726222f},
-std::array<float,2>{0.703595519f, 0.734314322f},
-std::array<float,2>{0.29811123f, 0.490861088f},
-std::array<float,2>{0.403816193f, 0.574809551f},
-std::array<float,2>{0.610792756f, 0.319926769f},
-std::array<float,2>{0.841492057f, 0.845471621f},
-std::array<float,2>{0.139370441f, 0.181977227f},
-std::array<float,2>{0.241057351f, 0.642594695f},
-std::array<float,2>{0.777706802f, 0.388073534f},
-std::array<float,2>{0.503462195f, 0.923642933f},
-std::array<float,2>{0.455124617f, 0.00274508027f},
-std::array<float,2>{0.320878953f, 0.78852123f},
-std::array<float,2>{0.656553328f, 0.233908698f},
-std::array<float,2>{0.958420217f, 0.511716366f},
-std::array<float,2>{0.0787441209f, 0.27961868f},
-std::array<float,2>{0.0657292008f, 0.761022389f},
-std::array<float,2>{0.941040039f, 0.187750727f},
-std::array<float,2>{0.684788644f, 0.532698691f},
-std::array<float,2>{0.342662305f, 0.287883312f},
-std::array<float,2>{0.449489683f, 0.663625956f},
-std::array<float,2>{0.522714257f, 0.412594885f},
-std::array<float,2>{0.756499887f, 0.88536948f},
-std::array<float,2>{0.233403549f, 0.0486590602f},
-std::array<float,2>{0.148817256f, 0.616249263f},
-std::array<float,2>{0.821747839f, 0.3439762f},
-std::array<float,2>{0.604553699f, 0.81421876f},
-std::array<float,2>{0.389547825f, 0.134942427f},
-std::array<float,2>{0.28300494f, 0.973393083f},
-std::array<float,2>{0.69669044f, 0.115673423f},
-std::array<float,2>{0.876434147f, 0.710108459f},
-std::array<float,2>{0.0259857699f, 0.441658199f},
-std::array<float,2>{0.211864531f, 0.907061517f},
-std::array<float,2>{0.798499346f, 0.0292472988f},
-std::array<float,2>{0.547902346f, 0.625279129f},
-std::array<float,2>{0.490989f, 0.393401861f},
-std::array<float,2>{0.34516868f, 0.523748159f},
-std::array<float,2>{0.633872151f, 0.264333993f},
-std::array<float,2>{0.977767348f, 0.807753026f},
-std::array<float,2>{0.0988990292f, 0.249025419f},
-std::array<float,2>{0.0576961711f, 0.73465246f},
-std::array<float,2>{0.922665715f, 0.469193518f},
-std::array<float,2>{0.737883687f, 0.956511617f},
-std::array<float,2>{0.269931972f, 0.0888406932f},
-std::array<float,2>{0.436576486f, 0.861290097f},
-std::array<float,2>{0.587232769f, 0.162803665f},
-std::array<float,2>{0.849676073f, 0.589778185f},
-std::array<float,2>{0.174413249f, 0.333984405f},
-std::array<float,2>{0.147707656f, 0.779486775f},
-std::array<float,2>{0.813155055f, 0.21352604f},
-std::array<float,2>{0.594496846f, 0.555725753f},
-std::array<float,2>{0.376568913f, 0.299519032f},
-std::array<float,2>{0.293855429f, 0.681881547f},
-std::array<float,2>{0.690906048f, 0.43557471f},
-std::array<float,2>{0.888076365f, 0.891436458f},
-std::array<float,2>{0.0220564343f, 0.0385934487f},
-std::array<float,2>{0.0745019615f, 0.596726656f},
-std::array<float,2>{0.953006327f, 0.364036888f},
-std::array<float,2>{0.674682915f, 0.835024595f},
-std::array<float,2>{0.328641444f, 0.15409331f},
-std::array<float,2>{0.439658612f, 0.996405303f},
-std::array<float,2>{0.525854826f, 0.0968174189f},
-std::array<float,2>{0.760477066f, 0.688371837f},
-std::array<float,2>{0.223081708f, 0.453962624f},
-std::array<float,2>{0.0471034013f, 0.927613378f},
-std::array<float,2>{0.931965649f, 0.00510004675f},
-std::array<float,2>{0.7477175f, 0.647289813f},
-std::array<float,2>{0.276913285f, 0.383614898f},
-std::array<float,2>{0.425080985f, 0.513952494f},
-std::array<float,2>{0.579389989f, 0.27541399f},
-std::array<float,2>{0.853839636f, 0.78407377f},
-std::array<float,2>{0.180372685f, 0.226991117f},
-std::array<float,2>{0.204920679f, 0.728182197f},
-std::array<float,2>{0.806469083f, 0.488168418f},
-std::array<float,2>{0.554780185f, 0.941297472f},
-std::array<float,2>{0.494390786f, 0.0682252645f},
-std::array<float,2>{0.35844335f, 0.850159585f},
-std::array<float,2>{0.631039798f, 0.184920579f},
-std::array<float,2>{0.969573796f, 0.571229935f},
-std::array<float,2>{0.10422153f, 0.313853741f},
-std::array<float,2>{0.119537421f, 0.818793833f},
-std::array<float,2>{0.998739719f, 0.137112647f},
-std::array<float,2>{0.650901616f, 0.610694051f},
-std::array<float,2>{0.373890072f, 0.350262076f},
-std::array<float,2>{0.481058687f, 0.706823528f},
-std::array<float,2>{0.532432795f, 0.437559158f},
-std::array<float,2>{0.787112176f, 0.96988523f},
-std::array<float,2>{0.202012375f, 0.109718107f},
-std::array<float,2>{0.1692435f, 0.537797391f},
-std::array<float,2>{0.872190952f, 0.28442502f},
-std::array<float,2>{0.56522119f, 0.76251024f},
-std::array<float,2>{0.414995134f, 0.19323197f},
-std::array<float,2>{0.258208483f, 0.88877064f},
-std::array<float,2>{0.730020821f, 0.0521050505f},
-std::array<float,2>{0.915506244f, 0.659606636f},
-std::array<float,2>{0.0345191322f, 0.406762421f},
-std::array<float,2>{0.245604694f, 0.958691716f},
-std::array<float,2>{0.772033453f, 0.0910136774f},
-std::array<float,2>{0.512514472f, 0.741174757f},
-std::array<float,2>{0.468063146f, 0.47417438f},
-std::array<float,2>{0.318258673f, 0.591488183f},
-std::array<float,2>{0.665610552f, 0.329759896f},
-std::array<float,2>{0.966457009f, 0.863622189f},
-std::array<float,2>{0.0910079703f, 0.15908502f},
-std::array<float,2>{0.00183848117f, 0.629135072f},
-std::array<float,2>{0.905277371f, 0.396975636f},
-std::array<float,2>{0.711136281f, 0.913622975f},
-std::array<float,2>{0.30858624f, 0.0264611933f},
-std::array<float,2>{0.390881866f, 0.811827421f},
-std::array<float,2>{0.62040621f, 0.245837465f},
-std::array<float,2>{0.835246623f, 0.529337823f},
-std::array<float,2>{0.125239879f, 0.259521484f},
-std::array<float,2>{0.187565073f, 0.868068039f},
-std::array<float,2>{0.794616282f, 0.168259412f},
-std::array<float,2>{0.543287873f, 0.583194911f},
-std::array<float,2>{0.470939994f, 0.34096083f},
-std::array<float,2>{0.366802245f, 0.743428826f},
-std::array<float,2>{0.643840909f, 0.47920838f},
-std::array<float,2>{0.989017725f, 0.966886997f},
-std::array<float,2>{0.110759139f, 0.0788709f},
-std::array<float,2>{0.0441503152f, 0.516236961f},
-std::array<float,2>{0.907744467f, 0.2522313f},
-std::array<float,2>{0.723335803f, 0.796930254f},
-std::array<float,2>{0.255929083f, 0.241437554f},
-std::array<float,2>{0.409868211f, 0.916456401f},
-std::array<float,2>{0.571785152f, 0.0209578164f},
-std::array<float,2>{0.866915941f, 0.634192884f},
-std::array<float,2>{0.157593325f, 0.403824925f},
-std::array<float,2>{0.0849789605f, 0.981695354f},
-std::array<float,2>{0.955315888f, 0.118282728f},
-std::array<float,2>{0.663663447f, 0.714541912f},
-std::array<float,2>{0.324984998f, 0.448612541f},
-std::array<float,2>{0.459111899f, 0.62477988f},
-std::array<float,2>{0.504081368f, 0.354692131f},
-std::array<float,2>{0.773722172f, 0.825139642f},
-std::array<float,2>{0.236589983f, 0.130150437f},
-std::array<float,2>{0.13441208f, 0.664522707f},
-std::array<float,2>{0.838549554f, 0.42114827f},
-std::array<float,2>{0.614260435f, 0.881894112f},
-std::array<float,2>{0.400757551f, 0.0621174164f},
-std::array<float,2>{0.30187133f, 0.757811666f},
-std::array<float,2>{0.707642019f, 0.196222484f},
-std::array<float,2>{0.892373204f, 0.54311949f},
-std::array<float,2>{0.00908384658f, 0.292770892f},
-std::array<float,2>{0.0282148328f, 0.796481371f},
-std::array<float,2>{0.880733967f, 0.22555995f},
-std::array<float,2>{0.702457607f, 0.507027984f},
-std::array<float,2>{0.288255244f, 0.267695248f},
-std::array<float,2>{0.384206086f, 0.652047455f},
-std::array<float,2>{0.608999968f, 0.378495425f},
-std::array<float,2>{0.828000426f, 0.934909403f},
-std::array<float,2>{0.152662262f, 0.0105502f},
-std::array<float,2>{0.227722615f, 0.564239264f},
-std::array<float,2>{0.750614882f, 0.323097765f},
-std::array<float,2>{0.51660794f, 0.8558954f},
-std::array<float,2>{0.446360618f, 0.179622635f},
-std::array<float,2>{0.338444829f, 0.945555329f},
-std::array<float,2>{0.680574536f, 0.0753003433f},
-std::array<float,2>{0.944907963f, 0.724415302f},
-std::array<float,2>{0.0682659075f, 0.49816367f},
-std::array<float,2>{0.17865397f, 0.901377559f},
-std::array<float,2>{0.845819592f, 0.0441482216f},
-std::array<float,2>{0.591767013f, 0.678178728f},
-std::array<float,2>{0.430360645f, 0.42445454f},
-std::array<float,2>{0.267974436f, 0.546880305f},
-std::array<float,2>{0.739276171f, 0.30536297f},
-std::array<float,2>{0.926694691f, 0.772227705f},
-std::array<float,2>{0.061680425f, 0.205484048f},
-std::array<float,2>{0.0939344466f, 0.696799099f},
-std::array<float,2>{0.981895864f, 0.461533189f},
-std::array<float,2>{0.637012064f, 0.987715065f},
-std::array<float,2>{0.348475516f, 0.102254726f},
-std::array<float,2>{0.486330241f, 0.840226471f},
-std::array<float,2>{0.553267121f, 0.146495342f},
-std::array<float,2>{0.804335058f, 0.607422531f},
-std::array<float,2>{0.215747789f, 0.368661314f},
-std::array<float,2>{0.234247431f, 0.758396626f},
-std::array<float,2>{0.756189585f, 0.19085893f},
-std::array<float,2>{0.523100376f, 0.534593523f},
-std::array<float,2>{0.450107038f, 0.286414176f},
-std::array<float,2>{0.341936499f, 0.661111653f},
-std::array<float,2>{0.68549341f, 0.410455495f},
-std::array<float,2>{0.94058162f, 0.884354353f},
-std::array<float,2>{0.0659652725f, 0.0506189577f},
-std::array<float,2>{0.0254998244f, 0.613951504f},
-std::array<float,2>{0.876948655f, 0.346673846f},
-std::array<float,2>{0.696869969f, 0.814598858f},
-std::array<float,2>{0.282461613f, 0.134264573f},
-std::array<float,2>{0.388917267f, 0.975147128f},
-std::array<float,2>{0.605136693f, 0.115122437f},
-std::array<float,2>{0.822265387f, 0.707724988f},
-std::array<float,2>{0.149100319f, 0.443614185f},
-std::array<float,2>{0.0993560031f, 0.909943044f},
-std::array<float,2>{0.978176177f, 0.0298281256f},
-std::array<float,2>{0.634320438f, 0.628310502f},
-std::array<float,2>{0.34569791f, 0.391780943f},
-std::array<float,2>{0.49035877f, 0.52733922f},
-std::array<float,2>{0.548638403f, 0.262682319f},
-std::array<float,2>{0.797956169f, 0.805003166f},
-std::array<float,2>{0.211014986f, 0.247660324f},
-std::array<float,2>{0.173913181f, 0.73823154f},
-std::array<float,2>{0.850320876f, 0.471543133f},
-std::array<float,2>{0.587419808f, 0.954795182f},
-std::array<float,2>{0.437260836f, 0.087826699f},
-std::array<float,2>{0.270437747f, 0.86298722f},
-std::array<float,2>{0.737480462f, 0.160784304f},
-std::array<float,2>{0.921984136f, 0.587489545f},
-std::array<float,2>{0.0583481304f, 0.333973616f},
-std::array<float,2>{0.0428100377f, 0.831970751f},
-std::array<float,2>{0.913873374f, 0.14893876f},
-std::array<float,2>{0.72098285f, 0.600568533f},
-std::array<float,2>{0.2515212f, 0.362392962f},
-std::array<float,2>{0.411471635f, 0.694247782f},
-std::array<float,2>{0.574229538f, 0.460424989f},
-std::array<float,2>{0.861424446f, 0.9953022f},
-std::array<float,2>{0.160396412f, 0.0993616879f},
-std::array<float,2>{0.193254784f, 0.559185863f},
-std::array<float,2>{0.789160967f, 0.302423418f},
-std::array<float,2>{0.540883124f, 0.775820732f},
-std::array<float,2>{0.476257086f, 0.217710093f},
-std::array<float,2>{0.362044275f, 0.895233572f},
-std::array<float,2>{0.644857645f, 0.0340742022f},
-std::array<float,2>{0.984661758f, 0.687130928f},
-std::array<float,2>{0.116538294f, 0.429808527f},
-std::array<float,2>{0.13875562f, 0.941885352f},
-std::array<float,2>{0.840915024f, 0.0663222596f},
-std::array<float,2>{0.611216128f, 0.730785429f},
-std::array<float,2>{0.403527856f, 0.489575833f},
-std::array<float,2>{0.298527539f, 0.577192843f},
-std::array<float,2>{0.703683734f, 0.316994488f},
-std::array<float,2>{0.896680355f, 0.846363068f},
-std::array<float,2>{0.0129553955f, 0.181069538f},
-std::array<float,2>{0.0785062686f, 0.640865266f},
-std::array<float,2>{0.958675027f, 0.390351415f},
-std::array<float,2>{0.656971812f, 0.925542355f},
-std::array<float,2>{0.320733994f, 0.000130575281f},
-std::array<float,2>{0.455854326f, 0.786684453f},
-std::array<float,2>{0.503096581f, 0.2311064f},
-std::array<float,2>{0.778225839f, 0.509229004f},
-std::array<float,2>{0.240528166f, 0.279077619f},
-std::array<float,2>{0.164459616f, 0.853866637f},
-std::array<float,2>{0.869233608f, 0.172154844f},
-std::array<float,2>{0.569307864f, 0.567471683f},
-std::array<float,2>{0.418235123f, 0.324343115f},
-std::array<float,2>{0.263072252f, 0.722476125f},
-std::array<float,2>{0.732966781f, 0.495177358f},
-std::array<float,2>{0.918395221f, 0.951765239f},
-std::array<float,2>{0.0383436382f, 0.074162893f},
-std::array<float,2>{0.122553654f, 0.503610849f},
-std::array<float,2>{0.993591428f, 0.272594303f},
-std::array<float,2>{0.653742611f, 0.789801776f},
-std::array<float,2>{0.367382109f, 0.221717104f},
-std::array<float,2>{0.478655577f, 0.930530429f},
-std::array<float,2>{0.537549257f, 0.0134285726f},
-std::array<float,2>{0.784839928f, 0.654865324f},
-std::array<float,2>{0.198397726f, 0.382101417f},
-std::array<float,2>{0.00581996189f, 0.990181565f},
-std::array<float,2>{0.900481701f, 0.106662519f},
-std::array<float,2>{0.715333462f, 0.700310886f},
-std::array<float,2>{0.311324745f, 0.467695624f},
-std::array<float,2>{0.396167636f, 0.60247314f},
-std::array<float,2>{0.624794543f, 0.371427923f},
-std::array<float,2>{0.830618918f, 0.839164436f},
-std::array<float,2>{0.130609527f, 0.141858041f},
-std::array<float,2>{0.248743445f, 0.67450577f},
-std::array<float,2>{0.766454458f, 0.42663613f},
-std::array<float,2>{0.511342883f, 0.905694425f},
-std::array<float,2>{0.464033484f, 0.0398824476f},
-std::array<float,2>{0.315814704f, 0.767997921f},
-std::array<float,2>{0.671139419f, 0.210872814f},
-std::array<float,2>{0.964015841f, 0.55468744f},
-std::array<float,2>{0.086265035f, 0.311431646f},
-std::array<float,2>{0.0730297118f, 0.801270664f},
-std::array<float,2>{0.948429525f, 0.238229245f},
-std::array<float,2>{0.67697674f, 0.521006942f},
-std::array<float,2>{0.334305167f, 0.257659912f},
-std::array<float,2>{0.44325006f, 0.638641119f},
-std::array<float,2>{0.530256331f, 0.399277687f},
-std::array<float,2>{0.761787355f, 0.920014679f},
-std::array<float,2>{0.222429723f, 0.0168350805f},
-std::array<float,2>{0.14423871f, 0.578743517f},
-std::array<float,2>{0.817977965f, 0.339083374f},
-std::array<float,2>{0.599387586f, 0.874217391f},
-std::array<float,2>{0.380514979f, 0.164170176f},
-std::array<float,2>{0.291952163f, 0.961422741f},
-std::array<float,2>{0.69427669f, 0.0853954181f},
-std::array<float,2>{0.885436535f, 0.748716593f},
-std::array<float,2>{0.01636157f, 0.48086527f},
-std::array<float,2>{0.210791469f, 0.878136098f},
-std::array<float,2>{0.81106168f, 0.05622961f},
-std::array<float,2>{0.560780585f, 0.669122517f},
-std::array<float,2>{0.497768849f, 0.41468823f},
-std::array<float,2>{0.353767872f, 0.542410076f},
-std::array<float,2>{0.628307641f, 0.296262652f},
-std::array<float,2>{0.97476083f, 0.750554085f},
-std::array<float,2>{0.107505038f, 0.201565787f},
-std::array<float,2>{0.0515977591f, 0.716616929f},
-std::array<float,2>{0.936631382f, 0.45235005f},
-std::array<float,2>{0.744113088f, 0.978956461f},
-std::array<float,2>{0.279196501f, 0.122787312f},
-std::array<float,2>{0.429463118f, 0.823706865f},
-std::array<float,2>{0.582795918f, 0.128083691f},
-std::array<float,2>{0.858373463f, 0.617468715f},
-std::array<float,2>{0.184368685f, 0.359249264f},
-std::array<float,2>{0.152873531f, 0.793624759f},
-std::array<float,2>{0.827518046f, 0.22364606f},
-std::array<float,2>{0.608831942f, 0.504822373f},
-std::array<float,2>{0.38460359f, 0.266754657f},
-std::array<float,2>{0.288857132f, 0.649211645f},
-std::array<float,2>{0.702893138f, 0.375866264f},
-std::array<float,2>{0.880246162f, 0.936538398f},
-std::array<float,2>{0.0275676437f, 0.00847033598f},
-std::array<float,2>{0.0675813109f, 0.565468907f},
-std::array<float,2>{0.944406867f, 0.321788281f},
-std::array<float,2>{0.680086732f, 0.859010339f},
-std::array<float,2>{0.338090152f, 0.177674085f},
-std::array<float,2>{0.446827948f, 0.949165881f},
-std::array<float,2>{0.517428398f, 0.0771119073f},
-std::array<float,2>{0.750471473f, 0.726182282f},
-std::array<float,2>{0.228295803f, 0.496986181f},
-std::array<float,2>{0.0621969625f, 0.900348186f},
-std::array<float,2>{0.926057994f, 0.0454923362f},
-std::array<float,2>{0.739927948f, 0.676828563f},
-std::array<float,2>{0.268423796f, 0.422414809f},
-std::array<float,2>{0.429949611f, 0.549477398f},
-std::array<float,2>{0.591056705f, 0.307829052f},
-std::array<float,2>{0.846510828f, 0.770187736f},
-std::array<float,2>{0.177964717f, 0.203545406f},
-std::array<float,2>{0.215042114f, 0.698144495f},
-std::array<float,2>{0.80381757f, 0.464710563f},
-std::array<float,2>{0.552845359f, 0.984534562f},
-std::array<float,2>{0.486853719f, 0.10392414f},
-std::array<float,2>{0.348087609f, 0.842315912f},
-std::array<float,2>{0.637254596f, 0.145777613f},
-std::array<float,2>{0.982269287f, 0.606271446f},
-std::array<float,2>{0.0945857912f, 0.37050125f},
-std::array<float,2>{0.111109234f, 0.869345903f},
-std::array<float,2>{0.988715649f, 0.171558291f},
-std::array<float,2>{0.644471169f, 0.585177898f},
-std::array<float,2>{0.366272211f, 0.342778742f},
-std::array<float,2>{0.471567661f, 0.746019483f},
-std::array<float,2>{0.543543816f, 0.478015304f},
-std::array<float,2>{0.794290364f, 0.964853406f},
-std::array<float,2>{0.187996864f, 0.0811559632f},
-std::array<float,2>{0.158060655f, 0.519131362f},
-std::array<float,2>{0.86659044f, 0.251866728f},
-std::array<float,2>{0.571310282f, 0.799035013f},
-std::array<float,2>{0.409380823f, 0.238687277f},
-std::array<float,2>{0.256756097f, 0.915015101f},
-std::array<float,2>{0.722964048f, 0.0216450617f},
-std::array<float,2>{0.9076882f, 0.635719538f},
-std::array<float,2>{0.0445470102f, 0.405525744f},
-std::array<float,2>{0.237055987f, 0.984081149f},
-std::array<float,2>{0.774289608f, 0.121063739f},
-std::array<float,2>{0.504503012f, 0.712264001f},
-std::array<float,2>{0.459474623f, 0.446207076f},
-std::array<float,2>{0.32454893f, 0.621290326f},
-std::array<float,2>{0.66333884f, 0.353364646f},
-std::array<float,2>{0.955936968f, 0.827623725f},
-std::array<float,2>{0.0855818838f, 0.131216064f},
-std::array<float,2>{0.00932694878f, 0.666208208f},
-std::array<float,2>{0.891660154f, 0.41882506f},
-std::array<float,2>{0.707324922f, 0.879935801f},
-std::array<float,2>{0.302335292f, 0.0603888556f},
-std::array<float,2>{0.401297897f, 0.754195273f},
-std::array<float,2>{0.615020633f, 0.197693422f},
-std::array<float,2>{0.838092506f, 0.545116603f},
-std::array<float,2>{0.134071484f, 0.290410817f},
-std::array<float,2>{0.201280892f, 0.816878319f},
-std::array<float,2>{0.787898302f, 0.140420213f},
-std::array<float,2>{0.533063531f, 0.612443924f},
-std::array<float,2>{0.480821162f, 0.349409819f},
-std::array<float,2>{0.373381257f, 0.70368886f},
-std::array<float,2>{0.650836766f, 0.440651834f},
-std::array<float,2>{0.998294652f, 0.971865773f},
-std::array<float,2>{0.119986929f, 0.112693742f},
-std::array<float,2>{0.0347660929f, 0.53683567f},
-std::array<float,2>{0.915642679f, 0.282139987f},
-std::array<float,2>{0.729541719f, 0.764565647f},
-std::array<float,2>{0.258501083f, 0.194255933f},
-std::array<float,2>{0.414236099f, 0.886945248f},
-std::array<float,2>{0.564516842f, 0.0532801524f},
-std::array<float,2>{0.873008728f, 0.657305419f},
-std::array<float,2>{0.169631943f, 0.409730405f},
-std::array<float,2>{0.091529429f, 0.95981437f},
-std::array<float,2>{0.966156006f, 0.0935895517f},
-std::array<float,2>{0.665340364f, 0.739119053f},
-std::array<float,2>{0.317757547f, 0.476144105f},
-std::array<float,2>{0.468705565f, 0.592908382f},
-std::array<float,2>{0.511839569f, 0.330586404f},
-std::array<float,2>{0.771781504f, 0.86561203f},
-std::array<float,2>{0.245618537f, 0.1576529f},
-std::array<float,2>{0.125554115f, 0.632785618f},
-std::array<float,2>{0.835481763f, 0.396368742f},
-std::array<float,2>{0.620629311f, 0.911711156f},
-std::array<float,2>{0.391528338f, 0.0250876546f},
-std::array<float,2>{0.307860672f, 0.808719158f},
-std::array<float,2>{0.711671293f, 0.243718237f},
-std::array<float,2>{0.906224847f, 0.527350366f},
-std::array<float,2>{0.00102659478f, 0.260673523f},
-std::array<float,2>{0.0217133239f, 0.778431058f},
-std::array<float,2>{0.888508439f, 0.211120084f},
-std::array<float,2>{0.691242695f, 0.557856917f},
-std::array<float,2>{0.293050826f, 0.29802534f},
-std::array<float,2>{0.376157194f, 0.679848373f},
-std::array<float,2>{0.59395057f, 0.433773518f},
-std::array<float,2>{0.812839389f, 0.893537939f},
-std::array<float,2>{0.14832519f, 0.0358900502f},
-std::array<float,2>{0.22334902f, 0.594336212f},
-std::array<float,2>{0.759988248f, 0.366461635f},
-std::array<float,2>{0.52618283f, 0.832245767f},
-std::array<float,2>{0.440206945f, 0.155300096f},
-std::array<float,2>{0.328605324f, 0.999623358f},
-std::array<float,2>{0.673939705f, 0.0955270156f},
-std::array<float,2>{0.952414215f, 0.691272795f},
-std::array<float,2>{0.0751123652f, 0.456746012f},
-std::array<float,2>{0.180023864f, 0.928278387f},
-std::array<float,2>{0.85440588f, 0.00753132021f},
-std::array<float,2>{0.579721153f, 0.644970834f},
-std::array<float,2>{0.425747991f, 0.386209697f},
-std::array<float,2>{0.27681458f, 0.513566256f},
-std::array<float,2>{0.747106552f, 0.274105042f},
-std::array<float,2>{0.932175875f, 0.783068359f},
-std::array<float,2>{0.0475670099f, 0.228703752f},
-std::array<float,2>{0.103535265f, 0.729079843f},
-std::array<float,2>{0.969228625f, 0.484704673f},
-std::array<float,2>{0.631404936f, 0.937930882f},
-std::array<float,2>{0.35912618f, 0.0688699111f},
-std::array<float,2>{0.495050102f, 0.848705888f},
-std::array<float,2>{0.555195332f, 0.18734552f},
-std::array<float,2>{0.80603528f, 0.573688209f},
-std::array<float,2>{0.204405949f, 0.315460056f},
-std::array<float,2>{0.212943882f, 0.808467209f},
-std::array<float,2>{0.799381912f, 0.249976724f},
-std::array<float,2>{0.550271511f, 0.524092555f},
-std::array<float,2>{0.490151465f, 0.263905168f},
-std::array<float,2>{0.347440392f, 0.625649273f},
-std::array<float,2>{0.636611938f, 0.39281711f},
-std::array<float,2>{0.978575766f, 0.906320274f},
-std::array<float,2>{0.10105405f, 0.0286725853f},
-std::array<float,2>{0.0565516017f, 0.589150727f},
-std::array<float,2>{0.924750507f, 0.334703743f},
-std::array<float,2>{0.734409034f, 0.860352159f},
-std::array<float,2>{0.272742867f, 0.162568361f},
-std::array<float,2>{0.43481043f, 0.956590176f},
-std::array<float,2>{0.589191914f, 0.0879348591f},
-std::array<float,2>{0.848007023f, 0.735151768f},
-std::array<float,2>{0.172170907f, 0.469375968f},
-std::array<float,2>{0.0643576235f, 0.88491559f},
-std::array<float,2>{0.938931465f, 0.0482106246f},
-std::array<float,2>{0.687147617f, 0.663487196f},
-std::array<float,2>{0.340092719f, 0.412870407f},
-std::array<float,2>{0.452047408f, 0.532733142f},
-std::array<float,2>{0.520473063f, 0.287549913f},
-std::array<float,2>{0.754543424f, 0.761612952f},
-std::array<float,2>{0.230646938f, 0.188243285f},
-std::array<float,2>{0.152297124f, 0.710460305f},
-std::array<float,2>{0.823353827f, 0.44213444f},
-std::array<float,2>{0.602853596f, 0.972969055f},
-std::array<float,2>{0.387618959f, 0.116114333f},
-std::array<float,2>{0.283382654f, 0.813695431f},
-std::array<float,2>{0.699060857f, 0.135448113f},
-std::array<float,2>{0.877052128f, 0.617135406f},
-std::array<float,2>{0.0238837767f, 0.34444353f},
-std::array<float,2>{0.0145422705f, 0.84479773f},
-std::array<float,2>{0.895159364f, 0.182419389f},
-std::array<float,2>{0.705324709f, 0.574518383f},
-std::array<float,2>{0.299631447f, 0.319625258f},
-std::array<float,2>{0.404520839f, 0.733604431f},
-std::array<float,2>{0.611574829f, 0.490236938f},
-std::array<float,2>{0.842135012f, 0.945262551f},
-std::array<float,2>{0.138181746f, 0.0629987866f},
-std::array<float,2>{0.239628851f, 0.510831952f},
-std::array<float,2>{0.779664576f, 0.279937953f},
-std::array<float,2>{0.501812279f, 0.788690448f},
-std::array<float,2>{0.454354674f, 0.233625904f},
-std::array<float,2>{0.323337585f, 0.92298305f},
-std::array<float,2>{0.659337819f, 0.00239370833f},
-std::array<float,2>{0.960898221f, 0.643138885f},
-std::array<float,2>{0.0810435042f, 0.388213962f},
-std::array<float,2>{0.163277f, 0.992665648f},
-std::array<float,2>{0.859893501f, 0.101151012f},
-std::array<float,2>{0.576727986f, 0.692627549f},
-std::array<float,2>{0.413137853f, 0.458233565f},
-std::array<float,2>{0.25358364f, 0.597817242f},
-std::array<float,2>{0.719992518f, 0.359735042f},
-std::array<float,2>{0.910774469f, 0.829762995f},
-std::array<float,2>{0.0394454449f, 0.152299151f},
-std::array<float,2>{0.113831453f, 0.684006512f},
-std::array<float,2>{0.988030314f, 0.433386147f},
-std::array<float,2>{0.64775306f, 0.897772193f},
-std::array<float,2>{0.359966546f, 0.0314443149f},
-std::array<float,2>{0.473328471f, 0.774398029f},
-std::array<float,2>{0.542670012f, 0.215597764f},
-std::array<float,2>{0.791457891f, 0.561072528f},
-std::array<float,2>{0.194829509f, 0.302964628f},
-std::array<float,2>{0.132355794f, 0.836925864f},
-std::array<float,2>{0.82977289f, 0.144142643f},
-std::array<float,2>{0.621623456f, 0.605375409f},
-std::array<float,2>{0.397537351f, 0.374356925f},
-std::array<float,2>{0.309718013f, 0.701471269f},
-std::array<float,2>{0.716855884f, 0.465206951f},
-std::array<float,2>{0.898754478f, 0.991337359f},
-std::array<float,2>{0.007503164f, 0.107633725f},
-std::array<float,2>{0.0882339031f, 0.550941885f},
-std::array<float,2>{0.962443233f, 0.309283406f},
-std::array<float,2>{0.669439077f, 0.766656756f},
-std::array<float,2>{0.31276831f, 0.207978949f},
-std::array<float,2>{0.461979955f, 0.903223932f},
-std::array<float,2>{0.509098232f, 0.0427420288f},
-std::array<float,2>{0.768064618f, 0.673569739f},
-std::array<float,2>{0.24655129f, 0.428802729f},
-std::array<float,2>{0.0351644866f, 0.950712502f},
-std::array<float,2>{0.921812475f, 0.0718933567f},
-std::array<float,2>{0.731876969f, 0.719892263f},
-std::array<float,2>{0.263878465f, 0.492970467f},
-std::array<float,2>{0.421690702f, 0.569448769f},
-std::array<float,2>{0.567122936f, 0.327037781f},
-std::array<float,2>{0.867810428f, 0.853262067f},
-std::array<float,2>{0.167007357f, 0.174994379f},
-std::array<float,2>{0.195564121f, 0.653121471f},
-std::array<float,2>{0.782632291f, 0.3798244f},
-std::array<float,2>{0.53532505f, 0.932698905f},
-std::array<float,2>{0.477933407f, 0.0146458279f},
-std::array<float,2>{0.370174497f, 0.792793393f},
-std::array<float,2>{0.65609622f, 0.220089301f},
-std::array<float,2>{0.995767951f, 0.501172721f},
-std::array<float,2>{0.124494471f, 0.270314693f},
-std::array<float,2>{0.105814122f, 0.752231002f},
-std::array<float,2>{0.97286272f, 0.200606316f},
-std::array<float,2>{0.62581414f, 0.540819645f},
-std::array<float,2>{0.353085726f, 0.293093979f},
-std::array<float,2>{0.499611199f, 0.670223117f},
-std::array<float,2>{0.559769094f, 0.417822927f},
-std::array<float,2>{0.808816969f, 0.876651704f},
-std::array<float,2>{0.208159193f, 0.0584808402f},
-std::array<float,2>{0.186446413f, 0.619791687f},
-std::array<float,2>{0.857095659f, 0.356047034f},
-std::array<float,2>{0.584230959f, 0.821259379f},
-std::array<float,2>{0.427635819f, 0.12542066f},
-std::array<float,2>{0.281135023f, 0.976887286f},
-std::array<float,2>{0.744789958f, 0.124062605f},
-std::array<float,2>{0.934775412f, 0.717339277f},
-std::array<float,2>{0.0540193878f, 0.450662792f},
-std::array<float,2>{0.218986586f, 0.918118656f},
-std::array<float,2>{0.765248001f, 0.0188306049f},
-std::array<float,2>{0.528021336f, 0.639971197f},
-std::array<float,2>{0.444416821f, 0.400538862f},
-std::array<float,2>{0.332633644f, 0.521911204f},
-std::array<float,2>{0.678560674f, 0.254373163f},
-std::array<float,2>{0.946783066f, 0.804246247f},
-std::array<float,2>{0.070474349f, 0.235862821f},
-std::array<float,2>{0.0189929642f, 0.747623563f},
-std::array<float,2>{0.883690834f, 0.483607769f},
-std::array<float,2>{0.692796946f, 0.963605165f},
-std::array<float,2>{0.290602654f, 0.0832679421f},
-std::array<float,2>{0.381323248f, 0.872915328f},
-std::array<float,2>{0.599950075f, 0.166052163f},
-std::array<float,2>{0.820310891f, 0.580569088f},
-std::array<float,2>{0.141986772f, 0.337709367f},
-std::array<float,2>{0.176018134f, 0.771768034f},
-std::array<float,2>{0.844385147f, 0.20566608f},
-std::array<float,2>{0.592685282f, 0.547646761f},
-std::array<float,2>{0.432429582f, 0.304868728f},
-std::array<float,2>{0.267362148f, 0.678229988f},
-std::array<float,2>{0.741856873f, 0.424274832f},
-std::array<float,2>{0.928150177f, 0.901873648f},
-std::array<float,2>{0.0588551946f, 0.0448149592f},
-std::array<float,2>{0.0972811431f, 0.608044744f},
-std::array<float,2>{0.982459188f, 0.368523806f},
-std::array<float,2>{0.640233636f, 0.840369999f},
-std::array<float,2>{0.349653721f, 0.147037685f},
-std::array<float,2>{0.48490265f, 0.988086104f},
-std::array<float,2>{0.550991654f, 0.101726368f},
-std::array<float,2>{0.801119745f, 0.696501613f},
-std::array<float,2>{0.218380496f, 0.461295575f},
-std::array<float,2>{0.0307576042f, 0.935245335f},
-std::array<float,2>{0.881901622f, 0.0098545393f},
-std::array<float,2>{0.700124502f, 0.651710987f},
-std::array<float,2>{0.285258263f, 0.378090262f},
-std::array<float,2>{0.385653347f, 0.50775826f},
-std::array<float,2>{0.606739759f, 0.26824823f},
-std::array<float,2>{0.825552046f, 0.795898497f},
-std::array<float,2>{0.155350372f, 0.225067228f},
-std::array<float,2>{0.229034618f, 0.72404176f},
-std::array<float,2>{0.752044201f, 0.498851418f},
-std::array<float,2>{0.517714024f, 0.94590646f},
-std::array<float,2>{0.448185891f, 0.0756936073f},
-std::array<float,2>{0.337774009f, 0.856256127f},
-std::array<float,2>{0.681669414f, 0.178862631f},
-std::array<float,2>{0.941499352f, 0.563884974f},
-std::array<float,2>{0.0687412024f, 0.322299123f},
-std::array<float,2>{0.0829775631f, 0.82432425f},
-std::array<float,2>{0.954355419f, 0.130755737f},
-std::array<float,2>{0.661311924f, 0.624148011f},
-std::array<float,2>{0.327062994f, 0.355027944f},
-std::array<float,2>{0.458053052f, 0.713935316f},
-std::array<float,2>{0.507395923f, 0.449065804f},
-std::array<float,2>{0.77642113f, 0.982347727f},
-std::array<float,2>{0.23503086f, 0.119130746f},
-std::array<float,2>{0.135307714f, 0.543582916f},
-std::array<float,2>{0.83782047f, 0.292119503f},
-std::array<float,2>{0.616103351f, 0.756891787f},
-std::array<float,2>{0.399010152f, 0.195427492f},
-std::array<float,2>{0.30279389f, 0.882409096f},
-std::array<float,2>{0.710205853f, 0.0618595704f},
-std::array<float,2>{0.892758727f, 0.664604545f},
-std::array<float,2>{0.0105292592f, 0.421856463f},
-std::array<float,2>{0.19115448f, 0.967336714f},
-std::array<float,2>{0.795451939f, 0.0782156959f},
-std::array<float,2>{0.545216858f, 0.74374938f},
-std::array<float,2>{0.470547915f, 0.478650242f},
-std::array<float,2>{0.365120113f, 0.583717644f},
-std::array<float,2>{0.641751707f, 0.341592103f},
-std::array<float,2>{0.991844952f, 0.867194772f},
-std::array<float,2>{0.112338103f, 0.1687655f},
-std::array<float,2>{0.0451077111f, 0.634748876f},
-std::array<float,2>{0.90918833f, 0.40378353f},
-std::array<float,2>{0.725543141f, 0.916701555f},
-std::array<float,2>{0.254887611f, 0.0214313213f},
-std::array<float,2>{0.406582117f, 0.79764992f},
-std::array<float,2>{0.572427392f, 0.242156684f},
-std::array<float,2>{0.863968432f, 0.515953481f},
-std::array<float,2>{0.159356475f, 0.252621859f},
-std::array<float,2>{0.242943764f, 0.863907218f},
-std::array<float,2>{0.770709038f, 0.158280954f},
-std::array<float,2>{0.513921499f, 0.590954602f},
-std::array<float,2>{0.465209365f, 0.329388291f},
-std::array<float,2>{0.318829298f, 0.740326464f},
-std::array<float,2>{0.667258322f, 0.474047124f},
-std::array<float,2>{0.968450844f, 0.958074212f},
-std::array<float,2>{0.092342779f, 0.0916547403f},
-std::array<float,2>{0.00369985821f, 0.529921353f},
-std::array<float,2>{0.903265476f, 0.259210855f},
-std::array<float,2>{0.712926209f, 0.812456846f},
-std::array<float,2>{0.30537793f, 0.245464146f},
-std::array<float,2>{0.392715901f, 0.913344979f},
-std::array<float,2>{0.618688345f, 0.0270961635f},
-std::array<float,2>{0.832627833f, 0.629776239f},
-std::array<float,2>{0.127113268f, 0.396841645f},
-std::array<float,2>{0.118183024f, 0.970425248f},
-std::array<float,2>{0.997700989f, 0.109881774f},
-std::array<float,2>{0.649253964f, 0.70643729f},
-std::array<float,2>{0.372688264f, 0.438177705f},
-std::array<float,2>{0.48353225f, 0.610892415f},
-std::array<float,2>{0.533821702f, 0.349891424f},
-std::array<float,2>{0.785984874f, 0.819148064f},
-std::array<float,2>{0.201169774f, 0.137308702f},
-std::array<float,2>{0.17152442f, 0.659681141f},
-std::array<float,2>{0.873583734f, 0.406398833f},
-std::array<float,2>{0.564322591f, 0.889365852f},
-std::array<float,2>{0.417939305f, 0.0522703342f},
-std::array<float,2>{0.260906607f, 0.761820078f},
-std::array<float,2>{0.726885319f, 0.192392245f},
-std::array<float,2>{0.916056812f, 0.537560999f},
-std::array<float,2>{0.0322017036f, 0.285077304f},
-std::array<float,2>{0.0498405546f, 0.783277929f},
-std::array<float,2>{0.931503356f, 0.227172181f},
-std::array<float,2>{0.748785436f, 0.514198542f},
-std::array<float,2>{0.274758875f, 0.275886506f},
-std::array<float,2>{0.421956778f, 0.646510243f},
-std::array<float,2>{0.580492556f, 0.38289699f},
-std::array<float,2>{0.853026152f, 0.926966965f},
-std::array<float,2>{0.181688741f, 0.00583026046f},
-std::array<float,2>{0.206697121f, 0.570445478f},
-std::array<float,2>{0.807544827f, 0.314033777f},
-std::array<float,2>{0.55707258f, 0.849858224f},
-std::array<float,2>{0.493692011f, 0.185463145f},
-std::array<float,2>{0.357098848f, 0.940534115f},
-std::array<float,2>{0.629345179f, 0.0678360835f},
-std::array<float,2>{0.970908046f, 0.727998078f},
-std::array<float,2>{0.102990717f, 0.487719923f},
-std::array<float,2>{0.145704791f, 0.890810072f},
-std::array<float,2>{0.815058827f, 0.0381847061f},
-std::array<float,2>{0.597294867f, 0.682197571f},
-std::array<float,2>{0.378394961f, 0.436339766f},
-std::array<float,2>{0.294957012f, 0.556472898f},
-std::array<float,2>{0.688716173f, 0.298832178f},
-std::array<float,2>{0.890213847f, 0.780212462f},
-std::array<float,2>{0.0199467838f, 0.212893248f},
-std::array<float,2>{0.0773333982f, 0.687526464f},
-std::array<float,2>{0.950437605f, 0.45347473f},
-std::array<float,2>{0.67227f, 0.996602356f},
-std::array<float,2>{0.331676543f, 0.0973002985f},
-std::array<float,2>{0.439277321f, 0.835775793f},
-std::array<float,2>{0.525289237f, 0.15372473f},
-std::array<float,2>{0.758636117f, 0.597209752f},
-std::array<float,2>{0.226295769f, 0.36340484f},
-std::array<float,2>{0.19393833f, 0.77697289f},
-std::array<float,2>{0.792569757f, 0.218323231f},
-std::array<float,2>{0.541387975f, 0.56011188f},
-std::array<float,2>{0.474491298f, 0.301022857f},
-std::array<float,2>{0.360457659f, 0.686113298f},
-std::array<float,2>{0.646904707f, 0.431241393f},
-std::array<float,2>{0.986950815f, 0.895863473f},
-std::array<float,2>{0.11471314f, 0.0348419175f},
-std::array<float,2>{0.0408029631f, 0.601174295f},
-std::array<float,2>{0.911686301f, 0.362194806f},
-std::array<float,2>{0.718983173f, 0.83058548f},
-std::array<float,2>{0.252683878f, 0.150336355f},
-std::array<float,2>{0.41304791f, 0.995106936f},
-std::array<float,2>{0.578054547f, 0.0984834135f},
-std::array<float,2>{0.86118865f, 0.695120037f},
-std::array<float,2>{0.162451044f, 0.459239036f},
-std::array<float,2>{0.0812504441f, 0.92432332f},
-std::array<float,2>{0.959130704f, 0.00115729729f},
-std::array<float,2>{0.658301592f, 0.64186126f},
-std::array<float,2>{0.322304934f, 0.388740242f},
-std::array<float,2>{0.453199923f, 0.508485675f},
-std::array<float,2>{0.500287831f, 0.278230578f},
-std::array<float,2>{0.780866623f, 0.785610914f},
-std::array<float,2>{0.23848407f, 0.231893554f},
-std::array<float,2>{0.136929587f, 0.73204428f},
-std::array<float,2>{0.843652904f, 0.488533854f},
-std::array<float,2>{0.612309873f, 0.943173289f},
-std::array<float,2>{0.405477554f, 0.0652588159f},
-std::array<float,2>{0.299988031f, 0.847296298f},
-std::array<float,2>{0.706096113f, 0.180549681f},
-std::array<float,2>{0.896371245f, 0.576550305f},
-std::array<float,2>{0.015020703f, 0.317786455f},
-std::array<float,2>{0.0253570359f, 0.815628052f},
-std::array<float,2>{0.878735602f, 0.133318365f},
-std::array<float,2>{0.69808346f, 0.614433408f},
-std::array<float,2>{0.284269571f, 0.347563148f},
-std::array<float,2>{0.38785556f, 0.708222032f},
-std::array<float,2>{0.601817608f, 0.444338977f},
-std::array<float,2>{0.823125482f, 0.976237535f},
-std::array<float,2>{0.151312098f, 0.113640122f},
-std::array<float,2>{0.232019648f, 0.533218384f},
-std::array<float,2>{0.755495489f, 0.285690516f},
-std::array<float,2>{0.520677567f, 0.759172261f},
-std::array<float,2>{0.453039467f, 0.189518198f},
-std::array<float,2>{0.341706246f, 0.882932544f},
-std::array<float,2>{0.686181009f, 0.0489653349f},
-std::array<float,2>{0.938191652f, 0.661432505f},
-std::array<float,2>{0.0633999929f, 0.411759466f},
-std::array<float,2>{0.172962561f, 0.953630447f},
-std::array<float,2>{0.849194765f, 0.0860053226f},
-std::array<float,2>{0.588651717f, 0.73679316f},
-std::array<float,2>{0.433687389f, 0.472230613f},
-std::array<float,2>{0.272293776f, 0.586585283f},
-std::array<float,2>{0.736248553f, 0.332766145f},
-std::array<float,2>{0.925419569f, 0.861431897f},
-std::array<float,2>{0.0553325489f, 0.161219493f},
-std::array<float,2>{0.100240968f, 0.627927959f},
-std::array<float,2>{0.980246723f, 0.391554087f},
-std::array<float,2>{0.634802341f, 0.908801258f},
-std::array<float,2>{0.345941812f, 0.0309997723f},
-std::array<float,2>{0.488296002f, 0.805946887f},
-std::array<float,2>{0.548888326f, 0.246309146f},
-std::array<float,2>{0.800526857f, 0.525672138f},
-std::array<float,2>{0.214080647f, 0.263040066f},
-std::array<float,2>{0.141003311f, 0.873798966f},
-std::array<float,2>{0.819036663f, 0.165653408f},
-std::array<float,2>{0.601383448f, 0.579244137f},
-std::array<float,2>{0.382100701f, 0.338120788f},
-std::array<float,2>{0.289215684f, 0.749756396f},
-std::array<float,2>{0.692367852f, 0.48222369f},
-std::array<float,2>{0.884254515f, 0.9627527f},
-std::array<float,2>{0.0179244094f, 0.0839850679f},
-std::array<float,2>{0.0718318149f, 0.520469785f},
-std::array<float,2>{0.946071208f, 0.256026596f},
-std::array<float,2>{0.679264307f, 0.802161455f},
-std::array<float,2>{0.33306542f, 0.236804023f},
-std::array<float,2>{0.44423455f, 0.921625733f},
-std::array<float,2>{0.528619349f, 0.0163931064f},
-std::array<float,2>{0.763756037f, 0.63748461f},
-std::array<float,2>{0.220540479f, 0.399518788f},
-std::array<float,2>{0.053395845f, 0.979854643f},
-std::array<float,2>{0.934406996f, 0.122035608f},
-std::array<float,2>{0.745402515f, 0.715447724f},
-std::array<float,2>{0.279691428f, 0.452102184f},
-std::array<float,2>{0.42656672f, 0.618252635f},
-std::array<float,2>{0.585329652f, 0.357707709f},
-std::array<float,2>{0.8560251f, 0.822814286f},
-std::array<float,2>{0.186833397f, 0.127217218f},
-std::array<float,2>{0.207190275f, 0.668017149f},
-std::array<float,2>{0.810024619f, 0.41544956f},
-std::array<float,2>{0.559056044f, 0.87710917f},
-std::array<float,2>{0.498093873f, 0.055652298f},
-std::array<float,2>{0.351788998f, 0.75147146f},
-std::array<float,2>{0.626376927f, 0.202385634f},
-std::array<float,2>{0.974102557f, 0.541165948f},
-std::array<float,2>{0.106845848f, 0.295455933f},
-std::array<float,2>{0.123485446f, 0.790164053f},
-std::array<float,2>{0.994484663f, 0.220707804f},
-std::array<float,2>{0.655220091f, 0.502054274f},
-std::array<float,2>{0.369581252f, 0.272070348f},
-std::array<float,2>{0.477315396f, 0.65563035f},
-std::array<float,2>{0.536382079f, 0.381783277f},
-std::array<float,2>{0.782195151f, 0.931580782f},
-std::array<float,2>{0.196318865f, 0.0123295737f},
-std::array<float,2>{0.16675891f, 0.567106962f},
-std::array<float,2>{0.868498266f, 0.325554967f},
-std::array<float,2>{0.56751436f, 0.855232179f},
-std::array<float,2>{0.420477629f, 0.17311357f},
-std::array<float,2>{0.265090585f, 0.952420294f},
-std::array<float,2>{0.730966866f, 0.0731327981f},
-std::array<float,2>{0.920676827f, 0.720813632f},
-std::array<float,2>{0.0363777727f, 0.495093644f},
-std::array<float,2>{0.247529462f, 0.90446943f},
-std::array<float,2>{0.768870711f, 0.0408086479f},
-std::array<float,2>{0.50798142f, 0.675303459f},
-std::array<float,2>{0.46101144f, 0.42730397f},
-std::array<float,2>{0.314358026f, 0.552908778f},
-std::array<float,2>{0.668651044f, 0.312055588f},
-std::array<float,2>{0.961203277f, 0.768833458f},
-std::array<float,2>{0.0896367505f, 0.209337682f},
-std::array<float,2>{0.00653306302f, 0.699961245f},
-std::array<float,2>{0.899893939f, 0.468459398f},
-std::array<float,2>{0.718030334f, 0.989224613f},
-std::array<float,2>{0.308926016f, 0.105516501f},
-std::array<float,2>{0.39669013f, 0.8381809f},
-std::array<float,2>{0.622597098f, 0.141314939f},
-std::array<float,2>{0.828182936f, 0.602655351f},
-std::array<float,2>{0.131073922f, 0.372582555f},
-std::array<float,2>{0.158621922f, 0.799915135f},
-std::array<float,2>{0.864933372f, 0.239777073f},
-std::array<float,2>{0.57380724f, 0.51780194f},
-std::array<float,2>{0.407316953f, 0.250790477f},
-std::array<float,2>{0.254834712f, 0.636419117f},
-std::array<float,2>{0.726438344f, 0.404432297f},
-std::array<float,2>{0.908591747f, 0.915754199f},
-std::array<float,2>{0.0468681492f, 0.0231040623f},
-std::array<float,2>{0.111695312f, 0.584898531f},
-std::array<float,2>{0.990351021f, 0.342285901f},
-std::array<float,2>{0.640711069f, 0.870300055f},
-std::array<float,2>{0.364239484f, 0.170333758f},
-std::array<float,2>{0.46938628f, 0.966238141f},
-std::array<float,2>{0.546515346f, 0.0803314298f},
-std::array<float,2>{0.796037436f, 0.744740367f},
-std::array<float,2>{0.189690217f, 0.477228492f},
-std::array<float,2>{0.0112944031f, 0.879778445f},
-std::array<float,2>{0.893911421f, 0.059247978f},
-std::array<float,2>{0.709100068f, 0.667373061f},
-std::array<float,2>{0.304664582f, 0.419239402f},
-std::array<float,2>{0.399796754f, 0.546339691f},
-std::array<float,2>{0.616881371f, 0.289981842f},
-std::array<float,2>{0.836748958f, 0.755223632f},
-std::array<float,2>{0.136382252f, 0.198609516f},
-std::array<float,2>{0.236095637f, 0.711692631f},
-std::array<float,2>{0.775424242f, 0.446297288f},
-std::array<float,2>{0.50594151f, 0.982595921f},
-std::array<float,2>{0.457319766f, 0.120022193f},
-std::array<float,2>{0.328036249f, 0.826632321f},
-std::array<float,2>{0.66069597f, 0.132781237f},
-std::array<float,2>{0.95350498f, 0.622542858f},
-std::array<float,2>{0.0833740011f, 0.352013737f},
-std::array<float,2>{0.0700946078f, 0.858243346f},
-std::array<float,2>{0.942697465f, 0.176167101f},
-std::array<float,2>{0.683288991f, 0.565350652f},
-std::array<float,2>{0.336850315f, 0.320564628f},
-std::array<float,2>{0.448836476f, 0.725380599f},
-std::array<float,2>{0.519274235f, 0.497412741f},
-std::array<float,2>{0.753086448f, 0.947404802f},
-std::array<float,2>{0.229510203f, 0.0777324885f},
-std::array<float,2>{0.154936582f, 0.505140841f},
-std::array<float,2>{0.824725509f, 0.265933156f},
-std::array<float,2>{0.606425226f, 0.794273794f},
-std::array<float,2>{0.386608303f, 0.22336185f},
-std::array<float,2>{0.286295414f, 0.936130524f},
-std::array<float,2>{0.700264275f, 0.00970595703f},
-std::array<float,2>{0.880991638f, 0.64985472f},
-std::array<float,2>{0.0297809131f, 0.37672919f},
-std::array<float,2>{0.216862708f, 0.985947669f},
-std::array<float,2>{0.802578747f, 0.104585201f},
-std::array<float,2>{0.552440524f, 0.699119806f},
-std::array<float,2>{0.485925436f, 0.463137776f},
-std::array<float,2>{0.350656301f, 0.606445551f},
-std::array<float,2>{0.638917744f, 0.369821936f},
-std::array<float,2>{0.98434633f, 0.843584299f},
-std::array<float,2>{0.0961680487f, 0.145229474f},
-std::array<float,2>{0.0597487763f, 0.676005065f},
-std::array<float,2>{0.928829432f, 0.423246115f},
-std::array<float,2>{0.740802467f, 0.898700058f},
-std::array<float,2>{0.265770137f, 0.0461857244f},
-std::array<float,2>{0.43274945f, 0.770933568f},
-std::array<float,2>{0.593622983f, 0.204656869f},
-std::array<float,2>{0.845056534f, 0.549954593f},
-std::array<float,2>{0.176881671f, 0.30707854f},
-std::array<float,2>{0.224834636f, 0.833777308f},
-std::array<float,2>{0.759237647f, 0.15512079f},
-std::array<float,2>{0.524382412f, 0.595263004f},
-std::array<float,2>{0.437743187f, 0.365952134f},
-std::array<float,2>{0.330460966f, 0.689622641f},
-std::array<float,2>{0.67297858f, 0.455738246f},
-std::array<float,2>{0.949456036f, 0.998055577f},
-std::array<float,2>{0.0764897987f, 0.0940844715f},
-std::array<float,2>{0.0209607594f, 0.556933463f},
-std::array<float,2>{0.889148653f, 0.297759444f},
-std::array<float,2>{0.687661529f, 0.777576685f},
-std::array<float,2>{0.296574593f, 0.212220624f},
-std::array<float,2>{0.377655506f, 0.893707156f},
-std::array<float,2>{0.596263707f, 0.0367166027f},
-std::array<float,2>{0.816338956f, 0.681482017f},
-std::array<float,2>{0.144794852f, 0.435053676f},
-std::array<float,2>{0.101621605f, 0.938902557f},
-std::array<float,2>{0.971743524f, 0.0702115223f},
-std::array<float,2>{0.630467594f, 0.72993803f},
-std::array<float,2>{0.355778515f, 0.486256301f},
-std::array<float,2>{0.492891341f, 0.57276082f},
-std::array<float,2>{0.5582304f, 0.314482123f},
-std::array<float,2>{0.808451116f, 0.84824723f},
-std::array<float,2>{0.205145031f, 0.186387539f},
-std::array<float,2>{0.18320331f, 0.6464535f},
-std::array<float,2>{0.851694524f, 0.385704309f},
-std::array<float,2>{0.581682801f, 0.929329515f},
-std::array<float,2>{0.423489451f, 0.00621790253f},
-std::array<float,2>{0.27394411f, 0.781945944f},
-std::array<float,2>{0.749476373f, 0.230092987f},
-std::array<float,2>{0.930166543f, 0.512448311f},
-std::array<float,2>{0.0494697243f, 0.274788082f},
-std::array<float,2>{0.0328845307f, 0.76530242f},
-std::array<float,2>{0.917314231f, 0.194400668f},
-std::array<float,2>{0.72844243f, 0.535910964f},
-std::array<float,2>{0.259982109f, 0.283175051f},
-std::array<float,2>{0.416921765f, 0.656493366f},
-std::array<float,2>{0.563076258f, 0.408789545f},
-std::array<float,2>{0.874602139f, 0.887851059f},
-std::array<float,2>{0.170003965f, 0.0546034165f},
-std::array<float,2>{0.200010076f, 0.612094343f},
-std::array<float,2>{0.786431611f, 0.348368436f},
-std::array<float,2>{0.534222603f, 0.818196058f},
-std::array<float,2>{0.482616663f, 0.138824806f},
-std::array<float,2>{0.371657938f, 0.971120834f},
-std::array<float,2>{0.649630368f, 0.111788452f},
-std::array<float,2>{0.996515572f, 0.704555154f},
-std::array<float,2>{0.11797981f, 0.439654082f},
-std::array<float,2>{0.128871843f, 0.911098838f},
-std::array<float,2>{0.833324552f, 0.0238521863f},
-std::array<float,2>{0.617723882f, 0.630904019f},
-std::array<float,2>{0.394042075f, 0.394809335f},
-std::array<float,2>{0.305954367f, 0.528785229f},
-std::array<float,2>{0.713912249f, 0.261527061f},
-std::array<float,2>{0.90369314f, 0.810437262f},
-std::array<float,2>{0.00267709722f, 0.242193148f},
-std::array<float,2>{0.0936661288f, 0.740231514f},
-std::array<float,2>{0.967499733f, 0.475063682f},
-std::array<float,2>{0.66655153f, 0.960054517f},
-std::array<float,2>{0.319709361f, 0.0923346505f},
-std::array<float,2>{0.465992391f, 0.866785467f},
-std::array<float,2>{0.515109837f, 0.156401098f},
-std::array<float,2>{0.769768178f, 0.59184587f},
-std::array<float,2>{0.243508294f, 0.33141169f},
-std::array<float,2>{0.241872251f, 0.787470102f},
-std::array<float,2>{0.778398395f, 0.232878f},
-std::array<float,2>{0.502611339f, 0.51025933f},
-std::array<float,2>{0.456060708f, 0.280935943f},
-std::array<float,2>{0.322185099f, 0.644198239f},
-std::array<float,2>{0.658181489f, 0.386929363f},
-std::array<float,2>{0.957618654f, 0.921906888f},
-std::array<float,2>{0.0795489997f, 0.00378331123f},
-std::array<float,2>{0.0118156178f, 0.575662374f},
-std::array<float,2>{0.898073018f, 0.318964183f},
-std::array<float,2>{0.704133868f, 0.843904912f},
-std::array<float,2>{0.297060609f, 0.182737917f},
-std::array<float,2>{0.40292713f, 0.944097817f},
-std::array<float,2>{0.609412134f, 0.0637248382f},
-std::array<float,2>{0.839964688f, 0.733240128f},
-std::array<float,2>{0.140424907f, 0.491334081f},
-std::array<float,2>{0.115796015f, 0.896530449f},
-std::array<float,2>{0.986160696f, 0.0323619097f},
-std::array<float,2>{0.64575845f, 0.684630811f},
-std::array<float,2>{0.363066494f, 0.432328761f},
-std::array<float,2>{0.47492066f, 0.561693609f},
-std::array<float,2>{0.539421022f, 0.304427505f},
-std::array<float,2>{0.790430129f, 0.775000989f},
-std::array<float,2>{0.191836908f, 0.216260046f},
-std::array<float,2>{0.161594242f, 0.691787601f},
-std::array<float,2>{0.862820923f, 0.457879603f},
-std::array<float,2>{0.5760746f, 0.993345439f},
-std::array<float,2>{0.410343707f, 0.100372843f},
-std::array<float,2>{0.250358015f, 0.828342736f},
-std::array<float,2>{0.722317934f, 0.150909528f},
-std::array<float,2>{0.912526906f, 0.599362433f},
-std::array<float,2>{0.0415035821f, 0.360625744f},
-std::array<float,2>{0.0575726442f, 0.860039055f},
-std::array<float,2>{0.923444927f, 0.16394259f},
-std::array<float,2>{0.736772001f, 0.588041663f},
-std::array<float,2>{0.270889878f, 0.335124522f},
-std::array<float,2>{0.435682744f, 0.73614496f},
-std::array<float,2>{0.586802661f, 0.470449835f},
-std::array<float,2>{0.850767672f, 0.955907702f},
-std::array<float,2>{0.175042227f, 0.0893424228f},
-std::array<float,2>{0.211969465f, 0.525042653f},
-std::array<float,2>{0.797135293f, 0.265233099f},
-std::array<float,2>{0.547191322f, 0.807545185f},
-std::array<float,2>{0.491934597f, 0.248934388f},
-std::array<float,2>{0.344390273f, 0.907251358f},
-std::array<float,2>{0.633772731f, 0.0280200653f},
-std::array<float,2>{0.9769032f, 0.62686187f},
-std::array<float,2>{0.0984543785f, 0.393565148f},
-std::array<float,2>{0.150046691f, 0.973916471f},
-std::array<float,2>{0.820364952f, 0.116221435f},
-std::array<float,2>{0.603676677f, 0.709343016f},
-std::array<float,2>{0.39009428f, 0.443040431f},
-std::array<float,2>{0.281454444f, 0.615356624f},
-std::array<float,2>{0.695780694f, 0.345342726f},
-std::array<float,2>{0.875354648f, 0.81293565f},
-std::array<float,2>{0.0263835993f, 0.135896072f},
-std::array<float,2>{0.0647978336f, 0.662660718f},
-std::array<float,2>{0.939663172f, 0.413927078f},
-std::array<float,2>{0.68426013f, 0.886468649f},
-std::array<float,2>{0.343095154f, 0.0474422835f},
-std::array<float,2>{0.451121241f, 0.760556698f},
-std::array<float,2>{0.521931767f, 0.189223528f},
-std::array<float,2>{0.757461786f, 0.531790555f},
-std::array<float,2>{0.233038485f, 0.288414866f},
-std::array<float,2>{0.184651747f, 0.821894944f},
-std::array<float,2>{0.858657181f, 0.126768559f},
-std::array<float,2>{0.583585083f, 0.621051908f},
-std::array<float,2>{0.428476065f, 0.356922477f},
-std::array<float,2>{0.277971953f, 0.718533039f},
-std::array<float,2>{0.742487133f, 0.449392527f},
-std::array<float,2>{0.935910285f, 0.977676094f},
-std::array<float,2>{0.0524084307f, 0.123386309f},
-std::array<float,2>{0.108956046f, 0.539592445f},
-std::array<float,2>{0.976521969f, 0.294743121f},
-std::array<float,2>{0.627229631f, 0.753867984f},
-std::array<float,2>{0.35528928f, 0.200180411f},
-std::array<float,2>{0.496679604f, 0.875770092f},
-std::array<float,2>{0.561675608f, 0.0568086766f},
-std::array<float,2>{0.811747193f, 0.671612084f},
-std::array<float,2>{0.209461942f, 0.416470021f},
-std::array<float,2>{0.0174504519f, 0.964296103f},
-std::array<float,2>{0.886322856f, 0.0827625021f},
-std::array<float,2>{0.69494009f, 0.746706963f},
-std::array<float,2>{0.292915136f, 0.482786655f},
-std::array<float,2>{0.379589528f, 0.581115067f},
-std::array<float,2>{0.598351538f, 0.336500287f},
-std::array<float,2>{0.817065239f, 0.87165451f},
-std::array<float,2>{0.142585367f, 0.167384937f},
-std::array<float,2>{0.221444726f, 0.639495373f},
-std::array<float,2>{0.763630986f, 0.402165234f},
-std::array<float,2>{0.530473888f, 0.918981612f},
-std::array<float,2>{0.441976726f, 0.0184689108f},
-std::array<float,2>{0.335009128f, 0.803068876f},
-std::array<float,2>{0.676283777f, 0.235026628f},
-std::array<float,2>{0.947792709f, 0.522566199f},
-std::array<float,2>{0.0736265853f, 0.255478024f},
-std::array<float,2>{0.0872423276f, 0.766138077f},
-std::array<float,2>{0.962956071f, 0.208466247f},
-std::array<float,2>{0.670263231f, 0.552314639f},
-std::array<float,2>{0.314482749f, 0.310347527f},
-std::array<float,2>{0.463453263f, 0.6725775f},
-std::array<float,2>{0.510522902f, 0.427940905f},
-std::array<float,2>{0.766698241f, 0.903538525f},
-std::array<float,2>{0.249301553f, 0.0417745113f},
-std::array<float,2>{0.12923044f, 0.603752792f},
-std::array<float,2>{0.831137896f, 0.373527378f},
-std::array<float,2>{0.623623133f, 0.836794317f},
-std::array<float,2>{0.395108432f, 0.143106163f},
-std::array<float,2>{0.311913431f, 0.990579307f},
-std::array<float,2>{0.71595639f, 0.10928867f},
-std::array<float,2>{0.901645005f, 0.70271349f},
-std::array<float,2>{0.00454052631f, 0.465867728f},
-std::array<float,2>{0.197797731f, 0.932093501f},
-std::array<float,2>{0.783484399f, 0.0155202653f},
-std::array<float,2>{0.538329899f, 0.653782725f},
-std::array<float,2>{0.479555845f, 0.380207628f},
-std::array<float,2>{0.369139642f, 0.500451744f},
-std::array<float,2>{0.653287053f, 0.271203697f},
-std::array<float,2>{0.992519081f, 0.791798651f},
-std::array<float,2>{0.121546246f, 0.219139412f},
-std::array<float,2>{0.0378037058f, 0.718944371f},
-std::array<float,2>{0.919106245f, 0.494045198f},
-std::array<float,2>{0.733604372f, 0.949979782f},
-std::array<float,2>{0.262493491f, 0.0703746527f},
-std::array<float,2>{0.419908017f, 0.8525244f},
-std::array<float,2>{0.569470704f, 0.174409837f},
-std::array<float,2>{0.870851636f, 0.569310546f},
-std::array<float,2>{0.165762171f, 0.327320874f},
-std::array<float,2>{0.133207008f, 0.756048679f},
-std::array<float,2>{0.83960861f, 0.196857929f},
-std::array<float,2>{0.614212036f, 0.544457316f},
-std::array<float,2>{0.402042925f, 0.291162908f},
-std::array<float,2>{0.30085057f, 0.665296376f},
-std::array<float,2>{0.708253086f, 0.4207775f},
-std::array<float,2>{0.891405642f, 0.881676972f},
-std::array<float,2>{0.00813600142f, 0.0612390935f},
-std::array<float,2>{0.0842116699f, 0.623669028f},
-std::array<float,2>{0.956510723f, 0.354311556f},
-std::array<float,2>{0.662279546f, 0.825925767f},
-std::array<float,2>{0.325494409f, 0.129465774f},
-std::array<float,2>{0.460001141f, 0.981272161f},
-std::array<float,2>{0.505261838f, 0.117936604f},
-std::array<float,2>{0.775108039f, 0.713535428f},
-std::array<float,2>{0.23825258f, 0.448173791f},
-std::array<float,2>{0.0435581468f, 0.917510509f},
-std::array<float,2>{0.907109559f, 0.0204301141f},
-std::array<float,2>{0.724421442f, 0.633768082f},
-std::array<float,2>{0.25717777f, 0.403244704f},
-std::array<float,2>{0.408658266f, 0.517197609f},
-std::array<float,2>{0.570537388f, 0.253498137f},
-std::array<float,2>{0.865525186f, 0.798641801f},
-std::array<float,2>{0.157199487f, 0.240984946f},
-std::array<float,2>{0.188497052f, 0.742998481f},
-std::array<float,2>{0.793149054f, 0.479629189f},
-std::array<float,2>{0.544674039f, 0.968367636f},
-std::array<float,2>{0.472334057f, 0.0797955766f},
-std::array<float,2>{0.36563924f, 0.868487835f},
-std::array<float,2>{0.64309144f, 0.169514894f},
-std::array<float,2>{0.990056515f, 0.582826316f},
-std::array<float,2>{0.109731749f, 0.339868009f},
-std::array<float,2>{0.0948382467f, 0.841096163f},
-std::array<float,2>{0.980858982f, 0.147554532f},
-std::array<float,2>{0.638279557f, 0.608953893f},
-std::array<float,2>{0.348872393f, 0.368055195f},
-std::array<float,2>{0.488067508f, 0.696117461f},
-std::array<float,2>{0.554432213f, 0.462618589f},
-std::array<float,2>{0.803550005f, 0.986737609f},
-std::array<float,2>{0.216128767f, 0.10298989f},
-std::array<float,2>{0.179105356f, 0.547884762f},
-std::array<float,2>{0.847389162f, 0.305783629f},
-std::array<float,2>{0.590324223f, 0.773142397f},
-std::array<float,2>{0.431532234f, 0.206437126f},
-std::array<float,2>{0.268668056f, 0.901107609f},
-std::array<float,2>{0.738867104f, 0.043336302f},
-std::array<float,2>{0.927241147f, 0.679605544f},
-std::array<float,2>{0.0613702908f, 0.425688595f},
-std::array<float,2>{0.227184951f, 0.946605504f},
-std::array<float,2>{0.751071513f, 0.0747524723f},
-std::array<float,2>{0.516283095f, 0.723504126f},
-std::array<float,2>{0.445521891f, 0.499571443f},
-std::array<float,2>{0.339187741f, 0.563060462f},
-std::array<float,2>{0.681504846f, 0.324041694f},
-std::array<float,2>{0.943488836f, 0.857061386f},
-std::array<float,2>{0.0666346326f, 0.17774348f},
-std::array<float,2>{0.0287033059f, 0.650617003f},
-std::array<float,2>{0.879401863f, 0.377064228f},
-std::array<float,2>{0.702014446f, 0.933979809f},
-std::array<float,2>{0.287383527f, 0.0114486078f},
-std::array<float,2>{0.383727938f, 0.795727968f},
-std::array<float,2>{0.607661486f, 0.225877553f},
-std::array<float,2>{0.82633543f, 0.506242514f},
-std::array<float,2>{0.153557628f, 0.269479543f},
-std::array<float,2>{0.203751892f, 0.85073477f},
-std::array<float,2>{0.805008948f, 0.183638334f},
-std::array<float,2>{0.556146979f, 0.572242022f},
-std::array<float,2>{0.495979846f, 0.313190401f},
-std::array<float,2>{0.358143806f, 0.726600945f},
-std::array<float,2>{0.632646561f, 0.4867419f},
-std::array<float,2>{0.970320821f, 0.939779818f},
-std::array<float,2>{0.105105758f, 0.0669738054f},
-std::array<float,2>{0.0481594056f, 0.515306175f},
-std::array<float,2>{0.933065891f, 0.276671737f},
-std::array<float,2>{0.747054994f, 0.78430748f},
-std::array<float,2>{0.276161075f, 0.227992207f},
-std::array<float,2>{0.423963428f, 0.926620603f},
-std::array<float,2>{0.57878989f, 0.00405390002f},
-std::array<float,2>{0.854978979f, 0.647546947f},
-std::array<float,2>{0.180677816f, 0.384099454f},
-std::array<float,2>{0.0755140632f, 0.997641146f},
-std::array<float,2>{0.951432943f, 0.0959282219f},
-std::array<float,2>{0.675437987f, 0.688887119f},
-std::array<float,2>{0.329684436f, 0.454486489f},
-std::array<float,2>{0.44132939f, 0.59657371f},
-std::array<float,2>{0.526542962f, 0.364445865f},
-std::array<float,2>{0.76118964f, 0.834358096f},
-std::array<float,2>{0.223718613f, 0.15258722f},
-std::array<float,2>{0.147075236f, 0.682734966f},
-std::array<float,2>{0.813646197f, 0.437267303f},
-std::array<float,2>{0.595550478f, 0.891830564f},
-std::array<float,2>{0.375237942f, 0.0378677696f},
-std::array<float,2>{0.294336587f, 0.780610085f},
-std::array<float,2>{0.690113246f, 0.214288265f},
-std::array<float,2>{0.887545526f, 0.554991305f},
-std::array<float,2>{0.0225880183f, 0.299900711f},
-std::array<float,2>{0.000436161557f, 0.810677409f},
-std::array<float,2>{0.904645681f, 0.244881019f},
-std::array<float,2>{0.712260544f, 0.530399919f},
-std::array<float,2>{0.307563514f, 0.257914305f},
-std::array<float,2>{0.392001033f, 0.630439341f},
-std::array<float,2>{0.619599462f, 0.398035586f},
-std::array<float,2>{0.834849954f, 0.912578344f},
-std::array<float,2>{0.126933917f, 0.0257245563f},
-std::array<float,2>{0.244201913f, 0.590147674f},
-std::array<float,2>{0.772723019f, 0.3286708f},
-std::array<float,2>{0.513084471f, 0.865188777f},
-std::array<float,2>{0.467096627f, 0.159822136f},
-std::array<float,2>{0.316979349f, 0.957850158f},
-std::array<float,2>{0.664258361f, 0.0899821296f},
-std::array<float,2>{0.965746284f, 0.741634429f},
-std::array<float,2>{0.0902411938f, 0.473096043f},
-std::array<float,2>{0.168645442f, 0.890249193f},
-std::array<float,2>{0.871550918f, 0.0516081266f},
-std::array<float,2>{0.565979958f, 0.659126759f},
-std::array<float,2>{0.415908128f, 0.407954991f},
-std::array<float,2>{0.259480864f, 0.538459539f},
-std::array<float,2>{0.728807211f, 0.283396423f},
-std::array<float,2>{0.91420579f, 0.763630092f},
-std::array<float,2>{0.0334208198f, 0.192322195f},
-std::array<float,2>{0.120324984f, 0.705519199f},
-std::array<float,2>{0.999759376f, 0.438549638f},
-std::array<float,2>{0.652047157f, 0.968999267f},
-std::array<float,2>{0.374252319f, 0.111287042f},
-std::array<float,2>{0.482363075f, 0.819336653f},
-std::array<float,2>{0.531318486f, 0.137795642f},
-std::array<float,2>{0.788998187f, 0.60944283f},
-std::array<float,2>{0.202910736f, 0.350895226f},
-std::array<float,2>{0.237935022f, 0.75443083f},
-std::array<float,2>{0.7752707f, 0.197779894f},
-std::array<float,2>{0.504977286f, 0.545702696f},
-std::array<float,2>{0.460211277f, 0.29100275f},
-std::array<float,2>{0.325437397f, 0.666933894f},
-std::array<float,2>{0.662410557f, 0.418326855f},
-std::array<float,2>{0.956225634f, 0.880849361f},
-std::array<float,2>{0.0844160765f, 0.0598455742f},
-std::array<float,2>{0.0079783313f, 0.622054994f},
-std::array<float,2>{0.891254723f, 0.35290277f},
-std::array<float,2>{0.708099604f, 0.827721536f},
-std::array<float,2>{0.301153898f, 0.131485954f},
-std::array<float,2>{0.402263373f, 0.983623326f},
-std::array<float,2>{0.613804221f, 0.120255575f},
-std::array<float,2>{0.839436889f, 0.712813199f},
-std::array<float,2>{0.132984266f, 0.445351422f},
-std::array<float,2>{0.109578639f, 0.914457381f},
-std::array<float,2>{0.989866316f, 0.0221762173f},
-std::array<float,2>{0.643483758f, 0.635084808f},
-std::array<float,2>{0.365392357f, 0.405834198f},
-std::array<float,2>{0.472511441f, 0.518651247f},
-std::array<float,2>{0.544784427f, 0.251036853f},
-std::array<float,2>{0.793410778f, 0.799646199f},
-std::array<float,2>{0.188731521f, 0.238918602f},
-std::array<float,2>{0.156882197f, 0.745511413f},
-std::array<float,2>{0.865375817f, 0.478387356f},
-std::array<float,2>{0.570764065f, 0.965531409f},
-std::array<float,2>{0.408311903f, 0.081942752f},
-std::array<float,2>{0.256841451f, 0.870002627f},
-std::array<float,2>{0.724315584f, 0.1711822f},
-std::array<float,2>{0.906856954f, 0.585852206f},
-std::array<float,2>{0.0438337773f, 0.343289912f},
-std::array<float,2>{0.0611082762f, 0.842033327f},
-std::array<float,2>{0.926770091f, 0.146338344f},
-std::array<float,2>{0.73913157f, 0.605568886f},
-std::array<float,2>{0.269003093f, 0.370781541f},
-std::array<float,2>{0.431284964f, 0.697355688f},
-std::array<float,2>{0.590056479f, 0.464267135f},
-std::array<float,2>{0.847453475f, 0.985092998f},
-std::array<float,2>{0.178854287f, 0.104060501f},
-std::array<float,2>{0.215849444f, 0.548862576f},
-std::array<float,2>{0.803390503f, 0.308501303f},
-std::array<float,2>{0.554500222f, 0.769818962f},
-std::array<float,2>{0.487915516f, 0.203711882f},
-std::array<float,2>{0.348987937f, 0.899567962f},
-std::array<float,2>{0.638507187f, 0.0452090017f},
-std::array<float,2>{0.98062551f, 0.677364111f},
-std::array<float,2>{0.0949808657f, 0.422093004f},
-std::array<float,2>{0.153802082f, 0.94868046f},
-std::array<float,2>{0.82654798f, 0.0765567273f},
-std::array<float,2>{0.607747316f, 0.725638926f},
-std::array<float,2>{0.383319765f, 0.496494383f},
-std::array<float,2>{0.287226588f, 0.56622839f},
-std::array<float,2>{0.701685369f, 0.321495533f},
-std::array<float,2>{0.879787803f, 0.85852313f},
-std::array<float,2>{0.0284030475f, 0.176807597f},
-std::array<float,2>{0.066839315f, 0.648827851f},
-std::array<float,2>{0.94381541f, 0.375001073f},
-std::array<float,2>{0.681311488f, 0.937055051f},
-std::array<float,2>{0.338896513f, 0.00809576083f},
-std::array<float,2>{0.44559288f, 0.793016553f},
-std::array<float,2>{0.516490638f, 0.224311203f},
-std::array<float,2>{0.75133878f, 0.504250705f},
-std::array<float,2>{0.227477178f, 0.26725769f},
-std::array<float,2>{0.181012318f, 0.849218488f},
-std::array<float,2>{0.854597986f, 0.18677026f},
-std::array<float,2>{0.578978062f, 0.573894024f},
-std::array<float,2>{0.424143016f, 0.316348344f},
-std::array<float,2>{0.276038349f, 0.728871167f},
-std::array<float,2>{0.746699154f, 0.485241055f},
-std::array<float,2>{0.932662189f, 0.938163102f},
-std::array<float,2>{0.0480453372f, 0.0686701387f},
-std::array<float,2>{0.105377339f, 0.513060093f},
-std::array<float,2>{0.970636666f, 0.273571521f},
-std::array<float,2>{0.632439077f, 0.782441914f},
-std::array<float,2>{0.358383417f, 0.229214445f},
-std::array<float,2>{0.495772064f, 0.927792132f},
-std::array<float,2>{0.555781841f, 0.00702021364f},
-std::array<float,2>{0.804827929f, 0.645453513f},
-std::array<float,2>{0.204095751f, 0.386430442f},
-std::array<float,2>{0.0227386504f, 0.999196529f},
-std::array<float,2>{0.887345374f, 0.0948515683f},
-std::array<float,2>{0.690343916f, 0.690583587f},
-std::array<float,2>{0.294079989f, 0.456216782f},
-std::array<float,2>{0.375252843f, 0.593972981f},
-std::array<float,2>{0.59529984f, 0.367001891f},
-std::array<float,2>{0.813785851f, 0.83266139f},
-std::array<float,2>{0.147300437f, 0.155806407f},
-std::array<float,2>{0.224070802f, 0.680307508f},
-std::array<float,2>{0.760953188f, 0.43416816f},
-std::array<float,2>{0.526824772f, 0.892957509f},
-std::array<float,2>{0.440962225f, 0.0353778303f},
-std::array<float,2>{0.329882592f, 0.778963864f},
-std::array<float,2>{0.675660849f, 0.211833984f},
-std::array<float,2>{0.951203108f, 0.558358908f},
-std::array<float,2>{0.0752424002f, 0.298786551f},
-std::array<float,2>{0.0900315791f, 0.809519529f},
-std::array<float,2>{0.965491652f, 0.243430868f},
-std::array<float,2>{0.664473772f, 0.528261662f},
-std::array<float,2>{0.31737107f, 0.259994805f},
-std::array<float,2>{0.467007428f, 0.632105172f},
-std::array<float,2>{0.512697756f, 0.39576456f},
-std::array<float,2>{0.772504985f, 0.91127342f},
-std::array<float,2>{0.24446331f, 0.0245108213f},
-std::array<float,2>{0.12652193f, 0.593633354f},
-std::array<float,2>{0.834574997f, 0.330136895f},
-std::array<float,2>{0.619216263f, 0.866051972f},
-std::array<float,2>{0.39165619f, 0.158098221f},
-std::array<float,2>{0.30725646f, 0.958986104f},
-std::array<float,2>{0.711995661f, 0.0931501985f},
-std::array<float,2>{0.904328227f, 0.73845613f},
-std::array<float,2>{0.000189138504f, 0.475949824f},
-std::array<float,2>{0.202639505f, 0.887216091f},
-std::array<float,2>{0.788697183f, 0.0531803668f},
-std::array<float,2>{0.531517625f, 0.657979548f},
-std::array<float,2>{0.482092977f, 0.409181863f},
-std::array<float,2>{0.374306262f, 0.536142945f},
-std::array<float,2>{0.652152181f, 0.281653374f},
-std::array<float,2>{0.999561787f, 0.763784707f},
-std::array<float,2>{0.120539375f, 0.193705574f},
-std::array<float,2>{0.0335063897f, 0.703177512f},
-std::array<float,2>{0.914530337f, 0.441098839f},
-std::array<float,2>{0.728593826f, 0.972355127f},
-std::array<float,2>{0.259760737f, 0.113250144f},
-std::array<float,2>{0.415602744f, 0.816974759f},
-std::array<float,2>{0.566331923f, 0.139877528f},
-std::array<float,2>{0.871289015f, 0.613198102f},
-std::array<float,2>{0.168877736f, 0.348930895f},
-std::array<float,2>{0.140187413f, 0.786486268f},
-std::array<float,2>{0.840169251f, 0.230887294f},
-std::array<float,2>{0.609621108f, 0.509529412f},
-std::array<float,2>{0.403159708f, 0.278785825f},
-std::array<float,2>{0.297302425f, 0.641589105f},
-std::array<float,2>{0.704397619f, 0.389979959f},
-std::array<float,2>{0.898260534f, 0.924806356f},
-std::array<float,2>{0.0119979251f, 0.000665582542f},
-std::array<float,2>{0.0792045444f, 0.578016162f},
-std::array<float,2>{0.95792985f, 0.316504747f},
-std::array<float,2>{0.657770872f, 0.846058607f},
-std::array<float,2>{0.322021425f, 0.181297258f},
-std::array<float,2>{0.456488967f, 0.942113519f},
-std::array<float,2>{0.502738118f, 0.0656440035f},
-std::array<float,2>{0.778634131f, 0.731425762f},
-std::array<float,2>{0.24202694f, 0.489906758f},
-std::array<float,2>{0.0410796143f, 0.894792378f},
-std::array<float,2>{0.912171543f, 0.0333144814f},
-std::array<float,2>{0.72261703f, 0.686720371f},
-std::array<float,2>{0.250237614f, 0.430390805f},
-std::array<float,2>{0.410470098f, 0.558635533f},
-std::array<float,2>{0.575874269f, 0.302214414f},
-std::array<float,2>{0.86319375f, 0.775953293f},
-std::array<float,2>{0.161350727f, 0.217184871f},
-std::array<float,2>{0.191456676f, 0.693812847f},
-std::array<float,2>{0.790153742f, 0.46061331f},
-std::array<float,2>{0.539259255f, 0.995646715f},
-std::array<float,2>{0.474645346f, 0.0986374393f},
-std::array<float,2>{0.36298883f, 0.831185043f},
-std::array<float,2>{0.645710766f, 0.148642883f},
-std::array<float,2>{0.985897124f, 0.599868774f},
-std::array<float,2>{0.115995489f, 0.362993479f},
-std::array<float,2>{0.0983029976f, 0.862599492f},
-std::array<float,2>{0.97675252f, 0.160210922f},
-std::array<float,2>{0.633430481f, 0.587024808f},
-std::array<float,2>{0.344584912f, 0.333013624f},
-std::array<float,2>{0.492084146f, 0.737439752f},
-std::array<float,2>{0.546958268f, 0.470800608f},
-std::array<float,2>{0.797091246f, 0.954132497f},
-std::array<float,2>{0.212275282f, 0.0871039033f},
-std::array<float,2>{0.175188333f, 0.526771188f},
-std::array<float,2>{0.85085839f, 0.261912137f},
-std::array<float,2>{0.586456597f, 0.805340469f},
-std::array<float,2>{0.435942501f, 0.247483149f},
-std::array<float,2>{0.270617455f, 0.909258962f},
-std::array<float,2>{0.736484587f, 0.029656129f},
-std::array<float,2>{0.923761189f, 0.628838599f},
-std::array<float,2>{0.0573185645f, 0.392478198f},
-std::array<float,2>{0.233369693f, 0.974746466f},
-std::array<float,2>{0.757570207f, 0.114480458f},
-std::array<float,2>{0.521663547f, 0.707255542f},
-std::array<float,2>{0.450826734f, 0.444202006f},
-std::array<float,2>{0.342850685f, 0.613733232f},
-std::array<float,2>{0.684391022f, 0.345842332f},
-std::array<float,2>{0.939889014f, 0.815123796f},
-std::array<float,2>{0.0644926503f, 0.134308472f},
-std::array<float,2>{0.02677368f, 0.66018337f},
-std::array<float,2>{0.875012279f, 0.410870135f},
-std::array<float,2>{0.695542395f, 0.884216249f},
-std::array<float,2>{0.281616807f, 0.049839057f},
-std::array<float,2>{0.38966462f, 0.758045554f},
-std::array<float,2>{0.603881836f, 0.191322327f},
-std::array<float,2>{0.820662856f, 0.535041809f},
-std::array<float,2>{0.150293708f, 0.287058204f},
-std::array<float,2>{0.209221914f, 0.824102759f},
-std::array<float,2>{0.811884761f, 0.128863886f},
-std::array<float,2>{0.56198585f, 0.618019342f},
-std::array<float,2>{0.496874213f, 0.3588579f},
-std::array<float,2>{0.355161518f, 0.715878904f},
-std::array<float,2>{0.627127707f, 0.452967286f},
-std::array<float,2>{0.97629112f, 0.97948885f},
-std::array<float,2>{0.109338634f, 0.122096621f},
-std::array<float,2>{0.052551426f, 0.542939484f},
-std::array<float,2>{0.935655832f, 0.296473533f},
-std::array<float,2>{0.742358565f, 0.750224948f},
-std::array<float,2>{0.278245598f, 0.201772302f},
-std::array<float,2>{0.428448141f, 0.87886411f},
-std::array<float,2>{0.583805859f, 0.0558948256f},
-std::array<float,2>{0.858423114f, 0.669577718f},
-std::array<float,2>{0.184902951f, 0.414420843f},
-std::array<float,2>{0.0733745024f, 0.961646557f},
-std::array<float,2>{0.948062003f, 0.0858979821f},
-std::array<float,2>{0.676741242f, 0.74819392f},
-std::array<float,2>{0.335260451f, 0.481307447f},
-std::array<float,2>{0.442354828f, 0.578503609f},
-std::array<float,2>{0.530587137f, 0.339399874f},
-std::array<float,2>{0.763338149f, 0.874678791f},
-std::array<float,2>{0.221353471f, 0.164705962f},
-std::array<float,2>{0.142843053f, 0.638023734f},
-std::array<float,2>{0.817267954f, 0.398543924f},
-std::array<float,2>{0.598549366f, 0.920532167f},
-std::array<float,2>{0.379867643f, 0.0171518996f},
-std::array<float,2>{0.292598993f, 0.801050782f},
-std::array<float,2>{0.695115447f, 0.237592608f},
-std::array<float,2>{0.886514783f, 0.520965755f},
-std::array<float,2>{0.0173220001f, 0.257236004f},
-std::array<float,2>{0.0048685451f, 0.768454611f},
-std::array<float,2>{0.901390433f, 0.21001339f},
-std::array<float,2>{0.716263652f, 0.553715527f},
-std::array<float,2>{0.311712861f, 0.3106094f},
-std::array<float,2>{0.395396531f, 0.673917294f},
-std::array<float,2>{0.623804867f, 0.426196605f},
-std::array<float,2>{0.831375837f, 0.90595293f},
-std::array<float,2>{0.128910035f, 0.0392858163f},
-std::array<float,2>{0.249234617f, 0.601768672f},
-std::array<float,2>{0.766928494f, 0.372007847f},
-std::array<float,2>{0.5103001f, 0.83980304f},
-std::array<float,2>{0.463679284f, 0.142140448f},
-std::array<float,2>{0.314889014f, 0.989683628f},
-std::array<float,2>{0.670083523f, 0.107025571f},
-std::array<float,2>{0.963181674f, 0.701051235f},
-std::array<float,2>{0.0869923979f, 0.467268497f},
-std::array<float,2>{0.16579403f, 0.930104494f},
-std::array<float,2>{0.870797992f, 0.013013985f},
-std::array<float,2>{0.569816172f, 0.6546157f},
-std::array<float,2>{0.419536352f, 0.382712752f},
-std::array<float,2>{0.262312561f, 0.502940774f},
-std::array<float,2>{0.733757913f, 0.273023099f},
-std::array<float,2>{0.919337213f, 0.789489627f},
-std::array<float,2>{0.0379991718f, 0.222189143f},
-std::array<float,2>{0.121301681f, 0.722055793f},
-std::array<float,2>{0.992328048f, 0.495981544f},
-std::array<float,2>{0.652900577f, 0.95143646f},
-std::array<float,2>{0.368770927f, 0.0736088455f},
-std::array<float,2>{0.479775637f, 0.854366064f},
-std::array<float,2>{0.538527071f, 0.17262128f},
-std::array<float,2>{0.783358574f, 0.567911983f},
-std::array<float,2>{0.198173791f, 0.325092256f},
-std::array<float,2>{0.189750224f, 0.797163248f},
-std::array<float,2>{0.79631424f, 0.241517022f},
-std::array<float,2>{0.546661615f, 0.516567469f},
-std::array<float,2>{0.469695807f, 0.25218448f},
-std::array<float,2>{0.363869488f, 0.634014547f},
-std::array<float,2>{0.640923679f, 0.404241055f},
-std::array<float,2>{0.990653336f, 0.916133583f},
-std::array<float,2>{0.111480325f, 0.0205121152f},
-std::array<float,2>{0.0465259142f, 0.583419442f},
-std::array<float,2>{0.908364236f, 0.341152221f},
-std::array<float,2>{0.726278126f, 0.867783308f},
-std::array<float,2>{0.254550695f, 0.168155447f},
-std::array<float,2>{0.407580942f, 0.967067182f},
-std::array<float,2>{0.574151933f, 0.0786499903f},
-std::array<float,2>{0.865044177f, 0.743356824f},
-std::array<float,2>{0.15829584f, 0.479468316f},
-std::array<float,2>{0.0830530599f, 0.88218075f},
-std::array<float,2>{0.953205287f, 0.0624684021f},
-std::array<float,2>{0.661010504f, 0.664259195f},
-std::array<float,2>{0.327876449f, 0.421121478f},
-std::array<float,2>{0.457196772f, 0.543335617f},
-std::array<float,2>{0.50626713f, 0.292484969f},
-std::array<float,2>{0.77574867f, 0.757436574f},
-std::array<float,2>{0.235906795f, 0.195815921f},
-std::array<float,2>{0.13656725f, 0.714761257f},
-std::array<float,2>{0.836574495f, 0.448455453f},
-std::array<float,2>{0.617158413f, 0.981566012f},
-std::array<float,2>{0.399442941f, 0.118475862f},
-std::array<float,2>{0.304277658f, 0.824760556f},
-std::array<float,2>{0.709286213f, 0.129916266f},
-std::array<float,2>{0.893792272f, 0.624569416f},
-std::array<float,2>{0.0116450572f, 0.354810327f},
-std::array<float,2>{0.0294066854f, 0.855643332f},
-std::array<float,2>{0.881191909f, 0.179434434f},
-std::array<float,2>{0.700662732f, 0.564021766f},
-std::array<float,2>{0.28645125f, 0.322934687f},
-std::array<float,2>{0.386325598f, 0.724250913f},
-std::array<float,2>{0.606012166f, 0.498304635f},
-std::array<float,2>{0.825127423f, 0.945590377f},
-std::array<float,2>{0.155184031f, 0.0755418614f},
-std::array<float,2>{0.229962572f, 0.507139087f},
-std::array<float,2>{0.753275037f, 0.26784426f},
-std::array<float,2>{0.519479513f, 0.796802342f},
-std::array<float,2>{0.449058324f, 0.225145802f},
-std::array<float,2>{0.336502939f, 0.934695303f},
-std::array<float,2>{0.683526039f, 0.010334163f},
-std::array<float,2>{0.942620158f, 0.652101874f},
-std::array<float,2>{0.070024766f, 0.378840804f},
-std::array<float,2>{0.177178115f, 0.987451494f},
-std::array<float,2>{0.844729841f, 0.102402829f},
-std::array<float,2>{0.593483448f, 0.697107911f},
-std::array<float,2>{0.433083475f, 0.4618797f},
-std::array<float,2>{0.266045362f, 0.607759714f},
-std::array<float,2>{0.741121948f, 0.369013578f},
-std::array<float,2>{0.929124236f, 0.840019464f},
-std::array<float,2>{0.059845563f, 0.146935835f},
-std::array<float,2>{0.0959056467f, 0.677938223f},
-std::array<float,2>{0.984057903f, 0.424746484f},
-std::array<float,2>{0.638725042f, 0.901619256f},
-std::array<float,2>{0.350954473f, 0.0442393832f},
-std::array<float,2>{0.486094117f, 0.772165656f},
-std::array<float,2>{0.552663386f, 0.20520702f},
-std::array<float,2>{0.802431345f, 0.547227979f},
-std::array<float,2>{0.217100859f, 0.305631846f},
-std::array<float,2>{0.14455314f, 0.83531487f},
-std::array<float,2>{0.815956533f, 0.154033884f},
-std::array<float,2>{0.596603453f, 0.597048461f},
-std::array<float,2>{0.377920687f, 0.363886565f},
-std::array<float,2>{0.296633065f, 0.688170612f},
-std::array<float,2>{0.687862635f, 0.453730941f},
-std::array<float,2>{0.888863385f, 0.996323407f},
-std::array<float,2>{0.0206628349f, 0.0970540568f},
-std::array<float,2>{0.0763351396f, 0.556009173f},
-std::array<float,2>{0.949591279f, 0.299689114f},
-std::array<float,2>{0.673174739f, 0.779780328f},
-std::array<float,2>{0.330150664f, 0.213701099f},
-std::array<float,2>{0.437775403f, 0.891233027f},
-std::array<float,2>{0.523966074f, 0.0388405286f},
-std::array<float,2>{0.758881152f, 0.682093143f},
-std::array<float,2>{0.224961728f, 0.435895562f},
-std::array<float,2>{0.0496889055f, 0.941047728f},
-std::array<float,2>{0.929813504f, 0.0680823848f},
-std::array<float,2>{0.749099851f, 0.728464961f},
-std::array<float,2>{0.274309456f, 0.487913609f},
-std::array<float,2>{0.423676372f, 0.570907652f},
-std::array<float,2>{0.581880331f, 0.313657761f},
-std::array<float,2>{0.851848423f, 0.850578547f},
-std::array<float,2>{0.183482841f, 0.18475534f},
-std::array<float,2>{0.205533445f, 0.646980047f},
-std::array<float,2>{0.80821377f, 0.383348972f},
-std::array<float,2>{0.558422148f, 0.927371085f},
-std::array<float,2>{0.492927283f, 0.00516228564f},
-std::array<float,2>{0.355677634f, 0.783741891f},
-std::array<float,2>{0.630688071f, 0.226785332f},
-std::array<float,2>{0.972131014f, 0.513832986f},
-std::array<float,2>{0.101875119f, 0.275720268f},
-std::array<float,2>{0.117727503f, 0.762254298f},
-std::array<float,2>{0.996173322f, 0.192994773f},
-std::array<float,2>{0.649891138f, 0.537863135f},
-std::array<float,2>{0.371895522f, 0.284347057f},
-std::array<float,2>{0.482736319f, 0.659369111f},
-std::array<float,2>{0.534483373f, 0.407219827f},
-std::array<float,2>{0.786194026f, 0.888991714f},
-std::array<float,2>{0.199722424f, 0.0519546866f},
-std::array<float,2>{0.170356676f, 0.610378504f},
-std::array<float,2>{0.87484324f, 0.350415587f},
-std::array<float,2>{0.563377917f, 0.818392217f},
-std::array<float,2>{0.416659594f, 0.136916712f},
-std::array<float,2>{0.260232449f, 0.969995975f},
-std::array<float,2>{0.728167534f, 0.10939505f},
-std::array<float,2>{0.916999042f, 0.706575453f},
-std::array<float,2>{0.0330011845f, 0.437911868f},
-std::array<float,2>{0.24327293f, 0.913928926f},
-std::array<float,2>{0.769892454f, 0.0268514659f},
-std::array<float,2>{0.514713705f, 0.629393756f},
-std::array<float,2>{0.466149032f, 0.397432774f},
-std::array<float,2>{0.3195737f, 0.529573441f},
-std::array<float,2>{0.666793942f, 0.25964281f},
-std::array<float,2>{0.967662811f, 0.811584711f},
-std::array<float,2>{0.0932868198f, 0.24597533f},
-std::array<float,2>{0.00290903426f, 0.740920424f},
-std::array<float,2>{0.903530836f, 0.474529117f},
-std::array<float,2>{0.714354396f, 0.958761394f},
-std::array<float,2>{0.305843502f, 0.0911049768f},
-std::array<float,2>{0.3936961f, 0.863339365f},
-std::array<float,2>{0.617930472f, 0.158792749f},
-std::array<float,2>{0.833179772f, 0.591763616f},
-std::array<float,2>{0.128433049f, 0.330041826f},
-std::array<float,2>{0.162318036f, 0.773491979f},
-std::array<float,2>{0.860873103f, 0.215250984f},
-std::array<float,2>{0.577860653f, 0.56086576f},
-std::array<float,2>{0.412806928f, 0.303534091f},
-std::array<float,2>{0.252697289f, 0.684243381f},
-std::array<float,2>{0.719165385f, 0.433093101f},
-std::array<float,2>{0.91191411f, 0.898228943f},
-std::array<float,2>{0.0406454615f, 0.0321195871f},
-std::array<float,2>{0.114359356f, 0.598157525f},
-std::array<float,2>{0.987277389f, 0.360114396f},
-std::array<float,2>{0.646639287f, 0.82923764f},
-std::array<float,2>{0.360706985f, 0.151437581f},
-std::array<float,2>{0.474242687f, 0.993052661f},
-std::array<float,2>{0.541133046f, 0.10080222f},
-std::array<float,2>{0.79277879f, 0.693297982f},
-std::array<float,2>{0.194187477f, 0.458934218f},
-std::array<float,2>{0.0148214679f, 0.923523128f},
-std::array<float,2>{0.896015167f, 0.00245465734f},
-std::array<float,2>{0.706500351f, 0.642896175f},
-std::array<float,2>{0.300286651f, 0.387703955f},
-std::array<float,2>{0.405557156f, 0.511246979f},
-std::array<float,2>{0.61268127f, 0.279369801f},
-std::array<float,2>{0.843391716f, 0.788258314f},
-std::array<float,2>{0.137178719f, 0.234207183f},
-std::array<float,2>{0.238731489f, 0.733984768f},
-std::array<float,2>{0.781228125f, 0.491000593f},
-std::array<float,2>{0.500039935f, 0.944385588f},
-std::array<float,2>{0.453397453f, 0.0629561245f},
-std::array<float,2>{0.322619766f, 0.845341742f},
-std::array<float,2>{0.658567071f, 0.181679115f},
-std::array<float,2>{0.959436595f, 0.575108886f},
-std::array<float,2>{0.0814175159f, 0.320111126f},
-std::array<float,2>{0.0631613135f, 0.814001381f},
-std::array<float,2>{0.938331962f, 0.135046482f},
-std::array<float,2>{0.68636775f, 0.6166538f},
-std::array<float,2>{0.341469914f, 0.344220728f},
-std::array<float,2>{0.452791512f, 0.710307777f},
-std::array<float,2>{0.520818353f, 0.441441506f},
-std::array<float,2>{0.755850196f, 0.973272026f},
-std::array<float,2>{0.232318401f, 0.115274593f},
-std::array<float,2>{0.150927365f, 0.532307565f},
-std::array<float,2>{0.822812557f, 0.287778616f},
-std::array<float,2>{0.601780474f, 0.760977626f},
-std::array<float,2>{0.388151318f, 0.187563837f},
-std::array<float,2>{0.284524232f, 0.885596335f},
-std::array<float,2>{0.697911739f, 0.0483622961f},
-std::array<float,2>{0.878568769f, 0.664011478f},
-std::array<float,2>{0.0250915997f, 0.412173539f},
-std::array<float,2>{0.21434395f, 0.956068039f},
-std::array<float,2>{0.800649405f, 0.0885955021f},
-std::array<float,2>{0.549248815f, 0.734401166f},
-std::array<float,2>{0.488531142f, 0.46884644f},
-std::array<float,2>{0.346182793f, 0.589591086f},
-std::array<float,2>{0.635036707f, 0.334298313f},
-std::array<float,2>{0.980162323f, 0.860934198f},
-std::array<float,2>{0.100462452f, 0.162939012f},
-std::array<float,2>{0.0556619652f, 0.625227749f},
-std::array<float,2>{0.925780416f, 0.393066555f},
-std::array<float,2>{0.736058474f, 0.906977296f},
-std::array<float,2>{0.272166103f, 0.0289702397f},
-std::array<float,2>{0.433957785f, 0.807907462f},
-std::array<float,2>{0.588601351f, 0.249437153f},
-std::array<float,2>{0.84944737f, 0.523511648f},
-std::array<float,2>{0.17330949f, 0.26442945f},
-std::array<float,2>{0.220387459f, 0.872386694f},
-std::array<float,2>{0.764103949f, 0.166509092f},
-std::array<float,2>{0.528549969f, 0.580153763f},
-std::array<float,2>{0.443899155f, 0.337322235f},
-std::array<float,2>{0.333284616f, 0.74715656f},
-std::array<float,2>{0.679606795f, 0.483940542f},
-std::array<float,2>{0.945948064f, 0.962994277f},
-std::array<float,2>{0.07203722f, 0.0837433636f},
-std::array<float,2>{0.0177277364f, 0.52207613f},
-std::array<float,2>{0.883832812f, 0.254503876f},
-std::array<float,2>{0.69199264f, 0.80384624f},
-std::array<float,2>{0.28946656f, 0.235426188f},
-std::array<float,2>{0.381891996f, 0.918551028f},
-std::array<float,2>{0.601314306f, 0.0192525685f},
-std::array<float,2>{0.819149435f, 0.640484035f},
-std::array<float,2>{0.140713155f, 0.40091458f},
-std::array<float,2>{0.106557339f, 0.977419138f},
-std::array<float,2>{0.973663032f, 0.124676056f},
-std::array<float,2>{0.626055419f, 0.717236161f},
-std::array<float,2>{0.352016687f, 0.450780451f},
-std::array<float,2>{0.498461604f, 0.619573116f},
-std::array<float,2>{0.558604181f, 0.355768293f},
-std::array<float,2>{0.809782863f, 0.820475578f},
-std::array<float,2>{0.207335606f, 0.125573903f},
-std::array<float,2>{0.186767355f, 0.670819223f},
-std::array<float,2>{0.856224835f, 0.417019963f},
-std::array<float,2>{0.585101128f, 0.876189053f},
-std::array<float,2>{0.426468968f, 0.0578667223f},
-std::array<float,2>{0.279341221f, 0.752751946f},
-std::array<float,2>{0.745339334f, 0.200838342f},
-std::array<float,2>{0.934176266f, 0.540307641f},
-std::array<float,2>{0.0536346622f, 0.29373464f},
-std::array<float,2>{0.0361467525f, 0.792193174f},
-std::array<float,2>{0.920435786f, 0.220364913f},
-std::array<float,2>{0.731243551f, 0.501783013f},
-std::array<float,2>{0.264848799f, 0.269715309f},
-std::array<float,2>{0.420725316f, 0.652619362f},
-std::array<float,2>{0.567840099f, 0.379026353f},
-std::array<float,2>{0.868175149f, 0.933190823f},
-std::array<float,2>{0.166727901f, 0.0140990559f},
-std::array<float,2>{0.196577176f, 0.569969594f},
-std::array<float,2>{0.781907201f, 0.32664144f},
-std::array<float,2>{0.536195219f, 0.85261178f},
-std::array<float,2>{0.477244318f, 0.175328031f},
-std::array<float,2>{0.369145125f, 0.950653315f},
-std::array<float,2>{0.654950261f, 0.0712944269f},
-std::array<float,2>{0.994230747f, 0.720440328f},
-std::array<float,2>{0.123142481f, 0.49231866f},
-std::array<float,2>{0.131301716f, 0.902621865f},
-std::array<float,2>{0.828532398f, 0.042384468f},
-std::array<float,2>{0.622863173f, 0.673336267f},
-std::array<float,2>{0.39680168f, 0.429288357f},
-std::array<float,2>{0.308700234f, 0.551585734f},
-std::array<float,2>{0.717786908f, 0.308660269f},
-std::array<float,2>{0.899573147f, 0.767305791f},
-std::array<float,2>{0.00671951286f, 0.207199678f},
-std::array<float,2>{0.0893564224f, 0.701808929f},
-std::array<float,2>{0.961102784f, 0.465699673f},
-std::array<float,2>{0.668772221f, 0.991977155f},
-std::array<float,2>{0.314207762f, 0.108372003f},
-std::array<float,2>{0.461424112f, 0.83765763f},
-std::array<float,2>{0.508229554f, 0.143982232f},
-std::array<float,2>{0.768609107f, 0.604760706f},
-std::array<float,2>{0.247256905f, 0.374976099f},
-std::array<float,2>{0.218578815f, 0.771258295f},
-std::array<float,2>{0.800909758f, 0.204485506f},
-std::array<float,2>{0.551250517f, 0.550419748f},
-std::array<float,2>{0.48534441f, 0.307381749f},
-std::array<float,2>{0.350018024f, 0.676285267f},
-std::array<float,2>{0.64048034f, 0.423378259f},
-std::array<float,2>{0.982738256f, 0.899100542f},
-std::array<float,2>{0.0975549668f, 0.0466830246f},
-std::array<float,2>{0.0586787015f, 0.607334852f},
-std::array<float,2>{0.927937806f, 0.369594187f},
-std::array<float,2>{0.742084205f, 0.842939913f},
-std::array<float,2>{0.26714018f, 0.144782752f},
-std::array<float,2>{0.432361126f, 0.985436022f},
-std::array<float,2>{0.59249872f, 0.10542801f},
-std::array<float,2>{0.844569981f, 0.698412836f},
-std::array<float,2>{0.176151261f, 0.463521659f},
-std::array<float,2>{0.068451263f, 0.935674787f},
-std::array<float,2>{0.941837311f, 0.00905840937f},
-std::array<float,2>{0.681944728f, 0.649950385f},
-std::array<float,2>{0.337538749f, 0.376095474f},
-std::array<float,2>{0.44784829f, 0.505667508f},
-std::array<float,2>{0.517929018f, 0.266321719f},
-std::array<float,2>{0.752421319f, 0.794532895f},
-std::array<float,2>{0.229277536f, 0.223109469f},
-std::array<float,2>{0.155719653f, 0.72487694f},
-std::array<float,2>{0.825300992f, 0.49781242f},
-std::array<float,2>{0.606508374f, 0.947802246f},
-std::array<float,2>{0.3854087f, 0.0774654821f},
-std::array<float,2>{0.285622567f, 0.857654154f},
-std::array<float,2>{0.699837327f, 0.17643559f},
-std::array<float,2>{0.882130682f, 0.564576089f},
-std::array<float,2>{0.0304698423f, 0.321219444f},
-std::array<float,2>{0.0104891993f, 0.826732993f},
-std::array<float,2>{0.893005729f, 0.131948665f},
-std::array<float,2>{0.710134268f, 0.622953475f},
-std::array<float,2>{0.303182214f, 0.352385044f},
-std::array<float,2>{0.399295688f, 0.711050749f},
-std::array<float,2>{0.615882099f, 0.447069526f},
-std::array<float,2>{0.837642312f, 0.983190775f},
-std::array<float,2>{0.135622114f, 0.119324163f},
-std::array<float,2>{0.235235363f, 0.54649806f},
-std::array<float,2>{0.776842356f, 0.289525658f},
-std::array<float,2>{0.507586539f, 0.755733192f},
-std::array<float,2>{0.458492965f, 0.199089751f},
-std::array<float,2>{0.326715887f, 0.879125237f},
-std::array<float,2>{0.661554396f, 0.058771573f},
-std::array<float,2>{0.954132557f, 0.667894363f},
-std::array<float,2>{0.0827406719f, 0.419566065f},
-std::array<float,2>{0.159527466f, 0.966720641f},
-std::array<float,2>{0.864106119f, 0.0809706673f},
-std::array<float,2>{0.572730064f, 0.744494498f},
-std::array<float,2>{0.40633297f, 0.476727724f},
-std::array<float,2>{0.255185276f, 0.584081709f},
-std::array<float,2>{0.725182056f, 0.341854483f},
-std::array<float,2>{0.909434259f, 0.870885611f},
-std::array<float,2>{0.0452934913f, 0.17080839f},
-std::array<float,2>{0.112724856f, 0.636061132f},
-std::array<float,2>{0.991964936f, 0.405214369f},
-std::array<float,2>{0.641945839f, 0.915487766f},
-std::array<float,2>{0.364921331f, 0.0229490045f},
-std::array<float,2>{0.470446765f, 0.80031687f},
-std::array<float,2>{0.545099318f, 0.239536539f},
-std::array<float,2>{0.795845747f, 0.518312454f},
-std::array<float,2>{0.191329941f, 0.250098616f},
-std::array<float,2>{0.12728323f, 0.866244376f},
-std::array<float,2>{0.832965672f, 0.15678443f},
-std::array<float,2>{0.61905396f, 0.592573047f},
-std::array<float,2>{0.392979056f, 0.331896156f},
-std::array<float,2>{0.305654854f, 0.739427626f},
-std::array<float,2>{0.71335876f, 0.475399703f},
-std::array<float,2>{0.902891576f, 0.96079421f},
-std::array<float,2>{0.00364772254f, 0.0922766179f},
-std::array<float,2>{0.0927070081f, 0.529160559f},
-std::array<float,2>{0.968514621f, 0.260987699f},
-std::array<float,2>{0.666996837f, 0.809617102f},
-std::array<float,2>{0.318576664f, 0.242766783f},
-std::array<float,2>{0.464877903f, 0.910182059f},
-std::array<float,2>{0.513688445f, 0.0243897866f},
-std::array<float,2>{0.770942748f, 0.631644845f},
-std::array<float,2>{0.242880359f, 0.395330489f},
-std::array<float,2>{0.0317492262f, 0.971417069f},
-std::array<float,2>{0.916495144f, 0.112119712f},
-std::array<float,2>{0.726585627f, 0.705062449f},
-std::array<float,2>{0.26109156f, 0.440073311f},
-std::array<float,2>{0.417618304f, 0.611450255f},
-std::array<float,2>{0.56416285f, 0.347915828f},
-std::array<float,2>{0.873799562f, 0.817544699f},
-std::array<float,2>{0.171830401f, 0.139237896f},
-std::array<float,2>{0.200803369f, 0.656925559f},
-std::array<float,2>{0.78567034f, 0.408218414f},
-std::array<float,2>{0.53396529f, 0.888532519f},
-std::array<float,2>{0.483812511f, 0.0537578315f},
-std::array<float,2>{0.372807741f, 0.764703453f},
-std::array<float,2>{0.649078906f, 0.19484055f},
-std::array<float,2>{0.997849584f, 0.535166979f},
-std::array<float,2>{0.11848934f, 0.282598197f},
-std::array<float,2>{0.10269352f, 0.781251371f},
-std::array<float,2>{0.971072555f, 0.229578376f},
-std::array<float,2>{0.628975987f, 0.511852801f},
-std::array<float,2>{0.357264549f, 0.275355577f},
-std::array<float,2>{0.493914127f, 0.645507991f},
-std::array<float,2>{0.556673229f, 0.385208786f},
-std::array<float,2>{0.807170928f, 0.929006815f},
-std::array<float,2>{0.206869319f, 0.00673132343f},
-std::array<float,2>{0.181897819f, 0.572441518f},
-std::array<float,2>{0.852759421f, 0.315169305f},
-std::array<float,2>{0.580209434f, 0.847703576f},
-std::array<float,2>{0.422169775f, 0.185835943f},
-std::array<float,2>{0.274567813f, 0.939135671f},
-std::array<float,2>{0.748580754f, 0.0695336685f},
-std::array<float,2>{0.931242824f, 0.730361581f},
-std::array<float,2>{0.0502195805f, 0.485543489f},
-std::array<float,2>{0.226449013f, 0.894128442f},
-std::array<float,2>{0.758457124f, 0.0361541137f},
-std::array<float,2>{0.525000334f, 0.68082875f},
-std::array<float,2>{0.439014524f, 0.435242355f},
-std::array<float,2>{0.331853479f, 0.557569683f},
-std::array<float,2>{0.671876609f, 0.296956778f},
-std::array<float,2>{0.950546861f, 0.778107941f},
-std::array<float,2>{0.0775027052f, 0.212468967f},
-std::array<float,2>{0.0196366068f, 0.689951658f},
-std::array<float,2>{0.890467167f, 0.455410719f},
-std::array<float,2>{0.688883901f, 0.998774529f},
-std::array<float,2>{0.295292646f, 0.0945849717f},
-std::array<float,2>{0.378082335f, 0.833013117f},
-std::array<float,2>{0.59757781f, 0.154508471f},
-std::array<float,2>{0.815358222f, 0.594949841f},
-std::array<float,2>{0.145771205f, 0.365334243f},
-std::array<float,2>{0.172053888f, 0.806207478f},
-std::array<float,2>{0.847760737f, 0.246988267f},
-std::array<float,2>{0.589019895f, 0.526266456f},
-std::array<float,2>{0.43505162f, 0.263656765f},
-std::array<float,2>{0.272692442f, 0.62708199f},
-std::array<float,2>{0.734815955f, 0.390856802f},
-std::array<float,2>{0.924353421f, 0.908407688f},
-std::array<float,2>{0.0562013164f, 0.0303297993f},
-std::array<float,2>{0.100607462f, 0.5863868f},
-std::array<float,2>{0.978851795f, 0.33226338f},
-std::array<float,2>{0.636440754f, 0.861889362f},
-std::array<float,2>{0.347256213f, 0.162103236f},
-std::array<float,2>{0.489815027f, 0.953404188f},
-std::array<float,2>{0.55002737f, 0.0864972696f},
-std::array<float,2>{0.79971385f, 0.737049282f},
-std::array<float,2>{0.213233083f, 0.47207135f},
-std::array<float,2>{0.0234830752f, 0.883601427f},
-std::array<float,2>{0.877210736f, 0.0497025773f},
-std::array<float,2>{0.698747694f, 0.661891222f},
-std::array<float,2>{0.283467561f, 0.411398411f},
-std::array<float,2>{0.387329251f, 0.53407073f},
-std::array<float,2>{0.602697372f, 0.285245627f},
-std::array<float,2>{0.823586881f, 0.759507179f},
-std::array<float,2>{0.151895285f, 0.19022505f},
-std::array<float,2>{0.230864793f, 0.708620548f},
-std::array<float,2>{0.754668772f, 0.444899946f},
-std::array<float,2>{0.520041108f, 0.975841522f},
-std::array<float,2>{0.4518556f, 0.114182532f},
-std::array<float,2>{0.340018868f, 0.815997839f},
-std::array<float,2>{0.687284291f, 0.133262217f},
-std::array<float,2>{0.938610196f, 0.615197301f},
-std::array<float,2>{0.0640897676f, 0.346890062f},
-std::array<float,2>{0.0808030367f, 0.846984446f},
-std::array<float,2>{0.960460246f, 0.180007413f},
-std::array<float,2>{0.659627855f, 0.577017963f},
-std::array<float,2>{0.323514998f, 0.317993551f},
-std::array<float,2>{0.454209685f, 0.731919646f},
-std::array<float,2>{0.501686454f, 0.488852143f},
-std::array<float,2>{0.779446006f, 0.942593515f},
-std::array<float,2>{0.239489153f, 0.0649113804f},
-std::array<float,2>{0.137761161f, 0.50824976f},
-std::array<float,2>{0.841964602f, 0.277446538f},
-std::array<float,2>{0.611366391f, 0.785937369f},
-std::array<float,2>{0.404552817f, 0.232299402f},
-std::array<float,2>{0.299513727f, 0.924066305f},
-std::array<float,2>{0.705113411f, 0.00193196337f},
-std::array<float,2>{0.895401597f, 0.642337799f},
-std::array<float,2>{0.0143939191f, 0.389374226f},
-std::array<float,2>{0.195304528f, 0.994519234f},
-std::array<float,2>{0.79118681f, 0.0977565721f},
-std::array<float,2>{0.542844594f, 0.694518805f},
-std::array<float,2>{0.473469734f, 0.459847391f},
-std::array<float,2>{0.360237092f, 0.60066998f},
-std::array<float,2>{0.647703171f, 0.361364365f},
-std::array<float,2>{0.98807925f, 0.830260634f},
-std::array<float,2>{0.114046067f, 0.149480447f},
-std::array<float,2>{0.0391624384f, 0.685997427f},
-std::array<float,2>{0.911047578f, 0.431149155f},
-std::array<float,2>{0.719902217f, 0.89644599f},
-std::array<float,2>{0.253772616f, 0.0344332084f},
-std::array<float,2>{0.413497984f, 0.776411653f},
-std::array<float,2>{0.577123106f, 0.218198851f},
-std::array<float,2>{0.860234559f, 0.559930384f},
-std::array<float,2>{0.16357331f, 0.301625103f},
-std::array<float,2>{0.246284425f, 0.838572741f},
-std::array<float,2>{0.767682552f, 0.140920848f},
-std::array<float,2>{0.509022653f, 0.603307784f},
-std::array<float,2>{0.462248653f, 0.372524589f},
-std::array<float,2>{0.312516332f, 0.699656904f},
-std::array<float,2>{0.669885814f, 0.468116939f},
-std::array<float,2>{0.962735713f, 0.988624394f},
-std::array<float,2>{0.0879027918f, 0.105998106f},
-std::array<float,2>{0.00759721268f, 0.553652644f},
-std::array<float,2>{0.898491025f, 0.311701447f},
-std::array<float,2>{0.717161894f, 0.769346058f},
-std::array<float,2>{0.309837759f, 0.209574386f},
-std::array<float,2>{0.397943377f, 0.905225098f},
-std::array<float,2>{0.62187928f, 0.0403792672f},
-std::array<float,2>{0.829973817f, 0.674854934f},
-std::array<float,2>{0.132728517f, 0.4268969f},
-std::array<float,2>{0.124112926f, 0.952652335f},
-std::array<float,2>{0.996080399f, 0.0726156831f},
-std::array<float,2>{0.655943334f, 0.721466959f},
-std::array<float,2>{0.370372266f, 0.494153798f},
-std::array<float,2>{0.477629632f, 0.566609502f},
-std::array<float,2>{0.535475433f, 0.326108217f},
-std::array<float,2>{0.782442629f, 0.854581296f},
-std::array<float,2>{0.195470378f, 0.173381716f},
-std::array<float,2>{0.167323932f, 0.655799508f},
-std::array<float,2>{0.868121445f, 0.381069779f},
-std::array<float,2>{0.567217648f, 0.930685759f},
-std::array<float,2>{0.421507567f, 0.0118449954f},
-std::array<float,2>{0.263988167f, 0.790621042f},
-std::array<float,2>{0.731613934f, 0.221518919f},
-std::array<float,2>{0.921582878f, 0.502672315f},
-std::array<float,2>{0.035426639f, 0.271861047f},
-std::array<float,2>{0.0537528209f, 0.751087785f},
-std::array<float,2>{0.934899807f, 0.202718183f},
-std::array<float,2>{0.74495244f, 0.54185307f},
-std::array<float,2>{0.280812919f, 0.295018405f},
-std::array<float,2>{0.427306473f, 0.668728292f},
-std::array<float,2>{0.584135592f, 0.41584298f},
-std::array<float,2>{0.857243001f, 0.877735317f},
-std::array<float,2>{0.186193049f, 0.0551267639f},
-std::array<float,2>{0.208458483f, 0.618784249f},
-std::array<float,2>{0.809059978f, 0.358265847f},
-std::array<float,2>{0.559949219f, 0.822501004f},
-std::array<float,2>{0.499923497f, 0.127444133f},
-std::array<float,2>{0.353409916f, 0.980371654f},
-std::array<float,2>{0.62554127f, 0.121240877f},
-std::array<float,2>{0.972935081f, 0.714946687f},
-std::array<float,2>{0.105560996f, 0.451548547f},
-std::array<float,2>{0.141749695f, 0.92134881f},
-std::array<float,2>{0.819870293f, 0.0156975724f},
-std::array<float,2>{0.59973681f, 0.637049377f},
-std::array<float,2>{0.38107115f, 0.400146276f},
-std::array<float,2>{0.290935934f, 0.51974982f},
-std::array<float,2>{0.692414463f, 0.256818414f},
-std::array<float,2>{0.883540213f, 0.802329779f},
-std::array<float,2>{0.0187870339f, 0.236867413f},
-std::array<float,2>{0.0706590712f, 0.74948436f},
-std::array<float,2>{0.947093844f, 0.481498361f},
-std::array<float,2>{0.678410709f, 0.961974204f},
-std::array<float,2>{0.332882971f, 0.0849355459f},
-std::array<float,2>{0.444628656f, 0.873224854f},
-std::array<float,2>{0.528230309f, 0.165281415f},
-std::array<float,2>{0.765511572f, 0.579927683f},
-std::array<float,2>{0.21911256f, 0.338460326f},
-std::array<float,2>{0.228157908f, 0.794969261f},
-std::array<float,2>{0.750045657f, 0.226114914f},
-std::array<float,2>{0.51711458f, 0.506582379f},
-std::array<float,2>{0.447257757f, 0.268694639f},
-std::array<float,2>{0.338257462f, 0.651141047f},
-std::array<float,2>{0.679813385f, 0.377809078f},
-std::array<float,2>{0.944627941f, 0.934160888f},
-std::array<float,2>{0.0677169785f, 0.0110760806f},
-std::array<float,2>{0.0277663041f, 0.562919438f},
-std::array<float,2>{0.879965901f, 0.323687136f},
-std::array<float,2>{0.702810466f, 0.856488824f},
-std::array<float,2>{0.288769811f, 0.178473175f},
-std::array<float,2>{0.384470224f, 0.946954072f},
-std::array<float,2>{0.608512878f, 0.074581489f},
-std::array<float,2>{0.827282608f, 0.723081231f},
-std::array<float,2>{0.153270394f, 0.499378085f},
-std::array<float,2>{0.0942615792f, 0.900483549f},
-std::array<float,2>{0.981995583f, 0.0438989364f},
-std::array<float,2>{0.637542069f, 0.679134727f},
-std::array<float,2>{0.347656876f, 0.424998224f},
-std::array<float,2>{0.487152189f, 0.548563182f},
-std::array<float,2>{0.55311811f, 0.306413889f},
-std::array<float,2>{0.80414784f, 0.772888601f},
-std::array<float,2>{0.215286657f, 0.207023129f},
-std::array<float,2>{0.178118974f, 0.695745289f},
-std::array<float,2>{0.846200943f, 0.462343693f},
-std::array<float,2>{0.591175914f, 0.987143219f},
-std::array<float,2>{0.429867923f, 0.103405826f},
-std::array<float,2>{0.268095523f, 0.841504574f},
-std::array<float,2>{0.740157127f, 0.148258522f},
-std::array<float,2>{0.925828874f, 0.608489156f},
-std::array<float,2>{0.062323831f, 0.36744985f},
-std::array<float,2>{0.0447922647f, 0.868944585f},
-std::array<float,2>{0.907316089f, 0.169329599f},
-std::array<float,2>{0.722824931f, 0.582258701f},
-std::array<float,2>{0.256541103f, 0.340353221f},
-std::array<float,2>{0.409623384f, 0.742206156f},
-std::array<float,2>{0.571555197f, 0.480463803f},
-std::array<float,2>{0.866322339f, 0.968115449f},
-std::array<float,2>{0.157887951f, 0.0791996717f},
-std::array<float,2>{0.188239217f, 0.516849577f},
-std::array<float,2>{0.794151545f, 0.253076822f},
-std::array<float,2>{0.543936789f, 0.798266292f},
-std::array<float,2>{0.471428394f, 0.240664706f},
-std::array<float,2>{0.366592646f, 0.917237043f},
-std::array<float,2>{0.644208014f, 0.0197892636f},
-std::array<float,2>{0.988451719f, 0.633025885f},
-std::array<float,2>{0.110900499f, 0.402702063f},
-std::array<float,2>{0.13399455f, 0.980590343f},
-std::array<float,2>{0.8383286f, 0.117329277f},
-std::array<float,2>{0.614850283f, 0.713221371f},
-std::array<float,2>{0.40091148f, 0.447476685f},
-std::array<float,2>{0.302623689f, 0.623243213f},
-std::array<float,2>{0.707238317f, 0.353838712f},
-std::array<float,2>{0.891950965f, 0.825645447f},
-std::array<float,2>{0.00954557303f, 0.129287034f},
-std::array<float,2>{0.0857040435f, 0.665944159f},
-std::array<float,2>{0.955801368f, 0.420058876f},
-std::array<float,2>{0.663114071f, 0.881271899f},
-std::array<float,2>{0.32428363f, 0.0608489253f},
-std::array<float,2>{0.459760278f, 0.756830812f},
-std::array<float,2>{0.50476265f, 0.19663243f},
-std::array<float,2>{0.774125576f, 0.543995798f},
-std::array<float,2>{0.237223536f, 0.29192394f},
-std::array<float,2>{0.169911519f, 0.820286632f},
-std::array<float,2>{0.872593522f, 0.138317838f},
-std::array<float,2>{0.564761221f, 0.610206544f},
-std::array<float,2>{0.414462835f, 0.35127449f},
-std::array<float,2>{0.258570462f, 0.705766022f},
-std::array<float,2>{0.729909182f, 0.439434618f},
-std::array<float,2>{0.915953219f, 0.969321132f},
-std::array<float,2>{0.0349274017f, 0.110409498f},
-std::array<float,2>{0.119643062f, 0.53874588f},
-std::array<float,2>{0.998281837f, 0.283767521f},
-std::array<float,2>{0.650544524f, 0.763106048f},
-std::array<float,2>{0.3731758f, 0.191795141f},
-std::array<float,2>{0.480697364f, 0.8897596f},
-std::array<float,2>{0.532742381f, 0.0510259047f},
-std::array<float,2>{0.787801564f, 0.658515334f},
-std::array<float,2>{0.201538146f, 0.407232463f},
-std::array<float,2>{0.00125041476f, 0.957201183f},
-std::array<float,2>{0.905762732f, 0.0906829312f},
-std::array<float,2>{0.711431623f, 0.74193877f},
-std::array<float,2>{0.307886958f, 0.473509371f},
-std::array<float,2>{0.391292483f, 0.590592146f},
-std::array<float,2>{0.621079028f, 0.328150779f},
-std::array<float,2>{0.835883439f, 0.864596486f},
-std::array<float,2>{0.125974f, 0.15947406f},
-std::array<float,2>{0.24591656f, 0.629889429f},
-std::array<float,2>{0.771569729f, 0.397692174f},
-std::array<float,2>{0.511981308f, 0.912719011f},
-std::array<float,2>{0.468380064f, 0.0261533242f},
-std::array<float,2>{0.31745559f, 0.811221719f},
-std::array<float,2>{0.665250897f, 0.244548544f},
-std::array<float,2>{0.965929806f, 0.531071067f},
-std::array<float,2>{0.0916178674f, 0.25862667f},
-std::array<float,2>{0.0747490972f, 0.780859649f},
-std::array<float,2>{0.952198684f, 0.214767903f},
-std::array<float,2>{0.67419225f, 0.555299699f},
-std::array<float,2>{0.328267545f, 0.300649136f},
-std::array<float,2>{0.440176696f, 0.683176935f},
-std::array<float,2>{0.525929034f, 0.43682003f},
-std::array<float,2>{0.760068834f, 0.892340064f},
-std::array<float,2>{0.223421484f, 0.0372590125f},
-std::array<float,2>{0.147970855f, 0.596136034f},
-std::array<float,2>{0.8126266f, 0.365222275f},
-std::array<float,2>{0.594018221f, 0.834506273f},
-std::array<float,2>{0.376380116f, 0.152969703f},
-std::array<float,2>{0.293418944f, 0.997372389f},
-std::array<float,2>{0.691015303f, 0.0961991698f},
-std::array<float,2>{0.888321996f, 0.689150691f},
-std::array<float,2>{0.0217891783f, 0.454835236f},
-std::array<float,2>{0.204191655f, 0.925840259f},
-std::array<float,2>{0.805869758f, 0.00465186266f},
-std::array<float,2>{0.555577397f, 0.648297429f},
-std::array<float,2>{0.494643569f, 0.38463214f},
-std::array<float,2>{0.359182894f, 0.515026093f},
-std::array<float,2>{0.631830513f, 0.277051508f},
-std::array<float,2>{0.968936563f, 0.78515178f},
-std::array<float,2>{0.103769407f, 0.228162125f},
-std::array<float,2>{0.0478230938f, 0.727321327f},
-std::array<float,2>{0.93238008f, 0.48728174f},
-std::array<float,2>{0.747369409f, 0.940018117f},
-std::array<float,2>{0.276506007f, 0.066436924f},
-std::array<float,2>{0.425345093f, 0.851147413f},
-std::array<float,2>{0.580074251f, 0.184173048f},
-std::array<float,2>{0.854036093f, 0.57130909f},
-std::array<float,2>{0.17992644f, 0.312693626f},
-std::array<float,2>{0.149212167f, 0.759816706f},
-std::array<float,2>{0.821937084f, 0.188590601f},
-std::array<float,2>{0.605383039f, 0.53131628f},
-std::array<float,2>{0.388778538f, 0.28869158f},
-std::array<float,2>{0.282600343f, 0.662277997f},
-std::array<float,2>{0.697158396f, 0.413507313f},
-std::array<float,2>{0.876472652f, 0.886128187f},
-std::array<float,2>{0.0256887823f, 0.0471377522f},
-std::array<float,2>{0.0663123801f, 0.616188467f},
-std::array<float,2>{0.940737307f, 0.345109224f},
-std::array<float,2>{0.685193896f, 0.813253105f},
-std::array<float,2>{0.342120558f, 0.136378229f},
-std::array<float,2>{0.449931562f, 0.974160433f},
-std::array<float,2>{0.52320087f, 0.116780736f},
-std::array<float,2>{0.755903244f, 0.709565222f},
-std::array<float,2>{0.233901858f, 0.44260785f},
-std::array<float,2>{0.0584816672f, 0.907809377f},
-std::array<float,2>{0.922220886f, 0.0277665704f},
-std::array<float,2>{0.737691939f, 0.626388073f},
-std::array<float,2>{0.270159811f, 0.394396782f},
-std::array<float,2>{0.437240928f, 0.524878621f},
-std::array<float,2>{0.587714016f, 0.264774531f},
-std::array<float,2>{0.850414336f, 0.807114124f},
-std::array<float,2>{0.17412205f, 0.24805738f},
-std::array<float,2>{0.21141699f, 0.735598087f},
-std::array<float,2>{0.798290431f, 0.46978274f},
-std::array<float,2>{0.548563659f, 0.955165744f},
-std::array<float,2>{0.490578562f, 0.0894374177f},
-std::array<float,2>{0.345323354f, 0.859717846f},
-std::array<float,2>{0.634743094f, 0.163401544f},
-std::array<float,2>{0.978398621f, 0.588808894f},
-std::array<float,2>{0.0995614007f, 0.335766345f},
-std::array<float,2>{0.116346061f, 0.828751683f},
-std::array<float,2>{0.984467566f, 0.150636107f},
-std::array<float,2>{0.644626796f, 0.599001527f},
-std::array<float,2>{0.362190366f, 0.36115405f},
-std::array<float,2>{0.4764615f, 0.692139745f},
-std::array<float,2>{0.540603757f, 0.457460046f},
-std::array<float,2>{0.789468825f, 0.994107008f},
-std::array<float,2>{0.193091646f, 0.099861443f},
-std::array<float,2>{0.160452962f, 0.562173545f},
-std::array<float,2>{0.861798406f, 0.303938866f},
-std::array<float,2>{0.574580133f, 0.774525881f},
-std::array<float,2>{0.411290228f, 0.216742784f},
-std::array<float,2>{0.251747221f, 0.897179067f},
-std::array<float,2>{0.720805883f, 0.0331593677f},
-std::array<float,2>{0.913695693f, 0.685271561f},
-std::array<float,2>{0.0425869972f, 0.431664824f},
-std::array<float,2>{0.24032934f, 0.943815351f},
-std::array<float,2>{0.778023899f, 0.0642579347f},
-std::array<float,2>{0.503346741f, 0.732511938f},
-std::array<float,2>{0.455786258f, 0.492011905f},
-std::array<float,2>{0.320548385f, 0.575686932f},
-std::array<float,2>{0.657007039f, 0.318644166f},
-std::array<float,2>{0.958881319f, 0.844370067f},
-std::array<float,2>{0.0782495961f, 0.18315509f},
-std::array<float,2>{0.0127444193f, 0.643923342f},
-std::array<float,2>{0.896824598f, 0.387678355f},
-std::array<float,2>{0.703870654f, 0.922366798f},
-std::array<float,2>{0.298657924f, 0.00300755422f},
-std::array<float,2>{0.403716207f, 0.787634492f},
-std::array<float,2>{0.610859692f, 0.233269393f},
-std::array<float,2>{0.841188014f, 0.510080934f},
-std::array<float,2>{0.139156863f, 0.280744582f},
-std::array<float,2>{0.198701531f, 0.851923108f},
-std::array<float,2>{0.785040498f, 0.173954368f},
-std::array<float,2>{0.537143648f, 0.568511784f},
-std::array<float,2>{0.478987992f, 0.327657104f},
-std::array<float,2>{0.367508382f, 0.71940881f},
-std::array<float,2>{0.653398752f, 0.493251979f},
-std::array<float,2>{0.993408084f, 0.949279547f},
-std::array<float,2>{0.122140102f, 0.0712072179f},
-std::array<float,2>{0.0381933972f, 0.500631928f},
-std::array<float,2>{0.917995751f, 0.270510525f},
-std::array<float,2>{0.733190715f, 0.791257799f},
-std::array<float,2>{0.26279816f, 0.219524831f},
-std::array<float,2>{0.418036908f, 0.932344317f},
-std::array<float,2>{0.569067299f, 0.0150319329f},
-std::array<float,2>{0.869596243f, 0.65397048f},
-std::array<float,2>{0.164306372f, 0.380405515f},
-std::array<float,2>{0.0860049054f, 0.990731597f},
-std::array<float,2>{0.964235008f, 0.108809173f},
-std::array<float,2>{0.671304584f, 0.702172399f},
-std::array<float,2>{0.315656096f, 0.466795713f},
-std::array<float,2>{0.464122891f, 0.604344249f},
-std::array<float,2>{0.511564672f, 0.373562902f},
-std::array<float,2>{0.766152084f, 0.836200297f},
-std::array<float,2>{0.248945981f, 0.143007979f},
-std::array<float,2>{0.130696148f, 0.671883583f},
-std::array<float,2>{0.830907106f, 0.428660661f},
-std::array<float,2>{0.624602914f, 0.903827488f},
-std::array<float,2>{0.396412969f, 0.0414231457f},
-std::array<float,2>{0.311193883f, 0.765796006f},
-std::array<float,2>{0.715814471f, 0.208530948f},
-std::array<float,2>{0.900823593f, 0.552098453f},
-std::array<float,2>{0.00547779724f, 0.309871644f},
-std::array<float,2>{0.0163132884f, 0.80341959f},
-std::array<float,2>{0.885511994f, 0.234833464f},
-std::array<float,2>{0.693881869f, 0.523177624f},
-std::array<float,2>{0.291635633f, 0.255009115f},
-std::array<float,2>{0.380663961f, 0.638819158f},
-std::array<float,2>{0.599129617f, 0.401825428f},
-std::array<float,2>{0.818272948f, 0.919673026f},
-std::array<float,2>{0.144415721f, 0.0179692209f},
-std::array<float,2>{0.222279146f, 0.581950486f},
-std::array<float,2>{0.762023866f, 0.336271703f},
-std::array<float,2>{0.529828668f, 0.871303737f},
-std::array<float,2>{0.442925632f, 0.167707726f},
-std::array<float,2>{0.333988547f, 0.964421928f},
-std::array<float,2>{0.677022576f, 0.0822350457f},
-std::array<float,2>{0.948663414f, 0.746106982f},
-std::array<float,2>{0.0728924349f, 0.483070046f},
-std::array<float,2>{0.184102654f, 0.875035167f},
-std::array<float,2>{0.857983947f, 0.0574417636f},
-std::array<float,2>{0.582717001f, 0.671218455f},
-std::array<float,2>{0.429354608f, 0.416591078f},
-std::array<float,2>{0.278866142f, 0.539346457f},
-std::array<float,2>{0.743889928f, 0.294423163f},
-std::array<float,2>{0.936998069f, 0.753006995f},
-std::array<float,2>{0.0513586998f, 0.199607179f},
-std::array<float,2>{0.107901372f, 0.717925668f},
-std::array<float,2>{0.974981904f, 0.449984163f},
-std::array<float,2>{0.628081083f, 0.978049695f},
-std::array<float,2>{0.353627324f, 0.123743281f},
-std::array<float,2>{0.497815728f, 0.821421385f},
-std::array<float,2>{0.560935497f, 0.126167178f},
-std::array<float,2>{0.811360121f, 0.620170414f},
-std::array<float,2>{0.210598424f, 0.357180983f},
-std::array<float,2>{0.222715467f, 0.777679861f},
-std::array<float,2>{0.760690391f, 0.212034985f},
-std::array<float,2>{0.525493383f, 0.556645691f},
-std::array<float,2>{0.439845651f, 0.297433406f},
-std::array<float,2>{0.329019189f, 0.681394458f},
-std::array<float,2>{0.674378157f, 0.434635758f},
-std::array<float,2>{0.952877104f, 0.894037724f},
-std::array<float,2>{0.074264057f, 0.0370564796f},
-std::array<float,2>{0.022293184f, 0.595605493f},
-std::array<float,2>{0.88777262f, 0.366020858f},
-std::array<float,2>{0.690468967f, 0.833704054f},
-std::array<float,2>{0.293459088f, 0.154918611f},
-std::array<float,2>{0.376766771f, 0.998512924f},
-std::array<float,2>{0.594308734f, 0.0938490033f},
-std::array<float,2>{0.813265324f, 0.689725578f},
-std::array<float,2>{0.147574157f, 0.455992937f},
-std::array<float,2>{0.104354598f, 0.929578424f},
-std::array<float,2>{0.969339669f, 0.00591465505f},
-std::array<float,2>{0.631118417f, 0.646081746f},
-std::array<float,2>{0.358739316f, 0.385446638f},
-std::array<float,2>{0.494329333f, 0.512633622f},
-std::array<float,2>{0.554982185f, 0.274626613f},
-std::array<float,2>{0.806167483f, 0.782220066f},
-std::array<float,2>{0.204623431f, 0.23044762f},
-std::array<float,2>{0.180596769f, 0.729707301f},
-std::array<float,2>{0.853578746f, 0.485921115f},
-std::array<float,2>{0.579167545f, 0.938569784f},
-std::array<float,2>{0.424878627f, 0.0698686466f},
-std::array<float,2>{0.277288347f, 0.848414898f},
-std::array<float,2>{0.74782908f, 0.186110377f},
-std::array<float,2>{0.931829274f, 0.57313031f},
-std::array<float,2>{0.0471653491f, 0.314757198f},
-std::array<float,2>{0.0342391394f, 0.817936361f},
-std::array<float,2>{0.915134072f, 0.13908276f},
-std::array<float,2>{0.73033005f, 0.61182189f},
-std::array<float,2>{0.257876188f, 0.348582715f},
-std::array<float,2>{0.414573133f, 0.704303324f},
-std::array<float,2>{0.564951122f, 0.439701349f},
-std::array<float,2>{0.872403026f, 0.970719337f},
-std::array<float,2>{0.168977588f, 0.111541979f},
-std::array<float,2>{0.201893896f, 0.5357306f},
-std::array<float,2>{0.787367523f, 0.28276369f},
-std::array<float,2>{0.532509685f, 0.765604913f},
-std::array<float,2>{0.481283009f, 0.19466491f},
-std::array<float,2>{0.373716235f, 0.88811028f},
-std::array<float,2>{0.651323318f, 0.0543811843f},
-std::array<float,2>{0.998879731f, 0.656604707f},
-std::array<float,2>{0.119323604f, 0.409137249f},
-std::array<float,2>{0.12541008f, 0.96023649f},
-std::array<float,2>{0.835172057f, 0.0926297605f},
-std::array<float,2>{0.620246708f, 0.739769161f},
-std::array<float,2>{0.390648216f, 0.474821121f},
-std::array<float,2>{0.308222443f, 0.592192233f},
-std::array<float,2>{0.711384237f, 0.331110626f},
-std::array<float,2>{0.905629933f, 0.86700052f},
-std::array<float,2>{0.0016051979f, 0.156711012f},
-std::array<float,2>{0.0910867527f, 0.631218433f},
-std::array<float,2>{0.966556251f, 0.394732684f},
-std::array<float,2>{0.665939152f, 0.91082567f},
-std::array<float,2>{0.317955405f, 0.0236197319f},
-std::array<float,2>{0.467837662f, 0.810157299f},
-std::array<float,2>{0.512338817f, 0.24243468f},
-std::array<float,2>{0.772329986f, 0.528503716f},
-std::array<float,2>{0.245209306f, 0.261348754f},
-std::array<float,2>{0.157303825f, 0.870569885f},
-std::array<float,2>{0.866963565f, 0.170163289f},
-std::array<float,2>{0.572192609f, 0.584486902f},
-std::array<float,2>{0.410105944f, 0.342675716f},
-std::array<float,2>{0.256293923f, 0.744933963f},
-std::array<float,2>{0.723604441f, 0.477317393f},
-std::array<float,2>{0.908179581f, 0.965866566f},
-std::array<float,2>{0.0441978574f, 0.0801037326f},
-std::array<float,2>{0.11049138f, 0.518022597f},
-std::array<float,2>{0.988879621f, 0.250646114f},
-std::array<float,2>{0.643746734f, 0.80016607f},
-std::array<float,2>{0.367030799f, 0.240141258f},
-std::array<float,2>{0.47099629f, 0.91580236f},
-std::array<float,2>{0.543064356f, 0.0234082155f},
-std::array<float,2>{0.794807673f, 0.636709571f},
-std::array<float,2>{0.187908545f, 0.404607594f},
-std::array<float,2>{0.00882634055f, 0.982898831f},
-std::array<float,2>{0.892233133f, 0.119754083f},
-std::array<float,2>{0.707912445f, 0.711617649f},
-std::array<float,2>{0.302150935f, 0.446533412f},
-std::array<float,2>{0.400414824f, 0.62227267f},
-std::array<float,2>{0.614525199f, 0.351659596f},
-std::array<float,2>{0.838706195f, 0.826281071f},
-std::array<float,2>{0.134566307f, 0.13246429f},
-std::array<float,2>{0.23634249f, 0.66708523f},
-std::array<float,2>{0.773628771f, 0.41916728f},
-std::array<float,2>{0.504360616f, 0.879426658f},
-std::array<float,2>{0.459419131f, 0.0594402328f},
-std::array<float,2>{0.324754387f, 0.754899442f},
-std::array<float,2>{0.663883507f, 0.198465139f},
-std::array<float,2>{0.95547998f, 0.545964718f},
-std::array<float,2>{0.0852562115f, 0.289719284f},
-std::array<float,2>{0.0679352134f, 0.794112802f},
-std::array<float,2>{0.945182145f, 0.223477826f},
-std::array<float,2>{0.680282593f, 0.505043924f},
-std::array<float,2>{0.338866621f, 0.265751839f},
-std::array<float,2>{0.44653368f, 0.649647474f},
-std::array<float,2>{0.51697886f, 0.376692891f},
-std::array<float,2>{0.750956416f, 0.936373174f},
-std::array<float,2>{0.227933422f, 0.00939241145f},
-std::array<float,2>{0.152358681f, 0.564984381f},
-std::array<float,2>{0.827880085f, 0.320529759f},
-std::array<float,2>{0.609279335f, 0.858089209f},
-std::array<float,2>{0.384002239f, 0.176004976f},
-std::array<float,2>{0.288456291f, 0.947557747f},
-std::array<float,2>{0.70219487f, 0.0779235289f},
-std::array<float,2>{0.880520701f, 0.725111723f},
-std::array<float,2>{0.027965609f, 0.497135341f},
-std::array<float,2>{0.215420261f, 0.898452044f},
-std::array<float,2>{0.804630578f, 0.0460405946f},
-std::array<float,2>{0.553568423f, 0.676211774f},
-std::array<float,2>{0.48669377f, 0.422935992f},
-std::array<float,2>{0.348355651f, 0.550078154f},
-std::array<float,2>{0.636834204f, 0.306702673f},
-std::array<float,2>{0.981604218f, 0.770718157f},
-std::array<float,2>{0.0941238925f, 0.204841107f},
-std::array<float,2>{0.0618357733f, 0.698864162f},
-std::array<float,2>{0.92637068f, 0.462925434f},
-std::array<float,2>{0.739586353f, 0.986148238f},
-std::array<float,2>{0.267719179f, 0.10495887f},
-std::array<float,2>{0.430611491f, 0.843455851f},
-std::array<float,2>{0.591377735f, 0.14532499f},
-std::array<float,2>{0.846130371f, 0.606748283f},
-std::array<float,2>{0.178387269f, 0.370061249f},
-std::array<float,2>{0.14379485f, 0.801777542f},
-std::array<float,2>{0.817637146f, 0.236416847f},
-std::array<float,2>{0.599077702f, 0.520184815f},
-std::array<float,2>{0.380033642f, 0.256265938f},
-std::array<float,2>{0.291058868f, 0.637354493f},
-std::array<float,2>{0.693430185f, 0.399755299f},
-std::array<float,2>{0.885118544f, 0.921769023f},
-std::array<float,2>{0.0159964059f, 0.0161565579f},
-std::array<float,2>{0.072357364f, 0.57952559f},
-std::array<float,2>{0.948876321f, 0.338292897f},
-std::array<float,2>{0.677676618f, 0.873620033f},
-std::array<float,2>{0.334828496f, 0.165779024f},
-std::array<float,2>{0.442597389f, 0.962414026f},
-std::array<float,2>{0.529408932f, 0.0843086168f},
-std::array<float,2>{0.762492418f, 0.749618888f},
-std::array<float,2>{0.221964851f, 0.482126892f},
-std::array<float,2>{0.0508520976f, 0.877229631f},
-std::array<float,2>{0.937232673f, 0.05523156f},
-std::array<float,2>{0.743273914f, 0.66823101f},
-std::array<float,2>{0.278785497f, 0.415114731f},
-std::array<float,2>{0.42913121f, 0.541464329f},
-std::array<float,2>{0.582364619f, 0.295819074f},
-std::array<float,2>{0.857425988f, 0.751945674f},
-std::array<float,2>{0.18362397f, 0.202632815f},
-std::array<float,2>{0.210140109f, 0.715671718f},
-std::array<float,2>{0.810616851f, 0.451712966f},
-std::array<float,2>{0.561411917f, 0.979666889f},
-std::array<float,2>{0.497237086f, 0.121790394f},
-std::array<float,2>{0.354005784f, 0.823082387f},
-std::array<float,2>{0.628439665f, 0.126987994f},
-std::array<float,2>{0.97533524f, 0.618630111f},
-std::array<float,2>{0.107940637f, 0.357544124f},
-std::array<float,2>{0.122796729f, 0.855143607f},
-std::array<float,2>{0.993875921f, 0.172965825f},
-std::array<float,2>{0.65383929f, 0.567337871f},
-std::array<float,2>{0.367889673f, 0.325221896f},
-std::array<float,2>{0.479286432f, 0.721011996f},
-std::array<float,2>{0.537684917f, 0.494634569f},
-std::array<float,2>{0.784212947f, 0.952363908f},
-std::array<float,2>{0.198983818f, 0.0728198066f},
-std::array<float,2>{0.164766967f, 0.50239557f},
-std::array<float,2>{0.869934201f, 0.272250473f},
-std::array<float,2>{0.568752766f, 0.79048115f},
-std::array<float,2>{0.418840647f, 0.220974639f},
-std::array<float,2>{0.263404816f, 0.931163073f},
-std::array<float,2>{0.732506037f, 0.0126480656f},
-std::array<float,2>{0.918618679f, 0.655372262f},
-std::array<float,2>{0.0388466604f, 0.381524622f},
-std::array<float,2>{0.248263642f, 0.988865495f},
-std::array<float,2>{0.76609391f, 0.105735622f},
-std::array<float,2>{0.51074785f, 0.699878216f},
-std::array<float,2>{0.464549333f, 0.468551904f},
-std::array<float,2>{0.316346347f, 0.602992773f},
-std::array<float,2>{0.671668947f, 0.372853488f},
-std::array<float,2>{0.964470506f, 0.83803153f},
-std::array<float,2>{0.0866291448f, 0.141397819f},
-std::array<float,2>{0.00523515791f, 0.675620735f},
-std::array<float,2>{0.901070535f, 0.427652866f},
-std::array<float,2>{0.714970767f, 0.904554725f},
-std::array<float,2>{0.310664922f, 0.0407162458f},
-std::array<float,2>{0.395712376f, 0.768745363f},
-std::array<float,2>{0.624359846f, 0.209104091f},
-std::array<float,2>{0.830204129f, 0.553100169f},
-std::array<float,2>{0.130169436f, 0.312465608f},
-std::array<float,2>{0.192759499f, 0.83093977f},
-std::array<float,2>{0.789593935f, 0.150142968f},
-std::array<float,2>{0.540491402f, 0.601491988f},
-std::array<float,2>{0.475657403f, 0.36194703f},
-std::array<float,2>{0.361506909f, 0.694828331f},
-std::array<float,2>{0.645083427f, 0.45908007f},
-std::array<float,2>{0.985241592f, 0.994865537f},
-std::array<float,2>{0.116849042f, 0.0983741805f},
-std::array<float,2>{0.0420141667f, 0.560361207f},
-std::array<float,2>{0.913480043f, 0.301234156f},
-std::array<float,2>{0.721451223f, 0.777277172f},
-std::array<float,2>{0.25113669f, 0.21871677f},
-std::array<float,2>{0.411962807f, 0.895560026f},
-std::array<float,2>{0.575117111f, 0.034929689f},
-std::array<float,2>{0.862217486f, 0.686305523f},
-std::array<float,2>{0.160999194f, 0.431456685f},
-std::array<float,2>{0.0790945664f, 0.94290787f},
-std::array<float,2>{0.958129644f, 0.0650140196f},
-std::array<float,2>{0.656392038f, 0.73222065f},
-std::array<float,2>{0.321144849f, 0.488418728f},
-std::array<float,2>{0.45537734f, 0.576276183f},
-std::array<float,2>{0.503785729f, 0.317531973f},
-std::array<float,2>{0.777587712f, 0.847470343f},
-std::array<float,2>{0.240963504f, 0.180259049f},
-std::array<float,2>{0.13960968f, 0.641646147f},
-std::array<float,2>{0.841647267f, 0.388920188f},
-std::array<float,2>{0.610550702f, 0.92475611f},
-std::array<float,2>{0.404213011f, 0.00126758777f},
-std::array<float,2>{0.297860295f, 0.785275102f},
-std::array<float,2>{0.703339875f, 0.231551722f},
-std::array<float,2>{0.897081077f, 0.508619249f},
-std::array<float,2>{0.0134980325f, 0.277858198f},
-std::array<float,2>{0.0262908693f, 0.75895077f},
-std::array<float,2>{0.876144886f, 0.189707875f},
-std::array<float,2>{0.696526349f, 0.533592701f},
-std::array<float,2>{0.282776147f, 0.28600952f},
-std::array<float,2>{0.389402181f, 0.661375225f},
-std::array<float,2>{0.604813874f, 0.411931068f},
-std::array<float,2>{0.821293354f, 0.883102953f},
-std::array<float,2>{0.148612574f, 0.0493077114f},
-std::array<float,2>{0.233792633f, 0.614743471f},
-std::array<float,2>{0.756824076f, 0.347180158f},
-std::array<float,2>{0.522631824f, 0.815860987f},
-std::array<float,2>{0.449458122f, 0.133561805f},
-std::array<float,2>{0.342451632f, 0.976471603f},
-std::array<float,2>{0.684984207f, 0.113465004f},
-std::array<float,2>{0.941238165f, 0.708299696f},
-std::array<float,2>{0.0654849485f, 0.444643945f},
-std::array<float,2>{0.174794018f, 0.90909487f},
-std::array<float,2>{0.849896491f, 0.0310718231f},
-std::array<float,2>{0.587112069f, 0.627643704f},
-std::array<float,2>{0.436800003f, 0.391270846f},
-std::array<float,2>{0.269546986f, 0.525461614f},
-std::array<float,2>{0.738126338f, 0.262920916f},
-std::array<float,2>{0.922464252f, 0.805730522f},
-std::array<float,2>{0.0579081476f, 0.246499494f},
-std::array<float,2>{0.0987977311f, 0.736419499f},
-std::array<float,2>{0.977944076f, 0.472506315f},
-std::array<float,2>{0.634197176f, 0.954045236f},
-std::array<float,2>{0.344890714f, 0.0863003135f},
-std::array<float,2>{0.490914404f, 0.86160326f},
-std::array<float,2>{0.548180103f, 0.161408827f},
-std::array<float,2>{0.798743427f, 0.586703658f},
-std::array<float,2>{0.211664945f, 0.332576782f},
-std::array<float,2>{0.206257552f, 0.784654021f},
-std::array<float,2>{0.806850135f, 0.227756917f},
-std::array<float,2>{0.557377517f, 0.515462041f},
-std::array<float,2>{0.493243486f, 0.276384741f},
-std::array<float,2>{0.356544822f, 0.647762835f},
-std::array<float,2>{0.629535794f, 0.383840322f},
-std::array<float,2>{0.971194446f, 0.926339746f},
-std::array<float,2>{0.103262104f, 0.00418866472f},
-std::array<float,2>{0.0505704544f, 0.571811378f},
-std::array<float,2>{0.93068248f, 0.31329456f},
-std::array<float,2>{0.748218954f, 0.851066768f},
-std::array<float,2>{0.27511391f, 0.183888271f},
-std::array<float,2>{0.422540337f, 0.939637959f},
-std::array<float,2>{0.580817759f, 0.0672005117f},
-std::array<float,2>{0.853280962f, 0.727033675f},
-std::array<float,2>{0.182229429f, 0.486418575f},
-std::array<float,2>{0.0779569224f, 0.892033517f},
-std::array<float,2>{0.951138675f, 0.0377707407f},
-std::array<float,2>{0.67241931f, 0.68296653f},
-std::array<float,2>{0.331158727f, 0.437153041f},
-std::array<float,2>{0.438942164f, 0.554802418f},
-std::array<float,2>{0.524787486f, 0.300172478f},
-std::array<float,2>{0.757884681f, 0.780457377f},
-std::array<float,2>{0.225925699f, 0.214085862f},
-std::array<float,2>{0.146209553f, 0.688622236f},
-std::array<float,2>{0.814465165f, 0.454126954f},
-std::array<float,2>{0.596681774f, 0.997874439f},
-std::array<float,2>{0.378577262f, 0.0959596485f},
-std::array<float,2>{0.29585287f, 0.834066153f},
-std::array<float,2>{0.689411104f, 0.152675614f},
-std::array<float,2>{0.889683783f, 0.596316695f},
-std::array<float,2>{0.0205037594f, 0.364528358f},
-std::array<float,2>{0.00294778612f, 0.864974201f},
-std::array<float,2>{0.902421653f, 0.15999116f},
-std::array<float,2>{0.713480711f, 0.590043068f},
-std::array<float,2>{0.305133909f, 0.328920364f},
-std::array<float,2>{0.393185139f, 0.741327107f},
-std::array<float,2>{0.618389487f, 0.472774178f},
-std::array<float,2>{0.832434654f, 0.957526743f},
-std::array<float,2>{0.127712503f, 0.0901107192f},
-std::array<float,2>{0.242581531f, 0.530684352f},
-std::array<float,2>{0.771285534f, 0.258076936f},
-std::array<float,2>{0.514271379f, 0.810854614f},
-std::array<float,2>{0.465333521f, 0.244737789f},
-std::array<float,2>{0.319160551f, 0.912237167f},
-std::array<float,2>{0.667937875f, 0.0254233982f},
-std::array<float,2>{0.968180418f, 0.630795598f},
-std::array<float,2>{0.092140086f, 0.398272306f},
-std::array<float,2>{0.171105668f, 0.968925357f},
-std::array<float,2>{0.873368919f, 0.110927299f},
-std::array<float,2>{0.563901722f, 0.705122054f},
-std::array<float,2>{0.416992575f, 0.438905776f},
-std::array<float,2>{0.261289537f, 0.609673083f},
-std::array<float,2>{0.727408707f, 0.350754112f},
-std::array<float,2>{0.916938186f, 0.819757283f},
-std::array<float,2>{0.0316626132f, 0.138084754f},
-std::array<float,2>{0.119027592f, 0.65879792f},
-std::array<float,2>{0.997364581f, 0.408115923f},
-std::array<float,2>{0.648700476f, 0.890592039f},
-std::array<float,2>{0.372220516f, 0.0514747687f},
-std::array<float,2>{0.483938098f, 0.763371348f},
-std::array<float,2>{0.533506572f, 0.191898152f},
-std::array<float,2>{0.785392225f, 0.538243532f},
-std::array<float,2>{0.200667799f, 0.283572495f},
-std::array<float,2>{0.134950072f, 0.826080501f},
-std::array<float,2>{0.837098479f, 0.129804581f},
-std::array<float,2>{0.615558445f, 0.623939991f},
-std::array<float,2>{0.398850948f, 0.354212284f},
-std::array<float,2>{0.303412348f, 0.713847816f},
-std::array<float,2>{0.710553288f, 0.447802961f},
-std::array<float,2>{0.893162847f, 0.980980873f},
-std::array<float,2>{0.010154577f, 0.117807925f},
-std::array<float,2>{0.0822435394f, 0.544741333f},
-std::array<float,2>{0.954972863f, 0.291460246f},
-std::array<float,2>{0.661705375f, 0.756339908f},
-std::array<float,2>{0.326537848f, 0.197253838f},
-std::array<float,2>{0.458754212f, 0.881558895f},
-std::array<float,2>{0.507023931f, 0.0614666454f},
-std::array<float,2>{0.777269304f, 0.665170491f},
-std::array<float,2>{0.234576389f, 0.420569748f},
-std::array<float,2>{0.045880992f, 0.968651533f},
-std::array<float,2>{0.910051584f, 0.0800315291f},
-std::array<float,2>{0.72488755f, 0.742691219f},
-std::array<float,2>{0.25543794f, 0.479908675f},
-std::array<float,2>{0.407220274f, 0.582572639f},
-std::array<float,2>{0.573109806f, 0.340231776f},
-std::array<float,2>{0.863305748f, 0.868366957f},
-std::array<float,2>{0.159885883f, 0.169711933f},
-std::array<float,2>{0.190447748f, 0.633309126f},
-std::array<float,2>{0.795307755f, 0.402955115f},
-std::array<float,2>{0.545456886f, 0.917824924f},
-std::array<float,2>{0.469961882f, 0.0202123094f},
-std::array<float,2>{0.364628494f, 0.79857415f},
-std::array<float,2>{0.642434895f, 0.240905821f},
-std::array<float,2>{0.991562843f, 0.517488182f},
-std::array<float,2>{0.112899348f, 0.253795892f},
-std::array<float,2>{0.096919544f, 0.773382723f},
-std::array<float,2>{0.983261228f, 0.206289157f},
-std::array<float,2>{0.640010178f, 0.548188925f},
-std::array<float,2>{0.350158453f, 0.305968255f},
-std::array<float,2>{0.484727532f, 0.679224074f},
-std::array<float,2>{0.551473737f, 0.425461382f},
-std::array<float,2>{0.801414728f, 0.90114069f},
-std::array<float,2>{0.218006745f, 0.0430995561f},
-std::array<float,2>{0.176652744f, 0.609207094f},
-std::array<float,2>{0.843928337f, 0.367898583f},
-std::array<float,2>{0.592221975f, 0.840966463f},
-std::array<float,2>{0.431703299f, 0.147750467f},
-std::array<float,2>{0.266695231f, 0.986526847f},
-std::array<float,2>{0.741352558f, 0.102571078f},
-std::array<float,2>{0.928377092f, 0.695825398f},
-std::array<float,2>{0.059170302f, 0.462653667f},
-std::array<float,2>{0.228727698f, 0.933760345f},
-std::array<float,2>{0.75272882f, 0.0115681086f},
-std::array<float,2>{0.518258393f, 0.650838852f},
-std::array<float,2>{0.447567731f, 0.377216607f},
-std::array<float,2>{0.33701086f, 0.505904317f},
-std::array<float,2>{0.682211339f, 0.269128382f},
-std::array<float,2>{0.942051649f, 0.795450211f},
-std::array<float,2>{0.068860054f, 0.225827202f},
-std::array<float,2>{0.0310613811f, 0.723304391f},
-std::array<float,2>{0.88253665f, 0.499811828f},
-std::array<float,2>{0.699236333f, 0.946440697f},
-std::array<float,2>{0.286057115f, 0.0750417262f},
-std::array<float,2>{0.385181636f, 0.857220411f},
-std::array<float,2>{0.607371449f, 0.178204745f},
-std::array<float,2>{0.825932801f, 0.563245118f},
-std::array<float,2>{0.156159565f, 0.323830783f},
-std::array<float,2>{0.185997143f, 0.753441155f},
-std::array<float,2>{0.856643379f, 0.199836031f},
-std::array<float,2>{0.584542215f, 0.539949596f},
-std::array<float,2>{0.42700547f, 0.294479966f},
-std::array<float,2>{0.2806651f, 0.671783984f},
-std::array<float,2>{0.744206846f, 0.416107774f},
-std::array<float,2>{0.935408711f, 0.875727534f},
-std::array<float,2>{0.0545288026f, 0.05690635f},
-std::array<float,2>{0.105996422f, 0.62076056f},
-std::array<float,2>{0.973464429f, 0.356644452f},
-std::array<float,2>{0.625425994f, 0.822128415f},
-std::array<float,2>{0.352767915f, 0.126595259f},
-std::array<float,2>{0.499209672f, 0.977961838f},
-std::array<float,2>{0.560208023f, 0.12321087f},
-std::array<float,2>{0.809103727f, 0.718468308f},
-std::array<float,2>{0.208714232f, 0.44955492f},
-std::array<float,2>{0.0192143656f, 0.919387639f},
-std::array<float,2>{0.883262217f, 0.018134322f},
-std::array<float,2>{0.692907751f, 0.639227271f},
-std::array<float,2>{0.290387452f, 0.402068317f},
-std::array<float,2>{0.381357014f, 0.522798777f},
-std::array<float,2>{0.600472093f, 0.255616963f},
-std::array<float,2>{0.819694102f, 0.802858949f},
-std::array<float,2>{0.142103598f, 0.235183835f},
-std::array<float,2>{0.219653696f, 0.747067928f},
-std::array<float,2>{0.764904737f, 0.482476443f},
-std::array<float,2>{0.527629793f, 0.963957965f},
-std::array<float,2>{0.445052862f, 0.0829301476f},
-std::array<float,2>{0.332442135f, 0.87196064f},
-std::array<float,2>{0.678150296f, 0.167227522f},
-std::array<float,2>{0.946555853f, 0.581399202f},
-std::array<float,2>{0.0712344944f, 0.336886615f},
-std::array<float,2>{0.0888371691f, 0.836503506f},
-std::array<float,2>{0.962003052f, 0.143523991f},
-std::array<float,2>{0.668957353f, 0.603867054f},
-std::array<float,2>{0.313371539f, 0.373077154f},
-std::array<float,2>{0.462690443f, 0.703112543f},
-std::array<float,2>{0.509667039f, 0.466264009f},
-std::array<float,2>{0.768087447f, 0.990325391f},
-std::array<float,2>{0.246970639f, 0.109092094f},
-std::array<float,2>{0.132069439f, 0.552510023f},
-std::array<float,2>{0.829376578f, 0.310140371f},
-std::array<float,2>{0.621485233f, 0.766498089f},
-std::array<float,2>{0.398281246f, 0.208063275f},
-std::array<float,2>{0.310447872f, 0.903637886f},
-std::array<float,2>{0.717527628f, 0.0417444222f},
-std::array<float,2>{0.899331093f, 0.672843993f},
-std::array<float,2>{0.00687716296f, 0.427982658f},
-std::array<float,2>{0.196092755f, 0.949911654f},
-std::array<float,2>{0.782777965f, 0.0707339421f},
-std::array<float,2>{0.535806119f, 0.719186962f},
-std::array<float,2>{0.478159279f, 0.493801147f},
-std::array<float,2>{0.370743126f, 0.569036782f},
-std::array<float,2>{0.655416429f, 0.327628821f},
-std::array<float,2>{0.995441675f, 0.852282941f},
-std::array<float,2>{0.124950126f, 0.17476359f},
-std::array<float,2>{0.0358513482f, 0.653419256f},
-std::array<float,2>{0.921299398f, 0.379919976f},
-std::array<float,2>{0.732002378f, 0.931715488f},
-std::array<float,2>{0.264276952f, 0.0152545404f},
-std::array<float,2>{0.420961231f, 0.791650891f},
-std::array<float,2>{0.566444933f, 0.218856975f},
-std::array<float,2>{0.867597699f, 0.500011742f},
-std::array<float,2>{0.167875469f, 0.271472931f},
-std::array<float,2>{0.240129843f, 0.844046772f},
-std::array<float,2>{0.780078888f, 0.182872742f},
-std::array<float,2>{0.501237869f, 0.575350046f},
-std::array<float,2>{0.45480901f, 0.319256902f},
-std::array<float,2>{0.324202657f, 0.732973874f},
-std::array<float,2>{0.659783363f, 0.491487533f},
-std::array<float,2>{0.960048616f, 0.944042563f},
-std::array<float,2>{0.080294095f, 0.0636200532f},
-std::array<float,2>{0.0137894629f, 0.510718942f},
-std::array<float,2>{0.894771934f, 0.281076193f},
-std::array<float,2>{0.70592767f, 0.787302852f},
-std::array<float,2>{0.299086541f, 0.232517421f},
-std::array<float,2>{0.404871523f, 0.922162354f},
-std::array<float,2>{0.612244785f, 0.00351832388f},
-std::array<float,2>{0.842725694f, 0.644313872f},
-std::array<float,2>{0.138302818f, 0.387037784f},
-std::array<float,2>{0.113646694f, 0.99355638f},
-std::array<float,2>{0.987653077f, 0.100098729f},
-std::array<float,2>{0.648028374f, 0.69146347f},
-std::array<float,2>{0.359807074f, 0.457696617f},
-std::array<float,2>{0.47286132f, 0.599425018f},
-std::array<float,2>{0.542196035f, 0.360522479f},
-std::array<float,2>{0.791764081f, 0.828391254f},
-std::array<float,2>{0.194513991f, 0.151282474f},
-std::array<float,2>{0.16399233f, 0.685045004f},
-std::array<float,2>{0.859472573f, 0.432592094f},
-std::array<float,2>{0.576291382f, 0.896867335f},
-std::array<float,2>{0.414058864f, 0.0326144882f},
-std::array<float,2>{0.25324598f, 0.775302887f},
-std::array<float,2>{0.720668912f, 0.215955675f},
-std::array<float,2>{0.910299718f, 0.561879277f},
-std::array<float,2>{0.0399847962f, 0.304553509f},
-std::array<float,2>{0.0559444912f, 0.807184339f},
-std::array<float,2>{0.923968136f, 0.248648331f},
-std::array<float,2>{0.73533535f, 0.525196731f},
-std::array<float,2>{0.273104995f, 0.265526861f},
-std::array<float,2>{0.435313642f, 0.626606464f},
-std::array<float,2>{0.589480162f, 0.39396736f},
-std::array<float,2>{0.848353446f, 0.907532692f},
-std::array<float,2>{0.172495112f, 0.0283039641f},
-std::array<float,2>{0.213455454f, 0.588176548f},
-std::array<float,2>{0.799183547f, 0.335310698f},
-std::array<float,2>{0.550359607f, 0.860303223f},
-std::array<float,2>{0.489468098f, 0.163763195f},
-std::array<float,2>{0.347101748f, 0.95574373f},
-std::array<float,2>{0.635975122f, 0.0890345201f},
-std::array<float,2>{0.979030907f, 0.7359429f},
-std::array<float,2>{0.101215914f, 0.470587671f},
-std::array<float,2>{0.151525408f, 0.886683941f},
-std::array<float,2>{0.823838413f, 0.047805205f},
-std::array<float,2>{0.603503525f, 0.662974656f},
-std::array<float,2>{0.386798203f, 0.413764209f},
-std::array<float,2>{0.283795834f, 0.532124937f},
-std::array<float,2>{0.698572934f, 0.288189501f},
-std::array<float,2>{0.877604544f, 0.760451496f},
-std::array<float,2>{0.0241692029f, 0.189204365f},
-std::array<float,2>{0.0636317357f, 0.709062099f},
-std::array<float,2>{0.939211845f, 0.44332251f},
-std::array<float,2>{0.686626077f, 0.973867953f},
-std::array<float,2>{0.340543121f, 0.116611987f},
-std::array<float,2>{0.451229453f, 0.812573671f},
-std::array<float,2>{0.519779503f, 0.136066601f},
-std::array<float,2>{0.754205704f, 0.615689635f},
-std::array<float,2>{0.231097609f, 0.345494628f},
-std::array<float,2>{0.199251831f, 0.76426816f},
-std::array<float,2>{0.786748648f, 0.193909377f},
-std::array<float,2>{0.534710348f, 0.537105203f},
-std::array<float,2>{0.483170837f, 0.281745404f},
-std::array<float,2>{0.371199757f, 0.657638729f},
-std::array<float,2>{0.650300682f, 0.409959018f},
-std::array<float,2>{0.99683547f, 0.887028396f},
-std::array<float,2>{0.117432669f, 0.0535142198f},
-std::array<float,2>{0.0325484984f, 0.612730086f},
-std::array<float,2>{0.917927384f, 0.349154145f},
-std::array<float,2>{0.727623284f, 0.816448271f},
-std::array<float,2>{0.260722518f, 0.140340418f},
-std::array<float,2>{0.416142464f, 0.971980155f},
-std::array<float,2>{0.562510908f, 0.112432227f},
-std::array<float,2>{0.874375641f, 0.704060793f},
-std::array<float,2>{0.170468062f, 0.440847397f},
-std::array<float,2>{0.0932424664f, 0.911999524f},
-std::array<float,2>{0.966940939f, 0.025217386f},
-std::array<float,2>{0.666241765f, 0.632362247f},
-std::array<float,2>{0.320241213f, 0.396129519f},
-std::array<float,2>{0.466371596f, 0.527818263f},
-std::array<float,2>{0.515379608f, 0.260393381f},
-std::array<float,2>{0.770356715f, 0.809000313f},
-std::array<float,2>{0.244091839f, 0.244029105f},
-std::array<float,2>{0.128001899f, 0.738982499f},
-std::array<float,2>{0.833818257f, 0.476540297f},
-std::array<float,2>{0.617282689f, 0.959541261f},
-std::array<float,2>{0.39446044f, 0.0934706256f},
-std::array<float,2>{0.306595117f, 0.865246892f},
-std::array<float,2>{0.714428842f, 0.157364011f},
-std::array<float,2>{0.90425396f, 0.593236685f},
-std::array<float,2>{0.00241189497f, 0.330964684f},
-std::array<float,2>{0.0212504845f, 0.832483351f},
-std::array<float,2>{0.889378846f, 0.155624941f},
-std::array<float,2>{0.688139915f, 0.594651937f},
-std::array<float,2>{0.296319813f, 0.36627695f},
-std::array<float,2>{0.377260506f, 0.691039622f},
-std::array<float,2>{0.596168697f, 0.456947833f},
-std::array<float,2>{0.815665305f, 0.999787867f},
-std::array<float,2>{0.145464495f, 0.0952340588f},
-std::array<float,2>{0.22551778f, 0.55804944f},
-std::array<float,2>{0.759678066f, 0.298333764f},
-std::array<float,2>{0.523825884f, 0.778763711f},
-std::array<float,2>{0.438088745f, 0.211209878f},
-std::array<float,2>{0.330687404f, 0.893276691f},
-std::array<float,2>{0.673488498f, 0.0357331f},
-std::array<float,2>{0.949796855f, 0.680155694f},
-std::array<float,2>{0.0771260113f, 0.434027255f},
-std::array<float,2>{0.182704419f, 0.937618673f},
-std::array<float,2>{0.852265f, 0.0692758784f},
-std::array<float,2>{0.581258953f, 0.729410827f},
-std::array<float,2>{0.42329827f, 0.48444891f},
-std::array<float,2>{0.273835927f, 0.57337898f},
-std::array<float,2>{0.749992013f, 0.315719068f},
-std::array<float,2>{0.930588663f, 0.848962069f},
-std::array<float,2>{0.049198918f, 0.187172323f},
-std::array<float,2>{0.102373682f, 0.644569695f},
-std::array<float,2>{0.972494006f, 0.385965377f},
-std::array<float,2>{0.630055964f, 0.928589284f},
-std::array<float,2>{0.356432259f, 0.00770291779f},
-std::array<float,2>{0.492506832f, 0.782761693f},
-std::array<float,2>{0.557726741f, 0.228831887f},
-std::array<float,2>{0.807635903f, 0.513389587f},
-std::array<float,2>{0.205746934f, 0.274199098f},
-std::array<float,2>{0.154604718f, 0.859228432f},
-std::array<float,2>{0.824259222f, 0.177288771f},
-std::array<float,2>{0.605623484f, 0.565684319f},
-std::array<float,2>{0.386029631f, 0.322095692f},
-std::array<float,2>{0.286629111f, 0.72638768f},
-std::array<float,2>{0.701130688f, 0.496813625f},
-std::array<float,2>{0.881792784f, 0.948782921f},
-std::array<float,2>{0.0298501737f, 0.0768813416f},
-std::array<float,2>{0.0697662383f, 0.504564226f},
-std::array<float,2>{0.94321388f, 0.266916454f},
-std::array<float,2>{0.683100343f, 0.793728054f},
-std::array<float,2>{0.336367428f, 0.223974094f},
-std::array<float,2>{0.448463619f, 0.93679136f},
-std::array<float,2>{0.518571377f, 0.00876533333f},
-std::array<float,2>{0.753427804f, 0.649145842f},
-std::array<float,2>{0.230118752f, 0.375497818f},
-std::array<float,2>{0.0600930341f, 0.984638274f},
-std::array<float,2>{0.929483712f, 0.10355749f},
-std::array<float,2>{0.740336657f, 0.697983146f},
-std::array<float,2>{0.266520232f, 0.464570522f},
-std::array<float,2>{0.433139294f, 0.606149018f},
-std::array<float,2>{0.592828214f, 0.370357841f},
-std::array<float,2>{0.845670342f, 0.842660725f},
-std::array<float,2>{0.177375063f, 0.14571254f},
-std::array<float,2>{0.217616662f, 0.677118301f},
-std::array<float,2>{0.801843762f, 0.422735512f},
-std::array<float,2>{0.551891983f, 0.900037169f},
-std::array<float,2>{0.485813528f, 0.0458668135f},
-std::array<float,2>{0.351177603f, 0.770295262f},
-std::array<float,2>{0.639558375f, 0.203335077f},
-std::array<float,2>{0.983411014f, 0.549788475f},
-std::array<float,2>{0.0966495648f, 0.30791238f},
-std::array<float,2>{0.112020217f, 0.799209714f},
-std::array<float,2>{0.990929365f, 0.238496542f},
-std::array<float,2>{0.641309261f, 0.519514441f},
-std::array<float,2>{0.363652855f, 0.251517117f},
-std::array<float,2>{0.468968153f, 0.635278106f},
-std::array<float,2>{0.546297014f, 0.40540266f},
-std::array<float,2>{0.796596229f, 0.914748847f},
-std::array<float,2>{0.190117627f, 0.0218102969f},
-std::array<float,2>{0.158916414f, 0.585219145f},
-std::array<float,2>{0.864298642f, 0.343082458f},
-std::array<float,2>{0.573448241f, 0.869411528f},
-std::array<float,2>{0.407892704f, 0.171843618f},
-std::array<float,2>{0.254047573f, 0.965170979f},
-std::array<float,2>{0.726023078f, 0.0814907104f},
-std::array<float,2>{0.908948362f, 0.745646656f},
-std::array<float,2>{0.0461064093f, 0.477675885f},
-std::array<float,2>{0.235730156f, 0.880262256f},
-std::array<float,2>{0.775903106f, 0.0602331012f},
-std::array<float,2>{0.506767869f, 0.666316628f},
-std::array<float,2>{0.457755119f, 0.418568492f},
-std::array<float,2>{0.327185333f, 0.545385659f},
-std::array<float,2>{0.660189033f, 0.290127039f},
-std::array<float,2>{0.95374167f, 0.753945947f},
-std::array<float,2>{0.0838525593f, 0.197347477f},
-std::array<float,2>{0.0109391641f, 0.711960733f},
-std::array<float,2>{0.894120038f, 0.44580844f},
-std::array<float,2>{0.709590495f, 0.984264255f},
-std::array<float,2>{0.30381009f, 0.12067645f},
-std::array<float,2>{0.400087893f, 0.82718116f},
-std::array<float,2>{0.616303205f, 0.131098017f},
-std::array<float,2>{0.836004674f, 0.621542096f},
-std::array<float,2>{0.136068463f, 0.353204638f},
-std::array<float,2>{0.166336685f, 0.789582133f},
-std::array<float,2>{0.868943036f, 0.222061709f},
-std::array<float,2>{0.567881525f, 0.503878653f},
-std::array<float,2>{0.420074105f, 0.272911847f},
-std::array<float,2>{0.265493035f, 0.655240119f},
-std::array<float,2>{0.730602086f, 0.38206777f},
-std::array<float,2>{0.920028627f, 0.930419743f},
-std::array<float,2>{0.0370032564f, 0.0134195825f},
-std::array<float,2>{0.123607717f, 0.56783843f},
-std::array<float,2>{0.994655013f, 0.324582547f},
-std::array<float,2>{0.654775441f, 0.853637159f},
-std::array<float,2>{0.369993031f, 0.171958387f},
-std::array<float,2>{0.476736933f, 0.952009797f},
-std::array<float,2>{0.537034392f, 0.0739203766f},
-std::array<float,2>{0.781623781f, 0.722330093f},
-std::array<float,2>{0.196836442f, 0.495562166f},
-std::array<float,2>{0.00611123489f, 0.90529412f},
-std::array<float,2>{0.900163829f, 0.0397483595f},
-std::array<float,2>{0.718628585f, 0.674788594f},
-std::array<float,2>{0.309459597f, 0.426288724f},
-std::array<float,2>{0.397346675f, 0.554309309f},
-std::array<float,2>{0.622469604f, 0.311160117f},
-std::array<float,2>{0.82906127f, 0.767780662f},
-std::array<float,2>{0.13135758f, 0.210585833f},
-std::array<float,2>{0.247698829f, 0.700526774f},
-std::array<float,2>{0.769210637f, 0.46752885f},
-std::array<float,2>{0.508538067f, 0.989801884f},
-std::array<float,2>{0.46155107f, 0.106739476f},
-std::array<float,2>{0.313628674f, 0.83907634f},
-std::array<float,2>{0.668111444f, 0.14164868f},
-std::array<float,2>{0.961449683f, 0.602266908f},
-std::array<float,2>{0.0892847478f, 0.371257871f},
-std::array<float,2>{0.0714962408f, 0.874312818f},
-std::array<float,2>{0.945407569f, 0.164519668f},
-std::array<float,2>{0.678911388f, 0.579065442f},
-std::array<float,2>{0.333600909f, 0.339284837f},
-std::array<float,2>{0.443802953f, 0.748855114f},
-std::array<float,2>{0.528998733f, 0.480478883f},
-std::array<float,2>{0.764506221f, 0.96109426f},
-std::array<float,2>{0.220187515f, 0.0852049515f},
-std::array<float,2>{0.141194105f, 0.52126807f},
-std::array<float,2>{0.818572938f, 0.257408351f},
-std::array<float,2>{0.60092777f, 0.80158776f},
-std::array<float,2>{0.38246876f, 0.237912372f},
-std::array<float,2>{0.289646685f, 0.920281887f},
-std::array<float,2>{0.691576838f, 0.0170373283f},
-std::array<float,2>{0.884666562f, 0.638195455f},
-std::array<float,2>{0.0185102765f, 0.398974776f},
-std::array<float,2>{0.207833946f, 0.978744566f},
-std::array<float,2>{0.810321033f, 0.122863054f},
-std::array<float,2>{0.559318066f, 0.716394663f},
-std::array<float,2>{0.498817116f, 0.452623516f},
-std::array<float,2>{0.35223493f, 0.617320776f},
-std::array<float,2>{0.626793563f, 0.358967334f},
-std::array<float,2>{0.97443676f, 0.823342144f},
-std::array<float,2>{0.107270956f, 0.128323019f},
-std::array<float,2>{0.0531550758f, 0.669241488f},
-std::array<float,2>{0.933824837f, 0.414806426f},
-std::array<float,2>{0.745732129f, 0.87833786f},
-std::array<float,2>{0.279797584f, 0.0564354658f},
-std::array<float,2>{0.425783426f, 0.750856161f},
-std::array<float,2>{0.585663676f, 0.201285407f},
-std::array<float,2>{0.855866432f, 0.54206413f},
-std::array<float,2>{0.18707101f, 0.29604724f},
-std::array<float,2>{0.231471613f, 0.814723134f},
-std::array<float,2>{0.754988194f, 0.133996129f},
-std::array<float,2>{0.521379292f, 0.614063561f},
-std::array<float,2>{0.452234566f, 0.34629041f},
-std::array<float,2>{0.340955228f, 0.70777297f},
-std::array<float,2>{0.68559885f, 0.443481177f},
-std::array<float,2>{0.9378075f, 0.975493968f},
-std::array<float,2>{0.0628235191f, 0.114796534f},
-std::array<float,2>{0.0247309543f, 0.534298956f},
-std::array<float,2>{0.877985001f, 0.286218822f},
-std::array<float,2>{0.697284043f, 0.758743763f},
-std::array<float,2>{0.284961998f, 0.190533862f},
-std::array<float,2>{0.388234556f, 0.884719849f},
-std::array<float,2>{0.602198541f, 0.0504856743f},
-std::array<float,2>{0.822435439f, 0.660855591f},
-std::array<float,2>{0.150816813f, 0.410372853f},
-std::array<float,2>{0.0996311754f, 0.95494312f},
-std::array<float,2>{0.97994417f, 0.0874614865f},
-std::array<float,2>{0.635324001f, 0.73800379f},
-std::array<float,2>{0.346331686f, 0.471378148f},
-std::array<float,2>{0.489161253f, 0.58767283f},
-std::array<float,2>{0.549443364f, 0.333612293f},
-std::array<float,2>{0.800082028f, 0.863274574f},
-std::array<float,2>{0.214457974f, 0.161119431f},
-std::array<float,2>{0.173771054f, 0.628083944f},
-std::array<float,2>{0.848682642f, 0.391884476f},
-std::array<float,2>{0.588028312f, 0.909907401f},
-std::array<float,2>{0.434372455f, 0.030243054f},
-std::array<float,2>{0.271591276f, 0.804744482f},
-std::array<float,2>{0.735500276f, 0.247828126f},
-std::array<float,2>{0.924978793f, 0.526946247f},
-std::array<float,2>{0.0548785254f, 0.262241215f},
-std::array<float,2>{0.0401788354f, 0.775480747f},
-std::array<float,2>{0.911411166f, 0.217358112f},
-std::array<float,2>{0.719260156f, 0.559415638f},
-std::array<float,2>{0.252311379f, 0.302559346f},
-std::array<float,2>{0.412387401f, 0.687385857f},
-std::array<float,2>{0.577597201f, 0.430143952f},
-std::array<float,2>{0.860481262f, 0.895333886f},
-std::array<float,2>{0.162599742f, 0.033693742f},
-std::array<float,2>{0.193529531f, 0.600336194f},
-std::array<float,2>{0.792452097f, 0.362646639f},
-std::array<float,2>{0.54167819f, 0.831569672f},
-std::array<float,2>{0.473999202f, 0.149253964f},
-std::array<float,2>{0.360952467f, 0.995512187f},
-std::array<float,2>{0.647291481f, 0.0996081084f},
-std::array<float,2>{0.98664999f, 0.694006085f},
-std::array<float,2>{0.115074091f, 0.460015297f},
-std::array<float,2>{0.137254626f, 0.925510705f},
-std::array<float,2>{0.842864871f, 0.000486598787f},
-std::array<float,2>{0.612944841f, 0.641009033f},
-std::array<float,2>{0.40596211f, 0.390510798f},
-std::array<float,2>{0.300332248f, 0.508964479f},
-std::array<float,2>{0.706822515f, 0.278993607f},
-std::array<float,2>{0.895827055f, 0.786954463f},
-std::array<float,2>{0.0155231785f, 0.23133947f},
-std::array<float,2>{0.0820118859f, 0.730513036f},
-std::array<float,2>{0.959922075f, 0.489389777f},
-std::array<float,2>{0.658811629f, 0.941468596f},
-std::array<float,2>{0.32313624f, 0.06592682f},
-std::array<float,2>{0.453947067f, 0.84648031f},
-std::array<float,2>{0.5008654f, 0.180724666f},
-std::array<float,2>{0.780649602f, 0.577579618f},
-std::array<float,2>{0.239109471f, 0.317219943f},
-std::array<float,2>{0.244925767f, 0.812190652f},
-std::array<float,2>{0.773086011f, 0.24520798f},
-std::array<float,2>{0.513583243f, 0.530223727f},
-std::array<float,2>{0.467599452f, 0.259021521f},
-std::array<float,2>{0.316648394f, 0.629566491f},
-std::array<float,2>{0.664933443f, 0.396727502f},
-std::array<float,2>{0.96500659f, 0.913304329f},
-std::array<float,2>{0.0906791985f, 0.0272793174f},
-std::array<float,2>{0.000549145567f, 0.59113723f},
-std::array<float,2>{0.904919088f, 0.329145372f},
-std::array<float,2>{0.712641656f, 0.864236712f},
-std::array<float,2>{0.307088047f, 0.158550337f},
-std::array<float,2>{0.39253056f, 0.958439529f},
-std::array<float,2>{0.619728863f, 0.0914427415f},
-std::array<float,2>{0.83422637f, 0.740545332f},
-std::array<float,2>{0.12622112f, 0.473824322f},
-std::array<float,2>{0.121059723f, 0.889436364f},
-std::array<float,2>{0.999310613f, 0.052701734f},
-std::array<float,2>{0.651633501f, 0.659979522f},
-std::array<float,2>{0.374919206f, 0.406672984f},
-std::array<float,2>{0.481770307f, 0.537152469f},
-std::array<float,2>{0.53222543f, 0.284793496f},
-std::array<float,2>{0.788445532f, 0.762015045f},
-std::array<float,2>{0.202604488f, 0.192650959f},
-std::array<float,2>{0.168048918f, 0.706131995f},
-std::array<float,2>{0.871724606f, 0.438383341f},
-std::array<float,2>{0.565811574f, 0.970536411f},
-std::array<float,2>{0.415524811f, 0.110250443f},
-std::array<float,2>{0.258796632f, 0.818940818f},
-std::array<float,2>{0.729332745f, 0.137541339f},
-std::array<float,2>{0.914810359f, 0.611156762f},
-std::array<float,2>{0.033990968f, 0.349632949f},
-std::array<float,2>{0.0487939231f, 0.849840999f},
-std::array<float,2>{0.933308184f, 0.18528308f},
-std::array<float,2>{0.746190071f, 0.570689619f},
-std::array<float,2>{0.275560707f, 0.314331263f},
-std::array<float,2>{0.424569041f, 0.727780521f},
-std::array<float,2>{0.578181028f, 0.487385988f},
-std::array<float,2>{0.855096161f, 0.940745592f},
-std::array<float,2>{0.181316704f, 0.0675268546f},
-std::array<float,2>{0.203414217f, 0.514507592f},
-std::array<float,2>{0.805200636f, 0.276195347f},
-std::array<float,2>{0.556393385f, 0.783555746f},
-std::array<float,2>{0.495332718f, 0.227389574f},
-std::array<float,2>{0.357724458f, 0.927055478f},
-std::array<float,2>{0.631874859f, 0.00554426899f},
-std::array<float,2>{0.970133722f, 0.646825373f},
-std::array<float,2>{0.104543835f, 0.383139968f},
-std::array<float,2>{0.146492094f, 0.997037411f},
-std::array<float,2>{0.814157307f, 0.0975470096f},
-std::array<float,2>{0.595086038f, 0.687776208f},
-std::array<float,2>{0.375646532f, 0.4532094f},
-std::array<float,2>{0.294562668f, 0.597535253f},
-std::array<float,2>{0.689754546f, 0.363709629f},
-std::array<float,2>{0.887177944f, 0.835692346f},
-std::array<float,2>{0.0229778215f, 0.153323457f},
-std::array<float,2>{0.0758672357f, 0.682503283f},
-std::array<float,2>{0.951956391f, 0.436132669f},
-std::array<float,2>{0.674980879f, 0.890896499f},
-std::array<float,2>{0.32927829f, 0.038501963f},
-std::array<float,2>{0.440755844f, 0.779961169f},
-std::array<float,2>{0.527151644f, 0.213174462f},
-std::array<float,2>{0.761714995f, 0.556182981f},
-std::array<float,2>{0.224438772f, 0.29911086f},
-std::array<float,2>{0.179654852f, 0.840605974f},
-std::array<float,2>{0.847028732f, 0.1473777f},
-std::array<float,2>{0.590611756f, 0.608373284f},
-std::array<float,2>{0.430853486f, 0.368205756f},
-std::array<float,2>{0.2692177f, 0.696692526f},
-std::array<float,2>{0.738445044f, 0.461062491f},
-std::array<float,2>{0.927667439f, 0.987839997f},
-std::array<float,2>{0.0608307347f, 0.101838425f},
-std::array<float,2>{0.0954491198f, 0.547517478f},
-std::array<float,2>{0.98109287f, 0.305057794f},
-std::array<float,2>{0.638147354f, 0.771535099f},
-std::array<float,2>{0.349547774f, 0.205848053f},
-std::array<float,2>{0.487658918f, 0.902190924f},
-std::array<float,2>{0.553898692f, 0.0445791036f},
-std::array<float,2>{0.802898824f, 0.678705633f},
-std::array<float,2>{0.216416374f, 0.423849255f},
-std::array<float,2>{0.0289161466f, 0.946164072f},
-std::array<float,2>{0.87905544f, 0.0760692284f},
-std::array<float,2>{0.701398253f, 0.723842978f},
-std::array<float,2>{0.28769502f, 0.498565078f},
-std::array<float,2>{0.382963926f, 0.563562453f},
-std::array<float,2>{0.608085275f, 0.322684109f},
-std::array<float,2>{0.826842189f, 0.855991781f},
-std::array<float,2>{0.153821915f, 0.178958923f},
-std::array<float,2>{0.226853147f, 0.651390374f},
-std::array<float,2>{0.75158006f, 0.378346652f},
-std::array<float,2>{0.516092837f, 0.935309827f},
-std::array<float,2>{0.446121633f, 0.010154401f},
-std::array<float,2>{0.339712948f, 0.796210766f},
-std::array<float,2>{0.680909455f, 0.224851042f},
-std::array<float,2>{0.943937063f, 0.507537603f},
-std::array<float,2>{0.067001082f, 0.268469304f},
-std::array<float,2>{0.0846708491f, 0.757287443f},
-std::array<float,2>{0.956660151f, 0.195639357f},
-std::array<float,2>{0.662877798f, 0.543763995f},
-std::array<float,2>{0.326023012f, 0.292369723f},
-std::array<float,2>{0.46049121f, 0.664935589f},
-std::array<float,2>{0.505551159f, 0.421530455f},
-std::array<float,2>{0.774415851f, 0.882569075f},
-std::array<float,2>{0.237670854f, 0.0616571903f},
-std::array<float,2>{0.133772701f, 0.624413431f},
-std::array<float,2>{0.838934064f, 0.355315536f},
-std::array<float,2>{0.613415837f, 0.82454735f},
-std::array<float,2>{0.401735455f, 0.130606934f},
-std::array<float,2>{0.301280826f, 0.982172132f},
-std::array<float,2>{0.708933055f, 0.118848383f},
-std::array<float,2>{0.890803993f, 0.714272857f},
-std::array<float,2>{0.00858498923f, 0.448876649f},
-std::array<float,2>{0.18917878f, 0.916949987f},
-std::array<float,2>{0.793861747f, 0.0211609397f},
-std::array<float,2>{0.544355631f, 0.634437561f},
-std::array<float,2>{0.471971035f, 0.403493583f},
-std::array<float,2>{0.365898103f, 0.51563412f},
-std::array<float,2>{0.642709732f, 0.252738982f},
-std::array<float,2>{0.98929739f, 0.797396779f},
-std::array<float,2>{0.110233977f, 0.241883129f},
-std::array<float,2>{0.0433062017f, 0.74397862f},
-std::array<float,2>{0.906521082f, 0.4787983f},
-std::array<float,2>{0.723667145f, 0.967723966f},
-std::array<float,2>{0.257340282f, 0.0784728825f},
-std::array<float,2>{0.409070909f, 0.867626131f},
-std::array<float,2>{0.571030438f, 0.168483824f},
-std::array<float,2>{0.866208613f, 0.583835542f},
-std::array<float,2>{0.156412691f, 0.341430277f},
-std::array<float,2>{0.129761368f, 0.766880631f},
-std::array<float,2>{0.831968367f, 0.207561374f},
-std::array<float,2>{0.623104274f, 0.55106163f},
-std::array<float,2>{0.394583136f, 0.309561104f},
-std::array<float,2>{0.312073201f, 0.673749328f},
-std::array<float,2>{0.716516674f, 0.429033548f},
-std::array<float,2>{0.901888609f, 0.902844191f},
-std::array<float,2>{0.00438367995f, 0.042517148f},
-std::array<float,2>{0.0876611695f, 0.605174601f},
-std::array<float,2>{0.963807881f, 0.374076605f},
-std::array<float,2>{0.670585513f, 0.837374568f},
-std::array<float,2>{0.315006137f, 0.144348681f},
-std::array<float,2>{0.463036418f, 0.991629779f},
-std::array<float,2>{0.50994128f, 0.107672408f},
-std::array<float,2>{0.767115653f, 0.701323986f},
-std::array<float,2>{0.249923825f, 0.464892775f},
-std::array<float,2>{0.0374811962f, 0.933079958f},
-std::array<float,2>{0.919610739f, 0.0143937906f},
-std::array<float,2>{0.734188855f, 0.652923524f},
-std::array<float,2>{0.261868119f, 0.379572868f},
-std::array<float,2>{0.419213891f, 0.501267433f},
-std::array<float,2>{0.569827437f, 0.270116299f},
-std::array<float,2>{0.870144606f, 0.792721391f},
-std::array<float,2>{0.165344357f, 0.219937563f},
-std::array<float,2>{0.197357684f, 0.720021546f},
-std::array<float,2>{0.784031451f, 0.492728978f},
-std::array<float,2>{0.538865864f, 0.951014996f},
-std::array<float,2>{0.480454445f, 0.0722026378f},
-std::array<float,2>{0.368222773f, 0.853507996f},
-std::array<float,2>{0.652554989f, 0.175240487f},
-std::array<float,2>{0.992679417f, 0.569699407f},
-std::array<float,2>{0.121958129f, 0.326764822f},
-std::array<float,2>{0.108734258f, 0.821014702f},
-std::array<float,2>{0.975748837f, 0.125208437f},
-std::array<float,2>{0.62772125f, 0.620063782f},
-std::array<float,2>{0.354970068f, 0.356203586f},
-std::array<float,2>{0.496487916f, 0.717611372f},
-std::array<float,2>{0.562158167f, 0.450408489f},
-std::array<float,2>{0.812091053f, 0.976777077f},
-std::array<float,2>{0.209936708f, 0.12429785f},
-std::array<float,2>{0.185193643f, 0.540702045f},
-std::array<float,2>{0.859119475f, 0.293232173f},
-std::array<float,2>{0.583334446f, 0.752115905f},
-std::array<float,2>{0.428031743f, 0.20032604f},
-std::array<float,2>{0.277668267f, 0.876800179f},
-std::array<float,2>{0.743011773f, 0.05812677f},
-std::array<float,2>{0.936516702f, 0.670158744f},
-std::array<float,2>{0.0518783666f, 0.417660594f},
-std::array<float,2>{0.221022397f, 0.963692188f},
-std::array<float,2>{0.763039291f, 0.0831669942f},
-std::array<float,2>{0.530902267f, 0.747836471f},
-std::array<float,2>{0.441608846f, 0.483852744f},
-std::array<float,2>{0.33577472f, 0.580964804f},
-std::array<float,2>{0.676189065f, 0.337614387f},
-std::array<float,2>{0.947644591f, 0.872799039f},
-std::array<float,2>{0.0741255283f, 0.166368261f},
-std::array<float,2>{0.0166424196f, 0.639865994f},
-std::array<float,2>{0.886047542f, 0.400800049f},
-std::array<float,2>{0.694421768f, 0.918317556f},
-std::array<float,2>{0.292323083f, 0.0185690802f},
-std::array<float,2>{0.379054308f, 0.804629982f},
-std::array<float,2>{0.597857833f, 0.236282796f},
-std::array<float,2>{0.816504836f, 0.521570206f},
-std::array<float,2>{0.143217281f, 0.254057407f},
-std::array<float,2>{0.212651581f, 0.860613704f},
-std::array<float,2>{0.797449827f, 0.162301227f},
-std::array<float,2>{0.547648489f, 0.588937998f},
-std::array<float,2>{0.491467148f, 0.334818393f},
-std::array<float,2>{0.343890399f, 0.734993577f},
-std::array<float,2>{0.633020401f, 0.469640493f},
-std::array<float,2>{0.977502763f, 0.956978202f},
-std::array<float,2>{0.0978760645f, 0.0883259773f},
-std::array<float,2>{0.0569225401f, 0.524373353f},
-std::array<float,2>{0.923114538f, 0.263975799f},
-std::array<float,2>{0.737296343f, 0.808117926f},
-std::array<float,2>{0.271413267f, 0.249607354f},
-std::array<float,2>{0.436157227f, 0.906616271f},
-std::array<float,2>{0.586391449f, 0.0284629408f},
-std::array<float,2>{0.851115108f, 0.625747204f},
-std::array<float,2>{0.175526261f, 0.392922848f},
-std::array<float,2>{0.0651585087f, 0.972898781f},
-std::array<float,2>{0.940300405f, 0.115854964f},
-std::array<float,2>{0.683736682f, 0.710914075f},
-std::array<float,2>{0.343287587f, 0.44229266f},
-std::array<float,2>{0.450551927f, 0.616942585f},
-std::array<float,2>{0.522444427f, 0.344675958f},
-std::array<float,2>{0.757011294f, 0.813850045f},
-std::array<float,2>{0.232573986f, 0.135578111f},
-std::array<float,2>{0.149508074f, 0.663091302f},
-std::array<float,2>{0.821186543f, 0.412631422f},
-std::array<float,2>{0.604446828f, 0.885044277f},
-std::array<float,2>{0.390406132f, 0.0480607226f},
-std::array<float,2>{0.281801254f, 0.761462867f},
-std::array<float,2>{0.695953667f, 0.188014835f},
-std::array<float,2>{0.875900149f, 0.533151686f},
-std::array<float,2>{0.0269751865f, 0.287284523f},
-std::array<float,2>{0.0125637213f, 0.788866758f},
-std::array<float,2>{0.897871792f, 0.233793125f},
-std::array<float,2>{0.704678655f, 0.511124074f},
-std::array<float,2>{0.297405899f, 0.280159712f},
-std::array<float,2>{0.402603924f, 0.643503606f},
-std::array<float,2>{0.610010803f, 0.388559341f},
-std::array<float,2>{0.840441763f, 0.923293054f},
-std::array<float,2>{0.139717728f, 0.00197009882f},
-std::array<float,2>{0.24140732f, 0.57428354f},
-std::array<float,2>{0.779118955f, 0.319349408f},
-std::array<float,2>{0.501985848f, 0.844990313f},
-std::array<float,2>{0.456553698f, 0.182353541f},
-std::array<float,2>{0.321659774f, 0.944992423f},
-std::array<float,2>{0.657705367f, 0.0633479804f},
-std::array<float,2>{0.957354963f, 0.733855307f},
-std::array<float,2>{0.0796744823f, 0.4906362f},
-std::array<float,2>{0.161946774f, 0.897529423f},
-std::array<float,2>{0.862650633f, 0.0315185636f},
-std::array<float,2>{0.575508177f, 0.68363446f},
-std::array<float,2>{0.410915881f, 0.433195829f},
-std::array<float,2>{0.250976115f, 0.561430156f},
-std::array<float,2>{0.721719444f, 0.303114533f},
-std::array<float,2>{0.912669063f, 0.774007618f},
-std::array<float,2>{0.0415513143f, 0.215376377f},
-std::array<float,2>{0.11563921f, 0.69257015f},
-std::array<float,2>{0.985404313f, 0.458438605f},
-std::array<float,2>{0.64616859f, 0.992245972f},
-std::array<float,2>{0.362662017f, 0.101520456f},
-std::array<float,2>{0.475461513f, 0.830029011f},
-std::array<float,2>{0.539925098f, 0.152034521f},
-std::array<float,2>{0.790808618f, 0.598110914f},
-std::array<float,2>{0.191958979f, 0.359505802f}}
\ No newline at end of file
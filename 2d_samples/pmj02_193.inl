@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.233012274f, 0.569688439f},
-std::array<float,2>{0.582652569f, 0.363378197f},
-std::array<float,2>{0.85664773f, 0.998823345f},
-std::array<float,2>{0.293901205f, 0.0144146597f},
-std::array<float,2>{0.388142675f, 0.765742838f},
-std::array<float,2>{0.880986989f, 0.226822585f},
-std::array<float,2>{0.711681306f, 0.749922216f},
-std::array<float,2>{0.0894497856f, 0.407143295f},
-std::array<float,2>{0.317304164f, 0.627432764f},
-std::array<float,2>{0.761883557f, 0.464677095f},
-std::array<float,2>{0.515691519f, 0.846450388f},
-std::array<float,2>{0.131045491f, 0.132059529f},
-std::array<float,2>{0.04685032f, 0.910314858f},
-std::array<float,2>{0.668300331f, 0.111391403f},
-std::array<float,2>{0.981350899f, 0.525997281f},
-std::array<float,2>{0.446753711f, 0.298525482f},
-std::array<float,2>{0.099876605f, 0.707206309f},
-std::array<float,2>{0.73506403f, 0.378239989f},
-std::array<float,2>{0.929319918f, 0.807919979f},
-std::array<float,2>{0.408270925f, 0.195779517f},
-std::array<float,2>{0.264569342f, 0.96729964f},
-std::array<float,2>{0.825784564f, 0.0419641547f},
-std::array<float,2>{0.603717446f, 0.600953102f},
-std::array<float,2>{0.188632548f, 0.341451019f},
-std::array<float,2>{0.473780334f, 0.536243498f},
-std::array<float,2>{0.961697817f, 0.259814799f},
-std::array<float,2>{0.649681032f, 0.87646395f},
-std::array<float,2>{0.0110941064f, 0.0824987218f},
-std::array<float,2>{0.177638277f, 0.812750161f},
-std::array<float,2>{0.55561173f, 0.180067077f},
-std::array<float,2>{0.785664022f, 0.67635119f},
-std::array<float,2>{0.346480221f, 0.475639224f},
-std::array<float,2>{0.146989554f, 0.657292843f},
-std::array<float,2>{0.507378399f, 0.499156237f},
-std::array<float,2>{0.767518222f, 0.841104805f},
-std::array<float,2>{0.329905003f, 0.166419506f},
-std::array<float,2>{0.465118974f, 0.905022919f},
-std::array<float,2>{0.988219798f, 0.0637567788f},
-std::array<float,2>{0.683431029f, 0.555986047f},
-std::array<float,2>{0.0525060631f, 0.269497722f},
-std::array<float,2>{0.305657119f, 0.618730783f},
-std::array<float,2>{0.872383893f, 0.321538419f},
-std::array<float,2>{0.566115797f, 0.937907517f},
-std::array<float,2>{0.239052817f, 0.0514924042f},
-std::array<float,2>{0.0775277764f, 0.787135541f},
-std::array<float,2>{0.701431453f, 0.218261078f},
-std::array<float,2>{0.896818757f, 0.7014153f},
-std::array<float,2>{0.40461123f, 0.391710669f},
-std::array<float,2>{0.0294269007f, 0.50831759f},
-std::array<float,2>{0.632673264f, 0.291644245f},
-std::array<float,2>{0.952741265f, 0.927160978f},
-std::array<float,2>{0.49163574f, 0.094282262f},
-std::array<float,2>{0.363225907f, 0.868243158f},
-std::array<float,2>{0.805924773f, 0.155732587f},
-std::array<float,2>{0.533386111f, 0.656216443f},
-std::array<float,2>{0.162780881f, 0.444094181f},
-std::array<float,2>{0.436715007f, 0.719896317f},
-std::array<float,2>{0.90864712f, 0.437255561f},
-std::array<float,2>{0.7210024f, 0.752623677f},
-std::array<float,2>{0.117840208f, 0.234394863f},
-std::array<float,2>{0.207281977f, 0.970844746f},
-std::array<float,2>{0.622286856f, 0.0161810759f},
-std::array<float,2>{0.836218715f, 0.590415895f},
-std::array<float,2>{0.26803863f, 0.359308839f},
-std::array<float,2>{0.168233052f, 0.550643384f},
-std::array<float,2>{0.543036163f, 0.275604457f},
-std::array<float,2>{0.798043489f, 0.897458255f},
-std::array<float,2>{0.374915063f, 0.0732888132f},
-std::array<float,2>{0.495902985f, 0.830681205f},
-std::array<float,2>{0.938609183f, 0.160586074f},
-std::array<float,2>{0.633455098f, 0.668396831f},
-std::array<float,2>{0.0192801654f, 0.484400511f},
-std::array<float,2>{0.275866866f, 0.691974044f},
-std::array<float,2>{0.829788804f, 0.402849793f},
-std::array<float,2>{0.610091805f, 0.796342313f},
-std::array<float,2>{0.216842309f, 0.210122868f},
-std::array<float,2>{0.110758625f, 0.949271977f},
-std::array<float,2>{0.728104055f, 0.0595752038f},
-std::array<float,2>{0.917929947f, 0.609680057f},
-std::array<float,2>{0.42501539f, 0.320237428f},
-std::array<float,2>{0.0587721802f, 0.643395782f},
-std::array<float,2>{0.672956347f, 0.445646077f},
-std::array<float,2>{0.999903798f, 0.860022783f},
-std::array<float,2>{0.45790866f, 0.14630878f},
-std::array<float,2>{0.337435454f, 0.930548191f},
-std::array<float,2>{0.776269615f, 0.104702413f},
-std::array<float,2>{0.515424013f, 0.50487262f},
-std::array<float,2>{0.156213477f, 0.28585127f},
-std::array<float,2>{0.39797771f, 0.58228302f},
-std::array<float,2>{0.906107545f, 0.346915543f},
-std::array<float,2>{0.690905631f, 0.982580304f},
-std::array<float,2>{0.0631471127f, 0.026067771f},
-std::array<float,2>{0.242790759f, 0.75888896f},
-std::array<float,2>{0.572469175f, 0.244017676f},
-std::array<float,2>{0.860529721f, 0.731891274f},
-std::array<float,2>{0.299655855f, 0.423766077f},
-std::array<float,2>{0.200103953f, 0.740368724f},
-std::array<float,2>{0.595319808f, 0.421149254f},
-std::array<float,2>{0.818239987f, 0.778238416f},
-std::array<float,2>{0.256172448f, 0.225163013f},
-std::array<float,2>{0.420685977f, 0.988765597f},
-std::array<float,2>{0.933923781f, 0.00499964226f},
-std::array<float,2>{0.746421695f, 0.570911646f},
-std::array<float,2>{0.105725117f, 0.374181092f},
-std::array<float,2>{0.355486751f, 0.517340004f},
-std::array<float,2>{0.789784312f, 0.312450379f},
-std::array<float,2>{0.554485142f, 0.921206355f},
-std::array<float,2>{0.182537571f, 0.122959442f},
-std::array<float,2>{0.00591941876f, 0.856928051f},
-std::array<float,2>{0.6408571f, 0.137239233f},
-std::array<float,2>{0.953972459f, 0.6334216f},
-std::array<float,2>{0.483127922f, 0.458259165f},
-std::array<float,2>{0.0796309263f, 0.608970225f},
-std::array<float,2>{0.709014297f, 0.33038193f},
-std::array<float,2>{0.884429932f, 0.959560633f},
-std::array<float,2>{0.381481916f, 0.0315691233f},
-std::array<float,2>{0.282773226f, 0.803149283f},
-std::array<float,2>{0.844417095f, 0.190253273f},
-std::array<float,2>{0.58609283f, 0.717185736f},
-std::array<float,2>{0.220669001f, 0.385016054f},
-std::array<float,2>{0.441386193f, 0.680203617f},
-std::array<float,2>{0.969232023f, 0.479421645f},
-std::array<float,2>{0.658827364f, 0.821261644f},
-std::array<float,2>{0.0346291512f, 0.177081004f},
-std::array<float,2>{0.13576594f, 0.886866152f},
-std::array<float,2>{0.528114319f, 0.0895751193f},
-std::array<float,2>{0.752714872f, 0.540844321f},
-std::array<float,2>{0.322113305f, 0.256244659f},
-std::array<float,2>{0.214521602f, 0.528199494f},
-std::array<float,2>{0.614302814f, 0.302894741f},
-std::array<float,2>{0.833498716f, 0.909697115f},
-std::array<float,2>{0.278782308f, 0.113302596f},
-std::array<float,2>{0.42758593f, 0.849613786f},
-std::array<float,2>{0.918150306f, 0.127552599f},
-std::array<float,2>{0.733550072f, 0.630116403f},
-std::array<float,2>{0.11710912f, 0.468508244f},
-std::array<float,2>{0.368510664f, 0.743558645f},
-std::array<float,2>{0.80392772f, 0.413945526f},
-std::array<float,2>{0.541961133f, 0.773151398f},
-std::array<float,2>{0.16591832f, 0.230627567f},
-std::array<float,2>{0.0229846183f, 0.99370116f},
-std::array<float,2>{0.638422072f, 0.0093894219f},
-std::array<float,2>{0.942342043f, 0.565049291f},
-std::array<float,2>{0.499393731f, 0.361456364f},
-std::array<float,2>{0.0694459006f, 0.674772382f},
-std::array<float,2>{0.695035815f, 0.468835771f},
-std::array<float,2>{0.901279569f, 0.817924082f},
-std::array<float,2>{0.394431174f, 0.186025485f},
-std::array<float,2>{0.302343816f, 0.879870236f},
-std::array<float,2>{0.865585923f, 0.0782502666f},
-std::array<float,2>{0.574625909f, 0.533157289f},
-std::array<float,2>{0.249675825f, 0.264745623f},
-std::array<float,2>{0.453740895f, 0.595021129f},
-std::array<float,2>{0.994515896f, 0.339186162f},
-std::array<float,2>{0.677156031f, 0.963857353f},
-std::array<float,2>{0.0575343743f, 0.0452643223f},
-std::array<float,2>{0.151994482f, 0.809373438f},
-std::array<float,2>{0.509849608f, 0.202881128f},
-std::array<float,2>{0.779819608f, 0.705544949f},
-std::array<float,2>{0.340848416f, 0.380428374f},
-std::array<float,2>{0.1840747f, 0.698857546f},
-std::array<float,2>{0.547883391f, 0.396315604f},
-std::array<float,2>{0.796350896f, 0.784865141f},
-std::array<float,2>{0.35350436f, 0.214163646f},
-std::array<float,2>{0.476996273f, 0.945049286f},
-std::array<float,2>{0.958892822f, 0.0482145585f},
-std::array<float,2>{0.647892952f, 0.623095512f},
-std::array<float,2>{0.00128819596f, 0.324632943f},
-std::array<float,2>{0.253262043f, 0.559398711f},
-std::array<float,2>{0.815106213f, 0.271817178f},
-std::array<float,2>{0.598152637f, 0.898763418f},
-std::array<float,2>{0.197648749f, 0.0670735836f},
-std::array<float,2>{0.105037607f, 0.838900685f},
-std::array<float,2>{0.745908499f, 0.170154259f},
-std::array<float,2>{0.931073785f, 0.662171602f},
-std::array<float,2>{0.415814936f, 0.495642751f},
-std::array<float,2>{0.0388138928f, 0.58627063f},
-std::array<float,2>{0.663796008f, 0.352742463f},
-std::array<float,2>{0.973685205f, 0.973321915f},
-std::array<float,2>{0.441649765f, 0.0213013291f},
-std::array<float,2>{0.326931119f, 0.756330132f},
-std::array<float,2>{0.757062614f, 0.240843818f},
-std::array<float,2>{0.525072396f, 0.725759685f},
-std::array<float,2>{0.137481913f, 0.431983054f},
-std::array<float,2>{0.377083033f, 0.649593413f},
-std::array<float,2>{0.887052298f, 0.440006346f},
-std::array<float,2>{0.704247594f, 0.873879075f},
-std::array<float,2>{0.0857603252f, 0.148642957f},
-std::array<float,2>{0.226150364f, 0.924025476f},
-std::array<float,2>{0.591419041f, 0.0993446782f},
-std::array<float,2>{0.850466311f, 0.512179136f},
-std::array<float,2>{0.288616329f, 0.296142131f},
-std::array<float,2>{0.12864849f, 0.614224613f},
-std::array<float,2>{0.521699786f, 0.313404799f},
-std::array<float,2>{0.758581042f, 0.948934138f},
-std::array<float,2>{0.313288301f, 0.0572252497f},
-std::array<float,2>{0.451486349f, 0.792595029f},
-std::array<float,2>{0.978600442f, 0.203991383f},
-std::array<float,2>{0.667829156f, 0.689349771f},
-std::array<float,2>{0.0401764475f, 0.401523024f},
-std::array<float,2>{0.291767269f, 0.665742993f},
-std::array<float,2>{0.851837337f, 0.490997404f},
-std::array<float,2>{0.579638183f, 0.834080994f},
-std::array<float,2>{0.22699146f, 0.157930166f},
-std::array<float,2>{0.092177175f, 0.892539501f},
-std::array<float,2>{0.717325747f, 0.0770498812f},
-std::array<float,2>{0.877866864f, 0.553134739f},
-std::array<float,2>{0.383585691f, 0.27870512f},
-std::array<float,2>{0.0128370058f, 0.730182707f},
-std::array<float,2>{0.655395865f, 0.426046103f},
-std::array<float,2>{0.965281785f, 0.762708604f},
-std::array<float,2>{0.469983906f, 0.247489855f},
-std::array<float,2>{0.348026127f, 0.978346407f},
-std::array<float,2>{0.784068108f, 0.0280707907f},
-std::array<float,2>{0.561991513f, 0.578221679f},
-std::array<float,2>{0.173430666f, 0.348599851f},
-std::array<float,2>{0.411483139f, 0.503540695f},
-std::array<float,2>{0.925592065f, 0.283064246f},
-std::array<float,2>{0.73833859f, 0.934175432f},
-std::array<float,2>{0.0973214507f, 0.105850965f},
-std::array<float,2>{0.191554323f, 0.863590717f},
-std::array<float,2>{0.605566084f, 0.14144516f},
-std::array<float,2>{0.822810709f, 0.648409009f},
-std::array<float,2>{0.261117637f, 0.45286274f},
-std::array<float,2>{0.235379294f, 0.639055252f},
-std::array<float,2>{0.568631232f, 0.454507291f},
-std::array<float,2>{0.870778501f, 0.854543865f},
-std::array<float,2>{0.310626149f, 0.133424029f},
-std::array<float,2>{0.399355561f, 0.914349258f},
-std::array<float,2>{0.89191097f, 0.118350469f},
-std::array<float,2>{0.698476732f, 0.520442188f},
-std::array<float,2>{0.0732091889f, 0.307210743f},
-std::array<float,2>{0.334943622f, 0.576458871f},
-std::array<float,2>{0.770623386f, 0.370078802f},
-std::array<float,2>{0.503526688f, 0.988146007f},
-std::array<float,2>{0.140702859f, 7.44453209e-05f},
-std::array<float,2>{0.0501095615f, 0.776015997f},
-std::array<float,2>{0.685719728f, 0.220648885f},
-std::array<float,2>{0.991632342f, 0.737245381f},
-std::array<float,2>{0.462573558f, 0.417500645f},
-std::array<float,2>{0.122016974f, 0.544765592f},
-std::array<float,2>{0.72358954f, 0.253070444f},
-std::array<float,2>{0.910456181f, 0.886499047f},
-std::array<float,2>{0.43315345f, 0.092147328f},
-std::array<float,2>{0.269670606f, 0.825201094f},
-std::array<float,2>{0.841906428f, 0.171999589f},
-std::array<float,2>{0.617600262f, 0.68671149f},
-std::array<float,2>{0.20660235f, 0.481532842f},
-std::array<float,2>{0.487116694f, 0.713399768f},
-std::array<float,2>{0.946329892f, 0.387928128f},
-std::array<float,2>{0.628054619f, 0.800611615f},
-std::array<float,2>{0.0272654761f, 0.195192397f},
-std::array<float,2>{0.156904712f, 0.955833256f},
-std::array<float,2>{0.538897455f, 0.0379256271f},
-std::array<float,2>{0.810556054f, 0.602830827f},
-std::array<float,2>{0.366591215f, 0.335193455f},
-std::array<float,2>{0.19023338f, 0.598266602f},
-std::array<float,2>{0.603339136f, 0.342136472f},
-std::array<float,2>{0.827252686f, 0.965225935f},
-std::array<float,2>{0.262172818f, 0.0406214334f},
-std::array<float,2>{0.407256156f, 0.805357695f},
-std::array<float,2>{0.927264094f, 0.198864743f},
-std::array<float,2>{0.738146603f, 0.710585535f},
-std::array<float,2>{0.0995563343f, 0.375262022f},
-std::array<float,2>{0.344897687f, 0.678566635f},
-std::array<float,2>{0.787508428f, 0.474482238f},
-std::array<float,2>{0.557287753f, 0.815606773f},
-std::array<float,2>{0.178572133f, 0.181850716f},
-std::array<float,2>{0.00829137955f, 0.878820479f},
-std::array<float,2>{0.650897324f, 0.0843059346f},
-std::array<float,2>{0.963785708f, 0.538690507f},
-std::array<float,2>{0.474896967f, 0.258219808f},
-std::array<float,2>{0.0859750509f, 0.747596502f},
-std::array<float,2>{0.714761078f, 0.408452153f},
-std::array<float,2>{0.879113197f, 0.769109905f},
-std::array<float,2>{0.390297532f, 0.229379386f},
-std::array<float,2>{0.296272129f, 0.996635437f},
-std::array<float,2>{0.858808517f, 0.0129101081f},
-std::array<float,2>{0.585302114f, 0.567363858f},
-std::array<float,2>{0.23114197f, 0.366470128f},
-std::array<float,2>{0.447786689f, 0.523561716f},
-std::array<float,2>{0.982760489f, 0.300124973f},
-std::array<float,2>{0.670125842f, 0.912839651f},
-std::array<float,2>{0.0431270264f, 0.111125901f},
-std::array<float,2>{0.129688531f, 0.843807459f},
-std::array<float,2>{0.518234968f, 0.130154312f},
-std::array<float,2>{0.765229642f, 0.625244021f},
-std::array<float,2>{0.32025829f, 0.461500376f},
-std::array<float,2>{0.16056478f, 0.652895808f},
-std::array<float,2>{0.53184551f, 0.441426665f},
-std::array<float,2>{0.807985365f, 0.870013177f},
-std::array<float,2>{0.359896243f, 0.154185489f},
-std::array<float,2>{0.489214808f, 0.929185092f},
-std::array<float,2>{0.950501621f, 0.095774956f},
-std::array<float,2>{0.629712701f, 0.510047019f},
-std::array<float,2>{0.029158948f, 0.289180845f},
-std::array<float,2>{0.266559839f, 0.592218637f},
-std::array<float,2>{0.838050127f, 0.355942309f},
-std::array<float,2>{0.623437047f, 0.969193995f},
-std::array<float,2>{0.209078848f, 0.0183648653f},
-std::array<float,2>{0.11968895f, 0.751583517f},
-std::array<float,2>{0.720240355f, 0.236848459f},
-std::array<float,2>{0.906476319f, 0.722591102f},
-std::array<float,2>{0.434388965f, 0.434358567f},
-std::array<float,2>{0.0535319149f, 0.557555497f},
-std::array<float,2>{0.680608273f, 0.266294897f},
-std::array<float,2>{0.984887719f, 0.903126121f},
-std::array<float,2>{0.467120647f, 0.0649890825f},
-std::array<float,2>{0.331354022f, 0.842494071f},
-std::array<float,2>{0.768280447f, 0.164950445f},
-std::array<float,2>{0.504459202f, 0.658210576f},
-std::array<float,2>{0.146048591f, 0.496932864f},
-std::array<float,2>{0.403984845f, 0.700416625f},
-std::array<float,2>{0.896230102f, 0.394274175f},
-std::array<float,2>{0.700875759f, 0.785742283f},
-std::array<float,2>{0.0746763423f, 0.216705039f},
-std::array<float,2>{0.241029918f, 0.940401375f},
-std::array<float,2>{0.564378083f, 0.054315839f},
-std::array<float,2>{0.873853445f, 0.620424032f},
-std::array<float,2>{0.30736044f, 0.322838962f},
-std::array<float,2>{0.152787328f, 0.506401956f},
-std::array<float,2>{0.513501167f, 0.288791299f},
-std::array<float,2>{0.775137961f, 0.932339787f},
-std::array<float,2>{0.338018149f, 0.102638334f},
-std::array<float,2>{0.459210992f, 0.862704873f},
-std::array<float,2>{0.997404218f, 0.147263244f},
-std::array<float,2>{0.674224973f, 0.640784383f},
-std::array<float,2>{0.0608720928f, 0.448839247f},
-std::array<float,2>{0.298211694f, 0.733523071f},
-std::array<float,2>{0.862529695f, 0.424535006f},
-std::array<float,2>{0.570964396f, 0.760115743f},
-std::array<float,2>{0.245266169f, 0.245052457f},
-std::array<float,2>{0.0654335767f, 0.982363462f},
-std::array<float,2>{0.688107848f, 0.0250448175f},
-std::array<float,2>{0.902901113f, 0.584706128f},
-std::array<float,2>{0.395373881f, 0.345564961f},
-std::array<float,2>{0.0163958948f, 0.67064923f},
-std::array<float,2>{0.635529399f, 0.486789614f},
-std::array<float,2>{0.940049648f, 0.828628361f},
-std::array<float,2>{0.493395239f, 0.163543805f},
-std::array<float,2>{0.372667879f, 0.895922959f},
-std::array<float,2>{0.80046469f, 0.0715937838f},
-std::array<float,2>{0.544941068f, 0.547870398f},
-std::array<float,2>{0.170097649f, 0.274909288f},
-std::array<float,2>{0.423520148f, 0.612137675f},
-std::array<float,2>{0.914826274f, 0.3179456f},
-std::array<float,2>{0.729869723f, 0.951178551f},
-std::array<float,2>{0.112679206f, 0.06109697f},
-std::array<float,2>{0.216358885f, 0.794691622f},
-std::array<float,2>{0.613029838f, 0.208039045f},
-std::array<float,2>{0.831508398f, 0.693533242f},
-std::array<float,2>{0.273586661f, 0.405353993f},
-std::array<float,2>{0.221079782f, 0.716490865f},
-std::array<float,2>{0.588302433f, 0.384271532f},
-std::array<float,2>{0.846406519f, 0.802076161f},
-std::array<float,2>{0.28402862f, 0.188808233f},
-std::array<float,2>{0.379620582f, 0.957099915f},
-std::array<float,2>{0.885509014f, 0.0349450856f},
-std::array<float,2>{0.708208561f, 0.607391953f},
-std::array<float,2>{0.0811345577f, 0.329173476f},
-std::array<float,2>{0.324212581f, 0.542786658f},
-std::array<float,2>{0.751031637f, 0.254001766f},
-std::array<float,2>{0.530990839f, 0.889106572f},
-std::array<float,2>{0.133807838f, 0.0864400119f},
-std::array<float,2>{0.0319828093f, 0.823779106f},
-std::array<float,2>{0.657623112f, 0.178783163f},
-std::array<float,2>{0.970998704f, 0.682377696f},
-std::array<float,2>{0.438639522f, 0.477708727f},
-std::array<float,2>{0.10886427f, 0.574087679f},
-std::array<float,2>{0.749810159f, 0.372194797f},
-std::array<float,2>{0.936478078f, 0.990886152f},
-std::array<float,2>{0.418149054f, 0.0068410919f},
-std::array<float,2>{0.254483283f, 0.779310405f},
-std::array<float,2>{0.818407297f, 0.223898113f},
-std::array<float,2>{0.597098947f, 0.739477336f},
-std::array<float,2>{0.202953845f, 0.418102682f},
-std::array<float,2>{0.481077343f, 0.635915339f},
-std::array<float,2>{0.955906928f, 0.460378319f},
-std::array<float,2>{0.643414259f, 0.857536197f},
-std::array<float,2>{0.00461273035f, 0.13869594f},
-std::array<float,2>{0.179811791f, 0.919402838f},
-std::array<float,2>{0.551294982f, 0.123066671f},
-std::array<float,2>{0.791716814f, 0.518344164f},
-std::array<float,2>{0.35928601f, 0.309104115f},
-std::array<float,2>{0.246320665f, 0.53447026f},
-std::array<float,2>{0.577024817f, 0.263488919f},
-std::array<float,2>{0.864784241f, 0.882230997f},
-std::array<float,2>{0.30437544f, 0.0803784803f},
-std::array<float,2>{0.391929537f, 0.819194973f},
-std::array<float,2>{0.898551702f, 0.183820203f},
-std::array<float,2>{0.691998899f, 0.673352242f},
-std::array<float,2>{0.0680027902f, 0.471566021f},
-std::array<float,2>{0.343369365f, 0.704171777f},
-std::array<float,2>{0.778433144f, 0.382386714f},
-std::array<float,2>{0.509411931f, 0.811398387f},
-std::array<float,2>{0.149604276f, 0.200370029f},
-std::array<float,2>{0.0556739047f, 0.961899161f},
-std::array<float,2>{0.678005219f, 0.0433262996f},
-std::array<float,2>{0.993869662f, 0.595878541f},
-std::array<float,2>{0.456304044f, 0.337100655f},
-std::array<float,2>{0.115157709f, 0.632326663f},
-std::array<float,2>{0.731567025f, 0.465548724f},
-std::array<float,2>{0.921564281f, 0.849039257f},
-std::array<float,2>{0.427910358f, 0.125772446f},
-std::array<float,2>{0.28110531f, 0.907538474f},
-std::array<float,2>{0.834041357f, 0.115392104f},
-std::array<float,2>{0.615330398f, 0.530617297f},
-std::array<float,2>{0.211025685f, 0.301083773f},
-std::array<float,2>{0.497677535f, 0.563883305f},
-std::array<float,2>{0.943593204f, 0.35970819f},
-std::array<float,2>{0.639611065f, 0.994500041f},
-std::array<float,2>{0.0205677487f, 0.0098522706f},
-std::array<float,2>{0.167766407f, 0.771201789f},
-std::array<float,2>{0.540111125f, 0.233772054f},
-std::array<float,2>{0.801242352f, 0.745892763f},
-std::array<float,2>{0.36969313f, 0.410354912f},
-std::array<float,2>{0.139759332f, 0.722891808f},
-std::array<float,2>{0.525452852f, 0.431375414f},
-std::array<float,2>{0.754610896f, 0.754275739f},
-std::array<float,2>{0.324254185f, 0.23897174f},
-std::array<float,2>{0.44458276f, 0.976364851f},
-std::array<float,2>{0.975731552f, 0.0233533941f},
-std::array<float,2>{0.661213517f, 0.589784443f},
-std::array<float,2>{0.0358783267f, 0.35489437f},
-std::array<float,2>{0.28672412f, 0.513813078f},
-std::array<float,2>{0.84844631f, 0.293739438f},
-std::array<float,2>{0.592336774f, 0.923491418f},
-std::array<float,2>{0.224511847f, 0.10038662f},
-std::array<float,2>{0.0824661553f, 0.871692359f},
-std::array<float,2>{0.706433117f, 0.151886269f},
-std::array<float,2>{0.88969624f, 0.652069032f},
-std::array<float,2>{0.376028866f, 0.439267576f},
-std::array<float,2>{0.00280810846f, 0.622592866f},
-std::array<float,2>{0.645816207f, 0.327123255f},
-std::array<float,2>{0.959910274f, 0.941619098f},
-std::array<float,2>{0.479973167f, 0.0489466153f},
-std::array<float,2>{0.354937255f, 0.782137275f},
-std::array<float,2>{0.793426394f, 0.211623475f},
-std::array<float,2>{0.549234152f, 0.696617246f},
-std::array<float,2>{0.187380433f, 0.398153603f},
-std::array<float,2>{0.417545229f, 0.66149354f},
-std::array<float,2>{0.932589054f, 0.494134456f},
-std::array<float,2>{0.742317855f, 0.837160647f},
-std::array<float,2>{0.101739533f, 0.168281347f},
-std::array<float,2>{0.195954591f, 0.901010156f},
-std::array<float,2>{0.601027787f, 0.0692915618f},
-std::array<float,2>{0.814109743f, 0.561184943f},
-std::array<float,2>{0.251242757f, 0.270642996f},
-std::array<float,2>{0.175466597f, 0.581419647f},
-std::array<float,2>{0.559246361f, 0.350363791f},
-std::array<float,2>{0.783109963f, 0.980324507f},
-std::array<float,2>{0.349901199f, 0.0298625305f},
-std::array<float,2>{0.472371638f, 0.763803124f},
-std::array<float,2>{0.9670977f, 0.24939695f},
-std::array<float,2>{0.652908921f, 0.727955699f},
-std::array<float,2>{0.0153223714f, 0.428124696f},
-std::array<float,2>{0.25942868f, 0.645395994f},
-std::array<float,2>{0.820840597f, 0.449671894f},
-std::array<float,2>{0.60930711f, 0.866995573f},
-std::array<float,2>{0.195088029f, 0.143876791f},
-std::array<float,2>{0.0945786238f, 0.935596287f},
-std::array<float,2>{0.740557432f, 0.108160041f},
-std::array<float,2>{0.922444344f, 0.500902116f},
-std::array<float,2>{0.41332677f, 0.283268183f},
-std::array<float,2>{0.0412388816f, 0.690665483f},
-std::array<float,2>{0.664841115f, 0.400319368f},
-std::array<float,2>{0.976617873f, 0.790319264f},
-std::array<float,2>{0.449352741f, 0.20628354f},
-std::array<float,2>{0.316338152f, 0.945399463f},
-std::array<float,2>{0.759967089f, 0.0559220277f},
-std::array<float,2>{0.520256519f, 0.61583513f},
-std::array<float,2>{0.125020608f, 0.315383941f},
-std::array<float,2>{0.386351913f, 0.552399516f},
-std::array<float,2>{0.875548303f, 0.281092852f},
-std::array<float,2>{0.715464592f, 0.894163549f},
-std::array<float,2>{0.0903560445f, 0.0745577887f},
-std::array<float,2>{0.22874853f, 0.832858741f},
-std::array<float,2>{0.580161214f, 0.160145685f},
-std::array<float,2>{0.854962885f, 0.666123748f},
-std::array<float,2>{0.290890872f, 0.48989886f},
-std::array<float,2>{0.203976557f, 0.68424511f},
-std::array<float,2>{0.62014538f, 0.483499259f},
-std::array<float,2>{0.841705203f, 0.827170312f},
-std::array<float,2>{0.272713631f, 0.175150618f},
-std::array<float,2>{0.431550115f, 0.882863343f},
-std::array<float,2>{0.914020598f, 0.0912213176f},
-std::array<float,2>{0.725303948f, 0.545365632f},
-std::array<float,2>{0.123413339f, 0.251927316f},
-std::array<float,2>{0.364018649f, 0.603637636f},
-std::array<float,2>{0.808845937f, 0.333337188f},
-std::array<float,2>{0.535951614f, 0.954352379f},
-std::array<float,2>{0.158425227f, 0.0355578586f},
-std::array<float,2>{0.0250006579f, 0.797835648f},
-std::array<float,2>{0.625376344f, 0.19201012f},
-std::array<float,2>{0.94821763f, 0.71184051f},
-std::array<float,2>{0.485321075f, 0.390317112f},
-std::array<float,2>{0.0705191344f, 0.523125768f},
-std::array<float,2>{0.697180569f, 0.304820806f},
-std::array<float,2>{0.894304276f, 0.917371452f},
-std::array<float,2>{0.401822597f, 0.120282829f},
-std::array<float,2>{0.308650583f, 0.851857781f},
-std::array<float,2>{0.868260801f, 0.135603443f},
-std::array<float,2>{0.567010105f, 0.637390971f},
-std::array<float,2>{0.237022147f, 0.45532459f},
-std::array<float,2>{0.463499546f, 0.734883606f},
-std::array<float,2>{0.98973757f, 0.415407181f},
-std::array<float,2>{0.684217334f, 0.774284661f},
-std::array<float,2>{0.0475283638f, 0.222287133f},
-std::array<float,2>{0.144431978f, 0.986299992f},
-std::array<float,2>{0.501936138f, 0.0035434505f},
-std::array<float,2>{0.772642732f, 0.575055063f},
-std::array<float,2>{0.333129913f, 0.367709368f},
-std::array<float,2>{0.210463196f, 0.590927601f},
-std::array<float,2>{0.624962986f, 0.357553184f},
-std::array<float,2>{0.839639902f, 0.971863508f},
-std::array<float,2>{0.267047733f, 0.0174900889f},
-std::array<float,2>{0.435199291f, 0.753247678f},
-std::array<float,2>{0.907305956f, 0.235858887f},
-std::array<float,2>{0.719136596f, 0.719037056f},
-std::array<float,2>{0.120196588f, 0.435749561f},
-std::array<float,2>{0.361278176f, 0.654304743f},
-std::array<float,2>{0.807271183f, 0.445287436f},
-std::array<float,2>{0.532959461f, 0.867960215f},
-std::array<float,2>{0.161189079f, 0.154395252f},
-std::array<float,2>{0.0279327296f, 0.925867796f},
-std::array<float,2>{0.630782425f, 0.0953409672f},
-std::array<float,2>{0.949459791f, 0.509563684f},
-std::array<float,2>{0.489321917f, 0.292547494f},
-std::array<float,2>{0.0754382536f, 0.702185094f},
-std::array<float,2>{0.699383438f, 0.391203254f},
-std::array<float,2>{0.894665718f, 0.788889229f},
-std::array<float,2>{0.402345896f, 0.217442781f},
-std::array<float,2>{0.308496237f, 0.939099967f},
-std::array<float,2>{0.874346554f, 0.0525461994f},
-std::array<float,2>{0.563123226f, 0.617527366f},
-std::array<float,2>{0.241834536f, 0.320525467f},
-std::array<float,2>{0.468146533f, 0.554773927f},
-std::array<float,2>{0.985450745f, 0.267964751f},
-std::array<float,2>{0.680881262f, 0.906128943f},
-std::array<float,2>{0.0541037321f, 0.0630429909f},
-std::array<float,2>{0.144626543f, 0.839844525f},
-std::array<float,2>{0.505829751f, 0.167172492f},
-std::array<float,2>{0.76914835f, 0.656655669f},
-std::array<float,2>{0.330992937f, 0.498893678f},
-std::array<float,2>{0.179346517f, 0.677165329f},
-std::array<float,2>{0.558375418f, 0.47532323f},
-std::array<float,2>{0.788121283f, 0.814062595f},
-std::array<float,2>{0.344570309f, 0.180717409f},
-std::array<float,2>{0.475917727f, 0.875744224f},
-std::array<float,2>{0.96442312f, 0.0835284814f},
-std::array<float,2>{0.651522517f, 0.535952568f},
-std::array<float,2>{0.00963610411f, 0.260973483f},
-std::array<float,2>{0.263500065f, 0.600139081f},
-std::array<float,2>{0.826502979f, 0.340765297f},
-std::array<float,2>{0.602477968f, 0.968302846f},
-std::array<float,2>{0.190827504f, 0.0422156341f},
-std::array<float,2>{0.0983013585f, 0.807084262f},
-std::array<float,2>{0.736825705f, 0.19653362f},
-std::array<float,2>{0.926422179f, 0.708221912f},
-std::array<float,2>{0.406962186f, 0.377091885f},
-std::array<float,2>{0.0444505215f, 0.5272668f},
-std::array<float,2>{0.671216428f, 0.297036499f},
-std::array<float,2>{0.984074295f, 0.912073135f},
-std::array<float,2>{0.448898911f, 0.112943232f},
-std::array<float,2>{0.319293141f, 0.847283781f},
-std::array<float,2>{0.764369965f, 0.131004766f},
-std::array<float,2>{0.51891923f, 0.62844348f},
-std::array<float,2>{0.130211964f, 0.463322014f},
-std::array<float,2>{0.389200628f, 0.748793662f},
-std::array<float,2>{0.880163252f, 0.407361716f},
-std::array<float,2>{0.712932587f, 0.767218828f},
-std::array<float,2>{0.0876008347f, 0.227875739f},
-std::array<float,2>{0.231629223f, 0.999660969f},
-std::array<float,2>{0.584152043f, 0.0156192649f},
-std::array<float,2>{0.857478976f, 0.569072843f},
-std::array<float,2>{0.295387745f, 0.364704192f},
-std::array<float,2>{0.132904828f, 0.539164484f},
-std::array<float,2>{0.529437006f, 0.257803768f},
-std::array<float,2>{0.750079274f, 0.887795627f},
-std::array<float,2>{0.32284224f, 0.0881056339f},
-std::array<float,2>{0.438218206f, 0.821775019f},
-std::array<float,2>{0.972339809f, 0.176210135f},
-std::array<float,2>{0.656652272f, 0.681018353f},
-std::array<float,2>{0.0327064171f, 0.480195522f},
-std::array<float,2>{0.284870803f, 0.718339741f},
-std::array<float,2>{0.847410917f, 0.386634797f},
-std::array<float,2>{0.589376509f, 0.804131508f},
-std::array<float,2>{0.2217969f, 0.190430239f},
-std::array<float,2>{0.0808192268f, 0.960758269f},
-std::array<float,2>{0.707735896f, 0.0331363454f},
-std::array<float,2>{0.886488676f, 0.608256459f},
-std::array<float,2>{0.379917622f, 0.331841856f},
-std::array<float,2>{0.00551243871f, 0.634380758f},
-std::array<float,2>{0.644269109f, 0.457643211f},
-std::array<float,2>{0.956960797f, 0.856177747f},
-std::array<float,2>{0.481491029f, 0.137737051f},
-std::array<float,2>{0.357699215f, 0.920866668f},
-std::array<float,2>{0.792666972f, 0.121402666f},
-std::array<float,2>{0.552396178f, 0.516232252f},
-std::array<float,2>{0.180821314f, 0.310551584f},
-std::array<float,2>{0.419161409f, 0.571526945f},
-std::array<float,2>{0.936903596f, 0.373521268f},
-std::array<float,2>{0.748457849f, 0.98984462f},
-std::array<float,2>{0.10794948f, 0.00463109603f},
-std::array<float,2>{0.20190683f, 0.778994441f},
-std::array<float,2>{0.596544385f, 0.226469547f},
-std::array<float,2>{0.81973201f, 0.74175787f},
-std::array<float,2>{0.255500764f, 0.419992507f},
-std::array<float,2>{0.244917303f, 0.73053956f},
-std::array<float,2>{0.571714163f, 0.421948791f},
-std::array<float,2>{0.861839354f, 0.757915497f},
-std::array<float,2>{0.297282279f, 0.242590874f},
-std::array<float,2>{0.395919144f, 0.983999431f},
-std::array<float,2>{0.903859138f, 0.0272930618f},
-std::array<float,2>{0.689096272f, 0.583520353f},
-std::array<float,2>{0.065421842f, 0.346605301f},
-std::array<float,2>{0.339314878f, 0.505563617f},
-std::array<float,2>{0.773983717f, 0.286395967f},
-std::array<float,2>{0.512098014f, 0.93129611f},
-std::array<float,2>{0.153774962f, 0.104094587f},
-std::array<float,2>{0.0620982908f, 0.861290991f},
-std::array<float,2>{0.675640821f, 0.144856349f},
-std::array<float,2>{0.996751368f, 0.644303024f},
-std::array<float,2>{0.460602343f, 0.447010279f},
-std::array<float,2>{0.112057298f, 0.610951781f},
-std::array<float,2>{0.72925061f, 0.318967313f},
-std::array<float,2>{0.915234387f, 0.951022089f},
-std::array<float,2>{0.422788352f, 0.0591939241f},
-std::array<float,2>{0.274862587f, 0.795522928f},
-std::array<float,2>{0.830641448f, 0.208994359f},
-std::array<float,2>{0.612132311f, 0.692479789f},
-std::array<float,2>{0.215474114f, 0.403740734f},
-std::array<float,2>{0.493045926f, 0.669183552f},
-std::array<float,2>{0.941085994f, 0.485567719f},
-std::array<float,2>{0.636213005f, 0.831206024f},
-std::array<float,2>{0.0166290049f, 0.16162163f},
-std::array<float,2>{0.17168507f, 0.898030579f},
-std::array<float,2>{0.546826124f, 0.0723830536f},
-std::array<float,2>{0.799265504f, 0.54945749f},
-std::array<float,2>{0.371960759f, 0.277290463f},
-std::array<float,2>{0.223370716f, 0.513296247f},
-std::array<float,2>{0.593620062f, 0.295503795f},
-std::array<float,2>{0.84913224f, 0.924991548f},
-std::array<float,2>{0.285312206f, 0.098142311f},
-std::array<float,2>{0.375506967f, 0.874901474f},
-std::array<float,2>{0.889369786f, 0.150055647f},
-std::array<float,2>{0.705381334f, 0.649198234f},
-std::array<float,2>{0.0838257223f, 0.441356361f},
-std::array<float,2>{0.325420529f, 0.725139201f},
-std::array<float,2>{0.754937649f, 0.433284581f},
-std::array<float,2>{0.526820004f, 0.757297099f},
-std::array<float,2>{0.138743728f, 0.242126286f},
-std::array<float,2>{0.036535535f, 0.973676503f},
-std::array<float,2>{0.660837293f, 0.020076558f},
-std::array<float,2>{0.975159287f, 0.587194622f},
-std::array<float,2>{0.444048494f, 0.351691753f},
-std::array<float,2>{0.103154264f, 0.663541377f},
-std::array<float,2>{0.743288934f, 0.494542927f},
-std::array<float,2>{0.932838321f, 0.838740885f},
-std::array<float,2>{0.416874439f, 0.17138502f},
-std::array<float,2>{0.25053668f, 0.899525225f},
-std::array<float,2>{0.813098788f, 0.0678891614f},
-std::array<float,2>{0.600231051f, 0.560041964f},
-std::array<float,2>{0.196290553f, 0.273242831f},
-std::array<float,2>{0.479035914f, 0.624352157f},
-std::array<float,2>{0.960756123f, 0.325300664f},
-std::array<float,2>{0.644660056f, 0.944305599f},
-std::array<float,2>{0.00375350704f, 0.047371164f},
-std::array<float,2>{0.186389655f, 0.783660769f},
-std::array<float,2>{0.550368011f, 0.213453099f},
-std::array<float,2>{0.794742286f, 0.697425485f},
-std::array<float,2>{0.353688329f, 0.394885629f},
-std::array<float,2>{0.148871571f, 0.706543803f},
-std::array<float,2>{0.508031905f, 0.379560322f},
-std::array<float,2>{0.777513683f, 0.810029745f},
-std::array<float,2>{0.342502952f, 0.201676115f},
-std::array<float,2>{0.455571949f, 0.964199781f},
-std::array<float,2>{0.992866278f, 0.046841003f},
-std::array<float,2>{0.679565728f, 0.594625711f},
-std::array<float,2>{0.0549638346f, 0.338544309f},
-std::array<float,2>{0.302949905f, 0.532157481f},
-std::array<float,2>{0.864181101f, 0.264448404f},
-std::array<float,2>{0.577309966f, 0.880484343f},
-std::array<float,2>{0.247906834f, 0.079657577f},
-std::array<float,2>{0.0668625832f, 0.816525698f},
-std::array<float,2>{0.693174005f, 0.186908692f},
-std::array<float,2>{0.900356352f, 0.675185621f},
-std::array<float,2>{0.391361952f, 0.470297128f},
-std::array<float,2>{0.0198158994f, 0.565456629f},
-std::array<float,2>{0.63996172f, 0.362882406f},
-std::array<float,2>{0.945092261f, 0.993010759f},
-std::array<float,2>{0.496156752f, 0.00866892189f},
-std::array<float,2>{0.371049613f, 0.771714389f},
-std::array<float,2>{0.801892519f, 0.231616825f},
-std::array<float,2>{0.539655685f, 0.742527544f},
-std::array<float,2>{0.166864365f, 0.412730962f},
-std::array<float,2>{0.428925812f, 0.629096746f},
-std::array<float,2>{0.920066714f, 0.467070311f},
-std::array<float,2>{0.730557919f, 0.85089463f},
-std::array<float,2>{0.113447852f, 0.128745362f},
-std::array<float,2>{0.212010652f, 0.909083128f},
-std::array<float,2>{0.616978407f, 0.115212552f},
-std::array<float,2>{0.835034251f, 0.528369546f},
-std::array<float,2>{0.280217797f, 0.304547668f},
-std::array<float,2>{0.159555838f, 0.601853788f},
-std::array<float,2>{0.537059367f, 0.334792167f},
-std::array<float,2>{0.809913099f, 0.956106424f},
-std::array<float,2>{0.364599109f, 0.0385695659f},
-std::array<float,2>{0.485392392f, 0.799073815f},
-std::array<float,2>{0.948243082f, 0.193403482f},
-std::array<float,2>{0.626720667f, 0.714804292f},
-std::array<float,2>{0.0237776823f, 0.387192607f},
-std::array<float,2>{0.272315592f, 0.685653031f},
-std::array<float,2>{0.83994323f, 0.481381059f},
-std::array<float,2>{0.619947016f, 0.82423991f},
-std::array<float,2>{0.204548851f, 0.173366949f},
-std::array<float,2>{0.124685042f, 0.885083258f},
-std::array<float,2>{0.726233542f, 0.0933061466f},
-std::array<float,2>{0.912595987f, 0.543022335f},
-std::array<float,2>{0.429810643f, 0.25240472f},
-std::array<float,2>{0.0486163422f, 0.738019049f},
-std::array<float,2>{0.685486376f, 0.416662395f},
-std::array<float,2>{0.988761544f, 0.777013242f},
-std::array<float,2>{0.464195043f, 0.218791902f},
-std::array<float,2>{0.332901895f, 0.9871099f},
-std::array<float,2>{0.77192831f, 0.00144191703f},
-std::array<float,2>{0.500591397f, 0.577858686f},
-std::array<float,2>{0.143067837f, 0.370543182f},
-std::array<float,2>{0.400972545f, 0.521453917f},
-std::array<float,2>{0.893410206f, 0.308358848f},
-std::array<float,2>{0.696151316f, 0.915733635f},
-std::array<float,2>{0.0717440993f, 0.117604479f},
-std::array<float,2>{0.237668067f, 0.854063332f},
-std::array<float,2>{0.568185568f, 0.134735182f},
-std::array<float,2>{0.867786348f, 0.640268922f},
-std::array<float,2>{0.309621125f, 0.453641534f},
-std::array<float,2>{0.193581045f, 0.647335291f},
-std::array<float,2>{0.607946813f, 0.451642662f},
-std::array<float,2>{0.822125554f, 0.865060389f},
-std::array<float,2>{0.257841349f, 0.142428681f},
-std::array<float,2>{0.412280589f, 0.935494304f},
-std::array<float,2>{0.923820913f, 0.107118294f},
-std::array<float,2>{0.74151504f, 0.502700686f},
-std::array<float,2>{0.0956790149f, 0.28174156f},
-std::array<float,2>{0.351027548f, 0.579617858f},
-std::array<float,2>{0.78167063f, 0.348775655f},
-std::array<float,2>{0.560043693f, 0.977066517f},
-std::array<float,2>{0.174074903f, 0.029024506f},
-std::array<float,2>{0.0137974648f, 0.762616694f},
-std::array<float,2>{0.653985202f, 0.247005746f},
-std::array<float,2>{0.968718946f, 0.728878558f},
-std::array<float,2>{0.471215338f, 0.427595496f},
-std::array<float,2>{0.0911444202f, 0.55416292f},
-std::array<float,2>{0.716623008f, 0.27777952f},
-std::array<float,2>{0.876410842f, 0.890946746f},
-std::array<float,2>{0.385625392f, 0.0774665177f},
-std::array<float,2>{0.289126188f, 0.835320115f},
-std::array<float,2>{0.853683829f, 0.156446353f},
-std::array<float,2>{0.581526577f, 0.664160371f},
-std::array<float,2>{0.230421141f, 0.491405219f},
-std::array<float,2>{0.451091647f, 0.687729716f},
-std::array<float,2>{0.978391767f, 0.400939107f},
-std::array<float,2>{0.666001797f, 0.79170984f},
-std::array<float,2>{0.0428853445f, 0.204299465f},
-std::array<float,2>{0.126364008f, 0.948000848f},
-std::array<float,2>{0.521121562f, 0.0583498031f},
-std::array<float,2>{0.761697352f, 0.615226805f},
-std::array<float,2>{0.314719141f, 0.31349811f},
-std::array<float,2>{0.239303201f, 0.619318068f},
-std::array<float,2>{0.565082133f, 0.323444426f},
-std::array<float,2>{0.871648431f, 0.941373467f},
-std::array<float,2>{0.306166857f, 0.0534014553f},
-std::array<float,2>{0.405429512f, 0.786162257f},
-std::array<float,2>{0.89770937f, 0.215485677f},
-std::array<float,2>{0.70261991f, 0.700035572f},
-std::array<float,2>{0.0769039541f, 0.393170029f},
-std::array<float,2>{0.328589916f, 0.659573138f},
-std::array<float,2>{0.765758276f, 0.497768462f},
-std::array<float,2>{0.50623399f, 0.843432248f},
-std::array<float,2>{0.14838846f, 0.165643945f},
-std::array<float,2>{0.0515897498f, 0.903701246f},
-std::array<float,2>{0.682173729f, 0.0658826083f},
-std::array<float,2>{0.98654294f, 0.558195412f},
-std::array<float,2>{0.465906948f, 0.266803235f},
-std::array<float,2>{0.119004011f, 0.72105217f},
-std::array<float,2>{0.722178757f, 0.434912354f},
-std::array<float,2>{0.909365952f, 0.750014186f},
-std::array<float,2>{0.435598373f, 0.237944871f},
-std::array<float,2>{0.269448638f, 0.970235109f},
-std::array<float,2>{0.837468922f, 0.0185638927f},
-std::array<float,2>{0.621124268f, 0.593642414f},
-std::array<float,2>{0.20806706f, 0.35735482f},
-std::array<float,2>{0.490249932f, 0.51090169f},
-std::array<float,2>{0.951273382f, 0.290205151f},
-std::array<float,2>{0.631042302f, 0.928360701f},
-std::array<float,2>{0.0310543533f, 0.0969006792f},
-std::array<float,2>{0.163591653f, 0.870647669f},
-std::array<float,2>{0.534763992f, 0.15289101f},
-std::array<float,2>{0.804796576f, 0.653362811f},
-std::array<float,2>{0.36220938f, 0.443111897f},
-std::array<float,2>{0.131884113f, 0.626856387f},
-std::array<float,2>{0.517519772f, 0.462026894f},
-std::array<float,2>{0.76324439f, 0.845326602f},
-std::array<float,2>{0.317385793f, 0.129287243f},
-std::array<float,2>{0.446241826f, 0.91343224f},
-std::array<float,2>{0.98225522f, 0.109539263f},
-std::array<float,2>{0.669496357f, 0.524622381f},
-std::array<float,2>{0.0453502685f, 0.299260199f},
-std::array<float,2>{0.294445217f, 0.567499399f},
-std::array<float,2>{0.855480194f, 0.36589542f},
-std::array<float,2>{0.58376956f, 0.997543097f},
-std::array<float,2>{0.233658478f, 0.0118326433f},
-std::array<float,2>{0.0885911286f, 0.767948568f},
-std::array<float,2>{0.71279639f, 0.2298498f},
-std::array<float,2>{0.882378042f, 0.746388912f},
-std::array<float,2>{0.387287945f, 0.409261882f},
-std::array<float,2>{0.0105201388f, 0.537141204f},
-std::array<float,2>{0.648523152f, 0.258789212f},
-std::array<float,2>{0.962278306f, 0.877179503f},
-std::array<float,2>{0.473412424f, 0.0854141414f},
-std::array<float,2>{0.346770138f, 0.81456995f},
-std::array<float,2>{0.78621465f, 0.183562919f},
-std::array<float,2>{0.556271911f, 0.678955615f},
-std::array<float,2>{0.176569939f, 0.473347753f},
-std::array<float,2>{0.40945664f, 0.709033012f},
-std::array<float,2>{0.928376257f, 0.376507372f},
-std::array<float,2>{0.735453129f, 0.806501865f},
-std::array<float,2>{0.100887202f, 0.197494477f},
-std::array<float,2>{0.188473016f, 0.96669364f},
-std::array<float,2>{0.605312109f, 0.0396051146f},
-std::array<float,2>{0.824707389f, 0.598971546f},
-std::array<float,2>{0.265078336f, 0.343638271f},
-std::array<float,2>{0.183263212f, 0.518890798f},
-std::array<float,2>{0.553198993f, 0.309948742f},
-std::array<float,2>{0.79035002f, 0.91858983f},
-std::array<float,2>{0.356930673f, 0.124758236f},
-std::array<float,2>{0.483992249f, 0.858628511f},
-std::array<float,2>{0.955052555f, 0.139679059f},
-std::array<float,2>{0.642405868f, 0.635066867f},
-std::array<float,2>{0.00710748881f, 0.459126353f},
-std::array<float,2>{0.25760591f, 0.738292277f},
-std::array<float,2>{0.817374229f, 0.419318795f},
-std::array<float,2>{0.594383776f, 0.780907869f},
-std::array<float,2>{0.200998038f, 0.222863436f},
-std::array<float,2>{0.106627494f, 0.991925359f},
-std::array<float,2>{0.747272551f, 0.0068290527f},
-std::array<float,2>{0.935130835f, 0.572850168f},
-std::array<float,2>{0.420934707f, 0.3714737f},
-std::array<float,2>{0.0341252908f, 0.682781458f},
-std::array<float,2>{0.659216285f, 0.476673067f},
-std::array<float,2>{0.969787002f, 0.823002815f},
-std::array<float,2>{0.439901173f, 0.178069815f},
-std::array<float,2>{0.320939779f, 0.889970541f},
-std::array<float,2>{0.753877044f, 0.0873579085f},
-std::array<float,2>{0.529222667f, 0.541983724f},
-std::array<float,2>{0.135459617f, 0.255644023f},
-std::array<float,2>{0.381980032f, 0.605681896f},
-std::array<float,2>{0.883006632f, 0.328399956f},
-std::array<float,2>{0.710509062f, 0.958577514f},
-std::array<float,2>{0.0785640031f, 0.033768218f},
-std::array<float,2>{0.219509646f, 0.801679254f},
-std::array<float,2>{0.587542653f, 0.187531874f},
-std::array<float,2>{0.8454445f, 0.715097725f},
-std::array<float,2>{0.281680703f, 0.383694023f},
-std::array<float,2>{0.218584076f, 0.695004046f},
-std::array<float,2>{0.61130929f, 0.404588848f},
-std::array<float,2>{0.828369617f, 0.793350458f},
-std::array<float,2>{0.276709229f, 0.207730681f},
-std::array<float,2>{0.424474984f, 0.95285511f},
-std::array<float,2>{0.916076183f, 0.0622258335f},
-std::array<float,2>{0.727058768f, 0.612460613f},
-std::array<float,2>{0.109776258f, 0.316464245f},
-std::array<float,2>{0.373364836f, 0.547262847f},
-std::array<float,2>{0.79781425f, 0.273610324f},
-std::array<float,2>{0.543951571f, 0.895272553f},
-std::array<float,2>{0.168974265f, 0.0707195327f},
-std::array<float,2>{0.0177496467f, 0.829379439f},
-std::array<float,2>{0.634151816f, 0.162913889f},
-std::array<float,2>{0.93793726f, 0.670935988f},
-std::array<float,2>{0.494779408f, 0.487407595f},
-std::array<float,2>{0.064068377f, 0.584991932f},
-std::array<float,2>{0.689832985f, 0.344587207f},
-std::array<float,2>{0.904570878f, 0.981184125f},
-std::array<float,2>{0.397448957f, 0.0238378141f},
-std::array<float,2>{0.300165921f, 0.761158586f},
-std::array<float,2>{0.859737277f, 0.245365888f},
-std::array<float,2>{0.573829293f, 0.733347237f},
-std::array<float,2>{0.243206188f, 0.425690889f},
-std::array<float,2>{0.45807302f, 0.642288864f},
-std::array<float,2>{0.998160362f, 0.447738618f},
-std::array<float,2>{0.672206402f, 0.861721337f},
-std::array<float,2>{0.0601326115f, 0.148190841f},
-std::array<float,2>{0.154464573f, 0.933492422f},
-std::array<float,2>{0.514446735f, 0.101946175f},
-std::array<float,2>{0.777290761f, 0.50759542f},
-std::array<float,2>{0.336762935f, 0.287923604f},
-std::array<float,2>{0.198382169f, 0.561907113f},
-std::array<float,2>{0.598962605f, 0.270115435f},
-std::array<float,2>{0.816006541f, 0.902286708f},
-std::array<float,2>{0.252044022f, 0.0702072233f},
-std::array<float,2>{0.414203405f, 0.835990787f},
-std::array<float,2>{0.930321395f, 0.16954197f},
-std::array<float,2>{0.744150341f, 0.660463333f},
-std::array<float,2>{0.10386534f, 0.492807597f},
-std::array<float,2>{0.352195859f, 0.696161449f},
-std::array<float,2>{0.795014858f, 0.39682889f},
-std::array<float,2>{0.54710269f, 0.782867253f},
-std::array<float,2>{0.185395584f, 0.212395847f},
-std::array<float,2>{0.000857326668f, 0.942658186f},
-std::array<float,2>{0.646678925f, 0.0501685105f},
-std::array<float,2>{0.957352459f, 0.621831596f},
-std::array<float,2>{0.478095084f, 0.328104138f},
-std::array<float,2>{0.0847572312f, 0.650420427f},
-std::array<float,2>{0.703175604f, 0.437708259f},
-std::array<float,2>{0.887860179f, 0.872401774f},
-std::array<float,2>{0.378681183f, 0.15133585f},
-std::array<float,2>{0.287653863f, 0.922531247f},
-std::array<float,2>{0.851040363f, 0.101162814f},
-std::array<float,2>{0.590485394f, 0.515545964f},
-std::array<float,2>{0.225376979f, 0.294666201f},
-std::array<float,2>{0.442656487f, 0.588177025f},
-std::array<float,2>{0.972972691f, 0.353840411f},
-std::array<float,2>{0.662822783f, 0.974928319f},
-std::array<float,2>{0.0373140424f, 0.021874601f},
-std::array<float,2>{0.137879163f, 0.754924059f},
-std::array<float,2>{0.523945987f, 0.240156889f},
-std::array<float,2>{0.756141782f, 0.724454939f},
-std::array<float,2>{0.328077435f, 0.429754078f},
-std::array<float,2>{0.164909139f, 0.744524002f},
-std::array<float,2>{0.542463362f, 0.411948979f},
-std::array<float,2>{0.803099632f, 0.769612014f},
-std::array<float,2>{0.367629439f, 0.23270224f},
-std::array<float,2>{0.498903424f, 0.995923817f},
-std::array<float,2>{0.942901433f, 0.0108304406f},
-std::array<float,2>{0.637034059f, 0.563170195f},
-std::array<float,2>{0.0223256759f, 0.361172885f},
-std::array<float,2>{0.277531147f, 0.529644489f},
-std::array<float,2>{0.832306266f, 0.301870733f},
-std::array<float,2>{0.613418877f, 0.906926274f},
-std::array<float,2>{0.213096231f, 0.116910234f},
-std::array<float,2>{0.11533539f, 0.848535717f},
-std::array<float,2>{0.733294189f, 0.126170695f},
-std::array<float,2>{0.919077873f, 0.63167268f},
-std::array<float,2>{0.426074386f, 0.466015548f},
-std::array<float,2>{0.0585334599f, 0.596740603f},
-std::array<float,2>{0.676128745f, 0.335966319f},
-std::array<float,2>{0.995607972f, 0.962478161f},
-std::array<float,2>{0.454782128f, 0.04440156f},
-std::array<float,2>{0.340258926f, 0.812451184f},
-std::array<float,2>{0.78089124f, 0.199388415f},
-std::array<float,2>{0.510897815f, 0.70349139f},
-std::array<float,2>{0.15040113f, 0.380974293f},
-std::array<float,2>{0.393138498f, 0.672814131f},
-std::array<float,2>{0.901914716f, 0.472157717f},
-std::array<float,2>{0.694293797f, 0.819747984f},
-std::array<float,2>{0.0692033544f, 0.184588477f},
-std::array<float,2>{0.24807848f, 0.88147974f},
-std::array<float,2>{0.576087534f, 0.0818168223f},
-std::array<float,2>{0.866339445f, 0.533783078f},
-std::array<float,2>{0.301475734f, 0.261875153f},
-std::array<float,2>{0.141844988f, 0.57579881f},
-std::array<float,2>{0.502453566f, 0.368700653f},
-std::array<float,2>{0.770309567f, 0.985232413f},
-std::array<float,2>{0.335101396f, 0.00246322644f},
-std::array<float,2>{0.461244196f, 0.77512145f},
-std::array<float,2>{0.990737975f, 0.22152023f},
-std::array<float,2>{0.687362671f, 0.736219168f},
-std::array<float,2>{0.0488850214f, 0.414491832f},
-std::array<float,2>{0.312212527f, 0.63856703f},
-std::array<float,2>{0.869366229f, 0.457025498f},
-std::array<float,2>{0.569432616f, 0.852694571f},
-std::array<float,2>{0.234607413f, 0.136099398f},
-std::array<float,2>{0.0738340691f, 0.916334867f},
-std::array<float,2>{0.698096097f, 0.119279429f},
-std::array<float,2>{0.891460598f, 0.52175349f},
-std::array<float,2>{0.399840325f, 0.305791438f},
-std::array<float,2>{0.0256768875f, 0.712762654f},
-std::array<float,2>{0.626972735f, 0.389441401f},
-std::array<float,2>{0.945337892f, 0.798245609f},
-std::array<float,2>{0.487651885f, 0.192682609f},
-std::array<float,2>{0.36531058f, 0.953136027f},
-std::array<float,2>{0.812023461f, 0.0362969525f},
-std::array<float,2>{0.537912846f, 0.604525328f},
-std::array<float,2>{0.15748623f, 0.332733691f},
-std::array<float,2>{0.432466924f, 0.546857417f},
-std::array<float,2>{0.911874771f, 0.250477761f},
-std::array<float,2>{0.724064231f, 0.884004295f},
-std::array<float,2>{0.122918941f, 0.0898975134f},
-std::array<float,2>{0.205409169f, 0.827044606f},
-std::array<float,2>{0.618639529f, 0.174363047f},
-std::array<float,2>{0.84364146f, 0.685525954f},
-std::array<float,2>{0.271407396f, 0.48249796f},
-std::array<float,2>{0.228072733f, 0.667824388f},
-std::array<float,2>{0.579029918f, 0.48907131f},
-std::array<float,2>{0.853432298f, 0.833641946f},
-std::array<float,2>{0.29221943f, 0.158940196f},
-std::array<float,2>{0.383814394f, 0.893358469f},
-std::array<float,2>{0.878191829f, 0.0760590285f},
-std::array<float,2>{0.718198001f, 0.551162243f},
-std::array<float,2>{0.092999056f, 0.279636711f},
-std::array<float,2>{0.313579261f, 0.616660953f},
-std::array<float,2>{0.759185433f, 0.316128373f},
-std::array<float,2>{0.522695124f, 0.946690857f},
-std::array<float,2>{0.127043888f, 0.0552861914f},
-std::array<float,2>{0.0395039693f, 0.789951086f},
-std::array<float,2>{0.66667217f, 0.205166668f},
-std::array<float,2>{0.980369806f, 0.689855874f},
-std::array<float,2>{0.452686399f, 0.398549229f},
-std::array<float,2>{0.0966280997f, 0.501036286f},
-std::array<float,2>{0.739392877f, 0.284633666f},
-std::array<float,2>{0.924377978f, 0.937480688f},
-std::array<float,2>{0.410807878f, 0.109116487f},
-std::array<float,2>{0.260000765f, 0.866002977f},
-std::array<float,2>{0.823481381f, 0.143464759f},
-std::array<float,2>{0.606930614f, 0.646181285f},
-std::array<float,2>{0.19271256f, 0.450702727f},
-std::array<float,2>{0.468870819f, 0.727100611f},
-std::array<float,2>{0.966758549f, 0.4294146f},
-std::array<float,2>{0.655017793f, 0.765128136f},
-std::array<float,2>{0.0117829116f, 0.248498917f},
-std::array<float,2>{0.172722742f, 0.978768349f},
-std::array<float,2>{0.561442018f, 0.0302833524f},
-std::array<float,2>{0.784417987f, 0.58012116f},
-std::array<float,2>{0.349307299f, 0.351276785f},
-std::array<float,2>{0.243686244f, 0.583345532f},
-std::array<float,2>{0.573558033f, 0.34586069f},
-std::array<float,2>{0.86002773f, 0.983810484f},
-std::array<float,2>{0.300357789f, 0.0265851263f},
-std::array<float,2>{0.396823645f, 0.758387446f},
-std::array<float,2>{0.905070364f, 0.243003756f},
-std::array<float,2>{0.69030273f, 0.731032014f},
-std::array<float,2>{0.0637371764f, 0.422814161f},
-std::array<float,2>{0.336380988f, 0.643561065f},
-std::array<float,2>{0.776673317f, 0.446401387f},
-std::array<float,2>{0.513973951f, 0.860618472f},
-std::array<float,2>{0.154830515f, 0.145082191f},
-std::array<float,2>{0.059993241f, 0.931010485f},
-std::array<float,2>{0.672747016f, 0.103581637f},
-std::array<float,2>{0.998963296f, 0.505275071f},
-std::array<float,2>{0.458688915f, 0.286739022f},
-std::array<float,2>{0.110298425f, 0.693169713f},
-std::array<float,2>{0.726960063f, 0.404007733f},
-std::array<float,2>{0.916887641f, 0.794989824f},
-std::array<float,2>{0.424040347f, 0.20972842f},
-std::array<float,2>{0.277224243f, 0.950289488f},
-std::array<float,2>{0.828961611f, 0.0587722249f},
-std::array<float,2>{0.610580981f, 0.610637546f},
-std::array<float,2>{0.21793431f, 0.318535239f},
-std::array<float,2>{0.494519919f, 0.548890054f},
-std::array<float,2>{0.938273787f, 0.276436627f},
-std::array<float,2>{0.634619355f, 0.897733927f},
-std::array<float,2>{0.0185215138f, 0.0728346333f},
-std::array<float,2>{0.169847429f, 0.831552446f},
-std::array<float,2>{0.544845343f, 0.161384583f},
-std::array<float,2>{0.797348082f, 0.669890702f},
-std::array<float,2>{0.373575151f, 0.485846698f},
-std::array<float,2>{0.135087863f, 0.681382f},
-std::array<float,2>{0.528752565f, 0.479634881f},
-std::array<float,2>{0.753097296f, 0.822050869f},
-std::array<float,2>{0.320350915f, 0.176537633f},
-std::array<float,2>{0.440294832f, 0.888567686f},
-std::array<float,2>{0.970313489f, 0.0884058252f},
-std::array<float,2>{0.659979343f, 0.539990604f},
-std::array<float,2>{0.0335105397f, 0.25726518f},
-std::array<float,2>{0.281746715f, 0.607792974f},
-std::array<float,2>{0.844801366f, 0.331115752f},
-std::array<float,2>{0.587085783f, 0.960248768f},
-std::array<float,2>{0.219032213f, 0.0322558358f},
-std::array<float,2>{0.0789504051f, 0.804260373f},
-std::array<float,2>{0.70997721f, 0.191155061f},
-std::array<float,2>{0.883367956f, 0.717999578f},
-std::array<float,2>{0.382688046f, 0.386044472f},
-std::array<float,2>{0.00739036361f, 0.515823364f},
-std::array<float,2>{0.642039478f, 0.311186522f},
-std::array<float,2>{0.954392254f, 0.919942677f},
-std::array<float,2>{0.483657271f, 0.121628076f},
-std::array<float,2>{0.357087165f, 0.855873406f},
-std::array<float,2>{0.790808141f, 0.138387427f},
-std::array<float,2>{0.553665996f, 0.633929908f},
-std::array<float,2>{0.18272607f, 0.457266539f},
-std::array<float,2>{0.421837568f, 0.74138546f},
-std::array<float,2>{0.934738874f, 0.420482159f},
-std::array<float,2>{0.747981846f, 0.778468132f},
-std::array<float,2>{0.107307144f, 0.225615352f},
-std::array<float,2>{0.200649917f, 0.989455462f},
-std::array<float,2>{0.593909919f, 0.00405033072f},
-std::array<float,2>{0.816747248f, 0.572228312f},
-std::array<float,2>{0.257030785f, 0.373771131f},
-std::array<float,2>{0.175835922f, 0.535422146f},
-std::array<float,2>{0.555710673f, 0.261402518f},
-std::array<float,2>{0.786816716f, 0.875379622f},
-std::array<float,2>{0.347417146f, 0.0833151117f},
-std::array<float,2>{0.472750753f, 0.813858986f},
-std::array<float,2>{0.962822497f, 0.181473181f},
-std::array<float,2>{0.649224043f, 0.677428126f},
-std::array<float,2>{0.00990162697f, 0.475055963f},
-std::array<float,2>{0.265470445f, 0.708825886f},
-std::array<float,2>{0.824570656f, 0.377865762f},
-std::array<float,2>{0.604865849f, 0.807587862f},
-std::array<float,2>{0.187847674f, 0.197160974f},
-std::array<float,2>{0.101378098f, 0.96808362f},
-std::array<float,2>{0.735867262f, 0.042570021f},
-std::array<float,2>{0.928037107f, 0.59985286f},
-std::array<float,2>{0.410020649f, 0.340008169f},
-std::array<float,2>{0.045588173f, 0.62824142f},
-std::array<float,2>{0.669238508f, 0.463441819f},
-std::array<float,2>{0.98180306f, 0.846832931f},
-std::array<float,2>{0.445414931f, 0.131673411f},
-std::array<float,2>{0.318137795f, 0.911536455f},
-std::array<float,2>{0.763168514f, 0.1127012f},
-std::array<float,2>{0.516657948f, 0.526572049f},
-std::array<float,2>{0.132724226f, 0.297463059f},
-std::array<float,2>{0.387122184f, 0.568769157f},
-std::array<float,2>{0.882072806f, 0.364775628f},
-std::array<float,2>{0.711960018f, 0.99928391f},
-std::array<float,2>{0.0882480443f, 0.0147356763f},
-std::array<float,2>{0.234177008f, 0.766644776f},
-std::array<float,2>{0.583322763f, 0.228223532f},
-std::array<float,2>{0.856416345f, 0.74832958f},
-std::array<float,2>{0.294195503f, 0.408106387f},
-std::array<float,2>{0.208649948f, 0.719388425f},
-std::array<float,2>{0.621986091f, 0.436308116f},
-std::array<float,2>{0.836943209f, 0.753627658f},
-std::array<float,2>{0.268882215f, 0.235705569f},
-std::array<float,2>{0.436170399f, 0.972568154f},
-std::array<float,2>{0.909750998f, 0.0170619823f},
-std::array<float,2>{0.722049534f, 0.591467619f},
-std::array<float,2>{0.11840079f, 0.358338147f},
-std::array<float,2>{0.361435413f, 0.50907582f},
-std::array<float,2>{0.805483818f, 0.292246878f},
-std::array<float,2>{0.534323037f, 0.926424623f},
-std::array<float,2>{0.163403973f, 0.0947770849f},
-std::array<float,2>{0.0306106061f, 0.867540002f},
-std::array<float,2>{0.631700575f, 0.155220896f},
-std::array<float,2>{0.951889634f, 0.655103981f},
-std::array<float,2>{0.490961313f, 0.444403887f},
-std::array<float,2>{0.0764824301f, 0.617722571f},
-std::array<float,2>{0.703116775f, 0.320864975f},
-std::array<float,2>{0.898225665f, 0.93863827f},
-std::array<float,2>{0.406192124f, 0.051810585f},
-std::array<float,2>{0.305858701f, 0.788113952f},
-std::array<float,2>{0.871095717f, 0.216805756f},
-std::array<float,2>{0.564870834f, 0.702943861f},
-std::array<float,2>{0.239753217f, 0.39070043f},
-std::array<float,2>{0.466724634f, 0.657177806f},
-std::array<float,2>{0.98713088f, 0.498095423f},
-std::array<float,2>{0.681961358f, 0.840716779f},
-std::array<float,2>{0.0511977896f, 0.167644098f},
-std::array<float,2>{0.147627667f, 0.905348659f},
-std::array<float,2>{0.506454825f, 0.0625118092f},
-std::array<float,2>{0.766361058f, 0.555539191f},
-std::array<float,2>{0.328891575f, 0.26847446f},
-std::array<float,2>{0.192970797f, 0.502224326f},
-std::array<float,2>{0.607046604f, 0.281524837f},
-std::array<float,2>{0.824052095f, 0.934669375f},
-std::array<float,2>{0.260684431f, 0.106709607f},
-std::array<float,2>{0.410504907f, 0.864551544f},
-std::array<float,2>{0.924245417f, 0.142025426f},
-std::array<float,2>{0.739931643f, 0.646961391f},
-std::array<float,2>{0.0960850492f, 0.452107131f},
-std::array<float,2>{0.348875374f, 0.729177535f},
-std::array<float,2>{0.784884036f, 0.426794559f},
-std::array<float,2>{0.560978532f, 0.761764765f},
-std::array<float,2>{0.172175199f, 0.246337578f},
-std::array<float,2>{0.0125108315f, 0.976940751f},
-std::array<float,2>{0.65447253f, 0.0287790522f},
-std::array<float,2>{0.966044724f, 0.579151452f},
-std::array<float,2>{0.469286591f, 0.34954527f},
-std::array<float,2>{0.0937135443f, 0.664822638f},
-std::array<float,2>{0.718290389f, 0.492092371f},
-std::array<float,2>{0.87882185f, 0.835682929f},
-std::array<float,2>{0.384533525f, 0.1568546f},
-std::array<float,2>{0.292579889f, 0.891189575f},
-std::array<float,2>{0.852752745f, 0.0777952224f},
-std::array<float,2>{0.578258693f, 0.554232776f},
-std::array<float,2>{0.22785531f, 0.27826792f},
-std::array<float,2>{0.45249474f, 0.614692569f},
-std::array<float,2>{0.979608417f, 0.314157069f},
-std::array<float,2>{0.66618377f, 0.947275639f},
-std::array<float,2>{0.0395967923f, 0.0580040626f},
-std::array<float,2>{0.12784344f, 0.791184962f},
-std::array<float,2>{0.523401558f, 0.204977408f},
-std::array<float,2>{0.759361267f, 0.688100278f},
-std::array<float,2>{0.314173907f, 0.400723219f},
-std::array<float,2>{0.157832861f, 0.713892639f},
-std::array<float,2>{0.537352085f, 0.387589395f},
-std::array<float,2>{0.811674297f, 0.79946655f},
-std::array<float,2>{0.365833402f, 0.193912446f},
-std::array<float,2>{0.488152325f, 0.956648767f},
-std::array<float,2>{0.946242571f, 0.0390582122f},
-std::array<float,2>{0.627580881f, 0.602334738f},
-std::array<float,2>{0.026006002f, 0.334263921f},
-std::array<float,2>{0.270883828f, 0.543828487f},
-std::array<float,2>{0.843033016f, 0.252825856f},
-std::array<float,2>{0.618864417f, 0.885529757f},
-std::array<float,2>{0.205736399f, 0.0931577906f},
-std::array<float,2>{0.122551978f, 0.825137973f},
-std::array<float,2>{0.724405587f, 0.172963932f},
-std::array<float,2>{0.911180854f, 0.686186254f},
-std::array<float,2>{0.431970805f, 0.480662286f},
-std::array<float,2>{0.0496833436f, 0.577565253f},
-std::array<float,2>{0.68680501f, 0.371030062f},
-std::array<float,2>{0.990442216f, 0.986646175f},
-std::array<float,2>{0.461644292f, 0.00175289297f},
-std::array<float,2>{0.335611254f, 0.776854932f},
-std::array<float,2>{0.769765735f, 0.219595596f},
-std::array<float,2>{0.502175808f, 0.737530112f},
-std::array<float,2>{0.142478764f, 0.416493326f},
-std::array<float,2>{0.400353909f, 0.639962316f},
-std::array<float,2>{0.890836298f, 0.453281581f},
-std::array<float,2>{0.697347164f, 0.85353148f},
-std::array<float,2>{0.0735563412f, 0.134079888f},
-std::array<float,2>{0.234985098f, 0.915440142f},
-std::array<float,2>{0.570271611f, 0.118010402f},
-std::array<float,2>{0.8699615f, 0.520878375f},
-std::array<float,2>{0.311848491f, 0.307815969f},
-std::array<float,2>{0.151035145f, 0.594055176f},
-std::array<float,2>{0.511374295f, 0.338200361f},
-std::array<float,2>{0.78038013f, 0.964753807f},
-std::array<float,2>{0.340777904f, 0.0459100567f},
-std::array<float,2>{0.45442155f, 0.810062647f},
-std::array<float,2>{0.995435953f, 0.201208428f},
-std::array<float,2>{0.676654279f, 0.706134677f},
-std::array<float,2>{0.0579051636f, 0.379152864f},
-std::array<float,2>{0.301016957f, 0.675766647f},
-std::array<float,2>{0.866970658f, 0.469739079f},
-std::array<float,2>{0.575524628f, 0.817302883f},
-std::array<float,2>{0.248580813f, 0.187195942f},
-std::array<float,2>{0.0685444027f, 0.879956543f},
-std::array<float,2>{0.693515718f, 0.0795280412f},
-std::array<float,2>{0.901812375f, 0.531590939f},
-std::array<float,2>{0.392690659f, 0.264109313f},
-std::array<float,2>{0.0215746257f, 0.742695153f},
-std::array<float,2>{0.63731873f, 0.412263632f},
-std::array<float,2>{0.942486763f, 0.772282302f},
-std::array<float,2>{0.498219371f, 0.232326537f},
-std::array<float,2>{0.368141741f, 0.992595255f},
-std::array<float,2>{0.803596914f, 0.0078817429f},
-std::array<float,2>{0.542625785f, 0.566309869f},
-std::array<float,2>{0.164434731f, 0.362751424f},
-std::array<float,2>{0.426697373f, 0.52918607f},
-std::array<float,2>{0.919591367f, 0.303755105f},
-std::array<float,2>{0.732680738f, 0.908403814f},
-std::array<float,2>{0.115945689f, 0.114352144f},
-std::array<float,2>{0.213765889f, 0.851386964f},
-std::array<float,2>{0.613922358f, 0.128077462f},
-std::array<float,2>{0.832536459f, 0.629654109f},
-std::array<float,2>{0.277902037f, 0.467677534f},
-std::array<float,2>{0.225096464f, 0.648596227f},
-std::array<float,2>{0.589943349f, 0.440545827f},
-std::array<float,2>{0.851235569f, 0.874250114f},
-std::array<float,2>{0.287537485f, 0.149505585f},
-std::array<float,2>{0.37793833f, 0.925661147f},
-std::array<float,2>{0.888379395f, 0.0985725075f},
-std::array<float,2>{0.703872204f, 0.513114035f},
-std::array<float,2>{0.0842434466f, 0.295153588f},
-std::array<float,2>{0.327196628f, 0.587745667f},
-std::array<float,2>{0.756452262f, 0.352242619f},
-std::array<float,2>{0.523779809f, 0.974186718f},
-std::array<float,2>{0.138548926f, 0.0196120311f},
-std::array<float,2>{0.0377881713f, 0.757432103f},
-std::array<float,2>{0.662155211f, 0.241250202f},
-std::array<float,2>{0.973545194f, 0.724673152f},
-std::array<float,2>{0.443103582f, 0.433065057f},
-std::array<float,2>{0.104040205f, 0.560176134f},
-std::array<float,2>{0.744734526f, 0.272714347f},
-std::array<float,2>{0.929993093f, 0.900232792f},
-std::array<float,2>{0.414969146f, 0.0677347854f},
-std::array<float,2>{0.252807498f, 0.838088512f},
-std::array<float,2>{0.815679133f, 0.171430737f},
-std::array<float,2>{0.599498153f, 0.663757801f},
-std::array<float,2>{0.198873192f, 0.494956255f},
-std::array<float,2>{0.477963507f, 0.698106468f},
-std::array<float,2>{0.95761019f, 0.395218968f},
-std::array<float,2>{0.647349596f, 0.784141362f},
-std::array<float,2>{0.000256441999f, 0.213369846f},
-std::array<float,2>{0.184906125f, 0.943581343f},
-std::array<float,2>{0.547648191f, 0.0468883328f},
-std::array<float,2>{0.795645356f, 0.624622881f},
-std::array<float,2>{0.351975769f, 0.325910717f},
-std::array<float,2>{0.215208009f, 0.613164365f},
-std::array<float,2>{0.611471355f, 0.317014426f},
-std::array<float,2>{0.830439031f, 0.952213585f},
-std::array<float,2>{0.275094569f, 0.0615249537f},
-std::array<float,2>{0.42215091f, 0.793609798f},
-std::array<float,2>{0.915760636f, 0.207388595f},
-std::array<float,2>{0.728802145f, 0.694666147f},
-std::array<float,2>{0.111614719f, 0.405018538f},
-std::array<float,2>{0.371488601f, 0.67138958f},
-std::array<float,2>{0.799505889f, 0.488226026f},
-std::array<float,2>{0.546182454f, 0.829940915f},
-std::array<float,2>{0.171211317f, 0.16238232f},
-std::array<float,2>{0.0172967091f, 0.894897878f},
-std::array<float,2>{0.636464775f, 0.0711462274f},
-std::array<float,2>{0.94058305f, 0.547626853f},
-std::array<float,2>{0.492593229f, 0.274010599f},
-std::array<float,2>{0.0649389699f, 0.732599318f},
-std::array<float,2>{0.688513696f, 0.424954325f},
-std::array<float,2>{0.903326452f, 0.761288702f},
-std::array<float,2>{0.396367133f, 0.245766506f},
-std::array<float,2>{0.297767758f, 0.980597913f},
-std::array<float,2>{0.861720562f, 0.024171222f},
-std::array<float,2>{0.572042704f, 0.585930526f},
-std::array<float,2>{0.244411021f, 0.343975931f},
-std::array<float,2>{0.460438579f, 0.507049322f},
-std::array<float,2>{0.99614805f, 0.287253678f},
-std::array<float,2>{0.675052404f, 0.932740152f},
-std::array<float,2>{0.0619064048f, 0.102143891f},
-std::array<float,2>{0.154256761f, 0.86186409f},
-std::array<float,2>{0.51234144f, 0.147886485f},
-std::array<float,2>{0.773911357f, 0.641677856f},
-std::array<float,2>{0.339481771f, 0.447867841f},
-std::array<float,2>{0.181601807f, 0.635482609f},
-std::array<float,2>{0.551951647f, 0.459542871f},
-std::array<float,2>{0.79229182f, 0.859060645f},
-std::array<float,2>{0.357996136f, 0.140332922f},
-std::array<float,2>{0.482275456f, 0.918356419f},
-std::array<float,2>{0.956358314f, 0.124441423f},
-std::array<float,2>{0.643763185f, 0.519518435f},
-std::array<float,2>{0.00492695533f, 0.310242623f},
-std::array<float,2>{0.255242616f, 0.572705209f},
-std::array<float,2>{0.820027888f, 0.371970326f},
-std::array<float,2>{0.595741212f, 0.991583586f},
-std::array<float,2>{0.201428473f, 0.00613665953f},
-std::array<float,2>{0.107654303f, 0.780326486f},
-std::array<float,2>{0.748830676f, 0.22362636f},
-std::array<float,2>{0.937025666f, 0.738977849f},
-std::array<float,2>{0.419573188f, 0.419501752f},
-std::array<float,2>{0.0331391953f, 0.541173875f},
-std::array<float,2>{0.65705961f, 0.255161256f},
-std::array<float,2>{0.971725762f, 0.890425086f},
-std::array<float,2>{0.437525183f, 0.087480925f},
-std::array<float,2>{0.322537869f, 0.822444916f},
-std::array<float,2>{0.750912786f, 0.17864278f},
-std::array<float,2>{0.530051947f, 0.683379948f},
-std::array<float,2>{0.133693248f, 0.477105618f},
-std::array<float,2>{0.380553871f, 0.715512156f},
-std::array<float,2>{0.885910273f, 0.382821769f},
-std::array<float,2>{0.707042038f, 0.80090934f},
-std::array<float,2>{0.0800959319f, 0.188039958f},
-std::array<float,2>{0.222538516f, 0.958113849f},
-std::array<float,2>{0.588955164f, 0.0336419083f},
-std::array<float,2>{0.84685415f, 0.606074035f},
-std::array<float,2>{0.284626186f, 0.328990936f},
-std::array<float,2>{0.130590826f, 0.525175869f},
-std::array<float,2>{0.519070446f, 0.299443483f},
-std::array<float,2>{0.764133334f, 0.913616598f},
-std::array<float,2>{0.318612099f, 0.110084563f},
-std::array<float,2>{0.448521405f, 0.845007718f},
-std::array<float,2>{0.983461916f, 0.129564032f},
-std::array<float,2>{0.671554267f, 0.626252353f},
-std::array<float,2>{0.0444153287f, 0.462456584f},
-std::array<float,2>{0.29584685f, 0.746730685f},
-std::array<float,2>{0.858142197f, 0.409920186f},
-std::array<float,2>{0.584826052f, 0.768413842f},
-std::array<float,2>{0.232127979f, 0.230360821f},
-std::array<float,2>{0.0872704908f, 0.997631431f},
-std::array<float,2>{0.713774681f, 0.0124440901f},
-std::array<float,2>{0.880560875f, 0.567942262f},
-std::array<float,2>{0.388758063f, 0.365650326f},
-std::array<float,2>{0.00885018893f, 0.679642797f},
-std::array<float,2>{0.651973486f, 0.47298193f},
-std::array<float,2>{0.964130282f, 0.815108061f},
-std::array<float,2>{0.476302058f, 0.182653829f},
-std::array<float,2>{0.344005436f, 0.87764734f},
-std::array<float,2>{0.788934886f, 0.0855337903f},
-std::array<float,2>{0.557863772f, 0.538069069f},
-std::array<float,2>{0.1789487f, 0.259312779f},
-std::array<float,2>{0.406487405f, 0.59918654f},
-std::array<float,2>{0.925975144f, 0.342948556f},
-std::array<float,2>{0.736493289f, 0.965837419f},
-std::array<float,2>{0.0979562327f, 0.0393880941f},
-std::array<float,2>{0.191033319f, 0.806056738f},
-std::array<float,2>{0.601594687f, 0.197979078f},
-std::array<float,2>{0.826823413f, 0.709912658f},
-std::array<float,2>{0.262910873f, 0.376234055f},
-std::array<float,2>{0.241266236f, 0.699509919f},
-std::array<float,2>{0.562914908f, 0.392639697f},
-std::array<float,2>{0.874598265f, 0.787066519f},
-std::array<float,2>{0.308046877f, 0.215198964f},
-std::array<float,2>{0.402928591f, 0.940573215f},
-std::array<float,2>{0.895148277f, 0.0530525446f},
-std::array<float,2>{0.699708581f, 0.62010324f},
-std::array<float,2>{0.0759159029f, 0.323880911f},
-std::array<float,2>{0.330328047f, 0.557903647f},
-std::array<float,2>{0.768837988f, 0.267465532f},
-std::array<float,2>{0.505117357f, 0.904182613f},
-std::array<float,2>{0.145243675f, 0.0661965534f},
-std::array<float,2>{0.0546109229f, 0.842940509f},
-std::array<float,2>{0.681398213f, 0.165182784f},
-std::array<float,2>{0.98590219f, 0.659991086f},
-std::array<float,2>{0.468320936f, 0.49742341f},
-std::array<float,2>{0.120657489f, 0.592924237f},
-std::array<float,2>{0.719498158f, 0.356894225f},
-std::array<float,2>{0.908036768f, 0.969908953f},
-std::array<float,2>{0.434728742f, 0.0192900114f},
-std::array<float,2>{0.267248303f, 0.750562966f},
-std::array<float,2>{0.838973582f, 0.23775883f},
-std::array<float,2>{0.624298275f, 0.721486986f},
-std::array<float,2>{0.210304022f, 0.435237408f},
-std::array<float,2>{0.490001976f, 0.65413028f},
-std::array<float,2>{0.949724793f, 0.442554384f},
-std::array<float,2>{0.629903674f, 0.870533168f},
-std::array<float,2>{0.0276056826f, 0.152785823f},
-std::array<float,2>{0.162091449f, 0.928120494f},
-std::array<float,2>{0.532647192f, 0.0973797217f},
-std::array<float,2>{0.806882262f, 0.511652708f},
-std::array<float,2>{0.360795557f, 0.290945739f},
-std::array<float,2>{0.229681775f, 0.551721811f},
-std::array<float,2>{0.58179611f, 0.280238837f},
-std::array<float,2>{0.854151905f, 0.892859519f},
-std::array<float,2>{0.28985548f, 0.0752021223f},
-std::array<float,2>{0.385052055f, 0.833483458f},
-std::array<float,2>{0.876654625f, 0.158688292f},
-std::array<float,2>{0.716241956f, 0.667050421f},
-std::array<float,2>{0.0913958848f, 0.48848629f},
-std::array<float,2>{0.31501317f, 0.690412343f},
-std::array<float,2>{0.761219621f, 0.399331003f},
-std::array<float,2>{0.52097857f, 0.789391518f},
-std::array<float,2>{0.126563147f, 0.205729946f},
-std::array<float,2>{0.0424795784f, 0.947148621f},
-std::array<float,2>{0.665205717f, 0.0550997257f},
-std::array<float,2>{0.977882445f, 0.616703987f},
-std::array<float,2>{0.450564206f, 0.315907568f},
-std::array<float,2>{0.0948421136f, 0.645896971f},
-std::array<float,2>{0.741888523f, 0.450383484f},
-std::array<float,2>{0.92321527f, 0.86558497f},
-std::array<float,2>{0.412765294f, 0.142747238f},
-std::array<float,2>{0.258415997f, 0.936719835f},
-std::array<float,2>{0.821470797f, 0.108622007f},
-std::array<float,2>{0.607634068f, 0.501487553f},
-std::array<float,2>{0.193885565f, 0.28504619f},
-std::array<float,2>{0.470759004f, 0.581046224f},
-std::array<float,2>{0.968238652f, 0.350934058f},
-std::array<float,2>{0.653797805f, 0.979032278f},
-std::array<float,2>{0.0142043941f, 0.0310682449f},
-std::array<float,2>{0.174711719f, 0.765411317f},
-std::array<float,2>{0.560541272f, 0.248720229f},
-std::array<float,2>{0.781863749f, 0.726664364f},
-std::array<float,2>{0.351388186f, 0.428935915f},
-std::array<float,2>{0.142838821f, 0.73552233f},
-std::array<float,2>{0.500483155f, 0.414923072f},
-std::array<float,2>{0.77204597f, 0.774438441f},
-std::array<float,2>{0.332032949f, 0.221064776f},
-std::array<float,2>{0.464674026f, 0.984697878f},
-std::array<float,2>{0.988837004f, 0.00221608137f},
-std::array<float,2>{0.684729218f, 0.575295091f},
-std::array<float,2>{0.0480934605f, 0.368416011f},
-std::array<float,2>{0.310499847f, 0.52246058f},
-std::array<float,2>{0.867569506f, 0.306545228f},
-std::array<float,2>{0.567409873f, 0.916911185f},
-std::array<float,2>{0.237936482f, 0.120075978f},
-std::array<float,2>{0.0720648766f, 0.853260756f},
-std::array<float,2>{0.695610702f, 0.136505216f},
-std::array<float,2>{0.893045902f, 0.638061166f},
-std::array<float,2>{0.40082258f, 0.456216097f},
-std::array<float,2>{0.0239664707f, 0.605350077f},
-std::array<float,2>{0.626411378f, 0.332282186f},
-std::array<float,2>{0.949185073f, 0.953917801f},
-std::array<float,2>{0.486189246f, 0.0370828658f},
-std::array<float,2>{0.365035594f, 0.798435092f},
-std::array<float,2>{0.810088992f, 0.193179682f},
-std::array<float,2>{0.536335111f, 0.71232754f},
-std::array<float,2>{0.159725472f, 0.388999552f},
-std::array<float,2>{0.430286914f, 0.685035169f},
-std::array<float,2>{0.912926078f, 0.483231932f},
-std::array<float,2>{0.725723505f, 0.826306283f},
-std::array<float,2>{0.12425226f, 0.17394045f},
-std::array<float,2>{0.205042467f, 0.884745836f},
-std::array<float,2>{0.619402289f, 0.0903412476f},
-std::array<float,2>{0.840342999f, 0.546143889f},
-std::array<float,2>{0.271940768f, 0.250871629f},
-std::array<float,2>{0.166028708f, 0.562887251f},
-std::array<float,2>{0.539063334f, 0.360433757f},
-std::array<float,2>{0.8025617f, 0.995190501f},
-std::array<float,2>{0.37021777f, 0.0114061814f},
-std::array<float,2>{0.496642768f, 0.770475864f},
-std::array<float,2>{0.944636583f, 0.233103827f},
-std::array<float,2>{0.64037925f, 0.744967699f},
-std::array<float,2>{0.0201705415f, 0.411586374f},
-std::array<float,2>{0.279654384f, 0.631078541f},
-std::array<float,2>{0.835934579f, 0.466676712f},
-std::array<float,2>{0.616671562f, 0.847838521f},
-std::array<float,2>{0.212763309f, 0.12677151f},
-std::array<float,2>{0.114012718f, 0.906558216f},
-std::array<float,2>{0.731403589f, 0.116643429f},
-std::array<float,2>{0.920781672f, 0.529992878f},
-std::array<float,2>{0.429656029f, 0.302648723f},
-std::array<float,2>{0.0555695258f, 0.70398891f},
-std::array<float,2>{0.678891242f, 0.381374478f},
-std::array<float,2>{0.992343545f, 0.811738014f},
-std::array<float,2>{0.455523461f, 0.19985716f},
-std::array<float,2>{0.34204635f, 0.962390244f},
-std::array<float,2>{0.777944624f, 0.0445608459f},
-std::array<float,2>{0.508535743f, 0.597380161f},
-std::array<float,2>{0.149269998f, 0.33655113f},
-std::array<float,2>{0.390904963f, 0.533265412f},
-std::array<float,2>{0.899419188f, 0.262477994f},
-std::array<float,2>{0.692751229f, 0.881295085f},
-std::array<float,2>{0.0671567991f, 0.0810815915f},
-std::array<float,2>{0.24740319f, 0.819884598f},
-std::array<float,2>{0.577672422f, 0.185273394f},
-std::array<float,2>{0.863488317f, 0.672194958f},
-std::array<float,2>{0.303460062f, 0.472216666f},
-std::array<float,2>{0.196825668f, 0.661007643f},
-std::array<float,2>{0.599814653f, 0.492656767f},
-std::array<float,2>{0.812566459f, 0.836753845f},
-std::array<float,2>{0.250446826f, 0.169241592f},
-std::array<float,2>{0.416254461f, 0.901373744f},
-std::array<float,2>{0.933505177f, 0.0695682317f},
-std::array<float,2>{0.743761957f, 0.562342048f},
-std::array<float,2>{0.102770403f, 0.269995421f},
-std::array<float,2>{0.354451567f, 0.621547997f},
-std::array<float,2>{0.794141769f, 0.327602506f},
-std::array<float,2>{0.549991667f, 0.942882895f},
-std::array<float,2>{0.18586719f, 0.0503969826f},
-std::array<float,2>{0.00324666733f, 0.782461286f},
-std::array<float,2>{0.645337462f, 0.212837681f},
-std::array<float,2>{0.959983945f, 0.695607424f},
-std::array<float,2>{0.478843063f, 0.397126496f},
-std::array<float,2>{0.0831005871f, 0.514851451f},
-std::array<float,2>{0.705617547f, 0.294220895f},
-std::array<float,2>{0.889089108f, 0.922151148f},
-std::array<float,2>{0.375355631f, 0.100749619f},
-std::array<float,2>{0.285805374f, 0.872690976f},
-std::array<float,2>{0.848950326f, 0.150442719f},
-std::array<float,2>{0.593168557f, 0.651139736f},
-std::array<float,2>{0.222743481f, 0.438413173f},
-std::array<float,2>{0.443696201f, 0.723872185f},
-std::array<float,2>{0.974896491f, 0.430542201f},
-std::array<float,2>{0.660575867f, 0.755704343f},
-std::array<float,2>{0.0370798372f, 0.23934494f},
-std::array<float,2>{0.139617458f, 0.975116611f},
-std::array<float,2>{0.526941359f, 0.0223005861f},
-std::array<float,2>{0.755401969f, 0.588738918f},
-std::array<float,2>{0.325902998f, 0.354461282f},
-std::array<float,2>{0.202220619f, 0.570347428f},
-std::array<float,2>{0.597290695f, 0.374888361f},
-std::array<float,2>{0.819139719f, 0.989183187f},
-std::array<float,2>{0.254129052f, 0.0054973145f},
-std::array<float,2>{0.418524653f, 0.777672648f},
-std::array<float,2>{0.93593049f, 0.225024387f},
-std::array<float,2>{0.749066055f, 0.740886927f},
-std::array<float,2>{0.109286614f, 0.421712101f},
-std::array<float,2>{0.358769834f, 0.633277237f},
-std::array<float,2>{0.791301847f, 0.458645612f},
-std::array<float,2>{0.551056206f, 0.856939375f},
-std::array<float,2>{0.180435374f, 0.136732504f},
-std::array<float,2>{0.00413929578f, 0.92152822f},
-std::array<float,2>{0.642849088f, 0.122540206f},
-std::array<float,2>{0.955142915f, 0.516694784f},
-std::array<float,2>{0.480583966f, 0.311838746f},
-std::array<float,2>{0.0819186866f, 0.717342019f},
-std::array<float,2>{0.708881199f, 0.385302961f},
-std::array<float,2>{0.884814739f, 0.803584814f},
-std::array<float,2>{0.37924394f, 0.189566612f},
-std::array<float,2>{0.283497542f, 0.959328413f},
-std::array<float,2>{0.84571749f, 0.031969443f},
-std::array<float,2>{0.588587761f, 0.608486831f},
-std::array<float,2>{0.221417561f, 0.330995232f},
-std::array<float,2>{0.439120591f, 0.540284634f},
-std::array<float,2>{0.971559584f, 0.256684214f},
-std::array<float,2>{0.658119678f, 0.887296259f},
-std::array<float,2>{0.0315604806f, 0.0892177746f},
-std::array<float,2>{0.134597287f, 0.82061851f},
-std::array<float,2>{0.53069979f, 0.177727804f},
-std::array<float,2>{0.751720607f, 0.680169165f},
-std::array<float,2>{0.323720098f, 0.478838652f},
-std::array<float,2>{0.170600787f, 0.668587327f},
-std::array<float,2>{0.545726418f, 0.4850775f},
-std::array<float,2>{0.799862921f, 0.830208957f},
-std::array<float,2>{0.372302622f, 0.160766408f},
-std::array<float,2>{0.493717998f, 0.896808147f},
-std::array<float,2>{0.939546466f, 0.0740339756f},
-std::array<float,2>{0.635198772f, 0.5499143f},
-std::array<float,2>{0.0160761625f, 0.276190877f},
-std::array<float,2>{0.274145484f, 0.609986484f},
-std::array<float,2>{0.831934392f, 0.3193371f},
-std::array<float,2>{0.612448037f, 0.950068355f},
-std::array<float,2>{0.215929002f, 0.0601910725f},
-std::array<float,2>{0.112936288f, 0.79681921f},
-std::array<float,2>{0.729998827f, 0.210900515f},
-std::array<float,2>{0.914391458f, 0.691676915f},
-std::array<float,2>{0.42329523f, 0.402412564f},
-std::array<float,2>{0.0615161955f, 0.503959537f},
-std::array<float,2>{0.674656153f, 0.285300583f},
-std::array<float,2>{0.997643828f, 0.929909706f},
-std::array<float,2>{0.459930539f, 0.105148502f},
-std::array<float,2>{0.338766009f, 0.85937798f},
-std::array<float,2>{0.774748504f, 0.145612255f},
-std::array<float,2>{0.513098001f, 0.643021166f},
-std::array<float,2>{0.153125718f, 0.446241498f},
-std::array<float,2>{0.394844264f, 0.732175767f},
-std::array<float,2>{0.902612507f, 0.423328549f},
-std::array<float,2>{0.687646329f, 0.759613872f},
-std::array<float,2>{0.0663620755f, 0.243340299f},
-std::array<float,2>{0.245653719f, 0.98331517f},
-std::array<float,2>{0.57068789f, 0.025634516f},
-std::array<float,2>{0.863089502f, 0.582971871f},
-std::array<float,2>{0.298478812f, 0.347416431f},
-std::array<float,2>{0.145934835f, 0.556334317f},
-std::array<float,2>{0.503956497f, 0.268563509f},
-std::array<float,2>{0.767719746f, 0.904735506f},
-std::array<float,2>{0.331585407f, 0.0640676767f},
-std::array<float,2>{0.46730867f, 0.841566384f},
-std::array<float,2>{0.984551907f, 0.166797653f},
-std::array<float,2>{0.67990911f, 0.657995582f},
-std::array<float,2>{0.053006053f, 0.499671221f},
-std::array<float,2>{0.306735337f, 0.701977134f},
-std::array<float,2>{0.873254299f, 0.392300308f},
-std::array<float,2>{0.563880444f, 0.788073838f},
-std::array<float,2>{0.240479767f, 0.218706638f},
-std::array<float,2>{0.0748408884f, 0.93823266f},
-std::array<float,2>{0.70034039f, 0.0508061014f},
-std::array<float,2>{0.895640552f, 0.618309975f},
-std::array<float,2>{0.403479367f, 0.322011918f},
-std::array<float,2>{0.0287938211f, 0.655510008f},
-std::array<float,2>{0.629393518f, 0.44357577f},
-std::array<float,2>{0.950711489f, 0.868899643f},
-std::array<float,2>{0.488729954f, 0.156172216f},
-std::array<float,2>{0.359847605f, 0.927552998f},
-std::array<float,2>{0.808299661f, 0.0941372588f},
-std::array<float,2>{0.531669021f, 0.507879615f},
-std::array<float,2>{0.160676032f, 0.291365325f},
-std::array<float,2>{0.433708221f, 0.590108454f},
-std::array<float,2>{0.906800091f, 0.358529478f},
-std::array<float,2>{0.720165431f, 0.97159338f},
-std::array<float,2>{0.11931885f, 0.0156264193f},
-std::array<float,2>{0.209708571f, 0.752360761f},
-std::array<float,2>{0.624004304f, 0.235013679f},
-std::array<float,2>{0.838554323f, 0.72064513f},
-std::array<float,2>{0.265944362f, 0.436949581f},
-std::array<float,2>{0.230780944f, 0.749475241f},
-std::array<float,2>{0.585741401f, 0.406525135f},
-std::array<float,2>{0.858903766f, 0.76640588f},
-std::array<float,2>{0.296683192f, 0.22713694f},
-std::array<float,2>{0.389770627f, 0.998244703f},
-std::array<float,2>{0.879413247f, 0.0137326131f},
-std::array<float,2>{0.714182019f, 0.569906175f},
-std::array<float,2>{0.0868943185f, 0.363796294f},
-std::array<float,2>{0.319624364f, 0.525403798f},
-std::array<float,2>{0.764870405f, 0.298042178f},
-std::array<float,2>{0.517752945f, 0.911117017f},
-std::array<float,2>{0.129272044f, 0.112179272f},
-std::array<float,2>{0.0439418778f, 0.845795929f},
-std::array<float,2>{0.670559704f, 0.132714942f},
-std::array<float,2>{0.98311311f, 0.627661586f},
-std::array<float,2>{0.447470278f, 0.464269876f},
-std::array<float,2>{0.0988170654f, 0.601369739f},
-std::array<float,2>{0.737370849f, 0.341044456f},
-std::array<float,2>{0.927121997f, 0.967057288f},
-std::array<float,2>{0.40817517f, 0.0413509309f},
-std::array<float,2>{0.262416124f, 0.808458745f},
-std::array<float,2>{0.827931166f, 0.19597365f},
-std::array<float,2>{0.602807701f, 0.707791507f},
-std::array<float,2>{0.189785764f, 0.378870219f},
-std::array<float,2>{0.475146562f, 0.675870895f},
-std::array<float,2>{0.963343799f, 0.476285845f},
-std::array<float,2>{0.650438964f, 0.813161254f},
-std::array<float,2>{0.00860229786f, 0.180542782f},
-std::array<float,2>{0.178206131f, 0.876692235f},
-std::array<float,2>{0.557108402f, 0.0825627819f},
-std::array<float,2>{0.787874758f, 0.536691904f},
-std::array<float,2>{0.345438659f, 0.260547012f},
-std::array<float,2>{0.236336604f, 0.519866705f},
-std::array<float,2>{0.566833854f, 0.306894153f},
-std::array<float,2>{0.868848443f, 0.914921939f},
-std::array<float,2>{0.309545606f, 0.118710369f},
-std::array<float,2>{0.401907384f, 0.855266333f},
-std::array<float,2>{0.893602729f, 0.132955894f},
-std::array<float,2>{0.696491063f, 0.639233649f},
-std::array<float,2>{0.0712449104f, 0.454938859f},
-std::array<float,2>{0.333502203f, 0.736724198f},
-std::array<float,2>{0.773008645f, 0.417468458f},
-std::array<float,2>{0.501436889f, 0.775477409f},
-std::array<float,2>{0.143576697f, 0.220111907f},
-std::array<float,2>{0.0472830124f, 0.987721384f},
-std::array<float,2>{0.683743298f, 0.00058272999f},
-std::array<float,2>{0.989852071f, 0.577073634f},
-std::array<float,2>{0.463337034f, 0.36954695f},
-std::array<float,2>{0.123715281f, 0.687297702f},
-std::array<float,2>{0.724785626f, 0.482131779f},
-std::array<float,2>{0.913113832f, 0.825892925f},
-std::array<float,2>{0.430880845f, 0.172777653f},
-std::array<float,2>{0.273029f, 0.885915816f},
-std::array<float,2>{0.840851247f, 0.0927286893f},
-std::array<float,2>{0.62100625f, 0.544405997f},
-std::array<float,2>{0.203450531f, 0.253486872f},
-std::array<float,2>{0.484407902f, 0.603106916f},
-std::array<float,2>{0.947509766f, 0.335759282f},
-std::array<float,2>{0.625564158f, 0.955124319f},
-std::array<float,2>{0.0247172937f, 0.0375678726f},
-std::array<float,2>{0.158928335f, 0.800100982f},
-std::array<float,2>{0.535254359f, 0.194797903f},
-std::array<float,2>{0.809177101f, 0.713201582f},
-std::array<float,2>{0.363289386f, 0.388231158f},
-std::array<float,2>{0.125858486f, 0.688557327f},
-std::array<float,2>{0.51961726f, 0.402134389f},
-std::array<float,2>{0.760483861f, 0.792041123f},
-std::array<float,2>{0.315780908f, 0.203548953f},
-std::array<float,2>{0.449981987f, 0.948505759f},
-std::array<float,2>{0.977211773f, 0.0569818504f},
-std::array<float,2>{0.664112747f, 0.613584816f},
-std::array<float,2>{0.0417199284f, 0.312572747f},
-std::array<float,2>{0.290217191f, 0.553529978f},
-std::array<float,2>{0.85524708f, 0.279206485f},
-std::array<float,2>{0.580886781f, 0.892012775f},
-std::array<float,2>{0.229380891f, 0.0764940083f},
-std::array<float,2>{0.0898482576f, 0.834824979f},
-std::array<float,2>{0.715314984f, 0.157711312f},
-std::array<float,2>{0.875431955f, 0.665451229f},
-std::array<float,2>{0.38585335f, 0.49040094f},
-std::array<float,2>{0.0151365027f, 0.578833997f},
-std::array<float,2>{0.652540267f, 0.34807989f},
-std::array<float,2>{0.967609286f, 0.977726281f},
-std::array<float,2>{0.472137243f, 0.0274389777f},
-std::array<float,2>{0.350149304f, 0.763620257f},
-std::array<float,2>{0.782278121f, 0.247620896f},
-std::array<float,2>{0.558940947f, 0.729554832f},
-std::array<float,2>{0.175102174f, 0.426654011f},
-std::array<float,2>{0.413676947f, 0.647859156f},
-std::array<float,2>{0.922278941f, 0.452550203f},
-std::array<float,2>{0.740972161f, 0.864050746f},
-std::array<float,2>{0.0938585848f, 0.140899345f},
-std::array<float,2>{0.19474563f, 0.933824837f},
-std::array<float,2>{0.608718276f, 0.106195718f},
-std::array<float,2>{0.820334792f, 0.503162026f},
-std::array<float,2>{0.259034961f, 0.28227824f},
-std::array<float,2>{0.186611429f, 0.623918176f},
-std::array<float,2>{0.54969126f, 0.325174272f},
-std::array<float,2>{0.793555498f, 0.944709539f},
-std::array<float,2>{0.355375767f, 0.0487423725f},
-std::array<float,2>{0.480110884f, 0.784299374f},
-std::array<float,2>{0.95935756f, 0.214707166f},
-std::array<float,2>{0.646481931f, 0.698287785f},
-std::array<float,2>{0.00198465353f, 0.39568004f},
-std::array<float,2>{0.25151059f, 0.662985921f},
-std::array<float,2>{0.813683212f, 0.495168358f},
-std::array<float,2>{0.601431429f, 0.83976233f},
-std::array<float,2>{0.195380777f, 0.170434639f},
-std::array<float,2>{0.102322228f, 0.899131f},
-std::array<float,2>{0.742891312f, 0.0667672679f},
-std::array<float,2>{0.932076633f, 0.558810294f},
-std::array<float,2>{0.417336464f, 0.271986634f},
-std::array<float,2>{0.035533946f, 0.726527989f},
-std::array<float,2>{0.661800385f, 0.432341099f},
-std::array<float,2>{0.976173401f, 0.756497741f},
-std::array<float,2>{0.445170581f, 0.240655571f},
-std::array<float,2>{0.324888855f, 0.97274065f},
-std::array<float,2>{0.753968f, 0.020694619f},
-std::array<float,2>{0.525919259f, 0.586839616f},
-std::array<float,2>{0.140269563f, 0.353161663f},
-std::array<float,2>{0.376785606f, 0.512647748f},
-std::array<float,2>{0.890469372f, 0.296699405f},
-std::array<float,2>{0.706976533f, 0.924719691f},
-std::array<float,2>{0.0826538205f, 0.0989131629f},
-std::array<float,2>{0.223869577f, 0.873295248f},
-std::array<float,2>{0.592186689f, 0.149034113f},
-std::array<float,2>{0.848037243f, 0.650118053f},
-std::array<float,2>{0.286454558f, 0.439504236f},
-std::array<float,2>{0.211578667f, 0.630557239f},
-std::array<float,2>{0.615808547f, 0.468231469f},
-std::array<float,2>{0.834813118f, 0.850583553f},
-std::array<float,2>{0.280513972f, 0.127026215f},
-std::array<float,2>{0.428349942f, 0.909627199f},
-std::array<float,2>{0.920994759f, 0.113989264f},
-std::array<float,2>{0.732035458f, 0.527395725f},
-std::array<float,2>{0.114410177f, 0.303256541f},
-std::array<float,2>{0.369217843f, 0.564677238f},
-std::array<float,2>{0.80149883f, 0.362050623f},
-std::array<float,2>{0.540620089f, 0.99356395f},
-std::array<float,2>{0.167235792f, 0.00892353151f},
-std::array<float,2>{0.0212441999f, 0.772906184f},
-std::array<float,2>{0.638677001f, 0.231319338f},
-std::array<float,2>{0.943979084f, 0.743675828f},
-std::array<float,2>{0.497249097f, 0.413323402f},
-std::array<float,2>{0.0677551106f, 0.532378733f},
-std::array<float,2>{0.691747069f, 0.265389115f},
-std::array<float,2>{0.899274886f, 0.87934339f},
-std::array<float,2>{0.392362863f, 0.0790966973f},
-std::array<float,2>{0.304016322f, 0.817606807f},
-std::array<float,2>{0.864527345f, 0.186099276f},
-std::array<float,2>{0.576620162f, 0.674177587f},
-std::array<float,2>{0.246789873f, 0.469487756f},
-std::array<float,2>{0.456619173f, 0.705646873f},
-std::array<float,2>{0.993465066f, 0.38004905f},
-std::array<float,2>{0.678596675f, 0.808674932f},
-std::array<float,2>{0.0561660677f, 0.20224306f},
-std::array<float,2>{0.150242716f, 0.963323057f},
-std::array<float,2>{0.509057164f, 0.0454831868f},
-std::array<float,2>{0.779204011f, 0.595416188f},
-std::array<float,2>{0.342880428f, 0.339832813f},
-std::array<float,2>{0.219727218f, 0.606771231f},
-std::array<float,2>{0.586659908f, 0.329788685f},
-std::array<float,2>{0.843953431f, 0.957932651f},
-std::array<float,2>{0.282503694f, 0.0344353169f},
-std::array<float,2>{0.381067127f, 0.802678287f},
-std::array<float,2>{0.884038746f, 0.189189658f},
-std::array<float,2>{0.709889114f, 0.715909719f},
-std::array<float,2>{0.0795109868f, 0.384414494f},
-std::array<float,2>{0.321681947f, 0.682039678f},
-std::array<float,2>{0.752223611f, 0.478239924f},
-std::array<float,2>{0.527736664f, 0.823552668f},
-std::array<float,2>{0.136705503f, 0.179371357f},
-std::array<float,2>{0.0347312987f, 0.889346182f},
-std::array<float,2>{0.658588767f, 0.0859850943f},
-std::array<float,2>{0.969257593f, 0.542012572f},
-std::array<float,2>{0.44086495f, 0.254401594f},
-std::array<float,2>{0.10641399f, 0.740068495f},
-std::array<float,2>{0.746988773f, 0.418864757f},
-std::array<float,2>{0.934123158f, 0.779966295f},
-std::array<float,2>{0.420160562f, 0.22446543f},
-std::array<float,2>{0.256826878f, 0.990614593f},
-std::array<float,2>{0.817403018f, 0.00758483168f},
-std::array<float,2>{0.595011711f, 0.573595941f},
-std::array<float,2>{0.199689016f, 0.372746915f},
-std::array<float,2>{0.482711405f, 0.518020689f},
-std::array<float,2>{0.953483224f, 0.308896512f},
-std::array<float,2>{0.641368508f, 0.919493377f},
-std::array<float,2>{0.00646384899f, 0.123713307f},
-std::array<float,2>{0.182123348f, 0.858312011f},
-std::array<float,2>{0.554163933f, 0.139475539f},
-std::array<float,2>{0.789538622f, 0.636339009f},
-std::array<float,2>{0.3560929f, 0.460886061f},
-std::array<float,2>{0.155698702f, 0.641251087f},
-std::array<float,2>{0.515004396f, 0.448439032f},
-std::array<float,2>{0.775675416f, 0.863169074f},
-std::array<float,2>{0.337074876f, 0.146870032f},
-std::array<float,2>{0.457081079f, 0.932087481f},
-std::array<float,2>{0.999293208f, 0.103223294f},
-std::array<float,2>{0.673796356f, 0.505886793f},
-std::array<float,2>{0.0595099516f, 0.288510442f},
-std::array<float,2>{0.298837423f, 0.58446151f},
-std::array<float,2>{0.861198127f, 0.34493655f},
-std::array<float,2>{0.573030114f, 0.981605649f},
-std::array<float,2>{0.242476508f, 0.0244572125f},
-std::array<float,2>{0.0628570095f, 0.760466576f},
-std::array<float,2>{0.691091955f, 0.244384825f},
-std::array<float,2>{0.905688584f, 0.734337568f},
-std::array<float,2>{0.397503942f, 0.423940182f},
-std::array<float,2>{0.0187002998f, 0.548577011f},
-std::array<float,2>{0.632898688f, 0.27448976f},
-std::array<float,2>{0.939008772f, 0.896220863f},
-std::array<float,2>{0.495226413f, 0.0721174106f},
-std::array<float,2>{0.37442863f, 0.828489482f},
-std::array<float,2>{0.798735142f, 0.164023623f},
-std::array<float,2>{0.543709636f, 0.670072198f},
-std::array<float,2>{0.168912455f, 0.48697862f},
-std::array<float,2>{0.42533657f, 0.694146216f},
-std::array<float,2>{0.917027473f, 0.405971438f},
-std::array<float,2>{0.727879107f, 0.793957829f},
-std::array<float,2>{0.111238673f, 0.208934739f},
-std::array<float,2>{0.217598662f, 0.951805592f},
-std::array<float,2>{0.609667063f, 0.0607889257f},
-std::array<float,2>{0.829367459f, 0.611561418f},
-std::array<float,2>{0.275927365f, 0.317710012f},
-std::array<float,2>{0.162177026f, 0.510629117f},
-std::array<float,2>{0.533936679f, 0.289752066f},
-std::array<float,2>{0.806158364f, 0.929224551f},
-std::array<float,2>{0.362462252f, 0.0965359136f},
-std::array<float,2>{0.492104948f, 0.869438827f},
-std::array<float,2>{0.952268839f, 0.153499186f},
-std::array<float,2>{0.632056057f, 0.652485549f},
-std::array<float,2>{0.0297952592f, 0.442306608f},
-std::array<float,2>{0.268295467f, 0.721797049f},
-std::array<float,2>{0.836798728f, 0.433927715f},
-std::array<float,2>{0.62258786f, 0.751003802f},
-std::array<float,2>{0.207643762f, 0.236489579f},
-std::array<float,2>{0.117606334f, 0.969249547f},
-std::array<float,2>{0.721491635f, 0.0175813101f},
-std::array<float,2>{0.908732176f, 0.592597365f},
-std::array<float,2>{0.437144816f, 0.356108427f},
-std::array<float,2>{0.0518119335f, 0.658786118f},
-std::array<float,2>{0.683024108f, 0.496566713f},
-std::array<float,2>{0.987443149f, 0.841798425f},
-std::array<float,2>{0.465774029f, 0.164432019f},
-std::array<float,2>{0.329425067f, 0.902443945f},
-std::array<float,2>{0.766682446f, 0.0648024902f},
-std::array<float,2>{0.50700587f, 0.556932986f},
-std::array<float,2>{0.146830171f, 0.265878946f},
-std::array<float,2>{0.405181706f, 0.620855927f},
-std::array<float,2>{0.89698261f, 0.322308153f},
-std::array<float,2>{0.701751471f, 0.939709365f},
-std::array<float,2>{0.0779423937f, 0.0537895076f},
-std::array<float,2>{0.23837477f, 0.785572708f},
-std::array<float,2>{0.565534532f, 0.216103166f},
-std::array<float,2>{0.872741818f, 0.701162636f},
-std::array<float,2>{0.305078149f, 0.393809646f},
-std::array<float,2>{0.188985452f, 0.71010679f},
-std::array<float,2>{0.604443133f, 0.375693589f},
-std::array<float,2>{0.825642347f, 0.804914832f},
-std::array<float,2>{0.264097661f, 0.198551044f},
-std::array<float,2>{0.409172952f, 0.965485513f},
-std::array<float,2>{0.928868771f, 0.0400639251f},
-std::array<float,2>{0.734568477f, 0.597852111f},
-std::array<float,2>{0.100229561f, 0.342467725f},
-std::array<float,2>{0.34595561f, 0.538307905f},
-std::array<float,2>{0.785196662f, 0.258314788f},
-std::array<float,2>{0.554740548f, 0.878019571f},
-std::array<float,2>{0.177083388f, 0.0845995918f},
-std::array<float,2>{0.0114648296f, 0.816375673f},
-std::array<float,2>{0.650225639f, 0.18246308f},
-std::array<float,2>{0.961089015f, 0.677807033f},
-std::array<float,2>{0.474353433f, 0.474067301f},
-std::array<float,2>{0.0892612413f, 0.566632152f},
-std::array<float,2>{0.711026907f, 0.366949081f},
-std::array<float,2>{0.881424725f, 0.996108592f},
-std::array<float,2>{0.388202369f, 0.0133707486f},
-std::array<float,2>{0.293067962f, 0.768823445f},
-std::array<float,2>{0.857183397f, 0.228533372f},
-std::array<float,2>{0.582327664f, 0.747223139f},
-std::array<float,2>{0.232818305f, 0.408887476f},
-std::array<float,2>{0.44679907f, 0.625617862f},
-std::array<float,2>{0.980931103f, 0.46135959f},
-std::array<float,2>{0.66869539f, 0.844283283f},
-std::array<float,2>{0.0462948605f, 0.130667999f},
-std::array<float,2>{0.131604001f, 0.912278831f},
-std::array<float,2>{0.516148448f, 0.110608287f},
-std::array<float,2>{0.762337863f, 0.52414912f},
-std::array<float,2>{0.316610515f, 0.30057767f},
-std::array<float,2>{0.206371695f, 0.545538187f},
-std::array<float,2>{0.618004441f, 0.251018584f},
-std::array<float,2>{0.842598617f, 0.883544326f},
-std::array<float,2>{0.270384938f, 0.0915274322f},
-std::array<float,2>{0.432880282f, 0.827912211f},
-std::array<float,2>{0.911028862f, 0.17545934f},
-std::array<float,2>{0.722745717f, 0.683616698f},
-std::array<float,2>{0.121296495f, 0.484229058f},
-std::array<float,2>{0.367114693f, 0.711017549f},
-std::array<float,2>{0.811218143f, 0.389895588f},
-std::array<float,2>{0.538397849f, 0.797252178f},
-std::array<float,2>{0.1566035f, 0.191843897f},
-std::array<float,2>{0.026390845f, 0.954648554f},
-std::array<float,2>{0.628480673f, 0.0359490961f},
-std::array<float,2>{0.946929336f, 0.604114175f},
-std::array<float,2>{0.486466318f, 0.333521783f},
-std::array<float,2>{0.0725438744f, 0.636891723f},
-std::array<float,2>{0.69883132f, 0.455906361f},
-std::array<float,2>{0.892178118f, 0.852169156f},
-std::array<float,2>{0.398891747f, 0.135143653f},
-std::array<float,2>{0.311219931f, 0.91762501f},
-std::array<float,2>{0.870558858f, 0.120643012f},
-std::array<float,2>{0.56917423f, 0.522620797f},
-std::array<float,2>{0.236274764f, 0.305635244f},
-std::array<float,2>{0.462346256f, 0.574562132f},
-std::array<float,2>{0.991941571f, 0.36736536f},
-std::array<float,2>{0.686266601f, 0.985588074f},
-std::array<float,2>{0.0505194999f, 0.00337886275f},
-std::array<float,2>{0.141233101f, 0.773805737f},
-std::array<float,2>{0.503337681f, 0.221740589f},
-std::array<float,2>{0.771112978f, 0.734550416f},
-std::array<float,2>{0.334354848f, 0.415876299f},
-std::array<float,2>{0.172999769f, 0.728203237f},
-std::array<float,2>{0.562154233f, 0.428629369f},
-std::array<float,2>{0.783643901f, 0.764235616f},
-std::array<float,2>{0.348386973f, 0.24990724f},
-std::array<float,2>{0.470576763f, 0.979928017f},
-std::array<float,2>{0.965705812f, 0.0297338441f},
-std::array<float,2>{0.656218469f, 0.581777155f},
-std::array<float,2>{0.0135257719f, 0.349856377f},
-std::array<float,2>{0.261254102f, 0.500372529f},
-std::array<float,2>{0.822657466f, 0.284052044f},
-std::array<float,2>{0.60640794f, 0.936291456f},
-std::array<float,2>{0.192372143f, 0.107607849f},
-std::array<float,2>{0.0967183635f, 0.866261542f},
-std::array<float,2>{0.738982677f, 0.144358054f},
-std::array<float,2>{0.925193012f, 0.644727349f},
-std::array<float,2>{0.411750436f, 0.449841857f},
-std::array<float,2>{0.0405410752f, 0.61524111f},
-std::array<float,2>{0.667040706f, 0.314871401f},
-std::array<float,2>{0.979299188f, 0.945821345f},
-std::array<float,2>{0.452131927f, 0.0565909743f},
-std::array<float,2>{0.312762082f, 0.79054296f},
-std::array<float,2>{0.758283019f, 0.206895262f},
-std::array<float,2>{0.522364736f, 0.691226959f},
-std::array<float,2>{0.127952099f, 0.39981699f},
-std::array<float,2>{0.38290301f, 0.666689217f},
-std::array<float,2>{0.877056956f, 0.489631951f},
-std::array<float,2>{0.717244089f, 0.832456887f},
-std::array<float,2>{0.0926319063f, 0.159435973f},
-std::array<float,2>{0.227163091f, 0.893925786f},
-std::array<float,2>{0.579510868f, 0.0748275965f},
-std::array<float,2>{0.85224849f, 0.552076161f},
-std::array<float,2>{0.291274726f, 0.280602038f},
-std::array<float,2>{0.136734217f, 0.588975906f},
-std::array<float,2>{0.52453655f, 0.355006218f},
-std::array<float,2>{0.757498324f, 0.975693882f},
-std::array<float,2>{0.326432288f, 0.0226780903f},
-std::array<float,2>{0.442335457f, 0.754511058f},
-std::array<float,2>{0.974563599f, 0.238527268f},
-std::array<float,2>{0.663241327f, 0.723171532f},
-std::array<float,2>{0.0381179936f, 0.431140721f},
-std::array<float,2>{0.288560718f, 0.65150255f},
-std::array<float,2>{0.849998116f, 0.438611895f},
-std::array<float,2>{0.59090215f, 0.871259272f},
-std::array<float,2>{0.226033226f, 0.151590258f},
-std::array<float,2>{0.0850831121f, 0.922954679f},
-std::array<float,2>{0.704914033f, 0.0996428207f},
-std::array<float,2>{0.887643337f, 0.514213443f},
-std::array<float,2>{0.377895683f, 0.293133974f},
-std::array<float,2>{0.00153586187f, 0.696992278f},
-std::array<float,2>{0.648004293f, 0.397664964f},
-std::array<float,2>{0.958012581f, 0.781265378f},
-std::array<float,2>{0.477514267f, 0.211422369f},
-std::array<float,2>{0.352657914f, 0.941900849f},
-std::array<float,2>{0.796669185f, 0.0493814461f},
-std::array<float,2>{0.548460484f, 0.622184396f},
-std::array<float,2>{0.184180394f, 0.326264799f},
-std::array<float,2>{0.41538921f, 0.560787916f},
-std::array<float,2>{0.931590796f, 0.271062344f},
-std::array<float,2>{0.745452642f, 0.900839627f},
-std::array<float,2>{0.104571246f, 0.0684536323f},
-std::array<float,2>{0.197787821f, 0.837415934f},
-std::array<float,2>{0.597932279f, 0.168631956f},
-std::array<float,2>{0.814489782f, 0.661934674f},
-std::array<float,2>{0.253731459f, 0.493495554f},
-std::array<float,2>{0.249054939f, 0.67323643f},
-std::array<float,2>{0.574993312f, 0.470803916f},
-std::array<float,2>{0.865723491f, 0.818706095f},
-std::array<float,2>{0.302119434f, 0.184480563f},
-std::array<float,2>{0.393771529f, 0.882383823f},
-std::array<float,2>{0.900604188f, 0.0808917657f},
-std::array<float,2>{0.694453001f, 0.535101235f},
-std::array<float,2>{0.0700878873f, 0.262993246f},
-std::array<float,2>{0.341742873f, 0.59654808f},
-std::array<float,2>{0.779639959f, 0.337632149f},
-std::array<float,2>{0.510505915f, 0.960942864f},
-std::array<float,2>{0.15158464f, 0.0435123555f},
-std::array<float,2>{0.056833189f, 0.810971081f},
-std::array<float,2>{0.677320302f, 0.200749174f},
-std::array<float,2>{0.99509716f, 0.704782128f},
-std::array<float,2>{0.453163028f, 0.382058948f},
-std::array<float,2>{0.116502702f, 0.531198561f},
-std::array<float,2>{0.734160066f, 0.301747173f},
-std::array<float,2>{0.91873318f, 0.907777607f},
-std::array<float,2>{0.427180022f, 0.116154343f},
-std::array<float,2>{0.278830945f, 0.849228323f},
-std::array<float,2>{0.833345711f, 0.125480443f},
-std::array<float,2>{0.614892662f, 0.631951332f},
-std::array<float,2>{0.213910207f, 0.465061635f},
-std::array<float,2>{0.499568641f, 0.745577276f},
-std::array<float,2>{0.94180584f, 0.410701364f},
-std::array<float,2>{0.638090134f, 0.770926416f},
-std::array<float,2>{0.0227739885f, 0.234049663f},
-std::array<float,2>{0.165478289f, 0.995053411f},
-std::array<float,2>{0.541424096f, 0.0106936349f},
-std::array<float,2>{0.804626882f, 0.564270794f},
-std::array<float,2>{0.3690072f, 0.360183507f},
-std::array<float,2>{0.22580336f, 0.586955011f},
-std::array<float,2>{0.591166914f, 0.351873249f},
-std::array<float,2>{0.849809289f, 0.974074304f},
-std::array<float,2>{0.288279533f, 0.0203945693f},
-std::array<float,2>{0.377680242f, 0.756882608f},
-std::array<float,2>{0.887208879f, 0.241901338f},
-std::array<float,2>{0.704688489f, 0.725463629f},
-std::array<float,2>{0.0852628425f, 0.433360517f},
-std::array<float,2>{0.326311529f, 0.649096489f},
-std::array<float,2>{0.757756531f, 0.441158652f},
-std::array<float,2>{0.524674535f, 0.874591768f},
-std::array<float,2>{0.137166649f, 0.150269553f},
-std::array<float,2>{0.0383552164f, 0.925176382f},
-std::array<float,2>{0.66355288f, 0.0976729617f},
-std::array<float,2>{0.9741714f, 0.513510108f},
-std::array<float,2>{0.441974699f, 0.29581508f},
-std::array<float,2>{0.104766414f, 0.697674334f},
-std::array<float,2>{0.74515605f, 0.394651622f},
-std::array<float,2>{0.931272507f, 0.783340812f},
-std::array<float,2>{0.415070623f, 0.213766858f},
-std::array<float,2>{0.253516257f, 0.943849623f},
-std::array<float,2>{0.814767122f, 0.0476791188f},
-std::array<float,2>{0.597673237f, 0.624219835f},
-std::array<float,2>{0.198240519f, 0.325473279f},
-std::array<float,2>{0.477124095f, 0.559612334f},
-std::array<float,2>{0.958384693f, 0.273140967f},
-std::array<float,2>{0.648391128f, 0.899783134f},
-std::array<float,2>{0.00188346824f, 0.0682950243f},
-std::array<float,2>{0.184495658f, 0.838600874f},
-std::array<float,2>{0.548636615f, 0.170940101f},
-std::array<float,2>{0.796423554f, 0.663121998f},
-std::array<float,2>{0.352808297f, 0.494269609f},
-std::array<float,2>{0.151795208f, 0.675033152f},
-std::array<float,2>{0.510461867f, 0.470599711f},
-std::array<float,2>{0.77945894f, 0.816677451f},
-std::array<float,2>{0.341405094f, 0.186735809f},
-std::array<float,2>{0.453427404f, 0.880683899f},
-std::array<float,2>{0.994767606f, 0.079952091f},
-std::array<float,2>{0.677677751f, 0.531788528f},
-std::array<float,2>{0.0570138246f, 0.264354378f},
-std::array<float,2>{0.301837742f, 0.594406247f},
-std::array<float,2>{0.866010129f, 0.338666707f},
-std::array<float,2>{0.574725211f, 0.963938236f},
-std::array<float,2>{0.24942936f, 0.0465781093f},
-std::array<float,2>{0.0699932575f, 0.809590638f},
-std::array<float,2>{0.694790542f, 0.202014685f},
-std::array<float,2>{0.900643051f, 0.706835687f},
-std::array<float,2>{0.393832445f, 0.379745156f},
-std::array<float,2>{0.0226058587f, 0.528796732f},
-std::array<float,2>{0.637721479f, 0.304439008f},
-std::array<float,2>{0.941601157f, 0.908910394f},
-std::array<float,2>{0.499844521f, 0.114746585f},
-std::array<float,2>{0.368755132f, 0.850587845f},
-std::array<float,2>{0.804233491f, 0.128497735f},
-std::array<float,2>{0.541168511f, 0.629307866f},
-std::array<float,2>{0.16504921f, 0.466851592f},
-std::array<float,2>{0.426765949f, 0.742282331f},
-std::array<float,2>{0.918638945f, 0.412980884f},
-std::array<float,2>{0.734076679f, 0.771844447f},
-std::array<float,2>{0.116239838f, 0.231831878f},
-std::array<float,2>{0.214345291f, 0.992704034f},
-std::array<float,2>{0.615169287f, 0.00839875452f},
-std::array<float,2>{0.83321476f, 0.565770566f},
-std::array<float,2>{0.279276043f, 0.363182098f},
-std::array<float,2>{0.156291559f, 0.543442905f},
-std::array<float,2>{0.538203061f, 0.252077341f},
-std::array<float,2>{0.811476588f, 0.884928942f},
-std::array<float,2>{0.366890848f, 0.0935348943f},
-std::array<float,2>{0.4866409f, 0.824654877f},
-std::array<float,2>{0.947128356f, 0.173644483f},
-std::array<float,2>{0.628733754f, 0.685954213f},
-std::array<float,2>{0.026840074f, 0.480965734f},
-std::array<float,2>{0.270070761f, 0.714472175f},
-std::array<float,2>{0.842469931f, 0.386958748f},
-std::array<float,2>{0.617860973f, 0.799018741f},
-std::array<float,2>{0.206296355f, 0.193804547f},
-std::array<float,2>{0.121566296f, 0.956376612f},
-std::array<float,2>{0.722950459f, 0.0381251238f},
-std::array<float,2>{0.910806835f, 0.601730466f},
-std::array<float,2>{0.432787627f, 0.334682673f},
-std::array<float,2>{0.0505866222f, 0.640575528f},
-std::array<float,2>{0.686456442f, 0.453906119f},
-std::array<float,2>{0.99211961f, 0.854281664f},
-std::array<float,2>{0.462030947f, 0.134403005f},
-std::array<float,2>{0.334003627f, 0.915799379f},
-std::array<float,2>{0.771246374f, 0.117236994f},
-std::array<float,2>{0.502939522f, 0.521098554f},
-std::array<float,2>{0.141381189f, 0.308197916f},
-std::array<float,2>{0.398483038f, 0.577893436f},
-std::array<float,2>{0.892498314f, 0.370280892f},
-std::array<float,2>{0.699087739f, 0.986820519f},
-std::array<float,2>{0.0724725202f, 0.0011317163f},
-std::array<float,2>{0.236006573f, 0.777246654f},
-std::array<float,2>{0.568978012f, 0.219003946f},
-std::array<float,2>{0.870326459f, 0.738215387f},
-std::array<float,2>{0.31135878f, 0.416769534f},
-std::array<float,2>{0.191991672f, 0.728730738f},
-std::array<float,2>{0.605968237f, 0.427315593f},
-std::array<float,2>{0.822383881f, 0.762391388f},
-std::array<float,2>{0.26170969f, 0.246760622f},
-std::array<float,2>{0.411900222f, 0.977342308f},
-std::array<float,2>{0.924863636f, 0.0292273089f},
-std::array<float,2>{0.739209533f, 0.579947948f},
-std::array<float,2>{0.0970654339f, 0.349030316f},
-std::array<float,2>{0.348450601f, 0.502510548f},
-std::array<float,2>{0.783370376f, 0.282140195f},
-std::array<float,2>{0.562275827f, 0.935204089f},
-std::array<float,2>{0.173308402f, 0.107261412f},
-std::array<float,2>{0.0133810621f, 0.86485225f},
-std::array<float,2>{0.655940175f, 0.142150939f},
-std::array<float,2>{0.965438783f, 0.647105455f},
-std::array<float,2>{0.470362306f, 0.451313138f},
-std::array<float,2>{0.0923889056f, 0.614972472f},
-std::array<float,2>{0.71682024f, 0.313859254f},
-std::array<float,2>{0.877382934f, 0.947884619f},
-std::array<float,2>{0.383241951f, 0.0583389737f},
-std::array<float,2>{0.291098386f, 0.791838229f},
-std::array<float,2>{0.85242182f, 0.204582602f},
-std::array<float,2>{0.579195499f, 0.687936783f},
-std::array<float,2>{0.22741124f, 0.401252687f},
-std::array<float,2>{0.451863766f, 0.664403141f},
-std::array<float,2>{0.979007185f, 0.491613448f},
-std::array<float,2>{0.667288363f, 0.835176706f},
-std::array<float,2>{0.0409978777f, 0.156536624f},
-std::array<float,2>{0.128281623f, 0.89078033f},
-std::array<float,2>{0.521997154f, 0.0771847069f},
-std::array<float,2>{0.757826447f, 0.553831875f},
-std::array<float,2>{0.312654614f, 0.277432263f},
-std::array<float,2>{0.207960144f, 0.509508014f},
-std::array<float,2>{0.622966051f, 0.292889833f},
-std::array<float,2>{0.836646199f, 0.926224113f},
-std::array<float,2>{0.268467098f, 0.0955987722f},
-std::array<float,2>{0.437391043f, 0.867751539f},
-std::array<float,2>{0.909171999f, 0.154704437f},
-std::array<float,2>{0.721420884f, 0.654590964f},
-std::array<float,2>{0.117378041f, 0.444868892f},
-std::array<float,2>{0.362599373f, 0.718931854f},
-std::array<float,2>{0.80645597f, 0.435933053f},
-std::array<float,2>{0.533933699f, 0.753010631f},
-std::array<float,2>{0.162378877f, 0.236134201f},
-std::array<float,2>{0.0302081835f, 0.972034335f},
-std::array<float,2>{0.63230437f, 0.017291056f},
-std::array<float,2>{0.952626884f, 0.591206074f},
-std::array<float,2>{0.491765708f, 0.357676595f},
-std::array<float,2>{0.077842176f, 0.656459272f},
-std::array<float,2>{0.70214349f, 0.498704463f},
-std::array<float,2>{0.897353888f, 0.840230048f},
-std::array<float,2>{0.404966831f, 0.167326674f},
-std::array<float,2>{0.3047328f, 0.905873239f},
-std::array<float,2>{0.872915804f, 0.0633395091f},
-std::array<float,2>{0.565809131f, 0.555124402f},
-std::array<float,2>{0.23856543f, 0.26768595f},
-std::array<float,2>{0.465420157f, 0.617245018f},
-std::array<float,2>{0.987665951f, 0.320617527f},
-std::array<float,2>{0.682700694f, 0.939391792f},
-std::array<float,2>{0.0522011779f, 0.0523498096f},
-std::array<float,2>{0.146489963f, 0.788663268f},
-std::array<float,2>{0.507241011f, 0.217593715f},
-std::array<float,2>{0.766917109f, 0.702616096f},
-std::array<float,2>{0.329226226f, 0.39150852f},
-std::array<float,2>{0.176922768f, 0.708317757f},
-std::array<float,2>{0.555066466f, 0.377338946f},
-std::array<float,2>{0.785482824f, 0.80679065f},
-std::array<float,2>{0.345884621f, 0.196332589f},
-std::array<float,2>{0.474591196f, 0.968665719f},
-std::array<float,2>{0.961412489f, 0.0423351191f},
-std::array<float,2>{0.649949849f, 0.600579917f},
-std::array<float,2>{0.0115021067f, 0.340548337f},
-std::array<float,2>{0.263895959f, 0.535835624f},
-std::array<float,2>{0.82530123f, 0.261007369f},
-std::array<float,2>{0.60404247f, 0.875579357f},
-std::array<float,2>{0.189364195f, 0.0838400349f},
-std::array<float,2>{0.100509211f, 0.814226687f},
-std::array<float,2>{0.734645247f, 0.181097671f},
-std::array<float,2>{0.929080009f, 0.676918149f},
-std::array<float,2>{0.408861607f, 0.475445747f},
-std::array<float,2>{0.0460229889f, 0.569144368f},
-std::array<float,2>{0.668832958f, 0.364369363f},
-std::array<float,2>{0.980616629f, 0.999997497f},
-std::array<float,2>{0.447171211f, 0.0153692421f},
-std::array<float,2>{0.316851705f, 0.767449081f},
-std::array<float,2>{0.762552857f, 0.227584392f},
-std::array<float,2>{0.516428113f, 0.748567462f},
-std::array<float,2>{0.131504744f, 0.407537252f},
-std::array<float,2>{0.388588369f, 0.628732324f},
-std::array<float,2>{0.881825984f, 0.462906361f},
-std::array<float,2>{0.711262882f, 0.847447634f},
-std::array<float,2>{0.0889808238f, 0.131262109f},
-std::array<float,2>{0.232527196f, 0.911805749f},
-std::array<float,2>{0.582124889f, 0.113249734f},
-std::array<float,2>{0.85708195f, 0.526993454f},
-std::array<float,2>{0.293405712f, 0.297213465f},
-std::array<float,2>{0.136448354f, 0.608030915f},
-std::array<float,2>{0.527579546f, 0.331716657f},
-std::array<float,2>{0.752098083f, 0.960588455f},
-std::array<float,2>{0.321304709f, 0.0328356065f},
-std::array<float,2>{0.440671027f, 0.80395335f},
-std::array<float,2>{0.969709992f, 0.190789521f},
-std::array<float,2>{0.658219635f, 0.718732238f},
-std::array<float,2>{0.0350505933f, 0.386312217f},
-std::array<float,2>{0.282240838f, 0.680675387f},
-std::array<float,2>{0.844161272f, 0.480383247f},
-std::array<float,2>{0.586901069f, 0.82131964f},
-std::array<float,2>{0.220157549f, 0.17589651f},
-std::array<float,2>{0.0792160779f, 0.888139665f},
-std::array<float,2>{0.709538281f, 0.0883171931f},
-std::array<float,2>{0.883846283f, 0.539428592f},
-std::array<float,2>{0.381132156f, 0.257529736f},
-std::array<float,2>{0.00670106523f, 0.742155612f},
-std::array<float,2>{0.641269743f, 0.420386821f},
-std::array<float,2>{0.953235984f, 0.779076755f},
-std::array<float,2>{0.482579023f, 0.226269722f},
-std::array<float,2>{0.356220186f, 0.990043938f},
-std::array<float,2>{0.789165258f, 0.00469082501f},
-std::array<float,2>{0.553847373f, 0.571706355f},
-std::array<float,2>{0.181741133f, 0.373075277f},
-std::array<float,2>{0.420408785f, 0.516402006f},
-std::array<float,2>{0.934363902f, 0.310942978f},
-std::array<float,2>{0.746810734f, 0.920418739f},
-std::array<float,2>{0.105991997f, 0.121133685f},
-std::array<float,2>{0.199285179f, 0.856417418f},
-std::array<float,2>{0.594954431f, 0.137959376f},
-std::array<float,2>{0.81763804f, 0.634552419f},
-std::array<float,2>{0.256401986f, 0.457907587f},
-std::array<float,2>{0.242215544f, 0.64418155f},
-std::array<float,2>{0.572955072f, 0.447209507f},
-std::array<float,2>{0.860967278f, 0.860932887f},
-std::array<float,2>{0.299214631f, 0.144730493f},
-std::array<float,2>{0.397920489f, 0.931488454f},
-std::array<float,2>{0.905276895f, 0.10447403f},
-std::array<float,2>{0.69116801f, 0.505722344f},
-std::array<float,2>{0.0626059175f, 0.286322236f},
-std::array<float,2>{0.33727929f, 0.583872497f},
-std::array<float,2>{0.775526941f, 0.346415281f},
-std::array<float,2>{0.514770448f, 0.984301805f},
-std::array<float,2>{0.155362546f, 0.0269527286f},
-std::array<float,2>{0.0591529459f, 0.75809598f},
-std::array<float,2>{0.673393965f, 0.242341727f},
-std::array<float,2>{0.999212265f, 0.730878055f},
-std::array<float,2>{0.457454532f, 0.422309667f},
-std::array<float,2>{0.110890619f, 0.549743891f},
-std::array<float,2>{0.727748632f, 0.276995063f},
-std::array<float,2>{0.917336822f, 0.898276091f},
-std::array<float,2>{0.425768793f, 0.0727290809f},
-std::array<float,2>{0.276124716f, 0.831444442f},
-std::array<float,2>{0.829139292f, 0.162078947f},
-std::array<float,2>{0.609433472f, 0.669239342f},
-std::array<float,2>{0.217461288f, 0.485783428f},
-std::array<float,2>{0.49559325f, 0.692748487f},
-std::array<float,2>{0.939240098f, 0.403354228f},
-std::array<float,2>{0.633176148f, 0.795665681f},
-std::array<float,2>{0.0189144164f, 0.209377363f},
-std::array<float,2>{0.168542728f, 0.950916767f},
-std::array<float,2>{0.543535709f, 0.0594328679f},
-std::array<float,2>{0.798442185f, 0.611227036f},
-std::array<float,2>{0.37411195f, 0.319329232f},
-std::array<float,2>{0.195621535f, 0.621727586f},
-std::array<float,2>{0.601080358f, 0.327679753f},
-std::array<float,2>{0.813911855f, 0.942498147f},
-std::array<float,2>{0.251833856f, 0.0499077849f},
-std::array<float,2>{0.417006642f, 0.783099413f},
-std::array<float,2>{0.93172884f, 0.212139368f},
-std::array<float,2>{0.742933333f, 0.695838273f},
-std::array<float,2>{0.102280118f, 0.396725774f},
-std::array<float,2>{0.355064601f, 0.660161912f},
-std::array<float,2>{0.793933392f, 0.493144393f},
-std::array<float,2>{0.549496233f, 0.836362958f},
-std::array<float,2>{0.186905816f, 0.169737831f},
-std::array<float,2>{0.00222315802f, 0.902073383f},
-std::array<float,2>{0.646112144f, 0.0700001419f},
-std::array<float,2>{0.959220946f, 0.561749995f},
-std::array<float,2>{0.480333507f, 0.270473987f},
-std::array<float,2>{0.0828145966f, 0.724228263f},
-std::array<float,2>{0.70659107f, 0.430133164f},
-std::array<float,2>{0.890312195f, 0.755194962f},
-std::array<float,2>{0.37669307f, 0.239883348f},
-std::array<float,2>{0.286351532f, 0.974800348f},
-std::array<float,2>{0.847684801f, 0.0215327218f},
-std::array<float,2>{0.591934681f, 0.588032484f},
-std::array<float,2>{0.223946229f, 0.353637338f},
-std::array<float,2>{0.444894463f, 0.515158117f},
-std::array<float,2>{0.976411581f, 0.294689775f},
-std::array<float,2>{0.661901295f, 0.922735572f},
-std::array<float,2>{0.0353581905f, 0.10152185f},
-std::array<float,2>{0.140493423f, 0.872093856f},
-std::array<float,2>{0.526267469f, 0.151074439f},
-std::array<float,2>{0.754359424f, 0.650793433f},
-std::array<float,2>{0.325068533f, 0.437967837f},
-std::array<float,2>{0.167237639f, 0.631388366f},
-std::array<float,2>{0.540831149f, 0.466138929f},
-std::array<float,2>{0.801542699f, 0.84821558f},
-std::array<float,2>{0.36952734f, 0.126382872f},
-std::array<float,2>{0.497502327f, 0.907139599f},
-std::array<float,2>{0.944200516f, 0.117110237f},
-std::array<float,2>{0.639124155f, 0.529343545f},
-std::array<float,2>{0.0211085118f, 0.30218032f},
-std::array<float,2>{0.280661225f, 0.563364327f},
-std::array<float,2>{0.83464545f, 0.360853493f},
-std::array<float,2>{0.616002798f, 0.995821893f},
-std::array<float,2>{0.211871445f, 0.0112042036f},
-std::array<float,2>{0.114534706f, 0.769809902f},
-std::array<float,2>{0.732249975f, 0.232548207f},
-std::array<float,2>{0.921202838f, 0.744219124f},
-std::array<float,2>{0.428515345f, 0.41169706f},
-std::array<float,2>{0.0566345304f, 0.534118831f},
-std::array<float,2>{0.678345621f, 0.261980295f},
-std::array<float,2>{0.993339598f, 0.881788492f},
-std::array<float,2>{0.45681107f, 0.0815595686f},
-std::array<float,2>{0.343228966f, 0.819480658f},
-std::array<float,2>{0.778902113f, 0.1848474f},
-std::array<float,2>{0.508847415f, 0.672570944f},
-std::array<float,2>{0.149934754f, 0.471923828f},
-std::array<float,2>{0.392282426f, 0.703338623f},
-std::array<float,2>{0.898968458f, 0.381184429f},
-std::array<float,2>{0.691575825f, 0.812141895f},
-std::array<float,2>{0.0674883276f, 0.199650526f},
-std::array<float,2>{0.24695684f, 0.962860703f},
-std::array<float,2>{0.576221764f, 0.044030875f},
-std::array<float,2>{0.864340425f, 0.596984923f},
-std::array<float,2>{0.303875536f, 0.336283594f},
-std::array<float,2>{0.143988088f, 0.521594346f},
-std::array<float,2>{0.500988662f, 0.306094676f},
-std::array<float,2>{0.773224473f, 0.916028023f},
-std::array<float,2>{0.333773106f, 0.11955373f},
-std::array<float,2>{0.463023275f, 0.853021324f},
-std::array<float,2>{0.990062237f, 0.135886356f},
-std::array<float,2>{0.683911622f, 0.638370574f},
-std::array<float,2>{0.0469238162f, 0.456762224f},
-std::array<float,2>{0.309247404f, 0.735864341f},
-std::array<float,2>{0.869106591f, 0.414283365f},
-std::array<float,2>{0.5665434f, 0.775151968f},
-std::array<float,2>{0.23670435f, 0.221209988f},
-std::array<float,2>{0.0709947348f, 0.985046744f},
-std::array<float,2>{0.696600258f, 0.00285451417f},
-std::array<float,2>{0.894007862f, 0.575949311f},
-std::array<float,2>{0.402127087f, 0.369112968f},
-std::array<float,2>{0.0244919825f, 0.685127735f},
-std::array<float,2>{0.625812054f, 0.482788384f},
-std::array<float,2>{0.947550416f, 0.826835275f},
-std::array<float,2>{0.48465544f, 0.174633548f},
-std::array<float,2>{0.363649189f, 0.884234369f},
-std::array<float,2>{0.809427559f, 0.0902816206f},
-std::array<float,2>{0.535466433f, 0.546391368f},
-std::array<float,2>{0.158963606f, 0.250009567f},
-std::array<float,2>{0.431043595f, 0.604809165f},
-std::array<float,2>{0.913572431f, 0.332847327f},
-std::array<float,2>{0.725081027f, 0.953505158f},
-std::array<float,2>{0.123827636f, 0.0364407152f},
-std::array<float,2>{0.203294516f, 0.797860324f},
-std::array<float,2>{0.620817244f, 0.192399815f},
-std::array<float,2>{0.841125309f, 0.712477326f},
-std::array<float,2>{0.273309499f, 0.389396012f},
-std::array<float,2>{0.229024068f, 0.689550161f},
-std::array<float,2>{0.580621719f, 0.39881739f},
-std::array<float,2>{0.855049014f, 0.789664328f},
-std::array<float,2>{0.290288776f, 0.205526873f},
-std::array<float,2>{0.386020392f, 0.946326494f},
-std::array<float,2>{0.875065625f, 0.0555275902f},
-std::array<float,2>{0.715054214f, 0.616337121f},
-std::array<float,2>{0.0902044773f, 0.316181898f},
-std::array<float,2>{0.315606803f, 0.550855756f},
-std::array<float,2>{0.76072526f, 0.279347658f},
-std::array<float,2>{0.519868612f, 0.893195927f},
-std::array<float,2>{0.125581712f, 0.0758735016f},
-std::array<float,2>{0.041770786f, 0.833765626f},
-std::array<float,2>{0.664437592f, 0.158709899f},
-std::array<float,2>{0.977494717f, 0.667707443f},
-std::array<float,2>{0.44980675f, 0.488807321f},
-std::array<float,2>{0.0941740796f, 0.580394328f},
-std::array<float,2>{0.740819335f, 0.351555735f},
-std::array<float,2>{0.921986341f, 0.978531897f},
-std::array<float,2>{0.414059937f, 0.0306419712f},
-std::array<float,2>{0.259007782f, 0.764869511f},
-std::array<float,2>{0.820693076f, 0.2481675f},
-std::array<float,2>{0.608640313f, 0.727365315f},
-std::array<float,2>{0.194341943f, 0.429535836f},
-std::array<float,2>{0.471740842f, 0.646458328f},
-std::array<float,2>{0.96734792f, 0.451134503f},
-std::array<float,2>{0.65276897f, 0.865804911f},
-std::array<float,2>{0.0148488926f, 0.143087387f},
-std::array<float,2>{0.174946666f, 0.937053621f},
-std::array<float,2>{0.558764875f, 0.109258965f},
-std::array<float,2>{0.782641888f, 0.501410842f},
-std::array<float,2>{0.350480795f, 0.284322143f},
-std::array<float,2>{0.240277842f, 0.558482885f},
-std::array<float,2>{0.563537598f, 0.267083645f},
-std::array<float,2>{0.873443305f, 0.903348804f},
-std::array<float,2>{0.307054609f, 0.0654700771f},
-std::array<float,2>{0.403587103f, 0.843531728f},
-std::array<float,2>{0.89584434f, 0.165984139f},
-std::array<float,2>{0.700548232f, 0.659253895f},
-std::array<float,2>{0.0750599056f, 0.497924179f},
-std::array<float,2>{0.332012862f, 0.699722052f},
-std::array<float,2>{0.768029034f, 0.393438816f},
-std::array<float,2>{0.504242361f, 0.786379457f},
-std::array<float,2>{0.145590946f, 0.215723038f},
-std::array<float,2>{0.0528872684f, 0.941142678f},
-std::array<float,2>{0.680172443f, 0.0535628274f},
-std::array<float,2>{0.984832644f, 0.619458616f},
-std::array<float,2>{0.467636615f, 0.323671609f},
-std::array<float,2>{0.119508326f, 0.653681755f},
-std::array<float,2>{0.719781458f, 0.443257809f},
-std::array<float,2>{0.907142162f, 0.870876372f},
-std::array<float,2>{0.433983415f, 0.153261513f},
-std::array<float,2>{0.265822828f, 0.928703845f},
-std::array<float,2>{0.838829756f, 0.0971447006f},
-std::array<float,2>{0.623763144f, 0.511054456f},
-std::array<float,2>{0.209744945f, 0.290360838f},
-std::array<float,2>{0.488446951f, 0.593406379f},
-std::array<float,2>{0.951122701f, 0.357040763f},
-std::array<float,2>{0.62896657f, 0.970680833f},
-std::array<float,2>{0.0284160655f, 0.0188743789f},
-std::array<float,2>{0.161046803f, 0.750465214f},
-std::array<float,2>{0.531379163f, 0.238186538f},
-std::array<float,2>{0.808488667f, 0.720855415f},
-std::array<float,2>{0.359489232f, 0.434626967f},
-std::array<float,2>{0.129070073f, 0.746105552f},
-std::array<float,2>{0.518021584f, 0.409542233f},
-std::array<float,2>{0.764949918f, 0.767681777f},
-std::array<float,2>{0.319487214f, 0.22966367f},
-std::array<float,2>{0.447682232f, 0.99718821f},
-std::array<float,2>{0.983230948f, 0.0122064967f},
-std::array<float,2>{0.670751214f, 0.567827284f},
-std::array<float,2>{0.0435817763f, 0.36604315f},
-std::array<float,2>{0.296464205f, 0.52489984f},
-std::array<float,2>{0.85927248f, 0.298859358f},
-std::array<float,2>{0.585485876f, 0.913304865f},
-std::array<float,2>{0.230545655f, 0.109744392f},
-std::array<float,2>{0.0864609405f, 0.84558934f},
-std::array<float,2>{0.713991225f, 0.129059047f},
-std::array<float,2>{0.879831254f, 0.626537263f},
-std::array<float,2>{0.389915496f, 0.462350547f},
-std::array<float,2>{0.00835342892f, 0.598654091f},
-std::array<float,2>{0.65066427f, 0.343434274f},
-std::array<float,2>{0.962890923f, 0.966387987f},
-std::array<float,2>{0.475450844f, 0.039889764f},
-std::array<float,2>{0.345543534f, 0.806388617f},
-std::array<float,2>{0.787670434f, 0.19759199f},
-std::array<float,2>{0.556698143f, 0.709414065f},
-std::array<float,2>{0.177966028f, 0.376837313f},
-std::array<float,2>{0.407849222f, 0.678824544f},
-std::array<float,2>{0.926825225f, 0.473514885f},
-std::array<float,2>{0.737781405f, 0.81484592f},
-std::array<float,2>{0.0989626944f, 0.1831958f},
-std::array<float,2>{0.189647511f, 0.877308011f},
-std::array<float,2>{0.602698445f, 0.0851039514f},
-std::array<float,2>{0.827842295f, 0.537587047f},
-std::array<float,2>{0.262456596f, 0.259262919f},
-std::array<float,2>{0.1803471f, 0.573207021f},
-std::array<float,2>{0.550909519f, 0.371221006f},
-std::array<float,2>{0.791096628f, 0.992158353f},
-std::array<float,2>{0.358479589f, 0.0065534371f},
-std::array<float,2>{0.480881274f, 0.781112909f},
-std::array<float,2>{0.955339313f, 0.223105758f},
-std::array<float,2>{0.642748833f, 0.738549471f},
-std::array<float,2>{0.00415789615f, 0.419071764f},
-std::array<float,2>{0.254258096f, 0.634830475f},
-std::array<float,2>{0.818885744f, 0.459252715f},
-std::array<float,2>{0.597601473f, 0.858810365f},
-std::array<float,2>{0.202572778f, 0.140069798f},
-std::array<float,2>{0.108988434f, 0.918759286f},
-std::array<float,2>{0.749411166f, 0.12452434f},
-std::array<float,2>{0.935606956f, 0.518696606f},
-std::array<float,2>{0.418887883f, 0.309621602f},
-std::array<float,2>{0.0314489044f, 0.714941919f},
-std::array<float,2>{0.657782316f, 0.383457661f},
-std::array<float,2>{0.971410871f, 0.801342607f},
-std::array<float,2>{0.439418226f, 0.187760428f},
-std::array<float,2>{0.323483557f, 0.958812833f},
-std::array<float,2>{0.751660466f, 0.0340763927f},
-std::array<float,2>{0.530502796f, 0.605828941f},
-std::array<float,2>{0.134318843f, 0.328331679f},
-std::array<float,2>{0.379108459f, 0.541693032f},
-std::array<float,2>{0.885136187f, 0.255554467f},
-std::array<float,2>{0.708617687f, 0.889781892f},
-std::array<float,2>{0.0817350969f, 0.0871081501f},
-std::array<float,2>{0.22149308f, 0.822819471f},
-std::array<float,2>{0.588684678f, 0.177786648f},
-std::array<float,2>{0.846082091f, 0.683029115f},
-std::array<float,2>{0.28337115f, 0.47696045f},
-std::array<float,2>{0.216247976f, 0.671304405f},
-std::array<float,2>{0.61276561f, 0.487787008f},
-std::array<float,2>{0.831582904f, 0.829119205f},
-std::array<float,2>{0.274236411f, 0.162799582f},
-std::array<float,2>{0.422915369f, 0.895150781f},
-std::array<float,2>{0.914179265f, 0.0703936219f},
-std::array<float,2>{0.7304672f, 0.54696095f},
-std::array<float,2>{0.11321637f, 0.273713619f},
-std::array<float,2>{0.372433066f, 0.612582624f},
-std::array<float,2>{0.80020231f, 0.316694558f},
-std::array<float,2>{0.545645833f, 0.952994525f},
-std::array<float,2>{0.170785546f, 0.0623427406f},
-std::array<float,2>{0.0157977585f, 0.793206453f},
-std::array<float,2>{0.634992421f, 0.207956821f},
-std::array<float,2>{0.939723015f, 0.695134461f},
-std::array<float,2>{0.49403736f, 0.404350609f},
-std::array<float,2>{0.0661509931f, 0.507385194f},
-std::array<float,2>{0.687843621f, 0.287693858f},
-std::array<float,2>{0.902466595f, 0.933319092f},
-std::array<float,2>{0.394602865f, 0.101746269f},
-std::array<float,2>{0.298709273f, 0.861340582f},
-std::array<float,2>{0.862940431f, 0.148235455f},
-std::array<float,2>{0.570341945f, 0.642478526f},
-std::array<float,2>{0.24585411f, 0.44750306f},
-std::array<float,2>{0.459542006f, 0.732953072f},
-std::array<float,2>{0.997910559f, 0.42541483f},
-std::array<float,2>{0.674432755f, 0.760852754f},
-std::array<float,2>{0.0612088554f, 0.245157316f},
-std::array<float,2>{0.15295513f, 0.981264472f},
-std::array<float,2>{0.512888432f, 0.0234781615f},
-std::array<float,2>{0.774539888f, 0.585362732f},
-std::array<float,2>{0.33852452f, 0.344478965f},
-std::array<float,2>{0.212574974f, 0.565252721f},
-std::array<float,2>{0.616376936f, 0.361742407f},
-std::array<float,2>{0.835684955f, 0.994067311f},
-std::array<float,2>{0.279506356f, 0.00968782138f},
-std::array<float,2>{0.429243654f, 0.773431063f},
-std::array<float,2>{0.920647264f, 0.230870545f},
-std::array<float,2>{0.731104195f, 0.743166864f},
-std::array<float,2>{0.114203222f, 0.413625002f},
-std::array<float,2>{0.370533317f, 0.630354166f},
-std::array<float,2>{0.802469909f, 0.4682706f},
-std::array<float,2>{0.539384842f, 0.849873304f},
-std::array<float,2>{0.166283816f, 0.127871111f},
-std::array<float,2>{0.0203453247f, 0.909947932f},
-std::array<float,2>{0.640545249f, 0.113597117f},
-std::array<float,2>{0.944476902f, 0.52794528f},
-std::array<float,2>{0.497062832f, 0.303086072f},
-std::array<float,2>{0.0669300929f, 0.705181003f},
-std::array<float,2>{0.692414701f, 0.380755395f},
-std::array<float,2>{0.899879336f, 0.809186041f},
-std::array<float,2>{0.390701532f, 0.202694222f},
-std::array<float,2>{0.303600281f, 0.963548899f},
-std::array<float,2>{0.86360687f, 0.0449709855f},
-std::array<float,2>{0.578063011f, 0.594944894f},
-std::array<float,2>{0.247186169f, 0.338975906f},
-std::array<float,2>{0.455086917f, 0.532722831f},
-std::array<float,2>{0.992628396f, 0.265121639f},
-std::array<float,2>{0.679132998f, 0.87960422f},
-std::array<float,2>{0.0553827398f, 0.078392297f},
-std::array<float,2>{0.149051562f, 0.818273783f},
-std::array<float,2>{0.508729815f, 0.185740396f},
-std::array<float,2>{0.778285861f, 0.674375415f},
-std::array<float,2>{0.341984332f, 0.469170034f},
-std::array<float,2>{0.185715497f, 0.662537932f},
-std::array<float,2>{0.550203383f, 0.496050805f},
-std::array<float,2>{0.794304192f, 0.839247227f},
-std::array<float,2>{0.354059845f, 0.170407414f},
-std::array<float,2>{0.478746414f, 0.898457706f},
-std::array<float,2>{0.960291088f, 0.0671532154f},
-std::array<float,2>{0.645199239f, 0.559125781f},
-std::array<float,2>{0.00311716739f, 0.271657676f},
-std::array<float,2>{0.250008702f, 0.623471916f},
-std::array<float,2>{0.812777102f, 0.324290812f},
-std::array<float,2>{0.599939525f, 0.945245028f},
-std::array<float,2>{0.197028741f, 0.0479535237f},
-std::array<float,2>{0.102931671f, 0.784948468f},
-std::array<float,2>{0.744058669f, 0.21400696f},
-std::array<float,2>{0.933284104f, 0.699078441f},
-std::array<float,2>{0.416466832f, 0.396230459f},
-std::array<float,2>{0.0368060432f, 0.511794686f},
-std::array<float,2>{0.660306513f, 0.296306729f},
-std::array<float,2>{0.974698722f, 0.924115181f},
-std::array<float,2>{0.443507552f, 0.0994915217f},
-std::array<float,2>{0.325963169f, 0.873613894f},
-std::array<float,2>{0.75580132f, 0.148758367f},
-std::array<float,2>{0.527276754f, 0.649827898f},
-std::array<float,2>{0.139379218f, 0.440348357f},
-std::array<float,2>{0.375243336f, 0.725980282f},
-std::array<float,2>{0.888784528f, 0.431670159f},
-std::array<float,2>{0.706030488f, 0.756058574f},
-std::array<float,2>{0.0832581669f, 0.240994453f},
-std::array<float,2>{0.222900942f, 0.973393083f},
-std::array<float,2>{0.592809141f, 0.0210639071f},
-std::array<float,2>{0.848865449f, 0.585993528f},
-std::array<float,2>{0.285915852f, 0.352970988f},
-std::array<float,2>{0.126822293f, 0.552842617f},
-std::array<float,2>{0.520630598f, 0.278416395f},
-std::array<float,2>{0.760814309f, 0.892091751f},
-std::array<float,2>{0.315373361f, 0.0768230259f},
-std::array<float,2>{0.450344592f, 0.834252f},
-std::array<float,2>{0.977743328f, 0.158202007f},
-std::array<float,2>{0.665412903f, 0.665828347f},
-std::array<float,2>{0.0420501232f, 0.49092555f},
-std::array<float,2>{0.289746493f, 0.688998818f},
-std::array<float,2>{0.854279578f, 0.401819408f},
-std::array<float,2>{0.581766367f, 0.792786419f},
-std::array<float,2>{0.22974129f, 0.203633875f},
-std::array<float,2>{0.0915806368f, 0.949042976f},
-std::array<float,2>{0.715911984f, 0.0575554855f},
-std::array<float,2>{0.876939416f, 0.613852262f},
-std::array<float,2>{0.384867162f, 0.313213289f},
-std::array<float,2>{0.0145031335f, 0.648027718f},
-std::array<float,2>{0.653552532f, 0.452901095f},
-std::array<float,2>{0.967910111f, 0.863347948f},
-std::array<float,2>{0.471152812f, 0.141302168f},
-std::array<float,2>{0.351271927f, 0.934492052f},
-std::array<float,2>{0.782201648f, 0.105535567f},
-std::array<float,2>{0.560217559f, 0.503673196f},
-std::array<float,2>{0.174482077f, 0.282827735f},
-std::array<float,2>{0.412951261f, 0.578450263f},
-std::array<float,2>{0.922869086f, 0.348181576f},
-std::array<float,2>{0.742046535f, 0.978030801f},
-std::array<float,2>{0.0949715897f, 0.0281594638f},
-std::array<float,2>{0.194227591f, 0.763002396f},
-std::array<float,2>{0.607867718f, 0.247219443f},
-std::array<float,2>{0.821771383f, 0.730443299f},
-std::array<float,2>{0.258775651f, 0.425934941f},
-std::array<float,2>{0.238169417f, 0.736981452f},
-std::array<float,2>{0.567634284f, 0.417879134f},
-std::array<float,2>{0.867243111f, 0.776201069f},
-std::array<float,2>{0.310286015f, 0.220320359f},
-std::array<float,2>{0.400577933f, 0.987955868f},
-std::array<float,2>{0.892767012f, 0.000380984013f},
-std::array<float,2>{0.695488513f, 0.57638967f},
-std::array<float,2>{0.0720103905f, 0.369698733f},
-std::array<float,2>{0.332435131f, 0.520193577f},
-std::array<float,2>{0.772271514f, 0.307511926f},
-std::array<float,2>{0.500221074f, 0.914164364f},
-std::array<float,2>{0.142716408f, 0.118551679f},
-std::array<float,2>{0.0481532663f, 0.854977787f},
-std::array<float,2>{0.684881389f, 0.133738697f},
-std::array<float,2>{0.989256501f, 0.638738215f},
-std::array<float,2>{0.464519948f, 0.454338253f},
-std::array<float,2>{0.124325469f, 0.602587342f},
-std::array<float,2>{0.725860596f, 0.335441679f},
-std::array<float,2>{0.912808239f, 0.955789745f},
-std::array<float,2>{0.43064183f, 0.0377821438f},
-std::array<float,2>{0.271686852f, 0.800532699f},
-std::array<float,2>{0.840731442f, 0.194872499f},
-std::array<float,2>{0.619172812f, 0.713665485f},
-std::array<float,2>{0.204598695f, 0.388169438f},
-std::array<float,2>{0.486050785f, 0.686980307f},
-std::array<float,2>{0.948872328f, 0.481763393f},
-std::array<float,2>{0.626114786f, 0.825638115f},
-std::array<float,2>{0.0242448878f, 0.17217198f},
-std::array<float,2>{0.160057783f, 0.886283994f},
-std::array<float,2>{0.536381423f, 0.0919290185f},
-std::array<float,2>{0.810325563f, 0.544622302f},
-std::array<float,2>{0.364793748f, 0.253339648f},
-std::array<float,2>{0.232277825f, 0.526253581f},
-std::array<float,2>{0.584618747f, 0.298681617f},
-std::array<float,2>{0.858240247f, 0.910529196f},
-std::array<float,2>{0.295553356f, 0.111771978f},
-std::array<float,2>{0.389061749f, 0.846201956f},
-std::array<float,2>{0.880712271f, 0.132155344f},
-std::array<float,2>{0.713449597f, 0.627099097f},
-std::array<float,2>{0.0871364921f, 0.464547336f},
-std::array<float,2>{0.318592101f, 0.749543309f},
-std::array<float,2>{0.763762176f, 0.406818539f},
-std::array<float,2>{0.519502342f, 0.765980124f},
-std::array<float,2>{0.1306483f, 0.226684421f},
-std::array<float,2>{0.044056043f, 0.998690844f},
-std::array<float,2>{0.671646416f, 0.0142946132f},
-std::array<float,2>{0.983780801f, 0.569339871f},
-std::array<float,2>{0.448332638f, 0.363750517f},
-std::array<float,2>{0.0977318808f, 0.67655313f},
-std::array<float,2>{0.736643136f, 0.475884974f},
-std::array<float,2>{0.926173508f, 0.812660754f},
-std::array<float,2>{0.406684637f, 0.17972067f},
-std::array<float,2>{0.263113767f, 0.876129866f},
-std::array<float,2>{0.827122986f, 0.0822294652f},
-std::array<float,2>{0.602035046f, 0.536584973f},
-std::array<float,2>{0.191171288f, 0.26017645f},
-std::array<float,2>{0.476358235f, 0.60077095f},
-std::array<float,2>{0.963928223f, 0.341577917f},
-std::array<float,2>{0.652297199f, 0.967620492f},
-std::array<float,2>{0.00909891631f, 0.0417010859f},
-std::array<float,2>{0.179100722f, 0.807859302f},
-std::array<float,2>{0.557751119f, 0.195535645f},
-std::array<float,2>{0.788748145f, 0.707290769f},
-std::array<float,2>{0.343952417f, 0.378038764f},
-std::array<float,2>{0.145432442f, 0.701557517f},
-std::array<float,2>{0.505277514f, 0.391892582f},
-std::array<float,2>{0.768742442f, 0.787395895f},
-std::array<float,2>{0.330210656f, 0.21784085f},
-std::array<float,2>{0.468701988f, 0.937688649f},
-std::array<float,2>{0.986166477f, 0.0515538268f},
-std::array<float,2>{0.681165934f, 0.619037747f},
-std::array<float,2>{0.0544225797f, 0.321449697f},
-std::array<float,2>{0.307617575f, 0.555829763f},
-std::array<float,2>{0.874808371f, 0.269150108f},
-std::array<float,2>{0.562516332f, 0.905219913f},
-std::array<float,2>{0.241466045f, 0.0636967793f},
-std::array<float,2>{0.0761355534f, 0.840865254f},
-std::array<float,2>{0.700159371f, 0.166154921f},
-std::array<float,2>{0.895374715f, 0.657594502f},
-std::array<float,2>{0.403140306f, 0.499362737f},
-std::array<float,2>{0.0275308248f, 0.590597212f},
-std::array<float,2>{0.630246639f, 0.359113872f},
-std::array<float,2>{0.950160563f, 0.971109271f},
-std::array<float,2>{0.489933491f, 0.0165898241f},
-std::array<float,2>{0.360492319f, 0.752926588f},
-std::array<float,2>{0.806894362f, 0.234649852f},
-std::array<float,2>{0.532425702f, 0.720013618f},
-std::array<float,2>{0.161738247f, 0.437336653f},
-std::array<float,2>{0.434841514f, 0.655839622f},
-std::array<float,2>{0.907839417f, 0.443914205f},
-std::array<float,2>{0.719373822f, 0.868579745f},
-std::array<float,2>{0.120949f, 0.155455008f},
-std::array<float,2>{0.210190848f, 0.926875591f},
-std::array<float,2>{0.624239564f, 0.0946500301f},
-std::array<float,2>{0.839239299f, 0.50858897f},
-std::array<float,2>{0.267477483f, 0.291757584f},
-std::array<float,2>{0.171138912f, 0.609526932f},
-std::array<float,2>{0.545918405f, 0.319824964f},
-std::array<float,2>{0.799792707f, 0.949508607f},
-std::array<float,2>{0.371213436f, 0.0600057915f},
-std::array<float,2>{0.492222458f, 0.796125948f},
-std::array<float,2>{0.940887332f, 0.210268185f},
-std::array<float,2>{0.63670212f, 0.692364514f},
-std::array<float,2>{0.0174960922f, 0.403273314f},
-std::array<float,2>{0.275371015f, 0.668138266f},
-std::array<float,2>{0.830089927f, 0.484747112f},
-std::array<float,2>{0.611760199f, 0.830974996f},
-std::array<float,2>{0.215071842f, 0.160280704f},
-std::array<float,2>{0.111569494f, 0.897102654f},
-std::array<float,2>{0.728749752f, 0.0735482126f},
-std::array<float,2>{0.915802181f, 0.55049634f},
-std::array<float,2>{0.421981156f, 0.275747359f},
-std::array<float,2>{0.0615300797f, 0.731530786f},
-std::array<float,2>{0.67484504f, 0.423342288f},
-std::array<float,2>{0.996497571f, 0.759055912f},
-std::array<float,2>{0.460142136f, 0.243865296f},
-std::array<float,2>{0.339747965f, 0.982836604f},
-std::array<float,2>{0.773538828f, 0.0263417158f},
-std::array<float,2>{0.512674034f, 0.58203721f},
-std::array<float,2>{0.153823331f, 0.347009897f},
-std::array<float,2>{0.396070242f, 0.504460514f},
-std::array<float,2>{0.903629541f, 0.286012113f},
-std::array<float,2>{0.688720942f, 0.930334151f},
-std::array<float,2>{0.064631179f, 0.104875639f},
-std::array<float,2>{0.244383872f, 0.860145628f},
-std::array<float,2>{0.571961045f, 0.146174133f},
-std::array<float,2>{0.861433446f, 0.643260181f},
-std::array<float,2>{0.297576517f, 0.445507616f},
-std::array<float,2>{0.20137848f, 0.633631051f},
-std::array<float,2>{0.595969558f, 0.458124727f},
-std::array<float,2>{0.82024318f, 0.856579304f},
-std::array<float,2>{0.255053222f, 0.137505099f},
-std::array<float,2>{0.419691116f, 0.920970738f},
-std::array<float,2>{0.93729198f, 0.12277057f},
-std::array<float,2>{0.74872297f, 0.517310619f},
-std::array<float,2>{0.107729465f, 0.312125057f},
-std::array<float,2>{0.358260483f, 0.571053267f},
-std::array<float,2>{0.792166233f, 0.374503106f},
-std::array<float,2>{0.552085042f, 0.988418162f},
-std::array<float,2>{0.181245208f, 0.00529105263f},
-std::array<float,2>{0.00513064628f, 0.777892649f},
-std::array<float,2>{0.643902302f, 0.225478411f},
-std::array<float,2>{0.956151962f, 0.740632117f},
-std::array<float,2>{0.482005775f, 0.42109856f},
-std::array<float,2>{0.080482319f, 0.540606797f},
-std::array<float,2>{0.707439601f, 0.255953282f},
-std::array<float,2>{0.886086047f, 0.887180865f},
-std::array<float,2>{0.380734682f, 0.0898210555f},
-std::array<float,2>{0.284325212f, 0.820979178f},
-std::array<float,2>{0.846952021f, 0.176960319f},
-std::array<float,2>{0.589199066f, 0.680449128f},
-std::array<float,2>{0.222276405f, 0.479049236f},
-std::array<float,2>{0.437827826f, 0.716902554f},
-std::array<float,2>{0.972030938f, 0.384998202f},
-std::array<float,2>{0.656808615f, 0.802757621f},
-std::array<float,2>{0.032902211f, 0.190162361f},
-std::array<float,2>{0.133438498f, 0.959936976f},
-std::array<float,2>{0.530001462f, 0.0314641073f},
-std::array<float,2>{0.750614941f, 0.609217227f},
-std::array<float,2>{0.322457165f, 0.330175012f},
-std::array<float,2>{0.248806715f, 0.596167862f},
-std::array<float,2>{0.575395405f, 0.337313831f},
-std::array<float,2>{0.866905987f, 0.961612046f},
-std::array<float,2>{0.301063895f, 0.043033164f},
-std::array<float,2>{0.393062294f, 0.811080396f},
-std::array<float,2>{0.901526868f, 0.200545534f},
-std::array<float,2>{0.693675399f, 0.70434618f},
-std::array<float,2>{0.0686650127f, 0.382682979f},
-std::array<float,2>{0.340425849f, 0.673695385f},
-std::array<float,2>{0.780719757f, 0.471288383f},
-std::array<float,2>{0.511499584f, 0.81894505f},
-std::array<float,2>{0.151212662f, 0.184038535f},
-std::array<float,2>{0.0577805825f, 0.881860673f},
-std::array<float,2>{0.676439643f, 0.0802737996f},
-std::array<float,2>{0.995296299f, 0.534227908f},
-std::array<float,2>{0.454205841f, 0.263309002f},
-std::array<float,2>{0.116077229f, 0.745661199f},
-std::array<float,2>{0.732640505f, 0.410446078f},
-std::array<float,2>{0.919856489f, 0.771292508f},
-std::array<float,2>{0.42636618f, 0.233547747f},
-std::array<float,2>{0.278269589f, 0.994181037f},
-std::array<float,2>{0.832827687f, 0.0100842565f},
-std::array<float,2>{0.614172578f, 0.563514471f},
-std::array<float,2>{0.213588715f, 0.359577119f},
-std::array<float,2>{0.498450458f, 0.530349016f},
-std::array<float,2>{0.942791164f, 0.300902337f},
-std::array<float,2>{0.637567461f, 0.907262862f},
-std::array<float,2>{0.0219362583f, 0.115570709f},
-std::array<float,2>{0.164250016f, 0.848873317f},
-std::array<float,2>{0.542772591f, 0.125711352f},
-std::array<float,2>{0.803224266f, 0.632639229f},
-std::array<float,2>{0.367900074f, 0.465728015f},
-std::array<float,2>{0.138281971f, 0.652287304f},
-std::array<float,2>{0.523514569f, 0.439205229f},
-std::array<float,2>{0.756675482f, 0.87205416f},
-std::array<float,2>{0.327460587f, 0.152112842f},
-std::array<float,2>{0.443217605f, 0.923691034f},
-std::array<float,2>{0.973296165f, 0.100252688f},
-std::array<float,2>{0.662569761f, 0.514133334f},
-std::array<float,2>{0.0379793271f, 0.293553531f},
-std::array<float,2>{0.287178308f, 0.589595258f},
-std::array<float,2>{0.851346731f, 0.354512453f},
-std::array<float,2>{0.59016186f, 0.976223588f},
-std::array<float,2>{0.224754989f, 0.0230649002f},
-std::array<float,2>{0.08415436f, 0.753949463f},
-std::array<float,2>{0.703801811f, 0.239145488f},
-std::array<float,2>{0.888594866f, 0.723101258f},
-std::array<float,2>{0.378345311f, 0.431591958f},
-std::array<float,2>{5.21755173e-05f, 0.561289251f},
-std::array<float,2>{0.647062719f, 0.270910501f},
-std::array<float,2>{0.957839489f, 0.901237249f},
-std::array<float,2>{0.477767974f, 0.0688498467f},
-std::array<float,2>{0.351678282f, 0.83714056f},
-std::array<float,2>{0.795762479f, 0.168169692f},
-std::array<float,2>{0.547409952f, 0.661348701f},
-std::array<float,2>{0.184621602f, 0.49371171f},
-std::array<float,2>{0.414634913f, 0.696350574f},
-std::array<float,2>{0.929839849f, 0.398302674f},
-std::array<float,2>{0.745028675f, 0.781850994f},
-std::array<float,2>{0.1043979f, 0.211896092f},
-std::array<float,2>{0.199164063f, 0.94185555f},
-std::array<float,2>{0.599205017f, 0.0492553227f},
-std::array<float,2>{0.815452635f, 0.622892976f},
-std::array<float,2>{0.252485484f, 0.326748937f},
-std::array<float,2>{0.17187503f, 0.500625372f},
-std::array<float,2>{0.560734808f, 0.283583611f},
-std::array<float,2>{0.784921885f, 0.935980439f},
-std::array<float,2>{0.3490358f, 0.108112f},
-std::array<float,2>{0.469566017f, 0.866858363f},
-std::array<float,2>{0.966304779f, 0.143731177f},
-std::array<float,2>{0.654582739f, 0.645156503f},
-std::array<float,2>{0.0122611923f, 0.449383557f},
-std::array<float,2>{0.260265559f, 0.727752507f},
-std::array<float,2>{0.823797345f, 0.42793557f},
-std::array<float,2>{0.607330203f, 0.764017105f},
-std::array<float,2>{0.193187669f, 0.24903959f},
-std::array<float,2>{0.0957827494f, 0.980008364f},
-std::array<float,2>{0.740075171f, 0.0300689042f},
-std::array<float,2>{0.924039602f, 0.581171036f},
-std::array<float,2>{0.410213262f, 0.350251883f},
-std::array<float,2>{0.0399143435f, 0.666503131f},
-std::array<float,2>{0.666344821f, 0.490164489f},
-std::array<float,2>{0.979911506f, 0.832671225f},
-std::array<float,2>{0.452204555f, 0.159705058f},
-std::array<float,2>{0.314258367f, 0.894361794f},
-std::array<float,2>{0.759577692f, 0.0743205696f},
-std::array<float,2>{0.523120105f, 0.552491546f},
-std::array<float,2>{0.127612337f, 0.280809492f},
-std::array<float,2>{0.384443462f, 0.616157353f},
-std::array<float,2>{0.878544033f, 0.315128505f},
-std::array<float,2>{0.718712151f, 0.945691824f},
-std::array<float,2>{0.0933887959f, 0.0558607988f},
-std::array<float,2>{0.227648333f, 0.790214717f},
-std::array<float,2>{0.578474224f, 0.206335813f},
-std::array<float,2>{0.852915227f, 0.690831006f},
-std::array<float,2>{0.292725563f, 0.39999792f},
-std::array<float,2>{0.205940396f, 0.711539209f},
-std::array<float,2>{0.619119644f, 0.390615404f},
-std::array<float,2>{0.842778623f, 0.797405064f},
-std::array<float,2>{0.270620435f, 0.192202345f},
-std::array<float,2>{0.431832612f, 0.95413214f},
-std::array<float,2>{0.911548674f, 0.0352659412f},
-std::array<float,2>{0.724294364f, 0.603990972f},
-std::array<float,2>{0.12221726f, 0.33317858f},
-std::array<float,2>{0.366076767f, 0.544993043f},
-std::array<float,2>{0.811846852f, 0.251592696f},
-std::array<float,2>{0.537526309f, 0.883254588f},
-std::array<float,2>{0.158010721f, 0.090882577f},
-std::array<float,2>{0.0263307765f, 0.827502012f},
-std::array<float,2>{0.627925336f, 0.17491065f},
-std::array<float,2>{0.945902944f, 0.684504509f},
-std::array<float,2>{0.488018543f, 0.483708769f},
-std::array<float,2>{0.0733706802f, 0.574848473f},
-std::array<float,2>{0.697724223f, 0.368034363f},
-std::array<float,2>{0.890908182f, 0.985932767f},
-std::array<float,2>{0.400062174f, 0.0036794683f},
-std::array<float,2>{0.311618328f, 0.774038672f},
-std::array<float,2>{0.869649649f, 0.222574785f},
-std::array<float,2>{0.570040524f, 0.735342205f},
-std::array<float,2>{0.2352954f, 0.415070385f},
-std::array<float,2>{0.461798161f, 0.63763696f},
-std::array<float,2>{0.990568638f, 0.455173314f},
-std::array<float,2>{0.686581314f, 0.851776004f},
-std::array<float,2>{0.049436897f, 0.135466203f},
-std::array<float,2>{0.142254889f, 0.917144239f},
-std::array<float,2>{0.502200365f, 0.120408498f},
-std::array<float,2>{0.769996643f, 0.523324251f},
-std::array<float,2>{0.335835934f, 0.305138826f},
-std::array<float,2>{0.187547445f, 0.539036632f},
-std::array<float,2>{0.604563236f, 0.257977515f},
-std::array<float,2>{0.82444942f, 0.878581226f},
-std::array<float,2>{0.265353322f, 0.0840372667f},
-std::array<float,2>{0.4098804f, 0.815683544f},
-std::array<float,2>{0.9279387f, 0.182117522f},
-std::array<float,2>{0.736192405f, 0.678450286f},
-std::array<float,2>{0.101211853f, 0.474355876f},
-std::array<float,2>{0.347196788f, 0.710856915f},
-std::array<float,2>{0.787007928f, 0.375114977f},
-std::array<float,2>{0.556123376f, 0.805630744f},
-std::array<float,2>{0.176184565f, 0.199161783f},
-std::array<float,2>{0.0101684276f, 0.965011775f},
-std::array<float,2>{0.649001539f, 0.0409068391f},
-std::array<float,2>{0.962622821f, 0.598429084f},
-std::array<float,2>{0.472943068f, 0.341947049f},
-std::array<float,2>{0.0879953802f, 0.625276148f},
-std::array<float,2>{0.712391138f, 0.461701155f},
-std::array<float,2>{0.882138431f, 0.844032466f},
-std::array<float,2>{0.38692385f, 0.129896134f},
-std::array<float,2>{0.294074535f, 0.91284591f},
-std::array<float,2>{0.856041133f, 0.110885754f},
-std::array<float,2>{0.583191812f, 0.523870707f},
-std::array<float,2>{0.233957753f, 0.299944818f},
-std::array<float,2>{0.445770323f, 0.566926003f},
-std::array<float,2>{0.981508255f, 0.366268247f},
-std::array<float,2>{0.66916877f, 0.997048557f},
-std::array<float,2>{0.0458094254f, 0.01299283f},
-std::array<float,2>{0.132544816f, 0.769301474f},
-std::array<float,2>{0.516890168f, 0.229179457f},
-std::array<float,2>{0.762887299f, 0.747824013f},
-std::array<float,2>{0.31804353f, 0.408418834f},
-std::array<float,2>{0.163278759f, 0.722320735f},
-std::array<float,2>{0.534600317f, 0.434138387f},
-std::array<float,2>{0.80520767f, 0.751825333f},
-std::array<float,2>{0.36169973f, 0.237274721f},
-std::array<float,2>{0.491197199f, 0.968955696f},
-std::array<float,2>{0.951968253f, 0.0182644073f},
-std::array<float,2>{0.631477892f, 0.591935396f},
-std::array<float,2>{0.0304608047f, 0.355614394f},
-std::array<float,2>{0.268710792f, 0.50985986f},
-std::array<float,2>{0.837335527f, 0.289509594f},
-std::array<float,2>{0.621726811f, 0.928768158f},
-std::array<float,2>{0.208883971f, 0.096183762f},
-std::array<float,2>{0.118438892f, 0.869682789f},
-std::array<float,2>{0.721888006f, 0.154046312f},
-std::array<float,2>{0.910108924f, 0.653217793f},
-std::array<float,2>{0.436356097f, 0.441750884f},
-std::array<float,2>{0.0509175919f, 0.620322526f},
-std::array<float,2>{0.681730986f, 0.323112339f},
-std::array<float,2>{0.986899495f, 0.939976513f},
-std::array<float,2>{0.466378033f, 0.054616075f},
-std::array<float,2>{0.328843594f, 0.786068261f},
-std::array<float,2>{0.766174197f, 0.216538012f},
-std::array<float,2>{0.506835401f, 0.700468063f},
-std::array<float,2>{0.147752568f, 0.394353271f},
-std::array<float,2>{0.405787915f, 0.658645928f},
-std::array<float,2>{0.898072422f, 0.496737242f},
-std::array<float,2>{0.702864587f, 0.842606664f},
-std::array<float,2>{0.0761999264f, 0.164567918f},
-std::array<float,2>{0.24005796f, 0.902954996f},
-std::array<float,2>{0.564539969f, 0.065420635f},
-std::array<float,2>{0.871367991f, 0.557354271f},
-std::array<float,2>{0.306051522f, 0.266396374f},
-std::array<float,2>{0.155263856f, 0.584857285f},
-std::array<float,2>{0.513756454f, 0.345364928f},
-std::array<float,2>{0.776478529f, 0.981968284f},
-std::array<float,2>{0.336119294f, 0.0253601819f},
-std::array<float,2>{0.458978713f, 0.759822905f},
-std::array<float,2>{0.998558998f, 0.244629174f},
-std::array<float,2>{0.672548413f, 0.733802199f},
-std::array<float,2>{0.0598033443f, 0.424762666f},
-std::array<float,2>{0.300684333f, 0.640971482f},
-std::array<float,2>{0.860197365f, 0.44902125f},
-std::array<float,2>{0.573463321f, 0.862496138f},
-std::array<float,2>{0.243937626f, 0.146981016f},
-std::array<float,2>{0.0635971949f, 0.932583869f},
-std::array<float,2>{0.69017458f, 0.102963388f},
-std::array<float,2>{0.904929638f, 0.50678587f},
-std::array<float,2>{0.396517158f, 0.28906092f},
-std::array<float,2>{0.0182307921f, 0.693698943f},
-std::array<float,2>{0.634449542f, 0.405597955f},
-std::array<float,2>{0.93817687f, 0.794468939f},
-std::array<float,2>{0.49420765f, 0.208324239f},
-std::array<float,2>{0.373863131f, 0.951544285f},
-std::array<float,2>{0.797069788f, 0.0614314564f},
-std::array<float,2>{0.544433713f, 0.611868918f},
-std::array<float,2>{0.169479579f, 0.31834358f},
-std::array<float,2>{0.424217045f, 0.548296988f},
-std::array<float,2>{0.916703999f, 0.275175422f},
-std::array<float,2>{0.726610422f, 0.895657182f},
-std::array<float,2>{0.109891832f, 0.0713722706f},
-std::array<float,2>{0.218040943f, 0.828976274f},
-std::array<float,2>{0.610649765f, 0.163242936f},
-std::array<float,2>{0.828686833f, 0.670659423f},
-std::array<float,2>{0.276974946f, 0.486549824f},
-std::array<float,2>{0.218950629f, 0.682294726f},
-std::array<float,2>{0.587377906f, 0.478002429f},
-std::array<float,2>{0.845045865f, 0.824060321f},
-std::array<float,2>{0.282181501f, 0.179143026f},
-std::array<float,2>{0.382422924f, 0.888682842f},
-std::array<float,2>{0.883704007f, 0.0868953019f},
-std::array<float,2>{0.710363328f, 0.542608917f},
-std::array<float,2>{0.0788142234f, 0.25428915f},
-std::array<float,2>{0.320655257f, 0.607046962f},
-std::array<float,2>{0.753260851f, 0.329559624f},
-std::array<float,2>{0.528519452f, 0.957493365f},
-std::array<float,2>{0.135000408f, 0.0348129831f},
-std::array<float,2>{0.0334108993f, 0.801910937f},
-std::array<float,2>{0.659721315f, 0.188640341f},
-std::array<float,2>{0.970573306f, 0.716676652f},
-std::array<float,2>{0.440128624f, 0.38389191f},
-std::array<float,2>{0.107059322f, 0.518105388f},
-std::array<float,2>{0.747633874f, 0.309456736f},
-std::array<float,2>{0.934886158f, 0.919085443f},
-std::array<float,2>{0.421553582f, 0.123497069f},
-std::array<float,2>{0.25726229f, 0.857729077f},
-std::array<float,2>{0.816472769f, 0.139014825f},
-std::array<float,2>{0.594155252f, 0.636176109f},
-std::array<float,2>{0.200405627f, 0.46019575f},
-std::array<float,2>{0.483625859f, 0.739641666f},
-std::array<float,2>{0.954201818f, 0.418449163f},
-std::array<float,2>{0.641623795f, 0.779550552f},
-std::array<float,2>{0.00758870551f, 0.223871559f},
-std::array<float,2>{0.182916835f, 0.991178811f},
-std::array<float,2>{0.553376138f, 0.00720582623f},
-std::array<float,2>{0.790652514f, 0.573916972f},
-std::array<float,2>{0.357330889f, 0.372518688f},
-std::array<float,2>{0.23465322f, 0.576738179f},
-std::array<float,2>{0.569794655f, 0.369335413f},
-std::array<float,2>{0.869394362f, 0.987341046f},
-std::array<float,2>{0.312271953f, 0.000877008133f},
-std::array<float,2>{0.399449021f, 0.775814176f},
-std::array<float,2>{0.891228378f, 0.219823152f},
-std::array<float,2>{0.697846711f, 0.736421227f},
-std::array<float,2>{0.0740061104f, 0.41704157f},
-std::array<float,2>{0.335247487f, 0.639545739f},
-std::array<float,2>{0.770032346f, 0.454791963f},
-std::array<float,2>{0.502766371f, 0.855139554f},
-std::array<float,2>{0.141977251f, 0.133228317f},
-std::array<float,2>{0.0493030809f, 0.914591193f},
-std::array<float,2>{0.687107086f, 0.119137652f},
-std::array<float,2>{0.991016388f, 0.519664824f},
-std::array<float,2>{0.461002618f, 0.306695789f},
-std::array<float,2>{0.122748032f, 0.713072956f},
-std::array<float,2>{0.72373879f, 0.388623953f},
-std::array<float,2>{0.911645114f, 0.799900293f},
-std::array<float,2>{0.432297885f, 0.194410503f},
-std::array<float,2>{0.271097451f, 0.955478251f},
-std::array<float,2>{0.843391716f, 0.0371778756f},
-std::array<float,2>{0.618316174f, 0.603333354f},
-std::array<float,2>{0.205151334f, 0.335672379f},
-std::array<float,2>{0.487306476f, 0.54406929f},
-std::array<float,2>{0.945777953f, 0.253801733f},
-std::array<float,2>{0.627259135f, 0.886042297f},
-std::array<float,2>{0.0254448727f, 0.0924713612f},
-std::array<float,2>{0.157365844f, 0.825985372f},
-std::array<float,2>{0.537735045f, 0.172523886f},
-std::array<float,2>{0.812319398f, 0.687238038f},
-std::array<float,2>{0.365663797f, 0.48226881f},
-std::array<float,2>{0.127320558f, 0.665194035f},
-std::array<float,2>{0.522852361f, 0.490667552f},
-std::array<float,2>{0.758865774f, 0.834506094f},
-std::array<float,2>{0.313919961f, 0.157429144f},
-std::array<float,2>{0.452911049f, 0.891824543f},
-std::array<float,2>{0.980108261f, 0.0763638318f},
-std::array<float,2>{0.666949093f, 0.553266585f},
-std::array<float,2>{0.0390859656f, 0.278987378f},
-std::array<float,2>{0.292474031f, 0.613317728f},
-std::array<float,2>{0.853261113f, 0.31286487f},
-std::array<float,2>{0.578705311f, 0.948452175f},
-std::array<float,2>{0.228510857f, 0.0567143969f},
-std::array<float,2>{0.0932458416f, 0.792454958f},
-std::array<float,2>{0.717958927f, 0.203126311f},
-std::array<float,2>{0.878106534f, 0.688900113f},
-std::array<float,2>{0.384056389f, 0.402048558f},
-std::array<float,2>{0.0121618994f, 0.503195107f},
-std::array<float,2>{0.655203581f, 0.282586426f},
-std::array<float,2>{0.966457844f, 0.93391794f},
-std::array<float,2>{0.469218999f, 0.106368177f},
-std::array<float,2>{0.349497527f, 0.863898218f},
-std::array<float,2>{0.784533739f, 0.140702009f},
-std::array<float,2>{0.561161518f, 0.647593379f},
-std::array<float,2>{0.172406957f, 0.452301651f},
-std::array<float,2>{0.41091308f, 0.729852617f},
-std::array<float,2>{0.924713135f, 0.426491946f},
-std::array<float,2>{0.739642501f, 0.763275146f},
-std::array<float,2>{0.0963683501f, 0.248010948f},
-std::array<float,2>{0.192489579f, 0.977889538f},
-std::array<float,2>{0.606492996f, 0.0277676005f},
-std::array<float,2>{0.823558927f, 0.578981936f},
-std::array<float,2>{0.260131955f, 0.347782314f},
-std::array<float,2>{0.185261816f, 0.558976531f},
-std::array<float,2>{0.54733932f, 0.272243679f},
-std::array<float,2>{0.795333624f, 0.899336696f},
-std::array<float,2>{0.352414846f, 0.0665612668f},
-std::array<float,2>{0.478378475f, 0.839481413f},
-std::array<float,2>{0.957191586f, 0.170852348f},
-std::array<float,2>{0.646839797f, 0.662715852f},
-std::array<float,2>{0.000692992005f, 0.495596766f},
-std::array<float,2>{0.252384871f, 0.698630333f},
-std::array<float,2>{0.816192806f, 0.395832747f},
-std::array<float,2>{0.598869264f, 0.784583449f},
-std::array<float,2>{0.198521599f, 0.214397773f},
-std::array<float,2>{0.103554368f, 0.944414139f},
-std::array<float,2>{0.744417071f, 0.0483752303f},
-std::array<float,2>{0.930617571f, 0.623734057f},
-std::array<float,2>{0.41441524f, 0.324943036f},
-std::array<float,2>{0.0375568494f, 0.650303125f},
-std::array<float,2>{0.662866652f, 0.439874947f},
-std::array<float,2>{0.972682476f, 0.873208106f},
-std::array<float,2>{0.442486405f, 0.149378106f},
-std::array<float,2>{0.327706724f, 0.924502432f},
-std::array<float,2>{0.75599432f, 0.0987147763f},
-std::array<float,2>{0.524402797f, 0.512437522f},
-std::array<float,2>{0.138084307f, 0.296450198f},
-std::array<float,2>{0.37850517f, 0.586571395f},
-std::array<float,2>{0.888145268f, 0.353481233f},
-std::array<float,2>{0.703597665f, 0.972952306f},
-std::array<float,2>{0.0845612437f, 0.020887224f},
-std::array<float,2>{0.225274518f, 0.756802738f},
-std::array<float,2>{0.590781569f, 0.240285814f},
-std::array<float,2>{0.850596189f, 0.726218939f},
-std::array<float,2>{0.287859708f, 0.432596415f},
-std::array<float,2>{0.213280842f, 0.74397862f},
-std::array<float,2>{0.613546252f, 0.413496941f},
-std::array<float,2>{0.832264841f, 0.772606254f},
-std::array<float,2>{0.277814478f, 0.230989158f},
-std::array<float,2>{0.425935775f, 0.993187308f},
-std::array<float,2>{0.919365168f, 0.00915641896f},
-std::array<float,2>{0.733037174f, 0.564819157f},
-std::array<float,2>{0.115716092f, 0.362168789f},
-std::array<float,2>{0.367373079f, 0.527600706f},
-std::array<float,2>{0.802910149f, 0.303477824f},
-std::array<float,2>{0.542043149f, 0.909198761f},
-std::array<float,2>{0.164705873f, 0.114101633f},
-std::array<float,2>{0.0221655983f, 0.850299358f},
-std::array<float,2>{0.636779428f, 0.127411529f},
-std::array<float,2>{0.943207502f, 0.630754292f},
-std::array<float,2>{0.498694599f, 0.46780926f},
-std::array<float,2>{0.0690464824f, 0.595637143f},
-std::array<float,2>{0.693989217f, 0.33936283f},
-std::array<float,2>{0.902265072f, 0.963103473f},
-std::array<float,2>{0.393527567f, 0.0456607752f},
-std::array<float,2>{0.301521271f, 0.809036374f},
-std::array<float,2>{0.866485298f, 0.202405959f},
-std::array<float,2>{0.575830102f, 0.705980003f},
-std::array<float,2>{0.24837856f, 0.380140811f},
-std::array<float,2>{0.454967439f, 0.674028635f},
-std::array<float,2>{0.995880067f, 0.469262958f},
-std::array<float,2>{0.675954819f, 0.817724645f},
-std::array<float,2>{0.0581088066f, 0.18646349f},
-std::array<float,2>{0.150794923f, 0.879001439f},
-std::array<float,2>{0.511225641f, 0.0787165985f},
-std::array<float,2>{0.781222224f, 0.532592833f},
-std::array<float,2>{0.340032727f, 0.265144348f},
-std::array<float,2>{0.200817451f, 0.516967297f},
-std::array<float,2>{0.594519913f, 0.311631441f},
-std::array<float,2>{0.817079902f, 0.92177999f},
-std::array<float,2>{0.257465273f, 0.122176856f},
-std::array<float,2>{0.421155214f, 0.857263505f},
-std::array<float,2>{0.935311437f, 0.137120217f},
-std::array<float,2>{0.747468889f, 0.632908344f},
-std::array<float,2>{0.106781229f, 0.458789885f},
-std::array<float,2>{0.356506258f, 0.741183221f},
-std::array<float,2>{0.790261507f, 0.421543658f},
-std::array<float,2>{0.552832067f, 0.777365804f},
-std::array<float,2>{0.183428273f, 0.224771798f},
-std::array<float,2>{0.00697974302f, 0.988785028f},
-std::array<float,2>{0.642154694f, 0.00575879635f},
-std::array<float,2>{0.954592347f, 0.570682108f},
-std::array<float,2>{0.484321594f, 0.374543726f},
-std::array<float,2>{0.0782797188f, 0.679696739f},
-std::array<float,2>{0.710836768f, 0.478666782f},
-std::array<float,2>{0.883084774f, 0.820498705f},
-std::array<float,2>{0.382175148f, 0.177384555f},
-std::array<float,2>{0.281469405f, 0.887547433f},
-std::array<float,2>{0.845658004f, 0.0890439078f},
-std::array<float,2>{0.587675631f, 0.540119588f},
-std::array<float,2>{0.219399914f, 0.256380141f},
-std::array<float,2>{0.439583749f, 0.608748615f},
-std::array<float,2>{0.970202148f, 0.330650657f},
-std::array<float,2>{0.659467638f, 0.959005177f},
-std::array<float,2>{0.0339221172f, 0.0321699791f},
-std::array<float,2>{0.135529116f, 0.803259134f},
-std::array<float,2>{0.528864264f, 0.189740941f},
-std::array<float,2>{0.753651679f, 0.717694104f},
-std::array<float,2>{0.321165621f, 0.385672569f},
-std::array<float,2>{0.169424355f, 0.691522181f},
-std::array<float,2>{0.544325829f, 0.402763933f},
-std::array<float,2>{0.797601223f, 0.796515048f},
-std::array<float,2>{0.373081297f, 0.210451782f},
-std::array<float,2>{0.494886249f, 0.949843705f},
-std::array<float,2>{0.937612653f, 0.0604840107f},
-std::array<float,2>{0.633970857f, 0.61014694f},
-std::array<float,2>{0.0179320276f, 0.319762796f},
-std::array<float,2>{0.276536703f, 0.550059319f},
-std::array<float,2>{0.828141272f, 0.276067168f},
-std::array<float,2>{0.611016631f, 0.896523356f},
-std::array<float,2>{0.218409628f, 0.0738359764f},
-std::array<float,2>{0.109602235f, 0.830336034f},
-std::array<float,2>{0.727335513f, 0.161032781f},
-std::array<float,2>{0.916413128f, 0.668861508f},
-std::array<float,2>{0.424764395f, 0.485228539f},
-std::array<float,2>{0.0605030023f, 0.582732975f},
-std::array<float,2>{0.672041357f, 0.347307235f},
-std::array<float,2>{0.998348117f, 0.983069956f},
-std::array<float,2>{0.458255202f, 0.025770817f},
-std::array<float,2>{0.336464703f, 0.759383738f},
-std::array<float,2>{0.776910841f, 0.24362272f},
-std::array<float,2>{0.514288306f, 0.732364953f},
-std::array<float,2>{0.154781431f, 0.422857285f},
-std::array<float,2>{0.397109836f, 0.642631292f},
-std::array<float,2>{0.904531419f, 0.445807546f},
-std::array<float,2>{0.689546883f, 0.859756172f},
-std::array<float,2>{0.0644360855f, 0.145895392f},
-std::array<float,2>{0.243479237f, 0.930089414f},
-std::array<float,2>{0.574047327f, 0.105428986f},
-std::array<float,2>{0.859392047f, 0.50430119f},
-std::array<float,2>{0.299881905f, 0.285460949f},
-std::array<float,2>{0.148031697f, 0.618564248f},
-std::array<float,2>{0.506023824f, 0.322188377f},
-std::array<float,2>{0.766002059f, 0.938185692f},
-std::array<float,2>{0.32819277f, 0.0511691198f},
-std::array<float,2>{0.466183692f, 0.787698269f},
-std::array<float,2>{0.986747742f, 0.218417272f},
-std::array<float,2>{0.682390749f, 0.701825857f},
-std::array<float,2>{0.0513570681f, 0.392365217f},
-std::array<float,2>{0.306502759f, 0.657749832f},
-std::array<float,2>{0.872070312f, 0.499883801f},
-std::array<float,2>{0.56524837f, 0.841457784f},
-std::array<float,2>{0.239745647f, 0.166602999f},
-std::array<float,2>{0.0771010891f, 0.904450476f},
-std::array<float,2>{0.702386677f, 0.064256303f},
-std::array<float,2>{0.897657573f, 0.556403577f},
-std::array<float,2>{0.405673623f, 0.268963933f},
-std::array<float,2>{0.0309818145f, 0.720276773f},
-std::array<float,2>{0.631166339f, 0.436582148f},
-std::array<float,2>{0.95153898f, 0.752175272f},
-std::array<float,2>{0.490481377f, 0.23512502f},
-std::array<float,2>{0.362018883f, 0.971391439f},
-std::array<float,2>{0.805148363f, 0.0159418639f},
-std::array<float,2>{0.535028458f, 0.589848101f},
-std::array<float,2>{0.163858891f, 0.358670235f},
-std::array<float,2>{0.435948938f, 0.508151293f},
-std::array<float,2>{0.909611225f, 0.291174799f},
-std::array<float,2>{0.722575963f, 0.927421987f},
-std::array<float,2>{0.118790373f, 0.0939578861f},
-std::array<float,2>{0.20826216f, 0.868665755f},
-std::array<float,2>{0.621420443f, 0.155914739f},
-std::array<float,2>{0.837749779f, 0.655632198f},
-std::array<float,2>{0.269156128f, 0.443650633f},
-std::array<float,2>{0.233579695f, 0.627897978f},
-std::array<float,2>{0.583707631f, 0.464033693f},
-std::array<float,2>{0.85583663f, 0.845967472f},
-std::array<float,2>{0.294834584f, 0.132520795f},
-std::array<float,2>{0.387625098f, 0.910885274f},
-std::array<float,2>{0.882737815f, 0.112060338f},
-std::array<float,2>{0.712491333f, 0.525679111f},
-std::array<float,2>{0.0886885375f, 0.298305899f},
-std::array<float,2>{0.317735285f, 0.570225477f},
-std::array<float,2>{0.763589203f, 0.364215553f},
-std::array<float,2>{0.517292559f, 0.99839443f},
-std::array<float,2>{0.132108927f, 0.0140086291f},
-std::array<float,2>{0.0449775383f, 0.766174912f},
-std::array<float,2>{0.669762135f, 0.227512285f},
-std::array<float,2>{0.982082665f, 0.749061644f},
-std::array<float,2>{0.445971161f, 0.406423151f},
-std::array<float,2>{0.100705281f, 0.536926448f},
-std::array<float,2>{0.735812724f, 0.260495931f},
-std::array<float,2>{0.928704798f, 0.876794338f},
-std::array<float,2>{0.409261435f, 0.0828252137f},
-std::array<float,2>{0.264874697f, 0.813372433f},
-std::array<float,2>{0.825028479f, 0.180306494f},
-std::array<float,2>{0.605113089f, 0.676031291f},
-std::array<float,2>{0.188054904f, 0.476356179f},
-std::array<float,2>{0.473217368f, 0.707665086f},
-std::array<float,2>{0.961940289f, 0.378647089f},
-std::array<float,2>{0.648858249f, 0.808338821f},
-std::array<float,2>{0.0103211291f, 0.196180403f},
-std::array<float,2>{0.176299736f, 0.966841698f},
-std::array<float,2>{0.556544304f, 0.041206982f},
-std::array<float,2>{0.786542773f, 0.601182878f},
-std::array<float,2>{0.347166061f, 0.341138095f},
-std::array<float,2>{0.204270944f, 0.604463398f},
-std::array<float,2>{0.619735718f, 0.333920985f},
-std::array<float,2>{0.840197206f, 0.955062389f},
-std::array<float,2>{0.272071123f, 0.0358393677f},
-std::array<float,2>{0.430070043f, 0.797011673f},
-std::array<float,2>{0.912117124f, 0.191586509f},
-std::array<float,2>{0.726535678f, 0.711195767f},
-std::array<float,2>{0.124836333f, 0.38981548f},
-std::array<float,2>{0.36441794f, 0.68394798f},
-std::array<float,2>{0.80967629f, 0.483992994f},
-std::array<float,2>{0.536690474f, 0.827842295f},
-std::array<float,2>{0.15920046f, 0.175557733f},
-std::array<float,2>{0.0236280076f, 0.88362807f},
-std::array<float,2>{0.626694918f, 0.0915627033f},
-std::array<float,2>{0.948594332f, 0.545765519f},
-std::array<float,2>{0.485647798f, 0.251443923f},
-std::array<float,2>{0.0715156868f, 0.734680891f},
-std::array<float,2>{0.695899487f, 0.415629536f},
-std::array<float,2>{0.893108964f, 0.773520589f},
-std::array<float,2>{0.401257336f, 0.222047031f},
-std::array<float,2>{0.309866011f, 0.985640705f},
-std::array<float,2>{0.868125439f, 0.003020562f},
-std::array<float,2>{0.567992032f, 0.5742293f},
-std::array<float,2>{0.237495244f, 0.36750859f},
-std::array<float,2>{0.4638713f, 0.522748828f},
-std::array<float,2>{0.988386333f, 0.30534336f},
-std::array<float,2>{0.685205936f, 0.917895854f},
-std::array<float,2>{0.0485768653f, 0.121083967f},
-std::array<float,2>{0.143385351f, 0.852429926f},
-std::array<float,2>{0.500848174f, 0.13498269f},
-std::array<float,2>{0.771650136f, 0.636978567f},
-std::array<float,2>{0.332715541f, 0.455586642f},
-std::array<float,2>{0.173926696f, 0.644949019f},
-std::array<float,2>{0.559610724f, 0.450086057f},
-std::array<float,2>{0.781374872f, 0.866481543f},
-std::array<float,2>{0.35075438f, 0.144124523f},
-std::array<float,2>{0.471527785f, 0.936156213f},
-std::array<float,2>{0.968505859f, 0.107670307f},
-std::array<float,2>{0.654258013f, 0.50019151f},
-std::array<float,2>{0.0140849324f, 0.283740252f},
-std::array<float,2>{0.2581155f, 0.581969619f},
-std::array<float,2>{0.821857214f, 0.349829495f},
-std::array<float,2>{0.608237505f, 0.979724467f},
-std::array<float,2>{0.193831593f, 0.0293072928f},
-std::array<float,2>{0.0953463763f, 0.764556289f},
-std::array<float,2>{0.741366088f, 0.249562547f},
-std::array<float,2>{0.923399508f, 0.728348374f},
-std::array<float,2>{0.41241017f, 0.428307176f},
-std::array<float,2>{0.0427086279f, 0.551906526f},
-std::array<float,2>{0.665729523f, 0.280446231f},
-std::array<float,2>{0.978112757f, 0.893707871f},
-std::array<float,2>{0.450693756f, 0.0751529261f},
-std::array<float,2>{0.314613342f, 0.832243204f},
-std::array<float,2>{0.761287034f, 0.159408182f},
-std::array<float,2>{0.521342635f, 0.666974545f},
-std::array<float,2>{0.126014084f, 0.489260435f},
-std::array<float,2>{0.385360628f, 0.690940976f},
-std::array<float,2>{0.876140952f, 0.399462551f},
-std::array<float,2>{0.716471434f, 0.791002393f},
-std::array<float,2>{0.0908883512f, 0.206714734f},
-std::array<float,2>{0.229989514f, 0.946156502f},
-std::array<float,2>{0.581258535f, 0.0561917275f},
-std::array<float,2>{0.853959799f, 0.615556955f},
-std::array<float,2>{0.289334446f, 0.3145684f},
-std::array<float,2>{0.138926536f, 0.514423788f},
-std::array<float,2>{0.526560307f, 0.293251485f},
-std::array<float,2>{0.755354583f, 0.923128188f},
-std::array<float,2>{0.325542927f, 0.0999073833f},
-std::array<float,2>{0.444099873f, 0.87142092f},
-std::array<float,2>{0.975487113f, 0.151676953f},
-std::array<float,2>{0.661125839f, 0.651758075f},
-std::array<float,2>{0.0363518074f, 0.43890363f},
-std::array<float,2>{0.285593659f, 0.7233935f},
-std::array<float,2>{0.84942776f, 0.430872649f},
-std::array<float,2>{0.593438089f, 0.754779756f},
-std::array<float,2>{0.223471075f, 0.238296524f},
-std::array<float,2>{0.0836903304f, 0.975833178f},
-std::array<float,2>{0.705108345f, 0.0229233745f},
-std::array<float,2>{0.889629841f, 0.589183569f},
-std::array<float,2>{0.375739425f, 0.355386853f},
-std::array<float,2>{0.00344726257f, 0.661838472f},
-std::array<float,2>{0.644780815f, 0.493349701f},
-std::array<float,2>{0.96050787f, 0.837789237f},
-std::array<float,2>{0.479454547f, 0.168753967f},
-std::array<float,2>{0.35388875f, 0.900592089f},
-std::array<float,2>{0.794587433f, 0.0686565861f},
-std::array<float,2>{0.550684512f, 0.560933113f},
-std::array<float,2>{0.186080158f, 0.271290302f},
-std::array<float,2>{0.416722149f, 0.622471094f},
-std::array<float,2>{0.93288964f, 0.326546848f},
-std::array<float,2>{0.743431151f, 0.942366719f},
-std::array<float,2>{0.103409365f, 0.049598258f},
-std::array<float,2>{0.196752757f, 0.781692505f},
-std::array<float,2>{0.600451887f, 0.211022228f},
-std::array<float,2>{0.81331861f, 0.697241306f},
-std::array<float,2>{0.250849932f, 0.397732943f},
-std::array<float,2>{0.247669607f, 0.70501101f},
-std::array<float,2>{0.577510417f, 0.382129937f},
-std::array<float,2>{0.86389941f, 0.810558796f},
-std::array<float,2>{0.303163469f, 0.201084077f},
-std::array<float,2>{0.391282171f, 0.961268187f},
-std::array<float,2>{0.900050879f, 0.0438074544f},
-std::array<float,2>{0.692913234f, 0.596207321f},
-std::array<float,2>{0.0666197166f, 0.337819338f},
-std::array<float,2>{0.34263429f, 0.534768701f},
-std::array<float,2>{0.777750909f, 0.262832791f},
-std::array<float,2>{0.50823456f, 0.882688642f},
-std::array<float,2>{0.148608565f, 0.0807031393f},
-std::array<float,2>{0.0548863225f, 0.818501711f},
-std::array<float,2>{0.679352403f, 0.184086695f},
-std::array<float,2>{0.993133783f, 0.672891736f},
-std::array<float,2>{0.455965221f, 0.471134394f},
-std::array<float,2>{0.113562442f, 0.564028323f},
-std::array<float,2>{0.730910063f, 0.35995549f},
-std::array<float,2>{0.920223892f, 0.994688809f},
-std::array<float,2>{0.429190785f, 0.0103315199f},
-std::array<float,2>{0.279835343f, 0.770537198f},
-std::array<float,2>{0.835422873f, 0.23432225f},
-std::array<float,2>{0.616797805f, 0.745282173f},
-std::array<float,2>{0.212297827f, 0.411063612f},
-std::array<float,2>{0.496401101f, 0.632117152f},
-std::array<float,2>{0.944880843f, 0.465102077f},
-std::array<float,2>{0.639800608f, 0.849393427f},
-std::array<float,2>{0.0197512358f, 0.125145257f},
-std::array<float,2>{0.16668722f, 0.908077717f},
-std::array<float,2>{0.539820671f, 0.115916505f},
-std::array<float,2>{0.802221715f, 0.530894756f},
-std::array<float,2>{0.370673984f, 0.301395684f},
-std::array<float,2>{0.222093344f, 0.542269886f},
-std::array<float,2>{0.589803636f, 0.25466004f},
-std::array<float,2>{0.847469389f, 0.889423251f},
-std::array<float,2>{0.285122037f, 0.0862684399f},
-std::array<float,2>{0.380312592f, 0.823295295f},
-std::array<float,2>{0.886303365f, 0.17952235f},
-std::array<float,2>{0.707891107f, 0.681690395f},
-std::array<float,2>{0.0807783306f, 0.478489101f},
-std::array<float,2>{0.323173791f, 0.716299951f},
-std::array<float,2>{0.750380754f, 0.384599447f},
-std::array<float,2>{0.529769599f, 0.802358985f},
-std::array<float,2>{0.133212313f, 0.189376891f},
-std::array<float,2>{0.0324434973f, 0.957546771f},
-std::array<float,2>{0.656382143f, 0.0342355743f},
-std::array<float,2>{0.972533345f, 0.606646657f},
-std::array<float,2>{0.438285857f, 0.329966158f},
-std::array<float,2>{0.108271748f, 0.636689126f},
-std::array<float,2>{0.748053551f, 0.460610896f},
-std::array<float,2>{0.936538637f, 0.858117521f},
-std::array<float,2>{0.419330269f, 0.139301091f},
-std::array<float,2>{0.255783528f, 0.919763446f},
-std::array<float,2>{0.819498599f, 0.123913057f},
-std::array<float,2>{0.596308768f, 0.51771605f},
-std::array<float,2>{0.201897085f, 0.308737367f},
-std::array<float,2>{0.481856167f, 0.573280692f},
-std::array<float,2>{0.956582546f, 0.373042256f},
-std::array<float,2>{0.644437611f, 0.990462959f},
-std::array<float,2>{0.00578001235f, 0.007461634f},
-std::array<float,2>{0.181132287f, 0.78019011f},
-std::array<float,2>{0.552549481f, 0.224156171f},
-std::array<float,2>{0.792892933f, 0.739813149f},
-std::array<float,2>{0.35765925f, 0.418532491f},
-std::array<float,2>{0.153331056f, 0.734049439f},
-std::array<float,2>{0.511874557f, 0.424214274f},
-std::array<float,2>{0.774338305f, 0.760508537f},
-std::array<float,2>{0.338944197f, 0.244178429f},
-std::array<float,2>{0.460868478f, 0.981699467f},
-std::array<float,2>{0.99698025f, 0.0247202758f},
-std::array<float,2>{0.675513029f, 0.584035993f},
-std::array<float,2>{0.0624357909f, 0.345010161f},
-std::array<float,2>{0.29696843f, 0.506286919f},
-std::array<float,2>{0.862074256f, 0.288303167f},
-std::array<float,2>{0.571394742f, 0.931651473f},
-std::array<float,2>{0.244701415f, 0.103468604f},
-std::array<float,2>{0.0650440976f, 0.86288023f},
-std::array<float,2>{0.689216912f, 0.146565303f},
-std::array<float,2>{0.904165983f, 0.641506433f},
-std::array<float,2>{0.395574093f, 0.448636025f},
-std::array<float,2>{0.0169398859f, 0.611690402f},
-std::array<float,2>{0.635974884f, 0.317484319f},
-std::array<float,2>{0.94138056f, 0.952077866f},
-std::array<float,2>{0.492766261f, 0.0609461702f},
-std::array<float,2>{0.371809065f, 0.794397831f},
-std::array<float,2>{0.798877358f, 0.208525479f},
-std::array<float,2>{0.546596885f, 0.693852961f},
-std::array<float,2>{0.171453446f, 0.406090349f},
-std::array<float,2>{0.422369212f, 0.670406222f},
-std::array<float,2>{0.915338576f, 0.48719123f},
-std::array<float,2>{0.729127049f, 0.828360558f},
-std::array<float,2>{0.112239204f, 0.16361174f},
-std::array<float,2>{0.215629637f, 0.89639765f},
-std::array<float,2>{0.611983478f, 0.0719981641f},
-std::array<float,2>{0.831020057f, 0.548687816f},
-std::array<float,2>{0.274464726f, 0.274742514f},
-std::array<float,2>{0.161516383f, 0.592497349f},
-std::array<float,2>{0.532862723f, 0.356272459f},
-std::array<float,2>{0.807492554f, 0.969496191f},
-std::array<float,2>{0.360891521f, 0.01803823f},
-std::array<float,2>{0.489649206f, 0.751326621f},
-std::array<float,2>{0.949688852f, 0.236627981f},
-std::array<float,2>{0.630409062f, 0.722036183f},
-std::array<float,2>{0.0282109659f, 0.433715492f},
-std::array<float,2>{0.266752213f, 0.652604699f},
-std::array<float,2>{0.839400053f, 0.442062825f},
-std::array<float,2>{0.624611676f, 0.869276404f},
-std::array<float,2>{0.210761204f, 0.153765231f},
-std::array<float,2>{0.1205846f, 0.929447532f},
-std::array<float,2>{0.718933284f, 0.0962327644f},
-std::array<float,2>{0.907505751f, 0.51039958f},
-std::array<float,2>{0.435531139f, 0.28993547f},
-std::array<float,2>{0.0539389253f, 0.700905204f},
-std::array<float,2>{0.68102634f, 0.393640041f},
-std::array<float,2>{0.98563379f, 0.785170972f},
-std::array<float,2>{0.467903256f, 0.215983495f},
-std::array<float,2>{0.330698729f, 0.939582646f},
-std::array<float,2>{0.769379437f, 0.0540389828f},
-std::array<float,2>{0.505517423f, 0.620719254f},
-std::array<float,2>{0.144999534f, 0.322605699f},
-std::array<float,2>{0.402724862f, 0.556788206f},
-std::array<float,2>{0.894882262f, 0.265711129f},
-std::array<float,2>{0.699620962f, 0.902793288f},
-std::array<float,2>{0.0756108165f, 0.0646008328f},
-std::array<float,2>{0.242013231f, 0.842172265f},
-std::array<float,2>{0.563462675f, 0.164249301f},
-std::array<float,2>{0.874045372f, 0.659147918f},
-std::array<float,2>{0.308190703f, 0.496130735f},
-std::array<float,2>{0.190628201f, 0.677983224f},
-std::array<float,2>{0.602277398f, 0.473808229f},
-std::array<float,2>{0.826355338f, 0.81599617f},
-std::array<float,2>{0.263184488f, 0.18234241f},
-std::array<float,2>{0.407044053f, 0.878186226f},
-std::array<float,2>{0.926641047f, 0.0848035514f},
-std::array<float,2>{0.737112045f, 0.538417697f},
-std::array<float,2>{0.0984981582f, 0.258562803f},
-std::array<float,2>{0.344448656f, 0.598095894f},
-std::array<float,2>{0.788504362f, 0.34254694f},
-std::array<float,2>{0.558145821f, 0.965717196f},
-std::array<float,2>{0.179478899f, 0.0403583348f},
-std::array<float,2>{0.00942127407f, 0.80497402f},
-std::array<float,2>{0.651747644f, 0.198330805f},
-std::array<float,2>{0.964655638f, 0.710377872f},
-std::array<float,2>{0.475766957f, 0.37591365f},
-std::array<float,2>{0.0877616704f, 0.524182737f},
-std::array<float,2>{0.713256121f, 0.300528765f},
-std::array<float,2>{0.880068123f, 0.912560642f},
-std::array<float,2>{0.389633596f, 0.110529482f},
-std::array<float,2>{0.294975877f, 0.84469986f},
-std::array<float,2>{0.857681155f, 0.13052839f},
-std::array<float,2>{0.58437258f, 0.625802636f},
-std::array<float,2>{0.231887192f, 0.461059928f},
-std::array<float,2>{0.449089199f, 0.74748081f},
-std::array<float,2>{0.984373152f, 0.409053415f},
-std::array<float,2>{0.671038806f, 0.768791974f},
-std::array<float,2>{0.0448784307f, 0.228924841f},
-std::array<float,2>{0.130076334f, 0.996453643f},
-std::array<float,2>{0.518642485f, 0.0135011636f},
-std::array<float,2>{0.764537632f, 0.566868663f},
-std::array<float,2>{0.319068164f, 0.36678642f},
-std::array<float,2>{0.194983825f, 0.579465985f},
-std::array<float,2>{0.608971953f, 0.349340707f},
-std::array<float,2>{0.821076155f, 0.976648927f},
-std::array<float,2>{0.259588033f, 0.0284690745f},
-std::array<float,2>{0.413563013f, 0.762148798f},
-std::array<float,2>{0.922843754f, 0.24635081f},
-std::array<float,2>{0.740290642f, 0.729423225f},
-std::array<float,2>{0.0943754241f, 0.427177727f},
-std::array<float,2>{0.349711359f, 0.646632016f},
-std::array<float,2>{0.782953203f, 0.451885641f},
-std::array<float,2>{0.559555769f, 0.864426792f},
-std::array<float,2>{0.175755337f, 0.141768202f},
-std::array<float,2>{0.0155443233f, 0.934896469f},
-std::array<float,2>{0.653204143f, 0.106666766f},
-std::array<float,2>{0.96695745f, 0.501988471f},
-std::array<float,2>{0.472535789f, 0.281439394f},
-std::array<float,2>{0.0907085687f, 0.688370705f},
-std::array<float,2>{0.715628803f, 0.400562286f},
-std::array<float,2>{0.875860453f, 0.791273713f},
-std::array<float,2>{0.386487663f, 0.204693139f},
-std::array<float,2>{0.290708899f, 0.947519898f},
-std::array<float,2>{0.854502618f, 0.0576878674f},
-std::array<float,2>{0.580445826f, 0.614304423f},
-std::array<float,2>{0.228998929f, 0.314412236f},
-std::array<float,2>{0.449589044f, 0.554525137f},
-std::array<float,2>{0.976855993f, 0.277932376f},
-std::array<float,2>{0.664577186f, 0.891392827f},
-std::array<float,2>{0.0414927304f, 0.0779989585f},
-std::array<float,2>{0.125315085f, 0.835745037f},
-std::array<float,2>{0.520282745f, 0.157163516f},
-std::array<float,2>{0.760090172f, 0.664611638f},
-std::array<float,2>{0.316035151f, 0.491892934f},
-std::array<float,2>{0.158482268f, 0.686522305f},
-std::array<float,2>{0.535690904f, 0.48071602f},
-std::array<float,2>{0.808688641f, 0.824846268f},
-std::array<float,2>{0.363919199f, 0.173243567f},
-std::array<float,2>{0.484996438f, 0.885291994f},
-std::array<float,2>{0.94791621f, 0.0928812027f},
-std::array<float,2>{0.625008345f, 0.543485165f},
-std::array<float,2>{0.0251804944f, 0.25250113f},
-std::array<float,2>{0.272603989f, 0.602086306f},
-std::array<float,2>{0.841391623f, 0.334014893f},
-std::array<float,2>{0.620545506f, 0.956934512f},
-std::array<float,2>{0.203614622f, 0.0388113074f},
-std::array<float,2>{0.123056769f, 0.799682498f},
-std::array<float,2>{0.725421846f, 0.194330066f},
-std::array<float,2>{0.913637757f, 0.714235663f},
-std::array<float,2>{0.43117103f, 0.387272507f},
-std::array<float,2>{0.0478298552f, 0.520742059f},
-std::array<float,2>{0.684527338f, 0.307896435f},
-std::array<float,2>{0.989364386f, 0.91512537f},
-std::array<float,2>{0.463775128f, 0.117730074f},
-std::array<float,2>{0.333301365f, 0.853958547f},
-std::array<float,2>{0.772763431f, 0.133907512f},
-std::array<float,2>{0.501592696f, 0.639790237f},
-std::array<float,2>{0.144159347f, 0.453518689f},
-std::array<float,2>{0.401521951f, 0.737629235f},
-std::array<float,2>{0.894069374f, 0.416218281f},
-std::array<float,2>{0.69678241f, 0.776431739f},
-std::array<float,2>{0.070643656f, 0.219389215f},
-std::array<float,2>{0.237163305f, 0.986506701f},
-std::array<float,2>{0.567234635f, 0.0014682156f},
-std::array<float,2>{0.868464947f, 0.577267408f},
-std::array<float,2>{0.309050351f, 0.370682418f},
-std::array<float,2>{0.149702862f, 0.53143698f},
-std::array<float,2>{0.509752393f, 0.263836712f},
-std::array<float,2>{0.778741837f, 0.880255461f},
-std::array<float,2>{0.343617052f, 0.0791997835f},
-std::array<float,2>{0.456192017f, 0.817044437f},
-std::array<float,2>{0.994048953f, 0.187449843f},
-std::array<float,2>{0.677870095f, 0.675435901f},
-std::array<float,2>{0.0560614951f, 0.470111459f},
-std::array<float,2>{0.304534853f, 0.706317902f},
-std::array<float,2>{0.865171313f, 0.378928363f},
-std::array<float,2>{0.576693237f, 0.810318589f},
-std::array<float,2>{0.246494099f, 0.201583579f},
-std::array<float,2>{0.0683160052f, 0.964595199f},
-std::array<float,2>{0.692251086f, 0.0463567078f},
-std::array<float,2>{0.89868784f, 0.593826234f},
-std::array<float,2>{0.39163959f, 0.337921858f},
-std::array<float,2>{0.0209710095f, 0.629504144f},
-std::array<float,2>{0.639344394f, 0.467441142f},
-std::array<float,2>{0.943633795f, 0.851113796f},
-std::array<float,2>{0.497956663f, 0.128410518f},
-std::array<float,2>{0.370007843f, 0.908491671f},
-std::array<float,2>{0.800943434f, 0.114736162f},
-std::array<float,2>{0.540463984f, 0.528838158f},
-std::array<float,2>{0.167626753f, 0.304077327f},
-std::array<float,2>{0.428195745f, 0.565944791f},
-std::array<float,2>{0.921812892f, 0.362343132f},
-std::array<float,2>{0.731693625f, 0.992256582f},
-std::array<float,2>{0.114937544f, 0.00806399155f},
-std::array<float,2>{0.211327672f, 0.772012115f},
-std::array<float,2>{0.615534902f, 0.232111692f},
-std::array<float,2>{0.834342301f, 0.74300766f},
-std::array<float,2>{0.280904144f, 0.412591636f},
-std::array<float,2>{0.224213257f, 0.724862218f},
-std::array<float,2>{0.592625976f, 0.432691664f},
-std::array<float,2>{0.848333061f, 0.757582605f},
-std::array<float,2>{0.286920011f, 0.241544038f},
-std::array<float,2>{0.376361549f, 0.974392414f},
-std::array<float,2>{0.890135229f, 0.0198842939f},
-std::array<float,2>{0.70616585f, 0.587512493f},
-std::array<float,2>{0.0821104497f, 0.352337629f},
-std::array<float,2>{0.324607015f, 0.512828112f},
-std::array<float,2>{0.754783094f, 0.295389861f},
-std::array<float,2>{0.525641799f, 0.925314069f},
-std::array<float,2>{0.139938638f, 0.0983625948f},
-std::array<float,2>{0.0359670073f, 0.874483466f},
-std::array<float,2>{0.661502957f, 0.149780661f},
-std::array<float,2>{0.976053774f, 0.648797929f},
-std::array<float,2>{0.444484413f, 0.440815032f},
-std::array<float,2>{0.101999842f, 0.62494868f},
-std::array<float,2>{0.742624164f, 0.326112181f},
-std::array<float,2>{0.93224597f, 0.943661928f},
-std::array<float,2>{0.417728812f, 0.0471936911f},
-std::array<float,2>{0.251118213f, 0.78376615f},
-std::array<float,2>{0.814231098f, 0.213106513f},
-std::array<float,2>{0.600724757f, 0.697981f},
-std::array<float,2>{0.196114048f, 0.395440519f},
-std::array<float,2>{0.479537666f, 0.664022267f},
-std::array<float,2>{0.959709227f, 0.494819701f},
-std::array<float,2>{0.645520806f, 0.838228643f},
-std::array<float,2>{0.00254932488f, 0.171846166f},
-std::array<float,2>{0.187189758f, 0.900111616f},
-std::array<float,2>{0.548874795f, 0.067584224f},
-std::array<float,2>{0.793020308f, 0.560323775f},
-std::array<float,2>{0.354633987f, 0.27264744f},
-std::array<float,2>{0.245462924f, 0.504933536f},
-std::array<float,2>{0.571109712f, 0.287033617f},
-std::array<float,2>{0.862718642f, 0.930709362f},
-std::array<float,2>{0.298044384f, 0.10381984f},
-std::array<float,2>{0.395165265f, 0.860434592f},
-std::array<float,2>{0.903271079f, 0.145314738f},
-std::array<float,2>{0.688267946f, 0.643886685f},
-std::array<float,2>{0.0659075454f, 0.446685106f},
-std::array<float,2>{0.338326722f, 0.731405258f},
-std::array<float,2>{0.775283992f, 0.422378749f},
-std::array<float,2>{0.513421595f, 0.758584976f},
-std::array<float,2>{0.152404457f, 0.242697403f},
-std::array<float,2>{0.0605884418f, 0.983553112f},
-std::array<float,2>{0.673907697f, 0.0266254917f},
-std::array<float,2>{0.997152627f, 0.583095849f},
-std::array<float,2>{0.459467888f, 0.346127689f},
-std::array<float,2>{0.112480342f, 0.669600606f},
-std::array<float,2>{0.729715407f, 0.48625809f},
-std::array<float,2>{0.914610088f, 0.831787407f},
-std::array<float,2>{0.423812091f, 0.161326289f},
-std::array<float,2>{0.273875356f, 0.897573054f},
-std::array<float,2>{0.831287622f, 0.0730911642f},
-std::array<float,2>{0.61311245f, 0.549199045f},
-std::array<float,2>{0.216769189f, 0.276645482f},
-std::array<float,2>{0.493441045f, 0.610520542f},
-std::array<float,2>{0.940282583f, 0.318635255f},
-std::array<float,2>{0.635377884f, 0.950533986f},
-std::array<float,2>{0.016290376f, 0.0590218604f},
-std::array<float,2>{0.170263037f, 0.795288742f},
-std::array<float,2>{0.545218468f, 0.20967856f},
-std::array<float,2>{0.800561607f, 0.69293052f},
-std::array<float,2>{0.372811973f, 0.40410158f},
-std::array<float,2>{0.134040266f, 0.718128502f},
-std::array<float,2>{0.531233549f, 0.385811716f},
-std::array<float,2>{0.751387835f, 0.804498911f},
-std::array<float,2>{0.323939353f, 0.191187292f},
-std::array<float,2>{0.438882679f, 0.960147917f},
-std::array<float,2>{0.970861912f, 0.0326655246f},
-std::array<float,2>{0.657386541f, 0.60744226f},
-std::array<float,2>{0.031911049f, 0.331436038f},
-std::array<float,2>{0.283907562f, 0.539577723f},
-std::array<float,2>{0.846441984f, 0.256994158f},
-std::array<float,2>{0.587972641f, 0.888219655f},
-std::array<float,2>{0.220920146f, 0.0887478217f},
-std::array<float,2>{0.0815268382f, 0.821971595f},
-std::array<float,2>{0.708437383f, 0.176428929f},
-std::array<float,2>{0.885317504f, 0.681429625f},
-std::array<float,2>{0.379882693f, 0.479901165f},
-std::array<float,2>{0.00464955205f, 0.571872056f},
-std::array<float,2>{0.643176317f, 0.373814702f},
-std::array<float,2>{0.955759406f, 0.989701331f},
-std::array<float,2>{0.481274277f, 0.00438417727f},
-std::array<float,2>{0.358927161f, 0.778702855f},
-std::array<float,2>{0.79198736f, 0.225965634f},
-std::array<float,2>{0.551654398f, 0.741694391f},
-std::array<float,2>{0.179979816f, 0.420842826f},
-std::array<float,2>{0.418290943f, 0.634188771f},
-std::array<float,2>{0.936166048f, 0.457433194f},
-std::array<float,2>{0.749626577f, 0.855491638f},
-std::array<float,2>{0.108441368f, 0.13863188f},
-std::array<float,2>{0.202694207f, 0.920169473f},
-std::array<float,2>{0.596687436f, 0.121991359f},
-std::array<float,2>{0.818630338f, 0.515946865f},
-std::array<float,2>{0.254743159f, 0.311453223f},
-std::array<float,2>{0.178376392f, 0.599864006f},
-std::array<float,2>{0.557615042f, 0.340236455f},
-std::array<float,2>{0.787254155f, 0.967858791f},
-std::array<float,2>{0.345012307f, 0.0428832658f},
-std::array<float,2>{0.474649966f, 0.807160079f},
-std::array<float,2>{0.963516951f, 0.196872085f},
-std::array<float,2>{0.651157558f, 0.708630204f},
-std::array<float,2>{0.00787095632f, 0.377504587f},
-std::array<float,2>{0.261805564f, 0.677599311f},
-std::array<float,2>{0.827552557f, 0.474824995f},
-std::array<float,2>{0.603036582f, 0.81362617f},
-std::array<float,2>{0.190093756f, 0.181168929f},
-std::array<float,2>{0.0992125794f, 0.875233412f},
-std::array<float,2>{0.737984657f, 0.0830737799f},
-std::array<float,2>{0.927690208f, 0.53537488f},
-std::array<float,2>{0.407586306f, 0.261485815f},
-std::array<float,2>{0.0433878303f, 0.748216867f},
-std::array<float,2>{0.670204699f, 0.407871336f},
-std::array<float,2>{0.982647598f, 0.767007828f},
-std::array<float,2>{0.448122323f, 0.228466675f},
-std::array<float,2>{0.319996655f, 0.999248207f},
-std::array<float,2>{0.765381277f, 0.0150655936f},
-std::array<float,2>{0.518511534f, 0.568440795f},
-std::array<float,2>{0.129461244f, 0.365093261f},
-std::array<float,2>{0.390409887f, 0.526613355f},
-std::array<float,2>{0.879172921f, 0.297772437f},
-std::array<float,2>{0.71454221f, 0.91122514f},
-std::array<float,2>{0.0862867981f, 0.112507798f},
-std::array<float,2>{0.231442258f, 0.846924961f},
-std::array<float,2>{0.585051239f, 0.131507978f},
-std::array<float,2>{0.858453512f, 0.628001392f},
-std::array<float,2>{0.296102762f, 0.463819951f},
-std::array<float,2>{0.209301099f, 0.654832482f},
-std::array<float,2>{0.623195767f, 0.444605947f},
-std::array<float,2>{0.838312924f, 0.867233813f},
-std::array<float,2>{0.266337514f, 0.154897824f},
-std::array<float,2>{0.434273332f, 0.92668736f},
-std::array<float,2>{0.906556368f, 0.0950256735f},
-std::array<float,2>{0.720688701f, 0.508911312f},
-std::array<float,2>{0.119999424f, 0.292232394f},
-std::array<float,2>{0.360222965f, 0.591789365f},
-std::array<float,2>{0.807791293f, 0.357998729f},
-std::array<float,2>{0.532101989f, 0.972329319f},
-std::array<float,2>{0.160374522f, 0.0168018341f},
-std::array<float,2>{0.0290105883f, 0.753771007f},
-std::array<float,2>{0.629459977f, 0.235516399f},
-std::array<float,2>{0.950284541f, 0.719495416f},
-std::array<float,2>{0.488797694f, 0.436159909f},
-std::array<float,2>{0.0742294714f, 0.555319607f},
-std::array<float,2>{0.701047122f, 0.268206477f},
-std::array<float,2>{0.896353424f, 0.905700684f},
-std::array<float,2>{0.40427053f, 0.0627462864f},
-std::array<float,2>{0.307423472f, 0.840409338f},
-std::array<float,2>{0.873659253f, 0.167907462f},
-std::array<float,2>{0.564170897f, 0.65686965f},
-std::array<float,2>{0.240776509f, 0.498300314f},
-std::array<float,2>{0.466866881f, 0.70265764f},
-std::array<float,2>{0.985238433f, 0.390910178f},
-std::array<float,2>{0.680413544f, 0.788486958f},
-std::array<float,2>{0.0533881672f, 0.217117026f},
-std::array<float,2>{0.146247208f, 0.938847721f},
-std::array<float,2>{0.504814386f, 0.0521305352f},
-std::array<float,2>{0.768322051f, 0.617986977f},
-std::array<float,2>{0.33128041f, 0.321101665f},
-std::array<float,2>{0.226726413f, 0.616954029f},
-std::array<float,2>{0.579943419f, 0.31544134f},
-std::array<float,2>{0.85158968f, 0.946925163f},
-std::array<float,2>{0.291532248f, 0.0548305921f},
-std::array<float,2>{0.383386552f, 0.789265156f},
-std::array<float,2>{0.877575517f, 0.206047237f},
-std::array<float,2>{0.717669427f, 0.68999809f},
-std::array<float,2>{0.0918193981f, 0.398963571f},
-std::array<float,2>{0.313136309f, 0.667449892f},
-std::array<float,2>{0.758360565f, 0.488574833f},
-std::array<float,2>{0.521836519f, 0.833250105f},
-std::array<float,2>{0.128816918f, 0.158392981f},
-std::array<float,2>{0.0403473303f, 0.892811954f},
-std::array<float,2>{0.667541385f, 0.0756449923f},
-std::array<float,2>{0.978865623f, 0.55140233f},
-std::array<float,2>{0.451254904f, 0.279794365f},
-std::array<float,2>{0.0974668562f, 0.726942062f},
-std::array<float,2>{0.738574088f, 0.429095864f},
-std::array<float,2>{0.925406337f, 0.765378714f},
-std::array<float,2>{0.41114974f, 0.248818889f},
-std::array<float,2>{0.260798573f, 0.979319036f},
-std::array<float,2>{0.823134005f, 0.0308665484f},
-std::array<float,2>{0.605914235f, 0.580624402f},
-std::array<float,2>{0.191748261f, 0.350668907f},
-std::array<float,2>{0.469946772f, 0.501783907f},
-std::array<float,2>{0.964917362f, 0.28490299f},
-std::array<float,2>{0.655612767f, 0.936970115f},
-std::array<float,2>{0.0130788358f, 0.108695388f},
-std::array<float,2>{0.173697665f, 0.86535728f},
-std::array<float,2>{0.561767459f, 0.142905906f},
-std::array<float,2>{0.783692837f, 0.645594716f},
-std::array<float,2>{0.347817451f, 0.450661987f},
-std::array<float,2>{0.140870154f, 0.637722254f},
-std::array<float,2>{0.503737926f, 0.456439793f},
-std::array<float,2>{0.77090019f, 0.853482664f},
-std::array<float,2>{0.334662437f, 0.136258259f},
-std::array<float,2>{0.462713033f, 0.91653192f},
-std::array<float,2>{0.991448581f, 0.119828373f},
-std::array<float,2>{0.685994625f, 0.522140503f},
-std::array<float,2>{0.0499318987f, 0.306372017f},
-std::array<float,2>{0.310882866f, 0.575616896f},
-std::array<float,2>{0.870889604f, 0.368407011f},
-std::array<float,2>{0.568448782f, 0.98448658f},
-std::array<float,2>{0.235599175f, 0.00215225597f},
-std::array<float,2>{0.0728682429f, 0.774729729f},
-std::array<float,2>{0.698518217f, 0.220784366f},
-std::array<float,2>{0.89170891f, 0.735821426f},
-std::array<float,2>{0.399007887f, 0.414724797f},
-std::array<float,2>{0.0270148721f, 0.546033859f},
-std::array<float,2>{0.628249168f, 0.250489771f},
-std::array<float,2>{0.94663924f, 0.884515524f},
-std::array<float,2>{0.486842036f, 0.0906857923f},
-std::array<float,2>{0.366347641f, 0.826650381f},
-std::array<float,2>{0.810819447f, 0.174298793f},
-std::array<float,2>{0.538762808f, 0.684714079f},
-std::array<float,2>{0.157094896f, 0.483147532f},
-std::array<float,2>{0.433356702f, 0.71213913f},
-std::array<float,2>{0.910167992f, 0.388883263f},
-std::array<float,2>{0.723347723f, 0.798716187f},
-std::array<float,2>{0.121604867f, 0.193101764f},
-std::array<float,2>{0.206836253f, 0.953821003f},
-std::array<float,2>{0.617330194f, 0.0366517715f},
-std::array<float,2>{0.842049718f, 0.604990542f},
-std::array<float,2>{0.269973487f, 0.332149506f},
-std::array<float,2>{0.165709645f, 0.530107856f},
-std::array<float,2>{0.541617453f, 0.302306384f},
-std::array<float,2>{0.804025292f, 0.906333566f},
-std::array<float,2>{0.368350774f, 0.11625462f},
-std::array<float,2>{0.499256641f, 0.848042428f},
-std::array<float,2>{0.941996276f, 0.126619533f},
-std::array<float,2>{0.638458848f, 0.631227076f},
-std::array<float,2>{0.0233360212f, 0.466475755f},
-std::array<float,2>{0.278520644f, 0.74464345f},
-std::array<float,2>{0.833806276f, 0.411331326f},
-std::array<float,2>{0.614611745f, 0.770062327f},
-std::array<float,2>{0.214607254f, 0.233270451f},
-std::array<float,2>{0.116737403f, 0.995429635f},
-std::array<float,2>{0.733707249f, 0.0115635674f},
-std::array<float,2>{0.918396711f, 0.562658131f},
-std::array<float,2>{0.427316755f, 0.360836446f},
-std::array<float,2>{0.0573373735f, 0.672055542f},
-std::array<float,2>{0.676981151f, 0.472493142f},
-std::array<float,2>{0.994213223f, 0.820149958f},
-std::array<float,2>{0.454047382f, 0.185481742f},
-std::array<float,2>{0.341289759f, 0.881031334f},
-std::array<float,2>{0.780108154f, 0.0814937949f},
-std::array<float,2>{0.510212123f, 0.533490121f},
-std::array<float,2>{0.152115837f, 0.262414902f},
-std::array<float,2>{0.394098431f, 0.59746474f},
-std::array<float,2>{0.900948703f, 0.336801827f},
-std::array<float,2>{0.695304334f, 0.961966276f},
-std::array<float,2>{0.069780305f, 0.0448724739f},
-std::array<float,2>{0.249768704f, 0.811799705f},
-std::array<float,2>{0.574455619f, 0.199969903f},
-std::array<float,2>{0.865276873f, 0.703696012f},
-std::array<float,2>{0.302701533f, 0.381787241f},
-std::array<float,2>{0.197292596f, 0.695441186f},
-std::array<float,2>{0.59860158f, 0.397454172f},
-std::array<float,2>{0.815334976f, 0.782656133f},
-std::array<float,2>{0.253165931f, 0.212593824f},
-std::array<float,2>{0.415716439f, 0.943212271f},
-std::array<float,2>{0.930907309f, 0.0507351756f},
-std::array<float,2>{0.745837569f, 0.621170998f},
-std::array<float,2>{0.105365992f, 0.327383488f},
-std::array<float,2>{0.353268594f, 0.562104344f},
-std::array<float,2>{0.79605031f, 0.269772232f},
-std::array<float,2>{0.548111439f, 0.901851833f},
-std::array<float,2>{0.183707207f, 0.0697613657f},
-std::array<float,2>{0.00114204036f, 0.836478949f},
-std::array<float,2>{0.64751792f, 0.168986827f},
-std::array<float,2>{0.958598018f, 0.660731196f},
-std::array<float,2>{0.476707995f, 0.492318988f},
-std::array<float,2>{0.0856153443f, 0.588474035f},
-std::array<float,2>{0.704562724f, 0.354072213f},
-std::array<float,2>{0.88672179f, 0.97548461f},
-std::array<float,2>{0.377394348f, 0.0219995715f},
-std::array<float,2>{0.288974881f, 0.75541538f},
-std::array<float,2>{0.850246191f, 0.23960273f},
-std::array<float,2>{0.59174031f, 0.723961055f},
-std::array<float,2>{0.226445317f, 0.430276632f},
-std::array<float,2>{0.441656351f, 0.650887072f},
-std::array<float,2>{0.97403264f, 0.438195735f},
-std::array<float,2>{0.663937211f, 0.872951031f},
-std::array<float,2>{0.0388640948f, 0.150690556f},
-std::array<float,2>{0.137265578f, 0.922047377f},
-std::array<float,2>{0.525373101f, 0.100842118f},
-std::array<float,2>{0.757203937f, 0.514942765f},
-std::array<float,2>{0.326784223f, 0.294145584f},
-std::array<float,2>{0.217169315f, 0.547377586f},
-std::array<float,2>{0.610325754f, 0.2743451f},
-std::array<float,2>{0.829891026f, 0.894651771f},
-std::array<float,2>{0.275614649f, 0.0708490834f},
-std::array<float,2>{0.425135821f, 0.829833746f},
-std::array<float,2>{0.917675495f, 0.162215218f},
-std::array<float,2>{0.728289008f, 0.671804845f},
-std::array<float,2>{0.110490896f, 0.48787576f},
-std::array<float,2>{0.374675035f, 0.694525659f},
-std::array<float,2>{0.798240304f, 0.405123562f},
-std::array<float,2>{0.543293834f, 0.793804228f},
-std::array<float,2>{0.168074906f, 0.207267523f},
-std::array<float,2>{0.0194901638f, 0.952609479f},
-std::array<float,2>{0.633752704f, 0.0619782843f},
-std::array<float,2>{0.93888694f, 0.612987936f},
-std::array<float,2>{0.495673776f, 0.317276061f},
-std::array<float,2>{0.0632343143f, 0.642065883f},
-std::array<float,2>{0.69044584f, 0.448200732f},
-std::array<float,2>{0.905771255f, 0.862140477f},
-std::array<float,2>{0.398372173f, 0.147567302f},
-std::array<float,2>{0.299377233f, 0.933064878f},
-std::array<float,2>{0.860708475f, 0.102393895f},
-std::array<float,2>{0.57266438f, 0.507100701f},
-std::array<float,2>{0.242944434f, 0.287468076f},
-std::array<float,2>{0.457658231f, 0.585500777f},
-std::array<float,2>{0.99954325f, 0.344224989f},
-std::array<float,2>{0.673266888f, 0.98081094f},
-std::array<float,2>{0.0589583665f, 0.0241500214f},
-std::array<float,2>{0.155833244f, 0.761501431f},
-std::array<float,2>{0.515277803f, 0.246061057f},
-std::array<float,2>{0.77609694f, 0.732702672f},
-std::array<float,2>{0.337827981f, 0.42521131f},
-std::array<float,2>{0.182348877f, 0.739229083f},
-std::array<float,2>{0.554402292f, 0.41977939f},
-std::array<float,2>{0.789820015f, 0.780744851f},
-std::array<float,2>{0.355847746f, 0.223184064f},
-std::array<float,2>{0.483248562f, 0.991213143f},
-std::array<float,2>{0.953761816f, 0.00599838421f},
-std::array<float,2>{0.641044855f, 0.572464585f},
-std::array<float,2>{0.00634256285f, 0.371645182f},
-std::array<float,2>{0.255932897f, 0.519051611f},
-std::array<float,2>{0.817890823f, 0.310367912f},
-std::array<float,2>{0.595590115f, 0.918067873f},
-std::array<float,2>{0.199893832f, 0.124207839f},
-std::array<float,2>{0.105524778f, 0.859234154f},
-std::array<float,2>{0.746123254f, 0.140596434f},
-std::array<float,2>{0.933694124f, 0.635720968f},
-std::array<float,2>{0.420481086f, 0.459726483f},
-std::array<float,2>{0.0343165845f, 0.606215954f},
-std::array<float,2>{0.658997357f, 0.328824937f},
-std::array<float,2>{0.968816221f, 0.958276272f},
-std::array<float,2>{0.441018671f, 0.0334073678f},
-std::array<float,2>{0.321974218f, 0.801249206f},
-std::array<float,2>{0.752559841f, 0.188302502f},
-std::array<float,2>{0.527857602f, 0.715709925f},
-std::array<float,2>{0.136124313f, 0.383230895f},
-std::array<float,2>{0.38168931f, 0.683150351f},
-std::array<float,2>{0.884752929f, 0.477415472f},
-std::array<float,2>{0.709282458f, 0.822572947f},
-std::array<float,2>{0.0800305158f, 0.178287193f},
-std::array<float,2>{0.22035329f, 0.890259743f},
-std::array<float,2>{0.586333334f, 0.0878437981f},
-std::array<float,2>{0.84464246f, 0.541325331f},
-std::array<float,2>{0.283124804f, 0.254949272f},
-std::array<float,2>{0.13127856f, 0.568275809f},
-std::array<float,2>{0.515976548f, 0.365438133f},
-std::array<float,2>{0.762035549f, 0.997941434f},
-std::array<float,2>{0.317084193f, 0.0126474528f},
-std::array<float,2>{0.446355164f, 0.768205047f},
-std::array<float,2>{0.981002986f, 0.230117083f},
-std::array<float,2>{0.668085515f, 0.746838748f},
-std::array<float,2>{0.0464095585f, 0.409871519f},
-std::array<float,2>{0.293667167f, 0.626002908f},
-std::array<float,2>{0.856727242f, 0.46277526f},
-std::array<float,2>{0.582887471f, 0.844860435f},
-std::array<float,2>{0.233312249f, 0.129870027f},
-std::array<float,2>{0.0898251012f, 0.913959622f},
-std::array<float,2>{0.711427927f, 0.110170297f},
-std::array<float,2>{0.881232798f, 0.524975896f},
-std::array<float,2>{0.387695611f, 0.2997832f},
-std::array<float,2>{0.0107552269f, 0.709525943f},
-std::array<float,2>{0.649422646f, 0.376094431f},
-std::array<float,2>{0.961668611f, 0.805710018f},
-std::array<float,2>{0.474055707f, 0.198027074f},
-std::array<float,2>{0.346313149f, 0.966070473f},
-std::array<float,2>{0.785982072f, 0.039211411f},
-std::array<float,2>{0.555214882f, 0.59958303f},
-std::array<float,2>{0.177264601f, 0.343034923f},
-std::array<float,2>{0.408620328f, 0.537778318f},
-std::array<float,2>{0.929578841f, 0.259566009f},
-std::array<float,2>{0.735216498f, 0.877848864f},
-std::array<float,2>{0.0998287648f, 0.0857832879f},
-std::array<float,2>{0.18883872f, 0.815395653f},
-std::array<float,2>{0.603851736f, 0.18290399f},
-std::array<float,2>{0.826118469f, 0.679354489f},
-std::array<float,2>{0.264361471f, 0.472886741f},
-std::array<float,2>{0.238908857f, 0.659724951f},
-std::array<float,2>{0.566273332f, 0.497092605f},
-std::array<float,2>{0.872203112f, 0.843130589f},
-std::array<float,2>{0.305183023f, 0.165397003f},
-std::array<float,2>{0.404518425f, 0.903835595f},
-std::array<float,2>{0.896619916f, 0.0661506131f},
-std::array<float,2>{0.701239288f, 0.557761431f},
-std::array<float,2>{0.0773531795f, 0.267215997f},
-std::array<float,2>{0.329686224f, 0.619716346f},
-std::array<float,2>{0.76709789f, 0.324106872f},
-std::array<float,2>{0.507654607f, 0.940829456f},
-std::array<float,2>{0.147306144f, 0.0529254489f},
-std::array<float,2>{0.0524728708f, 0.786845565f},
-std::array<float,2>{0.68314749f, 0.214955822f},
-std::array<float,2>{0.987812579f, 0.699356019f},
-std::array<float,2>{0.465059251f, 0.392957002f},
-std::array<float,2>{0.118133269f, 0.511288583f},
-std::array<float,2>{0.720845938f, 0.290583938f},
-std::array<float,2>{0.908344924f, 0.927939653f},
-std::array<float,2>{0.436986089f, 0.0974296704f},
-std::array<float,2>{0.267648935f, 0.870170951f},
-std::array<float,2>{0.835992157f, 0.152526051f},
-std::array<float,2>{0.622461557f, 0.654023767f},
-std::array<float,2>{0.207067326f, 0.442717403f},
-std::array<float,2>{0.491381258f, 0.721295238f},
-std::array<float,2>{0.953008831f, 0.435533822f},
-std::array<float,2>{0.632487535f, 0.750791609f},
-std::array<float,2>{0.0297520421f, 0.237430334f},
-std::array<float,2>{0.163030297f, 0.970012546f},
-std::array<float,2>{0.533653259f, 0.0191710424f},
-std::array<float,2>{0.805869162f, 0.59305501f},
-std::array<float,2>{0.36286661f, 0.356687546f}}
\ No newline at end of file
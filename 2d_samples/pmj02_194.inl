@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.130039871f, 0.147102818f},
-std::array<float,2>{0.748642325f, 0.58892101f},
-std::array<float,2>{0.914647222f, 0.345271766f},
-std::array<float,2>{0.463098168f, 0.780294538f},
-std::array<float,2>{0.372711241f, 0.403162092f},
-std::array<float,2>{0.842638552f, 0.97578758f},
-std::array<float,2>{0.522280514f, 0.0560193695f},
-std::array<float,2>{0.117143191f, 0.68725574f},
-std::array<float,2>{0.00888101663f, 0.26956591f},
-std::array<float,2>{0.581446111f, 0.821457505f},
-std::array<float,2>{0.810091257f, 0.193458602f},
-std::array<float,2>{0.310793966f, 0.517189145f},
-std::array<float,2>{0.404889166f, 0.0665945113f},
-std::array<float,2>{0.968195617f, 0.709436178f},
-std::array<float,2>{0.63232249f, 0.484342426f},
-std::array<float,2>{0.196938798f, 0.925752819f},
-std::array<float,2>{0.0757147074f, 0.0161027964f},
-std::array<float,2>{0.557770014f, 0.650032163f},
-std::array<float,2>{0.867425919f, 0.411191344f},
-std::array<float,2>{0.327572018f, 0.945297599f},
-std::array<float,2>{0.48252514f, 0.3235856f},
-std::array<float,2>{0.87594837f, 0.789100051f},
-std::array<float,2>{0.696300507f, 0.184676453f},
-std::array<float,2>{0.182820648f, 0.616345644f},
-std::array<float,2>{0.221640527f, 0.446751088f},
-std::array<float,2>{0.670577049f, 0.889469683f},
-std::array<float,2>{0.987933159f, 0.116384327f},
-std::array<float,2>{0.40664041f, 0.722288489f},
-std::array<float,2>{0.277459651f, 0.219092965f},
-std::array<float,2>{0.758115292f, 0.540337861f},
-std::array<float,2>{0.614261508f, 0.295436472f},
-std::array<float,2>{0.0552467592f, 0.867193699f},
-std::array<float,2>{0.218419448f, 0.102473997f},
-std::array<float,2>{0.64369756f, 0.739511728f},
-std::array<float,2>{0.942801535f, 0.454323411f},
-std::array<float,2>{0.382977366f, 0.895714521f},
-std::array<float,2>{0.285997689f, 0.297390699f},
-std::array<float,2>{0.792637467f, 0.857653797f},
-std::array<float,2>{0.567770004f, 0.244310036f},
-std::array<float,2>{0.0174185336f, 0.549425125f},
-std::array<float,2>{0.0989990532f, 0.425829113f},
-std::array<float,2>{0.50317806f, 0.966580927f},
-std::array<float,2>{0.81866312f, 0.00537165534f},
-std::array<float,2>{0.345188975f, 0.630932093f},
-std::array<float,2>{0.443877399f, 0.167877212f},
-std::array<float,2>{0.934293091f, 0.595435619f},
-std::array<float,2>{0.726552486f, 0.329434335f},
-std::array<float,2>{0.141587183f, 0.797737837f},
-std::array<float,2>{0.0401672125f, 0.210901037f},
-std::array<float,2>{0.596297204f, 0.512610853f},
-std::array<float,2>{0.771179199f, 0.250814974f},
-std::array<float,2>{0.250180781f, 0.840281844f},
-std::array<float,2>{0.43375954f, 0.495161474f},
-std::array<float,2>{0.978243113f, 0.912792981f},
-std::array<float,2>{0.676624417f, 0.0891236812f},
-std::array<float,2>{0.244025156f, 0.687505305f},
-std::array<float,2>{0.170871302f, 0.363474727f},
-std::array<float,2>{0.715680957f, 0.758984029f},
-std::array<float,2>{0.891052842f, 0.135153726f},
-std::array<float,2>{0.496564716f, 0.56852901f},
-std::array<float,2>{0.334408253f, 0.0400731489f},
-std::array<float,2>{0.853354096f, 0.670973659f},
-std::array<float,2>{0.540352702f, 0.38284868f},
-std::array<float,2>{0.082201153f, 0.988554239f},
-std::array<float,2>{0.240321696f, 0.235259056f},
-std::array<float,2>{0.68405807f, 0.559460223f},
-std::array<float,2>{0.974758029f, 0.312144667f},
-std::array<float,2>{0.425422579f, 0.85047704f},
-std::array<float,2>{0.259624392f, 0.461367905f},
-std::array<float,2>{0.775847435f, 0.898471177f},
-std::array<float,2>{0.602017224f, 0.0995108932f},
-std::array<float,2>{0.0360777453f, 0.743441224f},
-std::array<float,2>{0.0876592249f, 0.336980939f},
-std::array<float,2>{0.534819126f, 0.804818392f},
-std::array<float,2>{0.845671535f, 0.159669563f},
-std::array<float,2>{0.343535751f, 0.603614807f},
-std::array<float,2>{0.486249089f, 0.00790229719f},
-std::array<float,2>{0.900817513f, 0.638983071f},
-std::array<float,2>{0.703597963f, 0.431931913f},
-std::array<float,2>{0.161628336f, 0.95865798f},
-std::array<float,2>{0.029621169f, 0.0824023411f},
-std::array<float,2>{0.576546252f, 0.702779651f},
-std::array<float,2>{0.78193748f, 0.485605419f},
-std::array<float,2>{0.295352668f, 0.918680668f},
-std::array<float,2>{0.38015309f, 0.261071891f},
-std::array<float,2>{0.950543702f, 0.833965123f},
-std::array<float,2>{0.654698968f, 0.21201463f},
-std::array<float,2>{0.204637513f, 0.507322311f},
-std::array<float,2>{0.153316811f, 0.378133297f},
-std::array<float,2>{0.729945898f, 0.999492347f},
-std::array<float,2>{0.921924412f, 0.0346313901f},
-std::array<float,2>{0.446924895f, 0.65628159f},
-std::array<float,2>{0.356784642f, 0.127178878f},
-std::array<float,2>{0.825405359f, 0.571592808f},
-std::array<float,2>{0.507985055f, 0.372937113f},
-std::array<float,2>{0.105053142f, 0.75542599f},
-std::array<float,2>{0.177526504f, 0.05040114f},
-std::array<float,2>{0.69356674f, 0.672409534f},
-std::array<float,2>{0.884531617f, 0.392689437f},
-std::array<float,2>{0.475773841f, 0.980696082f},
-std::array<float,2>{0.31313622f, 0.355685472f},
-std::array<float,2>{0.86134696f, 0.766133785f},
-std::array<float,2>{0.552409291f, 0.150214061f},
-std::array<float,2>{0.0664638802f, 0.581847072f},
-std::array<float,2>{0.0498043932f, 0.473105431f},
-std::array<float,2>{0.619341671f, 0.93666178f},
-std::array<float,2>{0.755644917f, 0.0718269497f},
-std::array<float,2>{0.273379952f, 0.714026392f},
-std::array<float,2>{0.417374641f, 0.198691919f},
-std::array<float,2>{0.996612787f, 0.52805841f},
-std::array<float,2>{0.6594221f, 0.280340582f},
-std::array<float,2>{0.233971134f, 0.813759267f},
-std::array<float,2>{0.122023858f, 0.178506896f},
-std::array<float,2>{0.525165617f, 0.617972612f},
-std::array<float,2>{0.832209945f, 0.316470891f},
-std::array<float,2>{0.362361759f, 0.781836808f},
-std::array<float,2>{0.453743994f, 0.418096334f},
-std::array<float,2>{0.908563375f, 0.947553575f},
-std::array<float,2>{0.737511039f, 0.0274445005f},
-std::array<float,2>{0.134794697f, 0.642710567f},
-std::array<float,2>{0.193103611f, 0.281634688f},
-std::array<float,2>{0.639681935f, 0.863913f},
-std::array<float,2>{0.958332002f, 0.23171109f},
-std::array<float,2>{0.39240247f, 0.534779072f},
-std::array<float,2>{0.303898513f, 0.124890797f},
-std::array<float,2>{0.80423516f, 0.734109461f},
-std::array<float,2>{0.58731246f, 0.441810876f},
-std::array<float,2>{0.00600939058f, 0.87747395f},
-std::array<float,2>{0.199275896f, 0.162491471f},
-std::array<float,2>{0.627591252f, 0.608689666f},
-std::array<float,2>{0.96364361f, 0.341824651f},
-std::array<float,2>{0.399123162f, 0.810298502f},
-std::array<float,2>{0.306224555f, 0.436639637f},
-std::array<float,2>{0.808495998f, 0.955706239f},
-std::array<float,2>{0.584310412f, 0.0121462708f},
-std::array<float,2>{0.0125770736f, 0.633951068f},
-std::array<float,2>{0.110827483f, 0.306897312f},
-std::array<float,2>{0.517745912f, 0.843846083f},
-std::array<float,2>{0.836967885f, 0.241892591f},
-std::array<float,2>{0.367218107f, 0.557740629f},
-std::array<float,2>{0.465277702f, 0.0951306969f},
-std::array<float,2>{0.921111703f, 0.746265531f},
-std::array<float,2>{0.744977832f, 0.468735397f},
-std::array<float,2>{0.126622126f, 0.905238748f},
-std::array<float,2>{0.0600181147f, 0.0368223488f},
-std::array<float,2>{0.609519124f, 0.661270022f},
-std::array<float,2>{0.765264988f, 0.380829722f},
-std::array<float,2>{0.275333822f, 0.993590474f},
-std::array<float,2>{0.412907243f, 0.369004577f},
-std::array<float,2>{0.990486741f, 0.75247556f},
-std::array<float,2>{0.666611791f, 0.131156176f},
-std::array<float,2>{0.223179564f, 0.575289071f},
-std::array<float,2>{0.186656043f, 0.490892857f},
-std::array<float,2>{0.702522695f, 0.917236984f},
-std::array<float,2>{0.882457376f, 0.081674926f},
-std::array<float,2>{0.477019936f, 0.697079241f},
-std::array<float,2>{0.32100451f, 0.217030391f},
-std::array<float,2>{0.873271585f, 0.501400471f},
-std::array<float,2>{0.561500072f, 0.263571531f},
-std::array<float,2>{0.0705923438f, 0.830750525f},
-std::array<float,2>{0.144854814f, 0.0745387524f},
-std::array<float,2>{0.720066309f, 0.717868924f},
-std::array<float,2>{0.932798147f, 0.471875668f},
-std::array<float,2>{0.437920362f, 0.9314574f},
-std::array<float,2>{0.350395709f, 0.273622572f},
-std::array<float,2>{0.813818514f, 0.816681564f},
-std::array<float,2>{0.505264223f, 0.199960887f},
-std::array<float,2>{0.0951459259f, 0.526573837f},
-std::array<float,2>{0.0197123587f, 0.397918314f},
-std::array<float,2>{0.563708782f, 0.977797449f},
-std::array<float,2>{0.794968247f, 0.0510433912f},
-std::array<float,2>{0.283848822f, 0.678197503f},
-std::array<float,2>{0.389598042f, 0.155781746f},
-std::array<float,2>{0.939091146f, 0.584384501f},
-std::array<float,2>{0.646726727f, 0.353497446f},
-std::array<float,2>{0.211985841f, 0.771387935f},
-std::array<float,2>{0.0819134191f, 0.226974413f},
-std::array<float,2>{0.543881118f, 0.536613345f},
-std::array<float,2>{0.855784953f, 0.285337567f},
-std::array<float,2>{0.329167992f, 0.860804081f},
-std::array<float,2>{0.494344473f, 0.441255182f},
-std::array<float,2>{0.895537198f, 0.880094647f},
-std::array<float,2>{0.711058497f, 0.12085288f},
-std::array<float,2>{0.164245695f, 0.730291247f},
-std::array<float,2>{0.249672487f, 0.315162033f},
-std::array<float,2>{0.673749268f, 0.787111938f},
-std::array<float,2>{0.982777178f, 0.174632847f},
-std::array<float,2>{0.431328863f, 0.621113241f},
-std::array<float,2>{0.254164159f, 0.0255429633f},
-std::array<float,2>{0.767978787f, 0.648349285f},
-std::array<float,2>{0.600538135f, 0.414531976f},
-std::array<float,2>{0.0434063971f, 0.950491309f},
-std::array<float,2>{0.156501055f, 0.187694043f},
-std::array<float,2>{0.708925784f, 0.52273351f},
-std::array<float,2>{0.902474821f, 0.26664868f},
-std::array<float,2>{0.488667786f, 0.827792048f},
-std::array<float,2>{0.33766979f, 0.480219364f},
-std::array<float,2>{0.850827157f, 0.92852217f},
-std::array<float,2>{0.537316859f, 0.0643587038f},
-std::array<float,2>{0.0915792212f, 0.706016719f},
-std::array<float,2>{0.0315148309f, 0.349419981f},
-std::array<float,2>{0.609087884f, 0.774818242f},
-std::array<float,2>{0.778882265f, 0.143465489f},
-std::array<float,2>{0.262989551f, 0.592444599f},
-std::array<float,2>{0.42666766f, 0.0608782955f},
-std::array<float,2>{0.971550107f, 0.682900012f},
-std::array<float,2>{0.680116534f, 0.401577771f},
-std::array<float,2>{0.23752895f, 0.972087741f},
-std::array<float,2>{0.106405064f, 0.11290855f},
-std::array<float,2>{0.51256907f, 0.722777426f},
-std::array<float,2>{0.823553085f, 0.449670404f},
-std::array<float,2>{0.351898789f, 0.882972002f},
-std::array<float,2>{0.452100843f, 0.290705174f},
-std::array<float,2>{0.927089393f, 0.871554196f},
-std::array<float,2>{0.731299818f, 0.225064352f},
-std::array<float,2>{0.151177734f, 0.544489861f},
-std::array<float,2>{0.208376348f, 0.407134175f},
-std::array<float,2>{0.651781499f, 0.940256238f},
-std::array<float,2>{0.947709024f, 0.0229957588f},
-std::array<float,2>{0.3781057f, 0.653651714f},
-std::array<float,2>{0.292968154f, 0.180537015f},
-std::array<float,2>{0.787544727f, 0.611376822f},
-std::array<float,2>{0.572938085f, 0.327359647f},
-std::array<float,2>{0.0260127317f, 0.795167983f},
-std::array<float,2>{0.229365245f, 0.000699413533f},
-std::array<float,2>{0.661139607f, 0.628317356f},
-std::array<float,2>{0.993802011f, 0.423484385f},
-std::array<float,2>{0.418750226f, 0.964388669f},
-std::array<float,2>{0.266337574f, 0.335120231f},
-std::array<float,2>{0.751609504f, 0.804280043f},
-std::array<float,2>{0.623942137f, 0.170482114f},
-std::array<float,2>{0.0538290143f, 0.600778639f},
-std::array<float,2>{0.0633871555f, 0.460375518f},
-std::array<float,2>{0.54802078f, 0.892679811f},
-std::array<float,2>{0.864710689f, 0.107115619f},
-std::array<float,2>{0.317477703f, 0.735346079f},
-std::array<float,2>{0.471623063f, 0.246364549f},
-std::array<float,2>{0.889967978f, 0.552332401f},
-std::array<float,2>{0.687899053f, 0.303896457f},
-std::array<float,2>{0.172254503f, 0.854757607f},
-std::array<float,2>{0.00367766246f, 0.139810503f},
-std::array<float,2>{0.590029955f, 0.564271808f},
-std::array<float,2>{0.797386467f, 0.362354219f},
-std::array<float,2>{0.29843995f, 0.764366031f},
-std::array<float,2>{0.397686541f, 0.387099355f},
-std::array<float,2>{0.956096649f, 0.985449672f},
-std::array<float,2>{0.633784413f, 0.045974832f},
-std::array<float,2>{0.18808645f, 0.666552246f},
-std::array<float,2>{0.139466703f, 0.25638026f},
-std::array<float,2>{0.73859942f, 0.838671565f},
-std::array<float,2>{0.91381669f, 0.206403777f},
-std::array<float,2>{0.460891515f, 0.508861125f},
-std::array<float,2>{0.364484161f, 0.0937221348f},
-std::array<float,2>{0.831601679f, 0.694582283f},
-std::array<float,2>{0.528177381f, 0.499999583f},
-std::array<float,2>{0.120058902f, 0.908943236f},
-std::array<float,2>{0.181562409f, 0.186865881f},
-std::array<float,2>{0.697314501f, 0.614144444f},
-std::array<float,2>{0.878015876f, 0.321093738f},
-std::array<float,2>{0.48104915f, 0.79108721f},
-std::array<float,2>{0.325538695f, 0.412743777f},
-std::array<float,2>{0.870048821f, 0.943059444f},
-std::array<float,2>{0.554895341f, 0.0182318799f},
-std::array<float,2>{0.0773765892f, 0.651201725f},
-std::array<float,2>{0.0585373975f, 0.293191195f},
-std::array<float,2>{0.615347326f, 0.869631231f},
-std::array<float,2>{0.761149526f, 0.221354276f},
-std::array<float,2>{0.280594021f, 0.542340934f},
-std::array<float,2>{0.408956707f, 0.114129223f},
-std::array<float,2>{0.984556973f, 0.719373882f},
-std::array<float,2>{0.669554412f, 0.449109733f},
-std::array<float,2>{0.220106214f, 0.887878001f},
-std::array<float,2>{0.115234226f, 0.0576545894f},
-std::array<float,2>{0.520302355f, 0.684451699f},
-std::array<float,2>{0.839868307f, 0.405775577f},
-std::array<float,2>{0.373061955f, 0.97267431f},
-std::array<float,2>{0.462827981f, 0.347501874f},
-std::array<float,2>{0.916364431f, 0.777879477f},
-std::array<float,2>{0.746121585f, 0.146011576f},
-std::array<float,2>{0.131761f, 0.586702704f},
-std::array<float,2>{0.199075162f, 0.481113106f},
-std::array<float,2>{0.63055408f, 0.922523677f},
-std::array<float,2>{0.96565181f, 0.0684730113f},
-std::array<float,2>{0.403180569f, 0.708795905f},
-std::array<float,2>{0.310269237f, 0.192847624f},
-std::array<float,2>{0.810904622f, 0.518865287f},
-std::array<float,2>{0.579830289f, 0.272470832f},
-std::array<float,2>{0.0114384787f, 0.823684692f},
-std::array<float,2>{0.245413721f, 0.0863840282f},
-std::array<float,2>{0.678849995f, 0.691151083f},
-std::array<float,2>{0.978770435f, 0.493396014f},
-std::array<float,2>{0.436260402f, 0.910336971f},
-std::array<float,2>{0.252449036f, 0.252218693f},
-std::array<float,2>{0.772218347f, 0.842413306f},
-std::array<float,2>{0.595239699f, 0.207133353f},
-std::array<float,2>{0.0413149409f, 0.51558578f},
-std::array<float,2>{0.0851536691f, 0.386007279f},
-std::array<float,2>{0.542065144f, 0.991370082f},
-std::array<float,2>{0.854778051f, 0.0416314751f},
-std::array<float,2>{0.332435578f, 0.669280529f},
-std::array<float,2>{0.498599529f, 0.134293318f},
-std::array<float,2>{0.894124687f, 0.566688776f},
-std::array<float,2>{0.71701926f, 0.365423739f},
-std::array<float,2>{0.169206187f, 0.761051297f},
-std::array<float,2>{0.0184096042f, 0.243651509f},
-std::array<float,2>{0.568822622f, 0.547371805f},
-std::array<float,2>{0.790506005f, 0.30022338f},
-std::array<float,2>{0.288616687f, 0.855964422f},
-std::array<float,2>{0.385212481f, 0.456917107f},
-std::array<float,2>{0.94409579f, 0.897083819f},
-std::array<float,2>{0.64242655f, 0.104377039f},
-std::array<float,2>{0.215081438f, 0.740357697f},
-std::array<float,2>{0.143786982f, 0.331893742f},
-std::array<float,2>{0.724355221f, 0.800729334f},
-std::array<float,2>{0.936579049f, 0.164731815f},
-std::array<float,2>{0.44193545f, 0.596808612f},
-std::array<float,2>{0.346989602f, 0.00767820282f},
-std::array<float,2>{0.817295194f, 0.629711866f},
-std::array<float,2>{0.501361191f, 0.427795112f},
-std::array<float,2>{0.100973755f, 0.967053294f},
-std::array<float,2>{0.205792099f, 0.214476943f},
-std::array<float,2>{0.653776407f, 0.505606592f},
-std::array<float,2>{0.953081489f, 0.258305252f},
-std::array<float,2>{0.381689936f, 0.83588922f},
-std::array<float,2>{0.294068575f, 0.487375706f},
-std::array<float,2>{0.783222616f, 0.920146883f},
-std::array<float,2>{0.575943291f, 0.0845126435f},
-std::array<float,2>{0.028850086f, 0.700316012f},
-std::array<float,2>{0.101790376f, 0.374706388f},
-std::array<float,2>{0.5104931f, 0.756637335f},
-std::array<float,2>{0.827161074f, 0.126878113f},
-std::array<float,2>{0.358812928f, 0.573642731f},
-std::array<float,2>{0.447636247f, 0.0327456146f},
-std::array<float,2>{0.923986375f, 0.659043252f},
-std::array<float,2>{0.727740943f, 0.376399994f},
-std::array<float,2>{0.155836135f, 0.996615946f},
-std::array<float,2>{0.0386844054f, 0.100289144f},
-std::array<float,2>{0.604077578f, 0.746050775f},
-std::array<float,2>{0.775335491f, 0.464297831f},
-std::array<float,2>{0.260097414f, 0.901968718f},
-std::array<float,2>{0.423092961f, 0.309668064f},
-std::array<float,2>{0.972977757f, 0.847851098f},
-std::array<float,2>{0.686483383f, 0.236926436f},
-std::array<float,2>{0.240156129f, 0.560928047f},
-std::array<float,2>{0.163507089f, 0.42994234f},
-std::array<float,2>{0.705767453f, 0.959994137f},
-std::array<float,2>{0.898454249f, 0.00977646746f},
-std::array<float,2>{0.488191575f, 0.63792336f},
-std::array<float,2>{0.341588974f, 0.157620758f},
-std::array<float,2>{0.846279621f, 0.602908254f},
-std::array<float,2>{0.532970488f, 0.339424044f},
-std::array<float,2>{0.0891543403f, 0.806815505f},
-std::array<float,2>{0.134568661f, 0.0309023391f},
-std::array<float,2>{0.734632015f, 0.641620278f},
-std::array<float,2>{0.90810442f, 0.421131492f},
-std::array<float,2>{0.456117094f, 0.945532143f},
-std::array<float,2>{0.359937727f, 0.319583446f},
-std::array<float,2>{0.83553189f, 0.78506583f},
-std::array<float,2>{0.527150989f, 0.177046314f},
-std::array<float,2>{0.124770097f, 0.619472921f},
-std::array<float,2>{0.00534449611f, 0.443418413f},
-std::array<float,2>{0.58975637f, 0.876198649f},
-std::array<float,2>{0.801280022f, 0.122892633f},
-std::array<float,2>{0.300846964f, 0.730922639f},
-std::array<float,2>{0.393400818f, 0.233603805f},
-std::array<float,2>{0.960778892f, 0.531381071f},
-std::array<float,2>{0.637200415f, 0.284208477f},
-std::array<float,2>{0.193659127f, 0.866305649f},
-std::array<float,2>{0.068400979f, 0.150739402f},
-std::array<float,2>{0.554670572f, 0.578720152f},
-std::array<float,2>{0.861152351f, 0.35842815f},
-std::array<float,2>{0.315521181f, 0.768677235f},
-std::array<float,2>{0.473101854f, 0.391691506f},
-std::array<float,2>{0.885204315f, 0.984193385f},
-std::array<float,2>{0.69313246f, 0.0484266765f},
-std::array<float,2>{0.17917119f, 0.674014449f},
-std::array<float,2>{0.231855705f, 0.27902934f},
-std::array<float,2>{0.657420099f, 0.816252351f},
-std::array<float,2>{0.999529421f, 0.195420504f},
-std::array<float,2>{0.414615691f, 0.529399931f},
-std::array<float,2>{0.269690424f, 0.0737297013f},
-std::array<float,2>{0.757424831f, 0.712013543f},
-std::array<float,2>{0.617610097f, 0.476450086f},
-std::array<float,2>{0.0487936884f, 0.934233129f},
-std::array<float,2>{0.225155219f, 0.129108071f},
-std::array<float,2>{0.665626764f, 0.578047574f},
-std::array<float,2>{0.989135981f, 0.370459437f},
-std::array<float,2>{0.41180861f, 0.750372589f},
-std::array<float,2>{0.277153254f, 0.381025046f},
-std::array<float,2>{0.76295805f, 0.994268775f},
-std::array<float,2>{0.613069415f, 0.0371193103f},
-std::array<float,2>{0.0611572415f, 0.663524091f},
-std::array<float,2>{0.0726545751f, 0.265258461f},
-std::array<float,2>{0.559223294f, 0.829136908f},
-std::array<float,2>{0.872612476f, 0.215674356f},
-std::array<float,2>{0.323972702f, 0.503106713f},
-std::array<float,2>{0.480064809f, 0.0781344846f},
-std::array<float,2>{0.879573047f, 0.69893378f},
-std::array<float,2>{0.699316084f, 0.489705622f},
-std::array<float,2>{0.18529205f, 0.914120972f},
-std::array<float,2>{0.0154451355f, 0.0151688103f},
-std::array<float,2>{0.582689106f, 0.635953367f},
-std::array<float,2>{0.805808008f, 0.434119672f},
-std::array<float,2>{0.307844698f, 0.953915596f},
-std::array<float,2>{0.400997579f, 0.341235995f},
-std::array<float,2>{0.960992217f, 0.811890304f},
-std::array<float,2>{0.625126481f, 0.161939397f},
-std::array<float,2>{0.202039212f, 0.606345773f},
-std::array<float,2>{0.128736109f, 0.466387749f},
-std::array<float,2>{0.743806183f, 0.903326511f},
-std::array<float,2>{0.919698656f, 0.0964135751f},
-std::array<float,2>{0.466899723f, 0.748997211f},
-std::array<float,2>{0.369311631f, 0.239932016f},
-std::array<float,2>{0.839336097f, 0.556420326f},
-std::array<float,2>{0.515911102f, 0.304974824f},
-std::array<float,2>{0.112505324f, 0.845998526f},
-std::array<float,2>{0.16679202f, 0.118143417f},
-std::array<float,2>{0.713317454f, 0.728177071f},
-std::array<float,2>{0.897921741f, 0.437533259f},
-std::array<float,2>{0.492285699f, 0.881366432f},
-std::array<float,2>{0.331301123f, 0.28784734f},
-std::array<float,2>{0.858500421f, 0.861685276f},
-std::array<float,2>{0.545231879f, 0.229815274f},
-std::array<float,2>{0.0784001052f, 0.538034022f},
-std::array<float,2>{0.0452539884f, 0.416651666f},
-std::array<float,2>{0.598956048f, 0.952230096f},
-std::array<float,2>{0.76734376f, 0.0239799861f},
-std::array<float,2>{0.256286711f, 0.646267951f},
-std::array<float,2>{0.432367861f, 0.172483101f},
-std::array<float,2>{0.98080045f, 0.624742925f},
-std::array<float,2>{0.675140321f, 0.313148856f},
-std::array<float,2>{0.246520743f, 0.785513043f},
-std::array<float,2>{0.0957964808f, 0.201895088f},
-std::array<float,2>{0.505859792f, 0.524497986f},
-std::array<float,2>{0.815586388f, 0.277174324f},
-std::array<float,2>{0.349090993f, 0.819193006f},
-std::array<float,2>{0.440264583f, 0.469270468f},
-std::array<float,2>{0.929769814f, 0.933034182f},
-std::array<float,2>{0.722601295f, 0.0779455751f},
-std::array<float,2>{0.148037896f, 0.715963423f},
-std::array<float,2>{0.214099467f, 0.354675055f},
-std::array<float,2>{0.645219803f, 0.772619128f},
-std::array<float,2>{0.940333188f, 0.153072476f},
-std::array<float,2>{0.387168229f, 0.583415985f},
-std::array<float,2>{0.283004761f, 0.0528268851f},
-std::array<float,2>{0.793602586f, 0.675820708f},
-std::array<float,2>{0.565395713f, 0.395335406f},
-std::array<float,2>{0.0225253478f, 0.979881823f},
-std::array<float,2>{0.150087953f, 0.222689062f},
-std::array<float,2>{0.732530475f, 0.546185911f},
-std::array<float,2>{0.928577423f, 0.291991502f},
-std::array<float,2>{0.449810952f, 0.873308778f},
-std::array<float,2>{0.355234444f, 0.45145908f},
-std::array<float,2>{0.822163403f, 0.885378182f},
-std::array<float,2>{0.514646947f, 0.110665001f},
-std::array<float,2>{0.109280974f, 0.726339996f},
-std::array<float,2>{0.0251674745f, 0.325129718f},
-std::array<float,2>{0.572256327f, 0.793664694f},
-std::array<float,2>{0.787059546f, 0.182472199f},
-std::array<float,2>{0.289435923f, 0.609592497f},
-std::array<float,2>{0.375371635f, 0.0207752455f},
-std::array<float,2>{0.946684122f, 0.654498458f},
-std::array<float,2>{0.650307655f, 0.408430696f},
-std::array<float,2>{0.210827053f, 0.937703133f},
-std::array<float,2>{0.0921707377f, 0.0662155673f},
-std::array<float,2>{0.535688221f, 0.703885555f},
-std::array<float,2>{0.847924292f, 0.47673896f},
-std::array<float,2>{0.338943988f, 0.927369416f},
-std::array<float,2>{0.491705805f, 0.26792866f},
-std::array<float,2>{0.906178534f, 0.825813651f},
-std::array<float,2>{0.710291147f, 0.191124588f},
-std::array<float,2>{0.158310696f, 0.519623637f},
-std::array<float,2>{0.234398305f, 0.399902225f},
-std::array<float,2>{0.681849003f, 0.97048068f},
-std::array<float,2>{0.970188081f, 0.0594371557f},
-std::array<float,2>{0.429472923f, 0.68135637f},
-std::array<float,2>{0.263924271f, 0.141613573f},
-std::array<float,2>{0.779715717f, 0.590885401f},
-std::array<float,2>{0.605550051f, 0.350304157f},
-std::array<float,2>{0.0351244174f, 0.775995493f},
-std::array<float,2>{0.190720066f, 0.0435947292f},
-std::array<float,2>{0.635084987f, 0.665914834f},
-std::array<float,2>{0.954383433f, 0.389184505f},
-std::array<float,2>{0.395677119f, 0.987049818f},
-std::array<float,2>{0.298970431f, 0.360394359f},
-std::array<float,2>{0.800004125f, 0.762302935f},
-std::array<float,2>{0.592350066f, 0.138646111f},
-std::array<float,2>{0.00164873176f, 0.564586759f},
-std::array<float,2>{0.117692262f, 0.496463388f},
-std::array<float,2>{0.529559791f, 0.908015013f},
-std::array<float,2>{0.829537868f, 0.0912549943f},
-std::array<float,2>{0.366964012f, 0.692718625f},
-std::array<float,2>{0.4581303f, 0.204183966f},
-std::array<float,2>{0.911352336f, 0.511361897f},
-std::array<float,2>{0.742044568f, 0.25475058f},
-std::array<float,2>{0.137171313f, 0.836266756f},
-std::array<float,2>{0.0509846099f, 0.168866396f},
-std::array<float,2>{0.621785283f, 0.599171638f},
-std::array<float,2>{0.753495574f, 0.3328816f},
-std::array<float,2>{0.267867833f, 0.802547514f},
-std::array<float,2>{0.420117676f, 0.424270988f},
-std::array<float,2>{0.995429933f, 0.962417662f},
-std::array<float,2>{0.662767529f, 0.00248646503f},
-std::array<float,2>{0.228490174f, 0.625623524f},
-std::array<float,2>{0.1747109f, 0.302331448f},
-std::array<float,2>{0.690075934f, 0.853015423f},
-std::array<float,2>{0.886743665f, 0.24908559f},
-std::array<float,2>{0.469478607f, 0.553467989f},
-std::array<float,2>{0.319121182f, 0.107593849f},
-std::array<float,2>{0.865572691f, 0.736399651f},
-std::array<float,2>{0.54974103f, 0.457839191f},
-std::array<float,2>{0.0659334958f, 0.891121149f},
-std::array<float,2>{0.142086655f, 0.165892318f},
-std::array<float,2>{0.724750876f, 0.595934927f},
-std::array<float,2>{0.935141802f, 0.330634773f},
-std::array<float,2>{0.444773972f, 0.799283147f},
-std::array<float,2>{0.34387666f, 0.429251611f},
-std::array<float,2>{0.819528639f, 0.968524992f},
-std::array<float,2>{0.502056837f, 0.00590609387f},
-std::array<float,2>{0.0979856551f, 0.629882872f},
-std::array<float,2>{0.0165119525f, 0.299323618f},
-std::array<float,2>{0.567201674f, 0.856533468f},
-std::array<float,2>{0.791270196f, 0.242765814f},
-std::array<float,2>{0.28626734f, 0.547950566f},
-std::array<float,2>{0.384643167f, 0.105442554f},
-std::array<float,2>{0.941533089f, 0.741613805f},
-std::array<float,2>{0.643066764f, 0.455189914f},
-std::array<float,2>{0.216842383f, 0.897588372f},
-std::array<float,2>{0.0838675275f, 0.0424269736f},
-std::array<float,2>{0.539344251f, 0.668695986f},
-std::array<float,2>{0.852334857f, 0.384943247f},
-std::array<float,2>{0.335530788f, 0.990394711f},
-std::array<float,2>{0.49734965f, 0.367164165f},
-std::array<float,2>{0.891736567f, 0.75987643f},
-std::array<float,2>{0.716013014f, 0.133707538f},
-std::array<float,2>{0.17157118f, 0.568004847f},
-std::array<float,2>{0.242295757f, 0.492967218f},
-std::array<float,2>{0.677256584f, 0.911526799f},
-std::array<float,2>{0.977216005f, 0.0869573951f},
-std::array<float,2>{0.43553257f, 0.689710736f},
-std::array<float,2>{0.251594245f, 0.208487272f},
-std::array<float,2>{0.769795656f, 0.513899684f},
-std::array<float,2>{0.596737802f, 0.253509313f},
-std::array<float,2>{0.0393002555f, 0.843654215f},
-std::array<float,2>{0.195893347f, 0.0700569376f},
-std::array<float,2>{0.631637156f, 0.707958102f},
-std::array<float,2>{0.967636049f, 0.481912971f},
-std::array<float,2>{0.406016052f, 0.923233092f},
-std::array<float,2>{0.312187582f, 0.272451311f},
-std::array<float,2>{0.808846116f, 0.822688997f},
-std::array<float,2>{0.580899179f, 0.192131758f},
-std::array<float,2>{0.00796360709f, 0.517888546f},
-std::array<float,2>{0.115838662f, 0.404443473f},
-std::array<float,2>{0.522627711f, 0.974112809f},
-std::array<float,2>{0.843211591f, 0.0570378639f},
-std::array<float,2>{0.371342123f, 0.684648693f},
-std::array<float,2>{0.464501053f, 0.145008832f},
-std::array<float,2>{0.915500045f, 0.587581873f},
-std::array<float,2>{0.749148786f, 0.346077085f},
-std::array<float,2>{0.129839346f, 0.778758049f},
-std::array<float,2>{0.056424614f, 0.221756473f},
-std::array<float,2>{0.613788307f, 0.541854024f},
-std::array<float,2>{0.759518683f, 0.294081777f},
-std::array<float,2>{0.278487027f, 0.870490551f},
-std::array<float,2>{0.408017188f, 0.447266102f},
-std::array<float,2>{0.98652041f, 0.887389839f},
-std::array<float,2>{0.671002984f, 0.115150273f},
-std::array<float,2>{0.222376287f, 0.71989876f},
-std::array<float,2>{0.18205978f, 0.321919322f},
-std::array<float,2>{0.695542872f, 0.792060852f},
-std::array<float,2>{0.876728117f, 0.185677588f},
-std::array<float,2>{0.484078079f, 0.614591718f},
-std::array<float,2>{0.326216251f, 0.0189969875f},
-std::array<float,2>{0.868376613f, 0.652061045f},
-std::array<float,2>{0.557588935f, 0.413222224f},
-std::array<float,2>{0.0743491426f, 0.941938579f},
-std::array<float,2>{0.232608765f, 0.197007984f},
-std::array<float,2>{0.658325255f, 0.530778766f},
-std::array<float,2>{0.997781396f, 0.278213501f},
-std::array<float,2>{0.41670534f, 0.814565778f},
-std::array<float,2>{0.271998614f, 0.474662274f},
-std::array<float,2>{0.754176736f, 0.935168207f},
-std::array<float,2>{0.620794415f, 0.0729817525f},
-std::array<float,2>{0.0506373495f, 0.711837769f},
-std::array<float,2>{0.068260856f, 0.357605159f},
-std::array<float,2>{0.551160634f, 0.767630339f},
-std::array<float,2>{0.862948954f, 0.151427403f},
-std::array<float,2>{0.313891381f, 0.579681993f},
-std::array<float,2>{0.474638283f, 0.0468900613f},
-std::array<float,2>{0.883133531f, 0.675535619f},
-std::array<float,2>{0.694499373f, 0.390825331f},
-std::array<float,2>{0.176334977f, 0.982693553f},
-std::array<float,2>{0.00689099031f, 0.121669441f},
-std::array<float,2>{0.586324155f, 0.732093155f},
-std::array<float,2>{0.802895546f, 0.444448411f},
-std::array<float,2>{0.303055376f, 0.875731468f},
-std::array<float,2>{0.39086625f, 0.283643484f},
-std::array<float,2>{0.957356215f, 0.865778267f},
-std::array<float,2>{0.639539182f, 0.233242258f},
-std::array<float,2>{0.19146587f, 0.532899261f},
-std::array<float,2>{0.136537224f, 0.420762748f},
-std::array<float,2>{0.736836374f, 0.947244167f},
-std::array<float,2>{0.90953666f, 0.029451143f},
-std::array<float,2>{0.454564244f, 0.640916884f},
-std::array<float,2>{0.362259895f, 0.175845429f},
-std::array<float,2>{0.833558202f, 0.62102133f},
-std::array<float,2>{0.523544252f, 0.318835944f},
-std::array<float,2>{0.122074112f, 0.783571482f},
-std::array<float,2>{0.160566449f, 0.0110994382f},
-std::array<float,2>{0.704107761f, 0.637332201f},
-std::array<float,2>{0.901746213f, 0.431324363f},
-std::array<float,2>{0.484716177f, 0.959057689f},
-std::array<float,2>{0.342476964f, 0.338731736f},
-std::array<float,2>{0.844680429f, 0.807674825f},
-std::array<float,2>{0.533409894f, 0.156688824f},
-std::array<float,2>{0.0864672065f, 0.601702809f},
-std::array<float,2>{0.0368307754f, 0.46359539f},
-std::array<float,2>{0.603150666f, 0.900632918f},
-std::array<float,2>{0.777107179f, 0.101334736f},
-std::array<float,2>{0.258066237f, 0.744412303f},
-std::array<float,2>{0.424305588f, 0.237765729f},
-std::array<float,2>{0.976542652f, 0.562116623f},
-std::array<float,2>{0.685410023f, 0.309120715f},
-std::array<float,2>{0.241262347f, 0.849201262f},
-std::array<float,2>{0.103612982f, 0.125752926f},
-std::array<float,2>{0.509539127f, 0.573143661f},
-std::array<float,2>{0.824306488f, 0.373533696f},
-std::array<float,2>{0.355666816f, 0.757646382f},
-std::array<float,2>{0.445927948f, 0.37589404f},
-std::array<float,2>{0.923261404f, 0.997947037f},
-std::array<float,2>{0.729371846f, 0.0317254663f},
-std::array<float,2>{0.153653383f, 0.65963614f},
-std::array<float,2>{0.203160793f, 0.259197652f},
-std::array<float,2>{0.656223893f, 0.834552467f},
-std::array<float,2>{0.949977994f, 0.213550121f},
-std::array<float,2>{0.379635841f, 0.504069388f},
-std::array<float,2>{0.296037167f, 0.0858230963f},
-std::array<float,2>{0.782797933f, 0.699385464f},
-std::array<float,2>{0.577380121f, 0.487007022f},
-std::array<float,2>{0.030994162f, 0.921574831f},
-std::array<float,2>{0.211212948f, 0.154144511f},
-std::array<float,2>{0.648099422f, 0.582401514f},
-std::array<float,2>{0.937661648f, 0.35423097f},
-std::array<float,2>{0.390090495f, 0.772136927f},
-std::array<float,2>{0.284803659f, 0.396006167f},
-std::array<float,2>{0.796032488f, 0.979094326f},
-std::array<float,2>{0.56287986f, 0.0544113219f},
-std::array<float,2>{0.0213577244f, 0.676851928f},
-std::array<float,2>{0.0941736475f, 0.27542755f},
-std::array<float,2>{0.504511952f, 0.819576383f},
-std::array<float,2>{0.812639475f, 0.203077301f},
-std::array<float,2>{0.350846171f, 0.523497641f},
-std::array<float,2>{0.439289093f, 0.0767903402f},
-std::array<float,2>{0.932398975f, 0.715038359f},
-std::array<float,2>{0.719225645f, 0.469834358f},
-std::array<float,2>{0.145820484f, 0.931968868f},
-std::array<float,2>{0.0444973223f, 0.0252587665f},
-std::array<float,2>{0.600937247f, 0.644849837f},
-std::array<float,2>{0.769364178f, 0.417958528f},
-std::array<float,2>{0.255456537f, 0.951663733f},
-std::array<float,2>{0.430384904f, 0.313607872f},
-std::array<float,2>{0.983686566f, 0.78708744f},
-std::array<float,2>{0.672371864f, 0.172883436f},
-std::array<float,2>{0.248888537f, 0.623406053f},
-std::array<float,2>{0.165442079f, 0.438590586f},
-std::array<float,2>{0.712573767f, 0.881933272f},
-std::array<float,2>{0.894941092f, 0.118607f},
-std::array<float,2>{0.495980769f, 0.727338791f},
-std::array<float,2>{0.328986853f, 0.229071915f},
-std::array<float,2>{0.856558084f, 0.538847506f},
-std::array<float,2>{0.544183552f, 0.288278431f},
-std::array<float,2>{0.0801038668f, 0.862613857f},
-std::array<float,2>{0.12504968f, 0.0970205516f},
-std::array<float,2>{0.745922625f, 0.749120116f},
-std::array<float,2>{0.920258224f, 0.465744704f},
-std::array<float,2>{0.465851426f, 0.902969658f},
-std::array<float,2>{0.368504137f, 0.30615595f},
-std::array<float,2>{0.836209416f, 0.846712291f},
-std::array<float,2>{0.518863142f, 0.238571256f},
-std::array<float,2>{0.11003115f, 0.555449188f},
-std::array<float,2>{0.0129514327f, 0.435254633f},
-std::array<float,2>{0.585068643f, 0.954429209f},
-std::array<float,2>{0.8075881f, 0.0138431862f},
-std::array<float,2>{0.304837137f, 0.634990036f},
-std::array<float,2>{0.399986744f, 0.160833776f},
-std::array<float,2>{0.964133501f, 0.60676688f},
-std::array<float,2>{0.628116488f, 0.340431154f},
-std::array<float,2>{0.200699091f, 0.810613811f},
-std::array<float,2>{0.0715662464f, 0.215966716f},
-std::array<float,2>{0.561531425f, 0.502036929f},
-std::array<float,2>{0.874636948f, 0.264267027f},
-std::array<float,2>{0.32181257f, 0.828368306f},
-std::array<float,2>{0.477922767f, 0.488932133f},
-std::array<float,2>{0.881071568f, 0.915373623f},
-std::array<float,2>{0.701221406f, 0.0795161575f},
-std::array<float,2>{0.185816079f, 0.697976887f},
-std::array<float,2>{0.223890334f, 0.369850636f},
-std::array<float,2>{0.667651057f, 0.751190841f},
-std::array<float,2>{0.99176836f, 0.129981518f},
-std::array<float,2>{0.413110167f, 0.576334774f},
-std::array<float,2>{0.274323732f, 0.0387385413f},
-std::array<float,2>{0.764265716f, 0.662123024f},
-std::array<float,2>{0.611218393f, 0.38186571f},
-std::array<float,2>{0.0586755686f, 0.9951424f},
-std::array<float,2>{0.173396885f, 0.248152256f},
-std::array<float,2>{0.688549757f, 0.554462612f},
-std::array<float,2>{0.88898474f, 0.301072359f},
-std::array<float,2>{0.472613811f, 0.852438152f},
-std::array<float,2>{0.31690678f, 0.458706826f},
-std::array<float,2>{0.863941193f, 0.892570674f},
-std::array<float,2>{0.547790051f, 0.108826444f},
-std::array<float,2>{0.0639890432f, 0.738114178f},
-std::array<float,2>{0.0530644357f, 0.333119303f},
-std::array<float,2>{0.624485314f, 0.801351964f},
-std::array<float,2>{0.750044107f, 0.169849917f},
-std::array<float,2>{0.267265648f, 0.597819865f},
-std::array<float,2>{0.419753641f, 0.00343057723f},
-std::array<float,2>{0.99239862f, 0.626905918f},
-std::array<float,2>{0.660188198f, 0.425695181f},
-std::array<float,2>{0.230374992f, 0.961651504f},
-std::array<float,2>{0.12060979f, 0.0901588723f},
-std::array<float,2>{0.528609157f, 0.691577911f},
-std::array<float,2>{0.830807805f, 0.497994006f},
-std::array<float,2>{0.363418072f, 0.906975508f},
-std::array<float,2>{0.459722906f, 0.254955232f},
-std::array<float,2>{0.912448764f, 0.837110162f},
-std::array<float,2>{0.739403367f, 0.203547239f},
-std::array<float,2>{0.139688298f, 0.510532081f},
-std::array<float,2>{0.1884837f, 0.390211344f},
-std::array<float,2>{0.634370148f, 0.987423658f},
-std::array<float,2>{0.955960989f, 0.0441903621f},
-std::array<float,2>{0.396950275f, 0.664634645f},
-std::array<float,2>{0.297553509f, 0.137520954f},
-std::array<float,2>{0.798194945f, 0.566119969f},
-std::array<float,2>{0.591136754f, 0.359924436f},
-std::array<float,2>{0.00280402997f, 0.763349414f},
-std::array<float,2>{0.236804128f, 0.06018655f},
-std::array<float,2>{0.680732012f, 0.680435419f},
-std::array<float,2>{0.972312689f, 0.398882031f},
-std::array<float,2>{0.42743358f, 0.969093442f},
-std::array<float,2>{0.262182385f, 0.350703359f},
-std::array<float,2>{0.777540028f, 0.776537955f},
-std::array<float,2>{0.608269393f, 0.14067471f},
-std::array<float,2>{0.0328230411f, 0.59070307f},
-std::array<float,2>{0.0899119303f, 0.478020579f},
-std::array<float,2>{0.538697958f, 0.926630855f},
-std::array<float,2>{0.849625945f, 0.0647896603f},
-std::array<float,2>{0.336626202f, 0.704212844f},
-std::array<float,2>{0.489695519f, 0.189810544f},
-std::array<float,2>{0.90387857f, 0.520712852f},
-std::array<float,2>{0.707491815f, 0.26882264f},
-std::array<float,2>{0.157499149f, 0.824443638f},
-std::array<float,2>{0.0266965516f, 0.183209226f},
-std::array<float,2>{0.573987186f, 0.611169696f},
-std::array<float,2>{0.788466454f, 0.325550914f},
-std::array<float,2>{0.291551977f, 0.794348598f},
-std::array<float,2>{0.377462387f, 0.410044819f},
-std::array<float,2>{0.949164271f, 0.939343512f},
-std::array<float,2>{0.650821686f, 0.0198272709f},
-std::array<float,2>{0.2078989f, 0.656034648f},
-std::array<float,2>{0.151659966f, 0.292951435f},
-std::array<float,2>{0.731629729f, 0.874294579f},
-std::array<float,2>{0.925886035f, 0.224263832f},
-std::array<float,2>{0.452608287f, 0.545551777f},
-std::array<float,2>{0.353275239f, 0.110108241f},
-std::array<float,2>{0.822498918f, 0.725348711f},
-std::array<float,2>{0.513265908f, 0.452276558f},
-std::array<float,2>{0.106664397f, 0.885795474f},
-std::array<float,2>{0.168561652f, 0.136425465f},
-std::array<float,2>{0.718746245f, 0.569969893f},
-std::array<float,2>{0.893460095f, 0.364406914f},
-std::array<float,2>{0.499159396f, 0.758570015f},
-std::array<float,2>{0.333750278f, 0.384651691f},
-std::array<float,2>{0.853733242f, 0.990092516f},
-std::array<float,2>{0.541794479f, 0.0399480537f},
-std::array<float,2>{0.0848864764f, 0.670211196f},
-std::array<float,2>{0.0420889035f, 0.251779854f},
-std::array<float,2>{0.594104946f, 0.841570318f},
-std::array<float,2>{0.772771001f, 0.209430888f},
-std::array<float,2>{0.253010839f, 0.513217688f},
-std::array<float,2>{0.437484443f, 0.088666454f},
-std::array<float,2>{0.980225384f, 0.688995481f},
-std::array<float,2>{0.678505957f, 0.494790941f},
-std::array<float,2>{0.244824216f, 0.91392982f},
-std::array<float,2>{0.0998575166f, 0.00464008562f},
-std::array<float,2>{0.50079143f, 0.631892741f},
-std::array<float,2>{0.818043828f, 0.427696168f},
-std::array<float,2>{0.346142322f, 0.965189815f},
-std::array<float,2>{0.443215996f, 0.328232139f},
-std::array<float,2>{0.936331451f, 0.798407912f},
-std::array<float,2>{0.723543584f, 0.166903213f},
-std::array<float,2>{0.143100142f, 0.594711721f},
-std::array<float,2>{0.215999946f, 0.453404963f},
-std::array<float,2>{0.640858114f, 0.895151913f},
-std::array<float,2>{0.944523036f, 0.102960832f},
-std::array<float,2>{0.386354297f, 0.738735676f},
-std::array<float,2>{0.287600368f, 0.246059269f},
-std::array<float,2>{0.789867759f, 0.550030589f},
-std::array<float,2>{0.569576502f, 0.298623949f},
-std::array<float,2>{0.0188870821f, 0.858941138f},
-std::array<float,2>{0.21972017f, 0.115292393f},
-std::array<float,2>{0.668795824f, 0.721315444f},
-std::array<float,2>{0.986178994f, 0.445640355f},
-std::array<float,2>{0.409568846f, 0.890454948f},
-std::array<float,2>{0.279794425f, 0.296343774f},
-std::array<float,2>{0.760638535f, 0.868839324f},
-std::array<float,2>{0.616539836f, 0.220419556f},
-std::array<float,2>{0.0572341941f, 0.53990078f},
-std::array<float,2>{0.0763296559f, 0.410764575f},
-std::array<float,2>{0.556363225f, 0.943540275f},
-std::array<float,2>{0.871060669f, 0.0172755439f},
-std::array<float,2>{0.324435949f, 0.649009228f},
-std::array<float,2>{0.482083648f, 0.184469208f},
-std::array<float,2>{0.877666593f, 0.61575824f},
-std::array<float,2>{0.698957324f, 0.322368562f},
-std::array<float,2>{0.179773688f, 0.790462375f},
-std::array<float,2>{0.00984069053f, 0.194700599f},
-std::array<float,2>{0.578806221f, 0.515649199f},
-std::array<float,2>{0.811858475f, 0.27142486f},
-std::array<float,2>{0.309102446f, 0.820780039f},
-std::array<float,2>{0.40418005f, 0.482467651f},
-std::array<float,2>{0.966223717f, 0.924598515f},
-std::array<float,2>{0.629321218f, 0.0677264631f},
-std::array<float,2>{0.198163927f, 0.710104704f},
-std::array<float,2>{0.132682487f, 0.344108105f},
-std::array<float,2>{0.747441232f, 0.780183136f},
-std::array<float,2>{0.917912722f, 0.147646651f},
-std::array<float,2>{0.461377293f, 0.587939978f},
-std::array<float,2>{0.374543458f, 0.0546970852f},
-std::array<float,2>{0.841494799f, 0.686358094f},
-std::array<float,2>{0.521174967f, 0.404000044f},
-std::array<float,2>{0.113693461f, 0.975191355f},
-std::array<float,2>{0.194987848f, 0.231288344f},
-std::array<float,2>{0.638026416f, 0.533500671f},
-std::array<float,2>{0.959867895f, 0.282485992f},
-std::array<float,2>{0.393692821f, 0.864665329f},
-std::array<float,2>{0.302552223f, 0.443170726f},
-std::array<float,2>{0.801851749f, 0.878071904f},
-std::array<float,2>{0.588644624f, 0.123722941f},
-std::array<float,2>{0.00427829428f, 0.733058572f},
-std::array<float,2>{0.123909175f, 0.317411304f},
-std::array<float,2>{0.526144683f, 0.782494962f},
-std::array<float,2>{0.834335566f, 0.179299906f},
-std::array<float,2>{0.361297041f, 0.61886251f},
-std::array<float,2>{0.45542112f, 0.0289800074f},
-std::array<float,2>{0.906599283f, 0.644368947f},
-std::array<float,2>{0.736167967f, 0.419350713f},
-std::array<float,2>{0.133416742f, 0.948741138f},
-std::array<float,2>{0.0471214429f, 0.0711044222f},
-std::array<float,2>{0.619019449f, 0.713282824f},
-std::array<float,2>{0.756293416f, 0.474370033f},
-std::array<float,2>{0.271070898f, 0.936000049f},
-std::array<float,2>{0.415080637f, 0.27995199f},
-std::array<float,2>{0.998790264f, 0.81343013f},
-std::array<float,2>{0.656609237f, 0.198216483f},
-std::array<float,2>{0.230552301f, 0.529225767f},
-std::array<float,2>{0.178243905f, 0.393781781f},
-std::array<float,2>{0.691581249f, 0.982331932f},
-std::array<float,2>{0.886241734f, 0.04934806f},
-std::array<float,2>{0.47447437f, 0.673049212f},
-std::array<float,2>{0.314846009f, 0.149137944f},
-std::array<float,2>{0.860346377f, 0.580932617f},
-std::array<float,2>{0.553424835f, 0.356593519f},
-std::array<float,2>{0.0697703212f, 0.766910732f},
-std::array<float,2>{0.154343218f, 0.0338599905f},
-std::array<float,2>{0.727004528f, 0.658160508f},
-std::array<float,2>{0.924845874f, 0.377380997f},
-std::array<float,2>{0.448423713f, 0.998550475f},
-std::array<float,2>{0.357443511f, 0.371136725f},
-std::array<float,2>{0.826667845f, 0.754851699f},
-std::array<float,2>{0.510886371f, 0.128222093f},
-std::array<float,2>{0.103264287f, 0.570943713f},
-std::array<float,2>{0.0277304761f, 0.484387219f},
-std::array<float,2>{0.575036585f, 0.919239402f},
-std::array<float,2>{0.784998894f, 0.0833299682f},
-std::array<float,2>{0.293807387f, 0.701964855f},
-std::array<float,2>{0.381854355f, 0.211173281f},
-std::array<float,2>{0.951950908f, 0.506453156f},
-std::array<float,2>{0.652991116f, 0.259929419f},
-std::array<float,2>{0.206539273f, 0.832552969f},
-std::array<float,2>{0.087901786f, 0.158298761f},
-std::array<float,2>{0.531578541f, 0.604832649f},
-std::array<float,2>{0.846723497f, 0.336656213f},
-std::array<float,2>{0.339993477f, 0.806621075f},
-std::array<float,2>{0.486560196f, 0.433162451f},
-std::array<float,2>{0.899518013f, 0.957445204f},
-std::array<float,2>{0.706763446f, 0.00965706352f},
-std::array<float,2>{0.162422314f, 0.640266776f},
-std::array<float,2>{0.238842562f, 0.310640812f},
-std::array<float,2>{0.687276185f, 0.851292968f},
-std::array<float,2>{0.973835111f, 0.235987753f},
-std::array<float,2>{0.422279269f, 0.560458839f},
-std::array<float,2>{0.260961264f, 0.0977630466f},
-std::array<float,2>{0.773604691f, 0.742262423f},
-std::array<float,2>{0.605165899f, 0.462639928f},
-std::array<float,2>{0.0371664427f, 0.900291383f},
-std::array<float,2>{0.247397095f, 0.174814641f},
-std::array<float,2>{0.674290121f, 0.622324705f},
-std::array<float,2>{0.982124388f, 0.315961033f},
-std::array<float,2>{0.43344909f, 0.78888464f},
-std::array<float,2>{0.257113487f, 0.41579473f},
-std::array<float,2>{0.765913308f, 0.950068474f},
-std::array<float,2>{0.598356903f, 0.0270449743f},
-std::array<float,2>{0.0465399325f, 0.646920741f},
-std::array<float,2>{0.0797831118f, 0.286249012f},
-std::array<float,2>{0.546782911f, 0.859734416f},
-std::array<float,2>{0.858383477f, 0.227728426f},
-std::array<float,2>{0.330588758f, 0.535638273f},
-std::array<float,2>{0.49345389f, 0.119987793f},
-std::array<float,2>{0.896674871f, 0.728538811f},
-std::array<float,2>{0.714258015f, 0.440013111f},
-std::array<float,2>{0.167585567f, 0.879074454f},
-std::array<float,2>{0.0222301614f, 0.0523852892f},
-std::array<float,2>{0.566181242f, 0.679350555f},
-std::array<float,2>{0.794306517f, 0.396566719f},
-std::array<float,2>{0.281821132f, 0.977263093f},
-std::array<float,2>{0.387957513f, 0.351973116f},
-std::array<float,2>{0.941071451f, 0.770336986f},
-std::array<float,2>{0.645920634f, 0.154821768f},
-std::array<float,2>{0.213678926f, 0.585642159f},
-std::array<float,2>{0.146559328f, 0.470747977f},
-std::array<float,2>{0.721556008f, 0.929698765f},
-std::array<float,2>{0.931327224f, 0.0758761391f},
-std::array<float,2>{0.440876067f, 0.71702528f},
-std::array<float,2>{0.348502874f, 0.200260028f},
-std::array<float,2>{0.815066934f, 0.526313424f},
-std::array<float,2>{0.506991744f, 0.275202096f},
-std::array<float,2>{0.0973843187f, 0.81760931f},
-std::array<float,2>{0.184131771f, 0.0809671432f},
-std::array<float,2>{0.700850785f, 0.695670605f},
-std::array<float,2>{0.88025701f, 0.49132058f},
-std::array<float,2>{0.478586942f, 0.916303813f},
-std::array<float,2>{0.322637081f, 0.262482584f},
-std::array<float,2>{0.871345878f, 0.831388116f},
-std::array<float,2>{0.55998981f, 0.217972621f},
-std::array<float,2>{0.0737795606f, 0.500057518f},
-std::array<float,2>{0.0622182749f, 0.37976864f},
-std::array<float,2>{0.611487567f, 0.992595553f},
-std::array<float,2>{0.762422621f, 0.0358469076f},
-std::array<float,2>{0.275812447f, 0.660505593f},
-std::array<float,2>{0.411057889f, 0.132118687f},
-std::array<float,2>{0.98928839f, 0.574560046f},
-std::array<float,2>{0.664895713f, 0.367451072f},
-std::array<float,2>{0.225821763f, 0.753741264f},
-std::array<float,2>{0.11142385f, 0.240919068f},
-std::array<float,2>{0.517392755f, 0.557371974f},
-std::array<float,2>{0.838748872f, 0.307840943f},
-std::array<float,2>{0.37044853f, 0.845357895f},
-std::array<float,2>{0.467936546f, 0.467038721f},
-std::array<float,2>{0.918930471f, 0.905307949f},
-std::array<float,2>{0.742856801f, 0.0946608707f},
-std::array<float,2>{0.127469569f, 0.747199833f},
-std::array<float,2>{0.20273371f, 0.342856675f},
-std::array<float,2>{0.62633574f, 0.808688402f},
-std::array<float,2>{0.96273452f, 0.163355455f},
-std::array<float,2>{0.401606917f, 0.608143032f},
-std::array<float,2>{0.307445735f, 0.0136480415f},
-std::array<float,2>{0.804961264f, 0.633280277f},
-std::array<float,2>{0.583082139f, 0.435598701f},
-std::array<float,2>{0.0136765055f, 0.956639469f},
-std::array<float,2>{0.138497144f, 0.205906361f},
-std::array<float,2>{0.740732491f, 0.507839024f},
-std::array<float,2>{0.910480797f, 0.256970912f},
-std::array<float,2>{0.457785159f, 0.839075863f},
-std::array<float,2>{0.365326703f, 0.498119503f},
-std::array<float,2>{0.829061151f, 0.910059869f},
-std::array<float,2>{0.530377805f, 0.0920764729f},
-std::array<float,2>{0.119128831f, 0.693970442f},
-std::array<float,2>{0.000725707971f, 0.362278312f},
-std::array<float,2>{0.59290278f, 0.764989734f},
-std::array<float,2>{0.799114525f, 0.138724402f},
-std::array<float,2>{0.300123572f, 0.563196063f},
-std::array<float,2>{0.395240754f, 0.0456500873f},
-std::array<float,2>{0.953785539f, 0.667790294f},
-std::array<float,2>{0.636215985f, 0.388489217f},
-std::array<float,2>{0.189683676f, 0.98446238f},
-std::array<float,2>{0.0654079765f, 0.106400847f},
-std::array<float,2>{0.54984951f, 0.735833049f},
-std::array<float,2>{0.866556227f, 0.459102213f},
-std::array<float,2>{0.319494754f, 0.894335151f},
-std::array<float,2>{0.469731629f, 0.303017199f},
-std::array<float,2>{0.888132393f, 0.854080617f},
-std::array<float,2>{0.691124439f, 0.247397065f},
-std::array<float,2>{0.17569308f, 0.551494479f},
-std::array<float,2>{0.227093741f, 0.422558784f},
-std::array<float,2>{0.663352311f, 0.963341355f},
-std::array<float,2>{0.994524717f, 0.00144224532f},
-std::array<float,2>{0.421420008f, 0.627601802f},
-std::array<float,2>{0.268643409f, 0.171864316f},
-std::array<float,2>{0.752385616f, 0.600432515f},
-std::array<float,2>{0.622304976f, 0.334862947f},
-std::array<float,2>{0.0517876372f, 0.803254247f},
-std::array<float,2>{0.209321737f, 0.0221457481f},
-std::array<float,2>{0.648602426f, 0.652953684f},
-std::array<float,2>{0.945844829f, 0.407941341f},
-std::array<float,2>{0.376431584f, 0.941346467f},
-std::array<float,2>{0.290098876f, 0.326566637f},
-std::array<float,2>{0.785745442f, 0.796864808f},
-std::array<float,2>{0.571013212f, 0.181072757f},
-std::array<float,2>{0.0237887874f, 0.612836719f},
-std::array<float,2>{0.107444346f, 0.45097509f},
-std::array<float,2>{0.514671028f, 0.884462893f},
-std::array<float,2>{0.820808947f, 0.112021923f},
-std::array<float,2>{0.354093254f, 0.723803341f},
-std::array<float,2>{0.450612575f, 0.22567533f},
-std::array<float,2>{0.929214776f, 0.543216527f},
-std::array<float,2>{0.733798563f, 0.289083838f},
-std::array<float,2>{0.149182126f, 0.872178376f},
-std::array<float,2>{0.0338152647f, 0.143620208f},
-std::array<float,2>{0.606993556f, 0.593200862f},
-std::array<float,2>{0.781151295f, 0.348587692f},
-std::array<float,2>{0.265196949f, 0.774112284f},
-std::array<float,2>{0.428379685f, 0.401136905f},
-std::array<float,2>{0.968895853f, 0.971629322f},
-std::array<float,2>{0.683226407f, 0.0617110394f},
-std::array<float,2>{0.235972896f, 0.681695938f},
-std::array<float,2>{0.159665078f, 0.265865505f},
-std::array<float,2>{0.709743857f, 0.826847553f},
-std::array<float,2>{0.90523231f, 0.188869044f},
-std::array<float,2>{0.490550399f, 0.521942258f},
-std::array<float,2>{0.33808887f, 0.0634386018f},
-std::array<float,2>{0.849088013f, 0.706429303f},
-std::array<float,2>{0.536521733f, 0.478765458f},
-std::array<float,2>{0.0934422091f, 0.9293648f},
-std::array<float,2>{0.154112607f, 0.128859043f},
-std::array<float,2>{0.728642821f, 0.570580721f},
-std::array<float,2>{0.923374414f, 0.37185663f},
-std::array<float,2>{0.445687324f, 0.754032969f},
-std::array<float,2>{0.356373549f, 0.377695858f},
-std::array<float,2>{0.824984908f, 0.998244703f},
-std::array<float,2>{0.509203911f, 0.0336165428f},
-std::array<float,2>{0.104305126f, 0.657670975f},
-std::array<float,2>{0.0302845016f, 0.260303825f},
-std::array<float,2>{0.577699482f, 0.832303643f},
-std::array<float,2>{0.782703757f, 0.211667642f},
-std::array<float,2>{0.296617687f, 0.506334603f},
-std::array<float,2>{0.379128754f, 0.083904922f},
-std::array<float,2>{0.949602902f, 0.701316476f},
-std::array<float,2>{0.65529722f, 0.48515293f},
-std::array<float,2>{0.203938782f, 0.919752836f},
-std::array<float,2>{0.0861351117f, 0.00927167013f},
-std::array<float,2>{0.534136295f, 0.639854491f},
-std::array<float,2>{0.843824029f, 0.432776541f},
-std::array<float,2>{0.342279017f, 0.957912028f},
-std::array<float,2>{0.485037118f, 0.336149156f},
-std::array<float,2>{0.901872337f, 0.805924058f},
-std::array<float,2>{0.704817057f, 0.15913853f},
-std::array<float,2>{0.160818234f, 0.605003774f},
-std::array<float,2>{0.242148876f, 0.46206069f},
-std::array<float,2>{0.684610307f, 0.899654508f},
-std::array<float,2>{0.976073623f, 0.0985361412f},
-std::array<float,2>{0.424509317f, 0.742979884f},
-std::array<float,2>{0.258671403f, 0.23556295f},
-std::array<float,2>{0.776469529f, 0.55958432f},
-std::array<float,2>{0.602744579f, 0.311133802f},
-std::array<float,2>{0.036341168f, 0.850903153f},
-std::array<float,2>{0.192014754f, 0.12317393f},
-std::array<float,2>{0.638694704f, 0.73277396f},
-std::array<float,2>{0.957802176f, 0.442652613f},
-std::array<float,2>{0.391359508f, 0.878448188f},
-std::array<float,2>{0.303392649f, 0.283019364f},
-std::array<float,2>{0.803431213f, 0.864987493f},
-std::array<float,2>{0.586805463f, 0.230507374f},
-std::array<float,2>{0.00733340206f, 0.53409344f},
-std::array<float,2>{0.122655518f, 0.419792593f},
-std::array<float,2>{0.52410239f, 0.948713481f},
-std::array<float,2>{0.833241522f, 0.0284097567f},
-std::array<float,2>{0.361715555f, 0.643764615f},
-std::array<float,2>{0.454720587f, 0.179066002f},
-std::array<float,2>{0.909759164f, 0.618603051f},
-std::array<float,2>{0.736615777f, 0.317878634f},
-std::array<float,2>{0.136033505f, 0.782814622f},
-std::array<float,2>{0.0498491935f, 0.197375372f},
-std::array<float,2>{0.620402336f, 0.528614104f},
-std::array<float,2>{0.754696548f, 0.279727519f},
-std::array<float,2>{0.271659493f, 0.812776744f},
-std::array<float,2>{0.416420549f, 0.474040121f},
-std::array<float,2>{0.997268081f, 0.936341107f},
-std::array<float,2>{0.659047008f, 0.0706099495f},
-std::array<float,2>{0.233174726f, 0.713670611f},
-std::array<float,2>{0.176245406f, 0.356966972f},
-std::array<float,2>{0.695205927f, 0.767447114f},
-std::array<float,2>{0.883653998f, 0.148459718f},
-std::array<float,2>{0.47524026f, 0.580354512f},
-std::array<float,2>{0.314399302f, 0.0490310006f},
-std::array<float,2>{0.862482607f, 0.673713088f},
-std::array<float,2>{0.551349044f, 0.39443776f},
-std::array<float,2>{0.0677976608f, 0.981801689f},
-std::array<float,2>{0.222143799f, 0.220045522f},
-std::array<float,2>{0.671683371f, 0.539470971f},
-std::array<float,2>{0.987063587f, 0.296710461f},
-std::array<float,2>{0.407573432f, 0.868270516f},
-std::array<float,2>{0.278915554f, 0.446231931f},
-std::array<float,2>{0.758833468f, 0.889707446f},
-std::array<float,2>{0.61344111f, 0.115816899f},
-std::array<float,2>{0.0559492595f, 0.720802188f},
-std::array<float,2>{0.0748998448f, 0.323204547f},
-std::array<float,2>{0.556939006f, 0.7906124f},
-std::array<float,2>{0.868999779f, 0.184069037f},
-std::array<float,2>{0.327107549f, 0.615304708f},
-std::array<float,2>{0.483519524f, 0.0166743025f},
-std::array<float,2>{0.876028657f, 0.64844054f},
-std::array<float,2>{0.695979238f, 0.410607606f},
-std::array<float,2>{0.182395622f, 0.943924665f},
-std::array<float,2>{0.00841614604f, 0.0679720715f},
-std::array<float,2>{0.580332816f, 0.710525692f},
-std::array<float,2>{0.809503853f, 0.483039439f},
-std::array<float,2>{0.311753094f, 0.924025059f},
-std::array<float,2>{0.40563041f, 0.270892322f},
-std::array<float,2>{0.967089176f, 0.821160913f},
-std::array<float,2>{0.631271899f, 0.195019856f},
-std::array<float,2>{0.195402533f, 0.516265094f},
-std::array<float,2>{0.129283607f, 0.403807908f},
-std::array<float,2>{0.749994397f, 0.974964678f},
-std::array<float,2>{0.915894866f, 0.0552802011f},
-std::array<float,2>{0.464075774f, 0.686026216f},
-std::array<float,2>{0.371590525f, 0.148112565f},
-std::array<float,2>{0.843295395f, 0.588513196f},
-std::array<float,2>{0.523434997f, 0.344550341f},
-std::array<float,2>{0.11549174f, 0.779533386f},
-std::array<float,2>{0.171346143f, 0.0394793339f},
-std::array<float,2>{0.716779113f, 0.670718551f},
-std::array<float,2>{0.89237684f, 0.383869529f},
-std::array<float,2>{0.497888446f, 0.989551246f},
-std::array<float,2>{0.335234076f, 0.365006745f},
-std::array<float,2>{0.851691186f, 0.757979393f},
-std::array<float,2>{0.539635837f, 0.136183769f},
-std::array<float,2>{0.0832159892f, 0.569699109f},
-std::array<float,2>{0.0396846458f, 0.494316727f},
-std::array<float,2>{0.597635567f, 0.913309813f},
-std::array<float,2>{0.770339191f, 0.0883144513f},
-std::array<float,2>{0.251042664f, 0.688791215f},
-std::array<float,2>{0.434748501f, 0.209708244f},
-std::array<float,2>{0.976796448f, 0.512866437f},
-std::array<float,2>{0.677211702f, 0.251339048f},
-std::array<float,2>{0.243134439f, 0.84087342f},
-std::array<float,2>{0.0985768735f, 0.166467413f},
-std::array<float,2>{0.502560675f, 0.593844056f},
-std::array<float,2>{0.819960713f, 0.328737944f},
-std::array<float,2>{0.344272524f, 0.797989964f},
-std::array<float,2>{0.445017487f, 0.427105635f},
-std::array<float,2>{0.935020864f, 0.965794265f},
-std::array<float,2>{0.725509048f, 0.00422583753f},
-std::array<float,2>{0.142357633f, 0.632391214f},
-std::array<float,2>{0.217311919f, 0.298077196f},
-std::array<float,2>{0.642870665f, 0.858686984f},
-std::array<float,2>{0.942210376f, 0.245393217f},
-std::array<float,2>{0.384142995f, 0.550509334f},
-std::array<float,2>{0.286829144f, 0.103308819f},
-std::array<float,2>{0.791945875f, 0.738901198f},
-std::array<float,2>{0.566511691f, 0.453629881f},
-std::array<float,2>{0.015921535f, 0.894816279f},
-std::array<float,2>{0.20713681f, 0.181415796f},
-std::array<float,2>{0.651230395f, 0.612661362f},
-std::array<float,2>{0.948380768f, 0.32674554f},
-std::array<float,2>{0.377361715f, 0.795918405f},
-std::array<float,2>{0.291084766f, 0.407263011f},
-std::array<float,2>{0.788854241f, 0.940437019f},
-std::array<float,2>{0.573381782f, 0.0214847792f},
-std::array<float,2>{0.0271616988f, 0.652530015f},
-std::array<float,2>{0.107160509f, 0.289596289f},
-std::array<float,2>{0.512832344f, 0.872957945f},
-std::array<float,2>{0.822849333f, 0.226382911f},
-std::array<float,2>{0.352712005f, 0.543908954f},
-std::array<float,2>{0.452709943f, 0.111700751f},
-std::array<float,2>{0.926416576f, 0.724319458f},
-std::array<float,2>{0.731958449f, 0.450338602f},
-std::array<float,2>{0.152191117f, 0.88403964f},
-std::array<float,2>{0.0324264914f, 0.0624254085f},
-std::array<float,2>{0.607557654f, 0.682341814f},
-std::array<float,2>{0.778025508f, 0.400549978f},
-std::array<float,2>{0.262407094f, 0.971003056f},
-std::array<float,2>{0.42703706f, 0.347976834f},
-std::array<float,2>{0.972060144f, 0.773489177f},
-std::array<float,2>{0.681172848f, 0.144268915f},
-std::array<float,2>{0.236872688f, 0.593383491f},
-std::array<float,2>{0.157839075f, 0.479038388f},
-std::array<float,2>{0.707671821f, 0.929129541f},
-std::array<float,2>{0.903750122f, 0.062516436f},
-std::array<float,2>{0.490231246f, 0.707015276f},
-std::array<float,2>{0.336342156f, 0.189111665f},
-std::array<float,2>{0.850322664f, 0.522311985f},
-std::array<float,2>{0.53819108f, 0.266270936f},
-std::array<float,2>{0.0906400681f, 0.826214671f},
-std::array<float,2>{0.140409961f, 0.0925840661f},
-std::array<float,2>{0.739831865f, 0.693756521f},
-std::array<float,2>{0.912801087f, 0.498942047f},
-std::array<float,2>{0.459005266f, 0.90933007f},
-std::array<float,2>{0.364240736f, 0.257502496f},
-std::array<float,2>{0.830218494f, 0.83964467f},
-std::array<float,2>{0.529249191f, 0.205460683f},
-std::array<float,2>{0.120345689f, 0.508740067f},
-std::array<float,2>{0.00222104508f, 0.388134003f},
-std::array<float,2>{0.591328323f, 0.985212505f},
-std::array<float,2>{0.798546314f, 0.0453083739f},
-std::array<float,2>{0.296967894f, 0.667409956f},
-std::array<float,2>{0.397141516f, 0.139443323f},
-std::array<float,2>{0.955169439f, 0.562739432f},
-std::array<float,2>{0.633897662f, 0.361471981f},
-std::array<float,2>{0.189051643f, 0.765490174f},
-std::array<float,2>{0.0636872724f, 0.247656107f},
-std::array<float,2>{0.547290742f, 0.550910413f},
-std::array<float,2>{0.863599539f, 0.303664088f},
-std::array<float,2>{0.316597998f, 0.85373646f},
-std::array<float,2>{0.472034276f, 0.459563196f},
-std::array<float,2>{0.889456868f, 0.893970847f},
-std::array<float,2>{0.689400554f, 0.105758011f},
-std::array<float,2>{0.173226476f, 0.736115336f},
-std::array<float,2>{0.229666471f, 0.334383458f},
-std::array<float,2>{0.660916984f, 0.803199112f},
-std::array<float,2>{0.993065238f, 0.171038494f},
-std::array<float,2>{0.419346362f, 0.600095272f},
-std::array<float,2>{0.266623467f, 0.00169792317f},
-std::array<float,2>{0.750813305f, 0.627266228f},
-std::array<float,2>{0.624815583f, 0.422127962f},
-std::array<float,2>{0.0535397306f, 0.963614285f},
-std::array<float,2>{0.186519444f, 0.218349189f},
-std::array<float,2>{0.701879799f, 0.500551164f},
-std::array<float,2>{0.881572485f, 0.261955559f},
-std::array<float,2>{0.478313565f, 0.831833184f},
-std::array<float,2>{0.321410328f, 0.491950333f},
-std::array<float,2>{0.874106705f, 0.916738272f},
-std::array<float,2>{0.562013388f, 0.0802776664f},
-std::array<float,2>{0.0718252733f, 0.695977449f},
-std::array<float,2>{0.0593423061f, 0.367769927f},
-std::array<float,2>{0.61050266f, 0.752989173f},
-std::array<float,2>{0.764003456f, 0.132393286f},
-std::array<float,2>{0.273579657f, 0.574724019f},
-std::array<float,2>{0.41403845f, 0.0354700945f},
-std::array<float,2>{0.991323471f, 0.66097039f},
-std::array<float,2>{0.667063713f, 0.379306078f},
-std::array<float,2>{0.224488124f, 0.992935538f},
-std::array<float,2>{0.109495334f, 0.0938647166f},
-std::array<float,2>{0.519207716f, 0.747979939f},
-std::array<float,2>{0.836717427f, 0.467707306f},
-std::array<float,2>{0.369026512f, 0.906034231f},
-std::array<float,2>{0.466326177f, 0.308435678f},
-std::array<float,2>{0.920864344f, 0.84495312f},
-std::array<float,2>{0.745146453f, 0.240720376f},
-std::array<float,2>{0.125894353f, 0.556959927f},
-std::array<float,2>{0.200389937f, 0.436297715f},
-std::array<float,2>{0.628835618f, 0.9562096f},
-std::array<float,2>{0.964675546f, 0.0129752532f},
-std::array<float,2>{0.399456114f, 0.63361007f},
-std::array<float,2>{0.305539906f, 0.163780883f},
-std::array<float,2>{0.806685269f, 0.607494652f},
-std::array<float,2>{0.585722923f, 0.343509167f},
-std::array<float,2>{0.0133706816f, 0.809446335f},
-std::array<float,2>{0.248496786f, 0.0264380593f},
-std::array<float,2>{0.67213589f, 0.647367477f},
-std::array<float,2>{0.983950257f, 0.415173501f},
-std::array<float,2>{0.430169523f, 0.949302256f},
-std::array<float,2>{0.255193084f, 0.315832764f},
-std::array<float,2>{0.768710136f, 0.788411379f},
-std::array<float,2>{0.601424515f, 0.175680071f},
-std::array<float,2>{0.0442708321f, 0.622956932f},
-std::array<float,2>{0.080627948f, 0.439590961f},
-std::array<float,2>{0.544472337f, 0.87967068f},
-std::array<float,2>{0.857033432f, 0.119353637f},
-std::array<float,2>{0.328163713f, 0.729060292f},
-std::array<float,2>{0.495444387f, 0.228138074f},
-std::array<float,2>{0.895314813f, 0.535873592f},
-std::array<float,2>{0.712296486f, 0.286854029f},
-std::array<float,2>{0.16558972f, 0.860350728f},
-std::array<float,2>{0.0205079969f, 0.154753953f},
-std::array<float,2>{0.563252151f, 0.58500284f},
-std::array<float,2>{0.796532094f, 0.352450728f},
-std::array<float,2>{0.28466323f, 0.769927025f},
-std::array<float,2>{0.390522808f, 0.397160321f},
-std::array<float,2>{0.938321173f, 0.97660023f},
-std::array<float,2>{0.647538304f, 0.0517737307f},
-std::array<float,2>{0.211501896f, 0.679119825f},
-std::array<float,2>{0.146137655f, 0.274423659f},
-std::array<float,2>{0.719252646f, 0.818100929f},
-std::array<float,2>{0.931867778f, 0.201075524f},
-std::array<float,2>{0.438698232f, 0.525599122f},
-std::array<float,2>{0.351256967f, 0.0755204931f},
-std::array<float,2>{0.813289702f, 0.717532635f},
-std::array<float,2>{0.504009068f, 0.471666485f},
-std::array<float,2>{0.0946166217f, 0.930381417f},
-std::array<float,2>{0.162963808f, 0.156818405f},
-std::array<float,2>{0.70620364f, 0.602484107f},
-std::array<float,2>{0.900149882f, 0.33811003f},
-std::array<float,2>{0.487086177f, 0.808511734f},
-std::array<float,2>{0.340767175f, 0.430744916f},
-std::array<float,2>{0.847529829f, 0.95989728f},
-std::array<float,2>{0.53193593f, 0.0115851369f},
-std::array<float,2>{0.0885437205f, 0.636743069f},
-std::array<float,2>{0.0379751399f, 0.308644861f},
-std::array<float,2>{0.604851544f, 0.849036992f},
-std::array<float,2>{0.774022996f, 0.238073304f},
-std::array<float,2>{0.261380762f, 0.561886191f},
-std::array<float,2>{0.422431499f, 0.100658573f},
-std::array<float,2>{0.974459708f, 0.744727671f},
-std::array<float,2>{0.686785698f, 0.463356376f},
-std::array<float,2>{0.238464102f, 0.900957942f},
-std::array<float,2>{0.102913477f, 0.0317532308f},
-std::array<float,2>{0.511424959f, 0.659812987f},
-std::array<float,2>{0.826505959f, 0.375143409f},
-std::array<float,2>{0.357953101f, 0.997208714f},
-std::array<float,2>{0.448910147f, 0.373611629f},
-std::array<float,2>{0.925522387f, 0.757273793f},
-std::array<float,2>{0.727380037f, 0.125186071f},
-std::array<float,2>{0.155099317f, 0.572509229f},
-std::array<float,2>{0.206742346f, 0.486329764f},
-std::array<float,2>{0.652383029f, 0.920900106f},
-std::array<float,2>{0.95165211f, 0.0854187906f},
-std::array<float,2>{0.382676482f, 0.699757278f},
-std::array<float,2>{0.293381184f, 0.212918118f},
-std::array<float,2>{0.784508705f, 0.504654408f},
-std::array<float,2>{0.574497759f, 0.259580255f},
-std::array<float,2>{0.028227007f, 0.834460497f},
-std::array<float,2>{0.231142282f, 0.072394155f},
-std::array<float,2>{0.657162964f, 0.711323082f},
-std::array<float,2>{0.998089015f, 0.47529462f},
-std::array<float,2>{0.415640026f, 0.934605122f},
-std::array<float,2>{0.270557463f, 0.277626306f},
-std::array<float,2>{0.75671488f, 0.815334618f},
-std::array<float,2>{0.618480742f, 0.196701407f},
-std::array<float,2>{0.0477902517f, 0.530740499f},
-std::array<float,2>{0.0702579916f, 0.391454935f},
-std::array<float,2>{0.553032994f, 0.98303628f},
-std::array<float,2>{0.859578729f, 0.0478246175f},
-std::array<float,2>{0.315308094f, 0.674874842f},
-std::array<float,2>{0.474109232f, 0.152279601f},
-std::array<float,2>{0.885903835f, 0.579278648f},
-std::array<float,2>{0.69210875f, 0.358341306f},
-std::array<float,2>{0.17794928f, 0.768092692f},
-std::array<float,2>{0.00468032295f, 0.23258099f},
-std::array<float,2>{0.588205934f, 0.532508552f},
-std::array<float,2>{0.802456737f, 0.283808976f},
-std::array<float,2>{0.301968575f, 0.865631402f},
-std::array<float,2>{0.394207656f, 0.444972277f},
-std::array<float,2>{0.959356844f, 0.875094116f},
-std::array<float,2>{0.638454735f, 0.121170536f},
-std::array<float,2>{0.194457337f, 0.731601655f},
-std::array<float,2>{0.133212239f, 0.319077909f},
-std::array<float,2>{0.735603988f, 0.78389138f},
-std::array<float,2>{0.906902313f, 0.176479101f},
-std::array<float,2>{0.455814332f, 0.620213747f},
-std::array<float,2>{0.360421091f, 0.0302440599f},
-std::array<float,2>{0.834473491f, 0.641156256f},
-std::array<float,2>{0.525469005f, 0.420290589f},
-std::array<float,2>{0.123173267f, 0.946424305f},
-std::array<float,2>{0.197670549f, 0.191881686f},
-std::array<float,2>{0.629570842f, 0.518126249f},
-std::array<float,2>{0.966362953f, 0.271630883f},
-std::array<float,2>{0.403451413f, 0.823194206f},
-std::array<float,2>{0.308655232f, 0.482240289f},
-std::array<float,2>{0.812082767f, 0.923817396f},
-std::array<float,2>{0.578495741f, 0.0694481581f},
-std::array<float,2>{0.0103167323f, 0.707424223f},
-std::array<float,2>{0.114132322f, 0.346507758f},
-std::array<float,2>{0.520934463f, 0.77919966f},
-std::array<float,2>{0.8410303f, 0.145155355f},
-std::array<float,2>{0.374254435f, 0.587194562f},
-std::array<float,2>{0.461874634f, 0.057531964f},
-std::array<float,2>{0.917354345f, 0.685109794f},
-std::array<float,2>{0.747571588f, 0.405051321f},
-std::array<float,2>{0.132017449f, 0.974135935f},
-std::array<float,2>{0.0569263957f, 0.114489801f},
-std::array<float,2>{0.616927624f, 0.720586598f},
-std::array<float,2>{0.760124028f, 0.447979361f},
-std::array<float,2>{0.27933079f, 0.886928499f},
-std::array<float,2>{0.409712285f, 0.294676274f},
-std::array<float,2>{0.985539317f, 0.870952606f},
-std::array<float,2>{0.66840142f, 0.222321376f},
-std::array<float,2>{0.21910055f, 0.541309893f},
-std::array<float,2>{0.180455998f, 0.413661212f},
-std::array<float,2>{0.698422909f, 0.94176954f},
-std::array<float,2>{0.877328932f, 0.0190653075f},
-std::array<float,2>{0.481596917f, 0.651615918f},
-std::array<float,2>{0.32490629f, 0.18630299f},
-std::array<float,2>{0.870190501f, 0.615210354f},
-std::array<float,2>{0.55568862f, 0.321706653f},
-std::array<float,2>{0.0767879412f, 0.792746305f},
-std::array<float,2>{0.142797381f, 0.00677262805f},
-std::array<float,2>{0.722921729f, 0.63040477f},
-std::array<float,2>{0.935797751f, 0.429019243f},
-std::array<float,2>{0.442641348f, 0.968176663f},
-std::array<float,2>{0.346380174f, 0.330465555f},
-std::array<float,2>{0.817847073f, 0.799444139f},
-std::array<float,2>{0.500336528f, 0.165332824f},
-std::array<float,2>{0.100447282f, 0.596340418f},
-std::array<float,2>{0.0193143133f, 0.455811858f},
-std::array<float,2>{0.56999135f, 0.898086488f},
-std::array<float,2>{0.789295316f, 0.104636505f},
-std::array<float,2>{0.287156045f, 0.742100894f},
-std::array<float,2>{0.385775805f, 0.242553264f},
-std::array<float,2>{0.945024192f, 0.548737586f},
-std::array<float,2>{0.641198874f, 0.298900813f},
-std::array<float,2>{0.216693103f, 0.85724479f},
-std::array<float,2>{0.0841838941f, 0.133019671f},
-std::array<float,2>{0.541320801f, 0.56767267f},
-std::array<float,2>{0.854277849f, 0.366487384f},
-std::array<float,2>{0.333468229f, 0.7603001f},
-std::array<float,2>{0.499902397f, 0.385729283f},
-std::array<float,2>{0.892735362f, 0.990860641f},
-std::array<float,2>{0.717869103f, 0.0425784588f},
-std::array<float,2>{0.168227971f, 0.668339014f},
-std::array<float,2>{0.244264081f, 0.253057688f},
-std::array<float,2>{0.677836657f, 0.843162477f},
-std::array<float,2>{0.979690492f, 0.208949372f},
-std::array<float,2>{0.436882049f, 0.514444947f},
-std::array<float,2>{0.25367403f, 0.0878205448f},
-std::array<float,2>{0.773188174f, 0.690309286f},
-std::array<float,2>{0.594257712f, 0.492446929f},
-std::array<float,2>{0.0426854454f, 0.911943734f},
-std::array<float,2>{0.235368714f, 0.14112322f},
-std::array<float,2>{0.682719231f, 0.590328753f},
-std::array<float,2>{0.969624102f, 0.351430655f},
-std::array<float,2>{0.428002208f, 0.776983142f},
-std::array<float,2>{0.265001178f, 0.399270862f},
-std::array<float,2>{0.780668974f, 0.969417274f},
-std::array<float,2>{0.606609523f, 0.0599009804f},
-std::array<float,2>{0.0332318135f, 0.680094242f},
-std::array<float,2>{0.09295059f, 0.269524395f},
-std::array<float,2>{0.536968887f, 0.824732482f},
-std::array<float,2>{0.849399388f, 0.190291598f},
-std::array<float,2>{0.338761419f, 0.52115339f},
-std::array<float,2>{0.490803391f, 0.0653446317f},
-std::array<float,2>{0.90431422f, 0.705009103f},
-std::array<float,2>{0.709311187f, 0.478213459f},
-std::array<float,2>{0.15975906f, 0.926082611f},
-std::array<float,2>{0.0243584234f, 0.0202479549f},
-std::array<float,2>{0.570545495f, 0.655700266f},
-std::array<float,2>{0.785165548f, 0.409300089f},
-std::array<float,2>{0.290800571f, 0.938477039f},
-std::array<float,2>{0.376918733f, 0.325808138f},
-std::array<float,2>{0.94557029f, 0.794448614f},
-std::array<float,2>{0.64901346f, 0.183091253f},
-std::array<float,2>{0.209532276f, 0.610752583f},
-std::array<float,2>{0.148755431f, 0.452653676f},
-std::array<float,2>{0.734362721f, 0.886492968f},
-std::array<float,2>{0.928771257f, 0.109561048f},
-std::array<float,2>{0.451012641f, 0.724820375f},
-std::array<float,2>{0.353692472f, 0.223727569f},
-std::array<float,2>{0.820615113f, 0.545206606f},
-std::array<float,2>{0.515622258f, 0.292292804f},
-std::array<float,2>{0.108201645f, 0.874906361f},
-std::array<float,2>{0.174838036f, 0.109281845f},
-std::array<float,2>{0.690648258f, 0.737664819f},
-std::array<float,2>{0.888340056f, 0.458351433f},
-std::array<float,2>{0.47035706f, 0.892017841f},
-std::array<float,2>{0.319856107f, 0.3017551f},
-std::array<float,2>{0.867003679f, 0.851942599f},
-std::array<float,2>{0.550415695f, 0.248703733f},
-std::array<float,2>{0.0644970611f, 0.553930223f},
-std::array<float,2>{0.0527063198f, 0.425211638f},
-std::array<float,2>{0.622955084f, 0.961411119f},
-std::array<float,2>{0.75248003f, 0.0029767931f},
-std::array<float,2>{0.269053459f, 0.626435757f},
-std::array<float,2>{0.421040028f, 0.169173807f},
-std::array<float,2>{0.994757235f, 0.598193824f},
-std::array<float,2>{0.663835287f, 0.333500564f},
-std::array<float,2>{0.22683534f, 0.801263273f},
-std::array<float,2>{0.118298054f, 0.203849122f},
-std::array<float,2>{0.530991256f, 0.510238945f},
-std::array<float,2>{0.828245878f, 0.255569905f},
-std::array<float,2>{0.36602509f, 0.837685049f},
-std::array<float,2>{0.457482636f, 0.497370154f},
-std::array<float,2>{0.9111076f, 0.9067083f},
-std::array<float,2>{0.740696549f, 0.0906776488f},
-std::array<float,2>{0.138163686f, 0.692214489f},
-std::array<float,2>{0.190038145f, 0.35959968f},
-std::array<float,2>{0.636324048f, 0.762969792f},
-std::array<float,2>{0.953279495f, 0.136900991f},
-std::array<float,2>{0.394643933f, 0.565891922f},
-std::array<float,2>{0.300769418f, 0.0446602851f},
-std::array<float,2>{0.799764752f, 0.664308906f},
-std::array<float,2>{0.593360364f, 0.389751792f},
-std::array<float,2>{0.000394994131f, 0.987899542f},
-std::array<float,2>{0.127381757f, 0.239055783f},
-std::array<float,2>{0.7424981f, 0.554916322f},
-std::array<float,2>{0.918036997f, 0.305733055f},
-std::array<float,2>{0.468470812f, 0.847203195f},
-std::array<float,2>{0.370737642f, 0.464876711f},
-std::array<float,2>{0.838224292f, 0.902658284f},
-std::array<float,2>{0.516970038f, 0.097180672f},
-std::array<float,2>{0.112023078f, 0.749877334f},
-std::array<float,2>{0.0142125934f, 0.339996606f},
-std::array<float,2>{0.583782077f, 0.811050534f},
-std::array<float,2>{0.805645287f, 0.160324663f},
-std::array<float,2>{0.306754649f, 0.607278228f},
-std::array<float,2>{0.402331442f, 0.0141623486f},
-std::array<float,2>{0.962234676f, 0.635509253f},
-std::array<float,2>{0.626606405f, 0.435034245f},
-std::array<float,2>{0.202151f, 0.955073953f},
-std::array<float,2>{0.073477596f, 0.079987064f},
-std::array<float,2>{0.560161889f, 0.697432935f},
-std::array<float,2>{0.872069001f, 0.488463134f},
-std::array<float,2>{0.322799146f, 0.915825844f},
-std::array<float,2>{0.479397893f, 0.263685793f},
-std::array<float,2>{0.880798817f, 0.828835368f},
-std::array<float,2>{0.700523794f, 0.2164772f},
-std::array<float,2>{0.183938548f, 0.502443492f},
-std::array<float,2>{0.226401463f, 0.382415324f},
-std::array<float,2>{0.664453328f, 0.995759487f},
-std::array<float,2>{0.989939034f, 0.038523145f},
-std::array<float,2>{0.410623729f, 0.66270864f},
-std::array<float,2>{0.275914103f, 0.130650789f},
-std::array<float,2>{0.761739492f, 0.576788723f},
-std::array<float,2>{0.612140179f, 0.369540155f},
-std::array<float,2>{0.0616871007f, 0.751897573f},
-std::array<float,2>{0.2133127f, 0.0540944561f},
-std::array<float,2>{0.646103621f, 0.677597046f},
-std::array<float,2>{0.940677404f, 0.395723253f},
-std::array<float,2>{0.388278782f, 0.978716016f},
-std::array<float,2>{0.281382471f, 0.353946596f},
-std::array<float,2>{0.794665813f, 0.771580696f},
-std::array<float,2>{0.565814257f, 0.153671369f},
-std::array<float,2>{0.0217065252f, 0.582985401f},
-std::array<float,2>{0.0970528051f, 0.47024551f},
-std::array<float,2>{0.507806718f, 0.932326019f},
-std::array<float,2>{0.814520121f, 0.0762433186f},
-std::array<float,2>{0.3478297f, 0.715332806f},
-std::array<float,2>{0.441305488f, 0.20249261f},
-std::array<float,2>{0.930703342f, 0.524363577f},
-std::array<float,2>{0.721033573f, 0.276040882f},
-std::array<float,2>{0.147315115f, 0.819858313f},
-std::array<float,2>{0.046338018f, 0.173672944f},
-std::array<float,2>{0.597693682f, 0.623928845f},
-std::array<float,2>{0.766153455f, 0.314012766f},
-std::array<float,2>{0.257724017f, 0.786598265f},
-std::array<float,2>{0.432750285f, 0.417119056f},
-std::array<float,2>{0.981457949f, 0.951607466f},
-std::array<float,2>{0.674751461f, 0.0247965362f},
-std::array<float,2>{0.247784629f, 0.645188332f},
-std::array<float,2>{0.167132884f, 0.288746506f},
-std::array<float,2>{0.714561284f, 0.863152504f},
-std::array<float,2>{0.897083163f, 0.228693709f},
-std::array<float,2>{0.493940681f, 0.538113475f},
-std::array<float,2>{0.33029747f, 0.118887782f},
-std::array<float,2>{0.857730508f, 0.726796508f},
-std::array<float,2>{0.546363711f, 0.439337164f},
-std::array<float,2>{0.0795300454f, 0.882745504f},
-std::array<float,2>{0.135337517f, 0.177480072f},
-std::array<float,2>{0.73803401f, 0.619914412f},
-std::array<float,2>{0.909051716f, 0.319940567f},
-std::array<float,2>{0.453260511f, 0.784551442f},
-std::array<float,2>{0.362918407f, 0.421465546f},
-std::array<float,2>{0.83262521f, 0.946191788f},
-std::array<float,2>{0.52462846f, 0.0303177666f},
-std::array<float,2>{0.121199958f, 0.64209646f},
-std::array<float,2>{0.00640865322f, 0.284697503f},
-std::array<float,2>{0.587498724f, 0.866780221f},
-std::array<float,2>{0.804107964f, 0.234107748f},
-std::array<float,2>{0.30425337f, 0.531908512f},
-std::array<float,2>{0.391648382f, 0.12214265f},
-std::array<float,2>{0.958963931f, 0.731328845f},
-std::array<float,2>{0.640594721f, 0.444211394f},
-std::array<float,2>{0.192695245f, 0.876743436f},
-std::array<float,2>{0.0670657158f, 0.0480027981f},
-std::array<float,2>{0.551967502f, 0.674485505f},
-std::array<float,2>{0.861853659f, 0.39238587f},
-std::array<float,2>{0.312782705f, 0.983628154f},
-std::array<float,2>{0.476257086f, 0.359102845f},
-std::array<float,2>{0.884123325f, 0.76908958f},
-std::array<float,2>{0.694188535f, 0.151078478f},
-std::array<float,2>{0.176767588f, 0.578490496f},
-std::array<float,2>{0.233588547f, 0.475683779f},
-std::array<float,2>{0.659864724f, 0.934067667f},
-std::array<float,2>{0.996113002f, 0.0737458915f},
-std::array<float,2>{0.417613059f, 0.712434053f},
-std::array<float,2>{0.272865653f, 0.196206793f},
-std::array<float,2>{0.754883409f, 0.52979058f},
-std::array<float,2>{0.619808435f, 0.278408706f},
-std::array<float,2>{0.0492465161f, 0.815799415f},
-std::array<float,2>{0.20439671f, 0.0841225162f},
-std::array<float,2>{0.654980719f, 0.700826585f},
-std::array<float,2>{0.950775564f, 0.488071918f},
-std::array<float,2>{0.380750895f, 0.920509875f},
-std::array<float,2>{0.295636088f, 0.25798279f},
-std::array<float,2>{0.781445324f, 0.835152328f},
-std::array<float,2>{0.576911569f, 0.2142061f},
-std::array<float,2>{0.0300262794f, 0.505143046f},
-std::array<float,2>{0.104761235f, 0.376806587f},
-std::array<float,2>{0.508411944f, 0.996187449f},
-std::array<float,2>{0.82606709f, 0.0326304212f},
-std::array<float,2>{0.357064664f, 0.658279002f},
-std::array<float,2>{0.446694314f, 0.126121968f},
-std::array<float,2>{0.922663987f, 0.574217975f},
-std::array<float,2>{0.730198085f, 0.374114335f},
-std::array<float,2>{0.152751803f, 0.756226778f},
-std::array<float,2>{0.0351603888f, 0.236484051f},
-std::array<float,2>{0.602262199f, 0.561444581f},
-std::array<float,2>{0.77608645f, 0.310072124f},
-std::array<float,2>{0.258979112f, 0.848561883f},
-std::array<float,2>{0.42522499f, 0.464410812f},
-std::array<float,2>{0.975573242f, 0.901439011f},
-std::array<float,2>{0.684441507f, 0.0997715369f},
-std::array<float,2>{0.241194993f, 0.745405138f},
-std::array<float,2>{0.161237285f, 0.338902861f},
-std::array<float,2>{0.704099953f, 0.807271302f},
-std::array<float,2>{0.901004314f, 0.158041999f},
-std::array<float,2>{0.48569575f, 0.603090346f},
-std::array<float,2>{0.342807949f, 0.0102833472f},
-std::array<float,2>{0.84483695f, 0.638570786f},
-std::array<float,2>{0.534613371f, 0.430417806f},
-std::array<float,2>{0.0869164392f, 0.960487723f},
-std::array<float,2>{0.243283764f, 0.207832634f},
-std::array<float,2>{0.675824106f, 0.515029311f},
-std::array<float,2>{0.977989316f, 0.252509236f},
-std::array<float,2>{0.434382409f, 0.841969132f},
-std::array<float,2>{0.250878125f, 0.494115263f},
-std::array<float,2>{0.77080667f, 0.910845041f},
-std::array<float,2>{0.595722735f, 0.0867470428f},
-std::array<float,2>{0.0408313945f, 0.690809429f},
-std::array<float,2>{0.0825355574f, 0.365749866f},
-std::array<float,2>{0.540703773f, 0.761457026f},
-std::array<float,2>{0.852641761f, 0.134237498f},
-std::array<float,2>{0.33464849f, 0.567238688f},
-std::array<float,2>{0.496650517f, 0.0412971675f},
-std::array<float,2>{0.89134407f, 0.669664502f},
-std::array<float,2>{0.714909792f, 0.38656044f},
-std::array<float,2>{0.170410007f, 0.992165387f},
-std::array<float,2>{0.0169486813f, 0.103773035f},
-std::array<float,2>{0.56791842f, 0.741156697f},
-std::array<float,2>{0.792201459f, 0.456340134f},
-std::array<float,2>{0.285434157f, 0.896965027f},
-std::array<float,2>{0.383762121f, 0.30075711f},
-std::array<float,2>{0.943356991f, 0.855591357f},
-std::array<float,2>{0.644242525f, 0.244130373f},
-std::array<float,2>{0.218187362f, 0.547023773f},
-std::array<float,2>{0.141101629f, 0.428473294f},
-std::array<float,2>{0.725854278f, 0.967568457f},
-std::array<float,2>{0.933656394f, 0.00696115056f},
-std::array<float,2>{0.443649709f, 0.629065394f},
-std::array<float,2>{0.345263541f, 0.164446026f},
-std::array<float,2>{0.818999827f, 0.597226143f},
-std::array<float,2>{0.503596246f, 0.331508696f},
-std::array<float,2>{0.0992752761f, 0.799851298f},
-std::array<float,2>{0.183228552f, 0.0177935176f},
-std::array<float,2>{0.696793854f, 0.650691986f},
-std::array<float,2>{0.875357389f, 0.412503898f},
-std::array<float,2>{0.482937634f, 0.942472219f},
-std::array<float,2>{0.328057855f, 0.320504546f},
-std::array<float,2>{0.868054807f, 0.791629791f},
-std::array<float,2>{0.558580935f, 0.187074706f},
-std::array<float,2>{0.0754706413f, 0.613437235f},
-std::array<float,2>{0.0551432893f, 0.448627293f},
-std::array<float,2>{0.615232229f, 0.888198495f},
-std::array<float,2>{0.758407593f, 0.113329515f},
-std::array<float,2>{0.278103203f, 0.718911171f},
-std::array<float,2>{0.407140553f, 0.22117728f},
-std::array<float,2>{0.987686694f, 0.542578101f},
-std::array<float,2>{0.670321584f, 0.29387942f},
-std::array<float,2>{0.221129492f, 0.869494319f},
-std::array<float,2>{0.11656297f, 0.145839512f},
-std::array<float,2>{0.5216254f, 0.586024106f},
-std::array<float,2>{0.841924012f, 0.346694499f},
-std::array<float,2>{0.372131348f, 0.777785718f},
-std::array<float,2>{0.463796705f, 0.405579299f},
-std::array<float,2>{0.914094687f, 0.973378479f},
-std::array<float,2>{0.748296082f, 0.0584753044f},
-std::array<float,2>{0.130485356f, 0.683646798f},
-std::array<float,2>{0.196680546f, 0.273259997f},
-std::array<float,2>{0.632580996f, 0.824009895f},
-std::array<float,2>{0.968410134f, 0.192920536f},
-std::array<float,2>{0.404733002f, 0.519530654f},
-std::array<float,2>{0.311428368f, 0.0691820681f},
-std::array<float,2>{0.809859157f, 0.708194554f},
-std::array<float,2>{0.581771612f, 0.480619103f},
-std::array<float,2>{0.00968403835f, 0.922022104f},
-std::array<float,2>{0.187656969f, 0.137824044f},
-std::array<float,2>{0.632963181f, 0.56536293f},
-std::array<float,2>{0.956992567f, 0.361140877f},
-std::array<float,2>{0.398238987f, 0.761910737f},
-std::array<float,2>{0.298120677f, 0.389096886f},
-std::array<float,2>{0.796967268f, 0.98650074f},
-std::array<float,2>{0.590729892f, 0.0433254056f},
-std::array<float,2>{0.00309741241f, 0.665168583f},
-std::array<float,2>{0.119179972f, 0.254216254f},
-std::array<float,2>{0.527641714f, 0.836786926f},
-std::array<float,2>{0.831431925f, 0.204978272f},
-std::array<float,2>{0.365081131f, 0.510797679f},
-std::array<float,2>{0.460211158f, 0.0915743113f},
-std::array<float,2>{0.913318396f, 0.693279564f},
-std::array<float,2>{0.739030957f, 0.496752203f},
-std::array<float,2>{0.139042288f, 0.907511532f},
-std::array<float,2>{0.0545782372f, 0.00205832929f},
-std::array<float,2>{0.623124421f, 0.625209868f},
-std::array<float,2>{0.751105905f, 0.424567491f},
-std::array<float,2>{0.265792131f, 0.962358534f},
-std::array<float,2>{0.418336719f, 0.332397729f},
-std::array<float,2>{0.99349761f, 0.801790297f},
-std::array<float,2>{0.661771417f, 0.168340579f},
-std::array<float,2>{0.228958353f, 0.599004149f},
-std::array<float,2>{0.172438204f, 0.457448035f},
-std::array<float,2>{0.688392997f, 0.890770078f},
-std::array<float,2>{0.890618742f, 0.108318083f},
-std::array<float,2>{0.471077144f, 0.73708874f},
-std::array<float,2>{0.318182915f, 0.249939859f},
-std::array<float,2>{0.864759982f, 0.552937269f},
-std::array<float,2>{0.548369944f, 0.302059293f},
-std::array<float,2>{0.0625587851f, 0.853115499f},
-std::array<float,2>{0.150855601f, 0.110959142f},
-std::array<float,2>{0.730927765f, 0.725826919f},
-std::array<float,2>{0.92770189f, 0.451974124f},
-std::array<float,2>{0.451655775f, 0.884825587f},
-std::array<float,2>{0.352081716f, 0.291394234f},
-std::array<float,2>{0.823774219f, 0.873610616f},
-std::array<float,2>{0.511762142f, 0.22318317f},
-std::array<float,2>{0.105929665f, 0.546610653f},
-std::array<float,2>{0.0257374737f, 0.408802778f},
-std::array<float,2>{0.572584748f, 0.938138247f},
-std::array<float,2>{0.788024724f, 0.0210637301f},
-std::array<float,2>{0.29213801f, 0.655128479f},
-std::array<float,2>{0.378689408f, 0.181963086f},
-std::array<float,2>{0.947792232f, 0.610033453f},
-std::array<float,2>{0.651885867f, 0.32436341f},
-std::array<float,2>{0.208908483f, 0.793310702f},
-std::array<float,2>{0.0910422057f, 0.190673262f},
-std::array<float,2>{0.537810743f, 0.520122468f},
-std::array<float,2>{0.851148963f, 0.268199623f},
-std::array<float,2>{0.337245643f, 0.825297773f},
-std::array<float,2>{0.488890797f, 0.477217883f},
-std::array<float,2>{0.902938128f, 0.927220762f},
-std::array<float,2>{0.708060384f, 0.0654706135f},
-std::array<float,2>{0.157067999f, 0.703248084f},
-std::array<float,2>{0.238092512f, 0.349653006f},
-std::array<float,2>{0.680321753f, 0.775637805f},
-std::array<float,2>{0.97103411f, 0.142094746f},
-std::array<float,2>{0.42582801f, 0.591750145f},
-std::array<float,2>{0.263590604f, 0.0588817783f},
-std::array<float,2>{0.778638542f, 0.681063771f},
-std::array<float,2>{0.608873785f, 0.400313318f},
-std::array<float,2>{0.0321565941f, 0.969976842f},
-std::array<float,2>{0.165017024f, 0.230433211f},
-std::array<float,2>{0.711429f, 0.537472665f},
-std::array<float,2>{0.89645493f, 0.287413269f},
-std::array<float,2>{0.494925648f, 0.861993074f},
-std::array<float,2>{0.329688162f, 0.438230753f},
-std::array<float,2>{0.855992019f, 0.881313324f},
-std::array<float,2>{0.543023169f, 0.117581911f},
-std::array<float,2>{0.0812521055f, 0.72785151f},
-std::array<float,2>{0.0437949933f, 0.312795371f},
-std::array<float,2>{0.599817276f, 0.785790861f},
-std::array<float,2>{0.768491507f, 0.171886578f},
-std::array<float,2>{0.254473418f, 0.624409318f},
-std::array<float,2>{0.431025684f, 0.0239130985f},
-std::array<float,2>{0.983064711f, 0.645956397f},
-std::array<float,2>{0.673254848f, 0.416500151f},
-std::array<float,2>{0.24917236f, 0.952902794f},
-std::array<float,2>{0.0952288732f, 0.0773888081f},
-std::array<float,2>{0.505439579f, 0.716606438f},
-std::array<float,2>{0.814390242f, 0.46875456f},
-std::array<float,2>{0.349873155f, 0.933459401f},
-std::array<float,2>{0.438332289f, 0.276418149f},
-std::array<float,2>{0.933578193f, 0.818828642f},
-std::array<float,2>{0.720490754f, 0.201176584f},
-std::array<float,2>{0.145362407f, 0.525170505f},
-std::array<float,2>{0.212737694f, 0.394647598f},
-std::array<float,2>{0.647278607f, 0.980168164f},
-std::array<float,2>{0.93852967f, 0.0532941297f},
-std::array<float,2>{0.38904655f, 0.676451325f},
-std::array<float,2>{0.283420593f, 0.152366713f},
-std::array<float,2>{0.795841634f, 0.583963633f},
-std::array<float,2>{0.564265609f, 0.355466366f},
-std::array<float,2>{0.0203694142f, 0.773193598f},
-std::array<float,2>{0.222681358f, 0.038029667f},
-std::array<float,2>{0.666211188f, 0.663606703f},
-std::array<float,2>{0.990829051f, 0.381407559f},
-std::array<float,2>{0.412194431f, 0.994795024f},
-std::array<float,2>{0.274514526f, 0.370704293f},
-std::array<float,2>{0.765048802f, 0.7509709f},
-std::array<float,2>{0.610057533f, 0.129636094f},
-std::array<float,2>{0.0601697266f, 0.577435017f},
-std::array<float,2>{0.0710124895f, 0.489999563f},
-std::array<float,2>{0.560658872f, 0.914798796f},
-std::array<float,2>{0.873594105f, 0.0788870826f},
-std::array<float,2>{0.320443839f, 0.698251307f},
-std::array<float,2>{0.477375895f, 0.214906827f},
-std::array<float,2>{0.882311046f, 0.503605008f},
-std::array<float,2>{0.703059494f, 0.264915109f},
-std::array<float,2>{0.187448904f, 0.829773545f},
-std::array<float,2>{0.0121882232f, 0.161444217f},
-std::array<float,2>{0.584901392f, 0.60567838f},
-std::array<float,2>{0.808040142f, 0.341710269f},
-std::array<float,2>{0.305670649f, 0.812373042f},
-std::array<float,2>{0.398438394f, 0.433797747f},
-std::array<float,2>{0.96326685f, 0.953596592f},
-std::array<float,2>{0.627053738f, 0.0150928162f},
-std::array<float,2>{0.200053483f, 0.636562169f},
-std::array<float,2>{0.126418307f, 0.305231303f},
-std::array<float,2>{0.74436003f, 0.84627682f},
-std::array<float,2>{0.921541333f, 0.23926194f},
-std::array<float,2>{0.465728521f, 0.555920601f},
-std::array<float,2>{0.367853463f, 0.0959505066f},
-std::array<float,2>{0.83778131f, 0.748084724f},
-std::array<float,2>{0.518419683f, 0.465996206f},
-std::array<float,2>{0.11087703f, 0.90386951f},
-std::array<float,2>{0.179560453f, 0.149659336f},
-std::array<float,2>{0.69272393f, 0.581271231f},
-std::array<float,2>{0.885388434f, 0.356241673f},
-std::array<float,2>{0.473602206f, 0.765886784f},
-std::array<float,2>{0.316372752f, 0.393204361f},
-std::array<float,2>{0.860451341f, 0.981031835f},
-std::array<float,2>{0.553986728f, 0.0499132201f},
-std::array<float,2>{0.0689301789f, 0.672028899f},
-std::array<float,2>{0.048233971f, 0.281184018f},
-std::array<float,2>{0.617966115f, 0.81422627f},
-std::array<float,2>{0.757281601f, 0.198986739f},
-std::array<float,2>{0.270364165f, 0.527698576f},
-std::array<float,2>{0.414200485f, 0.0715160072f},
-std::array<float,2>{0.999505579f, 0.714363039f},
-std::array<float,2>{0.657976627f, 0.473232746f},
-std::array<float,2>{0.232238874f, 0.937311471f},
-std::array<float,2>{0.124377906f, 0.0281699561f},
-std::array<float,2>{0.52674228f, 0.643538535f},
-std::array<float,2>{0.835044146f, 0.418765724f},
-std::array<float,2>{0.359596223f, 0.948123217f},
-std::array<float,2>{0.456807137f, 0.317011297f},
-std::array<float,2>{0.907328188f, 0.781407475f},
-std::array<float,2>{0.735231578f, 0.177791432f},
-std::array<float,2>{0.133829668f, 0.61730516f},
-std::array<float,2>{0.194172278f, 0.442060709f},
-std::array<float,2>{0.637682736f, 0.877207398f},
-std::array<float,2>{0.960089862f, 0.12414556f},
-std::array<float,2>{0.392923653f, 0.733661652f},
-std::array<float,2>{0.301691562f, 0.232240677f},
-std::array<float,2>{0.801110566f, 0.534427106f},
-std::array<float,2>{0.589284122f, 0.281900197f},
-std::array<float,2>{0.00555902626f, 0.863318622f},
-std::array<float,2>{0.239695802f, 0.0987051055f},
-std::array<float,2>{0.685584486f, 0.744053125f},
-std::array<float,2>{0.973198891f, 0.461841106f},
-std::array<float,2>{0.423401862f, 0.899353802f},
-std::array<float,2>{0.260453075f, 0.31158337f},
-std::array<float,2>{0.774540424f, 0.849762499f},
-std::array<float,2>{0.603776395f, 0.234510034f},
-std::array<float,2>{0.0380916186f, 0.55872947f},
-std::array<float,2>{0.0894612446f, 0.432538092f},
-std::array<float,2>{0.532359719f, 0.958220482f},
-std::array<float,2>{0.845778286f, 0.0087566264f},
-std::array<float,2>{0.341116339f, 0.639347136f},
-std::array<float,2>{0.487552911f, 0.159338489f},
-std::array<float,2>{0.899030507f, 0.604269147f},
-std::array<float,2>{0.705321431f, 0.337862134f},
-std::array<float,2>{0.163739726f, 0.805333674f},
-std::array<float,2>{0.0286245141f, 0.212874517f},
-std::array<float,2>{0.575573564f, 0.507639766f},
-std::array<float,2>{0.784094214f, 0.261359125f},
-std::array<float,2>{0.294847578f, 0.833286285f},
-std::array<float,2>{0.381213158f, 0.486032873f},
-std::array<float,2>{0.952513397f, 0.918006182f},
-std::array<float,2>{0.653809726f, 0.0825694576f},
-std::array<float,2>{0.205448374f, 0.702281296f},
-std::array<float,2>{0.155709341f, 0.372150838f},
-std::array<float,2>{0.728392959f, 0.755231082f},
-std::array<float,2>{0.924738526f, 0.127712607f},
-std::array<float,2>{0.448197216f, 0.572047412f},
-std::array<float,2>{0.35916689f, 0.0350132287f},
-std::array<float,2>{0.82811904f, 0.656845331f},
-std::array<float,2>{0.51009804f, 0.378733724f},
-std::array<float,2>{0.102253787f, 0.999810636f},
-std::array<float,2>{0.215411097f, 0.244891256f},
-std::array<float,2>{0.641695321f, 0.548874438f},
-std::array<float,2>{0.943548441f, 0.296918511f},
-std::array<float,2>{0.385641038f, 0.858188868f},
-std::array<float,2>{0.288147658f, 0.454702795f},
-std::array<float,2>{0.790862501f, 0.896413326f},
-std::array<float,2>{0.569126666f, 0.101971015f},
-std::array<float,2>{0.0176154338f, 0.73986423f},
-std::array<float,2>{0.101359054f, 0.329993039f},
-std::array<float,2>{0.501725137f, 0.797281563f},
-std::array<float,2>{0.816547871f, 0.167237103f},
-std::array<float,2>{0.347456694f, 0.594890952f},
-std::array<float,2>{0.441859365f, 0.00525723211f},
-std::array<float,2>{0.937259972f, 0.631547213f},
-std::array<float,2>{0.723922074f, 0.42633307f},
-std::array<float,2>{0.144409016f, 0.965879321f},
-std::array<float,2>{0.0417771153f, 0.0897196308f},
-std::array<float,2>{0.594870448f, 0.688127756f},
-std::array<float,2>{0.77192986f, 0.495637447f},
-std::array<float,2>{0.252394617f, 0.912186384f},
-std::array<float,2>{0.435921133f, 0.250479668f},
-std::array<float,2>{0.979490697f, 0.840771198f},
-std::array<float,2>{0.679684818f, 0.21003969f},
-std::array<float,2>{0.246086434f, 0.51174432f},
-std::array<float,2>{0.169529334f, 0.383372188f},
-std::array<float,2>{0.717753232f, 0.989219964f},
-std::array<float,2>{0.893874586f, 0.0407619029f},
-std::array<float,2>{0.498332947f, 0.671758294f},
-std::array<float,2>{0.332936108f, 0.135490477f},
-std::array<float,2>{0.855378866f, 0.568885624f},
-std::array<float,2>{0.542512476f, 0.363931865f},
-std::array<float,2>{0.0856910944f, 0.759342313f},
-std::array<float,2>{0.131317392f, 0.0564798936f},
-std::array<float,2>{0.746939182f, 0.686837673f},
-std::array<float,2>{0.916749835f, 0.402704716f},
-std::array<float,2>{0.462231308f, 0.976148963f},
-std::array<float,2>{0.373941779f, 0.344800174f},
-std::array<float,2>{0.840628982f, 0.780986309f},
-std::array<float,2>{0.519725144f, 0.146633342f},
-std::array<float,2>{0.114735253f, 0.589572608f},
-std::array<float,2>{0.0108074294f, 0.483713478f},
-std::array<float,2>{0.579114497f, 0.92487973f},
-std::array<float,2>{0.811329305f, 0.0671730861f},
-std::array<float,2>{0.30966112f, 0.709746242f},
-std::array<float,2>{0.402525365f, 0.194203988f},
-std::array<float,2>{0.965283394f, 0.517075002f},
-std::array<float,2>{0.630340695f, 0.270453662f},
-std::array<float,2>{0.198383912f, 0.821959734f},
-std::array<float,2>{0.0776996464f, 0.185480237f},
-std::array<float,2>{0.555583298f, 0.616774023f},
-std::array<float,2>{0.869586885f, 0.324042827f},
-std::array<float,2>{0.326005906f, 0.789565444f},
-std::array<float,2>{0.480568498f, 0.411975116f},
-std::array<float,2>{0.878516018f, 0.944495142f},
-std::array<float,2>{0.697929859f, 0.0162146129f},
-std::array<float,2>{0.181096211f, 0.649888933f},
-std::array<float,2>{0.220419288f, 0.295402586f},
-std::array<float,2>{0.668996513f, 0.867738605f},
-std::array<float,2>{0.985074461f, 0.219404593f},
-std::array<float,2>{0.408620477f, 0.540568769f},
-std::array<float,2>{0.280927569f, 0.117023289f},
-std::array<float,2>{0.761262596f, 0.721764088f},
-std::array<float,2>{0.616110325f, 0.447008044f},
-std::array<float,2>{0.0577163175f, 0.888746083f},
-std::array<float,2>{0.227849498f, 0.170017019f},
-std::array<float,2>{0.662376881f, 0.60127908f},
-std::array<float,2>{0.996037185f, 0.335809171f},
-std::array<float,2>{0.42082262f, 0.803859711f},
-std::array<float,2>{0.268315852f, 0.423068047f},
-std::array<float,2>{0.753111541f, 0.964141548f},
-std::array<float,2>{0.621300161f, 0.000340652623f},
-std::array<float,2>{0.0515118241f, 0.628500938f},
-std::array<float,2>{0.0656522587f, 0.304215461f},
-std::array<float,2>{0.549202383f, 0.855236828f},
-std::array<float,2>{0.866014898f, 0.246681139f},
-std::array<float,2>{0.318805665f, 0.551981032f},
-std::array<float,2>{0.469177455f, 0.106523618f},
-std::array<float,2>{0.887361526f, 0.734569192f},
-std::array<float,2>{0.689488351f, 0.460925639f},
-std::array<float,2>{0.174090981f, 0.893322468f},
-std::array<float,2>{0.00118272414f, 0.0468032546f},
-std::array<float,2>{0.592242181f, 0.666362882f},
-std::array<float,2>{0.800393105f, 0.387531698f},
-std::array<float,2>{0.299381077f, 0.986235738f},
-std::array<float,2>{0.396094382f, 0.363010794f},
-std::array<float,2>{0.954899371f, 0.763676465f},
-std::array<float,2>{0.635567427f, 0.140211195f},
-std::array<float,2>{0.190982133f, 0.563889682f},
-std::array<float,2>{0.137473688f, 0.499204993f},
-std::array<float,2>{0.741544068f, 0.908348262f},
-std::array<float,2>{0.91205889f, 0.0928158611f},
-std::array<float,2>{0.458709508f, 0.695074081f},
-std::array<float,2>{0.366212577f, 0.206821635f},
-std::array<float,2>{0.82979852f, 0.509382129f},
-std::array<float,2>{0.530209899f, 0.256272018f},
-std::array<float,2>{0.117268719f, 0.838262975f},
-std::array<float,2>{0.158790648f, 0.0636964291f},
-std::array<float,2>{0.710725963f, 0.705389738f},
-std::array<float,2>{0.905557513f, 0.479668468f},
-std::array<float,2>{0.491364747f, 0.928077221f},
-std::array<float,2>{0.339598358f, 0.267347187f},
-std::array<float,2>{0.84858346f, 0.827497303f},
-std::array<float,2>{0.535498321f, 0.188221142f},
-std::array<float,2>{0.0926703215f, 0.523305118f},
-std::array<float,2>{0.0342820808f, 0.401975721f},
-std::array<float,2>{0.606368959f, 0.9722808f},
-std::array<float,2>{0.780131936f, 0.0614871979f},
-std::array<float,2>{0.26456973f, 0.683183193f},
-std::array<float,2>{0.429151326f, 0.14270778f},
-std::array<float,2>{0.970280588f, 0.59191674f},
-std::array<float,2>{0.682480872f, 0.349018902f},
-std::array<float,2>{0.235288918f, 0.775286376f},
-std::array<float,2>{0.108536325f, 0.225133032f},
-std::array<float,2>{0.51393491f, 0.544047773f},
-std::array<float,2>{0.821341038f, 0.290120095f},
-std::array<float,2>{0.354668945f, 0.871626496f},
-std::array<float,2>{0.449293166f, 0.449895799f},
-std::array<float,2>{0.927847385f, 0.883788586f},
-std::array<float,2>{0.732960761f, 0.112467125f},
-std::array<float,2>{0.149537057f, 0.723358214f},
-std::array<float,2>{0.210210443f, 0.328106195f},
-std::array<float,2>{0.649786413f, 0.795682132f},
-std::array<float,2>{0.94703114f, 0.179901466f},
-std::array<float,2>{0.375824988f, 0.612107694f},
-std::array<float,2>{0.290008694f, 0.0224720277f},
-std::array<float,2>{0.78659308f, 0.654061139f},
-std::array<float,2>{0.571336806f, 0.40668115f},
-std::array<float,2>{0.0246438235f, 0.939546764f},
-std::array<float,2>{0.147766724f, 0.199560195f},
-std::array<float,2>{0.721723676f, 0.527101934f},
-std::array<float,2>{0.930244982f, 0.274053246f},
-std::array<float,2>{0.439870447f, 0.817211449f},
-std::array<float,2>{0.349179566f, 0.472528964f},
-std::array<float,2>{0.816188991f, 0.931003511f},
-std::array<float,2>{0.506416738f, 0.0750624463f},
-std::array<float,2>{0.0966709107f, 0.718521774f},
-std::array<float,2>{0.0234033577f, 0.352793604f},
-std::array<float,2>{0.564810276f, 0.770910442f},
-std::array<float,2>{0.793425322f, 0.155408025f},
-std::array<float,2>{0.28249374f, 0.584881723f},
-std::array<float,2>{0.387416422f, 0.051478114f},
-std::array<float,2>{0.93949908f, 0.678704619f},
-std::array<float,2>{0.644754827f, 0.398277819f},
-std::array<float,2>{0.214808673f, 0.978501678f},
-std::array<float,2>{0.0789214671f, 0.120395653f},
-std::array<float,2>{0.545431256f, 0.72984308f},
-std::array<float,2>{0.859239638f, 0.440819532f},
-std::array<float,2>{0.331663847f, 0.880760133f},
-std::array<float,2>{0.493146598f, 0.286023468f},
-std::array<float,2>{0.898292542f, 0.861270249f},
-std::array<float,2>{0.713715076f, 0.227492511f},
-std::array<float,2>{0.16603522f, 0.536812186f},
-std::array<float,2>{0.246677443f, 0.41476354f},
-std::array<float,2>{0.675536036f, 0.95093888f},
-std::array<float,2>{0.98124212f, 0.0262570269f},
-std::array<float,2>{0.431683302f, 0.647710025f},
-std::array<float,2>{0.256757706f, 0.173883304f},
-std::array<float,2>{0.766747057f, 0.621879995f},
-std::array<float,2>{0.599208236f, 0.314794958f},
-std::array<float,2>{0.0454174392f, 0.787836969f},
-std::array<float,2>{0.201578349f, 0.0126005579f},
-std::array<float,2>{0.625952899f, 0.634755135f},
-std::array<float,2>{0.961512148f, 0.437078655f},
-std::array<float,2>{0.400723338f, 0.955425322f},
-std::array<float,2>{0.308131963f, 0.342351466f},
-std::array<float,2>{0.80618f, 0.809616983f},
-std::array<float,2>{0.582348645f, 0.163036034f},
-std::array<float,2>{0.0147002768f, 0.609195769f},
-std::array<float,2>{0.113068469f, 0.468138635f},
-std::array<float,2>{0.516284883f, 0.904762506f},
-std::array<float,2>{0.839697897f, 0.0952723324f},
-std::array<float,2>{0.36972627f, 0.746966064f},
-std::array<float,2>{0.467644453f, 0.241504088f},
-std::array<float,2>{0.918987513f, 0.558249414f},
-std::array<float,2>{0.743606269f, 0.307298154f},
-std::array<float,2>{0.128398463f, 0.844578981f},
-std::array<float,2>{0.0606359951f, 0.131680235f},
-std::array<float,2>{0.612383187f, 0.57585144f},
-std::array<float,2>{0.76358372f, 0.368316084f},
-std::array<float,2>{0.276445299f, 0.751991987f},
-std::array<float,2>{0.411354363f, 0.380167693f},
-std::array<float,2>{0.988564372f, 0.993801355f},
-std::array<float,2>{0.665200889f, 0.0362618826f},
-std::array<float,2>{0.224761218f, 0.661657453f},
-std::array<float,2>{0.184843794f, 0.262843668f},
-std::array<float,2>{0.700148582f, 0.830473006f},
-std::array<float,2>{0.878997564f, 0.21728611f},
-std::array<float,2>{0.479978055f, 0.501589775f},
-std::array<float,2>{0.323703617f, 0.0811918154f},
-std::array<float,2>{0.872344553f, 0.696733296f},
-std::array<float,2>{0.558886468f, 0.490599155f},
-std::array<float,2>{0.0728760064f, 0.917496264f},
-std::array<float,2>{0.138849169f, 0.139042392f},
-std::array<float,2>{0.738948822f, 0.563383102f},
-std::array<float,2>{0.913528681f, 0.36188221f},
-std::array<float,2>{0.460102081f, 0.764768004f},
-std::array<float,2>{0.364806086f, 0.38833496f},
-std::array<float,2>{0.831225395f, 0.984651923f},
-std::array<float,2>{0.527533889f, 0.0457801558f},
-std::array<float,2>{0.119535275f, 0.667651296f},
-std::array<float,2>{0.00322244992f, 0.257237852f},
-std::array<float,2>{0.59047699f, 0.839315414f},
-std::array<float,2>{0.797230244f, 0.205601305f},
-std::array<float,2>{0.29797712f, 0.508084059f},
-std::array<float,2>{0.398036063f, 0.0920143649f},
-std::array<float,2>{0.956602275f, 0.694113374f},
-std::array<float,2>{0.633075535f, 0.498511076f},
-std::array<float,2>{0.187892243f, 0.909749389f},
-std::array<float,2>{0.0628897622f, 0.0010645783f},
-std::array<float,2>{0.548642457f, 0.627841175f},
-std::array<float,2>{0.865072191f, 0.422769278f},
-std::array<float,2>{0.317976147f, 0.963095188f},
-std::array<float,2>{0.47070843f, 0.334674776f},
-std::array<float,2>{0.890327513f, 0.803690732f},
-std::array<float,2>{0.688028812f, 0.171550587f},
-std::array<float,2>{0.172689021f, 0.600282311f},
-std::array<float,2>{0.228711665f, 0.459235072f},
-std::array<float,2>{0.662108779f, 0.894167602f},
-std::array<float,2>{0.993257582f, 0.106105223f},
-std::array<float,2>{0.418114066f, 0.735434949f},
-std::array<float,2>{0.265974104f, 0.247105822f},
-std::array<float,2>{0.751339495f, 0.551747918f},
-std::array<float,2>{0.623292565f, 0.302895755f},
-std::array<float,2>{0.0541998334f, 0.854335606f},
-std::array<float,2>{0.208631113f, 0.112211645f},
-std::array<float,2>{0.652278602f, 0.724060357f},
-std::array<float,2>{0.948230386f, 0.450848401f},
-std::array<float,2>{0.378498763f, 0.884715915f},
-std::array<float,2>{0.292367637f, 0.289403141f},
-std::array<float,2>{0.787792623f, 0.872398794f},
-std::array<float,2>{0.572391093f, 0.22589989f},
-std::array<float,2>{0.0256081689f, 0.543165267f},
-std::array<float,2>{0.10565123f, 0.408021212f},
-std::array<float,2>{0.512120903f, 0.941088378f},
-std::array<float,2>{0.824083865f, 0.0224403758f},
-std::array<float,2>{0.352506906f, 0.653165162f},
-std::array<float,2>{0.451176822f, 0.180838645f},
-std::array<float,2>{0.927427828f, 0.613053739f},
-std::array<float,2>{0.730701566f, 0.326326609f},
-std::array<float,2>{0.150565267f, 0.79649049f},
-std::array<float,2>{0.0317991115f, 0.188482314f},
-std::array<float,2>{0.608590066f, 0.521674275f},
-std::array<float,2>{0.778454304f, 0.265988648f},
-std::array<float,2>{0.263315618f, 0.826958776f},
-std::array<float,2>{0.42609036f, 0.478687167f},
-std::array<float,2>{0.970805764f, 0.92954123f},
-std::array<float,2>{0.680573165f, 0.0629913434f},
-std::array<float,2>{0.237974614f, 0.706216633f},
-std::array<float,2>{0.156820476f, 0.3481628f},
-std::array<float,2>{0.708279014f, 0.774204254f},
-std::array<float,2>{0.903243303f, 0.143986002f},
-std::array<float,2>{0.489181638f, 0.592811346f},
-std::array<float,2>{0.337053031f, 0.0618952364f},
-std::array<float,2>{0.851412296f, 0.682056665f},
-std::array<float,2>{0.5380463f, 0.401106119f},
-std::array<float,2>{0.0911638364f, 0.971300602f},
-std::array<float,2>{0.249403998f, 0.228023842f},
-std::array<float,2>{0.67301935f, 0.535302639f},
-std::array<float,2>{0.9831599f, 0.286415249f},
-std::array<float,2>{0.430868745f, 0.859565496f},
-std::array<float,2>{0.25475049f, 0.440379113f},
-std::array<float,2>{0.768116474f, 0.879328907f},
-std::array<float,2>{0.599964261f, 0.119742952f},
-std::array<float,2>{0.0436919108f, 0.728986919f},
-std::array<float,2>{0.0813675672f, 0.316392511f},
-std::array<float,2>{0.543272674f, 0.788668811f},
-std::array<float,2>{0.856268883f, 0.175070211f},
-std::array<float,2>{0.330070615f, 0.622298896f},
-std::array<float,2>{0.494652301f, 0.0272746459f},
-std::array<float,2>{0.896076024f, 0.646674514f},
-std::array<float,2>{0.711772442f, 0.415561169f},
-std::array<float,2>{0.164703384f, 0.949851394f},
-std::array<float,2>{0.0201098584f, 0.0761709139f},
-std::array<float,2>{0.564098477f, 0.717048526f},
-std::array<float,2>{0.795600832f, 0.471067458f},
-std::array<float,2>{0.2835702f, 0.930161238f},
-std::array<float,2>{0.388834953f, 0.275137454f},
-std::array<float,2>{0.938893437f, 0.817710459f},
-std::array<float,2>{0.647034645f, 0.200674951f},
-std::array<float,2>{0.212627202f, 0.525932491f},
-std::array<float,2>{0.145195171f, 0.396954f},
-std::array<float,2>{0.720223486f, 0.977377951f},
-std::array<float,2>{0.933138072f, 0.0526291542f},
-std::array<float,2>{0.438174814f, 0.679480076f},
-std::array<float,2>{0.349814445f, 0.155202031f},
-std::array<float,2>{0.813981831f, 0.585858643f},
-std::array<float,2>{0.505641639f, 0.351709872f},
-std::array<float,2>{0.0956787318f, 0.77011317f},
-std::array<float,2>{0.187080577f, 0.0359181315f},
-std::array<float,2>{0.702713132f, 0.660390377f},
-std::array<float,2>{0.881940484f, 0.379503608f},
-std::array<float,2>{0.477197289f, 0.992274821f},
-std::array<float,2>{0.320700586f, 0.36736092f},
-std::array<float,2>{0.873865724f, 0.753419578f},
-std::array<float,2>{0.560952723f, 0.132050395f},
-std::array<float,2>{0.0710551813f, 0.57432574f},
-std::array<float,2>{0.0605222918f, 0.491534621f},
-std::array<float,2>{0.610177398f, 0.916164041f},
-std::array<float,2>{0.764798999f, 0.080782108f},
-std::array<float,2>{0.274849266f, 0.695511699f},
-std::array<float,2>{0.412420809f, 0.218170598f},
-std::array<float,2>{0.991110981f, 0.500296712f},
-std::array<float,2>{0.666396618f, 0.262245834f},
-std::array<float,2>{0.222921446f, 0.831068158f},
-std::array<float,2>{0.111321598f, 0.163135484f},
-std::array<float,2>{0.518178225f, 0.608314872f},
-std::array<float,2>{0.837504745f, 0.343258619f},
-std::array<float,2>{0.36815834f, 0.809016109f},
-std::array<float,2>{0.465429634f, 0.435833007f},
-std::array<float,2>{0.921766877f, 0.956952751f},
-std::array<float,2>{0.744413257f, 0.0131983785f},
-std::array<float,2>{0.126161978f, 0.632834375f},
-std::array<float,2>{0.199723348f, 0.307910234f},
-std::array<float,2>{0.627205133f, 0.845535994f},
-std::array<float,2>{0.962964416f, 0.241001755f},
-std::array<float,2>{0.39871788f, 0.557381749f},
-std::array<float,2>{0.306051791f, 0.0943722874f},
-std::array<float,2>{0.807736516f, 0.747348547f},
-std::array<float,2>{0.584529042f, 0.467182785f},
-std::array<float,2>{0.0117437746f, 0.905528605f},
-std::array<float,2>{0.192603424f, 0.179511562f},
-std::array<float,2>{0.640258014f, 0.619125962f},
-std::array<float,2>{0.958587408f, 0.317739159f},
-std::array<float,2>{0.39190048f, 0.782286108f},
-std::array<float,2>{0.304458499f, 0.418997705f},
-std::array<float,2>{0.803718507f, 0.949206352f},
-std::array<float,2>{0.5877406f, 0.0290704444f},
-std::array<float,2>{0.00667920616f, 0.644197106f},
-std::array<float,2>{0.121392295f, 0.282262862f},
-std::array<float,2>{0.524679244f, 0.864473343f},
-std::array<float,2>{0.833006144f, 0.230966032f},
-std::array<float,2>{0.363186926f, 0.533408999f},
-std::array<float,2>{0.453480303f, 0.123896457f},
-std::array<float,2>{0.908704758f, 0.733219445f},
-std::array<float,2>{0.738076627f, 0.442893714f},
-std::array<float,2>{0.13565211f, 0.878336608f},
-std::array<float,2>{0.0488439016f, 0.0497323684f},
-std::array<float,2>{0.620071173f, 0.673274934f},
-std::array<float,2>{0.755127788f, 0.393804491f},
-std::array<float,2>{0.272585362f, 0.9820171f},
-std::array<float,2>{0.417900115f, 0.356901646f},
-std::array<float,2>{0.996401072f, 0.766790748f},
-std::array<float,2>{0.660084605f, 0.149340078f},
-std::array<float,2>{0.233760476f, 0.580569923f},
-std::array<float,2>{0.17700693f, 0.474168211f},
-std::array<float,2>{0.693958342f, 0.935719609f},
-std::array<float,2>{0.883834183f, 0.0710294321f},
-std::array<float,2>{0.476330072f, 0.712966144f},
-std::array<float,2>{0.31254527f, 0.197864622f},
-std::array<float,2>{0.86224395f, 0.528909624f},
-std::array<float,2>{0.552124739f, 0.280260533f},
-std::array<float,2>{0.0672111362f, 0.813082337f},
-std::array<float,2>{0.152476847f, 0.0831184238f},
-std::array<float,2>{0.730289996f, 0.701817095f},
-std::array<float,2>{0.922425091f, 0.484777808f},
-std::array<float,2>{0.446416706f, 0.919175684f},
-std::array<float,2>{0.357368737f, 0.260050446f},
-std::array<float,2>{0.825889349f, 0.832824171f},
-std::array<float,2>{0.508546591f, 0.211288229f},
-std::array<float,2>{0.104546778f, 0.506687999f},
-std::array<float,2>{0.030151315f, 0.377040863f},
-std::array<float,2>{0.576778114f, 0.998879969f},
-std::array<float,2>{0.781701088f, 0.0339727886f},
-std::array<float,2>{0.295690268f, 0.657875001f},
-std::array<float,2>{0.380506873f, 0.128025651f},
-std::array<float,2>{0.950992107f, 0.571095943f},
-std::array<float,2>{0.655103207f, 0.371498227f},
-std::array<float,2>{0.204246402f, 0.754519701f},
-std::array<float,2>{0.0871826783f, 0.23614049f},
-std::array<float,2>{0.534273922f, 0.560135365f},
-std::array<float,2>{0.845172405f, 0.310921162f},
-std::array<float,2>{0.343067616f, 0.85144335f},
-std::array<float,2>{0.4854922f, 0.46278882f},
-std::array<float,2>{0.901133835f, 0.900097728f},
-std::array<float,2>{0.703756273f, 0.0979568958f},
-std::array<float,2>{0.16150631f, 0.74262023f},
-std::array<float,2>{0.240930393f, 0.336801022f},
-std::array<float,2>{0.684095621f, 0.806385994f},
-std::array<float,2>{0.975264549f, 0.158565909f},
-std::array<float,2>{0.425022274f, 0.604604423f},
-std::array<float,2>{0.259112567f, 0.00933533348f},
-std::array<float,2>{0.776132464f, 0.64043957f},
-std::array<float,2>{0.602298796f, 0.43336457f},
-std::array<float,2>{0.035466738f, 0.957037151f},
-std::array<float,2>{0.170110673f, 0.209133208f},
-std::array<float,2>{0.71513468f, 0.513585925f},
-std::array<float,2>{0.891367078f, 0.251633763f},
-std::array<float,2>{0.497021586f, 0.841471493f},
-std::array<float,2>{0.334912241f, 0.495029092f},
-std::array<float,2>{0.852898419f, 0.913802087f},
-std::array<float,2>{0.540890098f, 0.0885896012f},
-std::array<float,2>{0.0829392076f, 0.689234555f},
-std::array<float,2>{0.0407657884f, 0.364679903f},
-std::array<float,2>{0.596155465f, 0.758509398f},
-std::array<float,2>{0.770590723f, 0.136605725f},
-std::array<float,2>{0.250550658f, 0.570161819f},
-std::array<float,2>{0.434160411f, 0.0397929139f},
-std::array<float,2>{0.977663755f, 0.670116663f},
-std::array<float,2>{0.676163077f, 0.38436535f},
-std::array<float,2>{0.243518621f, 0.989839196f},
-std::array<float,2>{0.0994303077f, 0.102756232f},
-std::array<float,2>{0.503800333f, 0.738293171f},
-std::array<float,2>{0.819234252f, 0.453143477f},
-std::array<float,2>{0.345497996f, 0.895462215f},
-std::array<float,2>{0.443504512f, 0.298362255f},
-std::array<float,2>{0.933890522f, 0.859178782f},
-std::array<float,2>{0.72567147f, 0.245636046f},
-std::array<float,2>{0.140820578f, 0.550082624f},
-std::array<float,2>{0.217965767f, 0.42740494f},
-std::array<float,2>{0.644374371f, 0.964889586f},
-std::array<float,2>{0.942930281f, 0.00453816215f},
-std::array<float,2>{0.383315533f, 0.632217348f},
-std::array<float,2>{0.285358042f, 0.166742206f},
-std::array<float,2>{0.792277038f, 0.594457209f},
-std::array<float,2>{0.568251252f, 0.328393906f},
-std::array<float,2>{0.0166351814f, 0.798767984f},
-std::array<float,2>{0.220797881f, 0.017340662f},
-std::array<float,2>{0.670021117f, 0.649369001f},
-std::array<float,2>{0.987507164f, 0.410889804f},
-std::array<float,2>{0.406961054f, 0.943726897f},
-std::array<float,2>{0.278031886f, 0.322611719f},
-std::array<float,2>{0.758577645f, 0.790234387f},
-std::array<float,2>{0.61475879f, 0.184283495f},
-std::array<float,2>{0.0548717976f, 0.616074741f},
-std::array<float,2>{0.0752284974f, 0.445470065f},
-std::array<float,2>{0.55820471f, 0.890274107f},
-std::array<float,2>{0.867680728f, 0.115673468f},
-std::array<float,2>{0.327834368f, 0.721582651f},
-std::array<float,2>{0.483375877f, 0.220462456f},
-std::array<float,2>{0.875007689f, 0.539711952f},
-std::array<float,2>{0.697049499f, 0.295947582f},
-std::array<float,2>{0.183492094f, 0.868931651f},
-std::array<float,2>{0.00942863431f, 0.14778176f},
-std::array<float,2>{0.581940174f, 0.588358045f},
-std::array<float,2>{0.809779286f, 0.343849242f},
-std::array<float,2>{0.311252296f, 0.779879808f},
-std::array<float,2>{0.404475302f, 0.404187143f},
-std::array<float,2>{0.968659282f, 0.975362897f},
-std::array<float,2>{0.632485032f, 0.0551143363f},
-std::array<float,2>{0.196313962f, 0.68623209f},
-std::array<float,2>{0.130845919f, 0.271048874f},
-std::array<float,2>{0.748171329f, 0.820454836f},
-std::array<float,2>{0.914343238f, 0.194410563f},
-std::array<float,2>{0.463585198f, 0.516014993f},
-std::array<float,2>{0.372391254f, 0.0675853193f},
-std::array<float,2>{0.842047155f, 0.710407317f},
-std::array<float,2>{0.52188158f, 0.482696742f},
-std::array<float,2>{0.116335891f, 0.924490392f},
-std::array<float,2>{0.173900723f, 0.169554815f},
-std::array<float,2>{0.68974936f, 0.59807688f},
-std::array<float,2>{0.887463093f, 0.333367974f},
-std::array<float,2>{0.468932807f, 0.801628709f},
-std::array<float,2>{0.31844148f, 0.425379604f},
-std::array<float,2>{0.865866959f, 0.961875081f},
-std::array<float,2>{0.549036384f, 0.00370088918f},
-std::array<float,2>{0.0657904297f, 0.626533985f},
-std::array<float,2>{0.0516202375f, 0.30084914f},
-std::array<float,2>{0.621535659f, 0.852232456f},
-std::array<float,2>{0.753287494f, 0.248468056f},
-std::array<float,2>{0.268102437f, 0.554244459f},
-std::array<float,2>{0.420618504f, 0.10845761f},
-std::array<float,2>{0.995768249f, 0.737887442f},
-std::array<float,2>{0.66218245f, 0.458967149f},
-std::array<float,2>{0.227774426f, 0.89221257f},
-std::array<float,2>{0.11749877f, 0.0440451987f},
-std::array<float,2>{0.529929042f, 0.664904356f},
-std::array<float,2>{0.830013633f, 0.390491575f},
-std::array<float,2>{0.366676986f, 0.987567961f},
-std::array<float,2>{0.458799928f, 0.360161334f},
-std::array<float,2>{0.911757886f, 0.763628483f},
-std::array<float,2>{0.74136132f, 0.137221307f},
-std::array<float,2>{0.137307256f, 0.566376686f},
-std::array<float,2>{0.191251278f, 0.497748107f},
-std::array<float,2>{0.635321021f, 0.907015383f},
-std::array<float,2>{0.95481199f, 0.0900653079f},
-std::array<float,2>{0.396292806f, 0.691703022f},
-std::array<float,2>{0.299669683f, 0.203228086f},
-std::array<float,2>{0.800739706f, 0.510287225f},
-std::array<float,2>{0.591797054f, 0.255297601f},
-std::array<float,2>{0.00129357167f, 0.837340713f},
-std::array<float,2>{0.235081002f, 0.0646101758f},
-std::array<float,2>{0.682325065f, 0.704355836f},
-std::array<float,2>{0.97053653f, 0.477548748f},
-std::array<float,2>{0.428737909f, 0.926366329f},
-std::array<float,2>{0.264378905f, 0.268775105f},
-std::array<float,2>{0.779934108f, 0.824662745f},
-std::array<float,2>{0.60611552f, 0.189488634f},
-std::array<float,2>{0.0345738754f, 0.520846665f},
-std::array<float,2>{0.092381686f, 0.398618639f},
-std::array<float,2>{0.535383284f, 0.968770504f},
-std::array<float,2>{0.848316491f, 0.0603720844f},
-std::array<float,2>{0.339720398f, 0.680190563f},
-std::array<float,2>{0.491669744f, 0.140896559f},
-std::array<float,2>{0.905449808f, 0.590349495f},
-std::array<float,2>{0.710684896f, 0.350959778f},
-std::array<float,2>{0.15897724f, 0.776689887f},
-std::array<float,2>{0.0248634703f, 0.224513367f},
-std::array<float,2>{0.571698487f, 0.545726717f},
-std::array<float,2>{0.786335528f, 0.292512625f},
-std::array<float,2>{0.289656878f, 0.874191999f},
-std::array<float,2>{0.375552714f, 0.4526366f},
-std::array<float,2>{0.946969032f, 0.886061788f},
-std::array<float,2>{0.649600506f, 0.11002899f},
-std::array<float,2>{0.210045516f, 0.725265503f},
-std::array<float,2>{0.149687797f, 0.325342327f},
-std::array<float,2>{0.733359933f, 0.794132233f},
-std::array<float,2>{0.928107202f, 0.183357224f},
-std::array<float,2>{0.449625731f, 0.611029208f},
-std::array<float,2>{0.354902118f, 0.0196197182f},
-std::array<float,2>{0.821621954f, 0.655849874f},
-std::array<float,2>{0.51379019f, 0.409690946f},
-std::array<float,2>{0.108676605f, 0.939096034f},
-std::array<float,2>{0.214466602f, 0.202689722f},
-std::array<float,2>{0.644985139f, 0.523871005f},
-std::array<float,2>{0.939871967f, 0.275748879f},
-std::array<float,2>{0.387573451f, 0.81966424f},
-std::array<float,2>{0.282297373f, 0.470130056f},
-std::array<float,2>{0.793184102f, 0.931659818f},
-std::array<float,2>{0.564583182f, 0.0769409463f},
-std::array<float,2>{0.0231406316f, 0.715255082f},
-std::array<float,2>{0.096310474f, 0.354351938f},
-std::array<float,2>{0.506721973f, 0.772447228f},
-std::array<float,2>{0.816018283f, 0.153905585f},
-std::array<float,2>{0.349421829f, 0.582049191f},
-std::array<float,2>{0.43948105f, 0.0545783564f},
-std::array<float,2>{0.930451512f, 0.677086532f},
-std::array<float,2>{0.722018898f, 0.396286398f},
-std::array<float,2>{0.147483185f, 0.979401767f},
-std::array<float,2>{0.0457310453f, 0.118404567f},
-std::array<float,2>{0.599494576f, 0.727257252f},
-std::array<float,2>{0.766951263f, 0.438928455f},
-std::array<float,2>{0.256519973f, 0.882283688f},
-std::array<float,2>{0.432002932f, 0.288495332f},
-std::array<float,2>{0.980992019f, 0.862446249f},
-std::array<float,2>{0.67571187f, 0.229281962f},
-std::array<float,2>{0.247051582f, 0.538814485f},
-std::array<float,2>{0.166404665f, 0.417639881f},
-std::array<float,2>{0.713595092f, 0.952062488f},
-std::array<float,2>{0.897958577f, 0.024939606f},
-std::array<float,2>{0.492683351f, 0.644771993f},
-std::array<float,2>{0.331933945f, 0.173311755f},
-std::array<float,2>{0.859108925f, 0.623187959f},
-std::array<float,2>{0.545678616f, 0.313901186f},
-std::array<float,2>{0.0787016004f, 0.786772132f},
-std::array<float,2>{0.127989367f, 0.0141441673f},
-std::array<float,2>{0.743190885f, 0.635089755f},
-std::array<float,2>{0.919390261f, 0.435449004f},
-std::array<float,2>{0.467442721f, 0.954313099f},
-std::array<float,2>{0.369906873f, 0.340783268f},
-std::array<float,2>{0.839531004f, 0.810865879f},
-std::array<float,2>{0.516459584f, 0.160937771f},
-std::array<float,2>{0.112839684f, 0.606556892f},
-std::array<float,2>{0.0151359662f, 0.465459526f},
-std::array<float,2>{0.582258701f, 0.903180599f},
-std::array<float,2>{0.806489468f, 0.096874401f},
-std::array<float,2>{0.30847916f, 0.749411404f},
-std::array<float,2>{0.400622219f, 0.238350704f},
-std::array<float,2>{0.961825907f, 0.555419266f},
-std::array<float,2>{0.625609219f, 0.306438804f},
-std::array<float,2>{0.201314539f, 0.847123802f},
-std::array<float,2>{0.0731049925f, 0.130363137f},
-std::array<float,2>{0.558744848f, 0.576474965f},
-std::array<float,2>{0.872220755f, 0.369993865f},
-std::array<float,2>{0.323312312f, 0.751252413f},
-std::array<float,2>{0.479517341f, 0.382268399f},
-std::array<float,2>{0.879285097f, 0.995426238f},
-std::array<float,2>{0.69978708f, 0.0390469506f},
-std::array<float,2>{0.184784949f, 0.662385762f},
-std::array<float,2>{0.224965557f, 0.264412642f},
-std::array<float,2>{0.665402412f, 0.828374445f},
-std::array<float,2>{0.988346517f, 0.216201156f},
-std::array<float,2>{0.411518425f, 0.502354205f},
-std::array<float,2>{0.276671261f, 0.079226993f},
-std::array<float,2>{0.763348222f, 0.698016226f},
-std::array<float,2>{0.612765491f, 0.489144027f},
-std::array<float,2>{0.0609963574f, 0.915146232f},
-std::array<float,2>{0.232087553f, 0.151674852f},
-std::array<float,2>{0.657730281f, 0.579943299f},
-std::array<float,2>{0.999222636f, 0.357781619f},
-std::array<float,2>{0.414460659f, 0.767980874f},
-std::array<float,2>{0.270116091f, 0.39101544f},
-std::array<float,2>{0.756837666f, 0.982573986f},
-std::array<float,2>{0.617829204f, 0.0472929254f},
-std::array<float,2>{0.0479856282f, 0.675611675f},
-std::array<float,2>{0.0693322346f, 0.277978987f},
-std::array<float,2>{0.553878784f, 0.81492728f},
-std::array<float,2>{0.860794485f, 0.19703427f},
-std::array<float,2>{0.315976888f, 0.531216979f},
-std::array<float,2>{0.473302335f, 0.0731894448f},
-std::array<float,2>{0.885740399f, 0.711515665f},
-std::array<float,2>{0.692424476f, 0.474940777f},
-std::array<float,2>{0.179248244f, 0.935520649f},
-std::array<float,2>{0.00573064201f, 0.0295613967f},
-std::array<float,2>{0.588967681f, 0.640833676f},
-std::array<float,2>{0.800870061f, 0.420517832f},
-std::array<float,2>{0.301280618f, 0.946848333f},
-std::array<float,2>{0.392806828f, 0.318574816f},
-std::array<float,2>{0.960392535f, 0.783409655f},
-std::array<float,2>{0.637278557f, 0.176060438f},
-std::array<float,2>{0.194030181f, 0.620684803f},
-std::array<float,2>{0.134086534f, 0.444707781f},
-std::array<float,2>{0.734890103f, 0.875860214f},
-std::array<float,2>{0.907640636f, 0.122022785f},
-std::array<float,2>{0.456716955f, 0.732249558f},
-std::array<float,2>{0.359754145f, 0.233147502f},
-std::array<float,2>{0.835309029f, 0.533021688f},
-std::array<float,2>{0.526586175f, 0.283343762f},
-std::array<float,2>{0.12408597f, 0.865985692f},
-std::array<float,2>{0.163889185f, 0.101125665f},
-std::array<float,2>{0.705426931f, 0.744165659f},
-std::array<float,2>{0.899321198f, 0.463694423f},
-std::array<float,2>{0.487498999f, 0.900733054f},
-std::array<float,2>{0.34100166f, 0.309348822f},
-std::array<float,2>{0.845967352f, 0.849479496f},
-std::array<float,2>{0.532582402f, 0.237495109f},
-std::array<float,2>{0.0897319987f, 0.562315285f},
-std::array<float,2>{0.0384318456f, 0.431486279f},
-std::array<float,2>{0.603604913f, 0.959397614f},
-std::array<float,2>{0.774683952f, 0.0107438592f},
-std::array<float,2>{0.260727525f, 0.637612879f},
-std::array<float,2>{0.423678309f, 0.156381413f},
-std::array<float,2>{0.973564625f, 0.601996839f},
-std::array<float,2>{0.685911357f, 0.338438809f},
-std::array<float,2>{0.239350393f, 0.808072507f},
-std::array<float,2>{0.102467708f, 0.213780284f},
-std::array<float,2>{0.51000607f, 0.504183888f},
-std::array<float,2>{0.827801764f, 0.259025812f},
-std::array<float,2>{0.358964235f, 0.834835351f},
-std::array<float,2>{0.447882473f, 0.487202078f},
-std::array<float,2>{0.924460053f, 0.921709239f},
-std::array<float,2>{0.728114963f, 0.0855048522f},
-std::array<float,2>{0.155409515f, 0.69961822f},
-std::array<float,2>{0.205299318f, 0.373065561f},
-std::array<float,2>{0.654265225f, 0.757327318f},
-std::array<float,2>{0.952346087f, 0.125697047f},
-std::array<float,2>{0.38093859f, 0.572944164f},
-std::array<float,2>{0.294507563f, 0.0312675461f},
-std::array<float,2>{0.783893943f, 0.659212768f},
-std::array<float,2>{0.575224221f, 0.375556916f},
-std::array<float,2>{0.0284469184f, 0.997741222f},
-std::array<float,2>{0.144252703f, 0.243162662f},
-std::array<float,2>{0.723666728f, 0.548147321f},
-std::array<float,2>{0.937072217f, 0.299754322f},
-std::array<float,2>{0.441641331f, 0.856808901f},
-std::array<float,2>{0.347300857f, 0.455554128f},
-std::array<float,2>{0.816891611f, 0.897719979f},
-std::array<float,2>{0.501592338f, 0.105120659f},
-std::array<float,2>{0.101183221f, 0.741306365f},
-std::array<float,2>{0.0178694967f, 0.33084017f},
-std::array<float,2>{0.569090784f, 0.798893631f},
-std::array<float,2>{0.790545642f, 0.165530115f},
-std::array<float,2>{0.288398445f, 0.596133411f},
-std::array<float,2>{0.385353804f, 0.00613329001f},
-std::array<float,2>{0.943645775f, 0.630143046f},
-std::array<float,2>{0.64203912f, 0.42946893f},
-std::array<float,2>{0.215760663f, 0.968421161f},
-std::array<float,2>{0.0859311596f, 0.0872918218f},
-std::array<float,2>{0.542854965f, 0.689512491f},
-std::array<float,2>{0.855195582f, 0.492825508f},
-std::array<float,2>{0.332698792f, 0.911135077f},
-std::array<float,2>{0.498273015f, 0.253718704f},
-std::array<float,2>{0.893681765f, 0.843504965f},
-std::array<float,2>{0.717415392f, 0.208143428f},
-std::array<float,2>{0.169766217f, 0.513963044f},
-std::array<float,2>{0.245648026f, 0.385208935f},
-std::array<float,2>{0.67941457f, 0.990518272f},
-std::array<float,2>{0.979011297f, 0.0421261266f},
-std::array<float,2>{0.435554355f, 0.668899894f},
-std::array<float,2>{0.251974583f, 0.133312374f},
-std::array<float,2>{0.771629095f, 0.568353534f},
-std::array<float,2>{0.595058858f, 0.366709679f},
-std::array<float,2>{0.041633077f, 0.760183871f},
-std::array<float,2>{0.198556185f, 0.0568084903f},
-std::array<float,2>{0.629965425f, 0.684852958f},
-std::array<float,2>{0.964998424f, 0.404558599f},
-std::array<float,2>{0.402730823f, 0.973688245f},
-std::array<float,2>{0.30989337f, 0.345741153f},
-std::array<float,2>{0.811207473f, 0.778388321f},
-std::array<float,2>{0.579432011f, 0.144635826f},
-std::array<float,2>{0.0110623501f, 0.587871134f},
-std::array<float,2>{0.114469573f, 0.481571734f},
-std::array<float,2>{0.51981777f, 0.923029423f},
-std::array<float,2>{0.840333641f, 0.0701059997f},
-std::array<float,2>{0.373719037f, 0.707706988f},
-std::array<float,2>{0.461967438f, 0.19225724f},
-std::array<float,2>{0.91655755f, 0.517754793f},
-std::array<float,2>{0.746626854f, 0.272049814f},
-std::array<float,2>{0.130974308f, 0.822295189f},
-std::array<float,2>{0.0580275953f, 0.186009213f},
-std::array<float,2>{0.615765989f, 0.614266396f},
-std::array<float,2>{0.76150167f, 0.322148681f},
-std::array<float,2>{0.28111136f, 0.792453766f},
-std::array<float,2>{0.408299506f, 0.413516313f},
-std::array<float,2>{0.985244274f, 0.942319036f},
-std::array<float,2>{0.669240296f, 0.0187414512f},
-std::array<float,2>{0.220663697f, 0.652235508f},
-std::array<float,2>{0.180825517f, 0.294251323f},
-std::array<float,2>{0.698062479f, 0.87033838f},
-std::array<float,2>{0.8787781f, 0.222071692f},
-std::array<float,2>{0.480908483f, 0.541732311f},
-std::array<float,2>{0.325843155f, 0.114966094f},
-std::array<float,2>{0.869313359f, 0.720044911f},
-std::array<float,2>{0.555276155f, 0.447646588f},
-std::array<float,2>{0.0781064034f, 0.887542844f},
-std::array<float,2>{0.15195936f, 0.18230617f},
-std::array<float,2>{0.732367933f, 0.609690785f},
-std::array<float,2>{0.926745415f, 0.324930906f},
-std::array<float,2>{0.452882707f, 0.793886304f},
-std::array<float,2>{0.352800608f, 0.408617318f},
-std::array<float,2>{0.823097646f, 0.937768698f},
-std::array<float,2>{0.512978375f, 0.0205255337f},
-std::array<float,2>{0.1072428f, 0.654579163f},
-std::array<float,2>{0.0269301999f, 0.291612208f},
-std::array<float,2>{0.573587835f, 0.873146296f},
-std::array<float,2>{0.788779676f, 0.223068908f},
-std::array<float,2>{0.291387588f, 0.5460549f},
-std::array<float,2>{0.376971453f, 0.110556945f},
-std::array<float,2>{0.948535323f, 0.726113558f},
-std::array<float,2>{0.651105404f, 0.451326162f},
-std::array<float,2>{0.207419589f, 0.885653436f},
-std::array<float,2>{0.090405941f, 0.0591881089f},
-std::array<float,2>{0.538545251f, 0.681530535f},
-std::array<float,2>{0.850472152f, 0.399600804f},
-std::array<float,2>{0.336015016f, 0.970442772f},
-std::array<float,2>{0.489891797f, 0.350548446f},
-std::array<float,2>{0.903541565f, 0.776296973f},
-std::array<float,2>{0.70791167f, 0.141994759f},
-std::array<float,2>{0.158044949f, 0.591299176f},
-std::array<float,2>{0.237135634f, 0.476951212f},
-std::array<float,2>{0.681589723f, 0.927527308f},
-std::array<float,2>{0.971841991f, 0.0660755485f},
-std::array<float,2>{0.42681855f, 0.703821719f},
-std::array<float,2>{0.262568355f, 0.191176042f},
-std::array<float,2>{0.778089166f, 0.519785166f},
-std::array<float,2>{0.607867658f, 0.267786115f},
-std::array<float,2>{0.0325761363f, 0.826031208f},
-std::array<float,2>{0.18938151f, 0.0909882262f},
-std::array<float,2>{0.634188294f, 0.692533255f},
-std::array<float,2>{0.955432653f, 0.49619177f},
-std::array<float,2>{0.397302538f, 0.907923698f},
-std::array<float,2>{0.297234058f, 0.254419386f},
-std::array<float,2>{0.798616707f, 0.835975945f},
-std::array<float,2>{0.591789067f, 0.204522118f},
-std::array<float,2>{0.00216918625f, 0.511612117f},
-std::array<float,2>{0.120419912f, 0.38940528f},
-std::array<float,2>{0.528845131f, 0.987188995f},
-std::array<float,2>{0.830330908f, 0.0437898897f},
-std::array<float,2>{0.363842845f, 0.665739119f},
-std::array<float,2>{0.459336281f, 0.13818799f},
-std::array<float,2>{0.912884474f, 0.564906538f},
-std::array<float,2>{0.740112126f, 0.360673636f},
-std::array<float,2>{0.140351519f, 0.762671411f},
-std::array<float,2>{0.0534039699f, 0.249304965f},
-std::array<float,2>{0.624639213f, 0.553419292f},
-std::array<float,2>{0.750646889f, 0.302561164f},
-std::array<float,2>{0.266856104f, 0.852570593f},
-std::array<float,2>{0.419004917f, 0.457609206f},
-std::array<float,2>{0.992820084f, 0.891467333f},
-std::array<float,2>{0.660782516f, 0.107746825f},
-std::array<float,2>{0.229841202f, 0.736603022f},
-std::array<float,2>{0.172960207f, 0.33263886f},
-std::array<float,2>{0.68919313f, 0.802372754f},
-std::array<float,2>{0.889277816f, 0.168676063f},
-std::array<float,2>{0.471852571f, 0.599392653f},
-std::array<float,2>{0.316803157f, 0.00287798303f},
-std::array<float,2>{0.863433778f, 0.625969172f},
-std::array<float,2>{0.54697305f, 0.423875719f},
-std::array<float,2>{0.0638479367f, 0.962661445f},
-std::array<float,2>{0.22436209f, 0.215404496f},
-std::array<float,2>{0.667446017f, 0.503317773f},
-std::array<float,2>{0.991595685f, 0.265605718f},
-std::array<float,2>{0.413706183f, 0.829465032f},
-std::array<float,2>{0.273799002f, 0.489264548f},
-std::array<float,2>{0.763782203f, 0.914318025f},
-std::array<float,2>{0.610708773f, 0.0783744976f},
-std::array<float,2>{0.0591348372f, 0.699173808f},
-std::array<float,2>{0.0722000897f, 0.370134652f},
-std::array<float,2>{0.562461317f, 0.750188649f},
-std::array<float,2>{0.874486446f, 0.129369617f},
-std::array<float,2>{0.321708411f, 0.577866316f},
-std::array<float,2>{0.478111058f, 0.037439853f},
-std::array<float,2>{0.881673098f, 0.663248956f},
-std::array<float,2>{0.701916099f, 0.381239831f},
-std::array<float,2>{0.186036617f, 0.994493842f},
-std::array<float,2>{0.0136094596f, 0.0966748074f},
-std::array<float,2>{0.585493207f, 0.748557031f},
-std::array<float,2>{0.807055295f, 0.46676597f},
-std::array<float,2>{0.305351496f, 0.903671801f},
-std::array<float,2>{0.399896324f, 0.304710776f},
-std::array<float,2>{0.964536488f, 0.845791757f},
-std::array<float,2>{0.628626108f, 0.240003973f},
-std::array<float,2>{0.200664386f, 0.556294501f},
-std::array<float,2>{0.125526324f, 0.434348345f},
-std::array<float,2>{0.74554801f, 0.95379746f},
-std::array<float,2>{0.920456111f, 0.015436667f},
-std::array<float,2>{0.466619402f, 0.636108041f},
-std::array<float,2>{0.368846476f, 0.161792099f},
-std::array<float,2>{0.836450875f, 0.606075525f},
-std::array<float,2>{0.51930964f, 0.340952367f},
-std::array<float,2>{0.109678686f, 0.811685145f},
-std::array<float,2>{0.165800214f, 0.0243004989f},
-std::array<float,2>{0.711990595f, 0.646043599f},
-std::array<float,2>{0.89511019f, 0.416902959f},
-std::array<float,2>{0.495133638f, 0.952492952f},
-std::array<float,2>{0.328445941f, 0.313361079f},
-std::array<float,2>{0.857215106f, 0.785267055f},
-std::array<float,2>{0.544846594f, 0.172743291f},
-std::array<float,2>{0.0808249936f, 0.624782622f},
-std::array<float,2>{0.0440283492f, 0.437745422f},
-std::array<float,2>{0.601270556f, 0.881738186f},
-std::array<float,2>{0.768834949f, 0.117720075f},
-std::array<float,2>{0.255019724f, 0.728349984f},
-std::array<float,2>{0.429896742f, 0.229492813f},
-std::array<float,2>{0.984348953f, 0.537699878f},
-std::array<float,2>{0.672020316f, 0.287663668f},
-std::array<float,2>{0.248060688f, 0.861343384f},
-std::array<float,2>{0.0944738463f, 0.153118044f},
-std::array<float,2>{0.504386187f, 0.583043933f},
-std::array<float,2>{0.813224673f, 0.354861766f},
-std::array<float,2>{0.351496398f, 0.7727139f},
-std::array<float,2>{0.438907772f, 0.395258158f},
-std::array<float,2>{0.931914151f, 0.979498208f},
-std::array<float,2>{0.719565749f, 0.0530283526f},
-std::array<float,2>{0.146399423f, 0.676168501f},
-std::array<float,2>{0.211891234f, 0.277061105f},
-std::array<float,2>{0.647714972f, 0.819023609f},
-std::array<float,2>{0.938038766f, 0.201981932f},
-std::array<float,2>{0.390275121f, 0.524770975f},
-std::array<float,2>{0.284339994f, 0.0777671337f},
-std::array<float,2>{0.796659529f, 0.716166019f},
-std::array<float,2>{0.563178062f, 0.469662249f},
-std::array<float,2>{0.0209945552f, 0.932709396f},
-std::array<float,2>{0.203695983f, 0.12658228f},
-std::array<float,2>{0.655589998f, 0.573345006f},
-std::array<float,2>{0.949430108f, 0.374979556f},
-std::array<float,2>{0.379335731f, 0.756447375f},
-std::array<float,2>{0.296653003f, 0.375986338f},
-std::array<float,2>{0.782327473f, 0.996953249f},
-std::array<float,2>{0.577887714f, 0.0331546701f},
-std::array<float,2>{0.0305395517f, 0.65873754f},
-std::array<float,2>{0.104185708f, 0.258743554f},
-std::array<float,2>{0.508844554f, 0.835686862f},
-std::array<float,2>{0.824927509f, 0.2146727f},
-std::array<float,2>{0.356138587f, 0.505771697f},
-std::array<float,2>{0.445413113f, 0.0848667622f},
-std::array<float,2>{0.923721731f, 0.700497985f},
-std::array<float,2>{0.728884518f, 0.487731934f},
-std::array<float,2>{0.153922811f, 0.920246124f},
-std::array<float,2>{0.0365094282f, 0.0101286527f},
-std::array<float,2>{0.602814376f, 0.638147116f},
-std::array<float,2>{0.776709974f, 0.429851681f},
-std::array<float,2>{0.258437693f, 0.960316479f},
-std::array<float,2>{0.424776495f, 0.339784056f},
-std::array<float,2>{0.975764394f, 0.806887984f},
-std::array<float,2>{0.684937179f, 0.157439411f},
-std::array<float,2>{0.241934493f, 0.602579892f},
-std::array<float,2>{0.161039114f, 0.46405226f},
-std::array<float,2>{0.704933643f, 0.902271807f},
-std::array<float,2>{0.902195454f, 0.100390114f},
-std::array<float,2>{0.485334128f, 0.74574393f},
-std::array<float,2>{0.341968715f, 0.237120286f},
-std::array<float,2>{0.844199121f, 0.560678542f},
-std::array<float,2>{0.533719242f, 0.309951186f},
-std::array<float,2>{0.086218521f, 0.848133087f},
-std::array<float,2>{0.13598232f, 0.122666284f},
-std::array<float,2>{0.736353755f, 0.730564713f},
-std::array<float,2>{0.910131395f, 0.443831325f},
-std::array<float,2>{0.455077857f, 0.876435518f},
-std::array<float,2>{0.361386836f, 0.284614235f},
-std::array<float,2>{0.833378077f, 0.86651963f},
-std::array<float,2>{0.52417016f, 0.233860776f},
-std::array<float,2>{0.122843549f, 0.531618595f},
-std::array<float,2>{0.00757898437f, 0.42115584f},
-std::array<float,2>{0.586524308f, 0.945698917f},
-std::array<float,2>{0.803598285f, 0.0310201384f},
-std::array<float,2>{0.303609997f, 0.641965151f},
-std::array<float,2>{0.391222149f, 0.176866516f},
-std::array<float,2>{0.957763255f, 0.619348168f},
-std::array<float,2>{0.639152944f, 0.31934312f},
-std::array<float,2>{0.192329884f, 0.784828544f},
-std::array<float,2>{0.0674600676f, 0.195747703f},
-std::array<float,2>{0.551663101f, 0.529568732f},
-std::array<float,2>{0.862789869f, 0.279273182f},
-std::array<float,2>{0.314188629f, 0.816160202f},
-std::array<float,2>{0.475561649f, 0.476097316f},
-std::array<float,2>{0.883470297f, 0.934440255f},
-std::array<float,2>{0.695016921f, 0.07344459f},
-std::array<float,2>{0.175826773f, 0.71234858f},
-std::array<float,2>{0.233070299f, 0.358799726f},
-std::array<float,2>{0.658693969f, 0.769033849f},
-std::array<float,2>{0.997467816f, 0.150528401f},
-std::array<float,2>{0.416170746f, 0.578948677f},
-std::array<float,2>{0.271865875f, 0.0486489832f},
-std::array<float,2>{0.754485309f, 0.6741696f},
-std::array<float,2>{0.620187819f, 0.391884357f},
-std::array<float,2>{0.0502523556f, 0.983891547f},
-std::array<float,2>{0.18214497f, 0.221455827f},
-std::array<float,2>{0.696288466f, 0.542039633f},
-std::array<float,2>{0.876445174f, 0.293419212f},
-std::array<float,2>{0.483760536f, 0.870011806f},
-std::array<float,2>{0.326754928f, 0.448732018f},
-std::array<float,2>{0.868830681f, 0.887990296f},
-std::array<float,2>{0.556778312f, 0.113969304f},
-std::array<float,2>{0.0750719011f, 0.719597876f},
-std::array<float,2>{0.0557356328f, 0.321027786f},
-std::array<float,2>{0.613597035f, 0.79144913f},
-std::array<float,2>{0.759262562f, 0.186744407f},
-std::array<float,2>{0.279069394f, 0.614010334f},
-std::array<float,2>{0.407423168f, 0.0184151959f},
-std::array<float,2>{0.987014353f, 0.65105921f},
-std::array<float,2>{0.67145884f, 0.412849128f},
-std::array<float,2>{0.221719891f, 0.943160594f},
-std::array<float,2>{0.115267783f, 0.0686166435f},
-std::array<float,2>{0.523186028f, 0.708610356f},
-std::array<float,2>{0.843632638f, 0.481255442f},
-std::array<float,2>{0.371983975f, 0.922793865f},
-std::array<float,2>{0.464161813f, 0.272888631f},
-std::array<float,2>{0.915746033f, 0.823436201f},
-std::array<float,2>{0.749516606f, 0.192419872f},
-std::array<float,2>{0.128952339f, 0.518624008f},
-std::array<float,2>{0.195597887f, 0.406247437f},
-std::array<float,2>{0.630987346f, 0.973012447f},
-std::array<float,2>{0.966918826f, 0.057903666f},
-std::array<float,2>{0.405400187f, 0.684184015f},
-std::array<float,2>{0.312010497f, 0.146397218f},
-std::array<float,2>{0.809179246f, 0.586460769f},
-std::array<float,2>{0.580143571f, 0.347330868f},
-std::array<float,2>{0.00877787173f, 0.778129935f},
-std::array<float,2>{0.242878467f, 0.0419518575f},
-std::array<float,2>{0.676815391f, 0.668967307f},
-std::array<float,2>{0.976994812f, 0.385744721f},
-std::array<float,2>{0.43483305f, 0.991537035f},
-std::array<float,2>{0.251292527f, 0.365548491f},
-std::array<float,2>{0.770132482f, 0.760825455f},
-std::array<float,2>{0.597213686f, 0.134525374f},
-std::array<float,2>{0.0399985164f, 0.566408753f},
-std::array<float,2>{0.0833869651f, 0.493627757f},
-std::array<float,2>{0.539867699f, 0.910448611f},
-std::array<float,2>{0.851983547f, 0.0860148519f},
-std::array<float,2>{0.3350133f, 0.691190183f},
-std::array<float,2>{0.497634351f, 0.207393333f},
-std::array<float,2>{0.892170727f, 0.515289485f},
-std::array<float,2>{0.716320574f, 0.252156913f},
-std::array<float,2>{0.171025679f, 0.842713058f},
-std::array<float,2>{0.0157359969f, 0.164849132f},
-std::array<float,2>{0.566779971f, 0.596932411f},
-std::array<float,2>{0.791710496f, 0.33160907f},
-std::array<float,2>{0.287087977f, 0.800308466f},
-std::array<float,2>{0.38391909f, 0.42810908f},
-std::array<float,2>{0.941998243f, 0.966943622f},
-std::array<float,2>{0.642738163f, 0.00741345715f},
-std::array<float,2>{0.217723191f, 0.629444838f},
-std::array<float,2>{0.142148212f, 0.299848795f},
-std::array<float,2>{0.725234926f, 0.856239736f},
-std::array<float,2>{0.934763134f, 0.243210629f},
-std::array<float,2>{0.445247293f, 0.547847748f},
-std::array<float,2>{0.344691485f, 0.104226395f},
-std::array<float,2>{0.820203185f, 0.740480781f},
-std::array<float,2>{0.502874196f, 0.456643552f},
-std::array<float,2>{0.0983204618f, 0.8974154f},
-std::array<float,2>{0.16013746f, 0.143276438f},
-std::array<float,2>{0.709142625f, 0.592631936f},
-std::array<float,2>{0.904728532f, 0.349310011f},
-std::array<float,2>{0.491145104f, 0.774624586f},
-std::array<float,2>{0.338470191f, 0.401815534f},
-std::array<float,2>{0.849128664f, 0.971779406f},
-std::array<float,2>{0.536720216f, 0.0607219562f},
-std::array<float,2>{0.0930851251f, 0.682824254f},
-std::array<float,2>{0.0334539376f, 0.267010868f},
-std::array<float,2>{0.606838405f, 0.828075886f},
-std::array<float,2>{0.780347705f, 0.18795225f},
-std::array<float,2>{0.264779389f, 0.522524834f},
-std::array<float,2>{0.427970409f, 0.0641304106f},
-std::array<float,2>{0.969286561f, 0.705651462f},
-std::array<float,2>{0.683061242f, 0.480426431f},
-std::array<float,2>{0.235807598f, 0.928400397f},
-std::array<float,2>{0.107997708f, 0.0232293606f},
-std::array<float,2>{0.515299201f, 0.653344035f},
-std::array<float,2>{0.820424795f, 0.406785667f},
-std::array<float,2>{0.353965968f, 0.940121233f},
-std::array<float,2>{0.450855821f, 0.327526152f},
-std::array<float,2>{0.929103851f, 0.795104623f},
-std::array<float,2>{0.73400867f, 0.180317953f},
-std::array<float,2>{0.148537859f, 0.611657977f},
-std::array<float,2>{0.209956795f, 0.449273229f},
-std::array<float,2>{0.649258792f, 0.883073092f},
-std::array<float,2>{0.945447683f, 0.11309509f},
-std::array<float,2>{0.376571178f, 0.722958326f},
-std::array<float,2>{0.290687263f, 0.224675998f},
-std::array<float,2>{0.785531282f, 0.544726551f},
-std::array<float,2>{0.57078588f, 0.290938914f},
-std::array<float,2>{0.0239677355f, 0.871313095f},
-std::array<float,2>{0.226655573f, 0.107182443f},
-std::array<float,2>{0.663651884f, 0.734921873f},
-std::array<float,2>{0.994887352f, 0.459979683f},
-std::array<float,2>{0.421384007f, 0.892991602f},
-std::array<float,2>{0.269454241f, 0.304029584f},
-std::array<float,2>{0.752736211f, 0.854564786f},
-std::array<float,2>{0.622789502f, 0.246312231f},
-std::array<float,2>{0.0524108596f, 0.552601159f},
-std::array<float,2>{0.0647730008f, 0.423699617f},
-std::array<float,2>{0.550736725f, 0.964763343f},
-std::array<float,2>{0.866934299f, 0.000906004105f},
-std::array<float,2>{0.320263267f, 0.628156602f},
-std::array<float,2>{0.470611542f, 0.170670405f},
-std::array<float,2>{0.888451576f, 0.600849986f},
-std::array<float,2>{0.690850794f, 0.335224688f},
-std::array<float,2>{0.175072283f, 0.8045488f},
-std::array<float,2>{0.000160727606f, 0.206063837f},
-std::array<float,2>{0.593748569f, 0.509046376f},
-std::array<float,2>{0.79952687f, 0.256703436f},
-std::array<float,2>{0.300338775f, 0.838414848f},
-std::array<float,2>{0.394907832f, 0.499743909f},
-std::array<float,2>{0.953505218f, 0.908757269f},
-std::array<float,2>{0.636489809f, 0.0933854356f},
-std::array<float,2>{0.190416187f, 0.69441998f},
-std::array<float,2>{0.137706921f, 0.36272341f},
-std::array<float,2>{0.740313768f, 0.764591753f},
-std::array<float,2>{0.910887897f, 0.139893368f},
-std::array<float,2>{0.457111746f, 0.564010501f},
-std::array<float,2>{0.365763396f, 0.0462150462f},
-std::array<float,2>{0.828594565f, 0.666937768f},
-std::array<float,2>{0.531097949f, 0.386899889f},
-std::array<float,2>{0.118577294f, 0.985800862f},
-std::array<float,2>{0.202540711f, 0.242130592f},
-std::array<float,2>{0.626769185f, 0.557883501f},
-std::array<float,2>{0.962035537f, 0.306837142f},
-std::array<float,2>{0.401866138f, 0.844154239f},
-std::array<float,2>{0.307071865f, 0.468455166f},
-std::array<float,2>{0.805364907f, 0.904859781f},
-std::array<float,2>{0.583690882f, 0.0948041528f},
-std::array<float,2>{0.014480304f, 0.746440887f},
-std::array<float,2>{0.112142995f, 0.342054367f},
-std::array<float,2>{0.516725659f, 0.810485601f},
-std::array<float,2>{0.838073075f, 0.162228718f},
-std::array<float,2>{0.371082425f, 0.608476698f},
-std::array<float,2>{0.468567938f, 0.0118670277f},
-std::array<float,2>{0.918304622f, 0.634124219f},
-std::array<float,2>{0.742245078f, 0.43687126f},
-std::array<float,2>{0.127112404f, 0.95595926f},
-std::array<float,2>{0.0619824454f, 0.0818043426f},
-std::array<float,2>{0.611974001f, 0.696931243f},
-std::array<float,2>{0.762011886f, 0.491013169f},
-std::array<float,2>{0.276257753f, 0.917163372f},
-std::array<float,2>{0.410322189f, 0.263184369f},
-std::array<float,2>{0.99011457f, 0.830933809f},
-std::array<float,2>{0.664099991f, 0.217271671f},
-std::array<float,2>{0.226130366f, 0.500977874f},
-std::array<float,2>{0.183628976f, 0.380381703f},
-std::array<float,2>{0.700276554f, 0.993323922f},
-std::array<float,2>{0.880405188f, 0.0369532742f},
-std::array<float,2>{0.479154795f, 0.661407053f},
-std::array<float,2>{0.323191613f, 0.131087124f},
-std::array<float,2>{0.87158674f, 0.575658262f},
-std::array<float,2>{0.560423672f, 0.368757486f},
-std::array<float,2>{0.0736110955f, 0.752719045f},
-std::array<float,2>{0.147013694f, 0.0509174727f},
-std::array<float,2>{0.720869124f, 0.677895308f},
-std::array<float,2>{0.931061983f, 0.397479415f},
-std::array<float,2>{0.440993756f, 0.977730691f},
-std::array<float,2>{0.348126322f, 0.353072137f},
-std::array<float,2>{0.814772308f, 0.771044016f},
-std::array<float,2>{0.507455826f, 0.156222522f},
-std::array<float,2>{0.0966948494f, 0.584223151f},
-std::array<float,2>{0.0217490643f, 0.471945494f},
-std::array<float,2>{0.565524697f, 0.931183994f},
-std::array<float,2>{0.794762373f, 0.0743474364f},
-std::array<float,2>{0.281615973f, 0.718132973f},
-std::array<float,2>{0.388527691f, 0.19979319f},
-std::array<float,2>{0.940474391f, 0.526829958f},
-std::array<float,2>{0.646379173f, 0.27371937f},
-std::array<float,2>{0.213052511f, 0.816522062f},
-std::array<float,2>{0.0791126788f, 0.174458861f},
-std::array<float,2>{0.545915663f, 0.62157768f},
-std::array<float,2>{0.857531905f, 0.31541419f},
-std::array<float,2>{0.330356985f, 0.787586808f},
-std::array<float,2>{0.493888855f, 0.414292455f},
-std::array<float,2>{0.897323728f, 0.950224698f},
-std::array<float,2>{0.714760602f, 0.0257188622f},
-std::array<float,2>{0.167413682f, 0.648057163f},
-std::array<float,2>{0.247940823f, 0.28553775f},
-std::array<float,2>{0.674434662f, 0.860594153f},
-std::array<float,2>{0.981891692f, 0.226734221f},
-std::array<float,2>{0.433088064f, 0.536267161f},
-std::array<float,2>{0.257480294f, 0.120786376f},
-std::array<float,2>{0.766391218f, 0.730034232f},
-std::array<float,2>{0.597982585f, 0.441022813f},
-std::array<float,2>{0.0460218005f, 0.880129695f},
-std::array<float,2>{0.238638565f, 0.159997568f},
-std::array<float,2>{0.686602473f, 0.603767753f},
-std::array<float,2>{0.974268615f, 0.337293804f},
-std::array<float,2>{0.422818989f, 0.804949522f},
-std::array<float,2>{0.261543036f, 0.431707084f},
-std::array<float,2>{0.774290442f, 0.958877861f},
-std::array<float,2>{0.604624629f, 0.0082184365f},
-std::array<float,2>{0.0376480855f, 0.6386953f},
-std::array<float,2>{0.0887693167f, 0.312447816f},
-std::array<float,2>{0.531997561f, 0.850317776f},
-std::array<float,2>{0.847209275f, 0.234947667f},
-std::array<float,2>{0.340352386f, 0.559125841f},
-std::array<float,2>{0.48703137f, 0.0993338674f},
-std::array<float,2>{0.900053859f, 0.743336201f},
-std::array<float,2>{0.706421793f, 0.460985571f},
-std::array<float,2>{0.162740707f, 0.898707926f},
-std::array<float,2>{0.0278491527f, 0.0341973417f},
-std::array<float,2>{0.574405909f, 0.65653193f},
-std::array<float,2>{0.784367681f, 0.378238291f},
-std::array<float,2>{0.293124348f, 0.999080122f},
-std::array<float,2>{0.382409602f, 0.372743398f},
-std::array<float,2>{0.951297462f, 0.755856395f},
-std::array<float,2>{0.652692556f, 0.127226323f},
-std::array<float,2>{0.206959665f, 0.571494997f},
-std::array<float,2>{0.154971182f, 0.485542297f},
-std::array<float,2>{0.727242947f, 0.91870296f},
-std::array<float,2>{0.92557323f, 0.0820315778f},
-std::array<float,2>{0.449011743f, 0.703042388f},
-std::array<float,2>{0.358397126f, 0.212276995f},
-std::array<float,2>{0.826264739f, 0.506888688f},
-std::array<float,2>{0.511610329f, 0.260818005f},
-std::array<float,2>{0.102634855f, 0.833615243f},
-std::array<float,2>{0.178063005f, 0.07223735f},
-std::array<float,2>{0.692241728f, 0.71415323f},
-std::array<float,2>{0.886075079f, 0.472893327f},
-std::array<float,2>{0.473868012f, 0.936914563f},
-std::array<float,2>{0.315021455f, 0.280584335f},
-std::array<float,2>{0.859826922f, 0.813604057f},
-std::array<float,2>{0.552963734f, 0.198308438f},
-std::array<float,2>{0.0698467121f, 0.52825278f},
-std::array<float,2>{0.0476035066f, 0.392907947f},
-std::array<float,2>{0.618318081f, 0.980782151f},
-std::array<float,2>{0.756566405f, 0.0506111495f},
-std::array<float,2>{0.270754665f, 0.672771811f},
-std::array<float,2>{0.415914625f, 0.150090486f},
-std::array<float,2>{0.998520672f, 0.581680298f},
-std::array<float,2>{0.656810999f, 0.355889499f},
-std::array<float,2>{0.231292695f, 0.766587198f},
-std::array<float,2>{0.123471536f, 0.231633544f},
-std::array<float,2>{0.525862455f, 0.53503114f},
-std::array<float,2>{0.834859729f, 0.281326354f},
-std::array<float,2>{0.360776871f, 0.864228666f},
-std::array<float,2>{0.455781758f, 0.441623062f},
-std::array<float,2>{0.90716368f, 0.877857924f},
-std::array<float,2>{0.735453248f, 0.124613583f},
-std::array<float,2>{0.132816851f, 0.734190524f},
-std::array<float,2>{0.194595158f, 0.316743165f},
-std::array<float,2>{0.638235509f, 0.7820521f},
-std::array<float,2>{0.958991408f, 0.178402424f},
-std::array<float,2>{0.394319475f, 0.617859662f},
-std::array<float,2>{0.302086115f, 0.027826447f},
-std::array<float,2>{0.802710116f, 0.642978549f},
-std::array<float,2>{0.588109612f, 0.418258309f},
-std::array<float,2>{0.00453948602f, 0.94735229f},
-std::array<float,2>{0.132284388f, 0.193762407f},
-std::array<float,2>{0.747862756f, 0.51750195f},
-std::array<float,2>{0.917079329f, 0.269860536f},
-std::array<float,2>{0.461545497f, 0.821699381f},
-std::array<float,2>{0.37434566f, 0.483925521f},
-std::array<float,2>{0.841191292f, 0.925404072f},
-std::array<float,2>{0.520698309f, 0.0668855235f},
-std::array<float,2>{0.113818608f, 0.709156394f},
-std::array<float,2>{0.0106770229f, 0.345642239f},
-std::array<float,2>{0.578170061f, 0.780635238f},
-std::array<float,2>{0.812466443f, 0.14729403f},
-std::array<float,2>{0.308986962f, 0.58919239f},
-std::array<float,2>{0.403793871f, 0.0557765663f},
-std::array<float,2>{0.966602504f, 0.687400699f},
-std::array<float,2>{0.629811406f, 0.402989656f},
-std::array<float,2>{0.197378263f, 0.975895643f},
-std::array<float,2>{0.0769503638f, 0.116639704f},
-std::array<float,2>{0.555947185f, 0.722604454f},
-std::array<float,2>{0.870421231f, 0.446420789f},
-std::array<float,2>{0.325019121f, 0.889291704f},
-std::array<float,2>{0.481690615f, 0.295838147f},
-std::array<float,2>{0.877151906f, 0.867560327f},
-std::array<float,2>{0.698643506f, 0.218957961f},
-std::array<float,2>{0.180404946f, 0.540262938f},
-std::array<float,2>{0.218911305f, 0.411429793f},
-std::array<float,2>{0.668110192f, 0.944906294f},
-std::array<float,2>{0.985822618f, 0.0156564489f},
-std::array<float,2>{0.410004556f, 0.650218964f},
-std::array<float,2>{0.279635191f, 0.185022354f},
-std::array<float,2>{0.759958088f, 0.616576731f},
-std::array<float,2>{0.617054462f, 0.32329455f},
-std::array<float,2>{0.0568701848f, 0.789503574f},
-std::array<float,2>{0.216478169f, 0.00572943734f},
-std::array<float,2>{0.641497612f, 0.63121444f},
-std::array<float,2>{0.945257425f, 0.426125973f},
-std::array<float,2>{0.386194378f, 0.966356993f},
-std::array<float,2>{0.287556171f, 0.32921949f},
-std::array<float,2>{0.789387822f, 0.797550857f},
-std::array<float,2>{0.57022351f, 0.167650044f},
-std::array<float,2>{0.0192620829f, 0.595591903f},
-std::array<float,2>{0.100113966f, 0.454485297f},
-std::array<float,2>{0.500210404f, 0.895960689f},
-std::array<float,2>{0.817562401f, 0.102198318f},
-std::array<float,2>{0.346440047f, 0.739263713f},
-std::array<float,2>{0.442621529f, 0.244540244f},
-std::array<float,2>{0.935720086f, 0.549665391f},
-std::array<float,2>{0.722764969f, 0.297662616f},
-std::array<float,2>{0.142907366f, 0.857725501f},
-std::array<float,2>{0.0427939519f, 0.135002747f},
-std::array<float,2>{0.59452486f, 0.568667889f},
-std::array<float,2>{0.773346007f, 0.363717794f},
-std::array<float,2>{0.253586382f, 0.759221077f},
-std::array<float,2>{0.436663777f, 0.383182466f},
-std::array<float,2>{0.979739785f, 0.988488615f},
-std::array<float,2>{0.678146064f, 0.0404727682f},
-std::array<float,2>{0.244528651f, 0.671158314f},
-std::array<float,2>{0.168169498f, 0.250493556f},
-std::array<float,2>{0.718069255f, 0.839973986f},
-std::array<float,2>{0.893042743f, 0.210459322f},
-std::array<float,2>{0.499700099f, 0.512304306f},
-std::array<float,2>{0.333101124f, 0.0890613645f},
-std::array<float,2>{0.854041278f, 0.687979579f},
-std::array<float,2>{0.541169643f, 0.495363861f},
-std::array<float,2>{0.0844417289f, 0.912863553f},
-std::array<float,2>{0.145683035f, 0.155750215f},
-std::array<float,2>{0.718932807f, 0.584594905f},
-std::array<float,2>{0.932305455f, 0.352755815f},
-std::array<float,2>{0.439134926f, 0.770713627f},
-std::array<float,2>{0.350647658f, 0.39810726f},
-std::array<float,2>{0.812971175f, 0.978261471f},
-std::array<float,2>{0.504721642f, 0.0515495725f},
-std::array<float,2>{0.093951948f, 0.67824614f},
-std::array<float,2>{0.0210004356f, 0.274332345f},
-std::array<float,2>{0.562614441f, 0.817037046f},
-std::array<float,2>{0.796364009f, 0.19931595f},
-std::array<float,2>{0.28494674f, 0.526856899f},
-std::array<float,2>{0.389805436f, 0.0748253167f},
-std::array<float,2>{0.937923849f, 0.718407929f},
-std::array<float,2>{0.648376763f, 0.472264141f},
-std::array<float,2>{0.210945964f, 0.930873096f},
-std::array<float,2>{0.0804922953f, 0.0259070396f},
-std::array<float,2>{0.544386446f, 0.647500217f},
-std::array<float,2>{0.856726766f, 0.414820164f},
-std::array<float,2>{0.328632742f, 0.950860858f},
-std::array<float,2>{0.495802402f, 0.314656436f},
-std::array<float,2>{0.894630611f, 0.788049281f},
-std::array<float,2>{0.712727368f, 0.174185365f},
-std::array<float,2>{0.165274978f, 0.62172997f},
-std::array<float,2>{0.248703703f, 0.440640926f},
-std::array<float,2>{0.672837198f, 0.880546153f},
-std::array<float,2>{0.983556867f, 0.120244533f},
-std::array<float,2>{0.430633307f, 0.729542613f},
-std::array<float,2>{0.255629957f, 0.227203608f},
-std::array<float,2>{0.769187093f, 0.537018239f},
-std::array<float,2>{0.600593388f, 0.285791636f},
-std::array<float,2>{0.044790715f, 0.860893428f},
-std::array<float,2>{0.2011455f, 0.0954925194f},
-std::array<float,2>{0.628391087f, 0.746646881f},
-std::array<float,2>{0.963869393f, 0.468002319f},
-std::array<float,2>{0.40035367f, 0.904364586f},
-std::array<float,2>{0.304971009f, 0.3075203f},
-std::array<float,2>{0.807168782f, 0.844288349f},
-std::array<float,2>{0.58544755f, 0.241395697f},
-std::array<float,2>{0.0129224425f, 0.558367074f},
-std::array<float,2>{0.110238597f, 0.437301755f},
-std::array<float,2>{0.51865232f, 0.955317676f},
-std::array<float,2>{0.836027801f, 0.0122852819f},
-std::array<float,2>{0.368296117f, 0.634474635f},
-std::array<float,2>{0.466200024f, 0.162641123f},
-std::array<float,2>{0.920084178f, 0.609012306f},
-std::array<float,2>{0.745621443f, 0.342559904f},
-std::array<float,2>{0.125255093f, 0.81000644f},
-std::array<float,2>{0.0589831918f, 0.217683047f},
-std::array<float,2>{0.610878646f, 0.501722991f},
-std::array<float,2>{0.764432013f, 0.263150066f},
-std::array<float,2>{0.27406019f, 0.830255508f},
-std::array<float,2>{0.413370788f, 0.490405232f},
-std::array<float,2>{0.992075682f, 0.91795665f},
-std::array<float,2>{0.667960227f, 0.0815080926f},
-std::array<float,2>{0.223709732f, 0.696349204f},
-std::array<float,2>{0.185680985f, 0.368432343f},
-std::array<float,2>{0.70160383f, 0.752303243f},
-std::array<float,2>{0.881206036f, 0.131539166f},
-std::array<float,2>{0.47758463f, 0.575996816f},
-std::array<float,2>{0.322055936f, 0.036495138f},
-std::array<float,2>{0.874797285f, 0.661994159f},
-std::array<float,2>{0.561828136f, 0.379963428f},
-std::array<float,2>{0.0714612827f, 0.994051695f},
-std::array<float,2>{0.230094403f, 0.246891603f},
-std::array<float,2>{0.660579622f, 0.552064598f},
-std::array<float,2>{0.992555261f, 0.304646134f},
-std::array<float,2>{0.419466943f, 0.855111241f},
-std::array<float,2>{0.267559379f, 0.460450143f},
-std::array<float,2>{0.750348389f, 0.893200815f},
-std::array<float,2>{0.624113441f, 0.106913932f},
-std::array<float,2>{0.0528396927f, 0.734745204f},
-std::array<float,2>{0.0643826202f, 0.335490376f},
-std::array<float,2>{0.547506332f, 0.804085672f},
-std::array<float,2>{0.864170074f, 0.170172587f},
-std::array<float,2>{0.317346603f, 0.601405323f},
-std::array<float,2>{0.472281128f, 8.3753439e-05f},
-std::array<float,2>{0.888850689f, 0.628879428f},
-std::array<float,2>{0.688793421f, 0.42314741f},
-std::array<float,2>{0.173715919f, 0.963900864f},
-std::array<float,2>{0.00265243812f, 0.0931665823f},
-std::array<float,2>{0.590946198f, 0.694907129f},
-std::array<float,2>{0.797914028f, 0.499329269f},
-std::array<float,2>{0.297646761f, 0.908669829f},
-std::array<float,2>{0.39660576f, 0.256060272f},
-std::array<float,2>{0.955741465f, 0.837968469f},
-std::array<float,2>{0.63471508f, 0.206752077f},
-std::array<float,2>{0.188891619f, 0.50965631f},
-std::array<float,2>{0.140005782f, 0.387435257f},
-std::array<float,2>{0.739592314f, 0.986024439f},
-std::array<float,2>{0.912246764f, 0.0464261323f},
-std::array<float,2>{0.459510505f, 0.666193068f},
-std::array<float,2>{0.363699734f, 0.140390918f},
-std::array<float,2>{0.830957413f, 0.563485086f},
-std::array<float,2>{0.528453112f, 0.363070279f},
-std::array<float,2>{0.120909542f, 0.763920546f},
-std::array<float,2>{0.157342046f, 0.0611669384f},
-std::array<float,2>{0.707040846f, 0.683510005f},
-std::array<float,2>{0.904293358f, 0.402172476f},
-std::array<float,2>{0.48931089f, 0.972449541f},
-std::array<float,2>{0.33670795f, 0.348713279f},
-std::array<float,2>{0.850090086f, 0.775059044f},
-std::array<float,2>{0.53902179f, 0.143004477f},
-std::array<float,2>{0.0902315453f, 0.592239857f},
-std::array<float,2>{0.0330513716f, 0.47979784f},
-std::array<float,2>{0.607927442f, 0.927825511f},
-std::array<float,2>{0.777723372f, 0.0638698414f},
-std::array<float,2>{0.261818975f, 0.705240488f},
-std::array<float,2>{0.42772752f, 0.188304976f},
-std::array<float,2>{0.972587168f, 0.523191869f},
-std::array<float,2>{0.681061327f, 0.267215192f},
-std::array<float,2>{0.236412376f, 0.827322721f},
-std::array<float,2>{0.106731564f, 0.179999322f},
-std::array<float,2>{0.513629317f, 0.611908615f},
-std::array<float,2>{0.822739482f, 0.327836365f},
-std::array<float,2>{0.353171349f, 0.795421839f},
-std::array<float,2>{0.452314228f, 0.406469971f},
-std::array<float,2>{0.926114023f, 0.939855695f},
-std::array<float,2>{0.731777906f, 0.0229306053f},
-std::array<float,2>{0.151593149f, 0.653881192f},
-std::array<float,2>{0.207646027f, 0.290526778f},
-std::array<float,2>{0.650430381f, 0.87184155f},
-std::array<float,2>{0.948788345f, 0.225457698f},
-std::array<float,2>{0.377906084f, 0.544340193f},
-std::array<float,2>{0.29179576f, 0.112775669f},
-std::array<float,2>{0.788240194f, 0.723395646f},
-std::array<float,2>{0.573848546f, 0.450044215f},
-std::array<float,2>{0.026376389f, 0.883304238f},
-std::array<float,2>{0.217163384f, 0.16704011f},
-std::array<float,2>{0.643455267f, 0.595161438f},
-std::array<float,2>{0.941751301f, 0.329779834f},
-std::array<float,2>{0.384408355f, 0.79703933f},
-std::array<float,2>{0.286537707f, 0.426638633f},
-std::array<float,2>{0.791048944f, 0.966217816f},
-std::array<float,2>{0.566927671f, 0.00489685917f},
-std::array<float,2>{0.0163490474f, 0.631674826f},
-std::array<float,2>{0.0978234559f, 0.29727602f},
-std::array<float,2>{0.502220809f, 0.857993424f},
-std::array<float,2>{0.819781959f, 0.244805366f},
-std::array<float,2>{0.344184816f, 0.549200177f},
-std::array<float,2>{0.444371998f, 0.101684697f},
-std::array<float,2>{0.935405791f, 0.740122259f},
-std::array<float,2>{0.724953949f, 0.454844326f},
-std::array<float,2>{0.141739652f, 0.896121979f},
-std::array<float,2>{0.0393348522f, 0.040880397f},
-std::array<float,2>{0.597018838f, 0.671436608f},
-std::array<float,2>{0.769704461f, 0.383690029f},
-std::array<float,2>{0.251835167f, 0.988946378f},
-std::array<float,2>{0.43511039f, 0.364116699f},
-std::array<float,2>{0.977411985f, 0.759544611f},
-std::array<float,2>{0.677614927f, 0.135694519f},
-std::array<float,2>{0.242630795f, 0.569263101f},
-std::array<float,2>{0.171681136f, 0.49597165f},
-std::array<float,2>{0.716164827f, 0.912570119f},
-std::array<float,2>{0.892078638f, 0.0894925222f},
-std::array<float,2>{0.497234523f, 0.688476145f},
-std::array<float,2>{0.335784733f, 0.210223988f},
-std::array<float,2>{0.852075517f, 0.512122393f},
-std::array<float,2>{0.539124668f, 0.250108778f},
-std::array<float,2>{0.0835518166f, 0.840381265f},
-std::array<float,2>{0.129507706f, 0.0670906156f},
-std::array<float,2>{0.749312997f, 0.709542155f},
-std::array<float,2>{0.915088475f, 0.483457237f},
-std::array<float,2>{0.464817613f, 0.925219774f},
-std::array<float,2>{0.371182382f, 0.270198256f},
-std::array<float,2>{0.842933595f, 0.822180092f},
-std::array<float,2>{0.522769988f, 0.193918541f},
-std::array<float,2>{0.11618866f, 0.516815662f},
-std::array<float,2>{0.00822997093f, 0.402441472f},
-std::array<float,2>{0.580797195f, 0.976530433f},
-std::array<float,2>{0.808822393f, 0.0562894009f},
-std::array<float,2>{0.312347442f, 0.68663466f},
-std::array<float,2>{0.405991733f, 0.14677994f},
-std::array<float,2>{0.967437148f, 0.589803576f},
-std::array<float,2>{0.631448627f, 0.345206469f},
-std::array<float,2>{0.196112618f, 0.781202614f},
-std::array<float,2>{0.0746419877f, 0.219601765f},
-std::array<float,2>{0.557346165f, 0.540948808f},
-std::array<float,2>{0.868410408f, 0.295143187f},
-std::array<float,2>{0.326427221f, 0.868114769f},
-std::array<float,2>{0.484270245f, 0.447076917f},
-std::array<float,2>{0.87656647f, 0.889138162f},
-std::array<float,2>{0.69557178f, 0.116856731f},
-std::array<float,2>{0.18171069f, 0.721967757f},
-std::array<float,2>{0.222477183f, 0.323898971f},
-std::array<float,2>{0.671299219f, 0.789798975f},
-std::array<float,2>{0.986794949f, 0.185200348f},
-std::array<float,2>{0.407884896f, 0.617113173f},
-std::array<float,2>{0.278575182f, 0.0164086148f},
-std::array<float,2>{0.759676874f, 0.649636984f},
-std::array<float,2>{0.61404407f, 0.411684602f},
-std::array<float,2>{0.0563174076f, 0.944664478f},
-std::array<float,2>{0.176754773f, 0.198745936f},
-std::array<float,2>{0.694784105f, 0.527385414f},
-std::array<float,2>{0.883051217f, 0.280876815f},
-std::array<float,2>{0.475096226f, 0.814095736f},
-std::array<float,2>{0.313631743f, 0.47356239f},
-std::array<float,2>{0.863167882f, 0.937081337f},
-std::array<float,2>{0.550896168f, 0.0716184825f},
-std::array<float,2>{0.0681058094f, 0.714629769f},
-std::array<float,2>{0.0502966493f, 0.356122255f},
-std::array<float,2>{0.620952666f, 0.765811324f},
-std::array<float,2>{0.754060268f, 0.149578124f},
-std::array<float,2>{0.272283942f, 0.5815413f},
-std::array<float,2>{0.416866571f, 0.0502641574f},
-std::array<float,2>{0.998044848f, 0.672324061f},
-std::array<float,2>{0.65864414f, 0.393343985f},
-std::array<float,2>{0.232761204f, 0.981362998f},
-std::array<float,2>{0.122364029f, 0.124451689f},
-std::array<float,2>{0.523765206f, 0.733591914f},
-std::array<float,2>{0.833745182f, 0.442217261f},
-std::array<float,2>{0.361951023f, 0.876981676f},
-std::array<float,2>{0.454179764f, 0.28203094f},
-std::array<float,2>{0.909372985f, 0.863677442f},
-std::array<float,2>{0.737118304f, 0.232037395f},
-std::array<float,2>{0.136258036f, 0.534401298f},
-std::array<float,2>{0.191887066f, 0.418679982f},
-std::array<float,2>{0.639336646f, 0.947848737f},
-std::array<float,2>{0.957235157f, 0.0279039312f},
-std::array<float,2>{0.390872478f, 0.643183827f},
-std::array<float,2>{0.302771807f, 0.177985847f},
-std::array<float,2>{0.803023875f, 0.617491484f},
-std::array<float,2>{0.586072326f, 0.317192495f},
-std::array<float,2>{0.0073159379f, 0.781523168f},
-std::array<float,2>{0.241468206f, 0.0084359115f},
-std::array<float,2>{0.685281813f, 0.639615893f},
-std::array<float,2>{0.976234913f, 0.43233791f},
-std::array<float,2>{0.423994511f, 0.958429813f},
-std::array<float,2>{0.258008569f, 0.337521046f},
-std::array<float,2>{0.777008533f, 0.805538476f},
-std::array<float,2>{0.603480697f, 0.159536064f},
-std::array<float,2>{0.0370438918f, 0.604173601f},
-std::array<float,2>{0.0869012028f, 0.461611569f},
-std::array<float,2>{0.53347522f, 0.898929536f},
-std::array<float,2>{0.844412148f, 0.0989915356f},
-std::array<float,2>{0.342671365f, 0.743817925f},
-std::array<float,2>{0.484417945f, 0.23467654f},
-std::array<float,2>{0.901379347f, 0.55905062f},
-std::array<float,2>{0.704398215f, 0.311902523f},
-std::array<float,2>{0.160227224f, 0.849978924f},
-std::array<float,2>{0.0312377308f, 0.127504632f},
-std::array<float,2>{0.577400565f, 0.571834028f},
-std::array<float,2>{0.783054829f, 0.37241891f},
-std::array<float,2>{0.296190709f, 0.754961729f},
-std::array<float,2>{0.379797161f, 0.378546715f},
-std::array<float,2>{0.949714065f, 0.999703109f},
-std::array<float,2>{0.655782104f, 0.0348765366f},
-std::array<float,2>{0.203521058f, 0.657033384f},
-std::array<float,2>{0.153430328f, 0.261717021f},
-std::array<float,2>{0.729227126f, 0.833180189f},
-std::array<float,2>{0.922988117f, 0.212533861f},
-std::array<float,2>{0.446243435f, 0.507464588f},
-std::array<float,2>{0.355754167f, 0.0829323307f},
-std::array<float,2>{0.8244766f, 0.702521682f},
-std::array<float,2>{0.509447098f, 0.486118525f},
-std::array<float,2>{0.103898346f, 0.91844362f},
-std::array<float,2>{0.16782479f, 0.172341987f},
-std::array<float,2>{0.714011788f, 0.62413615f},
-std::array<float,2>{0.896865904f, 0.312549889f},
-std::array<float,2>{0.493301988f, 0.786111057f},
-std::array<float,2>{0.330842882f, 0.416201234f},
-std::array<float,2>{0.858039618f, 0.952847004f},
-std::array<float,2>{0.546484649f, 0.023497995f},
-std::array<float,2>{0.0800186694f, 0.645618498f},
-std::array<float,2>{0.0468605384f, 0.287190974f},
-std::array<float,2>{0.598428428f, 0.862171173f},
-std::array<float,2>{0.765779018f, 0.230087787f},
-std::array<float,2>{0.257016748f, 0.537327528f},
-std::array<float,2>{0.433290005f, 0.117370717f},
-std::array<float,2>{0.982297361f, 0.727569401f},
-std::array<float,2>{0.674003005f, 0.438377619f},
-std::array<float,2>{0.247185543f, 0.88093555f},
-std::array<float,2>{0.0976162106f, 0.0535543449f},
-std::array<float,2>{0.507264137f, 0.676649094f},
-std::array<float,2>{0.815223038f, 0.394842982f},
-std::array<float,2>{0.348373681f, 0.980338454f},
-std::array<float,2>{0.440593779f, 0.355192065f},
-std::array<float,2>{0.931624472f, 0.772951305f},
-std::array<float,2>{0.721196175f, 0.152710751f},
-std::array<float,2>{0.146935731f, 0.583516181f},
-std::array<float,2>{0.213533193f, 0.469157934f},
-std::array<float,2>{0.645514071f, 0.933226585f},
-std::array<float,2>{0.941235065f, 0.0775956362f},
-std::array<float,2>{0.387845278f, 0.716403782f},
-std::array<float,2>{0.282147914f, 0.201416746f},
-std::array<float,2>{0.794072807f, 0.524977624f},
-std::array<float,2>{0.566150784f, 0.276693106f},
-std::array<float,2>{0.0220533311f, 0.818536937f},
-std::array<float,2>{0.226010144f, 0.0787266493f},
-std::array<float,2>{0.664696097f, 0.698629022f},
-std::array<float,2>{0.989654243f, 0.489959627f},
-std::array<float,2>{0.41085434f, 0.914679527f},
-std::array<float,2>{0.275542945f, 0.264770925f},
-std::array<float,2>{0.762634635f, 0.829938471f},
-std::array<float,2>{0.611715972f, 0.215132594f},
-std::array<float,2>{0.0624127164f, 0.503748775f},
-std::array<float,2>{0.0740148947f, 0.381798148f},
-std::array<float,2>{0.559799433f, 0.994914889f},
-std::array<float,2>{0.871208727f, 0.0378126241f},
-std::array<float,2>{0.322282881f, 0.66383338f},
-std::array<float,2>{0.478936732f, 0.129659638f},
-std::array<float,2>{0.880120218f, 0.577216387f},
-std::array<float,2>{0.701135278f, 0.370975941f},
-std::array<float,2>{0.184473425f, 0.750693679f},
-std::array<float,2>{0.0139830746f, 0.239641935f},
-std::array<float,2>{0.583344162f, 0.555845439f},
-std::array<float,2>{0.804782927f, 0.30551511f},
-std::array<float,2>{0.307163864f, 0.84647119f},
-std::array<float,2>{0.401662827f, 0.466154367f},
-std::array<float,2>{0.962587655f, 0.904286265f},
-std::array<float,2>{0.626024961f, 0.0957091823f},
-std::array<float,2>{0.203020349f, 0.748471141f},
-std::array<float,2>{0.127702713f, 0.341483563f},
-std::array<float,2>{0.743143022f, 0.812119842f},
-std::array<float,2>{0.918659568f, 0.161287293f},
-std::array<float,2>{0.468254f, 0.60583806f},
-std::array<float,2>{0.370229542f, 0.0147860972f},
-std::array<float,2>{0.838546574f, 0.636357665f},
-std::array<float,2>{0.517191887f, 0.433958501f},
-std::array<float,2>{0.111603923f, 0.953132212f},
-std::array<float,2>{0.18986319f, 0.204799786f},
-std::array<float,2>{0.635838866f, 0.510997534f},
-std::array<float,2>{0.953949511f, 0.25392279f},
-std::array<float,2>{0.395479888f, 0.836590588f},
-std::array<float,2>{0.299839377f, 0.496992528f},
-std::array<float,2>{0.798979282f, 0.907254577f},
-std::array<float,2>{0.593249023f, 0.0914810672f},
-std::array<float,2>{0.000938133104f, 0.692888737f},
-std::array<float,2>{0.118778653f, 0.360945314f},
-std::array<float,2>{0.530611396f, 0.762102902f},
-std::array<float,2>{0.828679144f, 0.138014168f},
-std::array<float,2>{0.365695715f, 0.565144598f},
-std::array<float,2>{0.457613528f, 0.0429858603f},
-std::array<float,2>{0.910193503f, 0.665398598f},
-std::array<float,2>{0.741080642f, 0.38884595f},
-std::array<float,2>{0.138249099f, 0.986793935f},
-std::array<float,2>{0.0520293601f, 0.10798645f},
-std::array<float,2>{0.622342944f, 0.737046719f},
-std::array<float,2>{0.752184451f, 0.457035065f},
-std::array<float,2>{0.26887846f, 0.890919983f},
-std::array<float,2>{0.421766907f, 0.301779062f},
-std::array<float,2>{0.994167447f, 0.853432178f},
-std::array<float,2>{0.663124919f, 0.249583647f},
-std::array<float,2>{0.227310359f, 0.553197026f},
-std::array<float,2>{0.175522059f, 0.424471885f},
-std::array<float,2>{0.6912359f, 0.962074578f},
-std::array<float,2>{0.887903571f, 0.00241633202f},
-std::array<float,2>{0.470131218f, 0.625314176f},
-std::array<float,2>{0.319714874f, 0.168039933f},
-std::array<float,2>{0.866263509f, 0.598787248f},
-std::array<float,2>{0.550211549f, 0.332048476f},
-std::array<float,2>{0.0649700239f, 0.802211046f},
-std::array<float,2>{0.149108589f, 0.0212877672f},
-std::array<float,2>{0.733608902f, 0.654886365f},
-std::array<float,2>{0.929677367f, 0.409148812f},
-std::array<float,2>{0.450269073f, 0.938265562f},
-std::array<float,2>{0.354367942f, 0.324576288f},
-std::array<float,2>{0.821164668f, 0.793010592f},
-std::array<float,2>{0.515039444f, 0.181677923f},
-std::array<float,2>{0.107825011f, 0.610247374f},
-std::array<float,2>{0.0234592352f, 0.451735139f},
-std::array<float,2>{0.571139574f, 0.885029435f},
-std::array<float,2>{0.786074519f, 0.111123458f},
-std::array<float,2>{0.290416628f, 0.725929081f},
-std::array<float,2>{0.375990182f, 0.223535076f},
-std::array<float,2>{0.946132302f, 0.546749651f},
-std::array<float,2>{0.648729682f, 0.291216373f},
-std::array<float,2>{0.209053785f, 0.873831391f},
-std::array<float,2>{0.0935860425f, 0.142417252f},
-std::array<float,2>{0.536358237f, 0.591363668f},
-std::array<float,2>{0.848815262f, 0.350094557f},
-std::array<float,2>{0.338197887f, 0.77549696f},
-std::array<float,2>{0.490305632f, 0.400086492f},
-std::array<float,2>{0.904792607f, 0.969822109f},
-std::array<float,2>{0.709534109f, 0.058829546f},
-std::array<float,2>{0.159212053f, 0.680739403f},
-std::array<float,2>{0.236302227f, 0.268411964f},
-std::array<float,2>{0.683549583f, 0.825492501f},
-std::array<float,2>{0.969047546f, 0.19068031f},
-std::array<float,2>{0.428499222f, 0.520415545f},
-std::array<float,2>{0.26538378f, 0.0658174083f},
-std::array<float,2>{0.780854762f, 0.703579783f},
-std::array<float,2>{0.607206106f, 0.477403432f},
-std::array<float,2>{0.0339607149f, 0.926782131f},
-std::array<float,2>{0.244960591f, 0.133933067f},
-std::array<float,2>{0.678417385f, 0.567059517f},
-std::array<float,2>{0.980097234f, 0.366089314f},
-std::array<float,2>{0.437059551f, 0.761692822f},
-std::array<float,2>{0.253297359f, 0.38627404f},
-std::array<float,2>{0.772665501f, 0.991901278f},
-std::array<float,2>{0.593895793f, 0.0411356203f},
-std::array<float,2>{0.0422797427f, 0.669782043f},
-std::array<float,2>{0.0846695155f, 0.252889782f},
-std::array<float,2>{0.541518807f, 0.842220187f},
-std::array<float,2>{0.853824556f, 0.207536295f},
-std::array<float,2>{0.333632052f, 0.514695048f},
-std::array<float,2>{0.499444902f, 0.0865447223f},
-std::array<float,2>{0.893199503f, 0.690659344f},
-std::array<float,2>{0.718299687f, 0.493657947f},
-std::array<float,2>{0.168872416f, 0.910957396f},
-std::array<float,2>{0.018718509f, 0.00715999817f},
-std::array<float,2>{0.569605231f, 0.629241049f},
-std::array<float,2>{0.789649904f, 0.428273648f},
-std::array<float,2>{0.287906289f, 0.9675138f},
-std::array<float,2>{0.386583209f, 0.331133008f},
-std::array<float,2>{0.94466877f, 0.800142646f},
-std::array<float,2>{0.640979588f, 0.164074734f},
-std::array<float,2>{0.216191232f, 0.597497284f},
-std::array<float,2>{0.14347139f, 0.456263244f},
-std::array<float,2>{0.723154962f, 0.896485686f},
-std::array<float,2>{0.936261058f, 0.103518479f},
-std::array<float,2>{0.442982256f, 0.74079603f},
-std::array<float,2>{0.345848113f, 0.243825778f},
-std::array<float,2>{0.818346143f, 0.547353625f},
-std::array<float,2>{0.500709891f, 0.30042693f},
-std::array<float,2>{0.099650763f, 0.855811775f},
-std::array<float,2>{0.180084258f, 0.113548711f},
-std::array<float,2>{0.699130774f, 0.719127834f},
-std::array<float,2>{0.877719641f, 0.448410064f},
-std::array<float,2>{0.482326418f, 0.888546526f},
-std::array<float,2>{0.32464245f, 0.293501884f},
-std::array<float,2>{0.870818079f, 0.869225502f},
-std::array<float,2>{0.556545138f, 0.220945626f},
-std::array<float,2>{0.0764702857f, 0.542765677f},
-std::array<float,2>{0.0574757233f, 0.412214607f},
-std::array<float,2>{0.616325438f, 0.942766488f},
-std::array<float,2>{0.760428131f, 0.0179225598f},
-std::array<float,2>{0.280035019f, 0.650411785f},
-std::array<float,2>{0.409276485f, 0.187478334f},
-std::array<float,2>{0.985897541f, 0.613645136f},
-std::array<float,2>{0.668637991f, 0.320654571f},
-std::array<float,2>{0.219415426f, 0.791760921f},
-std::array<float,2>{0.113508902f, 0.193269715f},
-std::array<float,2>{0.521288335f, 0.51905179f},
-std::array<float,2>{0.841587126f, 0.272964597f},
-std::array<float,2>{0.374840736f, 0.823969305f},
-std::array<float,2>{0.460992575f, 0.48073253f},
-std::array<float,2>{0.917624295f, 0.922154427f},
-std::array<float,2>{0.747086167f, 0.0690378174f},
-std::array<float,2>{0.132368132f, 0.70826304f},
-std::array<float,2>{0.19794552f, 0.347142488f},
-std::array<float,2>{0.628998697f, 0.777579904f},
-std::array<float,2>{0.966049671f, 0.145725131f},
-std::array<float,2>{0.40387845f, 0.586363196f},
-std::array<float,2>{0.309496164f, 0.0581869557f},
-std::array<float,2>{0.81159246f, 0.683998704f},
-std::array<float,2>{0.578975916f, 0.405457765f},
-std::array<float,2>{0.0101325437f, 0.973497748f},
-std::array<float,2>{0.133600622f, 0.23418121f},
-std::array<float,2>{0.735921502f, 0.532088339f},
-std::array<float,2>{0.906268418f, 0.285063744f},
-std::array<float,2>{0.455192655f, 0.866980195f},
-std::array<float,2>{0.360902905f, 0.443892211f},
-std::array<float,2>{0.834032118f, 0.876615047f},
-std::array<float,2>{0.525944114f, 0.122412764f},
-std::array<float,2>{0.123692736f, 0.731167376f},
-std::array<float,2>{0.00414571259f, 0.320109963f},
-std::array<float,2>{0.58858943f, 0.784411073f},
-std::array<float,2>{0.802177906f, 0.177548274f},
-std::array<float,2>{0.302382171f, 0.619708955f},
-std::array<float,2>{0.393981338f, 0.030520156f},
-std::array<float,2>{0.959534705f, 0.642528594f},
-std::array<float,2>{0.637696981f, 0.421675473f},
-std::array<float,2>{0.195142448f, 0.945976794f},
-std::array<float,2>{0.0695798099f, 0.0740375593f},
-std::array<float,2>{0.553692579f, 0.712828815f},
-std::array<float,2>{0.859984219f, 0.476039886f},
-std::array<float,2>{0.31452173f, 0.933630168f},
-std::array<float,2>{0.474124551f, 0.278805673f},
-std::array<float,2>{0.886617362f, 0.815475702f},
-std::array<float,2>{0.691840351f, 0.195916161f},
-std::array<float,2>{0.178642616f, 0.530081034f},
-std::array<float,2>{0.230801091f, 0.392165095f},
-std::array<float,2>{0.656278014f, 0.983671188f},
-std::array<float,2>{0.998639047f, 0.0482013151f},
-std::array<float,2>{0.415434331f, 0.67467618f},
-std::array<float,2>{0.271355569f, 0.151337281f},
-std::array<float,2>{0.756007016f, 0.578338563f},
-std::array<float,2>{0.618775785f, 0.35919407f},
-std::array<float,2>{0.0469645262f, 0.769497275f},
-std::array<float,2>{0.206090331f, 0.0324460156f},
-std::array<float,2>{0.653311253f, 0.658456981f},
-std::array<float,2>{0.951689661f, 0.376550257f},
-std::array<float,2>{0.382246047f, 0.996344447f},
-std::array<float,2>{0.293638319f, 0.374296337f},
-std::array<float,2>{0.784745038f, 0.756081522f},
-std::array<float,2>{0.57480222f, 0.126429245f},
-std::array<float,2>{0.0274702962f, 0.57382381f},
-std::array<float,2>{0.103471048f, 0.487959564f},
-std::array<float,2>{0.511004031f, 0.920830846f},
-std::array<float,2>{0.827074945f, 0.0844057649f},
-std::array<float,2>{0.357740581f, 0.70110929f},
-std::array<float,2>{0.448548228f, 0.214003891f},
-std::array<float,2>{0.925288737f, 0.504947007f},
-std::array<float,2>{0.726616263f, 0.258078426f},
-std::array<float,2>{0.154744625f, 0.835439026f},
-std::array<float,2>{0.0373760499f, 0.157774687f},
-std::array<float,2>{0.605361819f, 0.60346365f},
-std::array<float,2>{0.773883879f, 0.33922863f},
-std::array<float,2>{0.261161715f, 0.807409942f},
-std::array<float,2>{0.421928823f, 0.430439025f},
-std::array<float,2>{0.974063694f, 0.960783541f},
-std::array<float,2>{0.687171102f, 0.0106704198f},
-std::array<float,2>{0.239250332f, 0.638190269f},
-std::array<float,2>{0.162182361f, 0.310511231f},
-std::array<float,2>{0.70692718f, 0.848158658f},
-std::array<float,2>{0.899751842f, 0.236576617f},
-std::array<float,2>{0.486680031f, 0.561124325f},
-std::array<float,2>{0.340271711f, 0.0999462456f},
-std::array<float,2>{0.846951306f, 0.745151401f},
-std::array<float,2>{0.531260967f, 0.464655489f},
-std::array<float,2>{0.088299498f, 0.901722252f},
-std::array<float,2>{0.126853466f, 0.160440087f},
-std::array<float,2>{0.744803369f, 0.606966734f},
-std::array<float,2>{0.921287119f, 0.340296775f},
-std::array<float,2>{0.465069175f, 0.811305165f},
-std::array<float,2>{0.367586344f, 0.434714615f},
-std::array<float,2>{0.837204039f, 0.954676211f},
-std::array<float,2>{0.517878592f, 0.0145800766f},
-std::array<float,2>{0.110492468f, 0.635434091f},
-std::array<float,2>{0.0123793073f, 0.305986851f},
-std::array<float,2>{0.58421272f, 0.847483456f},
-std::array<float,2>{0.808256149f, 0.238947302f},
-std::array<float,2>{0.306558102f, 0.555122197f},
-std::array<float,2>{0.399266988f, 0.0975842699f},
-std::array<float,2>{0.963409245f, 0.749578416f},
-std::array<float,2>{0.627828121f, 0.46527639f},
-std::array<float,2>{0.199704304f, 0.902407229f},
-std::array<float,2>{0.0703757703f, 0.0383112654f},
-std::array<float,2>{0.561176062f, 0.663076699f},
-std::array<float,2>{0.873496592f, 0.382702291f},
-std::array<float,2>{0.321074784f, 0.995948732f},
-std::array<float,2>{0.476572633f, 0.369183242f},
-std::array<float,2>{0.882722497f, 0.751532197f},
-std::array<float,2>{0.702292919f, 0.130435705f},
-std::array<float,2>{0.18691285f, 0.576979101f},
-std::array<float,2>{0.223422691f, 0.488585502f},
-std::array<float,2>{0.66688174f, 0.915752769f},
-std::array<float,2>{0.990281343f, 0.0796728507f},
-std::array<float,2>{0.412684292f, 0.69771874f},
-std::array<float,2>{0.275037736f, 0.216668829f},
-std::array<float,2>{0.765400827f, 0.502753019f},
-std::array<float,2>{0.609815955f, 0.263991296f},
-std::array<float,2>{0.059711881f, 0.829063773f},
-std::array<float,2>{0.212253213f, 0.0765086189f},
-std::array<float,2>{0.646803677f, 0.715780437f},
-std::array<float,2>{0.939447999f, 0.470652878f},
-std::array<float,2>{0.38932547f, 0.932590067f},
-std::array<float,2>{0.284001529f, 0.276192397f},
-std::array<float,2>{0.795170963f, 0.820141017f},
-std::array<float,2>{0.563919783f, 0.202231258f},
-std::array<float,2>{0.0199838243f, 0.523973048f},
-std::array<float,2>{0.0948712528f, 0.395912856f},
-std::array<float,2>{0.505060852f, 0.978868365f},
-std::array<float,2>{0.813546896f, 0.0538650751f},
-std::array<float,2>{0.350304842f, 0.677272916f},
-std::array<float,2>{0.437527865f, 0.15351446f},
-std::array<float,2>{0.932863653f, 0.582615733f},
-std::array<float,2>{0.719933271f, 0.353575408f},
-std::array<float,2>{0.144710958f, 0.771733224f},
-std::array<float,2>{0.0431621894f, 0.228771403f},
-std::array<float,2>{0.600322545f, 0.538407624f},
-std::array<float,2>{0.767663717f, 0.288988531f},
-std::array<float,2>{0.25392282f, 0.86297226f},
-std::array<float,2>{0.431422323f, 0.439007521f},
-std::array<float,2>{0.982615769f, 0.882387102f},
-std::array<float,2>{0.673510611f, 0.119135134f},
-std::array<float,2>{0.249772102f, 0.727046371f},
-std::array<float,2>{0.164342269f, 0.31422323f},
-std::array<float,2>{0.711261094f, 0.786324382f},
-std::array<float,2>{0.8959952f, 0.173512489f},
-std::array<float,2>{0.494594187f, 0.623580456f},
-std::array<float,2>{0.329455853f, 0.0245701727f},
-std::array<float,2>{0.855681181f, 0.645322025f},
-std::array<float,2>{0.543497741f, 0.417323798f},
-std::array<float,2>{0.0815985501f, 0.951196313f},
-std::array<float,2>{0.237604901f, 0.189965814f},
-std::array<float,2>{0.679921091f, 0.521455944f},
-std::array<float,2>{0.971225142f, 0.269277543f},
-std::array<float,2>{0.426305592f, 0.825093567f},
-std::array<float,2>{0.262765646f, 0.478485107f},
-std::array<float,2>{0.77925688f, 0.925971806f},
-std::array<float,2>{0.609182239f, 0.0650071576f},
-std::array<float,2>{0.0314530209f, 0.704601586f},
-std::array<float,2>{0.0914736614f, 0.351124823f},
-std::array<float,2>{0.537507653f, 0.777227759f},
-std::array<float,2>{0.851061821f, 0.141574055f},
-std::array<float,2>{0.337433279f, 0.58993566f},
-std::array<float,2>{0.488475859f, 0.0597967952f},
-std::array<float,2>{0.902826548f, 0.679872036f},
-std::array<float,2>{0.708699942f, 0.398957103f},
-std::array<float,2>{0.156293631f, 0.969671845f},
-std::array<float,2>{0.0262080822f, 0.109757222f},
-std::array<float,2>{0.573240519f, 0.724874794f},
-std::array<float,2>{0.787195086f, 0.453096867f},
-std::array<float,2>{0.292710215f, 0.88641417f},
-std::array<float,2>{0.378228873f, 0.292162269f},
-std::array<float,2>{0.947361708f, 0.874545395f},
-std::array<float,2>{0.651557028f, 0.224049181f},
-std::array<float,2>{0.208238631f, 0.544939935f},
-std::array<float,2>{0.150901034f, 0.409654349f},
-std::array<float,2>{0.731068909f, 0.938956022f},
-std::array<float,2>{0.926936209f, 0.0204833131f},
-std::array<float,2>{0.451878726f, 0.655276895f},
-std::array<float,2>{0.351651162f, 0.182761997f},
-std::array<float,2>{0.823302507f, 0.610473573f},
-std::array<float,2>{0.512344241f, 0.325980961f},
-std::array<float,2>{0.106144376f, 0.79490459f},
-std::array<float,2>{0.172082558f, 0.00320461951f},
-std::array<float,2>{0.687711298f, 0.626130641f},
-std::array<float,2>{0.889885068f, 0.424818277f},
-std::array<float,2>{0.471391946f, 0.96103549f},
-std::array<float,2>{0.317631543f, 0.333792299f},
-std::array<float,2>{0.864262521f, 0.800866365f},
-std::array<float,2>{0.548142016f, 0.169396102f},
-std::array<float,2>{0.0632276908f, 0.59851414f},
-std::array<float,2>{0.0541500598f, 0.458190024f},
-std::array<float,2>{0.62360698f, 0.891725481f},
-std::array<float,2>{0.751857996f, 0.10896638f},
-std::array<float,2>{0.266553491f, 0.737381816f},
-std::array<float,2>{0.418530375f, 0.248905525f},
-std::array<float,2>{0.994127095f, 0.554090559f},
-std::array<float,2>{0.66137743f, 0.301394969f},
-std::array<float,2>{0.229035974f, 0.851753116f},
-std::array<float,2>{0.119704351f, 0.137096688f},
-std::array<float,2>{0.52792263f, 0.565557122f},
-std::array<float,2>{0.831873775f, 0.359623253f},
-std::array<float,2>{0.364521891f, 0.762712479f},
-std::array<float,2>{0.460585773f, 0.390075266f},
-std::array<float,2>{0.913928211f, 0.98825115f},
-std::array<float,2>{0.738467336f, 0.0448946245f},
-std::array<float,2>{0.139318764f, 0.664136648f},
-std::array<float,2>{0.188340932f, 0.25571391f},
-std::array<float,2>{0.63340193f, 0.83748287f},
-std::array<float,2>{0.956309915f, 0.203871742f},
-std::array<float,2>{0.397714049f, 0.509787679f},
-std::array<float,2>{0.298696756f, 0.0904906243f},
-std::array<float,2>{0.797820389f, 0.692067742f},
-std::array<float,2>{0.590163946f, 0.497262776f},
-std::array<float,2>{0.00361616607f, 0.906306386f},
-std::array<float,2>{0.197233275f, 0.145504385f},
-std::array<float,2>{0.631977618f, 0.587144434f},
-std::array<float,2>{0.967970014f, 0.346416175f},
-std::array<float,2>{0.405199379f, 0.778876126f},
-std::array<float,2>{0.310695171f, 0.40502584f},
-std::array<float,2>{0.810454905f, 0.974451423f},
-std::array<float,2>{0.581270576f, 0.0571652949f},
-std::array<float,2>{0.0092178788f, 0.685508549f},
-std::array<float,2>{0.116814114f, 0.271770239f},
-std::array<float,2>{0.522112191f, 0.822868228f},
-std::array<float,2>{0.842521369f, 0.191423818f},
-std::array<float,2>{0.372997642f, 0.518544495f},
-std::array<float,2>{0.4631989f, 0.0697847158f},
-std::array<float,2>{0.915003479f, 0.707216024f},
-std::array<float,2>{0.748893082f, 0.482176989f},
-std::array<float,2>{0.130285621f, 0.923549533f},
-std::array<float,2>{0.0555775911f, 0.0194640737f},
-std::array<float,2>{0.61465925f, 0.651466787f},
-std::array<float,2>{0.757855713f, 0.413989931f},
-std::array<float,2>{0.277657926f, 0.941610157f},
-std::array<float,2>{0.40639472f, 0.321422815f},
-std::array<float,2>{0.988205135f, 0.792681456f},
-std::array<float,2>{0.67086792f, 0.186193973f},
-std::array<float,2>{0.221244588f, 0.614807844f},
-std::array<float,2>{0.182869941f, 0.448015302f},
-std::array<float,2>{0.696677089f, 0.887130618f},
-std::array<float,2>{0.87556082f, 0.114670128f},
-std::array<float,2>{0.482796073f, 0.720436931f},
-std::array<float,2>{0.327330619f, 0.222489804f},
-std::array<float,2>{0.867517412f, 0.541212797f},
-std::array<float,2>{0.557907522f, 0.294810563f},
-std::array<float,2>{0.0761477202f, 0.870715857f},
-std::array<float,2>{0.141349778f, 0.104826622f},
-std::array<float,2>{0.726312995f, 0.741810143f},
-std::array<float,2>{0.934391856f, 0.4557769f},
-std::array<float,2>{0.444323391f, 0.898216426f},
-std::array<float,2>{0.344888657f, 0.299260437f},
-std::array<float,2>{0.818537533f, 0.857115388f},
-std::array<float,2>{0.502943873f, 0.242417082f},
-std::array<float,2>{0.0988540053f, 0.548385203f},
-std::array<float,2>{0.0171141848f, 0.428816229f},
-std::array<float,2>{0.567531586f, 0.967936575f},
-std::array<float,2>{0.792887151f, 0.00635775365f},
-std::array<float,2>{0.285721183f, 0.630686522f},
-std::array<float,2>{0.383245587f, 0.165133566f},
-std::array<float,2>{0.942613125f, 0.596455872f},
-std::array<float,2>{0.643895566f, 0.330126584f},
-std::array<float,2>{0.21862188f, 0.799664497f},
-std::array<float,2>{0.0823778957f, 0.208690375f},
-std::array<float,2>{0.540144801f, 0.514389277f},
-std::array<float,2>{0.853271425f, 0.253209621f},
-std::array<float,2>{0.334022105f, 0.842849493f},
-std::array<float,2>{0.496133924f, 0.492304653f},
-std::array<float,2>{0.89076972f, 0.911651134f},
-std::array<float,2>{0.715391338f, 0.0876141489f},
-std::array<float,2>{0.170562938f, 0.68995738f},
-std::array<float,2>{0.243779883f, 0.366350621f},
-std::array<float,2>{0.676391125f, 0.760637879f},
-std::array<float,2>{0.978291869f, 0.133194551f},
-std::array<float,2>{0.433868647f, 0.567442954f},
-std::array<float,2>{0.250274301f, 0.0427303165f},
-std::array<float,2>{0.771460593f, 0.668117344f},
-std::array<float,2>{0.596589983f, 0.385290384f},
-std::array<float,2>{0.0404209755f, 0.991196752f},
-std::array<float,2>{0.161985502f, 0.23787725f},
-std::array<float,2>{0.703293264f, 0.561540544f},
-std::array<float,2>{0.900541008f, 0.308983743f},
-std::array<float,2>{0.485873163f, 0.848854542f},
-std::array<float,2>{0.343454212f, 0.462976366f},
-std::array<float,2>{0.845257938f, 0.901211381f},
-std::array<float,2>{0.534992278f, 0.10096021f},
-std::array<float,2>{0.0876435712f, 0.744995177f},
-std::array<float,2>{0.0357091166f, 0.338200301f},
-std::array<float,2>{0.601619422f, 0.808119118f},
-std::array<float,2>{0.775419533f, 0.157217607f},
-std::array<float,2>{0.259426057f, 0.602132082f},
-std::array<float,2>{0.425766945f, 0.0114025436f},
-std::array<float,2>{0.974918544f, 0.637003183f},
-std::array<float,2>{0.683758199f, 0.431078136f},
-std::array<float,2>{0.240596458f, 0.959653616f},
-std::array<float,2>{0.105333894f, 0.0850909352f},
-std::array<float,2>{0.508214653f, 0.700009346f},
-std::array<float,2>{0.825462878f, 0.486799002f},
-std::array<float,2>{0.356518775f, 0.92129153f},
-std::array<float,2>{0.447144151f, 0.25940913f},
-std::array<float,2>{0.922253489f, 0.834036231f},
-std::array<float,2>{0.729726434f, 0.213292226f},
-std::array<float,2>{0.153004587f, 0.504564226f},
-std::array<float,2>{0.204867855f, 0.375466704f},
-std::array<float,2>{0.654375076f, 0.997403622f},
-std::array<float,2>{0.950419247f, 0.0320358388f},
-std::array<float,2>{0.38007018f, 0.660081148f},
-std::array<float,2>{0.29497242f, 0.125272572f},
-std::array<float,2>{0.782064795f, 0.572546244f},
-std::array<float,2>{0.57631588f, 0.37383607f},
-std::array<float,2>{0.0295073148f, 0.756870687f},
-std::array<float,2>{0.234337911f, 0.0475546382f},
-std::array<float,2>{0.659450531f, 0.675185084f},
-std::array<float,2>{0.996867537f, 0.391343743f},
-std::array<float,2>{0.41705972f, 0.983212292f},
-std::array<float,2>{0.273038894f, 0.358008087f},
-std::array<float,2>{0.755373955f, 0.76845032f},
-std::array<float,2>{0.619508266f, 0.151991501f},
-std::array<float,2>{0.0493816063f, 0.579547346f},
-std::array<float,2>{0.0667658001f, 0.475481033f},
-std::array<float,2>{0.552583575f, 0.934963286f},
-std::array<float,2>{0.861785412f, 0.072743915f},
-std::array<float,2>{0.313333809f, 0.711178005f},
-std::array<float,2>{0.475833386f, 0.196298614f},
-std::array<float,2>{0.884400845f, 0.530318379f},
-std::array<float,2>{0.693689525f, 0.277545214f},
-std::array<float,2>{0.177483246f, 0.815109134f},
-std::array<float,2>{0.00618609181f, 0.176634088f},
-std::array<float,2>{0.587102294f, 0.620413005f},
-std::array<float,2>{0.804489195f, 0.319149673f},
-std::array<float,2>{0.304045528f, 0.784052432f},
-std::array<float,2>{0.39231807f, 0.420159578f},
-std::array<float,2>{0.958191991f, 0.94673419f},
-std::array<float,2>{0.640030801f, 0.0298030041f},
-std::array<float,2>{0.193166301f, 0.641598403f},
-std::array<float,2>{0.135103792f, 0.284144491f},
-std::array<float,2>{0.737668574f, 0.865326822f},
-std::array<float,2>{0.908218026f, 0.23283729f},
-std::array<float,2>{0.454058379f, 0.532458961f},
-std::array<float,2>{0.362776846f, 0.121533081f},
-std::array<float,2>{0.832475483f, 0.73185569f},
-std::array<float,2>{0.525071681f, 0.445200354f},
-std::array<float,2>{0.121660337f, 0.875384629f},
-std::array<float,2>{0.185529783f, 0.132579073f},
-std::array<float,2>{0.699556708f, 0.574952543f},
-std::array<float,2>{0.879653275f, 0.368110418f},
-std::array<float,2>{0.480453908f, 0.753417075f},
-std::array<float,2>{0.323990077f, 0.379040629f},
-std::array<float,2>{0.872915864f, 0.992880166f},
-std::array<float,2>{0.559484065f, 0.0352832638f},
-std::array<float,2>{0.072496824f, 0.660761654f},
-std::array<float,2>{0.0613829717f, 0.262025535f},
-std::array<float,2>{0.612818718f, 0.83176434f},
-std::array<float,2>{0.762709141f, 0.218559638f},
-std::array<float,2>{0.277044803f, 0.500763297f},
-std::array<float,2>{0.411925465f, 0.080534704f},
-std::array<float,2>{0.988951802f, 0.696223974f},
-std::array<float,2>{0.665926874f, 0.491782397f},
-std::array<float,2>{0.225350156f, 0.916751981f},
-std::array<float,2>{0.11262545f, 0.0128838448f},
-std::array<float,2>{0.515835643f, 0.633320272f},
-std::array<float,2>{0.839101255f, 0.436273873f},
-std::array<float,2>{0.369583637f, 0.956354499f},
-std::array<float,2>{0.467063546f, 0.343464941f},
-std::array<float,2>{0.919582486f, 0.809283674f},
-std::array<float,2>{0.743995905f, 0.163939312f},
-std::array<float,2>{0.128523275f, 0.607745886f},
-std::array<float,2>{0.201672167f, 0.467493206f},
-std::array<float,2>{0.625329435f, 0.905881703f},
-std::array<float,2>{0.961318076f, 0.0940684304f},
-std::array<float,2>{0.401130199f, 0.74777317f},
-std::array<float,2>{0.30791828f, 0.240281984f},
-std::array<float,2>{0.806151092f, 0.556692719f},
-std::array<float,2>{0.582818925f, 0.308287412f},
-std::array<float,2>{0.0153409047f, 0.845155895f},
-std::array<float,2>{0.246283367f, 0.11955554f},
-std::array<float,2>{0.674899518f, 0.729295969f},
-std::array<float,2>{0.98054862f, 0.439867318f},
-std::array<float,2>{0.432413518f, 0.879410207f},
-std::array<float,2>{0.255947143f, 0.287043124f},
-std::array<float,2>{0.76722151f, 0.860043824f},
-std::array<float,2>{0.598648787f, 0.22847724f},
-std::array<float,2>{0.045124691f, 0.536073625f},
-std::array<float,2>{0.0781336799f, 0.415523797f},
-std::array<float,2>{0.544931471f, 0.949635088f},
-std::array<float,2>{0.858812153f, 0.0266718529f},
-std::array<float,2>{0.331144065f, 0.647000372f},
-std::array<float,2>{0.492651582f, 0.17549023f},
-std::array<float,2>{0.897633553f, 0.622677267f},
-std::array<float,2>{0.71294564f, 0.315497875f},
-std::array<float,2>{0.166723788f, 0.788149297f},
-std::array<float,2>{0.0228264965f, 0.200734362f},
-std::array<float,2>{0.564950407f, 0.525811434f},
-std::array<float,2>{0.793886602f, 0.274733901f},
-std::array<float,2>{0.282858491f, 0.818197489f},
-std::array<float,2>{0.386750042f, 0.47128126f},
-std::array<float,2>{0.939979434f, 0.930580795f},
-std::array<float,2>{0.645323157f, 0.0754138306f},
-std::array<float,2>{0.214352161f, 0.717513382f},
-std::array<float,2>{0.148378208f, 0.352192432f},
-std::array<float,2>{0.722361445f, 0.769616008f},
-std::array<float,2>{0.93016243f, 0.154491097f},
-std::array<float,2>{0.440103292f, 0.585372329f},
-std::array<float,2>{0.348846972f, 0.0521166883f},
-std::array<float,2>{0.815685451f, 0.678934216f},
-std::array<float,2>{0.506278634f, 0.397436589f},
-std::array<float,2>{0.0960892439f, 0.977011263f},
-std::array<float,2>{0.210582644f, 0.226174459f},
-std::array<float,2>{0.649992168f, 0.54356426f},
-std::array<float,2>{0.94632262f, 0.289873719f},
-std::array<float,2>{0.375117153f, 0.872572422f},
-std::array<float,2>{0.28930223f, 0.450466454f},
-std::array<float,2>{0.786668897f, 0.883995891f},
-std::array<float,2>{0.571925938f, 0.111433603f},
-std::array<float,2>{0.0249762461f, 0.724373817f},
-std::array<float,2>{0.108921304f, 0.327052683f},
-std::array<float,2>{0.514284074f, 0.796163917f},
-std::array<float,2>{0.821994603f, 0.181337655f},
-std::array<float,2>{0.355096102f, 0.612315059f},
-std::array<float,2>{0.450066447f, 0.0219169166f},
-std::array<float,2>{0.928227723f, 0.652621686f},
-std::array<float,2>{0.732863963f, 0.407644928f},
-std::array<float,2>{0.150230378f, 0.940741479f},
-std::array<float,2>{0.0346994884f, 0.0628849342f},
-std::array<float,2>{0.605905712f, 0.706557512f},
-std::array<float,2>{0.779466391f, 0.479328632f},
-std::array<float,2>{0.263872474f, 0.928885996f},
-std::array<float,2>{0.429234087f, 0.266434669f},
-std::array<float,2>{0.96981132f, 0.826491773f},
-std::array<float,2>{0.682009161f, 0.189228341f},
-std::array<float,2>{0.234815732f, 0.522205174f},
-std::array<float,2>{0.158545539f, 0.400800377f},
-std::array<float,2>{0.710075498f, 0.970743954f},
-std::array<float,2>{0.905911624f, 0.0621316358f},
-std::array<float,2>{0.49213317f, 0.682440817f},
-std::array<float,2>{0.339339286f, 0.14450939f},
-std::array<float,2>{0.847684503f, 0.593565166f},
-std::array<float,2>{0.53607136f, 0.347793072f},
-std::array<float,2>{0.091870904f, 0.773883462f},
-std::array<float,2>{0.136941448f, 0.0451504923f},
-std::array<float,2>{0.741763532f, 0.667233706f},
-std::array<float,2>{0.911532104f, 0.387825191f},
-std::array<float,2>{0.458481967f, 0.985069096f},
-std::array<float,2>{0.366750509f, 0.361736357f},
-std::array<float,2>{0.829197288f, 0.765191257f},
-std::array<float,2>{0.529520273f, 0.139282003f},
-std::array<float,2>{0.118026644f, 0.562863886f},
-std::array<float,2>{0.00175984448f, 0.498753697f},
-std::array<float,2>{0.592551708f, 0.909601569f},
-std::array<float,2>{0.800262809f, 0.092341125f},
-std::array<float,2>{0.299301058f, 0.693377852f},
-std::array<float,2>{0.395795316f, 0.205083877f},
-std::array<float,2>{0.954189003f, 0.508509994f},
-std::array<float,2>{0.634890258f, 0.257667929f},
-std::array<float,2>{0.190649569f, 0.839567065f},
-std::array<float,2>{0.0663116425f, 0.171312094f},
-std::array<float,2>{0.549452066f, 0.599653304f},
-std::array<float,2>{0.865415573f, 0.334082693f},
-std::array<float,2>{0.319072902f, 0.802959859f},
-std::array<float,2>{0.469486028f, 0.42194131f},
-std::array<float,2>{0.887141228f, 0.963728309f},
-std::array<float,2>{0.690341234f, 0.00185606768f},
-std::array<float,2>{0.174418196f, 0.627135456f},
-std::array<float,2>{0.228048429f, 0.303308934f},
-std::array<float,2>{0.662864625f, 0.853763521f},
-std::array<float,2>{0.995257318f, 0.247849286f},
-std::array<float,2>{0.420210212f, 0.551089764f},
-std::array<float,2>{0.267644584f, 0.105697826f},
-std::array<float,2>{0.753701508f, 0.736038744f},
-std::array<float,2>{0.622056425f, 0.459736437f},
-std::array<float,2>{0.0511010848f, 0.893588006f},
-std::array<float,2>{0.219787732f, 0.183781072f},
-std::array<float,2>{0.669897854f, 0.615498722f},
-std::array<float,2>{0.984651625f, 0.322900623f},
-std::array<float,2>{0.408792913f, 0.790833771f},
-std::array<float,2>{0.280357212f, 0.41026178f},
-std::array<float,2>{0.760804176f, 0.944175124f},
-std::array<float,2>{0.615507782f, 0.017047096f},
-std::array<float,2>{0.0583239421f, 0.648905575f},
-std::array<float,2>{0.0775090307f, 0.296559662f},
-std::array<float,2>{0.555015385f, 0.868451118f},
-std::array<float,2>{0.869642198f, 0.219850525f},
-std::array<float,2>{0.325405329f, 0.53921622f},
-std::array<float,2>{0.481385082f, 0.116109006f},
-std::array<float,2>{0.878296614f, 0.721066236f},
-std::array<float,2>{0.697611392f, 0.445884317f},
-std::array<float,2>{0.181311011f, 0.890092492f},
-std::array<float,2>{0.0117123108f, 0.0555593558f},
-std::array<float,2>{0.57998234f, 0.685621977f},
-std::array<float,2>{0.810690641f, 0.403336555f},
-std::array<float,2>{0.310493857f, 0.974853456f},
-std::array<float,2>{0.402884752f, 0.344273508f},
-std::array<float,2>{0.965393424f, 0.779619098f},
-std::array<float,2>{0.630830646f, 0.148196444f},
-std::array<float,2>{0.198813543f, 0.588753819f},
-std::array<float,2>{0.131423101f, 0.483389914f},
-std::array<float,2>{0.746390641f, 0.924139559f},
-std::array<float,2>{0.916073501f, 0.0681968853f},
-std::array<float,2>{0.46255821f, 0.710923076f},
-std::array<float,2>{0.373470515f, 0.195238516f},
-std::array<float,2>{0.840135455f, 0.516409457f},
-std::array<float,2>{0.520087302f, 0.270537555f},
-std::array<float,2>{0.114865221f, 0.820842266f},
-std::array<float,2>{0.168991551f, 0.0880808979f},
-std::array<float,2>{0.717206061f, 0.688665867f},
-std::array<float,2>{0.89449358f, 0.494540364f},
-std::array<float,2>{0.498921692f, 0.913367569f},
-std::array<float,2>{0.33220768f, 0.251101077f},
-std::array<float,2>{0.854508936f, 0.841145337f},
-std::array<float,2>{0.542443871f, 0.20986861f},
-std::array<float,2>{0.0853052512f, 0.513074696f},
-std::array<float,2>{0.0410287455f, 0.384176701f},
-std::array<float,2>{0.595491409f, 0.989280581f},
-std::array<float,2>{0.771982968f, 0.0391205028f},
-std::array<float,2>{0.252897501f, 0.670518041f},
-std::array<float,2>{0.43636784f, 0.135942757f},
-std::array<float,2>{0.978638768f, 0.569530368f},
-std::array<float,2>{0.679062903f, 0.364925861f},
-std::array<float,2>{0.245250925f, 0.758237362f},
-std::array<float,2>{0.100793041f, 0.245352671f},
-std::array<float,2>{0.501194656f, 0.550746024f},
-std::array<float,2>{0.816982925f, 0.298220783f},
-std::array<float,2>{0.346871316f, 0.858564794f},
-std::array<float,2>{0.442255527f, 0.45400241f},
-std::array<float,2>{0.936920226f, 0.894742429f},
-std::array<float,2>{0.724421382f, 0.103171296f},
-std::array<float,2>{0.143802255f, 0.739156723f},
-std::array<float,2>{0.21522589f, 0.328906476f},
-std::array<float,2>{0.642163038f, 0.79825145f},
-std::array<float,2>{0.943956375f, 0.166191503f},
-std::array<float,2>{0.384969682f, 0.594049096f},
-std::array<float,2>{0.289048463f, 0.00406110333f},
-std::array<float,2>{0.790067554f, 0.632781386f},
-std::array<float,2>{0.56853497f, 0.426968724f},
-std::array<float,2>{0.0181730464f, 0.965352297f},
-std::array<float,2>{0.156031549f, 0.211733386f},
-std::array<float,2>{0.727837026f, 0.506022871f},
-std::array<float,2>{0.924168229f, 0.260534078f},
-std::array<float,2>{0.447362185f, 0.832093418f},
-std::array<float,2>{0.358410031f, 0.48487851f},
-std::array<float,2>{0.82747227f, 0.919484794f},
-std::array<float,2>{0.510534406f, 0.0836390406f},
-std::array<float,2>{0.101978101f, 0.701508343f},
-std::array<float,2>{0.0291912034f, 0.371634245f},
-std::array<float,2>{0.575850606f, 0.754305899f},
-std::array<float,2>{0.783554256f, 0.128613055f},
-std::array<float,2>{0.294348449f, 0.570520103f},
-std::array<float,2>{0.381459445f, 0.0334114768f},
-std::array<float,2>{0.952674866f, 0.657367766f},
-std::array<float,2>{0.653453946f, 0.377629131f},
-std::array<float,2>{0.205867663f, 0.998503089f},
-std::array<float,2>{0.0889600515f, 0.0981799513f},
-std::array<float,2>{0.53288424f, 0.742855728f},
-std::array<float,2>{0.846624136f, 0.462278128f},
-std::array<float,2>{0.341327369f, 0.899761617f},
-std::array<float,2>{0.487953931f, 0.311408401f},
-std::array<float,2>{0.898867965f, 0.85082531f},
-std::array<float,2>{0.705818295f, 0.235817313f},
-std::array<float,2>{0.163113981f, 0.559972405f},
-std::array<float,2>{0.239835486f, 0.433054507f},
-std::array<float,2>{0.686102271f, 0.957745135f},
-std::array<float,2>{0.972857118f, 0.00887147058f},
-std::array<float,2>{0.423259616f, 0.640037656f},
-std::array<float,2>{0.259771645f, 0.158800736f},
-std::array<float,2>{0.775098443f, 0.605364084f},
-std::array<float,2>{0.604330182f, 0.336213291f},
-std::array<float,2>{0.0388721861f, 0.805749238f},
-std::array<float,2>{0.193541467f, 0.0287359338f},
-std::array<float,2>{0.636742294f, 0.643883407f},
-std::array<float,2>{0.960653007f, 0.419635206f},
-std::array<float,2>{0.39316377f, 0.948446155f},
-std::array<float,2>{0.301155955f, 0.318312138f},
-std::array<float,2>{0.801653981f, 0.78312254f},
-std::array<float,2>{0.589378715f, 0.178767785f},
-std::array<float,2>{0.00500236126f, 0.618302643f},
-std::array<float,2>{0.124632761f, 0.442476511f},
-std::array<float,2>{0.527034581f, 0.87872541f},
-std::array<float,2>{0.835827947f, 0.123454474f},
-std::array<float,2>{0.360120088f, 0.732503057f},
-std::array<float,2>{0.456323624f, 0.230914399f},
-std::array<float,2>{0.907876551f, 0.53372705f},
-std::array<float,2>{0.734559655f, 0.282882065f},
-std::array<float,2>{0.134431973f, 0.865104377f},
-std::array<float,2>{0.0483484939f, 0.148759693f},
-std::array<float,2>{0.617410123f, 0.580103099f},
-std::array<float,2>{0.757731795f, 0.35733524f},
-std::array<float,2>{0.26988402f, 0.767224371f},
-std::array<float,2>{0.414940685f, 0.394270748f},
-std::array<float,2>{0.999814093f, 0.981498718f},
-std::array<float,2>{0.657705784f, 0.0492073298f},
-std::array<float,2>{0.231457278f, 0.673567057f},
-std::array<float,2>{0.178896099f, 0.279512674f},
-std::array<float,2>{0.6929546f, 0.812659323f},
-std::array<float,2>{0.884916663f, 0.197510242f},
-std::array<float,2>{0.472688764f, 0.528324962f},
-std::array<float,2>{0.31581521f, 0.0703802034f},
-std::array<float,2>{0.861041188f, 0.713547885f},
-std::array<float,2>{0.554213226f, 0.473700345f},
-std::array<float,2>{0.0686398968f, 0.936169028f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.191157445f, 0.303105235f},
-std::array<float,2>{0.871830106f, 0.70104599f},
-std::array<float,2>{0.648301899f, 0.0140334647f},
-std::array<float,2>{0.421116561f, 0.961445212f},
-std::array<float,2>{0.263887137f, 0.138507396f},
-std::array<float,2>{0.531473279f, 0.845739603f},
-std::array<float,2>{0.881110251f, 0.45527783f},
-std::array<float,2>{0.115368761f, 0.618646801f},
-std::array<float,2>{0.0354497321f, 0.0747522414f},
-std::array<float,2>{0.953560889f, 0.910600841f},
-std::array<float,2>{0.59100312f, 0.313915938f},
-std::array<float,2>{0.334078491f, 0.628795207f},
-std::array<float,2>{0.472327441f, 0.427740157f},
-std::array<float,2>{0.729574561f, 0.511069417f},
-std::array<float,2>{0.781323493f, 0.201207429f},
-std::array<float,2>{0.14353691f, 0.787183523f},
-std::array<float,2>{0.0725788996f, 0.475421369f},
-std::array<float,2>{0.909878254f, 0.562795818f},
-std::array<float,2>{0.528029561f, 0.182803705f},
-std::array<float,2>{0.282935768f, 0.841980755f},
-std::array<float,2>{0.404866457f, 0.0343379118f},
-std::array<float,2>{0.67693609f, 0.991430581f},
-std::array<float,2>{0.814178765f, 0.251906842f},
-std::array<float,2>{0.247279555f, 0.72200048f},
-std::array<float,2>{0.157336459f, 0.230642945f},
-std::array<float,2>{0.753671944f, 0.780488193f},
-std::array<float,2>{0.695316851f, 0.388913006f},
-std::array<float,2>{0.440017432f, 0.548671126f},
-std::array<float,2>{0.373172671f, 0.367600411f},
-std::array<float,2>{0.616902292f, 0.656993985f},
-std::array<float,2>{0.969468951f, 0.113279574f},
-std::array<float,2>{0.011647664f, 0.88776511f},
-std::array<float,2>{0.13454093f, 0.404468566f},
-std::array<float,2>{0.808766127f, 0.541738987f},
-std::array<float,2>{0.745732665f, 0.236332029f},
-std::array<float,2>{0.489149809f, 0.7622962f},
-std::array<float,2>{0.316821486f, 0.104079463f},
-std::array<float,2>{0.57249856f, 0.891377151f},
-std::array<float,2>{0.949298739f, 0.349300802f},
-std::array<float,2>{0.0510495119f, 0.680280924f},
-std::array<float,2>{0.108950943f, 0.165518969f},
-std::array<float,2>{0.891667366f, 0.82763797f},
-std::array<float,2>{0.550115705f, 0.48678124f},
-std::array<float,2>{0.275263697f, 0.583096266f},
-std::array<float,2>{0.430648446f, 0.274369538f},
-std::array<float,2>{0.63059175f, 0.735652149f},
-std::array<float,2>{0.858604848f, 0.0517829545f},
-std::array<float,2>{0.208222941f, 0.977358222f},
-std::array<float,2>{0.023201149f, 0.339247674f},
-std::array<float,2>{0.989313185f, 0.641685367f},
-std::array<float,2>{0.604130566f, 0.0791486353f},
-std::array<float,2>{0.358656079f, 0.932251334f},
-std::array<float,2>{0.466863275f, 0.203285828f},
-std::array<float,2>{0.714560211f, 0.797413647f},
-std::array<float,2>{0.768384039f, 0.40903452f},
-std::array<float,2>{0.175680593f, 0.528552532f},
-std::array<float,2>{0.228439331f, 0.0216050949f},
-std::array<float,2>{0.830594242f, 0.942887008f},
-std::array<float,2>{0.664351463f, 0.284904361f},
-std::array<float,2>{0.380515665f, 0.712337434f},
-std::array<float,2>{0.307403862f, 0.444776744f},
-std::array<float,2>{0.500808179f, 0.601673901f},
-std::array<float,2>{0.928810775f, 0.148411378f},
-std::array<float,2>{0.0916337967f, 0.866619408f},
-std::array<float,2>{0.185949847f, 0.355419904f},
-std::array<float,2>{0.773875535f, 0.67674017f},
-std::array<float,2>{0.709223449f, 0.097631909f},
-std::array<float,2>{0.460175306f, 0.905123591f},
-std::array<float,2>{0.34764713f, 0.242596596f},
-std::array<float,2>{0.595488191f, 0.756669521f},
-std::array<float,2>{0.996168554f, 0.392427385f},
-std::array<float,2>{0.0260795243f, 0.535629034f},
-std::array<float,2>{0.0828096196f, 0.0586375445f},
-std::array<float,2>{0.93460989f, 0.970742881f},
-std::array<float,2>{0.512466073f, 0.271792382f},
-std::array<float,2>{0.297139943f, 0.749759614f},
-std::array<float,2>{0.390395671f, 0.493763506f},
-std::array<float,2>{0.658533394f, 0.592813194f},
-std::array<float,2>{0.839754939f, 0.15997763f},
-std::array<float,2>{0.22150512f, 0.816541076f},
-std::array<float,2>{0.0575041361f, 0.42072317f},
-std::array<float,2>{0.938237906f, 0.523122311f},
-std::array<float,2>{0.568888783f, 0.215181962f},
-std::array<float,2>{0.322366744f, 0.811060309f},
-std::array<float,2>{0.492406785f, 0.0928782225f},
-std::array<float,2>{0.741871834f, 0.922403932f},
-std::array<float,2>{0.801288307f, 0.335236073f},
-std::array<float,2>{0.130538508f, 0.649202585f},
-std::array<float,2>{0.211457446f, 0.15195559f},
-std::array<float,2>{0.846793771f, 0.873181105f},
-std::array<float,2>{0.637532353f, 0.447833121f},
-std::array<float,2>{0.426737428f, 0.593806803f},
-std::array<float,2>{0.265974581f, 0.29185161f},
-std::array<float,2>{0.557447791f, 0.710397422f},
-std::array<float,2>{0.904028296f, 0.0301360935f},
-std::array<float,2>{0.0951630101f, 0.950107992f},
-std::array<float,2>{0.235699698f, 0.463291854f},
-std::array<float,2>{0.820856094f, 0.612007678f},
-std::array<float,2>{0.687306762f, 0.127955243f},
-std::array<float,2>{0.396922618f, 0.857052445f},
-std::array<float,2>{0.295830727f, 0.00560005708f},
-std::array<float,2>{0.523392439f, 0.960346937f},
-std::array<float,2>{0.92089057f, 0.305131733f},
-std::array<float,2>{0.0629804656f, 0.689541459f},
-std::array<float,2>{0.0043884092f, 0.19020173f},
-std::array<float,2>{0.978629947f, 0.793826103f},
-std::array<float,2>{0.6179896f, 0.4363572f},
-std::array<float,2>{0.360979229f, 0.503439903f},
-std::array<float,2>{0.449069023f, 0.323231429f},
-std::array<float,2>{0.688454747f, 0.634174347f},
-std::array<float,2>{0.761155069f, 0.0667501613f},
-std::array<float,2>{0.168746084f, 0.914362609f},
-std::array<float,2>{0.11983294f, 0.259659141f},
-std::array<float,2>{0.887867212f, 0.727073729f},
-std::array<float,2>{0.542749166f, 0.0419332311f},
-std::array<float,2>{0.25398773f, 0.995777011f},
-std::array<float,2>{0.413442105f, 0.173419416f},
-std::array<float,2>{0.649624825f, 0.833346486f},
-std::array<float,2>{0.864840329f, 0.479213387f},
-std::array<float,2>{0.200676233f, 0.572676182f},
-std::array<float,2>{0.153555945f, 0.124378763f},
-std::array<float,2>{0.791940808f, 0.881862164f},
-std::array<float,2>{0.719540954f, 0.362556189f},
-std::array<float,2>{0.483038366f, 0.670605183f},
-std::array<float,2>{0.338321865f, 0.376945794f},
-std::array<float,2>{0.581835687f, 0.561843574f},
-std::array<float,2>{0.962591052f, 0.223986849f},
-std::array<float,2>{0.0456886329f, 0.766674459f},
-std::array<float,2>{0.145622909f, 0.267533034f},
-std::array<float,2>{0.78524822f, 0.743867815f},
-std::array<float,2>{0.732202709f, 0.0560455024f},
-std::array<float,2>{0.474366665f, 0.975976169f},
-std::array<float,2>{0.330568433f, 0.161607638f},
-std::array<float,2>{0.58595407f, 0.814592123f},
-std::array<float,2>{0.959710181f, 0.497002095f},
-std::array<float,2>{0.0345498659f, 0.586557329f},
-std::array<float,2>{0.112178043f, 0.0979158804f},
-std::array<float,2>{0.878400564f, 0.901663721f},
-std::array<float,2>{0.536291599f, 0.359257579f},
-std::array<float,2>{0.257982194f, 0.673844457f},
-std::array<float,2>{0.415968806f, 0.395464212f},
-std::array<float,2>{0.642679632f, 0.533023059f},
-std::array<float,2>{0.870018363f, 0.249909893f},
-std::array<float,2>{0.193173662f, 0.753673434f},
-std::array<float,2>{0.0150889512f, 0.450876772f},
-std::array<float,2>{0.975143194f, 0.600974917f},
-std::array<float,2>{0.610233426f, 0.153378874f},
-std::array<float,2>{0.370561153f, 0.868779361f},
-std::array<float,2>{0.444404006f, 0.0268482435f},
-std::array<float,2>{0.701245546f, 0.948041618f},
-std::array<float,2>{0.755747855f, 0.294806898f},
-std::array<float,2>{0.161509573f, 0.704211354f},
-std::array<float,2>{0.245560452f, 0.211402103f},
-std::array<float,2>{0.816586792f, 0.806774616f},
-std::array<float,2>{0.672275245f, 0.415701568f},
-std::array<float,2>{0.39895156f, 0.515811443f},
-std::array<float,2>{0.28812179f, 0.331230223f},
-std::array<float,2>{0.525010288f, 0.655081213f},
-std::array<float,2>{0.913826108f, 0.0877307206f},
-std::array<float,2>{0.0762816891f, 0.926694214f},
-std::array<float,2>{0.203922212f, 0.432576746f},
-std::array<float,2>{0.852437735f, 0.507054925f},
-std::array<float,2>{0.62673223f, 0.191534892f},
-std::array<float,2>{0.434492469f, 0.79140836f},
-std::array<float,2>{0.280665249f, 0.0640486479f},
-std::array<float,2>{0.554431617f, 0.920691907f},
-std::array<float,2>{0.896655679f, 0.324764371f},
-std::array<float,2>{0.104339182f, 0.638356745f},
-std::array<float,2>{0.0469467603f, 0.131317616f},
-std::array<float,2>{0.947512269f, 0.853819489f},
-std::array<float,2>{0.574840248f, 0.465960056f},
-std::array<float,2>{0.312991261f, 0.614143372f},
-std::array<float,2>{0.486193985f, 0.309170812f},
-std::array<float,2>{0.746562302f, 0.695297897f},
-std::array<float,2>{0.805143714f, 0.000917952508f},
-std::array<float,2>{0.138477281f, 0.956227362f},
-std::array<float,2>{0.0863761976f, 0.365459323f},
-std::array<float,2>{0.922872782f, 0.6665892f},
-std::array<float,2>{0.506529272f, 0.11859218f},
-std::array<float,2>{0.309935272f, 0.87528652f},
-std::array<float,2>{0.376403928f, 0.222230211f},
-std::array<float,2>{0.668350041f, 0.771590769f},
-std::array<float,2>{0.834818959f, 0.381865621f},
-std::array<float,2>{0.232680306f, 0.557260215f},
-std::array<float,2>{0.1793966f, 0.0467518456f},
-std::array<float,2>{0.77285862f, 0.996721625f},
-std::array<float,2>{0.716445029f, 0.265506834f},
-std::array<float,2>{0.462548196f, 0.731283665f},
-std::array<float,2>{0.354785979f, 0.48313567f},
-std::array<float,2>{0.60637629f, 0.577835441f},
-std::array<float,2>{0.987677634f, 0.178970367f},
-std::array<float,2>{0.0175833441f, 0.831839919f},
-std::array<float,2>{0.226341262f, 0.318179786f},
-std::array<float,2>{0.84172219f, 0.631666362f},
-std::array<float,2>{0.660202801f, 0.0718865395f},
-std::array<float,2>{0.384240031f, 0.909598768f},
-std::array<float,2>{0.303136885f, 0.196805388f},
-std::array<float,2>{0.50940448f, 0.782495975f},
-std::array<float,2>{0.933575273f, 0.425298423f},
-std::array<float,2>{0.0806380808f, 0.514993131f},
-std::array<float,2>{0.0278195031f, 0.00896799844f},
-std::array<float,2>{0.992823184f, 0.965300322f},
-std::array<float,2>{0.598132074f, 0.298851579f},
-std::array<float,2>{0.349869817f, 0.697701633f},
-std::array<float,2>{0.453841239f, 0.457748204f},
-std::array<float,2>{0.703466475f, 0.622850478f},
-std::array<float,2>{0.780435622f, 0.134104788f},
-std::array<float,2>{0.180640563f, 0.849716127f},
-std::array<float,2>{0.10003943f, 0.385297328f},
-std::array<float,2>{0.902244627f, 0.551337123f},
-std::array<float,2>{0.562374413f, 0.22665301f},
-std::array<float,2>{0.271757424f, 0.773705959f},
-std::array<float,2>{0.424882889f, 0.116703749f},
-std::array<float,2>{0.635130167f, 0.885212302f},
-std::array<float,2>{0.851468623f, 0.374724537f},
-std::array<float,2>{0.217017338f, 0.660981953f},
-std::array<float,2>{0.12856251f, 0.183942497f},
-std::array<float,2>{0.798440039f, 0.836490154f},
-std::array<float,2>{0.734424889f, 0.46951893f},
-std::array<float,2>{0.497081786f, 0.569352448f},
-std::array<float,2>{0.327157766f, 0.25660035f},
-std::array<float,2>{0.56408906f, 0.726088881f},
-std::array<float,2>{0.943520904f, 0.0383412577f},
-std::array<float,2>{0.0599444509f, 0.986519575f},
-std::array<float,2>{0.167819828f, 0.492099643f},
-std::array<float,2>{0.764791906f, 0.578987062f},
-std::array<float,2>{0.693309605f, 0.16879569f},
-std::array<float,2>{0.4523938f, 0.823528767f},
-std::array<float,2>{0.364042044f, 0.0472082943f},
-std::array<float,2>{0.622054577f, 0.984368384f},
-std::array<float,2>{0.981936276f, 0.279406548f},
-std::array<float,2>{0.00213602767f, 0.740180612f},
-std::array<float,2>{0.0691105649f, 0.239502579f},
-std::array<float,2>{0.915895343f, 0.758853853f},
-std::array<float,2>{0.517995715f, 0.398658872f},
-std::array<float,2>{0.291814089f, 0.542976737f},
-std::array<float,2>{0.394166917f, 0.347188443f},
-std::array<float,2>{0.682967305f, 0.686388195f},
-std::array<float,2>{0.825061142f, 0.108243667f},
-std::array<float,2>{0.241573408f, 0.897315621f},
-std::array<float,2>{0.040202491f, 0.28765288f},
-std::array<float,2>{0.967630208f, 0.717728019f},
-std::array<float,2>{0.583496869f, 0.0175736733f},
-std::array<float,2>{0.341049016f, 0.940791249f},
-std::array<float,2>{0.477673531f, 0.143318012f},
-std::array<float,2>{0.726032436f, 0.8625561f},
-std::array<float,2>{0.794598103f, 0.438044906f},
-std::array<float,2>{0.150803804f, 0.606260955f},
-std::array<float,2>{0.197108984f, 0.0858253464f},
-std::array<float,2>{0.860923529f, 0.933819234f},
-std::array<float,2>{0.653819859f, 0.343244761f},
-std::array<float,2>{0.408691019f, 0.647264063f},
-std::array<float,2>{0.251217574f, 0.412594646f},
-std::array<float,2>{0.544745505f, 0.524108171f},
-std::array<float,2>{0.886276662f, 0.207362756f},
-std::array<float,2>{0.123288654f, 0.804683387f},
-std::array<float,2>{0.249156252f, 0.253441155f},
-std::array<float,2>{0.815125406f, 0.719497204f},
-std::array<float,2>{0.678259432f, 0.0315357782f},
-std::array<float,2>{0.403377235f, 0.989039242f},
-std::array<float,2>{0.284169853f, 0.180154443f},
-std::array<float,2>{0.530055881f, 0.841253638f},
-std::array<float,2>{0.907292128f, 0.472733885f},
-std::array<float,2>{0.07114961f, 0.565560758f},
-std::array<float,2>{0.0078581376f, 0.110753886f},
-std::array<float,2>{0.970945537f, 0.889571249f},
-std::array<float,2>{0.614557922f, 0.370794684f},
-std::array<float,2>{0.372476101f, 0.660026908f},
-std::array<float,2>{0.437752873f, 0.386933774f},
-std::array<float,2>{0.69745034f, 0.549185097f},
-std::array<float,2>{0.751845658f, 0.233809382f},
-std::array<float,2>{0.158963144f, 0.777354896f},
-std::array<float,2>{0.114530906f, 0.454023093f},
-std::array<float,2>{0.880827487f, 0.620460272f},
-std::array<float,2>{0.535109997f, 0.14044565f},
-std::array<float,2>{0.26330182f, 0.84439832f},
-std::array<float,2>{0.418157101f, 0.0118918866f},
-std::array<float,2>{0.646389663f, 0.963007152f},
-std::array<float,2>{0.873877287f, 0.300996125f},
-std::array<float,2>{0.189358652f, 0.701887965f},
-std::array<float,2>{0.141169026f, 0.200912863f},
-std::array<float,2>{0.784591556f, 0.785739064f},
-std::array<float,2>{0.727665901f, 0.427158296f},
-std::array<float,2>{0.469680071f, 0.508004308f},
-std::array<float,2>{0.333664149f, 0.315188408f},
-std::array<float,2>{0.593432426f, 0.625178218f},
-std::array<float,2>{0.955334246f, 0.078094542f},
-std::array<float,2>{0.0377515666f, 0.913424253f},
-std::array<float,2>{0.173566759f, 0.406488836f},
-std::array<float,2>{0.766455412f, 0.529382527f},
-std::array<float,2>{0.710938394f, 0.207010955f},
-std::array<float,2>{0.466362596f, 0.800543427f},
-std::array<float,2>{0.35596925f, 0.0814391002f},
-std::array<float,2>{0.603301585f, 0.930141807f},
-std::array<float,2>{0.991936862f, 0.336857945f},
-std::array<float,2>{0.0205902737f, 0.644436657f},
-std::array<float,2>{0.0920673311f, 0.144632086f},
-std::array<float,2>{0.926785409f, 0.863500297f},
-std::array<float,2>{0.503413081f, 0.442277819f},
-std::array<float,2>{0.305431932f, 0.60452348f},
-std::array<float,2>{0.380877525f, 0.282662392f},
-std::array<float,2>{0.666784525f, 0.714814365f},
-std::array<float,2>{0.829994559f, 0.020186197f},
-std::array<float,2>{0.229135916f, 0.943460405f},
-std::array<float,2>{0.0535516106f, 0.351299673f},
-std::array<float,2>{0.951954842f, 0.682991862f},
-std::array<float,2>{0.570620835f, 0.102268562f},
-std::array<float,2>{0.318887413f, 0.893915713f},
-std::array<float,2>{0.49171254f, 0.234589711f},
-std::array<float,2>{0.743255198f, 0.764470816f},
-std::array<float,2>{0.812287807f, 0.402945429f},
-std::array<float,2>{0.135985941f, 0.540109992f},
-std::array<float,2>{0.210229903f, 0.0542079695f},
-std::array<float,2>{0.855982959f, 0.978810191f},
-std::array<float,2>{0.63184756f, 0.276619554f},
-std::array<float,2>{0.433521003f, 0.738099277f},
-std::array<float,2>{0.275480092f, 0.484657049f},
-std::array<float,2>{0.547663987f, 0.585610449f},
-std::array<float,2>{0.893436134f, 0.16637376f},
-std::array<float,2>{0.105544478f, 0.824995458f},
-std::array<float,2>{0.13128674f, 0.332979798f},
-std::array<float,2>{0.8043859f, 0.651786625f},
-std::array<float,2>{0.739202678f, 0.0917521194f},
-std::array<float,2>{0.495202243f, 0.92410785f},
-std::array<float,2>{0.320456833f, 0.217825547f},
-std::array<float,2>{0.567447603f, 0.809290051f},
-std::array<float,2>{0.941383362f, 0.418875247f},
-std::array<float,2>{0.0551712587f, 0.520812571f},
-std::array<float,2>{0.0961138532f, 0.0288119223f},
-std::array<float,2>{0.906079829f, 0.952840209f},
-std::array<float,2>{0.555630744f, 0.289400607f},
-std::array<float,2>{0.267972171f, 0.707364142f},
-std::array<float,2>{0.429529846f, 0.446435243f},
-std::array<float,2>{0.640547693f, 0.595908403f},
-std::array<float,2>{0.844858646f, 0.150177732f},
-std::array<float,2>{0.214105859f, 0.872911692f},
-std::array<float,2>{0.0238198098f, 0.392939717f},
-std::array<float,2>{0.999232829f, 0.537945628f},
-std::array<float,2>{0.596231043f, 0.244696945f},
-std::array<float,2>{0.344849378f, 0.753961682f},
-std::array<float,2>{0.457713783f, 0.0938483998f},
-std::array<float,2>{0.707892239f, 0.902846932f},
-std::array<float,2>{0.776267171f, 0.353493571f},
-std::array<float,2>{0.184048235f, 0.678074241f},
-std::array<float,2>{0.219731435f, 0.157399923f},
-std::array<float,2>{0.83693558f, 0.818585575f},
-std::array<float,2>{0.656685293f, 0.495019943f},
-std::array<float,2>{0.388424903f, 0.590896726f},
-std::array<float,2>{0.3003622f, 0.271159619f},
-std::array<float,2>{0.515031874f, 0.747918844f},
-std::array<float,2>{0.936297894f, 0.0621610694f},
-std::array<float,2>{0.084149316f, 0.970226943f},
-std::array<float,2>{0.20264858f, 0.477257729f},
-std::array<float,2>{0.865942299f, 0.570370376f},
-std::array<float,2>{0.650740921f, 0.174676538f},
-std::array<float,2>{0.411111802f, 0.835264564f},
-std::array<float,2>{0.256399781f, 0.040264599f},
-std::array<float,2>{0.53958559f, 0.992913246f},
-std::array<float,2>{0.888712704f, 0.260251075f},
-std::array<float,2>{0.118472554f, 0.729534864f},
-std::array<float,2>{0.04445187f, 0.225878835f},
-std::array<float,2>{0.964091539f, 0.768631995f},
-std::array<float,2>{0.579569638f, 0.378645808f},
-std::array<float,2>{0.337379813f, 0.559342623f},
-std::array<float,2>{0.482028216f, 0.360757709f},
-std::array<float,2>{0.721902251f, 0.669382989f},
-std::array<float,2>{0.789921641f, 0.122358568f},
-std::array<float,2>{0.155395731f, 0.880233586f},
-std::array<float,2>{0.0653619692f, 0.307515144f},
-std::array<float,2>{0.919109225f, 0.687550426f},
-std::array<float,2>{0.519998729f, 0.00689907791f},
-std::array<float,2>{0.293913484f, 0.958812594f},
-std::array<float,2>{0.394618511f, 0.126286685f},
-std::array<float,2>{0.683946133f, 0.857943594f},
-std::array<float,2>{0.822352052f, 0.461449057f},
-std::array<float,2>{0.237397164f, 0.609388053f},
-std::array<float,2>{0.170001984f, 0.0702832192f},
-std::array<float,2>{0.758955121f, 0.916194558f},
-std::array<float,2>{0.690888107f, 0.321003973f},
-std::array<float,2>{0.446330935f, 0.636244476f},
-std::array<float,2>{0.361965507f, 0.434812725f},
-std::array<float,2>{0.620716751f, 0.50097388f},
-std::array<float,2>{0.977814078f, 0.188429132f},
-std::array<float,2>{0.00749802031f, 0.79540652f},
-std::array<float,2>{0.163516253f, 0.296578437f},
-std::array<float,2>{0.757339954f, 0.706957042f},
-std::array<float,2>{0.699875772f, 0.0245795865f},
-std::array<float,2>{0.442904651f, 0.945852816f},
-std::array<float,2>{0.36910817f, 0.155405685f},
-std::array<float,2>{0.612047851f, 0.870497406f},
-std::array<float,2>{0.974460661f, 0.45191735f},
-std::array<float,2>{0.0129804583f, 0.599308968f},
-std::array<float,2>{0.0759774074f, 0.0888518393f},
-std::array<float,2>{0.910699487f, 0.929498494f},
-std::array<float,2>{0.52697432f, 0.328404248f},
-std::array<float,2>{0.286876112f, 0.653285325f},
-std::array<float,2>{0.401256979f, 0.416966349f},
-std::array<float,2>{0.675042868f, 0.518851221f},
-std::array<float,2>{0.819729686f, 0.214085177f},
-std::array<float,2>{0.243244797f, 0.8063218f},
-std::array<float,2>{0.0327386297f, 0.499219924f},
-std::array<float,2>{0.957891345f, 0.588315785f},
-std::array<float,2>{0.589560032f, 0.163215175f},
-std::array<float,2>{0.329394519f, 0.813624322f},
-std::array<float,2>{0.475417554f, 0.0572110303f},
-std::array<float,2>{0.733255386f, 0.972829044f},
-std::array<float,2>{0.788110316f, 0.268629164f},
-std::array<float,2>{0.148016453f, 0.745649517f},
-std::array<float,2>{0.194808379f, 0.24615185f},
-std::array<float,2>{0.867589772f, 0.750964403f},
-std::array<float,2>{0.641453683f, 0.397103727f},
-std::array<float,2>{0.416580975f, 0.534243226f},
-std::array<float,2>{0.260196209f, 0.356572121f},
-std::array<float,2>{0.537883043f, 0.672505379f},
-std::array<float,2>{0.876190305f, 0.101560645f},
-std::array<float,2>{0.109682791f, 0.899969101f},
-std::array<float,2>{0.231148139f, 0.380588561f},
-std::array<float,2>{0.832857251f, 0.5548715f},
-std::array<float,2>{0.670646191f, 0.219831079f},
-std::array<float,2>{0.377200067f, 0.76973474f},
-std::array<float,2>{0.312128723f, 0.120382421f},
-std::array<float,2>{0.504505813f, 0.877582192f},
-std::array<float,2>{0.925435662f, 0.364914417f},
-std::array<float,2>{0.0885693952f, 0.665323794f},
-std::array<float,2>{0.0164102595f, 0.176328853f},
-std::array<float,2>{0.98524034f, 0.829814672f},
-std::array<float,2>{0.608637869f, 0.481419712f},
-std::array<float,2>{0.352099359f, 0.574821174f},
-std::array<float,2>{0.46381256f, 0.262887895f},
-std::array<float,2>{0.7176494f, 0.732979298f},
-std::array<float,2>{0.769566596f, 0.0442337655f},
-std::array<float,2>{0.177284285f, 0.999834418f},
-std::array<float,2>{0.102636993f, 0.327260971f},
-std::array<float,2>{0.89598304f, 0.639893293f},
-std::array<float,2>{0.551639974f, 0.0651829392f},
-std::array<float,2>{0.278818399f, 0.919609547f},
-std::array<float,2>{0.436687708f, 0.193545133f},
-std::array<float,2>{0.628027439f, 0.789455831f},
-std::array<float,2>{0.853910625f, 0.430346131f},
-std::array<float,2>{0.205426291f, 0.505523026f},
-std::array<float,2>{0.140473425f, 0.0020394919f},
-std::array<float,2>{0.80671078f, 0.953470588f},
-std::array<float,2>{0.749524236f, 0.31200847f},
-std::array<float,2>{0.486751497f, 0.691588998f},
-std::array<float,2>{0.315263152f, 0.467158467f},
-std::array<float,2>{0.576599896f, 0.616887212f},
-std::array<float,2>{0.947107553f, 0.130085245f},
-std::array<float,2>{0.049719926f, 0.853049576f},
-std::array<float,2>{0.216775894f, 0.371497035f},
-std::array<float,2>{0.848673582f, 0.663047254f},
-std::array<float,2>{0.634034872f, 0.114885248f},
-std::array<float,2>{0.422333926f, 0.884614646f},
-std::array<float,2>{0.269830912f, 0.230263472f},
-std::array<float,2>{0.560202479f, 0.77598846f},
-std::array<float,2>{0.8990376f, 0.383414447f},
-std::array<float,2>{0.0993658528f, 0.554438412f},
-std::array<float,2>{0.0616762042f, 0.0356549025f},
-std::array<float,2>{0.941708207f, 0.98487854f},
-std::array<float,2>{0.566401899f, 0.255613148f},
-std::array<float,2>{0.324881196f, 0.723828256f},
-std::array<float,2>{0.498753965f, 0.472306758f},
-std::array<float,2>{0.736844838f, 0.566633701f},
-std::array<float,2>{0.799859524f, 0.18727003f},
-std::array<float,2>{0.125665307f, 0.839811623f},
-std::array<float,2>{0.0787466764f, 0.422190219f},
-std::array<float,2>{0.931274652f, 0.512090921f},
-std::array<float,2>{0.511182725f, 0.198386773f},
-std::array<float,2>{0.301587403f, 0.783966482f},
-std::array<float,2>{0.385760337f, 0.0738320276f},
-std::array<float,2>{0.663794696f, 0.906579971f},
-std::array<float,2>{0.843616009f, 0.319769681f},
-std::array<float,2>{0.223360807f, 0.629730403f},
-std::array<float,2>{0.182212859f, 0.136518657f},
-std::array<float,2>{0.778455257f, 0.847820461f},
-std::array<float,2>{0.706496835f, 0.460908473f},
-std::array<float,2>{0.455602765f, 0.623804808f},
-std::array<float,2>{0.347749919f, 0.297853351f},
-std::array<float,2>{0.600174606f, 0.696388423f},
-std::array<float,2>{0.995259464f, 0.0111647332f},
-std::array<float,2>{0.0297293123f, 0.96855557f},
-std::array<float,2>{0.14875412f, 0.440953165f},
-std::array<float,2>{0.796210349f, 0.607521594f},
-std::array<float,2>{0.724339545f, 0.140652463f},
-std::array<float,2>{0.479791611f, 0.859954476f},
-std::array<float,2>{0.342276156f, 0.0177758168f},
-std::array<float,2>{0.585291743f, 0.938424528f},
-std::array<float,2>{0.96521008f, 0.285708368f},
-std::array<float,2>{0.0420694686f, 0.71500659f},
-std::array<float,2>{0.122889765f, 0.209337115f},
-std::array<float,2>{0.883785784f, 0.802112639f},
-std::array<float,2>{0.54659164f, 0.412108183f},
-std::array<float,2>{0.25389871f, 0.52655828f},
-std::array<float,2>{0.408147603f, 0.340648472f},
-std::array<float,2>{0.656177223f, 0.646155477f},
-std::array<float,2>{0.861680806f, 0.0838128254f},
-std::array<float,2>{0.197425261f, 0.936603189f},
-std::array<float,2>{0.00116686081f, 0.279295444f},
-std::array<float,2>{0.983611703f, 0.741322398f},
-std::array<float,2>{0.624876976f, 0.049974259f},
-std::array<float,2>{0.366220623f, 0.980559468f},
-std::array<float,2>{0.450749069f, 0.170058817f},
-std::array<float,2>{0.695097566f, 0.820602298f},
-std::array<float,2>{0.76296401f, 0.488924593f},
-std::array<float,2>{0.16420491f, 0.580342591f},
-std::array<float,2>{0.240035921f, 0.105630837f},
-std::array<float,2>{0.827380896f, 0.89574331f},
-std::array<float,2>{0.680492163f, 0.345340848f},
-std::array<float,2>{0.391322851f, 0.685521245f},
-std::array<float,2>{0.289637655f, 0.402219504f},
-std::array<float,2>{0.516463161f, 0.545407474f},
-std::array<float,2>{0.916945219f, 0.24056305f},
-std::array<float,2>{0.0673544407f, 0.761587381f},
-std::array<float,2>{0.229688287f, 0.283218354f},
-std::array<float,2>{0.828871906f, 0.711751044f},
-std::array<float,2>{0.667051315f, 0.0234294236f},
-std::array<float,2>{0.382341534f, 0.94174093f},
-std::array<float,2>{0.306058437f, 0.146762073f},
-std::array<float,2>{0.502904773f, 0.866176724f},
-std::array<float,2>{0.925984979f, 0.444143742f},
-std::array<float,2>{0.09348239f, 0.602677345f},
-std::array<float,2>{0.0195637867f, 0.0787849575f},
-std::array<float,2>{0.990335882f, 0.932954073f},
-std::array<float,2>{0.602454603f, 0.338180244f},
-std::array<float,2>{0.357352942f, 0.64096427f},
-std::array<float,2>{0.465127617f, 0.409698278f},
-std::array<float,2>{0.712139785f, 0.527841032f},
-std::array<float,2>{0.767274976f, 0.204377219f},
-std::array<float,2>{0.172700986f, 0.798714697f},
-std::array<float,2>{0.106613562f, 0.487427086f},
-std::array<float,2>{0.893942833f, 0.582302451f},
-std::array<float,2>{0.548744917f, 0.164449096f},
-std::array<float,2>{0.277275145f, 0.826883018f},
-std::array<float,2>{0.431851506f, 0.0513743833f},
-std::array<float,2>{0.630908728f, 0.977835536f},
-std::array<float,2>{0.856774569f, 0.274579436f},
-std::array<float,2>{0.209801853f, 0.735174835f},
-std::array<float,2>{0.135345042f, 0.237656549f},
-std::array<float,2>{0.810988367f, 0.763112247f},
-std::array<float,2>{0.742518485f, 0.405707806f},
-std::array<float,2>{0.490511596f, 0.542517662f},
-std::array<float,2>{0.319623858f, 0.348101377f},
-std::array<float,2>{0.571569979f, 0.681586266f},
-std::array<float,2>{0.952776611f, 0.10496562f},
-std::array<float,2>{0.0544693246f, 0.891650677f},
-std::array<float,2>{0.159837857f, 0.389773965f},
-std::array<float,2>{0.750826716f, 0.547317028f},
-std::array<float,2>{0.698437393f, 0.231596485f},
-std::array<float,2>{0.439109325f, 0.780133307f},
-std::array<float,2>{0.371133149f, 0.111742057f},
-std::array<float,2>{0.613637626f, 0.886782765f},
-std::array<float,2>{0.971731246f, 0.368932098f},
-std::array<float,2>{0.00892000645f, 0.657560766f},
-std::array<float,2>{0.0721248463f, 0.182087541f},
-std::array<float,2>{0.906737149f, 0.843738198f},
-std::array<float,2>{0.530358911f, 0.475873888f},
-std::array<float,2>{0.284929037f, 0.563785672f},
-std::array<float,2>{0.40251106f, 0.250826359f},
-std::array<float,2>{0.679152548f, 0.721185029f},
-std::array<float,2>{0.815704942f, 0.0335575715f},
-std::array<float,2>{0.248907045f, 0.991054296f},
-std::array<float,2>{0.0383604765f, 0.31324929f},
-std::array<float,2>{0.956645131f, 0.627155721f},
-std::array<float,2>{0.591837943f, 0.076155588f},
-std::array<float,2>{0.332113326f, 0.911758423f},
-std::array<float,2>{0.470149636f, 0.20259653f},
-std::array<float,2>{0.727267802f, 0.789005816f},
-std::array<float,2>{0.783485353f, 0.429113388f},
-std::array<float,2>{0.142534733f, 0.509870768f},
-std::array<float,2>{0.187730759f, 0.0155214071f},
-std::array<float,2>{0.874637783f, 0.961987376f},
-std::array<float,2>{0.645365775f, 0.30381012f},
-std::array<float,2>{0.419903696f, 0.699461162f},
-std::array<float,2>{0.261941761f, 0.456768245f},
-std::array<float,2>{0.533558309f, 0.617908895f},
-std::array<float,2>{0.879277945f, 0.137185365f},
-std::array<float,2>{0.113735162f, 0.847444475f},
-std::array<float,2>{0.154622123f, 0.361882806f},
-std::array<float,2>{0.790790021f, 0.671710372f},
-std::array<float,2>{0.72148931f, 0.123792507f},
-std::array<float,2>{0.481058717f, 0.88144958f},
-std::array<float,2>{0.336882919f, 0.222969919f},
-std::array<float,2>{0.578605473f, 0.765927732f},
-std::array<float,2>{0.96384275f, 0.37546891f},
-std::array<float,2>{0.0437028296f, 0.561204135f},
-std::array<float,2>{0.117760643f, 0.0424100086f},
-std::array<float,2>{0.889757216f, 0.994658172f},
-std::array<float,2>{0.540167749f, 0.258091241f},
-std::array<float,2>{0.257772297f, 0.727771699f},
-std::array<float,2>{0.411261708f, 0.479689479f},
-std::array<float,2>{0.651797414f, 0.57343024f},
-std::array<float,2>{0.866821706f, 0.17270872f},
-std::array<float,2>{0.201337412f, 0.832368433f},
-std::array<float,2>{0.00602723099f, 0.437302887f},
-std::array<float,2>{0.977250934f, 0.502322853f},
-std::array<float,2>{0.620028019f, 0.190988168f},
-std::array<float,2>{0.362484425f, 0.794893265f},
-std::array<float,2>{0.446138918f, 0.0681672171f},
-std::array<float,2>{0.69014591f, 0.915687025f},
-std::array<float,2>{0.758211315f, 0.323552608f},
-std::array<float,2>{0.171045646f, 0.633658469f},
-std::array<float,2>{0.237183288f, 0.127340838f},
-std::array<float,2>{0.823909044f, 0.85568285f},
-std::array<float,2>{0.685099304f, 0.464807689f},
-std::array<float,2>{0.396045804f, 0.612444341f},
-std::array<float,2>{0.294430315f, 0.305901319f},
-std::array<float,2>{0.521027327f, 0.690537095f},
-std::array<float,2>{0.918691576f, 0.00459834142f},
-std::array<float,2>{0.0658377111f, 0.959547043f},
-std::array<float,2>{0.213570088f, 0.448618174f},
-std::array<float,2>{0.844586015f, 0.595111609f},
-std::array<float,2>{0.639260828f, 0.150580853f},
-std::array<float,2>{0.427836031f, 0.874701321f},
-std::array<float,2>{0.269355118f, 0.0303053036f},
-std::array<float,2>{0.556539357f, 0.950291157f},
-std::array<float,2>{0.905057788f, 0.292426854f},
-std::array<float,2>{0.0974047035f, 0.709788859f},
-std::array<float,2>{0.0565591417f, 0.215997592f},
-std::array<float,2>{0.939830184f, 0.81160897f},
-std::array<float,2>{0.566832602f, 0.420934886f},
-std::array<float,2>{0.32156533f, 0.521625161f},
-std::array<float,2>{0.494439214f, 0.334227085f},
-std::array<float,2>{0.740010798f, 0.649630785f},
-std::array<float,2>{0.803643465f, 0.0927583352f},
-std::array<float,2>{0.132812232f, 0.923292398f},
-std::array<float,2>{0.0850355178f, 0.272486418f},
-std::array<float,2>{0.937357068f, 0.748844683f},
-std::array<float,2>{0.514146447f, 0.060046453f},
-std::array<float,2>{0.299487799f, 0.971934974f},
-std::array<float,2>{0.387578845f, 0.158641413f},
-std::array<float,2>{0.657559097f, 0.817717016f},
-std::array<float,2>{0.836700618f, 0.492555052f},
-std::array<float,2>{0.218906656f, 0.592239201f},
-std::array<float,2>{0.185245037f, 0.0962992832f},
-std::array<float,2>{0.776947498f, 0.90571481f},
-std::array<float,2>{0.708086371f, 0.354266793f},
-std::array<float,2>{0.458810508f, 0.677137733f},
-std::array<float,2>{0.344057709f, 0.39110139f},
-std::array<float,2>{0.597056508f, 0.536880195f},
-std::array<float,2>{0.998730063f, 0.243667498f},
-std::array<float,2>{0.025166655f, 0.757720888f},
-std::array<float,2>{0.176680326f, 0.264249563f},
-std::array<float,2>{0.77116394f, 0.731672406f},
-std::array<float,2>{0.718290567f, 0.0453788377f},
-std::array<float,2>{0.464442641f, 0.997174859f},
-std::array<float,2>{0.353182793f, 0.178568617f},
-std::array<float,2>{0.608027995f, 0.83091563f},
-std::array<float,2>{0.986106634f, 0.483767033f},
-std::array<float,2>{0.0173592661f, 0.576885879f},
-std::array<float,2>{0.0895380601f, 0.117965743f},
-std::array<float,2>{0.924424052f, 0.876843631f},
-std::array<float,2>{0.505501628f, 0.367133409f},
-std::array<float,2>{0.310606897f, 0.667743742f},
-std::array<float,2>{0.378275365f, 0.381371826f},
-std::array<float,2>{0.671254575f, 0.557656705f},
-std::array<float,2>{0.833733618f, 0.221595839f},
-std::array<float,2>{0.232161164f, 0.772746503f},
-std::array<float,2>{0.0505802967f, 0.465221703f},
-std::array<float,2>{0.945756137f, 0.61495465f},
-std::array<float,2>{0.577567518f, 0.13257955f},
-std::array<float,2>{0.315931648f, 0.855232537f},
-std::array<float,2>{0.487864763f, 0.00113856909f},
-std::array<float,2>{0.748355746f, 0.955511689f},
-std::array<float,2>{0.80812484f, 0.309735f},
-std::array<float,2>{0.139244467f, 0.693423927f},
-std::array<float,2>{0.206180677f, 0.192846373f},
-std::array<float,2>{0.854601383f, 0.79206562f},
-std::array<float,2>{0.627151489f, 0.433374822f},
-std::array<float,2>{0.436326891f, 0.506259561f},
-std::array<float,2>{0.278055042f, 0.325423062f},
-std::array<float,2>{0.551921189f, 0.637120664f},
-std::array<float,2>{0.894732356f, 0.0627450943f},
-std::array<float,2>{0.102105573f, 0.921457112f},
-std::array<float,2>{0.242670894f, 0.41498515f},
-std::array<float,2>{0.818861306f, 0.517053664f},
-std::array<float,2>{0.673997939f, 0.21261999f},
-std::array<float,2>{0.402196229f, 0.808110058f},
-std::array<float,2>{0.285505772f, 0.0868028253f},
-std::array<float,2>{0.52562958f, 0.926954091f},
-std::array<float,2>{0.911584675f, 0.330841959f},
-std::array<float,2>{0.0748654157f, 0.655674338f},
-std::array<float,2>{0.0121029224f, 0.152553022f},
-std::array<float,2>{0.973378837f, 0.867872775f},
-std::array<float,2>{0.613279462f, 0.449468791f},
-std::array<float,2>{0.367231578f, 0.600140631f},
-std::array<float,2>{0.442242026f, 0.293873698f},
-std::array<float,2>{0.70083034f, 0.703353822f},
-std::array<float,2>{0.756624103f, 0.0259231515f},
-std::array<float,2>{0.162729636f, 0.948976755f},
-std::array<float,2>{0.111113019f, 0.358389169f},
-std::array<float,2>{0.875653148f, 0.675039291f},
-std::array<float,2>{0.538433611f, 0.0989029929f},
-std::array<float,2>{0.261654139f, 0.900782585f},
-std::array<float,2>{0.417892605f, 0.248597115f},
-std::array<float,2>{0.642339945f, 0.752651036f},
-std::array<float,2>{0.868802845f, 0.395920008f},
-std::array<float,2>{0.194210395f, 0.531439543f},
-std::array<float,2>{0.146610081f, 0.0549065471f},
-std::array<float,2>{0.788081229f, 0.975561738f},
-std::array<float,2>{0.733576119f, 0.265882224f},
-std::array<float,2>{0.476443172f, 0.742518604f},
-std::array<float,2>{0.32823512f, 0.497276127f},
-std::array<float,2>{0.588665009f, 0.587143302f},
-std::array<float,2>{0.958069384f, 0.160275206f},
-std::array<float,2>{0.0317848735f, 0.816386521f},
-std::array<float,2>{0.19825539f, 0.342662811f},
-std::array<float,2>{0.862759233f, 0.648377359f},
-std::array<float,2>{0.654759645f, 0.0844377056f},
-std::array<float,2>{0.4064776f, 0.934787869f},
-std::array<float,2>{0.252793372f, 0.208431914f},
-std::array<float,2>{0.545355797f, 0.803108513f},
-std::array<float,2>{0.88461709f, 0.413772792f},
-std::array<float,2>{0.121414043f, 0.525167167f},
-std::array<float,2>{0.0416580886f, 0.0157104246f},
-std::array<float,2>{0.966619074f, 0.939732015f},
-std::array<float,2>{0.584673762f, 0.288983822f},
-std::array<float,2>{0.343091935f, 0.717975199f},
-std::array<float,2>{0.479054153f, 0.438490212f},
-std::array<float,2>{0.723218739f, 0.607351959f},
-std::array<float,2>{0.795192659f, 0.143992618f},
-std::array<float,2>{0.149523988f, 0.861423373f},
-std::array<float,2>{0.0679988936f, 0.399722129f},
-std::array<float,2>{0.917777777f, 0.544815779f},
-std::array<float,2>{0.517508864f, 0.238956034f},
-std::array<float,2>{0.290213257f, 0.758221805f},
-std::array<float,2>{0.392556697f, 0.108746924f},
-std::array<float,2>{0.681115627f, 0.897845924f},
-std::array<float,2>{0.826211154f, 0.346621364f},
-std::array<float,2>{0.238448948f, 0.686544001f},
-std::array<float,2>{0.165489599f, 0.169428602f},
-std::array<float,2>{0.762098014f, 0.82240212f},
-std::array<float,2>{0.693432331f, 0.491127372f},
-std::array<float,2>{0.449590623f, 0.580025673f},
-std::array<float,2>{0.365453362f, 0.280875683f},
-std::array<float,2>{0.623690128f, 0.739066839f},
-std::array<float,2>{0.982582748f, 0.0483169891f},
-std::array<float,2>{0.000705899321f, 0.982512534f},
-std::array<float,2>{0.126474813f, 0.470475912f},
-std::array<float,2>{0.799514949f, 0.56908232f},
-std::array<float,2>{0.738031983f, 0.185320392f},
-std::array<float,2>{0.499260545f, 0.837033927f},
-std::array<float,2>{0.326030344f, 0.0378676988f},
-std::array<float,2>{0.564777613f, 0.988087296f},
-std::array<float,2>{0.942682445f, 0.257537037f},
-std::array<float,2>{0.0609085485f, 0.725313544f},
-std::array<float,2>{0.0977813527f, 0.228476286f},
-std::array<float,2>{0.899611592f, 0.775137961f},
-std::array<float,2>{0.558964312f, 0.38603282f},
-std::array<float,2>{0.270775229f, 0.552286863f},
-std::array<float,2>{0.423626304f, 0.373628855f},
-std::array<float,2>{0.633083999f, 0.661228836f},
-std::array<float,2>{0.8480528f, 0.115865737f},
-std::array<float,2>{0.215408042f, 0.886365712f},
-std::array<float,2>{0.030428797f, 0.300287932f},
-std::array<float,2>{0.99433434f, 0.698745728f},
-std::array<float,2>{0.601217508f, 0.00849762f},
-std::array<float,2>{0.349011034f, 0.966033399f},
-std::array<float,2>{0.456202298f, 0.133084819f},
-std::array<float,2>{0.706029236f, 0.850673378f},
-std::array<float,2>{0.777914286f, 0.45846805f},
-std::array<float,2>{0.183271036f, 0.621530175f},
-std::array<float,2>{0.22393091f, 0.0704254806f},
-std::array<float,2>{0.841847837f, 0.908782184f},
-std::array<float,2>{0.662351012f, 0.317360252f},
-std::array<float,2>{0.385112137f, 0.631839395f},
-std::array<float,2>{0.302193433f, 0.424067676f},
-std::array<float,2>{0.510676324f, 0.514273345f},
-std::array<float,2>{0.929803729f, 0.196011111f},
-std::array<float,2>{0.0795560777f, 0.781737328f},
-std::array<float,2>{0.207324043f, 0.276024193f},
-std::array<float,2>{0.857498705f, 0.736776114f},
-std::array<float,2>{0.629351079f, 0.0535366647f},
-std::array<float,2>{0.430977672f, 0.98044759f},
-std::array<float,2>{0.273884088f, 0.16753377f},
-std::array<float,2>{0.549059689f, 0.825622737f},
-std::array<float,2>{0.8907969f, 0.485640049f},
-std::array<float,2>{0.108146071f, 0.584171236f},
-std::array<float,2>{0.052718211f, 0.102915481f},
-std::array<float,2>{0.951109946f, 0.893011272f},
-std::array<float,2>{0.573791862f, 0.350121289f},
-std::array<float,2>{0.318329781f, 0.68225807f},
-std::array<float,2>{0.489850968f, 0.403943598f},
-std::array<float,2>{0.744450927f, 0.539372444f},
-std::array<float,2>{0.809901178f, 0.235796571f},
-std::array<float,2>{0.133738086f, 0.76538527f},
-std::array<float,2>{0.0904509872f, 0.442697585f},
-std::array<float,2>{0.928396165f, 0.604183257f},
-std::array<float,2>{0.501840293f, 0.146269426f},
-std::array<float,2>{0.308541924f, 0.865172744f},
-std::array<float,2>{0.379365534f, 0.0208344683f},
-std::array<float,2>{0.665682495f, 0.944473684f},
-std::array<float,2>{0.831751823f, 0.282203048f},
-std::array<float,2>{0.226685837f, 0.712935388f},
-std::array<float,2>{0.17444393f, 0.20535475f},
-std::array<float,2>{0.769364119f, 0.798928857f},
-std::array<float,2>{0.713704109f, 0.407726973f},
-std::array<float,2>{0.468258977f, 0.530687451f},
-std::array<float,2>{0.357632369f, 0.33741653f},
-std::array<float,2>{0.605378091f, 0.643338919f},
-std::array<float,2>{0.988694847f, 0.080609709f},
-std::array<float,2>{0.0222148821f, 0.931180775f},
-std::array<float,2>{0.143853635f, 0.426386565f},
-std::array<float,2>{0.782392204f, 0.509191096f},
-std::array<float,2>{0.728890002f, 0.199681491f},
-std::array<float,2>{0.47159946f, 0.787074089f},
-std::array<float,2>{0.335466117f, 0.0766373351f},
-std::array<float,2>{0.590727985f, 0.912189126f},
-std::array<float,2>{0.954411983f, 0.31622082f},
-std::array<float,2>{0.0361382738f, 0.62684536f},
-std::array<float,2>{0.116597369f, 0.139158875f},
-std::array<float,2>{0.882365763f, 0.845116258f},
-std::array<float,2>{0.532779038f, 0.454779863f},
-std::array<float,2>{0.264914364f, 0.619428277f},
-std::array<float,2>{0.420805782f, 0.30204007f},
-std::array<float,2>{0.646738946f, 0.702600241f},
-std::array<float,2>{0.872796834f, 0.0131276008f},
-std::array<float,2>{0.190373868f, 0.964210093f},
-std::array<float,2>{0.0104320114f, 0.369276613f},
-std::array<float,2>{0.969862103f, 0.658956826f},
-std::array<float,2>{0.615659058f, 0.109429352f},
-std::array<float,2>{0.374257177f, 0.890510499f},
-std::array<float,2>{0.440488309f, 0.233167484f},
-std::array<float,2>{0.697022855f, 0.778998733f},
-std::array<float,2>{0.752773345f, 0.387780696f},
-std::array<float,2>{0.156617776f, 0.550271451f},
-std::array<float,2>{0.246697575f, 0.0329831503f},
-std::array<float,2>{0.812635839f, 0.990158498f},
-std::array<float,2>{0.676322103f, 0.252067953f},
-std::array<float,2>{0.406207561f, 0.719899476f},
-std::array<float,2>{0.281708688f, 0.474221945f},
-std::array<float,2>{0.528593838f, 0.564575553f},
-std::array<float,2>{0.908219397f, 0.180884734f},
-std::array<float,2>{0.074086763f, 0.840741694f},
-std::array<float,2>{0.169832945f, 0.321859866f},
-std::array<float,2>{0.76069051f, 0.635108829f},
-std::array<float,2>{0.689363897f, 0.068750456f},
-std::array<float,2>{0.44805491f, 0.917360485f},
-std::array<float,2>{0.360003531f, 0.188772917f},
-std::array<float,2>{0.618768752f, 0.796541154f},
-std::array<float,2>{0.980394781f, 0.434337795f},
-std::array<float,2>{0.00527251046f, 0.50132513f},
-std::array<float,2>{0.063612394f, 0.00599022722f},
-std::array<float,2>{0.921675563f, 0.957721233f},
-std::array<float,2>{0.522123992f, 0.308459133f},
-std::array<float,2>{0.295915216f, 0.689274967f},
-std::array<float,2>{0.397728652f, 0.462521583f},
-std::array<float,2>{0.685789943f, 0.6107409f},
-std::array<float,2>{0.821495354f, 0.125951797f},
-std::array<float,2>{0.235306457f, 0.859237909f},
-std::array<float,2>{0.0465943106f, 0.37758857f},
-std::array<float,2>{0.961493731f, 0.560342729f},
-std::array<float,2>{0.580120206f, 0.224954158f},
-std::array<float,2>{0.339089423f, 0.767665327f},
-std::array<float,2>{0.484311789f, 0.121364437f},
-std::array<float,2>{0.71991843f, 0.879344404f},
-std::array<float,2>{0.792653441f, 0.360260606f},
-std::array<float,2>{0.152396649f, 0.668651581f},
-std::array<float,2>{0.200177193f, 0.175183401f},
-std::array<float,2>{0.863582015f, 0.834873259f},
-std::array<float,2>{0.649377167f, 0.478161126f},
-std::array<float,2>{0.412774384f, 0.57193172f},
-std::array<float,2>{0.255667299f, 0.261228383f},
-std::array<float,2>{0.541662455f, 0.728999853f},
-std::array<float,2>{0.887456417f, 0.0396467149f},
-std::array<float,2>{0.120749012f, 0.993826449f},
-std::array<float,2>{0.222033456f, 0.495151997f},
-std::array<float,2>{0.838680446f, 0.590596497f},
-std::array<float,2>{0.659650087f, 0.156549841f},
-std::array<float,2>{0.388943791f, 0.819941282f},
-std::array<float,2>{0.298103124f, 0.0608800761f},
-std::array<float,2>{0.512919724f, 0.968837798f},
-std::array<float,2>{0.9344396f, 0.270386666f},
-std::array<float,2>{0.083058849f, 0.746167541f},
-std::array<float,2>{0.0267149787f, 0.245413154f},
-std::array<float,2>{0.997854948f, 0.755393267f},
-std::array<float,2>{0.594552457f, 0.394468725f},
-std::array<float,2>{0.346372694f, 0.538100004f},
-std::array<float,2>{0.459821939f, 0.351682454f},
-std::array<float,2>{0.709982336f, 0.678854048f},
-std::array<float,2>{0.775343657f, 0.0950917751f},
-std::array<float,2>{0.18722719f, 0.903522134f},
-std::array<float,2>{0.0939109251f, 0.290743977f},
-std::array<float,2>{0.902449489f, 0.708279073f},
-std::array<float,2>{0.558566332f, 0.0277954563f},
-std::array<float,2>{0.267191321f, 0.951864958f},
-std::array<float,2>{0.426848292f, 0.148955762f},
-std::array<float,2>{0.638167977f, 0.871230185f},
-std::array<float,2>{0.846141398f, 0.44589898f},
-std::array<float,2>{0.2125929f, 0.597258925f},
-std::array<float,2>{0.129544318f, 0.0899011642f},
-std::array<float,2>{0.80252564f, 0.924932361f},
-std::array<float,2>{0.740834594f, 0.333499074f},
-std::array<float,2>{0.49322319f, 0.650918901f},
-std::array<float,2>{0.324176311f, 0.419460237f},
-std::array<float,2>{0.569767892f, 0.5201419f},
-std::array<float,2>{0.938740492f, 0.21728155f},
-std::array<float,2>{0.0582092814f, 0.809727073f},
-std::array<float,2>{0.137152001f, 0.311272502f},
-std::array<float,2>{0.805782378f, 0.692975342f},
-std::array<float,2>{0.748024881f, 0.00334411021f},
-std::array<float,2>{0.484942049f, 0.954890251f},
-std::array<float,2>{0.314279079f, 0.129525363f},
-std::array<float,2>{0.575947464f, 0.851648211f},
-std::array<float,2>{0.948404312f, 0.468445688f},
-std::array<float,2>{0.0479407534f, 0.615786672f},
-std::array<float,2>{0.104762837f, 0.0655316114f},
-std::array<float,2>{0.8981179f, 0.918322861f},
-std::array<float,2>{0.553092003f, 0.327029765f},
-std::array<float,2>{0.279476672f, 0.639143527f},
-std::array<float,2>{0.434745252f, 0.430704892f},
-std::array<float,2>{0.62542665f, 0.503926158f},
-std::array<float,2>{0.852666378f, 0.195249811f},
-std::array<float,2>{0.205014452f, 0.790979505f},
-std::array<float,2>{0.0192322433f, 0.481982946f},
-std::array<float,2>{0.986584485f, 0.575984418f},
-std::array<float,2>{0.607055604f, 0.177232474f},
-std::array<float,2>{0.353629738f, 0.82871294f},
-std::array<float,2>{0.461427063f, 0.042991057f},
-std::array<float,2>{0.715303957f, 0.998589873f},
-std::array<float,2>{0.771637678f, 0.262263983f},
-std::array<float,2>{0.177908033f, 0.733550787f},
-std::array<float,2>{0.233756781f, 0.219368801f},
-std::array<float,2>{0.835932374f, 0.771062851f},
-std::array<float,2>{0.669573069f, 0.379637927f},
-std::array<float,2>{0.375708401f, 0.556504786f},
-std::array<float,2>{0.309268951f, 0.363315016f},
-std::array<float,2>{0.507017195f, 0.664337397f},
-std::array<float,2>{0.922439575f, 0.119174741f},
-std::array<float,2>{0.0877129287f, 0.878672659f},
-std::array<float,2>{0.191925615f, 0.398016512f},
-std::array<float,2>{0.870197415f, 0.533936143f},
-std::array<float,2>{0.64378041f, 0.247405261f},
-std::array<float,2>{0.414196283f, 0.751013458f},
-std::array<float,2>{0.259105772f, 0.0996206552f},
-std::array<float,2>{0.535289645f, 0.898834944f},
-std::array<float,2>{0.877814889f, 0.356270492f},
-std::array<float,2>{0.112552673f, 0.673813343f},
-std::array<float,2>{0.0340953097f, 0.162843049f},
-std::array<float,2>{0.960451543f, 0.812662423f},
-std::array<float,2>{0.587452888f, 0.498277605f},
-std::array<float,2>{0.33128947f, 0.589491129f},
-std::array<float,2>{0.472750783f, 0.26824528f},
-std::array<float,2>{0.731145442f, 0.744662285f},
-std::array<float,2>{0.786465824f, 0.0584052317f},
-std::array<float,2>{0.144618571f, 0.974133015f},
-std::array<float,2>{0.0777424127f, 0.330000222f},
-std::array<float,2>{0.912204504f, 0.653497219f},
-std::array<float,2>{0.524043143f, 0.0896728933f},
-std::array<float,2>{0.287470222f, 0.928038836f},
-std::array<float,2>{0.399483234f, 0.213119224f},
-std::array<float,2>{0.673824251f, 0.804715514f},
-std::array<float,2>{0.817613244f, 0.417928785f},
-std::array<float,2>{0.24509725f, 0.51828444f},
-std::array<float,2>{0.16061762f, 0.0239806548f},
-std::array<float,2>{0.753937721f, 0.946626425f},
-std::array<float,2>{0.702503324f, 0.295458347f},
-std::array<float,2>{0.444245398f, 0.705707848f},
-std::array<float,2>{0.369743168f, 0.452409595f},
-std::array<float,2>{0.610661983f, 0.598153651f},
-std::array<float,2>{0.976375997f, 0.15526244f},
-std::array<float,2>{0.0139362421f, 0.869894326f},
-std::array<float,2>{0.240296066f, 0.344346523f},
-std::array<float,2>{0.825755f, 0.684155643f},
-std::array<float,2>{0.681753039f, 0.106585294f},
-std::array<float,2>{0.393103659f, 0.894857705f},
-std::array<float,2>{0.292251885f, 0.242022082f},
-std::array<float,2>{0.518823326f, 0.760073483f},
-std::array<float,2>{0.914601922f, 0.400505275f},
-std::array<float,2>{0.0698578581f, 0.546778679f},
-std::array<float,2>{0.00374678546f, 0.0490017347f},
-std::array<float,2>{0.981147051f, 0.982154727f},
-std::array<float,2>{0.623029709f, 0.277739018f},
-std::array<float,2>{0.36509341f, 0.740976453f},
-std::array<float,2>{0.451189071f, 0.490095973f},
-std::array<float,2>{0.692189932f, 0.581377685f},
-std::array<float,2>{0.764163733f, 0.171031117f},
-std::array<float,2>{0.166815445f, 0.821442485f},
-std::array<float,2>{0.124688715f, 0.411004126f},
-std::array<float,2>{0.885046005f, 0.525651097f},
-std::array<float,2>{0.543897629f, 0.210868448f},
-std::array<float,2>{0.250812292f, 0.801138282f},
-std::array<float,2>{0.409958303f, 0.0820691511f},
-std::array<float,2>{0.653218508f, 0.936001241f},
-std::array<float,2>{0.859784424f, 0.340848386f},
-std::array<float,2>{0.196058437f, 0.644581854f},
-std::array<float,2>{0.152173012f, 0.142419577f},
-std::array<float,2>{0.793752909f, 0.860881746f},
-std::array<float,2>{0.725265861f, 0.439908385f},
-std::array<float,2>{0.476992518f, 0.609212875f},
-std::array<float,2>{0.340104938f, 0.286137015f},
-std::array<float,2>{0.582250416f, 0.71589309f},
-std::array<float,2>{0.968015015f, 0.0190418325f},
-std::array<float,2>{0.0399858207f, 0.938950658f},
-std::array<float,2>{0.180889919f, 0.459531158f},
-std::array<float,2>{0.779782891f, 0.624382496f},
-std::array<float,2>{0.704363585f, 0.134861022f},
-std::array<float,2>{0.454982668f, 0.849511027f},
-std::array<float,2>{0.350832492f, 0.0103754727f},
-std::array<float,2>{0.59948951f, 0.967019498f},
-std::array<float,2>{0.994037151f, 0.297469318f},
-std::array<float,2>{0.0291071162f, 0.695888579f},
-std::array<float,2>{0.0811055303f, 0.198159248f},
-std::array<float,2>{0.932054758f, 0.784368157f},
-std::array<float,2>{0.508247435f, 0.423793435f},
-std::array<float,2>{0.304214209f, 0.513003647f},
-std::array<float,2>{0.382928371f, 0.319143862f},
-std::array<float,2>{0.661691964f, 0.630469322f},
-std::array<float,2>{0.839946985f, 0.0730515718f},
-std::array<float,2>{0.225315765f, 0.907640576f},
-std::array<float,2>{0.0589539446f, 0.254718333f},
-std::array<float,2>{0.945245802f, 0.722742081f},
-std::array<float,2>{0.562871695f, 0.0365799181f},
-std::array<float,2>{0.326641768f, 0.985794127f},
-std::array<float,2>{0.496463925f, 0.186194181f},
-std::array<float,2>{0.735864341f, 0.838712454f},
-std::array<float,2>{0.797597647f, 0.47111091f},
-std::array<float,2>{0.127055153f, 0.567406356f},
-std::array<float,2>{0.217991561f, 0.113489665f},
-std::array<float,2>{0.84963733f, 0.882924497f},
-std::array<float,2>{0.636316359f, 0.372698039f},
-std::array<float,2>{0.424066186f, 0.663960755f},
-std::array<float,2>{0.273283392f, 0.38437891f},
-std::array<float,2>{0.56082207f, 0.552884459f},
-std::array<float,2>{0.900925696f, 0.228755891f},
-std::array<float,2>{0.100964956f, 0.776970029f},
-std::array<float,2>{0.212003544f, 0.292813629f},
-std::array<float,2>{0.846660554f, 0.7091313f},
-std::array<float,2>{0.638522089f, 0.0312330648f},
-std::array<float,2>{0.427714348f, 0.951046884f},
-std::array<float,2>{0.266611218f, 0.150879264f},
-std::array<float,2>{0.558047116f, 0.874509513f},
-std::array<float,2>{0.902899444f, 0.448983133f},
-std::array<float,2>{0.0943573341f, 0.595380366f},
-std::array<float,2>{0.0578243844f, 0.0920866653f},
-std::array<float,2>{0.938974202f, 0.923485756f},
-std::array<float,2>{0.56991607f, 0.334782273f},
-std::array<float,2>{0.323516965f, 0.650091648f},
-std::array<float,2>{0.493789017f, 0.421551317f},
-std::array<float,2>{0.740351796f, 0.522159457f},
-std::array<float,2>{0.801974475f, 0.216529474f},
-std::array<float,2>{0.128997847f, 0.812161863f},
-std::array<float,2>{0.0839748979f, 0.492779523f},
-std::array<float,2>{0.933958352f, 0.592315435f},
-std::array<float,2>{0.513348579f, 0.158823654f},
-std::array<float,2>{0.298652142f, 0.818011105f},
-std::array<float,2>{0.389232486f, 0.0604131408f},
-std::array<float,2>{0.659814775f, 0.972452939f},
-std::array<float,2>{0.838063896f, 0.273229122f},
-std::array<float,2>{0.222418129f, 0.748122513f},
-std::array<float,2>{0.186948821f, 0.243260816f},
-std::array<float,2>{0.774549007f, 0.756870747f},
-std::array<float,2>{0.710646808f, 0.391251534f},
-std::array<float,2>{0.459247708f, 0.536160588f},
-std::array<float,2>{0.345705718f, 0.35394451f},
-std::array<float,2>{0.593859315f, 0.677602887f},
-std::array<float,2>{0.997255504f, 0.0959268063f},
-std::array<float,2>{0.0271534789f, 0.90588522f},
-std::array<float,2>{0.153260365f, 0.375829935f},
-std::array<float,2>{0.792118669f, 0.560763776f},
-std::array<float,2>{0.720556676f, 0.223382115f},
-std::array<float,2>{0.483633816f, 0.766570866f},
-std::array<float,2>{0.339547753f, 0.123087488f},
-std::array<float,2>{0.580877364f, 0.880924463f},
-std::array<float,2>{0.961173594f, 0.361721039f},
-std::array<float,2>{0.0460970961f, 0.671245277f},
-std::array<float,2>{0.120366991f, 0.172215164f},
-std::array<float,2>{0.886907458f, 0.832636893f},
-std::array<float,2>{0.541152298f, 0.480146825f},
-std::array<float,2>{0.255307049f, 0.573871851f},
-std::array<float,2>{0.412357926f, 0.258671165f},
-std::array<float,2>{0.648451626f, 0.728240669f},
-std::array<float,2>{0.863943398f, 0.0427384675f},
-std::array<float,2>{0.199295193f, 0.994368851f},
-std::array<float,2>{0.00561656523f, 0.323878765f},
-std::array<float,2>{0.979522526f, 0.632864952f},
-std::array<float,2>{0.618300498f, 0.0675247088f},
-std::array<float,2>{0.359724969f, 0.915409803f},
-std::array<float,2>{0.447718322f, 0.190886319f},
-std::array<float,2>{0.688669562f, 0.79431355f},
-std::array<float,2>{0.759832442f, 0.43695733f},
-std::array<float,2>{0.169334456f, 0.502660215f},
-std::array<float,2>{0.234380797f, 0.0043127602f},
-std::array<float,2>{0.822207153f, 0.959424078f},
-std::array<float,2>{0.686204076f, 0.306296974f},
-std::array<float,2>{0.398064822f, 0.691296339f},
-std::array<float,2>{0.296564043f, 0.464315206f},
-std::array<float,2>{0.52190727f, 0.61297977f},
-std::array<float,2>{0.921353161f, 0.127686173f},
-std::array<float,2>{0.0643248558f, 0.856385589f},
-std::array<float,2>{0.157158107f, 0.368442446f},
-std::array<float,2>{0.752383232f, 0.657803357f},
-std::array<float,2>{0.696448684f, 0.112236351f},
-std::array<float,2>{0.441271603f, 0.887539446f},
-std::array<float,2>{0.374891579f, 0.232301131f},
-std::array<float,2>{0.615767002f, 0.77975136f},
-std::array<float,2>{0.970694304f, 0.390528053f},
-std::array<float,2>{0.0101881213f, 0.547468543f},
-std::array<float,2>{0.0734431297f, 0.0337226242f},
-std::array<float,2>{0.908872128f, 0.990370572f},
-std::array<float,2>{0.529283941f, 0.250162899f},
-std::array<float,2>{0.282187074f, 0.721373975f},
-std::array<float,2>{0.405645072f, 0.476248294f},
-std::array<float,2>{0.675807297f, 0.564120471f},
-std::array<float,2>{0.813178778f, 0.182483464f},
-std::array<float,2>{0.246342495f, 0.842923105f},
-std::array<float,2>{0.0370947085f, 0.429248095f},
-std::array<float,2>{0.954930127f, 0.510358274f},
-std::array<float,2>{0.589909792f, 0.203054175f},
-std::array<float,2>{0.335011512f, 0.788165689f},
-std::array<float,2>{0.471166044f, 0.0753641278f},
-std::array<float,2>{0.729313314f, 0.911242902f},
-std::array<float,2>{0.782771468f, 0.312719464f},
-std::array<float,2>{0.144116342f, 0.627453744f},
-std::array<float,2>{0.18959026f, 0.137657538f},
-std::array<float,2>{0.872523606f, 0.846833348f},
-std::array<float,2>{0.647299588f, 0.456447601f},
-std::array<float,2>{0.420124888f, 0.617549062f},
-std::array<float,2>{0.265300065f, 0.304620415f},
-std::array<float,2>{0.532463133f, 0.699978352f},
-std::array<float,2>{0.882267773f, 0.0148551352f},
-std::array<float,2>{0.116817683f, 0.96254158f},
-std::array<float,2>{0.227274016f, 0.443834782f},
-std::array<float,2>{0.83152771f, 0.603109241f},
-std::array<float,2>{0.665068507f, 0.147248879f},
-std::array<float,2>{0.379824877f, 0.865549743f},
-std::array<float,2>{0.307875633f, 0.0228245128f},
-std::array<float,2>{0.501013696f, 0.94193995f},
-std::array<float,2>{0.928163826f, 0.284149826f},
-std::array<float,2>{0.0902900845f, 0.711320639f},
-std::array<float,2>{0.0218259934f, 0.204674616f},
-std::array<float,2>{0.989248216f, 0.798163831f},
-std::array<float,2>{0.604558587f, 0.409287393f},
-std::array<float,2>{0.358179569f, 0.527590334f},
-std::array<float,2>{0.468362659f, 0.338719249f},
-std::array<float,2>{0.712977231f, 0.641238332f},
-std::array<float,2>{0.768751681f, 0.0784083158f},
-std::array<float,2>{0.174047053f, 0.933235884f},
-std::array<float,2>{0.107866146f, 0.275384218f},
-std::array<float,2>{0.891207695f, 0.734417617f},
-std::array<float,2>{0.549325883f, 0.0512245707f},
-std::array<float,2>{0.274064243f, 0.978063345f},
-std::array<float,2>{0.431630164f, 0.164971232f},
-std::array<float,2>{0.62985152f, 0.826557279f},
-std::array<float,2>{0.858285367f, 0.488097638f},
-std::array<float,2>{0.207711473f, 0.582747996f},
-std::array<float,2>{0.13289997f, 0.105203882f},
-std::array<float,2>{0.810357094f, 0.89246732f},
-std::array<float,2>{0.74491179f, 0.348586261f},
-std::array<float,2>{0.489285409f, 0.680800676f},
-std::array<float,2>{0.317513734f, 0.405882061f},
-std::array<float,2>{0.573479354f, 0.542021751f},
-std::array<float,2>{0.950547516f, 0.237881795f},
-std::array<float,2>{0.0518066362f, 0.763198376f},
-std::array<float,2>{0.127665728f, 0.256861776f},
-std::array<float,2>{0.79706037f, 0.724652588f},
-std::array<float,2>{0.735512376f, 0.0373757854f},
-std::array<float,2>{0.49705714f, 0.987381279f},
-std::array<float,2>{0.32694459f, 0.184592158f},
-std::array<float,2>{0.563473761f, 0.837750733f},
-std::array<float,2>{0.944726646f, 0.469875038f},
-std::array<float,2>{0.0593221933f, 0.568791449f},
-std::array<float,2>{0.101274446f, 0.115512796f},
-std::array<float,2>{0.900751472f, 0.886095881f},
-std::array<float,2>{0.561060488f, 0.373298973f},
-std::array<float,2>{0.272504807f, 0.661856294f},
-std::array<float,2>{0.424689084f, 0.386497021f},
-std::array<float,2>{0.636147738f, 0.55182147f},
-std::array<float,2>{0.85018909f, 0.227780417f},
-std::array<float,2>{0.218292326f, 0.774646282f},
-std::array<float,2>{0.028721476f, 0.458626658f},
-std::array<float,2>{0.993364632f, 0.621774018f},
-std::array<float,2>{0.598727226f, 0.133457705f},
-std::array<float,2>{0.351347476f, 0.851113558f},
-std::array<float,2>{0.454368681f, 0.00826913863f},
-std::array<float,2>{0.704766989f, 0.966514885f},
-std::array<float,2>{0.780262053f, 0.300356001f},
-std::array<float,2>{0.18163766f, 0.698386788f},
-std::array<float,2>{0.224735364f, 0.195619911f},
-std::array<float,2>{0.840669692f, 0.782178521f},
-std::array<float,2>{0.661600173f, 0.424651325f},
-std::array<float,2>{0.38367489f, 0.513911188f},
-std::array<float,2>{0.303934425f, 0.316821367f},
-std::array<float,2>{0.508668184f, 0.632808208f},
-std::array<float,2>{0.932445407f, 0.0712001696f},
-std::array<float,2>{0.0816762298f, 0.908548355f},
-std::array<float,2>{0.195757464f, 0.413353235f},
-std::array<float,2>{0.85988301f, 0.524855673f},
-std::array<float,2>{0.652752757f, 0.20885776f},
-std::array<float,2>{0.409665883f, 0.803459227f},
-std::array<float,2>{0.250136822f, 0.0847415924f},
-std::array<float,2>{0.543302238f, 0.935379744f},
-std::array<float,2>{0.885508537f, 0.341835678f},
-std::array<float,2>{0.124030568f, 0.647575974f},
-std::array<float,2>{0.0393029675f, 0.144196406f},
-std::array<float,2>{0.968625784f, 0.861936569f},
-std::array<float,2>{0.582557201f, 0.439447612f},
-std::array<float,2>{0.340368629f, 0.606709301f},
-std::array<float,2>{0.477194697f, 0.288159817f},
-std::array<float,2>{0.724867523f, 0.718607306f},
-std::array<float,2>{0.792974949f, 0.0165523626f},
-std::array<float,2>{0.151600033f, 0.940046728f},
-std::array<float,2>{0.0696124062f, 0.34613061f},
-std::array<float,2>{0.914240837f, 0.687402844f},
-std::array<float,2>{0.519353747f, 0.109314345f},
-std::array<float,2>{0.29257971f, 0.897996306f},
-std::array<float,2>{0.392950803f, 0.238536566f},
-std::array<float,2>{0.682358503f, 0.758714676f},
-std::array<float,2>{0.825333297f, 0.399964809f},
-std::array<float,2>{0.240917489f, 0.544297755f},
-std::array<float,2>{0.166157097f, 0.0486735776f},
-std::array<float,2>{0.763908684f, 0.983126879f},
-std::array<float,2>{0.691620529f, 0.280441076f},
-std::array<float,2>{0.452085882f, 0.738365412f},
-std::array<float,2>{0.364556521f, 0.490440607f},
-std::array<float,2>{0.622196913f, 0.579419315f},
-std::array<float,2>{0.980503559f, 0.169664696f},
-std::array<float,2>{0.00329709705f, 0.823126435f},
-std::array<float,2>{0.244335234f, 0.330110431f},
-std::array<float,2>{0.817940652f, 0.655925632f},
-std::array<float,2>{0.673150003f, 0.086279504f},
-std::array<float,2>{0.40026471f, 0.927605569f},
-std::array<float,2>{0.287895471f, 0.212316036f},
-std::array<float,2>{0.523499966f, 0.807780743f},
-std::array<float,2>{0.912926137f, 0.414176434f},
-std::array<float,2>{0.0773759857f, 0.517179072f},
-std::array<float,2>{0.0145155052f, 0.0256657414f},
-std::array<float,2>{0.975829303f, 0.948719323f},
-std::array<float,2>{0.610921323f, 0.293259323f},
-std::array<float,2>{0.369153112f, 0.703689992f},
-std::array<float,2>{0.443541765f, 0.449766904f},
-std::array<float,2>{0.702727199f, 0.59991473f},
-std::array<float,2>{0.754854381f, 0.152997747f},
-std::array<float,2>{0.160944387f, 0.86729598f},
-std::array<float,2>{0.112825498f, 0.396018386f},
-std::array<float,2>{0.877044976f, 0.531953096f},
-std::array<float,2>{0.535654724f, 0.248163462f},
-std::array<float,2>{0.259435982f, 0.752255619f},
-std::array<float,2>{0.414853305f, 0.0995330215f},
-std::array<float,2>{0.644147575f, 0.901254356f},
-std::array<float,2>{0.870747864f, 0.357579947f},
-std::array<float,2>{0.191661775f, 0.675324202f},
-std::array<float,2>{0.145257682f, 0.160688296f},
-std::array<float,2>{0.78709352f, 0.815686882f},
-std::array<float,2>{0.730566144f, 0.497592241f},
-std::array<float,2>{0.473229855f, 0.587879539f},
-std::array<float,2>{0.331676632f, 0.266489953f},
-std::array<float,2>{0.587221503f, 0.742844343f},
-std::array<float,2>{0.960040212f, 0.0552825406f},
-std::array<float,2>{0.0336188041f, 0.974840283f},
-std::array<float,2>{0.178348035f, 0.484004647f},
-std::array<float,2>{0.772181869f, 0.576210916f},
-std::array<float,2>{0.715673804f, 0.177896827f},
-std::array<float,2>{0.460980475f, 0.830308855f},
-std::array<float,2>{0.354409903f, 0.0454180352f},
-std::array<float,2>{0.606495142f, 0.998021424f},
-std::array<float,2>{0.987250507f, 0.263788342f},
-std::array<float,2>{0.0185548868f, 0.73238045f},
-std::array<float,2>{0.0872823447f, 0.221002087f},
-std::array<float,2>{0.922261298f, 0.773276448f},
-std::array<float,2>{0.507455707f, 0.380908728f},
-std::array<float,2>{0.308888286f, 0.558311224f},
-std::array<float,2>{0.375238895f, 0.366505414f},
-std::array<float,2>{0.668973625f, 0.667465925f},
-std::array<float,2>{0.835396647f, 0.117587283f},
-std::array<float,2>{0.234116122f, 0.876101255f},
-std::array<float,2>{0.04850813f, 0.310252696f},
-std::array<float,2>{0.948824525f, 0.694094181f},
-std::array<float,2>{0.575670481f, 0.00187625107f},
-std::array<float,2>{0.313899159f, 0.955901444f},
-std::array<float,2>{0.484532416f, 0.132220507f},
-std::array<float,2>{0.747341335f, 0.854966581f},
-std::array<float,2>{0.806203365f, 0.465409428f},
-std::array<float,2>{0.137555197f, 0.614603579f},
-std::array<float,2>{0.204447955f, 0.0632284284f},
-std::array<float,2>{0.853245378f, 0.921114028f},
-std::array<float,2>{0.625809431f, 0.326069444f},
-std::array<float,2>{0.435410351f, 0.637377799f},
-std::array<float,2>{0.280090392f, 0.432888329f},
-std::array<float,2>{0.553538978f, 0.506349623f},
-std::array<float,2>{0.897803843f, 0.193053231f},
-std::array<float,2>{0.10508348f, 0.792519152f},
-std::array<float,2>{0.219347164f, 0.269670725f},
-std::array<float,2>{0.836363912f, 0.747055888f},
-std::array<float,2>{0.657984376f, 0.0613574237f},
-std::array<float,2>{0.38687709f, 0.969630182f},
-std::array<float,2>{0.299048632f, 0.157196298f},
-std::array<float,2>{0.514349401f, 0.819751441f},
-std::array<float,2>{0.9366135f, 0.496064246f},
-std::array<float,2>{0.0859314054f, 0.590212107f},
-std::array<float,2>{0.0245295614f, 0.0955964625f},
-std::array<float,2>{0.998127341f, 0.904208779f},
-std::array<float,2>{0.597382426f, 0.352141976f},
-std::array<float,2>{0.344269037f, 0.67948705f},
-std::array<float,2>{0.458434701f, 0.393585622f},
-std::array<float,2>{0.70866853f, 0.538726091f},
-std::array<float,2>{0.776520073f, 0.24587366f},
-std::array<float,2>{0.184773892f, 0.755169749f},
-std::array<float,2>{0.0968310386f, 0.445747644f},
-std::array<float,2>{0.904545009f, 0.596794128f},
-std::array<float,2>{0.55588907f, 0.148473606f},
-std::array<float,2>{0.268577158f, 0.871997118f},
-std::array<float,2>{0.428642631f, 0.0278607011f},
-std::array<float,2>{0.638914347f, 0.951571047f},
-std::array<float,2>{0.844058752f, 0.290045857f},
-std::array<float,2>{0.213046893f, 0.708712101f},
-std::array<float,2>{0.132177457f, 0.217294708f},
-std::array<float,2>{0.802786052f, 0.81012857f},
-std::array<float,2>{0.739443004f, 0.419254124f},
-std::array<float,2>{0.494754314f, 0.519854665f},
-std::array<float,2>{0.321895123f, 0.333272487f},
-std::array<float,2>{0.566992223f, 0.650479257f},
-std::array<float,2>{0.940267444f, 0.0905322209f},
-std::array<float,2>{0.0558646433f, 0.925502956f},
-std::array<float,2>{0.171457738f, 0.434077859f},
-std::array<float,2>{0.758613884f, 0.501782537f},
-std::array<float,2>{0.689843655f, 0.189074665f},
-std::array<float,2>{0.445651054f, 0.796028376f},
-std::array<float,2>{0.363249868f, 0.0692371652f},
-std::array<float,2>{0.619314253f, 0.917903423f},
-std::array<float,2>{0.976571143f, 0.321326643f},
-std::array<float,2>{0.00663440768f, 0.635272324f},
-std::array<float,2>{0.066101037f, 0.12539348f},
-std::array<float,2>{0.918299019f, 0.858431399f},
-std::array<float,2>{0.520513058f, 0.461977154f},
-std::array<float,2>{0.294496268f, 0.610866547f},
-std::array<float,2>{0.395786852f, 0.307638377f},
-std::array<float,2>{0.684984326f, 0.688525558f},
-std::array<float,2>{0.823304474f, 0.00652013998f},
-std::array<float,2>{0.236561641f, 0.957468867f},
-std::array<float,2>{0.0433808044f, 0.359730601f},
-std::array<float,2>{0.963005483f, 0.668429971f},
-std::array<float,2>{0.578900635f, 0.121641569f},
-std::array<float,2>{0.336106807f, 0.879564583f},
-std::array<float,2>{0.480687618f, 0.225469336f},
-std::array<float,2>{0.721036494f, 0.768255293f},
-std::array<float,2>{0.790137112f, 0.376982093f},
-std::array<float,2>{0.154943943f, 0.559720039f},
-std::array<float,2>{0.201748729f, 0.039516978f},
-std::array<float,2>{0.866619825f, 0.993537128f},
-std::array<float,2>{0.652123809f, 0.261583596f},
-std::array<float,2>{0.412085205f, 0.729462266f},
-std::array<float,2>{0.257300586f, 0.477703482f},
-std::array<float,2>{0.540663421f, 0.571492851f},
-std::array<float,2>{0.890315652f, 0.17540504f},
-std::array<float,2>{0.117460422f, 0.834363759f},
-std::array<float,2>{0.141820341f, 0.315895915f},
-std::array<float,2>{0.783966422f, 0.626266599f},
-std::array<float,2>{0.726944983f, 0.076832056f},
-std::array<float,2>{0.470372856f, 0.912679195f},
-std::array<float,2>{0.332887977f, 0.199828535f},
-std::array<float,2>{0.592770815f, 0.786242843f},
-std::array<float,2>{0.956522048f, 0.425846368f},
-std::array<float,2>{0.039003849f, 0.509428144f},
-std::array<float,2>{0.114029244f, 0.0132357199f},
-std::array<float,2>{0.879627764f, 0.96452719f},
-std::array<float,2>{0.533769727f, 0.30269593f},
-std::array<float,2>{0.262359977f, 0.703097284f},
-std::array<float,2>{0.419301808f, 0.454216868f},
-std::array<float,2>{0.644839764f, 0.619794786f},
-std::array<float,2>{0.874060273f, 0.139591575f},
-std::array<float,2>{0.188301742f, 0.845574856f},
-std::array<float,2>{0.00937898364f, 0.38826257f},
-std::array<float,2>{0.972421169f, 0.550383031f},
-std::array<float,2>{0.614120185f, 0.232763007f},
-std::array<float,2>{0.371801972f, 0.778377831f},
-std::array<float,2>{0.438730419f, 0.109902613f},
-std::array<float,2>{0.698828518f, 0.889762461f},
-std::array<float,2>{0.750240028f, 0.369907379f},
-std::array<float,2>{0.159201309f, 0.658357203f},
-std::array<float,2>{0.248184741f, 0.181392327f},
-std::array<float,2>{0.816370547f, 0.840043485f},
-std::array<float,2>{0.679680645f, 0.473812193f},
-std::array<float,2>{0.403118163f, 0.565411627f},
-std::array<float,2>{0.284663886f, 0.252925664f},
-std::array<float,2>{0.53094691f, 0.720352769f},
-std::array<float,2>{0.906911612f, 0.0325605869f},
-std::array<float,2>{0.0713807791f, 0.989312649f},
-std::array<float,2>{0.20906724f, 0.486128509f},
-std::array<float,2>{0.857281387f, 0.58490622f},
-std::array<float,2>{0.631354749f, 0.167090401f},
-std::array<float,2>{0.432225823f, 0.825892866f},
-std::array<float,2>{0.276503801f, 0.0527422167f},
-std::array<float,2>{0.548014164f, 0.979804099f},
-std::array<float,2>{0.894254208f, 0.275853485f},
-std::array<float,2>{0.107334383f, 0.737191319f},
-std::array<float,2>{0.0537139364f, 0.235937387f},
-std::array<float,2>{0.952278137f, 0.765089393f},
-std::array<float,2>{0.57187891f, 0.403692126f},
-std::array<float,2>{0.320253611f, 0.539631128f},
-std::array<float,2>{0.490810096f, 0.350095838f},
-std::array<float,2>{0.742797554f, 0.681688368f},
-std::array<float,2>{0.811197639f, 0.103277907f},
-std::array<float,2>{0.135086954f, 0.893537998f},
-std::array<float,2>{0.0930975899f, 0.281561166f},
-std::array<float,2>{0.926466644f, 0.713608861f},
-std::array<float,2>{0.502129257f, 0.0214670617f},
-std::array<float,2>{0.306369692f, 0.945084631f},
-std::array<float,2>{0.382175148f, 0.145601764f},
-std::array<float,2>{0.667544961f, 0.864491463f},
-std::array<float,2>{0.828466296f, 0.442878455f},
-std::array<float,2>{0.230430141f, 0.603907645f},
-std::array<float,2>{0.171929911f, 0.0802278817f},
-std::array<float,2>{0.766744971f, 0.930968046f},
-std::array<float,2>{0.712757766f, 0.33733657f},
-std::array<float,2>{0.465818167f, 0.642871022f},
-std::array<float,2>{0.356672436f, 0.407312334f},
-std::array<float,2>{0.601927161f, 0.530842841f},
-std::array<float,2>{0.990741968f, 0.205923915f},
-std::array<float,2>{0.0201771129f, 0.79943651f},
-std::array<float,2>{0.182909369f, 0.297212929f},
-std::array<float,2>{0.777709663f, 0.695757866f},
-std::array<float,2>{0.705326438f, 0.0101067238f},
-std::array<float,2>{0.456801921f, 0.96737653f},
-std::array<float,2>{0.349443406f, 0.135573134f},
-std::array<float,2>{0.60100174f, 0.849030852f},
-std::array<float,2>{0.994792163f, 0.459199786f},
-std::array<float,2>{0.0311883315f, 0.62477386f},
-std::array<float,2>{0.0798415095f, 0.0726371929f},
-std::array<float,2>{0.930400431f, 0.907832861f},
-std::array<float,2>{0.509930551f, 0.318706453f},
-std::array<float,2>{0.3023853f, 0.630323946f},
-std::array<float,2>{0.385354728f, 0.422947526f},
-std::array<float,2>{0.662826836f, 0.513314784f},
-std::array<float,2>{0.842739344f, 0.197585449f},
-std::array<float,2>{0.224566758f, 0.78467989f},
-std::array<float,2>{0.0611483827f, 0.47127685f},
-std::array<float,2>{0.943339586f, 0.56824851f},
-std::array<float,2>{0.565230727f, 0.186022058f},
-std::array<float,2>{0.32542187f, 0.838061571f},
-std::array<float,2>{0.499700338f, 0.0369365178f},
-std::array<float,2>{0.737352788f, 0.985979557f},
-std::array<float,2>{0.799160838f, 0.254299849f},
-std::array<float,2>{0.126183122f, 0.723414123f},
-std::array<float,2>{0.215249896f, 0.229411557f},
-std::array<float,2>{0.848261595f, 0.776397407f},
-std::array<float,2>{0.633305907f, 0.384073228f},
-std::array<float,2>{0.423072487f, 0.553302169f},
-std::array<float,2>{0.271152169f, 0.372288972f},
-std::array<float,2>{0.559356153f, 0.6632213f},
-std::array<float,2>{0.900359631f, 0.113892317f},
-std::array<float,2>{0.0982371345f, 0.883753002f},
-std::array<float,2>{0.23906593f, 0.401072323f},
-std::array<float,2>{0.826885998f, 0.546130598f},
-std::array<float,2>{0.681329966f, 0.241490319f},
-std::array<float,2>{0.391857415f, 0.760510385f},
-std::array<float,2>{0.290646046f, 0.107355103f},
-std::array<float,2>{0.516662776f, 0.895312428f},
-std::array<float,2>{0.917278349f, 0.344137877f},
-std::array<float,2>{0.0677189976f, 0.683907688f},
-std::array<float,2>{0.000208550526f, 0.171482608f},
-std::array<float,2>{0.983160377f, 0.821871459f},
-std::array<float,2>{0.623292208f, 0.489362299f},
-std::array<float,2>{0.365912288f, 0.581904948f},
-std::array<float,2>{0.45010972f, 0.277863324f},
-std::array<float,2>{0.694145381f, 0.740582943f},
-std::array<float,2>{0.762387395f, 0.0497922264f},
-std::array<float,2>{0.16594325f, 0.981678069f},
-std::array<float,2>{0.121623263f, 0.341492563f},
-std::array<float,2>{0.884025693f, 0.645266414f},
-std::array<float,2>{0.545867443f, 0.0828233734f},
-std::array<float,2>{0.252192378f, 0.936304688f},
-std::array<float,2>{0.406973094f, 0.210151836f},
-std::array<float,2>{0.654792964f, 0.801561832f},
-std::array<float,2>{0.862987518f, 0.410161287f},
-std::array<float,2>{0.199147925f, 0.526034057f},
-std::array<float,2>{0.150002703f, 0.0195270721f},
-std::array<float,2>{0.795477271f, 0.939406872f},
-std::array<float,2>{0.722789586f, 0.286856681f},
-std::array<float,2>{0.478878856f, 0.716789842f},
-std::array<float,2>{0.343708187f, 0.440397501f},
-std::array<float,2>{0.584405184f, 0.608852684f},
-std::array<float,2>{0.965928853f, 0.141705349f},
-std::array<float,2>{0.0412517078f, 0.860385478f},
-std::array<float,2>{0.193796054f, 0.355737597f},
-std::array<float,2>{0.868199468f, 0.673314035f},
-std::array<float,2>{0.641749203f, 0.100179136f},
-std::array<float,2>{0.41734013f, 0.898991048f},
-std::array<float,2>{0.260823876f, 0.247785598f},
-std::array<float,2>{0.538975537f, 0.751790702f},
-std::array<float,2>{0.875181556f, 0.397800863f},
-std::array<float,2>{0.110508047f, 0.533514261f},
-std::array<float,2>{0.0315729901f, 0.058043398f},
-std::array<float,2>{0.958720267f, 0.973903894f},
-std::array<float,2>{0.588284016f, 0.267725497f},
-std::array<float,2>{0.328867733f, 0.744421005f},
-std::array<float,2>{0.475931615f, 0.498641968f},
-std::array<float,2>{0.734133005f, 0.58892417f},
-std::array<float,2>{0.787126839f, 0.162443519f},
-std::array<float,2>{0.147136912f, 0.813376904f},
-std::array<float,2>{0.0744660944f, 0.417334318f},
-std::array<float,2>{0.911805391f, 0.517682016f},
-std::array<float,2>{0.526307046f, 0.213766605f},
-std::array<float,2>{0.28602767f, 0.805291533f},
-std::array<float,2>{0.401630014f, 0.0892432928f},
-std::array<float,2>{0.674345136f, 0.928274572f},
-std::array<float,2>{0.81874764f, 0.329193264f},
-std::array<float,2>{0.242804348f, 0.653980672f},
-std::array<float,2>{0.162406489f, 0.154443428f},
-std::array<float,2>{0.756224871f, 0.869279444f},
-std::array<float,2>{0.700449944f, 0.452730507f},
-std::array<float,2>{0.44143182f, 0.598011792f},
-std::array<float,2>{0.367973864f, 0.295257539f},
-std::array<float,2>{0.612786353f, 0.705099046f},
-std::array<float,2>{0.97268796f, 0.0238216184f},
-std::array<float,2>{0.0126803452f, 0.947078407f},
-std::array<float,2>{0.138786077f, 0.468141854f},
-std::array<float,2>{0.808031261f, 0.615277827f},
-std::array<float,2>{0.748995841f, 0.129113898f},
-std::array<float,2>{0.487510055f, 0.852490664f},
-std::array<float,2>{0.31562984f, 0.00343267084f},
-std::array<float,2>{0.577969134f, 0.954454899f},
-std::array<float,2>{0.94597739f, 0.310884088f},
-std::array<float,2>{0.0500033051f, 0.692550778f},
-std::array<float,2>{0.101664953f, 0.194391832f},
-std::array<float,2>{0.895053566f, 0.790348232f},
-std::array<float,2>{0.552393019f, 0.431469023f},
-std::array<float,2>{0.277364045f, 0.50444001f},
-std::array<float,2>{0.435585469f, 0.326462388f},
-std::array<float,2>{0.627744853f, 0.639434338f},
-std::array<float,2>{0.855077505f, 0.0660766289f},
-std::array<float,2>{0.206941992f, 0.918683171f},
-std::array<float,2>{0.0166879445f, 0.261917293f},
-std::array<float,2>{0.98567456f, 0.734103382f},
-std::array<float,2>{0.607588291f, 0.0437206775f},
-std::array<float,2>{0.352821231f, 0.998197854f},
-std::array<float,2>{0.463946372f, 0.177344352f},
-std::array<float,2>{0.71801275f, 0.828588128f},
-std::array<float,2>{0.770689785f, 0.481657952f},
-std::array<float,2>{0.175986111f, 0.575534523f},
-std::array<float,2>{0.231534481f, 0.119783916f},
-std::array<float,2>{0.833477914f, 0.878110409f},
-std::array<float,2>{0.671461701f, 0.363989949f},
-std::array<float,2>{0.378761798f, 0.665011823f},
-std::array<float,2>{0.311087072f, 0.378910661f},
-std::array<float,2>{0.505102754f, 0.555824757f},
-std::array<float,2>{0.924165547f, 0.219055533f},
-std::array<float,2>{0.0893371701f, 0.770985067f},
-std::array<float,2>{0.23802726f, 0.305390805f},
-std::array<float,2>{0.822956502f, 0.690190792f},
-std::array<float,2>{0.684423208f, 0.00530803623f},
-std::array<float,2>{0.395112216f, 0.960915089f},
-std::array<float,2>{0.293320477f, 0.128842771f},
-std::array<float,2>{0.520412445f, 0.856734157f},
-std::array<float,2>{0.919817746f, 0.463826239f},
-std::array<float,2>{0.0645421147f, 0.611454129f},
-std::array<float,2>{0.00689519523f, 0.0670569688f},
-std::array<float,2>{0.97821188f, 0.91462785f},
-std::array<float,2>{0.620257556f, 0.322424591f},
-std::array<float,2>{0.36177513f, 0.634720325f},
-std::array<float,2>{0.447215736f, 0.435652703f},
-std::array<float,2>{0.691398203f, 0.503377497f},
-std::array<float,2>{0.759553552f, 0.189554408f},
-std::array<float,2>{0.170561492f, 0.793456376f},
-std::array<float,2>{0.118798777f, 0.478739589f},
-std::array<float,2>{0.889335513f, 0.572782397f},
-std::array<float,2>{0.5390746f, 0.173093393f},
-std::array<float,2>{0.256059855f, 0.833565176f},
-std::array<float,2>{0.410453737f, 0.0411583371f},
-std::array<float,2>{0.651296258f, 0.995175362f},
-std::array<float,2>{0.865261912f, 0.259017795f},
-std::array<float,2>{0.20218274f, 0.726642668f},
-std::array<float,2>{0.156125769f, 0.224456459f},
-std::array<float,2>{0.789215565f, 0.767265975f},
-std::array<float,2>{0.722558916f, 0.37601617f},
-std::array<float,2>{0.481477857f, 0.562079787f},
-std::array<float,2>{0.337422162f, 0.362801194f},
-std::array<float,2>{0.579729259f, 0.669974029f},
-std::array<float,2>{0.964387059f, 0.124756381f},
-std::array<float,2>{0.0444267131f, 0.882474601f},
-std::array<float,2>{0.184179187f, 0.391647607f},
-std::array<float,2>{0.775804937f, 0.536062777f},
-std::array<float,2>{0.707377732f, 0.242782474f},
-std::array<float,2>{0.457077146f, 0.756110251f},
-std::array<float,2>{0.345377952f, 0.0967997164f},
-std::array<float,2>{0.595819116f, 0.904636741f},
-std::array<float,2>{0.999610364f, 0.354885936f},
-std::array<float,2>{0.0242522359f, 0.676264524f},
-std::array<float,2>{0.0847057104f, 0.159402445f},
-std::array<float,2>{0.935947895f, 0.817335308f},
-std::array<float,2>{0.515435576f, 0.493501335f},
-std::array<float,2>{0.3001194f, 0.593714297f},
-std::array<float,2>{0.388037115f, 0.272187889f},
-std::array<float,2>{0.657060623f, 0.749368668f},
-std::array<float,2>{0.837486506f, 0.0594362579f},
-std::array<float,2>{0.220350996f, 0.971608937f},
-std::array<float,2>{0.055566214f, 0.33588171f},
-std::array<float,2>{0.940447628f, 0.648591101f},
-std::array<float,2>{0.567930996f, 0.0934165418f},
-std::array<float,2>{0.320918918f, 0.922263563f},
-std::array<float,2>{0.495856494f, 0.215741545f},
-std::array<float,2>{0.738658786f, 0.810672283f},
-std::array<float,2>{0.803819001f, 0.419997275f},
-std::array<float,2>{0.131439373f, 0.522799015f},
-std::array<float,2>{0.214480728f, 0.02939835f},
-std::array<float,2>{0.845568895f, 0.949250042f},
-std::array<float,2>{0.639750123f, 0.291068882f},
-std::array<float,2>{0.429044485f, 0.710829258f},
-std::array<float,2>{0.268234909f, 0.447411865f},
-std::array<float,2>{0.555089355f, 0.594573915f},
-std::array<float,2>{0.905631125f, 0.151481956f},
-std::array<float,2>{0.0966012627f, 0.873694241f},
-std::array<float,2>{0.136562899f, 0.348814785f},
-std::array<float,2>{0.811814249f, 0.680042446f},
-std::array<float,2>{0.743990719f, 0.103548229f},
-std::array<float,2>{0.491413832f, 0.890803993f},
-std::array<float,2>{0.318559676f, 0.237263978f},
-std::array<float,2>{0.5709126f, 0.762053192f},
-std::array<float,2>{0.951544821f, 0.405168205f},
-std::array<float,2>{0.0529369116f, 0.541161656f},
-std::array<float,2>{0.10633257f, 0.0524652749f},
-std::array<float,2>{0.892624795f, 0.976564586f},
-std::array<float,2>{0.547272086f, 0.273532987f},
-std::array<float,2>{0.276287228f, 0.736271739f},
-std::array<float,2>{0.432722598f, 0.487100273f},
-std::array<float,2>{0.632804215f, 0.583724916f},
-std::array<float,2>{0.855839014f, 0.165749148f},
-std::array<float,2>{0.210861579f, 0.827280402f},
-std::array<float,2>{0.0212932732f, 0.408258379f},
-std::array<float,2>{0.991232753f, 0.529179394f},
-std::array<float,2>{0.602837205f, 0.203696027f},
-std::array<float,2>{0.355781704f, 0.796986699f},
-std::array<float,2>{0.465987623f, 0.0798948184f},
-std::array<float,2>{0.711583018f, 0.931851268f},
-std::array<float,2>{0.766081154f, 0.339555323f},
-std::array<float,2>{0.173152223f, 0.642508149f},
-std::array<float,2>{0.228674188f, 0.147940919f},
-std::array<float,2>{0.829403877f, 0.866875231f},
-std::array<float,2>{0.666150331f, 0.445134968f},
-std::array<float,2>{0.381777495f, 0.602340758f},
-std::array<float,2>{0.304885447f, 0.284461558f},
-std::array<float,2>{0.503775835f, 0.712659478f},
-std::array<float,2>{0.927529693f, 0.0220485236f},
-std::array<float,2>{0.0926573202f, 0.942804098f},
-std::array<float,2>{0.188687846f, 0.455947101f},
-std::array<float,2>{0.873203099f, 0.618996739f},
-std::array<float,2>{0.645690799f, 0.138071805f},
-std::array<float,2>{0.418632835f, 0.846270859f},
-std::array<float,2>{0.263057411f, 0.0143147958f},
-std::array<float,2>{0.534590364f, 0.961230338f},
-std::array<float,2>{0.880071402f, 0.303245515f},
-std::array<float,2>{0.115198784f, 0.700455308f},
-std::array<float,2>{0.0373702496f, 0.201995224f},
-std::array<float,2>{0.955808043f, 0.788013816f},
-std::array<float,2>{0.593049526f, 0.42849198f},
-std::array<float,2>{0.33305949f, 0.511381805f},
-std::array<float,2>{0.468826622f, 0.314005047f},
-std::array<float,2>{0.728338778f, 0.62839514f},
-std::array<float,2>{0.784873664f, 0.0746463761f},
-std::array<float,2>{0.140821338f, 0.910990119f},
-std::array<float,2>{0.0706848949f, 0.251273811f},
-std::array<float,2>{0.907967746f, 0.722408831f},
-std::array<float,2>{0.529468179f, 0.0349795111f},
-std::array<float,2>{0.283370465f, 0.992037654f},
-std::array<float,2>{0.403822422f, 0.183363244f},
-std::array<float,2>{0.677739739f, 0.842538893f},
-std::array<float,2>{0.81488055f, 0.474865139f},
-std::array<float,2>{0.249818847f, 0.563404739f},
-std::array<float,2>{0.158263952f, 0.112649173f},
-std::array<float,2>{0.751120806f, 0.888490915f},
-std::array<float,2>{0.698188961f, 0.368094921f},
-std::array<float,2>{0.438073158f, 0.656453311f},
-std::array<float,2>{0.372894347f, 0.389241755f},
-std::array<float,2>{0.615077257f, 0.5481686f},
-std::array<float,2>{0.971480548f, 0.231170535f},
-std::array<float,2>{0.0084249163f, 0.781230867f},
-std::array<float,2>{0.164932758f, 0.280065596f},
-std::array<float,2>{0.763251483f, 0.739723265f},
-std::array<float,2>{0.694800019f, 0.0475844704f},
-std::array<float,2>{0.450218678f, 0.983766437f},
-std::array<float,2>{0.366936564f, 0.168253422f},
-std::array<float,2>{0.624200106f, 0.823829651f},
-std::array<float,2>{0.984048009f, 0.491445571f},
-std::array<float,2>{0.00164692616f, 0.578591287f},
-std::array<float,2>{0.0668236539f, 0.107707784f},
-std::array<float,2>{0.916073263f, 0.896879494f},
-std::array<float,2>{0.516007006f, 0.347156137f},
-std::array<float,2>{0.289367616f, 0.685748041f},
-std::array<float,2>{0.390978396f, 0.399372131f},
-std::array<float,2>{0.679691434f, 0.543499708f},
-std::array<float,2>{0.82773304f, 0.239775583f},
-std::array<float,2>{0.23967956f, 0.759721398f},
-std::array<float,2>{0.0427408591f, 0.437891603f},
-std::array<float,2>{0.965536177f, 0.605709434f},
-std::array<float,2>{0.585632801f, 0.142966881f},
-std::array<float,2>{0.342750847f, 0.862811744f},
-std::array<float,2>{0.480077773f, 0.0167054329f},
-std::array<float,2>{0.723689377f, 0.941259563f},
-std::array<float,2>{0.796503663f, 0.287404835f},
-std::array<float,2>{0.149248138f, 0.717227459f},
-std::array<float,2>{0.197775364f, 0.207685724f},
-std::array<float,2>{0.862061679f, 0.803767681f},
-std::array<float,2>{0.655705631f, 0.412714064f},
-std::array<float,2>{0.407564193f, 0.523587644f},
-std::array<float,2>{0.253166705f, 0.343553573f},
-std::array<float,2>{0.545939744f, 0.646870315f},
-std::array<float,2>{0.882817566f, 0.0852351189f},
-std::array<float,2>{0.122212932f, 0.934400439f},
-std::array<float,2>{0.222968563f, 0.425040424f},
-std::array<float,2>{0.842865884f, 0.515581608f},
-std::array<float,2>{0.66321528f, 0.196647257f},
-std::array<float,2>{0.386535674f, 0.782796443f},
-std::array<float,2>{0.301164061f, 0.0715591758f},
-std::array<float,2>{0.511514366f, 0.91005832f},
-std::array<float,2>{0.930815995f, 0.31772849f},
-std::array<float,2>{0.0782751366f, 0.631112218f},
-std::array<float,2>{0.02983764f, 0.134612948f},
-std::array<float,2>{0.995972812f, 0.850509703f},
-std::array<float,2>{0.600004613f, 0.457353324f},
-std::array<float,2>{0.348261416f, 0.622146726f},
-std::array<float,2>{0.455512166f, 0.299801409f},
-std::array<float,2>{0.706942201f, 0.698201358f},
-std::array<float,2>{0.778978884f, 0.00964519102f},
-std::array<float,2>{0.181880772f, 0.965435028f},
-std::array<float,2>{0.0986648053f, 0.374025464f},
-std::array<float,2>{0.898608029f, 0.660160005f},
-std::array<float,2>{0.560017467f, 0.116555803f},
-std::array<float,2>{0.270483732f, 0.885418117f},
-std::array<float,2>{0.422724038f, 0.227407441f},
-std::array<float,2>{0.634640217f, 0.774264932f},
-std::array<float,2>{0.849213839f, 0.385125488f},
-std::array<float,2>{0.215845644f, 0.551263809f},
-std::array<float,2>{0.125196233f, 0.0389050506f},
-std::array<float,2>{0.800477982f, 0.986902535f},
-std::array<float,2>{0.736448288f, 0.256162524f},
-std::array<float,2>{0.498348206f, 0.725845218f},
-std::array<float,2>{0.324269742f, 0.469119221f},
-std::array<float,2>{0.565880299f, 0.570158184f},
-std::array<float,2>{0.941896617f, 0.184275761f},
-std::array<float,2>{0.0623897724f, 0.83637166f},
-std::array<float,2>{0.205749542f, 0.324496627f},
-std::array<float,2>{0.854400873f, 0.63785398f},
-std::array<float,2>{0.628418148f, 0.0638293624f},
-std::array<float,2>{0.437081516f, 0.920350254f},
-std::array<float,2>{0.27846092f, 0.192301735f},
-std::array<float,2>{0.551256537f, 0.791880608f},
-std::array<float,2>{0.896114111f, 0.431776345f},
-std::array<float,2>{0.103175968f, 0.507748067f},
-std::array<float,2>{0.0489066616f, 0.000174050641f},
-std::array<float,2>{0.946594834f, 0.95659256f},
-std::array<float,2>{0.576762974f, 0.308656365f},
-std::array<float,2>{0.314731717f, 0.694454908f},
-std::array<float,2>{0.487029344f, 0.466422141f},
-std::array<float,2>{0.749213099f, 0.613469601f},
-std::array<float,2>{0.807381868f, 0.131381422f},
-std::array<float,2>{0.140004918f, 0.854486167f},
-std::array<float,2>{0.0879968852f, 0.382494032f},
-std::array<float,2>{0.925201654f, 0.556984007f},
-std::array<float,2>{0.504021287f, 0.22210896f},
-std::array<float,2>{0.311796635f, 0.772397995f},
-std::array<float,2>{0.377745837f, 0.118868962f},
-std::array<float,2>{0.669938564f, 0.875873446f},
-std::array<float,2>{0.832271516f, 0.365854293f},
-std::array<float,2>{0.230898276f, 0.666284144f},
-std::array<float,2>{0.177218974f, 0.179309174f},
-std::array<float,2>{0.770142138f, 0.831522703f},
-std::array<float,2>{0.716911972f, 0.482868642f},
-std::array<float,2>{0.462946415f, 0.577524483f},
-std::array<float,2>{0.351691812f, 0.264864534f},
-std::array<float,2>{0.608892798f, 0.730654001f},
-std::array<float,2>{0.984857619f, 0.046302598f},
-std::array<float,2>{0.0156837385f, 0.996353149f},
-std::array<float,2>{0.147944868f, 0.496433109f},
-std::array<float,2>{0.788926601f, 0.586376131f},
-std::array<float,2>{0.732463002f, 0.161928341f},
-std::array<float,2>{0.474967659f, 0.815083921f},
-std::array<float,2>{0.329741687f, 0.0563045107f},
-std::array<float,2>{0.589037716f, 0.976082146f},
-std::array<float,2>{0.95725143f, 0.266640693f},
-std::array<float,2>{0.0325601101f, 0.743557692f},
-std::array<float,2>{0.110185832f, 0.249059498f},
-std::array<float,2>{0.876722693f, 0.753211081f},
-std::array<float,2>{0.537349999f, 0.394746989f},
-std::array<float,2>{0.260674387f, 0.532408774f},
-std::array<float,2>{0.416439772f, 0.358510911f},
-std::array<float,2>{0.640628576f, 0.674515724f},
-std::array<float,2>{0.867919624f, 0.098355405f},
-std::array<float,2>{0.195012242f, 0.902097046f},
-std::array<float,2>{0.0135615841f, 0.294368207f},
-std::array<float,2>{0.973885059f, 0.70493561f},
-std::array<float,2>{0.611468673f, 0.0270257294f},
-std::array<float,2>{0.36844328f, 0.94749397f},
-std::array<float,2>{0.442412198f, 0.154013768f},
-std::array<float,2>{0.699255288f, 0.868315041f},
-std::array<float,2>{0.756975055f, 0.450366259f},
-std::array<float,2>{0.163678452f, 0.601140201f},
-std::array<float,2>{0.244057208f, 0.0872835666f},
-std::array<float,2>{0.819962084f, 0.9259606f},
-std::array<float,2>{0.675662816f, 0.331905574f},
-std::array<float,2>{0.400583893f, 0.654395282f},
-std::array<float,2>{0.28645584f, 0.415211111f},
-std::array<float,2>{0.526469111f, 0.516345263f},
-std::array<float,2>{0.910512686f, 0.211644754f},
-std::array<float,2>{0.0754305795f, 0.807297289f},
-std::array<float,2>{0.20076865f, 0.260578036f},
-std::array<float,2>{0.864518344f, 0.730200768f},
-std::array<float,2>{0.650165081f, 0.0409272946f},
-std::array<float,2>{0.413897604f, 0.992566466f},
-std::array<float,2>{0.25458315f, 0.174128816f},
-std::array<float,2>{0.542470515f, 0.835824013f},
-std::array<float,2>{0.88831389f, 0.476775974f},
-std::array<float,2>{0.119551532f, 0.570820689f},
-std::array<float,2>{0.0449706391f, 0.122799031f},
-std::array<float,2>{0.96229583f, 0.880799413f},
-std::array<float,2>{0.581474721f, 0.361319095f},
-std::array<float,2>{0.338505924f, 0.669847667f},
-std::array<float,2>{0.482744902f, 0.378127217f},
-std::array<float,2>{0.718945742f, 0.558775306f},
-std::array<float,2>{0.791430771f, 0.226354986f},
-std::array<float,2>{0.154177576f, 0.769330025f},
-std::array<float,2>{0.0631180555f, 0.461318225f},
-std::array<float,2>{0.920190692f, 0.610033035f},
-std::array<float,2>{0.522517502f, 0.126679569f},
-std::array<float,2>{0.295327276f, 0.857448399f},
-std::array<float,2>{0.397178739f, 0.00746956281f},
-std::array<float,2>{0.686784327f, 0.958054423f},
-std::array<float,2>{0.820772529f, 0.306928903f},
-std::array<float,2>{0.235906556f, 0.688202083f},
-std::array<float,2>{0.168029904f, 0.187929913f},
-std::array<float,2>{0.761287034f, 0.795482159f},
-std::array<float,2>{0.687797308f, 0.435111016f},
-std::array<float,2>{0.448389202f, 0.500403881f},
-std::array<float,2>{0.360803187f, 0.320659935f},
-std::array<float,2>{0.617481411f, 0.636182725f},
-std::array<float,2>{0.979009807f, 0.0696167946f},
-std::array<float,2>{0.00471600704f, 0.9165411f},
-std::array<float,2>{0.130246475f, 0.418454856f},
-std::array<float,2>{0.800916076f, 0.521002769f},
-std::array<float,2>{0.741564095f, 0.218496278f},
-std::array<float,2>{0.492783338f, 0.809067667f},
-std::array<float,2>{0.322781354f, 0.0910044387f},
-std::array<float,2>{0.568382502f, 0.924411297f},
-std::array<float,2>{0.937867343f, 0.332354277f},
-std::array<float,2>{0.0568399392f, 0.652288318f},
-std::array<float,2>{0.0955007747f, 0.149691924f},
-std::array<float,2>{0.903429747f, 0.872155607f},
-std::array<float,2>{0.556848168f, 0.447107255f},
-std::array<float,2>{0.266133249f, 0.596425951f},
-std::array<float,2>{0.425818771f, 0.289803386f},
-std::array<float,2>{0.63686949f, 0.707535923f},
-std::array<float,2>{0.847303927f, 0.0287835579f},
-std::array<float,2>{0.21138002f, 0.952456772f},
-std::array<float,2>{0.0256623309f, 0.352585196f},
-std::array<float,2>{0.996917009f, 0.67836827f},
-std::array<float,2>{0.595190644f, 0.0945926383f},
-std::array<float,2>{0.346973985f, 0.902348757f},
-std::array<float,2>{0.460758895f, 0.244324878f},
-std::array<float,2>{0.709914982f, 0.754589021f},
-std::array<float,2>{0.774411082f, 0.393423676f},
-std::array<float,2>{0.18622537f, 0.537579834f},
-std::array<float,2>{0.221112922f, 0.0616939925f},
-std::array<float,2>{0.83888942f, 0.969844878f},
-std::array<float,2>{0.658781171f, 0.270763427f},
-std::array<float,2>{0.389956504f, 0.747282386f},
-std::array<float,2>{0.297621965f, 0.494491458f},
-std::array<float,2>{0.511908472f, 0.591571867f},
-std::array<float,2>{0.935174644f, 0.158037379f},
-std::array<float,2>{0.082343258f, 0.819066644f},
-std::array<float,2>{0.174864873f, 0.336085528f},
-std::array<float,2>{0.767593086f, 0.643835723f},
-std::array<float,2>{0.714339554f, 0.0816090032f},
-std::array<float,2>{0.46736604f, 0.93045944f},
-std::array<float,2>{0.359185308f, 0.206358641f},
-std::array<float,2>{0.603657067f, 0.800191224f},
-std::array<float,2>{0.989780366f, 0.407036066f},
-std::array<float,2>{0.0224905554f, 0.529899418f},
-std::array<float,2>{0.090847306f, 0.019839352f},
-std::array<float,2>{0.929317832f, 0.944042087f},
-std::array<float,2>{0.50011313f, 0.282747537f},
-std::array<float,2>{0.306904852f, 0.71426481f},
-std::array<float,2>{0.380117714f, 0.441737235f},
-std::array<float,2>{0.664847791f, 0.605012953f},
-std::array<float,2>{0.830448627f, 0.145222455f},
-std::array<float,2>{0.227540344f, 0.864094734f},
-std::array<float,2>{0.0514939129f, 0.402770251f},
-std::array<float,2>{0.949708402f, 0.540788829f},
-std::array<float,2>{0.57314086f, 0.234869659f},
-std::array<float,2>{0.317158043f, 0.763971269f},
-std::array<float,2>{0.488724798f, 0.101837873f},
-std::array<float,2>{0.745257676f, 0.894282758f},
-std::array<float,2>{0.809190154f, 0.350927055f},
-std::array<float,2>{0.133858949f, 0.683210433f},
-std::array<float,2>{0.208915934f, 0.166606352f},
-std::array<float,2>{0.859087825f, 0.824654937f},
-std::array<float,2>{0.630100191f, 0.485286981f},
-std::array<float,2>{0.430115402f, 0.585350692f},
-std::array<float,2>{0.274729341f, 0.277292073f},
-std::array<float,2>{0.550396562f, 0.737618208f},
-std::array<float,2>{0.892346203f, 0.0541089699f},
-std::array<float,2>{0.108670712f, 0.979122818f},
-std::array<float,2>{0.248001635f, 0.473560929f},
-std::array<float,2>{0.813666701f, 0.566272616f},
-std::array<float,2>{0.677255332f, 0.180309132f},
-std::array<float,2>{0.404344946f, 0.84161973f},
-std::array<float,2>{0.282427907f, 0.03206864f},
-std::array<float,2>{0.527482569f, 0.988599539f},
-std::array<float,2>{0.909480691f, 0.253366709f},
-std::array<float,2>{0.0730172396f, 0.718852282f},
-std::array<float,2>{0.011059247f, 0.234352261f},
-std::array<float,2>{0.969149888f, 0.778201461f},
-std::array<float,2>{0.616302431f, 0.387601554f},
-std::array<float,2>{0.37394613f, 0.549660325f},
-std::array<float,2>{0.439483792f, 0.37025103f},
-std::array<float,2>{0.696126282f, 0.659591019f},
-std::array<float,2>{0.75294894f, 0.11123684f},
-std::array<float,2>{0.158187151f, 0.888862073f},
-std::array<float,2>{0.115796886f, 0.30160284f},
-std::array<float,2>{0.881789029f, 0.70154196f},
-std::array<float,2>{0.531938076f, 0.012455483f},
-std::array<float,2>{0.264446527f, 0.963500261f},
-std::array<float,2>{0.421856642f, 0.139772788f},
-std::array<float,2>{0.647864521f, 0.844152749f},
-std::array<float,2>{0.871392548f, 0.453131169f},
-std::array<float,2>{0.190664947f, 0.620772302f},
-std::array<float,2>{0.142694294f, 0.0772347152f},
-std::array<float,2>{0.782005787f, 0.913984358f},
-std::array<float,2>{0.730141878f, 0.314825952f},
-std::array<float,2>{0.472091615f, 0.6257025f},
-std::array<float,2>{0.334652215f, 0.427268386f},
-std::array<float,2>{0.591758609f, 0.508528709f},
-std::array<float,2>{0.953784168f, 0.200671747f},
-std::array<float,2>{0.0357672423f, 0.78542763f},
-std::array<float,2>{0.151298717f, 0.285397321f},
-std::array<float,2>{0.794341803f, 0.715411246f},
-std::array<float,2>{0.726460755f, 0.0183085147f},
-std::array<float,2>{0.47848478f, 0.93769604f},
-std::array<float,2>{0.341609627f, 0.141390756f},
-std::array<float,2>{0.58312726f, 0.859861076f},
-std::array<float,2>{0.966913223f, 0.440547526f},
-std::array<float,2>{0.040691223f, 0.607922018f},
-std::array<float,2>{0.123686291f, 0.0834123492f},
-std::array<float,2>{0.886047125f, 0.937291384f},
-std::array<float,2>{0.544389784f, 0.339868367f},
-std::array<float,2>{0.251881331f, 0.645578086f},
-std::array<float,2>{0.409114927f, 0.411498517f},
-std::array<float,2>{0.653650582f, 0.527221382f},
-std::array<float,2>{0.860777378f, 0.209853217f},
-std::array<float,2>{0.196728155f, 0.802491605f},
-std::array<float,2>{0.00284203002f, 0.488640994f},
-std::array<float,2>{0.981888592f, 0.580726802f},
-std::array<float,2>{0.621147871f, 0.170777991f},
-std::array<float,2>{0.363426447f, 0.821032882f},
-std::array<float,2>{0.452901065f, 0.0507057272f},
-std::array<float,2>{0.69249779f, 0.981021821f},
-std::array<float,2>{0.765168488f, 0.278361261f},
-std::array<float,2>{0.167231292f, 0.741929531f},
-std::array<float,2>{0.2421159f, 0.241152331f},
-std::array<float,2>{0.824577034f, 0.760818422f},
-std::array<float,2>{0.683232844f, 0.401700288f},
-std::array<float,2>{0.393787384f, 0.545533657f},
-std::array<float,2>{0.291240424f, 0.344924241f},
-std::array<float,2>{0.518227279f, 0.684635818f},
-std::array<float,2>{0.915338218f, 0.106295854f},
-std::array<float,2>{0.0687275156f, 0.896376729f},
-std::array<float,2>{0.21734111f, 0.383207411f},
-std::array<float,2>{0.850707829f, 0.554111302f},
-std::array<float,2>{0.635535359f, 0.229574829f},
-std::array<float,2>{0.425617665f, 0.775566995f},
-std::array<float,2>{0.272169858f, 0.114517614f},
-std::array<float,2>{0.561760247f, 0.883861721f},
-std::array<float,2>{0.901614368f, 0.37163803f},
-std::array<float,2>{0.100402661f, 0.662358046f},
-std::array<float,2>{0.0605172329f, 0.18681559f},
-std::array<float,2>{0.944232166f, 0.839206338f},
-std::array<float,2>{0.563653409f, 0.472084105f},
-std::array<float,2>{0.327792317f, 0.567257822f},
-std::array<float,2>{0.497852802f, 0.25520426f},
-std::array<float,2>{0.735069394f, 0.724478602f},
-std::array<float,2>{0.798303306f, 0.0352185294f},
-std::array<float,2>{0.128244624f, 0.984569371f},
-std::array<float,2>{0.0800951347f, 0.320172131f},
-std::array<float,2>{0.932618201f, 0.629333198f},
-std::array<float,2>{0.509071767f, 0.0735734552f},
-std::array<float,2>{0.303225458f, 0.907066047f},
-std::array<float,2>{0.384640574f, 0.19900541f},
-std::array<float,2>{0.660844266f, 0.783367872f},
-std::array<float,2>{0.841219962f, 0.422467709f},
-std::array<float,2>{0.226039261f, 0.512335777f},
-std::array<float,2>{0.17995128f, 0.0114015089f},
-std::array<float,2>{0.781035185f, 0.967995048f},
-std::array<float,2>{0.703951061f, 0.298653513f},
-std::array<float,2>{0.453399509f, 0.697116911f},
-std::array<float,2>{0.350306332f, 0.460351944f},
-std::array<float,2>{0.598155677f, 0.623252094f},
-std::array<float,2>{0.992371917f, 0.13606441f},
-std::array<float,2>{0.0279008038f, 0.848180354f},
-std::array<float,2>{0.233296439f, 0.364552945f},
-std::array<float,2>{0.83439374f, 0.665740013f},
-std::array<float,2>{0.668863773f, 0.120879352f},
-std::array<float,2>{0.376503229f, 0.877422035f},
-std::array<float,2>{0.310398757f, 0.220421687f},
-std::array<float,2>{0.506027579f, 0.770379186f},
-std::array<float,2>{0.923495889f, 0.380189836f},
-std::array<float,2>{0.0864608437f, 0.555330217f},
-std::array<float,2>{0.0183958746f, 0.0447095335f},
-std::array<float,2>{0.988190114f, 0.999432147f},
-std::array<float,2>{0.605504811f, 0.263395488f},
-std::array<float,2>{0.355246574f, 0.732795477f},
-std::array<float,2>{0.462101549f, 0.480685353f},
-std::array<float,2>{0.715953052f, 0.574673891f},
-std::array<float,2>{0.773216784f, 0.17601651f},
-std::array<float,2>{0.179005742f, 0.829230249f},
-std::array<float,2>{0.1036411f, 0.429876089f},
-std::array<float,2>{0.897128105f, 0.505213439f},
-std::array<float,2>{0.554052055f, 0.194178268f},
-std::array<float,2>{0.280974776f, 0.789740443f},
-std::array<float,2>{0.433798164f, 0.0646979809f},
-std::array<float,2>{0.626262724f, 0.919412792f},
-std::array<float,2>{0.851803899f, 0.327956647f},
-std::array<float,2>{0.203485399f, 0.640191555f},
-std::array<float,2>{0.138152033f, 0.130768776f},
-std::array<float,2>{0.805479705f, 0.852866411f},
-std::array<float,2>{0.746621966f, 0.467367589f},
-std::array<float,2>{0.48569423f, 0.616226196f},
-std::array<float,2>{0.312687576f, 0.312042028f},
-std::array<float,2>{0.574465811f, 0.6921615f},
-std::array<float,2>{0.948218465f, 0.00274067908f},
-std::array<float,2>{0.0476208068f, 0.953743339f},
-std::array<float,2>{0.161839068f, 0.451520532f},
-std::array<float,2>{0.755225301f, 0.598895133f},
-std::array<float,2>{0.702132285f, 0.155934006f},
-std::array<float,2>{0.445018381f, 0.870946288f},
-std::array<float,2>{0.370624989f, 0.0249283519f},
-std::array<float,2>{0.609616935f, 0.945697963f},
-std::array<float,2>{0.974687517f, 0.296271205f},
-std::array<float,2>{0.0153966835f, 0.706394017f},
-std::array<float,2>{0.0770360678f, 0.214676246f},
-std::array<float,2>{0.913250327f, 0.805771708f},
-std::array<float,2>{0.524661899f, 0.416254669f},
-std::array<float,2>{0.288901985f, 0.519326806f},
-std::array<float,2>{0.398608297f, 0.32900393f},
-std::array<float,2>{0.672789037f, 0.652547717f},
-std::array<float,2>{0.817022264f, 0.0882009044f},
-std::array<float,2>{0.246037602f, 0.929094672f},
-std::array<float,2>{0.0350879207f, 0.269233853f},
-std::array<float,2>{0.95938772f, 0.745492578f},
-std::array<float,2>{0.586723506f, 0.0568980984f},
-std::array<float,2>{0.330435395f, 0.973573387f},
-std::array<float,2>{0.473990381f, 0.163812488f},
-std::array<float,2>{0.731559634f, 0.814418495f},
-std::array<float,2>{0.785830438f, 0.499896646f},
-std::array<float,2>{0.146146268f, 0.588635147f},
-std::array<float,2>{0.192670181f, 0.101056397f},
-std::array<float,2>{0.869539738f, 0.899523914f},
-std::array<float,2>{0.64347291f, 0.357381701f},
-std::array<float,2>{0.415524036f, 0.672042549f},
-std::array<float,2>{0.258552313f, 0.396859258f},
-std::array<float,2>{0.536677897f, 0.534757853f},
-std::array<float,2>{0.878817022f, 0.246765137f},
-std::array<float,2>{0.11137899f, 0.75030601f},
-std::array<float,2>{0.1963716f, 0.288629085f},
-std::array<float,2>{0.860587776f, 0.718171775f},
-std::array<float,2>{0.653360784f, 0.0159706194f},
-std::array<float,2>{0.408753306f, 0.939688206f},
-std::array<float,2>{0.251502007f, 0.143714443f},
-std::array<float,2>{0.544118047f, 0.861591876f},
-std::array<float,2>{0.885799766f, 0.43881765f},
-std::array<float,2>{0.123809978f, 0.607007802f},
-std::array<float,2>{0.0408987999f, 0.0841294453f},
-std::array<float,2>{0.967175663f, 0.935052633f},
-std::array<float,2>{0.583470821f, 0.342508852f},
-std::array<float,2>{0.341429025f, 0.648168147f},
-std::array<float,2>{0.478125036f, 0.414002955f},
-std::array<float,2>{0.72616142f, 0.525133967f},
-std::array<float,2>{0.794140399f, 0.208201289f},
-std::array<float,2>{0.151095837f, 0.802811861f},
-std::array<float,2>{0.0685625076f, 0.490771085f},
-std::array<float,2>{0.915189087f, 0.579649568f},
-std::array<float,2>{0.518521488f, 0.169184297f},
-std::array<float,2>{0.291445434f, 0.822596014f},
-std::array<float,2>{0.393835604f, 0.0479447953f},
-std::array<float,2>{0.683467686f, 0.982675374f},
-std::array<float,2>{0.824281096f, 0.281091034f},
-std::array<float,2>{0.241794124f, 0.73899579f},
-std::array<float,2>{0.167334199f, 0.239105299f},
-std::array<float,2>{0.765513778f, 0.757825494f},
-std::array<float,2>{0.692719877f, 0.399497479f},
-std::array<float,2>{0.452668011f, 0.544675827f},
-std::array<float,2>{0.363570899f, 0.346397877f},
-std::array<float,2>{0.621487141f, 0.686950743f},
-std::array<float,2>{0.981680512f, 0.108592704f},
-std::array<float,2>{0.00264087017f, 0.897658944f},
-std::array<float,2>{0.128171086f, 0.385852247f},
-std::array<float,2>{0.797917485f, 0.552723944f},
-std::array<float,2>{0.735268235f, 0.228208244f},
-std::array<float,2>{0.497670442f, 0.775159299f},
-std::array<float,2>{0.328081369f, 0.115987182f},
-std::array<float,2>{0.563938797f, 0.886668682f},
-std::array<float,2>{0.943865061f, 0.374018073f},
-std::array<float,2>{0.0601672865f, 0.661399186f},
-std::array<float,2>{0.100283489f, 0.185075849f},
-std::array<float,2>{0.901542485f, 0.837198019f},
-std::array<float,2>{0.56182003f, 0.470391363f},
-std::array<float,2>{0.272359788f, 0.56914854f},
-std::array<float,2>{0.425480545f, 0.257755518f},
-std::array<float,2>{0.635308385f, 0.725518405f},
-std::array<float,2>{0.851012409f, 0.037620239f},
-std::array<float,2>{0.217772126f, 0.987804592f},
-std::array<float,2>{0.028127715f, 0.317107707f},
-std::array<float,2>{0.99262172f, 0.632089913f},
-std::array<float,2>{0.598517001f, 0.0705899596f},
-std::array<float,2>{0.350484848f, 0.909081757f},
-std::array<float,2>{0.453310996f, 0.196267396f},
-std::array<float,2>{0.703707993f, 0.781357229f},
-std::array<float,2>{0.780961812f, 0.424289495f},
-std::array<float,2>{0.179803506f, 0.514418662f},
-std::array<float,2>{0.225606099f, 0.00860913377f},
-std::array<float,2>{0.840828121f, 0.966202974f},
-std::array<float,2>{0.661003709f, 0.299999475f},
-std::array<float,2>{0.38429293f, 0.699068069f},
-std::array<float,2>{0.303552657f, 0.458035916f},
-std::array<float,2>{0.508792281f, 0.621204138f},
-std::array<float,2>{0.933000863f, 0.13301447f},
-std::array<float,2>{0.0803983957f, 0.850848615f},
-std::array<float,2>{0.178786054f, 0.366822988f},
-std::array<float,2>{0.772996247f, 0.667543948f},
-std::array<float,2>{0.716121972f, 0.117866747f},
-std::array<float,2>{0.462353975f, 0.876506567f},
-std::array<float,2>{0.355169356f, 0.221264154f},
-std::array<float,2>{0.605801344f, 0.772679329f},
-std::array<float,2>{0.988034248f, 0.381697297f},
-std::array<float,2>{0.0181168355f, 0.557905853f},
-std::array<float,2>{0.0867304131f, 0.04496805f},
-std::array<float,2>{0.923699856f, 0.997417867f},
-std::array<float,2>{0.506162286f, 0.264526337f},
-std::array<float,2>{0.310116827f, 0.731900752f},
-std::array<float,2>{0.376756638f, 0.483465403f},
-std::array<float,2>{0.668631554f, 0.576963961f},
-std::array<float,2>{0.834116161f, 0.178372458f},
-std::array<float,2>{0.2329804f, 0.830793738f},
-std::array<float,2>{0.0473803505f, 0.433200002f},
-std::array<float,2>{0.947986066f, 0.506002247f},
-std::array<float,2>{0.574436963f, 0.192395642f},
-std::array<float,2>{0.312966794f, 0.792478502f},
-std::array<float,2>{0.485476196f, 0.0626356676f},
-std::array<float,2>{0.74685508f, 0.921754479f},
-std::array<float,2>{0.805355191f, 0.325458407f},
-std::array<float,2>{0.137705952f, 0.636956394f},
-std::array<float,2>{0.203353271f, 0.132538348f},
-std::array<float,2>{0.851998508f, 0.855097175f},
-std::array<float,2>{0.626161158f, 0.464942276f},
-std::array<float,2>{0.433952063f, 0.615061581f},
-std::array<float,2>{0.281098515f, 0.309849441f},
-std::array<float,2>{0.553863406f, 0.693671703f},
-std::array<float,2>{0.897304118f, 0.0014413126f},
-std::array<float,2>{0.103967644f, 0.955212355f},
-std::array<float,2>{0.245606586f, 0.449401587f},
-std::array<float,2>{0.817324817f, 0.600575626f},
-std::array<float,2>{0.672391295f, 0.152620733f},
-std::array<float,2>{0.398702562f, 0.867994845f},
-std::array<float,2>{0.288606673f, 0.0263110176f},
-std::array<float,2>{0.524621844f, 0.948877871f},
-std::array<float,2>{0.913487911f, 0.293701112f},
-std::array<float,2>{0.0768258199f, 0.703605294f},
-std::array<float,2>{0.0151927294f, 0.212707743f},
-std::array<float,2>{0.975048184f, 0.808395028f},
-std::array<float,2>{0.60975641f, 0.414558023f},
-std::array<float,2>{0.370949835f, 0.516833425f},
-std::array<float,2>{0.44529596f, 0.33077234f},
-std::array<float,2>{0.701665938f, 0.655376434f},
-std::array<float,2>{0.75495106f, 0.0864317939f},
-std::array<float,2>{0.161951154f, 0.92700249f},
-std::array<float,2>{0.111675985f, 0.265785098f},
-std::array<float,2>{0.878591001f, 0.742216468f},
-std::array<float,2>{0.536933482f, 0.0550714098f},
-std::array<float,2>{0.258517295f, 0.975224912f},
-std::array<float,2>{0.415104181f, 0.160532638f},
-std::array<float,2>{0.643299997f, 0.81596458f},
-std::array<float,2>{0.869148195f, 0.497411668f},
-std::array<float,2>{0.192490995f, 0.587188125f},
-std::array<float,2>{0.146449789f, 0.098636277f},
-std::array<float,2>{0.786021411f, 0.900614619f},
-std::array<float,2>{0.731925607f, 0.357960463f},
-std::array<float,2>{0.473720253f, 0.675232828f},
-std::array<float,2>{0.330311328f, 0.395631522f},
-std::array<float,2>{0.586540043f, 0.531563342f},
-std::array<float,2>{0.959184349f, 0.248944849f},
-std::array<float,2>{0.0348429307f, 0.752825618f},
-std::array<float,2>{0.154040694f, 0.257996172f},
-std::array<float,2>{0.791061163f, 0.727957308f},
-std::array<float,2>{0.719039321f, 0.0420998186f},
-std::array<float,2>{0.48253718f, 0.995094836f},
-std::array<float,2>{0.338719159f, 0.172522292f},
-std::array<float,2>{0.581159234f, 0.832111001f},
-std::array<float,2>{0.962055445f, 0.479811937f},
-std::array<float,2>{0.0453602001f, 0.573725462f},
-std::array<float,2>{0.119217522f, 0.12365339f},
-std::array<float,2>{0.888566375f, 0.88173914f},
-std::array<float,2>{0.542201936f, 0.362195909f},
-std::array<float,2>{0.25472036f, 0.671586394f},
-std::array<float,2>{0.413603902f, 0.37522912f},
-std::array<float,2>{0.649953842f, 0.561338007f},
-std::array<float,2>{0.86436671f, 0.222691417f},
-std::array<float,2>{0.200973883f, 0.765849054f},
-std::array<float,2>{0.00446772901f, 0.464428693f},
-std::array<float,2>{0.97948283f, 0.612567782f},
-std::array<float,2>{0.617316544f, 0.127086639f},
-std::array<float,2>{0.360537857f, 0.855777323f},
-std::array<float,2>{0.448594809f, 0.00472778222f},
-std::array<float,2>{0.687699497f, 0.959913731f},
-std::array<float,2>{0.761628211f, 0.305988729f},
-std::array<float,2>{0.168281749f, 0.690774441f},
-std::array<float,2>{0.236123949f, 0.191377819f},
-std::array<float,2>{0.82040143f, 0.794622123f},
-std::array<float,2>{0.686575234f, 0.437205225f},
-std::array<float,2>{0.397294253f, 0.501982808f},
-std::array<float,2>{0.294997513f, 0.32334733f},
-std::array<float,2>{0.522919416f, 0.633461654f},
-std::array<float,2>{0.92012459f, 0.0681115687f},
-std::array<float,2>{0.0633704364f, 0.915994048f},
-std::array<float,2>{0.211121812f, 0.421329379f},
-std::array<float,2>{0.847483277f, 0.521808743f},
-std::array<float,2>{0.63709569f, 0.216123298f},
-std::array<float,2>{0.42606318f, 0.812010765f},
-std::array<float,2>{0.266557902f, 0.0923865587f},
-std::array<float,2>{0.556926072f, 0.922940254f},
-std::array<float,2>{0.903770745f, 0.334369004f},
-std::array<float,2>{0.0952242091f, 0.649750769f},
-std::array<float,2>{0.0570239313f, 0.150676489f},
-std::array<float,2>{0.937516928f, 0.874813616f},
-std::array<float,2>{0.568659008f, 0.448467374f},
-std::array<float,2>{0.323015988f, 0.594962478f},
-std::array<float,2>{0.493140727f, 0.292229384f},
-std::array<float,2>{0.741373777f, 0.709479988f},
-std::array<float,2>{0.801203012f, 0.030564364f},
-std::array<float,2>{0.129994377f, 0.950479448f},
-std::array<float,2>{0.0820690542f, 0.354222834f},
-std::array<float,2>{0.935307086f, 0.676783383f},
-std::array<float,2>{0.511967123f, 0.0965072587f},
-std::array<float,2>{0.297477186f, 0.905411303f},
-std::array<float,2>{0.389828593f, 0.243956015f},
-std::array<float,2>{0.658973098f, 0.757472575f},
-std::array<float,2>{0.839220822f, 0.390781611f},
-std::array<float,2>{0.220904663f, 0.536764681f},
-std::array<float,2>{0.186487198f, 0.0596208312f},
-std::array<float,2>{0.774025321f, 0.971828401f},
-std::array<float,2>{0.70971024f, 0.27282697f},
-std::array<float,2>{0.46064046f, 0.748545468f},
-std::array<float,2>{0.34691447f, 0.492264211f},
-std::array<float,2>{0.594952464f, 0.592031419f},
-std::array<float,2>{0.996642232f, 0.158314899f},
-std::array<float,2>{0.025440501f, 0.817561388f},
-std::array<float,2>{0.227786005f, 0.338002533f},
-std::array<float,2>{0.830132842f, 0.640826762f},
-std::array<float,2>{0.664554f, 0.0790150538f},
-std::array<float,2>{0.380242795f, 0.932637215f},
-std::array<float,2>{0.306679487f, 0.204206094f},
-std::array<float,2>{0.500384092f, 0.798376739f},
-std::array<float,2>{0.929488719f, 0.409953535f},
-std::array<float,2>{0.0912030339f, 0.528084517f},
-std::array<float,2>{0.0229200013f, 0.0230624247f},
-std::array<float,2>{0.990081131f, 0.941440105f},
-std::array<float,2>{0.603759825f, 0.283563435f},
-std::array<float,2>{0.359012157f, 0.711508751f},
-std::array<float,2>{0.467622966f, 0.443944126f},
-std::array<float,2>{0.714008629f, 0.602968216f},
-std::array<float,2>{0.767929435f, 0.146602347f},
-std::array<float,2>{0.17513071f, 0.865804255f},
-std::array<float,2>{0.108432047f, 0.405303746f},
-std::array<float,2>{0.892159998f, 0.542727053f},
-std::array<float,2>{0.550688446f, 0.237544328f},
-std::array<float,2>{0.274637312f, 0.762879014f},
-std::array<float,2>{0.429769933f, 0.104545087f},
-std::array<float,2>{0.630194843f, 0.891862214f},
-std::array<float,2>{0.85914284f, 0.347898215f},
-std::array<float,2>{0.208501652f, 0.68131578f},
-std::array<float,2>{0.134137347f, 0.164261878f},
-std::array<float,2>{0.809340537f, 0.827093482f},
-std::array<float,2>{0.745561242f, 0.487722754f},
-std::array<float,2>{0.488292128f, 0.58224982f},
-std::array<float,2>{0.316940725f, 0.274894863f},
-std::array<float,2>{0.572790086f, 0.735060692f},
-std::array<float,2>{0.950157583f, 0.0516476817f},
-std::array<float,2>{0.0515982509f, 0.977597296f},
-std::array<float,2>{0.157774523f, 0.475698829f},
-std::array<float,2>{0.753300786f, 0.563546538f},
-std::array<float,2>{0.69581753f, 0.1817099f},
-std::array<float,2>{0.439714611f, 0.843317628f},
-std::array<float,2>{0.373652786f, 0.033420071f},
-std::array<float,2>{0.616477907f, 0.990808129f},
-std::array<float,2>{0.968837738f, 0.250641078f},
-std::array<float,2>{0.0108425906f, 0.720787227f},
-std::array<float,2>{0.0729627013f, 0.231799588f},
-std::array<float,2>{0.909306407f, 0.779838741f},
-std::array<float,2>{0.527648211f, 0.390078902f},
-std::array<float,2>{0.282712728f, 0.546931386f},
-std::array<float,2>{0.404592037f, 0.368712664f},
-std::array<float,2>{0.677522779f, 0.657305241f},
-std::array<float,2>{0.813864291f, 0.111358479f},
-std::array<float,2>{0.247677788f, 0.887020648f},
-std::array<float,2>{0.0360426009f, 0.304022372f},
-std::array<float,2>{0.954075575f, 0.699630558f},
-std::array<float,2>{0.591454327f, 0.0152465869f},
-std::array<float,2>{0.334826946f, 0.962229013f},
-std::array<float,2>{0.471779525f, 0.136861339f},
-std::array<float,2>{0.730300307f, 0.847257018f},
-std::array<float,2>{0.781970143f, 0.456832707f},
-std::array<float,2>{0.143023893f, 0.618076622f},
-std::array<float,2>{0.190897897f, 0.0756988674f},
-std::array<float,2>{0.871192336f, 0.911876917f},
-std::array<float,2>{0.647659063f, 0.313012958f},
-std::array<float,2>{0.421431124f, 0.627387464f},
-std::array<float,2>{0.264365911f, 0.428791076f},
-std::array<float,2>{0.532144606f, 0.510169446f},
-std::array<float,2>{0.881549418f, 0.202387631f},
-std::array<float,2>{0.115996286f, 0.788766563f},
-std::array<float,2>{0.239306852f, 0.277438432f},
-std::array<float,2>{0.828098178f, 0.740874469f},
-std::array<float,2>{0.680002511f, 0.0492706895f},
-std::array<float,2>{0.390647292f, 0.982248724f},
-std::array<float,2>{0.289087862f, 0.171324059f},
-std::array<float,2>{0.515733659f, 0.821737289f},
-std::array<float,2>{0.916405618f, 0.489757091f},
-std::array<float,2>{0.0665953383f, 0.581132293f},
-std::array<float,2>{0.00174879888f, 0.106692724f},
-std::array<float,2>{0.984320998f, 0.894752741f},
-std::array<float,2>{0.624310076f, 0.344663829f},
-std::array<float,2>{0.367004812f, 0.684548378f},
-std::array<float,2>{0.450461864f, 0.400823295f},
-std::array<float,2>{0.694391072f, 0.546400785f},
-std::array<float,2>{0.763451636f, 0.241819009f},
-std::array<float,2>{0.164655164f, 0.759922981f},
-std::array<float,2>{0.122314997f, 0.439555824f},
-std::array<float,2>{0.883128285f, 0.609045386f},
-std::array<float,2>{0.546298087f, 0.142245665f},
-std::array<float,2>{0.253410637f, 0.861109078f},
-std::array<float,2>{0.407459617f, 0.0185786746f},
-std::array<float,2>{0.655277252f, 0.938480496f},
-std::array<float,2>{0.862047791f, 0.286460906f},
-std::array<float,2>{0.198171645f, 0.71615833f},
-std::array<float,2>{0.149139345f, 0.210496157f},
-std::array<float,2>{0.796638072f, 0.800893188f},
-std::array<float,2>{0.72411859f, 0.410703272f},
-std::array<float,2>{0.480406582f, 0.525629699f},
-std::array<float,2>{0.342342496f, 0.341137856f},
-std::array<float,2>{0.585745096f, 0.644987941f},
-std::array<float,2>{0.965701699f, 0.0823339671f},
-std::array<float,2>{0.0426061004f, 0.935679078f},
-std::array<float,2>{0.181965202f, 0.423515111f},
-std::array<float,2>{0.779239178f, 0.512711942f},
-std::array<float,2>{0.706702054f, 0.197803825f},
-std::array<float,2>{0.455166936f, 0.784487784f},
-std::array<float,2>{0.348461539f, 0.0728589147f},
-std::array<float,2>{0.599775016f, 0.907318771f},
-std::array<float,2>{0.995707393f, 0.318918675f},
-std::array<float,2>{0.0302278697f, 0.630789161f},
-std::array<float,2>{0.0785575882f, 0.135225058f},
-std::array<float,2>{0.931130409f, 0.849134386f},
-std::array<float,2>{0.511380255f, 0.459729165f},
-std::array<float,2>{0.30085057f, 0.624154449f},
-std::array<float,2>{0.386254877f, 0.29761076f},
-std::array<float,2>{0.66349411f, 0.696197033f},
-std::array<float,2>{0.843122602f, 0.0105779227f},
-std::array<float,2>{0.222700909f, 0.967106223f},
-std::array<float,2>{0.0622541308f, 0.372909099f},
-std::array<float,2>{0.942209721f, 0.663622916f},
-std::array<float,2>{0.565539241f, 0.113746047f},
-std::array<float,2>{0.324558437f, 0.883151233f},
-std::array<float,2>{0.498051614f, 0.228956163f},
-std::array<float,2>{0.736683309f, 0.777329743f},
-std::array<float,2>{0.800672114f, 0.384643674f},
-std::array<float,2>{0.125483871f, 0.553202808f},
-std::array<float,2>{0.216103986f, 0.0361451395f},
-std::array<float,2>{0.849560201f, 0.985454321f},
-std::array<float,2>{0.634360194f, 0.25459224f},
-std::array<float,2>{0.422415912f, 0.722903311f},
-std::array<float,2>{0.27016151f, 0.470815092f},
-std::array<float,2>{0.559633195f, 0.567630291f},
-std::array<float,2>{0.898807526f, 0.18650955f},
-std::array<float,2>{0.0989851952f, 0.83852452f},
-std::array<float,2>{0.139719605f, 0.326784134f},
-std::array<float,2>{0.807130039f, 0.638866603f},
-std::array<float,2>{0.749358118f, 0.0657051951f},
-std::array<float,2>{0.487193435f, 0.918098986f},
-std::array<float,2>{0.314468801f, 0.194985822f},
-std::array<float,2>{0.576911926f, 0.790579617f},
-std::array<float,2>{0.946387231f, 0.431116879f},
-std::array<float,2>{0.0493017845f, 0.504351914f},
-std::array<float,2>{0.103315219f, 0.00308082555f},
-std::array<float,2>{0.896423519f, 0.954715192f},
-std::array<float,2>{0.551003218f, 0.311356366f},
-std::array<float,2>{0.278754532f, 0.693357646f},
-std::array<float,2>{0.437369436f, 0.468519241f},
-std::array<float,2>{0.628847778f, 0.616081119f},
-std::array<float,2>{0.854046047f, 0.129767776f},
-std::array<float,2>{0.205929965f, 0.852000773f},
-std::array<float,2>{0.0159130469f, 0.379753798f},
-std::array<float,2>{0.984465837f, 0.556346774f},
-std::array<float,2>{0.609309852f, 0.219487607f},
-std::array<float,2>{0.351878285f, 0.771295905f},
-std::array<float,2>{0.463372439f, 0.11938671f},
-std::array<float,2>{0.717232347f, 0.878577054f},
-std::array<float,2>{0.770478904f, 0.363574684f},
-std::array<float,2>{0.176814809f, 0.664083898f},
-std::array<float,2>{0.230674431f, 0.176952511f},
-std::array<float,2>{0.832419574f, 0.829020202f},
-std::array<float,2>{0.67021507f, 0.482259363f},
-std::array<float,2>{0.377470762f, 0.575910509f},
-std::array<float,2>{0.31158331f, 0.262518257f},
-std::array<float,2>{0.504381061f, 0.73388052f},
-std::array<float,2>{0.924969077f, 0.0434366576f},
-std::array<float,2>{0.0881883502f, 0.998834014f},
-std::array<float,2>{0.195188999f, 0.498407155f},
-std::array<float,2>{0.868061662f, 0.589726746f},
-std::array<float,2>{0.64098984f, 0.162617162f},
-std::array<float,2>{0.416080832f, 0.812789559f},
-std::array<float,2>{0.26029554f, 0.0583339408f},
-std::array<float,2>{0.537437439f, 0.974433124f},
-std::array<float,2>{0.876479328f, 0.268343121f},
-std::array<float,2>{0.109865665f, 0.744959593f},
-std::array<float,2>{0.0323435739f, 0.247209653f},
-std::array<float,2>{0.957467258f, 0.751243532f},
-std::array<float,2>{0.589332044f, 0.398426801f},
-std::array<float,2>{0.329991788f, 0.533878148f},
-std::array<float,2>{0.474801004f, 0.3560628f},
-std::array<float,2>{0.732791483f, 0.673405707f},
-std::array<float,2>{0.788612485f, 0.100066476f},
-std::array<float,2>{0.147536218f, 0.89852196f},
-std::array<float,2>{0.0754529312f, 0.295878857f},
-std::array<float,2>{0.910378635f, 0.705862164f},
-std::array<float,2>{0.526776373f, 0.0241739172f},
-std::array<float,2>{0.286279917f, 0.946303248f},
-std::array<float,2>{0.400817364f, 0.155018613f},
-std::array<float,2>{0.675352037f, 0.869722009f},
-std::array<float,2>{0.820101917f, 0.452298462f},
-std::array<float,2>{0.243830964f, 0.598541141f},
-std::array<float,2>{0.163959578f, 0.0894201174f},
-std::array<float,2>{0.75714761f, 0.92789495f},
-std::array<float,2>{0.699693739f, 0.329728991f},
-std::array<float,2>{0.442658722f, 0.653711319f},
-std::array<float,2>{0.368262887f, 0.417559952f},
-std::array<float,2>{0.61165452f, 0.518333793f},
-std::array<float,2>{0.973772287f, 0.213295504f},
-std::array<float,2>{0.0132017126f, 0.805032372f},
-std::array<float,2>{0.170708477f, 0.308301955f},
-std::array<float,2>{0.75930351f, 0.689014733f},
-std::array<float,2>{0.6909253f, 0.00627801614f},
-std::array<float,2>{0.44688198f, 0.957766354f},
-std::array<float,2>{0.361570656f, 0.125580758f},
-std::array<float,2>{0.620551586f, 0.859076142f},
-std::array<float,2>{0.978279233f, 0.462739348f},
-std::array<float,2>{0.00729838898f, 0.610574841f},
-std::array<float,2>{0.0648031607f, 0.0684288219f},
-std::array<float,2>{0.919609368f, 0.917197704f},
-std::array<float,2>{0.520025849f, 0.322130501f},
-std::array<float,2>{0.293120146f, 0.634895325f},
-std::array<float,2>{0.39536196f, 0.434226185f},
-std::array<float,2>{0.684113264f, 0.501130342f},
-std::array<float,2>{0.823158741f, 0.188501403f},
-std::array<float,2>{0.238279283f, 0.796658218f},
-std::array<float,2>{0.0440465324f, 0.478495896f},
-std::array<float,2>{0.964724123f, 0.57221359f},
-std::array<float,2>{0.579840243f, 0.17483604f},
-std::array<float,2>{0.337726146f, 0.834533274f},
-std::array<float,2>{0.481900454f, 0.0399008617f},
-std::array<float,2>{0.722232401f, 0.994081318f},
-std::array<float,2>{0.78932941f, 0.260951966f},
-std::array<float,2>{0.155762181f, 0.728536963f},
-std::array<float,2>{0.202515647f, 0.224686086f},
-std::array<float,2>{0.865655541f, 0.768023193f},
-std::array<float,2>{0.650993407f, 0.377742916f},
-std::array<float,2>{0.41038689f, 0.56007427f},
-std::array<float,2>{0.25630635f, 0.359929711f},
-std::array<float,2>{0.539534688f, 0.668869317f},
-std::array<float,2>{0.889542818f, 0.121222794f},
-std::array<float,2>{0.119049549f, 0.879143655f},
-std::array<float,2>{0.220545962f, 0.39410904f},
-std::array<float,2>{0.837785363f, 0.538352787f},
-std::array<float,2>{0.65676111f, 0.245203078f},
-std::array<float,2>{0.387852192f, 0.755775988f},
-std::array<float,2>{0.299899906f, 0.0948963985f},
-std::array<float,2>{0.515291154f, 0.903759003f},
-std::array<float,2>{0.935770512f, 0.351950377f},
-std::array<float,2>{0.0848292261f, 0.679088235f},
-std::array<float,2>{0.0240688808f, 0.156335905f},
-std::array<float,2>{0.999797106f, 0.820126593f},
-std::array<float,2>{0.596123695f, 0.495435745f},
-std::array<float,2>{0.345694155f, 0.59054172f},
-std::array<float,2>{0.457420319f, 0.270150304f},
-std::array<float,2>{0.70725143f, 0.746521354f},
-std::array<float,2>{0.775547385f, 0.0607075021f},
-std::array<float,2>{0.184382349f, 0.969064951f},
-std::array<float,2>{0.0964224041f, 0.333910823f},
-std::array<float,2>{0.905338049f, 0.651308954f},
-std::array<float,2>{0.554802895f, 0.0903211907f},
-std::array<float,2>{0.268525988f, 0.925058305f},
-std::array<float,2>{0.428790092f, 0.216858596f},
-std::array<float,2>{0.640112758f, 0.80984956f},
-std::array<float,2>{0.845259488f, 0.419896901f},
-std::array<float,2>{0.214790404f, 0.520291746f},
-std::array<float,2>{0.131651267f, 0.0274431799f},
-std::array<float,2>{0.804086804f, 0.952125549f},
-std::array<float,2>{0.738517344f, 0.290981948f},
-std::array<float,2>{0.495634884f, 0.708085775f},
-std::array<float,2>{0.321057945f, 0.446250618f},
-std::array<float,2>{0.568160415f, 0.597592294f},
-std::array<float,2>{0.940779448f, 0.149253771f},
-std::array<float,2>{0.0552452914f, 0.871475399f},
-std::array<float,2>{0.210513249f, 0.350452781f},
-std::array<float,2>{0.855655253f, 0.682401299f},
-std::array<float,2>{0.632466137f, 0.102762483f},
-std::array<float,2>{0.432972729f, 0.892730594f},
-std::array<float,2>{0.275970131f, 0.235581398f},
-std::array<float,2>{0.5470258f, 0.765224516f},
-std::array<float,2>{0.892881155f, 0.404133141f},
-std::array<float,2>{0.10612835f, 0.539103031f},
-std::array<float,2>{0.0530951135f, 0.0533169582f},
-std::array<float,2>{0.951392412f, 0.980124235f},
-std::array<float,2>{0.571259677f, 0.276195645f},
-std::array<float,2>{0.31877318f, 0.736463189f},
-std::array<float,2>{0.491499841f, 0.48540175f},
-std::array<float,2>{0.743679762f, 0.584424615f},
-std::array<float,2>{0.811612248f, 0.167902753f},
-std::array<float,2>{0.136455104f, 0.82520014f},
-std::array<float,2>{0.0925022811f, 0.408083975f},
-std::array<float,2>{0.927286267f, 0.530333281f},
-std::array<float,2>{0.503511369f, 0.205247149f},
-std::array<float,2>{0.305046707f, 0.799147308f},
-std::array<float,2>{0.381496757f, 0.0809488595f},
-std::array<float,2>{0.666397512f, 0.931517184f},
-std::array<float,2>{0.82919395f, 0.337802917f},
-std::array<float,2>{0.228984803f, 0.643249512f},
-std::array<float,2>{0.173004553f, 0.146140009f},
-std::array<float,2>{0.765830994f, 0.864856839f},
-std::array<float,2>{0.711687148f, 0.442602515f},
-std::array<float,2>{0.466185719f, 0.604460239f},
-std::array<float,2>{0.355611891f, 0.281927198f},
-std::array<float,2>{0.602612257f, 0.713371277f},
-std::array<float,2>{0.991655827f, 0.0205312129f},
-std::array<float,2>{0.0211889222f, 0.944790304f},
-std::array<float,2>{0.140875548f, 0.455010831f},
-std::array<float,2>{0.78506887f, 0.619277477f},
-std::array<float,2>{0.728183508f, 0.138873413f},
-std::array<float,2>{0.4690108f, 0.84487927f},
-std::array<float,2>{0.33340925f, 0.0128712934f},
-std::array<float,2>{0.592980802f, 0.963879764f},
-std::array<float,2>{0.956009209f, 0.301775753f},
-std::array<float,2>{0.0372254923f, 0.702233613f},
-std::array<float,2>{0.114957757f, 0.199445769f},
-std::array<float,2>{0.880226135f, 0.786804199f},
-std::array<float,2>{0.534352064f, 0.426731199f},
-std::array<float,2>{0.262842059f, 0.508904517f},
-std::array<float,2>{0.418713421f, 0.315923423f},
-std::array<float,2>{0.645834684f, 0.626486123f},
-std::array<float,2>{0.873385012f, 0.0762454942f},
-std::array<float,2>{0.188939869f, 0.912441373f},
-std::array<float,2>{0.00877060741f, 0.252388209f},
-std::array<float,2>{0.971264541f, 0.720081747f},
-std::array<float,2>{0.614941537f, 0.0328531265f},
-std::array<float,2>{0.372626454f, 0.989847898f},
-std::array<float,2>{0.438247144f, 0.180930838f},
-std::array<float,2>{0.697849691f, 0.840432584f},
-std::array<float,2>{0.751454055f, 0.474479437f},
-std::array<float,2>{0.158689499f, 0.564760149f},
-std::array<float,2>{0.249741092f, 0.109757535f},
-std::array<float,2>{0.814662516f, 0.890311599f},
-std::array<float,2>{0.678041816f, 0.369614631f},
-std::array<float,2>{0.404114187f, 0.658753395f},
-std::array<float,2>{0.283566177f, 0.388019085f},
-std::array<float,2>{0.529569268f, 0.550028384f},
-std::array<float,2>{0.907756865f, 0.233070686f},
-std::array<float,2>{0.0705554783f, 0.779211283f},
-std::array<float,2>{0.224316373f, 0.299086809f},
-std::array<float,2>{0.842348754f, 0.697469056f},
-std::array<float,2>{0.662941754f, 0.00924690347f},
-std::array<float,2>{0.385668844f, 0.964928567f},
-std::array<float,2>{0.302707672f, 0.133870602f},
-std::array<float,2>{0.510190129f, 0.850061774f},
-std::array<float,2>{0.930560768f, 0.457903892f},
-std::array<float,2>{0.0796425715f, 0.622643769f},
-std::array<float,2>{0.0308712535f, 0.0721115768f},
-std::array<float,2>{0.994880021f, 0.909258485f},
-std::array<float,2>{0.600669622f, 0.318006605f},
-std::array<float,2>{0.349247694f, 0.631487012f},
-std::array<float,2>{0.456573933f, 0.425636888f},
-std::array<float,2>{0.705137551f, 0.514837384f},
-std::array<float,2>{0.777356565f, 0.197263435f},
-std::array<float,2>{0.182733357f, 0.782368064f},
-std::array<float,2>{0.0985618234f, 0.469428867f},
-std::array<float,2>{0.899972141f, 0.569598973f},
-std::array<float,2>{0.559267044f, 0.183652908f},
-std::array<float,2>{0.27126655f, 0.836684823f},
-std::array<float,2>{0.423182368f, 0.0382165648f},
-std::array<float,2>{0.633774042f, 0.986668468f},
-std::array<float,2>{0.848433375f, 0.25651893f},
-std::array<float,2>{0.215055883f, 0.726346314f},
-std::array<float,2>{0.126302108f, 0.226912975f},
-std::array<float,2>{0.798853815f, 0.773468852f},
-std::array<float,2>{0.737572908f, 0.385724097f},
-std::array<float,2>{0.499959439f, 0.551731944f},
-std::array<float,2>{0.325606495f, 0.374832422f},
-std::array<float,2>{0.564955711f, 0.660811007f},
-std::array<float,2>{0.942881107f, 0.117158294f},
-std::array<float,2>{0.061451938f, 0.884847462f},
-std::array<float,2>{0.165531963f, 0.398778915f},
-std::array<float,2>{0.762501717f, 0.543228149f},
-std::array<float,2>{0.693860233f, 0.239373758f},
-std::array<float,2>{0.449772f, 0.75913322f},
-std::array<float,2>{0.3660658f, 0.108035237f},
-std::array<float,2>{0.623238087f, 0.897127867f},
-std::array<float,2>{0.98313719f, 0.347525865f},
-std::array<float,2>{0.000467729027f, 0.686155677f},
-std::array<float,2>{0.0674137026f, 0.168539211f},
-std::array<float,2>{0.917229056f, 0.823419571f},
-std::array<float,2>{0.516924977f, 0.491727203f},
-std::array<float,2>{0.290868551f, 0.578753293f},
-std::array<float,2>{0.391804308f, 0.279741466f},
-std::array<float,2>{0.68156147f, 0.739978611f},
-std::array<float,2>{0.827072203f, 0.0469247401f},
-std::array<float,2>{0.238776028f, 0.984006345f},
-std::array<float,2>{0.0414934494f, 0.342857033f},
-std::array<float,2>{0.966171205f, 0.647061706f},
-std::array<float,2>{0.584072113f, 0.0854554549f},
-std::array<float,2>{0.343320161f, 0.934051752f},
-std::array<float,2>{0.478575319f, 0.207069963f},
-std::array<float,2>{0.723025084f, 0.804341376f},
-std::array<float,2>{0.795696676f, 0.412146717f},
-std::array<float,2>{0.150380343f, 0.524233699f},
-std::array<float,2>{0.198934004f, 0.0172331277f},
-std::array<float,2>{0.863252759f, 0.940505445f},
-std::array<float,2>{0.655245304f, 0.288074404f},
-std::array<float,2>{0.407105714f, 0.717511475f},
-std::array<float,2>{0.25236842f, 0.438241631f},
-std::array<float,2>{0.5454638f, 0.606054723f},
-std::array<float,2>{0.884241164f, 0.143148869f},
-std::array<float,2>{0.121899568f, 0.862413704f},
-std::array<float,2>{0.147383407f, 0.359122872f},
-std::array<float,2>{0.787436485f, 0.674170315f},
-std::array<float,2>{0.733999491f, 0.0977071002f},
-std::array<float,2>{0.475683987f, 0.901377976f},
-std::array<float,2>{0.328663111f, 0.24961625f},
-std::array<float,2>{0.587978303f, 0.75343591f},
-std::array<float,2>{0.958946824f, 0.39514944f},
-std::array<float,2>{0.0313385129f, 0.5329054f},
-std::array<float,2>{0.110634044f, 0.0556704663f},
-std::array<float,2>{0.875445902f, 0.975678742f},
-std::array<float,2>{0.538702726f, 0.267152756f},
-std::array<float,2>{0.261055499f, 0.744121194f},
-std::array<float,2>{0.41704452f, 0.496603698f},
-std::array<float,2>{0.642004907f, 0.586853027f},
-std::array<float,2>{0.86848551f, 0.161237076f},
-std::array<float,2>{0.193601847f, 0.814929545f},
-std::array<float,2>{0.0123299593f, 0.415879309f},
-std::array<float,2>{0.972930789f, 0.516070664f},
-std::array<float,2>{0.612508833f, 0.211067289f},
-std::array<float,2>{0.367720723f, 0.806916952f},
-std::array<float,2>{0.44182539f, 0.0876291171f},
-std::array<float,2>{0.700242102f, 0.92631942f},
-std::array<float,2>{0.756095707f, 0.331413299f},
-std::array<float,2>{0.162119076f, 0.654947102f},
-std::array<float,2>{0.242951125f, 0.153732285f},
-std::array<float,2>{0.818575382f, 0.869104028f},
-std::array<float,2>{0.674801052f, 0.451166093f},
-std::array<float,2>{0.401453316f, 0.600639284f},
-std::array<float,2>{0.285882831f, 0.294443458f},
-std::array<float,2>{0.525946319f, 0.704458952f},
-std::array<float,2>{0.91208303f, 0.0266106706f},
-std::array<float,2>{0.0742477104f, 0.947888732f},
-std::array<float,2>{0.206548899f, 0.466164023f},
-std::array<float,2>{0.85526818f, 0.613933265f},
-std::array<float,2>{0.627452731f, 0.130923137f},
-std::array<float,2>{0.435820401f, 0.853676021f},
-std::array<float,2>{0.277773708f, 0.000503402785f},
-std::array<float,2>{0.552669287f, 0.956328511f},
-std::array<float,2>{0.895431757f, 0.309342176f},
-std::array<float,2>{0.101850398f, 0.694891214f},
-std::array<float,2>{0.0501204655f, 0.191713974f},
-std::array<float,2>{0.946210861f, 0.791080832f},
-std::array<float,2>{0.577850938f, 0.432231277f},
-std::array<float,2>{0.3157745f, 0.507155478f},
-std::array<float,2>{0.487556219f, 0.325043857f},
-std::array<float,2>{0.748771846f, 0.638543427f},
-std::array<float,2>{0.807738364f, 0.0644089207f},
-std::array<float,2>{0.138939291f, 0.920490205f},
-std::array<float,2>{0.0890767723f, 0.265376925f},
-std::array<float,2>{0.923894286f, 0.730987072f},
-std::array<float,2>{0.50520587f, 0.0464900509f},
-std::array<float,2>{0.311390519f, 0.99697721f},
-std::array<float,2>{0.378647506f, 0.178893402f},
-std::array<float,2>{0.671647906f, 0.831620991f},
-std::array<float,2>{0.833135366f, 0.483228892f},
-std::array<float,2>{0.231809974f, 0.577917457f},
-std::array<float,2>{0.176046669f, 0.118357725f},
-std::array<float,2>{0.770887733f, 0.875102818f},
-std::array<float,2>{0.718132019f, 0.365534931f},
-std::array<float,2>{0.46412921f, 0.666874886f},
-std::array<float,2>{0.352731079f, 0.382176518f},
-std::array<float,2>{0.607831895f, 0.557483494f},
-std::array<float,2>{0.985484481f, 0.222535968f},
-std::array<float,2>{0.0169406608f, 0.771793962f},
-std::array<float,2>{0.184883744f, 0.271726102f},
-std::array<float,2>{0.776759207f, 0.749700963f},
-std::array<float,2>{0.708867967f, 0.0589797385f},
-std::array<float,2>{0.458205611f, 0.970981836f},
-std::array<float,2>{0.344717145f, 0.159779415f},
-std::array<float,2>{0.59753406f, 0.816780448f},
-std::array<float,2>{0.998351395f, 0.49399513f},
-std::array<float,2>{0.0247636139f, 0.593260527f},
-std::array<float,2>{0.085462831f, 0.0973496661f},
-std::array<float,2>{0.936977386f, 0.904903889f},
-std::array<float,2>{0.514434278f, 0.355091751f},
-std::array<float,2>{0.299293637f, 0.676430106f},
-std::array<float,2>{0.387022972f, 0.392108649f},
-std::array<float,2>{0.657908797f, 0.535374522f},
-std::array<float,2>{0.836070716f, 0.242260516f},
-std::array<float,2>{0.219502464f, 0.756503165f},
-std::array<float,2>{0.0561455451f, 0.44812429f},
-std::array<float,2>{0.940034091f, 0.594117045f},
-std::array<float,2>{0.567171156f, 0.152166933f},
-std::array<float,2>{0.32207936f, 0.873530447f},
-std::array<float,2>{0.495045692f, 0.0298858769f},
-std::array<float,2>{0.739735365f, 0.949739337f},
-std::array<float,2>{0.803187191f, 0.291532695f},
-std::array<float,2>{0.131918237f, 0.710096896f},
-std::array<float,2>{0.213332593f, 0.214939728f},
-std::array<float,2>{0.843757391f, 0.811339498f},
-std::array<float,2>{0.639123738f, 0.420619905f},
-std::array<float,2>{0.42827937f, 0.523235619f},
-std::array<float,2>{0.268987805f, 0.335070044f},
-std::array<float,2>{0.556142688f, 0.649055183f},
-std::array<float,2>{0.904421687f, 0.09312132f},
-std::array<float,2>{0.0970439613f, 0.922638118f},
-std::array<float,2>{0.236732453f, 0.436124772f},
-std::array<float,2>{0.823656082f, 0.503857255f},
-std::array<float,2>{0.68458581f, 0.190181255f},
-std::array<float,2>{0.395670861f, 0.793680251f},
-std::array<float,2>{0.294701934f, 0.0664480999f},
-std::array<float,2>{0.520953178f, 0.914200604f},
-std::array<float,2>{0.918198824f, 0.322964907f},
-std::array<float,2>{0.0663625598f, 0.633906126f},
-std::array<float,2>{0.00646588625f, 0.128195614f},
-std::array<float,2>{0.97701174f, 0.857359231f},
-std::array<float,2>{0.619449079f, 0.463012367f},
-std::array<float,2>{0.362870753f, 0.612169147f},
-std::array<float,2>{0.445546329f, 0.304821193f},
-std::array<float,2>{0.689670861f, 0.689853609f},
-std::array<float,2>{0.758507192f, 0.00568320462f},
-std::array<float,2>{0.17174165f, 0.960081995f},
-std::array<float,2>{0.117227539f, 0.362512678f},
-std::array<float,2>{0.890434206f, 0.670819402f},
-std::array<float,2>{0.540960014f, 0.124240287f},
-std::array<float,2>{0.256992757f, 0.882219195f},
-std::array<float,2>{0.41170159f, 0.223658234f},
-std::array<float,2>{0.652013779f, 0.766900122f},
-std::array<float,2>{0.86644417f, 0.376697153f},
-std::array<float,2>{0.201997608f, 0.561576128f},
-std::array<float,2>{0.155117676f, 0.0416496284f},
-std::array<float,2>{0.790384352f, 0.995896995f},
-std::array<float,2>{0.720796704f, 0.259311736f},
-std::array<float,2>{0.480845571f, 0.727532804f},
-std::array<float,2>{0.336409509f, 0.479442984f},
-std::array<float,2>{0.578712821f, 0.57237196f},
-std::array<float,2>{0.963183403f, 0.17371437f},
-std::array<float,2>{0.0432088897f, 0.833187282f},
-std::array<float,2>{0.188050002f, 0.313482612f},
-std::array<float,2>{0.874272227f, 0.628525674f},
-std::array<float,2>{0.644579887f, 0.0751533508f},
-std::array<float,2>{0.419133276f, 0.910254776f},
-std::array<float,2>{0.262512088f, 0.201492101f},
-std::array<float,2>{0.533944011f, 0.787430525f},
-std::array<float,2>{0.879653633f, 0.427993655f},
-std::array<float,2>{0.113798052f, 0.510882258f},
-std::array<float,2>{0.038672179f, 0.0137960929f},
-std::array<float,2>{0.956267476f, 0.961693943f},
-std::array<float,2>{0.592398584f, 0.302842885f},
-std::array<float,2>{0.332548141f, 0.700912952f},
-std::array<float,2>{0.470496237f, 0.455514431f},
-std::array<float,2>{0.726670861f, 0.618254483f},
-std::array<float,2>{0.78385061f, 0.138288558f},
-std::array<float,2>{0.141970545f, 0.84617877f},
-std::array<float,2>{0.0716677532f, 0.388991266f},
-std::array<float,2>{0.907107294f, 0.548402727f},
-std::array<float,2>{0.531093299f, 0.230771974f},
-std::array<float,2>{0.284289807f, 0.780591547f},
-std::array<float,2>{0.402909368f, 0.112795494f},
-std::array<float,2>{0.679275215f, 0.888076484f},
-std::array<float,2>{0.816009045f, 0.367416769f},
-std::array<float,2>{0.248394862f, 0.656770587f},
-std::array<float,2>{0.159610763f, 0.182879642f},
-std::array<float,2>{0.750461578f, 0.842222214f},
-std::array<float,2>{0.699052095f, 0.475339472f},
-std::array<float,2>{0.438560188f, 0.562672317f},
-std::array<float,2>{0.371941715f, 0.251579404f},
-std::array<float,2>{0.613829136f, 0.721748948f},
-std::array<float,2>{0.972300708f, 0.0345367789f},
-std::array<float,2>{0.00953062996f, 0.991464674f},
-std::array<float,2>{0.134794474f, 0.486507505f},
-std::array<float,2>{0.811464727f, 0.583397388f},
-std::array<float,2>{0.743128181f, 0.165148631f},
-std::array<float,2>{0.491056323f, 0.827985823f},
-std::array<float,2>{0.319951206f, 0.0520968549f},
-std::array<float,2>{0.572222114f, 0.9772771f},
-std::array<float,2>{0.952549875f, 0.274080068f},
-std::array<float,2>{0.0539702512f, 0.735554814f},
-std::array<float,2>{0.107077837f, 0.236740857f},
-std::array<float,2>{0.89432019f, 0.762597024f},
-std::array<float,2>{0.548255026f, 0.404639661f},
-std::array<float,2>{0.276619971f, 0.54193908f},
-std::array<float,2>{0.432567f, 0.349414974f},
-std::array<float,2>{0.631618738f, 0.680502474f},
-std::array<float,2>{0.857169807f, 0.104433894f},
-std::array<float,2>{0.209307045f, 0.891307354f},
-std::array<float,2>{0.0203312133f, 0.285051554f},
-std::array<float,2>{0.991208196f, 0.712092161f},
-std::array<float,2>{0.601700485f, 0.021774495f},
-std::array<float,2>{0.356793731f, 0.943182707f},
-std::array<float,2>{0.465535909f, 0.148003951f},
-std::array<float,2>{0.712572753f, 0.866328597f},
-std::array<float,2>{0.767047346f, 0.444464058f},
-std::array<float,2>{0.172356918f, 0.60201323f},
-std::array<float,2>{0.230113238f, 0.0793849304f},
-std::array<float,2>{0.828196883f, 0.932545543f},
-std::array<float,2>{0.66783905f, 0.339094222f},
-std::array<float,2>{0.382002622f, 0.642035425f},
-std::array<float,2>{0.306445926f, 0.408833742f},
-std::array<float,2>{0.50227809f, 0.528586805f},
-std::array<float,2>{0.926646888f, 0.203438208f},
-std::array<float,2>{0.0928046629f, 0.797816634f},
-std::array<float,2>{0.218687475f, 0.255797565f},
-std::array<float,2>{0.850450575f, 0.723881483f},
-std::array<float,2>{0.635755122f, 0.036126107f},
-std::array<float,2>{0.424320966f, 0.985338926f},
-std::array<float,2>{0.272747695f, 0.187078804f},
-std::array<float,2>{0.561512828f, 0.839408875f},
-std::array<float,2>{0.90054059f, 0.472450852f},
-std::array<float,2>{0.10141056f, 0.566691458f},
-std::array<float,2>{0.05950021f, 0.115117036f},
-std::array<float,2>{0.944435716f, 0.884304225f},
-std::array<float,2>{0.563201368f, 0.37112838f},
-std::array<float,2>{0.326669097f, 0.662710667f},
-std::array<float,2>{0.496750057f, 0.383563071f},
-std::array<float,2>{0.735608578f, 0.554608941f},
-std::array<float,2>{0.79716599f, 0.230182692f},
-std::array<float,2>{0.127747819f, 0.776184857f},
-std::array<float,2>{0.0818185955f, 0.460631818f},
-std::array<float,2>{0.932189584f, 0.623751283f},
-std::array<float,2>{0.508347094f, 0.136304334f},
-std::array<float,2>{0.304119557f, 0.847900808f},
-std::array<float,2>{0.383370787f, 0.0109833414f},
-std::array<float,2>{0.661187351f, 0.968458414f},
-std::array<float,2>{0.840407491f, 0.298243254f},
-std::array<float,2>{0.224954203f, 0.696728885f},
-std::array<float,2>{0.181383803f, 0.198492303f},
-std::array<float,2>{0.779933393f, 0.783792317f},
-std::array<float,2>{0.704842448f, 0.422032475f},
-std::array<float,2>{0.454152346f, 0.511938989f},
-std::array<float,2>{0.351221353f, 0.319509476f},
-std::array<float,2>{0.598940969f, 0.629578471f},
-std::array<float,2>{0.993516505f, 0.074080579f},
-std::array<float,2>{0.0283863954f, 0.906279504f},
-std::array<float,2>{0.151680082f, 0.411746562f},
-std::array<float,2>{0.793248057f, 0.526626289f},
-std::array<float,2>{0.72466892f, 0.209130198f},
-std::array<float,2>{0.477313221f, 0.801864862f},
-std::array<float,2>{0.340613872f, 0.0836347193f},
-std::array<float,2>{0.582998693f, 0.936959147f},
-std::array<float,2>{0.968383431f, 0.340436041f},
-std::array<float,2>{0.0394658037f, 0.646284044f},
-std::array<float,2>{0.124318786f, 0.140920043f},
-std::array<float,2>{0.885473609f, 0.860119224f},
-std::array<float,2>{0.54321146f, 0.441289186f},
-std::array<float,2>{0.25043416f, 0.607870698f},
-std::array<float,2>{0.409376472f, 0.286088616f},
-std::array<float,2>{0.652370393f, 0.715163887f},
-std::array<float,2>{0.860338271f, 0.0180124547f},
-std::array<float,2>{0.195430845f, 0.938103318f},
-std::array<float,2>{0.00297265546f, 0.345558614f},
-std::array<float,2>{0.980834305f, 0.685085237f},
-std::array<float,2>{0.622439265f, 0.105769038f},
-std::array<float,2>{0.364327252f, 0.895861387f},
-std::array<float,2>{0.451817632f, 0.240428343f},
-std::array<float,2>{0.691693723f, 0.761466801f},
-std::array<float,2>{0.764061391f, 0.401895881f},
-std::array<float,2>{0.166499168f, 0.545101345f},
-std::array<float,2>{0.241049334f, 0.0501188971f},
-std::array<float,2>{0.825451195f, 0.98077035f},
-std::array<float,2>{0.682375193f, 0.278968453f},
-std::array<float,2>{0.392817795f, 0.741607189f},
-std::array<float,2>{0.292813718f, 0.489210933f},
-std::array<float,2>{0.519147813f, 0.580183864f},
-std::array<float,2>{0.91435039f, 0.170202494f},
-std::array<float,2>{0.0693756491f, 0.820476949f},
-std::array<float,2>{0.160759017f, 0.328240424f},
-std::array<float,2>{0.754612446f, 0.652960241f},
-std::array<float,2>{0.703121066f, 0.0884890705f},
-std::array<float,2>{0.443674177f, 0.929291487f},
-std::array<float,2>{0.369599372f, 0.214326844f},
-std::array<float,2>{0.611299038f, 0.806624889f},
-std::array<float,2>{0.975964129f, 0.416595846f},
-std::array<float,2>{0.0142088132f, 0.518776417f},
-std::array<float,2>{0.0774270594f, 0.0247425195f},
-std::array<float,2>{0.912663996f, 0.946045399f},
-std::array<float,2>{0.523865342f, 0.296871454f},
-std::array<float,2>{0.28761512f, 0.706565678f},
-std::array<float,2>{0.399926186f, 0.451866329f},
-std::array<float,2>{0.672900379f, 0.599461913f},
-std::array<float,2>{0.818289399f, 0.155664176f},
-std::array<float,2>{0.244397074f, 0.870161474f},
-std::array<float,2>{0.0332163759f, 0.397333771f},
-std::array<float,2>{0.960265875f, 0.534571767f},
-std::array<float,2>{0.586975574f, 0.246419355f},
-std::array<float,2>{0.331796646f, 0.750566602f},
-std::array<float,2>{0.473409235f, 0.101299748f},
-std::array<float,2>{0.730764687f, 0.900239289f},
-std::array<float,2>{0.786715627f, 0.356761098f},
-std::array<float,2>{0.145507514f, 0.67284292f},
-std::array<float,2>{0.191618636f, 0.163401499f},
-std::array<float,2>{0.870952487f, 0.813918829f},
-std::array<float,2>{0.644511521f, 0.499268293f},
-std::array<float,2>{0.414763302f, 0.588066041f},
-std::array<float,2>{0.259628206f, 0.269019485f},
-std::array<float,2>{0.535897791f, 0.746073246f},
-std::array<float,2>{0.877251565f, 0.0574110523f},
-std::array<float,2>{0.113133281f, 0.973094165f},
-std::array<float,2>{0.23428449f, 0.4811185f},
-std::array<float,2>{0.835023165f, 0.574961901f},
-std::array<float,2>{0.669341743f, 0.176650479f},
-std::array<float,2>{0.375320643f, 0.829859734f},
-std::array<float,2>{0.308816999f, 0.0439489707f},
-std::array<float,2>{0.507707059f, 0.999735236f},
-std::array<float,2>{0.922090709f, 0.263136446f},
-std::array<float,2>{0.0871398523f, 0.733240545f},
-std::array<float,2>{0.0188907608f, 0.220199794f},
-std::array<float,2>{0.986843586f, 0.769982755f},
-std::array<float,2>{0.606831074f, 0.380751699f},
-std::array<float,2>{0.354050338f, 0.555171251f},
-std::array<float,2>{0.461278677f, 0.365145475f},
-std::array<float,2>{0.715355396f, 0.665082693f},
-std::array<float,2>{0.772328019f, 0.120330952f},
-std::array<float,2>{0.17864947f, 0.877901137f},
-std::array<float,2>{0.105327845f, 0.311687887f},
-std::array<float,2>{0.897527337f, 0.691842616f},
-std::array<float,2>{0.55336529f, 0.00241281884f},
-std::array<float,2>{0.27993238f, 0.953188777f},
-std::array<float,2>{0.435093552f, 0.130316362f},
-std::array<float,2>{0.625730038f, 0.853512764f},
-std::array<float,2>{0.85343039f, 0.466855556f},
-std::array<float,2>{0.204217866f, 0.616980553f},
-std::array<float,2>{0.137256294f, 0.0652648956f},
-std::array<float,2>{0.806491315f, 0.919841349f},
-std::array<float,2>{0.7471053f, 0.327525288f},
-std::array<float,2>{0.484847635f, 0.639656842f},
-std::array<float,2>{0.313579708f, 0.430558234f},
-std::array<float,2>{0.57531023f, 0.50572437f},
-std::array<float,2>{0.949146032f, 0.193608463f},
-std::array<float,2>{0.0486727916f, 0.789156139f},
-std::array<float,2>{0.129368499f, 0.289167464f},
-std::array<float,2>{0.802157938f, 0.707211792f},
-std::array<float,2>{0.740688264f, 0.0292696934f},
-std::array<float,2>{0.49398154f, 0.952989459f},
-std::array<float,2>{0.323422432f, 0.150056601f},
-std::array<float,2>{0.570280373f, 0.87265569f},
-std::array<float,2>{0.939327419f, 0.446706176f},
-std::array<float,2>{0.0579595678f, 0.596100628f},
-std::array<float,2>{0.0947127566f, 0.0914340392f},
-std::array<float,2>{0.90307945f, 0.92392391f},
-std::array<float,2>{0.557734489f, 0.332584113f},
-std::array<float,2>{0.267062485f, 0.651429415f},
-std::array<float,2>{0.427438855f, 0.418642581f},
-std::array<float,2>{0.638426781f, 0.520712018f},
-std::array<float,2>{0.846212804f, 0.2181907f},
-std::array<float,2>{0.212217927f, 0.809404135f},
-std::array<float,2>{0.0270829722f, 0.494638681f},
-std::array<float,2>{0.997524858f, 0.591188073f},
-std::array<float,2>{0.594002128f, 0.157665446f},
-std::array<float,2>{0.345955282f, 0.818788946f},
-std::array<float,2>{0.459202826f, 0.0624631979f},
-std::array<float,2>{0.710699797f, 0.970531106f},
-std::array<float,2>{0.774861574f, 0.271424383f},
-std::array<float,2>{0.186755493f, 0.747766435f},
-std::array<float,2>{0.222203016f, 0.244981036f},
-std::array<float,2>{0.838216424f, 0.754232883f},
-std::array<float,2>{0.660066307f, 0.392718285f},
-std::array<float,2>{0.389422268f, 0.537607431f},
-std::array<float,2>{0.298543721f, 0.353042066f},
-std::array<float,2>{0.513448596f, 0.677880049f},
-std::array<float,2>{0.933718324f, 0.094121404f},
-std::array<float,2>{0.0835790485f, 0.90328604f},
-std::array<float,2>{0.199614927f, 0.378779918f},
-std::array<float,2>{0.864210248f, 0.559160411f},
-std::array<float,2>{0.648740947f, 0.225608125f},
-std::array<float,2>{0.412265211f, 0.768982172f},
-std::array<float,2>{0.254946798f, 0.12228816f},
-std::array<float,2>{0.541457176f, 0.87992543f},
-std::array<float,2>{0.887203693f, 0.360532671f},
-std::array<float,2>{0.120216072f, 0.669071078f},
-std::array<float,2>{0.0462360568f, 0.174412549f},
-std::array<float,2>{0.96136111f, 0.835084319f},
-std::array<float,2>{0.580782175f, 0.477371663f},
-std::array<float,2>{0.339661688f, 0.570575118f},
-std::array<float,2>{0.483684063f, 0.259866655f},
-std::array<float,2>{0.720390797f, 0.729925573f},
-std::array<float,2>{0.792430103f, 0.0403551385f},
-std::array<float,2>{0.152924106f, 0.993070722f},
-std::array<float,2>{0.064039804f, 0.321086496f},
-std::array<float,2>{0.921139181f, 0.636601567f},
-std::array<float,2>{0.521594286f, 0.0700124502f},
-std::array<float,2>{0.296647757f, 0.916489899f},
-std::array<float,2>{0.398387104f, 0.188229144f},
-std::array<float,2>{0.686501563f, 0.794942796f},
-std::array<float,2>{0.821796179f, 0.434957564f},
-std::array<float,2>{0.23475422f, 0.500555158f},
-std::array<float,2>{0.168995485f, 0.00716309436f},
-std::array<float,2>{0.76012665f, 0.958678901f},
-std::array<float,2>{0.688753545f, 0.307257324f},
-std::array<float,2>{0.447422445f, 0.687914848f},
-std::array<float,2>{0.359602094f, 0.461835593f},
-std::array<float,2>{0.61842978f, 0.609747291f},
-std::array<float,2>{0.979916573f, 0.126069382f},
-std::array<float,2>{0.00550943846f, 0.858356714f},
-std::array<float,2>{0.246109322f, 0.37093243f},
-std::array<float,2>{0.81324923f, 0.659814715f},
-std::array<float,2>{0.676107705f, 0.110384412f},
-std::array<float,2>{0.40530923f, 0.88938123f},
-std::array<float,2>{0.28188777f, 0.233449429f},
-std::array<float,2>{0.528866649f, 0.777830601f},
-std::array<float,2>{0.909069002f, 0.386982709f},
-std::array<float,2>{0.073661834f, 0.548899293f},
-std::array<float,2>{0.00990700256f, 0.0314286835f},
-std::array<float,2>{0.97024411f, 0.988932073f},
-std::array<float,2>{0.616010785f, 0.253734618f},
-std::array<float,2>{0.37475574f, 0.719367921f},
-std::array<float,2>{0.441044182f, 0.473021746f},
-std::array<float,2>{0.696655512f, 0.565837801f},
-std::array<float,2>{0.752058327f, 0.179831728f},
-std::array<float,2>{0.156753838f, 0.840912282f},
-std::array<float,2>{0.117113002f, 0.426820964f},
-std::array<float,2>{0.881928444f, 0.50811702f},
-std::array<float,2>{0.532657325f, 0.20111762f},
-std::array<float,2>{0.265512496f, 0.785985172f},
-std::array<float,2>{0.420213342f, 0.0778776109f},
-std::array<float,2>{0.647021115f, 0.913140059f},
-std::array<float,2>{0.872298658f, 0.315138251f},
-std::array<float,2>{0.189887539f, 0.625419021f},
-std::array<float,2>{0.14439185f, 0.140232876f},
-std::array<float,2>{0.783060014f, 0.844668388f},
-std::array<float,2>{0.729041994f, 0.453652054f},
-std::array<float,2>{0.470848233f, 0.620282531f},
-std::array<float,2>{0.335265845f, 0.301259756f},
-std::array<float,2>{0.590226173f, 0.701922059f},
-std::array<float,2>{0.954677522f, 0.0121000716f},
-std::array<float,2>{0.0367734656f, 0.963355243f},
-std::array<float,2>{0.174267918f, 0.441903323f},
-std::array<float,2>{0.76893121f, 0.604907632f},
-std::array<float,2>{0.713229656f, 0.144842058f},
-std::array<float,2>{0.468673706f, 0.863617659f},
-std::array<float,2>{0.358108759f, 0.0203511007f},
-std::array<float,2>{0.604877055f, 0.943689883f},
-std::array<float,2>{0.988874197f, 0.282355219f},
-std::array<float,2>{0.0215109698f, 0.714522958f},
-std::array<float,2>{0.0899645686f, 0.20676668f},
-std::array<float,2>{0.927778363f, 0.800390363f},
-std::array<float,2>{0.501249373f, 0.406517416f},
-std::array<float,2>{0.307685494f, 0.529745579f},
-std::array<float,2>{0.379509777f, 0.336435437f},
-std::array<float,2>{0.665457249f, 0.644097447f},
-std::array<float,2>{0.831292331f, 0.0812644586f},
-std::array<float,2>{0.227316737f, 0.92989558f},
-std::array<float,2>{0.0521935746f, 0.276502699f},
-std::array<float,2>{0.950239182f, 0.737869501f},
-std::array<float,2>{0.573499501f, 0.0544862114f},
-std::array<float,2>{0.317702472f, 0.978585958f},
-std::array<float,2>{0.489554107f, 0.166248441f},
-std::array<float,2>{0.744798124f, 0.824891329f},
-std::array<float,2>{0.810233772f, 0.484587342f},
-std::array<float,2>{0.13324827f, 0.585812569f},
-std::array<float,2>{0.207864538f, 0.102470376f},
-std::array<float,2>{0.858142376f, 0.893639565f},
-std::array<float,2>{0.629616976f, 0.351412147f},
-std::array<float,2>{0.431298733f, 0.682787836f},
-std::array<float,2>{0.274269879f, 0.403277874f},
-std::array<float,2>{0.549616098f, 0.54051131f},
-std::array<float,2>{0.891534567f, 0.234799191f},
-std::array<float,2>{0.107617326f, 0.764393687f},
-std::array<float,2>{0.204750657f, 0.308947831f},
-std::array<float,2>{0.852933764f, 0.694625854f},
-std::array<float,2>{0.625230968f, 0.000410605222f},
-std::array<float,2>{0.434837282f, 0.956844509f},
-std::array<float,2>{0.279611528f, 0.131702721f},
-std::array<float,2>{0.552800834f, 0.854059756f},
-std::array<float,2>{0.898416638f, 0.46657455f},
-std::array<float,2>{0.10460335f, 0.613635778f},
-std::array<float,2>{0.0482289046f, 0.0636006519f},
-std::array<float,2>{0.948542416f, 0.920094013f},
-std::array<float,2>{0.575815916f, 0.324427724f},
-std::array<float,2>{0.314194471f, 0.638113916f},
-std::array<float,2>{0.485222071f, 0.43193987f},
-std::array<float,2>{0.747724473f, 0.507356822f},
-std::array<float,2>{0.805970609f, 0.192078531f},
-std::array<float,2>{0.136755526f, 0.79164052f},
-std::array<float,2>{0.0875014141f, 0.482601613f},
-std::array<float,2>{0.922645926f, 0.577155173f},
-std::array<float,2>{0.507255614f, 0.17960377f},
-std::array<float,2>{0.309378684f, 0.831246436f},
-std::array<float,2>{0.375825316f, 0.0460004695f},
-std::array<float,2>{0.669741809f, 0.996263862f},
-std::array<float,2>{0.835592806f, 0.265037596f},
-std::array<float,2>{0.23343645f, 0.730826437f},
-std::array<float,2>{0.178126141f, 0.221877694f},
-std::array<float,2>{0.77174592f, 0.77207911f},
-std::array<float,2>{0.71504879f, 0.382791877f},
-std::array<float,2>{0.461821645f, 0.556766927f},
-std::array<float,2>{0.35391444f, 0.366059273f},
-std::array<float,2>{0.607255697f, 0.666023016f},
-std::array<float,2>{0.986406028f, 0.119073242f},
-std::array<float,2>{0.0193243958f, 0.875704467f},
-std::array<float,2>{0.144930303f, 0.394940883f},
-std::array<float,2>{0.786308527f, 0.532708526f},
-std::array<float,2>{0.731267393f, 0.249474034f},
-std::array<float,2>{0.473128229f, 0.753055394f},
-std::array<float,2>{0.331534088f, 0.0985665843f},
-std::array<float,2>{0.587744892f, 0.902338207f},
-std::array<float,2>{0.960737586f, 0.358766228f},
-std::array<float,2>{0.0338827968f, 0.674614549f},
-std::array<float,2>{0.112468332f, 0.161658227f},
-std::array<float,2>{0.877618909f, 0.815197408f},
-std::array<float,2>{0.535426021f, 0.496253371f},
-std::array<float,2>{0.258809417f, 0.586152077f},
-std::array<float,2>{0.414437115f, 0.266914427f},
-std::array<float,2>{0.64403075f, 0.743406832f},
-std::array<float,2>{0.870599985f, 0.056493856f},
-std::array<float,2>{0.192356586f, 0.976401269f},
-std::array<float,2>{0.0136780059f, 0.331741959f},
-std::array<float,2>{0.976198018f, 0.654644907f},
-std::array<float,2>{0.610579073f, 0.0869821459f},
-std::array<float,2>{0.370052755f, 0.926191449f},
-std::array<float,2>{0.444005698f, 0.211789906f},
-std::array<float,2>{0.702320099f, 0.807541907f},
-std::array<float,2>{0.754216909f, 0.415362954f},
-std::array<float,2>{0.160306722f, 0.516369402f},
-std::array<float,2>{0.244675979f, 0.0271487404f},
-std::array<float,2>{0.817758083f, 0.947629273f},
-std::array<float,2>{0.673579037f, 0.294177324f},
-std::array<float,2>{0.39972353f, 0.704665601f},
-std::array<float,2>{0.287294924f, 0.450549126f},
-std::array<float,2>{0.524194419f, 0.601453066f},
-std::array<float,2>{0.912414312f, 0.154273883f},
-std::array<float,2>{0.0781064332f, 0.868636787f},
-std::array<float,2>{0.166686922f, 0.346799016f},
-std::array<float,2>{0.7644642f, 0.68582499f},
-std::array<float,2>{0.69197005f, 0.107618518f},
-std::array<float,2>{0.451522291f, 0.896539748f},
-std::array<float,2>{0.364982456f, 0.24002032f},
-std::array<float,2>{0.622619927f, 0.759328663f},
-std::array<float,2>{0.981205523f, 0.399051547f},
-std::array<float,2>{0.00359621178f, 0.543862402f},
-std::array<float,2>{0.0701559037f, 0.0476384386f},
-std::array<float,2>{0.915036559f, 0.983483255f},
-std::array<float,2>{0.518658757f, 0.279930174f},
-std::array<float,2>{0.292228222f, 0.739422023f},
-std::array<float,2>{0.393330932f, 0.491509438f},
-std::array<float,2>{0.682060182f, 0.578206301f},
-std::array<float,2>{0.826085925f, 0.168150038f},
-std::array<float,2>{0.240586445f, 0.824169099f},
-std::array<float,2>{0.0395641997f, 0.412916541f},
-std::array<float,2>{0.968183577f, 0.523709238f},
-std::array<float,2>{0.582325876f, 0.20795083f},
-std::array<float,2>{0.340037048f, 0.804137588f},
-std::array<float,2>{0.476593941f, 0.0852025151f},
-std::array<float,2>{0.725461423f, 0.934091449f},
-std::array<float,2>{0.793588638f, 0.343504161f},
-std::array<float,2>{0.152090609f, 0.64660567f},
-std::array<float,2>{0.195929766f, 0.142645672f},
-std::array<float,2>{0.859387398f, 0.863170326f},
-std::array<float,2>{0.653039217f, 0.437645197f},
-std::array<float,2>{0.409695834f, 0.605852067f},
-std::array<float,2>{0.250692695f, 0.287197173f},
-std::array<float,2>{0.543540895f, 0.716987491f},
-std::array<float,2>{0.884819806f, 0.0170770362f},
-std::array<float,2>{0.124915995f, 0.941078246f},
-std::array<float,2>{0.225438029f, 0.457262695f},
-std::array<float,2>{0.840197027f, 0.622506917f},
-std::array<float,2>{0.66193378f, 0.134404808f},
-std::array<float,2>{0.383098155f, 0.85015291f},
-std::array<float,2>{0.304458082f, 0.00947321765f},
-std::array<float,2>{0.507968545f, 0.96560967f},
-std::array<float,2>{0.931748927f, 0.299339861f},
-std::array<float,2>{0.0814835578f, 0.697970152f},
-std::array<float,2>{0.0290430691f, 0.196442649f},
-std::array<float,2>{0.993705392f, 0.783189237f},
-std::array<float,2>{0.599231422f, 0.425250918f},
-std::array<float,2>{0.350634247f, 0.51520592f},
-std::array<float,2>{0.45462662f, 0.317535341f},
-std::array<float,2>{0.704129398f, 0.630982399f},
-std::array<float,2>{0.779331326f, 0.071514383f},
-std::array<float,2>{0.181026444f, 0.909870744f},
-std::array<float,2>{0.10061501f, 0.256040156f},
-std::array<float,2>{0.901339054f, 0.725671887f},
-std::array<float,2>{0.560607612f, 0.0387201086f},
-std::array<float,2>{0.272992998f, 0.987197042f},
-std::array<float,2>{0.424165398f, 0.184379831f},
-std::array<float,2>{0.636634231f, 0.836119711f},
-std::array<float,2>{0.850058019f, 0.468860209f},
-std::array<float,2>{0.21808134f, 0.569911361f},
-std::array<float,2>{0.127282977f, 0.116333984f},
-std::array<float,2>{0.797801852f, 0.885672569f},
-std::array<float,2>{0.736159682f, 0.374293029f},
-std::array<float,2>{0.496256828f, 0.66044718f},
-std::array<float,2>{0.326177597f, 0.384893179f},
-std::array<float,2>{0.562542975f, 0.550871551f},
-std::array<float,2>{0.945015192f, 0.22707963f},
-std::array<float,2>{0.0586380772f, 0.774032533f},
-std::array<float,2>{0.133373648f, 0.273870021f},
-std::array<float,2>{0.809626639f, 0.735963702f},
-std::array<float,2>{0.744155645f, 0.0525053069f},
-std::array<float,2>{0.490181267f, 0.976873338f},
-std::array<float,2>{0.318038851f, 0.165833652f},
-std::array<float,2>{0.574207067f, 0.827417195f},
-std::array<float,2>{0.950848818f, 0.486963451f},
-std::array<float,2>{0.052413702f, 0.58377254f},
-std::array<float,2>{0.108348548f, 0.103800394f},
-std::array<float,2>{0.891034245f, 0.890930116f},
-std::array<float,2>{0.549282432f, 0.349044025f},
-std::array<float,2>{0.273653001f, 0.679874539f},
-std::array<float,2>{0.430775642f, 0.404987603f},
-std::array<float,2>{0.628942788f, 0.541409731f},
-std::array<float,2>{0.857909799f, 0.236856088f},
-std::array<float,2>{0.207053795f, 0.76173687f},
-std::array<float,2>{0.0223548654f, 0.444961101f},
-std::array<float,2>{0.988380849f, 0.602264881f},
-std::array<float,2>{0.60506779f, 0.14746882f},
-std::array<float,2>{0.357784897f, 0.867031217f},
-std::array<float,2>{0.467789382f, 0.0223735683f},
-std::array<float,2>{0.713382542f, 0.942408562f},
-std::array<float,2>{0.769227386f, 0.284217089f},
-std::array<float,2>{0.174626648f, 0.712410271f},
-std::array<float,2>{0.226913527f, 0.204055548f},
-std::array<float,2>{0.832002878f, 0.797273397f},
-std::array<float,2>{0.665873826f, 0.408524573f},
-std::array<float,2>{0.379009396f, 0.529005289f},
-std::array<float,2>{0.308156431f, 0.339810342f},
-std::array<float,2>{0.50147748f, 0.642312407f},
-std::array<float,2>{0.928709388f, 0.0797991231f},
-std::array<float,2>{0.0906472132f, 0.932028115f},
-std::array<float,2>{0.190009058f, 0.428321302f},
-std::array<float,2>{0.872907221f, 0.51152277f},
-std::array<float,2>{0.646574557f, 0.201786906f},
-std::array<float,2>{0.420436293f, 0.787836432f},
-std::array<float,2>{0.264876932f, 0.0743609592f},
-std::array<float,2>{0.533107758f, 0.91087395f},
-std::array<float,2>{0.882608116f, 0.314296037f},
-std::array<float,2>{0.116219752f, 0.627982736f},
-std::array<float,2>{0.0366086848f, 0.137817234f},
-std::array<float,2>{0.954266965f, 0.846529782f},
-std::array<float,2>{0.590407968f, 0.455670804f},
-std::array<float,2>{0.335892797f, 0.618886471f},
-std::array<float,2>{0.471198738f, 0.303654075f},
-std::array<float,2>{0.72873491f, 0.700407028f},
-std::array<float,2>{0.782607079f, 0.0144352308f},
-std::array<float,2>{0.143786117f, 0.9610641f},
-std::array<float,2>{0.0738695264f, 0.367692381f},
-std::array<float,2>{0.908646762f, 0.65656054f},
-std::array<float,2>{0.528346777f, 0.112368114f},
-std::array<float,2>{0.281475604f, 0.888404548f},
-std::array<float,2>{0.40580374f, 0.231260523f},
-std::array<float,2>{0.676751971f, 0.780922592f},
-std::array<float,2>{0.812849224f, 0.389600664f},
-std::array<float,2>{0.246842802f, 0.547942519f},
-std::array<float,2>{0.156368807f, 0.0348207019f},
-std::array<float,2>{0.752605379f, 0.991826773f},
-std::array<float,2>{0.696822405f, 0.251020223f},
-std::array<float,2>{0.440801501f, 0.722652435f},
-std::array<float,2>{0.37439701f, 0.47481364f},
-std::array<float,2>{0.615281582f, 0.563179433f},
-std::array<float,2>{0.970139802f, 0.183271065f},
-std::array<float,2>{0.0106723346f, 0.842443943f},
-std::array<float,2>{0.234966502f, 0.322618335f},
-std::array<float,2>{0.821562171f, 0.634332895f},
-std::array<float,2>{0.685910344f, 0.0672956035f},
-std::array<float,2>{0.3976551f, 0.915020406f},
-std::array<float,2>{0.296167552f, 0.189755738f},
-std::array<float,2>{0.522351325f, 0.793134689f},
-std::array<float,2>{0.921520472f, 0.435965031f},
-std::array<float,2>{0.0637938902f, 0.503023267f},
-std::array<float,2>{0.00504307449f, 0.00499186153f},
-std::array<float,2>{0.980109692f, 0.960539222f},
-std::array<float,2>{0.619048357f, 0.305546552f},
-std::array<float,2>{0.360254139f, 0.690046132f},
-std::array<float,2>{0.447850794f, 0.463462681f},
-std::array<float,2>{0.689138114f, 0.611623764f},
-std::array<float,2>{0.760376692f, 0.128515512f},
-std::array<float,2>{0.169553041f, 0.856537938f},
-std::array<float,2>{0.121004738f, 0.376328021f},
-std::array<float,2>{0.887368977f, 0.562336981f},
-std::array<float,2>{0.541850209f, 0.224211842f},
-std::array<float,2>{0.255564153f, 0.767521918f},
-std::array<float,2>{0.412892789f, 0.124546133f},
-std::array<float,2>{0.649062037f, 0.882767618f},
-std::array<float,2>{0.863326132f, 0.363133222f},
-std::array<float,2>{0.199819699f, 0.670224071f},
-std::array<float,2>{0.152717873f, 0.173306957f},
-std::array<float,2>{0.792793334f, 0.833804965f},
-std::array<float,2>{0.72018528f, 0.478972852f},
-std::array<float,2>{0.484090298f, 0.57308042f},
-std::array<float,2>{0.339221537f, 0.259263366f},
-std::array<float,2>{0.580426216f, 0.72694695f},
-std::array<float,2>{0.961737692f, 0.0414879918f},
-std::array<float,2>{0.0468373783f, 0.99548018f},
-std::array<float,2>{0.187350139f, 0.493252069f},
-std::array<float,2>{0.775036991f, 0.593436003f},
-std::array<float,2>{0.710244f, 0.159460932f},
-std::array<float,2>{0.459692776f, 0.816987991f},
-std::array<float,2>{0.346574008f, 0.0593075939f},
-std::array<float,2>{0.594291449f, 0.971291363f},
-std::array<float,2>{0.997776687f, 0.272326589f},
-std::array<float,2>{0.0265739709f, 0.749153316f},
-std::array<float,2>{0.0834344327f, 0.243057281f},
-std::array<float,2>{0.934309721f, 0.755965292f},
-std::array<float,2>{0.513136268f, 0.39197576f},
-std::array<float,2>{0.29789421f, 0.535874426f},
-std::array<float,2>{0.388720483f, 0.354496628f},
-std::array<float,2>{0.659299195f, 0.675977528f},
-std::array<float,2>{0.838544965f, 0.0970795751f},
-std::array<float,2>{0.221910477f, 0.904334068f},
-std::array<float,2>{0.0585716218f, 0.29133895f},
-std::array<float,2>{0.938598394f, 0.710667014f},
-std::array<float,2>{0.569463074f, 0.0296229851f},
-std::array<float,2>{0.323863f, 0.949493527f},
-std::array<float,2>{0.493579686f, 0.151646256f},
-std::array<float,2>{0.741147518f, 0.873784781f},
-std::array<float,2>{0.802469432f, 0.447565973f},
-std::array<float,2>{0.12972334f, 0.594448984f},
-std::array<float,2>{0.21269995f, 0.0935183987f},
-std::array<float,2>{0.845835805f, 0.921913743f},
-std::array<float,2>{0.637896776f, 0.335513413f},
-std::array<float,2>{0.427117556f, 0.64885354f},
-std::array<float,2>{0.26752463f, 0.420280755f},
-std::array<float,2>{0.558173895f, 0.522492707f},
-std::array<float,2>{0.902707934f, 0.21547161f},
-std::array<float,2>{0.0940342471f, 0.811031342f},
-std::array<float,2>{0.232302099f, 0.2634345f},
-std::array<float,2>{0.833946943f, 0.73256284f},
-std::array<float,2>{0.670966208f, 0.044493299f},
-std::array<float,2>{0.378014714f, 0.999218345f},
-std::array<float,2>{0.310905904f, 0.176224992f},
-std::array<float,2>{0.505700707f, 0.829566956f},
-std::array<float,2>{0.924730062f, 0.480783939f},
-std::array<float,2>{0.0896232501f, 0.574409366f},
-std::array<float,2>{0.0171042681f, 0.120736413f},
-std::array<float,2>{0.985909283f, 0.876980305f},
-std::array<float,2>{0.608244479f, 0.364392966f},
-std::array<float,2>{0.353327304f, 0.665837288f},
-std::array<float,2>{0.464687377f, 0.379927456f},
-std::array<float,2>{0.71862781f, 0.555548608f},
-std::array<float,2>{0.77143085f, 0.220592156f},
-std::array<float,2>{0.176391065f, 0.770042777f},
-std::array<float,2>{0.102453008f, 0.46759519f},
-std::array<float,2>{0.894822836f, 0.616615593f},
-std::array<float,2>{0.5521698f, 0.130455628f},
-std::array<float,2>{0.278308898f, 0.852733076f},
-std::array<float,2>{0.436228454f, 0.00261107669f},
-std::array<float,2>{0.627405465f, 0.953886151f},
-std::array<float,2>{0.854773462f, 0.312448561f},
-std::array<float,2>{0.206469595f, 0.692103088f},
-std::array<float,2>{0.139533117f, 0.194030955f},
-std::array<float,2>{0.80853498f, 0.789934099f},
-std::array<float,2>{0.748117208f, 0.43012175f},
-std::array<float,2>{0.48805964f, 0.50506711f},
-std::array<float,2>{0.316300482f, 0.327869862f},
-std::array<float,2>{0.577385366f, 0.640459299f},
-std::array<float,2>{0.945453346f, 0.0645051375f},
-std::array<float,2>{0.0504203439f, 0.919188976f},
-std::array<float,2>{0.162957951f, 0.416350514f},
-std::array<float,2>{0.756468832f, 0.519251943f},
-std::array<float,2>{0.701079071f, 0.214468643f},
-std::array<float,2>{0.441957057f, 0.806124389f},
-std::array<float,2>{0.367509276f, 0.0879530832f},
-std::array<float,2>{0.612970293f, 0.928880632f},
-std::array<float,2>{0.973618925f, 0.328736573f},
-std::array<float,2>{0.0118289571f, 0.652681708f},
-std::array<float,2>{0.0751463771f, 0.156080276f},
-std::array<float,2>{0.911236525f, 0.870730937f},
-std::array<float,2>{0.525635302f, 0.451298475f},
-std::array<float,2>{0.285270005f, 0.598795831f},
-std::array<float,2>{0.401941717f, 0.296006799f},
-std::array<float,2>{0.674297154f, 0.706186593f},
-std::array<float,2>{0.819207191f, 0.0252699722f},
-std::array<float,2>{0.24221772f, 0.945402086f},
-std::array<float,2>{0.0322058722f, 0.357138067f},
-std::array<float,2>{0.9584167f, 0.672215581f},
-std::array<float,2>{0.588550508f, 0.10079883f},
-std::array<float,2>{0.32841602f, 0.899807215f},
-std::array<float,2>{0.476241976f, 0.246897668f},
-std::array<float,2>{0.733694673f, 0.75019747f},
-std::array<float,2>{0.787614107f, 0.396557629f},
-std::array<float,2>{0.146774814f, 0.535132289f},
-std::array<float,2>{0.193862483f, 0.056853801f},
-std::array<float,2>{0.869084716f, 0.973175108f},
-std::array<float,2>{0.642275214f, 0.269425571f},
-std::array<float,2>{0.417587936f, 0.745332539f},
-std::array<float,2>{0.261345088f, 0.499554098f},
-std::array<float,2>{0.538311362f, 0.588400245f},
-std::array<float,2>{0.875965595f, 0.163957462f},
-std::array<float,2>{0.110862024f, 0.814143658f},
-std::array<float,2>{0.149780989f, 0.340225786f},
-std::array<float,2>{0.795109332f, 0.6459108f},
-std::array<float,2>{0.723447025f, 0.0832237527f},
-std::array<float,2>{0.479427278f, 0.937153339f},
-std::array<float,2>{0.342891067f, 0.20955728f},
-std::array<float,2>{0.584721923f, 0.802480459f},
-std::array<float,2>{0.966552615f, 0.411327213f},
-std::array<float,2>{0.041952461f, 0.526880264f},
-std::array<float,2>{0.121115707f, 0.0185179599f},
-std::array<float,2>{0.884349406f, 0.937906146f},
-std::array<float,2>{0.545072198f, 0.285458088f},
-std::array<float,2>{0.252536386f, 0.71558392f},
-std::array<float,2>{0.406700075f, 0.440679729f},
-std::array<float,2>{0.654386163f, 0.608329117f},
-std::array<float,2>{0.862374306f, 0.141171098f},
-std::array<float,2>{0.198705658f, 0.859548688f},
-std::array<float,2>{0.000910093077f, 0.40142563f},
-std::array<float,2>{0.982878625f, 0.545837343f},
-std::array<float,2>{0.623828232f, 0.240859523f},
-std::array<float,2>{0.365557432f, 0.761052489f},
-std::array<float,2>{0.449273854f, 0.10598585f},
-std::array<float,2>{0.693673432f, 0.896174729f},
-std::array<float,2>{0.761898637f, 0.345189571f},
-std::array<float,2>{0.165190667f, 0.68503648f},
-std::array<float,2>{0.238553628f, 0.170589522f},
-std::array<float,2>{0.826618254f, 0.821281374f},
-std::array<float,2>{0.680794835f, 0.488365412f},
-std::array<float,2>{0.392325133f, 0.580897212f},
-std::array<float,2>{0.290501416f, 0.278656602f},
-std::array<float,2>{0.517151773f, 0.742132008f},
-std::array<float,2>{0.917643189f, 0.0504892655f},
-std::array<float,2>{0.0682943538f, 0.981426775f},
-std::array<float,2>{0.215625465f, 0.471707344f},
-std::array<float,2>{0.847681344f, 0.567058504f},
-std::array<float,2>{0.632923961f, 0.186622813f},
-std::array<float,2>{0.423430294f, 0.839080453f},
-std::array<float,2>{0.270704925f, 0.0354316384f},
-std::array<float,2>{0.558752418f, 0.984849751f},
-std::array<float,2>{0.899706364f, 0.254964679f},
-std::array<float,2>{0.0981115997f, 0.724258363f},
-std::array<float,2>{0.0606474467f, 0.229922503f},
-std::array<float,2>{0.942528546f, 0.775686383f},
-std::array<float,2>{0.564585447f, 0.383034348f},
-std::array<float,2>{0.325838655f, 0.55390048f},
-std::array<float,2>{0.49948591f, 0.371921957f},
-std::array<float,2>{0.738279462f, 0.662229419f},
-std::array<float,2>{0.799677849f, 0.114382558f},
-std::array<float,2>{0.126832932f, 0.884205222f},
-std::array<float,2>{0.0791434348f, 0.298534602f},
-std::array<float,2>{0.930140018f, 0.696849644f},
-std::array<float,2>{0.510270476f, 0.0115792584f},
-std::array<float,2>{0.301929384f, 0.968185008f},
-std::array<float,2>{0.385006279f, 0.135925174f},
-std::array<float,2>{0.662412584f, 0.848471522f},
-std::array<float,2>{0.842182338f, 0.460079223f},
-std::array<float,2>{0.223801926f, 0.62343055f},
-std::array<float,2>{0.183449f, 0.0732530653f},
-std::array<float,2>{0.77817446f, 0.906838775f},
-std::array<float,2>{0.705608964f, 0.320032567f},
-std::array<float,2>{0.456516534f, 0.629130065f},
-std::array<float,2>{0.348707557f, 0.422705442f},
-std::array<float,2>{0.601345718f, 0.512504339f},
-std::array<float,2>{0.994493246f, 0.198895559f},
-std::array<float,2>{0.0306894369f, 0.783646286f},
-std::array<float,2>{0.172388807f, 0.283145308f},
-std::array<float,2>{0.767550886f, 0.71404326f},
-std::array<float,2>{0.712332904f, 0.0195661411f},
-std::array<float,2>{0.464914948f, 0.944201589f},
-std::array<float,2>{0.356977195f, 0.14549543f},
-std::array<float,2>{0.602078378f, 0.863877654f},
-std::array<float,2>{0.990544558f, 0.441648781f},
-std::array<float,2>{0.0199031923f, 0.605376124f},
-std::array<float,2>{0.0935119167f, 0.0818351954f},
-std::array<float,2>{0.926211417f, 0.930214524f},
-std::array<float,2>{0.502651036f, 0.336411864f},
-std::array<float,2>{0.305805892f, 0.643699646f},
-std::array<float,2>{0.382590324f, 0.406768829f},
-std::array<float,2>{0.667247653f, 0.530236423f},
-std::array<float,2>{0.828669369f, 0.206213787f},
-std::array<float,2>{0.229920521f, 0.799955308f},
-std::array<float,2>{0.0543137528f, 0.484884739f},
-std::array<float,2>{0.952958584f, 0.584976971f},
-std::array<float,2>{0.571305931f, 0.166753486f},
-std::array<float,2>{0.31941247f, 0.82442528f},
-std::array<float,2>{0.490256757f, 0.0538654178f},
-std::array<float,2>{0.742264092f, 0.979485154f},
-std::array<float,2>{0.810718536f, 0.276916802f},
-std::array<float,2>{0.135673568f, 0.737374723f},
-std::array<float,2>{0.209582016f, 0.235303372f},
-std::array<float,2>{0.856571853f, 0.763850868f},
-std::array<float,2>{0.631288946f, 0.402364194f},
-std::array<float,2>{0.432028115f, 0.540627539f},
-std::array<float,2>{0.277055025f, 0.350643069f},
-std::array<float,2>{0.548556507f, 0.683378279f},
-std::array<float,2>{0.893740952f, 0.101776935f},
-std::array<float,2>{0.106742397f, 0.894390285f},
-std::array<float,2>{0.248641074f, 0.387363404f},
-std::array<float,2>{0.815551519f, 0.549416363f},
-std::array<float,2>{0.6787588f, 0.233888209f},
-std::array<float,2>{0.402603447f, 0.777960241f},
-std::array<float,2>{0.284779012f, 0.111021318f},
-std::array<float,2>{0.530601025f, 0.888983965f},
-std::array<float,2>{0.906390429f, 0.370602429f},
-std::array<float,2>{0.0719744936f, 0.659386754f},
-std::array<float,2>{0.00924876891f, 0.180433378f},
-std::array<float,2>{0.971995413f, 0.841432393f},
-std::array<float,2>{0.613326252f, 0.473229885f},
-std::array<float,2>{0.37138173f, 0.566045821f},
-std::array<float,2>{0.439381003f, 0.252966732f},
-std::array<float,2>{0.698512852f, 0.719071507f},
-std::array<float,2>{0.750639081f, 0.0319570415f},
-std::array<float,2>{0.160118893f, 0.988491416f},
-std::array<float,2>{0.113312408f, 0.31447643f},
-std::array<float,2>{0.879063308f, 0.625770211f},
-std::array<float,2>{0.533204019f, 0.077480875f},
-std::array<float,2>{0.262126058f, 0.913755834f},
-std::array<float,2>{0.41952461f, 0.200248301f},
-std::array<float,2>{0.645100474f, 0.785161793f},
-std::array<float,2>{0.874886811f, 0.42755121f},
-std::array<float,2>{0.187924176f, 0.508746624f},
-std::array<float,2>{0.142294988f, 0.0122375041f},
-std::array<float,2>{0.783211589f, 0.963689148f},
-std::array<float,2>{0.727404058f, 0.301354527f},
-std::array<float,2>{0.469863385f, 0.701204181f},
-std::array<float,2>{0.33245191f, 0.453606158f},
-std::array<float,2>{0.592187047f, 0.620880842f},
-std::array<float,2>{0.956973076f, 0.139929026f},
-std::array<float,2>{0.0381163172f, 0.843840122f},
-std::array<float,2>{0.201493964f, 0.360957384f},
-std::array<float,2>{0.867064714f, 0.669506907f},
-std::array<float,2>{0.651394486f, 0.122898176f},
-std::array<float,2>{0.411478311f, 0.880513549f},
-std::array<float,2>{0.257518589f, 0.226156726f},
-std::array<float,2>{0.540368259f, 0.769044638f},
-std::array<float,2>{0.889896154f, 0.378194511f},
-std::array<float,2>{0.118082196f, 0.558851898f},
-std::array<float,2>{0.0436789989f, 0.0405994244f},
-std::array<float,2>{0.963514864f, 0.992315948f},
-std::array<float,2>{0.57821548f, 0.260388076f},
-std::array<float,2>{0.336515039f, 0.730300725f},
-std::array<float,2>{0.481372088f, 0.47699821f},
-std::array<float,2>{0.721342623f, 0.571145117f},
-std::array<float,2>{0.790586591f, 0.173984692f},
-std::array<float,2>{0.15433082f, 0.835597217f},
-std::array<float,2>{0.0654732808f, 0.435533732f},
-std::array<float,2>{0.918751776f, 0.500105917f},
-std::array<float,2>{0.521482468f, 0.187659249f},
-std::array<float,2>{0.294025242f, 0.795888722f},
-std::array<float,2>{0.396266282f, 0.0694513246f},
-std::array<float,2>{0.685399413f, 0.916968107f},
-std::array<float,2>{0.82418406f, 0.32046771f},
-std::array<float,2>{0.237021521f, 0.635959268f},
-std::array<float,2>{0.171203807f, 0.126891032f},
-std::array<float,2>{0.7579934f, 0.857847452f},
-std::array<float,2>{0.690352261f, 0.461066097f},
-std::array<float,2>{0.445856333f, 0.610253692f},
-std::array<float,2>{0.362706274f, 0.306869805f},
-std::array<float,2>{0.61974299f, 0.688373864f},
-std::array<float,2>{0.977450192f, 0.00772102037f},
-std::array<float,2>{0.00628156215f, 0.958438158f},
-std::array<float,2>{0.132341281f, 0.446931928f},
-std::array<float,2>{0.803246796f, 0.596520483f},
-std::array<float,2>{0.739911795f, 0.149492294f},
-std::array<float,2>{0.494321704f, 0.872493207f},
-std::array<float,2>{0.321352035f, 0.0283806119f},
-std::array<float,2>{0.56662333f, 0.952377141f},
-std::array<float,2>{0.93961376f, 0.289633751f},
-std::array<float,2>{0.0561699197f, 0.707903504f},
-std::array<float,2>{0.0976364538f, 0.218647376f},
-std::array<float,2>{0.904894471f, 0.808742881f},
-std::array<float,2>{0.556338251f, 0.417971253f},
-std::array<float,2>{0.269214183f, 0.521394134f},
-std::array<float,2>{0.428040683f, 0.33204034f},
-std::array<float,2>{0.639540255f, 0.652065098f},
-std::array<float,2>{0.844284594f, 0.0912437513f},
-std::array<float,2>{0.213712499f, 0.92472744f},
-std::array<float,2>{0.0249375775f, 0.270699263f},
-std::array<float,2>{0.998795152f, 0.747361243f},
-std::array<float,2>{0.596868873f, 0.0619284511f},
-std::array<float,2>{0.343805432f, 0.970109105f},
-std::array<float,2>{0.458613127f, 0.157717273f},
-std::array<float,2>{0.708472371f, 0.819258392f},
-std::array<float,2>{0.777123094f, 0.494146436f},
-std::array<float,2>{0.185488909f, 0.591365278f},
-std::array<float,2>{0.219185993f, 0.0942910984f},
-std::array<float,2>{0.836597204f, 0.902797103f},
-std::array<float,2>{0.657257438f, 0.352816373f},
-std::array<float,2>{0.387428701f, 0.678583682f},
-std::array<float,2>{0.299560606f, 0.393309236f},
-std::array<float,2>{0.513674259f, 0.537217677f},
-std::array<float,2>{0.93720907f, 0.244574502f},
-std::array<float,2>{0.0853558928f, 0.754769981f},
-std::array<float,2>{0.243414849f, 0.293006659f},
-std::array<float,2>{0.819343925f, 0.703883231f},
-std::array<float,2>{0.675056577f, 0.0254652202f},
-std::array<float,2>{0.401005387f, 0.948249519f},
-std::array<float,2>{0.286728919f, 0.153268516f},
-std::array<float,2>{0.527257502f, 0.867571771f},
-std::array<float,2>{0.910944462f, 0.450089693f},
-std::array<float,2>{0.075699389f, 0.599767864f},
-std::array<float,2>{0.0127655044f, 0.0861628205f},
-std::array<float,2>{0.974252701f, 0.927392602f},
-std::array<float,2>{0.612280846f, 0.330455422f},
-std::array<float,2>{0.368712485f, 0.656084716f},
-std::array<float,2>{0.443288416f, 0.414521068f},
-std::array<float,2>{0.70001471f, 0.517461956f},
-std::array<float,2>{0.757705867f, 0.211943105f},
-std::array<float,2>{0.163197175f, 0.807929873f},
-std::array<float,2>{0.109420963f, 0.497859567f},
-std::array<float,2>{0.876425743f, 0.587505102f},
-std::array<float,2>{0.537838042f, 0.16113019f},
-std::array<float,2>{0.259813845f, 0.815465271f},
-std::array<float,2>{0.416940868f, 0.0555280112f},
-std::array<float,2>{0.641264796f, 0.975057602f},
-std::array<float,2>{0.8673262f, 0.266322464f},
-std::array<float,2>{0.194568083f, 0.742939055f},
-std::array<float,2>{0.148425937f, 0.248510569f},
-std::array<float,2>{0.788508236f, 0.75213629f},
-std::array<float,2>{0.733130693f, 0.39634347f},
-std::array<float,2>{0.475267857f, 0.532063544f},
-std::array<float,2>{0.329207361f, 0.357708991f},
-std::array<float,2>{0.589682817f, 0.675737321f},
-std::array<float,2>{0.95764786f, 0.0991476923f},
-std::array<float,2>{0.033018589f, 0.901106715f},
-std::array<float,2>{0.177498341f, 0.38114804f},
-std::array<float,2>{0.769992769f, 0.558459699f},
-std::array<float,2>{0.717402279f, 0.22094664f},
-std::array<float,2>{0.463546753f, 0.773086369f},
-std::array<float,2>{0.352506757f, 0.117330506f},
-std::array<float,2>{0.608700454f, 0.876269817f},
-std::array<float,2>{0.984991133f, 0.366224468f},
-std::array<float,2>{0.0163386688f, 0.667210698f},
-std::array<float,2>{0.0887714252f, 0.178217098f},
-std::array<float,2>{0.925551355f, 0.830388784f},
-std::array<float,2>{0.504841566f, 0.484261721f},
-std::array<float,2>{0.31234163f, 0.576513469f},
-std::array<float,2>{0.377037674f, 0.264008433f},
-std::array<float,2>{0.670891464f, 0.732148647f},
-std::array<float,2>{0.832720518f, 0.0457278565f},
-std::array<float,2>{0.231312722f, 0.997630954f},
-std::array<float,2>{0.0495078452f, 0.325751483f},
-std::array<float,2>{0.946840465f, 0.637668908f},
-std::array<float,2>{0.576246619f, 0.0633816123f},
-std::array<float,2>{0.315173775f, 0.921314895f},
-std::array<float,2>{0.486350983f, 0.193288594f},
-std::array<float,2>{0.749975264f, 0.792749107f},
-std::array<float,2>{0.80712837f, 0.432786018f},
-std::array<float,2>{0.140313059f, 0.506764948f},
-std::array<float,2>{0.205168709f, 0.00151758362f},
-std::array<float,2>{0.853757739f, 0.955624044f},
-std::array<float,2>{0.628239989f, 0.310460716f},
-std::array<float,2>{0.436794341f, 0.69386971f},
-std::array<float,2>{0.279243559f, 0.465796947f},
-std::array<float,2>{0.551397085f, 0.61432445f},
-std::array<float,2>{0.895629108f, 0.132080019f},
-std::array<float,2>{0.102848552f, 0.854546607f},
-std::array<float,2>{0.125762656f, 0.373111099f},
-std::array<float,2>{0.80017215f, 0.661874652f},
-std::array<float,2>{0.737085998f, 0.115323596f},
-std::array<float,2>{0.498945832f, 0.885803699f},
-std::array<float,2>{0.325066239f, 0.22799921f},
-std::array<float,2>{0.566096365f, 0.774676621f},
-std::array<float,2>{0.941434503f, 0.386322141f},
-std::array<float,2>{0.0619856939f, 0.552018225f},
-std::array<float,2>{0.0992653146f, 0.037185654f},
-std::array<float,2>{0.89940691f, 0.987695038f},
-std::array<float,2>{0.560419798f, 0.257150412f},
-std::array<float,2>{0.269774199f, 0.725065827f},
-std::array<float,2>{0.422015756f, 0.470004052f},
-std::array<float,2>{0.634032726f, 0.568585157f},
-std::array<float,2>{0.849027038f, 0.185006246f},
-std::array<float,2>{0.216478989f, 0.837493837f},
-std::array<float,2>{0.0294795092f, 0.424559653f},
-std::array<float,2>{0.995369494f, 0.514035463f},
-std::array<float,2>{0.600570798f, 0.195331618f},
-std::array<float,2>{0.347939312f, 0.781858265f},
-std::array<float,2>{0.455948919f, 0.07095965f},
-std::array<float,2>{0.706180632f, 0.908368766f},
-std::array<float,2>{0.778647423f, 0.316586584f},
-std::array<float,2>{0.182533711f, 0.63233906f},
-std::array<float,2>{0.22358802f, 0.133557171f},
-std::array<float,2>{0.843297899f, 0.851349831f},
-std::array<float,2>{0.663837552f, 0.458842665f},
-std::array<float,2>{0.386158258f, 0.62185955f},
-std::array<float,2>{0.301509291f, 0.300725609f},
-std::array<float,2>{0.510770857f, 0.698634088f},
-std::array<float,2>{0.931610167f, 0.00803308282f},
-std::array<float,2>{0.0788695663f, 0.966641605f},
-std::array<float,2>{0.197664708f, 0.439116091f},
-std::array<float,2>{0.861403227f, 0.606651127f},
-std::array<float,2>{0.655938268f, 0.144429654f},
-std::array<float,2>{0.407859981f, 0.862288356f},
-std::array<float,2>{0.253625304f, 0.0162547138f},
-std::array<float,2>{0.546692967f, 0.94031018f},
-std::array<float,2>{0.883405507f, 0.288404167f},
-std::array<float,2>{0.122632809f, 0.718429625f},
-std::array<float,2>{0.0423949994f, 0.208594561f},
-std::array<float,2>{0.965022743f, 0.803527176f},
-std::array<float,2>{0.585107148f, 0.413303524f},
-std::array<float,2>{0.341905773f, 0.524576843f},
-std::array<float,2>{0.479723662f, 0.342070699f},
-std::array<float,2>{0.724586666f, 0.647946f},
-std::array<float,2>{0.795943975f, 0.0846961588f},
-std::array<float,2>{0.148663774f, 0.93527633f},
-std::array<float,2>{0.0669089481f, 0.280692041f},
-std::array<float,2>{0.916623235f, 0.73858428f},
-std::array<float,2>{0.516136169f, 0.0484246202f},
-std::array<float,2>{0.290037096f, 0.983340025f},
-std::array<float,2>{0.39159739f, 0.169747129f},
-std::array<float,2>{0.680413067f, 0.822812736f},
-std::array<float,2>{0.827606142f, 0.490492374f},
-std::array<float,2>{0.239827082f, 0.579238713f},
-std::array<float,2>{0.164538771f, 0.10910245f},
-std::array<float,2>{0.762925565f, 0.898386896f},
-std::array<float,2>{0.694977939f, 0.345729142f},
-std::array<float,2>{0.451169133f, 0.687209249f},
-std::array<float,2>{0.366678149f, 0.40020147f},
-std::array<float,2>{0.624744356f, 0.544023633f},
-std::array<float,2>{0.98382467f, 0.238315821f},
-std::array<float,2>{0.00131461315f, 0.758485794f},
-std::array<float,2>{0.158858001f, 0.250340849f},
-std::array<float,2>{0.751670122f, 0.7216236f},
-std::array<float,2>{0.697753608f, 0.0340066031f},
-std::array<float,2>{0.43760255f, 0.990559697f},
-std::array<float,2>{0.372111171f, 0.182281747f},
-std::array<float,2>{0.614262283f, 0.8432073f},
-std::array<float,2>{0.971052825f, 0.476371378f},
-std::array<float,2>{0.00824978016f, 0.564337611f},
-std::array<float,2>{0.0708196163f, 0.111850433f},
-std::array<float,2>{0.907711506f, 0.887430549f},
-std::array<float,2>{0.529813766f, 0.368319929f},
-std::array<float,2>{0.283709675f, 0.657982767f},
-std::array<float,2>{0.403602839f, 0.390223891f},
-std::array<float,2>{0.67851764f, 0.547670007f},
-std::array<float,2>{0.815263391f, 0.232144669f},
-std::array<float,2>{0.249421179f, 0.779528916f},
-std::array<float,2>{0.0380810387f, 0.456075162f},
-std::array<float,2>{0.955085576f, 0.617237806f},
-std::array<float,2>{0.593667805f, 0.137327805f},
-std::array<float,2>{0.333814293f, 0.847147226f},
-std::array<float,2>{0.469336927f, 0.0150858797f},
-std::array<float,2>{0.727876782f, 0.962664962f},
-std::array<float,2>{0.78431052f, 0.304436296f},
-std::array<float,2>{0.141510442f, 0.699792266f},
-std::array<float,2>{0.18896693f, 0.202703476f},
-std::array<float,2>{0.873776913f, 0.788358927f},
-std::array<float,2>{0.646180212f, 0.429682553f},
-std::array<float,2>{0.418266773f, 0.510618746f},
-std::array<float,2>{0.263433576f, 0.312956214f},
-std::array<float,2>{0.534840405f, 0.62791127f},
-std::array<float,2>{0.880416274f, 0.0755699798f},
-std::array<float,2>{0.11444784f, 0.911592364f},
-std::array<float,2>{0.229468793f, 0.409558266f},
-std::array<float,2>{0.829684317f, 0.527457952f},
-std::array<float,2>{0.666580617f, 0.204834744f},
-std::array<float,2>{0.381133705f, 0.797880948f},
-std::array<float,2>{0.305401653f, 0.0781793594f},
-std::array<float,2>{0.503012598f, 0.933544576f},
-std::array<float,2>{0.927096784f, 0.338484347f},
-std::array<float,2>{0.0919196308f, 0.641547143f},
-std::array<float,2>{0.0207543764f, 0.146996319f},
-std::array<float,2>{0.991984665f, 0.865272462f},
-std::array<float,2>{0.603227973f, 0.443545669f},
-std::array<float,2>{0.356293797f, 0.603273153f},
-std::array<float,2>{0.466602325f, 0.283872485f},
-std::array<float,2>{0.711329758f, 0.711164951f},
-std::array<float,2>{0.76625973f, 0.0225287974f},
-std::array<float,2>{0.173646942f, 0.942248166f},
-std::array<float,2>{0.105924815f, 0.348370135f},
-std::array<float,2>{0.893122137f, 0.681032717f},
-std::array<float,2>{0.547601104f, 0.105406374f},
-std::array<float,2>{0.275733441f, 0.892168045f},
-std::array<float,2>{0.433264971f, 0.238142908f},
-std::array<float,2>{0.632265329f, 0.763445556f},
-std::array<float,2>{0.856333494f, 0.406068236f},
-std::array<float,2>{0.210076526f, 0.542417049f},
-std::array<float,2>{0.136227474f, 0.05083571f},
-std::array<float,2>{0.812200129f, 0.978308797f},
-std::array<float,2>{0.743543923f, 0.274972469f},
-std::array<float,2>{0.492064118f, 0.734822452f},
-std::array<float,2>{0.319330543f, 0.487881809f},
-std::array<float,2>{0.570550203f, 0.582827806f},
-std::array<float,2>{0.951689243f, 0.164679706f},
-std::array<float,2>{0.053452678f, 0.826178491f},
-std::array<float,2>{0.214193135f, 0.334702998f},
-std::array<float,2>{0.845212281f, 0.650149405f},
-std::array<float,2>{0.640275717f, 0.0918876529f},
-std::array<float,2>{0.429412782f, 0.923584223f},
-std::array<float,2>{0.267611593f, 0.216735691f},
-std::array<float,2>{0.555188835f, 0.812283218f},
-std::array<float,2>{0.9059816f, 0.421738893f},
-std::array<float,2>{0.0958387107f, 0.522291899f},
-std::array<float,2>{0.0549115576f, 0.0309640095f},
-std::array<float,2>{0.94092983f, 0.9508093f},
-std::array<float,2>{0.567670405f, 0.29272148f},
-std::array<float,2>{0.320652872f, 0.709444404f},
-std::array<float,2>{0.495548397f, 0.44882074f},
-std::array<float,2>{0.738942742f, 0.595529556f},
-std::array<float,2>{0.804449737f, 0.151217744f},
-std::array<float,2>{0.131095141f, 0.874153793f},
-std::array<float,2>{0.084292464f, 0.391573429f},
-std::array<float,2>{0.936255872f, 0.536434591f},
-std::array<float,2>{0.514760137f, 0.24364002f},
-std::array<float,2>{0.30062753f, 0.757269621f},
-std::array<float,2>{0.388544112f, 0.0959659219f},
-std::array<float,2>{0.656443f, 0.906104505f},
-std::array<float,2>{0.837272227f, 0.353747636f},
-std::array<float,2>{0.22009477f, 0.677476883f},
-std::array<float,2>{0.183723792f, 0.159170404f},
-std::array<float,2>{0.776096106f, 0.818189561f},
-std::array<float,2>{0.707676947f, 0.493044883f},
-std::array<float,2>{0.457808316f, 0.592749178f},
-std::array<float,2>{0.34500283f, 0.273027152f},
-std::array<float,2>{0.596664786f, 0.74839896f},
-std::array<float,2>{0.999434114f, 0.0602831952f},
-std::array<float,2>{0.023489289f, 0.97219032f},
-std::array<float,2>{0.155760944f, 0.480331957f},
-std::array<float,2>{0.789794743f, 0.574129999f},
-std::array<float,2>{0.722095549f, 0.172008887f},
-std::array<float,2>{0.482324392f, 0.832789302f},
-std::array<float,2>{0.336960852f, 0.042516876f},
-std::array<float,2>{0.579245269f, 0.99459821f},
-std::array<float,2>{0.964293003f, 0.258479089f},
-std::array<float,2>{0.0446848013f, 0.728427589f},
-std::array<float,2>{0.118347138f, 0.223592132f},
-std::array<float,2>{0.889060855f, 0.76618588f},
-std::array<float,2>{0.539961934f, 0.375492811f},
-std::array<float,2>{0.256728858f, 0.560893118f},
-std::array<float,2>{0.410869181f, 0.361351669f},
-std::array<float,2>{0.650631011f, 0.670966685f},
-std::array<float,2>{0.86619997f, 0.12329971f},
-std::array<float,2>{0.202990055f, 0.881279707f},
-std::array<float,2>{0.00777696446f, 0.306518584f},
-std::array<float,2>{0.977540672f, 0.691101193f},
-std::array<float,2>{0.620940387f, 0.00393818552f},
-std::array<float,2>{0.362210512f, 0.959163666f},
-std::array<float,2>{0.446631849f, 0.12766099f},
-std::array<float,2>{0.690444529f, 0.856128931f},
-std::array<float,2>{0.759214103f, 0.463903606f},
-std::array<float,2>{0.170304775f, 0.613201201f},
-std::array<float,2>{0.2376021f, 0.0676944554f},
-std::array<float,2>{0.822668016f, 0.915058374f},
-std::array<float,2>{0.683836758f, 0.323980808f},
-std::array<float,2>{0.394997656f, 0.633081794f},
-std::array<float,2>{0.293587536f, 0.436590374f},
-std::array<float,2>{0.519533932f, 0.502864778f},
-std::array<float,2>{0.919429421f, 0.190565452f},
-std::array<float,2>{0.0650332943f, 0.793996096f},
-std::array<float,2>{0.19294928f, 0.267976344f},
-std::array<float,2>{0.869747281f, 0.744180202f},
-std::array<float,2>{0.642901838f, 0.0578144453f},
-std::array<float,2>{0.415648133f, 0.973696828f},
-std::array<float,2>{0.258139342f, 0.162141398f},
-std::array<float,2>{0.536495924f, 0.813174486f},
-std::array<float,2>{0.878082871f, 0.498867273f},
-std::array<float,2>{0.111823f, 0.589270353f},
-std::array<float,2>{0.0343303904f, 0.100514799f},
-std::array<float,2>{0.95987606f, 0.899278641f},
-std::array<float,2>{0.586209297f, 0.355474532f},
-std::array<float,2>{0.330909967f, 0.672887981f},
-std::array<float,2>{0.474360675f, 0.397688568f},
-std::array<float,2>{0.732071996f, 0.533265412f},
-std::array<float,2>{0.785540164f, 0.24795486f},
-std::array<float,2>{0.145819306f, 0.751486719f},
-std::array<float,2>{0.0766424984f, 0.452999413f},
-std::array<float,2>{0.913728952f, 0.597658753f},
-std::array<float,2>{0.525233328f, 0.154741213f},
-std::array<float,2>{0.288483322f, 0.869628012f},
-std::array<float,2>{0.399217546f, 0.0234999862f},
-std::array<float,2>{0.671928883f, 0.947015882f},
-std::array<float,2>{0.816743016f, 0.29508698f},
-std::array<float,2>{0.245335087f, 0.705516338f},
-std::array<float,2>{0.161241233f, 0.213459387f},
-std::array<float,2>{0.755389929f, 0.805478394f},
-std::array<float,2>{0.701634824f, 0.417018116f},
-std::array<float,2>{0.444820136f, 0.517938614f},
-std::array<float,2>{0.37031889f, 0.329530358f},
-std::array<float,2>{0.609893799f, 0.654266953f},
-std::array<float,2>{0.975464046f, 0.088874355f},
-std::array<float,2>{0.0146621875f, 0.928605676f},
-std::array<float,2>{0.138185158f, 0.431205511f},
-std::array<float,2>{0.804729879f, 0.504855394f},
-std::array<float,2>{0.746112823f, 0.194609985f},
-std::array<float,2>{0.485891014f, 0.790102243f},
-std::array<float,2>{0.313288897f, 0.0663930401f},
-std::array<float,2>{0.575190663f, 0.918943763f},
-std::array<float,2>{0.947318912f, 0.326404452f},
-std::array<float,2>{0.0471650884f, 0.639362872f},
-std::array<float,2>{0.104229979f, 0.129324511f},
-std::array<float,2>{0.896744072f, 0.852218449f},
-std::array<float,2>{0.554675639f, 0.467948616f},
-std::array<float,2>{0.280357391f, 0.615494788f},
-std::array<float,2>{0.4342646f, 0.310578495f},
-std::array<float,2>{0.626707256f, 0.692734718f},
-std::array<float,2>{0.852158368f, 0.00372944167f},
-std::array<float,2>{0.203767911f, 0.954140961f},
-std::array<float,2>{0.0178615712f, 0.364020854f},
-std::array<float,2>{0.987353384f, 0.664767504f},
-std::array<float,2>{0.606066465f, 0.120101258f},
-std::array<float,2>{0.35461551f, 0.878265798f},
-std::array<float,2>{0.462679178f, 0.218927085f},
-std::array<float,2>{0.716565013f, 0.77071172f},
-std::array<float,2>{0.772501945f, 0.379235357f},
-std::array<float,2>{0.179505318f, 0.555908859f},
-std::array<float,2>{0.232665226f, 0.0435551926f},
-std::array<float,2>{0.834664702f, 0.998488843f},
-std::array<float,2>{0.668134272f, 0.262157172f},
-std::array<float,2>{0.376136184f, 0.73426348f},
-std::array<float,2>{0.309792608f, 0.481812358f},
-std::array<float,2>{0.506790221f, 0.575248182f},
-std::array<float,2>{0.92312479f, 0.177558333f},
-std::array<float,2>{0.0860017836f, 0.828161538f},
-std::array<float,2>{0.180341035f, 0.318539292f},
-std::array<float,2>{0.780555367f, 0.629940629f},
-std::array<float,2>{0.703196168f, 0.0724303052f},
-std::array<float,2>{0.453872025f, 0.908009529f},
-std::array<float,2>{0.349657416f, 0.197275579f},
-std::array<float,2>{0.597807407f, 0.785001636f},
-std::array<float,2>{0.993093848f, 0.423281252f},
-std::array<float,2>{0.0273515992f, 0.513641059f},
-std::array<float,2>{0.0809585676f, 0.00983217452f},
-std::array<float,2>{0.933149755f, 0.967592001f},
-std::array<float,2>{0.50976342f, 0.297064483f},
-std::array<float,2>{0.302924931f, 0.695463002f},
-std::array<float,2>{0.383930475f, 0.459382296f},
-std::array<float,2>{0.660489082f, 0.624527454f},
-std::array<float,2>{0.841440856f, 0.135297194f},
-std::array<float,2>{0.226126224f, 0.848690689f},
-std::array<float,2>{0.0597905517f, 0.383851171f},
-std::array<float,2>{0.943842053f, 0.55348295f},
-std::array<float,2>{0.564433217f, 0.229058027f},
-std::array<float,2>{0.32756713f, 0.77681601f},
-std::array<float,2>{0.497546315f, 0.114223614f},
-std::array<float,2>{0.734829485f, 0.883307397f},
-std::array<float,2>{0.798640251f, 0.372372538f},
-std::array<float,2>{0.128864691f, 0.663414717f},
-std::array<float,2>{0.217265546f, 0.185680404f},
-std::array<float,2>{0.851079166f, 0.838378131f},
-std::array<float,2>{0.634925365f, 0.471565306f},
-std::array<float,2>{0.425190747f, 0.568028331f},
-std::array<float,2>{0.271514386f, 0.254042625f},
-std::array<float,2>{0.562035263f, 0.723362923f},
-std::array<float,2>{0.901993155f, 0.0366387516f},
-std::array<float,2>{0.0997053012f, 0.986296356f},
-std::array<float,2>{0.241434529f, 0.489526093f},
-std::array<float,2>{0.824734569f, 0.581775427f},
-std::array<float,2>{0.682722926f, 0.171706319f},
-std::array<float,2>{0.394315243f, 0.822053909f},
-std::array<float,2>{0.291601181f, 0.0494528562f},
-std::array<float,2>{0.517607808f, 0.981918156f},
-std::array<float,2>{0.91568929f, 0.278120071f},
-std::array<float,2>{0.0689216778f, 0.740320504f},
-std::array<float,2>{0.00232508755f, 0.241363227f},
-std::array<float,2>{0.982221007f, 0.760421753f},
-std::array<float,2>{0.621771991f, 0.401330829f},
-std::array<float,2>{0.363998592f, 0.546315312f},
-std::array<float,2>{0.452159405f, 0.343817562f},
-std::array<float,2>{0.693044305f, 0.683723271f},
-std::array<float,2>{0.764913857f, 0.10705974f},
-std::array<float,2>{0.167683229f, 0.895113349f},
-std::array<float,2>{0.123523697f, 0.286866635f},
-std::array<float,2>{0.886631072f, 0.716332912f},
-std::array<float,2>{0.544627666f, 0.0192044992f},
-std::array<float,2>{0.251391441f, 0.939189017f},
-std::array<float,2>{0.40831095f, 0.142049223f},
-std::array<float,2>{0.654075682f, 0.86081773f},
-std::array<float,2>{0.861094892f, 0.44006902f},
-std::array<float,2>{0.196833849f, 0.608472228f},
-std::array<float,2>{0.15053314f, 0.0825496837f},
-std::array<float,2>{0.794821143f, 0.936060071f},
-std::array<float,2>{0.725661039f, 0.341568381f},
-std::array<float,2>{0.477796823f, 0.645070493f},
-std::array<float,2>{0.341269583f, 0.410639822f},
-std::array<float,2>{0.583962977f, 0.526306748f},
-std::array<float,2>{0.967434108f, 0.210338697f},
-std::array<float,2>{0.0403817073f, 0.80149585f},
-std::array<float,2>{0.143255726f, 0.302422196f},
-std::array<float,2>{0.781518996f, 0.702643156f},
-std::array<float,2>{0.729785383f, 0.0135976439f},
-std::array<float,2>{0.472613126f, 0.964717329f},
-std::array<float,2>{0.334240019f, 0.139308989f},
-std::array<float,2>{0.591247439f, 0.845299721f},
-std::array<float,2>{0.953231871f, 0.454524398f},
-std::array<float,2>{0.0352331772f, 0.620083511f},
-std::array<float,2>{0.115578905f, 0.0769891068f},
-std::array<float,2>{0.881080508f, 0.912972212f},
-std::array<float,2>{0.53154248f, 0.315585226f},
-std::array<float,2>{0.264036059f, 0.626010954f},
-std::array<float,2>{0.421179414f, 0.426183671f},
-std::array<float,2>{0.648115814f, 0.509602368f},
-std::array<float,2>{0.871624112f, 0.200117856f},
-std::array<float,2>{0.191296786f, 0.786377728f},
-std::array<float,2>{0.0114596197f, 0.473989397f},
-std::array<float,2>{0.969532609f, 0.564943373f},
-std::array<float,2>{0.61718744f, 0.181422949f},
-std::array<float,2>{0.373440266f, 0.840094924f},
-std::array<float,2>{0.440230429f, 0.0322884358f},
-std::array<float,2>{0.695604622f, 0.989638984f},
-std::array<float,2>{0.753435612f, 0.252595961f},
-std::array<float,2>{0.157676861f, 0.720568776f},
-std::array<float,2>{0.247478694f, 0.232571632f},
-std::array<float,2>{0.814278364f, 0.778684855f},
-std::array<float,2>{0.677036047f, 0.388556093f},
-std::array<float,2>{0.405153573f, 0.550675929f},
-std::array<float,2>{0.283132344f, 0.369822741f},
-std::array<float,2>{0.528294086f, 0.658683419f},
-std::array<float,2>{0.91002208f, 0.110194974f},
-std::array<float,2>{0.0723836571f, 0.889994383f},
-std::array<float,2>{0.208465248f, 0.403495193f},
-std::array<float,2>{0.858727098f, 0.539940655f},
-std::array<float,2>{0.630843759f, 0.236296177f},
-std::array<float,2>{0.4302378f, 0.764687896f},
-std::array<float,2>{0.274928838f, 0.103262819f},
-std::array<float,2>{0.550032735f, 0.893176198f},
-std::array<float,2>{0.892080665f, 0.349825114f},
-std::array<float,2>{0.10913451f, 0.682053089f},
-std::array<float,2>{0.050985463f, 0.167291656f},
-std::array<float,2>{0.949501157f, 0.825968266f},
-std::array<float,2>{0.572737277f, 0.485970855f},
-std::array<float,2>{0.316648781f, 0.584583819f},
-std::array<float,2>{0.488850802f, 0.275526315f},
-std::array<float,2>{0.745901704f, 0.736843109f},
-std::array<float,2>{0.808880866f, 0.0530996732f},
-std::array<float,2>{0.134434804f, 0.979653895f},
-std::array<float,2>{0.0913671851f, 0.336943507f},
-std::array<float,2>{0.929135978f, 0.642580509f},
-std::array<float,2>{0.500503361f, 0.0805283338f},
-std::array<float,2>{0.307282507f, 0.93085283f},
-std::array<float,2>{0.380714387f, 0.205661446f},
-std::array<float,2>{0.664186954f, 0.799582541f},
-std::array<float,2>{0.831002772f, 0.407619178f},
-std::array<float,2>{0.228163764f, 0.531098187f},
-std::array<float,2>{0.175363749f, 0.0211624168f},
-std::array<float,2>{0.768232942f, 0.944967151f},
-std::array<float,2>{0.714702785f, 0.281476289f},
-std::array<float,2>{0.467117816f, 0.713748813f},
-std::array<float,2>{0.358564973f, 0.443232059f},
-std::array<float,2>{0.604410887f, 0.603647172f},
-std::array<float,2>{0.989549279f, 0.145839363f},
-std::array<float,2>{0.0230754614f, 0.864535451f},
-std::array<float,2>{0.221230581f, 0.352426678f},
-std::array<float,2>{0.839390099f, 0.679272354f},
-std::array<float,2>{0.658283174f, 0.0953689367f},
-std::array<float,2>{0.390158385f, 0.903973222f},
-std::array<float,2>{0.296922863f, 0.245734543f},
-std::array<float,2>{0.512298107f, 0.754925668f},
-std::array<float,2>{0.934954822f, 0.393842548f},
-std::array<float,2>{0.0827192739f, 0.539026916f},
-std::array<float,2>{0.0262458734f, 0.0611222722f},
-std::array<float,2>{0.996383131f, 0.969319403f},
-std::array<float,2>{0.595216393f, 0.269980252f},
-std::array<float,2>{0.347242087f, 0.74671334f},
-std::array<float,2>{0.460337967f, 0.495637238f},
-std::array<float,2>{0.709357619f, 0.590019703f},
-std::array<float,2>{0.773617148f, 0.156877831f},
-std::array<float,2>{0.185679078f, 0.819513679f},
-std::array<float,2>{0.0948870182f, 0.419093937f},
-std::array<float,2>{0.904243469f, 0.519595146f},
-std::array<float,2>{0.557346523f, 0.217723668f},
-std::array<float,2>{0.265743703f, 0.810308874f},
-std::array<float,2>{0.42628479f, 0.0907095298f},
-std::array<float,2>{0.637371659f, 0.92572093f},
-std::array<float,2>{0.847047925f, 0.333249241f},
-std::array<float,2>{0.211896017f, 0.650690496f},
-std::array<float,2>{0.130737334f, 0.148839906f},
-std::array<float,2>{0.801669121f, 0.871767104f},
-std::array<float,2>{0.742022693f, 0.445457488f},
-std::array<float,2>{0.492488086f, 0.597045183f},
-std::array<float,2>{0.322615713f, 0.290421724f},
-std::array<float,2>{0.569317937f, 0.708812833f},
-std::array<float,2>{0.938079834f, 0.0281901099f},
-std::array<float,2>{0.0572596565f, 0.951230645f},
-std::array<float,2>{0.16851674f, 0.462242961f},
-std::array<float,2>{0.760933697f, 0.611164451f},
-std::array<float,2>{0.688183248f, 0.125235081f},
-std::array<float,2>{0.448739678f, 0.858689189f},
-std::array<float,2>{0.361294806f, 0.00671449676f},
-std::array<float,2>{0.617731512f, 0.957207918f},
-std::array<float,2>{0.978861272f, 0.307921916f},
-std::array<float,2>{0.00392953726f, 0.688920975f},
-std::array<float,2>{0.0627324805f, 0.189225212f},
-std::array<float,2>{0.920583367f, 0.796257913f},
-std::array<float,2>{0.522994518f, 0.433596045f},
-std::array<float,2>{0.295529932f, 0.501672387f},
-std::array<float,2>{0.396514118f, 0.32173562f},
-std::array<float,2>{0.687015951f, 0.63569361f},
-std::array<float,2>{0.821091771f, 0.0689872578f},
-std::array<float,2>{0.235381216f, 0.917722404f},
-std::array<float,2>{0.0455149487f, 0.261230469f},
-std::array<float,2>{0.962677777f, 0.729158521f},
-std::array<float,2>{0.581659198f, 0.0391268432f},
-std::array<float,2>{0.338093877f, 0.993181884f},
-std::array<float,2>{0.483361989f, 0.175538942f},
-std::array<float,2>{0.719313741f, 0.834091783f},
-std::array<float,2>{0.791622698f, 0.477812618f},
-std::array<float,2>{0.153664544f, 0.571672916f},
-std::array<float,2>{0.200259894f, 0.121978335f},
-std::array<float,2>{0.865142345f, 0.879714727f},
-std::array<float,2>{0.649841845f, 0.359531075f},
-std::array<float,2>{0.413146138f, 0.668192863f},
-std::array<float,2>{0.254276603f, 0.37738806f},
-std::array<float,2>{0.542716742f, 0.55987668f},
-std::array<float,2>{0.888003409f, 0.225174859f},
-std::array<float,2>{0.120104805f, 0.768476367f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.109989472f, 0.955937624f},
-std::array<float,2>{0.655184984f, 0.363834083f},
-std::array<float,2>{0.77789104f, 0.591770172f},
-std::array<float,2>{0.334964424f, 0.244021431f},
-std::array<float,2>{0.414425582f, 0.703836381f},
-std::array<float,2>{0.905467391f, 0.0533248335f},
-std::array<float,2>{0.575296938f, 0.845905066f},
-std::array<float,2>{0.152909964f, 0.484157413f},
-std::array<float,2>{0.288889855f, 0.782758772f},
-std::array<float,2>{0.867940068f, 0.391442478f},
-std::array<float,2>{0.740383089f, 0.650191247f},
-std::array<float,2>{0.0324760936f, 0.0819649845f},
-std::array<float,2>{0.228948206f, 0.550189614f},
-std::array<float,2>{0.527148306f, 0.153804943f},
-std::array<float,2>{0.961153448f, 0.903378308f},
-std::array<float,2>{0.461294025f, 0.293938547f},
-std::array<float,2>{0.18044056f, 0.822448075f},
-std::array<float,2>{0.594556868f, 0.452633232f},
-std::array<float,2>{0.910231769f, 0.7493065f},
-std::array<float,2>{0.393932462f, 0.030924147f},
-std::array<float,2>{0.365948528f, 0.621482313f},
-std::array<float,2>{0.805774808f, 0.195392311f},
-std::array<float,2>{0.678526282f, 0.978480637f},
-std::array<float,2>{0.0697205812f, 0.32121098f},
-std::array<float,2>{0.47060281f, 0.928298891f},
-std::array<float,2>{0.985767186f, 0.274804473f},
-std::array<float,2>{0.539325178f, 0.526190579f},
-std::array<float,2>{0.214289725f, 0.169700801f},
-std::array<float,2>{0.00337532256f, 0.676692426f},
-std::array<float,2>{0.69749254f, 0.120982513f},
-std::array<float,2>{0.832243621f, 0.769490123f},
-std::array<float,2>{0.259908199f, 0.414419681f},
-std::array<float,2>{0.0475644022f, 0.754615188f},
-std::array<float,2>{0.732013643f, 0.431375712f},
-std::array<float,2>{0.851339877f, 0.660201669f},
-std::array<float,2>{0.312396318f, 0.0955545828f},
-std::array<float,2>{0.438288331f, 0.510022163f},
-std::array<float,2>{0.946464062f, 0.178827554f},
-std::array<float,2>{0.511146665f, 0.907539129f},
-std::array<float,2>{0.244147941f, 0.265295357f},
-std::array<float,2>{0.324968904f, 0.994134784f},
-std::array<float,2>{0.754844666f, 0.330295354f},
-std::array<float,2>{0.62797904f, 0.595725358f},
-std::array<float,2>{0.095428735f, 0.217993975f},
-std::array<float,2>{0.133353233f, 0.723949909f},
-std::array<float,2>{0.578276634f, 0.000528726843f},
-std::array<float,2>{0.883043289f, 0.83527565f},
-std::array<float,2>{0.42256543f, 0.460612476f},
-std::array<float,2>{0.199825242f, 0.878746808f},
-std::array<float,2>{0.553957403f, 0.301468194f},
-std::array<float,2>{0.96955061f, 0.536278486f},
-std::array<float,2>{0.492560774f, 0.137041494f},
-std::array<float,2>{0.269247681f, 0.640498638f},
-std::array<float,2>{0.822037518f, 0.076508604f},
-std::array<float,2>{0.707693994f, 0.796907783f},
-std::array<float,2>{0.0157713983f, 0.381982356f},
-std::array<float,2>{0.388272405f, 0.871001184f},
-std::array<float,2>{0.926763177f, 0.485581964f},
-std::array<float,2>{0.609555244f, 0.69219631f},
-std::array<float,2>{0.1639494f, 0.0353101678f},
-std::array<float,2>{0.0822855905f, 0.572122097f},
-std::array<float,2>{0.671682179f, 0.221003175f},
-std::array<float,2>{0.781462789f, 0.952899337f},
-std::array<float,2>{0.343819708f, 0.347645909f},
-std::array<float,2>{0.0306498799f, 0.918523014f},
-std::array<float,2>{0.714430571f, 0.257532001f},
-std::array<float,2>{0.814938724f, 0.50401783f},
-std::array<float,2>{0.278268069f, 0.180534527f},
-std::array<float,2>{0.484947413f, 0.66643393f},
-std::array<float,2>{0.979724288f, 0.105720147f},
-std::array<float,2>{0.560798705f, 0.758465767f},
-std::array<float,2>{0.194092453f, 0.422986478f},
-std::array<float,2>{0.358159274f, 0.836640716f},
-std::array<float,2>{0.792722821f, 0.462584764f},
-std::array<float,2>{0.662486136f, 0.730681658f},
-std::array<float,2>{0.0915622339f, 0.0121887019f},
-std::array<float,2>{0.164109528f, 0.602474749f},
-std::array<float,2>{0.62305671f, 0.207487881f},
-std::array<float,2>{0.935093582f, 0.990467548f},
-std::array<float,2>{0.379832655f, 0.338153213f},
-std::array<float,2>{0.238494068f, 0.807480872f},
-std::array<float,2>{0.501248896f, 0.38741526f},
-std::array<float,2>{0.941114128f, 0.628754318f},
-std::array<float,2>{0.446671516f, 0.0702330619f},
-std::array<float,2>{0.304094821f, 0.546650946f},
-std::array<float,2>{0.853836536f, 0.129679337f},
-std::array<float,2>{0.721671343f, 0.885706723f},
-std::array<float,2>{0.0604753383f, 0.31153062f},
-std::array<float,2>{0.432089895f, 0.939787984f},
-std::array<float,2>{0.877522707f, 0.355303526f},
-std::array<float,2>{0.593245685f, 0.570028305f},
-std::array<float,2>{0.128852829f, 0.232535928f},
-std::array<float,2>{0.103212632f, 0.701657474f},
-std::array<float,2>{0.637654781f, 0.0432367139f},
-std::array<float,2>{0.765615225f, 0.863318026f},
-std::array<float,2>{0.313862771f, 0.499132842f},
-std::array<float,2>{0.0715309903f, 0.858788252f},
-std::array<float,2>{0.681418598f, 0.473419189f},
-std::array<float,2>{0.79835248f, 0.716854274f},
-std::array<float,2>{0.373232812f, 0.057296399f},
-std::array<float,2>{0.399238467f, 0.580616295f},
-std::array<float,2>{0.921506286f, 0.236266196f},
-std::array<float,2>{0.601917505f, 0.961615086f},
-std::array<float,2>{0.175694659f, 0.37093541f},
-std::array<float,2>{0.255184382f, 0.897869289f},
-std::array<float,2>{0.837601006f, 0.283933073f},
-std::array<float,2>{0.689196289f, 0.557181478f},
-std::array<float,2>{0.0148530621f, 0.146772593f},
-std::array<float,2>{0.205712572f, 0.647546113f},
-std::array<float,2>{0.536481977f, 0.0919824839f},
-std::array<float,2>{0.997223079f, 0.793051362f},
-std::array<float,2>{0.483109772f, 0.405340135f},
-std::array<float,2>{0.142787918f, 0.976176977f},
-std::array<float,2>{0.565741658f, 0.317400664f},
-std::array<float,2>{0.895367861f, 0.610442758f},
-std::array<float,2>{0.413794041f, 0.18810454f},
-std::array<float,2>{0.341310233f, 0.739124894f},
-std::array<float,2>{0.767612278f, 0.0211588386f},
-std::array<float,2>{0.64503026f, 0.814579427f},
-std::array<float,2>{0.120873503f, 0.44167158f},
-std::array<float,2>{0.453926772f, 0.776437283f},
-std::array<float,2>{0.960768223f, 0.411543697f},
-std::array<float,2>{0.519308805f, 0.685064375f},
-std::array<float,2>{0.219975144f, 0.110415317f},
-std::array<float,2>{0.045571439f, 0.52327311f},
-std::array<float,2>{0.748723984f, 0.161015332f},
-std::array<float,2>{0.859889746f, 0.929773152f},
-std::array<float,2>{0.296447814f, 0.270712852f},
-std::array<float,2>{0.0860188082f, 0.898501396f},
-std::array<float,2>{0.657076001f, 0.28955847f},
-std::array<float,2>{0.795700908f, 0.552675247f},
-std::array<float,2>{0.353176594f, 0.149863616f},
-std::array<float,2>{0.377626181f, 0.654527605f},
-std::array<float,2>{0.932325542f, 0.0855737776f},
-std::array<float,2>{0.619568229f, 0.786625266f},
-std::array<float,2>{0.168295562f, 0.39805761f},
-std::array<float,2>{0.27521652f, 0.850497723f},
-std::array<float,2>{0.818390727f, 0.477438062f},
-std::array<float,2>{0.71678555f, 0.709796309f},
-std::array<float,2>{0.0243792199f, 0.0503475443f},
-std::array<float,2>{0.190814063f, 0.585955858f},
-std::array<float,2>{0.555831134f, 0.248134181f},
-std::array<float,2>{0.981762111f, 0.958925307f},
-std::array<float,2>{0.488346487f, 0.359684914f},
-std::array<float,2>{0.132419437f, 0.773347557f},
-std::array<float,2>{0.589165092f, 0.420687467f},
-std::array<float,2>{0.881582201f, 0.673984289f},
-std::array<float,2>{0.434799552f, 0.123120189f},
-std::array<float,2>{0.318578154f, 0.530012548f},
-std::array<float,2>{0.758511841f, 0.164915621f},
-std::array<float,2>{0.636516511f, 0.922382951f},
-std::array<float,2>{0.107883818f, 0.280462176f},
-std::array<float,2>{0.452031195f, 0.983575821f},
-std::array<float,2>{0.942080677f, 0.328106701f},
-std::array<float,2>{0.506900072f, 0.618178308f},
-std::array<float,2>{0.235270172f, 0.200393751f},
-std::array<float,2>{0.058044266f, 0.744465172f},
-std::array<float,2>{0.722687662f, 0.0256602243f},
-std::array<float,2>{0.857125163f, 0.827556729f},
-std::array<float,2>{0.29775697f, 0.447235733f},
-std::array<float,2>{0.00836036447f, 0.830043375f},
-std::array<float,2>{0.692528069f, 0.454736024f},
-std::array<float,2>{0.842665732f, 0.719424844f},
-std::array<float,2>{0.250873893f, 0.006182326f},
-std::array<float,2>{0.479102731f, 0.598862708f},
-std::array<float,2>{0.994477451f, 0.211243629f},
-std::array<float,2>{0.533663511f, 0.999429226f},
-std::array<float,2>{0.21013543f, 0.335030913f},
-std::array<float,2>{0.36958307f, 0.911484241f},
-std::array<float,2>{0.803536236f, 0.260647327f},
-std::array<float,2>{0.683743656f, 0.512492776f},
-std::array<float,2>{0.0757422671f, 0.174731165f},
-std::array<float,2>{0.175995082f, 0.659415185f},
-std::array<float,2>{0.607472181f, 0.0978231058f},
-std::array<float,2>{0.916377664f, 0.751382172f},
-std::array<float,2>{0.405771732f, 0.433715194f},
-std::array<float,2>{0.225042135f, 0.947600245f},
-std::array<float,2>{0.52230674f, 0.34950462f},
-std::array<float,2>{0.955549479f, 0.574953675f},
-std::array<float,2>{0.460714966f, 0.226483583f},
-std::array<float,2>{0.292929739f, 0.687893152f},
-std::array<float,2>{0.866777599f, 0.0342302844f},
-std::array<float,2>{0.743786335f, 0.87164861f},
-std::array<float,2>{0.0410704687f, 0.490740746f},
-std::array<float,2>{0.407884985f, 0.802293718f},
-std::array<float,2>{0.892383039f, 0.375280797f},
-std::array<float,2>{0.566513658f, 0.635462224f},
-std::array<float,2>{0.145767719f, 0.0727978349f},
-std::array<float,2>{0.123104692f, 0.531361163f},
-std::array<float,2>{0.643692017f, 0.1332791f},
-std::array<float,2>{0.771924078f, 0.878963172f},
-std::array<float,2>{0.338983774f, 0.300190061f},
-std::array<float,2>{0.0362143144f, 0.98813808f},
-std::array<float,2>{0.735889852f, 0.341120571f},
-std::array<float,2>{0.873322368f, 0.608852923f},
-std::array<float,2>{0.283998907f, 0.203508884f},
-std::array<float,2>{0.466828465f, 0.726634562f},
-std::array<float,2>{0.967819691f, 0.00993430708f},
-std::array<float,2>{0.530102253f, 0.842871487f},
-std::array<float,2>{0.231472731f, 0.465678871f},
-std::array<float,2>{0.330806643f, 0.763838887f},
-std::array<float,2>{0.776161969f, 0.429305434f},
-std::array<float,2>{0.650977194f, 0.66954565f},
-std::array<float,2>{0.115013182f, 0.101950832f},
-std::array<float,2>{0.151554853f, 0.502884448f},
-std::array<float,2>{0.571675003f, 0.18449989f},
-std::array<float,2>{0.900255919f, 0.916936874f},
-std::array<float,2>{0.420673728f, 0.251301736f},
-std::array<float,2>{0.215273917f, 0.862534642f},
-std::array<float,2>{0.544848919f, 0.494307876f},
-std::array<float,2>{0.991549432f, 0.695411921f},
-std::array<float,2>{0.476364672f, 0.0429176055f},
-std::array<float,2>{0.265527606f, 0.565444827f},
-std::array<float,2>{0.828191221f, 0.229059339f},
-std::array<float,2>{0.69986701f, 0.943967521f},
-std::array<float,2>{0.00429004803f, 0.356480986f},
-std::array<float,2>{0.395376325f, 0.887946308f},
-std::array<float,2>{0.909026086f, 0.305477738f},
-std::array<float,2>{0.598831117f, 0.542732298f},
-std::array<float,2>{0.186094582f, 0.125694945f},
-std::array<float,2>{0.063308619f, 0.628953338f},
-std::array<float,2>{0.674015582f, 0.066341266f},
-std::array<float,2>{0.809519768f, 0.80979228f},
-std::array<float,2>{0.359811157f, 0.385295212f},
-std::array<float,2>{0.0991275385f, 0.789924085f},
-std::array<float,2>{0.629300594f, 0.40061909f},
-std::array<float,2>{0.753802419f, 0.643938065f},
-std::array<float,2>{0.32199043f, 0.0873649269f},
-std::array<float,2>{0.429335445f, 0.560673118f},
-std::array<float,2>{0.888764679f, 0.141480982f},
-std::array<float,2>{0.583950996f, 0.892519832f},
-std::array<float,2>{0.137663424f, 0.286975712f},
-std::array<float,2>{0.306290805f, 0.967441142f},
-std::array<float,2>{0.845119536f, 0.374692023f},
-std::array<float,2>{0.72880584f, 0.582969189f},
-std::array<float,2>{0.0529401414f, 0.241342977f},
-std::array<float,2>{0.247701526f, 0.711081266f},
-std::array<float,2>{0.514051557f, 0.0595128797f},
-std::array<float,2>{0.952352464f, 0.852171242f},
-std::array<float,2>{0.444319993f, 0.469652802f},
-std::array<float,2>{0.158576012f, 0.936089337f},
-std::array<float,2>{0.614722371f, 0.266368151f},
-std::array<float,2>{0.922627389f, 0.51563406f},
-std::array<float,2>{0.38424024f, 0.159950972f},
-std::array<float,2>{0.34808293f, 0.682135999f},
-std::array<float,2>{0.785926044f, 0.114880726f},
-std::array<float,2>{0.667135298f, 0.778986573f},
-std::array<float,2>{0.080233708f, 0.408259362f},
-std::array<float,2>{0.497590899f, 0.820140541f},
-std::array<float,2>{0.97463268f, 0.440206051f},
-std::array<float,2>{0.548992276f, 0.737513721f},
-std::array<float,2>{0.199113816f, 0.0162735544f},
-std::array<float,2>{0.0233481713f, 0.616919935f},
-std::array<float,2>{0.70316422f, 0.193504661f},
-std::array<float,2>{0.82792002f, 0.970874667f},
-std::array<float,2>{0.271944791f, 0.315788567f},
-std::array<float,2>{0.0676917806f, 0.978752851f},
-std::array<float,2>{0.677273571f, 0.32237038f},
-std::array<float,2>{0.807584763f, 0.624317348f},
-std::array<float,2>{0.365000457f, 0.197969019f},
-std::array<float,2>{0.392392188f, 0.746259153f},
-std::array<float,2>{0.912120342f, 0.0278765243f},
-std::array<float,2>{0.596641541f, 0.822061718f},
-std::array<float,2>{0.182936922f, 0.450898677f},
-std::array<float,2>{0.259166032f, 0.76635313f},
-std::array<float,2>{0.835195959f, 0.416515946f},
-std::array<float,2>{0.696965396f, 0.677770674f},
-std::array<float,2>{0.000702067569f, 0.118020594f},
-std::array<float,2>{0.212284595f, 0.524187803f},
-std::array<float,2>{0.542838871f, 0.171593502f},
-std::array<float,2>{0.988127291f, 0.926288009f},
-std::array<float,2>{0.471916378f, 0.277144462f},
-std::array<float,2>{0.154447138f, 0.845246851f},
-std::array<float,2>{0.577860236f, 0.480689675f},
-std::array<float,2>{0.903153062f, 0.705100417f},
-std::array<float,2>{0.416857868f, 0.0511293001f},
-std::array<float,2>{0.332913697f, 0.593726635f},
-std::array<float,2>{0.779712975f, 0.24536255f},
-std::array<float,2>{0.653908968f, 0.954405785f},
-std::array<float,2>{0.111684009f, 0.366022408f},
-std::array<float,2>{0.463609189f, 0.904783964f},
-std::array<float,2>{0.964636624f, 0.295583576f},
-std::array<float,2>{0.523629487f, 0.54754734f},
-std::array<float,2>{0.228190139f, 0.155544043f},
-std::array<float,2>{0.0337096564f, 0.650815964f},
-std::array<float,2>{0.738313615f, 0.078346774f},
-std::array<float,2>{0.869740546f, 0.784321725f},
-std::array<float,2>{0.285726607f, 0.393884569f},
-std::array<float,2>{0.017973382f, 0.799930871f},
-std::array<float,2>{0.709982872f, 0.380546957f},
-std::array<float,2>{0.82384187f, 0.637432575f},
-std::array<float,2>{0.267229915f, 0.0761369616f},
-std::array<float,2>{0.495295674f, 0.537538528f},
-std::array<float,2>{0.97128284f, 0.139849886f},
-std::array<float,2>{0.552628398f, 0.87562573f},
-std::array<float,2>{0.203085467f, 0.304537028f},
-std::array<float,2>{0.347349077f, 0.950024486f},
-std::array<float,2>{0.784645796f, 0.344233781f},
-std::array<float,2>{0.669611692f, 0.572820485f},
-std::array<float,2>{0.0844716951f, 0.220503896f},
-std::array<float,2>{0.160179064f, 0.694243968f},
-std::array<float,2>{0.612249434f, 0.0381824709f},
-std::array<float,2>{0.929160833f, 0.868040144f},
-std::array<float,2>{0.390045136f, 0.48792547f},
-std::array<float,2>{0.243536055f, 0.909801245f},
-std::array<float,2>{0.507863522f, 0.262602091f},
-std::array<float,2>{0.947556555f, 0.508041799f},
-std::array<float,2>{0.439721972f, 0.176089257f},
-std::array<float,2>{0.308763832f, 0.662479639f},
-std::array<float,2>{0.848994732f, 0.0973814502f},
-std::array<float,2>{0.732593119f, 0.756401241f},
-std::array<float,2>{0.0492272004f, 0.432377636f},
-std::array<float,2>{0.425034493f, 0.832677543f},
-std::array<float,2>{0.885488331f, 0.458775073f},
-std::array<float,2>{0.580432892f, 0.725360274f},
-std::array<float,2>{0.135007143f, 0.0030548647f},
-std::array<float,2>{0.0962987021f, 0.595475018f},
-std::array<float,2>{0.625493109f, 0.216198891f},
-std::array<float,2>{0.757748604f, 0.994684339f},
-std::array<float,2>{0.327025145f, 0.328213423f},
-std::array<float,2>{0.0606818795f, 0.884291589f},
-std::array<float,2>{0.720096409f, 0.309356809f},
-std::array<float,2>{0.851629555f, 0.54490912f},
-std::array<float,2>{0.30237788f, 0.132065415f},
-std::array<float,2>{0.448020846f, 0.626903594f},
-std::array<float,2>{0.938513398f, 0.0672129393f},
-std::array<float,2>{0.502115667f, 0.806006134f},
-std::array<float,2>{0.241977423f, 0.388689101f},
-std::array<float,2>{0.316260427f, 0.866236985f},
-std::array<float,2>{0.762313843f, 0.49677211f},
-std::array<float,2>{0.639607549f, 0.69929868f},
-std::array<float,2>{0.105226904f, 0.0453376994f},
-std::array<float,2>{0.126866147f, 0.567921162f},
-std::array<float,2>{0.590444326f, 0.231835946f},
-std::array<float,2>{0.876208603f, 0.938138366f},
-std::array<float,2>{0.430951804f, 0.35233143f},
-std::array<float,2>{0.19292447f, 0.760069072f},
-std::array<float,2>{0.559167862f, 0.425531864f},
-std::array<float,2>{0.977634072f, 0.665461004f},
-std::array<float,2>{0.486758858f, 0.108891383f},
-std::array<float,2>{0.280629605f, 0.50641942f},
-std::array<float,2>{0.812601805f, 0.183237523f},
-std::array<float,2>{0.711257577f, 0.920562267f},
-std::array<float,2>{0.0279123541f, 0.255427331f},
-std::array<float,2>{0.382430345f, 0.988879561f},
-std::array<float,2>{0.936487257f, 0.336571246f},
-std::array<float,2>{0.622186363f, 0.605438232f},
-std::array<float,2>{0.166447401f, 0.209624618f},
-std::array<float,2>{0.0926153585f, 0.734176636f},
-std::array<float,2>{0.660274923f, 0.0143099865f},
-std::array<float,2>{0.789302528f, 0.839083612f},
-std::array<float,2>{0.356213212f, 0.463107795f},
-std::array<float,2>{0.118162498f, 0.812641919f},
-std::array<float,2>{0.648369133f, 0.445207357f},
-std::array<float,2>{0.766581059f, 0.741025984f},
-std::array<float,2>{0.343291163f, 0.021488566f},
-std::array<float,2>{0.410240501f, 0.612723947f},
-std::array<float,2>{0.898362994f, 0.189464629f},
-std::array<float,2>{0.562768936f, 0.974503219f},
-std::array<float,2>{0.141165406f, 0.320047677f},
-std::array<float,2>{0.29320851f, 0.93298173f},
-std::array<float,2>{0.862265587f, 0.273174047f},
-std::array<float,2>{0.747688711f, 0.51964277f},
-std::array<float,2>{0.0448431671f, 0.162118226f},
-std::array<float,2>{0.22239697f, 0.686891019f},
-std::array<float,2>{0.516867995f, 0.112160437f},
-std::array<float,2>{0.958441436f, 0.774187803f},
-std::array<float,2>{0.4566392f, 0.413533092f},
-std::array<float,2>{0.172144085f, 0.964059114f},
-std::array<float,2>{0.604001939f, 0.368504077f},
-std::array<float,2>{0.91936636f, 0.579449475f},
-std::array<float,2>{0.40201205f, 0.238132268f},
-std::array<float,2>{0.371473998f, 0.715100706f},
-std::array<float,2>{0.800096512f, 0.0564375408f},
-std::array<float,2>{0.68309027f, 0.856552184f},
-std::array<float,2>{0.0741632283f, 0.475612849f},
-std::array<float,2>{0.481426716f, 0.795671284f},
-std::array<float,2>{0.99843955f, 0.403970301f},
-std::array<float,2>{0.537604749f, 0.644964695f},
-std::array<float,2>{0.204349756f, 0.0916386768f},
-std::array<float,2>{0.0122533729f, 0.55571425f},
-std::array<float,2>{0.689895153f, 0.146008387f},
-std::array<float,2>{0.837973833f, 0.8961882f},
-std::array<float,2>{0.256651998f, 0.2825993f},
-std::array<float,2>{0.107080735f, 0.923888564f},
-std::array<float,2>{0.63383007f, 0.277652264f},
-std::array<float,2>{0.761503339f, 0.527482271f},
-std::array<float,2>{0.316619694f, 0.167601094f},
-std::array<float,2>{0.436125755f, 0.672915578f},
-std::array<float,2>{0.879464269f, 0.121131144f},
-std::array<float,2>{0.586447656f, 0.769964576f},
-std::array<float,2>{0.129271314f, 0.418234468f},
-std::array<float,2>{0.299731046f, 0.825647354f},
-std::array<float,2>{0.859028339f, 0.447413236f},
-std::array<float,2>{0.726322412f, 0.743365884f},
-std::array<float,2>{0.0556064658f, 0.0239015892f},
-std::array<float,2>{0.237659127f, 0.620300174f},
-std::array<float,2>{0.50405246f, 0.203064054f},
-std::array<float,2>{0.943578839f, 0.981337428f},
-std::array<float,2>{0.450357914f, 0.32587266f},
-std::array<float,2>{0.170175061f, 0.78720963f},
-std::array<float,2>{0.617229283f, 0.396475822f},
-std::array<float,2>{0.931089044f, 0.652514279f},
-std::array<float,2>{0.376351357f, 0.0827982053f},
-std::array<float,2>{0.354784667f, 0.553313076f},
-std::array<float,2>{0.794480503f, 0.152151346f},
-std::array<float,2>{0.658272266f, 0.901896119f},
-std::array<float,2>{0.0881867036f, 0.292031854f},
-std::array<float,2>{0.491672695f, 0.960457563f},
-std::array<float,2>{0.983422756f, 0.363075495f},
-std::array<float,2>{0.557138681f, 0.589598179f},
-std::array<float,2>{0.188082621f, 0.246524885f},
-std::array<float,2>{0.0254284889f, 0.708816648f},
-std::array<float,2>{0.717290401f, 0.0470649302f},
-std::array<float,2>{0.816830039f, 0.84922111f},
-std::array<float,2>{0.276139289f, 0.479255378f},
-std::array<float,2>{0.0401692912f, 0.873230755f},
-std::array<float,2>{0.744469643f, 0.489894718f},
-std::array<float,2>{0.863907397f, 0.69094044f},
-std::array<float,2>{0.290221661f, 0.0315343738f},
-std::array<float,2>{0.458659947f, 0.577677429f},
-std::array<float,2>{0.953873456f, 0.223363221f},
-std::array<float,2>{0.520665348f, 0.945717514f},
-std::array<float,2>{0.223856688f, 0.349750757f},
-std::array<float,2>{0.336537063f, 0.882065833f},
-std::array<float,2>{0.769820452f, 0.297584653f},
-std::array<float,2>{0.641910017f, 0.533957839f},
-std::array<float,2>{0.122676991f, 0.135824889f},
-std::array<float,2>{0.147238538f, 0.634741187f},
-std::array<float,2>{0.568984091f, 0.0721305758f},
-std::array<float,2>{0.894352913f, 0.803956985f},
-std::array<float,2>{0.408630818f, 0.37780112f},
-std::array<float,2>{0.208946019f, 0.996935666f},
-std::array<float,2>{0.532320857f, 0.333093822f},
-std::array<float,2>{0.992673516f, 0.601372123f},
-std::array<float,2>{0.478464395f, 0.214347959f},
-std::array<float,2>{0.252141297f, 0.721814692f},
-std::array<float,2>{0.840826511f, 0.00437000953f},
-std::array<float,2>{0.69376719f, 0.830931425f},
-std::array<float,2>{0.0100105079f, 0.45548746f},
-std::array<float,2>{0.402512938f, 0.753082514f},
-std::array<float,2>{0.915537596f, 0.436155707f},
-std::array<float,2>{0.606566072f, 0.658184588f},
-std::array<float,2>{0.178616405f, 0.100737795f},
-std::array<float,2>{0.0775360167f, 0.515293121f},
-std::array<float,2>{0.687149107f, 0.171918482f},
-std::array<float,2>{0.801823318f, 0.913120329f},
-std::array<float,2>{0.368711472f, 0.259712547f},
-std::array<float,2>{0.00699684955f, 0.942639709f},
-std::array<float,2>{0.701184213f, 0.359210551f},
-std::array<float,2>{0.831252992f, 0.56346041f},
-std::array<float,2>{0.262482464f, 0.228040829f},
-std::array<float,2>{0.473036677f, 0.697774291f},
-std::array<float,2>{0.98879528f, 0.0399027951f},
-std::array<float,2>{0.546727777f, 0.860381603f},
-std::array<float,2>{0.217744306f, 0.492524356f},
-std::array<float,2>{0.361860365f, 0.811549187f},
-std::array<float,2>{0.811653733f, 0.383199424f},
-std::array<float,2>{0.673065841f, 0.632790506f},
-std::array<float,2>{0.0650229082f, 0.0627433658f},
-std::array<float,2>{0.185331494f, 0.540641367f},
-std::array<float,2>{0.600069761f, 0.12785311f},
-std::array<float,2>{0.907558024f, 0.888881564f},
-std::array<float,2>{0.39764908f, 0.307496876f},
-std::array<float,2>{0.232646808f, 0.840599298f},
-std::array<float,2>{0.52755338f, 0.468166202f},
-std::array<float,2>{0.966736376f, 0.729396105f},
-std::array<float,2>{0.466577947f, 0.0085886959f},
-std::array<float,2>{0.281978875f, 0.606288493f},
-std::array<float,2>{0.872108042f, 0.205436647f},
-std::array<float,2>{0.737991154f, 0.985403776f},
-std::array<float,2>{0.0373266935f, 0.343125939f},
-std::array<float,2>{0.41812101f, 0.91575706f},
-std::array<float,2>{0.902227521f, 0.253592402f},
-std::array<float,2>{0.573093116f, 0.501234114f},
-std::array<float,2>{0.148758516f, 0.187242404f},
-std::array<float,2>{0.115453646f, 0.670452118f},
-std::array<float,2>{0.650336921f, 0.103994742f},
-std::array<float,2>{0.773597062f, 0.762810767f},
-std::array<float,2>{0.328457177f, 0.427506983f},
-std::array<float,2>{0.0799158663f, 0.779413581f},
-std::array<float,2>{0.664249599f, 0.407636613f},
-std::array<float,2>{0.787756085f, 0.680202246f},
-std::array<float,2>{0.349611849f, 0.115473188f},
-std::array<float,2>{0.384953707f, 0.518819451f},
-std::array<float,2>{0.925128698f, 0.156255379f},
-std::array<float,2>{0.616396248f, 0.934765339f},
-std::array<float,2>{0.157136261f, 0.268022954f},
-std::array<float,2>{0.271380901f, 0.969610095f},
-std::array<float,2>{0.824570596f, 0.313465923f},
-std::array<float,2>{0.707000434f, 0.613401413f},
-std::array<float,2>{0.0199492387f, 0.192792475f},
-std::array<float,2>{0.195513114f, 0.734426022f},
-std::array<float,2>{0.547443569f, 0.0192532763f},
-std::array<float,2>{0.973478734f, 0.816881597f},
-std::array<float,2>{0.498811066f, 0.437629372f},
-std::array<float,2>{0.139750674f, 0.893606246f},
-std::array<float,2>{0.58478266f, 0.287672043f},
-std::array<float,2>{0.887497127f, 0.559900701f},
-std::array<float,2>{0.427061677f, 0.144153148f},
-std::array<float,2>{0.322438031f, 0.641973555f},
-std::array<float,2>{0.751212001f, 0.0888298675f},
-std::array<float,2>{0.632591367f, 0.792849422f},
-std::array<float,2>{0.100008868f, 0.399360687f},
-std::array<float,2>{0.443136126f, 0.855407298f},
-std::array<float,2>{0.950051188f, 0.47084108f},
-std::array<float,2>{0.511728048f, 0.713721097f},
-std::array<float,2>{0.248414651f, 0.0607679859f},
-std::array<float,2>{0.0514689609f, 0.584015667f},
-std::array<float,2>{0.726956904f, 0.239391595f},
-std::array<float,2>{0.846111417f, 0.96510458f},
-std::array<float,2>{0.308064967f, 0.371918678f},
-std::array<float,2>{0.0942514613f, 0.995129049f},
-std::array<float,2>{0.627718151f, 0.330037564f},
-std::array<float,2>{0.755035639f, 0.593966126f},
-std::array<float,2>{0.325636238f, 0.215420052f},
-std::array<float,2>{0.423382998f, 0.726130068f},
-std::array<float,2>{0.88425988f, 0.0019811797f},
-std::array<float,2>{0.57922864f, 0.833850741f},
-std::array<float,2>{0.134662673f, 0.45773688f},
-std::array<float,2>{0.311032921f, 0.757025599f},
-std::array<float,2>{0.849860251f, 0.433338672f},
-std::array<float,2>{0.731335163f, 0.6637128f},
-std::array<float,2>{0.0480436534f, 0.096469149f},
-std::array<float,2>{0.245359123f, 0.50959456f},
-std::array<float,2>{0.509867251f, 0.1777329f},
-std::array<float,2>{0.945606172f, 0.908617139f},
-std::array<float,2>{0.438856125f, 0.263670743f},
-std::array<float,2>{0.1630079f, 0.868293643f},
-std::array<float,2>{0.610960305f, 0.486478269f},
-std::array<float,2>{0.926576436f, 0.69448936f},
-std::array<float,2>{0.387686998f, 0.0373124741f},
-std::array<float,2>{0.345404983f, 0.573914409f},
-std::array<float,2>{0.783202291f, 0.219279185f},
-std::array<float,2>{0.670511007f, 0.950924754f},
-std::array<float,2>{0.0836653039f, 0.344956875f},
-std::array<float,2>{0.493910462f, 0.876510799f},
-std::array<float,2>{0.970695794f, 0.303648859f},
-std::array<float,2>{0.553592265f, 0.538508654f},
-std::array<float,2>{0.200498387f, 0.139513031f},
-std::array<float,2>{0.0174174085f, 0.638110995f},
-std::array<float,2>{0.708764374f, 0.0743903518f},
-std::array<float,2>{0.821038187f, 0.799417078f},
-std::array<float,2>{0.268262178f, 0.37933448f},
-std::array<float,2>{0.0317693017f, 0.783935785f},
-std::array<float,2>{0.741475701f, 0.392961264f},
-std::array<float,2>{0.868236959f, 0.651471376f},
-std::array<float,2>{0.287230432f, 0.0799059421f},
-std::array<float,2>{0.462741017f, 0.548191369f},
-std::array<float,2>{0.962887347f, 0.154589862f},
-std::array<float,2>{0.525436521f, 0.906234622f},
-std::array<float,2>{0.229569316f, 0.296521306f},
-std::array<float,2>{0.334320456f, 0.95390445f},
-std::array<float,2>{0.779213309f, 0.367033958f},
-std::array<float,2>{0.655908406f, 0.592262685f},
-std::array<float,2>{0.111172222f, 0.244784594f},
-std::array<float,2>{0.153819859f, 0.706964195f},
-std::array<float,2>{0.575016499f, 0.0521522686f},
-std::array<float,2>{0.904818356f, 0.84455663f},
-std::array<float,2>{0.415517658f, 0.481584489f},
-std::array<float,2>{0.213663414f, 0.927525938f},
-std::array<float,2>{0.540871441f, 0.275652766f},
-std::array<float,2>{0.984857321f, 0.525027335f},
-std::array<float,2>{0.469540685f, 0.170165822f},
-std::array<float,2>{0.261485875f, 0.679656923f},
-std::array<float,2>{0.833078146f, 0.118470795f},
-std::array<float,2>{0.6987409f, 0.767216206f},
-std::array<float,2>{0.00231087161f, 0.417248964f},
-std::array<float,2>{0.393160194f, 0.820654571f},
-std::array<float,2>{0.911844552f, 0.44998318f},
-std::array<float,2>{0.594807982f, 0.747724295f},
-std::array<float,2>{0.181028724f, 0.0287072454f},
-std::array<float,2>{0.0687557757f, 0.623447835f},
-std::array<float,2>{0.678853571f, 0.199207753f},
-std::array<float,2>{0.804741144f, 0.98018539f},
-std::array<float,2>{0.367157131f, 0.32366237f},
-std::array<float,2>{0.0146446042f, 0.895160377f},
-std::array<float,2>{0.687801838f, 0.281971186f},
-std::array<float,2>{0.836688995f, 0.555088639f},
-std::array<float,2>{0.254476845f, 0.145367876f},
-std::array<float,2>{0.484003425f, 0.645927489f},
-std::array<float,2>{0.996331692f, 0.0904887393f},
-std::array<float,2>{0.535437047f, 0.795911849f},
-std::array<float,2>{0.206921101f, 0.403135866f},
-std::array<float,2>{0.374559402f, 0.856348574f},
-std::array<float,2>{0.797127426f, 0.475507468f},
-std::array<float,2>{0.680436492f, 0.716157377f},
-std::array<float,2>{0.0710455552f, 0.0554048456f},
-std::array<float,2>{0.173990756f, 0.578400075f},
-std::array<float,2>{0.603459299f, 0.236515447f},
-std::array<float,2>{0.920869768f, 0.963467896f},
-std::array<float,2>{0.399446696f, 0.367429465f},
-std::array<float,2>{0.219287872f, 0.774491787f},
-std::array<float,2>{0.517600536f, 0.412692875f},
-std::array<float,2>{0.959668577f, 0.685687065f},
-std::array<float,2>{0.454562366f, 0.113275692f},
-std::array<float,2>{0.294970423f, 0.521232009f},
-std::array<float,2>{0.860701561f, 0.163485482f},
-std::array<float,2>{0.749600351f, 0.932089031f},
-std::array<float,2>{0.046627868f, 0.271652609f},
-std::array<float,2>{0.412578344f, 0.973227739f},
-std::array<float,2>{0.896412611f, 0.31872043f},
-std::array<float,2>{0.564974129f, 0.611359835f},
-std::array<float,2>{0.144410953f, 0.190671042f},
-std::array<float,2>{0.119161651f, 0.741585553f},
-std::array<float,2>{0.646036863f, 0.0232989118f},
-std::array<float,2>{0.768824697f, 0.813826799f},
-std::array<float,2>{0.340103179f, 0.443716764f},
-std::array<float,2>{0.0905735269f, 0.838215113f},
-std::array<float,2>{0.663393974f, 0.464637309f},
-std::array<float,2>{0.791783094f, 0.733031213f},
-std::array<float,2>{0.358659536f, 0.0148493182f},
-std::array<float,2>{0.380253315f, 0.604003489f},
-std::array<float,2>{0.934197903f, 0.210038066f},
-std::array<float,2>{0.624190986f, 0.989665389f},
-std::array<float,2>{0.165663004f, 0.337849408f},
-std::array<float,2>{0.27845785f, 0.921430588f},
-std::array<float,2>{0.81564641f, 0.253917277f},
-std::array<float,2>{0.713176191f, 0.507597446f},
-std::array<float,2>{0.02957418f, 0.182291016f},
-std::array<float,2>{0.194637433f, 0.664094388f},
-std::array<float,2>{0.56247431f, 0.107907712f},
-std::array<float,2>{0.978790104f, 0.761654377f},
-std::array<float,2>{0.485918254f, 0.424051285f},
-std::array<float,2>{0.127279267f, 0.938675046f},
-std::array<float,2>{0.592643857f, 0.352726668f},
-std::array<float,2>{0.878242135f, 0.567084968f},
-std::array<float,2>{0.432640463f, 0.230922624f},
-std::array<float,2>{0.313049048f, 0.70086062f},
-std::array<float,2>{0.764449298f, 0.046614714f},
-std::array<float,2>{0.637997687f, 0.865828931f},
-std::array<float,2>{0.102055438f, 0.497873366f},
-std::array<float,2>{0.445703f, 0.805152774f},
-std::array<float,2>{0.939718723f, 0.390253663f},
-std::array<float,2>{0.500064313f, 0.62512809f},
-std::array<float,2>{0.240016744f, 0.0677051842f},
-std::array<float,2>{0.0593485758f, 0.543125331f},
-std::array<float,2>{0.721921325f, 0.131271869f},
-std::array<float,2>{0.855318308f, 0.883777738f},
-std::array<float,2>{0.3037f, 0.310474247f},
-std::array<float,2>{0.0749012232f, 0.912786305f},
-std::array<float,2>{0.684771836f, 0.258105606f},
-std::array<float,2>{0.804104984f, 0.514307797f},
-std::array<float,2>{0.370558321f, 0.172920644f},
-std::array<float,2>{0.404464424f, 0.656523168f},
-std::array<float,2>{0.917032301f, 0.0998707935f},
-std::array<float,2>{0.608520865f, 0.75292027f},
-std::array<float,2>{0.177310556f, 0.436564475f},
-std::array<float,2>{0.251773626f, 0.831538439f},
-std::array<float,2>{0.842824697f, 0.456112891f},
-std::array<float,2>{0.692328393f, 0.721090376f},
-std::array<float,2>{0.0096458951f, 0.00573949888f},
-std::array<float,2>{0.209897146f, 0.600142896f},
-std::array<float,2>{0.534724653f, 0.213747516f},
-std::array<float,2>{0.995305598f, 0.997276008f},
-std::array<float,2>{0.479924649f, 0.332896382f},
-std::array<float,2>{0.145407274f, 0.803286254f},
-std::array<float,2>{0.567565024f, 0.378518224f},
-std::array<float,2>{0.89077872f, 0.633406401f},
-std::array<float,2>{0.406808525f, 0.0709914416f},
-std::array<float,2>{0.33819294f, 0.53448689f},
-std::array<float,2>{0.773411691f, 0.13485761f},
-std::array<float,2>{0.642621934f, 0.881082416f},
-std::array<float,2>{0.124617316f, 0.297988176f},
-std::array<float,2>{0.459088922f, 0.94635272f},
-std::array<float,2>{0.956923187f, 0.35101226f},
-std::array<float,2>{0.523093164f, 0.576327026f},
-std::array<float,2>{0.22579129f, 0.224000782f},
-std::array<float,2>{0.04252287f, 0.690428019f},
-std::array<float,2>{0.742526472f, 0.0326521322f},
-std::array<float,2>{0.865287602f, 0.874258578f},
-std::array<float,2>{0.291950613f, 0.489020407f},
-std::array<float,2>{0.0252562724f, 0.848143876f},
-std::array<float,2>{0.715066075f, 0.479570568f},
-std::array<float,2>{0.819494605f, 0.707668185f},
-std::array<float,2>{0.273453951f, 0.0482833982f},
-std::array<float,2>{0.490105808f, 0.587933719f},
-std::array<float,2>{0.98109591f, 0.247822791f},
-std::array<float,2>{0.555650651f, 0.959075809f},
-std::array<float,2>{0.189616501f, 0.361920655f},
-std::array<float,2>{0.352418393f, 0.900794446f},
-std::array<float,2>{0.796225965f, 0.291579187f},
-std::array<float,2>{0.657976568f, 0.554286778f},
-std::array<float,2>{0.0870831758f, 0.150961012f},
-std::array<float,2>{0.169643998f, 0.654185057f},
-std::array<float,2>{0.62073493f, 0.0831225663f},
-std::array<float,2>{0.933279216f, 0.788589358f},
-std::array<float,2>{0.378072381f, 0.394847274f},
-std::array<float,2>{0.235449359f, 0.981990218f},
-std::array<float,2>{0.506072104f, 0.324261278f},
-std::array<float,2>{0.942840874f, 0.61993438f},
-std::array<float,2>{0.453059554f, 0.201592475f},
-std::array<float,2>{0.29810831f, 0.742439628f},
-std::array<float,2>{0.855866134f, 0.0253403243f},
-std::array<float,2>{0.724331677f, 0.824928463f},
-std::array<float,2>{0.0574215017f, 0.448409975f},
-std::array<float,2>{0.433647692f, 0.771179676f},
-std::array<float,2>{0.882371604f, 0.419607043f},
-std::array<float,2>{0.58840543f, 0.671911478f},
-std::array<float,2>{0.131084815f, 0.122486956f},
-std::array<float,2>{0.109184623f, 0.528935492f},
-std::array<float,2>{0.635359704f, 0.166923791f},
-std::array<float,2>{0.759760261f, 0.925032139f},
-std::array<float,2>{0.320254207f, 0.278992921f},
-std::array<float,2>{0.0542539805f, 0.966471255f},
-std::array<float,2>{0.729814589f, 0.37288323f},
-std::array<float,2>{0.844320476f, 0.585770071f},
-std::array<float,2>{0.305125952f, 0.238993421f},
-std::array<float,2>{0.445252806f, 0.714695275f},
-std::array<float,2>{0.951734304f, 0.0620354936f},
-std::array<float,2>{0.514752686f, 0.853961587f},
-std::array<float,2>{0.246551111f, 0.472529382f},
-std::array<float,2>{0.321176648f, 0.791300476f},
-std::array<float,2>{0.752132177f, 0.399564981f},
-std::array<float,2>{0.630265951f, 0.6410653f},
-std::array<float,2>{0.0977269411f, 0.089804098f},
-std::array<float,2>{0.13790442f, 0.559048116f},
-std::array<float,2>{0.582943439f, 0.143152043f},
-std::array<float,2>{0.890414953f, 0.893450677f},
-std::array<float,2>{0.427926362f, 0.288671106f},
-std::array<float,2>{0.19762966f, 0.817542851f},
-std::array<float,2>{0.550331473f, 0.438641369f},
-std::array<float,2>{0.976484001f, 0.736050487f},
-std::array<float,2>{0.496667862f, 0.0179430097f},
-std::array<float,2>{0.273213238f, 0.614314079f},
-std::array<float,2>{0.826476514f, 0.191487998f},
-std::array<float,2>{0.704622984f, 0.970410287f},
-std::array<float,2>{0.0223123394f, 0.313660771f},
-std::array<float,2>{0.383249134f, 0.934193969f},
-std::array<float,2>{0.923394442f, 0.268899471f},
-std::array<float,2>{0.614150763f, 0.517973602f},
-std::array<float,2>{0.160054341f, 0.157272294f},
-std::array<float,2>{0.0814206451f, 0.680876613f},
-std::array<float,2>{0.666133463f, 0.116704687f},
-std::array<float,2>{0.786188543f, 0.780778348f},
-std::array<float,2>{0.349193305f, 0.407085091f},
-std::array<float,2>{0.11373619f, 0.76187259f},
-std::array<float,2>{0.65187031f, 0.426392704f},
-std::array<float,2>{0.776423454f, 0.671590388f},
-std::array<float,2>{0.331446975f, 0.105127163f},
-std::array<float,2>{0.421799302f, 0.500028551f},
-std::array<float,2>{0.898565412f, 0.185568556f},
-std::array<float,2>{0.571111798f, 0.914622188f},
-std::array<float,2>{0.151018694f, 0.252375722f},
-std::array<float,2>{0.28418237f, 0.984821916f},
-std::array<float,2>{0.874948382f, 0.342632711f},
-std::array<float,2>{0.735138655f, 0.60720855f},
-std::array<float,2>{0.0352705643f, 0.20673728f},
-std::array<float,2>{0.230997443f, 0.729671359f},
-std::array<float,2>{0.530863881f, 0.00907604024f},
-std::array<float,2>{0.967759609f, 0.841691673f},
-std::array<float,2>{0.468132764f, 0.467648864f},
-std::array<float,2>{0.186918169f, 0.890582561f},
-std::array<float,2>{0.598148048f, 0.30809015f},
-std::array<float,2>{0.909400702f, 0.539620936f},
-std::array<float,2>{0.395607829f, 0.12828052f},
-std::array<float,2>{0.360553265f, 0.630921304f},
-std::array<float,2>{0.80979234f, 0.0643123984f},
-std::array<float,2>{0.674945295f, 0.81139189f},
-std::array<float,2>{0.0637517199f, 0.384682596f},
-std::array<float,2>{0.475538492f, 0.860270917f},
-std::array<float,2>{0.991124868f, 0.493758172f},
-std::array<float,2>{0.543624818f, 0.699118316f},
-std::array<float,2>{0.216611192f, 0.0407681316f},
-std::array<float,2>{0.00555367116f, 0.564343333f},
-std::array<float,2>{0.700739384f, 0.227007493f},
-std::array<float,2>{0.829706907f, 0.941866636f},
-std::array<float,2>{0.264262855f, 0.358389467f},
-std::array<float,2>{0.0857442543f, 0.9514305f},
-std::array<float,2>{0.66892916f, 0.345809102f},
-std::array<float,2>{0.783495307f, 0.570448935f},
-std::array<float,2>{0.345877409f, 0.222404763f},
-std::array<float,2>{0.389219999f, 0.692804456f},
-std::array<float,2>{0.928237796f, 0.0364525318f},
-std::array<float,2>{0.613203466f, 0.869398057f},
-std::array<float,2>{0.161146849f, 0.484930903f},
-std::array<float,2>{0.265765786f, 0.7980811f},
-std::array<float,2>{0.822571337f, 0.380926311f},
-std::array<float,2>{0.709712684f, 0.639116883f},
-std::array<float,2>{0.0192996413f, 0.0773444921f},
-std::array<float,2>{0.201655179f, 0.53531307f},
-std::array<float,2>{0.550945699f, 0.138489023f},
-std::array<float,2>{0.971815407f, 0.877167344f},
-std::array<float,2>{0.495025337f, 0.301863372f},
-std::array<float,2>{0.136704832f, 0.834488869f},
-std::array<float,2>{0.581284821f, 0.459524304f},
-std::array<float,2>{0.885988295f, 0.723225653f},
-std::array<float,2>{0.423987478f, 0.00110988063f},
-std::array<float,2>{0.327230752f, 0.597142577f},
-std::array<float,2>{0.756637931f, 0.216918811f},
-std::array<float,2>{0.626636982f, 0.992197812f},
-std::array<float,2>{0.0976088047f, 0.331489831f},
-std::array<float,2>{0.441286385f, 0.90661335f},
-std::array<float,2>{0.948731542f, 0.264539003f},
-std::array<float,2>{0.50907135f, 0.511480212f},
-std::array<float,2>{0.242874324f, 0.178147212f},
-std::array<float,2>{0.0502161607f, 0.661753893f},
-std::array<float,2>{0.73399955f, 0.0941499472f},
-std::array<float,2>{0.847702742f, 0.75563693f},
-std::array<float,2>{0.309894204f, 0.430480152f},
-std::array<float,2>{0.00192307984f, 0.767988026f},
-std::array<float,2>{0.695689142f, 0.415830791f},
-std::array<float,2>{0.834165931f, 0.677527308f},
-std::array<float,2>{0.258005947f, 0.119940668f},
-std::array<float,2>{0.471256942f, 0.527275205f},
-std::array<float,2>{0.98654902f, 0.1682183f},
-std::array<float,2>{0.54144156f, 0.929112434f},
-std::array<float,2>{0.210974768f, 0.273880929f},
-std::array<float,2>{0.363851875f, 0.976764143f},
-std::array<float,2>{0.807855368f, 0.321727008f},
-std::array<float,2>{0.67661339f, 0.622528195f},
-std::array<float,2>{0.0668194517f, 0.196391061f},
-std::array<float,2>{0.182027742f, 0.748790443f},
-std::array<float,2>{0.596717894f, 0.0299501587f},
-std::array<float,2>{0.913191855f, 0.82336694f},
-std::array<float,2>{0.390715241f, 0.451362014f},
-std::array<float,2>{0.226667047f, 0.902544916f},
-std::array<float,2>{0.525025487f, 0.29472661f},
-std::array<float,2>{0.96357888f, 0.548985302f},
-std::array<float,2>{0.464526415f, 0.153234288f},
-std::array<float,2>{0.287092239f, 0.648716688f},
-std::array<float,2>{0.870687783f, 0.0802887678f},
-std::array<float,2>{0.739743412f, 0.78135252f},
-std::array<float,2>{0.0344004892f, 0.392574638f},
-std::array<float,2>{0.417960942f, 0.847289562f},
-std::array<float,2>{0.903495431f, 0.482694209f},
-std::array<float,2>{0.576762855f, 0.704338431f},
-std::array<float,2>{0.155495539f, 0.0542158894f},
-std::array<float,2>{0.112910472f, 0.590512753f},
-std::array<float,2>{0.652545393f, 0.242229283f},
-std::array<float,2>{0.781199157f, 0.956324935f},
-std::array<float,2>{0.333392352f, 0.364843994f},
-std::array<float,2>{0.0432950556f, 0.931606948f},
-std::array<float,2>{0.746656239f, 0.269726992f},
-std::array<float,2>{0.862463117f, 0.521920919f},
-std::array<float,2>{0.294680268f, 0.161321267f},
-std::array<float,2>{0.455609411f, 0.684153497f},
-std::array<float,2>{0.957568944f, 0.10977f},
-std::array<float,2>{0.515675306f, 0.775820076f},
-std::array<float,2>{0.221548691f, 0.41067344f},
-std::array<float,2>{0.342694044f, 0.815993369f},
-std::array<float,2>{0.767509699f, 0.442661226f},
-std::array<float,2>{0.646875918f, 0.740077436f},
-std::array<float,2>{0.118401453f, 0.0196441114f},
-std::array<float,2>{0.141941696f, 0.609885991f},
-std::array<float,2>{0.563865721f, 0.188594699f},
-std::array<float,2>{0.897006452f, 0.974613786f},
-std::array<float,2>{0.41206643f, 0.316629231f},
-std::array<float,2>{0.203425303f, 0.794303596f},
-std::array<float,2>{0.538634479f, 0.404301912f},
-std::array<float,2>{0.99951762f, 0.646896064f},
-std::array<float,2>{0.481623113f, 0.0937393382f},
-std::array<float,2>{0.257266402f, 0.558293939f},
-std::array<float,2>{0.839498281f, 0.148333892f},
-std::array<float,2>{0.691347778f, 0.896552026f},
-std::array<float,2>{0.01329289f, 0.284402549f},
-std::array<float,2>{0.40057528f, 0.962237656f},
-std::array<float,2>{0.91843915f, 0.37005794f},
-std::array<float,2>{0.605096877f, 0.582006872f},
-std::array<float,2>{0.17333816f, 0.234616771f},
-std::array<float,2>{0.0732267797f, 0.71843636f},
-std::array<float,2>{0.68166405f, 0.0585145876f},
-std::array<float,2>{0.798942745f, 0.857515812f},
-std::array<float,2>{0.372460037f, 0.474378526f},
-std::array<float,2>{0.104271509f, 0.865162075f},
-std::array<float,2>{0.640457571f, 0.498804003f},
-std::array<float,2>{0.763262391f, 0.702364981f},
-std::array<float,2>{0.314672053f, 0.0447886959f},
-std::array<float,2>{0.42982614f, 0.568844259f},
-std::array<float,2>{0.875275433f, 0.234093726f},
-std::array<float,2>{0.591347814f, 0.940521657f},
-std::array<float,2>{0.125498354f, 0.353678435f},
-std::array<float,2>{0.300986081f, 0.885758936f},
-std::array<float,2>{0.852546453f, 0.310878098f},
-std::array<float,2>{0.718806267f, 0.545304477f},
-std::array<float,2>{0.0624352098f, 0.130177304f},
-std::array<float,2>{0.24035798f, 0.627759695f},
-std::array<float,2>{0.503725588f, 0.0686223358f},
-std::array<float,2>{0.93796885f, 0.807669818f},
-std::array<float,2>{0.448386729f, 0.388590604f},
-std::array<float,2>{0.167227238f, 0.991771758f},
-std::array<float,2>{0.621581852f, 0.339268416f},
-std::array<float,2>{0.937079191f, 0.602846324f},
-std::array<float,2>{0.381784052f, 0.208568454f},
-std::array<float,2>{0.35675022f, 0.732322514f},
-std::array<float,2>{0.790782213f, 0.0131592546f},
-std::array<float,2>{0.661212862f, 0.837022305f},
-std::array<float,2>{0.0933835283f, 0.461886734f},
-std::array<float,2>{0.488219351f, 0.758966327f},
-std::array<float,2>{0.977162778f, 0.422126353f},
-std::array<float,2>{0.559752047f, 0.667000175f},
-std::array<float,2>{0.191567063f, 0.106481373f},
-std::array<float,2>{0.0290753506f, 0.505605161f},
-std::array<float,2>{0.712197483f, 0.181418151f},
-std::array<float,2>{0.814100325f, 0.919069111f},
-std::array<float,2>{0.27990666f, 0.256756067f},
-std::array<float,2>{0.121737152f, 0.880798459f},
-std::array<float,2>{0.64134115f, 0.299458027f},
-std::array<float,2>{0.770970762f, 0.533193052f},
-std::array<float,2>{0.337480694f, 0.134678125f},
-std::array<float,2>{0.409249723f, 0.635908008f},
-std::array<float,2>{0.892990887f, 0.073664777f},
-std::array<float,2>{0.570307851f, 0.801281691f},
-std::array<float,2>{0.148359999f, 0.376501799f},
-std::array<float,2>{0.289628893f, 0.872460723f},
-std::array<float,2>{0.864906967f, 0.491923928f},
-std::array<float,2>{0.745118976f, 0.688525259f},
-std::array<float,2>{0.039648544f, 0.0339955389f},
-std::array<float,2>{0.223188609f, 0.575219989f},
-std::array<float,2>{0.520207405f, 0.224819988f},
-std::array<float,2>{0.954874039f, 0.949174643f},
-std::array<float,2>{0.457315475f, 0.348245531f},
-std::array<float,2>{0.179027557f, 0.750380337f},
-std::array<float,2>{0.605629265f, 0.435453862f},
-std::array<float,2>{0.914908051f, 0.658676505f},
-std::array<float,2>{0.403759629f, 0.0994365364f},
-std::array<float,2>{0.367643803f, 0.513655901f},
-std::array<float,2>{0.800815761f, 0.175455302f},
-std::array<float,2>{0.686515272f, 0.910341084f},
-std::array<float,2>{0.0765921921f, 0.261005819f},
-std::array<float,2>{0.476860434f, 0.998445094f},
-std::array<float,2>{0.993236959f, 0.334177107f},
-std::array<float,2>{0.531319261f, 0.598038554f},
-std::array<float,2>{0.207844719f, 0.212768361f},
-std::array<float,2>{0.0112698581f, 0.720235586f},
-std::array<float,2>{0.69481951f, 0.00754323881f},
-std::array<float,2>{0.84052515f, 0.828814328f},
-std::array<float,2>{0.253808707f, 0.453148186f},
-std::array<float,2>{0.0560154766f, 0.826457858f},
-std::array<float,2>{0.725016832f, 0.445822001f},
-std::array<float,2>{0.858302295f, 0.745384037f},
-std::array<float,2>{0.29980737f, 0.026790522f},
-std::array<float,2>{0.449528575f, 0.617397547f},
-std::array<float,2>{0.9444381f, 0.200092912f},
-std::array<float,2>{0.505358279f, 0.983170986f},
-std::array<float,2>{0.236345023f, 0.326243788f},
-std::array<float,2>{0.317410976f, 0.923245192f},
-std::array<float,2>{0.760605216f, 0.279603392f},
-std::array<float,2>{0.633658469f, 0.531237662f},
-std::array<float,2>{0.106149755f, 0.165441632f},
-std::array<float,2>{0.130057827f, 0.674816787f},
-std::array<float,2>{0.587664127f, 0.12491481f},
-std::array<float,2>{0.880307317f, 0.771879196f},
-std::array<float,2>{0.437150478f, 0.421564817f},
-std::array<float,2>{0.188804612f, 0.957370281f},
-std::array<float,2>{0.55827409f, 0.360545784f},
-std::array<float,2>{0.983063161f, 0.586970866f},
-std::array<float,2>{0.491121382f, 0.249705389f},
-std::array<float,2>{0.276609927f, 0.710868776f},
-std::array<float,2>{0.817943633f, 0.0490193516f},
-std::array<float,2>{0.717993498f, 0.850700378f},
-std::array<float,2>{0.0271703135f, 0.478142351f},
-std::array<float,2>{0.375342011f, 0.785889387f},
-std::array<float,2>{0.930466294f, 0.397297293f},
-std::array<float,2>{0.618613183f, 0.655824721f},
-std::array<float,2>{0.171551749f, 0.0849081352f},
-std::array<float,2>{0.089384906f, 0.551687658f},
-std::array<float,2>{0.65957123f, 0.148932457f},
-std::array<float,2>{0.793576777f, 0.899792552f},
-std::array<float,2>{0.35444501f, 0.290179312f},
-std::array<float,2>{0.0213099755f, 0.972643256f},
-std::array<float,2>{0.705619454f, 0.314730883f},
-std::array<float,2>{0.825496137f, 0.615966618f},
-std::array<float,2>{0.269772112f, 0.194742322f},
-std::array<float,2>{0.499069005f, 0.736566901f},
-std::array<float,2>{0.974250913f, 0.0168302283f},
-std::array<float,2>{0.548360527f, 0.819317937f},
-std::array<float,2>{0.197020277f, 0.440553099f},
-std::array<float,2>{0.351147056f, 0.77783972f},
-std::array<float,2>{0.789031506f, 0.409844369f},
-std::array<float,2>{0.665542781f, 0.683289111f},
-std::array<float,2>{0.079078339f, 0.11387296f},
-std::array<float,2>{0.157786101f, 0.516860187f},
-std::array<float,2>{0.615805745f, 0.158646882f},
-std::array<float,2>{0.924394608f, 0.9372437f},
-std::array<float,2>{0.385861248f, 0.267211288f},
-std::array<float,2>{0.249076024f, 0.852833867f},
-std::array<float,2>{0.513185918f, 0.470148057f},
-std::array<float,2>{0.951167703f, 0.712426186f},
-std::array<float,2>{0.441450089f, 0.059594091f},
-std::array<float,2>{0.307162881f, 0.58362478f},
-std::array<float,2>{0.847078204f, 0.2407704f},
-std::array<float,2>{0.727539718f, 0.968029082f},
-std::array<float,2>{0.0522505715f, 0.37389791f},
-std::array<float,2>{0.425991088f, 0.891146958f},
-std::array<float,2>{0.888426125f, 0.285372615f},
-std::array<float,2>{0.585601509f, 0.56246376f},
-std::array<float,2>{0.13927868f, 0.142438322f},
-std::array<float,2>{0.10125611f, 0.643039644f},
-std::array<float,2>{0.631791294f, 0.0862977058f},
-std::array<float,2>{0.750623941f, 0.790263534f},
-std::array<float,2>{0.32326737f, 0.401897937f},
-std::array<float,2>{0.066271469f, 0.808697999f},
-std::array<float,2>{0.672075748f, 0.385778815f},
-std::array<float,2>{0.81057626f, 0.630057752f},
-std::array<float,2>{0.362725794f, 0.0652162507f},
-std::array<float,2>{0.397130042f, 0.541609347f},
-std::array<float,2>{0.906466484f, 0.126127377f},
-std::array<float,2>{0.600632668f, 0.886835337f},
-std::array<float,2>{0.184272125f, 0.3057639f},
-std::array<float,2>{0.263611943f, 0.944615841f},
-std::array<float,2>{0.830280185f, 0.356175125f},
-std::array<float,2>{0.702181578f, 0.564888656f},
-std::array<float,2>{0.00588097516f, 0.230245486f},
-std::array<float,2>{0.218136057f, 0.696304202f},
-std::array<float,2>{0.54530555f, 0.0413662307f},
-std::array<float,2>{0.989656091f, 0.861350596f},
-std::array<float,2>{0.474356622f, 0.495528728f},
-std::array<float,2>{0.150128156f, 0.917496085f},
-std::array<float,2>{0.574215293f, 0.250055462f},
-std::array<float,2>{0.901093781f, 0.503402114f},
-std::array<float,2>{0.41989094f, 0.185021028f},
-std::array<float,2>{0.329703629f, 0.668484211f},
-std::array<float,2>{0.774589837f, 0.103069581f},
-std::array<float,2>{0.648572505f, 0.764710486f},
-std::array<float,2>{0.116221912f, 0.42866233f},
-std::array<float,2>{0.465170234f, 0.84260416f},
-std::array<float,2>{0.965097249f, 0.466181934f},
-std::array<float,2>{0.528587282f, 0.727781653f},
-std::array<float,2>{0.234286562f, 0.0108186677f},
-std::array<float,2>{0.0382483304f, 0.607899964f},
-std::array<float,2>{0.736431718f, 0.204414397f},
-std::array<float,2>{0.871207535f, 0.987030268f},
-std::array<float,2>{0.283194125f, 0.339912653f},
-std::array<float,2>{0.101903744f, 0.941056967f},
-std::array<float,2>{0.638636291f, 0.354198366f},
-std::array<float,2>{0.764141142f, 0.568883598f},
-std::array<float,2>{0.312904358f, 0.233856902f},
-std::array<float,2>{0.433438003f, 0.703040004f},
-std::array<float,2>{0.878540814f, 0.0444086641f},
-std::array<float,2>{0.592029512f, 0.864323974f},
-std::array<float,2>{0.127622306f, 0.498284012f},
-std::array<float,2>{0.302954435f, 0.808328748f},
-std::array<float,2>{0.854970098f, 0.387850791f},
-std::array<float,2>{0.722331464f, 0.627134562f},
-std::array<float,2>{0.0588585176f, 0.0690388605f},
-std::array<float,2>{0.239632204f, 0.545413792f},
-std::array<float,2>{0.500898182f, 0.130643249f},
-std::array<float,2>{0.940027058f, 0.886686921f},
-std::array<float,2>{0.446072817f, 0.311359614f},
-std::array<float,2>{0.165220112f, 0.837652147f},
-std::array<float,2>{0.624833882f, 0.461136878f},
-std::array<float,2>{0.934029639f, 0.731637239f},
-std::array<float,2>{0.380454063f, 0.0133240093f},
-std::array<float,2>{0.359204441f, 0.603237033f},
-std::array<float,2>{0.791276276f, 0.208431497f},
-std::array<float,2>{0.663737774f, 0.99149251f},
-std::array<float,2>{0.0902697518f, 0.339459002f},
-std::array<float,2>{0.485669315f, 0.919885695f},
-std::array<float,2>{0.979468822f, 0.255862534f},
-std::array<float,2>{0.561704338f, 0.505259216f},
-std::array<float,2>{0.195285261f, 0.180979803f},
-std::array<float,2>{0.0299301464f, 0.667508066f},
-std::array<float,2>{0.713397324f, 0.107125476f},
-std::array<float,2>{0.816202581f, 0.759733558f},
-std::array<float,2>{0.278814316f, 0.422825903f},
-std::array<float,2>{0.046370998f, 0.776236773f},
-std::array<float,2>{0.749129832f, 0.410369694f},
-std::array<float,2>{0.86128819f, 0.683756411f},
-std::array<float,2>{0.29581359f, 0.110165082f},
-std::array<float,2>{0.4548859f, 0.522323489f},
-std::array<float,2>{0.959368944f, 0.161904693f},
-std::array<float,2>{0.518140614f, 0.931109726f},
-std::array<float,2>{0.218939498f, 0.270328075f},
-std::array<float,2>{0.340669751f, 0.975492716f},
-std::array<float,2>{0.769230247f, 0.317165405f},
-std::array<float,2>{0.645896733f, 0.609640241f},
-std::array<float,2>{0.119736791f, 0.18930693f},
-std::array<float,2>{0.143652722f, 0.739320278f},
-std::array<float,2>{0.564855635f, 0.0203133337f},
-std::array<float,2>{0.895535529f, 0.815574944f},
-std::array<float,2>{0.412840575f, 0.443177909f},
-std::array<float,2>{0.206176937f, 0.89744705f},
-std::array<float,2>{0.535980582f, 0.28486383f},
-std::array<float,2>{0.996629179f, 0.557949781f},
-std::array<float,2>{0.483600289f, 0.147629559f},
-std::array<float,2>{0.253965259f, 0.647087932f},
-std::array<float,2>{0.836319447f, 0.0928535387f},
-std::array<float,2>{0.688041747f, 0.794826388f},
-std::array<float,2>{0.013822807f, 0.404906213f},
-std::array<float,2>{0.399979264f, 0.858309388f},
-std::array<float,2>{0.920277715f, 0.474048406f},
-std::array<float,2>{0.602735162f, 0.717800081f},
-std::array<float,2>{0.174351007f, 0.0580367297f},
-std::array<float,2>{0.0704119653f, 0.581178486f},
-std::array<float,2>{0.679961681f, 0.23508811f},
-std::array<float,2>{0.797668397f, 0.962856054f},
-std::array<float,2>{0.37404415f, 0.369200349f},
-std::array<float,2>{0.00256018457f, 0.929314911f},
-std::array<float,2>{0.698255479f, 0.274182945f},
-std::array<float,2>{0.83351475f, 0.526407599f},
-std::array<float,2>{0.260872096f, 0.168543294f},
-std::array<float,2>{0.469097674f, 0.677137971f},
-std::array<float,2>{0.98523128f, 0.119400926f},
-std::array<float,2>{0.540187955f, 0.768173039f},
-std::array<float,2>{0.213085517f, 0.415070206f},
-std::array<float,2>{0.366630942f, 0.823780775f},
-std::array<float,2>{0.805410385f, 0.452125669f},
-std::array<float,2>{0.679305136f, 0.748224676f},
-std::array<float,2>{0.069165647f, 0.0294650011f},
-std::array<float,2>{0.181639418f, 0.622846186f},
-std::array<float,2>{0.595410228f, 0.196994171f},
-std::array<float,2>{0.911250174f, 0.977178752f},
-std::array<float,2>{0.392620683f, 0.321995497f},
-std::array<float,2>{0.230273128f, 0.781802654f},
-std::array<float,2>{0.525991261f, 0.391967833f},
-std::array<float,2>{0.962169349f, 0.649360955f},
-std::array<float,2>{0.462251663f, 0.0810226351f},
-std::array<float,2>{0.28766349f, 0.549680769f},
-std::array<float,2>{0.86902523f, 0.152814597f},
-std::array<float,2>{0.742066562f, 0.902846396f},
-std::array<float,2>{0.0312507264f, 0.294414133f},
-std::array<float,2>{0.415910721f, 0.956647992f},
-std::array<float,2>{0.904515922f, 0.364503264f},
-std::array<float,2>{0.574222088f, 0.590063751f},
-std::array<float,2>{0.15375495f, 0.24294661f},
-std::array<float,2>{0.11038354f, 0.704759896f},
-std::array<float,2>{0.655452013f, 0.0541687906f},
-std::array<float,2>{0.778783441f, 0.846835196f},
-std::array<float,2>{0.334521264f, 0.483023822f},
-std::array<float,2>{0.0831249803f, 0.86983031f},
-std::array<float,2>{0.669978559f, 0.484558254f},
-std::array<float,2>{0.782314658f, 0.692940533f},
-std::array<float,2>{0.344736069f, 0.0370175652f},
-std::array<float,2>{0.386780173f, 0.570962369f},
-std::array<float,2>{0.926086485f, 0.221739724f},
-std::array<float,2>{0.61041981f, 0.951711118f},
-std::array<float,2>{0.162227973f, 0.346551657f},
-std::array<float,2>{0.267785966f, 0.87763232f},
-std::array<float,2>{0.820711851f, 0.30246526f},
-std::array<float,2>{0.708193123f, 0.536085665f},
-std::array<float,2>{0.0170041025f, 0.137775376f},
-std::array<float,2>{0.201009914f, 0.639561594f},
-std::array<float,2>{0.552927017f, 0.0779635236f},
-std::array<float,2>{0.969786048f, 0.798755229f},
-std::array<float,2>{0.493257701f, 0.381759554f},
-std::array<float,2>{0.133940309f, 0.99314183f},
-std::array<float,2>{0.580002129f, 0.331783801f},
-std::array<float,2>{0.884477139f, 0.59742415f},
-std::array<float,2>{0.422952116f, 0.217696428f},
-std::array<float,2>{0.326066047f, 0.723001599f},
-std::array<float,2>{0.755652905f, 0.00178942643f},
-std::array<float,2>{0.627013505f, 0.834044158f},
-std::array<float,2>{0.094039008f, 0.459156126f},
-std::array<float,2>{0.439234644f, 0.755317271f},
-std::array<float,2>{0.946108043f, 0.429838508f},
-std::array<float,2>{0.51041466f, 0.661420226f},
-std::array<float,2>{0.245790258f, 0.0945925936f},
-std::array<float,2>{0.0487576164f, 0.511160374f},
-std::array<float,2>{0.730920255f, 0.178343534f},
-std::array<float,2>{0.850194335f, 0.906962991f},
-std::array<float,2>{0.311143726f, 0.263691485f},
-std::array<float,2>{0.0639763772f, 0.887521148f},
-std::array<float,2>{0.675411224f, 0.306319267f},
-std::array<float,2>{0.810486436f, 0.541053414f},
-std::array<float,2>{0.361118555f, 0.126863971f},
-std::array<float,2>{0.396122634f, 0.630471349f},
-std::array<float,2>{0.910148919f, 0.0649293214f},
-std::array<float,2>{0.597963274f, 0.809419751f},
-std::array<float,2>{0.187290475f, 0.386407256f},
-std::array<float,2>{0.263946623f, 0.862173438f},
-std::array<float,2>{0.829575181f, 0.49586904f},
-std::array<float,2>{0.700571179f, 0.696955442f},
-std::array<float,2>{0.00531126885f, 0.041989252f},
-std::array<float,2>{0.21605365f, 0.564944029f},
-std::array<float,2>{0.54318893f, 0.229980141f},
-std::array<float,2>{0.990481257f, 0.945252478f},
-std::array<float,2>{0.474769086f, 0.355644286f},
-std::array<float,2>{0.150812075f, 0.765228987f},
-std::array<float,2>{0.570538044f, 0.427998304f},
-std::array<float,2>{0.899297953f, 0.668144166f},
-std::array<float,2>{0.421182662f, 0.102673411f},
-std::array<float,2>{0.331565499f, 0.50368762f},
-std::array<float,2>{0.777128994f, 0.185529739f},
-std::array<float,2>{0.651768088f, 0.917038202f},
-std::array<float,2>{0.113806941f, 0.250966668f},
-std::array<float,2>{0.468361229f, 0.986486077f},
-std::array<float,2>{0.966833532f, 0.34041658f},
-std::array<float,2>{0.530581772f, 0.60828954f},
-std::array<float,2>{0.230623752f, 0.204965979f},
-std::array<float,2>{0.0356605984f, 0.728439033f},
-std::array<float,2>{0.734841704f, 0.0115498221f},
-std::array<float,2>{0.874281466f, 0.842203081f},
-std::array<float,2>{0.284870595f, 0.466476709f},
-std::array<float,2>{0.0215513725f, 0.81856662f},
-std::array<float,2>{0.704511404f, 0.441281378f},
-std::array<float,2>{0.826861441f, 0.736936212f},
-std::array<float,2>{0.272582024f, 0.0172904693f},
-std::array<float,2>{0.496236682f, 0.615504205f},
-std::array<float,2>{0.97561419f, 0.195098758f},
-std::array<float,2>{0.550097585f, 0.972146988f},
-std::array<float,2>{0.197892994f, 0.314950794f},
-std::array<float,2>{0.349116474f, 0.936540842f},
-std::array<float,2>{0.786672115f, 0.266862661f},
-std::array<float,2>{0.666757703f, 0.517529726f},
-std::array<float,2>{0.0817944333f, 0.158921644f},
-std::array<float,2>{0.159382835f, 0.682626605f},
-std::array<float,2>{0.613367498f, 0.11356546f},
-std::array<float,2>{0.923193455f, 0.777403951f},
-std::array<float,2>{0.383450449f, 0.409659505f},
-std::array<float,2>{0.246841386f, 0.968655109f},
-std::array<float,2>{0.515490234f, 0.373097211f},
-std::array<float,2>{0.951503456f, 0.583317459f},
-std::array<float,2>{0.444689542f, 0.240682945f},
-std::array<float,2>{0.30563572f, 0.71202004f},
-std::array<float,2>{0.843883991f, 0.0601518787f},
-std::array<float,2>{0.730082691f, 0.853124857f},
-std::array<float,2>{0.0541123562f, 0.470661789f},
-std::array<float,2>{0.428352654f, 0.790948391f},
-std::array<float,2>{0.889914811f, 0.401734471f},
-std::array<float,2>{0.582171798f, 0.643271327f},
-std::array<float,2>{0.138464421f, 0.0865582377f},
-std::array<float,2>{0.0983016863f, 0.561871588f},
-std::array<float,2>{0.630821526f, 0.141840607f},
-std::array<float,2>{0.75263226f, 0.890836179f},
-std::array<float,2>{0.320554644f, 0.285695046f},
-std::array<float,2>{0.0569662005f, 0.982612789f},
-std::array<float,2>{0.72382766f, 0.326971471f},
-std::array<float,2>{0.856412709f, 0.617927372f},
-std::array<float,2>{0.298769563f, 0.199517027f},
-std::array<float,2>{0.452352107f, 0.74582088f},
-std::array<float,2>{0.94294697f, 0.0271384511f},
-std::array<float,2>{0.506515443f, 0.827028513f},
-std::array<float,2>{0.236263737f, 0.44577685f},
-std::array<float,2>{0.319728076f, 0.772452414f},
-std::array<float,2>{0.758903503f, 0.42138347f},
-std::array<float,2>{0.63524133f, 0.675412774f},
-std::array<float,2>{0.10846398f, 0.124238841f},
-std::array<float,2>{0.13146311f, 0.530701876f},
-std::array<float,2>{0.588170648f, 0.165904954f},
-std::array<float,2>{0.882315576f, 0.923398435f},
-std::array<float,2>{0.434314758f, 0.279796779f},
-std::array<float,2>{0.190246269f, 0.851324677f},
-std::array<float,2>{0.555018008f, 0.477832139f},
-std::array<float,2>{0.980814219f, 0.710369289f},
-std::array<float,2>{0.489735633f, 0.0494823791f},
-std::array<float,2>{0.274313927f, 0.587808907f},
-std::array<float,2>{0.81982857f, 0.249064073f},
-std::array<float,2>{0.715748429f, 0.957665801f},
-std::array<float,2>{0.0247183908f, 0.361261278f},
-std::array<float,2>{0.378596157f, 0.900260329f},
-std::array<float,2>{0.933079898f, 0.2906726f},
-std::array<float,2>{0.620161653f, 0.551073074f},
-std::array<float,2>{0.169328347f, 0.148447737f},
-std::array<float,2>{0.0876312554f, 0.655309796f},
-std::array<float,2>{0.657600522f, 0.0842152238f},
-std::array<float,2>{0.796745598f, 0.785333335f},
-std::array<float,2>{0.35192591f, 0.396955103f},
-std::array<float,2>{0.124245428f, 0.800956428f},
-std::array<float,2>{0.64310956f, 0.376124084f},
-std::array<float,2>{0.772656381f, 0.63650775f},
-std::array<float,2>{0.338613451f, 0.0737866387f},
-std::array<float,2>{0.406436712f, 0.532698929f},
-std::array<float,2>{0.891378403f, 0.13384673f},
-std::array<float,2>{0.5682289f, 0.880080462f},
-std::array<float,2>{0.144549966f, 0.299272269f},
-std::array<float,2>{0.291204691f, 0.948585629f},
-std::array<float,2>{0.866084695f, 0.347688496f},
-std::array<float,2>{0.742941439f, 0.575915635f},
-std::array<float,2>{0.0424220525f, 0.225436628f},
-std::array<float,2>{0.226273358f, 0.689007759f},
-std::array<float,2>{0.522663057f, 0.033319544f},
-std::array<float,2>{0.956362486f, 0.872874796f},
-std::array<float,2>{0.459576219f, 0.491491139f},
-std::array<float,2>{0.176933885f, 0.910989404f},
-std::array<float,2>{0.608930469f, 0.261325449f},
-std::array<float,2>{0.917690754f, 0.513004661f},
-std::array<float,2>{0.404910713f, 0.175132528f},
-std::array<float,2>{0.370795608f, 0.659098148f},
-std::array<float,2>{0.804282904f, 0.098983109f},
-std::array<float,2>{0.6851542f, 0.750582457f},
-std::array<float,2>{0.0745955333f, 0.434950948f},
-std::array<float,2>{0.48037976f, 0.828422725f},
-std::array<float,2>{0.99584353f, 0.453819752f},
-std::array<float,2>{0.534434557f, 0.720046401f},
-std::array<float,2>{0.209265053f, 0.00709170569f},
-std::array<float,2>{0.0087924283f, 0.598315358f},
-std::array<float,2>{0.691463172f, 0.211973414f},
-std::array<float,2>{0.843488336f, 0.998687804f},
-std::array<float,2>{0.251296222f, 0.334832609f},
-std::array<float,2>{0.093242608f, 0.989803791f},
-std::array<float,2>{0.661991596f, 0.337182254f},
-std::array<float,2>{0.790182412f, 0.604417205f},
-std::array<float,2>{0.357082188f, 0.210777268f},
-std::array<float,2>{0.381081134f, 0.732666135f},
-std::array<float,2>{0.936932445f, 0.0154701909f},
-std::array<float,2>{0.621867061f, 0.838481784f},
-std::array<float,2>{0.167951033f, 0.464294612f},
-std::array<float,2>{0.279728651f, 0.760764003f},
-std::array<float,2>{0.813628316f, 0.424362063f},
-std::array<float,2>{0.712800622f, 0.664735198f},
-std::array<float,2>{0.0283208527f, 0.108003706f},
-std::array<float,2>{0.192374662f, 0.507135749f},
-std::array<float,2>{0.560282826f, 0.181904137f},
-std::array<float,2>{0.977047324f, 0.921196103f},
-std::array<float,2>{0.487385929f, 0.254729688f},
-std::array<float,2>{0.12543577f, 0.865440607f},
-std::array<float,2>{0.5911479f, 0.497273624f},
-std::array<float,2>{0.875707686f, 0.70031184f},
-std::array<float,2>{0.430649787f, 0.0462296754f},
-std::array<float,2>{0.315003932f, 0.566568375f},
-std::array<float,2>{0.762807846f, 0.231247514f},
-std::array<float,2>{0.639965296f, 0.939129651f},
-std::array<float,2>{0.103784688f, 0.353205085f},
-std::array<float,2>{0.448999941f, 0.883256078f},
-std::array<float,2>{0.938150764f, 0.309832126f},
-std::array<float,2>{0.503373206f, 0.543643653f},
-std::array<float,2>{0.240882441f, 0.131367758f},
-std::array<float,2>{0.0618966147f, 0.625755608f},
-std::array<float,2>{0.719350874f, 0.0679068863f},
-std::array<float,2>{0.853036582f, 0.805191875f},
-std::array<float,2>{0.301494807f, 0.389662176f},
-std::array<float,2>{0.0128139611f, 0.79678899f},
-std::array<float,2>{0.690500379f, 0.402822375f},
-std::array<float,2>{0.839323997f, 0.646155059f},
-std::array<float,2>{0.257553756f, 0.0900552869f},
-std::array<float,2>{0.482275069f, 0.555658221f},
-std::array<float,2>{0.999438107f, 0.144731119f},
-std::array<float,2>{0.538237989f, 0.894843042f},
-std::array<float,2>{0.203979895f, 0.281317741f},
-std::array<float,2>{0.372577071f, 0.962909162f},
-std::array<float,2>{0.799445033f, 0.368098319f},
-std::array<float,2>{0.682169378f, 0.578919113f},
-std::array<float,2>{0.0724363029f, 0.23707208f},
-std::array<float,2>{0.173516646f, 0.716552019f},
-std::array<float,2>{0.604532778f, 0.0548963808f},
-std::array<float,2>{0.918486595f, 0.855677545f},
-std::array<float,2>{0.401236862f, 0.474927694f},
-std::array<float,2>{0.221078739f, 0.932546258f},
-std::array<float,2>{0.516420305f, 0.272176266f},
-std::array<float,2>{0.957504988f, 0.520735681f},
-std::array<float,2>{0.455396056f, 0.163835838f},
-std::array<float,2>{0.294431388f, 0.686303437f},
-std::array<float,2>{0.863004208f, 0.112611271f},
-std::array<float,2>{0.746284187f, 0.77499193f},
-std::array<float,2>{0.0439302959f, 0.412577629f},
-std::array<float,2>{0.411359817f, 0.814132988f},
-std::array<float,2>{0.896889329f, 0.444285303f},
-std::array<float,2>{0.564363301f, 0.742104411f},
-std::array<float,2>{0.142233953f, 0.022820184f},
-std::array<float,2>{0.118739776f, 0.61195749f},
-std::array<float,2>{0.647045612f, 0.191234082f},
-std::array<float,2>{0.766874552f, 0.972868025f},
-std::array<float,2>{0.342104822f, 0.318957418f},
-std::array<float,2>{0.034697134f, 0.905578196f},
-std::array<float,2>{0.739895403f, 0.296355933f},
-std::array<float,2>{0.87059176f, 0.548369467f},
-std::array<float,2>{0.286569059f, 0.15523988f},
-std::array<float,2>{0.463941991f, 0.652204275f},
-std::array<float,2>{0.963204861f, 0.0795107484f},
-std::array<float,2>{0.524819911f, 0.783400834f},
-std::array<float,2>{0.227264076f, 0.393219799f},
-std::array<float,2>{0.33360371f, 0.843972206f},
-std::array<float,2>{0.780468702f, 0.48228085f},
-std::array<float,2>{0.652998686f, 0.706399381f},
-std::array<float,2>{0.112738788f, 0.0524701476f},
-std::array<float,2>{0.155995011f, 0.592654586f},
-std::array<float,2>{0.576254249f, 0.244213805f},
-std::array<float,2>{0.90398562f, 0.953414023f},
-std::array<float,2>{0.417462289f, 0.366536796f},
-std::array<float,2>{0.21178478f, 0.766729772f},
-std::array<float,2>{0.541864276f, 0.417778194f},
-std::array<float,2>{0.986823678f, 0.679134071f},
-std::array<float,2>{0.470980823f, 0.119048968f},
-std::array<float,2>{0.258326262f, 0.524708688f},
-std::array<float,2>{0.834534764f, 0.170575872f},
-std::array<float,2>{0.696035385f, 0.926935971f},
-std::array<float,2>{0.00105856289f, 0.276232898f},
-std::array<float,2>{0.391560286f, 0.979537666f},
-std::array<float,2>{0.914033413f, 0.324134856f},
-std::array<float,2>{0.597648263f, 0.624019563f},
-std::array<float,2>{0.182167232f, 0.198587358f},
-std::array<float,2>{0.067284435f, 0.74750191f},
-std::array<float,2>{0.676246822f, 0.0288837161f},
-std::array<float,2>{0.808125138f, 0.821006358f},
-std::array<float,2>{0.36351651f, 0.449255705f},
-std::array<float,2>{0.0969617143f, 0.833021343f},
-std::array<float,2>{0.626211464f, 0.457415551f},
-std::array<float,2>{0.756094038f, 0.725652874f},
-std::array<float,2>{0.327919751f, 0.0028881859f},
-std::array<float,2>{0.424393266f, 0.594309866f},
-std::array<float,2>{0.886358798f, 0.215165913f},
-std::array<float,2>{0.581709862f, 0.995697856f},
-std::array<float,2>{0.136030033f, 0.329253852f},
-std::array<float,2>{0.310537308f, 0.908922255f},
-std::array<float,2>{0.848474443f, 0.262909472f},
-std::array<float,2>{0.733697951f, 0.509238362f},
-std::array<float,2>{0.0507466868f, 0.177169502f},
-std::array<float,2>{0.242305115f, 0.663489521f},
-std::array<float,2>{0.509486377f, 0.0960516781f},
-std::array<float,2>{0.948341608f, 0.757809937f},
-std::array<float,2>{0.440506548f, 0.432734191f},
-std::array<float,2>{0.162107214f, 0.950402856f},
-std::array<float,2>{0.612603128f, 0.345267266f},
-std::array<float,2>{0.928198099f, 0.573727429f},
-std::array<float,2>{0.38914004f, 0.218859076f},
-std::array<float,2>{0.34660545f, 0.695086718f},
-std::array<float,2>{0.784156322f, 0.037943121f},
-std::array<float,2>{0.668389857f, 0.868786633f},
-std::array<float,2>{0.0854054689f, 0.48727712f},
-std::array<float,2>{0.494530022f, 0.79913801f},
-std::array<float,2>{0.972524524f, 0.379870325f},
-std::array<float,2>{0.551569104f, 0.638560653f},
-std::array<float,2>{0.201796904f, 0.0751797035f},
-std::array<float,2>{0.018771518f, 0.538773417f},
-std::array<float,2>{0.709338069f, 0.139061183f},
-std::array<float,2>{0.822891355f, 0.8762362f},
-std::array<float,2>{0.266331792f, 0.302951664f},
-std::array<float,2>{0.116704442f, 0.914143741f},
-std::array<float,2>{0.649319947f, 0.252613336f},
-std::array<float,2>{0.775337815f, 0.500694513f},
-std::array<float,2>{0.329335988f, 0.186281398f},
-std::array<float,2>{0.419235468f, 0.671090424f},
-std::array<float,2>{0.900675774f, 0.104871646f},
-std::array<float,2>{0.573419273f, 0.762666583f},
-std::array<float,2>{0.149485543f, 0.425958455f},
-std::array<float,2>{0.282298356f, 0.841130197f},
-std::array<float,2>{0.871641278f, 0.466808319f},
-std::array<float,2>{0.737291217f, 0.73034811f},
-std::array<float,2>{0.0389168635f, 0.00936153717f},
-std::array<float,2>{0.233735055f, 0.606524289f},
-std::array<float,2>{0.529017329f, 0.206072465f},
-std::array<float,2>{0.965564609f, 0.98503226f},
-std::array<float,2>{0.465507865f, 0.341981173f},
-std::array<float,2>{0.183647111f, 0.810863078f},
-std::array<float,2>{0.601220906f, 0.384058088f},
-std::array<float,2>{0.907097638f, 0.631482244f},
-std::array<float,2>{0.396564156f, 0.0638202131f},
-std::array<float,2>{0.36320132f, 0.539070129f},
-std::array<float,2>{0.811434627f, 0.128661811f},
-std::array<float,2>{0.672609806f, 0.88996911f},
-std::array<float,2>{0.0657664016f, 0.308146447f},
-std::array<float,2>{0.473779708f, 0.941931665f},
-std::array<float,2>{0.989997566f, 0.35747695f},
-std::array<float,2>{0.545509696f, 0.563484013f},
-std::array<float,2>{0.218270764f, 0.227302134f},
-std::array<float,2>{0.00651973719f, 0.698650539f},
-std::array<float,2>{0.702807367f, 0.0402758345f},
-std::array<float,2>{0.830720842f, 0.859399796f},
-std::array<float,2>{0.263084948f, 0.49324283f},
-std::array<float,2>{0.0520630851f, 0.854370654f},
-std::array<float,2>{0.728236854f, 0.472058624f},
-std::array<float,2>{0.847484291f, 0.71435076f},
-std::array<float,2>{0.30692926f, 0.0615318865f},
-std::array<float,2>{0.442006052f, 0.585154593f},
-std::array<float,2>{0.950387716f, 0.238479957f},
-std::array<float,2>{0.51291281f, 0.965966523f},
-std::array<float,2>{0.249555379f, 0.37217775f},
-std::array<float,2>{0.324070036f, 0.892722905f},
-std::array<float,2>{0.750401318f, 0.288410932f},
-std::array<float,2>{0.630947769f, 0.559562206f},
-std::array<float,2>{0.100662433f, 0.142656118f},
-std::array<float,2>{0.138760969f, 0.641289234f},
-std::array<float,2>{0.585226655f, 0.0890510753f},
-std::array<float,2>{0.887806416f, 0.791832626f},
-std::array<float,2>{0.426737607f, 0.400018692f},
-std::array<float,2>{0.196497396f, 0.970128119f},
-std::array<float,2>{0.54815352f, 0.314374566f},
-std::array<float,2>{0.973760247f, 0.615014553f},
-std::array<float,2>{0.49951908f, 0.192309752f},
-std::array<float,2>{0.270076543f, 0.735517561f},
-std::array<float,2>{0.82612133f, 0.018206438f},
-std::array<float,2>{0.705416143f, 0.817871451f},
-std::array<float,2>{0.0208154507f, 0.439228326f},
-std::array<float,2>{0.386396408f, 0.780435681f},
-std::array<float,2>{0.923979521f, 0.406404316f},
-std::array<float,2>{0.615601063f, 0.681154191f},
-std::array<float,2>{0.157545835f, 0.116612695f},
-std::array<float,2>{0.0781934187f, 0.51807642f},
-std::array<float,2>{0.665162683f, 0.158149853f},
-std::array<float,2>{0.788093388f, 0.933757961f},
-std::array<float,2>{0.350968301f, 0.269301414f},
-std::array<float,2>{0.0265985243f, 0.959556103f},
-std::array<float,2>{0.718432605f, 0.361560851f},
-std::array<float,2>{0.817448854f, 0.588844061f},
-std::array<float,2>{0.277183771f, 0.247242093f},
-std::array<float,2>{0.490697175f, 0.707268715f},
-std::array<float,2>{0.982673347f, 0.0487193204f},
-std::array<float,2>{0.558047056f, 0.848371327f},
-std::array<float,2>{0.189159974f, 0.480288208f},
-std::array<float,2>{0.35360378f, 0.78835541f},
-std::array<float,2>{0.793259382f, 0.395364374f},
-std::array<float,2>{0.659809351f, 0.653768659f},
-std::array<float,2>{0.0892365873f, 0.0839016512f},
-std::array<float,2>{0.171203539f, 0.55392766f},
-std::array<float,2>{0.619096577f, 0.15061608f},
-std::array<float,2>{0.929868639f, 0.901233613f},
-std::array<float,2>{0.375822306f, 0.29111743f},
-std::array<float,2>{0.236986011f, 0.824353278f},
-std::array<float,2>{0.505665898f, 0.449186414f},
-std::array<float,2>{0.944912255f, 0.743089259f},
-std::array<float,2>{0.450119257f, 0.0248199645f},
-std::array<float,2>{0.300582439f, 0.619218946f},
-std::array<float,2>{0.857814193f, 0.202070117f},
-std::array<float,2>{0.725488782f, 0.9818331f},
-std::array<float,2>{0.0563394614f, 0.324711382f},
-std::array<float,2>{0.436984956f, 0.925746262f},
-std::array<float,2>{0.880679548f, 0.278743982f},
-std::array<float,2>{0.587241411f, 0.528555751f},
-std::array<float,2>{0.130624056f, 0.166098401f},
-std::array<float,2>{0.105581187f, 0.672456384f},
-std::array<float,2>{0.633215845f, 0.122854456f},
-std::array<float,2>{0.759943068f, 0.770531893f},
-std::array<float,2>{0.318093657f, 0.419000149f},
-std::array<float,2>{0.0767075792f, 0.752030253f},
-std::array<float,2>{0.685774446f, 0.437291116f},
-std::array<float,2>{0.801406145f, 0.657012701f},
-std::array<float,2>{0.367909491f, 0.100580215f},
-std::array<float,2>{0.404055893f, 0.513849556f},
-std::array<float,2>{0.914415359f, 0.173565522f},
-std::array<float,2>{0.606141329f, 0.91249305f},
-std::array<float,2>{0.17937471f, 0.258465111f},
-std::array<float,2>{0.253032267f, 0.997992277f},
-std::array<float,2>{0.840038657f, 0.332124829f},
-std::array<float,2>{0.695023f, 0.599836648f},
-std::array<float,2>{0.0112042967f, 0.213003069f},
-std::array<float,2>{0.207209542f, 0.721364677f},
-std::array<float,2>{0.532024026f, 0.00518241059f},
-std::array<float,2>{0.993994296f, 0.831843853f},
-std::array<float,2>{0.477248579f, 0.456805557f},
-std::array<float,2>{0.14763023f, 0.881664395f},
-std::array<float,2>{0.569396794f, 0.298803955f},
-std::array<float,2>{0.893104076f, 0.535148919f},
-std::array<float,2>{0.409978598f, 0.135687813f},
-std::array<float,2>{0.336916327f, 0.633056641f},
-std::array<float,2>{0.77113378f, 0.0705748126f},
-std::array<float,2>{0.640654683f, 0.803183794f},
-std::array<float,2>{0.121151492f, 0.378123462f},
-std::array<float,2>{0.457675904f, 0.874576986f},
-std::array<float,2>{0.954551041f, 0.488451689f},
-std::array<float,2>{0.519889295f, 0.68960017f},
-std::array<float,2>{0.222670957f, 0.0329713523f},
-std::array<float,2>{0.0394841693f, 0.576967597f},
-std::array<float,2>{0.745955646f, 0.224177912f},
-std::array<float,2>{0.864743173f, 0.946864724f},
-std::array<float,2>{0.289136171f, 0.351098418f},
-std::array<float,2>{0.120156139f, 0.973730206f},
-std::array<float,2>{0.644815683f, 0.319391578f},
-std::array<float,2>{0.768529117f, 0.612865686f},
-std::array<float,2>{0.341233641f, 0.190113291f},
-std::array<float,2>{0.413171381f, 0.740539551f},
-std::array<float,2>{0.89461118f, 0.0222471841f},
-std::array<float,2>{0.566136599f, 0.813391864f},
-std::array<float,2>{0.143248111f, 0.444800109f},
-std::array<float,2>{0.296229541f, 0.773767352f},
-std::array<float,2>{0.859518349f, 0.413913071f},
-std::array<float,2>{0.74832207f, 0.687279046f},
-std::array<float,2>{0.0452109687f, 0.111697614f},
-std::array<float,2>{0.220701724f, 0.520436883f},
-std::array<float,2>{0.518648207f, 0.163068369f},
-std::array<float,2>{0.959980428f, 0.93314606f},
-std::array<float,2>{0.453345299f, 0.272922009f},
-std::array<float,2>{0.175206497f, 0.857088566f},
-std::array<float,2>{0.602175951f, 0.476088315f},
-std::array<float,2>{0.921091974f, 0.715579748f},
-std::array<float,2>{0.398605138f, 0.0558877885f},
-std::array<float,2>{0.373799801f, 0.579978049f},
-std::array<float,2>{0.798278511f, 0.237562746f},
-std::array<float,2>{0.681033969f, 0.964583874f},
-std::array<float,2>{0.0720538795f, 0.368777841f},
-std::array<float,2>{0.482486278f, 0.89597553f},
-std::array<float,2>{0.997861207f, 0.283140481f},
-std::array<float,2>{0.537015438f, 0.556342065f},
-std::array<float,2>{0.205144063f, 0.145946056f},
-std::array<float,2>{0.0153527251f, 0.645223558f},
-std::array<float,2>{0.688836098f, 0.090849638f},
-std::array<float,2>{0.837274909f, 0.79495132f},
-std::array<float,2>{0.25564906f, 0.403764039f},
-std::array<float,2>{0.0596521944f, 0.806372702f},
-std::array<float,2>{0.721095741f, 0.389356911f},
-std::array<float,2>{0.854292393f, 0.625983536f},
-std::array<float,2>{0.304354429f, 0.0668391436f},
-std::array<float,2>{0.446912616f, 0.543991685f},
-std::array<float,2>{0.94091171f, 0.132665604f},
-std::array<float,2>{0.501919568f, 0.883881152f},
-std::array<float,2>{0.239194974f, 0.308859736f},
-std::array<float,2>{0.314016461f, 0.937906802f},
-std::array<float,2>{0.764975131f, 0.351941586f},
-std::array<float,2>{0.636741161f, 0.567779183f},
-std::array<float,2>{0.102558091f, 0.232388005f},
-std::array<float,2>{0.128114074f, 0.700149477f},
-std::array<float,2>{0.593299508f, 0.0455592237f},
-std::array<float,2>{0.877403557f, 0.866838276f},
-std::array<float,2>{0.432292193f, 0.496449143f},
-std::array<float,2>{0.193504959f, 0.919934571f},
-std::array<float,2>{0.561513066f, 0.255099565f},
-std::array<float,2>{0.980347633f, 0.505917966f},
-std::array<float,2>{0.484388173f, 0.182687923f},
-std::array<float,2>{0.277792364f, 0.665677428f},
-std::array<float,2>{0.815310538f, 0.108745523f},
-std::array<float,2>{0.714187205f, 0.760424852f},
-std::array<float,2>{0.0311781857f, 0.424965471f},
-std::array<float,2>{0.379311651f, 0.839411438f},
-std::array<float,2>{0.935015023f, 0.463645309f},
-std::array<float,2>{0.623805285f, 0.733412266f},
-std::array<float,2>{0.164903671f, 0.0138489539f},
-std::array<float,2>{0.0912231579f, 0.604827225f},
-std::array<float,2>{0.662791669f, 0.209210023f},
-std::array<float,2>{0.792211592f, 0.98858726f},
-std::array<float,2>{0.357579768f, 0.336240023f},
-std::array<float,2>{0.0162828267f, 0.87505585f},
-std::array<float,2>{0.707206428f, 0.304157019f},
-std::array<float,2>{0.821432173f, 0.53803879f},
-std::array<float,2>{0.268600285f, 0.140163556f},
-std::array<float,2>{0.492830157f, 0.637033701f},
-std::array<float,2>{0.968862057f, 0.0755153f},
-std::array<float,2>{0.554499865f, 0.800440729f},
-std::array<float,2>{0.199513972f, 0.380096167f},
-std::array<float,2>{0.344486505f, 0.867408812f},
-std::array<float,2>{0.782084227f, 0.487434477f},
-std::array<float,2>{0.671233118f, 0.69382441f},
-std::array<float,2>{0.0827504173f, 0.0389563181f},
-std::array<float,2>{0.163094282f, 0.572452486f},
-std::array<float,2>{0.610023379f, 0.220109954f},
-std::array<float,2>{0.927716315f, 0.949357867f},
-std::array<float,2>{0.387821972f, 0.344264328f},
-std::array<float,2>{0.244826093f, 0.756040454f},
-std::array<float,2>{0.511601448f, 0.432120532f},
-std::array<float,2>{0.946834862f, 0.662946165f},
-std::array<float,2>{0.437684417f, 0.0970327705f},
-std::array<float,2>{0.311558694f, 0.508713603f},
-std::array<float,2>{0.85074234f, 0.176487356f},
-std::array<float,2>{0.731474459f, 0.90920639f},
-std::array<float,2>{0.0469963364f, 0.261830688f},
-std::array<float,2>{0.422296077f, 0.994539082f},
-std::array<float,2>{0.883304894f, 0.328848451f},
-std::array<float,2>{0.578738153f, 0.595046043f},
-std::array<float,2>{0.132928327f, 0.21649535f},
-std::array<float,2>{0.0947328284f, 0.724953175f},
-std::array<float,2>{0.628650606f, 0.00358377886f},
-std::array<float,2>{0.75427568f, 0.832053959f},
-std::array<float,2>{0.324437052f, 0.458384991f},
-std::array<float,2>{0.0702010989f, 0.821621358f},
-std::array<float,2>{0.677872896f, 0.450585842f},
-std::array<float,2>{0.806580424f, 0.746722162f},
-std::array<float,2>{0.365512729f, 0.0277605895f},
-std::array<float,2>{0.394220263f, 0.624878407f},
-std::array<float,2>{0.910786629f, 0.197323725f},
-std::array<float,2>{0.594046116f, 0.979026675f},
-std::array<float,2>{0.179764912f, 0.322780371f},
-std::array<float,2>{0.260645449f, 0.926127732f},
-std::array<float,2>{0.832897067f, 0.27665323f},
-std::array<float,2>{0.697871089f, 0.523791075f},
-std::array<float,2>{0.00379607594f, 0.170992225f},
-std::array<float,2>{0.214487046f, 0.678692818f},
-std::array<float,2>{0.539820075f, 0.117420241f},
-std::array<float,2>{0.986326218f, 0.765835345f},
-std::array<float,2>{0.47004059f, 0.416392803f},
-std::array<float,2>{0.152414009f, 0.954659104f},
-std::array<float,2>{0.576145053f, 0.365343899f},
-std::array<float,2>{0.906086922f, 0.593005598f},
-std::array<float,2>{0.414938182f, 0.24606587f},
-std::array<float,2>{0.335596323f, 0.705909073f},
-std::array<float,2>{0.777406991f, 0.0513793156f},
-std::array<float,2>{0.654762387f, 0.845198274f},
-std::array<float,2>{0.109472014f, 0.481275558f},
-std::array<float,2>{0.461648434f, 0.785132289f},
-std::array<float,2>{0.961678565f, 0.394451857f},
-std::array<float,2>{0.526789427f, 0.651061833f},
-std::array<float,2>{0.229301512f, 0.0789980814f},
-std::array<float,2>{0.0329170339f, 0.547182977f},
-std::array<float,2>{0.740967691f, 0.155943573f},
-std::array<float,2>{0.867275596f, 0.904955983f},
-std::array<float,2>{0.288491845f, 0.294967532f},
-std::array<float,2>{0.0806305259f, 0.935115218f},
-std::array<float,2>{0.667801917f, 0.268117338f},
-std::array<float,2>{0.785312533f, 0.519132257f},
-std::array<float,2>{0.348632783f, 0.156950787f},
-std::array<float,2>{0.384459734f, 0.679854929f},
-std::array<float,2>{0.922123194f, 0.11587172f},
-std::array<float,2>{0.61495775f, 0.779980242f},
-std::array<float,2>{0.158984616f, 0.408141017f},
-std::array<float,2>{0.272312671f, 0.817306578f},
-std::array<float,2>{0.827491224f, 0.438128293f},
-std::array<float,2>{0.703741312f, 0.735190094f},
-std::array<float,2>{0.0225100312f, 0.0185951944f},
-std::array<float,2>{0.198554695f, 0.614029706f},
-std::array<float,2>{0.549575448f, 0.193266854f},
-std::array<float,2>{0.975551188f, 0.96882242f},
-std::array<float,2>{0.497358143f, 0.312578738f},
-std::array<float,2>{0.137034297f, 0.792079508f},
-std::array<float,2>{0.583161414f, 0.398530334f},
-std::array<float,2>{0.889580011f, 0.642415166f},
-std::array<float,2>{0.428865492f, 0.0882662982f},
-std::array<float,2>{0.321688741f, 0.560196817f},
-std::array<float,2>{0.753261328f, 0.143805087f},
-std::array<float,2>{0.629653513f, 0.894317389f},
-std::array<float,2>{0.098946251f, 0.287443221f},
-std::array<float,2>{0.443506449f, 0.965805054f},
-std::array<float,2>{0.95277524f, 0.371188551f},
-std::array<float,2>{0.514515281f, 0.584622979f},
-std::array<float,2>{0.247243911f, 0.239968821f},
-std::array<float,2>{0.0535718091f, 0.713161826f},
-std::array<float,2>{0.729094088f, 0.0613483973f},
-std::array<float,2>{0.845636725f, 0.854972661f},
-std::array<float,2>{0.305691034f, 0.471451074f},
-std::array<float,2>{0.0044908016f, 0.860934079f},
-std::array<float,2>{0.699231446f, 0.492713064f},
-std::array<float,2>{0.828883648f, 0.697418392f},
-std::array<float,2>{0.264754534f, 0.0392342843f},
-std::array<float,2>{0.476069987f, 0.562513828f},
-std::array<float,2>{0.991871238f, 0.227762282f},
-std::array<float,2>{0.544398546f, 0.9429003f},
-std::array<float,2>{0.215650126f, 0.358689487f},
-std::array<float,2>{0.360252827f, 0.889463663f},
-std::array<float,2>{0.808659911f, 0.306878209f},
-std::array<float,2>{0.674610794f, 0.540252924f},
-std::array<float,2>{0.0625122041f, 0.126977816f},
-std::array<float,2>{0.185757488f, 0.632035792f},
-std::array<float,2>{0.599557221f, 0.063014172f},
-std::array<float,2>{0.908527434f, 0.812358737f},
-std::array<float,2>{0.394982755f, 0.383593887f},
-std::array<float,2>{0.23241359f, 0.986048996f},
-std::array<float,2>{0.529663563f, 0.343373358f},
-std::array<float,2>{0.968606949f, 0.605853915f},
-std::array<float,2>{0.467564881f, 0.205656484f},
-std::array<float,2>{0.283296734f, 0.728700757f},
-std::array<float,2>{0.873753846f, 0.00807050988f},
-std::array<float,2>{0.735412598f, 0.840086281f},
-std::array<float,2>{0.0367584489f, 0.468368351f},
-std::array<float,2>{0.420289218f, 0.763277054f},
-std::array<float,2>{0.899896145f, 0.426895589f},
-std::array<float,2>{0.571834624f, 0.670311809f},
-std::array<float,2>{0.152045757f, 0.104277723f},
-std::array<float,2>{0.11466036f, 0.501467466f},
-std::array<float,2>{0.650475681f, 0.186910197f},
-std::array<float,2>{0.775698841f, 0.915040672f},
-std::array<float,2>{0.330293864f, 0.253171325f},
-std::array<float,2>{0.0419267453f, 0.945859909f},
-std::array<float,2>{0.743424773f, 0.350304723f},
-std::array<float,2>{0.866402149f, 0.577466965f},
-std::array<float,2>{0.292222887f, 0.222813934f},
-std::array<float,2>{0.460229456f, 0.690499306f},
-std::array<float,2>{0.956048548f, 0.0317549333f},
-std::array<float,2>{0.52178508f, 0.873947799f},
-std::array<float,2>{0.225284487f, 0.489289045f},
-std::array<float,2>{0.339805722f, 0.804307938f},
-std::array<float,2>{0.772063971f, 0.377334654f},
-std::array<float,2>{0.644291341f, 0.633892715f},
-std::array<float,2>{0.123877741f, 0.0714871585f},
-std::array<float,2>{0.146346524f, 0.533243001f},
-std::array<float,2>{0.567316532f, 0.136453509f},
-std::array<float,2>{0.89174068f, 0.882440746f},
-std::array<float,2>{0.407443941f, 0.296875298f},
-std::array<float,2>{0.210685492f, 0.830519319f},
-std::array<float,2>{0.53369534f, 0.455932051f},
-std::array<float,2>{0.995000958f, 0.722397745f},
-std::array<float,2>{0.478589565f, 0.00442730868f},
-std::array<float,2>{0.250045836f, 0.600756586f},
-std::array<float,2>{0.842140257f, 0.214390025f},
-std::array<float,2>{0.693149745f, 0.99655956f},
-std::array<float,2>{0.00818310305f, 0.333671838f},
-std::array<float,2>{0.405704767f, 0.913824439f},
-std::array<float,2>{0.91681844f, 0.259253085f},
-std::array<float,2>{0.608163059f, 0.515049756f},
-std::array<float,2>{0.176660687f, 0.172593504f},
-std::array<float,2>{0.0752271041f, 0.657570899f},
-std::array<float,2>{0.684561074f, 0.101115696f},
-std::array<float,2>{0.802951097f, 0.753471076f},
-std::array<float,2>{0.369744956f, 0.435884684f},
-std::array<float,2>{0.108121403f, 0.770360172f},
-std::array<float,2>{0.635948718f, 0.418879211f},
-std::array<float,2>{0.758194029f, 0.673479319f},
-std::array<float,2>{0.319326043f, 0.121745653f},
-std::array<float,2>{0.43517971f, 0.528278232f},
-std::array<float,2>{0.880944252f, 0.167323127f},
-std::array<float,2>{0.589749515f, 0.924511254f},
-std::array<float,2>{0.132268459f, 0.277924687f},
-std::array<float,2>{0.297275752f, 0.980731189f},
-std::array<float,2>{0.856620252f, 0.325232625f},
-std::array<float,2>{0.723407269f, 0.620959103f},
-std::array<float,2>{0.0582467653f, 0.202456221f},
-std::array<float,2>{0.234452739f, 0.743668318f},
-std::array<float,2>{0.507644415f, 0.0243937895f},
-std::array<float,2>{0.941740096f, 0.826115012f},
-std::array<float,2>{0.451587111f, 0.448028147f},
-std::array<float,2>{0.168524683f, 0.901406705f},
-std::array<float,2>{0.619849563f, 0.292901874f},
-std::array<float,2>{0.932007968f, 0.552893102f},
-std::array<float,2>{0.377226681f, 0.151385441f},
-std::array<float,2>{0.352808714f, 0.652893364f},
-std::array<float,2>{0.795280278f, 0.0821863413f},
-std::array<float,2>{0.656628489f, 0.787696779f},
-std::array<float,2>{0.0868675932f, 0.395571262f},
-std::array<float,2>{0.489080906f, 0.848823547f},
-std::array<float,2>{0.982272863f, 0.478521526f},
-std::array<float,2>{0.556585371f, 0.70811069f},
-std::array<float,2>{0.190942302f, 0.0477496088f},
-std::array<float,2>{0.0239206515f, 0.589090049f},
-std::array<float,2>{0.715847433f, 0.246595114f},
-std::array<float,2>{0.819242477f, 0.96025449f},
-std::array<float,2>{0.27481693f, 0.362596005f},
-std::array<float,2>{0.0736690536f, 0.961139619f},
-std::array<float,2>{0.683182955f, 0.370164722f},
-std::array<float,2>{0.800454736f, 0.580492079f},
-std::array<float,2>{0.372048318f, 0.235677943f},
-std::array<float,2>{0.401371151f, 0.717666745f},
-std::array<float,2>{0.919490278f, 0.0570578016f},
-std::array<float,2>{0.604317963f, 0.858893931f},
-std::array<float,2>{0.172840118f, 0.473113388f},
-std::array<float,2>{0.256179333f, 0.793480575f},
-std::array<float,2>{0.838780642f, 0.406211436f},
-std::array<float,2>{0.69030869f, 0.648344874f},
-std::array<float,2>{0.0120502636f, 0.0927710086f},
-std::array<float,2>{0.204959482f, 0.556800663f},
-std::array<float,2>{0.537374258f, 0.147358179f},
-std::array<float,2>{0.9986251f, 0.898427308f},
-std::array<float,2>{0.480603427f, 0.283655196f},
-std::array<float,2>{0.140793905f, 0.814979613f},
-std::array<float,2>{0.563000619f, 0.442029655f},
-std::array<float,2>{0.897818863f, 0.738392949f},
-std::array<float,2>{0.410940975f, 0.0209626351f},
-std::array<float,2>{0.342948437f, 0.610929251f},
-std::array<float,2>{0.765650392f, 0.187564299f},
-std::array<float,2>{0.647710443f, 0.975784719f},
-std::array<float,2>{0.117530838f, 0.317973435f},
-std::array<float,2>{0.456472844f, 0.93032521f},
-std::array<float,2>{0.958955348f, 0.27113691f},
-std::array<float,2>{0.517439008f, 0.522574186f},
-std::array<float,2>{0.221738949f, 0.160361722f},
-std::array<float,2>{0.0440966114f, 0.684859991f},
-std::array<float,2>{0.747401834f, 0.110936828f},
-std::array<float,2>{0.86170125f, 0.77705431f},
-std::array<float,2>{0.293676734f, 0.411753893f},
-std::array<float,2>{0.0275936835f, 0.757862389f},
-std::array<float,2>{0.711550117f, 0.423763514f},
-std::array<float,2>{0.81313765f, 0.666702449f},
-std::array<float,2>{0.281050354f, 0.106086224f},
-std::array<float,2>{0.487174869f, 0.504447162f},
-std::array<float,2>{0.978181005f, 0.179797232f},
-std::array<float,2>{0.55898726f, 0.918166935f},
-std::array<float,2>{0.192691624f, 0.256847292f},
-std::array<float,2>{0.355785489f, 0.991092682f},
-std::array<float,2>{0.789626658f, 0.338572145f},
-std::array<float,2>{0.660757899f, 0.601709068f},
-std::array<float,2>{0.0919164643f, 0.207718387f},
-std::array<float,2>{0.166708663f, 0.731107712f},
-std::array<float,2>{0.622704029f, 0.0122864945f},
-std::array<float,2>{0.93586868f, 0.836241722f},
-std::array<float,2>{0.38190189f, 0.462156951f},
-std::array<float,2>{0.241523728f, 0.885145247f},
-std::array<float,2>{0.502622366f, 0.312105745f},
-std::array<float,2>{0.939201415f, 0.546132386f},
-std::array<float,2>{0.447734833f, 0.129083961f},
-std::array<float,2>{0.302148968f, 0.627959371f},
-std::array<float,2>{0.852530479f, 0.0693648309f},
-std::array<float,2>{0.720619738f, 0.806653976f},
-std::array<float,2>{0.0615229532f, 0.387047023f},
-std::array<float,2>{0.431170404f, 0.864229977f},
-std::array<float,2>{0.876646996f, 0.499537021f},
-std::array<float,2>{0.589861214f, 0.701704443f},
-std::array<float,2>{0.126074135f, 0.0438377038f},
-std::array<float,2>{0.104944199f, 0.5695225f},
-std::array<float,2>{0.638856232f, 0.233015925f},
-std::array<float,2>{0.762092471f, 0.940429509f},
-std::array<float,2>{0.315704077f, 0.354560226f},
-std::array<float,2>{0.0495769754f, 0.907813907f},
-std::array<float,2>{0.733145118f, 0.26467815f},
-std::array<float,2>{0.84915626f, 0.510729074f},
-std::array<float,2>{0.309292197f, 0.17929028f},
-std::array<float,2>{0.440097332f, 0.660772443f},
-std::array<float,2>{0.948073566f, 0.0949752554f},
-std::array<float,2>{0.508323431f, 0.754120231f},
-std::array<float,2>{0.244008303f, 0.430937052f},
-std::array<float,2>{0.326387197f, 0.835591733f},
-std::array<float,2>{0.757009327f, 0.459984541f},
-std::array<float,2>{0.62500608f, 0.724521637f},
-std::array<float,2>{0.095726952f, 0.000372083043f},
-std::array<float,2>{0.135275915f, 0.596514463f},
-std::array<float,2>{0.580780745f, 0.218712434f},
-std::array<float,2>{0.884917557f, 0.993432701f},
-std::array<float,2>{0.425742f, 0.330801785f},
-std::array<float,2>{0.202326775f, 0.797717929f},
-std::array<float,2>{0.551846325f, 0.382562816f},
-std::array<float,2>{0.970883965f, 0.640122533f},
-std::array<float,2>{0.495928854f, 0.0769631714f},
-std::array<float,2>{0.266939342f, 0.536844611f},
-std::array<float,2>{0.823586702f, 0.137365282f},
-std::array<float,2>{0.710553706f, 0.878276169f},
-std::array<float,2>{0.0182864666f, 0.300865263f},
-std::array<float,2>{0.39035207f, 0.952555597f},
-std::array<float,2>{0.929362833f, 0.346737534f},
-std::array<float,2>{0.61160022f, 0.571668029f},
-std::array<float,2>{0.160802975f, 0.22127521f},
-std::array<float,2>{0.0846329555f, 0.691441715f},
-std::array<float,2>{0.668958724f, 0.0358034484f},
-std::array<float,2>{0.785112441f, 0.870259821f},
-std::array<float,2>{0.347091466f, 0.485881984f},
-std::array<float,2>{0.111829683f, 0.846310735f},
-std::array<float,2>{0.653490424f, 0.483640105f},
-std::array<float,2>{0.780219257f, 0.703371525f},
-std::array<float,2>{0.33221212f, 0.052749265f},
-std::array<float,2>{0.416175216f, 0.591039479f},
-std::array<float,2>{0.902480364f, 0.243268713f},
-std::array<float,2>{0.577280343f, 0.95551157f},
-std::array<float,2>{0.155234993f, 0.363501787f},
-std::array<float,2>{0.285259038f, 0.904052436f},
-std::array<float,2>{0.869370162f, 0.293009609f},
-std::array<float,2>{0.739199877f, 0.550773919f},
-std::array<float,2>{0.0332097672f, 0.153858498f},
-std::array<float,2>{0.227952585f, 0.649874926f},
-std::array<float,2>{0.52399379f, 0.0811751485f},
-std::array<float,2>{0.964059353f, 0.782528877f},
-std::array<float,2>{0.463135451f, 0.390844166f},
-std::array<float,2>{0.18325673f, 0.97780931f},
-std::array<float,2>{0.595895708f, 0.32073772f},
-std::array<float,2>{0.912799537f, 0.622017026f},
-std::array<float,2>{0.39163062f, 0.196197495f},
-std::array<float,2>{0.364314526f, 0.749664843f},
-std::array<float,2>{0.806706905f, 0.0304564014f},
-std::array<float,2>{0.677223563f, 0.82294929f},
-std::array<float,2>{0.0679743439f, 0.453112572f},
-std::array<float,2>{0.47239086f, 0.768580556f},
-std::array<float,2>{0.987538338f, 0.414632767f},
-std::array<float,2>{0.54215461f, 0.676066697f},
-std::array<float,2>{0.212428421f, 0.120206177f},
-std::array<float,2>{0.000144271078f, 0.525851607f},
-std::array<float,2>{0.69664228f, 0.169161022f},
-std::array<float,2>{0.835526049f, 0.928155243f},
-std::array<float,2>{0.25929594f, 0.274944037f},
-std::array<float,2>{0.100523092f, 0.891758442f},
-std::array<float,2>{0.631859839f, 0.286549062f},
-std::array<float,2>{0.751585901f, 0.561494768f},
-std::array<float,2>{0.322975248f, 0.140925705f},
-std::array<float,2>{0.427604824f, 0.644267917f},
-std::array<float,2>{0.887125194f, 0.0874475539f},
-std::array<float,2>{0.584374249f, 0.789307177f},
-std::array<float,2>{0.140373811f, 0.401131719f},
-std::array<float,2>{0.3085531f, 0.851956189f},
-std::array<float,2>{0.84640187f, 0.469157517f},
-std::array<float,2>{0.727394342f, 0.711810172f},
-std::array<float,2>{0.0509446822f, 0.058994174f},
-std::array<float,2>{0.248804167f, 0.582360268f},
-std::array<float,2>{0.512308836f, 0.241885513f},
-std::array<float,2>{0.949384749f, 0.96702677f},
-std::array<float,2>{0.442525417f, 0.374436408f},
-std::array<float,2>{0.156701997f, 0.778783321f},
-std::array<float,2>{0.616981268f, 0.409150332f},
-std::array<float,2>{0.925649405f, 0.681768477f},
-std::array<float,2>{0.385384291f, 0.114339754f},
-std::array<float,2>{0.350387365f, 0.516326308f},
-std::array<float,2>{0.78754425f, 0.159603491f},
-std::array<float,2>{0.664991379f, 0.93589735f},
-std::array<float,2>{0.0794551894f, 0.265713602f},
-std::array<float,2>{0.498281747f, 0.971308231f},
-std::array<float,2>{0.97301048f, 0.316350162f},
-std::array<float,2>{0.546999693f, 0.61626178f},
-std::array<float,2>{0.195948854f, 0.194199398f},
-std::array<float,2>{0.020111002f, 0.738224506f},
-std::array<float,2>{0.706094623f, 0.0159611702f},
-std::array<float,2>{0.82471776f, 0.819606781f},
-std::array<float,2>{0.270624906f, 0.439756095f},
-std::array<float,2>{0.0379689112f, 0.843523145f},
-std::array<float,2>{0.737558961f, 0.465230078f},
-std::array<float,2>{0.872918427f, 0.727193415f},
-std::array<float,2>{0.281564862f, 0.0103148669f},
-std::array<float,2>{0.465869248f, 0.608985901f},
-std::array<float,2>{0.966005147f, 0.203672037f},
-std::array<float,2>{0.527852178f, 0.987768173f},
-std::array<float,2>{0.233306065f, 0.341421485f},
-std::array<float,2>{0.329100341f, 0.916287661f},
-std::array<float,2>{0.774152875f, 0.251517266f},
-std::array<float,2>{0.649446845f, 0.502352655f},
-std::array<float,2>{0.115829051f, 0.183617219f},
-std::array<float,2>{0.149091944f, 0.669106007f},
-std::array<float,2>{0.572517514f, 0.102456361f},
-std::array<float,2>{0.901754677f, 0.764558434f},
-std::array<float,2>{0.41872701f, 0.429092735f},
-std::array<float,2>{0.216907129f, 0.943762183f},
-std::array<float,2>{0.546031237f, 0.357289404f},
-std::array<float,2>{0.988567114f, 0.56620276f},
-std::array<float,2>{0.473179221f, 0.22869122f},
-std::array<float,2>{0.26195091f, 0.696047187f},
-std::array<float,2>{0.831797719f, 0.0421775132f},
-std::array<float,2>{0.701993406f, 0.862846017f},
-std::array<float,2>{0.00769096753f, 0.494940609f},
-std::array<float,2>{0.3980335f, 0.810457349f},
-std::array<float,2>{0.907956719f, 0.385160804f},
-std::array<float,2>{0.600107431f, 0.629594624f},
-std::array<float,2>{0.18470259f, 0.0656214282f},
-std::array<float,2>{0.0646680146f, 0.542368591f},
-std::array<float,2>{0.673456371f, 0.125200912f},
-std::array<float,2>{0.812032044f, 0.888373196f},
-std::array<float,2>{0.361555457f, 0.304739535f},
-std::array<float,2>{0.0106483623f, 0.999667704f},
-std::array<float,2>{0.69402051f, 0.335476637f},
-std::array<float,2>{0.841522634f, 0.599609137f},
-std::array<float,2>{0.252884358f, 0.211465999f},
-std::array<float,2>{0.477543771f, 0.718980551f},
-std::array<float,2>{0.993101954f, 0.00650013518f},
-std::array<float,2>{0.533042848f, 0.829469979f},
-std::array<float,2>{0.208225593f, 0.454557627f},
-std::array<float,2>{0.368629336f, 0.751661062f},
-std::array<float,2>{0.802312136f, 0.434250385f},
-std::array<float,2>{0.686668277f, 0.660014331f},
-std::array<float,2>{0.07787361f, 0.0985583663f},
-std::array<float,2>{0.178143665f, 0.511920214f},
-std::array<float,2>{0.607224524f, 0.173865229f},
-std::array<float,2>{0.915378988f, 0.911981344f},
-std::array<float,2>{0.402999341f, 0.260204285f},
-std::array<float,2>{0.224216387f, 0.871560752f},
-std::array<float,2>{0.521328986f, 0.490305632f},
-std::array<float,2>{0.953323543f, 0.688045263f},
-std::array<float,2>{0.458418757f, 0.0346723683f},
-std::array<float,2>{0.290689707f, 0.574284434f},
-std::array<float,2>{0.863528132f, 0.225661919f},
-std::array<float,2>{0.745042324f, 0.947779655f},
-std::array<float,2>{0.0408036634f, 0.348873645f},
-std::array<float,2>{0.408778876f, 0.879741848f},
-std::array<float,2>{0.89386797f, 0.300445586f},
-std::array<float,2>{0.568516314f, 0.532211304f},
-std::array<float,2>{0.146932587f, 0.133604631f},
-std::array<float,2>{0.12220823f, 0.634772837f},
-std::array<float,2>{0.642433584f, 0.0722738802f},
-std::array<float,2>{0.770142257f, 0.802113891f},
-std::array<float,2>{0.336111277f, 0.375787884f},
-std::array<float,2>{0.0886100903f, 0.786515951f},
-std::array<float,2>{0.65885824f, 0.39777261f},
-std::array<float,2>{0.794246137f, 0.655272484f},
-std::array<float,2>{0.355019629f, 0.0852157995f},
-std::array<float,2>{0.376816928f, 0.551838219f},
-std::array<float,2>{0.931549609f, 0.1500386f},
-std::array<float,2>{0.618146539f, 0.898941398f},
-std::array<float,2>{0.170734465f, 0.289400637f},
-std::array<float,2>{0.275446385f, 0.958220959f},
-std::array<float,2>{0.817268848f, 0.360308558f},
-std::array<float,2>{0.717275977f, 0.586868882f},
-std::array<float,2>{0.0260629058f, 0.24869968f},
-std::array<float,2>{0.187956482f, 0.709441781f},
-std::array<float,2>{0.556666851f, 0.0499266945f},
-std::array<float,2>{0.984066188f, 0.849981248f},
-std::array<float,2>{0.492108375f, 0.476608485f},
-std::array<float,2>{0.129423693f, 0.922327518f},
-std::array<float,2>{0.586213589f, 0.280828834f},
-std::array<float,2>{0.879195929f, 0.529401302f},
-std::array<float,2>{0.435812443f, 0.164409697f},
-std::array<float,2>{0.317001343f, 0.674439788f},
-std::array<float,2>{0.760893762f, 0.123960972f},
-std::array<float,2>{0.634676278f, 0.772556484f},
-std::array<float,2>{0.106561378f, 0.420318305f},
-std::array<float,2>{0.450829923f, 0.827866077f},
-std::array<float,2>{0.944329977f, 0.446377724f},
-std::array<float,2>{0.504638314f, 0.744718909f},
-std::array<float,2>{0.238179177f, 0.0259731933f},
-std::array<float,2>{0.054927025f, 0.618661284f},
-std::array<float,2>{0.72587502f, 0.200885519f},
-std::array<float,2>{0.858858168f, 0.984355211f},
-std::array<float,2>{0.298870176f, 0.327596158f},
-std::array<float,2>{0.0981011912f, 0.967130721f},
-std::array<float,2>{0.629944384f, 0.374259979f},
-std::array<float,2>{0.752341092f, 0.582162023f},
-std::array<float,2>{0.320818305f, 0.242097795f},
-std::array<float,2>{0.428172499f, 0.711648047f},
-std::array<float,2>{0.89019227f, 0.0587103777f},
-std::array<float,2>{0.582747996f, 0.851646245f},
-std::array<float,2>{0.138138115f, 0.468850344f},
-std::array<float,2>{0.304725885f, 0.789234698f},
-std::array<float,2>{0.8446908f, 0.401111007f},
-std::array<float,2>{0.729650557f, 0.644377291f},
-std::array<float,2>{0.0544823036f, 0.087877214f},
-std::array<float,2>{0.246279329f, 0.561094999f},
-std::array<float,2>{0.515078843f, 0.140845045f},
-std::array<float,2>{0.951923728f, 0.891848862f},
-std::array<float,2>{0.444924593f, 0.286245257f},
-std::array<float,2>{0.159829527f, 0.819411457f},
-std::array<float,2>{0.614003301f, 0.439469725f},
-std::array<float,2>{0.92367667f, 0.737820864f},
-std::array<float,2>{0.382845819f, 0.015645016f},
-std::array<float,2>{0.349570304f, 0.616522431f},
-std::array<float,2>{0.786479771f, 0.193918556f},
-std::array<float,2>{0.666487336f, 0.971514165f},
-std::array<float,2>{0.0811377913f, 0.316062421f},
-std::array<float,2>{0.496879369f, 0.935634553f},
-std::array<float,2>{0.9762609f, 0.266049415f},
-std::array<float,2>{0.550760865f, 0.516575933f},
-std::array<float,2>{0.197487503f, 0.159413725f},
-std::array<float,2>{0.0221422147f, 0.681906283f},
-std::array<float,2>{0.705072403f, 0.114681214f},
-std::array<float,2>{0.826190591f, 0.778554916f},
-std::array<float,2>{0.273190379f, 0.408918381f},
-std::array<float,2>{0.0355259925f, 0.764257312f},
-std::array<float,2>{0.734892309f, 0.428824842f},
-std::array<float,2>{0.874705911f, 0.6693905f},
-std::array<float,2>{0.284538746f, 0.102241151f},
-std::array<float,2>{0.467899531f, 0.50209713f},
-std::array<float,2>{0.967338681f, 0.184044972f},
-std::array<float,2>{0.53108871f, 0.916049063f},
-std::array<float,2>{0.231353804f, 0.25184688f},
-std::array<float,2>{0.331203818f, 0.987457752f},
-std::array<float,2>{0.776753485f, 0.341719776f},
-std::array<float,2>{0.652201772f, 0.609257102f},
-std::array<float,2>{0.113462567f, 0.20387356f},
-std::array<float,2>{0.151256606f, 0.727459788f},
-std::array<float,2>{0.570979834f, 0.0105319219f},
-std::array<float,2>{0.898744166f, 0.843413055f},
-std::array<float,2>{0.421601117f, 0.465013951f},
-std::array<float,2>{0.216399863f, 0.888465226f},
-std::array<float,2>{0.543759584f, 0.304980844f},
-std::array<float,2>{0.990823984f, 0.54223001f},
-std::array<float,2>{0.475156933f, 0.125467345f},
-std::array<float,2>{0.264405012f, 0.629656196f},
-std::array<float,2>{0.830045283f, 0.0658591092f},
-std::array<float,2>{0.700973094f, 0.810258508f},
-std::array<float,2>{0.00575283775f, 0.384958714f},
-std::array<float,2>{0.395814925f, 0.863079309f},
-std::array<float,2>{0.909659982f, 0.494675934f},
-std::array<float,2>{0.598592937f, 0.695928812f},
-std::array<float,2>{0.186528713f, 0.0422804393f},
-std::array<float,2>{0.0635191053f, 0.566026449f},
-std::array<float,2>{0.675259531f, 0.228849739f},
-std::array<float,2>{0.810015023f, 0.943464994f},
-std::array<float,2>{0.360733896f, 0.35714516f},
-std::array<float,2>{0.00934440643f, 0.911773026f},
-std::array<float,2>{0.691972911f, 0.259789973f},
-std::array<float,2>{0.843073189f, 0.511988878f},
-std::array<float,2>{0.25153935f, 0.174107954f},
-std::array<float,2>{0.47965765f, 0.659669399f},
-std::array<float,2>{0.99546349f, 0.0982006043f},
-std::array<float,2>{0.53508538f, 0.751776159f},
-std::array<float,2>{0.209714368f, 0.434529722f},
-std::array<float,2>{0.370320648f, 0.829129279f},
-std::array<float,2>{0.803820908f, 0.454266131f},
-std::array<float,2>{0.684974492f, 0.719155014f},
-std::array<float,2>{0.0751078129f, 0.00682941498f},
-std::array<float,2>{0.177592382f, 0.599223971f},
-std::array<float,2>{0.60865736f, 0.211878404f},
-std::array<float,2>{0.917370498f, 0.99987489f},
-std::array<float,2>{0.404647261f, 0.335735142f},
-std::array<float,2>{0.226040393f, 0.801761568f},
-std::array<float,2>{0.523199081f, 0.375587165f},
-std::array<float,2>{0.956610262f, 0.635182023f},
-std::array<float,2>{0.459394187f, 0.0725332499f},
-std::array<float,2>{0.291538686f, 0.531743348f},
-std::array<float,2>{0.865552425f, 0.133471847f},
-std::array<float,2>{0.742360711f, 0.879559755f},
-std::array<float,2>{0.0428460762f, 0.300668985f},
-std::array<float,2>{0.406988114f, 0.948005378f},
-std::array<float,2>{0.890973032f, 0.349076688f},
-std::array<float,2>{0.567712009f, 0.574667394f},
-std::array<float,2>{0.145076916f, 0.225935981f},
-std::array<float,2>{0.124992684f, 0.688304186f},
-std::array<float,2>{0.64283222f, 0.0351053886f},
-std::array<float,2>{0.772992969f, 0.871250868f},
-std::array<float,2>{0.337920278f, 0.490596831f},
-std::array<float,2>{0.08727853f, 0.849687338f},
-std::array<float,2>{0.657793701f, 0.477022767f},
-std::array<float,2>{0.795997858f, 0.70908004f},
-std::array<float,2>{0.352239788f, 0.0500533059f},
-std::array<float,2>{0.378242046f, 0.586668551f},
-std::array<float,2>{0.933525741f, 0.248800859f},
-std::array<float,2>{0.620950997f, 0.958357453f},
-std::array<float,2>{0.169700131f, 0.360084772f},
-std::array<float,2>{0.273802638f, 0.899335206f},
-std::array<float,2>{0.819708943f, 0.289191693f},
-std::array<float,2>{0.715141594f, 0.552016079f},
-std::array<float,2>{0.0251454376f, 0.150275454f},
-std::array<float,2>{0.189799264f, 0.654810846f},
-std::array<float,2>{0.555240512f, 0.0851649195f},
-std::array<float,2>{0.981355906f, 0.786288202f},
-std::array<float,2>{0.489915073f, 0.397475213f},
-std::array<float,2>{0.131293342f, 0.984078407f},
-std::array<float,2>{0.588743269f, 0.327287048f},
-std::array<float,2>{0.882622182f, 0.619135976f},
-std::array<float,2>{0.433895528f, 0.20111002f},
-std::array<float,2>{0.320039719f, 0.744930804f},
-std::array<float,2>{0.759432614f, 0.0262267254f},
-std::array<float,2>{0.63556087f, 0.828009605f},
-std::array<float,2>{0.109005779f, 0.446761072f},
-std::array<float,2>{0.452761263f, 0.772926033f},
-std::array<float,2>{0.942604721f, 0.420163393f},
-std::array<float,2>{0.506330252f, 0.67476356f},
-std::array<float,2>{0.23576726f, 0.123687223f},
-std::array<float,2>{0.0573153421f, 0.529555202f},
-std::array<float,2>{0.724493504f, 0.164115682f},
-std::array<float,2>{0.855647504f, 0.92190814f},
-std::array<float,2>{0.297908515f, 0.28120479f},
-std::array<float,2>{0.0708138272f, 0.897974849f},
-std::array<float,2>{0.680247128f, 0.28335911f},
-std::array<float,2>{0.797001004f, 0.557113945f},
-std::array<float,2>{0.374963582f, 0.147142813f},
-std::array<float,2>{0.399715215f, 0.648173749f},
-std::array<float,2>{0.920449436f, 0.0924516767f},
-std::array<float,2>{0.603030503f, 0.793925941f},
-std::array<float,2>{0.17430985f, 0.405893892f},
-std::array<float,2>{0.254705071f, 0.859343648f},
-std::array<float,2>{0.83666724f, 0.472674757f},
-std::array<float,2>{0.687583327f, 0.717395723f},
-std::array<float,2>{0.0142043801f, 0.0568645373f},
-std::array<float,2>{0.206735149f, 0.58019501f},
-std::array<float,2>{0.535226583f, 0.235477835f},
-std::array<float,2>{0.996552825f, 0.961231232f},
-std::array<float,2>{0.484263718f, 0.370493323f},
-std::array<float,2>{0.144151285f, 0.777194321f},
-std::array<float,2>{0.565427423f, 0.412086636f},
-std::array<float,2>{0.896027982f, 0.684739888f},
-std::array<float,2>{0.41218093f, 0.111306079f},
-std::array<float,2>{0.339992434f, 0.522871375f},
-std::array<float,2>{0.768630028f, 0.160535604f},
-std::array<float,2>{0.646352053f, 0.930660427f},
-std::array<float,2>{0.119395807f, 0.271372974f},
-std::array<float,2>{0.454110444f, 0.976069212f},
-std::array<float,2>{0.959862411f, 0.318249911f},
-std::array<float,2>{0.517847955f, 0.611229956f},
-std::array<float,2>{0.219486564f, 0.187833339f},
-std::array<float,2>{0.0468744487f, 0.738677859f},
-std::array<float,2>{0.749872923f, 0.0207061581f},
-std::array<float,2>{0.860479951f, 0.815359056f},
-std::array<float,2>{0.295304596f, 0.442216784f},
-std::array<float,2>{0.0295324177f, 0.836037219f},
-std::array<float,2>{0.712978005f, 0.46238932f},
-std::array<float,2>{0.815748632f, 0.731396556f},
-std::array<float,2>{0.278684318f, 0.0124780163f},
-std::array<float,2>{0.486206323f, 0.60197103f},
-std::array<float,2>{0.978743851f, 0.20782274f},
-std::array<float,2>{0.562065005f, 0.990897536f},
-std::array<float,2>{0.194419503f, 0.338770986f},
-std::array<float,2>{0.358613372f, 0.918437064f},
-std::array<float,2>{0.791591644f, 0.257244796f},
-std::array<float,2>{0.663322985f, 0.504786313f},
-std::array<float,2>{0.09068802f, 0.180036053f},
-std::array<float,2>{0.165824547f, 0.666916013f},
-std::array<float,2>{0.624337018f, 0.106435172f},
-std::array<float,2>{0.934447169f, 0.758217275f},
-std::array<float,2>{0.380036324f, 0.423563868f},
-std::array<float,2>{0.239845917f, 0.940167248f},
-std::array<float,2>{0.500273883f, 0.354748577f},
-std::array<float,2>{0.939546108f, 0.569800794f},
-std::array<float,2>{0.445347875f, 0.233371451f},
-std::array<float,2>{0.303270459f, 0.702040851f},
-std::array<float,2>{0.855147779f, 0.0436157249f},
-std::array<float,2>{0.722108185f, 0.863908589f},
-std::array<float,2>{0.0590831563f, 0.499826878f},
-std::array<float,2>{0.432973713f, 0.806995392f},
-std::array<float,2>{0.877946615f, 0.38685587f},
-std::array<float,2>{0.592399538f, 0.628399491f},
-std::array<float,2>{0.127077743f, 0.0697395429f},
-std::array<float,2>{0.102478787f, 0.546207488f},
-std::array<float,2>{0.637767196f, 0.129312932f},
-std::array<float,2>{0.764391065f, 0.884914041f},
-std::array<float,2>{0.313466758f, 0.312273979f},
-std::array<float,2>{0.0481252372f, 0.993405282f},
-std::array<float,2>{0.73110944f, 0.330991536f},
-std::array<float,2>{0.849635482f, 0.596283317f},
-std::array<float,2>{0.310625643f, 0.218273401f},
-std::array<float,2>{0.438690662f, 0.724258006f},
-std::array<float,2>{0.945458472f, 0.00010402035f},
-std::array<float,2>{0.510187209f, 0.835700333f},
-std::array<float,2>{0.24558863f, 0.460277736f},
-std::array<float,2>{0.325431556f, 0.75419724f},
-std::array<float,2>{0.755167902f, 0.430673331f},
-std::array<float,2>{0.627661169f, 0.661037326f},
-std::array<float,2>{0.0944998562f, 0.0949222893f},
-std::array<float,2>{0.134401098f, 0.510335207f},
-std::array<float,2>{0.579414725f, 0.179590583f},
-std::array<float,2>{0.884031057f, 0.908159494f},
-std::array<float,2>{0.423727781f, 0.264906645f},
-std::array<float,2>{0.200265601f, 0.870415032f},
-std::array<float,2>{0.553265274f, 0.486284822f},
-std::array<float,2>{0.97036171f, 0.691797912f},
-std::array<float,2>{0.493822604f, 0.0358903855f},
-std::array<float,2>{0.268537283f, 0.571513057f},
-std::array<float,2>{0.821075737f, 0.221635804f},
-std::array<float,2>{0.708573461f, 0.952187777f},
-std::array<float,2>{0.0172002763f, 0.347108573f},
-std::array<float,2>{0.387255937f, 0.878113329f},
-std::array<float,2>{0.926297367f, 0.301130325f},
-std::array<float,2>{0.611097813f, 0.53700155f},
-std::array<float,2>{0.162801877f, 0.137658715f},
-std::array<float,2>{0.0837439671f, 0.639840603f},
-std::array<float,2>{0.670829773f, 0.0767185763f},
-std::array<float,2>{0.782920063f, 0.797420025f},
-std::array<float,2>{0.345518917f, 0.382707655f},
-std::array<float,2>{0.110870436f, 0.782303095f},
-std::array<float,2>{0.656073391f, 0.391026437f},
-std::array<float,2>{0.779014528f, 0.649515688f},
-std::array<float,2>{0.334222794f, 0.0813614354f},
-std::array<float,2>{0.415246159f, 0.550379157f},
-std::array<float,2>{0.905261457f, 0.154088885f},
-std::array<float,2>{0.574936986f, 0.904094458f},
-std::array<float,2>{0.154187903f, 0.293365568f},
-std::array<float,2>{0.287451208f, 0.955192149f},
-std::array<float,2>{0.868529022f, 0.36362499f},
-std::array<float,2>{0.741260409f, 0.591234028f},
-std::array<float,2>{0.0321518891f, 0.243616596f},
-std::array<float,2>{0.229926437f, 0.703238189f},
-std::array<float,2>{0.525683463f, 0.0530896001f},
-std::array<float,2>{0.962512493f, 0.846603334f},
-std::array<float,2>{0.462577045f, 0.483873576f},
-std::array<float,2>{0.180805683f, 0.927763879f},
-std::array<float,2>{0.594973862f, 0.275155514f},
-std::array<float,2>{0.91209662f, 0.525455117f},
-std::array<float,2>{0.39338398f, 0.169312954f},
-std::array<float,2>{0.366758138f, 0.675914109f},
-std::array<float,2>{0.805134773f, 0.120386496f},
-std::array<float,2>{0.67913121f, 0.768893361f},
-std::array<float,2>{0.0685806051f, 0.414860129f},
-std::array<float,2>{0.469334126f, 0.823140919f},
-std::array<float,2>{0.984437108f, 0.452857018f},
-std::array<float,2>{0.540633798f, 0.749759376f},
-std::array<float,2>{0.213415638f, 0.0305515137f},
-std::array<float,2>{0.00210760185f, 0.621814966f},
-std::array<float,2>{0.699021935f, 0.195992768f},
-std::array<float,2>{0.833355248f, 0.977544248f},
-std::array<float,2>{0.261371583f, 0.320485502f},
-std::array<float,2>{0.0788141713f, 0.969150364f},
-std::array<float,2>{0.66593641f, 0.312987566f},
-std::array<float,2>{0.788762867f, 0.614007711f},
-std::array<float,2>{0.35145551f, 0.193112284f},
-std::array<float,2>{0.386131614f, 0.734945416f},
-std::array<float,2>{0.924677372f, 0.018920308f},
-std::array<float,2>{0.616075337f, 0.816947579f},
-std::array<float,2>{0.158051759f, 0.438282609f},
-std::array<float,2>{0.269875675f, 0.780065536f},
-std::array<float,2>{0.825370133f, 0.407851487f},
-std::array<float,2>{0.70586133f, 0.679971039f},
-std::array<float,2>{0.0210332796f, 0.116149597f},
-std::array<float,2>{0.197074458f, 0.519527316f},
-std::array<float,2>{0.548761606f, 0.157173485f},
-std::array<float,2>{0.974484801f, 0.935442269f},
-std::array<float,2>{0.499288261f, 0.268424809f},
-std::array<float,2>{0.139525026f, 0.854625046f},
-std::array<float,2>{0.585851789f, 0.471305221f},
-std::array<float,2>{0.888522625f, 0.713006556f},
-std::array<float,2>{0.426263541f, 0.0611753874f},
-std::array<float,2>{0.323711574f, 0.584850252f},
-std::array<float,2>{0.750955224f, 0.240164876f},
-std::array<float,2>{0.631548285f, 0.96536988f},
-std::array<float,2>{0.101374127f, 0.371511817f},
-std::array<float,2>{0.441740304f, 0.894271314f},
-std::array<float,2>{0.950814009f, 0.287161589f},
-std::array<float,2>{0.513451815f, 0.560496986f},
-std::array<float,2>{0.24927704f, 0.143734112f},
-std::array<float,2>{0.0527002737f, 0.642157316f},
-std::array<float,2>{0.727930307f, 0.0879063532f},
-std::array<float,2>{0.846720338f, 0.7923944f},
-std::array<float,2>{0.307439953f, 0.398805887f},
-std::array<float,2>{0.00612051832f, 0.812211573f},
-std::array<float,2>{0.702446222f, 0.383476317f},
-std::array<float,2>{0.830467403f, 0.632171452f},
-std::array<float,2>{0.263300329f, 0.0632934123f},
-std::array<float,2>{0.474375814f, 0.540314555f},
-std::array<float,2>{0.989486575f, 0.127375379f},
-std::array<float,2>{0.54499197f, 0.889199972f},
-std::array<float,2>{0.217995852f, 0.306984812f},
-std::array<float,2>{0.362431914f, 0.943318188f},
-std::array<float,2>{0.811027706f, 0.358581901f},
-std::array<float,2>{0.672144353f, 0.562866747f},
-std::array<float,2>{0.0659190193f, 0.227887169f},
-std::array<float,2>{0.184520409f, 0.697694838f},
-std::array<float,2>{0.600919425f, 0.0395469218f},
-std::array<float,2>{0.906498492f, 0.861272752f},
-std::array<float,2>{0.397456974f, 0.493064374f},
-std::array<float,2>{0.233956397f, 0.915383577f},
-std::array<float,2>{0.528327644f, 0.253361225f},
-std::array<float,2>{0.964949071f, 0.501833558f},
-std::array<float,2>{0.464982957f, 0.186630085f},
-std::array<float,2>{0.282958627f, 0.669928908f},
-std::array<float,2>{0.871485174f, 0.104082651f},
-std::array<float,2>{0.736769974f, 0.763631225f},
-std::array<float,2>{0.0384163857f, 0.427171469f},
-std::array<float,2>{0.419586897f, 0.840247214f},
-std::array<float,2>{0.901180685f, 0.46861288f},
-std::array<float,2>{0.573936462f, 0.728790224f},
-std::array<float,2>{0.150337696f, 0.00795230735f},
-std::array<float,2>{0.116526902f, 0.605489671f},
-std::array<float,2>{0.64891386f, 0.205914408f},
-std::array<float,2>{0.774675012f, 0.986256897f},
-std::array<float,2>{0.330068707f, 0.343570739f},
-std::array<float,2>{0.0400002785f, 0.882624805f},
-std::array<float,2>{0.74560535f, 0.297126859f},
-std::array<float,2>{0.864991188f, 0.533686578f},
-std::array<float,2>{0.289820582f, 0.136607602f},
-std::array<float,2>{0.457234472f, 0.634078205f},
-std::array<float,2>{0.954798937f, 0.0716640204f},
-std::array<float,2>{0.520476043f, 0.804502785f},
-std::array<float,2>{0.223414972f, 0.377023816f},
-std::array<float,2>{0.337677956f, 0.873712838f},
-std::array<float,2>{0.770569205f, 0.489682138f},
-std::array<float,2>{0.641421258f, 0.690711081f},
-std::array<float,2>{0.121865012f, 0.03218095f},
-std::array<float,2>{0.148125127f, 0.57738328f},
-std::array<float,2>{0.569851041f, 0.223142952f},
-std::array<float,2>{0.89272511f, 0.946058691f},
-std::array<float,2>{0.409550935f, 0.350462168f},
-std::array<float,2>{0.207555085f, 0.753792942f},
-std::array<float,2>{0.531703353f, 0.435662061f},
-std::array<float,2>{0.993436277f, 0.65742749f},
-std::array<float,2>{0.476692945f, 0.101415664f},
-std::array<float,2>{0.253471583f, 0.514696002f},
-std::array<float,2>{0.840677738f, 0.172672376f},
-std::array<float,2>{0.694414198f, 0.913689673f},
-std::array<float,2>{0.0115392758f, 0.258821696f},
-std::array<float,2>{0.403550327f, 0.996105075f},
-std::array<float,2>{0.914673686f, 0.333753854f},
-std::array<float,2>{0.605796278f, 0.600849211f},
-std::array<float,2>{0.178923294f, 0.214614093f},
-std::array<float,2>{0.0761719719f, 0.722549975f},
-std::array<float,2>{0.686268985f, 0.00464548916f},
-std::array<float,2>{0.801172316f, 0.830251276f},
-std::array<float,2>{0.367188424f, 0.455792636f},
-std::array<float,2>{0.106432326f, 0.825745881f},
-std::array<float,2>{0.633475244f, 0.447982311f},
-std::array<float,2>{0.760494113f, 0.744079113f},
-std::array<float,2>{0.317814887f, 0.0240886528f},
-std::array<float,2>{0.437321514f, 0.620687723f},
-std::array<float,2>{0.879936218f, 0.202161506f},
-std::array<float,2>{0.587437391f, 0.98069948f},
-std::array<float,2>{0.130149394f, 0.325629771f},
-std::array<float,2>{0.30008918f, 0.924610257f},
-std::array<float,2>{0.858102024f, 0.278173059f},
-std::array<float,2>{0.724660099f, 0.527935445f},
-std::array<float,2>{0.0557831228f, 0.16722554f},
-std::array<float,2>{0.236814812f, 0.673615336f},
-std::array<float,2>{0.504908204f, 0.122049101f},
-std::array<float,2>{0.944668472f, 0.770225823f},
-std::array<float,2>{0.449392974f, 0.41866383f},
-std::array<float,2>{0.171637565f, 0.960172117f},
-std::array<float,2>{0.618190527f, 0.36252299f},
-std::array<float,2>{0.930311799f, 0.589232087f},
-std::array<float,2>{0.375053853f, 0.247030824f},
-std::array<float,2>{0.354194373f, 0.708374023f},
-std::array<float,2>{0.793707728f, 0.0475929119f},
-std::array<float,2>{0.659223616f, 0.848908186f},
-std::array<float,2>{0.0896563977f, 0.478985786f},
-std::array<float,2>{0.490822762f, 0.788049698f},
-std::array<float,2>{0.98324585f, 0.395769507f},
-std::array<float,2>{0.558592141f, 0.653243601f},
-std::array<float,2>{0.188494325f, 0.0823030397f},
-std::array<float,2>{0.0268707462f, 0.553002596f},
-std::array<float,2>{0.718049049f, 0.151809841f},
-std::array<float,2>{0.818131506f, 0.901766002f},
-std::array<float,2>{0.27678737f, 0.292504132f},
-std::array<float,2>{0.118524902f, 0.933399677f},
-std::array<float,2>{0.646502018f, 0.27247721f},
-std::array<float,2>{0.767187893f, 0.520257413f},
-std::array<float,2>{0.342388302f, 0.16280362f},
-std::array<float,2>{0.411726058f, 0.68701309f},
-std::array<float,2>{0.897268772f, 0.111557201f},
-std::array<float,2>{0.563708246f, 0.773602962f},
-std::array<float,2>{0.141804978f, 0.413722068f},
-std::array<float,2>{0.294484526f, 0.813183367f},
-std::array<float,2>{0.862622082f, 0.444473535f},
-std::array<float,2>{0.747019649f, 0.740385652f},
-std::array<float,2>{0.0430478007f, 0.0221574847f},
-std::array<float,2>{0.221381485f, 0.613155007f},
-std::array<float,2>{0.516005158f, 0.190414146f},
-std::array<float,2>{0.957979798f, 0.973961234f},
-std::array<float,2>{0.455895156f, 0.319810838f},
-std::array<float,2>{0.172936708f, 0.79532975f},
-std::array<float,2>{0.605275154f, 0.40348804f},
-std::array<float,2>{0.918104053f, 0.645348787f},
-std::array<float,2>{0.400691152f, 0.0910729244f},
-std::array<float,2>{0.372170508f, 0.556419194f},
-std::array<float,2>{0.799090743f, 0.145726264f},
-std::array<float,2>{0.682083488f, 0.895631194f},
-std::array<float,2>{0.0728445798f, 0.282739908f},
-std::array<float,2>{0.481805176f, 0.964752495f},
-std::array<float,2>{0.999783516f, 0.368968129f},
-std::array<float,2>{0.538841963f, 0.579824865f},
-std::array<float,2>{0.203144655f, 0.237318516f},
-std::array<float,2>{0.0135407206f, 0.715512455f},
-std::array<float,2>{0.690927923f, 0.0561128557f},
-std::array<float,2>{0.839621544f, 0.857256234f},
-std::array<float,2>{0.257064849f, 0.476430327f},
-std::array<float,2>{0.0622448698f, 0.867127538f},
-std::array<float,2>{0.719168425f, 0.496228874f},
-std::array<float,2>{0.852846563f, 0.699825704f},
-std::array<float,2>{0.301138461f, 0.0457387157f},
-std::array<float,2>{0.448571861f, 0.567402422f},
-std::array<float,2>{0.937554359f, 0.232032105f},
-std::array<float,2>{0.50360769f, 0.937609911f},
-std::array<float,2>{0.240711123f, 0.351803005f},
-std::array<float,2>{0.314724028f, 0.884164572f},
-std::array<float,2>{0.763542056f, 0.308611929f},
-std::array<float,2>{0.640284717f, 0.544415176f},
-std::array<float,2>{0.104072377f, 0.132531941f},
-std::array<float,2>{0.125886932f, 0.626246452f},
-std::array<float,2>{0.591643155f, 0.0666338578f},
-std::array<float,2>{0.875081658f, 0.806542516f},
-std::array<float,2>{0.430130959f, 0.389566064f},
-std::array<float,2>{0.191742495f, 0.988490105f},
-std::array<float,2>{0.559815526f, 0.336012214f},
-std::array<float,2>{0.977451861f, 0.604630709f},
-std::array<float,2>{0.487903386f, 0.209315971f},
-std::array<float,2>{0.28025803f, 0.733663261f},
-std::array<float,2>{0.814298987f, 0.0141485641f},
-std::array<float,2>{0.712141395f, 0.839774728f},
-std::array<float,2>{0.0289375987f, 0.463584602f},
-std::array<float,2>{0.381426096f, 0.76060921f},
-std::array<float,2>{0.93738234f, 0.425100565f},
-std::array<float,2>{0.621298432f, 0.666009307f},
-std::array<float,2>{0.167386904f, 0.108576916f},
-std::array<float,2>{0.0936570093f, 0.506292045f},
-std::array<float,2>{0.661590576f, 0.182891101f},
-std::array<float,2>{0.790659845f, 0.920293629f},
-std::array<float,2>{0.356616229f, 0.255199283f},
-std::array<float,2>{0.0191580933f, 0.94964844f},
-std::array<float,2>{0.709849596f, 0.344699889f},
-std::array<float,2>{0.822402537f, 0.572655797f},
-std::array<float,2>{0.266037136f, 0.219797537f},
-std::array<float,2>{0.494752169f, 0.693530023f},
-std::array<float,2>{0.97200501f, 0.0385924987f},
-std::array<float,2>{0.551086605f, 0.86750859f},
-std::array<float,2>{0.201297924f, 0.487762719f},
-std::array<float,2>{0.345996618f, 0.800596356f},
-std::array<float,2>{0.78325671f, 0.380189598f},
-std::array<float,2>{0.66861248f, 0.636833787f},
-std::array<float,2>{0.0854949132f, 0.0752672553f},
-std::array<float,2>{0.161499828f, 0.537658691f},
-std::array<float,2>{0.612801075f, 0.140569761f},
-std::array<float,2>{0.928613842f, 0.875328839f},
-std::array<float,2>{0.38945514f, 0.303731024f},
-std::array<float,2>{0.243113145f, 0.832403183f},
-std::array<float,2>{0.508870959f, 0.458107442f},
-std::array<float,2>{0.949124575f, 0.724836409f},
-std::array<float,2>{0.441105127f, 0.00377972005f},
-std::array<float,2>{0.309794843f, 0.594825208f},
-std::array<float,2>{0.848058581f, 0.216764629f},
-std::array<float,2>{0.734322369f, 0.994329035f},
-std::array<float,2>{0.0498415455f, 0.328924417f},
-std::array<float,2>{0.424203753f, 0.909527302f},
-std::array<float,2>{0.885942638f, 0.261966318f},
-std::array<float,2>{0.581384957f, 0.508375287f},
-std::array<float,2>{0.13631542f, 0.176569059f},
-std::array<float,2>{0.0972092301f, 0.662601113f},
-std::array<float,2>{0.626922071f, 0.0967451558f},
-std::array<float,2>{0.756472588f, 0.756147683f},
-std::array<float,2>{0.32740736f, 0.431683064f},
-std::array<float,2>{0.0664789006f, 0.766049743f},
-std::array<float,2>{0.67649287f, 0.416044444f},
-std::array<float,2>{0.807999194f, 0.678235829f},
-std::array<float,2>{0.364176661f, 0.117521219f},
-std::array<float,2>{0.390981078f, 0.523528516f},
-std::array<float,2>{0.91343385f, 0.171178609f},
-std::array<float,2>{0.59708637f, 0.92595917f},
-std::array<float,2>{0.181882307f, 0.276598305f},
-std::array<float,2>{0.258210152f, 0.979421735f},
-std::array<float,2>{0.834354103f, 0.323028862f},
-std::array<float,2>{0.695382595f, 0.624747336f},
-std::array<float,2>{0.00162743474f, 0.19765152f},
-std::array<float,2>{0.211208984f, 0.746831656f},
-std::array<float,2>{0.541067839f, 0.0273666419f},
-std::array<float,2>{0.986620188f, 0.821434736f},
-std::array<float,2>{0.471625924f, 0.450239062f},
-std::array<float,2>{0.155541226f, 0.905065715f},
-std::array<float,2>{0.577125013f, 0.295303702f},
-std::array<float,2>{0.903710663f, 0.547022045f},
-std::array<float,2>{0.417484283f, 0.156066209f},
-std::array<float,2>{0.333183378f, 0.651152909f},
-std::array<float,2>{0.780808747f, 0.0786849633f},
-std::array<float,2>{0.652744889f, 0.784795046f},
-std::array<float,2>{0.113045864f, 0.394179076f},
-std::array<float,2>{0.464782923f, 0.84481293f},
-std::array<float,2>{0.963784516f, 0.480969816f},
-std::array<float,2>{0.525217175f, 0.705689788f},
-std::array<float,2>{0.226950288f, 0.0517250337f},
-std::array<float,2>{0.0344661437f, 0.593109787f},
-std::array<float,2>{0.739441097f, 0.245832175f},
-std::array<float,2>{0.870984972f, 0.954871774f},
-std::array<float,2>{0.286784142f, 0.365599453f},
-std::array<float,2>{0.114812128f, 0.985231042f},
-std::array<float,2>{0.65136224f, 0.342166573f},
-std::array<float,2>{0.776002526f, 0.606758773f},
-std::array<float,2>{0.330892026f, 0.206536576f},
-std::array<float,2>{0.420636952f, 0.729982138f},
-std::array<float,2>{0.900057793f, 0.00972232968f},
-std::array<float,2>{0.57129395f, 0.840960145f},
-std::array<float,2>{0.151782662f, 0.467193514f},
-std::array<float,2>{0.283850729f, 0.762260973f},
-std::array<float,2>{0.873097241f, 0.426211029f},
-std::array<float,2>{0.736326456f, 0.671331823f},
-std::array<float,2>{0.0364159048f, 0.104595952f},
-std::array<float,2>{0.231894627f, 0.500884235f},
-std::array<float,2>{0.529942095f, 0.186162531f},
-std::array<float,2>{0.968137085f, 0.914497972f},
-std::array<float,2>{0.467228264f, 0.252806246f},
-std::array<float,2>{0.186449289f, 0.859766126f},
-std::array<float,2>{0.599044085f, 0.493581563f},
-std::array<float,2>{0.908728957f, 0.6984092f},
-std::array<float,2>{0.395236164f, 0.0405126512f},
-std::array<float,2>{0.359526545f, 0.563829958f},
-std::array<float,2>{0.809285164f, 0.22725074f},
-std::array<float,2>{0.67419374f, 0.942274392f},
-std::array<float,2>{0.0630763471f, 0.357677966f},
-std::array<float,2>{0.476234436f, 0.889829576f},
-std::array<float,2>{0.991261244f, 0.308565795f},
-std::array<float,2>{0.544638932f, 0.539310515f},
-std::array<float,2>{0.214939833f, 0.128799751f},
-std::array<float,2>{0.00400491105f, 0.631696522f},
-std::array<float,2>{0.700098753f, 0.0635129884f},
-std::array<float,2>{0.828415155f, 0.810697019f},
-std::array<float,2>{0.26518172f, 0.383887172f},
-std::array<float,2>{0.0530649759f, 0.791717231f},
-std::array<float,2>{0.728612959f, 0.400192767f},
-std::array<float,2>{0.844818771f, 0.641532242f},
-std::array<float,2>{0.306525737f, 0.0892889202f},
-std::array<float,2>{0.443883657f, 0.559194624f},
-std::array<float,2>{0.952575624f, 0.142909825f},
-std::array<float,2>{0.513894796f, 0.892935812f},
-std::array<float,2>{0.247864604f, 0.288134962f},
-std::array<float,2>{0.322200805f, 0.966167629f},
-std::array<float,2>{0.753487468f, 0.372361958f},
-std::array<float,2>{0.629070401f, 0.585294724f},
-std::array<float,2>{0.0993875191f, 0.238687426f},
-std::array<float,2>{0.137277007f, 0.71401757f},
-std::array<float,2>{0.583708286f, 0.0619969591f},
-std::array<float,2>{0.889160097f, 0.854030073f},
-std::array<float,2>{0.429565489f, 0.471816868f},
-std::array<float,2>{0.198922306f, 0.933851242f},
-std::array<float,2>{0.549206376f, 0.269116044f},
-std::array<float,2>{0.975054324f, 0.51842773f},
-std::array<float,2>{0.498026192f, 0.157853246f},
-std::array<float,2>{0.271558106f, 0.681520164f},
-std::array<float,2>{0.827666342f, 0.116407216f},
-std::array<float,2>{0.703465462f, 0.780759335f},
-std::array<float,2>{0.0231445748f, 0.406655192f},
-std::array<float,2>{0.384006679f, 0.818136096f},
-std::array<float,2>{0.922558069f, 0.439021885f},
-std::array<float,2>{0.614368439f, 0.735798776f},
-std::array<float,2>{0.158289403f, 0.0185135659f},
-std::array<float,2>{0.0803836957f, 0.61483109f},
-std::array<float,2>{0.667378366f, 0.192082345f},
-std::array<float,2>{0.785882056f, 0.969782233f},
-std::array<float,2>{0.347850829f, 0.314050525f},
-std::array<float,2>{0.0240351353f, 0.900907397f},
-std::array<float,2>{0.716371477f, 0.291321695f},
-std::array<float,2>{0.818604231f, 0.553956509f},
-std::array<float,2>{0.275106251f, 0.150849417f},
-std::array<float,2>{0.488731474f, 0.653369308f},
-std::array<float,2>{0.981465161f, 0.0836315677f},
-std::array<float,2>{0.556055307f, 0.78813225f},
-std::array<float,2>{0.19051294f, 0.395176739f},
-std::array<float,2>{0.353386998f, 0.848572969f},
-std::array<float,2>{0.795427859f, 0.480141401f},
-std::array<float,2>{0.656804025f, 0.707401931f},
-std::array<float,2>{0.0864071772f, 0.0485121459f},
-std::array<float,2>{0.168146297f, 0.588493884f},
-std::array<float,2>{0.619168103f, 0.24745068f},
-std::array<float,2>{0.932421684f, 0.959728777f},
-std::array<float,2>{0.377765477f, 0.361664206f},
-std::array<float,2>{0.234893292f, 0.770798743f},
-std::array<float,2>{0.507251441f, 0.419222474f},
-std::array<float,2>{0.942187607f, 0.672608674f},
-std::array<float,2>{0.451800674f, 0.122650348f},
-std::array<float,2>{0.297534883f, 0.528698325f},
-std::array<float,2>{0.857201576f, 0.166266084f},
-std::array<float,2>{0.723079205f, 0.925431728f},
-std::array<float,2>{0.0577542856f, 0.278426021f},
-std::array<float,2>{0.435047179f, 0.981579602f},
-std::array<float,2>{0.881660998f, 0.3250902f},
-std::array<float,2>{0.588891745f, 0.619595885f},
-std::array<float,2>{0.132685989f, 0.201796919f},
-std::array<float,2>{0.107634895f, 0.74278599f},
-std::array<float,2>{0.636461973f, 0.0246280041f},
-std::array<float,2>{0.758627236f, 0.824474573f},
-std::array<float,2>{0.318795949f, 0.44886139f},
-std::array<float,2>{0.076097101f, 0.831763506f},
-std::array<float,2>{0.683966696f, 0.456768066f},
-std::array<float,2>{0.803382456f, 0.721467793f},
-std::array<float,2>{0.369212985f, 0.00506771868f},
-std::array<float,2>{0.406108975f, 0.599878669f},
-std::array<float,2>{0.916181624f, 0.213359877f},
-std::array<float,2>{0.607702971f, 0.997693181f},
-std::array<float,2>{0.176107243f, 0.332370669f},
-std::array<float,2>{0.250724286f, 0.91216898f},
-std::array<float,2>{0.842433751f, 0.258719921f},
-std::array<float,2>{0.692808509f, 0.514065683f},
-std::array<float,2>{0.00870181434f, 0.173719943f},
-std::array<float,2>{0.210429683f, 0.656800747f},
-std::array<float,2>{0.533268511f, 0.100252956f},
-std::array<float,2>{0.994213104f, 0.752368271f},
-std::array<float,2>{0.479329497f, 0.437157869f},
-std::array<float,2>{0.145703495f, 0.947060525f},
-std::array<float,2>{0.566860735f, 0.351548553f},
-std::array<float,2>{0.892143011f, 0.576778829f},
-std::array<float,2>{0.40818426f, 0.224522978f},
-std::array<float,2>{0.339130312f, 0.689910829f},
-std::array<float,2>{0.771677494f, 0.0328391381f},
-std::array<float,2>{0.643812358f, 0.874864399f},
-std::array<float,2>{0.12331944f, 0.488723516f},
-std::array<float,2>{0.460452586f, 0.802946627f},
-std::array<float,2>{0.955191016f, 0.378276169f},
-std::array<float,2>{0.522131026f, 0.632852137f},
-std::array<float,2>{0.224658847f, 0.0704495311f},
-std::array<float,2>{0.0414777026f, 0.534889281f},
-std::array<float,2>{0.744130194f, 0.135381803f},
-std::array<float,2>{0.867133975f, 0.881360829f},
-std::array<float,2>{0.292680383f, 0.298420459f},
-std::array<float,2>{0.091327019f, 0.921040177f},
-std::array<float,2>{0.662258625f, 0.254544497f},
-std::array<float,2>{0.79288733f, 0.507003129f},
-std::array<float,2>{0.357960582f, 0.181810632f},
-std::array<float,2>{0.379422575f, 0.664958775f},
-std::array<float,2>{0.935393214f, 0.108234055f},
-std::array<float,2>{0.623378277f, 0.761038303f},
-std::array<float,2>{0.164463893f, 0.424778998f},
-std::array<float,2>{0.277974427f, 0.838726163f},
-std::array<float,2>{0.814678311f, 0.463923931f},
-std::array<float,2>{0.714822412f, 0.732424438f},
-std::array<float,2>{0.0303157195f, 0.0152766993f},
-std::array<float,2>{0.193984941f, 0.604075432f},
-std::array<float,2>{0.560672343f, 0.210688159f},
-std::array<float,2>{0.97993052f, 0.990034521f},
-std::array<float,2>{0.485204041f, 0.337128699f},
-std::array<float,2>{0.128534079f, 0.805431783f},
-std::array<float,2>{0.592918873f, 0.389920205f},
-std::array<float,2>{0.877715886f, 0.625689507f},
-std::array<float,2>{0.431756198f, 0.0681353211f},
-std::array<float,2>{0.313527793f, 0.543850303f},
-std::array<float,2>{0.765362263f, 0.131743789f},
-std::array<float,2>{0.637245119f, 0.883004248f},
-std::array<float,2>{0.103351407f, 0.309800684f},
-std::array<float,2>{0.446512192f, 0.939372599f},
-std::array<float,2>{0.941243649f, 0.353385627f},
-std::array<float,2>{0.501100779f, 0.566732585f},
-std::array<float,2>{0.238665f, 0.231161281f},
-std::array<float,2>{0.0602990128f, 0.70060879f},
-std::array<float,2>{0.721229255f, 0.0459177159f},
-std::array<float,2>{0.85370189f, 0.865550339f},
-std::array<float,2>{0.30380106f, 0.497317731f},
-std::array<float,2>{0.014968574f, 0.855862617f},
-std::array<float,2>{0.689359784f, 0.47475338f},
-std::array<float,2>{0.837678492f, 0.716665447f},
-std::array<float,2>{0.255075663f, 0.0549810231f},
-std::array<float,2>{0.483335286f, 0.578701258f},
-std::array<float,2>{0.997511327f, 0.236953139f},
-std::array<float,2>{0.536358953f, 0.963280022f},
-std::array<float,2>{0.205855802f, 0.367755592f},
-std::array<float,2>{0.373336822f, 0.89455694f},
-std::array<float,2>{0.798771381f, 0.281693757f},
-std::array<float,2>{0.681271493f, 0.555208862f},
-std::array<float,2>{0.0715378523f, 0.144916356f},
-std::array<float,2>{0.175396875f, 0.646423995f},
-std::array<float,2>{0.601727366f, 0.0901277661f},
-std::array<float,2>{0.921656311f, 0.79656148f},
-std::array<float,2>{0.398978114f, 0.402541041f},
-std::array<float,2>{0.219847783f, 0.972999454f},
-std::array<float,2>{0.519069374f, 0.319165438f},
-std::array<float,2>{0.960460544f, 0.612133443f},
-std::array<float,2>{0.453783721f, 0.190988749f},
-std::array<float,2>{0.296794266f, 0.741898417f},
-std::array<float,2>{0.860189199f, 0.022645181f},
-std::array<float,2>{0.748909891f, 0.81429553f},
-std::array<float,2>{0.0458413698f, 0.44400835f},
-std::array<float,2>{0.414046019f, 0.775158644f},
-std::array<float,2>{0.89522022f, 0.412123322f},
-std::array<float,2>{0.565561652f, 0.686146379f},
-std::array<float,2>{0.142895088f, 0.112425439f},
-std::array<float,2>{0.120624386f, 0.520771205f},
-std::array<float,2>{0.645417571f, 0.163716182f},
-std::array<float,2>{0.767969787f, 0.932306528f},
-std::array<float,2>{0.341763765f, 0.272408694f},
-std::array<float,2>{0.0323610343f, 0.953167856f},
-std::array<float,2>{0.740591466f, 0.366434336f},
-std::array<float,2>{0.867833078f, 0.592385352f},
-std::array<float,2>{0.288613528f, 0.244499847f},
-std::array<float,2>{0.461054921f, 0.706092656f},
-std::array<float,2>{0.96118468f, 0.0525454879f},
-std::array<float,2>{0.527076006f, 0.84412688f},
-std::array<float,2>{0.228670701f, 0.481934935f},
-std::array<float,2>{0.335245758f, 0.783452272f},
-std::array<float,2>{0.778114796f, 0.393318295f},
-std::array<float,2>{0.654996037f, 0.651960909f},
-std::array<float,2>{0.110169031f, 0.0792089999f},
-std::array<float,2>{0.153270453f, 0.548708141f},
-std::array<float,2>{0.575452387f, 0.154952407f},
-std::array<float,2>{0.905671179f, 0.905443132f},
-std::array<float,2>{0.414143533f, 0.295943111f},
-std::array<float,2>{0.21389991f, 0.821059406f},
-std::array<float,2>{0.539155602f, 0.44949466f},
-std::array<float,2>{0.985407054f, 0.747252822f},
-std::array<float,2>{0.470413536f, 0.0292089097f},
-std::array<float,2>{0.260083377f, 0.623550594f},
-std::array<float,2>{0.832304597f, 0.198450506f},
-std::array<float,2>{0.697554708f, 0.979931772f},
-std::array<float,2>{0.00296842586f, 0.323915392f},
-std::array<float,2>{0.393644094f, 0.927148759f},
-std::array<float,2>{0.910585463f, 0.276052266f},
-std::array<float,2>{0.594347715f, 0.52462101f},
-std::array<float,2>{0.18026419f, 0.170719653f},
-std::array<float,2>{0.0694142506f, 0.678918779f},
-std::array<float,2>{0.678322256f, 0.118861362f},
-std::array<float,2>{0.805966079f, 0.766901851f},
-std::array<float,2>{0.366163254f, 0.417597592f},
-std::array<float,2>{0.0956301093f, 0.757386804f},
-std::array<float,2>{0.628213525f, 0.432888776f},
-std::array<float,2>{0.754493237f, 0.663150787f},
-std::array<float,2>{0.324759096f, 0.0958558694f},
-std::array<float,2>{0.422845155f, 0.508850038f},
-std::array<float,2>{0.883111417f, 0.176765904f},
-std::array<float,2>{0.578423321f, 0.908938468f},
-std::array<float,2>{0.13376908f, 0.26312077f},
-std::array<float,2>{0.31203872f, 0.996057093f},
-std::array<float,2>{0.851234734f, 0.329437524f},
-std::array<float,2>{0.732297242f, 0.594712555f},
-std::array<float,2>{0.0478293449f, 0.215002239f},
-std::array<float,2>{0.244594157f, 0.725939453f},
-std::array<float,2>{0.510917127f, 0.00257465546f},
-std::array<float,2>{0.946688175f, 0.833274484f},
-std::array<float,2>{0.438180715f, 0.457216978f},
-std::array<float,2>{0.163613468f, 0.876119792f},
-std::array<float,2>{0.609782696f, 0.30310297f},
-std::array<float,2>{0.927130878f, 0.538959622f},
-std::array<float,2>{0.388465673f, 0.138877317f},
-std::array<float,2>{0.344146043f, 0.638335109f},
-std::array<float,2>{0.781585813f, 0.0748199746f},
-std::array<float,2>{0.671424568f, 0.798978269f},
-std::array<float,2>{0.0822180212f, 0.379637778f},
-std::array<float,2>{0.492206633f, 0.868964374f},
-std::array<float,2>{0.969337702f, 0.486937493f},
-std::array<float,2>{0.553946435f, 0.695061028f},
-std::array<float,2>{0.199966028f, 0.0376372784f},
-std::array<float,2>{0.0159668159f, 0.573242605f},
-std::array<float,2>{0.707908332f, 0.219130561f},
-std::array<float,2>{0.821782708f, 0.95054698f},
-std::array<float,2>{0.269403875f, 0.345612675f},
-std::array<float,2>{0.065356113f, 0.945058823f},
-std::array<float,2>{0.673166573f, 0.355942488f},
-std::array<float,2>{0.811939478f, 0.565240324f},
-std::array<float,2>{0.362092137f, 0.22960639f},
-std::array<float,2>{0.397855073f, 0.697243571f},
-std::array<float,2>{0.90741986f, 0.0416251048f},
-std::array<float,2>{0.599746823f, 0.861877441f},
-std::array<float,2>{0.185091898f, 0.495804608f},
-std::array<float,2>{0.262416393f, 0.809322834f},
-std::array<float,2>{0.831429362f, 0.386483818f},
-std::array<float,2>{0.701572537f, 0.630848289f},
-std::array<float,2>{0.00718943728f, 0.0646611154f},
-std::array<float,2>{0.217323661f, 0.541318178f},
-std::array<float,2>{0.546418011f, 0.12654762f},
-std::array<float,2>{0.989042282f, 0.887238622f},
-std::array<float,2>{0.472783148f, 0.306507498f},
-std::array<float,2>{0.148447454f, 0.841867685f},
-std::array<float,2>{0.57284534f, 0.466742635f},
-std::array<float,2>{0.902004659f, 0.728206158f},
-std::array<float,2>{0.418239415f, 0.0113057494f},
-std::array<float,2>{0.328236699f, 0.607984006f},
-std::array<float,2>{0.773733675f, 0.204799056f},
-std::array<float,2>{0.650063753f, 0.986578286f},
-std::array<float,2>{0.115485035f, 0.340659767f},
-std::array<float,2>{0.466479599f, 0.917423308f},
-std::array<float,2>{0.966480374f, 0.250494063f},
-std::array<float,2>{0.527683556f, 0.503551483f},
-std::array<float,2>{0.232858494f, 0.185200006f},
-std::array<float,2>{0.0374811552f, 0.668252647f},
-std::array<float,2>{0.738214314f, 0.102935061f},
-std::array<float,2>{0.872392714f, 0.765582383f},
-std::array<float,2>{0.28215909f, 0.427790999f},
-std::array<float,2>{0.0195798576f, 0.777634621f},
-std::array<float,2>{0.70654583f, 0.409378678f},
-std::array<float,2>{0.824307859f, 0.682885766f},
-std::array<float,2>{0.271052867f, 0.113299854f},
-std::array<float,2>{0.498756528f, 0.517276824f},
-std::array<float,2>{0.97328192f, 0.159054056f},
-std::array<float,2>{0.547802806f, 0.936889887f},
-std::array<float,2>{0.195582703f, 0.266641706f},
-std::array<float,2>{0.349928886f, 0.971866429f},
-std::array<float,2>{0.788054585f, 0.315289289f},
-std::array<float,2>{0.664516807f, 0.615285277f},
-std::array<float,2>{0.0797445625f, 0.194907263f},
-std::array<float,2>{0.156965479f, 0.737289429f},
-std::array<float,2>{0.616631448f, 0.0174443722f},
-std::array<float,2>{0.924820721f, 0.818670332f},
-std::array<float,2>{0.385108531f, 0.441015452f},
-std::array<float,2>{0.248116314f, 0.891103268f},
-std::array<float,2>{0.511970043f, 0.28593424f},
-std::array<float,2>{0.949788511f, 0.561594546f},
-std::array<float,2>{0.443047732f, 0.141865909f},
-std::array<float,2>{0.307845742f, 0.643470705f},
-std::array<float,2>{0.845715582f, 0.0868360698f},
-std::array<float,2>{0.726623774f, 0.790558577f},
-std::array<float,2>{0.0515259467f, 0.401521176f},
-std::array<float,2>{0.426806629f, 0.853328586f},
-std::array<float,2>{0.887309313f, 0.470448047f},
-std::array<float,2>{0.584685743f, 0.712315202f},
-std::array<float,2>{0.140122801f, 0.0605172664f},
-std::array<float,2>{0.09968362f, 0.583133519f},
-std::array<float,2>{0.632502854f, 0.240260586f},
-std::array<float,2>{0.751332581f, 0.968387067f},
-std::array<float,2>{0.32266736f, 0.373413235f},
-std::array<float,2>{0.0554157309f, 0.923820555f},
-std::array<float,2>{0.726176977f, 0.280148745f},
-std::array<float,2>{0.859266698f, 0.530393064f},
-std::array<float,2>{0.299333543f, 0.165727407f},
-std::array<float,2>{0.450678527f, 0.675591946f},
-std::array<float,2>{0.943736672f, 0.124339283f},
-std::array<float,2>{0.504263937f, 0.772050261f},
-std::array<float,2>{0.237330541f, 0.421021998f},
-std::array<float,2>{0.316747218f, 0.826836944f},
-std::array<float,2>{0.761280835f, 0.445335865f},
-std::array<float,2>{0.634169579f, 0.745931327f},
-std::array<float,2>{0.107211702f, 0.0268962588f},
-std::array<float,2>{0.128993481f, 0.617858708f},
-std::array<float,2>{0.586811483f, 0.199252889f},
-std::array<float,2>{0.879648328f, 0.982708931f},
-std::array<float,2>{0.436458319f, 0.326754063f},
-std::array<float,2>{0.188285768f, 0.785609722f},
-std::array<float,2>{0.557456017f, 0.396521956f},
-std::array<float,2>{0.983726323f, 0.655659139f},
-std::array<float,2>{0.491270036f, 0.0842676684f},
-std::array<float,2>{0.275936872f, 0.550996602f},
-std::array<float,2>{0.816464841f, 0.148877606f},
-std::array<float,2>{0.717657089f, 0.899940729f},
-std::array<float,2>{0.0258769486f, 0.2909334f},
-std::array<float,2>{0.376184195f, 0.957966805f},
-std::array<float,2>{0.930782497f, 0.360865861f},
-std::array<float,2>{0.617546737f, 0.587541103f},
-std::array<float,2>{0.170052871f, 0.249473289f},
-std::array<float,2>{0.0878921002f, 0.709964156f},
-std::array<float,2>{0.658447742f, 0.0497596711f},
-std::array<float,2>{0.794873178f, 0.851101458f},
-std::array<float,2>{0.354725659f, 0.477708668f},
-std::array<float,2>{0.1229693f, 0.872716308f},
-std::array<float,2>{0.641666174f, 0.491376728f},
-std::array<float,2>{0.769666433f, 0.689448595f},
-std::array<float,2>{0.336713642f, 0.0334557071f},
-std::array<float,2>{0.408365458f, 0.576163948f},
-std::array<float,2>{0.894200683f, 0.225265726f},
-std::array<float,2>{0.569274008f, 0.948243797f},
-std::array<float,2>{0.147214994f, 0.347927749f},
-std::array<float,2>{0.290311664f, 0.880210161f},
-std::array<float,2>{0.86407882f, 0.298931509f},
-std::array<float,2>{0.744185507f, 0.532246649f},
-std::array<float,2>{0.0403718688f, 0.134238556f},
-std::array<float,2>{0.223918885f, 0.636293471f},
-std::array<float,2>{0.520947516f, 0.0741063356f},
-std::array<float,2>{0.953647733f, 0.801079988f},
-std::array<float,2>{0.458761245f, 0.376246095f},
-std::array<float,2>{0.178309679f, 0.99881345f},
-std::array<float,2>{0.606827796f, 0.334511906f},
-std::array<float,2>{0.915900826f, 0.598400474f},
-std::array<float,2>{0.402663797f, 0.212382048f},
-std::array<float,2>{0.369089127f, 0.719733655f},
-std::array<float,2>{0.802040935f, 0.00700538f},
-std::array<float,2>{0.687424898f, 0.828145504f},
-std::array<float,2>{0.0771557987f, 0.453927815f},
-std::array<float,2>{0.47806707f, 0.75085634f},
-std::array<float,2>{0.992317736f, 0.434783906f},
-std::array<float,2>{0.532485843f, 0.658828795f},
-std::array<float,2>{0.208566561f, 0.0988323912f},
-std::array<float,2>{0.00977274403f, 0.512937844f},
-std::array<float,2>{0.693527937f, 0.174914405f},
-std::array<float,2>{0.841282904f, 0.910708785f},
-std::array<float,2>{0.252334148f, 0.261637568f},
-std::array<float,2>{0.105059616f, 0.886244655f},
-std::array<float,2>{0.63918668f, 0.31104514f},
-std::array<float,2>{0.762478769f, 0.545736134f},
-std::array<float,2>{0.316098362f, 0.130422458f},
-std::array<float,2>{0.430689812f, 0.62735492f},
-std::array<float,2>{0.876381814f, 0.0693081468f},
-std::array<float,2>{0.590662777f, 0.808484137f},
-std::array<float,2>{0.126626819f, 0.387997836f},
-std::array<float,2>{0.302514642f, 0.864553034f},
-std::array<float,2>{0.852032304f, 0.498373747f},
-std::array<float,2>{0.719738245f, 0.702652514f},
-std::array<float,2>{0.060983099f, 0.0440206788f},
-std::array<float,2>{0.241832748f, 0.56910646f},
-std::array<float,2>{0.502410114f, 0.233580962f},
-std::array<float,2>{0.938806474f, 0.941188037f},
-std::array<float,2>{0.44791016f, 0.35444659f},
-std::array<float,2>{0.16625303f, 0.7593894f},
-std::array<float,2>{0.622358263f, 0.422521055f},
-std::array<float,2>{0.936075032f, 0.667785943f},
-std::array<float,2>{0.382577151f, 0.107290745f},
-std::array<float,2>{0.356093556f, 0.504883826f},
-std::array<float,2>{0.789381206f, 0.180770621f},
-std::array<float,2>{0.660422862f, 0.919522703f},
-std::array<float,2>{0.0923025534f, 0.256210893f},
-std::array<float,2>{0.48633489f, 0.99129802f},
-std::array<float,2>{0.977959454f, 0.339837283f},
-std::array<float,2>{0.559390306f, 0.603466809f},
-std::array<float,2>{0.193126634f, 0.208116665f},
-std::array<float,2>{0.0281546116f, 0.731770158f},
-std::array<float,2>{0.711026788f, 0.0135129346f},
-std::array<float,2>{0.812927127f, 0.837462664f},
-std::array<float,2>{0.280491471f, 0.461266607f},
-std::array<float,2>{0.0445146263f, 0.815680027f},
-std::array<float,2>{0.747879565f, 0.443056613f},
-std::array<float,2>{0.861939251f, 0.73966229f},
-std::array<float,2>{0.2933878f, 0.0201636553f},
-std::array<float,2>{0.456974715f, 0.609564126f},
-std::array<float,2>{0.958044469f, 0.189131111f},
-std::array<float,2>{0.516620815f, 0.97521174f},
-std::array<float,2>{0.222551838f, 0.317112148f},
-std::array<float,2>{0.34366703f, 0.93080914f},
-std::array<float,2>{0.766154766f, 0.270099133f},
-std::array<float,2>{0.647952437f, 0.522133648f},
-std::array<float,2>{0.117814548f, 0.161810741f},
-std::array<float,2>{0.14145723f, 0.683858812f},
-std::array<float,2>{0.562661469f, 0.110066742f},
-std::array<float,2>{0.898001492f, 0.776100457f},
-std::array<float,2>{0.410642385f, 0.410496354f},
-std::array<float,2>{0.204202771f, 0.96250397f},
-std::array<float,2>{0.537903905f, 0.369572073f},
-std::array<float,2>{0.998259544f, 0.581515908f},
-std::array<float,2>{0.481164336f, 0.235202745f},
-std::array<float,2>{0.256577313f, 0.718065798f},
-std::array<float,2>{0.838274956f, 0.0578179806f},
-std::array<float,2>{0.68961823f, 0.858107626f},
-std::array<float,2>{0.0126702124f, 0.473827958f},
-std::array<float,2>{0.402154535f, 0.794519901f},
-std::array<float,2>{0.918955445f, 0.405048698f},
-std::array<float,2>{0.603691697f, 0.64740181f},
-std::array<float,2>{0.172095016f, 0.0931463838f},
-std::array<float,2>{0.0738492161f, 0.557700634f},
-std::array<float,2>{0.682823181f, 0.147908539f},
-std::array<float,2>{0.799917221f, 0.897172511f},
-std::array<float,2>{0.371336132f, 0.285052896f},
-std::array<float,2>{0.000940230268f, 0.977353394f},
-std::array<float,2>{0.697024405f, 0.322127044f},
-std::array<float,2>{0.835270524f, 0.6226843f},
-std::array<float,2>{0.258973479f, 0.197041884f},
-std::array<float,2>{0.472064704f, 0.748328269f},
-std::array<float,2>{0.98783654f, 0.0297143199f},
-std::array<float,2>{0.542614877f, 0.824115872f},
-std::array<float,2>{0.211921006f, 0.45176968f},
-std::array<float,2>{0.36497888f, 0.768373907f},
-std::array<float,2>{0.807316661f, 0.415367603f},
-std::array<float,2>{0.677706003f, 0.676912546f},
-std::array<float,2>{0.0674768686f, 0.119306967f},
-std::array<float,2>{0.18285124f, 0.526721418f},
-std::array<float,2>{0.596211791f, 0.168879166f},
-std::array<float,2>{0.912398279f, 0.929488301f},
-std::array<float,2>{0.392111242f, 0.274000764f},
-std::array<float,2>{0.228277177f, 0.847147763f},
-std::array<float,2>{0.523873091f, 0.483275414f},
-std::array<float,2>{0.964480877f, 0.70502919f},
-std::array<float,2>{0.46384874f, 0.0538943559f},
-std::array<float,2>{0.285944521f, 0.590113163f},
-std::array<float,2>{0.869943261f, 0.242912591f},
-std::array<float,2>{0.738567531f, 0.956830084f},
-std::array<float,2>{0.0340589024f, 0.364376098f},
-std::array<float,2>{0.416590273f, 0.903131604f},
-std::array<float,2>{0.902968168f, 0.293979049f},
-std::array<float,2>{0.577919066f, 0.549503505f},
-std::array<float,2>{0.154642582f, 0.152385756f},
-std::array<float,2>{0.111378975f, 0.649043739f},
-std::array<float,2>{0.654292345f, 0.0807453692f},
-std::array<float,2>{0.779373169f, 0.782106757f},
-std::array<float,2>{0.332732141f, 0.3916758f},
-std::array<float,2>{0.0840252563f, 0.798483431f},
-std::array<float,2>{0.669719636f, 0.381476879f},
-std::array<float,2>{0.784344852f, 0.639304936f},
-std::array<float,2>{0.347418725f, 0.077717714f},
-std::array<float,2>{0.389873713f, 0.535849452f},
-std::array<float,2>{0.928802907f, 0.138040617f},
-std::array<float,2>{0.611872196f, 0.877717972f},
-std::array<float,2>{0.160641357f, 0.302625895f},
-std::array<float,2>{0.267474473f, 0.952142954f},
-std::array<float,2>{0.824172199f, 0.346230537f},
-std::array<float,2>{0.710354507f, 0.571055591f},
-std::array<float,2>{0.0177734122f, 0.221938521f},
-std::array<float,2>{0.202681109f, 0.69316113f},
-std::array<float,2>{0.552441537f, 0.0368244089f},
-std::array<float,2>{0.971487284f, 0.870039463f},
-std::array<float,2>{0.495559871f, 0.484860003f},
-std::array<float,2>{0.135172606f, 0.907114327f},
-std::array<float,2>{0.580265582f, 0.263991684f},
-std::array<float,2>{0.88566488f, 0.510929763f},
-std::array<float,2>{0.425186306f, 0.178616971f},
-std::array<float,2>{0.326802373f, 0.661317647f},
-std::array<float,2>{0.757351398f, 0.094359681f},
-std::array<float,2>{0.625850141f, 0.755007267f},
-std::array<float,2>{0.0966559276f, 0.430057853f},
-std::array<float,2>{0.439474046f, 0.834380925f},
-std::array<float,2>{0.947285593f, 0.459230334f},
-std::array<float,2>{0.508074522f, 0.722879529f},
-std::array<float,2>{0.243228212f, 0.00155731174f},
-std::array<float,2>{0.048899278f, 0.597226262f},
-std::array<float,2>{0.732725859f, 0.217445135f},
-std::array<float,2>{0.84882772f, 0.9927333f},
-std::array<float,2>{0.308879226f, 0.331944019f},
-std::array<float,2>{0.123725519f, 0.948845744f},
-std::array<float,2>{0.644116402f, 0.348488033f},
-std::array<float,2>{0.772419572f, 0.575569391f},
-std::array<float,2>{0.339536965f, 0.224880636f},
-std::array<float,2>{0.407490075f, 0.688919544f},
-std::array<float,2>{0.891864479f, 0.0337641463f},
-std::array<float,2>{0.567130029f, 0.872270703f},
-std::array<float,2>{0.146199614f, 0.492091268f},
-std::array<float,2>{0.292476833f, 0.801540077f},
-std::array<float,2>{0.86663872f, 0.376934022f},
-std::array<float,2>{0.743403375f, 0.636209786f},
-std::array<float,2>{0.0417192765f, 0.0734630525f},
-std::array<float,2>{0.225421682f, 0.532946646f},
-std::array<float,2>{0.521560073f, 0.134360895f},
-std::array<float,2>{0.955703855f, 0.880374193f},
-std::array<float,2>{0.460180134f, 0.299666852f},
-std::array<float,2>{0.176395744f, 0.828986168f},
-std::array<float,2>{0.608045399f, 0.453520209f},
-std::array<float,2>{0.916573703f, 0.720584035f},
-std::array<float,2>{0.405425817f, 0.00776490336f},
-std::array<float,2>{0.369913667f, 0.597758532f},
-std::array<float,2>{0.80316186f, 0.21253103f},
-std::array<float,2>{0.684313059f, 0.998210371f},
-std::array<float,2>{0.0756247565f, 0.334232777f},
-std::array<float,2>{0.478888839f, 0.910458744f},
-std::array<float,2>{0.994738102f, 0.260970622f},
-std::array<float,2>{0.533953071f, 0.513315797f},
-std::array<float,2>{0.210879728f, 0.175654709f},
-std::array<float,2>{0.00789316744f, 0.658389807f},
-std::array<float,2>{0.693008304f, 0.0992623866f},
-std::array<float,2>{0.841855705f, 0.750168383f},
-std::array<float,2>{0.250270694f, 0.435208023f},
-std::array<float,2>{0.0584110096f, 0.77167356f},
-std::array<float,2>{0.723257899f, 0.421639055f},
-std::array<float,2>{0.856794536f, 0.675190032f},
-std::array<float,2>{0.297019243f, 0.12451198f},
-std::array<float,2>{0.451334238f, 0.53085953f},
-std::array<float,2>{0.941630244f, 0.1652679f},
-std::array<float,2>{0.507547677f, 0.92293489f},
-std::array<float,2>{0.23467654f, 0.279508293f},
-std::array<float,2>{0.318965465f, 0.983107626f},
-std::array<float,2>{0.757970035f, 0.326497614f},
-std::array<float,2>{0.636221409f, 0.61758405f},
-std::array<float,2>{0.10839501f, 0.199774712f},
-std::array<float,2>{0.132023215f, 0.745279729f},
-std::array<float,2>{0.589576364f, 0.026392214f},
-std::array<float,2>{0.881270409f, 0.826306403f},
-std::array<float,2>{0.435461998f, 0.446256608f},
-std::array<float,2>{0.191305488f, 0.899511516f},
-std::array<float,2>{0.556352079f, 0.290514082f},
-std::array<float,2>{0.982045829f, 0.551481843f},
-std::array<float,2>{0.488995492f, 0.149376601f},
-std::array<float,2>{0.274567038f, 0.656148136f},
-std::array<float,2>{0.818964243f, 0.0845987573f},
-std::array<float,2>{0.716216683f, 0.785882533f},
-std::array<float,2>{0.0235143863f, 0.397106797f},
-std::array<float,2>{0.377162486f, 0.850874364f},
-std::array<float,2>{0.931825161f, 0.478401452f},
-std::array<float,2>{0.620026052f, 0.710637689f},
-std::array<float,2>{0.168758854f, 0.0492876358f},
-std::array<float,2>{0.0864567906f, 0.587337911f},
-std::array<float,2>{0.656354785f, 0.249939039f},
-std::array<float,2>{0.795127153f, 0.957142055f},
-std::array<float,2>{0.35271588f, 0.360815018f},
-std::array<float,2>{0.02280025f, 0.937292695f},
-std::array<float,2>{0.703968823f, 0.267528892f},
-std::array<float,2>{0.827369452f, 0.516604483f},
-std::array<float,2>{0.272061378f, 0.158385232f},
-std::array<float,2>{0.49715355f, 0.683380961f},
-std::array<float,2>{0.975255013f, 0.114134498f},
-std::array<float,2>{0.549395561f, 0.778208256f},
-std::array<float,2>{0.198376954f, 0.410047174f},
-std::array<float,2>{0.348381162f, 0.818889618f},
-std::array<float,2>{0.785473168f, 0.440807164f},
-std::array<float,2>{0.667584717f, 0.736630321f},
-std::array<float,2>{0.0809342861f, 0.0169228408f},
-std::array<float,2>{0.158722967f, 0.616118968f},
-std::array<float,2>{0.615047276f, 0.194435716f},
-std::array<float,2>{0.922115147f, 0.972190261f},
-std::array<float,2>{0.3845357f, 0.314536363f},
-std::array<float,2>{0.247422978f, 0.790387452f},
-std::array<float,2>{0.514384747f, 0.402239323f},
-std::array<float,2>{0.952891529f, 0.64271605f},
-std::array<float,2>{0.443606704f, 0.0859884918f},
-std::array<float,2>{0.305912048f, 0.562079489f},
-std::array<float,2>{0.84535718f, 0.142260879f},
-std::array<float,2>{0.729483783f, 0.891509652f},
-std::array<float,2>{0.0534357913f, 0.285556048f},
-std::array<float,2>{0.429166108f, 0.967952132f},
-std::array<float,2>{0.889343143f, 0.373599142f},
-std::array<float,2>{0.583443701f, 0.583851814f},
-std::array<float,2>{0.136885285f, 0.240987018f},
-std::array<float,2>{0.098668389f, 0.712772667f},
-std::array<float,2>{0.629632652f, 0.059913788f},
-std::array<float,2>{0.753107905f, 0.852729261f},
-std::array<float,2>{0.321451455f, 0.469913185f},
-std::array<float,2>{0.062832661f, 0.861640215f},
-std::array<float,2>{0.674319386f, 0.4952676f},
-std::array<float,2>{0.809042573f, 0.696717083f},
-std::array<float,2>{0.359901458f, 0.0411848202f},
-std::array<float,2>{0.394703597f, 0.564617574f},
-std::array<float,2>{0.908326209f, 0.230084941f},
-std::array<float,2>{0.599205315f, 0.944513261f},
-std::array<float,2>{0.185951471f, 0.356427491f},
-std::array<float,2>{0.264906377f, 0.887018204f},
-std::array<float,2>{0.828763902f, 0.30608812f},
-std::array<float,2>{0.699662507f, 0.541933358f},
-std::array<float,2>{0.00485503953f, 0.126416445f},
-std::array<float,2>{0.215476707f, 0.63013947f},
-std::array<float,2>{0.544126272f, 0.0650948286f},
-std::array<float,2>{0.992068291f, 0.808978617f},
-std::array<float,2>{0.475676209f, 0.386211395f},
-std::array<float,2>{0.152328536f, 0.987171292f},
-std::array<float,2>{0.572159171f, 0.340188533f},
-std::array<float,2>{0.899436891f, 0.607443452f},
-std::array<float,2>{0.420153528f, 0.204252258f},
-std::array<float,2>{0.330513805f, 0.728012145f},
-std::array<float,2>{0.775503218f, 0.0111456448f},
-std::array<float,2>{0.650748909f, 0.842493236f},
-std::array<float,2>{0.114495002f, 0.466045052f},
-std::array<float,2>{0.467475951f, 0.765077889f},
-std::array<float,2>{0.968392551f, 0.428410441f},
-std::array<float,2>{0.529540896f, 0.668786943f},
-std::array<float,2>{0.232018277f, 0.103481412f},
-std::array<float,2>{0.0369805358f, 0.503129661f},
-std::array<float,2>{0.735677004f, 0.184619725f},
-std::array<float,2>{0.873831153f, 0.9177652f},
-std::array<float,2>{0.283466399f, 0.250415951f},
-std::array<float,2>{0.0829622895f, 0.877316058f},
-std::array<float,2>{0.670932889f, 0.302031308f},
-std::array<float,2>{0.781873167f, 0.535517335f},
-std::array<float,2>{0.344434112f, 0.138303056f},
-std::array<float,2>{0.388064533f, 0.638826549f},
-std::array<float,2>{0.927380204f, 0.0774734169f},
-std::array<float,2>{0.610190153f, 0.798248768f},
-std::array<float,2>{0.16333054f, 0.381126314f},
-std::array<float,2>{0.268969238f, 0.869308054f},
-std::array<float,2>{0.821677506f, 0.485252798f},
-std::array<float,2>{0.707402527f, 0.69249779f},
-std::array<float,2>{0.0164859295f, 0.036240384f},
-std::array<float,2>{0.199240819f, 0.57075417f},
-std::array<float,2>{0.554420292f, 0.222655892f},
-std::array<float,2>{0.969073176f, 0.951222003f},
-std::array<float,2>{0.493086338f, 0.346072733f},
-std::array<float,2>{0.133277059f, 0.75543344f},
-std::array<float,2>{0.578877211f, 0.430389166f},
-std::array<float,2>{0.88360858f, 0.661947489f},
-std::array<float,2>{0.421910614f, 0.093941398f},
-std::array<float,2>{0.324531287f, 0.511399925f},
-std::array<float,2>{0.754069328f, 0.177934065f},
-std::array<float,2>{0.628890872f, 0.906455517f},
-std::array<float,2>{0.0951628685f, 0.264257193f},
-std::array<float,2>{0.437957048f, 0.992569685f},
-std::array<float,2>{0.94719559f, 0.331256151f},
-std::array<float,2>{0.511343777f, 0.596762478f},
-std::array<float,2>{0.244927898f, 0.217220992f},
-std::array<float,2>{0.0473252274f, 0.723601878f},
-std::array<float,2>{0.731882453f, 0.00127271202f},
-std::array<float,2>{0.850930572f, 0.834896266f},
-std::array<float,2>{0.311780214f, 0.459860355f},
-std::array<float,2>{0.00350842066f, 0.823539197f},
-std::array<float,2>{0.698000073f, 0.451655984f},
-std::array<float,2>{0.832726836f, 0.748567283f},
-std::array<float,2>{0.26046446f, 0.0302638467f},
-std::array<float,2>{0.469854325f, 0.622143209f},
-std::array<float,2>{0.985877931f, 0.196663246f},
-std::array<float,2>{0.53958261f, 0.976812899f},
-std::array<float,2>{0.21470499f, 0.321318328f},
-std::array<float,2>{0.365469009f, 0.928769529f},
-std::array<float,2>{0.806278646f, 0.273632437f},
-std::array<float,2>{0.678149164f, 0.526876688f},
-std::array<float,2>{0.0700360239f, 0.167991832f},
-std::array<float,2>{0.180145323f, 0.677264631f},
-std::array<float,2>{0.593977749f, 0.119774178f},
-std::array<float,2>{0.911015332f, 0.767737567f},
-std::array<float,2>{0.39452523f, 0.41558218f},
-std::array<float,2>{0.229175642f, 0.956274569f},
-std::array<float,2>{0.526468873f, 0.365131706f},
-std::array<float,2>{0.961642802f, 0.590596914f},
-std::array<float,2>{0.46167174f, 0.242454499f},
-std::array<float,2>{0.288294047f, 0.704437017f},
-std::array<float,2>{0.867608607f, 0.0546533726f},
-std::array<float,2>{0.740792036f, 0.847476006f},
-std::array<float,2>{0.0329756588f, 0.48260951f},
-std::array<float,2>{0.414741039f, 0.781605422f},
-std::array<float,2>{0.905884743f, 0.39230004f},
-std::array<float,2>{0.575902581f, 0.648655415f},
-std::array<float,2>{0.152670056f, 0.0804687664f},
-std::array<float,2>{0.109716766f, 0.549274921f},
-std::array<float,2>{0.65443033f, 0.152997762f},
-std::array<float,2>{0.777795315f, 0.902774572f},
-std::array<float,2>{0.335701466f, 0.294435531f},
-std::array<float,2>{0.0450243987f, 0.97497046f},
-std::array<float,2>{0.74827069f, 0.316788346f},
-std::array<float,2>{0.859636366f, 0.610250115f},
-std::array<float,2>{0.296099216f, 0.188798726f},
-std::array<float,2>{0.453551233f, 0.739761472f},
-std::array<float,2>{0.960382938f, 0.0200190544f},
-std::array<float,2>{0.51891309f, 0.816316664f},
-std::array<float,2>{0.22024028f, 0.442601442f},
-std::array<float,2>{0.341008902f, 0.775428951f},
-std::array<float,2>{0.768287241f, 0.411109746f},
-std::array<float,2>{0.644694328f, 0.684451699f},
-std::array<float,2>{0.120553359f, 0.109596476f},
-std::array<float,2>{0.143371627f, 0.521721303f},
-std::array<float,2>{0.566206157f, 0.161591277f},
-std::array<float,2>{0.894951642f, 0.931172848f},
-std::array<float,2>{0.413469702f, 0.26985392f},
-std::array<float,2>{0.205528334f, 0.857696295f},
-std::array<float,2>{0.536629498f, 0.474319309f},
-std::array<float,2>{0.997789383f, 0.718690932f},
-std::array<float,2>{0.482737422f, 0.058313854f},
-std::array<float,2>{0.255412698f, 0.581655145f},
-std::array<float,2>{0.836925209f, 0.234639704f},
-std::array<float,2>{0.688592374f, 0.961970985f},
-std::array<float,2>{0.0155669544f, 0.36971119f},
-std::array<float,2>{0.398872554f, 0.896794379f},
-std::array<float,2>{0.921167433f, 0.284664482f},
-std::array<float,2>{0.602414131f, 0.558378696f},
-std::array<float,2>{0.174884111f, 0.147979617f},
-std::array<float,2>{0.0718678832f, 0.646497965f},
-std::array<float,2>{0.68081522f, 0.093422927f},
-std::array<float,2>{0.798083007f, 0.794003665f},
-std::array<float,2>{0.373679429f, 0.404727012f},
-std::array<float,2>{0.102921501f, 0.808054864f},
-std::array<float,2>{0.637165546f, 0.388415992f},
-std::array<float,2>{0.764801979f, 0.627463043f},
-std::array<float,2>{0.31438759f, 0.0683646128f},
-std::array<float,2>{0.432571769f, 0.545092165f},
-std::array<float,2>{0.877176881f, 0.129982665f},
-std::array<float,2>{0.593551219f, 0.886090934f},
-std::array<float,2>{0.12838088f, 0.31068635f},
-std::array<float,2>{0.304515183f, 0.940859497f},
-std::array<float,2>{0.854060054f, 0.353827536f},
-std::array<float,2>{0.720735013f, 0.568497062f},
-std::array<float,2>{0.0599650145f, 0.234365612f},
-std::array<float,2>{0.238921747f, 0.702479959f},
-std::array<float,2>{0.501681626f, 0.044568114f},
-std::array<float,2>{0.940523386f, 0.864938438f},
-std::array<float,2>{0.447228372f, 0.498659819f},
-std::array<float,2>{0.164776012f, 0.919233501f},
-std::array<float,2>{0.623602629f, 0.256544024f},
-std::array<float,2>{0.934650719f, 0.505814552f},
-std::array<float,2>{0.379054219f, 0.181236327f},
-std::array<float,2>{0.357879907f, 0.66740942f},
-std::array<float,2>{0.792467237f, 0.106844947f},
-std::array<float,2>{0.663020968f, 0.759173751f},
-std::array<float,2>{0.0909865275f, 0.42211628f},
-std::array<float,2>{0.484785587f, 0.837265074f},
-std::array<float,2>{0.980166972f, 0.461654216f},
-std::array<float,2>{0.561165512f, 0.73198694f},
-std::array<float,2>{0.193778828f, 0.0127757601f},
-std::array<float,2>{0.0307727791f, 0.602737486f},
-std::array<float,2>{0.71392709f, 0.208933011f},
-std::array<float,2>{0.815176427f, 0.992097676f},
-std::array<float,2>{0.277579337f, 0.33889237f},
-std::array<float,2>{0.0781228766f, 0.997358263f},
-std::array<float,2>{0.687004089f, 0.332564235f},
-std::array<float,2>{0.802517414f, 0.600445092f},
-std::array<float,2>{0.368368685f, 0.213528052f},
-std::array<float,2>{0.403129816f, 0.720797479f},
-std::array<float,2>{0.915086448f, 0.00546369236f},
-std::array<float,2>{0.60707128f, 0.83124882f},
-std::array<float,2>{0.177752033f, 0.456383854f},
-std::array<float,2>{0.252509952f, 0.752675712f},
-std::array<float,2>{0.841636419f, 0.436910152f},
-std::array<float,2>{0.694293499f, 0.656431556f},
-std::array<float,2>{0.0102929156f, 0.0996572822f},
-std::array<float,2>{0.208270386f, 0.514565289f},
-std::array<float,2>{0.53286624f, 0.173338011f},
-std::array<float,2>{0.992775321f, 0.913065851f},
-std::array<float,2>{0.477879763f, 0.257985234f},
-std::array<float,2>{0.146696821f, 0.874422431f},
-std::array<float,2>{0.568698347f, 0.488839686f},
-std::array<float,2>{0.893772304f, 0.690163791f},
-std::array<float,2>{0.409141302f, 0.0323488489f},
-std::array<float,2>{0.336241096f, 0.57642442f},
-std::array<float,2>{0.7703228f, 0.223767579f},
-std::array<float,2>{0.64212805f, 0.946750104f},
-std::array<float,2>{0.122416228f, 0.350656152f},
-std::array<float,2>{0.458058149f, 0.881144404f},
-std::array<float,2>{0.953474104f, 0.298331916f},
-std::array<float,2>{0.521196246f, 0.534201086f},
-std::array<float,2>{0.224472418f, 0.135030478f},
-std::array<float,2>{0.0405976623f, 0.633708537f},
-std::array<float,2>{0.744732141f, 0.071222648f},
-std::array<float,2>{0.863289535f, 0.803681195f},
-std::array<float,2>{0.291005164f, 0.378740132f},
-std::array<float,2>{0.0263235625f, 0.788880825f},
-std::array<float,2>{0.716826141f, 0.394667178f},
-std::array<float,2>{0.817128897f, 0.653828204f},
-std::array<float,2>{0.275641769f, 0.0832654834f},
-std::array<float,2>{0.491808653f, 0.55447787f},
-std::array<float,2>{0.984260619f, 0.151165858f},
-std::array<float,2>{0.556962848f, 0.900461853f},
-std::array<float,2>{0.187584758f, 0.291819662f},
-std::array<float,2>{0.355377227f, 0.959409833f},
-std::array<float,2>{0.794032454f, 0.36227712f},
-std::array<float,2>{0.65910244f, 0.588367403f},
-std::array<float,2>{0.0887267366f, 0.247677565f},
-std::array<float,2>{0.170565054f, 0.707963645f},
-std::array<float,2>{0.61790663f, 0.0480188951f},
-std::array<float,2>{0.931313217f, 0.847813189f},
-std::array<float,2>{0.376505524f, 0.479972243f},
-std::array<float,2>{0.237801462f, 0.925287545f},
-std::array<float,2>{0.504728198f, 0.279241711f},
-std::array<float,2>{0.944055021f, 0.529143393f},
-std::array<float,2>{0.450964868f, 0.166586429f},
-std::array<float,2>{0.299242556f, 0.672293901f},
-std::array<float,2>{0.858488619f, 0.122230314f},
-std::array<float,2>{0.725659847f, 0.771343827f},
-std::array<float,2>{0.0549643934f, 0.419695348f},
-std::array<float,2>{0.435657382f, 0.825182736f},
-std::array<float,2>{0.879014134f, 0.448543966f},
-std::array<float,2>{0.586137414f, 0.742248058f},
-std::array<float,2>{0.129854366f, 0.0249594115f},
-std::array<float,2>{0.106725268f, 0.619731188f},
-std::array<float,2>{0.634371758f, 0.201297298f},
-std::array<float,2>{0.761007547f, 0.982284427f},
-std::array<float,2>{0.317340076f, 0.324705154f},
-std::array<float,2>{0.0512057617f, 0.893302441f},
-std::array<float,2>{0.727144003f, 0.288847029f},
-std::array<float,2>{0.846443892f, 0.558786273f},
-std::array<float,2>{0.308143795f, 0.143358812f},
-std::array<float,2>{0.442817122f, 0.640666187f},
-std::array<float,2>{0.949584246f, 0.0895831808f},
-std::array<float,2>{0.512671411f, 0.791116655f},
-std::array<float,2>{0.248644963f, 0.399823606f},
-std::array<float,2>{0.32300666f, 0.853647828f},
-std::array<float,2>{0.751756847f, 0.472332567f},
-std::array<float,2>{0.632158279f, 0.714564621f},
-std::array<float,2>{0.100285098f, 0.0624526814f},
-std::array<float,2>{0.140623838f, 0.585665107f},
-std::array<float,2>{0.584012687f, 0.239166796f},
-std::array<float,2>{0.88691932f, 0.966677785f},
-std::array<float,2>{0.427488655f, 0.372657746f},
-std::array<float,2>{0.196201414f, 0.781078041f},
-std::array<float,2>{0.547182441f, 0.406897336f},
-std::array<float,2>{0.97287488f, 0.681126237f},
-std::array<float,2>{0.498335749f, 0.117172681f},
-std::array<float,2>{0.270902008f, 0.51764524f},
-std::array<float,2>{0.824981332f, 0.15767625f},
-std::array<float,2>{0.706328988f, 0.934559226f},
-std::array<float,2>{0.0202750526f, 0.268790424f},
-std::array<float,2>{0.385688037f, 0.970573485f},
-std::array<float,2>{0.925468206f, 0.313793004f},
-std::array<float,2>{0.616841793f, 0.614663839f},
-std::array<float,2>{0.156334504f, 0.191652805f},
-std::array<float,2>{0.07920973f, 0.736266971f},
-std::array<float,2>{0.664688706f, 0.0176731832f},
-std::array<float,2>{0.787154555f, 0.817819297f},
-std::array<float,2>{0.35034129f, 0.438920766f},
-std::array<float,2>{0.116013117f, 0.841475427f},
-std::array<float,2>{0.649732172f, 0.4674806f},
-std::array<float,2>{0.774377048f, 0.729967058f},
-std::array<float,2>{0.328721493f, 0.00880234595f},
-std::array<float,2>{0.418484628f, 0.607173026f},
-std::array<float,2>{0.901576102f, 0.206994474f},
-std::array<float,2>{0.572321296f, 0.984583437f},
-std::array<float,2>{0.149364203f, 0.342300147f},
-std::array<float,2>{0.281394362f, 0.914970815f},
-std::array<float,2>{0.872657478f, 0.252065986f},
-std::array<float,2>{0.737473845f, 0.500475407f},
-std::array<float,2>{0.0377089418f, 0.185851127f},
-std::array<float,2>{0.23304905f, 0.671691597f},
-std::array<float,2>{0.5281955f, 0.105291575f},
-std::array<float,2>{0.966209352f, 0.762096703f},
-std::array<float,2>{0.466261983f, 0.426619798f},
-std::array<float,2>{0.18498984f, 0.941456199f},
-std::array<float,2>{0.600549161f, 0.358014166f},
-std::array<float,2>{0.908169329f, 0.564129591f},
-std::array<float,2>{0.398311764f, 0.226794392f},
-std::array<float,2>{0.36177671f, 0.698917449f},
-std::array<float,2>{0.812382817f, 0.0409431234f},
-std::array<float,2>{0.673738241f, 0.859983206f},
-std::array<float,2>{0.0648985505f, 0.494017363f},
-std::array<float,2>{0.473600954f, 0.811192811f},
-std::array<float,2>{0.98834008f, 0.384511411f},
-std::array<float,2>{0.546178102f, 0.631305695f},
-std::array<float,2>{0.217181519f, 0.0640198961f},
-std::array<float,2>{0.00743899029f, 0.539984465f},
-std::array<float,2>{0.70175302f, 0.128171086f},
-std::array<float,2>{0.831677139f, 0.890149891f},
-std::array<float,2>{0.262078285f, 0.307684064f},
-std::array<float,2>{0.0961912498f, 0.908230603f},
-std::array<float,2>{0.625408947f, 0.263396531f},
-std::array<float,2>{0.757303238f, 0.509512126f},
-std::array<float,2>{0.326480508f, 0.177436635f},
-std::array<float,2>{0.425531924f, 0.663904905f},
-std::array<float,2>{0.885125875f, 0.0963265076f},
-std::array<float,2>{0.580926239f, 0.757316113f},
-std::array<float,2>{0.135695815f, 0.433505833f},
-std::array<float,2>{0.309548199f, 0.833550692f},
-std::array<float,2>{0.849501491f, 0.457853019f},
-std::array<float,2>{0.733329058f, 0.726474941f},
-std::array<float,2>{0.0493750051f, 0.00222228956f},
-std::array<float,2>{0.243879542f, 0.594200671f},
-std::array<float,2>{0.508751333f, 0.215656176f},
-std::array<float,2>{0.947963715f, 0.995471656f},
-std::array<float,2>{0.440204084f, 0.329818696f},
-std::array<float,2>{0.16110152f, 0.799766183f},
-std::array<float,2>{0.611486673f, 0.379023165f},
-std::array<float,2>{0.929560184f, 0.637844563f},
-std::array<float,2>{0.390381545f, 0.0745309517f},
-std::array<float,2>{0.346792102f, 0.538157701f},
-std::array<float,2>{0.784725487f, 0.139373258f},
-std::array<float,2>{0.669414222f, 0.87681812f},
-std::array<float,2>{0.0847433507f, 0.303318113f},
-std::array<float,2>{0.495726556f, 0.950984061f},
-std::array<float,2>{0.971113265f, 0.345025569f},
-std::array<float,2>{0.552040994f, 0.574106634f},
-std::array<float,2>{0.202579826f, 0.219567448f},
-std::array<float,2>{0.0185545981f, 0.694647074f},
-std::array<float,2>{0.710803151f, 0.0375223905f},
-std::array<float,2>{0.82325542f, 0.868514359f},
-std::array<float,2>{0.266746938f, 0.486589223f},
-std::array<float,2>{0.0335427411f, 0.844450951f},
-std::array<float,2>{0.738920152f, 0.481799334f},
-std::array<float,2>{0.869573295f, 0.706733286f},
-std::array<float,2>{0.285638034f, 0.0518624596f},
-std::array<float,2>{0.463010281f, 0.591819048f},
-std::array<float,2>{0.964330852f, 0.24508509f},
-std::array<float,2>{0.524409235f, 0.953697681f},
-std::array<float,2>{0.227699682f, 0.366940826f},
-std::array<float,2>{0.332448065f, 0.905788481f},
-std::array<float,2>{0.779808939f, 0.296806037f},
-std::array<float,2>{0.653726041f, 0.547902107f},
-std::array<float,2>{0.112210698f, 0.154341772f},
-std::array<float,2>{0.154895172f, 0.651713431f},
-std::array<float,2>{0.577462196f, 0.0797719732f},
-std::array<float,2>{0.902746975f, 0.783917248f},
-std::array<float,2>{0.416444123f, 0.392635554f},
-std::array<float,2>{0.212721586f, 0.980333507f},
-std::array<float,2>{0.542381108f, 0.323340446f},
-std::array<float,2>{0.987561166f, 0.623104751f},
-std::array<float,2>{0.472635299f, 0.198756203f},
-std::array<float,2>{0.259701908f, 0.747817338f},
-std::array<float,2>{0.83572042f, 0.0283298306f},
-std::array<float,2>{0.69642204f, 0.82053864f},
-std::array<float,2>{0.000255603984f, 0.449922383f},
-std::array<float,2>{0.392055452f, 0.767496586f},
-std::array<float,2>{0.912901402f, 0.417036772f},
-std::array<float,2>{0.59597379f, 0.679220676f},
-std::array<float,2>{0.183365166f, 0.11830537f},
-std::array<float,2>{0.0683067888f, 0.525355339f},
-std::array<float,2>{0.676786005f, 0.170173317f},
-std::array<float,2>{0.807073653f, 0.927305341f},
-std::array<float,2>{0.364592433f, 0.275421321f},
-std::array<float,2>{0.0118112173f, 0.963643312f},
-std::array<float,2>{0.690016031f, 0.367507577f},
-std::array<float,2>{0.838432908f, 0.578178585f},
-std::array<float,2>{0.255942553f, 0.23673223f},
-std::array<float,2>{0.480873227f, 0.716014922f},
-std::array<float,2>{0.99888593f, 0.0555642024f},
-std::array<float,2>{0.537216604f, 0.85609597f},
-std::array<float,2>{0.204760164f, 0.475238144f},
-std::array<float,2>{0.371649534f, 0.796310306f},
-std::array<float,2>{0.800583899f, 0.403017193f},
-std::array<float,2>{0.683419704f, 0.64559859f},
-std::array<float,2>{0.0733618215f, 0.0907572508f},
-std::array<float,2>{0.172418624f, 0.554854155f},
-std::array<float,2>{0.604118705f, 0.145206243f},
-std::array<float,2>{0.919689f, 0.895417154f},
-std::array<float,2>{0.401616484f, 0.282086194f},
-std::array<float,2>{0.221969664f, 0.813708425f},
-std::array<float,2>{0.517104506f, 0.443537146f},
-std::array<float,2>{0.958723843f, 0.74133563f},
-std::array<float,2>{0.456288964f, 0.0230220724f},
-std::array<float,2>{0.293777883f, 0.611707866f},
-std::array<float,2>{0.861347735f, 0.190792978f},
-std::array<float,2>{0.747206032f, 0.973466992f},
-std::array<float,2>{0.0443441421f, 0.318558007f},
-std::array<float,2>{0.410790026f, 0.931754529f},
-std::array<float,2>{0.897541165f, 0.271905601f},
-std::array<float,2>{0.56323576f, 0.521444857f},
-std::array<float,2>{0.140910789f, 0.163230449f},
-std::array<float,2>{0.117365278f, 0.68603301f},
-std::array<float,2>{0.647628665f, 0.112878397f},
-std::array<float,2>{0.765949547f, 0.774861693f},
-std::array<float,2>{0.343161017f, 0.41299209f},
-std::array<float,2>{0.0921105072f, 0.76136601f},
-std::array<float,2>{0.661123335f, 0.424191445f},
-std::array<float,2>{0.789970696f, 0.664404809f},
-std::array<float,2>{0.355487376f, 0.107444681f},
-std::array<float,2>{0.38217777f, 0.507455111f},
-std::array<float,2>{0.935629427f, 0.18261154f},
-std::array<float,2>{0.622804582f, 0.921821296f},
-std::array<float,2>{0.166766167f, 0.254374176f},
-std::array<float,2>{0.28097418f, 0.989497185f},
-std::array<float,2>{0.813368261f, 0.33742857f},
-std::array<float,2>{0.711861193f, 0.603754699f},
-std::array<float,2>{0.0275212228f, 0.210345984f},
-std::array<float,2>{0.192534402f, 0.733330429f},
-std::array<float,2>{0.558754206f, 0.0149426535f},
-std::array<float,2>{0.978468001f, 0.83813411f},
-std::array<float,2>{0.486913919f, 0.464530587f},
-std::array<float,2>{0.126433909f, 0.883354902f},
-std::array<float,2>{0.590143561f, 0.310123503f},
-std::array<float,2>{0.876933336f, 0.543454051f},
-std::array<float,2>{0.431502998f, 0.131011173f},
-std::array<float,2>{0.315546393f, 0.625435829f},
-std::array<float,2>{0.761822104f, 0.0675564706f},
-std::array<float,2>{0.639057219f, 0.804831684f},
-std::array<float,2>{0.104615316f, 0.390551716f},
-std::array<float,2>{0.447421908f, 0.866112888f},
-std::array<float,2>{0.939269602f, 0.497721165f},
-std::array<float,2>{0.502791643f, 0.701036334f},
-std::array<float,2>{0.241428539f, 0.0468477942f},
-std::array<float,2>{0.0611261241f, 0.567189693f},
-std::array<float,2>{0.72029531f, 0.230540022f},
-std::array<float,2>{0.852249861f, 0.938742638f},
-std::array<float,2>{0.30196929f, 0.353025615f},
-std::array<float,2>{0.108664319f, 0.981078506f},
-std::array<float,2>{0.634942472f, 0.325958848f},
-std::array<float,2>{0.759248734f, 0.620458484f},
-std::array<float,2>{0.319530636f, 0.202716544f},
-std::array<float,2>{0.434364885f, 0.74363631f},
-std::array<float,2>{0.881887853f, 0.0236286018f},
-std::array<float,2>{0.587975204f, 0.825428128f},
-std::array<float,2>{0.131758019f, 0.447747171f},
-std::array<float,2>{0.298386246f, 0.769594014f},
-std::array<float,2>{0.856106102f, 0.418099195f},
-std::array<float,2>{0.723899245f, 0.673315287f},
-std::array<float,2>{0.056652423f, 0.12157698f},
-std::array<float,2>{0.235840738f, 0.527721822f},
-std::array<float,2>{0.506805301f, 0.167865321f},
-std::array<float,2>{0.943202257f, 0.924241543f},
-std::array<float,2>{0.452451646f, 0.277506948f},
-std::array<float,2>{0.168953568f, 0.849558234f},
-std::array<float,2>{0.620554745f, 0.479022771f},
-std::array<float,2>{0.932836473f, 0.708706737f},
-std::array<float,2>{0.378710568f, 0.0471484214f},
-std::array<float,2>{0.351627618f, 0.589821696f},
-std::array<float,2>{0.796584606f, 0.246231228f},
-std::array<float,2>{0.657456696f, 0.960849702f},
-std::array<float,2>{0.0878470987f, 0.362976998f},
-std::array<float,2>{0.489376724f, 0.902204037f},
-std::array<float,2>{0.980532229f, 0.292327076f},
-std::array<float,2>{0.554921448f, 0.55367142f},
-std::array<float,2>{0.190113157f, 0.152050525f},
-std::array<float,2>{0.0245117228f, 0.652718961f},
-std::array<float,2>{0.715520024f, 0.0827527866f},
-std::array<float,2>{0.820216596f, 0.787467062f},
-std::array<float,2>{0.273948789f, 0.396156281f},
-std::array<float,2>{0.0420614481f, 0.803829074f},
-std::array<float,2>{0.742683172f, 0.377483338f},
-std::array<float,2>{0.865759015f, 0.63451916f},
-std::array<float,2>{0.291421354f, 0.0719473585f},
-std::array<float,2>{0.459909588f, 0.533798873f},
-std::array<float,2>{0.956210077f, 0.136030644f},
-std::array<float,2>{0.522871256f, 0.882195592f},
-std::array<float,2>{0.226383597f, 0.297791123f},
-std::array<float,2>{0.338856697f, 0.94551456f},
-std::array<float,2>{0.772776365f, 0.349897474f},
-std::array<float,2>{0.643333375f, 0.578088641f},
-std::array<float,2>{0.124371015f, 0.22340019f},
-std::array<float,2>{0.144948363f, 0.69117254f},
-std::array<float,2>{0.568014979f, 0.0312863998f},
-std::array<float,2>{0.891295671f, 0.873517096f},
-std::array<float,2>{0.406660348f, 0.490198731f},
-std::array<float,2>{0.20922482f, 0.913364649f},
-std::array<float,2>{0.534394979f, 0.259476274f},
-std::array<float,2>{0.995868146f, 0.51553148f},
-std::array<float,2>{0.480151504f, 0.172317758f},
-std::array<float,2>{0.251074076f, 0.657759845f},
-std::array<float,2>{0.843512595f, 0.101010621f},
-std::array<float,2>{0.691891313f, 0.753305078f},
-std::array<float,2>{0.00918865483f, 0.436405003f},
-std::array<float,2>{0.405085981f, 0.830695629f},
-std::array<float,2>{0.917790651f, 0.455213398f},
-std::array<float,2>{0.609337687f, 0.722045302f},
-std::array<float,2>{0.177196711f, 0.00414533354f},
-std::array<float,2>{0.0744282156f, 0.601171792f},
-std::array<float,2>{0.685426235f, 0.213881895f},
-std::array<float,2>{0.804638684f, 0.996778607f},
-std::array<float,2>{0.370867193f, 0.333357155f},
-std::array<float,2>{0.00506695453f, 0.88915211f},
-std::array<float,2>{0.700254619f, 0.307316273f},
-std::array<float,2>{0.829104245f, 0.540864468f},
-std::array<float,2>{0.263800651f, 0.127549842f},
-std::array<float,2>{0.475011319f, 0.632386982f},
-std::array<float,2>{0.990415514f, 0.0629640371f},
-std::array<float,2>{0.543324232f, 0.811823785f},
-std::array<float,2>{0.216171548f, 0.382820129f},
-std::array<float,2>{0.360952079f, 0.860618651f},
-std::array<float,2>{0.810140431f, 0.492261499f},
-std::array<float,2>{0.675734043f, 0.698113859f},
-std::array<float,2>{0.0642242506f, 0.0397503637f},
-std::array<float,2>{0.187099725f, 0.563095093f},
-std::array<float,2>{0.597732544f, 0.228394911f},
-std::array<float,2>{0.909773409f, 0.942542017f},
-std::array<float,2>{0.396454424f, 0.359115452f},
-std::array<float,2>{0.230938718f, 0.763027012f},
-std::array<float,2>{0.530450344f, 0.427396029f},
-std::array<float,2>{0.967204213f, 0.670779526f},
-std::array<float,2>{0.468671083f, 0.103539422f},
-std::array<float,2>{0.28513965f, 0.501211524f},
-std::array<float,2>{0.874102831f, 0.187392145f},
-std::array<float,2>{0.734573722f, 0.91601187f},
-std::array<float,2>{0.0360536389f, 0.253682673f},
-std::array<float,2>{0.420912206f, 0.985700428f},
-std::array<float,2>{0.899004757f, 0.342796534f},
-std::array<float,2>{0.570691347f, 0.606051743f},
-std::array<float,2>{0.150627896f, 0.20524998f},
-std::array<float,2>{0.114232935f, 0.729126692f},
-std::array<float,2>{0.6515432f, 0.00841975585f},
-std::array<float,2>{0.777047813f, 0.840372622f},
-std::array<float,2>{0.331843317f, 0.467954814f},
-std::array<float,2>{0.0817070901f, 0.816460311f},
-std::array<float,2>{0.666518509f, 0.437773824f},
-std::array<float,2>{0.786909878f, 0.734815121f},
-std::array<float,2>{0.348843277f, 0.0193765499f},
-std::array<float,2>{0.383608997f, 0.613734245f},
-std::array<float,2>{0.922957659f, 0.192469925f},
-std::array<float,2>{0.613709152f, 0.969369471f},
-std::array<float,2>{0.159539282f, 0.313148409f},
-std::array<float,2>{0.272740573f, 0.934969902f},
-std::array<float,2>{0.827011824f, 0.267764717f},
-std::array<float,2>{0.704162061f, 0.51858896f},
-std::array<float,2>{0.021822894f, 0.156736508f},
-std::array<float,2>{0.197998807f, 0.680592537f},
-std::array<float,2>{0.549811482f, 0.115514621f},
-std::array<float,2>{0.975948989f, 0.779771447f},
-std::array<float,2>{0.496569395f, 0.407261848f},
-std::array<float,2>{0.138425276f, 0.964919448f},
-std::array<float,2>{0.582433164f, 0.371743292f},
-std::array<float,2>{0.889818311f, 0.584264159f},
-std::array<float,2>{0.428502113f, 0.239679366f},
-std::array<float,2>{0.320680797f, 0.713557065f},
-std::array<float,2>{0.75286895f, 0.0610279813f},
-std::array<float,2>{0.630528271f, 0.855196238f},
-std::array<float,2>{0.0985859036f, 0.471113861f},
-std::array<float,2>{0.444402903f, 0.792532444f},
-std::array<float,2>{0.951276243f, 0.399084926f},
-std::array<float,2>{0.515363336f, 0.641784549f},
-std::array<float,2>{0.24658379f, 0.0884549022f},
-std::array<float,2>{0.0537467152f, 0.559623659f},
-std::array<float,2>{0.730457604f, 0.144521043f},
-std::array<float,2>{0.844004154f, 0.89388299f},
-std::array<float,2>{0.305302799f, 0.288049519f},
-std::array<float,2>{0.0690701753f, 0.926751137f},
-std::array<float,2>{0.679456711f, 0.276973158f},
-std::array<float,2>{0.805577219f, 0.524139881f},
-std::array<float,2>{0.366214693f, 0.171633452f},
-std::array<float,2>{0.39306435f, 0.678033054f},
-std::array<float,2>{0.9114483f, 0.11771208f},
-std::array<float,2>{0.595632315f, 0.766473532f},
-std::array<float,2>{0.181170613f, 0.416779578f},
-std::array<float,2>{0.261089534f, 0.821848869f},
-std::array<float,2>{0.833765924f, 0.451071233f},
-std::array<float,2>{0.69851011f, 0.746409774f},
-std::array<float,2>{0.00289900275f, 0.0281197391f},
-std::array<float,2>{0.213317811f, 0.624109507f},
-std::array<float,2>{0.540459871f, 0.198171049f},
-std::array<float,2>{0.984993339f, 0.978841722f},
-std::array<float,2>{0.468916267f, 0.32262674f},
-std::array<float,2>{0.15335995f, 0.784612834f},
-std::array<float,2>{0.574510098f, 0.39358148f},
-std::array<float,2>{0.904778779f, 0.650408924f},
-std::array<float,2>{0.41556415f, 0.078397885f},
-std::array<float,2>{0.334871948f, 0.547846198f},
-std::array<float,2>{0.77844125f, 0.155402139f},
-std::array<float,2>{0.655540109f, 0.904429317f},
-std::array<float,2>{0.110836245f, 0.295826972f},
-std::array<float,2>{0.462033093f, 0.954302907f},
-std::array<float,2>{0.961989164f, 0.365745217f},
-std::array<float,2>{0.526268601f, 0.593307793f},
-std::array<float,2>{0.230079323f, 0.245187581f},
-std::array<float,2>{0.0316935778f, 0.705462575f},
-std::array<float,2>{0.741777062f, 0.0509434119f},
-std::array<float,2>{0.868658543f, 0.845598698f},
-std::array<float,2>{0.287909746f, 0.480832249f},
-std::array<float,2>{0.0166992042f, 0.867821574f},
-std::array<float,2>{0.708343029f, 0.488232225f},
-std::array<float,2>{0.820390403f, 0.693897545f},
-std::array<float,2>{0.268044919f, 0.0385133065f},
-std::array<float,2>{0.493484586f, 0.573196232f},
-std::array<float,2>{0.970155537f, 0.220280096f},
-std::array<float,2>{0.553091705f, 0.949836254f},
-std::array<float,2>{0.200786874f, 0.343902856f},
-std::array<float,2>{0.345140636f, 0.875846326f},
-std::array<float,2>{0.782569587f, 0.304227859f},
-std::array<float,2>{0.670290053f, 0.537153602f},
-std::array<float,2>{0.0833238065f, 0.139972001f},
-std::array<float,2>{0.162359431f, 0.637674212f},
-std::array<float,2>{0.610722482f, 0.0759230778f},
-std::array<float,2>{0.925790787f, 0.800056636f},
-std::array<float,2>{0.387106389f, 0.380843014f},
-std::array<float,2>{0.245952994f, 0.995100915f},
-std::array<float,2>{0.510657191f, 0.328495443f},
-std::array<float,2>{0.945848346f, 0.595309436f},
-std::array<float,2>{0.439182937f, 0.215833291f},
-std::array<float,2>{0.311314613f, 0.725278854f},
-std::array<float,2>{0.850370884f, 0.00320346444f},
-std::array<float,2>{0.730650187f, 0.832784593f},
-std::array<float,2>{0.0483696051f, 0.45869565f},
-std::array<float,2>{0.423163533f, 0.756608427f},
-std::array<float,2>{0.884656072f, 0.432194918f},
-std::array<float,2>{0.579744577f, 0.662267089f},
-std::array<float,2>{0.134082451f, 0.0974814966f},
-std::array<float,2>{0.0938504785f, 0.508072555f},
-std::array<float,2>{0.627314746f, 0.175963357f},
-std::array<float,2>{0.755461812f, 0.910042048f},
-std::array<float,2>{0.325821877f, 0.262362272f},
-std::array<float,2>{0.0585964024f, 0.938356876f},
-std::array<float,2>{0.722651958f, 0.352099985f},
-std::array<float,2>{0.854677916f, 0.568318605f},
-std::array<float,2>{0.303142607f, 0.23168841f},
-std::array<float,2>{0.445975333f, 0.699618101f},
-std::array<float,2>{0.94028461f, 0.0449518375f},
-std::array<float,2>{0.500721216f, 0.866592646f},
-std::array<float,2>{0.239306197f, 0.497045189f},
-std::array<float,2>{0.312730819f, 0.80587709f},
-std::array<float,2>{0.763858318f, 0.389113992f},
-std::array<float,2>{0.638363779f, 0.62666446f},
-std::array<float,2>{0.101785809f, 0.0671027303f},
-std::array<float,2>{0.127745107f, 0.544571221f},
-std::array<float,2>{0.592135131f, 0.132110685f},
-std::array<float,2>{0.878742754f, 0.884680808f},
-std::array<float,2>{0.433128029f, 0.309310704f},
-std::array<float,2>{0.194895968f, 0.839292109f},
-std::array<float,2>{0.561929703f, 0.463224113f},
-std::array<float,2>{0.979217947f, 0.733996391f},
-std::array<float,2>{0.485429198f, 0.0146230925f},
-std::array<float,2>{0.279244751f, 0.60505873f},
-std::array<float,2>{0.816069603f, 0.209955812f},
-std::array<float,2>{0.713847637f, 0.989103198f},
-std::array<float,2>{0.0300347432f, 0.336693406f},
-std::array<float,2>{0.380721688f, 0.920830667f},
-std::array<float,2>{0.933788359f, 0.255627334f},
-std::array<float,2>{0.624607503f, 0.506735504f},
-std::array<float,2>{0.16541566f, 0.183407336f},
-std::array<float,2>{0.0899809822f, 0.665275514f},
-std::array<float,2>{0.663887262f, 0.109139651f},
-std::array<float,2>{0.791117966f, 0.759867728f},
-std::array<float,2>{0.358974516f, 0.425649375f},
-std::array<float,2>{0.120066799f, 0.773999035f},
-std::array<float,2>{0.645547032f, 0.413148999f},
-std::array<float,2>{0.769528925f, 0.686697543f},
-std::array<float,2>{0.340340048f, 0.11201825f},
-std::array<float,2>{0.412988305f, 0.519859672f},
-std::array<float,2>{0.89598304f, 0.162394896f},
-std::array<float,2>{0.564635873f, 0.932821393f},
-std::array<float,2>{0.143961668f, 0.27320388f},
-std::array<float,2>{0.29542768f, 0.97420758f},
-std::array<float,2>{0.861076951f, 0.320157826f},
-std::array<float,2>{0.749281347f, 0.612478554f},
-std::array<float,2>{0.0460416526f, 0.189914837f},
-std::array<float,2>{0.219035625f, 0.74073261f},
-std::array<float,2>{0.51853317f, 0.0219509825f},
-std::array<float,2>{0.959004283f, 0.812873483f},
-std::array<float,2>{0.454810053f, 0.444954425f},
-std::array<float,2>{0.174606547f, 0.896311879f},
-std::array<float,2>{0.602785051f, 0.282264978f},
-std::array<float,2>{0.920117676f, 0.556014597f},
-std::array<float,2>{0.400294274f, 0.146347776f},
-std::array<float,2>{0.374344349f, 0.644614458f},
-std::array<float,2>{0.797448218f, 0.091366224f},
-std::array<float,2>{0.679908931f, 0.795515537f},
-std::array<float,2>{0.0707747042f, 0.404091954f},
-std::array<float,2>{0.483782947f, 0.856690288f},
-std::array<float,2>{0.997044206f, 0.476046085f},
-std::array<float,2>{0.535775721f, 0.715004146f},
-std::array<float,2>{0.206300095f, 0.0562769845f},
-std::array<float,2>{0.0139171518f, 0.579264104f},
-std::array<float,2>{0.688450098f, 0.237829819f},
-std::array<float,2>{0.836013913f, 0.964331686f},
-std::array<float,2>{0.254370719f, 0.36823532f},
-std::array<float,2>{0.0888803452f, 0.958507955f},
-std::array<float,2>{0.660115719f, 0.359548956f},
-std::array<float,2>{0.793117583f, 0.586247027f},
-std::array<float,2>{0.353981495f, 0.248467907f},
-std::array<float,2>{0.375510544f, 0.709574342f},
-std::array<float,2>{0.93005991f, 0.0505562946f},
-std::array<float,2>{0.61880213f, 0.850102365f},
-std::array<float,2>{0.170904219f, 0.477284878f},
-std::array<float,2>{0.276922196f, 0.786923707f},
-std::array<float,2>{0.817796826f, 0.398218215f},
-std::array<float,2>{0.718586087f, 0.654680073f},
-std::array<float,2>{0.0268117767f, 0.085718222f},
-std::array<float,2>{0.189276338f, 0.552377582f},
-std::array<float,2>{0.557839453f, 0.149600178f},
-std::array<float,2>{0.982603848f, 0.898830056f},
-std::array<float,2>{0.490327924f, 0.289941281f},
-std::array<float,2>{0.130421609f, 0.827249408f},
-std::array<float,2>{0.587070644f, 0.446805477f},
-std::array<float,2>{0.880489647f, 0.74419266f},
-std::array<float,2>{0.436672777f, 0.0255988073f},
-std::array<float,2>{0.318295777f, 0.618492186f},
-std::array<float,2>{0.76022625f, 0.200649351f},
-std::array<float,2>{0.632904351f, 0.983678579f},
-std::array<float,2>{0.105735041f, 0.327649653f},
-std::array<float,2>{0.449843615f, 0.92263478f},
-std::array<float,2>{0.945222497f, 0.280535936f},
-std::array<float,2>{0.505465925f, 0.530221343f},
-std::array<float,2>{0.237214044f, 0.164768115f},
-std::array<float,2>{0.0564387441f, 0.674169064f},
-std::array<float,2>{0.725142181f, 0.123398446f},
-std::array<float,2>{0.857532263f, 0.773180604f},
-std::array<float,2>{0.300485402f, 0.420621932f},
-std::array<float,2>{0.0109026069f, 0.751085818f},
-std::array<float,2>{0.695181966f, 0.43388617f},
-std::array<float,2>{0.840104342f, 0.659646392f},
-std::array<float,2>{0.253216833f, 0.0981212333f},
-std::array<float,2>{0.477334589f, 0.51238513f},
-std::array<float,2>{0.993721783f, 0.174505726f},
-std::array<float,2>{0.531796753f, 0.911373794f},
-std::array<float,2>{0.207479715f, 0.260469675f},
-std::array<float,2>{0.368046045f, 0.999146104f},
-std::array<float,2>{0.801720619f, 0.33537358f},
-std::array<float,2>{0.686012685f, 0.59889251f},
-std::array<float,2>{0.0769942254f, 0.21117498f},
-std::array<float,2>{0.179466501f, 0.719527781f},
-std::array<float,2>{0.606267989f, 0.00598740112f},
-std::array<float,2>{0.914282143f, 0.829631746f},
-std::array<float,2>{0.403883636f, 0.454988271f},
-std::array<float,2>{0.222937167f, 0.879240036f},
-std::array<float,2>{0.519704819f, 0.300020367f},
-std::array<float,2>{0.95426482f, 0.53165406f},
-std::array<float,2>{0.457860649f, 0.132910296f},
-std::array<float,2>{0.289407521f, 0.635540903f},
-std::array<float,2>{0.864353895f, 0.0731156841f},
-std::array<float,2>{0.745713234f, 0.802494347f},
-std::array<float,2>{0.0391726643f, 0.37505281f},
-std::array<float,2>{0.409860164f, 0.871998131f},
-std::array<float,2>{0.89341563f, 0.491166204f},
-std::array<float,2>{0.569726825f, 0.687511444f},
-std::array<float,2>{0.147912845f, 0.0346272662f},
-std::array<float,2>{0.121426702f, 0.574873209f},
-std::array<float,2>{0.640989423f, 0.226266533f},
-std::array<float,2>{0.771264434f, 0.947386205f},
-std::array<float,2>{0.337346792f, 0.349265158f},
-std::array<float,2>{0.0387320966f, 0.916555762f},
-std::array<float,2>{0.737015605f, 0.251197666f},
-std::array<float,2>{0.872067571f, 0.502470016f},
-std::array<float,2>{0.282564491f, 0.184228718f},
-std::array<float,2>{0.465806007f, 0.669845045f},
-std::array<float,2>{0.965734541f, 0.101656526f},
-std::array<float,2>{0.52918154f, 0.76402396f},
-std::array<float,2>{0.233568847f, 0.429550558f},
-std::array<float,2>{0.32950002f, 0.843101621f},
-std::array<float,2>{0.775045455f, 0.465382874f},
-std::array<float,2>{0.649044752f, 0.726817191f},
-std::array<float,2>{0.116963446f, 0.0102393078f},
-std::array<float,2>{0.149794593f, 0.608479142f},
-std::array<float,2>{0.573534608f, 0.203210458f},
-std::array<float,2>{0.90057683f, 0.987807095f},
-std::array<float,2>{0.419017106f, 0.341028869f},
-std::array<float,2>{0.218738839f, 0.809950113f},
-std::array<float,2>{0.545662761f, 0.385575473f},
-std::array<float,2>{0.989937663f, 0.629315078f},
-std::array<float,2>{0.473966599f, 0.0660916343f},
-std::array<float,2>{0.262726247f, 0.542703986f},
-std::array<float,2>{0.830843747f, 0.125736535f},
-std::array<float,2>{0.702980459f, 0.8878932f},
-std::array<float,2>{0.00678778719f, 0.305377394f},
-std::array<float,2>{0.396794289f, 0.944264114f},
-std::array<float,2>{0.906870306f, 0.356727242f},
-std::array<float,2>{0.601461649f, 0.565732539f},
-std::array<float,2>{0.183909222f, 0.229438573f},
-std::array<float,2>{0.0656516775f, 0.695738077f},
-std::array<float,2>{0.672471225f, 0.0425178334f},
-std::array<float,2>{0.811049461f, 0.862596095f},
-std::array<float,2>{0.362796932f, 0.49439159f},
-std::array<float,2>{0.100959621f, 0.852472782f},
-std::array<float,2>{0.631286681f, 0.469389349f},
-std::array<float,2>{0.750024199f, 0.711233079f},
-std::array<float,2>{0.323886007f, 0.0591324642f},
-std::array<float,2>{0.426439464f, 0.582668662f},
-std::array<float,2>{0.887984276f, 0.241508603f},
-std::array<float,2>{0.585118949f, 0.967736721f},
-std::array<float,2>{0.138982281f, 0.374829233f},
-std::array<float,2>{0.30675891f, 0.89210397f},
-std::array<float,2>{0.847252548f, 0.286743492f},
-std::array<float,2>{0.728435874f, 0.560941935f},
-std::array<float,2>{0.0519359708f, 0.141117722f},
-std::array<float,2>{0.249954015f, 0.6436795f},
-std::array<float,2>{0.513156772f, 0.0870505273f},
-std::array<float,2>{0.95045191f, 0.789663196f},
-std::array<float,2>{0.442295343f, 0.400669903f},
-std::array<float,2>{0.157352641f, 0.970995605f},
-std::array<float,2>{0.615377545f, 0.315465331f},
-std::array<float,2>{0.924122274f, 0.616949379f},
-std::array<float,2>{0.386613667f, 0.193845674f},
-std::array<float,2>{0.350770831f, 0.737659872f},
-std::array<float,2>{0.788428247f, 0.016414335f},
-std::array<float,2>{0.665383101f, 0.819954097f},
-std::array<float,2>{0.0783819407f, 0.440132469f},
-std::array<float,2>{0.49999097f, 0.779217839f},
-std::array<float,2>{0.974071085f, 0.408682406f},
-std::array<float,2>{0.547936141f, 0.682401299f},
-std::array<float,2>{0.196772188f, 0.11510288f},
-std::array<float,2>{0.0205386449f, 0.516009748f},
-std::array<float,2>{0.705125034f, 0.15970026f},
-std::array<float,2>{0.825911701f, 0.936338842f},
-std::array<float,2>{0.270506293f, 0.266126633f},
-std::array<float,2>{0.112479642f, 0.903679013f},
-std::array<float,2>{0.653230548f, 0.293586463f},
-std::array<float,2>{0.780641079f, 0.550026238f},
-std::array<float,2>{0.333900988f, 0.153329536f},
-std::array<float,2>{0.417126358f, 0.650111973f},
-std::array<float,2>{0.904161453f, 0.0817293525f},
-std::array<float,2>{0.576474905f, 0.783152819f},
-std::array<float,2>{0.156058505f, 0.391222179f},
-std::array<float,2>{0.286144286f, 0.846046567f},
-std::array<float,2>{0.870145798f, 0.483891606f},
-std::array<float,2>{0.740031064f, 0.703915596f},
-std::array<float,2>{0.0350875966f, 0.05354812f},
-std::array<float,2>{0.22747159f, 0.591378748f},
-std::array<float,2>{0.524467111f, 0.243825361f},
-std::array<float,2>{0.963104606f, 0.95571053f},
-std::array<float,2>{0.464243978f, 0.364189863f},
-std::array<float,2>{0.182490423f, 0.769056261f},
-std::array<float,2>{0.597312093f, 0.414253622f},
-std::array<float,2>{0.913625598f, 0.676334143f},
-std::array<float,2>{0.391188532f, 0.120770924f},
-std::array<float,2>{0.363584757f, 0.526070178f},
-std::array<float,2>{0.808353186f, 0.169639274f},
-std::array<float,2>{0.676017821f, 0.92865324f},
-std::array<float,2>{0.0669894367f, 0.274639547f},
-std::array<float,2>{0.470762789f, 0.978065252f},
-std::array<float,2>{0.987079203f, 0.320926994f},
-std::array<float,2>{0.541642368f, 0.621321261f},
-std::array<float,2>{0.211666375f, 0.19572863f},
-std::array<float,2>{0.00133400597f, 0.749115288f},
-std::array<float,2>{0.696185887f, 0.0310460534f},
-std::array<float,2>{0.834934771f, 0.822560668f},
-std::array<float,2>{0.258605391f, 0.452204794f},
-std::array<float,2>{0.0504323542f, 0.835193932f},
-std::array<float,2>{0.733448386f, 0.460738271f},
-std::array<float,2>{0.848368764f, 0.723857343f},
-std::array<float,2>{0.310219407f, 0.000870934338f},
-std::array<float,2>{0.440749407f, 0.595994353f},
-std::array<float,2>{0.94863683f, 0.218108848f},
-std::array<float,2>{0.509763956f, 0.993867218f},
-std::array<float,2>{0.242621437f, 0.330502957f},
-std::array<float,2>{0.327655286f, 0.907365143f},
-std::array<float,2>{0.75618732f, 0.265596211f},
-std::array<float,2>{0.626372278f, 0.509877384f},
-std::array<float,2>{0.09677504f, 0.179153442f},
-std::array<float,2>{0.13578859f, 0.660606563f},
-std::array<float,2>{0.581828535f, 0.0952349752f},
-std::array<float,2>{0.886614203f, 0.754810929f},
-std::array<float,2>{0.424690604f, 0.431447238f},
-std::array<float,2>{0.201929659f, 0.95276475f},
-std::array<float,2>{0.551436186f, 0.347238928f},
-std::array<float,2>{0.972240627f, 0.571867943f},
-std::array<float,2>{0.494365245f, 0.220835909f},
-std::array<float,2>{0.266472876f, 0.692136943f},
-std::array<float,2>{0.823104143f, 0.0355699845f},
-std::array<float,2>{0.709073186f, 0.870778203f},
-std::array<float,2>{0.0189829953f, 0.485674262f},
-std::array<float,2>{0.388761908f, 0.797334075f},
-std::array<float,2>{0.927776873f, 0.382246166f},
-std::array<float,2>{0.612436712f, 0.640314519f},
-std::array<float,2>{0.161688685f, 0.076279752f},
-std::array<float,2>{0.0849977657f, 0.53656286f},
-std::array<float,2>{0.668190897f, 0.136947259f},
-std::array<float,2>{0.783764005f, 0.878490508f},
-std::array<float,2>{0.346417785f, 0.301691324f},
-std::array<float,2>{0.0286263451f, 0.990663826f},
-std::array<float,2>{0.71242696f, 0.337958902f},
-std::array<float,2>{0.813749671f, 0.602071047f},
-std::array<float,2>{0.279449731f, 0.207197264f},
-std::array<float,2>{0.487730771f, 0.730729759f},
-std::array<float,2>{0.976634562f, 0.0118948203f},
-std::array<float,2>{0.56053865f, 0.836805165f},
-std::array<float,2>{0.19196558f, 0.462687284f},
-std::array<float,2>{0.357328951f, 0.758751631f},
-std::array<float,2>{0.790472567f, 0.423211873f},
-std::array<float,2>{0.661664784f, 0.666130126f},
-std::array<float,2>{0.0928407088f, 0.105675489f},
-std::array<float,2>{0.167514175f, 0.504237652f},
-std::array<float,2>{0.621822894f, 0.180416957f},
-std::array<float,2>{0.936624229f, 0.91887331f},
-std::array<float,2>{0.381251425f, 0.257704109f},
-std::array<float,2>{0.241156876f, 0.863639712f},
-std::array<float,2>{0.503083467f, 0.499418914f},
-std::array<float,2>{0.938324213f, 0.701214314f},
-std::array<float,2>{0.448918462f, 0.0430048667f},
-std::array<float,2>{0.30158627f, 0.570239902f},
-std::array<float,2>{0.853378415f, 0.232695609f},
-std::array<float,2>{0.719630659f, 0.93956244f},
-std::array<float,2>{0.0616144389f, 0.355182081f},
-std::array<float,2>{0.430262536f, 0.885411918f},
-std::array<float,2>{0.875885963f, 0.311927468f},
-std::array<float,2>{0.590895057f, 0.546542764f},
-std::array<float,2>{0.125044838f, 0.12948297f},
-std::array<float,2>{0.103714064f, 0.628433287f},
-std::array<float,2>{0.639802992f, 0.069917053f},
-std::array<float,2>{0.763080895f, 0.807195365f},
-std::array<float,2>{0.315211892f, 0.387540489f},
-std::array<float,2>{0.0727194473f, 0.793415844f},
-std::array<float,2>{0.682599485f, 0.405747265f},
-std::array<float,2>{0.799592555f, 0.647739708f},
-std::array<float,2>{0.372820616f, 0.0920897275f},
-std::array<float,2>{0.40096572f, 0.557570934f},
-std::array<float,2>{0.918858051f, 0.146536052f},
-std::array<float,2>{0.604917884f, 0.897692561f},
-std::array<float,2>{0.173586488f, 0.284033895f},
-std::array<float,2>{0.257622182f, 0.96182996f},
-std::array<float,2>{0.839043379f, 0.370731086f},
-std::array<float,2>{0.690784395f, 0.580999076f},
-std::array<float,2>{0.0130924536f, 0.235907167f},
-std::array<float,2>{0.20382385f, 0.717266679f},
-std::array<float,2>{0.538443923f, 0.0574024208f},
-std::array<float,2>{0.999244034f, 0.858534455f},
-std::array<float,2>{0.482025594f, 0.473380744f},
-std::array<float,2>{0.142476216f, 0.929997981f},
-std::array<float,2>{0.56397903f, 0.270806909f},
-std::array<float,2>{0.896519482f, 0.523118079f},
-std::array<float,2>{0.411584765f, 0.160761863f},
-std::array<float,2>{0.341835052f, 0.685468495f},
-std::array<float,2>{0.76663053f, 0.110815786f},
-std::array<float,2>{0.647332132f, 0.776643455f},
-std::array<float,2>{0.119080603f, 0.411250681f},
-std::array<float,2>{0.45515573f, 0.814849377f},
-std::array<float,2>{0.957227468f, 0.441598296f},
-std::array<float,2>{0.516324222f, 0.738981009f},
-std::array<float,2>{0.220792517f, 0.0213375017f},
-std::array<float,2>{0.0436393991f, 0.610780895f},
-std::array<float,2>{0.746416152f, 0.188258693f},
-std::array<float,2>{0.863242269f, 0.976432681f},
-std::array<float,2>{0.294083655f, 0.317741245f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.124358959f, 0.11767973f},
-std::array<float,2>{0.654061854f, 0.901890874f},
-std::array<float,2>{0.433453918f, 0.544966042f},
-std::array<float,2>{0.853677869f, 0.476661921f},
-std::array<float,2>{0.263097554f, 0.315691978f},
-std::array<float,2>{0.916084409f, 0.746491373f},
-std::array<float,2>{0.24275285f, 0.826390982f},
-std::array<float,2>{0.549754679f, 0.198080555f},
-std::array<float,2>{0.499581426f, 0.179968268f},
-std::array<float,2>{0.787852347f, 0.753764927f},
-std::array<float,2>{0.0117842667f, 0.654910803f},
-std::array<float,2>{0.717330992f, 0.277861059f},
-std::array<float,2>{0.14089343f, 0.412058592f},
-std::array<float,2>{0.611485898f, 0.570509434f},
-std::array<float,2>{0.364188999f, 0.97716254f},
-std::array<float,2>{0.970204592f, 0.00652469741f},
-std::array<float,2>{0.193056539f, 0.238979235f},
-std::array<float,2>{0.520699441f, 0.853187323f},
-std::array<float,2>{0.291644096f, 0.703678012f},
-std::array<float,2>{0.898819923f, 0.351899058f},
-std::array<float,2>{0.384901106f, 0.440002322f},
-std::array<float,2>{0.821345508f, 0.508952022f},
-std::array<float,2>{0.0865867585f, 0.928923666f},
-std::array<float,2>{0.684918582f, 0.0728948414f},
-std::array<float,2>{0.324480981f, 0.0583196506f},
-std::array<float,2>{0.966975391f, 0.967643976f},
-std::array<float,2>{0.178596482f, 0.614579439f},
-std::array<float,2>{0.584288538f, 0.377893895f},
-std::array<float,2>{0.0513322055f, 0.285887688f},
-std::array<float,2>{0.72417891f, 0.660615087f},
-std::array<float,2>{0.456412464f, 0.805697322f},
-std::array<float,2>{0.755741298f, 0.128444105f},
-std::array<float,2>{0.159935951f, 0.0232059527f},
-std::array<float,2>{0.574900091f, 0.993701518f},
-std::array<float,2>{0.335036963f, 0.579543591f},
-std::array<float,2>{0.94962728f, 0.424607545f},
-std::array<float,2>{0.445367754f, 0.251243323f},
-std::array<float,2>{0.777020216f, 0.638325155f},
-std::array<float,2>{0.0461674668f, 0.773465991f},
-std::array<float,2>{0.746022344f, 0.166949779f},
-std::array<float,2>{0.30305329f, 0.20523347f},
-std::array<float,2>{0.886011362f, 0.839551091f},
-std::array<float,2>{0.217877612f, 0.732269287f},
-std::array<float,2>{0.503265858f, 0.332667798f},
-std::array<float,2>{0.076298669f, 0.48516649f},
-std::array<float,2>{0.663813949f, 0.558097899f},
-std::array<float,2>{0.396914721f, 0.884637952f},
-std::array<float,2>{0.831247032f, 0.0945568383f},
-std::array<float,2>{0.0300121587f, 0.144485414f},
-std::array<float,2>{0.691543818f, 0.785540462f},
-std::array<float,2>{0.48408848f, 0.686474383f},
-std::array<float,2>{0.812032819f, 0.298868477f},
-std::array<float,2>{0.343874961f, 0.396896452f},
-std::array<float,2>{0.98682332f, 0.59865129f},
-std::array<float,2>{0.134212658f, 0.949318349f},
-std::array<float,2>{0.599804521f, 0.0410158895f},
-std::array<float,2>{0.418263614f, 0.0845303982f},
-std::array<float,2>{0.86365211f, 0.908329368f},
-std::array<float,2>{0.105767883f, 0.52553767f},
-std::array<float,2>{0.632456183f, 0.461869627f},
-std::array<float,2>{0.220846638f, 0.373580962f},
-std::array<float,2>{0.546728909f, 0.69301182f},
-std::array<float,2>{0.278574258f, 0.866446555f},
-std::array<float,2>{0.930870593f, 0.232132435f},
-std::array<float,2>{0.0332094692f, 0.0381448492f},
-std::array<float,2>{0.735332131f, 0.941971958f},
-std::array<float,2>{0.440906256f, 0.604794979f},
-std::array<float,2>{0.76930815f, 0.405394375f},
-std::array<float,2>{0.340409011f, 0.31026724f},
-std::array<float,2>{0.938657522f, 0.677668571f},
-std::array<float,2>{0.169975638f, 0.795419633f},
-std::array<float,2>{0.565812528f, 0.150084525f},
-std::array<float,2>{0.401604474f, 0.225135759f},
-std::array<float,2>{0.838105202f, 0.873561621f},
-std::array<float,2>{0.0698061362f, 0.696362317f},
-std::array<float,2>{0.668776751f, 0.364853323f},
-std::array<float,2>{0.208058998f, 0.454364032f},
-std::array<float,2>{0.513701141f, 0.51818645f},
-std::array<float,2>{0.306972086f, 0.921496511f},
-std::array<float,2>{0.880086541f, 0.0930856168f},
-std::array<float,2>{0.132141545f, 0.162353456f},
-std::array<float,2>{0.604153037f, 0.770041704f},
-std::array<float,2>{0.356461108f, 0.632261515f},
-std::array<float,2>{0.995692313f, 0.260892928f},
-std::array<float,2>{0.470493406f, 0.436153769f},
-std::array<float,2>{0.802062988f, 0.591183722f},
-std::array<float,2>{0.0157415234f, 0.984565854f},
-std::array<float,2>{0.697416365f, 0.0304745454f},
-std::array<float,2>{0.266342521f, 0.10439948f},
-std::array<float,2>{0.926582694f, 0.88188976f},
-std::array<float,2>{0.232231408f, 0.548393607f},
-std::array<float,2>{0.531906843f, 0.494639933f},
-std::array<float,2>{0.0946946293f, 0.341392875f},
-std::array<float,2>{0.639725804f, 0.719852686f},
-std::array<float,2>{0.412506551f, 0.834656179f},
-std::array<float,2>{0.874201357f, 0.217528552f},
-std::array<float,2>{0.236739188f, 0.066143021f},
-std::array<float,2>{0.558757603f, 0.933545887f},
-std::array<float,2>{0.251114309f, 0.503400564f},
-std::array<float,2>{0.906431317f, 0.44797954f},
-std::array<float,2>{0.425383121f, 0.347200036f},
-std::array<float,2>{0.846251845f, 0.716092288f},
-std::array<float,2>{0.11267063f, 0.845077872f},
-std::array<float,2>{0.643794894f, 0.242476121f},
-std::array<float,2>{0.373981833f, 0.134120315f},
-std::array<float,2>{0.978106201f, 0.797023296f},
-std::array<float,2>{0.15000087f, 0.666181862f},
-std::array<float,2>{0.619714379f, 0.291747808f},
-std::array<float,2>{0.00582811842f, 0.386752278f},
-std::array<float,2>{0.710809648f, 0.621449292f},
-std::array<float,2>{0.486237705f, 0.960746884f},
-std::array<float,2>{0.796477139f, 0.05461872f},
-std::array<float,2>{0.0853832141f, 0.192317083f},
-std::array<float,2>{0.673431039f, 0.816002786f},
-std::array<float,2>{0.376518756f, 0.740977764f},
-std::array<float,2>{0.813463926f, 0.327005535f},
-std::array<float,2>{0.282604456f, 0.47018227f},
-std::array<float,2>{0.89363265f, 0.5329476f},
-std::array<float,2>{0.198440805f, 0.897243977f},
-std::array<float,2>{0.526336133f, 0.114972852f},
-std::array<float,2>{0.468464106f, 0.0115641011f},
-std::array<float,2>{0.76188612f, 0.975666642f},
-std::array<float,2>{0.0547291748f, 0.570206702f},
-std::array<float,2>{0.731437981f, 0.416069955f},
-std::array<float,2>{0.182587564f, 0.270322174f},
-std::array<float,2>{0.58747828f, 0.640977323f},
-std::array<float,2>{0.31675157f, 0.760112107f},
-std::array<float,2>{0.960630119f, 0.176196471f},
-std::array<float,2>{0.0635069981f, 0.00282415678f},
-std::array<float,2>{0.666648448f, 0.984054685f},
-std::array<float,2>{0.404975504f, 0.574767768f},
-std::array<float,2>{0.839895785f, 0.408950806f},
-std::array<float,2>{0.308840036f, 0.275967628f},
-std::array<float,2>{0.877411008f, 0.651091933f},
-std::array<float,2>{0.204368651f, 0.755952179f},
-std::array<float,2>{0.511035502f, 0.186756924f},
-std::array<float,2>{0.44257018f, 0.20122534f},
-std::array<float,2>{0.770280778f, 0.823915482f},
-std::array<float,2>{0.0354897343f, 0.744798005f},
-std::array<float,2>{0.741492689f, 0.31882745f},
-std::array<float,2>{0.167911798f, 0.482930839f},
-std::array<float,2>{0.569986939f, 0.541119337f},
-std::array<float,2>{0.336567819f, 0.905280232f},
-std::array<float,2>{0.941537976f, 0.122819684f},
-std::array<float,2>{0.230042234f, 0.132084981f},
-std::array<float,2>{0.536360502f, 0.810960174f},
-std::array<float,2>{0.270501077f, 0.658074737f},
-std::array<float,2>{0.922337711f, 0.284040987f},
-std::array<float,2>{0.407475442f, 0.381063282f},
-std::array<float,2>{0.869208753f, 0.610305727f},
-std::array<float,2>{0.101154365f, 0.964537501f},
-std::array<float,2>{0.636036098f, 0.0603162423f},
-std::array<float,2>{0.354778141f, 0.0773193464f},
-std::array<float,2>{0.99843353f, 0.923451543f},
-std::array<float,2>{0.126391098f, 0.515570879f},
-std::array<float,2>{0.606003702f, 0.444207788f},
-std::array<float,2>{0.0211781282f, 0.35836041f},
-std::array<float,2>{0.70118171f, 0.708579183f},
-std::array<float,2>{0.472867131f, 0.857588053f},
-std::array<float,2>{0.799384594f, 0.23473227f},
-std::array<float,2>{0.152979448f, 0.0995340273f},
-std::array<float,2>{0.622998416f, 0.888509631f},
-std::array<float,2>{0.367693663f, 0.559351146f},
-std::array<float,2>{0.982402086f, 0.49136281f},
-std::array<float,2>{0.49218604f, 0.32996887f},
-std::array<float,2>{0.789659321f, 0.728645444f},
-std::array<float,2>{0.0033374168f, 0.840555549f},
-std::array<float,2>{0.705344737f, 0.208122402f},
-std::array<float,2>{0.254399329f, 0.17172429f},
-std::array<float,2>{0.913927853f, 0.780436337f},
-std::array<float,2>{0.239759639f, 0.634043872f},
-std::array<float,2>{0.55719167f, 0.254171669f},
-std::array<float,2>{0.115833439f, 0.426933408f},
-std::array<float,2>{0.647309363f, 0.585381746f},
-std::array<float,2>{0.427737921f, 0.999714971f},
-std::array<float,2>{0.85075289f, 0.0163575001f},
-std::array<float,2>{0.0621799715f, 0.227151498f},
-std::array<float,2>{0.727928698f, 0.86010164f},
-std::array<float,2>{0.464337915f, 0.68860364f},
-std::array<float,2>{0.760020375f, 0.367677301f},
-std::array<float,2>{0.315143168f, 0.466463208f},
-std::array<float,2>{0.955014944f, 0.528461814f},
-std::array<float,2>{0.184917852f, 0.913609743f},
-std::array<float,2>{0.592561603f, 0.0805978701f},
-std::array<float,2>{0.380304456f, 0.0438808873f},
-std::array<float,2>{0.817591786f, 0.948262155f},
-std::array<float,2>{0.0791813731f, 0.59423542f},
-std::array<float,2>{0.678075969f, 0.392166436f},
-std::array<float,2>{0.201939225f, 0.30118829f},
-std::array<float,2>{0.528829873f, 0.681008577f},
-std::array<float,2>{0.285317719f, 0.781980872f},
-std::array<float,2>{0.894674361f, 0.146630272f},
-std::array<float,2>{0.00894065574f, 0.0875824615f},
-std::array<float,2>{0.714762986f, 0.917748392f},
-std::array<float,2>{0.49455297f, 0.519904196f},
-std::array<float,2>{0.781466365f, 0.459715605f},
-std::array<float,2>{0.361293018f, 0.36169377f},
-std::array<float,2>{0.973956585f, 0.702166677f},
-std::array<float,2>{0.146101967f, 0.868408084f},
-std::array<float,2>{0.616325378f, 0.222050488f},
-std::array<float,2>{0.435376018f, 0.155310631f},
-std::array<float,2>{0.857861936f, 0.7893852f},
-std::array<float,2>{0.118517675f, 0.672375619f},
-std::array<float,2>{0.648524404f, 0.306044549f},
-std::array<float,2>{0.249198124f, 0.40101707f},
-std::array<float,2>{0.554489493f, 0.607533932f},
-std::array<float,2>{0.259665966f, 0.940595627f},
-std::array<float,2>{0.91940403f, 0.0315386429f},
-std::array<float,2>{0.174537227f, 0.212531164f},
-std::array<float,2>{0.578166068f, 0.828442633f},
-std::array<float,2>{0.321226686f, 0.72436434f},
-std::array<float,2>{0.962232053f, 0.3392905f},
-std::array<float,2>{0.46008715f, 0.497175157f},
-std::array<float,2>{0.752142012f, 0.554453611f},
-std::array<float,2>{0.0472170115f, 0.876757264f},
-std::array<float,2>{0.722136021f, 0.109335154f},
-std::array<float,2>{0.294242203f, 0.024905825f},
-std::array<float,2>{0.902998388f, 0.989347219f},
-std::array<float,2>{0.187724113f, 0.587498605f},
-std::array<float,2>{0.517829239f, 0.430061907f},
-std::array<float,2>{0.0918265432f, 0.262891054f},
-std::array<float,2>{0.682426035f, 0.628231764f},
-std::array<float,2>{0.390473366f, 0.769004107f},
-std::array<float,2>{0.827671647f, 0.159375727f},
-std::array<float,2>{0.211298987f, 0.0506766215f},
-std::array<float,2>{0.504281938f, 0.956500471f},
-std::array<float,2>{0.300657362f, 0.618617058f},
-std::array<float,2>{0.888838172f, 0.385782152f},
-std::array<float,2>{0.390798032f, 0.296592563f},
-std::array<float,2>{0.835578263f, 0.669039905f},
-std::array<float,2>{0.0735529214f, 0.803492665f},
-std::array<float,2>{0.656714141f, 0.138905391f},
-std::array<float,2>{0.328450024f, 0.248077899f},
-std::array<float,2>{0.947773099f, 0.851330221f},
-std::array<float,2>{0.162758619f, 0.711996377f},
-std::array<float,2>{0.570664823f, 0.350556552f},
-std::array<float,2>{0.0403270759f, 0.449834973f},
-std::array<float,2>{0.746710062f, 0.504146636f},
-std::array<float,2>{0.4516249f, 0.936050534f},
-std::array<float,2>{0.779189348f, 0.0665261f},
-std::array<float,2>{0.103087358f, 0.172021225f},
-std::array<float,2>{0.628805459f, 0.762372196f},
-std::array<float,2>{0.415208429f, 0.648043573f},
-std::array<float,2>{0.861812651f, 0.269348502f},
-std::array<float,2>{0.276485592f, 0.418753386f},
-std::array<float,2>{0.936310053f, 0.565500975f},
-std::array<float,2>{0.225157484f, 0.972259462f},
-std::array<float,2>{0.540317535f, 0.0152792353f},
-std::array<float,2>{0.479709029f, 0.111099511f},
-std::array<float,2>{0.806722164f, 0.892498255f},
-std::array<float,2>{0.0237465315f, 0.536566734f},
-std::array<float,2>{0.688472867f, 0.474092543f},
-std::array<float,2>{0.139969513f, 0.321038455f},
-std::array<float,2>{0.594877899f, 0.735827088f},
-std::array<float,2>{0.350394517f, 0.818417311f},
-std::array<float,2>{0.990889788f, 0.191397429f},
-std::array<float,2>{0.0887616426f, 0.0710831732f},
-std::array<float,2>{0.686865568f, 0.926584661f},
-std::array<float,2>{0.384546131f, 0.510242105f},
-std::array<float,2>{0.823850751f, 0.43912822f},
-std::array<float,2>{0.28963244f, 0.355430692f},
-std::array<float,2>{0.900392711f, 0.706718922f},
-std::array<float,2>{0.195030183f, 0.855136275f},
-std::array<float,2>{0.522245169f, 0.24112311f},
-std::array<float,2>{0.45405075f, 0.12659955f},
-std::array<float,2>{0.757687807f, 0.807454467f},
-std::array<float,2>{0.0536815003f, 0.664008975f},
-std::array<float,2>{0.725098014f, 0.288677275f},
-std::array<float,2>{0.175801143f, 0.375531375f},
-std::array<float,2>{0.582120895f, 0.615486562f},
-std::array<float,2>{0.326397568f, 0.96597904f},
-std::array<float,2>{0.965365648f, 0.0552112088f},
-std::array<float,2>{0.244143486f, 0.195713341f},
-std::array<float,2>{0.547612011f, 0.824835658f},
-std::array<float,2>{0.264489383f, 0.749761701f},
-std::array<float,2>{0.914537013f, 0.313623577f},
-std::array<float,2>{0.42980659f, 0.479663342f},
-std::array<float,2>{0.85233748f, 0.543032765f},
-std::array<float,2>{0.12299405f, 0.899621606f},
-std::array<float,2>{0.654368699f, 0.119380258f},
-std::array<float,2>{0.365253419f, 0.00394082209f},
-std::array<float,2>{0.971857905f, 0.978819907f},
-std::array<float,2>{0.143599942f, 0.574177802f},
-std::array<float,2>{0.611066759f, 0.41240263f},
-std::array<float,2>{0.014206253f, 0.280476272f},
-std::array<float,2>{0.715791941f, 0.653520107f},
-std::array<float,2>{0.496188313f, 0.751223683f},
-std::array<float,2>{0.785953522f, 0.183271959f},
-std::array<float,2>{0.135002017f, 0.0391460098f},
-std::array<float,2>{0.598179162f, 0.95216167f},
-std::array<float,2>{0.346357018f, 0.599927664f},
-std::array<float,2>{0.98587805f, 0.394678414f},
-std::array<float,2>{0.482097477f, 0.298158795f},
-std::array<float,2>{0.8086133f, 0.685429931f},
-std::array<float,2>{0.0275979843f, 0.788802028f},
-std::array<float,2>{0.694113731f, 0.140653238f},
-std::array<float,2>{0.279426932f, 0.232639953f},
-std::array<float,2>{0.932652295f, 0.864142597f},
-std::array<float,2>{0.219490126f, 0.694285631f},
-std::array<float,2>{0.544345558f, 0.372053683f},
-std::array<float,2>{0.108126245f, 0.464138716f},
-std::array<float,2>{0.629381776f, 0.524128854f},
-std::array<float,2>{0.421019822f, 0.907278895f},
-std::array<float,2>{0.865287483f, 0.0830408856f},
-std::array<float,2>{0.0431843475f, 0.165142566f},
-std::array<float,2>{0.742653728f, 0.77547437f},
-std::array<float,2>{0.448269606f, 0.638727546f},
-std::array<float,2>{0.774597526f, 0.252581328f},
-std::array<float,2>{0.332156628f, 0.422081321f},
-std::array<float,2>{0.951423824f, 0.580663979f},
-std::array<float,2>{0.157665774f, 0.994572818f},
-std::array<float,2>{0.577394664f, 0.0212494731f},
-std::array<float,2>{0.394936591f, 0.0964052603f},
-std::array<float,2>{0.828365982f, 0.885612667f},
-std::array<float,2>{0.0751528293f, 0.555614233f},
-std::array<float,2>{0.660809994f, 0.486835241f},
-std::array<float,2>{0.216741726f, 0.335880399f},
-std::array<float,2>{0.500196517f, 0.733392179f},
-std::array<float,2>{0.302008301f, 0.836304486f},
-std::array<float,2>{0.884689391f, 0.203533649f},
-std::array<float,2>{0.0186908338f, 0.0278224479f},
-std::array<float,2>{0.696695983f, 0.987567246f},
-std::array<float,2>{0.470843405f, 0.591956973f},
-std::array<float,2>{0.804106951f, 0.434123755f},
-std::array<float,2>{0.357777804f, 0.259524912f},
-std::array<float,2>{0.992597222f, 0.62910521f},
-std::array<float,2>{0.130848274f, 0.771651328f},
-std::array<float,2>{0.602801621f, 0.160773516f},
-std::array<float,2>{0.410746872f, 0.216483787f},
-std::array<float,2>{0.872691989f, 0.83363241f},
-std::array<float,2>{0.0966632739f, 0.722522795f},
-std::array<float,2>{0.636724412f, 0.343153149f},
-std::array<float,2>{0.233240619f, 0.494001508f},
-std::array<float,2>{0.533881724f, 0.55043757f},
-std::array<float,2>{0.268426776f, 0.880277514f},
-std::array<float,2>{0.929332852f, 0.101743296f},
-std::array<float,2>{0.169523343f, 0.152076319f},
-std::array<float,2>{0.563778639f, 0.793666363f},
-std::array<float,2>{0.342987806f, 0.67777741f},
-std::array<float,2>{0.940560758f, 0.312232643f},
-std::array<float,2>{0.439008772f, 0.403737396f},
-std::array<float,2>{0.766857147f, 0.602308452f},
-std::array<float,2>{0.0323131904f, 0.94479984f},
-std::array<float,2>{0.737844765f, 0.0353372768f},
-std::array<float,2>{0.305272132f, 0.0909625962f},
-std::array<float,2>{0.881582618f, 0.919146538f},
-std::array<float,2>{0.209367841f, 0.515770018f},
-std::array<float,2>{0.512629569f, 0.456639409f},
-std::array<float,2>{0.0674312338f, 0.36693275f},
-std::array<float,2>{0.67127651f, 0.69793576f},
-std::array<float,2>{0.400375336f, 0.872321129f},
-std::array<float,2>{0.836982369f, 0.224021167f},
-std::array<float,2>{0.196489483f, 0.116056792f},
-std::array<float,2>{0.524828792f, 0.895328462f},
-std::array<float,2>{0.284985423f, 0.534274399f},
-std::array<float,2>{0.891485453f, 0.472413331f},
-std::array<float,2>{0.37720868f, 0.32569623f},
-std::array<float,2>{0.814684272f, 0.739679217f},
-std::array<float,2>{0.0831614584f, 0.813076258f},
-std::array<float,2>{0.674111187f, 0.195021361f},
-std::array<float,2>{0.320046604f, 0.179311126f},
-std::array<float,2>{0.957730651f, 0.757834017f},
-std::array<float,2>{0.181040525f, 0.643468499f},
-std::array<float,2>{0.588117599f, 0.272036523f},
-std::array<float,2>{0.0577139519f, 0.415594637f},
-std::array<float,2>{0.732592523f, 0.566735744f},
-std::array<float,2>{0.466016352f, 0.972726405f},
-std::array<float,2>{0.765529692f, 0.00905883871f},
-std::array<float,2>{0.109596953f, 0.244778737f},
-std::array<float,2>{0.642394125f, 0.84620738f},
-std::array<float,2>{0.42212835f, 0.718383908f},
-std::array<float,2>{0.845500946f, 0.344719827f},
-std::array<float,2>{0.253138125f, 0.445824146f},
-std::array<float,2>{0.909508109f, 0.500700176f},
-std::array<float,2>{0.235992238f, 0.930872619f},
-std::array<float,2>{0.561534107f, 0.0627940893f},
-std::array<float,2>{0.487311631f, 0.0524404533f},
-std::array<float,2>{0.793722451f, 0.957662761f},
-std::array<float,2>{0.00707163801f, 0.623894751f},
-std::array<float,2>{0.707544565f, 0.389552563f},
-std::array<float,2>{0.150632426f, 0.290888011f},
-std::array<float,2>{0.617802203f, 0.665269732f},
-std::array<float,2>{0.371875793f, 0.800558507f},
-std::array<float,2>{0.979725361f, 0.135450363f},
-std::array<float,2>{0.0982514843f, 0.0616854802f},
-std::array<float,2>{0.633902431f, 0.961078465f},
-std::array<float,2>{0.409088671f, 0.612359405f},
-std::array<float,2>{0.868618548f, 0.380321562f},
-std::array<float,2>{0.272322506f, 0.283062875f},
-std::array<float,2>{0.924208164f, 0.658736348f},
-std::array<float,2>{0.228504434f, 0.809913576f},
-std::array<float,2>{0.537499845f, 0.130179733f},
-std::array<float,2>{0.476133555f, 0.237399325f},
-std::array<float,2>{0.797393322f, 0.857093573f},
-std::array<float,2>{0.0221673138f, 0.709046364f},
-std::array<float,2>{0.699254096f, 0.357320577f},
-std::array<float,2>{0.127695337f, 0.442447841f},
-std::array<float,2>{0.60817337f, 0.513102055f},
-std::array<float,2>{0.351870418f, 0.92455405f},
-std::array<float,2>{0.997770965f, 0.0749704912f},
-std::array<float,2>{0.206582054f, 0.184651449f},
-std::array<float,2>{0.50945133f, 0.754966557f},
-std::array<float,2>{0.3108325f, 0.648793757f},
-std::array<float,2>{0.875486135f, 0.274885207f},
-std::array<float,2>{0.402803689f, 0.407517105f},
-std::array<float,2>{0.842630804f, 0.578099191f},
-std::array<float,2>{0.0649406016f, 0.982226312f},
-std::array<float,2>{0.665275753f, 0.000694101211f},
-std::array<float,2>{0.339301139f, 0.124891251f},
-std::array<float,2>{0.944692612f, 0.902672827f},
-std::array<float,2>{0.164858118f, 0.53907764f},
-std::array<float,2>{0.568079531f, 0.482198209f},
-std::array<float,2>{0.0382649191f, 0.316567987f},
-std::array<float,2>{0.73900336f, 0.744028449f},
-std::array<float,2>{0.444970667f, 0.821468115f},
-std::array<float,2>{0.77242732f, 0.199582174f},
-std::array<float,2>{0.187197611f, 0.0792356506f},
-std::array<float,2>{0.591321588f, 0.910803497f},
-std::array<float,2>{0.313468248f, 0.531072557f},
-std::array<float,2>{0.955940247f, 0.467067271f},
-std::array<float,2>{0.461914301f, 0.370115459f},
-std::array<float,2>{0.759154022f, 0.689767957f},
-std::array<float,2>{0.0592869632f, 0.861956418f},
-std::array<float,2>{0.729073226f, 0.229217857f},
-std::array<float,2>{0.288747102f, 0.145730525f},
-std::array<float,2>{0.896945775f, 0.783268452f},
-std::array<float,2>{0.199414939f, 0.683222592f},
-std::array<float,2>{0.530451417f, 0.303569317f},
-std::array<float,2>{0.0804956108f, 0.393066764f},
-std::array<float,2>{0.676472545f, 0.595892608f},
-std::array<float,2>{0.380964398f, 0.94656527f},
-std::array<float,2>{0.819228649f, 0.0462089367f},
-std::array<float,2>{0.000760583265f, 0.21074295f},
-std::array<float,2>{0.70324564f, 0.843463123f},
-std::array<float,2>{0.489737898f, 0.728153527f},
-std::array<float,2>{0.791569591f, 0.331109554f},
-std::array<float,2>{0.370114177f, 0.488638282f},
-std::array<float,2>{0.983762562f, 0.561800957f},
-std::array<float,2>{0.154732972f, 0.889166594f},
-std::array<float,2>{0.623744071f, 0.101273216f},
-std::array<float,2>{0.427591532f, 0.0187708363f},
-std::array<float,2>{0.848930061f, 0.996683538f},
-std::array<float,2>{0.11495883f, 0.582684398f},
-std::array<float,2>{0.646463454f, 0.429641008f},
-std::array<float,2>{0.240348458f, 0.257582605f},
-std::array<float,2>{0.55512023f, 0.63565135f},
-std::array<float,2>{0.256204754f, 0.777549684f},
-std::array<float,2>{0.910503983f, 0.16893661f},
-std::array<float,2>{0.0493137538f, 0.107013024f},
-std::array<float,2>{0.720053256f, 0.877866566f},
-std::array<float,2>{0.458790779f, 0.551630795f},
-std::array<float,2>{0.751789153f, 0.498376429f},
-std::array<float,2>{0.324100554f, 0.337115705f},
-std::array<float,2>{0.963730991f, 0.724646866f},
-std::array<float,2>{0.172966063f, 0.831280351f},
-std::array<float,2>{0.581591547f, 0.214174241f},
-std::array<float,2>{0.386849493f, 0.156898856f},
-std::array<float,2>{0.824263215f, 0.767192543f},
-std::array<float,2>{0.0906937271f, 0.626103699f},
-std::array<float,2>{0.679847121f, 0.264567018f},
-std::array<float,2>{0.191087842f, 0.433430254f},
-std::array<float,2>{0.516172767f, 0.589597821f},
-std::array<float,2>{0.296087861f, 0.990659654f},
-std::array<float,2>{0.906233549f, 0.0272727851f},
-std::array<float,2>{0.146617144f, 0.219213992f},
-std::array<float,2>{0.613480091f, 0.870388687f},
-std::array<float,2>{0.36164403f, 0.700294077f},
-std::array<float,2>{0.976224065f, 0.359665006f},
-std::array<float,2>{0.493412852f, 0.457215756f},
-std::array<float,2>{0.784366846f, 0.522338271f},
-std::array<float,2>{0.0114492457f, 0.915855885f},
-std::array<float,2>{0.712267518f, 0.0880454779f},
-std::array<float,2>{0.260185897f, 0.0335432328f},
-std::array<float,2>{0.921355069f, 0.937699735f},
-std::array<float,2>{0.246888161f, 0.60572058f},
-std::array<float,2>{0.551797688f, 0.399470329f},
-std::array<float,2>{0.120085761f, 0.307706386f},
-std::array<float,2>{0.651903212f, 0.67446506f},
-std::array<float,2>{0.437416762f, 0.791127086f},
-std::array<float,2>{0.856649876f, 0.152851343f},
-std::array<float,2>{0.22301124f, 0.0119647374f},
-std::array<float,2>{0.542224288f, 0.969852567f},
-std::array<float,2>{0.275306016f, 0.564097047f},
-std::array<float,2>{0.933700442f, 0.421006978f},
-std::array<float,2>{0.41764456f, 0.266866088f},
-std::array<float,2>{0.860405087f, 0.645429552f},
-std::array<float,2>{0.105195694f, 0.764829278f},
-std::array<float,2>{0.626478732f, 0.175033644f},
-std::array<float,2>{0.349101365f, 0.18828541f},
-std::array<float,2>{0.990003049f, 0.817301393f},
-std::array<float,2>{0.138511106f, 0.737660587f},
-std::array<float,2>{0.59716469f, 0.32296443f},
-std::array<float,2>{0.0258325897f, 0.475202918f},
-std::array<float,2>{0.689892054f, 0.538572192f},
-std::array<float,2>{0.477970213f, 0.892786741f},
-std::array<float,2>{0.805900574f, 0.113216288f},
-std::array<float,2>{0.0717645511f, 0.137020558f},
-std::array<float,2>{0.660046041f, 0.801052094f},
-std::array<float,2>{0.393879384f, 0.67128557f},
-std::array<float,2>{0.833820701f, 0.293990612f},
-std::array<float,2>{0.298327595f, 0.38371408f},
-std::array<float,2>{0.88763088f, 0.619497001f},
-std::array<float,2>{0.213662356f, 0.954699218f},
-std::array<float,2>{0.506948173f, 0.048783347f},
-std::array<float,2>{0.449811667f, 0.0687252432f},
-std::array<float,2>{0.780000269f, 0.934999704f},
-std::array<float,2>{0.042291902f, 0.506202996f},
-std::array<float,2>{0.748579085f, 0.451602548f},
-std::array<float,2>{0.161673531f, 0.348661929f},
-std::array<float,2>{0.573485613f, 0.712950587f},
-std::array<float,2>{0.331293315f, 0.848716199f},
-std::array<float,2>{0.945616961f, 0.246673152f},
-std::array<float,2>{0.106879406f, 0.082176134f},
-std::array<float,2>{0.631009281f, 0.906638145f},
-std::array<float,2>{0.419534445f, 0.525302172f},
-std::array<float,2>{0.864660621f, 0.463802457f},
-std::array<float,2>{0.277920425f, 0.372427374f},
-std::array<float,2>{0.930263937f, 0.695174754f},
-std::array<float,2>{0.221732289f, 0.864445746f},
-std::array<float,2>{0.545205832f, 0.233945027f},
-std::array<float,2>{0.483029455f, 0.142382771f},
-std::array<float,2>{0.811238766f, 0.787701309f},
-std::array<float,2>{0.0309605934f, 0.684273541f},
-std::array<float,2>{0.692558944f, 0.297454536f},
-std::array<float,2>{0.132940933f, 0.39630568f},
-std::array<float,2>{0.601098835f, 0.600965619f},
-std::array<float,2>{0.34510231f, 0.952095449f},
-std::array<float,2>{0.988238096f, 0.0403184406f},
-std::array<float,2>{0.217025742f, 0.205072165f},
-std::array<float,2>{0.502479076f, 0.83716023f},
-std::array<float,2>{0.304244518f, 0.733481288f},
-std::array<float,2>{0.885314941f, 0.334404677f},
-std::array<float,2>{0.39774248f, 0.48827365f},
-std::array<float,2>{0.830376089f, 0.555868566f},
-std::array<float,2>{0.0777732506f, 0.885992169f},
-std::array<float,2>{0.662748873f, 0.0970131159f},
-std::array<float,2>{0.334904701f, 0.0198138822f},
-std::array<float,2>{0.95049423f, 0.995229721f},
-std::array<float,2>{0.158466503f, 0.581330061f},
-std::array<float,2>{0.575995386f, 0.423560292f},
-std::array<float,2>{0.0456472896f, 0.253255576f},
-std::array<float,2>{0.744443536f, 0.640461326f},
-std::array<float,2>{0.446576387f, 0.777053416f},
-std::array<float,2>{0.775668979f, 0.164275631f},
-std::array<float,2>{0.17874445f, 0.0558249019f},
-std::array<float,2>{0.585261226f, 0.965631783f},
-std::array<float,2>{0.325471193f, 0.616485119f},
-std::array<float,2>{0.968404651f, 0.376699775f},
-std::array<float,2>{0.455965042f, 0.287412971f},
-std::array<float,2>{0.75400281f, 0.662140727f},
-std::array<float,2>{0.0523858294f, 0.808433652f},
-std::array<float,2>{0.722889185f, 0.125271022f},
-std::array<float,2>{0.292212903f, 0.242071271f},
-std::array<float,2>{0.900141478f, 0.853781343f},
-std::array<float,2>{0.191713259f, 0.705178976f},
-std::array<float,2>{0.520054996f, 0.354008257f},
-std::array<float,2>{0.0874581113f, 0.438064337f},
-std::array<float,2>{0.684427738f, 0.510987639f},
-std::array<float,2>{0.386100084f, 0.92752111f},
-std::array<float,2>{0.821155548f, 0.0716844425f},
-std::array<float,2>{0.0132182445f, 0.182583809f},
-std::array<float,2>{0.718268692f, 0.75081706f},
-std::array<float,2>{0.498414457f, 0.653071642f},
-std::array<float,2>{0.788324177f, 0.279829353f},
-std::array<float,2>{0.365055531f, 0.414033711f},
-std::array<float,2>{0.969213307f, 0.573236048f},
-std::array<float,2>{0.142253682f, 0.979939997f},
-std::array<float,2>{0.612447798f, 0.00500786491f},
-std::array<float,2>{0.432177037f, 0.120486334f},
-std::array<float,2>{0.855140209f, 0.899296165f},
-std::array<float,2>{0.123788588f, 0.544020951f},
-std::array<float,2>{0.652964115f, 0.478562206f},
-std::array<float,2>{0.243468657f, 0.312811643f},
-std::array<float,2>{0.549981117f, 0.748754382f},
-std::array<float,2>{0.262074351f, 0.825528741f},
-std::array<float,2>{0.917461336f, 0.196431071f},
-std::array<float,2>{0.0560420267f, 0.00868173037f},
-std::array<float,2>{0.73170352f, 0.974297523f},
-std::array<float,2>{0.46706745f, 0.567963004f},
-std::array<float,2>{0.763114691f, 0.414230764f},
-std::array<float,2>{0.317764014f, 0.272826314f},
-std::array<float,2>{0.959873557f, 0.644147336f},
-std::array<float,2>{0.18329069f, 0.75915283f},
-std::array<float,2>{0.586599827f, 0.178709343f},
-std::array<float,2>{0.375228018f, 0.193612754f},
-std::array<float,2>{0.813831925f, 0.813679755f},
-std::array<float,2>{0.0841001645f, 0.739153028f},
-std::array<float,2>{0.672015607f, 0.324876308f},
-std::array<float,2>{0.197783098f, 0.471379846f},
-std::array<float,2>{0.527081668f, 0.533627868f},
-std::array<float,2>{0.282071799f, 0.895678937f},
-std::array<float,2>{0.893214226f, 0.117020473f},
-std::array<float,2>{0.148994491f, 0.136580095f},
-std::array<float,2>{0.620122671f, 0.799041152f},
-std::array<float,2>{0.374273151f, 0.664374888f},
-std::array<float,2>{0.977072835f, 0.29003033f},
-std::array<float,2>{0.485077471f, 0.3901999f},
-std::array<float,2>{0.795364022f, 0.62419039f},
-std::array<float,2>{0.00392801827f, 0.958928823f},
-std::array<float,2>{0.709921002f, 0.0516436547f},
-std::array<float,2>{0.250169933f, 0.0635704175f},
-std::array<float,2>{0.907847524f, 0.929777801f},
-std::array<float,2>{0.237491995f, 0.50167805f},
-std::array<float,2>{0.560528219f, 0.447066784f},
-std::array<float,2>{0.112033829f, 0.345478415f},
-std::array<float,2>{0.643380165f, 0.717199981f},
-std::array<float,2>{0.423918724f, 0.846948028f},
-std::array<float,2>{0.847495854f, 0.245489717f},
-std::array<float,2>{0.230781734f, 0.103386261f},
-std::array<float,2>{0.533079147f, 0.879159987f},
-std::array<float,2>{0.267259449f, 0.54953891f},
-std::array<float,2>{0.926998317f, 0.492548525f},
-std::array<float,2>{0.413351506f, 0.342197478f},
-std::array<float,2>{0.873951793f, 0.721212745f},
-std::array<float,2>{0.0948352739f, 0.832694232f},
-std::array<float,2>{0.639336407f, 0.215077326f},
-std::array<float,2>{0.355730951f, 0.161798567f},
-std::array<float,2>{0.994735539f, 0.773402333f},
-std::array<float,2>{0.131275967f, 0.630292118f},
-std::array<float,2>{0.604925811f, 0.258764893f},
-std::array<float,2>{0.0169888306f, 0.434633642f},
-std::array<float,2>{0.698315442f, 0.592920184f},
-std::array<float,2>{0.469453573f, 0.986486256f},
-std::array<float,2>{0.800983131f, 0.028897902f},
-std::array<float,2>{0.0691932961f, 0.223343775f},
-std::array<float,2>{0.669056535f, 0.871772051f},
-std::array<float,2>{0.401214212f, 0.698861361f},
-std::array<float,2>{0.83957082f, 0.365873545f},
-std::array<float,2>{0.308168888f, 0.455763757f},
-std::array<float,2>{0.879351974f, 0.517083287f},
-std::array<float,2>{0.207875356f, 0.918192387f},
-std::array<float,2>{0.515238404f, 0.0899500027f},
-std::array<float,2>{0.440304846f, 0.0363088921f},
-std::array<float,2>{0.768074274f, 0.944240212f},
-std::array<float,2>{0.0350431167f, 0.603276789f},
-std::array<float,2>{0.735974252f, 0.403244048f},
-std::array<float,2>{0.171192423f, 0.311397493f},
-std::array<float,2>{0.564587295f, 0.678749144f},
-std::array<float,2>{0.341379791f, 0.79479003f},
-std::array<float,2>{0.937907934f, 0.150509238f},
-std::array<float,2>{0.0787481591f, 0.0457081273f},
-std::array<float,2>{0.679637372f, 0.945629001f},
-std::array<float,2>{0.379003435f, 0.597424507f},
-std::array<float,2>{0.817038178f, 0.393652141f},
-std::array<float,2>{0.286424637f, 0.303748697f},
-std::array<float,2>{0.896246254f, 0.682044268f},
-std::array<float,2>{0.202319562f, 0.78426671f},
-std::array<float,2>{0.528246582f, 0.144875154f},
-std::array<float,2>{0.463101894f, 0.230151653f},
-std::array<float,2>{0.760931015f, 0.86246568f},
-std::array<float,2>{0.0609262288f, 0.691174805f},
-std::array<float,2>{0.726854265f, 0.3703399f},
-std::array<float,2>{0.184320256f, 0.468470544f},
-std::array<float,2>{0.593740284f, 0.529407084f},
-std::array<float,2>{0.316325486f, 0.911927283f},
-std::array<float,2>{0.953677058f, 0.0787324533f},
-std::array<float,2>{0.238963574f, 0.169319078f},
-std::array<float,2>{0.557847559f, 0.77846235f},
-std::array<float,2>{0.25535208f, 0.635941863f},
-std::array<float,2>{0.912202597f, 0.256011903f},
-std::array<float,2>{0.42900607f, 0.428091675f},
-std::array<float,2>{0.850179255f, 0.58377254f},
-std::array<float,2>{0.116830811f, 0.997113228f},
-std::array<float,2>{0.647916615f, 0.0182004478f},
-std::array<float,2>{0.368845999f, 0.0998145863f},
-std::array<float,2>{0.980588555f, 0.88985157f},
-std::array<float,2>{0.154197693f, 0.561309993f},
-std::array<float,2>{0.621114373f, 0.489471853f},
-std::array<float,2>{0.00233867741f, 0.330734909f},
-std::array<float,2>{0.706903696f, 0.727396965f},
-std::array<float,2>{0.491004735f, 0.842702091f},
-std::array<float,2>{0.790479064f, 0.209322244f},
-std::array<float,2>{0.125781924f, 0.0753867999f},
-std::array<float,2>{0.607160032f, 0.925721169f},
-std::array<float,2>{0.35358119f, 0.51216799f},
-std::array<float,2>{0.999046445f, 0.441843778f},
-std::array<float,2>{0.47445333f, 0.356383681f},
-std::array<float,2>{0.80050087f, 0.71030879f},
-std::array<float,2>{0.020429831f, 0.856216669f},
-std::array<float,2>{0.702152789f, 0.237238303f},
-std::array<float,2>{0.271011978f, 0.129219711f},
-std::array<float,2>{0.923665881f, 0.809291661f},
-std::array<float,2>{0.228983313f, 0.65974915f},
-std::array<float,2>{0.535329461f, 0.281886756f},
-std::array<float,2>{0.100520991f, 0.37969166f},
-std::array<float,2>{0.635249972f, 0.611870944f},
-std::array<float,2>{0.407196581f, 0.962159574f},
-std::array<float,2>{0.870830536f, 0.0611196868f},
-std::array<float,2>{0.0367498249f, 0.201056451f},
-std::array<float,2>{0.740925193f, 0.821101308f},
-std::array<float,2>{0.441442341f, 0.742887676f},
-std::array<float,2>{0.771064341f, 0.318062752f},
-std::array<float,2>{0.337534964f, 0.481333524f},
-std::array<float,2>{0.94290489f, 0.54048419f},
-std::array<float,2>{0.166142464f, 0.903393745f},
-std::array<float,2>{0.569154978f, 0.123074658f},
-std::array<float,2>{0.405867368f, 0.00123619556f},
-std::array<float,2>{0.841702759f, 0.980645239f},
-std::array<float,2>{0.0626526326f, 0.576255858f},
-std::array<float,2>{0.667508662f, 0.406587273f},
-std::array<float,2>{0.203981861f, 0.273796767f},
-std::array<float,2>{0.509839416f, 0.649605155f},
-std::array<float,2>{0.31029436f, 0.754651368f},
-std::array<float,2>{0.878112495f, 0.184064731f},
-std::array<float,2>{0.0244795009f, 0.111497633f},
-std::array<float,2>{0.689375818f, 0.893763304f},
-std::array<float,2>{0.479007155f, 0.537490487f},
-std::array<float,2>{0.808200955f, 0.476144135f},
-std::array<float,2>{0.350662947f, 0.323434144f},
-std::array<float,2>{0.99174124f, 0.736849308f},
-std::array<float,2>{0.138753206f, 0.817964017f},
-std::array<float,2>{0.594031453f, 0.188758254f},
-std::array<float,2>{0.414875984f, 0.174590081f},
-std::array<float,2>{0.862537265f, 0.764081299f},
-std::array<float,2>{0.101762541f, 0.645588279f},
-std::array<float,2>{0.62786442f, 0.265860319f},
-std::array<float,2>{0.226504266f, 0.420675308f},
-std::array<float,2>{0.539242864f, 0.563092887f},
-std::array<float,2>{0.275917381f, 0.969355822f},
-std::array<float,2>{0.937384963f, 0.0127262147f},
-std::array<float,2>{0.163517192f, 0.247507572f},
-std::array<float,2>{0.571760893f, 0.848506331f},
-std::array<float,2>{0.329518795f, 0.714469314f},
-std::array<float,2>{0.948864877f, 0.348486483f},
-std::array<float,2>{0.452215105f, 0.452417135f},
-std::array<float,2>{0.777668417f, 0.507712364f},
-std::array<float,2>{0.0393619053f, 0.93403852f},
-std::array<float,2>{0.747111738f, 0.0695326477f},
-std::array<float,2>{0.299676746f, 0.0472421087f},
-std::array<float,2>{0.890396476f, 0.953716755f},
-std::array<float,2>{0.212210536f, 0.620635808f},
-std::array<float,2>{0.505366683f, 0.384629786f},
-std::array<float,2>{0.0727779865f, 0.293458819f},
-std::array<float,2>{0.657672644f, 0.670636415f},
-std::array<float,2>{0.391677946f, 0.801984906f},
-std::array<float,2>{0.834211707f, 0.138188243f},
-std::array<float,2>{0.188914031f, 0.0261023324f},
-std::array<float,2>{0.519326866f, 0.991910636f},
-std::array<float,2>{0.293057293f, 0.588297844f},
-std::array<float,2>{0.903974414f, 0.431873441f},
-std::array<float,2>{0.389510959f, 0.265190512f},
-std::array<float,2>{0.826254189f, 0.625341833f},
-std::array<float,2>{0.0936103463f, 0.766009033f},
-std::array<float,2>{0.683005393f, 0.157331333f},
-std::array<float,2>{0.322173387f, 0.212983727f},
-std::array<float,2>{0.961386859f, 0.830595315f},
-std::array<float,2>{0.17518425f, 0.72647059f},
-std::array<float,2>{0.579589903f, 0.336347759f},
-std::array<float,2>{0.0484876707f, 0.499057055f},
-std::array<float,2>{0.721053183f, 0.552404821f},
-std::array<float,2>{0.459784448f, 0.878513873f},
-std::array<float,2>{0.753771007f, 0.106096141f},
-std::array<float,2>{0.117840514f, 0.154125169f},
-std::array<float,2>{0.649904847f, 0.792026997f},
-std::array<float,2>{0.434263915f, 0.675702155f},
-std::array<float,2>{0.858567417f, 0.307347775f},
-std::array<float,2>{0.258149892f, 0.398797721f},
-std::array<float,2>{0.91892153f, 0.606788158f},
-std::array<float,2>{0.24879849f, 0.938869596f},
-std::array<float,2>{0.55363059f, 0.0344004855f},
-std::array<float,2>{0.495567322f, 0.0889924541f},
-std::array<float,2>{0.782757699f, 0.914842248f},
-std::array<float,2>{0.00855703093f, 0.522577107f},
-std::array<float,2>{0.712979257f, 0.45850724f},
-std::array<float,2>{0.14517948f, 0.361233264f},
-std::array<float,2>{0.616208375f, 0.699517131f},
-std::array<float,2>{0.360295594f, 0.870039105f},
-std::array<float,2>{0.973115265f, 0.220176324f},
-std::array<float,2>{0.0752091259f, 0.0947454125f},
-std::array<float,2>{0.661747396f, 0.88344568f},
-std::array<float,2>{0.39576906f, 0.55686444f},
-std::array<float,2>{0.82918793f, 0.486007243f},
-std::array<float,2>{0.301365435f, 0.33307758f},
-std::array<float,2>{0.883352876f, 0.73111558f},
-std::array<float,2>{0.214864224f, 0.838638842f},
-std::array<float,2>{0.501431763f, 0.206995681f},
-std::array<float,2>{0.447283238f, 0.167634845f},
-std::array<float,2>{0.773903728f, 0.774970174f},
-std::array<float,2>{0.0442644991f, 0.637063265f},
-std::array<float,2>{0.744018793f, 0.250966817f},
-std::array<float,2>{0.156424746f, 0.425584286f},
-std::array<float,2>{0.576408029f, 0.578771889f},
-std::array<float,2>{0.333143711f, 0.9928267f},
-std::array<float,2>{0.952391803f, 0.0223229378f},
-std::array<float,2>{0.220195457f, 0.231069639f},
-std::array<float,2>{0.543868959f, 0.86543417f},
-std::array<float,2>{0.280988872f, 0.691595674f},
-std::array<float,2>{0.932504535f, 0.37488541f},
-std::array<float,2>{0.420498312f, 0.462471753f},
-std::array<float,2>{0.866244256f, 0.526719928f},
-std::array<float,2>{0.108863555f, 0.909547508f},
-std::array<float,2>{0.6303249f, 0.0849655867f},
-std::array<float,2>{0.347168386f, 0.0421646871f},
-std::array<float,2>{0.984516442f, 0.950469613f},
-std::array<float,2>{0.135888398f, 0.598411143f},
-std::array<float,2>{0.598653674f, 0.397703946f},
-std::array<float,2>{0.0284995195f, 0.300410241f},
-std::array<float,2>{0.694357276f, 0.687317431f},
-std::array<float,2>{0.480649531f, 0.786216617f},
-std::array<float,2>{0.809642076f, 0.143018469f},
-std::array<float,2>{0.143487126f, 0.00745875947f},
-std::array<float,2>{0.609881222f, 0.97835499f},
-std::array<float,2>{0.367150187f, 0.571786225f},
-std::array<float,2>{0.970957994f, 0.41107145f},
-std::array<float,2>{0.497674167f, 0.278462052f},
-std::array<float,2>{0.786419749f, 0.655987442f},
-std::array<float,2>{0.0147482473f, 0.752330184f},
-std::array<float,2>{0.716462195f, 0.181608036f},
-std::array<float,2>{0.265213758f, 0.199056491f},
-std::array<float,2>{0.915894866f, 0.827409208f},
-std::array<float,2>{0.245916903f, 0.747477174f},
-std::array<float,2>{0.548619092f, 0.31525895f},
-std::array<float,2>{0.121222444f, 0.478261501f},
-std::array<float,2>{0.655297637f, 0.546168923f},
-std::array<float,2>{0.431585312f, 0.901328027f},
-std::array<float,2>{0.852941811f, 0.119057387f},
-std::array<float,2>{0.0541406684f, 0.127595082f},
-std::array<float,2>{0.726460993f, 0.805144191f},
-std::array<float,2>{0.45439297f, 0.661442935f},
-std::array<float,2>{0.756102145f, 0.286566287f},
-std::array<float,2>{0.327605426f, 0.378346175f},
-std::array<float,2>{0.966187954f, 0.613717377f},
-std::array<float,2>{0.176969156f, 0.967852592f},
-std::array<float,2>{0.583962381f, 0.0574106686f},
-std::array<float,2>{0.383530408f, 0.0734659582f},
-std::array<float,2>{0.822979748f, 0.928348422f},
-std::array<float,2>{0.0895977393f, 0.508051991f},
-std::array<float,2>{0.68632412f, 0.44090277f},
-std::array<float,2>{0.193927735f, 0.353340894f},
-std::array<float,2>{0.522480309f, 0.704290509f},
-std::array<float,2>{0.290317416f, 0.852358103f},
-std::array<float,2>{0.901497066f, 0.23991558f},
-std::array<float,2>{0.00605885312f, 0.0532355309f},
-std::array<float,2>{0.708948195f, 0.959439933f},
-std::array<float,2>{0.486439347f, 0.622428f},
-std::array<float,2>{0.794015348f, 0.38808912f},
-std::array<float,2>{0.372171342f, 0.292082459f},
-std::array<float,2>{0.979468226f, 0.667011857f},
-std::array<float,2>{0.151444569f, 0.798049569f},
-std::array<float,2>{0.618437171f, 0.133461252f},
-std::array<float,2>{0.423774242f, 0.243706957f},
-std::array<float,2>{0.844385684f, 0.844010949f},
-std::array<float,2>{0.110495917f, 0.715502024f},
-std::array<float,2>{0.641336918f, 0.345987767f},
-std::array<float,2>{0.235342741f, 0.448313832f},
-std::array<float,2>{0.56131351f, 0.502291679f},
-std::array<float,2>{0.252101421f, 0.931696057f},
-std::array<float,2>{0.90867126f, 0.0652212128f},
-std::array<float,2>{0.17981261f, 0.177027747f},
-std::array<float,2>{0.58912605f, 0.761442721f},
-std::array<float,2>{0.318420917f, 0.642410457f},
-std::array<float,2>{0.958385885f, 0.270775497f},
-std::array<float,2>{0.465667456f, 0.417757511f},
-std::array<float,2>{0.764451861f, 0.568757415f},
-std::array<float,2>{0.0567651726f, 0.9752689f},
-std::array<float,2>{0.733900428f, 0.0105154673f},
-std::array<float,2>{0.284166008f, 0.113727175f},
-std::array<float,2>{0.892568409f, 0.898381591f},
-std::array<float,2>{0.195519641f, 0.531465888f},
-std::array<float,2>{0.524214685f, 0.469209939f},
-std::array<float,2>{0.082073696f, 0.328057617f},
-std::array<float,2>{0.675149798f, 0.742033422f},
-std::array<float,2>{0.378174275f, 0.815213919f},
-std::array<float,2>{0.81618917f, 0.192803383f},
-std::array<float,2>{0.210224882f, 0.0920811594f},
-std::array<float,2>{0.513167679f, 0.919948459f},
-std::array<float,2>{0.306107759f, 0.519171596f},
-std::array<float,2>{0.882687509f, 0.453718632f},
-std::array<float,2>{0.398600131f, 0.363829345f},
-std::array<float,2>{0.836561441f, 0.696214139f},
-std::array<float,2>{0.0670226365f, 0.874552369f},
-std::array<float,2>{0.670331001f, 0.226331607f},
-std::array<float,2>{0.342715204f, 0.14879708f},
-std::array<float,2>{0.940211892f, 0.795975506f},
-std::array<float,2>{0.16885893f, 0.675809681f},
-std::array<float,2>{0.562821686f, 0.30900982f},
-std::array<float,2>{0.0312506631f, 0.405264497f},
-std::array<float,2>{0.73647809f, 0.603768528f},
-std::array<float,2>{0.437999547f, 0.942772448f},
-std::array<float,2>{0.766298711f, 0.0371975377f},
-std::array<float,2>{0.0972927287f, 0.217987224f},
-std::array<float,2>{0.637811422f, 0.83544302f},
-std::array<float,2>{0.411489993f, 0.719415009f},
-std::array<float,2>{0.871665776f, 0.339962155f},
-std::array<float,2>{0.268640965f, 0.495334417f},
-std::array<float,2>{0.927969575f, 0.547754049f},
-std::array<float,2>{0.2334342f, 0.881505966f},
-std::array<float,2>{0.53496325f, 0.104845181f},
-std::array<float,2>{0.472167224f, 0.030105602f},
-std::array<float,2>{0.802978396f, 0.986235321f},
-std::array<float,2>{0.0178019032f, 0.59030515f},
-std::array<float,2>{0.696054101f, 0.437126637f},
-std::array<float,2>{0.129290327f, 0.259806007f},
-std::array<float,2>{0.601848125f, 0.63131237f},
-std::array<float,2>{0.359083921f, 0.771073103f},
-std::array<float,2>{0.99321425f, 0.16368106f},
-std::array<float,2>{0.11343807f, 0.0169835575f},
-std::array<float,2>{0.645024836f, 0.998533726f},
-std::array<float,2>{0.426347882f, 0.584773064f},
-std::array<float,2>{0.848487914f, 0.426113784f},
-std::array<float,2>{0.256924629f, 0.255108237f},
-std::array<float,2>{0.911766946f, 0.633582771f},
-std::array<float,2>{0.241631448f, 0.77976191f},
-std::array<float,2>{0.556225061f, 0.170885682f},
-std::array<float,2>{0.48828882f, 0.207762063f},
-std::array<float,2>{0.792227447f, 0.841784716f},
-std::array<float,2>{0.00100998196f, 0.730284512f},
-std::array<float,2>{0.704611182f, 0.32821843f},
-std::array<float,2>{0.156082854f, 0.490666419f},
-std::array<float,2>{0.624178588f, 0.560526311f},
-std::array<float,2>{0.370989561f, 0.887650013f},
-std::array<float,2>{0.982574224f, 0.0985411778f},
-std::array<float,2>{0.200824335f, 0.147696078f},
-std::array<float,2>{0.529789388f, 0.782969713f},
-std::array<float,2>{0.287184298f, 0.680614829f},
-std::array<float,2>{0.898352921f, 0.302717239f},
-std::array<float,2>{0.381840587f, 0.390919536f},
-std::array<float,2>{0.820042968f, 0.595505834f},
-std::array<float,2>{0.081174314f, 0.947975099f},
-std::array<float,2>{0.677654326f, 0.0445146933f},
-std::array<float,2>{0.314163536f, 0.0819569901f},
-std::array<float,2>{0.95645231f, 0.912539363f},
-std::array<float,2>{0.186294332f, 0.527873516f},
-std::array<float,2>{0.589861453f, 0.4653157f},
-std::array<float,2>{0.0599213429f, 0.368514478f},
-std::array<float,2>{0.729549766f, 0.688285172f},
-std::array<float,2>{0.461103916f, 0.860527813f},
-std::array<float,2>{0.758553803f, 0.227732316f},
-std::array<float,2>{0.165335193f, 0.121532053f},
-std::array<float,2>{0.566521168f, 0.904397428f},
-std::array<float,2>{0.337933123f, 0.54241389f},
-std::array<float,2>{0.943410516f, 0.483983696f},
-std::array<float,2>{0.44378233f, 0.320204675f},
-std::array<float,2>{0.772770464f, 0.745203435f},
-std::array<float,2>{0.0371381566f, 0.822452366f},
-std::array<float,2>{0.739410758f, 0.202913016f},
-std::array<float,2>{0.311692238f, 0.185667872f},
-std::array<float,2>{0.876416683f, 0.757787406f},
-std::array<float,2>{0.20519197f, 0.651969075f},
-std::array<float,2>{0.508195341f, 0.276970029f},
-std::array<float,2>{0.0659275949f, 0.409996599f},
-std::array<float,2>{0.664702952f, 0.575590014f},
-std::array<float,2>{0.403715312f, 0.983094752f},
-std::array<float,2>{0.843162f, 0.00348437857f},
-std::array<float,2>{0.022507254f, 0.235416085f},
-std::array<float,2>{0.700864971f, 0.858860612f},
-std::array<float,2>{0.475493133f, 0.707562864f},
-std::array<float,2>{0.798493505f, 0.358659059f},
-std::array<float,2>{0.353278875f, 0.444658935f},
-std::array<float,2>{0.996428967f, 0.51398325f},
-std::array<float,2>{0.128665388f, 0.92225796f},
-std::array<float,2>{0.609077215f, 0.0766566992f},
-std::array<float,2>{0.409787744f, 0.0595565364f},
-std::array<float,2>{0.867358625f, 0.963665962f},
-std::array<float,2>{0.098947525f, 0.61105746f},
-std::array<float,2>{0.633489013f, 0.38271454f},
-std::array<float,2>{0.226982504f, 0.284542978f},
-std::array<float,2>{0.53896749f, 0.656476736f},
-std::array<float,2>{0.273091108f, 0.812433779f},
-std::array<float,2>{0.925072312f, 0.13097845f},
-std::array<float,2>{0.0419187136f, 0.0677670911f},
-std::array<float,2>{0.749673367f, 0.937356353f},
-std::array<float,2>{0.450337768f, 0.505660117f},
-std::array<float,2>{0.780512393f, 0.450812817f},
-std::array<float,2>{0.330242455f, 0.351111442f},
-std::array<float,2>{0.946844697f, 0.711720705f},
-std::array<float,2>{0.16084145f, 0.849787891f},
-std::array<float,2>{0.572287798f, 0.249923334f},
-std::array<float,2>{0.393358409f, 0.140067488f},
-std::array<float,2>{0.832438529f, 0.803794324f},
-std::array<float,2>{0.0710074604f, 0.668050587f},
-std::array<float,2>{0.658470929f, 0.295484424f},
-std::array<float,2>{0.214718789f, 0.385009348f},
-std::array<float,2>{0.505957007f, 0.617552996f},
-std::array<float,2>{0.297662407f, 0.955646753f},
-std::array<float,2>{0.887828231f, 0.0494024791f},
-std::array<float,2>{0.137097105f, 0.189915389f},
-std::array<float,2>{0.596152604f, 0.819593906f},
-std::array<float,2>{0.347667068f, 0.734447956f},
-std::array<float,2>{0.989207625f, 0.321821988f},
-std::array<float,2>{0.477049261f, 0.473453432f},
-std::array<float,2>{0.805355787f, 0.535333216f},
-std::array<float,2>{0.0272684265f, 0.890882373f},
-std::array<float,2>{0.690698981f, 0.110152051f},
-std::array<float,2>{0.273618311f, 0.0138931163f},
-std::array<float,2>{0.935180902f, 0.970873773f},
-std::array<float,2>{0.223982662f, 0.565324545f},
-std::array<float,2>{0.541393161f, 0.419633031f},
-std::array<float,2>{0.103942044f, 0.267983854f},
-std::array<float,2>{0.625222206f, 0.646884561f},
-std::array<float,2>{0.416988701f, 0.763124585f},
-std::array<float,2>{0.859575391f, 0.173613936f},
-std::array<float,2>{0.247875839f, 0.0323256627f},
-std::array<float,2>{0.551179826f, 0.940395892f},
-std::array<float,2>{0.261184841f, 0.609098673f},
-std::array<float,2>{0.92023778f, 0.401476055f},
-std::array<float,2>{0.435581565f, 0.305631876f},
-std::array<float,2>{0.855911195f, 0.672855437f},
-std::array<float,2>{0.120520145f, 0.790527701f},
-std::array<float,2>{0.651305318f, 0.155069947f},
-std::array<float,2>{0.362864852f, 0.221592814f},
-std::array<float,2>{0.975464582f, 0.867384732f},
-std::array<float,2>{0.147516146f, 0.701515555f},
-std::array<float,2>{0.614691317f, 0.362766683f},
-std::array<float,2>{0.0103124566f, 0.460051f},
-std::array<float,2>{0.711170971f, 0.520912886f},
-std::array<float,2>{0.492438167f, 0.916496158f},
-std::array<float,2>{0.784156322f, 0.0864547491f},
-std::array<float,2>{0.0915060639f, 0.159000888f},
-std::array<float,2>{0.681602299f, 0.767596781f},
-std::array<float,2>{0.388081819f, 0.627613306f},
-std::array<float,2>{0.825825393f, 0.26186502f},
-std::array<float,2>{0.295326501f, 0.431338459f},
-std::array<float,2>{0.905200005f, 0.586013198f},
-std::array<float,2>{0.18955189f, 0.988586307f},
-std::array<float,2>{0.516908944f, 0.0238881279f},
-std::array<float,2>{0.457457393f, 0.107783087f},
-std::array<float,2>{0.750559211f, 0.875378013f},
-std::array<float,2>{0.0500834212f, 0.553395689f},
-std::array<float,2>{0.718920887f, 0.496755451f},
-std::array<float,2>{0.172016114f, 0.338796914f},
-std::array<float,2>{0.580971181f, 0.723013282f},
-std::array<float,2>{0.322570592f, 0.829829931f},
-std::array<float,2>{0.964343131f, 0.211489365f},
-std::array<float,2>{0.095429711f, 0.105294704f},
-std::array<float,2>{0.638805509f, 0.881153464f},
-std::array<float,2>{0.413776457f, 0.547286987f},
-std::array<float,2>{0.873363316f, 0.495855778f},
-std::array<float,2>{0.266976923f, 0.340602309f},
-std::array<float,2>{0.927583277f, 0.718952358f},
-std::array<float,2>{0.231226683f, 0.835691154f},
-std::array<float,2>{0.532582819f, 0.218502074f},
-std::array<float,2>{0.468761593f, 0.163330257f},
-std::array<float,2>{0.80150497f, 0.770696819f},
-std::array<float,2>{0.0172462352f, 0.63170594f},
-std::array<float,2>{0.699190795f, 0.260386199f},
-std::array<float,2>{0.131624267f, 0.436534941f},
-std::array<float,2>{0.605200946f, 0.590421855f},
-std::array<float,2>{0.356119543f, 0.985560298f},
-std::array<float,2>{0.994586468f, 0.0294780843f},
-std::array<float,2>{0.207136706f, 0.226066515f},
-std::array<float,2>{0.515058577f, 0.874417543f},
-std::array<float,2>{0.308080226f, 0.695628285f},
-std::array<float,2>{0.879561484f, 0.36353597f},
-std::array<float,2>{0.400798768f, 0.453140169f},
-std::array<float,2>{0.839191973f, 0.518805385f},
-std::array<float,2>{0.0685183406f, 0.920700669f},
-std::array<float,2>{0.669915318f, 0.0924185589f},
-std::array<float,2>{0.341275871f, 0.0379115641f},
-std::array<float,2>{0.93807584f, 0.943222821f},
-std::array<float,2>{0.171757177f, 0.60412097f},
-std::array<float,2>{0.565377057f, 0.404380411f},
-std::array<float,2>{0.0342629626f, 0.309259027f},
-std::array<float,2>{0.735821366f, 0.676464796f},
-std::array<float,2>{0.439475626f, 0.796439111f},
-std::array<float,2>{0.767665744f, 0.149269462f},
-std::array<float,2>{0.182984069f, 0.0102357138f},
-std::array<float,2>{0.586012423f, 0.974877119f},
-std::array<float,2>{0.318204105f, 0.569031835f},
-std::array<float,2>{0.959198534f, 0.417031109f},
-std::array<float,2>{0.467640787f, 0.271278143f},
-std::array<float,2>{0.763437033f, 0.641803443f},
-std::array<float,2>{0.0563180558f, 0.760861516f},
-std::array<float,2>{0.73200804f, 0.177617729f},
-std::array<float,2>{0.281418562f, 0.192954808f},
-std::array<float,2>{0.892906666f, 0.81463927f},
-std::array<float,2>{0.197384432f, 0.741385102f},
-std::array<float,2>{0.5267995f, 0.327195674f},
-std::array<float,2>{0.0848505795f, 0.46926862f},
-std::array<float,2>{0.672710717f, 0.531820834f},
-std::array<float,2>{0.375723362f, 0.897906542f},
-std::array<float,2>{0.814044476f, 0.114104077f},
-std::array<float,2>{0.00469478406f, 0.132927373f},
-std::array<float,2>{0.709338665f, 0.79867661f},
-std::array<float,2>{0.48460263f, 0.667851031f},
-std::array<float,2>{0.79548192f, 0.292714298f},
-std::array<float,2>{0.374806076f, 0.388331562f},
-std::array<float,2>{0.976806343f, 0.622909904f},
-std::array<float,2>{0.148912609f, 0.959572732f},
-std::array<float,2>{0.620713353f, 0.053198427f},
-std::array<float,2>{0.424417049f, 0.0648108423f},
-std::array<float,2>{0.847161114f, 0.932342887f},
-std::array<float,2>{0.111624286f, 0.502650142f},
-std::array<float,2>{0.643059731f, 0.448881745f},
-std::array<float,2>{0.238265499f, 0.346513331f},
-std::array<float,2>{0.559990346f, 0.715185404f},
-std::array<float,2>{0.250736892f, 0.844317138f},
-std::array<float,2>{0.907276332f, 0.243544415f},
-std::array<float,2>{0.0520393178f, 0.0570322126f},
-std::array<float,2>{0.723401308f, 0.968470693f},
-std::array<float,2>{0.45526135f, 0.614046454f},
-std::array<float,2>{0.754532933f, 0.378758103f},
-std::array<float,2>{0.326160759f, 0.286661893f},
-std::array<float,2>{0.96813786f, 0.661657572f},
-std::array<float,2>{0.179260671f, 0.805594385f},
-std::array<float,2>{0.585539103f, 0.126980588f},
-std::array<float,2>{0.386459023f, 0.239550829f},
-std::array<float,2>{0.820622623f, 0.851646841f},
-std::array<float,2>{0.0872375369f, 0.704957604f},
-std::array<float,2>{0.683681965f, 0.352724791f},
-std::array<float,2>{0.192231938f, 0.441378027f},
-std::array<float,2>{0.519752085f, 0.508594751f},
-std::array<float,2>{0.29255563f, 0.928015709f},
-std::array<float,2>{0.899643481f, 0.0740979835f},
-std::array<float,2>{0.142038971f, 0.180800393f},
-std::array<float,2>{0.613039255f, 0.752846837f},
-std::array<float,2>{0.364468366f, 0.655287147f},
-std::array<float,2>{0.969541073f, 0.279228091f},
-std::array<float,2>{0.49861151f, 0.410359979f},
-std::array<float,2>{0.788616717f, 0.571541429f},
-std::array<float,2>{0.0130384583f, 0.978013217f},
-std::array<float,2>{0.717912912f, 0.00730202487f},
-std::array<float,2>{0.262369603f, 0.118446641f},
-std::array<float,2>{0.917945743f, 0.900831044f},
-std::array<float,2>{0.24396041f, 0.54647094f},
-std::array<float,2>{0.550536156f, 0.477702051f},
-std::array<float,2>{0.123349108f, 0.314638048f},
-std::array<float,2>{0.652719319f, 0.747623205f},
-std::array<float,2>{0.431959987f, 0.82783407f},
-std::array<float,2>{0.854625225f, 0.198446557f},
-std::array<float,2>{0.222557381f, 0.0858797431f},
-std::array<float,2>{0.545458615f, 0.90970248f},
-std::array<float,2>{0.277362138f, 0.526953697f},
-std::array<float,2>{0.929716885f, 0.462230086f},
-std::array<float,2>{0.418995768f, 0.374378681f},
-std::array<float,2>{0.86512506f, 0.692168117f},
-std::array<float,2>{0.107208602f, 0.865743697f},
-std::array<float,2>{0.631452918f, 0.230613559f},
-std::array<float,2>{0.345326722f, 0.143531367f},
-std::array<float,2>{0.987434864f, 0.786934972f},
-std::array<float,2>{0.133429512f, 0.686653793f},
-std::array<float,2>{0.600900412f, 0.300167978f},
-std::array<float,2>{0.0303734392f, 0.39835611f},
-std::array<float,2>{0.693300664f, 0.597885251f},
-std::array<float,2>{0.482850134f, 0.950762928f},
-std::array<float,2>{0.810624421f, 0.0425813682f},
-std::array<float,2>{0.0775750652f, 0.206154644f},
-std::array<float,2>{0.662473381f, 0.838058531f},
-std::array<float,2>{0.398202002f, 0.730897605f},
-std::array<float,2>{0.830914974f, 0.333772749f},
-std::array<float,2>{0.304005921f, 0.485612571f},
-std::array<float,2>{0.885093093f, 0.557427704f},
-std::array<float,2>{0.21753709f, 0.8830778f},
-std::array<float,2>{0.502232373f, 0.0954791084f},
-std::array<float,2>{0.447073877f, 0.0216857437f},
-std::array<float,2>{0.776005447f, 0.99225378f},
-std::array<float,2>{0.0452167578f, 0.57819736f},
-std::array<float,2>{0.744954526f, 0.424994528f},
-std::array<float,2>{0.158760756f, 0.250242293f},
-std::array<float,2>{0.575672865f, 0.637208939f},
-std::array<float,2>{0.334394515f, 0.774436831f},
-std::array<float,2>{0.950848758f, 0.167439923f},
-std::array<float,2>{0.0930379853f, 0.0241391007f},
-std::array<float,2>{0.683374941f, 0.989076972f},
-std::array<float,2>{0.389109761f, 0.586894929f},
-std::array<float,2>{0.826753676f, 0.430963963f},
-std::array<float,2>{0.293767512f, 0.262596309f},
-std::array<float,2>{0.903479099f, 0.626982868f},
-std::array<float,2>{0.189108118f, 0.768350005f},
-std::array<float,2>{0.518589437f, 0.158217207f},
-std::array<float,2>{0.45928213f, 0.211249411f},
-std::array<float,2>{0.753158808f, 0.82936269f},
-std::array<float,2>{0.0480323881f, 0.723179221f},
-std::array<float,2>{0.721434057f, 0.337965012f},
-std::array<float,2>{0.175525293f, 0.496312141f},
-std::array<float,2>{0.57954067f, 0.552903533f},
-std::array<float,2>{0.321337461f, 0.875963271f},
-std::array<float,2>{0.961497486f, 0.108336098f},
-std::array<float,2>{0.248164415f, 0.154446691f},
-std::array<float,2>{0.553115845f, 0.790251374f},
-std::array<float,2>{0.258487821f, 0.673500597f},
-std::array<float,2>{0.918195307f, 0.304793626f},
-std::array<float,2>{0.433758944f, 0.401892036f},
-std::array<float,2>{0.859263301f, 0.608682394f},
-std::array<float,2>{0.11763645f, 0.939584672f},
-std::array<float,2>{0.649486542f, 0.0329100266f},
-std::array<float,2>{0.359808624f, 0.0863916501f},
-std::array<float,2>{0.973384738f, 0.916637957f},
-std::array<float,2>{0.144785941f, 0.5210464f},
-std::array<float,2>{0.615602672f, 0.460881561f},
-std::array<float,2>{0.00790003687f, 0.363074601f},
-std::array<float,2>{0.713446677f, 0.702092946f},
-std::array<float,2>{0.495781094f, 0.867876053f},
-std::array<float,2>{0.782252312f, 0.220836043f},
-std::array<float,2>{0.139232382f, 0.109761588f},
-std::array<float,2>{0.59467268f, 0.891237497f},
-std::array<float,2>{0.351468056f, 0.535982132f},
-std::array<float,2>{0.99168855f, 0.472688705f},
-std::array<float,2>{0.478610516f, 0.321663171f},
-std::array<float,2>{0.808040857f, 0.735350132f},
-std::array<float,2>{0.0252414513f, 0.820116758f},
-std::array<float,2>{0.68862921f, 0.189991102f},
-std::array<float,2>{0.275439143f, 0.173303425f},
-std::array<float,2>{0.936572134f, 0.763480365f},
-std::array<float,2>{0.225776166f, 0.647178292f},
-std::array<float,2>{0.539776742f, 0.268189043f},
-std::array<float,2>{0.102532007f, 0.41912359f},
-std::array<float,2>{0.627166927f, 0.564468205f},
-std::array<float,2>{0.41415903f, 0.971314669f},
-std::array<float,2>{0.863208115f, 0.0143813202f},
-std::array<float,2>{0.0398419872f, 0.249307275f},
-std::array<float,2>{0.747994721f, 0.85047555f},
-std::array<float,2>{0.453018963f, 0.711033642f},
-std::array<float,2>{0.778254867f, 0.350824505f},
-std::array<float,2>{0.329854041f, 0.450300246f},
-std::array<float,2>{0.948389053f, 0.505235434f},
-std::array<float,2>{0.163882837f, 0.936820865f},
-std::array<float,2>{0.572049916f, 0.0682663396f},
-std::array<float,2>{0.392428964f, 0.0491497442f},
-std::array<float,2>{0.834713101f, 0.955160677f},
-std::array<float,2>{0.0722856522f, 0.617830575f},
-std::array<float,2>{0.657797813f, 0.385678232f},
-std::array<float,2>{0.212425336f, 0.295395434f},
-std::array<float,2>{0.505639076f, 0.66857177f},
-std::array<float,2>{0.298849195f, 0.804497957f},
-std::array<float,2>{0.889683664f, 0.140515596f},
-std::array<float,2>{0.0197897963f, 0.0769683719f},
-std::array<float,2>{0.703046858f, 0.922447205f},
-std::array<float,2>{0.473934978f, 0.514184773f},
-std::array<float,2>{0.800063491f, 0.445215523f},
-std::array<float,2>{0.354064256f, 0.359132022f},
-std::array<float,2>{0.999965549f, 0.707339168f},
-std::array<float,2>{0.125375941f, 0.859048367f},
-std::array<float,2>{0.606874883f, 0.235958681f},
-std::array<float,2>{0.406494886f, 0.131444663f},
-std::array<float,2>{0.870446563f, 0.811648667f},
-std::array<float,2>{0.100075305f, 0.6567415f},
-std::array<float,2>{0.635635138f, 0.285045058f},
-std::array<float,2>{0.229187548f, 0.381875634f},
-std::array<float,2>{0.535970688f, 0.610764861f},
-std::array<float,2>{0.270846277f, 0.963349283f},
-std::array<float,2>{0.923187971f, 0.0589466095f},
-std::array<float,2>{0.16669175f, 0.202367842f},
-std::array<float,2>{0.568499267f, 0.823211133f},
-std::array<float,2>{0.336918592f, 0.745900691f},
-std::array<float,2>{0.942797482f, 0.319369197f},
-std::array<float,2>{0.442224443f, 0.483589321f},
-std::array<float,2>{0.770566702f, 0.542886496f},
-std::array<float,2>{0.0361537412f, 0.905053854f},
-std::array<float,2>{0.740677655f, 0.121594697f},
-std::array<float,2>{0.309686959f, 0.00311462767f},
-std::array<float,2>{0.878594816f, 0.982864261f},
-std::array<float,2>{0.203168333f, 0.575801849f},
-std::array<float,2>{0.510389745f, 0.40949285f},
-std::array<float,2>{0.0633085668f, 0.276836157f},
-std::array<float,2>{0.667279661f, 0.651454031f},
-std::array<float,2>{0.405598313f, 0.757192433f},
-std::array<float,2>{0.840944529f, 0.186427623f},
-std::array<float,2>{0.202911586f, 0.0440725312f},
-std::array<float,2>{0.527450562f, 0.947443604f},
-std::array<float,2>{0.286640316f, 0.594816387f},
-std::array<float,2>{0.895926714f, 0.391126752f},
-std::array<float,2>{0.379769623f, 0.301805466f},
-std::array<float,2>{0.816531539f, 0.6799649f},
-std::array<float,2>{0.0784649551f, 0.782548666f},
-std::array<float,2>{0.678790271f, 0.148220241f},
-std::array<float,2>{0.31544435f, 0.22842145f},
-std::array<float,2>{0.95347023f, 0.861150384f},
-std::array<float,2>{0.183638588f, 0.687800646f},
-std::array<float,2>{0.59283036f, 0.368936479f},
-std::array<float,2>{0.0615025759f, 0.465521097f},
-std::array<float,2>{0.727097452f, 0.527526319f},
-std::array<float,2>{0.463670522f, 0.913077116f},
-std::array<float,2>{0.761327922f, 0.0810586065f},
-std::array<float,2>{0.116659909f, 0.170127913f},
-std::array<float,2>{0.648183465f, 0.779991269f},
-std::array<float,2>{0.429289907f, 0.632889271f},
-std::array<float,2>{0.849802554f, 0.255584478f},
-std::array<float,2>{0.255833417f, 0.426471472f},
-std::array<float,2>{0.91289103f, 0.584183037f},
-std::array<float,2>{0.238563791f, 0.998977244f},
-std::array<float,2>{0.558420777f, 0.0173301753f},
-std::array<float,2>{0.490313649f, 0.0976867154f},
-std::array<float,2>{0.790543377f, 0.887096584f},
-std::array<float,2>{0.00270286202f, 0.559572399f},
-std::array<float,2>{0.706182599f, 0.490970582f},
-std::array<float,2>{0.153438658f, 0.32868439f},
-std::array<float,2>{0.621832907f, 0.729747772f},
-std::array<float,2>{0.368248731f, 0.841110647f},
-std::array<float,2>{0.980994225f, 0.207111955f},
-std::array<float,2>{0.0667216629f, 0.0903630182f},
-std::array<float,2>{0.670617163f, 0.91860348f},
-std::array<float,2>{0.399062783f, 0.517451584f},
-std::array<float,2>{0.836020529f, 0.45515883f},
-std::array<float,2>{0.30643329f, 0.365442574f},
-std::array<float,2>{0.882246315f, 0.698467612f},
-std::array<float,2>{0.210867748f, 0.871093869f},
-std::array<float,2>{0.513595462f, 0.222694695f},
-std::array<float,2>{0.437910855f, 0.151124343f},
-std::array<float,2>{0.765925765f, 0.794092238f},
-std::array<float,2>{0.031977322f, 0.679330528f},
-std::array<float,2>{0.736874938f, 0.310980409f},
-std::array<float,2>{0.167993665f, 0.402362049f},
-std::array<float,2>{0.563297808f, 0.602725804f},
-std::array<float,2>{0.341879278f, 0.943575025f},
-std::array<float,2>{0.939576805f, 0.0366612189f},
-std::array<float,2>{0.233949363f, 0.215656266f},
-std::array<float,2>{0.534616828f, 0.832346916f},
-std::array<float,2>{0.269135058f, 0.721049428f},
-std::array<float,2>{0.928288162f, 0.342661649f},
-std::array<float,2>{0.412016988f, 0.492729127f},
-std::array<float,2>{0.871569753f, 0.548908949f},
-std::array<float,2>{0.0969672576f, 0.879633963f},
-std::array<float,2>{0.638613164f, 0.102585323f},
-std::array<float,2>{0.358814329f, 0.0286037438f},
-std::array<float,2>{0.994117498f, 0.986908197f},
-std::array<float,2>{0.129612505f, 0.593493104f},
-std::array<float,2>{0.602135956f, 0.43544656f},
-std::array<float,2>{0.0180853512f, 0.258038372f},
-std::array<float,2>{0.695586503f, 0.630714536f},
-std::array<float,2>{0.472178251f, 0.772929132f},
-std::array<float,2>{0.803602636f, 0.161358848f},
-std::array<float,2>{0.151952147f, 0.051240433f},
-std::array<float,2>{0.618720531f, 0.958452404f},
-std::array<float,2>{0.372745782f, 0.624528885f},
-std::array<float,2>{0.978679061f, 0.39008975f},
-std::array<float,2>{0.486831188f, 0.289444625f},
-std::array<float,2>{0.794484317f, 0.664927781f},
-std::array<float,2>{0.00641174614f, 0.799625337f},
-std::array<float,2>{0.708245873f, 0.135780722f},
-std::array<float,2>{0.252701133f, 0.245836765f},
-std::array<float,2>{0.909080744f, 0.847332954f},
-std::array<float,2>{0.234441057f, 0.717384517f},
-std::array<float,2>{0.560955644f, 0.344945341f},
-std::array<float,2>{0.111152798f, 0.446718961f},
-std::array<float,2>{0.640980542f, 0.50117594f},
-std::array<float,2>{0.423193067f, 0.930271864f},
-std::array<float,2>{0.843952715f, 0.0643602684f},
-std::array<float,2>{0.0574882999f, 0.177885026f},
-std::array<float,2>{0.733518004f, 0.759570599f},
-std::array<float,2>{0.464970767f, 0.643962741f},
-std::array<float,2>{0.76383996f, 0.273363203f},
-std::array<float,2>{0.319030106f, 0.414639533f},
-std::array<float,2>{0.958870113f, 0.567616403f},
-std::array<float,2>{0.18032819f, 0.9741081f},
-std::array<float,2>{0.589654684f, 0.00824714452f},
-std::array<float,2>{0.378627896f, 0.116287932f},
-std::array<float,2>{0.815525353f, 0.896463513f},
-std::array<float,2>{0.0829419196f, 0.533858538f},
-std::array<float,2>{0.675431073f, 0.471154451f},
-std::array<float,2>{0.196076274f, 0.324334145f},
-std::array<float,2>{0.523644805f, 0.73868686f},
-std::array<float,2>{0.283208668f, 0.814005494f},
-std::array<float,2>{0.891837955f, 0.194240883f},
-std::array<float,2>{0.0155879678f, 0.00554185314f},
-std::array<float,2>{0.716245174f, 0.980064511f},
-std::array<float,2>{0.49730882f, 0.572508097f},
-std::array<float,2>{0.786746204f, 0.41343537f},
-std::array<float,2>{0.366628647f, 0.279499739f},
-std::array<float,2>{0.971309841f, 0.652368903f},
-std::array<float,2>{0.142791569f, 0.75025028f},
-std::array<float,2>{0.609587848f, 0.181853026f},
-std::array<float,2>{0.43101564f, 0.197247684f},
-std::array<float,2>{0.853102446f, 0.825796902f},
-std::array<float,2>{0.121758021f, 0.748348176f},
-std::array<float,2>{0.65593493f, 0.313344598f},
-std::array<float,2>{0.245504498f, 0.479225188f},
-std::array<float,2>{0.548177421f, 0.544826269f},
-std::array<float,2>{0.265104622f, 0.898832798f},
-std::array<float,2>{0.91517216f, 0.120812126f},
-std::array<float,2>{0.177387759f, 0.125866249f},
-std::array<float,2>{0.583410621f, 0.807726681f},
-std::array<float,2>{0.327950656f, 0.662836075f},
-std::array<float,2>{0.966376781f, 0.287674636f},
-std::array<float,2>{0.454682022f, 0.376400262f},
-std::array<float,2>{0.756480336f, 0.616864741f},
-std::array<float,2>{0.054340072f, 0.96510011f},
-std::array<float,2>{0.725943565f, 0.0563415475f},
-std::array<float,2>{0.290765405f, 0.0718409866f},
-std::array<float,2>{0.902210891f, 0.926876187f},
-std::array<float,2>{0.193426639f, 0.511582971f},
-std::array<float,2>{0.523243725f, 0.437559992f},
-std::array<float,2>{0.08921092f, 0.353518158f},
-std::array<float,2>{0.685942888f, 0.705679715f},
-std::array<float,2>{0.382831186f, 0.854426742f},
-std::array<float,2>{0.822568178f, 0.24142009f},
-std::array<float,2>{0.215536684f, 0.0973551795f},
-std::array<float,2>{0.50176996f, 0.886353076f},
-std::array<float,2>{0.300845265f, 0.556461811f},
-std::array<float,2>{0.883136749f, 0.487417668f},
-std::array<float,2>{0.396384984f, 0.334500194f},
-std::array<float,2>{0.829688251f, 0.733904004f},
-std::array<float,2>{0.0761058629f, 0.837493956f},
-std::array<float,2>{0.661217868f, 0.204111695f},
-std::array<float,2>{0.333554208f, 0.164986283f},
-std::array<float,2>{0.95298475f, 0.776594877f},
-std::array<float,2>{0.156893089f, 0.639714301f},
-std::array<float,2>{0.57677716f, 0.253901541f},
-std::array<float,2>{0.0449166298f, 0.42303434f},
-std::array<float,2>{0.743424177f, 0.581638157f},
-std::array<float,2>{0.448206574f, 0.995827556f},
-std::array<float,2>{0.774107397f, 0.0203842111f},
-std::array<float,2>{0.10936904f, 0.233583078f},
-std::array<float,2>{0.630437255f, 0.865163147f},
-std::array<float,2>{0.420348912f, 0.694461346f},
-std::array<float,2>{0.866747141f, 0.372832209f},
-std::array<float,2>{0.280507356f, 0.46320495f},
-std::array<float,2>{0.931946874f, 0.524884343f},
-std::array<float,2>{0.220381454f, 0.907118857f},
-std::array<float,2>{0.543357849f, 0.0828333497f},
-std::array<float,2>{0.481152177f, 0.0408580229f},
-std::array<float,2>{0.810129046f, 0.951526821f},
-std::array<float,2>{0.0292587448f, 0.601334333f},
-std::array<float,2>{0.694973707f, 0.395924658f},
-std::array<float,2>{0.136518925f, 0.297126859f},
-std::array<float,2>{0.599402666f, 0.683610976f},
-std::array<float,2>{0.347034454f, 0.787569284f},
-std::array<float,2>{0.985280395f, 0.141902953f},
-std::array<float,2>{0.12106733f, 0.0348396786f},
-std::array<float,2>{0.650432885f, 0.939018786f},
-std::array<float,2>{0.436100185f, 0.607341945f},
-std::array<float,2>{0.856278181f, 0.399312824f},
-std::array<float,2>{0.261445463f, 0.307117194f},
-std::array<float,2>{0.920580387f, 0.675048351f},
-std::array<float,2>{0.247286737f, 0.792666852f},
-std::array<float,2>{0.551744223f, 0.15341869f},
-std::array<float,2>{0.493007272f, 0.220315024f},
-std::array<float,2>{0.783221364f, 0.869208395f},
-std::array<float,2>{0.00995532051f, 0.69983381f},
-std::array<float,2>{0.711489916f, 0.360811204f},
-std::array<float,2>{0.148301169f, 0.458456129f},
-std::array<float,2>{0.615008295f, 0.523180783f},
-std::array<float,2>{0.362740934f, 0.914550543f},
-std::array<float,2>{0.97483319f, 0.0894374028f},
-std::array<float,2>{0.189970672f, 0.157773256f},
-std::array<float,2>{0.517393768f, 0.766453326f},
-std::array<float,2>{0.29547444f, 0.62571156f},
-std::array<float,2>{0.904714048f, 0.264969558f},
-std::array<float,2>{0.388365209f, 0.432503432f},
-std::array<float,2>{0.825347066f, 0.588627636f},
-std::array<float,2>{0.0911338925f, 0.991691589f},
-std::array<float,2>{0.68081063f, 0.0254805796f},
-std::array<float,2>{0.322847188f, 0.105495915f},
-std::array<float,2>{0.964779079f, 0.878186405f},
-std::array<float,2>{0.172580123f, 0.55186367f},
-std::array<float,2>{0.580245733f, 0.499803603f},
-std::array<float,2>{0.0504134074f, 0.336520612f},
-std::array<float,2>{0.719421089f, 0.726055086f},
-std::array<float,2>{0.457813829f, 0.83026135f},
-std::array<float,2>{0.750359654f, 0.213819429f},
-std::array<float,2>{0.16038169f, 0.0702035129f},
-std::array<float,2>{0.57312572f, 0.934557498f},
-std::array<float,2>{0.330646396f, 0.507041335f},
-std::array<float,2>{0.946683466f, 0.452900708f},
-std::array<float,2>{0.450704694f, 0.347726226f},
-std::array<float,2>{0.781235218f, 0.714012384f},
-std::array<float,2>{0.0414514244f, 0.847846389f},
-std::array<float,2>{0.749410391f, 0.247847453f},
-std::array<float,2>{0.29725343f, 0.137850761f},
-std::array<float,2>{0.88833493f, 0.802484214f},
-std::array<float,2>{0.213957056f, 0.670324206f},
-std::array<float,2>{0.506747544f, 0.292977989f},
-std::array<float,2>{0.0705659315f, 0.383872718f},
-std::array<float,2>{0.659111083f, 0.620150626f},
-std::array<float,2>{0.393051356f, 0.953323781f},
-std::array<float,2>{0.832832336f, 0.0477843359f},
-std::array<float,2>{0.0264858622f, 0.189132303f},
-std::array<float,2>{0.691097736f, 0.817674339f},
-std::array<float,2>{0.477193594f, 0.736611307f},
-std::array<float,2>{0.804761708f, 0.324206501f},
-std::array<float,2>{0.34824428f, 0.475687325f},
-std::array<float,2>{0.988462329f, 0.537894666f},
-std::array<float,2>{0.137316138f, 0.894173265f},
-std::array<float,2>{0.596329868f, 0.112037919f},
-std::array<float,2>{0.416490614f, 0.0134810833f},
-std::array<float,2>{0.85993588f, 0.968828976f},
-std::array<float,2>{0.104054257f, 0.562976301f},
-std::array<float,2>{0.6259076f, 0.420080096f},
-std::array<float,2>{0.224357247f, 0.266417235f},
-std::array<float,2>{0.541818678f, 0.646415949f},
-std::array<float,2>{0.274134219f, 0.764624834f},
-std::array<float,2>{0.934961438f, 0.174314082f},
-std::array<float,2>{0.0375980623f, 0.123565175f},
-std::array<float,2>{0.740162492f, 0.903981686f},
-std::array<float,2>{0.44388333f, 0.540841937f},
-std::array<float,2>{0.773127675f, 0.480478942f},
-std::array<float,2>{0.338411003f, 0.317734867f},
-std::array<float,2>{0.944309413f, 0.742554903f},
-std::array<float,2>{0.165548086f, 0.820744216f},
-std::array<float,2>{0.567363381f, 0.200539112f},
-std::array<float,2>{0.404186219f, 0.184553891f},
-std::array<float,2>{0.843376577f, 0.753955603f},
-std::array<float,2>{0.0657253191f, 0.650038004f},
-std::array<float,2>{0.664390743f, 0.274208009f},
-std::array<float,2>{0.205801755f, 0.406835258f},
-std::array<float,2>{0.508596539f, 0.57697022f},
-std::array<float,2>{0.312333643f, 0.981224418f},
-std::array<float,2>{0.87646991f, 0.00182521692f},
-std::array<float,2>{0.128414541f, 0.236336231f},
-std::array<float,2>{0.608839214f, 0.855468869f},
-std::array<float,2>{0.352816999f, 0.710792184f},
-std::array<float,2>{0.996663749f, 0.355720431f},
-std::array<float,2>{0.474697351f, 0.441991836f},
-std::array<float,2>{0.798001528f, 0.512528777f},
-std::array<float,2>{0.0230965484f, 0.924877465f},
-std::array<float,2>{0.700217783f, 0.0758027211f},
-std::array<float,2>{0.272706658f, 0.0607523285f},
-std::array<float,2>{0.9257074f, 0.962446272f},
-std::array<float,2>{0.22746323f, 0.611351013f},
-std::array<float,2>{0.538430989f, 0.378994077f},
-std::array<float,2>{0.099238053f, 0.281477213f},
-std::array<float,2>{0.633235931f, 0.659615278f},
-std::array<float,2>{0.409268022f, 0.809022486f},
-std::array<float,2>{0.86772126f, 0.129404575f},
-std::array<float,2>{0.242144346f, 0.0175816864f},
-std::array<float,2>{0.556068957f, 0.997753561f},
-std::array<float,2>{0.257472873f, 0.583314478f},
-std::array<float,2>{0.911386549f, 0.428231388f},
-std::array<float,2>{0.425783634f, 0.256545395f},
-std::array<float,2>{0.847820759f, 0.63662672f},
-std::array<float,2>{0.113872483f, 0.778842509f},
-std::array<float,2>{0.644660175f, 0.169625059f},
-std::array<float,2>{0.370334625f, 0.209718302f},
-std::array<float,2>{0.982948482f, 0.842220306f},
-std::array<float,2>{0.155509472f, 0.72686851f},
-std::array<float,2>{0.624941707f, 0.330223292f},
-std::array<float,2>{0.00156216521f, 0.489887476f},
-std::array<float,2>{0.704454303f, 0.561023831f},
-std::array<float,2>{0.489224404f, 0.890227914f},
-std::array<float,2>{0.792722821f, 0.100568272f},
-std::array<float,2>{0.0818840563f, 0.145378485f},
-std::array<float,2>{0.676817179f, 0.785103679f},
-std::array<float,2>{0.382679731f, 0.682594895f},
-std::array<float,2>{0.819602251f, 0.304406732f},
-std::array<float,2>{0.287828416f, 0.394340038f},
-std::array<float,2>{0.89782232f, 0.596858859f},
-std::array<float,2>{0.200454339f, 0.945983648f},
-std::array<float,2>{0.529761195f, 0.0450356118f},
-std::array<float,2>{0.461640358f, 0.0783892199f},
-std::array<float,2>{0.757977962f, 0.911268234f},
-std::array<float,2>{0.0601935461f, 0.529985428f},
-std::array<float,2>{0.730311215f, 0.4678967f},
-std::array<float,2>{0.185754344f, 0.370963842f},
-std::array<float,2>{0.590523064f, 0.690805495f},
-std::array<float,2>{0.313729197f, 0.862878621f},
-std::array<float,2>{0.9567191f, 0.229578853f},
-std::array<float,2>{0.113189057f, 0.06324251f},
-std::array<float,2>{0.644078195f, 0.93127811f},
-std::array<float,2>{0.424967498f, 0.50024718f},
-std::array<float,2>{0.846027017f, 0.445797652f},
-std::array<float,2>{0.251473784f, 0.344177276f},
-std::array<float,2>{0.907192886f, 0.717824697f},
-std::array<float,2>{0.237196833f, 0.845886827f},
-std::array<float,2>{0.559181273f, 0.244610816f},
-std::array<float,2>{0.485747874f, 0.13483578f},
-std::array<float,2>{0.795985401f, 0.799938619f},
-std::array<float,2>{0.00488914642f, 0.665576518f},
-std::array<float,2>{0.710147321f, 0.290137321f},
-std::array<float,2>{0.149479687f, 0.38886112f},
-std::array<float,2>{0.61938566f, 0.623182833f},
-std::array<float,2>{0.373232812f, 0.957232833f},
-std::array<float,2>{0.977951825f, 0.0519978739f},
-std::array<float,2>{0.198928684f, 0.194709986f},
-std::array<float,2>{0.525796771f, 0.812740922f},
-std::array<float,2>{0.282951653f, 0.740110219f},
-std::array<float,2>{0.894194365f, 0.325671285f},
-std::array<float,2>{0.376407236f, 0.47172454f},
-std::array<float,2>{0.812627077f, 0.534867823f},
-std::array<float,2>{0.0857091919f, 0.894837618f},
-std::array<float,2>{0.67326802f, 0.115611643f},
-std::array<float,2>{0.31715405f, 0.00936158653f},
-std::array<float,2>{0.960311651f, 0.973628342f},
-std::array<float,2>{0.182016045f, 0.567382693f},
-std::array<float,2>{0.587207556f, 0.415201277f},
-std::array<float,2>{0.0552278683f, 0.271847218f},
-std::array<float,2>{0.730846345f, 0.642775893f},
-std::array<float,2>{0.468058944f, 0.758599162f},
-std::array<float,2>{0.762517452f, 0.179102525f},
-std::array<float,2>{0.170701712f, 0.0358079299f},
-std::array<float,2>{0.566329777f, 0.945188463f},
-std::array<float,2>{0.340237468f, 0.601715982f},
-std::array<float,2>{0.93925035f, 0.404222548f},
-std::array<float,2>{0.441002607f, 0.311797053f},
-std::array<float,2>{0.768568873f, 0.678594291f},
-std::array<float,2>{0.0341395624f, 0.793058872f},
-std::array<float,2>{0.734650016f, 0.151393726f},
-std::array<float,2>{0.30721876f, 0.224173263f},
-std::array<float,2>{0.880834758f, 0.873012662f},
-std::array<float,2>{0.208541334f, 0.69740206f},
-std::array<float,2>{0.514625669f, 0.366451949f},
-std::array<float,2>{0.0702869818f, 0.456325799f},
-std::array<float,2>{0.667980015f, 0.516247153f},
-std::array<float,2>{0.402141035f, 0.919515967f},
-std::array<float,2>{0.83854115f, 0.0915043354f},
-std::array<float,2>{0.0165640023f, 0.160412192f},
-std::array<float,2>{0.697835028f, 0.772031784f},
-std::array<float,2>{0.469991595f, 0.629873872f},
-std::array<float,2>{0.80258745f, 0.259127498f},
-std::array<float,2>{0.357408941f, 0.433848411f},
-std::array<float,2>{0.995279968f, 0.592582166f},
-std::array<float,2>{0.13237451f, 0.988189757f},
-std::array<float,2>{0.603958786f, 0.0280039608f},
-std::array<float,2>{0.412636191f, 0.102327459f},
-std::array<float,2>{0.874955595f, 0.880797565f},
-std::array<float,2>{0.0938891992f, 0.550024986f},
-std::array<float,2>{0.640294254f, 0.493420839f},
-std::array<float,2>{0.23155494f, 0.343377501f},
-std::array<float,2>{0.531594217f, 0.721927643f},
-std::array<float,2>{0.266052157f, 0.833417416f},
-std::array<float,2>{0.925878942f, 0.215985224f},
-std::array<float,2>{0.0466542915f, 0.020972088f},
-std::array<float,2>{0.745234311f, 0.994761229f},
-std::array<float,2>{0.446093202f, 0.5800789f},
-std::array<float,2>{0.776699424f, 0.422566026f},
-std::array<float,2>{0.335623413f, 0.251960367f},
-std::array<float,2>{0.949866533f, 0.639393985f},
-std::array<float,2>{0.159406364f, 0.776083171f},
-std::array<float,2>{0.574487865f, 0.165840149f},
-std::array<float,2>{0.397099495f, 0.20380795f},
-std::array<float,2>{0.831749141f, 0.836754322f},
-std::array<float,2>{0.0768242031f, 0.732889771f},
-std::array<float,2>{0.663153768f, 0.33520022f},
-std::array<float,2>{0.218275294f, 0.48671174f},
-std::array<float,2>{0.503602386f, 0.554877698f},
-std::array<float,2>{0.30342558f, 0.884972513f},
-std::array<float,2>{0.886676967f, 0.0960218906f},
-std::array<float,2>{0.134340197f, 0.141429558f},
-std::array<float,2>{0.600254178f, 0.788213909f},
-std::array<float,2>{0.34433794f, 0.684722781f},
-std::array<float,2>{0.986647248f, 0.298755586f},
-std::array<float,2>{0.483573437f, 0.395425528f},
-std::array<float,2>{0.81178546f, 0.600352287f},
-std::array<float,2>{0.0296655744f, 0.952997386f},
-std::array<float,2>{0.692376137f, 0.0396691151f},
-std::array<float,2>{0.279061466f, 0.0839791968f},
-std::array<float,2>{0.931286693f, 0.908168018f},
-std::array<float,2>{0.221293673f, 0.523496687f},
-std::array<float,2>{0.545932293f, 0.464407414f},
-std::array<float,2>{0.106340356f, 0.371280074f},
-std::array<float,2>{0.632215023f, 0.693554223f},
-std::array<float,2>{0.418896824f, 0.863520741f},
-std::array<float,2>{0.86392653f, 0.233215973f},
-std::array<float,2>{0.242576689f, 0.120067813f},
-std::array<float,2>{0.549092948f, 0.899985313f},
-std::array<float,2>{0.263249278f, 0.543598354f},
-std::array<float,2>{0.916522861f, 0.480160922f},
-std::array<float,2>{0.433075488f, 0.314357668f},
-std::array<float,2>{0.85448873f, 0.749025047f},
-std::array<float,2>{0.124863818f, 0.824442387f},
-std::array<float,2>{0.653750837f, 0.196125433f},
-std::array<float,2>{0.363437086f, 0.182744741f},
-std::array<float,2>{0.970230758f, 0.75165534f},
-std::array<float,2>{0.141591042f, 0.653825521f},
-std::array<float,2>{0.612231612f, 0.280865848f},
-std::array<float,2>{0.0126090413f, 0.412646592f},
-std::array<float,2>{0.716871321f, 0.573331177f},
-std::array<float,2>{0.499446869f, 0.979352593f},
-std::array<float,2>{0.787590563f, 0.0048584654f},
-std::array<float,2>{0.086034067f, 0.240509972f},
-std::array<float,2>{0.685264051f, 0.85469842f},
-std::array<float,2>{0.385374755f, 0.706065357f},
-std::array<float,2>{0.822102189f, 0.35491538f},
-std::array<float,2>{0.291276395f, 0.438586652f},
-std::array<float,2>{0.899403751f, 0.510680079f},
-std::array<float,2>{0.192689434f, 0.925912559f},
-std::array<float,2>{0.521319509f, 0.070651181f},
-std::array<float,2>{0.456734627f, 0.0551115796f},
-std::array<float,2>{0.755316138f, 0.966786265f},
-std::array<float,2>{0.0509346016f, 0.61580205f},
-std::array<float,2>{0.723771274f, 0.375331581f},
-std::array<float,2>{0.178097934f, 0.288449049f},
-std::array<float,2>{0.584920049f, 0.66330415f},
-std::array<float,2>{0.325172275f, 0.806781173f},
-std::array<float,2>{0.96731931f, 0.126222208f},
-std::array<float,2>{0.0741047487f, 0.0481805354f},
-std::array<float,2>{0.657042444f, 0.954451025f},
-std::array<float,2>{0.391133308f, 0.62008208f},
-std::array<float,2>{0.835241437f, 0.382967949f},
-std::array<float,2>{0.299956262f, 0.29447934f},
-std::array<float,2>{0.889517248f, 0.671625137f},
-std::array<float,2>{0.2117327f, 0.8015275f},
-std::array<float,2>{0.50460422f, 0.137398526f},
-std::array<float,2>{0.451883644f, 0.24627468f},
-std::array<float,2>{0.778728306f, 0.849598706f},
-std::array<float,2>{0.0407813638f, 0.713384986f},
-std::array<float,2>{0.746445537f, 0.349176705f},
-std::array<float,2>{0.162432045f, 0.451662928f},
-std::array<float,2>{0.571023941f, 0.506620467f},
-std::array<float,2>{0.328723788f, 0.935250759f},
-std::array<float,2>{0.947368503f, 0.0689853653f},
-std::array<float,2>{0.224990055f, 0.175326437f},
-std::array<float,2>{0.54070729f, 0.765406251f},
-std::array<float,2>{0.277015001f, 0.64497304f},
-std::array<float,2>{0.935619354f, 0.267213911f},
-std::array<float,2>{0.415950119f, 0.421618998f},
-std::array<float,2>{0.862260878f, 0.56389761f},
-std::array<float,2>{0.102564007f, 0.970255613f},
-std::array<float,2>{0.628339529f, 0.0125532243f},
-std::array<float,2>{0.349914223f, 0.112568058f},
-std::array<float,2>{0.990270972f, 0.893501937f},
-std::array<float,2>{0.140254766f, 0.538586557f},
-std::array<float,2>{0.595420122f, 0.475043297f},
-std::array<float,2>{0.0242525842f, 0.32259205f},
-std::array<float,2>{0.687705934f, 0.738139093f},
-std::array<float,2>{0.480373979f, 0.816446364f},
-std::array<float,2>{0.807477772f, 0.187872171f},
-std::array<float,2>{0.145599708f, 0.0886264592f},
-std::array<float,2>{0.616744041f, 0.915247738f},
-std::array<float,2>{0.360752493f, 0.521757126f},
-std::array<float,2>{0.974342704f, 0.457834363f},
-std::array<float,2>{0.49476403f, 0.360329658f},
-std::array<float,2>{0.782084286f, 0.70077008f},
-std::array<float,2>{0.0092945639f, 0.87071991f},
-std::array<float,2>{0.714081883f, 0.219654217f},
-std::array<float,2>{0.259043604f, 0.152688533f},
-std::array<float,2>{0.919813395f, 0.791549921f},
-std::array<float,2>{0.249595404f, 0.673940957f},
-std::array<float,2>{0.553838253f, 0.30829528f},
-std::array<float,2>{0.118821651f, 0.399914682f},
-std::array<float,2>{0.64941287f, 0.606236279f},
-std::array<float,2>{0.434899509f, 0.938475847f},
-std::array<float,2>{0.857991576f, 0.0339444317f},
-std::array<float,2>{0.0476989709f, 0.214666709f},
-std::array<float,2>{0.722313106f, 0.831945658f},
-std::array<float,2>{0.460923523f, 0.725164354f},
-std::array<float,2>{0.752779186f, 0.337789267f},
-std::array<float,2>{0.320345521f, 0.499001175f},
-std::array<float,2>{0.962506056f, 0.551252663f},
-std::array<float,2>{0.174102634f, 0.877037644f},
-std::array<float,2>{0.578881741f, 0.106577918f},
-std::array<float,2>{0.389780462f, 0.0264078323f},
-std::array<float,2>{0.827334642f, 0.991140008f},
-std::array<float,2>{0.0926381424f, 0.588888645f},
-std::array<float,2>{0.682098389f, 0.432898223f},
-std::array<float,2>{0.188388392f, 0.263956219f},
-std::array<float,2>{0.518085837f, 0.626830161f},
-std::array<float,2>{0.294670373f, 0.766893983f},
-std::array<float,2>{0.902546227f, 0.156412572f},
-std::array<float,2>{0.00381398154f, 0.100827493f},
-std::array<float,2>{0.705934286f, 0.888831019f},
-std::array<float,2>{0.491636544f, 0.562271714f},
-std::array<float,2>{0.789447844f, 0.488792956f},
-std::array<float,2>{0.367201418f, 0.331891268f},
-std::array<float,2>{0.981684446f, 0.72754395f},
-std::array<float,2>{0.152420253f, 0.842782497f},
-std::array<float,2>{0.622109294f, 0.21017915f},
-std::array<float,2>{0.428554147f, 0.168321878f},
-std::array<float,2>{0.851222575f, 0.778051913f},
-std::array<float,2>{0.115366243f, 0.635152757f},
-std::array<float,2>{0.646851063f, 0.257076263f},
-std::array<float,2>{0.239277154f, 0.42907843f},
-std::array<float,2>{0.557005644f, 0.582414448f},
-std::array<float,2>{0.254122227f, 0.996141136f},
-std::array<float,2>{0.913090646f, 0.0191535465f},
-std::array<float,2>{0.185500905f, 0.228740066f},
-std::array<float,2>{0.591828525f, 0.861518741f},
-std::array<float,2>{0.314686835f, 0.690046489f},
-std::array<float,2>{0.954341173f, 0.369378477f},
-std::array<float,2>{0.464615405f, 0.467361987f},
-std::array<float,2>{0.760471225f, 0.530322134f},
-std::array<float,2>{0.0616914965f, 0.910441101f},
-std::array<float,2>{0.728462219f, 0.0800431371f},
-std::array<float,2>{0.286078513f, 0.046708066f},
-std::array<float,2>{0.89534694f, 0.947099924f},
-std::array<float,2>{0.201544181f, 0.596613884f},
-std::array<float,2>{0.528410196f, 0.392898172f},
-std::array<float,2>{0.0796568245f, 0.302756906f},
-std::array<float,2>{0.678569198f, 0.68302685f},
-std::array<float,2>{0.380415797f, 0.783841193f},
-std::array<float,2>{0.81797719f, 0.146086797f},
-std::array<float,2>{0.204802066f, 2.65718481e-05f},
-std::array<float,2>{0.511415422f, 0.981807113f},
-std::array<float,2>{0.309159368f, 0.577488482f},
-std::array<float,2>{0.877664864f, 0.407975912f},
-std::array<float,2>{0.404313505f, 0.27497381f},
-std::array<float,2>{0.840393662f, 0.649214983f},
-std::array<float,2>{0.0641697198f, 0.755440533f},
-std::array<float,2>{0.666091561f, 0.185445189f},
-std::array<float,2>{0.335980713f, 0.199899465f},
-std::array<float,2>{0.942170024f, 0.822138488f},
-std::array<float,2>{0.16731143f, 0.743632436f},
-std::array<float,2>{0.569405377f, 0.317130208f},
-std::array<float,2>{0.0357539877f, 0.481875896f},
-std::array<float,2>{0.741957843f, 0.539912701f},
-std::array<float,2>{0.443339765f, 0.903060138f},
-std::array<float,2>{0.769581258f, 0.124292426f},
-std::array<float,2>{0.100767724f, 0.130372375f},
-std::array<float,2>{0.636307061f, 0.810430706f},
-std::array<float,2>{0.40778774f, 0.658328414f},
-std::array<float,2>{0.869984686f, 0.282653868f},
-std::array<float,2>{0.269555032f, 0.38054502f},
-std::array<float,2>{0.922598243f, 0.613169372f},
-std::array<float,2>{0.229772791f, 0.961612284f},
-std::array<float,2>{0.536857843f, 0.0622575954f},
-std::array<float,2>{0.473261505f, 0.0746586323f},
-std::array<float,2>{0.798956573f, 0.923952222f},
-std::array<float,2>{0.0207483191f, 0.513557494f},
-std::array<float,2>{0.701694191f, 0.443127543f},
-std::array<float,2>{0.126491711f, 0.356583923f},
-std::array<float,2>{0.605943561f, 0.709681392f},
-std::array<float,2>{0.355018169f, 0.856481373f},
-std::array<float,2>{0.998544037f, 0.238151819f},
-std::array<float,2>{0.0835523084f, 0.114360556f},
-std::array<float,2>{0.674521267f, 0.896615267f},
-std::array<float,2>{0.37792328f, 0.532282591f},
-std::array<float,2>{0.815192699f, 0.470291734f},
-std::array<float,2>{0.284273118f, 0.326643765f},
-std::array<float,2>{0.891064584f, 0.740316451f},
-std::array<float,2>{0.196987212f, 0.815457582f},
-std::array<float,2>{0.525228918f, 0.191464826f},
-std::array<float,2>{0.466459036f, 0.176559746f},
-std::array<float,2>{0.764741719f, 0.760342181f},
-std::array<float,2>{0.0582723208f, 0.641427457f},
-std::array<float,2>{0.7332322f, 0.269570351f},
-std::array<float,2>{0.181271374f, 0.416540265f},
-std::array<float,2>{0.58856529f, 0.569729447f},
-std::array<float,2>{0.319388092f, 0.976234615f},
-std::array<float,2>{0.957401693f, 0.0107566938f},
-std::array<float,2>{0.23552762f, 0.242804334f},
-std::array<float,2>{0.562227309f, 0.845524311f},
-std::array<float,2>{0.253483206f, 0.716328502f},
-std::array<float,2>{0.909958959f, 0.346777529f},
-std::array<float,2>{0.42282933f, 0.447695524f},
-std::array<float,2>{0.845209539f, 0.503494918f},
-std::array<float,2>{0.110326029f, 0.932813823f},
-std::array<float,2>{0.641625345f, 0.0657225698f},
-std::array<float,2>{0.371223658f, 0.0538356155f},
-std::array<float,2>{0.980280757f, 0.959970593f},
-std::array<float,2>{0.151223451f, 0.621898115f},
-std::array<float,2>{0.617639184f, 0.387303501f},
-std::array<float,2>{0.00740782777f, 0.291092008f},
-std::array<float,2>{0.707338393f, 0.66683507f},
-std::array<float,2>{0.487802595f, 0.797571421f},
-std::array<float,2>{0.793119371f, 0.1344053f},
-std::array<float,2>{0.129976943f, 0.0310548022f},
-std::array<float,2>{0.603259027f, 0.984933853f},
-std::array<float,2>{0.358244687f, 0.591782391f},
-std::array<float,2>{0.993045986f, 0.435905218f},
-std::array<float,2>{0.471515775f, 0.261620879f},
-std::array<float,2>{0.804585636f, 0.632425547f},
-std::array<float,2>{0.0194042511f, 0.769777179f},
-std::array<float,2>{0.696964204f, 0.162725493f},
-std::array<float,2>{0.267911583f, 0.216883093f},
-std::array<float,2>{0.929024875f, 0.83412534f},
-std::array<float,2>{0.232438579f, 0.720319927f},
-std::array<float,2>{0.533368945f, 0.341049284f},
-std::array<float,2>{0.0961650982f, 0.494238257f},
-std::array<float,2>{0.637427986f, 0.548274577f},
-std::array<float,2>{0.410637408f, 0.882744789f},
-std::array<float,2>{0.872163236f, 0.103814796f},
-std::array<float,2>{0.0330641977f, 0.149469942f},
-std::array<float,2>{0.737451792f, 0.795369327f},
-std::array<float,2>{0.438538492f, 0.676948547f},
-std::array<float,2>{0.767314255f, 0.309745461f},
-std::array<float,2>{0.343306303f, 0.406201601f},
-std::array<float,2>{0.941398144f, 0.604984641f},
-std::array<float,2>{0.169238657f, 0.941570938f},
-std::array<float,2>{0.564061344f, 0.0386124216f},
-std::array<float,2>{0.399747938f, 0.0933541507f},
-std::array<float,2>{0.837760508f, 0.920994401f},
-std::array<float,2>{0.0680899322f, 0.517600834f},
-std::array<float,2>{0.671584725f, 0.454839379f},
-std::array<float,2>{0.209878147f, 0.364287078f},
-std::array<float,2>{0.512161493f, 0.697064698f},
-std::array<float,2>{0.304974526f, 0.873118997f},
-std::array<float,2>{0.881161749f, 0.224880919f},
-std::array<float,2>{0.0282041598f, 0.0419445224f},
-std::array<float,2>{0.693825543f, 0.949951768f},
-std::array<float,2>{0.481877923f, 0.599205017f},
-std::array<float,2>{0.809136748f, 0.397354096f},
-std::array<float,2>{0.345937073f, 0.299724042f},
-std::array<float,2>{0.985646069f, 0.685932636f},
-std::array<float,2>{0.135382652f, 0.785861492f},
-std::array<float,2>{0.597982109f, 0.143606618f},
-std::array<float,2>{0.421640337f, 0.231512144f},
-std::array<float,2>{0.865840137f, 0.867172956f},
-std::array<float,2>{0.107573979f, 0.692540944f},
-std::array<float,2>{0.629645288f, 0.373080343f},
-std::array<float,2>{0.219060183f, 0.461417586f},
-std::array<float,2>{0.544909358f, 0.526159167f},
-std::array<float,2>{0.279971808f, 0.909167051f},
-std::array<float,2>{0.933396459f, 0.0840414166f},
-std::array<float,2>{0.157807082f, 0.166243926f},
-std::array<float,2>{0.577661932f, 0.774118483f},
-std::array<float,2>{0.332777977f, 0.63808769f},
-std::array<float,2>{0.951791406f, 0.251579255f},
-std::array<float,2>{0.44915548f, 0.424280018f},
-std::array<float,2>{0.775122464f, 0.579896748f},
-std::array<float,2>{0.0435420424f, 0.993597388f},
-std::array<float,2>{0.74270153f, 0.0224761236f},
-std::array<float,2>{0.302262783f, 0.0937612876f},
-std::array<float,2>{0.884153366f, 0.883856475f},
-std::array<float,2>{0.215869635f, 0.558124423f},
-std::array<float,2>{0.500830829f, 0.484545588f},
-std::array<float,2>{0.0745641589f, 0.332112223f},
-std::array<float,2>{0.660484254f, 0.731827557f},
-std::array<float,2>{0.395036548f, 0.839325428f},
-std::array<float,2>{0.828931153f, 0.20559974f},
-std::array<float,2>{0.194363356f, 0.0724639073f},
-std::array<float,2>{0.521526277f, 0.929552674f},
-std::array<float,2>{0.289294958f, 0.509327054f},
-std::array<float,2>{0.9010517f, 0.439712495f},
-std::array<float,2>{0.384261817f, 0.352232158f},
-std::array<float,2>{0.823440135f, 0.703510404f},
-std::array<float,2>{0.0880183876f, 0.852618575f},
-std::array<float,2>{0.687132061f, 0.238702565f},
-std::array<float,2>{0.327021956f, 0.12799336f},
-std::array<float,2>{0.965183318f, 0.806603253f},
-std::array<float,2>{0.176742673f, 0.660891891f},
-std::array<float,2>{0.582903981f, 0.285499871f},
-std::array<float,2>{0.0529294088f, 0.377188146f},
-std::array<float,2>{0.72493273f, 0.614839077f},
-std::array<float,2>{0.45327124f, 0.967026055f},
-std::array<float,2>{0.757109225f, 0.0580586493f},
-std::array<float,2>{0.122505054f, 0.197688431f},
-std::array<float,2>{0.655166626f, 0.826865196f},
-std::array<float,2>{0.430604875f, 0.747037053f},
-std::array<float,2>{0.851803303f, 0.316312164f},
-std::array<float,2>{0.264145076f, 0.477120161f},
-std::array<float,2>{0.914642572f, 0.545522273f},
-std::array<float,2>{0.245039716f, 0.901467979f},
-std::array<float,2>{0.54697156f, 0.117534593f},
-std::array<float,2>{0.496796459f, 0.00586168515f},
-std::array<float,2>{0.785453558f, 0.976648688f},
-std::array<float,2>{0.014131696f, 0.570903242f},
-std::array<float,2>{0.715172768f, 0.411601901f},
-std::array<float,2>{0.144228876f, 0.277565897f},
-std::array<float,2>{0.610820055f, 0.654505074f},
-std::array<float,2>{0.365736336f, 0.752990782f},
-std::array<float,2>{0.972195685f, 0.180351719f},
-std::array<float,2>{0.104507774f, 0.014886111f},
-std::array<float,2>{0.626255453f, 0.972084105f},
-std::array<float,2>{0.41707778f, 0.56605947f},
-std::array<float,2>{0.861123741f, 0.418079793f},
-std::array<float,2>{0.274623275f, 0.26861462f},
-std::array<float,2>{0.934266806f, 0.64759481f},
-std::array<float,2>{0.22320421f, 0.76195085f},
-std::array<float,2>{0.54266721f, 0.172576159f},
-std::array<float,2>{0.478204995f, 0.190872937f},
-std::array<float,2>{0.806383252f, 0.818936229f},
-std::array<float,2>{0.0261019859f, 0.736008465f},
-std::array<float,2>{0.689993143f, 0.320438921f},
-std::array<float,2>{0.138160467f, 0.474538445f},
-std::array<float,2>{0.597360075f, 0.537051558f},
-std::array<float,2>{0.349357963f, 0.891926885f},
-std::array<float,2>{0.989344597f, 0.110811211f},
-std::array<float,2>{0.213079512f, 0.139222994f},
-std::array<float,2>{0.507432401f, 0.802832484f},
-std::array<float,2>{0.298579574f, 0.669773996f},
-std::array<float,2>{0.887010455f, 0.296258062f},
-std::array<float,2>{0.394358993f, 0.386531115f},
-std::array<float,2>{0.833470404f, 0.618716538f},
-std::array<float,2>{0.0719001517f, 0.95667851f},
-std::array<float,2>{0.659587026f, 0.0501216576f},
-std::array<float,2>{0.331678659f, 0.0671992227f},
-std::array<float,2>{0.945852101f, 0.935635328f},
-std::array<float,2>{0.161586672f, 0.504744589f},
-std::array<float,2>{0.573760569f, 0.44940719f},
-std::array<float,2>{0.0426335707f, 0.349829793f},
-std::array<float,2>{0.748235583f, 0.712681413f},
-std::array<float,2>{0.449522436f, 0.85083431f},
-std::array<float,2>{0.779620945f, 0.248931438f},
-std::array<float,2>{0.1737535f, 0.108793139f},
-std::array<float,2>{0.581530869f, 0.876419485f},
-std::array<float,2>{0.323496521f, 0.553766072f},
-std::array<float,2>{0.963250816f, 0.497606874f},
-std::array<float,2>{0.45820117f, 0.339430124f},
-std::array<float,2>{0.751254559f, 0.72372663f},
-std::array<float,2>{0.0495699234f, 0.829022586f},
-std::array<float,2>{0.72059828f, 0.211955994f},
-std::array<float,2>{0.296433061f, 0.159868047f},
-std::array<float,2>{0.905422211f, 0.769286931f},
-std::array<float,2>{0.190913364f, 0.628530443f},
-std::array<float,2>{0.515833378f, 0.263522416f},
-std::array<float,2>{0.0902917013f, 0.430343419f},
-std::array<float,2>{0.6803388f, 0.5870471f},
-std::array<float,2>{0.387209803f, 0.989876568f},
-std::array<float,2>{0.825193465f, 0.0246535502f},
-std::array<float,2>{0.0108903702f, 0.222593412f},
-std::array<float,2>{0.712539077f, 0.868678987f},
-std::array<float,2>{0.494030982f, 0.702706456f},
-std::array<float,2>{0.78500706f, 0.362115711f},
-std::array<float,2>{0.362036288f, 0.459084988f},
-std::array<float,2>{0.975750566f, 0.52003628f},
-std::array<float,2>{0.147073194f, 0.917107761f},
-std::array<float,2>{0.613788605f, 0.0869632363f},
-std::array<float,2>{0.436755359f, 0.0321971439f},
-std::array<float,2>{0.857264757f, 0.94138062f},
-std::array<float,2>{0.119518436f, 0.60801059f},
-std::array<float,2>{0.651750267f, 0.400407195f},
-std::array<float,2>{0.24637042f, 0.306465477f},
-std::array<float,2>{0.552361131f, 0.672064304f},
-std::array<float,2>{0.26026234f, 0.789902925f},
-std::array<float,2>{0.921654224f, 0.155831575f},
-std::array<float,2>{0.0586090609f, 0.0801625922f},
-std::array<float,2>{0.728688955f, 0.913130701f},
-std::array<float,2>{0.462419242f, 0.528881788f},
-std::array<float,2>{0.759433329f, 0.466025442f},
-std::array<float,2>{0.312525332f, 0.367496461f},
-std::array<float,2>{0.955229938f, 0.689355612f},
-std::array<float,2>{0.186931878f, 0.859603524f},
-std::array<float,2>{0.591163218f, 0.226589739f},
-std::array<float,2>{0.381563962f, 0.147339776f},
-std::array<float,2>{0.818446696f, 0.781679034f},
-std::array<float,2>{0.080624707f, 0.681451559f},
-std::array<float,2>{0.675890863f, 0.301350176f},
-std::array<float,2>{0.199939609f, 0.391914696f},
-std::array<float,2>{0.531016529f, 0.594502449f},
-std::array<float,2>{0.288412094f, 0.949010372f},
-std::array<float,2>{0.897388399f, 0.0432790332f},
-std::array<float,2>{0.155065224f, 0.20893845f},
-std::array<float,2>{0.623246789f, 0.8399418f},
-std::array<float,2>{0.369313627f, 0.729022563f},
-std::array<float,2>{0.984167874f, 0.329573929f},
-std::array<float,2>{0.490136027f, 0.491907626f},
-std::array<float,2>{0.791383564f, 0.559040189f},
-std::array<float,2>{0.000275424216f, 0.888041675f},
-std::array<float,2>{0.703730166f, 0.0986566693f},
-std::array<float,2>{0.256427348f, 0.0157911219f},
-std::array<float,2>{0.91087842f, 0.999208748f},
-std::array<float,2>{0.240913525f, 0.58554256f},
-std::array<float,2>{0.555274308f, 0.427397609f},
-std::array<float,2>{0.114276625f, 0.254606634f},
-std::array<float,2>{0.645554245f, 0.634575665f},
-std::array<float,2>{0.426831961f, 0.780943751f},
-std::array<float,2>{0.849561989f, 0.171378225f},
-std::array<float,2>{0.227544323f, 0.0597550608f},
-std::array<float,2>{0.537968218f, 0.964310288f},
-std::array<float,2>{0.271531314f, 0.609810114f},
-std::array<float,2>{0.924641728f, 0.381658405f},
-std::array<float,2>{0.408361852f, 0.28327781f},
-std::array<float,2>{0.869103551f, 0.6572662f},
-std::array<float,2>{0.0980329812f, 0.811077058f},
-std::array<float,2>{0.634567916f, 0.132795438f},
-std::array<float,2>{0.352167815f, 0.235281333f},
-std::array<float,2>{0.997288406f, 0.85802722f},
-std::array<float,2>{0.127233028f, 0.708277166f},
-std::array<float,2>{0.60744828f, 0.357482642f},
-std::array<float,2>{0.0216885712f, 0.44384715f},
-std::array<float,2>{0.700175762f, 0.515011787f},
-std::array<float,2>{0.476037741f, 0.923037171f},
-std::array<float,2>{0.796914041f, 0.0779274553f},
-std::array<float,2>{0.0651493147f, 0.187146693f},
-std::array<float,2>{0.66600877f, 0.756494105f},
-std::array<float,2>{0.40286833f, 0.650610983f},
-std::array<float,2>{0.841942787f, 0.275691599f},
-std::array<float,2>{0.311422229f, 0.40859586f},
-std::array<float,2>{0.875850022f, 0.574430704f},
-std::array<float,2>{0.206256628f, 0.983814061f},
-std::array<float,2>{0.509006321f, 0.00232964312f},
-std::array<float,2>{0.444694877f, 0.122545481f},
-std::array<float,2>{0.77153331f, 0.906021178f},
-std::array<float,2>{0.0387464538f, 0.541766346f},
-std::array<float,2>{0.738630176f, 0.482591599f},
-std::array<float,2>{0.164063305f, 0.319054395f},
-std::array<float,2>{0.567636132f, 0.744391263f},
-std::array<float,2>{0.339373529f, 0.823376656f},
-std::array<float,2>{0.94518882f, 0.20180583f},
-std::array<float,2>{0.115507573f, 0.0983785391f},
-std::array<float,2>{0.646682024f, 0.887368262f},
-std::array<float,2>{0.428257674f, 0.560266197f},
-std::array<float,2>{0.851451933f, 0.490460336f},
-std::array<float,2>{0.254294246f, 0.328382403f},
-std::array<float,2>{0.913542986f, 0.730095863f},
-std::array<float,2>{0.239594981f, 0.84150815f},
-std::array<float,2>{0.556680143f, 0.207809135f},
-std::array<float,2>{0.491227776f, 0.170601383f},
-std::array<float,2>{0.789232075f, 0.779418528f},
-std::array<float,2>{0.00361625035f, 0.633310914f},
-std::array<float,2>{0.705629706f, 0.255146712f},
-std::array<float,2>{0.152590126f, 0.425852805f},
-std::array<float,2>{0.622379363f, 0.584478676f},
-std::array<float,2>{0.367669761f, 0.9981336f},
-std::array<float,2>{0.981904805f, 0.0166397076f},
-std::array<float,2>{0.201287761f, 0.227870256f},
-std::array<float,2>{0.528761864f, 0.860652804f},
-std::array<float,2>{0.285720557f, 0.688175976f},
-std::array<float,2>{0.895127058f, 0.368175447f},
-std::array<float,2>{0.380802214f, 0.464848608f},
-std::array<float,2>{0.818216443f, 0.528100193f},
-std::array<float,2>{0.0800182596f, 0.912192404f},
-std::array<float,2>{0.678274214f, 0.081586808f},
-std::array<float,2>{0.314740628f, 0.0448382162f},
-std::array<float,2>{0.954373538f, 0.94809252f},
-std::array<float,2>{0.185265943f, 0.595351696f},
-std::array<float,2>{0.592156827f, 0.390861154f},
-std::array<float,2>{0.0619355477f, 0.302361041f},
-std::array<float,2>{0.728028715f, 0.680369377f},
-std::array<float,2>{0.464432776f, 0.782812774f},
-std::array<float,2>{0.760692894f, 0.147876814f},
-std::array<float,2>{0.167054981f, 0.00382697303f},
-std::array<float,2>{0.569781244f, 0.983338773f},
-std::array<float,2>{0.336183965f, 0.575323462f},
-std::array<float,2>{0.942067444f, 0.409843355f},
-std::array<float,2>{0.442882031f, 0.27713713f},
-std::array<float,2>{0.769793332f, 0.65218854f},
-std::array<float,2>{0.0360693969f, 0.757384598f},
-std::array<float,2>{0.741820514f, 0.185852647f},
-std::array<float,2>{0.309352398f, 0.20285815f},
-std::array<float,2>{0.877913535f, 0.82261622f},
-std::array<float,2>{0.204938367f, 0.745565772f},
-std::array<float,2>{0.511500776f, 0.319853157f},
-std::array<float,2>{0.0642753914f, 0.484176904f},
-std::array<float,2>{0.666430593f, 0.542035282f},
-std::array<float,2>{0.40464431f, 0.904580951f},
-std::array<float,2>{0.840733945f, 0.121125333f},
-std::array<float,2>{0.0209942609f, 0.131189436f},
-std::array<float,2>{0.702132285f, 0.812040269f},
-std::array<float,2>{0.473556906f, 0.656623602f},
-std::array<float,2>{0.799165428f, 0.28421852f},
-std::array<float,2>{0.355382144f, 0.38248843f},
-std::array<float,2>{0.998970032f, 0.61119467f},
-std::array<float,2>{0.12688005f, 0.963445604f},
-std::array<float,2>{0.605500519f, 0.0592483133f},
-std::array<float,2>{0.407994479f, 0.0763680488f},
-std::array<float,2>{0.869798362f, 0.922028959f},
-std::array<float,2>{0.100995608f, 0.513682842f},
-std::array<float,2>{0.636554837f, 0.444504708f},
-std::array<float,2>{0.229520679f, 0.358609885f},
-std::array<float,2>{0.537088156f, 0.70784831f},
-std::array<float,2>{0.269950777f, 0.858489156f},
-std::array<float,2>{0.922845542f, 0.235810369f},
-std::array<float,2>{0.0406797193f, 0.0496895127f},
-std::array<float,2>{0.746122837f, 0.95584166f},
-std::array<float,2>{0.45193091f, 0.617227912f},
-std::array<float,2>{0.778402567f, 0.385047853f},
-std::array<float,2>{0.329081893f, 0.295756638f},
-std::array<float,2>{0.947601676f, 0.668383598f},
-std::array<float,2>{0.162165061f, 0.804070652f},
-std::array<float,2>{0.571078241f, 0.139777273f},
-std::array<float,2>{0.391417861f, 0.249546587f},
-std::array<float,2>{0.835199654f, 0.849959612f},
-std::array<float,2>{0.0738946646f, 0.711541116f},
-std::array<float,2>{0.656979382f, 0.35149166f},
-std::array<float,2>{0.211512148f, 0.451003462f},
-std::array<float,2>{0.504880965f, 0.505394161f},
-std::array<float,2>{0.300082654f, 0.937025309f},
-std::array<float,2>{0.889254212f, 0.0675710738f},
-std::array<float,2>{0.140404925f, 0.173403278f},
-std::array<float,2>{0.595549762f, 0.762720883f},
-std::array<float,2>{0.349670827f, 0.646580338f},
-std::array<float,2>{0.990711451f, 0.267693907f},
-std::array<float,2>{0.480021656f, 0.41987595f},
-std::array<float,2>{0.807160676f, 0.564952552f},
-std::array<float,2>{0.0240572412f, 0.971007764f},
-std::array<float,2>{0.687850893f, 0.0139865773f},
-std::array<float,2>{0.277116925f, 0.109867372f},
-std::array<float,2>{0.935826838f, 0.890682817f},
-std::array<float,2>{0.224769309f, 0.535434902f},
-std::array<float,2>{0.540944695f, 0.473379433f},
-std::array<float,2>{0.102844469f, 0.322056264f},
-std::array<float,2>{0.628017604f, 0.734692574f},
-std::array<float,2>{0.415531844f, 0.819456816f},
-std::array<float,2>{0.861976385f, 0.189616174f},
-std::array<float,2>{0.24991931f, 0.0868014246f},
-std::array<float,2>{0.55401361f, 0.916129589f},
-std::array<float,2>{0.258843005f, 0.520534933f},
-std::array<float,2>{0.919644713f, 0.460347712f},
-std::array<float,2>{0.434787482f, 0.362485796f},
-std::array<float,2>{0.858161211f, 0.701297522f},
-std::array<float,2>{0.119118363f, 0.867520988f},
-std::array<float,2>{0.649102032f, 0.221235037f},
-std::array<float,2>{0.360369265f, 0.15500012f},
-std::array<float,2>{0.974545538f, 0.790956616f},
-std::array<float,2>{0.145914555f, 0.673130393f},
-std::array<float,2>{0.61703378f, 0.305193186f},
-std::array<float,2>{0.00960743614f, 0.401630461f},
-std::array<float,2>{0.714129746f, 0.609221399f},
-std::array<float,2>{0.495080739f, 0.940094948f},
-std::array<float,2>{0.781947732f, 0.0325390287f},
-std::array<float,2>{0.0922947973f, 0.211681053f},
-std::array<float,2>{0.681690037f, 0.829895854f},
-std::array<float,2>{0.390028924f, 0.722719789f},
-std::array<float,2>{0.827581048f, 0.338497221f},
-std::array<float,2>{0.29472515f, 0.496970266f},
-std::array<float,2>{0.902778089f, 0.553656816f},
-std::array<float,2>{0.188057557f, 0.875005066f},
-std::array<float,2>{0.518313229f, 0.107532978f},
-std::array<float,2>{0.460500896f, 0.0236593727f},
-std::array<float,2>{0.752577841f, 0.988295615f},
-std::array<float,2>{0.0474075675f, 0.586204767f},
-std::array<float,2>{0.722582161f, 0.431428432f},
-std::array<float,2>{0.173975319f, 0.261981934f},
-std::array<float,2>{0.578727543f, 0.627692759f},
-std::array<float,2>{0.320658803f, 0.768059909f},
-std::array<float,2>{0.96265167f, 0.158923581f},
-std::array<float,2>{0.0770586506f, 0.0220775455f},
-std::array<float,2>{0.663443208f, 0.993122876f},
-std::array<float,2>{0.397399366f, 0.579017282f},
-std::array<float,2>{0.832019567f, 0.425394893f},
-std::array<float,2>{0.303533316f, 0.250577152f},
-std::array<float,2>{0.886267066f, 0.636813164f},
-std::array<float,2>{0.218608275f, 0.775253952f},
-std::array<float,2>{0.503871202f, 0.167853683f},
-std::array<float,2>{0.445904404f, 0.206773952f},
-std::array<float,2>{0.776510835f, 0.838415325f},
-std::array<float,2>{0.046479363f, 0.731397688f},
-std::array<float,2>{0.745517135f, 0.333367079f},
-std::array<float,2>{0.15960595f, 0.486129254f},
-std::array<float,2>{0.574373245f, 0.556900442f},
-std::array<float,2>{0.335741967f, 0.88369137f},
-std::array<float,2>{0.950078189f, 0.0951298401f},
-std::array<float,2>{0.221464604f, 0.142807692f},
-std::array<float,2>{0.546321929f, 0.786491334f},
-std::array<float,2>{0.278994888f, 0.687229931f},
-std::array<float,2>{0.931613564f, 0.300697297f},
-std::array<float,2>{0.418587267f, 0.397792786f},
-std::array<float,2>{0.864078104f, 0.598335207f},
-std::array<float,2>{0.106017478f, 0.950432003f},
-std::array<float,2>{0.631914854f, 0.0423397273f},
-std::array<float,2>{0.344637781f, 0.0853341743f},
-std::array<float,2>{0.986356974f, 0.909338653f},
-std::array<float,2>{0.13474904f, 0.526450396f},
-std::array<float,2>{0.600539029f, 0.462666512f},
-std::array<float,2>{0.0294583626f, 0.374607652f},
-std::array<float,2>{0.691933274f, 0.691759229f},
-std::array<float,2>{0.48375085f, 0.865663171f},
-std::array<float,2>{0.8116467f, 0.231310889f},
-std::array<float,2>{0.141120106f, 0.118709631f},
-std::array<float,2>{0.612003446f, 0.901104629f},
-std::array<float,2>{0.363606632f, 0.546083391f},
-std::array<float,2>{0.970558703f, 0.478295952f},
-std::array<float,2>{0.49921307f, 0.315123916f},
-std::array<float,2>{0.787211657f, 0.747202933f},
-std::array<float,2>{0.0122974822f, 0.827198923f},
-std::array<float,2>{0.717174709f, 0.198893443f},
-std::array<float,2>{0.263437927f, 0.18121928f},
-std::array<float,2>{0.916785598f, 0.752116501f},
-std::array<float,2>{0.242244467f, 0.656249046f},
-std::array<float,2>{0.549041092f, 0.278678566f},
-std::array<float,2>{0.124725573f, 0.410866112f},
-std::array<float,2>{0.65339601f, 0.57211715f},
-std::array<float,2>{0.432725847f, 0.978093505f},
-std::array<float,2>{0.854138732f, 0.00761674531f},
-std::array<float,2>{0.0510732904f, 0.240162537f},
-std::array<float,2>{0.723907053f, 0.852098048f},
-std::array<float,2>{0.456931114f, 0.704533398f},
-std::array<float,2>{0.754951775f, 0.353063554f},
-std::array<float,2>{0.324939132f, 0.440649956f},
-std::array<float,2>{0.967630506f, 0.50805974f},
-std::array<float,2>{0.17786257f, 0.928707123f},
-std::array<float,2>{0.584501207f, 0.0735257715f},
-std::array<float,2>{0.385527223f, 0.0572976544f},
-std::array<float,2>{0.821936488f, 0.96823138f},
-std::array<float,2>{0.0861993134f, 0.613331378f},
-std::array<float,2>{0.685459971f, 0.378125697f},
-std::array<float,2>{0.192458272f, 0.28622663f},
-std::array<float,2>{0.521120012f, 0.661236763f},
-std::array<float,2>{0.291223079f, 0.804887295f},
-std::array<float,2>{0.899128437f, 0.12776722f},
-std::array<float,2>{0.00522793131f, 0.0650651529f},
-std::array<float,2>{0.710352659f, 0.931952834f},
-std::array<float,2>{0.485474437f, 0.502141356f},
-std::array<float,2>{0.796209812f, 0.448582768f},
-std::array<float,2>{0.373479992f, 0.345828295f},
-std::array<float,2>{0.977729321f, 0.715581417f},
-std::array<float,2>{0.149894431f, 0.843962193f},
-std::array<float,2>{0.619165182f, 0.244127229f},
-std::array<float,2>{0.425079525f, 0.133779436f},
-std::array<float,2>{0.845825434f, 0.79828912f},
-std::array<float,2>{0.112865888f, 0.667262197f},
-std::array<float,2>{0.644422233f, 0.292320162f},
-std::array<float,2>{0.23686938f, 0.38788417f},
-std::array<float,2>{0.559539616f, 0.622221708f},
-std::array<float,2>{0.251863837f, 0.959156871f},
-std::array<float,2>{0.906757653f, 0.0534705408f},
-std::array<float,2>{0.181688592f, 0.192571387f},
-std::array<float,2>{0.586975515f, 0.815096974f},
-std::array<float,2>{0.317019045f, 0.741914392f},
-std::array<float,2>{0.959992468f, 0.327825576f},
-std::array<float,2>{0.467776477f, 0.468969196f},
-std::array<float,2>{0.762392998f, 0.531502366f},
-std::array<float,2>{0.055605039f, 0.898180723f},
-std::array<float,2>{0.730562508f, 0.113282681f},
-std::array<float,2>{0.283167154f, 0.0104928762f},
-std::array<float,2>{0.894467235f, 0.975403488f},
-std::array<float,2>{0.199087843f, 0.568541884f},
-std::array<float,2>{0.525600553f, 0.41753307f},
-std::array<float,2>{0.0856638029f, 0.27066347f},
-std::array<float,2>{0.672869265f, 0.642292798f},
-std::array<float,2>{0.376110494f, 0.761699259f},
-std::array<float,2>{0.812766433f, 0.176775932f},
-std::array<float,2>{0.208819613f, 0.0375895463f},
-std::array<float,2>{0.514243066f, 0.942500532f},
-std::array<float,2>{0.307412744f, 0.603747427f},
-std::array<float,2>{0.880444169f, 0.404789478f},
-std::array<float,2>{0.401996851f, 0.308631778f},
-std::array<float,2>{0.838846922f, 0.676181555f},
-std::array<float,2>{0.0700194314f, 0.796170831f},
-std::array<float,2>{0.66840893f, 0.148623824f},
-std::array<float,2>{0.340086758f, 0.226109877f},
-std::array<float,2>{0.939192414f, 0.874974132f},
-std::array<float,2>{0.17047213f, 0.695960641f},
-std::array<float,2>{0.566126525f, 0.364226758f},
-std::array<float,2>{0.0338772647f, 0.453941792f},
-std::array<float,2>{0.734420598f, 0.519510746f},
-std::array<float,2>{0.441163808f, 0.920171738f},
-std::array<float,2>{0.768925309f, 0.0918107629f},
-std::array<float,2>{0.0941368788f, 0.163852364f},
-std::array<float,2>{0.640512526f, 0.771416962f},
-std::array<float,2>{0.412919581f, 0.631035566f},
-std::array<float,2>{0.874520421f, 0.260087192f},
-std::array<float,2>{0.26568386f, 0.437322289f},
-std::array<float,2>{0.926139176f, 0.589889467f},
-std::array<float,2>{0.231736764f, 0.986012518f},
-std::array<float,2>{0.531486511f, 0.029957179f},
-std::array<float,2>{0.469847381f, 0.104524426f},
-std::array<float,2>{0.802461743f, 0.88175267f},
-std::array<float,2>{0.0163352657f, 0.547366738f},
-std::array<float,2>{0.698148668f, 0.495441347f},
-std::array<float,2>{0.132802948f, 0.340312243f},
-std::array<float,2>{0.603698909f, 0.719579875f},
-std::array<float,2>{0.357088953f, 0.835159957f},
-std::array<float,2>{0.995560348f, 0.218170702f},
-std::array<float,2>{0.0809236541f, 0.0788943917f},
-std::array<float,2>{0.676136792f, 0.911669612f},
-std::array<float,2>{0.381697744f, 0.529609263f},
-std::array<float,2>{0.818839848f, 0.468608946f},
-std::array<float,2>{0.288323939f, 0.370562434f},
-std::array<float,2>{0.897067606f, 0.690975547f},
-std::array<float,2>{0.200155631f, 0.862583935f},
-std::array<float,2>{0.530891299f, 0.230356425f},
-std::array<float,2>{0.462861866f, 0.14456293f},
-std::array<float,2>{0.759589732f, 0.784457266f},
-std::array<float,2>{0.0588437095f, 0.681871295f},
-std::array<float,2>{0.728939176f, 0.304047287f},
-std::array<float,2>{0.186643258f, 0.393854409f},
-std::array<float,2>{0.590824664f, 0.597219884f},
-std::array<float,2>{0.312827826f, 0.945323944f},
-std::array<float,2>{0.955339313f, 0.0456354171f},
-std::array<float,2>{0.240974456f, 0.208995789f},
-std::array<float,2>{0.555546582f, 0.842357457f},
-std::array<float,2>{0.256648302f, 0.727268755f},
-std::array<float,2>{0.910926282f, 0.331038088f},
-std::array<float,2>{0.427109987f, 0.48957631f},
-std::array<float,2>{0.849192619f, 0.561117589f},
-std::array<float,2>{0.11456953f, 0.889997125f},
-std::array<float,2>{0.645894945f, 0.0998834819f},
-std::array<float,2>{0.369626015f, 0.0183492396f},
-std::array<float,2>{0.984127343f, 0.997439325f},
-std::array<float,2>{0.154870659f, 0.583612382f},
-std::array<float,2>{0.623478949f, 0.427804798f},
-std::array<float,2>{0.00013616604f, 0.256290048f},
-std::array<float,2>{0.704041243f, 0.636095226f},
-std::array<float,2>{0.489757329f, 0.778801441f},
-std::array<float,2>{0.791044831f, 0.168976888f},
-std::array<float,2>{0.126983538f, 0.0613310486f},
-std::array<float,2>{0.607687116f, 0.961999655f},
-std::array<float,2>{0.352441996f, 0.612174451f},
-std::array<float,2>{0.997541547f, 0.379619896f},
-std::array<float,2>{0.475762695f, 0.282025814f},
-std::array<float,2>{0.797232568f, 0.660063624f},
-std::array<float,2>{0.0217970386f, 0.809553623f},
-std::array<float,2>{0.699939489f, 0.128943011f},
-std::array<float,2>{0.271738023f, 0.236817926f},
-std::array<float,2>{0.924521983f, 0.85604316f},
-std::array<float,2>{0.228020266f, 0.710047543f},
-std::array<float,2>{0.537801743f, 0.355972201f},
-std::array<float,2>{0.0976704434f, 0.441407502f},
-std::array<float,2>{0.634438038f, 0.511814296f},
-std::array<float,2>{0.408577353f, 0.925355315f},
-std::array<float,2>{0.868680775f, 0.0755535141f},
-std::array<float,2>{0.0388348997f, 0.183624476f},
-std::array<float,2>{0.738314092f, 0.754434049f},
-std::array<float,2>{0.444462627f, 0.649814785f},
-std::array<float,2>{0.771831334f, 0.273441732f},
-std::array<float,2>{0.339693815f, 0.406350136f},
-std::array<float,2>{0.94501698f, 0.576549947f},
-std::array<float,2>{0.164405808f, 0.980737627f},
-std::array<float,2>{0.567441225f, 0.000988230109f},
-std::array<float,2>{0.403267354f, 0.123347171f},
-std::array<float,2>{0.842229426f, 0.903767943f},
-std::array<float,2>{0.0653948411f, 0.540207148f},
-std::array<float,2>{0.665714562f, 0.48119092f},
-std::array<float,2>{0.206386462f, 0.318317413f},
-std::array<float,2>{0.509246767f, 0.742935658f},
-std::array<float,2>{0.311184198f, 0.820925057f},
-std::array<float,2>{0.875535011f, 0.20068723f},
-std::array<float,2>{0.0263439771f, 0.0130638201f},
-std::array<float,2>{0.690220416f, 0.969675541f},
-std::array<float,2>{0.478412479f, 0.563376307f},
-std::array<float,2>{0.806507051f, 0.42056787f},
-std::array<float,2>{0.349580914f, 0.26603657f},
-std::array<float,2>{0.989640534f, 0.645899534f},
-std::array<float,2>{0.137906075f, 0.763699412f},
-std::array<float,2>{0.597548068f, 0.174504608f},
-std::array<float,2>{0.41740036f, 0.188689843f},
-std::array<float,2>{0.86106354f, 0.818315625f},
-std::array<float,2>{0.104924493f, 0.737112105f},
-std::array<float,2>{0.626182318f, 0.323533148f},
-std::array<float,2>{0.223401919f, 0.476472914f},
-std::array<float,2>{0.542892277f, 0.537226558f},
-std::array<float,2>{0.274854124f, 0.894006908f},
-std::array<float,2>{0.934470654f, 0.111682817f},
-std::array<float,2>{0.161206007f, 0.138533115f},
-std::array<float,2>{0.574025214f, 0.802125275f},
-std::array<float,2>{0.331861109f, 0.670656204f},
-std::array<float,2>{0.946056604f, 0.293720931f},
-std::array<float,2>{0.449364364f, 0.384497166f},
-std::array<float,2>{0.779313505f, 0.621049166f},
-std::array<float,2>{0.0427297987f, 0.953897119f},
-std::array<float,2>{0.748528004f, 0.0468915701f},
-std::array<float,2>{0.29868865f, 0.0696371868f},
-std::array<float,2>{0.886798739f, 0.933678567f},
-std::array<float,2>{0.213160887f, 0.50749743f},
-std::array<float,2>{0.507627666f, 0.452332646f},
-std::array<float,2>{0.0721488744f, 0.348179728f},
-std::array<float,2>{0.659329295f, 0.714639902f},
-std::array<float,2>{0.394212931f, 0.848321378f},
-std::array<float,2>{0.833235323f, 0.247173175f},
-std::array<float,2>{0.19047758f, 0.106361412f},
-std::array<float,2>{0.516102314f, 0.878816247f},
-std::array<float,2>{0.296848953f, 0.552644908f},
-std::array<float,2>{0.905755877f, 0.499397635f},
-std::array<float,2>{0.387645721f, 0.335985124f},
-std::array<float,2>{0.824785411f, 0.726306558f},
-std::array<float,2>{0.0900689811f, 0.830968678f},
-std::array<float,2>{0.680470288f, 0.213344723f},
-std::array<float,2>{0.323279768f, 0.157548681f},
-std::array<float,2>{0.963130713f, 0.765837848f},
-std::array<float,2>{0.173503205f, 0.62501502f},
-std::array<float,2>{0.581282139f, 0.265488803f},
-std::array<float,2>{0.0493624471f, 0.431923807f},
-std::array<float,2>{0.720282376f, 0.587987483f},
-std::array<float,2>{0.458419353f, 0.992151082f},
-std::array<float,2>{0.751026809f, 0.0262243282f},
-std::array<float,2>{0.119238734f, 0.21975629f},
-std::array<float,2>{0.651507318f, 0.869642258f},
-std::array<float,2>{0.436953336f, 0.699305415f},
-std::array<float,2>{0.856967688f, 0.361005813f},
-std::array<float,2>{0.260736793f, 0.458937138f},
-std::array<float,2>{0.921548128f, 0.522862792f},
-std::array<float,2>{0.246269718f, 0.914585471f},
-std::array<float,2>{0.552574992f, 0.0893141776f},
-std::array<float,2>{0.493849784f, 0.0344408602f},
-std::array<float,2>{0.784840763f, 0.938532233f},
-std::array<float,2>{0.0111626126f, 0.606639206f},
-std::array<float,2>{0.712857425f, 0.398674548f},
-std::array<float,2>{0.147371009f, 0.307612479f},
-std::array<float,2>{0.614050031f, 0.675365686f},
-std::array<float,2>{0.362263858f, 0.792475343f},
-std::array<float,2>{0.975884616f, 0.153970808f},
-std::array<float,2>{0.107755236f, 0.0401532687f},
-std::array<float,2>{0.629544675f, 0.951790273f},
-std::array<float,2>{0.421535075f, 0.600675106f},
-std::array<float,2>{0.866074622f, 0.396164984f},
-std::array<float,2>{0.28021425f, 0.297751099f},
-std::array<float,2>{0.933225334f, 0.684353769f},
-std::array<float,2>{0.218967512f, 0.787977934f},
-std::array<float,2>{0.544474244f, 0.142305806f},
-std::array<float,2>{0.481602669f, 0.234138578f},
-std::array<float,2>{0.809455454f, 0.864544094f},
-std::array<float,2>{0.0278912354f, 0.694898427f},
-std::array<float,2>{0.693474233f, 0.372114539f},
-std::array<float,2>{0.135613546f, 0.463404953f},
-std::array<float,2>{0.597893417f, 0.524991691f},
-std::array<float,2>{0.346010536f, 0.906476259f},
-std::array<float,2>{0.985377014f, 0.0823253468f},
-std::array<float,2>{0.216185346f, 0.164362758f},
-std::array<float,2>{0.50071609f, 0.777286291f},
-std::array<float,2>{0.302684724f, 0.640317261f},
-std::array<float,2>{0.883916616f, 0.252974659f},
-std::array<float,2>{0.395477772f, 0.423797369f},
-std::array<float,2>{0.828673959f, 0.58117646f},
-std::array<float,2>{0.074310407f, 0.995442927f},
-std::array<float,2>{0.660174549f, 0.0196800716f},
-std::array<float,2>{0.332589716f, 0.0967796221f},
-std::array<float,2>{0.952118993f, 0.885931909f},
-std::array<float,2>{0.158066303f, 0.556145549f},
-std::array<float,2>{0.577946544f, 0.487886071f},
-std::array<float,2>{0.0438991375f, 0.334139168f},
-std::array<float,2>{0.743063927f, 0.733854413f},
-std::array<float,2>{0.448850363f, 0.83712399f},
-std::array<float,2>{0.775311589f, 0.204619497f},
-std::array<float,2>{0.176445171f, 0.0714655221f},
-std::array<float,2>{0.582761407f, 0.927402079f},
-std::array<float,2>{0.326717615f, 0.510873437f},
-std::array<float,2>{0.964936793f, 0.438443452f},
-std::array<float,2>{0.453612775f, 0.354479551f},
-std::array<float,2>{0.757013738f, 0.705458641f},
-std::array<float,2>{0.0530769899f, 0.853738427f},
-std::array<float,2>{0.724805772f, 0.241935313f},
-std::array<float,2>{0.28934145f, 0.1252262f},
-std::array<float,2>{0.901338458f, 0.808172226f},
-std::array<float,2>{0.194646969f, 0.662447453f},
-std::array<float,2>{0.521963298f, 0.28713578f},
-std::array<float,2>{0.0881454945f, 0.376731783f},
-std::array<float,2>{0.687425017f, 0.61634624f},
-std::array<float,2>{0.383910179f, 0.965566278f},
-std::array<float,2>{0.823657036f, 0.0561328158f},
-std::array<float,2>{0.0137153398f, 0.196625397f},
-std::array<float,2>{0.714996457f, 0.825251102f},
-std::array<float,2>{0.497015834f, 0.748896658f},
-std::array<float,2>{0.78520906f, 0.312634081f},
-std::array<float,2>{0.366079867f, 0.478883386f},
-std::array<float,2>{0.972503543f, 0.544341922f},
-std::array<float,2>{0.144458577f, 0.899114251f},
-std::array<float,2>{0.610380292f, 0.12017972f},
-std::array<float,2>{0.430229783f, 0.00513564516f},
-std::array<float,2>{0.85189265f, 0.97973603f},
-std::array<float,2>{0.122206002f, 0.572850883f},
-std::array<float,2>{0.654873729f, 0.413609743f},
-std::array<float,2>{0.244845033f, 0.280161679f},
-std::array<float,2>{0.547282815f, 0.653178632f},
-std::array<float,2>{0.263761401f, 0.750615716f},
-std::array<float,2>{0.914904892f, 0.182131439f},
-std::array<float,2>{0.0584811158f, 0.11684604f},
-std::array<float,2>{0.733038902f, 0.895897031f},
-std::array<float,2>{0.466776878f, 0.533438981f},
-std::array<float,2>{0.764909744f, 0.471654207f},
-std::array<float,2>{0.319609016f, 0.325056165f},
-std::array<float,2>{0.957223058f, 0.738772631f},
-std::array<float,2>{0.181462839f, 0.813958168f},
-std::array<float,2>{0.588864028f, 0.193561673f},
-std::array<float,2>{0.37746799f, 0.178428665f},
-std::array<float,2>{0.815130055f, 0.758809984f},
-std::array<float,2>{0.0839065537f, 0.644384146f},
-std::array<float,2>{0.674654603f, 0.272649765f},
-std::array<float,2>{0.197035328f, 0.414319187f},
-std::array<float,2>{0.525072575f, 0.568145931f},
-std::array<float,2>{0.284648955f, 0.974515736f},
-std::array<float,2>{0.890749156f, 0.00851774216f},
-std::array<float,2>{0.151058227f, 0.245202273f},
-std::array<float,2>{0.617367446f, 0.846763909f},
-std::array<float,2>{0.371400476f, 0.71702987f},
-std::array<float,2>{0.980037153f, 0.345433831f},
-std::array<float,2>{0.488264084f, 0.446825922f},
-std::array<float,2>{0.793360949f, 0.501853287f},
-std::array<float,2>{0.00757894246f, 0.930026948f},
-std::array<float,2>{0.707202196f, 0.0638077855f},
-std::array<float,2>{0.253769726f, 0.0512791947f},
-std::array<float,2>{0.909852862f, 0.958580256f},
-std::array<float,2>{0.235620484f, 0.624274313f},
-std::array<float,2>{0.562438369f, 0.390412062f},
-std::array<float,2>{0.109948196f, 0.289687514f},
-std::array<float,2>{0.642003f, 0.664218724f},
-std::array<float,2>{0.422462761f, 0.799095273f},
-std::array<float,2>{0.844803751f, 0.13645488f},
-std::array<float,2>{0.232891217f, 0.0290559568f},
-std::array<float,2>{0.533474207f, 0.986764014f},
-std::array<float,2>{0.267660439f, 0.593088806f},
-std::array<float,2>{0.928814471f, 0.434867531f},
-std::array<float,2>{0.410371482f, 0.258452386f},
-std::array<float,2>{0.872550189f, 0.630054533f},
-std::array<float,2>{0.0958056599f, 0.772981286f},
-std::array<float,2>{0.637693942f, 0.1620529f},
-std::array<float,2>{0.358038932f, 0.215098813f},
-std::array<float,2>{0.992904603f, 0.832957506f},
-std::array<float,2>{0.130230203f, 0.721556008f},
-std::array<float,2>{0.6032812f, 0.341906965f},
-std::array<float,2>{0.0190956946f, 0.492392689f},
-std::array<float,2>{0.697187066f, 0.549674332f},
-std::array<float,2>{0.4713884f, 0.879107535f},
-std::array<float,2>{0.804306924f, 0.103267476f},
-std::array<float,2>{0.0683226585f, 0.150783181f},
-std::array<float,2>{0.671785355f, 0.79461807f},
-std::array<float,2>{0.399624079f, 0.679079473f},
-std::array<float,2>{0.837504685f, 0.311180681f},
-std::array<float,2>{0.304862797f, 0.403050303f},
-std::array<float,2>{0.880910397f, 0.603267789f},
-std::array<float,2>{0.209709197f, 0.943860352f},
-std::array<float,2>{0.511907697f, 0.036479257f},
-std::array<float,2>{0.438763052f, 0.0903140008f},
-std::array<float,2>{0.767441571f, 0.91829896f},
-std::array<float,2>{0.0327744409f, 0.51664257f},
-std::array<float,2>{0.737623334f, 0.45592159f},
-std::array<float,2>{0.169133246f, 0.366116911f},
-std::array<float,2>{0.564399838f, 0.699202657f},
-std::array<float,2>{0.343561351f, 0.87187916f},
-std::array<float,2>{0.941154778f, 0.223476216f},
-std::array<float,2>{0.0997007117f, 0.0749041438f},
-std::array<float,2>{0.635382295f, 0.924694836f},
-std::array<float,2>{0.406287938f, 0.512710989f},
-std::array<float,2>{0.870142937f, 0.442722797f},
-std::array<float,2>{0.270643413f, 0.357010871f},
-std::array<float,2>{0.922887981f, 0.709314406f},
-std::array<float,2>{0.229324386f, 0.857305527f},
-std::array<float,2>{0.535758734f, 0.237560943f},
-std::array<float,2>{0.473734081f, 0.129968047f},
-std::array<float,2>{0.799942136f, 0.809808135f},
-std::array<float,2>{0.0196823049f, 0.659014523f},
-std::array<float,2>{0.7027511f, 0.282752573f},
-std::array<float,2>{0.125123516f, 0.379891783f},
-std::array<float,2>{0.606674135f, 0.612636089f},
-std::array<float,2>{0.354458749f, 0.961187601f},
-std::array<float,2>{0.999524295f, 0.0617915951f},
-std::array<float,2>{0.20351018f, 0.199351117f},
-std::array<float,2>{0.51067996f, 0.821577847f},
-std::array<float,2>{0.309957266f, 0.743658483f},
-std::array<float,2>{0.878767252f, 0.31673792f},
-std::array<float,2>{0.405393958f, 0.482006371f},
-std::array<float,2>{0.841166854f, 0.539523005f},
-std::array<float,2>{0.063135609f, 0.902391851f},
-std::array<float,2>{0.667122543f, 0.124588668f},
-std::array<float,2>{0.337282836f, 0.00079032575f},
-std::array<float,2>{0.942396104f, 0.981951237f},
-std::array<float,2>{0.166909873f, 0.577813566f},
-std::array<float,2>{0.568614721f, 0.40739435f},
-std::array<float,2>{0.0364730358f, 0.27462104f},
-std::array<float,2>{0.740414619f, 0.648468375f},
-std::array<float,2>{0.441989988f, 0.755207479f},
-std::array<float,2>{0.770807624f, 0.184847474f},
-std::array<float,2>{0.184056327f, 0.0461166464f},
-std::array<float,2>{0.593091071f, 0.946367741f},
-std::array<float,2>{0.315708846f, 0.596168756f},
-std::array<float,2>{0.953169703f, 0.393506885f},
-std::array<float,2>{0.463527441f, 0.303445369f},
-std::array<float,2>{0.761589587f, 0.683378041f},
-std::array<float,2>{0.0612038821f, 0.78349483f},
-std::array<float,2>{0.72734803f, 0.145849317f},
-std::array<float,2>{0.286930799f, 0.229254782f},
-std::array<float,2>{0.895596445f, 0.862111688f},
-std::array<float,2>{0.202728823f, 0.689569712f},
-std::array<float,2>{0.527796149f, 0.369659334f},
-std::array<float,2>{0.0782333836f, 0.466966897f},
-std::array<float,2>{0.679121733f, 0.530918956f},
-std::array<float,2>{0.379448235f, 0.911058962f},
-std::array<float,2>{0.816862822f, 0.0795339346f},
-std::array<float,2>{0.00257342774f, 0.168501407f},
-std::array<float,2>{0.706380129f, 0.777718604f},
-std::array<float,2>{0.490529329f, 0.635383785f},
-std::array<float,2>{0.79096806f, 0.257357359f},
-std::array<float,2>{0.368502438f, 0.429409713f},
-std::array<float,2>{0.981248319f, 0.582781553f},
-std::array<float,2>{0.153601035f, 0.996991038f},
-std::array<float,2>{0.621818423f, 0.0188440327f},
-std::array<float,2>{0.429499686f, 0.101361826f},
-std::array<float,2>{0.850075781f, 0.889552355f},
-std::array<float,2>{0.116247915f, 0.561579227f},
-std::array<float,2>{0.648395538f, 0.488456398f},
-std::array<float,2>{0.238506019f, 0.331496418f},
-std::array<float,2>{0.558127463f, 0.728429317f},
-std::array<float,2>{0.255534142f, 0.843710124f},
-std::array<float,2>{0.912642479f, 0.210623428f},
-std::array<float,2>{0.0481091142f, 0.0269635711f},
-std::array<float,2>{0.721532226f, 0.990300596f},
-std::array<float,2>{0.459017456f, 0.589693606f},
-std::array<float,2>{0.753339589f, 0.43328011f},
-std::array<float,2>{0.321709245f, 0.264354229f},
-std::array<float,2>{0.961750329f, 0.626370609f},
-std::array<float,2>{0.175687775f, 0.767462373f},
-std::array<float,2>{0.579311132f, 0.157101542f},
-std::array<float,2>{0.388843536f, 0.213939264f},
-std::array<float,2>{0.827085495f, 0.831358731f},
-std::array<float,2>{0.0928556994f, 0.724896014f},
-std::array<float,2>{0.683250308f, 0.337394536f},
-std::array<float,2>{0.189232513f, 0.498248756f},
-std::array<float,2>{0.518900752f, 0.551359236f},
-std::array<float,2>{0.293599337f, 0.877562463f},
-std::array<float,2>{0.90380466f, 0.107346721f},
-std::array<float,2>{0.144546852f, 0.153160423f},
-std::array<float,2>{0.615349114f, 0.791448772f},
-std::array<float,2>{0.359473795f, 0.674719393f},
-std::array<float,2>{0.97358346f, 0.308091879f},
-std::array<float,2>{0.496044308f, 0.399708688f},
-std::array<float,2>{0.782535374f, 0.60556972f},
-std::array<float,2>{0.00815251097f, 0.937753797f},
-std::array<float,2>{0.713708818f, 0.0332775526f},
-std::array<float,2>{0.258703113f, 0.0881606266f},
-std::array<float,2>{0.918309987f, 0.915748f},
-std::array<float,2>{0.248322368f, 0.522148967f},
-std::array<float,2>{0.552795589f, 0.457381994f},
-std::array<float,2>{0.11730168f, 0.359457552f},
-std::array<float,2>{0.649767637f, 0.700648189f},
-std::array<float,2>{0.433980376f, 0.870358467f},
-std::array<float,2>{0.859032929f, 0.218819857f},
-std::array<float,2>{0.225849897f, 0.112897292f},
-std::array<float,2>{0.539948285f, 0.892893732f},
-std::array<float,2>{0.275681436f, 0.538256407f},
-std::array<float,2>{0.936796665f, 0.475490004f},
-std::array<float,2>{0.414358139f, 0.323197782f},
-std::array<float,2>{0.862816155f, 0.737477779f},
-std::array<float,2>{0.102067493f, 0.817060232f},
-std::array<float,2>{0.627341568f, 0.188140199f},
-std::array<float,2>{0.351094246f, 0.175079688f},
-std::array<float,2>{0.991409302f, 0.765001118f},
-std::array<float,2>{0.139499471f, 0.645150244f},
-std::array<float,2>{0.594454467f, 0.266681284f},
-std::array<float,2>{0.0249482114f, 0.421332538f},
-std::array<float,2>{0.688903987f, 0.564353406f},
-std::array<float,2>{0.478999823f, 0.970098138f},
-std::array<float,2>{0.807654917f, 0.0117244758f},
-std::array<float,2>{0.0727224201f, 0.246956244f},
-std::array<float,2>{0.657981455f, 0.848901093f},
-std::array<float,2>{0.392248243f, 0.713274002f},
-std::array<float,2>{0.834929109f, 0.348954469f},
-std::array<float,2>{0.299190134f, 0.451304972f},
-std::array<float,2>{0.890015304f, 0.505984128f},
-std::array<float,2>{0.212709144f, 0.93475157f},
-std::array<float,2>{0.505516112f, 0.0683998391f},
-std::array<float,2>{0.452736676f, 0.048499994f},
-std::array<float,2>{0.77804023f, 0.95506376f},
-std::array<float,2>{0.0397167653f, 0.619256318f},
-std::array<float,2>{0.747571886f, 0.383431643f},
-std::array<float,2>{0.163760319f, 0.294329226f},
-std::array<float,2>{0.571885288f, 0.670925558f},
-std::array<float,2>{0.329734445f, 0.800874829f},
-std::array<float,2>{0.948679745f, 0.136925966f},
-std::array<float,2>{0.0870746002f, 0.0555032752f},
-std::array<float,2>{0.68392545f, 0.966201961f},
-std::array<float,2>{0.38670975f, 0.615392506f},
-std::array<float,2>{0.820417702f, 0.375807315f},
-std::array<float,2>{0.292791992f, 0.288887143f},
-std::array<float,2>{0.899819911f, 0.663585603f},
-std::array<float,2>{0.191923961f, 0.807243049f},
-std::array<float,2>{0.519942701f, 0.126722842f},
-std::array<float,2>{0.455383033f, 0.240754724f},
-std::array<float,2>{0.754735291f, 0.855240107f},
-std::array<float,2>{0.051954966f, 0.706809819f},
-std::array<float,2>{0.7233724f, 0.355021536f},
-std::array<float,2>{0.17960307f, 0.439409435f},
-std::array<float,2>{0.585848987f, 0.509772122f},
-std::array<float,2>{0.325727165f, 0.92645061f},
-std::array<float,2>{0.967812479f, 0.0710281357f},
-std::array<float,2>{0.243804514f, 0.183572352f},
-std::array<float,2>{0.550759733f, 0.751201034f},
-std::array<float,2>{0.26257357f, 0.653730214f},
-std::array<float,2>{0.917559266f, 0.280635625f},
-std::array<float,2>{0.431641787f, 0.412121832f},
-std::array<float,2>{0.85497725f, 0.573753297f},
-std::array<float,2>{0.123131111f, 0.978659034f},
-std::array<float,2>{0.652453721f, 0.00416932162f},
-std::array<float,2>{0.364676654f, 0.119611077f},
-std::array<float,2>{0.969436705f, 0.899817348f},
-std::array<float,2>{0.141679987f, 0.543408036f},
-std::array<float,2>{0.612821281f, 0.479968816f},
-std::array<float,2>{0.0128868464f, 0.31388402f},
-std::array<float,2>{0.718088984f, 0.749611378f},
-std::array<float,2>{0.498860091f, 0.825059295f},
-std::array<float,2>{0.788979411f, 0.195401415f},
-std::array<float,2>{0.133674324f, 0.0834065601f},
-std::array<float,2>{0.600763738f, 0.907639444f},
-std::array<float,2>{0.345555186f, 0.524232686f},
-std::array<float,2>{0.987590134f, 0.464105278f},
-std::array<float,2>{0.482572228f, 0.371659636f},
-std::array<float,2>{0.810799479f, 0.694043994f},
-std::array<float,2>{0.0305213649f, 0.863947272f},
-std::array<float,2>{0.693014741f, 0.232867554f},
-std::array<float,2>{0.277746737f, 0.141092032f},
-std::array<float,2>{0.929995f, 0.789016604f},
-std::array<float,2>{0.222171143f, 0.685187638f},
-std::array<float,2>{0.545865357f, 0.297926903f},
-std::array<float,2>{0.107124396f, 0.394826382f},
-std::array<float,2>{0.631698072f, 0.599801123f},
-std::array<float,2>{0.419276595f, 0.95263654f},
-std::array<float,2>{0.864962995f, 0.0394729301f},
-std::array<float,2>{0.0450475253f, 0.203352779f},
-std::array<float,2>{0.744855225f, 0.83605212f},
-std::array<float,2>{0.446976095f, 0.733011901f},
-std::array<float,2>{0.776161492f, 0.335478753f},
-std::array<float,2>{0.33421725f, 0.487231821f},
-std::array<float,2>{0.95095104f, 0.55534184f},
-std::array<float,2>{0.159061491f, 0.885392427f},
-std::array<float,2>{0.575340211f, 0.0966155902f},
-std::array<float,2>{0.398052424f, 0.0211734548f},
-std::array<float,2>{0.830766916f, 0.994357765f},
-std::array<float,2>{0.0773718432f, 0.581032634f},
-std::array<float,2>{0.662256658f, 0.422181249f},
-std::array<float,2>{0.217369676f, 0.252804935f},
-std::array<float,2>{0.502090394f, 0.638938367f},
-std::array<float,2>{0.30383727f, 0.775743365f},
-std::array<float,2>{0.884960651f, 0.165508419f},
-std::array<float,2>{0.0174533501f, 0.102017462f},
-std::array<float,2>{0.698928297f, 0.879888535f},
-std::array<float,2>{0.46915859f, 0.550779939f},
-std::array<float,2>{0.801555514f, 0.493751019f},
-std::array<float,2>{0.356380463f, 0.342892915f},
-std::array<float,2>{0.994190633f, 0.722183883f},
-std::array<float,2>{0.131348774f, 0.833888948f},
-std::array<float,2>{0.605422497f, 0.216599435f},
-std::array<float,2>{0.413863212f, 0.160958856f},
-std::array<float,2>{0.873069644f, 0.771886587f},
-std::array<float,2>{0.0956143364f, 0.629349291f},
-std::array<float,2>{0.63906008f, 0.259380311f},
-std::array<float,2>{0.231104448f, 0.434505075f},
-std::array<float,2>{0.532302678f, 0.592183411f},
-std::array<float,2>{0.266783893f, 0.987355947f},
-std::array<float,2>{0.927376449f, 0.0274986532f},
-std::array<float,2>{0.171602502f, 0.223812878f},
-std::array<float,2>{0.565160394f, 0.872077763f},
-std::array<float,2>{0.340975285f, 0.698039293f},
-std::array<float,2>{0.938329816f, 0.367130697f},
-std::array<float,2>{0.439771712f, 0.45679006f},
-std::array<float,2>{0.767880917f, 0.515926957f},
-std::array<float,2>{0.0346341766f, 0.919330597f},
-std::array<float,2>{0.735565841f, 0.091230914f},
-std::array<float,2>{0.307729065f, 0.0354623683f},
-std::array<float,2>{0.87980938f, 0.944442093f},
-std::array<float,2>{0.207400605f, 0.602250278f},
-std::array<float,2>{0.514811158f, 0.403334409f},
-std::array<float,2>{0.0686492175f, 0.312321395f},
-std::array<float,2>{0.669476569f, 0.677979052f},
-std::array<float,2>{0.400496989f, 0.79382962f},
-std::array<float,2>{0.839042902f, 0.152134389f},
-std::array<float,2>{0.197743461f, 0.00892281532f},
-std::array<float,2>{0.526414692f, 0.973069131f},
-std::array<float,2>{0.281607836f, 0.566439331f},
-std::array<float,2>{0.892781675f, 0.415967613f},
-std::array<float,2>{0.375852078f, 0.272309214f},
-std::array<float,2>{0.814365566f, 0.643247128f},
-std::array<float,2>{0.0845580772f, 0.758278191f},
-std::array<float,2>{0.672590971f, 0.179513007f},
-std::array<float,2>{0.317985624f, 0.195304498f},
-std::array<float,2>{0.959411681f, 0.813396454f},
-std::array<float,2>{0.182762608f, 0.739422083f},
-std::array<float,2>{0.586349905f, 0.326163828f},
-std::array<float,2>{0.056562975f, 0.472185612f},
-std::array<float,2>{0.732384443f, 0.53444308f},
-std::array<float,2>{0.467302173f, 0.895035326f},
-std::array<float,2>{0.763249755f, 0.115828268f},
-std::array<float,2>{0.111355536f, 0.135723785f},
-std::array<float,2>{0.642645359f, 0.8004179f},
-std::array<float,2>{0.424714327f, 0.665289164f},
-std::array<float,2>{0.846916378f, 0.290757358f},
-std::array<float,2>{0.250533342f, 0.389336675f},
-std::array<float,2>{0.907663822f, 0.62367177f},
-std::array<float,2>{0.237898156f, 0.9579193f},
-std::array<float,2>{0.559761882f, 0.0526854545f},
-std::array<float,2>{0.484798789f, 0.0626410544f},
-std::array<float,2>{0.795714438f, 0.931084871f},
-std::array<float,2>{0.00457315706f, 0.500759006f},
-std::array<float,2>{0.709067464f, 0.44626537f},
-std::array<float,2>{0.148672819f, 0.344243914f},
-std::array<float,2>{0.620920777f, 0.718735158f},
-std::array<float,2>{0.374562591f, 0.846467674f},
-std::array<float,2>{0.977025926f, 0.244904727f},
-std::array<float,2>{0.06558045f, 0.122559346f},
-std::array<float,2>{0.664281726f, 0.905701876f},
-std::array<float,2>{0.40383777f, 0.541494787f},
-std::array<float,2>{0.843678713f, 0.483359218f},
-std::array<float,2>{0.312045008f, 0.318412393f},
-std::array<float,2>{0.876792729f, 0.745009601f},
-std::array<float,2>{0.205960602f, 0.824080884f},
-std::array<float,2>{0.508383155f, 0.201572493f},
-std::array<float,2>{0.444184214f, 0.187006369f},
-std::array<float,2>{0.773433089f, 0.756281853f},
-std::array<float,2>{0.0379565917f, 0.65133214f},
-std::array<float,2>{0.739748955f, 0.276206911f},
-std::array<float,2>{0.165915623f, 0.408758998f},
-std::array<float,2>{0.566914201f, 0.575097561f},
-std::array<float,2>{0.3386904f, 0.984236062f},
-std::array<float,2>{0.944054067f, 0.0025165875f},
-std::array<float,2>{0.227259278f, 0.234581545f},
-std::array<float,2>{0.538145423f, 0.857690334f},
-std::array<float,2>{0.272677958f, 0.708828986f},
-std::array<float,2>{0.925470114f, 0.357969671f},
-std::array<float,2>{0.40946275f, 0.44401139f},
-std::array<float,2>{0.867995441f, 0.515355527f},
-std::array<float,2>{0.0995187908f, 0.923651397f},
-std::array<float,2>{0.63298142f, 0.077392891f},
-std::array<float,2>{0.352704644f, 0.0601894222f},
-std::array<float,2>{0.996829033f, 0.964651823f},
-std::array<float,2>{0.128076732f, 0.610077262f},
-std::array<float,2>{0.608631432f, 0.38127774f},
-std::array<float,2>{0.0232654065f, 0.283892959f},
-std::array<float,2>{0.700574398f, 0.657873034f},
-std::array<float,2>{0.475071877f, 0.810593963f},
-std::array<float,2>{0.798218846f, 0.131883711f},
-std::array<float,2>{0.155596241f, 0.0161186624f},
-std::array<float,2>{0.624639273f, 0.999914587f},
-std::array<float,2>{0.370505452f, 0.585012555f},
-std::array<float,2>{0.983295619f, 0.427184492f},
-std::array<float,2>{0.488965005f, 0.253958881f},
-std::array<float,2>{0.792826056f, 0.633859813f},
-std::array<float,2>{0.00189768581f, 0.780556977f},
-std::array<float,2>{0.704304099f, 0.17159012f},
-std::array<float,2>{0.257792026f, 0.208326951f},
-std::array<float,2>{0.91134268f, 0.84064728f},
-std::array<float,2>{0.241820604f, 0.728847623f},
-std::array<float,2>{0.555711806f, 0.329661787f},
-std::array<float,2>{0.114204884f, 0.491533488f},
-std::array<float,2>{0.644799352f, 0.559269607f},
-std::array<float,2>{0.426178128f, 0.888210773f},
-std::array<float,2>{0.847910166f, 0.0991371498f},
-std::array<float,2>{0.0604389198f, 0.146827579f},
-std::array<float,2>{0.730113685f, 0.782205701f},
-std::array<float,2>{0.461734623f, 0.68076098f},
-std::array<float,2>{0.758132339f, 0.300806522f},
-std::array<float,2>{0.313606083f, 0.392537475f},
-std::array<float,2>{0.956934035f, 0.593868136f},
-std::array<float,2>{0.185984254f, 0.94856602f},
-std::array<float,2>{0.590628505f, 0.0434863009f},
-std::array<float,2>{0.382483542f, 0.0810339078f},
-std::array<float,2>{0.819366395f, 0.913981616f},
-std::array<float,2>{0.0815623477f, 0.52876389f},
-std::array<float,2>{0.677084684f, 0.466775358f},
-std::array<float,2>{0.200267822f, 0.368121535f},
-std::array<float,2>{0.529397428f, 0.688826025f},
-std::array<float,2>{0.287946016f, 0.860290945f},
-std::array<float,2>{0.897484362f, 0.227527529f},
-std::array<float,2>{0.0102263158f, 0.0314554572f},
-std::array<float,2>{0.711716712f, 0.940911829f},
-std::array<float,2>{0.492715448f, 0.607714236f},
-std::array<float,2>{0.783657849f, 0.40132153f},
-std::array<float,2>{0.362474114f, 0.305726647f},
-std::array<float,2>{0.974879444f, 0.672817409f},
-std::array<float,2>{0.148039147f, 0.7892344f},
-std::array<float,2>{0.614967823f, 0.155614004f},
-std::array<float,2>{0.436452836f, 0.221686155f},
-std::array<float,2>{0.856099367f, 0.868596554f},
-std::array<float,2>{0.120819323f, 0.702446699f},
-std::array<float,2>{0.650787711f, 0.361570567f},
-std::array<float,2>{0.247351035f, 0.459822178f},
-std::array<float,2>{0.551414251f, 0.51972723f},
-std::array<float,2>{0.261658877f, 0.917494297f},
-std::array<float,2>{0.920807242f, 0.0876777992f},
-std::array<float,2>{0.172713146f, 0.159635752f},
-std::array<float,2>{0.580565751f, 0.768575668f},
-std::array<float,2>{0.323197752f, 0.628092945f},
-std::array<float,2>{0.964385033f, 0.263163f},
-std::array<float,2>{0.457561284f, 0.429823041f},
-std::array<float,2>{0.750143528f, 0.587823093f},
-std::array<float,2>{0.0507592969f, 0.989578962f},
-std::array<float,2>{0.719549298f, 0.025275182f},
-std::array<float,2>{0.295697093f, 0.109005965f},
-std::array<float,2>{0.904371917f, 0.876695693f},
-std::array<float,2>{0.19024992f, 0.554208755f},
-std::array<float,2>{0.51719594f, 0.49745068f},
-std::array<float,2>{0.0908944979f, 0.338899672f},
-std::array<float,2>{0.680939317f, 0.72450465f},
-std::array<float,2>{0.388501376f, 0.828291655f},
-std::array<float,2>{0.82546252f, 0.212834403f},
-std::array<float,2>{0.214119211f, 0.0667899549f},
-std::array<float,2>{0.506414175f, 0.936289549f},
-std::array<float,2>{0.296898544f, 0.504386842f},
-std::array<float,2>{0.888635516f, 0.450103343f},
-std::array<float,2>{0.392601788f, 0.350265294f},
-std::array<float,2>{0.832671106f, 0.712295532f},
-std::array<float,2>{0.0704157129f, 0.851252556f},
-std::array<float,2>{0.658893704f, 0.248358801f},
-std::array<float,2>{0.330827475f, 0.138927832f},
-std::array<float,2>{0.946511269f, 0.803374708f},
-std::array<float,2>{0.16056928f, 0.669260561f},
-std::array<float,2>{0.572838545f, 0.296646476f},
-std::array<float,2>{0.0412401669f, 0.386068374f},
-std::array<float,2>{0.749205053f, 0.618178129f},
-std::array<float,2>{0.450934649f, 0.956132531f},
-std::array<float,2>{0.780963957f, 0.0503804386f},
-std::array<float,2>{0.104358681f, 0.190919802f},
-std::array<float,2>{0.625502586f, 0.818836391f},
-std::array<float,2>{0.416120172f, 0.7353971f},
-std::array<float,2>{0.860209882f, 0.32126084f},
-std::array<float,2>{0.274275184f, 0.473828703f},
-std::array<float,2>{0.934614956f, 0.536145866f},
-std::array<float,2>{0.224503025f, 0.892300606f},
-std::array<float,2>{0.5417189f, 0.11105486f},
-std::array<float,2>{0.477333128f, 0.0155815464f},
-std::array<float,2>{0.80497098f, 0.972489417f},
-std::array<float,2>{0.0266874544f, 0.565690279f},
-std::array<float,2>{0.691293776f, 0.418571472f},
-std::array<float,2>{0.137621284f, 0.269209892f},
-std::array<float,2>{0.596606731f, 0.648323536f},
-std::array<float,2>{0.348626047f, 0.762453675f},
-std::array<float,2>{0.988728285f, 0.172284424f},
-std::array<float,2>{0.121942297f, 0.00673550693f},
-std::array<float,2>{0.656027794f, 0.97753036f},
-std::array<float,2>{0.430818886f, 0.570701301f},
-std::array<float,2>{0.853361964f, 0.411776334f},
-std::array<float,2>{0.264880866f, 0.278317124f},
-std::array<float,2>{0.915359318f, 0.655185401f},
-std::array<float,2>{0.245151356f, 0.753534973f},
-std::array<float,2>{0.547860265f, 0.179784819f},
-std::array<float,2>{0.497508168f, 0.197986588f},
-std::array<float,2>{0.786971807f, 0.826633394f},
-std::array<float,2>{0.0152807906f, 0.746261895f},
-std::array<float,2>{0.715891361f, 0.315548748f},
-std::array<float,2>{0.143033579f, 0.47696504f},
-std::array<float,2>{0.60972029f, 0.545301616f},
-std::array<float,2>{0.366436332f, 0.902180195f},
-std::array<float,2>{0.971580505f, 0.118040562f},
-std::array<float,2>{0.193818495f, 0.12890479f},
-std::array<float,2>{0.52296555f, 0.806093514f},
-std::array<float,2>{0.290977418f, 0.660211205f},
-std::array<float,2>{0.902047098f, 0.285964787f},
-std::array<float,2>{0.383200347f, 0.37760511f},
-std::array<float,2>{0.82238102f, 0.614409864f},
-std::array<float,2>{0.0891009569f, 0.967460215f},
-std::array<float,2>{0.68567729f, 0.0585356727f},
-std::array<float,2>{0.327853709f, 0.0730254874f},
-std::array<float,2>{0.966736794f, 0.92901516f},
-std::array<float,2>{0.177490264f, 0.50920701f},
-std::array<float,2>{0.583047092f, 0.440239638f},
-std::array<float,2>{0.0544755198f, 0.351595283f},
-std::array<float,2>{0.72562325f, 0.703920245f},
-std::array<float,2>{0.454876393f, 0.853316307f},
-std::array<float,2>{0.756752729f, 0.239067107f},
-std::array<float,2>{0.157172844f, 0.0944218114f},
-std::array<float,2>{0.5769189f, 0.884488761f},
-std::array<float,2>{0.333811551f, 0.557653785f},
-std::array<float,2>{0.952802718f, 0.485037178f},
-std::array<float,2>{0.44795683f, 0.33277142f},
-std::array<float,2>{0.774289906f, 0.732137501f},
-std::array<float,2>{0.0444364808f, 0.839673221f},
-std::array<float,2>{0.743248165f, 0.205370992f},
-std::array<float,2>{0.301108152f, 0.166588232f},
-std::array<float,2>{0.882814705f, 0.773778796f},
-std::array<float,2>{0.215766042f, 0.638477206f},
-std::array<float,2>{0.501567781f, 0.251021117f},
-std::array<float,2>{0.0756869242f, 0.424434721f},
-std::array<float,2>{0.661529005f, 0.579140663f},
-std::array<float,2>{0.396040827f, 0.993937135f},
-std::array<float,2>{0.830031872f, 0.023141183f},
-std::array<float,2>{0.0290084239f, 0.232351288f},
-std::array<float,2>{0.695084214f, 0.866622329f},
-std::array<float,2>{0.48125422f, 0.693262279f},
-std::array<float,2>{0.810370862f, 0.373795182f},
-std::array<float,2>{0.346761674f, 0.461525559f},
-std::array<float,2>{0.985085666f, 0.525866866f},
-std::array<float,2>{0.136462271f, 0.908683777f},
-std::array<float,2>{0.599158108f, 0.0848775953f},
-std::array<float,2>{0.420048714f, 0.0414896049f},
-std::array<float,2>{0.867038488f, 0.949654102f},
-std::array<float,2>{0.108898327f, 0.598993838f},
-std::array<float,2>{0.630772054f, 0.396496534f},
-std::array<float,2>{0.220574051f, 0.299178898f},
-std::array<float,2>{0.543198884f, 0.686128795f},
-std::array<float,2>{0.28061235f, 0.78528142f},
-std::array<float,2>{0.931772232f, 0.144159183f},
-std::array<float,2>{0.0321537293f, 0.0928992108f},
-std::array<float,2>{0.737122953f, 0.921831906f},
-std::array<float,2>{0.437624395f, 0.518365443f},
-std::array<float,2>{0.76581943f, 0.454112053f},
-std::array<float,2>{0.342183501f, 0.365175039f},
-std::array<float,2>{0.93985945f, 0.69656837f},
-std::array<float,2>{0.168419912f, 0.873951018f},
-std::array<float,2>{0.562988818f, 0.225533947f},
-std::array<float,2>{0.399189323f, 0.150172696f},
-std::array<float,2>{0.836403072f, 0.795787811f},
-std::array<float,2>{0.0664500147f, 0.677355945f},
-std::array<float,2>{0.670666754f, 0.310336143f},
-std::array<float,2>{0.210557073f, 0.405592829f},
-std::array<float,2>{0.513297319f, 0.60459435f},
-std::array<float,2>{0.306306094f, 0.942232788f},
-std::array<float,2>{0.882052779f, 0.0385144763f},
-std::array<float,2>{0.129661113f, 0.217648715f},
-std::array<float,2>{0.602456927f, 0.834723055f},
-std::array<float,2>{0.358436644f, 0.720039964f},
-std::array<float,2>{0.993860781f, 0.341662258f},
-std::array<float,2>{0.472537547f, 0.495100737f},
-std::array<float,2>{0.80331713f, 0.548775077f},
-std::array<float,2>{0.0183571018f, 0.88229531f},
-std::array<float,2>{0.695505023f, 0.10402368f},
-std::array<float,2>{0.269423246f, 0.030697016f},
-std::array<float,2>{0.928694904f, 0.984805584f},
-std::array<float,2>{0.234158054f, 0.590915978f},
-std::array<float,2>{0.534305692f, 0.436325997f},
-std::array<float,2>{0.0967493579f, 0.260988414f},
-std::array<float,2>{0.638410926f, 0.631938517f},
-std::array<float,2>{0.411836118f, 0.770376027f},
-std::array<float,2>{0.871271431f, 0.162437066f},
-std::array<float,2>{0.234762833f, 0.0542654842f},
-std::array<float,2>{0.560659111f, 0.960524619f},
-std::array<float,2>{0.252482921f, 0.621300876f},
-std::array<float,2>{0.908810079f, 0.387134224f},
-std::array<float,2>{0.423071712f, 0.291871279f},
-std::array<float,2>{0.844108045f, 0.666386127f},
-std::array<float,2>{0.110979408f, 0.797334611f},
-std::array<float,2>{0.640813231f, 0.134019718f},
-std::array<float,2>{0.373005509f, 0.242235288f},
-std::array<float,2>{0.978966594f, 0.844784498f},
-std::array<float,2>{0.152322412f, 0.715823293f},
-std::array<float,2>{0.61903584f, 0.347461373f},
-std::array<float,2>{0.00664899871f, 0.448108047f},
-std::array<float,2>{0.708332121f, 0.503087521f},
-std::array<float,2>{0.487190723f, 0.933259368f},
-std::array<float,2>{0.794693351f, 0.0662049353f},
-std::array<float,2>{0.0825321153f, 0.175837144f},
-std::array<float,2>{0.675684214f, 0.75989306f},
-std::array<float,2>{0.37880221f, 0.640758276f},
-std::array<float,2>{0.815718651f, 0.27015394f},
-std::array<float,2>{0.283557534f, 0.416410357f},
-std::array<float,2>{0.891880155f, 0.569871008f},
-std::array<float,2>{0.195877433f, 0.975896895f},
-std::array<float,2>{0.523853302f, 0.0114562027f},
-std::array<float,2>{0.465091527f, 0.115227245f},
-std::array<float,2>{0.764031351f, 0.897112846f},
-std::array<float,2>{0.0571528748f, 0.533040881f},
-std::array<float,2>{0.733865917f, 0.46976763f},
-std::array<float,2>{0.180491388f, 0.326662093f},
-std::array<float,2>{0.589509547f, 0.74078089f},
-std::array<float,2>{0.319114447f, 0.816222787f},
-std::array<float,2>{0.958699763f, 0.191923261f},
-std::array<float,2>{0.101880215f, 0.110498033f},
-std::array<float,2>{0.627661467f, 0.891795397f},
-std::array<float,2>{0.414782554f, 0.53678292f},
-std::array<float,2>{0.862774551f, 0.474269331f},
-std::array<float,2>{0.276248038f, 0.320762545f},
-std::array<float,2>{0.937074244f, 0.736304939f},
-std::array<float,2>{0.226191953f, 0.819247723f},
-std::array<float,2>{0.539459586f, 0.190653712f},
-std::array<float,2>{0.479372412f, 0.172741085f},
-std::array<float,2>{0.808568895f, 0.762046695f},
-std::array<float,2>{0.024784483f, 0.647831798f},
-std::array<float,2>{0.689204156f, 0.268846124f},
-std::array<float,2>{0.139071167f, 0.418249011f},
-std::array<float,2>{0.593868852f, 0.566265523f},
-std::array<float,2>{0.351050764f, 0.971695781f},
-std::array<float,2>{0.992008686f, 0.0150381178f},
-std::array<float,2>{0.212147102f, 0.248598725f},
-std::array<float,2>{0.504962683f, 0.850664616f},
-std::array<float,2>{0.299525976f, 0.712623894f},
-std::array<float,2>{0.890274227f, 0.349897802f},
-std::array<float,2>{0.391899168f, 0.44951579f},
-std::array<float,2>{0.834372222f, 0.504581451f},
-std::array<float,2>{0.0731604695f, 0.935937881f},
-std::array<float,2>{0.657454014f, 0.0669058189f},
-std::array<float,2>{0.329296798f, 0.0498452373f},
-std::array<float,2>{0.94918716f, 0.956885755f},
-std::array<float,2>{0.163135931f, 0.618971229f},
-std::array<float,2>{0.571291983f, 0.386317164f},
-std::array<float,2>{0.0391776264f, 0.295929104f},
-std::array<float,2>{0.747328162f, 0.669497252f},
-std::array<float,2>{0.452540517f, 0.803013384f},
-std::array<float,2>{0.777391732f, 0.139603153f},
-std::array<float,2>{0.175031811f, 0.0248064026f},
-std::array<float,2>{0.579835415f, 0.990078449f},
-std::array<float,2>{0.321876019f, 0.587371111f},
-std::array<float,2>{0.960974455f, 0.430431038f},
-std::array<float,2>{0.459490567f, 0.26332584f},
-std::array<float,2>{0.753616929f, 0.628687024f},
-std::array<float,2>{0.0486252084f, 0.769305468f},
-std::array<float,2>{0.720718265f, 0.159973681f},
-std::array<float,2>{0.293395013f, 0.212178424f},
-std::array<float,2>{0.904170752f, 0.82868135f},
-std::array<float,2>{0.188672841f, 0.723959804f},
-std::array<float,2>{0.519222081f, 0.339666098f},
-std::array<float,2>{0.0933233202f, 0.497846693f},
-std::array<float,2>{0.682750285f, 0.554162323f},
-std::array<float,2>{0.389206439f, 0.876079679f},
-std::array<float,2>{0.826523185f, 0.108487874f},
-std::array<float,2>{0.00842633564f, 0.156013161f},
-std::array<float,2>{0.713160753f, 0.789628267f},
-std::array<float,2>{0.495316386f, 0.672167122f},
-std::array<float,2>{0.7830832f, 0.306295127f},
-std::array<float,2>{0.359952301f, 0.400745243f},
-std::array<float,2>{0.972681701f, 0.608183622f},
-std::array<float,2>{0.145382494f, 0.940968633f},
-std::array<float,2>{0.615839362f, 0.0319599546f},
-std::array<float,2>{0.434494376f, 0.0873321071f},
-std::array<float,2>{0.858879864f, 0.91730988f},
-std::array<float,2>{0.118012942f, 0.520471513f},
-std::array<float,2>{0.650336146f, 0.459370941f},
-std::array<float,2>{0.248714879f, 0.361938417f},
-std::array<float,2>{0.553420782f, 0.702960372f},
-std::array<float,2>{0.257963419f, 0.86913681f},
-std::array<float,2>{0.918524861f, 0.222325653f},
-std::array<float,2>{0.0606753863f, 0.0431409404f},
-std::array<float,2>{0.726754129f, 0.948840499f},
-std::array<float,2>{0.463297844f, 0.594480634f},
-std::array<float,2>{0.761191249f, 0.391829759f},
-std::array<float,2>{0.316093206f, 0.301740348f},
-std::array<float,2>{0.954093993f, 0.681228876f},
-std::array<float,2>{0.184391677f, 0.781355262f},
-std::array<float,2>{0.593378782f, 0.147200331f},
-std::array<float,2>{0.379180759f, 0.226983726f},
-std::array<float,2>{0.817264795f, 0.859705329f},
-std::array<float,2>{0.078872174f, 0.689139128f},
-std::array<float,2>{0.6793859f, 0.367421091f},
-std::array<float,2>{0.202508822f, 0.466161281f},
-std::array<float,2>{0.5280568f, 0.529103994f},
-std::array<float,2>{0.286232293f, 0.913423657f},
-std::array<float,2>{0.896147192f, 0.0805482566f},
-std::array<float,2>{0.153926745f, 0.171133101f},
-std::array<float,2>{0.621464133f, 0.781239629f},
-std::array<float,2>{0.368905932f, 0.634503663f},
-std::array<float,2>{0.980773091f, 0.254835427f},
-std::array<float,2>{0.490782738f, 0.427607894f},
-std::array<float,2>{0.790116668f, 0.585781634f},
-std::array<float,2>{0.00218471838f, 0.999409854f},
-std::array<float,2>{0.7067433f, 0.0160560869f},
-std::array<float,2>{0.254889101f, 0.098937124f},
-std::array<float,2>{0.912443519f, 0.887911618f},
-std::array<float,2>{0.239144206f, 0.558691859f},
-std::array<float,2>{0.558028698f, 0.492067784f},
-std::array<float,2>{0.116971724f, 0.329317451f},
-std::array<float,2>{0.647664189f, 0.729423761f},
-std::array<float,2>{0.428734422f, 0.840249002f},
-std::array<float,2>{0.850404322f, 0.208724409f},
-std::array<float,2>{0.228582636f, 0.0777347386f},
-std::array<float,2>{0.535418987f, 0.923139513f},
-std::array<float,2>{0.271399379f, 0.514654636f},
-std::array<float,2>{0.923472226f, 0.443484813f},
-std::array<float,2>{0.406822443f, 0.357715756f},
-std::array<float,2>{0.870922565f, 0.708125114f},
-std::array<float,2>{0.100199297f, 0.858228743f},
-std::array<float,2>{0.634911239f, 0.235016361f},
-std::array<float,2>{0.353820324f, 0.13251701f},
-std::array<float,2>{0.999459028f, 0.811347246f},
-std::array<float,2>{0.125667587f, 0.657545984f},
-std::array<float,2>{0.607264459f, 0.283502162f},
-std::array<float,2>{0.0201937761f, 0.381364882f},
-std::array<float,2>{0.70239383f, 0.609458745f},
-std::array<float,2>{0.474289298f, 0.963891685f},
-std::array<float,2>{0.800566852f, 0.0598281696f},
-std::array<float,2>{0.0628769472f, 0.202098995f},
-std::array<float,2>{0.667798758f, 0.823581994f},
-std::array<float,2>{0.406063497f, 0.744238257f},
-std::array<float,2>{0.84139806f, 0.319192678f},
-std::array<float,2>{0.310391158f, 0.48285979f},
-std::array<float,2>{0.87839824f, 0.541652143f},
-std::array<float,2>{0.203623235f, 0.905852795f},
-std::array<float,2>{0.510100842f, 0.122313894f},
-std::array<float,2>{0.441669971f, 0.00195692875f},
-std::array<float,2>{0.771386623f, 0.98360455f},
-std::array<float,2>{0.0369576439f, 0.574654162f},
-std::array<float,2>{0.741039693f, 0.408323735f},
-std::array<float,2>{0.166416436f, 0.275453269f},
-std::array<float,2>{0.568914115f, 0.650663078f},
-std::array<float,2>{0.337674379f, 0.756833613f},
-std::array<float,2>{0.943250179f, 0.187262997f},
-std::array<float,2>{0.0843876153f, 0.0110503249f},
-std::array<float,2>{0.672354817f, 0.976511359f},
-std::array<float,2>{0.375339389f, 0.569521606f},
-std::array<float,2>{0.813494146f, 0.416979879f},
-std::array<float,2>{0.281750917f, 0.269925296f},
-std::array<float,2>{0.893326044f, 0.641151607f},
-std::array<float,2>{0.198042497f, 0.760570228f},
-std::array<float,2>{0.527258396f, 0.176283002f},
-std::array<float,2>{0.466909021f, 0.191769913f},
-std::array<float,2>{0.762843966f, 0.815691471f},
-std::array<float,2>{0.0558839962f, 0.740709782f},
-std::array<float,2>{0.731552243f, 0.326361448f},
-std::array<float,2>{0.183532432f, 0.470593631f},
-std::array<float,2>{0.58678782f, 0.532702267f},
-std::array<float,2>{0.317623436f, 0.896898985f},
-std::array<float,2>{0.959708631f, 0.114546441f},
-std::array<float,2>{0.237720802f, 0.134621114f},
-std::array<float,2>{0.560286403f, 0.797697783f},
-std::array<float,2>{0.25043425f, 0.666656613f},
-std::array<float,2>{0.908089161f, 0.291485101f},
-std::array<float,2>{0.424300104f, 0.387511462f},
-std::array<float,2>{0.847307265f, 0.621796727f},
-std::array<float,2>{0.112198159f, 0.960299253f},
-std::array<float,2>{0.643083274f, 0.0541796051f},
-std::array<float,2>{0.374129176f, 0.0656015053f},
-std::array<float,2>{0.977296352f, 0.933036983f},
-std::array<float,2>{0.149270862f, 0.503865361f},
-std::array<float,2>{0.620366573f, 0.447434127f},
-std::array<float,2>{0.00421869522f, 0.347019225f},
-std::array<float,2>{0.709649444f, 0.716740906f},
-std::array<float,2>{0.485216469f, 0.845365703f},
-std::array<float,2>{0.79509449f, 0.24296543f},
-std::array<float,2>{0.131061211f, 0.103737026f},
-std::array<float,2>{0.604536891f, 0.882536411f},
-std::array<float,2>{0.355590045f, 0.548058331f},
-std::array<float,2>{0.995045722f, 0.494449615f},
-std::array<float,2>{0.469608068f, 0.341253281f},
-std::array<float,2>{0.80120188f, 0.720609307f},
-std::array<float,2>{0.0166780055f, 0.834321439f},
-std::array<float,2>{0.698559284f, 0.217255503f},
-std::array<float,2>{0.267575115f, 0.162976712f},
-std::array<float,2>{0.927065969f, 0.769631207f},
-std::array<float,2>{0.230649337f, 0.632704318f},
-std::array<float,2>{0.532845557f, 0.261305541f},
-std::array<float,2>{0.0949797705f, 0.435743332f},
-std::array<float,2>{0.639513969f, 0.591435611f},
-std::array<float,2>{0.413137227f, 0.985344112f},
-std::array<float,2>{0.873557806f, 0.0307868365f},
-std::array<float,2>{0.0346726589f, 0.224722832f},
-std::array<float,2>{0.736308873f, 0.873518407f},
-std::array<float,2>{0.439948827f, 0.696918309f},
-std::array<float,2>{0.768466294f, 0.364528328f},
-std::array<float,2>{0.341586262f, 0.454700321f},
-std::array<float,2>{0.937578738f, 0.51794374f},
-std::array<float,2>{0.170901939f, 0.921351731f},
-std::array<float,2>{0.564908206f, 0.0935272574f},
-std::array<float,2>{0.401093572f, 0.0388300493f},
-std::array<float,2>{0.839716196f, 0.941808164f},
-std::array<float,2>{0.0690873414f, 0.605384409f},
-std::array<float,2>{0.669360578f, 0.405988902f},
-std::array<float,2>{0.20752719f, 0.30984363f},
-std::array<float,2>{0.515619338f, 0.677235067f},
-std::array<float,2>{0.308380753f, 0.794931531f},
-std::array<float,2>{0.87893188f, 0.149884209f},
-std::array<float,2>{0.0311055612f, 0.0843402296f},
-std::array<float,2>{0.692735851f, 0.908731341f},
-std::array<float,2>{0.483352363f, 0.525955319f},
-std::array<float,2>{0.8114236f, 0.461050093f},
-std::array<float,2>{0.344908416f, 0.373455107f},
-std::array<float,2>{0.987989128f, 0.692795634f},
-std::array<float,2>{0.133204281f, 0.86683917f},
-std::array<float,2>{0.60153985f, 0.231926709f},
-std::array<float,2>{0.419837952f, 0.143958807f},
-std::array<float,2>{0.864354014f, 0.785917759f},
-std::array<float,2>{0.106610514f, 0.685712636f},
-std::array<float,2>{0.631216943f, 0.29937306f},
-std::array<float,2>{0.221958861f, 0.39703387f},
-std::array<float,2>{0.545126557f, 0.59956044f},
-std::array<float,2>{0.278315067f, 0.949897587f},
-std::array<float,2>{0.930458784f, 0.0416546948f},
-std::array<float,2>{0.158301294f, 0.205975294f},
-std::array<float,2>{0.575911283f, 0.839064598f},
-std::array<float,2>{0.334711224f, 0.731672823f},
-std::array<float,2>{0.950367749f, 0.332442969f},
-std::array<float,2>{0.446406037f, 0.484639317f},
-std::array<float,2>{0.775631309f, 0.558486521f},
-std::array<float,2>{0.0458725132f, 0.884205222f},
-std::array<float,2>{0.744203627f, 0.0942268297f},
-std::array<float,2>{0.304585785f, 0.0227782652f},
-std::array<float,2>{0.885706961f, 0.993304193f},
-std::array<float,2>{0.217240363f, 0.579676688f},
-std::array<float,2>{0.502789974f, 0.424056292f},
-std::array<float,2>{0.0780448094f, 0.251884818f},
-std::array<float,2>{0.662985325f, 0.637914777f},
-std::array<float,2>{0.397535801f, 0.774197876f},
-std::array<float,2>{0.830225885f, 0.166360021f},
-std::array<float,2>{0.191612065f, 0.0576321371f},
-std::array<float,2>{0.520419478f, 0.967281163f},
-std::array<float,2>{0.292337239f, 0.615173995f},
-std::array<float,2>{0.900277317f, 0.377234489f},
-std::array<float,2>{0.385879964f, 0.285374552f},
-std::array<float,2>{0.821037412f, 0.66083461f},
-std::array<float,2>{0.087669827f, 0.806276143f},
-std::array<float,2>{0.684148312f, 0.128271878f},
-std::array<float,2>{0.325206727f, 0.23851563f},
-std::array<float,2>{0.968577743f, 0.853015065f},
-std::array<float,2>{0.178967476f, 0.703215539f},
-std::array<float,2>{0.585067153f, 0.352537185f},
-std::array<float,2>{0.0525590405f, 0.439513624f},
-std::array<float,2>{0.723136902f, 0.509657979f},
-std::array<float,2>{0.455692589f, 0.929436743f},
-std::array<float,2>{0.754390419f, 0.0726957694f},
-std::array<float,2>{0.123711124f, 0.180563673f},
-std::array<float,2>{0.653101504f, 0.753282309f},
-std::array<float,2>{0.432537168f, 0.654645085f},
-std::array<float,2>{0.855397046f, 0.277792603f},
-std::array<float,2>{0.261748761f, 0.411206156f},
-std::array<float,2>{0.917077482f, 0.571045041f},
-std::array<float,2>{0.243203565f, 0.976827562f},
-std::array<float,2>{0.550191879f, 0.0061623822f},
-std::array<float,2>{0.498246849f, 0.117252253f},
-std::array<float,2>{0.788330674f, 0.901829064f},
-std::array<float,2>{0.0135347461f, 0.545844972f},
-std::array<float,2>{0.718630493f, 0.477316201f},
-std::array<float,2>{0.142460406f, 0.316027701f},
-std::array<float,2>{0.612665355f, 0.746637225f},
-std::array<float,2>{0.364802539f, 0.827122033f},
-std::array<float,2>{0.968881905f, 0.19733198f},
-std::array<float,2>{0.0711129159f, 0.069235526f},
-std::array<float,2>{0.658418596f, 0.935371518f},
-std::array<float,2>{0.393070489f, 0.506456494f},
-std::array<float,2>{0.832175016f, 0.451998323f},
-std::array<float,2>{0.297565728f, 0.349581778f},
-std::array<float,2>{0.888149858f, 0.713722825f},
-std::array<float,2>{0.214415103f, 0.84930712f},
-std::array<float,2>{0.506163061f, 0.246522799f},
-std::array<float,2>{0.450603396f, 0.13759543f},
-std::array<float,2>{0.780692995f, 0.801435888f},
-std::array<float,2>{0.0416400135f, 0.671744347f},
-std::array<float,2>{0.749984324f, 0.294858724f},
-std::array<float,2>{0.161004275f, 0.383117437f},
-std::array<float,2>{0.572555184f, 0.619755268f},
-std::array<float,2>{0.330544233f, 0.954322755f},
-std::array<float,2>{0.947071135f, 0.048091881f},
-std::array<float,2>{0.223875657f, 0.187629625f},
-std::array<float,2>{0.541233659f, 0.81674999f},
-std::array<float,2>{0.273795962f, 0.737924993f},
-std::array<float,2>{0.935424805f, 0.322335541f},
-std::array<float,2>{0.416527241f, 0.474838883f},
-std::array<float,2>{0.859779418f, 0.538906395f},
-std::array<float,2>{0.103568301f, 0.893075645f},
-std::array<float,2>{0.625319839f, 0.112397f},
-std::array<float,2>{0.348138899f, 0.0123455273f},
-std::array<float,2>{0.988913774f, 0.970508277f},
-std::array<float,2>{0.136762902f, 0.563487709f},
-std::array<float,2>{0.595822215f, 0.421652526f},
-std::array<float,2>{0.0269829053f, 0.267512441f},
-std::array<float,2>{0.690582454f, 0.644565165f},
-std::array<float,2>{0.476778358f, 0.765146255f},
-std::array<float,2>{0.8055076f, 0.175680727f},
-std::array<float,2>{0.147837415f, 0.0337033868f},
-std::array<float,2>{0.614461541f, 0.938175619f},
-std::array<float,2>{0.363156259f, 0.606015742f},
-std::array<float,2>{0.975261867f, 0.400359243f},
-std::array<float,2>{0.492238045f, 0.308578968f},
-std::array<float,2>{0.783849955f, 0.674281955f},
-std::array<float,2>{0.0105898427f, 0.791823745f},
-std::array<float,2>{0.711413205f, 0.152571663f},
-std::array<float,2>{0.260928392f, 0.219279081f},
-std::array<float,2>{0.92005384f, 0.871077538f},
-std::array<float,2>{0.24767749f, 0.701023936f},
-std::array<float,2>{0.550809681f, 0.360052645f},
-std::array<float,2>{0.120164804f, 0.45772171f},
-std::array<float,2>{0.650964439f, 0.521495044f},
-std::array<float,2>{0.435802281f, 0.915349364f},
-std::array<float,2>{0.855654597f, 0.0884060413f},
-std::array<float,2>{0.0498925075f, 0.156664103f},
-std::array<float,2>{0.719183624f, 0.766635597f},
-std::array<float,2>{0.457202792f, 0.626572788f},
-std::array<float,2>{0.750799656f, 0.263709098f},
-std::array<float,2>{0.322484642f, 0.432720482f},
-std::array<float,2>{0.96396178f, 0.589277983f},
-std::array<float,2>{0.172248229f, 0.990925193f},
-std::array<float,2>{0.580747128f, 0.0268029049f},
-std::array<float,2>{0.387812942f, 0.10671939f},
-std::array<float,2>{0.826136231f, 0.877259672f},
-std::array<float,2>{0.0915784165f, 0.550881922f},
-std::array<float,2>{0.681250393f, 0.498598605f},
-std::array<float,2>{0.189750984f, 0.337583274f},
-std::array<float,2>{0.516710997f, 0.725534976f},
-std::array<float,2>{0.294943333f, 0.83159411f},
-std::array<float,2>{0.904945672f, 0.214550972f},
-std::array<float,2>{0.00135103718f, 0.0193494223f},
-std::array<float,2>{0.704955518f, 0.996436894f},
-std::array<float,2>{0.488546044f, 0.58221513f},
-std::array<float,2>{0.792393625f, 0.428788304f},
-std::array<float,2>{0.370671183f, 0.257097632f},
-std::array<float,2>{0.982888639f, 0.634830594f},
-std::array<float,2>{0.155890822f, 0.778079093f},
-std::array<float,2>{0.624389231f, 0.168189868f},
-std::array<float,2>{0.426541626f, 0.210210875f},
-std::array<float,2>{0.848316729f, 0.843226433f},
-std::array<float,2>{0.113697641f, 0.727804422f},
-std::array<float,2>{0.645340502f, 0.331574887f},
-std::array<float,2>{0.241372764f, 0.489242703f},
-std::array<float,2>{0.556553185f, 0.562097788f},
-std::array<float,2>{0.257081926f, 0.889117539f},
-std::array<float,2>{0.912017167f, 0.100837626f},
-std::array<float,2>{0.18613413f, 0.146361619f},
-std::array<float,2>{0.590207458f, 0.784151256f},
-std::array<float,2>{0.314433455f, 0.682758749f},
-std::array<float,2>{0.95620513f, 0.303066671f},
-std::array<float,2>{0.461192638f, 0.392787993f},
-std::array<float,2>{0.758321524f, 0.596287906f},
-std::array<float,2>{0.059663251f, 0.94682318f},
-std::array<float,2>{0.729771435f, 0.0465125218f},
-std::array<float,2>{0.287568778f, 0.0796773881f},
-std::array<float,2>{0.89801693f, 0.910370588f},
-std::array<float,2>{0.200956181f, 0.530643761f},
-std::array<float,2>{0.530069709f, 0.467651784f},
-std::array<float,2>{0.0813296363f, 0.36961481f},
-std::array<float,2>{0.677442908f, 0.69040072f},
-std::array<float,2>{0.382288903f, 0.861715436f},
-std::array<float,2>{0.820218086f, 0.228829771f},
-std::array<float,2>{0.205461293f, 0.124134563f},
-std::array<float,2>{0.507989228f, 0.903205991f},
-std::array<float,2>{0.31178239f, 0.539562643f},
-std::array<float,2>{0.876098037f, 0.481601059f},
-std::array<float,2>{0.403349847f, 0.317205727f},
-std::array<float,2>{0.842957318f, 0.743368804f},
-std::array<float,2>{0.0661635473f, 0.821847141f},
-std::array<float,2>{0.664905012f, 0.200179487f},
-std::array<float,2>{0.338173658f, 0.185250819f},
-std::array<float,2>{0.943830907f, 0.755824685f},
-std::array<float,2>{0.16512759f, 0.648932338f},
-std::array<float,2>{0.566658258f, 0.275220245f},
-std::array<float,2>{0.0374861769f, 0.407841861f},
-std::array<float,2>{0.739745975f, 0.577333868f},
-std::array<float,2>{0.443590701f, 0.981484175f},
-std::array<float,2>{0.772658527f, 0.000475248526f},
-std::array<float,2>{0.0987776667f, 0.237905055f},
-std::array<float,2>{0.633702934f, 0.856767893f},
-std::array<float,2>{0.409934163f, 0.709819138f},
-std::array<float,2>{0.867509305f, 0.356701523f},
-std::array<float,2>{0.273256689f, 0.442976207f},
-std::array<float,2>{0.924998164f, 0.51320523f},
-std::array<float,2>{0.226792544f, 0.924125433f},
-std::array<float,2>{0.538743734f, 0.0742211044f},
-std::array<float,2>{0.475320876f, 0.0622144789f},
-std::array<float,2>{0.798672736f, 0.961767197f},
-std::array<float,2>{0.0228321273f, 0.612973511f},
-std::array<float,2>{0.701034844f, 0.380671382f},
-std::array<float,2>{0.12848483f, 0.282324821f},
-std::array<float,2>{0.609261096f, 0.658508122f},
-std::array<float,2>{0.353131503f, 0.810289621f},
-std::array<float,2>{0.996105313f, 0.13063015f},
-std::array<float,2>{0.110751495f, 0.0521635376f},
-std::array<float,2>{0.641428053f, 0.957311511f},
-std::array<float,2>{0.423403919f, 0.623530388f},
-std::array<float,2>{0.84467423f, 0.38908121f},
-std::array<float,2>{0.252306104f, 0.290345907f},
-std::array<float,2>{0.908218682f, 0.6659922f},
-std::array<float,2>{0.235082492f, 0.800157368f},
-std::array<float,2>{0.561251223f, 0.135172248f},
-std::array<float,2>{0.486649036f, 0.244144589f},
-std::array<float,2>{0.79422754f, 0.845947683f},
-std::array<float,2>{0.00623254804f, 0.718201578f},
-std::array<float,2>{0.708707213f, 0.343926162f},
-std::array<float,2>{0.15178521f, 0.445502937f},
-std::array<float,2>{0.618328035f, 0.50022006f},
-std::array<float,2>{0.372355729f, 0.931636214f},
-std::array<float,2>{0.979243577f, 0.0630784407f},
-std::array<float,2>{0.195749074f, 0.178873464f},
-std::array<float,2>{0.52415359f, 0.758398533f},
-std::array<float,2>{0.283822417f, 0.642838538f},
-std::array<float,2>{0.892216086f, 0.271517158f},
-std::array<float,2>{0.378074765f, 0.415364236f},
-std::array<float,2>{0.816019535f, 0.566939294f},
-std::array<float,2>{0.0823519006f, 0.97336632f},
-std::array<float,2>{0.674853146f, 0.00954575278f},
-std::array<float,2>{0.318778992f, 0.115374282f},
-std::array<float,2>{0.958116293f, 0.894534707f},
-std::array<float,2>{0.180022627f, 0.534935951f},
-std::array<float,2>{0.58887738f, 0.471969962f},
-std::array<float,2>{0.0570470206f, 0.325380355f},
-std::array<float,2>{0.734216809f, 0.739753842f},
-std::array<float,2>{0.465445429f, 0.812942922f},
-std::array<float,2>{0.764172614f, 0.194402441f},
-std::array<float,2>{0.168528676f, 0.0916701183f},
-std::array<float,2>{0.562679291f, 0.919723988f},
-std::array<float,2>{0.342469037f, 0.516405165f},
-std::array<float,2>{0.940130949f, 0.456144094f},
-std::array<float,2>{0.438294828f, 0.366535634f},
-std::array<float,2>{0.766457677f, 0.69770813f},
-std::array<float,2>{0.0316769928f, 0.87270844f},
-std::array<float,2>{0.736729264f, 0.224594921f},
-std::array<float,2>{0.305752635f, 0.151765049f},
-std::array<float,2>{0.882565022f, 0.793243229f},
-std::array<float,2>{0.210126609f, 0.67832613f},
-std::array<float,2>{0.512781799f, 0.311733395f},
-std::array<float,2>{0.0672980994f, 0.403937101f},
-std::array<float,2>{0.670158982f, 0.601830661f},
-std::array<float,2>{0.398832828f, 0.9449628f},
-std::array<float,2>{0.836685956f, 0.0360802077f},
-std::array<float,2>{0.0180116892f, 0.216274425f},
-std::array<float,2>{0.695839703f, 0.833032429f},
-std::array<float,2>{0.471716523f, 0.721814573f},
-std::array<float,2>{0.803117335f, 0.343721569f},
-std::array<float,2>{0.359253019f, 0.493276268f},
-std::array<float,2>{0.993417382f, 0.550271571f},
-std::array<float,2>{0.129105151f, 0.880582869f},
-std::array<float,2>{0.601685643f, 0.102166973f},
-std::array<float,2>{0.411293477f, 0.0282064192f},
-std::array<float,2>{0.872066379f, 0.987800181f},
-std::array<float,2>{0.0975574479f, 0.59235096f},
-std::array<float,2>{0.638180077f, 0.433633119f},
-std::array<float,2>{0.233836994f, 0.25894627f},
-std::array<float,2>{0.534879506f, 0.629598379f},
-std::array<float,2>{0.268906593f, 0.772228718f},
-std::array<float,2>{0.928213775f, 0.160310984f},
-std::array<float,2>{0.0440483131f, 0.0957975984f},
-std::array<float,2>{0.743674874f, 0.885095477f},
-std::array<float,2>{0.447605491f, 0.554988682f},
-std::array<float,2>{0.773650944f, 0.48638916f},
-std::array<float,2>{0.333275586f, 0.335337937f},
-std::array<float,2>{0.952446759f, 0.732582211f},
-std::array<float,2>{0.156698287f, 0.836442232f},
-std::array<float,2>{0.576512992f, 0.203974351f},
-std::array<float,2>{0.395602107f, 0.165702477f},
-std::array<float,2>{0.829432905f, 0.77633971f},
-std::array<float,2>{0.0756388083f, 0.639581084f},
-std::array<float,2>{0.661904931f, 0.252220631f},
-std::array<float,2>{0.215269685f, 0.422668129f},
-std::array<float,2>{0.501203895f, 0.580545783f},
-std::array<float,2>{0.301546663f, 0.99499321f},
-std::array<float,2>{0.883566022f, 0.0205252953f},
-std::array<float,2>{0.136230141f, 0.233132899f},
-std::array<float,2>{0.598954201f, 0.86363101f},
-std::array<float,2>{0.347455293f, 0.693716764f},
-std::array<float,2>{0.984731615f, 0.37150538f},
-std::array<float,2>{0.48074016f, 0.464651585f},
-std::array<float,2>{0.809822857f, 0.52371341f},
-std::array<float,2>{0.0287054759f, 0.907732129f},
-std::array<float,2>{0.694823503f, 0.0835224688f},
-std::array<float,2>{0.281173855f, 0.0400329195f},
-std::array<float,2>{0.932147741f, 0.952825606f},
-std::array<float,2>{0.219970196f, 0.600129187f},
-std::array<float,2>{0.543462634f, 0.395136684f},
-std::array<float,2>{0.108594812f, 0.298390776f},
-std::array<float,2>{0.630083084f, 0.685013711f},
-std::array<float,2>{0.420836121f, 0.788566887f},
-std::array<float,2>{0.866465211f, 0.141343489f},
-std::array<float,2>{0.245647579f, 0.00456366874f},
-std::array<float,2>{0.548382819f, 0.979142606f},
-std::array<float,2>{0.26542747f, 0.57353431f},
-std::array<float,2>{0.915536046f, 0.412872225f},
-std::array<float,2>{0.431195259f, 0.281067908f},
-std::array<float,2>{0.852544904f, 0.65411526f},
-std::array<float,2>{0.121439211f, 0.751823843f},
-std::array<float,2>{0.655629396f, 0.18310082f},
-std::array<float,2>{0.366769761f, 0.195890218f},
-std::array<float,2>{0.970720649f, 0.824471653f},
-std::array<float,2>{0.143287867f, 0.749495268f},
-std::array<float,2>{0.610347748f, 0.314052463f},
-std::array<float,2>{0.0150363715f, 0.480372339f},
-std::array<float,2>{0.716706157f, 0.543704033f},
-std::array<float,2>{0.498013735f, 0.900283158f},
-std::array<float,2>{0.786307752f, 0.119740278f},
-std::array<float,2>{0.0897612944f, 0.126068443f},
-std::array<float,2>{0.686206937f, 0.806895494f},
-std::array<float,2>{0.383711904f, 0.663378954f},
-std::array<float,2>{0.823141575f, 0.288193196f},
-std::array<float,2>{0.290267825f, 0.375169694f},
-std::array<float,2>{0.901835501f, 0.61608988f},
-std::array<float,2>{0.194105566f, 0.966404915f},
-std::array<float,2>{0.522823095f, 0.0548076071f},
-std::array<float,2>{0.454107672f, 0.0703741834f},
-std::array<float,2>{0.756277025f, 0.926089108f},
-std::array<float,2>{0.0538098253f, 0.510373652f},
-std::array<float,2>{0.726139665f, 0.438753575f},
-std::array<float,2>{0.177045822f, 0.354655206f},
-std::array<float,2>{0.583549619f, 0.706326008f},
-std::array<float,2>{0.327338129f, 0.854884982f},
-std::array<float,2>{0.966057301f, 0.240373656f},
-std::array<float,2>{0.118252501f, 0.0896272436f},
-std::array<float,2>{0.648843348f, 0.914156973f},
-std::array<float,2>{0.435093582f, 0.523395121f},
-std::array<float,2>{0.857553244f, 0.458197027f},
-std::array<float,2>{0.259365588f, 0.360561073f},
-std::array<float,2>{0.918958068f, 0.700103283f},
-std::array<float,2>{0.249269977f, 0.869392872f},
-std::array<float,2>{0.554317355f, 0.220488831f},
-std::array<float,2>{0.494166315f, 0.15371649f},
-std::array<float,2>{0.781552076f, 0.792938411f},
-std::array<float,2>{0.00919170305f, 0.67517513f},
-std::array<float,2>{0.714465082f, 0.306738287f},
-std::array<float,2>{0.146290511f, 0.399095863f},
-std::array<float,2>{0.616537631f, 0.607015073f},
-std::array<float,2>{0.360951394f, 0.939328969f},
-std::array<float,2>{0.973741651f, 0.0349703617f},
-std::array<float,2>{0.187795088f, 0.21351546f},
-std::array<float,2>{0.517652988f, 0.830407619f},
-std::array<float,2>{0.294084281f, 0.725611031f},
-std::array<float,2>{0.903271973f, 0.336894572f},
-std::array<float,2>{0.390276879f, 0.499754459f},
-std::array<float,2>{0.828005373f, 0.552096307f},
-std::array<float,2>{0.092048198f, 0.878115356f},
-std::array<float,2>{0.682326257f, 0.105769597f},
-std::array<float,2>{0.320917189f, 0.0257891901f},
-std::array<float,2>{0.962126195f, 0.991395473f},
-std::array<float,2>{0.174791306f, 0.588621557f},
-std::array<float,2>{0.578404844f, 0.432287842f},
-std::array<float,2>{0.0469791628f, 0.264862984f},
-std::array<float,2>{0.721912742f, 0.625912845f},
-std::array<float,2>{0.460212886f, 0.766163051f},
-std::array<float,2>{0.752240241f, 0.158176079f},
-std::array<float,2>{0.162948653f, 0.0475443862f},
-std::array<float,2>{0.570458829f, 0.953577638f},
-std::array<float,2>{0.328301817f, 0.620539904f},
-std::array<float,2>{0.948004425f, 0.384135306f},
-std::array<float,2>{0.451363504f, 0.293440223f},
-std::array<float,2>{0.778969765f, 0.670077205f},
-std::array<float,2>{0.040182557f, 0.802517474f},
-std::array<float,2>{0.746851504f, 0.138056591f},
-std::array<float,2>{0.30039677f, 0.247784361f},
-std::array<float,2>{0.889091849f, 0.847959816f},
-std::array<float,2>{0.211042061f, 0.714303553f},
-std::array<float,2>{0.50400573f, 0.348011762f},
-std::array<float,2>{0.0733244568f, 0.452880204f},
-std::array<float,2>{0.656347394f, 0.507236481f},
-std::array<float,2>{0.390956521f, 0.934230208f},
-std::array<float,2>{0.835759461f, 0.0699139163f},
-std::array<float,2>{0.0235813037f, 0.17402263f},
-std::array<float,2>{0.688213348f, 0.764248967f},
-std::array<float,2>{0.479848921f, 0.646122396f},
-std::array<float,2>{0.806892037f, 0.266203225f},
-std::array<float,2>{0.350329876f, 0.42018947f},
-std::array<float,2>{0.991179049f, 0.56255579f},
-std::array<float,2>{0.139696524f, 0.969204664f},
-std::array<float,2>{0.595206499f, 0.0132946093f},
-std::array<float,2>{0.415499896f, 0.112266205f},
-std::array<float,2>{0.861339867f, 0.894388556f},
-std::array<float,2>{0.103289463f, 0.537816942f},
-std::array<float,2>{0.628453672f, 0.475831717f},
-std::array<float,2>{0.225512221f, 0.323921025f},
-std::array<float,2>{0.540278733f, 0.736398399f},
-std::array<float,2>{0.276653826f, 0.817417681f},
-std::array<float,2>{0.936243892f, 0.189231843f},
-std::array<float,2>{0.0353646092f, 0.00162286358f},
-std::array<float,2>{0.741360664f, 0.981145918f},
-std::array<float,2>{0.442685753f, 0.576898038f},
-std::array<float,2>{0.770241678f, 0.407103479f},
-std::array<float,2>{0.336864442f, 0.274109989f},
-std::array<float,2>{0.941716135f, 0.650227964f},
-std::array<float,2>{0.167513058f, 0.754343629f},
-std::array<float,2>{0.570255578f, 0.184299499f},
-std::array<float,2>{0.40523085f, 0.200205147f},
-std::array<float,2>{0.840162039f, 0.820497155f},
-std::array<float,2>{0.0637902543f, 0.742319822f},
-std::array<float,2>{0.666923463f, 0.317596614f},
-std::array<float,2>{0.204177558f, 0.480929673f},
-std::array<float,2>{0.510856748f, 0.540697277f},
-std::array<float,2>{0.308650434f, 0.904260755f},
-std::array<float,2>{0.877046347f, 0.124009289f},
-std::array<float,2>{0.126050547f, 0.129799977f},
-std::array<float,2>{0.606359899f, 0.808736026f},
-std::array<float,2>{0.35460642f, 0.659404218f},
-std::array<float,2>{0.998169243f, 0.28170523f},
-std::array<float,2>{0.473045409f, 0.379220396f},
-std::array<float,2>{0.799656093f, 0.611752629f},
-std::array<float,2>{0.021380432f, 0.96270442f},
-std::array<float,2>{0.701541781f, 0.060945373f},
-std::array<float,2>{0.270022869f, 0.0761231929f},
-std::array<float,2>{0.921962678f, 0.925148666f},
-std::array<float,2>{0.230313301f, 0.512223423f},
-std::array<float,2>{0.536427915f, 0.442178667f},
-std::array<float,2>{0.101478949f, 0.355692029f},
-std::array<float,2>{0.635908961f, 0.710473776f},
-std::array<float,2>{0.407399207f, 0.855722904f},
-std::array<float,2>{0.869442582f, 0.236684412f},
-std::array<float,2>{0.240151942f, 0.100248858f},
-std::array<float,2>{0.5575611f, 0.890440822f},
-std::array<float,2>{0.254658848f, 0.560737371f},
-std::array<float,2>{0.913613617f, 0.490089476f},
-std::array<float,2>{0.428130984f, 0.330409169f},
-std::array<float,2>{0.850967586f, 0.726693749f},
-std::array<float,2>{0.116182424f, 0.841870785f},
-std::array<float,2>{0.647063553f, 0.209583849f},
-std::array<float,2>{0.368117094f, 0.169830516f},
-std::array<float,2>{0.982144177f, 0.779240251f},
-std::array<float,2>{0.15329133f, 0.63625139f},
-std::array<float,2>{0.622789443f, 0.256695896f},
-std::array<float,2>{0.00313060055f, 0.42854026f},
-std::array<float,2>{0.70511955f, 0.583096564f},
-std::array<float,2>{0.491729409f, 0.997849643f},
-std::array<float,2>{0.78993243f, 0.0178689193f},
-std::array<float,2>{0.0794084221f, 0.229885936f},
-std::array<float,2>{0.677943707f, 0.863247573f},
-std::array<float,2>{0.379923433f, 0.690436661f},
-std::array<float,2>{0.817810893f, 0.370784372f},
-std::array<float,2>{0.285496175f, 0.468195438f},
-std::array<float,2>{0.894806862f, 0.530105054f},
-std::array<float,2>{0.201884016f, 0.911560237f},
-std::array<float,2>{0.529139638f, 0.078363359f},
-std::array<float,2>{0.464006275f, 0.045258563f},
-std::array<float,2>{0.759797812f, 0.946215928f},
-std::array<float,2>{0.0624905042f, 0.597027659f},
-std::array<float,2>{0.727539122f, 0.394047439f},
-std::array<float,2>{0.184675843f, 0.30454725f},
-std::array<float,2>{0.592297971f, 0.682210326f},
-std::array<float,2>{0.315212011f, 0.784838438f},
-std::array<float,2>{0.954600632f, 0.145136744f},
-std::array<float,2>{0.0695534572f, 0.0369884595f},
-std::array<float,2>{0.668462455f, 0.943641365f},
-std::array<float,2>{0.401715338f, 0.602948606f},
-std::array<float,2>{0.83831346f, 0.402636707f},
-std::array<float,2>{0.306720644f, 0.310772032f},
-std::array<float,2>{0.88034004f, 0.679512858f},
-std::array<float,2>{0.208409965f, 0.794374228f},
-std::array<float,2>{0.513955116f, 0.151101395f},
-std::array<float,2>{0.440517098f, 0.223118514f},
-std::array<float,2>{0.76905781f, 0.871471941f},
-std::array<float,2>{0.0336007103f, 0.698619246f},
-std::array<float,2>{0.734895706f, 0.365713149f},
-std::array<float,2>{0.170287177f, 0.455553144f},
-std::array<float,2>{0.565466821f, 0.517264068f},
-std::array<float,2>{0.340667933f, 0.918884873f},
-std::array<float,2>{0.93886292f, 0.0908041969f},
-std::array<float,2>{0.231972739f, 0.161588162f},
-std::array<float,2>{0.532013416f, 0.772604942f},
-std::array<float,2>{0.266537279f, 0.630408227f},
-std::array<float,2>{0.926283598f, 0.258124858f},
-std::array<float,2>{0.412196964f, 0.435130358f},
-std::array<float,2>{0.874457181f, 0.593721986f},
-std::array<float,2>{0.0943187326f, 0.987130344f},
-std::array<float,2>{0.640059412f, 0.0284570828f},
-std::array<float,2>{0.356715798f, 0.102984414f},
-std::array<float,2>{0.995928764f, 0.879809439f},
-std::array<float,2>{0.132012799f, 0.549152493f},
-std::array<float,2>{0.604395986f, 0.493091226f},
-std::array<float,2>{0.0160647333f, 0.342482507f},
-std::array<float,2>{0.69773066f, 0.72072643f},
-std::array<float,2>{0.470241815f, 0.832236528f},
-std::array<float,2>{0.801871479f, 0.215496972f},
-std::array<float,2>{0.150275871f, 0.0641980469f},
-std::array<float,2>{0.619961679f, 0.930644453f},
-std::array<float,2>{0.373748958f, 0.501258969f},
-std::array<float,2>{0.978382707f, 0.446435034f},
-std::array<float,2>{0.485993654f, 0.345139205f},
-std::array<float,2>{0.796780348f, 0.717720807f},
-std::array<float,2>{0.00550862821f, 0.847646654f},
-std::array<float,2>{0.710502386f, 0.246049762f},
-std::array<float,2>{0.251387924f, 0.136064216f},
-std::array<float,2>{0.906635642f, 0.799492955f},
-std::array<float,2>{0.236334682f, 0.664624155f},
-std::array<float,2>{0.55888325f, 0.289289802f},
-std::array<float,2>{0.112389185f, 0.389767021f},
-std::array<float,2>{0.643921494f, 0.624980628f},
-std::array<float,2>{0.425614297f, 0.958160698f},
-std::array<float,2>{0.846439838f, 0.0510231964f},
-std::array<float,2>{0.0550554395f, 0.193938255f},
-std::array<float,2>{0.731158793f, 0.814397335f},
-std::array<float,2>{0.468668252f, 0.73830843f},
-std::array<float,2>{0.762023747f, 0.324528009f},
-std::array<float,2>{0.316464663f, 0.47089982f},
-std::array<float,2>{0.960848033f, 0.534095049f},
-std::array<float,2>{0.182205126f, 0.89608568f},
-std::array<float,2>{0.587661624f, 0.116555303f},
-std::array<float,2>{0.376787901f, 0.00789674558f},
-std::array<float,2>{0.813119948f, 0.973734736f},
-std::array<float,2>{0.0850209296f, 0.567864895f},
-std::array<float,2>{0.67375952f, 0.414821833f},
-std::array<float,2>{0.198523611f, 0.273119241f},
-std::array<float,2>{0.525893748f, 0.643787086f},
-std::array<float,2>{0.282433212f, 0.759511828f},
-std::array<float,2>{0.893982828f, 0.178054482f},
-std::array<float,2>{0.0121860988f, 0.121001869f},
-std::array<float,2>{0.717594206f, 0.898601115f},
-std::array<float,2>{0.499927849f, 0.544474661f},
-std::array<float,2>{0.78767544f, 0.479438543f},
-std::array<float,2>{0.363870293f, 0.313074976f},
-std::array<float,2>{0.969955266f, 0.748133898f},
-std::array<float,2>{0.140819162f, 0.825947583f},
-std::array<float,2>{0.61180377f, 0.196847558f},
-std::array<float,2>{0.43327257f, 0.182026207f},
-std::array<float,2>{0.853841782f, 0.750151396f},
-std::array<float,2>{0.124161817f, 0.652650595f},
-std::array<float,2>{0.653895855f, 0.27955994f},
-std::array<float,2>{0.2430747f, 0.413288832f},
-std::array<float,2>{0.549545884f, 0.572590351f},
-std::array<float,2>{0.262812436f, 0.98034817f},
-std::array<float,2>{0.916328609f, 0.00562179275f},
-std::array<float,2>{0.178293109f, 0.241619602f},
-std::array<float,2>{0.584183216f, 0.854007006f},
-std::array<float,2>{0.324284762f, 0.705898702f},
-std::array<float,2>{0.967280209f, 0.353806973f},
-std::array<float,2>{0.456063151f, 0.437839538f},
-std::array<float,2>{0.755405843f, 0.511331081f},
-std::array<float,2>{0.0517031848f, 0.927217543f},
-std::array<float,2>{0.724573016f, 0.0722057f},
-std::array<float,2>{0.291788518f, 0.0566243529f},
-std::array<float,2>{0.898600996f, 0.96507895f},
-std::array<float,2>{0.193256706f, 0.616985202f},
-std::array<float,2>{0.520843327f, 0.376133084f},
-std::array<float,2>{0.0867322385f, 0.288056731f},
-std::array<float,2>{0.68462503f, 0.66301769f},
-std::array<float,2>{0.385244846f, 0.807975173f},
-std::array<float,2>{0.821764171f, 0.125582874f},
-std::array<float,2>{0.21806024f, 0.0201857667f},
-std::array<float,2>{0.502990186f, 0.996001601f},
-std::array<float,2>{0.30283463f, 0.581926823f},
-std::array<float,2>{0.885949075f, 0.423334092f},
-std::array<float,2>{0.396559983f, 0.253576189f},
-std::array<float,2>{0.831380665f, 0.639894962f},
-std::array<float,2>{0.0765575245f, 0.776687384f},
-std::array<float,2>{0.663974464f, 0.164600447f},
-std::array<float,2>{0.335304856f, 0.204388693f},
-std::array<float,2>{0.949444592f, 0.837691247f},
-std::array<float,2>{0.159899831f, 0.734149635f},
-std::array<float,2>{0.574993551f, 0.334825844f},
-std::array<float,2>{0.0459833033f, 0.487768978f},
-std::array<float,2>{0.745682418f, 0.556384861f},
-std::array<float,2>{0.445661277f, 0.886499405f},
-std::array<float,2>{0.777245343f, 0.097513631f},
-std::array<float,2>{0.105654515f, 0.141658649f},
-std::array<float,2>{0.632729411f, 0.787114024f},
-std::array<float,2>{0.41812396f, 0.684057772f},
-std::array<float,2>{0.863296092f, 0.297115862f},
-std::array<float,2>{0.278371751f, 0.395508826f},
-std::array<float,2>{0.931021214f, 0.6011765f},
-std::array<float,2>{0.221180096f, 0.951335549f},
-std::array<float,2>{0.546570063f, 0.0405793525f},
-std::array<float,2>{0.484208167f, 0.0825512633f},
-std::array<float,2>{0.812271357f, 0.906981051f},
-std::array<float,2>{0.0301073417f, 0.524609327f},
-std::array<float,2>{0.691724122f, 0.462913275f},
-std::array<float,2>{0.133923799f, 0.372641265f},
-std::array<float,2>{0.599865913f, 0.694704294f},
-std::array<float,2>{0.344148576f, 0.864937127f},
-std::array<float,2>{0.987197757f, 0.233794823f},
-std::array<float,2>{0.0905665159f, 0.108097918f},
-std::array<float,2>{0.679948211f, 0.875499308f},
-std::array<float,2>{0.387199849f, 0.552990675f},
-std::array<float,2>{0.824501872f, 0.496379882f},
-std::array<float,2>{0.296149135f, 0.338337094f},
-std::array<float,2>{0.905970752f, 0.723434746f},
-std::array<float,2>{0.191236377f, 0.829288661f},
-std::array<float,2>{0.516377449f, 0.21108067f},
-std::array<float,2>{0.45866853f, 0.158521712f},
-std::array<float,2>{0.751528144f, 0.768167555f},
-std::array<float,2>{0.0489380285f, 0.627343059f},
-std::array<float,2>{0.719808221f, 0.262402385f},
-std::array<float,2>{0.173168525f, 0.430835128f},
-std::array<float,2>{0.582017899f, 0.586457312f},
-std::array<float,2>{0.323781669f, 0.988828182f},
-std::array<float,2>{0.963389099f, 0.0242433399f},
-std::array<float,2>{0.246746957f, 0.221104622f},
-std::array<float,2>{0.552241981f, 0.868015707f},
-std::array<float,2>{0.259982407f, 0.701877952f},
-std::array<float,2>{0.921121478f, 0.363012314f},
-std::array<float,2>{0.437179774f, 0.460619897f},
-std::array<float,2>{0.856774569f, 0.521395504f},
-std::array<float,2>{0.119787276f, 0.916936815f},
-std::array<float,2>{0.652325273f, 0.0861031562f},
-std::array<float,2>{0.361474276f, 0.0331388004f},
-std::array<float,2>{0.976328731f, 0.939760029f},
-std::array<float,2>{0.146882758f, 0.608414829f},
-std::array<float,2>{0.613597572f, 0.402167678f},
-std::array<float,2>{0.0116860671f, 0.304958671f},
-std::array<float,2>{0.711928666f, 0.673662066f},
-std::array<float,2>{0.493181527f, 0.790289819f},
-std::array<float,2>{0.784476876f, 0.154665828f},
-std::array<float,2>{0.138338834f, 0.014489268f},
-std::array<float,2>{0.596879423f, 0.971519291f},
-std::array<float,2>{0.348876774f, 0.564699829f},
-std::array<float,2>{0.989810944f, 0.419347048f},
-std::array<float,2>{0.47754851f, 0.268479288f},
-std::array<float,2>{0.806119025f, 0.647233069f},
-std::array<float,2>{0.0256271362f, 0.763212681f},
-std::array<float,2>{0.689543128f, 0.172891334f},
-std::array<float,2>{0.274941176f, 0.190374583f},
-std::array<float,2>{0.934030533f, 0.8198511f},
-std::array<float,2>{0.222782716f, 0.734993517f},
-std::array<float,2>{0.542286098f, 0.321460456f},
-std::array<float,2>{0.105360717f, 0.473070562f},
-std::array<float,2>{0.626825929f, 0.535689831f},
-std::array<float,2>{0.417920023f, 0.891389608f},
-std::array<float,2>{0.860698223f, 0.109416611f},
-std::array<float,2>{0.0420257226f, 0.140138879f},
-std::array<float,2>{0.748780429f, 0.80436492f},
-std::array<float,2>{0.450002253f, 0.668839097f},
-std::array<float,2>{0.780168951f, 0.295087665f},
-std::array<float,2>{0.331427455f, 0.385341108f},
-std::array<float,2>{0.945410371f, 0.618121743f},
-std::array<float,2>{0.161971852f, 0.955373824f},
-std::array<float,2>{0.573728263f, 0.0489594825f},
-std::array<float,2>{0.393687904f, 0.0678975135f},
-std::array<float,2>{0.83360815f, 0.936628044f},
-std::array<float,2>{0.0714298412f, 0.504961431f},
-std::array<float,2>{0.659902692f, 0.450482458f},
-std::array<float,2>{0.213511333f, 0.350987613f},
-std::array<float,2>{0.507237077f, 0.711247802f},
-std::array<float,2>{0.297937542f, 0.85014832f},
-std::array<float,2>{0.887381732f, 0.249183014f},
-std::array<float,2>{0.0222872049f, 0.0585976355f},
-std::array<float,2>{0.69962126f, 0.96305877f},
-std::array<float,2>{0.476328909f, 0.610396385f},
-std::array<float,2>{0.797636211f, 0.382291853f},
-std::array<float,2>{0.351801395f, 0.284693241f},
-std::array<float,2>{0.997837543f, 0.657127082f},
-std::array<float,2>{0.127487928f, 0.811959684f},
-std::array<float,2>{0.608026624f, 0.131809384f},
-std::array<float,2>{0.40887329f, 0.236252949f},
-std::array<float,2>{0.868318677f, 0.859312713f},
-std::array<float,2>{0.0984690636f, 0.707046986f},
-std::array<float,2>{0.634235859f, 0.358969212f},
-std::array<float,2>{0.228134334f, 0.444966882f},
-std::array<float,2>{0.537342072f, 0.514628887f},
-std::array<float,2>{0.272039771f, 0.922610998f},
-std::array<float,2>{0.924047172f, 0.0767378882f},
-std::array<float,2>{0.16463013f, 0.186077222f},
-std::array<float,2>{0.568329155f, 0.75688231f},
-std::array<float,2>{0.338889956f, 0.651628673f},
-std::array<float,2>{0.94434166f, 0.27659753f},
-std::array<float,2>{0.445244163f, 0.409197837f},
-std::array<float,2>{0.772135317f, 0.576094508f},
-std::array<float,2>{0.0383640155f, 0.982612669f},
-std::array<float,2>{0.739129186f, 0.00325624784f},
-std::array<float,2>{0.310596019f, 0.121836565f},
-std::array<float,2>{0.875201464f, 0.904989779f},
-std::array<float,2>{0.206873491f, 0.542659283f},
-std::array<float,2>{0.509548366f, 0.483853757f},
-std::array<float,2>{0.0645741522f, 0.319626004f},
-std::array<float,2>{0.665400684f, 0.745738089f},
-std::array<float,2>{0.402571678f, 0.822981477f},
-std::array<float,2>{0.842394531f, 0.202463597f},
-std::array<float,2>{0.199596569f, 0.0813478678f},
-std::array<float,2>{0.530537426f, 0.912743628f},
-std::array<float,2>{0.289026856f, 0.527705669f},
-std::array<float,2>{0.896578252f, 0.465586334f},
-std::array<float,2>{0.381123632f, 0.368814737f},
-std::array<float,2>{0.818893373f, 0.687597275f},
-std::array<float,2>{0.0800925791f, 0.861058176f},
-std::array<float,2>{0.676609099f, 0.228028983f},
-std::array<float,2>{0.313037038f, 0.148188323f},
-std::array<float,2>{0.955744982f, 0.782276213f},
-std::array<float,2>{0.187307209f, 0.679931164f},
-std::array<float,2>{0.591599941f, 0.302124679f},
-std::array<float,2>{0.0594024099f, 0.391598105f},
-std::array<float,2>{0.729462326f, 0.595139861f},
-std::array<float,2>{0.462371022f, 0.947545171f},
-std::array<float,2>{0.758918405f, 0.0442308784f},
-std::array<float,2>{0.115124352f, 0.20738636f},
-std::array<float,2>{0.646109343f, 0.840854704f},
-std::array<float,2>{0.427411824f, 0.729530752f},
-std::array<float,2>{0.848828197f, 0.329036564f},
-std::array<float,2>{0.255876184f, 0.490882725f},
-std::array<float,2>{0.910389185f, 0.559851408f},
-std::array<float,2>{0.240507588f, 0.8867836f},
-std::array<float,2>{0.554878414f, 0.0980190858f},
-std::array<float,2>{0.489495337f, 0.017354019f},
-std::array<float,2>{0.791847885f, 0.998619795f},
-std::array<float,2>{0.000502535608f, 0.584241509f},
-std::array<float,2>{0.703449249f, 0.426647067f},
-std::array<float,2>{0.154501587f, 0.255779177f},
-std::array<float,2>{0.623984814f, 0.633127809f},
-std::array<float,2>{0.369786173f, 0.780269563f},
-std::array<float,2>{0.983573914f, 0.170323372f},
-std::array<float,2>{0.0963200405f, 0.0295844581f},
-std::array<float,2>{0.637135446f, 0.985743582f},
-std::array<float,2>{0.411000282f, 0.590813577f},
-std::array<float,2>{0.872962654f, 0.436893195f},
-std::array<float,2>{0.268214375f, 0.260627627f},
-std::array<float,2>{0.929597855f, 0.631560922f},
-std::array<float,2>{0.232943222f, 0.770977974f},
-std::array<float,2>{0.533974588f, 0.163234085f},
-std::array<float,2>{0.471066535f, 0.218726739f},
-std::array<float,2>{0.803831995f, 0.835922241f},
-std::array<float,2>{0.018984789f, 0.719088256f},
-std::array<float,2>{0.69643122f, 0.340547293f},
-std::array<float,2>{0.130611673f, 0.4957591f},
-std::array<float,2>{0.602719665f, 0.546994209f},
-std::array<float,2>{0.357471585f, 0.880885124f},
-std::array<float,2>{0.992276728f, 0.105004109f},
-std::array<float,2>{0.209077314f, 0.149042577f},
-std::array<float,2>{0.512278676f, 0.796830535f},
-std::array<float,2>{0.30564189f, 0.676672757f},
-std::array<float,2>{0.881831825f, 0.309407353f},
-std::array<float,2>{0.399962306f, 0.40459609f},
-std::array<float,2>{0.837377191f, 0.604281723f},
-std::array<float,2>{0.0676579177f, 0.942937493f},
-std::array<float,2>{0.670966983f, 0.0376304686f},
-std::array<float,2>{0.343111813f, 0.0925345123f},
-std::array<float,2>{0.940846026f, 0.920534015f},
-std::array<float,2>{0.169817179f, 0.518558681f},
-std::array<float,2>{0.56352371f, 0.453455478f},
-std::array<float,2>{0.032626953f, 0.363366336f},
-std::array<float,2>{0.738123178f, 0.695322752f},
-std::array<float,2>{0.439409375f, 0.874147296f},
-std::array<float,2>{0.766694486f, 0.225778356f},
-std::array<float,2>{0.180850878f, 0.113928571f},
-std::array<float,2>{0.588204682f, 0.897665679f},
-std::array<float,2>{0.320256442f, 0.532014072f},
-std::array<float,2>{0.957978487f, 0.469665885f},
-std::array<float,2>{0.466171771f, 0.327447027f},
-std::array<float,2>{0.765273809f, 0.741672516f},
-std::array<float,2>{0.0579031929f, 0.814716637f},
-std::array<float,2>{0.732693136f, 0.193120062f},
-std::array<float,2>{0.284705102f, 0.177331969f},
-std::array<float,2>{0.89129889f, 0.760997772f},
-std::array<float,2>{0.196586549f, 0.642084777f},
-std::array<float,2>{0.524442255f, 0.27101171f},
-std::array<float,2>{0.0833695009f, 0.417442769f},
-std::array<float,2>{0.673961461f, 0.569282115f},
-std::array<float,2>{0.376967251f, 0.974704862f},
-std::array<float,2>{0.81478864f, 0.00995989051f},
-std::array<float,2>{0.00721508171f, 0.243201435f},
-std::array<float,2>{0.707947075f, 0.844642639f},
-std::array<float,2>{0.48755011f, 0.71487844f},
-std::array<float,2>{0.793526232f, 0.346269965f},
-std::array<float,2>{0.371775568f, 0.449186355f},
-std::array<float,2>{0.979795039f, 0.502706289f},
-std::array<float,2>{0.150775179f, 0.932518065f},
-std::array<float,2>{0.61796546f, 0.0646043718f},
-std::array<float,2>{0.422031432f, 0.0528079979f},
-std::array<float,2>{0.845302701f, 0.959944308f},
-std::array<float,2>{0.109755874f, 0.622720838f},
-std::array<float,2>{0.642189622f, 0.388439268f},
-std::array<float,2>{0.236121327f, 0.292909682f},
-std::array<float,2>{0.561863422f, 0.667674541f},
-std::array<float,2>{0.253257006f, 0.798552692f},
-std::array<float,2>{0.909380615f, 0.133154184f},
-std::array<float,2>{0.0532784499f, 0.0738594979f},
-std::array<float,2>{0.725359321f, 0.927939773f},
-std::array<float,2>{0.453681916f, 0.508526027f},
-std::array<float,2>{0.757353127f, 0.441029131f},
-std::array<float,2>{0.326449722f, 0.352910906f},
-std::array<float,2>{0.965643167f, 0.704674542f},
-std::array<float,2>{0.176156908f, 0.851941168f},
-std::array<float,2>{0.582327485f, 0.239345074f},
-std::array<float,2>{0.384439528f, 0.127323806f},
-std::array<float,2>{0.824065208f, 0.805414498f},
-std::array<float,2>{0.0884120315f, 0.661951184f},
-std::array<float,2>{0.686525345f, 0.287034154f},
-std::array<float,2>{0.195128977f, 0.378568918f},
-std::array<float,2>{0.522038043f, 0.613824725f},
-std::array<float,2>{0.289862454f, 0.968661964f},
-std::array<float,2>{0.900687158f, 0.056834612f},
-std::array<float,2>{0.143908113f, 0.198676154f},
-std::array<float,2>{0.611310244f, 0.827950716f},
-std::array<float,2>{0.365666091f, 0.747926116f},
-std::array<float,2>{0.972078264f, 0.314830959f},
-std::array<float,2>{0.496549606f, 0.477888674f},
-std::array<float,2>{0.785776973f, 0.546836853f},
-std::array<float,2>{0.0145406462f, 0.90045017f},
-std::array<float,2>{0.715567052f, 0.118354164f},
-std::array<float,2>{0.264249593f, 0.00705476804f},
-std::array<float,2>{0.914280653f, 0.977541685f},
-std::array<float,2>{0.24449338f, 0.571389258f},
-std::array<float,2>{0.547582984f, 0.410461307f},
-std::array<float,2>{0.12273372f, 0.279009849f},
-std::array<float,2>{0.654731929f, 0.655595601f},
-std::array<float,2>{0.430066466f, 0.752680659f},
-std::array<float,2>{0.85205245f, 0.18099837f},
-std::array<float,2>{0.219254076f, 0.0428468995f},
-std::array<float,2>{0.544026852f, 0.951038539f},
-std::array<float,2>{0.279626191f, 0.597917616f},
-std::array<float,2>{0.933047473f, 0.398127854f},
-std::array<float,2>{0.42135635f, 0.300031334f},
-std::array<float,2>{0.865689993f, 0.686806381f},
-std::array<float,2>{0.108216211f, 0.786628485f},
-std::array<float,2>{0.629117787f, 0.143152431f},
-std::array<float,2>{0.346547037f, 0.230784193f},
-std::array<float,2>{0.986187398f, 0.866060913f},
-std::array<float,2>{0.135225579f, 0.691948175f},
-std::array<float,2>{0.598457754f, 0.374135435f},
-std::array<float,2>{0.0274161603f, 0.462090582f},
-std::array<float,2>{0.693879187f, 0.527341008f},
-std::array<float,2>{0.482324392f, 0.910112083f},
-std::array<float,2>{0.809066236f, 0.0855703577f},
-std::array<float,2>{0.0747690797f, 0.167114243f},
-std::array<float,2>{0.661095679f, 0.774729192f},
-std::array<float,2>{0.394728541f, 0.637650549f},
-std::array<float,2>{0.828441858f, 0.250308782f},
-std::array<float,2>{0.301824898f, 0.425263613f},
-std::array<float,2>{0.884478807f, 0.578463018f},
-std::array<float,2>{0.216336071f, 0.992675602f},
-std::array<float,2>{0.500347376f, 0.0218132325f},
-std::array<float,2>{0.448487282f, 0.0952934548f},
-std::array<float,2>{0.77476275f, 0.882958293f},
-std::array<float,2>{0.0433097892f, 0.557197034f},
-std::array<float,2>{0.742306411f, 0.485548049f},
-std::array<float,2>{0.157305375f, 0.333521813f},
-std::array<float,2>{0.577285767f, 0.730491459f},
-std::array<float,2>{0.332365453f, 0.838221729f},
-std::array<float,2>{0.951271951f, 0.206341535f}}
\ No newline at end of file
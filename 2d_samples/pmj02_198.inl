@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.0220287535f, 0.774100184f},
-std::array<float,2>{0.721780062f, 0.187273785f},
-std::array<float,2>{0.427290767f, 0.349822104f},
-std::array<float,2>{0.972420871f, 0.521377683f},
-std::array<float,2>{0.340973228f, 0.72562325f},
-std::array<float,2>{0.870049775f, 0.468643785f},
-std::array<float,2>{0.211512119f, 0.0342611745f},
-std::array<float,2>{0.523146152f, 0.956697226f},
-std::array<float,2>{0.169560507f, 0.620384634f},
-std::array<float,2>{0.592499197f, 0.289905608f},
-std::array<float,2>{0.276151896f, 0.201045647f},
-std::array<float,2>{0.777524233f, 0.867850542f},
-std::array<float,2>{0.491535276f, 0.901011944f},
-std::array<float,2>{0.889077663f, 0.0804559216f},
-std::array<float,2>{0.0739841014f, 0.424605936f},
-std::array<float,2>{0.651358366f, 0.673087239f},
-std::array<float,2>{0.22727859f, 0.970440447f},
-std::array<float,2>{0.557973325f, 0.0238295179f},
-std::array<float,2>{0.350931257f, 0.493447006f},
-std::array<float,2>{0.84129709f, 0.71207732f},
-std::array<float,2>{0.383555353f, 0.555623174f},
-std::array<float,2>{0.963704288f, 0.339038074f},
-std::array<float,2>{0.0507223234f, 0.145153075f},
-std::array<float,2>{0.706189334f, 0.79469198f},
-std::array<float,2>{0.116701491f, 0.634456038f},
-std::array<float,2>{0.68058002f, 0.390621603f},
-std::array<float,2>{0.454328239f, 0.100247584f},
-std::array<float,2>{0.915434301f, 0.91223371f},
-std::array<float,2>{0.292563349f, 0.837388515f},
-std::array<float,2>{0.791711509f, 0.234279528f},
-std::array<float,2>{0.143829152f, 0.274753273f},
-std::array<float,2>{0.602267742f, 0.576466918f},
-std::array<float,2>{0.0793113038f, 0.927968144f},
-std::array<float,2>{0.635226488f, 0.122633219f},
-std::array<float,2>{0.476280063f, 0.404460371f},
-std::array<float,2>{0.901141703f, 0.656057358f},
-std::array<float,2>{0.256569535f, 0.589268804f},
-std::array<float,2>{0.765210807f, 0.25990507f},
-std::array<float,2>{0.18386592f, 0.238616899f},
-std::array<float,2>{0.570381522f, 0.820638657f},
-std::array<float,2>{0.188728184f, 0.691610396f},
-std::array<float,2>{0.504893124f, 0.483939111f},
-std::array<float,2>{0.327260733f, 0.00317872665f},
-std::array<float,2>{0.846195757f, 0.987343729f},
-std::array<float,2>{0.4116427f, 0.801379621f},
-std::array<float,2>{0.99917239f, 0.128077656f},
-std::array<float,2>{0.0129225114f, 0.314550042f},
-std::array<float,2>{0.739243627f, 0.539413869f},
-std::array<float,2>{0.132393032f, 0.849010408f},
-std::array<float,2>{0.623862386f, 0.20420894f},
-std::array<float,2>{0.311048388f, 0.303292781f},
-std::array<float,2>{0.802954674f, 0.597840965f},
-std::array<float,2>{0.447789192f, 0.662237227f},
-std::array<float,2>{0.922893405f, 0.421364307f},
-std::array<float,2>{0.0977421775f, 0.0659636259f},
-std::array<float,2>{0.664049566f, 0.88713336f},
-std::array<float,2>{0.0446158461f, 0.510614872f},
-std::array<float,2>{0.691945434f, 0.3608751f},
-std::array<float,2>{0.39725551f, 0.169266894f},
-std::array<float,2>{0.938455582f, 0.756612122f},
-std::array<float,2>{0.363094121f, 0.94645381f},
-std::array<float,2>{0.818199337f, 0.0486130416f},
-std::array<float,2>{0.239772603f, 0.438666135f},
-std::array<float,2>{0.536473811f, 0.746195674f},
-std::array<float,2>{0.102917269f, 0.813999474f},
-std::array<float,2>{0.67149061f, 0.24272798f},
-std::array<float,2>{0.444063127f, 0.25458768f},
-std::array<float,2>{0.932064116f, 0.581681252f},
-std::array<float,2>{0.301944256f, 0.64824307f},
-std::array<float,2>{0.808412254f, 0.397679597f},
-std::array<float,2>{0.139622688f, 0.11222697f},
-std::array<float,2>{0.611459553f, 0.934115231f},
-std::array<float,2>{0.248052016f, 0.538581491f},
-std::array<float,2>{0.542072177f, 0.326167881f},
-std::array<float,2>{0.372929811f, 0.139438078f},
-std::array<float,2>{0.821656346f, 0.805708945f},
-std::array<float,2>{0.399985373f, 0.996713221f},
-std::array<float,2>{0.947899401f, 0.0153421164f},
-std::array<float,2>{0.0368538909f, 0.470558435f},
-std::array<float,2>{0.701290131f, 0.696210384f},
-std::array<float,2>{0.179427132f, 0.879776239f},
-std::array<float,2>{0.565521002f, 0.074787192f},
-std::array<float,2>{0.260478944f, 0.409533024f},
-std::array<float,2>{0.757215977f, 0.668614209f},
-std::array<float,2>{0.480956435f, 0.603504717f},
-std::array<float,2>{0.894046545f, 0.30788061f},
-std::array<float,2>{0.0866344422f, 0.211100608f},
-std::array<float,2>{0.625236928f, 0.857745647f},
-std::array<float,2>{0.00371894706f, 0.739372313f},
-std::array<float,2>{0.744872868f, 0.452140331f},
-std::array<float,2>{0.414779931f, 0.0563565046f},
-std::array<float,2>{0.985273719f, 0.93770957f},
-std::array<float,2>{0.317176908f, 0.763318062f},
-std::array<float,2>{0.852262616f, 0.159169734f},
-std::array<float,2>{0.195564568f, 0.37136358f},
-std::array<float,2>{0.511106789f, 0.500283599f},
-std::array<float,2>{0.0580243692f, 0.961120427f},
-std::array<float,2>{0.715851784f, 0.0398773625f},
-std::array<float,2>{0.378020734f, 0.457766652f},
-std::array<float,2>{0.954535604f, 0.729617059f},
-std::array<float,2>{0.3589122f, 0.528000355f},
-std::array<float,2>{0.834671021f, 0.355144709f},
-std::array<float,2>{0.219287977f, 0.174911246f},
-std::array<float,2>{0.54985261f, 0.773377717f},
-std::array<float,2>{0.150457487f, 0.679738581f},
-std::array<float,2>{0.59493655f, 0.433304489f},
-std::array<float,2>{0.288472652f, 0.0895800591f},
-std::array<float,2>{0.782452285f, 0.891436756f},
-std::array<float,2>{0.461374849f, 0.860541403f},
-std::array<float,2>{0.91361624f, 0.190420732f},
-std::array<float,2>{0.119172186f, 0.288695127f},
-std::array<float,2>{0.677319109f, 0.615043998f},
-std::array<float,2>{0.206501871f, 0.783259451f},
-std::array<float,2>{0.523855507f, 0.153850958f},
-std::array<float,2>{0.334815025f, 0.333279014f},
-std::array<float,2>{0.862294734f, 0.548738897f},
-std::array<float,2>{0.436512172f, 0.704583526f},
-std::array<float,2>{0.982005358f, 0.484490842f},
-std::array<float,2>{0.0289009679f, 0.0178494919f},
-std::array<float,2>{0.727103293f, 0.979687154f},
-std::array<float,2>{0.0702292994f, 0.56638062f},
-std::array<float,2>{0.647927344f, 0.273075014f},
-std::array<float,2>{0.496760905f, 0.226311982f},
-std::array<float,2>{0.877256989f, 0.830913246f},
-std::array<float,2>{0.266442686f, 0.919401467f},
-std::array<float,2>{0.770119429f, 0.107636265f},
-std::array<float,2>{0.156582415f, 0.377156466f},
-std::array<float,2>{0.581175983f, 0.626718938f},
-std::array<float,2>{0.0751659125f, 0.810902536f},
-std::array<float,2>{0.652983665f, 0.133926243f},
-std::array<float,2>{0.487438023f, 0.322889835f},
-std::array<float,2>{0.884475648f, 0.534399092f},
-std::array<float,2>{0.278345436f, 0.700672746f},
-std::array<float,2>{0.776408672f, 0.475491822f},
-std::array<float,2>{0.165211797f, 0.00961032789f},
-std::array<float,2>{0.586190462f, 0.994522989f},
-std::array<float,2>{0.21733579f, 0.584987998f},
-std::array<float,2>{0.51934725f, 0.250721872f},
-std::array<float,2>{0.336779207f, 0.247524872f},
-std::array<float,2>{0.87113601f, 0.818502963f},
-std::array<float,2>{0.422639668f, 0.932464778f},
-std::array<float,2>{0.97615999f, 0.116643734f},
-std::array<float,2>{0.0158500001f, 0.393933028f},
-std::array<float,2>{0.724721372f, 0.641616702f},
-std::array<float,2>{0.146475032f, 0.941601872f},
-std::array<float,2>{0.605872512f, 0.0619401f},
-std::array<float,2>{0.295506597f, 0.447294503f},
-std::array<float,2>{0.795954347f, 0.736470342f},
-std::array<float,2>{0.459449559f, 0.50629288f},
-std::array<float,2>{0.919052482f, 0.368629068f},
-std::array<float,2>{0.112584941f, 0.160831988f},
-std::array<float,2>{0.686566472f, 0.757933557f},
-std::array<float,2>{0.0525252037f, 0.667057812f},
-std::array<float,2>{0.707598209f, 0.411671788f},
-std::array<float,2>{0.387507319f, 0.0715795234f},
-std::array<float,2>{0.965207458f, 0.876197577f},
-std::array<float,2>{0.343907326f, 0.852528036f},
-std::array<float,2>{0.837876022f, 0.217665091f},
-std::array<float,2>{0.23395589f, 0.310729355f},
-std::array<float,2>{0.562103331f, 0.605785012f},
-std::array<float,2>{0.00933053158f, 0.895421207f},
-std::array<float,2>{0.737155974f, 0.0926930457f},
-std::array<float,2>{0.408571988f, 0.434268653f},
-std::array<float,2>{0.993896008f, 0.68523705f},
-std::array<float,2>{0.321739167f, 0.610760093f},
-std::array<float,2>{0.850578606f, 0.281718135f},
-std::array<float,2>{0.192266762f, 0.194706604f},
-std::array<float,2>{0.502822578f, 0.866197228f},
-std::array<float,2>{0.181830376f, 0.734286249f},
-std::array<float,2>{0.576664507f, 0.454251885f},
-std::array<float,2>{0.25364086f, 0.0437488928f},
-std::array<float,2>{0.76135844f, 0.966230273f},
-std::array<float,2>{0.472079486f, 0.76787442f},
-std::array<float,2>{0.905610561f, 0.178645119f},
-std::array<float,2>{0.0855431706f, 0.359283984f},
-std::array<float,2>{0.639908135f, 0.52625984f},
-std::array<float,2>{0.236208782f, 0.832325876f},
-std::array<float,2>{0.533235073f, 0.219990492f},
-std::array<float,2>{0.367004037f, 0.266627967f},
-std::array<float,2>{0.816369474f, 0.56967032f},
-std::array<float,2>{0.391085535f, 0.632043958f},
-std::array<float,2>{0.94339478f, 0.379749328f},
-std::array<float,2>{0.0399406627f, 0.105262086f},
-std::array<float,2>{0.688985765f, 0.915610254f},
-std::array<float,2>{0.0963469669f, 0.554098129f},
-std::array<float,2>{0.657181025f, 0.329635054f},
-std::array<float,2>{0.452973664f, 0.1501984f},
-std::array<float,2>{0.927249849f, 0.786403418f},
-std::array<float,2>{0.307128102f, 0.982458055f},
-std::array<float,2>{0.799512863f, 0.0213123597f},
-std::array<float,2>{0.126237631f, 0.489524037f},
-std::array<float,2>{0.620070457f, 0.709091783f},
-std::array<float,2>{0.0327091478f, 0.874422073f},
-std::array<float,2>{0.696524322f, 0.196989536f},
-std::array<float,2>{0.403467298f, 0.296162754f},
-std::array<float,2>{0.950459421f, 0.622873783f},
-std::array<float,2>{0.370898426f, 0.679431975f},
-std::array<float,2>{0.826078176f, 0.426081389f},
-std::array<float,2>{0.245408028f, 0.0852020457f},
-std::array<float,2>{0.546007931f, 0.904141128f},
-std::array<float,2>{0.132819265f, 0.515671968f},
-std::array<float,2>{0.615912795f, 0.34488073f},
-std::array<float,2>{0.299070209f, 0.182207659f},
-std::array<float,2>{0.810049653f, 0.777700067f},
-std::array<float,2>{0.437868774f, 0.958755791f},
-std::array<float,2>{0.934782982f, 0.0380872078f},
-std::array<float,2>{0.107983097f, 0.46457538f},
-std::array<float,2>{0.666113317f, 0.719661176f},
-std::array<float,2>{0.199589953f, 0.907322288f},
-std::array<float,2>{0.512112677f, 0.0955141559f},
-std::array<float,2>{0.312969446f, 0.385310113f},
-std::array<float,2>{0.858028591f, 0.638139188f},
-std::array<float,2>{0.418688655f, 0.571944892f},
-std::array<float,2>{0.989434659f, 0.280165017f},
-std::array<float,2>{0.00525716599f, 0.229603425f},
-std::array<float,2>{0.747285187f, 0.842381239f},
-std::array<float,2>{0.0933163911f, 0.7175861f},
-std::array<float,2>{0.630585134f, 0.497956395f},
-std::array<float,2>{0.477268934f, 0.0307039451f},
-std::array<float,2>{0.897011578f, 0.974959016f},
-std::array<float,2>{0.263784617f, 0.792567551f},
-std::array<float,2>{0.750967562f, 0.142839849f},
-std::array<float,2>{0.174697995f, 0.342399091f},
-std::array<float,2>{0.569165707f, 0.558939993f},
-std::array<float,2>{0.121252261f, 0.988506794f},
-std::array<float,2>{0.672160029f, 0.0056908736f},
-std::array<float,2>{0.468560725f, 0.479077548f},
-std::array<float,2>{0.90998286f, 0.690825224f},
-std::array<float,2>{0.283716857f, 0.54565531f},
-std::array<float,2>{0.786161065f, 0.317215353f},
-std::array<float,2>{0.154337361f, 0.131820962f},
-std::array<float,2>{0.600465417f, 0.799592197f},
-std::array<float,2>{0.223934308f, 0.651133716f},
-std::array<float,2>{0.554369986f, 0.399200916f},
-std::array<float,2>{0.355401754f, 0.117592633f},
-std::array<float,2>{0.831769645f, 0.921887398f},
-std::array<float,2>{0.379063904f, 0.825974762f},
-std::array<float,2>{0.958874047f, 0.23720026f},
-std::array<float,2>{0.0622505061f, 0.263761163f},
-std::array<float,2>{0.714337647f, 0.59071815f},
-std::array<float,2>{0.163590729f, 0.753431499f},
-std::array<float,2>{0.583758354f, 0.165280506f},
-std::array<float,2>{0.272345334f, 0.364071935f},
-std::array<float,2>{0.76826781f, 0.513344765f},
-std::array<float,2>{0.492446631f, 0.744352937f},
-std::array<float,2>{0.881409824f, 0.444489211f},
-std::array<float,2>{0.0629170984f, 0.0545599386f},
-std::array<float,2>{0.640858889f, 0.949467659f},
-std::array<float,2>{0.024384398f, 0.595150828f},
-std::array<float,2>{0.734027326f, 0.300291091f},
-std::array<float,2>{0.433403909f, 0.210911885f},
-std::array<float,2>{0.978722632f, 0.844670534f},
-std::array<float,2>{0.329263419f, 0.882837415f},
-std::array<float,2>{0.866607606f, 0.0699226037f},
-std::array<float,2>{0.207098708f, 0.415377825f},
-std::array<float,2>{0.531180084f, 0.660155654f},
-std::array<float,2>{0.0473676063f, 0.794957161f},
-std::array<float,2>{0.703881562f, 0.148083359f},
-std::array<float,2>{0.385758728f, 0.336470038f},
-std::array<float,2>{0.962710679f, 0.557017982f},
-std::array<float,2>{0.34854123f, 0.713715613f},
-std::array<float,2>{0.842749655f, 0.495682597f},
-std::array<float,2>{0.229076207f, 0.026577998f},
-std::array<float,2>{0.555377245f, 0.971927524f},
-std::array<float,2>{0.140635237f, 0.575200915f},
-std::array<float,2>{0.605303705f, 0.277291864f},
-std::array<float,2>{0.289894789f, 0.231786326f},
-std::array<float,2>{0.790909827f, 0.838173807f},
-std::array<float,2>{0.456665635f, 0.912001133f},
-std::array<float,2>{0.917024076f, 0.0993263647f},
-std::array<float,2>{0.113698162f, 0.38785708f},
-std::array<float,2>{0.682923257f, 0.63529563f},
-std::array<float,2>{0.213504717f, 0.953616023f},
-std::array<float,2>{0.521202207f, 0.0325507186f},
-std::array<float,2>{0.342428803f, 0.465180665f},
-std::array<float,2>{0.868969798f, 0.724187613f},
-std::array<float,2>{0.427896798f, 0.521817446f},
-std::array<float,2>{0.969131172f, 0.347784072f},
-std::array<float,2>{0.0203466173f, 0.184768572f},
-std::array<float,2>{0.72017771f, 0.775834799f},
-std::array<float,2>{0.0711251423f, 0.673950076f},
-std::array<float,2>{0.648929894f, 0.422729045f},
-std::array<float,2>{0.490122914f, 0.0783418119f},
-std::array<float,2>{0.887874544f, 0.898697138f},
-std::array<float,2>{0.274850786f, 0.870874345f},
-std::array<float,2>{0.779446423f, 0.20141466f},
-std::array<float,2>{0.170292556f, 0.291180044f},
-std::array<float,2>{0.591108084f, 0.617522776f},
-std::array<float,2>{0.101070575f, 0.88969481f},
-std::array<float,2>{0.66071254f, 0.0638665333f},
-std::array<float,2>{0.446440518f, 0.41963914f},
-std::array<float,2>{0.925245464f, 0.662048817f},
-std::array<float,2>{0.30910933f, 0.599911809f},
-std::array<float,2>{0.801210523f, 0.300887316f},
-std::array<float,2>{0.128943324f, 0.206229731f},
-std::array<float,2>{0.622088313f, 0.851092339f},
-std::array<float,2>{0.240714416f, 0.748405278f},
-std::array<float,2>{0.537717998f, 0.439959764f},
-std::array<float,2>{0.361001223f, 0.05037627f},
-std::array<float,2>{0.819984674f, 0.947585821f},
-std::array<float,2>{0.395098388f, 0.755403876f},
-std::array<float,2>{0.940203369f, 0.17098093f},
-std::array<float,2>{0.0454471111f, 0.361827016f},
-std::array<float,2>{0.694118023f, 0.508842289f},
-std::array<float,2>{0.185614929f, 0.823353767f},
-std::array<float,2>{0.573314011f, 0.241506189f},
-std::array<float,2>{0.255110025f, 0.258784086f},
-std::array<float,2>{0.763342798f, 0.586336195f},
-std::array<float,2>{0.474060327f, 0.653063715f},
-std::array<float,2>{0.89899826f, 0.403380662f},
-std::array<float,2>{0.0809687003f, 0.123942874f},
-std::array<float,2>{0.633959293f, 0.926012695f},
-std::array<float,2>{0.0140193701f, 0.542657077f},
-std::array<float,2>{0.74141556f, 0.313240916f},
-std::array<float,2>{0.413055599f, 0.126740724f},
-std::array<float,2>{0.997600496f, 0.803198755f},
-std::array<float,2>{0.324899644f, 0.984694242f},
-std::array<float,2>{0.844044805f, 0.000380310958f},
-std::array<float,2>{0.190925241f, 0.481739402f},
-std::array<float,2>{0.507387638f, 0.695241213f},
-std::array<float,2>{0.0897736773f, 0.856102526f},
-std::array<float,2>{0.628304482f, 0.214170307f},
-std::array<float,2>{0.482437462f, 0.305484831f},
-std::array<float,2>{0.89071697f, 0.604866922f},
-std::array<float,2>{0.258240342f, 0.671199143f},
-std::array<float,2>{0.75458467f, 0.407321781f},
-std::array<float,2>{0.176737711f, 0.0772124901f},
-std::array<float,2>{0.5644086f, 0.881207943f},
-std::array<float,2>{0.197464049f, 0.503269374f},
-std::array<float,2>{0.509622455f, 0.37373364f},
-std::array<float,2>{0.319342136f, 0.156291977f},
-std::array<float,2>{0.855217278f, 0.765369654f},
-std::array<float,2>{0.41779241f, 0.940147877f},
-std::array<float,2>{0.987633109f, 0.0582172722f},
-std::array<float,2>{0.00119598454f, 0.450052112f},
-std::array<float,2>{0.742212534f, 0.741710722f},
-std::array<float,2>{0.138015166f, 0.937038541f},
-std::array<float,2>{0.610351026f, 0.110701948f},
-std::array<float,2>{0.303091049f, 0.396004349f},
-std::array<float,2>{0.805665016f, 0.645853758f},
-std::array<float,2>{0.44252035f, 0.579702973f},
-std::array<float,2>{0.930350423f, 0.256066531f},
-std::array<float,2>{0.104296885f, 0.244242162f},
-std::array<float,2>{0.668311f, 0.81553328f},
-std::array<float,2>{0.0388508923f, 0.697601676f},
-std::array<float,2>{0.700780928f, 0.470977902f},
-std::array<float,2>{0.400558561f, 0.0134510631f},
-std::array<float,2>{0.945588171f, 0.999550045f},
-std::array<float,2>{0.374446094f, 0.807059705f},
-std::array<float,2>{0.822415352f, 0.138517156f},
-std::array<float,2>{0.247974291f, 0.326479524f},
-std::array<float,2>{0.540919304f, 0.536772907f},
-std::array<float,2>{0.0294500571f, 0.977917969f},
-std::array<float,2>{0.730004966f, 0.015935218f},
-std::array<float,2>{0.434748948f, 0.487973869f},
-std::array<float,2>{0.982509613f, 0.706055522f},
-std::array<float,2>{0.332538605f, 0.549754202f},
-std::array<float,2>{0.861296177f, 0.334090441f},
-std::array<float,2>{0.203495681f, 0.155837372f},
-std::array<float,2>{0.526072025f, 0.782017767f},
-std::array<float,2>{0.159556627f, 0.627362072f},
-std::array<float,2>{0.578424811f, 0.375366956f},
-std::array<float,2>{0.269250363f, 0.106916629f},
-std::array<float,2>{0.772613466f, 0.921432912f},
-std::array<float,2>{0.499402493f, 0.829909444f},
-std::array<float,2>{0.875349641f, 0.222892776f},
-std::array<float,2>{0.0680770352f, 0.270230383f},
-std::array<float,2>{0.64583534f, 0.563030243f},
-std::array<float,2>{0.221876323f, 0.770719826f},
-std::array<float,2>{0.547499478f, 0.173072621f},
-std::array<float,2>{0.356069148f, 0.352829307f},
-std::array<float,2>{0.832916975f, 0.529367447f},
-std::array<float,2>{0.375027597f, 0.727108896f},
-std::array<float,2>{0.955704749f, 0.460217267f},
-std::array<float,2>{0.0553273596f, 0.0428287573f},
-std::array<float,2>{0.716857672f, 0.964213252f},
-std::array<float,2>{0.119077243f, 0.615797579f},
-std::array<float,2>{0.679566681f, 0.286742479f},
-std::array<float,2>{0.464451522f, 0.188182607f},
-std::array<float,2>{0.910565972f, 0.861872494f},
-std::array<float,2>{0.286772966f, 0.893233538f},
-std::array<float,2>{0.785043001f, 0.0866765007f},
-std::array<float,2>{0.149469599f, 0.430494517f},
-std::array<float,2>{0.597510993f, 0.682579279f},
-std::array<float,2>{0.111026205f, 0.760933578f},
-std::array<float,2>{0.684735775f, 0.162307769f},
-std::array<float,2>{0.458891958f, 0.370876938f},
-std::array<float,2>{0.921057522f, 0.505137086f},
-std::array<float,2>{0.293284535f, 0.735893965f},
-std::array<float,2>{0.793658078f, 0.445818901f},
-std::array<float,2>{0.14657408f, 0.0602557845f},
-std::array<float,2>{0.608293891f, 0.943747878f},
-std::array<float,2>{0.230505347f, 0.609336138f},
-std::array<float,2>{0.559057474f, 0.308641672f},
-std::array<float,2>{0.347260147f, 0.216237858f},
-std::array<float,2>{0.839436352f, 0.853668571f},
-std::array<float,2>{0.389606804f, 0.87838012f},
-std::array<float,2>{0.967764616f, 0.0726263449f},
-std::array<float,2>{0.0528937094f, 0.413448244f},
-std::array<float,2>{0.709934294f, 0.665673733f},
-std::array<float,2>{0.166447699f, 0.993700087f},
-std::array<float,2>{0.589369714f, 0.0101716453f},
-std::array<float,2>{0.280333728f, 0.474275947f},
-std::array<float,2>{0.775219381f, 0.702439964f},
-std::array<float,2>{0.485885203f, 0.5331195f},
-std::array<float,2>{0.884910166f, 0.322028607f},
-std::array<float,2>{0.0768615901f, 0.135860369f},
-std::array<float,2>{0.654565632f, 0.809069693f},
-std::array<float,2>{0.01836049f, 0.643594742f},
-std::array<float,2>{0.724604189f, 0.392577946f},
-std::array<float,2>{0.425217986f, 0.113553144f},
-std::array<float,2>{0.972676694f, 0.9307006f},
-std::array<float,2>{0.338176876f, 0.817375362f},
-std::array<float,2>{0.873799324f, 0.248444676f},
-std::array<float,2>{0.215134561f, 0.25201714f},
-std::array<float,2>{0.515885353f, 0.583720326f},
-std::array<float,2>{0.0411797427f, 0.916360557f},
-std::array<float,2>{0.690062046f, 0.102494702f},
-std::array<float,2>{0.393000036f, 0.382810742f},
-std::array<float,2>{0.942990661f, 0.629724324f},
-std::array<float,2>{0.363553166f, 0.567056537f},
-std::array<float,2>{0.812891781f, 0.269361317f},
-std::array<float,2>{0.236892238f, 0.221273363f},
-std::array<float,2>{0.532618105f, 0.835202932f},
-std::array<float,2>{0.127523556f, 0.708846927f},
-std::array<float,2>{0.61806494f, 0.490922332f},
-std::array<float,2>{0.304989189f, 0.0231354702f},
-std::array<float,2>{0.798444033f, 0.980503619f},
-std::array<float,2>{0.450906575f, 0.788464725f},
-std::array<float,2>{0.92864418f, 0.151379794f},
-std::array<float,2>{0.0940038115f, 0.33144483f},
-std::array<float,2>{0.65998435f, 0.55181551f},
-std::array<float,2>{0.194259226f, 0.86370784f},
-std::array<float,2>{0.501378477f, 0.192853242f},
-std::array<float,2>{0.322579473f, 0.283229619f},
-std::array<float,2>{0.848512292f, 0.611675978f},
-std::array<float,2>{0.406821132f, 0.685786247f},
-std::array<float,2>{0.995921731f, 0.435878009f},
-std::array<float,2>{0.010739238f, 0.0914547145f},
-std::array<float,2>{0.7355088f, 0.897719562f},
-std::array<float,2>{0.0821995884f, 0.525177777f},
-std::array<float,2>{0.63694948f, 0.356573433f},
-std::array<float,2>{0.470423251f, 0.176067978f},
-std::array<float,2>{0.903586268f, 0.766682684f},
-std::array<float,2>{0.250368208f, 0.968160093f},
-std::array<float,2>{0.759296954f, 0.0462939739f},
-std::array<float,2>{0.180243522f, 0.45585078f},
-std::array<float,2>{0.575551152f, 0.732150435f},
-std::array<float,2>{0.0074811629f, 0.840978622f},
-std::array<float,2>{0.749851644f, 0.228245512f},
-std::array<float,2>{0.420179427f, 0.278283417f},
-std::array<float,2>{0.991378605f, 0.573923171f},
-std::array<float,2>{0.314755529f, 0.639339626f},
-std::array<float,2>{0.855928898f, 0.384491235f},
-std::array<float,2>{0.202279612f, 0.0960870013f},
-std::array<float,2>{0.513812959f, 0.909740806f},
-std::array<float,2>{0.171988025f, 0.562229395f},
-std::array<float,2>{0.566970348f, 0.340552866f},
-std::array<float,2>{0.262688756f, 0.141847759f},
-std::array<float,2>{0.752641201f, 0.789997697f},
-std::array<float,2>{0.47987774f, 0.974081695f},
-std::array<float,2>{0.89581424f, 0.0279417057f},
-std::array<float,2>{0.0904650167f, 0.498248875f},
-std::array<float,2>{0.632475078f, 0.716171265f},
-std::array<float,2>{0.243567154f, 0.905156672f},
-std::array<float,2>{0.543538332f, 0.0832808539f},
-std::array<float,2>{0.368486047f, 0.429072976f},
-std::array<float,2>{0.827695727f, 0.677075982f},
-std::array<float,2>{0.405407041f, 0.624852955f},
-std::array<float,2>{0.95181042f, 0.294148386f},
-std::array<float,2>{0.0347018503f, 0.198436111f},
-std::array<float,2>{0.698836327f, 0.871220231f},
-std::array<float,2>{0.105661131f, 0.72081095f},
-std::array<float,2>{0.665771246f, 0.462762326f},
-std::array<float,2>{0.439627081f, 0.0360657871f},
-std::array<float,2>{0.935651839f, 0.960583627f},
-std::array<float,2>{0.298581123f, 0.780066192f},
-std::array<float,2>{0.812141418f, 0.18139945f},
-std::array<float,2>{0.13598679f, 0.346435189f},
-std::array<float,2>{0.614196301f, 0.518178523f},
-std::array<float,2>{0.0656500608f, 0.952337325f},
-std::array<float,2>{0.643165112f, 0.0523745976f},
-std::array<float,2>{0.494973481f, 0.441773176f},
-std::array<float,2>{0.879831612f, 0.743855655f},
-std::array<float,2>{0.270737439f, 0.513866961f},
-std::array<float,2>{0.765967607f, 0.365838587f},
-std::array<float,2>{0.161070764f, 0.167286456f},
-std::array<float,2>{0.585710406f, 0.751413941f},
-std::array<float,2>{0.209081769f, 0.657845795f},
-std::array<float,2>{0.527583718f, 0.417700529f},
-std::array<float,2>{0.330457211f, 0.0667762011f},
-std::array<float,2>{0.864887178f, 0.885220766f},
-std::array<float,2>{0.429824501f, 0.845753729f},
-std::array<float,2>{0.977279782f, 0.208958015f},
-std::array<float,2>{0.0270613916f, 0.297033668f},
-std::array<float,2>{0.732317805f, 0.597362876f},
-std::array<float,2>{0.152793571f, 0.797442496f},
-std::array<float,2>{0.599385679f, 0.129855007f},
-std::array<float,2>{0.282763988f, 0.32006076f},
-std::array<float,2>{0.787605345f, 0.544494689f},
-std::array<float,2>{0.466339171f, 0.6881392f},
-std::array<float,2>{0.907512665f, 0.477443874f},
-std::array<float,2>{0.12482354f, 0.00593921775f},
-std::array<float,2>{0.675193489f, 0.991423547f},
-std::array<float,2>{0.0588523336f, 0.592953742f},
-std::array<float,2>{0.711097717f, 0.262520224f},
-std::array<float,2>{0.3820059f, 0.235562682f},
-std::array<float,2>{0.959260464f, 0.827277005f},
-std::array<float,2>{0.351830214f, 0.924912333f},
-std::array<float,2>{0.829192162f, 0.119473547f},
-std::array<float,2>{0.224814236f, 0.402028978f},
-std::array<float,2>{0.55210942f, 0.65001756f},
-std::array<float,2>{0.012073176f, 0.804682016f},
-std::array<float,2>{0.74014467f, 0.125610039f},
-std::array<float,2>{0.410888404f, 0.314416111f},
-std::array<float,2>{0.998558104f, 0.541726649f},
-std::array<float,2>{0.32707274f, 0.693904579f},
-std::array<float,2>{0.847118616f, 0.480724394f},
-std::array<float,2>{0.187896937f, 0.00158218888f},
-std::array<float,2>{0.504018247f, 0.985885739f},
-std::array<float,2>{0.185011372f, 0.587876379f},
-std::array<float,2>{0.571546435f, 0.258963585f},
-std::array<float,2>{0.256907403f, 0.240611315f},
-std::array<float,2>{0.763910294f, 0.822380722f},
-std::array<float,2>{0.475538731f, 0.927144051f},
-std::array<float,2>{0.901573718f, 0.124165751f},
-std::array<float,2>{0.0784557685f, 0.403011262f},
-std::array<float,2>{0.635943115f, 0.654262841f},
-std::array<float,2>{0.238922089f, 0.948614597f},
-std::array<float,2>{0.535591841f, 0.049629692f},
-std::array<float,2>{0.361855745f, 0.440583348f},
-std::array<float,2>{0.816777647f, 0.749983132f},
-std::array<float,2>{0.397777826f, 0.508123696f},
-std::array<float,2>{0.938677788f, 0.36246857f},
-std::array<float,2>{0.0436251909f, 0.170736209f},
-std::array<float,2>{0.692785442f, 0.754425406f},
-std::array<float,2>{0.0989494026f, 0.661031902f},
-std::array<float,2>{0.66247499f, 0.418625921f},
-std::array<float,2>{0.449116915f, 0.063082695f},
-std::array<float,2>{0.922089338f, 0.88917762f},
-std::array<float,2>{0.311715424f, 0.849774361f},
-std::array<float,2>{0.804062068f, 0.205747187f},
-std::array<float,2>{0.131781295f, 0.301815003f},
-std::array<float,2>{0.62479037f, 0.601357222f},
-std::array<float,2>{0.0730132088f, 0.899702907f},
-std::array<float,2>{0.651670396f, 0.0794226676f},
-std::array<float,2>{0.490534902f, 0.423197865f},
-std::array<float,2>{0.890528679f, 0.675589263f},
-std::array<float,2>{0.276530743f, 0.618384957f},
-std::array<float,2>{0.778755903f, 0.292927086f},
-std::array<float,2>{0.168038324f, 0.202808321f},
-std::array<float,2>{0.593436718f, 0.869974196f},
-std::array<float,2>{0.212514862f, 0.723261714f},
-std::array<float,2>{0.522299051f, 0.466398478f},
-std::array<float,2>{0.34007889f, 0.0313497894f},
-std::array<float,2>{0.870532811f, 0.954584539f},
-std::array<float,2>{0.426623166f, 0.777048647f},
-std::array<float,2>{0.970842004f, 0.18386884f},
-std::array<float,2>{0.0228381995f, 0.348726898f},
-std::array<float,2>{0.720839381f, 0.522841811f},
-std::array<float,2>{0.14346908f, 0.839195728f},
-std::array<float,2>{0.602620363f, 0.230529234f},
-std::array<float,2>{0.291133672f, 0.275929362f},
-std::array<float,2>{0.792446733f, 0.575112939f},
-std::array<float,2>{0.453885764f, 0.636574805f},
-std::array<float,2>{0.91421175f, 0.38684088f},
-std::array<float,2>{0.115774795f, 0.0976604372f},
-std::array<float,2>{0.680905819f, 0.910907447f},
-std::array<float,2>{0.0495739132f, 0.557949901f},
-std::array<float,2>{0.705679953f, 0.337352335f},
-std::array<float,2>{0.384540588f, 0.147105664f},
-std::array<float,2>{0.963909507f, 0.796814859f},
-std::array<float,2>{0.349697024f, 0.971597791f},
-std::array<float,2>{0.840028286f, 0.0261577182f},
-std::array<float,2>{0.228215396f, 0.494191408f},
-std::array<float,2>{0.557452142f, 0.714657485f},
-std::array<float,2>{0.120623857f, 0.862975776f},
-std::array<float,2>{0.67582047f, 0.188647822f},
-std::array<float,2>{0.462751776f, 0.286003977f},
-std::array<float,2>{0.912384868f, 0.616864204f},
-std::array<float,2>{0.287270933f, 0.682620525f},
-std::array<float,2>{0.782172322f, 0.431274533f},
-std::array<float,2>{0.151651114f, 0.0877718627f},
-std::array<float,2>{0.594248176f, 0.89433223f},
-std::array<float,2>{0.220683292f, 0.530809939f},
-std::array<float,2>{0.549196482f, 0.351779372f},
-std::array<float,2>{0.358202517f, 0.172817826f},
-std::array<float,2>{0.835685253f, 0.77032584f},
-std::array<float,2>{0.377865165f, 0.963487923f},
-std::array<float,2>{0.953198314f, 0.0418430232f},
-std::array<float,2>{0.0572538823f, 0.459176838f},
-std::array<float,2>{0.715388f, 0.728037894f},
-std::array<float,2>{0.15747565f, 0.920681655f},
-std::array<float,2>{0.580985308f, 0.105556279f},
-std::array<float,2>{0.267363995f, 0.375978678f},
-std::array<float,2>{0.771076977f, 0.628902078f},
-std::array<float,2>{0.497563988f, 0.56398958f},
-std::array<float,2>{0.87851125f, 0.271236241f},
-std::array<float,2>{0.0684343874f, 0.224061862f},
-std::array<float,2>{0.647337019f, 0.828968942f},
-std::array<float,2>{0.0281039141f, 0.70575881f},
-std::array<float,2>{0.727847457f, 0.48640582f},
-std::array<float,2>{0.437068105f, 0.016673997f},
-std::array<float,2>{0.981273651f, 0.976933122f},
-std::array<float,2>{0.335632712f, 0.783182442f},
-std::array<float,2>{0.862541437f, 0.154460147f},
-std::array<float,2>{0.20589219f, 0.335474342f},
-std::array<float,2>{0.524789989f, 0.549919128f},
-std::array<float,2>{0.0352654085f, 0.998078644f},
-std::array<float,2>{0.702781081f, 0.012336106f},
-std::array<float,2>{0.398717493f, 0.47221759f},
-std::array<float,2>{0.948717833f, 0.698283017f},
-std::array<float,2>{0.371375054f, 0.535405695f},
-std::array<float,2>{0.821201146f, 0.327904791f},
-std::array<float,2>{0.249208063f, 0.137617648f},
-std::array<float,2>{0.541990161f, 0.808252156f},
-std::array<float,2>{0.140436426f, 0.644617915f},
-std::array<float,2>{0.612875938f, 0.394956708f},
-std::array<float,2>{0.300951272f, 0.109573439f},
-std::array<float,2>{0.806731284f, 0.935674489f},
-std::array<float,2>{0.445002586f, 0.814829171f},
-std::array<float,2>{0.933375299f, 0.245895073f},
-std::array<float,2>{0.102250651f, 0.257479787f},
-std::array<float,2>{0.670728147f, 0.578969955f},
-std::array<float,2>{0.196384072f, 0.764604867f},
-std::array<float,2>{0.510404289f, 0.158167198f},
-std::array<float,2>{0.31782189f, 0.37488085f},
-std::array<float,2>{0.852625132f, 0.502638221f},
-std::array<float,2>{0.416013956f, 0.740618348f},
-std::array<float,2>{0.985519111f, 0.450618058f},
-std::array<float,2>{0.00289784628f, 0.0573972873f},
-std::array<float,2>{0.745646954f, 0.940557897f},
-std::array<float,2>{0.0877022892f, 0.603664815f},
-std::array<float,2>{0.626813233f, 0.30628705f},
-std::array<float,2>{0.482299179f, 0.213850826f},
-std::array<float,2>{0.893128812f, 0.857373953f},
-std::array<float,2>{0.26131916f, 0.881902933f},
-std::array<float,2>{0.756595612f, 0.0771417767f},
-std::array<float,2>{0.177804261f, 0.406788528f},
-std::array<float,2>{0.564740717f, 0.670854628f},
-std::array<float,2>{0.0843565613f, 0.766113341f},
-std::array<float,2>{0.63922447f, 0.177311644f},
-std::array<float,2>{0.471068144f, 0.356389076f},
-std::array<float,2>{0.904815078f, 0.523687065f},
-std::array<float,2>{0.252664328f, 0.731053829f},
-std::array<float,2>{0.760493994f, 0.456259906f},
-std::array<float,2>{0.182658836f, 0.0457320549f},
-std::array<float,2>{0.577759504f, 0.966941118f},
-std::array<float,2>{0.192465201f, 0.612498343f},
-std::array<float,2>{0.503147066f, 0.284436822f},
-std::array<float,2>{0.320855916f, 0.191473395f},
-std::array<float,2>{0.85075593f, 0.864519477f},
-std::array<float,2>{0.410111994f, 0.896793723f},
-std::array<float,2>{0.992835641f, 0.0899492875f},
-std::array<float,2>{0.00812754687f, 0.437133878f},
-std::array<float,2>{0.738269687f, 0.687370777f},
-std::array<float,2>{0.125312954f, 0.982392251f},
-std::array<float,2>{0.621063709f, 0.0220196713f},
-std::array<float,2>{0.308162391f, 0.491343796f},
-std::array<float,2>{0.800271869f, 0.707274199f},
-std::array<float,2>{0.451850802f, 0.550931096f},
-std::array<float,2>{0.925797701f, 0.330707163f},
-std::array<float,2>{0.0972236097f, 0.151365101f},
-std::array<float,2>{0.657928169f, 0.787816703f},
-std::array<float,2>{0.0405536927f, 0.630061686f},
-std::array<float,2>{0.687880158f, 0.381455421f},
-std::array<float,2>{0.391786963f, 0.102897778f},
-std::array<float,2>{0.944721818f, 0.917704344f},
-std::array<float,2>{0.365246743f, 0.834513366f},
-std::array<float,2>{0.815155447f, 0.221884131f},
-std::array<float,2>{0.235166788f, 0.267652124f},
-std::array<float,2>{0.534746528f, 0.567733049f},
-std::array<float,2>{0.0172225963f, 0.929966033f},
-std::array<float,2>{0.726473749f, 0.114834189f},
-std::array<float,2>{0.423118442f, 0.391358644f},
-std::array<float,2>{0.97518307f, 0.642706513f},
-std::array<float,2>{0.337076187f, 0.582447886f},
-std::array<float,2>{0.872584581f, 0.253315717f},
-std::array<float,2>{0.218484059f, 0.249238506f},
-std::array<float,2>{0.518255532f, 0.817668855f},
-std::array<float,2>{0.164307714f, 0.701897562f},
-std::array<float,2>{0.587197781f, 0.473286986f},
-std::array<float,2>{0.278283f, 0.0117126452f},
-std::array<float,2>{0.775959492f, 0.992294371f},
-std::array<float,2>{0.486660928f, 0.810215473f},
-std::array<float,2>{0.88323009f, 0.135148481f},
-std::array<float,2>{0.075715296f, 0.320327938f},
-std::array<float,2>{0.654046237f, 0.532199264f},
-std::array<float,2>{0.233308136f, 0.854660571f},
-std::array<float,2>{0.561421216f, 0.214953363f},
-std::array<float,2>{0.345611423f, 0.310328215f},
-std::array<float,2>{0.836832583f, 0.608265579f},
-std::array<float,2>{0.388642818f, 0.664683223f},
-std::array<float,2>{0.966791332f, 0.412549168f},
-std::array<float,2>{0.0509543233f, 0.0735416785f},
-std::array<float,2>{0.708811581f, 0.877019703f},
-std::array<float,2>{0.112107567f, 0.504658341f},
-std::array<float,2>{0.686439395f, 0.369423151f},
-std::array<float,2>{0.460330933f, 0.163754538f},
-std::array<float,2>{0.918328822f, 0.760155439f},
-std::array<float,2>{0.296328962f, 0.945165217f},
-std::array<float,2>{0.795560718f, 0.0594216771f},
-std::array<float,2>{0.144957647f, 0.447227925f},
-std::array<float,2>{0.606809795f, 0.735116541f},
-std::array<float,2>{0.0606154799f, 0.827007353f},
-std::array<float,2>{0.712995172f, 0.234838903f},
-std::array<float,2>{0.380074352f, 0.263366729f},
-std::array<float,2>{0.957521379f, 0.592186391f},
-std::array<float,2>{0.353960276f, 0.649261415f},
-std::array<float,2>{0.830901742f, 0.400525957f},
-std::array<float,2>{0.222913593f, 0.120543212f},
-std::array<float,2>{0.552880943f, 0.923961401f},
-std::array<float,2>{0.155707985f, 0.543302774f},
-std::array<float,2>{0.601429403f, 0.318788439f},
-std::array<float,2>{0.284775436f, 0.130751953f},
-std::array<float,2>{0.786012828f, 0.798114061f},
-std::array<float,2>{0.46683836f, 0.990269601f},
-std::array<float,2>{0.908323646f, 0.00770531874f},
-std::array<float,2>{0.122990586f, 0.478403151f},
-std::array<float,2>{0.673577309f, 0.689282179f},
-std::array<float,2>{0.208556935f, 0.886696339f},
-std::array<float,2>{0.529626131f, 0.0676406994f},
-std::array<float,2>{0.328760237f, 0.416436136f},
-std::array<float,2>{0.866001248f, 0.657024801f},
-std::array<float,2>{0.432605684f, 0.596625388f},
-std::array<float,2>{0.980048954f, 0.29872942f},
-std::array<float,2>{0.0250805262f, 0.207828194f},
-std::array<float,2>{0.732625067f, 0.847106159f},
-std::array<float,2>{0.0643800795f, 0.742392361f},
-std::array<float,2>{0.642294168f, 0.442706823f},
-std::array<float,2>{0.493976533f, 0.0516178906f},
-std::array<float,2>{0.882787228f, 0.951684058f},
-std::array<float,2>{0.273297548f, 0.750173926f},
-std::array<float,2>{0.768776536f, 0.166605815f},
-std::array<float,2>{0.162531331f, 0.366624177f},
-std::array<float,2>{0.582919359f, 0.515529692f},
-std::array<float,2>{0.108547799f, 0.959892333f},
-std::array<float,2>{0.667751312f, 0.0367094837f},
-std::array<float,2>{0.438840181f, 0.461629957f},
-std::array<float,2>{0.933775246f, 0.721983671f},
-std::array<float,2>{0.300541461f, 0.519344211f},
-std::array<float,2>{0.809235036f, 0.346975774f},
-std::array<float,2>{0.133912042f, 0.180570781f},
-std::array<float,2>{0.617005169f, 0.781154811f},
-std::array<float,2>{0.24474524f, 0.676460266f},
-std::array<float,2>{0.5449301f, 0.428156108f},
-std::array<float,2>{0.369952977f, 0.0824301317f},
-std::array<float,2>{0.825169861f, 0.90581882f},
-std::array<float,2>{0.402881503f, 0.872146428f},
-std::array<float,2>{0.949936628f, 0.198193148f},
-std::array<float,2>{0.0318130367f, 0.293832958f},
-std::array<float,2>{0.695992589f, 0.623394549f},
-std::array<float,2>{0.17499353f, 0.790445745f},
-std::array<float,2>{0.569691777f, 0.140964344f},
-std::array<float,2>{0.264786899f, 0.341422945f},
-std::array<float,2>{0.751139224f, 0.56054914f},
-std::array<float,2>{0.477607101f, 0.714865923f},
-std::array<float,2>{0.897958159f, 0.499248624f},
-std::array<float,2>{0.0921131223f, 0.0292694028f},
-std::array<float,2>{0.629139423f, 0.972786844f},
-std::array<float,2>{0.00471812766f, 0.573009133f},
-std::array<float,2>{0.746614516f, 0.278717846f},
-std::array<float,2>{0.419008762f, 0.226862386f},
-std::array<float,2>{0.988560617f, 0.839993834f},
-std::array<float,2>{0.314025968f, 0.908319294f},
-std::array<float,2>{0.858566761f, 0.0967273563f},
-std::array<float,2>{0.200701386f, 0.383314043f},
-std::array<float,2>{0.51284641f, 0.64031893f},
-std::array<float,2>{0.0466182269f, 0.757234216f},
-std::array<float,2>{0.694802821f, 0.168710992f},
-std::array<float,2>{0.395757318f, 0.360307544f},
-std::array<float,2>{0.940930009f, 0.511621356f},
-std::array<float,2>{0.359653562f, 0.748043418f},
-std::array<float,2>{0.819061875f, 0.437611997f},
-std::array<float,2>{0.242138207f, 0.0471926555f},
-std::array<float,2>{0.539012015f, 0.945927978f},
-std::array<float,2>{0.130222306f, 0.598804772f},
-std::array<float,2>{0.621462941f, 0.304286808f},
-std::array<float,2>{0.309749246f, 0.203202635f},
-std::array<float,2>{0.802268088f, 0.848245561f},
-std::array<float,2>{0.445903212f, 0.888437808f},
-std::array<float,2>{0.924193382f, 0.0654185861f},
-std::array<float,2>{0.0996534005f, 0.42069453f},
-std::array<float,2>{0.661838472f, 0.663784504f},
-std::array<float,2>{0.189454824f, 0.986532867f},
-std::array<float,2>{0.5059219f, 0.00202954863f},
-std::array<float,2>{0.325258523f, 0.483001828f},
-std::array<float,2>{0.845157385f, 0.692493916f},
-std::array<float,2>{0.413108826f, 0.540420949f},
-std::array<float,2>{0.996400297f, 0.315467685f},
-std::array<float,2>{0.0148844505f, 0.127341121f},
-std::array<float,2>{0.740586221f, 0.801906168f},
-std::array<float,2>{0.0816169828f, 0.65495944f},
-std::array<float,2>{0.632944167f, 0.405608386f},
-std::array<float,2>{0.47339958f, 0.121883497f},
-std::array<float,2>{0.899645329f, 0.92881906f},
-std::array<float,2>{0.254542321f, 0.821655393f},
-std::array<float,2>{0.762336373f, 0.239345387f},
-std::array<float,2>{0.186614722f, 0.260837764f},
-std::array<float,2>{0.572394252f, 0.587975919f},
-std::array<float,2>{0.114700712f, 0.913193822f},
-std::array<float,2>{0.681651354f, 0.101364352f},
-std::array<float,2>{0.455596417f, 0.388898104f},
-std::array<float,2>{0.916671336f, 0.633114934f},
-std::array<float,2>{0.290115148f, 0.577850223f},
-std::array<float,2>{0.78952229f, 0.273816615f},
-std::array<float,2>{0.142533898f, 0.233219981f},
-std::array<float,2>{0.604213655f, 0.836660683f},
-std::array<float,2>{0.229596809f, 0.711480141f},
-std::array<float,2>{0.555835545f, 0.492231965f},
-std::array<float,2>{0.349535614f, 0.0245940369f},
-std::array<float,2>{0.843278468f, 0.968762994f},
-std::array<float,2>{0.384950697f, 0.793291092f},
-std::array<float,2>{0.961089671f, 0.145631015f},
-std::array<float,2>{0.0481157824f, 0.338755518f},
-std::array<float,2>{0.704854608f, 0.555877745f},
-std::array<float,2>{0.171319351f, 0.868392348f},
-std::array<float,2>{0.590358317f, 0.200045213f},
-std::array<float,2>{0.273776323f, 0.290072054f},
-std::array<float,2>{0.78027761f, 0.619897723f},
-std::array<float,2>{0.489035189f, 0.672511756f},
-std::array<float,2>{0.887281477f, 0.425402969f},
-std::array<float,2>{0.0720719397f, 0.081429705f},
-std::array<float,2>{0.649743915f, 0.90220356f},
-std::array<float,2>{0.0211432576f, 0.520398974f},
-std::array<float,2>{0.719524145f, 0.351247579f},
-std::array<float,2>{0.429546505f, 0.18639718f},
-std::array<float,2>{0.970265508f, 0.774985731f},
-std::array<float,2>{0.343221962f, 0.955495834f},
-std::array<float,2>{0.867540121f, 0.0334303416f},
-std::array<float,2>{0.213950962f, 0.467417568f},
-std::array<float,2>{0.520174205f, 0.724865556f},
-std::array<float,2>{0.0670463964f, 0.831508338f},
-std::array<float,2>{0.644684374f, 0.224798396f},
-std::array<float,2>{0.498236448f, 0.272279143f},
-std::array<float,2>{0.876160264f, 0.56493324f},
-std::array<float,2>{0.268104076f, 0.625256121f},
-std::array<float,2>{0.772257566f, 0.378066301f},
-std::array<float,2>{0.158461243f, 0.109235018f},
-std::array<float,2>{0.580008745f, 0.918155134f},
-std::array<float,2>{0.204720691f, 0.547540069f},
-std::array<float,2>{0.527294815f, 0.332334101f},
-std::array<float,2>{0.333055019f, 0.15329729f},
-std::array<float,2>{0.859617472f, 0.785128593f},
-std::array<float,2>{0.433658868f, 0.979364038f},
-std::array<float,2>{0.983409405f, 0.0191983562f},
-std::array<float,2>{0.030965494f, 0.485456616f},
-std::array<float,2>{0.728694379f, 0.703577578f},
-std::array<float,2>{0.149224237f, 0.892020345f},
-std::array<float,2>{0.596551538f, 0.0886100829f},
-std::array<float,2>{0.285785645f, 0.432473987f},
-std::array<float,2>{0.784161508f, 0.681275487f},
-std::array<float,2>{0.463691622f, 0.613650262f},
-std::array<float,2>{0.911647916f, 0.287558436f},
-std::array<float,2>{0.117541477f, 0.191308782f},
-std::array<float,2>{0.6785447f, 0.859444261f},
-std::array<float,2>{0.0558974557f, 0.729051173f},
-std::array<float,2>{0.717882097f, 0.458922148f},
-std::array<float,2>{0.376277298f, 0.040353395f},
-std::array<float,2>{0.956714272f, 0.962615609f},
-std::array<float,2>{0.356480986f, 0.771868348f},
-std::array<float,2>{0.833139956f, 0.174354464f},
-std::array<float,2>{0.22142756f, 0.354305774f},
-std::array<float,2>{0.548020661f, 0.529147923f},
-std::array<float,2>{0.000416732248f, 0.938938797f},
-std::array<float,2>{0.743812859f, 0.0556290485f},
-std::array<float,2>{0.416849554f, 0.452640355f},
-std::array<float,2>{0.987084389f, 0.738617778f},
-std::array<float,2>{0.318657875f, 0.501444399f},
-std::array<float,2>{0.854470789f, 0.373040766f},
-std::array<float,2>{0.198242441f, 0.159423679f},
-std::array<float,2>{0.508244276f, 0.761940181f},
-std::array<float,2>{0.177117005f, 0.669830263f},
-std::array<float,2>{0.56278497f, 0.409024149f},
-std::array<float,2>{0.259022176f, 0.0755160972f},
-std::array<float,2>{0.755566061f, 0.880505502f},
-std::array<float,2>{0.484366924f, 0.859135389f},
-std::array<float,2>{0.891993165f, 0.212110311f},
-std::array<float,2>{0.0886000395f, 0.307442605f},
-std::array<float,2>{0.627305746f, 0.602535725f},
-std::array<float,2>{0.246934772f, 0.80545634f},
-std::array<float,2>{0.539800465f, 0.139864221f},
-std::array<float,2>{0.37307182f, 0.324396431f},
-std::array<float,2>{0.823349297f, 0.537849426f},
-std::array<float,2>{0.402230114f, 0.696500778f},
-std::array<float,2>{0.946954131f, 0.469015658f},
-std::array<float,2>{0.0371337831f, 0.0140291909f},
-std::array<float,2>{0.700040221f, 0.997979403f},
-std::array<float,2>{0.105048656f, 0.580394268f},
-std::array<float,2>{0.669284463f, 0.255598873f},
-std::array<float,2>{0.441946387f, 0.243964642f},
-std::array<float,2>{0.931346357f, 0.813427508f},
-std::array<float,2>{0.303719938f, 0.934645951f},
-std::array<float,2>{0.805357695f, 0.112742208f},
-std::array<float,2>{0.137108415f, 0.397113174f},
-std::array<float,2>{0.610467315f, 0.647013843f},
-std::array<float,2>{0.0948720127f, 0.785773575f},
-std::array<float,2>{0.658922315f, 0.149159774f},
-std::array<float,2>{0.449803561f, 0.328511029f},
-std::array<float,2>{0.929413915f, 0.553659976f},
-std::array<float,2>{0.306633115f, 0.710568666f},
-std::array<float,2>{0.797333241f, 0.488892645f},
-std::array<float,2>{0.128024697f, 0.0202766992f},
-std::array<float,2>{0.618391097f, 0.983730972f},
-std::array<float,2>{0.238235801f, 0.568635821f},
-std::array<float,2>{0.532155275f, 0.265917599f},
-std::array<float,2>{0.365199119f, 0.219482735f},
-std::array<float,2>{0.814441085f, 0.833880365f},
-std::array<float,2>{0.393798798f, 0.914582491f},
-std::array<float,2>{0.942355216f, 0.104183577f},
-std::array<float,2>{0.0421664678f, 0.38019067f},
-std::array<float,2>{0.690661669f, 0.631795526f},
-std::array<float,2>{0.180828229f, 0.965309799f},
-std::array<float,2>{0.574326396f, 0.0442274995f},
-std::array<float,2>{0.251430571f, 0.453974754f},
-std::array<float,2>{0.758251429f, 0.733328402f},
-std::array<float,2>{0.469069272f, 0.526639938f},
-std::array<float,2>{0.902509868f, 0.358391076f},
-std::array<float,2>{0.0833137631f, 0.179408178f},
-std::array<float,2>{0.638542473f, 0.76913631f},
-std::array<float,2>{0.0114491666f, 0.683964312f},
-std::array<float,2>{0.735247076f, 0.434839547f},
-std::array<float,2>{0.407856345f, 0.0930559337f},
-std::array<float,2>{0.99447149f, 0.896422803f},
-std::array<float,2>{0.323451161f, 0.866573513f},
-std::array<float,2>{0.848914385f, 0.194264218f},
-std::array<float,2>{0.194363669f, 0.282915622f},
-std::array<float,2>{0.500773728f, 0.610227585f},
-std::array<float,2>{0.0545208417f, 0.875947118f},
-std::array<float,2>{0.710590601f, 0.0708114803f},
-std::array<float,2>{0.39001587f, 0.410183072f},
-std::array<float,2>{0.967897475f, 0.666241825f},
-std::array<float,2>{0.346413821f, 0.606520951f},
-std::array<float,2>{0.838750839f, 0.312205374f},
-std::array<float,2>{0.23185195f, 0.217903659f},
-std::array<float,2>{0.560203135f, 0.853093565f},
-std::array<float,2>{0.148173183f, 0.738240719f},
-std::array<float,2>{0.609276831f, 0.448662043f},
-std::array<float,2>{0.294118941f, 0.0608634166f},
-std::array<float,2>{0.794018567f, 0.942868769f},
-std::array<float,2>{0.4578394f, 0.759512365f},
-std::array<float,2>{0.920066297f, 0.161418334f},
-std::array<float,2>{0.11015176f, 0.368093014f},
-std::array<float,2>{0.684079468f, 0.507306755f},
-std::array<float,2>{0.216653258f, 0.820194781f},
-std::array<float,2>{0.517359793f, 0.247008488f},
-std::array<float,2>{0.339483082f, 0.251387f},
-std::array<float,2>{0.874439895f, 0.584898353f},
-std::array<float,2>{0.424430341f, 0.641094387f},
-std::array<float,2>{0.974231482f, 0.392992705f},
-std::array<float,2>{0.0193244312f, 0.115855023f},
-std::array<float,2>{0.722840667f, 0.933375478f},
-std::array<float,2>{0.0776632354f, 0.533300936f},
-std::array<float,2>{0.655397177f, 0.32348451f},
-std::array<float,2>{0.484619141f, 0.13350372f},
-std::array<float,2>{0.886015534f, 0.812395096f},
-std::array<float,2>{0.279440045f, 0.995281994f},
-std::array<float,2>{0.77377075f, 0.00814773049f},
-std::array<float,2>{0.167671591f, 0.476493567f},
-std::array<float,2>{0.588600993f, 0.700110614f},
-std::array<float,2>{0.0259054266f, 0.845309615f},
-std::array<float,2>{0.730958164f, 0.209911183f},
-std::array<float,2>{0.431480199f, 0.29977873f},
-std::array<float,2>{0.978134513f, 0.594435394f},
-std::array<float,2>{0.331342459f, 0.658369005f},
-std::array<float,2>{0.863388956f, 0.414837956f},
-std::array<float,2>{0.21010685f, 0.0690815076f},
-std::array<float,2>{0.52920711f, 0.884028435f},
-std::array<float,2>{0.161556751f, 0.512516201f},
-std::array<float,2>{0.584390759f, 0.365044683f},
-std::array<float,2>{0.270460069f, 0.16414243f},
-std::array<float,2>{0.766640127f, 0.752640963f},
-std::array<float,2>{0.49597609f, 0.950252533f},
-std::array<float,2>{0.88010329f, 0.0534686819f},
-std::array<float,2>{0.0651184469f, 0.443539441f},
-std::array<float,2>{0.644184351f, 0.745987892f},
-std::array<float,2>{0.225853607f, 0.923421621f},
-std::array<float,2>{0.551078737f, 0.118625723f},
-std::array<float,2>{0.35309577f, 0.400311977f},
-std::array<float,2>{0.828212142f, 0.652268112f},
-std::array<float,2>{0.381769985f, 0.591493607f},
-std::array<float,2>{0.96085614f, 0.264680445f},
-std::array<float,2>{0.0597129352f, 0.237751096f},
-std::array<float,2>{0.712863624f, 0.824754655f},
-std::array<float,2>{0.123999946f, 0.690355957f},
-std::array<float,2>{0.674264669f, 0.480037272f},
-std::array<float,2>{0.465028048f, 0.00399343576f},
-std::array<float,2>{0.906952083f, 0.98966527f},
-std::array<float,2>{0.281698436f, 0.800747335f},
-std::array<float,2>{0.788449943f, 0.132667452f},
-std::array<float,2>{0.15340586f, 0.317783564f},
-std::array<float,2>{0.597760677f, 0.546864033f},
-std::array<float,2>{0.0916515961f, 0.976460516f},
-std::array<float,2>{0.631659508f, 0.0293600932f},
-std::array<float,2>{0.478939742f, 0.496574938f},
-std::array<float,2>{0.8948071f, 0.718190432f},
-std::array<float,2>{0.262845159f, 0.560364604f},
-std::array<float,2>{0.753288984f, 0.34343195f},
-std::array<float,2>{0.173441201f, 0.143869773f},
-std::array<float,2>{0.56788224f, 0.791376293f},
-std::array<float,2>{0.201579049f, 0.636979997f},
-std::array<float,2>{0.515158415f, 0.386678606f},
-std::array<float,2>{0.315910518f, 0.0944138914f},
-std::array<float,2>{0.856907904f, 0.906966627f},
-std::array<float,2>{0.421347171f, 0.843311608f},
-std::array<float,2>{0.990421295f, 0.228638858f},
-std::array<float,2>{0.00643050997f, 0.280325741f},
-std::array<float,2>{0.748169065f, 0.570912361f},
-std::array<float,2>{0.135046557f, 0.778339565f},
-std::array<float,2>{0.614887893f, 0.182941481f},
-std::array<float,2>{0.297456354f, 0.344463646f},
-std::array<float,2>{0.810640752f, 0.51732409f},
-std::array<float,2>{0.440585822f, 0.72048521f},
-std::array<float,2>{0.936897695f, 0.463624984f},
-std::array<float,2>{0.106484823f, 0.0378354155f},
-std::array<float,2>{0.664073884f, 0.957808614f},
-std::array<float,2>{0.034070693f, 0.621603549f},
-std::array<float,2>{0.697526038f, 0.295548111f},
-std::array<float,2>{0.405250251f, 0.195805594f},
-std::array<float,2>{0.952356756f, 0.873582959f},
-std::array<float,2>{0.367864609f, 0.903166473f},
-std::array<float,2>{0.826957047f, 0.0844679251f},
-std::array<float,2>{0.242735028f, 0.427066416f},
-std::array<float,2>{0.544502795f, 0.677898943f},
-std::array<float,2>{0.0021699171f, 0.762382209f},
-std::array<float,2>{0.745500684f, 0.159750909f},
-std::array<float,2>{0.415476769f, 0.372392088f},
-std::array<float,2>{0.9858495f, 0.501508772f},
-std::array<float,2>{0.317979842f, 0.738834679f},
-std::array<float,2>{0.853149772f, 0.452218294f},
-std::array<float,2>{0.196959719f, 0.0547311939f},
-std::array<float,2>{0.510025024f, 0.939093232f},
-std::array<float,2>{0.178321242f, 0.601654291f},
-std::array<float,2>{0.565084755f, 0.306655616f},
-std::array<float,2>{0.260803431f, 0.212447524f},
-std::array<float,2>{0.756144166f, 0.858802557f},
-std::array<float,2>{0.481865287f, 0.880016923f},
-std::array<float,2>{0.892703593f, 0.0758321807f},
-std::array<float,2>{0.0871028453f, 0.408510268f},
-std::array<float,2>{0.626438439f, 0.668983281f},
-std::array<float,2>{0.249663323f, 0.997324467f},
-std::array<float,2>{0.541184485f, 0.0145902112f},
-std::array<float,2>{0.371661782f, 0.469559759f},
-std::array<float,2>{0.820734799f, 0.696824491f},
-std::array<float,2>{0.398950666f, 0.537186444f},
-std::array<float,2>{0.948779345f, 0.324887067f},
-std::array<float,2>{0.0357934088f, 0.140388802f},
-std::array<float,2>{0.702169418f, 0.804967821f},
-std::array<float,2>{0.101676583f, 0.64695245f},
-std::array<float,2>{0.670027375f, 0.39659062f},
-std::array<float,2>{0.444736481f, 0.113080151f},
-std::array<float,2>{0.933078527f, 0.935435414f},
-std::array<float,2>{0.301464021f, 0.812901676f},
-std::array<float,2>{0.807432175f, 0.243216708f},
-std::array<float,2>{0.139818519f, 0.255066186f},
-std::array<float,2>{0.612735093f, 0.58068639f},
-std::array<float,2>{0.0688911006f, 0.918489873f},
-std::array<float,2>{0.646891832f, 0.108616479f},
-std::array<float,2>{0.49746567f, 0.378628671f},
-std::array<float,2>{0.878404737f, 0.625795662f},
-std::array<float,2>{0.266952544f, 0.565263808f},
-std::array<float,2>{0.77052772f, 0.27173847f},
-std::array<float,2>{0.15792565f, 0.225099206f},
-std::array<float,2>{0.580519021f, 0.831751823f},
-std::array<float,2>{0.205548882f, 0.703664601f},
-std::array<float,2>{0.524973035f, 0.486020684f},
-std::array<float,2>{0.335358232f, 0.0186355561f},
-std::array<float,2>{0.862920165f, 0.97852087f},
-std::array<float,2>{0.43676272f, 0.784406364f},
-std::array<float,2>{0.980945587f, 0.152513325f},
-std::array<float,2>{0.0276074894f, 0.332998306f},
-std::array<float,2>{0.728171647f, 0.54718554f},
-std::array<float,2>{0.15192087f, 0.86035043f},
-std::array<float,2>{0.593798101f, 0.190526098f},
-std::array<float,2>{0.287870944f, 0.287723869f},
-std::array<float,2>{0.781261981f, 0.613983333f},
-std::array<float,2>{0.462328285f, 0.680862904f},
-std::array<float,2>{0.912773669f, 0.431887746f},
-std::array<float,2>{0.120352156f, 0.0879889056f},
-std::array<float,2>{0.676554561f, 0.892153919f},
-std::array<float,2>{0.0569474101f, 0.528696239f},
-std::array<float,2>{0.715156078f, 0.353604347f},
-std::array<float,2>{0.377151698f, 0.174183309f},
-std::array<float,2>{0.95402807f, 0.772182822f},
-std::array<float,2>{0.357461274f, 0.962078631f},
-std::array<float,2>{0.835067272f, 0.0406864956f},
-std::array<float,2>{0.219864294f, 0.45810473f},
-std::array<float,2>{0.549722731f, 0.728635907f},
-std::array<float,2>{0.115680739f, 0.83605212f},
-std::array<float,2>{0.681257963f, 0.232830316f},
-std::array<float,2>{0.453138977f, 0.274022102f},
-std::array<float,2>{0.914559603f, 0.577210188f},
-std::array<float,2>{0.291918367f, 0.633638322f},
-std::array<float,2>{0.792613804f, 0.389620036f},
-std::array<float,2>{0.142973199f, 0.100981973f},
-std::array<float,2>{0.60312885f, 0.913930357f},
-std::array<float,2>{0.22764276f, 0.556493938f},
-std::array<float,2>{0.557093978f, 0.338267893f},
-std::array<float,2>{0.350458205f, 0.146311f},
-std::array<float,2>{0.840672672f, 0.793558121f},
-std::array<float,2>{0.383954614f, 0.969404101f},
-std::array<float,2>{0.964385867f, 0.0250945333f},
-std::array<float,2>{0.0489954054f, 0.493088365f},
-std::array<float,2>{0.705330729f, 0.711278439f},
-std::array<float,2>{0.168827325f, 0.901571393f},
-std::array<float,2>{0.592917144f, 0.0820246115f},
-std::array<float,2>{0.276910424f, 0.424815238f},
-std::array<float,2>{0.778840125f, 0.672100306f},
-std::array<float,2>{0.491002738f, 0.619417548f},
-std::array<float,2>{0.889736712f, 0.290784508f},
-std::array<float,2>{0.072338976f, 0.199646518f},
-std::array<float,2>{0.6520859f, 0.868979573f},
-std::array<float,2>{0.0233919416f, 0.725231946f},
-std::array<float,2>{0.721210182f, 0.46715799f},
-std::array<float,2>{0.42596814f, 0.0341188423f},
-std::array<float,2>{0.971508205f, 0.955742717f},
-std::array<float,2>{0.340456575f, 0.774431109f},
-std::array<float,2>{0.870943785f, 0.186000973f},
-std::array<float,2>{0.212134942f, 0.350996703f},
-std::array<float,2>{0.521508992f, 0.519962609f},
-std::array<float,2>{0.0430636667f, 0.945783854f},
-std::array<float,2>{0.693283737f, 0.0476900041f},
-std::array<float,2>{0.398263901f, 0.438164234f},
-std::array<float,2>{0.939350724f, 0.74743706f},
-std::array<float,2>{0.361420751f, 0.511065006f},
-std::array<float,2>{0.817299128f, 0.359755486f},
-std::array<float,2>{0.238516793f, 0.168143913f},
-std::array<float,2>{0.535782456f, 0.757786751f},
-std::array<float,2>{0.130929679f, 0.663320601f},
-std::array<float,2>{0.624230921f, 0.420407772f},
-std::array<float,2>{0.31237942f, 0.0648907572f},
-std::array<float,2>{0.804579496f, 0.88800633f},
-std::array<float,2>{0.448339015f, 0.848031342f},
-std::array<float,2>{0.922792315f, 0.204017043f},
-std::array<float,2>{0.0991351381f, 0.30414179f},
-std::array<float,2>{0.662729323f, 0.599388063f},
-std::array<float,2>{0.188254207f, 0.802658916f},
-std::array<float,2>{0.504498243f, 0.127733365f},
-std::array<float,2>{0.326580584f, 0.31638521f},
-std::array<float,2>{0.847280681f, 0.540884018f},
-std::array<float,2>{0.410158098f, 0.693158746f},
-std::array<float,2>{0.998182952f, 0.482771307f},
-std::array<float,2>{0.0125499824f, 0.00251935865f},
-std::array<float,2>{0.739263654f, 0.986976326f},
-std::array<float,2>{0.0790124461f, 0.588521957f},
-std::array<float,2>{0.636583745f, 0.261619419f},
-std::array<float,2>{0.474838018f, 0.240046263f},
-std::array<float,2>{0.902261317f, 0.821842074f},
-std::array<float,2>{0.25755915f, 0.929331958f},
-std::array<float,2>{0.764474452f, 0.121298023f},
-std::array<float,2>{0.18551144f, 0.405815035f},
-std::array<float,2>{0.572251856f, 0.654732108f},
-std::array<float,2>{0.0927493274f, 0.791951537f},
-std::array<float,2>{0.629739642f, 0.144109383f},
-std::array<float,2>{0.478475302f, 0.342850089f},
-std::array<float,2>{0.89763099f, 0.559585094f},
-std::array<float,2>{0.265496224f, 0.7184093f},
-std::array<float,2>{0.751578093f, 0.496663898f},
-std::array<float,2>{0.175309345f, 0.0300020315f},
-std::array<float,2>{0.570253313f, 0.975738168f},
-std::array<float,2>{0.200661331f, 0.570688426f},
-std::array<float,2>{0.513379872f, 0.281147808f},
-std::array<float,2>{0.313482493f, 0.229023233f},
-std::array<float,2>{0.858973086f, 0.843247771f},
-std::array<float,2>{0.419657916f, 0.90670085f},
-std::array<float,2>{0.98900789f, 0.0941100344f},
-std::array<float,2>{0.00413586991f, 0.385926396f},
-std::array<float,2>{0.74610579f, 0.637221575f},
-std::array<float,2>{0.134497419f, 0.957119167f},
-std::array<float,2>{0.616588295f, 0.0372452848f},
-std::array<float,2>{0.299846798f, 0.462940574f},
-std::array<float,2>{0.808629692f, 0.720211446f},
-std::array<float,2>{0.439102143f, 0.517027855f},
-std::array<float,2>{0.934090078f, 0.343920887f},
-std::array<float,2>{0.109225862f, 0.183544397f},
-std::array<float,2>{0.667115808f, 0.779034078f},
-std::array<float,2>{0.031457942f, 0.678406835f},
-std::array<float,2>{0.69574374f, 0.427449495f},
-std::array<float,2>{0.402778894f, 0.0848116949f},
-std::array<float,2>{0.94950372f, 0.902682006f},
-std::array<float,2>{0.369601339f, 0.873124838f},
-std::array<float,2>{0.824241757f, 0.195702732f},
-std::array<float,2>{0.2442922f, 0.295409948f},
-std::array<float,2>{0.545538127f, 0.621167302f},
-std::array<float,2>{0.0245929174f, 0.884674788f},
-std::array<float,2>{0.73320961f, 0.0683952719f},
-std::array<float,2>{0.431942016f, 0.414152831f},
-std::array<float,2>{0.979519546f, 0.659126103f},
-std::array<float,2>{0.328512818f, 0.594228089f},
-std::array<float,2>{0.865702927f, 0.299097329f},
-std::array<float,2>{0.208438143f, 0.209351853f},
-std::array<float,2>{0.530186832f, 0.844987035f},
-std::array<float,2>{0.162657186f, 0.745547473f},
-std::array<float,2>{0.582301438f, 0.443903387f},
-std::array<float,2>{0.272465855f, 0.053140007f},
-std::array<float,2>{0.769323766f, 0.950910151f},
-std::array<float,2>{0.493167996f, 0.752061129f},
-std::array<float,2>{0.88223362f, 0.164604902f},
-std::array<float,2>{0.0639551729f, 0.364624709f},
-std::array<float,2>{0.641679466f, 0.511793375f},
-std::array<float,2>{0.223520726f, 0.824698985f},
-std::array<float,2>{0.553404689f, 0.238124371f},
-std::array<float,2>{0.354482323f, 0.265556425f},
-std::array<float,2>{0.830105841f, 0.591113329f},
-std::array<float,2>{0.380519122f, 0.651633799f},
-std::array<float,2>{0.95748657f, 0.399428606f},
-std::array<float,2>{0.061453063f, 0.118786037f},
-std::array<float,2>{0.713385165f, 0.923163652f},
-std::array<float,2>{0.122099206f, 0.546068668f},
-std::array<float,2>{0.672945499f, 0.317879558f},
-std::array<float,2>{0.467698812f, 0.13198109f},
-std::array<float,2>{0.909089446f, 0.800281882f},
-std::array<float,2>{0.284325778f, 0.990018785f},
-std::array<float,2>{0.785620034f, 0.00448285695f},
-std::array<float,2>{0.155978158f, 0.479876369f},
-std::array<float,2>{0.60090971f, 0.689825296f},
-std::array<float,2>{0.0514089465f, 0.852611184f},
-std::array<float,2>{0.708187222f, 0.218305752f},
-std::array<float,2>{0.387805849f, 0.31156534f},
-std::array<float,2>{0.966149628f, 0.607097268f},
-std::array<float,2>{0.344839483f, 0.666629195f},
-std::array<float,2>{0.83615458f, 0.410754651f},
-std::array<float,2>{0.232872739f, 0.070331201f},
-std::array<float,2>{0.560569882f, 0.875149488f},
-std::array<float,2>{0.145071417f, 0.507418573f},
-std::array<float,2>{0.607104778f, 0.367310792f},
-std::array<float,2>{0.296709388f, 0.161905274f},
-std::array<float,2>{0.794928014f, 0.758888423f},
-std::array<float,2>{0.460514635f, 0.942892909f},
-std::array<float,2>{0.918876708f, 0.0611260869f},
-std::array<float,2>{0.111733496f, 0.448851913f},
-std::array<float,2>{0.685761631f, 0.737726092f},
-std::array<float,2>{0.218036339f, 0.932825565f},
-std::array<float,2>{0.517736852f, 0.11547567f},
-std::array<float,2>{0.337537944f, 0.393434644f},
-std::array<float,2>{0.872466564f, 0.641535282f},
-std::array<float,2>{0.423680246f, 0.584306896f},
-std::array<float,2>{0.974946082f, 0.2515468f},
-std::array<float,2>{0.0168965776f, 0.246458545f},
-std::array<float,2>{0.725883543f, 0.819381475f},
-std::array<float,2>{0.0755229667f, 0.699422419f},
-std::array<float,2>{0.653462708f, 0.475630194f},
-std::array<float,2>{0.487070888f, 0.00830416568f},
-std::array<float,2>{0.883600056f, 0.995621085f},
-std::array<float,2>{0.277427822f, 0.811883211f},
-std::array<float,2>{0.775661826f, 0.132862777f},
-std::array<float,2>{0.164879009f, 0.324099034f},
-std::array<float,2>{0.587777793f, 0.534104466f},
-std::array<float,2>{0.0967574045f, 0.984242499f},
-std::array<float,2>{0.657277465f, 0.0197171662f},
-std::array<float,2>{0.45140934f, 0.488587856f},
-std::array<float,2>{0.926606596f, 0.710204363f},
-std::array<float,2>{0.307879806f, 0.55303365f},
-std::array<float,2>{0.80062896f, 0.328956604f},
-std::array<float,2>{0.125646651f, 0.148815855f},
-std::array<float,2>{0.620463431f, 0.785407722f},
-std::array<float,2>{0.234712794f, 0.631033659f},
-std::array<float,2>{0.534415305f, 0.380480111f},
-std::array<float,2>{0.366122454f, 0.103753127f},
-std::array<float,2>{0.814577579f, 0.914236784f},
-std::array<float,2>{0.392462641f, 0.833012283f},
-std::array<float,2>{0.945192218f, 0.219083741f},
-std::array<float,2>{0.0403079838f, 0.266563416f},
-std::array<float,2>{0.688182235f, 0.568985462f},
-std::array<float,2>{0.183129713f, 0.768637121f},
-std::array<float,2>{0.577289999f, 0.178926334f},
-std::array<float,2>{0.252005249f, 0.357821375f},
-std::array<float,2>{0.759941936f, 0.527186394f},
-std::array<float,2>{0.47141698f, 0.732559323f},
-std::array<float,2>{0.904581487f, 0.453362554f},
-std::array<float,2>{0.0847560838f, 0.0447282344f},
-std::array<float,2>{0.638778865f, 0.965421855f},
-std::array<float,2>{0.00832520891f, 0.609681606f},
-std::array<float,2>{0.73742038f, 0.282700062f},
-std::array<float,2>{0.409529567f, 0.193574473f},
-std::array<float,2>{0.992511809f, 0.866776705f},
-std::array<float,2>{0.320324987f, 0.895676255f},
-std::array<float,2>{0.851078153f, 0.0933056176f},
-std::array<float,2>{0.192875788f, 0.435061783f},
-std::array<float,2>{0.503614366f, 0.684436977f},
-std::array<float,2>{0.0379038006f, 0.807623506f},
-std::array<float,2>{0.69930172f, 0.136968747f},
-std::array<float,2>{0.401601166f, 0.327185422f},
-std::array<float,2>{0.94667989f, 0.53597486f},
-std::array<float,2>{0.373727143f, 0.698777795f},
-std::array<float,2>{0.823925138f, 0.472014606f},
-std::array<float,2>{0.246209159f, 0.0118752886f},
-std::array<float,2>{0.539321125f, 0.998911917f},
-std::array<float,2>{0.137417719f, 0.578419983f},
-std::array<float,2>{0.610861301f, 0.257026225f},
-std::array<float,2>{0.304397494f, 0.245434776f},
-std::array<float,2>{0.804891467f, 0.815397322f},
-std::array<float,2>{0.441459775f, 0.936511159f},
-std::array<float,2>{0.931110144f, 0.109893382f},
-std::array<float,2>{0.104593776f, 0.395218343f},
-std::array<float,2>{0.669735074f, 0.64510721f},
-std::array<float,2>{0.198947489f, 0.941385686f},
-std::array<float,2>{0.508525312f, 0.0566418841f},
-std::array<float,2>{0.319093168f, 0.450859159f},
-std::array<float,2>{0.853991747f, 0.740835428f},
-std::array<float,2>{0.416152328f, 0.502244711f},
-std::array<float,2>{0.986391723f, 0.374494582f},
-std::array<float,2>{0.000916149467f, 0.157498837f},
-std::array<float,2>{0.743387401f, 0.763774276f},
-std::array<float,2>{0.0883357823f, 0.670081556f},
-std::array<float,2>{0.627473652f, 0.40631929f},
-std::array<float,2>{0.48382929f, 0.0765545815f},
-std::array<float,2>{0.892310262f, 0.882326126f},
-std::array<float,2>{0.259461761f, 0.856525838f},
-std::array<float,2>{0.755027592f, 0.213323474f},
-std::array<float,2>{0.177696228f, 0.305684239f},
-std::array<float,2>{0.563070893f, 0.604041219f},
-std::array<float,2>{0.117982216f, 0.893988192f},
-std::array<float,2>{0.67811352f, 0.0871288702f},
-std::array<float,2>{0.463319153f, 0.430710644f},
-std::array<float,2>{0.911613107f, 0.683312476f},
-std::array<float,2>{0.285332739f, 0.616406739f},
-std::array<float,2>{0.783397675f, 0.285205334f},
-std::array<float,2>{0.148727745f, 0.18907553f},
-std::array<float,2>{0.596073449f, 0.862396657f},
-std::array<float,2>{0.220967531f, 0.727712393f},
-std::array<float,2>{0.54844439f, 0.459686279f},
-std::array<float,2>{0.357248604f, 0.0412899964f},
-std::array<float,2>{0.833659649f, 0.96310097f},
-std::array<float,2>{0.376813263f, 0.769600868f},
-std::array<float,2>{0.956334352f, 0.17193602f},
-std::array<float,2>{0.0565924421f, 0.352324098f},
-std::array<float,2>{0.718540847f, 0.530327559f},
-std::array<float,2>{0.158929542f, 0.82856977f},
-std::array<float,2>{0.579190016f, 0.224532887f},
-std::array<float,2>{0.267889023f, 0.270772845f},
-std::array<float,2>{0.771523774f, 0.563520133f},
-std::array<float,2>{0.498904079f, 0.628011107f},
-std::array<float,2>{0.876522422f, 0.376584858f},
-std::array<float,2>{0.0668699741f, 0.106014505f},
-std::array<float,2>{0.645062804f, 0.920024335f},
-std::array<float,2>{0.0307138339f, 0.550339758f},
-std::array<float,2>{0.729293346f, 0.334969074f},
-std::array<float,2>{0.434425354f, 0.155007154f},
-std::array<float,2>{0.983922839f, 0.782476664f},
-std::array<float,2>{0.333742827f, 0.977178335f},
-std::array<float,2>{0.86023432f, 0.0174469631f},
-std::array<float,2>{0.204543203f, 0.487175524f},
-std::array<float,2>{0.526523113f, 0.705265582f},
-std::array<float,2>{0.0714368746f, 0.869143724f},
-std::array<float,2>{0.650154948f, 0.202467173f},
-std::array<float,2>{0.488635331f, 0.292313099f},
-std::array<float,2>{0.886923552f, 0.61867249f},
-std::array<float,2>{0.274131298f, 0.67494899f},
-std::array<float,2>{0.7808097f, 0.42349425f},
-std::array<float,2>{0.171549261f, 0.0796994567f},
-std::array<float,2>{0.590295017f, 0.900186181f},
-std::array<float,2>{0.214677632f, 0.52306658f},
-std::array<float,2>{0.519688129f, 0.349191487f},
-std::array<float,2>{0.343668729f, 0.184328124f},
-std::array<float,2>{0.86803019f, 0.776520312f},
-std::array<float,2>{0.428880662f, 0.954728961f},
-std::array<float,2>{0.969936848f, 0.032142289f},
-std::array<float,2>{0.0206333082f, 0.466226935f},
-std::array<float,2>{0.719109178f, 0.722895145f},
-std::array<float,2>{0.141606152f, 0.910551071f},
-std::array<float,2>{0.603639364f, 0.0981744751f},
-std::array<float,2>{0.29091388f, 0.387626082f},
-std::array<float,2>{0.78963995f, 0.636076689f},
-std::array<float,2>{0.455543131f, 0.574518681f},
-std::array<float,2>{0.916326404f, 0.275601834f},
-std::array<float,2>{0.115165494f, 0.231145725f},
-std::array<float,2>{0.682585299f, 0.839546561f},
-std::array<float,2>{0.0485551432f, 0.714188278f},
-std::array<float,2>{0.70440042f, 0.494918078f},
-std::array<float,2>{0.385606766f, 0.0255188532f},
-std::array<float,2>{0.961885571f, 0.970822215f},
-std::array<float,2>{0.349016875f, 0.795922995f},
-std::array<float,2>{0.843249679f, 0.14683488f},
-std::array<float,2>{0.230262324f, 0.337454855f},
-std::array<float,2>{0.556447446f, 0.558393598f},
-std::array<float,2>{0.0154712955f, 0.985491037f},
-std::array<float,2>{0.741026342f, 0.001239429f},
-std::array<float,2>{0.413710982f, 0.481037647f},
-std::array<float,2>{0.99704951f, 0.693426371f},
-std::array<float,2>{0.325936317f, 0.541163862f},
-std::array<float,2>{0.845273197f, 0.313874006f},
-std::array<float,2>{0.19035916f, 0.125017047f},
-std::array<float,2>{0.506522596f, 0.803863466f},
-std::array<float,2>{0.187125891f, 0.65357244f},
-std::array<float,2>{0.573175907f, 0.402730376f},
-std::array<float,2>{0.253912508f, 0.124716237f},
-std::array<float,2>{0.761841536f, 0.927689373f},
-std::array<float,2>{0.472682744f, 0.823043108f},
-std::array<float,2>{0.900081277f, 0.240890771f},
-std::array<float,2>{0.0811209604f, 0.259758592f},
-std::array<float,2>{0.63335526f, 0.587093771f},
-std::array<float,2>{0.241570845f, 0.75427109f},
-std::array<float,2>{0.53845489f, 0.170020461f},
-std::array<float,2>{0.360116273f, 0.362854362f},
-std::array<float,2>{0.818572521f, 0.50832659f},
-std::array<float,2>{0.396455914f, 0.749297142f},
-std::array<float,2>{0.940640152f, 0.441270709f},
-std::array<float,2>{0.046028059f, 0.0490208156f},
-std::array<float,2>{0.69505924f, 0.948861361f},
-std::array<float,2>{0.100412957f, 0.600643456f},
-std::array<float,2>{0.661277115f, 0.302427441f},
-std::array<float,2>{0.445410877f, 0.205115497f},
-std::array<float,2>{0.924525082f, 0.850190222f},
-std::array<float,2>{0.31027019f, 0.888833582f},
-std::array<float,2>{0.801994324f, 0.0628850162f},
-std::array<float,2>{0.130547777f, 0.418043762f},
-std::array<float,2>{0.621699989f, 0.660305977f},
-std::array<float,2>{0.1070363f, 0.780523479f},
-std::array<float,2>{0.66496098f, 0.179810464f},
-std::array<float,2>{0.441272348f, 0.347638696f},
-std::array<float,2>{0.937201321f, 0.5185799f},
-std::array<float,2>{0.297340453f, 0.722277462f},
-std::array<float,2>{0.811139643f, 0.461141765f},
-std::array<float,2>{0.135635182f, 0.0362098627f},
-std::array<float,2>{0.6145913f, 0.9591856f},
-std::array<float,2>{0.24247326f, 0.623879373f},
-std::array<float,2>{0.54400146f, 0.293037862f},
-std::array<float,2>{0.367449462f, 0.197749361f},
-std::array<float,2>{0.826261759f, 0.873019814f},
-std::array<float,2>{0.404358774f, 0.905329168f},
-std::array<float,2>{0.95277369f, 0.0829710141f},
-std::array<float,2>{0.0333641656f, 0.42853719f},
-std::array<float,2>{0.697916031f, 0.675941885f},
-std::array<float,2>{0.172968969f, 0.973327518f},
-std::array<float,2>{0.567809582f, 0.0286759846f},
-std::array<float,2>{0.263441265f, 0.499663085f},
-std::array<float,2>{0.753834665f, 0.715721428f},
-std::array<float,2>{0.47914359f, 0.561096609f},
-std::array<float,2>{0.895131588f, 0.341209948f},
-std::array<float,2>{0.090840295f, 0.141148031f},
-std::array<float,2>{0.631227136f, 0.790753365f},
-std::array<float,2>{0.00632472662f, 0.639821649f},
-std::array<float,2>{0.748941779f, 0.382936597f},
-std::array<float,2>{0.421440691f, 0.0975201949f},
-std::array<float,2>{0.990991652f, 0.908995152f},
-std::array<float,2>{0.316287488f, 0.840785801f},
-std::array<float,2>{0.857144952f, 0.227245107f},
-std::array<float,2>{0.201986492f, 0.279255748f},
-std::array<float,2>{0.514878571f, 0.57261157f},
-std::array<float,2>{0.0602152869f, 0.924554467f},
-std::array<float,2>{0.712046802f, 0.12095914f},
-std::array<float,2>{0.381190866f, 0.401354343f},
-std::array<float,2>{0.960271358f, 0.648819447f},
-std::array<float,2>{0.352995664f, 0.592411816f},
-std::array<float,2>{0.82862103f, 0.263172418f},
-std::array<float,2>{0.226435184f, 0.235067472f},
-std::array<float,2>{0.551448941f, 0.826350868f},
-std::array<float,2>{0.154221639f, 0.68895787f},
-std::array<float,2>{0.598340213f, 0.477754802f},
-std::array<float,2>{0.281784594f, 0.00715061836f},
-std::array<float,2>{0.788795412f, 0.99076581f},
-std::array<float,2>{0.465651572f, 0.798431158f},
-std::array<float,2>{0.906325698f, 0.130251363f},
-std::array<float,2>{0.123190448f, 0.319259584f},
-std::array<float,2>{0.674546301f, 0.543634653f},
-std::array<float,2>{0.210543111f, 0.847309947f},
-std::array<float,2>{0.528805137f, 0.207182243f},
-std::array<float,2>{0.331850976f, 0.298262477f},
-std::array<float,2>{0.863987565f, 0.595730841f},
-std::array<float,2>{0.430932611f, 0.656571984f},
-std::array<float,2>{0.977701366f, 0.416569084f},
-std::array<float,2>{0.0258176737f, 0.0682785511f},
-std::array<float,2>{0.730932474f, 0.885894358f},
-std::array<float,2>{0.0646556318f, 0.514766157f},
-std::array<float,2>{0.643808484f, 0.367087722f},
-std::array<float,2>{0.495412946f, 0.16625683f},
-std::array<float,2>{0.880404234f, 0.750558496f},
-std::array<float,2>{0.269554049f, 0.951599538f},
-std::array<float,2>{0.767500401f, 0.0511944853f},
-std::array<float,2>{0.161858216f, 0.443240583f},
-std::array<float,2>{0.584529757f, 0.743146658f},
-std::array<float,2>{0.0188593157f, 0.818119407f},
-std::array<float,2>{0.723283648f, 0.249735445f},
-std::array<float,2>{0.42394492f, 0.253792435f},
-std::array<float,2>{0.973835886f, 0.58276242f},
-std::array<float,2>{0.339198261f, 0.643327296f},
-std::array<float,2>{0.87452966f, 0.390927225f},
-std::array<float,2>{0.21619904f, 0.114461251f},
-std::array<float,2>{0.516642272f, 0.93030405f},
-std::array<float,2>{0.167111769f, 0.531563103f},
-std::array<float,2>{0.588328958f, 0.321112961f},
-std::array<float,2>{0.280006647f, 0.135459229f},
-std::array<float,2>{0.774295151f, 0.809934735f},
-std::array<float,2>{0.485153407f, 0.99280256f},
-std::array<float,2>{0.886661768f, 0.0110394824f},
-std::array<float,2>{0.0772755072f, 0.472931117f},
-std::array<float,2>{0.656003058f, 0.701213419f},
-std::array<float,2>{0.232106596f, 0.877772152f},
-std::array<float,2>{0.559727669f, 0.0741893351f},
-std::array<float,2>{0.345714033f, 0.413020432f},
-std::array<float,2>{0.838365972f, 0.664123297f},
-std::array<float,2>{0.390328586f, 0.607754767f},
-std::array<float,2>{0.968424916f, 0.309946954f},
-std::array<float,2>{0.053987857f, 0.21574077f},
-std::array<float,2>{0.710442901f, 0.855201781f},
-std::array<float,2>{0.109688558f, 0.734470487f},
-std::array<float,2>{0.684299171f, 0.446767956f},
-std::array<float,2>{0.457371801f, 0.0587760024f},
-std::array<float,2>{0.920692623f, 0.944651186f},
-std::array<float,2>{0.294723183f, 0.760450959f},
-std::array<float,2>{0.794536054f, 0.163441658f},
-std::array<float,2>{0.147678539f, 0.369952589f},
-std::array<float,2>{0.608594954f, 0.504180193f},
-std::array<float,2>{0.08371149f, 0.967329025f},
-std::array<float,2>{0.638106942f, 0.0451259837f},
-std::array<float,2>{0.469448447f, 0.456708997f},
-std::array<float,2>{0.902879f, 0.730507851f},
-std::array<float,2>{0.25172171f, 0.524251223f},
-std::array<float,2>{0.758418322f, 0.355731994f},
-std::array<float,2>{0.181185976f, 0.176783621f},
-std::array<float,2>{0.574890137f, 0.765678465f},
-std::array<float,2>{0.194864422f, 0.686927795f},
-std::array<float,2>{0.500430942f, 0.436844975f},
-std::array<float,2>{0.323943228f, 0.0907149836f},
-std::array<float,2>{0.849241555f, 0.897121012f},
-std::array<float,2>{0.407654792f, 0.86504364f},
-std::array<float,2>{0.994822025f, 0.192366168f},
-std::array<float,2>{0.0108585693f, 0.284677178f},
-std::array<float,2>{0.734492302f, 0.613263726f},
-std::array<float,2>{0.128666461f, 0.787413061f},
-std::array<float,2>{0.618697464f, 0.150713012f},
-std::array<float,2>{0.305786878f, 0.330528051f},
-std::array<float,2>{0.797558188f, 0.551512718f},
-std::array<float,2>{0.4496122f, 0.707615614f},
-std::array<float,2>{0.929121792f, 0.491902977f},
-std::array<float,2>{0.0953928456f, 0.0218111314f},
-std::array<float,2>{0.65845561f, 0.981600761f},
-std::array<float,2>{0.0426381119f, 0.568082392f},
-std::array<float,2>{0.691274464f, 0.268377453f},
-std::array<float,2>{0.394061327f, 0.222493589f},
-std::array<float,2>{0.941596508f, 0.833985507f},
-std::array<float,2>{0.364505053f, 0.917076707f},
-std::array<float,2>{0.813707829f, 0.103155516f},
-std::array<float,2>{0.237643436f, 0.381313354f},
-std::array<float,2>{0.531674027f, 0.630853117f},
-std::array<float,2>{0.0284308847f, 0.781555057f},
-std::array<float,2>{0.726782024f, 0.155351907f},
-std::array<float,2>{0.43563211f, 0.334627599f},
-std::array<float,2>{0.981880069f, 0.549309671f},
-std::array<float,2>{0.33446458f, 0.706671834f},
-std::array<float,2>{0.861593902f, 0.487612307f},
-std::array<float,2>{0.206864551f, 0.0166008137f},
-std::array<float,2>{0.523988962f, 0.978293359f},
-std::array<float,2>{0.156843975f, 0.562779129f},
-std::array<float,2>{0.581708312f, 0.269614607f},
-std::array<float,2>{0.265820801f, 0.223163888f},
-std::array<float,2>{0.769693136f, 0.829225898f},
-std::array<float,2>{0.496433735f, 0.921134353f},
-std::array<float,2>{0.877696991f, 0.106949389f},
-std::array<float,2>{0.069763042f, 0.375924498f},
-std::array<float,2>{0.64824903f, 0.627579391f},
-std::array<float,2>{0.219126478f, 0.964556277f},
-std::array<float,2>{0.550558686f, 0.0421828777f},
-std::array<float,2>{0.358598351f, 0.460484713f},
-std::array<float,2>{0.834413052f, 0.726983488f},
-std::array<float,2>{0.37881586f, 0.529807329f},
-std::array<float,2>{0.954916775f, 0.353423625f},
-std::array<float,2>{0.0583688691f, 0.173722178f},
-std::array<float,2>{0.716663778f, 0.771419227f},
-std::array<float,2>{0.119656779f, 0.681828618f},
-std::array<float,2>{0.677075088f, 0.430090338f},
-std::array<float,2>{0.461711824f, 0.0860579461f},
-std::array<float,2>{0.913509309f, 0.89303416f},
-std::array<float,2>{0.288989156f, 0.861755133f},
-std::array<float,2>{0.782897115f, 0.187517583f},
-std::array<float,2>{0.151067391f, 0.286574543f},
-std::array<float,2>{0.595393062f, 0.615293205f},
-std::array<float,2>{0.0861463472f, 0.881735563f},
-std::array<float,2>{0.625852525f, 0.0780492872f},
-std::array<float,2>{0.481289268f, 0.408150315f},
-std::array<float,2>{0.893579721f, 0.671502233f},
-std::array<float,2>{0.259974003f, 0.605127215f},
-std::array<float,2>{0.757413089f, 0.30494082f},
-std::array<float,2>{0.178905517f, 0.214703426f},
-std::array<float,2>{0.565935135f, 0.855649292f},
-std::array<float,2>{0.19581598f, 0.741565347f},
-std::array<float,2>{0.511268437f, 0.449648887f},
-std::array<float,2>{0.31677106f, 0.0579107292f},
-std::array<float,2>{0.851568758f, 0.939552426f},
-std::array<float,2>{0.414334595f, 0.765063286f},
-std::array<float,2>{0.984419644f, 0.156743646f},
-std::array<float,2>{0.00307699246f, 0.373418272f},
-std::array<float,2>{0.744476855f, 0.50382334f},
-std::array<float,2>{0.139114752f, 0.8159886f},
-std::array<float,2>{0.611905396f, 0.244877964f},
-std::array<float,2>{0.302655101f, 0.256524235f},
-std::array<float,2>{0.807829082f, 0.579394817f},
-std::array<float,2>{0.443535239f, 0.646448791f},
-std::array<float,2>{0.932437658f, 0.395846277f},
-std::array<float,2>{0.103149392f, 0.110877924f},
-std::array<float,2>{0.671319187f, 0.936694324f},
-std::array<float,2>{0.0364675708f, 0.536153555f},
-std::array<float,2>{0.70214045f, 0.326973796f},
-std::array<float,2>{0.39987883f, 0.137881145f},
-std::array<float,2>{0.947322965f, 0.807432532f},
-std::array<float,2>{0.372226f, 0.999471128f},
-std::array<float,2>{0.821924508f, 0.0131801059f},
-std::array<float,2>{0.248828754f, 0.471517563f},
-std::array<float,2>{0.542871356f, 0.69797802f},
-std::array<float,2>{0.0983131751f, 0.851000071f},
-std::array<float,2>{0.663190246f, 0.206970543f},
-std::array<float,2>{0.447313964f, 0.301608562f},
-std::array<float,2>{0.923751414f, 0.600242555f},
-std::array<float,2>{0.310974181f, 0.661142647f},
-std::array<float,2>{0.80355078f, 0.419104308f},
-std::array<float,2>{0.132015765f, 0.0641456246f},
-std::array<float,2>{0.623363197f, 0.890206933f},
-std::array<float,2>{0.239545032f, 0.509554803f},
-std::array<float,2>{0.536905408f, 0.361561894f},
-std::array<float,2>{0.362399668f, 0.171807587f},
-std::array<float,2>{0.817436218f, 0.755245805f},
-std::array<float,2>{0.39683944f, 0.948211432f},
-std::array<float,2>{0.937694609f, 0.0499809869f},
-std::array<float,2>{0.044358328f, 0.439760476f},
-std::array<float,2>{0.691673338f, 0.748584449f},
-std::array<float,2>{0.184343755f, 0.92641592f},
-std::array<float,2>{0.571150362f, 0.123098247f},
-std::array<float,2>{0.256005913f, 0.403871089f},
-std::array<float,2>{0.764659345f, 0.652465165f},
-std::array<float,2>{0.475732565f, 0.586684763f},
-std::array<float,2>{0.900817752f, 0.257812709f},
-std::array<float,2>{0.0799836516f, 0.241842121f},
-std::array<float,2>{0.635301709f, 0.824042022f},
-std::array<float,2>{0.0134040015f, 0.694552004f},
-std::array<float,2>{0.738606334f, 0.482284606f},
-std::array<float,2>{0.411578298f, 0.00091330416f},
-std::array<float,2>{0.99991399f, 0.984866917f},
-std::array<float,2>{0.327992946f, 0.803416729f},
-std::array<float,2>{0.845958531f, 0.126436278f},
-std::array<float,2>{0.189251781f, 0.312867582f},
-std::array<float,2>{0.505707324f, 0.5421893f},
-std::array<float,2>{0.0500574335f, 0.972635567f},
-std::array<float,2>{0.706790507f, 0.0272454601f},
-std::array<float,2>{0.38307938f, 0.495250344f},
-std::array<float,2>{0.963148296f, 0.713321686f},
-std::array<float,2>{0.351332814f, 0.557287276f},
-std::array<float,2>{0.841766953f, 0.336072087f},
-std::array<float,2>{0.226767272f, 0.147862941f},
-std::array<float,2>{0.558345437f, 0.795591831f},
-std::array<float,2>{0.144071504f, 0.634841859f},
-std::array<float,2>{0.602034628f, 0.388459682f},
-std::array<float,2>{0.292117685f, 0.0990189761f},
-std::array<float,2>{0.791338384f, 0.911247373f},
-std::array<float,2>{0.455040783f, 0.838406742f},
-std::array<float,2>{0.915679872f, 0.232175767f},
-std::array<float,2>{0.1163022f, 0.276589036f},
-std::array<float,2>{0.679886341f, 0.57573092f},
-std::array<float,2>{0.211340055f, 0.775941789f},
-std::array<float,2>{0.522607028f, 0.185207993f},
-std::array<float,2>{0.341459066f, 0.348177642f},
-std::array<float,2>{0.869406343f, 0.522237659f},
-std::array<float,2>{0.426925659f, 0.723721325f},
-std::array<float,2>{0.972151935f, 0.465383023f},
-std::array<float,2>{0.0219649803f, 0.0329479948f},
-std::array<float,2>{0.722248077f, 0.953125f},
-std::array<float,2>{0.0735435709f, 0.617786169f},
-std::array<float,2>{0.65042603f, 0.291589469f},
-std::array<float,2>{0.492183864f, 0.201847851f},
-std::array<float,2>{0.88955462f, 0.870290577f},
-std::array<float,2>{0.275722474f, 0.898935676f},
-std::array<float,2>{0.778207123f, 0.0789726377f},
-std::array<float,2>{0.168948695f, 0.422076404f},
-std::array<float,2>{0.591865301f, 0.674490273f},
-std::array<float,2>{0.0632698089f, 0.751680493f},
-std::array<float,2>{0.641422927f, 0.167588264f},
-std::array<float,2>{0.493142068f, 0.36563167f},
-std::array<float,2>{0.880970776f, 0.514623821f},
-std::array<float,2>{0.271668375f, 0.74346149f},
-std::array<float,2>{0.767664433f, 0.442032874f},
-std::array<float,2>{0.163414419f, 0.0520796254f},
-std::array<float,2>{0.583235919f, 0.953027666f},
-std::array<float,2>{0.207906187f, 0.596699774f},
-std::array<float,2>{0.530657947f, 0.297496736f},
-std::array<float,2>{0.329726905f, 0.208374679f},
-std::array<float,2>{0.867173254f, 0.846203685f},
-std::array<float,2>{0.433037281f, 0.885331452f},
-std::array<float,2>{0.979265034f, 0.0670444444f},
-std::array<float,2>{0.0238569975f, 0.417464197f},
-std::array<float,2>{0.733712494f, 0.657358289f},
-std::array<float,2>{0.154926673f, 0.99201709f},
-std::array<float,2>{0.599679887f, 0.00677599758f},
-std::array<float,2>{0.283653021f, 0.476875246f},
-std::array<float,2>{0.786747992f, 0.687883019f},
-std::array<float,2>{0.467851996f, 0.544006228f},
-std::array<float,2>{0.909482837f, 0.319783002f},
-std::array<float,2>{0.121601865f, 0.129132316f},
-std::array<float,2>{0.672551394f, 0.797067165f},
-std::array<float,2>{0.061865747f, 0.649580121f},
-std::array<float,2>{0.714531362f, 0.401627064f},
-std::array<float,2>{0.379591256f, 0.119722128f},
-std::array<float,2>{0.958191216f, 0.925606906f},
-std::array<float,2>{0.354513764f, 0.827786326f},
-std::array<float,2>{0.831456006f, 0.23585619f},
-std::array<float,2>{0.22429271f, 0.261786073f},
-std::array<float,2>{0.554110169f, 0.593283474f},
-std::array<float,2>{0.00546855852f, 0.909582019f},
-std::array<float,2>{0.747879803f, 0.0964528844f},
-std::array<float,2>{0.41815716f, 0.38390854f},
-std::array<float,2>{0.990210474f, 0.639090478f},
-std::array<float,2>{0.313024551f, 0.573458493f},
-std::array<float,2>{0.857478738f, 0.277764171f},
-std::array<float,2>{0.199993774f, 0.227931798f},
-std::array<float,2>{0.512339532f, 0.841419399f},
-std::array<float,2>{0.173905089f, 0.716698527f},
-std::array<float,2>{0.568674147f, 0.498828053f},
-std::array<float,2>{0.264629155f, 0.0274288412f},
-std::array<float,2>{0.750293195f, 0.974470139f},
-std::array<float,2>{0.476661384f, 0.789390206f},
-std::array<float,2>{0.896567643f, 0.142190978f},
-std::array<float,2>{0.0928331688f, 0.339981526f},
-std::array<float,2>{0.630214036f, 0.561779201f},
-std::array<float,2>{0.246002913f, 0.871880591f},
-std::array<float,2>{0.546552062f, 0.198754862f},
-std::array<float,2>{0.370463729f, 0.294847608f},
-std::array<float,2>{0.825359344f, 0.624395192f},
-std::array<float,2>{0.404180825f, 0.677429616f},
-std::array<float,2>{0.951040566f, 0.429525465f},
-std::array<float,2>{0.0327733941f, 0.0837571025f},
-std::array<float,2>{0.697212517f, 0.904451847f},
-std::array<float,2>{0.107650578f, 0.517678261f},
-std::array<float,2>{0.666872084f, 0.346045971f},
-std::array<float,2>{0.438296556f, 0.180838779f},
-std::array<float,2>{0.935322881f, 0.779716492f},
-std::array<float,2>{0.29969427f, 0.960446477f},
-std::array<float,2>{0.810190439f, 0.0356240161f},
-std::array<float,2>{0.133691549f, 0.462318629f},
-std::array<float,2>{0.615396321f, 0.721647978f},
-std::array<float,2>{0.0395214483f, 0.835826159f},
-std::array<float,2>{0.688544869f, 0.220897347f},
-std::array<float,2>{0.391456574f, 0.268830448f},
-std::array<float,2>{0.944146574f, 0.566460669f},
-std::array<float,2>{0.366397619f, 0.629206896f},
-std::array<float,2>{0.81582588f, 0.382082283f},
-std::array<float,2>{0.235813707f, 0.101882428f},
-std::array<float,2>{0.53391093f, 0.916617811f},
-std::array<float,2>{0.126661837f, 0.552266181f},
-std::array<float,2>{0.619372666f, 0.331968009f},
-std::array<float,2>{0.307156086f, 0.152342379f},
-std::array<float,2>{0.798898637f, 0.788627326f},
-std::array<float,2>{0.452282548f, 0.981431842f},
-std::array<float,2>{0.927040875f, 0.0226688851f},
-std::array<float,2>{0.0958301574f, 0.490649343f},
-std::array<float,2>{0.656504869f, 0.708260715f},
-std::array<float,2>{0.191816881f, 0.898418844f},
-std::array<float,2>{0.502158225f, 0.0908478275f},
-std::array<float,2>{0.322111547f, 0.436201751f},
-std::array<float,2>{0.849994302f, 0.686064065f},
-std::array<float,2>{0.408764184f, 0.611941695f},
-std::array<float,2>{0.993489444f, 0.283763468f},
-std::array<float,2>{0.00890999474f, 0.193207532f},
-std::array<float,2>{0.736782372f, 0.864104211f},
-std::array<float,2>{0.0850646943f, 0.731666565f},
-std::array<float,2>{0.640539289f, 0.455296695f},
-std::array<float,2>{0.472364902f, 0.04653598f},
-std::array<float,2>{0.906059504f, 0.96830672f},
-std::array<float,2>{0.252973467f, 0.767469645f},
-std::array<float,2>{0.761039078f, 0.176708445f},
-std::array<float,2>{0.182215959f, 0.357390761f},
-std::array<float,2>{0.576355338f, 0.524447143f},
-std::array<float,2>{0.113055833f, 0.943931937f},
-std::array<float,2>{0.687450111f, 0.0595902987f},
-std::array<float,2>{0.459632397f, 0.445656836f},
-std::array<float,2>{0.919538975f, 0.73573792f},
-std::array<float,2>{0.295289159f, 0.505747139f},
-std::array<float,2>{0.796729863f, 0.370182216f},
-std::array<float,2>{0.145517588f, 0.162685484f},
-std::array<float,2>{0.606338918f, 0.761671662f},
-std::array<float,2>{0.233404458f, 0.665314078f},
-std::array<float,2>{0.561739922f, 0.413971066f},
-std::array<float,2>{0.344603598f, 0.0728241429f},
-std::array<float,2>{0.837055981f, 0.878882587f},
-std::array<float,2>{0.386896878f, 0.854239702f},
-std::array<float,2>{0.965522945f, 0.216610104f},
-std::array<float,2>{0.0521476083f, 0.309227914f},
-std::array<float,2>{0.707478166f, 0.608832717f},
-std::array<float,2>{0.166008651f, 0.809327483f},
-std::array<float,2>{0.586748838f, 0.136578247f},
-std::array<float,2>{0.27905336f, 0.321517587f},
-std::array<float,2>{0.777138114f, 0.532443523f},
-std::array<float,2>{0.488020271f, 0.702880204f},
-std::array<float,2>{0.884023666f, 0.47397542f},
-std::array<float,2>{0.074230887f, 0.0106328763f},
-std::array<float,2>{0.652723551f, 0.993590891f},
-std::array<float,2>{0.0164565183f, 0.583296657f},
-std::array<float,2>{0.725427389f, 0.252533525f},
-std::array<float,2>{0.421898276f, 0.248539954f},
-std::array<float,2>{0.975754857f, 0.816762447f},
-std::array<float,2>{0.336120784f, 0.931205988f},
-std::array<float,2>{0.871594846f, 0.11388202f},
-std::array<float,2>{0.217059806f, 0.391931415f},
-std::array<float,2>{0.51865977f, 0.644483626f},
-std::array<float,2>{0.0549752265f, 0.772728562f},
-std::array<float,2>{0.717763603f, 0.175335556f},
-std::array<float,2>{0.375613958f, 0.354777396f},
-std::array<float,2>{0.95526123f, 0.527787447f},
-std::array<float,2>{0.355670065f, 0.729990959f},
-std::array<float,2>{0.832221448f, 0.457045734f},
-std::array<float,2>{0.222287104f, 0.0391228236f},
-std::array<float,2>{0.547261894f, 0.96155411f},
-std::array<float,2>{0.150320977f, 0.614445686f},
-std::array<float,2>{0.597008824f, 0.288152248f},
-std::array<float,2>{0.286366105f, 0.189531758f},
-std::array<float,2>{0.784538925f, 0.860922694f},
-std::array<float,2>{0.464122057f, 0.890986681f},
-std::array<float,2>{0.910731971f, 0.089245148f},
-std::array<float,2>{0.118411303f, 0.432993293f},
-std::array<float,2>{0.678889573f, 0.680523932f},
-std::array<float,2>{0.203766659f, 0.980245233f},
-std::array<float,2>{0.525758505f, 0.0185479783f},
-std::array<float,2>{0.332409501f, 0.484933347f},
-std::array<float,2>{0.860582411f, 0.704684794f},
-std::array<float,2>{0.435266852f, 0.548151076f},
-std::array<float,2>{0.98301512f, 0.333524942f},
-std::array<float,2>{0.030108884f, 0.153342247f},
-std::array<float,2>{0.729772747f, 0.78415513f},
-std::array<float,2>{0.0675369874f, 0.62623024f},
-std::array<float,2>{0.646308362f, 0.377649963f},
-std::array<float,2>{0.499704778f, 0.108328156f},
-std::array<float,2>{0.875651658f, 0.919788599f},
-std::array<float,2>{0.268939018f, 0.830344141f},
-std::array<float,2>{0.773212194f, 0.225649342f},
-std::array<float,2>{0.160011902f, 0.272825271f},
-std::array<float,2>{0.578922153f, 0.565493524f},
-std::array<float,2>{0.103722259f, 0.933750629f},
-std::array<float,2>{0.668613672f, 0.111501448f},
-std::array<float,2>{0.443100691f, 0.398314923f},
-std::array<float,2>{0.929880857f, 0.647732794f},
-std::array<float,2>{0.303463429f, 0.581397653f},
-std::array<float,2>{0.806360245f, 0.254255116f},
-std::array<float,2>{0.138499931f, 0.242190078f},
-std::array<float,2>{0.609458148f, 0.813568294f},
-std::array<float,2>{0.247357398f, 0.695601404f},
-std::array<float,2>{0.540066779f, 0.469887227f},
-std::array<float,2>{0.374673218f, 0.0149206519f},
-std::array<float,2>{0.822796047f, 0.996162415f},
-std::array<float,2>{0.401231855f, 0.806353927f},
-std::array<float,2>{0.945825756f, 0.138778389f},
-std::array<float,2>{0.0385651588f, 0.325656027f},
-std::array<float,2>{0.700609624f, 0.538087785f},
-std::array<float,2>{0.175919697f, 0.858136237f},
-std::array<float,2>{0.563608527f, 0.211699709f},
-std::array<float,2>{0.25840047f, 0.308205217f},
-std::array<float,2>{0.75437212f, 0.602582812f},
-std::array<float,2>{0.482931316f, 0.668034434f},
-std::array<float,2>{0.891267538f, 0.41002968f},
-std::array<float,2>{0.0892495811f, 0.0745522529f},
-std::array<float,2>{0.628691018f, 0.879058719f},
-std::array<float,2>{0.00149749883f, 0.500775754f},
-std::array<float,2>{0.742919803f, 0.371872902f},
-std::array<float,2>{0.417060345f, 0.158389553f},
-std::array<float,2>{0.987850606f, 0.762838244f},
-std::array<float,2>{0.319949836f, 0.938334584f},
-std::array<float,2>{0.854547501f, 0.0557464473f},
-std::array<float,2>{0.197801948f, 0.451299429f},
-std::array<float,2>{0.509235442f, 0.7401402f},
-std::array<float,2>{0.0802364051f, 0.82110703f},
-std::array<float,2>{0.634676337f, 0.239189222f},
-std::array<float,2>{0.474193245f, 0.260719627f},
-std::array<float,2>{0.898879766f, 0.589437842f},
-std::array<float,2>{0.255445629f, 0.655508518f},
-std::array<float,2>{0.763020813f, 0.405211091f},
-std::array<float,2>{0.186099499f, 0.122354962f},
-std::array<float,2>{0.573792279f, 0.92838484f},
-std::array<float,2>{0.19065249f, 0.539767504f},
-std::array<float,2>{0.507038116f, 0.314986318f},
-std::array<float,2>{0.324373692f, 0.128635198f},
-std::array<float,2>{0.844566822f, 0.801158547f},
-std::array<float,2>{0.412328422f, 0.988118708f},
-std::array<float,2>{0.997121215f, 0.00388387637f},
-std::array<float,2>{0.0142011177f, 0.483647227f},
-std::array<float,2>{0.742057621f, 0.692190349f},
-std::array<float,2>{0.129511803f, 0.887681961f},
-std::array<float,2>{0.622588515f, 0.0657503381f},
-std::array<float,2>{0.308866084f, 0.421462595f},
-std::array<float,2>{0.801715851f, 0.662822902f},
-std::array<float,2>{0.447062224f, 0.598297417f},
-std::array<float,2>{0.925364971f, 0.303214163f},
-std::array<float,2>{0.10143815f, 0.204763547f},
-std::array<float,2>{0.660438895f, 0.849543869f},
-std::array<float,2>{0.0451567844f, 0.746584177f},
-std::array<float,2>{0.693490505f, 0.439439952f},
-std::array<float,2>{0.394895524f, 0.0479456075f},
-std::array<float,2>{0.939650774f, 0.946834564f},
-std::array<float,2>{0.360685229f, 0.756273091f},
-std::array<float,2>{0.819682002f, 0.169730633f},
-std::array<float,2>{0.241123155f, 0.360536486f},
-std::array<float,2>{0.537539303f, 0.510222495f},
-std::array<float,2>{0.0195904244f, 0.95652169f},
-std::array<float,2>{0.720616281f, 0.0347539f},
-std::array<float,2>{0.428550571f, 0.468037575f},
-std::array<float,2>{0.969513416f, 0.726112723f},
-std::array<float,2>{0.342091531f, 0.520990372f},
-std::array<float,2>{0.868339896f, 0.350271404f},
-std::array<float,2>{0.213338509f, 0.186551943f},
-std::array<float,2>{0.520877123f, 0.773476362f},
-std::array<float,2>{0.170414165f, 0.673793614f},
-std::array<float,2>{0.591310322f, 0.424264997f},
-std::array<float,2>{0.274922818f, 0.0808157474f},
-std::array<float,2>{0.780056238f, 0.900731564f},
-std::array<float,2>{0.489678741f, 0.867235005f},
-std::array<float,2>{0.888491511f, 0.200256959f},
-std::array<float,2>{0.0705711097f, 0.289314061f},
-std::array<float,2>{0.64877224f, 0.620687366f},
-std::array<float,2>{0.228530452f, 0.794055521f},
-std::array<float,2>{0.554923534f, 0.144812137f},
-std::array<float,2>{0.348052919f, 0.339815229f},
-std::array<float,2>{0.84205389f, 0.555154622f},
-std::array<float,2>{0.386505097f, 0.712684751f},
-std::array<float,2>{0.962356806f, 0.493842423f},
-std::array<float,2>{0.0470677279f, 0.0241005551f},
-std::array<float,2>{0.703287125f, 0.970106065f},
-std::array<float,2>{0.114099875f, 0.576753616f},
-std::array<float,2>{0.683593631f, 0.275278896f},
-std::array<float,2>{0.45616889f, 0.233584166f},
-std::array<float,2>{0.917918742f, 0.837539196f},
-std::array<float,2>{0.289124072f, 0.912691295f},
-std::array<float,2>{0.790179074f, 0.0996871963f},
-std::array<float,2>{0.141182125f, 0.389837354f},
-std::array<float,2>{0.604551136f, 0.633869827f},
-std::array<float,2>{0.124162905f, 0.798952579f},
-std::array<float,2>{0.675587952f, 0.131052464f},
-std::array<float,2>{0.465934962f, 0.316810369f},
-std::array<float,2>{0.908136547f, 0.545400977f},
-std::array<float,2>{0.282660753f, 0.691013515f},
-std::array<float,2>{0.787473261f, 0.478895754f},
-std::array<float,2>{0.153296843f, 0.00509482156f},
-std::array<float,2>{0.598980308f, 0.989141703f},
-std::array<float,2>{0.225222811f, 0.589896679f},
-std::array<float,2>{0.552435517f, 0.264256001f},
-std::array<float,2>{0.352485389f, 0.236420289f},
-std::array<float,2>{0.829719841f, 0.825649917f},
-std::array<float,2>{0.382496715f, 0.922544181f},
-std::array<float,2>{0.959476888f, 0.118037745f},
-std::array<float,2>{0.0592800379f, 0.398768485f},
-std::array<float,2>{0.711498976f, 0.650633514f},
-std::array<float,2>{0.160594001f, 0.950166404f},
-std::array<float,2>{0.585229933f, 0.0541646928f},
-std::array<float,2>{0.271481067f, 0.445262432f},
-std::array<float,2>{0.766471207f, 0.744631946f},
-std::array<float,2>{0.494215995f, 0.513006628f},
-std::array<float,2>{0.879338622f, 0.363573909f},
-std::array<float,2>{0.0659518465f, 0.165913224f},
-std::array<float,2>{0.642999887f, 0.75317049f},
-std::array<float,2>{0.0268390663f, 0.659546316f},
-std::array<float,2>{0.731887639f, 0.415745407f},
-std::array<float,2>{0.430428743f, 0.0693561882f},
-std::array<float,2>{0.977005959f, 0.88338685f},
-std::array<float,2>{0.331048757f, 0.843828797f},
-std::array<float,2>{0.864657938f, 0.210305259f},
-std::array<float,2>{0.209621757f, 0.300658792f},
-std::array<float,2>{0.528261006f, 0.595366001f},
-std::array<float,2>{0.0343219489f, 0.903556883f},
-std::array<float,2>{0.698704958f, 0.0856834948f},
-std::array<float,2>{0.405879557f, 0.426347584f},
-std::array<float,2>{0.95129323f, 0.678912759f},
-std::array<float,2>{0.368904382f, 0.622140467f},
-std::array<float,2>{0.827604413f, 0.296460062f},
-std::array<float,2>{0.24398756f, 0.196495801f},
-std::array<float,2>{0.543030381f, 0.87469697f},
-std::array<float,2>{0.136660933f, 0.718968093f},
-std::array<float,2>{0.61349076f, 0.463945508f},
-std::array<float,2>{0.2979967f, 0.0386969782f},
-std::array<float,2>{0.811697364f, 0.958353758f},
-std::array<float,2>{0.440049678f, 0.77812326f},
-std::array<float,2>{0.936211169f, 0.182007253f},
-std::array<float,2>{0.106278919f, 0.345570028f},
-std::array<float,2>{0.665338039f, 0.516355693f},
-std::array<float,2>{0.202826798f, 0.842269421f},
-std::array<float,2>{0.51439476f, 0.230058238f},
-std::array<float,2>{0.315395713f, 0.279420257f},
-std::array<float,2>{0.856107414f, 0.57154572f},
-std::array<float,2>{0.420825154f, 0.638618648f},
-std::array<float,2>{0.99177134f, 0.385026604f},
-std::array<float,2>{0.00686260918f, 0.0949631557f},
-std::array<float,2>{0.749269962f, 0.908128738f},
-std::array<float,2>{0.0901793391f, 0.559173346f},
-std::array<float,2>{0.631885529f, 0.342125744f},
-std::array<float,2>{0.480041265f, 0.143098325f},
-std::array<float,2>{0.896085143f, 0.792169929f},
-std::array<float,2>{0.262174934f, 0.975155413f},
-std::array<float,2>{0.752290487f, 0.0312022083f},
-std::array<float,2>{0.17281498f, 0.497325331f},
-std::array<float,2>{0.566658974f, 0.717066586f},
-std::array<float,2>{0.010219859f, 0.865641534f},
-std::array<float,2>{0.736149013f, 0.194890872f},
-std::array<float,2>{0.406364709f, 0.28186208f},
-std::array<float,2>{0.995133102f, 0.611122072f},
-std::array<float,2>{0.323169112f, 0.684763551f},
-std::array<float,2>{0.848090827f, 0.433859646f},
-std::array<float,2>{0.193667278f, 0.0918156058f},
-std::array<float,2>{0.501898766f, 0.894949496f},
-std::array<float,2>{0.180035725f, 0.525469184f},
-std::array<float,2>{0.575853109f, 0.358605504f},
-std::array<float,2>{0.250917315f, 0.178111166f},
-std::array<float,2>{0.759181499f, 0.768285811f},
-std::array<float,2>{0.470164448f, 0.966353178f},
-std::array<float,2>{0.903823674f, 0.0430022441f},
-std::array<float,2>{0.0825885162f, 0.454760402f},
-std::array<float,2>{0.637237906f, 0.733531475f},
-std::array<float,2>{0.236606255f, 0.915091157f},
-std::array<float,2>{0.533091068f, 0.104687445f},
-std::array<float,2>{0.364052057f, 0.379224837f},
-std::array<float,2>{0.813018084f, 0.632689655f},
-std::array<float,2>{0.393551737f, 0.570277512f},
-std::array<float,2>{0.942608476f, 0.267270356f},
-std::array<float,2>{0.0417166948f, 0.220419526f},
-std::array<float,2>{0.6895172f, 0.832933366f},
-std::array<float,2>{0.0942579284f, 0.709496856f},
-std::array<float,2>{0.659483016f, 0.489830315f},
-std::array<float,2>{0.450558394f, 0.0206215996f},
-std::array<float,2>{0.927898288f, 0.983279288f},
-std::array<float,2>{0.305375904f, 0.786662519f},
-std::array<float,2>{0.797865629f, 0.149461553f},
-std::array<float,2>{0.126965314f, 0.329445124f},
-std::array<float,2>{0.617524445f, 0.554385006f},
-std::array<float,2>{0.0765429512f, 0.994630575f},
-std::array<float,2>{0.654873788f, 0.00887459517f},
-std::array<float,2>{0.485737652f, 0.475083262f},
-std::array<float,2>{0.885455012f, 0.701041639f},
-std::array<float,2>{0.281167537f, 0.534750342f},
-std::array<float,2>{0.774846673f, 0.322556645f},
-std::array<float,2>{0.166526377f, 0.134458005f},
-std::array<float,2>{0.589157641f, 0.811055899f},
-std::array<float,2>{0.21581392f, 0.642309308f},
-std::array<float,2>{0.516418874f, 0.39432466f},
-std::array<float,2>{0.338867158f, 0.11671254f},
-std::array<float,2>{0.873239338f, 0.931845546f},
-std::array<float,2>{0.425446332f, 0.819302499f},
-std::array<float,2>{0.973265529f, 0.247984588f},
-std::array<float,2>{0.0176265258f, 0.250192732f},
-std::array<float,2>{0.723759592f, 0.585532427f},
-std::array<float,2>{0.147080481f, 0.758762538f},
-std::array<float,2>{0.607587397f, 0.160618022f},
-std::array<float,2>{0.293874562f, 0.369083077f},
-std::array<float,2>{0.793364286f, 0.506599188f},
-std::array<float,2>{0.458261281f, 0.736855984f},
-std::array<float,2>{0.921660364f, 0.448059231f},
-std::array<float,2>{0.110537656f, 0.0620411113f},
-std::array<float,2>{0.68527776f, 0.941953599f},
-std::array<float,2>{0.0536865592f, 0.606097877f},
-std::array<float,2>{0.709411323f, 0.311435312f},
-std::array<float,2>{0.389074087f, 0.217115521f},
-std::array<float,2>{0.967093647f, 0.851569235f},
-std::array<float,2>{0.347076118f, 0.876702011f},
-std::array<float,2>{0.839017808f, 0.0718328953f},
-std::array<float,2>{0.231316835f, 0.411534995f},
-std::array<float,2>{0.559185386f, 0.667559147f},
-std::array<float,2>{0.0234400108f, 0.752898514f},
-std::array<float,2>{0.733608723f, 0.164339676f},
-std::array<float,2>{0.432724774f, 0.364898354f},
-std::array<float,2>{0.979090154f, 0.512395382f},
-std::array<float,2>{0.329992145f, 0.745784402f},
-std::array<float,2>{0.866817176f, 0.443823993f},
-std::array<float,2>{0.207672626f, 0.0534274317f},
-std::array<float,2>{0.530323863f, 0.950517654f},
-std::array<float,2>{0.16317524f, 0.594626665f},
-std::array<float,2>{0.583305836f, 0.299342483f},
-std::array<float,2>{0.271958143f, 0.209577158f},
-std::array<float,2>{0.76782912f, 0.845477462f},
-std::array<float,2>{0.492793769f, 0.884137094f},
-std::array<float,2>{0.881157935f, 0.0692575648f},
-std::array<float,2>{0.0630034432f, 0.41459772f},
-std::array<float,2>{0.641292274f, 0.658508599f},
-std::array<float,2>{0.224490643f, 0.989492118f},
-std::array<float,2>{0.553902686f, 0.00437788107f},
-std::array<float,2>{0.354969919f, 0.480385005f},
-std::array<float,2>{0.8312428f, 0.690087497f},
-std::array<float,2>{0.379720598f, 0.54656601f},
-std::array<float,2>{0.958324432f, 0.317626506f},
-std::array<float,2>{0.061602883f, 0.132386431f},
-std::array<float,2>{0.714678943f, 0.800535083f},
-std::array<float,2>{0.121950962f, 0.651875556f},
-std::array<float,2>{0.672848463f, 0.400004894f},
-std::array<float,2>{0.468258917f, 0.118339539f},
-std::array<float,2>{0.909276903f, 0.923801959f},
-std::array<float,2>{0.283359617f, 0.825153589f},
-std::array<float,2>{0.786967278f, 0.237315357f},
-std::array<float,2>{0.155191854f, 0.264894128f},
-std::array<float,2>{0.600075722f, 0.591691494f},
-std::array<float,2>{0.0931465775f, 0.907146394f},
-std::array<float,2>{0.630034208f, 0.0946618691f},
-std::array<float,2>{0.477043182f, 0.386308193f},
-std::array<float,2>{0.896820605f, 0.636767268f},
-std::array<float,2>{0.264284551f, 0.571257114f},
-std::array<float,2>{0.750132322f, 0.280713409f},
-std::array<float,2>{0.174142942f, 0.228816763f},
-std::array<float,2>{0.568423569f, 0.843603849f},
-std::array<float,2>{0.199845806f, 0.717878938f},
-std::array<float,2>{0.512603819f, 0.496328741f},
-std::array<float,2>{0.313271552f, 0.0297219697f},
-std::array<float,2>{0.857699692f, 0.976305604f},
-std::array<float,2>{0.418366969f, 0.791217387f},
-std::array<float,2>{0.989924729f, 0.143565089f},
-std::array<float,2>{0.00563490717f, 0.343555301f},
-std::array<float,2>{0.747709334f, 0.560077906f},
-std::array<float,2>{0.133463562f, 0.873973489f},
-std::array<float,2>{0.615577757f, 0.196074978f},
-std::array<float,2>{0.299330443f, 0.295779794f},
-std::array<float,2>{0.810378075f, 0.621930122f},
-std::array<float,2>{0.438192457f, 0.67818588f},
-std::array<float,2>{0.935105145f, 0.426875412f},
-std::array<float,2>{0.107811198f, 0.0842283815f},
-std::array<float,2>{0.666591883f, 0.902923882f},
-std::array<float,2>{0.0330770798f, 0.51750809f},
-std::array<float,2>{0.697005689f, 0.344688535f},
-std::array<float,2>{0.403835684f, 0.182766333f},
-std::array<float,2>{0.950811684f, 0.77867347f},
-std::array<float,2>{0.370345771f, 0.957740903f},
-std::array<float,2>{0.825473845f, 0.0378426649f},
-std::array<float,2>{0.245741069f, 0.463558823f},
-std::array<float,2>{0.546867669f, 0.720281422f},
-std::array<float,2>{0.0961222574f, 0.833510697f},
-std::array<float,2>{0.656375945f, 0.219305962f},
-std::array<float,2>{0.452478439f, 0.265862375f},
-std::array<float,2>{0.926956117f, 0.568395019f},
-std::array<float,2>{0.307460278f, 0.631486833f},
-std::array<float,2>{0.79912293f, 0.379925221f},
-std::array<float,2>{0.126754478f, 0.104265995f},
-std::array<float,2>{0.619524956f, 0.914905965f},
-std::array<float,2>{0.235382497f, 0.553258002f},
-std::array<float,2>{0.534102976f, 0.328272611f},
-std::array<float,2>{0.366459548f, 0.149407223f},
-std::array<float,2>{0.815449417f, 0.785948813f},
-std::array<float,2>{0.391225696f, 0.983401597f},
-std::array<float,2>{0.943865001f, 0.0200992506f},
-std::array<float,2>{0.0392781235f, 0.489253908f},
-std::array<float,2>{0.688937902f, 0.710896432f},
-std::array<float,2>{0.182531446f, 0.896082759f},
-std::array<float,2>{0.576511621f, 0.0928375795f},
-std::array<float,2>{0.253308207f, 0.43458131f},
-std::array<float,2>{0.760817826f, 0.683749139f},
-std::array<float,2>{0.472523153f, 0.610090971f},
-std::array<float,2>{0.906003535f, 0.283148825f},
-std::array<float,2>{0.0854095221f, 0.194039613f},
-std::array<float,2>{0.640287757f, 0.866301775f},
-std::array<float,2>{0.00908303726f, 0.733118296f},
-std::array<float,2>{0.736550212f, 0.453716606f},
-std::array<float,2>{0.409169823f, 0.0440884009f},
-std::array<float,2>{0.99336493f, 0.965057909f},
-std::array<float,2>{0.322019845f, 0.769501925f},
-std::array<float,2>{0.84984225f, 0.179458871f},
-std::array<float,2>{0.191545472f, 0.3579202f},
-std::array<float,2>{0.502424657f, 0.526437879f},
-std::array<float,2>{0.0518368855f, 0.942496657f},
-std::array<float,2>{0.707154691f, 0.060640227f},
-std::array<float,2>{0.386964709f, 0.448364109f},
-std::array<float,2>{0.965788543f, 0.737954557f},
-std::array<float,2>{0.344442129f, 0.506941617f},
-std::array<float,2>{0.83723861f, 0.367814422f},
-std::array<float,2>{0.233671159f, 0.16127412f},
-std::array<float,2>{0.561822474f, 0.75970304f},
-std::array<float,2>{0.14581199f, 0.666452467f},
-std::array<float,2>{0.606148243f, 0.410492897f},
-std::array<float,2>{0.295133531f, 0.0711401403f},
-std::array<float,2>{0.796611607f, 0.875512838f},
-std::array<float,2>{0.459722966f, 0.853383839f},
-std::array<float,2>{0.919916093f, 0.218219131f},
-std::array<float,2>{0.112878352f, 0.31234625f},
-std::array<float,2>{0.687203169f, 0.606695056f},
-std::array<float,2>{0.21692121f, 0.81209147f},
-std::array<float,2>{0.519042313f, 0.133749872f},
-std::array<float,2>{0.336337686f, 0.323625594f},
-std::array<float,2>{0.871923149f, 0.533640504f},
-std::array<float,2>{0.422311932f, 0.699817181f},
-std::array<float,2>{0.975838959f, 0.476136625f},
-std::array<float,2>{0.0162443854f, 0.00804763846f},
-std::array<float,2>{0.725105703f, 0.995407939f},
-std::array<float,2>{0.0745247081f, 0.584528983f},
-std::array<float,2>{0.652385235f, 0.251181066f},
-std::array<float,2>{0.488221496f, 0.24661684f},
-std::array<float,2>{0.884186625f, 0.819839776f},
-std::array<float,2>{0.27893737f, 0.93320322f},
-std::array<float,2>{0.776979685f, 0.116138384f},
-std::array<float,2>{0.165566355f, 0.392754614f},
-std::array<float,2>{0.586509705f, 0.64078939f},
-std::array<float,2>{0.0695217475f, 0.784718812f},
-std::array<float,2>{0.647991836f, 0.152984127f},
-std::array<float,2>{0.496237427f, 0.33227089f},
-std::array<float,2>{0.877603292f, 0.547725081f},
-std::array<float,2>{0.266089201f, 0.70327431f},
-std::array<float,2>{0.76996398f, 0.485681653f},
-std::array<float,2>{0.157032505f, 0.019479651f},
-std::array<float,2>{0.581832826f, 0.979009748f},
-std::array<float,2>{0.206754521f, 0.56450665f},
-std::array<float,2>{0.524409413f, 0.272053033f},
-std::array<float,2>{0.334028482f, 0.224957526f},
-std::array<float,2>{0.861419976f, 0.831190705f},
-std::array<float,2>{0.435834289f, 0.918352306f},
-std::array<float,2>{0.981672764f, 0.10899099f},
-std::array<float,2>{0.0286304075f, 0.378219724f},
-std::array<float,2>{0.726895571f, 0.625238419f},
-std::array<float,2>{0.151328474f, 0.962888479f},
-std::array<float,2>{0.59553045f, 0.0400408879f},
-std::array<float,2>{0.288700223f, 0.458715707f},
-std::array<float,2>{0.783074796f, 0.729441524f},
-std::array<float,2>{0.461668193f, 0.528852403f},
-std::array<float,2>{0.91315341f, 0.354005247f},
-std::array<float,2>{0.120073065f, 0.174671873f},
-std::array<float,2>{0.676964402f, 0.771659911f},
-std::array<float,2>{0.0581078045f, 0.681631982f},
-std::array<float,2>{0.71650362f, 0.432230473f},
-std::array<float,2>{0.378470033f, 0.0887161791f},
-std::array<float,2>{0.954700351f, 0.891613841f},
-std::array<float,2>{0.358745873f, 0.85966444f},
-std::array<float,2>{0.834005177f, 0.190966815f},
-std::array<float,2>{0.218816951f, 0.287151992f},
-std::array<float,2>{0.550426006f, 0.613419831f},
-std::array<float,2>{0.0032701923f, 0.880687952f},
-std::array<float,2>{0.74424547f, 0.0753935874f},
-std::array<float,2>{0.414293945f, 0.408895195f},
-std::array<float,2>{0.98468852f, 0.669443548f},
-std::array<float,2>{0.316435307f, 0.602109373f},
-std::array<float,2>{0.851994097f, 0.307165116f},
-std::array<float,2>{0.196265757f, 0.212211788f},
-std::array<float,2>{0.511711657f, 0.858959496f},
-std::array<float,2>{0.179081321f, 0.738482177f},
-std::array<float,2>{0.566167057f, 0.45297271f},
-std::array<float,2>{0.26006785f, 0.0553097799f},
-std::array<float,2>{0.757717609f, 0.938668668f},
-std::array<float,2>{0.481067538f, 0.762202382f},
-std::array<float,2>{0.893830657f, 0.159655452f},
-std::array<float,2>{0.0863003284f, 0.372784942f},
-std::array<float,2>{0.625588238f, 0.501097858f},
-std::array<float,2>{0.24872157f, 0.813092351f},
-std::array<float,2>{0.542675078f, 0.243870631f},
-std::array<float,2>{0.372323513f, 0.255671859f},
-std::array<float,2>{0.822221935f, 0.580082536f},
-std::array<float,2>{0.399582744f, 0.647260368f},
-std::array<float,2>{0.947734177f, 0.397294104f},
-std::array<float,2>{0.0362912863f, 0.112319693f},
-std::array<float,2>{0.701900661f, 0.935021281f},
-std::array<float,2>{0.103278629f, 0.537772894f},
-std::array<float,2>{0.670968711f, 0.324535191f},
-std::array<float,2>{0.443633765f, 0.140109241f},
-std::array<float,2>{0.932220042f, 0.805323422f},
-std::array<float,2>{0.302403629f, 0.997572124f},
-std::array<float,2>{0.808009207f, 0.0138065312f},
-std::array<float,2>{0.138698697f, 0.468783736f},
-std::array<float,2>{0.61208576f, 0.696546912f},
-std::array<float,2>{0.0440543257f, 0.848419607f},
-std::array<float,2>{0.691593766f, 0.203608453f},
-std::array<float,2>{0.396673441f, 0.304494083f},
-std::array<float,2>{0.937984884f, 0.598996997f},
-std::array<float,2>{0.362630039f, 0.663991809f},
-std::array<float,2>{0.817637503f, 0.420506924f},
-std::array<float,2>{0.239281327f, 0.0649484396f},
-std::array<float,2>{0.536784589f, 0.888326347f},
-std::array<float,2>{0.132115781f, 0.51133877f},
-std::array<float,2>{0.623058259f, 0.360038698f},
-std::array<float,2>{0.310624182f, 0.168469951f},
-std::array<float,2>{0.803339541f, 0.757078469f},
-std::array<float,2>{0.447633237f, 0.946081698f},
-std::array<float,2>{0.923389852f, 0.0469969958f},
-std::array<float,2>{0.0985732526f, 0.437947512f},
-std::array<float,2>{0.663391352f, 0.747581303f},
-std::array<float,2>{0.189145118f, 0.929038346f},
-std::array<float,2>{0.505389631f, 0.121662259f},
-std::array<float,2>{0.327668458f, 0.405466944f},
-std::array<float,2>{0.845739007f, 0.655176401f},
-std::array<float,2>{0.411328793f, 0.58827883f},
-std::array<float,2>{0.999649644f, 0.261125267f},
-std::array<float,2>{0.0135177644f, 0.239561066f},
-std::array<float,2>{0.738281429f, 0.821512878f},
-std::array<float,2>{0.0797261372f, 0.692692995f},
-std::array<float,2>{0.635658026f, 0.483322948f},
-std::array<float,2>{0.475849271f, 0.00237593427f},
-std::array<float,2>{0.900627673f, 0.986634672f},
-std::array<float,2>{0.256143749f, 0.802185416f},
-std::array<float,2>{0.764955461f, 0.12705493f},
-std::array<float,2>{0.18429248f, 0.315799594f},
-std::array<float,2>{0.570961118f, 0.540197194f},
-std::array<float,2>{0.11665564f, 0.969072938f},
-std::array<float,2>{0.680089056f, 0.0246651042f},
-std::array<float,2>{0.454686344f, 0.492459565f},
-std::array<float,2>{0.915855944f, 0.711856365f},
-std::array<float,2>{0.292397439f, 0.556129813f},
-std::array<float,2>{0.791252375f, 0.33839342f},
-std::array<float,2>{0.144469276f, 0.145867109f},
-std::array<float,2>{0.601571083f, 0.79307127f},
-std::array<float,2>{0.226941511f, 0.632999003f},
-std::array<float,2>{0.558479786f, 0.388933688f},
-std::array<float,2>{0.351085424f, 0.101152785f},
-std::array<float,2>{0.841454864f, 0.913550556f},
-std::array<float,2>{0.382837623f, 0.836682916f},
-std::array<float,2>{0.963132203f, 0.232913539f},
-std::array<float,2>{0.0500236563f, 0.273608297f},
-std::array<float,2>{0.706673563f, 0.578092575f},
-std::array<float,2>{0.16923742f, 0.775314748f},
-std::array<float,2>{0.592249036f, 0.186224163f},
-std::array<float,2>{0.275483489f, 0.351506233f},
-std::array<float,2>{0.777873456f, 0.520230055f},
-std::array<float,2>{0.491816908f, 0.724777877f},
-std::array<float,2>{0.889356554f, 0.467591316f},
-std::array<float,2>{0.073420465f, 0.0336375237f},
-std::array<float,2>{0.650658548f, 0.955266416f},
-std::array<float,2>{0.0215877723f, 0.619736433f},
-std::array<float,2>{0.722596705f, 0.290291548f},
-std::array<float,2>{0.427033424f, 0.199815497f},
-std::array<float,2>{0.971767128f, 0.868496954f},
-std::array<float,2>{0.341716647f, 0.901955128f},
-std::array<float,2>{0.869353533f, 0.0812914819f},
-std::array<float,2>{0.21107465f, 0.425667465f},
-std::array<float,2>{0.522832155f, 0.672840118f},
-std::array<float,2>{0.05934323f, 0.798092902f},
-std::array<float,2>{0.711850643f, 0.130507201f},
-std::array<float,2>{0.382672668f, 0.318564802f},
-std::array<float,2>{0.9599123f, 0.543135405f},
-std::array<float,2>{0.352232009f, 0.689062893f},
-std::array<float,2>{0.829974115f, 0.478042692f},
-std::array<float,2>{0.225439757f, 0.00735416869f},
-std::array<float,2>{0.552670002f, 0.990629494f},
-std::array<float,2>{0.15299426f, 0.591934979f},
-std::array<float,2>{0.598814726f, 0.263643473f},
-std::array<float,2>{0.282384068f, 0.234474674f},
-std::array<float,2>{0.787116528f, 0.826796055f},
-std::array<float,2>{0.46619001f, 0.924098015f},
-std::array<float,2>{0.907861829f, 0.120148361f},
-std::array<float,2>{0.124294445f, 0.400776237f},
-std::array<float,2>{0.675463319f, 0.649024665f},
-std::array<float,2>{0.209904671f, 0.952073753f},
-std::array<float,2>{0.528026044f, 0.051272817f},
-std::array<float,2>{0.330800503f, 0.44258216f},
-std::array<float,2>{0.864299119f, 0.742513716f},
-std::array<float,2>{0.430403113f, 0.515182436f},
-std::array<float,2>{0.976786792f, 0.366447479f},
-std::array<float,2>{0.0263872985f, 0.166981384f},
-std::array<float,2>{0.73152858f, 0.750349283f},
-std::array<float,2>{0.0662935972f, 0.656745911f},
-std::array<float,2>{0.64278096f, 0.416041613f},
-std::array<float,2>{0.494386613f, 0.0674542785f},
-std::array<float,2>{0.879044414f, 0.886451066f},
-std::array<float,2>{0.271045923f, 0.846739471f},
-std::array<float,2>{0.766146898f, 0.207668528f},
-std::array<float,2>{0.160208389f, 0.298489332f},
-std::array<float,2>{0.585013628f, 0.596288621f},
-std::array<float,2>{0.106069855f, 0.906221688f},
-std::array<float,2>{0.665065706f, 0.0822551176f},
-std::array<float,2>{0.440380871f, 0.427795887f},
-std::array<float,2>{0.936481476f, 0.676552415f},
-std::array<float,2>{0.298321396f, 0.623110354f},
-std::array<float,2>{0.812006235f, 0.293635339f},
-std::array<float,2>{0.136384547f, 0.197884664f},
-std::array<float,2>{0.613607228f, 0.872377574f},
-std::array<float,2>{0.243729368f, 0.721816003f},
-std::array<float,2>{0.543219805f, 0.46179685f},
-std::array<float,2>{0.368894517f, 0.0368964635f},
-std::array<float,2>{0.827251375f, 0.959555387f},
-std::array<float,2>{0.406010032f, 0.780962706f},
-std::array<float,2>{0.951653838f, 0.180211172f},
-std::array<float,2>{0.0346548669f, 0.346778601f},
-std::array<float,2>{0.698298872f, 0.519129515f},
-std::array<float,2>{0.172525227f, 0.840324044f},
-std::array<float,2>{0.566598535f, 0.226727635f},
-std::array<float,2>{0.261865348f, 0.278460652f},
-std::array<float,2>{0.752179921f, 0.572912574f},
-std::array<float,2>{0.480252206f, 0.640435517f},
-std::array<float,2>{0.896472871f, 0.383674115f},
-std::array<float,2>{0.0899252668f, 0.0970956832f},
-std::array<float,2>{0.632173061f, 0.908550739f},
-std::array<float,2>{0.00712386705f, 0.561033785f},
-std::array<float,2>{0.74919498f, 0.341750145f},
-std::array<float,2>{0.420550942f, 0.14083226f},
-std::array<float,2>{0.992070496f, 0.790275097f},
-std::array<float,2>{0.31496641f, 0.973077953f},
-std::array<float,2>{0.85634166f, 0.0289733224f},
-std::array<float,2>{0.203001112f, 0.499446571f},
-std::array<float,2>{0.514411211f, 0.715135276f},
-std::array<float,2>{0.0829738155f, 0.864290774f},
-std::array<float,2>{0.637693882f, 0.191657245f},
-std::array<float,2>{0.469953954f, 0.284237623f},
-std::array<float,2>{0.904078424f, 0.612749219f},
-std::array<float,2>{0.25052008f, 0.687214255f},
-std::array<float,2>{0.758900464f, 0.43737945f},
-std::array<float,2>{0.179823369f, 0.0902191326f},
-std::array<float,2>{0.57599324f, 0.896554589f},
-std::array<float,2>{0.193527281f, 0.52365011f},
-std::array<float,2>{0.50152415f, 0.356054276f},
-std::array<float,2>{0.322951376f, 0.17752631f},
-std::array<float,2>{0.847656846f, 0.766370356f},
-std::array<float,2>{0.406560957f, 0.967239618f},
-std::array<float,2>{0.995395541f, 0.0455201603f},
-std::array<float,2>{0.0097821895f, 0.45652169f},
-std::array<float,2>{0.735841393f, 0.731312037f},
-std::array<float,2>{0.127209514f, 0.917868674f},
-std::array<float,2>{0.617390335f, 0.102584884f},
-std::array<float,2>{0.305645883f, 0.381754458f},
-std::array<float,2>{0.798123121f, 0.630290985f},
-std::array<float,2>{0.450322092f, 0.567613602f},
-std::array<float,2>{0.928175271f, 0.267916918f},
-std::array<float,2>{0.0945002139f, 0.221941009f},
-std::array<float,2>{0.659331501f, 0.83482337f},
-std::array<float,2>{0.0417488441f, 0.707476556f},
-std::array<float,2>{0.689728141f, 0.491555572f},
-std::array<float,2>{0.393301576f, 0.0223075803f},
-std::array<float,2>{0.942703724f, 0.982045293f},
-std::array<float,2>{0.363903165f, 0.787909806f},
-std::array<float,2>{0.813257337f, 0.150981754f},
-std::array<float,2>{0.236334473f, 0.33095631f},
-std::array<float,2>{0.53295213f, 0.551116168f},
-std::array<float,2>{0.0178686455f, 0.992658079f},
-std::array<float,2>{0.724093318f, 0.0114081129f},
-std::array<float,2>{0.425647169f, 0.473500967f},
-std::array<float,2>{0.97342062f, 0.702136636f},
-std::array<float,2>{0.338407993f, 0.531854868f},
-std::array<float,2>{0.873310924f, 0.320602417f},
-std::array<float,2>{0.215411887f, 0.134894297f},
-std::array<float,2>{0.516237557f, 0.810389102f},
-std::array<float,2>{0.166981265f, 0.642949879f},
-std::array<float,2>{0.588974714f, 0.391234308f},
-std::array<float,2>{0.280802459f, 0.115136869f},
-std::array<float,2>{0.774638534f, 0.929821789f},
-std::array<float,2>{0.485593617f, 0.817551613f},
-std::array<float,2>{0.885693133f, 0.249330252f},
-std::array<float,2>{0.0763023198f, 0.253110349f},
-std::array<float,2>{0.655156434f, 0.582059026f},
-std::array<float,2>{0.231169567f, 0.759971142f},
-std::array<float,2>{0.559490323f, 0.163887739f},
-std::array<float,2>{0.34691298f, 0.369370848f},
-std::array<float,2>{0.839264572f, 0.504609525f},
-std::array<float,2>{0.388802171f, 0.734943628f},
-std::array<float,2>{0.966898084f, 0.446970552f},
-std::array<float,2>{0.0534266308f, 0.0590848029f},
-std::array<float,2>{0.70920223f, 0.945019603f},
-std::array<float,2>{0.110808149f, 0.608089983f},
-std::array<float,2>{0.685324311f, 0.310157478f},
-std::array<float,2>{0.458128065f, 0.215328157f},
-std::array<float,2>{0.921422064f, 0.854801178f},
-std::array<float,2>{0.29355967f, 0.87723881f},
-std::array<float,2>{0.79301542f, 0.0733447596f},
-std::array<float,2>{0.147380352f, 0.412126929f},
-std::array<float,2>{0.607849538f, 0.664890528f},
-std::array<float,2>{0.118328363f, 0.770076931f},
-std::array<float,2>{0.678962827f, 0.172528267f},
-std::array<float,2>{0.464108884f, 0.35193038f},
-std::array<float,2>{0.910994291f, 0.531192005f},
-std::array<float,2>{0.286437988f, 0.728477359f},
-std::array<float,2>{0.784326971f, 0.459446967f},
-std::array<float,2>{0.1500929f, 0.0415340103f},
-std::array<float,2>{0.596912146f, 0.963843822f},
-std::array<float,2>{0.222635061f, 0.617042303f},
-std::array<float,2>{0.547028482f, 0.28566429f},
-std::array<float,2>{0.355748117f, 0.188904032f},
-std::array<float,2>{0.832453072f, 0.863186359f},
-std::array<float,2>{0.375923932f, 0.894079626f},
-std::array<float,2>{0.955455303f, 0.0874530822f},
-std::array<float,2>{0.0546931438f, 0.431592375f},
-std::array<float,2>{0.717465758f, 0.682907045f},
-std::array<float,2>{0.159896657f, 0.976573884f},
-std::array<float,2>{0.578856707f, 0.0169658735f},
-std::array<float,2>{0.268702656f, 0.486814797f},
-std::array<float,2>{0.773061097f, 0.705993295f},
-std::array<float,2>{0.499905676f, 0.550274014f},
-std::array<float,2>{0.875828564f, 0.335857332f},
-std::array<float,2>{0.0676491559f, 0.154576421f},
-std::array<float,2>{0.646077096f, 0.782892644f},
-std::array<float,2>{0.0299479011f, 0.628538013f},
-std::array<float,2>{0.729544997f, 0.376337916f},
-std::array<float,2>{0.435430378f, 0.105713457f},
-std::array<float,2>{0.98330301f, 0.920595229f},
-std::array<float,2>{0.332037538f, 0.828755677f},
-std::array<float,2>{0.860616386f, 0.223777518f},
-std::array<float,2>{0.203966931f, 0.271472216f},
-std::array<float,2>{0.525423229f, 0.564257979f},
-std::array<float,2>{0.038145829f, 0.936033368f},
-std::array<float,2>{0.700389981f, 0.109682657f},
-std::array<float,2>{0.401025027f, 0.394621491f},
-std::array<float,2>{0.946270704f, 0.644914865f},
-std::array<float,2>{0.374760687f, 0.578749418f},
-std::array<float,2>{0.82302469f, 0.257723868f},
-std::array<float,2>{0.247148156f, 0.245796114f},
-std::array<float,2>{0.540349841f, 0.81460923f},
-std::array<float,2>{0.138331726f, 0.698690712f},
-std::array<float,2>{0.609753191f, 0.472478658f},
-std::array<float,2>{0.30367443f, 0.0124671124f},
-std::array<float,2>{0.806636989f, 0.99849999f},
-std::array<float,2>{0.443182051f, 0.80839169f},
-std::array<float,2>{0.930134952f, 0.137325719f},
-std::array<float,2>{0.103862397f, 0.327759087f},
-std::array<float,2>{0.668729067f, 0.535253525f},
-std::array<float,2>{0.19809036f, 0.857098758f},
-std::array<float,2>{0.508939564f, 0.213433102f},
-std::array<float,2>{0.320270956f, 0.306565911f},
-std::array<float,2>{0.854884863f, 0.603960395f},
-std::array<float,2>{0.417375028f, 0.67061615f},
-std::array<float,2>{0.988131464f, 0.407027066f},
-std::array<float,2>{0.00194237405f, 0.0768485442f},
-std::array<float,2>{0.742974162f, 0.882221818f},
-std::array<float,2>{0.0888697356f, 0.502853036f},
-std::array<float,2>{0.628623247f, 0.374679118f},
-std::array<float,2>{0.483157247f, 0.157847837f},
-std::array<float,2>{0.891563296f, 0.764259875f},
-std::array<float,2>{0.258739889f, 0.940695286f},
-std::array<float,2>{0.753985941f, 0.0573201403f},
-std::array<float,2>{0.176209897f, 0.450330764f},
-std::array<float,2>{0.563786209f, 0.740450799f},
-std::array<float,2>{0.0146010667f, 0.822540879f},
-std::array<float,2>{0.741913974f, 0.240396887f},
-std::array<float,2>{0.41239807f, 0.259117991f},
-std::array<float,2>{0.997515976f, 0.587480307f},
-std::array<float,2>{0.324538112f, 0.653825223f},
-std::array<float,2>{0.844449639f, 0.40327087f},
-std::array<float,2>{0.190788612f, 0.124345116f},
-std::array<float,2>{0.507115245f, 0.926806152f},
-std::array<float,2>{0.186482459f, 0.541831613f},
-std::array<float,2>{0.574056745f, 0.313966215f},
-std::array<float,2>{0.255794376f, 0.125735983f},
-std::array<float,2>{0.762869358f, 0.804401934f},
-std::array<float,2>{0.474431008f, 0.98614645f},
-std::array<float,2>{0.898629427f, 0.00176084717f},
-std::array<float,2>{0.0804760456f, 0.480632097f},
-std::array<float,2>{0.63447243f, 0.694256961f},
-std::array<float,2>{0.240749076f, 0.889482915f},
-std::array<float,2>{0.537342668f, 0.0634064078f},
-std::array<float,2>{0.360472441f, 0.418944418f},
-std::array<float,2>{0.819374979f, 0.66083622f},
-std::array<float,2>{0.394531608f, 0.601161599f},
-std::array<float,2>{0.939713299f, 0.302169472f},
-std::array<float,2>{0.0453357436f, 0.205912814f},
-std::array<float,2>{0.693684816f, 0.849980295f},
-std::array<float,2>{0.101243645f, 0.749592781f},
-std::array<float,2>{0.660363436f, 0.440710932f},
-std::array<float,2>{0.446875036f, 0.0494233891f},
-std::array<float,2>{0.925776482f, 0.94832015f},
-std::array<float,2>{0.308755219f, 0.754694045f},
-std::array<float,2>{0.801398098f, 0.170608595f},
-std::array<float,2>{0.129733399f, 0.362595618f},
-std::array<float,2>{0.622846127f, 0.507922173f},
-std::array<float,2>{0.0704959482f, 0.954325199f},
-std::array<float,2>{0.648536623f, 0.0315861143f},
-std::array<float,2>{0.489351988f, 0.466706991f},
-std::array<float,2>{0.888255358f, 0.72359699f},
-std::array<float,2>{0.275278181f, 0.522519052f},
-std::array<float,2>{0.779826224f, 0.349037409f},
-std::array<float,2>{0.170777678f, 0.183625892f},
-std::array<float,2>{0.591638923f, 0.77713412f},
-std::array<float,2>{0.2130595f, 0.675520539f},
-std::array<float,2>{0.520719051f, 0.422988087f},
-std::array<float,2>{0.341850728f, 0.0791833699f},
-std::array<float,2>{0.868644893f, 0.899551094f},
-std::array<float,2>{0.428462595f, 0.869740844f},
-std::array<float,2>{0.969461203f, 0.202946991f},
-std::array<float,2>{0.0198770799f, 0.292613685f},
-std::array<float,2>{0.720436633f, 0.618651152f},
-std::array<float,2>{0.14154397f, 0.796462953f},
-std::array<float,2>{0.604935706f, 0.147418827f},
-std::array<float,2>{0.289446473f, 0.337139398f},
-std::array<float,2>{0.790472865f, 0.557801604f},
-std::array<float,2>{0.456463844f, 0.714407802f},
-std::array<float,2>{0.917659402f, 0.494483769f},
-std::array<float,2>{0.113957636f, 0.026097456f},
-std::array<float,2>{0.683275461f, 0.971208334f},
-std::array<float,2>{0.0473445393f, 0.574728727f},
-std::array<float,2>{0.703570247f, 0.276157707f},
-std::array<float,2>{0.386336654f, 0.23071532f},
-std::array<float,2>{0.962046146f, 0.838949323f},
-std::array<float,2>{0.347669452f, 0.910794199f},
-std::array<float,2>{0.842033029f, 0.0979717821f},
-std::array<float,2>{0.228837669f, 0.387041867f},
-std::array<float,2>{0.555168927f, 0.636416912f},
-std::array<float,2>{0.00419429457f, 0.789789498f},
-std::array<float,2>{0.746581972f, 0.141639099f},
-std::array<float,2>{0.419846892f, 0.340775013f},
-std::array<float,2>{0.989060581f, 0.562391937f},
-std::array<float,2>{0.313941509f, 0.71594888f},
-std::array<float,2>{0.859159887f, 0.498456031f},
-std::array<float,2>{0.200306207f, 0.0281741507f},
-std::array<float,2>{0.513657749f, 0.973854959f},
-std::array<float,2>{0.17574434f, 0.574183047f},
-std::array<float,2>{0.570026219f, 0.277832061f},
-std::array<float,2>{0.26513803f, 0.228486836f},
-std::array<float,2>{0.751760006f, 0.841305077f},
-std::array<float,2>{0.478130758f, 0.909931183f},
-std::array<float,2>{0.897860885f, 0.0957431048f},
-std::array<float,2>{0.0923975855f, 0.384631217f},
-std::array<float,2>{0.629461467f, 0.639513552f},
-std::array<float,2>{0.24460271f, 0.960698903f},
-std::array<float,2>{0.545737624f, 0.0357296504f},
-std::array<float,2>{0.369231939f, 0.462452292f},
-std::array<float,2>{0.824464858f, 0.721060634f},
-std::array<float,2>{0.402473897f, 0.518351257f},
-std::array<float,2>{0.949274659f, 0.346522301f},
-std::array<float,2>{0.0316941515f, 0.181212142f},
-std::array<float,2>{0.695383787f, 0.780013323f},
-std::array<float,2>{0.108946659f, 0.676774144f},
-std::array<float,2>{0.667452872f, 0.428950936f},
-std::array<float,2>{0.439286292f, 0.0832293257f},
-std::array<float,2>{0.934529066f, 0.904890954f},
-std::array<float,2>{0.300129235f, 0.871372342f},
-std::array<float,2>{0.809063852f, 0.198512092f},
-std::array<float,2>{0.134577334f, 0.294280976f},
-std::array<float,2>{0.616215289f, 0.624743521f},
-std::array<float,2>{0.0636372194f, 0.884816289f},
-std::array<float,2>{0.641917288f, 0.0665288791f},
-std::array<float,2>{0.493440568f, 0.41792205f},
-std::array<float,2>{0.881863296f, 0.658028185f},
-std::array<float,2>{0.272845596f, 0.597465932f},
-std::array<float,2>{0.769154727f, 0.297133356f},
-std::array<float,2>{0.162992537f, 0.208684057f},
-std::array<float,2>{0.582071364f, 0.846058488f},
-std::array<float,2>{0.208217919f, 0.743942559f},
-std::array<float,2>{0.52991575f, 0.441563189f},
-std::array<float,2>{0.328343958f, 0.0525144227f},
-std::array<float,2>{0.865457356f, 0.952598929f},
-std::array<float,2>{0.431664675f, 0.751012087f},
-std::array<float,2>{0.979759514f, 0.167205766f},
-std::array<float,2>{0.0248624086f, 0.366011649f},
-std::array<float,2>{0.732963383f, 0.514142036f},
-std::array<float,2>{0.156051174f, 0.82762152f},
-std::array<float,2>{0.60065639f, 0.235774472f},
-std::array<float,2>{0.284429729f, 0.262440771f},
-std::array<float,2>{0.785342395f, 0.593209624f},
-std::array<float,2>{0.467460245f, 0.650211155f},
-std::array<float,2>{0.908692598f, 0.402313113f},
-std::array<float,2>{0.122388586f, 0.119207904f},
-std::array<float,2>{0.6732198f, 0.925087571f},
-std::array<float,2>{0.0610535778f, 0.544709504f},
-std::array<float,2>{0.713865519f, 0.320173234f},
-std::array<float,2>{0.380853087f, 0.129618108f},
-std::array<float,2>{0.957215309f, 0.797619879f},
-std::array<float,2>{0.35407567f, 0.991594315f},
-std::array<float,2>{0.830526292f, 0.00634171255f},
-std::array<float,2>{0.223287374f, 0.477088422f},
-std::array<float,2>{0.553552985f, 0.688285172f},
-std::array<float,2>{0.111455441f, 0.85381192f},
-std::array<float,2>{0.685816228f, 0.215841591f},
-std::array<float,2>{0.460818559f, 0.309048504f},
-std::array<float,2>{0.918490171f, 0.609050155f},
-std::array<float,2>{0.296601981f, 0.665809631f},
-std::array<float,2>{0.795185924f, 0.413121074f},
-std::array<float,2>{0.14540787f, 0.0724159554f},
-std::array<float,2>{0.607321143f, 0.87793082f},
-std::array<float,2>{0.232497931f, 0.50496614f},
-std::array<float,2>{0.560881853f, 0.370703042f},
-std::array<float,2>{0.345154643f, 0.162419945f},
-std::array<float,2>{0.836235404f, 0.76102674f},
-std::array<float,2>{0.388156563f, 0.943398476f},
-std::array<float,2>{0.965979815f, 0.0603917092f},
-std::array<float,2>{0.0515328944f, 0.446256757f},
-std::array<float,2>{0.708371222f, 0.736324489f},
-std::array<float,2>{0.164782956f, 0.931116819f},
-std::array<float,2>{0.587402761f, 0.113329642f},
-std::array<float,2>{0.277799338f, 0.392199069f},
-std::array<float,2>{0.775473535f, 0.643869698f},
-std::array<float,2>{0.486931771f, 0.583879232f},
-std::array<float,2>{0.883346498f, 0.25223121f},
-std::array<float,2>{0.0753895715f, 0.24808608f},
-std::array<float,2>{0.653681219f, 0.81693089f},
-std::array<float,2>{0.0167340916f, 0.702165067f},
-std::array<float,2>{0.725609601f, 0.474581301f},
-std::array<float,2>{0.423387825f, 0.0099727232f},
-std::array<float,2>{0.97480154f, 0.993899703f},
-std::array<float,2>{0.33765471f, 0.808822095f},
-std::array<float,2>{0.87228173f, 0.136118799f},
-std::array<float,2>{0.217807651f, 0.321979433f},
-std::array<float,2>{0.517972469f, 0.532814324f},
-std::array<float,2>{0.0401017703f, 0.980730891f},
-std::array<float,2>{0.688283682f, 0.023303112f},
-std::array<float,2>{0.392307252f, 0.490971446f},
-std::array<float,2>{0.944974482f, 0.708616436f},
-std::array<float,2>{0.365765184f, 0.552066028f},
-std::array<float,2>{0.814868212f, 0.331233472f},
-std::array<float,2>{0.234450251f, 0.151720047f},
-std::array<float,2>{0.534436584f, 0.78813833f},
-std::array<float,2>{0.125803158f, 0.629584908f},
-std::array<float,2>{0.620210767f, 0.382478327f},
-std::array<float,2>{0.307618499f, 0.102083787f},
-std::array<float,2>{0.800370634f, 0.916057229f},
-std::array<float,2>{0.451605111f, 0.835250139f},
-std::array<float,2>{0.926510513f, 0.221477509f},
-std::array<float,2>{0.0970586389f, 0.269180924f},
-std::array<float,2>{0.657608449f, 0.567313612f},
-std::array<float,2>{0.193171784f, 0.767049491f},
-std::array<float,2>{0.503693819f, 0.175906405f},
-std::array<float,2>{0.320623457f, 0.356857955f},
-std::array<float,2>{0.851419985f, 0.525043905f},
-std::array<float,2>{0.409192234f, 0.732343018f},
-std::array<float,2>{0.992278457f, 0.455757231f},
-std::array<float,2>{0.00858932082f, 0.0459610596f},
-std::array<float,2>{0.737614512f, 0.967932105f},
-std::array<float,2>{0.0845654756f, 0.611518145f},
-std::array<float,2>{0.639028788f, 0.283558518f},
-std::array<float,2>{0.47154963f, 0.192425638f},
-std::array<float,2>{0.904505134f, 0.863393426f},
-std::array<float,2>{0.252385557f, 0.897490025f},
-std::array<float,2>{0.760137141f, 0.0917446613f},
-std::array<float,2>{0.183492661f, 0.435707539f},
-std::array<float,2>{0.577490211f, 0.686032951f},
-std::array<float,2>{0.0873341411f, 0.765568733f},
-std::array<float,2>{0.626002669f, 0.156665832f},
-std::array<float,2>{0.481679857f, 0.373972803f},
-std::array<float,2>{0.892893732f, 0.503013134f},
-std::array<float,2>{0.261229753f, 0.742124259f},
-std::array<float,2>{0.755935371f, 0.449893087f},
-std::array<float,2>{0.178500935f, 0.058543697f},
-std::array<float,2>{0.565230787f, 0.940302432f},
-std::array<float,2>{0.197263151f, 0.604544461f},
-std::array<float,2>{0.509889066f, 0.305317044f},
-std::array<float,2>{0.318133593f, 0.213972896f},
-std::array<float,2>{0.8532933f, 0.856259286f},
-std::array<float,2>{0.415132403f, 0.881049037f},
-std::array<float,2>{0.986284852f, 0.0776305199f},
-std::array<float,2>{0.00228931545f, 0.407575369f},
-std::array<float,2>{0.745196223f, 0.671009898f},
-std::array<float,2>{0.140101314f, 0.999982059f},
-std::array<float,2>{0.612483323f, 0.0134090427f},
-std::array<float,2>{0.301587552f, 0.470889658f},
-std::array<float,2>{0.807212114f, 0.697373509f},
-std::array<float,2>{0.444413334f, 0.537036359f},
-std::array<float,2>{0.932637393f, 0.326261163f},
-std::array<float,2>{0.102044657f, 0.138262436f},
-std::array<float,2>{0.670178533f, 0.806748509f},
-std::array<float,2>{0.0360788517f, 0.645569921f},
-std::array<float,2>{0.702435553f, 0.396473676f},
-std::array<float,2>{0.399362862f, 0.110502772f},
-std::array<float,2>{0.949216902f, 0.937318921f},
-std::array<float,2>{0.371871918f, 0.815839171f},
-std::array<float,2>{0.820364654f, 0.244575396f},
-std::array<float,2>{0.249807313f, 0.256179094f},
-std::array<float,2>{0.541323781f, 0.579853177f},
-std::array<float,2>{0.0273548756f, 0.921756208f},
-std::array<float,2>{0.72830534f, 0.106681004f},
-std::array<float,2>{0.436780006f, 0.37505731f},
-std::array<float,2>{0.980629385f, 0.627132714f},
-std::array<float,2>{0.335002512f, 0.563397348f},
-std::array<float,2>{0.86318332f, 0.270451546f},
-std::array<float,2>{0.205084756f, 0.222925931f},
-std::array<float,2>{0.525339007f, 0.829631269f},
-std::array<float,2>{0.158151731f, 0.706335187f},
-std::array<float,2>{0.580218256f, 0.488242269f},
-std::array<float,2>{0.266698718f, 0.0157462265f},
-std::array<float,2>{0.77076596f, 0.977593303f},
-std::array<float,2>{0.497110963f, 0.781943083f},
-std::array<float,2>{0.878122032f, 0.156150892f},
-std::array<float,2>{0.0691281706f, 0.334399641f},
-std::array<float,2>{0.64651829f, 0.549556971f},
-std::array<float,2>{0.220021307f, 0.862071395f},
-std::array<float,2>{0.549401283f, 0.188313931f},
-std::array<float,2>{0.357795954f, 0.286883622f},
-std::array<float,2>{0.835319519f, 0.616179347f},
-std::array<float,2>{0.377250195f, 0.68222791f},
-std::array<float,2>{0.953666687f, 0.430375695f},
-std::array<float,2>{0.0567953363f, 0.0865217745f},
-std::array<float,2>{0.714917958f, 0.893457472f},
-std::array<float,2>{0.120422959f, 0.529557824f},
-std::array<float,2>{0.67645067f, 0.352662802f},
-std::array<float,2>{0.462081313f, 0.173206821f},
-std::array<float,2>{0.912944078f, 0.770924687f},
-std::array<float,2>{0.287827015f, 0.963999033f},
-std::array<float,2>{0.781520188f, 0.0426772386f},
-std::array<float,2>{0.152147949f, 0.46002996f},
-std::array<float,2>{0.594081402f, 0.727433801f},
-std::array<float,2>{0.0490927063f, 0.838052034f},
-std::array<float,2>{0.70512712f, 0.231630117f},
-std::array<float,2>{0.384078175f, 0.276925981f},
-std::array<float,2>{0.964828372f, 0.57544291f},
-std::array<float,2>{0.350219309f, 0.635722697f},
-std::array<float,2>{0.840431452f, 0.38794747f},
-std::array<float,2>{0.227976292f, 0.0993876457f},
-std::array<float,2>{0.55668968f, 0.911768317f},
-std::array<float,2>{0.142751962f, 0.556663334f},
-std::array<float,2>{0.603496253f, 0.336778611f},
-std::array<float,2>{0.291617185f, 0.148289874f},
-std::array<float,2>{0.792820573f, 0.795326769f},
-std::array<float,2>{0.453544468f, 0.971876264f},
-std::array<float,2>{0.914818287f, 0.0268022288f},
-std::array<float,2>{0.115275294f, 0.496017784f},
-std::array<float,2>{0.681524098f, 0.713605702f},
-std::array<float,2>{0.212263778f, 0.898664773f},
-std::array<float,2>{0.521922529f, 0.07844612f},
-std::array<float,2>{0.340630561f, 0.422552466f},
-std::array<float,2>{0.870777369f, 0.674270093f},
-std::array<float,2>{0.426035106f, 0.617258489f},
-std::array<float,2>{0.971323252f, 0.291332901f},
-std::array<float,2>{0.0230908357f, 0.201577187f},
-std::array<float,2>{0.721660197f, 0.870815992f},
-std::array<float,2>{0.0725689232f, 0.724562109f},
-std::array<float,2>{0.652179897f, 0.46494174f},
-std::array<float,2>{0.490899831f, 0.0322992243f},
-std::array<float,2>{0.890002489f, 0.954063952f},
-std::array<float,2>{0.277214736f, 0.775559068f},
-std::array<float,2>{0.779137611f, 0.185020968f},
-std::array<float,2>{0.168700427f, 0.348011822f},
-std::array<float,2>{0.593094647f, 0.521514297f},
-std::array<float,2>{0.0996046811f, 0.947311938f},
-std::array<float,2>{0.662969589f, 0.0506054498f},
-std::array<float,2>{0.448638439f, 0.440272629f},
-std::array<float,2>{0.922563553f, 0.748195231f},
-std::array<float,2>{0.312080234f, 0.509271741f},
-std::array<float,2>{0.804432154f, 0.3621943f},
-std::array<float,2>{0.131228805f, 0.171293423f},
-std::array<float,2>{0.62433064f, 0.755623996f},
-std::array<float,2>{0.238587931f, 0.661751807f},
-std::array<float,2>{0.536070943f, 0.419891834f},
-std::array<float,2>{0.361669093f, 0.0635138899f},
-std::array<float,2>{0.81709522f, 0.890123546f},
-std::array<float,2>{0.398066908f, 0.851388514f},
-std::array<float,2>{0.9390769f, 0.2064026f},
-std::array<float,2>{0.043320775f, 0.301117688f},
-std::array<float,2>{0.692961812f, 0.599749148f},
-std::array<float,2>{0.185172781f, 0.802911282f},
-std::array<float,2>{0.571865022f, 0.126677856f},
-std::array<float,2>{0.257678032f, 0.313012242f},
-std::array<float,2>{0.764314115f, 0.542808294f},
-std::array<float,2>{0.474996537f, 0.694885552f},
-std::array<float,2>{0.901913106f, 0.481480181f},
-std::array<float,2>{0.0787011683f, 0.000200385053f},
-std::array<float,2>{0.636329293f, 0.984484196f},
-std::array<float,2>{0.0122808414f, 0.586000979f},
-std::array<float,2>{0.739620328f, 0.258442134f},
-std::array<float,2>{0.410637915f, 0.241452798f},
-std::array<float,2>{0.998404741f, 0.823645234f},
-std::array<float,2>{0.326243252f, 0.926216781f},
-std::array<float,2>{0.847651005f, 0.123535536f},
-std::array<float,2>{0.188028693f, 0.40365544f},
-std::array<float,2>{0.504730523f, 0.653241873f},
-std::array<float,2>{0.0336475819f, 0.777489126f},
-std::array<float,2>{0.698004246f, 0.182409152f},
-std::array<float,2>{0.404718757f, 0.344976783f},
-std::array<float,2>{0.953120053f, 0.516017258f},
-std::array<float,2>{0.367230684f, 0.719323754f},
-std::array<float,2>{0.826480389f, 0.464770973f},
-std::array<float,2>{0.242300332f, 0.038398955f},
-std::array<float,2>{0.544221222f, 0.958699286f},
-std::array<float,2>{0.135317296f, 0.622612774f},
-std::array<float,2>{0.61445421f, 0.296030372f},
-std::array<float,2>{0.296964258f, 0.197244525f},
-std::array<float,2>{0.811406434f, 0.874262273f},
-std::array<float,2>{0.441109657f, 0.903837681f},
-std::array<float,2>{0.937487066f, 0.0852889046f},
-std::array<float,2>{0.107411005f, 0.425922841f},
-std::array<float,2>{0.664774001f, 0.679599524f},
-std::array<float,2>{0.201673016f, 0.974696517f},
-std::array<float,2>{0.515070558f, 0.0303417258f},
-std::array<float,2>{0.316079289f, 0.497666657f},
-std::array<float,2>{0.857350767f, 0.717422247f},
-std::array<float,2>{0.421777606f, 0.558685958f},
-std::array<float,2>{0.990776122f, 0.342530936f},
-std::array<float,2>{0.00597872026f, 0.142817169f},
-std::array<float,2>{0.748609364f, 0.792961776f},
-std::array<float,2>{0.0912067816f, 0.637807131f},
-std::array<float,2>{0.631069183f, 0.385644317f},
-std::array<float,2>{0.479289502f, 0.0952236503f},
-std::array<float,2>{0.895397246f, 0.907576144f},
-std::array<float,2>{0.263189316f, 0.842633665f},
-std::array<float,2>{0.75356555f, 0.229923636f},
-std::array<float,2>{0.173327848f, 0.279917628f},
-std::array<float,2>{0.567624629f, 0.572207749f},
-std::array<float,2>{0.123352058f, 0.922157407f},
-std::array<float,2>{0.674647272f, 0.117306933f},
-std::array<float,2>{0.465349883f, 0.399082124f},
-std::array<float,2>{0.906656921f, 0.651112258f},
-std::array<float,2>{0.282167226f, 0.590463161f},
-std::array<float,2>{0.789015889f, 0.264142126f},
-std::array<float,2>{0.154009834f, 0.236967295f},
-std::array<float,2>{0.598489285f, 0.825859487f},
-std::array<float,2>{0.226168498f, 0.690485179f},
-std::array<float,2>{0.551673055f, 0.47945115f},
-std::array<float,2>{0.352631301f, 0.00547636021f},
-std::array<float,2>{0.82890296f, 0.988734365f},
-std::array<float,2>{0.381101876f, 0.799418986f},
-std::array<float,2>{0.960000455f, 0.131496757f},
-std::array<float,2>{0.0603120029f, 0.317001194f},
-std::array<float,2>{0.712207377f, 0.545509279f},
-std::array<float,2>{0.161982819f, 0.844411612f},
-std::array<float,2>{0.584742248f, 0.210594401f},
-std::array<float,2>{0.269786865f, 0.299853534f},
-std::array<float,2>{0.767200112f, 0.594799459f},
-std::array<float,2>{0.49521786f, 0.659870505f},
-std::array<float,2>{0.88069886f, 0.415112674f},
-std::array<float,2>{0.0647346154f, 0.0702956691f},
-std::array<float,2>{0.643755496f, 0.883175313f},
-std::array<float,2>{0.0254420601f, 0.513540089f},
-std::array<float,2>{0.730666995f, 0.363889217f},
-std::array<float,2>{0.430845648f, 0.165473506f},
-std::array<float,2>{0.977905273f, 0.753730714f},
-std::array<float,2>{0.331671923f, 0.94929266f},
-std::array<float,2>{0.864014566f, 0.0544187315f},
-std::array<float,2>{0.210703358f, 0.444687515f},
-std::array<float,2>{0.528516948f, 0.744421244f},
-std::array<float,2>{0.0775636211f, 0.818646431f},
-std::array<float,2>{0.656156898f, 0.247245923f},
-std::array<float,2>{0.484889686f, 0.25082013f},
-std::array<float,2>{0.886255205f, 0.585259855f},
-std::array<float,2>{0.280038029f, 0.642004788f},
-std::array<float,2>{0.773994505f, 0.393712819f},
-std::array<float,2>{0.167318851f, 0.116285853f},
-std::array<float,2>{0.587921977f, 0.932278931f},
-std::array<float,2>{0.215876415f, 0.534491599f},
-std::array<float,2>{0.516908705f, 0.323020309f},
-std::array<float,2>{0.339011461f, 0.134264961f},
-std::array<float,2>{0.874918759f, 0.81060338f},
-std::array<float,2>{0.424304038f, 0.994374871f},
-std::array<float,2>{0.974066019f, 0.00935509801f},
-std::array<float,2>{0.0187817495f, 0.475148052f},
-std::array<float,2>{0.723448992f, 0.700289845f},
-std::array<float,2>{0.147729859f, 0.876417518f},
-std::array<float,2>{0.608669579f, 0.0714830682f},
-std::array<float,2>{0.294531703f, 0.411978751f},
-std::array<float,2>{0.794777691f, 0.667289317f},
-std::array<float,2>{0.457124949f, 0.605585217f},
-std::array<float,2>{0.920626462f, 0.310934156f},
-std::array<float,2>{0.109445833f, 0.217419073f},
-std::array<float,2>{0.684549928f, 0.852166712f},
-std::array<float,2>{0.053803429f, 0.736771107f},
-std::array<float,2>{0.710134208f, 0.447611809f},
-std::array<float,2>{0.390403777f, 0.0615735017f},
-std::array<float,2>{0.968527138f, 0.941794276f},
-std::array<float,2>{0.346010327f, 0.758166611f},
-std::array<float,2>{0.838094532f, 0.16111961f},
-std::array<float,2>{0.232383862f, 0.368248433f},
-std::array<float,2>{0.559970915f, 0.50599432f},
-std::array<float,2>{0.0112005323f, 0.965978146f},
-std::array<float,2>{0.734809577f, 0.0435860902f},
-std::array<float,2>{0.407244653f, 0.454544634f},
-std::array<float,2>{0.994995356f, 0.733964741f},
-std::array<float,2>{0.324196935f, 0.526002944f},
-std::array<float,2>{0.849592507f, 0.358939081f},
-std::array<float,2>{0.195175722f, 0.178230017f},
-std::array<float,2>{0.500165343f, 0.767776251f},
-std::array<float,2>{0.181486487f, 0.685431898f},
-std::array<float,2>{0.575175405f, 0.434444129f},
-std::array<float,2>{0.251661062f, 0.0924297869f},
-std::array<float,2>{0.758654773f, 0.89505136f},
-std::array<float,2>{0.469501615f, 0.865901411f},
-std::array<float,2>{0.903182089f, 0.194516703f},
-std::array<float,2>{0.0839680135f, 0.281294882f},
-std::array<float,2>{0.637698472f, 0.610407829f},
-std::array<float,2>{0.237317637f, 0.786332905f},
-std::array<float,2>{0.531374753f, 0.150056377f},
-std::array<float,2>{0.364463896f, 0.329846501f},
-std::array<float,2>{0.813766778f, 0.553790867f},
-std::array<float,2>{0.394375741f, 0.709235191f},
-std::array<float,2>{0.941685498f, 0.489424586f},
-std::array<float,2>{0.0427481085f, 0.0210594758f},
-std::array<float,2>{0.691072941f, 0.982750893f},
-std::array<float,2>{0.0956676975f, 0.569543779f},
-std::array<float,2>{0.658238292f, 0.267004579f},
-std::array<float,2>{0.449322581f, 0.219749421f},
-std::array<float,2>{0.92880708f, 0.832216144f},
-std::array<float,2>{0.305989683f, 0.915876985f},
-std::array<float,2>{0.797780037f, 0.105206966f},
-std::array<float,2>{0.1285965f, 0.379396796f},
-std::array<float,2>{0.618993938f, 0.63215822f},
-std::array<float,2>{0.104793891f, 0.805999577f},
-std::array<float,2>{0.669565678f, 0.139296561f},
-std::array<float,2>{0.441817015f, 0.32579565f},
-std::array<float,2>{0.930797756f, 0.538872719f},
-std::array<float,2>{0.304531693f, 0.695990622f},
-std::array<float,2>{0.805117428f, 0.470455021f},
-std::array<float,2>{0.137616321f, 0.0155214965f},
-std::array<float,2>{0.61109513f, 0.996840894f},
-std::array<float,2>{0.246463403f, 0.582029521f},
-std::array<float,2>{0.539150715f, 0.25477615f},
-std::array<float,2>{0.373838514f, 0.242994756f},
-std::array<float,2>{0.824119031f, 0.814318955f},
-std::array<float,2>{0.40182057f, 0.934540808f},
-std::array<float,2>{0.946346521f, 0.111845478f},
-std::array<float,2>{0.0376314633f, 0.397822767f},
-std::array<float,2>{0.699571252f, 0.648064733f},
-std::array<float,2>{0.177333236f, 0.937749088f},
-std::array<float,2>{0.563351929f, 0.0565222204f},
-std::array<float,2>{0.259617031f, 0.451741785f},
-std::array<float,2>{0.75513947f, 0.739627123f},
-std::array<float,2>{0.483407557f, 0.500243783f},
-std::array<float,2>{0.892353356f, 0.371164054f},
-std::array<float,2>{0.088132225f, 0.158738822f},
-std::array<float,2>{0.627685964f, 0.76355195f},
-std::array<float,2>{0.000715095317f, 0.668926239f},
-std::array<float,2>{0.743427098f, 0.409328789f},
-std::array<float,2>{0.41629076f, 0.0750285834f},
-std::array<float,2>{0.986703813f, 0.879453957f},
-std::array<float,2>{0.319064558f, 0.857616901f},
-std::array<float,2>{0.853515923f, 0.211396515f},
-std::array<float,2>{0.19905296f, 0.307633728f},
-std::array<float,2>{0.508769095f, 0.603241026f},
-std::array<float,2>{0.0563297793f, 0.891186476f},
-std::array<float,2>{0.718412399f, 0.0898393318f},
-std::array<float,2>{0.376653224f, 0.433522612f},
-std::array<float,2>{0.956219137f, 0.680044353f},
-std::array<float,2>{0.357001305f, 0.6149652f},
-std::array<float,2>{0.833828092f, 0.288916588f},
-std::array<float,2>{0.220924407f, 0.190027624f},
-std::array<float,2>{0.548759758f, 0.860746861f},
-std::array<float,2>{0.148494601f, 0.729822099f},
-std::array<float,2>{0.595848322f, 0.457695931f},
-std::array<float,2>{0.285458595f, 0.0396268219f},
-std::array<float,2>{0.783557832f, 0.961319923f},
-std::array<float,2>{0.462898582f, 0.773032546f},
-std::array<float,2>{0.911369443f, 0.175074846f},
-std::array<float,2>{0.117786497f, 0.35523662f},
-std::array<float,2>{0.677890718f, 0.528080344f},
-std::array<float,2>{0.204205379f, 0.830654919f},
-std::array<float,2>{0.52664113f, 0.226449206f},
-std::array<float,2>{0.333619505f, 0.273435384f},
-std::array<float,2>{0.860060215f, 0.566107333f},
-std::array<float,2>{0.434163719f, 0.626522124f},
-std::array<float,2>{0.984326005f, 0.377343565f},
-std::array<float,2>{0.0304905642f, 0.107885554f},
-std::array<float,2>{0.729104221f, 0.918992162f},
-std::array<float,2>{0.0665480345f, 0.548527777f},
-std::array<float,2>{0.645383418f, 0.33316043f},
-std::array<float,2>{0.49862498f, 0.154076815f},
-std::array<float,2>{0.876930594f, 0.783493876f},
-std::array<float,2>{0.267794698f, 0.979753911f},
-std::array<float,2>{0.771971166f, 0.0176415294f},
-std::array<float,2>{0.159133956f, 0.484827608f},
-std::array<float,2>{0.57943517f, 0.704154134f},
-std::array<float,2>{0.0208686031f, 0.867958069f},
-std::array<float,2>{0.718810439f, 0.200901479f},
-std::array<float,2>{0.429184943f, 0.289671481f},
-std::array<float,2>{0.970110357f, 0.620307505f},
-std::array<float,2>{0.343478084f, 0.673148394f},
-std::array<float,2>{0.867690682f, 0.424524456f},
-std::array<float,2>{0.214519694f, 0.08019647f},
-std::array<float,2>{0.51993376f, 0.901289761f},
-std::array<float,2>{0.171650127f, 0.521150529f},
-std::array<float,2>{0.589906394f, 0.349956304f},
-std::array<float,2>{0.27418685f, 0.187201008f},
-std::array<float,2>{0.781178594f, 0.77422893f},
-std::array<float,2>{0.488316774f, 0.956864476f},
-std::array<float,2>{0.887072921f, 0.0345187671f},
-std::array<float,2>{0.0715578496f, 0.468359232f},
-std::array<float,2>{0.650049388f, 0.72601527f},
-std::array<float,2>{0.230214044f, 0.91241622f},
-std::array<float,2>{0.556396365f, 0.100448273f},
-std::array<float,2>{0.348798096f, 0.390170157f},
-std::array<float,2>{0.842786551f, 0.634719789f},
-std::array<float,2>{0.385404676f, 0.576250792f},
-std::array<float,2>{0.961574912f, 0.274637222f},
-std::array<float,2>{0.0487662517f, 0.234065443f},
-std::array<float,2>{0.704199612f, 0.836960495f},
-std::array<float,2>{0.1148488f, 0.712307096f},
-std::array<float,2>{0.682151556f, 0.493318945f},
-std::array<float,2>{0.455187917f, 0.0236259159f},
-std::array<float,2>{0.916031301f, 0.970559895f},
-std::array<float,2>{0.290647805f, 0.794565082f},
-std::array<float,2>{0.790020585f, 0.14537771f},
-std::array<float,2>{0.142080098f, 0.33913359f},
-std::array<float,2>{0.603849411f, 0.555218101f},
-std::array<float,2>{0.0815161243f, 0.987571061f},
-std::array<float,2>{0.633611977f, 0.00313071348f},
-std::array<float,2>{0.473099351f, 0.48424527f},
-std::array<float,2>{0.900371075f, 0.691729784f},
-std::array<float,2>{0.254192591f, 0.539073944f},
-std::array<float,2>{0.762014091f, 0.314792395f},
-std::array<float,2>{0.187255993f, 0.128198147f},
-std::array<float,2>{0.572869778f, 0.80157572f},
-std::array<float,2>{0.189990535f, 0.655868173f},
-std::array<float,2>{0.506720006f, 0.404680043f},
-std::array<float,2>{0.325790226f, 0.122830808f},
-std::array<float,2>{0.845476329f, 0.927996755f},
-std::array<float,2>{0.413843006f, 0.820406199f},
-std::array<float,2>{0.996648848f, 0.238511115f},
-std::array<float,2>{0.0152722318f, 0.26017347f},
-std::array<float,2>{0.740823805f, 0.58893913f},
-std::array<float,2>{0.130642742f, 0.756415725f},
-std::array<float,2>{0.621939301f, 0.169066146f},
-std::array<float,2>{0.310391188f, 0.361182839f},
-std::array<float,2>{0.802244544f, 0.510337651f},
-std::array<float,2>{0.445623457f, 0.746502161f},
-std::array<float,2>{0.924782813f, 0.438932419f},
-std::array<float,2>{0.100209996f, 0.048549328f},
-std::array<float,2>{0.661518335f, 0.946612895f},
-std::array<float,2>{0.0461923406f, 0.598120034f},
-std::array<float,2>{0.695242703f, 0.303695261f},
-std::array<float,2>{0.396124274f, 0.204581127f},
-std::array<float,2>{0.940916002f, 0.848779619f},
-std::array<float,2>{0.359991163f, 0.886838377f},
-std::array<float,2>{0.818805993f, 0.0662026629f},
-std::array<float,2>{0.241373092f, 0.421000957f},
-std::array<float,2>{0.538198829f, 0.662413299f},
-std::array<float,2>{0.00797320157f, 0.768392682f},
-std::array<float,2>{0.737827301f, 0.177877575f},
-std::array<float,2>{0.409856379f, 0.358871877f},
-std::array<float,2>{0.993042588f, 0.525755644f},
-std::array<float,2>{0.321089566f, 0.733881831f},
-std::array<float,2>{0.85086447f, 0.454969436f},
-std::array<float,2>{0.192849591f, 0.0432767458f},
-std::array<float,2>{0.503274202f, 0.966772437f},
-std::array<float,2>{0.183073983f, 0.610893071f},
-std::array<float,2>{0.578116357f, 0.281984717f},
-std::array<float,2>{0.252879441f, 0.195169613f},
-std::array<float,2>{0.760649323f, 0.865247965f},
-std::array<float,2>{0.47086513f, 0.894535363f},
-std::array<float,2>{0.905132651f, 0.0921237394f},
-std::array<float,2>{0.0840357468f, 0.433605909f},
-std::array<float,2>{0.639645696f, 0.684905112f},
-std::array<float,2>{0.235087231f, 0.982956827f},
-std::array<float,2>{0.535078406f, 0.0209601652f},
-std::array<float,2>{0.365677059f, 0.490109891f},
-std::array<float,2>{0.815296829f, 0.709766328f},
-std::array<float,2>{0.392073721f, 0.554653168f},
-std::array<float,2>{0.944387436f, 0.329134911f},
-std::array<float,2>{0.0408985391f, 0.149684116f},
-std::array<float,2>{0.687564611f, 0.786927044f},
-std::array<float,2>{0.0976009071f, 0.632564008f},
-std::array<float,2>{0.658029974f, 0.379039407f},
-std::array<float,2>{0.451964349f, 0.104900643f},
-std::array<float,2>{0.926180899f, 0.915486753f},
-std::array<float,2>{0.308394134f, 0.832581282f},
-std::array<float,2>{0.799888372f, 0.220499158f},
-std::array<float,2>{0.125017479f, 0.267360538f},
-std::array<float,2>{0.620795667f, 0.569892585f},
-std::array<float,2>{0.0759591311f, 0.931995153f},
-std::array<float,2>{0.654236019f, 0.11715778f},
-std::array<float,2>{0.486363202f, 0.394255072f},
-std::array<float,2>{0.882848442f, 0.64241451f},
-std::array<float,2>{0.277963579f, 0.585720301f},
-std::array<float,2>{0.776327193f, 0.250400633f},
-std::array<float,2>{0.164304227f, 0.247740567f},
-std::array<float,2>{0.586983562f, 0.819071591f},
-std::array<float,2>{0.21852082f, 0.700916648f},
-std::array<float,2>{0.518488884f, 0.474785596f},
-std::array<float,2>{0.337308437f, 0.00908127334f},
-std::array<float,2>{0.87282598f, 0.99498868f},
-std::array<float,2>{0.422900945f, 0.811448514f},
-std::array<float,2>{0.975580812f, 0.134685412f},
-std::array<float,2>{0.0175709706f, 0.322396576f},
-std::array<float,2>{0.726127565f, 0.535073221f},
-std::array<float,2>{0.144694164f, 0.85199964f},
-std::array<float,2>{0.606506348f, 0.216821879f},
-std::array<float,2>{0.295966953f, 0.311119556f},
-std::array<float,2>{0.795752645f, 0.606299996f},
-std::array<float,2>{0.460093796f, 0.667913556f},
-std::array<float,2>{0.918206632f, 0.411283046f},
-std::array<float,2>{0.111938536f, 0.0722121224f},
-std::array<float,2>{0.686142147f, 0.876888037f},
-std::array<float,2>{0.0511737987f, 0.506350279f},
-std::array<float,2>{0.708587348f, 0.36879316f},
-std::array<float,2>{0.388413906f, 0.160183683f},
-std::array<float,2>{0.966380477f, 0.758366525f},
-std::array<float,2>{0.345445275f, 0.942308843f},
-std::array<float,2>{0.836502731f, 0.0622596629f},
-std::array<float,2>{0.232918397f, 0.44775483f},
-std::array<float,2>{0.561243773f, 0.737112761f},
-std::array<float,2>{0.122755662f, 0.825309277f},
-std::array<float,2>{0.673771441f, 0.236783832f},
-std::array<float,2>{0.46715498f, 0.264519393f},
-std::array<float,2>{0.908545375f, 0.590218484f},
-std::array<float,2>{0.285122365f, 0.650656223f},
-std::array<float,2>{0.785713553f, 0.398613572f},
-std::array<float,2>{0.155486867f, 0.117870197f},
-std::array<float,2>{0.601195872f, 0.922748327f},
-std::array<float,2>{0.222866789f, 0.545107782f},
-std::array<float,2>{0.553196728f, 0.316594809f},
-std::array<float,2>{0.353602529f, 0.131286055f},
-std::array<float,2>{0.830704749f, 0.799133658f},
-std::array<float,2>{0.380250812f, 0.988792479f},
-std::array<float,2>{0.957764745f, 0.005301225f},
-std::array<float,2>{0.0608750395f, 0.47867319f},
-std::array<float,2>{0.713258862f, 0.691173613f},
-std::array<float,2>{0.162344664f, 0.883658409f},
-std::array<float,2>{0.582676589f, 0.0697039887f},
-std::array<float,2>{0.273140669f, 0.415945947f},
-std::array<float,2>{0.768811405f, 0.659185767f},
-std::array<float,2>{0.4936665f, 0.595476091f},
-std::array<float,2>{0.882373691f, 0.300515026f},
-std::array<float,2>{0.0639822334f, 0.210027397f},
-std::array<float,2>{0.642519593f, 0.844193339f},
-std::array<float,2>{0.0251674131f, 0.744931042f},
-std::array<float,2>{0.73279047f, 0.445052207f},
-std::array<float,2>{0.432257921f, 0.0538191795f},
-std::array<float,2>{0.980437636f, 0.94977802f},
-std::array<float,2>{0.329079837f, 0.753271639f},
-std::array<float,2>{0.865863383f, 0.165648922f},
-std::array<float,2>{0.208847895f, 0.36332491f},
-std::array<float,2>{0.529468894f, 0.512823343f},
-std::array<float,2>{0.0320675634f, 0.958116353f},
-std::array<float,2>{0.696158648f, 0.0388606563f},
-std::array<float,2>{0.403140128f, 0.464293748f},
-std::array<float,2>{0.950159311f, 0.719030499f},
-std::array<float,2>{0.369676799f, 0.516446173f},
-std::array<float,2>{0.824828029f, 0.345348477f},
-std::array<float,2>{0.245027304f, 0.181778044f},
-std::array<float,2>{0.545218647f, 0.778071821f},
-std::array<float,2>{0.134045199f, 0.678981602f},
-std::array<float,2>{0.61690098f, 0.426583141f},
-std::array<float,2>{0.300357223f, 0.0857229009f},
-std::array<float,2>{0.809342206f, 0.903738618f},
-std::array<float,2>{0.438636094f, 0.874997079f},
-std::array<float,2>{0.93403995f, 0.19665724f},
-std::array<float,2>{0.108820245f, 0.296823412f},
-std::array<float,2>{0.66766578f, 0.622461438f},
-std::array<float,2>{0.200935751f, 0.792258084f},
-std::array<float,2>{0.512964785f, 0.143412322f},
-std::array<float,2>{0.314285457f, 0.341821253f},
-std::array<float,2>{0.858702302f, 0.559346795f},
-std::array<float,2>{0.419405431f, 0.716825128f},
-std::array<float,2>{0.988430202f, 0.49711296f},
-std::array<float,2>{0.00447636331f, 0.0308856256f},
-std::array<float,2>{0.746893644f, 0.9753443f},
-std::array<float,2>{0.0918644145f, 0.571351349f},
-std::array<float,2>{0.629326046f, 0.27971074f},
-std::array<float,2>{0.477930963f, 0.230362266f},
-std::array<float,2>{0.89831996f, 0.841884136f},
-std::array<float,2>{0.265103906f, 0.907941759f},
-std::array<float,2>{0.751229703f, 0.0949985459f},
-std::array<float,2>{0.175134733f, 0.38494426f},
-std::array<float,2>{0.569343269f, 0.638331413f},
-std::array<float,2>{0.0782606825f, 0.800794601f},
-std::array<float,2>{0.636103332f, 0.128861293f},
-std::array<float,2>{0.475185692f, 0.315343678f},
-std::array<float,2>{0.901720643f, 0.539854169f},
-std::array<float,2>{0.257294357f, 0.691905677f},
-std::array<float,2>{0.76410538f, 0.483442783f},
-std::array<float,2>{0.184601724f, 0.00357865985f},
-std::array<float,2>{0.571486354f, 0.987837732f},
-std::array<float,2>{0.187621668f, 0.589644134f},
-std::array<float,2>{0.5041942f, 0.26046434f},
-std::array<float,2>{0.326849014f, 0.238844216f},
-std::array<float,2>{0.84675771f, 0.820909262f},
-std::array<float,2>{0.410970271f, 0.928470075f},
-std::array<float,2>{0.998909116f, 0.122259274f},
-std::array<float,2>{0.011918149f, 0.404827207f},
-std::array<float,2>{0.739951432f, 0.655714571f},
-std::array<float,2>{0.131573305f, 0.94707334f},
-std::array<float,2>{0.62457186f, 0.0482120328f},
-std::array<float,2>{0.311802447f, 0.439005256f},
-std::array<float,2>{0.803741992f, 0.74697566f},
-std::array<float,2>{0.448935956f, 0.509921193f},
-std::array<float,2>{0.922140837f, 0.36060074f},
-std::array<float,2>{0.0986647084f, 0.169600695f},
-std::array<float,2>{0.662231863f, 0.755892992f},
-std::array<float,2>{0.0439077839f, 0.66292721f},
-std::array<float,2>{0.692419648f, 0.421694905f},
-std::array<float,2>{0.397528917f, 0.0654525757f},
-std::array<float,2>{0.938905358f, 0.887334049f},
-std::array<float,2>{0.362196624f, 0.84920752f},
-std::array<float,2>{0.816412747f, 0.204891086f},
-std::array<float,2>{0.239189029f, 0.302901894f},
-std::array<float,2>{0.535369456f, 0.598424852f},
-std::array<float,2>{0.0225766674f, 0.900478005f},
-std::array<float,2>{0.721002579f, 0.080683887f},
-std::array<float,2>{0.426460385f, 0.423991323f},
-std::array<float,2>{0.970996499f, 0.673403621f},
-std::array<float,2>{0.340092897f, 0.620923877f},
-std::array<float,2>{0.87032944f, 0.289089203f},
-std::array<float,2>{0.212816522f, 0.200533047f},
-std::array<float,2>{0.522005379f, 0.86753881f},
-std::array<float,2>{0.16831851f, 0.726378798f},
-std::array<float,2>{0.593547523f, 0.467829555f},
-std::array<float,2>{0.276830316f, 0.0349531025f},
-std::array<float,2>{0.778560996f, 0.956146836f},
-std::array<float,2>{0.490399569f, 0.773918629f},
-std::array<float,2>{0.890155613f, 0.186981708f},
-std::array<float,2>{0.0727956146f, 0.350479156f},
-std::array<float,2>{0.651572168f, 0.520516694f},
-std::array<float,2>{0.228320852f, 0.837880075f},
-std::array<float,2>{0.557298481f, 0.233849153f},
-std::array<float,2>{0.350021064f, 0.275100887f},
-std::array<float,2>{0.840251148f, 0.576968193f},
-std::array<float,2>{0.384491712f, 0.634174705f},
-std::array<float,2>{0.964235425f, 0.39006266f},
-std::array<float,2>{0.0493884124f, 0.0999251679f},
-std::array<float,2>{0.70584023f, 0.912987769f},
-std::array<float,2>{0.116168566f, 0.554702401f},
-std::array<float,2>{0.680966139f, 0.339506418f},
-std::array<float,2>{0.453699142f, 0.14456746f},
-std::array<float,2>{0.914324284f, 0.79423517f},
-std::array<float,2>{0.291363209f, 0.969885528f},
-std::array<float,2>{0.792196035f, 0.0242402181f},
-std::array<float,2>{0.143197522f, 0.494089723f},
-std::array<float,2>{0.602971673f, 0.712421656f},
-std::array<float,2>{0.0574797504f, 0.861230671f},
-std::array<float,2>{0.715669155f, 0.189893022f},
-std::array<float,2>{0.377537251f, 0.288334399f},
-std::array<float,2>{0.953371346f, 0.614571154f},
-std::array<float,2>{0.358064711f, 0.68017602f},
-std::array<float,2>{0.835893333f, 0.432844609f},
-std::array<float,2>{0.220357344f, 0.0890502036f},
-std::array<float,2>{0.549057901f, 0.890625358f},
-std::array<float,2>{0.151413694f, 0.527558148f},
-std::array<float,2>{0.59450537f, 0.354667246f},
-std::array<float,2>{0.287411928f, 0.175761178f},
-std::array<float,2>{0.781935513f, 0.772681534f},
-std::array<float,2>{0.462572008f, 0.961802363f},
-std::array<float,2>{0.91219312f, 0.0394691825f},
-std::array<float,2>{0.120920688f, 0.45738849f},
-std::array<float,2>{0.676119506f, 0.730366886f},
-std::array<float,2>{0.205804661f, 0.919608474f},
-std::array<float,2>{0.524561465f, 0.107923709f},
-std::array<float,2>{0.335827857f, 0.377779365f},
-std::array<float,2>{0.862761319f, 0.626080215f},
-std::array<float,2>{0.437425345f, 0.565859139f},
-std::array<float,2>{0.981038988f, 0.27246511f},
-std::array<float,2>{0.0280665942f, 0.225971818f},
-std::array<float,2>{0.72762996f, 0.830114782f},
-std::array<float,2>{0.0686507076f, 0.704981863f},
-std::array<float,2>{0.647070408f, 0.485271633f},
-std::array<float,2>{0.497824728f, 0.0183104537f},
-std::array<float,2>{0.878704965f, 0.980152071f},
-std::array<float,2>{0.267211705f, 0.783903062f},
-std::array<float,2>{0.771333873f, 0.15357846f},
-std::array<float,2>{0.15727149f, 0.333912462f},
-std::array<float,2>{0.580687225f, 0.54805541f},
-std::array<float,2>{0.102470689f, 0.996374965f},
-std::array<float,2>{0.670475781f, 0.014697874f},
-std::array<float,2>{0.445292413f, 0.469981015f},
-std::array<float,2>{0.93331331f, 0.695335925f},
-std::array<float,2>{0.301098645f, 0.538487554f},
-std::array<float,2>{0.807034612f, 0.325425744f},
-std::array<float,2>{0.140284047f, 0.139113158f},
-std::array<float,2>{0.61305207f, 0.806568623f},
-std::array<float,2>{0.249283269f, 0.64768517f},
-std::array<float,2>{0.541505456f, 0.398092121f},
-std::array<float,2>{0.371271282f, 0.111640923f},
-std::array<float,2>{0.820981801f, 0.93387717f},
-std::array<float,2>{0.398474187f, 0.813790381f},
-std::array<float,2>{0.948454797f, 0.242525309f},
-std::array<float,2>{0.0354844853f, 0.25410217f},
-std::array<float,2>{0.702890992f, 0.581072032f},
-std::array<float,2>{0.178042293f, 0.762949944f},
-std::array<float,2>{0.564514339f, 0.158668518f},
-std::array<float,2>{0.261504412f, 0.371737123f},
-std::array<float,2>{0.756382227f, 0.500539303f},
-std::array<float,2>{0.482117832f, 0.739791632f},
-std::array<float,2>{0.893340111f, 0.45151931f},
-std::array<float,2>{0.0874793679f, 0.0560639352f},
-std::array<float,2>{0.626648307f, 0.93809849f},
-std::array<float,2>{0.00266667828f, 0.602923512f},
-std::array<float,2>{0.745977461f, 0.308564842f},
-std::array<float,2>{0.415549695f, 0.211625353f},
-std::array<float,2>{0.985632896f, 0.858376503f},
-std::array<float,2>{0.317577332f, 0.879196823f},
-std::array<float,2>{0.852788627f, 0.0742293969f},
-std::array<float,2>{0.196636736f, 0.409910381f},
-std::array<float,2>{0.510725081f, 0.668256044f},
-std::array<float,2>{0.0422794744f, 0.789001644f},
-std::array<float,2>{0.690686524f, 0.151948839f},
-std::array<float,2>{0.39381969f, 0.331662863f},
-std::array<float,2>{0.942054212f, 0.552535057f},
-std::array<float,2>{0.364812106f, 0.708068907f},
-std::array<float,2>{0.814088643f, 0.490309566f},
-std::array<float,2>{0.237911522f, 0.0229241978f},
-std::array<float,2>{0.531877816f, 0.981140912f},
-std::array<float,2>{0.128196061f, 0.566890121f},
-std::array<float,2>{0.618617356f, 0.268603802f},
-std::array<float,2>{0.306340963f, 0.221075892f},
-std::array<float,2>{0.797110975f, 0.835580349f},
-std::array<float,2>{0.449992567f, 0.916826785f},
-std::array<float,2>{0.929601789f, 0.101780966f},
-std::array<float,2>{0.0952084213f, 0.382042736f},
-std::array<float,2>{0.658982337f, 0.628968954f},
-std::array<float,2>{0.194636464f, 0.968605816f},
-std::array<float,2>{0.500511885f, 0.0468093455f},
-std::array<float,2>{0.323720932f, 0.455389351f},
-std::array<float,2>{0.848779202f, 0.73175472f},
-std::array<float,2>{0.40815872f, 0.524820805f},
-std::array<float,2>{0.994144022f, 0.357018858f},
-std::array<float,2>{0.0115856072f, 0.176291779f},
-std::array<float,2>{0.735072911f, 0.767289162f},
-std::array<float,2>{0.0830841213f, 0.686472476f},
-std::array<float,2>{0.638238728f, 0.436451584f},
-std::array<float,2>{0.468783438f, 0.0912944824f},
-std::array<float,2>{0.902668417f, 0.898103595f},
-std::array<float,2>{0.251107156f, 0.863887668f},
-std::array<float,2>{0.758042932f, 0.192947626f},
-std::array<float,2>{0.181111768f, 0.28407976f},
-std::array<float,2>{0.574559927f, 0.612212241f},
-std::array<float,2>{0.109925993f, 0.878528476f},
-std::array<float,2>{0.683669209f, 0.0731773004f},
-std::array<float,2>{0.45769915f, 0.413641095f},
-std::array<float,2>{0.920208693f, 0.66511023f},
-std::array<float,2>{0.294198096f, 0.608474374f},
-std::array<float,2>{0.794354558f, 0.309533596f},
-std::array<float,2>{0.14842616f, 0.216502115f},
-std::array<float,2>{0.608989477f, 0.854453981f},
-std::array<float,2>{0.231664464f, 0.735562325f},
-std::array<float,2>{0.560385406f, 0.445446849f},
-std::array<float,2>{0.346450299f, 0.059961345f},
-std::array<float,2>{0.838412344f, 0.944167316f},
-std::array<float,2>{0.389855355f, 0.761276782f},
-std::array<float,2>{0.968120277f, 0.163011476f},
-std::array<float,2>{0.0542165339f, 0.37037012f},
-std::array<float,2>{0.710798144f, 0.505601764f},
-std::array<float,2>{0.16789563f, 0.816409647f},
-std::array<float,2>{0.588634491f, 0.249016568f},
-std::array<float,2>{0.279716164f, 0.252877414f},
-std::array<float,2>{0.773592651f, 0.583030581f},
-std::array<float,2>{0.484508812f, 0.644080102f},
-std::array<float,2>{0.885938704f, 0.39174059f},
-std::array<float,2>{0.0781057402f, 0.114068642f},
-std::array<float,2>{0.655608237f, 0.931471586f},
-std::array<float,2>{0.0191144012f, 0.53248322f},
-std::array<float,2>{0.722998619f, 0.321620435f},
-std::array<float,2>{0.424602956f, 0.136404216f},
-std::array<float,2>{0.974419832f, 0.809164882f},
-std::array<float,2>{0.339831263f, 0.993387163f},
-std::array<float,2>{0.874040604f, 0.0103758834f},
-std::array<float,2>{0.216479242f, 0.473866761f},
-std::array<float,2>{0.517254055f, 0.703063965f},
-std::array<float,2>{0.0653758496f, 0.846443534f},
-std::array<float,2>{0.644505024f, 0.208045825f},
-std::array<float,2>{0.495733887f, 0.297737986f},
-std::array<float,2>{0.880175233f, 0.596996546f},
-std::array<float,2>{0.270105094f, 0.65757525f},
-std::array<float,2>{0.767014503f, 0.417188168f},
-std::array<float,2>{0.161150947f, 0.0673726797f},
-std::array<float,2>{0.584135473f, 0.88555932f},
-std::array<float,2>{0.210220665f, 0.514374673f},
-std::array<float,2>{0.529007196f, 0.36543116f},
-std::array<float,2>{0.331251204f, 0.167849511f},
-std::array<float,2>{0.863554955f, 0.751767516f},
-std::array<float,2>{0.43131724f, 0.952877164f},
-std::array<float,2>{0.978279293f, 0.0519077294f},
-std::array<float,2>{0.0261969492f, 0.442376226f},
-std::array<float,2>{0.731210768f, 0.743341804f},
-std::array<float,2>{0.153756395f, 0.925516546f},
-std::array<float,2>{0.598003626f, 0.120021924f},
-std::array<float,2>{0.281348169f, 0.401611269f},
-std::array<float,2>{0.78831321f, 0.649672508f},
-std::array<float,2>{0.465119243f, 0.593533039f},
-std::array<float,2>{0.907081485f, 0.262090236f},
-std::array<float,2>{0.123593621f, 0.236172929f},
-std::array<float,2>{0.673841178f, 0.828098953f},
-std::array<float,2>{0.059899915f, 0.687541842f},
-std::array<float,2>{0.712606013f, 0.476775169f},
-std::array<float,2>{0.38139677f, 0.00637661433f},
-std::array<float,2>{0.960528553f, 0.991756618f},
-std::array<float,2>{0.353352457f, 0.797252357f},
-std::array<float,2>{0.828509092f, 0.129223362f},
-std::array<float,2>{0.225703835f, 0.319384217f},
-std::array<float,2>{0.550835967f, 0.544216275f},
-std::array<float,2>{0.00675288262f, 0.974252641f},
-std::array<float,2>{0.748370767f, 0.0277038421f},
-std::array<float,2>{0.421035886f, 0.498575956f},
-std::array<float,2>{0.990523934f, 0.716460049f},
-std::array<float,2>{0.315557092f, 0.561538577f},
-std::array<float,2>{0.856459916f, 0.340268791f},
-std::array<float,2>{0.201367348f, 0.142424628f},
-std::array<float,2>{0.515559435f, 0.789263606f},
-std::array<float,2>{0.173630327f, 0.638759434f},
-std::array<float,2>{0.568348885f, 0.384104103f},
-std::array<float,2>{0.262998164f, 0.0963996351f},
-std::array<float,2>{0.752952576f, 0.909421802f},
-std::array<float,2>{0.478751779f, 0.841635883f},
-std::array<float,2>{0.894700587f, 0.227560252f},
-std::array<float,2>{0.0914827138f, 0.277442962f},
-std::array<float,2>{0.631528676f, 0.573684335f},
-std::array<float,2>{0.242961287f, 0.779493272f},
-std::array<float,2>{0.544916213f, 0.180987552f},
-std::array<float,2>{0.367989868f, 0.345844209f},
-std::array<float,2>{0.826685846f, 0.517831564f},
-std::array<float,2>{0.404991031f, 0.721409261f},
-std::array<float,2>{0.952449739f, 0.462157875f},
-std::array<float,2>{0.0338160209f, 0.0352829099f},
-std::array<float,2>{0.697360039f, 0.960099876f},
-std::array<float,2>{0.106722608f, 0.624128997f},
-std::array<float,2>{0.664403558f, 0.294442803f},
-std::array<float,2>{0.440900505f, 0.199214742f},
-std::array<float,2>{0.936652958f, 0.871755064f},
-std::array<float,2>{0.297697842f, 0.904569864f},
-std::array<float,2>{0.81100142f, 0.0837330371f},
-std::array<float,2>{0.134878635f, 0.429224253f},
-std::array<float,2>{0.615084112f, 0.67765069f},
-std::array<float,2>{0.0999860317f, 0.754976749f},
-std::array<float,2>{0.662102103f, 0.171534732f},
-std::array<float,2>{0.446070522f, 0.361749053f},
-std::array<float,2>{0.92390281f, 0.50946939f},
-std::array<float,2>{0.309975624f, 0.748971164f},
-std::array<float,2>{0.802572191f, 0.439517885f},
-std::array<float,2>{0.130112976f, 0.050186906f},
-std::array<float,2>{0.621233821f, 0.947794914f},
-std::array<float,2>{0.241908133f, 0.600352943f},
-std::array<float,2>{0.53875941f, 0.30133599f},
-std::array<float,2>{0.359566271f, 0.206560045f},
-std::array<float,2>{0.819310069f, 0.850800276f},
-std::array<float,2>{0.395529687f, 0.890423179f},
-std::array<float,2>{0.941359162f, 0.064399533f},
-std::array<float,2>{0.0467717722f, 0.41935733f},
-std::array<float,2>{0.694512188f, 0.661544144f},
-std::array<float,2>{0.186866492f, 0.985286117f},
-std::array<float,2>{0.572711706f, 0.000693737471f},
-std::array<float,2>{0.254801065f, 0.481964827f},
-std::array<float,2>{0.762616038f, 0.69475913f},
-std::array<float,2>{0.473160326f, 0.542320728f},
-std::array<float,2>{0.899803579f, 0.312709481f},
-std::array<float,2>{0.0819397271f, 0.126147062f},
-std::array<float,2>{0.633292913f, 0.803559244f},
-std::array<float,2>{0.0151334601f, 0.652814984f},
-std::array<float,2>{0.740451872f, 0.40419063f},
-std::array<float,2>{0.41334182f, 0.123515174f},
-std::array<float,2>{0.996258974f, 0.926557124f},
-std::array<float,2>{0.325624287f, 0.823769212f},
-std::array<float,2>{0.844928026f, 0.242154837f},
-std::array<float,2>{0.189768225f, 0.258272201f},
-std::array<float,2>{0.506337464f, 0.586549699f},
-std::array<float,2>{0.0479322746f, 0.911407351f},
-std::array<float,2>{0.704696417f, 0.0986981615f},
-std::array<float,2>{0.385179847f, 0.388386637f},
-std::array<float,2>{0.96139729f, 0.635057151f},
-std::array<float,2>{0.349255115f, 0.575964987f},
-std::array<float,2>{0.843516886f, 0.276644289f},
-std::array<float,2>{0.229865238f, 0.232212588f},
-std::array<float,2>{0.556113899f, 0.838796794f},
-std::array<float,2>{0.142237112f, 0.712940812f},
-std::array<float,2>{0.604287267f, 0.495419294f},
-std::array<float,2>{0.290447116f, 0.0269662719f},
-std::array<float,2>{0.789244711f, 0.972400904f},
-std::array<float,2>{0.45590055f, 0.795677304f},
-std::array<float,2>{0.916901529f, 0.147489116f},
-std::array<float,2>{0.114383072f, 0.336281687f},
-std::array<float,2>{0.682026982f, 0.557525992f},
-std::array<float,2>{0.214312032f, 0.870480776f},
-std::array<float,2>{0.520383179f, 0.202076823f},
-std::array<float,2>{0.342874974f, 0.291758627f},
-std::array<float,2>{0.867270291f, 0.617949903f},
-std::array<float,2>{0.429312527f, 0.674724102f},
-std::array<float,2>{0.970503688f, 0.422316551f},
-std::array<float,2>{0.0213390682f, 0.078773275f},
-std::array<float,2>{0.719400644f, 0.899348438f},
-std::array<float,2>{0.0720039904f, 0.522158921f},
-std::array<float,2>{0.649429083f, 0.348468274f},
-std::array<float,2>{0.488979459f, 0.18536824f},
-std::array<float,2>{0.887636364f, 0.776205778f},
-std::array<float,2>{0.273468524f, 0.953551173f},
-std::array<float,2>{0.780629456f, 0.0331895761f},
-std::array<float,2>{0.170966864f, 0.465628117f},
-std::array<float,2>{0.590808809f, 0.723979294f},
-std::array<float,2>{0.0310473293f, 0.829373419f},
-std::array<float,2>{0.728812456f, 0.223488346f},
-std::array<float,2>{0.433851331f, 0.269824028f},
-std::array<float,2>{0.983707905f, 0.562562466f},
-std::array<float,2>{0.333274066f, 0.627851129f},
-std::array<float,2>{0.859751582f, 0.37572971f},
-std::array<float,2>{0.204914317f, 0.107359447f},
-std::array<float,2>{0.526960313f, 0.921227038f},
-std::array<float,2>{0.158304513f, 0.548962474f},
-std::array<float,2>{0.579809546f, 0.33474344f},
-std::array<float,2>{0.268314481f, 0.155618027f},
-std::array<float,2>{0.772170126f, 0.781269848f},
-std::array<float,2>{0.498446584f, 0.97805208f},
-std::array<float,2>{0.876423657f, 0.0163120516f},
-std::array<float,2>{0.0671900287f, 0.487529814f},
-std::array<float,2>{0.644790828f, 0.706881106f},
-std::array<float,2>{0.221580639f, 0.892741144f},
-std::array<float,2>{0.548243999f, 0.0863260999f},
-std::array<float,2>{0.356887907f, 0.429906696f},
-std::array<float,2>{0.833332121f, 0.681937933f},
-std::array<float,2>{0.37620908f, 0.615719616f},
-std::array<float,2>{0.956860304f, 0.286215007f},
-std::array<float,2>{0.0560247414f, 0.187746897f},
-std::array<float,2>{0.718041301f, 0.861355186f},
-std::array<float,2>{0.117318764f, 0.726682246f},
-std::array<float,2>{0.678419352f, 0.460916221f},
-std::array<float,2>{0.463494033f, 0.0424171425f},
-std::array<float,2>{0.911873043f, 0.964660108f},
-std::array<float,2>{0.285938472f, 0.771109104f},
-std::array<float,2>{0.783806622f, 0.173344865f},
-std::array<float,2>{0.149089977f, 0.353120446f},
-std::array<float,2>{0.596318483f, 0.53013438f},
-std::array<float,2>{0.0887785554f, 0.939857066f},
-std::array<float,2>{0.62705195f, 0.0578404069f},
-std::array<float,2>{0.483978808f, 0.449313879f},
-std::array<float,2>{0.891774833f, 0.741249621f},
-std::array<float,2>{0.259130597f, 0.503475547f},
-std::array<float,2>{0.755737364f, 0.373216867f},
-std::array<float,2>{0.176851943f, 0.157083958f},
-std::array<float,2>{0.562615097f, 0.764804423f},
-std::array<float,2>{0.19872658f, 0.671864152f},
-std::array<float,2>{0.508054495f, 0.407943457f},
-std::array<float,2>{0.318489283f, 0.0778080896f},
-std::array<float,2>{0.854114413f, 0.881432593f},
-std::array<float,2>{0.416521341f, 0.855788827f},
-std::array<float,2>{0.986963809f, 0.214590594f},
-std::array<float,2>{1.94687595e-06f, 0.304866016f},
-std::array<float,2>{0.7440449f, 0.605407119f},
-std::array<float,2>{0.136833221f, 0.807130039f},
-std::array<float,2>{0.610762775f, 0.138126701f},
-std::array<float,2>{0.30414781f, 0.32682547f},
-std::array<float,2>{0.805471957f, 0.536556184f},
-std::array<float,2>{0.442371964f, 0.698106349f},
-std::array<float,2>{0.931484759f, 0.471397758f},
-std::array<float,2>{0.105438367f, 0.0128304334f},
-std::array<float,2>{0.66911602f, 0.999142945f},
-std::array<float,2>{0.0373959839f, 0.579133093f},
-std::array<float,2>{0.699785292f, 0.256819576f},
-std::array<float,2>{0.402011454f, 0.244663045f},
-std::array<float,2>{0.947097838f, 0.816255629f},
-std::array<float,2>{0.373428792f, 0.936849654f},
-std::array<float,2>{0.82350558f, 0.111166507f},
-std::array<float,2>{0.246657878f, 0.395564586f},
-std::array<float,2>{0.539570212f, 0.646106839f},
-std::array<float,2>{0.0159434732f, 0.809616089f},
-std::array<float,2>{0.724872112f, 0.135704204f},
-std::array<float,2>{0.422382265f, 0.320830315f},
-std::array<float,2>{0.976554096f, 0.531255007f},
-std::array<float,2>{0.336449087f, 0.701449871f},
-std::array<float,2>{0.871392429f, 0.472729951f},
-std::array<float,2>{0.217769295f, 0.0108811548f},
-std::array<float,2>{0.519234061f, 0.992943883f},
-std::array<float,2>{0.165438354f, 0.582885981f},
-std::array<float,2>{0.586166322f, 0.253433377f},
-std::array<float,2>{0.278627187f, 0.249883577f},
-std::array<float,2>{0.77668643f, 0.817887008f},
-std::array<float,2>{0.487700284f, 0.930437744f},
-std::array<float,2>{0.88463968f, 0.114553407f},
-std::array<float,2>{0.0748970583f, 0.390691906f},
-std::array<float,2>{0.653131962f, 0.643293381f},
-std::array<float,2>{0.23429592f, 0.944488585f},
-std::array<float,2>{0.562304556f, 0.0588461533f},
-std::array<float,2>{0.344201624f, 0.446473688f},
-std::array<float,2>{0.837614477f, 0.734786332f},
-std::array<float,2>{0.38728857f, 0.504060388f},
-std::array<float,2>{0.96501857f, 0.369836271f},
-std::array<float,2>{0.052435305f, 0.163126856f},
-std::array<float,2>{0.707865298f, 0.760659039f},
-std::array<float,2>{0.112497032f, 0.664410532f},
-std::array<float,2>{0.686835349f, 0.4127132f},
-std::array<float,2>{0.459119737f, 0.07397414f},
-std::array<float,2>{0.919395685f, 0.877520442f},
-std::array<float,2>{0.295696318f, 0.855413914f},
-std::array<float,2>{0.796209693f, 0.215498254f},
-std::array<float,2>{0.146163493f, 0.309808999f},
-std::array<float,2>{0.605475903f, 0.607455194f},
-std::array<float,2>{0.085731402f, 0.897408128f},
-std::array<float,2>{0.639715075f, 0.0905664414f},
-std::array<float,2>{0.471814752f, 0.436649889f},
-std::array<float,2>{0.90531522f, 0.686702847f},
-std::array<float,2>{0.253832281f, 0.612863839f},
-std::array<float,2>{0.761527717f, 0.28508085f},
-std::array<float,2>{0.182034463f, 0.19208312f},
-std::array<float,2>{0.576905787f, 0.8649472f},
-std::array<float,2>{0.191966876f, 0.730734825f},
-std::array<float,2>{0.502582014f, 0.456937641f},
-std::array<float,2>{0.321498156f, 0.0451722294f},
-std::array<float,2>{0.85015595f, 0.967584729f},
-std::array<float,2>{0.408311933f, 0.765918314f},
-std::array<float,2>{0.994057f, 0.177166745f},
-std::array<float,2>{0.00968108885f, 0.355474085f},
-std::array<float,2>{0.73687619f, 0.523979485f},
-std::array<float,2>{0.12601985f, 0.834384739f},
-std::array<float,2>{0.619759917f, 0.222377717f},
-std::array<float,2>{0.306868851f, 0.268230796f},
-std::array<float,2>{0.799705446f, 0.568328381f},
-std::array<float,2>{0.452764988f, 0.630397975f},
-std::array<float,2>{0.927558482f, 0.3810682f},
-std::array<float,2>{0.0965956897f, 0.103386f},
-std::array<float,2>{0.656913102f, 0.917340994f},
-std::array<float,2>{0.0397622362f, 0.551645994f},
-std::array<float,2>{0.68929261f, 0.330116361f},
-std::array<float,2>{0.390732348f, 0.150551096f},
-std::array<float,2>{0.94368118f, 0.787259579f},
-std::array<float,2>{0.366809189f, 0.981921852f},
-std::array<float,2>{0.816144526f, 0.0214876495f},
-std::array<float,2>{0.235931367f, 0.492026359f},
-std::array<float,2>{0.533621132f, 0.707890391f},
-std::array<float,2>{0.108274065f, 0.872725844f},
-std::array<float,2>{0.666280627f, 0.197369158f},
-std::array<float,2>{0.43750152f, 0.293408185f},
-std::array<float,2>{0.934815943f, 0.623568356f},
-std::array<float,2>{0.299107522f, 0.67602998f},
-std::array<float,2>{0.809734344f, 0.428388327f},
-std::array<float,2>{0.133184388f, 0.0826703534f},
-std::array<float,2>{0.61607331f, 0.905719578f},
-std::array<float,2>{0.24523063f, 0.518810153f},
-std::array<float,2>{0.546347976f, 0.347188413f},
-std::array<float,2>{0.370617986f, 0.180121645f},
-std::array<float,2>{0.825711846f, 0.780418456f},
-std::array<float,2>{0.403639585f, 0.95937705f},
-std::array<float,2>{0.950319529f, 0.0364804193f},
-std::array<float,2>{0.0323171206f, 0.461310804f},
-std::array<float,2>{0.696557641f, 0.722518384f},
-std::array<float,2>{0.174467131f, 0.908893585f},
-std::array<float,2>{0.568898082f, 0.0972429663f},
-std::array<float,2>{0.263952374f, 0.383289903f},
-std::array<float,2>{0.750654459f, 0.640110314f},
-std::array<float,2>{0.477315128f, 0.572384298f},
-std::array<float,2>{0.897343874f, 0.278978914f},
-std::array<float,2>{0.0936820135f, 0.227345943f},
-std::array<float,2>{0.630825222f, 0.840338945f},
-std::array<float,2>{0.00489329873f, 0.715359569f},
-std::array<float,2>{0.747512281f, 0.499835759f},
-std::array<float,2>{0.418836683f, 0.0283901114f},
-std::array<float,2>{0.989599407f, 0.973506749f},
-std::array<float,2>{0.312631756f, 0.791000068f},
-std::array<float,2>{0.858156979f, 0.141505703f},
-std::array<float,2>{0.199254483f, 0.34104082f},
-std::array<float,2>{0.511802137f, 0.561368287f},
-std::array<float,2>{0.0624059588f, 0.991009355f},
-std::array<float,2>{0.714104474f, 0.0069996533f},
-std::array<float,2>{0.37923786f, 0.477962941f},
-std::array<float,2>{0.958660662f, 0.688511252f},
-std::array<float,2>{0.355103672f, 0.543773651f},
-std::array<float,2>{0.831940889f, 0.319059968f},
-std::array<float,2>{0.223760277f, 0.129912838f},
-std::array<float,2>{0.554658234f, 0.798636973f},
-std::array<float,2>{0.154580474f, 0.648658454f},
-std::array<float,2>{0.600217104f, 0.401096404f},
-std::array<float,2>{0.284015894f, 0.120824739f},
-std::array<float,2>{0.786520958f, 0.924624145f},
-std::array<float,2>{0.468388885f, 0.826525211f},
-std::array<float,2>{0.909804165f, 0.235288471f},
-std::array<float,2>{0.121529646f, 0.26278016f},
-std::array<float,2>{0.672094226f, 0.59271127f},
-std::array<float,2>{0.207386747f, 0.750844955f},
-std::array<float,2>{0.530967891f, 0.166295305f},
-std::array<float,2>{0.329547495f, 0.366800606f},
-std::array<float,2>{0.866432846f, 0.515036881f},
-std::array<float,2>{0.433189422f, 0.74286294f},
-std::array<float,2>{0.978775084f, 0.443016499f},
-std::array<float,2>{0.0239261184f, 0.0508037545f},
-std::array<float,2>{0.734197497f, 0.951296151f},
-std::array<float,2>{0.0626991615f, 0.596046746f},
-std::array<float,2>{0.640912354f, 0.297870934f},
-std::array<float,2>{0.492218912f, 0.207298055f},
-std::array<float,2>{0.881784499f, 0.847467721f},
-std::array<float,2>{0.272202998f, 0.886086464f},
-std::array<float,2>{0.768524587f, 0.0680721551f},
-std::array<float,2>{0.164038792f, 0.416751087f},
-std::array<float,2>{0.583502889f, 0.656369448f},
-std::array<float,2>{0.0739346296f, 0.776611745f},
-std::array<float,2>{0.651084721f, 0.184085846f},
-std::array<float,2>{0.491233826f, 0.34953931f},
-std::array<float,2>{0.888827324f, 0.523197353f},
-std::array<float,2>{0.275896639f, 0.722991645f},
-std::array<float,2>{0.777667642f, 0.465953887f},
-std::array<float,2>{0.169801027f, 0.0319442488f},
-std::array<float,2>{0.592725515f, 0.954951763f},
-std::array<float,2>{0.211709663f, 0.619077623f},
-std::array<float,2>{0.523288906f, 0.29213202f},
-std::array<float,2>{0.341308594f, 0.202323407f},
-std::array<float,2>{0.869657099f, 0.869586766f},
-std::array<float,2>{0.427548587f, 0.900047183f},
-std::array<float,2>{0.972408533f, 0.0798493773f},
-std::array<float,2>{0.0224323794f, 0.423656225f},
-std::array<float,2>{0.721983314f, 0.675271511f},
-std::array<float,2>{0.143695354f, 0.971106172f},
-std::array<float,2>{0.602301657f, 0.0258786436f},
-std::array<float,2>{0.292938441f, 0.494720876f},
-std::array<float,2>{0.791783273f, 0.714104056f},
-std::array<float,2>{0.454516083f, 0.558304489f},
-std::array<float,2>{0.915165365f, 0.337684065f},
-std::array<float,2>{0.117074966f, 0.1466683f},
-std::array<float,2>{0.680229545f, 0.796290994f},
-std::array<float,2>{0.0504886508f, 0.635959864f},
-std::array<float,2>{0.706514299f, 0.387404978f},
-std::array<float,2>{0.383322269f, 0.0984663591f},
-std::array<float,2>{0.963560998f, 0.910160482f},
-std::array<float,2>{0.350623399f, 0.839660525f},
-std::array<float,2>{0.841060638f, 0.231354162f},
-std::array<float,2>{0.227448642f, 0.275810957f},
-std::array<float,2>{0.55777204f, 0.574266791f},
-std::array<float,2>{0.0131318271f, 0.927406669f},
-std::array<float,2>{0.738847375f, 0.124876849f},
-std::array<float,2>{0.411987782f, 0.402463526f},
-std::array<float,2>{0.999473572f, 0.653436959f},
-std::array<float,2>{0.327624828f, 0.587341726f},
-std::array<float,2>{0.846524358f, 0.259509444f},
-std::array<float,2>{0.188680202f, 0.2410779f},
-std::array<float,2>{0.505138755f, 0.822910666f},
-std::array<float,2>{0.183777913f, 0.693652093f},
-std::array<float,2>{0.570788324f, 0.481376439f},
-std::array<float,2>{0.256801218f, 0.00109670893f},
-std::array<float,2>{0.765400171f, 0.985670328f},
-std::array<float,2>{0.476337045f, 0.804123223f},
-std::array<float,2>{0.900889814f, 0.125471935f},
-std::array<float,2>{0.0794739649f, 0.313593507f},
-std::array<float,2>{0.634860635f, 0.541447401f},
-std::array<float,2>{0.240079582f, 0.8505826f},
-std::array<float,2>{0.536325872f, 0.205331847f},
-std::array<float,2>{0.363033682f, 0.302685916f},
-std::array<float,2>{0.81789434f, 0.600908339f},
-std::array<float,2>{0.397177637f, 0.660510182f},
-std::array<float,2>{0.938000202f, 0.418340921f},
-std::array<float,2>{0.0447391309f, 0.0625884682f},
-std::array<float,2>{0.692189574f, 0.888970077f},
-std::array<float,2>{0.0980324373f, 0.508577168f},
-std::array<float,2>{0.663738191f, 0.363255858f},
-std::array<float,2>{0.448176146f, 0.170350999f},
-std::array<float,2>{0.92333889f, 0.754140377f},
-std::array<float,2>{0.311504215f, 0.949118376f},
-std::array<float,2>{0.803044558f, 0.0492996536f},
-std::array<float,2>{0.132648587f, 0.441020697f},
-std::array<float,2>{0.623654425f, 0.749060452f},
-std::array<float,2>{0.0371085703f, 0.814984441f},
-std::array<float,2>{0.701490521f, 0.245290399f},
-std::array<float,2>{0.400245219f, 0.257257551f},
-std::array<float,2>{0.948038459f, 0.578201473f},
-std::array<float,2>{0.372793615f, 0.645278633f},
-std::array<float,2>{0.821392119f, 0.395271987f},
-std::array<float,2>{0.248310179f, 0.110188894f},
-std::array<float,2>{0.542296231f, 0.936241746f},
-std::array<float,2>{0.139300868f, 0.535764515f},
-std::array<float,2>{0.611616433f, 0.327485025f},
-std::array<float,2>{0.302013457f, 0.136894047f},
-std::array<float,2>{0.808285117f, 0.807899594f},
-std::array<float,2>{0.444267601f, 0.998645365f},
-std::array<float,2>{0.931876719f, 0.0121328644f},
-std::array<float,2>{0.102698185f, 0.471691906f},
-std::array<float,2>{0.671813846f, 0.698997259f},
-std::array<float,2>{0.195487112f, 0.882791817f},
-std::array<float,2>{0.510806084f, 0.0762980357f},
-std::array<float,2>{0.316986293f, 0.406729072f},
-std::array<float,2>{0.852400124f, 0.670318365f},
-std::array<float,2>{0.414950877f, 0.604305744f},
-std::array<float,2>{0.985008299f, 0.306098938f},
-std::array<float,2>{0.00358196185f, 0.213087037f},
-std::array<float,2>{0.745049953f, 0.856743217f},
-std::array<float,2>{0.0866998062f, 0.740987778f},
-std::array<float,2>{0.62531364f, 0.451075703f},
-std::array<float,2>{0.480472684f, 0.0568982139f},
-std::array<float,2>{0.894501984f, 0.941154122f},
-std::array<float,2>{0.2606664f, 0.764153242f},
-std::array<float,2>{0.757031441f, 0.157432035f},
-std::array<float,2>{0.179578587f, 0.374257088f},
-std::array<float,2>{0.565676689f, 0.501958311f},
-std::array<float,2>{0.11951267f, 0.963361144f},
-std::array<float,2>{0.67754668f, 0.0411624014f},
-std::array<float,2>{0.461061925f, 0.459725946f},
-std::array<float,2>{0.913896799f, 0.727928638f},
-std::array<float,2>{0.288269609f, 0.530617774f},
-std::array<float,2>{0.782615066f, 0.352279365f},
-std::array<float,2>{0.150645107f, 0.172156051f},
-std::array<float,2>{0.595196486f, 0.769877553f},
-std::array<float,2>{0.219670922f, 0.683509111f},
-std::array<float,2>{0.550243497f, 0.431139171f},
-std::array<float,2>{0.359238505f, 0.0872913152f},
-std::array<float,2>{0.83478713f, 0.893748879f},
-std::array<float,2>{0.378311157f, 0.862675011f},
-std::array<float,2>{0.954119563f, 0.189211443f},
-std::array<float,2>{0.0576695129f, 0.285429686f},
-std::array<float,2>{0.716135621f, 0.616659522f},
-std::array<float,2>{0.156419381f, 0.782351315f},
-std::array<float,2>{0.581337571f, 0.155124649f},
-std::array<float,2>{0.266223699f, 0.335418314f},
-std::array<float,2>{0.770407438f, 0.550577104f},
-std::array<float,2>{0.496921629f, 0.705324888f},
-std::array<float,2>{0.877080142f, 0.48689115f},
-std::array<float,2>{0.070038192f, 0.0171397422f},
-std::array<float,2>{0.647628307f, 0.977344096f},
-std::array<float,2>{0.0290833954f, 0.563915312f},
-std::array<float,2>{0.727322578f, 0.270563126f},
-std::array<float,2>{0.436071604f, 0.224232808f},
-std::array<float,2>{0.982372999f, 0.828204334f},
-std::array<float,2>{0.334522039f, 0.920364678f},
-std::array<float,2>{0.861850917f, 0.10639821f},
-std::array<float,2>{0.206210554f, 0.376745522f},
-std::array<float,2>{0.523529291f, 0.628386378f},
-std::array<float,2>{0.0529805347f, 0.759196341f},
-std::array<float,2>{0.709488511f, 0.161760986f},
-std::array<float,2>{0.389163166f, 0.367644995f},
-std::array<float,2>{0.96733129f, 0.507719576f},
-std::array<float,2>{0.347422689f, 0.73748982f},
-std::array<float,2>{0.839609981f, 0.449028164f},
-std::array<float,2>{0.230822936f, 0.0613990687f},
-std::array<float,2>{0.55868268f, 0.943340659f},
-std::array<float,2>{0.146840513f, 0.607236147f},
-std::array<float,2>{0.607968867f, 0.312009215f},
-std::array<float,2>{0.293042839f, 0.218533367f},
-std::array<float,2>{0.79379189f, 0.852944672f},
-std::array<float,2>{0.458580941f, 0.875308394f},
-std::array<float,2>{0.921239495f, 0.0705881938f},
-std::array<float,2>{0.111105382f, 0.411055356f},
-std::array<float,2>{0.684894323f, 0.666762531f},
-std::array<float,2>{0.214988276f, 0.995940506f},
-std::array<float,2>{0.515668929f, 0.00869504828f},
-std::array<float,2>{0.338019878f, 0.475964487f},
-std::array<float,2>{0.873581767f, 0.699563801f},
-std::array<float,2>{0.425029278f, 0.5337286f},
-std::array<float,2>{0.972992539f, 0.323892355f},
-std::array<float,2>{0.0182528123f, 0.133236378f},
-std::array<float,2>{0.724143744f, 0.811594188f},
-std::array<float,2>{0.0770540461f, 0.641115427f},
-std::array<float,2>{0.654366255f, 0.393079847f},
-std::array<float,2>{0.486182332f, 0.115490034f},
-std::array<float,2>{0.885015726f, 0.932872832f},
-std::array<float,2>{0.280548722f, 0.819782555f},
-std::array<float,2>{0.774982035f, 0.246224716f},
-std::array<float,2>{0.16624552f, 0.251801163f},
-std::array<float,2>{0.589778841f, 0.584155262f},
-std::array<float,2>{0.0939490795f, 0.914415836f},
-std::array<float,2>{0.659695506f, 0.103879318f},
-std::array<float,2>{0.451157928f, 0.380738795f},
-std::array<float,2>{0.928402781f, 0.631229818f},
-std::array<float,2>{0.304836899f, 0.569283843f},
-std::array<float,2>{0.798795938f, 0.266172111f},
-std::array<float,2>{0.127835259f, 0.218902946f},
-std::array<float,2>{0.617792308f, 0.833367944f},
-std::array<float,2>{0.23729451f, 0.710398853f},
-std::array<float,2>{0.532307625f, 0.488485634f},
-std::array<float,2>{0.363312811f, 0.0199226048f},
-std::array<float,2>{0.81255883f, 0.984100759f},
-std::array<float,2>{0.39262712f, 0.785363436f},
-std::array<float,2>{0.943247557f, 0.1485461f},
-std::array<float,2>{0.0413422026f, 0.328700453f},
-std::array<float,2>{0.690328896f, 0.552743971f},
-std::array<float,2>{0.180466488f, 0.867123604f},
-std::array<float,2>{0.575376391f, 0.193622798f},
-std::array<float,2>{0.250008404f, 0.282316655f},
-std::array<float,2>{0.759735048f, 0.609414995f},
-std::array<float,2>{0.470495641f, 0.68421948f},
-std::array<float,2>{0.903458476f, 0.435491085f},
-std::array<float,2>{0.0825007558f, 0.093717508f},
-std::array<float,2>{0.637030959f, 0.895846128f},
-std::array<float,2>{0.0103464173f, 0.526889324f},
-std::array<float,2>{0.735791087f, 0.357453734f},
-std::array<float,2>{0.40718466f, 0.179119125f},
-std::array<float,2>{0.995738506f, 0.7688694f},
-std::array<float,2>{0.322411418f, 0.965761602f},
-std::array<float,2>{0.848288178f, 0.0446345322f},
-std::array<float,2>{0.193865225f, 0.453495324f},
-std::array<float,2>{0.501020014f, 0.732706189f},
-std::array<float,2>{0.0907705277f, 0.842985988f},
-std::array<float,2>{0.63279736f, 0.229472563f},
-std::array<float,2>{0.479735285f, 0.280776531f},
-std::array<float,2>{0.895636499f, 0.570525467f},
-std::array<float,2>{0.262388974f, 0.637537599f},
-std::array<float,2>{0.752685547f, 0.386094093f},
-std::array<float,2>{0.172348112f, 0.0939647332f},
-std::array<float,2>{0.567218661f, 0.906405389f},
-std::array<float,2>{0.202622637f, 0.559964776f},
-std::array<float,2>{0.514133573f, 0.343106151f},
-std::array<float,2>{0.314495832f, 0.144338489f},
-std::array<float,2>{0.855630815f, 0.791635811f},
-std::array<float,2>{0.420137674f, 0.975842357f},
-std::array<float,2>{0.991557539f, 0.0302325692f},
-std::array<float,2>{0.00766216032f, 0.497030526f},
-std::array<float,2>{0.749681354f, 0.718649805f},
-std::array<float,2>{0.135956854f, 0.902418554f},
-std::array<float,2>{0.613997519f, 0.0846242979f},
-std::array<float,2>{0.298631966f, 0.427578449f},
-std::array<float,2>{0.81247133f, 0.678669333f},
-std::array<float,2>{0.439717829f, 0.62154901f},
-std::array<float,2>{0.935917258f, 0.295149237f},
-std::array<float,2>{0.105791934f, 0.195520803f},
-std::array<float,2>{0.666006565f, 0.873528898f},
-std::array<float,2>{0.0349525735f, 0.719751179f},
-std::array<float,2>{0.699208677f, 0.463325262f},
-std::array<float,2>{0.405540496f, 0.0375585519f},
-std::array<float,2>{0.952115715f, 0.957518578f},
-std::array<float,2>{0.368318439f, 0.779241204f},
-std::array<float,2>{0.828001022f, 0.183134884f},
-std::array<float,2>{0.243253484f, 0.344162434f},
-std::array<float,2>{0.543820143f, 0.516835749f},
-std::array<float,2>{0.0272908956f, 0.951143622f},
-std::array<float,2>{0.732082367f, 0.0527972281f},
-std::array<float,2>{0.43010956f, 0.444150567f},
-std::array<float,2>{0.977526665f, 0.745224118f},
-std::array<float,2>{0.330299258f, 0.512197971f},
-std::array<float,2>{0.865123332f, 0.364436001f},
-std::array<float,2>{0.209423631f, 0.164992601f},
-std::array<float,2>{0.527795017f, 0.752273679f},
-std::array<float,2>{0.160732999f, 0.658718824f},
-std::array<float,2>{0.585666776f, 0.414454818f},
-std::array<float,2>{0.270993948f, 0.0688271746f},
-std::array<float,2>{0.765707135f, 0.884301245f},
-std::array<float,2>{0.494853556f, 0.84477675f},
-std::array<float,2>{0.879562914f, 0.209047139f},
-std::array<float,2>{0.0658135563f, 0.299042046f},
-std::array<float,2>{0.64331305f, 0.593842745f},
-std::array<float,2>{0.225066781f, 0.799851f},
-std::array<float,2>{0.551950991f, 0.132176027f},
-std::array<float,2>{0.351577073f, 0.318168283f},
-std::array<float,2>{0.829491198f, 0.546233356f},
-std::array<float,2>{0.382214487f, 0.68950367f},
-std::array<float,2>{0.959149003f, 0.479634374f},
-std::array<float,2>{0.0587509982f, 0.00482476922f},
-std::array<float,2>{0.711390853f, 0.989771962f},
-std::array<float,2>{0.124687858f, 0.590982437f},
-std::array<float,2>{0.674884617f, 0.26527527f},
-std::array<float,2>{0.466734976f, 0.237862736f},
-std::array<float,2>{0.907419622f, 0.824314892f},
-std::array<float,2>{0.283174485f, 0.923090756f},
-std::array<float,2>{0.788073003f, 0.118983775f},
-std::array<float,2>{0.152581647f, 0.399773747f},
-std::array<float,2>{0.599197626f, 0.651375711f},
-std::array<float,2>{0.113311388f, 0.793791771f},
-std::array<float,2>{0.682758391f, 0.146221578f},
-std::array<float,2>{0.456893981f, 0.337973118f},
-std::array<float,2>{0.917374492f, 0.556240976f},
-std::array<float,2>{0.289616644f, 0.711170971f},
-std::array<float,2>{0.790557742f, 0.492790312f},
-std::array<float,2>{0.14107132f, 0.0251535904f},
-std::array<float,2>{0.605152011f, 0.969558001f},
-std::array<float,2>{0.229344398f, 0.577557266f},
-std::array<float,2>{0.555608809f, 0.274262041f},
-std::array<float,2>{0.34819755f, 0.232658297f},
-std::array<float,2>{0.842294514f, 0.836370587f},
-std::array<float,2>{0.386071891f, 0.913791776f},
-std::array<float,2>{0.962608159f, 0.100719623f},
-std::array<float,2>{0.0478086472f, 0.389403999f},
-std::array<float,2>{0.703620076f, 0.633472204f},
-std::array<float,2>{0.170159563f, 0.956039965f},
-std::array<float,2>{0.590967357f, 0.0339066796f},
-std::array<float,2>{0.27458021f, 0.466828048f},
-std::array<float,2>{0.77954495f, 0.725505829f},
-std::array<float,2>{0.48982197f, 0.519728839f},
-std::array<float,2>{0.88816458f, 0.350621492f},
-std::array<float,2>{0.0708445609f, 0.185757086f},
-std::array<float,2>{0.649208069f, 0.774854004f},
-std::array<float,2>{0.0201164391f, 0.672350645f},
-std::array<float,2>{0.719837308f, 0.425283223f},
-std::array<float,2>{0.428069681f, 0.0816743597f},
-std::array<float,2>{0.968846321f, 0.90175426f},
-std::array<float,2>{0.342663556f, 0.8687554f},
-std::array<float,2>{0.868769884f, 0.199360177f},
-std::array<float,2>{0.21367681f, 0.29076156f},
-std::array<float,2>{0.521280944f, 0.619157612f},
-std::array<float,2>{0.0456952155f, 0.887901783f},
-std::array<float,2>{0.694080532f, 0.0646141097f},
-std::array<float,2>{0.395434409f, 0.419963539f},
-std::array<float,2>{0.940015495f, 0.663496017f},
-std::array<float,2>{0.361200124f, 0.599140227f},
-std::array<float,2>{0.820305228f, 0.303822696f},
-std::array<float,2>{0.2404477f, 0.203685448f},
-std::array<float,2>{0.538005531f, 0.847811401f},
-std::array<float,2>{0.129303142f, 0.747185707f},
-std::array<float,2>{0.622441053f, 0.438305378f},
-std::array<float,2>{0.309373409f, 0.0474573821f},
-std::array<float,2>{0.800895989f, 0.945390522f},
-std::array<float,2>{0.446563244f, 0.757444859f},
-std::array<float,2>{0.924963176f, 0.168254107f},
-std::array<float,2>{0.100639075f, 0.359478265f},
-std::array<float,2>{0.661031663f, 0.51089251f},
-std::array<float,2>{0.191343471f, 0.822094023f},
-std::array<float,2>{0.507593513f, 0.239800289f},
-std::array<float,2>{0.325090587f, 0.261253327f},
-std::array<float,2>{0.843916178f, 0.588753462f},
-std::array<float,2>{0.41279307f, 0.654334247f},
-std::array<float,2>{0.998019814f, 0.406216264f},
-std::array<float,2>{0.0138902785f, 0.121463656f},
-std::array<float,2>{0.741476297f, 0.929579079f},
-std::array<float,2>{0.0807890072f, 0.540718377f},
-std::array<float,2>{0.634111941f, 0.31592676f},
-std::array<float,2>{0.473785609f, 0.127547055f},
-std::array<float,2>{0.899258375f, 0.802312016f},
-std::array<float,2>{0.255176663f, 0.987300694f},
-std::array<float,2>{0.76358676f, 0.0026925155f},
-std::array<float,2>{0.185876459f, 0.482621193f},
-std::array<float,2>{0.573553801f, 0.693026543f},
-std::array<float,2>{0.00138435408f, 0.858574271f},
-std::array<float,2>{0.742634714f, 0.212690502f},
-std::array<float,2>{0.417527169f, 0.306889921f},
-std::array<float,2>{0.98746103f, 0.602046609f},
-std::array<float,2>{0.319805801f, 0.669326484f},
-std::array<float,2>{0.855260789f, 0.408355892f},
-std::array<float,2>{0.197613746f, 0.0760464072f},
-std::array<float,2>{0.509360671f, 0.880349755f},
-std::array<float,2>{0.176457673f, 0.501753807f},
-std::array<float,2>{0.564029098f, 0.372130513f},
-std::array<float,2>{0.257914275f, 0.160129532f},
-std::array<float,2>{0.754779935f, 0.762522876f},
-std::array<float,2>{0.482900023f, 0.93938601f},
-std::array<float,2>{0.890962839f, 0.0551171936f},
-std::array<float,2>{0.0893929005f, 0.452419996f},
-std::array<float,2>{0.628017664f, 0.739024758f},
-std::array<float,2>{0.247702807f, 0.935138464f},
-std::array<float,2>{0.540586233f, 0.112901889f},
-std::array<float,2>{0.374265999f, 0.39685747f},
-std::array<float,2>{0.822628796f, 0.646545291f},
-std::array<float,2>{0.400716424f, 0.581020117f},
-std::array<float,2>{0.945497751f, 0.255336016f},
-std::array<float,2>{0.0387273058f, 0.243591219f},
-std::array<float,2>{0.7010656f, 0.812514961f},
-std::array<float,2>{0.104061678f, 0.697106361f},
-std::array<float,2>{0.668015957f, 0.469414145f},
-std::array<float,2>{0.442809582f, 0.014391209f},
-std::array<float,2>{0.930527866f, 0.997107029f},
-std::array<float,2>{0.302849352f, 0.804832876f},
-std::array<float,2>{0.805933952f, 0.14014715f},
-std::array<float,2>{0.137705371f, 0.324991256f},
-std::array<float,2>{0.610054135f, 0.537477016f},
-std::array<float,2>{0.0682324618f, 0.978786588f},
-std::array<float,2>{0.645659328f, 0.0189390741f},
-std::array<float,2>{0.49909091f, 0.486091495f},
-std::array<float,2>{0.875171125f, 0.704079151f},
-std::array<float,2>{0.26949954f, 0.546883941f},
-std::array<float,2>{0.772851944f, 0.332575858f},
-std::array<float,2>{0.159212694f, 0.152775213f},
-std::array<float,2>{0.57830137f, 0.784647822f},
-std::array<float,2>{0.203367785f, 0.62570107f},
-std::array<float,2>{0.526328206f, 0.37868154f},
-std::array<float,2>{0.332953483f, 0.108870409f},
-std::array<float,2>{0.860920668f, 0.918871522f},
-std::array<float,2>{0.43500793f, 0.831800401f},
-std::array<float,2>{0.98279649f, 0.22549367f},
-std::array<float,2>{0.0295967963f, 0.271493345f},
-std::array<float,2>{0.730321527f, 0.565138161f},
-std::array<float,2>{0.149697512f, 0.772235632f},
-std::array<float,2>{0.597233713f, 0.173842087f},
-std::array<float,2>{0.287059575f, 0.35387361f},
-std::array<float,2>{0.784821928f, 0.528396666f},
-std::array<float,2>{0.464808345f, 0.728868306f},
-std::array<float,2>{0.910205305f, 0.458354801f},
-std::array<float,2>{0.118711025f, 0.0408040695f},
-std::array<float,2>{0.679336369f, 0.962280989f},
-std::array<float,2>{0.0556103401f, 0.614062786f},
-std::array<float,2>{0.717109501f, 0.287910044f},
-std::array<float,2>{0.37537697f, 0.190758705f},
-std::array<float,2>{0.956020057f, 0.860024035f},
-std::array<float,2>{0.356400847f, 0.892540753f},
-std::array<float,2>{0.832594693f, 0.088256605f},
-std::array<float,2>{0.222038344f, 0.431704134f},
-std::array<float,2>{0.547692001f, 0.680998743f}}
\ No newline at end of file
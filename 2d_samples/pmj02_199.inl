@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.221284091f, 0.736038148f},
-std::array<float,2>{0.977100372f, 0.256078482f},
-std::array<float,2>{0.517553031f, 0.79838407f},
-std::array<float,2>{0.357994139f, 0.0852644145f},
-std::array<float,2>{0.429426074f, 0.997617424f},
-std::array<float,2>{0.637269735f, 0.150700539f},
-std::array<float,2>{0.825564146f, 0.578415573f},
-std::array<float,2>{0.0433695577f, 0.490262508f},
-std::array<float,2>{0.305758506f, 0.504225791f},
-std::array<float,2>{0.585789144f, 0.419331372f},
-std::array<float,2>{0.890245259f, 0.894335806f},
-std::array<float,2>{0.131469592f, 0.226987571f},
-std::array<float,2>{0.0920856148f, 0.858969927f},
-std::array<float,2>{0.80058378f, 0.0142847719f},
-std::array<float,2>{0.710678399f, 0.680889368f},
-std::array<float,2>{0.466388136f, 0.335823208f},
-std::array<float,2>{0.0059957807f, 0.616849184f},
-std::array<float,2>{0.870752513f, 0.443904847f},
-std::array<float,2>{0.662171483f, 0.959373355f},
-std::array<float,2>{0.401209146f, 0.164001495f},
-std::array<float,2>{0.319429785f, 0.76200819f},
-std::array<float,2>{0.545128763f, 0.102770954f},
-std::array<float,2>{0.947107434f, 0.701128423f},
-std::array<float,2>{0.201114669f, 0.282878608f},
-std::array<float,2>{0.469323725f, 0.649284959f},
-std::array<float,2>{0.736673176f, 0.357731432f},
-std::array<float,2>{0.763526261f, 0.83822006f},
-std::array<float,2>{0.114239216f, 0.0580981523f},
-std::array<float,2>{0.166544452f, 0.917341113f},
-std::array<float,2>{0.931227624f, 0.206753746f},
-std::array<float,2>{0.624404013f, 0.53241396f},
-std::array<float,2>{0.251898438f, 0.375026494f},
-std::array<float,2>{0.145281866f, 0.559518635f},
-std::array<float,2>{0.905104101f, 0.397457391f},
-std::array<float,2>{0.572709739f, 0.937324822f},
-std::array<float,2>{0.287992746f, 0.19054465f},
-std::array<float,2>{0.448064148f, 0.81312561f},
-std::array<float,2>{0.693263471f, 0.0383836403f},
-std::array<float,2>{0.792030752f, 0.63507849f},
-std::array<float,2>{0.0767539218f, 0.371433049f},
-std::array<float,2>{0.369402915f, 0.703820348f},
-std::array<float,2>{0.504049599f, 0.306320518f},
-std::array<float,2>{0.992117047f, 0.780962348f},
-std::array<float,2>{0.239744931f, 0.111041054f},
-std::array<float,2>{0.0487479083f, 0.941815019f},
-std::array<float,2>{0.833126009f, 0.185325742f},
-std::array<float,2>{0.654173613f, 0.603571296f},
-std::array<float,2>{0.410486877f, 0.466147542f},
-std::array<float,2>{0.100891948f, 0.659085572f},
-std::array<float,2>{0.779194713f, 0.314904183f},
-std::array<float,2>{0.730242491f, 0.864330351f},
-std::array<float,2>{0.487728238f, 0.0182481091f},
-std::array<float,2>{0.277067125f, 0.875902712f},
-std::array<float,2>{0.604499578f, 0.244761094f},
-std::array<float,2>{0.906335711f, 0.530537307f},
-std::array<float,2>{0.182231098f, 0.422771931f},
-std::array<float,2>{0.384937137f, 0.57491523f},
-std::array<float,2>{0.676792443f, 0.477244884f},
-std::array<float,2>{0.856938124f, 0.981786966f},
-std::array<float,2>{0.0214746948f, 0.13437742f},
-std::array<float,2>{0.205831096f, 0.795467019f},
-std::array<float,2>{0.955614984f, 0.0770496279f},
-std::array<float,2>{0.552462459f, 0.722297192f},
-std::array<float,2>{0.338562399f, 0.270139307f},
-std::array<float,2>{0.178289905f, 0.631159842f},
-std::array<float,2>{0.916057169f, 0.360833019f},
-std::array<float,2>{0.593764842f, 0.827824473f},
-std::array<float,2>{0.268814892f, 0.0465869866f},
-std::array<float,2>{0.493241608f, 0.926715732f},
-std::array<float,2>{0.726201117f, 0.195780873f},
-std::array<float,2>{0.773223281f, 0.551658094f},
-std::array<float,2>{0.106041141f, 0.400418222f},
-std::array<float,2>{0.331983626f, 0.599468827f},
-std::array<float,2>{0.554927409f, 0.458434075f},
-std::array<float,2>{0.962892473f, 0.948490739f},
-std::array<float,2>{0.216891587f, 0.176740095f},
-std::array<float,2>{0.0280349702f, 0.768508494f},
-std::array<float,2>{0.851164699f, 0.118038163f},
-std::array<float,2>{0.684654415f, 0.71325469f},
-std::array<float,2>{0.375590622f, 0.304465473f},
-std::array<float,2>{0.069567807f, 0.520764053f},
-std::array<float,2>{0.781379998f, 0.437389046f},
-std::array<float,2>{0.699535131f, 0.885649204f},
-std::array<float,2>{0.437789053f, 0.238519445f},
-std::array<float,2>{0.294624925f, 0.873961985f},
-std::array<float,2>{0.562764585f, 0.0310296286f},
-std::array<float,2>{0.891235411f, 0.669171631f},
-std::array<float,2>{0.153921068f, 0.323497355f},
-std::array<float,2>{0.417827457f, 0.726808906f},
-std::array<float,2>{0.646334112f, 0.276505142f},
-std::array<float,2>{0.836611807f, 0.788196325f},
-std::array<float,2>{0.0624509379f, 0.0649208277f},
-std::array<float,2>{0.249577299f, 0.970159113f},
-std::array<float,2>{0.995642245f, 0.130933061f},
-std::array<float,2>{0.510270655f, 0.562911868f},
-std::array<float,2>{0.366759032f, 0.470265418f},
-std::array<float,2>{0.191809803f, 0.590407729f},
-std::array<float,2>{0.941594124f, 0.495947897f},
-std::array<float,2>{0.536859155f, 0.988147616f},
-std::array<float,2>{0.327007681f, 0.147173986f},
-std::array<float,2>{0.392781377f, 0.805162072f},
-std::array<float,2>{0.671114385f, 0.0919776708f},
-std::array<float,2>{0.866282463f, 0.748552918f},
-std::array<float,2>{0.0131310523f, 0.260735542f},
-std::array<float,2>{0.26364246f, 0.678702354f},
-std::array<float,2>{0.614275873f, 0.342758656f},
-std::array<float,2>{0.924583375f, 0.851016223f},
-std::array<float,2>{0.160954893f, 0.00317908451f},
-std::array<float,2>{0.122217476f, 0.90494591f},
-std::array<float,2>{0.752342403f, 0.223468304f},
-std::array<float,2>{0.746574104f, 0.513124347f},
-std::array<float,2>{0.483276099f, 0.407509893f},
-std::array<float,2>{0.0385886393f, 0.691922963f},
-std::array<float,2>{0.813480079f, 0.294770509f},
-std::array<float,2>{0.632422626f, 0.754496098f},
-std::array<float,2>{0.430233389f, 0.095555678f},
-std::array<float,2>{0.345370203f, 0.966088533f},
-std::array<float,2>{0.527822137f, 0.168753102f},
-std::array<float,2>{0.969053447f, 0.620383501f},
-std::array<float,2>{0.229336143f, 0.447458833f},
-std::array<float,2>{0.456742465f, 0.542302489f},
-std::array<float,2>{0.712137163f, 0.383465588f},
-std::array<float,2>{0.810922861f, 0.912639141f},
-std::array<float,2>{0.0828855038f, 0.215345263f},
-std::array<float,2>{0.135323718f, 0.834482193f},
-std::array<float,2>{0.877367973f, 0.0524219871f},
-std::array<float,2>{0.591985703f, 0.647265494f},
-std::array<float,2>{0.300647736f, 0.347967744f},
-std::array<float,2>{0.214398578f, 0.687405109f},
-std::array<float,2>{0.967581749f, 0.329362601f},
-std::array<float,2>{0.559589684f, 0.852303863f},
-std::array<float,2>{0.332577825f, 0.0111853406f},
-std::array<float,2>{0.379154831f, 0.895639241f},
-std::array<float,2>{0.68131125f, 0.233947486f},
-std::array<float,2>{0.845137894f, 0.501408815f},
-std::array<float,2>{0.0258713886f, 0.415451109f},
-std::array<float,2>{0.273161918f, 0.585444331f},
-std::array<float,2>{0.599082112f, 0.487122416f},
-std::array<float,2>{0.921535254f, 0.994687319f},
-std::array<float,2>{0.174169913f, 0.153964296f},
-std::array<float,2>{0.101690926f, 0.800986767f},
-std::array<float,2>{0.768989801f, 0.0809111372f},
-std::array<float,2>{0.721630991f, 0.739505053f},
-std::array<float,2>{0.498557478f, 0.25278312f},
-std::array<float,2>{0.0558238588f, 0.53724587f},
-std::array<float,2>{0.842807531f, 0.381396234f},
-std::array<float,2>{0.640765488f, 0.91807425f},
-std::array<float,2>{0.421564937f, 0.210507676f},
-std::array<float,2>{0.362141073f, 0.840005279f},
-std::array<float,2>{0.515492976f, 0.06016054f},
-std::array<float,2>{0.996331692f, 0.655504763f},
-std::array<float,2>{0.245054245f, 0.352517873f},
-std::array<float,2>{0.444931448f, 0.695640624f},
-std::array<float,2>{0.696773291f, 0.288709342f},
-std::array<float,2>{0.788858533f, 0.761025846f},
-std::array<float,2>{0.0649156645f, 0.107236065f},
-std::array<float,2>{0.149408862f, 0.953165412f},
-std::array<float,2>{0.896505594f, 0.158317149f},
-std::array<float,2>{0.568415642f, 0.61149919f},
-std::array<float,2>{0.292453349f, 0.439641535f},
-std::array<float,2>{0.158655912f, 0.605642915f},
-std::array<float,2>{0.927033961f, 0.464505523f},
-std::array<float,2>{0.611592233f, 0.941260219f},
-std::array<float,2>{0.261409819f, 0.180069908f},
-std::array<float,2>{0.47875151f, 0.776462376f},
-std::array<float,2>{0.745681822f, 0.116877891f},
-std::array<float,2>{0.757445276f, 0.708542943f},
-std::array<float,2>{0.118818976f, 0.310010165f},
-std::array<float,2>{0.322267652f, 0.638582349f},
-std::array<float,2>{0.532067358f, 0.367898166f},
-std::array<float,2>{0.941107452f, 0.81647855f},
-std::array<float,2>{0.191088229f, 0.034774486f},
-std::array<float,2>{0.0107493456f, 0.930514216f},
-std::array<float,2>{0.859601557f, 0.193536162f},
-std::array<float,2>{0.665447056f, 0.556809187f},
-std::array<float,2>{0.39611578f, 0.393735945f},
-std::array<float,2>{0.079495959f, 0.726107776f},
-std::array<float,2>{0.805364907f, 0.268813968f},
-std::array<float,2>{0.718093812f, 0.791276574f},
-std::array<float,2>{0.459617734f, 0.0721039847f},
-std::array<float,2>{0.301696956f, 0.977758646f},
-std::array<float,2>{0.585968733f, 0.138894886f},
-std::array<float,2>{0.881973803f, 0.573830009f},
-std::array<float,2>{0.137906f, 0.483407617f},
-std::array<float,2>{0.435231507f, 0.524490654f},
-std::array<float,2>{0.628513038f, 0.4261581f},
-std::array<float,2>{0.819714606f, 0.882369518f},
-std::array<float,2>{0.032216765f, 0.248767689f},
-std::array<float,2>{0.233623609f, 0.859657884f},
-std::array<float,2>{0.975573063f, 0.0226353351f},
-std::array<float,2>{0.525047719f, 0.662083209f},
-std::array<float,2>{0.348641127f, 0.31858471f},
-std::array<float,2>{0.125256792f, 0.71705687f},
-std::array<float,2>{0.885637701f, 0.297416598f},
-std::array<float,2>{0.580458522f, 0.77264452f},
-std::array<float,2>{0.310450256f, 0.12369132f},
-std::array<float,2>{0.462964445f, 0.950349092f},
-std::array<float,2>{0.703959763f, 0.175731838f},
-std::array<float,2>{0.802931428f, 0.593932569f},
-std::array<float,2>{0.0876514763f, 0.455106825f},
-std::array<float,2>{0.353558093f, 0.550024629f},
-std::array<float,2>{0.52024442f, 0.40567255f},
-std::array<float,2>{0.981135488f, 0.923388243f},
-std::array<float,2>{0.223492637f, 0.199843124f},
-std::array<float,2>{0.0421537608f, 0.821864188f},
-std::array<float,2>{0.823001325f, 0.0428968407f},
-std::array<float,2>{0.63630116f, 0.626032293f},
-std::array<float,2>{0.425515473f, 0.364473104f},
-std::array<float,2>{0.1130988f, 0.56664753f},
-std::array<float,2>{0.757826746f, 0.475690067f},
-std::array<float,2>{0.73938483f, 0.973512411f},
-std::array<float,2>{0.476021677f, 0.126507878f},
-std::array<float,2>{0.257270694f, 0.782936394f},
-std::array<float,2>{0.617478609f, 0.067700997f},
-std::array<float,2>{0.936487377f, 0.730677128f},
-std::array<float,2>{0.170963585f, 0.279319555f},
-std::array<float,2>{0.404129326f, 0.666894794f},
-std::array<float,2>{0.658243537f, 0.327658445f},
-std::array<float,2>{0.871548176f, 0.870587885f},
-std::array<float,2>{0.000753813714f, 0.0241937544f},
-std::array<float,2>{0.197183549f, 0.8873474f},
-std::array<float,2>{0.952791929f, 0.237529263f},
-std::array<float,2>{0.539749742f, 0.517950237f},
-std::array<float,2>{0.313872427f, 0.429946393f},
-std::array<float,2>{0.237863317f, 0.511274338f},
-std::array<float,2>{0.986511052f, 0.412397146f},
-std::array<float,2>{0.501163065f, 0.898518622f},
-std::array<float,2>{0.372489363f, 0.220740691f},
-std::array<float,2>{0.409142464f, 0.844538152f},
-std::array<float,2>{0.648615956f, 0.00419210829f},
-std::array<float,2>{0.830205083f, 0.672544539f},
-std::array<float,2>{0.051941596f, 0.339006245f},
-std::array<float,2>{0.28216067f, 0.743684828f},
-std::array<float,2>{0.576693952f, 0.264716864f},
-std::array<float,2>{0.901306272f, 0.810767591f},
-std::array<float,2>{0.142855331f, 0.0889060274f},
-std::array<float,2>{0.0717653036f, 0.989290297f},
-std::array<float,2>{0.795095205f, 0.141937226f},
-std::array<float,2>{0.690907598f, 0.58722645f},
-std::array<float,2>{0.449737161f, 0.49710083f},
-std::array<float,2>{0.016409738f, 0.643348932f},
-std::array<float,2>{0.853423476f, 0.347409397f},
-std::array<float,2>{0.672086f, 0.831521928f},
-std::array<float,2>{0.387421131f, 0.0470994525f},
-std::array<float,2>{0.343201369f, 0.908985198f},
-std::array<float,2>{0.547344327f, 0.213476449f},
-std::array<float,2>{0.960446835f, 0.545029104f},
-std::array<float,2>{0.210400969f, 0.38673538f},
-std::array<float,2>{0.48905769f, 0.621638536f},
-std::array<float,2>{0.731861591f, 0.450800925f},
-std::array<float,2>{0.773496866f, 0.96118784f},
-std::array<float,2>{0.0956227109f, 0.165394545f},
-std::array<float,2>{0.186512038f, 0.750617146f},
-std::array<float,2>{0.913920224f, 0.101560734f},
-std::array<float,2>{0.60781163f, 0.689172566f},
-std::array<float,2>{0.281100839f, 0.289704919f},
-std::array<float,2>{0.201674357f, 0.701330543f},
-std::array<float,2>{0.948505461f, 0.283453017f},
-std::array<float,2>{0.544163108f, 0.764486849f},
-std::array<float,2>{0.317222714f, 0.105213538f},
-std::array<float,2>{0.398966074f, 0.958385885f},
-std::array<float,2>{0.660994232f, 0.16207923f},
-std::array<float,2>{0.868103266f, 0.613928199f},
-std::array<float,2>{0.00519034499f, 0.442824602f},
-std::array<float,2>{0.252097845f, 0.533697128f},
-std::array<float,2>{0.622108757f, 0.377681226f},
-std::array<float,2>{0.933565378f, 0.915153086f},
-std::array<float,2>{0.16485624f, 0.205021784f},
-std::array<float,2>{0.117014661f, 0.837868571f},
-std::array<float,2>{0.76537621f, 0.0557278655f},
-std::array<float,2>{0.734510303f, 0.651019335f},
-std::array<float,2>{0.471939743f, 0.356866628f},
-std::array<float,2>{0.0468138009f, 0.580848277f},
-std::array<float,2>{0.826731563f, 0.4896442f},
-std::array<float,2>{0.638772905f, 0.998434782f},
-std::array<float,2>{0.427621245f, 0.150198415f},
-std::array<float,2>{0.355944633f, 0.799178183f},
-std::array<float,2>{0.517740548f, 0.0824976414f},
-std::array<float,2>{0.97915709f, 0.737911284f},
-std::array<float,2>{0.219697163f, 0.254525304f},
-std::array<float,2>{0.468617707f, 0.682429671f},
-std::array<float,2>{0.708725154f, 0.332329959f},
-std::array<float,2>{0.797951996f, 0.856151104f},
-std::array<float,2>{0.0917027891f, 0.0121743307f},
-std::array<float,2>{0.129846931f, 0.891671062f},
-std::array<float,2>{0.886786699f, 0.229035228f},
-std::array<float,2>{0.582313359f, 0.507024288f},
-std::array<float,2>{0.307232857f, 0.421283156f},
-std::array<float,2>{0.181594625f, 0.527910411f},
-std::array<float,2>{0.909614861f, 0.424425513f},
-std::array<float,2>{0.602353752f, 0.87853682f},
-std::array<float,2>{0.274235666f, 0.243526131f},
-std::array<float,2>{0.485786021f, 0.866586328f},
-std::array<float,2>{0.727848768f, 0.0167728849f},
-std::array<float,2>{0.781039834f, 0.657689631f},
-std::array<float,2>{0.0979332849f, 0.312571526f},
-std::array<float,2>{0.336540312f, 0.71965462f},
-std::array<float,2>{0.553001225f, 0.272505313f},
-std::array<float,2>{0.954402149f, 0.794168711f},
-std::array<float,2>{0.203713834f, 0.0744785517f},
-std::array<float,2>{0.0229699109f, 0.982604086f},
-std::array<float,2>{0.857743621f, 0.136007831f},
-std::array<float,2>{0.678667009f, 0.576716721f},
-std::array<float,2>{0.383236796f, 0.479718417f},
-std::array<float,2>{0.0743699297f, 0.633531392f},
-std::array<float,2>{0.789103448f, 0.373618364f},
-std::array<float,2>{0.694991291f, 0.815707088f},
-std::array<float,2>{0.446427912f, 0.0361305997f},
-std::array<float,2>{0.285693258f, 0.933682621f},
-std::array<float,2>{0.570586145f, 0.188238055f},
-std::array<float,2>{0.902708769f, 0.561201036f},
-std::array<float,2>{0.147600755f, 0.395597696f},
-std::array<float,2>{0.41385141f, 0.602991879f},
-std::array<float,2>{0.655071795f, 0.46761471f},
-std::array<float,2>{0.834143817f, 0.944018722f},
-std::array<float,2>{0.0499640927f, 0.186670169f},
-std::array<float,2>{0.240438402f, 0.77797544f},
-std::array<float,2>{0.989994228f, 0.112355851f},
-std::array<float,2>{0.506617069f, 0.706140757f},
-std::array<float,2>{0.36902374f, 0.307418436f},
-std::array<float,2>{0.155227989f, 0.670941293f},
-std::array<float,2>{0.893644929f, 0.321127087f},
-std::array<float,2>{0.564792156f, 0.871231735f},
-std::array<float,2>{0.295239508f, 0.0292397831f},
-std::array<float,2>{0.440128386f, 0.884355426f},
-std::array<float,2>{0.702729881f, 0.241993874f},
-std::array<float,2>{0.784750164f, 0.522758305f},
-std::array<float,2>{0.0664726272f, 0.434994757f},
-std::array<float,2>{0.364966035f, 0.565658927f},
-std::array<float,2>{0.508004069f, 0.47072199f},
-std::array<float,2>{0.993132651f, 0.970808446f},
-std::array<float,2>{0.247751415f, 0.129061997f},
-std::array<float,2>{0.0598586611f, 0.785188496f},
-std::array<float,2>{0.838160694f, 0.0627195388f},
-std::array<float,2>{0.647685766f, 0.729503453f},
-std::array<float,2>{0.415270954f, 0.274058908f},
-std::array<float,2>{0.107890487f, 0.553579867f},
-std::array<float,2>{0.770922601f, 0.399876297f},
-std::array<float,2>{0.72398442f, 0.927831769f},
-std::array<float,2>{0.495323539f, 0.198425546f},
-std::array<float,2>{0.267551094f, 0.825768292f},
-std::array<float,2>{0.597298265f, 0.0437531099f},
-std::array<float,2>{0.914180636f, 0.630459905f},
-std::array<float,2>{0.177365273f, 0.362278312f},
-std::array<float,2>{0.378154755f, 0.712628365f},
-std::array<float,2>{0.686225891f, 0.300873905f},
-std::array<float,2>{0.848831594f, 0.766474485f},
-std::array<float,2>{0.0296370015f, 0.121003307f},
-std::array<float,2>{0.21671015f, 0.946061492f},
-std::array<float,2>{0.961721897f, 0.179010674f},
-std::array<float,2>{0.557001054f, 0.600586891f},
-std::array<float,2>{0.329482645f, 0.460182816f},
-std::array<float,2>{0.228392482f, 0.61790508f},
-std::array<float,2>{0.972633779f, 0.445780545f},
-std::array<float,2>{0.529875815f, 0.966987491f},
-std::array<float,2>{0.345927328f, 0.171606511f},
-std::array<float,2>{0.433220774f, 0.757329762f},
-std::array<float,2>{0.629599094f, 0.0961851403f},
-std::array<float,2>{0.814464688f, 0.694383562f},
-std::array<float,2>{0.0353776552f, 0.296552867f},
-std::array<float,2>{0.297256529f, 0.645007432f},
-std::array<float,2>{0.590749681f, 0.351027578f},
-std::array<float,2>{0.876511574f, 0.833522022f},
-std::array<float,2>{0.133054912f, 0.0532907806f},
-std::array<float,2>{0.0857688636f, 0.911166191f},
-std::array<float,2>{0.809320271f, 0.21871376f},
-std::array<float,2>{0.713956833f, 0.540927172f},
-std::array<float,2>{0.453236431f, 0.385528654f},
-std::array<float,2>{0.0152415773f, 0.747325778f},
-std::array<float,2>{0.863715649f, 0.258492202f},
-std::array<float,2>{0.668693066f, 0.807072401f},
-std::array<float,2>{0.39200896f, 0.0909423456f},
-std::array<float,2>{0.325135708f, 0.984555602f},
-std::array<float,2>{0.537756264f, 0.145894647f},
-std::array<float,2>{0.94528693f, 0.593323886f},
-std::array<float,2>{0.194700658f, 0.493692696f},
-std::array<float,2>{0.481174737f, 0.514173567f},
-std::array<float,2>{0.748405337f, 0.408715397f},
-std::array<float,2>{0.75184077f, 0.903421879f},
-std::array<float,2>{0.123639211f, 0.224901959f},
-std::array<float,2>{0.162327886f, 0.849442959f},
-std::array<float,2>{0.922035873f, 0.000356200879f},
-std::array<float,2>{0.615336001f, 0.676413417f},
-std::array<float,2>{0.264365852f, 0.341697186f},
-std::array<float,2>{0.243628785f, 0.65344888f},
-std::array<float,2>{0.998486221f, 0.354633629f},
-std::array<float,2>{0.512584269f, 0.842865646f},
-std::array<float,2>{0.360527188f, 0.0610822178f},
-std::array<float,2>{0.419599682f, 0.921631038f},
-std::array<float,2>{0.643144429f, 0.207664058f},
-std::array<float,2>{0.840780675f, 0.535906136f},
-std::array<float,2>{0.0571296364f, 0.379752517f},
-std::array<float,2>{0.290202081f, 0.61078006f},
-std::array<float,2>{0.567099035f, 0.438247681f},
-std::array<float,2>{0.896215677f, 0.955409229f},
-std::array<float,2>{0.151872829f, 0.156444758f},
-std::array<float,2>{0.0641737506f, 0.758427978f},
-std::array<float,2>{0.786552906f, 0.108313218f},
-std::array<float,2>{0.698570013f, 0.698227346f},
-std::array<float,2>{0.443332523f, 0.286861986f},
-std::array<float,2>{0.025086347f, 0.503763437f},
-std::array<float,2>{0.84645462f, 0.416705757f},
-std::array<float,2>{0.682322264f, 0.898293912f},
-std::array<float,2>{0.381129384f, 0.232014522f},
-std::array<float,2>{0.335271984f, 0.854955673f},
-std::array<float,2>{0.561472952f, 0.00870106835f},
-std::array<float,2>{0.966517508f, 0.684871256f},
-std::array<float,2>{0.212221652f, 0.33169207f},
-std::array<float,2>{0.4977144f, 0.740785241f},
-std::array<float,2>{0.719654322f, 0.251432359f},
-std::array<float,2>{0.765921235f, 0.804582596f},
-std::array<float,2>{0.104122147f, 0.0795382261f},
-std::array<float,2>{0.173019439f, 0.993685961f},
-std::array<float,2>{0.919145465f, 0.155587599f},
-std::array<float,2>{0.60012728f, 0.582336605f},
-std::array<float,2>{0.269864947f, 0.484795243f},
-std::array<float,2>{0.140136927f, 0.570320785f},
-std::array<float,2>{0.880248547f, 0.481141955f},
-std::array<float,2>{0.589370966f, 0.979427278f},
-std::array<float,2>{0.303677112f, 0.137324527f},
-std::array<float,2>{0.457764953f, 0.789672852f},
-std::array<float,2>{0.716362774f, 0.0735445246f},
-std::array<float,2>{0.80730617f, 0.72450459f},
-std::array<float,2>{0.0802948102f, 0.266979665f},
-std::array<float,2>{0.351284444f, 0.664053023f},
-std::array<float,2>{0.526525497f, 0.318205267f},
-std::array<float,2>{0.973193884f, 0.861749411f},
-std::array<float,2>{0.23074463f, 0.0200154446f},
-std::array<float,2>{0.0336213149f, 0.879537165f},
-std::array<float,2>{0.817684531f, 0.247336149f},
-std::array<float,2>{0.62687856f, 0.526550531f},
-std::array<float,2>{0.436727852f, 0.427795649f},
-std::array<float,2>{0.119480588f, 0.709732652f},
-std::array<float,2>{0.755564511f, 0.310645878f},
-std::array<float,2>{0.742190838f, 0.775026917f},
-std::array<float,2>{0.478396833f, 0.113724217f},
-std::array<float,2>{0.258065462f, 0.939409614f},
-std::array<float,2>{0.61051631f, 0.183339551f},
-std::array<float,2>{0.9292472f, 0.607857943f},
-std::array<float,2>{0.157570168f, 0.46146822f},
-std::array<float,2>{0.398160964f, 0.555698812f},
-std::array<float,2>{0.667603552f, 0.391819775f},
-std::array<float,2>{0.861968398f, 0.932180941f},
-std::array<float,2>{0.00907423068f, 0.192928076f},
-std::array<float,2>{0.188053623f, 0.819504917f},
-std::array<float,2>{0.938908398f, 0.0313653424f},
-std::array<float,2>{0.534100592f, 0.63915813f},
-std::array<float,2>{0.322201818f, 0.370851994f},
-std::array<float,2>{0.168062031f, 0.73371917f},
-std::array<float,2>{0.933641315f, 0.27830264f},
-std::array<float,2>{0.620089054f, 0.783620894f},
-std::array<float,2>{0.254611492f, 0.0693343133f},
-std::array<float,2>{0.474182874f, 0.976045251f},
-std::array<float,2>{0.741815209f, 0.127107546f},
-std::array<float,2>{0.759873509f, 0.569819152f},
-std::array<float,2>{0.110711336f, 0.473534554f},
-std::array<float,2>{0.315990865f, 0.517410159f},
-std::array<float,2>{0.541052818f, 0.43182385f},
-std::array<float,2>{0.949337661f, 0.890401602f},
-std::array<float,2>{0.198101893f, 0.235095814f},
-std::array<float,2>{0.00201670406f, 0.867276847f},
-std::array<float,2>{0.874941707f, 0.0264913738f},
-std::array<float,2>{0.657659173f, 0.66462636f},
-std::array<float,2>{0.404575735f, 0.325183302f},
-std::array<float,2>{0.0879079252f, 0.597089112f},
-std::array<float,2>{0.802148402f, 0.453440964f},
-std::array<float,2>{0.70699501f, 0.951913297f},
-std::array<float,2>{0.4612692f, 0.17275396f},
-std::array<float,2>{0.311402768f, 0.769828081f},
-std::array<float,2>{0.579088926f, 0.121181764f},
-std::array<float,2>{0.884666026f, 0.716285586f},
-std::array<float,2>{0.127203584f, 0.300525963f},
-std::array<float,2>{0.421875566f, 0.627408504f},
-std::array<float,2>{0.634280562f, 0.366663784f},
-std::array<float,2>{0.821051657f, 0.824074328f},
-std::array<float,2>{0.0399254598f, 0.0404060334f},
-std::array<float,2>{0.225000158f, 0.92530036f},
-std::array<float,2>{0.984031022f, 0.201611906f},
-std::array<float,2>{0.522134304f, 0.547756076f},
-std::array<float,2>{0.352131456f, 0.40245685f},
-std::array<float,2>{0.208551913f, 0.543018878f},
-std::array<float,2>{0.957125962f, 0.389401287f},
-std::array<float,2>{0.549928963f, 0.90757519f},
-std::array<float,2>{0.341667861f, 0.211672023f},
-std::array<float,2>{0.390248001f, 0.828997791f},
-std::array<float,2>{0.675720334f, 0.049395673f},
-std::array<float,2>{0.854393423f, 0.641113937f},
-std::array<float,2>{0.0185360946f, 0.344851524f},
-std::array<float,2>{0.279257178f, 0.690960944f},
-std::array<float,2>{0.606203079f, 0.291470766f},
-std::array<float,2>{0.910806715f, 0.752840579f},
-std::array<float,2>{0.184065402f, 0.0981404632f},
-std::array<float,2>{0.0965465978f, 0.964736938f},
-std::array<float,2>{0.776934862f, 0.166553289f},
-std::array<float,2>{0.733718872f, 0.623138785f},
-std::array<float,2>{0.490710586f, 0.45193994f},
-std::array<float,2>{0.0540790148f, 0.675765336f},
-std::array<float,2>{0.8290326f, 0.336307019f},
-std::array<float,2>{0.652159154f, 0.847216845f},
-std::array<float,2>{0.407751888f, 0.00712226424f},
-std::array<float,2>{0.374296516f, 0.900525331f},
-std::array<float,2>{0.50301832f, 0.219840348f},
-std::array<float,2>{0.984815896f, 0.508849084f},
-std::array<float,2>{0.235210925f, 0.412007451f},
-std::array<float,2>{0.452994138f, 0.588938415f},
-std::array<float,2>{0.688482046f, 0.499399304f},
-std::array<float,2>{0.794356346f, 0.990816176f},
-std::array<float,2>{0.0728415251f, 0.143423676f},
-std::array<float,2>{0.141696572f, 0.808667064f},
-std::array<float,2>{0.90015924f, 0.0876408443f},
-std::array<float,2>{0.574585021f, 0.744191885f},
-std::array<float,2>{0.283350766f, 0.262151688f},
-std::array<float,2>{0.204634055f, 0.721226335f},
-std::array<float,2>{0.953514278f, 0.271377861f},
-std::array<float,2>{0.554233432f, 0.796769083f},
-std::array<float,2>{0.33722651f, 0.0774345621f},
-std::array<float,2>{0.383793652f, 0.980823278f},
-std::array<float,2>{0.679470062f, 0.133701235f},
-std::array<float,2>{0.85916537f, 0.576063931f},
-std::array<float,2>{0.022035839f, 0.478395492f},
-std::array<float,2>{0.274424106f, 0.529838383f},
-std::array<float,2>{0.603468597f, 0.423555076f},
-std::array<float,2>{0.908713877f, 0.876302898f},
-std::array<float,2>{0.180156961f, 0.245825484f},
-std::array<float,2>{0.0987046957f, 0.863901436f},
-std::array<float,2>{0.779300094f, 0.0187061727f},
-std::array<float,2>{0.727080464f, 0.659591258f},
-std::array<float,2>{0.485220522f, 0.315915614f},
-std::array<float,2>{0.0497454964f, 0.605415344f},
-std::array<float,2>{0.83503437f, 0.465162307f},
-std::array<float,2>{0.655517161f, 0.943209529f},
-std::array<float,2>{0.412678093f, 0.183613122f},
-std::array<float,2>{0.367546737f, 0.779354513f},
-std::array<float,2>{0.507470429f, 0.109972328f},
-std::array<float,2>{0.989054382f, 0.705060422f},
-std::array<float,2>{0.242070898f, 0.305224955f},
-std::array<float,2>{0.445936203f, 0.63581419f},
-std::array<float,2>{0.694137871f, 0.373018503f},
-std::array<float,2>{0.790224314f, 0.813697398f},
-std::array<float,2>{0.0757559985f, 0.0376023129f},
-std::array<float,2>{0.146527603f, 0.935892045f},
-std::array<float,2>{0.903734863f, 0.189581215f},
-std::array<float,2>{0.571530521f, 0.560358226f},
-std::array<float,2>{0.287025034f, 0.398001462f},
-std::array<float,2>{0.165182874f, 0.531709671f},
-std::array<float,2>{0.932520986f, 0.376430631f},
-std::array<float,2>{0.621271074f, 0.916312635f},
-std::array<float,2>{0.253444999f, 0.205373645f},
-std::array<float,2>{0.47081694f, 0.839685321f},
-std::array<float,2>{0.735990524f, 0.0566951707f},
-std::array<float,2>{0.763721287f, 0.649930835f},
-std::array<float,2>{0.115917563f, 0.358595461f},
-std::array<float,2>{0.317422241f, 0.699792802f},
-std::array<float,2>{0.543463111f, 0.281256914f},
-std::array<float,2>{0.947945595f, 0.763349533f},
-std::array<float,2>{0.20268023f, 0.101782344f},
-std::array<float,2>{0.00412926171f, 0.960568488f},
-std::array<float,2>{0.869070292f, 0.162365094f},
-std::array<float,2>{0.66143012f, 0.615791857f},
-std::array<float,2>{0.399734586f, 0.444662511f},
-std::array<float,2>{0.0902369395f, 0.67992276f},
-std::array<float,2>{0.797543406f, 0.334493458f},
-std::array<float,2>{0.707253575f, 0.857614338f},
-std::array<float,2>{0.467498749f, 0.0146900695f},
-std::array<float,2>{0.307803482f, 0.893306077f},
-std::array<float,2>{0.583190978f, 0.227794856f},
-std::array<float,2>{0.887936592f, 0.505442142f},
-std::array<float,2>{0.130750343f, 0.418685704f},
-std::array<float,2>{0.426312596f, 0.579278111f},
-std::array<float,2>{0.640389562f, 0.492142409f},
-std::array<float,2>{0.827451646f, 0.996503651f},
-std::array<float,2>{0.0458504632f, 0.151437163f},
-std::array<float,2>{0.220135882f, 0.797723651f},
-std::array<float,2>{0.979569554f, 0.0841468349f},
-std::array<float,2>{0.518681467f, 0.734648943f},
-std::array<float,2>{0.35662508f, 0.257464081f},
-std::array<float,2>{0.134116381f, 0.648172319f},
-std::array<float,2>{0.875035286f, 0.348910093f},
-std::array<float,2>{0.59132129f, 0.835847497f},
-std::array<float,2>{0.298558652f, 0.0511501431f},
-std::array<float,2>{0.454206914f, 0.913887978f},
-std::array<float,2>{0.713170648f, 0.216355339f},
-std::array<float,2>{0.809889138f, 0.541105866f},
-std::array<float,2>{0.0843436867f, 0.384643912f},
-std::array<float,2>{0.347033411f, 0.619843483f},
-std::array<float,2>{0.530632377f, 0.448269665f},
-std::array<float,2>{0.970871866f, 0.964957416f},
-std::array<float,2>{0.227324024f, 0.169517443f},
-std::array<float,2>{0.0361762717f, 0.755853415f},
-std::array<float,2>{0.815658391f, 0.0941714197f},
-std::array<float,2>{0.630301654f, 0.692528546f},
-std::array<float,2>{0.431668669f, 0.293392688f},
-std::array<float,2>{0.124927804f, 0.511767507f},
-std::array<float,2>{0.750228405f, 0.406910628f},
-std::array<float,2>{0.749809146f, 0.905625761f},
-std::array<float,2>{0.481713742f, 0.224281996f},
-std::array<float,2>{0.264673978f, 0.850408375f},
-std::array<float,2>{0.617166877f, 0.00196547923f},
-std::array<float,2>{0.923688769f, 0.679682553f},
-std::array<float,2>{0.163123325f, 0.342931658f},
-std::array<float,2>{0.390898257f, 0.7490502f},
-std::array<float,2>{0.669756114f, 0.261235535f},
-std::array<float,2>{0.864727497f, 0.806450725f},
-std::array<float,2>{0.0140851671f, 0.0930671915f},
-std::array<float,2>{0.193503216f, 0.987219512f},
-std::array<float,2>{0.943856657f, 0.148049369f},
-std::array<float,2>{0.538102865f, 0.591444671f},
-std::array<float,2>{0.325293809f, 0.494976491f},
-std::array<float,2>{0.246997178f, 0.564393163f},
-std::array<float,2>{0.993870497f, 0.469263792f},
-std::array<float,2>{0.508800268f, 0.969455719f},
-std::array<float,2>{0.363838285f, 0.132289767f},
-std::array<float,2>{0.414447159f, 0.787184834f},
-std::array<float,2>{0.647007585f, 0.0663743764f},
-std::array<float,2>{0.838989973f, 0.728485823f},
-std::array<float,2>{0.0594896674f, 0.276323199f},
-std::array<float,2>{0.29608655f, 0.668810725f},
-std::array<float,2>{0.565859318f, 0.322336137f},
-std::array<float,2>{0.892775118f, 0.874628544f},
-std::array<float,2>{0.156193078f, 0.0298160389f},
-std::array<float,2>{0.0679767877f, 0.886045396f},
-std::array<float,2>{0.784061372f, 0.240207016f},
-std::array<float,2>{0.701312125f, 0.520200193f},
-std::array<float,2>{0.44055444f, 0.435849369f},
-std::array<float,2>{0.0303099044f, 0.714235187f},
-std::array<float,2>{0.848131418f, 0.302883595f},
-std::array<float,2>{0.687260866f, 0.769291103f},
-std::array<float,2>{0.377858579f, 0.118392006f},
-std::array<float,2>{0.328352898f, 0.94823432f},
-std::array<float,2>{0.558264196f, 0.177629739f},
-std::array<float,2>{0.962563992f, 0.59856689f},
-std::array<float,2>{0.215236187f, 0.457532257f},
-std::array<float,2>{0.495073557f, 0.552541852f},
-std::array<float,2>{0.723418653f, 0.401974976f},
-std::array<float,2>{0.770286739f, 0.927624226f},
-std::array<float,2>{0.109299541f, 0.197168469f},
-std::array<float,2>{0.176618546f, 0.826231241f},
-std::array<float,2>{0.915600896f, 0.0458637513f},
-std::array<float,2>{0.596522748f, 0.631842256f},
-std::array<float,2>{0.266415775f, 0.359550714f},
-std::array<float,2>{0.23225148f, 0.660373569f},
-std::array<float,2>{0.973847806f, 0.320086449f},
-std::array<float,2>{0.525676072f, 0.861097991f},
-std::array<float,2>{0.350477666f, 0.0218671765f},
-std::array<float,2>{0.436185628f, 0.881772697f},
-std::array<float,2>{0.62510103f, 0.249634355f},
-std::array<float,2>{0.817066133f, 0.523967326f},
-std::array<float,2>{0.0344010107f, 0.427530378f},
-std::array<float,2>{0.303954422f, 0.573019922f},
-std::array<float,2>{0.588014662f, 0.48301205f},
-std::array<float,2>{0.878978074f, 0.977008224f},
-std::array<float,2>{0.139477342f, 0.139678374f},
-std::array<float,2>{0.0811877325f, 0.792386949f},
-std::array<float,2>{0.808179379f, 0.0704496056f},
-std::array<float,2>{0.715677261f, 0.724939287f},
-std::array<float,2>{0.458520591f, 0.267614037f},
-std::array<float,2>{0.00790797453f, 0.558132172f},
-std::array<float,2>{0.862877309f, 0.392803013f},
-std::array<float,2>{0.66659373f, 0.931319237f},
-std::array<float,2>{0.397345394f, 0.194428667f},
-std::array<float,2>{0.32108441f, 0.818117559f},
-std::array<float,2>{0.534198403f, 0.0336319134f},
-std::array<float,2>{0.937822044f, 0.637219489f},
-std::array<float,2>{0.188965529f, 0.368628979f},
-std::array<float,2>{0.476960152f, 0.707933605f},
-std::array<float,2>{0.743226767f, 0.30941236f},
-std::array<float,2>{0.75459528f, 0.776201189f},
-std::array<float,2>{0.120517597f, 0.116158068f},
-std::array<float,2>{0.156291753f, 0.940299273f},
-std::array<float,2>{0.928574026f, 0.18104732f},
-std::array<float,2>{0.610113382f, 0.606735468f},
-std::array<float,2>{0.259148747f, 0.463227689f},
-std::array<float,2>{0.151164725f, 0.612734556f},
-std::array<float,2>{0.895331681f, 0.441090614f},
-std::array<float,2>{0.56764406f, 0.955041707f},
-std::array<float,2>{0.289140463f, 0.159686655f},
-std::array<float,2>{0.44155255f, 0.760210872f},
-std::array<float,2>{0.69750905f, 0.105656326f},
-std::array<float,2>{0.785827518f, 0.696649671f},
-std::array<float,2>{0.0630213395f, 0.287900746f},
-std::array<float,2>{0.359549612f, 0.655260086f},
-std::array<float,2>{0.512815118f, 0.352759212f},
-std::array<float,2>{0.999031186f, 0.841136158f},
-std::array<float,2>{0.242508695f, 0.0592803843f},
-std::array<float,2>{0.0578693114f, 0.918958485f},
-std::array<float,2>{0.84140718f, 0.209574118f},
-std::array<float,2>{0.643752456f, 0.538463712f},
-std::array<float,2>{0.418333471f, 0.381859809f},
-std::array<float,2>{0.105046384f, 0.738934755f},
-std::array<float,2>{0.767464399f, 0.253115326f},
-std::array<float,2>{0.720617712f, 0.802553892f},
-std::array<float,2>{0.496618658f, 0.0816585124f},
-std::array<float,2>{0.271427959f, 0.995509684f},
-std::array<float,2>{0.601549327f, 0.152709126f},
-std::array<float,2>{0.918667495f, 0.584255815f},
-std::array<float,2>{0.172470361f, 0.487396091f},
-std::array<float,2>{0.38256076f, 0.500338495f},
-std::array<float,2>{0.683517218f, 0.414155662f},
-std::array<float,2>{0.847016096f, 0.895506501f},
-std::array<float,2>{0.0234539658f, 0.23309052f},
-std::array<float,2>{0.211587667f, 0.853266895f},
-std::array<float,2>{0.965331972f, 0.0101729017f},
-std::array<float,2>{0.561653733f, 0.686378241f},
-std::array<float,2>{0.334732562f, 0.329008967f},
-std::array<float,2>{0.185372084f, 0.687611878f},
-std::array<float,2>{0.911183178f, 0.290981501f},
-std::array<float,2>{0.606992722f, 0.75144279f},
-std::array<float,2>{0.27791661f, 0.0998295322f},
-std::array<float,2>{0.491756141f, 0.96246326f},
-std::array<float,2>{0.733333707f, 0.164069369f},
-std::array<float,2>{0.776299059f, 0.622375309f},
-std::array<float,2>{0.0970009044f, 0.450015724f},
-std::array<float,2>{0.340550423f, 0.546775222f},
-std::array<float,2>{0.549447894f, 0.387921929f},
-std::array<float,2>{0.958192408f, 0.909481645f},
-std::array<float,2>{0.207219109f, 0.21441181f},
-std::array<float,2>{0.0194171313f, 0.830211103f},
-std::array<float,2>{0.855404317f, 0.0486395173f},
-std::array<float,2>{0.674784482f, 0.644101381f},
-std::array<float,2>{0.389515609f, 0.346066356f},
-std::array<float,2>{0.0739326924f, 0.58662951f},
-std::array<float,2>{0.79369092f, 0.496610582f},
-std::array<float,2>{0.688269436f, 0.988655865f},
-std::array<float,2>{0.451662898f, 0.140956879f},
-std::array<float,2>{0.284653336f, 0.812367141f},
-std::array<float,2>{0.575977921f, 0.0882758424f},
-std::array<float,2>{0.89907521f, 0.74236697f},
-std::array<float,2>{0.141506553f, 0.263797879f},
-std::array<float,2>{0.406703681f, 0.673755407f},
-std::array<float,2>{0.650631487f, 0.338809848f},
-std::array<float,2>{0.829416633f, 0.844729125f},
-std::array<float,2>{0.0529435314f, 0.00582513772f},
-std::array<float,2>{0.236011982f, 0.899452627f},
-std::array<float,2>{0.985832214f, 0.221955851f},
-std::array<float,2>{0.502611041f, 0.510025442f},
-std::array<float,2>{0.373970568f, 0.41374889f},
-std::array<float,2>{0.199122459f, 0.518589914f},
-std::array<float,2>{0.950463772f, 0.431325316f},
-std::array<float,2>{0.542172909f, 0.888167739f},
-std::array<float,2>{0.315069705f, 0.237188861f},
-std::array<float,2>{0.405881137f, 0.86931181f},
-std::array<float,2>{0.656971991f, 0.024808431f},
-std::array<float,2>{0.873253763f, 0.667830348f},
-std::array<float,2>{0.00385750271f, 0.326368898f},
-std::array<float,2>{0.255614936f, 0.731445611f},
-std::array<float,2>{0.620470583f, 0.280778348f},
-std::array<float,2>{0.935326576f, 0.781733215f},
-std::array<float,2>{0.169673011f, 0.0665691942f},
-std::array<float,2>{0.109573573f, 0.974327087f},
-std::array<float,2>{0.761248648f, 0.125898093f},
-std::array<float,2>{0.740579963f, 0.568023741f},
-std::array<float,2>{0.473058343f, 0.474620223f},
-std::array<float,2>{0.0409313142f, 0.625373542f},
-std::array<float,2>{0.821436346f, 0.363519758f},
-std::array<float,2>{0.633282244f, 0.8211537f},
-std::array<float,2>{0.423653156f, 0.0411965363f},
-std::array<float,2>{0.353314668f, 0.922445595f},
-std::array<float,2>{0.522868156f, 0.200303346f},
-std::array<float,2>{0.98243773f, 0.549272656f},
-std::array<float,2>{0.226403043f, 0.404936522f},
-std::array<float,2>{0.462569743f, 0.59509784f},
-std::array<float,2>{0.705961406f, 0.456388146f},
-std::array<float,2>{0.800787628f, 0.949825346f},
-std::array<float,2>{0.089525573f, 0.17443493f},
-std::array<float,2>{0.12813881f, 0.772120178f},
-std::array<float,2>{0.883129537f, 0.124360435f},
-std::array<float,2>{0.580014586f, 0.718695939f},
-std::array<float,2>{0.312132269f, 0.298802555f},
-std::array<float,2>{0.238307983f, 0.705819368f},
-std::array<float,2>{0.991176963f, 0.308114439f},
-std::array<float,2>{0.505391002f, 0.779162943f},
-std::array<float,2>{0.370775193f, 0.111924179f},
-std::array<float,2>{0.411320329f, 0.944755375f},
-std::array<float,2>{0.653260648f, 0.186498329f},
-std::array<float,2>{0.832584381f, 0.602032781f},
-std::array<float,2>{0.0476881303f, 0.467960149f},
-std::array<float,2>{0.28829962f, 0.562137961f},
-std::array<float,2>{0.573787034f, 0.394910157f},
-std::array<float,2>{0.90607357f, 0.93516773f},
-std::array<float,2>{0.146444887f, 0.188541725f},
-std::array<float,2>{0.0775100291f, 0.814770937f},
-std::array<float,2>{0.791332901f, 0.036487285f},
-std::array<float,2>{0.691790521f, 0.634044349f},
-std::array<float,2>{0.448925316f, 0.374167323f},
-std::array<float,2>{0.0203836747f, 0.577381551f},
-std::array<float,2>{0.855788648f, 0.47933042f},
-std::array<float,2>{0.675792277f, 0.98340553f},
-std::array<float,2>{0.386229664f, 0.135509297f},
-std::array<float,2>{0.339459598f, 0.79307431f},
-std::array<float,2>{0.551414669f, 0.0759652406f},
-std::array<float,2>{0.956709862f, 0.720646679f},
-std::array<float,2>{0.206212834f, 0.27206099f},
-std::array<float,2>{0.486617893f, 0.656251609f},
-std::array<float,2>{0.728809834f, 0.313888609f},
-std::array<float,2>{0.778170705f, 0.865440011f},
-std::array<float,2>{0.0996117964f, 0.0160540324f},
-std::array<float,2>{0.183347821f, 0.877045512f},
-std::array<float,2>{0.90770787f, 0.2427288f},
-std::array<float,2>{0.604122519f, 0.529205322f},
-std::array<float,2>{0.275919676f, 0.425763875f},
-std::array<float,2>{0.132181078f, 0.506548166f},
-std::array<float,2>{0.88871181f, 0.420564473f},
-std::array<float,2>{0.584349096f, 0.890732229f},
-std::array<float,2>{0.305289358f, 0.22960417f},
-std::array<float,2>{0.465624899f, 0.856742561f},
-std::array<float,2>{0.709090054f, 0.0134375133f},
-std::array<float,2>{0.799525738f, 0.682961941f},
-std::array<float,2>{0.0933118761f, 0.333509833f},
-std::array<float,2>{0.359126389f, 0.737193525f},
-std::array<float,2>{0.515827119f, 0.254911333f},
-std::array<float,2>{0.97760874f, 0.800041556f},
-std::array<float,2>{0.221928209f, 0.0832172707f},
-std::array<float,2>{0.0448340103f, 0.999936163f},
-std::array<float,2>{0.824740827f, 0.149279267f},
-std::array<float,2>{0.63805896f, 0.581609964f},
-std::array<float,2>{0.428500265f, 0.488300443f},
-std::array<float,2>{0.115036897f, 0.651550293f},
-std::array<float,2>{0.762343109f, 0.355527878f},
-std::array<float,2>{0.737339795f, 0.836095214f},
-std::array<float,2>{0.470080078f, 0.0550391302f},
-std::array<float,2>{0.250249416f, 0.914120793f},
-std::array<float,2>{0.623836458f, 0.204063147f},
-std::array<float,2>{0.930072725f, 0.534966767f},
-std::array<float,2>{0.167229518f, 0.378302127f},
-std::array<float,2>{0.401594728f, 0.614389181f},
-std::array<float,2>{0.663476229f, 0.442326874f},
-std::array<float,2>{0.869848549f, 0.957646608f},
-std::array<float,2>{0.00705357036f, 0.160455957f},
-std::array<float,2>{0.199535593f, 0.764872611f},
-std::array<float,2>{0.945497692f, 0.103529386f},
-std::array<float,2>{0.546033084f, 0.702332437f},
-std::array<float,2>{0.318548441f, 0.284687281f},
-std::array<float,2>{0.161859363f, 0.6774382f},
-std::array<float,2>{0.925260425f, 0.34067741f},
-std::array<float,2>{0.614160061f, 0.848540843f},
-std::array<float,2>{0.262467742f, 0.0012919521f},
-std::array<float,2>{0.483926475f, 0.903067708f},
-std::array<float,2>{0.748012185f, 0.225718051f},
-std::array<float,2>{0.75358367f, 0.514680624f},
-std::array<float,2>{0.121803932f, 0.409505934f},
-std::array<float,2>{0.327707738f, 0.592614889f},
-std::array<float,2>{0.535225987f, 0.493008465f},
-std::array<float,2>{0.943129122f, 0.985516548f},
-std::array<float,2>{0.192825228f, 0.144573584f},
-std::array<float,2>{0.0120119425f, 0.808510184f},
-std::array<float,2>{0.865311384f, 0.0901593417f},
-std::array<float,2>{0.670146227f, 0.746718884f},
-std::array<float,2>{0.39388746f, 0.259637177f},
-std::array<float,2>{0.0834050402f, 0.539811194f},
-std::array<float,2>{0.812247753f, 0.38619107f},
-std::array<float,2>{0.711297095f, 0.910913944f},
-std::array<float,2>{0.455929756f, 0.217136294f},
-std::array<float,2>{0.299029797f, 0.832832873f},
-std::array<float,2>{0.59371376f, 0.0546292178f},
-std::array<float,2>{0.877994299f, 0.646428287f},
-std::array<float,2>{0.136372164f, 0.350291759f},
-std::array<float,2>{0.431135505f, 0.694052756f},
-std::array<float,2>{0.63086921f, 0.295761555f},
-std::array<float,2>{0.813417792f, 0.756702602f},
-std::array<float,2>{0.0371128321f, 0.0973682553f},
-std::array<float,2>{0.230405346f, 0.96791178f},
-std::array<float,2>{0.970381021f, 0.170287579f},
-std::array<float,2>{0.52860713f, 0.618215382f},
-std::array<float,2>{0.344314247f, 0.447246522f},
-std::array<float,2>{0.218593001f, 0.600483477f},
-std::array<float,2>{0.964591622f, 0.459886789f},
-std::array<float,2>{0.556116998f, 0.947023392f},
-std::array<float,2>{0.330125093f, 0.17823635f},
-std::array<float,2>{0.376182765f, 0.767265737f},
-std::array<float,2>{0.683829844f, 0.119356677f},
-std::array<float,2>{0.849784732f, 0.711424768f},
-std::array<float,2>{0.0283626411f, 0.302040786f},
-std::array<float,2>{0.26835829f, 0.629404843f},
-std::array<float,2>{0.594894528f, 0.363235056f},
-std::array<float,2>{0.917713165f, 0.824827373f},
-std::array<float,2>{0.178976417f, 0.0440114364f},
-std::array<float,2>{0.106775671f, 0.929392934f},
-std::array<float,2>{0.77193141f, 0.197748393f},
-std::array<float,2>{0.724958479f, 0.554107249f},
-std::array<float,2>{0.492583603f, 0.398497909f},
-std::array<float,2>{0.0610908903f, 0.729386926f},
-std::array<float,2>{0.836981654f, 0.274597734f},
-std::array<float,2>{0.645174861f, 0.786442757f},
-std::array<float,2>{0.416868448f, 0.0637095347f},
-std::array<float,2>{0.365697086f, 0.972231925f},
-std::array<float,2>{0.511222243f, 0.130150586f},
-std::array<float,2>{0.994472563f, 0.564864516f},
-std::array<float,2>{0.248232186f, 0.472514361f},
-std::array<float,2>{0.439246923f, 0.521738827f},
-std::array<float,2>{0.7004807f, 0.433991551f},
-std::array<float,2>{0.783043563f, 0.883532107f},
-std::array<float,2>{0.0686125681f, 0.240245938f},
-std::array<float,2>{0.153280452f, 0.872859776f},
-std::array<float,2>{0.892531753f, 0.0275967214f},
-std::array<float,2>{0.56373024f, 0.670055568f},
-std::array<float,2>{0.293913692f, 0.321649373f},
-std::array<float,2>{0.1894802f, 0.6396842f},
-std::array<float,2>{0.939905226f, 0.369235754f},
-std::array<float,2>{0.5327878f, 0.818481803f},
-std::array<float,2>{0.324058503f, 0.0322287008f},
-std::array<float,2>{0.394713074f, 0.933123052f},
-std::array<float,2>{0.664684474f, 0.191703856f},
-std::array<float,2>{0.861160815f, 0.555586159f},
-std::array<float,2>{0.0106467316f, 0.391543001f},
-std::array<float,2>{0.26034224f, 0.60869807f},
-std::array<float,2>{0.613252163f, 0.462092996f},
-std::array<float,2>{0.926151454f, 0.93802464f},
-std::array<float,2>{0.159715191f, 0.182186425f},
-std::array<float,2>{0.117402487f, 0.773939729f},
-std::array<float,2>{0.756020248f, 0.114680097f},
-std::array<float,2>{0.745073259f, 0.710898817f},
-std::array<float,2>{0.480425924f, 0.312010109f},
-std::array<float,2>{0.0324649289f, 0.525925159f},
-std::array<float,2>{0.81844914f, 0.429242373f},
-std::array<float,2>{0.627489507f, 0.880524695f},
-std::array<float,2>{0.434547573f, 0.246595889f},
-std::array<float,2>{0.347837776f, 0.862585902f},
-std::array<float,2>{0.523981512f, 0.0205389597f},
-std::array<float,2>{0.975851595f, 0.662270963f},
-std::array<float,2>{0.233183339f, 0.316757321f},
-std::array<float,2>{0.460432947f, 0.723288357f},
-std::array<float,2>{0.716987193f, 0.265706986f},
-std::array<float,2>{0.805770278f, 0.790691912f},
-std::array<float,2>{0.0785309225f, 0.0732095912f},
-std::array<float,2>{0.137584314f, 0.97961086f},
-std::array<float,2>{0.880860806f, 0.138185769f},
-std::array<float,2>{0.587566495f, 0.571631134f},
-std::array<float,2>{0.301790327f, 0.482106805f},
-std::array<float,2>{0.17576769f, 0.583724976f},
-std::array<float,2>{0.920148313f, 0.486151487f},
-std::array<float,2>{0.597888887f, 0.992497742f},
-std::array<float,2>{0.271560758f, 0.154466271f},
-std::array<float,2>{0.499583095f, 0.80287993f},
-std::array<float,2>{0.721911073f, 0.0785799995f},
-std::array<float,2>{0.768324673f, 0.741615355f},
-std::array<float,2>{0.103267975f, 0.250775605f},
-std::array<float,2>{0.333633095f, 0.684374332f},
-std::array<float,2>{0.559516847f, 0.330182463f},
-std::array<float,2>{0.968629062f, 0.854065835f},
-std::array<float,2>{0.213500276f, 0.00971380901f},
-std::array<float,2>{0.0271769781f, 0.897079825f},
-std::array<float,2>{0.844313025f, 0.23142612f},
-std::array<float,2>{0.680138409f, 0.502734721f},
-std::array<float,2>{0.38035512f, 0.417067438f},
-std::array<float,2>{0.0658440962f, 0.698822796f},
-std::array<float,2>{0.787300885f, 0.285485357f},
-std::array<float,2>{0.695454895f, 0.759062827f},
-std::array<float,2>{0.443584949f, 0.109114014f},
-std::array<float,2>{0.291787148f, 0.956711352f},
-std::array<float,2>{0.569585204f, 0.157392979f},
-std::array<float,2>{0.898225427f, 0.609636545f},
-std::array<float,2>{0.149729326f, 0.439149827f},
-std::array<float,2>{0.41996941f, 0.536659241f},
-std::array<float,2>{0.641960204f, 0.380041271f},
-std::array<float,2>{0.841901004f, 0.920820892f},
-std::array<float,2>{0.0548673309f, 0.208587244f},
-std::array<float,2>{0.245688885f, 0.842283726f},
-std::array<float,2>{0.997260213f, 0.0619919784f},
-std::array<float,2>{0.513808429f, 0.652873933f},
-std::array<float,2>{0.362750053f, 0.354021966f},
-std::array<float,2>{0.144192174f, 0.745693266f},
-std::array<float,2>{0.901783586f, 0.263111025f},
-std::array<float,2>{0.577771246f, 0.80988127f},
-std::array<float,2>{0.283008933f, 0.0862892047f},
-std::array<float,2>{0.450588703f, 0.991901994f},
-std::array<float,2>{0.689868212f, 0.143896893f},
-std::array<float,2>{0.796619594f, 0.588400662f},
-std::array<float,2>{0.0705325678f, 0.498330355f},
-std::array<float,2>{0.371520787f, 0.508738995f},
-std::array<float,2>{0.500830233f, 0.410240978f},
-std::array<float,2>{0.987678707f, 0.901942909f},
-std::array<float,2>{0.237245455f, 0.218942121f},
-std::array<float,2>{0.0511405766f, 0.846379757f},
-std::array<float,2>{0.831876934f, 0.00671698479f},
-std::array<float,2>{0.650042534f, 0.673965514f},
-std::array<float,2>{0.410090238f, 0.337611645f},
-std::array<float,2>{0.0944174603f, 0.624166012f},
-std::array<float,2>{0.774952769f, 0.452459574f},
-std::array<float,2>{0.731174767f, 0.963746727f},
-std::array<float,2>{0.489538401f, 0.167657554f},
-std::array<float,2>{0.280150533f, 0.753668189f},
-std::array<float,2>{0.609011233f, 0.0995768234f},
-std::array<float,2>{0.912325501f, 0.690106153f},
-std::array<float,2>{0.186951563f, 0.292256802f},
-std::array<float,2>{0.388072878f, 0.64243263f},
-std::array<float,2>{0.673149884f, 0.34405148f},
-std::array<float,2>{0.85160476f, 0.829668641f},
-std::array<float,2>{0.0168223195f, 0.0505593494f},
-std::array<float,2>{0.209613577f, 0.907096803f},
-std::array<float,2>{0.9593153f, 0.212478071f},
-std::array<float,2>{0.548678935f, 0.544285357f},
-std::array<float,2>{0.342749745f, 0.390425235f},
-std::array<float,2>{0.22417517f, 0.548026085f},
-std::array<float,2>{0.982293069f, 0.403753668f},
-std::array<float,2>{0.52055335f, 0.924425304f},
-std::array<float,2>{0.354931951f, 0.20303978f},
-std::array<float,2>{0.424241632f, 0.823056757f},
-std::array<float,2>{0.635521054f, 0.0395360328f},
-std::array<float,2>{0.823491871f, 0.62858808f},
-std::array<float,2>{0.0416742116f, 0.365341425f},
-std::array<float,2>{0.308801472f, 0.71546936f},
-std::array<float,2>{0.581971884f, 0.299403399f},
-std::array<float,2>{0.885928035f, 0.771114826f},
-std::array<float,2>{0.126259997f, 0.122234687f},
-std::array<float,2>{0.0864940658f, 0.95311904f},
-std::array<float,2>{0.804035604f, 0.172886372f},
-std::array<float,2>{0.704283953f, 0.596267164f},
-std::array<float,2>{0.464726388f, 0.45495221f},
-std::array<float,2>{0.00191208883f, 0.665142596f},
-std::array<float,2>{0.872120559f, 0.325763226f},
-std::array<float,2>{0.659346998f, 0.86863935f},
-std::array<float,2>{0.402414024f, 0.0260285567f},
-std::array<float,2>{0.313471675f, 0.889635682f},
-std::array<float,2>{0.540172994f, 0.235462755f},
-std::array<float,2>{0.952007592f, 0.516267717f},
-std::array<float,2>{0.195515871f, 0.433219939f},
-std::array<float,2>{0.475473762f, 0.569282174f},
-std::array<float,2>{0.738967597f, 0.473935664f},
-std::array<float,2>{0.759437799f, 0.974668801f},
-std::array<float,2>{0.111335777f, 0.128295407f},
-std::array<float,2>{0.170808285f, 0.784985662f},
-std::array<float,2>{0.937409878f, 0.0698121935f},
-std::array<float,2>{0.618875384f, 0.732850313f},
-std::array<float,2>{0.256654888f, 0.279171467f},
-std::array<float,2>{0.248569891f, 0.727733612f},
-std::array<float,2>{0.995042682f, 0.275792152f},
-std::array<float,2>{0.511268854f, 0.787934422f},
-std::array<float,2>{0.365865618f, 0.0655133575f},
-std::array<float,2>{0.416192561f, 0.968913555f},
-std::array<float,2>{0.644651711f, 0.132795841f},
-std::array<float,2>{0.837648332f, 0.563827515f},
-std::array<float,2>{0.060557954f, 0.468903154f},
-std::array<float,2>{0.293274373f, 0.520006359f},
-std::array<float,2>{0.563970029f, 0.43617326f},
-std::array<float,2>{0.891912222f, 0.886342525f},
-std::array<float,2>{0.152409017f, 0.239674449f},
-std::array<float,2>{0.0689237416f, 0.874492407f},
-std::array<float,2>{0.782364428f, 0.0296132546f},
-std::array<float,2>{0.701006711f, 0.668452263f},
-std::array<float,2>{0.438828796f, 0.322787285f},
-std::array<float,2>{0.029163463f, 0.59795332f},
-std::array<float,2>{0.850102007f, 0.457379013f},
-std::array<float,2>{0.684155941f, 0.947280526f},
-std::array<float,2>{0.376508296f, 0.176777124f},
-std::array<float,2>{0.330733865f, 0.768669188f},
-std::array<float,2>{0.556300581f, 0.118717074f},
-std::array<float,2>{0.96430105f, 0.714679062f},
-std::array<float,2>{0.218151689f, 0.303689271f},
-std::array<float,2>{0.492878646f, 0.632474601f},
-std::array<float,2>{0.725128651f, 0.360093266f},
-std::array<float,2>{0.772239864f, 0.827054262f},
-std::array<float,2>{0.107022442f, 0.0452335142f},
-std::array<float,2>{0.179580182f, 0.927236617f},
-std::array<float,2>{0.917006075f, 0.196617126f},
-std::array<float,2>{0.595434904f, 0.552102506f},
-std::array<float,2>{0.267653853f, 0.401382238f},
-std::array<float,2>{0.136078387f, 0.541766644f},
-std::array<float,2>{0.878582835f, 0.383814335f},
-std::array<float,2>{0.593218446f, 0.913116872f},
-std::array<float,2>{0.299469888f, 0.215870425f},
-std::array<float,2>{0.45553115f, 0.835059822f},
-std::array<float,2>{0.7116521f, 0.0514742173f},
-std::array<float,2>{0.811643541f, 0.647511899f},
-std::array<float,2>{0.0836181492f, 0.34925282f},
-std::array<float,2>{0.343883902f, 0.693247437f},
-std::array<float,2>{0.528980851f, 0.29360345f},
-std::array<float,2>{0.970152497f, 0.754950166f},
-std::array<float,2>{0.229953364f, 0.0943844989f},
-std::array<float,2>{0.037826255f, 0.965433955f},
-std::array<float,2>{0.812953115f, 0.169160351f},
-std::array<float,2>{0.631379008f, 0.619387507f},
-std::array<float,2>{0.431462735f, 0.448942512f},
-std::array<float,2>{0.121200927f, 0.678895891f},
-std::array<float,2>{0.75340867f, 0.343319088f},
-std::array<float,2>{0.747162938f, 0.8496328f},
-std::array<float,2>{0.483822018f, 0.00247423048f},
-std::array<float,2>{0.261839509f, 0.905813575f},
-std::array<float,2>{0.613360405f, 0.223873883f},
-std::array<float,2>{0.925485432f, 0.512318134f},
-std::array<float,2>{0.161157727f, 0.406347603f},
-std::array<float,2>{0.39410466f, 0.591112673f},
-std::array<float,2>{0.670535803f, 0.494584441f},
-std::array<float,2>{0.866195202f, 0.986767709f},
-std::array<float,2>{0.0125771025f, 0.147687957f},
-std::array<float,2>{0.193174943f, 0.805760145f},
-std::array<float,2>{0.942839622f, 0.0936145112f},
-std::array<float,2>{0.535746038f, 0.749596417f},
-std::array<float,2>{0.327349603f, 0.260836452f},
-std::array<float,2>{0.167767763f, 0.649616241f},
-std::array<float,2>{0.930302262f, 0.358928829f},
-std::array<float,2>{0.623061776f, 0.838971317f},
-std::array<float,2>{0.250907183f, 0.057412602f},
-std::array<float,2>{0.470523924f, 0.916923881f},
-std::array<float,2>{0.738054633f, 0.20603773f},
-std::array<float,2>{0.762095809f, 0.532118618f},
-std::array<float,2>{0.114597246f, 0.376819342f},
-std::array<float,2>{0.318906307f, 0.615634561f},
-std::array<float,2>{0.54648447f, 0.445191801f},
-std::array<float,2>{0.946215749f, 0.960087478f},
-std::array<float,2>{0.199767813f, 0.162941724f},
-std::array<float,2>{0.00756268669f, 0.763120413f},
-std::array<float,2>{0.86923492f, 0.102396145f},
-std::array<float,2>{0.663915336f, 0.699416101f},
-std::array<float,2>{0.401907146f, 0.282028437f},
-std::array<float,2>{0.0928734839f, 0.505115211f},
-std::array<float,2>{0.799014807f, 0.418340504f},
-std::array<float,2>{0.709879696f, 0.893046319f},
-std::array<float,2>{0.4651016f, 0.228060231f},
-std::array<float,2>{0.30513674f, 0.858033538f},
-std::array<float,2>{0.584628165f, 0.0152429603f},
-std::array<float,2>{0.889174819f, 0.680619061f},
-std::array<float,2>{0.132382601f, 0.334468573f},
-std::array<float,2>{0.427862436f, 0.735104382f},
-std::array<float,2>{0.638626456f, 0.257009745f},
-std::array<float,2>{0.824247241f, 0.797143102f},
-std::array<float,2>{0.0443008542f, 0.0846657455f},
-std::array<float,2>{0.222423151f, 0.996644139f},
-std::array<float,2>{0.978078485f, 0.151985362f},
-std::array<float,2>{0.516321361f, 0.579743922f},
-std::array<float,2>{0.358623177f, 0.491655707f},
-std::array<float,2>{0.206866086f, 0.575244009f},
-std::array<float,2>{0.956058562f, 0.477887481f},
-std::array<float,2>{0.551020026f, 0.981014609f},
-std::array<float,2>{0.339179069f, 0.132870972f},
-std::array<float,2>{0.386369437f, 0.796324372f},
-std::array<float,2>{0.676384509f, 0.0780529901f},
-std::array<float,2>{0.856097996f, 0.720755219f},
-std::array<float,2>{0.0195621885f, 0.270626158f},
-std::array<float,2>{0.275701225f, 0.659723461f},
-std::array<float,2>{0.603847206f, 0.316329122f},
-std::array<float,2>{0.908133626f, 0.863503397f},
-std::array<float,2>{0.182653278f, 0.019110525f},
-std::array<float,2>{0.100334175f, 0.876594722f},
-std::array<float,2>{0.777459741f, 0.245186985f},
-std::array<float,2>{0.729370773f, 0.529598832f},
-std::array<float,2>{0.486977845f, 0.423145801f},
-std::array<float,2>{0.0473029539f, 0.704230368f},
-std::array<float,2>{0.832333326f, 0.305071861f},
-std::array<float,2>{0.652504683f, 0.780194044f},
-std::array<float,2>{0.411767662f, 0.109562226f},
-std::array<float,2>{0.370244622f, 0.942406058f},
-std::array<float,2>{0.505191624f, 0.184160501f},
-std::array<float,2>{0.990341783f, 0.604833663f},
-std::array<float,2>{0.239216626f, 0.465587914f},
-std::array<float,2>{0.448540449f, 0.559823871f},
-std::array<float,2>{0.692138433f, 0.397794545f},
-std::array<float,2>{0.791553259f, 0.936360538f},
-std::array<float,2>{0.0779289231f, 0.190294191f},
-std::array<float,2>{0.145531818f, 0.81413132f},
-std::array<float,2>{0.90532279f, 0.0375835933f},
-std::array<float,2>{0.573717833f, 0.636581957f},
-std::array<float,2>{0.288904965f, 0.37244767f},
-std::array<float,2>{0.196033806f, 0.667110801f},
-std::array<float,2>{0.951443374f, 0.326999068f},
-std::array<float,2>{0.540992916f, 0.869720221f},
-std::array<float,2>{0.312602401f, 0.024913365f},
-std::array<float,2>{0.403112948f, 0.888604581f},
-std::array<float,2>{0.659865141f, 0.236775815f},
-std::array<float,2>{0.872740448f, 0.519309938f},
-std::array<float,2>{0.00117762538f, 0.430862248f},
-std::array<float,2>{0.256234884f, 0.567810535f},
-std::array<float,2>{0.618317068f, 0.475263864f},
-std::array<float,2>{0.936704755f, 0.97408551f},
-std::array<float,2>{0.169959709f, 0.125403866f},
-std::array<float,2>{0.112198301f, 0.781938493f},
-std::array<float,2>{0.758998454f, 0.0670848563f},
-std::array<float,2>{0.738647282f, 0.731942594f},
-std::array<float,2>{0.474762291f, 0.280285805f},
-std::array<float,2>{0.0414742678f, 0.549435437f},
-std::array<float,2>{0.824135423f, 0.40457049f},
-std::array<float,2>{0.634812534f, 0.921997607f},
-std::array<float,2>{0.424395055f, 0.201137632f},
-std::array<float,2>{0.35524264f, 0.820762515f},
-std::array<float,2>{0.52111572f, 0.041551657f},
-std::array<float,2>{0.981660783f, 0.625702202f},
-std::array<float,2>{0.2238262f, 0.364100695f},
-std::array<float,2>{0.464179009f, 0.717790306f},
-std::array<float,2>{0.704879045f, 0.298285633f},
-std::array<float,2>{0.80449456f, 0.771967053f},
-std::array<float,2>{0.0859450474f, 0.124656156f},
-std::array<float,2>{0.126617998f, 0.949506938f},
-std::array<float,2>{0.886696637f, 0.174015656f},
-std::array<float,2>{0.581097186f, 0.595229208f},
-std::array<float,2>{0.309400618f, 0.457016855f},
-std::array<float,2>{0.187016919f, 0.622635603f},
-std::array<float,2>{0.912661791f, 0.449528217f},
-std::array<float,2>{0.608501434f, 0.962265551f},
-std::array<float,2>{0.279415935f, 0.164594024f},
-std::array<float,2>{0.489866585f, 0.751671493f},
-std::array<float,2>{0.730603874f, 0.100248903f},
-std::array<float,2>{0.774662256f, 0.6881935f},
-std::array<float,2>{0.094202511f, 0.290278465f},
-std::array<float,2>{0.341932654f, 0.643920779f},
-std::array<float,2>{0.548263907f, 0.346225619f},
-std::array<float,2>{0.959586859f, 0.830893576f},
-std::array<float,2>{0.209303975f, 0.0480600707f},
-std::array<float,2>{0.0175090376f, 0.91006881f},
-std::array<float,2>{0.852400601f, 0.213968486f},
-std::array<float,2>{0.673776984f, 0.546272397f},
-std::array<float,2>{0.388629973f, 0.388375849f},
-std::array<float,2>{0.0712038055f, 0.742776155f},
-std::array<float,2>{0.796098709f, 0.264316142f},
-std::array<float,2>{0.690204799f, 0.811728835f},
-std::array<float,2>{0.450781047f, 0.0883829594f},
-std::array<float,2>{0.282290548f, 0.989165187f},
-std::array<float,2>{0.577326655f, 0.141404226f},
-std::array<float,2>{0.901884556f, 0.586217701f},
-std::array<float,2>{0.143838614f, 0.496497422f},
-std::array<float,2>{0.409554303f, 0.510727286f},
-std::array<float,2>{0.6497702f, 0.413111776f},
-std::array<float,2>{0.831368208f, 0.900389493f},
-std::array<float,2>{0.0514809676f, 0.222566396f},
-std::array<float,2>{0.236353442f, 0.845542371f},
-std::array<float,2>{0.988005579f, 0.00531902537f},
-std::array<float,2>{0.500356734f, 0.673230946f},
-std::array<float,2>{0.371887267f, 0.338084966f},
-std::array<float,2>{0.150304839f, 0.697253406f},
-std::array<float,2>{0.897642672f, 0.287136585f},
-std::array<float,2>{0.57029593f, 0.760389149f},
-std::array<float,2>{0.291259229f, 0.106355399f},
-std::array<float,2>{0.444149882f, 0.954357445f},
-std::array<float,2>{0.696053684f, 0.159353837f},
-std::array<float,2>{0.78771615f, 0.612811923f},
-std::array<float,2>{0.0662023574f, 0.440714598f},
-std::array<float,2>{0.363254428f, 0.538618624f},
-std::array<float,2>{0.51457572f, 0.382671565f},
-std::array<float,2>{0.998045802f, 0.919803858f},
-std::array<float,2>{0.245415986f, 0.209034115f},
-std::array<float,2>{0.055662103f, 0.841400325f},
-std::array<float,2>{0.84262675f, 0.058773689f},
-std::array<float,2>{0.642220438f, 0.65464139f},
-std::array<float,2>{0.42074272f, 0.353264451f},
-std::array<float,2>{0.102715358f, 0.584774554f},
-std::array<float,2>{0.767791212f, 0.487976491f},
-std::array<float,2>{0.722443342f, 0.995884955f},
-std::array<float,2>{0.499069989f, 0.153131515f},
-std::array<float,2>{0.272278011f, 0.801954746f},
-std::array<float,2>{0.598428726f, 0.0813665092f},
-std::array<float,2>{0.920501411f, 0.738427341f},
-std::array<float,2>{0.174933389f, 0.253480703f},
-std::array<float,2>{0.380853653f, 0.685587943f},
-std::array<float,2>{0.680323124f, 0.32858032f},
-std::array<float,2>{0.843813956f, 0.852899492f},
-std::array<float,2>{0.0266574379f, 0.0106161209f},
-std::array<float,2>{0.212938324f, 0.894636095f},
-std::array<float,2>{0.967903495f, 0.232721865f},
-std::array<float,2>{0.559032619f, 0.500898004f},
-std::array<float,2>{0.333099157f, 0.414933056f},
-std::array<float,2>{0.232597753f, 0.523497939f},
-std::array<float,2>{0.976226926f, 0.427079171f},
-std::array<float,2>{0.523444891f, 0.881180048f},
-std::array<float,2>{0.348511368f, 0.249260783f},
-std::array<float,2>{0.434069484f, 0.860627711f},
-std::array<float,2>{0.627409935f, 0.0220657252f},
-std::array<float,2>{0.818958282f, 0.660975039f},
-std::array<float,2>{0.0331207179f, 0.319488406f},
-std::array<float,2>{0.302280247f, 0.725145876f},
-std::array<float,2>{0.587284684f, 0.268158317f},
-std::array<float,2>{0.881591141f, 0.792830527f},
-std::array<float,2>{0.137017816f, 0.0708559826f},
-std::array<float,2>{0.0786890686f, 0.977495193f},
-std::array<float,2>{0.806286693f, 0.140230253f},
-std::array<float,2>{0.717519641f, 0.572384417f},
-std::array<float,2>{0.460515738f, 0.482472181f},
-std::array<float,2>{0.0101312604f, 0.637041748f},
-std::array<float,2>{0.860720992f, 0.368906081f},
-std::array<float,2>{0.664403677f, 0.817681968f},
-std::array<float,2>{0.395082951f, 0.0336948819f},
-std::array<float,2>{0.32325229f, 0.930705369f},
-std::array<float,2>{0.53227216f, 0.195202857f},
-std::array<float,2>{0.940373003f, 0.558077037f},
-std::array<float,2>{0.190299273f, 0.393137097f},
-std::array<float,2>{0.479549974f, 0.607292473f},
-std::array<float,2>{0.744599938f, 0.463570088f},
-std::array<float,2>{0.756701291f, 0.939656258f},
-std::array<float,2>{0.117916554f, 0.181200564f},
-std::array<float,2>{0.159465879f, 0.775642812f},
-std::array<float,2>{0.92659539f, 0.115422472f},
-std::array<float,2>{0.612586319f, 0.707074404f},
-std::array<float,2>{0.25981459f, 0.308833927f},
-std::array<float,2>{0.21536988f, 0.711570978f},
-std::array<float,2>{0.962346792f, 0.302359492f},
-std::array<float,2>{0.557689309f, 0.766854346f},
-std::array<float,2>{0.329074919f, 0.120019488f},
-std::array<float,2>{0.377162516f, 0.946752965f},
-std::array<float,2>{0.686701179f, 0.178132206f},
-std::array<float,2>{0.848278105f, 0.599652112f},
-std::array<float,2>{0.0310842991f, 0.4590891f},
-std::array<float,2>{0.265879065f, 0.554573178f},
-std::array<float,2>{0.596135318f, 0.399192572f},
-std::array<float,2>{0.915498853f, 0.9291749f},
-std::array<float,2>{0.176265433f, 0.197772071f},
-std::array<float,2>{0.108584672f, 0.824550629f},
-std::array<float,2>{0.769936204f, 0.0445779637f},
-std::array<float,2>{0.722951174f, 0.629294753f},
-std::array<float,2>{0.494362742f, 0.362681657f},
-std::array<float,2>{0.0588978641f, 0.565284491f},
-std::array<float,2>{0.839527845f, 0.471850038f},
-std::array<float,2>{0.646661282f, 0.972159863f},
-std::array<float,2>{0.4146626f, 0.130394608f},
-std::array<float,2>{0.363610983f, 0.786912441f},
-std::array<float,2>{0.509671271f, 0.0640625805f},
-std::array<float,2>{0.993192255f, 0.728602707f},
-std::array<float,2>{0.246560022f, 0.275040448f},
-std::array<float,2>{0.44101733f, 0.67078042f},
-std::array<float,2>{0.701792657f, 0.321996838f},
-std::array<float,2>{0.783554912f, 0.872538507f},
-std::array<float,2>{0.0675579607f, 0.0279033817f},
-std::array<float,2>{0.15539366f, 0.882906616f},
-std::array<float,2>{0.89351058f, 0.240773395f},
-std::array<float,2>{0.566060126f, 0.522255659f},
-std::array<float,2>{0.296439916f, 0.434184045f},
-std::array<float,2>{0.163633645f, 0.515181601f},
-std::array<float,2>{0.923327506f, 0.409730047f},
-std::array<float,2>{0.6162287f, 0.902402282f},
-std::array<float,2>{0.265320659f, 0.226302356f},
-std::array<float,2>{0.482382387f, 0.847883344f},
-std::array<float,2>{0.74949199f, 0.00189372944f},
-std::array<float,2>{0.750563622f, 0.677094996f},
-std::array<float,2>{0.124196999f, 0.339996547f},
-std::array<float,2>{0.326106578f, 0.746154547f},
-std::array<float,2>{0.538853705f, 0.2588889f},
-std::array<float,2>{0.943558514f, 0.807911098f},
-std::array<float,2>{0.194227889f, 0.090533644f},
-std::array<float,2>{0.0143816657f, 0.985887289f},
-std::array<float,2>{0.865151227f, 0.145088226f},
-std::array<float,2>{0.669207275f, 0.5919227f},
-std::array<float,2>{0.391155899f, 0.492530733f},
-std::array<float,2>{0.0848198161f, 0.645635188f},
-std::array<float,2>{0.810458899f, 0.350087434f},
-std::array<float,2>{0.713556767f, 0.83236587f},
-std::array<float,2>{0.454903692f, 0.0541605428f},
-std::array<float,2>{0.297952533f, 0.910500824f},
-std::array<float,2>{0.591303706f, 0.217572987f},
-std::array<float,2>{0.875771821f, 0.539390385f},
-std::array<float,2>{0.134406701f, 0.386284232f},
-std::array<float,2>{0.432197809f, 0.618867457f},
-std::array<float,2>{0.630567491f, 0.446412623f},
-std::array<float,2>{0.816369951f, 0.968577921f},
-std::array<float,2>{0.0370050184f, 0.170611113f},
-std::array<float,2>{0.226912796f, 0.755960703f},
-std::array<float,2>{0.971674979f, 0.0968750939f},
-std::array<float,2>{0.53119576f, 0.693676054f},
-std::array<float,2>{0.347513586f, 0.295372784f},
-std::array<float,2>{0.130164027f, 0.683407009f},
-std::array<float,2>{0.888301075f, 0.333430231f},
-std::array<float,2>{0.583690464f, 0.857234836f},
-std::array<float,2>{0.308453858f, 0.0128657976f},
-std::array<float,2>{0.467173427f, 0.891421854f},
-std::array<float,2>{0.707732499f, 0.230318531f},
-std::array<float,2>{0.797098875f, 0.50619328f},
-std::array<float,2>{0.0904240981f, 0.420096785f},
-std::array<float,2>{0.357235789f, 0.581063628f},
-std::array<float,2>{0.51918298f, 0.488782793f},
-std::array<float,2>{0.980370224f, 0.999104977f},
-std::array<float,2>{0.22029005f, 0.148602113f},
-std::array<float,2>{0.0450020172f, 0.800460637f},
-std::array<float,2>{0.827933073f, 0.083764717f},
-std::array<float,2>{0.639950335f, 0.736706436f},
-std::array<float,2>{0.4259395f, 0.255645514f},
-std::array<float,2>{0.115324117f, 0.534602106f},
-std::array<float,2>{0.764430225f, 0.378829807f},
-std::array<float,2>{0.735563397f, 0.915031493f},
-std::array<float,2>{0.471460342f, 0.203336239f},
-std::array<float,2>{0.252969384f, 0.836814344f},
-std::array<float,2>{0.621690512f, 0.0552292541f},
-std::array<float,2>{0.931794882f, 0.652340949f},
-std::array<float,2>{0.165599555f, 0.356226236f},
-std::array<float,2>{0.400135249f, 0.70268929f},
-std::array<float,2>{0.661900222f, 0.28447631f},
-std::array<float,2>{0.868251443f, 0.765329063f},
-std::array<float,2>{0.00464662584f, 0.104370877f},
-std::array<float,2>{0.202443883f, 0.957121313f},
-std::array<float,2>{0.947614074f, 0.161052614f},
-std::array<float,2>{0.5434407f, 0.615104914f},
-std::array<float,2>{0.318150908f, 0.441427112f},
-std::array<float,2>{0.241422221f, 0.602062941f},
-std::array<float,2>{0.988305032f, 0.468467295f},
-std::array<float,2>{0.507246673f, 0.945085526f},
-std::array<float,2>{0.36776191f, 0.185895875f},
-std::array<float,2>{0.412498116f, 0.778727174f},
-std::array<float,2>{0.655797839f, 0.111807898f},
-std::array<float,2>{0.835471332f, 0.70553422f},
-std::array<float,2>{0.0489738397f, 0.30800873f},
-std::array<float,2>{0.286286294f, 0.634732783f},
-std::array<float,2>{0.572081864f, 0.374635369f},
-std::array<float,2>{0.903981626f, 0.814988732f},
-std::array<float,2>{0.14700155f, 0.0366347991f},
-std::array<float,2>{0.0756723136f, 0.934908867f},
-std::array<float,2>{0.790974438f, 0.189203024f},
-std::array<float,2>{0.693399608f, 0.561773181f},
-std::array<float,2>{0.445742965f, 0.395275503f},
-std::array<float,2>{0.0219042599f, 0.720145166f},
-std::array<float,2>{0.858603597f, 0.271488965f},
-std::array<float,2>{0.678910375f, 0.793944895f},
-std::array<float,2>{0.384696066f, 0.0754382014f},
-std::array<float,2>{0.33764264f, 0.984268188f},
-std::array<float,2>{0.554104805f, 0.135094121f},
-std::array<float,2>{0.953923047f, 0.577763498f},
-std::array<float,2>{0.204573393f, 0.478974462f},
-std::array<float,2>{0.484398127f, 0.528401196f},
-std::array<float,2>{0.726723909f, 0.425240636f},
-std::array<float,2>{0.780118167f, 0.877584279f},
-std::array<float,2>{0.0994708687f, 0.242364019f},
-std::array<float,2>{0.180329829f, 0.865768254f},
-std::array<float,2>{0.9082219f, 0.0165153854f},
-std::array<float,2>{0.602721393f, 0.656979382f},
-std::array<float,2>{0.27512005f, 0.314229906f},
-std::array<float,2>{0.225985304f, 0.62805146f},
-std::array<float,2>{0.982988179f, 0.365900904f},
-std::array<float,2>{0.523086905f, 0.822733819f},
-std::array<float,2>{0.352688223f, 0.0397270434f},
-std::array<float,2>{0.422957897f, 0.92428261f},
-std::array<float,2>{0.633750021f, 0.202544242f},
-std::array<float,2>{0.822223306f, 0.548469841f},
-std::array<float,2>{0.040161401f, 0.404008269f},
-std::array<float,2>{0.311595559f, 0.596166313f},
-std::array<float,2>{0.579393446f, 0.454130203f},
-std::array<float,2>{0.883703649f, 0.952387214f},
-std::array<float,2>{0.128475472f, 0.173477978f},
-std::array<float,2>{0.0889223069f, 0.770649552f},
-std::array<float,2>{0.801446319f, 0.122993298f},
-std::array<float,2>{0.705451369f, 0.714919269f},
-std::array<float,2>{0.462074488f, 0.299266994f},
-std::array<float,2>{0.00332270982f, 0.515851557f},
-std::array<float,2>{0.873878539f, 0.433068544f},
-std::array<float,2>{0.656336844f, 0.88890481f},
-std::array<float,2>{0.405758023f, 0.236231834f},
-std::array<float,2>{0.314656079f, 0.868918002f},
-std::array<float,2>{0.542537391f, 0.0256332047f},
-std::array<float,2>{0.951071382f, 0.665696204f},
-std::array<float,2>{0.198479518f, 0.325416625f},
-std::array<float,2>{0.473322421f, 0.733259261f},
-std::array<float,2>{0.741055667f, 0.278414816f},
-std::array<float,2>{0.761159956f, 0.78456831f},
-std::array<float,2>{0.110224493f, 0.0702394322f},
-std::array<float,2>{0.169261515f, 0.975580335f},
-std::array<float,2>{0.934606314f, 0.128686011f},
-std::array<float,2>{0.620654106f, 0.568755805f},
-std::array<float,2>{0.255115241f, 0.474541396f},
-std::array<float,2>{0.140841171f, 0.588353932f},
-std::array<float,2>{0.898867607f, 0.498579741f},
-std::array<float,2>{0.575342417f, 0.991526842f},
-std::array<float,2>{0.284731001f, 0.144097388f},
-std::array<float,2>{0.451536477f, 0.810481369f},
-std::array<float,2>{0.687776029f, 0.0868375972f},
-std::array<float,2>{0.793110967f, 0.745322585f},
-std::array<float,2>{0.0734864846f, 0.263537884f},
-std::array<float,2>{0.373258531f, 0.674332619f},
-std::array<float,2>{0.502303421f, 0.337148607f},
-std::array<float,2>{0.986067474f, 0.845778346f},
-std::array<float,2>{0.235447422f, 0.00625682063f},
-std::array<float,2>{0.0533321723f, 0.901603639f},
-std::array<float,2>{0.829716086f, 0.219413057f},
-std::array<float,2>{0.650993943f, 0.508277297f},
-std::array<float,2>{0.406890959f, 0.410662055f},
-std::array<float,2>{0.0973588079f, 0.689599812f},
-std::array<float,2>{0.77582252f, 0.292542011f},
-std::array<float,2>{0.732463002f, 0.753065884f},
-std::array<float,2>{0.491530836f, 0.0986976549f},
-std::array<float,2>{0.277603328f, 0.963292003f},
-std::array<float,2>{0.606538415f, 0.167016476f},
-std::array<float,2>{0.912055135f, 0.624700248f},
-std::array<float,2>{0.184678659f, 0.452831298f},
-std::array<float,2>{0.388982117f, 0.544812441f},
-std::array<float,2>{0.674193859f, 0.389873534f},
-std::array<float,2>{0.85466814f, 0.906654716f},
-std::array<float,2>{0.0189901479f, 0.212316811f},
-std::array<float,2>{0.207696676f, 0.829515815f},
-std::array<float,2>{0.958551943f, 0.0499814674f},
-std::array<float,2>{0.549098909f, 0.641680956f},
-std::array<float,2>{0.339905977f, 0.344410598f},
-std::array<float,2>{0.172211483f, 0.741963565f},
-std::array<float,2>{0.918361366f, 0.250123173f},
-std::array<float,2>{0.60073483f, 0.803586423f},
-std::array<float,2>{0.27055189f, 0.0791000798f},
-std::array<float,2>{0.496357262f, 0.992714882f},
-std::array<float,2>{0.719948649f, 0.155040547f},
-std::array<float,2>{0.767030299f, 0.58313185f},
-std::array<float,2>{0.104558162f, 0.485690832f},
-std::array<float,2>{0.334231764f, 0.502014279f},
-std::array<float,2>{0.562348962f, 0.417562842f},
-std::array<float,2>{0.965710342f, 0.896922708f},
-std::array<float,2>{0.211375952f, 0.230851084f},
-std::array<float,2>{0.0242436863f, 0.853877187f},
-std::array<float,2>{0.847384572f, 0.00918431673f},
-std::array<float,2>{0.682992458f, 0.683658719f},
-std::array<float,2>{0.381840825f, 0.331031382f},
-std::array<float,2>{0.0626969412f, 0.609925866f},
-std::array<float,2>{0.785513639f, 0.438813239f},
-std::array<float,2>{0.698178113f, 0.956354558f},
-std::array<float,2>{0.442167878f, 0.158087209f},
-std::array<float,2>{0.289924681f, 0.759677291f},
-std::array<float,2>{0.568264604f, 0.108519375f},
-std::array<float,2>{0.8948614f, 0.698364913f},
-std::array<float,2>{0.150411278f, 0.285795569f},
-std::array<float,2>{0.418713003f, 0.652755141f},
-std::array<float,2>{0.644238055f, 0.353900403f},
-std::array<float,2>{0.840938568f, 0.842635632f},
-std::array<float,2>{0.0581375919f, 0.0623161905f},
-std::array<float,2>{0.243010506f, 0.920355082f},
-std::array<float,2>{0.999945402f, 0.2083489f},
-std::array<float,2>{0.513305247f, 0.536472023f},
-std::array<float,2>{0.3599298f, 0.380609155f},
-std::array<float,2>{0.188585028f, 0.55492425f},
-std::array<float,2>{0.938340247f, 0.391016036f},
-std::array<float,2>{0.534847677f, 0.932642817f},
-std::array<float,2>{0.320397407f, 0.192233294f},
-std::array<float,2>{0.396873504f, 0.818924725f},
-std::array<float,2>{0.666337788f, 0.032812953f},
-std::array<float,2>{0.862318575f, 0.640311301f},
-std::array<float,2>{0.00858345721f, 0.369775355f},
-std::array<float,2>{0.259700745f, 0.710236311f},
-std::array<float,2>{0.609665155f, 0.312151849f},
-std::array<float,2>{0.927786112f, 0.773538113f},
-std::array<float,2>{0.157186851f, 0.115230337f},
-std::array<float,2>{0.120808683f, 0.937739253f},
-std::array<float,2>{0.754389882f, 0.181821629f},
-std::array<float,2>{0.744104028f, 0.608903706f},
-std::array<float,2>{0.477119625f, 0.462735295f},
-std::array<float,2>{0.0348552875f, 0.663082719f},
-std::array<float,2>{0.816531479f, 0.317287803f},
-std::array<float,2>{0.625579f, 0.862915397f},
-std::array<float,2>{0.435885102f, 0.0210981984f},
-std::array<float,2>{0.34991619f, 0.880359054f},
-std::array<float,2>{0.526019037f, 0.246407092f},
-std::array<float,2>{0.974253833f, 0.525817811f},
-std::array<float,2>{0.231514096f, 0.429043293f},
-std::array<float,2>{0.458332181f, 0.571817338f},
-std::array<float,2>{0.715330362f, 0.481462091f},
-std::array<float,2>{0.807846904f, 0.980376244f},
-std::array<float,2>{0.0816552714f, 0.138040766f},
-std::array<float,2>{0.138701186f, 0.790071964f},
-std::array<float,2>{0.879880071f, 0.0727290735f},
-std::array<float,2>{0.588472545f, 0.722845733f},
-std::array<float,2>{0.304378182f, 0.266600966f},
-std::array<float,2>{0.194868982f, 0.748391867f},
-std::array<float,2>{0.944661498f, 0.259811223f},
-std::array<float,2>{0.537581444f, 0.805427492f},
-std::array<float,2>{0.324436039f, 0.0926920772f},
-std::array<float,2>{0.392098784f, 0.987677336f},
-std::array<float,2>{0.668456793f, 0.14678064f},
-std::array<float,2>{0.864102602f, 0.590189457f},
-std::array<float,2>{0.0146832941f, 0.495198727f},
-std::array<float,2>{0.264018863f, 0.513368964f},
-std::array<float,2>{0.615958214f, 0.407809019f},
-std::array<float,2>{0.922524154f, 0.904688835f},
-std::array<float,2>{0.163030818f, 0.222865924f},
-std::array<float,2>{0.123400837f, 0.851326883f},
-std::array<float,2>{0.751129329f, 0.00352899032f},
-std::array<float,2>{0.748961866f, 0.678177536f},
-std::array<float,2>{0.480594069f, 0.342157394f},
-std::array<float,2>{0.0361289345f, 0.620678723f},
-std::array<float,2>{0.815120876f, 0.447846532f},
-std::array<float,2>{0.629271746f, 0.966598272f},
-std::array<float,2>{0.432921141f, 0.16797024f},
-std::array<float,2>{0.346310854f, 0.754282296f},
-std::array<float,2>{0.529492438f, 0.0949881151f},
-std::array<float,2>{0.971683741f, 0.691548645f},
-std::array<float,2>{0.227753326f, 0.29415679f},
-std::array<float,2>{0.453687996f, 0.64658767f},
-std::array<float,2>{0.714619994f, 0.348190516f},
-std::array<float,2>{0.809036255f, 0.834267378f},
-std::array<float,2>{0.0850980282f, 0.0517968312f},
-std::array<float,2>{0.133583933f, 0.912419617f},
-std::array<float,2>{0.876294315f, 0.21511513f},
-std::array<float,2>{0.589878321f, 0.542689323f},
-std::array<float,2>{0.297761232f, 0.382949114f},
-std::array<float,2>{0.176955119f, 0.551128685f},
-std::array<float,2>{0.915017188f, 0.401266158f},
-std::array<float,2>{0.596799135f, 0.926097691f},
-std::array<float,2>{0.267033368f, 0.195889205f},
-std::array<float,2>{0.495926142f, 0.827623129f},
-std::array<float,2>{0.724357724f, 0.0461430326f},
-std::array<float,2>{0.771335602f, 0.631751239f},
-std::array<float,2>{0.108226217f, 0.361160636f},
-std::array<float,2>{0.329959542f, 0.713623405f},
-std::array<float,2>{0.557588696f, 0.303712279f},
-std::array<float,2>{0.961106956f, 0.767723382f},
-std::array<float,2>{0.215944022f, 0.117490858f},
-std::array<float,2>{0.0302542541f, 0.949080169f},
-std::array<float,2>{0.849512219f, 0.175978318f},
-std::array<float,2>{0.685997605f, 0.598933339f},
-std::array<float,2>{0.378572464f, 0.458798021f},
-std::array<float,2>{0.0671436563f, 0.669919252f},
-std::array<float,2>{0.784496248f, 0.323750407f},
-std::array<float,2>{0.702270508f, 0.873262703f},
-std::array<float,2>{0.43972984f, 0.0303241238f},
-std::array<float,2>{0.295801342f, 0.885180533f},
-std::array<float,2>{0.565174222f, 0.238859981f},
-std::array<float,2>{0.89447844f, 0.521265745f},
-std::array<float,2>{0.1544763f, 0.436584949f},
-std::array<float,2>{0.415528029f, 0.563338757f},
-std::array<float,2>{0.648338974f, 0.469853073f},
-std::array<float,2>{0.838777184f, 0.970313132f},
-std::array<float,2>{0.0601879768f, 0.131705999f},
-std::array<float,2>{0.247494012f, 0.789022982f},
-std::array<float,2>{0.992221534f, 0.064971f},
-std::array<float,2>{0.508657575f, 0.727177083f},
-std::array<float,2>{0.364344805f, 0.276885748f},
-std::array<float,2>{0.148172885f, 0.635547698f},
-std::array<float,2>{0.902907312f, 0.371646017f},
-std::array<float,2>{0.57087034f, 0.812508404f},
-std::array<float,2>{0.285545945f, 0.0388073251f},
-std::array<float,2>{0.447197109f, 0.936805665f},
-std::array<float,2>{0.694448173f, 0.19105792f},
-std::array<float,2>{0.789946795f, 0.559018075f},
-std::array<float,2>{0.075186193f, 0.39653039f},
-std::array<float,2>{0.368229479f, 0.604193032f},
-std::array<float,2>{0.506258726f, 0.466449738f},
-std::array<float,2>{0.989620924f, 0.942347825f},
-std::array<float,2>{0.241189376f, 0.184584558f},
-std::array<float,2>{0.0504539311f, 0.780668497f},
-std::array<float,2>{0.834921122f, 0.110439666f},
-std::array<float,2>{0.65467006f, 0.703185916f},
-std::array<float,2>{0.41323784f, 0.306104571f},
-std::array<float,2>{0.0981612727f, 0.530911326f},
-std::array<float,2>{0.780611515f, 0.421949416f},
-std::array<float,2>{0.728500843f, 0.875024021f},
-std::array<float,2>{0.485841334f, 0.244494274f},
-std::array<float,2>{0.273635715f, 0.864964545f},
-std::array<float,2>{0.601763129f, 0.0179255586f},
-std::array<float,2>{0.909879863f, 0.65824157f},
-std::array<float,2>{0.180725604f, 0.315384448f},
-std::array<float,2>{0.383365601f, 0.721986711f},
-std::array<float,2>{0.678030908f, 0.26975596f},
-std::array<float,2>{0.857978284f, 0.794946432f},
-std::array<float,2>{0.0225470811f, 0.0761839747f},
-std::array<float,2>{0.203221545f, 0.982112348f},
-std::array<float,2>{0.95480442f, 0.134217888f},
-std::array<float,2>{0.553260446f, 0.5742203f},
-std::array<float,2>{0.336422622f, 0.476826638f},
-std::array<float,2>{0.21907641f, 0.578637004f},
-std::array<float,2>{0.978562951f, 0.490842849f},
-std::array<float,2>{0.518458426f, 0.997311711f},
-std::array<float,2>{0.356001168f, 0.150900424f},
-std::array<float,2>{0.426887661f, 0.798272133f},
-std::array<float,2>{0.639436603f, 0.0856442302f},
-std::array<float,2>{0.826439321f, 0.735663474f},
-std::array<float,2>{0.0460185334f, 0.256590128f},
-std::array<float,2>{0.306990147f, 0.681511819f},
-std::array<float,2>{0.582732856f, 0.335356742f},
-std::array<float,2>{0.887381196f, 0.858407736f},
-std::array<float,2>{0.129318908f, 0.0138558168f},
-std::array<float,2>{0.091074273f, 0.893724799f},
-std::array<float,2>{0.798647225f, 0.227080941f},
-std::array<float,2>{0.708435953f, 0.504591286f},
-std::array<float,2>{0.467983335f, 0.419549555f},
-std::array<float,2>{0.0057488475f, 0.700648963f},
-std::array<float,2>{0.867530346f, 0.28254351f},
-std::array<float,2>{0.660191417f, 0.76225698f},
-std::array<float,2>{0.398738652f, 0.10311833f},
-std::array<float,2>{0.316805571f, 0.959743202f},
-std::array<float,2>{0.544903576f, 0.163091347f},
-std::array<float,2>{0.949170351f, 0.616697192f},
-std::array<float,2>{0.201476187f, 0.443428814f},
-std::array<float,2>{0.472630173f, 0.532776177f},
-std::array<float,2>{0.735346675f, 0.375874907f},
-std::array<float,2>{0.76495862f, 0.917566001f},
-std::array<float,2>{0.116283715f, 0.206403896f},
-std::array<float,2>{0.164131194f, 0.838485241f},
-std::array<float,2>{0.933043778f, 0.0583078191f},
-std::array<float,2>{0.6228894f, 0.648511589f},
-std::array<float,2>{0.252920955f, 0.358293921f},
-std::array<float,2>{0.234476015f, 0.672209442f},
-std::array<float,2>{0.985341549f, 0.339674592f},
-std::array<float,2>{0.503486216f, 0.844117999f},
-std::array<float,2>{0.374611169f, 0.00459051132f},
-std::array<float,2>{0.407690793f, 0.899376273f},
-std::array<float,2>{0.651564002f, 0.221589431f},
-std::array<float,2>{0.828543067f, 0.510929227f},
-std::array<float,2>{0.0546382405f, 0.41279912f},
-std::array<float,2>{0.283958793f, 0.587478757f},
-std::array<float,2>{0.575137615f, 0.497726709f},
-std::array<float,2>{0.899869263f, 0.989802122f},
-std::array<float,2>{0.142307356f, 0.142127946f},
-std::array<float,2>{0.0727146938f, 0.811084628f},
-std::array<float,2>{0.794907033f, 0.0895887017f},
-std::array<float,2>{0.689002156f, 0.743506432f},
-std::array<float,2>{0.452161729f, 0.265271097f},
-std::array<float,2>{0.0179119334f, 0.545837045f},
-std::array<float,2>{0.853791952f, 0.387471348f},
-std::array<float,2>{0.674982429f, 0.908310413f},
-std::array<float,2>{0.38994509f, 0.213037252f},
-std::array<float,2>{0.340961128f, 0.831954718f},
-std::array<float,2>{0.550617158f, 0.0478202328f},
-std::array<float,2>{0.957771063f, 0.643036485f},
-std::array<float,2>{0.208437219f, 0.34704408f},
-std::array<float,2>{0.49095422f, 0.688902438f},
-std::array<float,2>{0.734302819f, 0.289472699f},
-std::array<float,2>{0.776372254f, 0.750379682f},
-std::array<float,2>{0.0958190858f, 0.100966111f},
-std::array<float,2>{0.184093699f, 0.961838603f},
-std::array<float,2>{0.910357296f, 0.165631309f},
-std::array<float,2>{0.605879009f, 0.621394396f},
-std::array<float,2>{0.278386593f, 0.450298697f},
-std::array<float,2>{0.127750352f, 0.594310999f},
-std::array<float,2>{0.884056091f, 0.455773234f},
-std::array<float,2>{0.57838273f, 0.951041818f},
-std::array<float,2>{0.310746253f, 0.175246537f},
-std::array<float,2>{0.461578578f, 0.773193717f},
-std::array<float,2>{0.706126869f, 0.123153463f},
-std::array<float,2>{0.802457511f, 0.717635453f},
-std::array<float,2>{0.0887262225f, 0.297273815f},
-std::array<float,2>{0.351850748f, 0.626845241f},
-std::array<float,2>{0.521671712f, 0.365185976f},
-std::array<float,2>{0.983710289f, 0.821474135f},
-std::array<float,2>{0.22535871f, 0.0423773639f},
-std::array<float,2>{0.0391474031f, 0.923078835f},
-std::array<float,2>{0.820642114f, 0.199618742f},
-std::array<float,2>{0.633885205f, 0.550723016f},
-std::array<float,2>{0.422380954f, 0.405777067f},
-std::array<float,2>{0.110899746f, 0.731392264f},
-std::array<float,2>{0.760599554f, 0.279976696f},
-std::array<float,2>{0.741538107f, 0.782537699f},
-std::array<float,2>{0.474108219f, 0.0680757836f},
-std::array<float,2>{0.254383445f, 0.973099172f},
-std::array<float,2>{0.619238138f, 0.126402274f},
-std::array<float,2>{0.934465587f, 0.567293584f},
-std::array<float,2>{0.16864714f, 0.476335973f},
-std::array<float,2>{0.405092448f, 0.518352687f},
-std::array<float,2>{0.658055723f, 0.430241674f},
-std::array<float,2>{0.874095201f, 0.886827886f},
-std::array<float,2>{0.00275473576f, 0.238019377f},
-std::array<float,2>{0.197564512f, 0.870952427f},
-std::array<float,2>{0.949962199f, 0.023440225f},
-std::array<float,2>{0.541776419f, 0.666157603f},
-std::array<float,2>{0.315722257f, 0.327300936f},
-std::array<float,2>{0.157731846f, 0.708277464f},
-std::array<float,2>{0.928812087f, 0.310188025f},
-std::array<float,2>{0.611040354f, 0.777135015f},
-std::array<float,2>{0.25856626f, 0.11627233f},
-std::array<float,2>{0.477949828f, 0.940520883f},
-std::array<float,2>{0.743019104f, 0.180531591f},
-std::array<float,2>{0.755280912f, 0.606393933f},
-std::array<float,2>{0.119694106f, 0.463917434f},
-std::array<float,2>{0.321537465f, 0.557531893f},
-std::array<float,2>{0.533642888f, 0.394236922f},
-std::array<float,2>{0.939385474f, 0.929857433f},
-std::array<float,2>{0.187790811f, 0.1939006f},
-std::array<float,2>{0.00954037439f, 0.817249179f},
-std::array<float,2>{0.86144501f, 0.0346637443f},
-std::array<float,2>{0.667012811f, 0.638107002f},
-std::array<float,2>{0.397744983f, 0.367465943f},
-std::array<float,2>{0.0809363425f, 0.573377192f},
-std::array<float,2>{0.807098806f, 0.484167963f},
-std::array<float,2>{0.715995789f, 0.978158832f},
-std::array<float,2>{0.457355082f, 0.139298424f},
-std::array<float,2>{0.303151309f, 0.791815817f},
-std::array<float,2>{0.589263141f, 0.0714353174f},
-std::array<float,2>{0.880845845f, 0.725786746f},
-std::array<float,2>{0.139725506f, 0.269287854f},
-std::array<float,2>{0.437475175f, 0.661171198f},
-std::array<float,2>{0.626429021f, 0.319221616f},
-std::array<float,2>{0.818319678f, 0.85995245f},
-std::array<float,2>{0.0339472666f, 0.0231735501f},
-std::array<float,2>{0.230972812f, 0.882290363f},
-std::array<float,2>{0.973065197f, 0.248371318f},
-std::array<float,2>{0.527237058f, 0.525149286f},
-std::array<float,2>{0.350903928f, 0.4262923f},
-std::array<float,2>{0.212686971f, 0.501471519f},
-std::array<float,2>{0.965985417f, 0.415942848f},
-std::array<float,2>{0.560734093f, 0.896122277f},
-std::array<float,2>{0.335864037f, 0.233836368f},
-std::array<float,2>{0.381759107f, 0.851834178f},
-std::array<float,2>{0.682086647f, 0.011484446f},
-std::array<float,2>{0.845831871f, 0.686663866f},
-std::array<float,2>{0.0244906358f, 0.330072016f},
-std::array<float,2>{0.270370334f, 0.739846051f},
-std::array<float,2>{0.59982425f, 0.252111346f},
-std::array<float,2>{0.919578671f, 0.801346838f},
-std::array<float,2>{0.173607528f, 0.0802168921f},
-std::array<float,2>{0.103940614f, 0.994545817f},
-std::array<float,2>{0.766329527f, 0.153531313f},
-std::array<float,2>{0.719042063f, 0.585800529f},
-std::array<float,2>{0.497482181f, 0.486486703f},
-std::array<float,2>{0.0566957407f, 0.656225145f},
-std::array<float,2>{0.840144694f, 0.351941496f},
-std::array<float,2>{0.643014193f, 0.840764165f},
-std::array<float,2>{0.418960214f, 0.0599287935f},
-std::array<float,2>{0.361224264f, 0.918530047f},
-std::array<float,2>{0.511966467f, 0.210071817f},
-std::array<float,2>{0.99863404f, 0.537947834f},
-std::array<float,2>{0.243721768f, 0.381339669f},
-std::array<float,2>{0.442442f, 0.611918926f},
-std::array<float,2>{0.69903475f, 0.440322578f},
-std::array<float,2>{0.786670983f, 0.953780532f},
-std::array<float,2>{0.0637433231f, 0.158769935f},
-std::array<float,2>{0.151490211f, 0.761270642f},
-std::array<float,2>{0.895528018f, 0.106670044f},
-std::array<float,2>{0.566583514f, 0.696094811f},
-std::array<float,2>{0.29055202f, 0.288380265f},
-std::array<float,2>{0.228734836f, 0.695065677f},
-std::array<float,2>{0.969525158f, 0.295989811f},
-std::array<float,2>{0.527911425f, 0.757162094f},
-std::array<float,2>{0.344977111f, 0.0963076353f},
-std::array<float,2>{0.429769039f, 0.967457414f},
-std::array<float,2>{0.631876528f, 0.17108494f},
-std::array<float,2>{0.81402117f, 0.617382646f},
-std::array<float,2>{0.0385690704f, 0.445874184f},
-std::array<float,2>{0.299854308f, 0.540208995f},
-std::array<float,2>{0.592559695f, 0.385104686f},
-std::array<float,2>{0.877593815f, 0.911916196f},
-std::array<float,2>{0.134849995f, 0.217957854f},
-std::array<float,2>{0.0825177059f, 0.833375394f},
-std::array<float,2>{0.811138809f, 0.0528884158f},
-std::array<float,2>{0.712773025f, 0.645340502f},
-std::array<float,2>{0.456286341f, 0.351275086f},
-std::array<float,2>{0.0132814245f, 0.592781723f},
-std::array<float,2>{0.86716944f, 0.493277937f},
-std::array<float,2>{0.671748877f, 0.984877884f},
-std::array<float,2>{0.393523932f, 0.146411374f},
-std::array<float,2>{0.326228052f, 0.807602465f},
-std::array<float,2>{0.536329627f, 0.0914510712f},
-std::array<float,2>{0.941911817f, 0.747737229f},
-std::array<float,2>{0.19220978f, 0.258105099f},
-std::array<float,2>{0.482792825f, 0.676054358f},
-std::array<float,2>{0.746962368f, 0.341118008f},
-std::array<float,2>{0.752627552f, 0.848842442f},
-std::array<float,2>{0.12257123f, 0.000553797465f},
-std::array<float,2>{0.160436288f, 0.903879642f},
-std::array<float,2>{0.92417109f, 0.225359395f},
-std::array<float,2>{0.61503613f, 0.513755977f},
-std::array<float,2>{0.263181329f, 0.408418119f},
-std::array<float,2>{0.15336363f, 0.523304582f},
-std::array<float,2>{0.89072448f, 0.435302943f},
-std::array<float,2>{0.563147843f, 0.884144187f},
-std::array<float,2>{0.294107616f, 0.241549432f},
-std::array<float,2>{0.438355833f, 0.872029185f},
-std::array<float,2>{0.699779809f, 0.0284003839f},
-std::array<float,2>{0.781845748f, 0.671652257f},
-std::array<float,2>{0.0699473768f, 0.320668846f},
-std::array<float,2>{0.366570979f, 0.730180383f},
-std::array<float,2>{0.510118246f, 0.273924977f},
-std::array<float,2>{0.99530828f, 0.786016643f},
-std::array<float,2>{0.249155164f, 0.0632773116f},
-std::array<float,2>{0.0617776103f, 0.971376836f},
-std::array<float,2>{0.835998416f, 0.129807994f},
-std::array<float,2>{0.645624995f, 0.566180408f},
-std::array<float,2>{0.417028755f, 0.471315444f},
-std::array<float,2>{0.105489373f, 0.630063653f},
-std::array<float,2>{0.772663236f, 0.361616701f},
-std::array<float,2>{0.725737631f, 0.825261712f},
-std::array<float,2>{0.493667632f, 0.0433760807f},
-std::array<float,2>{0.269173414f, 0.928594768f},
-std::array<float,2>{0.594618618f, 0.19883807f},
-std::array<float,2>{0.91676271f, 0.552829683f},
-std::array<float,2>{0.17808716f, 0.40018028f},
-std::array<float,2>{0.375293076f, 0.601263762f},
-std::array<float,2>{0.685400486f, 0.460825175f},
-std::array<float,2>{0.851008117f, 0.945648372f},
-std::array<float,2>{0.0277223829f, 0.179247901f},
-std::array<float,2>{0.217488453f, 0.765904069f},
-std::array<float,2>{0.963452876f, 0.12030375f},
-std::array<float,2>{0.555395782f, 0.712096572f},
-std::array<float,2>{0.331479192f, 0.301508278f},
-std::array<float,2>{0.181982085f, 0.657947361f},
-std::array<float,2>{0.907199204f, 0.313262939f},
-std::array<float,2>{0.605224431f, 0.866961241f},
-std::array<float,2>{0.276745409f, 0.0174055062f},
-std::array<float,2>{0.487834424f, 0.878259957f},
-std::array<float,2>{0.729915321f, 0.243702605f},
-std::array<float,2>{0.778620362f, 0.527368665f},
-std::array<float,2>{0.101080939f, 0.424005866f},
-std::array<float,2>{0.337984264f, 0.57630229f},
-std::array<float,2>{0.552197039f, 0.480111986f},
-std::array<float,2>{0.955092967f, 0.983389676f},
-std::array<float,2>{0.205113798f, 0.136711568f},
-std::array<float,2>{0.0205943696f, 0.794778407f},
-std::array<float,2>{0.856687903f, 0.0749209821f},
-std::array<float,2>{0.677375376f, 0.71875006f},
-std::array<float,2>{0.385410398f, 0.273135185f},
-std::array<float,2>{0.0762898922f, 0.560696483f},
-std::array<float,2>{0.792830646f, 0.396208435f},
-std::array<float,2>{0.692411125f, 0.934381247f},
-std::array<float,2>{0.447374523f, 0.187696695f},
-std::array<float,2>{0.287147164f, 0.816155016f},
-std::array<float,2>{0.572814465f, 0.03522617f},
-std::array<float,2>{0.904782891f, 0.63305676f},
-std::array<float,2>{0.14463456f, 0.373254776f},
-std::array<float,2>{0.410847008f, 0.706924856f},
-std::array<float,2>{0.653636932f, 0.307037026f},
-std::array<float,2>{0.833872676f, 0.777726412f},
-std::array<float,2>{0.0481378585f, 0.113255404f},
-std::array<float,2>{0.239915267f, 0.943564892f},
-std::array<float,2>{0.991547763f, 0.18727085f},
-std::array<float,2>{0.504812121f, 0.603217244f},
-std::array<float,2>{0.369636536f, 0.467136979f},
-std::array<float,2>{0.20061779f, 0.613653719f},
-std::array<float,2>{0.946316361f, 0.443215996f},
-std::array<float,2>{0.545668006f, 0.958729208f},
-std::array<float,2>{0.320176005f, 0.161360666f},
-std::array<float,2>{0.400707245f, 0.763750076f},
-std::array<float,2>{0.662618101f, 0.104777083f},
-std::array<float,2>{0.870366693f, 0.701684237f},
-std::array<float,2>{0.00668241223f, 0.284077317f},
-std::array<float,2>{0.251016736f, 0.650866091f},
-std::array<float,2>{0.624641538f, 0.357026488f},
-std::array<float,2>{0.930882931f, 0.837086916f},
-std::array<float,2>{0.166327059f, 0.0565184429f},
-std::array<float,2>{0.113612592f, 0.915929854f},
-std::array<float,2>{0.76301688f, 0.204426408f},
-std::array<float,2>{0.736974239f, 0.53341502f},
-std::array<float,2>{0.468879312f, 0.377341121f},
-std::array<float,2>{0.0436332263f, 0.737672806f},
-std::array<float,2>{0.826060712f, 0.254113138f},
-std::array<float,2>{0.637102306f, 0.799631238f},
-std::array<float,2>{0.428930134f, 0.0825577974f},
-std::array<float,2>{0.35780409f, 0.998953342f},
-std::array<float,2>{0.51696372f, 0.149710879f},
-std::array<float,2>{0.976584136f, 0.580217421f},
-std::array<float,2>{0.221004605f, 0.489871055f},
-std::array<float,2>{0.46604076f, 0.507390141f},
-std::array<float,2>{0.710394204f, 0.421759307f},
-std::array<float,2>{0.799806297f, 0.892187953f},
-std::array<float,2>{0.0925561041f, 0.228924721f},
-std::array<float,2>{0.13092941f, 0.85580647f},
-std::array<float,2>{0.890087247f, 0.0125653222f},
-std::array<float,2>{0.585402012f, 0.682085395f},
-std::array<float,2>{0.306448698f, 0.332932472f},
-std::array<float,2>{0.210933402f, 0.640784502f},
-std::array<float,2>{0.960824192f, 0.345537812f},
-std::array<float,2>{0.54766041f, 0.828303814f},
-std::array<float,2>{0.343543261f, 0.0492497459f},
-std::array<float,2>{0.38696301f, 0.907733083f},
-std::array<float,2>{0.672459662f, 0.210986942f},
-std::array<float,2>{0.85297972f, 0.543630958f},
-std::array<float,2>{0.0157729965f, 0.388771176f},
-std::array<float,2>{0.280404925f, 0.623746574f},
-std::array<float,2>{0.608307421f, 0.45132041f},
-std::array<float,2>{0.913279533f, 0.964265823f},
-std::array<float,2>{0.185983479f, 0.166417331f},
-std::array<float,2>{0.0948346928f, 0.75199616f},
-std::array<float,2>{0.774127483f, 0.0984564349f},
-std::array<float,2>{0.732055604f, 0.690767646f},
-std::array<float,2>{0.488700449f, 0.291928709f},
-std::array<float,2>{0.0523616709f, 0.509592354f},
-std::array<float,2>{0.830660999f, 0.411484957f},
-std::array<float,2>{0.649349928f, 0.901137412f},
-std::array<float,2>{0.408605486f, 0.220325798f},
-std::array<float,2>{0.372743458f, 0.846723557f},
-std::array<float,2>{0.501491547f, 0.00754831498f},
-std::array<float,2>{0.986918449f, 0.675205469f},
-std::array<float,2>{0.237657249f, 0.336845309f},
-std::array<float,2>{0.449235588f, 0.74486351f},
-std::array<float,2>{0.691141665f, 0.262528658f},
-std::array<float,2>{0.795832753f, 0.809408545f},
-std::array<float,2>{0.0718962848f, 0.0872673988f},
-std::array<float,2>{0.143532455f, 0.990604341f},
-std::array<float,2>{0.900513887f, 0.142682046f},
-std::array<float,2>{0.576602519f, 0.589634717f},
-std::array<float,2>{0.281713039f, 0.499680072f},
-std::array<float,2>{0.171670288f, 0.570193708f},
-std::array<float,2>{0.935579538f, 0.47269243f},
-std::array<float,2>{0.617831886f, 0.97617358f},
-std::array<float,2>{0.257673085f, 0.127487063f},
-std::array<float,2>{0.476346076f, 0.783898234f},
-std::array<float,2>{0.739815414f, 0.0685428083f},
-std::array<float,2>{0.758513868f, 0.734061778f},
-std::array<float,2>{0.112608306f, 0.27740401f},
-std::array<float,2>{0.314448833f, 0.664447367f},
-std::array<float,2>{0.539235234f, 0.324650824f},
-std::array<float,2>{0.952458322f, 0.868157208f},
-std::array<float,2>{0.196448907f, 0.0272707455f},
-std::array<float,2>{0.000219581183f, 0.889971852f},
-std::array<float,2>{0.871914327f, 0.234781846f},
-std::array<float,2>{0.659067869f, 0.51672262f},
-std::array<float,2>{0.40380758f, 0.432584882f},
-std::array<float,2>{0.0873463452f, 0.7163589f},
-std::array<float,2>{0.803615689f, 0.300257534f},
-std::array<float,2>{0.703153193f, 0.770367622f},
-std::array<float,2>{0.463484228f, 0.122040987f},
-std::array<float,2>{0.309835374f, 0.951529682f},
-std::array<float,2>{0.580748558f, 0.172087029f},
-std::array<float,2>{0.885176897f, 0.597551227f},
-std::array<float,2>{0.125952646f, 0.454086691f},
-std::array<float,2>{0.424977571f, 0.547336161f},
-std::array<float,2>{0.63603276f, 0.402876854f},
-std::array<float,2>{0.822350204f, 0.925021529f},
-std::array<float,2>{0.0426962376f, 0.202082187f},
-std::array<float,2>{0.222937092f, 0.823307693f},
-std::array<float,2>{0.980717063f, 0.0408996902f},
-std::array<float,2>{0.519922674f, 0.627687335f},
-std::array<float,2>{0.354329616f, 0.366880029f},
-std::array<float,2>{0.138212204f, 0.724115252f},
-std::array<float,2>{0.882549763f, 0.267467529f},
-std::array<float,2>{0.586510599f, 0.789315581f},
-std::array<float,2>{0.300791651f, 0.074145101f},
-std::array<float,2>{0.459364384f, 0.97851938f},
-std::array<float,2>{0.718345284f, 0.137142047f},
-std::array<float,2>{0.804883242f, 0.571087658f},
-std::array<float,2>{0.0798902139f, 0.480799317f},
-std::array<float,2>{0.349441022f, 0.526909351f},
-std::array<float,2>{0.52484858f, 0.428568184f},
-std::array<float,2>{0.974912584f, 0.879299104f},
-std::array<float,2>{0.233953297f, 0.2477815f},
-std::array<float,2>{0.0314787887f, 0.86220777f},
-std::array<float,2>{0.820141912f, 0.0204641018f},
-std::array<float,2>{0.628010333f, 0.663228154f},
-std::array<float,2>{0.435002148f, 0.317471802f},
-std::array<float,2>{0.118592747f, 0.608059347f},
-std::array<float,2>{0.756896436f, 0.461260796f},
-std::array<float,2>{0.745432436f, 0.938850403f},
-std::array<float,2>{0.479276896f, 0.182756484f},
-std::array<float,2>{0.260760784f, 0.774820924f},
-std::array<float,2>{0.611963034f, 0.113892585f},
-std::array<float,2>{0.927288413f, 0.709252775f},
-std::array<float,2>{0.158929601f, 0.311379194f},
-std::array<float,2>{0.395878106f, 0.639586926f},
-std::array<float,2>{0.665609121f, 0.37043035f},
-std::array<float,2>{0.860280037f, 0.820076644f},
-std::array<float,2>{0.011255783f, 0.0318186358f},
-std::array<float,2>{0.190856248f, 0.931692958f},
-std::array<float,2>{0.940591097f, 0.192593426f},
-std::array<float,2>{0.531614959f, 0.556226432f},
-std::array<float,2>{0.322828978f, 0.392401665f},
-std::array<float,2>{0.244200528f, 0.535613477f},
-std::array<float,2>{0.99675864f, 0.379290134f},
-std::array<float,2>{0.515020847f, 0.921233535f},
-std::array<float,2>{0.361785024f, 0.207157567f},
-std::array<float,2>{0.420992613f, 0.843366504f},
-std::array<float,2>{0.641302884f, 0.0607579947f},
-std::array<float,2>{0.843722463f, 0.653857589f},
-std::array<float,2>{0.0562532134f, 0.355240852f},
-std::array<float,2>{0.292930365f, 0.697672367f},
-std::array<float,2>{0.569029987f, 0.286536574f},
-std::array<float,2>{0.89733237f, 0.758014977f},
-std::array<float,2>{0.148640588f, 0.10761299f},
-std::array<float,2>{0.0652499273f, 0.955607593f},
-std::array<float,2>{0.788554847f, 0.157113418f},
-std::array<float,2>{0.697033823f, 0.610993385f},
-std::array<float,2>{0.444549143f, 0.437665403f},
-std::array<float,2>{0.0261585228f, 0.685111344f},
-std::array<float,2>{0.845298231f, 0.331298381f},
-std::array<float,2>{0.68083632f, 0.855204821f},
-std::array<float,2>{0.3794384f, 0.00820754189f},
-std::array<float,2>{0.332236171f, 0.897744298f},
-std::array<float,2>{0.560350358f, 0.231762677f},
-std::array<float,2>{0.966989875f, 0.503061116f},
-std::array<float,2>{0.214116827f, 0.416019619f},
-std::array<float,2>{0.498229653f, 0.582951665f},
-std::array<float,2>{0.721047878f, 0.485313416f},
-std::array<float,2>{0.769424796f, 0.993501246f},
-std::array<float,2>{0.102443494f, 0.156045541f},
-std::array<float,2>{0.174681291f, 0.80371356f},
-std::array<float,2>{0.921192408f, 0.0797777921f},
-std::array<float,2>{0.599261761f, 0.740719974f},
-std::array<float,2>{0.272612661f, 0.251588911f},
-std::array<float,2>{0.236940607f, 0.7433272f},
-std::array<float,2>{0.987428904f, 0.265500337f},
-std::array<float,2>{0.500707746f, 0.811310887f},
-std::array<float,2>{0.371296495f, 0.0896183923f},
-std::array<float,2>{0.409747183f, 0.990135849f},
-std::array<float,2>{0.65027082f, 0.142334044f},
-std::array<float,2>{0.831570506f, 0.587761402f},
-std::array<float,2>{0.0509564131f, 0.497808725f},
-std::array<float,2>{0.282874703f, 0.511069596f},
-std::array<float,2>{0.578018308f, 0.413066983f},
-std::array<float,2>{0.901495099f, 0.898979247f},
-std::array<float,2>{0.144418985f, 0.221287951f},
-std::array<float,2>{0.0705733895f, 0.843966842f},
-std::array<float,2>{0.796799481f, 0.00477331784f},
-std::array<float,2>{0.689504802f, 0.671916485f},
-std::array<float,2>{0.450346917f, 0.339371145f},
-std::array<float,2>{0.0169498194f, 0.621322989f},
-std::array<float,2>{0.85196203f, 0.450460345f},
-std::array<float,2>{0.672994316f, 0.961565435f},
-std::array<float,2>{0.387700558f, 0.165922359f},
-std::array<float,2>{0.342394501f, 0.75014174f},
-std::array<float,2>{0.54842478f, 0.100798681f},
-std::array<float,2>{0.959010899f, 0.688626707f},
-std::array<float,2>{0.209725976f, 0.289265066f},
-std::array<float,2>{0.489496917f, 0.642580867f},
-std::array<float,2>{0.731393278f, 0.346681595f},
-std::array<float,2>{0.775152504f, 0.831585705f},
-std::array<float,2>{0.0945235416f, 0.0473731831f},
-std::array<float,2>{0.186758056f, 0.908588707f},
-std::array<float,2>{0.91238302f, 0.213189572f},
-std::array<float,2>{0.609262705f, 0.545468271f},
-std::array<float,2>{0.279956728f, 0.387447715f},
-std::array<float,2>{0.125990823f, 0.550319672f},
-std::array<float,2>{0.886210859f, 0.406072408f},
-std::array<float,2>{0.58177352f, 0.92320019f},
-std::array<float,2>{0.308988899f, 0.199309632f},
-std::array<float,2>{0.464513898f, 0.821754217f},
-std::array<float,2>{0.704482019f, 0.0421639271f},
-std::array<float,2>{0.803819835f, 0.626686573f},
-std::array<float,2>{0.0866829157f, 0.36487931f},
-std::array<float,2>{0.354602873f, 0.717371106f},
-std::array<float,2>{0.520790994f, 0.297028959f},
-std::array<float,2>{0.981949508f, 0.77296102f},
-std::array<float,2>{0.224527016f, 0.123528175f},
-std::array<float,2>{0.0419524908f, 0.950883031f},
-std::array<float,2>{0.823404074f, 0.175042629f},
-std::array<float,2>{0.635366619f, 0.594487965f},
-std::array<float,2>{0.42400828f, 0.456033707f},
-std::array<float,2>{0.111643784f, 0.666305125f},
-std::array<float,2>{0.75959754f, 0.327591121f},
-std::array<float,2>{0.739093661f, 0.870638013f},
-std::array<float,2>{0.475118011f, 0.0238409173f},
-std::array<float,2>{0.256521821f, 0.887090325f},
-std::array<float,2>{0.61911428f, 0.238064989f},
-std::array<float,2>{0.937199056f, 0.518130481f},
-std::array<float,2>{0.170413375f, 0.430562705f},
-std::array<float,2>{0.402782202f, 0.567070723f},
-std::array<float,2>{0.659456372f, 0.476136237f},
-std::array<float,2>{0.872475028f, 0.972766399f},
-std::array<float,2>{0.00150639599f, 0.126079321f},
-std::array<float,2>{0.195628554f, 0.782289267f},
-std::array<float,2>{0.951749802f, 0.068264924f},
-std::array<float,2>{0.540518165f, 0.731044054f},
-std::array<float,2>{0.313067287f, 0.280248761f},
-std::array<float,2>{0.160137981f, 0.637857199f},
-std::array<float,2>{0.92593807f, 0.367340714f},
-std::array<float,2>{0.612882614f, 0.817012548f},
-std::array<float,2>{0.26063472f, 0.0343007185f},
-std::array<float,2>{0.480117857f, 0.930160999f},
-std::array<float,2>{0.744679034f, 0.194209859f},
-std::array<float,2>{0.756161869f, 0.557265878f},
-std::array<float,2>{0.11765679f, 0.394398421f},
-std::array<float,2>{0.323928356f, 0.606009364f},
-std::array<float,2>{0.533087492f, 0.46411711f},
-std::array<float,2>{0.939592659f, 0.94089973f},
-std::array<float,2>{0.189769343f, 0.180352688f},
-std::array<float,2>{0.0104839113f, 0.777031541f},
-std::array<float,2>{0.861038327f, 0.116549306f},
-std::array<float,2>{0.664821982f, 0.708057582f},
-std::array<float,2>{0.394906372f, 0.310339421f},
-std::array<float,2>{0.0782918036f, 0.52497673f},
-std::array<float,2>{0.806029975f, 0.426723689f},
-std::array<float,2>{0.717050493f, 0.881960571f},
-std::array<float,2>{0.460186064f, 0.248205438f},
-std::array<float,2>{0.302194327f, 0.860194504f},
-std::array<float,2>{0.587663412f, 0.0232171658f},
-std::array<float,2>{0.881315053f, 0.661599398f},
-std::array<float,2>{0.13740474f, 0.31889385f},
-std::array<float,2>{0.434207827f, 0.725980341f},
-std::array<float,2>{0.627711713f, 0.269116759f},
-std::array<float,2>{0.818686366f, 0.791588783f},
-std::array<float,2>{0.0326272808f, 0.0715833232f},
-std::array<float,2>{0.233038262f, 0.97833091f},
-std::array<float,2>{0.975630164f, 0.139567137f},
-std::array<float,2>{0.524180055f, 0.573591173f},
-std::array<float,2>{0.348123401f, 0.484039783f},
-std::array<float,2>{0.21378918f, 0.585634768f},
-std::array<float,2>{0.968363822f, 0.486812294f},
-std::array<float,2>{0.559317887f, 0.994203091f},
-std::array<float,2>{0.333910942f, 0.153692663f},
-std::array<float,2>{0.379916519f, 0.801545501f},
-std::array<float,2>{0.679816008f, 0.0804317147f},
-std::array<float,2>{0.844617665f, 0.740086913f},
-std::array<float,2>{0.027044978f, 0.252411455f},
-std::array<float,2>{0.271943897f, 0.686911225f},
-std::array<float,2>{0.597939253f, 0.329731345f},
-std::array<float,2>{0.920352101f, 0.851646185f},
-std::array<float,2>{0.175460175f, 0.0114415381f},
-std::array<float,2>{0.103405416f, 0.89645797f},
-std::array<float,2>{0.768157899f, 0.233558774f},
-std::array<float,2>{0.722158074f, 0.501769841f},
-std::array<float,2>{0.49978289f, 0.415747046f},
-std::array<float,2>{0.0550613701f, 0.695843577f},
-std::array<float,2>{0.842099607f, 0.288090229f},
-std::array<float,2>{0.641630828f, 0.761605799f},
-std::array<float,2>{0.420182973f, 0.106888048f},
-std::array<float,2>{0.362503588f, 0.954021931f},
-std::array<float,2>{0.513990879f, 0.159082234f},
-std::array<float,2>{0.997468948f, 0.612191081f},
-std::array<float,2>{0.24586986f, 0.44010967f},
-std::array<float,2>{0.44378823f, 0.537806332f},
-std::array<float,2>{0.695729673f, 0.38094911f},
-std::array<float,2>{0.787482023f, 0.918809295f},
-std::array<float,2>{0.0655478612f, 0.210343122f},
-std::array<float,2>{0.149501324f, 0.840551436f},
-std::array<float,2>{0.89817977f, 0.0596184097f},
-std::array<float,2>{0.569493234f, 0.655889094f},
-std::array<float,2>{0.291605949f, 0.351586014f},
-std::array<float,2>{0.192608535f, 0.677787483f},
-std::array<float,2>{0.94299686f, 0.341990292f},
-std::array<float,2>{0.535553575f, 0.851224065f},
-std::array<float,2>{0.328041047f, 0.00379582751f},
-std::array<float,2>{0.393725336f, 0.904527366f},
-std::array<float,2>{0.670177102f, 0.223001033f},
-std::array<float,2>{0.865605056f, 0.513443649f},
-std::array<float,2>{0.011902811f, 0.408194125f},
-std::array<float,2>{0.26232028f, 0.589976192f},
-std::array<float,2>{0.613960326f, 0.495453477f},
-std::array<float,2>{0.924944103f, 0.987314761f},
-std::array<float,2>{0.161890969f, 0.146588519f},
-std::array<float,2>{0.121860184f, 0.805261195f},
-std::array<float,2>{0.753763616f, 0.0924645066f},
-std::array<float,2>{0.747596204f, 0.748122096f},
-std::array<float,2>{0.48427555f, 0.26001662f},
-std::array<float,2>{0.0373787358f, 0.542818844f},
-std::array<float,2>{0.813027859f, 0.383200347f},
-std::array<float,2>{0.631301582f, 0.912272573f},
-std::array<float,2>{0.430898339f, 0.214916483f},
-std::array<float,2>{0.344661206f, 0.833984852f},
-std::array<float,2>{0.528379381f, 0.0521864295f},
-std::array<float,2>{0.97051394f, 0.646954119f},
-std::array<float,2>{0.230160832f, 0.3484644f},
-std::array<float,2>{0.455702305f, 0.691670179f},
-std::array<float,2>{0.7109887f, 0.294222564f},
-std::array<float,2>{0.812276602f, 0.753916442f},
-std::array<float,2>{0.0830368698f, 0.0947412103f},
-std::array<float,2>{0.136631131f, 0.966324031f},
-std::array<float,2>{0.878328204f, 0.16826956f},
-std::array<float,2>{0.593347371f, 0.621066332f},
-std::array<float,2>{0.299165845f, 0.448093504f},
-std::array<float,2>{0.178721309f, 0.598765135f},
-std::array<float,2>{0.917863846f, 0.458578467f},
-std::array<float,2>{0.595147491f, 0.948919475f},
-std::array<float,2>{0.268256724f, 0.176057845f},
-std::array<float,2>{0.492238253f, 0.767997801f},
-std::array<float,2>{0.724732518f, 0.117198586f},
-std::array<float,2>{0.771521389f, 0.713617563f},
-std::array<float,2>{0.10659337f, 0.304023504f},
-std::array<float,2>{0.330556244f, 0.631538689f},
-std::array<float,2>{0.555872142f, 0.360966146f},
-std::array<float,2>{0.964723468f, 0.827352107f},
-std::array<float,2>{0.218418807f, 0.0459442548f},
-std::array<float,2>{0.0286229216f, 0.92588383f},
-std::array<float,2>{0.849857152f, 0.196055025f},
-std::array<float,2>{0.683956087f, 0.550985515f},
-std::array<float,2>{0.376285106f, 0.400956035f},
-std::array<float,2>{0.0684157088f, 0.727450848f},
-std::array<float,2>{0.782899499f, 0.277172744f},
-std::array<float,2>{0.700224459f, 0.788656056f},
-std::array<float,2>{0.439188629f, 0.0653607249f},
-std::array<float,2>{0.293674439f, 0.970482707f},
-std::array<float,2>{0.563529909f, 0.131532103f},
-std::array<float,2>{0.892304182f, 0.563030541f},
-std::array<float,2>{0.153047428f, 0.46999675f},
-std::array<float,2>{0.416526169f, 0.521133363f},
-std::array<float,2>{0.645377994f, 0.436802864f},
-std::array<float,2>{0.837319613f, 0.884946048f},
-std::array<float,2>{0.0613287427f, 0.239183694f},
-std::array<float,2>{0.248395219f, 0.873426259f},
-std::array<float,2>{0.994275212f, 0.0305181444f},
-std::array<float,2>{0.51085484f, 0.669534981f},
-std::array<float,2>{0.365365744f, 0.324140877f},
-std::array<float,2>{0.146037534f, 0.703486323f},
-std::array<float,2>{0.905819118f, 0.305793464f},
-std::array<float,2>{0.573996186f, 0.780325711f},
-std::array<float,2>{0.288351953f, 0.11071986f},
-std::array<float,2>{0.449031174f, 0.942137599f},
-std::array<float,2>{0.691554785f, 0.184862569f},
-std::array<float,2>{0.791241288f, 0.604428709f},
-std::array<float,2>{0.0773388147f, 0.466616631f},
-std::array<float,2>{0.370940596f, 0.558708787f},
-std::array<float,2>{0.505758405f, 0.396943867f},
-std::array<float,2>{0.990831196f, 0.936686754f},
-std::array<float,2>{0.23864238f, 0.191195443f},
-std::array<float,2>{0.0475490727f, 0.812893391f},
-std::array<float,2>{0.832765937f, 0.0390136205f},
-std::array<float,2>{0.652882576f, 0.635297358f},
-std::array<float,2>{0.411415428f, 0.371971965f},
-std::array<float,2>{0.0999729633f, 0.574533463f},
-std::array<float,2>{0.77805078f, 0.476692051f},
-std::array<float,2>{0.728542566f, 0.982210815f},
-std::array<float,2>{0.486331612f, 0.134014159f},
-std::array<float,2>{0.276330501f, 0.795364916f},
-std::array<float,2>{0.604323149f, 0.0765538588f},
-std::array<float,2>{0.90726012f, 0.72175765f},
-std::array<float,2>{0.183430672f, 0.269819677f},
-std::array<float,2>{0.385769308f, 0.658526719f},
-std::array<float,2>{0.676053345f, 0.315032959f},
-std::array<float,2>{0.855616212f, 0.865162313f},
-std::array<float,2>{0.0201327577f, 0.0178000554f},
-std::array<float,2>{0.206532016f, 0.87540549f},
-std::array<float,2>{0.956915855f, 0.244270906f},
-std::array<float,2>{0.551638782f, 0.5312379f},
-std::array<float,2>{0.339683592f, 0.422225446f},
-std::array<float,2>{0.221704051f, 0.504867494f},
-std::array<float,2>{0.977967978f, 0.41989255f},
-std::array<float,2>{0.515899479f, 0.893890858f},
-std::array<float,2>{0.359305799f, 0.227444202f},
-std::array<float,2>{0.428250611f, 0.858805656f},
-std::array<float,2>{0.637789369f, 0.0139266243f},
-std::array<float,2>{0.825159073f, 0.681180656f},
-std::array<float,2>{0.0446514525f, 0.335035443f},
-std::array<float,2>{0.305449933f, 0.735469937f},
-std::array<float,2>{0.584028184f, 0.256743908f},
-std::array<float,2>{0.888945282f, 0.798034847f},
-std::array<float,2>{0.132050991f, 0.085873805f},
-std::array<float,2>{0.0936362594f, 0.997334659f},
-std::array<float,2>{0.799623668f, 0.151269063f},
-std::array<float,2>{0.709376991f, 0.578987539f},
-std::array<float,2>{0.465409696f, 0.49107635f},
-std::array<float,2>{0.00723685231f, 0.648687482f},
-std::array<float,2>{0.870078087f, 0.358020604f},
-std::array<float,2>{0.663130701f, 0.838772178f},
-std::array<float,2>{0.401760161f, 0.0584423095f},
-std::array<float,2>{0.318784952f, 0.917766929f},
-std::array<float,2>{0.546367526f, 0.206144333f},
-std::array<float,2>{0.945709169f, 0.533055723f},
-std::array<float,2>{0.199353933f, 0.375729531f},
-std::array<float,2>{0.469966084f, 0.616411686f},
-std::array<float,2>{0.73777622f, 0.443807423f},
-std::array<float,2>{0.762461424f, 0.95957619f},
-std::array<float,2>{0.114908166f, 0.163462728f},
-std::array<float,2>{0.167276263f, 0.762467802f},
-std::array<float,2>{0.929787576f, 0.103396662f},
-std::array<float,2>{0.623659074f, 0.700311303f},
-std::array<float,2>{0.250053734f, 0.282392859f},
-std::array<float,2>{0.207492545f, 0.690488875f},
-std::array<float,2>{0.95826596f, 0.291744441f},
-std::array<float,2>{0.54959029f, 0.752270639f},
-std::array<float,2>{0.340797424f, 0.0981982872f},
-std::array<float,2>{0.389169246f, 0.964075863f},
-std::array<float,2>{0.674509168f, 0.16617386f},
-std::array<float,2>{0.85509944f, 0.62384212f},
-std::array<float,2>{0.0191721562f, 0.451611847f},
-std::array<float,2>{0.278154343f, 0.543795884f},
-std::array<float,2>{0.60725075f, 0.389133781f},
-std::array<float,2>{0.911586165f, 0.908185482f},
-std::array<float,2>{0.185142964f, 0.211355388f},
-std::array<float,2>{0.0969110057f, 0.828435361f},
-std::array<float,2>{0.776039422f, 0.0489079505f},
-std::array<float,2>{0.733082116f, 0.641013443f},
-std::array<float,2>{0.49212727f, 0.345261335f},
-std::array<float,2>{0.0531618595f, 0.589530408f},
-std::array<float,2>{0.82915318f, 0.499982834f},
-std::array<float,2>{0.650639355f, 0.990396142f},
-std::array<float,2>{0.406351626f, 0.142871097f},
-std::array<float,2>{0.373594373f, 0.809192955f},
-std::array<float,2>{0.502803504f, 0.0869678408f},
-std::array<float,2>{0.985524356f, 0.744926453f},
-std::array<float,2>{0.236217812f, 0.262335479f},
-std::array<float,2>{0.451910168f, 0.674837828f},
-std::array<float,2>{0.688074827f, 0.336607069f},
-std::array<float,2>{0.793732345f, 0.847080648f},
-std::array<float,2>{0.0742104501f, 0.00770077202f},
-std::array<float,2>{0.141121909f, 0.90098238f},
-std::array<float,2>{0.899228156f, 0.220650211f},
-std::array<float,2>{0.575745642f, 0.50931114f},
-std::array<float,2>{0.284287095f, 0.411192417f},
-std::array<float,2>{0.169891953f, 0.516892552f},
-std::array<float,2>{0.935154438f, 0.432186306f},
-std::array<float,2>{0.620150506f, 0.889873207f},
-std::array<float,2>{0.255701214f, 0.234497949f},
-std::array<float,2>{0.472716838f, 0.867880762f},
-std::array<float,2>{0.740242183f, 0.0268765856f},
-std::array<float,2>{0.761522651f, 0.664238811f},
-std::array<float,2>{0.109739594f, 0.324240953f},
-std::array<float,2>{0.315315574f, 0.734326899f},
-std::array<float,2>{0.542418838f, 0.277624458f},
-std::array<float,2>{0.95031333f, 0.784098089f},
-std::array<float,2>{0.198767334f, 0.0686193332f},
-std::array<float,2>{0.00357682141f, 0.976540804f},
-std::array<float,2>{0.873300314f, 0.127837241f},
-std::array<float,2>{0.657017112f, 0.570014894f},
-std::array<float,2>{0.406097203f, 0.472998232f},
-std::array<float,2>{0.0898354873f, 0.627543271f},
-std::array<float,2>{0.801075339f, 0.367149413f},
-std::array<float,2>{0.705746412f, 0.823649824f},
-std::array<float,2>{0.462751776f, 0.0406561978f},
-std::array<float,2>{0.312470138f, 0.925183117f},
-std::array<float,2>{0.579642892f, 0.201767966f},
-std::array<float,2>{0.882829547f, 0.547090173f},
-std::array<float,2>{0.128229022f, 0.403147638f},
-std::array<float,2>{0.423577607f, 0.597284734f},
-std::array<float,2>{0.632987499f, 0.453744382f},
-std::array<float,2>{0.82168895f, 0.951389313f},
-std::array<float,2>{0.0406170525f, 0.172131091f},
-std::array<float,2>{0.226141542f, 0.770110369f},
-std::array<float,2>{0.982674778f, 0.121674165f},
-std::array<float,2>{0.522559583f, 0.716683567f},
-std::array<float,2>{0.353248686f, 0.299838871f},
-std::array<float,2>{0.139175624f, 0.663510919f},
-std::array<float,2>{0.879182279f, 0.31774497f},
-std::array<float,2>{0.588254869f, 0.861973584f},
-std::array<float,2>{0.303981245f, 0.0201251153f},
-std::array<float,2>{0.458865613f, 0.878910303f},
-std::array<float,2>{0.715335846f, 0.247937545f},
-std::array<float,2>{0.808391154f, 0.527289748f},
-std::array<float,2>{0.0815192312f, 0.428362817f},
-std::array<float,2>{0.350238472f, 0.570905566f},
-std::array<float,2>{0.525561631f, 0.480661362f},
-std::array<float,2>{0.974029183f, 0.978965044f},
-std::array<float,2>{0.232014522f, 0.136734203f},
-std::array<float,2>{0.0344823785f, 0.789214969f},
-std::array<float,2>{0.817237914f, 0.0739370883f},
-std::array<float,2>{0.625303745f, 0.723821402f},
-std::array<float,2>{0.436309397f, 0.267147005f},
-std::array<float,2>{0.120142542f, 0.556613445f},
-std::array<float,2>{0.754681706f, 0.392215222f},
-std::array<float,2>{0.743593693f, 0.932029068f},
-std::array<float,2>{0.476581931f, 0.192782953f},
-std::array<float,2>{0.258820981f, 0.820053279f},
-std::array<float,2>{0.610062003f, 0.0320439078f},
-std::array<float,2>{0.928266227f, 0.63939029f},
-std::array<float,2>{0.156715155f, 0.370214075f},
-std::array<float,2>{0.397021115f, 0.709079504f},
-std::array<float,2>{0.666909456f, 0.311088115f},
-std::array<float,2>{0.863046467f, 0.77465266f},
-std::array<float,2>{0.00828587264f, 0.114204317f},
-std::array<float,2>{0.189371049f, 0.93850404f},
-std::array<float,2>{0.937665641f, 0.183081642f},
-std::array<float,2>{0.534476876f, 0.608308733f},
-std::array<float,2>{0.320885122f, 0.461140007f},
-std::array<float,2>{0.242227778f, 0.611224353f},
-std::array<float,2>{0.999448776f, 0.437885225f},
-std::array<float,2>{0.51316458f, 0.956008017f},
-std::array<float,2>{0.359652698f, 0.156779826f},
-std::array<float,2>{0.418130815f, 0.758123398f},
-std::array<float,2>{0.643808067f, 0.107792594f},
-std::array<float,2>{0.841747522f, 0.697358966f},
-std::array<float,2>{0.0576497912f, 0.28635937f},
-std::array<float,2>{0.289497674f, 0.654094279f},
-std::array<float,2>{0.567570984f, 0.355047882f},
-std::array<float,2>{0.895041168f, 0.843593776f},
-std::array<float,2>{0.151113957f, 0.0608299784f},
-std::array<float,2>{0.0634670109f, 0.921017468f},
-std::array<float,2>{0.785960972f, 0.207483903f},
-std::array<float,2>{0.697734177f, 0.535307348f},
-std::array<float,2>{0.441680789f, 0.379005879f},
-std::array<float,2>{0.0237805396f, 0.740355253f},
-std::array<float,2>{0.846682549f, 0.251767069f},
-std::array<float,2>{0.683128655f, 0.803959131f},
-std::array<float,2>{0.382676274f, 0.0798700601f},
-std::array<float,2>{0.334492415f, 0.993330777f},
-std::array<float,2>{0.56186825f, 0.155987054f},
-std::array<float,2>{0.965061247f, 0.582561076f},
-std::array<float,2>{0.211845085f, 0.485046744f},
-std::array<float,2>{0.49692145f, 0.503202617f},
-std::array<float,2>{0.720436752f, 0.416343838f},
-std::array<float,2>{0.767173111f, 0.897486866f},
-std::array<float,2>{0.10525874f, 0.23166047f},
-std::array<float,2>{0.172837943f, 0.855407238f},
-std::array<float,2>{0.918858349f, 0.00798298698f},
-std::array<float,2>{0.601289093f, 0.685402811f},
-std::array<float,2>{0.271213979f, 0.331443876f},
-std::array<float,2>{0.227235347f, 0.645041645f},
-std::array<float,2>{0.971060693f, 0.351430297f},
-std::array<float,2>{0.530379832f, 0.833240747f},
-std::array<float,2>{0.346818447f, 0.0531737618f},
-std::array<float,2>{0.431985408f, 0.911626101f},
-std::array<float,2>{0.630026102f, 0.218233898f},
-std::array<float,2>{0.815842628f, 0.540498018f},
-std::array<float,2>{0.0364539325f, 0.384898216f},
-std::array<float,2>{0.298763424f, 0.617619097f},
-std::array<float,2>{0.591792285f, 0.44610396f},
-std::array<float,2>{0.875273943f, 0.967579663f},
-std::array<float,2>{0.134017482f, 0.171227142f},
-std::array<float,2>{0.0840060711f, 0.7570346f},
-std::array<float,2>{0.809570849f, 0.0965522751f},
-std::array<float,2>{0.71312952f, 0.695140719f},
-std::array<float,2>{0.454520166f, 0.296265841f},
-std::array<float,2>{0.0137668988f, 0.514062941f},
-std::array<float,2>{0.864264965f, 0.408664078f},
-std::array<float,2>{0.669450164f, 0.904214323f},
-std::array<float,2>{0.390693873f, 0.225298718f},
-std::array<float,2>{0.325518042f, 0.848888159f},
-std::array<float,2>{0.538532674f, 0.000797070505f},
-std::array<float,2>{0.944276035f, 0.675984979f},
-std::array<float,2>{0.193726629f, 0.340891361f},
-std::array<float,2>{0.48166886f, 0.747987807f},
-std::array<float,2>{0.749624968f, 0.257994294f},
-std::array<float,2>{0.750258863f, 0.80721277f},
-std::array<float,2>{0.124606855f, 0.0916540623f},
-std::array<float,2>{0.163438797f, 0.985157013f},
-std::array<float,2>{0.92348969f, 0.146012262f},
-std::array<float,2>{0.616937101f, 0.59306699f},
-std::array<float,2>{0.264970481f, 0.493624181f},
-std::array<float,2>{0.155934021f, 0.566036582f},
-std::array<float,2>{0.89293021f, 0.471661687f},
-std::array<float,2>{0.565633953f, 0.971600711f},
-std::array<float,2>{0.296384573f, 0.129487917f},
-std::array<float,2>{0.44070214f, 0.785855472f},
-std::array<float,2>{0.701426327f, 0.0631075203f},
-std::array<float,2>{0.783856452f, 0.730271041f},
-std::array<float,2>{0.0681340098f, 0.27365768f},
-std::array<float,2>{0.364143342f, 0.671544433f},
-std::array<float,2>{0.509046137f, 0.320320994f},
-std::array<float,2>{0.994130373f, 0.87166065f},
-std::array<float,2>{0.246673808f, 0.0286176205f},
-std::array<float,2>{0.0591079146f, 0.883827925f},
-std::array<float,2>{0.839229465f, 0.241424039f},
-std::array<float,2>{0.647318721f, 0.523081899f},
-std::array<float,2>{0.414245635f, 0.435139567f},
-std::array<float,2>{0.109019086f, 0.712362289f},
-std::array<float,2>{0.770051062f, 0.301752627f},
-std::array<float,2>{0.723280728f, 0.765856981f},
-std::array<float,2>{0.494699597f, 0.120582573f},
-std::array<float,2>{0.266165733f, 0.945510626f},
-std::array<float,2>{0.596353352f, 0.179561749f},
-std::array<float,2>{0.915889978f, 0.601407707f},
-std::array<float,2>{0.176495254f, 0.460585207f},
-std::array<float,2>{0.377496183f, 0.55306524f},
-std::array<float,2>{0.687074602f, 0.400118053f},
-std::array<float,2>{0.847670972f, 0.928337634f},
-std::array<float,2>{0.0307288524f, 0.199181631f},
-std::array<float,2>{0.214912385f, 0.825555503f},
-std::array<float,2>{0.962875664f, 0.0429846831f},
-std::array<float,2>{0.558472693f, 0.630326927f},
-std::array<float,2>{0.328498125f, 0.361548662f},
-std::array<float,2>{0.179874539f, 0.719058931f},
-std::array<float,2>{0.908956885f, 0.273246169f},
-std::array<float,2>{0.603241444f, 0.794463158f},
-std::array<float,2>{0.274855256f, 0.0751586333f},
-std::array<float,2>{0.485003591f, 0.983012259f},
-std::array<float,2>{0.727404714f, 0.136290938f},
-std::array<float,2>{0.779631436f, 0.576432168f},
-std::array<float,2>{0.0991167873f, 0.480255514f},
-std::array<float,2>{0.337070346f, 0.527777016f},
-std::array<float,2>{0.554446995f, 0.424219131f},
-std::array<float,2>{0.953187823f, 0.878029704f},
-std::array<float,2>{0.204905316f, 0.244082734f},
-std::array<float,2>{0.0223475043f, 0.866741478f},
-std::array<float,2>{0.859123588f, 0.0171457883f},
-std::array<float,2>{0.679274142f, 0.65817976f},
-std::array<float,2>{0.384169668f, 0.312996894f},
-std::array<float,2>{0.0759636164f, 0.603472769f},
-std::array<float,2>{0.790486336f, 0.466851026f},
-std::array<float,2>{0.693987846f, 0.943784595f},
-std::array<float,2>{0.446127892f, 0.187036842f},
-std::array<float,2>{0.286742121f, 0.777514696f},
-std::array<float,2>{0.571771622f, 0.112891212f},
-std::array<float,2>{0.903439343f, 0.706653833f},
-std::array<float,2>{0.146783069f, 0.306755394f},
-std::array<float,2>{0.413025618f, 0.632879615f},
-std::array<float,2>{0.655694187f, 0.37350446f},
-std::array<float,2>{0.835309446f, 0.816279769f},
-std::array<float,2>{0.0494601578f, 0.0355729796f},
-std::array<float,2>{0.241710365f, 0.934280157f},
-std::array<float,2>{0.989001513f, 0.18785511f},
-std::array<float,2>{0.507646799f, 0.560989439f},
-std::array<float,2>{0.367248356f, 0.396354914f},
-std::array<float,2>{0.202963531f, 0.533532143f},
-std::array<float,2>{0.948028386f, 0.377056479f},
-std::array<float,2>{0.543798327f, 0.91561389f},
-std::array<float,2>{0.31777814f, 0.204194233f},
-std::array<float,2>{0.399650574f, 0.83721143f},
-std::array<float,2>{0.661346853f, 0.0561792031f},
-std::array<float,2>{0.868703067f, 0.650524259f},
-std::array<float,2>{0.00432802876f, 0.357375175f},
-std::array<float,2>{0.253732592f, 0.702062726f},
-std::array<float,2>{0.621349514f, 0.28391099f},
-std::array<float,2>{0.932340026f, 0.764037967f},
-std::array<float,2>{0.165339127f, 0.104703479f},
-std::array<float,2>{0.116143368f, 0.958895028f},
-std::array<float,2>{0.764090598f, 0.161429182f},
-std::array<float,2>{0.736166358f, 0.613282621f},
-std::array<float,2>{0.471032381f, 0.442993909f},
-std::array<float,2>{0.0454556942f, 0.681793869f},
-std::array<float,2>{0.827308536f, 0.33275485f},
-std::array<float,2>{0.640224993f, 0.855535388f},
-std::array<float,2>{0.426620573f, 0.0122190425f},
-std::array<float,2>{0.356904417f, 0.892334759f},
-std::array<float,2>{0.518896282f, 0.228739783f},
-std::array<float,2>{0.979750574f, 0.507661521f},
-std::array<float,2>{0.219819665f, 0.421500534f},
-std::array<float,2>{0.467615336f, 0.580492854f},
-std::array<float,2>{0.707290113f, 0.490019083f},
-std::array<float,2>{0.797643125f, 0.998645306f},
-std::array<float,2>{0.0899199843f, 0.149593338f},
-std::array<float,2>{0.130438551f, 0.799317062f},
-std::array<float,2>{0.888045371f, 0.0828023702f},
-std::array<float,2>{0.58332485f, 0.737428367f},
-std::array<float,2>{0.30807066f, 0.254214615f},
-std::array<float,2>{0.197801232f, 0.732328475f},
-std::array<float,2>{0.949683547f, 0.280680865f},
-std::array<float,2>{0.541405082f, 0.782114625f},
-std::array<float,2>{0.316188574f, 0.0672459379f},
-std::array<float,2>{0.404381126f, 0.973816693f},
-std::array<float,2>{0.65732187f, 0.125070959f},
-std::array<float,2>{0.874680519f, 0.567577302f},
-std::array<float,2>{0.0023208675f, 0.475482941f},
-std::array<float,2>{0.254648685f, 0.519077063f},
-std::array<float,2>{0.619649649f, 0.431070536f},
-std::array<float,2>{0.933990419f, 0.888198853f},
-std::array<float,2>{0.168432906f, 0.236400366f},
-std::array<float,2>{0.110358179f, 0.870086193f},
-std::array<float,2>{0.760189116f, 0.0251643658f},
-std::array<float,2>{0.742136896f, 0.667251348f},
-std::array<float,2>{0.474391699f, 0.326685488f},
-std::array<float,2>{0.0397465378f, 0.595545709f},
-std::array<float,2>{0.82104063f, 0.456675947f},
-std::array<float,2>{0.634564817f, 0.949415445f},
-std::array<float,2>{0.422170043f, 0.174121201f},
-std::array<float,2>{0.352536142f, 0.771563172f},
-std::array<float,2>{0.522443473f, 0.124964215f},
-std::array<float,2>{0.984282553f, 0.718250394f},
-std::array<float,2>{0.224817678f, 0.297918648f},
-std::array<float,2>{0.461027473f, 0.625739992f},
-std::array<float,2>{0.706603408f, 0.363962352f},
-std::array<float,2>{0.801879048f, 0.820389926f},
-std::array<float,2>{0.088284269f, 0.0419299863f},
-std::array<float,2>{0.127181649f, 0.922325552f},
-std::array<float,2>{0.884469569f, 0.200899512f},
-std::array<float,2>{0.578657925f, 0.549778581f},
-std::array<float,2>{0.311074585f, 0.404466629f},
-std::array<float,2>{0.183726504f, 0.545963347f},
-std::array<float,2>{0.91110605f, 0.388609767f},
-std::array<float,2>{0.606158733f, 0.909898281f},
-std::array<float,2>{0.27896589f, 0.214269638f},
-std::array<float,2>{0.490350366f, 0.83065623f},
-std::array<float,2>{0.733431458f, 0.0481077544f},
-std::array<float,2>{0.777121723f, 0.643615901f},
-std::array<float,2>{0.0962512195f, 0.346534908f},
-std::array<float,2>{0.341309845f, 0.688411653f},
-std::array<float,2>{0.550135851f, 0.290320486f},
-std::array<float,2>{0.957320273f, 0.751878917f},
-std::array<float,2>{0.208936781f, 0.100449719f},
-std::array<float,2>{0.018269781f, 0.962064981f},
-std::array<float,2>{0.854058027f, 0.164946094f},
-std::array<float,2>{0.675333381f, 0.622858644f},
-std::array<float,2>{0.390620291f, 0.449411035f},
-std::array<float,2>{0.0730523244f, 0.672998905f},
-std::array<float,2>{0.794005871f, 0.338148624f},
-std::array<float,2>{0.688944459f, 0.84545207f},
-std::array<float,2>{0.452790529f, 0.00505797332f},
-std::array<float,2>{0.283636034f, 0.90003413f},
-std::array<float,2>{0.574246585f, 0.222359836f},
-std::array<float,2>{0.900110543f, 0.510446012f},
-std::array<float,2>{0.142026246f, 0.413436264f},
-std::array<float,2>{0.408007711f, 0.586176157f},
-std::array<float,2>{0.651897073f, 0.496173203f},
-std::array<float,2>{0.82863605f, 0.989004374f},
-std::array<float,2>{0.0537737273f, 0.141115695f},
-std::array<float,2>{0.235031366f, 0.811936915f},
-std::array<float,2>{0.98439467f, 0.0886802822f},
-std::array<float,2>{0.503251672f, 0.74313128f},
-std::array<float,2>{0.374117017f, 0.264421225f},
-std::array<float,2>{0.152197033f, 0.654533386f},
-std::array<float,2>{0.896360219f, 0.353439122f},
-std::array<float,2>{0.56731087f, 0.841605008f},
-std::array<float,2>{0.290436327f, 0.0588867217f},
-std::array<float,2>{0.443053454f, 0.919530094f},
-std::array<float,2>{0.69826889f, 0.209271044f},
-std::array<float,2>{0.786238313f, 0.539050281f},
-std::array<float,2>{0.0643018335f, 0.382349283f},
-std::array<float,2>{0.360681146f, 0.613276839f},
-std::array<float,2>{0.512242556f, 0.440626472f},
-std::array<float,2>{0.998220086f, 0.954259932f},
-std::array<float,2>{0.243399888f, 0.159609944f},
-std::array<float,2>{0.0574432798f, 0.76051265f},
-std::array<float,2>{0.840525746f, 0.106177285f},
-std::array<float,2>{0.643476903f, 0.696885943f},
-std::array<float,2>{0.419786721f, 0.287534386f},
-std::array<float,2>{0.104388528f, 0.500548184f},
-std::array<float,2>{0.765759349f, 0.414588749f},
-std::array<float,2>{0.719385087f, 0.8949247f},
-std::array<float,2>{0.498004377f, 0.23254934f},
-std::array<float,2>{0.269701809f, 0.85264039f},
-std::array<float,2>{0.600399733f, 0.0104762549f},
-std::array<float,2>{0.919298172f, 0.685957551f},
-std::array<float,2>{0.173224092f, 0.328273088f},
-std::array<float,2>{0.381036431f, 0.738650918f},
-std::array<float,2>{0.682454407f, 0.253714979f},
-std::array<float,2>{0.846336246f, 0.802223742f},
-std::array<float,2>{0.0252185538f, 0.0811483413f},
-std::array<float,2>{0.211995348f, 0.995659709f},
-std::array<float,2>{0.966659665f, 0.152955338f},
-std::array<float,2>{0.56113112f, 0.584586561f},
-std::array<float,2>{0.335059226f, 0.488115072f},
-std::array<float,2>{0.2305637f, 0.572584391f},
-std::array<float,2>{0.97352916f, 0.482743889f},
-std::array<float,2>{0.526726484f, 0.977088988f},
-std::array<float,2>{0.351439834f, 0.140570551f},
-std::array<float,2>{0.436785191f, 0.792553186f},
-std::array<float,2>{0.626650155f, 0.0710536614f},
-std::array<float,2>{0.817430258f, 0.725422084f},
-std::array<float,2>{0.0332674123f, 0.268402249f},
-std::array<float,2>{0.303416222f, 0.660679996f},
-std::array<float,2>{0.589807689f, 0.319638848f},
-std::array<float,2>{0.880093038f, 0.860396922f},
-std::array<float,2>{0.140542433f, 0.0223766509f},
-std::array<float,2>{0.0803463608f, 0.880928218f},
-std::array<float,2>{0.807564616f, 0.249309078f},
-std::array<float,2>{0.716602385f, 0.523788869f},
-std::array<float,2>{0.457542002f, 0.426950902f},
-std::array<float,2>{0.00887128524f, 0.707296371f},
-std::array<float,2>{0.862122953f, 0.308904856f},
-std::array<float,2>{0.667944133f, 0.775443792f},
-std::array<float,2>{0.398218304f, 0.115527198f},
-std::array<float,2>{0.322012186f, 0.939882338f},
-std::array<float,2>{0.533887625f, 0.181417301f},
-std::array<float,2>{0.938592136f, 0.606940031f},
-std::array<float,2>{0.188430712f, 0.4638004f},
-std::array<float,2>{0.478094965f, 0.557849407f},
-std::array<float,2>{0.742492259f, 0.393378258f},
-std::array<float,2>{0.755695403f, 0.930939376f},
-std::array<float,2>{0.119184092f, 0.195036873f},
-std::array<float,2>{0.157370031f, 0.817389131f},
-std::array<float,2>{0.929523349f, 0.0340628102f},
-std::array<float,2>{0.610736549f, 0.636947751f},
-std::array<float,2>{0.258027583f, 0.368783444f},
-std::array<float,2>{0.247884452f, 0.668092072f},
-std::array<float,2>{0.992913544f, 0.323221833f},
-std::array<float,2>{0.508193374f, 0.874032795f},
-std::array<float,2>{0.365137994f, 0.029442003f},
-std::array<float,2>{0.415474355f, 0.886643767f},
-std::array<float,2>{0.647852957f, 0.239263833f},
-std::array<float,2>{0.838005662f, 0.519765377f},
-std::array<float,2>{0.0595725738f, 0.436348081f},
-std::array<float,2>{0.294976205f, 0.563584268f},
-std::array<float,2>{0.564664602f, 0.469138831f},
-std::array<float,2>{0.893984973f, 0.969123602f},
-std::array<float,2>{0.15490301f, 0.132378861f},
-std::array<float,2>{0.0667935014f, 0.787735641f},
-std::array<float,2>{0.785013795f, 0.0658936575f},
-std::array<float,2>{0.703113973f, 0.727958918f},
-std::array<float,2>{0.44028154f, 0.275615066f},
-std::array<float,2>{0.0294283219f, 0.551960409f},
-std::array<float,2>{0.848984778f, 0.40167129f},
-std::array<float,2>{0.686398029f, 0.926874816f},
-std::array<float,2>{0.378222376f, 0.196477398f},
-std::array<float,2>{0.329148114f, 0.826871514f},
-std::array<float,2>{0.556762576f, 0.0449430197f},
-std::array<float,2>{0.961538196f, 0.632609844f},
-std::array<float,2>{0.216331258f, 0.360340565f},
-std::array<float,2>{0.495504349f, 0.714528143f},
-std::array<float,2>{0.723745525f, 0.303352177f},
-std::array<float,2>{0.770735979f, 0.768975198f},
-std::array<float,2>{0.107563555f, 0.119052567f},
-std::array<float,2>{0.177575856f, 0.947577655f},
-std::array<float,2>{0.914418817f, 0.177197784f},
-std::array<float,2>{0.597593725f, 0.597668052f},
-std::array<float,2>{0.267325222f, 0.457038939f},
-std::array<float,2>{0.133187547f, 0.619243681f},
-std::array<float,2>{0.876761436f, 0.449169666f},
-std::array<float,2>{0.590556324f, 0.965679288f},
-std::array<float,2>{0.296932548f, 0.169429794f},
-std::array<float,2>{0.4534567f, 0.755366743f},
-std::array<float,2>{0.714289665f, 0.0945695043f},
-std::array<float,2>{0.809536397f, 0.693070769f},
-std::array<float,2>{0.0856175423f, 0.293718606f},
-std::array<float,2>{0.346032381f, 0.64778471f},
-std::array<float,2>{0.530119777f, 0.349590868f},
-std::array<float,2>{0.972357035f, 0.835446835f},
-std::array<float,2>{0.228061616f, 0.0516463183f},
-std::array<float,2>{0.035525009f, 0.913494349f},
-std::array<float,2>{0.814756632f, 0.216218978f},
-std::array<float,2>{0.62982738f, 0.54171592f},
-std::array<float,2>{0.433452874f, 0.384128213f},
-std::array<float,2>{0.124007188f, 0.749878585f},
-std::array<float,2>{0.75149262f, 0.261052758f},
-std::array<float,2>{0.748117507f, 0.805939198f},
-std::array<float,2>{0.481408805f, 0.0933876485f},
-std::array<float,2>{0.264646202f, 0.986539721f},
-std::array<float,2>{0.61563772f, 0.147833303f},
-std::array<float,2>{0.922237158f, 0.590895534f},
-std::array<float,2>{0.162438855f, 0.494299084f},
-std::array<float,2>{0.391822994f, 0.512612283f},
-std::array<float,2>{0.668758631f, 0.406550854f},
-std::array<float,2>{0.863408267f, 0.906066537f},
-std::array<float,2>{0.0155008556f, 0.224014893f},
-std::array<float,2>{0.194413483f, 0.84985733f},
-std::array<float,2>{0.945036173f, 0.00282754214f},
-std::array<float,2>{0.538062692f, 0.679101646f},
-std::array<float,2>{0.324750423f, 0.343521357f},
-std::array<float,2>{0.164607763f, 0.699483037f},
-std::array<float,2>{0.933177888f, 0.281837881f},
-std::array<float,2>{0.622400939f, 0.762856603f},
-std::array<float,2>{0.252207309f, 0.102184296f},
-std::array<float,2>{0.47182551f, 0.960303247f},
-std::array<float,2>{0.734633863f, 0.162753254f},
-std::array<float,2>{0.765459299f, 0.615244925f},
-std::array<float,2>{0.116830006f, 0.444977999f},
-std::array<float,2>{0.317124486f, 0.531812847f},
-std::array<float,2>{0.544399023f, 0.376582146f},
-std::array<float,2>{0.948352277f, 0.91652745f},
-std::array<float,2>{0.202089056f, 0.205698296f},
-std::array<float,2>{0.00504207704f, 0.839162052f},
-std::array<float,2>{0.867749453f, 0.0572002046f},
-std::array<float,2>{0.660658538f, 0.649730325f},
-std::array<float,2>{0.399399936f, 0.359136462f},
-std::array<float,2>{0.0913961157f, 0.579842091f},
-std::array<float,2>{0.798228145f, 0.491245896f},
-std::array<float,2>{0.708807111f, 0.996923447f},
-std::array<float,2>{0.468366623f, 0.152297795f},
-std::array<float,2>{0.307374358f, 0.796896935f},
-std::array<float,2>{0.582204163f, 0.0847691149f},
-std::array<float,2>{0.886995018f, 0.735123098f},
-std::array<float,2>{0.129581764f, 0.257313907f},
-std::array<float,2>{0.427449882f, 0.680270255f},
-std::array<float,2>{0.639084995f, 0.334006786f},
-std::array<float,2>{0.827107489f, 0.858375251f},
-std::array<float,2>{0.046435412f, 0.0154991187f},
-std::array<float,2>{0.219420284f, 0.892797947f},
-std::array<float,2>{0.979249537f, 0.228289872f},
-std::array<float,2>{0.517988682f, 0.505316496f},
-std::array<float,2>{0.355708778f, 0.418096185f},
-std::array<float,2>{0.203910112f, 0.529536009f},
-std::array<float,2>{0.95417124f, 0.422869384f},
-std::array<float,2>{0.552762389f, 0.876926124f},
-std::array<float,2>{0.336779743f, 0.245555818f},
-std::array<float,2>{0.382855177f, 0.863755643f},
-std::array<float,2>{0.67836839f, 0.0194170959f},
-std::array<float,2>{0.857630551f, 0.659918249f},
-std::array<float,2>{0.0233785845f, 0.316150695f},
-std::array<float,2>{0.27403897f, 0.721179843f},
-std::array<float,2>{0.602113068f, 0.27095598f},
-std::array<float,2>{0.909408212f, 0.796112418f},
-std::array<float,2>{0.181317896f, 0.0776534528f},
-std::array<float,2>{0.0977643728f, 0.98125869f},
-std::array<float,2>{0.780812681f, 0.133186311f},
-std::array<float,2>{0.727660537f, 0.575588942f},
-std::array<float,2>{0.485446453f, 0.477663934f},
-std::array<float,2>{0.0501159653f, 0.636353672f},
-std::array<float,2>{0.83434099f, 0.372077525f},
-std::array<float,2>{0.654984176f, 0.814265788f},
-std::array<float,2>{0.413705528f, 0.0371966101f},
-std::array<float,2>{0.368721187f, 0.936233222f},
-std::array<float,2>{0.506540179f, 0.19005999f},
-std::array<float,2>{0.989934623f, 0.559812903f},
-std::array<float,2>{0.240673453f, 0.397467971f},
-std::array<float,2>{0.44663465f, 0.604572952f},
-std::array<float,2>{0.695229948f, 0.465340167f},
-std::array<float,2>{0.789394677f, 0.94267267f},
-std::array<float,2>{0.0745743513f, 0.184470206f},
-std::array<float,2>{0.147904322f, 0.779980302f},
-std::array<float,2>{0.902435184f, 0.109818533f},
-std::array<float,2>{0.570345938f, 0.704425335f},
-std::array<float,2>{0.286107153f, 0.304695427f},
-std::array<float,2>{0.223239496f, 0.715329349f},
-std::array<float,2>{0.981227398f, 0.299065024f},
-std::array<float,2>{0.520428658f, 0.770984709f},
-std::array<float,2>{0.353804082f, 0.122564472f},
-std::array<float,2>{0.425716251f, 0.952582717f},
-std::array<float,2>{0.636539042f, 0.173710898f},
-std::array<float,2>{0.822859406f, 0.595811903f},
-std::array<float,2>{0.0424355455f, 0.454572916f},
-std::array<float,2>{0.310200185f, 0.548749626f},
-std::array<float,2>{0.58024466f, 0.404081017f},
-std::array<float,2>{0.885408223f, 0.924047947f},
-std::array<float,2>{0.125199765f, 0.202352539f},
-std::array<float,2>{0.0874499232f, 0.822387815f},
-std::array<float,2>{0.802988648f, 0.0398607403f},
-std::array<float,2>{0.70379287f, 0.628336012f},
-std::array<float,2>{0.463184357f, 0.366104484f},
-std::array<float,2>{0.000560678542f, 0.568486869f},
-std::array<float,2>{0.871171355f, 0.474353522f},
-std::array<float,2>{0.658560991f, 0.975315928f},
-std::array<float,2>{0.403848886f, 0.128446206f},
-std::array<float,2>{0.313588053f, 0.784184456f},
-std::array<float,2>{0.539830625f, 0.069845818f},
-std::array<float,2>{0.952924967f, 0.732921541f},
-std::array<float,2>{0.196932048f, 0.278750747f},
-std::array<float,2>{0.475605279f, 0.665782154f},
-std::array<float,2>{0.739506483f, 0.325547159f},
-std::array<float,2>{0.758230746f, 0.86875242f},
-std::array<float,2>{0.112803616f, 0.025841821f},
-std::array<float,2>{0.171377704f, 0.888932347f},
-std::array<float,2>{0.936192155f, 0.235856518f},
-std::array<float,2>{0.617274106f, 0.515886962f},
-std::array<float,2>{0.256973207f, 0.432655901f},
-std::array<float,2>{0.142587245f, 0.507913888f},
-std::array<float,2>{0.900975525f, 0.411129296f},
-std::array<float,2>{0.577037096f, 0.901765585f},
-std::array<float,2>{0.281929255f, 0.219600275f},
-std::array<float,2>{0.450110734f, 0.846041083f},
-std::array<float,2>{0.690645099f, 0.00587374065f},
-std::array<float,2>{0.795325041f, 0.674588263f},
-std::array<float,2>{0.0714991689f, 0.337186992f},
-std::array<float,2>{0.372153938f, 0.745476127f},
-std::array<float,2>{0.501355767f, 0.263236046f},
-std::array<float,2>{0.986751676f, 0.810144901f},
-std::array<float,2>{0.238122478f, 0.0864446536f},
-std::array<float,2>{0.0521091036f, 0.991341591f},
-std::array<float,2>{0.830551982f, 0.144302323f},
-std::array<float,2>{0.648748577f, 0.588039756f},
-std::array<float,2>{0.40874809f, 0.498916954f},
-std::array<float,2>{0.0953020751f, 0.64200151f},
-std::array<float,2>{0.77370888f, 0.344722629f},
-std::array<float,2>{0.731675386f, 0.82923007f},
-std::array<float,2>{0.488988489f, 0.0501393601f},
-std::array<float,2>{0.280813515f, 0.906386971f},
-std::array<float,2>{0.607531309f, 0.212076366f},
-std::array<float,2>{0.913804471f, 0.544455707f},
-std::array<float,2>{0.186037347f, 0.390036315f},
-std::array<float,2>{0.387499571f, 0.624810755f},
-std::array<float,2>{0.672304928f, 0.453013003f},
-std::array<float,2>{0.853230119f, 0.962964237f},
-std::array<float,2>{0.0161302332f, 0.167266816f},
-std::array<float,2>{0.210153788f, 0.753240407f},
-std::array<float,2>{0.959996343f, 0.0988925993f},
-std::array<float,2>{0.547071159f, 0.689705014f},
-std::array<float,2>{0.342880428f, 0.292855114f},
-std::array<float,2>{0.173880994f, 0.683989644f},
-std::array<float,2>{0.921805203f, 0.330662072f},
-std::array<float,2>{0.598762393f, 0.853638887f},
-std::array<float,2>{0.2733832f, 0.00894571468f},
-std::array<float,2>{0.498866498f, 0.896722496f},
-std::array<float,2>{0.721273005f, 0.230611578f},
-std::array<float,2>{0.768704236f, 0.502431333f},
-std::array<float,2>{0.101835504f, 0.417925268f},
-std::array<float,2>{0.332801104f, 0.583475471f},
-std::array<float,2>{0.560023427f, 0.485478044f},
-std::array<float,2>{0.967438102f, 0.992958605f},
-std::array<float,2>{0.214764535f, 0.154802293f},
-std::array<float,2>{0.0255437735f, 0.803384364f},
-std::array<float,2>{0.844964147f, 0.0786269531f},
-std::array<float,2>{0.681400418f, 0.74180007f},
-std::array<float,2>{0.379051358f, 0.250347048f},
-std::array<float,2>{0.0646212325f, 0.536354065f},
-std::array<float,2>{0.788600504f, 0.380689979f},
-std::array<float,2>{0.696493387f, 0.920109689f},
-std::array<float,2>{0.445231229f, 0.208204821f},
-std::array<float,2>{0.292020559f, 0.842321575f},
-std::array<float,2>{0.568695724f, 0.0621758699f},
-std::array<float,2>{0.896804869f, 0.652507424f},
-std::array<float,2>{0.149102688f, 0.353675425f},
-std::array<float,2>{0.421779752f, 0.698527157f},
-std::array<float,2>{0.640931308f, 0.285920739f},
-std::array<float,2>{0.843248725f, 0.759474635f},
-std::array<float,2>{0.0561323091f, 0.108827233f},
-std::array<float,2>{0.244846418f, 0.956230581f},
-std::array<float,2>{0.996392369f, 0.157741144f},
-std::array<float,2>{0.515172184f, 0.610142231f},
-std::array<float,2>{0.361955583f, 0.438609272f},
-std::array<float,2>{0.191305414f, 0.609209895f},
-std::array<float,2>{0.941289127f, 0.462602735f},
-std::array<float,2>{0.531831861f, 0.93783015f},
-std::array<float,2>{0.322528243f, 0.182030469f},
-std::array<float,2>{0.396270961f, 0.773852527f},
-std::array<float,2>{0.66511631f, 0.114924826f},
-std::array<float,2>{0.859730601f, 0.710148394f},
-std::array<float,2>{0.0110127302f, 0.312445432f},
-std::array<float,2>{0.26160565f, 0.640622675f},
-std::array<float,2>{0.611489296f, 0.369968086f},
-std::array<float,2>{0.92691344f, 0.819141865f},
-std::array<float,2>{0.158390224f, 0.0331953503f},
-std::array<float,2>{0.118925393f, 0.932974815f},
-std::array<float,2>{0.757775962f, 0.192122832f},
-std::array<float,2>{0.746085107f, 0.555044711f},
-std::array<float,2>{0.478791207f, 0.390683442f},
-std::array<float,2>{0.0318624042f, 0.72304064f},
-std::array<float,2>{0.819575608f, 0.266115963f},
-std::array<float,2>{0.628788948f, 0.790326715f},
-std::array<float,2>{0.43548283f, 0.0723356158f},
-std::array<float,2>{0.349048883f, 0.980041564f},
-std::array<float,2>{0.525176287f, 0.13782461f},
-std::array<float,2>{0.975294054f, 0.572226465f},
-std::array<float,2>{0.233762398f, 0.481703103f},
-std::array<float,2>{0.459776729f, 0.525534928f},
-std::array<float,2>{0.717926025f, 0.428863674f},
-std::array<float,2>{0.805544257f, 0.880086482f},
-std::array<float,2>{0.0791985318f, 0.246269509f},
-std::array<float,2>{0.138104498f, 0.863262594f},
-std::array<float,2>{0.882153749f, 0.0213412885f},
-std::array<float,2>{0.58638823f, 0.662631094f},
-std::array<float,2>{0.301357806f, 0.3170093f},
-std::array<float,2>{0.217204362f, 0.62895602f},
-std::array<float,2>{0.96315515f, 0.362544119f},
-std::array<float,2>{0.555015683f, 0.824318409f},
-std::array<float,2>{0.331679851f, 0.0447860546f},
-std::array<float,2>{0.375742793f, 0.928923845f},
-std::array<float,2>{0.685016572f, 0.198190212f},
-std::array<float,2>{0.85141021f, 0.55432713f},
-std::array<float,2>{0.0282586832f, 0.399089575f},
-std::array<float,2>{0.268585473f, 0.599864364f},
-std::array<float,2>{0.594064891f, 0.459471613f},
-std::array<float,2>{0.916363776f, 0.946430266f},
-std::array<float,2>{0.178477317f, 0.177818f},
-std::array<float,2>{0.106225833f, 0.766661465f},
-std::array<float,2>{0.772966802f, 0.119766749f},
-std::array<float,2>{0.726462722f, 0.711881042f},
-std::array<float,2>{0.493444443f, 0.302605212f},
-std::array<float,2>{0.0622508079f, 0.522079706f},
-std::array<float,2>{0.836773276f, 0.434456468f},
-std::array<float,2>{0.64615953f, 0.883257806f},
-std::array<float,2>{0.417696029f, 0.241016254f},
-std::array<float,2>{0.367020637f, 0.872172713f},
-std::array<float,2>{0.510535777f, 0.0282188188f},
-std::array<float,2>{0.995980084f, 0.670433819f},
-std::array<float,2>{0.249782935f, 0.32206291f},
-std::array<float,2>{0.437546492f, 0.728856564f},
-std::array<float,2>{0.699298143f, 0.27537483f},
-std::array<float,2>{0.781559646f, 0.786687851f},
-std::array<float,2>{0.0696820989f, 0.0643961802f},
-std::array<float,2>{0.154212371f, 0.971876979f},
-std::array<float,2>{0.891386867f, 0.130709022f},
-std::array<float,2>{0.562726736f, 0.565147877f},
-std::array<float,2>{0.294712007f, 0.472096145f},
-std::array<float,2>{0.160705492f, 0.592131555f},
-std::array<float,2>{0.924333334f, 0.492297709f},
-std::array<float,2>{0.614592493f, 0.986277103f},
-std::array<float,2>{0.263329685f, 0.145299986f},
-std::array<float,2>{0.483133256f, 0.807666302f},
-std::array<float,2>{0.746313572f, 0.090734005f},
-std::array<float,2>{0.752007604f, 0.746473968f},
-std::array<float,2>{0.12251246f, 0.259181857f},
-std::array<float,2>{0.326775074f, 0.676763117f},
-std::array<float,2>{0.536926746f, 0.340232402f},
-std::array<float,2>{0.941830456f, 0.847974777f},
-std::array<float,2>{0.191567302f, 0.00158398808f},
-std::array<float,2>{0.0128756985f, 0.902617753f},
-std::array<float,2>{0.86660713f, 0.226532772f},
-std::array<float,2>{0.671157777f, 0.515429854f},
-std::array<float,2>{0.393064171f, 0.410074621f},
-std::array<float,2>{0.0827151313f, 0.693556726f},
-std::array<float,2>{0.81074518f, 0.295111239f},
-std::array<float,2>{0.712230325f, 0.75633961f},
-std::array<float,2>{0.456827968f, 0.0971295014f},
-std::array<float,2>{0.300304651f, 0.9684484f},
-std::array<float,2>{0.592218637f, 0.170841306f},
-std::array<float,2>{0.877159059f, 0.618987262f},
-std::array<float,2>{0.135687724f, 0.446533918f},
-std::array<float,2>{0.430646122f, 0.539303064f},
-std::array<float,2>{0.63257128f, 0.386519641f},
-std::array<float,2>{0.813910902f, 0.910304487f},
-std::array<float,2>{0.0389003977f, 0.21745719f},
-std::array<float,2>{0.229105785f, 0.832098067f},
-std::array<float,2>{0.968782008f, 0.0538760982f},
-std::array<float,2>{0.527511358f, 0.645895839f},
-std::array<float,2>{0.345588028f, 0.349656165f},
-std::array<float,2>{0.131819427f, 0.736495435f},
-std::array<float,2>{0.890530705f, 0.255432785f},
-std::array<float,2>{0.585553527f, 0.800670087f},
-std::array<float,2>{0.30603072f, 0.0835423097f},
-std::array<float,2>{0.466607302f, 0.999490857f},
-std::array<float,2>{0.710781872f, 0.148831442f},
-std::array<float,2>{0.800506055f, 0.581465304f},
-std::array<float,2>{0.0919651091f, 0.48906377f},
-std::array<float,2>{0.358294159f, 0.50589937f},
-std::array<float,2>{0.517155588f, 0.420202136f},
-std::array<float,2>{0.977460086f, 0.891254187f},
-std::array<float,2>{0.221524388f, 0.230060697f},
-std::array<float,2>{0.0429964922f, 0.857161939f},
-std::array<float,2>{0.825343728f, 0.0130927414f},
-std::array<float,2>{0.637474537f, 0.683125317f},
-std::array<float,2>{0.429513752f, 0.333060563f},
-std::array<float,2>{0.113794491f, 0.614901006f},
-std::array<float,2>{0.76325053f, 0.441685766f},
-std::array<float,2>{0.736547232f, 0.957482994f},
-std::array<float,2>{0.46969825f, 0.160799667f},
-std::array<float,2>{0.251614183f, 0.765471935f},
-std::array<float,2>{0.624186575f, 0.104045235f},
-std::array<float,2>{0.93160063f, 0.703021705f},
-std::array<float,2>{0.16680631f, 0.284248769f},
-std::array<float,2>{0.401068509f, 0.652036905f},
-std::array<float,2>{0.662440956f, 0.356145501f},
-std::array<float,2>{0.870852649f, 0.836462915f},
-std::array<float,2>{0.00620659068f, 0.0554568246f},
-std::array<float,2>{0.200798884f, 0.914576054f},
-std::array<float,2>{0.946922004f, 0.203609452f},
-std::array<float,2>{0.545371592f, 0.534215868f},
-std::array<float,2>{0.319669038f, 0.378467649f},
-std::array<float,2>{0.239288419f, 0.561581016f},
-std::array<float,2>{0.991728246f, 0.395097673f},
-std::array<float,2>{0.504267991f, 0.934777677f},
-std::array<float,2>{0.369273633f, 0.189416885f},
-std::array<float,2>{0.410174906f, 0.815248013f},
-std::array<float,2>{0.653972864f, 0.0370862782f},
-std::array<float,2>{0.833407581f, 0.63441962f},
-std::array<float,2>{0.0484326109f, 0.374973476f},
-std::array<float,2>{0.287636817f, 0.705107093f},
-std::array<float,2>{0.57240504f, 0.307823837f},
-std::array<float,2>{0.904831171f, 0.778476536f},
-std::array<float,2>{0.145228058f, 0.111469738f},
-std::array<float,2>{0.0770994872f, 0.945057154f},
-std::array<float,2>{0.792444527f, 0.185642526f},
-std::array<float,2>{0.693053603f, 0.602374613f},
-std::array<float,2>{0.447885901f, 0.468626112f},
-std::array<float,2>{0.0211669318f, 0.657185674f},
-std::array<float,2>{0.857410371f, 0.314169049f},
-std::array<float,2>{0.677091718f, 0.86608541f},
-std::array<float,2>{0.385162294f, 0.0161610693f},
-std::array<float,2>{0.338638693f, 0.877735853f},
-std::array<float,2>{0.552727699f, 0.242439881f},
-std::array<float,2>{0.95589304f, 0.528698325f},
-std::array<float,2>{0.205588952f, 0.425002038f},
-std::array<float,2>{0.4873375f, 0.577965498f},
-std::array<float,2>{0.730139792f, 0.478536755f},
-std::array<float,2>{0.778902888f, 0.98404938f},
-std::array<float,2>{0.100729689f, 0.134890243f},
-std::array<float,2>{0.182468712f, 0.793602347f},
-std::array<float,2>{0.906601667f, 0.0755131915f},
-std::array<float,2>{0.60490942f, 0.719830751f},
-std::array<float,2>{0.277144104f, 0.271961659f},
-std::array<float,2>{0.234359473f, 0.724621117f},
-std::array<float,2>{0.974832416f, 0.267871916f},
-std::array<float,2>{0.52450937f, 0.79213047f},
-std::array<float,2>{0.349181771f, 0.0705839023f},
-std::array<float,2>{0.434619099f, 0.976667762f},
-std::array<float,2>{0.628372431f, 0.140008152f},
-std::array<float,2>{0.820026278f, 0.572860241f},
-std::array<float,2>{0.0316761732f, 0.483287692f},
-std::array<float,2>{0.301248044f, 0.52418679f},
-std::array<float,2>{0.586875975f, 0.427358449f},
-std::array<float,2>{0.8825804f, 0.881566584f},
-std::array<float,2>{0.13865982f, 0.249822721f},
-std::array<float,2>{0.0797935203f, 0.86097759f},
-std::array<float,2>{0.805102766f, 0.0216956716f},
-std::array<float,2>{0.718697786f, 0.660604715f},
-std::array<float,2>{0.459170312f, 0.319944292f},
-std::array<float,2>{0.0115033174f, 0.606611192f},
-std::array<float,2>{0.859958947f, 0.46295777f},
-std::array<float,2>{0.665956676f, 0.940065145f},
-std::array<float,2>{0.395625591f, 0.180906013f},
-std::array<float,2>{0.32318458f, 0.776036859f},
-std::array<float,2>{0.531331301f, 0.115873903f},
-std::array<float,2>{0.940794408f, 0.707679749f},
-std::array<float,2>{0.190545261f, 0.309088737f},
-std::array<float,2>{0.479211032f, 0.637553751f},
-std::array<float,2>{0.745187104f, 0.368253112f},
-std::array<float,2>{0.757227063f, 0.818005383f},
-std::array<float,2>{0.11823146f, 0.0332946256f},
-std::array<float,2>{0.158981517f, 0.931615293f},
-std::array<float,2>{0.927705526f, 0.194752291f},
-std::array<float,2>{0.612233877f, 0.558492005f},
-std::array<float,2>{0.261085033f, 0.392971575f},
-std::array<float,2>{0.148798302f, 0.538206756f},
-std::array<float,2>{0.897005081f, 0.38208881f},
-std::array<float,2>{0.569126248f, 0.919332922f},
-std::array<float,2>{0.292666018f, 0.209837422f},
-std::array<float,2>{0.444597542f, 0.840970099f},
-std::array<float,2>{0.696968853f, 0.0594875365f},
-std::array<float,2>{0.788278461f, 0.654847562f},
-std::array<float,2>{0.0649977401f, 0.353001237f},
-std::array<float,2>{0.361463249f, 0.69629693f},
-std::array<float,2>{0.514728963f, 0.287812322f},
-std::array<float,2>{0.99699837f, 0.759795725f},
-std::array<float,2>{0.244571239f, 0.105896011f},
-std::array<float,2>{0.0565787889f, 0.954688668f},
-std::array<float,2>{0.843406081f, 0.16012691f},
-std::array<float,2>{0.641461015f, 0.612469852f},
-std::array<float,2>{0.421280205f, 0.441219658f},
-std::array<float,2>{0.102226093f, 0.686235905f},
-std::array<float,2>{0.769182324f, 0.328617305f},
-std::array<float,2>{0.720715702f, 0.853329539f},
-std::array<float,2>{0.498365462f, 0.0100070564f},
-std::array<float,2>{0.272829592f, 0.895184219f},
-std::array<float,2>{0.599535406f, 0.233329222f},
-std::array<float,2>{0.920903563f, 0.500145316f},
-std::array<float,2>{0.174560085f, 0.414528221f},
-std::array<float,2>{0.379695356f, 0.584196985f},
-std::array<float,2>{0.681061745f, 0.487719625f},
-std::array<float,2>{0.845523477f, 0.995305061f},
-std::array<float,2>{0.0259858463f, 0.152572274f},
-std::array<float,2>{0.214030981f, 0.802448928f},
-std::array<float,2>{0.967137098f, 0.0818984136f},
-std::array<float,2>{0.560290873f, 0.739049911f},
-std::array<float,2>{0.332281977f, 0.253369987f},
-std::array<float,2>{0.185754701f, 0.64451623f},
-std::array<float,2>{0.913515151f, 0.345777571f},
-std::array<float,2>{0.607954204f, 0.830344677f},
-std::array<float,2>{0.280758649f, 0.0483764559f},
-std::array<float,2>{0.488394082f, 0.909280181f},
-std::array<float,2>{0.732377648f, 0.214843065f},
-std::array<float,2>{0.774185181f, 0.546521962f},
-std::array<float,2>{0.0950076878f, 0.387977809f},
-std::array<float,2>{0.343347967f, 0.62209779f},
-std::array<float,2>{0.547547638f, 0.449904799f},
-std::array<float,2>{0.960566103f, 0.962742627f},
-std::array<float,2>{0.210476011f, 0.16432552f},
-std::array<float,2>{0.0160867628f, 0.750982583f},
-std::array<float,2>{0.852770388f, 0.0998938456f},
-std::array<float,2>{0.672626495f, 0.687766433f},
-std::array<float,2>{0.386925817f, 0.290531397f},
-std::array<float,2>{0.0722637847f, 0.50989908f},
-std::array<float,2>{0.795647979f, 0.413989633f},
-std::array<float,2>{0.691283345f, 0.899766564f},
-std::array<float,2>{0.449537992f, 0.221720681f},
-std::array<float,2>{0.281330377f, 0.845066547f},
-std::array<float,2>{0.576395094f, 0.0055228183f},
-std::array<float,2>{0.900720894f, 0.673570633f},
-std::array<float,2>{0.143175557f, 0.338571608f},
-std::array<float,2>{0.408315003f, 0.742540538f},
-std::array<float,2>{0.649126232f, 0.26414457f},
-std::array<float,2>{0.831052899f, 0.812205732f},
-std::array<float,2>{0.0527172722f, 0.0880917311f},
-std::array<float,2>{0.237337887f, 0.988305449f},
-std::array<float,2>{0.987294137f, 0.140748337f},
-std::array<float,2>{0.501769125f, 0.586751699f},
-std::array<float,2>{0.372982353f, 0.496986896f},
-std::array<float,2>{0.196745202f, 0.568322241f},
-std::array<float,2>{0.952266097f, 0.474979758f},
-std::array<float,2>{0.53953898f, 0.974522352f},
-std::array<float,2>{0.314043373f, 0.125593156f},
-std::array<float,2>{0.403540283f, 0.781449258f},
-std::array<float,2>{0.658798814f, 0.0667904243f},
-std::array<float,2>{0.87173754f, 0.731711864f},
-std::array<float,2>{0.00046031989f, 0.28121388f},
-std::array<float,2>{0.257339716f, 0.667635798f},
-std::array<float,2>{0.618065536f, 0.326451063f},
-std::array<float,2>{0.935906708f, 0.869585097f},
-std::array<float,2>{0.171624169f, 0.0246503279f},
-std::array<float,2>{0.112481937f, 0.887932777f},
-std::array<float,2>{0.758580089f, 0.236827195f},
-std::array<float,2>{0.74020052f, 0.518965483f},
-std::array<float,2>{0.476075679f, 0.431582868f},
-std::array<float,2>{0.0428882986f, 0.718344986f},
-std::array<float,2>{0.822599411f, 0.298396349f},
-std::array<float,2>{0.635798693f, 0.772260368f},
-std::array<float,2>{0.425265163f, 0.124058582f},
-std::array<float,2>{0.354149044f, 0.950123608f},
-std::array<float,2>{0.519631624f, 0.174602821f},
-std::array<float,2>{0.980592191f, 0.594902456f},
-std::array<float,2>{0.222870708f, 0.456074834f},
-std::array<float,2>{0.463664532f, 0.549038231f},
-std::array<float,2>{0.703600645f, 0.405110449f},
-std::array<float,2>{0.803303063f, 0.922795713f},
-std::array<float,2>{0.0870604143f, 0.200520411f},
-std::array<float,2>{0.125550896f, 0.820847154f},
-std::array<float,2>{0.884895325f, 0.0414211601f},
-std::array<float,2>{0.581052125f, 0.625107169f},
-std::array<float,2>{0.30981195f, 0.363743722f},
-std::array<float,2>{0.205441654f, 0.659318566f},
-std::array<float,2>{0.955561459f, 0.31547907f},
-std::array<float,2>{0.551944256f, 0.86416167f},
-std::array<float,2>{0.338216215f, 0.0190349184f},
-std::array<float,2>{0.385636479f, 0.876171649f},
-std::array<float,2>{0.677646935f, 0.246030644f},
-std::array<float,2>{0.856829166f, 0.530248523f},
-std::array<float,2>{0.0209110752f, 0.423739493f},
-std::array<float,2>{0.276418835f, 0.575890779f},
-std::array<float,2>{0.605225563f, 0.478113741f},
-std::array<float,2>{0.906960309f, 0.980627656f},
-std::array<float,2>{0.181794673f, 0.133454144f},
-std::array<float,2>{0.101531617f, 0.796459079f},
-std::array<float,2>{0.778425932f, 0.0772284567f},
-std::array<float,2>{0.729554534f, 0.721675217f},
-std::array<float,2>{0.488081962f, 0.27109915f},
-std::array<float,2>{0.0480499268f, 0.560293674f},
-std::array<float,2>{0.833574653f, 0.398319811f},
-std::array<float,2>{0.653464675f, 0.935578227f},
-std::array<float,2>{0.410928756f, 0.189856589f},
-std::array<float,2>{0.369971812f, 0.813817441f},
-std::array<float,2>{0.504403174f, 0.0379441343f},
-std::array<float,2>{0.991393149f, 0.636175931f},
-std::array<float,2>{0.240044385f, 0.372570395f},
-std::array<float,2>{0.447533846f, 0.704737425f},
-std::array<float,2>{0.692768216f, 0.305427909f},
-std::array<float,2>{0.792720914f, 0.779616714f},
-std::array<float,2>{0.0765385106f, 0.110338338f},
-std::array<float,2>{0.144965217f, 0.942955494f},
-std::array<float,2>{0.904341221f, 0.183871403f},
-std::array<float,2>{0.573137105f, 0.605182648f},
-std::array<float,2>{0.287414759f, 0.465016276f},
-std::array<float,2>{0.166229457f, 0.616051793f},
-std::array<float,2>{0.930992126f, 0.444476932f},
-std::array<float,2>{0.624783814f, 0.96093142f},
-std::array<float,2>{0.251397163f, 0.162274435f},
-std::array<float,2>{0.469131827f, 0.763512969f},
-std::array<float,2>{0.737160385f, 0.102001406f},
-std::array<float,2>{0.762733757f, 0.699982166f},
-std::array<float,2>{0.113390274f, 0.281597406f},
-std::array<float,2>{0.319968641f, 0.650376678f},
-std::array<float,2>{0.545638978f, 0.358677864f},
-std::array<float,2>{0.94670397f, 0.839410007f},
-std::array<float,2>{0.200373575f, 0.0570970401f},
-std::array<float,2>{0.00658634352f, 0.916021645f},
-std::array<float,2>{0.87034297f, 0.205290511f},
-std::array<float,2>{0.662957728f, 0.531385779f},
-std::array<float,2>{0.400545031f, 0.376095593f},
-std::array<float,2>{0.0923495516f, 0.734546483f},
-std::array<float,2>{0.800082266f, 0.257578373f},
-std::array<float,2>{0.710077286f, 0.797485888f},
-std::array<float,2>{0.466101766f, 0.0842527822f},
-std::array<float,2>{0.306387186f, 0.996236742f},
-std::array<float,2>{0.585136175f, 0.151774392f},
-std::array<float,2>{0.889778554f, 0.579383969f},
-std::array<float,2>{0.131236121f, 0.491902977f},
-std::array<float,2>{0.428992301f, 0.505851746f},
-std::array<float,2>{0.636825919f, 0.418707937f},
-std::array<float,2>{0.825749159f, 0.893480182f},
-std::array<float,2>{0.0437425449f, 0.227570817f},
-std::array<float,2>{0.220940247f, 0.857837617f},
-std::array<float,2>{0.976859748f, 0.0150146093f},
-std::array<float,2>{0.516750634f, 0.679979682f},
-std::array<float,2>{0.357624114f, 0.33489567f},
-std::array<float,2>{0.135046035f, 0.692840815f},
-std::array<float,2>{0.877742767f, 0.293005019f},
-std::array<float,2>{0.592336535f, 0.75550139f},
-std::array<float,2>{0.300240576f, 0.0938377902f},
-std::array<float,2>{0.456428736f, 0.965108454f},
-std::array<float,2>{0.712459147f, 0.169749424f},
-std::array<float,2>{0.811417818f, 0.619891226f},
-std::array<float,2>{0.0822155699f, 0.448675632f},
-std::array<float,2>{0.344727516f, 0.541405737f},
-std::array<float,2>{0.528189898f, 0.384507716f},
-std::array<float,2>{0.96930784f, 0.913733721f},
-std::array<float,2>{0.228764594f, 0.216747046f},
-std::array<float,2>{0.0381924883f, 0.835562706f},
-std::array<float,2>{0.814271033f, 0.0509902723f},
-std::array<float,2>{0.632167459f, 0.648245871f},
-std::array<float,2>{0.430094987f, 0.348639876f},
-std::array<float,2>{0.123011462f, 0.591557086f},
-std::array<float,2>{0.752720177f, 0.494832397f},
-std::array<float,2>{0.746652484f, 0.986891985f},
-std::array<float,2>{0.482465804f, 0.148302063f},
-std::array<float,2>{0.26290521f, 0.806374192f},
-std::array<float,2>{0.614869535f, 0.0927797779f},
-std::array<float,2>{0.924026966f, 0.74935478f},
-std::array<float,2>{0.160341382f, 0.26149714f},
-std::array<float,2>{0.393290102f, 0.67932421f},
-std::array<float,2>{0.671617985f, 0.343105376f},
-std::array<float,2>{0.866722524f, 0.850285888f},
-std::array<float,2>{0.01346655f, 0.00226671551f},
-std::array<float,2>{0.191921711f, 0.905469477f},
-std::array<float,2>{0.94222033f, 0.224527985f},
-std::array<float,2>{0.536500275f, 0.512014747f},
-std::array<float,2>{0.32642284f, 0.407196552f},
-std::array<float,2>{0.249330878f, 0.520295203f},
-std::array<float,2>{0.995548606f, 0.435584188f},
-std::array<float,2>{0.509824514f, 0.885841608f},
-std::array<float,2>{0.366211116f, 0.239921942f},
-std::array<float,2>{0.417353779f, 0.874816716f},
-std::array<float,2>{0.645974994f, 0.0302035045f},
-std::array<float,2>{0.83642447f, 0.668660641f},
-std::array<float,2>{0.0616834089f, 0.322698623f},
-std::array<float,2>{0.294285655f, 0.728206515f},
-std::array<float,2>{0.563278735f, 0.275923133f},
-std::array<float,2>{0.890941024f, 0.787382722f},
-std::array<float,2>{0.153726444f, 0.0660750493f},
-std::array<float,2>{0.070163466f, 0.969548225f},
-std::array<float,2>{0.782138407f, 0.132047459f},
-std::array<float,2>{0.700041354f, 0.564128816f},
-std::array<float,2>{0.43801555f, 0.469542146f},
-std::array<float,2>{0.0274093468f, 0.632251561f},
-std::array<float,2>{0.850603998f, 0.35963589f},
-std::array<float,2>{0.685180664f, 0.826536953f},
-std::array<float,2>{0.375061572f, 0.0454684012f},
-std::array<float,2>{0.331180841f, 0.927371621f},
-std::array<float,2>{0.55560863f, 0.196980968f},
-std::array<float,2>{0.963761091f, 0.552304626f},
-std::array<float,2>{0.217768684f, 0.402167678f},
-std::array<float,2>{0.494103432f, 0.598385096f},
-std::array<float,2>{0.72598052f, 0.457966328f},
-std::array<float,2>{0.772871375f, 0.947965562f},
-std::array<float,2>{0.105817132f, 0.177248716f},
-std::array<float,2>{0.177915722f, 0.76926899f},
-std::array<float,2>{0.916699708f, 0.118616462f},
-std::array<float,2>{0.594426751f, 0.7139768f},
-std::array<float,2>{0.269365966f, 0.303172529f},
-std::array<float,2>{0.187519908f, 0.710498095f},
-std::array<float,2>{0.939192116f, 0.31158331f},
-std::array<float,2>{0.533400953f, 0.774292648f},
-std::array<float,2>{0.321339518f, 0.114263982f},
-std::array<float,2>{0.397551715f, 0.938331544f},
-std::array<float,2>{0.667372823f, 0.182593644f},
-std::array<float,2>{0.861632168f, 0.60859704f},
-std::array<float,2>{0.00946171582f, 0.462376297f},
-std::array<float,2>{0.258415282f, 0.555213571f},
-std::array<float,2>{0.611248791f, 0.391277522f},
-std::array<float,2>{0.929178238f, 0.933415592f},
-std::array<float,2>{0.158083707f, 0.191512898f},
-std::array<float,2>{0.120106943f, 0.818750024f},
-std::array<float,2>{0.755088449f, 0.0325717404f},
-std::array<float,2>{0.742748618f, 0.640041709f},
-std::array<float,2>{0.477696925f, 0.369517416f},
-std::array<float,2>{0.033899758f, 0.571406186f},
-std::array<float,2>{0.817966342f, 0.482306659f},
-std::array<float,2>{0.626046419f, 0.979920268f},
-std::array<float,2>{0.437118918f, 0.138482377f},
-std::array<float,2>{0.350751966f, 0.790782452f},
-std::array<float,2>{0.526876688f, 0.0729586557f},
-std::array<float,2>{0.972826779f, 0.723456323f},
-std::array<float,2>{0.231249556f, 0.265872002f},
-std::array<float,2>{0.457163066f, 0.662506819f},
-std::array<float,2>{0.716272831f, 0.316482633f},
-std::array<float,2>{0.80686444f, 0.862503588f},
-std::array<float,2>{0.0805827305f, 0.0209929571f},
-std::array<float,2>{0.139930427f, 0.880815089f},
-std::array<float,2>{0.880376697f, 0.246896192f},
-std::array<float,2>{0.588910043f, 0.526356339f},
-std::array<float,2>{0.302820414f, 0.429533303f},
-std::array<float,2>{0.173380852f, 0.502557456f},
-std::array<float,2>{0.919769824f, 0.41740793f},
-std::array<float,2>{0.600097418f, 0.897282183f},
-std::array<float,2>{0.270244986f, 0.231035277f},
-std::array<float,2>{0.497182488f, 0.854476154f},
-std::array<float,2>{0.718759358f, 0.00933681801f},
-std::array<float,2>{0.766552091f, 0.68420434f},
-std::array<float,2>{0.103672229f, 0.330345333f},
-std::array<float,2>{0.335481375f, 0.741393209f},
-std::array<float,2>{0.560831547f, 0.250699729f},
-std::array<float,2>{0.966250598f, 0.802991331f},
-std::array<float,2>{0.212644011f, 0.0782685354f},
-std::array<float,2>{0.0247523021f, 0.992271364f},
-std::array<float,2>{0.846180618f, 0.154718101f},
-std::array<float,2>{0.68180269f, 0.583895385f},
-std::array<float,2>{0.381354481f, 0.485868782f},
-std::array<float,2>{0.0636149868f, 0.653256714f},
-std::array<float,2>{0.786955476f, 0.354334563f},
-std::array<float,2>{0.698929608f, 0.841951311f},
-std::array<float,2>{0.442696095f, 0.0616558976f},
-std::array<float,2>{0.290789038f, 0.920436859f},
-std::array<float,2>{0.566719353f, 0.208793089f},
-std::array<float,2>{0.895952046f, 0.537016451f},
-std::array<float,2>{0.151688993f, 0.380197316f},
-std::array<float,2>{0.419394106f, 0.609426916f},
-std::array<float,2>{0.642783821f, 0.43921113f},
-std::array<float,2>{0.839953363f, 0.956825972f},
-std::array<float,2>{0.0570471697f, 0.157538936f},
-std::array<float,2>{0.243946299f, 0.758938491f},
-std::array<float,2>{0.998977005f, 0.109211229f},
-std::array<float,2>{0.511724114f, 0.699048102f},
-std::array<float,2>{0.361066401f, 0.285251945f},
-std::array<float,2>{0.142363608f, 0.674073756f},
-std::array<float,2>{0.899421453f, 0.337720722f},
-std::array<float,2>{0.574852943f, 0.846520364f},
-std::array<float,2>{0.28379339f, 0.00650472427f},
-std::array<float,2>{0.452509791f, 0.902193308f},
-std::array<float,2>{0.689359546f, 0.219213217f},
-std::array<float,2>{0.794566929f, 0.508523285f},
-std::array<float,2>{0.0724613145f, 0.410497248f},
-std::array<float,2>{0.374943763f, 0.588834584f},
-std::array<float,2>{0.503809273f, 0.498161942f},
-std::array<float,2>{0.984974205f, 0.991959214f},
-std::array<float,2>{0.234751835f, 0.143732533f},
-std::array<float,2>{0.0543480031f, 0.809716284f},
-std::array<float,2>{0.828325629f, 0.0861224756f},
-std::array<float,2>{0.651622415f, 0.745857894f},
-std::array<float,2>{0.407303154f, 0.262789667f},
-std::array<float,2>{0.0959581435f, 0.544003785f},
-std::array<float,2>{0.776645482f, 0.390216827f},
-std::array<float,2>{0.734038413f, 0.906975865f},
-std::array<float,2>{0.491204411f, 0.212734967f},
-std::array<float,2>{0.278707802f, 0.830014288f},
-std::array<float,2>{0.605598569f, 0.0503511243f},
-std::array<float,2>{0.910532713f, 0.642329872f},
-std::array<float,2>{0.184341758f, 0.343851268f},
-std::array<float,2>{0.389763623f, 0.690207899f},
-std::array<float,2>{0.675248086f, 0.292149335f},
-std::array<float,2>{0.853524745f, 0.753635824f},
-std::array<float,2>{0.017708756f, 0.0991845354f},
-std::array<float,2>{0.208079249f, 0.963558018f},
-std::array<float,2>{0.957760394f, 0.167945623f},
-std::array<float,2>{0.550471544f, 0.624298036f},
-std::array<float,2>{0.341093212f, 0.452270985f},
-std::array<float,2>{0.225211456f, 0.596614599f},
-std::array<float,2>{0.98342222f, 0.454601526f},
-std::array<float,2>{0.521895051f, 0.952700913f},
-std::array<float,2>{0.351575106f, 0.173335776f},
-std::array<float,2>{0.422624946f, 0.771339297f},
-std::array<float,2>{0.634150386f, 0.122360341f},
-std::array<float,2>{0.820482016f, 0.715794683f},
-std::array<float,2>{0.0395407453f, 0.299804181f},
-std::array<float,2>{0.310996801f, 0.628842473f},
-std::array<float,2>{0.578227818f, 0.365555674f},
-std::array<float,2>{0.883886695f, 0.822767854f},
-std::array<float,2>{0.127601221f, 0.0391810574f},
-std::array<float,2>{0.088592492f, 0.924723446f},
-std::array<float,2>{0.802654922f, 0.202684984f},
-std::array<float,2>{0.706437469f, 0.548310757f},
-std::array<float,2>{0.461807281f, 0.403390348f},
-std::array<float,2>{0.00256602536f, 0.732576549f},
-std::array<float,2>{0.874289811f, 0.278855175f},
-std::array<float,2>{0.657828808f, 0.784886956f},
-std::array<float,2>{0.404999673f, 0.0695097148f},
-std::array<float,2>{0.315611005f, 0.974998295f},
-std::array<float,2>{0.541697621f, 0.128030598f},
-std::array<float,2>{0.949950218f, 0.568950713f},
-std::array<float,2>{0.19733496f, 0.473836988f},
-std::array<float,2>{0.473684669f, 0.516377449f},
-std::array<float,2>{0.741295755f, 0.433506101f},
-std::array<float,2>{0.760450065f, 0.88922143f},
-std::array<float,2>{0.111310579f, 0.235740423f},
-std::array<float,2>{0.168810636f, 0.868205011f},
-std::array<float,2>{0.934133828f, 0.0263494961f},
-std::array<float,2>{0.619418383f, 0.665301025f},
-std::array<float,2>{0.254137218f, 0.325996488f},
-std::array<float,2>{0.240768015f, 0.633900762f},
-std::array<float,2>{0.989290476f, 0.37438187f},
-std::array<float,2>{0.505968988f, 0.814603388f},
-std::array<float,2>{0.36848706f, 0.0362973846f},
-std::array<float,2>{0.413535088f, 0.935467839f},
-std::array<float,2>{0.654474914f, 0.188950062f},
-std::array<float,2>{0.834560812f, 0.562258303f},
-std::array<float,2>{0.0505625531f, 0.394600958f},
-std::array<float,2>{0.285365641f, 0.601757467f},
-std::array<float,2>{0.57126379f, 0.468072921f},
-std::array<float,2>{0.903090358f, 0.944529593f},
-std::array<float,2>{0.148319691f, 0.18614912f},
-std::array<float,2>{0.0747672468f, 0.778856277f},
-std::array<float,2>{0.78969717f, 0.112066321f},
-std::array<float,2>{0.694749534f, 0.70565927f},
-std::array<float,2>{0.446880132f, 0.308468342f},
-std::array<float,2>{0.0227178391f, 0.528810978f},
-std::array<float,2>{0.858189762f, 0.425383419f},
-std::array<float,2>{0.67786026f, 0.877340615f},
-std::array<float,2>{0.383549124f, 0.243077978f},
-std::array<float,2>{0.33609581f, 0.865580559f},
-std::array<float,2>{0.553470075f, 0.015854504f},
-std::array<float,2>{0.955040932f, 0.656690598f},
-std::array<float,2>{0.203572467f, 0.313578695f},
-std::array<float,2>{0.48612836f, 0.720303237f},
-std::array<float,2>{0.728071928f, 0.27226907f},
-std::array<float,2>{0.78037405f, 0.793233454f},
-std::array<float,2>{0.0986001492f, 0.0758729652f},
-std::array<float,2>{0.181130126f, 0.983696401f},
-std::array<float,2>{0.910089493f, 0.135341465f},
-std::array<float,2>{0.601913929f, 0.577626467f},
-std::array<float,2>{0.27387923f, 0.479037255f},
-std::array<float,2>{0.129090175f, 0.581866503f},
-std::array<float,2>{0.887461662f, 0.488646865f},
-std::array<float,2>{0.582815707f, 0.999747157f},
-std::array<float,2>{0.306839406f, 0.148977578f},
-std::array<float,2>{0.468029588f, 0.800182641f},
-std::array<float,2>{0.708218694f, 0.0833703503f},
-std::array<float,2>{0.798564732f, 0.736937582f},
-std::array<float,2>{0.0910376534f, 0.255346388f},
-std::array<float,2>{0.356419176f, 0.682839155f},
-std::array<float,2>{0.518143713f, 0.333974242f},
-std::array<float,2>{0.978946924f, 0.856665909f},
-std::array<float,2>{0.218983829f, 0.0134103838f},
-std::array<float,2>{0.0462010093f, 0.891045332f},
-std::array<float,2>{0.826183736f, 0.229807958f},
-std::array<float,2>{0.639238477f, 0.506816685f},
-std::array<float,2>{0.427237749f, 0.420865238f},
-std::array<float,2>{0.116680928f, 0.702537298f},
-std::array<float,2>{0.764736772f, 0.285088331f},
-std::array<float,2>{0.735081136f, 0.764930546f},
-std::array<float,2>{0.47225523f, 0.103951298f},
-std::array<float,2>{0.252664596f, 0.957873166f},
-std::array<float,2>{0.622794569f, 0.160318226f},
-std::array<float,2>{0.932755232f, 0.614661217f},
-std::array<float,2>{0.164425597f, 0.441968232f},
-std::array<float,2>{0.398663789f, 0.534821033f},
-std::array<float,2>{0.660437703f, 0.378096849f},
-std::array<float,2>{0.867392898f, 0.914324522f},
-std::array<float,2>{0.00554308901f, 0.203662455f},
-std::array<float,2>{0.201359838f, 0.836415172f},
-std::array<float,2>{0.948754013f, 0.0548511371f},
-std::array<float,2>{0.544593751f, 0.651620507f},
-std::array<float,2>{0.316550851f, 0.355802923f},
-std::array<float,2>{0.162735835f, 0.746898592f},
-std::array<float,2>{0.922808826f, 0.259427786f},
-std::array<float,2>{0.616002977f, 0.80829531f},
-std::array<float,2>{0.263820022f, 0.0898971781f},
-std::array<float,2>{0.480941534f, 0.985820234f},
-std::array<float,2>{0.748604298f, 0.144958839f},
-std::array<float,2>{0.751318395f, 0.592341423f},
-std::array<float,2>{0.123241782f, 0.492888838f},
-std::array<float,2>{0.324634433f, 0.515108168f},
-std::array<float,2>{0.537118256f, 0.409387499f},
-std::array<float,2>{0.94445771f, 0.903320193f},
-std::array<float,2>{0.195117578f, 0.226055205f},
-std::array<float,2>{0.0150911296f, 0.848149538f},
-std::array<float,2>{0.863977075f, 0.00117585727f},
-std::array<float,2>{0.667985201f, 0.677716732f},
-std::array<float,2>{0.392412186f, 0.340533465f},
-std::array<float,2>{0.0854148418f, 0.61846143f},
-std::array<float,2>{0.808612585f, 0.44698894f},
-std::array<float,2>{0.71448338f, 0.968256533f},
-std::array<float,2>{0.454048842f, 0.170097142f},
-std::array<float,2>{0.297565669f, 0.756527185f},
-std::array<float,2>{0.590326071f, 0.0974844843f},
-std::array<float,2>{0.876178443f, 0.694189787f},
-std::array<float,2>{0.133390337f, 0.295626402f},
-std::array<float,2>{0.432710022f, 0.646023512f},
-std::array<float,2>{0.628975093f, 0.350400627f},
-std::array<float,2>{0.815338135f, 0.832710862f},
-std::array<float,2>{0.0358011685f, 0.0542099401f},
-std::array<float,2>{0.227979615f, 0.910785735f},
-std::array<float,2>{0.972077966f, 0.216854706f},
-std::array<float,2>{0.529554844f, 0.539693177f},
-std::array<float,2>{0.346505463f, 0.385786414f},
-std::array<float,2>{0.216228396f, 0.553712428f},
-std::array<float,2>{0.961384475f, 0.398861021f},
-std::array<float,2>{0.557291746f, 0.929502845f},
-std::array<float,2>{0.32964617f, 0.19742465f},
-std::array<float,2>{0.378799468f, 0.825001001f},
-std::array<float,2>{0.685663223f, 0.044267673f},
-std::array<float,2>{0.849308968f, 0.629816949f},
-std::array<float,2>{0.0300210342f, 0.362957358f},
-std::array<float,2>{0.266747534f, 0.711099088f},
-std::array<float,2>{0.596978545f, 0.301846653f},
-std::array<float,2>{0.914770901f, 0.767447889f},
-std::array<float,2>{0.177234873f, 0.119558796f},
-std::array<float,2>{0.107982941f, 0.947003484f},
-std::array<float,2>{0.771090388f, 0.178656846f},
-std::array<float,2>{0.724502027f, 0.600237906f},
-std::array<float,2>{0.495780855f, 0.459700793f},
-std::array<float,2>{0.0603320412f, 0.670177519f},
-std::array<float,2>{0.838508964f, 0.321503729f},
-std::array<float,2>{0.647959292f, 0.872684777f},
-std::array<float,2>{0.415929258f, 0.0275542922f},
-std::array<float,2>{0.364634454f, 0.883786798f},
-std::array<float,2>{0.508446157f, 0.240478948f},
-std::array<float,2>{0.992521644f, 0.521663904f},
-std::array<float,2>{0.247245073f, 0.433678448f},
-std::array<float,2>{0.439618677f, 0.564671934f},
-std::array<float,2>{0.702604592f, 0.472248018f},
-std::array<float,2>{0.784221232f, 0.972522616f},
-std::array<float,2>{0.0668945536f, 0.130071506f},
-std::array<float,2>{0.154671773f, 0.786311269f},
-std::array<float,2>{0.894211233f, 0.0639275387f},
-std::array<float,2>{0.56529206f, 0.729169011f},
-std::array<float,2>{0.295513868f, 0.274784088f},
-std::array<float,2>{0.211041585f, 0.739476442f},
-std::array<float,2>{0.965428054f, 0.252502829f},
-std::array<float,2>{0.562120378f, 0.801235855f},
-std::array<float,2>{0.334199339f, 0.080810003f},
-std::array<float,2>{0.38224867f, 0.994885445f},
-std::array<float,2>{0.682803631f, 0.154205039f},
-std::array<float,2>{0.847565472f, 0.584997237f},
-std::array<float,2>{0.0240490064f, 0.486823887f},
-std::array<float,2>{0.270776808f, 0.50115937f},
-std::array<float,2>{0.600895524f, 0.415046036f},
-std::array<float,2>{0.918050826f, 0.895850599f},
-std::array<float,2>{0.171923578f, 0.234154508f},
-std::array<float,2>{0.104767554f, 0.852054954f},
-std::array<float,2>{0.766715884f, 0.0108184228f},
-std::array<float,2>{0.720136046f, 0.687056482f},
-std::array<float,2>{0.496327072f, 0.329144001f},
-std::array<float,2>{0.058422368f, 0.611577928f},
-std::array<float,2>{0.841080189f, 0.43971929f},
-std::array<float,2>{0.64450103f, 0.953375876f},
-std::array<float,2>{0.418481082f, 0.15858081f},
-std::array<float,2>{0.360317975f, 0.760747671f},
-std::array<float,2>{0.513551414f, 0.106960438f},
-std::array<float,2>{0.999708772f, 0.695411205f},
-std::array<float,2>{0.242681101f, 0.288962781f},
-std::array<float,2>{0.442089677f, 0.655752838f},
-std::array<float,2>{0.697831333f, 0.352185279f},
-std::array<float,2>{0.785232782f, 0.840323329f},
-std::array<float,2>{0.0629197434f, 0.0604935847f},
-std::array<float,2>{0.150851533f, 0.918307722f},
-std::array<float,2>{0.894692779f, 0.210876659f},
-std::array<float,2>{0.568055212f, 0.537528634f},
-std::array<float,2>{0.289566785f, 0.381702751f},
-std::array<float,2>{0.156860426f, 0.557123542f},
-std::array<float,2>{0.928073227f, 0.393847436f},
-std::array<float,2>{0.60959816f, 0.930303514f},
-std::array<float,2>{0.259445786f, 0.193828702f},
-std::array<float,2>{0.477373242f, 0.816894054f},
-std::array<float,2>{0.743883431f, 0.0349487439f},
-std::array<float,2>{0.753986597f, 0.638308942f},
-std::array<float,2>{0.120880164f, 0.368110776f},
-std::array<float,2>{0.320594221f, 0.708964229f},
-std::array<float,2>{0.535063684f, 0.309628755f},
-std::array<float,2>{0.938203037f, 0.77666539f},
-std::array<float,2>{0.18872194f, 0.116947159f},
-std::array<float,2>{0.00848072022f, 0.941082537f},
-std::array<float,2>{0.862741828f, 0.179873794f},
-std::array<float,2>{0.666057706f, 0.605720639f},
-std::array<float,2>{0.396593839f, 0.464758694f},
-std::array<float,2>{0.0818806589f, 0.661818922f},
-std::array<float,2>{0.807899773f, 0.318693459f},
-std::array<float,2>{0.715011895f, 0.859459877f},
-std::array<float,2>{0.458087802f, 0.0228907261f},
-std::array<float,2>{0.304627657f, 0.882796466f},
-std::array<float,2>{0.588745713f, 0.248831749f},
-std::array<float,2>{0.879617393f, 0.524667919f},
-std::array<float,2>{0.138974398f, 0.425933361f},
-std::array<float,2>{0.435773432f, 0.574044526f},
-std::array<float,2>{0.625797093f, 0.483805776f},
-std::array<float,2>{0.816884995f, 0.977952778f},
-std::array<float,2>{0.0350298099f, 0.138958201f},
-std::array<float,2>{0.231713429f, 0.791069329f},
-std::array<float,2>{0.974562705f, 0.0717885718f},
-std::array<float,2>{0.526140034f, 0.726349711f},
-std::array<float,2>{0.349643737f, 0.268608451f},
-std::array<float,2>{0.128849f, 0.62640357f},
-std::array<float,2>{0.883483887f, 0.364663482f},
-std::array<float,2>{0.579191267f, 0.822089553f},
-std::array<float,2>{0.311943442f, 0.0426186584f},
-std::array<float,2>{0.462349147f, 0.923601091f},
-std::array<float,2>{0.70530206f, 0.200083122f},
-std::array<float,2>{0.801708639f, 0.55007112f},
-std::array<float,2>{0.0893486515f, 0.405359149f},
-std::array<float,2>{0.352918476f, 0.594210505f},
-std::array<float,2>{0.523401022f, 0.455374092f},
-std::array<float,2>{0.983296096f, 0.950531363f},
-std::array<float,2>{0.225666076f, 0.175330088f},
-std::array<float,2>{0.0403910875f, 0.772933006f},
-std::array<float,2>{0.822020411f, 0.12397068f},
-std::array<float,2>{0.633490026f, 0.716818035f},
-std::array<float,2>{0.423333555f, 0.297778875f},
-std::array<float,2>{0.109934188f, 0.517644346f},
-std::array<float,2>{0.760919094f, 0.429721117f},
-std::array<float,2>{0.740917444f, 0.88765955f},
-std::array<float,2>{0.473578036f, 0.237760186f},
-std::array<float,2>{0.255344242f, 0.870142043f},
-std::array<float,2>{0.62098521f, 0.0241281781f},
-std::array<float,2>{0.9349612f, 0.66666472f},
-std::array<float,2>{0.168972254f, 0.327924907f},
-std::array<float,2>{0.405460238f, 0.730774164f},
-std::array<float,2>{0.656714499f, 0.279698461f},
-std::array<float,2>{0.873673379f, 0.783088326f},
-std::array<float,2>{0.00300160726f, 0.0675716326f},
-std::array<float,2>{0.198714942f, 0.973187208f},
-std::array<float,2>{0.950721622f, 0.126736969f},
-std::array<float,2>{0.542780995f, 0.566685975f},
-std::array<float,2>{0.314799964f, 0.475887805f},
-std::array<float,2>{0.235786527f, 0.587061882f},
-std::array<float,2>{0.986189723f, 0.497550517f},
-std::array<float,2>{0.502087355f, 0.989554226f},
-std::array<float,2>{0.373349994f, 0.14160651f},
-std::array<float,2>{0.407130301f, 0.81099999f},
-std::array<float,2>{0.651153266f, 0.0891882405f},
-std::array<float,2>{0.829925656f, 0.744062662f},
-std::array<float,2>{0.0534907058f, 0.264979422f},
-std::array<float,2>{0.285102338f, 0.672705412f},
-std::array<float,2>{0.575614035f, 0.339144498f},
-std::array<float,2>{0.898578048f, 0.844474196f},
-std::array<float,2>{0.141010001f, 0.00395696284f},
-std::array<float,2>{0.0733449757f, 0.898849964f},
-std::array<float,2>{0.793298244f, 0.220977262f},
-std::array<float,2>{0.687633514f, 0.511491537f},
-std::array<float,2>{0.451221824f, 0.412302881f},
-std::array<float,2>{0.0186179951f, 0.689288616f},
-std::array<float,2>{0.854858518f, 0.289945096f},
-std::array<float,2>{0.673954308f, 0.750937104f},
-std::array<float,2>{0.388780475f, 0.101161316f},
-std::array<float,2>{0.340139955f, 0.961130202f},
-std::array<float,2>{0.549063683f, 0.165224373f},
-std::array<float,2>{0.958837211f, 0.621895254f},
-std::array<float,2>{0.207954437f, 0.450993329f},
-std::array<float,2>{0.491432071f, 0.545347571f},
-std::array<float,2>{0.732671976f, 0.387010157f},
-std::array<float,2>{0.775600612f, 0.908933938f},
-std::array<float,2>{0.0974948555f, 0.213716328f},
-std::array<float,2>{0.185023203f, 0.83128196f},
-std::array<float,2>{0.9116382f, 0.0472788475f},
-std::array<float,2>{0.606715202f, 0.643173873f},
-std::array<float,2>{0.277431875f, 0.347523898f},
-std::array<float,2>{0.22054024f, 0.681016445f},
-std::array<float,2>{0.980114758f, 0.33557409f},
-std::array<float,2>{0.519400179f, 0.859259188f},
-std::array<float,2>{0.35707894f, 0.0145241413f},
-std::array<float,2>{0.426181614f, 0.894052982f},
-std::array<float,2>{0.639689565f, 0.226764604f},
-std::array<float,2>{0.827662647f, 0.503931046f},
-std::array<float,2>{0.0453234687f, 0.419177383f},
-std::array<float,2>{0.30813238f, 0.578189194f},
-std::array<float,2>{0.583742619f, 0.490529567f},
-std::array<float,2>{0.888472736f, 0.997956395f},
-std::array<float,2>{0.129916146f, 0.150525838f},
-std::array<float,2>{0.0905949995f, 0.798754513f},
-std::array<float,2>{0.797277331f, 0.0849941075f},
-std::array<float,2>{0.707776904f, 0.736284971f},
-std::array<float,2>{0.466911167f, 0.256279826f},
-std::array<float,2>{0.00447775377f, 0.532661676f},
-std::array<float,2>{0.868600905f, 0.375421762f},
-std::array<float,2>{0.661799192f, 0.917058468f},
-std::array<float,2>{0.400286198f, 0.206949294f},
-std::array<float,2>{0.317968249f, 0.838043451f},
-std::array<float,2>{0.543022931f, 0.0578481555f},
-std::array<float,2>{0.947457731f, 0.64897424f},
-std::array<float,2>{0.202235535f, 0.357570052f},
-std::array<float,2>{0.471226752f, 0.700773776f},
-std::array<float,2>{0.735647917f, 0.283009827f},
-std::array<float,2>{0.764346719f, 0.761866033f},
-std::array<float,2>{0.115628488f, 0.102845423f},
-std::array<float,2>{0.166015208f, 0.959081054f},
-std::array<float,2>{0.932088494f, 0.163742661f},
-std::array<float,2>{0.622060597f, 0.617091954f},
-std::array<float,2>{0.253317714f, 0.444172919f},
-std::array<float,2>{0.147426352f, 0.603887439f},
-std::array<float,2>{0.904070377f, 0.466018409f},
-std::array<float,2>{0.571979642f, 0.941612959f},
-std::array<float,2>{0.286600262f, 0.185176283f},
-std::array<float,2>{0.445420235f, 0.781159759f},
-std::array<float,2>{0.693710685f, 0.111249246f},
-std::array<float,2>{0.790595114f, 0.703950942f},
-std::array<float,2>{0.0753974617f, 0.306401491f},
-std::array<float,2>{0.368059725f, 0.634840906f},
-std::array<float,2>{0.507025063f, 0.37130788f},
-std::array<float,2>{0.988538682f, 0.813245714f},
-std::array<float,2>{0.241630971f, 0.0381879993f},
-std::array<float,2>{0.049245622f, 0.937079072f},
-std::array<float,2>{0.835835397f, 0.190761879f},
-std::array<float,2>{0.656222522f, 0.559157848f},
-std::array<float,2>{0.412251413f, 0.397039086f},
-std::array<float,2>{0.0991585031f, 0.722555876f},
-std::array<float,2>{0.779997408f, 0.270444721f},
-std::array<float,2>{0.726896405f, 0.79573679f},
-std::array<float,2>{0.484643161f, 0.0767169893f},
-std::array<float,2>{0.275169969f, 0.981657147f},
-std::array<float,2>{0.602860034f, 0.134691939f},
-std::array<float,2>{0.908451617f, 0.575082481f},
-std::array<float,2>{0.180662289f, 0.477359623f},
-std::array<float,2>{0.384369612f, 0.530288696f},
-std::array<float,2>{0.679090023f, 0.422450989f},
-std::array<float,2>{0.85872376f, 0.875614405f},
-std::array<float,2>{0.021691706f, 0.244962141f},
-std::array<float,2>{0.204304129f, 0.864699781f},
-std::array<float,2>{0.953671634f, 0.0183696859f},
-std::array<float,2>{0.553761184f, 0.658760309f},
-std::array<float,2>{0.337694108f, 0.314642042f},
-std::array<float,2>{0.175824881f, 0.713126302f},
-std::array<float,2>{0.91514051f, 0.304261357f},
-std::array<float,2>{0.595786631f, 0.768262565f},
-std::array<float,2>{0.265780151f, 0.117829092f},
-std::array<float,2>{0.494397372f, 0.948379219f},
-std::array<float,2>{0.722761273f, 0.176282093f},
-std::array<float,2>{0.769573212f, 0.59928447f},
-std::array<float,2>{0.108730517f, 0.458126873f},
-std::array<float,2>{0.328621954f, 0.551503539f},
-std::array<float,2>{0.557997286f, 0.400769711f},
-std::array<float,2>{0.961974919f, 0.926482618f},
-std::array<float,2>{0.215599179f, 0.195317805f},
-std::array<float,2>{0.0309819486f, 0.828122735f},
-std::array<float,2>{0.848599792f, 0.0468347482f},
-std::array<float,2>{0.686822832f, 0.63099277f},
-std::array<float,2>{0.377214462f, 0.360467494f},
-std::array<float,2>{0.0678007677f, 0.562527359f},
-std::array<float,2>{0.783394635f, 0.470694244f},
-std::array<float,2>{0.702007532f, 0.969812155f},
-std::array<float,2>{0.441224903f, 0.131213054f},
-std::array<float,2>{0.296727359f, 0.78843683f},
-std::array<float,2>{0.566353261f, 0.0644862875f},
-std::array<float,2>{0.893235922f, 0.726575017f},
-std::array<float,2>{0.155696556f, 0.276709408f},
-std::array<float,2>{0.415010422f, 0.669302046f},
-std::array<float,2>{0.646803141f, 0.323314011f},
-std::array<float,2>{0.839710891f, 0.873767376f},
-std::array<float,2>{0.0588287525f, 0.0309790056f},
-std::array<float,2>{0.246219069f, 0.885413766f},
-std::array<float,2>{0.993431628f, 0.238552287f},
-std::array<float,2>{0.5094347f, 0.520580888f},
-std::array<float,2>{0.363516122f, 0.437217891f},
-std::array<float,2>{0.193941981f, 0.512919128f},
-std::array<float,2>{0.943683207f, 0.407251149f},
-std::array<float,2>{0.538784802f, 0.905224025f},
-std::array<float,2>{0.325725555f, 0.223255605f},
-std::array<float,2>{0.391473979f, 0.850775182f},
-std::array<float,2>{0.669056237f, 0.00316371676f},
-std::array<float,2>{0.864805102f, 0.678367913f},
-std::array<float,2>{0.0146402242f, 0.342299402f},
-std::array<float,2>{0.265482366f, 0.748936713f},
-std::array<float,2>{0.616653144f, 0.260358214f},
-std::array<float,2>{0.922987044f, 0.804871261f},
-std::array<float,2>{0.16385974f, 0.0920457467f},
-std::array<float,2>{0.12435817f, 0.987891734f},
-std::array<float,2>{0.75073266f, 0.14745003f},
-std::array<float,2>{0.749202192f, 0.590580344f},
-std::array<float,2>{0.482007146f, 0.495623052f},
-std::array<float,2>{0.0366420299f, 0.647113502f},
-std::array<float,2>{0.816137075f, 0.347715378f},
-std::array<float,2>{0.630623102f, 0.834857583f},
-std::array<float,2>{0.432397425f, 0.0525196381f},
-std::array<float,2>{0.347224027f, 0.912949204f},
-std::array<float,2>{0.530917943f, 0.215711772f},
-std::array<float,2>{0.97137326f, 0.542087555f},
-std::array<float,2>{0.226761386f, 0.383721918f},
-std::array<float,2>{0.454623133f, 0.620345175f},
-std::array<float,2>{0.713738263f, 0.447559565f},
-std::array<float,2>{0.810260713f, 0.96588707f},
-std::array<float,2>{0.0846175104f, 0.168677434f},
-std::array<float,2>{0.134707689f, 0.754871547f},
-std::array<float,2>{0.875693202f, 0.0954283327f},
-std::array<float,2>{0.590822458f, 0.692370057f},
-std::array<float,2>{0.298209876f, 0.294544816f},
-std::array<float,2>{0.24533242f, 0.697828352f},
-std::array<float,2>{0.997672617f, 0.287044436f},
-std::array<float,2>{0.514196455f, 0.758604527f},
-std::array<float,2>{0.362843513f, 0.108054005f},
-std::array<float,2>{0.420457065f, 0.955096662f},
-std::array<float,2>{0.642514527f, 0.156634331f},
-std::array<float,2>{0.842496276f, 0.610521615f},
-std::array<float,2>{0.0552085191f, 0.438024938f},
-std::array<float,2>{0.291419566f, 0.535783172f},
-std::array<float,2>{0.569942653f, 0.379472166f},
-std::array<float,2>{0.897835076f, 0.921447039f},
-std::array<float,2>{0.149916261f, 0.207916006f},
-std::array<float,2>{0.0660867169f, 0.843067944f},
-std::array<float,2>{0.788015306f, 0.061410103f},
-std::array<float,2>{0.696011961f, 0.653574526f},
-std::array<float,2>{0.443904102f, 0.35476011f},
-std::array<float,2>{0.026572179f, 0.582174301f},
-std::array<float,2>{0.844236791f, 0.484560519f},
-std::array<float,2>{0.680483401f, 0.99405688f},
-std::array<float,2>{0.38047713f, 0.155390844f},
-std::array<float,2>{0.333397329f, 0.804308653f},
-std::array<float,2>{0.558617711f, 0.0792760104f},
-std::array<float,2>{0.968171597f, 0.741018951f},
-std::array<float,2>{0.213167846f, 0.251003206f},
-std::array<float,2>{0.499332726f, 0.684686124f},
-std::array<float,2>{0.722272456f, 0.33179155f},
-std::array<float,2>{0.767970026f, 0.854735732f},
-std::array<float,2>{0.102811471f, 0.00841013435f},
-std::array<float,2>{0.17525509f, 0.898152053f},
-std::array<float,2>{0.920832634f, 0.232318193f},
-std::array<float,2>{0.598180652f, 0.503621221f},
-std::array<float,2>{0.272127271f, 0.416795671f},
-std::array<float,2>{0.136890918f, 0.526704788f},
-std::array<float,2>{0.881818831f, 0.428140402f},
-std::array<float,2>{0.586915493f, 0.879740715f},
-std::array<float,2>{0.302658141f, 0.247074723f},
-std::array<float,2>{0.460775584f, 0.86144948f},
-std::array<float,2>{0.717647433f, 0.0197112709f},
-std::array<float,2>{0.806488395f, 0.663574636f},
-std::array<float,2>{0.078955017f, 0.318107754f},
-std::array<float,2>{0.348166049f, 0.724295497f},
-std::array<float,2>{0.523827612f, 0.266694814f},
-std::array<float,2>{0.976323426f, 0.789975107f},
-std::array<float,2>{0.232784346f, 0.0733965412f},
-std::array<float,2>{0.0329089873f, 0.979110599f},
-std::array<float,2>{0.819115341f, 0.137546748f},
-std::array<float,2>{0.626999378f, 0.570796907f},
-std::array<float,2>{0.433634847f, 0.481281877f},
-std::array<float,2>{0.118130654f, 0.63883239f},
-std::array<float,2>{0.75646615f, 0.370731562f},
-std::array<float,2>{0.744276941f, 0.819817424f},
-std::array<float,2>{0.479883283f, 0.0315481238f},
-std::array<float,2>{0.260231674f, 0.932561874f},
-std::array<float,2>{0.612489879f, 0.193202376f},
-std::array<float,2>{0.926438153f, 0.55601263f},
-std::array<float,2>{0.15940842f, 0.391872466f},
-std::array<float,2>{0.395304352f, 0.60752672f},
-std::array<float,2>{0.664242506f, 0.461892664f},
-std::array<float,2>{0.860486925f, 0.939016879f},
-std::array<float,2>{0.00984223746f, 0.183392718f},
-std::array<float,2>{0.190008655f, 0.775375485f},
-std::array<float,2>{0.93998909f, 0.113439731f},
-std::array<float,2>{0.532579541f, 0.709488153f},
-std::array<float,2>{0.323681593f, 0.310930669f},
-std::array<float,2>{0.170317292f, 0.665023088f},
-std::array<float,2>{0.936938226f, 0.324852258f},
-std::array<float,2>{0.618514359f, 0.86744827f},
-std::array<float,2>{0.255887657f, 0.0266327988f},
-std::array<float,2>{0.474958271f, 0.890146494f},
-std::array<float,2>{0.738368988f, 0.235213757f},
-std::array<float,2>{0.759241879f, 0.517199755f},
-std::array<float,2>{0.112046994f, 0.431971073f},
-std::array<float,2>{0.312970191f, 0.5694803f},
-std::array<float,2>{0.540674031f, 0.473347038f},
-std::array<float,2>{0.951198876f, 0.975647092f},
-std::array<float,2>{0.196275458f, 0.127352253f},
-std::array<float,2>{0.00139977643f, 0.783389032f},
-std::array<float,2>{0.872851014f, 0.0689700991f},
-std::array<float,2>{0.66001451f, 0.733483791f},
-std::array<float,2>{0.403004557f, 0.278049052f},
-std::array<float,2>{0.0863497928f, 0.54749012f},
-std::array<float,2>{0.804243028f, 0.402775973f},
-std::array<float,2>{0.704591453f, 0.925548792f},
-std::array<float,2>{0.463953763f, 0.201314718f},
-std::array<float,2>{0.309157372f, 0.823786259f},
-std::array<float,2>{0.581489563f, 0.0400713943f},
-std::array<float,2>{0.886422992f, 0.627176285f},
-std::array<float,2>{0.126946703f, 0.366276681f},
-std::array<float,2>{0.424751073f, 0.716057479f},
-std::array<float,2>{0.635073304f, 0.300698757f},
-std::array<float,2>{0.823832095f, 0.769679368f},
-std::array<float,2>{0.0410997346f, 0.121450342f},
-std::array<float,2>{0.224056646f, 0.951798141f},
-std::array<float,2>{0.981719494f, 0.172372282f},
-std::array<float,2>{0.521392822f, 0.596797168f},
-std::array<float,2>{0.355187744f, 0.453139096f},
-std::array<float,2>{0.209082842f, 0.62346226f},
-std::array<float,2>{0.959831595f, 0.451883674f},
-std::array<float,2>{0.548061728f, 0.964588404f},
-std::array<float,2>{0.342181802f, 0.166795567f},
-std::array<float,2>{0.388354838f, 0.752651572f},
-std::array<float,2>{0.673350513f, 0.0977516472f},
-std::array<float,2>{0.852276862f, 0.691243529f},
-std::array<float,2>{0.017257534f, 0.291158527f},
-std::array<float,2>{0.27964592f, 0.641419649f},
-std::array<float,2>{0.608727932f, 0.345165938f},
-std::array<float,2>{0.912972867f, 0.828697681f},
-std::array<float,2>{0.187295139f, 0.0496226251f},
-std::array<float,2>{0.093856819f, 0.907347023f},
-std::array<float,2>{0.774538815f, 0.211632401f},
-std::array<float,2>{0.730722725f, 0.54334259f},
-std::array<float,2>{0.490119815f, 0.389477223f},
-std::array<float,2>{0.0516755208f, 0.744411588f},
-std::array<float,2>{0.831064463f, 0.261954427f},
-std::array<float,2>{0.649417341f, 0.809059441f},
-std::array<float,2>{0.409242094f, 0.0876810178f},
-std::array<float,2>{0.371687621f, 0.991078377f},
-std::array<float,2>{0.500168025f, 0.143207371f},
-std::array<float,2>{0.988214552f, 0.589111805f},
-std::array<float,2>{0.236752853f, 0.499248415f},
-std::array<float,2>{0.45115757f, 0.509199977f},
-std::array<float,2>{0.689956367f, 0.41177845f},
-std::array<float,2>{0.796349764f, 0.900645316f},
-std::array<float,2>{0.0709835738f, 0.220176667f},
-std::array<float,2>{0.143693164f, 0.84750849f},
-std::array<float,2>{0.902323425f, 0.007010845f},
-std::array<float,2>{0.577571154f, 0.675412953f},
-std::array<float,2>{0.282563537f, 0.336001337f},
-std::array<float,2>{0.200067997f, 0.65120101f},
-std::array<float,2>{0.945882022f, 0.356544703f},
-std::array<float,2>{0.546745777f, 0.837472081f},
-std::array<float,2>{0.319322705f, 0.05602796f},
-std::array<float,2>{0.402239949f, 0.915441632f},
-std::array<float,2>{0.663664758f, 0.20473659f},
-std::array<float,2>{0.869406939f, 0.533941031f},
-std::array<float,2>{0.00758341374f, 0.377712935f},
-std::array<float,2>{0.250519454f, 0.614226997f},
-std::array<float,2>{0.623374403f, 0.442391634f},
-std::array<float,2>{0.930646181f, 0.958022773f},
-std::array<float,2>{0.167563647f, 0.161778495f},
-std::array<float,2>{0.114451818f, 0.764399707f},
-std::array<float,2>{0.761898756f, 0.105302334f},
-std::array<float,2>{0.737969279f, 0.701643884f},
-std::array<float,2>{0.470433265f, 0.283296555f},
-std::array<float,2>{0.0439872034f, 0.507292569f},
-std::array<float,2>{0.824616432f, 0.421050489f},
-std::array<float,2>{0.638282895f, 0.891914427f},
-std::array<float,2>{0.428114295f, 0.229286939f},
-std::array<float,2>{0.358695596f, 0.856445134f},
-std::array<float,2>{0.516483009f, 0.011840268f},
-std::array<float,2>{0.978509724f, 0.682168007f},
-std::array<float,2>{0.222204849f, 0.33222881f},
-std::array<float,2>{0.465006709f, 0.73826623f},
-std::array<float,2>{0.70948267f, 0.2546615f},
-std::array<float,2>{0.799172997f, 0.798858345f},
-std::array<float,2>{0.0932492688f, 0.0821993724f},
-std::array<float,2>{0.132712409f, 0.99805361f},
-std::array<float,2>{0.889415026f, 0.150049508f},
-std::array<float,2>{0.584778368f, 0.580757678f},
-std::array<float,2>{0.30475983f, 0.489369273f},
-std::array<float,2>{0.183058366f, 0.576907337f},
-std::array<float,2>{0.907829165f, 0.479804128f},
-std::array<float,2>{0.603564143f, 0.982798755f},
-std::array<float,2>{0.275525689f, 0.135805592f},
-std::array<float,2>{0.487114608f, 0.794349194f},
-std::array<float,2>{0.72906214f, 0.0743328854f},
-std::array<float,2>{0.77778548f, 0.719373047f},
-std::array<float,2>{0.100432709f, 0.272771776f},
-std::array<float,2>{0.339089036f, 0.657265663f},
-std::array<float,2>{0.551094055f, 0.312899023f},
-std::array<float,2>{0.956473529f, 0.866311789f},
-std::array<float,2>{0.206734076f, 0.0170076992f},
-std::array<float,2>{0.019996427f, 0.878825068f},
-std::array<float,2>{0.856367588f, 0.243171483f},
-std::array<float,2>{0.676556885f, 0.528152108f},
-std::array<float,2>{0.386572987f, 0.424785674f},
-std::array<float,2>{0.077702269f, 0.706357479f},
-std::array<float,2>{0.791751742f, 0.307251215f},
-std::array<float,2>{0.692333221f, 0.77829957f},
-std::array<float,2>{0.448408574f, 0.112692744f},
-std::array<float,2>{0.288816571f, 0.944288909f},
-std::array<float,2>{0.573381186f, 0.186894745f},
-std::array<float,2>{0.905757546f, 0.602658451f},
-std::array<float,2>{0.145869613f, 0.467368871f},
-std::array<float,2>{0.411942959f, 0.561319709f},
-std::array<float,2>{0.652646124f, 0.395939589f},
-std::array<float,2>{0.832267225f, 0.93399179f},
-std::array<float,2>{0.0469220951f, 0.188227236f},
-std::array<float,2>{0.238926813f, 0.81558001f},
-std::array<float,2>{0.990535975f, 0.0357861333f},
-std::array<float,2>{0.504965007f, 0.633766592f},
-std::array<float,2>{0.370421201f, 0.37402004f},
-std::array<float,2>{0.152742624f, 0.729860663f},
-std::array<float,2>{0.891652286f, 0.274238497f},
-std::array<float,2>{0.564293087f, 0.785586417f},
-std::array<float,2>{0.293074965f, 0.0628982186f},
-std::array<float,2>{0.438611418f, 0.971143484f},
-std::array<float,2>{0.700718641f, 0.129244223f},
-std::array<float,2>{0.782708704f, 0.565873623f},
-std::array<float,2>{0.0693116561f, 0.470972002f},
-std::array<float,2>{0.365972966f, 0.522536933f},
-std::array<float,2>{0.511568248f, 0.434711099f},
-std::array<float,2>{0.994716465f, 0.884622037f},
-std::array<float,2>{0.248785377f, 0.241862074f},
-std::array<float,2>{0.0608206876f, 0.871534884f},
-std::array<float,2>{0.837625146f, 0.0288508851f},
-std::array<float,2>{0.644871235f, 0.671244383f},
-std::array<float,2>{0.416476965f, 0.32093972f},
-std::array<float,2>{0.107326135f, 0.601052523f},
-std::array<float,2>{0.772109628f, 0.460248649f},
-std::array<float,2>{0.725407541f, 0.945957482f},
-std::array<float,2>{0.493012577f, 0.178882986f},
-std::array<float,2>{0.268022716f, 0.766232014f},
-std::array<float,2>{0.595553756f, 0.120674953f},
-std::array<float,2>{0.917344689f, 0.71286279f},
-std::array<float,2>{0.179319814f, 0.301177055f},
-std::array<float,2>{0.376840979f, 0.630675673f},
-std::array<float,2>{0.684393287f, 0.362017781f},
-std::array<float,2>{0.850387394f, 0.825957f},
-std::array<float,2>{0.028985193f, 0.0435018428f},
-std::array<float,2>{0.217831582f, 0.928041875f},
-std::array<float,2>{0.963937223f, 0.198616371f},
-std::array<float,2>{0.556512296f, 0.553363621f},
-std::array<float,2>{0.330983579f, 0.399649978f},
-std::array<float,2>{0.229688227f, 0.540671527f},
-std::array<float,2>{0.9698475f, 0.385291547f},
-std::array<float,2>{0.529065013f, 0.91138047f},
-std::array<float,2>{0.344118565f, 0.21846585f},
-std::array<float,2>{0.431249917f, 0.833944082f},
-std::array<float,2>{0.631627083f, 0.0536954887f},
-std::array<float,2>{0.812738776f, 0.644753397f},
-std::array<float,2>{0.0380076431f, 0.350593776f},
-std::array<float,2>{0.299785525f, 0.694618523f},
-std::array<float,2>{0.592992127f, 0.29679212f},
-std::array<float,2>{0.878866911f, 0.757807672f},
-std::array<float,2>{0.13582848f, 0.0959134996f},
-std::array<float,2>{0.0838575736f, 0.967220008f},
-std::array<float,2>{0.811825573f, 0.171655446f},
-std::array<float,2>{0.711879253f, 0.618021607f},
-std::array<float,2>{0.455124736f, 0.445353627f},
-std::array<float,2>{0.0122699393f, 0.676697016f},
-std::array<float,2>{0.865819275f, 0.34155184f},
-std::array<float,2>{0.670842826f, 0.849336743f},
-std::array<float,2>{0.394527048f, 0.000114776085f},
-std::array<float,2>{0.327415437f, 0.903651178f},
-std::array<float,2>{0.536063373f, 0.224795073f},
-std::array<float,2>{0.94259578f, 0.514574111f},
-std::array<float,2>{0.192973703f, 0.409003824f},
-std::array<float,2>{0.483549416f, 0.593605876f},
-std::array<float,2>{0.747407377f, 0.494095206f},
-std::array<float,2>{0.75309962f, 0.98483187f},
-std::array<float,2>{0.121427916f, 0.145548105f},
-std::array<float,2>{0.161421552f, 0.806701958f},
-std::array<float,2>{0.925776601f, 0.0911901966f},
-std::array<float,2>{0.61375618f, 0.747117221f},
-std::array<float,2>{0.262021035f, 0.258776218f}}
\ No newline at end of file
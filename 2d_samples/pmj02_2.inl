@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.750507593f, 0.80002296f},
-std::array<float,2>{0.137729958f, 0.403347015f},
-std::array<float,2>{0.463104576f, 0.745428622f},
-std::array<float,2>{0.623178482f, 0.235944852f},
-std::array<float,2>{0.697283745f, 0.548955381f},
-std::array<float,2>{0.367633075f, 0.0752868131f},
-std::array<float,2>{0.0789518878f, 0.980900884f},
-std::array<float,2>{0.90570271f, 0.367916495f},
-std::array<float,2>{0.54778254f, 0.902197182f},
-std::array<float,2>{0.429772973f, 0.292768806f},
-std::array<float,2>{0.240302071f, 0.567539036f},
-std::array<float,2>{0.865376472f, 0.00290220906f},
-std::array<float,2>{0.971930861f, 0.664473355f},
-std::array<float,2>{0.0303812753f, 0.125137627f},
-std::array<float,2>{0.30350107f, 0.846208036f},
-std::array<float,2>{0.687446654f, 0.487538695f},
-std::array<float,2>{0.911431551f, 0.964339614f},
-std::array<float,2>{0.114915743f, 0.314412236f},
-std::array<float,2>{0.32858929f, 0.514944613f},
-std::array<float,2>{0.719641387f, 0.111007407f},
-std::array<float,2>{0.583371103f, 0.712337494f},
-std::array<float,2>{0.484416127f, 0.215624407f},
-std::array<float,2>{0.181265324f, 0.755701542f},
-std::array<float,2>{0.801592886f, 0.411720097f},
-std::array<float,2>{0.628078163f, 0.843248665f},
-std::array<float,2>{0.279438227f, 0.447409868f},
-std::array<float,2>{0.0478858463f, 0.641491771f},
-std::array<float,2>{0.944540322f, 0.156686381f},
-std::array<float,2>{0.827730834f, 0.607797027f},
-std::array<float,2>{0.20000267f, 0.0341443866f},
-std::array<float,2>{0.394070596f, 0.911574185f},
-std::array<float,2>{0.529526711f, 0.278389364f},
-std::array<float,2>{0.956172347f, 0.860763192f},
-std::array<float,2>{0.0312885381f, 0.471937835f},
-std::array<float,2>{0.262527734f, 0.686702788f},
-std::array<float,2>{0.655626714f, 0.152876422f},
-std::array<float,2>{0.51078707f, 0.589679062f},
-std::array<float,2>{0.384766221f, 0.0255147982f},
-std::array<float,2>{0.212130502f, 0.881144941f},
-std::array<float,2>{0.839885056f, 0.307458431f},
-std::array<float,2>{0.746313751f, 0.987869322f},
-std::array<float,2>{0.322328985f, 0.354823112f},
-std::array<float,2>{0.103352733f, 0.536893249f},
-std::array<float,2>{0.933941841f, 0.0819487646f},
-std::array<float,2>{0.789628685f, 0.726194739f},
-std::array<float,2>{0.158094138f, 0.22062318f},
-std::array<float,2>{0.483333439f, 0.783672214f},
-std::array<float,2>{0.56300813f, 0.385920316f},
-std::array<float,2>{0.85434866f, 0.925039709f},
-std::array<float,2>{0.22472088f, 0.256665349f},
-std::array<float,2>{0.408513606f, 0.618327498f},
-std::array<float,2>{0.540074587f, 0.0578795597f},
-std::array<float,2>{0.662023723f, 0.628407776f},
-std::array<float,2>{0.283152163f, 0.181374267f},
-std::array<float,2>{0.0072560776f, 0.819422781f},
-std::array<float,2>{0.991620839f, 0.462488741f},
-std::array<float,2>{0.600818396f, 0.772868872f},
-std::array<float,2>{0.449210852f, 0.422078043f},
-std::array<float,2>{0.147654131f, 0.689226031f},
-std::array<float,2>{0.766072631f, 0.202268139f},
-std::array<float,2>{0.878545344f, 0.520691454f},
-std::array<float,2>{0.0688126832f, 0.100992434f},
-std::array<float,2>{0.357919782f, 0.942985356f},
-std::array<float,2>{0.715470374f, 0.329985321f},
-std::array<float,2>{0.835444331f, 0.820395589f},
-std::array<float,2>{0.205137596f, 0.459681839f},
-std::array<float,2>{0.375219047f, 0.635238051f},
-std::array<float,2>{0.501151264f, 0.172961086f},
-std::array<float,2>{0.647919714f, 0.611985564f},
-std::array<float,2>{0.254375935f, 0.0515481867f},
-std::array<float,2>{0.0456305966f, 0.936792016f},
-std::array<float,2>{0.966050267f, 0.265019715f},
-std::array<float,2>{0.577043414f, 0.951220572f},
-std::array<float,2>{0.470250666f, 0.341236085f},
-std::array<float,2>{0.167373627f, 0.523515701f},
-std::array<float,2>{0.787231147f, 0.106273524f},
-std::array<float,2>{0.928111613f, 0.698387802f},
-std::array<float,2>{0.0975846574f, 0.18922998f},
-std::array<float,2>{0.314601481f, 0.780641377f},
-std::array<float,2>{0.738959551f, 0.42993474f},
-std::array<float,2>{0.99397248f, 0.888183177f},
-std::array<float,2>{0.0121658752f, 0.300990641f},
-std::array<float,2>{0.29255572f, 0.584667087f},
-std::array<float,2>{0.664577484f, 0.0224499758f},
-std::array<float,2>{0.533794582f, 0.677227378f},
-std::array<float,2>{0.415366918f, 0.144794315f},
-std::array<float,2>{0.227688521f, 0.873072147f},
-std::array<float,2>{0.844216228f, 0.480670601f},
-std::array<float,2>{0.704128861f, 0.792550802f},
-std::array<float,2>{0.35061419f, 0.380948722f},
-std::array<float,2>{0.0734693184f, 0.728379786f},
-std::array<float,2>{0.884939194f, 0.228027642f},
-std::array<float,2>{0.77972728f, 0.543740511f},
-std::array<float,2>{0.15428707f, 0.0867938548f},
-std::array<float,2>{0.438555002f, 0.993936718f},
-std::array<float,2>{0.602879643f, 0.350746542f},
-std::array<float,2>{0.892838478f, 0.760035992f},
-std::array<float,2>{0.0872041434f, 0.418707639f},
-std::array<float,2>{0.359792888f, 0.703630865f},
-std::array<float,2>{0.694993436f, 0.206478119f},
-std::array<float,2>{0.615626454f, 0.503727913f},
-std::array<float,2>{0.460188389f, 0.117418364f},
-std::array<float,2>{0.131670222f, 0.953671694f},
-std::array<float,2>{0.763462067f, 0.327900052f},
-std::array<float,2>{0.674900711f, 0.917834282f},
-std::array<float,2>{0.310949802f, 0.270510525f},
-std::array<float,2>{0.0160530582f, 0.598193109f},
-std::array<float,2>{0.982949853f, 0.0438004993f},
-std::array<float,2>{0.869562626f, 0.65287894f},
-std::array<float,2>{0.243009478f, 0.168977052f},
-std::array<float,2>{0.423593283f, 0.833722353f},
-std::array<float,2>{0.561420858f, 0.44298768f},
-std::array<float,2>{0.805991709f, 0.970220387f},
-std::array<float,2>{0.175822571f, 0.365990132f},
-std::array<float,2>{0.497869045f, 0.561904073f},
-std::array<float,2>{0.590318859f, 0.0643392801f},
-std::array<float,2>{0.733251929f, 0.740033925f},
-std::array<float,2>{0.342802078f, 0.242787406f},
-std::array<float,2>{0.124028943f, 0.809343398f},
-std::array<float,2>{0.914504409f, 0.3911089f},
-std::array<float,2>{0.521680057f, 0.852025807f},
-std::array<float,2>{0.405927777f, 0.499270439f},
-std::array<float,2>{0.194011405f, 0.660829008f},
-std::array<float,2>{0.815641403f, 0.13699688f},
-std::array<float,2>{0.951291144f, 0.576420486f},
-std::array<float,2>{0.0620368011f, 0.0129173398f},
-std::array<float,2>{0.270671129f, 0.897923827f},
-std::array<float,2>{0.632980347f, 0.283567548f},
-std::array<float,2>{0.782686234f, 0.848082721f},
-std::array<float,2>{0.171697021f, 0.491252542f},
-std::array<float,2>{0.474700004f, 0.668080866f},
-std::array<float,2>{0.570481777f, 0.132478312f},
-std::array<float,2>{0.737496734f, 0.562799275f},
-std::array<float,2>{0.316657335f, 0.00439113332f},
-std::array<float,2>{0.0986093134f, 0.902568877f},
-std::array<float,2>{0.923182726f, 0.296284258f},
-std::array<float,2>{0.507155657f, 0.976945758f},
-std::array<float,2>{0.382758796f, 0.373995632f},
-std::array<float,2>{0.210526392f, 0.553148508f},
-std::array<float,2>{0.830617547f, 0.0735890269f},
-std::array<float,2>{0.962140024f, 0.74624157f},
-std::array<float,2>{0.0398438834f, 0.241368964f},
-std::array<float,2>{0.252375484f, 0.804361522f},
-std::array<float,2>{0.642645955f, 0.399605036f},
-std::array<float,2>{0.889407396f, 0.9096784f},
-std::array<float,2>{0.0763449967f, 0.27508378f},
-std::array<float,2>{0.346780419f, 0.604749143f},
-std::array<float,2>{0.710762978f, 0.036063157f},
-std::array<float,2>{0.605796516f, 0.645614505f},
-std::array<float,2>{0.443872482f, 0.162607104f},
-std::array<float,2>{0.151867971f, 0.839608967f},
-std::array<float,2>{0.773591399f, 0.452001005f},
-std::array<float,2>{0.67178756f, 0.753722608f},
-std::array<float,2>{0.295000821f, 0.408460289f},
-std::array<float,2>{0.00906584132f, 0.718157709f},
-std::array<float,2>{0.999125957f, 0.214698821f},
-std::array<float,2>{0.850175142f, 0.510663152f},
-std::array<float,2>{0.230598763f, 0.114536531f},
-std::array<float,2>{0.419261009f, 0.968165576f},
-std::array<float,2>{0.536239445f, 0.318230122f},
-std::array<float,2>{0.978001356f, 0.785936117f},
-std::array<float,2>{0.0202703811f, 0.387404412f},
-std::array<float,2>{0.305955857f, 0.719461262f},
-std::array<float,2>{0.676837087f, 0.223291457f},
-std::array<float,2>{0.558414817f, 0.532632768f},
-std::array<float,2>{0.426495939f, 0.0853794217f},
-std::array<float,2>{0.246829852f, 0.990204096f},
-std::array<float,2>{0.873082101f, 0.357082337f},
-std::array<float,2>{0.690245569f, 0.87727803f},
-std::array<float,2>{0.364535391f, 0.311425924f},
-std::array<float,2>{0.091770485f, 0.591576755f},
-std::array<float,2>{0.895650387f, 0.0289353728f},
-std::array<float,2>{0.761233389f, 0.679705799f},
-std::array<float,2>{0.128481284f, 0.151439875f},
-std::array<float,2>{0.456252515f, 0.866965055f},
-std::array<float,2>{0.611859083f, 0.475332201f},
-std::array<float,2>{0.820301116f, 0.939588845f},
-std::array<float,2>{0.190161169f, 0.335903376f},
-std::array<float,2>{0.400269866f, 0.516210616f},
-std::array<float,2>{0.517026603f, 0.0941554308f},
-std::array<float,2>{0.639385343f, 0.693711817f},
-std::array<float,2>{0.267553419f, 0.197489262f},
-std::array<float,2>{0.0569592044f, 0.766008198f},
-std::array<float,2>{0.948719263f, 0.429076314f},
-std::array<float,2>{0.588359475f, 0.814402521f},
-std::array<float,2>{0.494614542f, 0.467347026f},
-std::array<float,2>{0.174217299f, 0.629359007f},
-std::array<float,2>{0.812219858f, 0.186367452f},
-std::array<float,2>{0.921242118f, 0.621907175f},
-std::array<float,2>{0.117607065f, 0.0594601482f},
-std::array<float,2>{0.33855176f, 0.926110983f},
-std::array<float,2>{0.72832346f, 0.251960218f},
-std::array<float,2>{0.860004544f, 0.776996493f},
-std::array<float,2>{0.23642008f, 0.436383396f},
-std::array<float,2>{0.436486751f, 0.699838936f},
-std::array<float,2>{0.552852213f, 0.193898171f},
-std::array<float,2>{0.679758668f, 0.528895319f},
-std::array<float,2>{0.297123373f, 0.103806585f},
-std::array<float,2>{0.0241140276f, 0.948250413f},
-std::array<float,2>{0.974809706f, 0.336572468f},
-std::array<float,2>{0.617706597f, 0.931019664f},
-std::array<float,2>{0.466761231f, 0.260076612f},
-std::array<float,2>{0.133039355f, 0.613865554f},
-std::array<float,2>{0.75771296f, 0.0498098582f},
-std::array<float,2>{0.901674926f, 0.637270749f},
-std::array<float,2>{0.082587786f, 0.176738977f},
-std::array<float,2>{0.37117663f, 0.826095939f},
-std::array<float,2>{0.702089369f, 0.455168515f},
-std::array<float,2>{0.938486993f, 0.997591615f},
-std::array<float,2>{0.0542481095f, 0.343862146f},
-std::array<float,2>{0.276012838f, 0.542043209f},
-std::array<float,2>{0.63256979f, 0.0916428268f},
-std::array<float,2>{0.526246846f, 0.733219564f},
-std::array<float,2>{0.396797925f, 0.232380435f},
-std::array<float,2>{0.195550576f, 0.793502629f},
-std::array<float,2>{0.820357978f, 0.377558738f},
-std::array<float,2>{0.725829542f, 0.868582964f},
-std::array<float,2>{0.334596217f, 0.47818017f},
-std::array<float,2>{0.110663533f, 0.672001064f},
-std::array<float,2>{0.9091658f, 0.141062438f},
-std::array<float,2>{0.799091339f, 0.581097126f},
-std::array<float,2>{0.184723094f, 0.0175196528f},
-std::array<float,2>{0.49122417f, 0.884583712f},
-std::array<float,2>{0.579603255f, 0.298160911f},
-std::array<float,2>{0.929787397f, 0.830678701f},
-std::array<float,2>{0.107925303f, 0.440449566f},
-std::array<float,2>{0.326956064f, 0.650745988f},
-std::array<float,2>{0.744906723f, 0.166270539f},
-std::array<float,2>{0.566634417f, 0.593844354f},
-std::array<float,2>{0.479104131f, 0.0394304357f},
-std::array<float,2>{0.162287459f, 0.919487596f},
-std::array<float,2>{0.796159327f, 0.265911311f},
-std::array<float,2>{0.649015844f, 0.957891405f},
-std::array<float,2>{0.258771479f, 0.323014975f},
-std::array<float,2>{0.0379346609f, 0.504341602f},
-std::array<float,2>{0.958624899f, 0.123705916f},
-std::array<float,2>{0.835986912f, 0.707452118f},
-std::array<float,2>{0.216678903f, 0.208065704f},
-std::array<float,2>{0.39055267f, 0.762306869f},
-std::array<float,2>{0.514846981f, 0.417079926f},
-std::array<float,2>{0.769553781f, 0.894118071f},
-std::array<float,2>{0.140929163f, 0.287679374f},
-std::array<float,2>{0.449388385f, 0.571123302f},
-std::array<float,2>{0.596741259f, 0.011486752f},
-std::array<float,2>{0.71396631f, 0.656804979f},
-std::array<float,2>{0.351725519f, 0.132874221f},
-std::array<float,2>{0.0651374459f, 0.857548535f},
-std::array<float,2>{0.880652487f, 0.493332952f},
-std::array<float,2>{0.54565531f, 0.80637455f},
-std::array<float,2>{0.410874099f, 0.398132205f},
-std::array<float,2>{0.219815031f, 0.737656236f},
-std::array<float,2>{0.857183456f, 0.247572705f},
-std::array<float,2>{0.985060394f, 0.55469954f},
-std::array<float,2>{0.00324865268f, 0.0689056814f},
-std::array<float,2>{0.285468847f, 0.974699974f},
-std::array<float,2>{0.657966971f, 0.360565126f},
-std::array<float,2>{0.804076135f, 0.757662296f},
-std::array<float,2>{0.181936115f, 0.412455738f},
-std::array<float,2>{0.487432957f, 0.713850856f},
-std::array<float,2>{0.584623516f, 0.218582407f},
-std::array<float,2>{0.721361637f, 0.513665259f},
-std::array<float,2>{0.331562519f, 0.11278569f},
-std::array<float,2>{0.115723245f, 0.961409628f},
-std::array<float,2>{0.913897276f, 0.315376192f},
-std::array<float,2>{0.528032482f, 0.912154257f},
-std::array<float,2>{0.391324252f, 0.280531228f},
-std::array<float,2>{0.201332629f, 0.606760919f},
-std::array<float,2>{0.824940264f, 0.0317122228f},
-std::array<float,2>{0.941833317f, 0.644400954f},
-std::array<float,2>{0.0506928712f, 0.159996733f},
-std::array<float,2>{0.278126329f, 0.840481102f},
-std::array<float,2>{0.625528395f, 0.445725083f},
-std::array<float,2>{0.902591169f, 0.983738482f},
-std::array<float,2>{0.0816269815f, 0.369752645f},
-std::array<float,2>{0.37100178f, 0.547717869f},
-std::array<float,2>{0.695739567f, 0.0779544637f},
-std::array<float,2>{0.622318327f, 0.742801785f},
-std::array<float,2>{0.461947203f, 0.237700135f},
-std::array<float,2>{0.139270902f, 0.796919227f},
-std::array<float,2>{0.753263295f, 0.404413104f},
-std::array<float,2>{0.684910715f, 0.844810665f},
-std::array<float,2>{0.300822079f, 0.485109925f},
-std::array<float,2>{0.0290597305f, 0.666043818f},
-std::array<float,2>{0.970612407f, 0.128678203f},
-std::array<float,2>{0.864429951f, 0.568640947f},
-std::array<float,2>{0.238996625f, 0.000615660741f},
-std::array<float,2>{0.432594776f, 0.898682952f},
-std::array<float,2>{0.550454378f, 0.289632678f},
-std::array<float,2>{0.989178538f, 0.816946805f},
-std::array<float,2>{0.00464732479f, 0.464257598f},
-std::array<float,2>{0.283241957f, 0.625528812f},
-std::array<float,2>{0.663705111f, 0.18198441f},
-std::array<float,2>{0.542320728f, 0.619251013f},
-std::array<float,2>{0.406810731f, 0.0558098517f},
-std::array<float,2>{0.223083943f, 0.922106624f},
-std::array<float,2>{0.85305512f, 0.255651981f},
-std::array<float,2>{0.716989994f, 0.944867313f},
-std::array<float,2>{0.35721606f, 0.331023306f},
-std::array<float,2>{0.067280665f, 0.522399187f},
-std::array<float,2>{0.876044393f, 0.0990205333f},
-std::array<float,2>{0.767884612f, 0.690619171f},
-std::array<float,2>{0.145853743f, 0.199220687f},
-std::array<float,2>{0.447066367f, 0.771350563f},
-std::array<float,2>{0.598923564f, 0.424813718f},
-std::array<float,2>{0.842412949f, 0.880574524f},
-std::array<float,2>{0.213262394f, 0.305743843f},
-std::array<float,2>{0.384340554f, 0.587187231f},
-std::array<float,2>{0.508813977f, 0.02420328f},
-std::array<float,2>{0.653824747f, 0.684798956f},
-std::array<float,2>{0.264003575f, 0.154786959f},
-std::array<float,2>{0.0346195512f, 0.862320244f},
-std::array<float,2>{0.954506874f, 0.470163703f},
-std::array<float,2>{0.565155327f, 0.78132242f},
-std::array<float,2>{0.481960118f, 0.383548468f},
-std::array<float,2>{0.158674598f, 0.723644257f},
-std::array<float,2>{0.792293727f, 0.221704736f},
-std::array<float,2>{0.936165869f, 0.53755033f},
-std::array<float,2>{0.104353227f, 0.0789540634f},
-std::array<float,2>{0.321421623f, 0.98504895f},
-std::array<float,2>{0.749925077f, 0.352007776f},
-std::array<float,2>{0.846604645f, 0.871479809f},
-std::array<float,2>{0.229421258f, 0.483757049f},
-std::array<float,2>{0.417440236f, 0.678209901f},
-std::array<float,2>{0.532852411f, 0.146784365f},
-std::array<float,2>{0.666366994f, 0.583458662f},
-std::array<float,2>{0.290983558f, 0.0208515767f},
-std::array<float,2>{0.0152260233f, 0.890342414f},
-std::array<float,2>{0.995828748f, 0.302762836f},
-std::array<float,2>{0.605027676f, 0.994211018f},
-std::array<float,2>{0.440565825f, 0.348528355f},
-std::array<float,2>{0.154701471f, 0.545851469f},
-std::array<float,2>{0.777619183f, 0.0894423351f},
-std::array<float,2>{0.883024752f, 0.729361832f},
-std::array<float,2>{0.0704630986f, 0.229257464f},
-std::array<float,2>{0.348676175f, 0.790742397f},
-std::array<float,2>{0.706785798f, 0.380598158f},
-std::array<float,2>{0.967155635f, 0.935543358f},
-std::array<float,2>{0.0433942415f, 0.262061298f},
-std::array<float,2>{0.257341295f, 0.610420763f},
-std::array<float,2>{0.645291328f, 0.053528294f},
-std::array<float,2>{0.503574073f, 0.634119749f},
-std::array<float,2>{0.378829479f, 0.175345451f},
-std::array<float,2>{0.203579634f, 0.822816968f},
-std::array<float,2>{0.832444012f, 0.457887381f},
-std::array<float,2>{0.740914762f, 0.777761459f},
-std::array<float,2>{0.314414024f, 0.433173269f},
-std::array<float,2>{0.0950544253f, 0.69662106f},
-std::array<float,2>{0.927193999f, 0.191272527f},
-std::array<float,2>{0.785384059f, 0.52706629f},
-std::array<float,2>{0.16429387f, 0.108236961f},
-std::array<float,2>{0.471091866f, 0.951084852f},
-std::array<float,2>{0.575593054f, 0.343454897f},
-std::array<float,2>{0.916946113f, 0.811567485f},
-std::array<float,2>{0.122220196f, 0.394270957f},
-std::array<float,2>{0.340662688f, 0.741921067f},
-std::array<float,2>{0.731347859f, 0.245483026f},
-std::array<float,2>{0.592517972f, 0.559014201f},
-std::array<float,2>{0.499457866f, 0.0656397343f},
-std::array<float,2>{0.178220674f, 0.972504377f},
-std::array<float,2>{0.808158159f, 0.363381982f},
-std::array<float,2>{0.635870397f, 0.895769656f},
-std::array<float,2>{0.271774918f, 0.282916784f},
-std::array<float,2>{0.0600959025f, 0.574917078f},
-std::array<float,2>{0.949482203f, 0.0151600316f},
-std::array<float,2>{0.813712835f, 0.663745105f},
-std::array<float,2>{0.192347258f, 0.139640033f},
-std::array<float,2>{0.403052777f, 0.855464935f},
-std::array<float,2>{0.521095514f, 0.497186899f},
-std::array<float,2>{0.765583992f, 0.95646137f},
-std::array<float,2>{0.129400566f, 0.325792491f},
-std::array<float,2>{0.457077503f, 0.500229359f},
-std::array<float,2>{0.614900887f, 0.11935813f},
-std::array<float,2>{0.692513168f, 0.705803692f},
-std::array<float,2>{0.361904979f, 0.203834921f},
-std::array<float,2>{0.089313291f, 0.758597374f},
-std::array<float,2>{0.890692413f, 0.421698719f},
-std::array<float,2>{0.559254944f, 0.834754825f},
-std::array<float,2>{0.424188673f, 0.444624305f},
-std::array<float,2>{0.246077374f, 0.656051874f},
-std::array<float,2>{0.868492842f, 0.171471179f},
-std::array<float,2>{0.982351243f, 0.600973725f},
-std::array<float,2>{0.0186848287f, 0.0467173792f},
-std::array<float,2>{0.308691531f, 0.915487707f},
-std::array<float,2>{0.672577024f, 0.271775812f},
-std::array<float,2>{0.776610613f, 0.837282419f},
-std::array<float,2>{0.149674654f, 0.450818717f},
-std::array<float,2>{0.442904323f, 0.648307145f},
-std::array<float,2>{0.608785391f, 0.16181998f},
-std::array<float,2>{0.707535803f, 0.602190495f},
-std::array<float,2>{0.344587356f, 0.0375257246f},
-std::array<float,2>{0.0759049058f, 0.906501055f},
-std::array<float,2>{0.888138294f, 0.276751608f},
-std::array<float,2>{0.538474321f, 0.965114534f},
-std::array<float,2>{0.420277715f, 0.318449229f},
-std::array<float,2>{0.233579263f, 0.509172738f},
-std::array<float,2>{0.849047422f, 0.116113961f},
-std::array<float,2>{0.996696711f, 0.71495688f},
-std::array<float,2>{0.0110406848f, 0.212428614f},
-std::array<float,2>{0.293454498f, 0.750811458f},
-std::array<float,2>{0.669083834f, 0.408172756f},
-std::array<float,2>{0.924855888f, 0.906032741f},
-std::array<float,2>{0.100369833f, 0.293212652f},
-std::array<float,2>{0.320002973f, 0.565603614f},
-std::array<float,2>{0.734737575f, 0.00625215285f},
-std::array<float,2>{0.572385907f, 0.670238018f},
-std::array<float,2>{0.47297588f, 0.129702672f},
-std::array<float,2>{0.168408766f, 0.850024939f},
-std::array<float,2>{0.785013735f, 0.489967614f},
-std::array<float,2>{0.641002238f, 0.802024126f},
-std::array<float,2>{0.250076413f, 0.400423825f},
-std::array<float,2>{0.0420743339f, 0.748894095f},
-std::array<float,2>{0.963939548f, 0.239307866f},
-std::array<float,2>{0.829616487f, 0.552312791f},
-std::array<float,2>{0.207461789f, 0.0714290962f},
-std::array<float,2>{0.380111039f, 0.979102135f},
-std::array<float,2>{0.50578624f, 0.372625232f},
-std::array<float,2>{0.945364535f, 0.769021749f},
-std::array<float,2>{0.0547944568f, 0.426581115f},
-std::array<float,2>{0.267933547f, 0.692360878f},
-std::array<float,2>{0.638021886f, 0.195351675f},
-std::array<float,2>{0.518177032f, 0.518720031f},
-std::array<float,2>{0.401655197f, 0.0964668468f},
-std::array<float,2>{0.188387036f, 0.938643336f},
-std::array<float,2>{0.817474902f, 0.332670093f},
-std::array<float,2>{0.730366051f, 0.92792964f},
-std::array<float,2>{0.337847203f, 0.251723945f},
-std::array<float,2>{0.119205736f, 0.624277472f},
-std::array<float,2>{0.918029547f, 0.0623124428f},
-std::array<float,2>{0.809575081f, 0.632312059f},
-std::array<float,2>{0.173738137f, 0.184218392f},
-std::array<float,2>{0.492933929f, 0.814548373f},
-std::array<float,2>{0.586923242f, 0.466603816f},
-std::array<float,2>{0.871616364f, 0.991453886f},
-std::array<float,2>{0.248772353f, 0.358508974f},
-std::array<float,2>{0.429055393f, 0.534028411f},
-std::array<float,2>{0.555057287f, 0.0836987123f},
-std::array<float,2>{0.677946746f, 0.720983028f},
-std::array<float,2>{0.308350116f, 0.224961773f},
-std::array<float,2>{0.0217600428f, 0.788966298f},
-std::array<float,2>{0.980387151f, 0.389640749f},
-std::array<float,2>{0.609763563f, 0.865137994f},
-std::array<float,2>{0.455008268f, 0.473584086f},
-std::array<float,2>{0.125025451f, 0.681675136f},
-std::array<float,2>{0.757984519f, 0.149365783f},
-std::array<float,2>{0.898035228f, 0.592567325f},
-std::array<float,2>{0.092014119f, 0.0300763175f},
-std::array<float,2>{0.366862655f, 0.875147521f},
-std::array<float,2>{0.687767982f, 0.308784395f},
-std::array<float,2>{0.822993577f, 0.796527505f},
-std::array<float,2>{0.198539287f, 0.376888782f},
-std::array<float,2>{0.394872516f, 0.731569588f},
-std::array<float,2>{0.523772001f, 0.233438417f},
-std::array<float,2>{0.629894614f, 0.539336324f},
-std::array<float,2>{0.274383277f, 0.093358919f},
-std::array<float,2>{0.0515461713f, 0.999843657f},
-std::array<float,2>{0.940188348f, 0.347313374f},
-std::array<float,2>{0.580193758f, 0.886599898f},
-std::array<float,2>{0.488927484f, 0.300204515f},
-std::array<float,2>{0.186200276f, 0.578908026f},
-std::array<float,2>{0.797501445f, 0.0185154639f},
-std::array<float,2>{0.906270206f, 0.674683392f},
-std::array<float,2>{0.111662537f, 0.1442727f},
-std::array<float,2>{0.332841158f, 0.86965251f},
-std::array<float,2>{0.724260151f, 0.479508311f},
-std::array<float,2>{0.973566294f, 0.945855379f},
-std::array<float,2>{0.0259660259f, 0.338966608f},
-std::array<float,2>{0.299188375f, 0.530557394f},
-std::array<float,2>{0.682343125f, 0.103470616f},
-std::array<float,2>{0.551981568f, 0.702765465f},
-std::array<float,2>{0.434508711f, 0.193088844f},
-std::array<float,2>{0.234998986f, 0.774073362f},
-std::array<float,2>{0.862181604f, 0.434527427f},
-std::array<float,2>{0.700631201f, 0.826874316f},
-std::array<float,2>{0.373374104f, 0.454718232f},
-std::array<float,2>{0.0858133137f, 0.639966249f},
-std::array<float,2>{0.900251448f, 0.177759871f},
-std::array<float,2>{0.754478097f, 0.617007196f},
-std::array<float,2>{0.135288253f, 0.0481456332f},
-std::array<float,2>{0.468712509f, 0.932381332f},
-std::array<float,2>{0.620828271f, 0.258201092f},
-std::array<float,2>{0.882743895f, 0.857129633f},
-std::array<float,2>{0.0630183145f, 0.494542003f},
-std::array<float,2>{0.35382542f, 0.65967375f},
-std::array<float,2>{0.712816358f, 0.135350093f},
-std::array<float,2>{0.594522059f, 0.573410809f},
-std::array<float,2>{0.451966763f, 0.00927454326f},
-std::array<float,2>{0.142745942f, 0.891295373f},
-std::array<float,2>{0.772983968f, 0.28671965f},
-std::array<float,2>{0.660061538f, 0.974501967f},
-std::array<float,2>{0.288516879f, 0.362281919f},
-std::array<float,2>{0.00121217407f, 0.558402717f},
-std::array<float,2>{0.987884343f, 0.0667838156f},
-std::array<float,2>{0.859173179f, 0.735720515f},
-std::array<float,2>{0.221293017f, 0.248047769f},
-std::array<float,2>{0.413770616f, 0.808192253f},
-std::array<float,2>{0.543776929f, 0.395528674f},
-std::array<float,2>{0.793140471f, 0.920140266f},
-std::array<float,2>{0.160484821f, 0.267579556f},
-std::array<float,2>{0.476695567f, 0.59727937f},
-std::array<float,2>{0.57013315f, 0.0412807651f},
-std::array<float,2>{0.742347002f, 0.649609685f},
-std::array<float,2>{0.32440263f, 0.16572015f},
-std::array<float,2>{0.106055185f, 0.82927984f},
-std::array<float,2>{0.932901978f, 0.438829035f},
-std::array<float,2>{0.512983143f, 0.764337122f},
-std::array<float,2>{0.387327254f, 0.414396882f},
-std::array<float,2>{0.218650401f, 0.709730268f},
-std::array<float,2>{0.839011908f, 0.210253373f},
-std::array<float,2>{0.959878743f, 0.506847441f},
-std::array<float,2>{0.0369383246f, 0.121844955f},
-std::array<float,2>{0.259979934f, 0.960311055f},
-std::array<float,2>{0.651781559f, 0.320738494f},
-std::array<float,2>{0.767455041f, 0.770256579f},
-std::array<float,2>{0.14725922f, 0.4244968f},
-std::array<float,2>{0.4482328f, 0.689984262f},
-std::array<float,2>{0.599843979f, 0.200433999f},
-std::array<float,2>{0.716430187f, 0.522852063f},
-std::array<float,2>{0.358468115f, 0.0977680981f},
-std::array<float,2>{0.0699710697f, 0.943970084f},
-std::array<float,2>{0.877423525f, 0.33199352f},
-std::array<float,2>{0.539157927f, 0.923560321f},
-std::array<float,2>{0.409488559f, 0.25456816f},
-std::array<float,2>{0.226444513f, 0.620538116f},
-std::array<float,2>{0.855148315f, 0.054710757f},
-std::array<float,2>{0.990869999f, 0.625990927f},
-std::array<float,2>{0.0067062201f, 0.183240563f},
-std::array<float,2>{0.281504661f, 0.817583025f},
-std::array<float,2>{0.660734594f, 0.463788033f},
-std::array<float,2>{0.934915304f, 0.985685408f},
-std::array<float,2>{0.102028206f, 0.352642655f},
-std::array<float,2>{0.32367003f, 0.538204491f},
-std::array<float,2>{0.74802506f, 0.0797000527f},
-std::array<float,2>{0.563794851f, 0.7230317f},
-std::array<float,2>{0.484191805f, 0.221315861f},
-std::array<float,2>{0.156579822f, 0.782977104f},
-std::array<float,2>{0.790551841f, 0.384246975f},
-std::array<float,2>{0.654466808f, 0.861626744f},
-std::array<float,2>{0.26335749f, 0.469498754f},
-std::array<float,2>{0.0331029221f, 0.684168339f},
-std::array<float,2>{0.955836892f, 0.155851379f},
-std::array<float,2>{0.841562569f, 0.586293042f},
-std::array<float,2>{0.211564675f, 0.0244182572f},
-std::array<float,2>{0.38649261f, 0.879174948f},
-std::array<float,2>{0.510538518f, 0.30500561f},
-std::array<float,2>{0.943950891f, 0.841619074f},
-std::array<float,2>{0.0474208184f, 0.447027534f},
-std::array<float,2>{0.280777901f, 0.643087506f},
-std::array<float,2>{0.627893448f, 0.158501148f},
-std::array<float,2>{0.531005621f, 0.605739892f},
-std::array<float,2>{0.392689675f, 0.0323826782f},
-std::array<float,2>{0.200954184f, 0.913801491f},
-std::array<float,2>{0.82714349f, 0.279595405f},
-std::array<float,2>{0.720039308f, 0.962515891f},
-std::array<float,2>{0.330076307f, 0.31573385f},
-std::array<float,2>{0.114044316f, 0.512193978f},
-std::array<float,2>{0.910283566f, 0.111497365f},
-std::array<float,2>{0.802671432f, 0.713929415f},
-std::array<float,2>{0.179810211f, 0.217769355f},
-std::array<float,2>{0.485969096f, 0.755887568f},
-std::array<float,2>{0.582496405f, 0.413763434f},
-std::array<float,2>{0.866719067f, 0.899856806f},
-std::array<float,2>{0.241758779f, 0.2902354f},
-std::array<float,2>{0.431441814f, 0.569604039f},
-std::array<float,2>{0.548401177f, 0.00105476961f},
-std::array<float,2>{0.685812831f, 0.667428136f},
-std::array<float,2>{0.303730518f, 0.127393082f},
-std::array<float,2>{0.0295860879f, 0.843771756f},
-std::array<float,2>{0.970933259f, 0.486257225f},
-std::array<float,2>{0.624823451f, 0.798000753f},
-std::array<float,2>{0.464822441f, 0.405484796f},
-std::array<float,2>{0.137006417f, 0.743801415f},
-std::array<float,2>{0.751504183f, 0.236805886f},
-std::array<float,2>{0.904327333f, 0.548175216f},
-std::array<float,2>{0.0792935267f, 0.0765449181f},
-std::array<float,2>{0.368412584f, 0.983133435f},
-std::array<float,2>{0.698876381f, 0.370120764f},
-std::array<float,2>{0.815198302f, 0.854212821f},
-std::array<float,2>{0.194512978f, 0.496836662f},
-std::array<float,2>{0.404636562f, 0.662391961f},
-std::array<float,2>{0.522575498f, 0.140224427f},
-std::array<float,2>{0.634671092f, 0.575731099f},
-std::array<float,2>{0.270443112f, 0.0136990454f},
-std::array<float,2>{0.0614959523f, 0.895128906f},
-std::array<float,2>{0.952314913f, 0.281315863f},
-std::array<float,2>{0.590879202f, 0.971337199f},
-std::array<float,2>{0.496587992f, 0.364955366f},
-std::array<float,2>{0.17726405f, 0.559838891f},
-std::array<float,2>{0.804863274f, 0.0650583133f},
-std::array<float,2>{0.915133715f, 0.740445435f},
-std::array<float,2>{0.123344995f, 0.24448432f},
-std::array<float,2>{0.342596352f, 0.810965657f},
-std::array<float,2>{0.734139681f, 0.392655849f},
-std::array<float,2>{0.984148204f, 0.914779246f},
-std::array<float,2>{0.0172511134f, 0.272945374f},
-std::array<float,2>{0.311639696f, 0.599724591f},
-std::array<float,2>{0.67452985f, 0.0449298285f},
-std::array<float,2>{0.562278509f, 0.654468954f},
-std::array<float,2>{0.422369391f, 0.170727029f},
-std::array<float,2>{0.244071499f, 0.83529973f},
-std::array<float,2>{0.870198071f, 0.444322705f},
-std::array<float,2>{0.693461537f, 0.758902073f},
-std::array<float,2>{0.36063078f, 0.420764953f},
-std::array<float,2>{0.0864825547f, 0.706784725f},
-std::array<float,2>{0.894313633f, 0.204510272f},
-std::array<float,2>{0.762110412f, 0.501704097f},
-std::array<float,2>{0.132002473f, 0.120931827f},
-std::array<float,2>{0.459045619f, 0.955280662f},
-std::array<float,2>{0.616969287f, 0.324769527f},
-std::array<float,2>{0.886446536f, 0.789821982f},
-std::array<float,2>{0.0732376948f, 0.379501671f},
-std::array<float,2>{0.349975497f, 0.729758799f},
-std::array<float,2>{0.703764379f, 0.229636446f},
-std::array<float,2>{0.602508485f, 0.546866119f},
-std::array<float,2>{0.438009709f, 0.0886930898f},
-std::array<float,2>{0.152778268f, 0.995403886f},
-std::array<float,2>{0.780471504f, 0.349135339f},
-std::array<float,2>{0.665620029f, 0.888953626f},
-std::array<float,2>{0.291160405f, 0.303739756f},
-std::array<float,2>{0.0130711878f, 0.58211875f},
-std::array<float,2>{0.99228549f, 0.0204748381f},
-std::array<float,2>{0.845354319f, 0.679483235f},
-std::array<float,2>{0.227244616f, 0.148040801f},
-std::array<float,2>{0.414192647f, 0.872631609f},
-std::array<float,2>{0.534722626f, 0.48252669f},
-std::array<float,2>{0.788729489f, 0.949730754f},
-std::array<float,2>{0.166137561f, 0.342033923f},
-std::array<float,2>{0.469256997f, 0.525928319f},
-std::array<float,2>{0.578059435f, 0.108737946f},
-std::array<float,2>{0.739730597f, 0.696177244f},
-std::array<float,2>{0.316139519f, 0.189967707f},
-std::array<float,2>{0.0962565392f, 0.779196858f},
-std::array<float,2>{0.929123163f, 0.431923687f},
-std::array<float,2>{0.50097239f, 0.823960185f},
-std::array<float,2>{0.376643389f, 0.458912611f},
-std::array<float,2>{0.206332833f, 0.632876515f},
-std::array<float,2>{0.834321916f, 0.174715519f},
-std::array<float,2>{0.965173423f, 0.609572828f},
-std::array<float,2>{0.0468050204f, 0.0543841161f},
-std::array<float,2>{0.255110085f, 0.934223533f},
-std::array<float,2>{0.647244871f, 0.263649017f},
-std::array<float,2>{0.811338484f, 0.815816581f},
-std::array<float,2>{0.175340503f, 0.465151757f},
-std::array<float,2>{0.495250434f, 0.631523371f},
-std::array<float,2>{0.589350164f, 0.184867382f},
-std::array<float,2>{0.726918519f, 0.623511255f},
-std::array<float,2>{0.339596003f, 0.0606366545f},
-std::array<float,2>{0.118445501f, 0.928749084f},
-std::array<float,2>{0.920674443f, 0.250787437f},
-std::array<float,2>{0.51596272f, 0.937961578f},
-std::array<float,2>{0.399322808f, 0.333765298f},
-std::array<float,2>{0.190650135f, 0.517677128f},
-std::array<float,2>{0.819307089f, 0.09680783f},
-std::array<float,2>{0.947414577f, 0.692694128f},
-std::array<float,2>{0.0585568547f, 0.196662039f},
-std::array<float,2>{0.266078889f, 0.768435895f},
-std::array<float,2>{0.63991642f, 0.427197248f},
-std::array<float,2>{0.895371318f, 0.87685746f},
-std::array<float,2>{0.0900284573f, 0.310322911f},
-std::array<float,2>{0.363848507f, 0.593731999f},
-std::array<float,2>{0.690805554f, 0.0312050208f},
-std::array<float,2>{0.612900138f, 0.683467805f},
-std::array<float,2>{0.455864489f, 0.149587378f},
-std::array<float,2>{0.127437249f, 0.863486469f},
-std::array<float,2>{0.759894073f, 0.473635048f},
-std::array<float,2>{0.675879419f, 0.788016081f},
-std::array<float,2>{0.305598587f, 0.389802814f},
-std::array<float,2>{0.0209366102f, 0.722029626f},
-std::array<float,2>{0.977489829f, 0.226373881f},
-std::array<float,2>{0.87430197f, 0.534463704f},
-std::array<float,2>{0.247998953f, 0.0827358589f},
-std::array<float,2>{0.427039176f, 0.991167843f},
-std::array<float,2>{0.557338297f, 0.357884854f},
-std::array<float,2>{0.998262584f, 0.751396239f},
-std::array<float,2>{0.00865509268f, 0.406686455f},
-std::array<float,2>{0.296290994f, 0.716452718f},
-std::array<float,2>{0.669926763f, 0.211638257f},
-std::array<float,2>{0.53534168f, 0.50802052f},
-std::array<float,2>{0.41863665f, 0.116821341f},
-std::array<float,2>{0.231903508f, 0.966060221f},
-std::array<float,2>{0.8505916f, 0.319553494f},
-std::array<float,2>{0.709792733f, 0.907813191f},
-std::array<float,2>{0.346467078f, 0.276208103f},
-std::array<float,2>{0.0777502805f, 0.602669537f},
-std::array<float,2>{0.889935374f, 0.0386166126f},
-std::array<float,2>{0.775202155f, 0.646699369f},
-std::array<float,2>{0.150767222f, 0.160947785f},
-std::array<float,2>{0.444629043f, 0.836312354f},
-std::array<float,2>{0.607315719f, 0.449829668f},
-std::array<float,2>{0.831644833f, 0.979738235f},
-std::array<float,2>{0.209538132f, 0.371421188f},
-std::array<float,2>{0.381729394f, 0.551684618f},
-std::array<float,2>{0.50587821f, 0.0708141997f},
-std::array<float,2>{0.64417094f, 0.749632776f},
-std::array<float,2>{0.253031313f, 0.23846443f},
-std::array<float,2>{0.040221747f, 0.800979137f},
-std::array<float,2>{0.961483896f, 0.402159423f},
-std::array<float,2>{0.571623206f, 0.851420462f},
-std::array<float,2>{0.476023912f, 0.488462836f},
-std::array<float,2>{0.170753062f, 0.671160996f},
-std::array<float,2>{0.781931996f, 0.129967421f},
-std::array<float,2>{0.922255754f, 0.564585149f},
-std::array<float,2>{0.0986844897f, 0.00703914557f},
-std::array<float,2>{0.317494959f, 0.904922307f},
-std::array<float,2>{0.736801505f, 0.294546008f},
-std::array<float,2>{0.855932057f, 0.806996167f},
-std::array<float,2>{0.218882069f, 0.394843847f},
-std::array<float,2>{0.412101865f, 0.734565794f},
-std::array<float,2>{0.546049237f, 0.249370053f},
-std::array<float,2>{0.65681535f, 0.556885421f},
-std::array<float,2>{0.286811322f, 0.0676486194f},
-std::array<float,2>{0.0023884431f, 0.972956955f},
-std::array<float,2>{0.985415459f, 0.363227963f},
-std::array<float,2>{0.595787168f, 0.892265558f},
-std::array<float,2>{0.450410068f, 0.285512477f},
-std::array<float,2>{0.141987011f, 0.572379827f},
-std::array<float,2>{0.771039605f, 0.00867046602f},
-std::array<float,2>{0.879692078f, 0.658318937f},
-std::array<float,2>{0.0658878759f, 0.136235043f},
-std::array<float,2>{0.352797359f, 0.855941415f},
-std::array<float,2>{0.713245451f, 0.496059388f},
-std::array<float,2>{0.957911015f, 0.959460139f},
-std::array<float,2>{0.0389530957f, 0.321613818f},
-std::array<float,2>{0.259352773f, 0.506645322f},
-std::array<float,2>{0.649509728f, 0.12295711f},
-std::array<float,2>{0.513990402f, 0.710723817f},
-std::array<float,2>{0.388757944f, 0.209623277f},
-std::array<float,2>{0.215496838f, 0.765300989f},
-std::array<float,2>{0.836950183f, 0.415971786f},
-std::array<float,2>{0.745597541f, 0.828273118f},
-std::array<float,2>{0.327596396f, 0.437781513f},
-std::array<float,2>{0.108805567f, 0.648448229f},
-std::array<float,2>{0.931546807f, 0.164976135f},
-std::array<float,2>{0.795064688f, 0.596256852f},
-std::array<float,2>{0.163924709f, 0.0421676114f},
-std::array<float,2>{0.480172008f, 0.921209633f},
-std::array<float,2>{0.56804353f, 0.269388527f},
-std::array<float,2>{0.909352899f, 0.870185673f},
-std::array<float,2>{0.109666973f, 0.478639632f},
-std::array<float,2>{0.335293472f, 0.675379395f},
-std::array<float,2>{0.724716961f, 0.142626435f},
-std::array<float,2>{0.578245342f, 0.579711437f},
-std::array<float,2>{0.490608424f, 0.0189179033f},
-std::array<float,2>{0.184206173f, 0.885663867f},
-std::array<float,2>{0.799823165f, 0.299260437f},
-std::array<float,2>{0.631656647f, 0.998343468f},
-std::array<float,2>{0.276592791f, 0.346115857f},
-std::array<float,2>{0.0531309098f, 0.540709257f},
-std::array<float,2>{0.937808514f, 0.0921518207f},
-std::array<float,2>{0.822026968f, 0.730510354f},
-std::array<float,2>{0.197077796f, 0.232651189f},
-std::array<float,2>{0.397862345f, 0.795624316f},
-std::array<float,2>{0.527197003f, 0.375514448f},
-std::array<float,2>{0.756402791f, 0.933096528f},
-std::array<float,2>{0.13470602f, 0.259199291f},
-std::array<float,2>{0.465610236f, 0.61619091f},
-std::array<float,2>{0.618464351f, 0.0476014428f},
-std::array<float,2>{0.702762306f, 0.639129102f},
-std::array<float,2>{0.372619182f, 0.179218993f},
-std::array<float,2>{0.0835758373f, 0.827335298f},
-std::array<float,2>{0.900517166f, 0.45403865f},
-std::array<float,2>{0.55445832f, 0.774844944f},
-std::array<float,2>{0.436546534f, 0.435131043f},
-std::array<float,2>{0.237647071f, 0.701902628f},
-std::array<float,2>{0.861267269f, 0.192024544f},
-std::array<float,2>{0.975756407f, 0.529799998f},
-std::array<float,2>{0.024499163f, 0.10233473f},
-std::array<float,2>{0.298104495f, 0.946986258f},
-std::array<float,2>{0.680941284f, 0.33793807f},
-std::array<float,2>{0.791489542f, 0.784185827f},
-std::array<float,2>{0.160141394f, 0.384943873f},
-std::array<float,2>{0.481350034f, 0.725419223f},
-std::array<float,2>{0.566138923f, 0.219595775f},
-std::array<float,2>{0.748323262f, 0.535412371f},
-std::array<float,2>{0.321168453f, 0.0801334307f},
-std::array<float,2>{0.104566507f, 0.986334264f},
-std::array<float,2>{0.937368155f, 0.354478627f},
-std::array<float,2>{0.508489668f, 0.882433176f},
-std::array<float,2>{0.382977873f, 0.307941049f},
-std::array<float,2>{0.214429364f, 0.588667691f},
-std::array<float,2>{0.843147218f, 0.0266284216f},
-std::array<float,2>{0.953438878f, 0.6862728f},
-std::array<float,2>{0.0341073461f, 0.154057577f},
-std::array<float,2>{0.264680028f, 0.860160708f},
-std::array<float,2>{0.652586043f, 0.471045285f},
-std::array<float,2>{0.875699282f, 0.941992164f},
-std::array<float,2>{0.0677433908f, 0.328772396f},
-std::array<float,2>{0.355975866f, 0.520160258f},
-std::array<float,2>{0.718333781f, 0.100133047f},
-std::array<float,2>{0.598499596f, 0.688066125f},
-std::array<float,2>{0.4458915f, 0.202140495f},
-std::array<float,2>{0.1452609f, 0.772433877f},
-std::array<float,2>{0.769127429f, 0.422909498f},
-std::array<float,2>{0.662523448f, 0.818966687f},
-std::array<float,2>{0.284966409f, 0.461903006f},
-std::array<float,2>{0.00498419814f, 0.62711513f},
-std::array<float,2>{0.990061224f, 0.179706439f},
-std::array<float,2>{0.852512896f, 0.61788106f},
-std::array<float,2>{0.224375501f, 0.0573689304f},
-std::array<float,2>{0.40748474f, 0.924778342f},
-std::array<float,2>{0.541059077f, 0.257088035f},
-std::array<float,2>{0.969346941f, 0.847214758f},
-std::array<float,2>{0.0278484561f, 0.487159103f},
-std::array<float,2>{0.301856905f, 0.665737092f},
-std::array<float,2>{0.684368253f, 0.126176164f},
-std::array<float,2>{0.549053431f, 0.567180812f},
-std::array<float,2>{0.433465391f, 0.00297548063f},
-std::array<float,2>{0.239573419f, 0.900839746f},
-std::array<float,2>{0.863377512f, 0.291093349f},
-std::array<float,2>{0.696760714f, 0.981737435f},
-std::array<float,2>{0.370007992f, 0.368573755f},
-std::array<float,2>{0.0810009688f, 0.550060332f},
-std::array<float,2>{0.903846562f, 0.0748189017f},
-std::array<float,2>{0.752512455f, 0.744538069f},
-std::array<float,2>{0.14043209f, 0.23503755f},
-std::array<float,2>{0.4615255f, 0.799189448f},
-std::array<float,2>{0.621252894f, 0.402448058f},
-std::array<float,2>{0.826064825f, 0.910306513f},
-std::array<float,2>{0.202668369f, 0.277825922f},
-std::array<float,2>{0.391677111f, 0.609210074f},
-std::array<float,2>{0.528359652f, 0.0341886841f},
-std::array<float,2>{0.626731157f, 0.642308295f},
-std::array<float,2>{0.278978527f, 0.157359794f},
-std::array<float,2>{0.0496907011f, 0.842178702f},
-std::array<float,2>{0.942460835f, 0.448660672f},
-std::array<float,2>{0.585219443f, 0.754619122f},
-std::array<float,2>{0.486690253f, 0.410418868f},
-std::array<float,2>{0.183037654f, 0.711509705f},
-std::array<float,2>{0.803386033f, 0.216452926f},
-std::array<float,2>{0.912639499f, 0.514413178f},
-std::array<float,2>{0.116740145f, 0.110147558f},
-std::array<float,2>{0.330141753f, 0.963585317f},
-std::array<float,2>{0.722181916f, 0.3127518f},
-std::array<float,2>{0.868029892f, 0.832134962f},
-std::array<float,2>{0.244600609f, 0.442251414f},
-std::array<float,2>{0.424845815f, 0.653538346f},
-std::array<float,2>{0.560128331f, 0.16865553f},
-std::array<float,2>{0.673657358f, 0.599356949f},
-std::array<float,2>{0.309838682f, 0.0445654243f},
-std::array<float,2>{0.0179351736f, 0.916181087f},
-std::array<float,2>{0.980651498f, 0.269696087f},
-std::array<float,2>{0.613313437f, 0.954105914f},
-std::array<float,2>{0.458044916f, 0.326335877f},
-std::array<float,2>{0.130757555f, 0.502486944f},
-std::array<float,2>{0.76450038f, 0.119054601f},
-std::array<float,2>{0.891808629f, 0.704698324f},
-std::array<float,2>{0.0887810662f, 0.20565486f},
-std::array<float,2>{0.363029838f, 0.761252224f},
-std::array<float,2>{0.692143559f, 0.419449687f},
-std::array<float,2>{0.95105648f, 0.89741385f},
-std::array<float,2>{0.0590104982f, 0.285125166f},
-std::array<float,2>{0.273190022f, 0.577568829f},
-std::array<float,2>{0.635382652f, 0.0117974114f},
-std::array<float,2>{0.519584537f, 0.662013471f},
-std::array<float,2>{0.403335005f, 0.138073161f},
-std::array<float,2>{0.193066865f, 0.853232145f},
-std::array<float,2>{0.813233316f, 0.498261929f},
-std::array<float,2>{0.732280254f, 0.810188234f},
-std::array<float,2>{0.340909243f, 0.391671836f},
-std::array<float,2>{0.121710345f, 0.738479853f},
-std::array<float,2>{0.917165995f, 0.24404408f},
-std::array<float,2>{0.807012022f, 0.561205626f},
-std::array<float,2>{0.179170489f, 0.0633266866f},
-std::array<float,2>{0.499007106f, 0.96881187f},
-std::array<float,2>{0.593071878f, 0.366268307f},
-std::array<float,2>{0.92660141f, 0.779692292f},
-std::array<float,2>{0.0938999131f, 0.430671185f},
-std::array<float,2>{0.312979937f, 0.697772741f},
-std::array<float,2>{0.741372466f, 0.187681913f},
-std::array<float,2>{0.575120211f, 0.524742603f},
-std::array<float,2>{0.472302407f, 0.106729351f},
-std::array<float,2>{0.165534839f, 0.952850759f},
-std::array<float,2>{0.786921501f, 0.340173453f},
-std::array<float,2>{0.646429539f, 0.9361341f},
-std::array<float,2>{0.256327152f, 0.264186978f},
-std::array<float,2>{0.0447331369f, 0.612697184f},
-std::array<float,2>{0.968003035f, 0.052365765f},
-std::array<float,2>{0.833134294f, 0.636177123f},
-std::array<float,2>{0.205051452f, 0.172651589f},
-std::array<float,2>{0.377169877f, 0.821534395f},
-std::array<float,2>{0.502744555f, 0.460273921f},
-std::array<float,2>{0.778694391f, 0.992401123f},
-std::array<float,2>{0.156125695f, 0.349727482f},
-std::array<float,2>{0.440381646f, 0.544792891f},
-std::array<float,2>{0.603676975f, 0.0872148573f},
-std::array<float,2>{0.705502033f, 0.726887345f},
-std::array<float,2>{0.348553568f, 0.226614386f},
-std::array<float,2>{0.0719330907f, 0.791740894f},
-std::array<float,2>{0.883907974f, 0.382082105f},
-std::array<float,2>{0.531670332f, 0.874936581f},
-std::array<float,2>{0.416652352f, 0.481446087f},
-std::array<float,2>{0.230133906f, 0.675854743f},
-std::array<float,2>{0.847455084f, 0.146183684f},
-std::array<float,2>{0.994899154f, 0.585142016f},
-std::array<float,2>{0.01375522f, 0.0233044066f},
-std::array<float,2>{0.289659858f, 0.887549579f},
-std::array<float,2>{0.667807579f, 0.302671194f},
-std::array<float,2>{0.759536266f, 0.865971446f},
-std::array<float,2>{0.126488611f, 0.475656211f},
-std::array<float,2>{0.453867465f, 0.680670619f},
-std::array<float,2>{0.61110419f, 0.150671691f},
-std::array<float,2>{0.688489377f, 0.590559185f},
-std::array<float,2>{0.365462393f, 0.02754746f},
-std::array<float,2>{0.0928173363f, 0.878416777f},
-std::array<float,2>{0.896960676f, 0.312452316f},
-std::array<float,2>{0.556549311f, 0.988763928f},
-std::array<float,2>{0.427914113f, 0.35595268f},
-std::array<float,2>{0.24924159f, 0.531470478f},
-std::array<float,2>{0.87275672f, 0.0840032175f},
-std::array<float,2>{0.979095817f, 0.719869733f},
-std::array<float,2>{0.0229633208f, 0.22438851f},
-std::array<float,2>{0.307122558f, 0.786769927f},
-std::array<float,2>{0.679238439f, 0.38832128f},
-std::array<float,2>{0.919625282f, 0.927675188f},
-std::array<float,2>{0.120844595f, 0.253604114f},
-std::array<float,2>{0.336911529f, 0.62299931f},
-std::array<float,2>{0.728569627f, 0.0603804626f},
-std::array<float,2>{0.586074829f, 0.630688012f},
-std::array<float,2>{0.493570179f, 0.187059969f},
-std::array<float,2>{0.172057673f, 0.812708139f},
-std::array<float,2>{0.809478819f, 0.468152434f},
-std::array<float,2>{0.637390614f, 0.767082155f},
-std::array<float,2>{0.269199073f, 0.427855581f},
-std::array<float,2>{0.0563514121f, 0.694975615f},
-std::array<float,2>{0.946754813f, 0.198483333f},
-std::array<float,2>{0.817308486f, 0.516869128f},
-std::array<float,2>{0.189302102f, 0.0951366127f},
-std::array<float,2>{0.400559723f, 0.940595865f},
-std::array<float,2>{0.518580914f, 0.334327847f},
-std::array<float,2>{0.963104129f, 0.803062677f},
-std::array<float,2>{0.0419284888f, 0.398490965f},
-std::array<float,2>{0.251086771f, 0.74771744f},
-std::array<float,2>{0.64167732f, 0.240909353f},
-std::array<float,2>{0.504625499f, 0.554097414f},
-std::array<float,2>{0.379591167f, 0.0727868676f},
-std::array<float,2>{0.208747372f, 0.978159845f},
-std::array<float,2>{0.828534126f, 0.374325395f},
-std::array<float,2>{0.736007631f, 0.903460145f},
-std::array<float,2>{0.319247454f, 0.295395315f},
-std::array<float,2>{0.100916319f, 0.564254522f},
-std::array<float,2>{0.924190104f, 0.00581707479f},
-std::array<float,2>{0.783483326f, 0.669204235f},
-std::array<float,2>{0.168951929f, 0.131652653f},
-std::array<float,2>{0.474328488f, 0.848804593f},
-std::array<float,2>{0.574157834f, 0.491194487f},
-std::array<float,2>{0.848384798f, 0.967670023f},
-std::array<float,2>{0.232828975f, 0.316731453f},
-std::array<float,2>{0.421269715f, 0.511008739f},
-std::array<float,2>{0.537356675f, 0.113423184f},
-std::array<float,2>{0.66877532f, 0.717662156f},
-std::array<float,2>{0.294890434f, 0.213201433f},
-std::array<float,2>{0.0102862995f, 0.752710342f},
-std::array<float,2>{0.99777782f, 0.409970045f},
-std::array<float,2>{0.60769254f, 0.838704765f},
-std::array<float,2>{0.441746384f, 0.452635497f},
-std::array<float,2>{0.149334103f, 0.644696534f},
-std::array<float,2>{0.775784075f, 0.163185433f},
-std::array<float,2>{0.887082696f, 0.603814781f},
-std::array<float,2>{0.0746915415f, 0.0370174088f},
-std::array<float,2>{0.345579863f, 0.908418417f},
-std::array<float,2>{0.708273828f, 0.274040788f},
-std::array<float,2>{0.838401973f, 0.763141751f},
-std::array<float,2>{0.216959223f, 0.416575462f},
-std::array<float,2>{0.388314217f, 0.708450913f},
-std::array<float,2>{0.511860728f, 0.207488596f},
-std::array<float,2>{0.651170194f, 0.505343318f},
-std::array<float,2>{0.261694133f, 0.124429204f},
-std::array<float,2>{0.0360375866f, 0.958527923f},
-std::array<float,2>{0.960149944f, 0.324045628f},
-std::array<float,2>{0.568659782f, 0.918559909f},
-std::array<float,2>{0.478308827f, 0.2666547f},
-std::array<float,2>{0.161838278f, 0.595640063f},
-std::array<float,2>{0.794434011f, 0.0404702015f},
-std::array<float,2>{0.932288468f, 0.651840746f},
-std::array<float,2>{0.10655386f, 0.167340949f},
-std::array<float,2>{0.325403035f, 0.831267595f},
-std::array<float,2>{0.743454337f, 0.43982172f},
-std::array<float,2>{0.986963391f, 0.976090252f},
-std::array<float,2>{0.000406321342f, 0.360148668f},
-std::array<float,2>{0.287834883f, 0.556436658f},
-std::array<float,2>{0.658297539f, 0.0695708692f},
-std::array<float,2>{0.544681787f, 0.736380994f},
-std::array<float,2>{0.412945807f, 0.247006238f},
-std::array<float,2>{0.222463787f, 0.804991663f},
-std::array<float,2>{0.857548237f, 0.397343159f},
-std::array<float,2>{0.711274683f, 0.858923495f},
-std::array<float,2>{0.355052203f, 0.492500275f},
-std::array<float,2>{0.0643552169f, 0.657358527f},
-std::array<float,2>{0.881245911f, 0.134192824f},
-std::array<float,2>{0.77245301f, 0.571808279f},
-std::array<float,2>{0.143818453f, 0.00995131303f},
-std::array<float,2>{0.452970296f, 0.893409073f},
-std::array<float,2>{0.594999194f, 0.288503498f},
-std::array<float,2>{0.899354458f, 0.825123012f},
-std::array<float,2>{0.0848818719f, 0.456419855f},
-std::array<float,2>{0.374796689f, 0.638510346f},
-std::array<float,2>{0.699961483f, 0.177332833f},
-std::array<float,2>{0.619532704f, 0.614376366f},
-std::array<float,2>{0.46719718f, 0.0497261658f},
-std::array<float,2>{0.136350125f, 0.930090725f},
-std::array<float,2>{0.755619168f, 0.260944784f},
-std::array<float,2>{0.682921171f, 0.947863221f},
-std::array<float,2>{0.300639272f, 0.337176591f},
-std::array<float,2>{0.0272293612f, 0.527577281f},
-std::array<float,2>{0.973688126f, 0.105288461f},
-std::array<float,2>{0.862946868f, 0.701090932f},
-std::array<float,2>{0.235985726f, 0.194650888f},
-std::array<float,2>{0.435034215f, 0.77565676f},
-std::array<float,2>{0.55141753f, 0.436810553f},
-std::array<float,2>{0.798532546f, 0.882866442f},
-std::array<float,2>{0.187318295f, 0.297172427f},
-std::array<float,2>{0.489331901f, 0.580264211f},
-std::array<float,2>{0.581431687f, 0.0160153788f},
-std::array<float,2>{0.722766399f, 0.673103571f},
-std::array<float,2>{0.333037108f, 0.142226458f},
-std::array<float,2>{0.112678409f, 0.867896318f},
-std::array<float,2>{0.907934546f, 0.477314174f},
-std::array<float,2>{0.525014877f, 0.7944718f},
-std::array<float,2>{0.395722985f, 0.378834546f},
-std::array<float,2>{0.197650775f, 0.733771205f},
-std::array<float,2>{0.823518097f, 0.230511695f},
-std::array<float,2>{0.941271424f, 0.541504562f},
-std::array<float,2>{0.0524790958f, 0.0903643668f},
-std::array<float,2>{0.274551809f, 0.996571362f},
-std::array<float,2>{0.629238784f, 0.344860673f},
-std::array<float,2>{0.780950069f, 0.791440606f},
-std::array<float,2>{0.153032199f, 0.382397681f},
-std::array<float,2>{0.43790099f, 0.72740519f},
-std::array<float,2>{0.602011442f, 0.227434129f},
-std::array<float,2>{0.703264356f, 0.543992758f},
-std::array<float,2>{0.350482643f, 0.0878611505f},
-std::array<float,2>{0.0723219365f, 0.992741466f},
-std::array<float,2>{0.886144042f, 0.350498855f},
-std::array<float,2>{0.534542024f, 0.887003899f},
-std::array<float,2>{0.41456008f, 0.301877618f},
-std::array<float,2>{0.22658363f, 0.585528076f},
-std::array<float,2>{0.844931245f, 0.0226483308f},
-std::array<float,2>{0.993006885f, 0.676634908f},
-std::array<float,2>{0.0134968786f, 0.145745233f},
-std::array<float,2>{0.291610658f, 0.874380708f},
-std::array<float,2>{0.665156186f, 0.481969416f},
-std::array<float,2>{0.929346204f, 0.952408552f},
-std::array<float,2>{0.0961878151f, 0.340498179f},
-std::array<float,2>{0.315716088f, 0.52530539f},
-std::array<float,2>{0.740175664f, 0.107285097f},
-std::array<float,2>{0.577192426f, 0.697404027f},
-std::array<float,2>{0.469231158f, 0.188456789f},
-std::array<float,2>{0.166554272f, 0.779821813f},
-std::array<float,2>{0.788400829f, 0.43162781f},
-std::array<float,2>{0.646925032f, 0.822102964f},
-std::array<float,2>{0.25550884f, 0.460778475f},
-std::array<float,2>{0.046058584f, 0.636305571f},
-std::array<float,2>{0.965419054f, 0.172108218f},
-std::array<float,2>{0.83472997f, 0.612843275f},
-std::array<float,2>{0.206790596f, 0.0517796502f},
-std::array<float,2>{0.376444966f, 0.93601042f},
-std::array<float,2>{0.50008291f, 0.263991237f},
-std::array<float,2>{0.952886522f, 0.852861404f},
-std::array<float,2>{0.0606408715f, 0.498809278f},
-std::array<float,2>{0.269940287f, 0.661578596f},
-std::array<float,2>{0.633921385f, 0.138260111f},
-std::array<float,2>{0.523435414f, 0.577673554f},
-std::array<float,2>{0.405052125f, 0.0124553582f},
-std::array<float,2>{0.194858208f, 0.896679163f},
-std::array<float,2>{0.814880371f, 0.284214765f},
-std::array<float,2>{0.733628511f, 0.969256878f},
-std::array<float,2>{0.342154324f, 0.366872936f},
-std::array<float,2>{0.123985134f, 0.560694098f},
-std::array<float,2>{0.915736318f, 0.0625813603f},
-std::array<float,2>{0.805631578f, 0.738945842f},
-std::array<float,2>{0.177105099f, 0.243349642f},
-std::array<float,2>{0.496179581f, 0.809702098f},
-std::array<float,2>{0.59154737f, 0.392425895f},
-std::array<float,2>{0.870758355f, 0.916721523f},
-std::array<float,2>{0.243468538f, 0.270287901f},
-std::array<float,2>{0.422234833f, 0.598978519f},
-std::array<float,2>{0.561798751f, 0.0439703986f},
-std::array<float,2>{0.673932731f, 0.653842509f},
-std::array<float,2>{0.312443614f, 0.16816172f},
-std::array<float,2>{0.0170564912f, 0.832580984f},
-std::array<float,2>{0.983836591f, 0.441890657f},
-std::array<float,2>{0.616311848f, 0.760865927f},
-std::array<float,2>{0.459715784f, 0.419176877f},
-std::array<float,2>{0.132555693f, 0.704134524f},
-std::array<float,2>{0.762681484f, 0.205461249f},
-std::array<float,2>{0.893989384f, 0.502395749f},
-std::array<float,2>{0.086294502f, 0.118354782f},
-std::array<float,2>{0.361129075f, 0.954706907f},
-std::array<float,2>{0.694099784f, 0.327105373f},
-std::array<float,2>{0.82657367f, 0.842633247f},
-std::array<float,2>{0.20040068f, 0.449073732f},
-std::array<float,2>{0.393376976f, 0.641672254f},
-std::array<float,2>{0.530734301f, 0.157731906f},
-std::array<float,2>{0.627358198f, 0.608465075f},
-std::array<float,2>{0.280297011f, 0.0351328552f},
-std::array<float,2>{0.0468971506f, 0.911122799f},
-std::array<float,2>{0.943544865f, 0.278118908f},
-std::array<float,2>{0.582677066f, 0.963006198f},
-std::array<float,2>{0.485513449f, 0.313094914f},
-std::array<float,2>{0.180371642f, 0.513740063f},
-std::array<float,2>{0.802084446f, 0.109853365f},
-std::array<float,2>{0.910764754f, 0.711420834f},
-std::array<float,2>{0.113515802f, 0.216234535f},
-std::array<float,2>{0.329477578f, 0.754387558f},
-std::array<float,2>{0.720399439f, 0.411053538f},
-std::array<float,2>{0.971366644f, 0.900902748f},
-std::array<float,2>{0.0302496217f, 0.291562557f},
-std::array<float,2>{0.304490328f, 0.566798985f},
-std::array<float,2>{0.686442673f, 0.0036767188f},
-std::array<float,2>{0.548287332f, 0.665289223f},
-std::array<float,2>{0.430836499f, 0.126513034f},
-std::array<float,2>{0.241230369f, 0.847040594f},
-std::array<float,2>{0.866253018f, 0.486807913f},
-std::array<float,2>{0.698704541f, 0.799641311f},
-std::array<float,2>{0.369106203f, 0.403129786f},
-std::array<float,2>{0.0800530165f, 0.745002091f},
-std::array<float,2>{0.90503937f, 0.234822765f},
-std::array<float,2>{0.751353025f, 0.550684273f},
-std::array<float,2>{0.137269124f, 0.074572511f},
-std::array<float,2>{0.464027643f, 0.982392669f},
-std::array<float,2>{0.624398947f, 0.369138151f},
-std::array<float,2>{0.877595723f, 0.771546423f},
-std::array<float,2>{0.0694705695f, 0.423533499f},
-std::array<float,2>{0.358902127f, 0.6877774f},
-std::array<float,2>{0.716254532f, 0.201207772f},
-std::array<float,2>{0.600583851f, 0.51990217f},
-std::array<float,2>{0.447674304f, 0.0996134579f},
-std::array<float,2>{0.146555066f, 0.941857696f},
-std::array<float,2>{0.76696974f, 0.32834205f},
-std::array<float,2>{0.660573065f, 0.924239695f},
-std::array<float,2>{0.282062292f, 0.257416517f},
-std::array<float,2>{0.00610136054f, 0.617646039f},
-std::array<float,2>{0.990320504f, 0.0569700673f},
-std::array<float,2>{0.85497427f, 0.627472937f},
-std::array<float,2>{0.225849941f, 0.180416793f},
-std::array<float,2>{0.410096079f, 0.818784475f},
-std::array<float,2>{0.539995492f, 0.461173207f},
-std::array<float,2>{0.790056646f, 0.987222075f},
-std::array<float,2>{0.156804159f, 0.353774935f},
-std::array<float,2>{0.483436912f, 0.536129773f},
-std::array<float,2>{0.564117074f, 0.0809810534f},
-std::array<float,2>{0.74730134f, 0.725063562f},
-std::array<float,2>{0.323808789f, 0.218815878f},
-std::array<float,2>{0.102419376f, 0.784886181f},
-std::array<float,2>{0.935264349f, 0.385613412f},
-std::array<float,2>{0.51022011f, 0.859850049f},
-std::array<float,2>{0.385754913f, 0.47132951f},
-std::array<float,2>{0.211076945f, 0.685786724f},
-std::array<float,2>{0.840930283f, 0.153452978f},
-std::array<float,2>{0.955396831f, 0.588276565f},
-std::array<float,2>{0.0326972157f, 0.0270247851f},
-std::array<float,2>{0.262737513f, 0.882032394f},
-std::array<float,2>{0.654856801f, 0.308222026f},
-std::array<float,2>{0.800611436f, 0.867612183f},
-std::array<float,2>{0.183909193f, 0.477021933f},
-std::array<float,2>{0.490918487f, 0.673364758f},
-std::array<float,2>{0.578697622f, 0.141864032f},
-std::array<float,2>{0.725313783f, 0.580797374f},
-std::array<float,2>{0.335598469f, 0.0165016521f},
-std::array<float,2>{0.110108934f, 0.883648276f},
-std::array<float,2>{0.909925222f, 0.297638237f},
-std::array<float,2>{0.526614606f, 0.996658385f},
-std::array<float,2>{0.398400784f, 0.345646262f},
-std::array<float,2>{0.196308315f, 0.541166604f},
-std::array<float,2>{0.821709454f, 0.0899421424f},
-std::array<float,2>{0.938140392f, 0.734297276f},
-std::array<float,2>{0.0536784567f, 0.231416598f},
-std::array<float,2>{0.276993513f, 0.794315279f},
-std::array<float,2>{0.631267071f, 0.378325701f},
-std::array<float,2>{0.900965333f, 0.930614531f},
-std::array<float,2>{0.0834216103f, 0.261713237f},
-std::array<float,2>{0.372247368f, 0.614832342f},
-std::array<float,2>{0.702245295f, 0.0491991416f},
-std::array<float,2>{0.619031131f, 0.637919903f},
-std::array<float,2>{0.465018213f, 0.177038461f},
-std::array<float,2>{0.133833885f, 0.824522197f},
-std::array<float,2>{0.755883873f, 0.456862718f},
-std::array<float,2>{0.681206763f, 0.776154101f},
-std::array<float,2>{0.298824847f, 0.437161505f},
-std::array<float,2>{0.0249667875f, 0.700546682f},
-std::array<float,2>{0.976363361f, 0.194904804f},
-std::array<float,2>{0.860785544f, 0.528286457f},
-std::array<float,2>{0.238255784f, 0.104959846f},
-std::array<float,2>{0.43723911f, 0.947284281f},
-std::array<float,2>{0.554117858f, 0.337573767f},
-std::array<float,2>{0.986012936f, 0.805530012f},
-std::array<float,2>{0.00284195947f, 0.396673173f},
-std::array<float,2>{0.286610842f, 0.737165928f},
-std::array<float,2>{0.656303167f, 0.246500909f},
-std::array<float,2>{0.546741068f, 0.555902064f},
-std::array<float,2>{0.411417782f, 0.0702946931f},
-std::array<float,2>{0.21953705f, 0.975800753f},
-std::array<float,2>{0.856051326f, 0.359687895f},
-std::array<float,2>{0.713511467f, 0.892876327f},
-std::array<float,2>{0.353298724f, 0.289058238f},
-std::array<float,2>{0.0664005503f, 0.571537852f},
-std::array<float,2>{0.879295051f, 0.0105742291f},
-std::array<float,2>{0.770722032f, 0.657876909f},
-std::array<float,2>{0.142143652f, 0.134413019f},
-std::array<float,2>{0.45087865f, 0.858459413f},
-std::array<float,2>{0.596566796f, 0.492758572f},
-std::array<float,2>{0.837502182f, 0.958260298f},
-std::array<float,2>{0.21510686f, 0.323544592f},
-std::array<float,2>{0.389450103f, 0.505600512f},
-std::array<float,2>{0.514239609f, 0.124828376f},
-std::array<float,2>{0.650253773f, 0.708938539f},
-std::array<float,2>{0.259234995f, 0.207886934f},
-std::array<float,2>{0.0382021964f, 0.763655841f},
-std::array<float,2>{0.957108438f, 0.416457772f},
-std::array<float,2>{0.567465067f, 0.832021832f},
-std::array<float,2>{0.47968635f, 0.44014433f},
-std::array<float,2>{0.163547307f, 0.651900828f},
-std::array<float,2>{0.795413136f, 0.167697817f},
-std::array<float,2>{0.930964768f, 0.59521234f},
-std::array<float,2>{0.109285794f, 0.0406636782f},
-std::array<float,2>{0.328012884f, 0.918186605f},
-std::array<float,2>{0.745687068f, 0.267182559f},
-std::array<float,2>{0.851102293f, 0.752208292f},
-std::array<float,2>{0.231941029f, 0.409483522f},
-std::array<float,2>{0.418078333f, 0.717198193f},
-std::array<float,2>{0.535858512f, 0.213521808f},
-std::array<float,2>{0.670821607f, 0.511514962f},
-std::array<float,2>{0.296543062f, 0.113845952f},
-std::array<float,2>{0.00800544582f, 0.966908097f},
-std::array<float,2>{0.998696804f, 0.317125887f},
-std::array<float,2>{0.606802225f, 0.908984959f},
-std::array<float,2>{0.445183724f, 0.27358067f},
-std::array<float,2>{0.15092659f, 0.604286909f},
-std::array<float,2>{0.774770379f, 0.0362385809f},
-std::array<float,2>{0.890569031f, 0.645202696f},
-std::array<float,2>{0.0775758252f, 0.163794652f},
-std::array<float,2>{0.345713377f, 0.838193059f},
-std::array<float,2>{0.709467471f, 0.452886462f},
-std::array<float,2>{0.960953951f, 0.978016794f},
-std::array<float,2>{0.0407440476f, 0.374856174f},
-std::array<float,2>{0.253640354f, 0.554330647f},
-std::array<float,2>{0.643749833f, 0.0726093277f},
-std::array<float,2>{0.506679177f, 0.74737978f},
-std::array<float,2>{0.381324559f, 0.240288302f},
-std::array<float,2>{0.209144697f, 0.803627789f},
-std::array<float,2>{0.831225038f, 0.399333656f},
-std::array<float,2>{0.737251461f, 0.84929651f},
-std::array<float,2>{0.318228304f, 0.49069494f},
-std::array<float,2>{0.0992326885f, 0.669912875f},
-std::array<float,2>{0.922675312f, 0.131146073f},
-std::array<float,2>{0.781254053f, 0.563914955f},
-std::array<float,2>{0.170041546f, 0.00524356449f},
-std::array<float,2>{0.476364583f, 0.903870404f},
-std::array<float,2>{0.572174847f, 0.295740157f},
-std::array<float,2>{0.920024216f, 0.813216031f},
-std::array<float,2>{0.119131483f, 0.46844998f},
-std::array<float,2>{0.339296222f, 0.629968166f},
-std::array<float,2>{0.727521777f, 0.186765611f},
-std::array<float,2>{0.58973974f, 0.62223208f},
-std::array<float,2>{0.495947391f, 0.0598485582f},
-std::array<float,2>{0.174822494f, 0.927171648f},
-std::array<float,2>{0.810614944f, 0.253289014f},
-std::array<float,2>{0.640354216f, 0.941388309f},
-std::array<float,2>{0.266532332f, 0.33453697f},
-std::array<float,2>{0.0579393283f, 0.517431378f},
-std::array<float,2>{0.947953224f, 0.0953348279f},
-std::array<float,2>{0.818361938f, 0.694449186f},
-std::array<float,2>{0.191316113f, 0.199009717f},
-std::array<float,2>{0.398883045f, 0.767448306f},
-std::array<float,2>{0.516359806f, 0.428595275f},
-std::array<float,2>{0.760258377f, 0.878790975f},
-std::array<float,2>{0.127622157f, 0.311867267f},
-std::array<float,2>{0.455530256f, 0.589877665f},
-std::array<float,2>{0.612606406f, 0.0282746218f},
-std::array<float,2>{0.691159129f, 0.681369483f},
-std::array<float,2>{0.363370687f, 0.151080996f},
-std::array<float,2>{0.0903400853f, 0.865418077f},
-std::array<float,2>{0.894884109f, 0.476519197f},
-std::array<float,2>{0.556898236f, 0.786208808f},
-std::array<float,2>{0.427575529f, 0.387984931f},
-std::array<float,2>{0.247475192f, 0.720454156f},
-std::array<float,2>{0.874884069f, 0.223977283f},
-std::array<float,2>{0.97676146f, 0.531902313f},
-std::array<float,2>{0.0211524218f, 0.084804073f},
-std::array<float,2>{0.304715127f, 0.989137411f},
-std::array<float,2>{0.6762954f, 0.356313318f},
-std::array<float,2>{0.786550462f, 0.778660774f},
-std::array<float,2>{0.165287554f, 0.432605952f},
-std::array<float,2>{0.471850783f, 0.695690036f},
-std::array<float,2>{0.57459271f, 0.18979612f},
-std::array<float,2>{0.742184877f, 0.525838315f},
-std::array<float,2>{0.313408494f, 0.109330647f},
-std::array<float,2>{0.0944196135f, 0.949559093f},
-std::array<float,2>{0.925789118f, 0.342711091f},
-std::array<float,2>{0.501971781f, 0.934019029f},
-std::array<float,2>{0.377851158f, 0.263158202f},
-std::array<float,2>{0.2042889f, 0.610032201f},
-std::array<float,2>{0.833793819f, 0.0540294871f},
-std::array<float,2>{0.968430996f, 0.633467019f},
-std::array<float,2>{0.0443829037f, 0.174113199f},
-std::array<float,2>{0.256566972f, 0.823475599f},
-std::array<float,2>{0.645546079f, 0.458246201f},
-std::array<float,2>{0.88429904f, 0.995925307f},
-std::array<float,2>{0.0716745704f, 0.349000961f},
-std::array<float,2>{0.347751141f, 0.546340764f},
-std::array<float,2>{0.705592215f, 0.0880995169f},
-std::array<float,2>{0.604193807f, 0.730250299f},
-std::array<float,2>{0.439901292f, 0.230305955f},
-std::array<float,2>{0.155586183f, 0.789140344f},
-std::array<float,2>{0.778808773f, 0.379251003f},
-std::array<float,2>{0.667241037f, 0.87236774f},
-std::array<float,2>{0.289189994f, 0.483178765f},
-std::array<float,2>{0.0143613657f, 0.679084003f},
-std::array<float,2>{0.994299412f, 0.147619575f},
-std::array<float,2>{0.846987724f, 0.582527936f},
-std::array<float,2>{0.229796335f, 0.019591257f},
-std::array<float,2>{0.416210324f, 0.889461875f},
-std::array<float,2>{0.531930685f, 0.304371148f},
-std::array<float,2>{0.981387436f, 0.835899591f},
-std::array<float,2>{0.0182595924f, 0.443420887f},
-std::array<float,2>{0.310322344f, 0.655054152f},
-std::array<float,2>{0.673157454f, 0.170132369f},
-std::array<float,2>{0.559798956f, 0.600393713f},
-std::array<float,2>{0.425627023f, 0.0456398241f},
-std::array<float,2>{0.244691476f, 0.914281845f},
-std::array<float,2>{0.867277205f, 0.273388207f},
-std::array<float,2>{0.691421568f, 0.95587188f},
-std::array<float,2>{0.362599909f, 0.324371219f},
-std::array<float,2>{0.0879332572f, 0.501383185f},
-std::array<float,2>{0.892091572f, 0.120241724f},
-std::array<float,2>{0.763837576f, 0.706531286f},
-std::array<float,2>{0.130264238f, 0.20468156f},
-std::array<float,2>{0.45868361f, 0.759527504f},
-std::array<float,2>{0.61391592f, 0.420060247f},
-std::array<float,2>{0.812866807f, 0.894886971f},
-std::array<float,2>{0.192402467f, 0.281750172f},
-std::array<float,2>{0.404008359f, 0.575254381f},
-std::array<float,2>{0.520505905f, 0.0141737582f},
-std::array<float,2>{0.635173142f, 0.662821531f},
-std::array<float,2>{0.272503614f, 0.139798909f},
-std::array<float,2>{0.0593085326f, 0.853619099f},
-std::array<float,2>{0.950448811f, 0.496316046f},
-std::array<float,2>{0.593526363f, 0.811424732f},
-std::array<float,2>{0.498339385f, 0.393372715f},
-std::array<float,2>{0.179618225f, 0.741164625f},
-std::array<float,2>{0.807568371f, 0.245066404f},
-std::array<float,2>{0.917853832f, 0.56050086f},
-std::array<float,2>{0.121493116f, 0.0648857355f},
-std::array<float,2>{0.341668487f, 0.970724285f},
-std::array<float,2>{0.731927931f, 0.364387989f},
-std::array<float,2>{0.863889337f, 0.844520986f},
-std::array<float,2>{0.239788562f, 0.485571444f},
-std::array<float,2>{0.432766736f, 0.667800665f},
-std::array<float,2>{0.549532592f, 0.127744973f},
-std::array<float,2>{0.683656156f, 0.569827914f},
-std::array<float,2>{0.302376568f, 0.00166494225f},
-std::array<float,2>{0.0277776569f, 0.900321424f},
-std::array<float,2>{0.968816996f, 0.290790021f},
-std::array<float,2>{0.621716022f, 0.982425749f},
-std::array<float,2>{0.461411327f, 0.370698124f},
-std::array<float,2>{0.140021101f, 0.548782587f},
-std::array<float,2>{0.752009153f, 0.0769707635f},
-std::array<float,2>{0.90364778f, 0.743322968f},
-std::array<float,2>{0.0804951638f, 0.237138912f},
-std::array<float,2>{0.369576752f, 0.798783243f},
-std::array<float,2>{0.697250247f, 0.406241953f},
-std::array<float,2>{0.943284452f, 0.913485408f},
-std::array<float,2>{0.0489392616f, 0.280158103f},
-std::array<float,2>{0.278343141f, 0.605974734f},
-std::array<float,2>{0.626003206f, 0.0330299437f},
-std::array<float,2>{0.529170215f, 0.642958999f},
-std::array<float,2>{0.392115355f, 0.159047499f},
-std::array<float,2>{0.202302694f, 0.84125787f},
-std::array<float,2>{0.825477958f, 0.446535885f},
-std::array<float,2>{0.721799552f, 0.756533504f},
-std::array<float,2>{0.33063978f, 0.413128465f},
-std::array<float,2>{0.116460413f, 0.714460731f},
-std::array<float,2>{0.912264228f, 0.217059329f},
-std::array<float,2>{0.802951396f, 0.512438893f},
-std::array<float,2>{0.183266178f, 0.112081535f},
-std::array<float,2>{0.487277418f, 0.962071061f},
-std::array<float,2>{0.585605621f, 0.315958291f},
-std::array<float,2>{0.936896801f, 0.78229785f},
-std::array<float,2>{0.105284356f, 0.384564549f},
-std::array<float,2>{0.320366263f, 0.723415494f},
-std::array<float,2>{0.748886526f, 0.221074611f},
-std::array<float,2>{0.565776587f, 0.538693905f},
-std::array<float,2>{0.48081556f, 0.0792176276f},
-std::array<float,2>{0.159358025f, 0.986246824f},
-std::array<float,2>{0.791929483f, 0.353120685f},
-std::array<float,2>{0.653137028f, 0.879757881f},
-std::array<float,2>{0.265171111f, 0.305432767f},
-std::array<float,2>{0.0335539021f, 0.586731434f},
-std::array<float,2>{0.953784049f, 0.0252405908f},
-std::array<float,2>{0.8434062f, 0.683745623f},
-std::array<float,2>{0.214209229f, 0.155599922f},
-std::array<float,2>{0.383551806f, 0.861915231f},
-std::array<float,2>{0.507897556f, 0.4688977f},
-std::array<float,2>{0.768865585f, 0.943805695f},
-std::array<float,2>{0.144779786f, 0.331535876f},
-std::array<float,2>{0.445570618f, 0.52333945f},
-std::array<float,2>{0.597909868f, 0.0985637754f},
-std::array<float,2>{0.718129873f, 0.689686954f},
-std::array<float,2>{0.355682492f, 0.200857967f},
-std::array<float,2>{0.0679047033f, 0.769923866f},
-std::array<float,2>{0.875389457f, 0.424196243f},
-std::array<float,2>{0.541537166f, 0.818277776f},
-std::array<float,2>{0.40801695f, 0.463194758f},
-std::array<float,2>{0.22396563f, 0.626465619f},
-std::array<float,2>{0.852002084f, 0.182918012f},
-std::array<float,2>{0.989295483f, 0.620803058f},
-std::array<float,2>{0.00558978505f, 0.0555420816f},
-std::array<float,2>{0.284349561f, 0.922906518f},
-std::array<float,2>{0.66285038f, 0.254340708f},
-std::array<float,2>{0.754908323f, 0.827957153f},
-std::array<float,2>{0.136027575f, 0.453128576f},
-std::array<float,2>{0.467621922f, 0.639443994f},
-std::array<float,2>{0.619694352f, 0.178970918f},
-std::array<float,2>{0.699422359f, 0.615706503f},
-std::array<float,2>{0.374294341f, 0.047359813f},
-std::array<float,2>{0.0843158364f, 0.933210671f},
-std::array<float,2>{0.898863733f, 0.259377986f},
-std::array<float,2>{0.551187813f, 0.946340859f},
-std::array<float,2>{0.435337454f, 0.338782698f},
-std::array<float,2>{0.235499039f, 0.529346883f},
-std::array<float,2>{0.862349689f, 0.101583198f},
-std::array<float,2>{0.974312544f, 0.701200604f},
-std::array<float,2>{0.0266761165f, 0.191579953f},
-std::array<float,2>{0.300104201f, 0.775287151f},
-std::array<float,2>{0.683566034f, 0.435044527f},
-std::array<float,2>{0.907350183f, 0.884917974f},
-std::array<float,2>{0.113033704f, 0.299601465f},
-std::array<float,2>{0.333698362f, 0.579386353f},
-std::array<float,2>{0.723215878f, 0.0194260776f},
-std::array<float,2>{0.581779242f, 0.675053358f},
-std::array<float,2>{0.489913374f, 0.143245906f},
-std::array<float,2>{0.186819553f, 0.870906115f},
-std::array<float,2>{0.79804492f, 0.479457527f},
-std::array<float,2>{0.629474819f, 0.795023501f},
-std::array<float,2>{0.275252104f, 0.375215143f},
-std::array<float,2>{0.0521184579f, 0.730979562f},
-std::array<float,2>{0.940781772f, 0.232942641f},
-std::array<float,2>{0.823748767f, 0.540249884f},
-std::array<float,2>{0.198013246f, 0.0925592706f},
-std::array<float,2>{0.39631024f, 0.99871552f},
-std::array<float,2>{0.524825513f, 0.346502155f},
-std::array<float,2>{0.960839748f, 0.765046477f},
-std::array<float,2>{0.0356182307f, 0.415307313f},
-std::array<float,2>{0.260798991f, 0.710306466f},
-std::array<float,2>{0.650829256f, 0.209321752f},
-std::array<float,2>{0.512241006f, 0.505877078f},
-std::array<float,2>{0.38782391f, 0.122186705f},
-std::array<float,2>{0.217445061f, 0.959639072f},
-std::array<float,2>{0.838320911f, 0.321890146f},
-std::array<float,2>{0.743677437f, 0.921874344f},
-std::array<float,2>{0.325874269f, 0.2686764f},
-std::array<float,2>{0.107258767f, 0.595854402f},
-std::array<float,2>{0.931874514f, 0.042888321f},
-std::array<float,2>{0.794394672f, 0.64913553f},
-std::array<float,2>{0.161252365f, 0.164391249f},
-std::array<float,2>{0.477952123f, 0.829056382f},
-std::array<float,2>{0.569290936f, 0.438010633f},
-std::array<float,2>{0.858218908f, 0.973484576f},
-std::array<float,2>{0.221959874f, 0.362495631f},
-std::array<float,2>{0.412369877f, 0.557395101f},
-std::array<float,2>{0.543989718f, 0.0680052042f},
-std::array<float,2>{0.659135997f, 0.734876335f},
-std::array<float,2>{0.287220865f, 0.249932304f},
-std::array<float,2>{0.000615392986f, 0.807333887f},
-std::array<float,2>{0.986742437f, 0.395374119f},
-std::array<float,2>{0.595454872f, 0.856025457f},
-std::array<float,2>{0.452505589f, 0.49546653f},
-std::array<float,2>{0.144370377f, 0.659064412f},
-std::array<float,2>{0.771921337f, 0.136155874f},
-std::array<float,2>{0.881385744f, 0.57298696f},
-std::array<float,2>{0.0638296381f, 0.00790913124f},
-std::array<float,2>{0.354531556f, 0.892006457f},
-std::array<float,2>{0.711519539f, 0.28586638f},
-std::array<float,2>{0.829080582f, 0.801359475f},
-std::array<float,2>{0.208425269f, 0.401660949f},
-std::array<float,2>{0.379133195f, 0.749470651f},
-std::array<float,2>{0.504167676f, 0.238916367f},
-std::array<float,2>{0.642099142f, 0.550787807f},
-std::array<float,2>{0.251539141f, 0.0705915093f},
-std::array<float,2>{0.0414757654f, 0.980236769f},
-std::array<float,2>{0.96363771f, 0.371689647f},
-std::array<float,2>{0.573362947f, 0.904625773f},
-std::array<float,2>{0.473947823f, 0.294136792f},
-std::array<float,2>{0.169485241f, 0.565065801f},
-std::array<float,2>{0.784176409f, 0.00761979818f},
-std::array<float,2>{0.924648166f, 0.671405315f},
-std::array<float,2>{0.10152851f, 0.130805373f},
-std::array<float,2>{0.318423808f, 0.850920618f},
-std::array<float,2>{0.73549515f, 0.48903808f},
-std::array<float,2>{0.997544408f, 0.966726959f},
-std::array<float,2>{0.00999489799f, 0.320294321f},
-std::array<float,2>{0.294015914f, 0.508711338f},
-std::array<float,2>{0.668094039f, 0.116652057f},
-std::array<float,2>{0.5380072f, 0.71596688f},
-std::array<float,2>{0.421681374f, 0.211199135f},
-std::array<float,2>{0.233075947f, 0.751499116f},
-std::array<float,2>{0.8477422f, 0.407049835f},
-std::array<float,2>{0.708960354f, 0.836672425f},
-std::array<float,2>{0.344768822f, 0.449345797f},
-std::array<float,2>{0.0747412816f, 0.647148013f},
-std::array<float,2>{0.887489557f, 0.160385668f},
-std::array<float,2>{0.776327848f, 0.603286505f},
-std::array<float,2>{0.148499548f, 0.0382261761f},
-std::array<float,2>{0.441966385f, 0.907342732f},
-std::array<float,2>{0.608108401f, 0.275538236f},
-std::array<float,2>{0.897003472f, 0.863833189f},
-std::array<float,2>{0.0935086384f, 0.47425431f},
-std::array<float,2>{0.365861624f, 0.682674766f},
-std::array<float,2>{0.689255178f, 0.14997378f},
-std::array<float,2>{0.610706568f, 0.593243122f},
-std::array<float,2>{0.453235745f, 0.0304835811f},
-std::array<float,2>{0.126301721f, 0.875991762f},
-std::array<float,2>{0.758945525f, 0.309677422f},
-std::array<float,2>{0.679027498f, 0.990372539f},
-std::array<float,2>{0.307347745f, 0.358363748f},
-std::array<float,2>{0.0228774827f, 0.535152674f},
-std::array<float,2>{0.978943706f, 0.082038179f},
-std::array<float,2>{0.872451901f, 0.722190917f},
-std::array<float,2>{0.249881953f, 0.225970089f},
-std::array<float,2>{0.428647548f, 0.787290454f},
-std::array<float,2>{0.555721521f, 0.390217453f},
-std::array<float,2>{0.80899632f, 0.929645658f},
-std::array<float,2>{0.172792509f, 0.250107884f},
-std::array<float,2>{0.493780941f, 0.623981416f},
-std::array<float,2>{0.586642623f, 0.0612450205f},
-std::array<float,2>{0.729173958f, 0.631107271f},
-std::array<float,2>{0.336031854f, 0.185108304f},
-std::array<float,2>{0.120437086f, 0.816192389f},
-std::array<float,2>{0.919277608f, 0.46548599f},
-std::array<float,2>{0.519104362f, 0.767730713f},
-std::array<float,2>{0.401005477f, 0.427321464f},
-std::array<float,2>{0.188642696f, 0.693008721f},
-std::array<float,2>{0.816611111f, 0.197153315f},
-std::array<float,2>{0.946983576f, 0.518283308f},
-std::array<float,2>{0.056001056f, 0.097199358f},
-std::array<float,2>{0.268645823f, 0.938115656f},
-std::array<float,2>{0.636973381f, 0.333253473f},
-std::array<float,2>{0.763041973f, 0.758203983f},
-std::array<float,2>{0.131237552f, 0.421317518f},
-std::array<float,2>{0.460798055f, 0.705122709f},
-std::array<float,2>{0.615845263f, 0.203306571f},
-std::array<float,2>{0.694511652f, 0.50070411f},
-std::array<float,2>{0.359919965f, 0.120072119f},
-std::array<float,2>{0.0877353251f, 0.956714034f},
-std::array<float,2>{0.893227994f, 0.325596452f},
-std::array<float,2>{0.560882926f, 0.915822804f},
-std::array<float,2>{0.423065662f, 0.272435009f},
-std::array<float,2>{0.242543101f, 0.601145267f},
-std::array<float,2>{0.869937479f, 0.0459004529f},
-std::array<float,2>{0.982582808f, 0.655419588f},
-std::array<float,2>{0.0162000544f, 0.170974165f},
-std::array<float,2>{0.311080515f, 0.834306836f},
-std::array<float,2>{0.6753304f, 0.444893062f},
-std::array<float,2>{0.914881885f, 0.971815705f},
-std::array<float,2>{0.124645405f, 0.363954604f},
-std::array<float,2>{0.343389094f, 0.559479356f},
-std::array<float,2>{0.732890606f, 0.066386655f},
-std::array<float,2>{0.590402246f, 0.741640329f},
-std::array<float,2>{0.497180372f, 0.24567835f},
-std::array<float,2>{0.176400751f, 0.812238336f},
-std::array<float,2>{0.806359947f, 0.394036055f},
-std::array<float,2>{0.633514822f, 0.854630709f},
-std::array<float,2>{0.271479696f, 0.49783653f},
-std::array<float,2>{0.0618196391f, 0.663309395f},
-std::array<float,2>{0.951804101f, 0.138712481f},
-std::array<float,2>{0.815994918f, 0.574552298f},
-std::array<float,2>{0.193377197f, 0.0147314873f},
-std::array<float,2>{0.405597985f, 0.89640677f},
-std::array<float,2>{0.522270977f, 0.28249523f},
-std::array<float,2>{0.966623843f, 0.822604239f},
-std::array<float,2>{0.0452617295f, 0.457085639f},
-std::array<float,2>{0.254522115f, 0.634570479f},
-std::array<float,2>{0.648284674f, 0.174905509f},
-std::array<float,2>{0.50182426f, 0.610951483f},
-std::array<float,2>{0.375639766f, 0.0528715514f},
-std::array<float,2>{0.205783263f, 0.934675395f},
-std::array<float,2>{0.835629165f, 0.262640864f},
-std::array<float,2>{0.738336563f, 0.950584888f},
-std::array<float,2>{0.315316081f, 0.342850268f},
-std::array<float,2>{0.0968423411f, 0.526631951f},
-std::array<float,2>{0.928593397f, 0.107474968f},
-std::array<float,2>{0.7880283f, 0.697171986f},
-std::array<float,2>{0.167560667f, 0.19084397f},
-std::array<float,2>{0.470159292f, 0.777854919f},
-std::array<float,2>{0.576642871f, 0.43282184f},
-std::array<float,2>{0.844349921f, 0.889686882f},
-std::array<float,2>{0.228096485f, 0.303392082f},
-std::array<float,2>{0.415633053f, 0.583498359f},
-std::array<float,2>{0.533479095f, 0.0211126674f},
-std::array<float,2>{0.664157808f, 0.678611338f},
-std::array<float,2>{0.292005867f, 0.147347122f},
-std::array<float,2>{0.0126367277f, 0.871731877f},
-std::array<float,2>{0.993631899f, 0.483976185f},
-std::array<float,2>{0.60340476f, 0.790135622f},
-std::array<float,2>{0.439200073f, 0.380138934f},
-std::array<float,2>{0.153686285f, 0.728844523f},
-std::array<float,2>{0.780114532f, 0.228992283f},
-std::array<float,2>{0.88566339f, 0.545033216f},
-std::array<float,2>{0.0741219521f, 0.0890224576f},
-std::array<float,2>{0.351551384f, 0.994813144f},
-std::array<float,2>{0.704875708f, 0.347843289f},
-std::array<float,2>{0.840527952f, 0.86299336f},
-std::array<float,2>{0.212506875f, 0.470440507f},
-std::array<float,2>{0.385678738f, 0.685394287f},
-std::array<float,2>{0.511294782f, 0.154409677f},
-std::array<float,2>{0.656094372f, 0.58741343f},
-std::array<float,2>{0.262066483f, 0.0234701093f},
-std::array<float,2>{0.0319592096f, 0.880299211f},
-std::array<float,2>{0.956991255f, 0.30659914f},
-std::array<float,2>{0.562595665f, 0.984561265f},
-std::array<float,2>{0.482863545f, 0.352139831f},
-std::array<float,2>{0.157468036f, 0.53768903f},
-std::array<float,2>{0.789186001f, 0.0782618672f},
-std::array<float,2>{0.934565067f, 0.724356711f},
-std::array<float,2>{0.102986015f, 0.222253233f},
-std::array<float,2>{0.3229945f, 0.781986892f},
-std::array<float,2>{0.747047901f, 0.383151948f},
-std::array<float,2>{0.991931081f, 0.922699332f},
-std::array<float,2>{0.0073831412f, 0.255208492f},
-std::array<float,2>{0.282384843f, 0.619956374f},
-std::array<float,2>{0.661411703f, 0.0563073158f},
-std::array<float,2>{0.540769398f, 0.625191212f},
-std::array<float,2>{0.408962041f, 0.182223663f},
-std::array<float,2>{0.225293338f, 0.816827178f},
-std::array<float,2>{0.853904665f, 0.464598119f},
-std::array<float,2>{0.715227902f, 0.77066642f},
-std::array<float,2>{0.357483894f, 0.425698817f},
-std::array<float,2>{0.069037199f, 0.691005349f},
-std::array<float,2>{0.878104568f, 0.200006515f},
-std::array<float,2>{0.766168535f, 0.521850288f},
-std::array<float,2>{0.148216069f, 0.0995178744f},
-std::array<float,2>{0.448530078f, 0.944691002f},
-std::array<float,2>{0.60155201f, 0.330532372f},
-std::array<float,2>{0.905806601f, 0.79756397f},
-std::array<float,2>{0.0785503015f, 0.40503329f},
-std::array<float,2>{0.368006617f, 0.742538273f},
-std::array<float,2>{0.697791398f, 0.237849265f},
-std::array<float,2>{0.623685181f, 0.54710865f},
-std::array<float,2>{0.463828027f, 0.0772784278f},
-std::array<float,2>{0.138623223f, 0.984194994f},
-std::array<float,2>{0.750484109f, 0.369456589f},
-std::array<float,2>{0.686966836f, 0.899085164f},
-std::array<float,2>{0.302958012f, 0.28922224f},
-std::array<float,2>{0.0311288834f, 0.569185793f},
-std::array<float,2>{0.972575724f, 0.000397574564f},
-std::array<float,2>{0.866059959f, 0.666675866f},
-std::array<float,2>{0.241204992f, 0.128370211f},
-std::array<float,2>{0.430481762f, 0.845222294f},
-std::array<float,2>{0.547035873f, 0.484781533f},
-std::array<float,2>{0.801162601f, 0.961788297f},
-std::array<float,2>{0.18080081f, 0.31468147f},
-std::array<float,2>{0.485229462f, 0.512755573f},
-std::array<float,2>{0.583944738f, 0.112881079f},
-std::array<float,2>{0.718886971f, 0.712956667f},
-std::array<float,2>{0.328638315f, 0.218097761f},
-std::array<float,2>{0.114291042f, 0.756981909f},
-std::array<float,2>{0.911720634f, 0.412920654f},
-std::array<float,2>{0.530103207f, 0.83991009f},
-std::array<float,2>{0.393922687f, 0.445961416f},
-std::array<float,2>{0.199607044f, 0.644030213f},
-std::array<float,2>{0.827239871f, 0.159444019f},
-std::array<float,2>{0.945065141f, 0.607355952f},
-std::array<float,2>{0.048519738f, 0.03191901f},
-std::array<float,2>{0.280232847f, 0.912981987f},
-std::array<float,2>{0.628856182f, 0.281208754f},
-std::array<float,2>{0.796615541f, 0.829941154f},
-std::array<float,2>{0.162783012f, 0.438994646f},
-std::array<float,2>{0.47893548f, 0.650130332f},
-std::array<float,2>{0.567176223f, 0.165223047f},
-std::array<float,2>{0.744520128f, 0.596941173f},
-std::array<float,2>{0.326568574f, 0.0415339284f},
-std::array<float,2>{0.10788282f, 0.920439959f},
-std::array<float,2>{0.930338562f, 0.268412024f},
-std::array<float,2>{0.515205085f, 0.960777998f},
-std::array<float,2>{0.389900416f, 0.321089596f},
-std::array<float,2>{0.215983376f, 0.507387936f},
-std::array<float,2>{0.836442709f, 0.121405698f},
-std::array<float,2>{0.958016932f, 0.709055543f},
-std::array<float,2>{0.0375399329f, 0.210862175f},
-std::array<float,2>{0.257914364f, 0.764067352f},
-std::array<float,2>{0.648594379f, 0.414557457f},
-std::array<float,2>{0.880269349f, 0.891046524f},
-std::array<float,2>{0.064533323f, 0.286584586f},
-std::array<float,2>{0.352054775f, 0.574005425f},
-std::array<float,2>{0.714360535f, 0.00958780106f},
-std::array<float,2>{0.597446561f, 0.659598827f},
-std::array<float,2>{0.450071514f, 0.135033369f},
-std::array<float,2>{0.141192421f, 0.856658757f},
-std::array<float,2>{0.770232797f, 0.495093524f},
-std::array<float,2>{0.657293558f, 0.808003902f},
-std::array<float,2>{0.286079437f, 0.396401525f},
-std::array<float,2>{0.0034193811f, 0.736245155f},
-std::array<float,2>{0.984711707f, 0.248677298f},
-std::array<float,2>{0.856788397f, 0.557867408f},
-std::array<float,2>{0.220230043f, 0.067251727f},
-std::array<float,2>{0.410398483f, 0.973981857f},
-std::array<float,2>{0.545189261f, 0.361397684f},
-std::array<float,2>{0.975295305f, 0.773651719f},
-std::array<float,2>{0.0235067066f, 0.433974981f},
-std::array<float,2>{0.297440261f, 0.702398241f},
-std::array<float,2>{0.680294156f, 0.19251588f},
-std::array<float,2>{0.553256154f, 0.53099972f},
-std::array<float,2>{0.435698956f, 0.103014119f},
-std::array<float,2>{0.236890972f, 0.945545614f},
-std::array<float,2>{0.85939157f, 0.339540333f},
-std::array<float,2>{0.701358736f, 0.932053983f},
-std::array<float,2>{0.371587396f, 0.258588344f},
-std::array<float,2>{0.0822746307f, 0.616386652f},
-std::array<float,2>{0.902320147f, 0.0483463667f},
-std::array<float,2>{0.757274687f, 0.640339077f},
-std::array<float,2>{0.133331493f, 0.178318426f},
-std::array<float,2>{0.466086f, 0.826470435f},
-std::array<float,2>{0.617446363f, 0.45430842f},
-std::array<float,2>{0.821066976f, 0.99935174f},
-std::array<float,2>{0.196162134f, 0.346755087f},
-std::array<float,2>{0.397001326f, 0.539603293f},
-std::array<float,2>{0.525398433f, 0.0930837169f},
-std::array<float,2>{0.6319381f, 0.732153416f},
-std::array<float,2>{0.27553457f, 0.234175667f},
-std::array<float,2>{0.0541405119f, 0.796172559f},
-std::array<float,2>{0.939025819f, 0.37612766f},
-std::array<float,2>{0.579370141f, 0.869225323f},
-std::array<float,2>{0.491796643f, 0.480281055f},
-std::array<float,2>{0.185434818f, 0.674188316f},
-std::array<float,2>{0.799348891f, 0.143566787f},
-std::array<float,2>{0.908603668f, 0.578257024f},
-std::array<float,2>{0.111283049f, 0.0180389527f},
-std::array<float,2>{0.334381431f, 0.885977507f},
-std::array<float,2>{0.726289451f, 0.300556988f},
-std::array<float,2>{0.873990297f, 0.788338959f},
-std::array<float,2>{0.246256486f, 0.389039069f},
-std::array<float,2>{0.425805002f, 0.72126478f},
-std::array<float,2>{0.557626247f, 0.22514312f},
-std::array<float,2>{0.677298665f, 0.533396304f},
-std::array<float,2>{0.306274414f, 0.0834721625f},
-std::array<float,2>{0.0198811423f, 0.991881728f},
-std::array<float,2>{0.978420496f, 0.359005898f},
-std::array<float,2>{0.611380816f, 0.875802338f},
-std::array<float,2>{0.45669511f, 0.309254289f},
-std::array<float,2>{0.128375784f, 0.592070937f},
-std::array<float,2>{0.760978162f, 0.0296116285f},
-std::array<float,2>{0.896047175f, 0.682271779f},
-std::array<float,2>{0.0910312906f, 0.148518622f},
-std::array<float,2>{0.364825755f, 0.864555001f},
-std::array<float,2>{0.689896286f, 0.472743839f},
-std::array<float,2>{0.94888407f, 0.939231753f},
-std::array<float,2>{0.0575505011f, 0.332301557f},
-std::array<float,2>{0.266920298f, 0.519377053f},
-std::array<float,2>{0.638741434f, 0.0958226994f},
-std::array<float,2>{0.517401218f, 0.691593766f},
-std::array<float,2>{0.399658531f, 0.196183175f},
-std::array<float,2>{0.189838365f, 0.76945889f},
-std::array<float,2>{0.819559574f, 0.426067591f},
-std::array<float,2>{0.727785289f, 0.815388978f},
-std::array<float,2>{0.338303775f, 0.46625042f},
-std::array<float,2>{0.117957115f, 0.632427275f},
-std::array<float,2>{0.921558142f, 0.183602795f},
-std::array<float,2>{0.811727047f, 0.624791384f},
-std::array<float,2>{0.174658269f, 0.0616418794f},
-std::array<float,2>{0.494844437f, 0.928598225f},
-std::array<float,2>{0.588763118f, 0.251345992f},
-std::array<float,2>{0.923466921f, 0.850575626f},
-std::array<float,2>{0.0977590978f, 0.4896608f},
-std::array<float,2>{0.317095757f, 0.670755625f},
-std::array<float,2>{0.737903833f, 0.129250169f},
-std::array<float,2>{0.571176052f, 0.566101968f},
-std::array<float,2>{0.47513321f, 0.00648538442f},
-std::array<float,2>{0.171182528f, 0.905493557f},
-std::array<float,2>{0.782769263f, 0.293935746f},
-std::array<float,2>{0.643447816f, 0.978922784f},
-std::array<float,2>{0.252466619f, 0.372236758f},
-std::array<float,2>{0.0394825265f, 0.55219239f},
-std::array<float,2>{0.962862551f, 0.0719032064f},
-std::array<float,2>{0.830317616f, 0.748404622f},
-std::array<float,2>{0.210380837f, 0.239844546f},
-std::array<float,2>{0.38222146f, 0.802518487f},
-std::array<float,2>{0.507796943f, 0.400918573f},
-std::array<float,2>{0.774149716f, 0.906997204f},
-std::array<float,2>{0.151622191f, 0.276998222f},
-std::array<float,2>{0.443692386f, 0.601995647f},
-std::array<float,2>{0.606279075f, 0.0377201438f},
-std::array<float,2>{0.71040082f, 0.647704899f},
-std::array<float,2>{0.347289801f, 0.161222875f},
-std::array<float,2>{0.0767997801f, 0.837651312f},
-std::array<float,2>{0.888898551f, 0.450487673f},
-std::array<float,2>{0.536704779f, 0.750336289f},
-std::array<float,2>{0.4194372f, 0.407269776f},
-std::array<float,2>{0.231352001f, 0.715474606f},
-std::array<float,2>{0.849883437f, 0.212064326f},
-std::array<float,2>{0.999816179f, 0.509580314f},
-std::array<float,2>{0.00965580717f, 0.115585506f},
-std::array<float,2>{0.295890987f, 0.965555727f},
-std::array<float,2>{0.671292722f, 0.318989336f},
-std::array<float,2>{0.807895362f, 0.808933318f},
-std::array<float,2>{0.178696081f, 0.391343355f},
-std::array<float,2>{0.499895096f, 0.739520133f},
-std::array<float,2>{0.592270076f, 0.242253572f},
-std::array<float,2>{0.730857134f, 0.562277257f},
-std::array<float,2>{0.339911759f, 0.0638941005f},
-std::array<float,2>{0.122919336f, 0.970039487f},
-std::array<float,2>{0.916254163f, 0.365431607f},
-std::array<float,2>{0.520759404f, 0.898189187f},
-std::array<float,2>{0.402676821f, 0.284086764f},
-std::array<float,2>{0.191608459f, 0.576698899f},
-std::array<float,2>{0.814014256f, 0.0134534482f},
-std::array<float,2>{0.949735284f, 0.660257638f},
-std::array<float,2>{0.0597631671f, 0.137373686f},
-std::array<float,2>{0.272109866f, 0.852095068f},
-std::array<float,2>{0.636694133f, 0.499568909f},
-std::array<float,2>{0.891354084f, 0.953534782f},
-std::array<float,2>{0.0893990546f, 0.327206284f},
-std::array<float,2>{0.361812145f, 0.503135264f},
-std::array<float,2>{0.693021059f, 0.11780832f},
-std::array<float,2>{0.614463389f, 0.703561902f},
-std::array<float,2>{0.457726568f, 0.206656009f},
-std::array<float,2>{0.129102916f, 0.760655224f},
-std::array<float,2>{0.764862061f, 0.418238401f},
-std::array<float,2>{0.672358334f, 0.833150268f},
-std::array<float,2>{0.309117794f, 0.442817599f},
-std::array<float,2>{0.0193821602f, 0.652626812f},
-std::array<float,2>{0.981797755f, 0.169900432f},
-std::array<float,2>{0.869092703f, 0.597734988f},
-std::array<float,2>{0.245535135f, 0.0433121696f},
-std::array<float,2>{0.42459783f, 0.917281628f},
-std::array<float,2>{0.558900833f, 0.271330565f},
-std::array<float,2>{0.99526459f, 0.873710871f},
-std::array<float,2>{0.0146855908f, 0.481243789f},
-std::array<float,2>{0.290080398f, 0.677414894f},
-std::array<float,2>{0.666983604f, 0.14546825f},
-std::array<float,2>{0.532592416f, 0.584468007f},
-std::array<float,2>{0.417562872f, 0.0215760246f},
-std::array<float,2>{0.228611588f, 0.888571322f},
-std::array<float,2>{0.845767081f, 0.301354319f},
-std::array<float,2>{0.706424177f, 0.993434489f},
-std::array<float,2>{0.349586248f, 0.351529539f},
-std::array<float,2>{0.0709795877f, 0.543245137f},
-std::array<float,2>{0.883406699f, 0.0861745924f},
-std::array<float,2>{0.77783829f, 0.727871001f},
-std::array<float,2>{0.154880151f, 0.227951512f},
-std::array<float,2>{0.441029847f, 0.792058766f},
-std::array<float,2>{0.604849041f, 0.381697088f},
-std::array<float,2>{0.832721591f, 0.93714869f},
-std::array<float,2>{0.203847706f, 0.265407354f},
-std::array<float,2>{0.378256947f, 0.611568868f},
-std::array<float,2>{0.503270209f, 0.0510863923f},
-std::array<float,2>{0.64497602f, 0.635591924f},
-std::array<float,2>{0.25718832f, 0.17336078f},
-std::array<float,2>{0.0437279679f, 0.820874512f},
-std::array<float,2>{0.967750192f, 0.459304333f},
-std::array<float,2>{0.576133788f, 0.78093785f},
-std::array<float,2>{0.471370339f, 0.430243701f},
-std::array<float,2>{0.164877579f, 0.698943257f},
-std::array<float,2>{0.785851717f, 0.188537285f},
-std::array<float,2>{0.927396536f, 0.524178863f},
-std::array<float,2>{0.0954381898f, 0.105582811f},
-std::array<float,2>{0.313919514f, 0.951982617f},
-std::array<float,2>{0.74039042f, 0.341354132f},
-std::array<float,2>{0.852749705f, 0.820036471f},
-std::array<float,2>{0.223301485f, 0.461966813f},
-std::array<float,2>{0.406465888f, 0.62890476f},
-std::array<float,2>{0.542625844f, 0.180960357f},
-std::array<float,2>{0.663550198f, 0.618921161f},
-std::array<float,2>{0.284139007f, 0.0585689135f},
-std::array<float,2>{0.00400171429f, 0.925490499f},
-std::array<float,2>{0.988478959f, 0.255878001f},
-std::array<float,2>{0.599590361f, 0.942704618f},
-std::array<float,2>{0.446632296f, 0.329497784f},
-std::array<float,2>{0.146251187f, 0.521216869f},
-std::array<float,2>{0.768305779f, 0.101296976f},
-std::array<float,2>{0.876743317f, 0.688484073f},
-std::array<float,2>{0.0664519221f, 0.202771097f},
-std::array<float,2>{0.356811404f, 0.772986889f},
-std::array<float,2>{0.717605352f, 0.42272532f},
-std::array<float,2>{0.954672456f, 0.881483257f},
-std::array<float,2>{0.0349985287f, 0.306670666f},
-std::array<float,2>{0.264185458f, 0.589338362f},
-std::array<float,2>{0.653710365f, 0.0261927173f},
-std::array<float,2>{0.509369433f, 0.687159479f},
-std::array<float,2>{0.384000599f, 0.152542904f},
-std::array<float,2>{0.213485509f, 0.861129403f},
-std::array<float,2>{0.841810644f, 0.472520977f},
-std::array<float,2>{0.749082804f, 0.783819437f},
-std::array<float,2>{0.322229624f, 0.386384428f},
-std::array<float,2>{0.103930771f, 0.725858688f},
-std::array<float,2>{0.935864866f, 0.219910085f},
-std::array<float,2>{0.792757213f, 0.536316335f},
-std::array<float,2>{0.159065202f, 0.0811702609f},
-std::array<float,2>{0.481763095f, 0.987779856f},
-std::array<float,2>{0.564500332f, 0.355025262f},
-std::array<float,2>{0.913513243f, 0.75512749f},
-std::array<float,2>{0.115636326f, 0.411427438f},
-std::array<float,2>{0.331258088f, 0.712655425f},
-std::array<float,2>{0.720779896f, 0.214954823f},
-std::array<float,2>{0.584214389f, 0.515169382f},
-std::array<float,2>{0.48797974f, 0.110436365f},
-std::array<float,2>{0.18225874f, 0.964401603f},
-std::array<float,2>{0.804644406f, 0.313958585f},
-std::array<float,2>{0.625208616f, 0.911994815f},
-std::array<float,2>{0.27781108f, 0.279232919f},
-std::array<float,2>{0.0498371422f, 0.608132899f},
-std::array<float,2>{0.942349136f, 0.0333979204f},
-std::array<float,2>{0.824671328f, 0.640628815f},
-std::array<float,2>{0.201818392f, 0.156968251f},
-std::array<float,2>{0.390630782f, 0.843306601f},
-std::array<float,2>{0.527689159f, 0.448192358f},
-std::array<float,2>{0.753782094f, 0.981029212f},
-std::array<float,2>{0.138874799f, 0.367491722f},
-std::array<float,2>{0.462416261f, 0.549775362f},
-std::array<float,2>{0.622839451f, 0.0760730878f},
-std::array<float,2>{0.695985615f, 0.745770872f},
-std::array<float,2>{0.37020418f, 0.235611111f},
-std::array<float,2>{0.0811933428f, 0.800645113f},
-std::array<float,2>{0.903077662f, 0.404290885f},
-std::array<float,2>{0.550116837f, 0.846036553f},
-std::array<float,2>{0.432023138f, 0.487947106f},
-std::array<float,2>{0.238647923f, 0.664972663f},
-std::array<float,2>{0.864968359f, 0.125768974f},
-std::array<float,2>{0.969956756f, 0.568272531f},
-std::array<float,2>{0.0285045262f, 0.00201526424f},
-std::array<float,2>{0.30174461f, 0.901573479f},
-std::array<float,2>{0.685189843f, 0.292089462f},
-std::array<float,2>{0.77265197f, 0.858175218f},
-std::array<float,2>{0.143126607f, 0.493683845f},
-std::array<float,2>{0.451315105f, 0.656690598f},
-std::array<float,2>{0.594015002f, 0.133737162f},
-std::array<float,2>{0.712079942f, 0.570665717f},
-std::array<float,2>{0.354442418f, 0.0112206666f},
-std::array<float,2>{0.0626362488f, 0.894019246f},
-std::array<float,2>{0.882140279f, 0.287199974f},
-std::array<float,2>{0.54341203f, 0.97528559f},
-std::array<float,2>{0.41334933f, 0.361315042f},
-std::array<float,2>{0.221134409f, 0.555177391f},
-std::array<float,2>{0.858398795f, 0.068709664f},
-std::array<float,2>{0.987323463f, 0.73814702f},
-std::array<float,2>{0.00166173361f, 0.247463271f},
-std::array<float,2>{0.288844705f, 0.806146085f},
-std::array<float,2>{0.659632862f, 0.397633553f},
-std::array<float,2>{0.933536291f, 0.919169843f},
-std::array<float,2>{0.105571933f, 0.2664074f},
-std::array<float,2>{0.324754626f, 0.594587028f},
-std::array<float,2>{0.743062496f, 0.039637208f},
-std::array<float,2>{0.56976676f, 0.650919795f},
-std::array<float,2>{0.477308691f, 0.166549414f},
-std::array<float,2>{0.160892293f, 0.830538034f},
-std::array<float,2>{0.793650508f, 0.44114995f},
-std::array<float,2>{0.652112603f, 0.761936903f},
-std::array<float,2>{0.260504842f, 0.417481065f},
-std::array<float,2>{0.036511939f, 0.707566917f},
-std::array<float,2>{0.959237397f, 0.208666697f},
-std::array<float,2>{0.839555562f, 0.504841626f},
-std::array<float,2>{0.217957512f, 0.123466499f},
-std::array<float,2>{0.387205958f, 0.957515359f},
-std::array<float,2>{0.513246775f, 0.322459936f},
-std::array<float,2>{0.939562738f, 0.793398678f},
-std::array<float,2>{0.0507815741f, 0.377371103f},
-std::array<float,2>{0.273858249f, 0.732655287f},
-std::array<float,2>{0.630620062f, 0.231623247f},
-std::array<float,2>{0.524362504f, 0.542744458f},
-std::array<float,2>{0.395505339f, 0.0912455767f},
-std::array<float,2>{0.198973432f, 0.997296393f},
-std::array<float,2>{0.822718561f, 0.344436049f},
-std::array<float,2>{0.723829746f, 0.884004533f},
-std::array<float,2>{0.332394302f, 0.298749775f},
-std::array<float,2>{0.11227946f, 0.581580758f},
-std::array<float,2>{0.907043159f, 0.0168462358f},
-std::array<float,2>{0.797349691f, 0.672399879f},
-std::array<float,2>{0.185657173f, 0.14143005f},
-std::array<float,2>{0.488396764f, 0.868669629f},
-std::array<float,2>{0.580638051f, 0.477702379f},
-std::array<float,2>{0.86135149f, 0.949166059f},
-std::array<float,2>{0.234818444f, 0.336275786f},
-std::array<float,2>{0.433988333f, 0.528776348f},
-std::array<float,2>{0.552344859f, 0.104325421f},
-std::array<float,2>{0.682046056f, 0.699582756f},
-std::array<float,2>{0.299608678f, 0.193577245f},
-std::array<float,2>{0.0257748868f, 0.776696622f},
-std::array<float,2>{0.972679138f, 0.435664952f},
-std::array<float,2>{0.62039119f, 0.825566828f},
-std::array<float,2>{0.468094409f, 0.455905735f},
-std::array<float,2>{0.134779841f, 0.637161732f},
-std::array<float,2>{0.754070818f, 0.17605114f},
-std::array<float,2>{0.899586558f, 0.613501668f},
-std::array<float,2>{0.0851508155f, 0.0507112816f},
-std::array<float,2>{0.373923451f, 0.931263924f},
-std::array<float,2>{0.700886846f, 0.260446817f},
-std::array<float,2>{0.817906022f, 0.766361237f},
-std::array<float,2>{0.187811062f, 0.429466099f},
-std::array<float,2>{0.402001977f, 0.69422847f},
-std::array<float,2>{0.518041909f, 0.197763696f},
-std::array<float,2>{0.638323486f, 0.515799344f},
-std::array<float,2>{0.268134177f, 0.0946527347f},
-std::array<float,2>{0.0552240014f, 0.940214574f},
-std::array<float,2>{0.946237326f, 0.335039437f},
-std::array<float,2>{0.587492645f, 0.926753402f},
-std::array<float,2>{0.492445409f, 0.252788633f},
-std::array<float,2>{0.173174545f, 0.621301293f},
-std::array<float,2>{0.810224891f, 0.0587226078f},
-std::array<float,2>{0.918630123f, 0.629663825f},
-std::array<float,2>{0.119754702f, 0.186011925f},
-std::array<float,2>{0.337320685f, 0.813962936f},
-std::array<float,2>{0.729850471f, 0.467281342f},
-std::array<float,2>{0.979541957f, 0.989352584f},
-std::array<float,2>{0.0221713185f, 0.356582373f},
-std::array<float,2>{0.307639211f, 0.533045948f},
-std::array<float,2>{0.678602099f, 0.0857837871f},
-std::array<float,2>{0.555403769f, 0.718810499f},
-std::array<float,2>{0.429483116f, 0.222727537f},
-std::array<float,2>{0.248366922f, 0.785558164f},
-std::array<float,2>{0.871207178f, 0.387003213f},
-std::array<float,2>{0.68840611f, 0.866451383f},
-std::array<float,2>{0.366677552f, 0.474780977f},
-std::array<float,2>{0.0925839022f, 0.680310726f},
-std::array<float,2>{0.897512197f, 0.151951417f},
-std::array<float,2>{0.758368373f, 0.591103375f},
-std::array<float,2>{0.12582998f, 0.0286175627f},
-std::array<float,2>{0.454130471f, 0.877618194f},
-std::array<float,2>{0.610091031f, 0.310976237f},
-std::array<float,2>{0.888354361f, 0.838969052f},
-std::array<float,2>{0.075664863f, 0.451203465f},
-std::array<float,2>{0.344203532f, 0.646268606f},
-std::array<float,2>{0.70747745f, 0.162577555f},
-std::array<float,2>{0.609339356f, 0.605228305f},
-std::array<float,2>{0.442658395f, 0.0354008488f},
-std::array<float,2>{0.150068253f, 0.909224153f},
-std::array<float,2>{0.777319074f, 0.274446249f},
-std::array<float,2>{0.669858277f, 0.968523502f},
-std::array<float,2>{0.293488741f, 0.317414939f},
-std::array<float,2>{0.011385601f, 0.509933949f},
-std::array<float,2>{0.996344149f, 0.114815667f},
-std::array<float,2>{0.849501669f, 0.718633294f},
-std::array<float,2>{0.234015375f, 0.214277655f},
-std::array<float,2>{0.42063123f, 0.752992213f},
-std::array<float,2>{0.538789272f, 0.408716232f},
-std::array<float,2>{0.784273326f, 0.903123975f},
-std::array<float,2>{0.168777093f, 0.296462178f},
-std::array<float,2>{0.473405749f, 0.563441336f},
-std::array<float,2>{0.572922945f, 0.00487948628f},
-std::array<float,2>{0.7351318f, 0.66849041f},
-std::array<float,2>{0.319589555f, 0.132115692f},
-std::array<float,2>{0.0999676958f, 0.848205388f},
-std::array<float,2>{0.925691009f, 0.491981953f},
-std::array<float,2>{0.505042374f, 0.804036915f},
-std::array<float,2>{0.380675644f, 0.400180548f},
-std::array<float,2>{0.207755446f, 0.746896565f},
-std::array<float,2>{0.829249203f, 0.241702303f},
-std::array<float,2>{0.964409769f, 0.553471029f},
-std::array<float,2>{0.0425909124f, 0.0741492584f},
-std::array<float,2>{0.250824571f, 0.97740519f},
-std::array<float,2>{0.641392291f, 0.373174638f},
-std::array<float,2>{0.771406054f, 0.805822611f},
-std::array<float,2>{0.141787618f, 0.39791131f},
-std::array<float,2>{0.450590253f, 0.737793148f},
-std::array<float,2>{0.596181214f, 0.247139052f},
-std::array<float,2>{0.713038802f, 0.555458367f},
-std::array<float,2>{0.352678329f, 0.0685436949f},
-std::array<float,2>{0.0655085593f, 0.975534618f},
-std::array<float,2>{0.879601777f, 0.361022741f},
-std::array<float,2>{0.546309888f, 0.893579423f},
-std::array<float,2>{0.411821008f, 0.287487805f},
-std::array<float,2>{0.219060197f, 0.570554197f},
-std::array<float,2>{0.85551852f, 0.0107511897f},
-std::array<float,2>{0.98579222f, 0.65645647f},
-std::array<float,2>{0.0019752935f, 0.133440316f},
-std::array<float,2>{0.287014306f, 0.857949972f},
-std::array<float,2>{0.657081902f, 0.493939728f},
-std::array<float,2>{0.931381881f, 0.957090974f},
-std::array<float,2>{0.10863927f, 0.322727978f},
-std::array<float,2>{0.327248603f, 0.504564404f},
-std::array<float,2>{0.745329678f, 0.123060167f},
-std::array<float,2>{0.56816107f, 0.707998216f},
-std::array<float,2>{0.480439156f, 0.208982423f},
-std::array<float,2>{0.163788065f, 0.762187064f},
-std::array<float,2>{0.795214534f, 0.417958081f},
-std::array<float,2>{0.649755776f, 0.830314875f},
-std::array<float,2>{0.259654909f, 0.441304743f},
-std::array<float,2>{0.0386281386f, 0.651344478f},
-std::array<float,2>{0.957709432f, 0.166811258f},
-std::array<float,2>{0.837211013f, 0.594477713f},
-std::array<float,2>{0.215788335f, 0.0398293287f},
-std::array<float,2>{0.388980687f, 0.919286788f},
-std::array<float,2>{0.513699412f, 0.266138792f},
-std::array<float,2>{0.93757689f, 0.86905849f},
-std::array<float,2>{0.0528855063f, 0.477825284f},
-std::array<float,2>{0.276810914f, 0.672633529f},
-std::array<float,2>{0.631556869f, 0.141265333f},
-std::array<float,2>{0.526921153f, 0.582018971f},
-std::array<float,2>{0.397617787f, 0.0166975372f},
-std::array<float,2>{0.197000727f, 0.884043872f},
-std::array<float,2>{0.821881711f, 0.298358858f},
-std::array<float,2>{0.724902987f, 0.997460306f},
-std::array<float,2>{0.334976614f, 0.344620705f},
-std::array<float,2>{0.109520569f, 0.542570591f},
-std::array<float,2>{0.909627855f, 0.0908402279f},
-std::array<float,2>{0.80024153f, 0.732814848f},
-std::array<float,2>{0.184353232f, 0.231768668f},
-std::array<float,2>{0.490436286f, 0.793111503f},
-std::array<float,2>{0.578542888f, 0.376961082f},
-std::array<float,2>{0.860895634f, 0.931454957f},
-std::array<float,2>{0.237305269f, 0.260619909f},
-std::array<float,2>{0.436885506f, 0.613545179f},
-std::array<float,2>{0.554278433f, 0.0503390096f},
-std::array<float,2>{0.680781543f, 0.63675946f},
-std::array<float,2>{0.297873944f, 0.175945923f},
-std::array<float,2>{0.0247196089f, 0.825344443f},
-std::array<float,2>{0.975901484f, 0.455716312f},
-std::array<float,2>{0.618183494f, 0.7764709f},
-std::array<float,2>{0.465373278f, 0.435967505f},
-std::array<float,2>{0.134373069f, 0.699370861f},
-std::array<float,2>{0.756795824f, 0.193689108f},
-std::array<float,2>{0.900791347f, 0.528337836f},
-std::array<float,2>{0.0838618726f, 0.104026139f},
-std::array<float,2>{0.372924864f, 0.948805809f},
-std::array<float,2>{0.702997625f, 0.336038351f},
-std::array<float,2>{0.818992674f, 0.813525438f},
-std::array<float,2>{0.190821871f, 0.466944963f},
-std::array<float,2>{0.399013251f, 0.629489779f},
-std::array<float,2>{0.515656173f, 0.185717329f},
-std::array<float,2>{0.639832854f, 0.62157768f},
-std::array<float,2>{0.265825272f, 0.0589655712f},
-std::array<float,2>{0.0581245646f, 0.926297128f},
-std::array<float,2>{0.9475196f, 0.252589345f},
-std::array<float,2>{0.588998199f, 0.939945817f},
-std::array<float,2>{0.495532691f, 0.335216761f},
-std::array<float,2>{0.175697356f, 0.515930891f},
-std::array<float,2>{0.811060071f, 0.0944025815f},
-std::array<float,2>{0.920554698f, 0.693894982f},
-std::array<float,2>{0.118300118f, 0.198042229f},
-std::array<float,2>{0.339700133f, 0.766333699f},
-std::array<float,2>{0.726615787f, 0.429284692f},
-std::array<float,2>{0.977121055f, 0.877781034f},
-std::array<float,2>{0.0207506269f, 0.31072405f},
-std::array<float,2>{0.305304617f, 0.590999603f},
-std::array<float,2>{0.67614013f, 0.0284956917f},
-std::array<float,2>{0.557607234f, 0.680573046f},
-std::array<float,2>{0.426931322f, 0.152338266f},
-std::array<float,2>{0.247592166f, 0.866481185f},
-std::array<float,2>{0.874259353f, 0.474866062f},
-std::array<float,2>{0.690665364f, 0.785362959f},
-std::array<float,2>{0.364124358f, 0.386795938f},
-std::array<float,2>{0.090220511f, 0.71921134f},
-std::array<float,2>{0.895096719f, 0.223009214f},
-std::array<float,2>{0.760106802f, 0.532945037f},
-std::array<float,2>{0.12713854f, 0.0856155455f},
-std::array<float,2>{0.455673724f, 0.989539146f},
-std::array<float,2>{0.613144517f, 0.35687542f},
-std::array<float,2>{0.889835119f, 0.753207088f},
-std::array<float,2>{0.0780009553f, 0.409148484f},
-std::array<float,2>{0.346197873f, 0.718404531f},
-std::array<float,2>{0.709697366f, 0.213989362f},
-std::array<float,2>{0.607032835f, 0.51009959f},
-std::array<float,2>{0.444453686f, 0.11511758f},
-std::array<float,2>{0.150408894f, 0.968296468f},
-std::array<float,2>{0.775019705f, 0.317663968f},
-std::array<float,2>{0.670306921f, 0.909525871f},
-std::array<float,2>{0.295989215f, 0.274822474f},
-std::array<float,2>{0.0085104173f, 0.605183721f},
-std::array<float,2>{0.998318553f, 0.0352283157f},
-std::array<float,2>{0.850884914f, 0.646011233f},
-std::array<float,2>{0.231628418f, 0.162305519f},
-std::array<float,2>{0.418732136f, 0.839237988f},
-std::array<float,2>{0.535598814f, 0.451595932f},
-std::array<float,2>{0.782063007f, 0.977216542f},
-std::array<float,2>{0.170606136f, 0.373387545f},
-std::array<float,2>{0.475691497f, 0.55338496f},
-std::array<float,2>{0.571471274f, 0.07384146f},
-std::array<float,2>{0.736517727f, 0.74660027f},
-std::array<float,2>{0.317722708f, 0.242031187f},
-std::array<float,2>{0.0990934893f, 0.803801f},
-std::array<float,2>{0.921971262f, 0.399969459f},
-std::array<float,2>{0.506341636f, 0.848523498f},
-std::array<float,2>{0.381383926f, 0.491797864f},
-std::array<float,2>{0.209846228f, 0.668826044f},
-std::array<float,2>{0.831973493f, 0.131936491f},
-std::array<float,2>{0.96171236f, 0.563085914f},
-std::array<float,2>{0.0404137038f, 0.00440543657f},
-std::array<float,2>{0.253211051f, 0.903032959f},
-std::array<float,2>{0.644415736f, 0.296738207f},
-std::array<float,2>{0.805158257f, 0.852354825f},
-std::array<float,2>{0.177490726f, 0.499948174f},
-std::array<float,2>{0.497001529f, 0.660400808f},
-std::array<float,2>{0.59106797f, 0.13767387f},
-std::array<float,2>{0.734017253f, 0.576988459f},
-std::array<float,2>{0.342355341f, 0.0134058855f},
-std::array<float,2>{0.123048276f, 0.898203135f},
-std::array<float,2>{0.915489376f, 0.283758342f},
-std::array<float,2>{0.522775888f, 0.969852865f},
-std::array<float,2>{0.40444839f, 0.365702659f},
-std::array<float,2>{0.194581658f, 0.562206864f},
-std::array<float,2>{0.815053701f, 0.0636136681f},
-std::array<float,2>{0.952600539f, 0.739386559f},
-std::array<float,2>{0.0611852184f, 0.242582262f},
-std::array<float,2>{0.270207256f, 0.808602214f},
-std::array<float,2>{0.634401321f, 0.391418248f},
-std::array<float,2>{0.894071817f, 0.917230427f},
-std::array<float,2>{0.0868798047f, 0.271129638f},
-std::array<float,2>{0.360357016f, 0.597978592f},
-std::array<float,2>{0.693799198f, 0.0431845263f},
-std::array<float,2>{0.6167714f, 0.65244776f},
-std::array<float,2>{0.45939824f, 0.169505745f},
-std::array<float,2>{0.132294372f, 0.833351076f},
-std::array<float,2>{0.761790395f, 0.442475587f},
-std::array<float,2>{0.674764931f, 0.760271668f},
-std::array<float,2>{0.311996162f, 0.418201327f},
-std::array<float,2>{0.0174540095f, 0.703195751f},
-std::array<float,2>{0.983912289f, 0.207025051f},
-std::array<float,2>{0.870386779f, 0.503283024f},
-std::array<float,2>{0.243860379f, 0.118033513f},
-std::array<float,2>{0.422809064f, 0.953262031f},
-std::array<float,2>{0.562190354f, 0.327585161f},
-std::array<float,2>{0.992547154f, 0.792378485f},
-std::array<float,2>{0.0127964038f, 0.381537169f},
-std::array<float,2>{0.291262895f, 0.727616489f},
-std::array<float,2>{0.665981531f, 0.227776065f},
-std::array<float,2>{0.535041571f, 0.542983472f},
-std::array<float,2>{0.414495826f, 0.0862037241f},
-std::array<float,2>{0.227536574f, 0.993298233f},
-std::array<float,2>{0.8455441f, 0.35109809f},
-std::array<float,2>{0.703979433f, 0.888378024f},
-std::array<float,2>{0.349731684f, 0.301724881f},
-std::array<float,2>{0.0729408488f, 0.58422035f},
-std::array<float,2>{0.886542678f, 0.021930594f},
-std::array<float,2>{0.780625045f, 0.677654684f},
-std::array<float,2>{0.152559042f, 0.145140871f},
-std::array<float,2>{0.438383907f, 0.873897672f},
-std::array<float,2>{0.602227092f, 0.481108129f},
-std::array<float,2>{0.833986759f, 0.951671243f},
-std::array<float,2>{0.206201822f, 0.341606945f},
-std::array<float,2>{0.376837939f, 0.524126053f},
-std::array<float,2>{0.500599205f, 0.105739057f},
-std::array<float,2>{0.64712584f, 0.698991895f},
-std::array<float,2>{0.255180061f, 0.188903913f},
-std::array<float,2>{0.0464598127f, 0.7812199f},
-std::array<float,2>{0.964959085f, 0.430545151f},
-std::array<float,2>{0.577783167f, 0.821079671f},
-std::array<float,2>{0.469517022f, 0.459044904f},
-std::array<float,2>{0.166366115f, 0.635428011f},
-std::array<float,2>{0.788871288f, 0.173767492f},
-std::array<float,2>{0.928798854f, 0.611789644f},
-std::array<float,2>{0.0965015963f, 0.050789874f},
-std::array<float,2>{0.316384465f, 0.937482417f},
-std::array<float,2>{0.739357412f, 0.265319139f},
-std::array<float,2>{0.855372906f, 0.773415864f},
-std::array<float,2>{0.226140037f, 0.422482342f},
-std::array<float,2>{0.409349442f, 0.688778043f},
-std::array<float,2>{0.539361835f, 0.203046918f},
-std::array<float,2>{0.660941422f, 0.521410048f},
-std::array<float,2>{0.28136304f, 0.101506479f},
-std::array<float,2>{0.00657302327f, 0.94252038f},
-std::array<float,2>{0.991075635f, 0.329339921f},
-std::array<float,2>{0.599979579f, 0.925538182f},
-std::array<float,2>{0.447888494f, 0.256321162f},
-std::array<float,2>{0.146974176f, 0.618698955f},
-std::array<float,2>{0.767266095f, 0.0581574589f},
-std::array<float,2>{0.877036095f, 0.62842226f},
-std::array<float,2>{0.0703000948f, 0.180801332f},
-std::array<float,2>{0.358675033f, 0.820249438f},
-std::array<float,2>{0.716745853f, 0.462318242f},
-std::array<float,2>{0.955633879f, 0.987356782f},
-std::array<float,2>{0.0328452215f, 0.35542053f},
-std::array<float,2>{0.263645411f, 0.536553442f},
-std::array<float,2>{0.654723227f, 0.081499055f},
-std::array<float,2>{0.510263085f, 0.725670874f},
-std::array<float,2>{0.386365831f, 0.220128402f},
-std::array<float,2>{0.21179539f, 0.784056664f},
-std::array<float,2>{0.841507435f, 0.386540085f},
-std::array<float,2>{0.747708619f, 0.860940218f},
-std::array<float,2>{0.323341757f, 0.472382516f},
-std::array<float,2>{0.101729661f, 0.687371671f},
-std::array<float,2>{0.934681118f, 0.152627602f},
-std::array<float,2>{0.790981591f, 0.589095354f},
-std::array<float,2>{0.156258032f, 0.0259805582f},
-std::array<float,2>{0.484022826f, 0.881656528f},
-std::array<float,2>{0.563482463f, 0.307075948f},
-std::array<float,2>{0.910608292f, 0.843591094f},
-std::array<float,2>{0.113815717f, 0.447993785f},
-std::array<float,2>{0.329632699f, 0.640915275f},
-std::array<float,2>{0.719875574f, 0.15700902f},
-std::array<float,2>{0.582180023f, 0.608208418f},
-std::array<float,2>{0.486164123f, 0.033570163f},
-std::array<float,2>{0.179987907f, 0.91184485f},
-std::array<float,2>{0.802371264f, 0.278965712f},
-std::array<float,2>{0.627468824f, 0.964829028f},
-std::array<float,2>{0.281048983f, 0.31367743f},
-std::array<float,2>{0.0478049777f, 0.51548326f},
-std::array<float,2>{0.944109619f, 0.1107435f},
-std::array<float,2>{0.826830685f, 0.712450445f},
-std::array<float,2>{0.200839281f, 0.215259001f},
-std::array<float,2>{0.39292866f, 0.754967332f},
-std::array<float,2>{0.531202376f, 0.411213696f},
-std::array<float,2>{0.751773298f, 0.901806116f},
-std::array<float,2>{0.136892691f, 0.29232052f},
-std::array<float,2>{0.464428335f, 0.567979574f},
-std::array<float,2>{0.624598145f, 0.00237795035f},
-std::array<float,2>{0.699172854f, 0.664701462f},
-std::array<float,2>{0.368400484f, 0.125523478f},
-std::array<float,2>{0.0795689672f, 0.845891535f},
-std::array<float,2>{0.904710829f, 0.488179624f},
-std::array<float,2>{0.548682988f, 0.800485551f},
-std::array<float,2>{0.431382835f, 0.403964251f},
-std::array<float,2>{0.242083013f, 0.745988846f},
-std::array<float,2>{0.867016196f, 0.235518023f},
-std::array<float,2>{0.971075773f, 0.549478352f},
-std::array<float,2>{0.0295165088f, 0.0758215711f},
-std::array<float,2>{0.304117203f, 0.981404424f},
-std::array<float,2>{0.685602784f, 0.367353708f},
-std::array<float,2>{0.79486233f, 0.763796508f},
-std::array<float,2>{0.162003726f, 0.414818555f},
-std::array<float,2>{0.478075743f, 0.709334195f},
-std::array<float,2>{0.568596065f, 0.210656911f},
-std::array<float,2>{0.743249834f, 0.507570326f},
-std::array<float,2>{0.325579315f, 0.121139944f},
-std::array<float,2>{0.106718808f, 0.960479021f},
-std::array<float,2>{0.932615519f, 0.32095328f},
-std::array<float,2>{0.512193441f, 0.920702994f},
-std::array<float,2>{0.388561904f, 0.268230796f},
-std::array<float,2>{0.217154473f, 0.596887469f},
-std::array<float,2>{0.838764787f, 0.0419699736f},
-std::array<float,2>{0.96033442f, 0.650232732f},
-std::array<float,2>{0.0356551707f, 0.165347219f},
-std::array<float,2>{0.261327177f, 0.829778969f},
-std::array<float,2>{0.651055217f, 0.439391404f},
-std::array<float,2>{0.880977094f, 0.973752916f},
-std::array<float,2>{0.0641874f, 0.361645579f},
-std::array<float,2>{0.355449975f, 0.557810187f},
-std::array<float,2>{0.711179137f, 0.0670492575f},
-std::array<float,2>{0.594814777f, 0.736047268f},
-std::array<float,2>{0.45273602f, 0.248900637f},
-std::array<float,2>{0.143638402f, 0.807748377f},
-std::array<float,2>{0.772215545f, 0.396107018f},
-std::array<float,2>{0.658661544f, 0.856912732f},
-std::array<float,2>{0.288062751f, 0.494752467f},
-std::array<float,2>{0.000241926275f, 0.659225166f},
-std::array<float,2>{0.987122715f, 0.135000095f},
-std::array<float,2>{0.857821643f, 0.573859572f},
-std::array<float,2>{0.222216815f, 0.00936376303f},
-std::array<float,2>{0.412750453f, 0.890726149f},
-std::array<float,2>{0.544600487f, 0.28619349f},
-std::array<float,2>{0.973903f, 0.826260328f},
-std::array<float,2>{0.027080996f, 0.454558939f},
-std::array<float,2>{0.300424963f, 0.640558779f},
-std::array<float,2>{0.682814837f, 0.178515404f},
-std::array<float,2>{0.551628232f, 0.616457045f},
-std::array<float,2>{0.434740335f, 0.0487789996f},
-std::array<float,2>{0.236218378f, 0.93168956f},
-std::array<float,2>{0.863096237f, 0.258318841f},
-std::array<float,2>{0.699862659f, 0.94565177f},
-std::array<float,2>{0.374671429f, 0.339771301f},
-std::array<float,2>{0.0846514329f, 0.531223059f},
-std::array<float,2>{0.899096131f, 0.102594241f},
-std::array<float,2>{0.75551331f, 0.702210307f},
-std::array<float,2>{0.136539236f, 0.192803264f},
-std::array<float,2>{0.466958106f, 0.773730576f},
-std::array<float,2>{0.619341373f, 0.433680654f},
-std::array<float,2>{0.823297262f, 0.886025488f},
-std::array<float,2>{0.197392493f, 0.300472349f},
-std::array<float,2>{0.395856708f, 0.578504801f},
-std::array<float,2>{0.525249362f, 0.0176659562f},
-std::array<float,2>{0.628995717f, 0.673992872f},
-std::array<float,2>{0.274725199f, 0.14385356f},
-std::array<float,2>{0.0527161099f, 0.869483411f},
-std::array<float,2>{0.941081464f, 0.480144173f},
-std::array<float,2>{0.581267953f, 0.796018481f},
-std::array<float,2>{0.489518642f, 0.376289755f},
-std::array<float,2>{0.187225476f, 0.732390821f},
-std::array<float,2>{0.798757613f, 0.233893231f},
-std::array<float,2>{0.908176839f, 0.540006399f},
-std::array<float,2>{0.11233104f, 0.0928475559f},
-std::array<float,2>{0.333331227f, 0.999226153f},
-std::array<float,2>{0.723105073f, 0.347087473f},
-std::array<float,2>{0.872847736f, 0.864311934f},
-std::array<float,2>{0.249387681f, 0.473099798f},
-std::array<float,2>{0.428049386f, 0.682529867f},
-std::array<float,2>{0.556309998f, 0.148743615f},
-std::array<float,2>{0.679472983f, 0.591928363f},
-std::array<float,2>{0.306674749f, 0.029314233f},
-std::array<float,2>{0.0232123118f, 0.875699639f},
-std::array<float,2>{0.979439497f, 0.309435636f},
-std::array<float,2>{0.611017048f, 0.991993368f},
-std::array<float,2>{0.453654021f, 0.359313577f},
-std::array<float,2>{0.126952171f, 0.533681512f},
-std::array<float,2>{0.759392619f, 0.0831978843f},
-std::array<float,2>{0.896657348f, 0.721516192f},
-std::array<float,2>{0.0931113362f, 0.225530997f},
-std::array<float,2>{0.365649939f, 0.788254499f},
-std::array<float,2>{0.68889302f, 0.38868013f},
-std::array<float,2>{0.946412563f, 0.928345084f},
-std::array<float,2>{0.0563980788f, 0.251084566f},
-std::array<float,2>{0.269290924f, 0.62459743f},
-std::array<float,2>{0.637529016f, 0.0618105866f},
-std::array<float,2>{0.518930256f, 0.632807136f},
-std::array<float,2>{0.400697917f, 0.183862194f},
-std::array<float,2>{0.189008817f, 0.815092802f},
-std::array<float,2>{0.817079663f, 0.465858877f},
-std::array<float,2>{0.728925228f, 0.769232631f},
-std::array<float,2>{0.336533487f, 0.425807506f},
-std::array<float,2>{0.120951012f, 0.69175905f},
-std::array<float,2>{0.919801354f, 0.195863366f},
-std::array<float,2>{0.809256554f, 0.519100189f},
-std::array<float,2>{0.172228679f, 0.0961230919f},
-std::array<float,2>{0.493288249f, 0.939204633f},
-std::array<float,2>{0.586185157f, 0.332143486f},
-std::array<float,2>{0.923995554f, 0.802461326f},
-std::array<float,2>{0.100635208f, 0.401365459f},
-std::array<float,2>{0.318976074f, 0.748274684f},
-std::array<float,2>{0.736178219f, 0.240065038f},
-std::array<float,2>{0.573733807f, 0.55177176f},
-std::array<float,2>{0.474428564f, 0.0720231906f},
-std::array<float,2>{0.169262603f, 0.978688657f},
-std::array<float,2>{0.783378065f, 0.372438967f},
-std::array<float,2>{0.641925514f, 0.905682325f},
-std::array<float,2>{0.251436651f, 0.293484628f},
-std::array<float,2>{0.0415199697f, 0.566186607f},
-std::array<float,2>{0.963310361f, 0.00681403605f},
-std::array<float,2>{0.828257084f, 0.670592129f},
-std::array<float,2>{0.208532378f, 0.129085138f},
-std::array<float,2>{0.379641473f, 0.850270689f},
-std::array<float,2>{0.504855037f, 0.489442766f},
-std::array<float,2>{0.775488734f, 0.965820253f},
-std::array<float,2>{0.149084091f, 0.319237828f},
-std::array<float,2>{0.441612542f, 0.509404063f},
-std::array<float,2>{0.607482612f, 0.115254395f},
-std::array<float,2>{0.708142877f, 0.715694666f},
-std::array<float,2>{0.345383137f, 0.212387189f},
-std::array<float,2>{0.0743500665f, 0.750071168f},
-std::array<float,2>{0.886725366f, 0.407613128f},
-std::array<float,2>{0.537309349f, 0.837410986f},
-std::array<float,2>{0.421065837f, 0.450222403f},
-std::array<float,2>{0.232509658f, 0.647739172f},
-std::array<float,2>{0.848463178f, 0.161524281f},
-std::array<float,2>{0.997916996f, 0.601625443f},
-std::array<float,2>{0.0106535694f, 0.0379300453f},
-std::array<float,2>{0.294617027f, 0.90697968f},
-std::array<float,2>{0.668617368f, 0.27715674f},
-std::array<float,2>{0.764179826f, 0.833992898f},
-std::array<float,2>{0.130528629f, 0.445079178f},
-std::array<float,2>{0.458472103f, 0.655705392f},
-std::array<float,2>{0.613660514f, 0.171289176f},
-std::array<float,2>{0.691934943f, 0.601408184f},
-std::array<float,2>{0.363154888f, 0.0461775362f},
-std::array<float,2>{0.0884849578f, 0.915677071f},
-std::array<float,2>{0.892078042f, 0.27209115f},
-std::array<float,2>{0.560312271f, 0.956979394f},
-std::array<float,2>{0.425054401f, 0.325274408f},
-std::array<float,2>{0.244295374f, 0.500887275f},
-std::array<float,2>{0.867797136f, 0.119814187f},
-std::array<float,2>{0.980939925f, 0.705536544f},
-std::array<float,2>{0.0177585818f, 0.203476906f},
-std::array<float,2>{0.309746891f, 0.757820845f},
-std::array<float,2>{0.673487604f, 0.421007007f},
-std::array<float,2>{0.917252481f, 0.896216571f},
-std::array<float,2>{0.121867009f, 0.282293081f},
-std::array<float,2>{0.341210485f, 0.574403882f},
-std::array<float,2>{0.732069016f, 0.0150009217f},
-std::array<float,2>{0.592827737f, 0.663448334f},
-std::array<float,2>{0.498634815f, 0.139105573f},
-std::array<float,2>{0.178840846f, 0.854914784f},
-std::array<float,2>{0.806883156f, 0.497603804f},
-std::array<float,2>{0.635709941f, 0.812305868f},
-std::array<float,2>{0.273205221f, 0.393738776f},
-std::array<float,2>{0.058745198f, 0.741213739f},
-std::array<float,2>{0.950727403f, 0.245850101f},
-std::array<float,2>{0.813045084f, 0.559290171f},
-std::array<float,2>{0.193286195f, 0.0659762695f},
-std::array<float,2>{0.403653353f, 0.971943438f},
-std::array<float,2>{0.519926965f, 0.364093363f},
-std::array<float,2>{0.968065977f, 0.778291583f},
-std::array<float,2>{0.0446596406f, 0.432918996f},
-std::array<float,2>{0.255966634f, 0.696964324f},
-std::array<float,2>{0.646206796f, 0.190475389f},
-std::array<float,2>{0.502534509f, 0.526536703f},
-std::array<float,2>{0.377402246f, 0.107872143f},
-std::array<float,2>{0.204688996f, 0.95030266f},
-std::array<float,2>{0.833445609f, 0.343224764f},
-std::array<float,2>{0.741536617f, 0.93500632f},
-std::array<float,2>{0.312560201f, 0.262426913f},
-std::array<float,2>{0.0940850228f, 0.611119688f},
-std::array<float,2>{0.926466644f, 0.0531234145f},
-std::array<float,2>{0.786716104f, 0.634347558f},
-std::array<float,2>{0.165980905f, 0.175136894f},
-std::array<float,2>{0.472598493f, 0.82240659f},
-std::array<float,2>{0.574777842f, 0.457504034f},
-std::array<float,2>{0.847169101f, 0.994967759f},
-std::array<float,2>{0.230330586f, 0.347938687f},
-std::array<float,2>{0.416979909f, 0.545358539f},
-std::array<float,2>{0.53125298f, 0.0892401859f},
-std::array<float,2>{0.667641521f, 0.728719771f},
-std::array<float,2>{0.289801538f, 0.228630066f},
-std::array<float,2>{0.0141537664f, 0.790300071f},
-std::array<float,2>{0.994728088f, 0.379983872f},
-std::array<float,2>{0.603897274f, 0.871922135f},
-std::array<float,2>{0.440168053f, 0.484351993f},
-std::array<float,2>{0.155810684f, 0.678415656f},
-std::array<float,2>{0.778556228f, 0.147197679f},
-std::array<float,2>{0.88417387f, 0.583936334f},
-std::array<float,2>{0.0721842796f, 0.0213870667f},
-std::array<float,2>{0.348167449f, 0.890114486f},
-std::array<float,2>{0.705179214f, 0.303481191f},
-std::array<float,2>{0.842911661f, 0.781774282f},
-std::array<float,2>{0.214837074f, 0.3830176f},
-std::array<float,2>{0.383259684f, 0.724450648f},
-std::array<float,2>{0.508599043f, 0.222620741f},
-std::array<float,2>{0.652603328f, 0.537955105f},
-std::array<float,2>{0.265060216f, 0.0784022212f},
-std::array<float,2>{0.0339045785f, 0.984834909f},
-std::array<float,2>{0.953199148f, 0.352333307f},
-std::array<float,2>{0.566320062f, 0.879995048f},
-std::array<float,2>{0.480967909f, 0.306284934f},
-std::array<float,2>{0.159706458f, 0.587738514f},
-std::array<float,2>{0.791043401f, 0.0238904152f},
-std::array<float,2>{0.937211633f, 0.68512398f},
-std::array<float,2>{0.104827523f, 0.154687673f},
-std::array<float,2>{0.320953459f, 0.863188863f},
-std::array<float,2>{0.748257756f, 0.470530957f},
-std::array<float,2>{0.989760816f, 0.944547296f},
-std::array<float,2>{0.00532660866f, 0.330145627f},
-std::array<float,2>{0.284766555f, 0.521570444f},
-std::array<float,2>{0.662139952f, 0.099183768f},
-std::array<float,2>{0.541431248f, 0.691310406f},
-std::array<float,2>{0.407454103f, 0.199746594f},
-std::array<float,2>{0.224283323f, 0.770764351f},
-std::array<float,2>{0.852080047f, 0.425428003f},
-std::array<float,2>{0.718720257f, 0.816595793f},
-std::array<float,2>{0.35637635f, 0.464774877f},
-std::array<float,2>{0.0674775243f, 0.625427783f},
-std::array<float,2>{0.875924647f, 0.182526946f},
-std::array<float,2>{0.769425392f, 0.619646192f},
-std::array<float,2>{0.145295188f, 0.0564098842f},
-std::array<float,2>{0.446195632f, 0.922578514f},
-std::array<float,2>{0.598218381f, 0.255095065f},
-std::array<float,2>{0.90416646f, 0.845590115f},
-std::array<float,2>{0.0805669725f, 0.484520048f},
-std::array<float,2>{0.369829267f, 0.666780651f},
-std::array<float,2>{0.696459711f, 0.128074765f},
-std::array<float,2>{0.621532083f, 0.56891799f},
-std::array<float,2>{0.461746812f, 0.000160929936f},
-std::array<float,2>{0.140334368f, 0.899291456f},
-std::array<float,2>{0.752769113f, 0.289382458f},
-std::array<float,2>{0.684231699f, 0.984009624f},
-std::array<float,2>{0.302173972f, 0.369310021f},
-std::array<float,2>{0.0281042606f, 0.547152281f},
-std::array<float,2>{0.969584465f, 0.0774604753f},
-std::array<float,2>{0.863623023f, 0.742192566f},
-std::array<float,2>{0.239412233f, 0.238162801f},
-std::array<float,2>{0.433296293f, 0.797804117f},
-std::array<float,2>{0.549235046f, 0.404829085f},
-std::array<float,2>{0.803539574f, 0.912658811f},
-std::array<float,2>{0.18271853f, 0.280920178f},
-std::array<float,2>{0.486373812f, 0.607040465f},
-std::array<float,2>{0.585178018f, 0.0320302844f},
-std::array<float,2>{0.722626269f, 0.643744707f},
-std::array<float,2>{0.330396265f, 0.15940322f},
-std::array<float,2>{0.117015079f, 0.840306878f},
-std::array<float,2>{0.913007975f, 0.446200222f},
-std::array<float,2>{0.528688729f, 0.757230282f},
-std::array<float,2>{0.391867131f, 0.412765175f},
-std::array<float,2>{0.203107625f, 0.713187873f},
-std::array<float,2>{0.825781763f, 0.217834994f},
-std::array<float,2>{0.942808628f, 0.513182163f},
-std::array<float,2>{0.0494832136f, 0.113246575f},
-std::array<float,2>{0.279065162f, 0.961564958f},
-std::array<float,2>{0.62646991f, 0.314723879f},
-std::array<float,2>{0.757347107f, 0.775044262f},
-std::array<float,2>{0.133182257f, 0.434664726f},
-std::array<float,2>{0.466508836f, 0.701429904f},
-std::array<float,2>{0.618005693f, 0.191884398f},
-std::array<float,2>{0.701839685f, 0.529568374f},
-std::array<float,2>{0.371543139f, 0.102035634f},
-std::array<float,2>{0.0829736441f, 0.946701109f},
-std::array<float,2>{0.901503265f, 0.338444591f},
-std::array<float,2>{0.553024769f, 0.933392763f},
-std::array<float,2>{0.436202914f, 0.259703547f},
-std::array<float,2>{0.236706868f, 0.615385711f},
-std::array<float,2>{0.86022532f, 0.046878133f},
-std::array<float,2>{0.974960446f, 0.639385939f},
-std::array<float,2>{0.024206901f, 0.178906858f},
-std::array<float,2>{0.297063917f, 0.827783763f},
-std::array<float,2>{0.6800161f, 0.453486115f},
-std::array<float,2>{0.908751607f, 0.99898684f},
-std::array<float,2>{0.110378563f, 0.346353412f},
-std::array<float,2>{0.334750742f, 0.540368259f},
-std::array<float,2>{0.725937545f, 0.0923471376f},
-std::array<float,2>{0.579988837f, 0.731392801f},
-std::array<float,2>{0.491566777f, 0.233381286f},
-std::array<float,2>{0.184880972f, 0.795373678f},
-std::array<float,2>{0.799030662f, 0.37533325f},
-std::array<float,2>{0.632448614f, 0.87062794f},
-std::array<float,2>{0.276137948f, 0.479131997f},
-std::array<float,2>{0.0545785576f, 0.675012469f},
-std::array<float,2>{0.938917637f, 0.14350453f},
-std::array<float,2>{0.820649326f, 0.579270422f},
-std::array<float,2>{0.195653692f, 0.0192713216f},
-std::array<float,2>{0.396567374f, 0.885104895f},
-std::array<float,2>{0.525940061f, 0.299508929f},
-std::array<float,2>{0.958780169f, 0.828850806f},
-std::array<float,2>{0.0377658196f, 0.438321203f},
-std::array<float,2>{0.258520186f, 0.649250388f},
-std::array<float,2>{0.649277866f, 0.164069369f},
-std::array<float,2>{0.514950395f, 0.596146405f},
-std::array<float,2>{0.390220761f, 0.042541977f},
-std::array<float,2>{0.216547877f, 0.92139262f},
-std::array<float,2>{0.836237729f, 0.268957168f},
-std::array<float,2>{0.744695365f, 0.959817588f},
-std::array<float,2>{0.326763332f, 0.322161019f},
-std::array<float,2>{0.108299233f, 0.50632745f},
-std::array<float,2>{0.930029213f, 0.122379184f},
-std::array<float,2>{0.795975626f, 0.710035801f},
-std::array<float,2>{0.16258499f, 0.209067732f},
-std::array<float,2>{0.479280472f, 0.764861882f},
-std::array<float,2>{0.566769123f, 0.415187538f},
-std::array<float,2>{0.85695231f, 0.891710937f},
-std::array<float,2>{0.220176697f, 0.285938203f},
-std::array<float,2>{0.41104424f, 0.573009312f},
-std::array<float,2>{0.545455933f, 0.0081033539f},
-std::array<float,2>{0.657898128f, 0.658825517f},
-std::array<float,2>{0.285174876f, 0.135837093f},
-std::array<float,2>{0.00310883974f, 0.856300771f},
-std::array<float,2>{0.985167384f, 0.495231599f},
-std::array<float,2>{0.596960127f, 0.807612181f},
-std::array<float,2>{0.449500859f, 0.39516592f},
-std::array<float,2>{0.140735075f, 0.735294938f},
-std::array<float,2>{0.76978457f, 0.249527231f},
-std::array<float,2>{0.880522609f, 0.557335973f},
-std::array<float,2>{0.0652984828f, 0.068235904f},
-std::array<float,2>{0.351913929f, 0.97326833f},
-std::array<float,2>{0.714313805f, 0.362580925f},
-std::array<float,2>{0.830982685f, 0.850768745f},
-std::array<float,2>{0.210904628f, 0.48896718f},
-std::array<float,2>{0.382524759f, 0.671706617f},
-std::array<float,2>{0.507066369f, 0.130462661f},
-std::array<float,2>{0.642854989f, 0.565230548f},
-std::array<float,2>{0.252147943f, 0.00735730259f},
-std::array<float,2>{0.0397429056f, 0.904504597f},
-std::array<float,2>{0.962197661f, 0.294268429f},
-std::array<float,2>{0.570686996f, 0.980151832f},
-std::array<float,2>{0.475090891f, 0.371934652f},
-std::array<float,2>{0.171474099f, 0.55116725f},
-std::array<float,2>{0.782409668f, 0.0703454986f},
-std::array<float,2>{0.923038185f, 0.749035716f},
-std::array<float,2>{0.0983180031f, 0.239149258f},
-std::array<float,2>{0.316432565f, 0.801523685f},
-std::array<float,2>{0.737616897f, 0.401583314f},
-std::array<float,2>{0.999308944f, 0.907620907f},
-std::array<float,2>{0.00894555822f, 0.275849253f},
-std::array<float,2>{0.295244545f, 0.603168428f},
-std::array<float,2>{0.671435177f, 0.0385013781f},
-std::array<float,2>{0.536457121f, 0.647274315f},
-std::array<float,2>{0.419178843f, 0.160433486f},
-std::array<float,2>{0.230894387f, 0.836511672f},
-std::array<float,2>{0.850482404f, 0.449691504f},
-std::array<float,2>{0.710578561f, 0.751832128f},
-std::array<float,2>{0.347004324f, 0.406833231f},
-std::array<float,2>{0.0766248927f, 0.716125607f},
-std::array<float,2>{0.889404178f, 0.211115912f},
-std::array<float,2>{0.773905754f, 0.508503795f},
-std::array<float,2>{0.152322903f, 0.116416961f},
-std::array<float,2>{0.444316447f, 0.966484547f},
-std::array<float,2>{0.605543554f, 0.319883525f},
-std::array<float,2>{0.895933151f, 0.78753835f},
-std::array<float,2>{0.0914525688f, 0.390449494f},
-std::array<float,2>{0.364468187f, 0.722652018f},
-std::array<float,2>{0.690117836f, 0.225719437f},
-std::array<float,2>{0.612245083f, 0.534689307f},
-std::array<float,2>{0.456316978f, 0.0824434757f},
-std::array<float,2>{0.128786832f, 0.990539074f},
-std::array<float,2>{0.761688948f, 0.358114511f},
-std::array<float,2>{0.677110434f, 0.876245797f},
-std::array<float,2>{0.305797666f, 0.309884071f},
-std::array<float,2>{0.0201950781f, 0.592912436f},
-std::array<float,2>{0.97770083f, 0.0306926705f},
-std::array<float,2>{0.873479307f, 0.682969034f},
-std::array<float,2>{0.246617034f, 0.150166795f},
-std::array<float,2>{0.426705718f, 0.864105582f},
-std::array<float,2>{0.558271348f, 0.474380404f},
-std::array<float,2>{0.812259316f, 0.938430965f},
-std::array<float,2>{0.174010858f, 0.333170563f},
-std::array<float,2>{0.494240016f, 0.518405497f},
-std::array<float,2>{0.588047922f, 0.0975456387f},
-std::array<float,2>{0.728043556f, 0.693331122f},
-std::array<float,2>{0.338668227f, 0.196882024f},
-std::array<float,2>{0.117308177f, 0.767859638f},
-std::array<float,2>{0.921122849f, 0.427657783f},
-std::array<float,2>{0.516729891f, 0.815958917f},
-std::array<float,2>{0.399942249f, 0.465782315f},
-std::array<float,2>{0.190193146f, 0.630954981f},
-std::array<float,2>{0.819889307f, 0.185410202f},
-std::array<float,2>{0.948287785f, 0.623716831f},
-std::array<float,2>{0.0568741858f, 0.0614151731f},
-std::array<float,2>{0.267251492f, 0.929431379f},
-std::array<float,2>{0.639615536f, 0.250464797f},
-std::array<float,2>{0.787519157f, 0.823602021f},
-std::array<float,2>{0.167210028f, 0.458416313f},
-std::array<float,2>{0.470495105f, 0.633710861f},
-std::array<float,2>{0.576842427f, 0.173917964f},
-std::array<float,2>{0.739214897f, 0.610314786f},
-std::array<float,2>{0.314934701f, 0.0539194085f},
-std::array<float,2>{0.0973895341f, 0.933743238f},
-std::array<float,2>{0.927820206f, 0.26278314f},
-std::array<float,2>{0.501436174f, 0.949378669f},
-std::array<float,2>{0.375428349f, 0.342343152f},
-std::array<float,2>{0.205542624f, 0.525569201f},
-std::array<float,2>{0.834966123f, 0.109118246f},
-std::array<float,2>{0.966181695f, 0.69550693f},
-std::array<float,2>{0.0458200574f, 0.189630166f},
-std::array<float,2>{0.253957152f, 0.778530002f},
-std::array<float,2>{0.647556603f, 0.432348102f},
-std::array<float,2>{0.885156929f, 0.889298737f},
-std::array<float,2>{0.0735766664f, 0.304638386f},
-std::array<float,2>{0.35096103f, 0.582912385f},
-std::array<float,2>{0.704360485f, 0.0198827442f},
-std::array<float,2>{0.602579236f, 0.678907335f},
-std::array<float,2>{0.43884024f, 0.14791286f},
-std::array<float,2>{0.153991759f, 0.872274339f},
-std::array<float,2>{0.779481113f, 0.482949466f},
-std::array<float,2>{0.664980233f, 0.78953594f},
-std::array<float,2>{0.292748332f, 0.379101336f},
-std::array<float,2>{0.0118162259f, 0.730109334f},
-std::array<float,2>{0.993704915f, 0.230135411f},
-std::array<float,2>{0.843858242f, 0.54591459f},
-std::array<float,2>{0.227922708f, 0.0883570015f},
-std::array<float,2>{0.415110558f, 0.995788336f},
-std::array<float,2>{0.534021139f, 0.348804027f},
-std::array<float,2>{0.983320057f, 0.759509742f},
-std::array<float,2>{0.0158634447f, 0.420404941f},
-std::array<float,2>{0.310588598f, 0.706179678f},
-std::array<float,2>{0.675243795f, 0.204876065f},
-std::array<float,2>{0.561208367f, 0.501147509f},
-std::array<float,2>{0.423490226f, 0.120560072f},
-std::array<float,2>{0.242814273f, 0.955697954f},
-std::array<float,2>{0.8693223f, 0.324640781f},
-std::array<float,2>{0.69523859f, 0.914448798f},
-std::array<float,2>{0.359530658f, 0.272979319f},
-std::array<float,2>{0.0871093422f, 0.600271642f},
-std::array<float,2>{0.892628551f, 0.0458378084f},
-std::array<float,2>{0.763422549f, 0.654791713f},
-std::array<float,2>{0.131423965f, 0.170318484f},
-std::array<float,2>{0.460437149f, 0.835586786f},
-std::array<float,2>{0.615436673f, 0.443629116f},
-std::array<float,2>{0.815832198f, 0.971055865f},
-std::array<float,2>{0.194229141f, 0.364608258f},
-std::array<float,2>{0.406064272f, 0.560242772f},
-std::array<float,2>{0.521888137f, 0.0646699518f},
-std::array<float,2>{0.633057177f, 0.740738273f},
-std::array<float,2>{0.270865709f, 0.244677797f},
-std::array<float,2>{0.0622806735f, 0.81106776f},
-std::array<float,2>{0.951652884f, 0.393286407f},
-std::array<float,2>{0.590067983f, 0.853975654f},
-std::array<float,2>{0.497676462f, 0.496374428f},
-std::array<float,2>{0.17621024f, 0.662848294f},
-std::array<float,2>{0.805689394f, 0.139898032f},
-std::array<float,2>{0.914176464f, 0.575636804f},
-std::array<float,2>{0.12449006f, 0.0144838411f},
-std::array<float,2>{0.343082726f, 0.894764721f},
-std::array<float,2>{0.733006656f, 0.282045126f},
-std::array<float,2>{0.865522563f, 0.798494697f},
-std::array<float,2>{0.240569547f, 0.4058716f},
-std::array<float,2>{0.430017382f, 0.743561149f},
-std::array<float,2>{0.547567725f, 0.236913115f},
-std::array<float,2>{0.687142968f, 0.548452139f},
-std::array<float,2>{0.303384811f, 0.0767517686f},
-std::array<float,2>{0.0305795223f, 0.982858717f},
-std::array<float,2>{0.971901238f, 0.371003687f},
-std::array<float,2>{0.623517871f, 0.900077283f},
-std::array<float,2>{0.463273257f, 0.290686399f},
-std::array<float,2>{0.138049707f, 0.570220172f},
-std::array<float,2>{0.750754833f, 0.001725571f},
-std::array<float,2>{0.905510068f, 0.667697489f},
-std::array<float,2>{0.0788089707f, 0.127462208f},
-std::array<float,2>{0.367198586f, 0.844355047f},
-std::array<float,2>{0.697742701f, 0.485645294f},
-std::array<float,2>{0.944800079f, 0.962235689f},
-std::array<float,2>{0.0481964871f, 0.316271126f},
-std::array<float,2>{0.279664516f, 0.512461722f},
-std::array<float,2>{0.628381193f, 0.111819267f},
-std::array<float,2>{0.529631495f, 0.714808285f},
-std::array<float,2>{0.394470274f, 0.216921642f},
-std::array<float,2>{0.199745432f, 0.756727099f},
-std::array<float,2>{0.827946305f, 0.413473755f},
-std::array<float,2>{0.719449759f, 0.840903163f},
-std::array<float,2>{0.328185618f, 0.446526617f},
-std::array<float,2>{0.114994951f, 0.642686665f},
-std::array<float,2>{0.911141276f, 0.158822387f},
-std::array<float,2>{0.801278472f, 0.606311858f},
-std::array<float,2>{0.181565031f, 0.0327743888f},
-std::array<float,2>{0.484622478f, 0.913147688f},
-std::array<float,2>{0.583066106f, 0.279870659f},
-std::array<float,2>{0.933631837f, 0.862122774f},
-std::array<float,2>{0.103198178f, 0.469156712f},
-std::array<float,2>{0.322513908f, 0.683958828f},
-std::array<float,2>{0.746487319f, 0.155486703f},
-std::array<float,2>{0.563263059f, 0.58665669f},
-std::array<float,2>{0.482939363f, 0.0249772836f},
-std::array<float,2>{0.15775311f, 0.879584074f},
-std::array<float,2>{0.789851069f, 0.305417866f},
-std::array<float,2>{0.655331016f, 0.986053228f},
-std::array<float,2>{0.262306243f, 0.353468835f},
-std::array<float,2>{0.0317167938f, 0.539060593f},
-std::array<float,2>{0.956380486f, 0.0793745145f},
-std::array<float,2>{0.840165377f, 0.723168015f},
-std::array<float,2>{0.212258518f, 0.220780656f},
-std::array<float,2>{0.38503933f, 0.782547832f},
-std::array<float,2>{0.511107802f, 0.384404868f},
-std::array<float,2>{0.765827537f, 0.923248768f},
-std::array<float,2>{0.147755548f, 0.2539424f},
-std::array<float,2>{0.448890388f, 0.621082425f},
-std::array<float,2>{0.600922585f, 0.0553474203f},
-std::array<float,2>{0.715607107f, 0.626906455f},
-std::array<float,2>{0.35817185f, 0.182656959f},
-std::array<float,2>{0.0685238093f, 0.817940593f},
-std::array<float,2>{0.878663957f, 0.46311304f},
-std::array<float,2>{0.54041487f, 0.769612789f},
-std::array<float,2>{0.408252507f, 0.424003035f},
-std::array<float,2>{0.225010589f, 0.689858973f},
-std::array<float,2>{0.854144394f, 0.201159745f},
-std::array<float,2>{0.99122417f, 0.523111165f},
-std::array<float,2>{0.0070476369f, 0.0983775854f},
-std::array<float,2>{0.282869011f, 0.943545222f},
-std::array<float,2>{0.661668956f, 0.331238955f},
-std::array<float,2>{0.797810733f, 0.793945432f},
-std::array<float,2>{0.186516166f, 0.378006667f},
-std::array<float,2>{0.489152253f, 0.734032094f},
-std::array<float,2>{0.580466866f, 0.231179133f},
-std::array<float,2>{0.724549949f, 0.541297495f},
-std::array<float,2>{0.332543522f, 0.0902123153f},
-std::array<float,2>{0.111560896f, 0.996830761f},
-std::array<float,2>{0.90661329f, 0.345298201f},
-std::array<float,2>{0.523625076f, 0.883409441f},
-std::array<float,2>{0.394684583f, 0.297405988f},
-std::array<float,2>{0.198437825f, 0.581005991f},
-std::array<float,2>{0.82324028f, 0.0162906479f},
-std::array<float,2>{0.939975381f, 0.673788548f},
-std::array<float,2>{0.0514371544f, 0.14168103f},
-std::array<float,2>{0.273960769f, 0.867338002f},
-std::array<float,2>{0.63035655f, 0.476634741f},
-std::array<float,2>{0.899920106f, 0.947676241f},
-std::array<float,2>{0.085498713f, 0.337690651f},
-std::array<float,2>{0.37311995f, 0.528062522f},
-std::array<float,2>{0.700237572f, 0.104588337f},
-std::array<float,2>{0.620941043f, 0.700221956f},
-std::array<float,2>{0.468276143f, 0.195077524f},
-std::array<float,2>{0.135667175f, 0.77611059f},
-std::array<float,2>{0.754727662f, 0.437349677f},
-std::array<float,2>{0.682407856f, 0.82426697f},
-std::array<float,2>{0.298846424f, 0.456785828f},
-std::array<float,2>{0.0262701791f, 0.637988031f},
-std::array<float,2>{0.973315597f, 0.176836714f},
-std::array<float,2>{0.861896873f, 0.615103662f},
-std::array<float,2>{0.235223204f, 0.0490377732f},
-std::array<float,2>{0.43428123f, 0.930238664f},
-std::array<float,2>{0.552103639f, 0.261445314f},
-std::array<float,2>{0.988208473f, 0.858859658f},
-std::array<float,2>{0.00144000596f, 0.492939591f},
-std::array<float,2>{0.288297862f, 0.658112943f},
-std::array<float,2>{0.659738302f, 0.134652629f},
-std::array<float,2>{0.543526947f, 0.571427345f},
-std::array<float,2>{0.413902223f, 0.0102889584f},
-std::array<float,2>{0.221589595f, 0.892723322f},
-std::array<float,2>{0.859068215f, 0.288700551f},
-std::array<float,2>{0.712559462f, 0.975967407f},
-std::array<float,2>{0.353557855f, 0.359478861f},
-std::array<float,2>{0.0633132458f, 0.556112349f},
-std::array<float,2>{0.882426083f, 0.0699097887f},
-std::array<float,2>{0.77320236f, 0.7368626f},
-std::array<float,2>{0.142993599f, 0.246270731f},
-std::array<float,2>{0.451903939f, 0.805239797f},
-std::array<float,2>{0.594456017f, 0.396860629f},
-std::array<float,2>{0.839345336f, 0.918420374f},
-std::array<float,2>{0.218338892f, 0.267551303f},
-std::array<float,2>{0.387636691f, 0.594949782f},
-std::array<float,2>{0.512811959f, 0.040789593f},
-std::array<float,2>{0.651502371f, 0.652129829f},
-std::array<float,2>{0.260033607f, 0.167946488f},
-std::array<float,2>{0.0366350189f, 0.831569731f},
-std::array<float,2>{0.959550142f, 0.440388113f},
-std::array<float,2>{0.569838464f, 0.763366401f},
-std::array<float,2>{0.477044642f, 0.416154355f},
-std::array<float,2>{0.160159558f, 0.708696783f},
-std::array<float,2>{0.793215036f, 0.207550019f},
-std::array<float,2>{0.932764947f, 0.505716264f},
-std::array<float,2>{0.106418312f, 0.12461298f},
-std::array<float,2>{0.3246741f, 0.95814389f},
-std::array<float,2>{0.742657185f, 0.323360682f},
-std::array<float,2>{0.848636866f, 0.838126242f},
-std::array<float,2>{0.233870804f, 0.452859879f},
-std::array<float,2>{0.41992557f, 0.645317793f},
-std::array<float,2>{0.538229823f, 0.163948119f},
-std::array<float,2>{0.669275165f, 0.604109883f},
-std::array<float,2>{0.293060482f, 0.0364276506f},
-std::array<float,2>{0.0109404074f, 0.908738732f},
-std::array<float,2>{0.997059405f, 0.273687571f},
-std::array<float,2>{0.608519673f, 0.967152834f},
-std::array<float,2>{0.443252027f, 0.317287892f},
-std::array<float,2>{0.149459302f, 0.511464298f},
-std::array<float,2>{0.776821792f, 0.114059739f},
-std::array<float,2>{0.887701929f, 0.7168504f},
-std::array<float,2>{0.07605993f, 0.213822246f},
-std::array<float,2>{0.3443003f, 0.75219053f},
-std::array<float,2>{0.707781255f, 0.409363657f},
-std::array<float,2>{0.964182734f, 0.904053628f},
-std::array<float,2>{0.0424046256f, 0.295540959f},
-std::array<float,2>{0.250440657f, 0.563597143f},
-std::array<float,2>{0.640694439f, 0.00492790202f},
-std::array<float,2>{0.505477428f, 0.669587016f},
-std::array<float,2>{0.380255163f, 0.130984247f},
-std::array<float,2>{0.20719102f, 0.849530339f},
-std::array<float,2>{0.830029607f, 0.490439624f},
-std::array<float,2>{0.734581351f, 0.803415656f},
-std::array<float,2>{0.320154786f, 0.399131298f},
-std::array<float,2>{0.100131154f, 0.747310281f},
-std::array<float,2>{0.925276518f, 0.240534306f},
-std::array<float,2>{0.784786403f, 0.554673493f},
-std::array<float,2>{0.168110624f, 0.0724701583f},
-std::array<float,2>{0.472676456f, 0.977576733f},
-std::array<float,2>{0.5725618f, 0.374726504f},
-std::array<float,2>{0.918421388f, 0.767142236f},
-std::array<float,2>{0.119562402f, 0.428234875f},
-std::array<float,2>{0.337590903f, 0.694750249f},
-std::array<float,2>{0.730090618f, 0.198855191f},
-std::array<float,2>{0.587344587f, 0.517208278f},
-std::array<float,2>{0.492781758f, 0.0955431983f},
-std::array<float,2>{0.173523322f, 0.941125214f},
-std::array<float,2>{0.809824288f, 0.334855407f},
-std::array<float,2>{0.63786906f, 0.926769137f},
-std::array<float,2>{0.26777935f, 0.253016651f},
-std::array<float,2>{0.0550857708f, 0.622447908f},
-std::array<float,2>{0.945753455f, 0.0596342869f},
-std::array<float,2>{0.817822695f, 0.630139887f},
-std::array<float,2>{0.188139036f, 0.186999559f},
-std::array<float,2>{0.401536137f, 0.813277304f},
-std::array<float,2>{0.518504202f, 0.468507051f},
-std::array<float,2>{0.758208871f, 0.988874197f},
-std::array<float,2>{0.125400394f, 0.356020004f},
-std::array<float,2>{0.454775989f, 0.532183111f},
-std::array<float,2>{0.609573603f, 0.0845444724f},
-std::array<float,2>{0.687505722f, 0.72054404f},
-std::array<float,2>{0.367071509f, 0.223717093f},
-std::array<float,2>{0.0921076462f, 0.786466897f},
-std::array<float,2>{0.898252487f, 0.387794822f},
-std::array<float,2>{0.554900229f, 0.865696371f},
-std::array<float,2>{0.428838253f, 0.476253718f},
-std::array<float,2>{0.248890549f, 0.681501985f},
-std::array<float,2>{0.871864617f, 0.151263982f},
-std::array<float,2>{0.980114698f, 0.590149999f},
-std::array<float,2>{0.0216365773f, 0.0278663188f},
-std::array<float,2>{0.308141708f, 0.878598571f},
-std::array<float,2>{0.678064167f, 0.3117356f},
-std::array<float,2>{0.777494192f, 0.874213696f},
-std::array<float,2>{0.154439077f, 0.482395172f},
-std::array<float,2>{0.440741837f, 0.676512241f},
-std::array<float,2>{0.605251789f, 0.14577654f},
-std::array<float,2>{0.706977606f, 0.585841238f},
-std::array<float,2>{0.349113196f, 0.0227390695f},
-std::array<float,2>{0.0705957785f, 0.886944234f},
-std::array<float,2>{0.883100092f, 0.302159041f},
-std::array<float,2>{0.533167481f, 0.992982507f},
-std::array<float,2>{0.417108357f, 0.350203812f},
-std::array<float,2>{0.229147106f, 0.544288278f},
-std::array<float,2>{0.846244454f, 0.0875708163f},
-std::array<float,2>{0.995864451f, 0.727067471f},
-std::array<float,2>{0.0154435085f, 0.227209017f},
-std::array<float,2>{0.290749192f, 0.79121691f},
-std::array<float,2>{0.666044116f, 0.382778436f},
-std::array<float,2>{0.926797986f, 0.935769916f},
-std::array<float,2>{0.094773978f, 0.263902068f},
-std::array<float,2>{0.314129412f, 0.613186717f},
-std::array<float,2>{0.74097985f, 0.0520438738f},
-std::array<float,2>{0.575438797f, 0.63654238f},
-std::array<float,2>{0.470753014f, 0.172174439f},
-std::array<float,2>{0.164361864f, 0.821975172f},
-std::array<float,2>{0.785411716f, 0.460680693f},
-std::array<float,2>{0.645053566f, 0.780269802f},
-std::array<float,2>{0.25766328f, 0.431364447f},
-std::array<float,2>{0.0431348458f, 0.697699785f},
-std::array<float,2>{0.966890275f, 0.188091516f},
-std::array<float,2>{0.832131803f, 0.524947822f},
-std::array<float,2>{0.203317881f, 0.107048333f},
-std::array<float,2>{0.378601402f, 0.95239234f},
-std::array<float,2>{0.50368768f, 0.340692192f},
-std::array<float,2>{0.949423492f, 0.809887111f},
-std::array<float,2>{0.0605193526f, 0.392273754f},
-std::array<float,2>{0.271575868f, 0.739235044f},
-std::array<float,2>{0.636193991f, 0.243471175f},
-std::array<float,2>{0.521381617f, 0.561018109f},
-std::array<float,2>{0.403086871f, 0.0629842058f},
-std::array<float,2>{0.191989243f, 0.969633639f},
-std::array<float,2>{0.813814104f, 0.367117018f},
-std::array<float,2>{0.73102057f, 0.896741331f},
-std::array<float,2>{0.340376139f, 0.284603685f},
-std::array<float,2>{0.122347414f, 0.577952981f},
-std::array<float,2>{0.916687846f, 0.0122965863f},
-std::array<float,2>{0.808518112f, 0.661192954f},
-std::array<float,2>{0.177753076f, 0.13855575f},
-std::array<float,2>{0.499090225f, 0.852612138f},
-std::array<float,2>{0.59267658f, 0.498673797f},
-std::array<float,2>{0.868382692f, 0.955053031f},
-std::array<float,2>{0.245800495f, 0.326848686f},
-std::array<float,2>{0.423982114f, 0.502193868f},
-std::array<float,2>{0.559447885f, 0.118503109f},
-std::array<float,2>{0.672773957f, 0.704371452f},
-std::array<float,2>{0.308952689f, 0.20531331f},
-std::array<float,2>{0.0188238192f, 0.761217296f},
-std::array<float,2>{0.982075214f, 0.419245332f},
-std::array<float,2>{0.615027547f, 0.832828283f},
-std::array<float,2>{0.457331002f, 0.441604316f},
-std::array<float,2>{0.129817784f, 0.654295623f},
-std::array<float,2>{0.765347004f, 0.16833505f},
-std::array<float,2>{0.891031861f, 0.598835945f},
-std::array<float,2>{0.0888975635f, 0.0442766957f},
-std::array<float,2>{0.362302035f, 0.916955769f},
-std::array<float,2>{0.692729652f, 0.270145327f},
-std::array<float,2>{0.825088143f, 0.754079998f},
-std::array<float,2>{0.201453775f, 0.41084078f},
-std::array<float,2>{0.391395748f, 0.710947394f},
-std::array<float,2>{0.528170705f, 0.215884015f},
-std::array<float,2>{0.625862896f, 0.514090419f},
-std::array<float,2>{0.277865469f, 0.109468348f},
-std::array<float,2>{0.0503504798f, 0.963268459f},
-std::array<float,2>{0.941480756f, 0.313366801f},
-std::array<float,2>{0.584781885f, 0.910718203f},
-std::array<float,2>{0.48766017f, 0.277907968f},
-std::array<float,2>{0.181802958f, 0.608855128f},
-std::array<float,2>{0.803862274f, 0.0347242877f},
-std::array<float,2>{0.913642704f, 0.641986549f},
-std::array<float,2>{0.116137311f, 0.158111438f},
-std::array<float,2>{0.331837952f, 0.842445195f},
-std::array<float,2>{0.721562684f, 0.448864162f},
-std::array<float,2>{0.970336556f, 0.982033789f},
-std::array<float,2>{0.0288961679f, 0.368763596f},
-std::array<float,2>{0.301186681f, 0.550488174f},
-std::array<float,2>{0.684649527f, 0.0743639171f},
-std::array<float,2>{0.55072993f, 0.744685411f},
-std::array<float,2>{0.432280511f, 0.234402642f},
-std::array<float,2>{0.239126489f, 0.79946667f},
-std::array<float,2>{0.864572406f, 0.402997047f},
-std::array<float,2>{0.695323467f, 0.846778631f},
-std::array<float,2>{0.370842397f, 0.486437052f},
-std::array<float,2>{0.0819683895f, 0.66504091f},
-std::array<float,2>{0.902561486f, 0.126930296f},
-std::array<float,2>{0.752979994f, 0.566480994f},
-std::array<float,2>{0.139527351f, 0.00364536489f},
-std::array<float,2>{0.462186575f, 0.901328683f},
-std::array<float,2>{0.62216723f, 0.291842699f},
-std::array<float,2>{0.876362145f, 0.818542719f},
-std::array<float,2>{0.0669908077f, 0.461411953f},
-std::array<float,2>{0.357124805f, 0.627919734f},
-std::array<float,2>{0.717185736f, 0.180646792f},
-std::array<float,2>{0.598755598f, 0.617216587f},
-std::array<float,2>{0.446850181f, 0.0568705425f},
-std::array<float,2>{0.145648047f, 0.923861504f},
-std::array<float,2>{0.76775068f, 0.257810473f},
-std::array<float,2>{0.663880169f, 0.941565216f},
-std::array<float,2>{0.283667594f, 0.328410178f},
-std::array<float,2>{0.00458895415f, 0.519689739f},
-std::array<float,2>{0.988797009f, 0.0998786986f},
-std::array<float,2>{0.853432894f, 0.687606871f},
-std::array<float,2>{0.22271131f, 0.201607749f},
-std::array<float,2>{0.4071922f, 0.77175343f},
-std::array<float,2>{0.542205572f, 0.423816442f},
-std::array<float,2>{0.792018712f, 0.882258713f},
-std::array<float,2>{0.158314735f, 0.308497339f},
-std::array<float,2>{0.482338071f, 0.588116586f},
-std::array<float,2>{0.565313935f, 0.0272945408f},
-std::array<float,2>{0.749693751f, 0.685911536f},
-std::array<float,2>{0.32157445f, 0.153804392f},
-std::array<float,2>{0.104073703f, 0.859603226f},
-std::array<float,2>{0.936455131f, 0.471508712f},
-std::array<float,2>{0.509190738f, 0.785063207f},
-std::array<float,2>{0.384547889f, 0.385451734f},
-std::array<float,2>{0.213115841f, 0.724719942f},
-std::array<float,2>{0.842533171f, 0.219200015f},
-std::array<float,2>{0.954315364f, 0.535833001f},
-std::array<float,2>{0.0342301279f, 0.0806242302f},
-std::array<float,2>{0.263818413f, 0.986859858f},
-std::array<float,2>{0.654121876f, 0.353599548f},
-std::array<float,2>{0.761113822f, 0.787067652f},
-std::array<float,2>{0.127990261f, 0.388601124f},
-std::array<float,2>{0.456808507f, 0.719994009f},
-std::array<float,2>{0.61158663f, 0.224191338f},
-std::array<float,2>{0.689582646f, 0.5315997f},
-std::array<float,2>{0.36520043f, 0.0842492208f},
-std::array<float,2>{0.0911564007f, 0.988483012f},
-std::array<float,2>{0.896460533f, 0.355564356f},
-std::array<float,2>{0.557870626f, 0.877995491f},
-std::array<float,2>{0.426065326f, 0.312179148f},
-std::array<float,2>{0.246545449f, 0.590649366f},
-std::array<float,2>{0.873655736f, 0.0277432818f},
-std::array<float,2>{0.978192151f, 0.680962622f},
-std::array<float,2>{0.019584382f, 0.150470242f},
-std::array<float,2>{0.306616932f, 0.865890801f},
-std::array<float,2>{0.677559018f, 0.476058722f},
-std::array<float,2>{0.921807766f, 0.940751195f},
-std::array<float,2>{0.117765926f, 0.334023982f},
-std::array<float,2>{0.338116765f, 0.516607463f},
-std::array<float,2>{0.72758311f, 0.0948594585f},
-std::array<float,2>{0.588597f, 0.695301294f},
-std::array<float,2>{0.495072484f, 0.198721245f},
-std::array<float,2>{0.174395323f, 0.766748548f},
-std::array<float,2>{0.811978221f, 0.428171903f},
-std::array<float,2>{0.639148533f, 0.8129794f},
-std::array<float,2>{0.266839445f, 0.467844188f},
-std::array<float,2>{0.0571761355f, 0.630428731f},
-std::array<float,2>{0.949195087f, 0.187274456f},
-std::array<float,2>{0.81969291f, 0.622634768f},
-std::array<float,2>{0.189541787f, 0.0602897443f},
-std::array<float,2>{0.399503767f, 0.927343071f},
-std::array<float,2>{0.517193139f, 0.253753424f},
-std::array<float,2>{0.962509334f, 0.84895891f},
-std::array<float,2>{0.039168328f, 0.49088788f},
-std::array<float,2>{0.252909303f, 0.669135571f},
-std::array<float,2>{0.643111825f, 0.131366119f},
-std::array<float,2>{0.507439852f, 0.564053297f},
-std::array<float,2>{0.381935984f, 0.00543916319f},
-std::array<float,2>{0.210028186f, 0.903745115f},
-std::array<float,2>{0.830348849f, 0.295095474f},
-std::array<float,2>{0.738137543f, 0.978412092f},
-std::array<float,2>{0.317227364f, 0.374226183f},
-std::array<float,2>{0.0980114639f, 0.553809047f},
-std::array<float,2>{0.923631668f, 0.073097378f},
-std::array<float,2>{0.783138871f, 0.748035312f},
-std::array<float,2>{0.170972914f, 0.24120006f},
-std::array<float,2>{0.475350708f, 0.802823484f},
-std::array<float,2>{0.571021318f, 0.398897082f},
-std::array<float,2>{0.849614918f, 0.908558726f},
-std::array<float,2>{0.231064141f, 0.274308473f},
-std::array<float,2>{0.419884115f, 0.60373354f},
-std::array<float,2>{0.536933303f, 0.0366961919f},
-std::array<float,2>{0.670987844f, 0.644992292f},
-std::array<float,2>{0.295614958f, 0.163486332f},
-std::array<float,2>{0.00938607007f, 0.838619232f},
-std::array<float,2>{0.999515235f, 0.452364415f},
-std::array<float,2>{0.606061101f, 0.75252527f},
-std::array<float,2>{0.443438023f, 0.409738302f},
-std::array<float,2>{0.151396737f, 0.717518866f},
-std::array<float,2>{0.774304032f, 0.213051915f},
-std::array<float,2>{0.888950706f, 0.510970771f},
-std::array<float,2>{0.0770222321f, 0.113564879f},
-std::array<float,2>{0.347569108f, 0.967370093f},
-std::array<float,2>{0.710072398f, 0.316449493f},
-std::array<float,2>{0.836751759f, 0.831489682f},
-std::array<float,2>{0.21621716f, 0.439685464f},
-std::array<float,2>{0.389666378f, 0.651515067f},
-std::array<float,2>{0.515447319f, 0.167070299f},
-std::array<float,2>{0.648689866f, 0.595269203f},
-std::array<float,2>{0.258062065f, 0.0400711857f},
-std::array<float,2>{0.0371629149f, 0.918899715f},
-std::array<float,2>{0.958453357f, 0.267007113f},
-std::array<float,2>{0.567003191f, 0.958941281f},
-std::array<float,2>{0.478691518f, 0.323963404f},
-std::array<float,2>{0.163015679f, 0.505121529f},
-std::array<float,2>{0.796701908f, 0.124176063f},
-std::array<float,2>{0.930660009f, 0.70805496f},
-std::array<float,2>{0.107648581f, 0.207190514f},
-std::array<float,2>{0.326192141f, 0.762766004f},
-std::array<float,2>{0.744257689f, 0.416880131f},
-std::array<float,2>{0.984428406f, 0.893197298f},
-std::array<float,2>{0.00373876933f, 0.288113564f},
-std::array<float,2>{0.285802811f, 0.572241783f},
-std::array<float,2>{0.657672822f, 0.0100908726f},
-std::array<float,2>{0.54495126f, 0.657561719f},
-std::array<float,2>{0.410627246f, 0.13395308f},
-std::array<float,2>{0.220463723f, 0.85922718f},
-std::array<float,2>{0.856481493f, 0.49235633f},
-std::array<float,2>{0.714770138f, 0.804751098f},
-std::array<float,2>{0.352474838f, 0.397082955f},
-std::array<float,2>{0.0649077147f, 0.736794472f},
-std::array<float,2>{0.880098164f, 0.246684685f},
-std::array<float,2>{0.770323217f, 0.556375504f},
-std::array<float,2>{0.141535148f, 0.0696842745f},
-std::array<float,2>{0.449848682f, 0.97644496f},
-std::array<float,2>{0.597381592f, 0.359913081f},
-std::array<float,2>{0.902051032f, 0.775470316f},
-std::array<float,2>{0.0823773742f, 0.436524093f},
-std::array<float,2>{0.371835053f, 0.700845122f},
-std::array<float,2>{0.701588035f, 0.194502771f},
-std::array<float,2>{0.617337406f, 0.527684867f},
-std::array<float,2>{0.465856761f, 0.105020285f},
-std::array<float,2>{0.133692265f, 0.948196113f},
-std::array<float,2>{0.757010758f, 0.337002099f},
-std::array<float,2>{0.680513859f, 0.929846406f},
-std::array<float,2>{0.297637969f, 0.261099845f},
-std::array<float,2>{0.0237608459f, 0.614649832f},
-std::array<float,2>{0.975512922f, 0.0495153777f},
-std::array<float,2>{0.859711647f, 0.638279915f},
-std::array<float,2>{0.237304568f, 0.177516282f},
-std::array<float,2>{0.436000019f, 0.824775636f},
-std::array<float,2>{0.5535025f, 0.456214637f},
-std::array<float,2>{0.799723566f, 0.996293247f},
-std::array<float,2>{0.185196638f, 0.344982386f},
-std::array<float,2>{0.49199599f, 0.541778684f},
-std::array<float,2>{0.579186261f, 0.090654701f},
-std::array<float,2>{0.726450026f, 0.733604908f},
-std::array<float,2>{0.334213912f, 0.230827689f},
-std::array<float,2>{0.110901229f, 0.794703484f},
-std::array<float,2>{0.90843749f, 0.378569365f},
-std::array<float,2>{0.525689185f, 0.868146479f},
-std::array<float,2>{0.397390097f, 0.477223098f},
-std::array<float,2>{0.196042687f, 0.672881901f},
-std::array<float,2>{0.820818543f, 0.142502964f},
-std::array<float,2>{0.939302266f, 0.580484569f},
-std::array<float,2>{0.0538187064f, 0.0158503186f},
-std::array<float,2>{0.275828332f, 0.883181036f},
-std::array<float,2>{0.632188261f, 0.296972305f},
-std::array<float,2>{0.789375842f, 0.859908879f},
-std::array<float,2>{0.157499462f, 0.470916867f},
-std::array<float,2>{0.482592255f, 0.686370552f},
-std::array<float,2>{0.562885761f, 0.153847694f},
-std::array<float,2>{0.746802926f, 0.588422954f},
-std::array<float,2>{0.323130369f, 0.0265233368f},
-std::array<float,2>{0.102707773f, 0.882783234f},
-std::array<float,2>{0.934176087f, 0.307816267f},
-std::array<float,2>{0.511544228f, 0.986714363f},
-std::array<float,2>{0.385256946f, 0.354074985f},
-std::array<float,2>{0.212691471f, 0.535352886f},
-std::array<float,2>{0.84067291f, 0.0804954618f},
-std::array<float,2>{0.95665288f, 0.725272417f},
-std::array<float,2>{0.0319852456f, 0.219385415f},
-std::array<float,2>{0.261871189f, 0.784470201f},
-std::array<float,2>{0.656002998f, 0.385041833f},
-std::array<float,2>{0.878366768f, 0.924422443f},
-std::array<float,2>{0.0691732466f, 0.256982595f},
-std::array<float,2>{0.357825488f, 0.618146658f},
-std::array<float,2>{0.715015769f, 0.057563886f},
-std::array<float,2>{0.601087689f, 0.627204597f},
-std::array<float,2>{0.448416352f, 0.180136427f},
-std::array<float,2>{0.148124263f, 0.819289744f},
-std::array<float,2>{0.766489804f, 0.461616069f},
-std::array<float,2>{0.661258698f, 0.772001743f},
-std::array<float,2>{0.282554209f, 0.42326045f},
-std::array<float,2>{0.00762543408f, 0.688322186f},
-std::array<float,2>{0.992052674f, 0.201864734f},
-std::array<float,2>{0.853528917f, 0.520375192f},
-std::array<float,2>{0.225428805f, 0.100410305f},
-std::array<float,2>{0.408811659f, 0.942356765f},
-std::array<float,2>{0.540934801f, 0.329014093f},
-std::array<float,2>{0.972193956f, 0.799014509f},
-std::array<float,2>{0.0309743714f, 0.402661741f},
-std::array<float,2>{0.303166598f, 0.744347036f},
-std::array<float,2>{0.686570525f, 0.235213682f},
-std::array<float,2>{0.547149897f, 0.54994446f},
-std::array<float,2>{0.430192858f, 0.0750083029f},
-std::array<float,2>{0.240950212f, 0.981630385f},
-std::array<float,2>{0.865884244f, 0.368173301f},
-std::array<float,2>{0.698089004f, 0.900402367f},
-std::array<float,2>{0.367916942f, 0.291314095f},
-std::array<float,2>{0.0782864317f, 0.566999257f},
-std::array<float,2>{0.906026125f, 0.0033540884f},
-std::array<float,2>{0.750159025f, 0.665817142f},
-std::array<float,2>{0.138284251f, 0.126397789f},
-std::array<float,2>{0.463542968f, 0.847461939f},
-std::array<float,2>{0.623991787f, 0.486890972f},
-std::array<float,2>{0.827550709f, 0.963760495f},
-std::array<float,2>{0.199326918f, 0.312523454f},
-std::array<float,2>{0.393796057f, 0.51437813f},
-std::array<float,2>{0.529942393f, 0.109996319f},
-std::array<float,2>{0.628427207f, 0.711891174f},
-std::array<float,2>{0.279822886f, 0.216565654f},
-std::array<float,2>{0.0487804413f, 0.754773974f},
-std::array<float,2>{0.945225835f, 0.410188913f},
-std::array<float,2>{0.583518982f, 0.841905951f},
-std::array<float,2>{0.485042423f, 0.448270351f},
-std::array<float,2>{0.181084037f, 0.642532587f},
-std::array<float,2>{0.80086118f, 0.157583341f},
-std::array<float,2>{0.911956549f, 0.609122515f},
-std::array<float,2>{0.114610046f, 0.0345457643f},
-std::array<float,2>{0.328969061f, 0.910520375f},
-std::array<float,2>{0.719236553f, 0.277493387f},
-std::array<float,2>{0.8697142f, 0.761634529f},
-std::array<float,2>{0.242337868f, 0.419771701f},
-std::array<float,2>{0.42328167f, 0.704974651f},
-std::array<float,2>{0.560745537f, 0.205941111f},
-std::array<float,2>{0.675596356f, 0.502782345f},
-std::array<float,2>{0.311334431f, 0.118895002f},
-std::array<float,2>{0.0163592007f, 0.954366326f},
-std::array<float,2>{0.982812166f, 0.326619059f},
-std::array<float,2>{0.616127312f, 0.91632545f},
-std::array<float,2>{0.460559398f, 0.269798368f},
-std::array<float,2>{0.130982623f, 0.599584937f},
-std::array<float,2>{0.762826085f, 0.0448406152f},
-std::array<float,2>{0.893438458f, 0.653727472f},
-std::array<float,2>{0.0874556899f, 0.168720305f},
-std::array<float,2>{0.360299498f, 0.832366884f},
-std::array<float,2>{0.694648921f, 0.442000419f},
-std::array<float,2>{0.951987863f, 0.969154179f},
-std::array<float,2>{0.0617514551f, 0.366698921f},
-std::array<float,2>{0.2711595f, 0.561508775f},
-std::array<float,2>{0.633783221f, 0.0630494878f},
-std::array<float,2>{0.522092402f, 0.738697231f},
-std::array<float,2>{0.405316979f, 0.243657216f},
-std::array<float,2>{0.193614423f, 0.810408056f},
-std::array<float,2>{0.816213131f, 0.39189893f},
-std::array<float,2>{0.732491136f, 0.853310943f},
-std::array<float,2>{0.343736857f, 0.49835825f},
-std::array<float,2>{0.12496905f, 0.661841631f},
-std::array<float,2>{0.914768279f, 0.137807414f},
-std::array<float,2>{0.806417406f, 0.57725668f},
-std::array<float,2>{0.176713422f, 0.0120727401f},
-std::array<float,2>{0.497332215f, 0.897205114f},
-std::array<float,2>{0.590703726f, 0.284807682f},
-std::array<float,2>{0.928313076f, 0.821328044f},
-std::array<float,2>{0.0970254168f, 0.460086346f},
-std::array<float,2>{0.315141141f, 0.635919273f},
-std::array<float,2>{0.738594115f, 0.172427669f},
-std::array<float,2>{0.576375544f, 0.61251533f},
-std::array<float,2>{0.469894737f, 0.0526488423f},
-std::array<float,2>{0.16774638f, 0.936379671f},
-std::array<float,2>{0.787650645f, 0.264637411f},
-std::array<float,2>{0.647976518f, 0.952922881f},
-std::array<float,2>{0.254713029f, 0.340061635f},
-std::array<float,2>{0.0450064801f, 0.524581969f},
-std::array<float,2>{0.966450214f, 0.106532633f},
-std::array<float,2>{0.835732043f, 0.698084533f},
-std::array<float,2>{0.205944419f, 0.187792867f},
-std::array<float,2>{0.375776172f, 0.779412925f},
-std::array<float,2>{0.501569927f, 0.430976927f},
-std::array<float,2>{0.77988112f, 0.887249053f},
-std::array<float,2>{0.153456688f, 0.302377582f},
-std::array<float,2>{0.439388782f, 0.585268259f},
-std::array<float,2>{0.603029072f, 0.0231083371f},
-std::array<float,2>{0.704762399f, 0.676257253f},
-std::array<float,2>{0.35114029f, 0.146442965f},
-std::array<float,2>{0.0739595443f, 0.874567091f},
-std::array<float,2>{0.885471106f, 0.481755257f},
-std::array<float,2>{0.533254206f, 0.791879535f},
-std::array<float,2>{0.415977418f, 0.382028311f},
-std::array<float,2>{0.228337139f, 0.726631045f},
-std::array<float,2>{0.844494641f, 0.226866841f},
-std::array<float,2>{0.993304729f, 0.544665456f},
-std::array<float,2>{0.0123346178f, 0.0870515704f},
-std::array<float,2>{0.29238981f, 0.992650986f},
-std::array<float,2>{0.664462149f, 0.350058794f},
-std::array<float,2>{0.810372293f, 0.76828742f},
-std::array<float,2>{0.172986001f, 0.426830918f},
-std::array<float,2>{0.492228836f, 0.692406416f},
-std::array<float,2>{0.587760329f, 0.19632417f},
-std::array<float,2>{0.729572773f, 0.517887831f},
-std::array<float,2>{0.336931854f, 0.09701363f},
-std::array<float,2>{0.120070159f, 0.937518835f},
-std::array<float,2>{0.918885231f, 0.333533823f},
-std::array<float,2>{0.517603755f, 0.928992927f},
-std::array<float,2>{0.402303487f, 0.25054872f},
-std::array<float,2>{0.187630445f, 0.623091102f},
-std::array<float,2>{0.818305612f, 0.0609143004f},
-std::array<float,2>{0.945898294f, 0.631827295f},
-std::array<float,2>{0.0556609519f, 0.184662461f},
-std::array<float,2>{0.26831308f, 0.815589845f},
-std::array<float,2>{0.638512552f, 0.464910299f},
-std::array<float,2>{0.897752047f, 0.990911484f},
-std::array<float,2>{0.0923023745f, 0.357488185f},
-std::array<float,2>{0.366376698f, 0.534186304f},
-std::array<float,2>{0.688121796f, 0.0829357281f},
-std::array<float,2>{0.610259295f, 0.721702516f},
-std::array<float,2>{0.454526573f, 0.226077393f},
-std::array<float,2>{0.125613511f, 0.787764728f},
-std::array<float,2>{0.758612096f, 0.39012596f},
-std::array<float,2>{0.678431451f, 0.863646269f},
-std::array<float,2>{0.307982951f, 0.474092484f},
-std::array<float,2>{0.0223277584f, 0.683256745f},
-std::array<float,2>{0.979927778f, 0.149871051f},
-std::array<float,2>{0.871373057f, 0.59343195f},
-std::array<float,2>{0.248217106f, 0.0309410635f},
-std::array<float,2>{0.429280788f, 0.876697361f},
-std::array<float,2>{0.555659294f, 0.31028837f},
-std::array<float,2>{0.996280551f, 0.836178184f},
-std::array<float,2>{0.0117112901f, 0.450190574f},
-std::array<float,2>{0.293938011f, 0.646941423f},
-std::array<float,2>{0.669522464f, 0.160700664f},
-std::array<float,2>{0.538992226f, 0.602785826f},
-std::array<float,2>{0.420664489f, 0.0388273671f},
-std::array<float,2>{0.234372601f, 0.907974184f},
-std::array<float,2>{0.849189818f, 0.275957555f},
-std::array<float,2>{0.70707643f, 0.966073692f},
-std::array<float,2>{0.343950838f, 0.319670707f},
-std::array<float,2>{0.075294219f, 0.508106053f},
-std::array<float,2>{0.888557196f, 0.117157713f},
-std::array<float,2>{0.777088702f, 0.716556013f},
-std::array<float,2>{0.150376618f, 0.211696327f},
-std::array<float,2>{0.442498654f, 0.751149237f},
-std::array<float,2>{0.608910739f, 0.40646863f},
-std::array<float,2>{0.829414725f, 0.9051193f},
-std::array<float,2>{0.207814619f, 0.294868737f},
-std::array<float,2>{0.380550086f, 0.564880908f},
-std::array<float,2>{0.505131483f, 0.00728680706f},
-std::array<float,2>{0.641124904f, 0.67101562f},
-std::array<float,2>{0.250708759f, 0.130142391f},
-std::array<float,2>{0.0428825207f, 0.851124406f},
-std::array<float,2>{0.964642763f, 0.48867774f},
-std::array<float,2>{0.573057175f, 0.801142097f},
-std::array<float,2>{0.473219186f, 0.401873529f},
-std::array<float,2>{0.168512136f, 0.749872327f},
-std::array<float,2>{0.784662902f, 0.238712683f},
-std::array<float,2>{0.925314784f, 0.551387906f},
-std::array<float,2>{0.0997873396f, 0.0712533742f},
-std::array<float,2>{0.319444239f, 0.979692698f},
-std::array<float,2>{0.735013187f, 0.371094435f},
-std::array<float,2>{0.858749986f, 0.855559647f},
-std::array<float,2>{0.220815375f, 0.495728761f},
-std::array<float,2>{0.413316071f, 0.658514619f},
-std::array<float,2>{0.543172419f, 0.13661325f},
-std::array<float,2>{0.659313858f, 0.572633147f},
-std::array<float,2>{0.288655698f, 0.00831738021f},
-std::array<float,2>{0.00176003529f, 0.892572105f},
-std::array<float,2>{0.987748325f, 0.285387129f},
-std::array<float,2>{0.593873382f, 0.972797811f},
-std::array<float,2>{0.451635569f, 0.362994224f},
-std::array<float,2>{0.143324867f, 0.556869447f},
-std::array<float,2>{0.772918582f, 0.0674576834f},
-std::array<float,2>{0.882062256f, 0.734690666f},
-std::array<float,2>{0.0627835616f, 0.249042183f},
-std::array<float,2>{0.354010731f, 0.806875587f},
-std::array<float,2>{0.712302268f, 0.394567728f},
-std::array<float,2>{0.959051192f, 0.921092749f},
-std::array<float,2>{0.0362133384f, 0.269078165f},
-std::array<float,2>{0.260274231f, 0.596675456f},
-std::array<float,2>{0.652045131f, 0.0422611348f},
-std::array<float,2>{0.513579965f, 0.648755252f},
-std::array<float,2>{0.386753559f, 0.164684802f},
-std::array<float,2>{0.21802941f, 0.828519821f},
-std::array<float,2>{0.839782596f, 0.437696815f},
-std::array<float,2>{0.742830694f, 0.765586555f},
-std::array<float,2>{0.325072318f, 0.415763229f},
-std::array<float,2>{0.105777271f, 0.71052587f},
-std::array<float,2>{0.933161378f, 0.209788844f},
-std::array<float,2>{0.7938658f, 0.506448627f},
-std::array<float,2>{0.160881579f, 0.122591332f},
-std::array<float,2>{0.477208197f, 0.959112525f},
-std::array<float,2>{0.569503367f, 0.321494132f},
-std::array<float,2>{0.906912565f, 0.795875669f},
-std::array<float,2>{0.111919887f, 0.375932962f},
-std::array<float,2>{0.332220197f, 0.730817974f},
-std::array<float,2>{0.724063277f, 0.232693464f},
-std::array<float,2>{0.580884755f, 0.540791929f},
-std::array<float,2>{0.488560736f, 0.0919272751f},
-std::array<float,2>{0.186017662f, 0.998134434f},
-std::array<float,2>{0.79703337f, 0.345817387f},
-std::array<float,2>{0.630523264f, 0.88539964f},
-std::array<float,2>{0.273468614f, 0.298951f},
-std::array<float,2>{0.0511278324f, 0.579835415f},
-std::array<float,2>{0.939806759f, 0.0187587105f},
-std::array<float,2>{0.822507024f, 0.675564766f},
-std::array<float,2>{0.199206397f, 0.142987832f},
-std::array<float,2>{0.395044744f, 0.870575607f},
-std::array<float,2>{0.523959041f, 0.478969634f},
-std::array<float,2>{0.754212499f, 0.947038054f},
-std::array<float,2>{0.135117739f, 0.338301897f},
-std::array<float,2>{0.467866063f, 0.530156195f},
-std::array<float,2>{0.620266438f, 0.102199927f},
-std::array<float,2>{0.701160789f, 0.702065408f},
-std::array<float,2>{0.373573065f, 0.192347154f},
-std::array<float,2>{0.085265547f, 0.774564147f},
-std::array<float,2>{0.899793625f, 0.435435563f},
-std::array<float,2>{0.552525759f, 0.827540636f},
-std::array<float,2>{0.433729321f, 0.453807592f},
-std::array<float,2>{0.234445795f, 0.638901651f},
-std::array<float,2>{0.861738741f, 0.179451719f},
-std::array<float,2>{0.972923934f, 0.615965486f},
-std::array<float,2>{0.0256072935f, 0.0476305f},
-std::array<float,2>{0.29938361f, 0.932633817f},
-std::array<float,2>{0.681723177f, 0.258805782f},
-std::array<float,2>{0.768487871f, 0.817630231f},
-std::array<float,2>{0.146217227f, 0.463480741f},
-std::array<float,2>{0.446503788f, 0.626349151f},
-std::array<float,2>{0.599176407f, 0.183557451f},
-std::array<float,2>{0.717393219f, 0.62027061f},
-std::array<float,2>{0.356587261f, 0.0551180877f},
-std::array<float,2>{0.0668189675f, 0.923642039f},
-std::array<float,2>{0.876490831f, 0.254656076f},
-std::array<float,2>{0.542751014f, 0.944095135f},
-std::array<float,2>{0.406737208f, 0.331568241f},
-std::array<float,2>{0.223506629f, 0.522649705f},
-std::array<float,2>{0.85283798f, 0.0981391817f},
-std::array<float,2>{0.988634229f, 0.690273643f},
-std::array<float,2>{0.00430807844f, 0.200539842f},
-std::array<float,2>{0.283890992f, 0.770273507f},
-std::array<float,2>{0.663206935f, 0.424658358f},
-std::array<float,2>{0.935614944f, 0.879100204f},
-std::array<float,2>{0.103624724f, 0.304811954f},
-std::array<float,2>{0.3219212f, 0.585966945f},
-std::array<float,2>{0.749296486f, 0.0247450974f},
-std::array<float,2>{0.564881146f, 0.684452236f},
-std::array<float,2>{0.481571317f, 0.156037897f},
-std::array<float,2>{0.158781663f, 0.861355484f},
-std::array<float,2>{0.792705476f, 0.469453633f},
-std::array<float,2>{0.653359056f, 0.782758415f},
-std::array<float,2>{0.264622152f, 0.384002298f},
-std::array<float,2>{0.0347955674f, 0.722686231f},
-std::array<float,2>{0.954867363f, 0.221606538f},
-std::array<float,2>{0.842181742f, 0.538378417f},
-std::array<float,2>{0.213842079f, 0.0800476447f},
-std::array<float,2>{0.384119838f, 0.985466599f},
-std::array<float,2>{0.509706914f, 0.352880239f},
-std::array<float,2>{0.942136526f, 0.756313205f},
-std::array<float,2>{0.0502832197f, 0.414007515f},
-std::array<float,2>{0.277511716f, 0.714183092f},
-std::array<float,2>{0.625351727f, 0.217358515f},
-std::array<float,2>{0.527496338f, 0.511870742f},
-std::array<float,2>{0.390916586f, 0.111748829f},
-std::array<float,2>{0.202039629f, 0.962857008f},
-std::array<float,2>{0.82435137f, 0.3155756f},
-std::array<float,2>{0.721048951f, 0.914002299f},
-std::array<float,2>{0.331397206f, 0.279445469f},
-std::array<float,2>{0.115314193f, 0.605564237f},
-std::array<float,2>{0.913317204f, 0.0325510278f},
-std::array<float,2>{0.804318249f, 0.643531442f},
-std::array<float,2>{0.182474181f, 0.158232525f},
-std::array<float,2>{0.488222957f, 0.841400266f},
-std::array<float,2>{0.584465444f, 0.446865886f},
-std::array<float,2>{0.865068555f, 0.983156979f},
-std::array<float,2>{0.238440469f, 0.370428681f},
-std::array<float,2>{0.431876838f, 0.548080325f},
-std::array<float,2>{0.549856305f, 0.0763357207f},
-std::array<float,2>{0.685397923f, 0.743919313f},
-std::array<float,2>{0.301308423f, 0.236538962f},
-std::array<float,2>{0.028614983f, 0.798289239f},
-std::array<float,2>{0.970069826f, 0.405534953f},
-std::array<float,2>{0.622596443f, 0.844174027f},
-std::array<float,2>{0.46277532f, 0.486077875f},
-std::array<float,2>{0.139144495f, 0.667080641f},
-std::array<float,2>{0.753589988f, 0.127090752f},
-std::array<float,2>{0.902847767f, 0.569372654f},
-std::array<float,2>{0.0813620612f, 0.00125453947f},
-std::array<float,2>{0.370441467f, 0.899502277f},
-std::array<float,2>{0.696062982f, 0.290469408f},
-std::array<float,2>{0.814260662f, 0.810665965f},
-std::array<float,2>{0.191853061f, 0.392968833f},
-std::array<float,2>{0.402431786f, 0.740684986f},
-std::array<float,2>{0.520607114f, 0.244328067f},
-std::array<float,2>{0.636290193f, 0.559687972f},
-std::array<float,2>{0.272437602f, 0.065283753f},
-std::array<float,2>{0.0599246435f, 0.971540868f},
-std::array<float,2>{0.950010598f, 0.365142971f},
-std::array<float,2>{0.591858566f, 0.89545846f},
-std::array<float,2>{0.499637455f, 0.28160736f},
-std::array<float,2>{0.178440079f, 0.576071918f},
-std::array<float,2>{0.807665586f, 0.0139403204f},
-std::array<float,2>{0.916468501f, 0.662183166f},
-std::array<float,2>{0.122619011f, 0.140463755f},
-std::array<float,2>{0.340256095f, 0.854462266f},
-std::array<float,2>{0.730504155f, 0.496660471f},
-std::array<float,2>{0.981662214f, 0.955381155f},
-std::array<float,2>{0.0191755295f, 0.325060159f},
-std::array<float,2>{0.309471905f, 0.501942277f},
-std::array<float,2>{0.671989858f, 0.120689809f},
-std::array<float,2>{0.558660865f, 0.706840456f},
-std::array<float,2>{0.424463063f, 0.204235151f},
-std::array<float,2>{0.245303735f, 0.75908047f},
-std::array<float,2>{0.868791997f, 0.420417964f},
-std::array<float,2>{0.693190336f, 0.835106432f},
-std::array<float,2>{0.361444741f, 0.443889469f},
-std::array<float,2>{0.089693822f, 0.654714704f},
-std::array<float,2>{0.891514361f, 0.17059961f},
-std::array<float,2>{0.76507771f, 0.599937975f},
-std::array<float,2>{0.12923409f, 0.045220241f},
-std::array<float,2>{0.458001167f, 0.914980173f},
-std::array<float,2>{0.614718556f, 0.272516549f},
-std::array<float,2>{0.883647382f, 0.872963905f},
-std::array<float,2>{0.071159862f, 0.482669324f},
-std::array<float,2>{0.349315643f, 0.679284573f},
-std::array<float,2>{0.706167996f, 0.148236573f},
-std::array<float,2>{0.604695737f, 0.582285821f},
-std::array<float,2>{0.441259682f, 0.0201702341f},
-std::array<float,2>{0.155187219f, 0.888704658f},
-std::array<float,2>{0.778150797f, 0.304162264f},
-std::array<float,2>{0.666697562f, 0.995152295f},
-std::array<float,2>{0.290469766f, 0.349537849f},
-std::array<float,2>{0.0149954027f, 0.5464136f},
-std::array<float,2>{0.995494545f, 0.0885800868f},
-std::array<float,2>{0.845959365f, 0.729509711f},
-std::array<float,2>{0.228932604f, 0.229807839f},
-std::array<float,2>{0.417813599f, 0.78955543f},
-std::array<float,2>{0.532409489f, 0.379857421f},
-std::array<float,2>{0.78591305f, 0.934509277f},
-std::array<float,2>{0.164714262f, 0.263246715f},
-std::array<float,2>{0.471674591f, 0.609769106f},
-std::array<float,2>{0.575889051f, 0.0545850657f},
-std::array<float,2>{0.74058038f, 0.633096397f},
-std::array<float,2>{0.313614666f, 0.174459368f},
-std::array<float,2>{0.0956125855f, 0.824013412f},
-std::array<float,2>{0.927586854f, 0.458508819f},
-std::array<float,2>{0.503170013f, 0.778867781f},
-std::array<float,2>{0.378004521f, 0.43172133f},
-std::array<float,2>{0.203891799f, 0.695934892f},
-std::array<float,2>{0.833000422f, 0.190391615f},
-std::array<float,2>{0.967446208f, 0.526360452f},
-std::array<float,2>{0.0435158573f, 0.108483292f},
-std::array<float,2>{0.256907135f, 0.9501248f},
-std::array<float,2>{0.644657791f, 0.342264205f},
-std::array<float,2>{0.774610102f, 0.75071007f},
-std::array<float,2>{0.151148736f, 0.407824159f},
-std::array<float,2>{0.445056528f, 0.715255439f},
-std::array<float,2>{0.606563568f, 0.212706611f},
-std::array<float,2>{0.709201217f, 0.508818507f},
-std::array<float,2>{0.346001267f, 0.115880936f},
-std::array<float,2>{0.0771894306f, 0.965061963f},
-std::array<float,2>{0.890250325f, 0.31882897f},
-std::array<float,2>{0.536042571f, 0.90631485f},
-std::array<float,2>{0.418386132f, 0.276510656f},
-std::array<float,2>{0.232253313f, 0.602432609f},
-std::array<float,2>{0.85152179f, 0.0373246633f},
-std::array<float,2>{0.99899441f, 0.64803189f},
-std::array<float,2>{0.00813112687f, 0.162093848f},
-std::array<float,2>{0.296794534f, 0.83704567f},
-std::array<float,2>{0.670623064f, 0.451043338f},
-std::array<float,2>{0.922524214f, 0.979375005f},
-std::array<float,2>{0.099495098f, 0.372914404f},
-std::array<float,2>{0.31805855f, 0.552709699f},
-std::array<float,2>{0.73701781f, 0.0716759413f},
-std::array<float,2>{0.571861744f, 0.748614848f},
-std::array<float,2>{0.476190925f, 0.239580035f},
-std::array<float,2>{0.170389012f, 0.801831841f},
-std::array<float,2>{0.781550109f, 0.400836825f},
-std::array<float,2>{0.643917143f, 0.849840105f},
-std::array<float,2>{0.253693312f, 0.490014315f},
-std::array<float,2>{0.040863622f, 0.670005202f},
-std::array<float,2>{0.961334586f, 0.129443392f},
-std::array<float,2>{0.831430316f, 0.565902472f},
-std::array<float,2>{0.20943065f, 0.00591797661f},
-std::array<float,2>{0.38086924f, 0.905811727f},
-std::array<float,2>{0.506453872f, 0.293317229f},
-std::array<float,2>{0.948132157f, 0.814808011f},
-std::array<float,2>{0.0577851459f, 0.466490656f},
-std::array<float,2>{0.266206414f, 0.631919026f},
-std::array<float,2>{0.640527487f, 0.184512734f},
-std::array<float,2>{0.516154349f, 0.624034941f},
-std::array<float,2>{0.398635477f, 0.0621352717f},
-std::array<float,2>{0.191119969f, 0.928073108f},
-std::array<float,2>{0.818771482f, 0.251602858f},
-std::array<float,2>{0.727275431f, 0.938737571f},
-std::array<float,2>{0.339092016f, 0.332875788f},
-std::array<float,2>{0.118741386f, 0.519040942f},
-std::array<float,2>{0.92019254f, 0.0964063928f},
-std::array<float,2>{0.810972035f, 0.692024112f},
-std::array<float,2>{0.175244749f, 0.195783496f},
-std::array<float,2>{0.495633513f, 0.768704116f},
-std::array<float,2>{0.589356959f, 0.426385999f},
-std::array<float,2>{0.87451601f, 0.875405312f},
-std::array<float,2>{0.247196645f, 0.309066385f},
-std::array<float,2>{0.427457303f, 0.592445314f},
-std::array<float,2>{0.55676645f, 0.0299195144f},
-std::array<float,2>{0.676526189f, 0.681951761f},
-std::array<float,2>{0.305151194f, 0.149057508f},
-std::array<float,2>{0.0212954246f, 0.864942372f},
-std::array<float,2>{0.9768641f, 0.473371565f},
-std::array<float,2>{0.612446904f, 0.788648129f},
-std::array<float,2>{0.455321431f, 0.389293969f},
-std::array<float,2>{0.1278916f, 0.720783591f},
-std::array<float,2>{0.760656893f, 0.224831104f},
-std::array<float,2>{0.894631386f, 0.533831f},
-std::array<float,2>{0.0906514674f, 0.083755143f},
-std::array<float,2>{0.363543183f, 0.991513669f},
-std::array<float,2>{0.691282749f, 0.35870719f},
-std::array<float,2>{0.821470857f, 0.86988467f},
-std::array<float,2>{0.196736678f, 0.479911417f},
-std::array<float,2>{0.398126543f, 0.674464941f},
-std::array<float,2>{0.526403546f, 0.144356743f},
-std::array<float,2>{0.63103348f, 0.578646481f},
-std::array<float,2>{0.277313322f, 0.0182658639f},
-std::array<float,2>{0.0533067025f, 0.886381865f},
-std::array<float,2>{0.938464999f, 0.299918175f},
-std::array<float,2>{0.578909099f, 0.99955827f},
-std::array<float,2>{0.49102205f, 0.347565293f},
-std::array<float,2>{0.183778092f, 0.539107442f},
-std::array<float,2>{0.800413847f, 0.0936947837f},
-std::array<float,2>{0.90978682f, 0.731874645f},
-std::array<float,2>{0.109874576f, 0.233849898f},
-std::array<float,2>{0.335809767f, 0.796872675f},
-std::array<float,2>{0.725518525f, 0.376600266f},
-std::array<float,2>{0.976292133f, 0.932168245f},
-std::array<float,2>{0.0253338851f, 0.257858366f},
-std::array<float,2>{0.298406303f, 0.616889477f},
-std::array<float,2>{0.68154645f, 0.0479217023f},
-std::array<float,2>{0.553874314f, 0.639785647f},
-std::array<float,2>{0.437274307f, 0.178046927f},
-std::array<float,2>{0.237910494f, 0.826911092f},
-std::array<float,2>{0.860358f, 0.454847485f},
-std::array<float,2>{0.702527463f, 0.774318218f},
-std::array<float,2>{0.372330755f, 0.434142768f},
-std::array<float,2>{0.0832339972f, 0.703101695f},
-std::array<float,2>{0.901142776f, 0.193323016f},
-std::array<float,2>{0.756223142f, 0.530317545f},
-std::array<float,2>{0.134104088f, 0.10321635f},
-std::array<float,2>{0.465124905f, 0.946284175f},
-std::array<float,2>{0.618800759f, 0.339256704f},
-std::array<float,2>{0.879047513f, 0.80839628f},
-std::array<float,2>{0.0659855157f, 0.395761639f},
-std::array<float,2>{0.353247583f, 0.735556424f},
-std::array<float,2>{0.713652432f, 0.248495787f},
-std::array<float,2>{0.596226573f, 0.558238626f},
-std::array<float,2>{0.450936496f, 0.0666431412f},
-std::array<float,2>{0.142466918f, 0.974224627f},
-std::array<float,2>{0.770924747f, 0.361991227f},
-std::array<float,2>{0.656556964f, 0.891458333f},
-std::array<float,2>{0.286136985f, 0.2870408f},
-std::array<float,2>{0.00265323813f, 0.573534369f},
-std::array<float,2>{0.986290038f, 0.00899337512f},
-std::array<float,2>{0.856407046f, 0.659915924f},
-std::array<float,2>{0.219410881f, 0.13565883f},
-std::array<float,2>{0.411215156f, 0.857314348f},
-std::array<float,2>{0.546485066f, 0.494260758f},
-std::array<float,2>{0.795844615f, 0.960010409f},
-std::array<float,2>{0.163233012f, 0.320401192f},
-std::array<float,2>{0.479843944f, 0.507224917f},
-std::array<float,2>{0.567834735f, 0.121592321f},
-std::array<float,2>{0.746018648f, 0.709640503f},
-std::array<float,2>{0.327808112f, 0.210084826f},
-std::array<float,2>{0.108946845f, 0.764503241f},
-std::array<float,2>{0.930730283f, 0.414185643f},
-std::array<float,2>{0.514644742f, 0.829398096f},
-std::array<float,2>{0.389168948f, 0.438628614f},
-std::array<float,2>{0.214966729f, 0.649732053f},
-std::array<float,2>{0.837651253f, 0.165899947f},
-std::array<float,2>{0.957422078f, 0.597636819f},
-std::array<float,2>{0.0384947881f, 0.0411291309f},
-std::array<float,2>{0.258940756f, 0.92018348f},
-std::array<float,2>{0.650053144f, 0.267838687f},
-std::array<float,2>{0.801977694f, 0.840652823f},
-std::array<float,2>{0.180544555f, 0.44540903f},
-std::array<float,2>{0.485667169f, 0.64414525f},
-std::array<float,2>{0.58297348f, 0.159839243f},
-std::array<float,2>{0.720598161f, 0.60645324f},
-std::array<float,2>{0.329133749f, 0.0314667188f},
-std::array<float,2>{0.113629766f, 0.912489355f},
-std::array<float,2>{0.911058545f, 0.280295581f},
-std::array<float,2>{0.530394733f, 0.961028934f},
-std::array<float,2>{0.393212169f, 0.315066636f},
-std::array<float,2>{0.200446814f, 0.513264f},
-std::array<float,2>{0.826197386f, 0.112309396f},
-std::array<float,2>{0.94368732f, 0.713499784f},
-std::array<float,2>{0.047269728f, 0.218353808f},
-std::array<float,2>{0.280709177f, 0.757367909f},
-std::array<float,2>{0.626966774f, 0.412192017f},
-std::array<float,2>{0.904906929f, 0.898572564f},
-std::array<float,2>{0.0797610432f, 0.29000926f},
-std::array<float,2>{0.368703544f, 0.568461001f},
-std::array<float,2>{0.698308408f, 0.000943367137f},
-std::array<float,2>{0.624031901f, 0.666370988f},
-std::array<float,2>{0.464257628f, 0.128445148f},
-std::array<float,2>{0.137533739f, 0.845214069f},
-std::array<float,2>{0.75108856f, 0.484914541f},
-std::array<float,2>{0.686265051f, 0.797158599f},
-std::array<float,2>{0.304411054f, 0.404559642f},
-std::array<float,2>{0.0298515372f, 0.743094146f},
-std::array<float,2>{0.97165966f, 0.237505436f},
-std::array<float,2>{0.866540194f, 0.547396123f},
-std::array<float,2>{0.2415158f, 0.0777330101f},
-std::array<float,2>{0.431111604f, 0.98352921f},
-std::array<float,2>{0.547888935f, 0.369897127f},
-std::array<float,2>{0.990645647f, 0.771155894f},
-std::array<float,2>{0.00628282642f, 0.42517668f},
-std::array<float,2>{0.281826705f, 0.690755785f},
-std::array<float,2>{0.660394013f, 0.199572891f},
-std::array<float,2>{0.539788663f, 0.522000492f},
-std::array<float,2>{0.409898013f, 0.0987296402f},
-std::array<float,2>{0.225748435f, 0.945149601f},
-std::array<float,2>{0.854518294f, 0.330591828f},
-std::array<float,2>{0.715833545f, 0.922351778f},
-std::array<float,2>{0.359131545f, 0.255548179f},
-std::array<float,2>{0.0696340501f, 0.619540215f},
-std::array<float,2>{0.877820134f, 0.0559260696f},
-std::array<float,2>{0.766761124f, 0.625903904f},
-std::array<float,2>{0.146774516f, 0.181763113f},
-std::array<float,2>{0.447286129f, 0.817217827f},
-std::array<float,2>{0.600147307f, 0.463927507f},
-std::array<float,2>{0.841080785f, 0.985190153f},
-std::array<float,2>{0.21121192f, 0.351764143f},
-std::array<float,2>{0.385992378f, 0.537350237f},
-std::array<float,2>{0.509792805f, 0.0786578283f},
-std::array<float,2>{0.65504384f, 0.724100113f},
-std::array<float,2>{0.262982637f, 0.222082824f},
-std::array<float,2>{0.0324550979f, 0.78149879f},
-std::array<float,2>{0.955233455f, 0.383452833f},
-std::array<float,2>{0.564299643f, 0.862789392f},
-std::array<float,2>{0.483682573f, 0.469964385f},
-std::array<float,2>{0.157166019f, 0.684983313f},
-std::array<float,2>{0.790492356f, 0.15508616f},
-std::array<float,2>{0.935385048f, 0.587084591f},
-std::array<float,2>{0.102096364f, 0.0240289047f},
-std::array<float,2>{0.324116647f, 0.880796134f},
-std::array<float,2>{0.747363031f, 0.306050748f},
-std::array<float,2>{0.845085204f, 0.791000247f},
-std::array<float,2>{0.227033824f, 0.380710185f},
-std::array<float,2>{0.414918005f, 0.729213357f},
-std::array<float,2>{0.534360707f, 0.229112342f},
-std::array<float,2>{0.66534543f, 0.545456767f},
-std::array<float,2>{0.291775942f, 0.089774251f},
-std::array<float,2>{0.0134192426f, 0.994407594f},
-std::array<float,2>{0.99279362f, 0.348321617f},
-std::array<float,2>{0.601738632f, 0.89038825f},
-std::array<float,2>{0.437658846f, 0.303110331f},
-std::array<float,2>{0.15313679f, 0.583193839f},
-std::array<float,2>{0.781065583f, 0.0207342356f},
-std::array<float,2>{0.885934591f, 0.677908719f},
-std::array<float,2>{0.072636418f, 0.146647051f},
-std::array<float,2>{0.350212336f, 0.871293843f},
-std::array<float,2>{0.703537226f, 0.483578324f},
-std::array<float,2>{0.965617418f, 0.95068872f},
-std::array<float,2>{0.0463482924f, 0.343514353f},
-std::array<float,2>{0.255780071f, 0.527287841f},
-std::array<float,2>{0.64656055f, 0.108002782f},
-std::array<float,2>{0.500434577f, 0.696465969f},
-std::array<float,2>{0.376054078f, 0.190991282f},
-std::array<float,2>{0.206745133f, 0.777402878f},
-std::array<float,2>{0.834599137f, 0.433585137f},
-std::array<float,2>{0.739884257f, 0.823224425f},
-std::array<float,2>{0.315541893f, 0.457524329f},
-std::array<float,2>{0.0959158763f, 0.633928537f},
-std::array<float,2>{0.92953527f, 0.175683007f},
-std::array<float,2>{0.788141906f, 0.61083436f},
-std::array<float,2>{0.166856423f, 0.0533415489f},
-std::array<float,2>{0.46895799f, 0.935146034f},
-std::array<float,2>{0.577490151f, 0.261719018f},
-std::array<float,2>{0.916002929f, 0.855076194f},
-std::array<float,2>{0.12370342f, 0.497553051f},
-std::array<float,2>{0.341878057f, 0.66394043f},
-std::array<float,2>{0.733803988f, 0.139203534f},
-std::array<float,2>{0.591775656f, 0.575020492f},
-std::array<float,2>{0.496554703f, 0.0154383881f},
-std::array<float,2>{0.176854685f, 0.895553112f},
-std::array<float,2>{0.805348992f, 0.282959282f},
-std::array<float,2>{0.63414228f, 0.972173452f},
-std::array<float,2>{0.269559592f, 0.363574415f},
-std::array<float,2>{0.0608654059f, 0.558788538f},
-std::array<float,2>{0.952720702f, 0.0658464581f},
-std::array<float,2>{0.814527869f, 0.74202472f},
-std::array<float,2>{0.195139557f, 0.245245442f},
-std::array<float,2>{0.404949754f, 0.811953008f},
-std::array<float,2>{0.52304858f, 0.394488752f},
-std::array<float,2>{0.762319207f, 0.915237665f},
-std::array<float,2>{0.132794991f, 0.271694839f},
-std::array<float,2>{0.459891379f, 0.600607991f},
-std::array<float,2>{0.616512239f, 0.046574153f},
-std::array<float,2>{0.693981946f, 0.655852318f},
-std::array<float,2>{0.361040831f, 0.171647623f},
-std::array<float,2>{0.0859464556f, 0.834666193f},
-std::array<float,2>{0.893737257f, 0.444568574f},
-std::array<float,2>{0.561717272f, 0.758422554f},
-std::array<float,2>{0.422010958f, 0.421422988f},
-std::array<float,2>{0.243283346f, 0.70602268f},
-std::array<float,2>{0.871022403f, 0.203948781f},
-std::array<float,2>{0.983485579f, 0.500312507f},
-std::array<float,2>{0.0168435704f, 0.119478911f},
-std::array<float,2>{0.312120229f, 0.956248105f},
-std::array<float,2>{0.674282074f, 0.326071978f},
-std::array<float,2>{0.783710837f, 0.804617882f},
-std::array<float,2>{0.169790834f, 0.399717331f},
-std::array<float,2>{0.4737764f, 0.746437073f},
-std::array<float,2>{0.573498547f, 0.241590321f},
-std::array<float,2>{0.735622108f, 0.552810013f},
-std::array<float,2>{0.318698049f, 0.0734729096f},
-std::array<float,2>{0.101142168f, 0.97671175f},
-std::array<float,2>{0.924428225f, 0.373764455f},
-std::array<float,2>{0.50398767f, 0.902631819f},
-std::array<float,2>{0.379164129f, 0.296041101f},
-std::array<float,2>{0.208140045f, 0.562732041f},
-std::array<float,2>{0.828633666f, 0.00394387217f},
-std::array<float,2>{0.963622749f, 0.668315232f},
-std::array<float,2>{0.0411613248f, 0.132662922f},
-std::array<float,2>{0.251931578f, 0.847883463f},
-std::array<float,2>{0.6423949f, 0.491639733f},
-std::array<float,2>{0.887343943f, 0.967904329f},
-std::array<float,2>{0.075006038f, 0.317952514f},
-std::array<float,2>{0.345056802f, 0.510344207f},
-std::array<float,2>{0.708726823f, 0.114379682f},
-std::array<float,2>{0.608225763f, 0.717830539f},
-std::array<float,2>{0.44220382f, 0.214477792f},
-std::array<float,2>{0.148752183f, 0.753612041f},
-std::array<float,2>{0.776100516f, 0.408354253f},
-std::array<float,2>{0.668289304f, 0.839553237f},
-std::array<float,2>{0.294411659f, 0.451897234f},
-std::array<float,2>{0.0102533251f, 0.645796955f},
-std::array<float,2>{0.997100532f, 0.16292569f},
-std::array<float,2>{0.847965956f, 0.604588211f},
-std::array<float,2>{0.233275443f, 0.0356615521f},
-std::array<float,2>{0.421599627f, 0.910086036f},
-std::array<float,2>{0.537639678f, 0.275324881f},
-std::array<float,2>{0.978521049f, 0.866926312f},
-std::array<float,2>{0.0225228146f, 0.47552669f},
-std::array<float,2>{0.307503819f, 0.680095792f},
-std::array<float,2>{0.678845108f, 0.151660904f},
-std::array<float,2>{0.556141555f, 0.591440976f},
-std::array<float,2>{0.428330719f, 0.0290947519f},
-std::array<float,2>{0.249608219f, 0.877001643f},
-std::array<float,2>{0.872172892f, 0.311122388f},
-std::array<float,2>{0.689129591f, 0.98979789f},
-std::array<float,2>{0.365990847f, 0.35721913f},
-std::array<float,2>{0.0933976993f, 0.532357633f},
-std::array<float,2>{0.897367358f, 0.0850458294f},
-std::array<float,2>{0.759275496f, 0.719577074f},
-std::array<float,2>{0.126011923f, 0.223535046f},
-std::array<float,2>{0.453523546f, 0.785741389f},
-std::array<float,2>{0.610395551f, 0.387578011f},
-std::array<float,2>{0.816810131f, 0.925811887f},
-std::array<float,2>{0.188806802f, 0.252405673f},
-std::array<float,2>{0.401323467f, 0.621795833f},
-std::array<float,2>{0.519394934f, 0.0592820458f},
-std::array<float,2>{0.636745632f, 0.628960848f},
-std::array<float,2>{0.268995255f, 0.186094105f},
-std::array<float,2>{0.0558853075f, 0.814044952f},
-std::array<float,2>{0.947098076f, 0.467699558f},
-std::array<float,2>{0.586808085f, 0.765767574f},
-std::array<float,2>{0.494018704f, 0.428753346f},
-std::array<float,2>{0.172371328f, 0.693418443f},
-std::array<float,2>{0.808607519f, 0.1977088f},
-std::array<float,2>{0.919129372f, 0.516377091f},
-std::array<float,2>{0.120171644f, 0.0939884335f},
-std::array<float,2>{0.336241066f, 0.939722478f},
-std::array<float,2>{0.729255795f, 0.335629404f},
-std::array<float,2>{0.862733841f, 0.82569772f},
-std::array<float,2>{0.235834569f, 0.455371797f},
-std::array<float,2>{0.435076594f, 0.63752836f},
-std::array<float,2>{0.550783634f, 0.176491112f},
-std::array<float,2>{0.683145344f, 0.614116967f},
-std::array<float,2>{0.30002135f, 0.0501921587f},
-std::array<float,2>{0.02639593f, 0.930677295f},
-std::array<float,2>{0.974583387f, 0.259804487f},
-std::array<float,2>{0.620045662f, 0.9485358f},
-std::array<float,2>{0.467513591f, 0.336849153f},
-std::array<float,2>{0.135748848f, 0.529096782f},
-std::array<float,2>{0.75519532f, 0.103576764f},
-std::array<float,2>{0.898591697f, 0.700119197f},
-std::array<float,2>{0.0839913934f, 0.194095552f},
-std::array<float,2>{0.374053717f, 0.777132213f},
-std::array<float,2>{0.699620306f, 0.436047673f},
-std::array<float,2>{0.940587282f, 0.884406924f},
-std::array<float,2>{0.0517600663f, 0.297892481f},
-std::array<float,2>{0.274907351f, 0.581539154f},
-std::array<float,2>{0.629843652f, 0.0171309058f},
-std::array<float,2>{0.524492204f, 0.672356248f},
-std::array<float,2>{0.396191835f, 0.140687436f},
-std::array<float,2>{0.197915852f, 0.868190765f},
-std::array<float,2>{0.824213564f, 0.478280663f},
-std::array<float,2>{0.723403454f, 0.793907344f},
-std::array<float,2>{0.333973825f, 0.377692789f},
-std::array<float,2>{0.113161258f, 0.733012319f},
-std::array<float,2>{0.907497764f, 0.23206979f},
-std::array<float,2>{0.798147619f, 0.542416573f},
-std::array<float,2>{0.186723813f, 0.0915112942f},
-std::array<float,2>{0.490109235f, 0.997939706f},
-std::array<float,2>{0.581805646f, 0.344215661f},
-std::array<float,2>{0.931919098f, 0.762487769f},
-std::array<float,2>{0.107158415f, 0.417405695f},
-std::array<float,2>{0.325950861f, 0.707098722f},
-std::array<float,2>{0.74398905f, 0.208492011f},
-std::array<float,2>{0.568911254f, 0.503911078f},
-std::array<float,2>{0.477580667f, 0.123967148f},
-std::array<float,2>{0.161460266f, 0.957636714f},
-std::array<float,2>{0.793957651f, 0.32275638f},
-std::array<float,2>{0.65044564f, 0.919769049f},
-std::array<float,2>{0.261106879f, 0.265658766f},
-std::array<float,2>{0.0352067538f, 0.594168961f},
-std::array<float,2>{0.960685253f, 0.0392790511f},
-std::array<float,2>{0.838053405f, 0.650589347f},
-std::array<float,2>{0.217598453f, 0.166190311f},
-std::array<float,2>{0.387955427f, 0.830826223f},
-std::array<float,2>{0.512607276f, 0.440868855f},
-std::array<float,2>{0.77156508f, 0.975011408f},
-std::array<float,2>{0.144253924f, 0.360655099f},
-std::array<float,2>{0.45238328f, 0.555155694f},
-std::array<float,2>{0.595490932f, 0.0692717358f},
-std::array<float,2>{0.711791098f, 0.737355053f},
-std::array<float,2>{0.35497573f, 0.24785091f},
-std::array<float,2>{0.0636293218f, 0.806617141f},
-std::array<float,2>{0.881682038f, 0.398196906f},
-std::array<float,2>{0.544236839f, 0.857889831f},
-std::array<float,2>{0.412131578f, 0.493567646f},
-std::array<float,2>{0.22178413f, 0.657167494f},
-std::array<float,2>{0.857967556f, 0.133150324f},
-std::array<float,2>{0.986447453f, 0.571001351f},
-std::array<float,2>{0.000931375544f, 0.0112967081f},
-std::array<float,2>{0.287458122f, 0.894500017f},
-std::array<float,2>{0.658754349f, 0.287957311f},
-std::array<float,2>{0.752224267f, 0.846581101f},
-std::array<float,2>{0.139758617f, 0.487646192f},
-std::array<float,2>{0.461168587f, 0.664176881f},
-std::array<float,2>{0.62200284f, 0.125377581f},
-std::array<float,2>{0.697002172f, 0.567632437f},
-std::array<float,2>{0.369155467f, 0.00249869819f},
-std::array<float,2>{0.0801143721f, 0.902024865f},
-std::array<float,2>{0.903560281f, 0.292705536f},
-std::array<float,2>{0.549642086f, 0.980594814f},
-std::array<float,2>{0.433034033f, 0.368046761f},
-std::array<float,2>{0.240171835f, 0.549232304f},
-std::array<float,2>{0.864199817f, 0.0756190643f},
-std::array<float,2>{0.969068766f, 0.745174766f},
-std::array<float,2>{0.0274802335f, 0.236098424f},
-std::array<float,2>{0.302677721f, 0.800113082f},
-std::array<float,2>{0.684003949f, 0.403752595f},
-std::array<float,2>{0.912581027f, 0.91132015f},
-std::array<float,2>{0.116411664f, 0.278683782f},
-std::array<float,2>{0.330868721f, 0.607577741f},
-std::array<float,2>{0.722166598f, 0.0337553509f},
-std::array<float,2>{0.585737646f, 0.641212046f},
-std::array<float,2>{0.486898452f, 0.156480268f},
-std::array<float,2>{0.183563739f, 0.843014479f},
-std::array<float,2>{0.803005576f, 0.447582185f},
-std::array<float,2>{0.626371503f, 0.75560236f},
-std::array<float,2>{0.278758734f, 0.41192928f},
-std::array<float,2>{0.0490813106f, 0.711929858f},
-std::array<float,2>{0.943106413f, 0.215410709f},
-std::array<float,2>{0.825328171f, 0.514797091f},
-std::array<float,2>{0.202614084f, 0.111262783f},
-std::array<float,2>{0.392524898f, 0.963991642f},
-std::array<float,2>{0.528867424f, 0.314185172f},
-std::array<float,2>{0.954035759f, 0.783307016f},
-std::array<float,2>{0.0334384479f, 0.386216432f},
-std::array<float,2>{0.265449584f, 0.726343513f},
-std::array<float,2>{0.652851224f, 0.22023344f},
-std::array<float,2>{0.508258045f, 0.536759019f},
-std::array<float,2>{0.383391321f, 0.0815914199f},
-std::array<float,2>{0.213953376f, 0.988220751f},
-std::array<float,2>{0.843735814f, 0.354545832f},
-std::array<float,2>{0.748585403f, 0.880909562f},
-std::array<float,2>{0.320756346f, 0.307206362f},
-std::array<float,2>{0.105100416f, 0.589528739f},
-std::array<float,2>{0.936699688f, 0.0256543942f},
-std::array<float,2>{0.791707456f, 0.686873555f},
-std::array<float,2>{0.159480169f, 0.153300524f},
-std::array<float,2>{0.480506331f, 0.860510945f},
-std::array<float,2>{0.565597773f, 0.471757352f},
-std::array<float,2>{0.851613402f, 0.943167388f},
-std::array<float,2>{0.223847345f, 0.329611391f},
-std::array<float,2>{0.407762915f, 0.520757973f},
-std::array<float,2>{0.541822255f, 0.100710317f},
-std::array<float,2>{0.66261071f, 0.689168036f},
-std::array<float,2>{0.284467161f, 0.20262754f},
-std::array<float,2>{0.00577137945f, 0.77268821f},
-std::array<float,2>{0.98956418f, 0.4222565f},
-std::array<float,2>{0.597763062f, 0.819633245f},
-std::array<float,2>{0.445525914f, 0.462709278f},
-std::array<float,2>{0.144560382f, 0.628154874f},
-std::array<float,2>{0.7686041f, 0.181405187f},
-std::array<float,2>{0.875092328f, 0.618438959f},
-std::array<float,2>{0.0682476312f, 0.0576488003f},
-std::array<float,2>{0.355764329f, 0.925093174f},
-std::array<float,2>{0.717990041f, 0.256451279f},
-std::array<float,2>{0.83372283f, 0.780469418f},
-std::array<float,2>{0.204487354f, 0.429709375f},
-std::array<float,2>{0.377529442f, 0.698490739f},
-std::array<float,2>{0.502268016f, 0.189208701f},
-std::array<float,2>{0.645783365f, 0.523807466f},
-std::array<float,2>{0.25673148f, 0.106148414f},
-std::array<float,2>{0.0440507159f, 0.951598644f},
-std::array<float,2>{0.968521833f, 0.340886712f},
-std::array<float,2>{0.574290156f, 0.936597526f},
-std::array<float,2>{0.471989244f, 0.264659882f},
-std::array<float,2>{0.165115714f, 0.612221956f},
-std::array<float,2>{0.78628397f, 0.0513359644f},
-std::array<float,2>{0.926144838f, 0.634804845f},
-std::array<float,2>{0.0946246386f, 0.173305869f},
-std::array<float,2>{0.313200533f, 0.820664585f},
-std::array<float,2>{0.741748691f, 0.459842652f},
-std::array<float,2>{0.99458921f, 0.993655324f},
-std::array<float,2>{0.0146417143f, 0.350844651f},
-std::array<float,2>{0.289504439f, 0.543669462f},
-std::array<float,2>{0.667014241f, 0.0864581242f},
-std::array<float,2>{0.531998456f, 0.728092909f},
-std::array<float,2>{0.416295171f, 0.228348106f},
-std::array<float,2>{0.229514256f, 0.792804062f},
-std::array<float,2>{0.846800983f, 0.381307691f},
-std::array<float,2>{0.705907047f, 0.873509824f},
-std::array<float,2>{0.347980469f, 0.480773866f},
-std::array<float,2>{0.0713518187f, 0.67693305f},
-std::array<float,2>{0.8845312f, 0.144583061f},
-std::array<float,2>{0.779120028f, 0.584740043f},
-std::array<float,2>{0.155396476f, 0.0220519565f},
-std::array<float,2>{0.439481348f, 0.887892902f},
-std::array<float,2>{0.604444087f, 0.301104516f},
-std::array<float,2>{0.892376482f, 0.833971977f},
-std::array<float,2>{0.088209115f, 0.443261743f},
-std::array<float,2>{0.36237824f, 0.653119743f},
-std::array<float,2>{0.69171387f, 0.169262007f},
-std::array<float,2>{0.614226818f, 0.598567009f},
-std::array<float,2>{0.458772123f, 0.0434981883f},
-std::array<float,2>{0.130002961f, 0.917716682f},
-std::array<float,2>{0.764140606f, 0.270832032f},
-std::array<float,2>{0.672991037f, 0.953924775f},
-std::array<float,2>{0.310067981f, 0.32782799f},
-std::array<float,2>{0.0183494315f, 0.503503978f},
-std::array<float,2>{0.981152356f, 0.117524736f},
-std::array<float,2>{0.867540717f, 0.703897834f},
-std::array<float,2>{0.244991183f, 0.206229106f},
-std::array<float,2>{0.425300121f, 0.759924352f},
-std::array<float,2>{0.560003936f, 0.418648541f},
-std::array<float,2>{0.807234168f, 0.897585928f},
-std::array<float,2>{0.179391265f, 0.28323406f},
-std::array<float,2>{0.498054445f, 0.576368511f},
-std::array<float,2>{0.593464732f, 0.0130103463f},
-std::array<float,2>{0.731539369f, 0.660966337f},
-std::array<float,2>{0.34133938f, 0.136753276f},
-std::array<float,2>{0.121223681f, 0.85167402f},
-std::array<float,2>{0.917705655f, 0.499045163f},
-std::array<float,2>{0.520070612f, 0.809213698f},
-std::array<float,2>{0.404212564f, 0.390692443f},
-std::array<float,2>{0.19272919f, 0.739813387f},
-std::array<float,2>{0.8125633f, 0.243140593f},
-std::array<float,2>{0.950399637f, 0.561554551f},
-std::array<float,2>{0.0593503043f, 0.0641603395f},
-std::array<float,2>{0.272908121f, 0.970579028f},
-std::array<float,2>{0.634894431f, 0.365892917f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.452976197f, 0.441762388f},
-std::array<float,2>{0.891755223f, 0.714516163f},
-std::array<float,2>{0.165497914f, 0.751803458f},
-std::array<float,2>{0.546973288f, 0.246668771f},
-std::array<float,2>{0.0593763106f, 0.110402711f},
-std::array<float,2>{0.722831666f, 0.939159453f},
-std::array<float,2>{0.370964289f, 0.550195992f},
-std::array<float,2>{0.854475558f, 0.337920427f},
-std::array<float,2>{0.19624798f, 0.255900025f},
-std::array<float,2>{0.601205528f, 0.621531248f},
-std::array<float,2>{0.409998924f, 0.923870921f},
-std::array<float,2>{0.969738424f, 0.039205879f},
-std::array<float,2>{0.297794878f, 0.153756931f},
-std::array<float,2>{0.797951579f, 0.835431159f},
-std::array<float,2>{0.0724509358f, 0.638312876f},
-std::array<float,2>{0.652147472f, 0.431105077f},
-std::array<float,2>{0.337689251f, 0.371707022f},
-std::array<float,2>{0.829887331f, 0.503031731f},
-std::array<float,2>{0.00332181831f, 0.993848681f},
-std::array<float,2>{0.708045304f, 0.0641274005f},
-std::array<float,2>{0.14063707f, 0.210999981f},
-std::array<float,2>{0.52557677f, 0.793549299f},
-std::array<float,2>{0.499086171f, 0.733997285f},
-std::array<float,2>{0.934420049f, 0.473484665f},
-std::array<float,2>{0.104691826f, 0.385039657f},
-std::array<float,2>{0.67815727f, 0.659162223f},
-std::array<float,2>{0.253446817f, 0.85951376f},
-std::array<float,2>{0.751531422f, 0.158184171f},
-std::array<float,2>{0.38034454f, 0.0170957129f},
-std::array<float,2>{0.940271497f, 0.880809247f},
-std::array<float,2>{0.248599976f, 0.583523929f},
-std::array<float,2>{0.567687154f, 0.296489507f},
-std::array<float,2>{0.432661563f, 0.303528726f},
-std::array<float,2>{0.994639158f, 0.563047707f},
-std::array<float,2>{0.207081795f, 0.903048635f},
-std::array<float,2>{0.611970007f, 0.0143238371f},
-std::array<float,2>{0.0824230313f, 0.18353264f},
-std::array<float,2>{0.638248205f, 0.844190776f},
-std::array<float,2>{0.296121746f, 0.673853457f},
-std::array<float,2>{0.787563026f, 0.404132754f},
-std::array<float,2>{0.17697081f, 0.492115974f},
-std::array<float,2>{0.532477558f, 0.741918564f},
-std::array<float,2>{0.454248339f, 0.806956351f},
-std::array<float,2>{0.87537843f, 0.197185427f},
-std::array<float,2>{0.356513619f, 0.082619831f},
-std::array<float,2>{0.863437951f, 0.982306957f},
-std::array<float,2>{0.0334084369f, 0.530535996f},
-std::array<float,2>{0.74851805f, 0.348899722f},
-std::array<float,2>{0.266511589f, 0.408708662f},
-std::array<float,2>{0.769188702f, 0.645884871f},
-std::array<float,2>{0.119451463f, 0.825499535f},
-std::array<float,2>{0.660204589f, 0.129582107f},
-std::array<float,2>{0.225483045f, 0.0541552417f},
-std::array<float,2>{0.579423606f, 0.909717143f},
-std::array<float,2>{0.405543894f, 0.595279098f},
-std::array<float,2>{0.956952751f, 0.280928224f},
-std::array<float,2>{0.026887631f, 0.313805282f},
-std::array<float,2>{0.692399681f, 0.536308467f},
-std::array<float,2>{0.314337283f, 0.953973353f},
-std::array<float,2>{0.817098558f, 0.108072065f},
-std::array<float,2>{0.479284883f, 0.233872667f},
-std::array<float,2>{0.9084391f, 0.772846162f},
-std::array<float,2>{0.13837637f, 0.696186423f},
-std::array<float,2>{0.507405281f, 0.455903023f},
-std::array<float,2>{0.397015601f, 0.397041976f},
-std::array<float,2>{0.968120098f, 0.680878103f},
-std::array<float,2>{0.231944039f, 0.852020144f},
-std::array<float,2>{0.593602121f, 0.174566209f},
-std::array<float,2>{0.110977419f, 0.00417899666f},
-std::array<float,2>{0.664669394f, 0.891375065f},
-std::array<float,2>{0.278050154f, 0.573927581f},
-std::array<float,2>{0.779905975f, 0.310194701f},
-std::array<float,2>{0.128162831f, 0.357779145f},
-std::array<float,2>{0.51139605f, 0.519249678f},
-std::array<float,2>{0.474346995f, 0.975585818f},
-std::array<float,2>{0.916209579f, 0.0862336904f},
-std::array<float,2>{0.32435599f, 0.187610224f},
-std::array<float,2>{0.822252393f, 0.797431946f},
-std::array<float,2>{0.0189838093f, 0.74687016f},
-std::array<float,2>{0.702276587f, 0.499548256f},
-std::array<float,2>{0.282333791f, 0.266074777f},
-std::array<float,2>{0.7938748f, 0.601950109f},
-std::array<float,2>{0.0897804722f, 0.917253435f},
-std::array<float,2>{0.628114462f, 0.0591118149f},
-std::array<float,2>{0.217886448f, 0.134844393f},
-std::array<float,2>{0.622621596f, 0.817057967f},
-std::array<float,2>{0.427793115f, 0.653627276f},
-std::array<float,2>{0.988640606f, 0.417637259f},
-std::array<float,2>{0.0407824144f, 0.461644977f},
-std::array<float,2>{0.735492945f, 0.695283711f},
-std::array<float,2>{0.346885115f, 0.776349664f},
-std::array<float,2>{0.873534143f, 0.220835656f},
-std::array<float,2>{0.46689716f, 0.0964338258f},
-std::array<float,2>{0.889485955f, 0.963733971f},
-std::array<float,2>{0.185603365f, 0.542118311f},
-std::array<float,2>{0.543457985f, 0.320607543f},
-std::array<float,2>{0.490388721f, 0.335267574f},
-std::array<float,2>{0.924415946f, 0.557660401f},
-std::array<float,2>{0.151135564f, 0.950654864f},
-std::array<float,2>{0.515774965f, 0.120601393f},
-std::array<float,2>{0.0151956473f, 0.241862282f},
-std::array<float,2>{0.717796326f, 0.764949203f},
-std::array<float,2>{0.328587621f, 0.709677875f},
-std::array<float,2>{0.837057829f, 0.449644119f},
-std::array<float,2>{0.234559104f, 0.42923072f},
-std::array<float,2>{0.575583279f, 0.627510011f},
-std::array<float,2>{0.387470871f, 0.838637292f},
-std::array<float,2>{0.952911437f, 0.145576492f},
-std::array<float,2>{0.262346178f, 0.0328367464f},
-std::array<float,2>{0.761000156f, 0.933248281f},
-std::array<float,2>{0.0950150564f, 0.612183094f},
-std::array<float,2>{0.68317157f, 0.264333457f},
-std::array<float,2>{0.361607969f, 0.482972771f},
-std::array<float,2>{0.849896252f, 0.723441124f},
-std::array<float,2>{0.0487081669f, 0.784987271f},
-std::array<float,2>{0.728811383f, 0.209722638f},
-std::array<float,2>{0.161297128f, 0.07291013f},
-std::array<float,2>{0.555983543f, 0.991372526f},
-std::array<float,2>{0.440833807f, 0.512070119f},
-std::array<float,2>{0.902658105f, 0.361031979f},
-std::array<float,2>{0.0678120032f, 0.283841312f},
-std::array<float,2>{0.647299469f, 0.59353745f},
-std::array<float,2>{0.308384329f, 0.89035362f},
-std::array<float,2>{0.805796087f, 0.029884126f},
-std::array<float,2>{0.415274143f, 0.167692289f},
-std::array<float,2>{0.982821941f, 0.873965323f},
-std::array<float,2>{0.192738324f, 0.66865772f},
-std::array<float,2>{0.602427602f, 0.376736224f},
-std::array<float,2>{0.468789071f, 0.436064601f},
-std::array<float,2>{0.919720531f, 0.636563063f},
-std::array<float,2>{0.131813243f, 0.82836926f},
-std::array<float,2>{0.514960945f, 0.15007925f},
-std::array<float,2>{0.0198933408f, 0.0450404622f},
-std::array<float,2>{0.697237134f, 0.927673221f},
-std::array<float,2>{0.320492357f, 0.618561447f},
-std::array<float,2>{0.825888574f, 0.25207302f},
-std::array<float,2>{0.229654565f, 0.342263013f},
-std::array<float,2>{0.588553309f, 0.552634001f},
-std::array<float,2>{0.392429799f, 0.941959441f},
-std::array<float,2>{0.961526871f, 0.115524314f},
-std::array<float,2>{0.274016917f, 0.243354529f},
-std::array<float,2>{0.776291251f, 0.755917013f},
-std::array<float,2>{0.11704345f, 0.716544211f},
-std::array<float,2>{0.668292344f, 0.440325826f},
-std::array<float,2>{0.349830359f, 0.292545199f},
-std::array<float,2>{0.867210388f, 0.581373692f},
-std::array<float,2>{0.0439049825f, 0.878659368f},
-std::array<float,2>{0.739274383f, 0.0230060238f},
-std::array<float,2>{0.182214186f, 0.163167417f},
-std::array<float,2>{0.541117549f, 0.863980532f},
-std::array<float,2>{0.462971538f, 0.660694718f},
-std::array<float,2>{0.884834349f, 0.387279481f},
-std::array<float,2>{0.0901662484f, 0.469514698f},
-std::array<float,2>{0.630181909f, 0.72684139f},
-std::array<float,2>{0.28730908f, 0.792670965f},
-std::array<float,2>{0.789642096f, 0.216018364f},
-std::array<float,2>{0.424356103f, 0.0700130239f},
-std::array<float,2>{0.984706163f, 0.998204172f},
-std::array<float,2>{0.214588717f, 0.507026553f},
-std::array<float,2>{0.620652378f, 0.370850861f},
-std::array<float,2>{0.385916591f, 0.346312135f},
-std::array<float,2>{0.948663235f, 0.524529099f},
-std::array<float,2>{0.239879757f, 0.978388846f},
-std::array<float,2>{0.571213365f, 0.0787588581f},
-std::array<float,2>{0.0984822437f, 0.201657578f},
-std::array<float,2>{0.686705589f, 0.808920443f},
-std::array<float,2>{0.260881901f, 0.736701965f},
-std::array<float,2>{0.764247715f, 0.487646341f},
-std::array<float,2>{0.153440401f, 0.400388837f},
-std::array<float,2>{0.521180928f, 0.679589689f},
-std::array<float,2>{0.48711434f, 0.84936887f},
-std::array<float,2>{0.927022517f, 0.184279338f},
-std::array<float,2>{0.334793299f, 0.0102684228f},
-std::array<float,2>{0.841886103f, 0.900917411f},
-std::array<float,2>{0.00930369552f, 0.567321539f},
-std::array<float,2>{0.713414609f, 0.299173445f},
-std::array<float,2>{0.309840024f, 0.460751504f},
-std::array<float,2>{0.809047818f, 0.700520098f},
-std::array<float,2>{0.0653235912f, 0.768268287f},
-std::array<float,2>{0.642159164f, 0.228062391f},
-std::array<float,2>{0.191348046f, 0.10500557f},
-std::array<float,2>{0.606920123f, 0.959484398f},
-std::array<float,2>{0.421434045f, 0.534707069f},
-std::array<float,2>{0.980016708f, 0.318267703f},
-std::array<float,2>{0.051156234f, 0.273809463f},
-std::array<float,2>{0.732376039f, 0.59784323f},
-std::array<float,2>{0.363832414f, 0.911760449f},
-std::array<float,2>{0.847387373f, 0.0502309911f},
-std::array<float,2>{0.444957733f, 0.126791373f},
-std::array<float,2>{0.900611758f, 0.821796715f},
-std::array<float,2>{0.156799525f, 0.642775714f},
-std::array<float,2>{0.561161816f, 0.412132978f},
-std::array<float,2>{0.413382411f, 0.493540227f},
-std::array<float,2>{0.974284172f, 0.742569149f},
-std::array<float,2>{0.200361565f, 0.804285586f},
-std::array<float,2>{0.594057739f, 0.191715032f},
-std::array<float,2>{0.0754546374f, 0.0937479138f},
-std::array<float,2>{0.655109286f, 0.97081852f},
-std::array<float,2>{0.301070422f, 0.521428406f},
-std::array<float,2>{0.802851975f, 0.355033994f},
-std::array<float,2>{0.170954138f, 0.305873811f},
-std::array<float,2>{0.553398669f, 0.574418426f},
-std::array<float,2>{0.448879331f, 0.895171583f},
-std::array<float,2>{0.896800399f, 0.00345123815f},
-std::array<float,2>{0.37328279f, 0.17610164f},
-std::array<float,2>{0.855637908f, 0.855631292f},
-std::array<float,2>{0.0576882251f, 0.685996711f},
-std::array<float,2>{0.719311416f, 0.392626822f},
-std::array<float,2>{0.257014066f, 0.325377524f},
-std::array<float,2>{0.754112005f, 0.543825448f},
-std::array<float,2>{0.107805386f, 0.967984319f},
-std::array<float,2>{0.675255835f, 0.0982979611f},
-std::array<float,2>{0.244305357f, 0.222854733f},
-std::array<float,2>{0.566385269f, 0.777351797f},
-std::array<float,2>{0.378689885f, 0.689249396f},
-std::array<float,2>{0.941953838f, 0.468705982f},
-std::array<float,2>{0.00477108033f, 0.419941097f},
-std::array<float,2>{0.705371201f, 0.649120033f},
-std::array<float,2>{0.343286574f, 0.815048277f},
-std::array<float,2>{0.832241535f, 0.138956517f},
-std::array<float,2>{0.495693773f, 0.0560127944f},
-std::array<float,2>{0.93117398f, 0.918651819f},
-std::array<float,2>{0.146036685f, 0.608397245f},
-std::array<float,2>{0.531111777f, 0.272143334f},
-std::array<float,2>{0.45772168f, 0.259596795f},
-std::array<float,2>{0.880237222f, 0.615184367f},
-std::array<float,2>{0.173740402f, 0.937457919f},
-std::array<float,2>{0.538796246f, 0.03632259f},
-std::array<float,2>{0.0379311591f, 0.144228339f},
-std::array<float,2>{0.742496192f, 0.843732536f},
-std::array<float,2>{0.353165865f, 0.629405558f},
-std::array<float,2>{0.861387849f, 0.424208701f},
-std::array<float,2>{0.205488995f, 0.447116137f},
-std::array<float,2>{0.617063582f, 0.70619607f},
-std::array<float,2>{0.433757186f, 0.759478211f},
-std::array<float,2>{0.997351289f, 0.235655606f},
-std::array<float,2>{0.292106658f, 0.122688092f},
-std::array<float,2>{0.78483808f, 0.947080076f},
-std::array<float,2>{0.0788896009f, 0.561430156f},
-std::array<float,2>{0.635567427f, 0.331899434f},
-std::array<float,2>{0.319252312f, 0.380095601f},
-std::array<float,2>{0.81277293f, 0.665767431f},
-std::array<float,2>{0.0302684363f, 0.871024787f},
-std::array<float,2>{0.68998903f, 0.170426458f},
-std::array<float,2>{0.135786176f, 0.0258878805f},
-std::array<float,2>{0.503731906f, 0.883395135f},
-std::array<float,2>{0.484347016f, 0.588818789f},
-std::array<float,2>{0.911512494f, 0.286994487f},
-std::array<float,2>{0.121440969f, 0.36551109f},
-std::array<float,2>{0.658735812f, 0.507971525f},
-std::array<float,2>{0.27053389f, 0.985008955f},
-std::array<float,2>{0.771512806f, 0.07636372f},
-std::array<float,2>{0.399987191f, 0.204999402f},
-std::array<float,2>{0.959605455f, 0.785286307f},
-std::array<float,2>{0.21951282f, 0.719235599f},
-std::array<float,2>{0.58589536f, 0.477549046f},
-std::array<float,2>{0.496625602f, 0.475632519f},
-std::array<float,2>{0.935824752f, 0.732078314f},
-std::array<float,2>{0.143698633f, 0.796533883f},
-std::array<float,2>{0.523667216f, 0.214210525f},
-std::array<float,2>{0.000639923615f, 0.0654639304f},
-std::array<float,2>{0.710690558f, 0.994644403f},
-std::array<float,2>{0.338724464f, 0.500870585f},
-std::array<float,2>{0.830468476f, 0.373801589f},
-std::array<float,2>{0.246672586f, 0.294325292f},
-std::array<float,2>{0.568811297f, 0.58549881f},
-std::array<float,2>{0.381569922f, 0.881121397f},
-std::array<float,2>{0.938632965f, 0.0180569012f},
-std::array<float,2>{0.251087844f, 0.159371078f},
-std::array<float,2>{0.753795326f, 0.86295414f},
-std::array<float,2>{0.10237585f, 0.657698989f},
-std::array<float,2>{0.676586032f, 0.384334534f},
-std::array<float,2>{0.368756235f, 0.337560564f},
-std::array<float,2>{0.85269177f, 0.548022151f},
-std::array<float,2>{0.06104476f, 0.939988792f},
-std::array<float,2>{0.725905776f, 0.111571871f},
-std::array<float,2>{0.16771929f, 0.249561504f},
-std::array<float,2>{0.548884928f, 0.753154814f},
-std::array<float,2>{0.45089063f, 0.71103555f},
-std::array<float,2>{0.893447936f, 0.443426937f},
-std::array<float,2>{0.0711516067f, 0.433175445f},
-std::array<float,2>{0.648617744f, 0.639485061f},
-std::array<float,2>{0.298929691f, 0.833938777f},
-std::array<float,2>{0.800242543f, 0.1558332f},
-std::array<float,2>{0.407902151f, 0.0419505499f},
-std::array<float,2>{0.970791817f, 0.92326951f},
-std::array<float,2>{0.199162528f, 0.623813629f},
-std::array<float,2>{0.598380208f, 0.253962368f},
-std::array<float,2>{0.404107749f, 0.279213935f},
-std::array<float,2>{0.953214586f, 0.597058594f},
-std::array<float,2>{0.223520264f, 0.906478643f},
-std::array<float,2>{0.581528127f, 0.051455982f},
-std::array<float,2>{0.118496463f, 0.131190866f},
-std::array<float,2>{0.66345948f, 0.827404022f},
-std::array<float,2>{0.26820147f, 0.648433268f},
-std::array<float,2>{0.766863465f, 0.407920122f},
-std::array<float,2>{0.139148578f, 0.455052376f},
-std::array<float,2>{0.505036473f, 0.698071063f},
-std::array<float,2>{0.476564705f, 0.769960999f},
-std::array<float,2>{0.906808555f, 0.231082588f},
-std::array<float,2>{0.314678103f, 0.107096791f},
-std::array<float,2>{0.818919361f, 0.955534637f},
-std::array<float,2>{0.0241623912f, 0.538219869f},
-std::array<float,2>{0.693543017f, 0.316156685f},
-std::array<float,2>{0.293441743f, 0.405354947f},
-std::array<float,2>{0.786514699f, 0.673272967f},
-std::array<float,2>{0.084722355f, 0.847350895f},
-std::array<float,2>{0.640542209f, 0.181459382f},
-std::array<float,2>{0.209446132f, 0.0126984799f},
-std::array<float,2>{0.610520542f, 0.905104399f},
-std::array<float,2>{0.431491822f, 0.566184402f},
-std::array<float,2>{0.993064165f, 0.300861031f},
-std::array<float,2>{0.0322348885f, 0.350506127f},
-std::array<float,2>{0.74639982f, 0.528140068f},
-std::array<float,2>{0.357571274f, 0.983673215f},
-std::array<float,2>{0.865382791f, 0.0848204792f},
-std::array<float,2>{0.456230223f, 0.198383749f},
-std::array<float,2>{0.877527535f, 0.805865407f},
-std::array<float,2>{0.178252369f, 0.738317251f},
-std::array<float,2>{0.533513308f, 0.490137696f},
-std::array<float,2>{0.427330554f, 0.414921016f},
-std::array<float,2>{0.991320729f, 0.655172944f},
-std::array<float,2>{0.216702551f, 0.818607211f},
-std::array<float,2>{0.623913407f, 0.133876011f},
-std::array<float,2>{0.0876218155f, 0.0607481375f},
-std::array<float,2>{0.625707865f, 0.915594399f},
-std::array<float,2>{0.283230752f, 0.605434179f},
-std::array<float,2>{0.795917869f, 0.269307107f},
-std::array<float,2>{0.185512155f, 0.322266012f},
-std::array<float,2>{0.545398355f, 0.540154636f},
-std::array<float,2>{0.465787917f, 0.961193383f},
-std::array<float,2>{0.88679719f, 0.0956690013f},
-std::array<float,2>{0.344824791f, 0.220671698f},
-std::array<float,2>{0.871576905f, 0.774011672f},
-std::array<float,2>{0.0419950411f, 0.69327122f},
-std::array<float,2>{0.737006545f, 0.464645743f},
-std::array<float,2>{0.280491799f, 0.311023295f},
-std::array<float,2>{0.778345764f, 0.571353912f},
-std::array<float,2>{0.112769715f, 0.893785834f},
-std::array<float,2>{0.666418374f, 0.00746865571f},
-std::array<float,2>{0.23360002f, 0.172167614f},
-std::array<float,2>{0.591394722f, 0.8549155f},
-std::array<float,2>{0.395361215f, 0.681867123f},
-std::array<float,2>{0.965066433f, 0.395485729f},
-std::array<float,2>{0.0157242678f, 0.496567845f},
-std::array<float,2>{0.699654579f, 0.749695897f},
-std::array<float,2>{0.327509552f, 0.800323725f},
-std::array<float,2>{0.823687375f, 0.191195443f},
-std::array<float,2>{0.474664986f, 0.0880563036f},
-std::array<float,2>{0.91429013f, 0.973365545f},
-std::array<float,2>{0.126042932f, 0.516881585f},
-std::array<float,2>{0.508493125f, 0.357275307f},
-std::array<float,2>{0.439305574f, 0.361612231f},
-std::array<float,2>{0.905346394f, 0.513938963f},
-std::array<float,2>{0.163015768f, 0.989279509f},
-std::array<float,2>{0.558088899f, 0.0713527277f},
-std::array<float,2>{0.0492714606f, 0.207406193f},
-std::array<float,2>{0.727998793f, 0.781756818f},
-std::array<float,2>{0.360081613f, 0.725669205f},
-std::array<float,2>{0.849135995f, 0.481384516f},
-std::array<float,2>{0.194166034f, 0.37831223f},
-std::array<float,2>{0.604230464f, 0.67132163f},
-std::array<float,2>{0.416755468f, 0.871456027f},
-std::array<float,2>{0.981116593f, 0.164645672f},
-std::array<float,2>{0.30487138f, 0.0280003548f},
-std::array<float,2>{0.808237493f, 0.888293445f},
-std::array<float,2>{0.0686345845f, 0.591315389f},
-std::array<float,2>{0.645192385f, 0.282703191f},
-std::array<float,2>{0.331881255f, 0.451684088f},
-std::array<float,2>{0.838463426f, 0.7080338f},
-std::array<float,2>{0.013361631f, 0.76212126f},
-std::array<float,2>{0.716433346f, 0.239704236f},
-std::array<float,2>{0.149436831f, 0.117580526f},
-std::array<float,2>{0.519299209f, 0.953120112f},
-std::array<float,2>{0.489710212f, 0.555500507f},
-std::array<float,2>{0.923518002f, 0.333787411f},
-std::array<float,2>{0.0965389684f, 0.261858046f},
-std::array<float,2>{0.680987954f, 0.610564888f},
-std::array<float,2>{0.264352202f, 0.930206597f},
-std::array<float,2>{0.75901705f, 0.0349152908f},
-std::array<float,2>{0.38907215f, 0.147442117f},
-std::array<float,2>{0.951061666f, 0.83696866f},
-std::array<float,2>{0.237373307f, 0.625935435f},
-std::array<float,2>{0.577433228f, 0.426126689f},
-std::array<float,2>{0.462347388f, 0.388794571f},
-std::array<float,2>{0.884080231f, 0.662564576f},
-std::array<float,2>{0.18132998f, 0.866379797f},
-std::array<float,2>{0.540494204f, 0.161474869f},
-std::array<float,2>{0.0466292091f, 0.0201394483f},
-std::array<float,2>{0.740621984f, 0.876330018f},
-std::array<float,2>{0.347691655f, 0.578473508f},
-std::array<float,2>{0.87011534f, 0.290235192f},
-std::array<float,2>{0.212469503f, 0.367201418f},
-std::array<float,2>{0.617773414f, 0.505090475f},
-std::array<float,2>{0.422123998f, 0.996152878f},
-std::array<float,2>{0.987018347f, 0.0677559599f},
-std::array<float,2>{0.28596428f, 0.217422217f},
-std::array<float,2>{0.791234791f, 0.789340317f},
-std::array<float,2>{0.0927295759f, 0.730316699f},
-std::array<float,2>{0.632300198f, 0.471312732f},
-std::array<float,2>{0.32361716f, 0.251639724f},
-std::array<float,2>{0.827998281f, 0.621027231f},
-std::array<float,2>{0.0233699102f, 0.928003728f},
-std::array<float,2>{0.698848486f, 0.0435110219f},
-std::array<float,2>{0.128913715f, 0.151392192f},
-std::array<float,2>{0.512034416f, 0.83139056f},
-std::array<float,2>{0.470768809f, 0.633665323f},
-std::array<float,2>{0.920328856f, 0.435174137f},
-std::array<float,2>{0.11440549f, 0.437911928f},
-std::array<float,2>{0.670914412f, 0.717289805f},
-std::array<float,2>{0.276780903f, 0.755280316f},
-std::array<float,2>{0.773881495f, 0.244563356f},
-std::array<float,2>{0.394222796f, 0.113453478f},
-std::array<float,2>{0.963818073f, 0.943691015f},
-std::array<float,2>{0.227886394f, 0.552852452f},
-std::array<float,2>{0.58673805f, 0.340119272f},
-std::array<float,2>{0.418139398f, 0.318433106f},
-std::array<float,2>{0.977248013f, 0.53268826f},
-std::array<float,2>{0.189367846f, 0.958827794f},
-std::array<float,2>{0.608661354f, 0.103190154f},
-std::array<float,2>{0.064410992f, 0.229065537f},
-std::array<float,2>{0.643995583f, 0.766301751f},
-std::array<float,2>{0.312054724f, 0.702786744f},
-std::array<float,2>{0.810870647f, 0.458306283f},
-std::array<float,2>{0.15905261f, 0.410383552f},
-std::array<float,2>{0.55962944f, 0.641439438f},
-std::array<float,2>{0.442187041f, 0.822956681f},
-std::array<float,2>{0.899353445f, 0.127378792f},
-std::array<float,2>{0.366693646f, 0.0484165847f},
-std::array<float,2>{0.844515204f, 0.912782431f},
-std::array<float,2>{0.0528254844f, 0.599859953f},
-std::array<float,2>{0.734250188f, 0.276087135f},
-std::array<float,2>{0.25904417f, 0.484437674f},
-std::array<float,2>{0.762998343f, 0.735947132f},
-std::array<float,2>{0.100216471f, 0.812071919f},
-std::array<float,2>{0.683616281f, 0.200950176f},
-std::array<float,2>{0.240927309f, 0.0801919848f},
-std::array<float,2>{0.572379768f, 0.979779243f},
-std::array<float,2>{0.384296536f, 0.525525093f},
-std::array<float,2>{0.945879877f, 0.345117539f},
-std::array<float,2>{0.0112134172f, 0.298107654f},
-std::array<float,2>{0.711682975f, 0.56959933f},
-std::array<float,2>{0.333132684f, 0.899412572f},
-std::array<float,2>{0.840984523f, 0.0087059699f},
-std::array<float,2>{0.484802097f, 0.186336115f},
-std::array<float,2>{0.927884221f, 0.849891663f},
-std::array<float,2>{0.155815572f, 0.676033735f},
-std::array<float,2>{0.52150631f, 0.401963502f},
-std::array<float,2>{0.375636518f, 0.464935124f},
-std::array<float,2>{0.945086002f, 0.690994918f},
-std::array<float,2>{0.243385941f, 0.780071259f},
-std::array<float,2>{0.563279569f, 0.226064742f},
-std::array<float,2>{0.105810188f, 0.100181721f},
-std::array<float,2>{0.67239362f, 0.966496766f},
-std::array<float,2>{0.254188746f, 0.545602322f},
-std::array<float,2>{0.756203771f, 0.327418029f},
-std::array<float,2>{0.147215873f, 0.269913614f},
-std::array<float,2>{0.527366698f, 0.605758727f},
-std::array<float,2>{0.493761063f, 0.920934439f},
-std::array<float,2>{0.932828128f, 0.0581802651f},
-std::array<float,2>{0.34172985f, 0.137624726f},
-std::array<float,2>{0.835635543f, 0.812709093f},
-std::array<float,2>{0.00753466552f, 0.65072155f},
-std::array<float,2>{0.704060376f, 0.418803155f},
-std::array<float,2>{0.30375433f, 0.352180958f},
-std::array<float,2>{0.802663922f, 0.522230506f},
-std::array<float,2>{0.0765370354f, 0.969064534f},
-std::array<float,2>{0.653549135f, 0.0909304395f},
-std::array<float,2>{0.202358499f, 0.194500804f},
-std::array<float,2>{0.595878065f, 0.802256525f},
-std::array<float,2>{0.41146633f, 0.744907498f},
-std::array<float,2>{0.974695504f, 0.495932639f},
-std::array<float,2>{0.0555852056f, 0.390912414f},
-std::array<float,2>{0.721441865f, 0.684312642f},
-std::array<float,2>{0.372290671f, 0.85781914f},
-std::array<float,2>{0.859042227f, 0.177772194f},
-std::array<float,2>{0.446591735f, 0.000132646892f},
-std::array<float,2>{0.895295739f, 0.898251712f},
-std::array<float,2>{0.168707341f, 0.577301562f},
-std::array<float,2>{0.552577555f, 0.308131069f},
-std::array<float,2>{0.48228696f, 0.288897991f},
-std::array<float,2>{0.913826644f, 0.587461531f},
-std::array<float,2>{0.132925987f, 0.886534512f},
-std::array<float,2>{0.50023216f, 0.0238730703f},
-std::array<float,2>{0.0290073231f, 0.169066906f},
-std::array<float,2>{0.688207865f, 0.868666232f},
-std::array<float,2>{0.31779772f, 0.667739153f},
-std::array<float,2>{0.814474285f, 0.382475674f},
-std::array<float,2>{0.220766976f, 0.480392486f},
-std::array<float,2>{0.583255708f, 0.721396685f},
-std::array<float,2>{0.402068496f, 0.787332475f},
-std::array<float,2>{0.958694577f, 0.206683084f},
-std::array<float,2>{0.273222595f, 0.0754554942f},
-std::array<float,2>{0.76971823f, 0.986556113f},
-std::array<float,2>{0.123616897f, 0.509843111f},
-std::array<float,2>{0.657446146f, 0.363615543f},
-std::array<float,2>{0.355337888f, 0.423308283f},
-std::array<float,2>{0.860155463f, 0.631871581f},
-std::array<float,2>{0.0365973115f, 0.840906501f},
-std::array<float,2>{0.745305777f, 0.141107067f},
-std::array<float,2>{0.174582347f, 0.0372455679f},
-std::array<float,2>{0.535906434f, 0.935282409f},
-std::array<float,2>{0.460362941f, 0.616738677f},
-std::array<float,2>{0.881232321f, 0.259930253f},
-std::array<float,2>{0.0805822983f, 0.329942793f},
-std::array<float,2>{0.634315908f, 0.559525609f},
-std::array<float,2>{0.290892601f, 0.948755085f},
-std::array<float,2>{0.782176018f, 0.123654492f},
-std::array<float,2>{0.436388195f, 0.236884728f},
-std::array<float,2>{0.998734534f, 0.760867596f},
-std::array<float,2>{0.203204885f, 0.704679072f},
-std::array<float,2>{0.61474824f, 0.447396457f},
-std::array<float,2>{0.478265882f, 0.456401467f},
-std::array<float,2>{0.908124506f, 0.696508586f},
-std::array<float,2>{0.139740452f, 0.771587729f},
-std::array<float,2>{0.503964841f, 0.233107641f},
-std::array<float,2>{0.0252592433f, 0.109058298f},
-std::array<float,2>{0.694707811f, 0.954671204f},
-std::array<float,2>{0.315743774f, 0.535162687f},
-std::array<float,2>{0.819429398f, 0.31273526f},
-std::array<float,2>{0.22377789f, 0.279934973f},
-std::array<float,2>{0.580962121f, 0.594275594f},
-std::array<float,2>{0.403274477f, 0.908356667f},
-std::array<float,2>{0.954469144f, 0.0536075085f},
-std::array<float,2>{0.268601656f, 0.130200297f},
-std::array<float,2>{0.766075671f, 0.824723065f},
-std::array<float,2>{0.117741562f, 0.645310104f},
-std::array<float,2>{0.662439227f, 0.409379274f},
-std::array<float,2>{0.358497947f, 0.348380059f},
-std::array<float,2>{0.866858959f, 0.529391766f},
-std::array<float,2>{0.0317548998f, 0.980754614f},
-std::array<float,2>{0.74738884f, 0.0836343393f},
-std::array<float,2>{0.178796828f, 0.196155399f},
-std::array<float,2>{0.534769833f, 0.808068693f},
-std::array<float,2>{0.455105692f, 0.740289748f},
-std::array<float,2>{0.878823161f, 0.490526289f},
-std::array<float,2>{0.0857702345f, 0.402829379f},
-std::array<float,2>{0.639024854f, 0.675188363f},
-std::array<float,2>{0.294397354f, 0.845533788f},
-std::array<float,2>{0.78527993f, 0.182204992f},
-std::array<float,2>{0.429855794f, 0.0147320079f},
-std::array<float,2>{0.993975878f, 0.903575182f},
-std::array<float,2>{0.210612521f, 0.563881159f},
-std::array<float,2>{0.610264063f, 0.303832084f},
-std::array<float,2>{0.382514864f, 0.295549065f},
-std::array<float,2>{0.938401163f, 0.58231014f},
-std::array<float,2>{0.247944385f, 0.879776299f},
-std::array<float,2>{0.570265234f, 0.0164934956f},
-std::array<float,2>{0.103354149f, 0.157225803f},
-std::array<float,2>{0.677313149f, 0.860435009f},
-std::array<float,2>{0.250902891f, 0.659555912f},
-std::array<float,2>{0.752880692f, 0.386158377f},
-std::array<float,2>{0.143034413f, 0.473641306f},
-std::array<float,2>{0.524414659f, 0.732652664f},
-std::array<float,2>{0.497071773f, 0.793987453f},
-std::array<float,2>{0.936570466f, 0.212366298f},
-std::array<float,2>{0.338947058f, 0.0627204031f},
-std::array<float,2>{0.831431746f, 0.993100166f},
-std::array<float,2>{0.00150078302f, 0.502225399f},
-std::array<float,2>{0.709102631f, 0.372489691f},
-std::array<float,2>{0.300138533f, 0.430554688f},
-std::array<float,2>{0.799758017f, 0.636804521f},
-std::array<float,2>{0.0719324052f, 0.83428663f},
-std::array<float,2>{0.649847627f, 0.15329428f},
-std::array<float,2>{0.197333112f, 0.0407588705f},
-std::array<float,2>{0.599037826f, 0.925082088f},
-std::array<float,2>{0.406895638f, 0.622287214f},
-std::array<float,2>{0.972078264f, 0.257743418f},
-std::array<float,2>{0.0618888587f, 0.339235365f},
-std::array<float,2>{0.725097179f, 0.548964798f},
-std::array<float,2>{0.367459983f, 0.938254416f},
-std::array<float,2>{0.852504611f, 0.110268831f},
-std::array<float,2>{0.449231029f, 0.247959003f},
-std::array<float,2>{0.894290209f, 0.750591934f},
-std::array<float,2>{0.166217804f, 0.71304512f},
-std::array<float,2>{0.550348997f, 0.442737997f},
-std::array<float,2>{0.417743593f, 0.375121027f},
-std::array<float,2>{0.981558263f, 0.669016004f},
-std::array<float,2>{0.194799498f, 0.874249816f},
-std::array<float,2>{0.60514611f, 0.166199341f},
-std::array<float,2>{0.0695280358f, 0.0305534136f},
-std::array<float,2>{0.646471977f, 0.889514148f},
-std::array<float,2>{0.306620866f, 0.592727423f},
-std::array<float,2>{0.807097673f, 0.285125077f},
-std::array<float,2>{0.163747907f, 0.360267699f},
-std::array<float,2>{0.557281196f, 0.513268352f},
-std::array<float,2>{0.438369066f, 0.990549862f},
-std::array<float,2>{0.905237019f, 0.0735756755f},
-std::array<float,2>{0.36088109f, 0.210378721f},
-std::array<float,2>{0.847854257f, 0.783882141f},
-std::array<float,2>{0.0504320227f, 0.724455655f},
-std::array<float,2>{0.726678014f, 0.484287858f},
-std::array<float,2>{0.264895797f, 0.264831036f},
-std::array<float,2>{0.758179843f, 0.612988055f},
-std::array<float,2>{0.0975302979f, 0.931735575f},
-std::array<float,2>{0.680367231f, 0.0319695286f},
-std::array<float,2>{0.236657381f, 0.145197958f},
-std::array<float,2>{0.57704401f, 0.839660943f},
-std::array<float,2>{0.389979869f, 0.628191948f},
-std::array<float,2>{0.949569762f, 0.428205818f},
-std::array<float,2>{0.0121913096f, 0.450484931f},
-std::array<float,2>{0.714937091f, 0.710399151f},
-std::array<float,2>{0.330370337f, 0.764502466f},
-std::array<float,2>{0.839619279f, 0.240707755f},
-std::array<float,2>{0.489163876f, 0.119559206f},
-std::array<float,2>{0.922660112f, 0.949971318f},
-std::array<float,2>{0.1484534f, 0.556747198f},
-std::array<float,2>{0.518184066f, 0.334775686f},
-std::array<float,2>{0.466451019f, 0.322219729f},
-std::array<float,2>{0.887699366f, 0.541041076f},
-std::array<float,2>{0.184129655f, 0.96390295f},
-std::array<float,2>{0.546767533f, 0.0970306173f},
-std::array<float,2>{0.0415556617f, 0.221866295f},
-std::array<float,2>{0.737566292f, 0.776553214f},
-std::array<float,2>{0.344463646f, 0.694279671f},
-std::array<float,2>{0.872463107f, 0.46204412f},
-std::array<float,2>{0.21556811f, 0.416106731f},
-std::array<float,2>{0.624484479f, 0.652785182f},
-std::array<float,2>{0.426133692f, 0.817848086f},
-std::array<float,2>{0.990912318f, 0.136520207f},
-std::array<float,2>{0.284379333f, 0.0599869788f},
-std::array<float,2>{0.795203269f, 0.916211724f},
-std::array<float,2>{0.0860734358f, 0.603009522f},
-std::array<float,2>{0.626940548f, 0.266744375f},
-std::array<float,2>{0.32666716f, 0.498778492f},
-std::array<float,2>{0.823035717f, 0.747640491f},
-std::array<float,2>{0.0173653588f, 0.79823333f},
-std::array<float,2>{0.700867295f, 0.189130157f},
-std::array<float,2>{0.125305772f, 0.0871162862f},
-std::array<float,2>{0.509529829f, 0.976038575f},
-std::array<float,2>{0.476215571f, 0.517983675f},
-std::array<float,2>{0.915459037f, 0.359055549f},
-std::array<float,2>{0.111971483f, 0.309245378f},
-std::array<float,2>{0.66777873f, 0.573055744f},
-std::array<float,2>{0.27982533f, 0.891798615f},
-std::array<float,2>{0.777606726f, 0.00548074162f},
-std::array<float,2>{0.395913333f, 0.175005108f},
-std::array<float,2>{0.966368139f, 0.852716148f},
-std::array<float,2>{0.233331874f, 0.679700255f},
-std::array<float,2>{0.590506911f, 0.397924781f},
-std::array<float,2>{0.4429726f, 0.413124979f},
-std::array<float,2>{0.900057375f, 0.643851221f},
-std::array<float,2>{0.160138205f, 0.821136951f},
-std::array<float,2>{0.559167087f, 0.125664875f},
-std::array<float,2>{0.0544342585f, 0.0492722169f},
-std::array<float,2>{0.733081043f, 0.911130846f},
-std::array<float,2>{0.365308315f, 0.599496067f},
-std::array<float,2>{0.845130742f, 0.274835259f},
-std::array<float,2>{0.188002989f, 0.317004502f},
-std::array<float,2>{0.608113468f, 0.53338629f},
-std::array<float,2>{0.419743299f, 0.96083045f},
-std::array<float,2>{0.977752566f, 0.103813507f},
-std::array<float,2>{0.310955703f, 0.227309749f},
-std::array<float,2>{0.811775446f, 0.769260287f},
-std::array<float,2>{0.0627164915f, 0.699688077f},
-std::array<float,2>{0.642744482f, 0.459734082f},
-std::array<float,2>{0.332543969f, 0.300450981f},
-std::array<float,2>{0.840128899f, 0.568295956f},
-std::array<float,2>{0.0106812362f, 0.901842594f},
-std::array<float,2>{0.712858081f, 0.0114043094f},
-std::array<float,2>{0.155225128f, 0.185528517f},
-std::array<float,2>{0.522839665f, 0.848058522f},
-std::array<float,2>{0.486055195f, 0.678687751f},
-std::array<float,2>{0.928742409f, 0.399255395f},
-std::array<float,2>{0.101303108f, 0.48704496f},
-std::array<float,2>{0.685116172f, 0.737333059f},
-std::array<float,2>{0.258626968f, 0.809945762f},
-std::array<float,2>{0.762593389f, 0.202294245f},
-std::array<float,2>{0.383737236f, 0.0800022408f},
-std::array<float,2>{0.94634223f, 0.977077663f},
-std::array<float,2>{0.241260827f, 0.524180591f},
-std::array<float,2>{0.574129701f, 0.346905529f},
-std::array<float,2>{0.423189849f, 0.369413912f},
-std::array<float,2>{0.987387657f, 0.506161809f},
-std::array<float,2>{0.211833268f, 0.999298692f},
-std::array<float,2>{0.618743062f, 0.0686791092f},
-std::array<float,2>{0.0936982036f, 0.215663537f},
-std::array<float,2>{0.631826103f, 0.791734815f},
-std::array<float,2>{0.286154479f, 0.727568686f},
-std::array<float,2>{0.792379618f, 0.470324606f},
-std::array<float,2>{0.179848716f, 0.388297647f},
-std::array<float,2>{0.539954782f, 0.66188246f},
-std::array<float,2>{0.461883068f, 0.8645913f},
-std::array<float,2>{0.883178651f, 0.162950426f},
-std::array<float,2>{0.348837942f, 0.0222889092f},
-std::array<float,2>{0.870340884f, 0.87748003f},
-std::array<float,2>{0.0457151495f, 0.580443263f},
-std::array<float,2>{0.74196285f, 0.2918244f},
-std::array<float,2>{0.276228398f, 0.441185236f},
-std::array<float,2>{0.775199115f, 0.714969993f},
-std::array<float,2>{0.113353685f, 0.757765114f},
-std::array<float,2>{0.670757651f, 0.242578268f},
-std::array<float,2>{0.226961493f, 0.117157131f},
-std::array<float,2>{0.587790489f, 0.943120837f},
-std::array<float,2>{0.392720193f, 0.551559687f},
-std::array<float,2>{0.964656711f, 0.343481451f},
-std::array<float,2>{0.0219000038f, 0.253555804f},
-std::array<float,2>{0.69815141f, 0.617215574f},
-std::array<float,2>{0.32300669f, 0.926623642f},
-std::array<float,2>{0.827089846f, 0.046083644f},
-std::array<float,2>{0.472168952f, 0.148568064f},
-std::array<float,2>{0.921742082f, 0.82926482f},
-std::array<float,2>{0.130350336f, 0.63505441f},
-std::array<float,2>{0.512883484f, 0.437388271f},
-std::array<float,2>{0.400888652f, 0.476876408f},
-std::array<float,2>{0.957629085f, 0.720478177f},
-std::array<float,2>{0.221918046f, 0.786331177f},
-std::array<float,2>{0.58288753f, 0.203278676f},
-std::array<float,2>{0.12491437f, 0.0771998465f},
-std::array<float,2>{0.657188177f, 0.986086369f},
-std::array<float,2>{0.271698654f, 0.509321213f},
-std::array<float,2>{0.770800591f, 0.367003858f},
-std::array<float,2>{0.134037584f, 0.28588903f},
-std::array<float,2>{0.501002371f, 0.589094341f},
-std::array<float,2>{0.48138389f, 0.8847f},
-std::array<float,2>{0.91260308f, 0.0271224808f},
-std::array<float,2>{0.316867113f, 0.17136687f},
-std::array<float,2>{0.815607786f, 0.8695333f},
-std::array<float,2>{0.0275690332f, 0.664960563f},
-std::array<float,2>{0.689388573f, 0.379665375f},
-std::array<float,2>{0.289490044f, 0.33103469f},
-std::array<float,2>{0.782365739f, 0.562332153f},
-std::array<float,2>{0.0815021545f, 0.945606947f},
-std::array<float,2>{0.633245051f, 0.121810801f},
-std::array<float,2>{0.204676643f, 0.234672934f},
-std::array<float,2>{0.613883972f, 0.758406043f},
-std::array<float,2>{0.437110305f, 0.705241084f},
-std::array<float,2>{0.999388456f, 0.445608526f},
-std::array<float,2>{0.0356810056f, 0.425587624f},
-std::array<float,2>{0.744889498f, 0.630672753f},
-std::array<float,2>{0.354143083f, 0.842671394f},
-std::array<float,2>{0.861003935f, 0.14345558f},
-std::array<float,2>{0.459255368f, 0.0354269035f},
-std::array<float,2>{0.882461488f, 0.93587929f},
-std::array<float,2>{0.175639242f, 0.613439023f},
-std::array<float,2>{0.537056446f, 0.257866353f},
-std::array<float,2>{0.492250621f, 0.273135751f},
-std::array<float,2>{0.931998193f, 0.609284222f},
-std::array<float,2>{0.147536129f, 0.919136286f},
-std::array<float,2>{0.528884232f, 0.0554256029f},
-std::array<float,2>{0.00637674658f, 0.139972165f},
-std::array<float,2>{0.704675317f, 0.81594789f},
-std::array<float,2>{0.340216249f, 0.650319159f},
-std::array<float,2>{0.834345996f, 0.420996249f},
-std::array<float,2>{0.242555737f, 0.467569202f},
-std::array<float,2>{0.564282119f, 0.688052952f},
-std::array<float,2>{0.376489967f, 0.778393447f},
-std::array<float,2>{0.944081366f, 0.224025771f},
-std::array<float,2>{0.255475789f, 0.0990511701f},
-std::array<float,2>{0.756910801f, 0.967090368f},
-std::array<float,2>{0.106773131f, 0.544462562f},
-std::array<float,2>{0.672871649f, 0.324654698f},
-std::array<float,2>{0.371424288f, 0.393863142f},
-std::array<float,2>{0.857709706f, 0.686853409f},
-std::array<float,2>{0.0559772104f, 0.857388318f},
-std::array<float,2>{0.721733272f, 0.177114695f},
-std::array<float,2>{0.169836238f, 0.00286573218f},
-std::array<float,2>{0.551497877f, 0.895860255f},
-std::array<float,2>{0.445910484f, 0.576067328f},
-std::array<float,2>{0.896040559f, 0.304726988f},
-std::array<float,2>{0.0771953315f, 0.354194731f},
-std::array<float,2>{0.652932346f, 0.520027399f},
-std::array<float,2>{0.302872509f, 0.972481668f},
-std::array<float,2>{0.801531136f, 0.092573382f},
-std::array<float,2>{0.410849571f, 0.192667887f},
-std::array<float,2>{0.976216912f, 0.80274117f},
-std::array<float,2>{0.201520324f, 0.743206263f},
-std::array<float,2>{0.597479343f, 0.492611378f},
-std::array<float,2>{0.45399943f, 0.488639802f},
-std::array<float,2>{0.876405835f, 0.739476264f},
-std::array<float,2>{0.176648557f, 0.805290937f},
-std::array<float,2>{0.531909108f, 0.197958291f},
-std::array<float,2>{0.0349864103f, 0.0853268132f},
-std::array<float,2>{0.749377847f, 0.98274982f},
-std::array<float,2>{0.356116116f, 0.529239058f},
-std::array<float,2>{0.864697397f, 0.35114184f},
-std::array<float,2>{0.208099604f, 0.302538127f},
-std::array<float,2>{0.613263547f, 0.565035939f},
-std::array<float,2>{0.432107925f, 0.906163692f},
-std::array<float,2>{0.995595753f, 0.0118154092f},
-std::array<float,2>{0.295676619f, 0.179981083f},
-std::array<float,2>{0.788418353f, 0.846084654f},
-std::array<float,2>{0.0839425772f, 0.672514081f},
-std::array<float,2>{0.637535036f, 0.40490818f},
-std::array<float,2>{0.313145995f, 0.315331966f},
-std::array<float,2>{0.817794442f, 0.537943125f},
-std::array<float,2>{0.0261251293f, 0.956186056f},
-std::array<float,2>{0.691688478f, 0.106128819f},
-std::array<float,2>{0.13700892f, 0.231712401f},
-std::array<float,2>{0.506093681f, 0.771320105f},
-std::array<float,2>{0.479640782f, 0.698925018f},
-std::array<float,2>{0.90962708f, 0.453636289f},
-std::array<float,2>{0.120698571f, 0.406409889f},
-std::array<float,2>{0.661250174f, 0.647091389f},
-std::array<float,2>{0.267478466f, 0.82685256f},
-std::array<float,2>{0.768045306f, 0.132572278f},
-std::array<float,2>{0.404375046f, 0.0526381508f},
-std::array<float,2>{0.955526471f, 0.907562077f},
-std::array<float,2>{0.226334348f, 0.596581221f},
-std::array<float,2>{0.578983307f, 0.278052121f},
-std::array<float,2>{0.408947021f, 0.255385429f},
-std::array<float,2>{0.969389081f, 0.624302447f},
-std::array<float,2>{0.197061256f, 0.921987295f},
-std::array<float,2>{0.599619448f, 0.0426445231f},
-std::array<float,2>{0.0739426091f, 0.154866576f},
-std::array<float,2>{0.651176691f, 0.832193434f},
-std::array<float,2>{0.298735499f, 0.639894903f},
-std::array<float,2>{0.797735989f, 0.431781203f},
-std::array<float,2>{0.164718553f, 0.444597095f},
-std::array<float,2>{0.548582494f, 0.712453067f},
-std::array<float,2>{0.451371938f, 0.75202632f},
-std::array<float,2>{0.89100188f, 0.248570472f},
-std::array<float,2>{0.369222462f, 0.112652786f},
-std::array<float,2>{0.855078638f, 0.940719962f},
-std::array<float,2>{0.0601773709f, 0.54696101f},
-std::array<float,2>{0.723848224f, 0.336663246f},
-std::array<float,2>{0.252845377f, 0.383194506f},
-std::array<float,2>{0.750316858f, 0.656889617f},
-std::array<float,2>{0.103602819f, 0.861435711f},
-std::array<float,2>{0.679255843f, 0.158647209f},
-std::array<float,2>{0.24991405f, 0.0186292529f},
-std::array<float,2>{0.566732407f, 0.882752299f},
-std::array<float,2>{0.379827619f, 0.584585488f},
-std::array<float,2>{0.940670073f, 0.293396801f},
-std::array<float,2>{0.00256820675f, 0.37448734f},
-std::array<float,2>{0.707187772f, 0.501555145f},
-std::array<float,2>{0.33612594f, 0.995921314f},
-std::array<float,2>{0.828162193f, 0.0644999892f},
-std::array<float,2>{0.498363495f, 0.213053167f},
-std::array<float,2>{0.935398459f, 0.795281768f},
-std::array<float,2>{0.142243847f, 0.731155574f},
-std::array<float,2>{0.526862681f, 0.475527465f},
-std::array<float,2>{0.388476759f, 0.427138478f},
-std::array<float,2>{0.951416373f, 0.62626642f},
-std::array<float,2>{0.236164302f, 0.836394668f},
-std::array<float,2>{0.574778676f, 0.148034155f},
-std::array<float,2>{0.0946929455f, 0.0337050967f},
-std::array<float,2>{0.68242842f, 0.931372344f},
-std::array<float,2>{0.263266236f, 0.609518945f},
-std::array<float,2>{0.760474443f, 0.262899131f},
-std::array<float,2>{0.1523204f, 0.332583576f},
-std::array<float,2>{0.516835332f, 0.555829406f},
-std::array<float,2>{0.491382688f, 0.952079415f},
-std::array<float,2>{0.925165355f, 0.118576869f},
-std::array<float,2>{0.330040634f, 0.238694742f},
-std::array<float,2>{0.836853921f, 0.763062358f},
-std::array<float,2>{0.0136872809f, 0.70721662f},
-std::array<float,2>{0.717454612f, 0.452426106f},
-std::array<float,2>{0.307009071f, 0.281575173f},
-std::array<float,2>{0.805241585f, 0.590080678f},
-std::array<float,2>{0.0672414228f, 0.886797369f},
-std::array<float,2>{0.64811337f, 0.0285755992f},
-std::array<float,2>{0.191569373f, 0.165972531f},
-std::array<float,2>{0.603439987f, 0.872775912f},
-std::array<float,2>{0.414906383f, 0.670345128f},
-std::array<float,2>{0.98344034f, 0.377227664f},
-std::array<float,2>{0.0475446954f, 0.48172304f},
-std::array<float,2>{0.730069935f, 0.724723697f},
-std::array<float,2>{0.362788945f, 0.783056021f},
-std::array<float,2>{0.850970566f, 0.208104879f},
-std::array<float,2>{0.439815611f, 0.0703770071f},
-std::array<float,2>{0.904221356f, 0.988977969f},
-std::array<float,2>{0.16113165f, 0.515125513f},
-std::array<float,2>{0.554734647f, 0.362696171f},
-std::array<float,2>{0.473221451f, 0.356043428f},
-std::array<float,2>{0.917673469f, 0.516599357f},
-std::array<float,2>{0.127798185f, 0.974024892f},
-std::array<float,2>{0.509981275f, 0.0888779834f},
-std::array<float,2>{0.0181706585f, 0.189694852f},
-std::array<float,2>{0.702024996f, 0.799733937f},
-std::array<float,2>{0.325549901f, 0.749004304f},
-std::array<float,2>{0.8210693f, 0.497202665f},
-std::array<float,2>{0.231110513f, 0.396250516f},
-std::array<float,2>{0.592202663f, 0.68299973f},
-std::array<float,2>{0.398176223f, 0.854330719f},
-std::array<float,2>{0.967009544f, 0.17368415f},
-std::array<float,2>{0.278874934f, 0.00660062814f},
-std::array<float,2>{0.780663371f, 0.893116057f},
-std::array<float,2>{0.1100448f, 0.571078002f},
-std::array<float,2>{0.665614545f, 0.311909139f},
-std::array<float,2>{0.346228629f, 0.463223696f},
-std::array<float,2>{0.874498725f, 0.692195415f},
-std::array<float,2>{0.0396759883f, 0.774511993f},
-std::array<float,2>{0.73478657f, 0.218820661f},
-std::array<float,2>{0.186759144f, 0.0941890553f},
-std::array<float,2>{0.544527113f, 0.962472975f},
-std::array<float,2>{0.468741149f, 0.53925097f},
-std::array<float,2>{0.889807224f, 0.324106634f},
-std::array<float,2>{0.0885675922f, 0.268081129f},
-std::array<float,2>{0.627114058f, 0.603634357f},
-std::array<float,2>{0.281764239f, 0.914864898f},
-std::array<float,2>{0.794046462f, 0.0620996691f},
-std::array<float,2>{0.429096431f, 0.133554071f},
-std::array<float,2>{0.989522994f, 0.819954276f},
-std::array<float,2>{0.217476219f, 0.655941248f},
-std::array<float,2>{0.621268272f, 0.415395141f},
-std::array<float,2>{0.487611026f, 0.400475413f},
-std::array<float,2>{0.926506817f, 0.677541196f},
-std::array<float,2>{0.152717158f, 0.851287842f},
-std::array<float,2>{0.520426989f, 0.187244058f},
-std::array<float,2>{0.00838392973f, 0.00883866567f},
-std::array<float,2>{0.714607656f, 0.90003401f},
-std::array<float,2>{0.335500658f, 0.568381846f},
-std::array<float,2>{0.842798769f, 0.297626376f},
-std::array<float,2>{0.238995597f, 0.344647765f},
-std::array<float,2>{0.572127461f, 0.527103186f},
-std::array<float,2>{0.385722995f, 0.978743553f},
-std::array<float,2>{0.947527349f, 0.0816618055f},
-std::array<float,2>{0.26072979f, 0.20011358f},
-std::array<float,2>{0.764851928f, 0.81093812f},
-std::array<float,2>{0.099442713f, 0.734467447f},
-std::array<float,2>{0.686372638f, 0.485740811f},
-std::array<float,2>{0.364842534f, 0.276477754f},
-std::array<float,2>{0.846549809f, 0.601419687f},
-std::array<float,2>{0.0518509559f, 0.913790941f},
-std::array<float,2>{0.731259942f, 0.0475286059f},
-std::array<float,2>{0.157684132f, 0.128271922f},
-std::array<float,2>{0.562212825f, 0.824217319f},
-std::array<float,2>{0.444306135f, 0.642472863f},
-std::array<float,2>{0.902066886f, 0.411310554f},
-std::array<float,2>{0.0662560165f, 0.457246661f},
-std::array<float,2>{0.641295552f, 0.701579273f},
-std::array<float,2>{0.309220433f, 0.766715646f},
-std::array<float,2>{0.809853137f, 0.230343238f},
-std::array<float,2>{0.420386702f, 0.102415398f},
-std::array<float,2>{0.97905153f, 0.957983077f},
-std::array<float,2>{0.189701781f, 0.531927645f},
-std::array<float,2>{0.605519295f, 0.319624692f},
-std::array<float,2>{0.390908539f, 0.341308355f},
-std::array<float,2>{0.962430835f, 0.554500461f},
-std::array<float,2>{0.22931464f, 0.944792569f},
-std::array<float,2>{0.589712203f, 0.114953086f},
-std::array<float,2>{0.115313262f, 0.245521083f},
-std::array<float,2>{0.669526577f, 0.754558861f},
-std::array<float,2>{0.275061309f, 0.718278885f},
-std::array<float,2>{0.777138472f, 0.438542843f},
-std::array<float,2>{0.132034123f, 0.434526682f},
-std::array<float,2>{0.51396364f, 0.634531856f},
-std::array<float,2>{0.470495492f, 0.830966413f},
-std::array<float,2>{0.918857753f, 0.15057002f},
-std::array<float,2>{0.321545571f, 0.0444682427f},
-std::array<float,2>{0.824756444f, 0.928965807f},
-std::array<float,2>{0.0206671283f, 0.619461775f},
-std::array<float,2>{0.696013033f, 0.250473589f},
-std::array<float,2>{0.28826037f, 0.472552389f},
-std::array<float,2>{0.790733576f, 0.729325294f},
-std::array<float,2>{0.0909879655f, 0.790505946f},
-std::array<float,2>{0.62976712f, 0.218229845f},
-std::array<float,2>{0.213229582f, 0.0671644807f},
-std::array<float,2>{0.620042264f, 0.997358799f},
-std::array<float,2>{0.424921155f, 0.504476607f},
-std::array<float,2>{0.986259818f, 0.369066119f},
-std::array<float,2>{0.0446526445f, 0.289096773f},
-std::array<float,2>{0.738961339f, 0.579303682f},
-std::array<float,2>{0.351387471f, 0.875879288f},
-std::array<float,2>{0.86899966f, 0.0208144598f},
-std::array<float,2>{0.464832693f, 0.16075705f},
-std::array<float,2>{0.885842681f, 0.86565721f},
-std::array<float,2>{0.183289647f, 0.6633358f},
-std::array<float,2>{0.542225063f, 0.390001893f},
-std::array<float,2>{0.435517639f, 0.449096888f},
-std::array<float,2>{0.996128857f, 0.703797817f},
-std::array<float,2>{0.206576079f, 0.759943485f},
-std::array<float,2>{0.615586996f, 0.237445548f},
-std::array<float,2>{0.0791827217f, 0.124176197f},
-std::array<float,2>{0.636064589f, 0.947703242f},
-std::array<float,2>{0.291257352f, 0.560176015f},
-std::array<float,2>{0.784161448f, 0.328942239f},
-std::array<float,2>{0.17270498f, 0.261558026f},
-std::array<float,2>{0.537515223f, 0.615548134f},
-std::array<float,2>{0.458234459f, 0.933673561f},
-std::array<float,2>{0.879837632f, 0.0387336761f},
-std::array<float,2>{0.351585448f, 0.141934663f},
-std::array<float,2>{0.862507045f, 0.840294003f},
-std::array<float,2>{0.0384971611f, 0.631132245f},
-std::array<float,2>{0.743946016f, 0.421880454f},
-std::array<float,2>{0.269628912f, 0.364634156f},
-std::array<float,2>{0.772533596f, 0.511243939f},
-std::array<float,2>{0.122922845f, 0.987483561f},
-std::array<float,2>{0.659288347f, 0.074947156f},
-std::array<float,2>{0.219956666f, 0.205374032f},
-std::array<float,2>{0.584685326f, 0.788986564f},
-std::array<float,2>{0.399095386f, 0.722089887f},
-std::array<float,2>{0.960701406f, 0.478952646f},
-std::array<float,2>{0.0311104208f, 0.381793976f},
-std::array<float,2>{0.690448165f, 0.666439891f},
-std::array<float,2>{0.320105851f, 0.867880881f},
-std::array<float,2>{0.81440258f, 0.168847755f},
-std::array<float,2>{0.482931316f, 0.0251468178f},
-std::array<float,2>{0.910277009f, 0.884842694f},
-std::array<float,2>{0.135325581f, 0.586782992f},
-std::array<float,2>{0.501992762f, 0.287121177f},
-std::array<float,2>{0.447356075f, 0.306968451f},
-std::array<float,2>{0.897808015f, 0.577114105f},
-std::array<float,2>{0.170193747f, 0.89712584f},
-std::array<float,2>{0.553911209f, 0.00136337022f},
-std::array<float,2>{0.0568028614f, 0.179445982f},
-std::array<float,2>{0.71984446f, 0.859251142f},
-std::array<float,2>{0.374925226f, 0.685511112f},
-std::array<float,2>{0.856967509f, 0.392277688f},
-std::array<float,2>{0.199522421f, 0.494503319f},
-std::array<float,2>{0.595664978f, 0.745317101f},
-std::array<float,2>{0.412851781f, 0.801338434f},
-std::array<float,2>{0.972884059f, 0.194177896f},
-std::array<float,2>{0.302566379f, 0.0907836333f},
-std::array<float,2>{0.803846002f, 0.969741642f},
-std::array<float,2>{0.0748582631f, 0.523065746f},
-std::array<float,2>{0.655969381f, 0.352867424f},
-std::array<float,2>{0.342740983f, 0.41897288f},
-std::array<float,2>{0.833070695f, 0.651595175f},
-std::array<float,2>{0.00490206294f, 0.813553691f},
-std::array<float,2>{0.706922531f, 0.138311103f},
-std::array<float,2>{0.145463064f, 0.0567388125f},
-std::array<float,2>{0.529910803f, 0.920638621f},
-std::array<float,2>{0.494624496f, 0.606486261f},
-std::array<float,2>{0.930087447f, 0.270933002f},
-std::array<float,2>{0.108984493f, 0.326609164f},
-std::array<float,2>{0.674700379f, 0.546649098f},
-std::array<float,2>{0.255944669f, 0.9650985f},
-std::array<float,2>{0.755715132f, 0.101476856f},
-std::array<float,2>{0.377728909f, 0.225047618f},
-std::array<float,2>{0.942552328f, 0.780647099f},
-std::array<float,2>{0.245712534f, 0.689703703f},
-std::array<float,2>{0.565216184f, 0.465842962f},
-std::array<float,2>{0.468259811f, 0.462459803f},
-std::array<float,2>{0.890322328f, 0.693616152f},
-std::array<float,2>{0.187100276f, 0.777060509f},
-std::array<float,2>{0.544433117f, 0.222211406f},
-std::array<float,2>{0.0392843634f, 0.0973169282f},
-std::array<float,2>{0.735029042f, 0.964411318f},
-std::array<float,2>{0.346116573f, 0.54191184f},
-std::array<float,2>{0.874777675f, 0.321773916f},
-std::array<float,2>{0.216918617f, 0.267249674f},
-std::array<float,2>{0.62196362f, 0.60324049f},
-std::array<float,2>{0.429617345f, 0.916749179f},
-std::array<float,2>{0.990191042f, 0.0601987243f},
-std::array<float,2>{0.281725764f, 0.13575536f},
-std::array<float,2>{0.794615388f, 0.818183124f},
-std::array<float,2>{0.0883114114f, 0.653248727f},
-std::array<float,2>{0.627696872f, 0.416804463f},
-std::array<float,2>{0.326160342f, 0.358698279f},
-std::array<float,2>{0.820683539f, 0.518376648f},
-std::array<float,2>{0.0180350728f, 0.976250827f},
-std::array<float,2>{0.70119518f, 0.0875181258f},
-std::array<float,2>{0.127361968f, 0.188785583f},
-std::array<float,2>{0.510563791f, 0.798707247f},
-std::array<float,2>{0.472720325f, 0.74753505f},
-std::array<float,2>{0.917048812f, 0.498300612f},
-std::array<float,2>{0.10938292f, 0.398179054f},
-std::array<float,2>{0.665098131f, 0.680262148f},
-std::array<float,2>{0.278511494f, 0.853247881f},
-std::array<float,2>{0.780863106f, 0.17572698f},
-std::array<float,2>{0.39754355f, 0.00497378828f},
-std::array<float,2>{0.967772603f, 0.892282188f},
-std::array<float,2>{0.230688363f, 0.572331786f},
-std::array<float,2>{0.592449903f, 0.308616221f},
-std::array<float,2>{0.414180368f, 0.284300327f},
-std::array<float,2>{0.984344542f, 0.5919137f},
-std::array<float,2>{0.192085057f, 0.889122546f},
-std::array<float,2>{0.602584541f, 0.0308702067f},
-std::array<float,2>{0.0666348338f, 0.166973233f},
-std::array<float,2>{0.647731543f, 0.874937296f},
-std::array<float,2>{0.307257354f, 0.669718206f},
-std::array<float,2>{0.804842412f, 0.375729382f},
-std::array<float,2>{0.160252571f, 0.483857334f},
-std::array<float,2>{0.555272937f, 0.723860443f},
-std::array<float,2>{0.440328568f, 0.783562005f},
-std::array<float,2>{0.903692067f, 0.210515514f},
-std::array<float,2>{0.363186181f, 0.0739455372f},
-std::array<float,2>{0.851439774f, 0.99117589f},
-std::array<float,2>{0.0471388884f, 0.512853444f},
-std::array<float,2>{0.729745805f, 0.359568268f},
-std::array<float,2>{0.263100415f, 0.428628266f},
-std::array<float,2>{0.760044336f, 0.628698945f},
-std::array<float,2>{0.0940143541f, 0.839233339f},
-std::array<float,2>{0.682076693f, 0.144827887f},
-std::array<float,2>{0.235504597f, 0.0313401036f},
-std::array<float,2>{0.574529827f, 0.932172358f},
-std::array<float,2>{0.387825787f, 0.612683594f},
-std::array<float,2>{0.951877654f, 0.265322685f},
-std::array<float,2>{0.0142068956f, 0.334074229f},
-std::array<float,2>{0.717092276f, 0.5571751f},
-std::array<float,2>{0.329443872f, 0.949489295f},
-std::array<float,2>{0.836256087f, 0.11979825f},
-std::array<float,2>{0.491967022f, 0.241067991f},
-std::array<float,2>{0.925599456f, 0.763801813f},
-std::array<float,2>{0.15151082f, 0.710477054f},
-std::array<float,2>{0.517371893f, 0.451016247f},
-std::array<float,2>{0.379138738f, 0.386461556f},
-std::array<float,2>{0.940970898f, 0.659813166f},
-std::array<float,2>{0.249029785f, 0.86086303f},
-std::array<float,2>{0.567373991f, 0.156634942f},
-std::array<float,2>{0.104174398f, 0.0157933012f},
-std::array<float,2>{0.678978682f, 0.879050314f},
-std::array<float,2>{0.252382129f, 0.582689643f},
-std::array<float,2>{0.7505669f, 0.295163333f},
-std::array<float,2>{0.141812474f, 0.372722775f},
-std::array<float,2>{0.526539326f, 0.502478659f},
-std::array<float,2>{0.498842835f, 0.992496014f},
-std::array<float,2>{0.934668005f, 0.063307263f},
-std::array<float,2>{0.336433142f, 0.212743655f},
-std::array<float,2>{0.829042435f, 0.794549823f},
-std::array<float,2>{0.00223175553f, 0.732993007f},
-std::array<float,2>{0.707729995f, 0.474246234f},
-std::array<float,2>{0.297985673f, 0.256883651f},
-std::array<float,2>{0.797219694f, 0.622752726f},
-std::array<float,2>{0.0734012201f, 0.925652802f},
-std::array<float,2>{0.650638938f, 0.0400973968f},
-std::array<float,2>{0.196684584f, 0.152765408f},
-std::array<float,2>{0.600283384f, 0.834852934f},
-std::array<float,2>{0.408652723f, 0.637310147f},
-std::array<float,2>{0.969132543f, 0.430060536f},
-std::array<float,2>{0.0599972159f, 0.44317767f},
-std::array<float,2>{0.724259496f, 0.713778734f},
-std::array<float,2>{0.369762301f, 0.750344336f},
-std::array<float,2>{0.854792655f, 0.247299418f},
-std::array<float,2>{0.451891541f, 0.109587535f},
-std::array<float,2>{0.891268432f, 0.93773973f},
-std::array<float,2>{0.164384186f, 0.5493837f},
-std::array<float,2>{0.548246264f, 0.339827567f},
-std::array<float,2>{0.480394423f, 0.313332379f},
-std::array<float,2>{0.909880102f, 0.535948694f},
-std::array<float,2>{0.137651697f, 0.954286516f},
-std::array<float,2>{0.506575704f, 0.108522996f},
-std::array<float,2>{0.0256329626f, 0.232478887f},
-std::array<float,2>{0.692126334f, 0.772368193f},
-std::array<float,2>{0.3125332f, 0.696972489f},
-std::array<float,2>{0.817928851f, 0.456757337f},
-std::array<float,2>{0.225684136f, 0.40986529f},
-std::array<float,2>{0.578505456f, 0.644825101f},
-std::array<float,2>{0.404953808f, 0.8243469f},
-std::array<float,2>{0.955826402f, 0.130853251f},
-std::array<float,2>{0.266838312f, 0.0530111827f},
-std::array<float,2>{0.768522024f, 0.908883512f},
-std::array<float,2>{0.120548651f, 0.593790114f},
-std::array<float,2>{0.66167134f, 0.27938813f},
-std::array<float,2>{0.355947852f, 0.491190821f},
-std::array<float,2>{0.864950478f, 0.741183639f},
-std::array<float,2>{0.0343518369f, 0.808517277f},
-std::array<float,2>{0.749969006f, 0.195751026f},
-std::array<float,2>{0.175864592f, 0.0832766518f},
-std::array<float,2>{0.531440437f, 0.981177449f},
-std::array<float,2>{0.453301877f, 0.530179799f},
-std::array<float,2>{0.876613438f, 0.348113298f},
-std::array<float,2>{0.0834674463f, 0.304435104f},
-std::array<float,2>{0.63680017f, 0.564134359f},
-std::array<float,2>{0.295390427f, 0.903890848f},
-std::array<float,2>{0.788814843f, 0.0153832743f},
-std::array<float,2>{0.432242662f, 0.181938991f},
-std::array<float,2>{0.995782614f, 0.845176756f},
-std::array<float,2>{0.208711386f, 0.675652146f},
-std::array<float,2>{0.612579584f, 0.402832359f},
-std::array<float,2>{0.4949103f, 0.421459645f},
-std::array<float,2>{0.930194259f, 0.649655044f},
-std::array<float,2>{0.144890383f, 0.815858006f},
-std::array<float,2>{0.529376686f, 0.140279755f},
-std::array<float,2>{0.00579507183f, 0.0551031716f},
-std::array<float,2>{0.706080377f, 0.919585764f},
-std::array<float,2>{0.341973305f, 0.608491182f},
-std::array<float,2>{0.833794117f, 0.272835016f},
-std::array<float,2>{0.245299637f, 0.324784815f},
-std::array<float,2>{0.564926744f, 0.544044137f},
-std::array<float,2>{0.37735337f, 0.967407584f},
-std::array<float,2>{0.943005443f, 0.099457711f},
-std::array<float,2>{0.256646961f, 0.224508137f},
-std::array<float,2>{0.755172372f, 0.778856158f},
-std::array<float,2>{0.108532049f, 0.687791228f},
-std::array<float,2>{0.674133539f, 0.467209369f},
-std::array<float,2>{0.374460161f, 0.305377305f},
-std::array<float,2>{0.856894374f, 0.575360358f},
-std::array<float,2>{0.0573228151f, 0.896176577f},
-std::array<float,2>{0.720345259f, 0.0020338092f},
-std::array<float,2>{0.17080009f, 0.177264065f},
-std::array<float,2>{0.554579318f, 0.856513262f},
-std::array<float,2>{0.448151082f, 0.687182963f},
-std::array<float,2>{0.898023546f, 0.394261181f},
-std::array<float,2>{0.0742648095f, 0.492800653f},
-std::array<float,2>{0.655680895f, 0.743947506f},
-std::array<float,2>{0.302226394f, 0.803314328f},
-std::array<float,2>{0.804593027f, 0.193152755f},
-std::array<float,2>{0.412440866f, 0.0921959653f},
-std::array<float,2>{0.973620951f, 0.972155392f},
-std::array<float,2>{0.1999944f, 0.519698977f},
-std::array<float,2>{0.594808817f, 0.353672415f},
-std::array<float,2>{0.398449272f, 0.366505802f},
-std::array<float,2>{0.960212052f, 0.509021521f},
-std::array<float,2>{0.220306933f, 0.985379755f},
-std::array<float,2>{0.58399713f, 0.0780990496f},
-std::array<float,2>{0.122499198f, 0.204084605f},
-std::array<float,2>{0.65985775f, 0.786750317f},
-std::array<float,2>{0.270466268f, 0.720024645f},
-std::array<float,2>{0.773371935f, 0.477508783f},
-std::array<float,2>{0.134915844f, 0.379130781f},
-std::array<float,2>{0.502890766f, 0.664434373f},
-std::array<float,2>{0.482452899f, 0.869629264f},
-std::array<float,2>{0.910944819f, 0.171725184f},
-std::array<float,2>{0.319732457f, 0.0264045708f},
-std::array<float,2>{0.813561678f, 0.883942485f},
-std::array<float,2>{0.030349791f, 0.589745939f},
-std::array<float,2>{0.691094041f, 0.285364002f},
-std::array<float,2>{0.291833043f, 0.446014285f},
-std::array<float,2>{0.783302486f, 0.706042707f},
-std::array<float,2>{0.0797951072f, 0.757989645f},
-std::array<float,2>{0.63638562f, 0.235055685f},
-std::array<float,2>{0.206311852f, 0.121358953f},
-std::array<float,2>{0.615992844f, 0.946005225f},
-std::array<float,2>{0.435051143f, 0.561613798f},
-std::array<float,2>{0.996847093f, 0.330110908f},
-std::array<float,2>{0.0390213467f, 0.258358121f},
-std::array<float,2>{0.743548274f, 0.613944411f},
-std::array<float,2>{0.352238655f, 0.936046422f},
-std::array<float,2>{0.863205433f, 0.0361305401f},
-std::array<float,2>{0.45886156f, 0.142915323f},
-std::array<float,2>{0.879300714f, 0.841843247f},
-std::array<float,2>{0.171879977f, 0.629966199f},
-std::array<float,2>{0.537997127f, 0.425076038f},
-std::array<float,2>{0.425460577f, 0.470148623f},
-std::array<float,2>{0.985611916f, 0.728120983f},
-std::array<float,2>{0.213848129f, 0.791143119f},
-std::array<float,2>{0.619172692f, 0.21532838f},
-std::array<float,2>{0.0914535895f, 0.0689561591f},
-std::array<float,2>{0.629383564f, 0.999807656f},
-std::array<float,2>{0.288847029f, 0.506740272f},
-std::array<float,2>{0.790383399f, 0.370055526f},
-std::array<float,2>{0.182952896f, 0.291051388f},
-std::array<float,2>{0.542571723f, 0.580639541f},
-std::array<float,2>{0.464237511f, 0.877308011f},
-std::array<float,2>{0.8864429f, 0.0217313338f},
-std::array<float,2>{0.350733668f, 0.162181854f},
-std::array<float,2>{0.868585169f, 0.864887655f},
-std::array<float,2>{0.0441477858f, 0.661299288f},
-std::array<float,2>{0.738656402f, 0.387717098f},
-std::array<float,2>{0.274462581f, 0.343216419f},
-std::array<float,2>{0.77646327f, 0.550841868f},
-std::array<float,2>{0.115897551f, 0.942397952f},
-std::array<float,2>{0.669138074f, 0.116258219f},
-std::array<float,2>{0.228600249f, 0.243028641f},
-std::array<float,2>{0.588947535f, 0.757143378f},
-std::array<float,2>{0.391126662f, 0.715497136f},
-std::array<float,2>{0.961958587f, 0.440474153f},
-std::array<float,2>{0.0212919097f, 0.436754853f},
-std::array<float,2>{0.69534725f, 0.635684788f},
-std::array<float,2>{0.322173685f, 0.829975247f},
-std::array<float,2>{0.824506998f, 0.149074763f},
-std::array<float,2>{0.470068365f, 0.0464268103f},
-std::array<float,2>{0.918301404f, 0.9259606f},
-std::array<float,2>{0.132703945f, 0.618049085f},
-std::array<float,2>{0.514425635f, 0.253160954f},
-std::array<float,2>{0.443792582f, 0.275227964f},
-std::array<float,2>{0.901592612f, 0.598865151f},
-std::array<float,2>{0.157848626f, 0.910300851f},
-std::array<float,2>{0.561825991f, 0.0497205034f},
-std::array<float,2>{0.0523256771f, 0.125026405f},
-std::array<float,2>{0.730519116f, 0.820689619f},
-std::array<float,2>{0.364400774f, 0.64426434f},
-std::array<float,2>{0.845930696f, 0.413886666f},
-std::array<float,2>{0.190104187f, 0.459014326f},
-std::array<float,2>{0.606338084f, 0.699914515f},
-std::array<float,2>{0.420837879f, 0.768696249f},
-std::array<float,2>{0.978764057f, 0.226819962f},
-std::array<float,2>{0.30860725f, 0.104468755f},
-std::array<float,2>{0.810144782f, 0.960073173f},
-std::array<float,2>{0.0659089237f, 0.533976436f},
-std::array<float,2>{0.640903056f, 0.316810578f},
-std::array<float,2>{0.335160583f, 0.398785144f},
-std::array<float,2>{0.843533814f, 0.678030312f},
-std::array<float,2>{0.00800735969f, 0.84855777f},
-std::array<float,2>{0.7139045f, 0.18505691f},
-std::array<float,2>{0.15320611f, 0.0109958882f},
-std::array<float,2>{0.519874811f, 0.901874304f},
-std::array<float,2>{0.488237053f, 0.567754626f},
-std::array<float,2>{0.926139414f, 0.299919009f},
-std::array<float,2>{0.0987122282f, 0.347311765f},
-std::array<float,2>{0.685942471f, 0.523756742f},
-std::array<float,2>{0.259771645f, 0.97662127f},
-std::array<float,2>{0.765447676f, 0.0792777985f},
-std::array<float,2>{0.384802938f, 0.202748939f},
-std::array<float,2>{0.947905362f, 0.810334086f},
-std::array<float,2>{0.238372743f, 0.737869918f},
-std::array<float,2>{0.571527243f, 0.486815959f},
-std::array<float,2>{0.475854218f, 0.497565955f},
-std::array<float,2>{0.915791571f, 0.748252928f},
-std::array<float,2>{0.125687212f, 0.799146712f},
-std::array<float,2>{0.508924305f, 0.190194249f},
-std::array<float,2>{0.017065838f, 0.0894362926f},
-std::array<float,2>{0.700487018f, 0.974331081f},
-std::array<float,2>{0.326622218f, 0.515632093f},
-std::array<float,2>{0.822646797f, 0.355908573f},
-std::array<float,2>{0.232459515f, 0.31229347f},
-std::array<float,2>{0.590134323f, 0.57037288f},
-std::array<float,2>{0.396339178f, 0.892833233f},
-std::array<float,2>{0.966215551f, 0.00613876432f},
-std::array<float,2>{0.279774308f, 0.173273847f},
-std::array<float,2>{0.778173268f, 0.853946626f},
-std::array<float,2>{0.111749925f, 0.683106124f},
-std::array<float,2>{0.667233706f, 0.395892292f},
-std::array<float,2>{0.344011396f, 0.323486745f},
-std::array<float,2>{0.872819602f, 0.539941967f},
-std::array<float,2>{0.0412552767f, 0.9619807f},
-std::array<float,2>{0.73779732f, 0.0947000608f},
-std::array<float,2>{0.18360208f, 0.219399363f},
-std::array<float,2>{0.546239793f, 0.775046289f},
-std::array<float,2>{0.465868205f, 0.691682518f},
-std::array<float,2>{0.888655961f, 0.463758945f},
-std::array<float,2>{0.0866403133f, 0.415915877f},
-std::array<float,2>{0.626215041f, 0.655636072f},
-std::array<float,2>{0.284824461f, 0.819512069f},
-std::array<float,2>{0.795729637f, 0.132884294f},
-std::array<float,2>{0.42629227f, 0.0619456694f},
-std::array<float,2>{0.990597785f, 0.914422512f},
-std::array<float,2>{0.21504122f, 0.604328275f},
-std::array<float,2>{0.62486279f, 0.267655969f},
-std::array<float,2>{0.39028883f, 0.2632671f},
-std::array<float,2>{0.949821889f, 0.610198259f},
-std::array<float,2>{0.23711732f, 0.930674911f},
-std::array<float,2>{0.576213419f, 0.0336636044f},
-std::array<float,2>{0.0969222933f, 0.147713363f},
-std::array<float,2>{0.680126488f, 0.836661994f},
-std::array<float,2>{0.265457273f, 0.626568019f},
-std::array<float,2>{0.758417666f, 0.427584112f},
-std::array<float,2>{0.148967162f, 0.452968568f},
-std::array<float,2>{0.517946303f, 0.70785141f},
-std::array<float,2>{0.488658935f, 0.763300776f},
-std::array<float,2>{0.922334492f, 0.23902978f},
-std::array<float,2>{0.330639362f, 0.118825994f},
-std::array<float,2>{0.839292705f, 0.951179445f},
-std::array<float,2>{0.0123118348f, 0.556214809f},
-std::array<float,2>{0.715705574f, 0.332225561f},
-std::array<float,2>{0.306044906f, 0.377858609f},
-std::array<float,2>{0.80738169f, 0.670886099f},
-std::array<float,2>{0.0700842887f, 0.872248769f},
-std::array<float,2>{0.64581871f, 0.165348649f},
-std::array<float,2>{0.195227146f, 0.0289687961f},
-std::array<float,2>{0.604940057f, 0.887423635f},
-std::array<float,2>{0.417285353f, 0.590783894f},
-std::array<float,2>{0.982010424f, 0.28191185f},
-std::array<float,2>{0.0501318052f, 0.362931401f},
-std::array<float,2>{0.727391839f, 0.515368342f},
-std::array<float,2>{0.360595793f, 0.98838383f},
-std::array<float,2>{0.84847641f, 0.0710676759f},
-std::array<float,2>{0.437674761f, 0.208568007f},
-std::array<float,2>{0.904317617f, 0.782313585f},
-std::array<float,2>{0.163351491f, 0.725188613f},
-std::array<float,2>{0.556989193f, 0.482137233f},
-std::array<float,2>{0.406567156f, 0.432356f},
-std::array<float,2>{0.972325921f, 0.640549839f},
-std::array<float,2>{0.197769538f, 0.832590163f},
-std::array<float,2>{0.599420667f, 0.154525653f},
-std::array<float,2>{0.0713803247f, 0.0421191715f},
-std::array<float,2>{0.650326967f, 0.922694027f},
-std::array<float,2>{0.300449908f, 0.624636292f},
-std::array<float,2>{0.799029529f, 0.255084008f},
-std::array<float,2>{0.166873768f, 0.336420417f},
-std::array<float,2>{0.550171435f, 0.547667623f},
-std::array<float,2>{0.450136542f, 0.941381931f},
-std::array<float,2>{0.893641651f, 0.113274783f},
-std::array<float,2>{0.368156523f, 0.24849844f},
-std::array<float,2>{0.852036178f, 0.752571762f},
-std::array<float,2>{0.0621252693f, 0.712233782f},
-std::array<float,2>{0.725173652f, 0.444965035f},
-std::array<float,2>{0.2504583f, 0.293776363f},
-std::array<float,2>{0.752425432f, 0.584000289f},
-std::array<float,2>{0.102639385f, 0.881916285f},
-std::array<float,2>{0.676903486f, 0.0195084047f},
-std::array<float,2>{0.247477442f, 0.159044757f},
-std::array<float,2>{0.569749296f, 0.8622244f},
-std::array<float,2>{0.381955355f, 0.656731427f},
-std::array<float,2>{0.937763453f, 0.383616418f},
-std::array<float,2>{0.00127914862f, 0.474684119f},
-std::array<float,2>{0.70995611f, 0.730634212f},
-std::array<float,2>{0.339761019f, 0.795427501f},
-std::array<float,2>{0.83164376f, 0.213764474f},
-std::array<float,2>{0.497884274f, 0.0651287287f},
-std::array<float,2>{0.937350452f, 0.995570004f},
-std::array<float,2>{0.143259421f, 0.501387835f},
-std::array<float,2>{0.525019884f, 0.374527454f},
-std::array<float,2>{0.455828846f, 0.351019204f},
-std::array<float,2>{0.878149629f, 0.528538823f},
-std::array<float,2>{0.179529279f, 0.982914269f},
-std::array<float,2>{0.534281731f, 0.0858260691f},
-std::array<float,2>{0.0316840783f, 0.197445691f},
-std::array<float,2>{0.747772753f, 0.805042148f},
-std::array<float,2>{0.359179318f, 0.739909947f},
-std::array<float,2>{0.866240561f, 0.489016712f},
-std::array<float,2>{0.210418016f, 0.4047364f},
-std::array<float,2>{0.609585404f, 0.672192335f},
-std::array<float,2>{0.430376291f, 0.846523225f},
-std::array<float,2>{0.993461192f, 0.180528685f},
-std::array<float,2>{0.294678062f, 0.0123839863f},
-std::array<float,2>{0.785792232f, 0.905400276f},
-std::array<float,2>{0.0850730464f, 0.564834595f},
-std::array<float,2>{0.639208734f, 0.301936209f},
-std::array<float,2>{0.316198289f, 0.453265458f},
-std::array<float,2>{0.820061266f, 0.698463082f},
-std::array<float,2>{0.0246921573f, 0.770564497f},
-std::array<float,2>{0.695253134f, 0.231980845f},
-std::array<float,2>{0.140556112f, 0.105488352f},
-std::array<float,2>{0.504549444f, 0.956984162f},
-std::array<float,2>{0.477907687f, 0.537305534f},
-std::array<float,2>{0.907345355f, 0.314893246f},
-std::array<float,2>{0.117507555f, 0.277808219f},
-std::array<float,2>{0.662737191f, 0.596113026f},
-std::array<float,2>{0.269081056f, 0.908033788f},
-std::array<float,2>{0.7665416f, 0.0518077351f},
-std::array<float,2>{0.402518451f, 0.132222503f},
-std::array<float,2>{0.954712272f, 0.826433897f},
-std::array<float,2>{0.224279568f, 0.646499872f},
-std::array<float,2>{0.580470622f, 0.407148659f},
-std::array<float,2>{0.445693552f, 0.391673356f},
-std::array<float,2>{0.895568013f, 0.684955895f},
-std::array<float,2>{0.169079274f, 0.858741701f},
-std::array<float,2>{0.55089736f, 0.179123253f},
-std::array<float,2>{0.0562285595f, 0.00154350651f},
-std::array<float,2>{0.722437561f, 0.896769047f},
-std::array<float,2>{0.372012258f, 0.576619804f},
-std::array<float,2>{0.858385086f, 0.307445556f},
-std::array<float,2>{0.201725036f, 0.353332549f},
-std::array<float,2>{0.596929848f, 0.52257061f},
-std::array<float,2>{0.410423487f, 0.970474303f},
-std::array<float,2>{0.975639462f, 0.0898848996f},
-std::array<float,2>{0.303580582f, 0.19359982f},
-std::array<float,2>{0.801147521f, 0.801093996f},
-std::array<float,2>{0.0780067444f, 0.745668232f},
-std::array<float,2>{0.652689397f, 0.495063782f},
-std::array<float,2>{0.340649009f, 0.271371126f},
-std::array<float,2>{0.834683955f, 0.607219756f},
-std::array<float,2>{0.00621147454f, 0.920013189f},
-std::array<float,2>{0.704438031f, 0.0575896092f},
-std::array<float,2>{0.148432881f, 0.1379136f},
-std::array<float,2>{0.528463602f, 0.814050317f},
-std::array<float,2>{0.493014038f, 0.65217942f},
-std::array<float,2>{0.932162523f, 0.419877291f},
-std::array<float,2>{0.107179455f, 0.466700226f},
-std::array<float,2>{0.673552275f, 0.690050006f},
-std::array<float,2>{0.255050391f, 0.780860662f},
-std::array<float,2>{0.757672191f, 0.225145563f},
-std::array<float,2>{0.376028597f, 0.100788392f},
-std::array<float,2>{0.943529904f, 0.965544164f},
-std::array<float,2>{0.242882922f, 0.546368003f},
-std::array<float,2>{0.563816547f, 0.32682994f},
-std::array<float,2>{0.436819047f, 0.328321666f},
-std::array<float,2>{0.999684155f, 0.559868872f},
-std::array<float,2>{0.204201952f, 0.948116243f},
-std::array<float,2>{0.613692284f, 0.124642089f},
-std::array<float,2>{0.081844382f, 0.238002732f},
-std::array<float,2>{0.633707464f, 0.760631502f},
-std::array<float,2>{0.289630055f, 0.70337677f},
-std::array<float,2>{0.782837987f, 0.448424697f},
-std::array<float,2>{0.174859732f, 0.42236492f},
-std::array<float,2>{0.536364615f, 0.631795049f},
-std::array<float,2>{0.45973286f, 0.840351224f},
-std::array<float,2>{0.881973267f, 0.142190978f},
-std::array<float,2>{0.35396716f, 0.0384402722f},
-std::array<float,2>{0.860456645f, 0.934344292f},
-std::array<float,2>{0.0354520157f, 0.615837097f},
-std::array<float,2>{0.744268775f, 0.26094842f},
-std::array<float,2>{0.272229105f, 0.479471058f},
-std::array<float,2>{0.771191895f, 0.722405851f},
-std::array<float,2>{0.124354996f, 0.788390338f},
-std::array<float,2>{0.656360924f, 0.20601055f},
-std::array<float,2>{0.222229183f, 0.0746805891f},
-std::array<float,2>{0.582134783f, 0.988099039f},
-std::array<float,2>{0.400865108f, 0.511059582f},
-std::array<float,2>{0.957289219f, 0.365148842f},
-std::array<float,2>{0.0281825382f, 0.287629217f},
-std::array<float,2>{0.688496888f, 0.586407244f},
-std::array<float,2>{0.317355603f, 0.885633349f},
-std::array<float,2>{0.815924346f, 0.0247622095f},
-std::array<float,2>{0.480478972f, 0.16835995f},
-std::array<float,2>{0.912114859f, 0.867635489f},
-std::array<float,2>{0.134719387f, 0.666830838f},
-std::array<float,2>{0.501649976f, 0.38117066f},
-std::array<float,2>{0.393113911f, 0.439293116f},
-std::array<float,2>{0.964187145f, 0.717868507f},
-std::array<float,2>{0.227536827f, 0.754230976f},
-std::array<float,2>{0.586931765f, 0.245821521f},
-std::array<float,2>{0.114033453f, 0.114555322f},
-std::array<float,2>{0.670390844f, 0.945230007f},
-std::array<float,2>{0.275665224f, 0.553889692f},
-std::array<float,2>{0.774669588f, 0.341656595f},
-std::array<float,2>{0.130772844f, 0.250874221f},
-std::array<float,2>{0.513508797f, 0.620055914f},
-std::array<float,2>{0.471892476f, 0.929243982f},
-std::array<float,2>{0.920964658f, 0.0439510755f},
-std::array<float,2>{0.322617441f, 0.151027814f},
-std::array<float,2>{0.826284945f, 0.830302775f},
-std::array<float,2>{0.0221030917f, 0.634058177f},
-std::array<float,2>{0.697702229f, 0.43400228f},
-std::array<float,2>{0.286641747f, 0.368364364f},
-std::array<float,2>{0.792920649f, 0.50395757f},
-std::array<float,2>{0.0931237787f, 0.997797191f},
-std::array<float,2>{0.63087064f, 0.066798836f},
-std::array<float,2>{0.211331531f, 0.218367398f},
-std::array<float,2>{0.618596196f, 0.790681958f},
-std::array<float,2>{0.423780411f, 0.728578568f},
-std::array<float,2>{0.98796767f, 0.471688032f},
-std::array<float,2>{0.0449564494f, 0.390476376f},
-std::array<float,2>{0.741321146f, 0.66390413f},
-std::array<float,2>{0.349448115f, 0.865914047f},
-std::array<float,2>{0.870640635f, 0.16026549f},
-std::array<float,2>{0.461316079f, 0.0212157499f},
-std::array<float,2>{0.883430362f, 0.875444293f},
-std::array<float,2>{0.180627987f, 0.579856277f},
-std::array<float,2>{0.539290309f, 0.289761931f},
-std::array<float,2>{0.48549071f, 0.29695192f},
-std::array<float,2>{0.929661155f, 0.569246471f},
-std::array<float,2>{0.154308587f, 0.899439871f},
-std::array<float,2>{0.5230304f, 0.00940810703f},
-std::array<float,2>{0.0101968758f, 0.186867401f},
-std::array<float,2>{0.712343872f, 0.850609183f},
-std::array<float,2>{0.332368553f, 0.67705363f},
-std::array<float,2>{0.840381682f, 0.401152134f},
-std::array<float,2>{0.24187243f, 0.4861404f},
-std::array<float,2>{0.573347986f, 0.734913051f},
-std::array<float,2>{0.382927537f, 0.811512411f},
-std::array<float,2>{0.946924031f, 0.199524f},
-std::array<float,2>{0.25791207f, 0.0814144462f},
-std::array<float,2>{0.761740923f, 0.979211092f},
-std::array<float,2>{0.100783095f, 0.526611626f},
-std::array<float,2>{0.684772193f, 0.343776584f},
-std::array<float,2>{0.365755975f, 0.412045091f},
-std::array<float,2>{0.845564008f, 0.641919971f},
-std::array<float,2>{0.0540527664f, 0.823474288f},
-std::array<float,2>{0.732481182f, 0.128752813f},
-std::array<float,2>{0.159590781f, 0.0471749902f},
-std::array<float,2>{0.558893919f, 0.913099408f},
-std::array<float,2>{0.44249323f, 0.600866795f},
-std::array<float,2>{0.899445713f, 0.277201772f},
-std::array<float,2>{0.0633565485f, 0.319842488f},
-std::array<float,2>{0.643285215f, 0.531256914f},
-std::array<float,2>{0.311232299f, 0.957451165f},
-std::array<float,2>{0.812095881f, 0.101815738f},
-std::array<float,2>{0.419048965f, 0.229731768f},
-std::array<float,2>{0.97821492f, 0.767406344f},
-std::array<float,2>{0.187593728f, 0.702103257f},
-std::array<float,2>{0.607882142f, 0.457633823f},
-std::array<float,2>{0.490222424f, 0.449917436f},
-std::array<float,2>{0.923242629f, 0.709361017f},
-std::array<float,2>{0.149902672f, 0.765412271f},
-std::array<float,2>{0.518783748f, 0.241487235f},
-std::array<float,2>{0.013166531f, 0.121082805f},
-std::array<float,2>{0.716064095f, 0.951004803f},
-std::array<float,2>{0.331101209f, 0.5584203f},
-std::array<float,2>{0.838215709f, 0.335514605f},
-std::array<float,2>{0.238095447f, 0.263941079f},
-std::array<float,2>{0.57803756f, 0.611383677f},
-std::array<float,2>{0.389561385f, 0.932757378f},
-std::array<float,2>{0.950353563f, 0.0325024687f},
-std::array<float,2>{0.264113247f, 0.146166399f},
-std::array<float,2>{0.759525537f, 0.838073015f},
-std::array<float,2>{0.0960788056f, 0.627114713f},
-std::array<float,2>{0.681505919f, 0.428918213f},
-std::array<float,2>{0.359618634f, 0.360610694f},
-std::array<float,2>{0.848778009f, 0.512228012f},
-std::array<float,2>{0.049584344f, 0.99178946f},
-std::array<float,2>{0.728090703f, 0.072330296f},
-std::array<float,2>{0.162492886f, 0.209029928f},
-std::array<float,2>{0.558122456f, 0.784395218f},
-std::array<float,2>{0.438811481f, 0.72288543f},
-std::array<float,2>{0.905778706f, 0.482742608f},
-std::array<float,2>{0.0691859648f, 0.376259893f},
-std::array<float,2>{0.644675314f, 0.667986751f},
-std::array<float,2>{0.305499047f, 0.873218417f},
-std::array<float,2>{0.807884932f, 0.167154863f},
-std::array<float,2>{0.416116059f, 0.0296034142f},
-std::array<float,2>{0.980523109f, 0.889960885f},
-std::array<float,2>{0.193826213f, 0.592865586f},
-std::array<float,2>{0.603944361f, 0.283674419f},
-std::array<float,2>{0.394927055f, 0.309771627f},
-std::array<float,2>{0.965364754f, 0.573361635f},
-std::array<float,2>{0.234152868f, 0.890872836f},
-std::array<float,2>{0.590925097f, 0.00457680132f},
-std::array<float,2>{0.112917975f, 0.174235433f},
-std::array<float,2>{0.666668773f, 0.852346063f},
-std::array<float,2>{0.281114787f, 0.681312859f},
-std::array<float,2>{0.778849185f, 0.396800458f},
-std::array<float,2>{0.126684204f, 0.499424517f},
-std::array<float,2>{0.50808239f, 0.746373653f},
-std::array<float,2>{0.47521317f, 0.797177553f},
-std::array<float,2>{0.914851248f, 0.188102514f},
-std::array<float,2>{0.327939421f, 0.0867233649f},
-std::array<float,2>{0.824023426f, 0.974899709f},
-std::array<float,2>{0.0161259845f, 0.518947423f},
-std::array<float,2>{0.699889481f, 0.358304799f},
-std::array<float,2>{0.28403616f, 0.417258948f},
-std::array<float,2>{0.79647392f, 0.65401715f},
-std::array<float,2>{0.0873925537f, 0.816449106f},
-std::array<float,2>{0.625089467f, 0.135524422f},
-std::array<float,2>{0.216265321f, 0.0589714199f},
-std::array<float,2>{0.623497546f, 0.917797029f},
-std::array<float,2>{0.427134544f, 0.602362394f},
-std::array<float,2>{0.992164373f, 0.266157269f},
-std::array<float,2>{0.0428894497f, 0.32115218f},
-std::array<float,2>{0.736789644f, 0.542960346f},
-std::array<float,2>{0.345512539f, 0.96336031f},
-std::array<float,2>{0.871618092f, 0.0961913988f},
-std::array<float,2>{0.46514079f, 0.221617818f},
-std::array<float,2>{0.887623072f, 0.775545478f},
-std::array<float,2>{0.184763938f, 0.69459635f},
-std::array<float,2>{0.545763612f, 0.46105063f},
-std::array<float,2>{0.430718541f, 0.403502136f},
-std::array<float,2>{0.992204785f, 0.674761772f},
-std::array<float,2>{0.209633335f, 0.844339311f},
-std::array<float,2>{0.611323476f, 0.182711288f},
-std::array<float,2>{0.0843406022f, 0.0137240347f},
-std::array<float,2>{0.639768422f, 0.902453959f},
-std::array<float,2>{0.29389295f, 0.562699497f},
-std::array<float,2>{0.786950588f, 0.302943379f},
-std::array<float,2>{0.17800124f, 0.349360019f},
-std::array<float,2>{0.534036696f, 0.530965209f},
-std::array<float,2>{0.456837088f, 0.981661737f},
-std::array<float,2>{0.877235353f, 0.0820796713f},
-std::array<float,2>{0.358263373f, 0.196532726f},
-std::array<float,2>{0.865854144f, 0.807205558f},
-std::array<float,2>{0.0327667966f, 0.741482913f},
-std::array<float,2>{0.74669534f, 0.49137193f},
-std::array<float,2>{0.267710268f, 0.280694723f},
-std::array<float,2>{0.76713568f, 0.594801664f},
-std::array<float,2>{0.11903175f, 0.90928942f},
-std::array<float,2>{0.663683951f, 0.0543262586f},
-std::array<float,2>{0.222817466f, 0.129250199f},
-std::array<float,2>{0.581853807f, 0.826029658f},
-std::array<float,2>{0.403328121f, 0.646331608f},
-std::array<float,2>{0.953899503f, 0.408266187f},
-std::array<float,2>{0.0238345582f, 0.455507576f},
-std::array<float,2>{0.693950236f, 0.695557654f},
-std::array<float,2>{0.315076679f, 0.773263276f},
-std::array<float,2>{0.818792939f, 0.234261811f},
-std::array<float,2>{0.477334499f, 0.107776232f},
-std::array<float,2>{0.906532347f, 0.953273714f},
-std::array<float,2>{0.139212266f, 0.537019849f},
-std::array<float,2>{0.505695224f, 0.314417958f},
-std::array<float,2>{0.450573027f, 0.338626236f},
-std::array<float,2>{0.893003225f, 0.550382137f},
-std::array<float,2>{0.16736187f, 0.938643634f},
-std::array<float,2>{0.549388587f, 0.111255541f},
-std::array<float,2>{0.0608238652f, 0.246100649f},
-std::array<float,2>{0.72640413f, 0.751283884f},
-std::array<float,2>{0.368432283f, 0.71395576f},
-std::array<float,2>{0.853331149f, 0.442303181f},
-std::array<float,2>{0.198517337f, 0.431318939f},
-std::array<float,2>{0.598059058f, 0.637932181f},
-std::array<float,2>{0.40729329f, 0.835819066f},
-std::array<float,2>{0.97144562f, 0.154059693f},
-std::array<float,2>{0.299349815f, 0.0398556963f},
-std::array<float,2>{0.800712824f, 0.924321055f},
-std::array<float,2>{0.0705157891f, 0.622050703f},
-std::array<float,2>{0.64922142f, 0.256760299f},
-std::array<float,2>{0.338043809f, 0.47283569f},
-std::array<float,2>{0.830843866f, 0.733665586f},
-std::array<float,2>{0.000423446327f, 0.793435872f},
-std::array<float,2>{0.710427165f, 0.211601362f},
-std::array<float,2>{0.144240454f, 0.0638560206f},
-std::array<float,2>{0.52400285f, 0.993308187f},
-std::array<float,2>{0.496137679f, 0.503600061f},
-std::array<float,2>{0.936496317f, 0.3715128f},
-std::array<float,2>{0.101666734f, 0.296165526f},
-std::array<float,2>{0.676196754f, 0.58308661f},
-std::array<float,2>{0.251700878f, 0.879910827f},
-std::array<float,2>{0.753056467f, 0.0167607404f},
-std::array<float,2>{0.381153613f, 0.157251462f},
-std::array<float,2>{0.939118922f, 0.860151589f},
-std::array<float,2>{0.246095464f, 0.658409357f},
-std::array<float,2>{0.569040418f, 0.385372549f},
-std::array<float,2>{0.460858822f, 0.424651623f},
-std::array<float,2>{0.881835461f, 0.629059732f},
-std::array<float,2>{0.174243957f, 0.843039513f},
-std::array<float,2>{0.535498977f, 0.144041568f},
-std::array<float,2>{0.0368677899f, 0.0368762352f},
-std::array<float,2>{0.745785236f, 0.936744988f},
-std::array<float,2>{0.354594916f, 0.614494503f},
-std::array<float,2>{0.859754026f, 0.258999765f},
-std::array<float,2>{0.203679353f, 0.331503958f},
-std::array<float,2>{0.614282072f, 0.560649633f},
-std::array<float,2>{0.435957104f, 0.946413517f},
-std::array<float,2>{0.998051763f, 0.122361869f},
-std::array<float,2>{0.290294886f, 0.236151934f},
-std::array<float,2>{0.781286478f, 0.758864701f},
-std::array<float,2>{0.0801751614f, 0.70677036f},
-std::array<float,2>{0.634068131f, 0.446471304f},
-std::array<float,2>{0.318193614f, 0.286375701f},
-std::array<float,2>{0.815005362f, 0.588292301f},
-std::array<float,2>{0.0287889801f, 0.882867217f},
-std::array<float,2>{0.687759578f, 0.0255787149f},
-std::array<float,2>{0.133574471f, 0.17012836f},
-std::array<float,2>{0.500809073f, 0.870193303f},
-std::array<float,2>{0.481586128f, 0.665235996f},
-std::array<float,2>{0.913505673f, 0.380635917f},
-std::array<float,2>{0.12323676f, 0.478068113f},
-std::array<float,2>{0.657777071f, 0.71948123f},
-std::array<float,2>{0.27264446f, 0.785677016f},
-std::array<float,2>{0.770045459f, 0.204441816f},
-std::array<float,2>{0.401751876f, 0.0769058987f},
-std::array<float,2>{0.958375335f, 0.984602213f},
-std::array<float,2>{0.221366659f, 0.508433104f},
-std::array<float,2>{0.583583474f, 0.365824491f},
-std::array<float,2>{0.411723405f, 0.354965538f},
-std::array<float,2>{0.975426197f, 0.520632803f},
-std::array<float,2>{0.203053072f, 0.971365631f},
-std::array<float,2>{0.596511662f, 0.093149282f},
-std::array<float,2>{0.0770992339f, 0.192144707f},
-std::array<float,2>{0.653816819f, 0.80372268f},
-std::array<float,2>{0.304468334f, 0.743040025f},
-std::array<float,2>{0.802212477f, 0.493699551f},
-std::array<float,2>{0.168389469f, 0.393327475f},
-std::array<float,2>{0.552175283f, 0.686262906f},
-std::array<float,2>{0.447018713f, 0.856216908f},
-std::array<float,2>{0.894740403f, 0.176668018f},
-std::array<float,2>{0.372978628f, 0.00321715279f},
-std::array<float,2>{0.858624816f, 0.894982815f},
-std::array<float,2>{0.0549528748f, 0.575141966f},
-std::array<float,2>{0.721165776f, 0.30647099f},
-std::array<float,2>{0.254876792f, 0.468138427f},
-std::array<float,2>{0.75643295f, 0.688760161f},
-std::array<float,2>{0.106386535f, 0.778036773f},
-std::array<float,2>{0.671949923f, 0.22353293f},
-std::array<float,2>{0.244081602f, 0.0980298966f},
-std::array<float,2>{0.562750876f, 0.968721926f},
-std::array<float,2>{0.375448495f, 0.543038011f},
-std::array<float,2>{0.94479233f, 0.32601583f},
-std::array<float,2>{0.00686348183f, 0.271834373f},
-std::array<float,2>{0.703354955f, 0.607587397f},
-std::array<float,2>{0.340836793f, 0.918272555f},
-std::array<float,2>{0.835180283f, 0.0561621413f},
-std::array<float,2>{0.493627042f, 0.13949801f},
-std::array<float,2>{0.933275461f, 0.814769685f},
-std::array<float,2>{0.146856517f, 0.648675025f},
-std::array<float,2>{0.52823025f, 0.42082119f},
-std::array<float,2>{0.383930445f, 0.487978756f},
-std::array<float,2>{0.945800781f, 0.736890674f},
-std::array<float,2>{0.240363613f, 0.809427738f},
-std::array<float,2>{0.573150873f, 0.201723516f},
-std::array<float,2>{0.099647738f, 0.0783512518f},
-std::array<float,2>{0.684316754f, 0.977838755f},
-std::array<float,2>{0.259342492f, 0.525289178f},
-std::array<float,2>{0.763334513f, 0.346062392f},
-std::array<float,2>{0.15559873f, 0.299652308f},
-std::array<float,2>{0.522278666f, 0.56649071f},
-std::array<float,2>{0.485039264f, 0.90064472f},
-std::array<float,2>{0.928488433f, 0.00995591842f},
-std::array<float,2>{0.333820611f, 0.183613971f},
-std::array<float,2>{0.841787636f, 0.848817468f},
-std::array<float,2>{0.0116653033f, 0.678768814f},
-std::array<float,2>{0.711157143f, 0.39949581f},
-std::array<float,2>{0.311878175f, 0.317707837f},
-std::array<float,2>{0.811207891f, 0.534563422f},
-std::array<float,2>{0.0636180416f, 0.95925051f},
-std::array<float,2>{0.644432843f, 0.104641601f},
-std::array<float,2>{0.188881129f, 0.227623254f},
-std::array<float,2>{0.608941257f, 0.767600715f},
-std::array<float,2>{0.418666333f, 0.700873315f},
-std::array<float,2>{0.976828933f, 0.460129857f},
-std::array<float,2>{0.0534213074f, 0.413031906f},
-std::array<float,2>{0.733754754f, 0.643311083f},
-std::array<float,2>{0.366853952f, 0.82171154f},
-std::array<float,2>{0.844166994f, 0.12646459f},
-std::array<float,2>{0.441844225f, 0.0504072867f},
-std::array<float,2>{0.898703575f, 0.911285818f},
-std::array<float,2>{0.158372134f, 0.598373353f},
-std::array<float,2>{0.560222685f, 0.273930401f},
-std::array<float,2>{0.471327007f, 0.252457112f},
-std::array<float,2>{0.920608282f, 0.618883491f},
-std::array<float,2>{0.129666448f, 0.926837623f},
-std::array<float,2>{0.512285233f, 0.0455855653f},
-std::array<float,2>{0.0228917003f, 0.149630412f},
-std::array<float,2>{0.698397338f, 0.828630567f},
-std::array<float,2>{0.323905587f, 0.636149585f},
-std::array<float,2>{0.827185869f, 0.435969949f},
-std::array<float,2>{0.228476048f, 0.439693391f},
-std::array<float,2>{0.586419702f, 0.716241419f},
-std::array<float,2>{0.394026905f, 0.756790638f},
-std::array<float,2>{0.963320494f, 0.24406749f},
-std::array<float,2>{0.27731216f, 0.115727633f},
-std::array<float,2>{0.774275422f, 0.941703856f},
-std::array<float,2>{0.115054458f, 0.552012444f},
-std::array<float,2>{0.671739399f, 0.342533827f},
-std::array<float,2>{0.348347217f, 0.387188762f},
-std::array<float,2>{0.869476676f, 0.66055721f},
-std::array<float,2>{0.0463828705f, 0.863534153f},
-std::array<float,2>{0.741198421f, 0.163613513f},
-std::array<float,2>{0.18111442f, 0.0226973705f},
-std::array<float,2>{0.540584862f, 0.878188431f},
-std::array<float,2>{0.462562323f, 0.58165282f},
-std::array<float,2>{0.884698987f, 0.292403251f},
-std::array<float,2>{0.0922653228f, 0.370391935f},
-std::array<float,2>{0.632775486f, 0.5075441f},
-std::array<float,2>{0.285272688f, 0.998648703f},
-std::array<float,2>{0.791981161f, 0.0697556883f},
-std::array<float,2>{0.422736615f, 0.216745913f},
-std::array<float,2>{0.986599088f, 0.792131007f},
-std::array<float,2>{0.212211415f, 0.72730875f},
-std::array<float,2>{0.617354929f, 0.468859404f},
-std::array<float,2>{0.441277593f, 0.480870515f},
-std::array<float,2>{0.902861476f, 0.726123095f},
-std::array<float,2>{0.162088454f, 0.781573892f},
-std::array<float,2>{0.556268871f, 0.207993954f},
-std::array<float,2>{0.0481353439f, 0.0719781667f},
-std::array<float,2>{0.729022086f, 0.989933431f},
-std::array<float,2>{0.361931503f, 0.514307022f},
-std::array<float,2>{0.850460351f, 0.361990035f},
-std::array<float,2>{0.193021759f, 0.282928407f},
-std::array<float,2>{0.601860881f, 0.591150045f},
-std::array<float,2>{0.415861279f, 0.888164341f},
-std::array<float,2>{0.982954979f, 0.0273593888f},
-std::array<float,2>{0.308079988f, 0.164385334f},
-std::array<float,2>{0.806461573f, 0.872008562f},
-std::array<float,2>{0.0682820231f, 0.67142421f},
-std::array<float,2>{0.646664321f, 0.378460586f},
-std::array<float,2>{0.328799337f, 0.333253682f},
-std::array<float,2>{0.837505579f, 0.554753363f},
-std::array<float,2>{0.0147324558f, 0.952282131f},
-std::array<float,2>{0.718316793f, 0.117959693f},
-std::array<float,2>{0.150636286f, 0.240160331f},
-std::array<float,2>{0.516208291f, 0.762547135f},
-std::array<float,2>{0.490870148f, 0.708699226f},
-std::array<float,2>{0.924216688f, 0.451470792f},
-std::array<float,2>{0.0954840258f, 0.426375479f},
-std::array<float,2>{0.682778835f, 0.625082076f},
-std::array<float,2>{0.26190269f, 0.837413311f},
-std::array<float,2>{0.761598885f, 0.146585703f},
-std::array<float,2>{0.387168169f, 0.0345840044f},
-std::array<float,2>{0.952198744f, 0.930160224f},
-std::array<float,2>{0.235097125f, 0.611187637f},
-std::array<float,2>{0.576089263f, 0.262630016f},
-std::array<float,2>{0.428541094f, 0.268736601f},
-std::array<float,2>{0.988912761f, 0.604744196f},
-std::array<float,2>{0.218600377f, 0.915389597f},
-std::array<float,2>{0.622354448f, 0.0611412264f},
-std::array<float,2>{0.0889420137f, 0.134453699f},
-std::array<float,2>{0.628591776f, 0.819191813f},
-std::array<float,2>{0.283202261f, 0.654383004f},
-std::array<float,2>{0.793317497f, 0.414088726f},
-std::array<float,2>{0.186404511f, 0.464341342f},
-std::array<float,2>{0.543332219f, 0.692461312f},
-std::array<float,2>{0.467420071f, 0.773707986f},
-std::array<float,2>{0.888913691f, 0.219812974f},
-std::array<float,2>{0.347591996f, 0.0949334651f},
-std::array<float,2>{0.873589933f, 0.961463749f},
-std::array<float,2>{0.0400470532f, 0.540768266f},
-std::array<float,2>{0.73619324f, 0.322926909f},
-std::array<float,2>{0.277514696f, 0.394892126f},
-std::array<float,2>{0.779531479f, 0.682193875f},
-std::array<float,2>{0.110676005f, 0.855449617f},
-std::array<float,2>{0.664123476f, 0.172762737f},
-std::array<float,2>{0.231928796f, 0.00706884544f},
-std::array<float,2>{0.593114078f, 0.894153476f},
-std::array<float,2>{0.396856904f, 0.571913064f},
-std::array<float,2>{0.968627632f, 0.311309755f},
-std::array<float,2>{0.0191692729f, 0.356725782f},
-std::array<float,2>{0.7027964f, 0.517471313f},
-std::array<float,2>{0.325056493f, 0.97274822f},
-std::array<float,2>{0.821645558f, 0.0886637047f},
-std::array<float,2>{0.473713815f, 0.190706566f},
-std::array<float,2>{0.916507423f, 0.799897254f},
-std::array<float,2>{0.128674343f, 0.749252975f},
-std::array<float,2>{0.511102855f, 0.496665001f},
-std::array<float,2>{0.405918956f, 0.407713294f},
-std::array<float,2>{0.956427515f, 0.647514701f},
-std::array<float,2>{0.224802434f, 0.828112364f},
-std::array<float,2>{0.579605818f, 0.131378174f},
-std::array<float,2>{0.119661264f, 0.0509359278f},
-std::array<float,2>{0.660896778f, 0.906740665f},
-std::array<float,2>{0.265849352f, 0.59732163f},
-std::array<float,2>{0.768611491f, 0.278792471f},
-std::array<float,2>{0.13780655f, 0.315915972f},
-std::array<float,2>{0.507100582f, 0.538740993f},
-std::array<float,2>{0.478975236f, 0.955680072f},
-std::array<float,2>{0.908800066f, 0.106856026f},
-std::array<float,2>{0.313955396f, 0.23060827f},
-std::array<float,2>{0.816614151f, 0.770115554f},
-std::array<float,2>{0.0266804788f, 0.697750211f},
-std::array<float,2>{0.692871451f, 0.45422405f},
-std::array<float,2>{0.296446413f, 0.301437497f},
-std::array<float,2>{0.787980855f, 0.565494716f},
-std::array<float,2>{0.0830015987f, 0.904603004f},
-std::array<float,2>{0.637958884f, 0.0135958241f},
-std::array<float,2>{0.207744092f, 0.180905953f},
-std::array<float,2>{0.611806691f, 0.846942723f},
-std::array<float,2>{0.433421761f, 0.673496187f},
-std::array<float,2>{0.994436502f, 0.406110793f},
-std::array<float,2>{0.0339818038f, 0.489569694f},
-std::array<float,2>{0.748639107f, 0.739006639f},
-std::array<float,2>{0.357176125f, 0.806284606f},
-std::array<float,2>{0.864123166f, 0.198772714f},
-std::array<float,2>{0.455040604f, 0.0842059329f},
-std::array<float,2>{0.875912309f, 0.984157503f},
-std::array<float,2>{0.177409649f, 0.527650714f},
-std::array<float,2>{0.533083975f, 0.349992901f},
-std::array<float,2>{0.499963641f, 0.373094469f},
-std::array<float,2>{0.933620989f, 0.50034529f},
-std::array<float,2>{0.141276702f, 0.99431181f},
-std::array<float,2>{0.526232898f, 0.0661885962f},
-std::array<float,2>{0.00383770489f, 0.214611754f},
-std::array<float,2>{0.708907723f, 0.79629159f},
-std::array<float,2>{0.337063849f, 0.731449008f},
-std::array<float,2>{0.829118371f, 0.476397604f},
-std::array<float,2>{0.248218879f, 0.384107232f},
-std::array<float,2>{0.567905068f, 0.657865584f},
-std::array<float,2>{0.380796432f, 0.862370491f},
-std::array<float,2>{0.939821482f, 0.159863889f},
-std::array<float,2>{0.253144413f, 0.018534109f},
-std::array<float,2>{0.751100957f, 0.881398082f},
-std::array<float,2>{0.105252326f, 0.585032284f},
-std::array<float,2>{0.678475261f, 0.294504821f},
-std::array<float,2>{0.37016663f, 0.44393158f},
-std::array<float,2>{0.853847623f, 0.711672604f},
-std::array<float,2>{0.0589434952f, 0.753731728f},
-std::array<float,2>{0.723604798f, 0.249140084f},
-std::array<float,2>{0.165601f, 0.112136401f},
-std::array<float,2>{0.54740423f, 0.939560056f},
-std::array<float,2>{0.452491879f, 0.54852128f},
-std::array<float,2>{0.892228067f, 0.33739236f},
-std::array<float,2>{0.0732084438f, 0.254777998f},
-std::array<float,2>{0.651431859f, 0.623362184f},
-std::array<float,2>{0.297054499f, 0.923450887f},
-std::array<float,2>{0.798671424f, 0.0414280482f},
-std::array<float,2>{0.409207851f, 0.155384272f},
-std::array<float,2>{0.970360577f, 0.833271325f},
-std::array<float,2>{0.195691377f, 0.638991058f},
-std::array<float,2>{0.600633681f, 0.432719231f},
-std::array<float,2>{0.483453393f, 0.382230759f},
-std::array<float,2>{0.911749125f, 0.667352378f},
-std::array<float,2>{0.136564076f, 0.868406177f},
-std::array<float,2>{0.503174484f, 0.169646367f},
-std::array<float,2>{0.0294026081f, 0.0242195763f},
-std::array<float,2>{0.689487219f, 0.886163712f},
-std::array<float,2>{0.318422586f, 0.587316751f},
-std::array<float,2>{0.813337505f, 0.288373709f},
-std::array<float,2>{0.218906239f, 0.364149749f},
-std::array<float,2>{0.585314155f, 0.510403514f},
-std::array<float,2>{0.399873078f, 0.987303138f},
-std::array<float,2>{0.959078848f, 0.0758054331f},
-std::array<float,2>{0.271400958f, 0.206441522f},
-std::array<float,2>{0.772370458f, 0.787718356f},
-std::array<float,2>{0.121872835f, 0.72078079f},
-std::array<float,2>{0.658608913f, 0.479827642f},
-std::array<float,2>{0.352839381f, 0.260501295f},
-std::array<float,2>{0.861817598f, 0.616343796f},
-std::array<float,2>{0.0374540389f, 0.934941053f},
-std::array<float,2>{0.743025482f, 0.0377133824f},
-std::array<float,2>{0.172857955f, 0.141433388f},
-std::array<float,2>{0.538432837f, 0.841332674f},
-std::array<float,2>{0.457196653f, 0.63254559f},
-std::array<float,2>{0.88070184f, 0.423728526f},
-std::array<float,2>{0.078463003f, 0.448030323f},
-std::array<float,2>{0.634944797f, 0.704551041f},
-std::array<float,2>{0.292629153f, 0.761511624f},
-std::array<float,2>{0.784531057f, 0.236602694f},
-std::array<float,2>{0.434431702f, 0.123422645f},
-std::array<float,2>{0.997685134f, 0.948260546f},
-std::array<float,2>{0.205901816f, 0.559060752f},
-std::array<float,2>{0.616350293f, 0.329436332f},
-std::array<float,2>{0.378323585f, 0.327685893f},
-std::array<float,2>{0.941476524f, 0.544978321f},
-std::array<float,2>{0.245053068f, 0.965911746f},
-std::array<float,2>{0.565555751f, 0.0998158604f},
-std::array<float,2>{0.108168148f, 0.226312399f},
-std::array<float,2>{0.675427139f, 0.779653668f},
-std::array<float,2>{0.25775829f, 0.690725029f},
-std::array<float,2>{0.754451573f, 0.465806574f},
-std::array<float,2>{0.145872965f, 0.418168157f},
-std::array<float,2>{0.530717552f, 0.650902569f},
-std::array<float,2>{0.495288998f, 0.813264132f},
-std::array<float,2>{0.930705547f, 0.136749282f},
-std::array<float,2>{0.343247592f, 0.0576683581f},
-std::array<float,2>{0.83286494f, 0.921708822f},
-std::array<float,2>{0.00408902066f, 0.605969071f},
-std::array<float,2>{0.705956459f, 0.270035535f},
-std::array<float,2>{0.301592529f, 0.495493233f},
-std::array<float,2>{0.803276956f, 0.744293392f},
-std::array<float,2>{0.0760773197f, 0.801781595f},
-std::array<float,2>{0.654720366f, 0.194985121f},
-std::array<float,2>{0.200867146f, 0.0915026665f},
-std::array<float,2>{0.594448447f, 0.969706059f},
-std::array<float,2>{0.413786739f, 0.521583378f},
-std::array<float,2>{0.973681808f, 0.351661563f},
-std::array<float,2>{0.0584302172f, 0.307768673f},
-std::array<float,2>{0.719129264f, 0.577824831f},
-std::array<float,2>{0.373877943f, 0.897615135f},
-std::array<float,2>{0.856134057f, 0.000508180179f},
-std::array<float,2>{0.448697299f, 0.17828463f},
-std::array<float,2>{0.89739871f, 0.858210683f},
-std::array<float,2>{0.171628326f, 0.683686733f},
-std::array<float,2>{0.552779734f, 0.391408145f},
-std::array<float,2>{0.421094388f, 0.45871076f},
-std::array<float,2>{0.979665279f, 0.702343464f},
-std::array<float,2>{0.190884352f, 0.765821636f},
-std::array<float,2>{0.60737896f, 0.228643879f},
-std::array<float,2>{0.0646329671f, 0.102583446f},
-std::array<float,2>{0.641620934f, 0.958009183f},
-std::array<float,2>{0.310200542f, 0.533031106f},
-std::array<float,2>{0.809453547f, 0.318921417f},
-std::array<float,2>{0.15654698f, 0.275468379f},
-std::array<float,2>{0.56098038f, 0.600269258f},
-std::array<float,2>{0.444607139f, 0.912558138f},
-std::array<float,2>{0.901245058f, 0.0481785499f},
-std::array<float,2>{0.363392413f, 0.127877742f},
-std::array<float,2>{0.846731484f, 0.822444439f},
-std::array<float,2>{0.0516653806f, 0.640886724f},
-std::array<float,2>{0.731711328f, 0.41082865f},
-std::array<float,2>{0.261596173f, 0.345235318f},
-std::array<float,2>{0.764047444f, 0.526151121f},
-std::array<float,2>{0.097784549f, 0.980333805f},
-std::array<float,2>{0.687145233f, 0.0809661597f},
-std::array<float,2>{0.239428952f, 0.200556591f},
-std::array<float,2>{0.570674717f, 0.811553001f},
-std::array<float,2>{0.386716187f, 0.735483527f},
-std::array<float,2>{0.948899925f, 0.485051215f},
-std::array<float,2>{0.00903411862f, 0.401846409f},
-std::array<float,2>{0.713315368f, 0.676584721f},
-std::array<float,2>{0.334349692f, 0.850472331f},
-std::array<float,2>{0.842312813f, 0.185670286f},
-std::array<float,2>{0.486492604f, 0.00796470419f},
-std::array<float,2>{0.92770499f, 0.898711622f},
-std::array<float,2>{0.153920352f, 0.569884241f},
-std::array<float,2>{0.520601511f, 0.29879874f},
-std::array<float,2>{0.463405281f, 0.29095009f},
-std::array<float,2>{0.885342538f, 0.57903868f},
-std::array<float,2>{0.181901529f, 0.876903772f},
-std::array<float,2>{0.541545749f, 0.0196229126f},
-std::array<float,2>{0.0432473496f, 0.161840364f},
-std::array<float,2>{0.740191162f, 0.867179811f},
-std::array<float,2>{0.350539416f, 0.663069844f},
-std::array<float,2>{0.86778295f, 0.389259934f},
-std::array<float,2>{0.213901386f, 0.471035153f},
-std::array<float,2>{0.620440304f, 0.729866028f},
-std::array<float,2>{0.423846781f, 0.789737165f},
-std::array<float,2>{0.985133767f, 0.217255622f},
-std::array<float,2>{0.287726253f, 0.0681429058f},
-std::array<float,2>{0.789378405f, 0.996875405f},
-std::array<float,2>{0.0904728249f, 0.505706429f},
-std::array<float,2>{0.630695641f, 0.367835224f},
-std::array<float,2>{0.321101516f, 0.434959859f},
-std::array<float,2>{0.825610578f, 0.632887065f},
-std::array<float,2>{0.0203766115f, 0.831986606f},
-std::array<float,2>{0.696342885f, 0.152171835f},
-std::array<float,2>{0.130996495f, 0.0433123f},
-std::array<float,2>{0.515295029f, 0.928545237f},
-std::array<float,2>{0.46960184f, 0.620337963f},
-std::array<float,2>{0.9193753f, 0.251407593f},
-std::array<float,2>{0.11639984f, 0.340436906f},
-std::array<float,2>{0.668877542f, 0.553418815f},
-std::array<float,2>{0.273473978f, 0.944278002f},
-std::array<float,2>{0.775584161f, 0.114250228f},
-std::array<float,2>{0.391972989f, 0.244911015f},
-std::array<float,2>{0.961146951f, 0.75565511f},
-std::array<float,2>{0.23009643f, 0.716844797f},
-std::array<float,2>{0.587921023f, 0.438052386f},
-std::array<float,2>{0.444427788f, 0.459570229f},
-std::array<float,2>{0.901058733f, 0.69943738f},
-std::array<float,2>{0.15647231f, 0.769335926f},
-std::array<float,2>{0.560714066f, 0.227124318f},
-std::array<float,2>{0.0513636582f, 0.103621706f},
-std::array<float,2>{0.731473327f, 0.96058768f},
-std::array<float,2>{0.363581181f, 0.533544838f},
-std::array<float,2>{0.847097039f, 0.317237258f},
-std::array<float,2>{0.190669343f, 0.274467885f},
-std::array<float,2>{0.607052326f, 0.599168301f},
-std::array<float,2>{0.421230763f, 0.910719752f},
-std::array<float,2>{0.979966521f, 0.0489279702f},
-std::array<float,2>{0.31032145f, 0.125943944f},
-std::array<float,2>{0.809089124f, 0.820888281f},
-std::array<float,2>{0.0647531226f, 0.643756092f},
-std::array<float,2>{0.641911685f, 0.413472712f},
-std::array<float,2>{0.334116787f, 0.347003251f},
-std::array<float,2>{0.842599392f, 0.524038076f},
-std::array<float,2>{0.00896093529f, 0.977478445f},
-std::array<float,2>{0.712941527f, 0.0796104148f},
-std::array<float,2>{0.154104441f, 0.202406466f},
-std::array<float,2>{0.520874977f, 0.80962193f},
-std::array<float,2>{0.486629874f, 0.737634361f},
-std::array<float,2>{0.927448213f, 0.487227976f},
-std::array<float,2>{0.0980743244f, 0.39895016f},
-std::array<float,2>{0.687293887f, 0.678225458f},
-std::array<float,2>{0.261273921f, 0.847791076f},
-std::array<float,2>{0.763686717f, 0.18508473f},
-std::array<float,2>{0.38634944f, 0.0116541963f},
-std::array<float,2>{0.949175715f, 0.901571929f},
-std::array<float,2>{0.239538208f, 0.567920744f},
-std::array<float,2>{0.570418119f, 0.300578743f},
-std::array<float,2>{0.424215406f, 0.291531861f},
-std::array<float,2>{0.985052824f, 0.580220282f},
-std::array<float,2>{0.214148596f, 0.877790987f},
-std::array<float,2>{0.620278656f, 0.0221719462f},
-std::array<float,2>{0.090809375f, 0.162762791f},
-std::array<float,2>{0.630404711f, 0.864483714f},
-std::array<float,2>{0.28796491f, 0.661637068f},
-std::array<float,2>{0.789263248f, 0.388517827f},
-std::array<float,2>{0.181779727f, 0.470537871f},
-std::array<float,2>{0.541756332f, 0.728012085f},
-std::array<float,2>{0.463703752f, 0.791838646f},
-std::array<float,2>{0.885739803f, 0.215367734f},
-std::array<float,2>{0.350224346f, 0.0684623867f},
-std::array<float,2>{0.868095636f, 0.999162793f},
-std::array<float,2>{0.0430343896f, 0.506027818f},
-std::array<float,2>{0.739848077f, 0.369286209f},
-std::array<float,2>{0.273831427f, 0.437046796f},
-std::array<float,2>{0.77569586f, 0.634973586f},
-std::array<float,2>{0.116656743f, 0.829370499f},
-std::array<float,2>{0.66867888f, 0.148891106f},
-std::array<float,2>{0.230281666f, 0.0463154055f},
-std::array<float,2>{0.588298976f, 0.926390946f},
-std::array<float,2>{0.391667485f, 0.617663026f},
-std::array<float,2>{0.961378515f, 0.25387457f},
-std::array<float,2>{0.0201447196f, 0.343693197f},
-std::array<float,2>{0.69657737f, 0.5515064f},
-std::array<float,2>{0.32100004f, 0.943076372f},
-std::array<float,2>{0.825299561f, 0.11692822f},
-std::array<float,2>{0.469265819f, 0.242323905f},
-std::array<float,2>{0.919081271f, 0.757358432f},
-std::array<float,2>{0.131159991f, 0.715170979f},
-std::array<float,2>{0.515408576f, 0.441061795f},
-std::array<float,2>{0.399559081f, 0.379414976f},
-std::array<float,2>{0.959334254f, 0.66465503f},
-std::array<float,2>{0.219171211f, 0.869327009f},
-std::array<float,2>{0.584962904f, 0.170987427f},
-std::array<float,2>{0.121777207f, 0.0269216411f},
-std::array<float,2>{0.658299744f, 0.884402752f},
-std::array<float,2>{0.271223664f, 0.589188159f},
-std::array<float,2>{0.772009313f, 0.285701841f},
-std::array<float,2>{0.136313528f, 0.366762161f},
-std::array<float,2>{0.503019273f, 0.509572744f},
-std::array<float,2>{0.483692974f, 0.986034334f},
-std::array<float,2>{0.912073374f, 0.0774579942f},
-std::array<float,2>{0.318650961f, 0.203499764f},
-std::array<float,2>{0.813050449f, 0.786403716f},
-std::array<float,2>{0.029684497f, 0.720217645f},
-std::array<float,2>{0.689908087f, 0.476730883f},
-std::array<float,2>{0.292928576f, 0.258105278f},
-std::array<float,2>{0.784194231f, 0.613660455f},
-std::array<float,2>{0.0782408193f, 0.935752332f},
-std::array<float,2>{0.63502425f, 0.0352378152f},
-std::array<float,2>{0.205721587f, 0.143277809f},
-std::array<float,2>{0.616526127f, 0.842452288f},
-std::array<float,2>{0.434251875f, 0.630410194f},
-std::array<float,2>{0.998036325f, 0.425464898f},
-std::array<float,2>{0.0372069776f, 0.4454211f},
-std::array<float,2>{0.742794573f, 0.705524802f},
-std::array<float,2>{0.352702647f, 0.758607745f},
-std::array<float,2>{0.862181365f, 0.234597176f},
-std::array<float,2>{0.457304239f, 0.121867619f},
-std::array<float,2>{0.880461633f, 0.945365727f},
-std::array<float,2>{0.173161641f, 0.562199175f},
-std::array<float,2>{0.538186312f, 0.330573142f},
-std::array<float,2>{0.495513827f, 0.324339896f},
-std::array<float,2>{0.931137323f, 0.54491365f},
-std::array<float,2>{0.145575657f, 0.966933787f},
-std::array<float,2>{0.530365348f, 0.0987781659f},
-std::array<float,2>{0.00426183455f, 0.223806515f},
-std::array<float,2>{0.705674231f, 0.778632104f},
-std::array<float,2>{0.342783719f, 0.688341975f},
-std::array<float,2>{0.832663536f, 0.467363089f},
-std::array<float,2>{0.244709581f, 0.421234846f},
-std::array<float,2>{0.565675735f, 0.64991498f},
-std::array<float,2>{0.377959609f, 0.816237092f},
-std::array<float,2>{0.941826999f, 0.139738306f},
-std::array<float,2>{0.257336676f, 0.0552298017f},
-std::array<float,2>{0.754763663f, 0.919231534f},
-std::array<float,2>{0.107917123f, 0.609101355f},
-std::array<float,2>{0.67554307f, 0.273401022f},
-std::array<float,2>{0.373540074f, 0.492240191f},
-std::array<float,2>{0.856340528f, 0.743494272f},
-std::array<float,2>{0.058132425f, 0.80315721f},
-std::array<float,2>{0.718822837f, 0.192616284f},
-std::array<float,2>{0.171647877f, 0.092366226f},
-std::array<float,2>{0.553185701f, 0.972183645f},
-std::array<float,2>{0.448327601f, 0.520429075f},
-std::array<float,2>{0.897081017f, 0.354442418f},
-std::array<float,2>{0.0756936818f, 0.305117071f},
-std::array<float,2>{0.654529989f, 0.575701475f},
-std::array<float,2>{0.301343292f, 0.895612419f},
-std::array<float,2>{0.803592324f, 0.00263965293f},
-std::array<float,2>{0.413876683f, 0.176815376f},
-std::array<float,2>{0.974092722f, 0.857089877f},
-std::array<float,2>{0.201032639f, 0.686612248f},
-std::array<float,2>{0.59455055f, 0.39361316f},
-std::array<float,2>{0.478537202f, 0.409657031f},
-std::array<float,2>{0.908951223f, 0.645242095f},
-std::array<float,2>{0.138051629f, 0.825131357f},
-std::array<float,2>{0.506860971f, 0.12999329f},
-std::array<float,2>{0.0265374221f, 0.0534228049f},
-std::array<float,2>{0.693148434f, 0.908671021f},
-std::array<float,2>{0.313515395f, 0.594654322f},
-std::array<float,2>{0.816669285f, 0.280230999f},
-std::array<float,2>{0.225000143f, 0.312928885f},
-std::array<float,2>{0.579913497f, 0.535604537f},
-std::array<float,2>{0.406026155f, 0.954926968f},
-std::array<float,2>{0.956138551f, 0.109310076f},
-std::array<float,2>{0.265904307f, 0.233197421f},
-std::array<float,2>{0.768954098f, 0.771734297f},
-std::array<float,2>{0.119956128f, 0.696701765f},
-std::array<float,2>{0.660710931f, 0.45606038f},
-std::array<float,2>{0.357391179f, 0.304056823f},
-std::array<float,2>{0.863860369f, 0.563644171f},
-std::array<float,2>{0.0338208452f, 0.903440893f},
-std::array<float,2>{0.74890554f, 0.0149547979f},
-std::array<float,2>{0.177580431f, 0.182501778f},
-std::array<float,2>{0.532737017f, 0.845282316f},
-std::array<float,2>{0.454721004f, 0.674948752f},
-std::array<float,2>{0.875539958f, 0.402412474f},
-std::array<float,2>{0.0827522948f, 0.490319371f},
-std::array<float,2>{0.637927771f, 0.74068588f},
-std::array<float,2>{0.296800941f, 0.807687581f},
-std::array<float,2>{0.787693262f, 0.19602038f},
-std::array<float,2>{0.433261454f, 0.0837970972f},
-std::array<float,2>{0.994364679f, 0.980648279f},
-std::array<float,2>{0.207804248f, 0.529590607f},
-std::array<float,2>{0.611360133f, 0.348510504f},
-std::array<float,2>{0.38048026f, 0.37212491f},
-std::array<float,2>{0.939497948f, 0.502150118f},
-std::array<float,2>{0.248461813f, 0.992791772f},
-std::array<float,2>{0.568245649f, 0.062926203f},
-std::array<float,2>{0.105095625f, 0.212120995f},
-std::array<float,2>{0.678407609f, 0.794200063f},
-std::array<float,2>{0.253249705f, 0.732766986f},
-std::array<float,2>{0.751437902f, 0.474026859f},
-std::array<float,2>{0.141371846f, 0.385771155f},
-std::array<float,2>{0.526024818f, 0.659275174f},
-std::array<float,2>{0.499665558f, 0.860832751f},
-std::array<float,2>{0.93394798f, 0.15682289f},
-std::array<float,2>{0.337163687f, 0.0162215736f},
-std::array<float,2>{0.829474092f, 0.879550874f},
-std::array<float,2>{0.00341929565f, 0.582208335f},
-std::array<float,2>{0.708640873f, 0.29580453f},
-std::array<float,2>{0.297247708f, 0.442404956f},
-std::array<float,2>{0.798469901f, 0.71316725f},
-std::array<float,2>{0.072813347f, 0.750919104f},
-std::array<float,2>{0.651791334f, 0.247678876f},
-std::array<float,2>{0.195555195f, 0.109972723f},
-std::array<float,2>{0.601038456f, 0.938189089f},
-std::array<float,2>{0.409648806f, 0.549312115f},
-std::array<float,2>{0.970510006f, 0.339069307f},
-std::array<float,2>{0.0585970543f, 0.257539183f},
-std::array<float,2>{0.723223746f, 0.622364938f},
-std::array<float,2>{0.370577753f, 0.925038576f},
-std::array<float,2>{0.853563428f, 0.0408980362f},
-std::array<float,2>{0.452348292f, 0.153054565f},
-std::array<float,2>{0.892415583f, 0.834163666f},
-std::array<float,2>{0.165952936f, 0.637076616f},
-std::array<float,2>{0.547672451f, 0.430419385f},
-std::array<float,2>{0.415762037f, 0.483904839f},
-std::array<float,2>{0.983334184f, 0.724181652f},
-std::array<float,2>{0.193233505f, 0.784098029f},
-std::array<float,2>{0.601567745f, 0.210053563f},
-std::array<float,2>{0.0679832026f, 0.073440142f},
-std::array<float,2>{0.64673835f, 0.990325034f},
-std::array<float,2>{0.307715148f, 0.51351577f},
-std::array<float,2>{0.806230247f, 0.35992983f},
-std::array<float,2>{0.16184929f, 0.284849465f},
-std::array<float,2>{0.556505322f, 0.592407525f},
-std::array<float,2>{0.441013515f, 0.889189303f},
-std::array<float,2>{0.903191447f, 0.0304671619f},
-std::array<float,2>{0.362229705f, 0.166472986f},
-std::array<float,2>{0.85030663f, 0.874424458f},
-std::array<float,2>{0.047990106f, 0.669344068f},
-std::array<float,2>{0.729462743f, 0.375396311f},
-std::array<float,2>{0.262079418f, 0.334626168f},
-std::array<float,2>{0.761248648f, 0.556985617f},
-std::array<float,2>{0.095399417f, 0.949760556f},
-std::array<float,2>{0.68298471f, 0.119297206f},
-std::array<float,2>{0.235256046f, 0.240361303f},
-std::array<float,2>{0.575689316f, 0.764396489f},
-std::array<float,2>{0.386802077f, 0.710051417f},
-std::array<float,2>{0.952574849f, 0.450395107f},
-std::array<float,2>{0.0149015766f, 0.427923799f},
-std::array<float,2>{0.718715608f, 0.628146231f},
-std::array<float,2>{0.329075605f, 0.839499474f},
-std::array<float,2>{0.837671816f, 0.145453587f},
-std::array<float,2>{0.491153628f, 0.0321250744f},
-std::array<float,2>{0.923980772f, 0.932040513f},
-std::array<float,2>{0.150520474f, 0.613225222f},
-std::array<float,2>{0.516417623f, 0.264956892f},
-std::array<float,2>{0.467559755f, 0.266924858f},
-std::array<float,2>{0.889135659f, 0.602666855f},
-std::array<float,2>{0.186170489f, 0.916378081f},
-std::array<float,2>{0.54303968f, 0.0597538725f},
-std::array<float,2>{0.0404798351f, 0.136293307f},
-std::array<float,2>{0.735987008f, 0.817413032f},
-std::array<float,2>{0.347409636f, 0.652405441f},
-std::array<float,2>{0.874006391f, 0.416418523f},
-std::array<float,2>{0.218314812f, 0.462389112f},
-std::array<float,2>{0.622180164f, 0.693892837f},
-std::array<float,2>{0.428406447f, 0.776849508f},
-std::array<float,2>{0.989103734f, 0.222118422f},
-std::array<float,2>{0.28281039f, 0.0968277752f},
-std::array<float,2>{0.793181241f, 0.964340806f},
-std::array<float,2>{0.0891400576f, 0.541417599f},
-std::array<float,2>{0.628899336f, 0.321890295f},
-std::array<float,2>{0.324823081f, 0.397589147f},
-std::array<float,2>{0.82129848f, 0.68001771f},
-std::array<float,2>{0.0194453355f, 0.852862298f},
-std::array<float,2>{0.702892005f, 0.175082624f},
-std::array<float,2>{0.128484234f, 0.00571705308f},
-std::array<float,2>{0.510983348f, 0.892077923f},
-std::array<float,2>{0.473879367f, 0.572986364f},
-std::array<float,2>{0.916855037f, 0.309408098f},
-std::array<float,2>{0.110569127f, 0.359327018f},
-std::array<float,2>{0.664456606f, 0.517737925f},
-std::array<float,2>{0.277621865f, 0.97582531f},
-std::array<float,2>{0.779668272f, 0.0872060806f},
-std::array<float,2>{0.396693408f, 0.189247712f},
-std::array<float,2>{0.968340337f, 0.798062265f},
-std::array<float,2>{0.231485352f, 0.747950733f},
-std::array<float,2>{0.592945576f, 0.498833209f},
-std::array<float,2>{0.485207796f, 0.485487163f},
-std::array<float,2>{0.928440869f, 0.734646142f},
-std::array<float,2>{0.155331105f, 0.810649037f},
-std::array<float,2>{0.522067666f, 0.199914798f},
-std::array<float,2>{0.0112688281f, 0.0819207579f},
-std::array<float,2>{0.711383462f, 0.979002059f},
-std::array<float,2>{0.333578467f, 0.526993632f},
-std::array<float,2>{0.841432869f, 0.344242275f},
-std::array<float,2>{0.240529239f, 0.297508538f},
-std::array<float,2>{0.572972238f, 0.568610191f},
-std::array<float,2>{0.38425374f, 0.90036577f},
-std::array<float,2>{0.945362747f, 0.00910981372f},
-std::array<float,2>{0.259703785f, 0.187259272f},
-std::array<float,2>{0.763456523f, 0.851481736f},
-std::array<float,2>{0.100053988f, 0.677275777f},
-std::array<float,2>{0.684368074f, 0.40067476f},
-std::array<float,2>{0.366990894f, 0.319507092f},
-std::array<float,2>{0.843918264f, 0.531996369f},
-std::array<float,2>{0.0535706915f, 0.95769304f},
-std::array<float,2>{0.733606398f, 0.102079965f},
-std::array<float,2>{0.158498034f, 0.230019376f},
-std::array<float,2>{0.560520232f, 0.767087936f},
-std::array<float,2>{0.441434652f, 0.70130986f},
-std::array<float,2>{0.898605764f, 0.457501411f},
-std::array<float,2>{0.0639530122f, 0.411399275f},
-std::array<float,2>{0.64421159f, 0.642101109f},
-std::array<float,2>{0.311730593f, 0.823900878f},
-std::array<float,2>{0.811293244f, 0.128002271f},
-std::array<float,2>{0.418934584f, 0.047735963f},
-std::array<float,2>{0.976644218f, 0.914056063f},
-std::array<float,2>{0.188517913f, 0.601220906f},
-std::array<float,2>{0.609303057f, 0.276664406f},
-std::array<float,2>{0.393607169f, 0.250160009f},
-std::array<float,2>{0.963107765f, 0.619376659f},
-std::array<float,2>{0.228061214f, 0.928883612f},
-std::array<float,2>{0.586011708f, 0.0447329693f},
-std::array<float,2>{0.114977807f, 0.150833115f},
-std::array<float,2>{0.671539903f, 0.830735922f},
-std::array<float,2>{0.276924521f, 0.634347439f},
-std::array<float,2>{0.774070919f, 0.434145391f},
-std::array<float,2>{0.129554421f, 0.438829452f},
-std::array<float,2>{0.512533069f, 0.718610227f},
-std::array<float,2>{0.471470654f, 0.754667878f},
-std::array<float,2>{0.920788527f, 0.245289475f},
-std::array<float,2>{0.324008942f, 0.115116715f},
-std::array<float,2>{0.827553749f, 0.944450736f},
-std::array<float,2>{0.0225373805f, 0.554373145f},
-std::array<float,2>{0.698662221f, 0.340891689f},
-std::array<float,2>{0.285534263f, 0.389734715f},
-std::array<float,2>{0.791609406f, 0.663259208f},
-std::array<float,2>{0.0918825865f, 0.86524719f},
-std::array<float,2>{0.632409453f, 0.161044404f},
-std::array<float,2>{0.212111831f, 0.0206702184f},
-std::array<float,2>{0.617544174f, 0.875506938f},
-std::array<float,2>{0.422572851f, 0.579540074f},
-std::array<float,2>{0.986425459f, 0.289520562f},
-std::array<float,2>{0.0460425541f, 0.368659288f},
-std::array<float,2>{0.740816474f, 0.504646719f},
-std::array<float,2>{0.348492026f, 0.997246563f},
-std::array<float,2>{0.869273961f, 0.0670550913f},
-std::array<float,2>{0.462719649f, 0.217780173f},
-std::array<float,2>{0.884438992f, 0.790190101f},
-std::array<float,2>{0.180726022f, 0.729096174f},
-std::array<float,2>{0.540798545f, 0.472273409f},
-std::array<float,2>{0.435690343f, 0.42222783f},
-std::array<float,2>{0.998342156f, 0.631026268f},
-std::array<float,2>{0.204084903f, 0.840049326f},
-std::array<float,2>{0.614714801f, 0.141752347f},
-std::array<float,2>{0.0803870708f, 0.0388251394f},
-std::array<float,2>{0.633942544f, 0.933959067f},
-std::array<float,2>{0.29025659f, 0.615261674f},
-std::array<float,2>{0.781557858f, 0.261309862f},
-std::array<float,2>{0.1738673f, 0.328696579f},
-std::array<float,2>{0.535226643f, 0.560343862f},
-std::array<float,2>{0.460650682f, 0.94742763f},
-std::array<float,2>{0.881524622f, 0.124479905f},
-std::array<float,2>{0.354778409f, 0.237576023f},
-std::array<float,2>{0.859511554f, 0.760081708f},
-std::array<float,2>{0.0367903858f, 0.704078197f},
-std::array<float,2>{0.746025741f, 0.448909998f},
-std::array<float,2>{0.272864282f, 0.287534207f},
-std::array<float,2>{0.770371437f, 0.586584806f},
-std::array<float,2>{0.123425595f, 0.885014713f},
-std::array<float,2>{0.657972634f, 0.0250429027f},
-std::array<float,2>{0.221612304f, 0.168485418f},
-std::array<float,2>{0.583756685f, 0.867942393f},
-std::array<float,2>{0.401591778f, 0.666170955f},
-std::array<float,2>{0.958038449f, 0.381500632f},
-std::array<float,2>{0.0283800848f, 0.478581667f},
-std::array<float,2>{0.687653363f, 0.721799672f},
-std::array<float,2>{0.317941159f, 0.788744092f},
-std::array<float,2>{0.81523788f, 0.20508264f},
-std::array<float,2>{0.481801748f, 0.0750572979f},
-std::array<float,2>{0.913135946f, 0.987580359f},
-std::array<float,2>{0.133387432f, 0.511579216f},
-std::array<float,2>{0.500648975f, 0.364388853f},
-std::array<float,2>{0.447123617f, 0.352562189f},
-std::array<float,2>{0.894824624f, 0.523313105f},
-std::array<float,2>{0.168202624f, 0.970146f},
-std::array<float,2>{0.551798344f, 0.0905406997f},
-std::array<float,2>{0.054729566f, 0.194087043f},
-std::array<float,2>{0.720808923f, 0.801707268f},
-std::array<float,2>{0.372612476f, 0.745441854f},
-std::array<float,2>{0.858777344f, 0.494255483f},
-std::array<float,2>{0.202662915f, 0.392472446f},
-std::array<float,2>{0.5962708f, 0.685217738f},
-std::array<float,2>{0.411991268f, 0.85891825f},
-std::array<float,2>{0.975212336f, 0.179277003f},
-std::array<float,2>{0.304429978f, 0.00114367832f},
-std::array<float,2>{0.801832259f, 0.897313356f},
-std::array<float,2>{0.0766653568f, 0.576851308f},
-std::array<float,2>{0.654178321f, 0.306781709f},
-std::array<float,2>{0.341155499f, 0.466083735f},
-std::array<float,2>{0.83521533f, 0.689648092f},
-std::array<float,2>{0.00711291004f, 0.780288994f},
-std::array<float,2>{0.703542888f, 0.224714443f},
-std::array<float,2>{0.146627888f, 0.101126254f},
-std::array<float,2>{0.527853906f, 0.964854538f},
-std::array<float,2>{0.493368357f, 0.546578169f},
-std::array<float,2>{0.933376253f, 0.326288253f},
-std::array<float,2>{0.106026851f, 0.270725608f},
-std::array<float,2>{0.672167003f, 0.606816351f},
-std::array<float,2>{0.254524857f, 0.920677125f},
-std::array<float,2>{0.756626546f, 0.0570462905f},
-std::array<float,2>{0.375176847f, 0.138491452f},
-std::array<float,2>{0.944348216f, 0.813939154f},
-std::array<float,2>{0.243756548f, 0.651835442f},
-std::array<float,2>{0.562508821f, 0.419195116f},
-std::array<float,2>{0.456566066f, 0.405101985f},
-std::array<float,2>{0.877056897f, 0.672819734f},
-std::array<float,2>{0.177926198f, 0.845874369f},
-std::array<float,2>{0.533882141f, 0.179720387f},
-std::array<float,2>{0.0331530869f, 0.012141183f},
-std::array<float,2>{0.746931791f, 0.905920208f},
-std::array<float,2>{0.35802418f, 0.565291405f},
-std::array<float,2>{0.866185308f, 0.302483916f},
-std::array<float,2>{0.209802568f, 0.351502031f},
-std::array<float,2>{0.611075282f, 0.528835714f},
-std::array<float,2>{0.431037158f, 0.982665241f},
-std::array<float,2>{0.992542684f, 0.0851057097f},
-std::array<float,2>{0.293678463f, 0.198048279f},
-std::array<float,2>{0.786742032f, 0.805463314f},
-std::array<float,2>{0.0840545371f, 0.73961693f},
-std::array<float,2>{0.639997721f, 0.488423228f},
-std::array<float,2>{0.315192819f, 0.278242558f},
-std::array<float,2>{0.81846112f, 0.59632057f},
-std::array<float,2>{0.0236542933f, 0.907418609f},
-std::array<float,2>{0.694273531f, 0.0523701236f},
-std::array<float,2>{0.139482811f, 0.132395238f},
-std::array<float,2>{0.505451322f, 0.826971233f},
-std::array<float,2>{0.477178484f, 0.647267818f},
-std::array<float,2>{0.90647316f, 0.406564385f},
-std::array<float,2>{0.118662886f, 0.454076648f},
-std::array<float,2>{0.664014757f, 0.699180961f},
-std::array<float,2>{0.268045217f, 0.771147251f},
-std::array<float,2>{0.767455578f, 0.231683671f},
-std::array<float,2>{0.403747827f, 0.106324703f},
-std::array<float,2>{0.95380187f, 0.956389189f},
-std::array<float,2>{0.223038629f, 0.537667155f},
-std::array<float,2>{0.581691861f, 0.315027565f},
-std::array<float,2>{0.407507688f, 0.336895943f},
-std::array<float,2>{0.9713431f, 0.547157407f},
-std::array<float,2>{0.198383316f, 0.940654874f},
-std::array<float,2>{0.597767115f, 0.112401932f},
-std::array<float,2>{0.0705913305f, 0.248816416f},
-std::array<float,2>{0.649088442f, 0.752335906f},
-std::array<float,2>{0.299789071f, 0.712823331f},
-std::array<float,2>{0.800363719f, 0.444501221f},
-std::array<float,2>{0.167093366f, 0.432104141f},
-std::array<float,2>{0.549696386f, 0.639695287f},
-std::array<float,2>{0.45040375f, 0.832481325f},
-std::array<float,2>{0.892648876f, 0.155038476f},
-std::array<float,2>{0.368167847f, 0.042770125f},
-std::array<float,2>{0.853220046f, 0.922281623f},
-std::array<float,2>{0.060616143f, 0.624233603f},
-std::array<float,2>{0.726280808f, 0.255718708f},
-std::array<float,2>{0.25171268f, 0.475315928f},
-std::array<float,2>{0.753282189f, 0.73123759f},
-std::array<float,2>{0.101868644f, 0.794951022f},
-std::array<float,2>{0.675878704f, 0.213260889f},
-std::array<float,2>{0.246516407f, 0.0648680702f},
-std::array<float,2>{0.569256842f, 0.995700657f},
-std::array<float,2>{0.381097555f, 0.50193572f},
-std::array<float,2>{0.939421892f, 0.374112487f},
-std::array<float,2>{1.05085182e-05f, 0.29297328f},
-std::array<float,2>{0.710197985f, 0.584890187f},
-std::array<float,2>{0.338142812f, 0.882342875f},
-std::array<float,2>{0.830661595f, 0.0190020148f},
-std::array<float,2>{0.496526092f, 0.158444434f},
-std::array<float,2>{0.936203659f, 0.86179316f},
-std::array<float,2>{0.144358188f, 0.657160699f},
-std::array<float,2>{0.52438134f, 0.382915527f},
-std::array<float,2>{0.389165401f, 0.452173263f},
-std::array<float,2>{0.950667918f, 0.707335353f},
-std::array<float,2>{0.237821594f, 0.762892962f},
-std::array<float,2>{0.577756345f, 0.238406628f},
-std::array<float,2>{0.0958653092f, 0.118378438f},
-std::array<float,2>{0.681162655f, 0.951805353f},
-std::array<float,2>{0.263877392f, 0.556053281f},
-std::array<float,2>{0.759501159f, 0.332792014f},
-std::array<float,2>{0.150298104f, 0.263178498f},
-std::array<float,2>{0.51884377f, 0.609743416f},
-std::array<float,2>{0.489866436f, 0.931511879f},
-std::array<float,2>{0.922866225f, 0.0339412205f},
-std::array<float,2>{0.331480056f, 0.148423225f},
-std::array<float,2>{0.838057756f, 0.836137116f},
-std::array<float,2>{0.0128605934f, 0.626013398f},
-std::array<float,2>{0.716105878f, 0.426914185f},
-std::array<float,2>{0.305414349f, 0.362426639f},
-std::array<float,2>{0.807855964f, 0.51466161f},
-std::array<float,2>{0.0689788312f, 0.989141226f},
-std::array<float,2>{0.644920528f, 0.0706832185f},
-std::array<float,2>{0.193399563f, 0.208475977f},
-std::array<float,2>{0.603530407f, 0.782955706f},
-std::array<float,2>{0.416474581f, 0.724980235f},
-std::array<float,2>{0.980724096f, 0.481559545f},
-std::array<float,2>{0.0495069437f, 0.377195239f},
-std::array<float,2>{0.728511751f, 0.670028448f},
-std::array<float,2>{0.359761596f, 0.872940838f},
-std::array<float,2>{0.848935187f, 0.165713727f},
-std::array<float,2>{0.438583583f, 0.02851253f},
-std::array<float,2>{0.906099379f, 0.886977851f},
-std::array<float,2>{0.162228823f, 0.590251982f},
-std::array<float,2>{0.558567464f, 0.281332314f},
-std::array<float,2>{0.475553811f, 0.31166178f},
-std::array<float,2>{0.914691746f, 0.570901394f},
-std::array<float,2>{0.126805291f, 0.893357038f},
-std::array<float,2>{0.50798738f, 0.00639764452f},
-std::array<float,2>{0.0164055582f, 0.173441321f},
-std::array<float,2>{0.69996798f, 0.854097307f},
-std::array<float,2>{0.327824444f, 0.682694554f},
-std::array<float,2>{0.823974371f, 0.396088898f},
-std::array<float,2>{0.234104231f, 0.497474372f},
-std::array<float,2>{0.591145992f, 0.74864012f},
-std::array<float,2>{0.394771457f, 0.79940027f},
-std::array<float,2>{0.965806246f, 0.189782411f},
-std::array<float,2>{0.280858785f, 0.0892558843f},
-std::array<float,2>{0.779259861f, 0.97378993f},
-std::array<float,2>{0.113116562f, 0.516308308f},
-std::array<float,2>{0.66689378f, 0.356273532f},
-std::array<float,2>{0.345425725f, 0.415216506f},
-std::array<float,2>{0.871902525f, 0.656025827f},
-std::array<float,2>{0.042653922f, 0.820122778f},
-std::array<float,2>{0.736336291f, 0.133308128f},
-std::array<float,2>{0.185044676f, 0.0623561554f},
-std::array<float,2>{0.545436859f, 0.914690852f},
-std::array<float,2>{0.464968622f, 0.603900909f},
-std::array<float,2>{0.887366354f, 0.268327326f},
-std::array<float,2>{0.086968556f, 0.323911458f},
-std::array<float,2>{0.625262976f, 0.539333642f},
-std::array<float,2>{0.283864737f, 0.962672472f},
-std::array<float,2>{0.796749175f, 0.0937950313f},
-std::array<float,2>{0.426884353f, 0.219056293f},
-std::array<float,2>{0.991765261f, 0.774736285f},
-std::array<float,2>{0.215968415f, 0.692003489f},
-std::array<float,2>{0.623181343f, 0.463070124f},
-std::array<float,2>{0.472014546f, 0.440057218f},
-std::array<float,2>{0.921277046f, 0.716682792f},
-std::array<float,2>{0.13060981f, 0.756144881f},
-std::array<float,2>{0.513211429f, 0.24357976f},
-std::array<float,2>{0.022411257f, 0.115345344f},
-std::array<float,2>{0.69741565f, 0.942234397f},
-std::array<float,2>{0.322303683f, 0.552404463f},
-std::array<float,2>{0.826500654f, 0.342009693f},
-std::array<float,2>{0.227081984f, 0.252331108f},
-std::array<float,2>{0.587230086f, 0.618384778f},
-std::array<float,2>{0.393410683f, 0.927474797f},
-std::array<float,2>{0.96388793f, 0.0453129299f},
-std::array<float,2>{0.275402904f, 0.150302351f},
-std::array<float,2>{0.774499714f, 0.828312516f},
-std::array<float,2>{0.114011772f, 0.636239052f},
-std::array<float,2>{0.670050502f, 0.436484069f},
-std::array<float,2>{0.349271059f, 0.370801657f},
-std::array<float,2>{0.871050894f, 0.507214129f},
-std::array<float,2>{0.0452459268f, 0.99829793f},
-std::array<float,2>{0.741678119f, 0.0701532885f},
-std::array<float,2>{0.180222601f, 0.216204375f},
-std::array<float,2>{0.539522469f, 0.792828619f},
-std::array<float,2>{0.461177766f, 0.726601303f},
-std::array<float,2>{0.883690774f, 0.469329298f},
-std::array<float,2>{0.0929636657f, 0.387538016f},
-std::array<float,2>{0.631179631f, 0.660911977f},
-std::array<float,2>{0.286972851f, 0.86414206f},
-std::array<float,2>{0.792649508f, 0.163366437f},
-std::array<float,2>{0.423468351f, 0.02338426f},
-std::array<float,2>{0.98817569f, 0.878702521f},
-std::array<float,2>{0.210976824f, 0.581295013f},
-std::array<float,2>{0.618408084f, 0.292914271f},
-std::array<float,2>{0.383128613f, 0.299067527f},
-std::array<float,2>{0.947027802f, 0.567003012f},
-std::array<float,2>{0.24195987f, 0.901366711f},
-std::array<float,2>{0.573701859f, 0.0105726318f},
-std::array<float,2>{0.101055726f, 0.184344381f},
-std::array<float,2>{0.684856594f, 0.849211454f},
-std::array<float,2>{0.258075744f, 0.679442704f},
-std::array<float,2>{0.762136042f, 0.399970293f},
-std::array<float,2>{0.154651821f, 0.487480432f},
-std::array<float,2>{0.523209751f, 0.736429214f},
-std::array<float,2>{0.485752463f, 0.808760703f},
-std::array<float,2>{0.929341733f, 0.201276645f},
-std::array<float,2>{0.332169712f, 0.079049401f},
-std::array<float,2>{0.84079206f, 0.978209794f},
-std::array<float,2>{0.00977582671f, 0.52474004f},
-std::array<float,2>{0.711933374f, 0.34656027f},
-std::array<float,2>{0.311522692f, 0.412480801f},
-std::array<float,2>{0.812419713f, 0.642888606f},
-std::array<float,2>{0.0630950257f, 0.822171628f},
-std::array<float,2>{0.643514812f, 0.12654227f},
-std::array<float,2>{0.187987819f, 0.0499224886f},
-std::array<float,2>{0.607622564f, 0.911867261f},
-std::array<float,2>{0.419246167f, 0.597971678f},
-std::array<float,2>{0.978412688f, 0.273627102f},
-std::array<float,2>{0.0537746027f, 0.317872822f},
-std::array<float,2>{0.732812047f, 0.534985542f},
-std::array<float,2>{0.36599949f, 0.959894598f},
-std::array<float,2>{0.845297515f, 0.105272889f},
-std::array<float,2>{0.4428114f, 0.228461742f},
-std::array<float,2>{0.899684906f, 0.76845175f},
-std::array<float,2>{0.159340888f, 0.700208485f},
-std::array<float,2>{0.558759868f, 0.460471183f},
-std::array<float,2>{0.41031462f, 0.393017203f},
-std::array<float,2>{0.975993514f, 0.68567276f},
-std::array<float,2>{0.201935083f, 0.855875373f},
-std::array<float,2>{0.59669286f, 0.17580469f},
-std::array<float,2>{0.0776573271f, 0.00389034557f},
-std::array<float,2>{0.652564347f, 0.895292163f},
-std::array<float,2>{0.30330959f, 0.574637055f},
-std::array<float,2>{0.800828636f, 0.30609104f},
-std::array<float,2>{0.169407725f, 0.355297506f},
-std::array<float,2>{0.551146626f, 0.521088123f},
-std::array<float,2>{0.445434928f, 0.971165299f},
-std::array<float,2>{0.895920455f, 0.0934953913f},
-std::array<float,2>{0.371638775f, 0.191507801f},
-std::array<float,2>{0.858104646f, 0.804529667f},
-std::array<float,2>{0.0565619469f, 0.742332816f},
-std::array<float,2>{0.722363949f, 0.49335891f},
-std::array<float,2>{0.255316883f, 0.272337347f},
-std::array<float,2>{0.757332683f, 0.60811913f},
-std::array<float,2>{0.107056275f, 0.918767989f},
-std::array<float,2>{0.673668921f, 0.0556825586f},
-std::array<float,2>{0.242989242f, 0.138801455f},
-std::array<float,2>{0.563494563f, 0.815337121f},
-std::array<float,2>{0.376392275f, 0.649309814f},
-std::array<float,2>{0.943660676f, 0.420302987f},
-std::array<float,2>{0.00589992804f, 0.46834442f},
-std::array<float,2>{0.70433718f, 0.688995361f},
-std::array<float,2>{0.340402663f, 0.777809024f},
-std::array<float,2>{0.834790528f, 0.223089144f},
-std::array<float,2>{0.492775351f, 0.0985843539f},
-std::array<float,2>{0.932612598f, 0.968088508f},
-std::array<float,2>{0.148013443f, 0.543524683f},
-std::array<float,2>{0.528674781f, 0.325538456f},
-std::array<float,2>{0.459549278f, 0.331558317f},
-std::array<float,2>{0.882141173f, 0.561196804f},
-std::array<float,2>{0.175267279f, 0.946846843f},
-std::array<float,2>{0.53640902f, 0.123017751f},
-std::array<float,2>{0.0353333503f, 0.235540971f},
-std::array<float,2>{0.744570732f, 0.759682f},
-std::array<float,2>{0.353598505f, 0.706412911f},
-std::array<float,2>{0.860829592f, 0.446941763f},
-std::array<float,2>{0.204429924f, 0.42388308f},
-std::array<float,2>{0.613307536f, 0.629848361f},
-std::array<float,2>{0.436625868f, 0.843286097f},
-std::array<float,2>{0.999786258f, 0.144308865f},
-std::array<float,2>{0.289980233f, 0.0365009047f},
-std::array<float,2>{0.782983661f, 0.937048852f},
-std::array<float,2>{0.0817301199f, 0.614827573f},
-std::array<float,2>{0.633302212f, 0.259427518f},
-std::array<float,2>{0.317137182f, 0.478014141f},
-std::array<float,2>{0.816388786f, 0.71881336f},
-std::array<float,2>{0.0280084237f, 0.78545332f},
-std::array<float,2>{0.68876493f, 0.204826638f},
-std::array<float,2>{0.134516507f, 0.0764728412f},
-std::array<float,2>{0.501865268f, 0.985163629f},
-std::array<float,2>{0.480882376f, 0.508157909f},
-std::array<float,2>{0.912485182f, 0.365434557f},
-std::array<float,2>{0.124123648f, 0.286839187f},
-std::array<float,2>{0.656696618f, 0.588527322f},
-std::array<float,2>{0.27197662f, 0.883758307f},
-std::array<float,2>{0.77141875f, 0.0263406467f},
-std::array<float,2>{0.400409073f, 0.170868933f},
-std::array<float,2>{0.957119584f, 0.870606601f},
-std::array<float,2>{0.222596258f, 0.665846884f},
-std::array<float,2>{0.58235234f, 0.380275577f},
-std::array<float,2>{0.449801207f, 0.430732518f},
-std::array<float,2>{0.893930852f, 0.638662994f},
-std::array<float,2>{0.166717499f, 0.835096657f},
-std::array<float,2>{0.550009847f, 0.153440401f},
-std::array<float,2>{0.0624177009f, 0.0394482985f},
-std::array<float,2>{0.725407064f, 0.924215198f},
-std::array<float,2>{0.367737919f, 0.6211375f},
-std::array<float,2>{0.851748347f, 0.256140471f},
-std::array<float,2>{0.198225275f, 0.338180035f},
-std::array<float,2>{0.599218965f, 0.549954772f},
-std::array<float,2>{0.406313539f, 0.939284086f},
-std::array<float,2>{0.972450912f, 0.110653557f},
-std::array<float,2>{0.300721496f, 0.246906608f},
-std::array<float,2>{0.799302876f, 0.751651049f},
-std::array<float,2>{0.0717168823f, 0.714804471f},
-std::array<float,2>{0.650078714f, 0.441412479f},
-std::array<float,2>{0.339433432f, 0.296811253f},
-std::array<float,2>{0.831970274f, 0.583831608f},
-std::array<float,2>{0.00117356109f, 0.88039273f},
-std::array<float,2>{0.709696114f, 0.0173425302f},
-std::array<float,2>{0.143529728f, 0.157736987f},
-std::array<float,2>{0.525146961f, 0.859658659f},
-std::array<float,2>{0.497721851f, 0.658889234f},
-std::array<float,2>{0.937214792f, 0.384801209f},
-std::array<float,2>{0.10294643f, 0.473165601f},
-std::array<float,2>{0.677137792f, 0.734266043f},
-std::array<float,2>{0.250138164f, 0.793847263f},
-std::array<float,2>{0.752177894f, 0.211354986f},
-std::array<float,2>{0.382102728f, 0.0643227026f},
-std::array<float,2>{0.937645435f, 0.993946552f},
-std::array<float,2>{0.247122183f, 0.503284037f},
-std::array<float,2>{0.569548726f, 0.371829689f},
-std::array<float,2>{0.430456102f, 0.348838359f},
-std::array<float,2>{0.993345141f, 0.530463278f},
-std::array<float,2>{0.210126653f, 0.982137203f},
-std::array<float,2>{0.609729052f, 0.0828773752f},
-std::array<float,2>{0.0853387266f, 0.196836546f},
-std::array<float,2>{0.63944006f, 0.806827366f},
-std::array<float,2>{0.294535518f, 0.74214673f},
-std::array<float,2>{0.786081314f, 0.491712213f},
-std::array<float,2>{0.179410353f, 0.404051244f},
-std::array<float,2>{0.534534156f, 0.67427218f},
-std::array<float,2>{0.455619603f, 0.843959212f},
-std::array<float,2>{0.878361702f, 0.183319032f},
-std::array<float,2>{0.359059036f, 0.0146089504f},
-std::array<float,2>{0.866485775f, 0.903167129f},
-std::array<float,2>{0.0314261205f, 0.563392043f},
-std::array<float,2>{0.747828066f, 0.303415149f},
-std::array<float,2>{0.269512415f, 0.455759764f},
-std::array<float,2>{0.766330361f, 0.695967793f},
-std::array<float,2>{0.117288217f, 0.772557914f},
-std::array<float,2>{0.662953198f, 0.233560473f},
-std::array<float,2>{0.224494576f, 0.108181886f},
-std::array<float,2>{0.580169857f, 0.953656018f},
-std::array<float,2>{0.402714759f, 0.536536098f},
-std::array<float,2>{0.954973459f, 0.313642651f},
-std::array<float,2>{0.0246339496f, 0.281081378f},
-std::array<float,2>{0.694870591f, 0.595510542f},
-std::array<float,2>{0.316141605f, 0.910115123f},
-std::array<float,2>{0.820274413f, 0.0538402051f},
-std::array<float,2>{0.477718323f, 0.129778966f},
-std::array<float,2>{0.907563746f, 0.825204611f},
-std::array<float,2>{0.140355244f, 0.645681441f},
-std::array<float,2>{0.504650891f, 0.408937901f},
-std::array<float,2>{0.396099091f, 0.499860972f},
-std::array<float,2>{0.965843022f, 0.746652901f},
-std::array<float,2>{0.232782662f, 0.797612965f},
-std::array<float,2>{0.589942932f, 0.187836841f},
-std::array<float,2>{0.11154557f, 0.0861532092f},
-std::array<float,2>{0.667384148f, 0.975202501f},
-std::array<float,2>{0.279426515f, 0.519328654f},
-std::array<float,2>{0.777894914f, 0.357423335f},
-std::array<float,2>{0.125897825f, 0.310415417f},
-std::array<float,2>{0.509074092f, 0.574051559f},
-std::array<float,2>{0.47571823f, 0.891235232f},
-std::array<float,2>{0.915561438f, 0.00390957249f},
-std::array<float,2>{0.326218158f, 0.174352348f},
-std::array<float,2>{0.822499275f, 0.851728976f},
-std::array<float,2>{0.0167092774f, 0.681042016f},
-std::array<float,2>{0.700236201f, 0.397446692f},
-std::array<float,2>{0.284980237f, 0.320433438f},
-std::array<float,2>{0.795472801f, 0.542374909f},
-std::array<float,2>{0.0868387222f, 0.963424563f},
-std::array<float,2>{0.626412451f, 0.0964505225f},
-std::array<float,2>{0.215207949f, 0.221080542f},
-std::array<float,2>{0.624595702f, 0.77600503f},
-std::array<float,2>{0.426601946f, 0.695001781f},
-std::array<float,2>{0.990234733f, 0.461860448f},
-std::array<float,2>{0.0414109342f, 0.417799652f},
-std::array<float,2>{0.738250017f, 0.653440952f},
-std::array<float,2>{0.343907028f, 0.817311347f},
-std::array<float,2>{0.872733831f, 0.135241434f},
-std::array<float,2>{0.466199189f, 0.0595355444f},
-std::array<float,2>{0.888377368f, 0.917015135f},
-std::array<float,2>{0.184031993f, 0.601688385f},
-std::array<float,2>{0.546016514f, 0.265749007f},
-std::array<float,2>{0.488304287f, 0.264501929f},
-std::array<float,2>{0.92187953f, 0.612051904f},
-std::array<float,2>{0.149390727f, 0.93349421f},
-std::array<float,2>{0.51763922f, 0.0330127142f},
-std::array<float,2>{0.0125019597f, 0.145909265f},
-std::array<float,2>{0.715443134f, 0.838602662f},
-std::array<float,2>{0.330840975f, 0.627829134f},
-std::array<float,2>{0.839104533f, 0.429454565f},
-std::array<float,2>{0.236877143f, 0.449237108f},
-std::array<float,2>{0.576642394f, 0.709749818f},
-std::array<float,2>{0.390435517f, 0.76476568f},
-std::array<float,2>{0.950064957f, 0.242020488f},
-std::array<float,2>{0.265144497f, 0.120289005f},
-std::array<float,2>{0.758565843f, 0.95030129f},
-std::array<float,2>{0.0970089585f, 0.558054209f},
-std::array<float,2>{0.679850638f, 0.335044771f},
-std::array<float,2>{0.36037147f, 0.376548618f},
-std::array<float,2>{0.848374546f, 0.668773592f},
-std::array<float,2>{0.0498655252f, 0.873560786f},
-std::array<float,2>{0.727225661f, 0.167961076f},
-std::array<float,2>{0.16310294f, 0.0301519539f},
-std::array<float,2>{0.5566715f, 0.890410721f},
-std::array<float,2>{0.437850446f, 0.59330076f},
-std::array<float,2>{0.904759169f, 0.28395775f},
-std::array<float,2>{0.070067443f, 0.361203849f},
-std::array<float,2>{0.645682037f, 0.51189369f},
-std::array<float,2>{0.305851907f, 0.991508961f},
-std::array<float,2>{0.80725497f, 0.0731017217f},
-std::array<float,2>{0.417076558f, 0.209488213f},
-std::array<float,2>{0.982215583f, 0.784741461f},
-std::array<float,2>{0.194944531f, 0.723313093f},
-std::array<float,2>{0.604505658f, 0.483308643f},
-std::array<float,2>{0.464025557f, 0.471554101f},
-std::array<float,2>{0.886671782f, 0.730203152f},
-std::array<float,2>{0.182818353f, 0.789251029f},
-std::array<float,2>{0.542865336f, 0.217611358f},
-std::array<float,2>{0.0443071797f, 0.0675027296f},
-std::array<float,2>{0.73835963f, 0.996443033f},
-std::array<float,2>{0.351061761f, 0.505318403f},
-std::array<float,2>{0.868322849f, 0.367670417f},
-std::array<float,2>{0.213429019f, 0.290520877f},
-std::array<float,2>{0.619436502f, 0.578216314f},
-std::array<float,2>{0.425775588f, 0.87598455f},
-std::array<float,2>{0.9854514f, 0.020275237f},
-std::array<float,2>{0.288740784f, 0.161303699f},
-std::array<float,2>{0.790140092f, 0.866635323f},
-std::array<float,2>{0.0916457698f, 0.662210882f},
-std::array<float,2>{0.628919721f, 0.388973922f},
-std::array<float,2>{0.321983904f, 0.339998037f},
-std::array<float,2>{0.824444294f, 0.552998602f},
-std::array<float,2>{0.0212275703f, 0.943417549f},
-std::array<float,2>{0.695766509f, 0.113659129f},
-std::array<float,2>{0.132481426f, 0.244275808f},
-std::array<float,2>{0.514203191f, 0.75493747f},
-std::array<float,2>{0.469948798f, 0.717559636f},
-std::array<float,2>{0.918098688f, 0.4375332f},
-std::array<float,2>{0.116065137f, 0.435316622f},
-std::array<float,2>{0.669330478f, 0.633467317f},
-std::array<float,2>{0.274841249f, 0.831191599f},
-std::array<float,2>{0.776692688f, 0.151772767f},
-std::array<float,2>{0.391531676f, 0.0439137518f},
-std::array<float,2>{0.962317586f, 0.927958727f},
-std::array<float,2>{0.228784695f, 0.620691001f},
-std::array<float,2>{0.58933419f, 0.251907408f},
-std::array<float,2>{0.420449793f, 0.276167005f},
-std::array<float,2>{0.978589654f, 0.599784553f},
-std::array<float,2>{0.190405026f, 0.912969053f},
-std::array<float,2>{0.606077671f, 0.0486467704f},
-std::array<float,2>{0.0654702857f, 0.127192125f},
-std::array<float,2>{0.640765727f, 0.823234499f},
-std::array<float,2>{0.309049487f, 0.641175747f},
-std::array<float,2>{0.810437024f, 0.410592914f},
-std::array<float,2>{0.158135101f, 0.458085865f},
-std::array<float,2>{0.561628222f, 0.70311594f},
-std::array<float,2>{0.443569064f, 0.766436458f},
-std::array<float,2>{0.901712239f, 0.229361445f},
-std::array<float,2>{0.364599884f, 0.103511274f},
-std::array<float,2>{0.845979393f, 0.958558321f},
-std::array<float,2>{0.0527241975f, 0.532237589f},
-std::array<float,2>{0.730923474f, 0.318721503f},
-std::array<float,2>{0.260163665f, 0.40225789f},
-std::array<float,2>{0.76535964f, 0.675829053f},
-std::array<float,2>{0.0989426821f, 0.849789739f},
-std::array<float,2>{0.685790002f, 0.186077803f},
-std::array<float,2>{0.238532528f, 0.0083828019f},
-std::array<float,2>{0.571650743f, 0.899037898f},
-std::array<float,2>{0.385157347f, 0.569405258f},
-std::array<float,2>{0.948116422f, 0.297854275f},
-std::array<float,2>{0.00813749898f, 0.344810486f},
-std::array<float,2>{0.714147449f, 0.525809586f},
-std::array<float,2>{0.335324913f, 0.979612648f},
-std::array<float,2>{0.843451977f, 0.0803286433f},
-std::array<float,2>{0.487993568f, 0.200860515f},
-std::array<float,2>{0.926013291f, 0.812333941f},
-std::array<float,2>{0.153055578f, 0.736162484f},
-std::array<float,2>{0.519591749f, 0.48478815f},
-std::array<float,2>{0.377141088f, 0.418487132f},
-std::array<float,2>{0.943342566f, 0.650475323f},
-std::array<float,2>{0.245605364f, 0.81275022f},
-std::array<float,2>{0.564468026f, 0.137414038f},
-std::array<float,2>{0.108859912f, 0.0584581383f},
-std::array<float,2>{0.673857927f, 0.921234488f},
-std::array<float,2>{0.256439537f, 0.605691075f},
-std::array<float,2>{0.755052328f, 0.26965937f},
-std::array<float,2>{0.144719079f, 0.327388078f},
-std::array<float,2>{0.529574037f, 0.54574132f},
-std::array<float,2>{0.494866878f, 0.966671407f},
-std::array<float,2>{0.93059361f, 0.100490436f},
-std::array<float,2>{0.342114985f, 0.225822002f},
-std::array<float,2>{0.833501518f, 0.77992326f},
-std::array<float,2>{0.00539737009f, 0.691328228f},
-std::array<float,2>{0.706353366f, 0.465192556f},
-std::array<float,2>{0.30183205f, 0.308589637f},
-std::array<float,2>{0.804312527f, 0.577467442f},
-std::array<float,2>{0.0746668205f, 0.898012757f},
-std::array<float,2>{0.655395508f, 0.000426789018f},
-std::array<float,2>{0.199926347f, 0.178207636f},
-std::array<float,2>{0.594995022f, 0.85746789f},
-std::array<float,2>{0.412198871f, 0.684333205f},
-std::array<float,2>{0.973258317f, 0.390637487f},
-std::array<float,2>{0.057474684f, 0.495743334f},
-std::array<float,2>{0.720499039f, 0.744645715f},
-std::array<float,2>{0.374233603f, 0.802659929f},
-std::array<float,2>{0.85659498f, 0.194687381f},
-std::array<float,2>{0.447762936f, 0.0911149383f},
-std::array<float,2>{0.898394704f, 0.968770504f},
-std::array<float,2>{0.170478657f, 0.522214592f},
-std::array<float,2>{0.554205537f, 0.352314651f},
-std::array<float,2>{0.482712716f, 0.363349408f},
-std::array<float,2>{0.910728395f, 0.510151803f},
-std::array<float,2>{0.135167301f, 0.986580312f},
-std::array<float,2>{0.502605736f, 0.075356558f},
-std::array<float,2>{0.0305471048f, 0.206793636f},
-std::array<float,2>{0.691207349f, 0.787458062f},
-std::array<float,2>{0.31951803f, 0.721503437f},
-std::array<float,2>{0.813785076f, 0.480083495f},
-std::array<float,2>{0.220491007f, 0.382627726f},
-std::array<float,2>{0.584239662f, 0.667711616f},
-std::array<float,2>{0.398875237f, 0.869000256f},
-std::array<float,2>{0.960146666f, 0.16924955f},
-std::array<float,2>{0.270043999f, 0.0235286858f},
-std::array<float,2>{0.772994399f, 0.886287749f},
-std::array<float,2>{0.122181341f, 0.58772254f},
-std::array<float,2>{0.65992111f, 0.288677365f},
-std::array<float,2>{0.352393508f, 0.447698951f},
-std::array<float,2>{0.862832904f, 0.70498997f},
-std::array<float,2>{0.0387025066f, 0.760997951f},
-std::array<float,2>{0.74334383f, 0.237219825f},
-std::array<float,2>{0.172299296f, 0.123989522f},
-std::array<float,2>{0.537718952f, 0.949121654f},
-std::array<float,2>{0.45855543f, 0.559188306f},
-std::array<float,2>{0.879014671f, 0.329598546f},
-std::array<float,2>{0.0799156949f, 0.260249168f},
-std::array<float,2>{0.636691391f, 0.617009461f},
-std::array<float,2>{0.29174456f, 0.935436726f},
-std::array<float,2>{0.783590078f, 0.0374668315f},
-std::array<float,2>{0.434659839f, 0.14063406f},
-std::array<float,2>{0.996705949f, 0.841177285f},
-std::array<float,2>{0.206219077f, 0.63216114f},
-std::array<float,2>{0.61580056f, 0.422901273f},
-std::array<float,2>{0.498670489f, 0.384682477f},
-std::array<float,2>{0.934914291f, 0.657433629f},
-std::array<float,2>{0.142032847f, 0.863249421f},
-std::array<float,2>{0.526750863f, 0.159565642f},
-std::array<float,2>{0.0019995803f, 0.0176279899f},
-std::array<float,2>{0.707897067f, 0.880878687f},
-std::array<float,2>{0.33669433f, 0.585766912f},
-std::array<float,2>{0.828810155f, 0.294173807f},
-std::array<float,2>{0.249421641f, 0.373627961f},
-std::array<float,2>{0.567054093f, 0.50049603f},
-std::array<float,2>{0.379229099f, 0.994945347f},
-std::array<float,2>{0.941401899f, 0.065757744f},
-std::array<float,2>{0.252031654f, 0.214010701f},
-std::array<float,2>{0.75090301f, 0.796801031f},
-std::array<float,2>{0.104412049f, 0.732348859f},
-std::array<float,2>{0.678942621f, 0.476007998f},
-std::array<float,2>{0.370111227f, 0.254392445f},
-std::array<float,2>{0.854576468f, 0.623600364f},
-std::array<float,2>{0.0598020889f, 0.9229334f},
-std::array<float,2>{0.724471509f, 0.041701287f},
-std::array<float,2>{0.164237514f, 0.156102628f},
-std::array<float,2>{0.547875941f, 0.8337363f},
-std::array<float,2>{0.452127516f, 0.639169753f},
-std::array<float,2>{0.891523004f, 0.433521032f},
-std::array<float,2>{0.0735014901f, 0.443640351f},
-std::array<float,2>{0.650403082f, 0.711253703f},
-std::array<float,2>{0.298215568f, 0.753243566f},
-std::array<float,2>{0.79701668f, 0.249952242f},
-std::array<float,2>{0.408404112f, 0.111674637f},
-std::array<float,2>{0.968990088f, 0.940383136f},
-std::array<float,2>{0.196388587f, 0.548229337f},
-std::array<float,2>{0.600564063f, 0.337719589f},
-std::array<float,2>{0.405175328f, 0.316278875f},
-std::array<float,2>{0.955756485f, 0.538443983f},
-std::array<float,2>{0.226024434f, 0.955140412f},
-std::array<float,2>{0.578171611f, 0.107180201f},
-std::array<float,2>{0.120233744f, 0.231302932f},
-std::array<float,2>{0.662009358f, 0.769765079f},
-std::array<float,2>{0.26695928f, 0.69777596f},
-std::array<float,2>{0.768084109f, 0.454740047f},
-std::array<float,2>{0.137336016f, 0.407963961f},
-std::array<float,2>{0.506669521f, 0.648175418f},
-std::array<float,2>{0.480178028f, 0.827313364f},
-std::array<float,2>{0.910024941f, 0.131028771f},
-std::array<float,2>{0.312923133f, 0.0515252315f},
-std::array<float,2>{0.818206549f, 0.90673697f},
-std::array<float,2>{0.0258382205f, 0.596900523f},
-std::array<float,2>{0.692329824f, 0.278992116f},
-std::array<float,2>{0.295065135f, 0.489935964f},
-std::array<float,2>{0.788959205f, 0.738713861f},
-std::array<float,2>{0.0831719413f, 0.806081295f},
-std::array<float,2>{0.637087703f, 0.198673159f},
-std::array<float,2>{0.208769068f, 0.0845772177f},
-std::array<float,2>{0.612434626f, 0.983566105f},
-std::array<float,2>{0.432522863f, 0.528018653f},
-std::array<float,2>{0.996018827f, 0.350240052f},
-std::array<float,2>{0.0344363414f, 0.301119447f},
-std::array<float,2>{0.749720812f, 0.565963328f},
-std::array<float,2>{0.355571657f, 0.904946864f},
-std::array<float,2>{0.865063548f, 0.0131570231f},
-std::array<float,2>{0.453446627f, 0.181249321f},
-std::array<float,2>{0.876871288f, 0.847520769f},
-std::array<float,2>{0.176076323f, 0.673032045f},
-std::array<float,2>{0.531558931f, 0.40562889f},
-std::array<float,2>{0.429429799f, 0.464445263f},
-std::array<float,2>{0.989884317f, 0.6930812f},
-std::array<float,2>{0.217075929f, 0.774408817f},
-std::array<float,2>{0.621644497f, 0.220457628f},
-std::array<float,2>{0.0880681202f, 0.095448181f},
-std::array<float,2>{0.627462327f, 0.961108088f},
-std::array<float,2>{0.281269193f, 0.540411353f},
-std::array<float,2>{0.794746876f, 0.322635502f},
-std::array<float,2>{0.187403947f, 0.269228548f},
-std::array<float,2>{0.544027865f, 0.605048895f},
-std::array<float,2>{0.467956156f, 0.915955842f},
-std::array<float,2>{0.89057982f, 0.060849797f},
-std::array<float,2>{0.345723867f, 0.134041443f},
-std::array<float,2>{0.874677002f, 0.818542242f},
-std::array<float,2>{0.0394650139f, 0.654813707f},
-std::array<float,2>{0.735305905f, 0.414633334f},
-std::array<float,2>{0.278743207f, 0.357107222f},
-std::array<float,2>{0.781089664f, 0.516763628f},
-std::array<float,2>{0.109713718f, 0.973590374f},
-std::array<float,2>{0.66544199f, 0.0882824436f},
-std::array<float,2>{0.23087208f, 0.191146418f},
-std::array<float,2>{0.592733085f, 0.800710857f},
-std::array<float,2>{0.397733748f, 0.749997616f},
-std::array<float,2>{0.967522979f, 0.496262133f},
-std::array<float,2>{0.0177833308f, 0.395221919f},
-std::array<float,2>{0.701575398f, 0.681983113f},
-std::array<float,2>{0.325895369f, 0.854730189f},
-std::array<float,2>{0.820343554f, 0.171965882f},
-std::array<float,2>{0.473007411f, 0.00770950131f},
-std::array<float,2>{0.917328179f, 0.893881261f},
-std::array<float,2>{0.12716502f, 0.571671307f},
-std::array<float,2>{0.51041162f, 0.310595244f},
-std::array<float,2>{0.439964473f, 0.282398671f},
-std::array<float,2>{0.903354347f, 0.591558039f},
-std::array<float,2>{0.160617903f, 0.888668299f},
-std::array<float,2>{0.555486977f, 0.028099943f},
-std::array<float,2>{0.0470914394f, 0.164904907f},
-std::array<float,2>{0.729558587f, 0.871106982f},
-std::array<float,2>{0.362995803f, 0.670940459f},
-std::array<float,2>{0.851121068f, 0.378046066f},
-std::array<float,2>{0.192284748f, 0.481057823f},
-std::array<float,2>{0.602961779f, 0.726021349f},
-std::array<float,2>{0.414539367f, 0.782030821f},
-std::array<float,2>{0.984010756f, 0.20716466f},
-std::array<float,2>{0.307452679f, 0.0716952533f},
-std::array<float,2>{0.805145264f, 0.989730775f},
-std::array<float,2>{0.0667157546f, 0.513878763f},
-std::array<float,2>{0.647483766f, 0.361413866f},
-std::array<float,2>{0.329270065f, 0.426010728f},
-std::array<float,2>{0.836083591f, 0.625587046f},
-std::array<float,2>{0.0146104963f, 0.837260723f},
-std::array<float,2>{0.716873109f, 0.147209883f},
-std::array<float,2>{0.151660681f, 0.0347486027f},
-std::array<float,2>{0.517206311f, 0.930619836f},
-std::array<float,2>{0.491790742f, 0.610775888f},
-std::array<float,2>{0.92539227f, 0.262100756f},
-std::array<float,2>{0.0939156562f, 0.333645344f},
-std::array<float,2>{0.681857169f, 0.555278242f},
-std::array<float,2>{0.262729526f, 0.952791214f},
-std::array<float,2>{0.759911299f, 0.117211655f},
-std::array<float,2>{0.388019443f, 0.239280432f},
-std::array<float,2>{0.9519099f, 0.761945724f},
-std::array<float,2>{0.235611647f, 0.708297849f},
-std::array<float,2>{0.574292421f, 0.452071577f},
-std::array<float,2>{0.45836693f, 0.446744442f},
-std::array<float,2>{0.879577935f, 0.706896126f},
-std::array<float,2>{0.17240043f, 0.759237587f},
-std::array<float,2>{0.537270427f, 0.235850364f},
-std::array<float,2>{0.0381658711f, 0.122163892f},
-std::array<float,2>{0.743858874f, 0.946649551f},
-std::array<float,2>{0.351837814f, 0.56088233f},
-std::array<float,2>{0.862687647f, 0.331080616f},
-std::array<float,2>{0.20691216f, 0.259131342f},
-std::array<float,2>{0.615442455f, 0.614644229f},
-std::array<float,2>{0.435136974f, 0.936975837f},
-std::array<float,2>{0.99651438f, 0.0366548374f},
-std::array<float,2>{0.291335374f, 0.143793523f},
-std::array<float,2>{0.783721089f, 0.842899323f},
-std::array<float,2>{0.079482317f, 0.629380167f},
-std::array<float,2>{0.635835886f, 0.424472123f},
-std::array<float,2>{0.320014238f, 0.366207987f},
-std::array<float,2>{0.814123631f, 0.508550286f},
-std::array<float,2>{0.0308142267f, 0.984647155f},
-std::array<float,2>{0.690704703f, 0.0767823756f},
-std::array<float,2>{0.135688767f, 0.204118341f},
-std::array<float,2>{0.502256989f, 0.785915673f},
-std::array<float,2>{0.483373731f, 0.719586194f},
-std::array<float,2>{0.91045332f, 0.478408247f},
-std::array<float,2>{0.122570641f, 0.380585253f},
-std::array<float,2>{0.659653485f, 0.665296078f},
-std::array<float,2>{0.269984573f, 0.870561361f},
-std::array<float,2>{0.772880852f, 0.170189008f},
-std::array<float,2>{0.39926827f, 0.0257924329f},
-std::array<float,2>{0.960610867f, 0.88312304f},
-std::array<float,2>{0.220109805f, 0.588031173f},
-std::array<float,2>{0.584946275f, 0.286396146f},
-std::array<float,2>{0.412693769f, 0.306165814f},
-std::array<float,2>{0.97294867f, 0.574871898f},
-std::array<float,2>{0.199356183f, 0.894704223f},
-std::array<float,2>{0.595232666f, 0.00308292801f},
-std::array<float,2>{0.0750309229f, 0.176390216f},
-std::array<float,2>{0.656062782f, 0.856128216f},
-std::array<float,2>{0.302470118f, 0.686298072f},
-std::array<float,2>{0.803969026f, 0.393127054f},
-std::array<float,2>{0.170076817f, 0.494001806f},
-std::array<float,2>{0.554036558f, 0.742693961f},
-std::array<float,2>{0.447594255f, 0.804193795f},
-std::array<float,2>{0.897693455f, 0.192042992f},
-std::array<float,2>{0.374709129f, 0.0929295048f},
-std::array<float,2>{0.85724175f, 0.971616805f},
-std::array<float,2>{0.0569008142f, 0.520879328f},
-std::array<float,2>{0.720211387f, 0.354645252f},
-std::array<float,2>{0.256230175f, 0.420461833f},
-std::array<float,2>{0.755490065f, 0.648901045f},
-std::array<float,2>{0.109341554f, 0.814578891f},
-std::array<float,2>{0.674370825f, 0.139215261f},
-std::array<float,2>{0.245963946f, 0.0565668344f},
-std::array<float,2>{0.565124691f, 0.918176174f},
-std::array<float,2>{0.377468169f, 0.607892096f},
-std::array<float,2>{0.94265312f, 0.271562457f},
-std::array<float,2>{0.00533873308f, 0.325702965f},
-std::array<float,2>{0.706551731f, 0.543361008f},
-std::array<float,2>{0.342495471f, 0.968457937f},
-std::array<float,2>{0.833423376f, 0.0977606699f},
-std::array<float,2>{0.494151145f, 0.22322461f},
-std::array<float,2>{0.929892421f, 0.77822268f},
-std::array<float,2>{0.145113975f, 0.688638151f},
-std::array<float,2>{0.530119956f, 0.467868924f},
-std::array<float,2>{0.385359436f, 0.399773687f},
-std::array<float,2>{0.947278261f, 0.679067194f},
-std::array<float,2>{0.239140451f, 0.848947406f},
-std::array<float,2>{0.571926415f, 0.183855474f},
-std::array<float,2>{0.0993624628f, 0.0102349641f},
-std::array<float,2>{0.686122298f, 0.90062201f},
-std::array<float,2>{0.260355234f, 0.566883028f},
-std::array<float,2>{0.765070617f, 0.299542874f},
-std::array<float,2>{0.152481496f, 0.345715463f},
-std::array<float,2>{0.52014184f, 0.524972618f},
-std::array<float,2>{0.487324566f, 0.977614343f},
-std::array<float,2>{0.926647186f, 0.0785862356f},
-std::array<float,2>{0.335727394f, 0.202066272f},
-std::array<float,2>{0.843115628f, 0.809296668f},
-std::array<float,2>{0.00876549538f, 0.737303495f},
-std::array<float,2>{0.714400411f, 0.488191545f},
-std::array<float,2>{0.309514701f, 0.274206102f},
-std::array<float,2>{0.809731424f, 0.598526657f},
-std::array<float,2>{0.0660228804f, 0.911440551f},
-std::array<float,2>{0.641412616f, 0.0506948195f},
-std::array<float,2>{0.189630955f, 0.12617816f},
-std::array<float,2>{0.605900884f, 0.821299255f},
-std::array<float,2>{0.420129418f, 0.643215239f},
-std::array<float,2>{0.979419231f, 0.412705541f},
-std::array<float,2>{0.0522188544f, 0.460441917f},
-std::array<float,2>{0.730985522f, 0.700970471f},
-std::array<float,2>{0.36518836f, 0.768059433f},
-std::array<float,2>{0.846400023f, 0.227924168f},
-std::array<float,2>{0.443887711f, 0.104789361f},
-std::array<float,2>{0.902222097f, 0.959011555f},
-std::array<float,2>{0.157350078f, 0.534221292f},
-std::array<float,2>{0.562322378f, 0.317586243f},
-std::array<float,2>{0.470309883f, 0.342367649f},
-std::array<float,2>{0.918648601f, 0.551918268f},
-std::array<float,2>{0.132086039f, 0.941529572f},
-std::array<float,2>{0.513685405f, 0.116046168f},
-std::array<float,2>{0.0209130477f, 0.243840426f},
-std::array<float,2>{0.696199179f, 0.75653863f},
-std::array<float,2>{0.321472019f, 0.715930104f},
-std::array<float,2>{0.825016916f, 0.439723253f},
-std::array<float,2>{0.229087517f, 0.435734093f},
-std::array<float,2>{0.589475393f, 0.635896206f},
-std::array<float,2>{0.390825868f, 0.829024136f},
-std::array<float,2>{0.962802887f, 0.149682641f},
-std::array<float,2>{0.275166214f, 0.0458831526f},
-std::array<float,2>{0.776923835f, 0.927200615f},
-std::array<float,2>{0.115562707f, 0.619041026f},
-std::array<float,2>{0.669873416f, 0.252894044f},
-std::array<float,2>{0.351100147f, 0.469170153f},
-std::array<float,2>{0.868792892f, 0.727190375f},
-std::array<float,2>{0.0447453633f, 0.792363048f},
-std::array<float,2>{0.739219189f, 0.216528222f},
-std::array<float,2>{0.183474869f, 0.0695077553f},
-std::array<float,2>{0.542471528f, 0.999004483f},
-std::array<float,2>{0.464527905f, 0.507593691f},
-std::array<float,2>{0.886060178f, 0.37025401f},
-std::array<float,2>{0.0913061053f, 0.292223096f},
-std::array<float,2>{0.629568279f, 0.58180815f},
-std::array<float,2>{0.288470536f, 0.877932787f},
-std::array<float,2>{0.7908957f, 0.0227724314f},
-std::array<float,2>{0.425151885f, 0.163948387f},
-std::array<float,2>{0.985909879f, 0.863378763f},
-std::array<float,2>{0.212894514f, 0.660223544f},
-std::array<float,2>{0.619677424f, 0.386726558f},
-std::array<float,2>{0.49146387f, 0.428985476f},
-std::array<float,2>{0.92499733f, 0.627246022f},
-std::array<float,2>{0.152032286f, 0.838329911f},
-std::array<float,2>{0.517027617f, 0.146383971f},
-std::array<float,2>{0.0141384276f, 0.0323819518f},
-std::array<float,2>{0.717623591f, 0.933077633f},
-std::array<float,2>{0.329762936f, 0.611608088f},
-std::array<float,2>{0.836571157f, 0.263728678f},
-std::array<float,2>{0.235909492f, 0.335808992f},
-std::array<float,2>{0.575022221f, 0.558202147f},
-std::array<float,2>{0.388368964f, 0.950827479f},
-std::array<float,2>{0.951390743f, 0.120720461f},
-std::array<float,2>{0.263602555f, 0.241359308f},
-std::array<float,2>{0.760697067f, 0.76530844f},
-std::array<float,2>{0.0944735408f, 0.709090412f},
-std::array<float,2>{0.68216002f, 0.44996956f},
-std::array<float,2>{0.362344027f, 0.283291221f},
-std::array<float,2>{0.850765586f, 0.59320879f},
-std::array<float,2>{0.0477039553f, 0.889796257f},
-std::array<float,2>{0.730462909f, 0.0294547249f},
-std::array<float,2>{0.160856143f, 0.167395487f},
-std::array<float,2>{0.555174947f, 0.873509467f},
-std::array<float,2>{0.439644307f, 0.668230474f},
-std::array<float,2>{0.903921604f, 0.376049906f},
-std::array<float,2>{0.0671278536f, 0.482508868f},
-std::array<float,2>{0.648247898f, 0.722958326f},
-std::array<float,2>{0.306860566f, 0.784582555f},
-std::array<float,2>{0.805497885f, 0.209338441f},
-std::array<float,2>{0.414668709f, 0.0725874752f},
-std::array<float,2>{0.983723044f, 0.992164195f},
-std::array<float,2>{0.191664636f, 0.512577951f},
-std::array<float,2>{0.603139579f, 0.360397428f},
-std::array<float,2>{0.398330659f, 0.358099252f},
-std::array<float,2>{0.967157304f, 0.518736482f},
-std::array<float,2>{0.231443733f, 0.97468853f},
-std::array<float,2>{0.59182483f, 0.0865771696f},
-std::array<float,2>{0.110258549f, 0.188409373f},
-std::array<float,2>{0.66600889f, 0.796886146f},
-std::array<float,2>{0.279150069f, 0.746252477f},
-std::array<float,2>{0.780314028f, 0.499068022f},
-std::array<float,2>{0.127571955f, 0.396517992f},
-std::array<float,2>{0.510241091f, 0.681473613f},
-std::array<float,2>{0.473534524f, 0.852056861f},
-std::array<float,2>{0.917929471f, 0.17383121f},
-std::array<float,2>{0.325278938f, 0.00475270301f},
-std::array<float,2>{0.820935309f, 0.890663207f},
-std::array<float,2>{0.0183568057f, 0.573558271f},
-std::array<float,2>{0.70168972f, 0.310043633f},
-std::array<float,2>{0.282070279f, 0.461185426f},
-std::array<float,2>{0.794393778f, 0.694479287f},
-std::array<float,2>{0.0886835605f, 0.775781631f},
-std::array<float,2>{0.627280951f, 0.221291423f},
-std::array<float,2>{0.217637688f, 0.0957915932f},
-std::array<float,2>{0.621572196f, 0.963084459f},
-std::array<float,2>{0.428716451f, 0.542692959f},
-std::array<float,2>{0.98935014f, 0.320877016f},
-std::array<float,2>{0.0399045199f, 0.266569585f},
-std::array<float,2>{0.734531105f, 0.602177203f},
-std::array<float,2>{0.346587867f, 0.917508006f},
-std::array<float,2>{0.874076605f, 0.0587693118f},
-std::array<float,2>{0.468496025f, 0.135476217f},
-std::array<float,2>{0.889919877f, 0.816661716f},
-std::array<float,2>{0.18684864f, 0.654135585f},
-std::array<float,2>{0.544745743f, 0.41714558f},
-std::array<float,2>{0.431732029f, 0.491555423f},
-std::array<float,2>{0.995256066f, 0.741383255f},
-std::array<float,2>{0.208393231f, 0.807531118f},
-std::array<float,2>{0.612995207f, 0.196605772f},
-std::array<float,2>{0.0836788267f, 0.0824669078f},
-std::array<float,2>{0.637321949f, 0.981791258f},
-std::array<float,2>{0.295532137f, 0.531099558f},
-std::array<float,2>{0.788321078f, 0.34948203f},
-std::array<float,2>{0.176339373f, 0.30322063f},
-std::array<float,2>{0.532096386f, 0.562971294f},
-std::array<float,2>{0.453759521f, 0.902710676f},
-std::array<float,2>{0.876043499f, 0.0141060548f},
-std::array<float,2>{0.356366009f, 0.18302162f},
-std::array<float,2>{0.864282489f, 0.844658375f},
-std::array<float,2>{0.0348936431f, 0.674551427f},
-std::array<float,2>{0.749170542f, 0.403768301f},
-std::array<float,2>{0.267115563f, 0.314099133f},
-std::array<float,2>{0.767764151f, 0.536756873f},
-std::array<float,2>{0.120854512f, 0.953453481f},
-std::array<float,2>{0.661561847f, 0.107473113f},
-std::array<float,2>{0.226279467f, 0.23403576f},
-std::array<float,2>{0.578649044f, 0.773053408f},
-std::array<float,2>{0.404743105f, 0.695325494f},
-std::array<float,2>{0.955247223f, 0.45514071f},
-std::array<float,2>{0.0259073097f, 0.408591658f},
-std::array<float,2>{0.69160068f, 0.64610374f},
-std::array<float,2>{0.313248694f, 0.825784743f},
-std::array<float,2>{0.817618906f, 0.129125103f},
-std::array<float,2>{0.479925662f, 0.0545122772f},
-std::array<float,2>{0.909411669f, 0.909480035f},
-std::array<float,2>{0.136926204f, 0.59509629f},
-std::array<float,2>{0.506338298f, 0.280511379f},
-std::array<float,2>{0.45152998f, 0.256496251f},
-std::array<float,2>{0.890821755f, 0.621675611f},
-std::array<float,2>{0.164896905f, 0.924696624f},
-std::array<float,2>{0.548600972f, 0.0395795293f},
-std::array<float,2>{0.0603868514f, 0.154046774f},
-std::array<float,2>{0.72402972f, 0.835674763f},
-std::array<float,2>{0.369397938f, 0.637966037f},
-std::array<float,2>{0.855426013f, 0.43146193f},
-std::array<float,2>{0.196948498f, 0.442054272f},
-std::array<float,2>{0.599899411f, 0.714268327f},
-std::array<float,2>{0.408693671f, 0.751011431f},
-std::array<float,2>{0.969528258f, 0.246411115f},
-std::array<float,2>{0.298553288f, 0.1110496f},
-std::array<float,2>{0.797497153f, 0.938857496f},
-std::array<float,2>{0.0740307719f, 0.550614417f},
-std::array<float,2>{0.650915682f, 0.338380426f},
-std::array<float,2>{0.336321205f, 0.385608315f},
-std::array<float,2>{0.828512132f, 0.658667088f},
-std::array<float,2>{0.00284532667f, 0.86009109f},
-std::array<float,2>{0.707417727f, 0.157526284f},
-std::array<float,2>{0.142564222f, 0.0170210563f},
-std::array<float,2>{0.527301371f, 0.880266964f},
-std::array<float,2>{0.498048335f, 0.583424687f},
-std::array<float,2>{0.935277998f, 0.296007752f},
-std::array<float,2>{0.103761807f, 0.371147722f},
-std::array<float,2>{0.679540157f, 0.503831208f},
-std::array<float,2>{0.252509803f, 0.993642807f},
-std::array<float,2>{0.750052333f, 0.0635323301f},
-std::array<float,2>{0.379526913f, 0.211834639f},
-std::array<float,2>{0.940707982f, 0.793132424f},
-std::array<float,2>{0.249682337f, 0.733440638f},
-std::array<float,2>{0.566508412f, 0.473100394f},
-std::array<float,2>{0.481055349f, 0.479532897f},
-std::array<float,2>{0.913062453f, 0.720949054f},
-std::array<float,2>{0.133800834f, 0.788007259f},
-std::array<float,2>{0.501280963f, 0.206145108f},
-std::array<float,2>{0.0277805775f, 0.0759398341f},
-std::array<float,2>{0.689034462f, 0.987059891f},
-std::array<float,2>{0.316458315f, 0.510726333f},
-std::array<float,2>{0.815834165f, 0.363919467f},
-std::array<float,2>{0.221986115f, 0.28828311f},
-std::array<float,2>{0.582603216f, 0.586976767f},
-std::array<float,2>{0.401326835f, 0.885863006f},
-std::array<float,2>{0.957891583f, 0.0241410807f},
-std::array<float,2>{0.271962911f, 0.169814631f},
-std::array<float,2>{0.770685077f, 0.868427396f},
-std::array<float,2>{0.124516308f, 0.66715616f},
-std::array<float,2>{0.656807125f, 0.381843388f},
-std::array<float,2>{0.3544752f, 0.329198718f},
-std::array<float,2>{0.861292541f, 0.558731377f},
-std::array<float,2>{0.0359820276f, 0.948654652f},
-std::array<float,2>{0.74483794f, 0.123093054f},
-std::array<float,2>{0.175307155f, 0.23633498f},
-std::array<float,2>{0.536686897f, 0.761446536f},
-std::array<float,2>{0.45913747f, 0.704301f},
-std::array<float,2>{0.882665455f, 0.447990805f},
-std::array<float,2>{0.0812558979f, 0.423406512f},
-std::array<float,2>{0.632914245f, 0.632647336f},
-std::array<float,2>{0.289137363f, 0.84177196f},
-std::array<float,2>{0.782577872f, 0.141310573f},
-std::array<float,2>{0.437268376f, 0.0378719941f},
-std::array<float,2>{0.999024808f, 0.934744f},
-std::array<float,2>{0.205036581f, 0.616554081f},
-std::array<float,2>{0.614183128f, 0.260347724f},
-std::array<float,2>{0.376859814f, 0.270295292f},
-std::array<float,2>{0.944331467f, 0.606397331f},
-std::array<float,2>{0.242198959f, 0.921557128f},
-std::array<float,2>{0.564034402f, 0.0580387488f},
-std::array<float,2>{0.106653489f, 0.137013301f},
-std::array<float,2>{0.673332393f, 0.813134849f},
-std::array<float,2>{0.255843818f, 0.651231408f},
-std::array<float,2>{0.757230282f, 0.418273896f},
-std::array<float,2>{0.147727937f, 0.465419382f},
-std::array<float,2>{0.529207468f, 0.690635681f},
-std::array<float,2>{0.492480457f, 0.779451132f},
-std::array<float,2>{0.931660891f, 0.226445958f},
-std::array<float,2>{0.339930058f, 0.0999265835f},
-std::array<float,2>{0.834163308f, 0.966181397f},
-std::array<float,2>{0.00672300812f, 0.545345366f},
-std::array<float,2>{0.70499748f, 0.328065783f},
-std::array<float,2>{0.303121179f, 0.39125824f},
-std::array<float,2>{0.801469862f, 0.68408072f},
-std::array<float,2>{0.0775815174f, 0.858016074f},
-std::array<float,2>{0.653162003f, 0.178577542f},
-std::array<float,2>{0.201205999f, 0.000907909998f},
-std::array<float,2>{0.597274959f, 0.897879541f},
-std::array<float,2>{0.411030531f, 0.578121603f},
-std::array<float,2>{0.97653693f, 0.307957262f},
-std::array<float,2>{0.0558500141f, 0.351834327f},
-std::array<float,2>{0.722025216f, 0.521803796f},
-std::array<float,2>{0.371278107f, 0.969239533f},
-std::array<float,2>{0.857649803f, 0.0916598067f},
-std::array<float,2>{0.446179658f, 0.195084155f},
-std::array<float,2>{0.896376073f, 0.802150369f},
-std::array<float,2>{0.169614747f, 0.744456053f},
-std::array<float,2>{0.551683724f, 0.495271951f},
-std::array<float,2>{0.419558138f, 0.410904795f},
-std::array<float,2>{0.977973402f, 0.640680909f},
-std::array<float,2>{0.188407615f, 0.822585166f},
-std::array<float,2>{0.60839802f, 0.127472281f},
-std::array<float,2>{0.0629570335f, 0.0479745939f},
-std::array<float,2>{0.642846644f, 0.91218096f},
-std::array<float,2>{0.310564697f, 0.600576818f},
-std::array<float,2>{0.811651886f, 0.275757849f},
-std::array<float,2>{0.159766808f, 0.319285154f},
-std::array<float,2>{0.559564412f, 0.532840967f},
-std::array<float,2>{0.443297058f, 0.958424985f},
-std::array<float,2>{0.900328636f, 0.102849923f},
-std::array<float,2>{0.36551854f, 0.228940994f},
-std::array<float,2>{0.844878793f, 0.766041934f},
-std::array<float,2>{0.0544835031f, 0.702496052f},
-std::array<float,2>{0.733359933f, 0.4588916f},
-std::array<float,2>{0.258317649f, 0.298517138f},
-std::array<float,2>{0.762271881f, 0.570171118f},
-std::array<float,2>{0.101561151f, 0.898663878f},
-std::array<float,2>{0.685366154f, 0.00811525993f},
-std::array<float,2>{0.241528958f, 0.185922176f},
-std::array<float,2>{0.573969185f, 0.850267291f},
-std::array<float,2>{0.383459508f, 0.676454961f},
-std::array<float,2>{0.946555138f, 0.401557982f},
-std::array<float,2>{0.0104794009f, 0.485291272f},
-std::array<float,2>{0.712633371f, 0.735704005f},
-std::array<float,2>{0.332840025f, 0.811769962f},
-std::array<float,2>{0.839870036f, 0.20028019f},
-std::array<float,2>{0.486320436f, 0.0806624219f},
-std::array<float,2>{0.929073155f, 0.980143666f},
-std::array<float,2>{0.154981896f, 0.526096523f},
-std::array<float,2>{0.522509992f, 0.345589459f},
-std::array<float,2>{0.46150893f, 0.36797142f},
-std::array<float,2>{0.882986486f, 0.505402744f},
-std::array<float,2>{0.179958925f, 0.996594727f},
-std::array<float,2>{0.539681196f, 0.0679125264f},
-std::array<float,2>{0.0454220474f, 0.216818482f},
-std::array<float,2>{0.74191761f, 0.790023744f},
-std::array<float,2>{0.34900099f, 0.729563355f},
-std::array<float,2>{0.870372057f, 0.470779508f},
-std::array<float,2>{0.211617783f, 0.389512151f},
-std::array<float,2>{0.619005024f, 0.66263932f},
-std::array<float,2>{0.42291671f, 0.866782546f},
-std::array<float,2>{0.987680256f, 0.161947817f},
-std::array<float,2>{0.286536306f, 0.0199253745f},
-std::array<float,2>{0.792156518f, 0.876666844f},
-std::array<float,2>{0.0933380648f, 0.578625798f},
-std::array<float,2>{0.631471634f, 0.290705353f},
-std::array<float,2>{0.322851807f, 0.43836391f},
-std::array<float,2>{0.826854408f, 0.71704191f},
-std::array<float,2>{0.0214925874f, 0.7555179f},
-std::array<float,2>{0.697827518f, 0.244771332f},
-std::array<float,2>{0.129960299f, 0.113848127f},
-std::array<float,2>{0.513047516f, 0.944058836f},
-std::array<float,2>{0.47263366f, 0.55349946f},
-std::array<float,2>{0.921444595f, 0.340695918f},
-std::array<float,2>{0.113600358f, 0.250999361f},
-std::array<float,2>{0.670575976f, 0.620450199f},
-std::array<float,2>{0.276068002f, 0.92841959f},
-std::array<float,2>{0.774934292f, 0.043089997f},
-std::array<float,2>{0.392877072f, 0.1519541f},
-std::array<float,2>{0.964524925f, 0.831627429f},
-std::array<float,2>{0.226596922f, 0.633130789f},
-std::array<float,2>{0.587464333f, 0.4345918f},
-std::array<float,2>{0.438216776f, 0.378873736f},
-std::array<float,2>{0.904823005f, 0.671637118f},
-std::array<float,2>{0.164022118f, 0.8717556f},
-std::array<float,2>{0.55760479f, 0.16410014f},
-std::array<float,2>{0.0507435165f, 0.0276809111f},
-std::array<float,2>{0.726915181f, 0.88779062f},
-std::array<float,2>{0.361129016f, 0.591013491f},
-std::array<float,2>{0.84806788f, 0.282993048f},
-std::array<float,2>{0.194554776f, 0.362127841f},
-std::array<float,2>{0.605251729f, 0.514436185f},
-std::array<float,2>{0.417700797f, 0.990010321f},
-std::array<float,2>{0.981798708f, 0.0720764101f},
-std::array<float,2>{0.306383759f, 0.207711205f},
-std::array<float,2>{0.80664736f, 0.781466842f},
-std::array<float,2>{0.0695946068f, 0.726336658f},
-std::array<float,2>{0.646215141f, 0.480552882f},
-std::array<float,2>{0.330309451f, 0.262433201f},
-std::array<float,2>{0.83943969f, 0.610875905f},
-std::array<float,2>{0.0119324699f, 0.929838598f},
-std::array<float,2>{0.715307772f, 0.0342612937f},
-std::array<float,2>{0.148910999f, 0.146890536f},
-std::array<float,2>{0.518454254f, 0.837809503f},
-std::array<float,2>{0.488977998f, 0.62540549f},
-std::array<float,2>{0.922521055f, 0.426610887f},
-std::array<float,2>{0.0973557755f, 0.451209754f},
-std::array<float,2>{0.680478334f, 0.708748817f},
-std::array<float,2>{0.264844924f, 0.762357712f},
-std::array<float,2>{0.757828474f, 0.239814967f},
-std::array<float,2>{0.389749646f, 0.117812656f},
-std::array<float,2>{0.949328005f, 0.952472985f},
-std::array<float,2>{0.236485586f, 0.555085778f},
-std::array<float,2>{0.576798201f, 0.33323729f},
-std::array<float,2>{0.425906152f, 0.323180765f},
-std::array<float,2>{0.991183221f, 0.540946603f},
-std::array<float,2>{0.215654433f, 0.961858511f},
-std::array<float,2>{0.624147654f, 0.0950826854f},
-std::array<float,2>{0.0861923397f, 0.220189452f},
-std::array<float,2>{0.626624703f, 0.773559093f},
-std::array<float,2>{0.284625739f, 0.692728758f},
-std::array<float,2>{0.795121789f, 0.463961512f},
-std::array<float,2>{0.184569672f, 0.414527833f},
-std::array<float,2>{0.546494365f, 0.654604077f},
-std::array<float,2>{0.466638774f, 0.819042206f},
-std::array<float,2>{0.887987673f, 0.13453193f},
-std::array<float,2>{0.344484895f, 0.0612986423f},
-std::array<float,2>{0.872132242f, 0.915157199f},
-std::array<float,2>{0.0418541133f, 0.604697585f},
-std::array<float,2>{0.737331271f, 0.269022763f},
-std::array<float,2>{0.280115873f, 0.49689582f},
-std::array<float,2>{0.77734977f, 0.749350071f},
-std::array<float,2>{0.112170406f, 0.800198197f},
-std::array<float,2>{0.667502284f, 0.190557316f},
-std::array<float,2>{0.233097047f, 0.088438049f},
-std::array<float,2>{0.59073925f, 0.972940385f},
-std::array<float,2>{0.395565629f, 0.517286181f},
-std::array<float,2>{0.966747701f, 0.356533408f},
-std::array<float,2>{0.0172847323f, 0.311232358f},
-std::array<float,2>{0.701076925f, 0.572235465f},
-std::array<float,2>{0.326916635f, 0.89448297f},
-std::array<float,2>{0.822951615f, 0.00714432029f},
-std::array<float,2>{0.47650674f, 0.172531322f},
-std::array<float,2>{0.915064454f, 0.855187714f},
-std::array<float,2>{0.125008047f, 0.682474613f},
-std::array<float,2>{0.509289742f, 0.39462173f},
-std::array<float,2>{0.402897388f, 0.454565227f},
-std::array<float,2>{0.954120636f, 0.697409451f},
-std::array<float,2>{0.223969027f, 0.770443499f},
-std::array<float,2>{0.58074528f, 0.230926797f},
-std::array<float,2>{0.118024684f, 0.106628589f},
-std::array<float,2>{0.662258744f, 0.955902457f},
-std::array<float,2>{0.268956184f, 0.5388726f},
-std::array<float,2>{0.765637517f, 0.315639436f},
-std::array<float,2>{0.140135258f, 0.278390527f},
-std::array<float,2>{0.504228055f, 0.597599804f},
-std::array<float,2>{0.47840333f, 0.90718323f},
-std::array<float,2>{0.907738447f, 0.0512620509f},
-std::array<float,2>{0.315545321f, 0.131745145f},
-std::array<float,2>{0.819789588f, 0.82767427f},
-std::array<float,2>{0.0250887889f, 0.647840738f},
-std::array<float,2>{0.694536388f, 0.40729332f},
-std::array<float,2>{0.294118404f, 0.349696964f},
-std::array<float,2>{0.785418868f, 0.527577758f},
-std::array<float,2>{0.0854795277f, 0.98407197f},
-std::array<float,2>{0.638913453f, 0.0844182149f},
-std::array<float,2>{0.210732624f, 0.199092865f},
-std::array<float,2>{0.609985054f, 0.806505919f},
-std::array<float,2>{0.429993868f, 0.739107728f},
-std::array<float,2>{0.993806124f, 0.489495397f},
-std::array<float,2>{0.032201346f, 0.405998856f},
-std::array<float,2>{0.747159779f, 0.673701882f},
-std::array<float,2>{0.358797044f, 0.846891761f},
-std::array<float,2>{0.867174447f, 0.181124032f},
-std::array<float,2>{0.455542594f, 0.0134068374f},
-std::array<float,2>{0.878543735f, 0.90451628f},
-std::array<float,2>{0.178999186f, 0.565879881f},
-std::array<float,2>{0.534956574f, 0.301598072f},
-std::array<float,2>{0.497555345f, 0.29478851f},
-std::array<float,2>{0.936837077f, 0.585432947f},
-std::array<float,2>{0.142654061f, 0.881622672f},
-std::array<float,2>{0.524785876f, 0.0181312691f},
-std::array<float,2>{0.00188306672f, 0.16007635f},
-std::array<float,2>{0.709370673f, 0.862789214f},
-std::array<float,2>{0.339287311f, 0.658129275f},
-std::array<float,2>{0.831158459f, 0.383868486f},
-std::array<float,2>{0.247572064f, 0.476202846f},
-std::array<float,2>{0.570020914f, 0.73192507f},
-std::array<float,2>{0.382742316f, 0.796032131f},
-std::array<float,2>{0.938227296f, 0.214549944f},
-std::array<float,2>{0.250673354f, 0.0660626292f},
-std::array<float,2>{0.752545059f, 0.994478822f},
-std::array<float,2>{0.103207111f, 0.500024855f},
-std::array<float,2>{0.67772752f, 0.373341352f},
-std::array<float,2>{0.367194772f, 0.433100969f},
-std::array<float,2>{0.852155268f, 0.638899624f},
-std::array<float,2>{0.0615603663f, 0.833051682f},
-std::array<float,2>{0.724630654f, 0.155678973f},
-std::array<float,2>{0.166368768f, 0.0412269272f},
-std::array<float,2>{0.5506019f, 0.92370826f},
-std::array<float,2>{0.449600726f, 0.623172283f},
-std::array<float,2>{0.894246578f, 0.2545968f},
-std::array<float,2>{0.0721930265f, 0.336991191f},
-std::array<float,2>{0.649434149f, 0.54858619f},
-std::array<float,2>{0.299832761f, 0.939905345f},
-std::array<float,2>{0.799325109f, 0.111917265f},
-std::array<float,2>{0.40715614f, 0.249284089f},
-std::array<float,2>{0.971708238f, 0.753594756f},
-std::array<float,2>{0.197728097f, 0.711567283f},
-std::array<float,2>{0.598706186f, 0.444270432f},
-std::array<float,2>{0.494092137f, 0.466860861f},
-std::array<float,2>{0.932923079f, 0.687680006f},
-std::array<float,2>{0.14745447f, 0.779200315f},
-std::array<float,2>{0.527601182f, 0.224333167f},
-std::array<float,2>{0.00759942923f, 0.0992369056f},
-std::array<float,2>{0.703736305f, 0.967624128f},
-std::array<float,2>{0.341443747f, 0.544305623f},
-std::array<float,2>{0.835714996f, 0.324963272f},
-std::array<float,2>{0.243449405f, 0.272541076f},
-std::array<float,2>{0.563118219f, 0.608768165f},
-std::array<float,2>{0.375861317f, 0.919762492f},
-std::array<float,2>{0.945008039f, 0.0548616797f},
-std::array<float,2>{0.254097223f, 0.140501305f},
-std::array<float,2>{0.75603807f, 0.815479398f},
-std::array<float,2>{0.105618231f, 0.649758935f},
-std::array<float,2>{0.672666073f, 0.421742767f},
-std::array<float,2>{0.372389853f, 0.353919983f},
-std::array<float,2>{0.859142661f, 0.519805193f},
-std::array<float,2>{0.0551998354f, 0.971854925f},
-std::array<float,2>{0.721264482f, 0.091971375f},
-std::array<float,2>{0.168674782f, 0.193008676f},
-std::array<float,2>{0.552338898f, 0.803523302f},
-std::array<float,2>{0.446387529f, 0.743703723f},
-std::array<float,2>{0.895240784f, 0.493039489f},
-std::array<float,2>{0.0763933435f, 0.394463092f},
-std::array<float,2>{0.653768301f, 0.687277794f},
-std::array<float,2>{0.304127336f, 0.856883287f},
-std::array<float,2>{0.80233866f, 0.177644163f},
-std::array<float,2>{0.411218822f, 0.00225921604f},
-std::array<float,2>{0.974882722f, 0.896346927f},
-std::array<float,2>{0.202477589f, 0.575465322f},
-std::array<float,2>{0.596029639f, 0.305508733f},
-std::array<float,2>{0.402251452f, 0.2855483f},
-std::array<float,2>{0.95886898f, 0.589513838f},
-std::array<float,2>{0.221065983f, 0.884050965f},
-std::array<float,2>{0.583060563f, 0.0268148221f},
-std::array<float,2>{0.123781249f, 0.17158711f},
-std::array<float,2>{0.657631814f, 0.870081067f},
-std::array<float,2>{0.272970557f, 0.664163589f},
-std::array<float,2>{0.769885957f, 0.379256666f},
-std::array<float,2>{0.13321121f, 0.477199614f},
-std::array<float,2>{0.500367105f, 0.7199108f},
-std::array<float,2>{0.481963754f, 0.787092209f},
-std::array<float,2>{0.913654327f, 0.203827396f},
-std::array<float,2>{0.317506343f, 0.0778726339f},
-std::array<float,2>{0.814937353f, 0.985646307f},
-std::array<float,2>{0.0291389506f, 0.509229481f},
-std::array<float,2>{0.688302755f, 0.366313666f},
-std::array<float,2>{0.290531486f, 0.424859196f},
-std::array<float,2>{0.781771719f, 0.630337596f},
-std::array<float,2>{0.0809919462f, 0.842146039f},
-std::array<float,2>{0.634620905f, 0.142666578f},
-std::array<float,2>{0.203407779f, 0.035778936f},
-std::array<float,2>{0.615200818f, 0.936457276f},
-std::array<float,2>{0.436143339f, 0.614096522f},
-std::array<float,2>{0.99892509f, 0.258565038f},
-std::array<float,2>{0.0362918749f, 0.330367774f},
-std::array<float,2>{0.745457649f, 0.561846018f},
-std::array<float,2>{0.354983896f, 0.946174026f},
-std::array<float,2>{0.859942734f, 0.121214062f},
-std::array<float,2>{0.460098684f, 0.235135496f},
-std::array<float,2>{0.881048977f, 0.758103311f},
-std::array<float,2>{0.174504921f, 0.705677509f},
-std::array<float,2>{0.535651386f, 0.446209937f},
-std::array<float,2>{0.422082335f, 0.388125926f},
-std::array<float,2>{0.987244666f, 0.661507308f},
-std::array<float,2>{0.212808445f, 0.865009964f},
-std::array<float,2>{0.618088305f, 0.162391216f},
-std::array<float,2>{0.0923776403f, 0.0216785893f},
-std::array<float,2>{0.632063866f, 0.877100646f},
-std::array<float,2>{0.285841048f, 0.580863357f},
-std::array<float,2>{0.791387439f, 0.291342735f},
-std::array<float,2>{0.181543916f, 0.36964187f},
-std::array<float,2>{0.540039778f, 0.506461501f},
-std::array<float,2>{0.46203509f, 0.999523163f},
-std::array<float,2>{0.883908391f, 0.0692129731f},
-std::array<float,2>{0.34797594f, 0.214902639f},
-std::array<float,2>{0.869830906f, 0.791441679f},
-std::array<float,2>{0.0467580669f, 0.728327751f},
-std::array<float,2>{0.740419328f, 0.469901711f},
-std::array<float,2>{0.276431412f, 0.253305256f},
-std::array<float,2>{0.773546875f, 0.617880762f},
-std::array<float,2>{0.1147459f, 0.926137567f},
-std::array<float,2>{0.671183884f, 0.0467611924f},
-std::array<float,2>{0.22768952f, 0.149315551f},
-std::array<float,2>{0.586572111f, 0.82972759f},
-std::array<float,2>{0.394479096f, 0.635418534f},
-std::array<float,2>{0.963407159f, 0.436983705f},
-std::array<float,2>{0.0230695624f, 0.440884203f},
-std::array<float,2>{0.699126065f, 0.715693533f},
-std::array<float,2>{0.323395133f, 0.756992221f},
-std::array<float,2>{0.827757001f, 0.242889777f},
-std::array<float,2>{0.471125901f, 0.116617523f},
-std::array<float,2>{0.920014501f, 0.942732453f},
-std::array<float,2>{0.129183993f, 0.551036417f},
-std::array<float,2>{0.511764169f, 0.342849612f},
-std::array<float,2>{0.441910088f, 0.316619843f},
-std::array<float,2>{0.899030089f, 0.533913076f},
-std::array<float,2>{0.158715889f, 0.960220456f},
-std::array<float,2>{0.559966981f, 0.104236662f},
-std::array<float,2>{0.0530963801f, 0.226686582f},
-std::array<float,2>{0.733922243f, 0.76891315f},
-std::array<float,2>{0.366226256f, 0.700073183f},
-std::array<float,2>{0.844272137f, 0.45943737f},
-std::array<float,2>{0.189157873f, 0.41369161f},
-std::array<float,2>{0.608622849f, 0.644303203f},
-std::array<float,2>{0.418280661f, 0.8203246f},
-std::array<float,2>{0.977486253f, 0.125432834f},
-std::array<float,2>{0.312373191f, 0.0495437607f},
-std::array<float,2>{0.810704589f, 0.910472035f},
-std::array<float,2>{0.0639693066f, 0.598886788f},
-std::array<float,2>{0.643751025f, 0.274903238f},
-std::array<float,2>{0.333317935f, 0.486364394f},
-std::array<float,2>{0.841081917f, 0.738083482f},
-std::array<float,2>{0.0108854463f, 0.810250759f},
-std::array<float,2>{0.711531699f, 0.202943802f},
-std::array<float,2>{0.156192109f, 0.0795658156f},
-std::array<float,2>{0.521765113f, 0.976848423f},
-std::array<float,2>{0.4845348f, 0.523520112f},
-std::array<float,2>{0.928212166f, 0.347413629f},
-std::array<float,2>{0.100537188f, 0.300053269f},
-std::array<float,2>{0.683964312f, 0.567551851f},
-std::array<float,2>{0.258876711f, 0.902292013f},
-std::array<float,2>{0.762939453f, 0.0109190308f},
-std::array<float,2>{0.384647816f, 0.1847101f},
-std::array<float,2>{0.946045399f, 0.848356545f},
-std::array<float,2>{0.241029501f, 0.677736342f},
-std::array<float,2>{0.572699904f, 0.39862892f},
-std::array<float,2>{0.465361416f, 0.416542619f},
-std::array<float,2>{0.887012899f, 0.653039634f},
-std::array<float,2>{0.185257047f, 0.818045914f},
-std::array<float,2>{0.544959009f, 0.13614504f},
-std::array<float,2>{0.042274911f, 0.0605026297f},
-std::array<float,2>{0.737250805f, 0.91653651f},
-std::array<float,2>{0.345159143f, 0.603476584f},
-std::array<float,2>{0.871148288f, 0.267486721f},
-std::array<float,2>{0.216360763f, 0.321504653f},
-std::array<float,2>{0.623667181f, 0.541540027f},
-std::array<float,2>{0.427637577f, 0.964759946f},
-std::array<float,2>{0.991492808f, 0.0976429433f},
-std::array<float,2>{0.283541769f, 0.222494811f},
-std::array<float,2>{0.796254516f, 0.777218819f},
-std::array<float,2>{0.0876567587f, 0.693549633f},
-std::array<float,2>{0.625925422f, 0.462744027f},
-std::array<float,2>{0.32720992f, 0.308842182f},
-std::array<float,2>{0.823297679f, 0.572610617f},
-std::array<float,2>{0.0160698574f, 0.892376602f},
-std::array<float,2>{0.699281335f, 0.00521629024f},
-std::array<float,2>{0.126334295f, 0.175496221f},
-std::array<float,2>{0.508736372f, 0.853387833f},
-std::array<float,2>{0.474961519f, 0.680571854f},
-std::array<float,2>{0.914436638f, 0.398307145f},
-std::array<float,2>{0.112359576f, 0.498179138f},
-std::array<float,2>{0.666040838f, 0.747205257f},
-std::array<float,2>{0.280705035f, 0.798420489f},
-std::array<float,2>{0.778770328f, 0.1885726f},
-std::array<float,2>{0.395153761f, 0.0877726153f},
-std::array<float,2>{0.965256512f, 0.976434469f},
-std::array<float,2>{0.233643129f, 0.518228471f},
-std::array<float,2>{0.591642857f, 0.358411551f},
-std::array<float,2>{0.416714996f, 0.35975489f},
-std::array<float,2>{0.98140043f, 0.513177812f},
-std::array<float,2>{0.194014609f, 0.990840614f},
-std::array<float,2>{0.604368567f, 0.0739751458f},
-std::array<float,2>{0.0685749277f, 0.210930362f},
-std::array<float,2>{0.645363271f, 0.783272147f},
-std::array<float,2>{0.304993033f, 0.724032402f},
-std::array<float,2>{0.808442771f, 0.483575463f},
-std::array<float,2>{0.162728697f, 0.375750124f},
-std::array<float,2>{0.557837009f, 0.669619322f},
-std::array<float,2>{0.439022332f, 0.874697089f},
-std::array<float,2>{0.905532837f, 0.166596279f},
-std::array<float,2>{0.360185206f, 0.0311576668f},
-std::array<float,2>{0.84948957f, 0.888726294f},
-std::array<float,2>{0.0489768609f, 0.592083514f},
-std::array<float,2>{0.727582633f, 0.284438431f},
-std::array<float,2>{0.264564335f, 0.450837165f},
-std::array<float,2>{0.759236157f, 0.710883319f},
-std::array<float,2>{0.096398741f, 0.763917804f},
-std::array<float,2>{0.680822551f, 0.240938663f},
-std::array<float,2>{0.237779513f, 0.120039366f},
-std::array<float,2>{0.577200592f, 0.949456871f},
-std::array<float,2>{0.388849199f, 0.557511568f},
-std::array<float,2>{0.95073086f, 0.334461987f},
-std::array<float,2>{0.0136546241f, 0.265447021f},
-std::array<float,2>{0.716564953f, 0.612500906f},
-std::array<float,2>{0.331627667f, 0.932514369f},
-std::array<float,2>{0.838699281f, 0.0317109264f},
-std::array<float,2>{0.489365429f, 0.144689158f},
-std::array<float,2>{0.923826039f, 0.839086771f},
-std::array<float,2>{0.14982681f, 0.628609359f},
-std::array<float,2>{0.519117594f, 0.428418905f},
-std::array<float,2>{0.381685972f, 0.474449635f},
-std::array<float,2>{0.938895464f, 0.733385205f},
-std::array<float,2>{0.24684532f, 0.794855356f},
-std::array<float,2>{0.568382621f, 0.212432608f},
-std::array<float,2>{0.102157399f, 0.0630967095f},
-std::array<float,2>{0.676447451f, 0.992325902f},
-std::array<float,2>{0.251283348f, 0.502862751f},
-std::array<float,2>{0.753507376f, 0.372868657f},
-std::array<float,2>{0.143919662f, 0.295176923f},
-std::array<float,2>{0.52380228f, 0.582996666f},
-std::array<float,2>{0.496838778f, 0.87935847f},
-std::array<float,2>{0.935633659f, 0.0160868634f},
-std::array<float,2>{0.338443577f, 0.156297222f},
-std::array<float,2>{0.83025533f, 0.861314237f},
-std::array<float,2>{0.000771904364f, 0.659939528f},
-std::array<float,2>{0.710810959f, 0.386529595f},
-std::array<float,2>{0.299140811f, 0.339355588f},
-std::array<float,2>{0.800035477f, 0.54963243f},
-std::array<float,2>{0.0708210394f, 0.937778056f},
-std::array<float,2>{0.648811758f, 0.109636985f},
-std::array<float,2>{0.198863253f, 0.247527242f},
-std::array<float,2>{0.598573804f, 0.750008762f},
-std::array<float,2>{0.407994092f, 0.713592708f},
-std::array<float,2>{0.971109211f, 0.443041831f},
-std::array<float,2>{0.0613907315f, 0.429850817f},
-std::array<float,2>{0.725798011f, 0.637594461f},
-std::array<float,2>{0.368921846f, 0.834595025f},
-std::array<float,2>{0.852867186f, 0.15241307f},
-std::array<float,2>{0.450993955f, 0.0405120328f},
-std::array<float,2>{0.893309414f, 0.925361097f},
-std::array<float,2>{0.167919889f, 0.622875512f},
-std::array<float,2>{0.549152374f, 0.257105857f},
-std::array<float,2>{0.476942837f, 0.279542059f},
-std::array<float,2>{0.907088518f, 0.594051778f},
-std::array<float,2>{0.138815954f, 0.909033656f},
-std::array<float,2>{0.505323529f, 0.0527447499f},
-std::array<float,2>{0.0244110692f, 0.130475029f},
-std::array<float,2>{0.693627775f, 0.824679315f},
-std::array<float,2>{0.314803004f, 0.644694746f},
-std::array<float,2>{0.819251657f, 0.410025507f},
-std::array<float,2>{0.22319749f, 0.456907332f},
-std::array<float,2>{0.581183791f, 0.697061419f},
-std::array<float,2>{0.403910846f, 0.772055626f},
-std::array<float,2>{0.953612745f, 0.232772157f},
-std::array<float,2>{0.268326163f, 0.108671911f},
-std::array<float,2>{0.766795754f, 0.954451203f},
-std::array<float,2>{0.118366472f, 0.535823464f},
-std::array<float,2>{0.663277507f, 0.313165605f},
-std::array<float,2>{0.357771337f, 0.403158605f},
-std::array<float,2>{0.865563393f, 0.675391674f},
-std::array<float,2>{0.0326078683f, 0.844914615f},
-std::array<float,2>{0.746277809f, 0.181641445f},
-std::array<float,2>{0.178662494f, 0.015226434f},
-std::array<float,2>{0.533360064f, 0.904234946f},
-std::array<float,2>{0.456424832f, 0.564209223f},
-std::array<float,2>{0.877916157f, 0.304500043f},
-std::array<float,2>{0.0845599622f, 0.347739279f},
-std::array<float,2>{0.640355349f, 0.530003369f},
-std::array<float,2>{0.293199748f, 0.98129952f},
-std::array<float,2>{0.786286831f, 0.0832302198f},
-std::array<float,2>{0.431229681f, 0.195375994f},
-std::array<float,2>{0.992749929f, 0.808162749f},
-std::array<float,2>{0.209046334f, 0.740867734f},
-std::array<float,2>{0.610832155f, 0.490896255f},
-std::array<float,2>{0.449104965f, 0.494733363f},
-std::array<float,2>{0.896648407f, 0.74595052f},
-std::array<float,2>{0.171237275f, 0.800940633f},
-std::array<float,2>{0.553583324f, 0.193700433f},
-std::array<float,2>{0.0579093993f, 0.0902441889f},
-std::array<float,2>{0.719544291f, 0.970362604f},
-std::array<float,2>{0.373444289f, 0.522781312f},
-std::array<float,2>{0.855887592f, 0.353121847f},
-std::array<float,2>{0.20045501f, 0.307338923f},
-std::array<float,2>{0.593791425f, 0.576414108f},
-std::array<float,2>{0.413297653f, 0.896485388f},
-std::array<float,2>{0.974399149f, 0.00173947646f},
-std::array<float,2>{0.300889969f, 0.178739011f},
-std::array<float,2>{0.803056836f, 0.858533561f},
-std::array<float,2>{0.0752323866f, 0.684612274f},
-std::array<float,2>{0.654919386f, 0.392079622f},
-std::array<float,2>{0.343571067f, 0.327000022f},
-std::array<float,2>{0.832325637f, 0.545917749f},
-std::array<float,2>{0.0044254777f, 0.965721607f},
-std::array<float,2>{0.705099761f, 0.100959234f},
-std::array<float,2>{0.146387994f, 0.225417405f},
-std::array<float,2>{0.530875444f, 0.781200886f},
-std::array<float,2>{0.495927781f, 0.690254629f},
-std::array<float,2>{0.93155092f, 0.466471285f},
-std::array<float,2>{0.107615881f, 0.419570208f},
-std::array<float,2>{0.674893737f, 0.651968956f},
-std::array<float,2>{0.257313251f, 0.814293981f},
-std::array<float,2>{0.754391372f, 0.137984574f},
-std::array<float,2>{0.378500193f, 0.0571761467f},
-std::array<float,2>{0.942149222f, 0.92035383f},
-std::array<float,2>{0.244469106f, 0.607021093f},
-std::array<float,2>{0.566002667f, 0.271044821f},
-std::array<float,2>{0.434041411f, 0.261043996f},
-std::array<float,2>{0.997268915f, 0.616087854f},
-std::array<float,2>{0.205249652f, 0.934134364f},
-std::array<float,2>{0.616718471f, 0.0383051597f},
-std::array<float,2>{0.0786809549f, 0.142554745f},
-std::array<float,2>{0.635410607f, 0.840658188f},
-std::array<float,2>{0.292400867f, 0.631513298f},
-std::array<float,2>{0.785061479f, 0.422696412f},
-std::array<float,2>{0.173520952f, 0.448517025f},
-std::array<float,2>{0.538979232f, 0.703306317f},
-std::array<float,2>{0.457922101f, 0.760440767f},
-std::array<float,2>{0.880123317f, 0.238174066f},
-std::array<float,2>{0.353362352f, 0.124830917f},
-std::array<float,2>{0.861813009f, 0.947792172f},
-std::array<float,2>{0.0376033634f, 0.559746087f},
-std::array<float,2>{0.742266536f, 0.328468412f},
-std::array<float,2>{0.270995915f, 0.380995959f},
-std::array<float,2>{0.771753132f, 0.666504085f},
-std::array<float,2>{0.121181764f, 0.867277145f},
-std::array<float,2>{0.658957422f, 0.168142617f},
-std::array<float,2>{0.219387919f, 0.0244345777f},
-std::array<float,2>{0.58550483f, 0.885258436f},
-std::array<float,2>{0.400190234f, 0.586142778f},
-std::array<float,2>{0.959806085f, 0.287981093f},
-std::array<float,2>{0.0300236419f, 0.364862859f},
-std::array<float,2>{0.690252602f, 0.510968447f},
-std::array<float,2>{0.319001496f, 0.987984061f},
-std::array<float,2>{0.812590659f, 0.074326396f},
-std::array<float,2>{0.484095752f, 0.205741882f},
-std::array<float,2>{0.911209702f, 0.788155079f},
-std::array<float,2>{0.136225954f, 0.722635448f},
-std::array<float,2>{0.503503859f, 0.479116648f},
-std::array<float,2>{0.392131001f, 0.433614254f},
-std::array<float,2>{0.961696208f, 0.633877933f},
-std::array<float,2>{0.229978874f, 0.830375254f},
-std::array<float,2>{0.588781416f, 0.151215807f},
-std::array<float,2>{0.116772257f, 0.0443653464f},
-std::array<float,2>{0.668189585f, 0.929477334f},
-std::array<float,2>{0.274261445f, 0.619637847f},
-std::array<float,2>{0.775959134f, 0.250678122f},
-std::array<float,2>{0.131450668f, 0.341488808f},
-std::array<float,2>{0.514726877f, 0.554150283f},
-std::array<float,2>{0.469207525f, 0.945054531f},
-std::array<float,2>{0.919537067f, 0.114455901f},
-std::array<float,2>{0.320787907f, 0.245987579f},
-std::array<float,2>{0.825963914f, 0.754053593f},
-std::array<float,2>{0.0195645932f, 0.718043089f},
-std::array<float,2>{0.696925104f, 0.438982874f},
-std::array<float,2>{0.287403882f, 0.289976299f},
-std::array<float,2>{0.789857984f, 0.579621017f},
-std::array<float,2>{0.089906469f, 0.875083864f},
-std::array<float,2>{0.62992388f, 0.0214614514f},
-std::array<float,2>{0.214672595f, 0.160520181f},
-std::array<float,2>{0.620946705f, 0.866019905f},
-std::array<float,2>{0.424762607f, 0.663739443f},
-std::array<float,2>{0.984439611f, 0.390304565f},
-std::array<float,2>{0.0434980206f, 0.472133309f},
-std::array<float,2>{0.739685595f, 0.72879231f},
-std::array<float,2>{0.350003481f, 0.791002274f},
-std::array<float,2>{0.867532253f, 0.218525618f},
-std::array<float,2>{0.463152051f, 0.0665608048f},
-std::array<float,2>{0.885222614f, 0.998008251f},
-std::array<float,2>{0.182576567f, 0.504242063f},
-std::array<float,2>{0.541304529f, 0.368581265f},
-std::array<float,2>{0.487010539f, 0.344074458f},
-std::array<float,2>{0.926938593f, 0.526406348f},
-std::array<float,2>{0.153779045f, 0.97933495f},
-std::array<float,2>{0.521451056f, 0.081087023f},
-std::array<float,2>{0.00966743939f, 0.199305609f},
-std::array<float,2>{0.713635206f, 0.811267614f},
-std::array<float,2>{0.334514827f, 0.735262394f},
-std::array<float,2>{0.842244864f, 0.48592931f},
-std::array<float,2>{0.240056798f, 0.401108295f},
-std::array<float,2>{0.570927799f, 0.676888287f},
-std::array<float,2>{0.386099964f, 0.851015031f},
-std::array<float,2>{0.948332191f, 0.186718196f},
-std::array<float,2>{0.261134595f, 0.00966348685f},
-std::array<float,2>{0.764511526f, 0.899791002f},
-std::array<float,2>{0.098209396f, 0.56901288f},
-std::array<float,2>{0.68694818f, 0.297270596f},
-std::array<float,2>{0.364098728f, 0.45794782f},
-std::array<float,2>{0.847514927f, 0.701903343f},
-std::array<float,2>{0.0510007404f, 0.767131865f},
-std::array<float,2>{0.732081532f, 0.229969114f},
-std::array<float,2>{0.157060295f, 0.101655379f},
-std::array<float,2>{0.561366379f, 0.957164526f},
-std::array<float,2>{0.445145518f, 0.531634986f},
-std::array<float,2>{0.900809824f, 0.320166141f},
-std::array<float,2>{0.065185003f, 0.27692318f},
-std::array<float,2>{0.642386198f, 0.600669563f},
-std::array<float,2>{0.309621602f, 0.913498163f},
-std::array<float,2>{0.808668673f, 0.0469190776f},
-std::array<float,2>{0.421835661f, 0.128478542f},
-std::array<float,2>{0.980377793f, 0.823643208f},
-std::array<float,2>{0.190978959f, 0.641607583f},
-std::array<float,2>{0.606634319f, 0.411646515f},
-std::array<float,2>{0.474488407f, 0.395687222f},
-std::array<float,2>{0.91642344f, 0.683398187f},
-std::array<float,2>{0.128289834f, 0.853541434f},
-std::array<float,2>{0.511497676f, 0.172964528f},
-std::array<float,2>{0.0186748244f, 0.00604315475f},
-std::array<float,2>{0.702515602f, 0.89281553f},
-std::array<float,2>{0.324701786f, 0.570792437f},
-std::array<float,2>{0.821941555f, 0.312088758f},
-std::array<float,2>{0.232383445f, 0.355537951f},
-std::array<float,2>{0.59329319f, 0.515977263f},
-std::array<float,2>{0.397243828f, 0.974406064f},
-std::array<float,2>{0.967888236f, 0.0898155198f},
-std::array<float,2>{0.278297961f, 0.190167993f},
-std::array<float,2>{0.780080318f, 0.798888743f},
-std::array<float,2>{0.111173689f, 0.748434365f},
-std::array<float,2>{0.664919019f, 0.497916728f},
-std::array<float,2>{0.347032517f, 0.267999768f},
-std::array<float,2>{0.873111069f, 0.604060709f},
-std::array<float,2>{0.0405543335f, 0.914071262f},
-std::array<float,2>{0.735609651f, 0.061605338f},
-std::array<float,2>{0.185905412f, 0.133137524f},
-std::array<float,2>{0.543849707f, 0.819807172f},
-std::array<float,2>{0.467176288f, 0.655460715f},
-std::array<float,2>{0.889398277f, 0.415732116f},
-std::array<float,2>{0.0894394144f, 0.463612854f},
-std::array<float,2>{0.628340364f, 0.691633761f},
-std::array<float,2>{0.282513827f, 0.775153756f},
-std::array<float,2>{0.793578386f, 0.219521448f},
-std::array<float,2>{0.428132653f, 0.0943839476f},
-std::array<float,2>{0.988432109f, 0.962239683f},
-std::array<float,2>{0.218200997f, 0.539663315f},
-std::array<float,2>{0.622870505f, 0.323426038f},
-std::array<float,2>{0.387339264f, 0.332426876f},
-std::array<float,2>{0.952693164f, 0.55641526f},
-std::array<float,2>{0.234731212f, 0.951499581f},
-std::array<float,2>{0.575398266f, 0.119108863f},
-std::array<float,2>{0.0947953537f, 0.238998219f},
-std::array<float,2>{0.683456659f, 0.763430834f},
-std::array<float,2>{0.262531012f, 0.707712352f},
-std::array<float,2>{0.760815203f, 0.452780008f},
-std::array<float,2>{0.151024401f, 0.427346677f},
-std::array<float,2>{0.515894473f, 0.626745522f},
-std::array<float,2>{0.490691543f, 0.836906493f},
-std::array<float,2>{0.924608648f, 0.147652298f},
-std::array<float,2>{0.328261882f, 0.0334243067f},
-std::array<float,2>{0.837368906f, 0.930975199f},
-std::array<float,2>{0.0156076727f, 0.609934092f},
-std::array<float,2>{0.718035102f, 0.263507694f},
-std::array<float,2>{0.30834645f, 0.482371062f},
-std::array<float,2>{0.805964768f, 0.725573003f},
-std::array<float,2>{0.0674022809f, 0.782544076f},
-std::array<float,2>{0.647148907f, 0.208763897f},
-std::array<float,2>{0.192469954f, 0.0710048452f},
-std::array<float,2>{0.602054775f, 0.988584042f},
-std::array<float,2>{0.415383846f, 0.515620887f},
-std::array<float,2>{0.982652068f, 0.36323148f},
-std::array<float,2>{0.048469279f, 0.282132506f},
-std::array<float,2>{0.728620291f, 0.590375841f},
-std::array<float,2>{0.361535043f, 0.887682021f},
-std::array<float,2>{0.849763393f, 0.029232895f},
-std::array<float,2>{0.440589249f, 0.165259883f},
-std::array<float,2>{0.902507365f, 0.872446239f},
-std::array<float,2>{0.161536157f, 0.670556128f},
-std::array<float,2>{0.555763781f, 0.377485663f},
-std::array<float,2>{0.409781694f, 0.445085943f},
-std::array<float,2>{0.970055521f, 0.711941481f},
-std::array<float,2>{0.195818126f, 0.75275737f},
-std::array<float,2>{0.601472318f, 0.248076662f},
-std::array<float,2>{0.0725199804f, 0.112816259f},
-std::array<float,2>{0.651937723f, 0.941041946f},
-std::array<float,2>{0.297598481f, 0.547412097f},
-std::array<float,2>{0.798282921f, 0.335982442f},
-std::array<float,2>{0.165150687f, 0.255295366f},
-std::array<float,2>{0.547154725f, 0.624994993f},
-std::array<float,2>{0.452679515f, 0.922406316f},
-std::array<float,2>{0.89199549f, 0.0422798134f},
-std::array<float,2>{0.370627522f, 0.154651999f},
-std::array<float,2>{0.854090035f, 0.832821488f},
-std::array<float,2>{0.0591235496f, 0.640210152f},
-std::array<float,2>{0.723077834f, 0.43254891f},
-std::array<float,2>{0.253692746f, 0.374963403f},
-std::array<float,2>{0.751923382f, 0.50108552f},
-std::array<float,2>{0.104935877f, 0.995239735f},
-std::array<float,2>{0.677834034f, 0.0652782694f},
-std::array<float,2>{0.248845175f, 0.213506162f},
-std::array<float,2>{0.567538261f, 0.795783758f},
-std::array<float,2>{0.380035788f, 0.730936885f},
-std::array<float,2>{0.939998031f, 0.474997073f},
-std::array<float,2>{0.00304037309f, 0.383477032f},
-std::array<float,2>{0.708403945f, 0.656254768f},
-std::array<float,2>{0.337532729f, 0.861968219f},
-std::array<float,2>{0.829767942f, 0.158859149f},
-std::array<float,2>{0.499362737f, 0.0190598182f},
-std::array<float,2>{0.934293926f, 0.882148683f},
-std::array<float,2>{0.140907526f, 0.584346056f},
-std::array<float,2>{0.525672197f, 0.293569475f},
-std::array<float,2>{0.454583675f, 0.30206582f},
-std::array<float,2>{0.875052094f, 0.564590275f},
-std::array<float,2>{0.177187517f, 0.905528724f},
-std::array<float,2>{0.532439768f, 0.0124698421f},
-std::array<float,2>{0.0335858092f, 0.180330053f},
-std::array<float,2>{0.748216152f, 0.846284926f},
-std::array<float,2>{0.356858045f, 0.672032475f},
-std::array<float,2>{0.863558054f, 0.404336393f},
-std::array<float,2>{0.20732522f, 0.488808602f},
-std::array<float,2>{0.612221062f, 0.740210235f},
-std::array<float,2>{0.432900727f, 0.804928124f},
-std::array<float,2>{0.994892657f, 0.197668821f},
-std::array<float,2>{0.296308339f, 0.0856866986f},
-std::array<float,2>{0.787335396f, 0.983388305f},
-std::array<float,2>{0.0820794702f, 0.528781593f},
-std::array<float,2>{0.638632059f, 0.350608051f},
-std::array<float,2>{0.313988984f, 0.406980425f},
-std::array<float,2>{0.81721431f, 0.646881402f},
-std::array<float,2>{0.027227195f, 0.826371074f},
-std::array<float,2>{0.692695141f, 0.131888077f},
-std::array<float,2>{0.138516888f, 0.0521050766f},
-std::array<float,2>{0.50778234f, 0.907810628f},
-std::array<float,2>{0.479226261f, 0.595719397f},
-std::array<float,2>{0.908541381f, 0.277505338f},
-std::array<float,2>{0.119296104f, 0.314684689f},
-std::array<float,2>{0.660448015f, 0.53742975f},
-std::array<float,2>{0.266314924f, 0.956670046f},
-std::array<float,2>{0.769399285f, 0.105878353f},
-std::array<float,2>{0.405502915f, 0.232195914f},
-std::array<float,2>{0.95677495f, 0.770979166f},
-std::array<float,2>{0.225227177f, 0.698615789f},
-std::array<float,2>{0.579291523f, 0.453436673f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.17298381f, 0.306409091f},
-std::array<float,2>{0.586977363f, 0.943912208f},
-std::array<float,2>{0.850883782f, 0.139507055f},
-std::array<float,2>{0.29426676f, 0.579453707f},
-std::array<float,2>{0.411666751f, 0.0375393815f},
-std::array<float,2>{0.98724252f, 0.642240047f},
-std::array<float,2>{0.746882319f, 0.428082407f},
-std::array<float,2>{0.0647167712f, 0.75474757f},
-std::array<float,2>{0.0396803059f, 0.216848269f},
-std::array<float,2>{0.677924514f, 0.547806025f},
-std::array<float,2>{0.894552946f, 0.374850482f},
-std::array<float,2>{0.475077361f, 0.901367009f},
-std::array<float,2>{0.366211772f, 0.475740373f},
-std::array<float,2>{0.754295826f, 0.828775823f},
-std::array<float,2>{0.544958711f, 0.0806797519f},
-std::array<float,2>{0.198401943f, 0.704588592f},
-std::array<float,2>{0.0988202021f, 0.391683996f},
-std::array<float,2>{0.71767503f, 0.800080121f},
-std::array<float,2>{0.949028611f, 0.0230830852f},
-std::array<float,2>{0.404625565f, 0.659739614f},
-std::array<float,2>{0.278799415f, 0.167020351f},
-std::array<float,2>{0.828233182f, 0.594432294f},
-std::array<float,2>{0.599254191f, 0.26090166f},
-std::array<float,2>{0.156140015f, 0.985322356f},
-std::array<float,2>{0.230257571f, 0.104747333f},
-std::array<float,2>{0.526297033f, 0.740920782f},
-std::array<float,2>{0.806993246f, 0.465489745f},
-std::array<float,2>{0.329584271f, 0.868832469f},
-std::array<float,2>{0.454472989f, 0.312960297f},
-std::array<float,2>{0.924195111f, 0.923749745f},
-std::array<float,2>{0.643201053f, 0.241407052f},
-std::array<float,2>{0.0246269796f, 0.514027119f},
-std::array<float,2>{0.209663957f, 0.44645229f},
-std::array<float,2>{0.551471531f, 0.847288728f},
-std::array<float,2>{0.772240281f, 0.121262953f},
-std::array<float,2>{0.358785212f, 0.722976923f},
-std::array<float,2>{0.492782235f, 0.232073441f},
-std::array<float,2>{0.883663476f, 0.519929707f},
-std::array<float,2>{0.660416603f, 0.33386448f},
-std::array<float,2>{0.0539238602f, 0.908216894f},
-std::array<float,2>{0.0877431333f, 0.0123198535f},
-std::array<float,2>{0.731507897f, 0.679024875f},
-std::array<float,2>{0.975830555f, 0.377797037f},
-std::array<float,2>{0.431552798f, 0.784173846f},
-std::array<float,2>{0.300949782f, 0.272403955f},
-std::array<float,2>{0.861040235f, 0.977440357f},
-std::array<float,2>{0.576241732f, 0.183430731f},
-std::array<float,2>{0.159456372f, 0.622969866f},
-std::array<float,2>{0.00571237504f, 0.354628235f},
-std::array<float,2>{0.626954198f, 0.884116173f},
-std::array<float,2>{0.913283288f, 0.192699447f},
-std::array<float,2>{0.451495498f, 0.544406056f},
-std::array<float,2>{0.314103752f, 0.0686761588f},
-std::array<float,2>{0.790401578f, 0.693913817f},
-std::array<float,2>{0.511891901f, 0.49231708f},
-std::array<float,2>{0.235348016f, 0.817862928f},
-std::array<float,2>{0.134942621f, 0.14323625f},
-std::array<float,2>{0.616127551f, 0.574362218f},
-std::array<float,2>{0.825986326f, 0.281737626f},
-std::array<float,2>{0.26162073f, 0.967272758f},
-std::array<float,2>{0.379628569f, 0.414231151f},
-std::array<float,2>{0.954717278f, 0.779512048f},
-std::array<float,2>{0.697204173f, 0.0537217967f},
-std::array<float,2>{0.123867191f, 0.626248419f},
-std::array<float,2>{0.247343615f, 0.336966008f},
-std::array<float,2>{0.50182724f, 0.91952306f},
-std::array<float,2>{0.785941958f, 0.223724976f},
-std::array<float,2>{0.326307178f, 0.526464283f},
-std::array<float,2>{0.440342098f, 0.109522931f},
-std::array<float,2>{0.920280159f, 0.729513109f},
-std::array<float,2>{0.636407971f, 0.444178075f},
-std::array<float,2>{0.0127320457f, 0.858655274f},
-std::array<float,2>{0.116696276f, 0.172710791f},
-std::array<float,2>{0.691406608f, 0.611943841f},
-std::array<float,2>{0.968639076f, 0.275767386f},
-std::array<float,2>{0.38310498f, 0.968863249f},
-std::array<float,2>{0.252846956f, 0.3871319f},
-std::array<float,2>{0.817459404f, 0.796214521f},
-std::array<float,2>{0.61803925f, 0.00525205908f},
-std::array<float,2>{0.131061569f, 0.679701209f},
-std::array<float,2>{0.0549144074f, 0.485995173f},
-std::array<float,2>{0.667847931f, 0.82567066f},
-std::array<float,2>{0.878278732f, 0.0716375187f},
-std::array<float,2>{0.484749049f, 0.701481044f},
-std::array<float,2>{0.343931645f, 0.202620402f},
-std::array<float,2>{0.777944922f, 0.532134891f},
-std::array<float,2>{0.557061255f, 0.345525175f},
-std::array<float,2>{0.216322854f, 0.876785576f},
-std::array<float,2>{0.167022854f, 0.0568032935f},
-std::array<float,2>{0.56413275f, 0.640012026f},
-std::array<float,2>{0.869959354f, 0.413654596f},
-std::array<float,2>{0.310057789f, 0.76783973f},
-std::array<float,2>{0.428552836f, 0.295209944f},
-std::array<float,2>{0.97883296f, 0.959225178f},
-std::array<float,2>{0.723280668f, 0.153473884f},
-std::array<float,2>{0.0848109722f, 0.563966334f},
-std::array<float,2>{0.143057227f, 0.43434754f},
-std::array<float,2>{0.604435205f, 0.762193084f},
-std::array<float,2>{0.83676976f, 0.0416520126f},
-std::array<float,2>{0.266813636f, 0.654357195f},
-std::array<float,2>{0.39336589f, 0.13036114f},
-std::array<float,2>{0.940140784f, 0.593333006f},
-std::array<float,2>{0.704836786f, 0.303599626f},
-std::array<float,2>{0.10455668f, 0.948712707f},
-std::array<float,2>{0.0171709657f, 0.0898458958f},
-std::array<float,2>{0.654769957f, 0.712424099f},
-std::array<float,2>{0.932665527f, 0.477686137f},
-std::array<float,2>{0.465160877f, 0.839091718f},
-std::array<float,2>{0.337181926f, 0.360117972f},
-std::array<float,2>{0.80052948f, 0.896912098f},
-std::array<float,2>{0.522741735f, 0.209678024f},
-std::array<float,2>{0.226219818f, 0.559598863f},
-std::array<float,2>{0.0777089223f, 0.253021508f},
-std::array<float,2>{0.735162973f, 0.997714937f},
-std::array<float,2>{0.99771148f, 0.159699842f},
-std::array<float,2>{0.41694659f, 0.605910003f},
-std::array<float,2>{0.288934261f, 0.0309426896f},
-std::array<float,2>{0.855265558f, 0.670522809f},
-std::array<float,2>{0.582661748f, 0.405577064f},
-std::array<float,2>{0.183855578f, 0.810586989f},
-std::array<float,2>{0.192741454f, 0.243805364f},
-std::array<float,2>{0.537289083f, 0.500892997f},
-std::array<float,2>{0.758383811f, 0.323902786f},
-std::array<float,2>{0.373366445f, 0.931439936f},
-std::array<float,2>{0.480020374f, 0.454363614f},
-std::array<float,2>{0.90051949f, 0.861689985f},
-std::array<float,2>{0.679776967f, 0.0983274356f},
-std::array<float,2>{0.0378198847f, 0.746011794f},
-std::array<float,2>{0.125835791f, 0.367462069f},
-std::array<float,2>{0.624221861f, 0.903316379f},
-std::array<float,2>{0.814391434f, 0.211376935f},
-std::array<float,2>{0.254482508f, 0.552290797f},
-std::array<float,2>{0.390192538f, 0.0843708664f},
-std::array<float,2>{0.964718282f, 0.709636688f},
-std::array<float,2>{0.69121033f, 0.469835579f},
-std::array<float,2>{0.111984052f, 0.834771097f},
-std::array<float,2>{0.0106760869f, 0.133531585f},
-std::array<float,2>{0.638464272f, 0.58398658f},
-std::array<float,2>{0.916957498f, 0.311861664f},
-std::array<float,2>{0.444752634f, 0.939456582f},
-std::array<float,2>{0.321823716f, 0.42194128f},
-std::array<float,2>{0.781333804f, 0.75369221f},
-std::array<float,2>{0.506945431f, 0.0341606922f},
-std::array<float,2>{0.245481431f, 0.645887792f},
-std::array<float,2>{0.078678824f, 0.460952163f},
-std::array<float,2>{0.719448745f, 0.873209774f},
-std::array<float,2>{0.98273176f, 0.106811903f},
-std::array<float,2>{0.422310621f, 0.734479666f},
-std::array<float,2>{0.306063771f, 0.237150088f},
-std::array<float,2>{0.872324705f, 0.508163571f},
-std::array<float,2>{0.566955924f, 0.317920208f},
-std::array<float,2>{0.169162259f, 0.928815424f},
-std::array<float,2>{0.212711141f, 0.0176766794f},
-std::array<float,2>{0.560455918f, 0.661652923f},
-std::array<float,2>{0.774694979f, 0.394613326f},
-std::array<float,2>{0.349243999f, 0.803446591f},
-std::array<float,2>{0.489662915f, 0.261882275f},
-std::array<float,2>{0.881521344f, 0.990413129f},
-std::array<float,2>{0.669183195f, 0.170918852f},
-std::array<float,2>{0.0587044358f, 0.601220369f},
-std::array<float,2>{0.221433371f, 0.380973786f},
-std::array<float,2>{0.51912415f, 0.787661135f},
-std::array<float,2>{0.804295421f, 0.010949187f},
-std::array<float,2>{0.341065317f, 0.67210114f},
-std::array<float,2>{0.461167365f, 0.18478924f},
-std::array<float,2>{0.935460031f, 0.618012309f},
-std::array<float,2>{0.650679111f, 0.26949206f},
-std::array<float,2>{0.0223696716f, 0.982713997f},
-std::array<float,2>{0.105923094f, 0.11846523f},
-std::array<float,2>{0.709287763f, 0.719591796f},
-std::array<float,2>{0.942786813f, 0.449350893f},
-std::array<float,2>{0.395365685f, 0.849734187f},
-std::array<float,2>{0.272074014f, 0.33008036f},
-std::array<float,2>{0.84247762f, 0.91082859f},
-std::array<float,2>{0.608540893f, 0.22781907f},
-std::array<float,2>{0.146736145f, 0.517449796f},
-std::array<float,2>{0.0328947119f, 0.288449615f},
-std::array<float,2>{0.686772764f, 0.964406908f},
-std::array<float,2>{0.902816236f, 0.146201998f},
-std::array<float,2>{0.482400447f, 0.573070467f},
-std::array<float,2>{0.370285302f, 0.0495282523f},
-std::array<float,2>{0.762092054f, 0.630388856f},
-std::array<float,2>{0.532170892f, 0.420112073f},
-std::array<float,2>{0.189385086f, 0.775290251f},
-std::array<float,2>{0.183271989f, 0.187544525f},
-std::array<float,2>{0.579641938f, 0.540247917f},
-std::array<float,2>{0.859201908f, 0.357645601f},
-std::array<float,2>{0.282469869f, 0.887631357f},
-std::array<float,2>{0.419846505f, 0.4968611f},
-std::array<float,2>{0.996032417f, 0.813790441f},
-std::array<float,2>{0.741120219f, 0.0639476478f},
-std::array<float,2>{0.0739742368f, 0.689717531f},
-std::array<float,2>{0.202276275f, 0.279859453f},
-std::array<float,2>{0.539686859f, 0.974509597f},
-std::array<float,2>{0.753391385f, 0.178614572f},
-std::array<float,2>{0.359703839f, 0.615187049f},
-std::array<float,2>{0.471661806f, 0.00380594679f},
-std::array<float,2>{0.891167581f, 0.685408533f},
-std::array<float,2>{0.673683167f, 0.383264005f},
-std::array<float,2>{0.043371737f, 0.791853487f},
-std::array<float,2>{0.0682115555f, 0.222616807f},
-std::array<float,2>{0.74243331f, 0.527527571f},
-std::array<float,2>{0.988521099f, 0.34073782f},
-std::array<float,2>{0.409297645f, 0.915733039f},
-std::array<float,2>{0.289410293f, 0.44138059f},
-std::array<float,2>{0.843806088f, 0.85199219f},
-std::array<float,2>{0.591116309f, 0.116761647f},
-std::array<float,2>{0.178739458f, 0.732907951f},
-std::array<float,2>{0.0284320954f, 0.409338593f},
-std::array<float,2>{0.646884501f, 0.77187252f},
-std::array<float,2>{0.927708745f, 0.0614578836f},
-std::array<float,2>{0.458613038f, 0.634833455f},
-std::array<float,2>{0.334892035f, 0.151777193f},
-std::array<float,2>{0.810568273f, 0.569885194f},
-std::array<float,2>{0.528211415f, 0.291842878f},
-std::array<float,2>{0.233653218f, 0.956212699f},
-std::array<float,2>{0.150073826f, 0.0769927502f},
-std::array<float,2>{0.595877528f, 0.697987258f},
-std::array<float,2>{0.833764553f, 0.491718262f},
-std::array<float,2>{0.276141346f, 0.82301116f},
-std::array<float,2>{0.400413811f, 0.351431072f},
-std::array<float,2>{0.950856447f, 0.879132628f},
-std::array<float,2>{0.711612344f, 0.198228613f},
-std::array<float,2>{0.0957114995f, 0.538424015f},
-std::array<float,2>{0.160959795f, 0.481124401f},
-std::array<float,2>{0.573296249f, 0.841336906f},
-std::array<float,2>{0.866565228f, 0.0870248154f},
-std::array<float,2>{0.297243685f, 0.7165429f},
-std::array<float,2>{0.43474707f, 0.203754202f},
-std::array<float,2>{0.969436586f, 0.555937648f},
-std::array<float,2>{0.728631735f, 0.365995586f},
-std::array<float,2>{0.0920858383f, 0.891078115f},
-std::array<float,2>{0.0475083999f, 0.0453631096f},
-std::array<float,2>{0.659970164f, 0.6516366f},
-std::array<float,2>{0.888822615f, 0.433498204f},
-std::array<float,2>{0.496617168f, 0.761665881f},
-std::array<float,2>{0.351709217f, 0.297138125f},
-std::array<float,2>{0.765719831f, 0.950808883f},
-std::array<float,2>{0.550391495f, 0.128781706f},
-std::array<float,2>{0.205767468f, 0.589804649f},
-std::array<float,2>{0.11883384f, 0.326332986f},
-std::array<float,2>{0.70168227f, 0.937404096f},
-std::array<float,2>{0.957812428f, 0.249361306f},
-std::array<float,2>{0.376834631f, 0.507135391f},
-std::array<float,2>{0.262793005f, 0.0947822109f},
-std::array<float,2>{0.821601927f, 0.747880459f},
-std::array<float,2>{0.610041201f, 0.459677547f},
-std::array<float,2>{0.139186114f, 0.865144372f},
-std::array<float,2>{0.240271881f, 0.161422879f},
-std::array<float,2>{0.508642197f, 0.603177428f},
-std::array<float,2>{0.795869172f, 0.255102158f},
-std::array<float,2>{0.316831321f, 0.994631052f},
-std::array<float,2>{0.448518455f, 0.398995936f},
-std::array<float,2>{0.909523726f, 0.807245612f},
-std::array<float,2>{0.630766869f, 0.0234737769f},
-std::array<float,2>{0.00330700236f, 0.667410493f},
-std::array<float,2>{0.152835205f, 0.25963971f},
-std::array<float,2>{0.600495517f, 0.987051249f},
-std::array<float,2>{0.831544757f, 0.165689379f},
-std::array<float,2>{0.279659837f, 0.597200692f},
-std::array<float,2>{0.4030357f, 0.0199869331f},
-std::array<float,2>{0.946102977f, 0.656291068f},
-std::array<float,2>{0.716704249f, 0.394049048f},
-std::array<float,2>{0.10028486f, 0.797803342f},
-std::array<float,2>{0.0272768121f, 0.238678247f},
-std::array<float,2>{0.641605258f, 0.51224637f},
-std::array<float,2>{0.923725724f, 0.315325171f},
-std::array<float,2>{0.455957413f, 0.924407363f},
-std::array<float,2>{0.330700994f, 0.468378067f},
-std::array<float,2>{0.805373609f, 0.870854378f},
-std::array<float,2>{0.524078727f, 0.10227f},
-std::array<float,2>{0.227543771f, 0.740034282f},
-std::array<float,2>{0.0626024604f, 0.426548004f},
-std::array<float,2>{0.748789072f, 0.756527841f},
-std::array<float,2>{0.986085594f, 0.0353430696f},
-std::array<float,2>{0.412998706f, 0.644497991f},
-std::array<float,2>{0.295854896f, 0.13746044f},
-std::array<float,2>{0.848671973f, 0.582013369f},
-std::array<float,2>{0.589257658f, 0.307318687f},
-std::array<float,2>{0.175336778f, 0.94147855f},
-std::array<float,2>{0.19542034f, 0.0794531703f},
-std::array<float,2>{0.544002831f, 0.705636501f},
-std::array<float,2>{0.756002724f, 0.474321038f},
-std::array<float,2>{0.364490032f, 0.830853581f},
-std::array<float,2>{0.473934591f, 0.371229261f},
-std::array<float,2>{0.896990716f, 0.899815738f},
-std::array<float,2>{0.676436901f, 0.21626763f},
-std::array<float,2>{0.0418550819f, 0.54929626f},
-std::array<float,2>{0.237609521f, 0.494484127f},
-std::array<float,2>{0.514164567f, 0.819839835f},
-std::array<float,2>{0.792814314f, 0.0664868504f},
-std::array<float,2>{0.315054387f, 0.693344116f},
-std::array<float,2>{0.44943276f, 0.194927424f},
-std::array<float,2>{0.911661685f, 0.545459032f},
-std::array<float,2>{0.626048982f, 0.352397323f},
-std::array<float,2>{0.00703092013f, 0.884982228f},
-std::array<float,2>{0.121291697f, 0.0517915748f},
-std::array<float,2>{0.698043287f, 0.628516436f},
-std::array<float,2>{0.956216216f, 0.417845905f},
-std::array<float,2>{0.382425606f, 0.778773069f},
-std::array<float,2>{0.25963819f, 0.284285992f},
-std::array<float,2>{0.826774597f, 0.965843081f},
-std::array<float,2>{0.613341391f, 0.140843421f},
-std::array<float,2>{0.133657113f, 0.57680124f},
-std::array<float,2>{0.0520373248f, 0.334527016f},
-std::array<float,2>{0.663013279f, 0.906872213f},
-std::array<float,2>{0.886381984f, 0.233351961f},
-std::array<float,2>{0.495809346f, 0.522058249f},
-std::array<float,2>{0.356823146f, 0.124534823f},
-std::array<float,2>{0.770410955f, 0.724860072f},
-std::array<float,2>{0.553566873f, 0.447639912f},
-std::array<float,2>{0.208167568f, 0.843791187f},
-std::array<float,2>{0.157208458f, 0.181250304f},
-std::array<float,2>{0.574704826f, 0.624611795f},
-std::array<float,2>{0.862604439f, 0.271197081f},
-std::array<float,2>{0.3037287f, 0.980426669f},
-std::array<float,2>{0.432560265f, 0.375640363f},
-std::array<float,2>{0.97399652f, 0.781840265f},
-std::array<float,2>{0.732770205f, 0.0151028028f},
-std::array<float,2>{0.089712292f, 0.676049948f},
-std::array<float,2>{0.21838133f, 0.347163081f},
-std::array<float,2>{0.555383086f, 0.877933741f},
-std::array<float,2>{0.779608548f, 0.200817898f},
-std::array<float,2>{0.346931338f, 0.535045862f},
-std::array<float,2>{0.486501366f, 0.0740901455f},
-std::array<float,2>{0.875028372f, 0.699573219f},
-std::array<float,2>{0.664405286f, 0.486867338f},
-std::array<float,2>{0.0566823147f, 0.826346934f},
-std::array<float,2>{0.0827056468f, 0.15491426f},
-std::array<float,2>{0.725251675f, 0.565289736f},
-std::array<float,2>{0.978096128f, 0.294006169f},
-std::array<float,2>{0.426478297f, 0.957929194f},
-std::array<float,2>{0.311593562f, 0.411948055f},
-std::array<float,2>{0.868902862f, 0.765717089f},
-std::array<float,2>{0.564742923f, 0.0558681339f},
-std::array<float,2>{0.164684683f, 0.637975693f},
-std::array<float,2>{0.0144562442f, 0.442755669f},
-std::array<float,2>{0.633079767f, 0.855523288f},
-std::array<float,2>{0.91798526f, 0.112832218f},
-std::array<float,2>{0.438925356f, 0.727784872f},
-std::array<float,2>{0.324653536f, 0.225091368f},
-std::array<float,2>{0.787510335f, 0.524170339f},
-std::array<float,2>{0.503393292f, 0.338892192f},
-std::array<float,2>{0.248606086f, 0.92012006f},
-std::array<float,2>{0.130181491f, 0.00719276117f},
-std::array<float,2>{0.619796097f, 0.68264538f},
-std::array<float,2>{0.819143355f, 0.390058726f},
-std::array<float,2>{0.251463681f, 0.793846965f},
-std::array<float,2>{0.384930104f, 0.274349153f},
-std::array<float,2>{0.96623534f, 0.970740736f},
-std::array<float,2>{0.695106626f, 0.175711736f},
-std::array<float,2>{0.114958093f, 0.609964252f},
-std::array<float,2>{0.186269358f, 0.403892219f},
-std::array<float,2>{0.584015965f, 0.809311748f},
-std::array<float,2>{0.853364587f, 0.0285617318f},
-std::array<float,2>{0.286988109f, 0.668324709f},
-std::array<float,2>{0.415235758f, 0.157527491f},
-std::array<float,2>{0.999097466f, 0.607448936f},
-std::array<float,2>{0.737914443f, 0.250666708f},
-std::array<float,2>{0.0756672546f, 0.998883843f},
-std::array<float,2>{0.0370011069f, 0.101183861f},
-std::array<float,2>{0.683266044f, 0.742736697f},
-std::array<float,2>{0.899704814f, 0.4559443f},
-std::array<float,2>{0.478279024f, 0.860357225f},
-std::array<float,2>{0.372119397f, 0.320750475f},
-std::array<float,2>{0.760179877f, 0.93317008f},
-std::array<float,2>{0.53648442f, 0.245083332f},
-std::array<float,2>{0.193375707f, 0.502147615f},
-std::array<float,2>{0.102697976f, 0.302655905f},
-std::array<float,2>{0.706713319f, 0.946628869f},
-std::array<float,2>{0.937825382f, 0.131399319f},
-std::array<float,2>{0.39195931f, 0.591781497f},
-std::array<float,2>{0.268495858f, 0.0391034819f},
-std::array<float,2>{0.839384377f, 0.653407991f},
-std::array<float,2>{0.60232991f, 0.435616821f},
-std::array<float,2>{0.141220942f, 0.765585303f},
-std::array<float,2>{0.224379897f, 0.207049489f},
-std::array<float,2>{0.520725012f, 0.562206984f},
-std::array<float,2>{0.797899961f, 0.361518383f},
-std::array<float,2>{0.339078277f, 0.894576132f},
-std::array<float,2>{0.466839701f, 0.479723811f},
-std::array<float,2>{0.930444479f, 0.836432397f},
-std::array<float,2>{0.653421462f, 0.091883935f},
-std::array<float,2>{0.0178790595f, 0.713062823f},
-std::array<float,2>{0.171291724f, 0.319276184f},
-std::array<float,2>{0.570272028f, 0.926610827f},
-std::array<float,2>{0.874327421f, 0.235759348f},
-std::array<float,2>{0.307991087f, 0.510176301f},
-std::array<float,2>{0.425722241f, 0.109192319f},
-std::array<float,2>{0.981631696f, 0.737309098f},
-std::array<float,2>{0.722038388f, 0.463887185f},
-std::array<float,2>{0.0819745734f, 0.872371078f},
-std::array<float,2>{0.0615032539f, 0.168701068f},
-std::array<float,2>{0.670737147f, 0.598504841f},
-std::array<float,2>{0.878926516f, 0.263958454f},
-std::array<float,2>{0.491730094f, 0.990002811f},
-std::array<float,2>{0.351212054f, 0.397031724f},
-std::array<float,2>{0.777264714f, 0.800864995f},
-std::array<float,2>{0.562010407f, 0.0173566323f},
-std::array<float,2>{0.213821411f, 0.663699448f},
-std::array<float,2>{0.109444737f, 0.47116375f},
-std::array<float,2>{0.687924206f, 0.833518505f},
-std::array<float,2>{0.961191952f, 0.0826181695f},
-std::array<float,2>{0.387323827f, 0.708935201f},
-std::array<float,2>{0.256479472f, 0.213001385f},
-std::array<float,2>{0.815208197f, 0.553297758f},
-std::array<float,2>{0.62203604f, 0.369913548f},
-std::array<float,2>{0.127463028f, 0.905011654f},
-std::array<float,2>{0.243126586f, 0.0321814977f},
-std::array<float,2>{0.505771399f, 0.646552742f},
-std::array<float,2>{0.783799469f, 0.425289929f},
-std::array<float,2>{0.322827429f, 0.75108242f},
-std::array<float,2>{0.442624897f, 0.3094033f},
-std::array<float,2>{0.914735258f, 0.937845051f},
-std::array<float,2>{0.639267206f, 0.136586919f},
-std::array<float,2>{0.00854701269f, 0.582178116f},
-std::array<float,2>{0.19001767f, 0.419599891f},
-std::array<float,2>{0.533588171f, 0.776209533f},
-std::array<float,2>{0.763751328f, 0.0484769866f},
-std::array<float,2>{0.368825972f, 0.632210612f},
-std::array<float,2>{0.483898997f, 0.146664485f},
-std::array<float,2>{0.906197309f, 0.571728349f},
-std::array<float,2>{0.685030282f, 0.285549223f},
-std::array<float,2>{0.0336211026f, 0.961796105f},
-std::array<float,2>{0.0710415989f, 0.0657169223f},
-std::array<float,2>{0.740160942f, 0.687621593f},
-std::array<float,2>{0.994096398f, 0.499629825f},
-std::array<float,2>{0.420312732f, 0.814770997f},
-std::array<float,2>{0.284326106f, 0.357058823f},
-std::array<float,2>{0.856196105f, 0.890231609f},
-std::array<float,2>{0.581919253f, 0.191229388f},
-std::array<float,2>{0.180667713f, 0.542007148f},
-std::array<float,2>{0.020557547f, 0.266851604f},
-std::array<float,2>{0.649108171f, 0.982383907f},
-std::array<float,2>{0.936486959f, 0.185871035f},
-std::array<float,2>{0.464325249f, 0.620057046f},
-std::array<float,2>{0.341876626f, 0.00920079462f},
-std::array<float,2>{0.801886439f, 0.675515354f},
-std::array<float,2>{0.517516196f, 0.380522639f},
-std::array<float,2>{0.219948843f, 0.786164403f},
-std::array<float,2>{0.144733161f, 0.22859244f},
-std::array<float,2>{0.606799126f, 0.519254863f},
-std::array<float,2>{0.840605438f, 0.328545004f},
-std::array<float,2>{0.270763695f, 0.912237465f},
-std::array<float,2>{0.397744536f, 0.451192975f},
-std::array<float,2>{0.944410205f, 0.848516524f},
-std::array<float,2>{0.707632005f, 0.120440163f},
-std::array<float,2>{0.107824609f, 0.721208096f},
-std::array<float,2>{0.232040092f, 0.29087323f},
-std::array<float,2>{0.530706465f, 0.954823196f},
-std::array<float,2>{0.810016513f, 0.149280742f},
-std::array<float,2>{0.333139271f, 0.566690326f},
-std::array<float,2>{0.45988822f, 0.0589591712f},
-std::array<float,2>{0.929103732f, 0.633041382f},
-std::array<float,2>{0.644824147f, 0.406509817f},
-std::array<float,2>{0.0312187765f, 0.770562887f},
-std::array<float,2>{0.0937540382f, 0.196859419f},
-std::array<float,2>{0.713594496f, 0.536295056f},
-std::array<float,2>{0.951730251f, 0.347753078f},
-std::array<float,2>{0.398802429f, 0.88211292f},
-std::array<float,2>{0.273569584f, 0.488417417f},
-std::array<float,2>{0.835896432f, 0.82087177f},
-std::array<float,2>{0.594204485f, 0.075834997f},
-std::array<float,2>{0.152067512f, 0.696000636f},
-std::array<float,2>{0.0460347049f, 0.385612577f},
-std::array<float,2>{0.674954712f, 0.789080381f},
-std::array<float,2>{0.893720031f, 0.000428333209f},
-std::array<float,2>{0.469882756f, 0.685899615f},
-std::array<float,2>{0.363132596f, 0.176681623f},
-std::array<float,2>{0.751133442f, 0.615836978f},
-std::array<float,2>{0.541962206f, 0.278371841f},
-std::array<float,2>{0.200612783f, 0.976355135f},
-std::array<float,2>{0.176108629f, 0.113991022f},
-std::array<float,2>{0.593612134f, 0.730848014f},
-std::array<float,2>{0.84601903f, 0.439135969f},
-std::array<float,2>{0.292495787f, 0.854554713f},
-std::array<float,2>{0.407904476f, 0.343088418f},
-std::array<float,2>{0.99152565f, 0.916163146f},
-std::array<float,2>{0.744850099f, 0.219918594f},
-std::array<float,2>{0.0698389485f, 0.530851781f},
-std::array<float,2>{0.138566062f, 0.457122415f},
-std::array<float,2>{0.613120198f, 0.865290701f},
-std::array<float,2>{0.822291315f, 0.0958681405f},
-std::array<float,2>{0.264877141f, 0.749367654f},
-std::array<float,2>{0.378283918f, 0.246625409f},
-std::array<float,2>{0.959301829f, 0.505375803f},
-std::array<float,2>{0.700633228f, 0.325091124f},
-std::array<float,2>{0.120465226f, 0.933683395f},
-std::array<float,2>{0.00154729246f, 0.0271861609f},
-std::array<float,2>{0.632441282f, 0.665914834f},
-std::array<float,2>{0.907173097f, 0.401906908f},
-std::array<float,2>{0.44647181f, 0.805059731f},
-std::array<float,2>{0.319252044f, 0.257200599f},
-std::array<float,2>{0.794470012f, 0.992462695f},
-std::array<float,2>{0.510803461f, 0.163382053f},
-std::array<float,2>{0.240097091f, 0.605013311f},
-std::array<float,2>{0.0914901942f, 0.364971489f},
-std::array<float,2>{0.727048874f, 0.89385289f},
-std::array<float,2>{0.971287429f, 0.206301868f},
-std::array<float,2>{0.436233759f, 0.557975709f},
-std::array<float,2>{0.299075514f, 0.0894259214f},
-std::array<float,2>{0.864231825f, 0.717836022f},
-std::array<float,2>{0.57058835f, 0.48258993f},
-std::array<float,2>{0.163553849f, 0.84279418f},
-std::array<float,2>{0.203562438f, 0.126648203f},
-std::array<float,2>{0.548422456f, 0.587086618f},
-std::array<float,2>{0.767692566f, 0.300153136f},
-std::array<float,2>{0.353737146f, 0.952613056f},
-std::array<float,2>{0.498669237f, 0.430615574f},
-std::array<float,2>{0.887780786f, 0.758360207f},
-std::array<float,2>{0.657278478f, 0.0435263552f},
-std::array<float,2>{0.0506180525f, 0.648922503f},
-std::array<float,2>{0.158932894f, 0.27003032f},
-std::array<float,2>{0.577230632f, 0.979419291f},
-std::array<float,2>{0.860275745f, 0.179747403f},
-std::array<float,2>{0.302106142f, 0.623290837f},
-std::array<float,2>{0.430388331f, 0.014472398f},
-std::array<float,2>{0.975013494f, 0.677619517f},
-std::array<float,2>{0.730887294f, 0.376133591f},
-std::array<float,2>{0.0864290744f, 0.782473683f},
-std::array<float,2>{0.0534273535f, 0.23422648f},
-std::array<float,2>{0.661688745f, 0.52287662f},
-std::array<float,2>{0.884302497f, 0.335431814f},
-std::array<float,2>{0.493499815f, 0.907786787f},
-std::array<float,2>{0.357582539f, 0.449036509f},
-std::array<float,2>{0.772979498f, 0.844954669f},
-std::array<float,2>{0.552290797f, 0.123169921f},
-std::array<float,2>{0.21014221f, 0.726188481f},
-std::array<float,2>{0.124585286f, 0.416714668f},
-std::array<float,2>{0.695473909f, 0.777931273f},
-std::array<float,2>{0.953641236f, 0.051237382f},
-std::array<float,2>{0.380399615f, 0.627645135f},
-std::array<float,2>{0.260063648f, 0.141787618f},
-std::array<float,2>{0.824421585f, 0.577987075f},
-std::array<float,2>{0.616273224f, 0.283676744f},
-std::array<float,2>{0.136287108f, 0.965107322f},
-std::array<float,2>{0.235487193f, 0.0681864545f},
-std::array<float,2>{0.512799442f, 0.691780686f},
-std::array<float,2>{0.789450347f, 0.495404541f},
-std::array<float,2>{0.313232213f, 0.818436444f},
-std::array<float,2>{0.452760011f, 0.35324347f},
-std::array<float,2>{0.912939966f, 0.88655287f},
-std::array<float,2>{0.628466666f, 0.19357416f},
-std::array<float,2>{0.00453379704f, 0.546087205f},
-std::array<float,2>{0.197923109f, 0.473019451f},
-std::array<float,2>{0.546655416f, 0.831400275f},
-std::array<float,2>{0.7554304f, 0.0787876397f},
-std::array<float,2>{0.365356684f, 0.706811845f},
-std::array<float,2>{0.476196557f, 0.215195015f},
-std::array<float,2>{0.895847142f, 0.549950421f},
-std::array<float,2>{0.679340243f, 0.372402638f},
-std::array<float,2>{0.0408739746f, 0.898872912f},
-std::array<float,2>{0.0657902136f, 0.0362448879f},
-std::array<float,2>{0.74765712f, 0.64260596f},
-std::array<float,2>{0.987790763f, 0.427646875f},
-std::array<float,2>{0.410304606f, 0.757789016f},
-std::array<float,2>{0.293371081f, 0.308324069f},
-std::array<float,2>{0.849644363f, 0.942895114f},
-std::array<float,2>{0.58681947f, 0.137702242f},
-std::array<float,2>{0.172552913f, 0.5804708f},
-std::array<float,2>{0.0240625571f, 0.316122949f},
-std::array<float,2>{0.644086778f, 0.925752819f},
-std::array<float,2>{0.925209343f, 0.239369541f},
-std::array<float,2>{0.453786999f, 0.513433695f},
-std::array<float,2>{0.328163028f, 0.103140831f},
-std::array<float,2>{0.808433771f, 0.738378465f},
-std::array<float,2>{0.526868284f, 0.467505753f},
-std::array<float,2>{0.229235798f, 0.869204044f},
-std::array<float,2>{0.154383585f, 0.164362788f},
-std::array<float,2>{0.598008811f, 0.595999539f},
-std::array<float,2>{0.829145014f, 0.258064747f},
-std::array<float,2>{0.277876288f, 0.988258481f},
-std::array<float,2>{0.406208098f, 0.392972052f},
-std::array<float,2>{0.947344184f, 0.79846853f},
-std::array<float,2>{0.718293667f, 0.0205295514f},
-std::array<float,2>{0.0977979451f, 0.658093929f},
-std::array<float,2>{0.225488424f, 0.362635106f},
-std::array<float,2>{0.521826863f, 0.896257102f},
-std::array<float,2>{0.799585342f, 0.208289713f},
-std::array<float,2>{0.336495399f, 0.560652077f},
-std::array<float,2>{0.466736555f, 0.0932405144f},
-std::array<float,2>{0.932124078f, 0.714539945f},
-std::array<float,2>{0.655370116f, 0.478875995f},
-std::array<float,2>{0.0164150707f, 0.837007999f},
-std::array<float,2>{0.1041402f, 0.131911069f},
-std::array<float,2>{0.703537881f, 0.590658247f},
-std::array<float,2>{0.940766096f, 0.301129043f},
-std::array<float,2>{0.393747479f, 0.945908427f},
-std::array<float,2>{0.266562313f, 0.436822563f},
-std::array<float,2>{0.837394714f, 0.764378846f},
-std::array<float,2>{0.605080247f, 0.0400955714f},
-std::array<float,2>{0.144288272f, 0.653236508f},
-std::array<float,2>{0.0383859538f, 0.456150502f},
-std::array<float,2>{0.680999637f, 0.860317051f},
-std::array<float,2>{0.902196467f, 0.100123592f},
-std::array<float,2>{0.478833973f, 0.744041741f},
-std::array<float,2>{0.37455824f, 0.246061549f},
-std::array<float,2>{0.758900583f, 0.503688157f},
-std::array<float,2>{0.538671732f, 0.321304649f},
-std::array<float,2>{0.191463664f, 0.932588696f},
-std::array<float,2>{0.185444087f, 0.027446121f},
-std::array<float,2>{0.583171904f, 0.669100761f},
-std::array<float,2>{0.853715718f, 0.402933091f},
-std::array<float,2>{0.288085192f, 0.809984863f},
-std::array<float,2>{0.417296082f, 0.251491427f},
-std::array<float,2>{0.996515155f, 0.999791205f},
-std::array<float,2>{0.736126125f, 0.156551495f},
-std::array<float,2>{0.0763767511f, 0.608607411f},
-std::array<float,2>{0.132809177f, 0.389284641f},
-std::array<float,2>{0.618816614f, 0.794849098f},
-std::array<float,2>{0.817376494f, 0.00681632757f},
-std::array<float,2>{0.253459573f, 0.68250519f},
-std::array<float,2>{0.383792132f, 0.174615622f},
-std::array<float,2>{0.967548728f, 0.610842228f},
-std::array<float,2>{0.692601979f, 0.274876148f},
-std::array<float,2>{0.115530923f, 0.972036004f},
-std::array<float,2>{0.0121966638f, 0.111542188f},
-std::array<float,2>{0.63550514f, 0.727146685f},
-std::array<float,2>{0.921095908f, 0.442142248f},
-std::array<float,2>{0.440619677f, 0.856979191f},
-std::array<float,2>{0.327371508f, 0.338162214f},
-std::array<float,2>{0.786502421f, 0.921431899f},
-std::array<float,2>{0.500480294f, 0.225815356f},
-std::array<float,2>{0.246746913f, 0.525289416f},
-std::array<float,2>{0.0857141465f, 0.29342562f},
-std::array<float,2>{0.723895252f, 0.958875f},
-std::array<float,2>{0.979739308f, 0.155700833f},
-std::array<float,2>{0.429457873f, 0.565793514f},
-std::array<float,2>{0.309380174f, 0.0548794866f},
-std::array<float,2>{0.871079624f, 0.637421608f},
-std::array<float,2>{0.562869549f, 0.410760343f},
-std::array<float,2>{0.166052356f, 0.767325103f},
-std::array<float,2>{0.214846641f, 0.199632034f},
-std::array<float,2>{0.558087945f, 0.533235848f},
-std::array<float,2>{0.778665781f, 0.345812768f},
-std::array<float,2>{0.345030338f, 0.877469659f},
-std::array<float,2>{0.485563129f, 0.487539649f},
-std::array<float,2>{0.877100885f, 0.827197433f},
-std::array<float,2>{0.666232526f, 0.0723228157f},
-std::array<float,2>{0.0564869456f, 0.700315833f},
-std::array<float,2>{0.148041323f, 0.329230756f},
-std::array<float,2>{0.608060896f, 0.913727939f},
-std::array<float,2>{0.842931747f, 0.230119139f},
-std::array<float,2>{0.272512376f, 0.517764032f},
-std::array<float,2>{0.395869255f, 0.119159684f},
-std::array<float,2>{0.941764176f, 0.72174716f},
-std::array<float,2>{0.709962726f, 0.452585191f},
-std::array<float,2>{0.106629319f, 0.849475145f},
-std::array<float,2>{0.0231563114f, 0.186764196f},
-std::array<float,2>{0.651742876f, 0.620322764f},
-std::array<float,2>{0.933630884f, 0.266361088f},
-std::array<float,2>{0.462580949f, 0.981027186f},
-std::array<float,2>{0.340089649f, 0.379060566f},
-std::array<float,2>{0.80340898f, 0.785689831f},
-std::array<float,2>{0.518443882f, 0.00820223894f},
-std::array<float,2>{0.222227111f, 0.673873544f},
-std::array<float,2>{0.0723992437f, 0.498196274f},
-std::array<float,2>{0.741424024f, 0.816269219f},
-std::array<float,2>{0.994903624f, 0.064501144f},
-std::array<float,2>{0.418198258f, 0.689233601f},
-std::array<float,2>{0.281850278f, 0.190179318f},
-std::array<float,2>{0.857909977f, 0.541441739f},
-std::array<float,2>{0.578561246f, 0.355505347f},
-std::array<float,2>{0.18214722f, 0.888718724f},
-std::array<float,2>{0.187666029f, 0.047382243f},
-std::array<float,2>{0.532635331f, 0.631075859f},
-std::array<float,2>{0.763172269f, 0.418537855f},
-std::array<float,2>{0.369309962f, 0.777222693f},
-std::array<float,2>{0.481332153f, 0.286348671f},
-std::array<float,2>{0.904234707f, 0.962694347f},
-std::array<float,2>{0.686520338f, 0.147506341f},
-std::array<float,2>{0.0320542045f, 0.570650518f},
-std::array<float,2>{0.244924784f, 0.423963368f},
-std::array<float,2>{0.506267488f, 0.750487506f},
-std::array<float,2>{0.782791376f, 0.0326991901f},
-std::array<float,2>{0.32124567f, 0.647543848f},
-std::array<float,2>{0.443612695f, 0.135456681f},
-std::array<float,2>{0.917928398f, 0.583445966f},
-std::array<float,2>{0.63735795f, 0.310429156f},
-std::array<float,2>{0.0116005912f, 0.938580692f},
-std::array<float,2>{0.112751625f, 0.0836208761f},
-std::array<float,2>{0.690137565f, 0.707363665f},
-std::array<float,2>{0.963706851f, 0.47174108f},
-std::array<float,2>{0.38941282f, 0.832755029f},
-std::array<float,2>{0.255735844f, 0.370468974f},
-std::array<float,2>{0.812671065f, 0.905847728f},
-std::array<float,2>{0.623959541f, 0.214666381f},
-std::array<float,2>{0.126576647f, 0.554393113f},
-std::array<float,2>{0.060047511f, 0.265438259f},
-std::array<float,2>{0.668634653f, 0.988878131f},
-std::array<float,2>{0.88193965f, 0.169706643f},
-std::array<float,2>{0.489224643f, 0.599049628f},
-std::array<float,2>{0.348581105f, 0.0164533872f},
-std::array<float,2>{0.77386862f, 0.663078547f},
-std::array<float,2>{0.559344411f, 0.398402363f},
-std::array<float,2>{0.211223334f, 0.801786065f},
-std::array<float,2>{0.168466523f, 0.234406173f},
-std::array<float,2>{0.567787409f, 0.51100719f},
-std::array<float,2>{0.871927202f, 0.31998086f},
-std::array<float,2>{0.305635691f, 0.927493691f},
-std::array<float,2>{0.423563778f, 0.463302642f},
-std::array<float,2>{0.983478606f, 0.871591985f},
-std::array<float,2>{0.720572948f, 0.107637525f},
-std::array<float,2>{0.0791362599f, 0.73663342f},
-std::array<float,2>{0.206583321f, 0.29939279f},
-std::array<float,2>{0.549354434f, 0.951455057f},
-std::array<float,2>{0.767567396f, 0.125602856f},
-std::array<float,2>{0.352818191f, 0.586496651f},
-std::array<float,2>{0.497697026f, 0.0440519303f},
-std::array<float,2>{0.890149593f, 0.649640441f},
-std::array<float,2>{0.65850389f, 0.430855244f},
-std::array<float,2>{0.0479355715f, 0.759183943f},
-std::array<float,2>{0.093721725f, 0.205554083f},
-std::array<float,2>{0.73032546f, 0.5567922f},
-std::array<float,2>{0.97038883f, 0.363710552f},
-std::array<float,2>{0.433992922f, 0.893098414f},
-std::array<float,2>{0.298737198f, 0.48417443f},
-std::array<float,2>{0.865632594f, 0.841854632f},
-std::array<float,2>{0.573006272f, 0.0887886807f},
-std::array<float,2>{0.161569789f, 0.71765995f},
-std::array<float,2>{0.00240829354f, 0.401184916f},
-std::array<float,2>{0.62951839f, 0.806635678f},
-std::array<float,2>{0.908579707f, 0.0255967285f},
-std::array<float,2>{0.448071003f, 0.664963007f},
-std::array<float,2>{0.317425698f, 0.162556738f},
-std::array<float,2>{0.796390772f, 0.603810906f},
-std::array<float,2>{0.509406924f, 0.256320029f},
-std::array<float,2>{0.241505176f, 0.993616819f},
-std::array<float,2>{0.139653191f, 0.0972491652f},
-std::array<float,2>{0.610424101f, 0.748756945f},
-std::array<float,2>{0.821010768f, 0.458580911f},
-std::array<float,2>{0.262244016f, 0.866625845f},
-std::array<float,2>{0.375194252f, 0.325874507f},
-std::array<float,2>{0.958587587f, 0.935091496f},
-std::array<float,2>{0.702696681f, 0.247551113f},
-std::array<float,2>{0.11787191f, 0.504502296f},
-std::array<float,2>{0.177894682f, 0.438280076f},
-std::array<float,2>{0.590260744f, 0.85420692f},
-std::array<float,2>{0.845555484f, 0.114665687f},
-std::array<float,2>{0.29077819f, 0.732192159f},
-std::array<float,2>{0.408242553f, 0.219129071f},
-std::array<float,2>{0.989847064f, 0.52954185f},
-std::array<float,2>{0.744046152f, 0.341901809f},
-std::array<float,2>{0.0672072992f, 0.917574525f},
-std::array<float,2>{0.0444693118f, 0.00159094168f},
-std::array<float,2>{0.672039211f, 0.686854482f},
-std::array<float,2>{0.891628385f, 0.386699706f},
-std::array<float,2>{0.472237617f, 0.790394783f},
-std::array<float,2>{0.361092895f, 0.278015524f},
-std::array<float,2>{0.752829432f, 0.975232422f},
-std::array<float,2>{0.540346801f, 0.17718114f},
-std::array<float,2>{0.201871604f, 0.617182016f},
-std::array<float,2>{0.0968179926f, 0.349563092f},
-std::array<float,2>{0.712744713f, 0.881586611f},
-std::array<float,2>{0.949634969f, 0.195313707f},
-std::array<float,2>{0.401696831f, 0.535443306f},
-std::array<float,2>{0.276547015f, 0.0746462792f},
-std::array<float,2>{0.832320452f, 0.696985364f},
-std::array<float,2>{0.596711695f, 0.489950031f},
-std::array<float,2>{0.148720413f, 0.822105348f},
-std::array<float,2>{0.232767001f, 0.150372341f},
-std::array<float,2>{0.52926594f, 0.567517638f},
-std::array<float,2>{0.811543167f, 0.289571792f},
-std::array<float,2>{0.335787058f, 0.953543663f},
-std::array<float,2>{0.457276821f, 0.407410979f},
-std::array<float,2>{0.926218808f, 0.769602954f},
-std::array<float,2>{0.648159623f, 0.0596384369f},
-std::array<float,2>{0.0275717843f, 0.634575486f},
-std::array<float,2>{0.134105995f, 0.283122957f},
-std::array<float,2>{0.614807069f, 0.968321383f},
-std::array<float,2>{0.827587247f, 0.144239575f},
-std::array<float,2>{0.258727521f, 0.576072097f},
-std::array<float,2>{0.381401092f, 0.0532824323f},
-std::array<float,2>{0.955838799f, 0.625714958f},
-std::array<float,2>{0.699037015f, 0.415689498f},
-std::array<float,2>{0.122452565f, 0.781169355f},
-std::array<float,2>{0.00634944858f, 0.191553503f},
-std::array<float,2>{0.625702858f, 0.543412507f},
-std::array<float,2>{0.910826445f, 0.35391444f},
-std::array<float,2>{0.450410575f, 0.883255005f},
-std::array<float,2>{0.315973729f, 0.493305087f},
-std::array<float,2>{0.791335344f, 0.816606104f},
-std::array<float,2>{0.514964879f, 0.0701380968f},
-std::array<float,2>{0.237039983f, 0.694617033f},
-std::array<float,2>{0.0882447511f, 0.378092229f},
-std::array<float,2>{0.734101236f, 0.784219205f},
-std::array<float,2>{0.972959399f, 0.0136009119f},
-std::array<float,2>{0.432718635f, 0.678193927f},
-std::array<float,2>{0.303435862f, 0.182491213f},
-std::array<float,2>{0.861426055f, 0.621762216f},
-std::array<float,2>{0.575820863f, 0.272468418f},
-std::array<float,2>{0.157476425f, 0.978232026f},
-std::array<float,2>{0.207448646f, 0.122664154f},
-std::array<float,2>{0.55393213f, 0.723677397f},
-std::array<float,2>{0.770746708f, 0.445386857f},
-std::array<float,2>{0.355711341f, 0.845778704f},
-std::array<float,2>{0.49459514f, 0.332109243f},
-std::array<float,2>{0.885139465f, 0.90956378f},
-std::array<float,2>{0.663936675f, 0.230837315f},
-std::array<float,2>{0.0512257479f, 0.520559728f},
-std::array<float,2>{0.226592302f, 0.466686279f},
-std::array<float,2>{0.524774909f, 0.867561281f},
-std::array<float,2>{0.806635499f, 0.104149707f},
-std::array<float,2>{0.33176145f, 0.741825283f},
-std::array<float,2>{0.456828088f, 0.241071895f},
-std::array<float,2>{0.922191381f, 0.515569985f},
-std::array<float,2>{0.6406793f, 0.313855022f},
-std::array<float,2>{0.0263075437f, 0.922686517f},
-std::array<float,2>{0.100663178f, 0.0214978065f},
-std::array<float,2>{0.715180218f, 0.659155488f},
-std::array<float,2>{0.947214067f, 0.390938669f},
-std::array<float,2>{0.404246688f, 0.799471438f},
-std::array<float,2>{0.280724227f, 0.260149419f},
-std::array<float,2>{0.830708385f, 0.985698938f},
-std::array<float,2>{0.60098666f, 0.166054353f},
-std::array<float,2>{0.154165015f, 0.59555763f},
-std::array<float,2>{0.0421001501f, 0.373099476f},
-std::array<float,2>{0.677488804f, 0.901787937f},
-std::array<float,2>{0.898061275f, 0.21830824f},
-std::array<float,2>{0.473439962f, 0.548503757f},
-std::array<float,2>{0.363457441f, 0.0810741112f},
-std::array<float,2>{0.757254303f, 0.703793168f},
-std::array<float,2>{0.543345273f, 0.474830449f},
-std::array<float,2>{0.196657777f, 0.829298317f},
-std::array<float,2>{0.174199194f, 0.140442669f},
-std::array<float,2>{0.588310182f, 0.578557611f},
-std::array<float,2>{0.847851455f, 0.305551469f},
-std::array<float,2>{0.296580374f, 0.945063055f},
-std::array<float,2>{0.413309753f, 0.429397881f},
-std::array<float,2>{0.984682679f, 0.755154788f},
-std::array<float,2>{0.749548435f, 0.0389968194f},
-std::array<float,2>{0.0639189109f, 0.641338408f},
-std::array<float,2>{0.195159748f, 0.322933078f},
-std::array<float,2>{0.53602457f, 0.929787636f},
-std::array<float,2>{0.761674583f, 0.24306722f},
-std::array<float,2>{0.371119916f, 0.501715064f},
-std::array<float,2>{0.477342576f, 0.0989134312f},
-std::array<float,2>{0.89880383f, 0.744516551f},
-std::array<float,2>{0.68196851f, 0.453438222f},
-std::array<float,2>{0.0357121937f, 0.86281985f},
-std::array<float,2>{0.0745119974f, 0.158706769f},
-std::array<float,2>{0.736427724f, 0.607271075f},
-std::array<float,2>{0.998261511f, 0.252537906f},
-std::array<float,2>{0.414166421f, 0.996203125f},
-std::array<float,2>{0.285609126f, 0.404533863f},
-std::array<float,2>{0.852065206f, 0.811667502f},
-std::array<float,2>{0.585911095f, 0.029829843f},
-std::array<float,2>{0.186666936f, 0.671124637f},
-std::array<float,2>{0.0188773815f, 0.476812601f},
-std::array<float,2>{0.652677953f, 0.837898493f},
-std::array<float,2>{0.930884123f, 0.0908241868f},
-std::array<float,2>{0.468479037f, 0.71135354f},
-std::array<float,2>{0.338762373f, 0.210144028f},
-std::array<float,2>{0.797587633f, 0.559208035f},
-std::array<float,2>{0.520495057f, 0.360376596f},
-std::array<float,2>{0.223478556f, 0.897871375f},
-std::array<float,2>{0.141948178f, 0.042434901f},
-std::array<float,2>{0.603380263f, 0.655650735f},
-std::array<float,2>{0.838219583f, 0.435510099f},
-std::array<float,2>{0.26897499f, 0.763556361f},
-std::array<float,2>{0.390858084f, 0.304463565f},
-std::array<float,2>{0.939353168f, 0.948034644f},
-std::array<float,2>{0.705634594f, 0.129404262f},
-std::array<float,2>{0.102317736f, 0.592227757f},
-std::array<float,2>{0.165807992f, 0.412729234f},
-std::array<float,2>{0.566089094f, 0.769512534f},
-std::array<float,2>{0.868093073f, 0.0580127276f},
-std::array<float,2>{0.311030209f, 0.639638305f},
-std::array<float,2>{0.426925749f, 0.152916282f},
-std::array<float,2>{0.977264166f, 0.563101292f},
-std::array<float,2>{0.726118386f, 0.29686448f},
-std::array<float,2>{0.0832541734f, 0.960740507f},
-std::array<float,2>{0.0581407584f, 0.0711188838f},
-std::array<float,2>{0.665638626f, 0.703107834f},
-std::array<float,2>{0.876903594f, 0.484631181f},
-std::array<float,2>{0.487359494f, 0.824855924f},
-std::array<float,2>{0.346349001f, 0.344607949f},
-std::array<float,2>{0.780445874f, 0.875610054f},
-std::array<float,2>{0.556571603f, 0.201559588f},
-std::array<float,2>{0.217330903f, 0.533005834f},
-std::array<float,2>{0.113864653f, 0.27696377f},
-std::array<float,2>{0.693648398f, 0.970154762f},
-std::array<float,2>{0.964865565f, 0.173657894f},
-std::array<float,2>{0.385859877f, 0.612363875f},
-std::array<float,2>{0.250173956f, 0.00456819683f},
-std::array<float,2>{0.820198774f, 0.680775225f},
-std::array<float,2>{0.620876729f, 0.387914985f},
-std::array<float,2>{0.129338399f, 0.79570955f},
-std::array<float,2>{0.249154106f, 0.222694904f},
-std::array<float,2>{0.502504587f, 0.525398016f},
-std::array<float,2>{0.788851261f, 0.336364895f},
-std::array<float,2>{0.326071858f, 0.918774366f},
-std::array<float,2>{0.437734455f, 0.4447878f},
-std::array<float,2>{0.919430196f, 0.857489288f},
-std::array<float,2>{0.634460211f, 0.110450275f},
-std::array<float,2>{0.014652079f, 0.728965104f},
-std::array<float,2>{0.179833636f, 0.359318763f},
-std::array<float,2>{0.580240548f, 0.888246f},
-std::array<float,2>{0.857414842f, 0.189425051f},
-std::array<float,2>{0.283286333f, 0.539411068f},
-std::array<float,2>{0.420929253f, 0.0632566959f},
-std::array<float,2>{0.992269158f, 0.691260815f},
-std::array<float,2>{0.738357961f, 0.497117579f},
-std::array<float,2>{0.0722554997f, 0.813414454f},
-std::array<float,2>{0.0343426205f, 0.145280421f},
-std::array<float,2>{0.683680534f, 0.573784471f},
-std::array<float,2>{0.904795408f, 0.287509739f},
-std::array<float,2>{0.483311743f, 0.963293195f},
-std::array<float,2>{0.36769864f, 0.421794862f},
-std::array<float,2>{0.765602052f, 0.773718178f},
-std::array<float,2>{0.534234166f, 0.0501166023f},
-std::array<float,2>{0.191367552f, 0.629036367f},
-std::array<float,2>{0.109011352f, 0.451014936f},
-std::array<float,2>{0.708976984f, 0.851286411f},
-std::array<float,2>{0.943691671f, 0.117529318f},
-std::array<float,2>{0.397407264f, 0.720660388f},
-std::array<float,2>{0.269845009f, 0.227198109f},
-std::array<float,2>{0.840905726f, 0.516318381f},
-std::array<float,2>{0.605669439f, 0.331400543f},
-std::array<float,2>{0.146346837f, 0.911723793f},
-std::array<float,2>{0.219392598f, 0.00990457926f},
-std::array<float,2>{0.516501665f, 0.673620522f},
-std::array<float,2>{0.801217377f, 0.382531345f},
-std::array<float,2>{0.343018711f, 0.788376331f},
-std::array<float,2>{0.463357151f, 0.267974883f},
-std::array<float,2>{0.936809242f, 0.98357141f},
-std::array<float,2>{0.650038481f, 0.18451032f},
-std::array<float,2>{0.019927267f, 0.618370175f},
-std::array<float,2>{0.214177042f, 0.395736575f},
-std::array<float,2>{0.560804725f, 0.804497421f},
-std::array<float,2>{0.7754004f, 0.019038951f},
-std::array<float,2>{0.349653512f, 0.660991013f},
-std::array<float,2>{0.490344495f, 0.170159072f},
-std::array<float,2>{0.880710125f, 0.60023427f},
-std::array<float,2>{0.671197772f, 0.263540775f},
-std::array<float,2>{0.0624926835f, 0.992150247f},
-std::array<float,2>{0.0810316131f, 0.106336482f},
-std::array<float,2>{0.721059263f, 0.735605657f},
-std::array<float,2>{0.980761051f, 0.462305635f},
-std::array<float,2>{0.424566776f, 0.874875546f},
-std::array<float,2>{0.307473868f, 0.317357838f},
-std::array<float,2>{0.873266697f, 0.928346872f},
-std::array<float,2>{0.568977594f, 0.238198683f},
-std::array<float,2>{0.170480296f, 0.508817613f},
-std::array<float,2>{0.00885070395f, 0.311174721f},
-std::array<float,2>{0.640506089f, 0.940616608f},
-std::array<float,2>{0.915574491f, 0.133869499f},
-std::array<float,2>{0.44199264f, 0.585025191f},
-std::array<float,2>{0.323684871f, 0.0345662013f},
-std::array<float,2>{0.78469789f, 0.645360589f},
-std::array<float,2>{0.504307508f, 0.423176259f},
-std::array<float,2>{0.243542537f, 0.752376854f},
-std::array<float,2>{0.128476173f, 0.212811187f},
-std::array<float,2>{0.622644365f, 0.551134586f},
-std::array<float,2>{0.815708876f, 0.368423104f},
-std::array<float,2>{0.257141441f, 0.904122233f},
-std::array<float,2>{0.388084054f, 0.469482213f},
-std::array<float,2>{0.96242547f, 0.835586667f},
-std::array<float,2>{0.688661873f, 0.0852762312f},
-std::array<float,2>{0.110925041f, 0.709991276f},
-std::array<float,2>{0.238504931f, 0.254493713f},
-std::array<float,2>{0.510460973f, 0.995183051f},
-std::array<float,2>{0.793393672f, 0.160315961f},
-std::array<float,2>{0.320042551f, 0.601965487f},
-std::array<float,2>{0.446026564f, 0.0249085799f},
-std::array<float,2>{0.907840014f, 0.666075468f},
-std::array<float,2>{0.631570101f, 0.399902314f},
-std::array<float,2>{0.000545006071f, 0.807620287f},
-std::array<float,2>{0.119930305f, 0.248453051f},
-std::array<float,2>{0.699738085f, 0.506476223f},
-std::array<float,2>{0.960855663f, 0.327861637f},
-std::array<float,2>{0.377508134f, 0.936344922f},
-std::array<float,2>{0.264181405f, 0.460510224f},
-std::array<float,2>{0.824116051f, 0.863642514f},
-std::array<float,2>{0.611869872f, 0.0939655453f},
-std::array<float,2>{0.136764526f, 0.746379435f},
-std::array<float,2>{0.0489732139f, 0.43186295f},
-std::array<float,2>{0.657132924f, 0.760664344f},
-std::array<float,2>{0.887586832f, 0.0465620495f},
-std::array<float,2>{0.499108702f, 0.650974631f},
-std::array<float,2>{0.355404556f, 0.127118066f},
-std::array<float,2>{0.769058764f, 0.588523865f},
-std::array<float,2>{0.546953619f, 0.298595071f},
-std::array<float,2>{0.205066696f, 0.949729264f},
-std::array<float,2>{0.162289649f, 0.0860487148f},
-std::array<float,2>{0.571908653f, 0.714892149f},
-std::array<float,2>{0.864544749f, 0.48211661f},
-std::array<float,2>{0.300165921f, 0.840043247f},
-std::array<float,2>{0.436706543f, 0.366661519f},
-std::array<float,2>{0.972333372f, 0.891892016f},
-std::array<float,2>{0.728014588f, 0.204858929f},
-std::array<float,2>{0.0903400779f, 0.554836214f},
-std::array<float,2>{0.150468513f, 0.490584016f},
-std::array<float,2>{0.595214367f, 0.823303938f},
-std::array<float,2>{0.834228098f, 0.0777111128f},
-std::array<float,2>{0.275130749f, 0.6988011f},
-std::array<float,2>{0.400360286f, 0.199183151f},
-std::array<float,2>{0.952764094f, 0.537690818f},
-std::array<float,2>{0.714742959f, 0.350468069f},
-std::array<float,2>{0.0954279155f, 0.880308449f},
-std::array<float,2>{0.0297911316f, 0.062229488f},
-std::array<float,2>{0.646441877f, 0.636439323f},
-std::array<float,2>{0.928664267f, 0.408504397f},
-std::array<float,2>{0.460666269f, 0.772884607f},
-std::array<float,2>{0.332176536f, 0.292077363f},
-std::array<float,2>{0.809282839f, 0.955762446f},
-std::array<float,2>{0.529962659f, 0.151326552f},
-std::array<float,2>{0.231382191f, 0.568860412f},
-std::array<float,2>{0.0691103563f, 0.341252834f},
-std::array<float,2>{0.745829821f, 0.914965272f},
-std::array<float,2>{0.990818501f, 0.221539974f},
-std::array<float,2>{0.40644002f, 0.528841197f},
-std::array<float,2>{0.291397095f, 0.115383275f},
-std::array<float,2>{0.847059429f, 0.734024525f},
-std::array<float,2>{0.592601061f, 0.43965894f},
-std::array<float,2>{0.176766157f, 0.852727056f},
-std::array<float,2>{0.19932802f, 0.179125562f},
-std::array<float,2>{0.54271847f, 0.614081383f},
-std::array<float,2>{0.750185013f, 0.280366778f},
-std::array<float,2>{0.361619174f, 0.973074496f},
-std::array<float,2>{0.469074816f, 0.384503663f},
-std::array<float,2>{0.893500268f, 0.792196214f},
-std::array<float,2>{0.674044132f, 0.00257217814f},
-std::array<float,2>{0.0451485477f, 0.683820963f},
-std::array<float,2>{0.166679054f, 0.295898914f},
-std::array<float,2>{0.563145161f, 0.960220098f},
-std::array<float,2>{0.870371103f, 0.152372688f},
-std::array<float,2>{0.308914632f, 0.56281966f},
-std::array<float,2>{0.428729951f, 0.0582726672f},
-std::array<float,2>{0.980435729f, 0.638719022f},
-std::array<float,2>{0.724149525f, 0.412460506f},
-std::array<float,2>{0.0854175761f, 0.768754721f},
-std::array<float,2>{0.0559919029f, 0.201986507f},
-std::array<float,2>{0.666989744f, 0.532332301f},
-std::array<float,2>{0.877811432f, 0.344114006f},
-std::array<float,2>{0.486036599f, 0.875371516f},
-std::array<float,2>{0.345237106f, 0.485049784f},
-std::array<float,2>{0.779150128f, 0.824489057f},
-std::array<float,2>{0.55812943f, 0.0704468712f},
-std::array<float,2>{0.215353608f, 0.702302039f},
-std::array<float,2>{0.116169825f, 0.388280481f},
-std::array<float,2>{0.692965806f, 0.794974566f},
-std::array<float,2>{0.967149913f, 0.00393724628f},
-std::array<float,2>{0.384595841f, 0.681294262f},
-std::array<float,2>{0.253381699f, 0.173152998f},
-std::array<float,2>{0.816465497f, 0.612878919f},
-std::array<float,2>{0.618282199f, 0.276823014f},
-std::array<float,2>{0.132271335f, 0.970603466f},
-std::array<float,2>{0.246243283f, 0.111272655f},
-std::array<float,2>{0.500620663f, 0.729379654f},
-std::array<float,2>{0.786787093f, 0.444837213f},
-std::array<float,2>{0.328019649f, 0.858356833f},
-std::array<float,2>{0.440973431f, 0.336628646f},
-std::array<float,2>{0.92146033f, 0.918263495f},
-std::array<float,2>{0.634790242f, 0.223179057f},
-std::array<float,2>{0.0122996299f, 0.525953412f},
-std::array<float,2>{0.192318633f, 0.453916728f},
-std::array<float,2>{0.538322926f, 0.862405062f},
-std::array<float,2>{0.759661198f, 0.099324666f},
-std::array<float,2>{0.374048561f, 0.744717002f},
-std::array<float,2>{0.479433507f, 0.242556334f},
-std::array<float,2>{0.901587367f, 0.501142919f},
-std::array<float,2>{0.6812343f, 0.322692066f},
-std::array<float,2>{0.038677983f, 0.93022114f},
-std::array<float,2>{0.0767262429f, 0.0295052417f},
-std::array<float,2>{0.735370696f, 0.671576381f},
-std::array<float,2>{0.996658146f, 0.405202866f},
-std::array<float,2>{0.417789727f, 0.81248492f},
-std::array<float,2>{0.287121892f, 0.252300203f},
-std::array<float,2>{0.854367912f, 0.996906877f},
-std::array<float,2>{0.583942533f, 0.158676744f},
-std::array<float,2>{0.184597239f, 0.606868207f},
-std::array<float,2>{0.0159860495f, 0.361323446f},
-std::array<float,2>{0.655897081f, 0.89823544f},
-std::array<float,2>{0.932482183f, 0.210800305f},
-std::array<float,2>{0.466273099f, 0.558618844f},
-std::array<float,2>{0.336165547f, 0.0915097818f},
-std::array<float,2>{0.798889577f, 0.711574256f},
-std::array<float,2>{0.522141516f, 0.477071404f},
-std::array<float,2>{0.224826157f, 0.838686109f},
-std::array<float,2>{0.143963113f, 0.129298657f},
-std::array<float,2>{0.604663849f, 0.592573583f},
-std::array<float,2>{0.83771497f, 0.304011971f},
-std::array<float,2>{0.265752792f, 0.947705925f},
-std::array<float,2>{0.394238472f, 0.434990704f},
-std::array<float,2>{0.941174984f, 0.762874722f},
-std::array<float,2>{0.703919649f, 0.0428114347f},
-std::array<float,2>{0.103824422f, 0.655936599f},
-std::array<float,2>{0.228923216f, 0.314428955f},
-std::array<float,2>{0.526539445f, 0.921992958f},
-std::array<float,2>{0.807626784f, 0.240498573f},
-std::array<float,2>{0.328823894f, 0.514740109f},
-std::array<float,2>{0.453572839f, 0.103964157f},
-std::array<float,2>{0.925373793f, 0.741401613f},
-std::array<float,2>{0.643802762f, 0.465937436f},
-std::array<float,2>{0.0238923691f, 0.867998958f},
-std::array<float,2>{0.0983554497f, 0.166793942f},
-std::array<float,2>{0.71777463f, 0.594813585f},
-std::array<float,2>{0.948164225f, 0.260376453f},
-std::array<float,2>{0.405356675f, 0.985931456f},
-std::array<float,2>{0.277473956f, 0.391222f},
-std::array<float,2>{0.829894304f, 0.798953235f},
-std::array<float,2>{0.598348618f, 0.0220269933f},
-std::array<float,2>{0.154794455f, 0.658509314f},
-std::array<float,2>{0.0401505008f, 0.475401551f},
-std::array<float,2>{0.679099441f, 0.829703927f},
-std::array<float,2>{0.896236181f, 0.0818419605f},
-std::array<float,2>{0.475596756f, 0.703379393f},
-std::array<float,2>{0.365772098f, 0.218029976f},
-std::array<float,2>{0.755290806f, 0.548093855f},
-std::array<float,2>{0.546108305f, 0.374011725f},
-std::array<float,2>{0.197569877f, 0.902018249f},
-std::array<float,2>{0.171920925f, 0.0384643786f},
-std::array<float,2>{0.5862149f, 0.641093433f},
-std::array<float,2>{0.850503743f, 0.428762883f},
-std::array<float,2>{0.293814361f, 0.755798936f},
-std::array<float,2>{0.411081076f, 0.304949403f},
-std::array<float,2>{0.987971425f, 0.944499612f},
-std::array<float,2>{0.747467756f, 0.139864951f},
-std::array<float,2>{0.0659268126f, 0.578619123f},
-std::array<float,2>{0.136017099f, 0.415165722f},
-std::array<float,2>{0.616713226f, 0.780466259f},
-std::array<float,2>{0.825097978f, 0.052908387f},
-std::array<float,2>{0.260343254f, 0.625064075f},
-std::array<float,2>{0.380145282f, 0.143766418f},
-std::array<float,2>{0.95327431f, 0.57556814f},
-std::array<float,2>{0.695925593f, 0.282328099f},
-std::array<float,2>{0.124389403f, 0.967960894f},
-std::array<float,2>{0.00439308118f, 0.0694422871f},
-std::array<float,2>{0.628242254f, 0.694966435f},
-std::array<float,2>{0.912433505f, 0.493921757f},
-std::array<float,2>{0.452629119f, 0.817314625f},
-std::array<float,2>{0.312739879f, 0.354146302f},
-std::array<float,2>{0.789937675f, 0.883597791f},
-std::array<float,2>{0.513578594f, 0.192062497f},
-std::array<float,2>{0.235988274f, 0.543719053f},
-std::array<float,2>{0.0864012912f, 0.273222417f},
-std::array<float,2>{0.731232524f, 0.977708757f},
-std::array<float,2>{0.975286365f, 0.18210429f},
-std::array<float,2>{0.429972559f, 0.621306241f},
-std::array<float,2>{0.302288741f, 0.0127088856f},
-std::array<float,2>{0.859385788f, 0.678497791f},
-std::array<float,2>{0.577767849f, 0.378885418f},
-std::array<float,2>{0.158675849f, 0.785013556f},
-std::array<float,2>{0.210551381f, 0.231124654f},
-std::array<float,2>{0.552057385f, 0.521040678f},
-std::array<float,2>{0.772682846f, 0.332580954f},
-std::array<float,2>{0.358393162f, 0.909819365f},
-std::array<float,2>{0.493928313f, 0.4461568f},
-std::array<float,2>{0.883978784f, 0.8462888f},
-std::array<float,2>{0.661521912f, 0.122487821f},
-std::array<float,2>{0.0530393645f, 0.724347055f},
-std::array<float,2>{0.149092525f, 0.350084573f},
-std::array<float,2>{0.597299159f, 0.880624712f},
-std::array<float,2>{0.832912326f, 0.198525667f},
-std::array<float,2>{0.277213842f, 0.537215114f},
-std::array<float,2>{0.40189904f, 0.077449806f},
-std::array<float,2>{0.95006907f, 0.698473811f},
-std::array<float,2>{0.712249339f, 0.491094768f},
-std::array<float,2>{0.0975714549f, 0.824161649f},
-std::array<float,2>{0.0280523021f, 0.150777534f},
-std::array<float,2>{0.64747107f, 0.568461239f},
-std::array<float,2>{0.926522613f, 0.292611331f},
-std::array<float,2>{0.457914591f, 0.955180645f},
-std::array<float,2>{0.335094273f, 0.409080774f},
-std::array<float,2>{0.812297523f, 0.773325622f},
-std::array<float,2>{0.528675199f, 0.0618736446f},
-std::array<float,2>{0.233146831f, 0.636110783f},
-std::array<float,2>{0.0666294023f, 0.440238565f},
-std::array<float,2>{0.743541718f, 0.853240848f},
-std::array<float,2>{0.989744246f, 0.115844682f},
-std::array<float,2>{0.40896067f, 0.733849227f},
-std::array<float,2>{0.290279478f, 0.221067175f},
-std::array<float,2>{0.845114589f, 0.528580487f},
-std::array<float,2>{0.59081471f, 0.341527849f},
-std::array<float,2>{0.178368643f, 0.914107323f},
-std::array<float,2>{0.20131062f, 0.00201416342f},
-std::array<float,2>{0.540684164f, 0.684202492f},
-std::array<float,2>{0.752172828f, 0.384035081f},
-std::array<float,2>{0.360518128f, 0.792895734f},
-std::array<float,2>{0.471984208f, 0.280821741f},
-std::array<float,2>{0.892171443f, 0.973387003f},
-std::array<float,2>{0.672560453f, 0.17944327f},
-std::array<float,2>{0.0441039167f, 0.613577485f},
-std::array<float,2>{0.24193041f, 0.400025427f},
-std::array<float,2>{0.509087384f, 0.808347285f},
-std::array<float,2>{0.796383381f, 0.024768563f},
-std::array<float,2>{0.318183213f, 0.666985989f},
-std::array<float,2>{0.44753024f, 0.160969973f},
-std::array<float,2>{0.909027457f, 0.602239251f},
-std::array<float,2>{0.62914592f, 0.254278332f},
-std::array<float,2>{0.00283133285f, 0.995958984f},
-std::array<float,2>{0.117275871f, 0.094513543f},
-std::array<float,2>{0.70247817f, 0.747020245f},
-std::array<float,2>{0.95828265f, 0.46027112f},
-std::array<float,2>{0.375594646f, 0.863796532f},
-std::array<float,2>{0.261827171f, 0.327325523f},
-std::array<float,2>{0.820580125f, 0.936023951f},
-std::array<float,2>{0.610850155f, 0.248926684f},
-std::array<float,2>{0.140202925f, 0.50602746f},
-std::array<float,2>{0.0483622439f, 0.298108816f},
-std::array<float,2>{0.659061015f, 0.94928205f},
-std::array<float,2>{0.890109658f, 0.127608359f},
-std::array<float,2>{0.497191548f, 0.588232636f},
-std::array<float,2>{0.353060424f, 0.0459627584f},
-std::array<float,2>{0.767045796f, 0.650558412f},
-std::array<float,2>{0.548973799f, 0.432371318f},
-std::array<float,2>{0.20654282f, 0.759782195f},
-std::array<float,2>{0.161708102f, 0.204480037f},
-std::array<float,2>{0.572490752f, 0.555491626f},
-std::array<float,2>{0.865905643f, 0.366756201f},
-std::array<float,2>{0.297878951f, 0.892234266f},
-std::array<float,2>{0.434099853f, 0.48174569f},
-std::array<float,2>{0.970067143f, 0.840798914f},
-std::array<float,2>{0.729751348f, 0.0867702737f},
-std::array<float,2>{0.0930931568f, 0.715453982f},
-std::array<float,2>{0.211451069f, 0.262865126f},
-std::array<float,2>{0.558655083f, 0.99123466f},
-std::array<float,2>{0.77425313f, 0.170713529f},
-std::array<float,2>{0.348098427f, 0.600063086f},
-std::array<float,2>{0.488647044f, 0.0192353688f},
-std::array<float,2>{0.882564664f, 0.660504043f},
-std::array<float,2>{0.66803962f, 0.39637965f},
-std::array<float,2>{0.0602509268f, 0.803811014f},
-std::array<float,2>{0.0800667256f, 0.237398848f},
-std::array<float,2>{0.720118344f, 0.50933975f},
-std::array<float,2>{0.98412931f, 0.316852391f},
-std::array<float,2>{0.422921538f, 0.92786181f},
-std::array<float,2>{0.305123895f, 0.462750942f},
-std::array<float,2>{0.871197164f, 0.874261856f},
-std::array<float,2>{0.568330526f, 0.10557127f},
-std::array<float,2>{0.168225989f, 0.73606354f},
-std::array<float,2>{0.0109930933f, 0.423369646f},
-std::array<float,2>{0.637007177f, 0.752671778f},
-std::array<float,2>{0.917423666f, 0.0349980891f},
-std::array<float,2>{0.444121689f, 0.644754827f},
-std::array<float,2>{0.32064867f, 0.134479344f},
-std::array<float,2>{0.782517195f, 0.585465789f},
-std::array<float,2>{0.506499887f, 0.310792297f},
-std::array<float,2>{0.244302496f, 0.940918624f},
-std::array<float,2>{0.126119033f, 0.085891813f},
-std::array<float,2>{0.623343706f, 0.710523486f},
-std::array<float,2>{0.813165128f, 0.469186693f},
-std::array<float,2>{0.254939228f, 0.83542937f},
-std::array<float,2>{0.38876012f, 0.368735373f},
-std::array<float,2>{0.96303302f, 0.90335089f},
-std::array<float,2>{0.689714849f, 0.212320253f},
-std::array<float,2>{0.113101274f, 0.551284432f},
-std::array<float,2>{0.18179743f, 0.497832656f},
-std::array<float,2>{0.578867078f, 0.812734842f},
-std::array<float,2>{0.858173847f, 0.0626202822f},
-std::array<float,2>{0.28140676f, 0.690718651f},
-std::array<float,2>{0.418497801f, 0.188501984f},
-std::array<float,2>{0.994435191f, 0.539987981f},
-std::array<float,2>{0.741889179f, 0.3586061f},
-std::array<float,2>{0.0727763176f, 0.887726128f},
-std::array<float,2>{0.0315045342f, 0.0505625829f},
-std::array<float,2>{0.685910761f, 0.629683971f},
-std::array<float,2>{0.903678358f, 0.42108646f},
-std::array<float,2>{0.480913371f, 0.774061143f},
-std::array<float,2>{0.369833678f, 0.288012117f},
-std::array<float,2>{0.76366061f, 0.963698089f},
-std::array<float,2>{0.533104956f, 0.14459905f},
-std::array<float,2>{0.18829526f, 0.573592484f},
-std::array<float,2>{0.10710299f, 0.331804037f},
-std::array<float,2>{0.710463405f, 0.911385059f},
-std::array<float,2>{0.942154825f, 0.226925179f},
-std::array<float,2>{0.396009028f, 0.515629411f},
-std::array<float,2>{0.272991955f, 0.118043743f},
-std::array<float,2>{0.843401253f, 0.720059514f},
-std::array<float,2>{0.607655704f, 0.450237572f},
-std::array<float,2>{0.147696078f, 0.850856364f},
-std::array<float,2>{0.22190094f, 0.184076518f},
-std::array<float,2>{0.51783663f, 0.61895591f},
-std::array<float,2>{0.803162575f, 0.268334448f},
-std::array<float,2>{0.340692848f, 0.984247625f},
-std::array<float,2>{0.462071508f, 0.38201347f},
-std::array<float,2>{0.934376895f, 0.788926721f},
-std::array<float,2>{0.65198034f, 0.0107059283f},
-std::array<float,2>{0.0227482878f, 0.673267722f},
-std::array<float,2>{0.129857391f, 0.275110334f},
-std::array<float,2>{0.620153785f, 0.972382605f},
-std::array<float,2>{0.819672048f, 0.174293905f},
-std::array<float,2>{0.250927389f, 0.610715151f},
-std::array<float,2>{0.386402935f, 0.00612915214f},
-std::array<float,2>{0.965512633f, 0.682103813f},
-std::array<float,2>{0.694252849f, 0.388961971f},
-std::array<float,2>{0.113411598f, 0.794124603f},
-std::array<float,2>{0.0154131921f, 0.226315066f},
-std::array<float,2>{0.634128571f, 0.524766505f},
-std::array<float,2>{0.919620037f, 0.338415354f},
-std::array<float,2>{0.438161701f, 0.921367824f},
-std::array<float,2>{0.325404972f, 0.441470385f},
-std::array<float,2>{0.788556635f, 0.856494844f},
-std::array<float,2>{0.502175093f, 0.112119935f},
-std::array<float,2>{0.249824494f, 0.726687372f},
-std::array<float,2>{0.0835606754f, 0.410372734f},
-std::array<float,2>{0.725846171f, 0.766880333f},
-std::array<float,2>{0.976847708f, 0.0552251413f},
-std::array<float,2>{0.427441478f, 0.636795163f},
-std::array<float,2>{0.311216027f, 0.156238928f},
-std::array<float,2>{0.867211998f, 0.566325068f},
-std::array<float,2>{0.565437913f, 0.29361099f},
-std::array<float,2>{0.165344834f, 0.958072662f},
-std::array<float,2>{0.217188284f, 0.0728472024f},
-std::array<float,2>{0.556061566f, 0.701156616f},
-std::array<float,2>{0.781047583f, 0.488004118f},
-std::array<float,2>{0.345828503f, 0.828085899f},
-std::array<float,2>{0.488092393f, 0.34658137f},
-std::array<float,2>{0.876109421f, 0.87700963f},
-std::array<float,2>{0.66527313f, 0.200096354f},
-std::array<float,2>{0.0578298606f, 0.533706367f},
-std::array<float,2>{0.222805873f, 0.479166836f},
-std::array<float,2>{0.519790351f, 0.837614119f},
-std::array<float,2>{0.796973228f, 0.0934993327f},
-std::array<float,2>{0.337932676f, 0.714007616f},
-std::array<float,2>{0.46798256f, 0.208942443f},
-std::array<float,2>{0.931471527f, 0.561082482f},
-std::array<float,2>{0.653139472f, 0.362998337f},
-std::array<float,2>{0.0191919487f, 0.895708203f},
-std::array<float,2>{0.101864487f, 0.0407157913f},
-std::array<float,2>{0.705563188f, 0.652795494f},
-std::array<float,2>{0.938625157f, 0.437252164f},
-std::array<float,2>{0.391546756f, 0.764009953f},
-std::array<float,2>{0.269299597f, 0.301511467f},
-std::array<float,2>{0.838650227f, 0.945658267f},
-std::array<float,2>{0.602961898f, 0.132352293f},
-std::array<float,2>{0.142151639f, 0.589958787f},
-std::array<float,2>{0.0355533101f, 0.321873516f},
-std::array<float,2>{0.682367802f, 0.931806147f},
-std::array<float,2>{0.89903456f, 0.245528013f},
-std::array<float,2>{0.476764321f, 0.50301677f},
-std::array<float,2>{0.371669918f, 0.0998156592f},
-std::array<float,2>{0.761059344f, 0.743192434f},
-std::array<float,2>{0.535191298f, 0.456686139f},
-std::array<float,2>{0.194336742f, 0.859487116f},
-std::array<float,2>{0.187310234f, 0.15706633f},
-std::array<float,2>{0.585207939f, 0.609127402f},
-std::array<float,2>{0.851663589f, 0.250996292f},
-std::array<float,2>{0.285702735f, 0.999238908f},
-std::array<float,2>{0.414799273f, 0.402775645f},
-std::array<float,2>{0.998548687f, 0.810475111f},
-std::array<float,2>{0.737297833f, 0.0282961894f},
-std::array<float,2>{0.0748903081f, 0.6696859f},
-std::array<float,2>{0.197037786f, 0.37285611f},
-std::array<float,2>{0.543898344f, 0.899264157f},
-std::array<float,2>{0.757730961f, 0.215693891f},
-std::array<float,2>{0.364235491f, 0.550700486f},
-std::array<float,2>{0.473036736f, 0.0782304034f},
-std::array<float,2>{0.897630274f, 0.70624882f},
-std::array<float,2>{0.676869571f, 0.47338748f},
-std::array<float,2>{0.0428189412f, 0.83200109f},
-std::array<float,2>{0.0641158745f, 0.138426855f},
-std::array<float,2>{0.749204457f, 0.581038475f},
-std::array<float,2>{0.984871566f, 0.307656795f},
-std::array<float,2>{0.413747549f, 0.942677498f},
-std::array<float,2>{0.296312183f, 0.42708835f},
-std::array<float,2>{0.848298967f, 0.757152438f},
-std::array<float,2>{0.588735282f, 0.0367635898f},
-std::array<float,2>{0.174698144f, 0.643540621f},
-std::array<float,2>{0.0256826375f, 0.466834337f},
-std::array<float,2>{0.641180813f, 0.870042086f},
-std::array<float,2>{0.922412157f, 0.10269358f},
-std::array<float,2>{0.456369996f, 0.738967359f},
-std::array<float,2>{0.331397742f, 0.239829749f},
-std::array<float,2>{0.805893719f, 0.51282084f},
-std::array<float,2>{0.525026679f, 0.315523803f},
-std::array<float,2>{0.227463946f, 0.925119221f},
-std::array<float,2>{0.153491855f, 0.0212428514f},
-std::array<float,2>{0.601179957f, 0.657417357f},
-std::array<float,2>{0.830198705f, 0.393223345f},
-std::array<float,2>{0.281127661f, 0.798165739f},
-std::array<float,2>{0.403408766f, 0.258575737f},
-std::array<float,2>{0.946298242f, 0.987527668f},
-std::array<float,2>{0.715346217f, 0.164639294f},
-std::array<float,2>{0.101492949f, 0.596346021f},
-std::array<float,2>{0.158108249f, 0.376613528f},
-std::array<float,2>{0.575325966f, 0.78317827f},
-std::array<float,2>{0.862151682f, 0.013959338f},
-std::array<float,2>{0.303016156f, 0.67687726f},
-std::array<float,2>{0.433362961f, 0.180430308f},
-std::array<float,2>{0.973317385f, 0.623618424f},
-std::array<float,2>{0.733586311f, 0.269838959f},
-std::array<float,2>{0.0886713043f, 0.978713095f},
-std::array<float,2>{0.0516779758f, 0.12401823f},
-std::array<float,2>{0.66351068f, 0.725957572f},
-std::array<float,2>{0.885477424f, 0.448593199f},
-std::array<float,2>{0.495115459f, 0.845604122f},
-std::array<float,2>{0.356395006f, 0.33555457f},
-std::array<float,2>{0.771006107f, 0.907448113f},
-std::array<float,2>{0.554283142f, 0.233557031f},
-std::array<float,2>{0.207614005f, 0.523010492f},
-std::array<float,2>{0.122818343f, 0.284039408f},
-std::array<float,2>{0.698514223f, 0.965346754f},
-std::array<float,2>{0.955255508f, 0.14210324f},
-std::array<float,2>{0.380960017f, 0.577349007f},
-std::array<float,2>{0.258250624f, 0.0517220721f},
-std::array<float,2>{0.827727377f, 0.627164602f},
-std::array<float,2>{0.61436379f, 0.416396528f},
-std::array<float,2>{0.134670094f, 0.777688801f},
-std::array<float,2>{0.236455828f, 0.194184005f},
-std::array<float,2>{0.515159667f, 0.546835601f},
-std::array<float,2>{0.791863561f, 0.352744192f},
-std::array<float,2>{0.315512061f, 0.886012733f},
-std::array<float,2>{0.450980455f, 0.495779753f},
-std::array<float,2>{0.910642445f, 0.819179595f},
-std::array<float,2>{0.625378251f, 0.0675173849f},
-std::array<float,2>{0.00618228829f, 0.692017913f},
-std::array<float,2>{0.17747581f, 0.342755973f},
-std::array<float,2>{0.592163742f, 0.917333722f},
-std::array<float,2>{0.847459257f, 0.219297931f},
-std::array<float,2>{0.291783661f, 0.52978909f},
-std::array<float,2>{0.407152236f, 0.114923157f},
-std::array<float,2>{0.990314305f, 0.731603861f},
-std::array<float,2>{0.74557209f, 0.437737674f},
-std::array<float,2>{0.0686458424f, 0.853940606f},
-std::array<float,2>{0.0458020121f, 0.177615747f},
-std::array<float,2>{0.674556613f, 0.616542816f},
-std::array<float,2>{0.892985284f, 0.277363151f},
-std::array<float,2>{0.469484299f, 0.974893391f},
-std::array<float,2>{0.362101525f, 0.385868043f},
-std::array<float,2>{0.750932693f, 0.790717542f},
-std::array<float,2>{0.542225599f, 0.00138963154f},
-std::array<float,2>{0.199993461f, 0.687418222f},
-std::array<float,2>{0.0948489383f, 0.489321113f},
-std::array<float,2>{0.714313447f, 0.821631908f},
-std::array<float,2>{0.952492893f, 0.074970983f},
-std::array<float,2>{0.399509251f, 0.696673155f},
-std::array<float,2>{0.274862885f, 0.195946544f},
-std::array<float,2>{0.834576726f, 0.536031365f},
-std::array<float,2>{0.595299721f, 0.348990798f},
-std::array<float,2>{0.151099026f, 0.880870044f},
-std::array<float,2>{0.230637386f, 0.0603332967f},
-std::array<float,2>{0.529691279f, 0.634049654f},
-std::array<float,2>{0.808700562f, 0.407879084f},
-std::array<float,2>{0.332958966f, 0.770433247f},
-std::array<float,2>{0.460426599f, 0.289330423f},
-std::array<float,2>{0.9278965f, 0.953931093f},
-std::array<float,2>{0.645584583f, 0.149500966f},
-std::array<float,2>{0.0297587533f, 0.567947626f},
-std::array<float,2>{0.204446793f, 0.431506217f},
-std::array<float,2>{0.547740757f, 0.759617925f},
-std::array<float,2>{0.768823326f, 0.0448467955f},
-std::array<float,2>{0.354847908f, 0.649954379f},
-std::array<float,2>{0.499671251f, 0.125014246f},
-std::array<float,2>{0.887069821f, 0.586212754f},
-std::array<float,2>{0.656306863f, 0.299057722f},
-std::array<float,2>{0.0494644716f, 0.952074468f},
-std::array<float,2>{0.0900602937f, 0.0880502909f},
-std::array<float,2>{0.728203237f, 0.717131615f},
-std::array<float,2>{0.971945763f, 0.483796746f},
-std::array<float,2>{0.437075138f, 0.84267652f},
-std::array<float,2>{0.300729126f, 0.36400333f},
-std::array<float,2>{0.865101099f, 0.892661333f},
-std::array<float,2>{0.57133621f, 0.205899239f},
-std::array<float,2>{0.162870601f, 0.55720818f},
-std::array<float,2>{0.000217945664f, 0.256817549f},
-std::array<float,2>{0.631169438f, 0.993895352f},
-std::array<float,2>{0.907243609f, 0.162603498f},
-std::array<float,2>{0.445333898f, 0.604442775f},
-std::array<float,2>{0.319491059f, 0.0262476373f},
-std::array<float,2>{0.793857336f, 0.664184988f},
-std::array<float,2>{0.510188341f, 0.400677443f},
-std::array<float,2>{0.238793254f, 0.805798948f},
-std::array<float,2>{0.137527466f, 0.247769445f},
-std::array<float,2>{0.611477852f, 0.504228652f},
-std::array<float,2>{0.823509872f, 0.325475514f},
-std::array<float,2>{0.264092118f, 0.934883237f},
-std::array<float,2>{0.377411485f, 0.458089679f},
-std::array<float,2>{0.960273683f, 0.867027879f},
-std::array<float,2>{0.699532449f, 0.0971594974f},
-std::array<float,2>{0.119407289f, 0.748092592f},
-std::array<float,2>{0.243766338f, 0.309886634f},
-std::array<float,2>{0.504458308f, 0.939318299f},
-std::array<float,2>{0.784316003f, 0.135100201f},
-std::array<float,2>{0.324095368f, 0.583944738f},
-std::array<float,2>{0.441652298f, 0.0328683257f},
-std::array<float,2>{0.915078878f, 0.648088455f},
-std::array<float,2>{0.640016913f, 0.424553335f},
-std::array<float,2>{0.00970073882f, 0.750585079f},
-std::array<float,2>{0.110477529f, 0.214040384f},
-std::array<float,2>{0.689385593f, 0.553745747f},
-std::array<float,2>{0.962272584f, 0.37071678f},
-std::array<float,2>{0.388629466f, 0.905390263f},
-std::array<float,2>{0.257692754f, 0.472382337f},
-std::array<float,2>{0.816273451f, 0.832191706f},
-std::array<float,2>{0.622097373f, 0.0833828151f},
-std::array<float,2>{0.128088444f, 0.708003879f},
-std::array<float,2>{0.0618465468f, 0.397656322f},
-std::array<float,2>{0.671460569f, 0.802303314f},
-std::array<float,2>{0.879933357f, 0.0161095168f},
-std::array<float,2>{0.490997851f, 0.662308395f},
-std::array<float,2>{0.350504816f, 0.169421166f},
-std::array<float,2>{0.776022136f, 0.599368393f},
-std::array<float,2>{0.561292946f, 0.265092134f},
-std::array<float,2>{0.214670792f, 0.988315284f},
-std::array<float,2>{0.170090005f, 0.108111843f},
-std::array<float,2>{0.568697393f, 0.736942708f},
-std::array<float,2>{0.873699844f, 0.463802785f},
-std::array<float,2>{0.306890875f, 0.871410012f},
-std::array<float,2>{0.424106002f, 0.319822192f},
-std::array<float,2>{0.981017947f, 0.92683059f},
-std::array<float,2>{0.721484721f, 0.235059828f},
-std::array<float,2>{0.0801310912f, 0.511246145f},
-std::array<float,2>{0.145861015f, 0.453086406f},
-std::array<float,2>{0.606005967f, 0.849062681f},
-std::array<float,2>{0.841550946f, 0.119954705f},
-std::array<float,2>{0.270457447f, 0.722191632f},
-std::array<float,2>{0.396893084f, 0.229925811f},
-std::array<float,2>{0.944215536f, 0.518413782f},
-std::array<float,2>{0.708011031f, 0.329665542f},
-std::array<float,2>{0.108573027f, 0.913252115f},
-std::array<float,2>{0.0204396229f, 0.00869165827f},
-std::array<float,2>{0.649459779f, 0.674426496f},
-std::array<float,2>{0.937315106f, 0.379503518f},
-std::array<float,2>{0.463846147f, 0.785493672f},
-std::array<float,2>{0.343686819f, 0.265938699f},
-std::array<float,2>{0.801436722f, 0.980898082f},
-std::array<float,2>{0.515708983f, 0.187390357f},
-std::array<float,2>{0.21921964f, 0.620967984f},
-std::array<float,2>{0.0716284066f, 0.356013358f},
-std::array<float,2>{0.739189863f, 0.88930738f},
-std::array<float,2>{0.992953658f, 0.189595565f},
-std::array<float,2>{0.421511799f, 0.541841745f},
-std::array<float,2>{0.284025371f, 0.0652560443f},
-std::array<float,2>{0.856537163f, 0.688813567f},
-std::array<float,2>{0.580841839f, 0.498584777f},
-std::array<float,2>{0.180489942f, 0.815758586f},
-std::array<float,2>{0.190536171f, 0.148328334f},
-std::array<float,2>{0.534763753f, 0.571123421f},
-std::array<float,2>{0.765030384f, 0.287037313f},
-std::array<float,2>{0.367575496f, 0.962167203f},
-std::array<float,2>{0.482531577f, 0.418211013f},
-std::array<float,2>{0.904561162f, 0.776726305f},
-std::array<float,2>{0.684357941f, 0.0471216924f},
-std::array<float,2>{0.034851227f, 0.63172406f},
-std::array<float,2>{0.184146538f, 0.250432163f},
-std::array<float,2>{0.582280278f, 0.998166382f},
-std::array<float,2>{0.854860663f, 0.157852322f},
-std::array<float,2>{0.288262814f, 0.608118355f},
-std::array<float,2>{0.416222215f, 0.0289677326f},
-std::array<float,2>{0.997086525f, 0.668503165f},
-std::array<float,2>{0.734856009f, 0.403693408f},
-std::array<float,2>{0.0773161277f, 0.808862627f},
-std::array<float,2>{0.0371660292f, 0.244537026f},
-std::array<float,2>{0.680438101f, 0.502704561f},
-std::array<float,2>{0.901005089f, 0.320930064f},
-std::array<float,2>{0.479930997f, 0.932847381f},
-std::array<float,2>{0.373844445f, 0.455268204f},
-std::array<float,2>{0.758152723f, 0.860881448f},
-std::array<float,2>{0.537779331f, 0.100894362f},
-std::array<float,2>{0.193054438f, 0.742294431f},
-std::array<float,2>{0.105169795f, 0.436365783f},
-std::array<float,2>{0.704175293f, 0.764866829f},
-std::array<float,2>{0.939874232f, 0.0400283448f},
-std::array<float,2>{0.393018425f, 0.654044807f},
-std::array<float,2>{0.26746726f, 0.131037056f},
-std::array<float,2>{0.83636719f, 0.591116905f},
-std::array<float,2>{0.603685677f, 0.301791221f},
-std::array<float,2>{0.143127516f, 0.946984053f},
-std::array<float,2>{0.225727528f, 0.0927327573f},
-std::array<float,2>{0.523361564f, 0.713737607f},
-std::array<float,2>{0.800286055f, 0.480360448f},
-std::array<float,2>{0.337459803f, 0.836128473f},
-std::array<float,2>{0.465451241f, 0.361901045f},
-std::array<float,2>{0.933127344f, 0.895354569f},
-std::array<float,2>{0.65501219f, 0.207864314f},
-std::array<float,2>{0.0169972777f, 0.561667204f},
-std::array<float,2>{0.216189504f, 0.486742914f},
-std::array<float,2>{0.557255208f, 0.826785088f},
-std::array<float,2>{0.777427018f, 0.0732555836f},
-std::array<float,2>{0.344642878f, 0.700176418f},
-std::array<float,2>{0.485075265f, 0.200421885f},
-std::array<float,2>{0.878487468f, 0.534349203f},
-std::array<float,2>{0.667150497f, 0.347502232f},
-std::array<float,2>{0.0552381091f, 0.878716528f},
-std::array<float,2>{0.0843848884f, 0.0563563891f},
-std::array<float,2>{0.722721517f, 0.638204277f},
-std::array<float,2>{0.979413867f, 0.411402792f},
-std::array<float,2>{0.427928209f, 0.76641798f},
-std::array<float,2>{0.310294241f, 0.29453215f},
-std::array<float,2>{0.869337142f, 0.957243562f},
-std::array<float,2>{0.563855708f, 0.154353887f},
-std::array<float,2>{0.167820051f, 0.564777136f},
-std::array<float,2>{0.0134721342f, 0.339511484f},
-std::array<float,2>{0.636205971f, 0.920631468f},
-std::array<float,2>{0.920490861f, 0.225233942f},
-std::array<float,2>{0.439835519f, 0.523744643f},
-std::array<float,2>{0.327090442f, 0.112400718f},
-std::array<float,2>{0.785601377f, 0.728161454f},
-std::array<float,2>{0.501390338f, 0.443113595f},
-std::array<float,2>{0.247806117f, 0.856069803f},
-std::array<float,2>{0.131787255f, 0.174809873f},
-std::array<float,2>{0.617218971f, 0.609394789f},
-std::array<float,2>{0.81822741f, 0.273799509f},
-std::array<float,2>{0.252089947f, 0.971359551f},
-std::array<float,2>{0.383444816f, 0.390574157f},
-std::array<float,2>{0.967876673f, 0.793111324f},
-std::array<float,2>{0.692154825f, 0.00766775664f},
-std::array<float,2>{0.116878942f, 0.683364153f},
-std::array<float,2>{0.234500363f, 0.351799101f},
-std::array<float,2>{0.512455225f, 0.885358036f},
-std::array<float,2>{0.790712714f, 0.194381952f},
-std::array<float,2>{0.313802838f, 0.545405805f},
-std::array<float,2>{0.45177713f, 0.0668973178f},
-std::array<float,2>{0.913907647f, 0.6928702f},
-std::array<float,2>{0.627840459f, 0.495011091f},
-std::array<float,2>{0.00496437028f, 0.819662035f},
-std::array<float,2>{0.123291843f, 0.141234428f},
-std::array<float,2>{0.696479142f, 0.576377749f},
-std::array<float,2>{0.954299271f, 0.284721911f},
-std::array<float,2>{0.379330218f, 0.966371179f},
-std::array<float,2>{0.260820925f, 0.417265296f},
-std::array<float,2>{0.825399339f, 0.778853416f},
-std::array<float,2>{0.61535275f, 0.0522803739f},
-std::array<float,2>{0.13526082f, 0.628410041f},
-std::array<float,2>{0.0544078872f, 0.447933525f},
-std::array<float,2>{0.660719275f, 0.844580173f},
-std::array<float,2>{0.883087099f, 0.124129497f},
-std::array<float,2>{0.492495537f, 0.725264847f},
-std::array<float,2>{0.359284759f, 0.23252663f},
-std::array<float,2>{0.771488786f, 0.521915257f},
-std::array<float,2>{0.551251233f, 0.334355444f},
-std::array<float,2>{0.209300637f, 0.906400979f},
-std::array<float,2>{0.159944862f, 0.0154874129f},
-std::array<float,2>{0.576742828f, 0.676419079f},
-std::array<float,2>{0.860531092f, 0.375231236f},
-std::array<float,2>{0.301312089f, 0.781692445f},
-std::array<float,2>{0.430934787f, 0.270552218f},
-std::array<float,2>{0.976212025f, 0.979776859f},
-std::array<float,2>{0.732212067f, 0.181144282f},
-std::array<float,2>{0.0872732177f, 0.624032855f},
-std::array<float,2>{0.15529193f, 0.393980443f},
-std::array<float,2>{0.598915517f, 0.797108591f},
-std::array<float,2>{0.82882905f, 0.0204389561f},
-std::array<float,2>{0.278941333f, 0.657050431f},
-std::array<float,2>{0.404944509f, 0.165369853f},
-std::array<float,2>{0.948364735f, 0.596780658f},
-std::array<float,2>{0.716849387f, 0.258805454f},
-std::array<float,2>{0.0991574973f, 0.986731231f},
-std::array<float,2>{0.025207134f, 0.101662837f},
-std::array<float,2>{0.64292413f, 0.739503801f},
-std::array<float,2>{0.924477518f, 0.467992336f},
-std::array<float,2>{0.455005288f, 0.870392561f},
-std::array<float,2>{0.329592109f, 0.314667165f},
-std::array<float,2>{0.807449043f, 0.923864126f},
-std::array<float,2>{0.525580347f, 0.238946557f},
-std::array<float,2>{0.229693934f, 0.512017787f},
-std::array<float,2>{0.0650197268f, 0.306994021f},
-std::array<float,2>{0.7461766f, 0.942205071f},
-std::array<float,2>{0.986799359f, 0.137030602f},
-std::array<float,2>{0.411350936f, 0.581260502f},
-std::array<float,2>{0.294771552f, 0.0360803902f},
-std::array<float,2>{0.851506829f, 0.643846095f},
-std::array<float,2>{0.587719738f, 0.425808966f},
-std::array<float,2>{0.173605114f, 0.756002843f},
-std::array<float,2>{0.199021876f, 0.216457009f},
-std::array<float,2>{0.54554832f, 0.549381256f},
-std::array<float,2>{0.754789293f, 0.371768594f},
-std::array<float,2>{0.367052108f, 0.900080264f},
-std::array<float,2>{0.475258082f, 0.47385329f},
-std::array<float,2>{0.895438731f, 0.830438673f},
-std::array<float,2>{0.678629279f, 0.079749316f},
-std::array<float,2>{0.0390841663f, 0.705536664f},
-std::array<float,2>{0.138801008f, 0.324607521f},
-std::array<float,2>{0.60982883f, 0.934237838f},
-std::array<float,2>{0.821975946f, 0.246103734f},
-std::array<float,2>{0.26350677f, 0.504947662f},
-std::array<float,2>{0.376400918f, 0.0966198593f},
-std::array<float,2>{0.957241416f, 0.749518037f},
-std::array<float,2>{0.701444745f, 0.457575202f},
-std::array<float,2>{0.118568979f, 0.865940928f},
-std::array<float,2>{0.00371490605f, 0.163743943f},
-std::array<float,2>{0.630041063f, 0.604843378f},
-std::array<float,2>{0.909671545f, 0.257760793f},
-std::array<float,2>{0.449161708f, 0.992754281f},
-std::array<float,2>{0.317225993f, 0.40175131f},
-std::array<float,2>{0.795056105f, 0.805616438f},
-std::array<float,2>{0.507976353f, 0.0264854338f},
-std::array<float,2>{0.240847722f, 0.665240645f},
-std::array<float,2>{0.0924791992f, 0.483280301f},
-std::array<float,2>{0.729012251f, 0.843704045f},
-std::array<float,2>{0.969198942f, 0.0892908275f},
-std::array<float,2>{0.435500503f, 0.718669772f},
-std::array<float,2>{0.297445685f, 0.20673342f},
-std::array<float,2>{0.866768003f, 0.558316052f},
-std::array<float,2>{0.574108303f, 0.364656359f},
-std::array<float,2>{0.160377547f, 0.89436233f},
-std::array<float,2>{0.205450252f, 0.0432708785f},
-std::array<float,2>{0.550178826f, 0.649228752f},
-std::array<float,2>{0.766320705f, 0.430037886f},
-std::array<float,2>{0.352502644f, 0.758102775f},
-std::array<float,2>{0.496432722f, 0.300561756f},
-std::array<float,2>{0.88935113f, 0.953121364f},
-std::array<float,2>{0.659511209f, 0.126300916f},
-std::array<float,2>{0.0473402292f, 0.58760637f},
-std::array<float,2>{0.234328359f, 0.406975061f},
-std::array<float,2>{0.527780712f, 0.771353543f},
-std::array<float,2>{0.811436832f, 0.0594072454f},
-std::array<float,2>{0.334450305f, 0.633464158f},
-std::array<float,2>{0.458273172f, 0.148828655f},
-std::array<float,2>{0.926837981f, 0.567043841f},
-std::array<float,2>{0.647453606f, 0.290342778f},
-std::array<float,2>{0.0288225524f, 0.954348564f},
-std::array<float,2>{0.0964064822f, 0.0753587782f},
-std::array<float,2>{0.711394429f, 0.695450842f},
-std::array<float,2>{0.950537026f, 0.489216298f},
-std::array<float,2>{0.401257426f, 0.820684195f},
-std::array<float,2>{0.2757833f, 0.348521709f},
-std::array<float,2>{0.833130717f, 0.88232559f},
-std::array<float,2>{0.596269071f, 0.196712047f},
-std::array<float,2>{0.149741679f, 0.536966324f},
-std::array<float,2>{0.0435064882f, 0.279223114f},
-std::array<float,2>{0.672886133f, 0.97579354f},
-std::array<float,2>{0.890787601f, 0.176236823f},
-std::array<float,2>{0.470990866f, 0.615616024f},
-std::array<float,2>{0.360239595f, 0.000787777535f},
-std::array<float,2>{0.753651738f, 0.68606168f},
-std::array<float,2>{0.53947103f, 0.384888023f},
-std::array<float,2>{0.203014642f, 0.789922416f},
-std::array<float,2>{0.179209694f, 0.220363855f},
-std::array<float,2>{0.59173882f, 0.530509412f},
-std::array<float,2>{0.844686031f, 0.3435978f},
-std::array<float,2>{0.289809942f, 0.916600883f},
-std::array<float,2>{0.409698039f, 0.438594937f},
-std::array<float,2>{0.988779068f, 0.855020583f},
-std::array<float,2>{0.742886901f, 0.113667384f},
-std::array<float,2>{0.0675855428f, 0.731033742f},
-std::array<float,2>{0.188660204f, 0.285973102f},
-std::array<float,2>{0.531721592f, 0.960949838f},
-std::array<float,2>{0.762554705f, 0.147265851f},
-std::array<float,2>{0.37102437f, 0.572132051f},
-std::array<float,2>{0.481653333f, 0.0480369441f},
-std::array<float,2>{0.903225601f, 0.632380307f},
-std::array<float,2>{0.687189519f, 0.419207931f},
-std::array<float,2>{0.0323458835f, 0.775502086f},
-std::array<float,2>{0.0733096302f, 0.190432161f},
-std::array<float,2>{0.740322232f, 0.54284358f},
-std::array<float,2>{0.995120168f, 0.356730431f},
-std::array<float,2>{0.419034928f, 0.890098453f},
-std::array<float,2>{0.283002496f, 0.499383003f},
-std::array<float,2>{0.858640194f, 0.815409064f},
-std::array<float,2>{0.579370081f, 0.0660097897f},
-std::array<float,2>{0.182878897f, 0.688004911f},
-std::array<float,2>{0.0218966436f, 0.380090505f},
-std::array<float,2>{0.651162088f, 0.786859214f},
-std::array<float,2>{0.934979796f, 0.00936251599f},
-std::array<float,2>{0.461793959f, 0.6751858f},
-std::array<float,2>{0.341696233f, 0.186110616f},
-std::array<float,2>{0.803847671f, 0.619589806f},
-std::array<float,2>{0.518917918f, 0.267412364f},
-std::array<float,2>{0.220900789f, 0.981530547f},
-std::array<float,2>{0.147367597f, 0.121074006f},
-std::array<float,2>{0.609253526f, 0.720861793f},
-std::array<float,2>{0.842017412f, 0.451946259f},
-std::array<float,2>{0.271778941f, 0.847961903f},
-std::array<float,2>{0.394814879f, 0.328809053f},
-std::array<float,2>{0.942923963f, 0.912707567f},
-std::array<float,2>{0.709760725f, 0.229225397f},
-std::array<float,2>{0.106189802f, 0.51872164f},
-std::array<float,2>{0.169767588f, 0.464531243f},
-std::array<float,2>{0.566438138f, 0.872814119f},
-std::array<float,2>{0.872768939f, 0.108646736f},
-std::array<float,2>{0.306610197f, 0.738086462f},
-std::array<float,2>{0.422749013f, 0.23608923f},
-std::array<float,2>{0.982968748f, 0.51033169f},
-std::array<float,2>{0.719191909f, 0.318701476f},
-std::array<float,2>{0.0782885402f, 0.926084697f},
-std::array<float,2>{0.0593410246f, 0.0167653263f},
-std::array<float,2>{0.669529021f, 0.663485706f},
-std::array<float,2>{0.881175995f, 0.396724105f},
-std::array<float,2>{0.489875406f, 0.801603019f},
-std::array<float,2>{0.348747879f, 0.264292657f},
-std::array<float,2>{0.775121152f, 0.989383161f},
-std::array<float,2>{0.55972892f, 0.168088287f},
-std::array<float,2>{0.212033987f, 0.597838163f},
-std::array<float,2>{0.111783758f, 0.369201303f},
-std::array<float,2>{0.690501094f, 0.904346466f},
-std::array<float,2>{0.963917017f, 0.213520572f},
-std::array<float,2>{0.389945924f, 0.552834213f},
-std::array<float,2>{0.254283875f, 0.0825169384f},
-std::array<float,2>{0.813534796f, 0.708306491f},
-std::array<float,2>{0.624597073f, 0.471510887f},
-std::array<float,2>{0.125240579f, 0.833487689f},
-std::array<float,2>{0.246043652f, 0.135776117f},
-std::array<float,2>{0.507431209f, 0.582835078f},
-std::array<float,2>{0.781849384f, 0.308778465f},
-std::array<float,2>{0.321443856f, 0.938372254f},
-std::array<float,2>{0.44511652f, 0.425305426f},
-std::array<float,2>{0.916069984f, 0.751813233f},
-std::array<float,2>{0.638054967f, 0.0316627361f},
-std::array<float,2>{0.0101687806f, 0.647411168f},
-std::array<float,2>{0.140987501f, 0.30279094f},
-std::array<float,2>{0.60183835f, 0.949109912f},
-std::array<float,2>{0.839110196f, 0.130450785f},
-std::array<float,2>{0.268060327f, 0.593227863f},
-std::array<float,2>{0.39246586f, 0.0410415009f},
-std::array<float,2>{0.938097715f, 0.65511632f},
-std::array<float,2>{0.706165731f, 0.433669686f},
-std::array<float,2>{0.103115797f, 0.762341142f},
-std::array<float,2>{0.0184937641f, 0.209025562f},
-std::array<float,2>{0.654183209f, 0.560158432f},
-std::array<float,2>{0.92996794f, 0.359705448f},
-std::array<float,2>{0.467544377f, 0.897244453f},
-std::array<float,2>{0.339742869f, 0.478146136f},
-std::array<float,2>{0.798556983f, 0.839406967f},
-std::array<float,2>{0.521359384f, 0.0903804824f},
-std::array<float,2>{0.224061638f, 0.71203804f},
-std::array<float,2>{0.0760487989f, 0.406130195f},
-std::array<float,2>{0.737555563f, 0.811330497f},
-std::array<float,2>{0.999881268f, 0.0305856783f},
-std::array<float,2>{0.415745676f, 0.670020521f},
-std::array<float,2>{0.286287963f, 0.159222439f},
-std::array<float,2>{0.852747619f, 0.605980158f},
-std::array<float,2>{0.584951878f, 0.253801554f},
-std::array<float,2>{0.18584916f, 0.99748987f},
-std::array<float,2>{0.194294915f, 0.0980582535f},
-std::array<float,2>{0.536630154f, 0.745176792f},
-std::array<float,2>{0.760501802f, 0.455023617f},
-std::array<float,2>{0.372606426f, 0.862115443f},
-std::array<float,2>{0.47795257f, 0.323287308f},
-std::array<float,2>{0.900319815f, 0.93087703f},
-std::array<float,2>{0.682946801f, 0.243230015f},
-std::array<float,2>{0.0361475684f, 0.500031531f},
-std::array<float,2>{0.248133063f, 0.443707645f},
-std::array<float,2>{0.503817081f, 0.859079361f},
-std::array<float,2>{0.787836254f, 0.110225789f},
-std::array<float,2>{0.325050831f, 0.730217576f},
-std::array<float,2>{0.43913576f, 0.224298924f},
-std::array<float,2>{0.918571353f, 0.526892126f},
-std::array<float,2>{0.633325577f, 0.337581724f},
-std::array<float,2>{0.0138121461f, 0.919002414f},
-std::array<float,2>{0.114458457f, 0.00559705868f},
-std::array<float,2>{0.694769323f, 0.68021822f},
-std::array<float,2>{0.966558754f, 0.387326986f},
-std::array<float,2>{0.385324389f, 0.796697199f},
-std::array<float,2>{0.251725703f, 0.276192278f},
-std::array<float,2>{0.818419576f, 0.969673097f},
-std::array<float,2>{0.619284511f, 0.17217654f},
-std::array<float,2>{0.130652741f, 0.611441076f},
-std::array<float,2>{0.057495378f, 0.344954073f},
-std::array<float,2>{0.664592564f, 0.87633884f},
-std::array<float,2>{0.875720382f, 0.203002468f},
-std::array<float,2>{0.487284631f, 0.531530976f},
-std::array<float,2>{0.347560853f, 0.0719514638f},
-std::array<float,2>{0.7800771f, 0.70208782f},
-std::array<float,2>{0.554978311f, 0.485628337f},
-std::array<float,2>{0.218057215f, 0.826013327f},
-std::array<float,2>{0.164305583f, 0.154110327f},
-std::array<float,2>{0.565092564f, 0.563739598f},
-std::array<float,2>{0.868574917f, 0.295685112f},
-std::array<float,2>{0.312312454f, 0.959501207f},
-std::array<float,2>{0.425981492f, 0.413570851f},
-std::array<float,2>{0.977867186f, 0.768414378f},
-std::array<float,2>{0.72461468f, 0.0573670231f},
-std::array<float,2>{0.0820944384f, 0.640408337f},
-std::array<float,2>{0.208758622f, 0.333007991f},
-std::array<float,2>{0.553020477f, 0.908993304f},
-std::array<float,2>{0.76986295f, 0.231842071f},
-std::array<float,2>{0.357202321f, 0.520171106f},
-std::array<float,2>{0.49536252f, 0.121986285f},
-std::array<float,2>{0.885925949f, 0.723173499f},
-std::array<float,2>{0.662376404f, 0.446938127f},
-std::array<float,2>{0.0525133796f, 0.847112477f},
-std::array<float,2>{0.0889865384f, 0.182812184f},
-std::array<float,2>{0.733264267f, 0.622133553f},
-std::array<float,2>{0.974138677f, 0.271890074f},
-std::array<float,2>{0.431850612f, 0.976580679f},
-std::array<float,2>{0.304663062f, 0.377296805f},
-std::array<float,2>{0.862896144f, 0.783297181f},
-std::array<float,2>{0.574755549f, 0.0121028125f},
-std::array<float,2>{0.156632289f, 0.67963469f},
-std::array<float,2>{0.00771850161f, 0.492753446f},
-std::array<float,2>{0.626638472f, 0.81810993f},
-std::array<float,2>{0.911536694f, 0.0693019107f},
-std::array<float,2>{0.449861199f, 0.693716645f},
-std::array<float,2>{0.314649224f, 0.193226412f},
-std::array<float,2>{0.792394757f, 0.544760704f},
-std::array<float,2>{0.514124095f, 0.355420053f},
-std::array<float,2>{0.237839028f, 0.884749711f},
-std::array<float,2>{0.133216545f, 0.0546129346f},
-std::array<float,2>{0.613864422f, 0.626757681f},
-std::array<float,2>{0.82622242f, 0.414728642f},
-std::array<float,2>{0.25892958f, 0.780055225f},
-std::array<float,2>{0.382032812f, 0.28221038f},
-std::array<float,2>{0.956737518f, 0.96732372f},
-std::array<float,2>{0.697567642f, 0.142891049f},
-std::array<float,2>{0.121701606f, 0.575096726f},
-std::array<float,2>{0.175139517f, 0.428573132f},
-std::array<float,2>{0.589697003f, 0.754381835f},
-std::array<float,2>{0.849341631f, 0.0380332507f},
-std::array<float,2>{0.294948667f, 0.642088413f},
-std::array<float,2>{0.412477851f, 0.139088929f},
-std::array<float,2>{0.985411167f, 0.579624534f},
-std::array<float,2>{0.748077035f, 0.305669904f},
-std::array<float,2>{0.0631097928f, 0.943382204f},
-std::array<float,2>{0.0414433256f, 0.0803377107f},
-std::array<float,2>{0.67600143f, 0.704807162f},
-std::array<float,2>{0.89651072f, 0.476117462f},
-std::array<float,2>{0.474527478f, 0.828484476f},
-std::array<float,2>{0.36519438f, 0.374224424f},
-std::array<float,2>{0.756675541f, 0.900755346f},
-std::array<float,2>{0.544874251f, 0.217320755f},
-std::array<float,2>{0.196218252f, 0.547249556f},
-std::array<float,2>{0.0996197388f, 0.261246324f},
-std::array<float,2>{0.715955615f, 0.984585226f},
-std::array<float,2>{0.945433974f, 0.167679757f},
-std::array<float,2>{0.402559787f, 0.59397918f},
-std::array<float,2>{0.280154437f, 0.0226519182f},
-std::array<float,2>{0.831190646f, 0.659196496f},
-std::array<float,2>{0.599957585f, 0.392123073f},
-std::array<float,2>{0.152398497f, 0.800464451f},
-std::array<float,2>{0.228289396f, 0.241894484f},
-std::array<float,2>{0.523898661f, 0.514463425f},
-std::array<float,2>{0.805023789f, 0.313409507f},
-std::array<float,2>{0.330306798f, 0.923012674f},
-std::array<float,2>{0.45550561f, 0.464942068f},
-std::array<float,2>{0.923007727f, 0.868530869f},
-std::array<float,2>{0.642572999f, 0.105077967f},
-std::array<float,2>{0.0265527219f, 0.740613699f},
-std::array<float,2>{0.163818359f, 0.36562115f},
-std::array<float,2>{0.571250796f, 0.891551256f},
-std::array<float,2>{0.863763988f, 0.203398407f},
-std::array<float,2>{0.299531996f, 0.55628103f},
-std::array<float,2>{0.435938865f, 0.0877901837f},
-std::array<float,2>{0.970823526f, 0.716075122f},
-std::array<float,2>{0.727504671f, 0.480630279f},
-std::array<float,2>{0.0912878662f, 0.840952039f},
-std::array<float,2>{0.0502509661f, 0.128372222f},
-std::array<float,2>{0.657856464f, 0.589139819f},
-std::array<float,2>{0.888572037f, 0.297409266f},
-std::array<float,2>{0.498329818f, 0.950452089f},
-std::array<float,2>{0.354310244f, 0.432754636f},
-std::array<float,2>{0.768258095f, 0.760824025f},
-std::array<float,2>{0.547988892f, 0.045838926f},
-std::array<float,2>{0.203932956f, 0.651884437f},
-std::array<float,2>{0.120969601f, 0.459364653f},
-std::array<float,2>{0.70103085f, 0.864298105f},
-std::array<float,2>{0.959683001f, 0.095261313f},
-std::array<float,2>{0.378761381f, 0.7471717f},
-std::array<float,2>{0.265403807f, 0.249712229f},
-std::array<float,2>{0.822949111f, 0.507604718f},
-std::array<float,2>{0.612756133f, 0.327042669f},
-std::array<float,2>{0.137833655f, 0.936715961f},
-std::array<float,2>{0.239367336f, 0.0243053734f},
-std::array<float,2>{0.511660814f, 0.66787374f},
-std::array<float,2>{0.794066787f, 0.398846447f},
-std::array<float,2>{0.318813771f, 0.80701369f},
-std::array<float,2>{0.446896493f, 0.255800247f},
-std::array<float,2>{0.90665549f, 0.994502008f},
-std::array<float,2>{0.632255495f, 0.161670268f},
-std::array<float,2>{0.00135991222f, 0.602854967f},
-std::array<float,2>{0.200821385f, 0.383559108f},
-std::array<float,2>{0.541412532f, 0.791249752f},
-std::array<float,2>{0.751487494f, 0.00293596205f},
-std::array<float,2>{0.362350494f, 0.684810102f},
-std::array<float,2>{0.470305085f, 0.177961692f},
-std::array<float,2>{0.894299269f, 0.614472628f},
-std::array<float,2>{0.675365269f, 0.279698163f},
-std::array<float,2>{0.0466513596f, 0.973849773f},
-std::array<float,2>{0.0696749613f, 0.116624825f},
-std::array<float,2>{0.744303823f, 0.733284593f},
-std::array<float,2>{0.992107928f, 0.440698713f},
-std::array<float,2>{0.407249033f, 0.85222137f},
-std::array<float,2>{0.292329103f, 0.340018451f},
-std::array<float,2>{0.846504807f, 0.915325642f},
-std::array<float,2>{0.593197942f, 0.221803069f},
-std::array<float,2>{0.176275507f, 0.527846038f},
-std::array<float,2>{0.0307453256f, 0.291089922f},
-std::array<float,2>{0.645204246f, 0.956586003f},
-std::array<float,2>{0.929354012f, 0.151981294f},
-std::array<float,2>{0.459276229f, 0.569487929f},
-std::array<float,2>{0.333592713f, 0.0610150695f},
-std::array<float,2>{0.810404122f, 0.635341644f},
-std::array<float,2>{0.531028271f, 0.409975827f},
-std::array<float,2>{0.231687158f, 0.772331238f},
-std::array<float,2>{0.151561067f, 0.197287023f},
-std::array<float,2>{0.594502509f, 0.538840294f},
-std::array<float,2>{0.835196972f, 0.350780576f},
-std::array<float,2>{0.274362981f, 0.879674613f},
-std::array<float,2>{0.399039447f, 0.491385818f},
-std::array<float,2>{0.951323509f, 0.822303712f},
-std::array<float,2>{0.713065982f, 0.0762997121f},
-std::array<float,2>{0.0943548381f, 0.697505116f},
-std::array<float,2>{0.220618278f, 0.268703163f},
-std::array<float,2>{0.51673454f, 0.983188808f},
-std::array<float,2>{0.802566648f, 0.185220405f},
-std::array<float,2>{0.342337161f, 0.617414236f},
-std::array<float,2>{0.464672625f, 0.0117170876f},
-std::array<float,2>{0.935777366f, 0.672645688f},
-std::array<float,2>{0.648723006f, 0.381395489f},
-std::array<float,2>{0.0210857075f, 0.78742069f},
-std::array<float,2>{0.108187333f, 0.228071973f},
-std::array<float,2>{0.707034111f, 0.516882777f},
-std::array<float,2>{0.945026815f, 0.330983937f},
-std::array<float,2>{0.398257673f, 0.910489738f},
-std::array<float,2>{0.271111637f, 0.449721694f},
-std::array<float,2>{0.840255558f, 0.850507617f},
-std::array<float,2>{0.60735625f, 0.11904636f},
-std::array<float,2>{0.145194083f, 0.718943298f},
-std::array<float,2>{0.0338127986f, 0.420701772f},
-std::array<float,2>{0.685165167f, 0.774656236f},
-std::array<float,2>{0.905758142f, 0.0489148125f},
-std::array<float,2>{0.483463615f, 0.630093575f},
-std::array<float,2>{0.368210763f, 0.145641536f},
-std::array<float,2>{0.764218509f, 0.57265532f},
-std::array<float,2>{0.533884048f, 0.288736463f},
-std::array<float,2>{0.189898491f, 0.963955641f},
-std::array<float,2>{0.181544185f, 0.0642542467f},
-std::array<float,2>{0.58110106f, 0.689968169f},
-std::array<float,2>{0.85577333f, 0.496322006f},
-std::array<float,2>{0.285125762f, 0.814300835f},
-std::array<float,2>{0.420714796f, 0.358110666f},
-std::array<float,2>{0.993356645f, 0.886726081f},
-std::array<float,2>{0.739313006f, 0.188227549f},
-std::array<float,2>{0.070487231f, 0.540943384f},
-std::array<float,2>{0.126985192f, 0.470534384f},
-std::array<float,2>{0.621394098f, 0.833988428f},
-std::array<float,2>{0.814823925f, 0.0849604011f},
-std::array<float,2>{0.256238312f, 0.709089816f},
-std::array<float,2>{0.386888772f, 0.211746246f},
-std::array<float,2>{0.961708307f, 0.552095652f},
-std::array<float,2>{0.688092291f, 0.367768794f},
-std::array<float,2>{0.110009834f, 0.902783096f},
-std::array<float,2>{0.00781562366f, 0.0332260691f},
-std::array<float,2>{0.638977826f, 0.646156669f},
-std::array<float,2>{0.914282978f, 0.422708184f},
-std::array<float,2>{0.443033934f, 0.753298163f},
-std::array<float,2>{0.322357267f, 0.312427729f},
-std::array<float,2>{0.783457994f, 0.939950109f},
-std::array<float,2>{0.505195498f, 0.133125111f},
-std::array<float,2>{0.242231354f, 0.584541976f},
-std::array<float,2>{0.0812745169f, 0.317457736f},
-std::array<float,2>{0.722404122f, 0.929294825f},
-std::array<float,2>{0.982281864f, 0.236662745f},
-std::array<float,2>{0.424874365f, 0.508388221f},
-std::array<float,2>{0.308460474f, 0.107157476f},
-std::array<float,2>{0.874962211f, 0.735121429f},
-std::array<float,2>{0.569407344f, 0.461839229f},
-std::array<float,2>{0.171526834f, 0.873610139f},
-std::array<float,2>{0.213252321f, 0.171867847f},
-std::array<float,2>{0.562226415f, 0.600965023f},
-std::array<float,2>{0.776446521f, 0.262456477f},
-std::array<float,2>{0.351064533f, 0.990771472f},
-std::array<float,2>{0.491485715f, 0.395428836f},
-std::array<float,2>{0.879755676f, 0.803042352f},
-std::array<float,2>{0.670194387f, 0.0184718426f},
-std::array<float,2>{0.0608287305f, 0.661221445f},
-std::array<float,2>{0.182625875f, 0.287241459f},
-std::array<float,2>{0.579224825f, 0.962896943f},
-std::array<float,2>{0.858795702f, 0.145090044f},
-std::array<float,2>{0.282876462f, 0.573981225f},
-std::array<float,2>{0.419433504f, 0.0499532111f},
-std::array<float,2>{0.995380878f, 0.629204631f},
-std::array<float,2>{0.740585148f, 0.42148146f},
-std::array<float,2>{0.0736790001f, 0.773607135f},
-std::array<float,2>{0.0324709043f, 0.189207301f},
-std::array<float,2>{0.687420726f, 0.539139211f},
-std::array<float,2>{0.902911127f, 0.358987749f},
-std::array<float,2>{0.481904835f, 0.888488829f},
-std::array<float,2>{0.370657444f, 0.497396857f},
-std::array<float,2>{0.762299836f, 0.813060462f},
-std::array<float,2>{0.531253397f, 0.0630684048f},
-std::array<float,2>{0.188834459f, 0.691023231f},
-std::array<float,2>{0.106273398f, 0.382771313f},
-std::array<float,2>{0.709714413f, 0.788225412f},
-std::array<float,2>{0.943333566f, 0.0100285672f},
-std::array<float,2>{0.39476496f, 0.673550904f},
-std::array<float,2>{0.271535426f, 0.18423894f},
-std::array<float,2>{0.84204489f, 0.618483245f},
-std::array<float,2>{0.609113991f, 0.267650545f},
-std::array<float,2>{0.147084922f, 0.983805835f},
-std::array<float,2>{0.221140862f, 0.117295086f},
-std::array<float,2>{0.518568993f, 0.720357716f},
-std::array<float,2>{0.804149091f, 0.450852007f},
-std::array<float,2>{0.341493875f, 0.851557791f},
-std::array<float,2>{0.461454749f, 0.331190586f},
-std::array<float,2>{0.934808254f, 0.911969423f},
-std::array<float,2>{0.651025891f, 0.227465719f},
-std::array<float,2>{0.0216320232f, 0.516468048f},
-std::array<float,2>{0.212218583f, 0.461914361f},
-std::array<float,2>{0.559885979f, 0.874531746f},
-std::array<float,2>{0.775213778f, 0.105962679f},
-std::array<float,2>{0.348991454f, 0.735459626f},
-std::array<float,2>{0.490231901f, 0.237795442f},
-std::array<float,2>{0.881005824f, 0.509073138f},
-std::array<float,2>{0.669819295f, 0.317035019f},
-std::array<float,2>{0.0592754669f, 0.928683043f},
-std::array<float,2>{0.0783749446f, 0.0186977666f},
-std::array<float,2>{0.718843162f, 0.660679579f},
-std::array<float,2>{0.983322978f, 0.395962954f},
-std::array<float,2>{0.422385633f, 0.804249465f},
-std::array<float,2>{0.306162745f, 0.263210326f},
-std::array<float,2>{0.872844934f, 0.991745591f},
-std::array<float,2>{0.566699028f, 0.170206308f},
-std::array<float,2>{0.169570625f, 0.600529611f},
-std::array<float,2>{0.00982552487f, 0.368337065f},
-std::array<float,2>{0.637705147f, 0.903965652f},
-std::array<float,2>{0.916326463f, 0.212506786f},
-std::array<float,2>{0.444989741f, 0.550826848f},
-std::array<float,2>{0.321738601f, 0.0850707516f},
-std::array<float,2>{0.782097518f, 0.710372508f},
-std::array<float,2>{0.507709384f, 0.469690263f},
-std::array<float,2>{0.245619655f, 0.835758746f},
-std::array<float,2>{0.125330985f, 0.13410756f},
-std::array<float,2>{0.624843419f, 0.58527118f},
-std::array<float,2>{0.813838363f, 0.311349571f},
-std::array<float,2>{0.253977388f, 0.940747976f},
-std::array<float,2>{0.38983807f, 0.422910661f},
-std::array<float,2>{0.964124978f, 0.75197053f},
-std::array<float,2>{0.690870702f, 0.0342871062f},
-std::array<float,2>{0.11134696f, 0.645081818f},
-std::array<float,2>{0.241147488f, 0.327920467f},
-std::array<float,2>{0.508236945f, 0.936205566f},
-std::array<float,2>{0.795389891f, 0.248192236f},
-std::array<float,2>{0.317050695f, 0.506724179f},
-std::array<float,2>{0.448832393f, 0.0939948782f},
-std::array<float,2>{0.909995139f, 0.746211886f},
-std::array<float,2>{0.630300641f, 0.460856289f},
-std::array<float,2>{0.00354539347f, 0.863525271f},
-std::array<float,2>{0.118173018f, 0.160496131f},
-std::array<float,2>{0.701265037f, 0.601637125f},
-std::array<float,2>{0.957279265f, 0.254879802f},
-std::array<float,2>{0.376214921f, 0.995364845f},
-std::array<float,2>{0.263223976f, 0.399439752f},
-std::array<float,2>{0.822025955f, 0.80807966f},
-std::array<float,2>{0.609465837f, 0.0253183953f},
-std::array<float,2>{0.138964638f, 0.666398942f},
-std::array<float,2>{0.0470849797f, 0.482394725f},
-std::array<float,2>{0.659184694f, 0.840126932f},
-std::array<float,2>{0.889446855f, 0.0862122551f},
-std::array<float,2>{0.4962264f, 0.715149164f},
-std::array<float,2>{0.352095395f, 0.204685196f},
-std::array<float,2>{0.766458154f, 0.555070758f},
-std::array<float,2>{0.549840271f, 0.366433233f},
-std::array<float,2>{0.205123693f, 0.891759694f},
-std::array<float,2>{0.160574868f, 0.0468634628f},
-std::array<float,2>{0.573827565f, 0.651129544f},
-std::array<float,2>{0.867001772f, 0.432049751f},
-std::array<float,2>{0.297614336f, 0.760401964f},
-std::array<float,2>{0.435179502f, 0.298479259f},
-std::array<float,2>{0.96893084f, 0.950127125f},
-std::array<float,2>{0.72943747f, 0.127346858f},
-std::array<float,2>{0.0925554931f, 0.588815153f},
-std::array<float,2>{0.149530321f, 0.408390135f},
-std::array<float,2>{0.596539855f, 0.772469938f},
-std::array<float,2>{0.833331525f, 0.0624720342f},
-std::array<float,2>{0.275495082f, 0.636539698f},
-std::array<float,2>{0.401009381f, 0.150962606f},
-std::array<float,2>{0.95020473f, 0.569140553f},
-std::array<float,2>{0.711057842f, 0.292416811f},
-std::array<float,2>{0.0965695456f, 0.955888987f},
-std::array<float,2>{0.0292216353f, 0.0778844208f},
-std::array<float,2>{0.647091031f, 0.699047327f},
-std::array<float,2>{0.92714864f, 0.490426153f},
-std::array<float,2>{0.458250761f, 0.823695779f},
-std::array<float,2>{0.334212303f, 0.350208282f},
-std::array<float,2>{0.811187565f, 0.879966021f},
-std::array<float,2>{0.527382731f, 0.19895485f},
-std::array<float,2>{0.234040856f, 0.537952662f},
-std::array<float,2>{0.0678148717f, 0.280675292f},
-std::array<float,2>{0.742935598f, 0.972820759f},
-std::array<float,2>{0.989166379f, 0.178951949f},
-std::array<float,2>{0.410143852f, 0.613773465f},
-std::array<float,2>{0.289578855f, 0.00288215582f},
-std::array<float,2>{0.844332218f, 0.68390888f},
-std::array<float,2>{0.591475189f, 0.38453123f},
-std::array<float,2>{0.179444522f, 0.792474627f},
-std::array<float,2>{0.202848196f, 0.221199974f},
-std::array<float,2>{0.539230406f, 0.529099941f},
-std::array<float,2>{0.753904521f, 0.341028214f},
-std::array<float,2>{0.360010266f, 0.914689243f},
-std::array<float,2>{0.470799357f, 0.439761072f},
-std::array<float,2>{0.89089191f, 0.85281527f},
-std::array<float,2>{0.67321229f, 0.115718737f},
-std::array<float,2>{0.0438427143f, 0.734348953f},
-std::array<float,2>{0.135669276f, 0.353616953f},
-std::array<float,2>{0.615539074f, 0.883010745f},
-std::array<float,2>{0.82568115f, 0.191782758f},
-std::array<float,2>{0.261104614f, 0.543117881f},
-std::array<float,2>{0.379124433f, 0.0700045601f},
-std::array<float,2>{0.954413652f, 0.694512427f},
-std::array<float,2>{0.696621835f, 0.493576378f},
-std::array<float,2>{0.123089649f, 0.816753387f},
-std::array<float,2>{0.00534932129f, 0.144440934f},
-std::array<float,2>{0.627544165f, 0.57585597f},
-std::array<float,2>{0.913630188f, 0.282955766f},
-std::array<float,2>{0.452055246f, 0.968662322f},
-std::array<float,2>{0.313570619f, 0.415834188f},
-std::array<float,2>{0.791001201f, 0.780978203f},
-std::array<float,2>{0.512390137f, 0.053564176f},
-std::array<float,2>{0.234676167f, 0.625886023f},
-std::array<float,2>{0.0870072395f, 0.445689559f},
-std::array<float,2>{0.732162774f, 0.845992744f},
-std::array<float,2>{0.976495206f, 0.122819073f},
-std::array<float,2>{0.430872023f, 0.723944485f},
-std::array<float,2>{0.30162999f, 0.230534494f},
-std::array<float,2>{0.860676527f, 0.520768285f},
-std::array<float,2>{0.577043891f, 0.332365274f},
-std::array<float,2>{0.159795135f, 0.909241199f},
-std::array<float,2>{0.209080517f, 0.0133340061f},
-std::array<float,2>{0.55091083f, 0.677890658f},
-std::array<float,2>{0.771938026f, 0.378391534f},
-std::array<float,2>{0.359058946f, 0.784526944f},
-std::array<float,2>{0.492381871f, 0.272872776f},
-std::array<float,2>{0.88304764f, 0.978291094f},
-std::array<float,2>{0.661100805f, 0.18235001f},
-std::array<float,2>{0.0546200424f, 0.621978879f},
-std::array<float,2>{0.229905382f, 0.390626669f},
-std::array<float,2>{0.525777936f, 0.799686849f},
-std::array<float,2>{0.807370722f, 0.0217662454f},
-std::array<float,2>{0.32983762f, 0.658691764f},
-std::array<float,2>{0.454738587f, 0.166381016f},
-std::array<float,2>{0.92460227f, 0.595307469f},
-std::array<float,2>{0.642588198f, 0.259885788f},
-std::array<float,2>{0.0249287542f, 0.98554647f},
-std::array<float,2>{0.0995496362f, 0.104328193f},
-std::array<float,2>{0.717153192f, 0.742013395f},
-std::array<float,2>{0.948643148f, 0.466382205f},
-std::array<float,2>{0.405065417f, 0.867379308f},
-std::array<float,2>{0.279165655f, 0.313529909f},
-std::array<float,2>{0.828900635f, 0.922561705f},
-std::array<float,2>{0.598709404f, 0.240948454f},
-std::array<float,2>{0.155656278f, 0.515163839f},
-std::array<float,2>{0.0395430438f, 0.30530858f},
-std::array<float,2>{0.678380251f, 0.945158303f},
-std::array<float,2>{0.895049989f, 0.140261233f},
-std::array<float,2>{0.475366354f, 0.578131318f},
-std::array<float,2>{0.366926044f, 0.038789276f},
-std::array<float,2>{0.754424512f, 0.641398311f},
-std::array<float,2>{0.545663178f, 0.429569215f},
-std::array<float,2>{0.198969066f, 0.755097091f},
-std::array<float,2>{0.173503846f, 0.218532398f},
-std::array<float,2>{0.587411702f, 0.548710525f},
-std::array<float,2>{0.851174593f, 0.373371035f},
-std::array<float,2>{0.294637203f, 0.901482224f},
-std::array<float,2>{0.41140449f, 0.474923909f},
-std::array<float,2>{0.986382782f, 0.829573154f},
-std::array<float,2>{0.746383309f, 0.0815136209f},
-std::array<float,2>{0.0653320104f, 0.703923464f},
-std::array<float,2>{0.193273753f, 0.252877861f},
-std::array<float,2>{0.53798753f, 0.996574402f},
-std::array<float,2>{0.757964194f, 0.159035534f},
-std::array<float,2>{0.373597473f, 0.607174277f},
-std::array<float,2>{0.479598969f, 0.0301284529f},
-std::array<float,2>{0.901125789f, 0.671237648f},
-std::array<float,2>{0.68023634f, 0.40462485f},
-std::array<float,2>{0.0375249162f, 0.811898947f},
-std::array<float,2>{0.0775205791f, 0.242812008f},
-std::array<float,2>{0.734615624f, 0.501671016f},
-std::array<float,2>{0.997482836f, 0.323061138f},
-std::array<float,2>{0.416307271f, 0.93013984f},
-std::array<float,2>{0.288405776f, 0.453215301f},
-std::array<float,2>{0.854563534f, 0.863160253f},
-std::array<float,2>{0.582107544f, 0.0988154635f},
-std::array<float,2>{0.184377983f, 0.744309664f},
-std::array<float,2>{0.016602071f, 0.43519485f},
-std::array<float,2>{0.65511018f, 0.763408244f},
-std::array<float,2>{0.933575213f, 0.0422312841f},
-std::array<float,2>{0.465716362f, 0.655305922f},
-std::array<float,2>{0.337719321f, 0.129866198f},
-std::array<float,2>{0.800043225f, 0.591847241f},
-std::array<float,2>{0.523047626f, 0.304381192f},
-std::array<float,2>{0.226065502f, 0.947981477f},
-std::array<float,2>{0.143488467f, 0.0911577195f},
-std::array<float,2>{0.603909016f, 0.711153686f},
-std::array<float,2>{0.836134315f, 0.476749599f},
-std::array<float,2>{0.267152458f, 0.83819443f},
-std::array<float,2>{0.392783105f, 0.360682279f},
-std::array<float,2>{0.939481556f, 0.89766711f},
-std::array<float,2>{0.704587221f, 0.210358709f},
-std::array<float,2>{0.105248272f, 0.559355617f},
-std::array<float,2>{0.167628393f, 0.484491915f},
-std::array<float,2>{0.56349808f, 0.825003862f},
-std::array<float,2>{0.86956054f, 0.0710243061f},
-std::array<float,2>{0.310540468f, 0.702684581f},
-std::array<float,2>{0.428166866f, 0.201201916f},
-std::array<float,2>{0.979229987f, 0.532743275f},
-std::array<float,2>{0.723000526f, 0.344301492f},
-std::array<float,2>{0.0840246379f, 0.875920057f},
-std::array<float,2>{0.0556332767f, 0.0578324571f},
-std::array<float,2>{0.66733098f, 0.639248073f},
-std::array<float,2>{0.878666341f, 0.412946135f},
-std::array<float,2>{0.48516655f, 0.769166529f},
-std::array<float,2>{0.34429422f, 0.296486139f},
-std::array<float,2>{0.77761215f, 0.960662782f},
-std::array<float,2>{0.557505727f, 0.153199404f},
-std::array<float,2>{0.215952963f, 0.563361704f},
-std::array<float,2>{0.117157802f, 0.336064816f},
-std::array<float,2>{0.692118227f, 0.918526411f},
-std::array<float,2>{0.968063235f, 0.223105803f},
-std::array<float,2>{0.383786261f, 0.525697827f},
-std::array<float,2>{0.252414912f, 0.110595964f},
-std::array<float,2>{0.817926228f, 0.72874701f},
-std::array<float,2>{0.617556393f, 0.444575459f},
-std::array<float,2>{0.131524369f, 0.857877851f},
-std::array<float,2>{0.247722283f, 0.173525617f},
-std::array<float,2>{0.50107187f, 0.612666309f},
-std::array<float,2>{0.785268545f, 0.277335167f},
-std::array<float,2>{0.326903194f, 0.969949484f},
-std::array<float,2>{0.439641565f, 0.388142526f},
-std::array<float,2>{0.920824587f, 0.795493066f},
-std::array<float,2>{0.635743082f, 0.00483743567f},
-std::array<float,2>{0.013221533f, 0.680995643f},
-std::array<float,2>{0.145420149f, 0.266320825f},
-std::array<float,2>{0.607022107f, 0.98130089f},
-std::array<float,2>{0.839977324f, 0.186883941f},
-std::array<float,2>{0.271472245f, 0.620408714f},
-std::array<float,2>{0.398061126f, 0.00781429932f},
-std::array<float,2>{0.945198596f, 0.674137652f},
-std::array<float,2>{0.707292497f, 0.379363835f},
-std::array<float,2>{0.107981436f, 0.786011994f},
-std::array<float,2>{0.0213271957f, 0.230256155f},
-std::array<float,2>{0.648617923f, 0.517984986f},
-std::array<float,2>{0.935863316f, 0.329547375f},
-std::array<float,2>{0.464373887f, 0.913982928f},
-std::array<float,2>{0.342720896f, 0.452320009f},
-std::array<float,2>{0.802278459f, 0.84913069f},
-std::array<float,2>{0.516923606f, 0.119398281f},
-std::array<float,2>{0.220372289f, 0.722042382f},
-std::array<float,2>{0.070776403f, 0.418904662f},
-std::array<float,2>{0.739723861f, 0.777014136f},
-std::array<float,2>{0.993555307f, 0.0477244258f},
-std::array<float,2>{0.420559883f, 0.631110787f},
-std::array<float,2>{0.284804493f, 0.147709727f},
-std::array<float,2>{0.855470657f, 0.570411325f},
-std::array<float,2>{0.581536531f, 0.286548823f},
-std::array<float,2>{0.181162983f, 0.962546468f},
-std::array<float,2>{0.189525276f, 0.0647994354f},
-std::array<float,2>{0.533937156f, 0.68905288f},
-std::array<float,2>{0.764496922f, 0.49846065f},
-std::array<float,2>{0.368440121f, 0.816003501f},
-std::array<float,2>{0.483783245f, 0.355737537f},
-std::array<float,2>{0.905418098f, 0.889083624f},
-std::array<float,2>{0.685316801f, 0.190257162f},
-std::array<float,2>{0.0339459293f, 0.541043758f},
-std::array<float,2>{0.242450044f, 0.472143352f},
-std::array<float,2>{0.505115449f, 0.832765579f},
-std::array<float,2>{0.783247948f, 0.0839012265f},
-std::array<float,2>{0.322533935f, 0.70714891f},
-std::array<float,2>{0.443140268f, 0.214421943f},
-std::array<float,2>{0.914385796f, 0.554477274f},
-std::array<float,2>{0.638871908f, 0.370273769f},
-std::array<float,2>{0.00828119181f, 0.906210124f},
-std::array<float,2>{0.110150978f, 0.0324186236f},
-std::array<float,2>{0.688243926f, 0.647946656f},
-std::array<float,2>{0.961542785f, 0.424088806f},
-std::array<float,2>{0.387081712f, 0.750162184f},
-std::array<float,2>{0.256045312f, 0.310123384f},
-std::array<float,2>{0.81449002f, 0.938955128f},
-std::array<float,2>{0.621152401f, 0.135560289f},
-std::array<float,2>{0.127254814f, 0.583009124f},
-std::array<float,2>{0.0606887452f, 0.320115238f},
-std::array<float,2>{0.67010498f, 0.927371025f},
-std::array<float,2>{0.879409194f, 0.234763369f},
-std::array<float,2>{0.491417557f, 0.510822833f},
-std::array<float,2>{0.350792438f, 0.107796639f},
-std::array<float,2>{0.776716292f, 0.736484051f},
-std::array<float,2>{0.562469661f, 0.462989628f},
-std::array<float,2>{0.213024393f, 0.871901035f},
-std::array<float,2>{0.171705201f, 0.169496328f},
-std::array<float,2>{0.569608867f, 0.598845243f},
-std::array<float,2>{0.87463063f, 0.265185267f},
-std::array<float,2>{0.308157414f, 0.989245355f},
-std::array<float,2>{0.425208092f, 0.398124218f},
-std::array<float,2>{0.982047021f, 0.802122414f},
-std::array<float,2>{0.722495675f, 0.0163259581f},
-std::array<float,2>{0.0814403966f, 0.662605524f},
-std::array<float,2>{0.203735024f, 0.363320917f},
-std::array<float,2>{0.548101723f, 0.893455863f},
-std::array<float,2>{0.768519819f, 0.205312893f},
-std::array<float,2>{0.354007274f, 0.557039678f},
-std::array<float,2>{0.498190105f, 0.0884563774f},
-std::array<float,2>{0.888196468f, 0.717366576f},
-std::array<float,2>{0.658161819f, 0.484067082f},
-std::array<float,2>{0.0499510057f, 0.842250705f},
-std::array<float,2>{0.0910635144f, 0.125733674f},
-std::array<float,2>{0.727191448f, 0.586812317f},
-std::array<float,2>{0.971074224f, 0.299613446f},
-std::array<float,2>{0.435701907f, 0.951378226f},
-std::array<float,2>{0.299631774f, 0.430941701f},
-std::array<float,2>{0.863467395f, 0.758830547f},
-std::array<float,2>{0.571007311f, 0.0444230996f},
-std::array<float,2>{0.163771376f, 0.649865866f},
-std::array<float,2>{0.00115062343f, 0.458873987f},
-std::array<float,2>{0.63189888f, 0.866311848f},
-std::array<float,2>{0.906319082f, 0.097510837f},
-std::array<float,2>{0.447048694f, 0.748981297f},
-std::array<float,2>{0.318487406f, 0.247247905f},
-std::array<float,2>{0.794411838f, 0.504714966f},
-std::array<float,2>{0.511403799f, 0.326110363f},
-std::array<float,2>{0.23972556f, 0.935471177f},
-std::array<float,2>{0.138089105f, 0.0257470477f},
-std::array<float,2>{0.61237216f, 0.664604545f},
-std::array<float,2>{0.823082387f, 0.401044428f},
-std::array<float,2>{0.265302807f, 0.806394398f},
-std::array<float,2>{0.37858364f, 0.255886108f},
-std::array<float,2>{0.959906638f, 0.993398428f},
-std::array<float,2>{0.700741291f, 0.162297264f},
-std::array<float,2>{0.120795049f, 0.603562176f},
-std::array<float,2>{0.176517025f, 0.386371672f},
-std::array<float,2>{0.592943251f, 0.790153801f},
-std::array<float,2>{0.84641856f, 0.00194323773f},
-std::array<float,2>{0.292030364f, 0.686528802f},
-std::array<float,2>{0.407594949f, 0.176788449f},
-std::array<float,2>{0.991883159f, 0.616921365f},
-std::array<float,2>{0.744567871f, 0.278178632f},
-std::array<float,2>{0.0694870651f, 0.975426078f},
-std::array<float,2>{0.0466116071f, 0.114484422f},
-std::array<float,2>{0.675648272f, 0.731974542f},
-std::array<float,2>{0.894063234f, 0.438148022f},
-std::array<float,2>{0.470666617f, 0.854449093f},
-std::array<float,2>{0.362644166f, 0.342089474f},
-std::array<float,2>{0.751880825f, 0.917956173f},
-std::array<float,2>{0.541217566f, 0.218800649f},
-std::array<float,2>{0.201139942f, 0.529304683f},
-std::array<float,2>{0.0945084915f, 0.290017009f},
-std::array<float,2>{0.713365018f, 0.9531973f},
-std::array<float,2>{0.951610625f, 0.149998352f},
-std::array<float,2>{0.399172813f, 0.567774653f},
-std::array<float,2>{0.274015337f, 0.0600253344f},
-std::array<float,2>{0.835443497f, 0.634310246f},
-std::array<float,2>{0.59444648f, 0.407616168f},
-std::array<float,2>{0.15161705f, 0.769780457f},
-std::array<float,2>{0.231761679f, 0.195762977f},
-std::array<float,2>{0.530808032f, 0.535282612f},
-std::array<float,2>{0.810117126f, 0.349313855f},
-std::array<float,2>{0.333825767f, 0.881819189f},
-std::array<float,2>{0.459091842f, 0.490209877f},
-std::array<float,2>{0.929445982f, 0.821981609f},
-std::array<float,2>{0.645409882f, 0.0743823797f},
-std::array<float,2>{0.0303462762f, 0.697187841f},
-std::array<float,2>{0.156331137f, 0.335161537f},
-std::array<float,2>{0.575058758f, 0.908076167f},
-std::array<float,2>{0.863231242f, 0.233950153f},
-std::array<float,2>{0.304253668f, 0.522601485f},
-std::array<float,2>{0.432043999f, 0.123352222f},
-std::array<float,2>{0.974461496f, 0.726515651f},
-std::array<float,2>{0.732918203f, 0.448805749f},
-std::array<float,2>{0.0893476978f, 0.845060945f},
-std::array<float,2>{0.0524780899f, 0.179943487f},
-std::array<float,2>{0.662337363f, 0.623350918f},
-std::array<float,2>{0.886200964f, 0.270361841f},
-std::array<float,2>{0.495141685f, 0.979176879f},
-std::array<float,2>{0.356969535f, 0.376428366f},
-std::array<float,2>{0.769631565f, 0.78233695f},
-std::array<float,2>{0.552917004f, 0.0142362183f},
-std::array<float,2>{0.208585948f, 0.677331984f},
-std::array<float,2>{0.12195617f, 0.495239377f},
-std::array<float,2>{0.697335243f, 0.818817675f},
-std::array<float,2>{0.956814587f, 0.0680207312f},
-std::array<float,2>{0.38223514f, 0.691437304f},
-std::array<float,2>{0.259194434f, 0.193690434f},
-std::array<float,2>{0.826588452f, 0.546330273f},
-std::array<float,2>{0.614080787f, 0.353334695f},
-std::array<float,2>{0.132853299f, 0.886333287f},
-std::array<float,2>{0.23809655f, 0.0509671457f},
-std::array<float,2>{0.513703942f, 0.627833247f},
-std::array<float,2>{0.792170882f, 0.416924924f},
-std::array<float,2>{0.314832807f, 0.778271079f},
-std::array<float,2>{0.449972868f, 0.283220261f},
-std::array<float,2>{0.911192894f, 0.964991927f},
-std::array<float,2>{0.626933455f, 0.141847327f},
-std::array<float,2>{0.00735796709f, 0.577742636f},
-std::array<float,2>{0.195987523f, 0.427274406f},
-std::array<float,2>{0.544487834f, 0.757389247f},
-std::array<float,2>{0.75646776f, 0.0365684554f},
-std::array<float,2>{0.364934862f, 0.643005908f},
-std::array<float,2>{0.474275917f, 0.137958363f},
-std::array<float,2>{0.896953404f, 0.580259562f},
-std::array<float,2>{0.676266074f, 0.308536381f},
-std::array<float,2>{0.0410947427f, 0.943252087f},
-std::array<float,2>{0.0634609461f, 0.0790486261f},
-std::array<float,2>{0.748451769f, 0.706605494f},
-std::array<float,2>{0.985646069f, 0.472728312f},
-std::array<float,2>{0.412211239f, 0.831248999f},
-std::array<float,2>{0.2952272f, 0.372122705f},
-std::array<float,2>{0.84956044f, 0.898628891f},
-std::array<float,2>{0.5895679f, 0.21504879f},
-std::array<float,2>{0.174934834f, 0.550184071f},
-std::array<float,2>{0.0268531833f, 0.257944643f},
-std::array<float,2>{0.642180443f, 0.988026738f},
-std::array<float,2>{0.92329514f, 0.164294481f},
-std::array<float,2>{0.455310792f, 0.595802128f},
-std::array<float,2>{0.330458224f, 0.0208339747f},
-std::array<float,2>{0.804895937f, 0.657796741f},
-std::array<float,2>{0.523679435f, 0.392778724f},
-std::array<float,2>{0.228122756f, 0.798695862f},
-std::array<float,2>{0.152811393f, 0.239700645f},
-std::array<float,2>{0.599816263f, 0.513409674f},
-std::array<float,2>{0.831308544f, 0.316334605f},
-std::array<float,2>{0.279971391f, 0.925311744f},
-std::array<float,2>{0.402627558f, 0.467770457f},
-std::array<float,2>{0.945570886f, 0.869486868f},
-std::array<float,2>{0.716283441f, 0.103369124f},
-std::array<float,2>{0.100078396f, 0.738589525f},
-std::array<float,2>{0.223836645f, 0.300865382f},
-std::array<float,2>{0.521120012f, 0.946288824f},
-std::array<float,2>{0.798820019f, 0.132243231f},
-std::array<float,2>{0.339521319f, 0.5905568f},
-std::array<float,2>{0.46737203f, 0.0403342918f},
-std::array<float,2>{0.929835618f, 0.652989149f},
-std::array<float,2>{0.653849065f, 0.436736345f},
-std::array<float,2>{0.0181889664f, 0.764466643f},
-std::array<float,2>{0.103326045f, 0.208057135f},
-std::array<float,2>{0.70646733f, 0.560797155f},
-std::array<float,2>{0.938380778f, 0.362346202f},
-std::array<float,2>{0.39214471f, 0.896222293f},
-std::array<float,2>{0.267632842f, 0.478665769f},
-std::array<float,2>{0.839217961f, 0.837335944f},
-std::array<float,2>{0.601709068f, 0.0929359198f},
-std::array<float,2>{0.140861422f, 0.714730859f},
-std::array<float,2>{0.0366001576f, 0.403228611f},
-std::array<float,2>{0.68281126f, 0.809712827f},
-std::array<float,2>{0.899966836f, 0.0277428143f},
-std::array<float,2>{0.477694064f, 0.669347048f},
-std::array<float,2>{0.372990161f, 0.156251207f},
-std::array<float,2>{0.760455728f, 0.608851016f},
-std::array<float,2>{0.536876738f, 0.251855135f},
-std::array<float,2>{0.193892151f, 0.999555767f},
-std::array<float,2>{0.185639113f, 0.100484148f},
-std::array<float,2>{0.584706426f, 0.74379909f},
-std::array<float,2>{0.852863967f, 0.456505746f},
-std::array<float,2>{0.286492586f, 0.86007458f},
-std::array<float,2>{0.415875763f, 0.321565747f},
-std::array<float,2>{0.999713838f, 0.932349145f},
-std::array<float,2>{0.737478256f, 0.245782122f},
-std::array<float,2>{0.0756959021f, 0.503473282f},
-std::array<float,2>{0.130604222f, 0.441981077f},
-std::array<float,2>{0.619404137f, 0.857179224f},
-std::array<float,2>{0.818627298f, 0.111640014f},
-std::array<float,2>{0.251660258f, 0.727438211f},
-std::array<float,2>{0.385626525f, 0.225984454f},
-std::array<float,2>{0.96640873f, 0.524908245f},
-std::array<float,2>{0.694351673f, 0.337968439f},
-std::array<float,2>{0.114660695f, 0.921684682f},
-std::array<float,2>{0.0140165109f, 0.00656517036f},
-std::array<float,2>{0.633774579f, 0.68224448f},
-std::array<float,2>{0.918895721f, 0.389601707f},
-std::array<float,2>{0.4392564f, 0.794660807f},
-std::array<float,2>{0.324713469f, 0.274525583f},
-std::array<float,2>{0.787915707f, 0.971702695f},
-std::array<float,2>{0.503418922f, 0.174352989f},
-std::array<float,2>{0.248480171f, 0.611129522f},
-std::array<float,2>{0.0824017525f, 0.34608683f},
-std::array<float,2>{0.725088358f, 0.877766371f},
-std::array<float,2>{0.977658391f, 0.199417502f},
-std::array<float,2>{0.426258534f, 0.533572674f},
-std::array<float,2>{0.312078744f, 0.0726704374f},
-std::array<float,2>{0.868351877f, 0.700677752f},
-std::array<float,2>{0.565279961f, 0.487774193f},
-std::array<float,2>{0.164416656f, 0.827406585f},
-std::array<float,2>{0.217873603f, 0.155357018f},
-std::array<float,2>{0.554866314f, 0.565578699f},
-std::array<float,2>{0.780004978f, 0.293143511f},
-std::array<float,2>{0.34721753f, 0.958677113f},
-std::array<float,2>{0.486843914f, 0.410908937f},
-std::array<float,2>{0.875837684f, 0.767458975f},
-std::array<float,2>{0.664850354f, 0.0550762787f},
-std::array<float,2>{0.0573720559f, 0.63761121f},
-std::array<float,2>{0.167979434f, 0.263915688f},
-std::array<float,2>{0.5678792f, 0.98979944f},
-std::array<float,2>{0.871468186f, 0.168930739f},
-std::array<float,2>{0.304805666f, 0.598150969f},
-std::array<float,2>{0.423151821f, 0.0171729382f},
-std::array<float,2>{0.984171689f, 0.663996518f},
-std::array<float,2>{0.719729006f, 0.397283196f},
-std::array<float,2>{0.0797386616f, 0.801121294f},
-std::array<float,2>{0.0604498647f, 0.235491976f},
-std::array<float,2>{0.668405533f, 0.509815633f},
-std::array<float,2>{0.882576227f, 0.319069684f},
-std::array<float,2>{0.488299012f, 0.92641145f},
-std::array<float,2>{0.347768515f, 0.464166492f},
-std::array<float,2>{0.774024725f, 0.872113943f},
-std::array<float,2>{0.558953524f, 0.109030411f},
-std::array<float,2>{0.211740091f, 0.737676263f},
-std::array<float,2>{0.112883508f, 0.424967468f},
-std::array<float,2>{0.689649284f, 0.751312673f},
-std::array<float,2>{0.963312685f, 0.0318451598f},
-std::array<float,2>{0.388956875f, 0.646889925f},
-std::array<float,2>{0.255329072f, 0.136415794f},
-std::array<float,2>{0.813350499f, 0.582438648f},
-std::array<float,2>{0.623188734f, 0.309214652f},
-std::array<float,2>{0.12636067f, 0.937671423f},
-std::array<float,2>{0.244564533f, 0.0829014406f},
-std::array<float,2>{0.506818652f, 0.708550692f},
-std::array<float,2>{0.782379746f, 0.470916301f},
-std::array<float,2>{0.32048437f, 0.833780229f},
-std::array<float,2>{0.443914652f, 0.369820356f},
-std::array<float,2>{0.917015195f, 0.905093253f},
-std::array<float,2>{0.636789143f, 0.213229731f},
-std::array<float,2>{0.0109483479f, 0.553587139f},
-std::array<float,2>{0.188170955f, 0.49987027f},
-std::array<float,2>{0.532843471f, 0.814570546f},
-std::array<float,2>{0.763287306f, 0.0655947402f},
-std::array<float,2>{0.370044291f, 0.687902987f},
-std::array<float,2>{0.480484039f, 0.191116989f},
-std::array<float,2>{0.90341872f, 0.542338192f},
-std::array<float,2>{0.68563807f, 0.357327044f},
-std::array<float,2>{0.0313207172f, 0.890557528f},
-std::array<float,2>{0.0732138902f, 0.0486388914f},
-std::array<float,2>{0.742117763f, 0.631897569f},
-std::array<float,2>{0.994345605f, 0.41990301f},
-std::array<float,2>{0.418762654f, 0.775989771f},
-std::array<float,2>{0.281685233f, 0.285221338f},
-std::array<float,2>{0.858072579f, 0.961577058f},
-std::array<float,2>{0.57883215f, 0.146819264f},
-std::array<float,2>{0.182113975f, 0.571328104f},
-std::array<float,2>{0.0225159973f, 0.328368276f},
-std::array<float,2>{0.65224576f, 0.912481964f},
-std::array<float,2>{0.934147477f, 0.228905559f},
-std::array<float,2>{0.462308854f, 0.519490004f},
-std::array<float,2>{0.340409666f, 0.120229617f},
-std::array<float,2>{0.802868426f, 0.721642971f},
-std::array<float,2>{0.517745197f, 0.451516747f},
-std::array<float,2>{0.221987963f, 0.848334551f},
-std::array<float,2>{0.147856787f, 0.185593814f},
-std::array<float,2>{0.607669413f, 0.619812727f},
-std::array<float,2>{0.843511999f, 0.266625285f},
-std::array<float,2>{0.273326397f, 0.981972456f},
-std::array<float,2>{0.396352261f, 0.380841523f},
-std::array<float,2>{0.942136645f, 0.786451042f},
-std::array<float,2>{0.71075201f, 0.00885877293f},
-std::array<float,2>{0.107299872f, 0.675620377f},
-std::array<float,2>{0.233232707f, 0.347970515f},
-std::array<float,2>{0.528365254f, 0.88192302f},
-std::array<float,2>{0.812186897f, 0.197055861f},
-std::array<float,2>{0.335214555f, 0.536417425f},
-std::array<float,2>{0.457557678f, 0.0759455636f},
-std::array<float,2>{0.926443636f, 0.69613111f},
-std::array<float,2>{0.647948682f, 0.488765061f},
-std::array<float,2>{0.0282437205f, 0.821198523f},
-std::array<float,2>{0.0973738879f, 0.14895305f},
-std::array<float,2>{0.711986542f, 0.566505909f},
-std::array<float,2>{0.949890554f, 0.290639639f},
-std::array<float,2>{0.402329803f, 0.9549793f},
-std::array<float,2>{0.277000904f, 0.406440407f},
-std::array<float,2>{0.832707942f, 0.770778954f},
-std::array<float,2>{0.597599506f, 0.0586759299f},
-std::array<float,2>{0.149280012f, 0.633167386f},
-std::array<float,2>{0.0443515591f, 0.439266533f},
-std::array<float,2>{0.672840178f, 0.854978323f},
-std::array<float,2>{0.892366529f, 0.114195406f},
-std::array<float,2>{0.471864909f, 0.730599284f},
-std::array<float,2>{0.360625982f, 0.220125794f},
-std::array<float,2>{0.752378166f, 0.531147361f},
-std::array<float,2>{0.54083699f, 0.342825323f},
-std::array<float,2>{0.201616913f, 0.916387796f},
-std::array<float,2>{0.178616688f, 4.15235372e-05f},
-std::array<float,2>{0.590388417f, 0.685696065f},
-std::array<float,2>{0.84481287f, 0.385391533f},
-std::array<float,2>{0.290446639f, 0.789338291f},
-std::array<float,2>{0.408852667f, 0.278707564f},
-std::array<float,2>{0.989387274f, 0.976154745f},
-std::array<float,2>{0.743360162f, 0.176476493f},
-std::array<float,2>{0.0667504594f, 0.616043091f},
-std::array<float,2>{0.14059718f, 0.402234018f},
-std::array<float,2>{0.611106515f, 0.804930985f},
-std::array<float,2>{0.820374548f, 0.0270482562f},
-std::array<float,2>{0.26210618f, 0.665528655f},
-std::array<float,2>{0.37583521f, 0.163157642f},
-std::array<float,2>{0.95811975f, 0.605425179f},
-std::array<float,2>{0.702165127f, 0.256988049f},
-std::array<float,2>{0.117486462f, 0.992212296f},
-std::array<float,2>{0.0026454241f, 0.0961397812f},
-std::array<float,2>{0.629194379f, 0.749262512f},
-std::array<float,2>{0.90870899f, 0.457442313f},
-std::array<float,2>{0.447382748f, 0.865492046f},
-std::array<float,2>{0.317958921f, 0.324739754f},
-std::array<float,2>{0.796117246f, 0.934047163f},
-std::array<float,2>{0.508835375f, 0.246854857f},
-std::array<float,2>{0.242134154f, 0.505781233f},
-std::array<float,2>{0.0930149332f, 0.299837112f},
-std::array<float,2>{0.729516983f, 0.952368438f},
-std::array<float,2>{0.969753206f, 0.12672019f},
-std::array<float,2>{0.4343808f, 0.587315798f},
-std::array<float,2>{0.298228025f, 0.0437990502f},
-std::array<float,2>{0.866108179f, 0.648513794f},
-std::array<float,2>{0.572645366f, 0.430217654f},
-std::array<float,2>{0.16193065f, 0.758569121f},
-std::array<float,2>{0.206277177f, 0.206281811f},
-std::array<float,2>{0.549280226f, 0.557634592f},
-std::array<float,2>{0.766837358f, 0.365093827f},
-std::array<float,2>{0.353506416f, 0.893629909f},
-std::array<float,2>{0.497524589f, 0.482799143f},
-std::array<float,2>{0.889848888f, 0.843259454f},
-std::array<float,2>{0.65881753f, 0.089747563f},
-std::array<float,2>{0.0486802235f, 0.718077779f},
-std::array<float,2>{0.155210793f, 0.315160096f},
-std::array<float,2>{0.598493516f, 0.924573064f},
-std::array<float,2>{0.829784095f, 0.2383378f},
-std::array<float,2>{0.277632296f, 0.512654126f},
-std::array<float,2>{0.405709982f, 0.102476425f},
-std::array<float,2>{0.947765291f, 0.739850938f},
-std::array<float,2>{0.718070507f, 0.468534768f},
-std::array<float,2>{0.0985514224f, 0.870836198f},
-std::array<float,2>{0.0236729551f, 0.165804729f},
-std::array<float,2>{0.643659174f, 0.597627282f},
-std::array<float,2>{0.9256832f, 0.259292692f},
-std::array<float,2>{0.453312427f, 0.987295747f},
-std::array<float,2>{0.329050809f, 0.394327313f},
-std::array<float,2>{0.807907939f, 0.797489822f},
-std::array<float,2>{0.52680397f, 0.0196689926f},
-std::array<float,2>{0.228636712f, 0.656705916f},
-std::array<float,2>{0.0662464797f, 0.474485695f},
-std::array<float,2>{0.747126281f, 0.830780923f},
-std::array<float,2>{0.988103271f, 0.0792857334f},
-std::array<float,2>{0.410808623f, 0.705903292f},
-std::array<float,2>{0.293546975f, 0.215973198f},
-std::array<float,2>{0.850249708f, 0.5489887f},
-std::array<float,2>{0.586103916f, 0.371437609f},
-std::array<float,2>{0.172325045f, 0.899620533f},
-std::array<float,2>{0.197329611f, 0.0354894511f},
-std::array<float,2>{0.546210885f, 0.644044101f},
-std::array<float,2>{0.755102932f, 0.426353395f},
-std::array<float,2>{0.366197258f, 0.756723106f},
-std::array<float,2>{0.47588852f, 0.307450652f},
-std::array<float,2>{0.896270812f, 0.941813707f},
-std::array<float,2>{0.678737223f, 0.13723354f},
-std::array<float,2>{0.0403728522f, 0.58168751f},
-std::array<float,2>{0.236237884f, 0.41752094f},
-std::array<float,2>{0.513368189f, 0.778526604f},
-std::array<float,2>{0.789718509f, 0.0522121042f},
-std::array<float,2>{0.312891632f, 0.628721893f},
-std::array<float,2>{0.452196211f, 0.140878871f},
-std::array<float,2>{0.91220063f, 0.57701242f},
-std::array<float,2>{0.627938271f, 0.284493476f},
-std::array<float,2>{0.0040914705f, 0.966201425f},
-std::array<float,2>{0.124060579f, 0.0668085143f},
-std::array<float,2>{0.696048677f, 0.692937851f},
-std::array<float,2>{0.953495443f, 0.494245231f},
-std::array<float,2>{0.380070537f, 0.820214331f},
-std::array<float,2>{0.260616541f, 0.352095008f},
-std::array<float,2>{0.824720442f, 0.885071814f},
-std::array<float,2>{0.617121637f, 0.195088565f},
-std::array<float,2>{0.135907933f, 0.545674801f},
-std::array<float,2>{0.0528327785f, 0.271317452f},
-std::array<float,2>{0.661162972f, 0.980194449f},
-std::array<float,2>{0.884264112f, 0.181399107f},
-std::array<float,2>{0.493688256f, 0.62475884f},
-std::array<float,2>{0.35791862f, 0.0146650206f},
-std::array<float,2>{0.772712588f, 0.675787091f},
-std::array<float,2>{0.551836014f, 0.375908136f},
-std::array<float,2>{0.210937172f, 0.782019258f},
-std::array<float,2>{0.15833883f, 0.233011097f},
-std::array<float,2>{0.578045487f, 0.522255599f},
-std::array<float,2>{0.859810948f, 0.33488521f},
-std::array<float,2>{0.302503645f, 0.907063782f},
-std::array<float,2>{0.429793775f, 0.447414607f},
-std::array<float,2>{0.975574136f, 0.844203055f},
-std::array<float,2>{0.731191456f, 0.124767207f},
-std::array<float,2>{0.085965462f, 0.724712551f},
-std::array<float,2>{0.215687945f, 0.294402063f},
-std::array<float,2>{0.558540285f, 0.957607269f},
-std::array<float,2>{0.778859556f, 0.155246079f},
-std::array<float,2>{0.345606208f, 0.565162897f},
-std::array<float,2>{0.486099154f, 0.0560793579f},
-std::array<float,2>{0.877547264f, 0.63790369f},
-std::array<float,2>{0.666680634f, 0.411661744f},
-std::array<float,2>{0.0558915399f, 0.766058385f},
-std::array<float,2>{0.0851285532f, 0.201131135f},
-std::array<float,2>{0.724383831f, 0.534736931f},
-std::array<float,2>{0.980165362f, 0.346770734f},
-std::array<float,2>{0.429074138f, 0.878380358f},
-std::array<float,2>{0.308688819f, 0.487294406f},
-std::array<float,2>{0.870280087f, 0.826443136f},
-std::array<float,2>{0.563303113f, 0.0739718676f},
-std::array<float,2>{0.166848436f, 0.699400663f},
-std::array<float,2>{0.0126493135f, 0.389675438f},
-std::array<float,2>{0.635019362f, 0.793493867f},
-std::array<float,2>{0.921783864f, 0.00697859004f},
-std::array<float,2>{0.441300511f, 0.683034003f},
-std::array<float,2>{0.327671736f, 0.175351813f},
-std::array<float,2>{0.786919713f, 0.61018616f},
-std::array<float,2>{0.500793099f, 0.27403453f},
-std::array<float,2>{0.246549189f, 0.970960677f},
-std::array<float,2>{0.131847769f, 0.113184616f},
-std::array<float,2>{0.618415773f, 0.72772193f},
-std::array<float,2>{0.816825032f, 0.442440808f},
-std::array<float,2>{0.253028184f, 0.85584116f},
-std::array<float,2>{0.384352326f, 0.339308888f},
-std::array<float,2>{0.966981113f, 0.920325696f},
-std::array<float,2>{0.693175197f, 0.224659681f},
-std::array<float,2>{0.115793996f, 0.523996413f},
-std::array<float,2>{0.184878349f, 0.455615073f},
-std::array<float,2>{0.583618701f, 0.860689402f},
-std::array<float,2>{0.854074955f, 0.101357855f},
-std::array<float,2>{0.287495136f, 0.743040562f},
-std::array<float,2>{0.417496085f, 0.244816199f},
-std::array<float,2>{0.996887803f, 0.50231272f},
-std::array<float,2>{0.735757113f, 0.320410639f},
-std::array<float,2>{0.0770132765f, 0.933453143f},
-std::array<float,2>{0.0388875566f, 0.028646091f},
-std::array<float,2>{0.681532085f, 0.668057203f},
-std::array<float,2>{0.901760161f, 0.404203773f},
-std::array<float,2>{0.479103982f, 0.809487343f},
-std::array<float,2>{0.37442407f, 0.250794411f},
-std::array<float,2>{0.759382725f, 0.998749614f},
-std::array<float,2>{0.538463712f, 0.15734686f},
-std::array<float,2>{0.191925198f, 0.607782781f},
-std::array<float,2>{0.103651278f, 0.361774802f},
-std::array<float,2>{0.703760207f, 0.8948735f},
-std::array<float,2>{0.940926611f, 0.207478076f},
-std::array<float,2>{0.394426107f, 0.562467575f},
-std::array<float,2>{0.2660124f, 0.0920799747f},
-std::array<float,2>{0.83744961f, 0.713221192f},
-std::array<float,2>{0.604838014f, 0.479896873f},
-std::array<float,2>{0.143751144f, 0.836767614f},
-std::array<float,2>{0.224855617f, 0.131787822f},
-std::array<float,2>{0.522446036f, 0.591537058f},
-std::array<float,2>{0.799148917f, 0.302274913f},
-std::array<float,2>{0.336191237f, 0.946348786f},
-std::array<float,2>{0.465929687f, 0.435985684f},
-std::array<float,2>{0.932234168f, 0.765195727f},
-std::array<float,2>{0.656154275f, 0.0393261313f},
-std::array<float,2>{0.0158467926f, 0.653765261f},
-std::array<float,2>{0.128394306f, 0.311582714f},
-std::array<float,2>{0.622437537f, 0.939890146f},
-std::array<float,2>{0.816139638f, 0.133710384f},
-std::array<float,2>{0.257430583f, 0.584394336f},
-std::array<float,2>{0.388269275f, 0.0337264389f},
-std::array<float,2>{0.962036908f, 0.645746768f},
-std::array<float,2>{0.689095736f, 0.422231078f},
-std::array<float,2>{0.110810578f, 0.753520906f},
-std::array<float,2>{0.00928540342f, 0.211174324f},
-std::array<float,2>{0.639662385f, 0.552544117f},
-std::array<float,2>{0.915385902f, 0.36723116f},
-std::array<float,2>{0.441472828f, 0.902928889f},
-std::array<float,2>{0.323768675f, 0.470095307f},
-std::array<float,2>{0.784534812f, 0.834588706f},
-std::array<float,2>{0.504660487f, 0.0842011198f},
-std::array<float,2>{0.244138435f, 0.709854722f},
-std::array<float,2>{0.0805043876f, 0.394942939f},
-std::array<float,2>{0.721268058f, 0.803533912f},
-std::array<float,2>{0.981434464f, 0.0179740619f},
-std::array<float,2>{0.423841476f, 0.6619789f},
-std::array<float,2>{0.306811094f, 0.171278298f},
-std::array<float,2>{0.873948038f, 0.601544917f},
-std::array<float,2>{0.568487763f, 0.261969894f},
-std::array<float,2>{0.170305073f, 0.990491867f},
-std::array<float,2>{0.214525729f, 0.106584869f},
-std::array<float,2>{0.5611642f, 0.734820783f},
-std::array<float,2>{0.776211619f, 0.461203307f},
-std::array<float,2>{0.350245655f, 0.873293817f},
-std::array<float,2>{0.490876496f, 0.318328977f},
-std::array<float,2>{0.880359948f, 0.92911613f},
-std::array<float,2>{0.671715856f, 0.236832708f},
-std::array<float,2>{0.0615449883f, 0.508053362f},
-std::array<float,2>{0.218836814f, 0.449671179f},
-std::array<float,2>{0.516036749f, 0.850059986f},
-std::array<float,2>{0.801600099f, 0.118168071f},
-std::array<float,2>{0.343378901f, 0.719370544f},
-std::array<float,2>{0.463581085f, 0.227687895f},
-std::array<float,2>{0.937205613f, 0.517187178f},
-std::array<float,2>{0.649849713f, 0.330406338f},
-std::array<float,2>{0.0201429613f, 0.911022127f},
-std::array<float,2>{0.108658388f, 0.0110930949f},
-std::array<float,2>{0.708455563f, 0.672349989f},
-std::array<float,2>{0.944080949f, 0.381284505f},
-std::array<float,2>{0.396601796f, 0.788065076f},
-std::array<float,2>{0.270035744f, 0.269149542f},
-std::array<float,2>{0.841713071f, 0.982458413f},
-std::array<float,2>{0.60639292f, 0.185015336f},
-std::array<float,2>{0.145618856f, 0.617859244f},
-std::array<float,2>{0.035132546f, 0.357826591f},
-std::array<float,2>{0.684237778f, 0.887264132f},
-std::array<float,2>{0.904346287f, 0.187823623f},
-std::array<float,2>{0.482716173f, 0.540388346f},
-std::array<float,2>{0.367314011f, 0.0636319369f},
-std::array<float,2>{0.764876842f, 0.689679325f},
-std::array<float,2>{0.535030365f, 0.496766031f},
-std::array<float,2>{0.190883905f, 0.813625276f},
-std::array<float,2>{0.180259392f, 0.146422505f},
-std::array<float,2>{0.580646157f, 0.572849274f},
-std::array<float,2>{0.856858075f, 0.288299322f},
-std::array<float,2>{0.283821851f, 0.964621305f},
-std::array<float,2>{0.421809167f, 0.420364946f},
-std::array<float,2>{0.992825329f, 0.7751441f},
-std::array<float,2>{0.738898575f, 0.0497636236f},
-std::array<float,2>{0.0713990852f, 0.630694151f},
-std::array<float,2>{0.199873775f, 0.340494454f},
-std::array<float,2>{0.542263925f, 0.915790915f},
-std::array<float,2>{0.750623226f, 0.222208396f},
-std::array<float,2>{0.361903965f, 0.527641177f},
-std::array<float,2>{0.469254166f, 0.116960801f},
-std::array<float,2>{0.892579317f, 0.732622504f},
-std::array<float,2>{0.674712539f, 0.440925568f},
-std::array<float,2>{0.0454242751f, 0.851620376f},
-std::array<float,2>{0.0683674514f, 0.178459689f},
-std::array<float,2>{0.745182991f, 0.614832103f},
-std::array<float,2>{0.990534902f, 0.280029923f},
-std::array<float,2>{0.406970352f, 0.974225938f},
-std::array<float,2>{0.291510373f, 0.382913768f},
-std::array<float,2>{0.847388268f, 0.791712701f},
-std::array<float,2>{0.591879785f, 0.0035200601f},
-std::array<float,2>{0.17771551f, 0.685274065f},
-std::array<float,2>{0.0293911584f, 0.492113858f},
-std::array<float,2>{0.645974517f, 0.822918236f},
-std::array<float,2>{0.928039849f, 0.0768122226f},
-std::array<float,2>{0.460084826f, 0.698212266f},
-std::array<float,2>{0.332538158f, 0.197821423f},
-std::array<float,2>{0.808875561f, 0.538277626f},
-std::array<float,2>{0.5294801f, 0.351225704f},
-std::array<float,2>{0.230875224f, 0.879322171f},
-std::array<float,2>{0.151342601f, 0.0610717796f},
-std::array<float,2>{0.595612884f, 0.635106444f},
-std::array<float,2>{0.834781945f, 0.409537941f},
-std::array<float,2>{0.274468958f, 0.771627784f},
-std::array<float,2>{0.399823844f, 0.291577458f},
-std::array<float,2>{0.95220983f, 0.956381083f},
-std::array<float,2>{0.713944793f, 0.151505664f},
-std::array<float,2>{0.0951386765f, 0.570184767f},
-std::array<float,2>{0.162794769f, 0.433282077f},
-std::array<float,2>{0.571618974f, 0.761397064f},
-std::array<float,2>{0.864905715f, 0.0450366922f},
-std::array<float,2>{0.30035916f, 0.651379108f},
-std::array<float,2>{0.437266916f, 0.128443033f},
-std::array<float,2>{0.971689939f, 0.58950597f},
-std::array<float,2>{0.72832799f, 0.297087103f},
-std::array<float,2>{0.0902535394f, 0.951038301f},
-std::array<float,2>{0.0497284792f, 0.0873768702f},
-std::array<float,2>{0.656554699f, 0.716717958f},
-std::array<float,2>{0.886918068f, 0.481222302f},
-std::array<float,2>{0.499909192f, 0.841607988f},
-std::array<float,2>{0.354704499f, 0.365760803f},
-std::array<float,2>{0.768717051f, 0.890639484f},
-std::array<float,2>{0.547436357f, 0.203915104f},
-std::array<float,2>{0.20427525f, 0.555694103f},
-std::array<float,2>{0.119200431f, 0.255181193f},
-std::array<float,2>{0.699293673f, 0.994935036f},
-std::array<float,2>{0.960087359f, 0.161226273f},
-std::array<float,2>{0.377180427f, 0.603360415f},
-std::array<float,2>{0.263821006f, 0.0239230413f},
-std::array<float,2>{0.823424876f, 0.667168438f},
-std::array<float,2>{0.611813605f, 0.399239331f},
-std::array<float,2>{0.137280956f, 0.807434738f},
-std::array<float,2>{0.239136383f, 0.249217555f},
-std::array<float,2>{0.509932458f, 0.507021487f},
-std::array<float,2>{0.793504834f, 0.326469749f},
-std::array<float,2>{0.319762498f, 0.937014043f},
-std::array<float,2>{0.445567667f, 0.459869087f},
-std::array<float,2>{0.907534659f, 0.864764631f},
-std::array<float,2>{0.631062448f, 0.0949800909f},
-std::array<float,2>{0.000304307672f, 0.747621f},
-std::array<float,2>{0.174371257f, 0.374511927f},
-std::array<float,2>{0.58850491f, 0.901034772f},
-std::array<float,2>{0.848515093f, 0.217050388f},
-std::array<float,2>{0.296104431f, 0.547458589f},
-std::array<float,2>{0.413974941f, 0.0809168369f},
-std::array<float,2>{0.985117197f, 0.704219043f},
-std::array<float,2>{0.749478519f, 0.475903541f},
-std::array<float,2>{0.0642368048f, 0.829047501f},
-std::array<float,2>{0.0425851345f, 0.139374956f},
-std::array<float,2>{0.677100837f, 0.579141557f},
-std::array<float,2>{0.89793092f, 0.306371093f},
-std::array<float,2>{0.472811311f, 0.94423753f},
-std::array<float,2>{0.363945216f, 0.427768528f},
-std::array<float,2>{0.757524073f, 0.754573226f},
-std::array<float,2>{0.543550909f, 0.0373120271f},
-std::array<float,2>{0.196825445f, 0.642465413f},
-std::array<float,2>{0.101263307f, 0.465811431f},
-std::array<float,2>{0.715682149f, 0.869095206f},
-std::array<float,2>{0.946734369f, 0.104636848f},
-std::array<float,2>{0.403782994f, 0.74101299f},
-std::array<float,2>{0.280896455f, 0.241661996f},
-std::array<float,2>{0.830432534f, 0.513913512f},
-std::array<float,2>{0.601520061f, 0.312590778f},
-std::array<float,2>{0.153762341f, 0.923542738f},
-std::array<float,2>{0.227198392f, 0.0232258346f},
-std::array<float,2>{0.525383353f, 0.660081208f},
-std::array<float,2>{0.806026697f, 0.39190799f},
-std::array<float,2>{0.331248999f, 0.799826205f},
-std::array<float,2>{0.456145823f, 0.261229098f},
-std::array<float,2>{0.922819078f, 0.984974265f},
-std::array<float,2>{0.641567945f, 0.16740115f},
-std::array<float,2>{0.0255225264f, 0.594696224f},
-std::array<float,2>{0.207962483f, 0.377669901f},
-std::array<float,2>{0.55453974f, 0.783798993f},
-std::array<float,2>{0.77147907f, 0.0125157163f},
-std::array<float,2>{0.356033206f, 0.678727567f},
-std::array<float,2>{0.494702756f, 0.183305204f},
-std::array<float,2>{0.885597289f, 0.622652173f},
-std::array<float,2>{0.663124621f, 0.272118866f},
-std::array<float,2>{0.0514973328f, 0.977207363f},
-std::array<float,2>{0.0885536745f, 0.121465012f},
-std::array<float,2>{0.733771265f, 0.722811222f},
-std::array<float,2>{0.9734025f, 0.446635783f},
-std::array<float,2>{0.43314755f, 0.847590685f},
-std::array<float,2>{0.302785248f, 0.333544582f},
-std::array<float,2>{0.861938894f, 0.908500552f},
-std::array<float,2>{0.575488329f, 0.232324809f},
-std::array<float,2>{0.157953769f, 0.519641161f},
-std::array<float,2>{0.00598915247f, 0.281466961f},
-std::array<float,2>{0.625119686f, 0.966901898f},
-std::array<float,2>{0.910344601f, 0.143539518f},
-std::array<float,2>{0.450715482f, 0.574668944f},
-std::array<float,2>{0.315766484f, 0.0539847687f},
-std::array<float,2>{0.791522324f, 0.626060128f},
-std::array<float,2>{0.515584648f, 0.414335579f},
-std::array<float,2>{0.236801103f, 0.779644012f},
-std::array<float,2>{0.134432837f, 0.192506343f},
-std::array<float,2>{0.614590526f, 0.544154048f},
-std::array<float,2>{0.828082025f, 0.354938954f},
-std::array<float,2>{0.25781396f, 0.883827269f},
-std::array<float,2>{0.381158441f, 0.492493987f},
-std::array<float,2>{0.955352664f, 0.817599535f},
-std::array<float,2>{0.698325098f, 0.0683727041f},
-std::array<float,2>{0.12269675f, 0.694124043f},
-std::array<float,2>{0.249670967f, 0.27550137f},
-std::array<float,2>{0.502410233f, 0.969231963f},
-std::array<float,2>{0.788178921f, 0.172442511f},
-std::array<float,2>{0.325678557f, 0.612213731f},
-std::array<float,2>{0.438372582f, 0.0049659498f},
-std::array<float,2>{0.919678748f, 0.679950297f},
-std::array<float,2>{0.63383621f, 0.386931807f},
-std::array<float,2>{0.0153484903f, 0.796068072f},
-std::array<float,2>{0.113564789f, 0.223911166f},
-std::array<float,2>{0.693905473f, 0.526780725f},
-std::array<float,2>{0.965713918f, 0.337307721f},
-std::array<float,2>{0.386569738f, 0.919901013f},
-std::array<float,2>{0.250535071f, 0.443941474f},
-std::array<float,2>{0.819524646f, 0.858471513f},
-std::array<float,2>{0.620406628f, 0.109744705f},
-std::array<float,2>{0.129533917f, 0.729737341f},
-std::array<float,2>{0.0579029694f, 0.413920254f},
-std::array<float,2>{0.665476263f, 0.767774642f},
-std::array<float,2>{0.87644136f, 0.0570413433f},
-std::array<float,2>{0.487847388f, 0.639745533f},
-std::array<float,2>{0.346111447f, 0.15367198f},
-std::array<float,2>{0.780965865f, 0.564299226f},
-std::array<float,2>{0.555700719f, 0.295113534f},
-std::array<float,2>{0.216858193f, 0.959469378f},
-std::array<float,2>{0.165096253f, 0.0715105459f},
-std::array<float,2>{0.565690935f, 0.701175869f},
-std::array<float,2>{0.867525995f, 0.486283422f},
-std::array<float,2>{0.311413407f, 0.825361669f},
-std::array<float,2>{0.427669525f, 0.345353544f},
-std::array<float,2>{0.97669208f, 0.876519918f},
-std::array<float,2>{0.725706816f, 0.202266783f},
-std::array<float,2>{0.0838960111f, 0.531746805f},
-std::array<float,2>{0.142437473f, 0.47802639f},
-std::array<float,2>{0.602674067f, 0.839288473f},
-std::array<float,2>{0.838420808f, 0.0902098864f},
-std::array<float,2>{0.269065231f, 0.712793767f},
-std::array<float,2>{0.391190767f, 0.209798947f},
-std::array<float,2>{0.938880801f, 0.559933007f},
-std::array<float,2>{0.705190182f, 0.360028714f},
-std::array<float,2>{0.101670153f, 0.896661341f},
-std::array<float,2>{0.0195172951f, 0.0417953394f},
-std::array<float,2>{0.652890027f, 0.654720306f},
-std::array<float,2>{0.931314886f, 0.434253126f},
-std::array<float,2>{0.468045741f, 0.761846602f},
-std::array<float,2>{0.338276803f, 0.303402334f},
-std::array<float,2>{0.797175407f, 0.948309362f},
-std::array<float,2>{0.519700706f, 0.129924193f},
-std::array<float,2>{0.223037913f, 0.593685806f},
-std::array<float,2>{0.0750764385f, 0.324149042f},
-std::array<float,2>{0.737027764f, 0.931226552f},
-std::array<float,2>{0.998934388f, 0.243908077f},
-std::array<float,2>{0.414689302f, 0.500523746f},
-std::array<float,2>{0.286014557f, 0.0985905528f},
-std::array<float,2>{0.852045834f, 0.745699048f},
-std::array<float,2>{0.585001051f, 0.454263836f},
-std::array<float,2>{0.187139615f, 0.861421287f},
-std::array<float,2>{0.194617108f, 0.160078198f},
-std::array<float,2>{0.535455883f, 0.605628788f},
-std::array<float,2>{0.760981619f, 0.253406495f},
-std::array<float,2>{0.371959239f, 0.997844219f},
-std::array<float,2>{0.476936787f, 0.40527752f},
-std::array<float,2>{0.899235725f, 0.810989618f},
-std::array<float,2>{0.682396233f, 0.0312464256f},
-std::array<float,2>{0.0352220908f, 0.670721352f},
-std::array<float,2>{0.161358416f, 0.297821045f},
-std::array<float,2>{0.572933674f, 0.950425386f},
-std::array<float,2>{0.86543262f, 0.128087759f},
-std::array<float,2>{0.298391223f, 0.588979602f},
-std::array<float,2>{0.433801591f, 0.0454796217f},
-std::array<float,2>{0.970602214f, 0.652178645f},
-std::array<float,2>{0.730107427f, 0.433089614f},
-std::array<float,2>{0.093430154f, 0.761056781f},
-std::array<float,2>{0.0482938625f, 0.203356773f},
-std::array<float,2>{0.658287406f, 0.5564816f},
-std::array<float,2>{0.890536785f, 0.365360588f},
-std::array<float,2>{0.49794811f, 0.8913486f},
-std::array<float,2>{0.352772832f, 0.480823368f},
-std::array<float,2>{0.767110884f, 0.841211379f},
-std::array<float,2>{0.549771488f, 0.0875169709f},
-std::array<float,2>{0.206816882f, 0.715971947f},
-std::array<float,2>{0.118044376f, 0.398499966f},
-std::array<float,2>{0.702965856f, 0.806716681f},
-std::array<float,2>{0.958980501f, 0.0241547897f},
-std::array<float,2>{0.375437975f, 0.667648852f},
-std::array<float,2>{0.262586564f, 0.161926642f},
-std::array<float,2>{0.821115553f, 0.602652907f},
-std::array<float,2>{0.61067313f, 0.255450875f},
-std::array<float,2>{0.13997446f, 0.994294167f},
-std::array<float,2>{0.241432369f, 0.09570048f},
-std::array<float,2>{0.509712636f, 0.747523963f},
-std::array<float,2>{0.796737015f, 0.459137738f},
-std::array<float,2>{0.317695498f, 0.864554822f},
-std::array<float,2>{0.447899312f, 0.326883465f},
-std::array<float,2>{0.90834862f, 0.936960816f},
-std::array<float,2>{0.629847586f, 0.249763533f},
-std::array<float,2>{0.00207346561f, 0.507543325f},
-std::array<float,2>{0.202062115f, 0.440508664f},
-std::array<float,2>{0.54026854f, 0.852480292f},
-std::array<float,2>{0.752610981f, 0.116350263f},
-std::array<float,2>{0.361029446f, 0.733090103f},
-std::array<float,2>{0.472578108f, 0.222052038f},
-std::array<float,2>{0.89189291f, 0.528095245f},
-std::array<float,2>{0.672153354f, 0.340151399f},
-std::array<float,2>{0.0448294468f, 0.915255129f},
-std::array<float,2>{0.0669767782f, 0.00325168227f},
-std::array<float,2>{0.743837953f, 0.684970438f},
-std::array<float,2>{0.990196943f, 0.383478791f},
-std::array<float,2>{0.408544093f, 0.791292846f},
-std::array<float,2>{0.29073137f, 0.279346168f},
-std::array<float,2>{0.845384896f, 0.974108219f},
-std::array<float,2>{0.590064764f, 0.178054824f},
-std::array<float,2>{0.178001195f, 0.614607513f},
-std::array<float,2>{0.027647892f, 0.350971431f},
-std::array<float,2>{0.648348212f, 0.879595876f},
-std::array<float,2>{0.925890386f, 0.197693214f},
-std::array<float,2>{0.457214832f, 0.538734615f},
-std::array<float,2>{0.33552745f, 0.0765334442f},
-std::array<float,2>{0.811835706f, 0.697515726f},
-std::array<float,2>{0.528944671f, 0.491518706f},
-std::array<float,2>{0.232630163f, 0.82254529f},
-std::array<float,2>{0.148499072f, 0.152180597f},
-std::array<float,2>{0.597109556f, 0.56977272f},
-std::array<float,2>{0.832261741f, 0.291392416f},
-std::array<float,2>{0.276781499f, 0.957024992f},
-std::array<float,2>{0.401423424f, 0.409724474f},
-std::array<float,2>{0.949278176f, 0.77213788f},
-std::array<float,2>{0.71264416f, 0.0607170314f},
-std::array<float,2>{0.0969805866f, 0.635576844f},
-std::array<float,2>{0.222558916f, 0.330807865f},
-std::array<float,2>{0.518147826f, 0.910231531f},
-std::array<float,2>{0.803699076f, 0.228503436f},
-std::array<float,2>{0.33993876f, 0.516794443f},
-std::array<float,2>{0.462813914f, 0.118893728f},
-std::array<float,2>{0.933838427f, 0.719131291f},
-std::array<float,2>{0.651372433f, 0.450114459f},
-std::array<float,2>{0.0232170671f, 0.850314736f},
-std::array<float,2>{0.106860936f, 0.18547374f},
-std::array<float,2>{0.710267425f, 0.617633164f},
-std::array<float,2>{0.941496432f, 0.268909305f},
-std::array<float,2>{0.395640433f, 0.983049214f},
-std::array<float,2>{0.272922218f, 0.38173604f},
-std::array<float,2>{0.843215942f, 0.787242651f},
-std::array<float,2>{0.608323455f, 0.0114178872f},
-std::array<float,2>{0.148373947f, 0.672581017f},
-std::array<float,2>{0.0318553261f, 0.496457815f},
-std::array<float,2>{0.686248481f, 0.81415844f},
-std::array<float,2>{0.90402621f, 0.0641889647f},
-std::array<float,2>{0.481009215f, 0.690407872f},
-std::array<float,2>{0.369401246f, 0.188343063f},
-std::array<float,2>{0.762930214f, 0.540559828f},
-std::array<float,2>{0.53228718f, 0.358300805f},
-std::array<float,2>{0.187912881f, 0.887112379f},
-std::array<float,2>{0.182499245f, 0.0491437726f},
-std::array<float,2>{0.578203499f, 0.63013339f},
-std::array<float,2>{0.857652009f, 0.420643508f},
-std::array<float,2>{0.28213039f, 0.774699688f},
-std::array<float,2>{0.418351769f, 0.288842976f},
-std::array<float,2>{0.994661748f, 0.964116096f},
-std::array<float,2>{0.74169302f, 0.145941406f},
-std::array<float,2>{0.0726906657f, 0.572317898f},
-std::array<float,2>{0.12686567f, 0.422423482f},
-std::array<float,2>{0.623555779f, 0.752972007f},
-std::array<float,2>{0.81276077f, 0.0335263945f},
-std::array<float,2>{0.255484551f, 0.646392465f},
-std::array<float,2>{0.389215231f, 0.132998869f},
-std::array<float,2>{0.9635095f, 0.584842026f},
-std::array<float,2>{0.690424502f, 0.31225571f},
-std::array<float,2>{0.112499729f, 0.940246761f},
-std::array<float,2>{0.0114435889f, 0.0845381767f},
-std::array<float,2>{0.637632191f, 0.709228933f},
-std::array<float,2>{0.917496383f, 0.470336884f},
-std::array<float,2>{0.443466842f, 0.834386647f},
-std::array<float,2>{0.320815712f, 0.36795494f},
-std::array<float,2>{0.783149242f, 0.902373314f},
-std::array<float,2>{0.506008983f, 0.211468369f},
-std::array<float,2>{0.244768277f, 0.551942587f},
-std::array<float,2>{0.0794552565f, 0.262378573f},
-std::array<float,2>{0.720419824f, 0.99118799f},
-std::array<float,2>{0.983806491f, 0.171588331f},
-std::array<float,2>{0.423592418f, 0.600646734f},
-std::array<float,2>{0.30520469f, 0.0181015413f},
-std::array<float,2>{0.87170893f, 0.661443412f},
-std::array<float,2>{0.56748414f, 0.395067722f},
-std::array<float,2>{0.168836564f, 0.802938282f},
-std::array<float,2>{0.210953563f, 0.236559063f},
-std::array<float,2>{0.55927968f, 0.508630216f},
-std::array<float,2>{0.773533523f, 0.317738473f},
-std::array<float,2>{0.348283231f, 0.929658413f},
-std::array<float,2>{0.488907009f, 0.461467922f},
-std::array<float,2>{0.882129788f, 0.873949468f},
-std::array<float,2>{0.668787897f, 0.107382379f},
-std::array<float,2>{0.0596307181f, 0.73492384f},
-std::array<float,2>{0.144178793f, 0.359601289f},
-std::array<float,2>{0.605372012f, 0.897069573f},
-std::array<float,2>{0.837144554f, 0.209408522f},
-std::array<float,2>{0.266222268f, 0.560500622f},
-std::array<float,2>{0.393818378f, 0.09076076f},
-std::array<float,2>{0.940607369f, 0.712320745f},
-std::array<float,2>{0.703272462f, 0.478357732f},
-std::array<float,2>{0.104388125f, 0.839698315f},
-std::array<float,2>{0.0163071621f, 0.130759254f},
-std::array<float,2>{0.655668736f, 0.593003213f},
-std::array<float,2>{0.931832612f, 0.303202003f},
-std::array<float,2>{0.466395706f, 0.948774695f},
-std::array<float,2>{0.336819023f, 0.434073687f},
-std::array<float,2>{0.799406707f, 0.762452841f},
-std::array<float,2>{0.521719873f, 0.0414467007f},
-std::array<float,2>{0.225188062f, 0.654787004f},
-std::array<float,2>{0.0764185116f, 0.454730332f},
-std::array<float,2>{0.735928595f, 0.861889482f},
-std::array<float,2>{0.996246219f, 0.0976759344f},
-std::array<float,2>{0.41699475f, 0.745558977f},
-std::array<float,2>{0.287810892f, 0.243622974f},
-std::array<float,2>{0.85397315f, 0.500423729f},
-std::array<float,2>{0.583409965f, 0.323638439f},
-std::array<float,2>{0.185252503f, 0.931141973f},
-std::array<float,2>{0.191680789f, 0.0303491279f},
-std::array<float,2>{0.538895547f, 0.670311272f},
-std::array<float,2>{0.759101868f, 0.40599817f},
-std::array<float,2>{0.374797314f, 0.811158657f},
-std::array<float,2>{0.478604555f, 0.253468484f},
-std::array<float,2>{0.902044713f, 0.997200429f},
-std::array<float,2>{0.680754185f, 0.159544751f},
-std::array<float,2>{0.0382807516f, 0.606401443f},
-std::array<float,2>{0.24706994f, 0.387623399f},
-std::array<float,2>{0.500153303f, 0.796583593f},
-std::array<float,2>{0.786358714f, 0.00571510568f},
-std::array<float,2>{0.327460289f, 0.680640101f},
-std::array<float,2>{0.440726936f, 0.171899796f},
-std::array<float,2>{0.921268284f, 0.611696362f},
-std::array<float,2>{0.635493159f, 0.276117593f},
-std::array<float,2>{0.0119332969f, 0.969361544f},
-std::array<float,2>{0.115354277f, 0.110007055f},
-std::array<float,2>{0.692809641f, 0.730329156f},
-std::array<float,2>{0.967420578f, 0.443444461f},
-std::array<float,2>{0.384067327f, 0.859221697f},
-std::array<float,2>{0.253826976f, 0.337746501f},
-std::array<float,2>{0.817033589f, 0.919190407f},
-std::array<float,2>{0.619060934f, 0.224455193f},
-std::array<float,2>{0.132511958f, 0.527244747f},
-std::array<float,2>{0.0561584048f, 0.295471936f},
-std::array<float,2>{0.66647619f, 0.959880471f},
-std::array<float,2>{0.877379f, 0.153911933f},
-std::array<float,2>{0.485807687f, 0.563529313f},
-std::array<float,2>{0.344781518f, 0.0574065447f},
-std::array<float,2>{0.778547049f, 0.640346646f},
-std::array<float,2>{0.557649672f, 0.413265675f},
-std::array<float,2>{0.21510914f, 0.768164873f},
-std::array<float,2>{0.16629076f, 0.202725336f},
-std::array<float,2>{0.562690139f, 0.531439841f},
-std::array<float,2>{0.870728314f, 0.344973266f},
-std::array<float,2>{0.309220791f, 0.87615484f},
-std::array<float,2>{0.429202557f, 0.485509455f},
-std::array<float,2>{0.979540706f, 0.825804293f},
-std::array<float,2>{0.723695755f, 0.072062999f},
-std::array<float,2>{0.085583657f, 0.701789856f},
-std::array<float,2>{0.210421979f, 0.271723241f},
-std::array<float,2>{0.552635252f, 0.976913214f},
-std::array<float,2>{0.773410201f, 0.1830277f},
-std::array<float,2>{0.357720584f, 0.622345686f},
-std::array<float,2>{0.493175328f, 0.0117495563f},
-std::array<float,2>{0.884747207f, 0.679208875f},
-std::array<float,2>{0.661946535f, 0.377119511f},
-std::array<float,2>{0.0536392368f, 0.783545554f},
-std::array<float,2>{0.0867763534f, 0.231484771f},
-std::array<float,2>{0.730619729f, 0.520323873f},
-std::array<float,2>{0.974614203f, 0.333467454f},
-std::array<float,2>{0.4305408f, 0.908865452f},
-std::array<float,2>{0.301795959f, 0.447154343f},
-std::array<float,2>{0.859904826f, 0.846838653f},
-std::array<float,2>{0.577508628f, 0.121622503f},
-std::array<float,2>{0.159149036f, 0.723514557f},
-std::array<float,2>{0.00473429961f, 0.414802015f},
-std::array<float,2>{0.628704548f, 0.779814899f},
-std::array<float,2>{0.91271764f, 0.0543587655f},
-std::array<float,2>{0.452927768f, 0.626512706f},
-std::array<float,2>{0.313436449f, 0.14264676f},
-std::array<float,2>{0.7892434f, 0.574774444f},
-std::array<float,2>{0.51311785f, 0.2818138f},
-std::array<float,2>{0.235798717f, 0.967553735f},
-std::array<float,2>{0.136539191f, 0.0689146817f},
-std::array<float,2>{0.616463602f, 0.693600178f},
-std::array<float,2>{0.824500263f, 0.492979646f},
-std::array<float,2>{0.259879112f, 0.818139613f},
-std::array<float,2>{0.380848497f, 0.354999572f},
-std::array<float,2>{0.953976452f, 0.884402394f},
-std::array<float,2>{0.695729017f, 0.193063378f},
-std::array<float,2>{0.124757364f, 0.54465127f},
-std::array<float,2>{0.172627285f, 0.476521373f},
-std::array<float,2>{0.586489677f, 0.828312874f},
-std::array<float,2>{0.850000858f, 0.0801655725f},
-std::array<float,2>{0.293120235f, 0.704942465f},
-std::array<float,2>{0.410406023f, 0.217739061f},
-std::array<float,2>{0.98742336f, 0.54710263f},
-std::array<float,2>{0.747850835f, 0.374479234f},
-std::array<float,2>{0.0656491518f, 0.900589108f},
-std::array<float,2>{0.0406684913f, 0.0378042012f},
-std::array<float,2>{0.679654717f, 0.641701877f},
-std::array<float,2>{0.895703435f, 0.428298086f},
-std::array<float,2>{0.476474375f, 0.754137158f},
-std::array<float,2>{0.36551407f, 0.305939615f},
-std::array<float,2>{0.755618751f, 0.943608642f},
-std::array<float,2>{0.546545208f, 0.138775468f},
-std::array<float,2>{0.198112532f, 0.579899311f},
-std::array<float,2>{0.0980238244f, 0.313077122f},
-std::array<float,2>{0.718708634f, 0.923315406f},
-std::array<float,2>{0.947546899f, 0.242048532f},
-std::array<float,2>{0.405845284f, 0.514349699f},
-std::array<float,2>{0.278312773f, 0.105372816f},
-std::array<float,2>{0.829434276f, 0.740372479f},
-std::array<float,2>{0.597678185f, 0.465231478f},
-std::array<float,2>{0.154729038f, 0.868206322f},
-std::array<float,2>{0.229395121f, 0.167958945f},
-std::array<float,2>{0.527269006f, 0.594058514f},
-std::array<float,2>{0.808269203f, 0.261529744f},
-std::array<float,2>{0.328602999f, 0.984654367f},
-std::array<float,2>{0.453914344f, 0.392554015f},
-std::array<float,2>{0.924811482f, 0.800657213f},
-std::array<float,2>{0.64435631f, 0.0227394775f},
-std::array<float,2>{0.024291629f, 0.659626901f},
-std::array<float,2>{0.137092948f, 0.257532328f},
-std::array<float,2>{0.612261593f, 0.993015707f},
-std::array<float,2>{0.823819518f, 0.164044753f},
-std::array<float,2>{0.264443159f, 0.604699016f},
-std::array<float,2>{0.377764255f, 0.0267157536f},
-std::array<float,2>{0.960570335f, 0.665412307f},
-std::array<float,2>{0.700125039f, 0.401448369f},
-std::array<float,2>{0.11977689f, 0.805202007f},
-std::array<float,2>{0.000788176956f, 0.24635841f},
-std::array<float,2>{0.631658375f, 0.505187452f},
-std::array<float,2>{0.908046007f, 0.324331045f},
-std::array<float,2>{0.446108878f, 0.93451494f},
-std::array<float,2>{0.320246696f, 0.457941651f},
-std::array<float,2>{0.793212831f, 0.866070271f},
-std::array<float,2>{0.5107162f, 0.0962249339f},
-std::array<float,2>{0.238572508f, 0.749871314f},
-std::array<float,2>{0.0907157883f, 0.429702878f},
-std::array<float,2>{0.727748692f, 0.757835209f},
-std::array<float,2>{0.972532153f, 0.0430237576f},
-std::array<float,2>{0.437008649f, 0.649160743f},
-std::array<float,2>{0.299997151f, 0.126128361f},
-std::array<float,2>{0.864426315f, 0.587791681f},
-std::array<float,2>{0.572231054f, 0.300496489f},
-std::array<float,2>{0.162377909f, 0.952683806f},
-std::array<float,2>{0.204764158f, 0.0891088471f},
-std::array<float,2>{0.547255754f, 0.718394041f},
-std::array<float,2>{0.769392788f, 0.482950628f},
-std::array<float,2>{0.355004549f, 0.843438208f},
-std::array<float,2>{0.499484688f, 0.364355356f},
-std::array<float,2>{0.88740468f, 0.894063652f},
-std::array<float,2>{0.65693897f, 0.206936762f},
-std::array<float,2>{0.0491523221f, 0.55835712f},
-std::array<float,2>{0.231044278f, 0.488933563f},
-std::array<float,2>{0.530163646f, 0.82033354f},
-std::array<float,2>{0.809467018f, 0.0754996538f},
-std::array<float,2>{0.332311898f, 0.69567126f},
-std::array<float,2>{0.460740268f, 0.196455866f},
-std::array<float,2>{0.928242087f, 0.536686063f},
-std::array<float,2>{0.6460554f, 0.348284096f},
-std::array<float,2>{0.0300930496f, 0.88277787f},
-std::array<float,2>{0.0956239626f, 0.0591367036f},
-std::array<float,2>{0.714552164f, 0.633547187f},
-std::array<float,2>{0.952929258f, 0.407008141f},
-std::array<float,2>{0.400132567f, 0.771127164f},
-std::array<float,2>{0.275225669f, 0.290281564f},
-std::array<float,2>{0.834270477f, 0.95412147f},
-std::array<float,2>{0.594908059f, 0.148639426f},
-std::array<float,2>{0.150854275f, 0.567234516f},
-std::array<float,2>{0.0452929139f, 0.343391448f},
-std::array<float,2>{0.674132407f, 0.91697365f},
-std::array<float,2>{0.893165588f, 0.22058858f},
-std::array<float,2>{0.468988955f, 0.530624747f},
-std::array<float,2>{0.361365676f, 0.113519616f},
-std::array<float,2>{0.750294268f, 0.731429696f},
-std::array<float,2>{0.542726696f, 0.438875914f},
-std::array<float,2>{0.199578568f, 0.855390906f},
-std::array<float,2>{0.177245736f, 0.175790891f},
-std::array<float,2>{0.592339694f, 0.615265965f},
-std::array<float,2>{0.846715987f, 0.278869271f},
-std::array<float,2>{0.29119274f, 0.975948989f},
-std::array<float,2>{0.406554699f, 0.385011196f},
-std::array<float,2>{0.991166472f, 0.789793789f},
-std::array<float,2>{0.745967209f, 0.000659396581f},
-std::array<float,2>{0.0688822716f, 0.686453819f},
-std::array<float,2>{0.190940484f, 0.35657683f},
-std::array<float,2>{0.53443563f, 0.889764905f},
-std::array<float,2>{0.765277565f, 0.19081144f},
-std::array<float,2>{0.367992222f, 0.542583168f},
-std::array<float,2>{0.482932985f, 0.0662442744f},
-std::array<float,2>{0.905214608f, 0.688450694f},
-std::array<float,2>{0.683993399f, 0.499118537f},
-std::array<float,2>{0.03455415f, 0.815180063f},
-std::array<float,2>{0.071919471f, 0.147070095f},
-std::array<float,2>{0.738606036f, 0.57194829f},
-std::array<float,2>{0.992562711f, 0.28564468f},
-std::array<float,2>{0.421153992f, 0.961346328f},
-std::array<float,2>{0.283686757f, 0.419171721f},
-std::array<float,2>{0.857174218f, 0.77585119f},
-std::array<float,2>{0.580515265f, 0.048187498f},
-std::array<float,2>{0.180137306f, 0.632804453f},
-std::array<float,2>{0.0195957683f, 0.451669425f},
-std::array<float,2>{0.650229037f, 0.847794294f},
-std::array<float,2>{0.936757803f, 0.12069574f},
-std::array<float,2>{0.463023186f, 0.721057177f},
-std::array<float,2>{0.342991918f, 0.229312271f},
-std::array<float,2>{0.800979495f, 0.518985391f},
-std::array<float,2>{0.516163886f, 0.328934759f},
-std::array<float,2>{0.219724149f, 0.912948668f},
-std::array<float,2>{0.146024972f, 0.00958246179f},
-std::array<float,2>{0.605901599f, 0.674960375f},
-std::array<float,2>{0.841308475f, 0.380304724f},
-std::array<float,2>{0.269565523f, 0.786887884f},
-std::array<float,2>{0.397103369f, 0.267124087f},
-std::array<float,2>{0.943499029f, 0.981823742f},
-std::array<float,2>{0.708528757f, 0.186387122f},
-std::array<float,2>{0.109227121f, 0.619349241f},
-std::array<float,2>{0.170847982f, 0.396863759f},
-std::array<float,2>{0.569168389f, 0.801442862f},
-std::array<float,2>{0.873428106f, 0.0170550514f},
-std::array<float,2>{0.307358354f, 0.663269103f},
-std::array<float,2>{0.424369246f, 0.168351084f},
-std::array<float,2>{0.980657935f, 0.59799248f},
-std::array<float,2>{0.720826864f, 0.264491796f},
-std::array<float,2>{0.0807194635f, 0.989661753f},
-std::array<float,2>{0.0620336682f, 0.108522423f},
-std::array<float,2>{0.671062589f, 0.737912536f},
-std::array<float,2>{0.880379558f, 0.46472761f},
-std::array<float,2>{0.490688622f, 0.872589588f},
-std::array<float,2>{0.349927962f, 0.318444818f},
-std::array<float,2>{0.775758803f, 0.925995171f},
-std::array<float,2>{0.560580671f, 0.235882595f},
-std::array<float,2>{0.213912398f, 0.510581791f},
-std::array<float,2>{0.111202464f, 0.308939427f},
-std::array<float,2>{0.688720822f, 0.938148618f},
-std::array<float,2>{0.962728977f, 0.136035919f},
-std::array<float,2>{0.387892038f, 0.582674444f},
-std::array<float,2>{0.256991118f, 0.0312868431f},
-std::array<float,2>{0.815496385f, 0.647061586f},
-std::array<float,2>{0.622830153f, 0.425563276f},
-std::array<float,2>{0.128878951f, 0.751629174f},
-std::array<float,2>{0.243205309f, 0.213814855f},
-std::array<float,2>{0.504030287f, 0.553021848f},
-std::array<float,2>{0.785098374f, 0.369471043f},
-std::array<float,2>{0.323466569f, 0.904635847f},
-std::array<float,2>{0.442376554f, 0.471429974f},
-std::array<float,2>{0.915919185f, 0.833218396f},
-std::array<float,2>{0.640281677f, 0.082265757f},
-std::array<float,2>{0.00906864833f, 0.708107114f},
-std::array<float,2>{0.186896577f, 0.32115975f},
-std::array<float,2>{0.585592806f, 0.932887673f},
-std::array<float,2>{0.852324188f, 0.244355991f},
-std::array<float,2>{0.285268754f, 0.502562344f},
-std::array<float,2>{0.414424896f, 0.10065306f},
-std::array<float,2>{0.998336613f, 0.742453933f},
-std::array<float,2>{0.736676097f, 0.455346286f},
-std::array<float,2>{0.0743963569f, 0.861297071f},
-std::array<float,2>{0.0361307114f, 0.158008054f},
-std::array<float,2>{0.681818604f, 0.608313262f},
-std::array<float,2>{0.898507714f, 0.250194281f},
-std::array<float,2>{0.477071762f, 0.998336554f},
-std::array<float,2>{0.371550232f, 0.403529197f},
-std::array<float,2>{0.761343837f, 0.808698475f},
-std::array<float,2>{0.535820901f, 0.0292152222f},
-std::array<float,2>{0.194945782f, 0.668869555f},
-std::array<float,2>{0.1021908f, 0.480102122f},
-std::array<float,2>{0.705821991f, 0.836190999f},
-std::array<float,2>{0.939003348f, 0.0924098492f},
-std::array<float,2>{0.390983015f, 0.713593125f},
-std::array<float,2>{0.268743008f, 0.207683071f},
-std::array<float,2>{0.837917864f, 0.561768413f},
-std::array<float,2>{0.603088856f, 0.36227268f},
-std::array<float,2>{0.14181903f, 0.895198524f},
-std::array<float,2>{0.223166734f, 0.0397871807f},
-std::array<float,2>{0.520243406f, 0.654215813f},
-std::array<float,2>{0.7977162f, 0.436119854f},
-std::array<float,2>{0.338492095f, 0.764923334f},
-std::array<float,2>{0.468555868f, 0.302088082f},
-std::array<float,2>{0.931114137f, 0.947150946f},
-std::array<float,2>{0.652452886f, 0.131218433f},
-std::array<float,2>{0.0186745059f, 0.590835273f},
-std::array<float,2>{0.217533186f, 0.411206156f},
-std::array<float,2>{0.556159019f, 0.766354263f},
-std::array<float,2>{0.780651689f, 0.0565404594f},
-std::array<float,2>{0.346637338f, 0.638663471f},
-std::array<float,2>{0.487699509f, 0.154573649f},
-std::array<float,2>{0.876502693f, 0.564606369f},
-std::array<float,2>{0.665850818f, 0.29475221f},
-std::array<float,2>{0.0584451444f, 0.957513511f},
-std::array<float,2>{0.0831642225f, 0.0734989792f},
-std::array<float,2>{0.726385534f, 0.699936211f},
-std::array<float,2>{0.977505982f, 0.486361265f},
-std::array<float,2>{0.427140445f, 0.827059448f},
-std::array<float,2>{0.310767233f, 0.347220361f},
-std::array<float,2>{0.867914021f, 0.878654838f},
-std::array<float,2>{0.566220164f, 0.200543091f},
-std::array<float,2>{0.165529683f, 0.534451544f},
-std::array<float,2>{0.0150882462f, 0.273596853f},
-std::array<float,2>{0.634634316f, 0.971660137f},
-std::array<float,2>{0.919046044f, 0.175224438f},
-std::array<float,2>{0.437880456f, 0.609861434f},
-std::array<float,2>{0.325909406f, 0.00741024595f},
-std::array<float,2>{0.788675725f, 0.683326066f},
-std::array<float,2>{0.502730489f, 0.390206128f},
-std::array<float,2>{0.249458909f, 0.793438256f},
-std::array<float,2>{0.128985673f, 0.225583896f},
-std::array<float,2>{0.620845616f, 0.523604333f},
-std::array<float,2>{0.820004702f, 0.339778006f},
-std::array<float,2>{0.250245184f, 0.920840979f},
-std::array<float,2>{0.386056781f, 0.443227589f},
-std::array<float,2>{0.965267062f, 0.856344342f},
-std::array<float,2>{0.693361819f, 0.112553366f},
-std::array<float,2>{0.114160478f, 0.728512347f},
-std::array<float,2>{0.23729749f, 0.284919411f},
-std::array<float,2>{0.514698923f, 0.966630876f},
-std::array<float,2>{0.791206062f, 0.141404718f},
-std::array<float,2>{0.316314369f, 0.576561034f},
-std::array<float,2>{0.450473547f, 0.0524984412f},
-std::array<float,2>{0.910946071f, 0.628007531f},
-std::array<float,2>{0.625737011f, 0.417038769f},
-std::array<float,2>{0.00682909461f, 0.779291034f},
-std::array<float,2>{0.122269087f, 0.194791302f},
-std::array<float,2>{0.698916376f, 0.545145571f},
-std::array<float,2>{0.955804825f, 0.351920575f},
-std::array<float,2>{0.381752312f, 0.88555187f},
-std::array<float,2>{0.258331269f, 0.49475053f},
-std::array<float,2>{0.82731086f, 0.81934315f},
-std::array<float,2>{0.615100086f, 0.0671641007f},
-std::array<float,2>{0.133918732f, 0.692566216f},
-std::array<float,2>{0.0508676581f, 0.375382751f},
-std::array<float,2>{0.663682699f, 0.781402647f},
-std::array<float,2>{0.884872556f, 0.0153187765f},
-std::array<float,2>{0.494324327f, 0.67653507f},
-std::array<float,2>{0.355875343f, 0.180682048f},
-std::array<float,2>{0.77097404f, 0.624462664f},
-std::array<float,2>{0.554182887f, 0.270783395f},
-std::array<float,2>{0.207252681f, 0.979703546f},
-std::array<float,2>{0.157409757f, 0.124429703f},
-std::array<float,2>{0.576067567f, 0.725448608f},
-std::array<float,2>{0.861688673f, 0.447998464f},
-std::array<float,2>{0.303613245f, 0.844249308f},
-std::array<float,2>{0.433056176f, 0.334049046f},
-std::array<float,2>{0.972728372f, 0.906736135f},
-std::array<float,2>{0.734248042f, 0.23286508f},
-std::array<float,2>{0.0879596099f, 0.521715045f},
-std::array<float,2>{0.153919727f, 0.468070805f},
-std::array<float,2>{0.600610852f, 0.870211184f},
-std::array<float,2>{0.830867469f, 0.101943657f},
-std::array<float,2>{0.28031987f, 0.739446521f},
-std::array<float,2>{0.403823406f, 0.239055231f},
-std::array<float,2>{0.947017193f, 0.511907041f},
-std::array<float,2>{0.71504885f, 0.314861864f},
-std::array<float,2>{0.101047792f, 0.924257636f},
-std::array<float,2>{0.0260934848f, 0.0201521162f},
-std::array<float,2>{0.640885115f, 0.6567958f},
-std::array<float,2>{0.92190659f, 0.393795967f},
-std::array<float,2>{0.456598222f, 0.797351778f},
-std::array<float,2>{0.332029194f, 0.259172589f},
-std::array<float,2>{0.80634445f, 0.986463249f},
-std::array<float,2>{0.524496436f, 0.165224686f},
-std::array<float,2>{0.226858929f, 0.597052991f},
-std::array<float,2>{0.0636998191f, 0.371857315f},
-std::array<float,2>{0.749846816f, 0.9003281f},
-std::array<float,2>{0.984433174f, 0.21657072f},
-std::array<float,2>{0.413465083f, 0.549620211f},
-std::array<float,2>{0.296708912f, 0.079945676f},
-std::array<float,2>{0.847989738f, 0.70508033f},
-std::array<float,2>{0.58799845f, 0.473935872f},
-std::array<float,2>{0.173847154f, 0.83018744f},
-std::array<float,2>{0.196382865f, 0.136915013f},
-std::array<float,2>{0.543070138f, 0.581328571f},
-std::array<float,2>{0.756968856f, 0.306776732f},
-std::array<float,2>{0.363721848f, 0.941907942f},
-std::array<float,2>{0.47330153f, 0.426056266f},
-std::array<float,2>{0.898339689f, 0.756130636f},
-std::array<float,2>{0.677711606f, 0.0358304456f},
-std::array<float,2>{0.0424278304f, 0.643597305f},
-std::array<float,2>{0.179132268f, 0.277597219f},
-std::array<float,2>{0.590854108f, 0.974630773f},
-std::array<float,2>{0.844098032f, 0.177361652f},
-std::array<float,2>{0.289227158f, 0.616380692f},
-std::array<float,2>{0.409492642f, 0.00103529159f},
-std::array<float,2>{0.98875314f, 0.68710053f},
-std::array<float,2>{0.74232471f, 0.386071533f},
-std::array<float,2>{0.0679127499f, 0.790894687f},
-std::array<float,2>{0.0429869257f, 0.219545498f},
-std::array<float,2>{0.673502326f, 0.530211926f},
-std::array<float,2>{0.891401291f, 0.342394829f},
-std::array<float,2>{0.471231908f, 0.91715008f},
-std::array<float,2>{0.359445751f, 0.43790409f},
-std::array<float,2>{0.753049552f, 0.853531957f},
-std::array<float,2>{0.539948285f, 0.1149913f},
-std::array<float,2>{0.202575281f, 0.731711566f},
-std::array<float,2>{0.0960777104f, 0.407977641f},
-std::array<float,2>{0.711741686f, 0.770065844f},
-std::array<float,2>{0.9510535f, 0.0601807162f},
-std::array<float,2>{0.400846899f, 0.633826137f},
-std::array<float,2>{0.275952965f, 0.149782613f},
-std::array<float,2>{0.833702385f, 0.568206429f},
-std::array<float,2>{0.596166074f, 0.289069414f},
-std::array<float,2>{0.150207028f, 0.95365864f},
-std::array<float,2>{0.233474046f, 0.0749236494f},
-std::array<float,2>{0.52798748f, 0.696457446f},
-std::array<float,2>{0.810892701f, 0.489550024f},
-std::array<float,2>{0.334665865f, 0.821438909f},
-std::array<float,2>{0.458944589f, 0.348641962f},
-std::array<float,2>{0.927309215f, 0.881131113f},
-std::array<float,2>{0.646621048f, 0.196223974f},
-std::array<float,2>{0.0286515672f, 0.53567487f},
-std::array<float,2>{0.205842033f, 0.483459175f},
-std::array<float,2>{0.550603867f, 0.842438102f},
-std::array<float,2>{0.766101241f, 0.0882307738f},
-std::array<float,2>{0.35183689f, 0.71689409f},
-std::array<float,2>{0.496965975f, 0.205653653f},
-std::array<float,2>{0.888957858f, 0.557527125f},
-std::array<float,2>{0.659701526f, 0.364209563f},
-std::array<float,2>{0.0476321466f, 0.892987728f},
-std::array<float,2>{0.0919300616f, 0.0444683731f},
-std::array<float,2>{0.728902519f, 0.650256217f},
-std::array<float,2>{0.96959281f, 0.431339413f},
-std::array<float,2>{0.434957474f, 0.759377122f},
-std::array<float,2>{0.297079891f, 0.299179405f},
-std::array<float,2>{0.866261661f, 0.951712191f},
-std::array<float,2>{0.573496997f, 0.125462711f},
-std::array<float,2>{0.160816014f, 0.586127877f},
-std::array<float,2>{0.00293833879f, 0.325226068f},
-std::array<float,2>{0.630378664f, 0.934572577f},
-std::array<float,2>{0.90927577f, 0.247873276f},
-std::array<float,2>{0.448286742f, 0.5039168f},
-std::array<float,2>{0.316465646f, 0.0967440531f},
-std::array<float,2>{0.795508683f, 0.748423457f},
-std::array<float,2>{0.508470297f, 0.458334744f},
-std::array<float,2>{0.240715086f, 0.866756976f},
-std::array<float,2>{0.139581949f, 0.163018882f},
-std::array<float,2>{0.61019218f, 0.604198813f},
-std::array<float,2>{0.821364582f, 0.25652498f},
-std::array<float,2>{0.262969315f, 0.993930757f},
-std::array<float,2>{0.376593441f, 0.40059635f},
-std::array<float,2>{0.95773685f, 0.806140006f},
-std::array<float,2>{0.702049494f, 0.0261161607f},
-std::array<float,2>{0.118959114f, 0.664548397f},
-std::array<float,2>{0.245279238f, 0.371093273f},
-std::array<float,2>{0.507091999f, 0.905530751f},
-std::array<float,2>{0.781561315f, 0.21434404f},
-std::array<float,2>{0.32205984f, 0.553990424f},
-std::array<float,2>{0.44449535f, 0.0832206085f},
-std::array<float,2>{0.916601062f, 0.707697988f},
-std::array<float,2>{0.638274729f, 0.472639769f},
-std::array<float,2>{0.0103748981f, 0.832502842f},
-std::array<float,2>{0.11226362f, 0.134803757f},
-std::array<float,2>{0.690963566f, 0.583614707f},
-std::array<float,2>{0.964491665f, 0.309739739f},
-std::array<float,2>{0.390406042f, 0.938965857f},
-std::array<float,2>{0.254696369f, 0.424755275f},
-std::array<float,2>{0.814093828f, 0.750903666f},
-std::array<float,2>{0.624324143f, 0.0330745578f},
-std::array<float,2>{0.125716269f, 0.648374021f},
-std::array<float,2>{0.059062846f, 0.463452786f},
-std::array<float,2>{0.669347823f, 0.871243715f},
-std::array<float,2>{0.881806493f, 0.108266316f},
-std::array<float,2>{0.489354879f, 0.737224519f},
-std::array<float,2>{0.349440187f, 0.235240966f},
-std::array<float,2>{0.774436593f, 0.511671305f},
-std::array<float,2>{0.560256541f, 0.319553465f},
-std::array<float,2>{0.212454244f, 0.927118599f},
-std::array<float,2>{0.169316649f, 0.0157233439f},
-std::array<float,2>{0.567276716f, 0.662424207f},
-std::array<float,2>{0.872086227f, 0.397881657f},
-std::array<float,2>{0.305800349f, 0.802632928f},
-std::array<float,2>{0.422093958f, 0.264775097f},
-std::array<float,2>{0.982518196f, 0.988551617f},
-std::array<float,2>{0.719657779f, 0.169157878f},
-std::array<float,2>{0.0789602697f, 0.599168956f},
-std::array<float,2>{0.146689922f, 0.379759312f},
-std::array<float,2>{0.60879606f, 0.785201907f},
-std::array<float,2>{0.8426736f, 0.00853472482f},
-std::array<float,2>{0.272405118f, 0.674615979f},
-std::array<float,2>{0.395077944f, 0.187251061f},
-std::array<float,2>{0.942387819f, 0.620729327f},
-std::array<float,2>{0.709201455f, 0.265689194f},
-std::array<float,2>{0.105628207f, 0.980581284f},
-std::array<float,2>{0.0221992582f, 0.119664207f},
-std::array<float,2>{0.650446415f, 0.722498715f},
-std::array<float,2>{0.935087144f, 0.452872545f},
-std::array<float,2>{0.461255729f, 0.84880656f},
-std::array<float,2>{0.340953887f, 0.329869241f},
-std::array<float,2>{0.804674447f, 0.913385451f},
-std::array<float,2>{0.519301593f, 0.22960794f},
-std::array<float,2>{0.221443564f, 0.518205762f},
-std::array<float,2>{0.0741122663f, 0.286834806f},
-std::array<float,2>{0.740829766f, 0.962106705f},
-std::array<float,2>{0.995718837f, 0.148115009f},
-std::array<float,2>{0.419628531f, 0.570877433f},
-std::array<float,2>{0.282616287f, 0.0469891354f},
-std::array<float,2>{0.859053373f, 0.631585121f},
-std::array<float,2>{0.579872787f, 0.418218106f},
-std::array<float,2>{0.18351832f, 0.776609361f},
-std::array<float,2>{0.18914111f, 0.189864799f},
-std::array<float,2>{0.531858981f, 0.541729152f},
-std::array<float,2>{0.761803448f, 0.356227458f},
-std::array<float,2>{0.370501339f, 0.889624238f},
-std::array<float,2>{0.481949776f, 0.499022841f},
-std::array<float,2>{0.902386308f, 0.815641701f},
-std::array<float,2>{0.686527669f, 0.065109916f},
-std::array<float,2>{0.0330614746f, 0.688614547f},
-std::array<float,2>{0.13123925f, 0.338837922f},
-std::array<float,2>{0.617910385f, 0.921070635f},
-std::array<float,2>{0.817714214f, 0.226542979f},
-std::array<float,2>{0.252460599f, 0.524578571f},
-std::array<float,2>{0.382942498f, 0.111873329f},
-std::array<float,2>{0.968406498f, 0.726965249f},
-std::array<float,2>{0.691694736f, 0.441663504f},
-std::array<float,2>{0.116315804f, 0.85681659f},
-std::array<float,2>{0.0131611796f, 0.173960239f},
-std::array<float,2>{0.636539578f, 0.610381782f},
-std::array<float,2>{0.91996491f, 0.275267035f},
-std::array<float,2>{0.440038353f, 0.972595513f},
-std::array<float,2>{0.326556444f, 0.388775378f},
-std::array<float,2>{0.785814762f, 0.794196904f},
-std::array<float,2>{0.501685023f, 0.00591593562f},
-std::array<float,2>{0.247211069f, 0.681686819f},
-std::array<float,2>{0.0845514685f, 0.488209724f},
-std::array<float,2>{0.72357899f, 0.827748299f},
-std::array<float,2>{0.978715301f, 0.0730956793f},
-std::array<float,2>{0.428233534f, 0.700925589f},
-std::array<float,2>{0.309777647f, 0.199711859f},
-std::array<float,2>{0.869769156f, 0.533935606f},
-std::array<float,2>{0.564243317f, 0.346284211f},
-std::array<float,2>{0.167261168f, 0.877344429f},
-std::array<float,2>{0.216699734f, 0.055463627f},
-std::array<float,2>{0.556837976f, 0.637122989f},
-std::array<float,2>{0.778103232f, 0.410459638f},
-std::array<float,2>{0.344173938f, 0.766787052f},
-std::array<float,2>{0.484592557f, 0.293713003f},
-std::array<float,2>{0.878056467f, 0.958449185f},
-std::array<float,2>{0.66757971f, 0.155799419f},
-std::array<float,2>{0.0550931729f, 0.566042066f},
-std::array<float,2>{0.22652176f, 0.437337041f},
-std::array<float,2>{0.52270323f, 0.763818502f},
-std::array<float,2>{0.800727427f, 0.0408555679f},
-std::array<float,2>{0.337066859f, 0.652525783f},
-std::array<float,2>{0.464844704f, 0.132602662f},
-std::array<float,2>{0.932866991f, 0.590320289f},
-std::array<float,2>{0.654424548f, 0.301619679f},
-std::array<float,2>{0.0174873378f, 0.945388138f},
-std::array<float,2>{0.104774185f, 0.0936092064f},
-std::array<float,2>{0.704614639f, 0.714200377f},
-std::array<float,2>{0.940239668f, 0.47944957f},
-std::array<float,2>{0.393286377f, 0.837707758f},
-std::array<float,2>{0.267028153f, 0.363156199f},
-std::array<float,2>{0.836512148f, 0.895840645f},
-std::array<float,2>{0.604188919f, 0.20854488f},
-std::array<float,2>{0.142700195f, 0.561319172f},
-std::array<float,2>{0.0379046537f, 0.251336277f},
-std::array<float,2>{0.680162787f, 0.999345362f},
-std::array<float,2>{0.900767744f, 0.156748831f},
-std::array<float,2>{0.480249256f, 0.609366417f},
-std::array<float,2>{0.37328136f, 0.0279578809f},
-std::array<float,2>{0.758560598f, 0.669495642f},
-std::array<float,2>{0.537471592f, 0.402444363f},
-std::array<float,2>{0.19252333f, 0.810200095f},
-std::array<float,2>{0.183650956f, 0.245134026f},
-std::array<float,2>{0.582809508f, 0.503291249f},
-std::array<float,2>{0.855185091f, 0.322093606f},
-std::array<float,2>{0.288704187f, 0.932105839f},
-std::array<float,2>{0.416521639f, 0.45690605f},
-std::array<float,2>{0.998043478f, 0.859685779f},
-std::array<float,2>{0.735106826f, 0.0999894813f},
-std::array<float,2>{0.0780417845f, 0.743646801f},
-std::array<float,2>{0.198727444f, 0.307954222f},
-std::array<float,2>{0.545363963f, 0.942455947f},
-std::array<float,2>{0.753960788f, 0.138579622f},
-std::array<float,2>{0.366539925f, 0.580736458f},
-std::array<float,2>{0.474747717f, 0.0370673798f},
-std::array<float,2>{0.894812286f, 0.643146753f},
-std::array<float,2>{0.67804563f, 0.426854193f},
-std::array<float,2>{0.0399309173f, 0.757016063f},
-std::array<float,2>{0.0645415336f, 0.215530604f},
-std::array<float,2>{0.746720612f, 0.550504208f},
-std::array<float,2>{0.987034678f, 0.372777611f},
-std::array<float,2>{0.41190663f, 0.899095476f},
-std::array<float,2>{0.294139713f, 0.473588109f},
-std::array<float,2>{0.85066247f, 0.831588626f},
-std::array<float,2>{0.587168992f, 0.0785309002f},
-std::array<float,2>{0.173264951f, 0.706523657f},
-std::array<float,2>{0.0247403625f, 0.393450022f},
-std::array<float,2>{0.643447101f, 0.798064351f},
-std::array<float,2>{0.924007297f, 0.0210369769f},
-std::array<float,2>{0.454225391f, 0.657553136f},
-std::array<float,2>{0.3291834f, 0.165018409f},
-std::array<float,2>{0.806749344f, 0.596481562f},
-std::array<float,2>{0.525938988f, 0.258370101f},
-std::array<float,2>{0.230102524f, 0.987593055f},
-std::array<float,2>{0.15589115f, 0.102875747f},
-std::array<float,2>{0.599366784f, 0.739164412f},
-std::array<float,2>{0.82843399f, 0.467178136f},
-std::array<float,2>{0.278549314f, 0.869679272f},
-std::array<float,2>{0.404498369f, 0.315899014f},
-std::array<float,2>{0.948755562f, 0.924860299f},
-std::array<float,2>{0.717343688f, 0.240051925f},
-std::array<float,2>{0.0991156027f, 0.512989998f},
-std::array<float,2>{0.159312963f, 0.448361874f},
-std::array<float,2>{0.576640069f, 0.845216095f},
-std::array<float,2>{0.861240089f, 0.1235383f},
-std::array<float,2>{0.301074147f, 0.725718319f},
-std::array<float,2>{0.431267321f, 0.233886331f},
-std::array<float,2>{0.975587547f, 0.523358524f},
-std::array<float,2>{0.731912255f, 0.335906148f},
-std::array<float,2>{0.0875393748f, 0.907556474f},
-std::array<float,2>{0.053981699f, 0.0137501871f},
-std::array<float,2>{0.660280108f, 0.677215099f},
-std::array<float,2>{0.883303463f, 0.376926303f},
-std::array<float,2>{0.493078887f, 0.782915771f},
-std::array<float,2>{0.358551502f, 0.269729406f},
-std::array<float,2>{0.772127926f, 0.978900731f},
-std::array<float,2>{0.551649749f, 0.18022114f},
-std::array<float,2>{0.209810764f, 0.623981178f},
-std::array<float,2>{0.123568952f, 0.352789283f},
-std::array<float,2>{0.696936786f, 0.885824084f},
-std::array<float,2>{0.954942644f, 0.194049045f},
-std::array<float,2>{0.379683584f, 0.54642427f},
-std::array<float,2>{0.26146093f, 0.0677692741f},
-std::array<float,2>{0.825714529f, 0.692230463f},
-std::array<float,2>{0.615962267f, 0.496050835f},
-std::array<float,2>{0.135176376f, 0.819056034f},
-std::array<float,2>{0.23501645f, 0.14237757f},
-std::array<float,2>{0.512074888f, 0.577549458f},
-std::array<float,2>{0.790281117f, 0.283703297f},
-std::array<float,2>{0.314437479f, 0.965764821f},
-std::array<float,2>{0.451376975f, 0.416223049f},
-std::array<float,2>{0.913450956f, 0.777459502f},
-std::array<float,2>{0.627372622f, 0.051295571f},
-std::array<float,2>{0.00538786734f, 0.627432525f},
-std::array<float,2>{0.152168766f, 0.292797059f},
-std::array<float,2>{0.593863785f, 0.955403805f},
-std::array<float,2>{0.835475206f, 0.150393054f},
-std::array<float,2>{0.273870319f, 0.568683326f},
-std::array<float,2>{0.398618788f, 0.0616239943f},
-std::array<float,2>{0.952134609f, 0.635909975f},
-std::array<float,2>{0.713625968f, 0.408891559f},
-std::array<float,2>{0.0940465406f, 0.773032367f},
-std::array<float,2>{0.0309905093f, 0.198374897f},
-std::array<float,2>{0.644701779f, 0.537557244f},
-std::array<float,2>{0.928918481f, 0.349714279f},
-std::array<float,2>{0.459592551f, 0.880429387f},
-std::array<float,2>{0.333405823f, 0.490831673f},
-std::array<float,2>{0.80968529f, 0.823934972f},
-std::array<float,2>{0.530331433f, 0.0771661848f},
-std::array<float,2>{0.232195944f, 0.69861865f},
-std::array<float,2>{0.070208095f, 0.384018511f},
-std::array<float,2>{0.745054662f, 0.792587459f},
-std::array<float,2>{0.991387606f, 0.00236544316f},
-std::array<float,2>{0.408190817f, 0.684512496f},
-std::array<float,2>{0.292894065f, 0.17952618f},
-std::array<float,2>{0.845733106f, 0.61340636f},
-std::array<float,2>{0.593495369f, 0.281039864f},
-std::array<float,2>{0.175944373f, 0.973491728f},
-std::array<float,2>{0.200339913f, 0.116001748f},
-std::array<float,2>{0.541519225f, 0.733622968f},
-std::array<float,2>{0.751385093f, 0.440091521f},
-std::array<float,2>{0.363017768f, 0.85328573f},
-std::array<float,2>{0.470166028f, 0.341769427f},
-std::array<float,2>{0.893976212f, 0.91439867f},
-std::array<float,2>{0.675120533f, 0.220832855f},
-std::array<float,2>{0.0461459868f, 0.528345823f},
-std::array<float,2>{0.239878193f, 0.460105717f},
-std::array<float,2>{0.511229038f, 0.864231229f},
-std::array<float,2>{0.794785082f, 0.0943704918f},
-std::array<float,2>{0.318874687f, 0.746819198f},
-std::array<float,2>{0.446675599f, 0.248745367f},
-std::array<float,2>{0.906949937f, 0.506165922f},
-std::array<float,2>{0.632696271f, 0.327618569f},
-std::array<float,2>{0.00174790516f, 0.935780466f},
-std::array<float,2>{0.120218776f, 0.0246240385f},
-std::array<float,2>{0.700297356f, 0.666666627f},
-std::array<float,2>{0.959116518f, 0.400251687f},
-std::array<float,2>{0.377978086f, 0.80852288f},
-std::array<float,2>{0.265033245f, 0.254071414f},
-std::array<float,2>{0.82251668f, 0.995732307f},
-std::array<float,2>{0.613029778f, 0.160887331f},
-std::array<float,2>{0.138259694f, 0.602495074f},
-std::array<float,2>{0.0504731461f, 0.367032617f},
-std::array<float,2>{0.65752238f, 0.892356515f},
-std::array<float,2>{0.887982726f, 0.204207972f},
-std::array<float,2>{0.498784781f, 0.555419803f},
-std::array<float,2>{0.35390079f, 0.0864852443f},
-std::array<float,2>{0.767878056f, 0.715659797f},
-std::array<float,2>{0.54881686f, 0.481584698f},
-std::array<float,2>{0.203173578f, 0.840575933f},
-std::array<float,2>{0.163097635f, 0.127763435f},
-std::array<float,2>{0.570450902f, 0.587983489f},
-std::array<float,2>{0.863775492f, 0.297992915f},
-std::array<float,2>{0.299052685f, 0.949696481f},
-std::array<float,2>{0.436480761f, 0.432574689f},
-std::array<float,2>{0.971467137f, 0.760102868f},
-std::array<float,2>{0.726706862f, 0.0462920554f},
-std::array<float,2>{0.091790475f, 0.650774479f},
-std::array<float,2>{0.213452235f, 0.316521138f},
-std::array<float,2>{0.561668336f, 0.928078949f},
-std::array<float,2>{0.776909411f, 0.237717226f},
-std::array<float,2>{0.351429939f, 0.509677112f},
-std::array<float,2>{0.492009282f, 0.105951965f},
-std::array<float,2>{0.879177511f, 0.736237526f},
-std::array<float,2>{0.6705845f, 0.462431639f},
-std::array<float,2>{0.0612068065f, 0.874446511f},
-std::array<float,2>{0.0815673843f, 0.170469373f},
-std::array<float,2>{0.721858561f, 0.599820077f},
-std::array<float,2>{0.981862903f, 0.26310876f},
-std::array<float,2>{0.425462008f, 0.991643369f},
-std::array<float,2>{0.307751894f, 0.396186858f},
-std::array<float,2>{0.874046564f, 0.804041624f},
-std::array<float,2>{0.569951117f, 0.019444963f},
-std::array<float,2>{0.171115547f, 0.660293341f},
-std::array<float,2>{0.0085110534f, 0.468988746f},
-std::array<float,2>{0.639578581f, 0.835118175f},
-std::array<float,2>{0.914865732f, 0.0854911581f},
-std::array<float,2>{0.442733228f, 0.710793197f},
-std::array<float,2>{0.323222637f, 0.211969852f},
-std::array<float,2>{0.783962667f, 0.551662624f},
-std::array<float,2>{0.505419433f, 0.36907208f},
-std::array<float,2>{0.24278143f, 0.903631985f},
-std::array<float,2>{0.127789497f, 0.0348263308f},
-std::array<float,2>{0.621666133f, 0.644959211f},
-std::array<float,2>{0.814957857f, 0.423676431f},
-std::array<float,2>{0.256710231f, 0.752800286f},
-std::array<float,2>{0.387582362f, 0.310679227f},
-std::array<float,2>{0.961145341f, 0.941216111f},
-std::array<float,2>{0.687714815f, 0.134524867f},
-std::array<float,2>{0.109844998f, 0.585903883f},
-std::array<float,2>{0.181105688f, 0.421305865f},
-std::array<float,2>{0.581640363f, 0.774374008f},
-std::array<float,2>{0.856291056f, 0.0504044369f},
-std::array<float,2>{0.284496129f, 0.629555881f},
-std::array<float,2>{0.419997007f, 0.144781858f},
-std::array<float,2>{0.993747473f, 0.573482811f},
-std::array<float,2>{0.739885032f, 0.287645698f},
-std::array<float,2>{0.0712271854f, 0.963606238f},
-std::array<float,2>{0.0334375985f, 0.0629083365f},
-std::array<float,2>{0.684639633f, 0.690540493f},
-std::array<float,2>{0.905785441f, 0.4975743f},
-std::array<float,2>{0.484314144f, 0.812865257f},
-std::array<float,2>{0.368946493f, 0.358678281f},
-std::array<float,2>{0.764058411f, 0.887983739f},
-std::array<float,2>{0.533399522f, 0.188899994f},
-std::array<float,2>{0.190262973f, 0.53956306f},
-std::array<float,2>{0.10760095f, 0.2681337f},
-std::array<float,2>{0.707911849f, 0.984123826f},
-std::array<float,2>{0.944805682f, 0.183670431f},
-std::array<float,2>{0.397608966f, 0.618664503f},
-std::array<float,2>{0.270572811f, 0.0103427358f},
-std::array<float,2>{0.840440273f, 0.673052609f},
-std::array<float,2>{0.606520116f, 0.382106692f},
-std::array<float,2>{0.144902751f, 0.788760483f},
-std::array<float,2>{0.220080554f, 0.226767004f},
-std::array<float,2>{0.517194748f, 0.515965164f},
-std::array<float,2>{0.80209893f, 0.331546634f},
-std::array<float,2>{0.3421821f, 0.911297441f},
-std::array<float,2>{0.464072675f, 0.450636446f},
-std::array<float,2>{0.936159015f, 0.850724041f},
-std::array<float,2>{0.649397671f, 0.117874287f},
-std::array<float,2>{0.0209291112f, 0.719857395f},
-std::array<float,2>{0.164907262f, 0.34375146f},
-std::array<float,2>{0.564688504f, 0.875014424f},
-std::array<float,2>{0.868781745f, 0.201890081f},
-std::array<float,2>{0.311961353f, 0.53260535f},
-std::array<float,2>{0.426636249f, 0.0706873536f},
-std::array<float,2>{0.978371501f, 0.702433348f},
-std::array<float,2>{0.725433171f, 0.485311091f},
-std::array<float,2>{0.0827699527f, 0.824279666f},
-std::array<float,2>{0.0568913519f, 0.152716771f},
-std::array<float,2>{0.664155781f, 0.562580168f},
-std::array<float,2>{0.875423431f, 0.296244681f},
-std::array<float,2>{0.486745119f, 0.960033834f},
-std::array<float,2>{0.346744984f, 0.412259251f},
-std::array<float,2>{0.779344738f, 0.768994689f},
-std::array<float,2>{0.555660725f, 0.0584198385f},
-std::array<float,2>{0.218580052f, 0.639009535f},
-std::array<float,2>{0.115165778f, 0.445180297f},
-std::array<float,2>{0.695008218f, 0.857933462f},
-std::array<float,2>{0.965993464f, 0.111069731f},
-std::array<float,2>{0.385032892f, 0.729092062f},
-std::array<float,2>{0.251008838f, 0.223432496f},
-std::array<float,2>{0.81894058f, 0.526312053f},
-std::array<float,2>{0.620034754f, 0.33685416f},
-std::array<float,2>{0.129933536f, 0.918174744f},
-std::array<float,2>{0.248879343f, 0.00428250944f},
-std::array<float,2>{0.503127396f, 0.681467235f},
-std::array<float,2>{0.787154019f, 0.388650268f},
-std::array<float,2>{0.324443161f, 0.795219541f},
-std::array<float,2>{0.438594103f, 0.276493192f},
-std::array<float,2>{0.918370545f, 0.970345497f},
-std::array<float,2>{0.632963002f, 0.172983781f},
-std::array<float,2>{0.0141925588f, 0.613039017f},
-std::array<float,2>{0.193785667f, 0.404888898f},
-std::array<float,2>{0.536260009f, 0.812234581f},
-std::array<float,2>{0.759770393f, 0.0295715202f},
-std::array<float,2>{0.372314721f, 0.671814382f},
-std::array<float,2>{0.478247434f, 0.158266842f},
-std::array<float,2>{0.899630845f, 0.60646069f},
-std::array<float,2>{0.683434129f, 0.25216341f},
-std::array<float,2>{0.0367728807f, 0.996657431f},
-std::array<float,2>{0.075241074f, 0.0995649993f},
-std::array<float,2>{0.73812294f, 0.745065272f},
-std::array<float,2>{0.999494255f, 0.453647554f},
-std::array<float,2>{0.415330917f, 0.862790346f},
-std::array<float,2>{0.286644042f, 0.32239449f},
-std::array<float,2>{0.853087723f, 0.930636644f},
-std::array<float,2>{0.5843606f, 0.242196321f},
-std::array<float,2>{0.186515614f, 0.501327157f},
-std::array<float,2>{0.0176550746f, 0.303738862f},
-std::array<float,2>{0.653731167f, 0.947309852f},
-std::array<float,2>{0.930308819f, 0.128975362f},
-std::array<float,2>{0.4671202f, 0.592501283f},
-std::array<float,2>{0.33932659f, 0.0425834171f},
-std::array<float,2>{0.798338056f, 0.656163692f},
-std::array<float,2>{0.520902157f, 0.434638023f},
-std::array<float,2>{0.224246785f, 0.763040006f},
-std::array<float,2>{0.14157629f, 0.210513905f},
-std::array<float,2>{0.60229224f, 0.55905807f},
-std::array<float,2>{0.839644611f, 0.360907495f},
-std::array<float,2>{0.268271625f, 0.898177087f},
-std::array<float,2>{0.39181608f, 0.477369398f},
-std::array<float,2>{0.937678993f, 0.838600218f},
-std::array<float,2>{0.706873953f, 0.0917827487f},
-std::array<float,2>{0.102997825f, 0.711776674f},
-std::array<float,2>{0.227951482f, 0.2605156f},
-std::array<float,2>{0.524175465f, 0.986160576f},
-std::array<float,2>{0.805500686f, 0.166617885f},
-std::array<float,2>{0.330844581f, 0.595110536f},
-std::array<float,2>{0.455746263f, 0.022433117f},
-std::array<float,2>{0.923463762f, 0.658446491f},
-std::array<float,2>{0.64197588f, 0.391407102f},
-std::array<float,2>{0.0269115586f, 0.79930073f},
-std::array<float,2>{0.100519426f, 0.240292341f},
-std::array<float,2>{0.716509998f, 0.514919639f},
-std::array<float,2>{0.945907474f, 0.314003795f},
-std::array<float,2>{0.403294146f, 0.92223531f},
-std::array<float,2>{0.279431671f, 0.466218829f},
-std::array<float,2>{0.831986248f, 0.867902756f},
-std::array<float,2>{0.600149512f, 0.103665501f},
-std::array<float,2>{0.153213501f, 0.741622984f},
-std::array<float,2>{0.041709207f, 0.42902872f},
-std::array<float,2>{0.676592588f, 0.755483627f},
-std::array<float,2>{0.897405684f, 0.0382558368f},
-std::array<float,2>{0.473647803f, 0.640760541f},
-std::array<float,2>{0.364580423f, 0.139957458f},
-std::array<float,2>{0.756105006f, 0.57897228f},
-std::array<float,2>{0.544394791f, 0.304926217f},
-std::array<float,2>{0.195763141f, 0.94474262f},
-std::array<float,2>{0.175604999f, 0.081615001f},
-std::array<float,2>{0.588918447f, 0.703197062f},
-std::array<float,2>{0.849013269f, 0.475201309f},
-std::array<float,2>{0.295562118f, 0.829957724f},
-std::array<float,2>{0.412756413f, 0.373582453f},
-std::array<float,2>{0.98597759f, 0.902327001f},
-std::array<float,2>{0.748684645f, 0.217797115f},
-std::array<float,2>{0.0629566014f, 0.548253238f},
-std::array<float,2>{0.133454576f, 0.493767172f},
-std::array<float,2>{0.613616467f, 0.816914022f},
-std::array<float,2>{0.826974928f, 0.069585748f},
-std::array<float,2>{0.259471983f, 0.695084214f},
-std::array<float,2>{0.382665813f, 0.192175522f},
-std::array<float,2>{0.956498444f, 0.54362464f},
-std::array<float,2>{0.697990835f, 0.35425204f},
-std::array<float,2>{0.121581689f, 0.883307934f},
-std::array<float,2>{0.00728450483f, 0.0531567298f},
-std::array<float,2>{0.626342356f, 0.625388086f},
-std::array<float,2>{0.912053287f, 0.415335953f},
-std::array<float,2>{0.449549973f, 0.780626476f},
-std::array<float,2>{0.315308422f, 0.282514304f},
-std::array<float,2>{0.792491019f, 0.968244612f},
-std::array<float,2>{0.514424562f, 0.143972829f},
-std::array<float,2>{0.237326935f, 0.575227559f},
-std::array<float,2>{0.0894245878f, 0.332997441f},
-std::array<float,2>{0.732596874f, 0.909927428f},
-std::array<float,2>{0.973749578f, 0.23136121f},
-std::array<float,2>{0.432217002f, 0.521343589f},
-std::array<float,2>{0.304139853f, 0.122310296f},
-std::array<float,2>{0.862425327f, 0.724548995f},
-std::array<float,2>{0.574420393f, 0.44589439f},
-std::array<float,2>{0.156749845f, 0.846525967f},
-std::array<float,2>{0.208369017f, 0.181864575f},
-std::array<float,2>{0.553392291f, 0.621397436f},
-std::array<float,2>{0.770191073f, 0.272983849f},
-std::array<float,2>{0.356553853f, 0.977978885f},
-std::array<float,2>{0.49599123f, 0.378502816f},
-std::array<float,2>{0.886564195f, 0.784810066f},
-std::array<float,2>{0.662789464f, 0.0131514091f},
-std::array<float,2>{0.0517630391f, 0.678267539f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.304809839f, 0.102835521f},
-std::array<float,2>{0.998853743f, 0.774885356f},
-std::array<float,2>{0.112486251f, 0.703025758f},
-std::array<float,2>{0.736032069f, 0.277925581f},
-std::array<float,2>{0.207099423f, 0.379034638f},
-std::array<float,2>{0.614518523f, 0.565281153f},
-std::array<float,2>{0.468964577f, 0.882889271f},
-std::array<float,2>{0.767398655f, 0.160472199f},
-std::array<float,2>{0.382961184f, 0.374637663f},
-std::array<float,2>{0.813934505f, 0.640898645f},
-std::array<float,2>{0.169172823f, 0.818130553f},
-std::array<float,2>{0.529636025f, 0.0344299041f},
-std::array<float,2>{0.0615013093f, 0.244930789f},
-std::array<float,2>{0.643981457f, 0.955900133f},
-std::array<float,2>{0.350905091f, 0.535733998f},
-std::array<float,2>{0.880506933f, 0.437902063f},
-std::array<float,2>{0.452079564f, 0.147200242f},
-std::array<float,2>{0.800461411f, 0.929331124f},
-std::array<float,2>{0.238805816f, 0.621243f},
-std::array<float,2>{0.581449986f, 0.415501773f},
-std::array<float,2>{0.0849565417f, 0.303767562f},
-std::array<float,2>{0.7069242f, 0.725076199f},
-std::array<float,2>{0.267885149f, 0.804573119f},
-std::array<float,2>{0.959928155f, 0.0745538175f},
-std::array<float,2>{0.323562235f, 0.474771976f},
-std::array<float,2>{0.917953372f, 0.527828455f},
-std::array<float,2>{0.00995212048f, 0.98830533f},
-std::array<float,2>{0.671968639f, 0.212314487f},
-std::array<float,2>{0.14966242f, 0.00212326832f},
-std::array<float,2>{0.537960529f, 0.850923121f},
-std::array<float,2>{0.421871662f, 0.679733336f},
-std::array<float,2>{0.843809783f, 0.328708261f},
-std::array<float,2>{0.366540551f, 0.187957659f},
-std::array<float,2>{0.904794216f, 0.978954971f},
-std::array<float,2>{0.0388334431f, 0.504888117f},
-std::array<float,2>{0.627282381f, 0.49250114f},
-std::array<float,2>{0.18096979f, 0.313533098f},
-std::array<float,2>{0.505917668f, 0.666091323f},
-std::array<float,2>{0.398305029f, 0.860681772f},
-std::array<float,2>{0.83994329f, 0.0295750592f},
-std::array<float,2>{0.489538908f, 0.426052004f},
-std::array<float,2>{0.76022619f, 0.597419322f},
-std::array<float,2>{0.197558329f, 0.908030689f},
-std::array<float,2>{0.605131507f, 0.129572064f},
-std::array<float,2>{0.0948383883f, 0.0862392783f},
-std::array<float,2>{0.729729533f, 0.781582117f},
-std::array<float,2>{0.292680889f, 0.73958981f},
-std::array<float,2>{0.979784846f, 0.295650572f},
-std::array<float,2>{0.432719797f, 0.0622791573f},
-std::array<float,2>{0.861477613f, 0.837731779f},
-std::array<float,2>{0.131987706f, 0.632260501f},
-std::array<float,2>{0.555926979f, 0.346097022f},
-std::array<float,2>{0.0223953556f, 0.455002517f},
-std::array<float,2>{0.658322513f, 0.549851179f},
-std::array<float,2>{0.338343412f, 0.938943386f},
-std::array<float,2>{0.936422944f, 0.224749774f},
-std::array<float,2>{0.2571536f, 0.260994732f},
-std::array<float,2>{0.940714896f, 0.706849813f},
-std::array<float,2>{0.0726912543f, 0.76323235f},
-std::array<float,2>{0.695064723f, 0.111171514f},
-std::array<float,2>{0.220323503f, 0.182453871f},
-std::array<float,2>{0.568377972f, 0.900766432f},
-std::array<float,2>{0.459000885f, 0.592972696f},
-std::array<float,2>{0.785379291f, 0.396643937f},
-std::array<float,2>{0.334184349f, 0.0214338358f},
-std::array<float,2>{0.926756322f, 0.874673128f},
-std::array<float,2>{0.0265131313f, 0.661754906f},
-std::array<float,2>{0.666128576f, 0.324030846f},
-std::array<float,2>{0.139665946f, 0.487177372f},
-std::array<float,2>{0.548648417f, 0.508015335f},
-std::array<float,2>{0.428019732f, 0.975347161f},
-std::array<float,2>{0.871538281f, 0.197932214f},
-std::array<float,2>{0.467122912f, 0.286220998f},
-std::array<float,2>{0.794152617f, 0.74712199f},
-std::array<float,2>{0.23096782f, 0.789464772f},
-std::array<float,2>{0.573674381f, 0.0786947906f},
-std::array<float,2>{0.0696482062f, 0.136534125f},
-std::array<float,2>{0.701591074f, 0.920585811f},
-std::array<float,2>{0.262051105f, 0.604200244f},
-std::array<float,2>{0.951621354f, 0.430379927f},
-std::array<float,2>{0.402192742f, 0.233137667f},
-std::array<float,2>{0.829359591f, 0.947957575f},
-std::array<float,2>{0.176406667f, 0.560065806f},
-std::array<float,2>{0.514233172f, 0.468121588f},
-std::array<float,2>{0.0409206897f, 0.353684187f},
-std::array<float,2>{0.634015739f, 0.637891173f},
-std::array<float,2>{0.36969623f, 0.831664026f},
-std::array<float,2>{0.896720469f, 0.0480729975f},
-std::array<float,2>{0.289026797f, 0.405298233f},
-std::array<float,2>{0.97306639f, 0.584859371f},
-std::array<float,2>{0.104599312f, 0.893032074f},
-std::array<float,2>{0.718850076f, 0.175662354f},
-std::array<float,2>{0.194622219f, 0.121157378f},
-std::array<float,2>{0.594812334f, 0.755587459f},
-std::array<float,2>{0.497310072f, 0.712870777f},
-std::array<float,2>{0.756741166f, 0.251612306f},
-std::array<float,2>{0.274972111f, 0.166423813f},
-std::array<float,2>{0.968527377f, 0.877947211f},
-std::array<float,2>{0.093673341f, 0.572995007f},
-std::array<float,2>{0.715698183f, 0.384625286f},
-std::array<float,2>{0.249799475f, 0.268092275f},
-std::array<float,2>{0.592964351f, 0.688342988f},
-std::array<float,2>{0.440294474f, 0.770079792f},
-std::array<float,2>{0.806797683f, 0.0998981521f},
-std::array<float,2>{0.411567807f, 0.451595515f},
-std::array<float,2>{0.854601622f, 0.540527761f},
-std::array<float,2>{0.142730549f, 0.964255333f},
-std::array<float,2>{0.539248943f, 0.2412166f},
-std::array<float,2>{0.00559100183f, 0.041961804f},
-std::array<float,2>{0.686599314f, 0.826033175f},
-std::array<float,2>{0.314951152f, 0.651480675f},
-std::array<float,2>{0.908818722f, 0.366192281f},
-std::array<float,2>{0.478714108f, 0.0696526766f},
-std::array<float,2>{0.779240429f, 0.811748862f},
-std::array<float,2>{0.218421742f, 0.729763448f},
-std::array<float,2>{0.620140016f, 0.312139362f},
-std::array<float,2>{0.121165909f, 0.408777863f},
-std::array<float,2>{0.742872536f, 0.610163689f},
-std::array<float,2>{0.303973973f, 0.932698548f},
-std::array<float,2>{0.988023162f, 0.152234644f},
-std::array<float,2>{0.353068471f, 0.336891294f},
-std::array<float,2>{0.887245834f, 0.679172218f},
-std::array<float,2>{0.0511167757f, 0.857332766f},
-std::array<float,2>{0.654862583f, 0.012749183f},
-std::array<float,2>{0.156588435f, 0.208279788f},
-std::array<float,2>{0.520456731f, 0.994121015f},
-std::array<float,2>{0.379841059f, 0.522187889f},
-std::array<float,2>{0.828058958f, 0.477502614f},
-std::array<float,2>{0.346693873f, 0.0847905129f},
-std::array<float,2>{0.877353609f, 0.796411753f},
-std::array<float,2>{0.0564702451f, 0.744897425f},
-std::array<float,2>{0.646652699f, 0.282735348f},
-std::array<float,2>{0.166775227f, 0.435503215f},
-std::array<float,2>{0.52654779f, 0.608510196f},
-std::array<float,2>{0.387111604f, 0.916029394f},
-std::array<float,2>{0.819481194f, 0.13798283f},
-std::array<float,2>{0.473462224f, 0.325744539f},
-std::array<float,2>{0.770124674f, 0.659227014f},
-std::array<float,2>{0.206381485f, 0.869551301f},
-std::array<float,2>{0.612687945f, 0.0181082711f},
-std::array<float,2>{0.113374576f, 0.202916652f},
-std::array<float,2>{0.741639793f, 0.970778167f},
-std::array<float,2>{0.308964342f, 0.512725174f},
-std::array<float,2>{0.99404645f, 0.490790009f},
-std::array<float,2>{0.417957991f, 0.175950214f},
-std::array<float,2>{0.849852741f, 0.897056043f},
-std::array<float,2>{0.15478687f, 0.580758214f},
-std::array<float,2>{0.53448236f, 0.402342945f},
-std::array<float,2>{0.0148212612f, 0.255388826f},
-std::array<float,2>{0.675848305f, 0.718262553f},
-std::array<float,2>{0.327397704f, 0.751206577f},
-std::array<float,2>{0.918878496f, 0.117676988f},
-std::array<float,2>{0.270772576f, 0.461362094f},
-std::array<float,2>{0.95315063f, 0.557051659f},
-std::array<float,2>{0.0819525346f, 0.950212598f},
-std::array<float,2>{0.707049072f, 0.228177339f},
-std::array<float,2>{0.235471025f, 0.0527964905f},
-std::array<float,2>{0.582504094f, 0.835659087f},
-std::array<float,2>{0.447635084f, 0.633227587f},
-std::array<float,2>{0.803265989f, 0.357884705f},
-std::array<float,2>{0.293372273f, 0.235987127f},
-std::array<float,2>{0.982829571f, 0.96552968f},
-std::array<float,2>{0.0977619812f, 0.544423759f},
-std::array<float,2>{0.73313868f, 0.44703427f},
-std::array<float,2>{0.199250966f, 0.359886289f},
-std::array<float,2>{0.609066546f, 0.655960798f},
-std::array<float,2>{0.485147744f, 0.820861638f},
-std::array<float,2>{0.763415694f, 0.0432793014f},
-std::array<float,2>{0.392758906f, 0.389108062f},
-std::array<float,2>{0.83801204f, 0.575480759f},
-std::array<float,2>{0.185205922f, 0.881213367f},
-std::array<float,2>{0.500680685f, 0.169057548f},
-std::array<float,2>{0.0341687649f, 0.096553646f},
-std::array<float,2>{0.62908107f, 0.766222f},
-std::array<float,2>{0.361517668f, 0.69211036f},
-std::array<float,2>{0.90090847f, 0.271972239f},
-std::array<float,2>{0.456697226f, 0.00793868955f},
-std::array<float,2>{0.782934606f, 0.85492897f},
-std::array<float,2>{0.223230556f, 0.671886861f},
-std::array<float,2>{0.563159645f, 0.34077093f},
-std::array<float,2>{0.0755585283f, 0.48078239f},
-std::array<float,2>{0.691208184f, 0.517095089f},
-std::array<float,2>{0.251265824f, 0.998751521f},
-std::array<float,2>{0.942373812f, 0.206056505f},
-std::array<float,2>{0.342344493f, 0.305729538f},
-std::array<float,2>{0.933088481f, 0.73260659f},
-std::array<float,2>{0.0177944079f, 0.805308402f},
-std::array<float,2>{0.660169899f, 0.0632120296f},
-std::array<float,2>{0.12563619f, 0.152368724f},
-std::array<float,2>{0.561648011f, 0.935571432f},
-std::array<float,2>{0.43383646f, 0.615872085f},
-std::array<float,2>{0.865073919f, 0.411354989f},
-std::array<float,2>{0.260184288f, 0.036826659f},
-std::array<float,2>{0.947640002f, 0.814107895f},
-std::array<float,2>{0.0660527572f, 0.646180391f},
-std::array<float,2>{0.698126376f, 0.370392054f},
-std::array<float,2>{0.226812258f, 0.443608016f},
-std::array<float,2>{0.577242553f, 0.533006012f},
-std::array<float,2>{0.461255997f, 0.960154235f},
-std::array<float,2>{0.792558968f, 0.246864766f},
-std::array<float,2>{0.424828053f, 0.276870936f},
-std::array<float,2>{0.869278729f, 0.698915243f},
-std::array<float,2>{0.13294813f, 0.777608573f},
-std::array<float,2>{0.554395616f, 0.108487397f},
-std::array<float,2>{0.028220227f, 0.158846006f},
-std::array<float,2>{0.670678914f, 0.889712393f},
-std::array<float,2>{0.329504848f, 0.569899261f},
-std::array<float,2>{0.922276855f, 0.378862023f},
-std::array<float,2>{0.494734228f, 0.215893373f},
-std::array<float,2>{0.750384569f, 0.988082707f},
-std::array<float,2>{0.190495506f, 0.525947571f},
-std::array<float,2>{0.601191223f, 0.468794256f},
-std::array<float,2>{0.107486598f, 0.333119839f},
-std::array<float,2>{0.725176871f, 0.687079787f},
-std::array<float,2>{0.281880409f, 0.845712602f},
-std::array<float,2>{0.972355664f, 0.00563780498f},
-std::array<float,2>{0.374472708f, 0.419954717f},
-std::array<float,2>{0.894506991f, 0.617421567f},
-std::array<float,2>{0.0447672643f, 0.923554301f},
-std::array<float,2>{0.639763534f, 0.142442465f},
-std::array<float,2>{0.172925085f, 0.0738781393f},
-std::array<float,2>{0.511195362f, 0.797949195f},
-std::array<float,2>{0.406019688f, 0.721953571f},
-std::array<float,2>{0.832948506f, 0.30039376f},
-std::array<float,2>{0.316460282f, 0.125233307f},
-std::array<float,2>{0.913535297f, 0.910302341f},
-std::array<float,2>{0.00128868187f, 0.600961387f},
-std::array<float,2>{0.681541622f, 0.424084634f},
-std::array<float,2>{0.145530537f, 0.29071641f},
-std::array<float,2>{0.546475291f, 0.737207353f},
-std::array<float,2>{0.409761697f, 0.788648129f},
-std::array<float,2>{0.856202662f, 0.0928985551f},
-std::array<float,2>{0.442422539f, 0.497216731f},
-std::array<float,2>{0.809414685f, 0.500447273f},
-std::array<float,2>{0.245939091f, 0.982571304f},
-std::array<float,2>{0.587680936f, 0.194582269f},
-std::array<float,2>{0.0869787186f, 0.0262148231f},
-std::array<float,2>{0.714758635f, 0.866493464f},
-std::array<float,2>{0.279784709f, 0.670086026f},
-std::array<float,2>{0.964581251f, 0.319494098f},
-std::array<float,2>{0.377115577f, 0.1154228f},
-std::array<float,2>{0.822610497f, 0.760296941f},
-std::array<float,2>{0.160799503f, 0.707165122f},
-std::array<float,2>{0.518844128f, 0.262416184f},
-std::array<float,2>{0.0478721671f, 0.392835587f},
-std::array<float,2>{0.652205884f, 0.587845922f},
-std::array<float,2>{0.359331101f, 0.903967083f},
-std::array<float,2>{0.885367334f, 0.187342554f},
-std::array<float,2>{0.300135791f, 0.350735337f},
-std::array<float,2>{0.992176056f, 0.627501011f},
-std::array<float,2>{0.118857607f, 0.841650486f},
-std::array<float,2>{0.747254848f, 0.0578000993f},
-std::array<float,2>{0.211606562f, 0.221098751f},
-std::array<float,2>{0.622422516f, 0.943509996f},
-std::array<float,2>{0.483644843f, 0.552520514f},
-std::array<float,2>{0.773987651f, 0.459862083f},
-std::array<float,2>{0.266993463f, 0.0780699551f},
-std::array<float,2>{0.957356572f, 0.801928043f},
-std::array<float,2>{0.0831095129f, 0.72382158f},
-std::array<float,2>{0.703686178f, 0.302303225f},
-std::array<float,2>{0.241848439f, 0.416096121f},
-std::array<float,2>{0.579807401f, 0.624701679f},
-std::array<float,2>{0.450324714f, 0.927249968f},
-std::array<float,2>{0.798110127f, 0.145953715f},
-std::array<float,2>{0.419513643f, 0.330668837f},
-std::array<float,2>{0.846283138f, 0.682651758f},
-std::array<float,2>{0.152057007f, 0.84856534f},
-std::array<float,2>{0.535303175f, 0.00069768168f},
-std::array<float,2>{0.00904107653f, 0.213908389f},
-std::array<float,2>{0.675665498f, 0.991350055f},
-std::array<float,2>{0.321569264f, 0.530942082f},
-std::array<float,2>{0.914711118f, 0.474133015f},
-std::array<float,2>{0.470832944f, 0.162413061f},
-std::array<float,2>{0.768152416f, 0.884828687f},
-std::array<float,2>{0.210619077f, 0.563341618f},
-std::array<float,2>{0.616469681f, 0.3827627f},
-std::array<float,2>{0.110099718f, 0.279437929f},
-std::array<float,2>{0.736606896f, 0.701070011f},
-std::array<float,2>{0.307474345f, 0.776608884f},
-std::array<float,2>{0.996314943f, 0.1049603f},
-std::array<float,2>{0.348831058f, 0.440667957f},
-std::array<float,2>{0.882479012f, 0.538219094f},
-std::array<float,2>{0.0586714968f, 0.955046475f},
-std::array<float,2>{0.641665578f, 0.24270764f},
-std::array<float,2>{0.171076909f, 0.0318641961f},
-std::array<float,2>{0.527954698f, 0.81914258f},
-std::array<float,2>{0.385144383f, 0.643729925f},
-std::array<float,2>{0.814682007f, 0.372950524f},
-std::array<float,2>{0.336363375f, 0.223696098f},
-std::array<float,2>{0.933836818f, 0.939705074f},
-std::array<float,2>{0.0210443102f, 0.54725039f},
-std::array<float,2>{0.656528473f, 0.455705613f},
-std::array<float,2>{0.129434839f, 0.344828993f},
-std::array<float,2>{0.557063162f, 0.629306078f},
-std::array<float,2>{0.430395186f, 0.839287758f},
-std::array<float,2>{0.86021632f, 0.0602075607f},
-std::array<float,2>{0.458444357f, 0.395180494f},
-std::array<float,2>{0.78807056f, 0.59100163f},
-std::array<float,2>{0.221520916f, 0.89908123f},
-std::array<float,2>{0.567023516f, 0.18094416f},
-std::array<float,2>{0.0719711185f, 0.112671405f},
-std::array<float,2>{0.692727864f, 0.76400429f},
-std::array<float,2>{0.254943103f, 0.705010772f},
-std::array<float,2>{0.937831938f, 0.259643674f},
-std::array<float,2>{0.394685894f, 0.0274424646f},
-std::array<float,2>{0.842195511f, 0.861963809f},
-std::array<float,2>{0.18205823f, 0.664096773f},
-std::array<float,2>{0.505670071f, 0.314678341f},
-std::array<float,2>{0.0357619226f, 0.494230717f},
-std::array<float,2>{0.626892865f, 0.507559955f},
-std::array<float,2>{0.364725977f, 0.978173256f},
-std::array<float,2>{0.904191375f, 0.190826952f},
-std::array<float,2>{0.289653867f, 0.293916225f},
-std::array<float,2>{0.977667749f, 0.742091537f},
-std::array<float,2>{0.097150065f, 0.784709752f},
-std::array<float,2>{0.727487922f, 0.0895150229f},
-std::array<float,2>{0.195876136f, 0.130934f},
-std::array<float,2>{0.60332638f, 0.909888506f},
-std::array<float,2>{0.491445512f, 0.595524192f},
-std::array<float,2>{0.759641707f, 0.428257495f},
-std::array<float,2>{0.367976844f, 0.0488372892f},
-std::array<float,2>{0.89560008f, 0.829614282f},
-std::array<float,2>{0.0420909114f, 0.639186502f},
-std::array<float,2>{0.635724306f, 0.352566332f},
-std::array<float,2>{0.17892468f, 0.466674834f},
-std::array<float,2>{0.513238311f, 0.562113643f},
-std::array<float,2>{0.399244815f, 0.946591258f},
-std::array<float,2>{0.831252337f, 0.23127757f},
-std::array<float,2>{0.499524891f, 0.25215286f},
-std::array<float,2>{0.755134821f, 0.71394366f},
-std::array<float,2>{0.191565573f, 0.756512463f},
-std::array<float,2>{0.596842885f, 0.123527765f},
-std::array<float,2>{0.101583987f, 0.172086909f},
-std::array<float,2>{0.721450627f, 0.890688837f},
-std::array<float,2>{0.287085325f, 0.58326f},
-std::array<float,2>{0.976442993f, 0.40427205f},
-std::array<float,2>{0.426647544f, 0.196152031f},
-std::array<float,2>{0.873294353f, 0.972885966f},
-std::array<float,2>{0.137950987f, 0.511691988f},
-std::array<float,2>{0.549329937f, 0.48489359f},
-std::array<float,2>{0.0234660897f, 0.320920646f},
-std::array<float,2>{0.664822459f, 0.66360867f},
-std::array<float,2>{0.333398789f, 0.871987939f},
-std::array<float,2>{0.929168999f, 0.0218441915f},
-std::array<float,2>{0.263846099f, 0.432634979f},
-std::array<float,2>{0.950891674f, 0.601927876f},
-std::array<float,2>{0.0665006414f, 0.91846478f},
-std::array<float,2>{0.700674117f, 0.134352401f},
-std::array<float,2>{0.233856246f, 0.0800864995f},
-std::array<float,2>{0.57157284f, 0.79249227f},
-std::array<float,2>{0.465120375f, 0.74901098f},
-std::array<float,2>{0.795948803f, 0.287819594f},
-std::array<float,2>{0.30145672f, 0.148944557f},
-std::array<float,2>{0.985619366f, 0.931323469f},
-std::array<float,2>{0.123271942f, 0.61280036f},
-std::array<float,2>{0.745706141f, 0.407386333f},
-std::array<float,2>{0.215525478f, 0.308858395f},
-std::array<float,2>{0.618365288f, 0.727592766f},
-std::array<float,2>{0.477874428f, 0.810121715f},
-std::array<float,2>{0.781127989f, 0.0666915774f},
-std::array<float,2>{0.381755799f, 0.479884326f},
-std::array<float,2>{0.824647665f, 0.520139933f},
-std::array<float,2>{0.158673465f, 0.994949222f},
-std::array<float,2>{0.521700144f, 0.209101364f},
-std::array<float,2>{0.0531376041f, 0.0155170942f},
-std::array<float,2>{0.654202104f, 0.858782351f},
-std::array<float,2>{0.354449958f, 0.676181018f},
-std::array<float,2>{0.890053034f, 0.338453412f},
-std::array<float,2>{0.43941471f, 0.0985354409f},
-std::array<float,2>{0.805647671f, 0.772364914f},
-std::array<float,2>{0.247542098f, 0.690527737f},
-std::array<float,2>{0.59009707f, 0.26722312f},
-std::array<float,2>{0.090888679f, 0.384889305f},
-std::array<float,2>{0.718534529f, 0.571734846f},
-std::array<float,2>{0.276691973f, 0.87685138f},
-std::array<float,2>{0.966282368f, 0.165015996f},
-std::array<float,2>{0.313037872f, 0.364356637f},
-std::array<float,2>{0.907070756f, 0.64969945f},
-std::array<float,2>{0.00765576772f, 0.826379299f},
-std::array<float,2>{0.683601916f, 0.0397610217f},
-std::array<float,2>{0.141427621f, 0.240070626f},
-std::array<float,2>{0.541827023f, 0.960957348f},
-std::array<float,2>{0.413935721f, 0.541405737f},
-std::array<float,2>{0.852592468f, 0.450364351f},
-std::array<float,2>{0.326078385f, 0.119280547f},
-std::array<float,2>{0.92016995f, 0.75305289f},
-std::array<float,2>{0.0118380701f, 0.71660322f},
-std::array<float,2>{0.677887619f, 0.256775737f},
-std::array<float,2>{0.152386978f, 0.398917109f},
-std::array<float,2>{0.532140851f, 0.579057455f},
-std::array<float,2>{0.414083511f, 0.894920826f},
-std::array<float,2>{0.848893106f, 0.178560257f},
-std::array<float,2>{0.447228014f, 0.355742246f},
-std::array<float,2>{0.801544011f, 0.636349261f},
-std::array<float,2>{0.237849683f, 0.832810402f},
-std::array<float,2>{0.585006893f, 0.0521094017f},
-std::array<float,2>{0.0790755823f, 0.230154172f},
-std::array<float,2>{0.709558308f, 0.951326132f},
-std::array<float,2>{0.273089796f, 0.556633353f},
-std::array<float,2>{0.955359578f, 0.464199364f},
-std::array<float,2>{0.39035666f, 0.140330344f},
-std::array<float,2>{0.816513836f, 0.914396524f},
-std::array<float,2>{0.165078908f, 0.606172621f},
-std::array<float,2>{0.52347225f, 0.436895728f},
-std::array<float,2>{0.0572309978f, 0.283225268f},
-std::array<float,2>{0.6460886f, 0.742884815f},
-std::array<float,2>{0.345151454f, 0.793033004f},
-std::array<float,2>{0.876755714f, 0.0838635489f},
-std::array<float,2>{0.312258363f, 0.489308625f},
-std::array<float,2>{0.994687974f, 0.515359581f},
-std::array<float,2>{0.115972176f, 0.968799949f},
-std::array<float,2>{0.739944756f, 0.200976864f},
-std::array<float,2>{0.203985423f, 0.0159016345f},
-std::array<float,2>{0.609793007f, 0.868798077f},
-std::array<float,2>{0.47602284f, 0.657285035f},
-std::array<float,2>{0.772726834f, 0.327706784f},
-std::array<float,2>{0.253666133f, 0.205059707f},
-std::array<float,2>{0.944853783f, 0.996502101f},
-std::array<float,2>{0.0761974454f, 0.517636478f},
-std::array<float,2>{0.687715471f, 0.483448923f},
-std::array<float,2>{0.226464957f, 0.343504786f},
-std::array<float,2>{0.565031052f, 0.674125373f},
-std::array<float,2>{0.454396486f, 0.853190958f},
-std::array<float,2>{0.783530653f, 0.0102151819f},
-std::array<float,2>{0.436407596f, 0.412695199f},
-std::array<float,2>{0.866480052f, 0.614641964f},
-std::array<float,2>{0.12742874f, 0.934215307f},
-std::array<float,2>{0.55863446f, 0.155165955f},
-std::array<float,2>{0.0163283199f, 0.0659431592f},
-std::array<float,2>{0.662895918f, 0.806955576f},
-std::array<float,2>{0.340319306f, 0.730790198f},
-std::array<float,2>{0.931420088f, 0.30718556f},
-std::array<float,2>{0.487323791f, 0.0454921462f},
-std::array<float,2>{0.763714731f, 0.822810531f},
-std::array<float,2>{0.202530921f, 0.65280658f},
-std::array<float,2>{0.606147945f, 0.363014996f},
-std::array<float,2>{0.101083502f, 0.447282791f},
-std::array<float,2>{0.731865048f, 0.546581864f},
-std::array<float,2>{0.295820326f, 0.968081653f},
-std::array<float,2>{0.980841517f, 0.236457184f},
-std::array<float,2>{0.361014396f, 0.270160735f},
-std::array<float,2>{0.899787962f, 0.694117963f},
-std::array<float,2>{0.0314439423f, 0.768092155f},
-std::array<float,2>{0.632677794f, 0.0947477296f},
-std::array<float,2>{0.185846642f, 0.169945553f},
-std::array<float,2>{0.502523899f, 0.880564868f},
-std::array<float,2>{0.39070946f, 0.576623738f},
-std::array<float,2>{0.83678627f, 0.387731135f},
-std::array<float,2>{0.283327937f, 0.00778562296f},
-std::array<float,2>{0.969046235f, 0.844986498f},
-std::array<float,2>{0.106362f, 0.68450135f},
-std::array<float,2>{0.724377155f, 0.335205585f},
-std::array<float,2>{0.189174369f, 0.472340941f},
-std::array<float,2>{0.599220991f, 0.52397114f},
-std::array<float,2>{0.493109077f, 0.986079574f},
-std::array<float,2>{0.752324939f, 0.218190625f},
-std::array<float,2>{0.402800769f, 0.298060864f},
-std::array<float,2>{0.834494054f, 0.720533431f},
-std::array<float,2>{0.174777716f, 0.799212337f},
-std::array<float,2>{0.508874774f, 0.0710763112f},
-std::array<float,2>{0.0468220748f, 0.14317961f},
-std::array<float,2>{0.638483465f, 0.924568057f},
-std::array<float,2>{0.37229079f, 0.619733214f},
-std::array<float,2>{0.892232716f, 0.418609291f},
-std::array<float,2>{0.463880807f, 0.248910576f},
-std::array<float,2>{0.789391637f, 0.957989872f},
-std::array<float,2>{0.230051368f, 0.534307718f},
-std::array<float,2>{0.574246943f, 0.442846f},
-std::array<float,2>{0.0636570081f, 0.368527561f},
-std::array<float,2>{0.695560932f, 0.64786768f},
-std::array<float,2>{0.258517414f, 0.81512332f},
-std::array<float,2>{0.946419001f, 0.0390230529f},
-std::array<float,2>{0.330295682f, 0.375865847f},
-std::array<float,2>{0.925184429f, 0.567213893f},
-std::array<float,2>{0.0296866056f, 0.887312293f},
-std::array<float,2>{0.668738782f, 0.157217979f},
-std::array<float,2>{0.135874301f, 0.106899977f},
-std::array<float,2>{0.551135242f, 0.780073941f},
-std::array<float,2>{0.423716724f, 0.696038365f},
-std::array<float,2>{0.868128359f, 0.274555892f},
-std::array<float,2>{0.356226414f, 0.184725076f},
-std::array<float,2>{0.884543777f, 0.906240761f},
-std::array<float,2>{0.0488758646f, 0.588598013f},
-std::array<float,2>{0.650227427f, 0.392305911f},
-std::array<float,2>{0.163190335f, 0.26390034f},
-std::array<float,2>{0.517215252f, 0.709605455f},
-std::array<float,2>{0.375409365f, 0.758972287f},
-std::array<float,2>{0.821549714f, 0.113558508f},
-std::array<float,2>{0.480876416f, 0.458829284f},
-std::array<float,2>{0.777104914f, 0.554497182f},
-std::array<float,2>{0.212929487f, 0.94327414f},
-std::array<float,2>{0.623095095f, 0.219059452f},
-std::array<float,2>{0.120926321f, 0.0552383214f},
-std::array<float,2>{0.748993218f, 0.842979252f},
-std::array<float,2>{0.298337549f, 0.625263453f},
-std::array<float,2>{0.989200711f, 0.349529475f},
-std::array<float,2>{0.406507045f, 0.0904455334f},
-std::array<float,2>{0.858121395f, 0.786050677f},
-std::array<float,2>{0.147749528f, 0.735402644f},
-std::array<float,2>{0.544109225f, 0.292249292f},
-std::array<float,2>{0.00276439195f, 0.422382891f},
-std::array<float,2>{0.683502972f, 0.599093437f},
-std::array<float,2>{0.320253819f, 0.913289964f},
-std::array<float,2>{0.911149323f, 0.128423944f},
-std::array<float,2>{0.278000653f, 0.317525625f},
-std::array<float,2>{0.962333083f, 0.669151247f},
-std::array<float,2>{0.0885779411f, 0.864070296f},
-std::array<float,2>{0.712329149f, 0.0244434718f},
-std::array<float,2>{0.2424016f, 0.191745594f},
-std::array<float,2>{0.589673281f, 0.980487883f},
-std::array<float,2>{0.443430156f, 0.502150297f},
-std::array<float,2>{0.81217593f, 0.498667657f},
-std::array<float,2>{0.254475266f, 0.110197067f},
-std::array<float,2>{0.938998342f, 0.762675703f},
-std::array<float,2>{0.0708709434f, 0.705507934f},
-std::array<float,2>{0.692138195f, 0.259881198f},
-std::array<float,2>{0.222408921f, 0.398353457f},
-std::array<float,2>{0.567444265f, 0.592191935f},
-std::array<float,2>{0.457572937f, 0.901569486f},
-std::array<float,2>{0.78844887f, 0.183386162f},
-std::array<float,2>{0.431626588f, 0.347155899f},
-std::array<float,2>{0.860634029f, 0.631306052f},
-std::array<float,2>{0.130517483f, 0.836868227f},
-std::array<float,2>{0.557863057f, 0.0612085834f},
-std::array<float,2>{0.0199249201f, 0.226084933f},
-std::array<float,2>{0.657786727f, 0.937938154f},
-std::array<float,2>{0.336924762f, 0.549320638f},
-std::array<float,2>{0.934837759f, 0.453451246f},
-std::array<float,2>{0.490689635f, 0.129956454f},
-std::array<float,2>{0.758709848f, 0.906912386f},
-std::array<float,2>{0.197135925f, 0.596647978f},
-std::array<float,2>{0.601999283f, 0.427493632f},
-std::array<float,2>{0.0957770944f, 0.296036124f},
-std::array<float,2>{0.727755845f, 0.738834858f},
-std::array<float,2>{0.290886909f, 0.783170581f},
-std::array<float,2>{0.977009594f, 0.0875677913f},
-std::array<float,2>{0.364167631f, 0.493772805f},
-std::array<float,2>{0.903060973f, 0.504661083f},
-std::array<float,2>{0.0361385122f, 0.97960937f},
-std::array<float,2>{0.62576133f, 0.188944981f},
-std::array<float,2>{0.18339783f, 0.0304700881f},
-std::array<float,2>{0.504746377f, 0.8598876f},
-std::array<float,2>{0.395554096f, 0.667514026f},
-std::array<float,2>{0.842906356f, 0.312595516f},
-std::array<float,2>{0.320988148f, 0.211681992f},
-std::array<float,2>{0.915643394f, 0.989963174f},
-std::array<float,2>{0.00856188685f, 0.529074788f},
-std::array<float,2>{0.674155772f, 0.475857258f},
-std::array<float,2>{0.150988728f, 0.329936534f},
-std::array<float,2>{0.536557138f, 0.68141067f},
-std::array<float,2>{0.41809395f, 0.850225806f},
-std::array<float,2>{0.84760797f, 0.00328582223f},
-std::array<float,2>{0.449473917f, 0.41433391f},
-std::array<float,2>{0.797058821f, 0.622900307f},
-std::array<float,2>{0.241040841f, 0.927800655f},
-std::array<float,2>{0.578906357f, 0.147919342f},
-std::array<float,2>{0.0826460421f, 0.0759880096f},
-std::array<float,2>{0.704165161f, 0.803498566f},
-std::array<float,2>{0.266108841f, 0.72646451f},
-std::array<float,2>{0.958547652f, 0.303127915f},
-std::array<float,2>{0.386050463f, 0.0340912454f},
-std::array<float,2>{0.815926492f, 0.816469967f},
-std::array<float,2>{0.170270309f, 0.64169538f},
-std::array<float,2>{0.529153168f, 0.373336941f},
-std::array<float,2>{0.0604225546f, 0.439217538f},
-std::array<float,2>{0.641537309f, 0.536639929f},
-std::array<float,2>{0.347793758f, 0.95656693f},
-std::array<float,2>{0.881758571f, 0.245269611f},
-std::array<float,2>{0.308265597f, 0.278888851f},
-std::array<float,2>{0.997653663f, 0.701394141f},
-std::array<float,2>{0.110424362f, 0.773854017f},
-std::array<float,2>{0.737699866f, 0.102515459f},
-std::array<float,2>{0.20938766f, 0.162065536f},
-std::array<float,2>{0.616158605f, 0.884016216f},
-std::array<float,2>{0.471719563f, 0.566099524f},
-std::array<float,2>{0.769167125f, 0.379924178f},
-std::array<float,2>{0.354700893f, 0.0121092852f},
-std::array<float,2>{0.888938785f, 0.855540276f},
-std::array<float,2>{0.0542464741f, 0.677958846f},
-std::array<float,2>{0.653241634f, 0.337275296f},
-std::array<float,2>{0.160144523f, 0.477933645f},
-std::array<float,2>{0.52250886f, 0.522864521f},
-std::array<float,2>{0.382054716f, 0.992732406f},
-std::array<float,2>{0.825946927f, 0.20750533f},
-std::array<float,2>{0.476738989f, 0.311009794f},
-std::array<float,2>{0.779388726f, 0.729346931f},
-std::array<float,2>{0.216721758f, 0.810822785f},
-std::array<float,2>{0.61758697f, 0.0691827014f},
-std::array<float,2>{0.124166377f, 0.150969356f},
-std::array<float,2>{0.74476552f, 0.932473779f},
-std::array<float,2>{0.301758856f, 0.610424697f},
-std::array<float,2>{0.984865129f, 0.410153091f},
-std::array<float,2>{0.412767619f, 0.240255356f},
-std::array<float,2>{0.852506995f, 0.963262737f},
-std::array<float,2>{0.142445013f, 0.539834261f},
-std::array<float,2>{0.542880058f, 0.452772766f},
-std::array<float,2>{0.00622144202f, 0.36647436f},
-std::array<float,2>{0.684909463f, 0.650708497f},
-std::array<float,2>{0.314368248f, 0.824900329f},
-std::array<float,2>{0.907282352f, 0.0427743793f},
-std::array<float,2>{0.275395662f, 0.38328895f},
-std::array<float,2>{0.965051532f, 0.573358655f},
-std::array<float,2>{0.090674907f, 0.877218902f},
-std::array<float,2>{0.717489719f, 0.16733104f},
-std::array<float,2>{0.246840149f, 0.101105012f},
-std::array<float,2>{0.591361225f, 0.770754874f},
-std::array<float,2>{0.437730134f, 0.689339876f},
-std::array<float,2>{0.806076288f, 0.2685965f},
-std::array<float,2>{0.285751045f, 0.173918352f},
-std::array<float,2>{0.975422323f, 0.89395386f},
-std::array<float,2>{0.103027269f, 0.585490644f},
-std::array<float,2>{0.722174227f, 0.404594302f},
-std::array<float,2>{0.192938849f, 0.250140131f},
-std::array<float,2>{0.596377909f, 0.711738706f},
-std::array<float,2>{0.498600006f, 0.754712403f},
-std::array<float,2>{0.754662395f, 0.122410096f},
-std::array<float,2>{0.400256664f, 0.467242628f},
-std::array<float,2>{0.830481768f, 0.558881998f},
-std::array<float,2>{0.177752271f, 0.948620737f},
-std::array<float,2>{0.51212275f, 0.234267578f},
-std::array<float,2>{0.0412929952f, 0.0471710525f},
-std::array<float,2>{0.63624227f, 0.830624521f},
-std::array<float,2>{0.368359357f, 0.636770129f},
-std::array<float,2>{0.895345509f, 0.354631722f},
-std::array<float,2>{0.466548741f, 0.0796331689f},
-std::array<float,2>{0.794947088f, 0.790994704f},
-std::array<float,2>{0.232944489f, 0.746651292f},
-std::array<float,2>{0.571025789f, 0.28609392f},
-std::array<float,2>{0.0677356943f, 0.430873662f},
-std::array<float,2>{0.69933331f, 0.604947686f},
-std::array<float,2>{0.265391171f, 0.921375155f},
-std::array<float,2>{0.95002985f, 0.13561973f},
-std::array<float,2>{0.332875758f, 0.32296896f},
-std::array<float,2>{0.928235114f, 0.660861969f},
-std::array<float,2>{0.0253031924f, 0.873703897f},
-std::array<float,2>{0.665974319f, 0.0200505145f},
-std::array<float,2>{0.137625501f, 0.198857546f},
-std::array<float,2>{0.550123692f, 0.976263165f},
-std::array<float,2>{0.427268893f, 0.509205043f},
-std::array<float,2>{0.874184608f, 0.487926722f},
-std::array<float,2>{0.341249257f, 0.0635597259f},
-std::array<float,2>{0.93020618f, 0.805964768f},
-std::array<float,2>{0.0169939362f, 0.733690321f},
-std::array<float,2>{0.663522542f, 0.305649251f},
-std::array<float,2>{0.128520191f, 0.410180539f},
-std::array<float,2>{0.560204625f, 0.616752803f},
-std::array<float,2>{0.436550289f, 0.937308967f},
-std::array<float,2>{0.865723312f, 0.15388453f},
-std::array<float,2>{0.453581929f, 0.341075897f},
-std::array<float,2>{0.785023928f, 0.673322856f},
-std::array<float,2>{0.224988267f, 0.853567004f},
-std::array<float,2>{0.565986156f, 0.00972330384f},
-std::array<float,2>{0.0778809786f, 0.205847219f},
-std::array<float,2>{0.688606739f, 0.999918163f},
-std::array<float,2>{0.252226591f, 0.516548216f},
-std::array<float,2>{0.943996251f, 0.482286453f},
-std::array<float,2>{0.392269462f, 0.168865696f},
-std::array<float,2>{0.83757621f, 0.882789016f},
-std::array<float,2>{0.186825499f, 0.574887335f},
-std::array<float,2>{0.5034284f, 0.390010417f},
-std::array<float,2>{0.0324307121f, 0.272972226f},
-std::array<float,2>{0.631547272f, 0.692575634f},
-std::array<float,2>{0.359551698f, 0.767453313f},
-std::array<float,2>{0.898765147f, 0.0970560014f},
-std::array<float,2>{0.29644382f, 0.445547819f},
-std::array<float,2>{0.981694877f, 0.543189883f},
-std::array<float,2>{0.100285284f, 0.966355085f},
-std::array<float,2>{0.731020212f, 0.234585539f},
-std::array<float,2>{0.202140644f, 0.0446749367f},
-std::array<float,2>{0.606853783f, 0.821807921f},
-std::array<float,2>{0.487054229f, 0.654811561f},
-std::array<float,2>{0.765455902f, 0.361248434f},
-std::array<float,2>{0.272007167f, 0.227208659f},
-std::array<float,2>{0.95619607f, 0.949832141f},
-std::array<float,2>{0.0793564022f, 0.557696462f},
-std::array<float,2>{0.710365713f, 0.462689072f},
-std::array<float,2>{0.237167135f, 0.358875364f},
-std::array<float,2>{0.58406651f, 0.633989513f},
-std::array<float,2>{0.445603102f, 0.834370553f},
-std::array<float,2>{0.801877499f, 0.0543460809f},
-std::array<float,2>{0.415494531f, 0.400596291f},
-std::array<float,2>{0.848495185f, 0.581513286f},
-std::array<float,2>{0.154258013f, 0.897700787f},
-std::array<float,2>{0.533065081f, 0.177178144f},
-std::array<float,2>{0.0133245718f, 0.118677437f},
-std::array<float,2>{0.679341733f, 0.750100851f},
-std::array<float,2>{0.324467331f, 0.717133582f},
-std::array<float,2>{0.921574295f, 0.254064858f},
-std::array<float,2>{0.474685162f, 0.0192555562f},
-std::array<float,2>{0.772286952f, 0.870737076f},
-std::array<float,2>{0.20501782f, 0.65910542f},
-std::array<float,2>{0.610639453f, 0.325192481f},
-std::array<float,2>{0.116686687f, 0.49121511f},
-std::array<float,2>{0.739009321f, 0.512417734f},
-std::array<float,2>{0.311381161f, 0.971872926f},
-std::array<float,2>{0.99570024f, 0.202124089f},
-std::array<float,2>{0.344249457f, 0.282158583f},
-std::array<float,2>{0.87563765f, 0.745407403f},
-std::array<float,2>{0.0584542975f, 0.795274556f},
-std::array<float,2>{0.645340264f, 0.0853016376f},
-std::array<float,2>{0.164064199f, 0.137480319f},
-std::array<float,2>{0.525169551f, 0.917477906f},
-std::array<float,2>{0.388922065f, 0.607860088f},
-std::array<float,2>{0.818312705f, 0.434235394f},
-std::array<float,2>{0.297517955f, 0.0575242266f},
-std::array<float,2>{0.990134597f, 0.840291202f},
-std::array<float,2>{0.119532585f, 0.628314316f},
-std::array<float,2>{0.749423206f, 0.349972069f},
-std::array<float,2>{0.214050308f, 0.460840881f},
-std::array<float,2>{0.624262214f, 0.551519573f},
-std::array<float,2>{0.481740028f, 0.944695592f},
-std::array<float,2>{0.775763273f, 0.221816912f},
-std::array<float,2>{0.376769871f, 0.263173431f},
-std::array<float,2>{0.821056247f, 0.708353996f},
-std::array<float,2>{0.162488148f, 0.761569202f},
-std::array<float,2>{0.515875995f, 0.117017016f},
-std::array<float,2>{0.0498638302f, 0.185909614f},
-std::array<float,2>{0.648911476f, 0.902678013f},
-std::array<float,2>{0.356798172f, 0.586162567f},
-std::array<float,2>{0.882843614f, 0.394107699f},
-std::array<float,2>{0.444777906f, 0.19399491f},
-std::array<float,2>{0.811016381f, 0.983455002f},
-std::array<float,2>{0.24316667f, 0.501646817f},
-std::array<float,2>{0.588130236f, 0.496571928f},
-std::array<float,2>{0.0891383737f, 0.31845513f},
-std::array<float,2>{0.711888134f, 0.671634614f},
-std::array<float,2>{0.279124618f, 0.865637362f},
-std::array<float,2>{0.961085081f, 0.026786346f},
-std::array<float,2>{0.318483651f, 0.425266802f},
-std::array<float,2>{0.9109056f, 0.600406229f},
-std::array<float,2>{0.00347728445f, 0.911796391f},
-std::array<float,2>{0.682258368f, 0.126379758f},
-std::array<float,2>{0.146783888f, 0.0926693529f},
-std::array<float,2>{0.543871999f, 0.787622511f},
-std::array<float,2>{0.407363921f, 0.737403333f},
-std::array<float,2>{0.859302044f, 0.289631665f},
-std::array<float,2>{0.371750206f, 0.140973896f},
-std::array<float,2>{0.891080856f, 0.921971619f},
-std::array<float,2>{0.0449554585f, 0.619023323f},
-std::array<float,2>{0.636756837f, 0.421702236f},
-std::array<float,2>{0.175609156f, 0.299766958f},
-std::array<float,2>{0.507898271f, 0.721029818f},
-std::array<float,2>{0.40386191f, 0.797693014f},
-std::array<float,2>{0.835242152f, 0.0731247887f},
-std::array<float,2>{0.493755639f, 0.470455766f},
-std::array<float,2>{0.753601432f, 0.527324975f},
-std::array<float,2>{0.187566027f, 0.986511111f},
-std::array<float,2>{0.598067641f, 0.215760022f},
-std::array<float,2>{0.107368343f, 0.00479567936f},
-std::array<float,2>{0.723320961f, 0.846891344f},
-std::array<float,2>{0.284899741f, 0.685858905f},
-std::array<float,2>{0.970677674f, 0.332758546f},
-std::array<float,2>{0.422110498f, 0.108216822f},
-std::array<float,2>{0.868294299f, 0.778520167f},
-std::array<float,2>{0.135196567f, 0.698109627f},
-std::array<float,2>{0.552089989f, 0.276295751f},
-std::array<float,2>{0.0312226471f, 0.37734586f},
-std::array<float,2>{0.669075012f, 0.568367541f},
-std::array<float,2>{0.331542969f, 0.889342308f},
-std::array<float,2>{0.924519777f, 0.159386083f},
-std::array<float,2>{0.259707391f, 0.36976248f},
-std::array<float,2>{0.945448816f, 0.644831598f},
-std::array<float,2>{0.062769033f, 0.813415051f},
-std::array<float,2>{0.697236359f, 0.0357288234f},
-std::array<float,2>{0.228861853f, 0.247127429f},
-std::array<float,2>{0.575307906f, 0.959949076f},
-std::array<float,2>{0.462918967f, 0.531935215f},
-std::array<float,2>{0.790346801f, 0.444529474f},
-std::array<float,2>{0.291096538f, 0.0887709707f},
-std::array<float,2>{0.979400694f, 0.784161329f},
-std::array<float,2>{0.0945545956f, 0.740981698f},
-std::array<float,2>{0.728823841f, 0.294719577f},
-std::array<float,2>{0.199120671f, 0.428745121f},
-std::array<float,2>{0.604398608f, 0.594264328f},
-std::array<float,2>{0.488788277f, 0.908737838f},
-std::array<float,2>{0.761453152f, 0.131936535f},
-std::array<float,2>{0.397346199f, 0.316396922f},
-std::array<float,2>{0.841696322f, 0.665896535f},
-std::array<float,2>{0.180022985f, 0.863000274f},
-std::array<float,2>{0.507158875f, 0.0285266992f},
-std::array<float,2>{0.0380362123f, 0.190232977f},
-std::array<float,2>{0.628455043f, 0.977162659f},
-std::array<float,2>{0.365408659f, 0.506383955f},
-std::array<float,2>{0.905766189f, 0.495966524f},
-std::array<float,2>{0.460044831f, 0.180335522f},
-std::array<float,2>{0.786808848f, 0.89975369f},
-std::array<float,2>{0.219202906f, 0.590711176f},
-std::array<float,2>{0.569617271f, 0.395757526f},
-std::array<float,2>{0.0733309165f, 0.258481175f},
-std::array<float,2>{0.693717778f, 0.703929842f},
-std::array<float,2>{0.256699532f, 0.765304208f},
-std::array<float,2>{0.939543247f, 0.112173155f},
-std::array<float,2>{0.339602321f, 0.456717491f},
-std::array<float,2>{0.936763227f, 0.54868716f},
-std::array<float,2>{0.0234182607f, 0.940884769f},
-std::array<float,2>{0.659881771f, 0.223245502f},
-std::array<float,2>{0.131573215f, 0.0590933561f},
-std::array<float,2>{0.555355728f, 0.838075101f},
-std::array<float,2>{0.432108462f, 0.630049109f},
-std::array<float,2>{0.86324352f, 0.344285458f},
-std::array<float,2>{0.349650174f, 0.24359642f},
-std::array<float,2>{0.879477262f, 0.953545868f},
-std::array<float,2>{0.0623564422f, 0.537239611f},
-std::array<float,2>{0.642600417f, 0.439921558f},
-std::array<float,2>{0.168362543f, 0.371646017f},
-std::array<float,2>{0.530429482f, 0.643542469f},
-std::array<float,2>{0.384058833f, 0.819916546f},
-std::array<float,2>{0.812922001f, 0.0324376412f},
-std::array<float,2>{0.470020443f, 0.38139677f},
-std::array<float,2>{0.765750647f, 0.564092636f},
-std::array<float,2>{0.208153903f, 0.886460602f},
-std::array<float,2>{0.613301098f, 0.163877949f},
-std::array<float,2>{0.111370504f, 0.10355594f},
-std::array<float,2>{0.735301554f, 0.776042998f},
-std::array<float,2>{0.30575189f, 0.700029135f},
-std::array<float,2>{0.999138534f, 0.280614495f},
-std::array<float,2>{0.420346171f, 0.00178950746f},
-std::array<float,2>{0.845523655f, 0.849060595f},
-std::array<float,2>{0.149097741f, 0.682359815f},
-std::array<float,2>{0.538781285f, 0.331528246f},
-std::array<float,2>{0.011355863f, 0.473555326f},
-std::array<float,2>{0.673815787f, 0.529582798f},
-std::array<float,2>{0.322990268f, 0.990449905f},
-std::array<float,2>{0.916868865f, 0.213753119f},
-std::array<float,2>{0.268744707f, 0.300869733f},
-std::array<float,2>{0.960208774f, 0.722755194f},
-std::array<float,2>{0.0859311223f, 0.801601171f},
-std::array<float,2>{0.705990136f, 0.0769455582f},
-std::array<float,2>{0.240083024f, 0.144962728f},
-std::array<float,2>{0.580227613f, 0.92622757f},
-std::array<float,2>{0.452666938f, 0.623152912f},
-std::array<float,2>{0.798910797f, 0.41790989f},
-std::array<float,2>{0.315674961f, 0.0409522504f},
-std::array<float,2>{0.909845054f, 0.827920437f},
-std::array<float,2>{0.00463937782f, 0.648748636f},
-std::array<float,2>{0.686261952f, 0.363394678f},
-std::array<float,2>{0.144018263f, 0.449892938f},
-std::array<float,2>{0.540975511f, 0.542596281f},
-std::array<float,2>{0.410344541f, 0.962172389f},
-std::array<float,2>{0.853650451f, 0.23892805f},
-std::array<float,2>{0.441196501f, 0.266508222f},
-std::array<float,2>{0.808183372f, 0.690330207f},
-std::array<float,2>{0.248231858f, 0.773136973f},
-std::array<float,2>{0.592606008f, 0.0986897573f},
-std::array<float,2>{0.0923798904f, 0.16556327f},
-std::array<float,2>{0.715922475f, 0.875161469f},
-std::array<float,2>{0.273631483f, 0.570897937f},
-std::array<float,2>{0.967695057f, 0.386504263f},
-std::array<float,2>{0.380339622f, 0.210929811f},
-std::array<float,2>{0.827022433f, 0.996028185f},
-std::array<float,2>{0.157350689f, 0.520901918f},
-std::array<float,2>{0.521267593f, 0.479047149f},
-std::array<float,2>{0.0524773933f, 0.339652598f},
-std::array<float,2>{0.655405998f, 0.677117944f},
-std::array<float,2>{0.352059633f, 0.858220398f},
-std::array<float,2>{0.887847364f, 0.0136787379f},
-std::array<float,2>{0.303503186f, 0.406315893f},
-std::array<float,2>{0.98698467f, 0.611550987f},
-std::array<float,2>{0.122770324f, 0.930503368f},
-std::array<float,2>{0.743211687f, 0.14999415f},
-std::array<float,2>{0.217001215f, 0.0677583665f},
-std::array<float,2>{0.620057285f, 0.809276879f},
-std::array<float,2>{0.47997877f, 0.727037132f},
-std::array<float,2>{0.77735126f, 0.310211003f},
-std::array<float,2>{0.263174653f, 0.133332983f},
-std::array<float,2>{0.952705443f, 0.91932708f},
-std::array<float,2>{0.0690400079f, 0.603065014f},
-std::array<float,2>{0.702709079f, 0.432197958f},
-std::array<float,2>{0.231659964f, 0.288274258f},
-std::array<float,2>{0.573105276f, 0.749891758f},
-std::array<float,2>{0.467814624f, 0.791413724f},
-std::array<float,2>{0.793545902f, 0.0816218778f},
-std::array<float,2>{0.429256231f, 0.485411435f},
-std::array<float,2>{0.872230887f, 0.50985533f},
-std::array<float,2>{0.139164209f, 0.973949313f},
-std::array<float,2>{0.547357798f, 0.196739852f},
-std::array<float,2>{0.0255094711f, 0.0225073118f},
-std::array<float,2>{0.667796314f, 0.872947454f},
-std::array<float,2>{0.33520323f, 0.662217617f},
-std::array<float,2>{0.927200973f, 0.322014391f},
-std::array<float,2>{0.496910959f, 0.124803662f},
-std::array<float,2>{0.756944418f, 0.757389128f},
-std::array<float,2>{0.193539217f, 0.713719189f},
-std::array<float,2>{0.593814492f, 0.253228843f},
-std::array<float,2>{0.104382098f, 0.403288692f},
-std::array<float,2>{0.720537245f, 0.58211422f},
-std::array<float,2>{0.2878398f, 0.892177045f},
-std::array<float,2>{0.974305511f, 0.173565224f},
-std::array<float,2>{0.370507091f, 0.351783097f},
-std::array<float,2>{0.898042023f, 0.639857531f},
-std::array<float,2>{0.0396708995f, 0.828458667f},
-std::array<float,2>{0.63334024f, 0.0504616871f},
-std::array<float,2>{0.17699632f, 0.231773302f},
-std::array<float,2>{0.515552044f, 0.945912302f},
-std::array<float,2>{0.401301652f, 0.561348379f},
-std::array<float,2>{0.829088569f, 0.465758443f},
-std::array<float,2>{0.362572849f, 0.0937974378f},
-std::array<float,2>{0.9022668f, 0.769464731f},
-std::array<float,2>{0.0350227728f, 0.694669604f},
-std::array<float,2>{0.630533099f, 0.270542532f},
-std::array<float,2>{0.183677435f, 0.387303442f},
-std::array<float,2>{0.50140816f, 0.577699423f},
-std::array<float,2>{0.393955082f, 0.879350007f},
-std::array<float,2>{0.838882685f, 0.171831653f},
-std::array<float,2>{0.48548618f, 0.362038016f},
-std::array<float,2>{0.761971712f, 0.653690279f},
-std::array<float,2>{0.200372443f, 0.82419318f},
-std::array<float,2>{0.607689321f, 0.0465787649f},
-std::array<float,2>{0.0988507569f, 0.238152847f},
-std::array<float,2>{0.733551085f, 0.967300296f},
-std::array<float,2>{0.293975204f, 0.545368314f},
-std::array<float,2>{0.983729899f, 0.448340356f},
-std::array<float,2>{0.435447425f, 0.155371338f},
-std::array<float,2>{0.863660932f, 0.935034692f},
-std::array<float,2>{0.126439288f, 0.613290906f},
-std::array<float,2>{0.561303735f, 0.413811386f},
-std::array<float,2>{0.0187672041f, 0.307798088f},
-std::array<float,2>{0.661402702f, 0.731632531f},
-std::array<float,2>{0.343228132f, 0.808493018f},
-std::array<float,2>{0.932190478f, 0.0649012402f},
-std::array<float,2>{0.250578374f, 0.482763439f},
-std::array<float,2>{0.942422807f, 0.519232273f},
-std::array<float,2>{0.0749273822f, 0.997873545f},
-std::array<float,2>{0.68964988f, 0.203395814f},
-std::array<float,2>{0.223805562f, 0.0111178588f},
-std::array<float,2>{0.56392622f, 0.852199674f},
-std::array<float,2>{0.456023216f, 0.675518632f},
-std::array<float,2>{0.781814158f, 0.341852158f},
-std::array<float,2>{0.310508281f, 0.199871257f},
-std::array<float,2>{0.993029833f, 0.970205963f},
-std::array<float,2>{0.114259362f, 0.514565885f},
-std::array<float,2>{0.74118042f, 0.48847726f},
-std::array<float,2>{0.205595046f, 0.326453626f},
-std::array<float,2>{0.612296224f, 0.656298578f},
-std::array<float,2>{0.473880172f, 0.867450893f},
-std::array<float,2>{0.770559669f, 0.0172508638f},
-std::array<float,2>{0.387904078f, 0.435785115f},
-std::array<float,2>{0.818369448f, 0.606620133f},
-std::array<float,2>{0.16739279f, 0.915330887f},
-std::array<float,2>{0.526178122f, 0.139105752f},
-std::array<float,2>{0.0548862219f, 0.0827264488f},
-std::array<float,2>{0.648402929f, 0.794532299f},
-std::array<float,2>{0.346309453f, 0.743798673f},
-std::array<float,2>{0.878873408f, 0.284762532f},
-std::array<float,2>{0.448836833f, 0.0516767241f},
-std::array<float,2>{0.804605484f, 0.833745658f},
-std::array<float,2>{0.235029206f, 0.63487947f},
-std::array<float,2>{0.583334744f, 0.357169598f},
-std::array<float,2>{0.0808875486f, 0.463225484f},
-std::array<float,2>{0.708432198f, 0.554854453f},
-std::array<float,2>{0.270099878f, 0.952649355f},
-std::array<float,2>{0.954887986f, 0.229032919f},
-std::array<float,2>{0.326488912f, 0.257437646f},
-std::array<float,2>{0.919052601f, 0.714960337f},
-std::array<float,2>{0.0141853942f, 0.752636015f},
-std::array<float,2>{0.677501678f, 0.120244369f},
-std::array<float,2>{0.155342773f, 0.179292858f},
-std::array<float,2>{0.533774734f, 0.896358728f},
-std::array<float,2>{0.416052669f, 0.579639733f},
-std::array<float,2>{0.850596845f, 0.399825782f},
-std::array<float,2>{0.280934364f, 0.0240655318f},
-std::array<float,2>{0.963233113f, 0.864926338f},
-std::array<float,2>{0.0860940591f, 0.668130219f},
-std::array<float,2>{0.713218987f, 0.316957682f},
-std::array<float,2>{0.245030135f, 0.499486357f},
-std::array<float,2>{0.585940957f, 0.503564715f},
-std::array<float,2>{0.441570729f, 0.982010126f},
-std::array<float,2>{0.810468912f, 0.192816511f},
-std::array<float,2>{0.408727646f, 0.291793555f},
-std::array<float,2>{0.856678009f, 0.734453321f},
-std::array<float,2>{0.144667253f, 0.787025928f},
-std::array<float,2>{0.545165062f, 0.0911205709f},
-std::array<float,2>{0.00015031881f, 0.127620161f},
-std::array<float,2>{0.680170536f, 0.912874937f},
-std::array<float,2>{0.317700893f, 0.598421574f},
-std::array<float,2>{0.912652194f, 0.423254251f},
-std::array<float,2>{0.48254171f, 0.219947591f},
-std::array<float,2>{0.774826944f, 0.942032337f},
-std::array<float,2>{0.212104842f, 0.553088903f},
-std::array<float,2>{0.621618509f, 0.457574755f},
-std::array<float,2>{0.117788188f, 0.347826153f},
-std::array<float,2>{0.746716321f, 0.626338065f},
-std::array<float,2>{0.299457222f, 0.842267632f},
-std::array<float,2>{0.990971446f, 0.055805292f},
-std::array<float,2>{0.358121842f, 0.391069084f},
-std::array<float,2>{0.885936797f, 0.588928103f},
-std::array<float,2>{0.0470362753f, 0.904787362f},
-std::array<float,2>{0.650500536f, 0.183688164f},
-std::array<float,2>{0.161494449f, 0.1144135f},
-std::array<float,2>{0.51841867f, 0.758504808f},
-std::array<float,2>{0.378159136f, 0.710370183f},
-std::array<float,2>{0.823464751f, 0.2652511f},
-std::array<float,2>{0.328282386f, 0.157585874f},
-std::array<float,2>{0.923046112f, 0.888196051f},
-std::array<float,2>{0.0283537507f, 0.568259656f},
-std::array<float,2>{0.671869576f, 0.376035929f},
-std::array<float,2>{0.134219363f, 0.27397868f},
-std::array<float,2>{0.553619325f, 0.696653426f},
-std::array<float,2>{0.423951238f, 0.781232774f},
-std::array<float,2>{0.870149672f, 0.106400609f},
-std::array<float,2>{0.462677717f, 0.44231379f},
-std::array<float,2>{0.791983366f, 0.534103632f},
-std::array<float,2>{0.228482321f, 0.958432019f},
-std::array<float,2>{0.577063084f, 0.249860421f},
-std::array<float,2>{0.0651283562f, 0.0373646989f},
-std::array<float,2>{0.698791087f, 0.816255689f},
-std::array<float,2>{0.260956287f, 0.646700501f},
-std::array<float,2>{0.948322058f, 0.367718607f},
-std::array<float,2>{0.404379159f, 0.0720884725f},
-std::array<float,2>{0.833790064f, 0.800762475f},
-std::array<float,2>{0.172519356f, 0.71877712f},
-std::array<float,2>{0.51038456f, 0.29761669f},
-std::array<float,2>{0.0435170308f, 0.419813365f},
-std::array<float,2>{0.639538825f, 0.620274425f},
-std::array<float,2>{0.373475492f, 0.925395489f},
-std::array<float,2>{0.892686307f, 0.143904805f},
-std::array<float,2>{0.282795697f, 0.334303111f},
-std::array<float,2>{0.971022844f, 0.685529053f},
-std::array<float,2>{0.109042689f, 0.843885958f},
-std::array<float,2>{0.725948155f, 0.00637721224f},
-std::array<float,2>{0.189947456f, 0.217195764f},
-std::array<float,2>{0.600475192f, 0.985094547f},
-std::array<float,2>{0.495852858f, 0.525305331f},
-std::array<float,2>{0.751000881f, 0.471645504f},
-std::array<float,2>{0.287222832f, 0.122818202f},
-std::array<float,2>{0.973879933f, 0.754055202f},
-std::array<float,2>{0.103817157f, 0.711005747f},
-std::array<float,2>{0.719903767f, 0.250831097f},
-std::array<float,2>{0.19426693f, 0.404973596f},
-std::array<float,2>{0.594715655f, 0.58498913f},
-std::array<float,2>{0.496339887f, 0.894267201f},
-std::array<float,2>{0.757727504f, 0.174766913f},
-std::array<float,2>{0.400712669f, 0.355317235f},
-std::array<float,2>{0.828565836f, 0.637572944f},
-std::array<float,2>{0.177648038f, 0.830466747f},
-std::array<float,2>{0.514922261f, 0.0473822318f},
-std::array<float,2>{0.0392774716f, 0.233782932f},
-std::array<float,2>{0.632947981f, 0.949188471f},
-std::array<float,2>{0.371032327f, 0.55928129f},
-std::array<float,2>{0.897701919f, 0.467666984f},
-std::array<float,2>{0.46864897f, 0.135232031f},
-std::array<float,2>{0.793300569f, 0.921547294f},
-std::array<float,2>{0.232362241f, 0.605415821f},
-std::array<float,2>{0.572654486f, 0.431252807f},
-std::array<float,2>{0.0686829016f, 0.28522554f},
-std::array<float,2>{0.702508092f, 0.746216297f},
-std::array<float,2>{0.263618857f, 0.79014194f},
-std::array<float,2>{0.952629864f, 0.0791246071f},
-std::array<float,2>{0.33575502f, 0.487462163f},
-std::array<float,2>{0.927552164f, 0.509702682f},
-std::array<float,2>{0.0262706373f, 0.975989938f},
-std::array<float,2>{0.667248487f, 0.198404565f},
-std::array<float,2>{0.138761953f, 0.0199654624f},
-std::array<float,2>{0.547507226f, 0.873483241f},
-std::array<float,2>{0.428772271f, 0.660198927f},
-std::array<float,2>{0.872822344f, 0.32257393f},
-std::array<float,2>{0.351752847f, 0.207903162f},
-std::array<float,2>{0.888603687f, 0.992339134f},
-std::array<float,2>{0.0521845818f, 0.523403764f},
-std::array<float,2>{0.656166494f, 0.478171468f},
-std::array<float,2>{0.157946855f, 0.337770373f},
-std::array<float,2>{0.520590365f, 0.678226292f},
-std::array<float,2>{0.380491614f, 0.856405318f},
-std::array<float,2>{0.826194465f, 0.0125602446f},
-std::array<float,2>{0.480463296f, 0.409276515f},
-std::array<float,2>{0.777979732f, 0.611259818f},
-std::array<float,2>{0.217373669f, 0.931892991f},
-std::array<float,2>{0.619251847f, 0.150748521f},
-std::array<float,2>{0.122547045f, 0.0686380789f},
-std::array<float,2>{0.743767083f, 0.811090052f},
-std::array<float,2>{0.303173453f, 0.728606701f},
-std::array<float,2>{0.986463785f, 0.311265737f},
-std::array<float,2>{0.411110848f, 0.042444557f},
-std::array<float,2>{0.854024172f, 0.824697196f},
-std::array<float,2>{0.144316614f, 0.650983155f},
-std::array<float,2>{0.540076792f, 0.366738677f},
-std::array<float,2>{0.00422736863f, 0.452588946f},
-std::array<float,2>{0.685817838f, 0.539508283f},
-std::array<float,2>{0.316289961f, 0.963594913f},
-std::array<float,2>{0.909415603f, 0.241051883f},
-std::array<float,2>{0.27434656f, 0.26952666f},
-std::array<float,2>{0.967036486f, 0.688831866f},
-std::array<float,2>{0.0918066129f, 0.771033883f},
-std::array<float,2>{0.716342151f, 0.10105893f},
-std::array<float,2>{0.248748466f, 0.1676002f},
-std::array<float,2>{0.592222035f, 0.877856016f},
-std::array<float,2>{0.44046396f, 0.573890746f},
-std::array<float,2>{0.80797267f, 0.383716553f},
-std::array<float,2>{0.322699696f, 0.00383757357f},
-std::array<float,2>{0.916322172f, 0.849804878f},
-std::array<float,2>{0.0111895176f, 0.680947244f},
-std::array<float,2>{0.672886312f, 0.329109877f},
-std::array<float,2>{0.14875035f, 0.476115912f},
-std::array<float,2>{0.53848815f, 0.528763294f},
-std::array<float,2>{0.420771569f, 0.989657402f},
-std::array<float,2>{0.844786644f, 0.211138204f},
-std::array<float,2>{0.452414393f, 0.303619117f},
-std::array<float,2>{0.79978478f, 0.725596309f},
-std::array<float,2>{0.23951453f, 0.80275774f},
-std::array<float,2>{0.58097595f, 0.0756570697f},
-std::array<float,2>{0.0853361785f, 0.148046598f},
-std::array<float,2>{0.705368936f, 0.928533554f},
-std::array<float,2>{0.269203156f, 0.622095883f},
-std::array<float,2>{0.960579991f, 0.414830148f},
-std::array<float,2>{0.384373695f, 0.2456505f},
-std::array<float,2>{0.813318193f, 0.956273556f},
-std::array<float,2>{0.168547049f, 0.536182642f},
-std::array<float,2>{0.531239092f, 0.438800365f},
-std::array<float,2>{0.0616466962f, 0.373923421f},
-std::array<float,2>{0.643252015f, 0.642329812f},
-std::array<float,2>{0.350507379f, 0.81714344f},
-std::array<float,2>{0.879101396f, 0.0334472992f},
-std::array<float,2>{0.306491226f, 0.380720705f},
-std::array<float,2>{0.999812841f, 0.565734386f},
-std::array<float,2>{0.111818217f, 0.884688973f},
-std::array<float,2>{0.73437959f, 0.161198184f},
-std::array<float,2>{0.208705097f, 0.101858564f},
-std::array<float,2>{0.614245892f, 0.773942411f},
-std::array<float,2>{0.470579207f, 0.70178175f},
-std::array<float,2>{0.766376317f, 0.278670251f},
-std::array<float,2>{0.255903989f, 0.182972997f},
-std::array<float,2>{0.940201402f, 0.902238488f},
-std::array<float,2>{0.0741101727f, 0.592512727f},
-std::array<float,2>{0.693981349f, 0.397516966f},
-std::array<float,2>{0.219723582f, 0.26052919f},
-std::array<float,2>{0.569879532f, 0.705674171f},
-std::array<float,2>{0.460631877f, 0.761853397f},
-std::array<float,2>{0.786142766f, 0.109604448f},
-std::array<float,2>{0.432433486f, 0.45400247f},
-std::array<float,2>{0.862475157f, 0.549043953f},
-std::array<float,2>{0.131331503f, 0.938013375f},
-std::array<float,2>{0.55488652f, 0.226003617f},
-std::array<float,2>{0.0225543734f, 0.0607520156f},
-std::array<float,2>{0.659575939f, 0.836029232f},
-std::array<float,2>{0.338909507f, 0.631714463f},
-std::array<float,2>{0.937263429f, 0.347462058f},
-std::array<float,2>{0.488357157f, 0.0871418342f},
-std::array<float,2>{0.760912955f, 0.782568216f},
-std::array<float,2>{0.19833976f, 0.73852855f},
-std::array<float,2>{0.60366416f, 0.296782762f},
-std::array<float,2>{0.0941135883f, 0.42691645f},
-std::array<float,2>{0.729197383f, 0.595754504f},
-std::array<float,2>{0.291969627f, 0.90634346f},
-std::array<float,2>{0.978908181f, 0.130598217f},
-std::array<float,2>{0.36592117f, 0.31333217f},
-std::array<float,2>{0.905421734f, 0.667295992f},
-std::array<float,2>{0.0375258178f, 0.859452903f},
-std::array<float,2>{0.628268361f, 0.0308878906f},
-std::array<float,2>{0.180178434f, 0.189395562f},
-std::array<float,2>{0.507792056f, 0.98035866f},
-std::array<float,2>{0.396598577f, 0.50433737f},
-std::array<float,2>{0.840830386f, 0.49336639f},
-std::array<float,2>{0.373650372f, 0.0726982877f},
-std::array<float,2>{0.893514514f, 0.796989799f},
-std::array<float,2>{0.0433885045f, 0.721554935f},
-std::array<float,2>{0.638677537f, 0.299055666f},
-std::array<float,2>{0.172189429f, 0.420900315f},
-std::array<float,2>{0.510202944f, 0.618199706f},
-std::array<float,2>{0.404792368f, 0.922616363f},
-std::array<float,2>{0.833015442f, 0.141382858f},
-std::array<float,2>{0.495529294f, 0.332475066f},
-std::array<float,2>{0.751773f, 0.686294138f},
-std::array<float,2>{0.189649299f, 0.84718895f},
-std::array<float,2>{0.599801362f, 0.0043790387f},
-std::array<float,2>{0.10872592f, 0.21511513f},
-std::array<float,2>{0.72625035f, 0.987086713f},
-std::array<float,2>{0.282704592f, 0.526753306f},
-std::array<float,2>{0.971342087f, 0.469919384f},
-std::array<float,2>{0.424425572f, 0.15991722f},
-std::array<float,2>{0.870639086f, 0.889074206f},
-std::array<float,2>{0.134622231f, 0.56899929f},
-std::array<float,2>{0.553043664f, 0.37790674f},
-std::array<float,2>{0.029086506f, 0.275694996f},
-std::array<float,2>{0.671115518f, 0.697481155f},
-std::array<float,2>{0.328848213f, 0.778974056f},
-std::array<float,2>{0.92370373f, 0.107463367f},
-std::array<float,2>{0.261294365f, 0.444979668f},
-std::array<float,2>{0.949129641f, 0.531292856f},
-std::array<float,2>{0.0648992211f, 0.959334016f},
-std::array<float,2>{0.698621273f, 0.24770613f},
-std::array<float,2>{0.227776602f, 0.035312999f},
-std::array<float,2>{0.576404452f, 0.81276834f},
-std::array<float,2>{0.46193409f, 0.64530617f},
-std::array<float,2>{0.791379452f, 0.369182825f},
-std::array<float,2>{0.299049348f, 0.222308502f},
-std::array<float,2>{0.990433335f, 0.945017934f},
-std::array<float,2>{0.117270812f, 0.55114609f},
-std::array<float,2>{0.746304393f, 0.460202038f},
-std::array<float,2>{0.212674946f, 0.350363553f},
-std::array<float,2>{0.621149659f, 0.628661454f},
-std::array<float,2>{0.482967079f, 0.840353906f},
-std::array<float,2>{0.775306106f, 0.0569127761f},
-std::array<float,2>{0.378542602f, 0.39398703f},
-std::array<float,2>{0.823785782f, 0.586738706f},
-std::array<float,2>{0.161720559f, 0.903096318f},
-std::array<float,2>{0.517588735f, 0.186405048f},
-std::array<float,2>{0.0475606769f, 0.116680779f},
-std::array<float,2>{0.651086032f, 0.761047721f},
-std::array<float,2>{0.357470423f, 0.708772838f},
-std::array<float,2>{0.886715591f, 0.263545305f},
-std::array<float,2>{0.441904664f, 0.0270862095f},
-std::array<float,2>{0.809904218f, 0.86620909f},
-std::array<float,2>{0.244146392f, 0.671258688f},
-std::array<float,2>{0.586656272f, 0.319170654f},
-std::array<float,2>{0.0865558684f, 0.496843576f},
-std::array<float,2>{0.713819981f, 0.501112342f},
-std::array<float,2>{0.280478597f, 0.984274805f},
-std::array<float,2>{0.963594675f, 0.193511412f},
-std::array<float,2>{0.317899704f, 0.289245546f},
-std::array<float,2>{0.912407637f, 0.738246083f},
-std::array<float,2>{0.00057608058f, 0.787220836f},
-std::array<float,2>{0.680275381f, 0.0918323472f},
-std::array<float,2>{0.145356685f, 0.126577049f},
-std::array<float,2>{0.545482993f, 0.911387444f},
-std::array<float,2>{0.408575267f, 0.599820495f},
-std::array<float,2>{0.857260942f, 0.425542891f},
-std::array<float,2>{0.269977629f, 0.0540967621f},
-std::array<float,2>{0.954520524f, 0.83476299f},
-std::array<float,2>{0.0804502964f, 0.634593844f},
-std::array<float,2>{0.708807647f, 0.359277427f},
-std::array<float,2>{0.234799773f, 0.46198678f},
-std::array<float,2>{0.583536863f, 0.558121502f},
-std::array<float,2>{0.448719144f, 0.949595094f},
-std::array<float,2>{0.804026246f, 0.226767689f},
-std::array<float,2>{0.416761965f, 0.254796565f},
-std::array<float,2>{0.851351321f, 0.717677474f},
-std::array<float,2>{0.156152666f, 0.750595331f},
-std::array<float,2>{0.533338487f, 0.118584454f},
-std::array<float,2>{0.0139656644f, 0.17752634f},
-std::array<float,2>{0.676896393f, 0.898373127f},
-std::array<float,2>{0.326824337f, 0.581983387f},
-std::array<float,2>{0.919877589f, 0.401178122f},
-std::array<float,2>{0.474482119f, 0.201325044f},
-std::array<float,2>{0.771020293f, 0.972182691f},
-std::array<float,2>{0.20549731f, 0.511837721f},
-std::array<float,2>{0.611395597f, 0.492034286f},
-std::array<float,2>{0.115211233f, 0.324680686f},
-std::array<float,2>{0.740323365f, 0.658406079f},
-std::array<float,2>{0.309730619f, 0.870340884f},
-std::array<float,2>{0.992647588f, 0.0186597165f},
-std::array<float,2>{0.346189499f, 0.433915734f},
-std::array<float,2>{0.877963424f, 0.608310223f},
-std::array<float,2>{0.055325713f, 0.917729259f},
-std::array<float,2>{0.647514284f, 0.137109458f},
-std::array<float,2>{0.167866305f, 0.0856759548f},
-std::array<float,2>{0.525590003f, 0.795812547f},
-std::array<float,2>{0.388372242f, 0.745987594f},
-std::array<float,2>{0.818849623f, 0.281591326f},
-std::array<float,2>{0.34344995f, 0.153359085f},
-std::array<float,2>{0.932082534f, 0.936757207f},
-std::array<float,2>{0.0194568615f, 0.616688192f},
-std::array<float,2>{0.661684632f, 0.410753936f},
-std::array<float,2>{0.12646839f, 0.304885626f},
-std::array<float,2>{0.560705841f, 0.734141886f},
-std::array<float,2>{0.434923053f, 0.806375086f},
-std::array<float,2>{0.864011645f, 0.0642486513f},
-std::array<float,2>{0.455125719f, 0.481591493f},
-std::array<float,2>{0.781639993f, 0.515718758f},
-std::array<float,2>{0.224532768f, 0.999318838f},
-std::array<float,2>{0.564359844f, 0.205452383f},
-std::array<float,2>{0.0742783323f, 0.00887988508f},
-std::array<float,2>{0.690083265f, 0.854040384f},
-std::array<float,2>{0.250372291f, 0.673576057f},
-std::array<float,2>{0.942937434f, 0.341703922f},
-std::array<float,2>{0.394168496f, 0.0974536315f},
-std::array<float,2>{0.839588046f, 0.7667979f},
-std::array<float,2>{0.184372425f, 0.693240047f},
-std::array<float,2>{0.501580179f, 0.272505105f},
-std::array<float,2>{0.0346146375f, 0.390551895f},
-std::array<float,2>{0.630143046f, 0.574591219f},
-std::array<float,2>{0.36298719f, 0.881916463f},
-std::array<float,2>{0.901722491f, 0.168087184f},
-std::array<float,2>{0.294788837f, 0.360765845f},
-std::array<float,2>{0.984205186f, 0.654531002f},
-std::array<float,2>{0.0992378369f, 0.821310878f},
-std::array<float,2>{0.734024823f, 0.044235114f},
-std::array<float,2>{0.200979337f, 0.234943777f},
-std::array<float,2>{0.608331919f, 0.965844095f},
-std::array<float,2>{0.48590669f, 0.543732941f},
-std::array<float,2>{0.762679398f, 0.446180403f},
-std::array<float,2>{0.265094906f, 0.0813533291f},
-std::array<float,2>{0.949404657f, 0.791562617f},
-std::array<float,2>{0.0682315528f, 0.749092042f},
-std::array<float,2>{0.700184643f, 0.288623959f},
-std::array<float,2>{0.232548669f, 0.431851387f},
-std::array<float,2>{0.570549607f, 0.602606118f},
-std::array<float,2>{0.466132939f, 0.919739306f},
-std::array<float,2>{0.795603633f, 0.132982016f},
-std::array<float,2>{0.427214831f, 0.321618587f},
-std::array<float,2>{0.874540925f, 0.662730873f},
-std::array<float,2>{0.137016669f, 0.872148275f},
-std::array<float,2>{0.550763309f, 0.0230167992f},
-std::array<float,2>{0.0244718436f, 0.197050229f},
-std::array<float,2>{0.665143311f, 0.974187434f},
-std::array<float,2>{0.332244962f, 0.510282576f},
-std::array<float,2>{0.927918017f, 0.48609668f},
-std::array<float,2>{0.498225391f, 0.173285946f},
-std::array<float,2>{0.754156411f, 0.891949892f},
-std::array<float,2>{0.192505181f, 0.583001196f},
-std::array<float,2>{0.595894277f, 0.402412623f},
-std::array<float,2>{0.103205509f, 0.253489822f},
-std::array<float,2>{0.722125828f, 0.713276744f},
-std::array<float,2>{0.285620093f, 0.756836116f},
-std::array<float,2>{0.974815607f, 0.124502599f},
-std::array<float,2>{0.369115382f, 0.464993745f},
-std::array<float,2>{0.894870281f, 0.560937703f},
-std::array<float,2>{0.041656889f, 0.945490777f},
-std::array<float,2>{0.636009693f, 0.231947318f},
-std::array<float,2>{0.178584337f, 0.0499357916f},
-std::array<float,2>{0.512565196f, 0.828638196f},
-std::array<float,2>{0.399652243f, 0.640348613f},
-std::array<float,2>{0.831021309f, 0.352393836f},
-std::array<float,2>{0.313792348f, 0.23851487f},
-std::array<float,2>{0.907994747f, 0.962885559f},
-std::array<float,2>{0.00635530287f, 0.542456627f},
-std::array<float,2>{0.685317695f, 0.449391067f},
-std::array<float,2>{0.141673267f, 0.36394307f},
-std::array<float,2>{0.542126358f, 0.649275959f},
-std::array<float,2>{0.412144989f, 0.827517211f},
-std::array<float,2>{0.851565123f, 0.0405269936f},
-std::array<float,2>{0.43838793f, 0.38616854f},
-std::array<float,2>{0.806205034f, 0.570426643f},
-std::array<float,2>{0.246343702f, 0.875918925f},
-std::array<float,2>{0.591068685f, 0.165170223f},
-std::array<float,2>{0.0899783f, 0.0994068384f},
-std::array<float,2>{0.716990888f, 0.77282691f},
-std::array<float,2>{0.276189566f, 0.689791858f},
-std::array<float,2>{0.965385616f, 0.266052336f},
-std::array<float,2>{0.382601738f, 0.0145329162f},
-std::array<float,2>{0.825413764f, 0.85755682f},
-std::array<float,2>{0.159402445f, 0.677598059f},
-std::array<float,2>{0.52342391f, 0.338870794f},
-std::array<float,2>{0.0537928529f, 0.478776485f},
-std::array<float,2>{0.652729273f, 0.521333694f},
-std::array<float,2>{0.355360836f, 0.995173812f},
-std::array<float,2>{0.889551938f, 0.210386261f},
-std::array<float,2>{0.302479208f, 0.309691042f},
-std::array<float,2>{0.984441757f, 0.727206767f},
-std::array<float,2>{0.124907434f, 0.80897665f},
-std::array<float,2>{0.744550288f, 0.0681294352f},
-std::array<float,2>{0.216091096f, 0.149802312f},
-std::array<float,2>{0.617710888f, 0.929949939f},
-std::array<float,2>{0.477366418f, 0.611871481f},
-std::array<float,2>{0.780091941f, 0.407093227f},
-std::array<float,2>{0.348250091f, 0.0328030065f},
-std::array<float,2>{0.88086623f, 0.819708705f},
-std::array<float,2>{0.0598878451f, 0.642775893f},
-std::array<float,2>{0.640977681f, 0.371359944f},
-std::array<float,2>{0.170455605f, 0.44026342f},
-std::array<float,2>{0.528736234f, 0.538068295f},
-std::array<float,2>{0.386367232f, 0.95377785f},
-std::array<float,2>{0.815846324f, 0.243868336f},
-std::array<float,2>{0.472388119f, 0.28121683f},
-std::array<float,2>{0.768678606f, 0.69959873f},
-std::array<float,2>{0.209791467f, 0.775642931f},
-std::array<float,2>{0.615315676f, 0.104182854f},
-std::array<float,2>{0.110895537f, 0.163368061f},
-std::array<float,2>{0.737879574f, 0.885870576f},
-std::array<float,2>{0.308104813f, 0.563697398f},
-std::array<float,2>{0.997171223f, 0.381081372f},
-std::array<float,2>{0.418930739f, 0.213167563f},
-std::array<float,2>{0.846820354f, 0.99089545f},
-std::array<float,2>{0.150439635f, 0.529881001f},
-std::array<float,2>{0.536896169f, 0.472852111f},
-std::array<float,2>{0.00805365574f, 0.331982523f},
-std::array<float,2>{0.674515843f, 0.682101667f},
-std::array<float,2>{0.320487976f, 0.849458814f},
-std::array<float,2>{0.915213883f, 0.00104230351f},
-std::array<float,2>{0.266441584f, 0.416997135f},
-std::array<float,2>{0.958349347f, 0.623636365f},
-std::array<float,2>{0.0821968615f, 0.926497817f},
-std::array<float,2>{0.704855084f, 0.145109788f},
-std::array<float,2>{0.240355834f, 0.0765011609f},
-std::array<float,2>{0.578439772f, 0.801077127f},
-std::array<float,2>{0.449917912f, 0.723391294f},
-std::array<float,2>{0.797808349f, 0.30132255f},
-std::array<float,2>{0.29011184f, 0.132522821f},
-std::array<float,2>{0.977147639f, 0.908278942f},
-std::array<float,2>{0.0963319913f, 0.593886733f},
-std::array<float,2>{0.728392005f, 0.429291219f},
-std::array<float,2>{0.196585134f, 0.293981105f},
-std::array<float,2>{0.60229677f, 0.740579188f},
-std::array<float,2>{0.4907507f, 0.783511877f},
-std::array<float,2>{0.75791043f, 0.0881850421f},
-std::array<float,2>{0.396276623f, 0.495462149f},
-std::array<float,2>{0.843280017f, 0.506313205f},
-std::array<float,2>{0.182790846f, 0.97689122f},
-std::array<float,2>{0.50436914f, 0.189683735f},
-std::array<float,2>{0.0368463062f, 0.029138891f},
-std::array<float,2>{0.625157177f, 0.862771153f},
-std::array<float,2>{0.363566041f, 0.665320158f},
-std::array<float,2>{0.902710974f, 0.315766722f},
-std::array<float,2>{0.457061917f, 0.111539982f},
-std::array<float,2>{0.788760722f, 0.764748931f},
-std::array<float,2>{0.221895516f, 0.703437626f},
-std::array<float,2>{0.568162918f, 0.258146733f},
-std::array<float,2>{0.0705027282f, 0.396012455f},
-std::array<float,2>{0.691875339f, 0.590146899f},
-std::array<float,2>{0.254014015f, 0.900194824f},
-std::array<float,2>{0.938604891f, 0.18003045f},
-std::array<float,2>{0.337818801f, 0.343768388f},
-std::array<float,2>{0.935263693f, 0.63069135f},
-std::array<float,2>{0.0204783436f, 0.838413119f},
-std::array<float,2>{0.657301366f, 0.0587410666f},
-std::array<float,2>{0.130196854f, 0.223072261f},
-std::array<float,2>{0.558240592f, 0.940947771f},
-std::array<float,2>{0.43072927f, 0.54797411f},
-std::array<float,2>{0.861312866f, 0.456216484f},
-std::array<float,2>{0.331355214f, 0.105578318f},
-std::array<float,2>{0.923942626f, 0.780738771f},
-std::array<float,2>{0.0307005737f, 0.697063267f},
-std::array<float,2>{0.66986084f, 0.273510486f},
-std::array<float,2>{0.135335192f, 0.376837432f},
-std::array<float,2>{0.552255332f, 0.567653179f},
-std::array<float,2>{0.42278415f, 0.887959182f},
-std::array<float,2>{0.869037807f, 0.157866612f},
-std::array<float,2>{0.463396013f, 0.367595524f},
-std::array<float,2>{0.790944397f, 0.646994114f},
-std::array<float,2>{0.229470804f, 0.815443814f},
-std::array<float,2>{0.575786829f, 0.0378477015f},
-std::array<float,2>{0.0631029457f, 0.249027058f},
-std::array<float,2>{0.696639121f, 0.958904445f},
-std::array<float,2>{0.258871347f, 0.533401132f},
-std::array<float,2>{0.945900679f, 0.441569567f},
-std::array<float,2>{0.403475702f, 0.144481987f},
-std::array<float,2>{0.835881948f, 0.92490226f},
-std::array<float,2>{0.175205141f, 0.621036351f},
-std::array<float,2>{0.508646965f, 0.419081271f},
-std::array<float,2>{0.0458122268f, 0.296930403f},
-std::array<float,2>{0.637516439f, 0.719651222f},
-std::array<float,2>{0.37137264f, 0.799984872f},
-std::array<float,2>{0.891470432f, 0.0716993883f},
-std::array<float,2>{0.284390092f, 0.470793813f},
-std::array<float,2>{0.969801009f, 0.524454594f},
-std::array<float,2>{0.106741101f, 0.984565973f},
-std::array<float,2>{0.722872376f, 0.217745066f},
-std::array<float,2>{0.188282445f, 0.00586005999f},
-std::array<float,2>{0.598287284f, 0.844288111f},
-std::array<float,2>{0.493509471f, 0.684747875f},
-std::array<float,2>{0.752996564f, 0.33464101f},
-std::array<float,2>{0.278772622f, 0.193199351f},
-std::array<float,2>{0.961432099f, 0.981484473f},
-std::array<float,2>{0.0894957557f, 0.50305748f},
-std::array<float,2>{0.710944414f, 0.499936551f},
-std::array<float,2>{0.243725955f, 0.316892236f},
-std::array<float,2>{0.588852286f, 0.668494642f},
-std::array<float,2>{0.445003122f, 0.864569128f},
-std::array<float,2>{0.811304331f, 0.0237459205f},
-std::array<float,2>{0.408165663f, 0.423588872f},
-std::array<float,2>{0.858767331f, 0.597984612f},
-std::array<float,2>{0.146975234f, 0.912186921f},
-std::array<float,2>{0.543308735f, 0.127371654f},
-std::array<float,2>{0.00309433532f, 0.0914190039f},
-std::array<float,2>{0.681736171f, 0.786493242f},
-std::array<float,2>{0.318929464f, 0.735154748f},
-std::array<float,2>{0.910232544f, 0.291294396f},
-std::array<float,2>{0.482032597f, 0.0562746227f},
-std::array<float,2>{0.776090622f, 0.842426658f},
-std::array<float,2>{0.214549571f, 0.626633525f},
-std::array<float,2>{0.624960959f, 0.348569632f},
-std::array<float,2>{0.119676761f, 0.457424849f},
-std::array<float,2>{0.749789655f, 0.553366303f},
-std::array<float,2>{0.297244251f, 0.941636264f},
-std::array<float,2>{0.98955971f, 0.220569655f},
-std::array<float,2>{0.357246816f, 0.264824778f},
-std::array<float,2>{0.883442581f, 0.710610867f},
-std::array<float,2>{0.0503345765f, 0.757868767f},
-std::array<float,2>{0.64937377f, 0.114818782f},
-std::array<float,2>{0.162943497f, 0.184154451f},
-std::array<float,2>{0.516519964f, 0.904505372f},
-std::array<float,2>{0.376371771f, 0.589382768f},
-std::array<float,2>{0.820668995f, 0.391385645f},
-std::array<float,2>{0.310855508f, 0.0167288762f},
-std::array<float,2>{0.995182276f, 0.868089855f},
-std::array<float,2>{0.117112838f, 0.656776845f},
-std::array<float,2>{0.73855871f, 0.326918215f},
-std::array<float,2>{0.204387143f, 0.488821238f},
-std::array<float,2>{0.610908806f, 0.513707638f},
-std::array<float,2>{0.475394011f, 0.970574319f},
-std::array<float,2>{0.771774888f, 0.199616715f},
-std::array<float,2>{0.38953343f, 0.284272164f},
-std::array<float,2>{0.817712724f, 0.74330157f},
-std::array<float,2>{0.164932266f, 0.794212222f},
-std::array<float,2>{0.524414957f, 0.0824095011f},
-std::array<float,2>{0.0577458814f, 0.13920252f},
-std::array<float,2>{0.644807518f, 0.91586107f},
-std::array<float,2>{0.343782246f, 0.60703361f},
-std::array<float,2>{0.875134766f, 0.436180502f},
-std::array<float,2>{0.446202993f, 0.228822291f},
-std::array<float,2>{0.802514732f, 0.952627599f},
-std::array<float,2>{0.236435011f, 0.555343926f},
-std::array<float,2>{0.584927976f, 0.463406354f},
-std::array<float,2>{0.0797762126f, 0.356923133f},
-std::array<float,2>{0.710554004f, 0.635683239f},
-std::array<float,2>{0.271879345f, 0.833212078f},
-std::array<float,2>{0.956986666f, 0.05108051f},
-std::array<float,2>{0.324867368f, 0.400228858f},
-std::array<float,2>{0.921246111f, 0.579228401f},
-std::array<float,2>{0.0131179532f, 0.895990312f},
-std::array<float,2>{0.67873472f, 0.17887947f},
-std::array<float,2>{0.153400764f, 0.121003233f},
-std::array<float,2>{0.532570481f, 0.752162158f},
-std::array<float,2>{0.415891051f, 0.715816379f},
-std::array<float,2>{0.847843647f, 0.257306844f},
-std::array<float,2>{0.359954745f, 0.171287969f},
-std::array<float,2>{0.899294317f, 0.879658401f},
-std::array<float,2>{0.0330740437f, 0.57723105f},
-std::array<float,2>{0.631027937f, 0.386992127f},
-std::array<float,2>{0.187232926f, 0.271344811f},
-std::array<float,2>{0.503114343f, 0.695016623f},
-std::array<float,2>{0.391972303f, 0.768818915f},
-std::array<float,2>{0.837035716f, 0.0944157094f},
-std::array<float,2>{0.486657798f, 0.448853076f},
-std::array<float,2>{0.764822781f, 0.545733809f},
-std::array<float,2>{0.201566011f, 0.966878712f},
-std::array<float,2>{0.607284129f, 0.237491801f},
-std::array<float,2>{0.100011759f, 0.0462436639f},
-std::array<float,2>{0.730527103f, 0.823566973f},
-std::array<float,2>{0.296084851f, 0.654225767f},
-std::array<float,2>{0.982147157f, 0.361647427f},
-std::array<float,2>{0.437036186f, 0.065304555f},
-std::array<float,2>{0.865322411f, 0.807847321f},
-std::array<float,2>{0.127984881f, 0.732009232f},
-std::array<float,2>{0.559619665f, 0.308406085f},
-std::array<float,2>{0.0175446961f, 0.413509429f},
-std::array<float,2>{0.663705289f, 0.613976121f},
-std::array<float,2>{0.341772258f, 0.935506344f},
-std::array<float,2>{0.929913223f, 0.156158507f},
-std::array<float,2>{0.25263527f, 0.342733592f},
-std::array<float,2>{0.943563998f, 0.674952388f},
-std::array<float,2>{0.0775731504f, 0.851736009f},
-std::array<float,2>{0.689278781f, 0.0115318131f},
-std::array<float,2>{0.225557879f, 0.203643069f},
-std::array<float,2>{0.56565094f, 0.997275293f},
-std::array<float,2>{0.453669876f, 0.518705666f},
-std::array<float,2>{0.784528077f, 0.483222842f},
-std::array<float,2>{0.277085781f, 0.100158334f},
-std::array<float,2>{0.966748774f, 0.769718885f},
-std::array<float,2>{0.0914158896f, 0.687740564f},
-std::array<float,2>{0.718032897f, 0.267873973f},
-std::array<float,2>{0.247587636f, 0.384039104f},
-std::array<float,2>{0.590570331f, 0.572338343f},
-std::array<float,2>{0.438903749f, 0.87848407f},
-std::array<float,2>{0.804948628f, 0.166899428f},
-std::array<float,2>{0.413384974f, 0.365565836f},
-std::array<float,2>{0.853381336f, 0.651882529f},
-std::array<float,2>{0.140755802f, 0.825372398f},
-std::array<float,2>{0.54142493f, 0.0413260795f},
-std::array<float,2>{0.00694369897f, 0.242156014f},
-std::array<float,2>{0.684448123f, 0.964586973f},
-std::array<float,2>{0.312722325f, 0.540197015f},
-std::array<float,2>{0.906733155f, 0.451702356f},
-std::array<float,2>{0.478370577f, 0.151613399f},
-std::array<float,2>{0.780557156f, 0.933588922f},
-std::array<float,2>{0.214873672f, 0.609647453f},
-std::array<float,2>{0.619132757f, 0.408514172f},
-std::array<float,2>{0.123684339f, 0.311640948f},
-std::array<float,2>{0.745421767f, 0.730239928f},
-std::array<float,2>{0.300838083f, 0.812346101f},
-std::array<float,2>{0.986238241f, 0.0699479431f},
-std::array<float,2>{0.353663683f, 0.476735681f},
-std::array<float,2>{0.890507102f, 0.521792829f},
-std::array<float,2>{0.0532336384f, 0.99349606f},
-std::array<float,2>{0.653583586f, 0.208963737f},
-std::array<float,2>{0.158815771f, 0.0132710868f},
-std::array<float,2>{0.522406876f, 0.856665075f},
-std::array<float,2>{0.381001711f, 0.679345787f},
-std::array<float,2>{0.825181961f, 0.336319923f},
-std::array<float,2>{0.333927184f, 0.197469965f},
-std::array<float,2>{0.929641128f, 0.974705994f},
-std::array<float,2>{0.0241991542f, 0.508609951f},
-std::array<float,2>{0.664341033f, 0.486629486f},
-std::array<float,2>{0.138417184f, 0.323543996f},
-std::array<float,2>{0.548874915f, 0.661544561f},
-std::array<float,2>{0.425852567f, 0.874036968f},
-std::array<float,2>{0.873924255f, 0.0206576474f},
-std::array<float,2>{0.465715647f, 0.429802507f},
-std::array<float,2>{0.79677707f, 0.603535056f},
-std::array<float,2>{0.234301105f, 0.920018256f},
-std::array<float,2>{0.571965337f, 0.135827422f},
-std::array<float,2>{0.0672470331f, 0.0785672441f},
-std::array<float,2>{0.700848043f, 0.78989923f},
-std::array<float,2>{0.26436156f, 0.747588098f},
-std::array<float,2>{0.950322092f, 0.287072986f},
-std::array<float,2>{0.398643315f, 0.0483610891f},
-std::array<float,2>{0.831624806f, 0.83145839f},
-std::array<float,2>{0.179208741f, 0.638649702f},
-std::array<float,2>{0.512712717f, 0.354424089f},
-std::array<float,2>{0.0426855832f, 0.468512595f},
-std::array<float,2>{0.63480407f, 0.559720814f},
-std::array<float,2>{0.36739105f, 0.947714627f},
-std::array<float,2>{0.896252215f, 0.232667714f},
-std::array<float,2>{0.286556333f, 0.251118928f},
-std::array<float,2>{0.975601137f, 0.712193131f},
-std::array<float,2>{0.102077097f, 0.755236328f},
-std::array<float,2>{0.72114563f, 0.121829294f},
-std::array<float,2>{0.192087397f, 0.174819082f},
-std::array<float,2>{0.597543001f, 0.89318049f},
-std::array<float,2>{0.499489367f, 0.584197462f},
-std::array<float,2>{0.755504787f, 0.406025112f},
-std::array<float,2>{0.364863694f, 0.0298157874f},
-std::array<float,2>{0.903690517f, 0.861236989f},
-std::array<float,2>{0.0352550484f, 0.666548491f},
-std::array<float,2>{0.626021564f, 0.314407587f},
-std::array<float,2>{0.182248682f, 0.49286136f},
-std::array<float,2>{0.505123556f, 0.505798221f},
-std::array<float,2>{0.395307869f, 0.979313731f},
-std::array<float,2>{0.842494547f, 0.188234344f},
-std::array<float,2>{0.491927207f, 0.295270592f},
-std::array<float,2>{0.759127617f, 0.739787459f},
-std::array<float,2>{0.1957459f, 0.78198266f},
-std::array<float,2>{0.602763951f, 0.0865893662f},
-std::array<float,2>{0.0973365158f, 0.129083693f},
-std::array<float,2>{0.726868808f, 0.907612085f},
-std::array<float,2>{0.289316088f, 0.59700948f},
-std::array<float,2>{0.97829932f, 0.426289171f},
-std::array<float,2>{0.4301458f, 0.225486353f},
-std::array<float,2>{0.859833181f, 0.939287543f},
-std::array<float,2>{0.128995657f, 0.550541639f},
-std::array<float,2>{0.557480454f, 0.454579473f},
-std::array<float,2>{0.0209497865f, 0.34666416f},
-std::array<float,2>{0.656885087f, 0.632795274f},
-std::array<float,2>{0.336497784f, 0.83727324f},
-std::array<float,2>{0.934485197f, 0.061976213f},
-std::array<float,2>{0.255834341f, 0.397277474f},
-std::array<float,2>{0.93807894f, 0.593720615f},
-std::array<float,2>{0.0714351013f, 0.901014566f},
-std::array<float,2>{0.693327665f, 0.181729019f},
-std::array<float,2>{0.220792577f, 0.110788085f},
-std::array<float,2>{0.56642127f, 0.762784004f},
-std::array<float,2>{0.458516926f, 0.706095815f},
-std::array<float,2>{0.787556946f, 0.261642218f},
-std::array<float,2>{0.307016701f, 0.16086176f},
-std::array<float,2>{0.996961951f, 0.883729339f},
-std::array<float,2>{0.109629519f, 0.564765155f},
-std::array<float,2>{0.736918509f, 0.379498661f},
-std::array<float,2>{0.21032609f, 0.277707845f},
-std::array<float,2>{0.617151141f, 0.702506781f},
-std::array<float,2>{0.471442342f, 0.775057137f},
-std::array<float,2>{0.768052161f, 0.103202261f},
-std::array<float,2>{0.385297537f, 0.43808049f},
-std::array<float,2>{0.814953625f, 0.535569012f},
-std::array<float,2>{0.171408355f, 0.955199242f},
-std::array<float,2>{0.527705073f, 0.2443856f},
-std::array<float,2>{0.0593392886f, 0.0350408219f},
-std::array<float,2>{0.642279327f, 0.817623973f},
-std::array<float,2>{0.349155933f, 0.641162038f},
-std::array<float,2>{0.882111728f, 0.374227434f},
-std::array<float,2>{0.450975358f, 0.074935928f},
-std::array<float,2>{0.79843837f, 0.803716958f},
-std::array<float,2>{0.24146606f, 0.725262284f},
-std::array<float,2>{0.579291582f, 0.304593056f},
-std::array<float,2>{0.0838497058f, 0.415834725f},
-std::array<float,2>{0.703194082f, 0.621835053f},
-std::array<float,2>{0.2674734f, 0.929051161f},
-std::array<float,2>{0.957666874f, 0.146569207f},
-std::array<float,2>{0.321948409f, 0.328495115f},
-std::array<float,2>{0.914469719f, 0.680621743f},
-std::array<float,2>{0.00933013018f, 0.851197183f},
-std::array<float,2>{0.675168753f, 0.00285678101f},
-std::array<float,2>{0.151834503f, 0.212700084f},
-std::array<float,2>{0.535896838f, 0.988973737f},
-std::array<float,2>{0.419422001f, 0.527914345f},
-std::array<float,2>{0.846017003f, 0.475419581f},
-std::array<float,2>{0.319387197f, 0.0932716727f},
-std::array<float,2>{0.911723018f, 0.788153172f},
-std::array<float,2>{0.00212745508f, 0.73653084f},
-std::array<float,2>{0.682783604f, 0.290175289f},
-std::array<float,2>{0.147998929f, 0.424602866f},
-std::array<float,2>{0.544534862f, 0.601529956f},
-std::array<float,2>{0.407038659f, 0.910661936f},
-std::array<float,2>{0.857892811f, 0.125512436f},
-std::array<float,2>{0.44385168f, 0.320095718f},
-std::array<float,2>{0.811652958f, 0.670516253f},
-std::array<float,2>{0.242692769f, 0.866748393f},
-std::array<float,2>{0.588915646f, 0.025873756f},
-std::array<float,2>{0.0881167799f, 0.194999233f},
-std::array<float,2>{0.712655365f, 0.983373046f},
-std::array<float,2>{0.27768752f, 0.500786006f},
-std::array<float,2>{0.962800086f, 0.497820705f},
-std::array<float,2>{0.375827909f, 0.186987758f},
-std::array<float,2>{0.82220453f, 0.903477311f},
-std::array<float,2>{0.163914278f, 0.587153256f},
-std::array<float,2>{0.516934931f, 0.393092692f},
-std::array<float,2>{0.0497135557f, 0.261786282f},
-std::array<float,2>{0.649638772f, 0.707737803f},
-std::array<float,2>{0.355799288f, 0.76012367f},
-std::array<float,2>{0.88427645f, 0.1158005f},
-std::array<float,2>{0.298628688f, 0.459253877f},
-std::array<float,2>{0.988626063f, 0.552162409f},
-std::array<float,2>{0.12019065f, 0.944135606f},
-std::array<float,2>{0.748509347f, 0.221332088f},
-std::array<float,2>{0.213582873f, 0.05815145f},
-std::array<float,2>{0.623654246f, 0.841008544f},
-std::array<float,2>{0.481266856f, 0.627144873f},
-std::array<float,2>{0.776783049f, 0.351508915f},
-std::array<float,2>{0.258080065f, 0.246438041f},
-std::array<float,2>{0.946796477f, 0.960873187f},
-std::array<float,2>{0.064226225f, 0.532454908f},
-std::array<float,2>{0.696209133f, 0.443917692f},
-std::array<float,2>{0.229526073f, 0.370834976f},
-std::array<float,2>{0.574905455f, 0.645586014f},
-std::array<float,2>{0.464684695f, 0.813517451f},
-std::array<float,2>{0.78995508f, 0.0362000503f},
-std::array<float,2>{0.42329964f, 0.378011644f},
-std::array<float,2>{0.867331624f, 0.569625437f},
-std::array<float,2>{0.136250004f, 0.890539289f},
-std::array<float,2>{0.551290512f, 0.158688471f},
-std::array<float,2>{0.0301472601f, 0.109360084f},
-std::array<float,2>{0.668013155f, 0.778012156f},
-std::array<float,2>{0.330773413f, 0.698564291f},
-std::array<float,2>{0.925377011f, 0.276411474f},
-std::array<float,2>{0.492362589f, 0.00504516158f},
-std::array<float,2>{0.752485633f, 0.846291363f},
-std::array<float,2>{0.188738927f, 0.686900795f},
-std::array<float,2>{0.598865688f, 0.333585262f},
-std::array<float,2>{0.105486214f, 0.469334275f},
-std::array<float,2>{0.724043369f, 0.52580905f},
-std::array<float,2>{0.284125835f, 0.987578213f},
-std::array<float,2>{0.969445944f, 0.216454238f},
-std::array<float,2>{0.372619092f, 0.3000938f},
-std::array<float,2>{0.891728401f, 0.72239548f},
-std::array<float,2>{0.0460058749f, 0.798578441f},
-std::array<float,2>{0.637729943f, 0.0735869929f},
-std::array<float,2>{0.174000323f, 0.14179951f},
-std::array<float,2>{0.50938791f, 0.922933638f},
-std::array<float,2>{0.403291613f, 0.617898047f},
-std::array<float,2>{0.834025681f, 0.420525908f},
-std::array<float,2>{0.294930607f, 0.0436454602f},
-std::array<float,2>{0.981125593f, 0.820411921f},
-std::array<float,2>{0.100710854f, 0.655684829f},
-std::array<float,2>{0.732331395f, 0.359853774f},
-std::array<float,2>{0.202688709f, 0.446765274f},
-std::array<float,2>{0.60556066f, 0.544702351f},
-std::array<float,2>{0.488061905f, 0.965028882f},
-std::array<float,2>{0.764305651f, 0.235491365f},
-std::array<float,2>{0.391212285f, 0.272132158f},
-std::array<float,2>{0.836376309f, 0.691640317f},
-std::array<float,2>{0.186140701f, 0.765646815f},
-std::array<float,2>{0.5022645f, 0.0958320871f},
-std::array<float,2>{0.0319853015f, 0.169725597f},
-std::array<float,2>{0.632107794f, 0.88158381f},
-std::array<float,2>{0.360562593f, 0.575765014f},
-std::array<float,2>{0.900317907f, 0.389306158f},
-std::array<float,2>{0.45485118f, 0.20655784f},
-std::array<float,2>{0.783796072f, 0.998523176f},
-std::array<float,2>{0.225947976f, 0.517054379f},
-std::array<float,2>{0.564912677f, 0.481179297f},
-std::array<float,2>{0.0767852068f, 0.339872837f},
-std::array<float,2>{0.68831718f, 0.672797143f},
-std::array<float,2>{0.253257394f, 0.855308235f},
-std::array<float,2>{0.944686949f, 0.00856636092f},
-std::array<float,2>{0.340562344f, 0.411648393f},
-std::array<float,2>{0.930765927f, 0.615285575f},
-std::array<float,2>{0.0156822018f, 0.936341405f},
-std::array<float,2>{0.662374198f, 0.152899235f},
-std::array<float,2>{0.127566591f, 0.0626572445f},
-std::array<float,2>{0.5593732f, 0.804704905f},
-std::array<float,2>{0.435946226f, 0.73319459f},
-std::array<float,2>{0.867164314f, 0.30647397f},
-std::array<float,2>{0.345341474f, 0.138423353f},
-std::array<float,2>{0.875982702f, 0.916786671f},
-std::array<float,2>{0.0568092018f, 0.609310031f},
-std::array<float,2>{0.645924032f, 0.434662402f},
-std::array<float,2>{0.165624142f, 0.282339305f},
-std::array<float,2>{0.524200559f, 0.744370937f},
-std::array<float,2>{0.390070915f, 0.79618305f},
-std::array<float,2>{0.817346275f, 0.0844198093f},
-std::array<float,2>{0.476466745f, 0.490549952f},
-std::array<float,2>{0.773128092f, 0.513384342f},
-std::array<float,2>{0.203533128f, 0.971251667f},
-std::array<float,2>{0.610332668f, 0.202482909f},
-std::array<float,2>{0.115649536f, 0.0180276483f},
-std::array<float,2>{0.739418268f, 0.870079696f},
-std::array<float,2>{0.311542243f, 0.660124183f},
-std::array<float,2>{0.99418807f, 0.325427592f},
-std::array<float,2>{0.414979428f, 0.117331408f},
-std::array<float,2>{0.849252939f, 0.751613855f},
-std::array<float,2>{0.153247148f, 0.717861652f},
-std::array<float,2>{0.531401515f, 0.255341619f},
-std::array<float,2>{0.0124964537f, 0.401782125f},
-std::array<float,2>{0.678418577f, 0.580353379f},
-std::array<float,2>{0.325444549f, 0.89660579f},
-std::array<float,2>{0.920677304f, 0.176427543f},
-std::array<float,2>{0.272737265f, 0.358239532f},
-std::array<float,2>{0.955883861f, 0.633753777f},
-std::array<float,2>{0.0781617761f, 0.835256338f},
-std::array<float,2>{0.709082723f, 0.053489618f},
-std::array<float,2>{0.237473682f, 0.227776572f},
-std::array<float,2>{0.585853994f, 0.950999975f},
-std::array<float,2>{0.446689278f, 0.557253957f},
-std::array<float,2>{0.801139057f, 0.461594701f},
-std::array<float,2>{0.304549783f, 0.0670679733f},
-std::array<float,2>{0.987660587f, 0.809895277f},
-std::array<float,2>{0.122019924f, 0.728369772f},
-std::array<float,2>{0.742298663f, 0.309082896f},
-std::array<float,2>{0.218134582f, 0.40798673f},
-std::array<float,2>{0.620881855f, 0.612688243f},
-std::array<float,2>{0.479367375f, 0.9307006f},
-std::array<float,2>{0.778545141f, 0.14888449f},
-std::array<float,2>{0.378960252f, 0.338175148f},
-std::array<float,2>{0.827512383f, 0.676472545f},
-std::array<float,2>{0.156775534f, 0.859110534f},
-std::array<float,2>{0.519578695f, 0.0149845881f},
-std::array<float,2>{0.0516510867f, 0.209806085f},
-std::array<float,2>{0.65457648f, 0.99414134f},
-std::array<float,2>{0.352812618f, 0.519551933f},
-std::array<float,2>{0.887140751f, 0.480451733f},
-std::array<float,2>{0.439703852f, 0.164137647f},
-std::array<float,2>{0.807157338f, 0.876190186f},
-std::array<float,2>{0.249317646f, 0.571790636f},
-std::array<float,2>{0.593508363f, 0.385691762f},
-std::array<float,2>{0.092958957f, 0.266708314f},
-std::array<float,2>{0.715059698f, 0.691044152f},
-std::array<float,2>{0.274869621f, 0.771954834f},
-std::array<float,2>{0.967873633f, 0.0980417728f},
-std::array<float,2>{0.314899892f, 0.450876147f},
-std::array<float,2>{0.908217967f, 0.54183495f},
-std::array<float,2>{0.00496318843f, 0.961454868f},
-std::array<float,2>{0.687012196f, 0.239324659f},
-std::array<float,2>{0.143139794f, 0.0393523686f},
-std::array<float,2>{0.539773583f, 0.826708138f},
-std::array<float,2>{0.412085593f, 0.650206625f},
-std::array<float,2>{0.855364203f, 0.364869535f},
-std::array<float,2>{0.369350195f, 0.230625823f},
-std::array<float,2>{0.897142887f, 0.946917593f},
-std::array<float,2>{0.0400470421f, 0.561598182f},
-std::array<float,2>{0.634591699f, 0.466195703f},
-std::array<float,2>{0.176042408f, 0.353185773f},
-std::array<float,2>{0.513710499f, 0.63879925f},
-std::array<float,2>{0.401799589f, 0.829482317f},
-std::array<float,2>{0.829941571f, 0.0494709127f},
-std::array<float,2>{0.497714162f, 0.403541505f},
-std::array<float,2>{0.756037354f, 0.583869755f},
-std::array<float,2>{0.194839701f, 0.891313076f},
-std::array<float,2>{0.595534801f, 0.172599941f},
-std::array<float,2>{0.105328418f, 0.123585641f},
-std::array<float,2>{0.719614744f, 0.756341279f},
-std::array<float,2>{0.288555831f, 0.714686096f},
-std::array<float,2>{0.973581791f, 0.252775937f},
-std::array<float,2>{0.428292155f, 0.0223256387f},
-std::array<float,2>{0.871727347f, 0.871204734f},
-std::array<float,2>{0.140240178f, 0.663378954f},
-std::array<float,2>{0.548133492f, 0.320411146f},
-std::array<float,2>{0.0272229761f, 0.484578222f},
-std::array<float,2>{0.66686821f, 0.510992944f},
-std::array<float,2>{0.334504634f, 0.973329842f},
-std::array<float,2>{0.926248431f, 0.195312738f},
-std::array<float,2>{0.262300819f, 0.287130713f},
-std::array<float,2>{0.95178169f, 0.748258173f},
-std::array<float,2>{0.0698770583f, 0.792454362f},
-std::array<float,2>{0.701763272f, 0.0806175917f},
-std::array<float,2>{0.230821475f, 0.133920997f},
-std::array<float,2>{0.573867798f, 0.918096483f},
-std::array<float,2>{0.467650563f, 0.602372169f},
-std::array<float,2>{0.7947734f, 0.433387429f},
-std::array<float,2>{0.338433057f, 0.0598959997f},
-std::array<float,2>{0.935947597f, 0.8397367f},
-std::array<float,2>{0.0217175931f, 0.62982899f},
-std::array<float,2>{0.659059584f, 0.345260471f},
-std::array<float,2>{0.132399157f, 0.455298066f},
-std::array<float,2>{0.556401134f, 0.547538757f},
-std::array<float,2>{0.433458179f, 0.940075219f},
-std::array<float,2>{0.862195969f, 0.224189565f},
-std::array<float,2>{0.459473133f, 0.258791924f},
-std::array<float,2>{0.785757482f, 0.704537809f},
-std::array<float,2>{0.219816908f, 0.76429075f},
-std::array<float,2>{0.569033921f, 0.112871602f},
-std::array<float,2>{0.0731662959f, 0.181494877f},
-std::array<float,2>{0.694375396f, 0.898537517f},
-std::array<float,2>{0.25741607f, 0.591330349f},
-std::array<float,2>{0.941067398f, 0.394644737f},
-std::array<float,2>{0.39789018f, 0.191000789f},
-std::array<float,2>{0.84057796f, 0.977969468f},
-std::array<float,2>{0.181453407f, 0.506861269f},
-std::array<float,2>{0.506522655f, 0.494947076f},
-std::array<float,2>{0.038230326f, 0.315351814f},
-std::array<float,2>{0.627826989f, 0.665012181f},
-std::array<float,2>{0.366859943f, 0.861577034f},
-std::array<float,2>{0.904318035f, 0.0280652065f},
-std::array<float,2>{0.292403668f, 0.428017497f},
-std::array<float,2>{0.980254233f, 0.595141709f},
-std::array<float,2>{0.0952809751f, 0.909509957f},
-std::array<float,2>{0.730103374f, 0.131735608f},
-std::array<float,2>{0.198007286f, 0.0890798941f},
-std::array<float,2>{0.604874313f, 0.784620047f},
-std::array<float,2>{0.489803672f, 0.741217732f},
-std::array<float,2>{0.760366499f, 0.293083906f},
-std::array<float,2>{0.268535554f, 0.146443889f},
-std::array<float,2>{0.959152222f, 0.9270913f},
-std::array<float,2>{0.0842002407f, 0.624148726f},
-std::array<float,2>{0.706281364f, 0.416701943f},
-std::array<float,2>{0.23872225f, 0.302064091f},
-std::array<float,2>{0.581678271f, 0.724479854f},
-std::array<float,2>{0.451605797f, 0.802527487f},
-std::array<float,2>{0.799806058f, 0.0775170475f},
-std::array<float,2>{0.421133071f, 0.473946482f},
-std::array<float,2>{0.844571531f, 0.530316591f},
-std::array<float,2>{0.149906948f, 0.991854191f},
-std::array<float,2>{0.537392199f, 0.214730948f},
-std::array<float,2>{0.0105452063f, 0.00032353212f},
-std::array<float,2>{0.672430575f, 0.848097265f},
-std::array<float,2>{0.323874205f, 0.683140695f},
-std::array<float,2>{0.917294979f, 0.330186784f},
-std::array<float,2>{0.469383359f, 0.105060667f},
-std::array<float,2>{0.766987503f, 0.777187705f},
-std::array<float,2>{0.207944304f, 0.70066458f},
-std::array<float,2>{0.61499548f, 0.280228168f},
-std::array<float,2>{0.112920016f, 0.38232097f},
-std::array<float,2>{0.735582113f, 0.562729836f},
-std::array<float,2>{0.305223256f, 0.88555181f},
-std::array<float,2>{0.998265147f, 0.162684515f},
-std::array<float,2>{0.351310939f, 0.372253269f},
-std::array<float,2>{0.879882991f, 0.644170523f},
-std::array<float,2>{0.0607841052f, 0.818699241f},
-std::array<float,2>{0.644126117f, 0.0316076167f},
-std::array<float,2>{0.169763371f, 0.242243186f},
-std::array<float,2>{0.52979064f, 0.954498291f},
-std::array<float,2>{0.383593649f, 0.53882885f},
-std::array<float,2>{0.814329922f, 0.441126436f},
-std::array<float,2>{0.358416587f, 0.114185467f},
-std::array<float,2>{0.885033906f, 0.759428859f},
-std::array<float,2>{0.0483560935f, 0.709074616f},
-std::array<float,2>{0.651703954f, 0.264387488f},
-std::array<float,2>{0.160516202f, 0.391910911f},
-std::array<float,2>{0.51942116f, 0.587998629f},
-std::array<float,2>{0.377880394f, 0.905408323f},
-std::array<float,2>{0.822951257f, 0.185285181f},
-std::array<float,2>{0.484018087f, 0.348660797f},
-std::array<float,2>{0.773847342f, 0.625971675f},
-std::array<float,2>{0.211389467f, 0.843603849f},
-std::array<float,2>{0.622855961f, 0.0550506078f},
-std::array<float,2>{0.118184216f, 0.219243988f},
-std::array<float,2>{0.747632444f, 0.94250387f},
-std::array<float,2>{0.300712556f, 0.553871512f},
-std::array<float,2>{0.991251528f, 0.458214521f},
-std::array<float,2>{0.409446359f, 0.128056258f},
-std::array<float,2>{0.855531812f, 0.913850427f},
-std::array<float,2>{0.146203622f, 0.599159479f},
-std::array<float,2>{0.546235621f, 0.421883494f},
-std::array<float,2>{0.00149675866f, 0.29295224f},
-std::array<float,2>{0.680764973f, 0.736075342f},
-std::array<float,2>{0.317335039f, 0.785275877f},
-std::array<float,2>{0.91394484f, 0.0900892317f},
-std::array<float,2>{0.279978961f, 0.498472422f},
-std::array<float,2>{0.963943183f, 0.502444446f},
-std::array<float,2>{0.0876595154f, 0.981402099f},
-std::array<float,2>{0.714222908f, 0.191916868f},
-std::array<float,2>{0.245128274f, 0.0251775067f},
-std::array<float,2>{0.586962044f, 0.863667965f},
-std::array<float,2>{0.443062663f, 0.669626772f},
-std::array<float,2>{0.808923542f, 0.318270534f},
-std::array<float,2>{0.281490356f, 0.218478337f},
-std::array<float,2>{0.972085178f, 0.985691309f},
-std::array<float,2>{0.108139716f, 0.523726702f},
-std::array<float,2>{0.72465241f, 0.471984506f},
-std::array<float,2>{0.191283375f, 0.335745364f},
-std::array<float,2>{0.600696564f, 0.683876276f},
-std::array<float,2>{0.494520277f, 0.845461667f},
-std::array<float,2>{0.750582099f, 0.00683929073f},
-std::array<float,2>{0.405685216f, 0.418147177f},
-std::array<float,2>{0.832412481f, 0.619309127f},
-std::array<float,2>{0.173700988f, 0.924099326f},
-std::array<float,2>{0.511241794f, 0.142674521f},
-std::array<float,2>{0.0444231778f, 0.07069204f},
-std::array<float,2>{0.640299499f, 0.799747407f},
-std::array<float,2>{0.374683052f, 0.719770312f},
-std::array<float,2>{0.893697321f, 0.298377723f},
-std::array<float,2>{0.461719275f, 0.0382913426f},
-std::array<float,2>{0.792342365f, 0.814834535f},
-std::array<float,2>{0.227182701f, 0.64830476f},
-std::array<float,2>{0.578025699f, 0.36913389f},
-std::array<float,2>{0.0655486137f, 0.442947179f},
-std::array<float,2>{0.697706521f, 0.53472811f},
-std::array<float,2>{0.260584354f, 0.957372069f},
-std::array<float,2>{0.948183358f, 0.248519719f},
-std::array<float,2>{0.329590619f, 0.274942368f},
-std::array<float,2>{0.9225986f, 0.695616484f},
-std::array<float,2>{0.0277081877f, 0.779365003f},
-std::array<float,2>{0.670060158f, 0.107146129f},
-std::array<float,2>{0.133657053f, 0.15651992f},
-std::array<float,2>{0.553797841f, 0.886923611f},
-std::array<float,2>{0.425451875f, 0.566693664f},
-std::array<float,2>{0.869852304f, 0.375405163f},
-std::array<float,2>{0.251936644f, 0.0104927924f},
-std::array<float,2>{0.941738307f, 0.852632761f},
-std::array<float,2>{0.0760878921f, 0.674472094f},
-std::array<float,2>{0.690843165f, 0.342967123f},
-std::array<float,2>{0.222714826f, 0.48428905f},
-std::array<float,2>{0.562566876f, 0.518532515f},
-std::array<float,2>{0.456200778f, 0.996603072f},
-std::array<float,2>{0.782427788f, 0.204442233f},
-std::array<float,2>{0.434137791f, 0.306901813f},
-std::array<float,2>{0.864312172f, 0.731198967f},
-std::array<float,2>{0.125135884f, 0.807551563f},
-std::array<float,2>{0.562235296f, 0.0658487007f},
-std::array<float,2>{0.018359419f, 0.154570505f},
-std::array<float,2>{0.660862446f, 0.93383801f},
-std::array<float,2>{0.342069805f, 0.614877522f},
-std::array<float,2>{0.933397889f, 0.412307918f},
-std::array<float,2>{0.484732628f, 0.236842424f},
-std::array<float,2>{0.762887836f, 0.968317807f},
-std::array<float,2>{0.199988917f, 0.546316743f},
-std::array<float,2>{0.608490586f, 0.44789207f},
-std::array<float,2>{0.0985363275f, 0.362644762f},
-std::array<float,2>{0.732808232f, 0.65290904f},
-std::array<float,2>{0.293572515f, 0.822690189f},
-std::array<float,2>{0.98319602f, 0.0452858359f},
-std::array<float,2>{0.362270057f, 0.388314724f},
-std::array<float,2>{0.900459051f, 0.576678157f},
-std::array<float,2>{0.0332787707f, 0.880330384f},
-std::array<float,2>{0.62971586f, 0.170851499f},
-std::array<float,2>{0.185042366f, 0.0952783227f},
-std::array<float,2>{0.500388026f, 0.768052638f},
-std::array<float,2>{0.393113464f, 0.693767488f},
-std::array<float,2>{0.838702083f, 0.269932598f},
-std::array<float,2>{0.327699184f, 0.178069338f},
-std::array<float,2>{0.918105662f, 0.8951689f},
-std::array<float,2>{0.015529816f, 0.578192711f},
-std::array<float,2>{0.676368535f, 0.399118721f},
-std::array<float,2>{0.15449971f, 0.256016135f},
-std::array<float,2>{0.534920812f, 0.716064513f},
-std::array<float,2>{0.417139947f, 0.75389272f},
-std::array<float,2>{0.850286424f, 0.11969278f},
-std::array<float,2>{0.4477593f, 0.464473724f},
-std::array<float,2>{0.802994549f, 0.556088269f},
-std::array<float,2>{0.236271486f, 0.951755345f},
-std::array<float,2>{0.582556486f, 0.229921728f},
-std::array<float,2>{0.081506893f, 0.052251704f},
-std::array<float,2>{0.707600772f, 0.832496405f},
-std::array<float,2>{0.271309167f, 0.635821164f},
-std::array<float,2>{0.953662395f, 0.356200814f},
-std::array<float,2>{0.387628645f, 0.0830337778f},
-std::array<float,2>{0.819842815f, 0.793841779f},
-std::array<float,2>{0.166440845f, 0.742343962f},
-std::array<float,2>{0.527308822f, 0.283822984f},
-std::array<float,2>{0.0560869202f, 0.437433749f},
-std::array<float,2>{0.647239089f, 0.605527997f},
-std::array<float,2>{0.347551525f, 0.914572477f},
-std::array<float,2>{0.877765954f, 0.139861301f},
-std::array<float,2>{0.309501082f, 0.327220559f},
-std::array<float,2>{0.993618786f, 0.657786727f},
-std::array<float,2>{0.113808155f, 0.868516624f},
-std::array<float,2>{0.742110252f, 0.0162093155f},
-std::array<float,2>{0.206621632f, 0.200669855f},
-std::array<float,2>{0.612915218f, 0.969286621f},
-std::array<float,2>{0.473095685f, 0.514986217f},
-std::array<float,2>{0.769756734f, 0.490027815f},
-std::array<float,2>{0.294200093f, 0.0961342528f},
-std::array<float,2>{0.983632982f, 0.766107202f},
-std::array<float,2>{0.0991098061f, 0.691779256f},
-std::array<float,2>{0.733806014f, 0.272426993f},
-std::array<float,2>{0.200650901f, 0.389462024f},
-std::array<float,2>{0.607616842f, 0.576006591f},
-std::array<float,2>{0.485762388f, 0.881815612f},
-std::array<float,2>{0.761852086f, 0.169654518f},
-std::array<float,2>{0.393652409f, 0.359464437f},
-std::array<float,2>{0.839226127f, 0.65545994f},
-std::array<float,2>{0.183938354f, 0.82066983f},
-std::array<float,2>{0.501065791f, 0.043921791f},
-std::array<float,2>{0.0348062627f, 0.23576656f},
-std::array<float,2>{0.630737901f, 0.965224385f},
-std::array<float,2>{0.362419873f, 0.544639409f},
-std::array<float,2>{0.901995599f, 0.446376979f},
-std::array<float,2>{0.455596626f, 0.153144106f},
-std::array<float,2>{0.782157898f, 0.93616128f},
-std::array<float,2>{0.224093631f, 0.615599513f},
-std::array<float,2>{0.563580573f, 0.411976337f},
-std::array<float,2>{0.0749537647f, 0.306188583f},
-std::array<float,2>{0.689755619f, 0.732923508f},
-std::array<float,2>{0.250797808f, 0.805017054f},
-std::array<float,2>{0.942772329f, 0.0629870594f},
-std::array<float,2>{0.342859f, 0.481431693f},
-std::array<float,2>{0.932475328f, 0.516698778f},
-std::array<float,2>{0.0188990161f, 0.998157144f},
-std::array<float,2>{0.661207378f, 0.206895858f},
-std::array<float,2>{0.126073778f, 0.00846225023f},
-std::array<float,2>{0.561211944f, 0.85503751f},
-std::array<float,2>{0.435207754f, 0.672463f},
-std::array<float,2>{0.863292158f, 0.340171993f},
-std::array<float,2>{0.346674383f, 0.202212349f},
-std::array<float,2>{0.878425956f, 0.971657097f},
-std::array<float,2>{0.055064436f, 0.513604581f},
-std::array<float,2>{0.648150206f, 0.490408689f},
-std::array<float,2>{0.167123213f, 0.325603247f},
-std::array<float,2>{0.526091933f, 0.65974474f},
-std::array<float,2>{0.388147801f, 0.869686723f},
-std::array<float,2>{0.818681479f, 0.0177238248f},
-std::array<float,2>{0.473739117f, 0.43489486f},
-std::array<float,2>{0.77078402f, 0.609036028f},
-std::array<float,2>{0.205887154f, 0.916694164f},
-std::array<float,2>{0.611899197f, 0.13860862f},
-std::array<float,2>{0.11471644f, 0.0840946436f},
-std::array<float,2>{0.740927637f, 0.795945704f},
-std::array<float,2>{0.310153008f, 0.744400203f},
-std::array<float,2>{0.992787004f, 0.282549053f},
-std::array<float,2>{0.416467726f, 0.0532328822f},
-std::array<float,2>{0.850898266f, 0.835148931f},
-std::array<float,2>{0.155722767f, 0.633468747f},
-std::array<float,2>{0.534073055f, 0.358012885f},
-std::array<float,2>{0.0144734308f, 0.461792648f},
-std::array<float,2>{0.677297413f, 0.557544112f},
-std::array<float,2>{0.326286703f, 0.950796247f},
-std::array<float,2>{0.919344842f, 0.227789104f},
-std::array<float,2>{0.270359039f, 0.254911005f},
-std::array<float,2>{0.95468998f, 0.718071878f},
-std::array<float,2>{0.0806852207f, 0.751761317f},
-std::array<float,2>{0.708124638f, 0.117468894f},
-std::array<float,2>{0.235244051f, 0.176653415f},
-std::array<float,2>{0.583065152f, 0.896948755f},
-std::array<float,2>{0.449161112f, 0.580187798f},
-std::array<float,2>{0.804402411f, 0.40138635f},
-std::array<float,2>{0.317396611f, 0.0255570393f},
-std::array<float,2>{0.91304636f, 0.867109478f},
-std::array<float,2>{0.000360527716f, 0.670811594f},
-std::array<float,2>{0.67974788f, 0.319924623f},
-std::array<float,2>{0.14481324f, 0.497592211f},
-std::array<float,2>{0.54534018f, 0.500627279f},
-std::array<float,2>{0.409122944f, 0.983045936f},
-std::array<float,2>{0.856924534f, 0.195225909f},
-std::array<float,2>{0.441651821f, 0.290356666f},
-std::array<float,2>{0.810236931f, 0.736812592f},
-std::array<float,2>{0.244751573f, 0.788419187f},
-std::array<float,2>{0.586351633f, 0.0935410261f},
-std::array<float,2>{0.0862212703f, 0.125847816f},
-std::array<float,2>{0.713043451f, 0.91093415f},
-std::array<float,2>{0.281167954f, 0.60112381f},
-std::array<float,2>{0.963055253f, 0.42440933f},
-std::array<float,2>{0.378181219f, 0.22157757f},
-std::array<float,2>{0.823527694f, 0.944076478f},
-std::array<float,2>{0.16124858f, 0.551895499f},
-std::array<float,2>{0.518165946f, 0.459099114f},
-std::array<float,2>{0.047205057f, 0.351120472f},
-std::array<float,2>{0.650831938f, 0.627360642f},
-std::array<float,2>{0.358256459f, 0.841224313f},
-std::array<float,2>{0.886064053f, 0.0584947355f},
-std::array<float,2>{0.299802482f, 0.393367648f},
-std::array<float,2>{0.990816951f, 0.58739543f},
-std::array<float,2>{0.117942624f, 0.903726578f},
-std::array<float,2>{0.74697572f, 0.186701193f},
-std::array<float,2>{0.212384865f, 0.116140366f},
-std::array<float,2>{0.622025609f, 0.759930491f},
-std::array<float,2>{0.482703686f, 0.707992971f},
-std::array<float,2>{0.774593353f, 0.262014568f},
-std::array<float,2>{0.261053771f, 0.158234209f},
-std::array<float,2>{0.948722959f, 0.890228271f},
-std::array<float,2>{0.0653556138f, 0.569414973f},
-std::array<float,2>{0.69903338f, 0.378310919f},
-std::array<float,2>{0.228082612f, 0.276682615f},
-std::array<float,2>{0.57690227f, 0.698255181f},
-std::array<float,2>{0.462549955f, 0.778101265f},
-std::array<float,2>{0.791593432f, 0.108987607f},
-std::array<float,2>{0.424175888f, 0.444219053f},
-std::array<float,2>{0.870537162f, 0.532537699f},
-std::array<float,2>{0.133933499f, 0.960561156f},
-std::array<float,2>{0.553402185f, 0.246319935f},
-std::array<float,2>{0.0287452694f, 0.0363944136f},
-std::array<float,2>{0.671493173f, 0.813827991f},
-std::array<float,2>{0.328376889f, 0.645982742f},
-std::array<float,2>{0.923267007f, 0.370967269f},
-std::array<float,2>{0.495630711f, 0.0734577328f},
-std::array<float,2>{0.751257062f, 0.798697174f},
-std::array<float,2>{0.190359086f, 0.722497642f},
-std::array<float,2>{0.600120008f, 0.300031871f},
-std::array<float,2>{0.109319352f, 0.420887709f},
-std::array<float,2>{0.725769818f, 0.617992163f},
-std::array<float,2>{0.283103973f, 0.923153579f},
-std::array<float,2>{0.970777988f, 0.141917542f},
-std::array<float,2>{0.373257726f, 0.333896071f},
-std::array<float,2>{0.892879546f, 0.686753809f},
-std::array<float,2>{0.0437744558f, 0.84657228f},
-std::array<float,2>{0.639176726f, 0.00526100444f},
-std::array<float,2>{0.172774613f, 0.216747254f},
-std::array<float,2>{0.510539234f, 0.987432301f},
-std::array<float,2>{0.404736638f, 0.525433719f},
-std::array<float,2>{0.833597422f, 0.469711185f},
-std::array<float,2>{0.365482748f, 0.0866733566f},
-std::array<float,2>{0.906232536f, 0.781915069f},
-std::array<float,2>{0.0377080292f, 0.740140319f},
-std::array<float,2>{0.628683507f, 0.294923812f},
-std::array<float,2>{0.179883152f, 0.426690817f},
-std::array<float,2>{0.507029414f, 0.596720099f},
-std::array<float,2>{0.397129238f, 0.907425523f},
-std::array<float,2>{0.841357768f, 0.129263937f},
-std::array<float,2>{0.489025593f, 0.314146906f},
-std::array<float,2>{0.761596739f, 0.666988194f},
-std::array<float,2>{0.198919684f, 0.86100322f},
-std::array<float,2>{0.604080558f, 0.0302077271f},
-std::array<float,2>{0.0944351777f, 0.18801634f},
-std::array<float,2>{0.728570342f, 0.979239464f},
-std::array<float,2>{0.29142639f, 0.505401075f},
-std::array<float,2>{0.979089797f, 0.492975503f},
-std::array<float,2>{0.431684226f, 0.181972146f},
-std::array<float,2>{0.862880111f, 0.901184499f},
-std::array<float,2>{0.131801888f, 0.593357801f},
-std::array<float,2>{0.555453479f, 0.396988422f},
-std::array<float,2>{0.0229871664f, 0.261250407f},
-std::array<float,2>{0.659941018f, 0.706514955f},
-std::array<float,2>{0.339501053f, 0.762959659f},
-std::array<float,2>{0.937006831f, 0.110403903f},
-std::array<float,2>{0.256563336f, 0.454218179f},
-std::array<float,2>{0.939732194f, 0.550364196f},
-std::array<float,2>{0.0735625327f, 0.939044297f},
-std::array<float,2>{0.693403661f, 0.225341186f},
-std::array<float,2>{0.218919992f, 0.0616891235f},
-std::array<float,2>{0.569450021f, 0.837017834f},
-std::array<float,2>{0.46036303f, 0.632489204f},
-std::array<float,2>{0.786876857f, 0.34638232f},
-std::array<float,2>{0.305956453f, 0.244262606f},
-std::array<float,2>{0.999484599f, 0.955554187f},
-std::array<float,2>{0.11164473f, 0.535186231f},
-std::array<float,2>{0.735049844f, 0.438335449f},
-std::array<float,2>{0.208363295f, 0.37428984f},
-std::array<float,2>{0.613735855f, 0.641577721f},
-std::array<float,2>{0.469936252f, 0.817700028f},
-std::array<float,2>{0.765951693f, 0.0348841026f},
-std::array<float,2>{0.383882284f, 0.379822284f},
-std::array<float,2>{0.812683344f, 0.564539433f},
-std::array<float,2>{0.16807206f, 0.883524299f},
-std::array<float,2>{0.530553937f, 0.161109701f},
-std::array<float,2>{0.0621185005f, 0.103442132f},
-std::array<float,2>{0.643009245f, 0.775385618f},
-std::array<float,2>{0.349946439f, 0.702178717f},
-std::array<float,2>{0.879727066f, 0.27744928f},
-std::array<float,2>{0.453100145f, 0.0025636456f},
-std::array<float,2>{0.799097359f, 0.851383924f},
-std::array<float,2>{0.239844158f, 0.680297196f},
-std::array<float,2>{0.580388069f, 0.328308642f},
-std::array<float,2>{0.0856217891f, 0.475258499f},
-std::array<float,2>{0.705746591f, 0.528153539f},
-std::array<float,2>{0.268889159f, 0.989076495f},
-std::array<float,2>{0.960201204f, 0.212629557f},
-std::array<float,2>{0.323103338f, 0.304379612f},
-std::array<float,2>{0.916658878f, 0.725468874f},
-std::array<float,2>{0.0114837773f, 0.803997874f},
-std::array<float,2>{0.67348218f, 0.0751524568f},
-std::array<float,2>{0.14923507f, 0.14683412f},
-std::array<float,2>{0.538960636f, 0.928881466f},
-std::array<float,2>{0.420124739f, 0.621706188f},
-std::array<float,2>{0.845227838f, 0.415562272f},
-std::array<float,2>{0.273829579f, 0.0410403237f},
-std::array<float,2>{0.967405319f, 0.825644314f},
-std::array<float,2>{0.0925547704f, 0.652185202f},
-std::array<float,2>{0.716127396f, 0.365265787f},
-std::array<float,2>{0.248468697f, 0.451960593f},
-std::array<float,2>{0.592509091f, 0.540300727f},
-std::array<float,2>{0.440936208f, 0.964657426f},
-std::array<float,2>{0.808396518f, 0.241786033f},
-std::array<float,2>{0.410505831f, 0.267718792f},
-std::array<float,2>{0.853777647f, 0.68794024f},
-std::array<float,2>{0.143746451f, 0.769780517f},
-std::array<float,2>{0.540616572f, 0.100403279f},
-std::array<float,2>{0.0044278102f, 0.166683391f},
-std::array<float,2>{0.686462462f, 0.878714681f},
-std::array<float,2>{0.315538257f, 0.57255882f},
-std::array<float,2>{0.90997839f, 0.383853525f},
-std::array<float,2>{0.479555607f, 0.20871602f},
-std::array<float,2>{0.777635992f, 0.993360281f},
-std::array<float,2>{0.217056677f, 0.521506369f},
-std::array<float,2>{0.619706035f, 0.476982892f},
-std::array<float,2>{0.122967981f, 0.336003423f},
-std::array<float,2>{0.743541658f, 0.679549754f},
-std::array<float,2>{0.303367555f, 0.856764615f},
-std::array<float,2>{0.987270355f, 0.0136164222f},
-std::array<float,2>{0.352356344f, 0.40833813f},
-std::array<float,2>{0.888136148f, 0.609513462f},
-std::array<float,2>{0.0525816455f, 0.933340907f},
-std::array<float,2>{0.655536294f, 0.151396617f},
-std::array<float,2>{0.157685339f, 0.0702468008f},
-std::array<float,2>{0.521171391f, 0.81216675f},
-std::array<float,2>{0.379900724f, 0.730107784f},
-std::array<float,2>{0.826893449f, 0.311970621f},
-std::array<float,2>{0.335440665f, 0.136229828f},
-std::array<float,2>{0.926827252f, 0.920295656f},
-std::array<float,2>{0.0257434268f, 0.603895843f},
-std::array<float,2>{0.66749084f, 0.429994762f},
-std::array<float,2>{0.139457822f, 0.28682524f},
-std::array<float,2>{0.546981514f, 0.747840524f},
-std::array<float,2>{0.429575056f, 0.789644778f},
-std::array<float,2>{0.87231487f, 0.078236632f},
-std::array<float,2>{0.468131989f, 0.486358672f},
-std::array<float,2>{0.793841064f, 0.508492827f},
-std::array<float,2>{0.23187767f, 0.974963248f},
-std::array<float,2>{0.572984934f, 0.197617948f},
-std::array<float,2>{0.0692745149f, 0.0207526945f},
-std::array<float,2>{0.703050673f, 0.874439418f},
-std::array<float,2>{0.262852162f, 0.661337972f},
-std::array<float,2>{0.953068554f, 0.323351949f},
-std::array<float,2>{0.400996834f, 0.121777795f},
-std::array<float,2>{0.82862252f, 0.754956603f},
-std::array<float,2>{0.177077666f, 0.712007403f},
-std::array<float,2>{0.515245855f, 0.25132826f},
-std::array<float,2>{0.0399201922f, 0.405950457f},
-std::array<float,2>{0.633604228f, 0.584284067f},
-std::array<float,2>{0.370123118f, 0.893358231f},
-std::array<float,2>{0.898232579f, 0.175216496f},
-std::array<float,2>{0.287854165f, 0.354189098f},
-std::array<float,2>{0.97445631f, 0.638299108f},
-std::array<float,2>{0.104215406f, 0.831288218f},
-std::array<float,2>{0.720302224f, 0.0486580692f},
-std::array<float,2>{0.193615824f, 0.232454136f},
-std::array<float,2>{0.594003975f, 0.947284758f},
-std::array<float,2>{0.496698052f, 0.560045958f},
-std::array<float,2>{0.757209659f, 0.468503237f},
-std::array<float,2>{0.252184778f, 0.0655228868f},
-std::array<float,2>{0.944240451f, 0.807338178f},
-std::array<float,2>{0.0777873844f, 0.731352508f},
-std::array<float,2>{0.688881338f, 0.306744367f},
-std::array<float,2>{0.224777594f, 0.412572533f},
-std::array<float,2>{0.566276252f, 0.61513555f},
-std::array<float,2>{0.453164905f, 0.933785379f},
-std::array<float,2>{0.784772575f, 0.154395774f},
-std::array<float,2>{0.436959535f, 0.343087733f},
-std::array<float,2>{0.866188705f, 0.674711525f},
-std::array<float,2>{0.128864989f, 0.852878869f},
-std::array<float,2>{0.560518801f, 0.0106114028f},
-std::array<float,2>{0.0167996716f, 0.204210266f},
-std::array<float,2>{0.66324091f, 0.99693495f},
-std::array<float,2>{0.340915143f, 0.518297493f},
-std::array<float,2>{0.93049103f, 0.484036595f},
-std::array<float,2>{0.487133026f, 0.170643926f},
-std::array<float,2>{0.765331626f, 0.879932463f},
-std::array<float,2>{0.201696768f, 0.577012956f},
-std::array<float,2>{0.606615126f, 0.388633341f},
-std::array<float,2>{0.100488685f, 0.269644827f},
-std::array<float,2>{0.731310308f, 0.693542004f},
-std::array<float,2>{0.296777248f, 0.767618716f},
-std::array<float,2>{0.98151958f, 0.0956515074f},
-std::array<float,2>{0.359667867f, 0.448061466f},
-std::array<float,2>{0.898460329f, 0.546039462f},
-std::array<float,2>{0.0325277597f, 0.968686521f},
-std::array<float,2>{0.631643414f, 0.237222522f},
-std::array<float,2>{0.186562479f, 0.0449357145f},
-std::array<float,2>{0.503844082f, 0.822303355f},
-std::array<float,2>{0.392462254f, 0.653311193f},
-std::array<float,2>{0.837830544f, 0.362459838f},
-std::array<float,2>{0.324368447f, 0.229682788f},
-std::array<float,2>{0.921841383f, 0.952077448f},
-std::array<float,2>{0.0134839108f, 0.555675328f},
-std::array<float,2>{0.67965585f, 0.464706421f},
-std::array<float,2>{0.154005155f, 0.356263995f},
-std::array<float,2>{0.532735944f, 0.636013985f},
-std::array<float,2>{0.415100008f, 0.832150996f},
-std::array<float,2>{0.8483634f, 0.0526508279f},
-std::array<float,2>{0.445484877f, 0.399276555f},
-std::array<float,2>{0.802189589f, 0.578393161f},
-std::array<float,2>{0.236816943f, 0.895354211f},
-std::array<float,2>{0.584467709f, 0.177800432f},
-std::array<float,2>{0.0792516917f, 0.120062687f},
-std::array<float,2>{0.710158885f, 0.75345552f},
-std::array<float,2>{0.27243048f, 0.715865135f},
-std::array<float,2>{0.956344604f, 0.256177813f},
-std::array<float,2>{0.388717085f, 0.0163744669f},
-std::array<float,2>{0.818044305f, 0.868330896f},
-std::array<float,2>{0.16441527f, 0.658029199f},
-std::array<float,2>{0.524995983f, 0.327401757f},
-std::array<float,2>{0.058138188f, 0.489970326f},
-std::array<float,2>{0.645089805f, 0.514750659f},
-std::array<float,2>{0.344529033f, 0.969587803f},
-std::array<float,2>{0.875772119f, 0.200274214f},
-std::array<float,2>{0.311195016f, 0.284018993f},
-std::array<float,2>{0.995917261f, 0.74254775f},
-std::array<float,2>{0.116385132f, 0.79356271f},
-std::array<float,2>{0.739124298f, 0.0834782794f},
-std::array<float,2>{0.204684511f, 0.140116975f},
-std::array<float,2>{0.610559344f, 0.914881825f},
-std::array<float,2>{0.47498247f, 0.605775654f},
-std::array<float,2>{0.772024512f, 0.437047631f},
-std::array<float,2>{0.35657391f, 0.0547735356f},
-std::array<float,2>{0.883168697f, 0.843326747f},
-std::array<float,2>{0.0502727292f, 0.625700653f},
-std::array<float,2>{0.648657441f, 0.349032313f},
-std::array<float,2>{0.162298918f, 0.458489597f},
-std::array<float,2>{0.515657425f, 0.554086149f},
-std::array<float,2>{0.37646994f, 0.94268924f},
-std::array<float,2>{0.820830226f, 0.219606519f},
-std::array<float,2>{0.481560826f, 0.264475733f},
-std::array<float,2>{0.775593042f, 0.709310949f},
-std::array<float,2>{0.214264974f, 0.759583533f},
-std::array<float,2>{0.624272645f, 0.11377874f},
-std::array<float,2>{0.119145408f, 0.185481921f},
-std::array<float,2>{0.749100566f, 0.905554831f},
-std::array<float,2>{0.297708303f, 0.588264704f},
-std::array<float,2>{0.989897966f, 0.391741842f},
-std::array<float,2>{0.407626241f, 0.192224219f},
-std::array<float,2>{0.859111249f, 0.981150746f},
-std::array<float,2>{0.146590054f, 0.502843022f},
-std::array<float,2>{0.54366082f, 0.498248458f},
-std::array<float,2>{0.00386700756f, 0.317944646f},
-std::array<float,2>{0.682495058f, 0.669838011f},
-std::array<float,2>{0.318795651f, 0.863373578f},
-std::array<float,2>{0.910826027f, 0.0249348879f},
-std::array<float,2>{0.279027641f, 0.422208607f},
-std::array<float,2>{0.961290956f, 0.599597931f},
-std::array<float,2>{0.0888772532f, 0.913698852f},
-std::array<float,2>{0.711550117f, 0.1283838f},
-std::array<float,2>{0.243507653f, 0.0899238959f},
-std::array<float,2>{0.588206172f, 0.785630465f},
-std::array<float,2>{0.444337308f, 0.736283541f},
-std::array<float,2>{0.810719907f, 0.292666614f},
-std::array<float,2>{0.285050452f, 0.142962918f},
-std::array<float,2>{0.970282316f, 0.923928022f},
-std::array<float,2>{0.107139692f, 0.619538784f},
-std::array<float,2>{0.723428965f, 0.418266624f},
-std::array<float,2>{0.187964544f, 0.298743814f},
-std::array<float,2>{0.597776949f, 0.720201492f},
-std::array<float,2>{0.49390021f, 0.799553394f},
-std::array<float,2>{0.753759384f, 0.0704522431f},
-std::array<float,2>{0.404076189f, 0.471845061f},
-std::array<float,2>{0.834997416f, 0.523553133f},
-std::array<float,2>{0.17542769f, 0.9855479f},
-std::array<float,2>{0.508073151f, 0.218703911f},
-std::array<float,2>{0.0453462228f, 0.00718484307f},
-std::array<float,2>{0.637049556f, 0.84524864f},
-std::array<float,2>{0.371895701f, 0.683719456f},
-std::array<float,2>{0.890718162f, 0.335615873f},
-std::array<float,2>{0.463369071f, 0.10733711f},
-std::array<float,2>{0.790163636f, 0.779777646f},
-std::array<float,2>{0.228577942f, 0.695331812f},
-std::array<float,2>{0.575518668f, 0.275227815f},
-std::array<float,2>{0.0625496209f, 0.375191659f},
-std::array<float,2>{0.696824551f, 0.56647867f},
-std::array<float,2>{0.259459019f, 0.886976779f},
-std::array<float,2>{0.945633471f, 0.156409025f},
-std::array<float,2>{0.331868142f, 0.368703097f},
-std::array<float,2>{0.924756885f, 0.647979319f},
-std::array<float,2>{0.0308886878f, 0.814520061f},
-std::array<float,2>{0.669420302f, 0.0384758599f},
-std::array<float,2>{0.135001048f, 0.248193666f},
-std::array<float,2>{0.551999629f, 0.95704186f},
-std::array<float,2>{0.422249258f, 0.534919083f},
-std::array<float,2>{0.868539512f, 0.443262279f},
-std::array<float,2>{0.33717376f, 0.113077819f},
-std::array<float,2>{0.934700608f, 0.764530241f},
-std::array<float,2>{0.0196784642f, 0.704120457f},
-std::array<float,2>{0.658054888f, 0.259130597f},
-std::array<float,2>{0.130810052f, 0.394922376f},
-std::array<float,2>{0.557663023f, 0.591795146f},
-std::array<float,2>{0.431256473f, 0.898769557f},
-std::array<float,2>{0.860496759f, 0.181241378f},
-std::array<float,2>{0.457863837f, 0.345494896f},
-std::array<float,2>{0.788196802f, 0.629611552f},
-std::array<float,2>{0.222644687f, 0.839404821f},
-std::array<float,2>{0.567657709f, 0.0597084425f},
-std::array<float,2>{0.0710500702f, 0.224600762f},
-std::array<float,2>{0.692365229f, 0.940317214f},
-std::array<float,2>{0.254732072f, 0.547655761f},
-std::array<float,2>{0.939430952f, 0.455457151f},
-std::array<float,2>{0.395889491f, 0.131376579f},
-std::array<float,2>{0.843097687f, 0.909398437f},
-std::array<float,2>{0.183345288f, 0.594887376f},
-std::array<float,2>{0.504456997f, 0.427875668f},
-std::array<float,2>{0.0363817364f, 0.293314815f},
-std::array<float,2>{0.625697494f, 0.741456568f},
-std::array<float,2>{0.363878489f, 0.784342408f},
-std::array<float,2>{0.903217435f, 0.0892890617f},
-std::array<float,2>{0.290610462f, 0.494764447f},
-std::array<float,2>{0.976625383f, 0.507136285f},
-std::array<float,2>{0.0961374715f, 0.977656424f},
-std::array<float,2>{0.727830887f, 0.191239074f},
-std::array<float,2>{0.196831211f, 0.0282972734f},
-std::array<float,2>{0.601691842f, 0.861399233f},
-std::array<float,2>{0.490387827f, 0.664631248f},
-std::array<float,2>{0.75839293f, 0.315137744f},
-std::array<float,2>{0.265710652f, 0.214455724f},
-std::array<float,2>{0.958887815f, 0.99201864f},
-std::array<float,2>{0.0827713162f, 0.530647993f},
-std::array<float,2>{0.704351187f, 0.473802209f},
-std::array<float,2>{0.240906298f, 0.330498278f},
-std::array<float,2>{0.578753531f, 0.683382988f},
-std::array<float,2>{0.449353755f, 0.847831011f},
-std::array<float,2>{0.797124922f, 5.78715844e-05f},
-std::array<float,2>{0.418354839f, 0.416880965f},
-std::array<float,2>{0.847293258f, 0.624324262f},
-std::array<float,2>{0.151165038f, 0.926836848f},
-std::array<float,2>{0.536258459f, 0.146158561f},
-std::array<float,2>{0.00834835414f, 0.0773135498f},
-std::array<float,2>{0.673987746f, 0.802291572f},
-std::array<float,2>{0.321143568f, 0.724259138f},
-std::array<float,2>{0.915888369f, 0.301806241f},
-std::array<float,2>{0.472043961f, 0.0313854143f},
-std::array<float,2>{0.769382536f, 0.818429172f},
-std::array<float,2>{0.209152564f, 0.644299805f},
-std::array<float,2>{0.615956724f, 0.372515589f},
-std::array<float,2>{0.110707082f, 0.441343337f},
-std::array<float,2>{0.737323165f, 0.538575768f},
-std::array<float,2>{0.308434784f, 0.954339743f},
-std::array<float,2>{0.998035431f, 0.242639035f},
-std::array<float,2>{0.347933501f, 0.279867947f},
-std::array<float,2>{0.881363332f, 0.700265288f},
-std::array<float,2>{0.0602297783f, 0.776899636f},
-std::array<float,2>{0.641252637f, 0.105258457f},
-std::array<float,2>{0.170052886f, 0.162897587f},
-std::array<float,2>{0.528871059f, 0.885491908f},
-std::array<float,2>{0.385788232f, 0.562881887f},
-std::array<float,2>{0.816277742f, 0.381869435f},
-std::array<float,2>{0.302144825f, 0.0147716254f},
-std::array<float,2>{0.985163331f, 0.859176934f},
-std::array<float,2>{0.124327309f, 0.676725328f},
-std::array<float,2>{0.745034277f, 0.338023305f},
-std::array<float,2>{0.216535822f, 0.480197996f},
-std::array<float,2>{0.617336333f, 0.519891024f},
-std::array<float,2>{0.477023095f, 0.994513452f},
-std::array<float,2>{0.779688776f, 0.209497407f},
-std::array<float,2>{0.38220948f, 0.309564501f},
-std::array<float,2>{0.825895369f, 0.728199244f},
-std::array<float,2>{0.159786493f, 0.809775531f},
-std::array<float,2>{0.522838771f, 0.0671784133f},
-std::array<float,2>{0.0546124205f, 0.148553878f},
-std::array<float,2>{0.653026342f, 0.931087255f},
-std::array<float,2>{0.354876369f, 0.612488091f},
-std::array<float,2>{0.888909996f, 0.407763362f},
-std::array<float,2>{0.437750012f, 0.23969169f},
-std::array<float,2>{0.805717051f, 0.961794853f},
-std::array<float,2>{0.246669486f, 0.541591823f},
-std::array<float,2>{0.591775298f, 0.450987458f},
-std::array<float,2>{0.0904249251f, 0.365193397f},
-std::array<float,2>{0.717759371f, 0.650118589f},
-std::array<float,2>{0.27573359f, 0.827056646f},
-std::array<float,2>{0.965128541f, 0.0393037684f},
-std::array<float,2>{0.314086854f, 0.38547644f},
-std::array<float,2>{0.907522082f, 0.572255731f},
-std::array<float,2>{0.00597503223f, 0.876446486f},
-std::array<float,2>{0.684643269f, 0.164492935f},
-std::array<float,2>{0.142240569f, 0.0977544785f},
-std::array<float,2>{0.542694092f, 0.77150631f},
-std::array<float,2>{0.412929982f, 0.691306233f},
-std::array<float,2>{0.85216856f, 0.266983539f},
-std::array<float,2>{0.368648171f, 0.172828242f},
-std::array<float,2>{0.89514643f, 0.891474724f},
-std::array<float,2>{0.041081734f, 0.583678126f},
-std::array<float,2>{0.636665046f, 0.403725117f},
-std::array<float,2>{0.178138927f, 0.252647132f},
-std::array<float,2>{0.511844397f, 0.714485586f},
-std::array<float,2>{0.400070488f, 0.755882025f},
-std::array<float,2>{0.83030647f, 0.123911865f},
-std::array<float,2>{0.498883069f, 0.465936631f},
-std::array<float,2>{0.754486382f, 0.561977804f},
-std::array<float,2>{0.193218827f, 0.947156966f},
-std::array<float,2>{0.596615136f, 0.23085244f},
-std::array<float,2>{0.102781788f, 0.0496469438f},
-std::array<float,2>{0.722538233f, 0.829226851f},
-std::array<float,2>{0.286003888f, 0.638971329f},
-std::array<float,2>{0.975268245f, 0.353350282f},
-std::array<float,2>{0.427606076f, 0.0809107721f},
-std::array<float,2>{0.87436372f, 0.792027295f},
-std::array<float,2>{0.137441009f, 0.74832654f},
-std::array<float,2>{0.549934208f, 0.287515879f},
-std::array<float,2>{0.0249354932f, 0.433258981f},
-std::array<float,2>{0.665605307f, 0.602053642f},
-std::array<float,2>{0.332532793f, 0.918315411f},
-std::array<float,2>{0.928653657f, 0.134201154f},
-std::array<float,2>{0.265342236f, 0.320674032f},
-std::array<float,2>{0.949789286f, 0.663276017f},
-std::array<float,2>{0.0675445199f, 0.871571839f},
-std::array<float,2>{0.699614286f, 0.0220448803f},
-std::array<float,2>{0.233259201f, 0.195726603f},
-std::array<float,2>{0.571127951f, 0.97349447f},
-std::array<float,2>{0.466662556f, 0.510787308f},
-std::array<float,2>{0.795374393f, 0.484803289f},
-std::array<float,2>{0.273214817f, 0.118251584f},
-std::array<float,2>{0.955116689f, 0.75091064f},
-std::array<float,2>{0.0787866265f, 0.717368126f},
-std::array<float,2>{0.709950864f, 0.254621208f},
-std::array<float,2>{0.238278866f, 0.400898963f},
-std::array<float,2>{0.585227966f, 0.581745505f},
-std::array<float,2>{0.446895361f, 0.898056746f},
-std::array<float,2>{0.801450372f, 0.177464232f},
-std::array<float,2>{0.414308399f, 0.359093547f},
-std::array<float,2>{0.848723888f, 0.634370804f},
-std::array<float,2>{0.152733877f, 0.834714711f},
-std::array<float,2>{0.531854749f, 0.0537662767f},
-std::array<float,2>{0.0121752787f, 0.226998538f},
-std::array<float,2>{0.678136706f, 0.949374259f},
-std::array<float,2>{0.325838387f, 0.558467627f},
-std::array<float,2>{0.919950962f, 0.462171763f},
-std::array<float,2>{0.475727707f, 0.136762142f},
-std::array<float,2>{0.772697151f, 0.917539239f},
-std::array<float,2>{0.203732803f, 0.607914746f},
-std::array<float,2>{0.609520078f, 0.433733314f},
-std::array<float,2>{0.115761422f, 0.281267613f},
-std::array<float,2>{0.740000069f, 0.745677114f},
-std::array<float,2>{0.312101245f, 0.795613885f},
-std::array<float,2>{0.994990051f, 0.0859007835f},
-std::array<float,2>{0.344924986f, 0.491837651f},
-std::array<float,2>{0.876478672f, 0.512013614f},
-std::array<float,2>{0.0574709363f, 0.972495854f},
-std::array<float,2>{0.646302998f, 0.201656193f},
-std::array<float,2>{0.165374458f, 0.0189187787f},
-std::array<float,2>{0.523698866f, 0.870386839f},
-std::array<float,2>{0.39042455f, 0.658585191f},
-std::array<float,2>{0.816668034f, 0.324343801f},
-std::array<float,2>{0.339858562f, 0.205307156f},
-std::array<float,2>{0.931362808f, 0.999083579f},
-std::array<float,2>{0.0163700953f, 0.516004086f},
-std::array<float,2>{0.662808895f, 0.481926531f},
-std::array<float,2>{0.126982138f, 0.341322303f},
-std::array<float,2>{0.559071064f, 0.673594713f},
-std::array<float,2>{0.436257631f, 0.854288578f},
-std::array<float,2>{0.866444528f, 0.00926887989f},
-std::array<float,2>{0.454127192f, 0.410913616f},
-std::array<float,2>{0.783386886f, 0.616298795f},
-std::array<float,2>{0.226177618f, 0.936872721f},
-std::array<float,2>{0.565251172f, 0.153801337f},
-std::array<float,2>{0.0764322206f, 0.0640040189f},
-std::array<float,2>{0.687835038f, 0.806475043f},
-std::array<float,2>{0.25345698f, 0.733910501f},
-std::array<float,2>{0.945077837f, 0.305091798f},
-std::array<float,2>{0.390928596f, 0.0440281816f},
-std::array<float,2>{0.83659488f, 0.821612f},
-std::array<float,2>{0.185589239f, 0.654566765f},
-std::array<float,2>{0.502706647f, 0.360485494f},
-std::array<float,2>{0.0315161534f, 0.445812464f},
-std::array<float,2>{0.632476747f, 0.543515444f},
-std::array<float,2>{0.361237556f, 0.966136396f},
-std::array<float,2>{0.899472356f, 0.235322297f},
-std::array<float,2>{0.295570254f, 0.272769094f},
-std::array<float,2>{0.98063904f, 0.692920685f},
-std::array<float,2>{0.101535864f, 0.766992152f},
-std::array<float,2>{0.731506288f, 0.0972512886f},
-std::array<float,2>{0.202285022f, 0.16824235f},
-std::array<float,2>{0.606382608f, 0.882237375f},
-std::array<float,2>{0.487765849f, 0.574324131f},
-std::array<float,2>{0.763935328f, 0.39031294f},
-std::array<float,2>{0.372487605f, 0.0039821961f},
-std::array<float,2>{0.892362475f, 0.847516358f},
-std::array<float,2>{0.0464854091f, 0.686112463f},
-std::array<float,2>{0.638353288f, 0.332229674f},
-std::array<float,2>{0.174478278f, 0.470200896f},
-std::array<float,2>{0.509046733f, 0.526548386f},
-std::array<float,2>{0.402561635f, 0.986901879f},
-std::array<float,2>{0.834765613f, 0.215010658f},
-std::array<float,2>{0.492798805f, 0.299193561f},
-std::array<float,2>{0.752088249f, 0.721216321f},
-std::array<float,2>{0.189293265f, 0.797122538f},
-std::array<float,2>{0.599387527f, 0.0723538101f},
-std::array<float,2>{0.106023893f, 0.141332254f},
-std::array<float,2>{0.724361658f, 0.922396898f},
-std::array<float,2>{0.283504069f, 0.618513584f},
-std::array<float,2>{0.968989372f, 0.421382427f},
-std::array<float,2>{0.423430711f, 0.247843921f},
-std::array<float,2>{0.867823064f, 0.959196687f},
-std::array<float,2>{0.136201546f, 0.531496644f},
-std::array<float,2>{0.550828993f, 0.44520545f},
-std::array<float,2>{0.0294385944f, 0.369614869f},
-std::array<float,2>{0.668675065f, 0.645213962f},
-std::array<float,2>{0.33046779f, 0.812532663f},
-std::array<float,2>{0.92482698f, 0.0354581177f},
-std::array<float,2>{0.258696169f, 0.377590835f},
-std::array<float,2>{0.946659446f, 0.569096804f},
-std::array<float,2>{0.0637875572f, 0.888806105f},
-std::array<float,2>{0.695372105f, 0.159694538f},
-std::array<float,2>{0.230248883f, 0.107759304f},
-std::array<float,2>{0.574584424f, 0.779161811f},
-std::array<float,2>{0.464169502f, 0.697641373f},
-std::array<float,2>{0.789070368f, 0.275433213f},
-std::array<float,2>{0.298086345f, 0.186267167f},
-std::array<float,2>{0.988860965f, 0.902922034f},
-std::array<float,2>{0.120618559f, 0.586457014f},
-std::array<float,2>{0.748607457f, 0.393666893f},
-std::array<float,2>{0.213167742f, 0.263197005f},
-std::array<float,2>{0.623435557f, 0.708573401f},
-std::array<float,2>{0.480551302f, 0.760844946f},
-std::array<float,2>{0.776894271f, 0.11627166f},
-std::array<float,2>{0.375146657f, 0.460253716f},
-std::array<float,2>{0.821380556f, 0.550825834f},
-std::array<float,2>{0.163527548f, 0.945121109f},
-std::array<float,2>{0.517561793f, 0.222561494f},
-std::array<float,2>{0.0491418242f, 0.0568097085f},
-std::array<float,2>{0.650083005f, 0.840604722f},
-std::array<float,2>{0.356048584f, 0.628744543f},
-std::array<float,2>{0.884355128f, 0.350283861f},
-std::array<float,2>{0.443612993f, 0.0922326595f},
-std::array<float,2>{0.812369406f, 0.787459075f},
-std::array<float,2>{0.242442325f, 0.737986386f},
-std::array<float,2>{0.589475334f, 0.289378673f},
-std::array<float,2>{0.0886964872f, 0.425457835f},
-std::array<float,2>{0.712015986f, 0.599907994f},
-std::array<float,2>{0.278086364f, 0.911325157f},
-std::array<float,2>{0.961928785f, 0.126946747f},
-std::array<float,2>{0.319930106f, 0.319072366f},
-std::array<float,2>{0.911555886f, 0.671023786f},
-std::array<float,2>{0.00251957704f, 0.865749657f},
-std::array<float,2>{0.68316257f, 0.0271475445f},
-std::array<float,2>{0.147596911f, 0.193821058f},
-std::array<float,2>{0.544236183f, 0.983980834f},
-std::array<float,2>{0.40625596f, 0.501275659f},
-std::array<float,2>{0.858359039f, 0.496797383f},
-std::array<float,2>{0.321354657f, 0.0753640458f},
-std::array<float,2>{0.914844275f, 0.803053617f},
-std::array<float,2>{0.00880042929f, 0.725887537f},
-std::array<float,2>{0.675404906f, 0.303242266f},
-std::array<float,2>{0.1523408f, 0.414571017f},
-std::array<float,2>{0.535451055f, 0.622373223f},
-std::array<float,2>{0.419866353f, 0.928345025f},
-std::array<float,2>{0.846539021f, 0.148200393f},
-std::array<float,2>{0.450553387f, 0.329502791f},
-std::array<float,2>{0.798022091f, 0.680809915f},
-std::array<float,2>{0.242129296f, 0.849971116f},
-std::array<float,2>{0.579985678f, 0.00351892039f},
-std::array<float,2>{0.0833741203f, 0.211341247f},
-std::array<float,2>{0.703979552f, 0.989394188f},
-std::array<float,2>{0.266828358f, 0.528553724f},
-std::array<float,2>{0.957055092f, 0.476411253f},
-std::array<float,2>{0.384986967f, 0.16154936f},
-std::array<float,2>{0.814906776f, 0.884299636f},
-std::array<float,2>{0.171382502f, 0.565447569f},
-std::array<float,2>{0.528318942f, 0.380530208f},
-std::array<float,2>{0.0590524077f, 0.278401971f},
-std::array<float,2>{0.642077267f, 0.702054918f},
-std::array<float,2>{0.349073589f, 0.774277925f},
-std::array<float,2>{0.882800996f, 0.101674341f},
-std::array<float,2>{0.307294577f, 0.438487858f},
-std::array<float,2>{0.996403575f, 0.53640312f},
-std::array<float,2>{0.110167399f, 0.956467092f},
-std::array<float,2>{0.73651433f, 0.245956063f},
-std::array<float,2>{0.210709557f, 0.033331532f},
-std::array<float,2>{0.616358101f, 0.816923082f},
-std::array<float,2>{0.47109735f, 0.642361701f},
-std::array<float,2>{0.768470287f, 0.373629838f},
-std::array<float,2>{0.255313307f, 0.225761637f},
-std::array<float,2>{0.93766588f, 0.938444555f},
-std::array<float,2>{0.0721131936f, 0.549215496f},
-std::array<float,2>{0.692398667f, 0.45379746f},
-std::array<float,2>{0.221198693f, 0.347337186f},
-std::array<float,2>{0.567230701f, 0.631562591f},
-std::array<float,2>{0.458179802f, 0.836200356f},
-std::array<float,2>{0.787622571f, 0.0609996207f},
-std::array<float,2>{0.430579543f, 0.397780329f},
-std::array<float,2>{0.859967411f, 0.592762947f},
-std::array<float,2>{0.129725322f, 0.902054548f},
-std::array<float,2>{0.556806505f, 0.182685092f},
-std::array<float,2>{0.0214250516f, 0.109803081f},
-std::array<float,2>{0.656268656f, 0.762010038f},
-std::array<float,2>{0.335944384f, 0.705854654f},
-std::array<float,2>{0.933856308f, 0.26044029f},
-std::array<float,2>{0.491599113f, 0.0310853478f},
-std::array<float,2>{0.759280622f, 0.859642863f},
-std::array<float,2>{0.196094751f, 0.667143404f},
-std::array<float,2>{0.603257537f, 0.313100457f},
-std::array<float,2>{0.0969085097f, 0.49358055f},
-std::array<float,2>{0.727059841f, 0.504095435f},
-std::array<float,2>{0.289968044f, 0.980098426f},
-std::array<float,2>{0.977999151f, 0.189070627f},
-std::array<float,2>{0.364496291f, 0.296589494f},
-std::array<float,2>{0.903871417f, 0.738429844f},
-std::array<float,2>{0.0360932201f, 0.782303154f},
-std::array<float,2>{0.626493573f, 0.0873621628f},
-std::array<float,2>{0.181876972f, 0.13064155f},
-std::array<float,2>{0.505587757f, 0.906567395f},
-std::array<float,2>{0.394961864f, 0.596130729f},
-std::array<float,2>{0.841829896f, 0.427204877f},
-std::array<float,2>{0.28672713f, 0.0477782935f},
-std::array<float,2>{0.976310134f, 0.830185056f},
-std::array<float,2>{0.101870053f, 0.637441576f},
-std::array<float,2>{0.72132647f, 0.355021f},
-std::array<float,2>{0.191659808f, 0.467401862f},
-std::array<float,2>{0.596984923f, 0.559499979f},
-std::array<float,2>{0.49979499f, 0.948886573f},
-std::array<float,2>{0.7548877f, 0.233492047f},
-std::array<float,2>{0.399137765f, 0.250606865f},
-std::array<float,2>{0.831484497f, 0.711346328f},
-std::array<float,2>{0.179150045f, 0.754289567f},
-std::array<float,2>{0.513600588f, 0.122704208f},
-std::array<float,2>{0.0423028022f, 0.174365625f},
-std::array<float,2>{0.635254025f, 0.894486189f},
-std::array<float,2>{0.367832601f, 0.585443914f},
-std::array<float,2>{0.895945787f, 0.405186921f},
-std::array<float,2>{0.465019733f, 0.198620096f},
-std::array<float,2>{0.796185434f, 0.975768983f},
-std::array<float,2>{0.233602762f, 0.509289742f},
-std::array<float,2>{0.571392119f, 0.487603247f},
-std::array<float,2>{0.0666816011f, 0.322416663f},
-std::array<float,2>{0.700423837f, 0.660616994f},
-std::array<float,2>{0.263993144f, 0.873149931f},
-std::array<float,2>{0.950978518f, 0.0197117887f},
-std::array<float,2>{0.333150744f, 0.431437433f},
-std::array<float,2>{0.928783596f, 0.605041564f},
-std::array<float,2>{0.0238493439f, 0.921719849f},
-std::array<float,2>{0.664762795f, 0.134872615f},
-std::array<float,2>{0.137870505f, 0.0793797597f},
-std::array<float,2>{0.54965806f, 0.790412188f},
-std::array<float,2>{0.426299691f, 0.746352017f},
-std::array<float,2>{0.873181999f, 0.285605997f},
-std::array<float,2>{0.354022771f, 0.150559887f},
-std::array<float,2>{0.889769256f, 0.931658506f},
-std::array<float,2>{0.0528180487f, 0.610930622f},
-std::array<float,2>{0.653996229f, 0.409436375f},
-std::array<float,2>{0.158243716f, 0.311427951f},
-std::array<float,2>{0.521806717f, 0.728880703f},
-std::array<float,2>{0.381568879f, 0.81136775f},
-std::array<float,2>{0.824418604f, 0.068415083f},
-std::array<float,2>{0.477781236f, 0.478353977f},
-std::array<float,2>{0.78083849f, 0.523028314f},
-std::array<float,2>{0.21561937f, 0.992604911f},
-std::array<float,2>{0.618584752f, 0.207746699f},
-std::array<float,2>{0.12336012f, 0.0122926077f},
-std::array<float,2>{0.745889962f, 0.856162071f},
-std::array<float,2>{0.301622689f, 0.678513944f},
-std::array<float,2>{0.985571325f, 0.33746767f},
-std::array<float,2>{0.413684905f, 0.10061051f},
-std::array<float,2>{0.852857172f, 0.771268189f},
-std::array<float,2>{0.141184688f, 0.688710749f},
-std::array<float,2>{0.541702986f, 0.269107997f},
-std::array<float,2>{0.00743690971f, 0.383326709f},
-std::array<float,2>{0.683900416f, 0.574208915f},
-std::array<float,2>{0.313427597f, 0.877571821f},
-std::array<float,2>{0.906880498f, 0.167885855f},
-std::array<float,2>{0.276557922f, 0.366989464f},
-std::array<float,2>{0.965954065f, 0.651274204f},
-std::array<float,2>{0.0913028717f, 0.824401438f},
-std::array<float,2>{0.71836251f, 0.0421196558f},
-std::array<float,2>{0.247272909f, 0.240730241f},
-std::array<float,2>{0.58996284f, 0.963840842f},
-std::array<float,2>{0.439021915f, 0.539113045f},
-std::array<float,2>{0.80534476f, 0.452160954f},
-std::array<float,2>{0.308640271f, 0.0821220875f},
-std::array<float,2>{0.99380815f, 0.793961883f},
-std::array<float,2>{0.113678843f, 0.743576825f},
-std::array<float,2>{0.741332769f, 0.284592152f},
-std::array<float,2>{0.206056535f, 0.436297983f},
-std::array<float,2>{0.612388313f, 0.607405245f},
-std::array<float,2>{0.473310947f, 0.915575564f},
-std::array<float,2>{0.770448387f, 0.13944371f},
-std::array<float,2>{0.386819214f, 0.326857179f},
-std::array<float,2>{0.819609761f, 0.657147825f},
-std::array<float,2>{0.16666393f, 0.867707431f},
-std::array<float,2>{0.526845038f, 0.0168905687f},
-std::array<float,2>{0.0561578348f, 0.199395284f},
-std::array<float,2>{0.646760285f, 0.97022754f},
-std::array<float,2>{0.34713158f, 0.514111817f},
-std::array<float,2>{0.877119184f, 0.489086419f},
-std::array<float,2>{0.447371632f, 0.179001153f},
-std::array<float,2>{0.803625882f, 0.895620346f},
-std::array<float,2>{0.235698745f, 0.579556942f},
-std::array<float,2>{0.582254946f, 0.39998275f},
-std::array<float,2>{0.0816019475f, 0.25707829f},
-std::array<float,2>{0.707287192f, 0.715349734f},
-std::array<float,2>{0.270521998f, 0.752336085f},
-std::array<float,2>{0.953435123f, 0.120759457f},
-std::array<float,2>{0.327366561f, 0.463737547f},
-std::array<float,2>{0.918473661f, 0.555489242f},
-std::array<float,2>{0.0149849532f, 0.952367008f},
-std::array<float,2>{0.67608577f, 0.228675053f},
-std::array<float,2>{0.155144453f, 0.0510131754f},
-std::array<float,2>{0.534215033f, 0.833278418f},
-std::array<float,2>{0.417630494f, 0.635421872f},
-std::array<float,2>{0.849923611f, 0.356492072f},
-std::array<float,2>{0.3616772f, 0.237576544f},
-std::array<float,2>{0.901173711f, 0.967091382f},
-std::array<float,2>{0.0337244235f, 0.545430839f},
-std::array<float,2>{0.629383147f, 0.449152797f},
-std::array<float,2>{0.185499683f, 0.361501694f},
-std::array<float,2>{0.500817776f, 0.653869808f},
-std::array<float,2>{0.392894536f, 0.823421001f},
-std::array<float,2>{0.838142931f, 0.0461040661f},
-std::array<float,2>{0.485045135f, 0.386762649f},
-std::array<float,2>{0.763622582f, 0.577441096f},
-std::array<float,2>{0.199592084f, 0.87945652f},
-std::array<float,2>{0.609279513f, 0.171038508f},
-std::array<float,2>{0.0980040208f, 0.0944847837f},
-std::array<float,2>{0.733336151f, 0.768585622f},
-std::array<float,2>{0.293156296f, 0.695084274f},
-std::array<float,2>{0.982422829f, 0.27116847f},
-std::array<float,2>{0.434045047f, 0.0114558684f},
-std::array<float,2>{0.864953756f, 0.851979434f},
-std::array<float,2>{0.125879362f, 0.675230503f},
-std::array<float,2>{0.561993003f, 0.342474371f},
-std::array<float,2>{0.0178806782f, 0.483073503f},
-std::array<float,2>{0.660597563f, 0.51895237f},
-std::array<float,2>{0.342563987f, 0.99750632f},
-std::array<float,2>{0.932829976f, 0.204044357f},
-std::array<float,2>{0.250993371f, 0.308121234f},
-std::array<float,2>{0.941979527f, 0.732273519f},
-std::array<float,2>{0.0752392113f, 0.807934463f},
-std::array<float,2>{0.690978229f, 0.0650772154f},
-std::array<float,2>{0.223507911f, 0.155793518f},
-std::array<float,2>{0.563300908f, 0.935059428f},
-std::array<float,2>{0.456984937f, 0.614221632f},
-std::array<float,2>{0.783066094f, 0.41326794f},
-std::array<float,2>{0.329325467f, 0.0376310907f},
-std::array<float,2>{0.922109008f, 0.815809667f},
-std::array<float,2>{0.0279011913f, 0.647362649f},
-std::array<float,2>{0.67047298f, 0.367398053f},
-std::array<float,2>{0.133085698f, 0.441666067f},
-std::array<float,2>{0.554455459f, 0.533470333f},
-std::array<float,2>{0.425157964f, 0.95854485f},
-std::array<float,2>{0.869415581f, 0.249421805f},
-std::array<float,2>{0.461020082f, 0.273906261f},
-std::array<float,2>{0.792895079f, 0.69693774f},
-std::array<float,2>{0.226567388f, 0.780313969f},
-std::array<float,2>{0.577566028f, 0.105803348f},
-std::array<float,2>{0.0662437081f, 0.158179164f},
-std::array<float,2>{0.697841346f, 0.88776046f},
-std::array<float,2>{0.259853274f, 0.567540646f},
-std::array<float,2>{0.947354496f, 0.376505852f},
-std::array<float,2>{0.405918092f, 0.217433855f},
-std::array<float,2>{0.832526267f, 0.984652162f},
-std::array<float,2>{0.173226207f, 0.524733424f},
-std::array<float,2>{0.510769188f, 0.471165121f},
-std::array<float,2>{0.0445059687f, 0.334872454f},
-std::array<float,2>{0.640133679f, 0.684896946f},
-std::array<float,2>{0.374066412f, 0.844669759f},
-std::array<float,2>{0.894086242f, 0.00612078421f},
-std::array<float,2>{0.282181293f, 0.419243991f},
-std::array<float,2>{0.97263819f, 0.620803177f},
-std::array<float,2>{0.107704088f, 0.925223589f},
-std::array<float,2>{0.725580335f, 0.144188106f},
-std::array<float,2>{0.190834746f, 0.0714446604f},
-std::array<float,2>{0.601542115f, 0.800292253f},
-std::array<float,2>{0.495074362f, 0.719292581f},
-std::array<float,2>{0.750023067f, 0.297279358f},
-std::array<float,2>{0.279445887f, 0.127011582f},
-std::array<float,2>{0.964842618f, 0.912421584f},
-std::array<float,2>{0.0873017237f, 0.597662151f},
-std::array<float,2>{0.714538515f, 0.423551828f},
-std::array<float,2>{0.245708033f, 0.291245192f},
-std::array<float,2>{0.587516665f, 0.734984159f},
-std::array<float,2>{0.442649454f, 0.786286831f},
-std::array<float,2>{0.80928117f, 0.0916973725f},
-std::array<float,2>{0.410100996f, 0.499514014f},
-std::array<float,2>{0.856167436f, 0.503216386f},
-std::array<float,2>{0.145934463f, 0.981724024f},
-std::array<float,2>{0.546810746f, 0.193056911f},
-std::array<float,2>{0.00116337067f, 0.0234393161f},
-std::array<float,2>{0.681248844f, 0.864287078f},
-std::array<float,2>{0.316887408f, 0.668826461f},
-std::array<float,2>{0.913322389f, 0.316437781f},
-std::array<float,2>{0.483568668f, 0.115100101f},
-std::array<float,2>{0.774207413f, 0.75822103f},
-std::array<float,2>{0.211716652f, 0.710836947f},
-std::array<float,2>{0.622193992f, 0.264921963f},
-std::array<float,2>{0.11905238f, 0.39129445f},
-std::array<float,2>{0.747317851f, 0.589744627f},
-std::array<float,2>{0.29992795f, 0.904590845f},
-std::array<float,2>{0.991752863f, 0.184358031f},
-std::array<float,2>{0.359073669f, 0.348258823f},
-std::array<float,2>{0.885552943f, 0.626934469f},
-std::array<float,2>{0.0482403152f, 0.842705488f},
-std::array<float,2>{0.652061641f, 0.0564520918f},
-std::array<float,2>{0.161091059f, 0.220338672f},
-std::array<float,2>{0.518700778f, 0.941682518f},
-std::array<float,2>{0.377204359f, 0.553705752f},
-std::array<float,2>{0.822450876f, 0.457157642f},
-std::array<float,2>{0.350644559f, 0.104293086f},
-std::array<float,2>{0.880855918f, 0.77553165f},
-std::array<float,2>{0.0612337552f, 0.699251533f},
-std::array<float,2>{0.643691123f, 0.280809522f},
-std::array<float,2>{0.169265613f, 0.381277621f},
-std::array<float,2>{0.529360414f, 0.56392163f},
-std::array<float,2>{0.383112609f, 0.886137724f},
-std::array<float,2>{0.813518286f, 0.163144931f},
-std::array<float,2>{0.469175518f, 0.371319205f},
-std::array<float,2>{0.767116487f, 0.643032491f},
-std::array<float,2>{0.207518831f, 0.819578826f},
-std::array<float,2>{0.614274621f, 0.0331578664f},
-std::array<float,2>{0.112747565f, 0.24407506f},
-std::array<float,2>{0.736252546f, 0.953999758f},
-std::array<float,2>{0.305156469f, 0.537726998f},
-std::array<float,2>{0.998669028f, 0.440176368f},
-std::array<float,2>{0.421538889f, 0.14536798f},
-std::array<float,2>{0.844152153f, 0.926542103f},
-std::array<float,2>{0.149538487f, 0.623846054f},
-std::array<float,2>{0.537826598f, 0.41748032f},
-std::array<float,2>{0.0102034099f, 0.301728398f},
-std::array<float,2>{0.672156572f, 0.723154426f},
-std::array<float,2>{0.323456198f, 0.800839484f},
-std::array<float,2>{0.917626023f, 0.0764136761f},
-std::array<float,2>{0.267665356f, 0.472970486f},
-std::array<float,2>{0.959568799f, 0.530040264f},
-std::array<float,2>{0.0845610648f, 0.991115272f},
-std::array<float,2>{0.706571937f, 0.213101074f},
-std::array<float,2>{0.239168227f, 0.00140187109f},
-std::array<float,2>{0.58123666f, 0.849196792f},
-std::array<float,2>{0.451825678f, 0.68167311f},
-std::array<float,2>{0.800639391f, 0.33154729f},
-std::array<float,2>{0.29294017f, 0.189712033f},
-std::array<float,2>{0.979511976f, 0.976748765f},
-std::array<float,2>{0.0949738696f, 0.50605458f},
-std::array<float,2>{0.729791164f, 0.495147228f},
-std::array<float,2>{0.197342247f, 0.315596163f},
-std::array<float,2>{0.605411708f, 0.66523999f},
-std::array<float,2>{0.489362031f, 0.862418771f},
-std::array<float,2>{0.759820342f, 0.0290519632f},
-std::array<float,2>{0.398179561f, 0.429551631f},
-std::array<float,2>{0.840113103f, 0.594153225f},
-std::array<float,2>{0.18089816f, 0.908568203f},
-std::array<float,2>{0.506138325f, 0.132696256f},
-std::array<float,2>{0.0387816988f, 0.0879841f},
-std::array<float,2>{0.627191484f, 0.783409655f},
-std::array<float,2>{0.366309613f, 0.74041599f},
-std::array<float,2>{0.905194044f, 0.294401705f},
-std::array<float,2>{0.45930481f, 0.0589991808f},
-std::array<float,2>{0.78556782f, 0.838741899f},
-std::array<float,2>{0.220692068f, 0.630601585f},
-std::array<float,2>{0.568658531f, 0.344094068f},
-std::array<float,2>{0.0724032447f, 0.45640111f},
-std::array<float,2>{0.695305169f, 0.548282146f},
-std::array<float,2>{0.257058293f, 0.941212535f},
-std::array<float,2>{0.940480888f, 0.22265996f},
-std::array<float,2>{0.338110447f, 0.257994205f},
-std::array<float,2>{0.936249971f, 0.70323503f},
-std::array<float,2>{0.0220899545f, 0.765067339f},
-std::array<float,2>{0.65860647f, 0.111600094f},
-std::array<float,2>{0.1320896f, 0.179892987f},
-std::array<float,2>{0.555869579f, 0.900093734f},
-std::array<float,2>{0.433041394f, 0.589887917f},
-std::array<float,2>{0.861685514f, 0.396467358f},
-std::array<float,2>{0.261749297f, 0.0232218429f},
-std::array<float,2>{0.951406598f, 0.872433126f},
-std::array<float,2>{0.069570601f, 0.663046598f},
-std::array<float,2>{0.701352954f, 0.321335912f},
-std::array<float,2>{0.231231675f, 0.485955328f},
-std::array<float,2>{0.573439956f, 0.510577619f},
-std::array<float,2>{0.466963232f, 0.97441715f},
-std::array<float,2>{0.794242263f, 0.196834758f},
-std::array<float,2>{0.427792788f, 0.288873285f},
-std::array<float,2>{0.871212065f, 0.749350011f},
-std::array<float,2>{0.140126944f, 0.791748226f},
-std::array<float,2>{0.548349917f, 0.0810781047f},
-std::array<float,2>{0.0266976207f, 0.133118778f},
-std::array<float,2>{0.666391969f, 0.919600666f},
-std::array<float,2>{0.334355384f, 0.602796495f},
-std::array<float,2>{0.926318109f, 0.43190527f},
-std::array<float,2>{0.497504681f, 0.232236132f},
-std::array<float,2>{0.756545067f, 0.945605993f},
-std::array<float,2>{0.194525734f, 0.560565233f},
-std::array<float,2>{0.595197141f, 0.465193212f},
-std::array<float,2>{0.104825437f, 0.352294117f},
-std::array<float,2>{0.719180882f, 0.640386283f},
-std::array<float,2>{0.288796902f, 0.82899487f},
-std::array<float,2>{0.972785473f, 0.0500588864f},
-std::array<float,2>{0.369892657f, 0.402823716f},
-std::array<float,2>{0.896782339f, 0.582709789f},
-std::array<float,2>{0.0406469814f, 0.891732872f},
-std::array<float,2>{0.634126604f, 0.17287825f},
-std::array<float,2>{0.176533848f, 0.12414819f},
-std::array<float,2>{0.514413118f, 0.757254422f},
-std::array<float,2>{0.401915073f, 0.71308881f},
-std::array<float,2>{0.829279602f, 0.253896296f},
-std::array<float,2>{0.315270782f, 0.165516376f},
-std::array<float,2>{0.908985198f, 0.875512183f},
-std::array<float,2>{0.00563960383f, 0.570576429f},
-std::array<float,2>{0.686870337f, 0.385871232f},
-std::array<float,2>{0.142904863f, 0.265784353f},
-std::array<float,2>{0.539335072f, 0.689525366f},
-std::array<float,2>{0.411213487f, 0.772599876f},
-std::array<float,2>{0.85493356f, 0.0992287621f},
-std::array<float,2>{0.440000981f, 0.44960013f},
-std::array<float,2>{0.806950688f, 0.542009652f},
-std::array<float,2>{0.249572366f, 0.962408125f},
-std::array<float,2>{0.593059301f, 0.238540247f},
-std::array<float,2>{0.0933744535f, 0.0402390733f},
-std::array<float,2>{0.715498626f, 0.827346206f},
-std::array<float,2>{0.275207996f, 0.649009943f},
-std::array<float,2>{0.968497992f, 0.364123791f},
-std::array<float,2>{0.379460067f, 0.067942813f},
-std::array<float,2>{0.827820897f, 0.808768332f},
-std::array<float,2>{0.156282902f, 0.727339625f},
-std::array<float,2>{0.520218909f, 0.309939057f},
-std::array<float,2>{0.0509088859f, 0.406743407f},
-std::array<float,2>{0.655064046f, 0.61226064f},
-std::array<float,2>{0.353278577f, 0.929703295f},
-std::array<float,2>{0.887573183f, 0.149507567f},
-std::array<float,2>{0.303768545f, 0.339353919f},
-std::array<float,2>{0.988236189f, 0.677391708f},
-std::array<float,2>{0.12147148f, 0.857872963f},
-std::array<float,2>{0.743056476f, 0.01419512f},
-std::array<float,2>{0.218549237f, 0.210194603f},
-std::array<float,2>{0.620424151f, 0.995589197f},
-std::array<float,2>{0.47881642f, 0.521203279f},
-std::array<float,2>{0.779018342f, 0.478585541f},
-std::array<float,2>{0.300374448f, 0.116799243f},
-std::array<float,2>{0.991482794f, 0.761435032f},
-std::array<float,2>{0.11848022f, 0.708037794f},
-std::array<float,2>{0.747964561f, 0.262849003f},
-std::array<float,2>{0.211074933f, 0.394451916f},
-std::array<float,2>{0.622784495f, 0.586255431f},
-std::array<float,2>{0.484158039f, 0.902500093f},
-std::array<float,2>{0.773473144f, 0.185620353f},
-std::array<float,2>{0.377657473f, 0.349659771f},
-std::array<float,2>{0.823228836f, 0.628012657f},
-std::array<float,2>{0.160252467f, 0.840025663f},
-std::array<float,2>{0.519176304f, 0.0573005676f},
-std::array<float,2>{0.0486802496f, 0.222105622f},
-std::array<float,2>{0.651599467f, 0.944361329f},
-std::array<float,2>{0.35887897f, 0.551487863f},
-std::array<float,2>{0.884979963f, 0.460645348f},
-std::array<float,2>{0.443147808f, 0.126077548f},
-std::array<float,2>{0.80873543f, 0.912015676f},
-std::array<float,2>{0.245550349f, 0.60033977f},
-std::array<float,2>{0.587286234f, 0.424891263f},
-std::array<float,2>{0.0874531642f, 0.289937884f},
-std::array<float,2>{0.714059353f, 0.737573743f},
-std::array<float,2>{0.280031651f, 0.787997425f},
-std::array<float,2>{0.964227915f, 0.0923958644f},
-std::array<float,2>{0.317028046f, 0.496153116f},
-std::array<float,2>{0.913743138f, 0.501847625f},
-std::array<float,2>{0.00178797171f, 0.983690798f},
-std::array<float,2>{0.680985928f, 0.194291979f},
-std::array<float,2>{0.146254361f, 0.0265806802f},
-std::array<float,2>{0.545904577f, 0.865470409f},
-std::array<float,2>{0.409385324f, 0.671464801f},
-std::array<float,2>{0.855822742f, 0.318789929f},
-std::array<float,2>{0.374959439f, 0.215458781f},
-std::array<float,2>{0.894005835f, 0.986631632f},
-std::array<float,2>{0.044116836f, 0.527018666f},
-std::array<float,2>{0.640479565f, 0.470579147f},
-std::array<float,2>{0.173553586f, 0.332912207f},
-std::array<float,2>{0.511709869f, 0.685728788f},
-std::array<float,2>{0.405481279f, 0.847071767f},
-std::array<float,2>{0.832172394f, 0.00440495322f},
-std::array<float,2>{0.494323432f, 0.421523958f},
-std::array<float,2>{0.750884414f, 0.618829072f},
-std::array<float,2>{0.190949708f, 0.922263682f},
-std::array<float,2>{0.600971282f, 0.140702531f},
-std::array<float,2>{0.108387105f, 0.0727960616f},
-std::array<float,2>{0.725084007f, 0.797521472f},
-std::array<float,2>{0.281601131f, 0.720731378f},
-std::array<float,2>{0.971789479f, 0.299511284f},
-std::array<float,2>{0.425775766f, 0.0361191817f},
-std::array<float,2>{0.869966149f, 0.813076794f},
-std::array<float,2>{0.133513629f, 0.644705415f},
-std::array<float,2>{0.554146647f, 0.370052189f},
-std::array<float,2>{0.0273697097f, 0.444691271f},
-std::array<float,2>{0.670378864f, 0.532194972f},
-std::array<float,2>{0.329944789f, 0.959619403f},
-std::array<float,2>{0.92273283f, 0.247386545f},
-std::array<float,2>{0.260383695f, 0.275976986f},
-std::array<float,2>{0.947781801f, 0.697827816f},
-std::array<float,2>{0.0657104179f, 0.778746903f},
-std::array<float,2>{0.697401881f, 0.107941642f},
-std::array<float,2>{0.227298468f, 0.159578487f},
-std::array<float,2>{0.577725351f, 0.889598966f},
-std::array<float,2>{0.461605102f, 0.568745732f},
-std::array<float,2>{0.7920416f, 0.37713486f},
-std::array<float,2>{0.341828883f, 0.00928485859f},
-std::array<float,2>{0.933184326f, 0.853874266f},
-std::array<float,2>{0.018229574f, 0.673005998f},
-std::array<float,2>{0.661111593f, 0.340919375f},
-std::array<float,2>{0.125447169f, 0.481963992f},
-std::array<float,2>{0.56236136f, 0.51615566f},
-std::array<float,2>{0.434538394f, 0.999533772f},
-std::array<float,2>{0.864705086f, 0.20580548f},
-std::array<float,2>{0.456416517f, 0.305278361f},
-std::array<float,2>{0.782544971f, 0.733596146f},
-std::array<float,2>{0.223074466f, 0.805724204f},
-std::array<float,2>{0.562874079f, 0.0638669133f},
-std::array<float,2>{0.0758296326f, 0.154104292f},
-std::array<float,2>{0.690506756f, 0.937054157f},
-std::array<float,2>{0.251507998f, 0.617177308f},
-std::array<float,2>{0.941617191f, 0.410562485f},
-std::array<float,2>{0.393332779f, 0.234686553f},
-std::array<float,2>{0.838546634f, 0.966592968f},
-std::array<float,2>{0.184680358f, 0.543293178f},
-std::array<float,2>{0.500064492f, 0.445557982f},
-std::array<float,2>{0.0335530825f, 0.361047208f},
-std::array<float,2>{0.629458547f, 0.65517813f},
-std::array<float,2>{0.361851811f, 0.82213819f},
-std::array<float,2>{0.900789261f, 0.044899907f},
-std::array<float,2>{0.293896645f, 0.389782339f},
-std::array<float,2>{0.982977092f, 0.574988902f},
-std::array<float,2>{0.0982202142f, 0.88235867f},
-std::array<float,2>{0.732558072f, 0.168489799f},
-std::array<float,2>{0.199781239f, 0.096783556f},
-std::array<float,2>{0.608856857f, 0.767230034f},
-std::array<float,2>{0.484558225f, 0.692635059f},
-std::array<float,2>{0.763056695f, 0.273205578f},
-std::array<float,2>{0.27119723f, 0.176940024f},
-std::array<float,2>{0.953939736f, 0.897898614f},
-std::array<float,2>{0.0811900347f, 0.581105947f},
-std::array<float,2>{0.707943976f, 0.400821984f},
-std::array<float,2>{0.236015782f, 0.254268646f},
-std::array<float,2>{0.582985461f, 0.716801763f},
-std::array<float,2>{0.448123455f, 0.750430822f},
-std::array<float,2>{0.802853823f, 0.119058549f},
-std::array<float,2>{0.417378575f, 0.462415636f},
-std::array<float,2>{0.850509942f, 0.558002651f},
-std::array<float,2>{0.154556662f, 0.950032115f},
-std::array<float,2>{0.534686804f, 0.227473006f},
-std::array<float,2>{0.0152649498f, 0.0545661189f},
-std::array<float,2>{0.676596642f, 0.834209204f},
-std::array<float,2>{0.327940583f, 0.634120941f},
-std::array<float,2>{0.918406665f, 0.358507961f},
-std::array<float,2>{0.472820729f, 0.0850247815f},
-std::array<float,2>{0.769828081f, 0.795017779f},
-std::array<float,2>{0.207021564f, 0.745344758f},
-std::array<float,2>{0.613115907f, 0.281943232f},
-std::array<float,2>{0.114106975f, 0.434348106f},
-std::array<float,2>{0.741895318f, 0.607607603f},
-std::array<float,2>{0.309095711f, 0.917128503f},
-std::array<float,2>{0.9931916f, 0.137244239f},
-std::array<float,2>{0.347260833f, 0.324760228f},
-std::array<float,2>{0.877641976f, 0.658885896f},
-std::array<float,2>{0.0558947511f, 0.871032834f},
-std::array<float,2>{0.647001624f, 0.0193813629f},
-std::array<float,2>{0.16617167f, 0.201722756f},
-std::array<float,2>{0.527065575f, 0.972035468f},
-std::array<float,2>{0.387354136f, 0.5125404f},
-std::array<float,2>{0.820163488f, 0.491527587f},
-std::array<float,2>{0.352698803f, 0.0690092966f},
-std::array<float,2>{0.886920452f, 0.810634017f},
-std::array<float,2>{0.0513755009f, 0.729210615f},
-std::array<float,2>{0.654370427f, 0.310735881f},
-std::array<float,2>{0.157204345f, 0.409736544f},
-std::array<float,2>{0.519957066f, 0.61075753f},
-std::array<float,2>{0.379342347f, 0.932317138f},
-std::array<float,2>{0.827237844f, 0.151319653f},
-std::array<float,2>{0.47922194f, 0.336928695f},
-std::array<float,2>{0.77862668f, 0.678214729f},
-std::array<float,2>{0.217904717f, 0.855927825f},
-std::array<float,2>{0.620616496f, 0.0118935788f},
-std::array<float,2>{0.121676318f, 0.207162902f},
-std::array<float,2>{0.742433429f, 0.99311471f},
-std::array<float,2>{0.304443002f, 0.522653937f},
-std::array<float,2>{0.987325788f, 0.477597594f},
-std::array<float,2>{0.411645353f, 0.1670174f},
-std::array<float,2>{0.855144978f, 0.876992106f},
-std::array<float,2>{0.143345222f, 0.573516488f},
-std::array<float,2>{0.540009499f, 0.382838488f},
-std::array<float,2>{0.00528166909f, 0.268814802f},
-std::array<float,2>{0.687378347f, 0.689148068f},
-std::array<float,2>{0.314492166f, 0.77070874f},
-std::array<float,2>{0.908613563f, 0.101415634f},
-std::array<float,2>{0.274489999f, 0.453055412f},
-std::array<float,2>{0.968049705f, 0.53965795f},
-std::array<float,2>{0.093135722f, 0.962908685f},
-std::array<float,2>{0.715192199f, 0.240487576f},
-std::array<float,2>{0.249142885f, 0.0425412841f},
-std::array<float,2>{0.593305528f, 0.824971139f},
-std::array<float,2>{0.43954882f, 0.650517642f},
-std::array<float,2>{0.807408214f, 0.366379827f},
-std::array<float,2>{0.288316429f, 0.234054253f},
-std::array<float,2>{0.973306775f, 0.948392689f},
-std::array<float,2>{0.105146743f, 0.558687031f},
-std::array<float,2>{0.719417751f, 0.466961265f},
-std::array<float,2>{0.195084751f, 0.354944229f},
-std::array<float,2>{0.595266402f, 0.637014627f},
-std::array<float,2>{0.497957259f, 0.830982804f},
-std::array<float,2>{0.756107926f, 0.0471092947f},
-std::array<float,2>{0.401553363f, 0.404521018f},
-std::array<float,2>{0.829601228f, 0.585863292f},
-std::array<float,2>{0.175893262f, 0.893782973f},
-std::array<float,2>{0.514130473f, 0.174235091f},
-std::array<float,2>{0.0404983535f, 0.122195311f},
-std::array<float,2>{0.634474158f, 0.754530549f},
-std::array<float,2>{0.36942637f, 0.711458087f},
-std::array<float,2>{0.897383869f, 0.25037986f},
-std::array<float,2>{0.467426389f, 0.0203670859f},
-std::array<float,2>{0.794544399f, 0.874000371f},
-std::array<float,2>{0.230703011f, 0.661033511f},
-std::array<float,2>{0.574016452f, 0.323028564f},
-std::array<float,2>{0.0701283216f, 0.488110989f},
-std::array<float,2>{0.70206809f, 0.508913159f},
-std::array<float,2>{0.262456715f, 0.97644347f},
-std::array<float,2>{0.952077329f, 0.198984116f},
-std::array<float,2>{0.334918141f, 0.285769731f},
-std::array<float,2>{0.925995767f, 0.746898115f},
-std::array<float,2>{0.0269831773f, 0.790758014f},
-std::array<float,2>{0.666627526f, 0.0800032467f},
-std::array<float,2>{0.140441418f, 0.135480046f},
-std::array<float,2>{0.548027396f, 0.920939803f},
-std::array<float,2>{0.428502381f, 0.604700089f},
-std::array<float,2>{0.872033358f, 0.431041688f},
-std::array<float,2>{0.257722169f, 0.0614810027f},
-std::array<float,2>{0.941295922f, 0.836625457f},
-std::array<float,2>{0.0729352683f, 0.631083429f},
-std::array<float,2>{0.694621801f, 0.346721917f},
-std::array<float,2>{0.220141053f, 0.453347474f},
-std::array<float,2>{0.569133997f, 0.549704373f},
-std::array<float,2>{0.459916949f, 0.937509239f},
-std::array<float,2>{0.786014974f, 0.226354167f},
-std::array<float,2>{0.433129251f, 0.26008296f},
-std::array<float,2>{0.861928642f, 0.705138683f},
-std::array<float,2>{0.132695854f, 0.762442946f},
-std::array<float,2>{0.556193173f, 0.110058025f},
-std::array<float,2>{0.0219721086f, 0.18315433f},
-std::array<float,2>{0.658777237f, 0.90170455f},
-std::array<float,2>{0.338855267f, 0.591898978f},
-std::array<float,2>{0.935623765f, 0.397970676f},
-std::array<float,2>{0.490135908f, 0.188518211f},
-std::array<float,2>{0.760722995f, 0.979923308f},
-std::array<float,2>{0.197817072f, 0.504450381f},
-std::array<float,2>{0.604553759f, 0.493902385f},
-std::array<float,2>{0.0955965966f, 0.312901288f},
-std::array<float,2>{0.730456114f, 0.667958081f},
-std::array<float,2>{0.292225301f, 0.860250354f},
-std::array<float,2>{0.980189145f, 0.0306431148f},
-std::array<float,2>{0.366950899f, 0.427253515f},
-std::array<float,2>{0.904614985f, 0.596328199f},
-std::array<float,2>{0.0383816697f, 0.907064438f},
-std::array<float,2>{0.627508283f, 0.130176187f},
-std::array<float,2>{0.181390032f, 0.0877219439f},
-std::array<float,2>{0.506634474f, 0.782783151f},
-std::array<float,2>{0.39749971f, 0.739032567f},
-std::array<float,2>{0.840538502f, 0.296166003f},
-std::array<float,2>{0.324126363f, 0.147552028f},
-std::array<float,2>{0.917121351f, 0.928049982f},
-std::array<float,2>{0.0104008531f, 0.622651756f},
-std::array<float,2>{0.672712624f, 0.414064944f},
-std::array<float,2>{0.150186941f, 0.302800715f},
-std::array<float,2>{0.537239313f, 0.726095617f},
-std::array<float,2>{0.421380788f, 0.803389192f},
-std::array<float,2>{0.84424299f, 0.0757447705f},
-std::array<float,2>{0.451391011f, 0.475799412f},
-std::array<float,2>{0.800171077f, 0.528892815f},
-std::array<float,2>{0.238283217f, 0.990009308f},
-std::array<float,2>{0.581858337f, 0.211560011f},
-std::array<float,2>{0.0843846723f, 0.00301709399f},
-std::array<float,2>{0.706513286f, 0.850380123f},
-std::array<float,2>{0.268261999f, 0.681319654f},
-std::array<float,2>{0.959370613f, 0.329801708f},
-std::array<float,2>{0.38348496f, 0.102156647f},
-std::array<float,2>{0.814038157f, 0.773529947f},
-std::array<float,2>{0.16949977f, 0.701501131f},
-std::array<float,2>{0.530193508f, 0.279180706f},
-std::array<float,2>{0.0608832613f, 0.38017723f},
-std::array<float,2>{0.644493759f, 0.566367865f},
-std::array<float,2>{0.351463228f, 0.884090304f},
-std::array<float,2>{0.880320311f, 0.161637962f},
-std::array<float,2>{0.305502117f, 0.373192817f},
-std::array<float,2>{0.998399079f, 0.642043471f},
-std::array<float,2>{0.11318551f, 0.81684202f},
-std::array<float,2>{0.735768378f, 0.033895582f},
-std::array<float,2>{0.207529292f, 0.245433584f},
-std::array<float,2>{0.614797235f, 0.956878126f},
-std::array<float,2>{0.46949017f, 0.537078559f},
-std::array<float,2>{0.766761184f, 0.439093202f},
-std::array<float,2>{0.277570397f, 0.0909396335f},
-std::array<float,2>{0.962519288f, 0.786796987f},
-std::array<float,2>{0.0882079303f, 0.734817266f},
-std::array<float,2>{0.712547123f, 0.291701317f},
-std::array<float,2>{0.243079603f, 0.423048764f},
-std::array<float,2>{0.589188159f, 0.59820658f},
-std::array<float,2>{0.444299132f, 0.912697256f},
-std::array<float,2>{0.811946571f, 0.127919257f},
-std::array<float,2>{0.406770647f, 0.317300737f},
-std::array<float,2>{0.857641876f, 0.668290377f},
-std::array<float,2>{0.148228481f, 0.865186334f},
-std::array<float,2>{0.544725716f, 0.0243398454f},
-std::array<float,2>{0.00243237708f, 0.192571044f},
-std::array<float,2>{0.682906628f, 0.982337773f},
-std::array<float,2>{0.319824159f, 0.503854394f},
-std::array<float,2>{0.911940336f, 0.499051362f},
-std::array<float,2>{0.481174141f, 0.183938965f},
-std::array<float,2>{0.776586831f, 0.905250847f},
-std::array<float,2>{0.213830888f, 0.589114487f},
-std::array<float,2>{0.623833477f, 0.390633941f},
-std::array<float,2>{0.120510384f, 0.265617281f},
-std::array<float,2>{0.748247266f, 0.710202575f},
-std::array<float,2>{0.29843232f, 0.758633316f},
-std::array<float,2>{0.988349438f, 0.114537247f},
-std::array<float,2>{0.355491936f, 0.45781368f},
-std::array<float,2>{0.883808792f, 0.552905738f},
-std::array<float,2>{0.0494602211f, 0.942259312f},
-std::array<float,2>{0.649694085f, 0.220196366f},
-std::array<float,2>{0.163692906f, 0.0560861975f},
-std::array<float,2>{0.516814828f, 0.842014432f},
-std::array<float,2>{0.375716627f, 0.626159966f},
-std::array<float,2>{0.821991205f, 0.348031729f},
-std::array<float,2>{0.330855131f, 0.249529973f},
-std::array<float,2>{0.925555885f, 0.958027005f},
-std::array<float,2>{0.0300128907f, 0.533880591f},
-std::array<float,2>{0.668455303f, 0.442138255f},
-std::array<float,2>{0.136646539f, 0.36795035f},
-std::array<float,2>{0.551751316f, 0.646860003f},
-std::array<float,2>{0.423079997f, 0.816008329f},
-std::array<float,2>{0.867666304f, 0.0371946357f},
-std::array<float,2>{0.464534551f, 0.376290411f},
-std::array<float,2>{0.789603949f, 0.56804657f},
-std::array<float,2>{0.229785681f, 0.88862431f},
-std::array<float,2>{0.574991643f, 0.157462746f},
-std::array<float,2>{0.0641946122f, 0.10615962f},
-std::array<float,2>{0.695859909f, 0.780961633f},
-std::array<float,2>{0.257952929f, 0.696505368f},
-std::array<float,2>{0.94710809f, 0.27418685f},
-std::array<float,2>{0.402893364f, 0.00681630056f},
-std::array<float,2>{0.834329784f, 0.844193161f},
-std::array<float,2>{0.174183801f, 0.68514061f},
-std::array<float,2>{0.509627402f, 0.334085107f},
-std::array<float,2>{0.0462626889f, 0.471291423f},
-std::array<float,2>{0.638025224f, 0.524937034f},
-std::array<float,2>{0.373025596f, 0.985140979f},
-std::array<float,2>{0.891851485f, 0.21702373f},
-std::array<float,2>{0.283756047f, 0.297471851f},
-std::array<float,2>{0.969666541f, 0.719062924f},
-std::array<float,2>{0.10585697f, 0.800464869f},
-std::array<float,2>{0.723792672f, 0.0718744919f},
-std::array<float,2>{0.188505769f, 0.143655419f},
-std::array<float,2>{0.598879158f, 0.925630987f},
-std::array<float,2>{0.492638528f, 0.620546222f},
-std::array<float,2>{0.752836227f, 0.41953212f},
-std::array<float,2>{0.360607207f, 0.0467839837f},
-std::array<float,2>{0.900019646f, 0.823795319f},
-std::array<float,2>{0.0319552012f, 0.653557062f},
-std::array<float,2>{0.631897748f, 0.362288266f},
-std::array<float,2>{0.186297908f, 0.448675245f},
-std::array<float,2>{0.502171576f, 0.544930637f},
-std::array<float,2>{0.391392618f, 0.967660487f},
-std::array<float,2>{0.836048245f, 0.237841964f},
-std::array<float,2>{0.487865448f, 0.270827353f},
-std::array<float,2>{0.76460886f, 0.694432914f},
-std::array<float,2>{0.203090012f, 0.769164979f},
-std::array<float,2>{0.605871677f, 0.0941026807f},
-std::array<float,2>{0.100837052f, 0.171423092f},
-std::array<float,2>{0.732012212f, 0.878932714f},
-std::array<float,2>{0.295405567f, 0.578103602f},
-std::array<float,2>{0.981331646f, 0.387454778f},
-std::array<float,2>{0.435740143f, 0.203197166f},
-std::array<float,2>{0.866882741f, 0.997610629f},
-std::array<float,2>{0.127685919f, 0.519504607f},
-std::array<float,2>{0.55910331f, 0.482569784f},
-std::array<float,2>{0.0160491336f, 0.342177033f},
-std::array<float,2>{0.662338734f, 0.675720751f},
-std::array<float,2>{0.340776503f, 0.852314889f},
-std::array<float,2>{0.931028724f, 0.0109222997f},
-std::array<float,2>{0.253157407f, 0.413941145f},
-std::array<float,2>{0.944411755f, 0.613570809f},
-std::array<float,2>{0.076933682f, 0.934781611f},
-std::array<float,2>{0.68814981f, 0.155710742f},
-std::array<float,2>{0.225667417f, 0.0645807609f},
-std::array<float,2>{0.564654768f, 0.808155239f},
-std::array<float,2>{0.454606056f, 0.731714427f},
-std::array<float,2>{0.784065604f, 0.308021545f},
-std::array<float,2>{0.311994046f, 0.13871263f},
-std::array<float,2>{0.994505465f, 0.915262997f},
-std::array<float,2>{0.115283601f, 0.606840372f},
-std::array<float,2>{0.739519656f, 0.435808986f},
-std::array<float,2>{0.203264371f, 0.28514877f},
-std::array<float,2>{0.610004067f, 0.744031489f},
-std::array<float,2>{0.476092935f, 0.794768333f},
-std::array<float,2>{0.77336961f, 0.0829313174f},
-std::array<float,2>{0.38979283f, 0.488727868f},
-std::array<float,2>{0.817101002f, 0.51426065f},
-std::array<float,2>{0.165807128f, 0.969811499f},
-std::array<float,2>{0.52395767f, 0.200184613f},
-std::array<float,2>{0.0570952892f, 0.0175037012f},
-std::array<float,2>{0.645581961f, 0.867302895f},
-std::array<float,2>{0.345528781f, 0.656717777f},
-std::array<float,2>{0.876228631f, 0.326190501f},
-std::array<float,2>{0.446464688f, 0.120522484f},
-std::array<float,2>{0.800807595f, 0.752868354f},
-std::array<float,2>{0.237566248f, 0.715244412f},
-std::array<float,2>{0.585624039f, 0.257678986f},
-std::array<float,2>{0.078507401f, 0.3994973f},
-std::array<float,2>{0.709292769f, 0.580058753f},
-std::array<float,2>{0.272550076f, 0.89606595f},
-std::array<float,2>{0.955733597f, 0.179608241f},
-std::array<float,2>{0.325235486f, 0.357280463f},
-std::array<float,2>{0.920477629f, 0.635082543f},
-std::array<float,2>{0.0122159505f, 0.833660543f},
-std::array<float,2>{0.678592622f, 0.0513539128f},
-std::array<float,2>{0.153048038f, 0.229419753f},
-std::array<float,2>{0.531606495f, 0.95300281f},
-std::array<float,2>{0.414608151f, 0.554975569f},
-std::array<float,2>{0.849591374f, 0.463119447f},
-std::array<float,2>{0.312823325f, 0.098994799f},
-std::array<float,2>{0.906261563f, 0.773218334f},
-std::array<float,2>{0.0072280122f, 0.689950287f},
-std::array<float,2>{0.684243381f, 0.266145289f},
-std::array<float,2>{0.141071901f, 0.386449635f},
-std::array<float,2>{0.541192114f, 0.571214676f},
-std::array<float,2>{0.413170099f, 0.875399292f},
-std::array<float,2>{0.853045642f, 0.165839911f},
-std::array<float,2>{0.438540012f, 0.363681078f},
-std::array<float,2>{0.804800749f, 0.648666918f},
-std::array<float,2>{0.247840375f, 0.827712595f},
-std::array<float,2>{0.590674043f, 0.0405871086f},
-std::array<float,2>{0.0915990695f, 0.239101514f},
-std::array<float,2>{0.717900813f, 0.961951792f},
-std::array<float,2>{0.277315527f, 0.542744875f},
-std::array<float,2>{0.966542959f, 0.450076491f},
-std::array<float,2>{0.381246507f, 0.150322944f},
-std::array<float,2>{0.824942887f, 0.93036747f},
-std::array<float,2>{0.15896906f, 0.611747801f},
-std::array<float,2>{0.522092164f, 0.406626195f},
-std::array<float,2>{0.0536712483f, 0.31049642f},
-std::array<float,2>{0.653439283f, 0.726678252f},
-std::array<float,2>{0.353992999f, 0.809525788f},
-std::array<float,2>{0.890168607f, 0.0675923005f},
-std::array<float,2>{0.30122599f, 0.479448199f},
-std::array<float,2>{0.986012399f, 0.520645082f},
-std::array<float,2>{0.123871312f, 0.995762885f},
-std::array<float,2>{0.74512583f, 0.21045728f},
-std::array<float,2>{0.215278924f, 0.0139451232f},
-std::array<float,2>{0.618671238f, 0.858074307f},
-std::array<float,2>{0.478040189f, 0.676761746f},
-std::array<float,2>{0.780403793f, 0.339442194f},
-std::array<float,2>{0.264459789f, 0.196428671f},
-std::array<float,2>{0.950553238f, 0.973816156f},
-std::array<float,2>{0.0670891479f, 0.510156751f},
-std::array<float,2>{0.701106489f, 0.485636503f},
-std::array<float,2>{0.234061077f, 0.322024226f},
-std::array<float,2>{0.572035074f, 0.662565351f},
-std::array<float,2>{0.465365887f, 0.872598112f},
-std::array<float,2>{0.796563089f, 0.0229486693f},
-std::array<float,2>{0.426170439f, 0.432611495f},
-std::array<float,2>{0.873727441f, 0.603492498f},
-std::array<float,2>{0.138634235f, 0.919084191f},
-std::array<float,2>{0.549107909f, 0.133715898f},
-std::array<float,2>{0.024158949f, 0.0819694847f},
-std::array<float,2>{0.664232254f, 0.79123652f},
-std::array<float,2>{0.33367452f, 0.749743879f},
-std::array<float,2>{0.929359198f, 0.288557708f},
-std::array<float,2>{0.499239266f, 0.0505455397f},
-std::array<float,2>{0.755737543f, 0.828125834f},
-std::array<float,2>{0.192197323f, 0.640095353f},
-std::array<float,2>{0.597243786f, 0.351992488f},
-std::array<float,2>{0.102310196f, 0.46551165f},
-std::array<float,2>{0.720727146f, 0.561228037f},
-std::array<float,2>{0.286336958f, 0.946049511f},
-std::array<float,2>{0.975926995f, 0.231629103f},
-std::array<float,2>{0.367631435f, 0.253147155f},
-std::array<float,2>{0.896105111f, 0.713552415f},
-std::array<float,2>{0.0427566245f, 0.757721782f},
-std::array<float,2>{0.63507098f, 0.124724127f},
-std::array<float,2>{0.179534405f, 0.17358613f},
-std::array<float,2>{0.51302439f, 0.892349005f},
-std::array<float,2>{0.398838699f, 0.582367122f},
-std::array<float,2>{0.831991792f, 0.40293175f},
-std::array<float,2>{0.289134115f, 0.0286087841f},
-std::array<float,2>{0.978191137f, 0.86325413f},
-std::array<float,2>{0.0974453613f, 0.665572822f},
-std::array<float,2>{0.726617038f, 0.315990657f},
-std::array<float,2>{0.19537963f, 0.495707154f},
-std::array<float,2>{0.603015542f, 0.506717145f},
-std::array<float,2>{0.492178321f, 0.977324426f},
-std::array<float,2>{0.75900799f, 0.190117612f},
-std::array<float,2>{0.395067871f, 0.294524372f},
-std::array<float,2>{0.842761517f, 0.740918815f},
-std::array<float,2>{0.182392433f, 0.783824503f},
-std::array<float,2>{0.50517869f, 0.0885996893f},
-std::array<float,2>{0.0354727246f, 0.132293165f},
-std::array<float,2>{0.626258254f, 0.909016252f},
-std::array<float,2>{0.365111798f, 0.594579875f},
-std::array<float,2>{0.903430283f, 0.429185599f},
-std::array<float,2>{0.458807319f, 0.223430574f},
-std::array<float,2>{0.787287354f, 0.940626502f},
-std::array<float,2>{0.22108376f, 0.548383117f},
-std::array<float,2>{0.566794336f, 0.456856042f},
-std::array<float,2>{0.0715759173f, 0.344665557f},
-std::array<float,2>{0.692989171f, 0.630253494f},
-std::array<float,2>{0.255551875f, 0.838186622f},
-std::array<float,2>{0.938400269f, 0.0593643002f},
-std::array<float,2>{0.336852908f, 0.395634532f},
-std::array<float,2>{0.934181631f, 0.590348423f},
-std::array<float,2>{0.0206816494f, 0.899566829f},
-std::array<float,2>{0.656990886f, 0.180587113f},
-std::array<float,2>{0.129228771f, 0.111915872f},
-std::array<float,2>{0.557201564f, 0.765557766f},
-std::array<float,2>{0.429767251f, 0.703795254f},
-std::array<float,2>{0.859466851f, 0.258672208f},
-std::array<float,2>{0.349544078f, 0.163705692f},
-std::array<float,2>{0.881965697f, 0.886569977f},
-std::array<float,2>{0.0592272654f, 0.56427598f},
-std::array<float,2>{0.642463386f, 0.38180998f},
-std::array<float,2>{0.171863437f, 0.280385643f},
-std::array<float,2>{0.527400911f, 0.69987303f},
-std::array<float,2>{0.385650009f, 0.776250601f},
-std::array<float,2>{0.81521374f, 0.103912555f},
-std::array<float,2>{0.471304268f, 0.439674437f},
-std::array<float,2>{0.767768025f, 0.537516057f},
-std::array<float,2>{0.210038647f, 0.953365982f},
-std::array<float,2>{0.616728961f, 0.243282691f},
-std::array<float,2>{0.109541036f, 0.0325236097f},
-std::array<float,2>{0.73710686f, 0.820082903f},
-std::array<float,2>{0.306674808f, 0.643209398f},
-std::array<float,2>{0.99674511f, 0.371858239f},
-std::array<float,2>{0.418984413f, 0.0767529383f},
-std::array<float,2>{0.845886707f, 0.801277936f},
-std::array<float,2>{0.15156503f, 0.723076344f},
-std::array<float,2>{0.53567028f, 0.301140308f},
-std::array<float,2>{0.00969348475f, 0.417552739f},
-std::array<float,2>{0.675027728f, 0.623331904f},
-std::array<float,2>{0.322024405f, 0.926023126f},
-std::array<float,2>{0.914087236f, 0.144674391f},
-std::array<float,2>{0.267287493f, 0.331115276f},
-std::array<float,2>{0.957768619f, 0.682598591f},
-std::array<float,2>{0.0836675018f, 0.848638713f},
-std::array<float,2>{0.703495204f, 0.00164341449f},
-std::array<float,2>{0.241245449f, 0.213551939f},
-std::array<float,2>{0.579408824f, 0.99059397f},
-std::array<float,2>{0.450738907f, 0.529476345f},
-std::array<float,2>{0.798808038f, 0.473256648f},
-std::array<float,2>{0.259042919f, 0.10873545f},
-std::array<float,2>{0.946090519f, 0.777351379f},
-std::array<float,2>{0.0632534847f, 0.699071527f},
-std::array<float,2>{0.696407735f, 0.277224153f},
-std::array<float,2>{0.229198664f, 0.378517419f},
-std::array<float,2>{0.57608515f, 0.570120871f},
-std::array<float,2>{0.463831335f, 0.890119433f},
-std::array<float,2>{0.790748477f, 0.159072772f},
-std::array<float,2>{0.422538102f, 0.370263129f},
-std::array<float,2>{0.868714154f, 0.646451652f},
-std::array<float,2>{0.135623142f, 0.814298213f},
-std::array<float,2>{0.552697301f, 0.0368760414f},
-std::array<float,2>{0.0303582307f, 0.246617123f},
-std::array<float,2>{0.669673741f, 0.960354447f},
-std::array<float,2>{0.331054807f, 0.532954931f},
-std::array<float,2>{0.924162149f, 0.443454325f},
-std::array<float,2>{0.493176997f, 0.142311215f},
-std::array<float,2>{0.753230155f, 0.923812211f},
-std::array<float,2>{0.188092127f, 0.617456198f},
-std::array<float,2>{0.59847641f, 0.420359999f},
-std::array<float,2>{0.106456339f, 0.300580651f},
-std::array<float,2>{0.722955167f, 0.721798897f},
-std::array<float,2>{0.284554392f, 0.798190773f},
-std::array<float,2>{0.970141351f, 0.0740815625f},
-std::array<float,2>{0.371217281f, 0.469151646f},
-std::array<float,2>{0.891338229f, 0.526196718f},
-std::array<float,2>{0.0455125272f, 0.987993658f},
-std::array<float,2>{0.637289107f, 0.21621336f},
-std::array<float,2>{0.175043672f, 0.00547912344f},
-std::array<float,2>{0.50830996f, 0.846120477f},
-std::array<float,2>{0.403712302f, 0.687340021f},
-std::array<float,2>{0.835562944f, 0.333448976f},
-std::array<float,2>{0.319221973f, 0.194462001f},
-std::array<float,2>{0.910533488f, 0.982894659f},
-std::array<float,2>{0.00324110081f, 0.500039518f},
-std::array<float,2>{0.682012022f, 0.497346312f},
-std::array<float,2>{0.147316396f, 0.31978327f},
-std::array<float,2>{0.543168664f, 0.670404613f},
-std::array<float,2>{0.407717913f, 0.866398215f},
-std::array<float,2>{0.858629048f, 0.0260598101f},
-std::array<float,2>{0.445269614f, 0.42392391f},
-std::array<float,2>{0.811193585f, 0.60081315f},
-std::array<float,2>{0.24394916f, 0.910569668f},
-std::array<float,2>{0.588509679f, 0.125355721f},
-std::array<float,2>{0.0896740407f, 0.0932159722f},
-std::array<float,2>{0.711373746f, 0.788854599f},
-std::array<float,2>{0.278530866f, 0.736865997f},
-std::array<float,2>{0.961825669f, 0.290934473f},
-std::array<float,2>{0.376087964f, 0.0580774583f},
-std::array<float,2>{0.820356429f, 0.841372848f},
-std::array<float,2>{0.162669927f, 0.627811313f},
-std::array<float,2>{0.516119421f, 0.350896835f},
-std::array<float,2>{0.0505605601f, 0.459711254f},
-std::array<float,2>{0.649156392f, 0.552459478f},
-std::array<float,2>{0.357125163f, 0.943631887f},
-std::array<float,2>{0.88367635f, 0.220765427f},
-std::array<float,2>{0.296928167f, 0.262611836f},
-std::array<float,2>{0.989426494f, 0.707406759f},
-std::array<float,2>{0.119956933f, 0.760608435f},
-std::array<float,2>{0.749662459f, 0.115711048f},
-std::array<float,2>{0.214602232f, 0.187052459f},
-std::array<float,2>{0.624720752f, 0.904082f},
-std::array<float,2>{0.482409775f, 0.587507606f},
-std::array<float,2>{0.77619642f, 0.392665923f},
-std::array<float,2>{0.344081759f, 0.0185072031f},
-std::array<float,2>{0.87538588f, 0.869191945f},
-std::array<float,2>{0.0579827465f, 0.659466922f},
-std::array<float,2>{0.644552946f, 0.326004148f},
-std::array<float,2>{0.164681897f, 0.491032988f},
-std::array<float,2>{0.524719894f, 0.513026297f},
-std::array<float,2>{0.389172882f, 0.971044958f},
-std::array<float,2>{0.817493975f, 0.202717707f},
-std::array<float,2>{0.475262135f, 0.283023357f},
-std::array<float,2>{0.771554649f, 0.744847238f},
-std::array<float,2>{0.2041713f, 0.796800792f},
-std::array<float,2>{0.611271083f, 0.0846526697f},
-std::array<float,2>{0.116820514f, 0.137752146f},
-std::array<float,2>{0.738316953f, 0.91640532f},
-std::array<float,2>{0.310738087f, 0.608670235f},
-std::array<float,2>{0.995538771f, 0.435291171f},
-std::array<float,2>{0.415670156f, 0.228314549f},
-std::array<float,2>{0.847953916f, 0.950632989f},
-std::array<float,2>{0.153570712f, 0.556696236f},
-std::array<float,2>{0.532274425f, 0.460941404f},
-std::array<float,2>{0.0127609847f, 0.357425421f},
-std::array<float,2>{0.679181397f, 0.632934213f},
-std::array<float,2>{0.325057298f, 0.835822284f},
-std::array<float,2>{0.920942664f, 0.0531667098f},
-std::array<float,2>{0.27171734f, 0.401958436f},
-std::array<float,2>{0.956604004f, 0.580852926f},
-std::array<float,2>{0.0799473673f, 0.897259235f},
-std::array<float,2>{0.710729778f, 0.176156715f},
-std::array<float,2>{0.236813992f, 0.118000031f},
-std::array<float,2>{0.584615469f, 0.751250744f},
-std::array<float,2>{0.445867389f, 0.718695581f},
-std::array<float,2>{0.802364826f, 0.255668014f},
-std::array<float,2>{0.296255201f, 0.16926083f},
-std::array<float,2>{0.982210815f, 0.880903125f},
-std::array<float,2>{0.099752523f, 0.575272679f},
-std::array<float,2>{0.730838358f, 0.388746053f},
-std::array<float,2>{0.20124203f, 0.271580637f},
-std::array<float,2>{0.606939077f, 0.692324519f},
-std::array<float,2>{0.48655805f, 0.766379952f},
-std::array<float,2>{0.765001893f, 0.0962676331f},
-std::array<float,2>{0.391772151f, 0.44688791f},
-std::array<float,2>{0.837160468f, 0.544011474f},
-std::array<float,2>{0.18737933f, 0.965718985f},
-std::array<float,2>{0.503237426f, 0.236196265f},
-std::array<float,2>{0.0328022875f, 0.0430320837f},
-std::array<float,2>{0.631274819f, 0.82106328f},
-std::array<float,2>{0.360172421f, 0.6561988f},
-std::array<float,2>{0.899109662f, 0.360259295f},
-std::array<float,2>{0.453966767f, 0.0632636547f},
-std::array<float,2>{0.784306884f, 0.805559099f},
-std::array<float,2>{0.225242838f, 0.732835293f},
-std::array<float,2>{0.56581074f, 0.306117982f},
-std::array<float,2>{0.0771875083f, 0.411446244f},
-std::array<float,2>{0.688966691f, 0.615996838f},
-std::array<float,2>{0.25280109f, 0.935874701f},
-std::array<float,2>{0.943842828f, 0.152611434f},
-std::array<float,2>{0.341509938f, 0.340564102f},
-std::array<float,2>{0.929962516f, 0.672223032f},
-std::array<float,2>{0.0172552839f, 0.854656041f},
-std::array<float,2>{0.663896561f, 0.00823772233f},
-std::array<float,2>{0.128218263f, 0.206395403f},
-std::array<float,2>{0.559937179f, 0.998811901f},
-std::array<float,2>{0.437419355f, 0.517472565f},
-std::array<float,2>{0.865675628f, 0.48069784f},
-std::array<float,2>{0.332511187f, 0.078978233f},
-std::array<float,2>{0.928186238f, 0.789251149f},
-std::array<float,2>{0.0247813053f, 0.747407675f},
-std::array<float,2>{0.665485203f, 0.286433756f},
-std::array<float,2>{0.136864617f, 0.43044287f},
-std::array<float,2>{0.550438106f, 0.604462147f},
-std::array<float,2>{0.426874489f, 0.920797408f},
-std::array<float,2>{0.874909937f, 0.136396214f},
-std::array<float,2>{0.465883374f, 0.323871315f},
-std::array<float,2>{0.795806468f, 0.662040234f},
-std::array<float,2>{0.232791498f, 0.874815404f},
-std::array<float,2>{0.570749521f, 0.0211918168f},
-std::array<float,2>{0.0679702982f, 0.198016867f},
-std::array<float,2>{0.699811757f, 0.975191057f},
-std::array<float,2>{0.264800072f, 0.508179545f},
-std::array<float,2>{0.949595511f, 0.486945242f},
-std::array<float,2>{0.399860442f, 0.175330386f},
-std::array<float,2>{0.830737531f, 0.892587721f},
-std::array<float,2>{0.178228155f, 0.584570587f},
-std::array<float,2>{0.512362361f, 0.405558586f},
-std::array<float,2>{0.041825626f, 0.251741916f},
-std::array<float,2>{0.63591516f, 0.712584913f},
-std::array<float,2>{0.368892223f, 0.75583607f},
-std::array<float,2>{0.894550383f, 0.121397272f},
-std::array<float,2>{0.285380691f, 0.467961103f},
-std::array<float,2>{0.974863231f, 0.560462594f},
-std::array<float,2>{0.103380792f, 0.948056579f},
-std::array<float,2>{0.72186321f, 0.23322846f},
-std::array<float,2>{0.192630574f, 0.0483192205f},
-std::array<float,2>{0.596026957f, 0.831944287f},
-std::array<float,2>{0.498429209f, 0.638063669f},
-std::array<float,2>{0.754010916f, 0.353766024f},
-std::array<float,2>{0.275928348f, 0.241521001f},
-std::array<float,2>{0.965790749f, 0.963983357f},
-std::array<float,2>{0.0902102888f, 0.541008234f},
-std::array<float,2>{0.717248797f, 0.451272041f},
-std::array<float,2>{0.246310875f, 0.36586681f},
-std::array<float,2>{0.590971231f, 0.651811182f},
-std::array<float,2>{0.438120276f, 0.825834751f},
-std::array<float,2>{0.806544602f, 0.0416679233f},
-std::array<float,2>{0.412522674f, 0.384285837f},
-std::array<float,2>{0.851829171f, 0.573075712f},
-std::array<float,2>{0.14205505f, 0.878375351f},
-std::array<float,2>{0.542455554f, 0.166128442f},
-std::array<float,2>{0.00674213935f, 0.0997518525f},
-std::array<float,2>{0.685245395f, 0.770325661f},
-std::array<float,2>{0.31349948f, 0.688005984f},
-std::array<float,2>{0.90776211f, 0.268354475f},
-std::array<float,2>{0.477259219f, 0.0129940007f},
-std::array<float,2>{0.77994591f, 0.857099712f},
-std::array<float,2>{0.215974942f, 0.678945601f},
-std::array<float,2>{0.617996871f, 0.336582601f},
-std::array<float,2>{0.124545194f, 0.477157056f},
-std::array<float,2>{0.74425602f, 0.522334635f},
-std::array<float,2>{0.302498043f, 0.993857861f},
-std::array<float,2>{0.984772086f, 0.208192125f},
-std::array<float,2>{0.355135113f, 0.31231311f},
-std::array<float,2>{0.889300704f, 0.729525387f},
-std::array<float,2>{0.0540378764f, 0.811808944f},
-std::array<float,2>{0.652568638f, 0.0695680156f},
-std::array<float,2>{0.159607783f, 0.152038887f},
-std::array<float,2>{0.523107469f, 0.933064163f},
-std::array<float,2>{0.382491976f, 0.609904885f},
-std::array<float,2>{0.825546205f, 0.40894568f},
-std::array<float,2>{0.307787389f, 0.0342890508f},
-std::array<float,2>{0.997398794f, 0.817947745f},
-std::array<float,2>{0.111166194f, 0.640674055f},
-std::array<float,2>{0.738204896f, 0.374883622f},
-std::array<float,2>{0.209587157f, 0.437619895f},
-std::array<float,2>{0.615713716f, 0.536129832f},
-std::array<float,2>{0.472634852f, 0.955704033f},
-std::array<float,2>{0.768850863f, 0.244629428f},
-std::array<float,2>{0.386537135f, 0.278313756f},
-std::array<float,2>{0.815523922f, 0.702774227f},
-std::array<float,2>{0.170822576f, 0.774489045f},
-std::array<float,2>{0.528459013f, 0.102738313f},
-std::array<float,2>{0.0596198961f, 0.160255939f},
-std::array<float,2>{0.640771985f, 0.883145511f},
-std::array<float,2>{0.348399401f, 0.565065563f},
-std::array<float,2>{0.881204367f, 0.379191041f},
-std::array<float,2>{0.450140178f, 0.211974367f},
-std::array<float,2>{0.797558069f, 0.988613486f},
-std::array<float,2>{0.240649298f, 0.527424276f},
-std::array<float,2>{0.578339279f, 0.475058883f},
-std::array<float,2>{0.0824458003f, 0.328878582f},
-std::array<float,2>{0.704771936f, 0.680105388f},
-std::array<float,2>{0.266270816f, 0.850682318f},
-std::array<float,2>{0.95819658f, 0.00222826446f},
-std::array<float,2>{0.320588708f, 0.415123641f},
-std::array<float,2>{0.91546005f, 0.62146765f},
-std::array<float,2>{0.00816430524f, 0.92949599f},
-std::array<float,2>{0.67459178f, 0.147250548f},
-std::array<float,2>{0.15065977f, 0.0742516518f},
-std::array<float,2>{0.536851108f, 0.804337502f},
-std::array<float,2>{0.418491483f, 0.724634886f},
-std::array<float,2>{0.847136676f, 0.304181933f},
-std::array<float,2>{0.363419622f, 0.129759908f},
-std::array<float,2>{0.902524114f, 0.907715619f},
-std::array<float,2>{0.0369230062f, 0.597410917f},
-std::array<float,2>{0.625469625f, 0.426023245f},
-std::array<float,2>{0.18300125f, 0.295750231f},
-std::array<float,2>{0.503970802f, 0.739429295f},
-std::array<float,2>{0.396018177f, 0.781386554f},
-std::array<float,2>{0.843534291f, 0.0860345066f},
-std::array<float,2>{0.491013855f, 0.492297381f},
-std::array<float,2>{0.758057594f, 0.505149662f},
-std::array<float,2>{0.196303546f, 0.978740096f},
-std::array<float,2>{0.60228622f, 0.187505215f},
-std::array<float,2>{0.0964529887f, 0.02939591f},
-std::array<float,2>{0.728129208f, 0.860491872f},
-std::array<float,2>{0.290332019f, 0.66629988f},
-std::array<float,2>{0.977330089f, 0.313785404f},
-std::array<float,2>{0.431079119f, 0.110951871f},
-std::array<float,2>{0.860860109f, 0.763438702f},
-std::array<float,2>{0.130054355f, 0.706703603f},
-std::array<float,2>{0.558557332f, 0.260986239f},
-std::array<float,2>{0.0200247783f, 0.396799475f},
-std::array<float,2>{0.657572508f, 0.593176663f},
-std::array<float,2>{0.337445229f, 0.900622427f},
-std::array<float,2>{0.935475945f, 0.182181358f},
-std::array<float,2>{0.254199535f, 0.345844418f},
-std::array<float,2>{0.938746274f, 0.631957948f},
-std::array<float,2>{0.0706806704f, 0.837553322f},
-std::array<float,2>{0.691430867f, 0.0620720871f},
-std::array<float,2>{0.22199434f, 0.224887744f},
-std::array<float,2>{0.567948461f, 0.938648641f},
-std::array<float,2>{0.457431793f, 0.550069869f},
-std::array<float,2>{0.788900197f, 0.45465681f},
-std::array<float,2>{0.282439828f, 0.0708486065f},
-std::array<float,2>{0.971541703f, 0.798933685f},
-std::array<float,2>{0.108574152f, 0.720258117f},
-std::array<float,2>{0.726350665f, 0.298150003f},
-std::array<float,2>{0.189897954f, 0.418751866f},
-std::array<float,2>{0.599896133f, 0.620085657f},
-std::array<float,2>{0.495282173f, 0.924404383f},
-std::array<float,2>{0.751642764f, 0.143547058f},
-std::array<float,2>{0.405109525f, 0.335075051f},
-std::array<float,2>{0.833356857f, 0.684157073f},
-std::array<float,2>{0.172001988f, 0.844829202f},
-std::array<float,2>{0.509955764f, 0.00745600136f},
-std::array<float,2>{0.0431386158f, 0.217775479f},
-std::array<float,2>{0.63907969f, 0.986259818f},
-std::array<float,2>{0.373952299f, 0.524263322f},
-std::array<float,2>{0.893229783f, 0.472626269f},
-std::array<float,2>{0.462238938f, 0.15692246f},
-std::array<float,2>{0.791147947f, 0.887636125f},
-std::array<float,2>{0.22799322f, 0.566933393f},
-std::array<float,2>{0.576498151f, 0.375661016f},
-std::array<float,2>{0.0645719469f, 0.274795085f},
-std::array<float,2>{0.698319376f, 0.696136057f},
-std::array<float,2>{0.26165235f, 0.779969096f},
-std::array<float,2>{0.948781669f, 0.106676534f},
-std::array<float,2>{0.328895301f, 0.442556381f},
-std::array<float,2>{0.923386633f, 0.534517229f},
-std::array<float,2>{0.0289895162f, 0.957608283f},
-std::array<float,2>{0.671164453f, 0.248638093f},
-std::array<float,2>{0.134442195f, 0.0385877341f},
-std::array<float,2>{0.552924514f, 0.815420568f},
-std::array<float,2>{0.424709737f, 0.647570848f},
-std::array<float,2>{0.8708992f, 0.368311226f},
-std::array<float,2>{0.357847512f, 0.218899682f},
-std::array<float,2>{0.886294782f, 0.942882597f},
-std::array<float,2>{0.0476976484f, 0.554430187f},
-std::array<float,2>{0.65114218f, 0.458671451f},
-std::array<float,2>{0.161975011f, 0.349127501f},
-std::array<float,2>{0.517878711f, 0.625103831f},
-std::array<float,2>{0.378897399f, 0.843158603f},
-std::array<float,2>{0.824195802f, 0.055470109f},
-std::array<float,2>{0.483340263f, 0.392457634f},
-std::array<float,2>{0.775008976f, 0.588729739f},
-std::array<float,2>{0.212581247f, 0.905990601f},
-std::array<float,2>{0.62146759f, 0.185003221f},
-std::array<float,2>{0.117456391f, 0.113516048f},
-std::array<float,2>{0.746477425f, 0.759131491f},
-std::array<float,2>{0.299125791f, 0.709897101f},
-std::array<float,2>{0.990621448f, 0.264011651f},
-std::array<float,2>{0.408434927f, 0.0248329174f},
-std::array<float,2>{0.856989145f, 0.863797247f},
-std::array<float,2>{0.145214468f, 0.66933161f},
-std::array<float,2>{0.545809865f, 0.317734718f},
-std::array<float,2>{0.000957040524f, 0.498961002f},
-std::array<float,2>{0.680571973f, 0.502218723f},
-std::array<float,2>{0.318163335f, 0.980760455f},
-std::array<float,2>{0.912234247f, 0.191506222f},
-std::array<float,2>{0.280736208f, 0.29209885f},
-std::array<float,2>{0.96370405f, 0.735732496f},
-std::array<float,2>{0.0868534595f, 0.785818398f},
-std::array<float,2>{0.713592589f, 0.0907294154f},
-std::array<float,2>{0.244551331f, 0.128736287f},
-std::array<float,2>{0.586844802f, 0.913432956f},
-std::array<float,2>{0.442170352f, 0.598747075f},
-std::array<float,2>{0.809668958f, 0.422644079f},
-std::array<float,2>{0.327032417f, 0.0517665967f},
-std::array<float,2>{0.919618487f, 0.832543254f},
-std::array<float,2>{0.01377327f, 0.636545897f},
-std::array<float,2>{0.677085519f, 0.355583429f},
-std::array<float,2>{0.155856714f, 0.463886648f},
-std::array<float,2>{0.533592939f, 0.556252778f},
-std::array<float,2>{0.416739285f, 0.951563716f},
-std::array<float,2>{0.851262748f, 0.230307758f},
-std::array<float,2>{0.44827503f, 0.256514907f},
-std::array<float,2>{0.803817451f, 0.716481447f},
-std::array<float,2>{0.23460491f, 0.7533077f},
-std::array<float,2>{0.5837906f, 0.119503304f},
-std::array<float,2>{0.0800911263f, 0.178241789f},
-std::array<float,2>{0.708665848f, 0.894532382f},
-std::array<float,2>{0.269698322f, 0.578782678f},
-std::array<float,2>{0.954169393f, 0.398592651f},
-std::array<float,2>{0.388455361f, 0.200847521f},
-std::array<float,2>{0.819137275f, 0.969067931f},
-std::array<float,2>{0.167522356f, 0.515459955f},
-std::array<float,2>{0.525865614f, 0.489505649f},
-std::array<float,2>{0.0554628707f, 0.32803908f},
-std::array<float,2>{0.647852898f, 0.657632351f},
-std::array<float,2>{0.345789254f, 0.868946016f},
-std::array<float,2>{0.878331959f, 0.015679542f},
-std::array<float,2>{0.310027957f, 0.436737686f},
-std::array<float,2>{0.992262423f, 0.606410146f},
-std::array<float,2>{0.114881426f, 0.914231956f},
-std::array<float,2>{0.740584433f, 0.140402973f},
-std::array<float,2>{0.20530352f, 0.0836797953f},
-std::array<float,2>{0.61167711f, 0.793381393f},
-std::array<float,2>{0.474279165f, 0.743065894f},
-std::array<float,2>{0.771306098f, 0.283627689f},
-std::array<float,2>{0.250188679f, 0.154875383f},
-std::array<float,2>{0.943157852f, 0.934511125f},
-std::array<float,2>{0.0746907517f, 0.614356041f},
-std::array<float,2>{0.690415859f, 0.413032889f},
-std::array<float,2>{0.224294752f, 0.307542205f},
-std::array<float,2>{0.564195573f, 0.730603933f},
-std::array<float,2>{0.455560565f, 0.806813359f},
-std::array<float,2>{0.781370223f, 0.0662530065f},
-std::array<float,2>{0.434751868f, 0.483838558f},
-std::array<float,2>{0.864180684f, 0.517880976f},
-std::array<float,2>{0.126938134f, 0.996141553f},
-std::array<float,2>{0.560810328f, 0.204649732f},
-std::array<float,2>{0.0192553215f, 0.00976939313f},
-std::array<float,2>{0.662015617f, 0.853400588f},
-std::array<float,2>{0.343661577f, 0.673949957f},
-std::array<float,2>{0.931788683f, 0.343517572f},
-std::array<float,2>{0.486274511f, 0.0950061008f},
-std::array<float,2>{0.76230669f, 0.768465817f},
-std::array<float,2>{0.200910136f, 0.693909407f},
-std::array<float,2>{0.608149588f, 0.270441383f},
-std::array<float,2>{0.0994260758f, 0.388049781f},
-std::array<float,2>{0.7343297f, 0.576256156f},
-std::array<float,2>{0.294477969f, 0.880826592f},
-std::array<float,2>{0.984080911f, 0.170273229f},
-std::array<float,2>{0.363226831f, 0.363091677f},
-std::array<float,2>{0.901384234f, 0.652437449f},
-std::array<float,2>{0.0344101377f, 0.823011279f},
-std::array<float,2>{0.630119979f, 0.0457763895f},
-std::array<float,2>{0.184117481f, 0.236716837f},
-std::array<float,2>{0.501725674f, 0.967997253f},
-std::array<float,2>{0.39435643f, 0.546665728f},
-std::array<float,2>{0.839744508f, 0.447574854f},
-std::array<float,2>{0.370804727f, 0.123227365f},
-std::array<float,2>{0.897899926f, 0.756767929f},
-std::array<float,2>{0.0394726731f, 0.714114547f},
-std::array<float,2>{0.633143187f, 0.252365291f},
-std::array<float,2>{0.177388042f, 0.403972f},
-std::array<float,2>{0.514875531f, 0.583037913f},
-std::array<float,2>{0.400494367f, 0.890988946f},
-std::array<float,2>{0.828155875f, 0.172362477f},
-std::array<float,2>{0.496144474f, 0.352945894f},
-std::array<float,2>{0.757369101f, 0.63964659f},
-std::array<float,2>{0.193954825f, 0.829870582f},
-std::array<float,2>{0.594292164f, 0.049292013f},
-std::array<float,2>{0.103598781f, 0.231052786f},
-std::array<float,2>{0.720004737f, 0.94630146f},
-std::array<float,2>{0.287564456f, 0.562458336f},
-std::array<float,2>{0.973665059f, 0.466346115f},
-std::array<float,2>{0.428973436f, 0.134682521f},
-std::array<float,2>{0.872601271f, 0.91870749f},
-std::array<float,2>{0.139063537f, 0.601586163f},
-std::array<float,2>{0.54783231f, 0.432875812f},
-std::array<float,2>{0.0261186734f, 0.287945986f},
-std::array<float,2>{0.667119801f, 0.748777807f},
-std::array<float,2>{0.335503966f, 0.792923927f},
-std::array<float,2>{0.927432656f, 0.080504626f},
-std::array<float,2>{0.263186991f, 0.485321134f},
-std::array<float,2>{0.952160239f, 0.511287093f},
-std::array<float,2>{0.068443872f, 0.973004401f},
-std::array<float,2>{0.702258408f, 0.19586584f},
-std::array<float,2>{0.231943846f, 0.0215541292f},
-std::array<float,2>{0.572327971f, 0.871643245f},
-std::array<float,2>{0.468430549f, 0.663960457f},
-std::array<float,2>{0.793166161f, 0.321175188f},
-std::array<float,2>{0.302868962f, 0.209317476f},
-std::array<float,2>{0.98659426f, 0.994641662f},
-std::array<float,2>{0.122114986f, 0.520463169f},
-std::array<float,2>{0.743950486f, 0.47969541f},
-std::array<float,2>{0.217676029f, 0.338770211f},
-std::array<float,2>{0.619437277f, 0.675928593f},
-std::array<float,2>{0.48002708f, 0.858406544f},
-std::array<float,2>{0.778196752f, 0.0152058369f},
-std::array<float,2>{0.380809814f, 0.407517552f},
-std::array<float,2>{0.826647699f, 0.613187015f},
-std::array<float,2>{0.15798761f, 0.931419432f},
-std::array<float,2>{0.520943522f, 0.149264798f},
-std::array<float,2>{0.051793579f, 0.0664153695f},
-std::array<float,2>{0.655844212f, 0.810493708f},
-std::array<float,2>{0.351931989f, 0.728006005f},
-std::array<float,2>{0.888263583f, 0.308815449f},
-std::array<float,2>{0.440786481f, 0.0398106575f},
-std::array<float,2>{0.807793736f, 0.826613009f},
-std::array<float,2>{0.248932913f, 0.649604619f},
-std::array<float,2>{0.591836035f, 0.364720583f},
-std::array<float,2>{0.0921796635f, 0.45050016f},
-std::array<float,2>{0.716789782f, 0.541191638f},
-std::array<float,2>{0.273945332f, 0.961311519f},
-std::array<float,2>{0.967216611f, 0.239954203f},
-std::array<float,2>{0.315938592f, 0.267404914f},
-std::array<float,2>{0.909535468f, 0.690790713f},
-std::array<float,2>{0.00406901911f, 0.772181213f},
-std::array<float,2>{0.685667276f, 0.0981756374f},
-std::array<float,2>{0.144106254f, 0.164644033f},
-std::array<float,2>{0.540350676f, 0.876522899f},
-std::array<float,2>{0.410724491f, 0.571458161f},
-std::array<float,2>{0.854251444f, 0.385128856f},
-std::array<float,2>{0.269408703f, 0.000873274577f},
-std::array<float,2>{0.960802674f, 0.848218024f},
-std::array<float,2>{0.0850242004f, 0.683031917f},
-std::array<float,2>{0.705228686f, 0.330852866f},
-std::array<float,2>{0.239369154f, 0.474571466f},
-std::array<float,2>{0.580571771f, 0.531181574f},
-std::array<float,2>{0.452391237f, 0.991537213f},
-std::array<float,2>{0.79952991f, 0.214128718f},
-std::array<float,2>{0.420429081f, 0.302510321f},
-std::array<float,2>{0.84511447f, 0.723898351f},
-std::array<float,2>{0.148533523f, 0.802226901f},
-std::array<float,2>{0.538236082f, 0.0778678358f},
-std::array<float,2>{0.0109649329f, 0.145731643f},
-std::array<float,2>{0.67332232f, 0.92765373f},
-std::array<float,2>{0.322454333f, 0.62496835f},
-std::array<float,2>{0.916092336f, 0.416499138f},
-std::array<float,2>{0.470234573f, 0.243008509f},
-std::array<float,2>{0.766282976f, 0.954626143f},
-std::array<float,2>{0.208769187f, 0.538450539f},
-std::array<float,2>{0.61377579f, 0.440700233f},
-std::array<float,2>{0.11221838f, 0.372746378f},
-std::array<float,2>{0.734711587f, 0.644040525f},
-std::array<float,2>{0.306311488f, 0.818859458f},
-std::array<float,2>{0.999705195f, 0.0322095118f},
-std::array<float,2>{0.350099653f, 0.382472575f},
-std::array<float,2>{0.879311383f, 0.563124299f},
-std::array<float,2>{0.0618374385f, 0.885110795f},
-std::array<float,2>{0.643352091f, 0.16214028f},
-std::array<float,2>{0.168704763f, 0.104644865f},
-std::array<float,2>{0.530980229f, 0.776763618f},
-std::array<float,2>{0.384565473f, 0.700750351f},
-std::array<float,2>{0.813078582f, 0.279723525f},
-std::array<float,2>{0.339128762f, 0.180712163f},
-std::array<float,2>{0.937112033f, 0.899342835f},
-std::array<float,2>{0.0229029283f, 0.59122175f},
-std::array<float,2>{0.659286559f, 0.395286828f},
-std::array<float,2>{0.131061926f, 0.259463012f},
-std::array<float,2>{0.555076838f, 0.704654217f},
-std::array<float,2>{0.432241201f, 0.763802052f},
-std::array<float,2>{0.862579763f, 0.11249841f},
-std::array<float,2>{0.460721046f, 0.455963194f},
-std::array<float,2>{0.786506772f, 0.546922266f},
-std::array<float,2>{0.21938853f, 0.939478099f},
-std::array<float,2>{0.570288897f, 0.223935097f},
-std::array<float,2>{0.0737678707f, 0.0603060797f},
-std::array<float,2>{0.694218099f, 0.839082956f},
-std::array<float,2>{0.256267816f, 0.62909162f},
-std::array<float,2>{0.940037847f, 0.345074177f},
-std::array<float,2>{0.396918327f, 0.089607276f},
-std::array<float,2>{0.841261625f, 0.785015523f},
-std::array<float,2>{0.180470958f, 0.741920829f},
-std::array<float,2>{0.507484734f, 0.293532521f},
-std::array<float,2>{0.0372105613f, 0.428472787f},
-std::array<float,2>{0.628164291f, 0.595426321f},
-std::array<float,2>{0.366037428f, 0.909912527f},
-std::array<float,2>{0.905755639f, 0.131287828f},
-std::array<float,2>{0.29153198f, 0.314739913f},
-std::array<float,2>{0.978584707f, 0.664470971f},
-std::array<float,2>{0.0939304009f, 0.862297297f},
-std::array<float,2>{0.729430079f, 0.027621787f},
-std::array<float,2>{0.198658139f, 0.190446377f},
-std::array<float,2>{0.603898942f, 0.97837162f},
-std::array<float,2>{0.4886536f, 0.507587373f},
-std::array<float,2>{0.76122731f, 0.494454354f}}
\ No newline at end of file
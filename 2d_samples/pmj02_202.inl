@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.573223829f, 0.92714411f},
-std::array<float,2>{0.297883958f, 0.273006618f},
-std::array<float,2>{0.222207606f, 0.561106384f},
-std::array<float,2>{0.939388931f, 0.166143388f},
-std::array<float,2>{0.801766217f, 0.66438514f},
-std::array<float,2>{0.0125885094f, 0.0244384035f},
-std::array<float,2>{0.38763392f, 0.853786767f},
-std::array<float,2>{0.735066175f, 0.376060754f},
-std::array<float,2>{0.903559208f, 0.794005215f},
-std::array<float,2>{0.18290098f, 0.481721491f},
-std::array<float,2>{0.373289794f, 0.718396962f},
-std::array<float,2>{0.5505808f, 0.084180519f},
-std::array<float,2>{0.665936887f, 0.594527721f},
-std::array<float,2>{0.439485878f, 0.232592344f},
-std::array<float,2>{0.0771742985f, 0.978508055f},
-std::array<float,2>{0.824546158f, 0.36759463f},
-std::array<float,2>{0.712982774f, 0.843309581f},
-std::array<float,2>{0.429854512f, 0.419675678f},
-std::array<float,2>{0.0575494766f, 0.625684381f},
-std::array<float,2>{0.76054424f, 0.0467458852f},
-std::array<float,2>{0.983347297f, 0.504163504f},
-std::array<float,2>{0.205207303f, 0.154085889f},
-std::array<float,2>{0.253339171f, 0.879074275f},
-std::array<float,2>{0.60758996f, 0.286149353f},
-std::array<float,2>{0.844211459f, 0.953539729f},
-std::array<float,2>{0.0977021232f, 0.332242817f},
-std::array<float,2>{0.48759833f, 0.58855921f},
-std::array<float,2>{0.642359734f, 0.192510694f},
-std::array<float,2>{0.505382597f, 0.742549419f},
-std::array<float,2>{0.319271564f, 0.123904765f},
-std::array<float,2>{0.155682832f, 0.767536283f},
-std::array<float,2>{0.912959337f, 0.462165296f},
-std::array<float,2>{0.640098155f, 0.989870429f},
-std::array<float,2>{0.475132257f, 0.349557221f},
-std::array<float,2>{0.110691153f, 0.621998489f},
-std::array<float,2>{0.865091026f, 0.24708648f},
-std::array<float,2>{0.936734438f, 0.693128943f},
-std::array<float,2>{0.13841109f, 0.0723932832f},
-std::array<float,2>{0.34227252f, 0.81119889f},
-std::array<float,2>{0.524636209f, 0.498613447f},
-std::array<float,2>{0.779151738f, 0.868728936f},
-std::array<float,2>{0.0329610668f, 0.396974444f},
-std::array<float,2>{0.409245133f, 0.676300645f},
-std::array<float,2>{0.694233298f, 0.00203202269f},
-std::array<float,2>{0.620625913f, 0.546735823f},
-std::array<float,2>{0.278119713f, 0.181339711f},
-std::array<float,2>{0.199832305f, 0.912398577f},
-std::array<float,2>{0.984753668f, 0.265121192f},
-std::array<float,2>{0.543766499f, 0.764467239f},
-std::array<float,2>{0.357980937f, 0.437672675f},
-std::array<float,2>{0.161094233f, 0.733090937f},
-std::array<float,2>{0.88765049f, 0.101200126f},
-std::array<float,2>{0.839503288f, 0.571019828f},
-std::array<float,2>{0.0852414444f, 0.217508852f},
-std::array<float,2>{0.462087303f, 0.939052701f},
-std::array<float,2>{0.67454946f, 0.316020101f},
-std::array<float,2>{0.961874664f, 0.892100036f},
-std::array<float,2>{0.238480508f, 0.310809523f},
-std::array<float,2>{0.288258731f, 0.529641688f},
-std::array<float,2>{0.584428966f, 0.127944395f},
-std::array<float,2>{0.730256677f, 0.64159745f},
-std::array<float,2>{0.405227751f, 0.0507127605f},
-std::array<float,2>{0.0173459537f, 0.826248646f},
-std::array<float,2>{0.784140468f, 0.425392777f},
-std::array<float,2>{0.516265035f, 0.95078814f},
-std::array<float,2>{0.335150361f, 0.324463367f},
-std::array<float,2>{0.132776603f, 0.562687933f},
-std::array<float,2>{0.928877831f, 0.20758687f},
-std::array<float,2>{0.867943287f, 0.725441754f},
-std::array<float,2>{0.122345082f, 0.106233478f},
-std::array<float,2>{0.481832445f, 0.75429213f},
-std::array<float,2>{0.631743312f, 0.45123592f},
-std::array<float,2>{0.998719335f, 0.812737226f},
-std::array<float,2>{0.192352697f, 0.431613773f},
-std::array<float,2>{0.266449779f, 0.652790666f},
-std::array<float,2>{0.612722516f, 0.0574831665f},
-std::array<float,2>{0.698503196f, 0.519825935f},
-std::array<float,2>{0.419069707f, 0.138920546f},
-std::array<float,2>{0.0417133085f, 0.902575433f},
-std::array<float,2>{0.771256685f, 0.30252856f},
-std::array<float,2>{0.6800946f, 0.802301407f},
-std::array<float,2>{0.458352894f, 0.487437338f},
-std::array<float,2>{0.0905160904f, 0.701605678f},
-std::array<float,2>{0.828508496f, 0.0694873482f},
-std::array<float,2>{0.88264823f, 0.614571869f},
-std::array<float,2>{0.16823855f, 0.236706927f},
-std::array<float,2>{0.349686891f, 0.995651841f},
-std::array<float,2>{0.536956429f, 0.357363492f},
-std::array<float,2>{0.793610096f, 0.919713497f},
-std::array<float,2>{0.0277198069f, 0.257343978f},
-std::array<float,2>{0.392543435f, 0.534806252f},
-std::array<float,2>{0.723033071f, 0.17380935f},
-std::array<float,2>{0.588915944f, 0.684723854f},
-std::array<float,2>{0.290073752f, 0.0101123983f},
-std::array<float,2>{0.242974266f, 0.8612746f},
-std::array<float,2>{0.95862478f, 0.404572994f},
-std::array<float,2>{0.7422508f, 0.884873331f},
-std::array<float,2>{0.377165675f, 0.296364248f},
-std::array<float,2>{0.00529105728f, 0.513567269f},
-std::array<float,2>{0.805489063f, 0.144617811f},
-std::array<float,2>{0.946621716f, 0.640226781f},
-std::array<float,2>{0.226823553f, 0.0312622786f},
-std::array<float,2>{0.30714497f, 0.833799422f},
-std::array<float,2>{0.569336712f, 0.408591628f},
-std::array<float,2>{0.814896524f, 0.775119305f},
-std::array<float,2>{0.0696959719f, 0.458726972f},
-std::array<float,2>{0.451144755f, 0.736106992f},
-std::array<float,2>{0.659345567f, 0.111557588f},
-std::array<float,2>{0.55744946f, 0.579057336f},
-std::array<float,2>{0.362736076f, 0.202783123f},
-std::array<float,2>{0.175502062f, 0.963571906f},
-std::array<float,2>{0.896294534f, 0.340522647f},
-std::array<float,2>{0.59787631f, 0.847690403f},
-std::array<float,2>{0.260979325f, 0.389106482f},
-std::array<float,2>{0.21210885f, 0.659151793f},
-std::array<float,2>{0.975898266f, 0.0170748662f},
-std::array<float,2>{0.755109251f, 0.551033497f},
-std::array<float,2>{0.0508996621f, 0.156598076f},
-std::array<float,2>{0.422669381f, 0.934639871f},
-std::array<float,2>{0.705871642f, 0.274475962f},
-std::array<float,2>{0.917395234f, 0.974237263f},
-std::array<float,2>{0.145151719f, 0.362177879f},
-std::array<float,2>{0.323025256f, 0.606770456f},
-std::array<float,2>{0.513337672f, 0.225286335f},
-std::array<float,2>{0.648921669f, 0.706479669f},
-std::array<float,2>{0.494682699f, 0.0929037184f},
-std::array<float,2>{0.103990696f, 0.783838987f},
-std::array<float,2>{0.854813099f, 0.473268181f},
-std::array<float,2>{0.552570403f, 0.901430666f},
-std::array<float,2>{0.367482364f, 0.297644645f},
-std::array<float,2>{0.185684487f, 0.517820299f},
-std::array<float,2>{0.898994327f, 0.136620596f},
-std::array<float,2>{0.823483229f, 0.652170718f},
-std::array<float,2>{0.0738478452f, 0.0596488193f},
-std::array<float,2>{0.442628145f, 0.820080757f},
-std::array<float,2>{0.668382883f, 0.437061161f},
-std::array<float,2>{0.944487095f, 0.753853679f},
-std::array<float,2>{0.225720003f, 0.448004544f},
-std::array<float,2>{0.304577351f, 0.718756497f},
-std::array<float,2>{0.574699879f, 0.104778863f},
-std::array<float,2>{0.738311231f, 0.568068504f},
-std::array<float,2>{0.383008361f, 0.203949705f},
-std::array<float,2>{0.00798564125f, 0.949045777f},
-std::array<float,2>{0.798350811f, 0.321133792f},
-std::array<float,2>{0.646318138f, 0.863517582f},
-std::array<float,2>{0.490094513f, 0.398584843f},
-std::array<float,2>{0.0944087505f, 0.680950761f},
-std::array<float,2>{0.849358678f, 0.0148148313f},
-std::array<float,2>{0.906584322f, 0.537220478f},
-std::array<float,2>{0.148741558f, 0.177892864f},
-std::array<float,2>{0.316207677f, 0.916368604f},
-std::array<float,2>{0.503076971f, 0.251240194f},
-std::array<float,2>{0.761909842f, 0.999099493f},
-std::array<float,2>{0.0594460592f, 0.352959424f},
-std::array<float,2>{0.435873568f, 0.613278031f},
-std::array<float,2>{0.718625724f, 0.241727158f},
-std::array<float,2>{0.602462113f, 0.697840989f},
-std::array<float,2>{0.255400836f, 0.0638127849f},
-std::array<float,2>{0.209323555f, 0.798782647f},
-std::array<float,2>{0.977908671f, 0.491999269f},
-std::array<float,2>{0.690686524f, 0.965296447f},
-std::array<float,2>{0.410639346f, 0.339720994f},
-std::array<float,2>{0.0356891938f, 0.585668147f},
-std::array<float,2>{0.775686681f, 0.196416348f},
-std::array<float,2>{0.988561451f, 0.739583313f},
-std::array<float,2>{0.198959783f, 0.116391487f},
-std::array<float,2>{0.276042432f, 0.778533995f},
-std::array<float,2>{0.624937773f, 0.456190586f},
-std::array<float,2>{0.863192439f, 0.828762889f},
-std::array<float,2>{0.115958758f, 0.410193741f},
-std::array<float,2>{0.469090343f, 0.63431716f},
-std::array<float,2>{0.633429706f, 0.0363596976f},
-std::array<float,2>{0.528077304f, 0.511483729f},
-std::array<float,2>{0.337555796f, 0.143645152f},
-std::array<float,2>{0.134748891f, 0.890256345f},
-std::array<float,2>{0.932244658f, 0.290392339f},
-std::array<float,2>{0.578359723f, 0.788561046f},
-std::array<float,2>{0.283305466f, 0.469201356f},
-std::array<float,2>{0.23530066f, 0.709504008f},
-std::array<float,2>{0.965448141f, 0.0894354954f},
-std::array<float,2>{0.787785172f, 0.601905167f},
-std::array<float,2>{0.0201665405f, 0.222363815f},
-std::array<float,2>{0.402119309f, 0.971678257f},
-std::array<float,2>{0.733058453f, 0.365080327f},
-std::array<float,2>{0.886357069f, 0.932005644f},
-std::array<float,2>{0.156794474f, 0.280506641f},
-std::array<float,2>{0.351877183f, 0.549453676f},
-std::array<float,2>{0.541844487f, 0.163768426f},
-std::array<float,2>{0.676870525f, 0.66030544f},
-std::array<float,2>{0.46829772f, 0.0223986413f},
-std::array<float,2>{0.0788003728f, 0.847053468f},
-std::array<float,2>{0.842535496f, 0.383875281f},
-std::array<float,2>{0.613488793f, 0.982244253f},
-std::array<float,2>{0.270819306f, 0.373450816f},
-std::array<float,2>{0.189248532f, 0.597827554f},
-std::array<float,2>{0.993724108f, 0.228323668f},
-std::array<float,2>{0.767999589f, 0.711169779f},
-std::array<float,2>{0.0435692295f, 0.0803517625f},
-std::array<float,2>{0.414174885f, 0.78911674f},
-std::array<float,2>{0.701557517f, 0.476921886f},
-std::array<float,2>{0.923067331f, 0.85875988f},
-std::array<float,2>{0.127043694f, 0.380241603f},
-std::array<float,2>{0.329802692f, 0.671714723f},
-std::array<float,2>{0.520640194f, 0.0310248081f},
-std::array<float,2>{0.626250029f, 0.556593478f},
-std::array<float,2>{0.479836673f, 0.168093055f},
-std::array<float,2>{0.117486708f, 0.922436297f},
-std::array<float,2>{0.872561634f, 0.268527418f},
-std::array<float,2>{0.720413089f, 0.770807564f},
-std::array<float,2>{0.394739419f, 0.465059072f},
-std::array<float,2>{0.0257439371f, 0.748234093f},
-std::array<float,2>{0.78951025f, 0.118866749f},
-std::array<float,2>{0.954022884f, 0.593452036f},
-std::array<float,2>{0.247130096f, 0.189870358f},
-std::array<float,2>{0.294520646f, 0.96032989f},
-std::array<float,2>{0.591032147f, 0.329475045f},
-std::array<float,2>{0.8328439f, 0.875657439f},
-std::array<float,2>{0.0890304074f, 0.284828186f},
-std::array<float,2>{0.455690414f, 0.502681077f},
-std::array<float,2>{0.68386668f, 0.152175456f},
-std::array<float,2>{0.535101771f, 0.629418075f},
-std::array<float,2>{0.345437139f, 0.0402389914f},
-std::array<float,2>{0.167163745f, 0.837129891f},
-std::array<float,2>{0.878002167f, 0.415529132f},
-std::array<float,2>{0.660264313f, 0.907759309f},
-std::array<float,2>{0.448216707f, 0.260545433f},
-std::array<float,2>{0.0643954426f, 0.542192996f},
-std::array<float,2>{0.819498777f, 0.186964169f},
-std::array<float,2>{0.891438127f, 0.673293233f},
-std::array<float,2>{0.177569881f, 0.00582701201f},
-std::array<float,2>{0.366219848f, 0.872113883f},
-std::array<float,2>{0.558861792f, 0.394484222f},
-std::array<float,2>{0.808839381f, 0.806578457f},
-std::array<float,2>{0.00359684229f, 0.495275855f},
-std::array<float,2>{0.380170047f, 0.691095531f},
-std::array<float,2>{0.749613762f, 0.0751913637f},
-std::array<float,2>{0.56310904f, 0.617256761f},
-std::array<float,2>{0.309464276f, 0.242658183f},
-std::array<float,2>{0.230759397f, 0.988122046f},
-std::array<float,2>{0.952172995f, 0.346129626f},
-std::array<float,2>{0.509708524f, 0.82389605f},
-std::array<float,2>{0.324991971f, 0.429099292f},
-std::array<float,2>{0.142081439f, 0.64652276f},
-std::array<float,2>{0.920508325f, 0.0537584946f},
-std::array<float,2>{0.858786106f, 0.523780227f},
-std::array<float,2>{0.106184922f, 0.130095541f},
-std::array<float,2>{0.496193379f, 0.895011604f},
-std::array<float,2>{0.654393911f, 0.305372477f},
-std::array<float,2>{0.968989611f, 0.944292963f},
-std::array<float,2>{0.218547672f, 0.320152342f},
-std::array<float,2>{0.265558034f, 0.576754689f},
-std::array<float,2>{0.596603334f, 0.212302238f},
-std::array<float,2>{0.709892631f, 0.727745831f},
-std::array<float,2>{0.429373175f, 0.0959913507f},
-std::array<float,2>{0.0478039011f, 0.758732915f},
-std::array<float,2>{0.750946522f, 0.442981005f},
-std::array<float,2>{0.606837571f, 0.881133497f},
-std::array<float,2>{0.251202077f, 0.288635463f},
-std::array<float,2>{0.203693911f, 0.507590234f},
-std::array<float,2>{0.981848776f, 0.154849321f},
-std::array<float,2>{0.758426309f, 0.627607286f},
-std::array<float,2>{0.0548931919f, 0.0448322669f},
-std::array<float,2>{0.43205893f, 0.84030664f},
-std::array<float,2>{0.712033629f, 0.419996232f},
-std::array<float,2>{0.910414517f, 0.768316925f},
-std::array<float,2>{0.153489947f, 0.46391359f},
-std::array<float,2>{0.317757756f, 0.744515598f},
-std::array<float,2>{0.505905986f, 0.122626632f},
-std::array<float,2>{0.644457817f, 0.587475836f},
-std::array<float,2>{0.484620571f, 0.194734678f},
-std::array<float,2>{0.099802576f, 0.95658648f},
-std::array<float,2>{0.84762305f, 0.334129542f},
-std::array<float,2>{0.737911522f, 0.852535784f},
-std::array<float,2>{0.388864905f, 0.378684849f},
-std::array<float,2>{0.0155472606f, 0.666372955f},
-std::array<float,2>{0.80314374f, 0.0255672112f},
-std::array<float,2>{0.941283405f, 0.560154438f},
-std::array<float,2>{0.220425174f, 0.164540946f},
-std::array<float,2>{0.300094187f, 0.928452313f},
-std::array<float,2>{0.571376204f, 0.270812392f},
-std::array<float,2>{0.828081667f, 0.980109215f},
-std::array<float,2>{0.0747744069f, 0.370277256f},
-std::array<float,2>{0.438192666f, 0.596024871f},
-std::array<float,2>{0.666228592f, 0.231804147f},
-std::array<float,2>{0.547890484f, 0.71552676f},
-std::array<float,2>{0.372685701f, 0.0828441009f},
-std::array<float,2>{0.181582615f, 0.795553088f},
-std::array<float,2>{0.904505074f, 0.484065145f},
-std::array<float,2>{0.672939301f, 0.940697551f},
-std::array<float,2>{0.464594454f, 0.312840492f},
-std::array<float,2>{0.0833172202f, 0.573891938f},
-std::array<float,2>{0.836736917f, 0.215193003f},
-std::array<float,2>{0.88872993f, 0.731569052f},
-std::array<float,2>{0.164037555f, 0.0995140225f},
-std::array<float,2>{0.355907619f, 0.762301505f},
-std::array<float,2>{0.545681119f, 0.439894974f},
-std::array<float,2>{0.783146501f, 0.825332463f},
-std::array<float,2>{0.0193706937f, 0.42372331f},
-std::array<float,2>{0.40372476f, 0.64291054f},
-std::array<float,2>{0.728361011f, 0.0471711606f},
-std::array<float,2>{0.582203567f, 0.5282377f},
-std::array<float,2>{0.286287129f, 0.126174212f},
-std::array<float,2>{0.241616145f, 0.894257784f},
-std::array<float,2>{0.964190304f, 0.309277326f},
-std::array<float,2>{0.525787115f, 0.810212851f},
-std::array<float,2>{0.340600997f, 0.496468395f},
-std::array<float,2>{0.139834955f, 0.695053697f},
-std::array<float,2>{0.934475601f, 0.0716920123f},
-std::array<float,2>{0.865920186f, 0.623635173f},
-std::array<float,2>{0.112527214f, 0.249884173f},
-std::array<float,2>{0.473685145f, 0.991917312f},
-std::array<float,2>{0.638321042f, 0.351415485f},
-std::array<float,2>{0.987902999f, 0.911011875f},
-std::array<float,2>{0.201964572f, 0.262716621f},
-std::array<float,2>{0.280042708f, 0.54328835f},
-std::array<float,2>{0.618162811f, 0.182671934f},
-std::array<float,2>{0.692639053f, 0.679351628f},
-std::array<float,2>{0.407208145f, 0.00123863877f},
-std::array<float,2>{0.0349155292f, 0.870275855f},
-std::array<float,2>{0.780501306f, 0.396134436f},
-std::array<float,2>{0.537249446f, 0.993425786f},
-std::array<float,2>{0.348555893f, 0.358000845f},
-std::array<float,2>{0.170928761f, 0.617029488f},
-std::array<float,2>{0.879633963f, 0.235555083f},
-std::array<float,2>{0.8319453f, 0.700601339f},
-std::array<float,2>{0.0935512856f, 0.0674022287f},
-std::array<float,2>{0.459800869f, 0.804232299f},
-std::array<float,2>{0.68336612f, 0.485602766f},
-std::array<float,2>{0.959228992f, 0.862715185f},
-std::array<float,2>{0.244279936f, 0.403815866f},
-std::array<float,2>{0.29157573f, 0.686975121f},
-std::array<float,2>{0.586844146f, 0.00866774563f},
-std::array<float,2>{0.724637926f, 0.531755865f},
-std::array<float,2>{0.393521726f, 0.174170062f},
-std::array<float,2>{0.0305119734f, 0.921296418f},
-std::array<float,2>{0.795093417f, 0.254645199f},
-std::array<float,2>{0.63004303f, 0.756885886f},
-std::array<float,2>{0.483650237f, 0.449404389f},
-std::array<float,2>{0.12385726f, 0.723879993f},
-std::array<float,2>{0.870514512f, 0.108063623f},
-std::array<float,2>{0.925782859f, 0.564860642f},
-std::array<float,2>{0.129257888f, 0.209213883f},
-std::array<float,2>{0.333030611f, 0.951836288f},
-std::array<float,2>{0.518266201f, 0.327880919f},
-std::array<float,2>{0.771946192f, 0.904601276f},
-std::array<float,2>{0.0401045159f, 0.304555476f},
-std::array<float,2>{0.421191365f, 0.522019982f},
-std::array<float,2>{0.696105659f, 0.138482243f},
-std::array<float,2>{0.609671712f, 0.655012965f},
-std::array<float,2>{0.269186974f, 0.0548684932f},
-std::array<float,2>{0.194396794f, 0.815382302f},
-std::array<float,2>{0.99611026f, 0.43289265f},
-std::array<float,2>{0.704367042f, 0.937394202f},
-std::array<float,2>{0.424880981f, 0.277008802f},
-std::array<float,2>{0.0531165525f, 0.554114521f},
-std::array<float,2>{0.756572187f, 0.158487841f},
-std::array<float,2>{0.972709835f, 0.657562375f},
-std::array<float,2>{0.213241428f, 0.0188162979f},
-std::array<float,2>{0.258553565f, 0.850324214f},
-std::array<float,2>{0.600550771f, 0.386836141f},
-std::array<float,2>{0.852049887f, 0.781438351f},
-std::array<float,2>{0.103071757f, 0.475125372f},
-std::array<float,2>{0.492498875f, 0.704381108f},
-std::array<float,2>{0.651945174f, 0.0906408429f},
-std::array<float,2>{0.514149666f, 0.607508838f},
-std::array<float,2>{0.322009146f, 0.223721594f},
-std::array<float,2>{0.148193926f, 0.97644943f},
-std::array<float,2>{0.915170133f, 0.360627502f},
-std::array<float,2>{0.566963315f, 0.834120214f},
-std::array<float,2>{0.305137873f, 0.406778485f},
-std::array<float,2>{0.229211345f, 0.637352586f},
-std::array<float,2>{0.948151588f, 0.0334459655f},
-std::array<float,2>{0.808118999f, 0.514347672f},
-std::array<float,2>{0.00709069893f, 0.148267329f},
-std::array<float,2>{0.376651555f, 0.883040786f},
-std::array<float,2>{0.745977163f, 0.294426888f},
-std::array<float,2>{0.89672327f, 0.961136699f},
-std::array<float,2>{0.172986999f, 0.3437213f},
-std::array<float,2>{0.36126557f, 0.58147037f},
-std::array<float,2>{0.556100488f, 0.200162798f},
-std::array<float,2>{0.657726288f, 0.737695932f},
-std::array<float,2>{0.451317996f, 0.109810807f},
-std::array<float,2>{0.0665046722f, 0.776409864f},
-std::array<float,2>{0.813949525f, 0.460202098f},
-std::array<float,2>{0.500454783f, 0.915096343f},
-std::array<float,2>{0.313392937f, 0.253392011f},
-std::array<float,2>{0.150879428f, 0.536130965f},
-std::array<float,2>{0.90908283f, 0.176241145f},
-std::array<float,2>{0.851454258f, 0.682003677f},
-std::array<float,2>{0.096654512f, 0.0121641411f},
-std::array<float,2>{0.490837753f, 0.866388381f},
-std::array<float,2>{0.646546662f, 0.402181387f},
-std::array<float,2>{0.98039645f, 0.800646484f},
-std::array<float,2>{0.208257407f, 0.489543647f},
-std::array<float,2>{0.257111579f, 0.696139932f},
-std::array<float,2>{0.604135454f, 0.0654757619f},
-std::array<float,2>{0.715357482f, 0.611252189f},
-std::array<float,2>{0.433795154f, 0.240200445f},
-std::array<float,2>{0.0621483102f, 0.997550786f},
-std::array<float,2>{0.763769209f, 0.354416609f},
-std::array<float,2>{0.670241773f, 0.816656053f},
-std::array<float,2>{0.444865406f, 0.434328079f},
-std::array<float,2>{0.0709383562f, 0.650066376f},
-std::array<float,2>{0.821126521f, 0.0617404394f},
-std::array<float,2>{0.901587725f, 0.517419934f},
-std::array<float,2>{0.185524985f, 0.13364692f},
-std::array<float,2>{0.369359225f, 0.898444295f},
-std::array<float,2>{0.553864539f, 0.300047904f},
-std::array<float,2>{0.800499439f, 0.946953952f},
-std::array<float,2>{0.0108008282f, 0.32226935f},
-std::array<float,2>{0.384775251f, 0.569999874f},
-std::array<float,2>{0.74038291f, 0.206732333f},
-std::array<float,2>{0.576748729f, 0.72156179f},
-std::array<float,2>{0.301985055f, 0.10255985f},
-std::array<float,2>{0.223421469f, 0.750723124f},
-std::array<float,2>{0.941921055f, 0.446586758f},
-std::array<float,2>{0.730587244f, 0.968858361f},
-std::array<float,2>{0.39974615f, 0.366388291f},
-std::array<float,2>{0.0221495237f, 0.604884505f},
-std::array<float,2>{0.786339879f, 0.219832867f},
-std::array<float,2>{0.968032002f, 0.708860159f},
-std::array<float,2>{0.237970531f, 0.0873453766f},
-std::array<float,2>{0.282115161f, 0.786919475f},
-std::array<float,2>{0.580151081f, 0.471901447f},
-std::array<float,2>{0.841138899f, 0.845378578f},
-std::array<float,2>{0.0815549865f, 0.384810656f},
-std::array<float,2>{0.46500203f, 0.662589014f},
-std::array<float,2>{0.677936792f, 0.0208856445f},
-std::array<float,2>{0.540143967f, 0.547831953f},
-std::array<float,2>{0.354337305f, 0.161877498f},
-std::array<float,2>{0.159294561f, 0.930831611f},
-std::array<float,2>{0.884319007f, 0.278053582f},
-std::array<float,2>{0.622976303f, 0.780240238f},
-std::array<float,2>{0.274505138f, 0.454837769f},
-std::array<float,2>{0.196306363f, 0.740563095f},
-std::array<float,2>{0.990983665f, 0.114896111f},
-std::array<float,2>{0.774708629f, 0.582155704f},
-std::array<float,2>{0.0374096707f, 0.198292896f},
-std::array<float,2>{0.412309587f, 0.968731225f},
-std::array<float,2>{0.688808501f, 0.336917371f},
-std::array<float,2>{0.930716276f, 0.888151228f},
-std::array<float,2>{0.135015398f, 0.292471111f},
-std::array<float,2>{0.337919921f, 0.508661866f},
-std::array<float,2>{0.530087531f, 0.140989408f},
-std::array<float,2>{0.635786116f, 0.636107087f},
-std::array<float,2>{0.470823884f, 0.0387694389f},
-std::array<float,2>{0.114191666f, 0.831634283f},
-std::array<float,2>{0.859947801f, 0.413765579f},
-std::array<float,2>{0.592529655f, 0.958095014f},
-std::array<float,2>{0.295236617f, 0.331153631f},
-std::array<float,2>{0.24846302f, 0.59046334f},
-std::array<float,2>{0.955534458f, 0.188452706f},
-std::array<float,2>{0.791018724f, 0.74740535f},
-std::array<float,2>{0.0246649757f, 0.12092077f},
-std::array<float,2>{0.398253769f, 0.772157192f},
-std::array<float,2>{0.722103477f, 0.467303336f},
-std::array<float,2>{0.876747608f, 0.838824511f},
-std::array<float,2>{0.165342405f, 0.417237699f},
-std::array<float,2>{0.345746785f, 0.632457554f},
-std::array<float,2>{0.532886147f, 0.0417654105f},
-std::array<float,2>{0.686495125f, 0.501372516f},
-std::array<float,2>{0.45349133f, 0.149906561f},
-std::array<float,2>{0.0870814696f, 0.878780901f},
-std::array<float,2>{0.835450947f, 0.283129424f},
-std::array<float,2>{0.70039326f, 0.792385757f},
-std::array<float,2>{0.416336447f, 0.480054468f},
-std::array<float,2>{0.0460764877f, 0.714420378f},
-std::array<float,2>{0.765962601f, 0.080048725f},
-std::array<float,2>{0.9956581f, 0.60138762f},
-std::array<float,2>{0.190538198f, 0.228594676f},
-std::array<float,2>{0.27167663f, 0.982565999f},
-std::array<float,2>{0.615515113f, 0.372984171f},
-std::array<float,2>{0.874860168f, 0.924818635f},
-std::array<float,2>{0.120274611f, 0.266915828f},
-std::array<float,2>{0.478389293f, 0.55701977f},
-std::array<float,2>{0.627984822f, 0.171539336f},
-std::array<float,2>{0.523303866f, 0.668967366f},
-std::array<float,2>{0.331000596f, 0.0277238749f},
-std::array<float,2>{0.125090972f, 0.856117606f},
-std::array<float,2>{0.924371064f, 0.382074773f},
-std::array<float,2>{0.654190421f, 0.898109794f},
-std::array<float,2>{0.498371482f, 0.307759821f},
-std::array<float,2>{0.109097883f, 0.527179837f},
-std::array<float,2>{0.855624557f, 0.131322578f},
-std::array<float,2>{0.918239355f, 0.645450771f},
-std::array<float,2>{0.14448756f, 0.0526765287f},
-std::array<float,2>{0.327556849f, 0.821281731f},
-std::array<float,2>{0.510083318f, 0.42582953f},
-std::array<float,2>{0.75377202f, 0.760909557f},
-std::array<float,2>{0.0490975454f, 0.444025725f},
-std::array<float,2>{0.426066875f, 0.730308831f},
-std::array<float,2>{0.707391739f, 0.0950733349f},
-std::array<float,2>{0.594619155f, 0.575675488f},
-std::array<float,2>{0.26222381f, 0.2146357f},
-std::array<float,2>{0.215212315f, 0.943137228f},
-std::array<float,2>{0.972584844f, 0.31697607f},
-std::array<float,2>{0.561848521f, 0.873687029f},
-std::array<float,2>{0.364192933f, 0.390808582f},
-std::array<float,2>{0.177768528f, 0.674895585f},
-std::array<float,2>{0.892833412f, 0.00722041493f},
-std::array<float,2>{0.817266285f, 0.539199829f},
-std::array<float,2>{0.0644850209f, 0.184167162f},
-std::array<float,2>{0.445917457f, 0.908375978f},
-std::array<float,2>{0.663389623f, 0.258565128f},
-std::array<float,2>{0.951141775f, 0.985257328f},
-std::array<float,2>{0.233791441f, 0.345245928f},
-std::array<float,2>{0.310823381f, 0.61973244f},
-std::array<float,2>{0.565777004f, 0.245716974f},
-std::array<float,2>{0.74672389f, 0.687953651f},
-std::array<float,2>{0.382059693f, 0.0778587088f},
-std::array<float,2>{0.00144729821f, 0.807064831f},
-std::array<float,2>{0.811959743f, 0.493541747f},
-std::array<float,2>{0.585863769f, 0.893087149f},
-std::array<float,2>{0.287836432f, 0.309794456f},
-std::array<float,2>{0.239262715f, 0.528974295f},
-std::array<float,2>{0.962280691f, 0.125849321f},
-std::array<float,2>{0.7848351f, 0.643746018f},
-std::array<float,2>{0.0165618304f, 0.0481947511f},
-std::array<float,2>{0.406219423f, 0.824241102f},
-std::array<float,2>{0.729310572f, 0.42236948f},
-std::array<float,2>{0.888278425f, 0.76274538f},
-std::array<float,2>{0.161385328f, 0.441108078f},
-std::array<float,2>{0.358458787f, 0.730981529f},
-std::array<float,2>{0.544402122f, 0.0981902182f},
-std::array<float,2>{0.674943328f, 0.572918475f},
-std::array<float,2>{0.461597383f, 0.216513216f},
-std::array<float,2>{0.0843757838f, 0.939715803f},
-std::array<float,2>{0.838032663f, 0.314438254f},
-std::array<float,2>{0.695095122f, 0.869161189f},
-std::array<float,2>{0.408618748f, 0.395267189f},
-std::array<float,2>{0.0312604867f, 0.677824795f},
-std::array<float,2>{0.777770102f, 0.00066731486f},
-std::array<float,2>{0.985548675f, 0.544013083f},
-std::array<float,2>{0.200926915f, 0.181751758f},
-std::array<float,2>{0.279144466f, 0.911277413f},
-std::array<float,2>{0.619517863f, 0.262312025f},
-std::array<float,2>{0.863754392f, 0.99117142f},
-std::array<float,2>{0.110121034f, 0.35023281f},
-std::array<float,2>{0.476042628f, 0.624654591f},
-std::array<float,2>{0.63870877f, 0.248338833f},
-std::array<float,2>{0.524064839f, 0.693996906f},
-std::array<float,2>{0.342848957f, 0.0704228953f},
-std::array<float,2>{0.137624949f, 0.808897197f},
-std::array<float,2>{0.936356306f, 0.497791022f},
-std::array<float,2>{0.640701771f, 0.95520854f},
-std::array<float,2>{0.486417294f, 0.334982097f},
-std::array<float,2>{0.0989862308f, 0.586081624f},
-std::array<float,2>{0.845018506f, 0.193390384f},
-std::array<float,2>{0.913307846f, 0.746092021f},
-std::array<float,2>{0.15495114f, 0.121496715f},
-std::array<float,2>{0.319481671f, 0.769045234f},
-std::array<float,2>{0.504065096f, 0.463810682f},
-std::array<float,2>{0.761597335f, 0.841793537f},
-std::array<float,2>{0.0585332513f, 0.421824336f},
-std::array<float,2>{0.43154943f, 0.628130436f},
-std::array<float,2>{0.713911116f, 0.0436898842f},
-std::array<float,2>{0.608502865f, 0.506012022f},
-std::array<float,2>{0.252361149f, 0.15592967f},
-std::array<float,2>{0.206815094f, 0.88218224f},
-std::array<float,2>{0.984200001f, 0.287448615f},
-std::array<float,2>{0.54893142f, 0.79676801f},
-std::array<float,2>{0.374343306f, 0.483080298f},
-std::array<float,2>{0.182488576f, 0.71606642f},
-std::array<float,2>{0.902520478f, 0.083671242f},
-std::array<float,2>{0.825420499f, 0.597351015f},
-std::array<float,2>{0.076738216f, 0.231154576f},
-std::array<float,2>{0.440618038f, 0.979187667f},
-std::array<float,2>{0.664295971f, 0.369616061f},
-std::array<float,2>{0.938352466f, 0.928891122f},
-std::array<float,2>{0.220717937f, 0.269932956f},
-std::array<float,2>{0.29729709f, 0.559334099f},
-std::array<float,2>{0.573989809f, 0.165411562f},
-std::array<float,2>{0.73566401f, 0.667921484f},
-std::array<float,2>{0.388593346f, 0.0268043131f},
-std::array<float,2>{0.0130403265f, 0.852944732f},
-std::array<float,2>{0.80107975f, 0.377721936f},
-std::array<float,2>{0.512225807f, 0.975012839f},
-std::array<float,2>{0.324146122f, 0.359917521f},
-std::array<float,2>{0.146390945f, 0.609193861f},
-std::array<float,2>{0.916146636f, 0.223527372f},
-std::array<float,2>{0.853636146f, 0.703786194f},
-std::array<float,2>{0.104602918f, 0.0912231877f},
-std::array<float,2>{0.495700717f, 0.782546222f},
-std::array<float,2>{0.65000546f, 0.475718677f},
-std::array<float,2>{0.974786937f, 0.851544201f},
-std::array<float,2>{0.211619899f, 0.388061583f},
-std::array<float,2>{0.260687619f, 0.656510472f},
-std::array<float,2>{0.599569261f, 0.0184490308f},
-std::array<float,2>{0.706178725f, 0.553601801f},
-std::array<float,2>{0.42291835f, 0.159524217f},
-std::array<float,2>{0.0518152304f, 0.936509967f},
-std::array<float,2>{0.754876971f, 0.276354462f},
-std::array<float,2>{0.658455312f, 0.775862336f},
-std::array<float,2>{0.450108916f, 0.459457487f},
-std::array<float,2>{0.0685525015f, 0.736922324f},
-std::array<float,2>{0.815785825f, 0.111320786f},
-std::array<float,2>{0.895119667f, 0.580762625f},
-std::array<float,2>{0.174266174f, 0.200995758f},
-std::array<float,2>{0.361434877f, 0.962018192f},
-std::array<float,2>{0.557724535f, 0.342473626f},
-std::array<float,2>{0.806115866f, 0.884162307f},
-std::array<float,2>{0.00425597606f, 0.293420434f},
-std::array<float,2>{0.378862262f, 0.515520632f},
-std::array<float,2>{0.744127333f, 0.147435755f},
-std::array<float,2>{0.568515718f, 0.637923121f},
-std::array<float,2>{0.3078987f, 0.034681458f},
-std::array<float,2>{0.227643624f, 0.835177958f},
-std::array<float,2>{0.945389092f, 0.407380909f},
-std::array<float,2>{0.724173486f, 0.92045027f},
-std::array<float,2>{0.390990257f, 0.255759776f},
-std::array<float,2>{0.0289194454f, 0.532678127f},
-std::array<float,2>{0.794033229f, 0.175608918f},
-std::array<float,2>{0.957972407f, 0.686216891f},
-std::array<float,2>{0.24371694f, 0.00893044565f},
-std::array<float,2>{0.289816678f, 0.861506104f},
-std::array<float,2>{0.588782966f, 0.403208047f},
-std::array<float,2>{0.829751968f, 0.803534687f},
-std::array<float,2>{0.0912327543f, 0.484420806f},
-std::array<float,2>{0.457663953f, 0.6999318f},
-std::array<float,2>{0.680742681f, 0.0673287958f},
-std::array<float,2>{0.535494387f, 0.615821421f},
-std::array<float,2>{0.350892305f, 0.234787613f},
-std::array<float,2>{0.169298351f, 0.993026435f},
-std::array<float,2>{0.881711364f, 0.358704388f},
-std::array<float,2>{0.612293661f, 0.815786839f},
-std::array<float,2>{0.267544597f, 0.432310373f},
-std::array<float,2>{0.192780808f, 0.655785441f},
-std::array<float,2>{0.999655008f, 0.0557283722f},
-std::array<float,2>{0.770469248f, 0.523271024f},
-std::array<float,2>{0.0421360061f, 0.136905372f},
-std::array<float,2>{0.418383896f, 0.905728936f},
-std::array<float,2>{0.697269022f, 0.30300647f},
-std::array<float,2>{0.928465128f, 0.952286065f},
-std::array<float,2>{0.13090919f, 0.32665956f},
-std::array<float,2>{0.334574193f, 0.565892458f},
-std::array<float,2>{0.517398059f, 0.210867509f},
-std::array<float,2>{0.632808447f, 0.723530948f},
-std::array<float,2>{0.480535597f, 0.108822063f},
-std::array<float,2>{0.121961698f, 0.756499112f},
-std::array<float,2>{0.869014561f, 0.450965464f},
-std::array<float,2>{0.542259037f, 0.930315137f},
-std::array<float,2>{0.353082955f, 0.278346866f},
-std::array<float,2>{0.157424062f, 0.548039317f},
-std::array<float,2>{0.885344446f, 0.1611007f},
-std::array<float,2>{0.842856884f, 0.663305283f},
-std::array<float,2>{0.07967145f, 0.019716287f},
-std::array<float,2>{0.467494398f, 0.843780398f},
-std::array<float,2>{0.676676035f, 0.386132628f},
-std::array<float,2>{0.966377378f, 0.786057711f},
-std::array<float,2>{0.235992774f, 0.471444458f},
-std::array<float,2>{0.284449816f, 0.707538009f},
-std::array<float,2>{0.58007741f, 0.0859562233f},
-std::array<float,2>{0.733887851f, 0.604392648f},
-std::array<float,2>{0.401127607f, 0.219280913f},
-std::array<float,2>{0.021374587f, 0.970482409f},
-std::array<float,2>{0.78873843f, 0.365418732f},
-std::array<float,2>{0.634051263f, 0.83089f},
-std::array<float,2>{0.469786614f, 0.412818193f},
-std::array<float,2>{0.116895579f, 0.635479867f},
-std::array<float,2>{0.861746967f, 0.0373317152f},
-std::array<float,2>{0.932739556f, 0.50943321f},
-std::array<float,2>{0.132915229f, 0.142248988f},
-std::array<float,2>{0.336116076f, 0.886972308f},
-std::array<float,2>{0.528983414f, 0.291401535f},
-std::array<float,2>{0.776560307f, 0.967666745f},
-std::array<float,2>{0.0365989842f, 0.336425275f},
-std::array<float,2>{0.411638826f, 0.583138585f},
-std::array<float,2>{0.690427303f, 0.197687641f},
-std::array<float,2>{0.623051107f, 0.741998851f},
-std::array<float,2>{0.277173787f, 0.113476388f},
-std::array<float,2>{0.197839797f, 0.781025589f},
-std::array<float,2>{0.989947617f, 0.453513026f},
-std::array<float,2>{0.717184603f, 0.996772289f},
-std::array<float,2>{0.43710953f, 0.355079442f},
-std::array<float,2>{0.0599192418f, 0.609896481f},
-std::array<float,2>{0.763341129f, 0.238886029f},
-std::array<float,2>{0.976701379f, 0.697095513f},
-std::array<float,2>{0.210281372f, 0.0652360544f},
-std::array<float,2>{0.254656762f, 0.798971772f},
-std::array<float,2>{0.602859914f, 0.489225447f},
-std::array<float,2>{0.848456204f, 0.865371823f},
-std::array<float,2>{0.0954106227f, 0.400722414f},
-std::array<float,2>{0.489066035f, 0.682685792f},
-std::array<float,2>{0.645253778f, 0.0133732529f},
-std::array<float,2>{0.502470613f, 0.536185443f},
-std::array<float,2>{0.314481705f, 0.177497879f},
-std::array<float,2>{0.149706319f, 0.914307773f},
-std::array<float,2>{0.907923281f, 0.252160877f},
-std::array<float,2>{0.575335085f, 0.751150966f},
-std::array<float,2>{0.302907258f, 0.445351928f},
-std::array<float,2>{0.225460276f, 0.721930504f},
-std::array<float,2>{0.943963826f, 0.102331534f},
-std::array<float,2>{0.79749459f, 0.568668962f},
-std::array<float,2>{0.00916690007f, 0.20562309f},
-std::array<float,2>{0.384727627f, 0.945890844f},
-std::array<float,2>{0.740099251f, 0.323675275f},
-std::array<float,2>{0.899444282f, 0.900233567f},
-std::array<float,2>{0.187303305f, 0.299377888f},
-std::array<float,2>{0.368802994f, 0.516459584f},
-std::array<float,2>{0.551651478f, 0.1342666f},
-std::array<float,2>{0.669124067f, 0.649135053f},
-std::array<float,2>{0.442203194f, 0.0609018058f},
-std::array<float,2>{0.0728898346f, 0.818020821f},
-std::array<float,2>{0.822531819f, 0.43477869f},
-std::array<float,2>{0.597399116f, 0.941982687f},
-std::array<float,2>{0.263884485f, 0.317932606f},
-std::array<float,2>{0.216870487f, 0.574844062f},
-std::array<float,2>{0.970537901f, 0.213243753f},
-std::array<float,2>{0.751117587f, 0.729183614f},
-std::array<float,2>{0.0483991168f, 0.0940030664f},
-std::array<float,2>{0.428432226f, 0.760309517f},
-std::array<float,2>{0.710881233f, 0.444898307f},
-std::array<float,2>{0.921465218f, 0.821457148f},
-std::array<float,2>{0.140881136f, 0.427081347f},
-std::array<float,2>{0.325449497f, 0.646462798f},
-std::array<float,2>{0.507858515f, 0.0513714217f},
-std::array<float,2>{0.655692041f, 0.525689602f},
-std::array<float,2>{0.49788022f, 0.132381022f},
-std::array<float,2>{0.10718713f, 0.897188783f},
-std::array<float,2>{0.858077884f, 0.307349741f},
-std::array<float,2>{0.748247206f, 0.807690918f},
-std::array<float,2>{0.379301429f, 0.49288246f},
-std::array<float,2>{0.00207850221f, 0.688631415f},
-std::array<float,2>{0.81022799f, 0.0765671134f},
-std::array<float,2>{0.95143199f, 0.620350063f},
-std::array<float,2>{0.231681824f, 0.244217291f},
-std::array<float,2>{0.310402572f, 0.985778153f},
-std::array<float,2>{0.563712537f, 0.343917966f},
-std::array<float,2>{0.818533897f, 0.909208715f},
-std::array<float,2>{0.0630375892f, 0.259583384f},
-std::array<float,2>{0.448324472f, 0.540739775f},
-std::array<float,2>{0.661916375f, 0.18490456f},
-std::array<float,2>{0.559764624f, 0.674388111f},
-std::array<float,2>{0.365994424f, 0.00678082276f},
-std::array<float,2>{0.176647231f, 0.874627888f},
-std::array<float,2>{0.891711891f, 0.392275035f},
-std::array<float,2>{0.684962392f, 0.877883613f},
-std::array<float,2>{0.456842899f, 0.281688958f},
-std::array<float,2>{0.0885291845f, 0.500692785f},
-std::array<float,2>{0.833021164f, 0.148515761f},
-std::array<float,2>{0.877480805f, 0.631739676f},
-std::array<float,2>{0.166670144f, 0.0423659012f},
-std::array<float,2>{0.343836367f, 0.839826107f},
-std::array<float,2>{0.533297956f, 0.416402936f},
-std::array<float,2>{0.790147364f, 0.773364723f},
-std::array<float,2>{0.0272358712f, 0.468681395f},
-std::array<float,2>{0.395513922f, 0.746106029f},
-std::array<float,2>{0.719470501f, 0.11993739f},
-std::array<float,2>{0.589939475f, 0.590965688f},
-std::array<float,2>{0.29374221f, 0.188891798f},
-std::array<float,2>{0.2469078f, 0.957608104f},
-std::array<float,2>{0.954123497f, 0.330899447f},
-std::array<float,2>{0.519685984f, 0.857408881f},
-std::array<float,2>{0.328958839f, 0.381310046f},
-std::array<float,2>{0.128483772f, 0.668168247f},
-std::array<float,2>{0.922046185f, 0.028498657f},
-std::array<float,2>{0.871280134f, 0.558248222f},
-std::array<float,2>{0.118350215f, 0.170866221f},
-std::array<float,2>{0.479363412f, 0.923832536f},
-std::array<float,2>{0.625176966f, 0.265741557f},
-std::array<float,2>{0.992325544f, 0.983499706f},
-std::array<float,2>{0.187684342f, 0.371816099f},
-std::array<float,2>{0.270290762f, 0.600211263f},
-std::array<float,2>{0.614356756f, 0.229994401f},
-std::array<float,2>{0.70273298f, 0.713797212f},
-std::array<float,2>{0.415130347f, 0.0788228512f},
-std::array<float,2>{0.0441159494f, 0.791116714f},
-std::array<float,2>{0.769531071f, 0.479199767f},
-std::array<float,2>{0.618351161f, 0.913710773f},
-std::array<float,2>{0.280297548f, 0.263700813f},
-std::array<float,2>{0.202928394f, 0.545240223f},
-std::array<float,2>{0.987229228f, 0.179936081f},
-std::array<float,2>{0.779297113f, 0.677712262f},
-std::array<float,2>{0.0334371515f, 0.0036161216f},
-std::array<float,2>{0.407278657f, 0.867693603f},
-std::array<float,2>{0.692320347f, 0.397592217f},
-std::array<float,2>{0.934886217f, 0.812065661f},
-std::array<float,2>{0.139167786f, 0.49994868f},
-std::array<float,2>{0.34099701f, 0.692161143f},
-std::array<float,2>{0.52665019f, 0.0734180138f},
-std::array<float,2>{0.637063265f, 0.622314811f},
-std::array<float,2>{0.472918093f, 0.246801808f},
-std::array<float,2>{0.111746408f, 0.988497674f},
-std::array<float,2>{0.867136478f, 0.347829491f},
-std::array<float,2>{0.727134287f, 0.827918649f},
-std::array<float,2>{0.402679533f, 0.424731553f},
-std::array<float,2>{0.0184916668f, 0.641845345f},
-std::array<float,2>{0.781857252f, 0.0488324985f},
-std::array<float,2>{0.963748336f, 0.530405462f},
-std::array<float,2>{0.240437552f, 0.127395421f},
-std::array<float,2>{0.285524964f, 0.891179502f},
-std::array<float,2>{0.583552897f, 0.312218606f},
-std::array<float,2>{0.837432563f, 0.938323081f},
-std::array<float,2>{0.0826222301f, 0.315137684f},
-std::array<float,2>{0.463244557f, 0.572056532f},
-std::array<float,2>{0.672552407f, 0.217954531f},
-std::array<float,2>{0.546652436f, 0.733956516f},
-std::array<float,2>{0.357118845f, 0.100058779f},
-std::array<float,2>{0.162975952f, 0.765171766f},
-std::array<float,2>{0.890466988f, 0.438640118f},
-std::array<float,2>{0.667546153f, 0.976795852f},
-std::array<float,2>{0.43868494f, 0.368512094f},
-std::array<float,2>{0.0758090839f, 0.595420241f},
-std::array<float,2>{0.826225579f, 0.234011322f},
-std::array<float,2>{0.90531826f, 0.717506588f},
-std::array<float,2>{0.180508479f, 0.0857383609f},
-std::array<float,2>{0.371987909f, 0.793757915f},
-std::array<float,2>{0.547690332f, 0.480811119f},
-std::array<float,2>{0.803754807f, 0.855372369f},
-std::array<float,2>{0.0144897103f, 0.375497639f},
-std::array<float,2>{0.390280098f, 0.665761054f},
-std::array<float,2>{0.736957133f, 0.0237690601f},
-std::array<float,2>{0.571150362f, 0.562057078f},
-std::array<float,2>{0.299026161f, 0.167231679f},
-std::array<float,2>{0.219010636f, 0.926181614f},
-std::array<float,2>{0.940148175f, 0.2721183f},
-std::array<float,2>{0.507763386f, 0.765625894f},
-std::array<float,2>{0.316818565f, 0.461868107f},
-std::array<float,2>{0.152819142f, 0.743974626f},
-std::array<float,2>{0.912080467f, 0.124142349f},
-std::array<float,2>{0.846129179f, 0.589040339f},
-std::array<float,2>{0.101386763f, 0.191818297f},
-std::array<float,2>{0.485488832f, 0.954633653f},
-std::array<float,2>{0.642871618f, 0.333621323f},
-std::array<float,2>{0.980898261f, 0.880219936f},
-std::array<float,2>{0.204147995f, 0.285793871f},
-std::array<float,2>{0.250497103f, 0.505070448f},
-std::array<float,2>{0.605778992f, 0.152543083f},
-std::array<float,2>{0.711415887f, 0.626440287f},
-std::array<float,2>{0.433281183f, 0.0452991799f},
-std::array<float,2>{0.0558316261f, 0.84264487f},
-std::array<float,2>{0.759208262f, 0.418660283f},
-std::array<float,2>{0.555091619f, 0.964322746f},
-std::array<float,2>{0.360160887f, 0.341543376f},
-std::array<float,2>{0.172129437f, 0.579195976f},
-std::array<float,2>{0.897561729f, 0.202066913f},
-std::array<float,2>{0.812797964f, 0.734477818f},
-std::array<float,2>{0.0674432144f, 0.112771772f},
-std::array<float,2>{0.452331305f, 0.774013221f},
-std::array<float,2>{0.656314313f, 0.457225949f},
-std::array<float,2>{0.948262274f, 0.83295089f},
-std::array<float,2>{0.229571909f, 0.409998298f},
-std::array<float,2>{0.306398183f, 0.638941467f},
-std::array<float,2>{0.568319559f, 0.0327676311f},
-std::array<float,2>{0.74476558f, 0.511999428f},
-std::array<float,2>{0.375679404f, 0.146443114f},
-std::array<float,2>{0.00651675137f, 0.886001587f},
-std::array<float,2>{0.806840062f, 0.295485556f},
-std::array<float,2>{0.650984824f, 0.784952939f},
-std::array<float,2>{0.493977278f, 0.474044681f},
-std::array<float,2>{0.101763666f, 0.705619097f},
-std::array<float,2>{0.853357553f, 0.0925701335f},
-std::array<float,2>{0.914960563f, 0.606133163f},
-std::array<float,2>{0.147175342f, 0.225925639f},
-std::array<float,2>{0.321076542f, 0.973305583f},
-std::array<float,2>{0.515588582f, 0.363010883f},
-std::array<float,2>{0.757240713f, 0.934410095f},
-std::array<float,2>{0.0539862253f, 0.274166405f},
-std::array<float,2>{0.424366862f, 0.552264988f},
-std::array<float,2>{0.703801453f, 0.158012331f},
-std::array<float,2>{0.601364136f, 0.660085499f},
-std::array<float,2>{0.25973013f, 0.0156767275f},
-std::array<float,2>{0.214030683f, 0.849433482f},
-std::array<float,2>{0.974261761f, 0.390556335f},
-std::array<float,2>{0.696354032f, 0.90384227f},
-std::array<float,2>{0.420607299f, 0.301406503f},
-std::array<float,2>{0.0395777039f, 0.521133482f},
-std::array<float,2>{0.772814512f, 0.139956445f},
-std::array<float,2>{0.997421443f, 0.653961778f},
-std::array<float,2>{0.193706259f, 0.0576700084f},
-std::array<float,2>{0.26766333f, 0.813597083f},
-std::array<float,2>{0.611176431f, 0.429916471f},
-std::array<float,2>{0.869649708f, 0.755189717f},
-std::array<float,2>{0.124332808f, 0.452246368f},
-std::array<float,2>{0.482798606f, 0.726254702f},
-std::array<float,2>{0.6296826f, 0.107354231f},
-std::array<float,2>{0.519274235f, 0.564361155f},
-std::array<float,2>{0.332179934f, 0.208409443f},
-std::array<float,2>{0.130495995f, 0.950143695f},
-std::array<float,2>{0.92730087f, 0.325815976f},
-std::array<float,2>{0.58744669f, 0.860141933f},
-std::array<float,2>{0.292102963f, 0.405863911f},
-std::array<float,2>{0.24606517f, 0.684497476f},
-std::array<float,2>{0.960906506f, 0.0111055514f},
-std::array<float,2>{0.796217501f, 0.533343792f},
-std::array<float,2>{0.0299343038f, 0.171992451f},
-std::array<float,2>{0.394295812f, 0.918161333f},
-std::array<float,2>{0.726233959f, 0.256624103f},
-std::array<float,2>{0.880491674f, 0.994736969f},
-std::array<float,2>{0.170078129f, 0.355705172f},
-std::array<float,2>{0.348881602f, 0.613401473f},
-std::array<float,2>{0.538587749f, 0.2380151f},
-std::array<float,2>{0.681851625f, 0.702758551f},
-std::array<float,2>{0.460027277f, 0.0687612444f},
-std::array<float,2>{0.092307888f, 0.801604509f},
-std::array<float,2>{0.830728769f, 0.487279534f},
-std::array<float,2>{0.530882239f, 0.888935864f},
-std::array<float,2>{0.339753956f, 0.289988607f},
-std::array<float,2>{0.135830596f, 0.509904623f},
-std::array<float,2>{0.930197895f, 0.143300995f},
-std::array<float,2>{0.860540569f, 0.633194387f},
-std::array<float,2>{0.114578836f, 0.0357610695f},
-std::array<float,2>{0.472547352f, 0.829966247f},
-std::array<float,2>{0.635013223f, 0.411242545f},
-std::array<float,2>{0.991650641f, 0.777592361f},
-std::array<float,2>{0.19537051f, 0.455971837f},
-std::array<float,2>{0.274058104f, 0.738650739f},
-std::array<float,2>{0.621865988f, 0.115361825f},
-std::array<float,2>{0.688411653f, 0.584094167f},
-std::array<float,2>{0.413092256f, 0.195798039f},
-std::array<float,2>{0.038269002f, 0.966100574f},
-std::array<float,2>{0.773614526f, 0.338651448f},
-std::array<float,2>{0.679196894f, 0.845951676f},
-std::array<float,2>{0.466685951f, 0.383135974f},
-std::array<float,2>{0.0809126273f, 0.661921263f},
-std::array<float,2>{0.84012866f, 0.023075182f},
-std::array<float,2>{0.88329947f, 0.549962282f},
-std::array<float,2>{0.15857479f, 0.16244404f},
-std::array<float,2>{0.355155587f, 0.932655394f},
-std::array<float,2>{0.539898455f, 0.280108333f},
-std::array<float,2>{0.785358191f, 0.971751034f},
-std::array<float,2>{0.0225397851f, 0.363767713f},
-std::array<float,2>{0.398902267f, 0.602810085f},
-std::array<float,2>{0.731885076f, 0.221018732f},
-std::array<float,2>{0.581630528f, 0.71052146f},
-std::array<float,2>{0.283116609f, 0.0879674777f},
-std::array<float,2>{0.23703745f, 0.787145972f},
-std::array<float,2>{0.967104912f, 0.470044047f},
-std::array<float,2>{0.741283655f, 0.947741747f},
-std::array<float,2>{0.385986894f, 0.321708083f},
-std::array<float,2>{0.0103931092f, 0.567175865f},
-std::array<float,2>{0.799270988f, 0.204838887f},
-std::array<float,2>{0.943203688f, 0.72024554f},
-std::array<float,2>{0.224076465f, 0.104326911f},
-std::array<float,2>{0.301597625f, 0.752405107f},
-std::array<float,2>{0.577287316f, 0.448317945f},
-std::array<float,2>{0.822115183f, 0.818724453f},
-std::array<float,2>{0.0715042874f, 0.436130315f},
-std::array<float,2>{0.443880975f, 0.651077271f},
-std::array<float,2>{0.67096746f, 0.0594390593f},
-std::array<float,2>{0.552898705f, 0.51920104f},
-std::array<float,2>{0.370756418f, 0.135247305f},
-std::array<float,2>{0.183666125f, 0.900611341f},
-std::array<float,2>{0.900762916f, 0.298473209f},
-std::array<float,2>{0.604724705f, 0.797183335f},
-std::array<float,2>{0.256166428f, 0.490341157f},
-std::array<float,2>{0.207421765f, 0.698512375f},
-std::array<float,2>{0.979198754f, 0.0629520044f},
-std::array<float,2>{0.765621603f, 0.611773551f},
-std::array<float,2>{0.0614863746f, 0.24094975f},
-std::array<float,2>{0.434635967f, 0.998625636f},
-std::array<float,2>{0.716350734f, 0.352391273f},
-std::array<float,2>{0.909700096f, 0.917797923f},
-std::array<float,2>{0.152307197f, 0.250628859f},
-std::array<float,2>{0.313988209f, 0.538850665f},
-std::array<float,2>{0.50164634f, 0.178870752f},
-std::array<float,2>{0.647591889f, 0.680151701f},
-std::array<float,2>{0.492145479f, 0.0141854845f},
-std::array<float,2>{0.0970084146f, 0.864790082f},
-std::array<float,2>{0.850003958f, 0.399738252f},
-std::array<float,2>{0.564927042f, 0.986802638f},
-std::array<float,2>{0.311732888f, 0.34692207f},
-std::array<float,2>{0.232742041f, 0.618587434f},
-std::array<float,2>{0.949397504f, 0.243795529f},
-std::array<float,2>{0.810878575f, 0.690375924f},
-std::array<float,2>{0.000780116767f, 0.0756400079f},
-std::array<float,2>{0.381538689f, 0.80510056f},
-std::array<float,2>{0.747541428f, 0.495028526f},
-std::array<float,2>{0.89441067f, 0.871966779f},
-std::array<float,2>{0.17896679f, 0.393100739f},
-std::array<float,2>{0.364892632f, 0.672248542f},
-std::array<float,2>{0.561330259f, 0.00458961446f},
-std::array<float,2>{0.662784994f, 0.541665912f},
-std::array<float,2>{0.446949661f, 0.185781077f},
-std::array<float,2>{0.0659368485f, 0.906704843f},
-std::array<float,2>{0.817975819f, 0.261411905f},
-std::array<float,2>{0.708054662f, 0.759570062f},
-std::array<float,2>{0.427188039f, 0.442088574f},
-std::array<float,2>{0.050417725f, 0.726665735f},
-std::array<float,2>{0.752475023f, 0.0972079188f},
-std::array<float,2>{0.970958829f, 0.577883542f},
-std::array<float,2>{0.215843424f, 0.211538553f},
-std::array<float,2>{0.263247728f, 0.944814563f},
-std::array<float,2>{0.595449388f, 0.318389535f},
-std::array<float,2>{0.857314408f, 0.89568764f},
-std::array<float,2>{0.107764453f, 0.305780739f},
-std::array<float,2>{0.499110311f, 0.524859011f},
-std::array<float,2>{0.652535141f, 0.129482195f},
-std::array<float,2>{0.511579931f, 0.647999465f},
-std::array<float,2>{0.326536715f, 0.0535688698f},
-std::array<float,2>{0.142973289f, 0.823193491f},
-std::array<float,2>{0.919351816f, 0.427894413f},
-std::array<float,2>{0.627250254f, 0.923299551f},
-std::array<float,2>{0.477155805f, 0.269024789f},
-std::array<float,2>{0.119400159f, 0.554781914f},
-std::array<float,2>{0.873654544f, 0.169458732f},
-std::array<float,2>{0.925418377f, 0.6702227f},
-std::array<float,2>{0.126187548f, 0.029973641f},
-std::array<float,2>{0.331556588f, 0.857626379f},
-std::array<float,2>{0.522351742f, 0.379255116f},
-std::array<float,2>{0.767355382f, 0.790369272f},
-std::array<float,2>{0.0457820073f, 0.478029013f},
-std::array<float,2>{0.417525828f, 0.712806165f},
-std::array<float,2>{0.699323893f, 0.081381008f},
-std::array<float,2>{0.616450191f, 0.599476099f},
-std::array<float,2>{0.272643805f, 0.22711879f},
-std::array<float,2>{0.189623758f, 0.980653584f},
-std::array<float,2>{0.995001495f, 0.374912441f},
-std::array<float,2>{0.531382799f, 0.836603165f},
-std::array<float,2>{0.346844465f, 0.414180338f},
-std::array<float,2>{0.16415517f, 0.630007267f},
-std::array<float,2>{0.875905812f, 0.040004421f},
-std::array<float,2>{0.834874034f, 0.503278732f},
-std::array<float,2>{0.0869039297f, 0.150520697f},
-std::array<float,2>{0.454391271f, 0.876367092f},
-std::array<float,2>{0.687156141f, 0.283517122f},
-std::array<float,2>{0.956918776f, 0.959141254f},
-std::array<float,2>{0.249892369f, 0.328671694f},
-std::array<float,2>{0.29659763f, 0.592009366f},
-std::array<float,2>{0.593077481f, 0.191281229f},
-std::array<float,2>{0.721567512f, 0.74921447f},
-std::array<float,2>{0.396742046f, 0.11775092f},
-std::array<float,2>{0.0240633413f, 0.770302713f},
-std::array<float,2>{0.792139888f, 0.465937436f},
-std::array<float,2>{0.588365793f, 0.918537617f},
-std::array<float,2>{0.289094001f, 0.256309271f},
-std::array<float,2>{0.243269637f, 0.533852994f},
-std::array<float,2>{0.957112968f, 0.17243512f},
-std::array<float,2>{0.794840515f, 0.683959842f},
-std::array<float,2>{0.0286198482f, 0.0116102481f},
-std::array<float,2>{0.39131856f, 0.859842122f},
-std::array<float,2>{0.723684728f, 0.405402541f},
-std::array<float,2>{0.881326973f, 0.801213622f},
-std::array<float,2>{0.169745684f, 0.486591697f},
-std::array<float,2>{0.351528347f, 0.702280045f},
-std::array<float,2>{0.536129594f, 0.0691013709f},
-std::array<float,2>{0.681152701f, 0.614209116f},
-std::array<float,2>{0.457390368f, 0.237669632f},
-std::array<float,2>{0.0917252228f, 0.994507849f},
-std::array<float,2>{0.829551995f, 0.356330812f},
-std::array<float,2>{0.698062003f, 0.814436197f},
-std::array<float,2>{0.418671936f, 0.430329055f},
-std::array<float,2>{0.0428714827f, 0.653756022f},
-std::array<float,2>{0.769851923f, 0.0584291257f},
-std::array<float,2>{0.999322355f, 0.520938337f},
-std::array<float,2>{0.193305388f, 0.140330642f},
-std::array<float,2>{0.267056495f, 0.903541505f},
-std::array<float,2>{0.611531734f, 0.300982147f},
-std::array<float,2>{0.868397057f, 0.949406326f},
-std::array<float,2>{0.121155106f, 0.325596631f},
-std::array<float,2>{0.480976045f, 0.563533485f},
-std::array<float,2>{0.63214004f, 0.208839804f},
-std::array<float,2>{0.51666683f, 0.725691676f},
-std::array<float,2>{0.334002286f, 0.106589153f},
-std::array<float,2>{0.131819874f, 0.75550729f},
-std::array<float,2>{0.928192854f, 0.452795178f},
-std::array<float,2>{0.64974618f, 0.973014534f},
-std::array<float,2>{0.495344013f, 0.362723738f},
-std::array<float,2>{0.10516943f, 0.605607212f},
-std::array<float,2>{0.854238212f, 0.22639209f},
-std::array<float,2>{0.916852355f, 0.705376804f},
-std::array<float,2>{0.14594534f, 0.0918357372f},
-std::array<float,2>{0.323704004f, 0.784363449f},
-std::array<float,2>{0.511733115f, 0.474444062f},
-std::array<float,2>{0.75407213f, 0.848685443f},
-std::array<float,2>{0.0526037253f, 0.390078455f},
-std::array<float,2>{0.423668981f, 0.659370184f},
-std::array<float,2>{0.706647098f, 0.0161385983f},
-std::array<float,2>{0.599042177f, 0.551811516f},
-std::array<float,2>{0.259777278f, 0.157572478f},
-std::array<float,2>{0.21116735f, 0.934008539f},
-std::array<float,2>{0.975122988f, 0.273720056f},
-std::array<float,2>{0.558156312f, 0.773744404f},
-std::array<float,2>{0.361988962f, 0.457653284f},
-std::array<float,2>{0.174449965f, 0.734892726f},
-std::array<float,2>{0.894706488f, 0.11284893f},
-std::array<float,2>{0.81592834f, 0.57993567f},
-std::array<float,2>{0.0693044662f, 0.201419502f},
-std::array<float,2>{0.449377239f, 0.964719772f},
-std::array<float,2>{0.658870757f, 0.340830296f},
-std::array<float,2>{0.945894957f, 0.886483848f},
-std::array<float,2>{0.228109866f, 0.295383304f},
-std::array<float,2>{0.308326364f, 0.512508988f},
-std::array<float,2>{0.568967402f, 0.145926178f},
-std::array<float,2>{0.743597627f, 0.639636338f},
-std::array<float,2>{0.378258884f, 0.0326361395f},
-std::array<float,2>{0.00451604743f, 0.832504094f},
-std::array<float,2>{0.806264043f, 0.409655243f},
-std::array<float,2>{0.504426599f, 0.954111099f},
-std::array<float,2>{0.320112169f, 0.333066434f},
-std::array<float,2>{0.154613137f, 0.589514732f},
-std::array<float,2>{0.913689375f, 0.192352086f},
-std::array<float,2>{0.845351756f, 0.743336856f},
-std::array<float,2>{0.0993548408f, 0.124578848f},
-std::array<float,2>{0.486946821f, 0.766402185f},
-std::array<float,2>{0.641411543f, 0.461007327f},
-std::array<float,2>{0.983883023f, 0.842095613f},
-std::array<float,2>{0.206207007f, 0.418117225f},
-std::array<float,2>{0.25269857f, 0.626846015f},
-std::array<float,2>{0.609187424f, 0.0455865562f},
-std::array<float,2>{0.714611471f, 0.505485356f},
-std::array<float,2>{0.430761516f, 0.153186485f},
-std::array<float,2>{0.0577874556f, 0.88081181f},
-std::array<float,2>{0.760826707f, 0.285180837f},
-std::array<float,2>{0.664755702f, 0.793453395f},
-std::array<float,2>{0.441246361f, 0.481226504f},
-std::array<float,2>{0.0762240142f, 0.717193246f},
-std::array<float,2>{0.825960934f, 0.0850058347f},
-std::array<float,2>{0.902844012f, 0.595093429f},
-std::array<float,2>{0.181865007f, 0.233719334f},
-std::array<float,2>{0.374855787f, 0.977436781f},
-std::array<float,2>{0.549746752f, 0.368740469f},
-std::array<float,2>{0.80169189f, 0.926354945f},
-std::array<float,2>{0.0135762487f, 0.271900684f},
-std::array<float,2>{0.387829393f, 0.561969161f},
-std::array<float,2>{0.736004889f, 0.167732805f},
-std::array<float,2>{0.573345065f, 0.665456355f},
-std::array<float,2>{0.297443807f, 0.0243255515f},
-std::array<float,2>{0.221485302f, 0.854900241f},
-std::array<float,2>{0.937671483f, 0.375113159f},
-std::array<float,2>{0.728833795f, 0.890773118f},
-std::array<float,2>{0.405591518f, 0.311755955f},
-std::array<float,2>{0.0160472654f, 0.530897617f},
-std::array<float,2>{0.784185052f, 0.127793983f},
-std::array<float,2>{0.962824225f, 0.642312646f},
-std::array<float,2>{0.240211621f, 0.0493214987f},
-std::array<float,2>{0.287159771f, 0.827343643f},
-std::array<float,2>{0.585208297f, 0.424125344f},
-std::array<float,2>{0.838651001f, 0.764871836f},
-std::array<float,2>{0.0846685842f, 0.439004958f},
-std::array<float,2>{0.461037397f, 0.733863235f},
-std::array<float,2>{0.675461113f, 0.100152224f},
-std::array<float,2>{0.544888318f, 0.571460485f},
-std::array<float,2>{0.359277368f, 0.218504623f},
-std::array<float,2>{0.161966383f, 0.937649727f},
-std::array<float,2>{0.888116002f, 0.314774305f},
-std::array<float,2>{0.619943738f, 0.867631078f},
-std::array<float,2>{0.278354764f, 0.398054481f},
-std::array<float,2>{0.200235948f, 0.677036881f},
-std::array<float,2>{0.986322761f, 0.00298063457f},
-std::array<float,2>{0.777886271f, 0.545589685f},
-std::array<float,2>{0.0317662284f, 0.180413708f},
-std::array<float,2>{0.408969939f, 0.913360059f},
-std::array<float,2>{0.694513083f, 0.264310718f},
-std::array<float,2>{0.935565948f, 0.989111543f},
-std::array<float,2>{0.136782855f, 0.348296762f},
-std::array<float,2>{0.34360528f, 0.622567713f},
-std::array<float,2>{0.523797035f, 0.246179998f},
-std::array<float,2>{0.639162242f, 0.691735387f},
-std::array<float,2>{0.476232409f, 0.0738993064f},
-std::array<float,2>{0.109531991f, 0.811997414f},
-std::array<float,2>{0.863994896f, 0.499489009f},
-std::array<float,2>{0.534166634f, 0.876934648f},
-std::array<float,2>{0.344548464f, 0.28401652f},
-std::array<float,2>{0.166355059f, 0.503777862f},
-std::array<float,2>{0.877166271f, 0.151257738f},
-std::array<float,2>{0.833530545f, 0.630716145f},
-std::array<float,2>{0.0881786868f, 0.0394388661f},
-std::array<float,2>{0.456533343f, 0.836250544f},
-std::array<float,2>{0.685334086f, 0.414710492f},
-std::array<float,2>{0.955044389f, 0.769986689f},
-std::array<float,2>{0.246109694f, 0.466679752f},
-std::array<float,2>{0.293366998f, 0.749667108f},
-std::array<float,2>{0.590685666f, 0.117279932f},
-std::array<float,2>{0.718789756f, 0.592500567f},
-std::array<float,2>{0.396041274f, 0.190504268f},
-std::array<float,2>{0.0265595764f, 0.959919155f},
-std::array<float,2>{0.790851772f, 0.328256637f},
-std::array<float,2>{0.62595135f, 0.858237088f},
-std::array<float,2>{0.478875756f, 0.379832864f},
-std::array<float,2>{0.118941866f, 0.670690894f},
-std::array<float,2>{0.871747315f, 0.0297631156f},
-std::array<float,2>{0.922469378f, 0.555540979f},
-std::array<float,2>{0.128098324f, 0.169343114f},
-std::array<float,2>{0.32841745f, 0.923503816f},
-std::array<float,2>{0.520343542f, 0.269318432f},
-std::array<float,2>{0.768684626f, 0.981170952f},
-std::array<float,2>{0.0449085273f, 0.374140978f},
-std::array<float,2>{0.415821761f, 0.598813295f},
-std::array<float,2>{0.702203095f, 0.226581216f},
-std::array<float,2>{0.615159333f, 0.712216258f},
-std::array<float,2>{0.269676805f, 0.0816555694f},
-std::array<float,2>{0.188250497f, 0.790805876f},
-std::array<float,2>{0.992836475f, 0.477825999f},
-std::array<float,2>{0.71042484f, 0.945112705f},
-std::array<float,2>{0.427741647f, 0.319312304f},
-std::array<float,2>{0.0480345972f, 0.57739538f},
-std::array<float,2>{0.751798213f, 0.211040154f},
-std::array<float,2>{0.96981138f, 0.727453589f},
-std::array<float,2>{0.217671096f, 0.0970437378f},
-std::array<float,2>{0.264466047f, 0.759156883f},
-std::array<float,2>{0.596986175f, 0.441485107f},
-std::array<float,2>{0.85744226f, 0.82246387f},
-std::array<float,2>{0.106668293f, 0.428380489f},
-std::array<float,2>{0.497544169f, 0.647535741f},
-std::array<float,2>{0.655979514f, 0.0529442728f},
-std::array<float,2>{0.508374155f, 0.524933875f},
-std::array<float,2>{0.326056242f, 0.129377007f},
-std::array<float,2>{0.141581133f, 0.896080911f},
-std::array<float,2>{0.920958519f, 0.306402951f},
-std::array<float,2>{0.564254165f, 0.805212677f},
-std::array<float,2>{0.309917152f, 0.494175076f},
-std::array<float,2>{0.232295737f, 0.689788938f},
-std::array<float,2>{0.951748788f, 0.076069966f},
-std::array<float,2>{0.809809387f, 0.619000375f},
-std::array<float,2>{0.00245532161f, 0.243459299f},
-std::array<float,2>{0.379537016f, 0.987213194f},
-std::array<float,2>{0.749018133f, 0.347229183f},
-std::array<float,2>{0.892360449f, 0.906834126f},
-std::array<float,2>{0.175904542f, 0.261050224f},
-std::array<float,2>{0.365546703f, 0.541179538f},
-std::array<float,2>{0.560363412f, 0.186459273f},
-std::array<float,2>{0.661580861f, 0.672374964f},
-std::array<float,2>{0.44874382f, 0.00396234449f},
-std::array<float,2>{0.062553376f, 0.871525228f},
-std::array<float,2>{0.819127619f, 0.392785102f},
-std::array<float,2>{0.603404343f, 0.998376846f},
-std::array<float,2>{0.254301548f, 0.35167262f},
-std::array<float,2>{0.210919857f, 0.611986816f},
-std::array<float,2>{0.977293789f, 0.240578786f},
-std::array<float,2>{0.762707412f, 0.698841572f},
-std::array<float,2>{0.0601940565f, 0.0633325949f},
-std::array<float,2>{0.436908454f, 0.797477126f},
-std::array<float,2>{0.717594147f, 0.490814507f},
-std::array<float,2>{0.907701135f, 0.86437422f},
-std::array<float,2>{0.150192991f, 0.400339991f},
-std::array<float,2>{0.31522125f, 0.680404305f},
-std::array<float,2>{0.502132595f, 0.0137764756f},
-std::array<float,2>{0.644688189f, 0.538508236f},
-std::array<float,2>{0.488559157f, 0.179579809f},
-std::array<float,2>{0.0947882235f, 0.917248726f},
-std::array<float,2>{0.848000944f, 0.250091463f},
-std::array<float,2>{0.739419699f, 0.752553701f},
-std::array<float,2>{0.38413316f, 0.448741138f},
-std::array<float,2>{0.00951666106f, 0.719891846f},
-std::array<float,2>{0.797128797f, 0.103964269f},
-std::array<float,2>{0.943612874f, 0.566708803f},
-std::array<float,2>{0.225029126f, 0.204118386f},
-std::array<float,2>{0.303357035f, 0.948001564f},
-std::array<float,2>{0.575748444f, 0.32202974f},
-std::array<float,2>{0.822802067f, 0.901309133f},
-std::array<float,2>{0.0725493804f, 0.297921568f},
-std::array<float,2>{0.441529304f, 0.518600225f},
-std::array<float,2>{0.669709444f, 0.135360315f},
-std::array<float,2>{0.550993562f, 0.650536954f},
-std::array<float,2>{0.368354559f, 0.0590416081f},
-std::array<float,2>{0.186966911f, 0.818873346f},
-std::array<float,2>{0.900112808f, 0.435803831f},
-std::array<float,2>{0.67615962f, 0.933370054f},
-std::array<float,2>{0.467150003f, 0.279751241f},
-std::array<float,2>{0.0795365646f, 0.550737023f},
-std::array<float,2>{0.843424737f, 0.162767962f},
-std::array<float,2>{0.884887934f, 0.661486268f},
-std::array<float,2>{0.157877177f, 0.0225901846f},
-std::array<float,2>{0.352741688f, 0.846636057f},
-std::array<float,2>{0.542658091f, 0.383738399f},
-std::array<float,2>{0.788114846f, 0.787809014f},
-std::array<float,2>{0.0207004379f, 0.470226556f},
-std::array<float,2>{0.400649101f, 0.710279703f},
-std::array<float,2>{0.733521402f, 0.0886759385f},
-std::array<float,2>{0.579566419f, 0.603214443f},
-std::array<float,2>{0.284960866f, 0.221608594f},
-std::array<float,2>{0.235755339f, 0.9726125f},
-std::array<float,2>{0.966186523f, 0.364169925f},
-std::array<float,2>{0.528392434f, 0.829400837f},
-std::array<float,2>{0.336682498f, 0.411916286f},
-std::array<float,2>{0.133344322f, 0.633722246f},
-std::array<float,2>{0.933509529f, 0.0353493132f},
-std::array<float,2>{0.861994028f, 0.510462046f},
-std::array<float,2>{0.116391234f, 0.14266856f},
-std::array<float,2>{0.470516115f, 0.889602661f},
-std::array<float,2>{0.634672165f, 0.289452255f},
-std::array<float,2>{0.989485383f, 0.96666944f},
-std::array<float,2>{0.197429135f, 0.338364959f},
-std::array<float,2>{0.276515901f, 0.584912419f},
-std::array<float,2>{0.623818994f, 0.195897087f},
-std::array<float,2>{0.689634264f, 0.739043117f},
-std::array<float,2>{0.411317527f, 0.115940183f},
-std::array<float,2>{0.0368962586f, 0.778200448f},
-std::array<float,2>{0.777075946f, 0.455234259f},
-std::array<float,2>{0.610454619f, 0.905932009f},
-std::array<float,2>{0.268279701f, 0.303500146f},
-std::array<float,2>{0.194148704f, 0.522726834f},
-std::array<float,2>{0.998022437f, 0.137415305f},
-std::array<float,2>{0.773272276f, 0.655632854f},
-std::array<float,2>{0.0391371511f, 0.0563402921f},
-std::array<float,2>{0.41998753f, 0.816046536f},
-std::array<float,2>{0.69718492f, 0.432089597f},
-std::array<float,2>{0.927179337f, 0.756201506f},
-std::array<float,2>{0.130087897f, 0.450208575f},
-std::array<float,2>{0.33293587f, 0.723011374f},
-std::array<float,2>{0.518834352f, 0.109032735f},
-std::array<float,2>{0.629169405f, 0.566292584f},
-std::array<float,2>{0.482962251f, 0.210261524f},
-std::array<float,2>{0.124588072f, 0.952998936f},
-std::array<float,2>{0.869192958f, 0.326681048f},
-std::array<float,2>{0.725943506f, 0.861856997f},
-std::array<float,2>{0.393908232f, 0.402479798f},
-std::array<float,2>{0.0297617503f, 0.685912848f},
-std::array<float,2>{0.796796799f, 0.00956776179f},
-std::array<float,2>{0.959978521f, 0.533161104f},
-std::array<float,2>{0.245333061f, 0.174840927f},
-std::array<float,2>{0.292672575f, 0.920035064f},
-std::array<float,2>{0.587389171f, 0.255335629f},
-std::array<float,2>{0.830332756f, 0.992650092f},
-std::array<float,2>{0.0920323282f, 0.359258235f},
-std::array<float,2>{0.460815698f, 0.615640163f},
-std::array<float,2>{0.682143271f, 0.235046759f},
-std::array<float,2>{0.538406432f, 0.699612439f},
-std::array<float,2>{0.349319935f, 0.0668463558f},
-std::array<float,2>{0.170818537f, 0.802949727f},
-std::array<float,2>{0.880295634f, 0.484867454f},
-std::array<float,2>{0.657027602f, 0.962878108f},
-std::array<float,2>{0.45298624f, 0.341875732f},
-std::array<float,2>{0.0682289153f, 0.580115855f},
-std::array<float,2>{0.813017666f, 0.200498268f},
-std::array<float,2>{0.89819032f, 0.736351311f},
-std::array<float,2>{0.172537386f, 0.110448003f},
-std::array<float,2>{0.359495878f, 0.775916874f},
-std::array<float,2>{0.555251658f, 0.459507316f},
-std::array<float,2>{0.807615221f, 0.835825562f},
-std::array<float,2>{0.00594966812f, 0.40781936f},
-std::array<float,2>{0.375053197f, 0.638318062f},
-std::array<float,2>{0.744157016f, 0.0344952829f},
-std::array<float,2>{0.567466378f, 0.51469481f},
-std::array<float,2>{0.306028903f, 0.146674111f},
-std::array<float,2>{0.229986608f, 0.884651363f},
-std::array<float,2>{0.94921273f, 0.29366976f},
-std::array<float,2>{0.514818847f, 0.78304249f},
-std::array<float,2>{0.320599049f, 0.476533115f},
-std::array<float,2>{0.146498859f, 0.703275502f},
-std::array<float,2>{0.914172173f, 0.0915862694f},
-std::array<float,2>{0.852998853f, 0.608536065f},
-std::array<float,2>{0.102444082f, 0.223091856f},
-std::array<float,2>{0.493541718f, 0.975572109f},
-std::array<float,2>{0.650485933f, 0.359406829f},
-std::array<float,2>{0.974015176f, 0.935690463f},
-std::array<float,2>{0.214505434f, 0.275533378f},
-std::array<float,2>{0.258952558f, 0.553115904f},
-std::array<float,2>{0.600877941f, 0.159878731f},
-std::array<float,2>{0.703335762f, 0.656763852f},
-std::array<float,2>{0.424056143f, 0.0177123379f},
-std::array<float,2>{0.0543216653f, 0.85083586f},
-std::array<float,2>{0.757381499f, 0.388404638f},
-std::array<float,2>{0.547086596f, 0.978578627f},
-std::array<float,2>{0.371492922f, 0.369682997f},
-std::array<float,2>{0.179767504f, 0.596744359f},
-std::array<float,2>{0.905976415f, 0.230813503f},
-std::array<float,2>{0.827073753f, 0.716502786f},
-std::array<float,2>{0.0753643215f, 0.0833292454f},
-std::array<float,2>{0.439265072f, 0.795940757f},
-std::array<float,2>{0.66724205f, 0.482872128f},
-std::array<float,2>{0.939728498f, 0.853336513f},
-std::array<float,2>{0.219654918f, 0.377129853f},
-std::array<float,2>{0.299406856f, 0.667123973f},
-std::array<float,2>{0.570697784f, 0.0271583628f},
-std::array<float,2>{0.736798763f, 0.559038103f},
-std::array<float,2>{0.389763653f, 0.165548161f},
-std::array<float,2>{0.0138830012f, 0.929239929f},
-std::array<float,2>{0.804254174f, 0.270273656f},
-std::array<float,2>{0.643333137f, 0.768924415f},
-std::array<float,2>{0.486004472f, 0.463268578f},
-std::array<float,2>{0.101056568f, 0.745567203f},
-std::array<float,2>{0.846568763f, 0.121869668f},
-std::array<float,2>{0.911141098f, 0.586693645f},
-std::array<float,2>{0.153319731f, 0.194021001f},
-std::array<float,2>{0.317201972f, 0.955960631f},
-std::array<float,2>{0.506868422f, 0.335810006f},
-std::array<float,2>{0.759735584f, 0.88257426f},
-std::array<float,2>{0.0566300191f, 0.288072258f},
-std::array<float,2>{0.432670057f, 0.506673634f},
-std::array<float,2>{0.711722553f, 0.155486479f},
-std::array<float,2>{0.606348574f, 0.628829777f},
-std::array<float,2>{0.250487357f, 0.0430640243f},
-std::array<float,2>{0.204846203f, 0.84085691f},
-std::array<float,2>{0.981056929f, 0.420934469f},
-std::array<float,2>{0.691432714f, 0.911841094f},
-std::array<float,2>{0.407963872f, 0.261801392f},
-std::array<float,2>{0.0337319672f, 0.544449985f},
-std::array<float,2>{0.779915631f, 0.18243818f},
-std::array<float,2>{0.986772537f, 0.678586781f},
-std::array<float,2>{0.202493131f, 9.5523581e-05f},
-std::array<float,2>{0.281180322f, 0.869880915f},
-std::array<float,2>{0.619099021f, 0.394575536f},
-std::array<float,2>{0.866638362f, 0.809144616f},
-std::array<float,2>{0.112051949f, 0.497424513f},
-std::array<float,2>{0.473296463f, 0.693435907f},
-std::array<float,2>{0.637548625f, 0.071238555f},
-std::array<float,2>{0.527238011f, 0.624414802f},
-std::array<float,2>{0.341658443f, 0.248676196f},
-std::array<float,2>{0.138845488f, 0.990240633f},
-std::array<float,2>{0.935431123f, 0.349749327f},
-std::array<float,2>{0.583099365f, 0.824707627f},
-std::array<float,2>{0.285659611f, 0.422003508f},
-std::array<float,2>{0.241187662f, 0.644530714f},
-std::array<float,2>{0.963163674f, 0.0487908572f},
-std::array<float,2>{0.781551242f, 0.528737843f},
-std::array<float,2>{0.0176213998f, 0.125217691f},
-std::array<float,2>{0.402917385f, 0.893051147f},
-std::array<float,2>{0.726869583f, 0.310262144f},
-std::array<float,2>{0.889818966f, 0.940418124f},
-std::array<float,2>{0.162207797f, 0.313889444f},
-std::array<float,2>{0.356535614f, 0.572493792f},
-std::array<float,2>{0.546035051f, 0.215967819f},
-std::array<float,2>{0.672115386f, 0.730642915f},
-std::array<float,2>{0.463772923f, 0.0979204476f},
-std::array<float,2>{0.0822365582f, 0.763223469f},
-std::array<float,2>{0.837053418f, 0.44085741f},
-std::array<float,2>{0.521631777f, 0.924335301f},
-std::array<float,2>{0.331367254f, 0.266441911f},
-std::array<float,2>{0.126679182f, 0.557629347f},
-std::array<float,2>{0.924855173f, 0.169985503f},
-std::array<float,2>{0.873097658f, 0.668868482f},
-std::array<float,2>{0.119836576f, 0.0289822463f},
-std::array<float,2>{0.477019846f, 0.856763482f},
-std::array<float,2>{0.62744379f, 0.381535023f},
-std::array<float,2>{0.994603097f, 0.791752219f},
-std::array<float,2>{0.190423638f, 0.478640407f},
-std::array<float,2>{0.273180306f, 0.713279724f},
-std::array<float,2>{0.616945446f, 0.0781970695f},
-std::array<float,2>{0.699720323f, 0.599925399f},
-std::array<float,2>{0.417146146f, 0.229833961f},
-std::array<float,2>{0.0450782701f, 0.984208941f},
-std::array<float,2>{0.766685009f, 0.371562034f},
-std::array<float,2>{0.686628938f, 0.839278281f},
-std::array<float,2>{0.454712957f, 0.416707993f},
-std::array<float,2>{0.0864126235f, 0.63108182f},
-std::array<float,2>{0.834396362f, 0.0425092801f},
-std::array<float,2>{0.875141799f, 0.500031948f},
-std::array<float,2>{0.164754003f, 0.149229303f},
-std::array<float,2>{0.347291797f, 0.877121449f},
-std::array<float,2>{0.531799734f, 0.282023609f},
-std::array<float,2>{0.792690814f, 0.95719862f},
-std::array<float,2>{0.0237869695f, 0.330475241f},
-std::array<float,2>{0.397082001f, 0.59136343f},
-std::array<float,2>{0.720963657f, 0.189180151f},
-std::array<float,2>{0.593398273f, 0.746988595f},
-std::array<float,2>{0.296230227f, 0.119222909f},
-std::array<float,2>{0.249384299f, 0.772883654f},
-std::array<float,2>{0.956508875f, 0.468245804f},
-std::array<float,2>{0.747568727f, 0.986018717f},
-std::array<float,2>{0.381028622f, 0.344614029f},
-std::array<float,2>{0.000252076308f, 0.620615721f},
-std::array<float,2>{0.811062634f, 0.245049268f},
-std::array<float,2>{0.950035334f, 0.689140618f},
-std::array<float,2>{0.233257517f, 0.0766855329f},
-std::array<float,2>{0.312321186f, 0.808525264f},
-std::array<float,2>{0.565369487f, 0.492408305f},
-std::array<float,2>{0.817805767f, 0.874351382f},
-std::array<float,2>{0.0656214952f, 0.391740531f},
-std::array<float,2>{0.446468174f, 0.673930883f},
-std::array<float,2>{0.662524283f, 0.00600879826f},
-std::array<float,2>{0.560598314f, 0.540302992f},
-std::array<float,2>{0.364525408f, 0.185411304f},
-std::array<float,2>{0.179663345f, 0.910077691f},
-std::array<float,2>{0.894009829f, 0.258800119f},
-std::array<float,2>{0.59477371f, 0.759895802f},
-std::array<float,2>{0.262752086f, 0.444584757f},
-std::array<float,2>{0.216608033f, 0.728660166f},
-std::array<float,2>{0.97140187f, 0.0945099071f},
-std::array<float,2>{0.752421737f, 0.574527144f},
-std::array<float,2>{0.0501452722f, 0.213743642f},
-std::array<float,2>{0.427487016f, 0.941652238f},
-std::array<float,2>{0.708655357f, 0.317809254f},
-std::array<float,2>{0.919821322f, 0.89688164f},
-std::array<float,2>{0.143286675f, 0.306920737f},
-std::array<float,2>{0.326943249f, 0.526327193f},
-std::array<float,2>{0.51091063f, 0.132192582f},
-std::array<float,2>{0.652896225f, 0.645766437f},
-std::array<float,2>{0.499722093f, 0.0510945581f},
-std::array<float,2>{0.10811197f, 0.822052717f},
-std::array<float,2>{0.856461406f, 0.427475721f},
-std::array<float,2>{0.577943206f, 0.945713758f},
-std::array<float,2>{0.300786465f, 0.324017733f},
-std::array<float,2>{0.224462867f, 0.569295585f},
-std::array<float,2>{0.942573011f, 0.205144659f},
-std::array<float,2>{0.799527168f, 0.722490728f},
-std::array<float,2>{0.0101280436f, 0.102048799f},
-std::array<float,2>{0.386340946f, 0.751550555f},
-std::array<float,2>{0.741976321f, 0.446124345f},
-std::array<float,2>{0.901260674f, 0.817520022f},
-std::array<float,2>{0.184389472f, 0.435219795f},
-std::array<float,2>{0.370236307f, 0.648557961f},
-std::array<float,2>{0.553681195f, 0.0610609241f},
-std::array<float,2>{0.671588123f, 0.515811443f},
-std::array<float,2>{0.443611026f, 0.13460578f},
-std::array<float,2>{0.0721749365f, 0.899468005f},
-std::array<float,2>{0.821771681f, 0.298930794f},
-std::array<float,2>{0.715851367f, 0.799726844f},
-std::array<float,2>{0.43517518f, 0.488414854f},
-std::array<float,2>{0.0609035082f, 0.696722686f},
-std::array<float,2>{0.764739037f, 0.0649355426f},
-std::array<float,2>{0.978536665f, 0.609587252f},
-std::array<float,2>{0.2076381f, 0.238405898f},
-std::array<float,2>{0.256676704f, 0.996295273f},
-std::array<float,2>{0.605150461f, 0.354611069f},
-std::array<float,2>{0.85019058f, 0.915036261f},
-std::array<float,2>{0.0973042473f, 0.252538711f},
-std::array<float,2>{0.491472155f, 0.536627233f},
-std::array<float,2>{0.648371994f, 0.177014202f},
-std::array<float,2>{0.501419246f, 0.683455288f},
-std::array<float,2>{0.313671231f, 0.0130139524f},
-std::array<float,2>{0.151638553f, 0.865824938f},
-std::array<float,2>{0.909440696f, 0.400973588f},
-std::array<float,2>{0.635661006f, 0.887530506f},
-std::array<float,2>{0.472109914f, 0.29171294f},
-std::array<float,2>{0.114868887f, 0.509174526f},
-std::array<float,2>{0.860934079f, 0.142037705f},
-std::array<float,2>{0.929851353f, 0.635135353f},
-std::array<float,2>{0.136377081f, 0.0380532704f},
-std::array<float,2>{0.338989794f, 0.830228269f},
-std::array<float,2>{0.5306651f, 0.412580073f},
-std::array<float,2>{0.774333596f, 0.780386865f},
-std::array<float,2>{0.0387244448f, 0.453990042f},
-std::array<float,2>{0.413923502f, 0.741305411f},
-std::array<float,2>{0.687816918f, 0.113872141f},
-std::array<float,2>{0.621448934f, 0.583879471f},
-std::array<float,2>{0.273713917f, 0.198076174f},
-std::array<float,2>{0.195846617f, 0.967120111f},
-std::array<float,2>{0.991802931f, 0.336453021f},
-std::array<float,2>{0.53923136f, 0.84442246f},
-std::array<float,2>{0.354875147f, 0.386710644f},
-std::array<float,2>{0.159158468f, 0.663636208f},
-std::array<float,2>{0.883654356f, 0.0200697072f},
-std::array<float,2>{0.840766788f, 0.548420429f},
-std::array<float,2>{0.080262512f, 0.160403386f},
-std::array<float,2>{0.4659549f, 0.930012167f},
-std::array<float,2>{0.679471016f, 0.279012352f},
-std::array<float,2>{0.967324197f, 0.969798148f},
-std::array<float,2>{0.236664936f, 0.365957588f},
-std::array<float,2>{0.28252545f, 0.603541672f},
-std::array<float,2>{0.581508934f, 0.219129011f},
-std::array<float,2>{0.732063174f, 0.707108378f},
-std::array<float,2>{0.399218708f, 0.0864712521f},
-std::array<float,2>{0.0232011247f, 0.78542918f},
-std::array<float,2>{0.785664678f, 0.471046239f},
-std::array<float,2>{0.570291698f, 0.883413732f},
-std::array<float,2>{0.306718141f, 0.294604242f},
-std::array<float,2>{0.227407604f, 0.513718009f},
-std::array<float,2>{0.946905136f, 0.147689745f},
-std::array<float,2>{0.804903448f, 0.636987567f},
-std::array<float,2>{0.00554101961f, 0.0341283269f},
-std::array<float,2>{0.377711594f, 0.834843159f},
-std::array<float,2>{0.743092358f, 0.406436652f},
-std::array<float,2>{0.895738721f, 0.777005851f},
-std::array<float,2>{0.175021112f, 0.460729033f},
-std::array<float,2>{0.362978458f, 0.737866044f},
-std::array<float,2>{0.557113767f, 0.110336363f},
-std::array<float,2>{0.659857273f, 0.58172518f},
-std::array<float,2>{0.450204194f, 0.199247688f},
-std::array<float,2>{0.0701912791f, 0.961738229f},
-std::array<float,2>{0.81504631f, 0.343085974f},
-std::array<float,2>{0.70554769f, 0.850052357f},
-std::array<float,2>{0.422218859f, 0.387639672f},
-std::array<float,2>{0.0517203733f, 0.658111751f},
-std::array<float,2>{0.755475402f, 0.0192040447f},
-std::array<float,2>{0.976186931f, 0.554347813f},
-std::array<float,2>{0.212506831f, 0.15893659f},
-std::array<float,2>{0.261654317f, 0.936926484f},
-std::array<float,2>{0.598509252f, 0.276519239f},
-std::array<float,2>{0.855068624f, 0.97578007f},
-std::array<float,2>{0.104366593f, 0.361021399f},
-std::array<float,2>{0.494191587f, 0.60806942f},
-std::array<float,2>{0.649152637f, 0.224181756f},
-std::array<float,2>{0.512841165f, 0.704848289f},
-std::array<float,2>{0.322475374f, 0.0903137252f},
-std::array<float,2>{0.144748628f, 0.782048285f},
-std::array<float,2>{0.917561114f, 0.474862248f},
-std::array<float,2>{0.630952179f, 0.951515019f},
-std::array<float,2>{0.482217908f, 0.327417344f},
-std::array<float,2>{0.122963078f, 0.564990699f},
-std::array<float,2>{0.867468119f, 0.209821224f},
-std::array<float,2>{0.929424822f, 0.724473715f},
-std::array<float,2>{0.132023111f, 0.107425727f},
-std::array<float,2>{0.335686803f, 0.757422447f},
-std::array<float,2>{0.516004443f, 0.450076312f},
-std::array<float,2>{0.770690024f, 0.81493777f},
-std::array<float,2>{0.0414467119f, 0.433426619f},
-std::array<float,2>{0.419534504f, 0.654725492f},
-std::array<float,2>{0.698924184f, 0.0554289408f},
-std::array<float,2>{0.613145709f, 0.521497905f},
-std::array<float,2>{0.266067713f, 0.137929454f},
-std::array<float,2>{0.191615865f, 0.905162632f},
-std::array<float,2>{0.998416126f, 0.304045022f},
-std::array<float,2>{0.536611438f, 0.804191649f},
-std::array<float,2>{0.35037449f, 0.486124277f},
-std::array<float,2>{0.168826982f, 0.701032102f},
-std::array<float,2>{0.882016957f, 0.0681099221f},
-std::array<float,2>{0.829058647f, 0.616287589f},
-std::array<float,2>{0.0901043266f, 0.235854119f},
-std::array<float,2>{0.458910406f, 0.993811488f},
-std::array<float,2>{0.68062216f, 0.357891619f},
-std::array<float,2>{0.958154321f, 0.921687901f},
-std::array<float,2>{0.242556795f, 0.253995031f},
-std::array<float,2>{0.290668637f, 0.531668603f},
-std::array<float,2>{0.589608431f, 0.174341038f},
-std::array<float,2>{0.723569632f, 0.687039137f},
-std::array<float,2>{0.39206183f, 0.0082142055f},
-std::array<float,2>{0.0279408805f, 0.863050222f},
-std::array<float,2>{0.793037534f, 0.403327644f},
-std::array<float,2>{0.525353968f, 0.991303921f},
-std::array<float,2>{0.34245649f, 0.350624472f},
-std::array<float,2>{0.137700826f, 0.623082042f},
-std::array<float,2>{0.937409639f, 0.249136046f},
-std::array<float,2>{0.864515066f, 0.694788098f},
-std::array<float,2>{0.111170813f, 0.0720332339f},
-std::array<float,2>{0.474660009f, 0.809927166f},
-std::array<float,2>{0.640467763f, 0.496936351f},
-std::array<float,2>{0.984903812f, 0.870900393f},
-std::array<float,2>{0.199678496f, 0.395976216f},
-std::array<float,2>{0.277465373f, 0.678917587f},
-std::array<float,2>{0.620218456f, 0.00148981181f},
-std::array<float,2>{0.693423986f, 0.543682039f},
-std::array<float,2>{0.409700036f, 0.183553606f},
-std::array<float,2>{0.0322870128f, 0.910356343f},
-std::array<float,2>{0.778679192f, 0.263188124f},
-std::array<float,2>{0.673999369f, 0.762057602f},
-std::array<float,2>{0.462808788f, 0.439947069f},
-std::array<float,2>{0.0858383551f, 0.731938303f},
-std::array<float,2>{0.839332521f, 0.0987370387f},
-std::array<float,2>{0.886999905f, 0.573329628f},
-std::array<float,2>{0.16031374f, 0.215620369f},
-std::array<float,2>{0.357442468f, 0.940980494f},
-std::array<float,2>{0.542970955f, 0.313337803f},
-std::array<float,2>{0.783271015f, 0.89359051f},
-std::array<float,2>{0.0166415926f, 0.30871737f},
-std::array<float,2>{0.40467608f, 0.527593076f},
-std::array<float,2>{0.729537189f, 0.126674771f},
-std::array<float,2>{0.584911466f, 0.643215001f},
-std::array<float,2>{0.288839251f, 0.0473775752f},
-std::array<float,2>{0.239153653f, 0.825883389f},
-std::array<float,2>{0.961302459f, 0.422920823f},
-std::array<float,2>{0.734601438f, 0.927924037f},
-std::array<float,2>{0.386720687f, 0.27139467f},
-std::array<float,2>{0.0120970123f, 0.559684634f},
-std::array<float,2>{0.802298307f, 0.164897248f},
-std::array<float,2>{0.938532829f, 0.66667062f},
-std::array<float,2>{0.222096846f, 0.0259243008f},
-std::array<float,2>{0.298488766f, 0.851877034f},
-std::array<float,2>{0.572682738f, 0.378400713f},
-std::array<float,2>{0.825128615f, 0.795251727f},
-std::array<float,2>{0.0777600184f, 0.48347488f},
-std::array<float,2>{0.440175742f, 0.714892864f},
-std::array<float,2>{0.665340662f, 0.0821499527f},
-std::array<float,2>{0.549999356f, 0.59650135f},
-std::array<float,2>{0.373772293f, 0.232172936f},
-std::array<float,2>{0.183364853f, 0.979849219f},
-std::array<float,2>{0.904157281f, 0.37092495f},
-std::array<float,2>{0.608002067f, 0.84074825f},
-std::array<float,2>{0.253600478f, 0.420891553f},
-std::array<float,2>{0.205651671f, 0.627366662f},
-std::array<float,2>{0.98282963f, 0.0439816564f},
-std::array<float,2>{0.759810209f, 0.507108569f},
-std::array<float,2>{0.0569476224f, 0.154655814f},
-std::array<float,2>{0.430373013f, 0.881505191f},
-std::array<float,2>{0.713745832f, 0.288475513f},
-std::array<float,2>{0.912424862f, 0.956152081f},
-std::array<float,2>{0.156249434f, 0.334597737f},
-std::array<float,2>{0.31837365f, 0.587177932f},
-std::array<float,2>{0.504981816f, 0.194869131f},
-std::array<float,2>{0.64194411f, 0.745107532f},
-std::array<float,2>{0.488147229f, 0.122395389f},
-std::array<float,2>{0.098451741f, 0.767732739f},
-std::array<float,2>{0.844369233f, 0.46476993f},
-std::array<float,2>{0.559264243f, 0.908968925f},
-std::array<float,2>{0.366880745f, 0.25829494f},
-std::array<float,2>{0.177065209f, 0.539761484f},
-std::array<float,2>{0.890732586f, 0.183947012f},
-std::array<float,2>{0.820228696f, 0.675542533f},
-std::array<float,2>{0.0636059493f, 0.00735418405f},
-std::array<float,2>{0.447534531f, 0.873389721f},
-std::array<float,2>{0.660689473f, 0.39111641f},
-std::array<float,2>{0.952742159f, 0.807511628f},
-std::array<float,2>{0.231371313f, 0.49394685f},
-std::array<float,2>{0.308867425f, 0.688216746f},
-std::array<float,2>{0.562750697f, 0.0775078312f},
-std::array<float,2>{0.749236941f, 0.61928159f},
-std::array<float,2>{0.380577683f, 0.245552793f},
-std::array<float,2>{0.00329520204f, 0.984402716f},
-std::array<float,2>{0.809230089f, 0.34504953f},
-std::array<float,2>{0.655055761f, 0.820447624f},
-std::array<float,2>{0.496643543f, 0.426685482f},
-std::array<float,2>{0.105602019f, 0.644532442f},
-std::array<float,2>{0.858943939f, 0.0517608225f},
-std::array<float,2>{0.920058846f, 0.52653563f},
-std::array<float,2>{0.142417312f, 0.131552383f},
-std::array<float,2>{0.324333489f, 0.897660077f},
-std::array<float,2>{0.509176016f, 0.30839476f},
-std::array<float,2>{0.750107706f, 0.942438483f},
-std::array<float,2>{0.047306478f, 0.316610187f},
-std::array<float,2>{0.42894271f, 0.576055825f},
-std::array<float,2>{0.709342599f, 0.213965878f},
-std::array<float,2>{0.5959993f, 0.729720473f},
-std::array<float,2>{0.264739901f, 0.0954686105f},
-std::array<float,2>{0.217935771f, 0.761542737f},
-std::array<float,2>{0.969348073f, 0.443472862f},
-std::array<float,2>{0.701887012f, 0.98314625f},
-std::array<float,2>{0.414755195f, 0.372104883f},
-std::array<float,2>{0.0429709256f, 0.600948453f},
-std::array<float,2>{0.768083453f, 0.229031965f},
-std::array<float,2>{0.993429542f, 0.714349806f},
-std::array<float,2>{0.188827813f, 0.0795473978f},
-std::array<float,2>{0.271355897f, 0.792865157f},
-std::array<float,2>{0.614219368f, 0.479633898f},
-std::array<float,2>{0.87234807f, 0.855689108f},
-std::array<float,2>{0.11770881f, 0.382431149f},
-std::array<float,2>{0.480302811f, 0.669494987f},
-std::array<float,2>{0.626751423f, 0.0282304343f},
-std::array<float,2>{0.521084905f, 0.557566643f},
-std::array<float,2>{0.329473019f, 0.171161696f},
-std::array<float,2>{0.127536178f, 0.925666392f},
-std::array<float,2>{0.923764825f, 0.267207146f},
-std::array<float,2>{0.591453314f, 0.771554351f},
-std::array<float,2>{0.294159442f, 0.467048079f},
-std::array<float,2>{0.247758687f, 0.747803092f},
-std::array<float,2>{0.95358777f, 0.120128796f},
-std::array<float,2>{0.789618671f, 0.590122044f},
-std::array<float,2>{0.0259746592f, 0.187820032f},
-std::array<float,2>{0.395337075f, 0.958584011f},
-std::array<float,2>{0.719857454f, 0.332000017f},
-std::array<float,2>{0.87890619f, 0.878255248f},
-std::array<float,2>{0.167697638f, 0.282275468f},
-std::array<float,2>{0.344842792f, 0.50166899f},
-std::array<float,2>{0.534492075f, 0.149576426f},
-std::array<float,2>{0.684373021f, 0.632298529f},
-std::array<float,2>{0.455473721f, 0.0413097665f},
-std::array<float,2>{0.0897390842f, 0.838317156f},
-std::array<float,2>{0.832318902f, 0.41782558f},
-std::array<float,2>{0.624314964f, 0.968220294f},
-std::array<float,2>{0.275655687f, 0.337594718f},
-std::array<float,2>{0.198420271f, 0.582760274f},
-std::array<float,2>{0.988828421f, 0.19899793f},
-std::array<float,2>{0.776100218f, 0.74073559f},
-std::array<float,2>{0.0355401486f, 0.114620581f},
-std::array<float,2>{0.410929561f, 0.77969557f},
-std::array<float,2>{0.691390514f, 0.454538494f},
-std::array<float,2>{0.931643128f, 0.831202269f},
-std::array<float,2>{0.13410455f, 0.413537174f},
-std::array<float,2>{0.337353587f, 0.636626422f},
-std::array<float,2>{0.527811766f, 0.0381895974f},
-std::array<float,2>{0.632903934f, 0.507948756f},
-std::array<float,2>{0.469575465f, 0.141385645f},
-std::array<float,2>{0.115565673f, 0.888616145f},
-std::array<float,2>{0.862688839f, 0.292749316f},
-std::array<float,2>{0.732604861f, 0.786319315f},
-std::array<float,2>{0.401467264f, 0.472205967f},
-std::array<float,2>{0.0200047866f, 0.708149672f},
-std::array<float,2>{0.787224531f, 0.0876764208f},
-std::array<float,2>{0.965146363f, 0.605402291f},
-std::array<float,2>{0.234712839f, 0.22067754f},
-std::array<float,2>{0.283893734f, 0.969724059f},
-std::array<float,2>{0.579002917f, 0.367143542f},
-std::array<float,2>{0.842004359f, 0.931496203f},
-std::array<float,2>{0.0784432217f, 0.277645618f},
-std::array<float,2>{0.468205541f, 0.547218084f},
-std::array<float,2>{0.677494466f, 0.161402643f},
-std::array<float,2>{0.541420877f, 0.662605405f},
-std::array<float,2>{0.352376193f, 0.0214136224f},
-std::array<float,2>{0.156387582f, 0.845003963f},
-std::array<float,2>{0.88581264f, 0.385408849f},
-std::array<float,2>{0.668563902f, 0.898980081f},
-std::array<float,2>{0.442953229f, 0.300429016f},
-std::array<float,2>{0.0734450817f, 0.517057955f},
-std::array<float,2>{0.823745191f, 0.132952869f},
-std::array<float,2>{0.898764074f, 0.649749637f},
-std::array<float,2>{0.186438665f, 0.0622978434f},
-std::array<float,2>{0.368044525f, 0.817082703f},
-std::array<float,2>{0.551901162f, 0.433953434f},
-std::array<float,2>{0.798131108f, 0.750043154f},
-std::array<float,2>{0.00847166218f, 0.447093278f},
-std::array<float,2>{0.38352406f, 0.720852494f},
-std::array<float,2>{0.738984108f, 0.103197858f},
-std::array<float,2>{0.575038791f, 0.569519162f},
-std::array<float,2>{0.304136485f, 0.206446052f},
-std::array<float,2>{0.226516262f, 0.946607649f},
-std::array<float,2>{0.945257068f, 0.323172063f},
-std::array<float,2>{0.503802299f, 0.866716146f},
-std::array<float,2>{0.315853685f, 0.401509225f},
-std::array<float,2>{0.149286091f, 0.682439804f},
-std::array<float,2>{0.90694207f, 0.0125708766f},
-std::array<float,2>{0.849016964f, 0.535366893f},
-std::array<float,2>{0.0941251293f, 0.176643521f},
-std::array<float,2>{0.489542931f, 0.915987968f},
-std::array<float,2>{0.645969689f, 0.253742039f},
-std::array<float,2>{0.978210509f, 0.997805297f},
-std::array<float,2>{0.209567443f, 0.353880942f},
-std::array<float,2>{0.255144954f, 0.6103971f},
-std::array<float,2>{0.601702094f, 0.239490643f},
-std::array<float,2>{0.718151867f, 0.695382357f},
-std::array<float,2>{0.436317831f, 0.0660936832f},
-std::array<float,2>{0.0589244515f, 0.79990685f},
-std::array<float,2>{0.762454987f, 0.49012199f},
-std::array<float,2>{0.5998649f, 0.93510896f},
-std::array<float,2>{0.258081734f, 0.275362015f},
-std::array<float,2>{0.213823587f, 0.551498175f},
-std::array<float,2>{0.973232269f, 0.157010779f},
-std::array<float,2>{0.756133914f, 0.65835011f},
-std::array<float,2>{0.0532526709f, 0.0173539277f},
-std::array<float,2>{0.425724506f, 0.848233759f},
-std::array<float,2>{0.70484376f, 0.389237195f},
-std::array<float,2>{0.915672362f, 0.783566535f},
-std::array<float,2>{0.147562116f, 0.472661436f},
-std::array<float,2>{0.321734875f, 0.707012296f},
-std::array<float,2>{0.514330864f, 0.0933589041f},
-std::array<float,2>{0.65183121f, 0.607137263f},
-std::array<float,2>{0.493122786f, 0.225043014f},
-std::array<float,2>{0.102876008f, 0.97377044f},
-std::array<float,2>{0.852210402f, 0.361733139f},
-std::array<float,2>{0.745371819f, 0.833099186f},
-std::array<float,2>{0.376047641f, 0.40881893f},
-std::array<float,2>{0.00778486766f, 0.639904141f},
-std::array<float,2>{0.808059633f, 0.0321430154f},
-std::array<float,2>{0.947585642f, 0.512803137f},
-std::array<float,2>{0.228552908f, 0.145174399f},
-std::array<float,2>{0.305463582f, 0.885450423f},
-std::array<float,2>{0.566798687f, 0.296561003f},
-std::array<float,2>{0.814182758f, 0.96326077f},
-std::array<float,2>{0.0671794191f, 0.33997339f},
-std::array<float,2>{0.451764733f, 0.578334093f},
-std::array<float,2>{0.657663107f, 0.202252418f},
-std::array<float,2>{0.556168735f, 0.735525846f},
-std::array<float,2>{0.360665917f, 0.112191804f},
-std::array<float,2>{0.17334938f, 0.774455786f},
-std::array<float,2>{0.897326887f, 0.458313406f},
-std::array<float,2>{0.682802677f, 0.995157301f},
-std::array<float,2>{0.459360361f, 0.356694281f},
-std::array<float,2>{0.0932579637f, 0.615135074f},
-std::array<float,2>{0.831218719f, 0.237191603f},
-std::array<float,2>{0.879367054f, 0.701919258f},
-std::array<float,2>{0.171767443f, 0.0700351372f},
-std::array<float,2>{0.347775996f, 0.801834345f},
-std::array<float,2>{0.537870824f, 0.488130838f},
-std::array<float,2>{0.795747817f, 0.860812128f},
-std::array<float,2>{0.030832978f, 0.405047119f},
-std::array<float,2>{0.392844349f, 0.685082018f},
-std::array<float,2>{0.725310564f, 0.0106140804f},
-std::array<float,2>{0.586278319f, 0.53441155f},
-std::array<float,2>{0.29144448f, 0.173300788f},
-std::array<float,2>{0.244815424f, 0.919068456f},
-std::array<float,2>{0.95961684f, 0.256880611f},
-std::array<float,2>{0.517798483f, 0.754864335f},
-std::array<float,2>{0.33377102f, 0.45181793f},
-std::array<float,2>{0.129506513f, 0.724935353f},
-std::array<float,2>{0.926694751f, 0.105533056f},
-std::array<float,2>{0.871011138f, 0.563456953f},
-std::array<float,2>{0.123067252f, 0.207258046f},
-std::array<float,2>{0.484272391f, 0.95065999f},
-std::array<float,2>{0.630702198f, 0.325090855f},
-std::array<float,2>{0.996951759f, 0.903016269f},
-std::array<float,2>{0.19496274f, 0.302101195f},
-std::array<float,2>{0.268989354f, 0.520268202f},
-std::array<float,2>{0.610176027f, 0.139175713f},
-std::array<float,2>{0.695484757f, 0.653107822f},
-std::array<float,2>{0.421545357f, 0.0570169576f},
-std::array<float,2>{0.0406963937f, 0.813201189f},
-std::array<float,2>{0.772284448f, 0.430710405f},
-std::array<float,2>{0.545303404f, 0.938484192f},
-std::array<float,2>{0.356253535f, 0.315578103f},
-std::array<float,2>{0.163524538f, 0.5705235f},
-std::array<float,2>{0.889607668f, 0.216809705f},
-std::array<float,2>{0.836339712f, 0.732875705f},
-std::array<float,2>{0.0837469473f, 0.100622669f},
-std::array<float,2>{0.464263797f, 0.76394105f},
-std::array<float,2>{0.673505485f, 0.438431442f},
-std::array<float,2>{0.964469373f, 0.827139854f},
-std::array<float,2>{0.24203214f, 0.425157845f},
-std::array<float,2>{0.28679657f, 0.640884995f},
-std::array<float,2>{0.582612038f, 0.0499176309f},
-std::array<float,2>{0.727663934f, 0.530145466f},
-std::array<float,2>{0.403999209f, 0.128721371f},
-std::array<float,2>{0.018865481f, 0.891626477f},
-std::array<float,2>{0.782271802f, 0.311091453f},
-std::array<float,2>{0.638010144f, 0.810770988f},
-std::array<float,2>{0.474170208f, 0.498053163f},
-std::array<float,2>{0.112803154f, 0.69266057f},
-std::array<float,2>{0.865443408f, 0.0731970444f},
-std::array<float,2>{0.9337641f, 0.621150255f},
-std::array<float,2>{0.14042832f, 0.247576073f},
-std::array<float,2>{0.339915127f, 0.989688039f},
-std::array<float,2>{0.526216149f, 0.348642498f},
-std::array<float,2>{0.781130135f, 0.912653506f},
-std::array<float,2>{0.0342885256f, 0.265212864f},
-std::array<float,2>{0.406585068f, 0.546009541f},
-std::array<float,2>{0.692933798f, 0.181014687f},
-std::array<float,2>{0.617291152f, 0.676115572f},
-std::array<float,2>{0.279742658f, 0.00286412914f},
-std::array<float,2>{0.201594695f, 0.868380725f},
-std::array<float,2>{0.987576604f, 0.396592617f},
-std::array<float,2>{0.712638915f, 0.879778147f},
-std::array<float,2>{0.432500362f, 0.286981642f},
-std::array<float,2>{0.0553498603f, 0.504431903f},
-std::array<float,2>{0.758032382f, 0.153686032f},
-std::array<float,2>{0.982114494f, 0.625224113f},
-std::array<float,2>{0.203365758f, 0.0462067239f},
-std::array<float,2>{0.251664698f, 0.843251646f},
-std::array<float,2>{0.606984973f, 0.419204623f},
-std::array<float,2>{0.846834004f, 0.766824305f},
-std::array<float,2>{0.100469463f, 0.462490529f},
-std::array<float,2>{0.485272557f, 0.742843807f},
-std::array<float,2>{0.643745959f, 0.123187035f},
-std::array<float,2>{0.506685555f, 0.587930262f},
-std::array<float,2>{0.318155318f, 0.193055436f},
-std::array<float,2>{0.153867468f, 0.953888893f},
-std::array<float,2>{0.910921156f, 0.332734644f},
-std::array<float,2>{0.571930766f, 0.854240417f},
-std::array<float,2>{0.300606042f, 0.376871973f},
-std::array<float,2>{0.219958305f, 0.664592505f},
-std::array<float,2>{0.940708935f, 0.0250084866f},
-std::array<float,2>{0.803369761f, 0.560761511f},
-std::array<float,2>{0.014853118f, 0.166619882f},
-std::array<float,2>{0.389198452f, 0.927419782f},
-std::array<float,2>{0.737483799f, 0.272582531f},
-std::array<float,2>{0.904987991f, 0.977835953f},
-std::array<float,2>{0.181098342f, 0.3678464f},
-std::array<float,2>{0.372308224f, 0.59393996f},
-std::array<float,2>{0.548664153f, 0.233143285f},
-std::array<float,2>{0.666582227f, 0.718175173f},
-std::array<float,2>{0.437508255f, 0.0846603587f},
-std::array<float,2>{0.0744953752f, 0.794744551f},
-std::array<float,2>{0.827425301f, 0.481961727f},
-std::array<float,2>{0.510493457f, 0.895096481f},
-std::array<float,2>{0.327938735f, 0.304734319f},
-std::array<float,2>{0.143569067f, 0.523928344f},
-std::array<float,2>{0.918863297f, 0.130662486f},
-std::array<float,2>{0.856241465f, 0.647226691f},
-std::array<float,2>{0.108420312f, 0.0545325615f},
-std::array<float,2>{0.498887867f, 0.823341429f},
-std::array<float,2>{0.653345644f, 0.42928803f},
-std::array<float,2>{0.972108126f, 0.758006811f},
-std::array<float,2>{0.215596884f, 0.442802787f},
-std::array<float,2>{0.261868149f, 0.728080094f},
-std::array<float,2>{0.594083309f, 0.0966156274f},
-std::array<float,2>{0.707990706f, 0.576282144f},
-std::array<float,2>{0.426343203f, 0.212423608f},
-std::array<float,2>{0.0495962575f, 0.943737864f},
-std::array<float,2>{0.75313431f, 0.31960094f},
-std::array<float,2>{0.664058387f, 0.872912824f},
-std::array<float,2>{0.445536464f, 0.393962353f},
-std::array<float,2>{0.0652228072f, 0.67335695f},
-std::array<float,2>{0.816496015f, 0.00497204391f},
-std::array<float,2>{0.893485725f, 0.542689919f},
-std::array<float,2>{0.17853266f, 0.187309057f},
-std::array<float,2>{0.363453805f, 0.907516122f},
-std::array<float,2>{0.562452137f, 0.260010242f},
-std::array<float,2>{0.812423468f, 0.987359166f},
-std::array<float,2>{0.00163323409f, 0.346458584f},
-std::array<float,2>{0.382417887f, 0.618044555f},
-std::array<float,2>{0.746433139f, 0.242767066f},
-std::array<float,2>{0.566355228f, 0.690589011f},
-std::array<float,2>{0.311261266f, 0.0744650811f},
-std::array<float,2>{0.234335616f, 0.8060956f},
-std::array<float,2>{0.95037818f, 0.496022731f},
-std::array<float,2>{0.722534478f, 0.960837543f},
-std::array<float,2>{0.397744447f, 0.329889536f},
-std::array<float,2>{0.0252950508f, 0.593225598f},
-std::array<float,2>{0.791991115f, 0.190108776f},
-std::array<float,2>{0.955724239f, 0.748902977f},
-std::array<float,2>{0.248952076f, 0.118365563f},
-std::array<float,2>{0.295674145f, 0.771352351f},
-std::array<float,2>{0.591968894f, 0.46578607f},
-std::array<float,2>{0.834962428f, 0.837753534f},
-std::array<float,2>{0.0875407681f, 0.415460348f},
-std::array<float,2>{0.453811795f, 0.629165113f},
-std::array<float,2>{0.68591094f, 0.0409194976f},
-std::array<float,2>{0.532642543f, 0.502122641f},
-std::array<float,2>{0.346345961f, 0.151713505f},
-std::array<float,2>{0.165938005f, 0.875265956f},
-std::array<float,2>{0.876250923f, 0.284360915f},
-std::array<float,2>{0.615977228f, 0.789962053f},
-std::array<float,2>{0.272082508f, 0.477362007f},
-std::array<float,2>{0.191041291f, 0.71190393f},
-std::array<float,2>{0.995598435f, 0.0809543207f},
-std::array<float,2>{0.766421378f, 0.598544657f},
-std::array<float,2>{0.0467842855f, 0.22755377f},
-std::array<float,2>{0.416749299f, 0.981843352f},
-std::array<float,2>{0.700740397f, 0.373905092f},
-std::array<float,2>{0.924288869f, 0.922027707f},
-std::array<float,2>{0.12572059f, 0.267877907f},
-std::array<float,2>{0.330468833f, 0.555954218f},
-std::array<float,2>{0.52246207f, 0.168656051f},
-std::array<float,2>{0.628728807f, 0.67111063f},
-std::array<float,2>{0.47794205f, 0.0305843987f},
-std::array<float,2>{0.12068557f, 0.858935595f},
-std::array<float,2>{0.8743065f, 0.38045457f},
-std::array<float,2>{0.580822289f, 0.970808566f},
-std::array<float,2>{0.281491339f, 0.364710778f},
-std::array<float,2>{0.23756589f, 0.602235258f},
-std::array<float,2>{0.96847862f, 0.221907377f},
-std::array<float,2>{0.786870897f, 0.70933044f},
-std::array<float,2>{0.0219376124f, 0.0889938548f},
-std::array<float,2>{0.400020301f, 0.788720489f},
-std::array<float,2>{0.731100261f, 0.469426423f},
-std::array<float,2>{0.884255588f, 0.847621083f},
-std::array<float,2>{0.159906551f, 0.384418994f},
-std::array<float,2>{0.353733301f, 0.66109395f},
-std::array<float,2>{0.540869176f, 0.0219385568f},
-std::array<float,2>{0.678621888f, 0.548975825f},
-std::array<float,2>{0.465637296f, 0.163312241f},
-std::array<float,2>{0.0815105736f, 0.932317257f},
-std::array<float,2>{0.841316402f, 0.281142503f},
-std::array<float,2>{0.689062417f, 0.779211938f},
-std::array<float,2>{0.412603676f, 0.456785947f},
-std::array<float,2>{0.038083341f, 0.740039408f},
-std::array<float,2>{0.775171697f, 0.116794288f},
-std::array<float,2>{0.99066174f, 0.585187972f},
-std::array<float,2>{0.197179466f, 0.197095603f},
-std::array<float,2>{0.274964124f, 0.965448797f},
-std::array<float,2>{0.62240839f, 0.339020908f},
-std::array<float,2>{0.85973841f, 0.890058756f},
-std::array<float,2>{0.113614134f, 0.290879011f},
-std::array<float,2>{0.471197933f, 0.510770321f},
-std::array<float,2>{0.636692405f, 0.144062579f},
-std::array<float,2>{0.52971065f, 0.633969367f},
-std::array<float,2>{0.338781297f, 0.0371076949f},
-std::array<float,2>{0.135675296f, 0.828610718f},
-std::array<float,2>{0.931220651f, 0.410761088f},
-std::array<float,2>{0.647263825f, 0.916749597f},
-std::array<float,2>{0.490382433f, 0.251681089f},
-std::array<float,2>{0.0958789513f, 0.537826061f},
-std::array<float,2>{0.850923002f, 0.178547606f},
-std::array<float,2>{0.908436894f, 0.681360602f},
-std::array<float,2>{0.150791392f, 0.0155317839f},
-std::array<float,2>{0.312676758f, 0.863909185f},
-std::array<float,2>{0.500496387f, 0.399186224f},
-std::array<float,2>{0.764276326f, 0.798097014f},
-std::array<float,2>{0.0618679374f, 0.491494864f},
-std::array<float,2>{0.434088588f, 0.697510004f},
-std::array<float,2>{0.714944601f, 0.0643432215f},
-std::array<float,2>{0.603739381f, 0.612489343f},
-std::array<float,2>{0.257464558f, 0.241353005f},
-std::array<float,2>{0.208588734f, 0.999951422f},
-std::array<float,2>{0.979523599f, 0.353460878f},
-std::array<float,2>{0.554570079f, 0.819724798f},
-std::array<float,2>{0.369830757f, 0.436657608f},
-std::array<float,2>{0.184722602f, 0.65144521f},
-std::array<float,2>{0.90218401f, 0.0600682758f},
-std::array<float,2>{0.820505261f, 0.518478632f},
-std::array<float,2>{0.0707957521f, 0.136045873f},
-std::array<float,2>{0.444656521f, 0.902013779f},
-std::array<float,2>{0.6708619f, 0.297026098f},
-std::array<float,2>{0.941699684f, 0.948355854f},
-std::array<float,2>{0.222825542f, 0.320779383f},
-std::array<float,2>{0.302693576f, 0.56773603f},
-std::array<float,2>{0.576640844f, 0.203564167f},
-std::array<float,2>{0.740808487f, 0.719363809f},
-std::array<float,2>{0.385298789f, 0.105412968f},
-std::array<float,2>{0.0114844507f, 0.753406644f},
-std::array<float,2>{0.800150156f, 0.447364509f},
-std::array<float,2>{0.579606473f, 0.932563126f},
-std::array<float,2>{0.284281254f, 0.280805796f},
-std::array<float,2>{0.236242801f, 0.549231291f},
-std::array<float,2>{0.966602981f, 0.163394928f},
-std::array<float,2>{0.788982391f, 0.660735369f},
-std::array<float,2>{0.0210920591f, 0.0216415972f},
-std::array<float,2>{0.400917292f, 0.847393572f},
-std::array<float,2>{0.734152257f, 0.384600937f},
-std::array<float,2>{0.885574698f, 0.788873732f},
-std::array<float,2>{0.157593176f, 0.469597191f},
-std::array<float,2>{0.353461772f, 0.709016263f},
-std::array<float,2>{0.542198479f, 0.0892189145f},
-std::array<float,2>{0.676455081f, 0.602396309f},
-std::array<float,2>{0.467661798f, 0.222016886f},
-std::array<float,2>{0.0799668953f, 0.971163511f},
-std::array<float,2>{0.843040943f, 0.364319861f},
-std::array<float,2>{0.68995744f, 0.828165889f},
-std::array<float,2>{0.41196993f, 0.410921812f},
-std::array<float,2>{0.036355719f, 0.634146273f},
-std::array<float,2>{0.776806235f, 0.0367333852f},
-std::array<float,2>{0.990089536f, 0.51110971f},
-std::array<float,2>{0.198222026f, 0.144466266f},
-std::array<float,2>{0.276863247f, 0.889879286f},
-std::array<float,2>{0.623423636f, 0.290671587f},
-std::array<float,2>{0.861506045f, 0.965713263f},
-std::array<float,2>{0.117145911f, 0.339244962f},
-std::array<float,2>{0.470207125f, 0.585443735f},
-std::array<float,2>{0.633879542f, 0.196990207f},
-std::array<float,2>{0.529241025f, 0.739859045f},
-std::array<float,2>{0.336206555f, 0.116945349f},
-std::array<float,2>{0.133195132f, 0.778989553f},
-std::array<float,2>{0.933055282f, 0.456909895f},
-std::array<float,2>{0.645295262f, 0.999595582f},
-std::array<float,2>{0.488990009f, 0.35308972f},
-std::array<float,2>{0.0956036672f, 0.612614572f},
-std::array<float,2>{0.848353386f, 0.241501853f},
-std::array<float,2>{0.908003271f, 0.697383761f},
-std::array<float,2>{0.14949517f, 0.0640252158f},
-std::array<float,2>{0.314836204f, 0.79800421f},
-std::array<float,2>{0.502889037f, 0.491387993f},
-std::array<float,2>{0.763563454f, 0.864195585f},
-std::array<float,2>{0.0597723164f, 0.399124831f},
-std::array<float,2>{0.437434196f, 0.68144697f},
-std::array<float,2>{0.71694392f, 0.0151465889f},
-std::array<float,2>{0.602695823f, 0.537904739f},
-std::array<float,2>{0.254563659f, 0.178388104f},
-std::array<float,2>{0.210142657f, 0.916570127f},
-std::array<float,2>{0.977025926f, 0.251740336f},
-std::array<float,2>{0.551413596f, 0.753089368f},
-std::array<float,2>{0.369015098f, 0.447532356f},
-std::array<float,2>{0.187133312f, 0.719635606f},
-std::array<float,2>{0.899877608f, 0.105017789f},
-std::array<float,2>{0.82226795f, 0.567513525f},
-std::array<float,2>{0.0732168704f, 0.20325157f},
-std::array<float,2>{0.441973299f, 0.94858557f},
-std::array<float,2>{0.669360757f, 0.320492893f},
-std::array<float,2>{0.944108844f, 0.902321637f},
-std::array<float,2>{0.225311711f, 0.297153056f},
-std::array<float,2>{0.303168863f, 0.518249094f},
-std::array<float,2>{0.575665176f, 0.135751039f},
-std::array<float,2>{0.73974824f, 0.651729167f},
-std::array<float,2>{0.384360641f, 0.0603379048f},
-std::array<float,2>{0.00897621736f, 0.819404781f},
-std::array<float,2>{0.797829807f, 0.436892301f},
-std::array<float,2>{0.508072674f, 0.943404973f},
-std::array<float,2>{0.325315237f, 0.319363028f},
-std::array<float,2>{0.140741199f, 0.57651633f},
-std::array<float,2>{0.921760201f, 0.212674662f},
-std::array<float,2>{0.858288407f, 0.728319943f},
-std::array<float,2>{0.10705296f, 0.0963444486f},
-std::array<float,2>{0.497701555f, 0.758134186f},
-std::array<float,2>{0.655405045f, 0.442472368f},
-std::array<float,2>{0.970215142f, 0.823523641f},
-std::array<float,2>{0.217232347f, 0.429660708f},
-std::array<float,2>{0.264146626f, 0.647182405f},
-std::array<float,2>{0.597469866f, 0.0542747304f},
-std::array<float,2>{0.710590661f, 0.524266064f},
-std::array<float,2>{0.428669572f, 0.130561203f},
-std::array<float,2>{0.0487028249f, 0.895323336f},
-std::array<float,2>{0.751385987f, 0.304946184f},
-std::array<float,2>{0.661745191f, 0.805818796f},
-std::array<float,2>{0.448512703f, 0.495775223f},
-std::array<float,2>{0.0632952452f, 0.690833449f},
-std::array<float,2>{0.818845093f, 0.0743164271f},
-std::array<float,2>{0.89187932f, 0.617780924f},
-std::array<float,2>{0.176374778f, 0.243115485f},
-std::array<float,2>{0.365935862f, 0.987580478f},
-std::array<float,2>{0.559951663f, 0.346355528f},
-std::array<float,2>{0.810392141f, 0.907410502f},
-std::array<float,2>{0.00230502384f, 0.259914011f},
-std::array<float,2>{0.378991157f, 0.54294306f},
-std::array<float,2>{0.748514175f, 0.18724376f},
-std::array<float,2>{0.563864946f, 0.673700273f},
-std::array<float,2>{0.310090214f, 0.00514818681f},
-std::array<float,2>{0.231823534f, 0.872622132f},
-std::array<float,2>{0.95127207f, 0.393700302f},
-std::array<float,2>{0.719513893f, 0.875142992f},
-std::array<float,2>{0.39578706f, 0.284544617f},
-std::array<float,2>{0.0270476807f, 0.502299607f},
-std::array<float,2>{0.790321529f, 0.151455164f},
-std::array<float,2>{0.954532564f, 0.628963351f},
-std::array<float,2>{0.246766165f, 0.0405678749f},
-std::array<float,2>{0.293615043f, 0.837423861f},
-std::array<float,2>{0.59032017f, 0.415221453f},
-std::array<float,2>{0.8334831f, 0.771143317f},
-std::array<float,2>{0.0888387933f, 0.465384156f},
-std::array<float,2>{0.45660758f, 0.748691201f},
-std::array<float,2>{0.684701681f, 0.11848072f},
-std::array<float,2>{0.533480823f, 0.592984736f},
-std::array<float,2>{0.34403339f, 0.190368339f},
-std::array<float,2>{0.166854367f, 0.960473359f},
-std::array<float,2>{0.877777815f, 0.32964772f},
-std::array<float,2>{0.614621639f, 0.859264016f},
-std::array<float,2>{0.270047754f, 0.38067022f},
-std::array<float,2>{0.187977478f, 0.671338022f},
-std::array<float,2>{0.992613494f, 0.030514013f},
-std::array<float,2>{0.769210756f, 0.555768549f},
-std::array<float,2>{0.0441935547f, 0.168941721f},
-std::array<float,2>{0.415445268f, 0.922165394f},
-std::array<float,2>{0.702885926f, 0.26761511f},
-std::array<float,2>{0.922301173f, 0.981634319f},
-std::array<float,2>{0.128733754f, 0.373770356f},
-std::array<float,2>{0.328636199f, 0.598321915f},
-std::array<float,2>{0.519870996f, 0.228005335f},
-std::array<float,2>{0.625432014f, 0.711622655f},
-std::array<float,2>{0.479060829f, 0.0806376487f},
-std::array<float,2>{0.118531637f, 0.789656281f},
-std::array<float,2>{0.871420503f, 0.477182508f},
-std::array<float,2>{0.544097841f, 0.891979635f},
-std::array<float,2>{0.358821988f, 0.31142047f},
-std::array<float,2>{0.161330089f, 0.529886663f},
-std::array<float,2>{0.888668001f, 0.128508702f},
-std::array<float,2>{0.838154852f, 0.640764415f},
-std::array<float,2>{0.0842273161f, 0.0500816703f},
-std::array<float,2>{0.461803854f, 0.826840281f},
-std::array<float,2>{0.675098956f, 0.424936563f},
-std::array<float,2>{0.961920142f, 0.763675392f},
-std::array<float,2>{0.239545986f, 0.438076437f},
-std::array<float,2>{0.288017631f, 0.7325477f},
-std::array<float,2>{0.585526824f, 0.100928016f},
-std::array<float,2>{0.729050934f, 0.570668697f},
-std::array<float,2>{0.405822337f, 0.217174679f},
-std::array<float,2>{0.0162608195f, 0.938747466f},
-std::array<float,2>{0.784975827f, 0.31582889f},
-std::array<float,2>{0.63911438f, 0.868456841f},
-std::array<float,2>{0.475622594f, 0.396776289f},
-std::array<float,2>{0.109914713f, 0.675985038f},
-std::array<float,2>{0.863492191f, 0.00264182012f},
-std::array<float,2>{0.936085284f, 0.546197355f},
-std::array<float,2>{0.137256995f, 0.180850103f},
-std::array<float,2>{0.343095958f, 0.913051903f},
-std::array<float,2>{0.52417779f, 0.265518427f},
-std::array<float,2>{0.777406633f, 0.989350498f},
-std::array<float,2>{0.0315172635f, 0.349030137f},
-std::array<float,2>{0.408440769f, 0.621396184f},
-std::array<float,2>{0.694976866f, 0.247981146f},
-std::array<float,2>{0.619232118f, 0.692481041f},
-std::array<float,2>{0.278993428f, 0.0727890581f},
-std::array<float,2>{0.201120093f, 0.810957789f},
-std::array<float,2>{0.985727549f, 0.498473912f},
-std::array<float,2>{0.714130461f, 0.953621447f},
-std::array<float,2>{0.431303024f, 0.332930058f},
-std::array<float,2>{0.0581824891f, 0.588196337f},
-std::array<float,2>{0.761416435f, 0.193307742f},
-std::array<float,2>{0.983996093f, 0.743023038f},
-std::array<float,2>{0.206544042f, 0.123329885f},
-std::array<float,2>{0.25207752f, 0.767003477f},
-std::array<float,2>{0.608757973f, 0.462828964f},
-std::array<float,2>{0.844926536f, 0.842969537f},
-std::array<float,2>{0.0986825973f, 0.419097394f},
-std::array<float,2>{0.486681432f, 0.62543875f},
-std::array<float,2>{0.640892029f, 0.0460793935f},
-std::array<float,2>{0.504160345f, 0.504731715f},
-std::array<float,2>{0.31961447f, 0.153391793f},
-std::array<float,2>{0.155188233f, 0.879624486f},
-std::array<float,2>{0.913410664f, 0.286737531f},
-std::array<float,2>{0.57385838f, 0.794538438f},
-std::array<float,2>{0.297024846f, 0.482248753f},
-std::array<float,2>{0.221046507f, 0.717939019f},
-std::array<float,2>{0.938062072f, 0.0848042965f},
-std::array<float,2>{0.8009848f, 0.594211936f},
-std::array<float,2>{0.0128715765f, 0.233347803f},
-std::array<float,2>{0.388252228f, 0.977738559f},
-std::array<float,2>{0.735506952f, 0.367922872f},
-std::array<float,2>{0.902703583f, 0.927567422f},
-std::array<float,2>{0.182214409f, 0.272899806f},
-std::array<float,2>{0.374171615f, 0.560997486f},
-std::array<float,2>{0.549283147f, 0.166971087f},
-std::array<float,2>{0.664331198f, 0.664943874f},
-std::array<float,2>{0.440747231f, 0.0253528543f},
-std::array<float,2>{0.0770836398f, 0.854273379f},
-std::array<float,2>{0.825544894f, 0.376536012f},
-std::array<float,2>{0.599183023f, 0.974023819f},
-std::array<float,2>{0.260358244f, 0.361529648f},
-std::array<float,2>{0.211676642f, 0.607376218f},
-std::array<float,2>{0.975022435f, 0.224740013f},
-std::array<float,2>{0.754517198f, 0.706689298f},
-std::array<float,2>{0.0521500185f, 0.0936513692f},
-std::array<float,2>{0.423263103f, 0.783405542f},
-std::array<float,2>{0.706348479f, 0.47292003f},
-std::array<float,2>{0.91641432f, 0.848463237f},
-std::array<float,2>{0.146103755f, 0.389567226f},
-std::array<float,2>{0.323736459f, 0.658662856f},
-std::array<float,2>{0.51254797f, 0.0172757227f},
-std::array<float,2>{0.650301218f, 0.551586032f},
-std::array<float,2>{0.496092796f, 0.156849414f},
-std::array<float,2>{0.104953557f, 0.935345232f},
-std::array<float,2>{0.85395968f, 0.275115848f},
-std::array<float,2>{0.743811429f, 0.774803042f},
-std::array<float,2>{0.378580123f, 0.458082646f},
-std::array<float,2>{0.00394627359f, 0.735741258f},
-std::array<float,2>{0.805809677f, 0.112007037f},
-std::array<float,2>{0.945606887f, 0.578495562f},
-std::array<float,2>{0.227986693f, 0.202475414f},
-std::array<float,2>{0.307810307f, 0.962995708f},
-std::array<float,2>{0.568842888f, 0.340208799f},
-std::array<float,2>{0.815628767f, 0.885530055f},
-std::array<float,2>{0.0687997639f, 0.296820134f},
-std::array<float,2>{0.449816078f, 0.51300633f},
-std::array<float,2>{0.658336222f, 0.145336121f},
-std::array<float,2>{0.558032274f, 0.639686227f},
-std::array<float,2>{0.361748397f, 0.031886667f},
-std::array<float,2>{0.174065858f, 0.833281457f},
-std::array<float,2>{0.895397782f, 0.409068078f},
-std::array<float,2>{0.681060791f, 0.919314206f},
-std::array<float,2>{0.457856894f, 0.257151723f},
-std::array<float,2>{0.0909491107f, 0.534544468f},
-std::array<float,2>{0.830074906f, 0.172945589f},
-std::array<float,2>{0.881352365f, 0.685348749f},
-std::array<float,2>{0.169163167f, 0.0104808481f},
-std::array<float,2>{0.35076651f, 0.860584557f},
-std::array<float,2>{0.535360694f, 0.404798448f},
-std::array<float,2>{0.794228971f, 0.802161515f},
-std::array<float,2>{0.0291782878f, 0.487811983f},
-std::array<float,2>{0.390838057f, 0.701815486f},
-std::array<float,2>{0.724534988f, 0.0701335147f},
-std::array<float,2>{0.588379502f, 0.614804685f},
-std::array<float,2>{0.289629221f, 0.237000674f},
-std::array<float,2>{0.244079337f, 0.995509148f},
-std::array<float,2>{0.957680464f, 0.356602103f},
-std::array<float,2>{0.517275751f, 0.813384295f},
-std::array<float,2>{0.334810525f, 0.431099236f},
-std::array<float,2>{0.131320298f, 0.652937531f},
-std::array<float,2>{0.928573787f, 0.0566962436f},
-std::array<float,2>{0.868873417f, 0.520199597f},
-std::array<float,2>{0.12164481f, 0.13954711f},
-std::array<float,2>{0.480784029f, 0.903262317f},
-std::array<float,2>{0.632559776f, 0.301759779f},
-std::array<float,2>{0.999912024f, 0.950298846f},
-std::array<float,2>{0.192609042f, 0.324821562f},
-std::array<float,2>{0.267153889f, 0.563099504f},
-std::array<float,2>{0.611897707f, 0.207420692f},
-std::array<float,2>{0.697600186f, 0.72462219f},
-std::array<float,2>{0.418047041f, 0.10581997f},
-std::array<float,2>{0.0423465408f, 0.754462779f},
-std::array<float,2>{0.770183265f, 0.4519867f},
-std::array<float,2>{0.62170887f, 0.888272226f},
-std::array<float,2>{0.274187088f, 0.292498618f},
-std::array<float,2>{0.19579266f, 0.508289874f},
-std::array<float,2>{0.991322279f, 0.14114809f},
-std::array<float,2>{0.773841023f, 0.636303365f},
-std::array<float,2>{0.0383512974f, 0.0383327082f},
-std::array<float,2>{0.413477391f, 0.831490278f},
-std::array<float,2>{0.688222766f, 0.413324654f},
-std::array<float,2>{0.930651009f, 0.779418528f},
-std::array<float,2>{0.136155441f, 0.454228193f},
-std::array<float,2>{0.339491725f, 0.741167307f},
-std::array<float,2>{0.53101939f, 0.11444518f},
-std::array<float,2>{0.634833038f, 0.582818389f},
-std::array<float,2>{0.472315222f, 0.198826045f},
-std::array<float,2>{0.114338614f, 0.967837393f},
-std::array<float,2>{0.860678434f, 0.337788075f},
-std::array<float,2>{0.731583774f, 0.844964504f},
-std::array<float,2>{0.398608208f, 0.3856785f},
-std::array<float,2>{0.0227907263f, 0.662977636f},
-std::array<float,2>{0.785434067f, 0.0210625548f},
-std::array<float,2>{0.966922522f, 0.547055066f},
-std::array<float,2>{0.237125158f, 0.161319807f},
-std::array<float,2>{0.282944024f, 0.931176603f},
-std::array<float,2>{0.581873238f, 0.277530819f},
-std::array<float,2>{0.840002954f, 0.969431102f},
-std::array<float,2>{0.0807518885f, 0.366856903f},
-std::array<float,2>{0.46648401f, 0.605173171f},
-std::array<float,2>{0.678762972f, 0.220414385f},
-std::array<float,2>{0.539614916f, 0.708492875f},
-std::array<float,2>{0.355389684f, 0.0874226615f},
-std::array<float,2>{0.158334181f, 0.78653115f},
-std::array<float,2>{0.882995009f, 0.472535789f},
-std::array<float,2>{0.671263635f, 0.94647342f},
-std::array<float,2>{0.444169015f, 0.322831333f},
-std::array<float,2>{0.0715935156f, 0.569770336f},
-std::array<float,2>{0.821786761f, 0.206107557f},
-std::array<float,2>{0.900621474f, 0.72118032f},
-std::array<float,2>{0.183991581f, 0.103341743f},
-std::array<float,2>{0.371076882f, 0.750480831f},
-std::array<float,2>{0.552983284f, 0.446933031f},
-std::array<float,2>{0.798841894f, 0.817139208f},
-std::array<float,2>{0.0106744412f, 0.433720529f},
-std::array<float,2>{0.385984182f, 0.649536788f},
-std::array<float,2>{0.741652131f, 0.062060155f},
-std::array<float,2>{0.577589333f, 0.516698062f},
-std::array<float,2>{0.301286608f, 0.133136883f},
-std::array<float,2>{0.223868579f, 0.899194956f},
-std::array<float,2>{0.942953169f, 0.300633758f},
-std::array<float,2>{0.501834691f, 0.800273359f},
-std::array<float,2>{0.314341575f, 0.489899129f},
-std::array<float,2>{0.152041882f, 0.695704699f},
-std::array<float,2>{0.910149455f, 0.066163063f},
-std::array<float,2>{0.849717498f, 0.610736847f},
-std::array<float,2>{0.0967913345f, 0.239664942f},
-std::array<float,2>{0.491920203f, 0.997682691f},
-std::array<float,2>{0.647769988f, 0.353701144f},
-std::array<float,2>{0.979328454f, 0.915679693f},
-std::array<float,2>{0.207262322f, 0.253560662f},
-std::array<float,2>{0.255917847f, 0.535525858f},
-std::array<float,2>{0.604891002f, 0.176286176f},
-std::array<float,2>{0.716624022f, 0.68225944f},
-std::array<float,2>{0.434845418f, 0.0123643605f},
-std::array<float,2>{0.0612235963f, 0.867058814f},
-std::array<float,2>{0.765240133f, 0.401731849f},
-std::array<float,2>{0.561215281f, 0.984654069f},
-std::array<float,2>{0.365117371f, 0.344881147f},
-std::array<float,2>{0.178735927f, 0.619573951f},
-std::array<float,2>{0.894083202f, 0.245315582f},
-std::array<float,2>{0.818272889f, 0.688413978f},
-std::array<float,2>{0.0662582442f, 0.077263914f},
-std::array<float,2>{0.447072953f, 0.807193696f},
-std::array<float,2>{0.662981868f, 0.493734032f},
-std::array<float,2>{0.94946909f, 0.873275578f},
-std::array<float,2>{0.232658938f, 0.391370684f},
-std::array<float,2>{0.31180653f, 0.675506055f},
-std::array<float,2>{0.56461519f, 0.00766771194f},
-std::array<float,2>{0.747124732f, 0.539932132f},
-std::array<float,2>{0.381800145f, 0.183608875f},
-std::array<float,2>{0.000492171792f, 0.908901572f},
-std::array<float,2>{0.810753047f, 0.25804919f},
-std::array<float,2>{0.652726054f, 0.761349678f},
-std::array<float,2>{0.499303997f, 0.443712533f},
-std::array<float,2>{0.1075323f, 0.72973752f},
-std::array<float,2>{0.857160985f, 0.0953433439f},
-std::array<float,2>{0.918976068f, 0.575745285f},
-std::array<float,2>{0.142602921f, 0.21417208f},
-std::array<float,2>{0.326408714f, 0.942843318f},
-std::array<float,2>{0.511316478f, 0.316807896f},
-std::array<float,2>{0.752784252f, 0.897738278f},
-std::array<float,2>{0.0505617969f, 0.308265597f},
-std::array<float,2>{0.426987022f, 0.526634037f},
-std::array<float,2>{0.708351076f, 0.131812632f},
-std::array<float,2>{0.595699549f, 0.644981861f},
-std::array<float,2>{0.263504714f, 0.0520490445f},
-std::array<float,2>{0.216201097f, 0.820693195f},
-std::array<float,2>{0.970931351f, 0.426277965f},
-std::array<float,2>{0.699690223f, 0.925478935f},
-std::array<float,2>{0.417776525f, 0.267543226f},
-std::array<float,2>{0.0456273034f, 0.557174861f},
-std::array<float,2>{0.767322183f, 0.171015128f},
-std::array<float,2>{0.994641364f, 0.66985631f},
-std::array<float,2>{0.189821318f, 0.0280750562f},
-std::array<float,2>{0.27284506f, 0.855949342f},
-std::array<float,2>{0.616491854f, 0.382806361f},
-std::array<float,2>{0.87382406f, 0.792620897f},
-std::array<float,2>{0.119237863f, 0.47973913f},
-std::array<float,2>{0.47732091f, 0.713926613f},
-std::array<float,2>{0.627162755f, 0.0791892633f},
-std::array<float,2>{0.522176564f, 0.600730479f},
-std::array<float,2>{0.331861496f, 0.229339033f},
-std::array<float,2>{0.126464799f, 0.983255804f},
-std::array<float,2>{0.92565167f, 0.372405529f},
-std::array<float,2>{0.592926443f, 0.838040888f},
-std::array<float,2>{0.296815753f, 0.417483598f},
-std::array<float,2>{0.249614239f, 0.631884992f},
-std::array<float,2>{0.956584036f, 0.0412095487f},
-std::array<float,2>{0.792306662f, 0.501856446f},
-std::array<float,2>{0.0243571047f, 0.149867445f},
-std::array<float,2>{0.396583021f, 0.878075957f},
-std::array<float,2>{0.721289575f, 0.282485723f},
-std::array<float,2>{0.87567699f, 0.958896399f},
-std::array<float,2>{0.164340287f, 0.331710637f},
-std::array<float,2>{0.347099304f, 0.589933515f},
-std::array<float,2>{0.531558573f, 0.18768765f},
-std::array<float,2>{0.687433481f, 0.747613907f},
-std::array<float,2>{0.454160154f, 0.120458297f},
-std::array<float,2>{0.086657919f, 0.771953583f},
-std::array<float,2>{0.834602177f, 0.466887414f},
-std::array<float,2>{0.526438415f, 0.910607398f},
-std::array<float,2>{0.341227263f, 0.263663292f},
-std::array<float,2>{0.139522955f, 0.543884933f},
-std::array<float,2>{0.934570432f, 0.183222935f},
-std::array<float,2>{0.866849363f, 0.679085493f},
-std::array<float,2>{0.111377686f, 0.00188170176f},
-std::array<float,2>{0.472849816f, 0.870652318f},
-std::array<float,2>{0.636873782f, 0.395631224f},
-std::array<float,2>{0.98681879f, 0.809596777f},
-std::array<float,2>{0.202835962f, 0.49672091f},
-std::array<float,2>{0.280675679f, 0.694382489f},
-std::array<float,2>{0.618547022f, 0.0719039068f},
-std::array<float,2>{0.692126155f, 0.623356164f},
-std::array<float,2>{0.407638639f, 0.249352127f},
-std::array<float,2>{0.0335845612f, 0.991457701f},
-std::array<float,2>{0.77955085f, 0.35092634f},
-std::array<float,2>{0.672717035f, 0.826071978f},
-std::array<float,2>{0.463116735f, 0.423300833f},
-std::array<float,2>{0.0829330981f, 0.643386185f},
-std::array<float,2>{0.837688386f, 0.0478379726f},
-std::array<float,2>{0.890375495f, 0.527347565f},
-std::array<float,2>{0.162650988f, 0.126880363f},
-std::array<float,2>{0.357311577f, 0.89381367f},
-std::array<float,2>{0.546413302f, 0.308924615f},
-std::array<float,2>{0.782200396f, 0.941237092f},
-std::array<float,2>{0.0182873886f, 0.313199967f},
-std::array<float,2>{0.402384132f, 0.573659956f},
-std::array<float,2>{0.727341354f, 0.215549931f},
-std::array<float,2>{0.583835423f, 0.732344747f},
-std::array<float,2>{0.285251528f, 0.0990895554f},
-std::array<float,2>{0.240602866f, 0.761906743f},
-std::array<float,2>{0.963430107f, 0.440284908f},
-std::array<float,2>{0.737145603f, 0.979689181f},
-std::array<float,2>{0.390474707f, 0.370804548f},
-std::array<float,2>{0.014389541f, 0.596343398f},
-std::array<float,2>{0.804087281f, 0.232398629f},
-std::array<float,2>{0.940417051f, 0.715328515f},
-std::array<float,2>{0.218942031f, 0.0823240355f},
-std::array<float,2>{0.299089462f, 0.794988871f},
-std::array<float,2>{0.570957303f, 0.483769447f},
-std::array<float,2>{0.826626658f, 0.851585031f},
-std::array<float,2>{0.0760016143f, 0.377998799f},
-std::array<float,2>{0.438744396f, 0.66695416f},
-std::array<float,2>{0.667835414f, 0.0262888484f},
-std::array<float,2>{0.547430456f, 0.559924066f},
-std::array<float,2>{0.371730953f, 0.16470547f},
-std::array<float,2>{0.180326119f, 0.928123415f},
-std::array<float,2>{0.905682445f, 0.27105397f},
-std::array<float,2>{0.605638444f, 0.767850935f},
-std::array<float,2>{0.250826836f, 0.464376509f},
-std::array<float,2>{0.204549223f, 0.744665623f},
-std::array<float,2>{0.980513334f, 0.122191645f},
-std::array<float,2>{0.759020448f, 0.587003827f},
-std::array<float,2>{0.0560430251f, 0.195204169f},
-std::array<float,2>{0.433399796f, 0.95646143f},
-std::array<float,2>{0.711180031f, 0.334921449f},
-std::array<float,2>{0.911815464f, 0.881732583f},
-std::array<float,2>{0.152390555f, 0.288285375f},
-std::array<float,2>{0.31646204f, 0.506944537f},
-std::array<float,2>{0.507338762f, 0.154528052f},
-std::array<float,2>{0.642726064f, 0.627150476f},
-std::array<float,2>{0.485795051f, 0.0443730131f},
-std::array<float,2>{0.101272568f, 0.840380609f},
-std::array<float,2>{0.845855832f, 0.420622289f},
-std::array<float,2>{0.567952812f, 0.961620748f},
-std::array<float,2>{0.306352973f, 0.342912465f},
-std::array<float,2>{0.229841948f, 0.581870735f},
-std::array<float,2>{0.948576093f, 0.199691892f},
-std::array<float,2>{0.806963682f, 0.738120377f},
-std::array<float,2>{0.00683243154f, 0.109967411f},
-std::array<float,2>{0.375814795f, 0.777311325f},
-std::array<float,2>{0.745027125f, 0.460449576f},
-std::array<float,2>{0.897747993f, 0.834502757f},
-std::array<float,2>{0.172026396f, 0.406688243f},
-std::array<float,2>{0.359984726f, 0.636785805f},
-std::array<float,2>{0.554783702f, 0.0337442458f},
-std::array<float,2>{0.656566858f, 0.514067769f},
-std::array<float,2>{0.452404737f, 0.147845536f},
-std::array<float,2>{0.0678161904f, 0.88371253f},
-std::array<float,2>{0.812588394f, 0.294755071f},
-std::array<float,2>{0.704028308f, 0.781752586f},
-std::array<float,2>{0.424576342f, 0.4747352f},
-std::array<float,2>{0.0538606159f, 0.704747498f},
-std::array<float,2>{0.756948292f, 0.0898588523f},
-std::array<float,2>{0.974606276f, 0.608166277f},
-std::array<float,2>{0.214299738f, 0.224416688f},
-std::array<float,2>{0.259401917f, 0.975936115f},
-std::array<float,2>{0.601101875f, 0.361238509f},
-std::array<float,2>{0.85322839f, 0.93654108f},
-std::array<float,2>{0.101840101f, 0.276712626f},
-std::array<float,2>{0.493865162f, 0.55456692f},
-std::array<float,2>{0.65121752f, 0.158697948f},
-std::array<float,2>{0.51514703f, 0.657880962f},
-std::array<float,2>{0.320877373f, 0.0194863807f},
-std::array<float,2>{0.14736414f, 0.849750459f},
-std::array<float,2>{0.914688528f, 0.387391865f},
-std::array<float,2>{0.629573405f, 0.904790819f},
-std::array<float,2>{0.482603222f, 0.30388099f},
-std::array<float,2>{0.124042027f, 0.521930575f},
-std::array<float,2>{0.869961083f, 0.138153672f},
-std::array<float,2>{0.927666247f, 0.65444684f},
-std::array<float,2>{0.130851611f, 0.0552333295f},
-std::array<float,2>{0.332510531f, 0.814628601f},
-std::array<float,2>{0.519423246f, 0.433327198f},
-std::array<float,2>{0.772475541f, 0.757743716f},
-std::array<float,2>{0.039995037f, 0.449818254f},
-std::array<float,2>{0.420802981f, 0.724207401f},
-std::array<float,2>{0.696595609f, 0.107786f},
-std::array<float,2>{0.610882759f, 0.565318406f},
-std::array<float,2>{0.267911851f, 0.209640086f},
-std::array<float,2>{0.193466261f, 0.95133692f},
-std::array<float,2>{0.99730289f, 0.327165753f},
-std::array<float,2>{0.538968921f, 0.863001287f},
-std::array<float,2>{0.34863466f, 0.403738737f},
-std::array<float,2>{0.17030248f, 0.687351108f},
-std::array<float,2>{0.880661368f, 0.00804051477f},
-std::array<float,2>{0.830887675f, 0.531475008f},
-std::array<float,2>{0.0926019624f, 0.174670771f},
-std::array<float,2>{0.460388035f, 0.921501398f},
-std::array<float,2>{0.681988478f, 0.254185706f},
-std::array<float,2>{0.960606813f, 0.993954599f},
-std::array<float,2>{0.245684803f, 0.357601494f},
-std::array<float,2>{0.292268395f, 0.616474986f},
-std::array<float,2>{0.587762415f, 0.236321017f},
-std::array<float,2>{0.726510942f, 0.700922549f},
-std::array<float,2>{0.394243866f, 0.0682152808f},
-std::array<float,2>{0.0300717335f, 0.803851664f},
-std::array<float,2>{0.795914054f, 0.485983074f},
-std::array<float,2>{0.574404299f, 0.899862766f},
-std::array<float,2>{0.304341048f, 0.299258649f},
-std::array<float,2>{0.225919813f, 0.515948653f},
-std::array<float,2>{0.94479984f, 0.134459108f},
-std::array<float,2>{0.798617959f, 0.648920357f},
-std::array<float,2>{0.00825338066f, 0.061324466f},
-std::array<float,2>{0.383124501f, 0.817656815f},
-std::array<float,2>{0.738653481f, 0.435492605f},
-std::array<float,2>{0.899256229f, 0.751888096f},
-std::array<float,2>{0.185795352f, 0.445892125f},
-std::array<float,2>{0.36729762f, 0.722271383f},
-std::array<float,2>{0.552489996f, 0.10156253f},
-std::array<float,2>{0.668085456f, 0.569022715f},
-std::array<float,2>{0.442391276f, 0.205356464f},
-std::array<float,2>{0.074017562f, 0.945501149f},
-std::array<float,2>{0.823654115f, 0.323847979f},
-std::array<float,2>{0.718385041f, 0.866208136f},
-std::array<float,2>{0.43574512f, 0.401187062f},
-std::array<float,2>{0.0592134632f, 0.683184326f},
-std::array<float,2>{0.761975348f, 0.0127989743f},
-std::array<float,2>{0.977663636f, 0.536877394f},
-std::array<float,2>{0.209010497f, 0.176763654f},
-std::array<float,2>{0.255634665f, 0.914567232f},
-std::array<float,2>{0.602284491f, 0.252791405f},
-std::array<float,2>{0.849535525f, 0.996515751f},
-std::array<float,2>{0.0946210921f, 0.354736567f},
-std::array<float,2>{0.489866108f, 0.609839082f},
-std::array<float,2>{0.646040738f, 0.238660663f},
-std::array<float,2>{0.503197253f, 0.696417809f},
-std::array<float,2>{0.316127837f, 0.0645342842f},
-std::array<float,2>{0.148462892f, 0.799476862f},
-std::array<float,2>{0.906283259f, 0.488554716f},
-std::array<float,2>{0.633650064f, 0.96699506f},
-std::array<float,2>{0.468786329f, 0.3368527f},
-std::array<float,2>{0.1161661f, 0.583698213f},
-std::array<float,2>{0.86280036f, 0.197759092f},
-std::array<float,2>{0.932376266f, 0.74149251f},
-std::array<float,2>{0.134498283f, 0.114121191f},
-std::array<float,2>{0.337867022f, 0.780530155f},
-std::array<float,2>{0.527951419f, 0.453654498f},
-std::array<float,2>{0.775425434f, 0.830436707f},
-std::array<float,2>{0.0360218249f, 0.412246436f},
-std::array<float,2>{0.410173208f, 0.634936035f},
-std::array<float,2>{0.690575838f, 0.0377649628f},
-std::array<float,2>{0.624717355f, 0.508974314f},
-std::array<float,2>{0.276327968f, 0.141806468f},
-std::array<float,2>{0.198997483f, 0.887381434f},
-std::array<float,2>{0.988359511f, 0.2919797f},
-std::array<float,2>{0.541696012f, 0.785376966f},
-std::array<float,2>{0.351750076f, 0.470862329f},
-std::array<float,2>{0.157184377f, 0.707379162f},
-std::array<float,2>{0.886538386f, 0.0868122503f},
-std::array<float,2>{0.84245193f, 0.603983343f},
-std::array<float,2>{0.0789854154f, 0.21894528f},
-std::array<float,2>{0.468689382f, 0.970049918f},
-std::array<float,2>{0.677225411f, 0.366207272f},
-std::array<float,2>{0.965704679f, 0.92983371f},
-std::array<float,2>{0.234942436f, 0.279184699f},
-std::array<float,2>{0.283680886f, 0.548600674f},
-std::array<float,2>{0.578576624f, 0.160219282f},
-std::array<float,2>{0.733388782f, 0.663964331f},
-std::array<float,2>{0.402053624f, 0.0203627348f},
-std::array<float,2>{0.0203934256f, 0.844705462f},
-std::array<float,2>{0.788063705f, 0.386327475f},
-std::array<float,2>{0.520758569f, 0.984087706f},
-std::array<float,2>{0.330070108f, 0.371166199f},
-std::array<float,2>{0.127325401f, 0.599650562f},
-std::array<float,2>{0.92327404f, 0.229710698f},
-std::array<float,2>{0.872889102f, 0.712942243f},
-std::array<float,2>{0.117385432f, 0.0783733279f},
-std::array<float,2>{0.479580432f, 0.791583538f},
-std::array<float,2>{0.626128316f, 0.478871733f},
-std::array<float,2>{0.994051576f, 0.85668087f},
-std::array<float,2>{0.189082205f, 0.381638765f},
-std::array<float,2>{0.270731241f, 0.668481529f},
-std::array<float,2>{0.613638878f, 0.0292060748f},
-std::array<float,2>{0.701255798f, 0.558047175f},
-std::array<float,2>{0.414515525f, 0.170230523f},
-std::array<float,2>{0.0437970683f, 0.924721956f},
-std::array<float,2>{0.76769793f, 0.266123712f},
-std::array<float,2>{0.683749139f, 0.772586584f},
-std::array<float,2>{0.455872446f, 0.467997938f},
-std::array<float,2>{0.0892225206f, 0.746685326f},
-std::array<float,2>{0.83259815f, 0.119467519f},
-std::array<float,2>{0.87838769f, 0.591678977f},
-std::array<float,2>{0.167480409f, 0.189342007f},
-std::array<float,2>{0.345603913f, 0.957405031f},
-std::array<float,2>{0.53467226f, 0.330152273f},
-std::array<float,2>{0.78925252f, 0.877215981f},
-std::array<float,2>{0.0255597606f, 0.281782508f},
-std::array<float,2>{0.394794822f, 0.500375152f},
-std::array<float,2>{0.720658779f, 0.149083599f},
-std::array<float,2>{0.591283917f, 0.631289661f},
-std::array<float,2>{0.294695914f, 0.0428111404f},
-std::array<float,2>{0.247518733f, 0.838942409f},
-std::array<float,2>{0.95373714f, 0.416853577f},
-std::array<float,2>{0.749812663f, 0.90979749f},
-std::array<float,2>{0.37996009f, 0.259087205f},
-std::array<float,2>{0.00367970532f, 0.540130794f},
-std::array<float,2>{0.808826208f, 0.185169235f},
-std::array<float,2>{0.952492356f, 0.674090147f},
-std::array<float,2>{0.230640769f, 0.0062178513f},
-std::array<float,2>{0.309307754f, 0.874221563f},
-std::array<float,2>{0.563369989f, 0.391864151f},
-std::array<float,2>{0.819598854f, 0.808224797f},
-std::array<float,2>{0.0641191378f, 0.492510855f},
-std::array<float,2>{0.447976232f, 0.689286113f},
-std::array<float,2>{0.660567701f, 0.0769114941f},
-std::array<float,2>{0.558775544f, 0.621055961f},
-std::array<float,2>{0.366660237f, 0.244670302f},
-std::array<float,2>{0.177308768f, 0.986216664f},
-std::array<float,2>{0.891155303f, 0.344311148f},
-std::array<float,2>{0.596201837f, 0.821826398f},
-std::array<float,2>{0.265241385f, 0.427719355f},
-std::array<float,2>{0.218325838f, 0.645564735f},
-std::array<float,2>{0.969193161f, 0.0509036779f},
-std::array<float,2>{0.750665128f, 0.525915086f},
-std::array<float,2>{0.0475695878f, 0.131911397f},
-std::array<float,2>{0.429469019f, 0.89670068f},
-std::array<float,2>{0.709522367f, 0.306739241f},
-std::array<float,2>{0.920733094f, 0.941504657f},
-std::array<float,2>{0.141839996f, 0.317573905f},
-std::array<float,2>{0.324887097f, 0.574434996f},
-std::array<float,2>{0.509278059f, 0.213508606f},
-std::array<float,2>{0.654600441f, 0.728915334f},
-std::array<float,2>{0.496527493f, 0.09433911f},
-std::array<float,2>{0.106401019f, 0.760192275f},
-std::array<float,2>{0.85858649f, 0.444549263f},
-std::array<float,2>{0.55042994f, 0.92964381f},
-std::array<float,2>{0.373449296f, 0.270080686f},
-std::array<float,2>{0.182646647f, 0.558665454f},
-std::array<float,2>{0.903715014f, 0.165886536f},
-std::array<float,2>{0.824284971f, 0.667279661f},
-std::array<float,2>{0.0774050802f, 0.026874518f},
-std::array<float,2>{0.439710915f, 0.853044033f},
-std::array<float,2>{0.66575706f, 0.377440602f},
-std::array<float,2>{0.938971758f, 0.79628545f},
-std::array<float,2>{0.222434551f, 0.482531965f},
-std::array<float,2>{0.298228323f, 0.716714323f},
-std::array<float,2>{0.572928309f, 0.0832076669f},
-std::array<float,2>{0.735269785f, 0.597107291f},
-std::array<float,2>{0.387405097f, 0.230545431f},
-std::array<float,2>{0.0122794379f, 0.978923261f},
-std::array<float,2>{0.802084267f, 0.369905949f},
-std::array<float,2>{0.64233011f, 0.841134012f},
-std::array<float,2>{0.487496495f, 0.421153247f},
-std::array<float,2>{0.0979453698f, 0.628523648f},
-std::array<float,2>{0.843780577f, 0.0432382226f},
-std::array<float,2>{0.912816167f, 0.506388843f},
-std::array<float,2>{0.15541631f, 0.155595973f},
-std::array<float,2>{0.319091529f, 0.882452011f},
-std::array<float,2>{0.505806386f, 0.287746489f},
-std::array<float,2>{0.760312796f, 0.955628633f},
-std::array<float,2>{0.0571762919f, 0.335455239f},
-std::array<float,2>{0.429946125f, 0.586439967f},
-std::array<float,2>{0.713147461f, 0.194287688f},
-std::array<float,2>{0.607749522f, 0.745216131f},
-std::array<float,2>{0.253087372f, 0.121600658f},
-std::array<float,2>{0.205564573f, 0.768780529f},
-std::array<float,2>{0.983088195f, 0.463064551f},
-std::array<float,2>{0.693948209f, 0.990717769f},
-std::array<float,2>{0.40945971f, 0.350040972f},
-std::array<float,2>{0.0329100639f, 0.624065578f},
-std::array<float,2>{0.778874934f, 0.248913288f},
-std::array<float,2>{0.984572947f, 0.693687797f},
-std::array<float,2>{0.200180471f, 0.0709753931f},
-std::array<float,2>{0.278022379f, 0.809554577f},
-std::array<float,2>{0.620936453f, 0.497088403f},
-std::array<float,2>{0.864954114f, 0.869721115f},
-std::array<float,2>{0.110448264f, 0.394874305f},
-std::array<float,2>{0.475574017f, 0.678440511f},
-std::array<float,2>{0.63974601f, 0.000378354685f},
-std::array<float,2>{0.524710596f, 0.544680417f},
-std::array<float,2>{0.341832757f, 0.182169363f},
-std::array<float,2>{0.138549387f, 0.91209656f},
-std::array<float,2>{0.936990142f, 0.262040764f},
-std::array<float,2>{0.584068894f, 0.763668418f},
-std::array<float,2>{0.288513631f, 0.44046697f},
-std::array<float,2>{0.238640919f, 0.730947971f},
-std::array<float,2>{0.961555719f, 0.0976722017f},
-std::array<float,2>{0.783855677f, 0.572627783f},
-std::array<float,2>{0.0171652418f, 0.216105208f},
-std::array<float,2>{0.404800475f, 0.939998746f},
-std::array<float,2>{0.730223298f, 0.313609868f},
-std::array<float,2>{0.887264252f, 0.892651141f},
-std::array<float,2>{0.160868928f, 0.310479015f},
-std::array<float,2>{0.358288974f, 0.528322875f},
-std::array<float,2>{0.543573439f, 0.125479341f},
-std::array<float,2>{0.674617469f, 0.64406389f},
-std::array<float,2>{0.462234259f, 0.0484648272f},
-std::array<float,2>{0.0850799307f, 0.825155556f},
-std::array<float,2>{0.83960259f, 0.422263026f},
-std::array<float,2>{0.612455189f, 0.952856183f},
-std::array<float,2>{0.266216546f, 0.327127457f},
-std::array<float,2>{0.192038104f, 0.566133976f},
-std::array<float,2>{0.998914123f, 0.210021779f},
-std::array<float,2>{0.771086395f, 0.722767413f},
-std::array<float,2>{0.0419092849f, 0.10937383f},
-std::array<float,2>{0.4193151f, 0.756001711f},
-std::array<float,2>{0.698390245f, 0.450513065f},
-std::array<float,2>{0.929119647f, 0.816179097f},
-std::array<float,2>{0.13248387f, 0.431716621f},
-std::array<float,2>{0.3352561f, 0.655314505f},
-std::array<float,2>{0.516384542f, 0.0563995652f},
-std::array<float,2>{0.63148582f, 0.522634268f},
-std::array<float,2>{0.481516749f, 0.137615725f},
-std::array<float,2>{0.122108057f, 0.906246066f},
-std::array<float,2>{0.8679052f, 0.303395808f},
-std::array<float,2>{0.722891033f, 0.803006828f},
-std::array<float,2>{0.392327785f, 0.485325843f},
-std::array<float,2>{0.0275350418f, 0.699391901f},
-std::array<float,2>{0.793833971f, 0.0666017756f},
-std::array<float,2>{0.958751559f, 0.615452766f},
-std::array<float,2>{0.242918611f, 0.235232547f},
-std::array<float,2>{0.290343046f, 0.99239862f},
-std::array<float,2>{0.589130521f, 0.358932972f},
-std::array<float,2>{0.828316331f, 0.920294583f},
-std::array<float,2>{0.0906217545f, 0.254996479f},
-std::array<float,2>{0.458213449f, 0.532772422f},
-std::array<float,2>{0.679705024f, 0.175126761f},
-std::array<float,2>{0.536706746f, 0.685730875f},
-std::array<float,2>{0.349874794f, 0.00948538072f},
-std::array<float,2>{0.167999849f, 0.862106025f},
-std::array<float,2>{0.882401526f, 0.402701169f},
-std::array<float,2>{0.659554541f, 0.884432077f},
-std::array<float,2>{0.450763524f, 0.293806612f},
-std::array<float,2>{0.0693790168f, 0.515088379f},
-std::array<float,2>{0.814555466f, 0.146750003f},
-std::array<float,2>{0.896090865f, 0.638504446f},
-std::array<float,2>{0.175581962f, 0.0344050489f},
-std::array<float,2>{0.36250481f, 0.835487664f},
-std::array<float,2>{0.557289243f, 0.408085942f},
-std::array<float,2>{0.805184782f, 0.776289284f},
-std::array<float,2>{0.00494876271f, 0.459896892f},
-std::array<float,2>{0.377352566f, 0.736798227f},
-std::array<float,2>{0.74265331f, 0.110659108f},
-std::array<float,2>{0.569711149f, 0.580489516f},
-std::array<float,2>{0.307381153f, 0.200274304f},
-std::array<float,2>{0.226705998f, 0.962644458f},
-std::array<float,2>{0.946345866f, 0.342279851f},
-std::array<float,2>{0.513527453f, 0.85077244f},
-std::array<float,2>{0.322819352f, 0.388598561f},
-std::array<float,2>{0.145492747f, 0.657061696f},
-std::array<float,2>{0.917007327f, 0.0178924277f},
-std::array<float,2>{0.854718149f, 0.552818418f},
-std::array<float,2>{0.103709608f, 0.159967139f},
-std::array<float,2>{0.495065182f, 0.935959041f},
-std::array<float,2>{0.648476064f, 0.275780648f},
-std::array<float,2>{0.975718677f, 0.975205958f},
-std::array<float,2>{0.212276921f, 0.359759182f},
-std::array<float,2>{0.261097878f, 0.608783722f},
-std::array<float,2>{0.598095596f, 0.222898602f},
-std::array<float,2>{0.705806136f, 0.70360291f},
-std::array<float,2>{0.422367811f, 0.0913401246f},
-std::array<float,2>{0.051025819f, 0.782738268f},
-std::array<float,2>{0.755235374f, 0.476116925f},
-std::array<float,2>{0.604462028f, 0.917212367f},
-std::array<float,2>{0.256916344f, 0.25047645f},
-std::array<float,2>{0.208065748f, 0.538312078f},
-std::array<float,2>{0.980085552f, 0.17943567f},
-std::array<float,2>{0.764141321f, 0.680450201f},
-std::array<float,2>{0.0623522066f, 0.0139338467f},
-std::array<float,2>{0.433884501f, 0.864580274f},
-std::array<float,2>{0.715623021f, 0.400112212f},
-std::array<float,2>{0.908809841f, 0.797665715f},
-std::array<float,2>{0.151352942f, 0.491043836f},
-std::array<float,2>{0.313104838f, 0.699135423f},
-std::array<float,2>{0.500041842f, 0.0631831586f},
-std::array<float,2>{0.646743298f, 0.612077475f},
-std::array<float,2>{0.491163999f, 0.240404084f},
-std::array<float,2>{0.0963326097f, 0.998244584f},
-std::array<float,2>{0.851248085f, 0.351851404f},
-std::array<float,2>{0.740547299f, 0.819242179f},
-std::array<float,2>{0.385218054f, 0.435646832f},
-std::array<float,2>{0.0110194543f, 0.6507532f},
-std::array<float,2>{0.800628245f, 0.0587862134f},
-std::array<float,2>{0.942199707f, 0.518949032f},
-std::array<float,2>{0.223259911f, 0.135549664f},
-std::array<float,2>{0.302177817f, 0.900891602f},
-std::array<float,2>{0.576959908f, 0.298252136f},
-std::array<float,2>{0.820878625f, 0.94786036f},
-std::array<float,2>{0.0711880103f, 0.321915448f},
-std::array<float,2>{0.445159346f, 0.566519201f},
-std::array<float,2>{0.670045197f, 0.204538852f},
-std::array<float,2>{0.554114103f, 0.720042467f},
-std::array<float,2>{0.3693946f, 0.103686586f},
-std::array<float,2>{0.185089186f, 0.752761185f},
-std::array<float,2>{0.90178895f, 0.449005306f},
-std::array<float,2>{0.67805469f, 0.972363889f},
-std::array<float,2>{0.46519208f, 0.363869339f},
-std::array<float,2>{0.0818443149f, 0.603491008f},
-std::array<float,2>{0.840879023f, 0.221406132f},
-std::array<float,2>{0.884694338f, 0.710030973f},
-std::array<float,2>{0.159553736f, 0.0885279775f},
-std::array<float,2>{0.354005694f, 0.787925959f},
-std::array<float,2>{0.540340066f, 0.470602512f},
-std::array<float,2>{0.78656131f, 0.846257806f},
-std::array<float,2>{0.0222425163f, 0.383533806f},
-std::array<float,2>{0.399597645f, 0.661253691f},
-std::array<float,2>{0.730888188f, 0.0227674618f},
-std::array<float,2>{0.580366433f, 0.550337136f},
-std::array<float,2>{0.281757802f, 0.163021028f},
-std::array<float,2>{0.238150656f, 0.933113456f},
-std::array<float,2>{0.967803478f, 0.279526532f},
-std::array<float,2>{0.529855132f, 0.778006315f},
-std::array<float,2>{0.338137418f, 0.455439299f},
-std::array<float,2>{0.134767786f, 0.738926411f},
-std::array<float,2>{0.931015611f, 0.116114274f},
-std::array<float,2>{0.860205889f, 0.584679961f},
-std::array<float,2>{0.113770731f, 0.196127295f},
-std::array<float,2>{0.471126169f, 0.966547847f},
-std::array<float,2>{0.63615799f, 0.338090897f},
-std::array<float,2>{0.990815222f, 0.889179885f},
-std::array<float,2>{0.196618423f, 0.289077729f},
-std::array<float,2>{0.27482152f, 0.510608494f},
-std::array<float,2>{0.622735918f, 0.142827585f},
-std::array<float,2>{0.688531458f, 0.633493066f},
-std::array<float,2>{0.412495494f, 0.0356237516f},
-std::array<float,2>{0.0371768288f, 0.829220116f},
-std::array<float,2>{0.77455622f, 0.411661297f},
-std::array<float,2>{0.533028185f, 0.959627271f},
-std::array<float,2>{0.346073478f, 0.328431457f},
-std::array<float,2>{0.165256158f, 0.592615485f},
-std::array<float,2>{0.876496136f, 0.190757245f},
-std::array<float,2>{0.835770786f, 0.749975979f},
-std::array<float,2>{0.0873399302f, 0.117640652f},
-std::array<float,2>{0.453206122f, 0.769696712f},
-std::array<float,2>{0.686092436f, 0.466514617f},
-std::array<float,2>{0.955315471f, 0.836162746f},
-std::array<float,2>{0.248056695f, 0.414903194f},
-std::array<float,2>{0.294986427f, 0.630501568f},
-std::array<float,2>{0.592308521f, 0.0391859189f},
-std::array<float,2>{0.7218135f, 0.503610611f},
-std::array<float,2>{0.398143649f, 0.15107967f},
-std::array<float,2>{0.0245529506f, 0.876597404f},
-std::array<float,2>{0.791451752f, 0.283801854f},
-std::array<float,2>{0.628293872f, 0.79068023f},
-std::array<float,2>{0.478172898f, 0.477627337f},
-std::array<float,2>{0.120569333f, 0.712070405f},
-std::array<float,2>{0.874614239f, 0.0818330795f},
-std::array<float,2>{0.924572408f, 0.599109232f},
-std::array<float,2>{0.125473619f, 0.226991355f},
-std::array<float,2>{0.330748409f, 0.981203496f},
-std::array<float,2>{0.523130298f, 0.374397188f},
-std::array<float,2>{0.765626431f, 0.923800528f},
-std::array<float,2>{0.0462787151f, 0.269183457f},
-std::array<float,2>{0.416048676f, 0.555244684f},
-std::array<float,2>{0.700615942f, 0.168952242f},
-std::array<float,2>{0.615444303f, 0.670646846f},
-std::array<float,2>{0.271876812f, 0.0293435249f},
-std::array<float,2>{0.190691456f, 0.857997119f},
-std::array<float,2>{0.995885074f, 0.379468769f},
-std::array<float,2>{0.707075357f, 0.896295905f},
-std::array<float,2>{0.425925016f, 0.30636102f},
-std::array<float,2>{0.0489419065f, 0.525302112f},
-std::array<float,2>{0.75344944f, 0.129070818f},
-std::array<float,2>{0.972268164f, 0.64773345f},
-std::array<float,2>{0.214986876f, 0.0531273969f},
-std::array<float,2>{0.262497365f, 0.822633147f},
-std::array<float,2>{0.594454587f, 0.428584576f},
-std::array<float,2>{0.855808318f, 0.758880258f},
-std::array<float,2>{0.109266162f, 0.441692621f},
-std::array<float,2>{0.498258203f, 0.727197111f},
-std::array<float,2>{0.653925717f, 0.096812278f},
-std::array<float,2>{0.509932458f, 0.577237487f},
-std::array<float,2>{0.327188492f, 0.211287007f},
-std::array<float,2>{0.14417772f, 0.945048094f},
-std::array<float,2>{0.918039739f, 0.319050103f},
-std::array<float,2>{0.565473497f, 0.871243477f},
-std::array<float,2>{0.310658306f, 0.392883062f},
-std::array<float,2>{0.233402684f, 0.672618449f},
-std::array<float,2>{0.95073837f, 0.00421897555f},
-std::array<float,2>{0.811724722f, 0.541413546f},
-std::array<float,2>{0.00105895137f, 0.186246186f},
-std::array<float,2>{0.382090688f, 0.907080889f},
-std::array<float,2>{0.746890903f, 0.260775864f},
-std::array<float,2>{0.892610073f, 0.986872733f},
-std::array<float,2>{0.178107649f, 0.347451597f},
-std::array<float,2>{0.363958716f, 0.618680596f},
-std::array<float,2>{0.561592102f, 0.243405625f},
-std::array<float,2>{0.663239777f, 0.689696133f},
-std::array<float,2>{0.446116328f, 0.0757753029f},
-std::array<float,2>{0.0648400933f, 0.805542886f},
-std::array<float,2>{0.816901803f, 0.494626164f},
-std::array<float,2>{0.506278157f, 0.88042599f},
-std::array<float,2>{0.317624301f, 0.28541553f},
-std::array<float,2>{0.153755188f, 0.505692184f},
-std::array<float,2>{0.910180151f, 0.152859002f},
-std::array<float,2>{0.847348034f, 0.626619339f},
-std::array<float,2>{0.100085735f, 0.0457941927f},
-std::array<float,2>{0.484583706f, 0.841852248f},
-std::array<float,2>{0.644217849f, 0.418347239f},
-std::array<float,2>{0.981652617f, 0.76617521f},
-std::array<float,2>{0.204024017f, 0.461222172f},
-std::array<float,2>{0.251304507f, 0.743427575f},
-std::array<float,2>{0.606626451f, 0.124937959f},
-std::array<float,2>{0.712244213f, 0.589801669f},
-std::array<float,2>{0.431843758f, 0.192055091f},
-std::array<float,2>{0.0549341217f, 0.954509139f},
-std::array<float,2>{0.758760035f, 0.333413512f},
-std::array<float,2>{0.666264713f, 0.854529738f},
-std::array<float,2>{0.438438207f, 0.375333816f},
-std::array<float,2>{0.0751450732f, 0.665274143f},
-std::array<float,2>{0.827642262f, 0.0240313336f},
-std::array<float,2>{0.904635251f, 0.561525285f},
-std::array<float,2>{0.18130599f, 0.167540267f},
-std::array<float,2>{0.37291041f, 0.926638484f},
-std::array<float,2>{0.548186958f, 0.271524101f},
-std::array<float,2>{0.802874029f, 0.977110982f},
-std::array<float,2>{0.0152155906f, 0.36894387f},
-std::array<float,2>{0.388941228f, 0.594901383f},
-std::array<float,2>{0.738170743f, 0.233508632f},
-std::array<float,2>{0.571565151f, 0.716911495f},
-std::array<float,2>{0.299862206f, 0.0852922052f},
-std::array<float,2>{0.220579207f, 0.792990029f},
-std::array<float,2>{0.940941393f, 0.48106733f},
-std::array<float,2>{0.728135526f, 0.93775022f},
-std::array<float,2>{0.403479159f, 0.314673603f},
-std::array<float,2>{0.0192809701f, 0.57176131f},
-std::array<float,2>{0.782716513f, 0.218525618f},
-std::array<float,2>{0.96398443f, 0.733588159f},
-std::array<float,2>{0.241311997f, 0.100479402f},
-std::array<float,2>{0.286520839f, 0.764910877f},
-std::array<float,2>{0.582289755f, 0.439387709f},
-std::array<float,2>{0.836503029f, 0.82744348f},
-std::array<float,2>{0.0832058787f, 0.423901975f},
-std::array<float,2>{0.464834541f, 0.642409563f},
-std::array<float,2>{0.673293173f, 0.0496840626f},
-std::array<float,2>{0.545580864f, 0.531240404f},
-std::array<float,2>{0.35567537f, 0.127602369f},
-std::array<float,2>{0.163682148f, 0.890886545f},
-std::array<float,2>{0.888957739f, 0.311875135f},
-std::array<float,2>{0.617906511f, 0.811753809f},
-std::array<float,2>{0.279952824f, 0.499134421f},
-std::array<float,2>{0.201679468f, 0.691477299f},
-std::array<float,2>{0.988267243f, 0.0740860477f},
-std::array<float,2>{0.780524194f, 0.622822642f},
-std::array<float,2>{0.0348176919f, 0.246466428f},
-std::array<float,2>{0.406863987f, 0.988898993f},
-std::array<float,2>{0.692506552f, 0.348572522f},
-std::array<float,2>{0.934284747f, 0.913157701f},
-std::array<float,2>{0.139990792f, 0.264545947f},
-std::array<float,2>{0.34044838f, 0.545759439f},
-std::array<float,2>{0.525502264f, 0.180633768f},
-std::array<float,2>{0.638579249f, 0.676903784f},
-std::array<float,2>{0.47393465f, 0.00327480468f},
-std::array<float,2>{0.112761296f, 0.867210865f},
-std::array<float,2>{0.866179049f, 0.398200929f},
-std::array<float,2>{0.586476564f, 0.994287729f},
-std::array<float,2>{0.291947454f, 0.356054246f},
-std::array<float,2>{0.244519442f, 0.613975286f},
-std::array<float,2>{0.95910871f, 0.237437472f},
-std::array<float,2>{0.795315742f, 0.702628672f},
-std::array<float,2>{0.0306290407f, 0.0689164624f},
-std::array<float,2>{0.393079758f, 0.800939202f},
-std::array<float,2>{0.72508949f, 0.486471206f},
-std::array<float,2>{0.879655421f, 0.859468818f},
-std::array<float,2>{0.171339005f, 0.405541122f},
-std::array<float,2>{0.348352939f, 0.68365556f},
-std::array<float,2>{0.53741622f, 0.0113773262f},
-std::array<float,2>{0.683257818f, 0.533969223f},
-std::array<float,2>{0.459616363f, 0.172741085f},
-std::array<float,2>{0.0934509858f, 0.918823361f},
-std::array<float,2>{0.831590891f, 0.256080925f},
-std::array<float,2>{0.695844114f, 0.755820274f},
-std::array<float,2>{0.420957565f, 0.453073084f},
-std::array<float,2>{0.0404643379f, 0.726063669f},
-std::array<float,2>{0.771611035f, 0.10690923f},
-std::array<float,2>{0.99639076f, 0.563942313f},
-std::array<float,2>{0.194692403f, 0.208564058f},
-std::array<float,2>{0.2695041f, 0.949643016f},
-std::array<float,2>{0.609547436f, 0.325352758f},
-std::array<float,2>{0.870359063f, 0.903591514f},
-std::array<float,2>{0.123581655f, 0.301119536f},
-std::array<float,2>{0.483402789f, 0.520552039f},
-std::array<float,2>{0.630182385f, 0.140541315f},
-std::array<float,2>{0.518542528f, 0.653359711f},
-std::array<float,2>{0.333456993f, 0.0582508482f},
-std::array<float,2>{0.129120573f, 0.814179718f},
-std::array<float,2>{0.926098406f, 0.430502743f},
-std::array<float,2>{0.652249575f, 0.933663189f},
-std::array<float,2>{0.492220253f, 0.273612797f},
-std::array<float,2>{0.103454657f, 0.552123487f},
-std::array<float,2>{0.851743758f, 0.157311454f},
-std::array<float,2>{0.9154827f, 0.659532368f},
-std::array<float,2>{0.148048177f, 0.0164012928f},
-std::array<float,2>{0.322035193f, 0.84909302f},
-std::array<float,2>{0.513684273f, 0.389869183f},
-std::array<float,2>{0.756715298f, 0.784589767f},
-std::array<float,2>{0.0528277382f, 0.474217474f},
-std::array<float,2>{0.425145417f, 0.705236197f},
-std::array<float,2>{0.704201162f, 0.0920739621f},
-std::array<float,2>{0.600250185f, 0.605903506f},
-std::array<float,2>{0.258395523f, 0.226291239f},
-std::array<float,2>{0.212982446f, 0.972719967f},
-std::array<float,2>{0.973027647f, 0.362475932f},
-std::array<float,2>{0.555901468f, 0.832067668f},
-std::array<float,2>{0.360876054f, 0.409247696f},
-std::array<float,2>{0.173279062f, 0.639383376f},
-std::array<float,2>{0.896841109f, 0.0323178731f},
-std::array<float,2>{0.813616455f, 0.512299478f},
-std::array<float,2>{0.0666919649f, 0.145544499f},
-std::array<float,2>{0.451564699f, 0.886307538f},
-std::array<float,2>{0.658078134f, 0.295104086f},
-std::array<float,2>{0.947817564f, 0.96448946f},
-std::array<float,2>{0.229401976f, 0.341094971f},
-std::array<float,2>{0.304752022f, 0.579806328f},
-std::array<float,2>{0.567227721f, 0.201291889f},
-std::array<float,2>{0.745800316f, 0.73527652f},
-std::array<float,2>{0.376750469f, 0.113196768f},
-std::array<float,2>{0.00690068072f, 0.773453236f},
-std::array<float,2>{0.808385789f, 0.457830489f},
-std::array<float,2>{0.562553287f, 0.906361341f},
-std::array<float,2>{0.308717251f, 0.26160869f},
-std::array<float,2>{0.231059551f, 0.541782856f},
-std::array<float,2>{0.952970684f, 0.18602331f},
-std::array<float,2>{0.809414148f, 0.672044635f},
-std::array<float,2>{0.00316554122f, 0.00474880449f},
-std::array<float,2>{0.380713105f, 0.871594608f},
-std::array<float,2>{0.749345183f, 0.393425018f},
-std::array<float,2>{0.89088738f, 0.80472064f},
-std::array<float,2>{0.176976159f, 0.494746476f},
-std::array<float,2>{0.36710155f, 0.690080047f},
-std::array<float,2>{0.559468746f, 0.07543917f},
-std::array<float,2>{0.661085367f, 0.618234873f},
-std::array<float,2>{0.447476834f, 0.244130686f},
-std::array<float,2>{0.0637336746f, 0.98643887f},
-std::array<float,2>{0.81983465f, 0.347094417f},
-std::array<float,2>{0.709045053f, 0.822860122f},
-std::array<float,2>{0.429058105f, 0.428083211f},
-std::array<float,2>{0.0469813757f, 0.648254156f},
-std::array<float,2>{0.750436306f, 0.0533038341f},
-std::array<float,2>{0.969653726f, 0.524427772f},
-std::array<float,2>{0.218234032f, 0.129674613f},
-std::array<float,2>{0.265075117f, 0.895988345f},
-std::array<float,2>{0.595901787f, 0.306150526f},
-std::array<float,2>{0.859158456f, 0.944526374f},
-std::array<float,2>{0.10593348f, 0.318717778f},
-std::array<float,2>{0.496861488f, 0.577806652f},
-std::array<float,2>{0.654958785f, 0.211818486f},
-std::array<float,2>{0.508845568f, 0.726843655f},
-std::array<float,2>{0.324633539f, 0.0975335315f},
-std::array<float,2>{0.142094791f, 0.759287417f},
-std::array<float,2>{0.920175493f, 0.442242384f},
-std::array<float,2>{0.626497269f, 0.980898321f},
-std::array<float,2>{0.480141252f, 0.374557763f},
-std::array<float,2>{0.117974475f, 0.599326074f},
-std::array<float,2>{0.872083068f, 0.22736825f},
-std::array<float,2>{0.923447371f, 0.712556839f},
-std::array<float,2>{0.127841011f, 0.0810596421f},
-std::array<float,2>{0.329110295f, 0.790153086f},
-std::array<float,2>{0.52143538f, 0.478313208f},
-std::array<float,2>{0.768439889f, 0.857816935f},
-std::array<float,2>{0.0433954f, 0.379148364f},
-std::array<float,2>{0.414961129f, 0.66996336f},
-std::array<float,2>{0.702093303f, 0.0300366729f},
-std::array<float,2>{0.61385268f, 0.555171311f},
-std::array<float,2>{0.271115363f, 0.169806167f},
-std::array<float,2>{0.188496023f, 0.923064113f},
-std::array<float,2>{0.993204892f, 0.268673807f},
-std::array<float,2>{0.534273565f, 0.770080745f},
-std::array<float,2>{0.345126778f, 0.46626839f},
-std::array<float,2>{0.167803079f, 0.749329507f},
-std::array<float,2>{0.878553927f, 0.118108213f},
-std::array<float,2>{0.832200766f, 0.59225899f},
-std::array<float,2>{0.0895311385f, 0.191016406f},
-std::array<float,2>{0.455154747f, 0.959305704f},
-std::array<float,2>{0.684176207f, 0.329002827f},
-std::array<float,2>{0.953247309f, 0.876176119f},
-std::array<float,2>{0.247987688f, 0.28335914f},
-std::array<float,2>{0.29419893f, 0.50314939f},
-std::array<float,2>{0.5916996f, 0.150677577f},
-std::array<float,2>{0.720151961f, 0.630213737f},
-std::array<float,2>{0.395130038f, 0.0397313982f},
-std::array<float,2>{0.026275618f, 0.83682245f},
-std::array<float,2>{0.789844871f, 0.41440016f},
-std::array<float,2>{0.52753222f, 0.965825796f},
-std::array<float,2>{0.337084919f, 0.338392973f},
-std::array<float,2>{0.13402088f, 0.584306359f},
-std::array<float,2>{0.93207103f, 0.195459798f},
-std::array<float,2>{0.86232394f, 0.738319039f},
-std::array<float,2>{0.11524871f, 0.115549609f},
-std::array<float,2>{0.469418883f, 0.777408123f},
-std::array<float,2>{0.633092344f, 0.455666512f},
-std::array<float,2>{0.989131033f, 0.829611599f},
-std::array<float,2>{0.198659167f, 0.411461204f},
-std::array<float,2>{0.27543509f, 0.632817686f},
-std::array<float,2>{0.624136806f, 0.0360400639f},
-std::array<float,2>{0.690962553f, 0.51009953f},
-std::array<float,2>{0.410735726f, 0.143470719f},
-std::array<float,2>{0.0353208669f, 0.888822496f},
-std::array<float,2>{0.776229441f, 0.28963384f},
-std::array<float,2>{0.677307129f, 0.787568927f},
-std::array<float,2>{0.468009412f, 0.469938427f},
-std::array<float,2>{0.0783056915f, 0.710859954f},
-std::array<float,2>{0.842243731f, 0.0881419778f},
-std::array<float,2>{0.886080623f, 0.602671206f},
-std::array<float,2>{0.156694219f, 0.220919579f},
-std::array<float,2>{0.352125287f, 0.971929133f},
-std::array<float,2>{0.541171908f, 0.36339891f},
-std::array<float,2>{0.787584901f, 0.933095455f},
-std::array<float,2>{0.0197332241f, 0.279987872f},
-std::array<float,2>{0.401789039f, 0.550215185f},
-std::array<float,2>{0.73275274f, 0.162131205f},
-std::array<float,2>{0.578738809f, 0.661804676f},
-std::array<float,2>{0.284078807f, 0.0233388189f},
-std::array<float,2>{0.2345341f, 0.845804453f},
-std::array<float,2>{0.96486026f, 0.382992029f},
-std::array<float,2>{0.739162147f, 0.900710821f},
-std::array<float,2>{0.38370046f, 0.298784286f},
-std::array<float,2>{0.00854851399f, 0.519388139f},
-std::array<float,2>{0.79793036f, 0.13487193f},
-std::array<float,2>{0.945009291f, 0.651294172f},
-std::array<float,2>{0.22629717f, 0.0592046008f},
-std::array<float,2>{0.3037332f, 0.81842649f},
-std::array<float,2>{0.574737012f, 0.436324835f},
-std::array<float,2>{0.82409668f, 0.751992702f},
-std::array<float,2>{0.0736479834f, 0.448518366f},
-std::array<float,2>{0.44326064f, 0.720658779f},
-std::array<float,2>{0.668864071f, 0.104034737f},
-std::array<float,2>{0.552144051f, 0.567131221f},
-std::array<float,2>{0.367684394f, 0.204712942f},
-std::array<float,2>{0.186177507f, 0.94749707f},
-std::array<float,2>{0.898574114f, 0.321514964f},
-std::array<float,2>{0.601844847f, 0.865108728f},
-std::array<float,2>{0.255075425f, 0.39942053f},
-std::array<float,2>{0.209740207f, 0.679846525f},
-std::array<float,2>{0.978337646f, 0.014406207f},
-std::array<float,2>{0.762220442f, 0.538740396f},
-std::array<float,2>{0.0586927943f, 0.179095194f},
-std::array<float,2>{0.436131924f, 0.917521417f},
-std::array<float,2>{0.717851877f, 0.250938088f},
-std::array<float,2>{0.907132387f, 0.99895668f},
-std::array<float,2>{0.14906393f, 0.352152824f},
-std::array<float,2>{0.315621346f, 0.61143136f},
-std::array<float,2>{0.503660023f, 0.241001204f},
-std::array<float,2>{0.645679474f, 0.698459029f},
-std::array<float,2>{0.489266843f, 0.0625720844f},
-std::array<float,2>{0.0937648192f, 0.796930552f},
-std::array<float,2>{0.84872371f, 0.490701079f},
-std::array<float,2>{0.556652009f, 0.885944963f},
-std::array<float,2>{0.363137543f, 0.295877635f},
-std::array<float,2>{0.175128758f, 0.511835098f},
-std::array<float,2>{0.895872831f, 0.146026388f},
-std::array<float,2>{0.815285921f, 0.638856411f},
-std::array<float,2>{0.0700446591f, 0.0331692658f},
-std::array<float,2>{0.450451732f, 0.83268702f},
-std::array<float,2>{0.659966409f, 0.4097853f},
-std::array<float,2>{0.947201073f, 0.774310112f},
-std::array<float,2>{0.2272425f, 0.457497478f},
-std::array<float,2>{0.307097167f, 0.734731853f},
-std::array<float,2>{0.569846332f, 0.112450182f},
-std::array<float,2>{0.742766738f, 0.579541981f},
-std::array<float,2>{0.37754783f, 0.201793194f},
-std::array<float,2>{0.00565249566f, 0.963943183f},
-std::array<float,2>{0.805159867f, 0.341682464f},
-std::array<float,2>{0.649196088f, 0.849122465f},
-std::array<float,2>{0.494432181f, 0.390168518f},
-std::array<float,2>{0.104089864f, 0.659700215f},
-std::array<float,2>{0.855379462f, 0.0159711763f},
-std::array<float,2>{0.917953074f, 0.552647233f},
-std::array<float,2>{0.145003587f, 0.157909065f},
-std::array<float,2>{0.322746187f, 0.934325516f},
-std::array<float,2>{0.512996852f, 0.274202496f},
-std::array<float,2>{0.755775154f, 0.973405242f},
-std::array<float,2>{0.0514576398f, 0.363138318f},
-std::array<float,2>{0.422101706f, 0.606418014f},
-std::array<float,2>{0.705104768f, 0.225752175f},
-std::array<float,2>{0.598334491f, 0.705954611f},
-std::array<float,2>{0.261470109f, 0.0925179496f},
-std::array<float,2>{0.212865189f, 0.784787059f},
-std::array<float,2>{0.976336539f, 0.473867267f},
-std::array<float,2>{0.699049771f, 0.949839354f},
-std::array<float,2>{0.419884831f, 0.32616359f},
-std::array<float,2>{0.0410296544f, 0.564164996f},
-std::array<float,2>{0.770818055f, 0.20814538f},
-std::array<float,2>{0.998287737f, 0.726426721f},
-std::array<float,2>{0.191692352f, 0.107120126f},
-std::array<float,2>{0.265784591f, 0.754942656f},
-std::array<float,2>{0.612970829f, 0.452599913f},
-std::array<float,2>{0.867331326f, 0.813740253f},
-std::array<float,2>{0.122575901f, 0.430069476f},
-std::array<float,2>{0.482027858f, 0.654141605f},
-std::array<float,2>{0.631331205f, 0.0579232387f},
-std::array<float,2>{0.515818775f, 0.521250844f},
-std::array<float,2>{0.335838765f, 0.139834121f},
-std::array<float,2>{0.13223055f, 0.904279768f},
-std::array<float,2>{0.929613411f, 0.30162394f},
-std::array<float,2>{0.589393854f, 0.801347077f},
-std::array<float,2>{0.290834695f, 0.486816525f},
-std::array<float,2>{0.242204323f, 0.703058898f},
-std::array<float,2>{0.958419502f, 0.0685506091f},
-std::array<float,2>{0.793440759f, 0.613730431f},
-std::array<float,2>{0.0282464772f, 0.238269195f},
-std::array<float,2>{0.39169687f, 0.995048046f},
-std::array<float,2>{0.723386824f, 0.355808914f},
-std::array<float,2>{0.882279932f, 0.91827625f},
-std::array<float,2>{0.168644518f, 0.256357521f},
-std::array<float,2>{0.350143522f, 0.533641756f},
-std::array<float,2>{0.536358118f, 0.172259748f},
-std::array<float,2>{0.680311441f, 0.684288561f},
-std::array<float,2>{0.458654493f, 0.0108367363f},
-std::array<float,2>{0.0900322124f, 0.85999459f},
-std::array<float,2>{0.828629315f, 0.406209141f},
-std::array<float,2>{0.620588303f, 0.988526523f},
-std::array<float,2>{0.277764887f, 0.348084718f},
-std::array<float,2>{0.199424416f, 0.62216413f},
-std::array<float,2>{0.985262096f, 0.24688299f},
-std::array<float,2>{0.77841866f, 0.692103446f},
-std::array<float,2>{0.0325426906f, 0.0736924186f},
-std::array<float,2>{0.410085708f, 0.812482774f},
-std::array<float,2>{0.693798602f, 0.499562591f},
-std::array<float,2>{0.937125027f, 0.868094027f},
-std::array<float,2>{0.138169289f, 0.397948235f},
-std::array<float,2>{0.342579305f, 0.677474856f},
-std::array<float,2>{0.524913967f, 0.00376015785f},
-std::array<float,2>{0.640345514f, 0.545104504f},
-std::array<float,2>{0.474925399f, 0.179691136f},
-std::array<float,2>{0.110963896f, 0.914044797f},
-std::array<float,2>{0.864313662f, 0.264085114f},
-std::array<float,2>{0.729841232f, 0.765544951f},
-std::array<float,2>{0.404455155f, 0.438952804f},
-std::array<float,2>{0.0170079973f, 0.734300435f},
-std::array<float,2>{0.783675909f, 0.09970323f},
-std::array<float,2>{0.961177289f, 0.571941197f},
-std::array<float,2>{0.238915861f, 0.218261302f},
-std::array<float,2>{0.288722843f, 0.93822515f},
-std::array<float,2>{0.584705651f, 0.315235674f},
-std::array<float,2>{0.838948011f, 0.891586542f},
-std::array<float,2>{0.0854745284f, 0.312414795f},
-std::array<float,2>{0.462564439f, 0.53052187f},
-std::array<float,2>{0.674251199f, 0.127024159f},
-std::array<float,2>{0.543377519f, 0.642021f},
-std::array<float,2>{0.357721478f, 0.0491155572f},
-std::array<float,2>{0.160524771f, 0.827781558f},
-std::array<float,2>{0.88677305f, 0.42453149f},
-std::array<float,2>{0.665237129f, 0.925861955f},
-std::array<float,2>{0.440389961f, 0.272367716f},
-std::array<float,2>{0.0780149326f, 0.562388897f},
-std::array<float,2>{0.824767351f, 0.16734843f},
-std::array<float,2>{0.903862298f, 0.665968299f},
-std::array<float,2>{0.183159769f, 0.0234692432f},
-std::array<float,2>{0.373933345f, 0.855115354f},
-std::array<float,2>{0.550157189f, 0.375746429f},
-std::array<float,2>{0.802660704f, 0.793552816f},
-std::array<float,2>{0.0117401276f, 0.480528504f},
-std::array<float,2>{0.386972487f, 0.71761781f},
-std::array<float,2>{0.734669924f, 0.0856871605f},
-std::array<float,2>{0.57246536f, 0.595609725f},
-std::array<float,2>{0.298797011f, 0.234226778f},
-std::array<float,2>{0.221739531f, 0.977043092f},
-std::array<float,2>{0.938810945f, 0.368388653f},
-std::array<float,2>{0.505196273f, 0.842347622f},
-std::array<float,2>{0.318757802f, 0.418823808f},
-std::array<float,2>{0.155971497f, 0.626162708f},
-std::array<float,2>{0.91231519f, 0.0449546762f},
-std::array<float,2>{0.844568372f, 0.505206466f},
-std::array<float,2>{0.0983584523f, 0.152731508f},
-std::array<float,2>{0.487949818f, 0.879921079f},
-std::array<float,2>{0.641630292f, 0.28606686f},
-std::array<float,2>{0.982472837f, 0.955006123f},
-std::array<float,2>{0.206000552f, 0.33385542f},
-std::array<float,2>{0.25389275f, 0.58928287f},
-std::array<float,2>{0.60833919f, 0.191541553f},
-std::array<float,2>{0.713422596f, 0.743846476f},
-std::array<float,2>{0.430494517f, 0.124310374f},
-std::array<float,2>{0.0566780865f, 0.765879691f},
-std::array<float,2>{0.760019958f, 0.461621851f},
-std::array<float,2>{0.593911469f, 0.897284627f},
-std::array<float,2>{0.262183398f, 0.30752793f},
-std::array<float,2>{0.215496734f, 0.525608659f},
-std::array<float,2>{0.97191596f, 0.132671192f},
-std::array<float,2>{0.753173828f, 0.646017134f},
-std::array<float,2>{0.0495102592f, 0.0516021699f},
-std::array<float,2>{0.426637322f, 0.821694732f},
-std::array<float,2>{0.707613289f, 0.426884532f},
-std::array<float,2>{0.918500245f, 0.760676324f},
-std::array<float,2>{0.143823177f, 0.445176929f},
-std::array<float,2>{0.32787928f, 0.729344904f},
-std::array<float,2>{0.510598004f, 0.0939734206f},
-std::array<float,2>{0.653750837f, 0.574964941f},
-std::array<float,2>{0.49855116f, 0.213101044f},
-std::array<float,2>{0.108705841f, 0.942214608f},
-std::array<float,2>{0.856168926f, 0.318130255f},
-std::array<float,2>{0.746326506f, 0.874933422f},
-std::array<float,2>{0.382803619f, 0.39240399f},
-std::array<float,2>{0.00173435535f, 0.674600363f},
-std::array<float,2>{0.81205833f, 0.00637845322f},
-std::array<float,2>{0.950532436f, 0.540822744f},
-std::array<float,2>{0.234128192f, 0.184713736f},
-std::array<float,2>{0.311497629f, 0.90956229f},
-std::array<float,2>{0.565956831f, 0.259426922f},
-std::array<float,2>{0.816790819f, 0.985469222f},
-std::array<float,2>{0.0650617108f, 0.344091982f},
-std::array<float,2>{0.445667088f, 0.62051928f},
-std::array<float,2>{0.66377902f, 0.244466275f},
-std::array<float,2>{0.562246859f, 0.688753724f},
-std::array<float,2>{0.363557935f, 0.0762112737f},
-std::array<float,2>{0.178320572f, 0.807886302f},
-std::array<float,2>{0.893298328f, 0.492948383f},
-std::array<float,2>{0.685716867f, 0.95799309f},
-std::array<float,2>{0.453930736f, 0.330687344f},
-std::array<float,2>{0.0877882168f, 0.591127336f},
-std::array<float,2>{0.835231662f, 0.188592821f},
-std::array<float,2>{0.876175225f, 0.746415854f},
-std::array<float,2>{0.165748417f, 0.11979647f},
-std::array<float,2>{0.346494615f, 0.773126543f},
-std::array<float,2>{0.532258034f, 0.468330592f},
-std::array<float,2>{0.791591585f, 0.83938235f},
-std::array<float,2>{0.0249165706f, 0.416172743f},
-std::array<float,2>{0.397686601f, 0.631435633f},
-std::array<float,2>{0.72217375f, 0.0421509705f},
-std::array<float,2>{0.592114329f, 0.50090307f},
-std::array<float,2>{0.295508474f, 0.148851886f},
-std::array<float,2>{0.248629496f, 0.877492964f},
-std::array<float,2>{0.955943525f, 0.281439483f},
-std::array<float,2>{0.522929728f, 0.791320086f},
-std::array<float,2>{0.330305487f, 0.479430526f},
-std::array<float,2>{0.125886261f, 0.713549852f},
-std::array<float,2>{0.92382884f, 0.0790525079f},
-std::array<float,2>{0.874111056f, 0.600470424f},
-std::array<float,2>{0.120891362f, 0.230318204f},
-std::array<float,2>{0.477547795f, 0.983846366f},
-std::array<float,2>{0.628582716f, 0.372026175f},
-std::array<float,2>{0.99519521f, 0.924265862f},
-std::array<float,2>{0.191373318f, 0.26589644f},
-std::array<float,2>{0.272257894f, 0.558464944f},
-std::array<float,2>{0.615798295f, 0.170616403f},
-std::array<float,2>{0.700996161f, 0.668429852f},
-std::array<float,2>{0.416553229f, 0.0286605954f},
-std::array<float,2>{0.046553053f, 0.85716188f},
-std::array<float,2>{0.766163051f, 0.380931079f},
-std::array<float,2>{0.540655434f, 0.970310271f},
-std::array<float,2>{0.353779525f, 0.365697175f},
-std::array<float,2>{0.16010648f, 0.604115427f},
-std::array<float,2>{0.883958638f, 0.219561562f},
-std::array<float,2>{0.841778219f, 0.707915783f},
-std::array<float,2>{0.0811851919f, 0.0862746611f},
-std::array<float,2>{0.46550855f, 0.785818517f},
-std::array<float,2>{0.67825079f, 0.471255332f},
-std::array<float,2>{0.968633652f, 0.844141304f},
-std::array<float,2>{0.23735489f, 0.385910273f},
-std::array<float,2>{0.281725675f, 0.663547635f},
-std::array<float,2>{0.580653489f, 0.0199424345f},
-std::array<float,2>{0.73122865f, 0.548237622f},
-std::array<float,2>{0.400285304f, 0.160774872f},
-std::array<float,2>{0.0214992631f, 0.930439591f},
-std::array<float,2>{0.786635518f, 0.278772354f},
-std::array<float,2>{0.636297762f, 0.780869901f},
-std::array<float,2>{0.471669734f, 0.453346401f},
-std::array<float,2>{0.113388292f, 0.741716981f},
-std::array<float,2>{0.859423459f, 0.113620877f},
-std::array<float,2>{0.931549609f, 0.583400846f},
-std::array<float,2>{0.135262713f, 0.197289959f},
-std::array<float,2>{0.338510156f, 0.967364609f},
-std::array<float,2>{0.529461026f, 0.336077362f},
-std::array<float,2>{0.775024474f, 0.886952758f},
-std::array<float,2>{0.0377319008f, 0.291183144f},
-std::array<float,2>{0.412911505f, 0.509605527f},
-std::array<float,2>{0.68928194f, 0.142398953f},
-std::array<float,2>{0.622114539f, 0.635707915f},
-std::array<float,2>{0.2751908f, 0.037407387f},
-std::array<float,2>{0.196959108f, 0.830650151f},
-std::array<float,2>{0.990418136f, 0.41308254f},
-std::array<float,2>{0.715144277f, 0.914212108f},
-std::array<float,2>{0.434348345f, 0.252411902f},
-std::array<float,2>{0.0616668537f, 0.53651756f},
-std::array<float,2>{0.764629066f, 0.177450955f},
-std::array<float,2>{0.979754984f, 0.682929516f},
-std::array<float,2>{0.208749488f, 0.0135890543f},
-std::array<float,2>{0.257792741f, 0.865586638f},
-std::array<float,2>{0.603901863f, 0.400611907f},
-std::array<float,2>{0.850599408f, 0.799272895f},
-std::array<float,2>{0.0960027054f, 0.488936543f},
-std::array<float,2>{0.490492702f, 0.696879804f},
-std::array<float,2>{0.647187471f, 0.0650800914f},
-std::array<float,2>{0.50096643f, 0.61019206f},
-std::array<float,2>{0.312966377f, 0.239120647f},
-std::array<float,2>{0.150423527f, 0.996836245f},
-std::array<float,2>{0.908483803f, 0.355368674f},
-std::array<float,2>{0.576231778f, 0.818291962f},
-std::array<float,2>{0.302464068f, 0.434825182f},
-std::array<float,2>{0.223053142f, 0.649267673f},
-std::array<float,2>{0.941528618f, 0.0607820638f},
-std::array<float,2>{0.799925268f, 0.516278088f},
-std::array<float,2>{0.0112967528f, 0.133789793f},
-std::array<float,2>{0.385671109f, 0.900001228f},
-std::array<float,2>{0.741175175f, 0.299743831f},
-std::array<float,2>{0.902074158f, 0.946090817f},
-std::array<float,2>{0.184962273f, 0.323347121f},
-std::array<float,2>{0.369957685f, 0.568426192f},
-std::array<float,2>{0.554334104f, 0.206032291f},
-std::array<float,2>{0.670626223f, 0.721780121f},
-std::array<float,2>{0.44455263f, 0.102160335f},
-std::array<float,2>{0.0705319047f, 0.751224697f},
-std::array<float,2>{0.820604682f, 0.445636749f},
-std::array<float,2>{0.514575303f, 0.936079681f},
-std::array<float,2>{0.32138744f, 0.276113391f},
-std::array<float,2>{0.147936612f, 0.553256392f},
-std::array<float,2>{0.915891707f, 0.159208044f},
-std::array<float,2>{0.85248369f, 0.656470716f},
-std::array<float,2>{0.102718741f, 0.0181414895f},
-std::array<float,2>{0.492840737f, 0.851103842f},
-std::array<float,2>{0.651482165f, 0.387865812f},
-std::array<float,2>{0.973505855f, 0.782234788f},
-std::array<float,2>{0.213451132f, 0.476036042f},
-std::array<float,2>{0.257986546f, 0.703979671f},
-std::array<float,2>{0.59961766f, 0.0910497084f},
-std::array<float,2>{0.704649448f, 0.609126389f},
-std::array<float,2>{0.425522655f, 0.223288253f},
-std::array<float,2>{0.0536238365f, 0.974707901f},
-std::array<float,2>{0.755881846f, 0.36019069f},
-std::array<float,2>{0.65744406f, 0.835319042f},
-std::array<float,2>{0.451939493f, 0.407631308f},
-std::array<float,2>{0.0670352504f, 0.63809967f},
-std::array<float,2>{0.814313591f, 0.0349889062f},
-std::array<float,2>{0.897146404f, 0.515211523f},
-std::array<float,2>{0.173646331f, 0.146982521f},
-std::array<float,2>{0.360590696f, 0.88394767f},
-std::array<float,2>{0.556541741f, 0.293204248f},
-std::array<float,2>{0.807647526f, 0.962312341f},
-std::array<float,2>{0.00735721691f, 0.342705101f},
-std::array<float,2>{0.376334935f, 0.581046343f},
-std::array<float,2>{0.745177865f, 0.200727239f},
-std::array<float,2>{0.566567004f, 0.737169385f},
-std::array<float,2>{0.305418909f, 0.111083075f},
-std::array<float,2>{0.228969648f, 0.775491595f},
-std::array<float,2>{0.947489321f, 0.459174693f},
-std::array<float,2>{0.725485027f, 0.992879152f},
-std::array<float,2>{0.392685741f, 0.358429581f},
-std::array<float,2>{0.0311558247f, 0.615968466f},
-std::array<float,2>{0.795435607f, 0.234403238f},
-std::array<float,2>{0.959790707f, 0.700107038f},
-std::array<float,2>{0.245018989f, 0.0670676902f},
-std::array<float,2>{0.291077614f, 0.803458869f},
-std::array<float,2>{0.585942328f, 0.484698981f},
-std::array<float,2>{0.831428647f, 0.861743152f},
-std::array<float,2>{0.0928457752f, 0.403065652f},
-std::array<float,2>{0.45907557f, 0.686495066f},
-std::array<float,2>{0.683009386f, 0.0092391083f},
-std::array<float,2>{0.537815392f, 0.532328904f},
-std::array<float,2>{0.347926646f, 0.175361544f},
-std::array<float,2>{0.171410069f, 0.92084372f},
-std::array<float,2>{0.879125595f, 0.255531818f},
-std::array<float,2>{0.610003591f, 0.756666958f},
-std::array<float,2>{0.268755674f, 0.45069778f},
-std::array<float,2>{0.195100188f, 0.723310947f},
-std::array<float,2>{0.996671557f, 0.10843879f},
-std::array<float,2>{0.772166729f, 0.565495372f},
-std::array<float,2>{0.0408574939f, 0.210611045f},
-std::array<float,2>{0.421659529f, 0.952516437f},
-std::array<float,2>{0.695587277f, 0.326368362f},
-std::array<float,2>{0.926482439f, 0.90535146f},
-std::array<float,2>{0.129856214f, 0.30274573f},
-std::array<float,2>{0.333559006f, 0.522961795f},
-std::array<float,2>{0.51789695f, 0.137142524f},
-std::array<float,2>{0.630523264f, 0.656164885f},
-std::array<float,2>{0.483958721f, 0.056116309f},
-std::array<float,2>{0.123437069f, 0.815473258f},
-std::array<float,2>{0.870638072f, 0.43249473f},
-std::array<float,2>{0.582771957f, 0.939593971f},
-std::array<float,2>{0.287004679f, 0.314011782f},
-std::array<float,2>{0.241792634f, 0.573083818f},
-std::array<float,2>{0.964787543f, 0.216671959f},
-std::array<float,2>{0.782573402f, 0.731399417f},
-std::array<float,2>{0.0186885241f, 0.0986142009f},
-std::array<float,2>{0.404238909f, 0.763090611f},
-std::array<float,2>{0.728025436f, 0.441307962f},
-std::array<float,2>{0.88932395f, 0.824527204f},
-std::array<float,2>{0.163231909f, 0.422730654f},
-std::array<float,2>{0.356187105f, 0.643877566f},
-std::array<float,2>{0.544965923f, 0.047902979f},
-std::array<float,2>{0.673704088f, 0.529140234f},
-std::array<float,2>{0.464049309f, 0.125554532f},
-std::array<float,2>{0.0834980533f, 0.893368423f},
-std::array<float,2>{0.836088598f, 0.309898496f},
-std::array<float,2>{0.693220437f, 0.808826029f},
-std::array<float,2>{0.406373709f, 0.497963667f},
-std::array<float,2>{0.0344839655f, 0.694207668f},
-std::array<float,2>{0.780945659f, 0.0707998052f},
-std::array<float,2>{0.987392366f, 0.624790668f},
-std::array<float,2>{0.201292858f, 0.248110205f},
-std::array<float,2>{0.279469907f, 0.990913272f},
-std::array<float,2>{0.617594779f, 0.35046792f},
-std::array<float,2>{0.865701199f, 0.911570251f},
-std::array<float,2>{0.113227367f, 0.262609959f},
-std::array<float,2>{0.474473298f, 0.544414937f},
-std::array<float,2>{0.637710094f, 0.182030052f},
-std::array<float,2>{0.526047826f, 0.678190768f},
-std::array<float,2>{0.340224594f, 0.000887629692f},
-std::array<float,2>{0.140188307f, 0.869565606f},
-std::array<float,2>{0.933926046f, 0.39524731f},
-std::array<float,2>{0.64400965f, 0.881979167f},
-std::array<float,2>{0.484969467f, 0.287193716f},
-std::array<float,2>{0.100157015f, 0.506228268f},
-std::array<float,2>{0.847053289f, 0.15618749f},
-std::array<float,2>{0.910660267f, 0.628380656f},
-std::array<float,2>{0.154086903f, 0.0438049696f},
-std::array<float,2>{0.317974478f, 0.84151715f},
-std::array<float,2>{0.506395996f, 0.421407849f},
-std::array<float,2>{0.758253217f, 0.769500554f},
-std::array<float,2>{0.0554731041f, 0.463554651f},
-std::array<float,2>{0.432167709f, 0.74563247f},
-std::array<float,2>{0.712803006f, 0.12126188f},
-std::array<float,2>{0.607178509f, 0.586381972f},
-std::array<float,2>{0.251813501f, 0.193653345f},
-std::array<float,2>{0.203585491f, 0.955511332f},
-std::array<float,2>{0.982352972f, 0.335351586f},
-std::array<float,2>{0.548396647f, 0.852581978f},
-std::array<float,2>{0.372437418f, 0.377452791f},
-std::array<float,2>{0.180883691f, 0.667709589f},
-std::array<float,2>{0.905055463f, 0.02636813f},
-std::array<float,2>{0.827237487f, 0.559174955f},
-std::array<float,2>{0.074295029f, 0.165252879f},
-std::array<float,2>{0.43782714f, 0.929194152f},
-std::array<float,2>{0.666916013f, 0.269739777f},
-std::array<float,2>{0.940610945f, 0.979258776f},
-std::array<float,2>{0.220041007f, 0.36935696f},
-std::array<float,2>{0.300295711f, 0.597535789f},
-std::array<float,2>{0.572128713f, 0.231427506f},
-std::array<float,2>{0.7377913f, 0.716025412f},
-std::array<float,2>{0.389450371f, 0.0839121714f},
-std::array<float,2>{0.0148987155f, 0.796387613f},
-std::array<float,2>{0.803657413f, 0.483196467f},
-std::array<float,2>{0.590468049f, 0.878439665f},
-std::array<float,2>{0.293167949f, 0.282863766f},
-std::array<float,2>{0.246503219f, 0.501075983f},
-std::array<float,2>{0.954601586f, 0.150172144f},
-std::array<float,2>{0.790723503f, 0.632720232f},
-std::array<float,2>{0.0266618039f, 0.0417340323f},
-std::array<float,2>{0.396348625f, 0.838435054f},
-std::array<float,2>{0.719000638f, 0.417129338f},
-std::array<float,2>{0.877273798f, 0.77236861f},
-std::array<float,2>{0.166127339f, 0.467703581f},
-std::array<float,2>{0.344286948f, 0.747146249f},
-std::array<float,2>{0.533881307f, 0.120837651f},
-std::array<float,2>{0.685297668f, 0.590641916f},
-std::array<float,2>{0.456211865f, 0.188203812f},
-std::array<float,2>{0.0881285891f, 0.958266735f},
-std::array<float,2>{0.833743751f, 0.331469476f},
-std::array<float,2>{0.702621818f, 0.856332242f},
-std::array<float,2>{0.415748358f, 0.382206857f},
-std::array<float,2>{0.0445951559f, 0.669214964f},
-std::array<float,2>{0.768978f, 0.027409723f},
-std::array<float,2>{0.993158758f, 0.556732893f},
-std::array<float,2>{0.188197464f, 0.171707124f},
-std::array<float,2>{0.269875169f, 0.925210357f},
-std::array<float,2>{0.614980638f, 0.266823471f},
-std::array<float,2>{0.872036576f, 0.98286283f},
-std::array<float,2>{0.1187061f, 0.372714639f},
-std::array<float,2>{0.478539318f, 0.601211548f},
-std::array<float,2>{0.625625372f, 0.228945896f},
-std::array<float,2>{0.520037532f, 0.714728296f},
-std::array<float,2>{0.328175604f, 0.0796738267f},
-std::array<float,2>{0.128405362f, 0.791993856f},
-std::array<float,2>{0.92275703f, 0.480282873f},
-std::array<float,2>{0.656202793f, 0.942894161f},
-std::array<float,2>{0.497292459f, 0.317182183f},
-std::array<float,2>{0.106878191f, 0.575376868f},
-std::array<float,2>{0.857826769f, 0.214413539f},
-std::array<float,2>{0.921197236f, 0.730083764f},
-std::array<float,2>{0.141321257f, 0.0949006975f},
-std::array<float,2>{0.325901121f, 0.761176348f},
-std::array<float,2>{0.508600056f, 0.444160014f},
-std::array<float,2>{0.75168395f, 0.820874453f},
-std::array<float,2>{0.0482011549f, 0.426145285f},
-std::array<float,2>{0.42818132f, 0.645110726f},
-std::array<float,2>{0.710117638f, 0.052345667f},
-std::array<float,2>{0.596884966f, 0.52702713f},
-std::array<float,2>{0.264369398f, 0.130873695f},
-std::array<float,2>{0.217526153f, 0.898303807f},
-std::array<float,2>{0.97015959f, 0.30797866f},
-std::array<float,2>{0.560139775f, 0.806711316f},
-std::array<float,2>{0.365283072f, 0.493303359f},
-std::array<float,2>{0.176073164f, 0.687706649f},
-std::array<float,2>{0.892288685f, 0.0780284777f},
-std::array<float,2>{0.819063902f, 0.619889021f},
-std::array<float,2>{0.0629084557f, 0.245885491f},
-std::array<float,2>{0.449132383f, 0.985069156f},
-std::array<float,2>{0.661218882f, 0.345606089f},
-std::array<float,2>{0.951993465f, 0.908447981f},
-std::array<float,2>{0.232013986f, 0.258437246f},
-std::array<float,2>{0.309748888f, 0.539524913f},
-std::array<float,2>{0.563974142f, 0.18438904f},
-std::array<float,2>{0.748625696f, 0.67516011f},
-std::array<float,2>{0.37980929f, 0.00687157316f},
-std::array<float,2>{0.00279588206f, 0.873972476f},
-std::array<float,2>{0.809815466f, 0.390988827f},
-std::array<float,2>{0.502295315f, 0.99713397f},
-std::array<float,2>{0.315131903f, 0.354008406f},
-std::array<float,2>{0.150002062f, 0.610984147f},
-std::array<float,2>{0.907392502f, 0.239774749f},
-std::array<float,2>{0.847825587f, 0.695902109f},
-std::array<float,2>{0.0951547325f, 0.0657423064f},
-std::array<float,2>{0.488444269f, 0.800468862f},
-std::array<float,2>{0.644932926f, 0.489435315f},
-std::array<float,2>{0.977426529f, 0.866653979f},
-std::array<float,2>{0.210600987f, 0.402066886f},
-std::array<float,2>{0.254056215f, 0.681648135f},
-std::array<float,2>{0.603135526f, 0.0119579583f},
-std::array<float,2>{0.717422068f, 0.535805345f},
-std::array<float,2>{0.436538726f, 0.176011413f},
-std::array<float,2>{0.0605055094f, 0.915484786f},
-std::array<float,2>{0.76295799f, 0.253057867f},
-std::array<float,2>{0.669579685f, 0.750850499f},
-std::array<float,2>{0.44173184f, 0.446519494f},
-std::array<float,2>{0.0724010244f, 0.721353054f},
-std::array<float,2>{0.82321465f, 0.102868974f},
-std::array<float,2>{0.900347352f, 0.570073068f},
-std::array<float,2>{0.186593249f, 0.206973374f},
-std::array<float,2>{0.368422359f, 0.947154403f},
-std::array<float,2>{0.551066577f, 0.322548926f},
-std::array<float,2>{0.797082663f, 0.898779035f},
-std::array<float,2>{0.00975349732f, 0.300195545f},
-std::array<float,2>{0.383917242f, 0.517314553f},
-std::array<float,2>{0.739729941f, 0.133407086f},
-std::array<float,2>{0.576043844f, 0.650147617f},
-std::array<float,2>{0.303468972f, 0.0619851053f},
-std::array<float,2>{0.224792019f, 0.816518307f},
-std::array<float,2>{0.943573356f, 0.434304386f},
-std::array<float,2>{0.733848214f, 0.930948138f},
-std::array<float,2>{0.40048784f, 0.278173864f},
-std::array<float,2>{0.0208371896f, 0.547406137f},
-std::array<float,2>{0.788346767f, 0.161807984f},
-std::array<float,2>{0.965869248f, 0.662158787f},
-std::array<float,2>{0.235398024f, 0.0206608754f},
-std::array<float,2>{0.284702152f, 0.845523953f},
-std::array<float,2>{0.579225183f, 0.385021389f},
-std::array<float,2>{0.843668044f, 0.786638916f},
-std::array<float,2>{0.079193756f, 0.472091138f},
-std::array<float,2>{0.466923922f, 0.708549321f},
-std::array<float,2>{0.675962508f, 0.0870284289f},
-std::array<float,2>{0.542951941f, 0.604627848f},
-std::array<float,2>{0.353012592f, 0.220076725f},
-std::array<float,2>{0.158007234f, 0.969203353f},
-std::array<float,2>{0.885085762f, 0.366670966f},
-std::array<float,2>{0.623767436f, 0.831919312f},
-std::array<float,2>{0.276636094f, 0.413957983f},
-std::array<float,2>{0.197536021f, 0.635775685f},
-std::array<float,2>{0.989592314f, 0.0388601422f},
-std::array<float,2>{0.777165473f, 0.508506417f},
-std::array<float,2>{0.03665822f, 0.140828386f},
-std::array<float,2>{0.411573797f, 0.887922525f},
-std::array<float,2>{0.689795554f, 0.292152941f},
-std::array<float,2>{0.933315456f, 0.968440354f},
-std::array<float,2>{0.133560851f, 0.337399542f},
-std::array<float,2>{0.336602718f, 0.582498312f},
-std::array<float,2>{0.528627038f, 0.19855538f},
-std::array<float,2>{0.634506285f, 0.740370214f},
-std::array<float,2>{0.470455825f, 0.115066774f},
-std::array<float,2>{0.116497785f, 0.779831529f},
-std::array<float,2>{0.862099648f, 0.454711586f},
-std::array<float,2>{0.535693169f, 0.920902431f},
-std::array<float,2>{0.351106375f, 0.25461033f},
-std::array<float,2>{0.169435039f, 0.532120407f},
-std::array<float,2>{0.88089323f, 0.173941568f},
-std::array<float,2>{0.829343498f, 0.686621189f},
-std::array<float,2>{0.0913194492f, 0.00841489341f},
-std::array<float,2>{0.4572047f, 0.86244911f},
-std::array<float,2>{0.681629181f, 0.404255629f},
-std::array<float,2>{0.957433105f, 0.804611087f},
-std::array<float,2>{0.243420199f, 0.485414237f},
-std::array<float,2>{0.289380908f, 0.700277627f},
-std::array<float,2>{0.58798933f, 0.0676359683f},
-std::array<float,2>{0.723985195f, 0.616738856f},
-std::array<float,2>{0.391384929f, 0.235778719f},
-std::array<float,2>{0.028535258f, 0.993219554f},
-std::array<float,2>{0.794582605f, 0.358378381f},
-std::array<float,2>{0.631990731f, 0.815009892f},
-std::array<float,2>{0.481225371f, 0.432837397f},
-std::array<float,2>{0.121490233f, 0.655053794f},
-std::array<float,2>{0.868450522f, 0.0550622828f},
-std::array<float,2>{0.927903712f, 0.522439361f},
-std::array<float,2>{0.131505877f, 0.138387591f},
-std::array<float,2>{0.334412187f, 0.904425919f},
-std::array<float,2>{0.516962647f, 0.304327756f},
-std::array<float,2>{0.769554853f, 0.952045441f},
-std::array<float,2>{0.0426019281f, 0.32769838f},
-std::array<float,2>{0.418933272f, 0.56458956f},
-std::array<float,2>{0.697835028f, 0.209318563f},
-std::array<float,2>{0.61161238f, 0.723757565f},
-std::array<float,2>{0.266720474f, 0.108191103f},
-std::array<float,2>{0.19293496f, 0.757321894f},
-std::array<float,2>{0.999058366f, 0.449682355f},
-std::array<float,2>{0.706878543f, 0.97611618f},
-std::array<float,2>{0.423442751f, 0.360397369f},
-std::array<float,2>{0.0524083376f, 0.607724547f},
-std::array<float,2>{0.754214287f, 0.223915517f},
-std::array<float,2>{0.975435495f, 0.704270303f},
-std::array<float,2>{0.211366057f, 0.0904496238f},
-std::array<float,2>{0.260228783f, 0.781568229f},
-std::array<float,2>{0.598867476f, 0.475398839f},
-std::array<float,2>{0.854287267f, 0.85057348f},
-std::array<float,2>{0.105413698f, 0.387100369f},
-std::array<float,2>{0.495415598f, 0.65730679f},
-std::array<float,2>{0.649650574f, 0.0186911058f},
-std::array<float,2>{0.512182534f, 0.553790569f},
-std::array<float,2>{0.323313564f, 0.15841113f},
-std::array<float,2>{0.145600662f, 0.937134802f},
-std::array<float,2>{0.916711152f, 0.277190417f},
-std::array<float,2>{0.569140553f, 0.776720822f},
-std::array<float,2>{0.308514684f, 0.460335433f},
-std::array<float,2>{0.228368565f, 0.737443447f},
-std::array<float,2>{0.946222067f, 0.10956616f},
-std::array<float,2>{0.806420326f, 0.581264615f},
-std::array<float,2>{0.00463969493f, 0.199895501f},
-std::array<float,2>{0.378157318f, 0.961233974f},
-std::array<float,2>{0.743373394f, 0.343437254f},
-std::array<float,2>{0.894928396f, 0.883253574f},
-std::array<float,2>{0.174726546f, 0.294022024f},
-std::array<float,2>{0.362150967f, 0.514535189f},
-std::array<float,2>{0.558535218f, 0.147968471f},
-std::array<float,2>{0.658956885f, 0.637660861f},
-std::array<float,2>{0.449471623f, 0.0336906426f},
-std::array<float,2>{0.0688636974f, 0.834353983f},
-std::array<float,2>{0.816348672f, 0.406994373f},
-std::array<float,2>{0.608888865f, 0.956833601f},
-std::array<float,2>{0.252508312f, 0.334316105f},
-std::array<float,2>{0.206437588f, 0.587716997f},
-std::array<float,2>{0.983614922f, 0.194433123f},
-std::array<float,2>{0.76117903f, 0.744205713f},
-std::array<float,2>{0.0581017435f, 0.122862011f},
-std::array<float,2>{0.430912256f, 0.768110991f},
-std::array<float,2>{0.714438438f, 0.464208126f},
-std::array<float,2>{0.914031327f, 0.839943647f},
-std::array<float,2>{0.154340118f, 0.420309216f},
-std::array<float,2>{0.319830656f, 0.627855003f},
-std::array<float,2>{0.504691184f, 0.0445811711f},
-std::array<float,2>{0.641131043f, 0.507462204f},
-std::array<float,2>{0.487202287f, 0.155082837f},
-std::array<float,2>{0.0995033383f, 0.880906582f},
-std::array<float,2>{0.845662355f, 0.288841069f},
-std::array<float,2>{0.73620832f, 0.795684755f},
-std::array<float,2>{0.387956858f, 0.484250963f},
-std::array<float,2>{0.013268441f, 0.715738893f},
-std::array<float,2>{0.801393926f, 0.0825564638f},
-std::array<float,2>{0.937950253f, 0.595840812f},
-std::array<float,2>{0.221430734f, 0.231523767f},
-std::array<float,2>{0.297706723f, 0.980462134f},
-std::array<float,2>{0.573702872f, 0.370475948f},
-std::array<float,2>{0.825779438f, 0.928480446f},
-std::array<float,2>{0.0764659122f, 0.270610422f},
-std::array<float,2>{0.441031247f, 0.560364068f},
-std::array<float,2>{0.664868474f, 0.164213389f},
-std::array<float,2>{0.549460053f, 0.666082561f},
-std::array<float,2>{0.37474373f, 0.0258720424f},
-std::array<float,2>{0.181914195f, 0.852063596f},
-std::array<float,2>{0.903241932f, 0.378452212f},
-std::array<float,2>{0.675763845f, 0.894402146f},
-std::array<float,2>{0.461345136f, 0.309371442f},
-std::array<float,2>{0.0848880932f, 0.527834117f},
-std::array<float,2>{0.838596582f, 0.126404062f},
-std::array<float,2>{0.887887836f, 0.642632306f},
-std::array<float,2>{0.161860749f, 0.0468861684f},
-std::array<float,2>{0.359056205f, 0.825675547f},
-std::array<float,2>{0.544597626f, 0.423520416f},
-std::array<float,2>{0.784460187f, 0.762533724f},
-std::array<float,2>{0.0156698022f, 0.439632684f},
-std::array<float,2>{0.405362695f, 0.731741905f},
-std::array<float,2>{0.728592992f, 0.0993601233f},
-std::array<float,2>{0.585003614f, 0.574137509f},
-std::array<float,2>{0.287539542f, 0.214934617f},
-std::array<float,2>{0.239751682f, 0.940548599f},
-std::array<float,2>{0.962604344f, 0.312615335f},
-std::array<float,2>{0.52355814f, 0.870424509f},
-std::array<float,2>{0.343396187f, 0.39640525f},
-std::array<float,2>{0.137199059f, 0.679674029f},
-std::array<float,2>{0.935955703f, 0.00106745912f},
-std::array<float,2>{0.864152133f, 0.543190658f},
-std::array<float,2>{0.109729886f, 0.183007598f},
-std::array<float,2>{0.476539016f, 0.91076833f},
-std::array<float,2>{0.639547825f, 0.263169765f},
-std::array<float,2>{0.98605907f, 0.992168784f},
-std::array<float,2>{0.200601816f, 0.351124525f},
-std::array<float,2>{0.278738797f, 0.623986006f},
-std::array<float,2>{0.619772434f, 0.249560297f},
-std::array<float,2>{0.694822192f, 0.695226669f},
-std::array<float,2>{0.40883711f, 0.0714745969f},
-std::array<float,2>{0.0319850445f, 0.810504913f},
-std::array<float,2>{0.778187454f, 0.496273816f},
-std::array<float,2>{0.616796196f, 0.922778964f},
-std::array<float,2>{0.273341447f, 0.268297702f},
-std::array<float,2>{0.189995944f, 0.55629909f},
-std::array<float,2>{0.994270205f, 0.168394774f},
-std::array<float,2>{0.766931832f, 0.671486557f},
-std::array<float,2>{0.0452682637f, 0.0308165047f},
-std::array<float,2>{0.417281985f, 0.858598351f},
-std::array<float,2>{0.700124979f, 0.380114913f},
-std::array<float,2>{0.925098777f, 0.789491534f},
-std::array<float,2>{0.126740247f, 0.476584375f},
-std::array<float,2>{0.331133544f, 0.711188316f},
-std::array<float,2>{0.521862805f, 0.0802559778f},
-std::array<float,2>{0.627710164f, 0.598127246f},
-std::array<float,2>{0.476633549f, 0.22806026f},
-std::array<float,2>{0.119881921f, 0.982027709f},
-std::array<float,2>{0.873340845f, 0.373254865f},
-std::array<float,2>{0.720936954f, 0.837302387f},
-std::array<float,2>{0.397427082f, 0.415859014f},
-std::array<float,2>{0.0235104673f, 0.629674673f},
-std::array<float,2>{0.792766154f, 0.0404331386f},
-std::array<float,2>{0.956145823f, 0.502701044f},
-std::array<float,2>{0.249102086f, 0.151931629f},
-std::array<float,2>{0.295968741f, 0.875760078f},
-std::array<float,2>{0.593617797f, 0.284940094f},
-std::array<float,2>{0.833988547f, 0.959974289f},
-std::array<float,2>{0.0861367509f, 0.329337716f},
-std::array<float,2>{0.454923004f, 0.593568206f},
-std::array<float,2>{0.686904252f, 0.189459741f},
-std::array<float,2>{0.532053947f, 0.74838078f},
-std::array<float,2>{0.347501129f, 0.119038813f},
-std::array<float,2>{0.16494137f, 0.770546377f},
-std::array<float,2>{0.875315964f, 0.465241015f},
-std::array<float,2>{0.662118256f, 0.988010108f},
-std::array<float,2>{0.446649879f, 0.34573558f},
-std::array<float,2>{0.065674305f, 0.617453933f},
-std::array<float,2>{0.817486167f, 0.242431119f},
-std::array<float,2>{0.893605828f, 0.691405118f},
-std::array<float,2>{0.179315388f, 0.0747223794f},
-std::array<float,2>{0.364323139f, 0.806306601f},
-std::array<float,2>{0.560976624f, 0.495451748f},
-std::array<float,2>{0.811317921f, 0.872440517f},
-std::array<float,2>{0.000110899062f, 0.394103378f},
-std::array<float,2>{0.381172866f, 0.672925532f},
-std::array<float,2>{0.748001933f, 0.00547125563f},
-std::array<float,2>{0.565104604f, 0.542361796f},
-std::array<float,2>{0.312125415f, 0.186626941f},
-std::array<float,2>{0.233034745f, 0.908193648f},
-std::array<float,2>{0.94983685f, 0.260273218f},
-std::array<float,2>{0.511092544f, 0.758525789f},
-std::array<float,2>{0.326844454f, 0.443297446f},
-std::array<float,2>{0.143420309f, 0.728013575f},
-std::array<float,2>{0.919603348f, 0.0958995894f},
-std::array<float,2>{0.856828511f, 0.577066302f},
-std::array<float,2>{0.108375557f, 0.212118089f},
-std::array<float,2>{0.499817163f, 0.944086552f},
-std::array<float,2>{0.653205037f, 0.319962949f},
-std::array<float,2>{0.971658647f, 0.89468509f},
-std::array<float,2>{0.216474369f, 0.305657893f},
-std::array<float,2>{0.262989491f, 0.523501337f},
-std::array<float,2>{0.59514755f, 0.13022384f},
-std::array<float,2>{0.708955109f, 0.646921694f},
-std::array<float,2>{0.427689701f, 0.0541397333f},
-std::array<float,2>{0.0499073677f, 0.824058712f},
-std::array<float,2>{0.751983464f, 0.428715676f},
-std::array<float,2>{0.55341047f, 0.948816001f},
-std::array<float,2>{0.370503902f, 0.320852876f},
-std::array<float,2>{0.184083417f, 0.568271995f},
-std::array<float,2>{0.900983274f, 0.203659236f},
-std::array<float,2>{0.821422637f, 0.719045997f},
-std::array<float,2>{0.0719516724f, 0.104595251f},
-std::array<float,2>{0.443437219f, 0.753549397f},
-std::array<float,2>{0.671820104f, 0.44776845f},
-std::array<float,2>{0.942813873f, 0.82002151f},
-std::array<float,2>{0.224194229f, 0.437292695f},
-std::array<float,2>{0.301107734f, 0.651996851f},
-std::array<float,2>{0.57774502f, 0.0598611571f},
-std::array<float,2>{0.741812587f, 0.517875433f},
-std::array<float,2>{0.386619836f, 0.136359826f},
-std::array<float,2>{0.00994250271f, 0.901708305f},
-std::array<float,2>{0.79970783f, 0.29750365f},
-std::array<float,2>{0.648021758f, 0.798531473f},
-std::array<float,2>{0.491291493f, 0.491811752f},
-std::array<float,2>{0.097500518f, 0.698233008f},
-std::array<float,2>{0.850461602f, 0.0636507496f},
-std::array<float,2>{0.909328341f, 0.612974346f},
-std::array<float,2>{0.151571766f, 0.241963446f},
-std::array<float,2>{0.313762218f, 0.999453545f},
-std::array<float,2>{0.501087368f, 0.352588475f},
-std::array<float,2>{0.764954805f, 0.916074932f},
-std::array<float,2>{0.0607742928f, 0.251179636f},
-std::array<float,2>{0.435543686f, 0.537537634f},
-std::array<float,2>{0.716138005f, 0.178148329f},
-std::array<float,2>{0.605381966f, 0.680682778f},
-std::array<float,2>{0.256510764f, 0.0149725145f},
-std::array<float,2>{0.208003297f, 0.863700628f},
-std::array<float,2>{0.978986084f, 0.398760498f},
-std::array<float,2>{0.687680304f, 0.890529215f},
-std::array<float,2>{0.413777769f, 0.290104985f},
-std::array<float,2>{0.0389132611f, 0.511282444f},
-std::array<float,2>{0.774129272f, 0.14387776f},
-std::array<float,2>{0.992165983f, 0.634624958f},
-std::array<float,2>{0.196079344f, 0.036501471f},
-std::array<float,2>{0.273480207f, 0.829012573f},
-std::array<float,2>{0.621100068f, 0.410492688f},
-std::array<float,2>{0.861119926f, 0.778588653f},
-std::array<float,2>{0.115012012f, 0.456441998f},
-std::array<float,2>{0.471797138f, 0.739469767f},
-std::array<float,2>{0.635351181f, 0.116579764f},
-std::array<float,2>{0.530304253f, 0.585860133f},
-std::array<float,2>{0.339226693f, 0.196740001f},
-std::array<float,2>{0.136701897f, 0.964950502f},
-std::array<float,2>{0.929980755f, 0.33951351f},
-std::array<float,2>{0.581297755f, 0.846765161f},
-std::array<float,2>{0.282353908f, 0.384133965f},
-std::array<float,2>{0.236497313f, 0.660628259f},
-std::array<float,2>{0.967718899f, 0.021982437f},
-std::array<float,2>{0.785990119f, 0.549595237f},
-std::array<float,2>{0.0231600963f, 0.164024666f},
-std::array<float,2>{0.399060696f, 0.93173945f},
-std::array<float,2>{0.732323885f, 0.280531317f},
-std::array<float,2>{0.883494675f, 0.971277595f},
-std::array<float,2>{0.158903822f, 0.364940047f},
-std::array<float,2>{0.354606748f, 0.60163939f},
-std::array<float,2>{0.539406359f, 0.222491682f},
-std::array<float,2>{0.679362297f, 0.709920943f},
-std::array<float,2>{0.466296405f, 0.0896464512f},
-std::array<float,2>{0.0803368464f, 0.788269043f},
-std::array<float,2>{0.840391397f, 0.468846917f},
-std::array<float,2>{0.518600404f, 0.902818084f},
-std::array<float,2>{0.332541347f, 0.302292526f},
-std::array<float,2>{0.130220428f, 0.519725025f},
-std::array<float,2>{0.926801801f, 0.138866693f},
-std::array<float,2>{0.869450867f, 0.652555704f},
-std::array<float,2>{0.124834567f, 0.0573426522f},
-std::array<float,2>{0.483293593f, 0.812872291f},
-std::array<float,2>{0.62902391f, 0.431290954f},
-std::array<float,2>{0.997702062f, 0.753939211f},
-std::array<float,2>{0.194019005f, 0.451419353f},
-std::array<float,2>{0.268500239f, 0.725299716f},
-std::array<float,2>{0.610661805f, 0.106083125f},
-std::array<float,2>{0.696920693f, 0.562846243f},
-std::array<float,2>{0.420172244f, 0.208006561f},
-std::array<float,2>{0.0394099131f, 0.951145947f},
-std::array<float,2>{0.773121476f, 0.324272305f},
-std::array<float,2>{0.68237555f, 0.861076415f},
-std::array<float,2>{0.460487425f, 0.404354572f},
-std::array<float,2>{0.0920936614f, 0.684912205f},
-std::array<float,2>{0.830208421f, 0.00988766085f},
-std::array<float,2>{0.880063772f, 0.53506279f},
-std::array<float,2>{0.170649305f, 0.17346251f},
-std::array<float,2>{0.349404812f, 0.919665635f},
-std::array<float,2>{0.538229942f, 0.257783294f},
-std::array<float,2>{0.796592653f, 0.99596715f},
-std::array<float,2>{0.0293199532f, 0.356936485f},
-std::array<float,2>{0.393576503f, 0.614460051f},
-std::array<float,2>{0.725809872f, 0.236483082f},
-std::array<float,2>{0.587058961f, 0.701272786f},
-std::array<float,2>{0.292923033f, 0.0695912093f},
-std::array<float,2>{0.245429978f, 0.802720606f},
-std::array<float,2>{0.960258186f, 0.487760574f},
-std::array<float,2>{0.744539917f, 0.963753521f},
-std::array<float,2>{0.375284165f, 0.340793759f},
-std::array<float,2>{0.00617991621f, 0.578614771f},
-std::array<float,2>{0.807232082f, 0.202905238f},
-std::array<float,2>{0.948885262f, 0.735950768f},
-std::array<float,2>{0.230375394f, 0.111582272f},
-std::array<float,2>{0.305685729f, 0.775220931f},
-std::array<float,2>{0.567692041f, 0.458931327f},
-std::array<float,2>{0.813455999f, 0.833718777f},
-std::array<float,2>{0.0680074766f, 0.408440828f},
-std::array<float,2>{0.452709854f, 0.640590012f},
-std::array<float,2>{0.65680927f, 0.0316435397f},
-std::array<float,2>{0.555599332f, 0.513258874f},
-std::array<float,2>{0.359691083f, 0.144785225f},
-std::array<float,2>{0.172774866f, 0.885170221f},
-std::array<float,2>{0.898317993f, 0.296105295f},
-std::array<float,2>{0.60069561f, 0.784076333f},
-std::array<float,2>{0.259075224f, 0.473598808f},
-std::array<float,2>{0.214636683f, 0.706156731f},
-std::array<float,2>{0.973694563f, 0.0931459367f},
-std::array<float,2>{0.757723391f, 0.606681168f},
-std::array<float,2>{0.0544651076f, 0.225455552f},
-std::array<float,2>{0.424205899f, 0.974556088f},
-std::array<float,2>{0.703454316f, 0.36183995f},
-std::array<float,2>{0.914449036f, 0.934835255f},
-std::array<float,2>{0.1469035f, 0.27472955f},
-std::array<float,2>{0.320550621f, 0.550928593f},
-std::array<float,2>{0.515061677f, 0.156327814f},
-std::array<float,2>{0.650639772f, 0.658904254f},
-std::array<float,2>{0.493199497f, 0.0166519471f},
-std::array<float,2>{0.102101222f, 0.848063231f},
-std::array<float,2>{0.85265547f, 0.388682038f},
-std::array<float,2>{0.570405781f, 0.978043258f},
-std::array<float,2>{0.299579144f, 0.367267489f},
-std::array<float,2>{0.219283864f, 0.594312608f},
-std::array<float,2>{0.939610839f, 0.232696787f},
-std::array<float,2>{0.804446101f, 0.718700707f},
-std::array<float,2>{0.014130882f, 0.0844394118f},
-std::array<float,2>{0.390056521f, 0.794332445f},
-std::array<float,2>{0.736474633f, 0.481647015f},
-std::array<float,2>{0.906007111f, 0.853546739f},
-std::array<float,2>{0.180171311f, 0.376247734f},
-std::array<float,2>{0.371308148f, 0.664134145f},
-std::array<float,2>{0.547234535f, 0.0248199236f},
-std::array<float,2>{0.667025387f, 0.561500907f},
-std::array<float,2>{0.438988149f, 0.166298792f},
-std::array<float,2>{0.0756128728f, 0.926889598f},
-std::array<float,2>{0.826700807f, 0.273233443f},
-std::array<float,2>{0.711638212f, 0.767289877f},
-std::array<float,2>{0.432987809f, 0.461914778f},
-std::array<float,2>{0.0562510602f, 0.74236232f},
-std::array<float,2>{0.759353399f, 0.12376859f},
-std::array<float,2>{0.981242001f, 0.588739336f},
-std::array<float,2>{0.204632163f, 0.192795023f},
-std::array<float,2>{0.250154585f, 0.953210533f},
-std::array<float,2>{0.606041551f, 0.332313925f},
-std::array<float,2>{0.846191406f, 0.879196942f},
-std::array<float,2>{0.100644559f, 0.286620528f},
-std::array<float,2>{0.48629263f, 0.50403285f},
-std::array<float,2>{0.643119752f, 0.153916776f},
-std::array<float,2>{0.507310033f, 0.625864089f},
-std::array<float,2>{0.316922992f, 0.0464058556f},
-std::array<float,2>{0.15286237f, 0.843610644f},
-std::array<float,2>{0.911437511f, 0.419753283f},
-std::array<float,2>{0.637399256f, 0.912114143f},
-std::array<float,2>{0.47359392f, 0.264703125f},
-std::array<float,2>{0.112297624f, 0.546479762f},
-std::array<float,2>{0.866405785f, 0.181519359f},
-std::array<float,2>{0.935247242f, 0.676575065f},
-std::array<float,2>{0.139132321f, 0.00232525822f},
-std::array<float,2>{0.34136194f, 0.868932307f},
-std::array<float,2>{0.527075768f, 0.397356749f},
-std::array<float,2>{0.780254722f, 0.811294079f},
-std::array<float,2>{0.0340670682f, 0.499020576f},
-std::array<float,2>{0.407764941f, 0.693067551f},
-std::array<float,2>{0.691711962f, 0.0726455152f},
-std::array<float,2>{0.618659496f, 0.621585786f},
-std::array<float,2>{0.280879438f, 0.247348309f},
-std::array<float,2>{0.202320188f, 0.990125895f},
-std::array<float,2>{0.986480474f, 0.349183202f},
-std::array<float,2>{0.546279013f, 0.826575935f},
-std::array<float,2>{0.356850296f, 0.425592661f},
-std::array<float,2>{0.162463501f, 0.641133666f},
-std::array<float,2>{0.88994354f, 0.0504233614f},
-std::array<float,2>{0.83715868f, 0.529535711f},
-std::array<float,2>{0.0822770298f, 0.128179669f},
-std::array<float,2>{0.463379532f, 0.892526746f},
-std::array<float,2>{0.672307014f, 0.310553491f},
-std::array<float,2>{0.962966263f, 0.939293861f},
-std::array<float,2>{0.240842611f, 0.316339701f},
-std::array<float,2>{0.286128312f, 0.571058273f},
-std::array<float,2>{0.583401442f, 0.217663959f},
-std::array<float,2>{0.72679323f, 0.733370602f},
-std::array<float,2>{0.403142184f, 0.101456471f},
-std::array<float,2>{0.0179729871f, 0.764333069f},
-std::array<float,2>{0.781285584f, 0.437878609f}}
\ No newline at end of file
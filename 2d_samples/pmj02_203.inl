@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.364904016f, 0.191114962f},
-std::array<float,2>{0.937614202f, 0.953749776f},
-std::array<float,2>{0.192016408f, 0.558460772f},
-std::array<float,2>{0.694541574f, 0.499678761f},
-std::array<float,2>{0.0591036938f, 0.266178757f},
-std::array<float,2>{0.614593863f, 0.662830651f},
-std::array<float,2>{0.479478031f, 0.769517958f},
-std::array<float,2>{0.845603704f, 0.0920707732f},
-std::array<float,2>{0.128490031f, 0.0200597905f},
-std::array<float,2>{0.632786155f, 0.818586826f},
-std::array<float,2>{0.283511907f, 0.743156135f},
-std::array<float,2>{0.887137532f, 0.342477083f},
-std::array<float,2>{0.377089918f, 0.407510638f},
-std::array<float,2>{0.810844004f, 0.583520174f},
-std::array<float,2>{0.113740593f, 0.931902349f},
-std::array<float,2>{0.54140985f, 0.137749881f},
-std::array<float,2>{0.459723055f, 0.116181247f},
-std::array<float,2>{0.842040837f, 0.791598856f},
-std::array<float,2>{0.00453520659f, 0.646108687f},
-std::array<float,2>{0.589242518f, 0.300179064f},
-std::array<float,2>{0.221864402f, 0.46369946f},
-std::array<float,2>{0.742214918f, 0.51108253f},
-std::array<float,2>{0.326712787f, 0.999811292f},
-std::array<float,2>{0.969158232f, 0.231613144f},
-std::array<float,2>{0.0872811675f, 0.177473128f},
-std::array<float,2>{0.507937193f, 0.883457303f},
-std::array<float,2>{0.425326407f, 0.620937347f},
-std::array<float,2>{0.775057971f, 0.387203455f},
-std::array<float,2>{0.270627886f, 0.355754465f},
-std::array<float,2>{0.909666002f, 0.698815882f},
-std::array<float,2>{0.186137736f, 0.845335066f},
-std::array<float,2>{0.686357141f, 0.0475404933f},
-std::array<float,2>{0.307691723f, 0.0395567901f},
-std::array<float,2>{0.892526269f, 0.874145508f},
-std::array<float,2>{0.151022166f, 0.715126395f},
-std::array<float,2>{0.644621193f, 0.360921323f},
-std::array<float,2>{0.108356647f, 0.39727664f},
-std::array<float,2>{0.559874117f, 0.601222277f},
-std::array<float,2>{0.391220629f, 0.900053382f},
-std::array<float,2>{0.793176115f, 0.167785257f},
-std::array<float,2>{0.211334631f, 0.249737322f},
-std::array<float,2>{0.713692665f, 0.982293069f},
-std::array<float,2>{0.349756539f, 0.527062535f},
-std::array<float,2>{0.962866187f, 0.451208979f},
-std::array<float,2>{0.490590006f, 0.286394894f},
-std::array<float,2>{0.859603107f, 0.625017226f},
-std::array<float,2>{0.0421330966f, 0.804033995f},
-std::array<float,2>{0.608053982f, 0.104623847f},
-std::array<float,2>{0.414642066f, 0.147136122f},
-std::array<float,2>{0.756979525f, 0.9143489f},
-std::array<float,2>{0.0778549761f, 0.568413317f},
-std::array<float,2>{0.523682594f, 0.429159731f},
-std::array<float,2>{0.169255555f, 0.320198119f},
-std::array<float,2>{0.659021318f, 0.722223759f},
-std::array<float,2>{0.254886478f, 0.837875366f},
-std::array<float,2>{0.936934114f, 0.00817440171f},
-std::array<float,2>{0.0245495811f, 0.074428387f},
-std::array<float,2>{0.568427205f, 0.760546088f},
-std::array<float,2>{0.440002054f, 0.686748624f},
-std::array<float,2>{0.826611876f, 0.255894274f},
-std::array<float,2>{0.333677024f, 0.472624451f},
-std::array<float,2>{0.995516121f, 0.5355618f},
-std::array<float,2>{0.241857663f, 0.946121156f},
-std::array<float,2>{0.725500882f, 0.209805951f},
-std::array<float,2>{0.263806373f, 0.160949945f},
-std::array<float,2>{0.927824199f, 0.891287386f},
-std::array<float,2>{0.156541988f, 0.608977854f},
-std::array<float,2>{0.664196968f, 0.405176878f},
-std::array<float,2>{0.0631429181f, 0.368575305f},
-std::array<float,2>{0.517689824f, 0.710352957f},
-std::array<float,2>{0.412175357f, 0.860041142f},
-std::array<float,2>{0.759633303f, 0.0385566354f},
-std::array<float,2>{0.246244133f, 0.0953566134f},
-std::array<float,2>{0.732306004f, 0.809766054f},
-std::array<float,2>{0.336262971f, 0.638931513f},
-std::array<float,2>{0.985746622f, 0.294065148f},
-std::array<float,2>{0.452160984f, 0.439653397f},
-std::array<float,2>{0.819778204f, 0.521539271f},
-std::array<float,2>{0.020882925f, 0.973416388f},
-std::array<float,2>{0.571172953f, 0.241142273f},
-std::array<float,2>{0.39939186f, 0.00698484946f},
-std::array<float,2>{0.783069015f, 0.831070662f},
-std::array<float,2>{0.094425939f, 0.73352915f},
-std::array<float,2>{0.551938176f, 0.322270602f},
-std::array<float,2>{0.146897972f, 0.435469478f},
-std::array<float,2>{0.652192712f, 0.575793803f},
-std::array<float,2>{0.297692984f, 0.906642854f},
-std::array<float,2>{0.898477077f, 0.153359801f},
-std::array<float,2>{0.0332705677f, 0.215005994f},
-std::array<float,2>{0.595448911f, 0.940639734f},
-std::array<float,2>{0.495504975f, 0.541889548f},
-std::array<float,2>{0.868264198f, 0.481892139f},
-std::array<float,2>{0.35880366f, 0.259685189f},
-std::array<float,2>{0.954805911f, 0.672352314f},
-std::array<float,2>{0.206942156f, 0.757428408f},
-std::array<float,2>{0.709808469f, 0.0658263788f},
-std::array<float,2>{0.313593775f, 0.0856294855f},
-std::array<float,2>{0.984289527f, 0.780958235f},
-std::array<float,2>{0.227832302f, 0.669988692f},
-std::array<float,2>{0.741272628f, 0.27910161f},
-std::array<float,2>{0.0132171353f, 0.489382118f},
-std::array<float,2>{0.584643245f, 0.550528169f},
-std::array<float,2>{0.461185247f, 0.96684128f},
-std::array<float,2>{0.830462158f, 0.200946167f},
-std::array<float,2>{0.176983178f, 0.131137207f},
-std::array<float,2>{0.675132751f, 0.925218284f},
-std::array<float,2>{0.2754004f, 0.593725979f},
-std::array<float,2>{0.914851427f, 0.416705221f},
-std::array<float,2>{0.436834008f, 0.329659075f},
-std::array<float,2>{0.766420424f, 0.740197182f},
-std::array<float,2>{0.0844661519f, 0.826796353f},
-std::array<float,2>{0.504841506f, 0.0286260564f},
-std::array<float,2>{0.47615242f, 0.219394058f},
-std::array<float,2>{0.859344065f, 0.990263283f},
-std::array<float,2>{0.0499453247f, 0.501541853f},
-std::array<float,2>{0.620903194f, 0.453781039f},
-std::array<float,2>{0.200100228f, 0.310577959f},
-std::array<float,2>{0.700067878f, 0.653169811f},
-std::array<float,2>{0.3703354f, 0.788047612f},
-std::array<float,2>{0.946976781f, 0.124677226f},
-std::array<float,2>{0.120245643f, 0.0606492758f},
-std::array<float,2>{0.532057583f, 0.852338672f},
-std::array<float,2>{0.386513114f, 0.694977999f},
-std::array<float,2>{0.803728759f, 0.348509163f},
-std::array<float,2>{0.289402425f, 0.375928789f},
-std::array<float,2>{0.875765502f, 0.614655793f},
-std::array<float,2>{0.135281429f, 0.875958204f},
-std::array<float,2>{0.637040138f, 0.18355687f},
-std::array<float,2>{0.342019349f, 0.135859504f},
-std::array<float,2>{0.991966069f, 0.937353373f},
-std::array<float,2>{0.243788302f, 0.58008033f},
-std::array<float,2>{0.728939235f, 0.411025196f},
-std::array<float,2>{0.01791526f, 0.337285042f},
-std::array<float,2>{0.574275255f, 0.74889797f},
-std::array<float,2>{0.447744161f, 0.812620044f},
-std::array<float,2>{0.813981414f, 0.0181028675f},
-std::array<float,2>{0.163780183f, 0.0879720971f},
-std::array<float,2>{0.671508431f, 0.771394968f},
-std::array<float,2>{0.258496821f, 0.658999562f},
-std::array<float,2>{0.922550797f, 0.272758424f},
-std::array<float,2>{0.409695983f, 0.492667764f},
-std::array<float,2>{0.764941931f, 0.560973704f},
-std::array<float,2>{0.0672422275f, 0.960897803f},
-std::array<float,2>{0.523395002f, 0.194803894f},
-std::array<float,2>{0.499838442f, 0.0509743206f},
-std::array<float,2>{0.874771118f, 0.850339174f},
-std::array<float,2>{0.0355780348f, 0.702560127f},
-std::array<float,2>{0.598856866f, 0.35235697f},
-std::array<float,2>{0.210153788f, 0.384941369f},
-std::array<float,2>{0.706841648f, 0.622542083f},
-std::array<float,2>{0.352488607f, 0.888067544f},
-std::array<float,2>{0.957181096f, 0.171933264f},
-std::array<float,2>{0.0999671072f, 0.227293059f},
-std::array<float,2>{0.550627887f, 0.994733155f},
-std::array<float,2>{0.404584318f, 0.51376915f},
-std::array<float,2>{0.786585689f, 0.468076199f},
-std::array<float,2>{0.304106534f, 0.301057845f},
-std::array<float,2>{0.90578413f, 0.643718183f},
-std::array<float,2>{0.143221617f, 0.796855628f},
-std::array<float,2>{0.654307723f, 0.112137817f},
-std::array<float,2>{0.277872235f, 0.106667303f},
-std::array<float,2>{0.920826852f, 0.797463059f},
-std::array<float,2>{0.174320981f, 0.63159579f},
-std::array<float,2>{0.678527951f, 0.282664388f},
-std::array<float,2>{0.0803372711f, 0.449032664f},
-std::array<float,2>{0.500372767f, 0.53031975f},
-std::array<float,2>{0.431813151f, 0.979159474f},
-std::array<float,2>{0.771926224f, 0.242399901f},
-std::array<float,2>{0.232738435f, 0.168252558f},
-std::array<float,2>{0.734589934f, 0.903536439f},
-std::array<float,2>{0.31670323f, 0.595415473f},
-std::array<float,2>{0.977571428f, 0.392637819f},
-std::array<float,2>{0.465553999f, 0.366769701f},
-std::array<float,2>{0.833873928f, 0.712631047f},
-std::array<float,2>{0.0104743186f, 0.869857967f},
-std::array<float,2>{0.578947842f, 0.0431575365f},
-std::array<float,2>{0.39042455f, 0.206939995f},
-std::array<float,2>{0.800459146f, 0.950823188f},
-std::array<float,2>{0.122332714f, 0.533647656f},
-std::array<float,2>{0.535405815f, 0.475883335f},
-std::array<float,2>{0.136994198f, 0.252811193f},
-std::array<float,2>{0.633776784f, 0.683539808f},
-std::array<float,2>{0.296062142f, 0.764228702f},
-std::array<float,2>{0.880352199f, 0.0716012493f},
-std::array<float,2>{0.0519761033f, 0.0150782624f},
-std::array<float,2>{0.623141527f, 0.842032671f},
-std::array<float,2>{0.469801694f, 0.725525141f},
-std::array<float,2>{0.855079412f, 0.313265681f},
-std::array<float,2>{0.373093665f, 0.422528088f},
-std::array<float,2>{0.951603591f, 0.566025496f},
-std::array<float,2>{0.197092324f, 0.921467245f},
-std::array<float,2>{0.695969641f, 0.144332975f},
-std::array<float,2>{0.288631827f, 0.236659661f},
-std::array<float,2>{0.886695325f, 0.972032905f},
-std::array<float,2>{0.131322488f, 0.517674506f},
-std::array<float,2>{0.626590848f, 0.443656653f},
-std::array<float,2>{0.112682417f, 0.29115504f},
-std::array<float,2>{0.54410702f, 0.635079086f},
-std::array<float,2>{0.381349206f, 0.804987609f},
-std::array<float,2>{0.805053473f, 0.0993764177f},
-std::array<float,2>{0.189642921f, 0.0315951779f},
-std::array<float,2>{0.689263225f, 0.866376162f},
-std::array<float,2>{0.359406441f, 0.703761339f},
-std::array<float,2>{0.945041478f, 0.371680319f},
-std::array<float,2>{0.480728596f, 0.39963302f},
-std::array<float,2>{0.848957539f, 0.604765832f},
-std::array<float,2>{0.0559643731f, 0.898317516f},
-std::array<float,2>{0.611275256f, 0.159706965f},
-std::array<float,2>{0.427178025f, 0.0675376132f},
-std::array<float,2>{0.781025469f, 0.752868712f},
-std::array<float,2>{0.0903249905f, 0.676221192f},
-std::array<float,2>{0.515048206f, 0.263357908f},
-std::array<float,2>{0.180548877f, 0.477423459f},
-std::array<float,2>{0.680601299f, 0.545217752f},
-std::array<float,2>{0.266606331f, 0.943986595f},
-std::array<float,2>{0.910765469f, 0.213101909f},
-std::array<float,2>{0.00359847629f, 0.15223363f},
-std::array<float,2>{0.591075242f, 0.913134873f},
-std::array<float,2>{0.453985512f, 0.571135879f},
-std::array<float,2>{0.836202502f, 0.43312797f},
-std::array<float,2>{0.322741628f, 0.325974852f},
-std::array<float,2>{0.972980559f, 0.730306804f},
-std::array<float,2>{0.22451888f, 0.832712412f},
-std::array<float,2>{0.749908626f, 0.00093409844f},
-std::array<float,2>{0.344365329f, 0.0234408192f},
-std::array<float,2>{0.967694759f, 0.822584212f},
-std::array<float,2>{0.216999367f, 0.734568f},
-std::array<float,2>{0.717232227f, 0.33549732f},
-std::array<float,2>{0.0452131405f, 0.419709474f},
-std::array<float,2>{0.603808463f, 0.586031616f},
-std::array<float,2>{0.485840768f, 0.928321123f},
-std::array<float,2>{0.864624143f, 0.127961978f},
-std::array<float,2>{0.154508352f, 0.1991027f},
-std::array<float,2>{0.642672658f, 0.961127043f},
-std::array<float,2>{0.311048478f, 0.554358125f},
-std::array<float,2>{0.895517528f, 0.486461312f},
-std::array<float,2>{0.396187156f, 0.275871724f},
-std::array<float,2>{0.790559649f, 0.66712594f},
-std::array<float,2>{0.101674698f, 0.775692761f},
-std::array<float,2>{0.557403982f, 0.0784860849f},
-std::array<float,2>{0.442625672f, 0.185238719f},
-std::array<float,2>{0.82409817f, 0.880706906f},
-std::array<float,2>{0.0304291509f, 0.612975299f},
-std::array<float,2>{0.562774837f, 0.381941825f},
-std::array<float,2>{0.235328868f, 0.346873552f},
-std::array<float,2>{0.720600426f, 0.688454568f},
-std::array<float,2>{0.329803616f, 0.856909037f},
-std::array<float,2>{0.997680008f, 0.0564038344f},
-std::array<float,2>{0.0712417364f, 0.11735902f},
-std::array<float,2>{0.530276299f, 0.783124149f},
-std::array<float,2>{0.41872263f, 0.649429798f},
-std::array<float,2>{0.752731144f, 0.307231873f},
-std::array<float,2>{0.251241058f, 0.4588148f},
-std::array<float,2>{0.930992842f, 0.50693059f},
-std::array<float,2>{0.166543931f, 0.986198008f},
-std::array<float,2>{0.66051662f, 0.226404339f},
-std::array<float,2>{0.325960338f, 0.233236507f},
-std::array<float,2>{0.972234726f, 0.997426808f},
-std::array<float,2>{0.220483035f, 0.509284019f},
-std::array<float,2>{0.745260239f, 0.4616476f},
-std::array<float,2>{0.00674784044f, 0.297364026f},
-std::array<float,2>{0.586809278f, 0.648037672f},
-std::array<float,2>{0.458025753f, 0.789149165f},
-std::array<float,2>{0.840375543f, 0.113590702f},
-std::array<float,2>{0.184393868f, 0.0502367951f},
-std::array<float,2>{0.683683693f, 0.846397638f},
-std::array<float,2>{0.271490157f, 0.696870685f},
-std::array<float,2>{0.90737921f, 0.358709693f},
-std::array<float,2>{0.422845006f, 0.388812721f},
-std::array<float,2>{0.775972068f, 0.618367255f},
-std::array<float,2>{0.0886934474f, 0.884944081f},
-std::array<float,2>{0.510636985f, 0.178240716f},
-std::array<float,2>{0.477457613f, 0.0906873792f},
-std::array<float,2>{0.847141147f, 0.76654613f},
-std::array<float,2>{0.0606122725f, 0.662015617f},
-std::array<float,2>{0.616871417f, 0.268997014f},
-std::array<float,2>{0.193410903f, 0.496627092f},
-std::array<float,2>{0.69159025f, 0.556064248f},
-std::array<float,2>{0.366055727f, 0.956689417f},
-std::array<float,2>{0.93963784f, 0.188255817f},
-std::array<float,2>{0.116483673f, 0.139833152f},
-std::array<float,2>{0.539513588f, 0.930226088f},
-std::array<float,2>{0.376177996f, 0.584695816f},
-std::array<float,2>{0.808710873f, 0.409453332f},
-std::array<float,2>{0.282318383f, 0.341391414f},
-std::array<float,2>{0.889900327f, 0.744786143f},
-std::array<float,2>{0.12691924f, 0.81669575f},
-std::array<float,2>{0.62964654f, 0.0231493805f},
-std::array<float,2>{0.255872041f, 0.00997086242f},
-std::array<float,2>{0.933652759f, 0.838171422f},
-std::array<float,2>{0.171609432f, 0.720105708f},
-std::array<float,2>{0.657546639f, 0.316557735f},
-std::array<float,2>{0.0742986053f, 0.427009135f},
-std::array<float,2>{0.526396692f, 0.567865789f},
-std::array<float,2>{0.416299671f, 0.917828619f},
-std::array<float,2>{0.755688429f, 0.14465794f},
-std::array<float,2>{0.238919467f, 0.207460031f},
-std::array<float,2>{0.72279954f, 0.947572827f},
-std::array<float,2>{0.335281819f, 0.538662314f},
-std::array<float,2>{0.993279397f, 0.469948828f},
-std::array<float,2>{0.438918322f, 0.255754262f},
-std::array<float,2>{0.826038003f, 0.68413645f},
-std::array<float,2>{0.0266607739f, 0.758407652f},
-std::array<float,2>{0.567235649f, 0.0772039965f},
-std::array<float,2>{0.393634558f, 0.164526537f},
-std::array<float,2>{0.796684921f, 0.900641024f},
-std::array<float,2>{0.105867229f, 0.599159241f},
-std::array<float,2>{0.561138451f, 0.396013319f},
-std::array<float,2>{0.149665102f, 0.362755299f},
-std::array<float,2>{0.646999419f, 0.717115164f},
-std::array<float,2>{0.306365967f, 0.871192575f},
-std::array<float,2>{0.893025398f, 0.0417994447f},
-std::array<float,2>{0.0403666347f, 0.101999298f},
-std::array<float,2>{0.606969893f, 0.802184761f},
-std::array<float,2>{0.490001351f, 0.62713933f},
-std::array<float,2>{0.862876415f, 0.28888765f},
-std::array<float,2>{0.348118067f, 0.450296342f},
-std::array<float,2>{0.963445008f, 0.525174439f},
-std::array<float,2>{0.213242248f, 0.983374894f},
-std::array<float,2>{0.711077452f, 0.247112408f},
-std::array<float,2>{0.298853606f, 0.155890837f},
-std::array<float,2>{0.900663733f, 0.910089791f},
-std::array<float,2>{0.146349475f, 0.57713753f},
-std::array<float,2>{0.648868382f, 0.43676281f},
-std::array<float,2>{0.0961893275f, 0.322164088f},
-std::array<float,2>{0.553875208f, 0.731617093f},
-std::array<float,2>{0.401235461f, 0.829595745f},
-std::array<float,2>{0.785131514f, 0.00409968616f},
-std::array<float,2>{0.204505667f, 0.0643869713f},
-std::array<float,2>{0.708349884f, 0.754002929f},
-std::array<float,2>{0.356146485f, 0.674436867f},
-std::array<float,2>{0.95671159f, 0.261062354f},
-std::array<float,2>{0.493243068f, 0.482751459f},
-std::array<float,2>{0.870425284f, 0.539066494f},
-std::array<float,2>{0.0323899984f, 0.938114703f},
-std::array<float,2>{0.596614003f, 0.218738467f},
-std::array<float,2>{0.410683393f, 0.0370077007f},
-std::array<float,2>{0.760995746f, 0.862396061f},
-std::array<float,2>{0.0644893348f, 0.707605124f},
-std::array<float,2>{0.516782701f, 0.370239556f},
-std::array<float,2>{0.158424154f, 0.403969288f},
-std::array<float,2>{0.666624606f, 0.606187761f},
-std::array<float,2>{0.262295604f, 0.894343495f},
-std::array<float,2>{0.927454829f, 0.163204372f},
-std::array<float,2>{0.0233754832f, 0.239478752f},
-std::array<float,2>{0.57288444f, 0.975056708f},
-std::array<float,2>{0.450353116f, 0.51958847f},
-std::array<float,2>{0.81814605f, 0.439402282f},
-std::array<float,2>{0.339408308f, 0.295596063f},
-std::array<float,2>{0.986611128f, 0.637752831f},
-std::array<float,2>{0.248838842f, 0.812253654f},
-std::array<float,2>{0.734197438f, 0.0959136188f},
-std::array<float,2>{0.367715985f, 0.122191556f},
-std::array<float,2>{0.949078262f, 0.78658402f},
-std::array<float,2>{0.201873541f, 0.655796826f},
-std::array<float,2>{0.702649951f, 0.310287595f},
-std::array<float,2>{0.0473398827f, 0.455465406f},
-std::array<float,2>{0.61744529f, 0.503653049f},
-std::array<float,2>{0.474035323f, 0.989699304f},
-std::array<float,2>{0.856967568f, 0.221199483f},
-std::array<float,2>{0.132998616f, 0.181362435f},
-std::array<float,2>{0.640145242f, 0.87726903f},
-std::array<float,2>{0.292093784f, 0.617178082f},
-std::array<float,2>{0.877202213f, 0.37820664f},
-std::array<float,2>{0.383476228f, 0.350964427f},
-std::array<float,2>{0.801787972f, 0.691750824f},
-std::array<float,2>{0.118409261f, 0.8550632f},
-std::array<float,2>{0.535073698f, 0.0592619106f},
-std::array<float,2>{0.463153064f, 0.201784939f},
-std::array<float,2>{0.829568386f, 0.965172827f},
-std::array<float,2>{0.0153503958f, 0.547985554f},
-std::array<float,2>{0.583824992f, 0.491468698f},
-std::array<float,2>{0.228687361f, 0.280308753f},
-std::array<float,2>{0.739444792f, 0.668230176f},
-std::array<float,2>{0.315757155f, 0.778409779f},
-std::array<float,2>{0.981824756f, 0.0834449157f},
-std::array<float,2>{0.0835577771f, 0.0309788715f},
-std::array<float,2>{0.506336868f, 0.824670911f},
-std::array<float,2>{0.433980435f, 0.740577698f},
-std::array<float,2>{0.768322468f, 0.331176311f},
-std::array<float,2>{0.274975151f, 0.415069133f},
-std::array<float,2>{0.916338623f, 0.590652525f},
-std::array<float,2>{0.178853884f, 0.923805058f},
-std::array<float,2>{0.672858357f, 0.130548969f},
-std::array<float,2>{0.354437709f, 0.174463883f},
-std::array<float,2>{0.959045172f, 0.890074015f},
-std::array<float,2>{0.207843035f, 0.62468189f},
-std::array<float,2>{0.703656852f, 0.384238094f},
-std::array<float,2>{0.0382563435f, 0.35538128f},
-std::array<float,2>{0.600809515f, 0.700630605f},
-std::array<float,2>{0.496772856f, 0.848407209f},
-std::array<float,2>{0.872403681f, 0.0542189777f},
-std::array<float,2>{0.141826078f, 0.111273386f},
-std::array<float,2>{0.654015481f, 0.793380558f},
-std::array<float,2>{0.300897896f, 0.641779304f},
-std::array<float,2>{0.903616667f, 0.303856313f},
-std::array<float,2>{0.402797014f, 0.46661967f},
-std::array<float,2>{0.788228273f, 0.513163626f},
-std::array<float,2>{0.0980704278f, 0.993674397f},
-std::array<float,2>{0.54695034f, 0.228956327f},
-std::array<float,2>{0.446621895f, 0.0164857768f},
-std::array<float,2>{0.815173686f, 0.816404164f},
-std::array<float,2>{0.0175536461f, 0.746563435f},
-std::array<float,2>{0.57642889f, 0.337929696f},
-std::array<float,2>{0.244844049f, 0.41387248f},
-std::array<float,2>{0.727952123f, 0.578663349f},
-std::array<float,2>{0.340143383f, 0.934229255f},
-std::array<float,2>{0.988410175f, 0.134218186f},
-std::array<float,2>{0.0687775463f, 0.192736164f},
-std::array<float,2>{0.521265924f, 0.957146108f},
-std::array<float,2>{0.407746851f, 0.558608115f},
-std::array<float,2>{0.762014389f, 0.495778561f},
-std::array<float,2>{0.259933978f, 0.270716041f},
-std::array<float,2>{0.925651312f, 0.657337785f},
-std::array<float,2>{0.161358833f, 0.773339868f},
-std::array<float,2>{0.669225693f, 0.0859982967f},
-std::array<float,2>{0.293318033f, 0.0739351362f},
-std::array<float,2>{0.882228673f, 0.762422383f},
-std::array<float,2>{0.139516205f, 0.680571437f},
-std::array<float,2>{0.636171639f, 0.250246078f},
-std::array<float,2>{0.123405524f, 0.474259466f},
-std::array<float,2>{0.538891733f, 0.531715512f},
-std::array<float,2>{0.388386637f, 0.952545285f},
-std::array<float,2>{0.797139347f, 0.203346193f},
-std::array<float,2>{0.198222265f, 0.142539546f},
-std::array<float,2>{0.699061334f, 0.918309987f},
-std::array<float,2>{0.372109562f, 0.563335598f},
-std::array<float,2>{0.949855506f, 0.424305826f},
-std::array<float,2>{0.471781909f, 0.315280139f},
-std::array<float,2>{0.852059722f, 0.722714961f},
-std::array<float,2>{0.0539578013f, 0.841630399f},
-std::array<float,2>{0.621739626f, 0.0120423762f},
-std::array<float,2>{0.431364506f, 0.245724544f},
-std::array<float,2>{0.770899653f, 0.978462994f},
-std::array<float,2>{0.0785121173f, 0.528643906f},
-std::array<float,2>{0.502765894f, 0.445513606f},
-std::array<float,2>{0.173130751f, 0.284686357f},
-std::array<float,2>{0.676395774f, 0.629555523f},
-std::array<float,2>{0.279474944f, 0.79998672f},
-std::array<float,2>{0.917980671f, 0.108808987f},
-std::array<float,2>{0.00858251285f, 0.0461166985f},
-std::array<float,2>{0.581635594f, 0.867960811f},
-std::array<float,2>{0.468460321f, 0.713029444f},
-std::array<float,2>{0.835052907f, 0.363739371f},
-std::array<float,2>{0.320069671f, 0.391388148f},
-std::array<float,2>{0.979272425f, 0.596339583f},
-std::array<float,2>{0.23053053f, 0.906209588f},
-std::array<float,2>{0.738141537f, 0.170248926f},
-std::array<float,2>{0.268342078f, 0.212797016f},
-std::array<float,2>{0.913679481f, 0.942318141f},
-std::array<float,2>{0.182867184f, 0.544716835f},
-std::array<float,2>{0.68198204f, 0.479237765f},
-std::array<float,2>{0.0924673676f, 0.263803422f},
-std::array<float,2>{0.512712717f, 0.677832305f},
-std::array<float,2>{0.428195655f, 0.75160867f},
-std::array<float,2>{0.778472126f, 0.0685628057f},
-std::array<float,2>{0.225959241f, 0.00202397397f},
-std::array<float,2>{0.747378111f, 0.835541844f},
-std::array<float,2>{0.32215932f, 0.728347778f},
-std::array<float,2>{0.975902259f, 0.327676862f},
-std::array<float,2>{0.456623286f, 0.43080616f},
-std::array<float,2>{0.83982724f, 0.573611915f},
-std::array<float,2>{4.4309345e-05f, 0.910443246f},
-std::array<float,2>{0.593307436f, 0.149901971f},
-std::array<float,2>{0.379376739f, 0.100013338f},
-std::array<float,2>{0.806958318f, 0.808411062f},
-std::array<float,2>{0.110604502f, 0.633634508f},
-std::array<float,2>{0.545199454f, 0.290828407f},
-std::array<float,2>{0.129098654f, 0.441713452f},
-std::array<float,2>{0.628273368f, 0.517024398f},
-std::array<float,2>{0.285356432f, 0.969069958f},
-std::array<float,2>{0.883566976f, 0.235067278f},
-std::array<float,2>{0.0579504557f, 0.156798422f},
-std::array<float,2>{0.611882985f, 0.895003557f},
-std::array<float,2>{0.482457608f, 0.603479803f},
-std::array<float,2>{0.850727081f, 0.400468141f},
-std::array<float,2>{0.363232136f, 0.373321593f},
-std::array<float,2>{0.942951143f, 0.705104232f},
-std::array<float,2>{0.187643826f, 0.865038335f},
-std::array<float,2>{0.691065788f, 0.0336130187f},
-std::array<float,2>{0.331953555f, 0.0575523935f},
-std::array<float,2>{0.999392748f, 0.858882427f},
-std::array<float,2>{0.23792477f, 0.689686656f},
-std::array<float,2>{0.721112847f, 0.344004124f},
-std::array<float,2>{0.0280869827f, 0.380671203f},
-std::array<float,2>{0.564992905f, 0.609660506f},
-std::array<float,2>{0.444574118f, 0.881622553f},
-std::array<float,2>{0.821217597f, 0.185876146f},
-std::array<float,2>{0.165029943f, 0.223794207f},
-std::array<float,2>{0.66308248f, 0.98805815f},
-std::array<float,2>{0.2530002f, 0.50403595f},
-std::array<float,2>{0.933327556f, 0.460201144f},
-std::array<float,2>{0.42121923f, 0.304917246f},
-std::array<float,2>{0.751050532f, 0.65061754f},
-std::array<float,2>{0.0725343451f, 0.784305692f},
-std::array<float,2>{0.529175162f, 0.119334467f},
-std::array<float,2>{0.486436039f, 0.126847059f},
-std::array<float,2>{0.866447866f, 0.927145779f},
-std::array<float,2>{0.0435077697f, 0.588706493f},
-std::array<float,2>{0.602360785f, 0.421534061f},
-std::array<float,2>{0.215868816f, 0.3335343f},
-std::array<float,2>{0.714929461f, 0.737209022f},
-std::array<float,2>{0.347340018f, 0.821067333f},
-std::array<float,2>{0.966675162f, 0.0260604583f},
-std::array<float,2>{0.104847088f, 0.0811310932f},
-std::array<float,2>{0.555247843f, 0.773467124f},
-std::array<float,2>{0.396830946f, 0.665322959f},
-std::array<float,2>{0.791702569f, 0.274901092f},
-std::array<float,2>{0.309984356f, 0.485572636f},
-std::array<float,2>{0.896835268f, 0.55248034f},
-std::array<float,2>{0.152611271f, 0.964843571f},
-std::array<float,2>{0.640946448f, 0.196924344f},
-std::array<float,2>{0.334883332f, 0.210533351f},
-std::array<float,2>{0.992959976f, 0.947042048f},
-std::array<float,2>{0.239445955f, 0.536211491f},
-std::array<float,2>{0.724591792f, 0.470729619f},
-std::array<float,2>{0.026159402f, 0.257599831f},
-std::array<float,2>{0.568017483f, 0.686506569f},
-std::array<float,2>{0.437569082f, 0.760954499f},
-std::array<float,2>{0.824774921f, 0.0758555979f},
-std::array<float,2>{0.170622304f, 0.0091361003f},
-std::array<float,2>{0.656986058f, 0.836788237f},
-std::array<float,2>{0.257205963f, 0.721556127f},
-std::array<float,2>{0.935008526f, 0.318517715f},
-std::array<float,2>{0.417811424f, 0.427890956f},
-std::array<float,2>{0.754301906f, 0.569505513f},
-std::array<float,2>{0.0755509138f, 0.915952504f},
-std::array<float,2>{0.525941551f, 0.147970572f},
-std::array<float,2>{0.488954246f, 0.10443607f},
-std::array<float,2>{0.861572146f, 0.802876174f},
-std::array<float,2>{0.0398912169f, 0.626499057f},
-std::array<float,2>{0.605959475f, 0.285529017f},
-std::array<float,2>{0.214382797f, 0.452997237f},
-std::array<float,2>{0.712688863f, 0.526121974f},
-std::array<float,2>{0.348686129f, 0.980526328f},
-std::array<float,2>{0.963911831f, 0.248259127f},
-std::array<float,2>{0.106671929f, 0.166768163f},
-std::array<float,2>{0.562104881f, 0.899243355f},
-std::array<float,2>{0.392756462f, 0.600316584f},
-std::array<float,2>{0.795032263f, 0.397852629f},
-std::array<float,2>{0.305214733f, 0.359526575f},
-std::array<float,2>{0.893687069f, 0.715821624f},
-std::array<float,2>{0.148694918f, 0.873888373f},
-std::array<float,2>{0.648090363f, 0.0408788919f},
-std::array<float,2>{0.273196012f, 0.0487654693f},
-std::array<float,2>{0.906620562f, 0.844702542f},
-std::array<float,2>{0.185460761f, 0.698047042f},
-std::array<float,2>{0.684940934f, 0.357249945f},
-std::array<float,2>{0.0892072022f, 0.388392627f},
-std::array<float,2>{0.511206269f, 0.619850278f},
-std::array<float,2>{0.423023403f, 0.884014547f},
-std::array<float,2>{0.776946425f, 0.176577449f},
-std::array<float,2>{0.219010681f, 0.230689868f},
-std::array<float,2>{0.744628072f, 0.998564839f},
-std::array<float,2>{0.325111628f, 0.510578334f},
-std::array<float,2>{0.970710814f, 0.464363545f},
-std::array<float,2>{0.457939535f, 0.299070597f},
-std::array<float,2>{0.840953648f, 0.644533455f},
-std::array<float,2>{0.00738025317f, 0.79278338f},
-std::array<float,2>{0.587358594f, 0.116888277f},
-std::array<float,2>{0.375041425f, 0.137194976f},
-std::array<float,2>{0.810462952f, 0.933103442f},
-std::array<float,2>{0.115671009f, 0.582414806f},
-std::array<float,2>{0.540884793f, 0.406760544f},
-std::array<float,2>{0.125423789f, 0.343220055f},
-std::array<float,2>{0.629986525f, 0.743284762f},
-std::array<float,2>{0.28213644f, 0.819905818f},
-std::array<float,2>{0.889249086f, 0.02116739f},
-std::array<float,2>{0.0618133768f, 0.0936520174f},
-std::array<float,2>{0.616179347f, 0.768300712f},
-std::array<float,2>{0.478268355f, 0.663918138f},
-std::array<float,2>{0.846116662f, 0.26661098f},
-std::array<float,2>{0.366798341f, 0.498503804f},
-std::array<float,2>{0.941074193f, 0.55708164f},
-std::array<float,2>{0.194438696f, 0.95483309f},
-std::array<float,2>{0.692971051f, 0.190163627f},
-std::array<float,2>{0.291777611f, 0.182279706f},
-std::array<float,2>{0.878311157f, 0.876742721f},
-std::array<float,2>{0.134049535f, 0.613780558f},
-std::array<float,2>{0.638960958f, 0.376645237f},
-std::array<float,2>{0.117194936f, 0.349578142f},
-std::array<float,2>{0.533279955f, 0.693518817f},
-std::array<float,2>{0.38472116f, 0.853375673f},
-std::array<float,2>{0.800986111f, 0.0623317622f},
-std::array<float,2>{0.202856123f, 0.123566918f},
-std::array<float,2>{0.701534808f, 0.788728535f},
-std::array<float,2>{0.368204355f, 0.653805375f},
-std::array<float,2>{0.947413445f, 0.311545789f},
-std::array<float,2>{0.473327249f, 0.454389066f},
-std::array<float,2>{0.856035233f, 0.500936866f},
-std::array<float,2>{0.0478828698f, 0.991394103f},
-std::array<float,2>{0.619133532f, 0.219896957f},
-std::array<float,2>{0.435447246f, 0.0280361641f},
-std::array<float,2>{0.769323051f, 0.827254593f},
-std::array<float,2>{0.0823029652f, 0.739017546f},
-std::array<float,2>{0.507100463f, 0.328646332f},
-std::array<float,2>{0.177898586f, 0.417763442f},
-std::array<float,2>{0.672557354f, 0.592443764f},
-std::array<float,2>{0.274193406f, 0.9247908f},
-std::array<float,2>{0.917740643f, 0.132650033f},
-std::array<float,2>{0.0138297742f, 0.199956819f},
-std::array<float,2>{0.582958341f, 0.968048573f},
-std::array<float,2>{0.464469403f, 0.549029112f},
-std::array<float,2>{0.828950167f, 0.488707095f},
-std::array<float,2>{0.315110326f, 0.278106779f},
-std::array<float,2>{0.981076837f, 0.671839476f},
-std::array<float,2>{0.229888454f, 0.779557109f},
-std::array<float,2>{0.738364339f, 0.0844008178f},
-std::array<float,2>{0.357062876f, 0.0648917183f},
-std::array<float,2>{0.955893338f, 0.755874455f},
-std::array<float,2>{0.203954592f, 0.67345798f},
-std::array<float,2>{0.707146287f, 0.258069009f},
-std::array<float,2>{0.0315653384f, 0.481391311f},
-std::array<float,2>{0.597300112f, 0.542464733f},
-std::array<float,2>{0.493016958f, 0.940203846f},
-std::array<float,2>{0.869497895f, 0.216303349f},
-std::array<float,2>{0.144979775f, 0.152865797f},
-std::array<float,2>{0.650264144f, 0.907250881f},
-std::array<float,2>{0.299962968f, 0.574711919f},
-std::array<float,2>{0.901566565f, 0.43373704f},
-std::array<float,2>{0.401754647f, 0.324078321f},
-std::array<float,2>{0.783821404f, 0.732733548f},
-std::array<float,2>{0.0968794674f, 0.830823123f},
-std::array<float,2>{0.553271949f, 0.0064969575f},
-std::array<float,2>{0.449780703f, 0.241613671f},
-std::array<float,2>{0.81706661f, 0.974227369f},
-std::array<float,2>{0.021839926f, 0.522915065f},
-std::array<float,2>{0.573691428f, 0.441112936f},
-std::array<float,2>{0.249970958f, 0.293764323f},
-std::array<float,2>{0.732474685f, 0.640003681f},
-std::array<float,2>{0.338606358f, 0.809189677f},
-std::array<float,2>{0.987380683f, 0.0945417583f},
-std::array<float,2>{0.0655115321f, 0.0374433473f},
-std::array<float,2>{0.515848458f, 0.861118615f},
-std::array<float,2>{0.411811829f, 0.709202111f},
-std::array<float,2>{0.760446846f, 0.367766172f},
-std::array<float,2>{0.263218194f, 0.40617007f},
-std::array<float,2>{0.925825238f, 0.60764271f},
-std::array<float,2>{0.159372345f, 0.892307281f},
-std::array<float,2>{0.667892873f, 0.161269441f},
-std::array<float,2>{0.371609539f, 0.14282085f},
-std::array<float,2>{0.950474143f, 0.920134604f},
-std::array<float,2>{0.198883027f, 0.564897299f},
-std::array<float,2>{0.697856605f, 0.422950506f},
-std::array<float,2>{0.053071361f, 0.313805223f},
-std::array<float,2>{0.622302234f, 0.726520181f},
-std::array<float,2>{0.471571267f, 0.84294343f},
-std::array<float,2>{0.853108823f, 0.0144351078f},
-std::array<float,2>{0.140060365f, 0.0704779774f},
-std::array<float,2>{0.635479748f, 0.764808357f},
-std::array<float,2>{0.294156551f, 0.68218869f},
-std::array<float,2>{0.881414533f, 0.253700167f},
-std::array<float,2>{0.387522697f, 0.475173146f},
-std::array<float,2>{0.7984851f, 0.534965396f},
-std::array<float,2>{0.124604329f, 0.949345469f},
-std::array<float,2>{0.537476778f, 0.205228642f},
-std::array<float,2>{0.467268944f, 0.0446667485f},
-std::array<float,2>{0.834239841f, 0.870569646f},
-std::array<float,2>{0.00887716468f, 0.711079359f},
-std::array<float,2>{0.580409169f, 0.365612686f},
-std::array<float,2>{0.232150823f, 0.394116491f},
-std::array<float,2>{0.736750662f, 0.59452796f},
-std::array<float,2>{0.318791181f, 0.902657568f},
-std::array<float,2>{0.980206847f, 0.169775411f},
-std::array<float,2>{0.0797753036f, 0.243248343f},
-std::array<float,2>{0.503213048f, 0.979718089f},
-std::array<float,2>{0.429922849f, 0.529753268f},
-std::array<float,2>{0.769677401f, 0.447540224f},
-std::array<float,2>{0.280521542f, 0.282122612f},
-std::array<float,2>{0.919187963f, 0.632715642f},
-std::array<float,2>{0.172729149f, 0.798419714f},
-std::array<float,2>{0.677110255f, 0.106287509f},
-std::array<float,2>{0.302533537f, 0.11256171f},
-std::array<float,2>{0.902553499f, 0.79565078f},
-std::array<float,2>{0.141432881f, 0.642875254f},
-std::array<float,2>{0.653158605f, 0.302167296f},
-std::array<float,2>{0.0994642451f, 0.467639089f},
-std::array<float,2>{0.548318803f, 0.515274167f},
-std::array<float,2>{0.403989345f, 0.995315969f},
-std::array<float,2>{0.787236691f, 0.227607682f},
-std::array<float,2>{0.208788127f, 0.173195601f},
-std::array<float,2>{0.704863012f, 0.887041152f},
-std::array<float,2>{0.354797125f, 0.621320367f},
-std::array<float,2>{0.960377574f, 0.385838628f},
-std::array<float,2>{0.497379839f, 0.352775037f},
-std::array<float,2>{0.871902406f, 0.701450467f},
-std::array<float,2>{0.0379943997f, 0.851438165f},
-std::array<float,2>{0.599713027f, 0.0524547696f},
-std::array<float,2>{0.406884044f, 0.193708241f},
-std::array<float,2>{0.763544917f, 0.959759951f},
-std::array<float,2>{0.069402419f, 0.562179565f},
-std::array<float,2>{0.520261884f, 0.493649632f},
-std::array<float,2>{0.160351068f, 0.271934241f},
-std::array<float,2>{0.668301463f, 0.659633875f},
-std::array<float,2>{0.260925978f, 0.770124614f},
-std::array<float,2>{0.924019277f, 0.0893161893f},
-std::array<float,2>{0.015767673f, 0.0190251395f},
-std::array<float,2>{0.577220798f, 0.814332545f},
-std::array<float,2>{0.445557088f, 0.749590635f},
-std::array<float,2>{0.815532267f, 0.336142391f},
-std::array<float,2>{0.341743708f, 0.41135484f},
-std::array<float,2>{0.99021697f, 0.581292808f},
-std::array<float,2>{0.245816529f, 0.936514616f},
-std::array<float,2>{0.726783454f, 0.135712966f},
-std::array<float,2>{0.252301276f, 0.225526363f},
-std::array<float,2>{0.932060182f, 0.984511435f},
-std::array<float,2>{0.165836349f, 0.505999207f},
-std::array<float,2>{0.663700879f, 0.457810223f},
-std::array<float,2>{0.0736962035f, 0.307694376f},
-std::array<float,2>{0.527522206f, 0.648849487f},
-std::array<float,2>{0.420854807f, 0.781843841f},
-std::array<float,2>{0.750249803f, 0.118434452f},
-std::array<float,2>{0.236640438f, 0.0552817658f},
-std::array<float,2>{0.722170413f, 0.856044173f},
-std::array<float,2>{0.330198914f, 0.688620329f},
-std::array<float,2>{0.998797357f, 0.346145242f},
-std::array<float,2>{0.443570107f, 0.38118282f},
-std::array<float,2>{0.821856201f, 0.61225605f},
-std::array<float,2>{0.0286994521f, 0.879524231f},
-std::array<float,2>{0.565977037f, 0.183993891f},
-std::array<float,2>{0.397645712f, 0.0794038922f},
-std::array<float,2>{0.792537749f, 0.777337253f},
-std::array<float,2>{0.103890978f, 0.666846633f},
-std::array<float,2>{0.556305587f, 0.276505888f},
-std::array<float,2>{0.153329521f, 0.487371922f},
-std::array<float,2>{0.642558694f, 0.552868545f},
-std::array<float,2>{0.309281439f, 0.962631643f},
-std::array<float,2>{0.897592664f, 0.197635353f},
-std::array<float,2>{0.0446109064f, 0.127343997f},
-std::array<float,2>{0.602982759f, 0.928881347f},
-std::array<float,2>{0.487840295f, 0.587582707f},
-std::array<float,2>{0.86569804f, 0.41859588f},
-std::array<float,2>{0.346506625f, 0.334004462f},
-std::array<float,2>{0.964896083f, 0.736034274f},
-std::array<float,2>{0.215284511f, 0.823900759f},
-std::array<float,2>{0.716699421f, 0.0252341274f},
-std::array<float,2>{0.320697039f, 0.00175608066f},
-std::array<float,2>{0.975476325f, 0.833122969f},
-std::array<float,2>{0.225420371f, 0.7294572f},
-std::array<float,2>{0.746179879f, 0.324850619f},
-std::array<float,2>{0.00174516009f, 0.432260364f},
-std::array<float,2>{0.591801524f, 0.572078824f},
-std::array<float,2>{0.455336303f, 0.912271023f},
-std::array<float,2>{0.83874613f, 0.151099563f},
-std::array<float,2>{0.182223454f, 0.214169085f},
-std::array<float,2>{0.683026254f, 0.944858015f},
-std::array<float,2>{0.269323289f, 0.546687841f},
-std::array<float,2>{0.912775099f, 0.478358209f},
-std::array<float,2>{0.428812325f, 0.26239413f},
-std::array<float,2>{0.777625442f, 0.677626669f},
-std::array<float,2>{0.0933217183f, 0.753595948f},
-std::array<float,2>{0.511767924f, 0.0671204701f},
-std::array<float,2>{0.483725518f, 0.158818319f},
-std::array<float,2>{0.849750519f, 0.896691322f},
-std::array<float,2>{0.0573911443f, 0.604411662f},
-std::array<float,2>{0.612888515f, 0.398895293f},
-std::array<float,2>{0.188506559f, 0.372144103f},
-std::array<float,2>{0.690000117f, 0.704978466f},
-std::array<float,2>{0.361647755f, 0.866197705f},
-std::array<float,2>{0.941447079f, 0.0324994363f},
-std::array<float,2>{0.10953331f, 0.0982987359f},
-std::array<float,2>{0.546430051f, 0.806026399f},
-std::array<float,2>{0.380394042f, 0.636153221f},
-std::array<float,2>{0.808407485f, 0.292371094f},
-std::array<float,2>{0.286788613f, 0.445114672f},
-std::array<float,2>{0.884013772f, 0.518678486f},
-std::array<float,2>{0.12996392f, 0.971152186f},
-std::array<float,2>{0.627920985f, 0.237450346f},
-std::array<float,2>{0.351329178f, 0.246277794f},
-std::array<float,2>{0.961562872f, 0.984336793f},
-std::array<float,2>{0.212332457f, 0.523695171f},
-std::array<float,2>{0.714749873f, 0.449323058f},
-std::array<float,2>{0.041529458f, 0.28797856f},
-std::array<float,2>{0.608899891f, 0.628440678f},
-std::array<float,2>{0.491719306f, 0.801727653f},
-std::array<float,2>{0.861171424f, 0.102553189f},
-std::array<float,2>{0.151398331f, 0.0426207818f},
-std::array<float,2>{0.645535886f, 0.872370422f},
-std::array<float,2>{0.307321727f, 0.718706906f},
-std::array<float,2>{0.890983939f, 0.361662f},
-std::array<float,2>{0.392483443f, 0.394955814f},
-std::array<float,2>{0.794134974f, 0.597822547f},
-std::array<float,2>{0.108418107f, 0.901910603f},
-std::array<float,2>{0.55880779f, 0.165697604f},
-std::array<float,2>{0.441200972f, 0.0767911971f},
-std::array<float,2>{0.827890515f, 0.758814931f},
-std::array<float,2>{0.0236741025f, 0.684899092f},
-std::array<float,2>{0.56999892f, 0.254608899f},
-std::array<float,2>{0.240408018f, 0.469581038f},
-std::array<float,2>{0.725856781f, 0.538027704f},
-std::array<float,2>{0.332430363f, 0.948739231f},
-std::array<float,2>{0.995013475f, 0.208901018f},
-std::array<float,2>{0.0768828169f, 0.145526454f},
-std::array<float,2>{0.524613917f, 0.916430473f},
-std::array<float,2>{0.415427208f, 0.566889763f},
-std::array<float,2>{0.756528437f, 0.426450372f},
-std::array<float,2>{0.254560441f, 0.318278432f},
-std::array<float,2>{0.935994625f, 0.719466805f},
-std::array<float,2>{0.168253034f, 0.839069009f},
-std::array<float,2>{0.660144091f, 0.0110277059f},
-std::array<float,2>{0.284289241f, 0.0220004171f},
-std::array<float,2>{0.888276517f, 0.818218231f},
-std::array<float,2>{0.127062067f, 0.745216906f},
-std::array<float,2>{0.630917132f, 0.339894116f},
-std::array<float,2>{0.114514321f, 0.408261985f},
-std::array<float,2>{0.542639971f, 0.585601032f},
-std::array<float,2>{0.378899097f, 0.930902958f},
-std::array<float,2>{0.811537981f, 0.139028743f},
-std::array<float,2>{0.193180293f, 0.189021483f},
-std::array<float,2>{0.69370997f, 0.955703437f},
-std::array<float,2>{0.363313913f, 0.554864585f},
-std::array<float,2>{0.938747942f, 0.497507662f},
-std::array<float,2>{0.479878515f, 0.268039107f},
-std::array<float,2>{0.843817532f, 0.660594046f},
-std::array<float,2>{0.0604974963f, 0.767243266f},
-std::array<float,2>{0.613547802f, 0.0909267589f},
-std::array<float,2>{0.424753934f, 0.178902119f},
-std::array<float,2>{0.773683071f, 0.886488616f},
-std::array<float,2>{0.0867706463f, 0.617606044f},
-std::array<float,2>{0.509688079f, 0.390137553f},
-std::array<float,2>{0.18700318f, 0.357533872f},
-std::array<float,2>{0.686608076f, 0.696065664f},
-std::array<float,2>{0.269696087f, 0.847004771f},
-std::array<float,2>{0.908579886f, 0.049300909f},
-std::array<float,2>{0.00555125205f, 0.114900678f},
-std::array<float,2>{0.588162899f, 0.790456057f},
-std::array<float,2>{0.46069169f, 0.646525621f},
-std::array<float,2>{0.843286574f, 0.297857106f},
-std::array<float,2>{0.327274352f, 0.462511748f},
-std::array<float,2>{0.970578372f, 0.508189261f},
-std::array<float,2>{0.220747337f, 0.99657768f},
-std::array<float,2>{0.743660271f, 0.234316736f},
-std::array<float,2>{0.276978374f, 0.129389703f},
-std::array<float,2>{0.915256441f, 0.922012508f},
-std::array<float,2>{0.176332325f, 0.591111183f},
-std::array<float,2>{0.674583375f, 0.414389342f},
-std::array<float,2>{0.0851939693f, 0.330097497f},
-std::array<float,2>{0.505170405f, 0.741298974f},
-std::array<float,2>{0.436169714f, 0.825378776f},
-std::array<float,2>{0.767299831f, 0.0297111925f},
-std::array<float,2>{0.226718441f, 0.08281672f},
-std::array<float,2>{0.74101913f, 0.777377486f},
-std::array<float,2>{0.313395053f, 0.668982089f},
-std::array<float,2>{0.982688129f, 0.280050009f},
-std::array<float,2>{0.462332636f, 0.490794897f},
-std::array<float,2>{0.831443787f, 0.547700346f},
-std::array<float,2>{0.0121093364f, 0.966526389f},
-std::array<float,2>{0.585066199f, 0.20221971f},
-std::array<float,2>{0.385232776f, 0.0598145239f},
-std::array<float,2>{0.803229153f, 0.854003012f},
-std::array<float,2>{0.119529754f, 0.692602992f},
-std::array<float,2>{0.532525837f, 0.350218624f},
-std::array<float,2>{0.136604115f, 0.377016872f},
-std::array<float,2>{0.637747109f, 0.615263343f},
-std::array<float,2>{0.290872276f, 0.878206909f},
-std::array<float,2>{0.876755774f, 0.179809675f},
-std::array<float,2>{0.049240727f, 0.222390085f},
-std::array<float,2>{0.619521141f, 0.988864422f},
-std::array<float,2>{0.474919587f, 0.502851546f},
-std::array<float,2>{0.858339429f, 0.456810206f},
-std::array<float,2>{0.369983196f, 0.308715463f},
-std::array<float,2>{0.945566595f, 0.654920876f},
-std::array<float,2>{0.200267196f, 0.786006451f},
-std::array<float,2>{0.701041162f, 0.121272393f},
-std::array<float,2>{0.336989403f, 0.0973197594f},
-std::array<float,2>{0.985127985f, 0.811267078f},
-std::array<float,2>{0.247476324f, 0.637527287f},
-std::array<float,2>{0.730517685f, 0.296325356f},
-std::array<float,2>{0.0201306231f, 0.438243389f},
-std::array<float,2>{0.571602583f, 0.520747542f},
-std::array<float,2>{0.451412022f, 0.976397812f},
-std::array<float,2>{0.818783998f, 0.238979012f},
-std::array<float,2>{0.157630965f, 0.162480727f},
-std::array<float,2>{0.665678382f, 0.893360794f},
-std::array<float,2>{0.26480639f, 0.606687725f},
-std::array<float,2>{0.928770244f, 0.40323332f},
-std::array<float,2>{0.413556069f, 0.369769335f},
-std::array<float,2>{0.758507907f, 0.708853602f},
-std::array<float,2>{0.0643437207f, 0.861618519f},
-std::array<float,2>{0.519063354f, 0.0354895853f},
-std::array<float,2>{0.494442433f, 0.216899768f},
-std::array<float,2>{0.867825091f, 0.939121664f},
-std::array<float,2>{0.0342248529f, 0.540168762f},
-std::array<float,2>{0.594399691f, 0.484249294f},
-std::array<float,2>{0.205258906f, 0.259774357f},
-std::array<float,2>{0.710038364f, 0.675144315f},
-std::array<float,2>{0.357961446f, 0.755344033f},
-std::array<float,2>{0.953597963f, 0.0630632788f},
-std::array<float,2>{0.0949208289f, 0.00494856015f},
-std::array<float,2>{0.551156044f, 0.828369558f},
-std::array<float,2>{0.40008834f, 0.731379092f},
-std::array<float,2>{0.782057643f, 0.320572108f},
-std::array<float,2>{0.298354596f, 0.436243266f},
-std::array<float,2>{0.899523199f, 0.577481747f},
-std::array<float,2>{0.14761582f, 0.908623934f},
-std::array<float,2>{0.651109993f, 0.154465586f},
-std::array<float,2>{0.317849576f, 0.171096772f},
-std::array<float,2>{0.976618588f, 0.905069888f},
-std::array<float,2>{0.233436331f, 0.597565413f},
-std::array<float,2>{0.73561281f, 0.391690612f},
-std::array<float,2>{0.0111693535f, 0.364730597f},
-std::array<float,2>{0.579172134f, 0.714515924f},
-std::array<float,2>{0.466155201f, 0.868352234f},
-std::array<float,2>{0.832130194f, 0.045375783f},
-std::array<float,2>{0.174936786f, 0.108261652f},
-std::array<float,2>{0.679224372f, 0.799677074f},
-std::array<float,2>{0.279266387f, 0.630023956f},
-std::array<float,2>{0.921113074f, 0.283336997f},
-std::array<float,2>{0.433081686f, 0.447091669f},
-std::array<float,2>{0.772821844f, 0.528301775f},
-std::array<float,2>{0.0819862112f, 0.976827681f},
-std::array<float,2>{0.50103575f, 0.245044231f},
-std::array<float,2>{0.468791246f, 0.013207688f},
-std::array<float,2>{0.854219079f, 0.84015882f},
-std::array<float,2>{0.0515055582f, 0.724374473f},
-std::array<float,2>{0.624552786f, 0.316211164f},
-std::array<float,2>{0.196251959f, 0.425689161f},
-std::array<float,2>{0.696877599f, 0.563999176f},
-std::array<float,2>{0.3745206f, 0.919426084f},
-std::array<float,2>{0.952955782f, 0.140918314f},
-std::array<float,2>{0.121758297f, 0.204506025f},
-std::array<float,2>{0.536644101f, 0.951555789f},
-std::array<float,2>{0.388737112f, 0.533168912f},
-std::array<float,2>{0.799781024f, 0.472952545f},
-std::array<float,2>{0.295437723f, 0.251377434f},
-std::array<float,2>{0.879799128f, 0.68085146f},
-std::array<float,2>{0.137704536f, 0.763402879f},
-std::array<float,2>{0.634140432f, 0.0726347491f},
-std::array<float,2>{0.259721518f, 0.0873609558f},
-std::array<float,2>{0.923746288f, 0.772066712f},
-std::array<float,2>{0.16252625f, 0.65656811f},
-std::array<float,2>{0.670139313f, 0.270261616f},
-std::array<float,2>{0.0678616688f, 0.494545996f},
-std::array<float,2>{0.521689832f, 0.55976522f},
-std::array<float,2>{0.409072816f, 0.958790064f},
-std::array<float,2>{0.76463449f, 0.192080885f},
-std::array<float,2>{0.242334723f, 0.133515507f},
-std::array<float,2>{0.729718626f, 0.935262918f},
-std::array<float,2>{0.343483031f, 0.579557657f},
-std::array<float,2>{0.990680158f, 0.412348896f},
-std::array<float,2>{0.449022293f, 0.338990331f},
-std::array<float,2>{0.812906861f, 0.74761194f},
-std::array<float,2>{0.0187342912f, 0.815247476f},
-std::array<float,2>{0.575888276f, 0.0174177755f},
-std::array<float,2>{0.40565294f, 0.229964823f},
-std::array<float,2>{0.786127985f, 0.99285239f},
-std::array<float,2>{0.10140612f, 0.512601912f},
-std::array<float,2>{0.549418688f, 0.46551016f},
-std::array<float,2>{0.144315973f, 0.30277577f},
-std::array<float,2>{0.655739307f, 0.640776038f},
-std::array<float,2>{0.30327031f, 0.794530988f},
-std::array<float,2>{0.904765606f, 0.109829478f},
-std::array<float,2>{0.03691753f, 0.0535994135f},
-std::array<float,2>{0.598574698f, 0.849169493f},
-std::array<float,2>{0.498319417f, 0.699862421f},
-std::array<float,2>{0.873775184f, 0.354155362f},
-std::array<float,2>{0.353012502f, 0.382858157f},
-std::array<float,2>{0.95811516f, 0.623847008f},
-std::array<float,2>{0.209013984f, 0.889082253f},
-std::array<float,2>{0.705610693f, 0.175230265f},
-std::array<float,2>{0.312009782f, 0.196081936f},
-std::array<float,2>{0.894718051f, 0.963334501f},
-std::array<float,2>{0.155376092f, 0.550964534f},
-std::array<float,2>{0.644393802f, 0.485271215f},
-std::array<float,2>{0.103511333f, 0.273735166f},
-std::array<float,2>{0.557633996f, 0.664753854f},
-std::array<float,2>{0.394673884f, 0.77526176f},
-std::array<float,2>{0.7899037f, 0.0802836716f},
-std::array<float,2>{0.218652979f, 0.0268391632f},
-std::array<float,2>{0.718323231f, 0.821670532f},
-std::array<float,2>{0.345006883f, 0.738180041f},
-std::array<float,2>{0.968383312f, 0.33243382f},
-std::array<float,2>{0.485287547f, 0.420440346f},
-std::array<float,2>{0.863776028f, 0.588998258f},
-std::array<float,2>{0.0464286543f, 0.925959051f},
-std::array<float,2>{0.604969144f, 0.125582621f},
-std::array<float,2>{0.419920295f, 0.121023037f},
-std::array<float,2>{0.753734887f, 0.783721805f},
-std::array<float,2>{0.0714239702f, 0.651602089f},
-std::array<float,2>{0.530117333f, 0.306235522f},
-std::array<float,2>{0.16747719f, 0.459942997f},
-std::array<float,2>{0.661608815f, 0.505518854f},
-std::array<float,2>{0.250899762f, 0.98725909f},
-std::array<float,2>{0.930158913f, 0.223110646f},
-std::array<float,2>{0.0301697999f, 0.186694816f},
-std::array<float,2>{0.563495159f, 0.881935477f},
-std::array<float,2>{0.441923231f, 0.61127454f},
-std::array<float,2>{0.822925627f, 0.379630446f},
-std::array<float,2>{0.328251153f, 0.345400363f},
-std::array<float,2>{0.9968853f, 0.691160738f},
-std::array<float,2>{0.235655487f, 0.857680082f},
-std::array<float,2>{0.719591558f, 0.0578964613f},
-std::array<float,2>{0.36097157f, 0.0345161483f},
-std::array<float,2>{0.943508148f, 0.864174128f},
-std::array<float,2>{0.191030234f, 0.706259131f},
-std::array<float,2>{0.687592328f, 0.374600619f},
-std::array<float,2>{0.0550783686f, 0.401416004f},
-std::array<float,2>{0.609992683f, 0.602532506f},
-std::array<float,2>{0.482019007f, 0.895851254f},
-std::array<float,2>{0.848043561f, 0.157994792f},
-std::array<float,2>{0.13203451f, 0.23591958f},
-std::array<float,2>{0.625406027f, 0.969763339f},
-std::array<float,2>{0.287931025f, 0.516504347f},
-std::array<float,2>{0.884892285f, 0.442808837f},
-std::array<float,2>{0.382323742f, 0.289347202f},
-std::array<float,2>{0.805721462f, 0.634631038f},
-std::array<float,2>{0.112206519f, 0.806732178f},
-std::array<float,2>{0.543024182f, 0.100685813f},
-std::array<float,2>{0.454375535f, 0.149280339f},
-std::array<float,2>{0.837614179f, 0.912107289f},
-std::array<float,2>{0.00257238979f, 0.572281241f},
-std::array<float,2>{0.590630889f, 0.430458158f},
-std::array<float,2>{0.222866535f, 0.327146798f},
-std::array<float,2>{0.748428285f, 0.727371871f},
-std::array<float,2>{0.323288709f, 0.83454603f},
-std::array<float,2>{0.973760843f, 0.00306163193f},
-std::array<float,2>{0.0912826806f, 0.0700315237f},
-std::array<float,2>{0.514113307f, 0.750699043f},
-std::array<float,2>{0.426351577f, 0.679041922f},
-std::array<float,2>{0.779482007f, 0.265357673f},
-std::array<float,2>{0.265770316f, 0.480307758f},
-std::array<float,2>{0.911217153f, 0.54356128f},
-std::array<float,2>{0.181236252f, 0.94267261f},
-std::array<float,2>{0.680819452f, 0.210973933f},
-std::array<float,2>{0.357907027f, 0.216700912f},
-std::array<float,2>{0.954000711f, 0.939695418f},
-std::array<float,2>{0.205862582f, 0.542934656f},
-std::array<float,2>{0.710631728f, 0.480699241f},
-std::array<float,2>{0.0347859301f, 0.258688301f},
-std::array<float,2>{0.593935251f, 0.673204958f},
-std::array<float,2>{0.495094508f, 0.756719887f},
-std::array<float,2>{0.867657602f, 0.0651970953f},
-std::array<float,2>{0.148403496f, 0.00599094853f},
-std::array<float,2>{0.650671661f, 0.830127597f},
-std::array<float,2>{0.297998369f, 0.7329638f},
-std::array<float,2>{0.900288224f, 0.323644012f},
-std::array<float,2>{0.399719298f, 0.434298486f},
-std::array<float,2>{0.781586766f, 0.574588478f},
-std::array<float,2>{0.0953857526f, 0.907850862f},
-std::array<float,2>{0.551661074f, 0.152604029f},
-std::array<float,2>{0.45209977f, 0.0940005332f},
-std::array<float,2>{0.819154263f, 0.808906496f},
-std::array<float,2>{0.0199241024f, 0.640276253f},
-std::array<float,2>{0.571837604f, 0.293031424f},
-std::array<float,2>{0.247881725f, 0.440504849f},
-std::array<float,2>{0.731206f, 0.523140311f},
-std::array<float,2>{0.337814122f, 0.973643541f},
-std::array<float,2>{0.984847248f, 0.241923213f},
-std::array<float,2>{0.0639623255f, 0.161799729f},
-std::array<float,2>{0.518562376f, 0.891982377f},
-std::array<float,2>{0.413830668f, 0.608361542f},
-std::array<float,2>{0.758250713f, 0.405475706f},
-std::array<float,2>{0.265450031f, 0.367525369f},
-std::array<float,2>{0.929344594f, 0.709625423f},
-std::array<float,2>{0.157945633f, 0.860507607f},
-std::array<float,2>{0.665074289f, 0.0378679819f},
-std::array<float,2>{0.290081114f, 0.0617309883f},
-std::array<float,2>{0.876410842f, 0.853022039f},
-std::array<float,2>{0.135826483f, 0.693975925f},
-std::array<float,2>{0.63852793f, 0.349102855f},
-std::array<float,2>{0.120067202f, 0.376079708f},
-std::array<float,2>{0.533177912f, 0.613424838f},
-std::array<float,2>{0.385403335f, 0.876143873f},
-std::array<float,2>{0.802791774f, 0.181956798f},
-std::array<float,2>{0.200861454f, 0.22051686f},
-std::array<float,2>{0.700571418f, 0.991791546f},
-std::array<float,2>{0.369294345f, 0.500370681f},
-std::array<float,2>{0.945811987f, 0.454908967f},
-std::array<float,2>{0.475577921f, 0.312278509f},
-std::array<float,2>{0.857779443f, 0.654197216f},
-std::array<float,2>{0.0496368371f, 0.788222671f},
-std::array<float,2>{0.619744062f, 0.123434573f},
-std::array<float,2>{0.435641736f, 0.132094324f},
-std::array<float,2>{0.766919494f, 0.924194455f},
-std::array<float,2>{0.0856757611f, 0.59211868f},
-std::array<float,2>{0.505669415f, 0.417060822f},
-std::array<float,2>{0.176028445f, 0.328386515f},
-std::array<float,2>{0.673850179f, 0.738540113f},
-std::array<float,2>{0.276664048f, 0.828103483f},
-std::array<float,2>{0.915610969f, 0.0274232905f},
-std::array<float,2>{0.0123895584f, 0.0845895186f},
-std::array<float,2>{0.585607231f, 0.780076921f},
-std::array<float,2>{0.462605298f, 0.671314538f},
-std::array<float,2>{0.832025468f, 0.27759546f},
-std::array<float,2>{0.312716424f, 0.489032745f},
-std::array<float,2>{0.983328819f, 0.549351692f},
-std::array<float,2>{0.227107778f, 0.96832329f},
-std::array<float,2>{0.740512311f, 0.199403808f},
-std::array<float,2>{0.270358503f, 0.175931141f},
-std::array<float,2>{0.908871233f, 0.884388924f},
-std::array<float,2>{0.187368169f, 0.619146824f},
-std::array<float,2>{0.687070847f, 0.387732446f},
-std::array<float,2>{0.0862866417f, 0.356910914f},
-std::array<float,2>{0.509065688f, 0.697575331f},
-std::array<float,2>{0.424196571f, 0.843804419f},
-std::array<float,2>{0.774390697f, 0.0480176061f},
-std::array<float,2>{0.221447676f, 0.116643034f},
-std::array<float,2>{0.743299544f, 0.792473733f},
-std::array<float,2>{0.327992558f, 0.645174384f},
-std::array<float,2>{0.970085859f, 0.299747169f},
-std::array<float,2>{0.460376412f, 0.464257061f},
-std::array<float,2>{0.842988074f, 0.509871602f},
-std::array<float,2>{0.0049096588f, 0.998274624f},
-std::array<float,2>{0.588382781f, 0.231205106f},
-std::array<float,2>{0.378005296f, 0.0207989998f},
-std::array<float,2>{0.812384903f, 0.819743454f},
-std::array<float,2>{0.114825048f, 0.743875384f},
-std::array<float,2>{0.542108715f, 0.343554556f},
-std::array<float,2>{0.127698556f, 0.406575412f},
-std::array<float,2>{0.631711066f, 0.582765579f},
-std::array<float,2>{0.284776062f, 0.933445811f},
-std::array<float,2>{0.888020575f, 0.137303755f},
-std::array<float,2>{0.0598895736f, 0.189628825f},
-std::array<float,2>{0.613918841f, 0.954562306f},
-std::array<float,2>{0.480442345f, 0.557400763f},
-std::array<float,2>{0.844486713f, 0.498713434f},
-std::array<float,2>{0.363837361f, 0.267365724f},
-std::array<float,2>{0.939357758f, 0.663294673f},
-std::array<float,2>{0.192547292f, 0.767896175f},
-std::array<float,2>{0.694186211f, 0.0929783583f},
-std::array<float,2>{0.33278352f, 0.0756384209f},
-std::array<float,2>{0.994569361f, 0.761453688f},
-std::array<float,2>{0.241026416f, 0.685577512f},
-std::array<float,2>{0.726407945f, 0.257069767f},
-std::array<float,2>{0.0244015194f, 0.471353948f},
-std::array<float,2>{0.569550991f, 0.537067235f},
-std::array<float,2>{0.440820992f, 0.946565747f},
-std::array<float,2>{0.8271842f, 0.210415006f},
-std::array<float,2>{0.168466121f, 0.147817448f},
-std::array<float,2>{0.659363747f, 0.915280163f},
-std::array<float,2>{0.253923833f, 0.57028985f},
-std::array<float,2>{0.936176896f, 0.42854768f},
-std::array<float,2>{0.415640235f, 0.319209993f},
-std::array<float,2>{0.756291687f, 0.720861137f},
-std::array<float,2>{0.0766346827f, 0.836152434f},
-std::array<float,2>{0.525047123f, 0.0095308274f},
-std::array<float,2>{0.491281182f, 0.248625681f},
-std::array<float,2>{0.860630572f, 0.981088459f},
-std::array<float,2>{0.0411848463f, 0.525811553f},
-std::array<float,2>{0.608463883f, 0.452366829f},
-std::array<float,2>{0.212747768f, 0.285802156f},
-std::array<float,2>{0.713960528f, 0.626027167f},
-std::array<float,2>{0.350910544f, 0.803324282f},
-std::array<float,2>{0.961290956f, 0.1038187f},
-std::array<float,2>{0.108941562f, 0.0401833914f},
-std::array<float,2>{0.559513867f, 0.873271883f},
-std::array<float,2>{0.391772091f, 0.716784298f},
-std::array<float,2>{0.794772089f, 0.360159963f},
-std::array<float,2>{0.306809902f, 0.39828971f},
-std::array<float,2>{0.891288102f, 0.599775851f},
-std::array<float,2>{0.152054861f, 0.898885667f},
-std::array<float,2>{0.646073937f, 0.16648975f},
-std::array<float,2>{0.324089199f, 0.150817677f},
-std::array<float,2>{0.974528134f, 0.912929237f},
-std::array<float,2>{0.223393455f, 0.5713287f},
-std::array<float,2>{0.748600125f, 0.431721628f},
-std::array<float,2>{0.00232233224f, 0.324515671f},
-std::array<float,2>{0.590230763f, 0.728883982f},
-std::array<float,2>{0.454684198f, 0.833742499f},
-std::array<float,2>{0.837370515f, 0.00137683493f},
-std::array<float,2>{0.180863827f, 0.0665376112f},
-std::array<float,2>{0.681557894f, 0.75313884f},
-std::array<float,2>{0.266579419f, 0.677093863f},
-std::array<float,2>{0.911939263f, 0.261981726f},
-std::array<float,2>{0.425845116f, 0.477738023f},
-std::array<float,2>{0.779871762f, 0.546275496f},
-std::array<float,2>{0.0915295854f, 0.944546103f},
-std::array<float,2>{0.514604926f, 0.21479325f},
-std::array<float,2>{0.481822908f, 0.0328491032f},
-std::array<float,2>{0.848327935f, 0.865593135f},
-std::array<float,2>{0.0552256778f, 0.704268157f},
-std::array<float,2>{0.609475613f, 0.372929215f},
-std::array<float,2>{0.190694556f, 0.39922905f},
-std::array<float,2>{0.688239992f, 0.603973508f},
-std::array<float,2>{0.360716522f, 0.897350967f},
-std::array<float,2>{0.944133103f, 0.158626944f},
-std::array<float,2>{0.111813478f, 0.237980485f},
-std::array<float,2>{0.543683112f, 0.971405089f},
-std::array<float,2>{0.382736474f, 0.519514501f},
-std::array<float,2>{0.806360543f, 0.444370925f},
-std::array<float,2>{0.287198335f, 0.292650938f},
-std::array<float,2>{0.885663748f, 0.636632323f},
-std::array<float,2>{0.132463098f, 0.806156456f},
-std::array<float,2>{0.625728846f, 0.0977807939f},
-std::array<float,2>{0.25044015f, 0.118718989f},
-std::array<float,2>{0.930629611f, 0.781270385f},
-std::array<float,2>{0.167830169f, 0.649032891f},
-std::array<float,2>{0.66199559f, 0.308348894f},
-std::array<float,2>{0.0722198114f, 0.457117468f},
-std::array<float,2>{0.529733956f, 0.506682217f},
-std::array<float,2>{0.418975592f, 0.985138178f},
-std::array<float,2>{0.753113806f, 0.224808529f},
-std::array<float,2>{0.236031324f, 0.184093446f},
-std::array<float,2>{0.718874335f, 0.879217565f},
-std::array<float,2>{0.32895413f, 0.611742735f},
-std::array<float,2>{0.996139228f, 0.381717235f},
-std::array<float,2>{0.441583663f, 0.346643418f},
-std::array<float,2>{0.822420597f, 0.689346313f},
-std::array<float,2>{0.029514607f, 0.855883121f},
-std::array<float,2>{0.564010322f, 0.0548464283f},
-std::array<float,2>{0.395166457f, 0.198155209f},
-std::array<float,2>{0.789273262f, 0.961951196f},
-std::array<float,2>{0.103003532f, 0.553270817f},
-std::array<float,2>{0.558399737f, 0.488121063f},
-std::array<float,2>{0.156198591f, 0.276880383f},
-std::array<float,2>{0.643570244f, 0.666030884f},
-std::array<float,2>{0.312333286f, 0.776538432f},
-std::array<float,2>{0.895082891f, 0.0799674094f},
-std::array<float,2>{0.0463137031f, 0.0245075207f},
-std::array<float,2>{0.605024338f, 0.823441923f},
-std::array<float,2>{0.484713286f, 0.735699773f},
-std::array<float,2>{0.86358422f, 0.334749758f},
-std::array<float,2>{0.345426887f, 0.418299437f},
-std::array<float,2>{0.967873573f, 0.587094486f},
-std::array<float,2>{0.218225822f, 0.929371119f},
-std::array<float,2>{0.718242705f, 0.127444103f},
-std::array<float,2>{0.303125411f, 0.228188872f},
-std::array<float,2>{0.904981852f, 0.995717406f},
-std::array<float,2>{0.143857017f, 0.515041232f},
-std::array<float,2>{0.655765891f, 0.46724391f},
-std::array<float,2>{0.100742273f, 0.302714407f},
-std::array<float,2>{0.549041271f, 0.643339932f},
-std::array<float,2>{0.405857384f, 0.795226514f},
-std::array<float,2>{0.785225809f, 0.112963542f},
-std::array<float,2>{0.209627509f, 0.0520915836f},
-std::array<float,2>{0.705377102f, 0.85095036f},
-std::array<float,2>{0.353142679f, 0.701992869f},
-std::array<float,2>{0.958626688f, 0.353356719f},
-std::array<float,2>{0.498613685f, 0.386458278f},
-std::array<float,2>{0.873073339f, 0.621989429f},
-std::array<float,2>{0.0365460776f, 0.887461007f},
-std::array<float,2>{0.597811997f, 0.173505694f},
-std::array<float,2>{0.408601612f, 0.0896861255f},
-std::array<float,2>{0.763753355f, 0.769914746f},
-std::array<float,2>{0.0681791157f, 0.660137475f},
-std::array<float,2>{0.522026837f, 0.272286415f},
-std::array<float,2>{0.162626281f, 0.49372074f},
-std::array<float,2>{0.670629442f, 0.561778307f},
-std::array<float,2>{0.259053558f, 0.958997428f},
-std::array<float,2>{0.922951698f, 0.194244593f},
-std::array<float,2>{0.0194397941f, 0.134789854f},
-std::array<float,2>{0.575389922f, 0.935643673f},
-std::array<float,2>{0.448541522f, 0.582015932f},
-std::array<float,2>{0.813108087f, 0.411904275f},
-std::array<float,2>{0.342857182f, 0.336508125f},
-std::array<float,2>{0.990941942f, 0.749232531f},
-std::array<float,2>{0.243072659f, 0.81354177f},
-std::array<float,2>{0.730056584f, 0.0191173423f},
-std::array<float,2>{0.374339163f, 0.013693356f},
-std::array<float,2>{0.952243865f, 0.84369576f},
-std::array<float,2>{0.195602447f, 0.725744545f},
-std::array<float,2>{0.696601033f, 0.314272285f},
-std::array<float,2>{0.0512649119f, 0.423676819f},
-std::array<float,2>{0.624388576f, 0.565040469f},
-std::array<float,2>{0.469617933f, 0.920814216f},
-std::array<float,2>{0.853925943f, 0.143092066f},
-std::array<float,2>{0.138329744f, 0.20581539f},
-std::array<float,2>{0.63444227f, 0.949788332f},
-std::array<float,2>{0.295046329f, 0.534476399f},
-std::array<float,2>{0.879010975f, 0.474809319f},
-std::array<float,2>{0.389398903f, 0.25314945f},
-std::array<float,2>{0.799019098f, 0.682124138f},
-std::array<float,2>{0.121484697f, 0.765208483f},
-std::array<float,2>{0.536550105f, 0.0708754137f},
-std::array<float,2>{0.466694236f, 0.169038579f},
-std::array<float,2>{0.832950532f, 0.903091252f},
-std::array<float,2>{0.0115399398f, 0.593985081f},
-std::array<float,2>{0.579657793f, 0.394037098f},
-std::array<float,2>{0.234070808f, 0.36583212f},
-std::array<float,2>{0.736112416f, 0.711683929f},
-std::array<float,2>{0.317908376f, 0.870954692f},
-std::array<float,2>{0.977152884f, 0.0442747772f},
-std::array<float,2>{0.0813491046f, 0.105711982f},
-std::array<float,2>{0.501930773f, 0.798224747f},
-std::array<float,2>{0.433308154f, 0.631929815f},
-std::array<float,2>{0.773381829f, 0.281510532f},
-std::array<float,2>{0.27832064f, 0.448173523f},
-std::array<float,2>{0.921681762f, 0.53026408f},
-std::array<float,2>{0.175424054f, 0.980213344f},
-std::array<float,2>{0.679088354f, 0.244136825f},
-std::array<float,2>{0.338237911f, 0.238411441f},
-std::array<float,2>{0.987969756f, 0.975772619f},
-std::array<float,2>{0.249059379f, 0.521239042f},
-std::array<float,2>{0.733336151f, 0.43783173f},
-std::array<float,2>{0.0223315749f, 0.296456605f},
-std::array<float,2>{0.574071944f, 0.637200594f},
-std::array<float,2>{0.449381322f, 0.810825109f},
-std::array<float,2>{0.816797316f, 0.0970543474f},
-std::array<float,2>{0.160107866f, 0.0360625908f},
-std::array<float,2>{0.667236269f, 0.862086535f},
-std::array<float,2>{0.262871057f, 0.70838666f},
-std::array<float,2>{0.926597476f, 0.369465292f},
-std::array<float,2>{0.411462724f, 0.40259701f},
-std::array<float,2>{0.759878516f, 0.607157111f},
-std::array<float,2>{0.0664042085f, 0.892979026f},
-std::array<float,2>{0.516395509f, 0.163063213f},
-std::array<float,2>{0.492286861f, 0.0626719743f},
-std::array<float,2>{0.870000184f, 0.755468071f},
-std::array<float,2>{0.0318041816f, 0.675626874f},
-std::array<float,2>{0.596946657f, 0.260562092f},
-std::array<float,2>{0.203176737f, 0.483625531f},
-std::array<float,2>{0.707986891f, 0.54078126f},
-std::array<float,2>{0.356674492f, 0.938930213f},
-std::array<float,2>{0.955323696f, 0.217610672f},
-std::array<float,2>{0.0975940526f, 0.154923573f},
-std::array<float,2>{0.553086281f, 0.908712804f},
-std::array<float,2>{0.402196616f, 0.577830374f},
-std::array<float,2>{0.783224225f, 0.435864449f},
-std::array<float,2>{0.300778657f, 0.321008712f},
-std::array<float,2>{0.901998281f, 0.730836868f},
-std::array<float,2>{0.145491004f, 0.828916013f},
-std::array<float,2>{0.649677813f, 0.00543089164f},
-std::array<float,2>{0.273615032f, 0.0298824664f},
-std::array<float,2>{0.917027235f, 0.825743914f},
-std::array<float,2>{0.178621396f, 0.741869509f},
-std::array<float,2>{0.672154546f, 0.330883563f},
-std::array<float,2>{0.0829563364f, 0.414550781f},
-std::array<float,2>{0.507635593f, 0.591632366f},
-std::array<float,2>{0.43503207f, 0.922636986f},
-std::array<float,2>{0.768718183f, 0.12986201f},
-std::array<float,2>{0.230186462f, 0.202996403f},
-std::array<float,2>{0.739250541f, 0.96588248f},
-std::array<float,2>{0.314754128f, 0.547034144f},
-std::array<float,2>{0.980777442f, 0.49069041f},
-std::array<float,2>{0.463872313f, 0.279464036f},
-std::array<float,2>{0.828508258f, 0.669889152f},
-std::array<float,2>{0.0144896638f, 0.77827698f},
-std::array<float,2>{0.582495451f, 0.0821186602f},
-std::array<float,2>{0.383915395f, 0.180289179f},
-std::array<float,2>{0.801473498f, 0.878635824f},
-std::array<float,2>{0.118096106f, 0.61597532f},
-std::array<float,2>{0.533708215f, 0.377574414f},
-std::array<float,2>{0.134345353f, 0.349900901f},
-std::array<float,2>{0.639360487f, 0.693328261f},
-std::array<float,2>{0.291100115f, 0.854167402f},
-std::array<float,2>{0.878506601f, 0.0600986481f},
-std::array<float,2>{0.0485228859f, 0.122064151f},
-std::array<float,2>{0.618599594f, 0.785379767f},
-std::array<float,2>{0.472709715f, 0.654452741f},
-std::array<float,2>{0.855660439f, 0.309370518f},
-std::array<float,2>{0.368806481f, 0.45624429f},
-std::array<float,2>{0.947879672f, 0.502071321f},
-std::array<float,2>{0.202322274f, 0.98857075f},
-std::array<float,2>{0.701664746f, 0.221900165f},
-std::array<float,2>{0.281569719f, 0.139496669f},
-std::array<float,2>{0.888835907f, 0.931166828f},
-std::array<float,2>{0.125742778f, 0.585339367f},
-std::array<float,2>{0.630555868f, 0.409136295f},
-std::array<float,2>{0.116059951f, 0.340727091f},
-std::array<float,2>{0.54027909f, 0.746090114f},
-std::array<float,2>{0.375767261f, 0.817474663f},
-std::array<float,2>{0.809669852f, 0.0215529464f},
-std::array<float,2>{0.195292845f, 0.0917220935f},
-std::array<float,2>{0.69276756f, 0.767077982f},
-std::array<float,2>{0.366572082f, 0.660849631f},
-std::array<float,2>{0.940586567f, 0.268345356f},
-std::array<float,2>{0.477777153f, 0.497840077f},
-std::array<float,2>{0.846580505f, 0.555200815f},
-std::array<float,2>{0.0620443858f, 0.955220103f},
-std::array<float,2>{0.615706146f, 0.18894133f},
-std::array<float,2>{0.42334345f, 0.0495550074f},
-std::array<float,2>{0.776701927f, 0.847512484f},
-std::array<float,2>{0.0895096585f, 0.69578141f},
-std::array<float,2>{0.511314213f, 0.358003438f},
-std::array<float,2>{0.184905067f, 0.389731467f},
-std::array<float,2>{0.685190499f, 0.618020594f},
-std::array<float,2>{0.272805542f, 0.885772169f},
-std::array<float,2>{0.906792819f, 0.179350331f},
-std::array<float,2>{0.00693644583f, 0.233665824f},
-std::array<float,2>{0.58746928f, 0.996894598f},
-std::array<float,2>{0.457326114f, 0.50876981f},
-std::array<float,2>{0.841610551f, 0.462257951f},
-std::array<float,2>{0.324515641f, 0.298677415f},
-std::array<float,2>{0.971475899f, 0.647294044f},
-std::array<float,2>{0.219433933f, 0.790705025f},
-std::array<float,2>{0.744813085f, 0.114697434f},
-std::array<float,2>{0.349298209f, 0.103177764f},
-std::array<float,2>{0.964438915f, 0.80119282f},
-std::array<float,2>{0.213989601f, 0.628030658f},
-std::array<float,2>{0.712278128f, 0.287199587f},
-std::array<float,2>{0.0391880311f, 0.449971139f},
-std::array<float,2>{0.605554461f, 0.524162173f},
-std::array<float,2>{0.488408595f, 0.983770967f},
-std::array<float,2>{0.861946523f, 0.246755898f},
-std::array<float,2>{0.148978397f, 0.165300459f},
-std::array<float,2>{0.647849917f, 0.901535571f},
-std::array<float,2>{0.304948837f, 0.598412275f},
-std::array<float,2>{0.894333541f, 0.395450592f},
-std::array<float,2>{0.393220812f, 0.361946732f},
-std::array<float,2>{0.795702159f, 0.717933655f},
-std::array<float,2>{0.107380733f, 0.87303412f},
-std::array<float,2>{0.5616889f, 0.0423403569f},
-std::array<float,2>{0.43808651f, 0.208412319f},
-std::array<float,2>{0.824373484f, 0.948251963f},
-std::array<float,2>{0.0254774485f, 0.537175298f},
-std::array<float,2>{0.567864299f, 0.469010085f},
-std::array<float,2>{0.240039319f, 0.253951162f},
-std::array<float,2>{0.723693609f, 0.685088038f},
-std::array<float,2>{0.334387749f, 0.759389341f},
-std::array<float,2>{0.992418587f, 0.0765464082f},
-std::array<float,2>{0.0757450163f, 0.0112663778f},
-std::array<float,2>{0.525793791f, 0.839517593f},
-std::array<float,2>{0.417179644f, 0.718994915f},
-std::array<float,2>{0.754504681f, 0.317477286f},
-std::array<float,2>{0.257555336f, 0.425887942f},
-std::array<float,2>{0.935149133f, 0.56705296f},
-std::array<float,2>{0.170234218f, 0.91659534f},
-std::array<float,2>{0.656441987f, 0.146210998f},
-std::array<float,2>{0.361954302f, 0.15765278f},
-std::array<float,2>{0.942379296f, 0.896387458f},
-std::array<float,2>{0.189107582f, 0.602010369f},
-std::array<float,2>{0.689855516f, 0.401974469f},
-std::array<float,2>{0.0569669977f, 0.374427438f},
-std::array<float,2>{0.612342238f, 0.706872046f},
-std::array<float,2>{0.484303951f, 0.863401175f},
-std::array<float,2>{0.850552678f, 0.0346964449f},
-std::array<float,2>{0.130720884f, 0.101545602f},
-std::array<float,2>{0.62740761f, 0.807533681f},
-std::array<float,2>{0.286174089f, 0.634118497f},
-std::array<float,2>{0.884583294f, 0.289840877f},
-std::array<float,2>{0.380337238f, 0.442913949f},
-std::array<float,2>{0.80810082f, 0.515779972f},
-std::array<float,2>{0.110173471f, 0.970453262f},
-std::array<float,2>{0.546189964f, 0.235645264f},
-std::array<float,2>{0.455924392f, 0.003753511f},
-std::array<float,2>{0.838093877f, 0.834089935f},
-std::array<float,2>{0.00139323296f, 0.726905942f},
-std::array<float,2>{0.592630208f, 0.32662192f},
-std::array<float,2>{0.224963874f, 0.429746628f},
-std::array<float,2>{0.747032046f, 0.572790742f},
-std::array<float,2>{0.320923209f, 0.911524534f},
-std::array<float,2>{0.975010574f, 0.148836449f},
-std::array<float,2>{0.0928314403f, 0.211464062f},
-std::array<float,2>{0.512584388f, 0.943162084f},
-std::array<float,2>{0.429336876f, 0.54336977f},
-std::array<float,2>{0.777848363f, 0.479812026f},
-std::array<float,2>{0.268935919f, 0.264822423f},
-std::array<float,2>{0.912194848f, 0.67948246f},
-std::array<float,2>{0.182111219f, 0.750220358f},
-std::array<float,2>{0.683249116f, 0.0697618797f},
-std::array<float,2>{0.309029758f, 0.080575332f},
-std::array<float,2>{0.898247957f, 0.774877071f},
-std::array<float,2>{0.153870225f, 0.664142668f},
-std::array<float,2>{0.641757786f, 0.274059594f},
-std::array<float,2>{0.104253322f, 0.484435558f},
-std::array<float,2>{0.555702388f, 0.551489234f},
-std::array<float,2>{0.398004919f, 0.963589847f},
-std::array<float,2>{0.792390585f, 0.195316002f},
-std::array<float,2>{0.215754107f, 0.12539801f},
-std::array<float,2>{0.716091037f, 0.926512539f},
-std::array<float,2>{0.345716447f, 0.589473367f},
-std::array<float,2>{0.965744317f, 0.419929057f},
-std::array<float,2>{0.487775534f, 0.33254686f},
-std::array<float,2>{0.866165459f, 0.737496614f},
-std::array<float,2>{0.0443352945f, 0.822169185f},
-std::array<float,2>{0.603253424f, 0.0270090941f},
-std::array<float,2>{0.42000863f, 0.22330156f},
-std::array<float,2>{0.750670075f, 0.986588001f},
-std::array<float,2>{0.0741391778f, 0.50528425f},
-std::array<float,2>{0.527877569f, 0.459038615f},
-std::array<float,2>{0.165490672f, 0.305679709f},
-std::array<float,2>{0.663119316f, 0.652068913f},
-std::array<float,2>{0.252506465f, 0.783486187f},
-std::array<float,2>{0.932133198f, 0.120259427f},
-std::array<float,2>{0.0289975293f, 0.058395084f},
-std::array<float,2>{0.565782428f, 0.858178496f},
-std::array<float,2>{0.444228202f, 0.690691471f},
-std::array<float,2>{0.821681976f, 0.345027506f},
-std::array<float,2>{0.330671042f, 0.379017621f},
-std::array<float,2>{0.998064041f, 0.610788345f},
-std::array<float,2>{0.237153485f, 0.882677257f},
-std::array<float,2>{0.722002685f, 0.187385425f},
-std::array<float,2>{0.261633694f, 0.191514641f},
-std::array<float,2>{0.924454153f, 0.958319664f},
-std::array<float,2>{0.161065206f, 0.560471296f},
-std::array<float,2>{0.668896437f, 0.494877279f},
-std::array<float,2>{0.0698792487f, 0.269873321f},
-std::array<float,2>{0.519928753f, 0.656773686f},
-std::array<float,2>{0.406372637f, 0.771512389f},
-std::array<float,2>{0.762774587f, 0.0874276683f},
-std::array<float,2>{0.245239139f, 0.0168264881f},
-std::array<float,2>{0.727381229f, 0.814629197f},
-std::array<float,2>{0.341099858f, 0.747317553f},
-std::array<float,2>{0.989463031f, 0.339581847f},
-std::array<float,2>{0.446011037f, 0.412904531f},
-std::array<float,2>{0.816250324f, 0.57998234f},
-std::array<float,2>{0.0163310543f, 0.934842169f},
-std::array<float,2>{0.577636838f, 0.133073568f},
-std::array<float,2>{0.403697491f, 0.109888881f},
-std::array<float,2>{0.78805387f, 0.794350207f},
-std::array<float,2>{0.0986998007f, 0.641447604f},
-std::array<float,2>{0.54842478f, 0.303407818f},
-std::array<float,2>{0.140865892f, 0.465151727f},
-std::array<float,2>{0.652345836f, 0.512028933f},
-std::array<float,2>{0.301979631f, 0.992351413f},
-std::array<float,2>{0.90324086f, 0.230036274f},
-std::array<float,2>{0.0372804105f, 0.175311029f},
-std::array<float,2>{0.60038656f, 0.889523208f},
-std::array<float,2>{0.498023123f, 0.623123169f},
-std::array<float,2>{0.871393502f, 0.383392692f},
-std::array<float,2>{0.355099648f, 0.353984982f},
-std::array<float,2>{0.960754931f, 0.699666202f},
-std::array<float,2>{0.208027601f, 0.849102139f},
-std::array<float,2>{0.704167366f, 0.0530780293f},
-std::array<float,2>{0.318923563f, 0.0454984568f},
-std::array<float,2>{0.979961693f, 0.869093895f},
-std::array<float,2>{0.231809482f, 0.713982999f},
-std::array<float,2>{0.736995161f, 0.364846438f},
-std::array<float,2>{0.00927885436f, 0.392157197f},
-std::array<float,2>{0.580943763f, 0.597034395f},
-std::array<float,2>{0.467626154f, 0.90447098f},
-std::array<float,2>{0.834472775f, 0.17160441f},
-std::array<float,2>{0.172027051f, 0.244484127f},
-std::array<float,2>{0.67772609f, 0.977290034f},
-std::array<float,2>{0.28123638f, 0.527499795f},
-std::array<float,2>{0.91956389f, 0.446618229f},
-std::array<float,2>{0.430212557f, 0.284154475f},
-std::array<float,2>{0.770050466f, 0.630594552f},
-std::array<float,2>{0.0792111009f, 0.798845112f},
-std::array<float,2>{0.503834307f, 0.107570618f},
-std::array<float,2>{0.47087577f, 0.1411165f},
-std::array<float,2>{0.852801681f, 0.919640303f},
-std::array<float,2>{0.0534374751f, 0.563527286f},
-std::array<float,2>{0.622947991f, 0.424880385f},
-std::array<float,2>{0.198516756f, 0.315796137f},
-std::array<float,2>{0.697410107f, 0.724009573f},
-std::array<float,2>{0.371147513f, 0.840637445f},
-std::array<float,2>{0.951156735f, 0.0128431618f},
-std::array<float,2>{0.124406643f, 0.0728707835f},
-std::array<float,2>{0.537908792f, 0.763137817f},
-std::array<float,2>{0.386881232f, 0.681328058f},
-std::array<float,2>{0.798232436f, 0.251700848f},
-std::array<float,2>{0.294619262f, 0.473562092f},
-std::array<float,2>{0.880946636f, 0.532519221f},
-std::array<float,2>{0.140332341f, 0.952011526f},
-std::array<float,2>{0.635250211f, 0.204696581f},
-std::array<float,2>{0.315960854f, 0.200678289f},
-std::array<float,2>{0.982174277f, 0.967290998f},
-std::array<float,2>{0.229207456f, 0.550056815f},
-std::array<float,2>{0.740151703f, 0.49007383f},
-std::array<float,2>{0.0147447949f, 0.278480351f},
-std::array<float,2>{0.583423436f, 0.670668364f},
-std::array<float,2>{0.463392824f, 0.780339241f},
-std::array<float,2>{0.829974294f, 0.0850050971f},
-std::array<float,2>{0.179460421f, 0.0292083155f},
-std::array<float,2>{0.673678756f, 0.826491952f},
-std::array<float,2>{0.274517357f, 0.739499032f},
-std::array<float,2>{0.916977942f, 0.329319537f},
-std::array<float,2>{0.434206337f, 0.416156501f},
-std::array<float,2>{0.767665982f, 0.593176126f},
-std::array<float,2>{0.0832547471f, 0.925612092f},
-std::array<float,2>{0.506512046f, 0.131755769f},
-std::array<float,2>{0.474460423f, 0.124445736f},
-std::array<float,2>{0.856520712f, 0.787146032f},
-std::array<float,2>{0.0476068556f, 0.652550161f},
-std::array<float,2>{0.61806643f, 0.311319172f},
-std::array<float,2>{0.201463178f, 0.453252196f},
-std::array<float,2>{0.70226872f, 0.501081288f},
-std::array<float,2>{0.367273927f, 0.990894616f},
-std::array<float,2>{0.948690057f, 0.219189212f},
-std::array<float,2>{0.118844807f, 0.182710931f},
-std::array<float,2>{0.534357607f, 0.875077307f},
-std::array<float,2>{0.382990986f, 0.615090251f},
-std::array<float,2>{0.802361786f, 0.375074416f},
-std::array<float,2>{0.29294464f, 0.348133743f},
-std::array<float,2>{0.877610385f, 0.694664836f},
-std::array<float,2>{0.133612707f, 0.851713777f},
-std::array<float,2>{0.639902294f, 0.0612291954f},
-std::array<float,2>{0.262066931f, 0.039002616f},
-std::array<float,2>{0.927230954f, 0.859515905f},
-std::array<float,2>{0.159005016f, 0.710772693f},
-std::array<float,2>{0.666026533f, 0.36880061f},
-std::array<float,2>{0.065277487f, 0.404526234f},
-std::array<float,2>{0.517464638f, 0.6087327f},
-std::array<float,2>{0.410467654f, 0.890760839f},
-std::array<float,2>{0.761411607f, 0.160261407f},
-std::array<float,2>{0.248401687f, 0.240461394f},
-std::array<float,2>{0.733487248f, 0.972928405f},
-std::array<float,2>{0.339070946f, 0.522229493f},
-std::array<float,2>{0.986997902f, 0.440012932f},
-std::array<float,2>{0.451135337f, 0.294435889f},
-std::array<float,2>{0.817568123f, 0.63935405f},
-std::array<float,2>{0.022774037f, 0.810059428f},
-std::array<float,2>{0.572326899f, 0.0950795114f},
-std::array<float,2>{0.400606543f, 0.154147148f},
-std::array<float,2>{0.78443253f, 0.90714711f},
-std::array<float,2>{0.0963705927f, 0.575528443f},
-std::array<float,2>{0.55453229f, 0.434688359f},
-std::array<float,2>{0.1459537f, 0.32313329f},
-std::array<float,2>{0.649282992f, 0.734301925f},
-std::array<float,2>{0.299595058f, 0.832026124f},
-std::array<float,2>{0.90124923f, 0.00754595781f},
-std::array<float,2>{0.0331745893f, 0.0660181865f},
-std::array<float,2>{0.595980883f, 0.757272601f},
-std::array<float,2>{0.493818939f, 0.672795475f},
-std::array<float,2>{0.870875001f, 0.258943349f},
-std::array<float,2>{0.355496496f, 0.482256681f},
-std::array<float,2>{0.956166565f, 0.541079462f},
-std::array<float,2>{0.204893157f, 0.941018105f},
-std::array<float,2>{0.708720088f, 0.215671003f},
-std::array<float,2>{0.305790186f, 0.167412743f},
-std::array<float,2>{0.893170476f, 0.899461925f},
-std::array<float,2>{0.15032585f, 0.600641191f},
-std::array<float,2>{0.646965444f, 0.396646798f},
-std::array<float,2>{0.106300905f, 0.360474437f},
-std::array<float,2>{0.560772598f, 0.715786815f},
-std::array<float,2>{0.394293964f, 0.874658644f},
-std::array<float,2>{0.795906544f, 0.0393449068f},
-std::array<float,2>{0.213799372f, 0.105184846f},
-std::array<float,2>{0.711470187f, 0.804375231f},
-std::array<float,2>{0.348615319f, 0.625949621f},
-std::array<float,2>{0.963145316f, 0.286850274f},
-std::array<float,2>{0.489743292f, 0.451965749f},
-std::array<float,2>{0.862494349f, 0.526650548f},
-std::array<float,2>{0.0409330912f, 0.981513977f},
-std::array<float,2>{0.606740892f, 0.249037638f},
-std::array<float,2>{0.416748077f, 0.00859130826f},
-std::array<float,2>{0.755166113f, 0.837341785f},
-std::array<float,2>{0.074972868f, 0.72198236f},
-std::array<float,2>{0.526949942f, 0.319382936f},
-std::array<float,2>{0.171210155f, 0.429324716f},
-std::array<float,2>{0.657828987f, 0.569172978f},
-std::array<float,2>{0.256575316f, 0.914599657f},
-std::array<float,2>{0.934113681f, 0.146631449f},
-std::array<float,2>{0.0272574294f, 0.209052175f},
-std::array<float,2>{0.566595376f, 0.945800364f},
-std::array<float,2>{0.439079225f, 0.535923839f},
-std::array<float,2>{0.825562239f, 0.472137779f},
-std::array<float,2>{0.33551985f, 0.256555736f},
-std::array<float,2>{0.994099498f, 0.687333107f},
-std::array<float,2>{0.238448709f, 0.760209322f},
-std::array<float,2>{0.723258913f, 0.0751862526f},
-std::array<float,2>{0.365512073f, 0.0927517638f},
-std::array<float,2>{0.940417886f, 0.768948972f},
-std::array<float,2>{0.193910256f, 0.662383556f},
-std::array<float,2>{0.692006946f, 0.265984505f},
-std::array<float,2>{0.0613997094f, 0.499389648f},
-std::array<float,2>{0.616493046f, 0.557639897f},
-std::array<float,2>{0.476666629f, 0.9532184f},
-std::array<float,2>{0.847549498f, 0.190759033f},
-std::array<float,2>{0.12603803f, 0.138290018f},
-std::array<float,2>{0.628999412f, 0.932423055f},
-std::array<float,2>{0.282962203f, 0.58340323f},
-std::array<float,2>{0.890396357f, 0.408133835f},
-std::array<float,2>{0.376605392f, 0.342198282f},
-std::array<float,2>{0.809488475f, 0.742436469f},
-std::array<float,2>{0.116819918f, 0.818888843f},
-std::array<float,2>{0.539591968f, 0.0197755527f},
-std::array<float,2>{0.458761364f, 0.232208282f},
-std::array<float,2>{0.840019763f, 0.999109268f},
-std::array<float,2>{0.00600940548f, 0.511655033f},
-std::array<float,2>{0.586385548f, 0.463338792f},
-std::array<float,2>{0.220061541f, 0.300370514f},
-std::array<float,2>{0.745684445f, 0.645665467f},
-std::array<float,2>{0.325402081f, 0.791493237f},
-std::array<float,2>{0.97192347f, 0.115671635f},
-std::array<float,2>{0.0881419778f, 0.0473316498f},
-std::array<float,2>{0.509855628f, 0.844969034f},
-std::array<float,2>{0.422100902f, 0.698726356f},
-std::array<float,2>{0.77561605f, 0.356119484f},
-std::array<float,2>{0.272369742f, 0.387488753f},
-std::array<float,2>{0.907903731f, 0.620135665f},
-std::array<float,2>{0.183676079f, 0.883054733f},
-std::array<float,2>{0.684431434f, 0.176783025f},
-std::array<float,2>{0.346916407f, 0.128653958f},
-std::array<float,2>{0.965925694f, 0.927736938f},
-std::array<float,2>{0.216347456f, 0.586756766f},
-std::array<float,2>{0.715674222f, 0.419349104f},
-std::array<float,2>{0.0431063175f, 0.335200638f},
-std::array<float,2>{0.601753891f, 0.734972239f},
-std::array<float,2>{0.486914665f, 0.823146105f},
-std::array<float,2>{0.866933227f, 0.0243471786f},
-std::array<float,2>{0.153239965f, 0.0787755474f},
-std::array<float,2>{0.641443431f, 0.776299059f},
-std::array<float,2>{0.310383677f, 0.66749692f},
-std::array<float,2>{0.897403061f, 0.275912523f},
-std::array<float,2>{0.397121012f, 0.48722747f},
-std::array<float,2>{0.791338086f, 0.554073751f},
-std::array<float,2>{0.105273366f, 0.961473227f},
-std::array<float,2>{0.555149436f, 0.198665217f},
-std::array<float,2>{0.445182681f, 0.0559584051f},
-std::array<float,2>{0.820542812f, 0.85716033f},
-std::array<float,2>{0.0278186109f, 0.687874913f},
-std::array<float,2>{0.564553678f, 0.347446173f},
-std::array<float,2>{0.237627059f, 0.382603437f},
-std::array<float,2>{0.721580386f, 0.612777948f},
-std::array<float,2>{0.331083745f, 0.880223632f},
-std::array<float,2>{0.999725699f, 0.184785381f},
-std::array<float,2>{0.0727832019f, 0.225750253f},
-std::array<float,2>{0.528686225f, 0.98558414f},
-std::array<float,2>{0.421688944f, 0.507506609f},
-std::array<float,2>{0.751827776f, 0.458299309f},
-std::array<float,2>{0.2538656f, 0.307099819f},
-std::array<float,2>{0.932918251f, 0.650205672f},
-std::array<float,2>{0.164396599f, 0.782283604f},
-std::array<float,2>{0.662119746f, 0.117855951f},
-std::array<float,2>{0.28578952f, 0.0991151929f},
-std::array<float,2>{0.883120656f, 0.805379748f},
-std::array<float,2>{0.129649624f, 0.635469437f},
-std::array<float,2>{0.628735244f, 0.291951358f},
-std::array<float,2>{0.11120563f, 0.444177389f},
-std::array<float,2>{0.545466542f, 0.518129051f},
-std::array<float,2>{0.379787862f, 0.972545683f},
-std::array<float,2>{0.807309687f, 0.236955598f},
-std::array<float,2>{0.188259482f, 0.159383237f},
-std::array<float,2>{0.690510094f, 0.897848487f},
-std::array<float,2>{0.362438828f, 0.605183959f},
-std::array<float,2>{0.942638636f, 0.399947852f},
-std::array<float,2>{0.483195901f, 0.371283621f},
-std::array<float,2>{0.851282716f, 0.703572929f},
-std::array<float,2>{0.0583446734f, 0.866918325f},
-std::array<float,2>{0.611719728f, 0.0321319252f},
-std::array<float,2>{0.428402305f, 0.213773504f},
-std::array<float,2>{0.778823912f, 0.943417072f},
-std::array<float,2>{0.0922132209f, 0.545681834f},
-std::array<float,2>{0.513402581f, 0.476884514f},
-std::array<float,2>{0.183325693f, 0.262750179f},
-std::array<float,2>{0.682342827f, 0.676746011f},
-std::array<float,2>{0.267861784f, 0.75208199f},
-std::array<float,2>{0.913251519f, 0.0681493357f},
-std::array<float,2>{0.00056183408f, 0.000479835755f},
-std::array<float,2>{0.592790544f, 0.8324579f},
-std::array<float,2>{0.456371248f, 0.729754686f},
-std::array<float,2>{0.838928998f, 0.325415283f},
-std::array<float,2>{0.321398973f, 0.433019072f},
-std::array<float,2>{0.976381838f, 0.570705652f},
-std::array<float,2>{0.226491496f, 0.913898528f},
-std::array<float,2>{0.747583628f, 0.151680991f},
-std::array<float,2>{0.280150533f, 0.242820635f},
-std::array<float,2>{0.918941557f, 0.978583455f},
-std::array<float,2>{0.17364049f, 0.530892909f},
-std::array<float,2>{0.676148355f, 0.448613405f},
-std::array<float,2>{0.0790685862f, 0.283067882f},
-std::array<float,2>{0.502431989f, 0.630976737f},
-std::array<float,2>{0.430847347f, 0.797253311f},
-std::array<float,2>{0.771012604f, 0.10694436f},
-std::array<float,2>{0.231234521f, 0.0436173715f},
-std::array<float,2>{0.737674177f, 0.869270265f},
-std::array<float,2>{0.319582611f, 0.712260485f},
-std::array<float,2>{0.978826165f, 0.366273433f},
-std::array<float,2>{0.46792078f, 0.393342137f},
-std::array<float,2>{0.835924625f, 0.594978094f},
-std::array<float,2>{0.00791722164f, 0.90382731f},
-std::array<float,2>{0.581097245f, 0.168604702f},
-std::array<float,2>{0.388121694f, 0.0721601993f},
-std::array<float,2>{0.797693551f, 0.763810694f},
-std::array<float,2>{0.123679735f, 0.683007896f},
-std::array<float,2>{0.53856951f, 0.252095848f},
-std::array<float,2>{0.13905257f, 0.476513147f},
-std::array<float,2>{0.636296451f, 0.534007132f},
-std::array<float,2>{0.293532431f, 0.950451016f},
-std::array<float,2>{0.882578611f, 0.206309631f},
-std::array<float,2>{0.054304745f, 0.143652692f},
-std::array<float,2>{0.621273279f, 0.92108047f},
-std::array<float,2>{0.47258994f, 0.565822899f},
-std::array<float,2>{0.851640224f, 0.422298729f},
-std::array<float,2>{0.372600824f, 0.312874943f},
-std::array<float,2>{0.949654698f, 0.724686861f},
-std::array<float,2>{0.197340891f, 0.842570484f},
-std::array<float,2>{0.698257506f, 0.0151453838f},
-std::array<float,2>{0.34065026f, 0.0178657342f},
-std::array<float,2>{0.988849282f, 0.813454688f},
-std::array<float,2>{0.244401515f, 0.74841547f},
-std::array<float,2>{0.72828263f, 0.337501734f},
-std::array<float,2>{0.016976906f, 0.410546005f},
-std::array<float,2>{0.57692498f, 0.580600917f},
-std::array<float,2>{0.446928263f, 0.936922371f},
-std::array<float,2>{0.814607203f, 0.136378899f},
-std::array<float,2>{0.161893219f, 0.195145145f},
-std::array<float,2>{0.669459581f, 0.960267305f},
-std::array<float,2>{0.2606484f, 0.561191082f},
-std::array<float,2>{0.925024927f, 0.493159741f},
-std::array<float,2>{0.407421172f, 0.27333042f},
-std::array<float,2>{0.762306452f, 0.658304751f},
-std::array<float,2>{0.0693120658f, 0.770809889f},
-std::array<float,2>{0.520648777f, 0.0887428001f},
-std::array<float,2>{0.496366352f, 0.172490567f},
-std::array<float,2>{0.872922421f, 0.888529122f},
-std::array<float,2>{0.0388073437f, 0.622893929f},
-std::array<float,2>{0.60145402f, 0.385424465f},
-std::array<float,2>{0.207121581f, 0.35196507f},
-std::array<float,2>{0.703483105f, 0.702929854f},
-std::array<float,2>{0.353782982f, 0.849662483f},
-std::array<float,2>{0.959677577f, 0.0516277999f},
-std::array<float,2>{0.0985122547f, 0.111373037f},
-std::array<float,2>{0.54742372f, 0.796226919f},
-std::array<float,2>{0.403140128f, 0.64422822f},
-std::array<float,2>{0.78895545f, 0.301612198f},
-std::array<float,2>{0.301301181f, 0.46860227f},
-std::array<float,2>{0.90404582f, 0.514281511f},
-std::array<float,2>{0.142323941f, 0.994547248f},
-std::array<float,2>{0.653388619f, 0.226864606f},
-std::array<float,2>{0.370846421f, 0.22085759f},
-std::array<float,2>{0.946560442f, 0.989762783f},
-std::array<float,2>{0.199413225f, 0.503268361f},
-std::array<float,2>{0.699323535f, 0.455749542f},
-std::array<float,2>{0.0504723415f, 0.309647709f},
-std::array<float,2>{0.620589614f, 0.655463755f},
-std::array<float,2>{0.476030499f, 0.786894262f},
-std::array<float,2>{0.858513951f, 0.123029269f},
-std::array<float,2>{0.134925827f, 0.0587466694f},
-std::array<float,2>{0.637297034f, 0.854863465f},
-std::array<float,2>{0.289607882f, 0.691997111f},
-std::array<float,2>{0.875372469f, 0.351108104f},
-std::array<float,2>{0.385859728f, 0.378607661f},
-std::array<float,2>{0.804588139f, 0.616504252f},
-std::array<float,2>{0.120664872f, 0.877668321f},
-std::array<float,2>{0.531550586f, 0.180669993f},
-std::array<float,2>{0.461841553f, 0.0835753158f},
-std::array<float,2>{0.83105278f, 0.77884841f},
-std::array<float,2>{0.0129262516f, 0.668893576f},
-std::array<float,2>{0.584329247f, 0.280768871f},
-std::array<float,2>{0.228433818f, 0.491703838f},
-std::array<float,2>{0.74180156f, 0.548471212f},
-std::array<float,2>{0.314098656f, 0.965729773f},
-std::array<float,2>{0.983704329f, 0.2014568f},
-std::array<float,2>{0.0845984593f, 0.130195796f},
-std::array<float,2>{0.504088342f, 0.923162222f},
-std::array<float,2>{0.437133253f, 0.589923799f},
-std::array<float,2>{0.765838385f, 0.415720016f},
-std::array<float,2>{0.2758798f, 0.331661105f},
-std::array<float,2>{0.914507568f, 0.740999818f},
-std::array<float,2>{0.177636743f, 0.825028181f},
-std::array<float,2>{0.675561726f, 0.0307326782f},
-std::array<float,2>{0.296954781f, 0.00445436081f},
-std::array<float,2>{0.898985863f, 0.829439998f},
-std::array<float,2>{0.146998867f, 0.732172608f},
-std::array<float,2>{0.651444435f, 0.321674436f},
-std::array<float,2>{0.0937524289f, 0.43738994f},
-std::array<float,2>{0.552724719f, 0.576295614f},
-std::array<float,2>{0.398743063f, 0.909648657f},
-std::array<float,2>{0.782545507f, 0.155351758f},
-std::array<float,2>{0.206239998f, 0.217953295f},
-std::array<float,2>{0.70922929f, 0.937894404f},
-std::array<float,2>{0.359369844f, 0.539871871f},
-std::array<float,2>{0.954329073f, 0.483045846f},
-std::array<float,2>{0.495856851f, 0.26136905f},
-std::array<float,2>{0.868977964f, 0.674106658f},
-std::array<float,2>{0.0341629945f, 0.754556179f},
-std::array<float,2>{0.595184863f, 0.0638506636f},
-std::array<float,2>{0.412681729f, 0.163945764f},
-std::array<float,2>{0.758933306f, 0.893852651f},
-std::array<float,2>{0.0627884641f, 0.605763555f},
-std::array<float,2>{0.518409312f, 0.403542459f},
-std::array<float,2>{0.156906873f, 0.370758593f},
-std::array<float,2>{0.664566338f, 0.707383394f},
-std::array<float,2>{0.264453322f, 0.8629632f},
-std::array<float,2>{0.928598106f, 0.0365949385f},
-std::array<float,2>{0.0213546082f, 0.0965355933f},
-std::array<float,2>{0.570361972f, 0.811730444f},
-std::array<float,2>{0.452797979f, 0.638653934f},
-std::array<float,2>{0.81992805f, 0.295233309f},
-std::array<float,2>{0.336911261f, 0.43884638f},
-std::array<float,2>{0.986136377f, 0.520146072f},
-std::array<float,2>{0.246753126f, 0.975183189f},
-std::array<float,2>{0.731744647f, 0.239792928f},
-std::array<float,2>{0.25558129f, 0.145079061f},
-std::array<float,2>{0.937149107f, 0.917303801f},
-std::array<float,2>{0.169859692f, 0.568054855f},
-std::array<float,2>{0.658289075f, 0.427660942f},
-std::array<float,2>{0.0774038583f, 0.317233115f},
-std::array<float,2>{0.524174154f, 0.720621467f},
-std::array<float,2>{0.414319724f, 0.838674128f},
-std::array<float,2>{0.757597029f, 0.0104452865f},
-std::array<float,2>{0.241312191f, 0.0776624382f},
-std::array<float,2>{0.724822938f, 0.758188188f},
-std::array<float,2>{0.333458364f, 0.683692157f},
-std::array<float,2>{0.995917976f, 0.255002201f},
-std::array<float,2>{0.439936846f, 0.470345527f},
-std::array<float,2>{0.826847494f, 0.538494408f},
-std::array<float,2>{0.0250859447f, 0.947952747f},
-std::array<float,2>{0.568908632f, 0.207921624f},
-std::array<float,2>{0.390966386f, 0.0411280245f},
-std::array<float,2>{0.793791831f, 0.871605217f},
-std::array<float,2>{0.10780286f, 0.71740371f},
-std::array<float,2>{0.560243011f, 0.363077074f},
-std::array<float,2>{0.150827512f, 0.395585328f},
-std::array<float,2>{0.645051897f, 0.598636568f},
-std::array<float,2>{0.30851686f, 0.901290298f},
-std::array<float,2>{0.891727448f, 0.164979368f},
-std::array<float,2>{0.0426112749f, 0.247865364f},
-std::array<float,2>{0.607594252f, 0.982894421f},
-std::array<float,2>{0.491192341f, 0.524542034f},
-std::array<float,2>{0.860228062f, 0.45105812f},
-std::array<float,2>{0.350485265f, 0.288398266f},
-std::array<float,2>{0.962141156f, 0.627604783f},
-std::array<float,2>{0.211524218f, 0.802428544f},
-std::array<float,2>{0.713133931f, 0.102234811f},
-std::array<float,2>{0.326298296f, 0.113900922f},
-std::array<float,2>{0.969670653f, 0.789668441f},
-std::array<float,2>{0.222651035f, 0.647844791f},
-std::array<float,2>{0.742703557f, 0.297317982f},
-std::array<float,2>{0.00400424516f, 0.461229771f},
-std::array<float,2>{0.58953774f, 0.509021759f},
-std::array<float,2>{0.459191561f, 0.997903109f},
-std::array<float,2>{0.842372954f, 0.232779264f},
-std::array<float,2>{0.185838148f, 0.178010151f},
-std::array<float,2>{0.685826719f, 0.885470808f},
-std::array<float,2>{0.271360666f, 0.619030952f},
-std::array<float,2>{0.909898937f, 0.389314443f},
-std::array<float,2>{0.424907923f, 0.359254807f},
-std::array<float,2>{0.774728477f, 0.696357191f},
-std::array<float,2>{0.0878727511f, 0.845824778f},
-std::array<float,2>{0.508453965f, 0.0504738353f},
-std::array<float,2>{0.47852096f, 0.187534809f},
-std::array<float,2>{0.84491092f, 0.956477284f},
-std::array<float,2>{0.05878691f, 0.556253135f},
-std::array<float,2>{0.614810348f, 0.496190041f},
-std::array<float,2>{0.191733196f, 0.269320875f},
-std::array<float,2>{0.694857538f, 0.66159755f},
-std::array<float,2>{0.364326835f, 0.765753746f},
-std::array<float,2>{0.938029766f, 0.0898502991f},
-std::array<float,2>{0.113944463f, 0.0226305053f},
-std::array<float,2>{0.541793942f, 0.817300081f},
-std::array<float,2>{0.377500743f, 0.744167864f},
-std::array<float,2>{0.811190486f, 0.341220975f},
-std::array<float,2>{0.283719599f, 0.410081089f},
-std::array<float,2>{0.887482226f, 0.584223509f},
-std::array<float,2>{0.127987459f, 0.930000544f},
-std::array<float,2>{0.632115662f, 0.140417814f},
-std::array<float,2>{0.329153329f, 0.186480954f},
-std::array<float,2>{0.997191191f, 0.881113112f},
-std::array<float,2>{0.234506607f, 0.609983206f},
-std::array<float,2>{0.719900548f, 0.380079806f},
-std::array<float,2>{0.0312457904f, 0.344511092f},
-std::array<float,2>{0.563391626f, 0.69016546f},
-std::array<float,2>{0.443161994f, 0.859287381f},
-std::array<float,2>{0.823267758f, 0.0569171868f},
-std::array<float,2>{0.166454151f, 0.119919695f},
-std::array<float,2>{0.660960615f, 0.784783661f},
-std::array<float,2>{0.251603752f, 0.651163638f},
-std::array<float,2>{0.931601226f, 0.305189878f},
-std::array<float,2>{0.418336421f, 0.460895419f},
-std::array<float,2>{0.752141654f, 0.504819989f},
-std::array<float,2>{0.070524171f, 0.987694561f},
-std::array<float,2>{0.530880332f, 0.224131644f},
-std::array<float,2>{0.485610664f, 0.0254657436f},
-std::array<float,2>{0.864889205f, 0.820491672f},
-std::array<float,2>{0.0456740074f, 0.736407876f},
-std::array<float,2>{0.604086399f, 0.333487183f},
-std::array<float,2>{0.217323333f, 0.421102822f},
-std::array<float,2>{0.717312098f, 0.588077784f},
-std::array<float,2>{0.344221503f, 0.927675188f},
-std::array<float,2>{0.967137456f, 0.126397386f},
-std::array<float,2>{0.102175392f, 0.196460992f},
-std::array<float,2>{0.556943238f, 0.963883877f},
-std::array<float,2>{0.395783424f, 0.552066922f},
-std::array<float,2>{0.790228248f, 0.486232787f},
-std::array<float,2>{0.310568839f, 0.274992287f},
-std::array<float,2>{0.896040857f, 0.665578187f},
-std::array<float,2>{0.154998019f, 0.773952544f},
-std::array<float,2>{0.643218577f, 0.0818557218f},
-std::array<float,2>{0.267577976f, 0.0692624748f},
-std::array<float,2>{0.910425127f, 0.751141965f},
-std::array<float,2>{0.179960519f, 0.678622186f},
-std::array<float,2>{0.680020094f, 0.264223158f},
-std::array<float,2>{0.0905689746f, 0.478585929f},
-std::array<float,2>{0.515511572f, 0.544195473f},
-std::array<float,2>{0.427513599f, 0.941470444f},
-std::array<float,2>{0.780751288f, 0.212159067f},
-std::array<float,2>{0.223986059f, 0.150355443f},
-std::array<float,2>{0.749208272f, 0.911118329f},
-std::array<float,2>{0.32300058f, 0.573834062f},
-std::array<float,2>{0.973300099f, 0.431541204f},
-std::array<float,2>{0.453343123f, 0.327348202f},
-std::array<float,2>{0.83661741f, 0.727970004f},
-std::array<float,2>{0.00306885596f, 0.835202873f},
-std::array<float,2>{0.591587186f, 0.00283402787f},
-std::array<float,2>{0.380995959f, 0.234845564f},
-std::array<float,2>{0.805498183f, 0.96958524f},
-std::array<float,2>{0.112850584f, 0.517236471f},
-std::array<float,2>{0.544817805f, 0.442318082f},
-std::array<float,2>{0.131613076f, 0.290280789f},
-std::array<float,2>{0.626307487f, 0.633167565f},
-std::array<float,2>{0.288404316f, 0.80764401f},
-std::array<float,2>{0.885873616f, 0.100400157f},
-std::array<float,2>{0.0563425124f, 0.0339641832f},
-std::array<float,2>{0.61055088f, 0.86435622f},
-std::array<float,2>{0.481180489f, 0.70597285f},
-std::array<float,2>{0.849484265f, 0.373646438f},
-std::array<float,2>{0.359892249f, 0.401316136f},
-std::array<float,2>{0.944421947f, 0.602778077f},
-std::array<float,2>{0.189950868f, 0.89511621f},
-std::array<float,2>{0.688704967f, 0.156604767f},
-std::array<float,2>{0.296842486f, 0.203946173f},
-std::array<float,2>{0.88078481f, 0.952790856f},
-std::array<float,2>{0.137486964f, 0.531927228f},
-std::array<float,2>{0.633266687f, 0.474058688f},
-std::array<float,2>{0.123031832f, 0.25078997f},
-std::array<float,2>{0.535651445f, 0.680047095f},
-std::array<float,2>{0.390053272f, 0.761883199f},
-std::array<float,2>{0.800008535f, 0.0732463822f},
-std::array<float,2>{0.196730316f, 0.0123425508f},
-std::array<float,2>{0.695608258f, 0.840990543f},
-std::array<float,2>{0.373645812f, 0.723437309f},
-std::array<float,2>{0.951974154f, 0.314632535f},
-std::array<float,2>{0.47032848f, 0.424730569f},
-std::array<float,2>{0.854910135f, 0.562674224f},
-std::array<float,2>{0.0526024476f, 0.918540061f},
-std::array<float,2>{0.623843491f, 0.141682878f},
-std::array<float,2>{0.43215549f, 0.109086208f},
-std::array<float,2>{0.772286654f, 0.80058676f},
-std::array<float,2>{0.0810019374f, 0.628949821f},
-std::array<float,2>{0.500580907f, 0.284432739f},
-std::array<float,2>{0.174164817f, 0.445954472f},
-std::array<float,2>{0.677917957f, 0.529152989f},
-std::array<float,2>{0.277570754f, 0.977774918f},
-std::array<float,2>{0.920216918f, 0.24542217f},
-std::array<float,2>{0.0101509821f, 0.170425102f},
-std::array<float,2>{0.578427434f, 0.905297875f},
-std::array<float,2>{0.464924544f, 0.596146822f},
-std::array<float,2>{0.833200932f, 0.390645325f},
-std::array<float,2>{0.3170228f, 0.364201784f},
-std::array<float,2>{0.978448331f, 0.713489771f},
-std::array<float,2>{0.23314169f, 0.867352784f},
-std::array<float,2>{0.735326469f, 0.0465763062f},
-std::array<float,2>{0.351993024f, 0.0540542305f},
-std::array<float,2>{0.957940638f, 0.847921908f},
-std::array<float,2>{0.21045576f, 0.700984716f},
-std::array<float,2>{0.706237555f, 0.354783326f},
-std::array<float,2>{0.0356547795f, 0.384495944f},
-std::array<float,2>{0.599416375f, 0.624373019f},
-std::array<float,2>{0.499024451f, 0.890205622f},
-std::array<float,2>{0.874063015f, 0.174215674f},
-std::array<float,2>{0.143031999f, 0.229486927f},
-std::array<float,2>{0.655183017f, 0.993282259f},
-std::array<float,2>{0.304606527f, 0.513501883f},
-std::array<float,2>{0.905399263f, 0.466144145f},
-std::array<float,2>{0.405198872f, 0.304520279f},
-std::array<float,2>{0.786921322f, 0.642456234f},
-std::array<float,2>{0.100389563f, 0.793702006f},
-std::array<float,2>{0.550278783f, 0.110713951f},
-std::array<float,2>{0.447920978f, 0.134483352f},
-std::array<float,2>{0.813610792f, 0.933894098f},
-std::array<float,2>{0.0183434505f, 0.578303158f},
-std::array<float,2>{0.574978709f, 0.413122416f},
-std::array<float,2>{0.243481234f, 0.338539273f},
-std::array<float,2>{0.729354322f, 0.746852756f},
-std::array<float,2>{0.342453301f, 0.815668344f},
-std::array<float,2>{0.991225243f, 0.015711844f},
-std::array<float,2>{0.0665315613f, 0.08687976f},
-std::array<float,2>{0.52264756f, 0.772730231f},
-std::array<float,2>{0.409292698f, 0.658137083f},
-std::array<float,2>{0.765182674f, 0.271476448f},
-std::array<float,2>{0.257847786f, 0.495370179f},
-std::array<float,2>{0.921947539f, 0.559166312f},
-std::array<float,2>{0.163544416f, 0.957959056f},
-std::array<float,2>{0.671159565f, 0.193240583f},
-std::array<float,2>{0.34484297f, 0.198332742f},
-std::array<float,2>{0.968556523f, 0.961800873f},
-std::array<float,2>{0.21829316f, 0.553806663f},
-std::array<float,2>{0.718538761f, 0.486841559f},
-std::array<float,2>{0.0466676429f, 0.276354522f},
-std::array<float,2>{0.604570985f, 0.667891622f},
-std::array<float,2>{0.485055923f, 0.775989652f},
-std::array<float,2>{0.864055991f, 0.0789864808f},
-std::array<float,2>{0.155657709f, 0.0240650084f},
-std::array<float,2>{0.644102931f, 0.822802305f},
-std::array<float,2>{0.31156981f, 0.735269904f},
-std::array<float,2>{0.894901216f, 0.335337311f},
-std::array<float,2>{0.394806772f, 0.418963522f},
-std::array<float,2>{0.789668143f, 0.586544394f},
-std::array<float,2>{0.103053331f, 0.928047836f},
-std::array<float,2>{0.557944834f, 0.128662407f},
-std::array<float,2>{0.442144006f, 0.118087724f},
-std::array<float,2>{0.823023021f, 0.782633364f},
-std::array<float,2>{0.0299717709f, 0.650007069f},
-std::array<float,2>{0.56382376f, 0.306644052f},
-std::array<float,2>{0.235416695f, 0.458181649f},
-std::array<float,2>{0.719394624f, 0.507692218f},
-std::array<float,2>{0.328594327f, 0.985746264f},
-std::array<float,2>{0.996669769f, 0.22585091f},
-std::array<float,2>{0.0717485547f, 0.184919015f},
-std::array<float,2>{0.530018151f, 0.880122721f},
-std::array<float,2>{0.419515699f, 0.612465084f},
-std::array<float,2>{0.753423333f, 0.382325679f},
-std::array<float,2>{0.250707597f, 0.347223699f},
-std::array<float,2>{0.9299106f, 0.68763721f},
-std::array<float,2>{0.167007193f, 0.857264221f},
-std::array<float,2>{0.661177814f, 0.0557238013f},
-std::array<float,2>{0.287669152f, 0.031876307f},
-std::array<float,2>{0.885048747f, 0.867152989f},
-std::array<float,2>{0.132207438f, 0.703299761f},
-std::array<float,2>{0.625073552f, 0.371343493f},
-std::array<float,2>{0.111931875f, 0.400346518f},
-std::array<float,2>{0.543404341f, 0.60532546f},
-std::array<float,2>{0.382026255f, 0.897609293f},
-std::array<float,2>{0.806059361f, 0.159645557f},
-std::array<float,2>{0.191314906f, 0.237186491f},
-std::array<float,2>{0.687766671f, 0.972346723f},
-std::array<float,2>{0.361097872f, 0.518550515f},
-std::array<float,2>{0.943730533f, 0.444084734f},
-std::array<float,2>{0.482389271f, 0.291613638f},
-std::array<float,2>{0.847726822f, 0.635684907f},
-std::array<float,2>{0.0548491776f, 0.80549711f},
-std::array<float,2>{0.610314786f, 0.0986580476f},
-std::array<float,2>{0.426535398f, 0.151416585f},
-std::array<float,2>{0.779757917f, 0.913805664f},
-std::array<float,2>{0.0910406709f, 0.570422947f},
-std::array<float,2>{0.51371032f, 0.432856739f},
-std::array<float,2>{0.181603432f, 0.325628281f},
-std::array<float,2>{0.680967271f, 0.729578972f},
-std::array<float,2>{0.266098201f, 0.832186759f},
-std::array<float,2>{0.911385059f, 3.47454329e-06f},
-std::array<float,2>{0.00281831017f, 0.0680053681f},
-std::array<float,2>{0.590520263f, 0.752208531f},
-std::array<float,2>{0.454191148f, 0.676292121f},
-std::array<float,2>{0.837759972f, 0.263161391f},
-std::array<float,2>{0.323685765f, 0.476716489f},
-std::array<float,2>{0.974057257f, 0.545576692f},
-std::array<float,2>{0.223091364f, 0.943789721f},
-std::array<float,2>{0.748160422f, 0.21348989f},
-std::array<float,2>{0.278847933f, 0.168814823f},
-std::array<float,2>{0.921356976f, 0.904191315f},
-std::array<float,2>{0.175116003f, 0.594726801f},
-std::array<float,2>{0.67948699f, 0.393137097f},
-std::array<float,2>{0.081754677f, 0.366465896f},
-std::array<float,2>{0.501344562f, 0.712018549f},
-std::array<float,2>{0.432620555f, 0.869568825f},
-std::array<float,2>{0.772528589f, 0.043922998f},
-std::array<float,2>{0.23386021f, 0.107321911f},
-std::array<float,2>{0.735454261f, 0.796938777f},
-std::array<float,2>{0.317579091f, 0.631236553f},
-std::array<float,2>{0.976849079f, 0.282942116f},
-std::array<float,2>{0.466043949f, 0.448384762f},
-std::array<float,2>{0.832333207f, 0.531078219f},
-std::array<float,2>{0.0107836062f, 0.978892982f},
-std::array<float,2>{0.579455554f, 0.242966801f},
-std::array<float,2>{0.389118224f, 0.0156233935f},
-std::array<float,2>{0.799469829f, 0.8423931f},
-std::array<float,2>{0.12205755f, 0.724901557f},
-std::array<float,2>{0.537000835f, 0.312608421f},
-std::array<float,2>{0.137961864f, 0.422118902f},
-std::array<float,2>{0.633879066f, 0.565447271f},
-std::array<float,2>{0.29572317f, 0.921266377f},
-std::array<float,2>{0.879593372f, 0.144012347f},
-std::array<float,2>{0.0516917668f, 0.206064522f},
-std::array<float,2>{0.624925494f, 0.95037812f},
-std::array<float,2>{0.469025195f, 0.533837438f},
-std::array<float,2>{0.854463995f, 0.47621721f},
-std::array<float,2>{0.374950498f, 0.252253175f},
-std::array<float,2>{0.952721357f, 0.682643592f},
-std::array<float,2>{0.195857912f, 0.76393342f},
-std::array<float,2>{0.69703418f, 0.0718494505f},
-std::array<float,2>{0.343571484f, 0.088440448f},
-std::array<float,2>{0.990261853f, 0.770594001f},
-std::array<float,2>{0.242627725f, 0.658607721f},
-std::array<float,2>{0.729952037f, 0.272951812f},
-std::array<float,2>{0.0190403387f, 0.492836773f},
-std::array<float,2>{0.575987935f, 0.561307907f},
-std::array<float,2>{0.44890812f, 0.959989727f},
-std::array<float,2>{0.812666297f, 0.19485411f},
-std::array<float,2>{0.162195429f, 0.136687294f},
-std::array<float,2>{0.670186579f, 0.936692774f},
-std::array<float,2>{0.259516329f, 0.580985606f},
-std::array<float,2>{0.923411727f, 0.410202205f},
-std::array<float,2>{0.40889141f, 0.337746024f},
-std::array<float,2>{0.764223695f, 0.748185396f},
-std::array<float,2>{0.067476362f, 0.813024402f},
-std::array<float,2>{0.521817207f, 0.0176186599f},
-std::array<float,2>{0.498256296f, 0.226645783f},
-std::array<float,2>{0.873864353f, 0.994380772f},
-std::array<float,2>{0.0366699807f, 0.514530957f},
-std::array<float,2>{0.598344922f, 0.468407243f},
-std::array<float,2>{0.209414706f, 0.301424414f},
-std::array<float,2>{0.706024349f, 0.644375443f},
-std::array<float,2>{0.352642536f, 0.796037495f},
-std::array<float,2>{0.958422005f, 0.111651391f},
-std::array<float,2>{0.101141669f, 0.051394552f},
-std::array<float,2>{0.549636364f, 0.849867165f},
-std::array<float,2>{0.405405611f, 0.702809989f},
-std::array<float,2>{0.785856426f, 0.351766437f},
-std::array<float,2>{0.303649813f, 0.385648042f},
-std::array<float,2>{0.904442549f, 0.622635841f},
-std::array<float,2>{0.144100159f, 0.888210773f},
-std::array<float,2>{0.655411661f, 0.172715753f},
-std::array<float,2>{0.313140661f, 0.131370738f},
-std::array<float,2>{0.98257947f, 0.925468862f},
-std::array<float,2>{0.226890936f, 0.592888534f},
-std::array<float,2>{0.740775645f, 0.416399091f},
-std::array<float,2>{0.0117886849f, 0.329461277f},
-std::array<float,2>{0.585385382f, 0.739695132f},
-std::array<float,2>{0.461921155f, 0.826349556f},
-std::array<float,2>{0.831223428f, 0.0288956296f},
-std::array<float,2>{0.176637486f, 0.0853446126f},
-std::array<float,2>{0.674333274f, 0.780535221f},
-std::array<float,2>{0.277328104f, 0.670544088f},
-std::array<float,2>{0.91551739f, 0.278674126f},
-std::array<float,2>{0.436436296f, 0.489859045f},
-std::array<float,2>{0.767556071f, 0.54997611f},
-std::array<float,2>{0.0853962973f, 0.967770398f},
-std::array<float,2>{0.504937887f, 0.200251207f},
-std::array<float,2>{0.474824846f, 0.0613526627f},
-std::array<float,2>{0.858032525f, 0.851952434f},
-std::array<float,2>{0.0490149558f, 0.694444418f},
-std::array<float,2>{0.619376004f, 0.347849309f},
-std::array<float,2>{0.200631902f, 0.375293791f},
-std::array<float,2>{0.70089829f, 0.614827573f},
-std::array<float,2>{0.369792968f, 0.87535578f},
-std::array<float,2>{0.945363402f, 0.182965115f},
-std::array<float,2>{0.119216345f, 0.218977571f},
-std::array<float,2>{0.532390296f, 0.991055846f},
-std::array<float,2>{0.384874552f, 0.501387358f},
-std::array<float,2>{0.803581774f, 0.453531742f},
-std::array<float,2>{0.290639877f, 0.311211348f},
-std::array<float,2>{0.876685739f, 0.652655542f},
-std::array<float,2>{0.136298254f, 0.787403882f},
-std::array<float,2>{0.638044655f, 0.124147162f},
-std::array<float,2>{0.265082508f, 0.0947881266f},
-std::array<float,2>{0.928961575f, 0.81039232f},
-std::array<float,2>{0.157450303f, 0.63957262f},
-std::array<float,2>{0.665935338f, 0.294796467f},
-std::array<float,2>{0.0639860779f, 0.440312684f},
-std::array<float,2>{0.519503415f, 0.522167265f},
-std::array<float,2>{0.413144737f, 0.972779155f},
-std::array<float,2>{0.758780241f, 0.240651205f},
-std::array<float,2>{0.247124225f, 0.160488665f},
-std::array<float,2>{0.73092109f, 0.890991151f},
-std::array<float,2>{0.337367356f, 0.608416975f},
-std::array<float,2>{0.984890938f, 0.40472886f},
-std::array<float,2>{0.451445609f, 0.369122624f},
-std::array<float,2>{0.818523586f, 0.710493028f},
-std::array<float,2>{0.0203978792f, 0.85983932f},
-std::array<float,2>{0.571525991f, 0.0386162437f},
-std::array<float,2>{0.400383562f, 0.215340003f},
-std::array<float,2>{0.781799197f, 0.941371679f},
-std::array<float,2>{0.0951440185f, 0.541373134f},
-std::array<float,2>{0.550876021f, 0.481935501f},
-std::array<float,2>{0.147851348f, 0.259223789f},
-std::array<float,2>{0.651344776f, 0.672386706f},
-std::array<float,2>{0.298714042f, 0.756895602f},
-std::array<float,2>{0.899799705f, 0.0663799644f},
-std::array<float,2>{0.0344291143f, 0.00761316856f},
-std::array<float,2>{0.594610453f, 0.831701338f},
-std::array<float,2>{0.494276971f, 0.733985245f},
-std::array<float,2>{0.868155301f, 0.322862864f},
-std::array<float,2>{0.358352333f, 0.434837908f},
-std::array<float,2>{0.953161895f, 0.575376689f},
-std::array<float,2>{0.205387428f, 0.906956434f},
-std::array<float,2>{0.71038723f, 0.154032424f},
-std::array<float,2>{0.307488561f, 0.249489188f},
-std::array<float,2>{0.890767753f, 0.981833935f},
-std::array<float,2>{0.151793182f, 0.526525676f},
-std::array<float,2>{0.645920396f, 0.451877356f},
-std::array<float,2>{0.108749464f, 0.287001491f},
-std::array<float,2>{0.558868885f, 0.625567019f},
-std::array<float,2>{0.392253458f, 0.804450691f},
-std::array<float,2>{0.794365644f, 0.105302192f},
-std::array<float,2>{0.212148905f, 0.039077647f},
-std::array<float,2>{0.714510918f, 0.874841809f},
-std::array<float,2>{0.3512128f, 0.715514421f},
-std::array<float,2>{0.961816728f, 0.36082378f},
-std::array<float,2>{0.491944045f, 0.396873921f},
-std::array<float,2>{0.86084497f, 0.60106504f},
-std::array<float,2>{0.0419547334f, 0.899890125f},
-std::array<float,2>{0.609261453f, 0.167000264f},
-std::array<float,2>{0.415265918f, 0.0747316405f},
-std::array<float,2>{0.756744742f, 0.759985447f},
-std::array<float,2>{0.0770201012f, 0.687229753f},
-std::array<float,2>{0.524728f, 0.256733626f},
-std::array<float,2>{0.168135568f, 0.471806645f},
-std::array<float,2>{0.659856021f, 0.535888493f},
-std::array<float,2>{0.254751712f, 0.945393205f},
-std::array<float,2>{0.935737193f, 0.209318534f},
-std::array<float,2>{0.023868883f, 0.146947294f},
-std::array<float,2>{0.570210636f, 0.914994657f},
-std::array<float,2>{0.44102174f, 0.56907624f},
-std::array<float,2>{0.827714443f, 0.429625481f},
-std::array<float,2>{0.332135588f, 0.319773614f},
-std::array<float,2>{0.994706154f, 0.721699536f},
-std::array<float,2>{0.240532562f, 0.836980879f},
-std::array<float,2>{0.725691736f, 0.00835719425f},
-std::array<float,2>{0.363634437f, 0.0195763465f},
-std::array<float,2>{0.938678801f, 0.819156349f},
-std::array<float,2>{0.192915618f, 0.742218435f},
-std::array<float,2>{0.693457186f, 0.341853499f},
-std::array<float,2>{0.060175579f, 0.407893807f},
-std::array<float,2>{0.613292158f, 0.583193362f},
-std::array<float,2>{0.479623049f, 0.932190835f},
-std::array<float,2>{0.844112277f, 0.138435066f},
-std::array<float,2>{0.127341121f, 0.190577149f},
-std::array<float,2>{0.631329f, 0.953537285f},
-std::array<float,2>{0.284659445f, 0.557900548f},
-std::array<float,2>{0.888623059f, 0.499147862f},
-std::array<float,2>{0.378481925f, 0.265687764f},
-std::array<float,2>{0.811793029f, 0.662304223f},
-std::array<float,2>{0.11427635f, 0.768690348f},
-std::array<float,2>{0.542782605f, 0.0924593955f},
-std::array<float,2>{0.460810274f, 0.177109733f},
-std::array<float,2>{0.843549848f, 0.883089006f},
-std::array<float,2>{0.00584286731f, 0.620512605f},
-std::array<float,2>{0.587972939f, 0.387389839f},
-std::array<float,2>{0.221088827f, 0.35624066f},
-std::array<float,2>{0.744061589f, 0.698441803f},
-std::array<float,2>{0.327618629f, 0.845003963f},
-std::array<float,2>{0.970320463f, 0.0470033661f},
-std::array<float,2>{0.0866040289f, 0.11538855f},
-std::array<float,2>{0.509423256f, 0.791151583f},
-std::array<float,2>{0.424489945f, 0.645880997f},
-std::array<float,2>{0.773529172f, 0.300646693f},
-std::array<float,2>{0.269782811f, 0.462998569f},
-std::array<float,2>{0.908400416f, 0.511247277f},
-std::array<float,2>{0.186762407f, 0.999316514f},
-std::array<float,2>{0.686884344f, 0.231969014f},
-std::array<float,2>{0.330539137f, 0.224438041f},
-std::array<float,2>{0.998649776f, 0.987357438f},
-std::array<float,2>{0.236411616f, 0.504544914f},
-std::array<float,2>{0.722649097f, 0.460458994f},
-std::array<float,2>{0.0285038576f, 0.305541128f},
-std::array<float,2>{0.566283762f, 0.650936842f},
-std::array<float,2>{0.443643093f, 0.785016775f},
-std::array<float,2>{0.822156727f, 0.119706407f},
-std::array<float,2>{0.165758833f, 0.056740582f},
-std::array<float,2>{0.663896263f, 0.858950019f},
-std::array<float,2>{0.252156377f, 0.690329552f},
-std::array<float,2>{0.931711972f, 0.344276398f},
-std::array<float,2>{0.420613974f, 0.380162835f},
-std::array<float,2>{0.75002104f, 0.610314071f},
-std::array<float,2>{0.0732576773f, 0.88095361f},
-std::array<float,2>{0.527669787f, 0.186243996f},
-std::array<float,2>{0.488219172f, 0.081615068f},
-std::array<float,2>{0.865299582f, 0.774371862f},
-std::array<float,2>{0.0448363572f, 0.665920019f},
-std::array<float,2>{0.602622092f, 0.27520892f},
-std::array<float,2>{0.214975893f, 0.485914081f},
-std::array<float,2>{0.716534555f, 0.551836073f},
-std::array<float,2>{0.346198291f, 0.964313209f},
-std::array<float,2>{0.965294182f, 0.196777239f},
-std::array<float,2>{0.103634678f, 0.126027122f},
-std::array<float,2>{0.556406081f, 0.927249372f},
-std::array<float,2>{0.397939146f, 0.588279665f},
-std::array<float,2>{0.792856395f, 0.421352893f},
-std::array<float,2>{0.309504956f, 0.333140552f},
-std::array<float,2>{0.89790231f, 0.736633599f},
-std::array<float,2>{0.153766751f, 0.820769012f},
-std::array<float,2>{0.64222151f, 0.0258283578f},
-std::array<float,2>{0.269167453f, 0.00254800473f},
-std::array<float,2>{0.913083673f, 0.835297585f},
-std::array<float,2>{0.1825037f, 0.727590382f},
-std::array<float,2>{0.682793856f, 0.327493668f},
-std::array<float,2>{0.0935846716f, 0.431153536f},
-std::array<float,2>{0.512016773f, 0.574165285f},
-std::array<float,2>{0.428988099f, 0.910746872f},
-std::array<float,2>{0.777387381f, 0.150084257f},
-std::array<float,2>{0.225172997f, 0.212055206f},
-std::array<float,2>{0.746552944f, 0.941851676f},
-std::array<float,2>{0.320439726f, 0.544112921f},
-std::array<float,2>{0.975114048f, 0.47878629f},
-std::array<float,2>{0.455204368f, 0.264414042f},
-std::array<float,2>{0.838601887f, 0.678370595f},
-std::array<float,2>{0.00153039664f, 0.751292765f},
-std::array<float,2>{0.592193246f, 0.0688899308f},
-std::array<float,2>{0.380657285f, 0.156377986f},
-std::array<float,2>{0.808134496f, 0.895490527f},
-std::array<float,2>{0.109763131f, 0.602864921f},
-std::array<float,2>{0.546764731f, 0.400986999f},
-std::array<float,2>{0.130242929f, 0.373928726f},
-std::array<float,2>{0.627475739f, 0.705596685f},
-std::array<float,2>{0.287071586f, 0.864599586f},
-std::array<float,2>{0.884182632f, 0.0339047052f},
-std::array<float,2>{0.057353083f, 0.100132897f},
-std::array<float,2>{0.613261282f, 0.807998836f},
-std::array<float,2>{0.483534485f, 0.633050203f},
-std::array<float,2>{0.850006461f, 0.290373534f},
-std::array<float,2>{0.361442387f, 0.442136556f},
-std::array<float,2>{0.94178021f, 0.517373025f},
-std::array<float,2>{0.18872948f, 0.969398379f},
-std::array<float,2>{0.690263748f, 0.234444693f},
-std::array<float,2>{0.294332534f, 0.142051458f},
-std::array<float,2>{0.881829798f, 0.918865561f},
-std::array<float,2>{0.139657483f, 0.5628407f},
-std::array<float,2>{0.635510266f, 0.42451337f},
-std::array<float,2>{0.124944426f, 0.31480521f},
-std::array<float,2>{0.53713125f, 0.723332882f},
-std::array<float,2>{0.387241393f, 0.841137052f},
-std::array<float,2>{0.798661947f, 0.0125454869f},
-std::array<float,2>{0.1990145f, 0.0737248808f},
-std::array<float,2>{0.69804424f, 0.762165308f},
-std::array<float,2>{0.37203005f, 0.679713726f},
-std::array<float,2>{0.950256765f, 0.25072214f},
-std::array<float,2>{0.47140947f, 0.473677754f},
-std::array<float,2>{0.853505313f, 0.532056987f},
-std::array<float,2>{0.0528811179f, 0.95308435f},
-std::array<float,2>{0.622496128f, 0.203739196f},
-std::array<float,2>{0.429951161f, 0.0467524976f},
-std::array<float,2>{0.76986748f, 0.867626846f},
-std::array<float,2>{0.0800090134f, 0.71369338f},
-std::array<float,2>{0.502987564f, 0.363979131f},
-std::array<float,2>{0.172570199f, 0.390997857f},
-std::array<float,2>{0.676904261f, 0.59588474f},
-std::array<float,2>{0.280513853f, 0.905664802f},
-std::array<float,2>{0.919231653f, 0.17075634f},
-std::array<float,2>{0.00925883558f, 0.245261237f},
-std::array<float,2>{0.580277324f, 0.977808714f},
-std::array<float,2>{0.46691972f, 0.528882861f},
-std::array<float,2>{0.834122539f, 0.446271867f},
-std::array<float,2>{0.31852141f, 0.284306914f},
-std::array<float,2>{0.980358422f, 0.629349768f},
-std::array<float,2>{0.232275918f, 0.800446868f},
-std::array<float,2>{0.736515701f, 0.109289125f},
-std::array<float,2>{0.354713827f, 0.110532567f},
-std::array<float,2>{0.96015054f, 0.793557286f},
-std::array<float,2>{0.208661199f, 0.642111301f},
-std::array<float,2>{0.704639018f, 0.304255903f},
-std::array<float,2>{0.0377984084f, 0.465875566f},
-std::array<float,2>{0.600022197f, 0.513221979f},
-std::array<float,2>{0.497226417f, 0.993623078f},
-std::array<float,2>{0.871744871f, 0.229055196f},
-std::array<float,2>{0.141234696f, 0.174054891f},
-std::array<float,2>{0.653015196f, 0.890585303f},
-std::array<float,2>{0.302389741f, 0.624151826f},
-std::array<float,2>{0.902818322f, 0.384546638f},
-std::array<float,2>{0.404147893f, 0.354621619f},
-std::array<float,2>{0.787379503f, 0.700750172f},
-std::array<float,2>{0.0991670489f, 0.847818732f},
-std::array<float,2>{0.548090339f, 0.0539303273f},
-std::array<float,2>{0.445414007f, 0.19304584f},
-std::array<float,2>{0.815754354f, 0.95763427f},
-std::array<float,2>{0.0159106888f, 0.55949229f},
-std::array<float,2>{0.577520251f, 0.495336264f},
-std::array<float,2>{0.245953918f, 0.271067768f},
-std::array<float,2>{0.726955533f, 0.657856464f},
-std::array<float,2>{0.341454655f, 0.772619188f},
-std::array<float,2>{0.989869595f, 0.0864796713f},
-std::array<float,2>{0.0696135387f, 0.0159673188f},
-std::array<float,2>{0.520470977f, 0.81581986f},
-std::array<float,2>{0.407226384f, 0.746816516f},
-std::array<float,2>{0.76326108f, 0.338857114f},
-std::array<float,2>{0.261131048f, 0.41354847f},
-std::array<float,2>{0.924224436f, 0.578573346f},
-std::array<float,2>{0.160457864f, 0.933642328f},
-std::array<float,2>{0.667975903f, 0.134617269f},
-std::array<float,2>{0.368474513f, 0.181064978f},
-std::array<float,2>{0.947586596f, 0.877693594f},
-std::array<float,2>{0.202912331f, 0.616444588f},
-std::array<float,2>{0.701367497f, 0.378741682f},
-std::array<float,2>{0.048308555f, 0.351395011f},
-std::array<float,2>{0.618759036f, 0.692195714f},
-std::array<float,2>{0.473611206f, 0.854557931f},
-std::array<float,2>{0.856357455f, 0.058878243f},
-std::array<float,2>{0.134008378f, 0.122753903f},
-std::array<float,2>{0.638700664f, 0.786754012f},
-std::array<float,2>{0.291720003f, 0.655553639f},
-std::array<float,2>{0.878126562f, 0.309956431f},
-std::array<float,2>{0.384425551f, 0.455975235f},
-std::array<float,2>{0.80122751f, 0.502931416f},
-std::array<float,2>{0.117466755f, 0.990087628f},
-std::array<float,2>{0.533607423f, 0.221050993f},
-std::array<float,2>{0.464613974f, 0.0302852653f},
-std::array<float,2>{0.828673482f, 0.824780047f},
-std::array<float,2>{0.0140259564f, 0.740793049f},
-std::array<float,2>{0.58257556f, 0.331850529f},
-std::array<float,2>{0.229651868f, 0.415970385f},
-std::array<float,2>{0.738628209f, 0.590243101f},
-std::array<float,2>{0.315309852f, 0.922945976f},
-std::array<float,2>{0.981339157f, 0.130026877f},
-std::array<float,2>{0.0821530074f, 0.201204151f},
-std::array<float,2>{0.506886065f, 0.965380371f},
-std::array<float,2>{0.43517068f, 0.548635304f},
-std::array<float,2>{0.769123554f, 0.49212867f},
-std::array<float,2>{0.274155378f, 0.281198025f},
-std::array<float,2>{0.917724073f, 0.668502212f},
-std::array<float,2>{0.178121924f, 0.779192328f},
-std::array<float,2>{0.672842205f, 0.0838563144f},
-std::array<float,2>{0.300062418f, 0.0635984689f},
-std::array<float,2>{0.901793778f, 0.754768372f},
-std::array<float,2>{0.144690886f, 0.673959494f},
-std::array<float,2>{0.649943054f, 0.261607111f},
-std::array<float,2>{0.0970863327f, 0.483223051f},
-std::array<float,2>{0.55355376f, 0.539617598f},
-std::array<float,2>{0.401380777f, 0.937722743f},
-std::array<float,2>{0.784005225f, 0.218206927f},
-std::array<float,2>{0.20370248f, 0.155541852f},
-std::array<float,2>{0.70740205f, 0.909279466f},
-std::array<float,2>{0.35727793f, 0.576566339f},
-std::array<float,2>{0.955789506f, 0.437158525f},
-std::array<float,2>{0.492739707f, 0.321489513f},
-std::array<float,2>{0.869292974f, 0.732318103f},
-std::array<float,2>{0.0314583182f, 0.829219162f},
-std::array<float,2>{0.597517312f, 0.00480125798f},
-std::array<float,2>{0.411916733f, 0.240035057f},
-std::array<float,2>{0.760646284f, 0.975361109f},
-std::array<float,2>{0.0657015741f, 0.52031827f},
-std::array<float,2>{0.515893459f, 0.438512236f},
-std::array<float,2>{0.159547716f, 0.294930279f},
-std::array<float,2>{0.667599022f, 0.63836205f},
-std::array<float,2>{0.263560325f, 0.811790109f},
-std::array<float,2>{0.926152468f, 0.0963124707f},
-std::array<float,2>{0.0214987881f, 0.0361616388f},
-std::array<float,2>{0.573326647f, 0.863143861f},
-std::array<float,2>{0.450076997f, 0.707062006f},
-std::array<float,2>{0.817145824f, 0.371089101f},
-std::array<float,2>{0.338650823f, 0.403653711f},
-std::array<float,2>{0.98768121f, 0.605616212f},
-std::array<float,2>{0.249719366f, 0.893692076f},
-std::array<float,2>{0.732762456f, 0.163698122f},
-std::array<float,2>{0.257066339f, 0.20756878f},
-std::array<float,2>{0.934744239f, 0.948230445f},
-std::array<float,2>{0.1708574f, 0.538143218f},
-std::array<float,2>{0.65680331f, 0.470471263f},
-std::array<float,2>{0.0751962885f, 0.255195737f},
-std::array<float,2>{0.526199043f, 0.683933258f},
-std::array<float,2>{0.417654157f, 0.758031905f},
-std::array<float,2>{0.754006922f, 0.0780875236f},
-std::array<float,2>{0.2396456f, 0.0106448215f},
-std::array<float,2>{0.724298239f, 0.838431954f},
-std::array<float,2>{0.33464992f, 0.720284581f},
-std::array<float,2>{0.992900968f, 0.317023873f},
-std::array<float,2>{0.437787473f, 0.42725575f},
-std::array<float,2>{0.825062931f, 0.568260849f},
-std::array<float,2>{0.0260821171f, 0.917069852f},
-std::array<float,2>{0.568151236f, 0.145438567f},
-std::array<float,2>{0.392996728f, 0.102305099f},
-std::array<float,2>{0.79530251f, 0.802552342f},
-std::array<float,2>{0.106731936f, 0.627782643f},
-std::array<float,2>{0.562328041f, 0.288167894f},
-std::array<float,2>{0.148514822f, 0.450796872f},
-std::array<float,2>{0.648377836f, 0.524747729f},
-std::array<float,2>{0.30561766f, 0.982509017f},
-std::array<float,2>{0.893989861f, 0.247596741f},
-std::array<float,2>{0.0397322364f, 0.164560109f},
-std::array<float,2>{0.606223643f, 0.90093112f},
-std::array<float,2>{0.489052653f, 0.598927677f},
-std::array<float,2>{0.861809909f, 0.395821095f},
-std::array<float,2>{0.349032164f, 0.362943172f},
-std::array<float,2>{0.964163721f, 0.717572927f},
-std::array<float,2>{0.214688852f, 0.872020543f},
-std::array<float,2>{0.712477446f, 0.041323524f},
-std::array<float,2>{0.324800789f, 0.0506099761f},
-std::array<float,2>{0.9709481f, 0.846127748f},
-std::array<float,2>{0.218787536f, 0.696623147f},
-std::array<float,2>{0.744153798f, 0.359071285f},
-std::array<float,2>{0.00768563617f, 0.389591247f},
-std::array<float,2>{0.58694762f, 0.618729472f},
-std::array<float,2>{0.45769453f, 0.885548294f},
-std::array<float,2>{0.841144204f, 0.17778337f},
-std::array<float,2>{0.185126901f, 0.232616454f},
-std::array<float,2>{0.684801996f, 0.997733772f},
-std::array<float,2>{0.273190916f, 0.509160221f},
-std::array<float,2>{0.906467736f, 0.461001992f},
-std::array<float,2>{0.423189104f, 0.296997607f},
-std::array<float,2>{0.777184129f, 0.647619307f},
-std::array<float,2>{0.0889585689f, 0.789918005f},
-std::array<float,2>{0.510787845f, 0.114255264f},
-std::array<float,2>{0.478384167f, 0.140306562f},
-std::array<float,2>{0.845919788f, 0.929689825f},
-std::array<float,2>{0.0616712458f, 0.584253907f},
-std::array<float,2>{0.615847349f, 0.409860075f},
-std::array<float,2>{0.19482328f, 0.340895414f},
-std::array<float,2>{0.693285882f, 0.744425952f},
-std::array<float,2>{0.367100805f, 0.817134023f},
-std::array<float,2>{0.941334248f, 0.0227533523f},
-std::array<float,2>{0.115350008f, 0.0901347175f},
-std::array<float,2>{0.540656209f, 0.765992582f},
-std::array<float,2>{0.375434577f, 0.661262035f},
-std::array<float,2>{0.810138047f, 0.269258559f},
-std::array<float,2>{0.281963468f, 0.496362537f},
-std::array<float,2>{0.889420927f, 0.556451738f},
-std::array<float,2>{0.125014395f, 0.956284463f},
-std::array<float,2>{0.630309045f, 0.187951997f},
-std::array<float,2>{0.322014481f, 0.214396983f},
-std::array<float,2>{0.975687504f, 0.944656491f},
-std::array<float,2>{0.225598395f, 0.546138585f},
-std::array<float,2>{0.747272491f, 0.477991641f},
-std::array<float,2>{0.000328633614f, 0.261737406f},
-std::array<float,2>{0.593577385f, 0.676870644f},
-std::array<float,2>{0.456946701f, 0.753357828f},
-std::array<float,2>{0.839504182f, 0.0668014064f},
-std::array<float,2>{0.182629928f, 0.00110857387f},
-std::array<float,2>{0.681707919f, 0.833694577f},
-std::array<float,2>{0.268241465f, 0.728711426f},
-std::array<float,2>{0.914008379f, 0.324305773f},
-std::array<float,2>{0.427774668f, 0.431994706f},
-std::array<float,2>{0.778761148f, 0.57170856f},
-std::array<float,2>{0.0927401409f, 0.912637472f},
-std::array<float,2>{0.513009191f, 0.150511786f},
-std::array<float,2>{0.48267138f, 0.0981133282f},
-std::array<float,2>{0.850849271f, 0.806638598f},
-std::array<float,2>{0.0577981472f, 0.636446178f},
-std::array<float,2>{0.612264097f, 0.292844981f},
-std::array<float,2>{0.187912077f, 0.444601655f},
-std::array<float,2>{0.691237509f, 0.51906234f},
-std::array<float,2>{0.362820655f, 0.971462488f},
-std::array<float,2>{0.943215013f, 0.238078758f},
-std::array<float,2>{0.110576414f, 0.158428714f},
-std::array<float,2>{0.544943988f, 0.897105873f},
-std::array<float,2>{0.378968894f, 0.603549361f},
-std::array<float,2>{0.806663334f, 0.398932129f},
-std::array<float,2>{0.285414189f, 0.372707784f},
-std::array<float,2>{0.88345623f, 0.704385519f},
-std::array<float,2>{0.129281208f, 0.865236521f},
-std::array<float,2>{0.628011882f, 0.0331987031f},
-std::array<float,2>{0.253239244f, 0.0550558791f},
-std::array<float,2>{0.933392048f, 0.855685055f},
-std::array<float,2>{0.164556831f, 0.689159274f},
-std::array<float,2>{0.662824392f, 0.346263945f},
-std::array<float,2>{0.0724757463f, 0.381385624f},
-std::array<float,2>{0.528933346f, 0.611328363f},
-std::array<float,2>{0.421117425f, 0.879016697f},
-std::array<float,2>{0.751318276f, 0.184404537f},
-std::array<float,2>{0.238093033f, 0.224958494f},
-std::array<float,2>{0.720934749f, 0.985021472f},
-std::array<float,2>{0.331676364f, 0.506367147f},
-std::array<float,2>{0.999129772f, 0.457331687f},
-std::array<float,2>{0.444613963f, 0.308570176f},
-std::array<float,2>{0.820951819f, 0.649326503f},
-std::array<float,2>{0.0280532911f, 0.781674802f},
-std::array<float,2>{0.565199733f, 0.118931293f},
-std::array<float,2>{0.396562994f, 0.127844885f},
-std::array<float,2>{0.791774392f, 0.929506242f},
-std::array<float,2>{0.104685917f, 0.587285042f},
-std::array<float,2>{0.555616319f, 0.418113381f},
-std::array<float,2>{0.152454033f, 0.334637016f},
-std::array<float,2>{0.640832961f, 0.735592306f},
-std::array<float,2>{0.309689939f, 0.823566973f},
-std::array<float,2>{0.896497905f, 0.0248019453f},
-std::array<float,2>{0.0438778065f, 0.0796120465f},
-std::array<float,2>{0.602172136f, 0.776619911f},
-std::array<float,2>{0.486600012f, 0.666486025f},
-std::array<float,2>{0.866612792f, 0.277247399f},
-std::array<float,2>{0.347503126f, 0.487794518f},
-std::array<float,2>{0.966412365f, 0.553555429f},
-std::array<float,2>{0.216106027f, 0.962288141f},
-std::array<float,2>{0.715131223f, 0.197967052f},
-std::array<float,2>{0.301049531f, 0.17366606f},
-std::array<float,2>{0.903451681f, 0.887437642f},
-std::array<float,2>{0.14195326f, 0.621729016f},
-std::array<float,2>{0.654126465f, 0.386603206f},
-std::array<float,2>{0.0976689905f, 0.353147954f},
-std::array<float,2>{0.547136188f, 0.701813757f},
-std::array<float,2>{0.402350992f, 0.850614727f},
-std::array<float,2>{0.788431823f, 0.0518989004f},
-std::array<float,2>{0.207555667f, 0.113263093f},
-std::array<float,2>{0.703938186f, 0.795133591f},
-std::array<float,2>{0.354033709f, 0.643096566f},
-std::array<float,2>{0.959297001f, 0.302406549f},
-std::array<float,2>{0.496978581f, 0.466943234f},
-std::array<float,2>{0.872174561f, 0.514776587f},
-std::array<float,2>{0.0385166444f, 0.995988607f},
-std::array<float,2>{0.600981593f, 0.228328526f},
-std::array<float,2>{0.408074707f, 0.0193928685f},
-std::array<float,2>{0.761912167f, 0.813865244f},
-std::array<float,2>{0.0683807582f, 0.749351263f},
-std::array<float,2>{0.521031737f, 0.336867511f},
-std::array<float,2>{0.161465943f, 0.411702305f},
-std::array<float,2>{0.669127941f, 0.581780255f},
-std::array<float,2>{0.260041565f, 0.935941935f},
-std::array<float,2>{0.925358295f, 0.13511093f},
-std::array<float,2>{0.0171798356f, 0.194019765f},
-std::array<float,2>{0.576239049f, 0.959368587f},
-std::array<float,2>{0.446322531f, 0.561618924f},
-std::array<float,2>{0.815212369f, 0.494072944f},
-std::array<float,2>{0.339987844f, 0.272032559f},
-std::array<float,2>{0.988615692f, 0.659810185f},
-std::array<float,2>{0.244938672f, 0.769614756f},
-std::array<float,2>{0.727748156f, 0.0895696282f},
-std::array<float,2>{0.372436851f, 0.0712308437f},
-std::array<float,2>{0.950020969f, 0.76556468f},
-std::array<float,2>{0.19784905f, 0.681779861f},
-std::array<float,2>{0.698957086f, 0.253411323f},
-std::array<float,2>{0.0537115559f, 0.474935532f},
-std::array<float,2>{0.621863604f, 0.534305036f},
-std::array<float,2>{0.472051769f, 0.950039923f},
-std::array<float,2>{0.852427781f, 0.205710083f},
-std::array<float,2>{0.13934581f, 0.143320024f},
-std::array<float,2>{0.635760784f, 0.920602918f},
-std::array<float,2>{0.293002814f, 0.565365016f},
-std::array<float,2>{0.881972611f, 0.423483282f},
-std::array<float,2>{0.388430893f, 0.314066231f},
-std::array<float,2>{0.796977758f, 0.726001084f},
-std::array<float,2>{0.123199716f, 0.843387008f},
-std::array<float,2>{0.538620055f, 0.0140019543f},
-std::array<float,2>{0.468602717f, 0.243739069f},
-std::array<float,2>{0.835300863f, 0.980364859f},
-std::array<float,2>{0.00840162672f, 0.529929459f},
-std::array<float,2>{0.58184284f, 0.44788754f},
-std::array<float,2>{0.230870187f, 0.281420231f},
-std::array<float,2>{0.737824023f, 0.632311523f},
-std::array<float,2>{0.319959253f, 0.798071206f},
-std::array<float,2>{0.979025185f, 0.105847754f},
-std::array<float,2>{0.0783116147f, 0.044138886f},
-std::array<float,2>{0.502476752f, 0.87068224f},
-std::array<float,2>{0.431593895f, 0.711574256f},
-std::array<float,2>{0.770541549f, 0.366185069f},
-std::array<float,2>{0.279551357f, 0.393572479f},
-std::array<float,2>{0.918292463f, 0.594210327f},
-std::array<float,2>{0.172978595f, 0.902975202f},
-std::array<float,2>{0.676598966f, 0.169242337f},
-std::array<float,2>{0.356283396f, 0.152351782f},
-std::array<float,2>{0.957025111f, 0.908186018f},
-std::array<float,2>{0.204146534f, 0.574334681f},
-std::array<float,2>{0.7081846f, 0.434521347f},
-std::array<float,2>{0.0325106233f, 0.323460132f},
-std::array<float,2>{0.596265733f, 0.733274043f},
-std::array<float,2>{0.493553609f, 0.830434024f},
-std::array<float,2>{0.870292425f, 0.00630046986f},
-std::array<float,2>{0.146119624f, 0.0650527477f},
-std::array<float,2>{0.648541808f, 0.756583095f},
-std::array<float,2>{0.299091756f, 0.672973812f},
-std::array<float,2>{0.900417507f, 0.258388013f},
-std::array<float,2>{0.401055038f, 0.480813771f},
-std::array<float,2>{0.784677505f, 0.542672753f},
-std::array<float,2>{0.0959076881f, 0.939864337f},
-std::array<float,2>{0.553956032f, 0.216525078f},
-std::array<float,2>{0.450659305f, 0.0376202427f},
-std::array<float,2>{0.81810689f, 0.860716879f},
-std::array<float,2>{0.0230635945f, 0.70974952f},
-std::array<float,2>{0.57315886f, 0.367300898f},
-std::array<float,2>{0.248595685f, 0.405579776f},
-std::array<float,2>{0.734047711f, 0.608030558f},
-std::array<float,2>{0.339835554f, 0.891619265f},
-std::array<float,2>{0.986335397f, 0.161877736f},
-std::array<float,2>{0.0648904815f, 0.241995454f},
-std::array<float,2>{0.517013431f, 0.973973095f},
-std::array<float,2>{0.411013454f, 0.523360133f},
-std::array<float,2>{0.760950029f, 0.440749079f},
-std::array<float,2>{0.262616903f, 0.293385327f},
-std::array<float,2>{0.927500069f, 0.640528321f},
-std::array<float,2>{0.158513501f, 0.808695734f},
-std::array<float,2>{0.666953743f, 0.0939572304f},
-std::array<float,2>{0.292272449f, 0.12314418f},
-std::array<float,2>{0.877115607f, 0.788559437f},
-std::array<float,2>{0.133245304f, 0.654033899f},
-std::array<float,2>{0.640571117f, 0.31206581f},
-std::array<float,2>{0.118286304f, 0.454639494f},
-std::array<float,2>{0.534879267f, 0.50014621f},
-std::array<float,2>{0.383593023f, 0.991998374f},
-std::array<float,2>{0.802043021f, 0.220260292f},
-std::array<float,2>{0.202018306f, 0.181646317f},
-std::array<float,2>{0.703115761f, 0.876434207f},
-std::array<float,2>{0.3681584f, 0.613590062f},
-std::array<float,2>{0.948756456f, 0.376380175f},
-std::array<float,2>{0.473860294f, 0.348647505f},
-std::array<float,2>{0.857234597f, 0.694253504f},
-std::array<float,2>{0.0470393039f, 0.852609038f},
-std::array<float,2>{0.617303371f, 0.0619936548f},
-std::array<float,2>{0.43361038f, 0.199522018f},
-std::array<float,2>{0.768257797f, 0.968697786f},
-std::array<float,2>{0.0839020088f, 0.549648225f},
-std::array<float,2>{0.505865932f, 0.488865852f},
-std::array<float,2>{0.178986922f, 0.277573735f},
-std::array<float,2>{0.673274517f, 0.670938492f},
-std::array<float,2>{0.275213987f, 0.780026376f},
-std::array<float,2>{0.916109383f, 0.0849438161f},
-std::array<float,2>{0.0156152602f, 0.0276501141f},
-std::array<float,2>{0.583553493f, 0.827852726f},
-std::array<float,2>{0.46302259f, 0.738329411f},
-std::array<float,2>{0.829229593f, 0.328332961f},
-std::array<float,2>{0.315532237f, 0.41739893f},
-std::array<float,2>{0.981578648f, 0.591846287f},
-std::array<float,2>{0.228829578f, 0.924044311f},
-std::array<float,2>{0.739551842f, 0.13195242f},
-std::array<float,2>{0.271848679f, 0.231096447f},
-std::array<float,2>{0.907507777f, 0.99852711f},
-std::array<float,2>{0.184175596f, 0.510104239f},
-std::array<float,2>{0.68404007f, 0.463953167f},
-std::array<float,2>{0.0884313062f, 0.29942748f},
-std::array<float,2>{0.510453522f, 0.645410895f},
-std::array<float,2>{0.422566026f, 0.792165279f},
-std::array<float,2>{0.776283205f, 0.116421841f},
-std::array<float,2>{0.220270425f, 0.0482191406f},
-std::array<float,2>{0.745442033f, 0.844117641f},
-std::array<float,2>{0.325696498f, 0.697507918f},
-std::array<float,2>{0.972463131f, 0.356492668f},
-std::array<float,2>{0.458407402f, 0.38814941f},
-std::array<float,2>{0.840707004f, 0.619473577f},
-std::array<float,2>{0.00647027418f, 0.88471067f},
-std::array<float,2>{0.586661935f, 0.176126972f},
-std::array<float,2>{0.37633571f, 0.0931327417f},
-std::array<float,2>{0.808983743f, 0.76765579f},
-std::array<float,2>{0.116411962f, 0.663433433f},
-std::array<float,2>{0.539179683f, 0.267229915f},
-std::array<float,2>{0.126551151f, 0.499013335f},
-std::array<float,2>{0.629567802f, 0.5571931f},
-std::array<float,2>{0.28258127f, 0.954206526f},
-std::array<float,2>{0.88965261f, 0.18971239f},
-std::array<float,2>{0.0607968904f, 0.137663767f},
-std::array<float,2>{0.617106557f, 0.933214247f},
-std::array<float,2>{0.477285743f, 0.582617044f},
-std::array<float,2>{0.846724331f, 0.406433284f},
-std::array<float,2>{0.365756214f, 0.343400836f},
-std::array<float,2>{0.939710855f, 0.743913233f},
-std::array<float,2>{0.19382672f, 0.819389582f},
-std::array<float,2>{0.691726446f, 0.0206742529f},
-std::array<float,2>{0.334983081f, 0.00928272121f},
-std::array<float,2>{0.993516684f, 0.836295307f},
-std::array<float,2>{0.239120319f, 0.721182585f},
-std::array<float,2>{0.722900629f, 0.319079965f},
-std::array<float,2>{0.0265312605f, 0.428464115f},
-std::array<float,2>{0.567106485f, 0.569987059f},
-std::array<float,2>{0.438663214f, 0.915448368f},
-std::array<float,2>{0.825686574f, 0.147604093f},
-std::array<float,2>{0.17165488f, 0.210135728f},
-std::array<float,2>{0.657429338f, 0.946327329f},
-std::array<float,2>{0.25624752f, 0.536719024f},
-std::array<float,2>{0.934019089f, 0.471575171f},
-std::array<float,2>{0.416079491f, 0.257106602f},
-std::array<float,2>{0.755552828f, 0.685836196f},
-std::array<float,2>{0.0745572969f, 0.761529863f},
-std::array<float,2>{0.526700914f, 0.075338006f},
-std::array<float,2>{0.489809275f, 0.166018784f},
-std::array<float,2>{0.863038838f, 0.898627043f},
-std::array<float,2>{0.0400788523f, 0.600015521f},
-std::array<float,2>{0.607379913f, 0.397953749f},
-std::array<float,2>{0.212962389f, 0.360080808f},
-std::array<float,2>{0.711411417f, 0.716414332f},
-std::array<float,2>{0.347723484f, 0.873291314f},
-std::array<float,2>{0.963814199f, 0.0402843542f},
-std::array<float,2>{0.105536394f, 0.103704304f},
-std::array<float,2>{0.561484694f, 0.80370146f},
-std::array<float,2>{0.393932611f, 0.626342237f},
-std::array<float,2>{0.796585321f, 0.286100984f},
-std::array<float,2>{0.306596726f, 0.452455789f},
-std::array<float,2>{0.892790079f, 0.525440395f},
-std::array<float,2>{0.149527028f, 0.981323123f},
-std::array<float,2>{0.647410035f, 0.249002069f},
-std::array<float,2>{0.359823823f, 0.235507533f},
-std::array<float,2>{0.945199251f, 0.970686615f},
-std::array<float,2>{0.189767063f, 0.515965641f},
-std::array<float,2>{0.689172924f, 0.443187714f},
-std::array<float,2>{0.0558240525f, 0.289574742f},
-std::array<float,2>{0.611041009f, 0.633849502f},
-std::array<float,2>{0.480585158f, 0.807342052f},
-std::array<float,2>{0.848860741f, 0.101258978f},
-std::array<float,2>{0.130866751f, 0.0349369049f},
-std::array<float,2>{0.626716673f, 0.863634825f},
-std::array<float,2>{0.289047539f, 0.706587791f},
-std::array<float,2>{0.886339068f, 0.37424475f},
-std::array<float,2>{0.381614566f, 0.402144223f},
-std::array<float,2>{0.804905593f, 0.601708949f},
-std::array<float,2>{0.112477869f, 0.896030009f},
-std::array<float,2>{0.544314325f, 0.157236606f},
-std::array<float,2>{0.453774035f, 0.0695722923f},
-std::array<float,2>{0.835982919f, 0.750385284f},
-std::array<float,2>{0.00388415554f, 0.679333329f},
-std::array<float,2>{0.591019809f, 0.265081048f},
-std::array<float,2>{0.224319056f, 0.479492962f},
-std::array<float,2>{0.749666393f, 0.543019891f},
-std::array<float,2>{0.322422206f, 0.943098068f},
-std::array<float,2>{0.972834408f, 0.211828381f},
-std::array<float,2>{0.0899850726f, 0.148632854f},
-std::array<float,2>{0.514809072f, 0.911351979f},
-std::array<float,2>{0.426920623f, 0.573149741f},
-std::array<float,2>{0.780795753f, 0.42995134f},
-std::array<float,2>{0.266961843f, 0.326310486f},
-std::array<float,2>{0.910912335f, 0.726702929f},
-std::array<float,2>{0.180326983f, 0.834414899f},
-std::array<float,2>{0.680252433f, 0.00360619673f},
-std::array<float,2>{0.311509162f, 0.0272835903f},
-std::array<float,2>{0.895759046f, 0.821898818f},
-std::array<float,2>{0.154547393f, 0.737688541f},
-std::array<float,2>{0.64283365f, 0.332853407f},
-std::array<float,2>{0.101906657f, 0.42034784f},
-std::array<float,2>{0.557328224f, 0.589717627f},
-std::array<float,2>{0.396337152f, 0.926594317f},
-std::array<float,2>{0.791011393f, 0.12516965f},
-std::array<float,2>{0.217206955f, 0.195582703f},
-std::array<float,2>{0.717023432f, 0.963781357f},
-std::array<float,2>{0.344560862f, 0.551690817f},
-std::array<float,2>{0.967525184f, 0.484756559f},
-std::array<float,2>{0.486084759f, 0.274250388f},
-std::array<float,2>{0.864299893f, 0.664359331f},
-std::array<float,2>{0.0449425131f, 0.774519682f},
-std::array<float,2>{0.603731036f, 0.0809057802f},
-std::array<float,2>{0.418599486f, 0.187083438f},
-std::array<float,2>{0.752538502f, 0.882338881f},
-std::array<float,2>{0.0709179267f, 0.610402048f},
-std::array<float,2>{0.53070116f, 0.379247487f},
-std::array<float,2>{0.166783392f, 0.344836891f},
-std::array<float,2>{0.660165071f, 0.690462172f},
-std::array<float,2>{0.251025528f, 0.858127415f},
-std::array<float,2>{0.930722952f, 0.0581205785f},
-std::array<float,2>{0.0305403545f, 0.120375067f},
-std::array<float,2>{0.562630057f, 0.783291817f},
-std::array<float,2>{0.442803591f, 0.652321577f},
-std::array<float,2>{0.823869109f, 0.306139916f},
-std::array<float,2>{0.329847902f, 0.459255219f},
-std::array<float,2>{0.99780488f, 0.505006492f},
-std::array<float,2>{0.234915286f, 0.9865219f},
-std::array<float,2>{0.720411301f, 0.22339499f},
-std::array<float,2>{0.258761287f, 0.132882282f},
-std::array<float,2>{0.922796071f, 0.934603512f},
-std::array<float,2>{0.163962439f, 0.57965368f},
-std::array<float,2>{0.671759486f, 0.412731647f},
-std::array<float,2>{0.0670296103f, 0.339831203f},
-std::array<float,2>{0.523044884f, 0.74728328f},
-std::array<float,2>{0.410089254f, 0.814875603f},
-std::array<float,2>{0.764768422f, 0.0169405621f},
-std::array<float,2>{0.244126603f, 0.087801598f},
-std::array<float,2>{0.728560448f, 0.771739364f},
-std::array<float,2>{0.34214744f, 0.657116115f},
-std::array<float,2>{0.99189502f, 0.269714594f},
-std::array<float,2>{0.447498381f, 0.494658262f},
-std::array<float,2>{0.814424634f, 0.560060501f},
-std::array<float,2>{0.0177598186f, 0.958208203f},
-std::array<float,2>{0.574695766f, 0.191668406f},
-std::array<float,2>{0.404449731f, 0.0529397726f},
-std::array<float,2>{0.786342263f, 0.848647714f},
-std::array<float,2>{0.0996996611f, 0.699391127f},
-std::array<float,2>{0.550393343f, 0.353641808f},
-std::array<float,2>{0.143375576f, 0.383780986f},
-std::array<float,2>{0.654625118f, 0.623292446f},
-std::array<float,2>{0.303750724f, 0.889342368f},
-std::array<float,2>{0.906216264f, 0.175618082f},
-std::array<float,2>{0.0353065543f, 0.23031041f},
-std::array<float,2>{0.598984778f, 0.992591977f},
-std::array<float,2>{0.499647498f, 0.511731267f},
-std::array<float,2>{0.87458533f, 0.464900851f},
-std::array<float,2>{0.352092028f, 0.303642482f},
-std::array<float,2>{0.95749104f, 0.641276896f},
-std::array<float,2>{0.210335404f, 0.794044912f},
-std::array<float,2>{0.706699073f, 0.110149674f},
-std::array<float,2>{0.316554487f, 0.107745469f},
-std::array<float,2>{0.9780159f, 0.799199343f},
-std::array<float,2>{0.232487977f, 0.630626321f},
-std::array<float,2>{0.734791756f, 0.283740461f},
-std::array<float,2>{0.0105003184f, 0.446301132f},
-std::array<float,2>{0.578619957f, 0.527622759f},
-std::array<float,2>{0.465744436f, 0.977462411f},
-std::array<float,2>{0.833604097f, 0.244324401f},
-std::array<float,2>{0.174663216f, 0.171833694f},
-std::array<float,2>{0.678358674f, 0.90466702f},
-std::array<float,2>{0.278105885f, 0.596838593f},
-std::array<float,2>{0.920631111f, 0.392359644f},
-std::array<float,2>{0.432028621f, 0.365133882f},
-std::array<float,2>{0.77158016f, 0.714278638f},
-std::array<float,2>{0.080201976f, 0.868832529f},
-std::array<float,2>{0.500149786f, 0.0458637439f},
-std::array<float,2>{0.470105827f, 0.205012992f},
-std::array<float,2>{0.855353177f, 0.951874375f},
-std::array<float,2>{0.0521973744f, 0.532399893f},
-std::array<float,2>{0.623380065f, 0.473384947f},
-std::array<float,2>{0.196975842f, 0.251740664f},
-std::array<float,2>{0.696288943f, 0.681631029f},
-std::array<float,2>{0.373447269f, 0.762935758f},
-std::array<float,2>{0.951197684f, 0.0730365887f},
-std::array<float,2>{0.122150429f, 0.0129943844f},
-std::array<float,2>{0.535313606f, 0.840519071f},
-std::array<float,2>{0.390272647f, 0.723834991f},
-std::array<float,2>{0.800563991f, 0.315439105f},
-std::array<float,2>{0.296205133f, 0.425130874f},
-std::array<float,2>{0.879957676f, 0.563868582f},
-std::array<float,2>{0.136809513f, 0.919683278f},
-std::array<float,2>{0.63350904f, 0.14138931f},
-std::array<float,2>{0.336177051f, 0.162743822f},
-std::array<float,2>{0.985486627f, 0.892696679f},
-std::array<float,2>{0.246383682f, 0.607303739f},
-std::array<float,2>{0.731972277f, 0.402563781f},
-std::array<float,2>{0.0207011681f, 0.369161278f},
-std::array<float,2>{0.570891142f, 0.708229661f},
-std::array<float,2>{0.452630132f, 0.861984015f},
-std::array<float,2>{0.819407582f, 0.0357868299f},
-std::array<float,2>{0.15640758f, 0.0968843028f},
-std::array<float,2>{0.664308548f, 0.810755908f},
-std::array<float,2>{0.264016598f, 0.636860073f},
-std::array<float,2>{0.928152978f, 0.296799809f},
-std::array<float,2>{0.412409723f, 0.437653184f},
-std::array<float,2>{0.759309053f, 0.521328807f},
-std::array<float,2>{0.0633114278f, 0.975887656f},
-std::array<float,2>{0.517874599f, 0.238701478f},
-std::array<float,2>{0.495255262f, 0.00575459702f},
-std::array<float,2>{0.868621469f, 0.828775585f},
-std::array<float,2>{0.0335795768f, 0.730562389f},
-std::array<float,2>{0.595638096f, 0.321267754f},
-std::array<float,2>{0.206718311f, 0.435562491f},
-std::array<float,2>{0.70947969f, 0.577895284f},
-std::array<float,2>{0.358428925f, 0.908953309f},
-std::array<float,2>{0.955012321f, 0.155234456f},
-std::array<float,2>{0.0945257396f, 0.217446372f},
-std::array<float,2>{0.552197993f, 0.938600302f},
-std::array<float,2>{0.399024427f, 0.540712178f},
-std::array<float,2>{0.782845318f, 0.483708769f},
-std::array<float,2>{0.297407299f, 0.260375559f},
-std::array<float,2>{0.89870435f, 0.675537109f},
-std::array<float,2>{0.146600038f, 0.755746365f},
-std::array<float,2>{0.652027428f, 0.0629426017f},
-std::array<float,2>{0.275643945f, 0.082461521f},
-std::array<float,2>{0.914648831f, 0.778058648f},
-std::array<float,2>{0.177132398f, 0.669478774f},
-std::array<float,2>{0.674906492f, 0.279690892f},
-std::array<float,2>{0.0840561166f, 0.49038291f},
-std::array<float,2>{0.504419208f, 0.547219992f},
-std::array<float,2>{0.436627835f, 0.966234326f},
-std::array<float,2>{0.766257405f, 0.202790663f},
-std::array<float,2>{0.227652669f, 0.129522741f},
-std::array<float,2>{0.741528571f, 0.922369838f},
-std::array<float,2>{0.313819468f, 0.59147042f},
-std::array<float,2>{0.983926535f, 0.414951146f},
-std::array<float,2>{0.461002171f, 0.330735385f},
-std::array<float,2>{0.830102861f, 0.741968274f},
-std::array<float,2>{0.0134609472f, 0.82597667f},
-std::array<float,2>{0.58488667f, 0.0301728975f},
-std::array<float,2>{0.386455119f, 0.222129658f},
-std::array<float,2>{0.804013968f, 0.988473475f},
-std::array<float,2>{0.120405346f, 0.502439916f},
-std::array<float,2>{0.531742454f, 0.456404448f},
-std::array<float,2>{0.135524601f, 0.309174538f},
-std::array<float,2>{0.636768818f, 0.654644191f},
-std::array<float,2>{0.289284199f, 0.785512924f},
-std::array<float,2>{0.87557447f, 0.121629514f},
-std::array<float,2>{0.0501819141f, 0.0604839325f},
-std::array<float,2>{0.620824277f, 0.854402721f},
-std::array<float,2>{0.476414323f, 0.693012238f},
-std::array<float,2>{0.859091938f, 0.349818021f},
-std::array<float,2>{0.370363891f, 0.377751797f},
-std::array<float,2>{0.947251081f, 0.615943909f},
-std::array<float,2>{0.199824497f, 0.878662884f},
-std::array<float,2>{0.69987458f, 0.180557191f},
-std::array<float,2>{0.28336814f, 0.188689902f},
-std::array<float,2>{0.886849105f, 0.955505788f},
-std::array<float,2>{0.128878176f, 0.555464029f},
-std::array<float,2>{0.632499874f, 0.49770844f},
-std::array<float,2>{0.113388799f, 0.268239439f},
-std::array<float,2>{0.541072786f, 0.660946786f},
-std::array<float,2>{0.377360135f, 0.76663202f},
-std::array<float,2>{0.810747802f, 0.0914008617f},
-std::array<float,2>{0.192197055f, 0.0217591673f},
-std::array<float,2>{0.694722652f, 0.817677319f},
-std::array<float,2>{0.365027994f, 0.745626628f},
-std::array<float,2>{0.937769175f, 0.340408176f},
-std::array<float,2>{0.4790847f, 0.40884313f},
-std::array<float,2>{0.845222652f, 0.585076392f},
-std::array<float,2>{0.0593631268f, 0.931432903f},
-std::array<float,2>{0.61434257f, 0.139319405f},
-std::array<float,2>{0.425679266f, 0.114454687f},
-std::array<float,2>{0.77535969f, 0.790995002f},
-std::array<float,2>{0.0870800093f, 0.647179067f},
-std::array<float,2>{0.508173406f, 0.298539311f},
-std::array<float,2>{0.18637453f, 0.461986691f},
-std::array<float,2>{0.686241567f, 0.508406162f},
-std::array<float,2>{0.270974874f, 0.996774554f},
-std::array<float,2>{0.909267783f, 0.233573407f},
-std::array<float,2>{0.00487554772f, 0.179523543f},
-std::array<float,2>{0.589097381f, 0.886016071f},
-std::array<float,2>{0.459596455f, 0.617784679f},
-std::array<float,2>{0.842268944f, 0.389895707f},
-std::array<float,2>{0.326989293f, 0.358217895f},
-std::array<float,2>{0.968856454f, 0.695384264f},
-std::array<float,2>{0.222131744f, 0.847286522f},
-std::array<float,2>{0.742538691f, 0.0497587919f},
-std::array<float,2>{0.34999454f, 0.0421373732f},
-std::array<float,2>{0.962468743f, 0.872623444f},
-std::array<float,2>{0.210964978f, 0.718132198f},
-std::array<float,2>{0.713595688f, 0.362120748f},
-std::array<float,2>{0.0422738381f, 0.395167828f},
-std::array<float,2>{0.608287275f, 0.598341048f},
-std::array<float,2>{0.490331829f, 0.901670516f},
-std::array<float,2>{0.859770477f, 0.165048271f},
-std::array<float,2>{0.151315436f, 0.246839151f},
-std::array<float,2>{0.644783616f, 0.983520985f},
-std::array<float,2>{0.308092713f, 0.524399519f},
-std::array<float,2>{0.89232409f, 0.449814439f},
-std::array<float,2>{0.391491443f, 0.287467927f},
-std::array<float,2>{0.79328537f, 0.62832588f},
-std::array<float,2>{0.107925214f, 0.800946891f},
-std::array<float,2>{0.559752584f, 0.103463538f},
-std::array<float,2>{0.440281421f, 0.146292925f},
-std::array<float,2>{0.826197505f, 0.916823506f},
-std::array<float,2>{0.0247045308f, 0.567355812f},
-std::array<float,2>{0.568796873f, 0.426080763f},
-std::array<float,2>{0.242082685f, 0.317714244f},
-std::array<float,2>{0.725330889f, 0.718837202f},
-std::array<float,2>{0.333949655f, 0.839725673f},
-std::array<float,2>{0.99532795f, 0.0115009993f},
-std::array<float,2>{0.0780460313f, 0.0761847049f},
-std::array<float,2>{0.523500979f, 0.759554684f},
-std::array<float,2>{0.414822549f, 0.685389876f},
-std::array<float,2>{0.757222414f, 0.254309982f},
-std::array<float,2>{0.255248904f, 0.468784422f},
-std::array<float,2>{0.936639071f, 0.537440777f},
-std::array<float,2>{0.169030443f, 0.948645055f},
-std::array<float,2>{0.658858776f, 0.208031952f},
-std::array<float,2>{0.373887509f, 0.20537743f},
-std::array<float,2>{0.951889217f, 0.949522018f},
-std::array<float,2>{0.196497113f, 0.53479898f},
-std::array<float,2>{0.69550854f, 0.47545743f},
-std::array<float,2>{0.0524828658f, 0.253476977f},
-std::array<float,2>{0.623677671f, 0.682612598f},
-std::array<float,2>{0.470508277f, 0.764895856f},
-std::array<float,2>{0.854661942f, 0.0707143247f},
-std::array<float,2>{0.137425527f, 0.0143088344f},
-std::array<float,2>{0.632973194f, 0.843098044f},
-std::array<float,2>{0.296624213f, 0.726134956f},
-std::array<float,2>{0.880541325f, 0.313579202f},
-std::array<float,2>{0.389806569f, 0.423113257f},
-std::array<float,2>{0.800052643f, 0.564522803f},
-std::array<float,2>{0.122688323f, 0.920177877f},
-std::array<float,2>{0.536006451f, 0.143034026f},
-std::array<float,2>{0.465313882f, 0.106035858f},
-std::array<float,2>{0.833347559f, 0.79882592f},
-std::array<float,2>{0.00983464904f, 0.632493436f},
-std::array<float,2>{0.578213036f, 0.281848341f},
-std::array<float,2>{0.233369648f, 0.447451025f},
-std::array<float,2>{0.734985113f, 0.529379129f},
-std::array<float,2>{0.317184418f, 0.979740024f},
-std::array<float,2>{0.978262067f, 0.243546396f},
-std::array<float,2>{0.0808077827f, 0.169522509f},
-std::array<float,2>{0.500748515f, 0.902526796f},
-std::array<float,2>{0.432534903f, 0.594461203f},
-std::array<float,2>{0.772054017f, 0.394348562f},
-std::array<float,2>{0.277830333f, 0.365454733f},
-std::array<float,2>{0.919943571f, 0.711243927f},
-std::array<float,2>{0.174053237f, 0.870343089f},
-std::array<float,2>{0.678024054f, 0.044868283f},
-std::array<float,2>{0.30429396f, 0.0526438765f},
-std::array<float,2>{0.90559566f, 0.851154506f},
-std::array<float,2>{0.142775878f, 0.701315224f},
-std::array<float,2>{0.655008554f, 0.352793097f},
-std::array<float,2>{0.100126259f, 0.386128426f},
-std::array<float,2>{0.54992795f, 0.621495903f},
-std::array<float,2>{0.405012101f, 0.886848867f},
-std::array<float,2>{0.786662698f, 0.173013806f},
-std::array<float,2>{0.210735545f, 0.227986485f},
-std::array<float,2>{0.706447482f, 0.995422781f},
-std::array<float,2>{0.351564825f, 0.515534282f},
-std::array<float,2>{0.957532287f, 0.467306793f},
-std::array<float,2>{0.499468744f, 0.301794261f},
-std::array<float,2>{0.874397755f, 0.642805815f},
-std::array<float,2>{0.0359611884f, 0.795807481f},
-std::array<float,2>{0.599223077f, 0.112538047f},
-std::array<float,2>{0.409662038f, 0.135388568f},
-std::array<float,2>{0.765482843f, 0.936053634f},
-std::array<float,2>{0.0667238459f, 0.581380844f},
-std::array<float,2>{0.522796273f, 0.411457837f},
-std::array<float,2>{0.16314353f, 0.336373746f},
-std::array<float,2>{0.670901597f, 0.749847233f},
-std::array<float,2>{0.258203715f, 0.814205706f},
-std::array<float,2>{0.922201812f, 0.0185637008f},
-std::array<float,2>{0.0182965491f, 0.089054212f},
-std::array<float,2>{0.574776173f, 0.770458341f},
-std::array<float,2>{0.448157549f, 0.659349561f},
-std::array<float,2>{0.813890159f, 0.271549255f},
-std::array<float,2>{0.342596799f, 0.493233562f},
-std::array<float,2>{0.99156487f, 0.562441111f},
-std::array<float,2>{0.243338719f, 0.959627807f},
-std::array<float,2>{0.729207516f, 0.193464011f},
-std::array<float,2>{0.251714945f, 0.183681414f},
-std::array<float,2>{0.931379855f, 0.879723847f},
-std::array<float,2>{0.166121647f, 0.611852288f},
-std::array<float,2>{0.660788715f, 0.380865067f},
-std::array<float,2>{0.0706324503f, 0.345790714f},
-std::array<float,2>{0.531065881f, 0.688955784f},
-std::array<float,2>{0.418002456f, 0.856266737f},
-std::array<float,2>{0.75241375f, 0.0555947945f},
-std::array<float,2>{0.23483707f, 0.11829181f},
-std::array<float,2>{0.720058918f, 0.782133162f},
-std::array<float,2>{0.329530776f, 0.648633182f},
-std::array<float,2>{0.997539103f, 0.308007687f},
-std::array<float,2>{0.442982435f, 0.457621336f},
-std::array<float,2>{0.823595405f, 0.506174922f},
-std::array<float,2>{0.0308916867f, 0.984775722f},
-std::array<float,2>{0.563145161f, 0.225276127f},
-std::array<float,2>{0.395659029f, 0.0249768589f},
-std::array<float,2>{0.790505469f, 0.824156404f},
-std::array<float,2>{0.102356516f, 0.736320674f},
-std::array<float,2>{0.556845963f, 0.334320188f},
-std::array<float,2>{0.155244097f, 0.418833256f},
-std::array<float,2>{0.643427789f, 0.587871969f},
-std::array<float,2>{0.311014891f, 0.929176509f},
-std::array<float,2>{0.896386027f, 0.127098277f},
-std::array<float,2>{0.0456127189f, 0.197357804f},
-std::array<float,2>{0.604371548f, 0.962679982f},
-std::array<float,2>{0.485568076f, 0.553034246f},
-std::array<float,2>{0.865055025f, 0.487663627f},
-std::array<float,2>{0.34377113f, 0.276625723f},
-std::array<float,2>{0.966915965f, 0.666601479f},
-std::array<float,2>{0.217657089f, 0.776909471f},
-std::array<float,2>{0.717648387f, 0.0792094767f},
-std::array<float,2>{0.322947234f, 0.0672161877f},
-std::array<float,2>{0.973396599f, 0.753730118f},
-std::array<float,2>{0.223779753f, 0.677357316f},
-std::array<float,2>{0.749424577f, 0.262643486f},
-std::array<float,2>{0.00329126953f, 0.478101432f},
-std::array<float,2>{0.591539025f, 0.546523869f},
-std::array<float,2>{0.453609258f, 0.945203722f},
-std::array<float,2>{0.836790979f, 0.213955462f},
-std::array<float,2>{0.17987673f, 0.151211575f},
-std::array<float,2>{0.679744184f, 0.91254437f},
-std::array<float,2>{0.267251194f, 0.57191664f},
-std::array<float,2>{0.910367012f, 0.432490945f},
-std::array<float,2>{0.427303612f, 0.324991047f},
-std::array<float,2>{0.78031522f, 0.729132891f},
-std::array<float,2>{0.0907849297f, 0.833311915f},
-std::array<float,2>{0.515373111f, 0.00166229252f},
-std::array<float,2>{0.481359541f, 0.237630218f},
-std::array<float,2>{0.849299908f, 0.970815241f},
-std::array<float,2>{0.0565884411f, 0.518871427f},
-std::array<float,2>{0.610618293f, 0.445027262f},
-std::array<float,2>{0.190289333f, 0.29204455f},
-std::array<float,2>{0.688778996f, 0.635797143f},
-std::array<float,2>{0.360243827f, 0.805746913f},
-std::array<float,2>{0.94481498f, 0.0985495076f},
-std::array<float,2>{0.113234051f, 0.0324195139f},
-std::array<float,2>{0.544456661f, 0.865834534f},
-std::array<float,2>{0.381129146f, 0.704617083f},
-std::array<float,2>{0.805389225f, 0.372527808f},
-std::array<float,2>{0.288251489f, 0.398452938f},
-std::array<float,2>{0.88618058f, 0.604083061f},
-std::array<float,2>{0.131427854f, 0.896805108f},
-std::array<float,2>{0.62616384f, 0.158956364f},
-std::array<float,2>{0.333091289f, 0.148210332f},
-std::array<float,2>{0.995757222f, 0.915713131f},
-std::array<float,2>{0.241625175f, 0.569725156f},
-std::array<float,2>{0.724900186f, 0.428080201f},
-std::array<float,2>{0.0253814887f, 0.318765193f},
-std::array<float,2>{0.569298267f, 0.721302867f},
-std::array<float,2>{0.439649403f, 0.836540818f},
-std::array<float,2>{0.827069163f, 0.00899635348f},
-std::array<float,2>{0.169569969f, 0.0759716034f},
-std::array<float,2>{0.658495605f, 0.761080325f},
-std::array<float,2>{0.255756199f, 0.686167181f},
-std::array<float,2>{0.937300742f, 0.257391751f},
-std::array<float,2>{0.41406408f, 0.471072257f},
-std::array<float,2>{0.757512391f, 0.53642261f},
-std::array<float,2>{0.0773908123f, 0.946977079f},
-std::array<float,2>{0.524144173f, 0.210893974f},
-std::array<float,2>{0.490832657f, 0.0405746959f},
-std::array<float,2>{0.860096276f, 0.873728514f},
-std::array<float,2>{0.0428008512f, 0.71622622f},
-std::array<float,2>{0.607714295f, 0.35975796f},
-std::array<float,2>{0.211804613f, 0.397581607f},
-std::array<float,2>{0.713285446f, 0.600431681f},
-std::array<float,2>{0.350230902f, 0.898952901f},
-std::array<float,2>{0.962168634f, 0.166548535f},
-std::array<float,2>{0.10759978f, 0.248419642f},
-std::array<float,2>{0.560542166f, 0.980894208f},
-std::array<float,2>{0.390774578f, 0.526246309f},
-std::array<float,2>{0.793661356f, 0.452764332f},
-std::array<float,2>{0.308163226f, 0.285333574f},
-std::array<float,2>{0.892044961f, 0.626880586f},
-std::array<float,2>{0.150598347f, 0.803106427f},
-std::array<float,2>{0.645501852f, 0.104232587f},
-std::array<float,2>{0.271152318f, 0.117104433f},
-std::array<float,2>{0.910061955f, 0.792711139f},
-std::array<float,2>{0.185718119f, 0.644859135f},
-std::array<float,2>{0.685590386f, 0.299248636f},
-std::array<float,2>{0.0875744522f, 0.464753211f},
-std::array<float,2>{0.508675694f, 0.510353982f},
-std::array<float,2>{0.425224692f, 0.998815238f},
-std::array<float,2>{0.774416685f, 0.230867103f},
-std::array<float,2>{0.222176582f, 0.176314801f},
-std::array<float,2>{0.743078828f, 0.88419348f},
-std::array<float,2>{0.326564193f, 0.619987071f},
-std::array<float,2>{0.969287336f, 0.388516903f},
-std::array<float,2>{0.459416091f, 0.357021868f},
-std::array<float,2>{0.842582881f, 0.697780728f},
-std::array<float,2>{0.00435613841f, 0.844324052f},
-std::array<float,2>{0.589785218f, 0.0485617295f},
-std::array<float,2>{0.377824008f, 0.190406784f},
-std::array<float,2>{0.811498106f, 0.954978883f},
-std::array<float,2>{0.114015378f, 0.556818485f},
-std::array<float,2>{0.541710377f, 0.49807784f},
-std::array<float,2>{0.128185883f, 0.266863346f},
-std::array<float,2>{0.631841063f, 0.66362375f},
-std::array<float,2>{0.28415373f, 0.768409193f},
-std::array<float,2>{0.887254298f, 0.0932744369f},
-std::array<float,2>{0.0590355508f, 0.0212534852f},
-std::array<float,2>{0.615224242f, 0.820293128f},
-std::array<float,2>{0.478820384f, 0.743594766f},
-std::array<float,2>{0.845066309f, 0.34282282f},
-std::array<float,2>{0.36462456f, 0.407046586f},
-std::array<float,2>{0.938294888f, 0.582166374f},
-std::array<float,2>{0.191622674f, 0.932829261f},
-std::array<float,2>{0.695300341f, 0.136823669f},
-std::array<float,2>{0.290032417f, 0.219971552f},
-std::array<float,2>{0.875057876f, 0.99156791f},
-std::array<float,2>{0.135204405f, 0.500632703f},
-std::array<float,2>{0.637651801f, 0.454181284f},
-std::array<float,2>{0.121064767f, 0.311860293f},
-std::array<float,2>{0.531328738f, 0.653562725f},
-std::array<float,2>{0.386048645f, 0.788835824f},
-std::array<float,2>{0.804259837f, 0.123918973f},
-std::array<float,2>{0.19946748f, 0.0621313527f},
-std::array<float,2>{0.699666202f, 0.853049397f},
-std::array<float,2>{0.370941132f, 0.693612814f},
-std::array<float,2>{0.946463168f, 0.349236965f},
-std::array<float,2>{0.475784421f, 0.376883388f},
-std::array<float,2>{0.858674109f, 0.614237368f},
-std::array<float,2>{0.0507546887f, 0.876480401f},
-std::array<float,2>{0.620155275f, 0.182395235f},
-std::array<float,2>{0.437358826f, 0.0840110779f},
-std::array<float,2>{0.766083241f, 0.779351354f},
-std::array<float,2>{0.0848684683f, 0.671524286f},
-std::array<float,2>{0.504362583f, 0.277904719f},
-std::array<float,2>{0.177438691f, 0.488362968f},
-std::array<float,2>{0.675509751f, 0.54914099f},
-std::array<float,2>{0.276217312f, 0.967897594f},
-std::array<float,2>{0.914095342f, 0.199711367f},
-std::array<float,2>{0.013036266f, 0.132354259f},
-std::array<float,2>{0.584127009f, 0.924369216f},
-std::array<float,2>{0.46148169f, 0.592579305f},
-std::array<float,2>{0.830771983f, 0.417553455f},
-std::array<float,2>{0.314431101f, 0.329101562f},
-std::array<float,2>{0.983564079f, 0.738914669f},
-std::array<float,2>{0.228145048f, 0.827476382f},
-std::array<float,2>{0.74206531f, 0.0283109322f},
-std::array<float,2>{0.358913541f, 0.0067714355f},
-std::array<float,2>{0.954368353f, 0.830639422f},
-std::array<float,2>{0.206362039f, 0.732447922f},
-std::array<float,2>{0.709103942f, 0.323748499f},
-std::array<float,2>{0.0337323584f, 0.433846772f},
-std::array<float,2>{0.594818056f, 0.575089693f},
-std::array<float,2>{0.495784163f, 0.907615483f},
-std::array<float,2>{0.868746221f, 0.153111339f},
-std::array<float,2>{0.147388414f, 0.215916619f},
-std::array<float,2>{0.651673496f, 0.940131664f},
-std::array<float,2>{0.297136098f, 0.542084336f},
-std::array<float,2>{0.899366736f, 0.481025487f},
-std::array<float,2>{0.398547202f, 0.257985979f},
-std::array<float,2>{0.782303214f, 0.673642099f},
-std::array<float,2>{0.0940293521f, 0.756175816f},
-std::array<float,2>{0.552471101f, 0.0644843876f},
-std::array<float,2>{0.453066409f, 0.161459595f},
-std::array<float,2>{0.820293725f, 0.892376125f},
-std::array<float,2>{0.0211355593f, 0.607695937f},
-std::array<float,2>{0.570618391f, 0.405913264f},
-std::array<float,2>{0.246994779f, 0.368028343f},
-std::array<float,2>{0.731658578f, 0.70931226f},
-std::array<float,2>{0.336662263f, 0.860866964f},
-std::array<float,2>{0.986002564f, 0.0372444652f},
-std::array<float,2>{0.0626109987f, 0.0942948908f},
-std::array<float,2>{0.518265545f, 0.809549034f},
-std::array<float,2>{0.413049906f, 0.639823794f},
-std::array<float,2>{0.759105682f, 0.293602288f},
-std::array<float,2>{0.264379919f, 0.441206068f},
-std::array<float,2>{0.928288758f, 0.522537053f},
-std::array<float,2>{0.157215223f, 0.97451973f},
-std::array<float,2>{0.664884388f, 0.241376624f},
-std::array<float,2>{0.319566011f, 0.244826943f},
-std::array<float,2>{0.978644252f, 0.976640105f},
-std::array<float,2>{0.231151119f, 0.527856827f},
-std::array<float,2>{0.737351418f, 0.446812689f},
-std::array<float,2>{0.00829194672f, 0.283680081f},
-std::array<float,2>{0.581349075f, 0.630277872f},
-std::array<float,2>{0.468046278f, 0.799447954f},
-std::array<float,2>{0.835539281f, 0.108058453f},
-std::array<float,2>{0.173500732f, 0.0449541323f},
-std::array<float,2>{0.675876558f, 0.868412793f},
-std::array<float,2>{0.279965967f, 0.714654982f},
-std::array<float,2>{0.918531895f, 0.364266396f},
-std::array<float,2>{0.43093428f, 0.392040759f},
-std::array<float,2>{0.771259367f, 0.597404718f},
-std::array<float,2>{0.0787149966f, 0.904884934f},
-std::array<float,2>{0.502013028f, 0.171259001f},
-std::array<float,2>{0.472195804f, 0.0724999756f},
-std::array<float,2>{0.852037072f, 0.763523281f},
-std::array<float,2>{0.0545703992f, 0.681145251f},
-std::array<float,2>{0.621359169f, 0.250993192f},
-std::array<float,2>{0.197623268f, 0.472840339f},
-std::array<float,2>{0.698616326f, 0.532792449f},
-std::array<float,2>{0.37303561f, 0.9512707f},
-std::array<float,2>{0.949333608f, 0.204178929f},
-std::array<float,2>{0.12395642f, 0.140633956f},
-std::array<float,2>{0.538136482f, 0.919165552f},
-std::array<float,2>{0.387838632f, 0.564322531f},
-std::array<float,2>{0.797563851f, 0.425339639f},
-std::array<float,2>{0.293909341f, 0.316161633f},
-std::array<float,2>{0.882535756f, 0.724288285f},
-std::array<float,2>{0.138740182f, 0.839894116f},
-std::array<float,2>{0.63668859f, 0.0135745713f},
-std::array<float,2>{0.260269135f, 0.0173008349f},
-std::array<float,2>{0.925148249f, 0.815147579f},
-std::array<float,2>{0.16184859f, 0.747999251f},
-std::array<float,2>{0.669729114f, 0.339322954f},
-std::array<float,2>{0.0689383f, 0.412533581f},
-std::array<float,2>{0.520752251f, 0.579330146f},
-std::array<float,2>{0.407618225f, 0.935389757f},
-std::array<float,2>{0.76266402f, 0.133725658f},
-std::array<float,2>{0.244286463f, 0.19225727f},
-std::array<float,2>{0.728094578f, 0.958671391f},
-std::array<float,2>{0.340344906f, 0.560057044f},
-std::array<float,2>{0.989120781f, 0.494346589f},
-std::array<float,2>{0.447122008f, 0.270335764f},
-std::array<float,2>{0.814818025f, 0.65638715f},
-std::array<float,2>{0.0167664029f, 0.77240628f},
-std::array<float,2>{0.576758742f, 0.087032713f},
-std::array<float,2>{0.402850837f, 0.174959943f},
-std::array<float,2>{0.788816988f, 0.888715982f},
-std::array<float,2>{0.0981937721f, 0.62358135f},
-std::array<float,2>{0.547773838f, 0.383196145f},
-std::array<float,2>{0.142401159f, 0.354455322f},
-std::array<float,2>{0.653774738f, 0.700181067f},
-std::array<float,2>{0.301703006f, 0.849523544f},
-std::array<float,2>{0.904153943f, 0.053328339f},
-std::array<float,2>{0.0390608571f, 0.109444991f},
-std::array<float,2>{0.601316929f, 0.794733405f},
-std::array<float,2>{0.496268392f, 0.641060174f},
-std::array<float,2>{0.872573197f, 0.303142011f},
-std::array<float,2>{0.353715599f, 0.465782166f},
-std::array<float,2>{0.959801733f, 0.51232022f},
-std::array<float,2>{0.207295194f, 0.993082821f},
-std::array<float,2>{0.70329833f, 0.229515895f},
-std::array<float,2>{0.310248405f, 0.12579222f},
-std::array<float,2>{0.897022724f, 0.926179707f},
-std::array<float,2>{0.152885452f, 0.589329302f},
-std::array<float,2>{0.641277969f, 0.420739353f},
-std::array<float,2>{0.105215698f, 0.332063198f},
-std::array<float,2>{0.554770052f, 0.737811387f},
-std::array<float,2>{0.397286832f, 0.821454585f},
-std::array<float,2>{0.791138887f, 0.0264870003f},
-std::array<float,2>{0.216600165f, 0.0803384036f},
-std::array<float,2>{0.71551317f, 0.775122106f},
-std::array<float,2>{0.347111315f, 0.664926708f},
-std::array<float,2>{0.96626246f, 0.273481458f},
-std::array<float,2>{0.48719725f, 0.485025674f},
-std::array<float,2>{0.867054999f, 0.551252246f},
-std::array<float,2>{0.0433393978f, 0.963062286f},
-std::array<float,2>{0.602038324f, 0.195801467f},
-std::array<float,2>{0.421465993f, 0.0578449294f},
-std::array<float,2>{0.751499534f, 0.857572615f},
-std::array<float,2>{0.0731206387f, 0.691396475f},
-std::array<float,2>{0.528531194f, 0.345573097f},
-std::array<float,2>{0.164116368f, 0.379680306f},
-std::array<float,2>{0.662464201f, 0.611051679f},
-std::array<float,2>{0.253589422f, 0.882223248f},
-std::array<float,2>{0.932805538f, 0.186961412f},
-std::array<float,2>{0.0275275148f, 0.222778186f},
-std::array<float,2>{0.56474793f, 0.986869693f},
-std::array<float,2>{0.444898158f, 0.505638421f},
-std::array<float,2>{0.820606232f, 0.45955804f},
-std::array<float,2>{0.331373066f, 0.306598842f},
-std::array<float,2>{0.999801993f, 0.651624262f},
-std::array<float,2>{0.237331897f, 0.784156919f},
-std::array<float,2>{0.721191525f, 0.120648772f},
-std::array<float,2>{0.36257422f, 0.100929677f},
-std::array<float,2>{0.942609489f, 0.806930304f},
-std::array<float,2>{0.188096821f, 0.634454429f},
-std::array<float,2>{0.690805137f, 0.289081305f},
-std::array<float,2>{0.058370851f, 0.442540079f},
-std::array<float,2>{0.611395359f, 0.516196072f},
-std::array<float,2>{0.482930094f, 0.96997261f},
-std::array<float,2>{0.851551354f, 0.236255735f},
-std::array<float,2>{0.129498109f, 0.157877222f},
-std::array<float,2>{0.628480494f, 0.895660222f},
-std::array<float,2>{0.285997301f, 0.602202058f},
-std::array<float,2>{0.882950008f, 0.401719332f},
-std::array<float,2>{0.37947607f, 0.374966264f},
-std::array<float,2>{0.807400525f, 0.70651269f},
-std::array<float,2>{0.110991105f, 0.863790989f},
-std::array<float,2>{0.545764983f, 0.0342758261f},
-std::array<float,2>{0.456177443f, 0.21133858f},
-std::array<float,2>{0.839298606f, 0.942403257f},
-std::array<float,2>{0.000787599478f, 0.543732941f},
-std::array<float,2>{0.593224287f, 0.479997247f},
-std::array<float,2>{0.226199016f, 0.265398204f},
-std::array<float,2>{0.747943938f, 0.678746104f},
-std::array<float,2>{0.321607232f, 0.750949979f},
-std::array<float,2>{0.976162076f, 0.0702021495f},
-std::array<float,2>{0.0918708742f, 0.00334524084f},
-std::array<float,2>{0.51360029f, 0.834822655f},
-std::array<float,2>{0.428685457f, 0.727293968f},
-std::array<float,2>{0.779271841f, 0.326810867f},
-std::array<float,2>{0.267606229f, 0.430235028f},
-std::array<float,2>{0.913452208f, 0.572612703f},
-std::array<float,2>{0.183468178f, 0.911690652f},
-std::array<float,2>{0.682430804f, 0.14914301f},
-std::array<float,2>{0.348236293f, 0.166009948f},
-std::array<float,2>{0.96297586f, 0.902279913f},
-std::array<float,2>{0.213456839f, 0.597917557f},
-std::array<float,2>{0.711889207f, 0.394695342f},
-std::array<float,2>{0.0406936742f, 0.361339957f},
-std::array<float,2>{0.606606543f, 0.718465209f},
-std::array<float,2>{0.489492446f, 0.872135699f},
-std::array<float,2>{0.862630665f, 0.0429395586f},
-std::array<float,2>{0.150018752f, 0.102888085f},
-std::array<float,2>{0.646515369f, 0.801378787f},
-std::array<float,2>{0.305939138f, 0.628808856f},
-std::array<float,2>{0.893435299f, 0.287620187f},
-std::array<float,2>{0.39425236f, 0.449632525f},
-std::array<float,2>{0.79628706f, 0.523603261f},
-std::array<float,2>{0.106099486f, 0.984086633f},
-std::array<float,2>{0.560986698f, 0.246394351f},
-std::array<float,2>{0.439386845f, 0.0109836021f},
-std::array<float,2>{0.825247765f, 0.839349747f},
-std::array<float,2>{0.0270337388f, 0.719572246f},
-std::array<float,2>{0.566700101f, 0.318026632f},
-std::array<float,2>{0.238555118f, 0.426608413f},
-std::array<float,2>{0.723413587f, 0.566635847f},
-std::array<float,2>{0.335856348f, 0.916142046f},
-std::array<float,2>{0.993828654f, 0.145869181f},
-std::array<float,2>{0.07472682f, 0.208506137f},
-std::array<float,2>{0.527197242f, 0.949122846f},
-std::array<float,2>{0.416719437f, 0.537813067f},
-std::array<float,2>{0.754927993f, 0.469255507f},
-std::array<float,2>{0.256699413f, 0.254857749f},
-std::array<float,2>{0.934415877f, 0.68469888f},
-std::array<float,2>{0.170907512f, 0.759220123f},
-std::array<float,2>{0.658167124f, 0.0771198273f},
-std::array<float,2>{0.282833755f, 0.091138728f},
-std::array<float,2>{0.890283704f, 0.767351627f},
-std::array<float,2>{0.126343161f, 0.660168409f},
-std::array<float,2>{0.629172504f, 0.267629266f},
-std::array<float,2>{0.117136739f, 0.497164458f},
-std::array<float,2>{0.539866686f, 0.555010378f},
-std::array<float,2>{0.376716346f, 0.955880284f},
-std::array<float,2>{0.809183657f, 0.189241379f},
-std::array<float,2>{0.194227248f, 0.138795123f},
-std::array<float,2>{0.69238019f, 0.931014359f},
-std::array<float,2>{0.365428984f, 0.585932732f},
-std::array<float,2>{0.939944208f, 0.408598363f},
-std::array<float,2>{0.477004945f, 0.340214819f},
-std::array<float,2>{0.847332358f, 0.745378792f},
-std::array<float,2>{0.061181888f, 0.817986369f},
-std::array<float,2>{0.61626929f, 0.0223471839f},
-std::array<float,2>{0.422165275f, 0.233909249f},
-std::array<float,2>{0.775677621f, 0.996251047f},
-std::array<float,2>{0.0880461633f, 0.507857025f},
-std::array<float,2>{0.510094762f, 0.462779433f},
-std::array<float,2>{0.183861449f, 0.298306048f},
-std::array<float,2>{0.684304178f, 0.646901846f},
-std::array<float,2>{0.272132069f, 0.790214479f},
-std::array<float,2>{0.9081043f, 0.115211748f},
-std::array<float,2>{0.00614540372f, 0.0490720049f},
-std::array<float,2>{0.586139679f, 0.846849799f},
-std::array<float,2>{0.458729088f, 0.695841908f},
-std::array<float,2>{0.840168595f, 0.357725501f},
-std::array<float,2>{0.325656384f, 0.39055714f},
-std::array<float,2>{0.972020268f, 0.617306828f},
-std::array<float,2>{0.219805181f, 0.886364639f},
-std::array<float,2>{0.745934069f, 0.179062635f},
-std::array<float,2>{0.274866402f, 0.202455148f},
-std::array<float,2>{0.916668832f, 0.966655493f},
-std::array<float,2>{0.179392025f, 0.547557771f},
-std::array<float,2>{0.673576713f, 0.491129935f},
-std::array<float,2>{0.0831886232f, 0.27985236f},
-std::array<float,2>{0.506713927f, 0.669371486f},
-std::array<float,2>{0.434546322f, 0.777618229f},
-std::array<float,2>{0.767899871f, 0.082702741f},
-std::array<float,2>{0.229297951f, 0.0294058397f},
-std::array<float,2>{0.73982209f, 0.825525701f},
-std::array<float,2>{0.316259205f, 0.741554737f},
-std::array<float,2>{0.982415736f, 0.330436736f},
-std::array<float,2>{0.463772207f, 0.414128125f},
-std::array<float,2>{0.829791069f, 0.591020644f},
-std::array<float,2>{0.0149978939f, 0.922151089f},
-std::array<float,2>{0.583109796f, 0.129066154f},
-std::array<float,2>{0.383213609f, 0.121562839f},
-std::array<float,2>{0.802609742f, 0.785650253f},
-std::array<float,2>{0.119019836f, 0.655216813f},
-std::array<float,2>{0.534491658f, 0.308857352f},
-std::array<float,2>{0.133509457f, 0.456580192f},
-std::array<float,2>{0.639759541f, 0.502442598f},
-std::array<float,2>{0.292596489f, 0.989065707f},
-std::array<float,2>{0.877795517f, 0.222616315f},
-std::array<float,2>{0.0477467589f, 0.180125624f},
-std::array<float,2>{0.617741406f, 0.877978981f},
-std::array<float,2>{0.474204153f, 0.615503907f},
-std::array<float,2>{0.856728077f, 0.377263367f},
-std::array<float,2>{0.367667824f, 0.350473791f},
-std::array<float,2>{0.948285699f, 0.692723751f},
-std::array<float,2>{0.201256007f, 0.853686869f},
-std::array<float,2>{0.702587068f, 0.0597745813f},
-std::array<float,2>{0.339295894f, 0.0352296866f},
-std::array<float,2>{0.98724997f, 0.861482799f},
-std::array<float,2>{0.248213455f, 0.708681107f},
-std::array<float,2>{0.733835638f, 0.370069504f},
-std::array<float,2>{0.0225923769f, 0.403070599f},
-std::array<float,2>{0.57253617f, 0.606887221f},
-std::array<float,2>{0.45080021f, 0.893164098f},
-std::array<float,2>{0.817716599f, 0.162246853f},
-std::array<float,2>{0.158786431f, 0.239123508f},
-std::array<float,2>{0.666498065f, 0.976212978f},
-std::array<float,2>{0.261752963f, 0.52092427f},
-std::array<float,2>{0.926776707f, 0.438177913f},
-std::array<float,2>{0.410162866f, 0.296099067f},
-std::array<float,2>{0.761600792f, 0.637213945f},
-std::array<float,2>{0.065081574f, 0.811461151f},
-std::array<float,2>{0.517309964f, 0.0975819081f},
-std::array<float,2>{0.493915111f, 0.154762924f},
-std::array<float,2>{0.870847881f, 0.908406436f},
-std::array<float,2>{0.0329391137f, 0.577166319f},
-std::array<float,2>{0.595927775f, 0.43631503f},
-std::array<float,2>{0.204791844f, 0.320487082f},
-std::array<float,2>{0.70881474f, 0.731146753f},
-std::array<float,2>{0.355806321f, 0.828263521f},
-std::array<float,2>{0.956392884f, 0.0053469874f},
-std::array<float,2>{0.0966246724f, 0.0633180141f},
-std::array<float,2>{0.554229856f, 0.755088329f},
-std::array<float,2>{0.400667071f, 0.674908996f},
-std::array<float,2>{0.784210145f, 0.260133803f},
-std::array<float,2>{0.299418122f, 0.483944327f},
-std::array<float,2>{0.901118934f, 0.540469825f},
-std::array<float,2>{0.145542234f, 0.939231873f},
-std::array<float,2>{0.649123728f, 0.217229173f},
-std::array<float,2>{0.34095943f, 0.19437696f},
-std::array<float,2>{0.989719391f, 0.960657895f},
-std::array<float,2>{0.245407164f, 0.560642064f},
-std::array<float,2>{0.727113485f, 0.49229008f},
-std::array<float,2>{0.0163873006f, 0.272569209f},
-std::array<float,2>{0.577990174f, 0.658931911f},
-std::array<float,2>{0.44626072f, 0.77112484f},
-std::array<float,2>{0.816129804f, 0.0882397965f},
-std::array<float,2>{0.160883397f, 0.0185287539f},
-std::array<float,2>{0.668473959f, 0.812879503f},
-std::array<float,2>{0.261251092f, 0.748677552f},
-std::array<float,2>{0.92465955f, 0.336927027f},
-std::array<float,2>{0.406500608f, 0.410677135f},
-std::array<float,2>{0.763057113f, 0.580474973f},
-std::array<float,2>{0.0702479184f, 0.937076747f},
-std::array<float,2>{0.519664943f, 0.136062667f},
-std::array<float,2>{0.497790903f, 0.11185059f},
-std::array<float,2>{0.871224701f, 0.79653579f},
-std::array<float,2>{0.0374740288f, 0.643810332f},
-std::array<float,2>{0.600190997f, 0.300830811f},
-std::array<float,2>{0.208393008f, 0.467981964f},
-std::array<float,2>{0.704499125f, 0.513966084f},
-std::array<float,2>{0.355354846f, 0.994937658f},
-std::array<float,2>{0.960475385f, 0.227450833f},
-std::array<float,2>{0.0988893956f, 0.172233284f},
-std::array<float,2>{0.548796713f, 0.887774289f},
-std::array<float,2>{0.403490871f, 0.622148633f},
-std::array<float,2>{0.787775338f, 0.385011554f},
-std::array<float,2>{0.302234739f, 0.352123231f},
-std::array<float,2>{0.902871549f, 0.702231169f},
-std::array<float,2>{0.140908688f, 0.85049814f},
-std::array<float,2>{0.652683198f, 0.0511836186f},
-std::array<float,2>{0.280967027f, 0.0433004051f},
-std::array<float,2>{0.919775367f, 0.870069683f},
-std::array<float,2>{0.172304139f, 0.71274507f},
-std::array<float,2>{0.677459121f, 0.36716482f},
-std::array<float,2>{0.0794139579f, 0.392954975f},
-std::array<float,2>{0.503532529f, 0.595576644f},
-std::array<float,2>{0.430662245f, 0.903757691f},
-std::array<float,2>{0.770464301f, 0.168122157f},
-std::array<float,2>{0.23164095f, 0.242656648f},
-std::array<float,2>{0.737099469f, 0.979329765f},
-std::array<float,2>{0.319136709f, 0.530748248f},
-std::array<float,2>{0.979585588f, 0.448925197f},
-std::array<float,2>{0.467491984f, 0.282376319f},
-std::array<float,2>{0.834835351f, 0.631507516f},
-std::array<float,2>{0.00974598806f, 0.797610283f},
-std::array<float,2>{0.580646276f, 0.106805511f},
-std::array<float,2>{0.386968315f, 0.14424032f},
-std::array<float,2>{0.797899306f, 0.921697378f},
-std::array<float,2>{0.124220461f, 0.566376448f},
-std::array<float,2>{0.537683785f, 0.42280072f},
-std::array<float,2>{0.140436962f, 0.313111693f},
-std::array<float,2>{0.634917438f, 0.725204766f},
-std::array<float,2>{0.294778943f, 0.84207201f},
-std::array<float,2>{0.881104648f, 0.0147462143f},
-std::array<float,2>{0.0536104552f, 0.0713396743f},
-std::array<float,2>{0.622670174f, 0.764587343f},
-std::array<float,2>{0.471137464f, 0.683206975f},
-std::array<float,2>{0.852759123f, 0.252471238f},
-std::array<float,2>{0.371381491f, 0.475590885f},
-std::array<float,2>{0.950742066f, 0.533213973f},
-std::array<float,2>{0.198255479f, 0.951032758f},
-std::array<float,2>{0.697676003f, 0.206550136f},
-std::array<float,2>{0.286502272f, 0.15993239f},
-std::array<float,2>{0.884358466f, 0.898094118f},
-std::array<float,2>{0.130562931f, 0.604579031f},
-std::array<float,2>{0.627087951f, 0.399710923f},
-std::array<float,2>{0.11003913f, 0.371999025f},
-std::array<float,2>{0.545914471f, 0.704040766f},
-std::array<float,2>{0.379929751f, 0.866622031f},
-std::array<float,2>{0.807647586f, 0.0313243009f},
-std::array<float,2>{0.189416394f, 0.0993008986f},
-std::array<float,2>{0.689537942f, 0.804704189f},
-std::array<float,2>{0.362246484f, 0.634773314f},
-std::array<float,2>{0.942065239f, 0.291352063f},
-std::array<float,2>{0.483969659f, 0.443462759f},
-std::array<float,2>{0.850199103f, 0.517976642f},
-std::array<float,2>{0.0567245223f, 0.971786678f},
-std::array<float,2>{0.612562716f, 0.236554921f},
-std::array<float,2>{0.42950055f, 0.000560720568f},
-std::array<float,2>{0.778208673f, 0.832916617f},
-std::array<float,2>{0.093220897f, 0.730013549f},
-std::array<float,2>{0.512352824f, 0.325724661f},
-std::array<float,2>{0.18180418f, 0.433352351f},
-std::array<float,2>{0.683553517f, 0.570984364f},
-std::array<float,2>{0.268734962f, 0.913341582f},
-std::array<float,2>{0.912476897f, 0.152045369f},
-std::array<float,2>{0.00109143206f, 0.213262528f},
-std::array<float,2>{0.592465639f, 0.944284618f},
-std::array<float,2>{0.455762982f, 0.545007467f},
-std::array<float,2>{0.838169277f, 0.47705546f},
-std::array<float,2>{0.321127623f, 0.263576269f},
-std::array<float,2>{0.974779665f, 0.675800979f},
-std::array<float,2>{0.224685773f, 0.752539873f},
-std::array<float,2>{0.746775031f, 0.0677290335f},
-std::array<float,2>{0.34602502f, 0.0783082396f},
-std::array<float,2>{0.965503871f, 0.775557041f},
-std::array<float,2>{0.215334892f, 0.667273879f},
-std::array<float,2>{0.716053367f, 0.275598556f},
-std::array<float,2>{0.0441571102f, 0.486668915f},
-std::array<float,2>{0.603498816f, 0.554562926f},
-std::array<float,2>{0.487387985f, 0.961346626f},
-std::array<float,2>{0.865777254f, 0.198812887f},
-std::array<float,2>{0.154128179f, 0.128276139f},
-std::array<float,2>{0.642042458f, 0.928686082f},
-std::array<float,2>{0.308837712f, 0.586298466f},
-std::array<float,2>{0.898156345f, 0.419506401f},
-std::array<float,2>{0.398349196f, 0.335905194f},
-std::array<float,2>{0.792024195f, 0.734701037f},
-std::array<float,2>{0.10407225f, 0.822333157f},
-std::array<float,2>{0.555959463f, 0.0237175375f},
-std::array<float,2>{0.444046855f, 0.226186082f},
-std::array<float,2>{0.821441412f, 0.985861182f},
-std::array<float,2>{0.0290820915f, 0.507116497f},
-std::array<float,2>{0.565575838f, 0.458636552f},
-std::array<float,2>{0.237039044f, 0.307548463f},
-std::array<float,2>{0.721711636f, 0.649900794f},
-std::array<float,2>{0.331017137f, 0.782830119f},
-std::array<float,2>{0.998464584f, 0.117438063f},
-std::array<float,2>{0.0738813952f, 0.0563634485f},
-std::array<float,2>{0.528254032f, 0.856542766f},
-std::array<float,2>{0.420321286f, 0.688154519f},
-std::array<float,2>{0.750856876f, 0.346923977f},
-std::array<float,2>{0.252691865f, 0.382176459f},
-std::array<float,2>{0.932535648f, 0.61322546f},
-std::array<float,2>{0.165142298f, 0.88038671f},
-std::array<float,2>{0.66333133f, 0.185437873f},
-std::array<float,2>{0.36644876f, 0.138033211f},
-std::array<float,2>{0.940758049f, 0.931645513f},
-std::array<float,2>{0.194831371f, 0.58374536f},
-std::array<float,2>{0.692410111f, 0.407349467f},
-std::array<float,2>{0.0622942932f, 0.342696369f},
-std::array<float,2>{0.615319788f, 0.742904663f},
-std::array<float,2>{0.477887124f, 0.81880188f},
-std::array<float,2>{0.846336782f, 0.0204284843f},
-std::array<float,2>{0.125551492f, 0.0918362141f},
-std::array<float,2>{0.630843401f, 0.76913631f},
-std::array<float,2>{0.281443179f, 0.663044572f},
-std::array<float,2>{0.88914907f, 0.26653555f},
-std::array<float,2>{0.375542879f, 0.499909252f},
-std::array<float,2>{0.810037196f, 0.558134496f},
-std::array<float,2>{0.115742005f, 0.953911781f},
-std::array<float,2>{0.540508807f, 0.191209212f},
-std::array<float,2>{0.457115769f, 0.0476650521f},
-std::array<float,2>{0.841482699f, 0.845537007f},
-std::array<float,2>{0.00712525984f, 0.69918716f},
-std::array<float,2>{0.587729454f, 0.355607927f},
-std::array<float,2>{0.219644427f, 0.386727363f},
-std::array<float,2>{0.745046318f, 0.620829821f},
-std::array<float,2>{0.324334949f, 0.88358885f},
-std::array<float,2>{0.971318483f, 0.177504241f},
-std::array<float,2>{0.0896384418f, 0.231756791f},
-std::array<float,2>{0.511501372f, 0.999536276f},
-std::array<float,2>{0.423602372f, 0.510982394f},
-std::array<float,2>{0.776454568f, 0.463393092f},
-std::array<float,2>{0.272498459f, 0.299911529f},
-std::array<float,2>{0.907147706f, 0.646384776f},
-std::array<float,2>{0.184766367f, 0.791974187f},
-std::array<float,2>{0.685525239f, 0.115728699f},
-std::array<float,2>{0.304805726f, 0.10492494f},
-std::array<float,2>{0.894282162f, 0.803943753f},
-std::array<float,2>{0.149325222f, 0.625440478f},
-std::array<float,2>{0.647657871f, 0.286187202f},
-std::array<float,2>{0.106946237f, 0.451422244f},
-std::array<float,2>{0.561855078f, 0.527327716f},
-std::array<float,2>{0.393345773f, 0.981976748f},
-std::array<float,2>{0.795598924f, 0.24988389f},
-std::array<float,2>{0.214240745f, 0.167515323f},
-std::array<float,2>{0.711942434f, 0.900170386f},
-std::array<float,2>{0.349496722f, 0.601379752f},
-std::array<float,2>{0.964831889f, 0.397119164f},
-std::array<float,2>{0.488633573f, 0.361210108f},
-std::array<float,2>{0.862292707f, 0.714854479f},
-std::array<float,2>{0.0394750424f, 0.874359727f},
-std::array<float,2>{0.605875134f, 0.0400033444f},
-std::array<float,2>{0.417342424f, 0.209500879f},
-std::array<float,2>{0.75481832f, 0.945972621f},
-std::array<float,2>{0.0759984329f, 0.535234511f},
-std::array<float,2>{0.525570393f, 0.472194731f},
-std::array<float,2>{0.16994758f, 0.256150812f},
-std::array<float,2>{0.656537294f, 0.687005103f},
-std::array<float,2>{0.257587194f, 0.760323405f},
-std::array<float,2>{0.935459614f, 0.0746630654f},
-std::array<float,2>{0.0258522648f, 0.00790998526f},
-std::array<float,2>{0.567403913f, 0.837507069f},
-std::array<float,2>{0.43843326f, 0.722503841f},
-std::array<float,2>{0.824542165f, 0.320005745f},
-std::array<float,2>{0.334044605f, 0.428866386f},
-std::array<float,2>{0.992554247f, 0.568801284f},
-std::array<float,2>{0.239787385f, 0.914267361f},
-std::array<float,2>{0.72396332f, 0.147317961f},
-std::array<float,2>{0.263081908f, 0.24091883f},
-std::array<float,2>{0.926486135f, 0.97338593f},
-std::array<float,2>{0.159733474f, 0.521829247f},
-std::array<float,2>{0.667261899f, 0.439883292f},
-std::array<float,2>{0.0660390258f, 0.294327438f},
-std::array<float,2>{0.51621598f, 0.638788819f},
-std::array<float,2>{0.411136568f, 0.809824944f},
-std::array<float,2>{0.760206044f, 0.095610261f},
-std::array<float,2>{0.2493103f, 0.0380944982f},
-std::array<float,2>{0.733107865f, 0.860257447f},
-std::array<float,2>{0.338099331f, 0.710032105f},
-std::array<float,2>{0.988232136f, 0.368250757f},
-std::array<float,2>{0.449464321f, 0.405020773f},
-std::array<float,2>{0.81643039f, 0.609374046f},
-std::array<float,2>{0.022151215f, 0.891501248f},
-std::array<float,2>{0.573881388f, 0.160880089f},
-std::array<float,2>{0.40187043f, 0.0655539557f},
-std::array<float,2>{0.78345722f, 0.757636726f},
-std::array<float,2>{0.0972823352f, 0.672002971f},
-std::array<float,2>{0.552847147f, 0.259407043f},
-std::array<float,2>{0.145178124f, 0.481456846f},
-std::array<float,2>{0.649452269f, 0.541743219f},
-std::array<float,2>{0.300486267f, 0.940699339f},
-std::array<float,2>{0.902182579f, 0.215218663f},
-std::array<float,2>{0.0320457667f, 0.153633595f},
-std::array<float,2>{0.596680343f, 0.906427324f},
-std::array<float,2>{0.492536336f, 0.575965106f},
-std::array<float,2>{0.869681656f, 0.435300171f},
-std::array<float,2>{0.356770813f, 0.322617829f},
-std::array<float,2>{0.955224395f, 0.733752489f},
-std::array<float,2>{0.203552574f, 0.8314026f},
-std::array<float,2>{0.70766592f, 0.00709379185f},
-std::array<float,2>{0.314545423f, 0.0284369346f},
-std::array<float,2>{0.980699003f, 0.826967299f},
-std::array<float,2>{0.23036623f, 0.739985406f},
-std::array<float,2>{0.738843441f, 0.329937041f},
-std::array<float,2>{0.0141957346f, 0.416916102f},
-std::array<float,2>{0.582058907f, 0.593437731f},
-std::array<float,2>{0.464117199f, 0.924869418f},
-std::array<float,2>{0.828160286f, 0.130998969f},
-std::array<float,2>{0.178306326f, 0.200829938f},
-std::array<float,2>{0.671958923f, 0.96726805f},
-std::array<float,2>{0.273838699f, 0.550628424f},
-std::array<float,2>{0.917478383f, 0.489529371f},
-std::array<float,2>{0.434772342f, 0.279012799f},
-std::array<float,2>{0.768889546f, 0.670314074f},
-std::array<float,2>{0.0826925263f, 0.781033456f},
-std::array<float,2>{0.50740099f, 0.0857544169f},
-std::array<float,2>{0.473056376f, 0.183336854f},
-std::array<float,2>{0.855915427f, 0.875712574f},
-std::array<float,2>{0.0488184579f, 0.61429137f},
-std::array<float,2>{0.618318081f, 0.375609905f},
-std::array<float,2>{0.202562183f, 0.348147511f},
-std::array<float,2>{0.702127218f, 0.6950863f},
-std::array<float,2>{0.369045854f, 0.852088392f},
-std::array<float,2>{0.947998703f, 0.0609275214f},
-std::array<float,2>{0.117797025f, 0.124922857f},
-std::array<float,2>{0.534101725f, 0.787752628f},
-std::array<float,2>{0.384040028f, 0.653044164f},
-std::array<float,2>{0.801618576f, 0.311033279f},
-std::array<float,2>{0.291281372f, 0.454009473f},
-std::array<float,2>{0.878716767f, 0.50179112f},
-std::array<float,2>{0.134588301f, 0.990599811f},
-std::array<float,2>{0.63944906f, 0.219631717f},
-std::array<float,2>{0.353313863f, 0.228637874f},
-std::array<float,2>{0.958853006f, 0.994080484f},
-std::array<float,2>{0.209956855f, 0.512761891f},
-std::array<float,2>{0.70521462f, 0.466373026f},
-std::array<float,2>{0.0361813642f, 0.304165632f},
-std::array<float,2>{0.597969532f, 0.641906857f},
-std::array<float,2>{0.498977333f, 0.79305172f},
-std::array<float,2>{0.873500228f, 0.111016765f},
-std::array<float,2>{0.143668562f, 0.0546637103f},
-std::array<float,2>{0.656235158f, 0.848248601f},
-std::array<float,2>{0.302777767f, 0.700364649f},
-std::array<float,2>{0.905144274f, 0.355120182f},
-std::array<float,2>{0.406203985f, 0.383842021f},
-std::array<float,2>{0.78549552f, 0.624831259f},
-std::array<float,2>{0.100928523f, 0.889766276f},
-std::array<float,2>{0.549313784f, 0.174575046f},
-std::array<float,2>{0.448354036f, 0.0863635913f},
-std::array<float,2>{0.813318133f, 0.773087204f},
-std::array<float,2>{0.0190762617f, 0.657474816f},
-std::array<float,2>{0.575612426f, 0.270923644f},
-std::array<float,2>{0.242726028f, 0.495988816f},
-std::array<float,2>{0.730394363f, 0.55899334f},
-std::array<float,2>{0.343063384f, 0.957438827f},
-std::array<float,2>{0.991051078f, 0.192555428f},
-std::array<float,2>{0.0680959597f, 0.133989662f},
-std::array<float,2>{0.522403598f, 0.93440491f},
-std::array<float,2>{0.408217907f, 0.578971565f},
-std::array<float,2>{0.764155865f, 0.413790643f},
-std::array<float,2>{0.258854359f, 0.338182032f},
-std::array<float,2>{0.923098028f, 0.746139824f},
-std::array<float,2>{0.162843257f, 0.816085517f},
-std::array<float,2>{0.670736551f, 0.0162198655f},
-std::array<float,2>{0.295272499f, 0.0119240582f},
-std::array<float,2>{0.879154265f, 0.841548383f},
-std::array<float,2>{0.13845104f, 0.723035395f},
-std::array<float,2>{0.634723723f, 0.315116674f},
-std::array<float,2>{0.121194087f, 0.424026936f},
-std::array<float,2>{0.536254883f, 0.563142598f},
-std::array<float,2>{0.389460087f, 0.918138504f},
-std::array<float,2>{0.79911077f, 0.142267779f},
-std::array<float,2>{0.195511281f, 0.203394771f},
-std::array<float,2>{0.696339011f, 0.95231539f},
-std::array<float,2>{0.374191135f, 0.53130722f},
-std::array<float,2>{0.952619135f, 0.474443197f},
-std::array<float,2>{0.469433576f, 0.250234991f},
-std::array<float,2>{0.853669584f, 0.680309117f},
-std::array<float,2>{0.0508367009f, 0.762641788f},
-std::array<float,2>{0.624105394f, 0.0742123872f},
-std::array<float,2>{0.433405459f, 0.1699844f},
-std::array<float,2>{0.772982001f, 0.905818164f},
-std::array<float,2>{0.0812558159f, 0.596444845f},
-std::array<float,2>{0.501688123f, 0.391197413f},
-std::array<float,2>{0.175715134f, 0.363365293f},
-std::array<float,2>{0.678889215f, 0.713211894f},
-std::array<float,2>{0.278707147f, 0.867698193f},
-std::array<float,2>{0.921389401f, 0.0463028178f},
-std::array<float,2>{0.0114468997f, 0.108444333f},
-std::array<float,2>{0.57993871f, 0.800093114f},
-std::array<float,2>{0.466531098f, 0.629642725f},
-std::array<float,2>{0.832644999f, 0.284983218f},
-std::array<float,2>{0.318201363f, 0.445603251f},
-std::array<float,2>{0.977369249f, 0.528481722f},
-std::array<float,2>{0.234257102f, 0.978249788f},
-std::array<float,2>{0.73602283f, 0.246002257f},
-std::array<float,2>{0.266253233f, 0.149557039f},
-std::array<float,2>{0.911830723f, 0.910345852f},
-std::array<float,2>{0.181118309f, 0.573332608f},
-std::array<float,2>{0.681316316f, 0.431037724f},
-std::array<float,2>{0.0915905461f, 0.32804203f},
-std::array<float,2>{0.514196754f, 0.728209734f},
-std::array<float,2>{0.426235795f, 0.835932553f},
-std::array<float,2>{0.780147195f, 0.00222038827f},
-std::array<float,2>{0.223387465f, 0.068622686f},
-std::array<float,2>{0.748901129f, 0.751952946f},
-std::array<float,2>{0.323903412f, 0.678184807f},
-std::array<float,2>{0.974128723f, 0.264009148f},
-std::array<float,2>{0.454918802f, 0.479310334f},
-std::array<float,2>{0.837098777f, 0.544521868f},
-std::array<float,2>{0.00207300601f, 0.942076206f},
-std::array<float,2>{0.590000153f, 0.212475583f},
-std::array<float,2>{0.382448226f, 0.033235997f},
-std::array<float,2>{0.80645889f, 0.864831209f},
-std::array<float,2>{0.111534983f, 0.70552361f},
-std::array<float,2>{0.543819666f, 0.373139024f},
-std::array<float,2>{0.132574603f, 0.400696486f},
-std::array<float,2>{0.62597394f, 0.603241682f},
-std::array<float,2>{0.28758052f, 0.894605041f},
-std::array<float,2>{0.88548708f, 0.157123178f},
-std::array<float,2>{0.0556561872f, 0.235179037f},
-std::array<float,2>{0.609657764f, 0.968803108f},
-std::array<float,2>{0.481556892f, 0.516693234f},
-std::array<float,2>{0.848500609f, 0.44148621f},
-std::array<float,2>{0.360552728f, 0.290623426f},
-std::array<float,2>{0.944055617f, 0.633531749f},
-std::array<float,2>{0.190439999f, 0.808261454f},
-std::array<float,2>{0.688220918f, 0.0996722057f},
-std::array<float,2>{0.328729361f, 0.119495593f},
-std::array<float,2>{0.996581078f, 0.784608066f},
-std::array<float,2>{0.236216664f, 0.650753617f},
-std::array<float,2>{0.719037652f, 0.305005848f},
-std::array<float,2>{0.02954196f, 0.460290223f},
-std::array<float,2>{0.564428031f, 0.50437808f},
-std::array<float,2>{0.441862285f, 0.987892866f},
-std::array<float,2>{0.822628975f, 0.224047318f},
-std::array<float,2>{0.167680785f, 0.185606122f},
-std::array<float,2>{0.661814213f, 0.881472647f},
-std::array<float,2>{0.250099003f, 0.609533429f},
-std::array<float,2>{0.930373967f, 0.380577773f},
-std::array<float,2>{0.4192276f, 0.34396559f},
-std::array<float,2>{0.753346562f, 0.689855635f},
-std::array<float,2>{0.0719055086f, 0.858467519f},
-std::array<float,2>{0.529333174f, 0.0572156236f},
-std::array<float,2>{0.484475315f, 0.197196528f},
-std::array<float,2>{0.863311827f, 0.964425147f},
-std::array<float,2>{0.0460663363f, 0.552646399f},
-std::array<float,2>{0.605260074f, 0.485778779f},
-std::array<float,2>{0.217787027f, 0.274461687f},
-std::array<float,2>{0.717787862f, 0.665121734f},
-std::array<float,2>{0.34569338f, 0.773899853f},
-std::array<float,2>{0.968121648f, 0.0813116208f},
-std::array<float,2>{0.102583297f, 0.0262036063f},
-std::array<float,2>{0.55827415f, 0.820902228f},
-std::array<float,2>{0.395404249f, 0.736851454f},
-std::array<float,2>{0.789343536f, 0.333932638f},
-std::array<float,2>{0.31216675f, 0.421843052f},
-std::array<float,2>{0.895383298f, 0.588539243f},
-std::array<float,2>{0.155779347f, 0.926991582f},
-std::array<float,2>{0.644042075f, 0.126493692f},
-std::array<float,2>{0.327837318f, 0.178618282f},
-std::array<float,2>{0.969913244f, 0.885249853f},
-std::array<float,2>{0.221259624f, 0.618423045f},
-std::array<float,2>{0.743546724f, 0.38893345f},
-std::array<float,2>{0.00513965357f, 0.358630985f},
-std::array<float,2>{0.588813841f, 0.697044194f},
-std::array<float,2>{0.460173607f, 0.846629262f},
-std::array<float,2>{0.843142271f, 0.0499498881f},
-std::array<float,2>{0.187168211f, 0.113315895f},
-std::array<float,2>{0.687367141f, 0.789327383f},
-std::array<float,2>{0.270207226f, 0.648268938f},
-std::array<float,2>{0.909109294f, 0.297628969f},
-std::array<float,2>{0.423841059f, 0.461858541f},
-std::array<float,2>{0.774082005f, 0.509710848f},
-std::array<float,2>{0.0860186517f, 0.997094393f},
-std::array<float,2>{0.508903861f, 0.232965097f},
-std::array<float,2>{0.479983121f, 0.0233234279f},
-std::array<float,2>{0.844440281f, 0.816466153f},
-std::array<float,2>{0.0596464388f, 0.745010853f},
-std::array<float,2>{0.614216328f, 0.3415654f},
-std::array<float,2>{0.192699343f, 0.409280539f},
-std::array<float,2>{0.693848908f, 0.584818244f},
-std::array<float,2>{0.364179701f, 0.9305529f},
-std::array<float,2>{0.939159632f, 0.140118822f},
-std::array<float,2>{0.114991523f, 0.188069507f},
-std::array<float,2>{0.542333961f, 0.95694232f},
-std::array<float,2>{0.378279269f, 0.555707633f},
-std::array<float,2>{0.812227845f, 0.496985406f},
-std::array<float,2>{0.284998506f, 0.268793553f},
-std::array<float,2>{0.887777686f, 0.661625087f},
-std::array<float,2>{0.127640277f, 0.766149521f},
-std::array<float,2>{0.631494761f, 0.0904700309f},
-std::array<float,2>{0.254258454f, 0.0775110871f},
-std::array<float,2>{0.93650347f, 0.758754432f},
-std::array<float,2>{0.168799192f, 0.684475541f},
-std::array<float,2>{0.659548521f, 0.255371869f},
-std::array<float,2>{0.0763125941f, 0.470123857f},
-std::array<float,2>{0.52519542f, 0.538947761f},
-std::array<float,2>{0.4158234f, 0.947317183f},
-std::array<float,2>{0.756033957f, 0.207137898f},
-std::array<float,2>{0.240764946f, 0.144899964f},
-std::array<float,2>{0.726162672f, 0.917666852f},
-std::array<float,2>{0.332609564f, 0.567591131f},
-std::array<float,2>{0.994373024f, 0.426994354f},
-std::array<float,2>{0.440570235f, 0.316739023f},
-std::array<float,2>{0.827543676f, 0.719893634f},
-std::array<float,2>{0.0239978824f, 0.837993026f},
-std::array<float,2>{0.569820523f, 0.0100234617f},
-std::array<float,2>{0.391855389f, 0.247384071f},
-std::array<float,2>{0.794596612f, 0.9829548f},
-std::array<float,2>{0.109336033f, 0.524908185f},
-std::array<float,2>{0.559093118f, 0.450615227f},
-std::array<float,2>{0.152223766f, 0.288646221f},
-std::array<float,2>{0.646299183f, 0.627409697f},
-std::array<float,2>{0.307097346f, 0.801947296f},
-std::array<float,2>{0.891439021f, 0.10176374f},
-std::array<float,2>{0.0414291024f, 0.0415087715f},
-std::array<float,2>{0.608832836f, 0.871513307f},
-std::array<float,2>{0.491561294f, 0.71687603f},
-std::array<float,2>{0.860395372f, 0.362323731f},
-std::array<float,2>{0.350727201f, 0.396477938f},
-std::array<float,2>{0.961047053f, 0.599520981f},
-std::array<float,2>{0.212525934f, 0.900608003f},
-std::array<float,2>{0.714190662f, 0.164286911f},
-std::array<float,2>{0.298095852f, 0.218425155f},
-std::array<float,2>{0.900025785f, 0.938249707f},
-std::array<float,2>{0.148019373f, 0.539511919f},
-std::array<float,2>{0.650554955f, 0.48247987f},
-std::array<float,2>{0.0954629034f, 0.260822773f},
-std::array<float,2>{0.55148375f, 0.674777985f},
-std::array<float,2>{0.399442464f, 0.754171968f},
-std::array<float,2>{0.781309962f, 0.0641882271f},
-std::array<float,2>{0.205576435f, 0.00426388066f},
-std::array<float,2>{0.710837483f, 0.830003679f},
-std::array<float,2>{0.357476979f, 0.731735706f},
-std::array<float,2>{0.953769028f, 0.321908802f},
-std::array<float,2>{0.494721711f, 0.436951131f},
-std::array<float,2>{0.867412746f, 0.576888084f},
-std::array<float,2>{0.0349832028f, 0.909836531f},
-std::array<float,2>{0.594197452f, 0.15605247f},
-std::array<float,2>{0.413709402f, 0.0961532742f},
-std::array<float,2>{0.757916689f, 0.812300503f},
-std::array<float,2>{0.0636539757f, 0.638167858f},
-std::array<float,2>{0.518897712f, 0.295763671f},
-std::array<float,2>{0.15800938f, 0.439197749f},
-std::array<float,2>{0.665318131f, 0.519900203f},
-std::array<float,2>{0.265318513f, 0.974640787f},
-std::array<float,2>{0.929684877f, 0.239592344f},
-std::array<float,2>{0.019575594f, 0.163425326f},
-std::array<float,2>{0.572039783f, 0.894087791f},
-std::array<float,2>{0.451876283f, 0.606237352f},
-std::array<float,2>{0.818885505f, 0.404167622f},
-std::array<float,2>{0.337568849f, 0.370434731f},
-std::array<float,2>{0.984508276f, 0.707885325f},
-std::array<float,2>{0.247801274f, 0.862701058f},
-std::array<float,2>{0.730970621f, 0.0368394107f},
-std::array<float,2>{0.369409263f, 0.059501268f},
-std::array<float,2>{0.946226478f, 0.855268717f},
-std::array<float,2>{0.201063946f, 0.691519082f},
-std::array<float,2>{0.700364411f, 0.350694686f},
-std::array<float,2>{0.0495493077f, 0.378041923f},
-std::array<float,2>{0.61990732f, 0.616902053f},
-std::array<float,2>{0.475148559f, 0.877014041f},
-std::array<float,2>{0.857649207f, 0.181562424f},
-std::array<float,2>{0.136173248f, 0.221574694f},
-std::array<float,2>{0.638374805f, 0.989490688f},
-std::array<float,2>{0.290361345f, 0.503884852f},
-std::array<float,2>{0.875983357f, 0.455152363f},
-std::array<float,2>{0.385683358f, 0.31031251f},
-std::array<float,2>{0.803201973f, 0.65610671f},
-std::array<float,2>{0.119720556f, 0.786167502f},
-std::array<float,2>{0.532830238f, 0.122333169f},
-std::array<float,2>{0.462796241f, 0.13083756f},
-std::array<float,2>{0.831751943f, 0.923426211f},
-std::array<float,2>{0.0124804163f, 0.590466976f},
-std::array<float,2>{0.585917354f, 0.415429413f},
-std::array<float,2>{0.227300286f, 0.331479281f},
-std::array<float,2>{0.740266502f, 0.740255117f},
-std::array<float,2>{0.312945843f, 0.824415028f},
-std::array<float,2>{0.98293519f, 0.0311833806f},
-std::array<float,2>{0.085701555f, 0.0831755623f},
-std::array<float,2>{0.505586863f, 0.778728485f},
-std::array<float,2>{0.435850918f, 0.668150961f},
-std::array<float,2>{0.766769707f, 0.28059569f},
-std::array<float,2>{0.276396006f, 0.491240978f},
-std::array<float,2>{0.915976286f, 0.548135757f},
-std::array<float,2>{0.175857186f, 0.964853525f},
-std::array<float,2>{0.674285769f, 0.202114955f}}
\ No newline at end of file
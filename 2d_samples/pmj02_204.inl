@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.916562796f, 0.282106549f},
-std::array<float,2>{0.143702999f, 0.966855049f},
-std::array<float,2>{0.531049907f, 0.671297014f},
-std::array<float,2>{0.46640572f, 0.147425547f},
-std::array<float,2>{0.651064992f, 0.0603230745f},
-std::array<float,2>{0.331416786f, 0.520256996f},
-std::array<float,2>{0.756285071f, 0.762362719f},
-std::array<float,2>{0.0856944919f, 0.493941247f},
-std::array<float,2>{0.584412634f, 0.413301289f},
-std::array<float,2>{0.424144387f, 0.833702087f},
-std::array<float,2>{0.993100226f, 0.570429146f},
-std::array<float,2>{0.191626593f, 0.0840426832f},
-std::array<float,2>{0.830320656f, 0.205673099f},
-std::array<float,2>{0.0448245443f, 0.698216498f},
-std::array<float,2>{0.739462316f, 0.924126446f},
-std::array<float,2>{0.302352011f, 0.370070666f},
-std::array<float,2>{0.793615222f, 0.46249038f},
-std::array<float,2>{0.110793903f, 0.791112661f},
-std::array<float,2>{0.670736432f, 0.560086071f},
-std::array<float,2>{0.356961876f, 0.0149608217f},
-std::array<float,2>{0.556107163f, 0.170828164f},
-std::array<float,2>{0.476994932f, 0.655094385f},
-std::array<float,2>{0.881217301f, 0.974657178f},
-std::array<float,2>{0.17156139f, 0.273746073f},
-std::array<float,2>{0.704767346f, 0.315168381f},
-std::array<float,2>{0.251256347f, 0.903631985f},
-std::array<float,2>{0.853800595f, 0.738979757f},
-std::array<float,2>{0.00942342822f, 0.240109161f},
-std::array<float,2>{0.942251921f, 0.120427884f},
-std::array<float,2>{0.225829899f, 0.620448887f},
-std::array<float,2>{0.596914947f, 0.848627806f},
-std::array<float,2>{0.378820121f, 0.398550302f},
-std::array<float,2>{0.981151462f, 0.375001848f},
-std::array<float,2>{0.216202885f, 0.870117664f},
-std::array<float,2>{0.56442219f, 0.602887213f},
-std::array<float,2>{0.407026976f, 0.095840551f},
-std::array<float,2>{0.725776255f, 0.234079719f},
-std::array<float,2>{0.286691815f, 0.720259249f},
-std::array<float,2>{0.821245253f, 0.879159391f},
-std::array<float,2>{0.0478963815f, 0.329775482f},
-std::array<float,2>{0.502816916f, 0.258199781f},
-std::array<float,2>{0.448615313f, 0.984759927f},
-std::array<float,2>{0.929539084f, 0.635171652f},
-std::array<float,2>{0.13675347f, 0.183059514f},
-std::array<float,2>{0.769312024f, 0.0241960455f},
-std::array<float,2>{0.0705975816f, 0.538332105f},
-std::array<float,2>{0.632240772f, 0.800817847f},
-std::array<float,2>{0.322843343f, 0.447479308f},
-std::array<float,2>{0.860877872f, 0.351211369f},
-std::array<float,2>{0.0222343113f, 0.906889737f},
-std::array<float,2>{0.691453874f, 0.714301527f},
-std::array<float,2>{0.280178279f, 0.196718499f},
-std::array<float,2>{0.621083617f, 0.0694468617f},
-std::array<float,2>{0.401724756f, 0.590397656f},
-std::array<float,2>{0.966019928f, 0.821551681f},
-std::array<float,2>{0.239448652f, 0.426436722f},
-std::array<float,2>{0.680925906f, 0.481670707f},
-std::array<float,2>{0.367495805f, 0.772592366f},
-std::array<float,2>{0.802435935f, 0.505778193f},
-std::array<float,2>{0.107259832f, 0.0427783094f},
-std::array<float,2>{0.892224193f, 0.131413624f},
-std::array<float,2>{0.183115512f, 0.681474447f},
-std::array<float,2>{0.536205947f, 0.951289833f},
-std::array<float,2>{0.488288134f, 0.306516975f},
-std::array<float,2>{0.958074331f, 0.337637424f},
-std::array<float,2>{0.246589422f, 0.885830998f},
-std::array<float,2>{0.611119986f, 0.726976097f},
-std::array<float,2>{0.397612125f, 0.22425051f},
-std::array<float,2>{0.702085793f, 0.103998467f},
-std::array<float,2>{0.270313144f, 0.59697473f},
-std::array<float,2>{0.874309957f, 0.859987736f},
-std::array<float,2>{0.0288057681f, 0.384712607f},
-std::array<float,2>{0.542753518f, 0.443601429f},
-std::array<float,2>{0.492614388f, 0.811198652f},
-std::array<float,2>{0.899132252f, 0.542525351f},
-std::array<float,2>{0.178394198f, 0.0213896148f},
-std::array<float,2>{0.805852771f, 0.178487822f},
-std::array<float,2>{0.0938069746f, 0.626280308f},
-std::array<float,2>{0.676245868f, 0.992520213f},
-std::array<float,2>{0.363257855f, 0.255700141f},
-std::array<float,2>{0.813782394f, 0.436210543f},
-std::array<float,2>{0.0553379394f, 0.813505709f},
-std::array<float,2>{0.727610409f, 0.583030403f},
-std::array<float,2>{0.291452259f, 0.0710536763f},
-std::array<float,2>{0.57078582f, 0.194225729f},
-std::array<float,2>{0.416504115f, 0.705768704f},
-std::array<float,2>{0.969456732f, 0.914695501f},
-std::array<float,2>{0.20919916f, 0.352075577f},
-std::array<float,2>{0.638147533f, 0.297808856f},
-std::array<float,2>{0.317095548f, 0.939220726f},
-std::array<float,2>{0.780690789f, 0.675311208f},
-std::array<float,2>{0.0645891801f, 0.137547001f},
-std::array<float,2>{0.936302304f, 0.037587326f},
-std::array<float,2>{0.131318748f, 0.50949347f},
-std::array<float,2>{0.513927579f, 0.775955498f},
-std::array<float,2>{0.44204998f, 0.47244212f},
-std::array<float,2>{0.885538936f, 0.488453567f},
-std::array<float,2>{0.156925842f, 0.750083685f},
-std::array<float,2>{0.553542852f, 0.525184035f},
-std::array<float,2>{0.474715412f, 0.0472332351f},
-std::array<float,2>{0.656531692f, 0.155882135f},
-std::array<float,2>{0.346531212f, 0.659214914f},
-std::array<float,2>{0.785618305f, 0.95783782f},
-std::array<float,2>{0.120049238f, 0.292483568f},
-std::array<float,2>{0.603942573f, 0.362960249f},
-std::array<float,2>{0.386190236f, 0.936055958f},
-std::array<float,2>{0.95196408f, 0.693856597f},
-std::array<float,2>{0.233017743f, 0.211410508f},
-std::array<float,2>{0.845837533f, 0.0886973217f},
-std::array<float,2>{0.00104550086f, 0.568504274f},
-std::array<float,2>{0.713122129f, 0.843487322f},
-std::array<float,2>{0.262812972f, 0.41991955f},
-std::array<float,2>{0.764532387f, 0.271692574f},
-std::array<float,2>{0.0896271467f, 0.983600795f},
-std::array<float,2>{0.641247749f, 0.645397305f},
-std::array<float,2>{0.338555664f, 0.156390533f},
-std::array<float,2>{0.520372391f, 0.00707281893f},
-std::array<float,2>{0.460329771f, 0.552546501f},
-std::array<float,2>{0.908540189f, 0.782124817f},
-std::array<float,2>{0.149354771f, 0.456780136f},
-std::array<float,2>{0.743218303f, 0.392607421f},
-std::array<float,2>{0.312035799f, 0.85679245f},
-std::array<float,2>{0.841140926f, 0.611604393f},
-std::array<float,2>{0.0375738256f, 0.113393947f},
-std::array<float,2>{0.989895761f, 0.249496654f},
-std::array<float,2>{0.197896615f, 0.745623469f},
-std::array<float,2>{0.588903308f, 0.894223273f},
-std::array<float,2>{0.43629995f, 0.327262938f},
-std::array<float,2>{0.997677743f, 0.250442594f},
-std::array<float,2>{0.190681472f, 0.998504162f},
-std::array<float,2>{0.581344068f, 0.62934494f},
-std::array<float,2>{0.426366359f, 0.17198135f},
-std::array<float,2>{0.73648864f, 0.0157106537f},
-std::array<float,2>{0.300582141f, 0.545089245f},
-std::array<float,2>{0.835608721f, 0.807496727f},
-std::array<float,2>{0.0414536782f, 0.438151836f},
-std::array<float,2>{0.526155114f, 0.389215648f},
-std::array<float,2>{0.463075429f, 0.867147982f},
-std::array<float,2>{0.91806376f, 0.600079f},
-std::array<float,2>{0.145796731f, 0.105733633f},
-std::array<float,2>{0.752772272f, 0.221933663f},
-std::array<float,2>{0.0788106248f, 0.731882036f},
-std::array<float,2>{0.654288352f, 0.890339196f},
-std::array<float,2>{0.332723767f, 0.342520893f},
-std::array<float,2>{0.856524467f, 0.474604815f},
-std::array<float,2>{0.0148172528f, 0.77734828f},
-std::array<float,2>{0.708544016f, 0.515480578f},
-std::array<float,2>{0.255492538f, 0.0329802856f},
-std::array<float,2>{0.598113835f, 0.133444369f},
-std::array<float,2>{0.378928661f, 0.679613471f},
-std::array<float,2>{0.940046549f, 0.941925287f},
-std::array<float,2>{0.219918758f, 0.302854091f},
-std::array<float,2>{0.664389849f, 0.355758905f},
-std::array<float,2>{0.353640586f, 0.918302476f},
-std::array<float,2>{0.79057622f, 0.707695365f},
-std::array<float,2>{0.117006332f, 0.190331012f},
-std::array<float,2>{0.876641631f, 0.0780623108f},
-std::array<float,2>{0.167479202f, 0.580831468f},
-std::array<float,2>{0.562435806f, 0.817015409f},
-std::array<float,2>{0.483648986f, 0.431211323f},
-std::array<float,2>{0.924360633f, 0.414184958f},
-std::array<float,2>{0.136317685f, 0.837377906f},
-std::array<float,2>{0.505250096f, 0.566026866f},
-std::array<float,2>{0.450230181f, 0.0934678689f},
-std::array<float,2>{0.628487766f, 0.217364624f},
-std::array<float,2>{0.325704008f, 0.688145459f},
-std::array<float,2>{0.772950947f, 0.932180524f},
-std::array<float,2>{0.0767083019f, 0.364552021f},
-std::array<float,2>{0.57001555f, 0.295434296f},
-std::array<float,2>{0.41175434f, 0.955408454f},
-std::array<float,2>{0.978396893f, 0.663612485f},
-std::array<float,2>{0.21461986f, 0.149302587f},
-std::array<float,2>{0.825051963f, 0.0539906174f},
-std::array<float,2>{0.0512696952f, 0.528520286f},
-std::array<float,2>{0.72042942f, 0.754475057f},
-std::array<float,2>{0.28435573f, 0.485479534f},
-std::array<float,2>{0.800202668f, 0.32271865f},
-std::array<float,2>{0.102237269f, 0.898050308f},
-std::array<float,2>{0.686251462f, 0.746699572f},
-std::array<float,2>{0.374880105f, 0.245078459f},
-std::array<float,2>{0.535026252f, 0.112606652f},
-std::array<float,2>{0.48708418f, 0.615868628f},
-std::array<float,2>{0.897850513f, 0.851578176f},
-std::array<float,2>{0.184885547f, 0.398274869f},
-std::array<float,2>{0.690643907f, 0.459064513f},
-std::array<float,2>{0.274743885f, 0.786447227f},
-std::array<float,2>{0.866484165f, 0.550161183f},
-std::array<float,2>{0.0158321615f, 0.000723117439f},
-std::array<float,2>{0.962354422f, 0.163289964f},
-std::array<float,2>{0.236101583f, 0.643832266f},
-std::array<float,2>{0.624526501f, 0.979643166f},
-std::array<float,2>{0.405532509f, 0.265955627f},
-std::array<float,2>{0.905101001f, 0.372153223f},
-std::array<float,2>{0.173131689f, 0.92954123f},
-std::array<float,2>{0.546126664f, 0.699765801f},
-std::array<float,2>{0.499175429f, 0.210568473f},
-std::array<float,2>{0.67268014f, 0.0781353414f},
-std::array<float,2>{0.36590305f, 0.576258242f},
-std::array<float,2>{0.809584916f, 0.830890656f},
-std::array<float,2>{0.0982344076f, 0.406830639f},
-std::array<float,2>{0.61623925f, 0.497147858f},
-std::array<float,2>{0.392857075f, 0.761200488f},
-std::array<float,2>{0.955179393f, 0.516473532f},
-std::array<float,2>{0.245911703f, 0.0572987497f},
-std::array<float,2>{0.869390011f, 0.141968757f},
-std::array<float,2>{0.0269983243f, 0.665753245f},
-std::array<float,2>{0.695525885f, 0.962810516f},
-std::array<float,2>{0.26680854f, 0.288572639f},
-std::array<float,2>{0.774019659f, 0.403567135f},
-std::array<float,2>{0.0668811575f, 0.844203353f},
-std::array<float,2>{0.633159518f, 0.623606205f},
-std::array<float,2>{0.315104693f, 0.122295626f},
-std::array<float,2>{0.508738995f, 0.234586194f},
-std::array<float,2>{0.440282673f, 0.736004531f},
-std::array<float,2>{0.931763589f, 0.901943624f},
-std::array<float,2>{0.126526251f, 0.318234891f},
-std::array<float,2>{0.732884824f, 0.281232506f},
-std::array<float,2>{0.293934375f, 0.969639063f},
-std::array<float,2>{0.818880498f, 0.651601315f},
-std::array<float,2>{0.0591371842f, 0.165555462f},
-std::array<float,2>{0.97624594f, 0.0114132566f},
-std::array<float,2>{0.205071107f, 0.555375636f},
-std::array<float,2>{0.575227022f, 0.796786547f},
-std::array<float,2>{0.421778947f, 0.467426181f},
-std::array<float,2>{0.947751462f, 0.450963616f},
-std::array<float,2>{0.229827493f, 0.797225058f},
-std::array<float,2>{0.607217908f, 0.534412563f},
-std::array<float,2>{0.389949292f, 0.0289664287f},
-std::array<float,2>{0.717900097f, 0.186856523f},
-std::array<float,2>{0.260766774f, 0.640257716f},
-std::array<float,2>{0.849792719f, 0.988347411f},
-std::array<float,2>{0.00586416526f, 0.263227642f},
-std::array<float,2>{0.547802567f, 0.333626956f},
-std::array<float,2>{0.470528275f, 0.876247883f},
-std::array<float,2>{0.887319386f, 0.72469008f},
-std::array<float,2>{0.160954699f, 0.229953438f},
-std::array<float,2>{0.783594131f, 0.0980044678f},
-std::array<float,2>{0.12179181f, 0.607254088f},
-std::array<float,2>{0.663502336f, 0.873984039f},
-std::array<float,2>{0.347677231f, 0.380777389f},
-std::array<float,2>{0.838311434f, 0.310441643f},
-std::array<float,2>{0.0334707201f, 0.949171901f},
-std::array<float,2>{0.74904871f, 0.687321067f},
-std::array<float,2>{0.308270395f, 0.125198364f},
-std::array<float,2>{0.59293139f, 0.0436916836f},
-std::array<float,2>{0.429941237f, 0.502331376f},
-std::array<float,2>{0.988070428f, 0.767052591f},
-std::array<float,2>{0.200526536f, 0.480339944f},
-std::array<float,2>{0.645724714f, 0.425668687f},
-std::array<float,2>{0.341136813f, 0.827133179f},
-std::array<float,2>{0.759892166f, 0.587819874f},
-std::array<float,2>{0.0913683921f, 0.0658299103f},
-std::array<float,2>{0.914003849f, 0.202775016f},
-std::array<float,2>{0.152482554f, 0.715871394f},
-std::array<float,2>{0.516428649f, 0.913761079f},
-std::array<float,2>{0.455619901f, 0.345687151f},
-std::array<float,2>{0.879083812f, 0.275740772f},
-std::array<float,2>{0.168648034f, 0.974157631f},
-std::array<float,2>{0.558582485f, 0.65241605f},
-std::array<float,2>{0.480081379f, 0.169302732f},
-std::array<float,2>{0.669801354f, 0.0130312713f},
-std::array<float,2>{0.358397424f, 0.561455965f},
-std::array<float,2>{0.796074986f, 0.790884018f},
-std::array<float,2>{0.112588279f, 0.463827908f},
-std::array<float,2>{0.594055653f, 0.40215081f},
-std::array<float,2>{0.375436038f, 0.849984467f},
-std::array<float,2>{0.944459975f, 0.617485762f},
-std::array<float,2>{0.223208472f, 0.119102187f},
-std::array<float,2>{0.853311539f, 0.241530806f},
-std::array<float,2>{0.0113640754f, 0.742170274f},
-std::array<float,2>{0.70631659f, 0.905978382f},
-std::array<float,2>{0.252816617f, 0.312671512f},
-std::array<float,2>{0.755657673f, 0.494196624f},
-std::array<float,2>{0.0835683867f, 0.763869464f},
-std::array<float,2>{0.649504721f, 0.52206099f},
-std::array<float,2>{0.329057902f, 0.0613959283f},
-std::array<float,2>{0.527834952f, 0.145431533f},
-std::array<float,2>{0.467963696f, 0.668164253f},
-std::array<float,2>{0.915077031f, 0.96602577f},
-std::array<float,2>{0.140693054f, 0.28322506f},
-std::array<float,2>{0.741789758f, 0.368504345f},
-std::array<float,2>{0.304013491f, 0.923347771f},
-std::array<float,2>{0.828383386f, 0.69634825f},
-std::array<float,2>{0.0461637601f, 0.203347683f},
-std::array<float,2>{0.994468212f, 0.0826251805f},
-std::array<float,2>{0.194325224f, 0.572629988f},
-std::array<float,2>{0.583160996f, 0.834779441f},
-std::array<float,2>{0.422531039f, 0.411867797f},
-std::array<float,2>{0.967355967f, 0.429579288f},
-std::array<float,2>{0.240460664f, 0.823857903f},
-std::array<float,2>{0.61773324f, 0.592101634f},
-std::array<float,2>{0.399069637f, 0.0670190603f},
-std::array<float,2>{0.694361866f, 0.197803974f},
-std::array<float,2>{0.278455317f, 0.71178472f},
-std::array<float,2>{0.863054156f, 0.909745097f},
-std::array<float,2>{0.0208143312f, 0.349453539f},
-std::array<float,2>{0.538464963f, 0.306900591f},
-std::array<float,2>{0.492048442f, 0.950375438f},
-std::array<float,2>{0.892785072f, 0.682493865f},
-std::array<float,2>{0.179796085f, 0.129810244f},
-std::array<float,2>{0.803659797f, 0.0399686024f},
-std::array<float,2>{0.108745441f, 0.50667572f},
-std::array<float,2>{0.682182133f, 0.76978147f},
-std::array<float,2>{0.369903743f, 0.483860284f},
-std::array<float,2>{0.822606981f, 0.330485284f},
-std::array<float,2>{0.0504654869f, 0.882098198f},
-std::array<float,2>{0.723833859f, 0.721824586f},
-std::array<float,2>{0.288272142f, 0.231233567f},
-std::array<float,2>{0.564520895f, 0.0943388268f},
-std::array<float,2>{0.410015047f, 0.604857802f},
-std::array<float,2>{0.983068347f, 0.867790163f},
-std::array<float,2>{0.216853961f, 0.377978444f},
-std::array<float,2>{0.63066566f, 0.445358485f},
-std::array<float,2>{0.321396887f, 0.804336131f},
-std::array<float,2>{0.76644063f, 0.535692394f},
-std::array<float,2>{0.0728252828f, 0.0263027214f},
-std::array<float,2>{0.926225662f, 0.181211352f},
-std::array<float,2>{0.139027059f, 0.634231269f},
-std::array<float,2>{0.50090003f, 0.986951768f},
-std::array<float,2>{0.446361363f, 0.260324806f},
-std::array<float,2>{0.971519172f, 0.355095834f},
-std::array<float,2>{0.208402455f, 0.916350543f},
-std::array<float,2>{0.572622836f, 0.703702629f},
-std::array<float,2>{0.414321512f, 0.192636147f},
-std::array<float,2>{0.729349434f, 0.072782591f},
-std::array<float,2>{0.289892703f, 0.584607959f},
-std::array<float,2>{0.815223098f, 0.816290855f},
-std::array<float,2>{0.058045879f, 0.435383469f},
-std::array<float,2>{0.512053251f, 0.470416307f},
-std::array<float,2>{0.44438988f, 0.774436176f},
-std::array<float,2>{0.934650958f, 0.50978142f},
-std::array<float,2>{0.129760176f, 0.0359955691f},
-std::array<float,2>{0.779230714f, 0.139201805f},
-std::array<float,2>{0.0636303797f, 0.672968984f},
-std::array<float,2>{0.639529586f, 0.940610588f},
-std::array<float,2>{0.320099384f, 0.300044119f},
-std::array<float,2>{0.871502221f, 0.386681557f},
-std::array<float,2>{0.0308664385f, 0.862613976f},
-std::array<float,2>{0.701051354f, 0.59379375f},
-std::array<float,2>{0.273069113f, 0.102126621f},
-std::array<float,2>{0.611588299f, 0.225641757f},
-std::array<float,2>{0.395344734f, 0.729203045f},
-std::array<float,2>{0.960474849f, 0.884519637f},
-std::array<float,2>{0.248680174f, 0.338898391f},
-std::array<float,2>{0.679035306f, 0.256585062f},
-std::array<float,2>{0.360338598f, 0.994161069f},
-std::array<float,2>{0.808538854f, 0.628192961f},
-std::array<float,2>{0.0965073779f, 0.176331684f},
-std::array<float,2>{0.902138054f, 0.0228820685f},
-std::array<float,2>{0.176941916f, 0.54079026f},
-std::array<float,2>{0.539739132f, 0.809882522f},
-std::array<float,2>{0.495938867f, 0.44173196f},
-std::array<float,2>{0.907725215f, 0.453775287f},
-std::array<float,2>{0.15157862f, 0.784692824f},
-std::array<float,2>{0.522793293f, 0.553364873f},
-std::array<float,2>{0.458151221f, 0.0055522942f},
-std::array<float,2>{0.642685056f, 0.159421489f},
-std::array<float,2>{0.337096065f, 0.647210479f},
-std::array<float,2>{0.763443351f, 0.982102394f},
-std::array<float,2>{0.0861997455f, 0.271076798f},
-std::array<float,2>{0.587111771f, 0.324884087f},
-std::array<float,2>{0.434365243f, 0.891866148f},
-std::array<float,2>{0.991734385f, 0.743210316f},
-std::array<float,2>{0.196529478f, 0.247754261f},
-std::array<float,2>{0.8435058f, 0.116650507f},
-std::array<float,2>{0.0364188552f, 0.611116052f},
-std::array<float,2>{0.745337486f, 0.858925581f},
-std::array<float,2>{0.309400678f, 0.392263949f},
-std::array<float,2>{0.788776815f, 0.28919968f},
-std::array<float,2>{0.118281566f, 0.959892452f},
-std::array<float,2>{0.659897149f, 0.656746387f},
-std::array<float,2>{0.344695538f, 0.153157473f},
-std::array<float,2>{0.55244714f, 0.0492970347f},
-std::array<float,2>{0.473273635f, 0.525915027f},
-std::array<float,2>{0.883689582f, 0.752644122f},
-std::array<float,2>{0.159831241f, 0.490552276f},
-std::array<float,2>{0.711664498f, 0.421173096f},
-std::array<float,2>{0.26427266f, 0.840833008f},
-std::array<float,2>{0.844391823f, 0.566663921f},
-std::array<float,2>{0.00352943549f, 0.0869552493f},
-std::array<float,2>{0.950347781f, 0.214808553f},
-std::array<float,2>{0.232369483f, 0.691927552f},
-std::array<float,2>{0.602805555f, 0.935095131f},
-std::array<float,2>{0.384605855f, 0.36087212f},
-std::array<float,2>{0.93871361f, 0.301606029f},
-std::array<float,2>{0.221220121f, 0.945239186f},
-std::array<float,2>{0.600672305f, 0.676349819f},
-std::array<float,2>{0.382283777f, 0.135859221f},
-std::array<float,2>{0.709469557f, 0.0350322016f},
-std::array<float,2>{0.257316977f, 0.512232363f},
-std::array<float,2>{0.858889997f, 0.780234218f},
-std::array<float,2>{0.0125219151f, 0.475949556f},
-std::array<float,2>{0.55897671f, 0.431738377f},
-std::array<float,2>{0.481464505f, 0.819146335f},
-std::array<float,2>{0.878676713f, 0.579835951f},
-std::array<float,2>{0.165281862f, 0.0749562085f},
-std::array<float,2>{0.79175818f, 0.188177049f},
-std::array<float,2>{0.113923468f, 0.709585965f},
-std::array<float,2>{0.667275012f, 0.920955062f},
-std::array<float,2>{0.353123337f, 0.358135343f},
-std::array<float,2>{0.833315074f, 0.439773798f},
-std::array<float,2>{0.0396477021f, 0.805121005f},
-std::array<float,2>{0.734575629f, 0.543170333f},
-std::array<float,2>{0.298430741f, 0.0184968971f},
-std::array<float,2>{0.579494238f, 0.174218923f},
-std::array<float,2>{0.428118825f, 0.631596684f},
-std::array<float,2>{0.999192715f, 0.996425867f},
-std::array<float,2>{0.188494787f, 0.253060579f},
-std::array<float,2>{0.655003488f, 0.341721922f},
-std::array<float,2>{0.335430831f, 0.887296021f},
-std::array<float,2>{0.750351965f, 0.732860804f},
-std::array<float,2>{0.0808346793f, 0.219859526f},
-std::array<float,2>{0.921737909f, 0.108318806f},
-std::array<float,2>{0.147470906f, 0.598389447f},
-std::array<float,2>{0.52403301f, 0.864908397f},
-std::array<float,2>{0.461410969f, 0.387041479f},
-std::array<float,2>{0.895339131f, 0.396246314f},
-std::array<float,2>{0.187323615f, 0.854252398f},
-std::array<float,2>{0.532723069f, 0.613788068f},
-std::array<float,2>{0.485092103f, 0.110897191f},
-std::array<float,2>{0.683928967f, 0.242324516f},
-std::array<float,2>{0.372735202f, 0.749418676f},
-std::array<float,2>{0.796963096f, 0.89609164f},
-std::array<float,2>{0.104395904f, 0.32095772f},
-std::array<float,2>{0.62116462f, 0.268610269f},
-std::array<float,2>{0.403340995f, 0.977362216f},
-std::array<float,2>{0.963413835f, 0.642388225f},
-std::array<float,2>{0.236856535f, 0.161416635f},
-std::array<float,2>{0.864497721f, 0.00214866945f},
-std::array<float,2>{0.0182812959f, 0.548026919f},
-std::array<float,2>{0.688702941f, 0.787347794f},
-std::array<float,2>{0.276161313f, 0.457543671f},
-std::array<float,2>{0.77092123f, 0.366029054f},
-std::array<float,2>{0.0757552609f, 0.930873394f},
-std::array<float,2>{0.626930416f, 0.689924836f},
-std::array<float,2>{0.326993823f, 0.215533838f},
-std::array<float,2>{0.505909383f, 0.0914628357f},
-std::array<float,2>{0.451177746f, 0.56354481f},
-std::array<float,2>{0.922321498f, 0.839632869f},
-std::array<float,2>{0.134415641f, 0.416079909f},
-std::array<float,2>{0.7223562f, 0.487614214f},
-std::array<float,2>{0.281940371f, 0.757077098f},
-std::array<float,2>{0.82729733f, 0.530906796f},
-std::array<float,2>{0.0543768965f, 0.0523177721f},
-std::array<float,2>{0.980429649f, 0.151768059f},
-std::array<float,2>{0.212103248f, 0.661313713f},
-std::array<float,2>{0.567661405f, 0.954118252f},
-std::array<float,2>{0.4123061f, 0.293828249f},
-std::array<float,2>{0.931402326f, 0.319752544f},
-std::array<float,2>{0.127438709f, 0.899501979f},
-std::array<float,2>{0.51158905f, 0.736873806f},
-std::array<float,2>{0.437612206f, 0.236674219f},
-std::array<float,2>{0.635862112f, 0.123741128f},
-std::array<float,2>{0.313519448f, 0.622983098f},
-std::array<float,2>{0.776302993f, 0.847164035f},
-std::array<float,2>{0.0698914975f, 0.406106859f},
-std::array<float,2>{0.576299727f, 0.465445191f},
-std::array<float,2>{0.41809234f, 0.793371022f},
-std::array<float,2>{0.974491835f, 0.5568887f},
-std::array<float,2>{0.205398902f, 0.00968881696f},
-std::array<float,2>{0.817892075f, 0.166359052f},
-std::array<float,2>{0.0611930527f, 0.650346279f},
-std::array<float,2>{0.731663883f, 0.972066402f},
-std::array<float,2>{0.294968635f, 0.278618962f},
-std::array<float,2>{0.81183517f, 0.408463925f},
-std::array<float,2>{0.100368306f, 0.829193354f},
-std::array<float,2>{0.674854159f, 0.575800419f},
-std::array<float,2>{0.364665359f, 0.0818697885f},
-std::array<float,2>{0.543667078f, 0.208839953f},
-std::array<float,2>{0.497237653f, 0.703093588f},
-std::array<float,2>{0.903104126f, 0.927476346f},
-std::array<float,2>{0.17541641f, 0.37445426f},
-std::array<float,2>{0.69794935f, 0.286957145f},
-std::array<float,2>{0.268956721f, 0.963527083f},
-std::array<float,2>{0.868650556f, 0.667430758f},
-std::array<float,2>{0.0234486908f, 0.144229293f},
-std::array<float,2>{0.953835726f, 0.0551248714f},
-std::array<float,2>{0.243198827f, 0.519049942f},
-std::array<float,2>{0.614223421f, 0.758204937f},
-std::array<float,2>{0.391942173f, 0.49839586f},
-std::array<float,2>{0.986170471f, 0.477723718f},
-std::array<float,2>{0.201655969f, 0.768136322f},
-std::array<float,2>{0.591777444f, 0.500502706f},
-std::array<float,2>{0.432613403f, 0.0453157201f},
-std::array<float,2>{0.746142983f, 0.128804639f},
-std::array<float,2>{0.305884331f, 0.683806539f},
-std::array<float,2>{0.837724745f, 0.94676429f},
-std::array<float,2>{0.0313491784f, 0.310566187f},
-std::array<float,2>{0.519188821f, 0.346907556f},
-std::array<float,2>{0.454153657f, 0.910884976f},
-std::array<float,2>{0.910160959f, 0.718726516f},
-std::array<float,2>{0.154566392f, 0.200217649f},
-std::array<float,2>{0.758735836f, 0.0642315894f},
-std::array<float,2>{0.0919861048f, 0.589027941f},
-std::array<float,2>{0.64682585f, 0.826029718f},
-std::array<float,2>{0.341942519f, 0.423581481f},
-std::array<float,2>{0.849597812f, 0.264362484f},
-std::array<float,2>{0.00450101122f, 0.990701437f},
-std::array<float,2>{0.716588736f, 0.638650775f},
-std::array<float,2>{0.258908242f, 0.184099033f},
-std::array<float,2>{0.608414114f, 0.0306046512f},
-std::array<float,2>{0.388468266f, 0.531978309f},
-std::array<float,2>{0.947204709f, 0.800186574f},
-std::array<float,2>{0.227180526f, 0.451657712f},
-std::array<float,2>{0.661910295f, 0.382649451f},
-std::array<float,2>{0.350847304f, 0.872037947f},
-std::array<float,2>{0.781516135f, 0.608821094f},
-std::array<float,2>{0.123659469f, 0.100005716f},
-std::array<float,2>{0.890055358f, 0.227416471f},
-std::array<float,2>{0.163845465f, 0.724515676f},
-std::array<float,2>{0.550064862f, 0.87822777f},
-std::array<float,2>{0.471198022f, 0.335206419f},
-std::array<float,2>{0.894470036f, 0.304755807f},
-std::array<float,2>{0.180945858f, 0.952276945f},
-std::array<float,2>{0.537674665f, 0.679940403f},
-std::array<float,2>{0.490389407f, 0.132535651f},
-std::array<float,2>{0.683152497f, 0.0417705961f},
-std::array<float,2>{0.370277226f, 0.504196465f},
-std::array<float,2>{0.804167032f, 0.772372127f},
-std::array<float,2>{0.107450314f, 0.480528444f},
-std::array<float,2>{0.618417442f, 0.426941186f},
-std::array<float,2>{0.399951279f, 0.820639491f},
-std::array<float,2>{0.968199134f, 0.591104627f},
-std::array<float,2>{0.24127008f, 0.0692673996f},
-std::array<float,2>{0.861411154f, 0.196155787f},
-std::array<float,2>{0.0204675999f, 0.713110566f},
-std::array<float,2>{0.69394362f, 0.907992661f},
-std::array<float,2>{0.277491301f, 0.349936515f},
-std::array<float,2>{0.766727686f, 0.448319644f},
-std::array<float,2>{0.0734151974f, 0.801974297f},
-std::array<float,2>{0.629851758f, 0.537562907f},
-std::array<float,2>{0.320645303f, 0.0251376312f},
-std::array<float,2>{0.501550019f, 0.182536319f},
-std::array<float,2>{0.445515573f, 0.63579601f},
-std::array<float,2>{0.92760098f, 0.985885501f},
-std::array<float,2>{0.140483275f, 0.259400189f},
-std::array<float,2>{0.722976565f, 0.328340918f},
-std::array<float,2>{0.288062632f, 0.880169451f},
-std::array<float,2>{0.823498011f, 0.719580948f},
-std::array<float,2>{0.0495320931f, 0.233359456f},
-std::array<float,2>{0.983552635f, 0.0970037207f},
-std::array<float,2>{0.218489677f, 0.602265358f},
-std::array<float,2>{0.565606058f, 0.869602978f},
-std::array<float,2>{0.408492178f, 0.376264125f},
-std::array<float,2>{0.943412304f, 0.399872035f},
-std::array<float,2>{0.223834231f, 0.849352717f},
-std::array<float,2>{0.595318675f, 0.619866848f},
-std::array<float,2>{0.376952827f, 0.119758196f},
-std::array<float,2>{0.705956519f, 0.238396361f},
-std::array<float,2>{0.253798068f, 0.740165412f},
-std::array<float,2>{0.851576269f, 0.902915776f},
-std::array<float,2>{0.0106918607f, 0.315859437f},
-std::array<float,2>{0.556935847f, 0.275187045f},
-std::array<float,2>{0.478875965f, 0.975862563f},
-std::array<float,2>{0.88023603f, 0.655765593f},
-std::array<float,2>{0.16908963f, 0.171749711f},
-std::array<float,2>{0.795847118f, 0.0140351681f},
-std::array<float,2>{0.111469485f, 0.559038997f},
-std::array<float,2>{0.668226123f, 0.792240441f},
-std::array<float,2>{0.359216064f, 0.461868912f},
-std::array<float,2>{0.829252124f, 0.370883375f},
-std::array<float,2>{0.0456669144f, 0.925594568f},
-std::array<float,2>{0.7402547f, 0.698471844f},
-std::array<float,2>{0.302833766f, 0.206137881f},
-std::array<float,2>{0.582682252f, 0.0851660073f},
-std::array<float,2>{0.423413575f, 0.571933627f},
-std::array<float,2>{0.995316803f, 0.832362533f},
-std::array<float,2>{0.194421813f, 0.41295436f},
-std::array<float,2>{0.648792505f, 0.493077397f},
-std::array<float,2>{0.329156429f, 0.762716472f},
-std::array<float,2>{0.754349709f, 0.520517051f},
-std::array<float,2>{0.0821652636f, 0.0590814501f},
-std::array<float,2>{0.914419234f, 0.147632033f},
-std::array<float,2>{0.141779035f, 0.670226574f},
-std::array<float,2>{0.52920723f, 0.968415499f},
-std::array<float,2>{0.467475086f, 0.282464713f},
-std::array<float,2>{0.990674675f, 0.326327533f},
-std::array<float,2>{0.196160495f, 0.893046319f},
-std::array<float,2>{0.586361766f, 0.744436681f},
-std::array<float,2>{0.435137957f, 0.248355776f},
-std::array<float,2>{0.744212985f, 0.114478156f},
-std::array<float,2>{0.309830368f, 0.61259532f},
-std::array<float,2>{0.84240216f, 0.856308103f},
-std::array<float,2>{0.0356182382f, 0.3937217f},
-std::array<float,2>{0.521850467f, 0.455744386f},
-std::array<float,2>{0.457634151f, 0.782348454f},
-std::array<float,2>{0.907122552f, 0.551281452f},
-std::array<float,2>{0.15043658f, 0.00594711676f},
-std::array<float,2>{0.762064576f, 0.157387942f},
-std::array<float,2>{0.0874025375f, 0.645825207f},
-std::array<float,2>{0.644046128f, 0.982653022f},
-std::array<float,2>{0.336678803f, 0.273351312f},
-std::array<float,2>{0.844823956f, 0.418394238f},
-std::array<float,2>{0.00201351312f, 0.842768431f},
-std::array<float,2>{0.712072074f, 0.569847524f},
-std::array<float,2>{0.265011132f, 0.089482531f},
-std::array<float,2>{0.601690054f, 0.212118343f},
-std::array<float,2>{0.383657545f, 0.695061505f},
-std::array<float,2>{0.950063944f, 0.936973333f},
-std::array<float,2>{0.230533138f, 0.362199396f},
-std::array<float,2>{0.658340871f, 0.291329563f},
-std::array<float,2>{0.345469177f, 0.95853883f},
-std::array<float,2>{0.787550926f, 0.658530891f},
-std::array<float,2>{0.117922656f, 0.154391602f},
-std::array<float,2>{0.884274244f, 0.0484204181f},
-std::array<float,2>{0.158331677f, 0.524113595f},
-std::array<float,2>{0.551584482f, 0.751054049f},
-std::array<float,2>{0.474397391f, 0.489716589f},
-std::array<float,2>{0.934551537f, 0.470864385f},
-std::array<float,2>{0.130290672f, 0.776584685f},
-std::array<float,2>{0.513570905f, 0.508648992f},
-std::array<float,2>{0.443777502f, 0.0383897237f},
-std::array<float,2>{0.640473604f, 0.13792415f},
-std::array<float,2>{0.318933666f, 0.674469709f},
-std::array<float,2>{0.777600706f, 0.938158989f},
-std::array<float,2>{0.0634129271f, 0.297912806f},
-std::array<float,2>{0.573844314f, 0.353335291f},
-std::array<float,2>{0.415212631f, 0.91527456f},
-std::array<float,2>{0.972502649f, 0.706765354f},
-std::array<float,2>{0.207911775f, 0.194616944f},
-std::array<float,2>{0.816191494f, 0.0714878365f},
-std::array<float,2>{0.056688711f, 0.582828343f},
-std::array<float,2>{0.729584336f, 0.813197017f},
-std::array<float,2>{0.290951073f, 0.4374246f},
-std::array<float,2>{0.807567179f, 0.254808933f},
-std::array<float,2>{0.0974828601f, 0.993602574f},
-std::array<float,2>{0.677887917f, 0.625262082f},
-std::array<float,2>{0.360436052f, 0.179403126f},
-std::array<float,2>{0.540937901f, 0.0202639438f},
-std::array<float,2>{0.494771183f, 0.541526079f},
-std::array<float,2>{0.900488973f, 0.812039077f},
-std::array<float,2>{0.176270798f, 0.445142001f},
-std::array<float,2>{0.699994802f, 0.38326475f},
-std::array<float,2>{0.27208209f, 0.860583127f},
-std::array<float,2>{0.872541249f, 0.596383095f},
-std::array<float,2>{0.0301303528f, 0.105030946f},
-std::array<float,2>{0.959175706f, 0.223120436f},
-std::array<float,2>{0.249121547f, 0.727822244f},
-std::array<float,2>{0.61305064f, 0.884886622f},
-std::array<float,2>{0.396394968f, 0.336664468f},
-std::array<float,2>{0.963927925f, 0.267286003f},
-std::array<float,2>{0.238175541f, 0.979361176f},
-std::array<float,2>{0.622182548f, 0.642680883f},
-std::array<float,2>{0.402489066f, 0.162429094f},
-std::array<float,2>{0.688002527f, 0.000994242495f},
-std::array<float,2>{0.276562572f, 0.549196661f},
-std::array<float,2>{0.863930464f, 0.785449028f},
-std::array<float,2>{0.0192319676f, 0.460024416f},
-std::array<float,2>{0.531380415f, 0.397452325f},
-std::array<float,2>{0.485850871f, 0.853277266f},
-std::array<float,2>{0.895745933f, 0.616485834f},
-std::array<float,2>{0.186238885f, 0.111786135f},
-std::array<float,2>{0.798080266f, 0.245275587f},
-std::array<float,2>{0.105231866f, 0.7477929f},
-std::array<float,2>{0.685144067f, 0.897446156f},
-std::array<float,2>{0.371655375f, 0.323611975f},
-std::array<float,2>{0.827001095f, 0.48526293f},
-std::array<float,2>{0.0533758365f, 0.754916072f},
-std::array<float,2>{0.721173286f, 0.527470231f},
-std::array<float,2>{0.282539755f, 0.0536553115f},
-std::array<float,2>{0.567196727f, 0.149825811f},
-std::array<float,2>{0.413697213f, 0.662133098f},
-std::array<float,2>{0.979405761f, 0.956587374f},
-std::array<float,2>{0.211040512f, 0.296780765f},
-std::array<float,2>{0.625685573f, 0.36370036f},
-std::array<float,2>{0.327535599f, 0.933262944f},
-std::array<float,2>{0.770341694f, 0.688713551f},
-std::array<float,2>{0.0751164705f, 0.218492001f},
-std::array<float,2>{0.923542321f, 0.0923311785f},
-std::array<float,2>{0.133627206f, 0.564672351f},
-std::array<float,2>{0.507429838f, 0.836138606f},
-std::array<float,2>{0.453048378f, 0.415846884f},
-std::array<float,2>{0.877825975f, 0.429723591f},
-std::array<float,2>{0.164571956f, 0.817708194f},
-std::array<float,2>{0.559571385f, 0.581411779f},
-std::array<float,2>{0.480709344f, 0.0770770311f},
-std::array<float,2>{0.666590869f, 0.191056654f},
-std::array<float,2>{0.352021873f, 0.708803952f},
-std::array<float,2>{0.792680264f, 0.919108927f},
-std::array<float,2>{0.11490839f, 0.356512517f},
-std::array<float,2>{0.599932432f, 0.304438412f},
-std::array<float,2>{0.381162882f, 0.94263941f},
-std::array<float,2>{0.937556386f, 0.678347409f},
-std::array<float,2>{0.222432256f, 0.134105355f},
-std::array<float,2>{0.857756972f, 0.031526871f},
-std::array<float,2>{0.0129366666f, 0.514038265f},
-std::array<float,2>{0.710370064f, 0.778752625f},
-std::array<float,2>{0.256055295f, 0.473245293f},
-std::array<float,2>{0.751623869f, 0.343063354f},
-std::array<float,2>{0.0814458281f, 0.8896088f},
-std::array<float,2>{0.65617162f, 0.731309891f},
-std::array<float,2>{0.334718078f, 0.220760018f},
-std::array<float,2>{0.525384486f, 0.107193232f},
-std::array<float,2>{0.462266594f, 0.601389587f},
-std::array<float,2>{0.920695424f, 0.865543008f},
-std::array<float,2>{0.146567225f, 0.389847368f},
-std::array<float,2>{0.735758901f, 0.439012676f},
-std::array<float,2>{0.29743883f, 0.807990134f},
-std::array<float,2>{0.832239985f, 0.54670912f},
-std::array<float,2>{0.0402284972f, 0.0168282781f},
-std::array<float,2>{0.998367965f, 0.173306942f},
-std::array<float,2>{0.188237712f, 0.630334556f},
-std::array<float,2>{0.578445554f, 0.99930793f},
-std::array<float,2>{0.429564089f, 0.25194186f},
-std::array<float,2>{0.911324143f, 0.344240457f},
-std::array<float,2>{0.155980051f, 0.912878096f},
-std::array<float,2>{0.517732084f, 0.715558171f},
-std::array<float,2>{0.453608125f, 0.20205918f},
-std::array<float,2>{0.648069918f, 0.0650452301f},
-std::array<float,2>{0.343494684f, 0.586210251f},
-std::array<float,2>{0.758944452f, 0.828099787f},
-std::array<float,2>{0.0934881642f, 0.424250036f},
-std::array<float,2>{0.590371609f, 0.479264677f},
-std::array<float,2>{0.433082104f, 0.765898228f},
-std::array<float,2>{0.985324323f, 0.503299177f},
-std::array<float,2>{0.202541202f, 0.0445203297f},
-std::array<float,2>{0.836038768f, 0.126209632f},
-std::array<float,2>{0.0325307362f, 0.685699344f},
-std::array<float,2>{0.747633398f, 0.947389722f},
-std::array<float,2>{0.305393308f, 0.308725327f},
-std::array<float,2>{0.782354236f, 0.379628032f},
-std::array<float,2>{0.124853536f, 0.874411047f},
-std::array<float,2>{0.660354376f, 0.605885029f},
-std::array<float,2>{0.350291252f, 0.0995569602f},
-std::array<float,2>{0.549423039f, 0.228841707f},
-std::array<float,2>{0.472212702f, 0.725856781f},
-std::array<float,2>{0.889558733f, 0.875468731f},
-std::array<float,2>{0.162644163f, 0.332224548f},
-std::array<float,2>{0.715742946f, 0.26235199f},
-std::array<float,2>{0.258724421f, 0.989357829f},
-std::array<float,2>{0.848473489f, 0.639635623f},
-std::array<float,2>{0.0051376312f, 0.186301574f},
-std::array<float,2>{0.945666134f, 0.0281881168f},
-std::array<float,2>{0.227570429f, 0.533585429f},
-std::array<float,2>{0.608252347f, 0.798403203f},
-std::array<float,2>{0.386972457f, 0.449421585f},
-std::array<float,2>{0.972722232f, 0.4679901f},
-std::array<float,2>{0.206598014f, 0.79496783f},
-std::array<float,2>{0.577483475f, 0.556402385f},
-std::array<float,2>{0.419767112f, 0.00976859964f},
-std::array<float,2>{0.731305242f, 0.164246365f},
-std::array<float,2>{0.295946568f, 0.65122509f},
-std::array<float,2>{0.817287087f, 0.969750643f},
-std::array<float,2>{0.0616002008f, 0.279872268f},
-std::array<float,2>{0.509993196f, 0.316830218f},
-std::array<float,2>{0.439178556f, 0.901295602f},
-std::array<float,2>{0.930574775f, 0.734695494f},
-std::array<float,2>{0.128839538f, 0.235728577f},
-std::array<float,2>{0.777238786f, 0.121900052f},
-std::array<float,2>{0.0690773129f, 0.624427497f},
-std::array<float,2>{0.634836495f, 0.845469773f},
-std::array<float,2>{0.313093543f, 0.403028667f},
-std::array<float,2>{0.868029654f, 0.287143528f},
-std::array<float,2>{0.0249691773f, 0.961758316f},
-std::array<float,2>{0.698729813f, 0.664542854f},
-std::array<float,2>{0.268056929f, 0.141256064f},
-std::array<float,2>{0.614803553f, 0.0576748066f},
-std::array<float,2>{0.391438901f, 0.517528117f},
-std::array<float,2>{0.954635441f, 0.759916663f},
-std::array<float,2>{0.242860243f, 0.496291876f},
-std::array<float,2>{0.674122989f, 0.407538772f},
-std::array<float,2>{0.363912404f, 0.831375241f},
-std::array<float,2>{0.810646296f, 0.577311039f},
-std::array<float,2>{0.100589149f, 0.0798567533f},
-std::array<float,2>{0.90352416f, 0.209321827f},
-std::array<float,2>{0.174797639f, 0.700448215f},
-std::array<float,2>{0.54447794f, 0.928373039f},
-std::array<float,2>{0.496885657f, 0.371882737f},
-std::array<float,2>{0.928188801f, 0.261088461f},
-std::array<float,2>{0.138608158f, 0.987674177f},
-std::array<float,2>{0.503863215f, 0.632959425f},
-std::array<float,2>{0.447411478f, 0.179840788f},
-std::array<float,2>{0.631354153f, 0.0267331898f},
-std::array<float,2>{0.324033499f, 0.536493421f},
-std::array<float,2>{0.768192947f, 0.803262293f},
-std::array<float,2>{0.0717626065f, 0.446518749f},
-std::array<float,2>{0.562969387f, 0.377443016f},
-std::array<float,2>{0.407827914f, 0.86817503f},
-std::array<float,2>{0.982345402f, 0.603995383f},
-std::array<float,2>{0.215302095f, 0.0955567285f},
-std::array<float,2>{0.822218835f, 0.231739119f},
-std::array<float,2>{0.0473853201f, 0.721669197f},
-std::array<float,2>{0.725340605f, 0.881430507f},
-std::array<float,2>{0.285909563f, 0.331658691f},
-std::array<float,2>{0.800927162f, 0.483188182f},
-std::array<float,2>{0.105828397f, 0.771147192f},
-std::array<float,2>{0.67998004f, 0.507194221f},
-std::array<float,2>{0.368212253f, 0.0400793552f},
-std::array<float,2>{0.535219073f, 0.130319953f},
-std::array<float,2>{0.489330083f, 0.68321681f},
-std::array<float,2>{0.890747607f, 0.949348807f},
-std::array<float,2>{0.182222053f, 0.308130652f},
-std::array<float,2>{0.692748666f, 0.347900152f},
-std::array<float,2>{0.281084985f, 0.908685744f},
-std::array<float,2>{0.859963477f, 0.712039649f},
-std::array<float,2>{0.0232801978f, 0.198835105f},
-std::array<float,2>{0.965763152f, 0.0674357191f},
-std::array<float,2>{0.239008978f, 0.593131661f},
-std::array<float,2>{0.620074868f, 0.823025465f},
-std::array<float,2>{0.401138574f, 0.428221077f},
-std::array<float,2>{0.993194699f, 0.410424978f},
-std::array<float,2>{0.192776188f, 0.835307956f},
-std::array<float,2>{0.585728228f, 0.573436797f},
-std::array<float,2>{0.42532748f, 0.0830664635f},
-std::array<float,2>{0.738666713f, 0.204568744f},
-std::array<float,2>{0.300812542f, 0.695618808f},
-std::array<float,2>{0.831317782f, 0.922300637f},
-std::array<float,2>{0.0436191931f, 0.367984474f},
-std::array<float,2>{0.52945745f, 0.284477621f},
-std::array<float,2>{0.46536693f, 0.965803325f},
-std::array<float,2>{0.917672098f, 0.66972214f},
-std::array<float,2>{0.143241912f, 0.145897329f},
-std::array<float,2>{0.756955981f, 0.0623503365f},
-std::array<float,2>{0.0841670185f, 0.523212612f},
-std::array<float,2>{0.651675045f, 0.764840484f},
-std::array<float,2>{0.330196947f, 0.495126337f},
-std::array<float,2>{0.855221927f, 0.314286858f},
-std::array<float,2>{0.00828856602f, 0.904453695f},
-std::array<float,2>{0.703659356f, 0.740859032f},
-std::array<float,2>{0.250523388f, 0.240696698f},
-std::array<float,2>{0.595983326f, 0.118162408f},
-std::array<float,2>{0.377295196f, 0.618686914f},
-std::array<float,2>{0.943228364f, 0.850957453f},
-std::array<float,2>{0.22488445f, 0.400422901f},
-std::array<float,2>{0.671149671f, 0.46465984f},
-std::array<float,2>{0.355819941f, 0.78993088f},
-std::array<float,2>{0.794388413f, 0.561819375f},
-std::array<float,2>{0.110348888f, 0.0120237144f},
-std::array<float,2>{0.88196516f, 0.168490067f},
-std::array<float,2>{0.170334578f, 0.654210985f},
-std::array<float,2>{0.555281043f, 0.973565996f},
-std::array<float,2>{0.478178889f, 0.276593953f},
-std::array<float,2>{0.952828467f, 0.35946852f},
-std::array<float,2>{0.233854145f, 0.933926165f},
-std::array<float,2>{0.604933381f, 0.692842662f},
-std::array<float,2>{0.384950668f, 0.213792548f},
-std::array<float,2>{0.714294255f, 0.0861487836f},
-std::array<float,2>{0.261964679f, 0.567656934f},
-std::array<float,2>{0.847480118f, 0.840754271f},
-std::array<float,2>{0.000765321602f, 0.420626074f},
-std::array<float,2>{0.554547787f, 0.491963625f},
-std::array<float,2>{0.475966603f, 0.753568828f},
-std::array<float,2>{0.886527956f, 0.52733916f},
-std::array<float,2>{0.157330409f, 0.0504993051f},
-std::array<float,2>{0.786795795f, 0.153716564f},
-std::array<float,2>{0.120752096f, 0.657928586f},
-std::array<float,2>{0.658124149f, 0.960148633f},
-std::array<float,2>{0.346713245f, 0.290485024f},
-std::array<float,2>{0.839895427f, 0.390954643f},
-std::array<float,2>{0.0384319536f, 0.857556164f},
-std::array<float,2>{0.742669702f, 0.610116839f},
-std::array<float,2>{0.310875803f, 0.11559201f},
-std::array<float,2>{0.58831358f, 0.246967465f},
-std::array<float,2>{0.437486231f, 0.742456794f},
-std::array<float,2>{0.989050686f, 0.89095825f},
-std::array<float,2>{0.198853612f, 0.325975448f},
-std::array<float,2>{0.641678035f, 0.269975603f},
-std::array<float,2>{0.339768916f, 0.980545104f},
-std::array<float,2>{0.765458465f, 0.647779584f},
-std::array<float,2>{0.0882659182f, 0.158453062f},
-std::array<float,2>{0.909415901f, 0.00445874641f},
-std::array<float,2>{0.150221512f, 0.554582715f},
-std::array<float,2>{0.521231711f, 0.783258498f},
-std::array<float,2>{0.459530115f, 0.45477584f},
-std::array<float,2>{0.899832964f, 0.442760646f},
-std::array<float,2>{0.17890358f, 0.809095323f},
-std::array<float,2>{0.541264534f, 0.539274931f},
-std::array<float,2>{0.493612796f, 0.0218430366f},
-std::array<float,2>{0.676973403f, 0.176773831f},
-std::array<float,2>{0.36221689f, 0.627678156f},
-std::array<float,2>{0.804742038f, 0.995129526f},
-std::array<float,2>{0.0956188962f, 0.257106781f},
-std::array<float,2>{0.609701633f, 0.338351846f},
-std::array<float,2>{0.397110552f, 0.883713961f},
-std::array<float,2>{0.95727849f, 0.730429411f},
-std::array<float,2>{0.247263208f, 0.225438625f},
-std::array<float,2>{0.873934686f, 0.102786541f},
-std::array<float,2>{0.0278275218f, 0.594924569f},
-std::array<float,2>{0.702701032f, 0.862284601f},
-std::array<float,2>{0.27092883f, 0.385056347f},
-std::array<float,2>{0.78009367f, 0.29952091f},
-std::array<float,2>{0.0661915615f, 0.94027251f},
-std::array<float,2>{0.63692981f, 0.672648489f},
-std::array<float,2>{0.317460477f, 0.139911011f},
-std::array<float,2>{0.515227318f, 0.0370021574f},
-std::array<float,2>{0.442639828f, 0.511552393f},
-std::array<float,2>{0.937064648f, 0.774013817f},
-std::array<float,2>{0.132099748f, 0.469616652f},
-std::array<float,2>{0.726950169f, 0.433604181f},
-std::array<float,2>{0.292019397f, 0.814967632f},
-std::array<float,2>{0.813175738f, 0.58542943f},
-std::array<float,2>{0.0565325469f, 0.0736860186f},
-std::array<float,2>{0.97056073f, 0.19188793f},
-std::array<float,2>{0.210654393f, 0.704324424f},
-std::array<float,2>{0.571526706f, 0.917415679f},
-std::array<float,2>{0.417894244f, 0.353999138f},
-std::array<float,2>{0.977376759f, 0.294670522f},
-std::array<float,2>{0.212917671f, 0.953146279f},
-std::array<float,2>{0.568990231f, 0.660788417f},
-std::array<float,2>{0.410455555f, 0.151285723f},
-std::array<float,2>{0.719299197f, 0.0516426079f},
-std::array<float,2>{0.283981323f, 0.529321492f},
-std::array<float,2>{0.82540983f, 0.756043613f},
-std::array<float,2>{0.0526071452f, 0.486486077f},
-std::array<float,2>{0.504512608f, 0.417279303f},
-std::array<float,2>{0.449243069f, 0.838289738f},
-std::array<float,2>{0.925402522f, 0.562687755f},
-std::array<float,2>{0.135174841f, 0.0900394171f},
-std::array<float,2>{0.771676242f, 0.216783464f},
-std::array<float,2>{0.0774384663f, 0.691377163f},
-std::array<float,2>{0.62784946f, 0.92973274f},
-std::array<float,2>{0.324705094f, 0.366496593f},
-std::array<float,2>{0.865934253f, 0.458681315f},
-std::array<float,2>{0.0168593992f, 0.788606822f},
-std::array<float,2>{0.690276384f, 0.547775984f},
-std::array<float,2>{0.274233401f, 0.00315496023f},
-std::array<float,2>{0.623346329f, 0.160344809f},
-std::array<float,2>{0.404487699f, 0.64121002f},
-std::array<float,2>{0.961423397f, 0.977906942f},
-std::array<float,2>{0.234720573f, 0.268335372f},
-std::array<float,2>{0.686893821f, 0.321977079f},
-std::array<float,2>{0.37398985f, 0.895190001f},
-std::array<float,2>{0.798921168f, 0.748337388f},
-std::array<float,2>{0.102762051f, 0.244097516f},
-std::array<float,2>{0.897416651f, 0.110315345f},
-std::array<float,2>{0.184541285f, 0.615096927f},
-std::array<float,2>{0.533644676f, 0.854564607f},
-std::array<float,2>{0.487557471f, 0.395479023f},
-std::array<float,2>{0.919808686f, 0.38831991f},
-std::array<float,2>{0.145226449f, 0.864225447f},
-std::array<float,2>{0.526690185f, 0.598872423f},
-std::array<float,2>{0.464555919f, 0.108814456f},
-std::array<float,2>{0.653170824f, 0.219362497f},
-std::array<float,2>{0.333861172f, 0.733480811f},
-std::array<float,2>{0.753568113f, 0.88794148f},
-std::array<float,2>{0.0798698738f, 0.340045124f},
-std::array<float,2>{0.580190957f, 0.252636671f},
-std::array<float,2>{0.42762354f, 0.998006105f},
-std::array<float,2>{0.996749759f, 0.632748723f},
-std::array<float,2>{0.190300524f, 0.17531766f},
-std::array<float,2>{0.834078372f, 0.0186515749f},
-std::array<float,2>{0.0426316559f, 0.544041693f},
-std::array<float,2>{0.737360001f, 0.806638479f},
-std::array<float,2>{0.298911512f, 0.440858185f},
-std::array<float,2>{0.789607823f, 0.35872671f},
-std::array<float,2>{0.115641743f, 0.920743525f},
-std::array<float,2>{0.665298641f, 0.710491419f},
-std::array<float,2>{0.355034024f, 0.189039931f},
-std::array<float,2>{0.560832858f, 0.0752681121f},
-std::array<float,2>{0.482948035f, 0.578186989f},
-std::array<float,2>{0.875817537f, 0.819699883f},
-std::array<float,2>{0.166807547f, 0.433341175f},
-std::array<float,2>{0.707283616f, 0.47489655f},
-std::array<float,2>{0.254753083f, 0.78095746f},
-std::array<float,2>{0.855806172f, 0.513220906f},
-std::array<float,2>{0.0145383943f, 0.0332049541f},
-std::array<float,2>{0.941226065f, 0.135397702f},
-std::array<float,2>{0.219109729f, 0.677601993f},
-std::array<float,2>{0.59888941f, 0.943885207f},
-std::array<float,2>{0.38077563f, 0.302033663f},
-std::array<float,2>{0.888508558f, 0.334578812f},
-std::array<float,2>{0.161260247f, 0.877634227f},
-std::array<float,2>{0.548754752f, 0.723440349f},
-std::array<float,2>{0.468946487f, 0.227716208f},
-std::array<float,2>{0.662187576f, 0.101281427f},
-std::array<float,2>{0.349441588f, 0.607803702f},
-std::array<float,2>{0.78508836f, 0.872255027f},
-std::array<float,2>{0.122141108f, 0.380903751f},
-std::array<float,2>{0.60607475f, 0.452150166f},
-std::array<float,2>{0.389408559f, 0.799478114f},
-std::array<float,2>{0.949190557f, 0.532456934f},
-std::array<float,2>{0.228774816f, 0.0295727011f},
-std::array<float,2>{0.850795567f, 0.185251877f},
-std::array<float,2>{0.00727346772f, 0.636785567f},
-std::array<float,2>{0.717496276f, 0.991487265f},
-std::array<float,2>{0.260499448f, 0.265398234f},
-std::array<float,2>{0.761665881f, 0.42272535f},
-std::array<float,2>{0.0904989168f, 0.825004578f},
-std::array<float,2>{0.645430624f, 0.588133097f},
-std::array<float,2>{0.340097845f, 0.0632429868f},
-std::array<float,2>{0.517413855f, 0.199447349f},
-std::array<float,2>{0.456619471f, 0.717148364f},
-std::array<float,2>{0.912476897f, 0.911553442f},
-std::array<float,2>{0.153722212f, 0.346642494f},
-std::array<float,2>{0.748860717f, 0.312036008f},
-std::array<float,2>{0.306761712f, 0.945386171f},
-std::array<float,2>{0.839330792f, 0.685338378f},
-std::array<float,2>{0.0348532312f, 0.127649248f},
-std::array<float,2>{0.986870766f, 0.0462866984f},
-std::array<float,2>{0.200188041f, 0.501794696f},
-std::array<float,2>{0.591956854f, 0.769111335f},
-std::array<float,2>{0.431399792f, 0.476961046f},
-std::array<float,2>{0.956602871f, 0.499581695f},
-std::array<float,2>{0.244317576f, 0.759560287f},
-std::array<float,2>{0.616024613f, 0.518298984f},
-std::array<float,2>{0.393925518f, 0.0564368851f},
-std::array<float,2>{0.696344018f, 0.142634556f},
-std::array<float,2>{0.266391158f, 0.666451335f},
-std::array<float,2>{0.870941579f, 0.964579582f},
-std::array<float,2>{0.0253938679f, 0.285904825f},
-std::array<float,2>{0.545581281f, 0.373354793f},
-std::array<float,2>{0.498381108f, 0.926440597f},
-std::array<float,2>{0.906027317f, 0.701671541f},
-std::array<float,2>{0.172165871f, 0.20714736f},
-std::array<float,2>{0.808952332f, 0.0809638277f},
-std::array<float,2>{0.0992481709f, 0.575041234f},
-std::array<float,2>{0.673772752f, 0.829052091f},
-std::array<float,2>{0.366825461f, 0.409767151f},
-std::array<float,2>{0.819903612f, 0.277357072f},
-std::array<float,2>{0.0597721115f, 0.971158445f},
-std::array<float,2>{0.733863652f, 0.649058223f},
-std::array<float,2>{0.294106811f, 0.167528242f},
-std::array<float,2>{0.575171113f, 0.00843323581f},
-std::array<float,2>{0.420650691f, 0.558435678f},
-std::array<float,2>{0.975166678f, 0.794484615f},
-std::array<float,2>{0.203443334f, 0.466348618f},
-std::array<float,2>{0.634168804f, 0.404606968f},
-std::array<float,2>{0.316111684f, 0.845847845f},
-std::array<float,2>{0.774752557f, 0.621287167f},
-std::array<float,2>{0.067821078f, 0.124661557f},
-std::array<float,2>{0.933329225f, 0.237750113f},
-std::array<float,2>{0.125615895f, 0.73774451f},
-std::array<float,2>{0.509063423f, 0.898853838f},
-std::array<float,2>{0.441276699f, 0.318759382f},
-std::array<float,2>{0.936673045f, 0.298822135f},
-std::array<float,2>{0.132712126f, 0.93785876f},
-std::array<float,2>{0.514978886f, 0.67408061f},
-std::array<float,2>{0.443204045f, 0.138663128f},
-std::array<float,2>{0.637480855f, 0.0388511233f},
-std::array<float,2>{0.318243474f, 0.508251488f},
-std::array<float,2>{0.779338717f, 0.776973903f},
-std::array<float,2>{0.0656932816f, 0.471288413f},
-std::array<float,2>{0.572127759f, 0.436890125f},
-std::array<float,2>{0.417120427f, 0.812858045f},
-std::array<float,2>{0.970069885f, 0.582407355f},
-std::array<float,2>{0.210330665f, 0.0719061717f},
-std::array<float,2>{0.812585413f, 0.194975331f},
-std::array<float,2>{0.0559588112f, 0.706351817f},
-std::array<float,2>{0.727197409f, 0.915977597f},
-std::array<float,2>{0.292889684f, 0.352686524f},
-std::array<float,2>{0.805500388f, 0.44447878f},
-std::array<float,2>{0.0947571993f, 0.811641753f},
-std::array<float,2>{0.677388191f, 0.541035116f},
-std::array<float,2>{0.361768216f, 0.0197847392f},
-std::array<float,2>{0.541936398f, 0.178848892f},
-std::array<float,2>{0.493771911f, 0.625966549f},
-std::array<float,2>{0.90028429f, 0.993671656f},
-std::array<float,2>{0.179554701f, 0.254328102f},
-std::array<float,2>{0.702216983f, 0.336349994f},
-std::array<float,2>{0.271042615f, 0.885323644f},
-std::array<float,2>{0.873525083f, 0.728317142f},
-std::array<float,2>{0.027956197f, 0.223363996f},
-std::array<float,2>{0.957621157f, 0.104526341f},
-std::array<float,2>{0.248035133f, 0.595892906f},
-std::array<float,2>{0.610199034f, 0.861136794f},
-std::array<float,2>{0.396858007f, 0.383462965f},
-std::array<float,2>{0.988658309f, 0.39452827f},
-std::array<float,2>{0.198720366f, 0.855927289f},
-std::array<float,2>{0.588668704f, 0.612907529f},
-std::array<float,2>{0.43677935f, 0.114772789f},
-std::array<float,2>{0.742991149f, 0.249005765f},
-std::array<float,2>{0.311340004f, 0.745035648f},
-std::array<float,2>{0.840765417f, 0.893286943f},
-std::array<float,2>{0.0387021042f, 0.326734394f},
-std::array<float,2>{0.520592391f, 0.272726774f},
-std::array<float,2>{0.459399223f, 0.983275115f},
-std::array<float,2>{0.909847915f, 0.646249294f},
-std::array<float,2>{0.149785534f, 0.157849297f},
-std::array<float,2>{0.764912009f, 0.00661437679f},
-std::array<float,2>{0.0886569023f, 0.551027119f},
-std::array<float,2>{0.64251411f, 0.782876849f},
-std::array<float,2>{0.338881284f, 0.455542773f},
-std::array<float,2>{0.846902728f, 0.361587971f},
-std::array<float,2>{2.32683542e-05f, 0.937042594f},
-std::array<float,2>{0.714732587f, 0.694770992f},
-std::array<float,2>{0.262410074f, 0.212685078f},
-std::array<float,2>{0.605105937f, 0.0893378258f},
-std::array<float,2>{0.385382026f, 0.569701314f},
-std::array<float,2>{0.952367783f, 0.841869235f},
-std::array<float,2>{0.234192953f, 0.418483526f},
-std::array<float,2>{0.657307208f, 0.489944667f},
-std::array<float,2>{0.347408473f, 0.751763701f},
-std::array<float,2>{0.78621763f, 0.523749411f},
-std::array<float,2>{0.120172553f, 0.0482552163f},
-std::array<float,2>{0.885841072f, 0.155148089f},
-std::array<float,2>{0.157731235f, 0.658877432f},
-std::array<float,2>{0.554149985f, 0.958259344f},
-std::array<float,2>{0.476216644f, 0.291781932f},
-std::array<float,2>{0.94246316f, 0.316373259f},
-std::array<float,2>{0.225349694f, 0.902575016f},
-std::array<float,2>{0.596203089f, 0.739505231f},
-std::array<float,2>{0.377507269f, 0.239020586f},
-std::array<float,2>{0.703370392f, 0.119186923f},
-std::array<float,2>{0.250007629f, 0.619470417f},
-std::array<float,2>{0.854814649f, 0.84868139f},
-std::array<float,2>{0.00852665119f, 0.400214851f},
-std::array<float,2>{0.554850519f, 0.461205333f},
-std::array<float,2>{0.477902114f, 0.792720854f},
-std::array<float,2>{0.882747948f, 0.55920279f},
-std::array<float,2>{0.170868367f, 0.0142707145f},
-std::array<float,2>{0.794583976f, 0.171192333f},
-std::array<float,2>{0.1094063f, 0.655698061f},
-std::array<float,2>{0.671765983f, 0.976093054f},
-std::array<float,2>{0.35603258f, 0.274476886f},
-std::array<float,2>{0.83187902f, 0.412146568f},
-std::array<float,2>{0.0431242436f, 0.832599699f},
-std::array<float,2>{0.73913306f, 0.571333408f},
-std::array<float,2>{0.301282972f, 0.0858179107f},
-std::array<float,2>{0.585129857f, 0.206949517f},
-std::array<float,2>{0.425168753f, 0.698911786f},
-std::array<float,2>{0.994057059f, 0.924836874f},
-std::array<float,2>{0.193230137f, 0.370129555f},
-std::array<float,2>{0.651899457f, 0.282777131f},
-std::array<float,2>{0.33062014f, 0.968208611f},
-std::array<float,2>{0.75764215f, 0.670765519f},
-std::array<float,2>{0.0848289728f, 0.148058996f},
-std::array<float,2>{0.917102635f, 0.0590925775f},
-std::array<float,2>{0.142800525f, 0.521373391f},
-std::array<float,2>{0.530180573f, 0.763546228f},
-std::array<float,2>{0.465326101f, 0.492644936f},
-std::array<float,2>{0.891384304f, 0.481058717f},
-std::array<float,2>{0.181747645f, 0.771971583f},
-std::array<float,2>{0.535940588f, 0.504576862f},
-std::array<float,2>{0.490027547f, 0.0410478748f},
-std::array<float,2>{0.68053478f, 0.132112086f},
-std::array<float,2>{0.36892879f, 0.680442631f},
-std::array<float,2>{0.801513851f, 0.952884436f},
-std::array<float,2>{0.106093459f, 0.305561543f},
-std::array<float,2>{0.619390309f, 0.350568891f},
-std::array<float,2>{0.400497973f, 0.907483935f},
-std::array<float,2>{0.965147793f, 0.713527918f},
-std::array<float,2>{0.238510326f, 0.195754826f},
-std::array<float,2>{0.859683037f, 0.0688420534f},
-std::array<float,2>{0.0226431098f, 0.591339052f},
-std::array<float,2>{0.692881584f, 0.82108891f},
-std::array<float,2>{0.280329466f, 0.427372873f},
-std::array<float,2>{0.767683804f, 0.259225458f},
-std::array<float,2>{0.0719451606f, 0.985627115f},
-std::array<float,2>{0.631267488f, 0.636473596f},
-std::array<float,2>{0.323278815f, 0.182059303f},
-std::array<float,2>{0.503134489f, 0.0248872936f},
-std::array<float,2>{0.44791016f, 0.538008869f},
-std::array<float,2>{0.928424239f, 0.802280068f},
-std::array<float,2>{0.137748331f, 0.449209452f},
-std::array<float,2>{0.724643409f, 0.376477331f},
-std::array<float,2>{0.28518647f, 0.869932234f},
-std::array<float,2>{0.821325898f, 0.601974189f},
-std::array<float,2>{0.0473547801f, 0.0974890962f},
-std::array<float,2>{0.981553018f, 0.232742459f},
-std::array<float,2>{0.215525806f, 0.718813896f},
-std::array<float,2>{0.56300354f, 0.880384862f},
-std::array<float,2>{0.407255828f, 0.328672826f},
-std::array<float,2>{0.975060344f, 0.279361814f},
-std::array<float,2>{0.203988507f, 0.970450997f},
-std::array<float,2>{0.574304938f, 0.650789082f},
-std::array<float,2>{0.420338094f, 0.164836019f},
-std::array<float,2>{0.733979762f, 0.0103499843f},
-std::array<float,2>{0.294655025f, 0.555929124f},
-std::array<float,2>{0.819763601f, 0.795431912f},
-std::array<float,2>{0.0605317578f, 0.468349934f},
-std::array<float,2>{0.509591401f, 0.402724296f},
-std::array<float,2>{0.44076702f, 0.845209599f},
-std::array<float,2>{0.932895422f, 0.624537587f},
-std::array<float,2>{0.12534672f, 0.121492513f},
-std::array<float,2>{0.775296688f, 0.235992089f},
-std::array<float,2>{0.0678774938f, 0.735049486f},
-std::array<float,2>{0.634470999f, 0.900488794f},
-std::array<float,2>{0.3156223f, 0.317031443f},
-std::array<float,2>{0.870182693f, 0.497001469f},
-std::array<float,2>{0.0261834394f, 0.760486424f},
-std::array<float,2>{0.696921945f, 0.516962171f},
-std::array<float,2>{0.266045958f, 0.0583041981f},
-std::array<float,2>{0.615589917f, 0.141089305f},
-std::array<float,2>{0.394138187f, 0.664728165f},
-std::array<float,2>{0.956321061f, 0.961419463f},
-std::array<float,2>{0.244656995f, 0.287785411f},
-std::array<float,2>{0.673038006f, 0.371573031f},
-std::array<float,2>{0.366271853f, 0.927980244f},
-std::array<float,2>{0.809195638f, 0.701009214f},
-std::array<float,2>{0.0986830816f, 0.209748879f},
-std::array<float,2>{0.905618131f, 0.0792719424f},
-std::array<float,2>{0.172782481f, 0.578025579f},
-std::array<float,2>{0.545273781f, 0.831551135f},
-std::array<float,2>{0.498735368f, 0.407826275f},
-std::array<float,2>{0.913000524f, 0.424694389f},
-std::array<float,2>{0.153833881f, 0.82760644f},
-std::array<float,2>{0.51679492f, 0.586854696f},
-std::array<float,2>{0.456190079f, 0.0647558644f},
-std::array<float,2>{0.644752502f, 0.201463804f},
-std::array<float,2>{0.340811044f, 0.715155184f},
-std::array<float,2>{0.761174381f, 0.912211418f},
-std::array<float,2>{0.0898697898f, 0.344081014f},
-std::array<float,2>{0.592527807f, 0.309246242f},
-std::array<float,2>{0.431056321f, 0.948195815f},
-std::array<float,2>{0.986598134f, 0.68650943f},
-std::array<float,2>{0.199392006f, 0.126638547f},
-std::array<float,2>{0.839711189f, 0.0439689942f},
-std::array<float,2>{0.034256231f, 0.503791213f},
-std::array<float,2>{0.748419523f, 0.766477466f},
-std::array<float,2>{0.307452589f, 0.478857547f},
-std::array<float,2>{0.784314096f, 0.332862258f},
-std::array<float,2>{0.122933477f, 0.875844121f},
-std::array<float,2>{0.662985146f, 0.726133943f},
-std::array<float,2>{0.348781466f, 0.22906822f},
-std::array<float,2>{0.548167884f, 0.0988681316f},
-std::array<float,2>{0.469591588f, 0.60604465f},
-std::array<float,2>{0.887717903f, 0.874568939f},
-std::array<float,2>{0.161716804f, 0.379252821f},
-std::array<float,2>{0.71720463f, 0.449799806f},
-std::array<float,2>{0.259853333f, 0.797916949f},
-std::array<float,2>{0.85128206f, 0.533948183f},
-std::array<float,2>{0.00775854057f, 0.0275864229f},
-std::array<float,2>{0.948680997f, 0.185553238f},
-std::array<float,2>{0.229010642f, 0.638847411f},
-std::array<float,2>{0.605945826f, 0.989853501f},
-std::array<float,2>{0.388824254f, 0.262109637f},
-std::array<float,2>{0.875285149f, 0.357344747f},
-std::array<float,2>{0.166123241f, 0.919627905f},
-std::array<float,2>{0.561365008f, 0.708126009f},
-std::array<float,2>{0.482890218f, 0.190829143f},
-std::array<float,2>{0.665881872f, 0.0764781013f},
-std::array<float,2>{0.354670137f, 0.58193028f},
-std::array<float,2>{0.78934592f, 0.818285108f},
-std::array<float,2>{0.115783118f, 0.430410147f},
-std::array<float,2>{0.599162877f, 0.472761571f},
-std::array<float,2>{0.380291641f, 0.77896148f},
-std::array<float,2>{0.940815389f, 0.514380336f},
-std::array<float,2>{0.21942614f, 0.0318785459f},
-std::array<float,2>{0.8561427f, 0.13427873f},
-std::array<float,2>{0.0137749491f, 0.678082764f},
-std::array<float,2>{0.707617104f, 0.943013608f},
-std::array<float,2>{0.254208833f, 0.304051757f},
-std::array<float,2>{0.753191352f, 0.390493691f},
-std::array<float,2>{0.0793007836f, 0.865744114f},
-std::array<float,2>{0.652457297f, 0.600719988f},
-std::array<float,2>{0.333037078f, 0.10645429f},
-std::array<float,2>{0.526895463f, 0.221225739f},
-std::array<float,2>{0.463897437f, 0.73092854f},
-std::array<float,2>{0.919050753f, 0.888864219f},
-std::array<float,2>{0.144787773f, 0.34359476f},
-std::array<float,2>{0.738115191f, 0.251041502f},
-std::array<float,2>{0.299566567f, 0.99963814f},
-std::array<float,2>{0.834571421f, 0.630612493f},
-std::array<float,2>{0.0419952683f, 0.173570275f},
-std::array<float,2>{0.996288002f, 0.0172211155f},
-std::array<float,2>{0.189589396f, 0.546031058f},
-std::array<float,2>{0.581025362f, 0.808190465f},
-std::array<float,2>{0.426880628f, 0.438876629f},
-std::array<float,2>{0.96157372f, 0.46055162f},
-std::array<float,2>{0.235313073f, 0.786029577f},
-std::array<float,2>{0.623832703f, 0.549579203f},
-std::array<float,2>{0.405244768f, 0.00191697048f},
-std::array<float,2>{0.689661503f, 0.162693426f},
-std::array<float,2>{0.273865819f, 0.643122017f},
-std::array<float,2>{0.865572274f, 0.978589773f},
-std::array<float,2>{0.0174702611f, 0.266682357f},
-std::array<float,2>{0.533989012f, 0.323904306f},
-std::array<float,2>{0.488155812f, 0.896594167f},
-std::array<float,2>{0.896739483f, 0.747318625f},
-std::array<float,2>{0.183631673f, 0.245826602f},
-std::array<float,2>{0.7994259f, 0.112269573f},
-std::array<float,2>{0.103093803f, 0.617046356f},
-std::array<float,2>{0.687048733f, 0.852731228f},
-std::array<float,2>{0.373238534f, 0.396843821f},
-std::array<float,2>{0.825730085f, 0.295942694f},
-std::array<float,2>{0.0520280711f, 0.956126332f},
-std::array<float,2>{0.719080746f, 0.662672341f},
-std::array<float,2>{0.283231199f, 0.150036097f},
-std::array<float,2>{0.568388224f, 0.0530482084f},
-std::array<float,2>{0.410816967f, 0.528115451f},
-std::array<float,2>{0.976684093f, 0.755852878f},
-std::array<float,2>{0.213389665f, 0.484607846f},
-std::array<float,2>{0.627221227f, 0.415288419f},
-std::array<float,2>{0.325009108f, 0.836545289f},
-std::array<float,2>{0.772255123f, 0.56535393f},
-std::array<float,2>{0.0780443996f, 0.0918475538f},
-std::array<float,2>{0.924962759f, 0.218227386f},
-std::array<float,2>{0.135650143f, 0.68909204f},
-std::array<float,2>{0.504013002f, 0.932880819f},
-std::array<float,2>{0.449775368f, 0.364113957f},
-std::array<float,2>{0.90133363f, 0.257360369f},
-std::array<float,2>{0.175785318f, 0.995621085f},
-std::array<float,2>{0.540234387f, 0.626976252f},
-std::array<float,2>{0.494564474f, 0.177336946f},
-std::array<float,2>{0.678461552f, 0.022377681f},
-std::array<float,2>{0.360866755f, 0.539632499f},
-std::array<float,2>{0.807007432f, 0.808646977f},
-std::array<float,2>{0.096681647f, 0.442945242f},
-std::array<float,2>{0.612376153f, 0.385649204f},
-std::array<float,2>{0.395927429f, 0.861793399f},
-std::array<float,2>{0.959620774f, 0.595637202f},
-std::array<float,2>{0.249848187f, 0.103402972f},
-std::array<float,2>{0.872900844f, 0.224797621f},
-std::array<float,2>{0.0297404323f, 0.729807854f},
-std::array<float,2>{0.699676812f, 0.883158028f},
-std::array<float,2>{0.271635205f, 0.338583529f},
-std::array<float,2>{0.777919948f, 0.469192833f},
-std::array<float,2>{0.0628472641f, 0.773836672f},
-std::array<float,2>{0.640027165f, 0.510877013f},
-std::array<float,2>{0.31847921f, 0.0362474471f},
-std::array<float,2>{0.513073862f, 0.140143663f},
-std::array<float,2>{0.444044143f, 0.67203784f},
-std::array<float,2>{0.933786273f, 0.939639509f},
-std::array<float,2>{0.130371332f, 0.299057275f},
-std::array<float,2>{0.730113149f, 0.354478538f},
-std::array<float,2>{0.290451974f, 0.917842269f},
-std::array<float,2>{0.815544665f, 0.70505929f},
-std::array<float,2>{0.0574482419f, 0.192088425f},
-std::array<float,2>{0.97189188f, 0.0741183832f},
-std::array<float,2>{0.207399175f, 0.585540414f},
-std::array<float,2>{0.573676646f, 0.814468324f},
-std::array<float,2>{0.415564477f, 0.434365571f},
-std::array<float,2>{0.949623406f, 0.420056134f},
-std::array<float,2>{0.23133634f, 0.840310752f},
-std::array<float,2>{0.602475882f, 0.568040907f},
-std::array<float,2>{0.38286227f, 0.0864602029f},
-std::array<float,2>{0.71240449f, 0.21328482f},
-std::array<float,2>{0.265587538f, 0.69335556f},
-std::array<float,2>{0.845595717f, 0.934149265f},
-std::array<float,2>{0.00270650419f, 0.360103428f},
-std::array<float,2>{0.550899446f, 0.290529668f},
-std::array<float,2>{0.474104375f, 0.960763335f},
-std::array<float,2>{0.884523749f, 0.657285392f},
-std::array<float,2>{0.159022495f, 0.153952226f},
-std::array<float,2>{0.787631512f, 0.0500051081f},
-std::array<float,2>{0.117618464f, 0.526697457f},
-std::array<float,2>{0.658708334f, 0.753203034f},
-std::array<float,2>{0.345008731f, 0.491526574f},
-std::array<float,2>{0.842174292f, 0.325446278f},
-std::array<float,2>{0.0359080806f, 0.89112699f},
-std::array<float,2>{0.744656265f, 0.74302274f},
-std::array<float,2>{0.310180485f, 0.246312171f},
-std::array<float,2>{0.586682498f, 0.115867406f},
-std::array<float,2>{0.434859455f, 0.609735787f},
-std::array<float,2>{0.991007626f, 0.858205378f},
-std::array<float,2>{0.19540213f, 0.391324461f},
-std::array<float,2>{0.643556952f, 0.454341978f},
-std::array<float,2>{0.335962713f, 0.783991516f},
-std::array<float,2>{0.762672603f, 0.553783178f},
-std::array<float,2>{0.0869983584f, 0.00435518241f},
-std::array<float,2>{0.906683326f, 0.158860773f},
-std::array<float,2>{0.151221141f, 0.648036063f},
-std::array<float,2>{0.522073627f, 0.981070042f},
-std::array<float,2>{0.457116097f, 0.270451725f},
-std::array<float,2>{0.995888054f, 0.367243558f},
-std::array<float,2>{0.19514738f, 0.922511518f},
-std::array<float,2>{0.582180679f, 0.696078956f},
-std::array<float,2>{0.423249871f, 0.204817653f},
-std::array<float,2>{0.740787029f, 0.0839556679f},
-std::array<float,2>{0.303325593f, 0.573762596f},
-std::array<float,2>{0.829939067f, 0.835875809f},
-std::array<float,2>{0.0453681611f, 0.411078781f},
-std::array<float,2>{0.52857852f, 0.495615035f},
-std::array<float,2>{0.467221409f, 0.765221119f},
-std::array<float,2>{0.91463387f, 0.522475004f},
-std::array<float,2>{0.142561227f, 0.0617213733f},
-std::array<float,2>{0.754736781f, 0.146465808f},
-std::array<float,2>{0.0827826262f, 0.668976784f},
-std::array<float,2>{0.649040222f, 0.964913964f},
-std::array<float,2>{0.32971248f, 0.284820616f},
-std::array<float,2>{0.852310956f, 0.401363879f},
-std::array<float,2>{0.0101080816f, 0.851555645f},
-std::array<float,2>{0.705109358f, 0.618274152f},
-std::array<float,2>{0.253028512f, 0.117237322f},
-std::array<float,2>{0.594777584f, 0.240798265f},
-std::array<float,2>{0.376179427f, 0.740374148f},
-std::array<float,2>{0.943877459f, 0.904851854f},
-std::array<float,2>{0.224501148f, 0.313960314f},
-std::array<float,2>{0.668480933f, 0.276977956f},
-std::array<float,2>{0.358419865f, 0.972904563f},
-std::array<float,2>{0.795061171f, 0.653688192f},
-std::array<float,2>{0.111868493f, 0.168064356f},
-std::array<float,2>{0.880610347f, 0.0126171773f},
-std::array<float,2>{0.169852316f, 0.562290132f},
-std::array<float,2>{0.557524145f, 0.789109111f},
-std::array<float,2>{0.479372263f, 0.464153767f},
-std::array<float,2>{0.926890016f, 0.446865737f},
-std::array<float,2>{0.139828935f, 0.802736521f},
-std::array<float,2>{0.501072228f, 0.536732912f},
-std::array<float,2>{0.446201205f, 0.0271687061f},
-std::array<float,2>{0.629362583f, 0.180327728f},
-std::array<float,2>{0.320914328f, 0.633409202f},
-std::array<float,2>{0.767143428f, 0.987856746f},
-std::array<float,2>{0.0738878623f, 0.261621743f},
-std::array<float,2>{0.565982997f, 0.331319183f},
-std::array<float,2>{0.408841372f, 0.880916715f},
-std::array<float,2>{0.983902097f, 0.720725298f},
-std::array<float,2>{0.21777685f, 0.231968656f},
-std::array<float,2>{0.824153423f, 0.0951801464f},
-std::array<float,2>{0.0489757583f, 0.604463875f},
-std::array<float,2>{0.723322213f, 0.869031191f},
-std::array<float,2>{0.287192434f, 0.377210617f},
-std::array<float,2>{0.804550648f, 0.307709038f},
-std::array<float,2>{0.108170092f, 0.949851751f},
-std::array<float,2>{0.682948411f, 0.682957888f},
-std::array<float,2>{0.371064603f, 0.130522117f},
-std::array<float,2>{0.537583947f, 0.0409001708f},
-std::array<float,2>{0.491018951f, 0.50763005f},
-std::array<float,2>{0.89403832f, 0.770878375f},
-std::array<float,2>{0.181462154f, 0.482580036f},
-std::array<float,2>{0.693524957f, 0.428602546f},
-std::array<float,2>{0.278173f, 0.822311282f},
-std::array<float,2>{0.861869335f, 0.593654871f},
-std::array<float,2>{0.0196940433f, 0.068134509f},
-std::array<float,2>{0.968498468f, 0.198461503f},
-std::array<float,2>{0.242168918f, 0.712736964f},
-std::array<float,2>{0.619064093f, 0.908749521f},
-std::array<float,2>{0.399660408f, 0.348352551f},
-std::array<float,2>{0.954278469f, 0.285442621f},
-std::array<float,2>{0.242227256f, 0.96402353f},
-std::array<float,2>{0.614602089f, 0.666900218f},
-std::array<float,2>{0.391048253f, 0.143497244f},
-std::array<float,2>{0.698907435f, 0.0558805279f},
-std::array<float,2>{0.268515795f, 0.517930806f},
-std::array<float,2>{0.867426097f, 0.759101272f},
-std::array<float,2>{0.0247901417f, 0.499492407f},
-std::array<float,2>{0.543974757f, 0.409440815f},
-std::array<float,2>{0.496345401f, 0.828509986f},
-std::array<float,2>{0.903879523f, 0.574432671f},
-std::array<float,2>{0.173862845f, 0.0803264007f},
-std::array<float,2>{0.811376095f, 0.20775111f},
-std::array<float,2>{0.101197742f, 0.701583445f},
-std::array<float,2>{0.674437821f, 0.925845623f},
-std::array<float,2>{0.363384038f, 0.373728275f},
-std::array<float,2>{0.816755891f, 0.46624428f},
-std::array<float,2>{0.0623109192f, 0.794347227f},
-std::array<float,2>{0.730865717f, 0.557740271f},
-std::array<float,2>{0.296698689f, 0.00786773302f},
-std::array<float,2>{0.577887535f, 0.167211056f},
-std::array<float,2>{0.419125766f, 0.648593009f},
-std::array<float,2>{0.973226786f, 0.971393406f},
-std::array<float,2>{0.206458449f, 0.278159112f},
-std::array<float,2>{0.635642231f, 0.319182426f},
-std::array<float,2>{0.312648386f, 0.899154127f},
-std::array<float,2>{0.776827931f, 0.73802942f},
-std::array<float,2>{0.0684761554f, 0.237809315f},
-std::array<float,2>{0.930023909f, 0.124354392f},
-std::array<float,2>{0.128071487f, 0.621869981f},
-std::array<float,2>{0.510365725f, 0.846209645f},
-std::array<float,2>{0.438884228f, 0.404812902f},
-std::array<float,2>{0.889153123f, 0.381767631f},
-std::array<float,2>{0.162148252f, 0.872573972f},
-std::array<float,2>{0.54883337f, 0.608388305f},
-std::array<float,2>{0.472127944f, 0.100733317f},
-std::array<float,2>{0.660965621f, 0.228314802f},
-std::array<float,2>{0.349711001f, 0.722993672f},
-std::array<float,2>{0.78299886f, 0.877245069f},
-std::array<float,2>{0.124497674f, 0.334298462f},
-std::array<float,2>{0.607571423f, 0.264741242f},
-std::array<float,2>{0.387346119f, 0.99174273f},
-std::array<float,2>{0.945986569f, 0.637238622f},
-std::array<float,2>{0.228464633f, 0.18465583f},
-std::array<float,2>{0.847764194f, 0.0301137958f},
-std::array<float,2>{0.00544016622f, 0.533165395f},
-std::array<float,2>{0.715028882f, 0.799055219f},
-std::array<float,2>{0.25816232f, 0.453002334f},
-std::array<float,2>{0.759689391f, 0.346003383f},
-std::array<float,2>{0.0931771398f, 0.911830842f},
-std::array<float,2>{0.647600353f, 0.717579961f},
-std::array<float,2>{0.342826545f, 0.200001284f},
-std::array<float,2>{0.51848042f, 0.0628350154f},
-std::array<float,2>{0.453915834f, 0.588804841f},
-std::array<float,2>{0.91162622f, 0.82442981f},
-std::array<float,2>{0.155479982f, 0.422031313f},
-std::array<float,2>{0.747355342f, 0.477488697f},
-std::array<float,2>{0.305070341f, 0.768988848f},
-std::array<float,2>{0.836755872f, 0.501109719f},
-std::array<float,2>{0.0331300944f, 0.0468341261f},
-std::array<float,2>{0.984443784f, 0.127202347f},
-std::array<float,2>{0.20283182f, 0.685036719f},
-std::array<float,2>{0.589937508f, 0.946158826f},
-std::array<float,2>{0.43311891f, 0.31155619f},
-std::array<float,2>{0.92040801f, 0.340480834f},
-std::array<float,2>{0.147088587f, 0.888398886f},
-std::array<float,2>{0.524720967f, 0.734273911f},
-std::array<float,2>{0.4626306f, 0.219025701f},
-std::array<float,2>{0.65538317f, 0.109098405f},
-std::array<float,2>{0.334114611f, 0.599262714f},
-std::array<float,2>{0.751104951f, 0.863369644f},
-std::array<float,2>{0.0819229931f, 0.38795796f},
-std::array<float,2>{0.579059303f, 0.441223711f},
-std::array<float,2>{0.429045111f, 0.805972695f},
-std::array<float,2>{0.998846829f, 0.544551075f},
-std::array<float,2>{0.187578142f, 0.0194981527f},
-std::array<float,2>{0.832751215f, 0.175276533f},
-std::array<float,2>{0.0406695232f, 0.632121801f},
-std::array<float,2>{0.735966146f, 0.997209609f},
-std::array<float,2>{0.297024548f, 0.252123743f},
-std::array<float,2>{0.792355657f, 0.432992727f},
-std::array<float,2>{0.114363454f, 0.819923401f},
-std::array<float,2>{0.666196346f, 0.578837633f},
-std::array<float,2>{0.35247615f, 0.0758502185f},
-std::array<float,2>{0.560113132f, 0.188811064f},
-std::array<float,2>{0.480977833f, 0.710193038f},
-std::array<float,2>{0.877307057f, 0.920039058f},
-std::array<float,2>{0.164443687f, 0.359041721f},
-std::array<float,2>{0.710621893f, 0.302536428f},
-std::array<float,2>{0.256646991f, 0.943825006f},
-std::array<float,2>{0.858007431f, 0.676853001f},
-std::array<float,2>{0.0134725608f, 0.135106117f},
-std::array<float,2>{0.938133299f, 0.0337146372f},
-std::array<float,2>{0.221707866f, 0.513167262f},
-std::array<float,2>{0.600196183f, 0.780363441f},
-std::array<float,2>{0.381642312f, 0.475235313f},
-std::array<float,2>{0.97898066f, 0.486905605f},
-std::array<float,2>{0.211647928f, 0.756474733f},
-std::array<float,2>{0.566847146f, 0.529971302f},
-std::array<float,2>{0.413508028f, 0.0508096144f},
-std::array<float,2>{0.721311808f, 0.150783673f},
-std::array<float,2>{0.282725006f, 0.660360873f},
-std::array<float,2>{0.826282561f, 0.953787386f},
-std::array<float,2>{0.0528633371f, 0.294432908f},
-std::array<float,2>{0.506948173f, 0.366959363f},
-std::array<float,2>{0.452461898f, 0.930590689f},
-std::array<float,2>{0.922859728f, 0.690780997f},
-std::array<float,2>{0.132971272f, 0.215964392f},
-std::array<float,2>{0.769570529f, 0.0904467329f},
-std::array<float,2>{0.074254103f, 0.563106239f},
-std::array<float,2>{0.625428438f, 0.83852756f},
-std::array<float,2>{0.327663958f, 0.4178873f},
-std::array<float,2>{0.86369592f, 0.268013358f},
-std::array<float,2>{0.0187508613f, 0.978356957f},
-std::array<float,2>{0.687914133f, 0.641073883f},
-std::array<float,2>{0.277150661f, 0.160775647f},
-std::array<float,2>{0.62263298f, 0.00364485802f},
-std::array<float,2>{0.403065234f, 0.547321081f},
-std::array<float,2>{0.964760005f, 0.788539767f},
-std::array<float,2>{0.237425625f, 0.458022803f},
-std::array<float,2>{0.684612393f, 0.394846022f},
-std::array<float,2>{0.371373683f, 0.855414569f},
-std::array<float,2>{0.798761427f, 0.614694357f},
-std::array<float,2>{0.104527391f, 0.109409653f},
-std::array<float,2>{0.896245301f, 0.243595958f},
-std::array<float,2>{0.18565461f, 0.748629808f},
-std::array<float,2>{0.531888425f, 0.894586682f},
-std::array<float,2>{0.485391766f, 0.32160899f},
-std::array<float,2>{0.882911026f, 0.292361498f},
-std::array<float,2>{0.159363315f, 0.957031608f},
-std::array<float,2>{0.552070379f, 0.659894407f},
-std::array<float,2>{0.472723216f, 0.155661657f},
-std::array<float,2>{0.659477949f, 0.0475165732f},
-std::array<float,2>{0.344217837f, 0.524589956f},
-std::array<float,2>{0.788098216f, 0.750799596f},
-std::array<float,2>{0.119080089f, 0.489015758f},
-std::array<float,2>{0.60324651f, 0.419173092f},
-std::array<float,2>{0.384068012f, 0.843089998f},
-std::array<float,2>{0.951064706f, 0.569010198f},
-std::array<float,2>{0.231634095f, 0.087900281f},
-std::array<float,2>{0.843969822f, 0.211800024f},
-std::array<float,2>{0.00323280669f, 0.693528056f},
-std::array<float,2>{0.711303413f, 0.935716748f},
-std::array<float,2>{0.263958573f, 0.362496436f},
-std::array<float,2>{0.762890279f, 0.456234723f},
-std::array<float,2>{0.0867842212f, 0.781581342f},
-std::array<float,2>{0.643422544f, 0.55224371f},
-std::array<float,2>{0.337577105f, 0.00739112636f},
-std::array<float,2>{0.523332f, 0.156831935f},
-std::array<float,2>{0.458770037f, 0.644813836f},
-std::array<float,2>{0.907259107f, 0.984212399f},
-std::array<float,2>{0.1521485f, 0.272297293f},
-std::array<float,2>{0.745643258f, 0.328015208f},
-std::array<float,2>{0.30885601f, 0.893981218f},
-std::array<float,2>{0.842788041f, 0.745604038f},
-std::array<float,2>{0.0368463732f, 0.249630749f},
-std::array<float,2>{0.991543829f, 0.113796823f},
-std::array<float,2>{0.197154626f, 0.612040579f},
-std::array<float,2>{0.587590158f, 0.857357085f},
-std::array<float,2>{0.433707654f, 0.393100291f},
-std::array<float,2>{0.960335493f, 0.384140551f},
-std::array<float,2>{0.248299211f, 0.859690845f},
-std::array<float,2>{0.611952662f, 0.597371876f},
-std::array<float,2>{0.394669831f, 0.104435131f},
-std::array<float,2>{0.700663865f, 0.223812386f},
-std::array<float,2>{0.27292496f, 0.727208436f},
-std::array<float,2>{0.871916056f, 0.886635661f},
-std::array<float,2>{0.0304377377f, 0.33719787f},
-std::array<float,2>{0.539121926f, 0.255228937f},
-std::array<float,2>{0.495207578f, 0.992791176f},
-std::array<float,2>{0.901751161f, 0.626644909f},
-std::array<float,2>{0.177318871f, 0.177799061f},
-std::array<float,2>{0.807713509f, 0.0206835084f},
-std::array<float,2>{0.0960161239f, 0.542434454f},
-std::array<float,2>{0.679251969f, 0.810761094f},
-std::array<float,2>{0.359542936f, 0.443908334f},
-std::array<float,2>{0.814830124f, 0.35184437f},
-std::array<float,2>{0.0584098212f, 0.914322793f},
-std::array<float,2>{0.728535891f, 0.705425918f},
-std::array<float,2>{0.289421827f, 0.193408385f},
-std::array<float,2>{0.572803676f, 0.0707893893f},
-std::array<float,2>{0.414846599f, 0.583746791f},
-std::array<float,2>{0.970995009f, 0.814071834f},
-std::array<float,2>{0.2087515f, 0.435626596f},
-std::array<float,2>{0.63883096f, 0.471976429f},
-std::array<float,2>{0.319471925f, 0.775737405f},
-std::array<float,2>{0.778478146f, 0.508847654f},
-std::array<float,2>{0.0639914274f, 0.0377589874f},
-std::array<float,2>{0.935276031f, 0.137066305f},
-std::array<float,2>{0.129053041f, 0.675220311f},
-std::array<float,2>{0.512309611f, 0.93855685f},
-std::array<float,2>{0.444919348f, 0.297133386f},
-std::array<float,2>{0.982878089f, 0.329581141f},
-std::array<float,2>{0.217350587f, 0.879579246f},
-std::array<float,2>{0.565085948f, 0.720153809f},
-std::array<float,2>{0.409547716f, 0.233455569f},
-std::array<float,2>{0.724494457f, 0.0966385901f},
-std::array<float,2>{0.288643688f, 0.603244007f},
-std::array<float,2>{0.822890401f, 0.87065357f},
-std::array<float,2>{0.050125327f, 0.375536948f},
-std::array<float,2>{0.500271082f, 0.448027968f},
-std::array<float,2>{0.446981817f, 0.801477611f},
-std::array<float,2>{0.926645339f, 0.538884521f},
-std::array<float,2>{0.139647901f, 0.0238212012f},
-std::array<float,2>{0.765711188f, 0.183503315f},
-std::array<float,2>{0.072444737f, 0.635362625f},
-std::array<float,2>{0.630071938f, 0.985154092f},
-std::array<float,2>{0.322077632f, 0.258620888f},
-std::array<float,2>{0.862421095f, 0.425865769f},
-std::array<float,2>{0.0213467367f, 0.821974576f},
-std::array<float,2>{0.694965303f, 0.590240061f},
-std::array<float,2>{0.278902829f, 0.0701861829f},
-std::array<float,2>{0.617280245f, 0.196834818f},
-std::array<float,2>{0.398709744f, 0.714405954f},
-std::array<float,2>{0.967162132f, 0.906458735f},
-std::array<float,2>{0.240734965f, 0.350854129f},
-std::array<float,2>{0.682073653f, 0.306075335f},
-std::array<float,2>{0.369186938f, 0.952098191f},
-std::array<float,2>{0.80294627f, 0.680665433f},
-std::array<float,2>{0.108938582f, 0.13117972f},
-std::array<float,2>{0.893386722f, 0.0421256013f},
-std::array<float,2>{0.180488363f, 0.504900515f},
-std::array<float,2>{0.538936853f, 0.773085058f},
-std::array<float,2>{0.491370469f, 0.482188731f},
-std::array<float,2>{0.915814817f, 0.493184239f},
-std::array<float,2>{0.141529471f, 0.762029827f},
-std::array<float,2>{0.527522147f, 0.519728661f},
-std::array<float,2>{0.46844691f, 0.0596518964f},
-std::array<float,2>{0.650236845f, 0.146685794f},
-std::array<float,2>{0.32850793f, 0.671472371f},
-std::array<float,2>{0.755319059f, 0.967767894f},
-std::array<float,2>{0.083287999f, 0.281412482f},
-std::array<float,2>{0.583768189f, 0.369269818f},
-std::array<float,2>{0.422051877f, 0.924782991f},
-std::array<float,2>{0.995012581f, 0.697685897f},
-std::array<float,2>{0.193507165f, 0.205398679f},
-std::array<float,2>{0.828973949f, 0.0847033188f},
-std::array<float,2>{0.0464814343f, 0.570982099f},
-std::array<float,2>{0.741552114f, 0.833339572f},
-std::array<float,2>{0.304613292f, 0.413856059f},
-std::array<float,2>{0.796870112f, 0.274196178f},
-std::array<float,2>{0.113025084f, 0.975312591f},
-std::array<float,2>{0.66914916f, 0.654442728f},
-std::array<float,2>{0.357738018f, 0.1701487f},
-std::array<float,2>{0.557908058f, 0.0152926287f},
-std::array<float,2>{0.479944199f, 0.55977422f},
-std::array<float,2>{0.879785061f, 0.791616201f},
-std::array<float,2>{0.168145657f, 0.462135524f},
-std::array<float,2>{0.706881881f, 0.399388552f},
-std::array<float,2>{0.252355993f, 0.848086953f},
-std::array<float,2>{0.852989852f, 0.620804727f},
-std::array<float,2>{0.0107714776f, 0.120674603f},
-std::array<float,2>{0.944867074f, 0.239509657f},
-std::array<float,2>{0.222982749f, 0.738626003f},
-std::array<float,2>{0.594600916f, 0.904227734f},
-std::array<float,2>{0.375634432f, 0.314718395f},
-std::array<float,2>{0.946732521f, 0.262896061f},
-std::array<float,2>{0.226566821f, 0.988878369f},
-std::array<float,2>{0.60913533f, 0.639977574f},
-std::array<float,2>{0.388178617f, 0.187469035f},
-std::array<float,2>{0.715914965f, 0.0285163522f},
-std::array<float,2>{0.259295613f, 0.534689963f},
-std::array<float,2>{0.848658085f, 0.797757626f},
-std::array<float,2>{0.00435231393f, 0.450572222f},
-std::array<float,2>{0.550659537f, 0.380069196f},
-std::array<float,2>{0.471143275f, 0.873128772f},
-std::array<float,2>{0.890582323f, 0.606711805f},
-std::array<float,2>{0.16347225f, 0.0983573124f},
-std::array<float,2>{0.781793118f, 0.230062306f},
-std::array<float,2>{0.123213917f, 0.725446045f},
-std::array<float,2>{0.66114676f, 0.876760066f},
-std::array<float,2>{0.35133943f, 0.333451807f},
-std::array<float,2>{0.837339938f, 0.479679644f},
-std::array<float,2>{0.0319510624f, 0.767379463f},
-std::array<float,2>{0.746707857f, 0.50270772f},
-std::array<float,2>{0.306481242f, 0.0433413759f},
-std::array<float,2>{0.591073394f, 0.125952587f},
-std::array<float,2>{0.431834996f, 0.686636031f},
-std::array<float,2>{0.985453069f, 0.948585987f},
-std::array<float,2>{0.201668873f, 0.309665352f},
-std::array<float,2>{0.64726913f, 0.345046967f},
-std::array<float,2>{0.342403352f, 0.913179338f},
-std::array<float,2>{0.758083582f, 0.716657698f},
-std::array<float,2>{0.0925247595f, 0.202514827f},
-std::array<float,2>{0.910894632f, 0.0661634356f},
-std::array<float,2>{0.154830456f, 0.587026417f},
-std::array<float,2>{0.518624306f, 0.826252401f},
-std::array<float,2>{0.455040723f, 0.425193965f},
-std::array<float,2>{0.902425349f, 0.406292737f},
-std::array<float,2>{0.175009474f, 0.830198586f},
-std::array<float,2>{0.5432235f, 0.576734781f},
-std::array<float,2>{0.497660846f, 0.0788549855f},
-std::array<float,2>{0.675704598f, 0.210319534f},
-std::array<float,2>{0.365174055f, 0.699489892f},
-std::array<float,2>{0.812393606f, 0.929084182f},
-std::array<float,2>{0.0998842716f, 0.373028189f},
-std::array<float,2>{0.613680065f, 0.28857702f},
-std::array<float,2>{0.39247793f, 0.962206781f},
-std::array<float,2>{0.953577816f, 0.665350437f},
-std::array<float,2>{0.243869126f, 0.142358139f},
-std::array<float,2>{0.868914187f, 0.0570270494f},
-std::array<float,2>{0.0243942272f, 0.516067028f},
-std::array<float,2>{0.697629809f, 0.76168859f},
-std::array<float,2>{0.269363016f, 0.497814208f},
-std::array<float,2>{0.775836468f, 0.317675084f},
-std::array<float,2>{0.0696641132f, 0.901755035f},
-std::array<float,2>{0.636350989f, 0.735484481f},
-std::array<float,2>{0.313986212f, 0.235195458f},
-std::array<float,2>{0.511015356f, 0.122947656f},
-std::array<float,2>{0.438087791f, 0.623050332f},
-std::array<float,2>{0.930803537f, 0.844446838f},
-std::array<float,2>{0.127900794f, 0.403820187f},
-std::array<float,2>{0.732111692f, 0.467232645f},
-std::array<float,2>{0.295776486f, 0.796202421f},
-std::array<float,2>{0.817499161f, 0.555049539f},
-std::array<float,2>{0.0609915592f, 0.0108595937f},
-std::array<float,2>{0.973654747f, 0.165110022f},
-std::array<float,2>{0.205590829f, 0.652043879f},
-std::array<float,2>{0.576954484f, 0.969058633f},
-std::array<float,2>{0.418755144f, 0.280570805f},
-std::array<float,2>{0.922546148f, 0.365028501f},
-std::array<float,2>{0.134048909f, 0.931903601f},
-std::array<float,2>{0.506598949f, 0.687663972f},
-std::array<float,2>{0.451859951f, 0.217242956f},
-std::array<float,2>{0.626268983f, 0.0928743407f},
-std::array<float,2>{0.326398313f, 0.565794528f},
-std::array<float,2>{0.771383464f, 0.837842345f},
-std::array<float,2>{0.0753877684f, 0.414814532f},
-std::array<float,2>{0.567991853f, 0.485904366f},
-std::array<float,2>{0.41289261f, 0.754015267f},
-std::array<float,2>{0.979676843f, 0.528977096f},
-std::array<float,2>{0.212517008f, 0.054381825f},
-std::array<float,2>{0.827880263f, 0.148713022f},
-std::array<float,2>{0.054192625f, 0.663315594f},
-std::array<float,2>{0.722011507f, 0.955584228f},
-std::array<float,2>{0.281609327f, 0.295084476f},
-std::array<float,2>{0.797465563f, 0.397669733f},
-std::array<float,2>{0.103684023f, 0.852070212f},
-std::array<float,2>{0.6841591f, 0.615441799f},
-std::array<float,2>{0.372297913f, 0.113029785f},
-std::array<float,2>{0.532446265f, 0.244331807f},
-std::array<float,2>{0.484695375f, 0.746570528f},
-std::array<float,2>{0.894547164f, 0.897568166f},
-std::array<float,2>{0.186708272f, 0.323162198f},
-std::array<float,2>{0.689426303f, 0.266372561f},
-std::array<float,2>{0.275846124f, 0.98001188f},
-std::array<float,2>{0.865023911f, 0.644157648f},
-std::array<float,2>{0.0177044217f, 0.163989335f},
-std::array<float,2>{0.963154614f, 0.000276075996f},
-std::array<float,2>{0.236525714f, 0.550767899f},
-std::array<float,2>{0.621868551f, 0.78678441f},
-std::array<float,2>{0.40390718f, 0.459757745f},
-std::array<float,2>{0.999578357f, 0.437650114f},
-std::array<float,2>{0.189194575f, 0.806728542f},
-std::array<float,2>{0.579856932f, 0.545546591f},
-std::array<float,2>{0.428321928f, 0.0165599231f},
-std::array<float,2>{0.734965086f, 0.172525033f},
-std::array<float,2>{0.298251331f, 0.62960577f},
-std::array<float,2>{0.833904684f, 0.998854637f},
-std::array<float,2>{0.0393686406f, 0.250599444f},
-std::array<float,2>{0.52392149f, 0.341914117f},
-std::array<float,2>{0.461515814f, 0.889676929f},
-std::array<float,2>{0.921078622f, 0.73201412f},
-std::array<float,2>{0.148436576f, 0.222410813f},
-std::array<float,2>{0.750509858f, 0.10636279f},
-std::array<float,2>{0.0803773925f, 0.600182235f},
-std::array<float,2>{0.654323518f, 0.866658866f},
-std::array<float,2>{0.33590737f, 0.389077812f},
-std::array<float,2>{0.858881712f, 0.303527117f},
-std::array<float,2>{0.0117839212f, 0.941572845f},
-std::array<float,2>{0.709536672f, 0.678788781f},
-std::array<float,2>{0.257669449f, 0.132901624f},
-std::array<float,2>{0.601487339f, 0.0323570222f},
-std::array<float,2>{0.382462889f, 0.51472491f},
-std::array<float,2>{0.939192951f, 0.777943671f},
-std::array<float,2>{0.220987946f, 0.473863155f},
-std::array<float,2>{0.667617202f, 0.430688262f},
-std::array<float,2>{0.352726787f, 0.816797197f},
-std::array<float,2>{0.791051865f, 0.580150306f},
-std::array<float,2>{0.11334946f, 0.0773130804f},
-std::array<float,2>{0.878251255f, 0.189758912f},
-std::array<float,2>{0.165682048f, 0.70742619f},
-std::array<float,2>{0.559220791f, 0.918725312f},
-std::array<float,2>{0.482260406f, 0.356157273f},
-std::array<float,2>{0.908939004f, 0.270860106f},
-std::array<float,2>{0.148535162f, 0.981658578f},
-std::array<float,2>{0.519685447f, 0.646636188f},
-std::array<float,2>{0.460599273f, 0.159949556f},
-std::array<float,2>{0.640833735f, 0.0050566257f},
-std::array<float,2>{0.338240892f, 0.553133845f},
-std::array<float,2>{0.763862312f, 0.784363747f},
-std::array<float,2>{0.0892457068f, 0.453261077f},
-std::array<float,2>{0.589527369f, 0.392048597f},
-std::array<float,2>{0.435936689f, 0.858600974f},
-std::array<float,2>{0.989681423f, 0.610641122f},
-std::array<float,2>{0.197368771f, 0.116970032f},
-std::array<float,2>{0.841489732f, 0.247107208f},
-std::array<float,2>{0.0378168784f, 0.74400115f},
-std::array<float,2>{0.743980706f, 0.892446339f},
-std::array<float,2>{0.311774313f, 0.324281275f},
-std::array<float,2>{0.785814703f, 0.491075128f},
-std::array<float,2>{0.119330645f, 0.752320707f},
-std::array<float,2>{0.656849146f, 0.525597751f},
-std::array<float,2>{0.345783323f, 0.0493690409f},
-std::array<float,2>{0.553220451f, 0.15264599f},
-std::array<float,2>{0.475563705f, 0.656640351f},
-std::array<float,2>{0.884912312f, 0.959335446f},
-std::array<float,2>{0.156597927f, 0.289988846f},
-std::array<float,2>{0.713677824f, 0.360429645f},
-std::array<float,2>{0.263654172f, 0.93464458f},
-std::array<float,2>{0.846334279f, 0.691608191f},
-std::array<float,2>{0.00165220315f, 0.214166358f},
-std::array<float,2>{0.951340616f, 0.0875574723f},
-std::array<float,2>{0.232776955f, 0.567298949f},
-std::array<float,2>{0.604415894f, 0.841706932f},
-std::array<float,2>{0.386572003f, 0.42159304f},
-std::array<float,2>{0.969157636f, 0.43460393f},
-std::array<float,2>{0.209912986f, 0.815807462f},
-std::array<float,2>{0.571018755f, 0.584176183f},
-std::array<float,2>{0.416321516f, 0.0726075843f},
-std::array<float,2>{0.728394568f, 0.192963675f},
-std::array<float,2>{0.291718334f, 0.703288972f},
-std::array<float,2>{0.814102173f, 0.916964769f},
-std::array<float,2>{0.0549122244f, 0.354794592f},
-std::array<float,2>{0.514609933f, 0.300313324f},
-std::array<float,2>{0.441559136f, 0.941089094f},
-std::array<float,2>{0.935634732f, 0.673515677f},
-std::array<float,2>{0.131627485f, 0.13876158f},
-std::array<float,2>{0.781094074f, 0.0355947204f},
-std::array<float,2>{0.0649451986f, 0.510358572f},
-std::array<float,2>{0.638221443f, 0.774962306f},
-std::array<float,2>{0.316839308f, 0.469826311f},
-std::array<float,2>{0.874637067f, 0.339455754f},
-std::array<float,2>{0.029078152f, 0.884241343f},
-std::array<float,2>{0.701627016f, 0.728612065f},
-std::array<float,2>{0.269986749f, 0.226459131f},
-std::array<float,2>{0.610589445f, 0.101852141f},
-std::array<float,2>{0.398285717f, 0.594707489f},
-std::array<float,2>{0.958850503f, 0.863271594f},
-std::array<float,2>{0.246528029f, 0.385898471f},
-std::array<float,2>{0.676576614f, 0.441907525f},
-std::array<float,2>{0.362399071f, 0.810200691f},
-std::array<float,2>{0.80628562f, 0.540323853f},
-std::array<float,2>{0.0943532437f, 0.0233612992f},
-std::array<float,2>{0.898889422f, 0.175996602f},
-std::array<float,2>{0.178066358f, 0.628583312f},
-std::array<float,2>{0.542140782f, 0.995061159f},
-std::array<float,2>{0.492743045f, 0.255865663f},
-std::array<float,2>{0.966742933f, 0.348652631f},
-std::array<float,2>{0.239857331f, 0.909515142f},
-std::array<float,2>{0.620164633f, 0.71099323f},
-std::array<float,2>{0.401880413f, 0.197294101f},
-std::array<float,2>{0.692017913f, 0.0667787567f},
-std::array<float,2>{0.279527187f, 0.592740119f},
-std::array<float,2>{0.860538363f, 0.823715448f},
-std::array<float,2>{0.0217439402f, 0.42896986f},
-std::array<float,2>{0.536881685f, 0.483940214f},
-std::array<float,2>{0.488857448f, 0.77029264f},
-std::array<float,2>{0.892059863f, 0.506136477f},
-std::array<float,2>{0.18262209f, 0.0392121747f},
-std::array<float,2>{0.802220345f, 0.129242107f},
-std::array<float,2>{0.106472999f, 0.681765974f},
-std::array<float,2>{0.681421518f, 0.95092845f},
-std::array<float,2>{0.367820084f, 0.307345659f},
-std::array<float,2>{0.820378542f, 0.378561646f},
-std::array<float,2>{0.0484086759f, 0.867365122f},
-std::array<float,2>{0.726370156f, 0.605332494f},
-std::array<float,2>{0.286356598f, 0.0939506739f},
-std::array<float,2>{0.563650072f, 0.23064971f},
-std::array<float,2>{0.40656215f, 0.722400188f},
-std::array<float,2>{0.980624914f, 0.882342517f},
-std::array<float,2>{0.216370657f, 0.330879658f},
-std::array<float,2>{0.632752001f, 0.259979188f},
-std::array<float,2>{0.322441757f, 0.986629426f},
-std::array<float,2>{0.768721759f, 0.634611368f},
-std::array<float,2>{0.0709011331f, 0.180827796f},
-std::array<float,2>{0.929162502f, 0.0258302428f},
-std::array<float,2>{0.137692541f, 0.535562575f},
-std::array<float,2>{0.501960039f, 0.804014444f},
-std::array<float,2>{0.448754758f, 0.446260661f},
-std::array<float,2>{0.881688356f, 0.463261276f},
-std::array<float,2>{0.170961171f, 0.790338933f},
-std::array<float,2>{0.556391299f, 0.560953617f},
-std::array<float,2>{0.477072716f, 0.0132018803f},
-std::array<float,2>{0.670381248f, 0.169744253f},
-std::array<float,2>{0.356459975f, 0.653005481f},
-std::array<float,2>{0.793061078f, 0.973884404f},
-std::array<float,2>{0.111159652f, 0.275993854f},
-std::array<float,2>{0.597338974f, 0.313048065f},
-std::array<float,2>{0.378012151f, 0.905448914f},
-std::array<float,2>{0.941651523f, 0.741253376f},
-std::array<float,2>{0.226231396f, 0.241885781f},
-std::array<float,2>{0.854048729f, 0.118569896f},
-std::array<float,2>{0.0090320278f, 0.618018389f},
-std::array<float,2>{0.704555333f, 0.850149512f},
-std::array<float,2>{0.251949191f, 0.40142712f},
-std::array<float,2>{0.756571114f, 0.284006476f},
-std::array<float,2>{0.0851501375f, 0.966778934f},
-std::array<float,2>{0.650686026f, 0.668840587f},
-std::array<float,2>{0.331745446f, 0.144637555f},
-std::array<float,2>{0.530340314f, 0.0607879385f},
-std::array<float,2>{0.466258705f, 0.521750569f},
-std::array<float,2>{0.916436136f, 0.764299273f},
-std::array<float,2>{0.144517556f, 0.49506259f},
-std::array<float,2>{0.739974797f, 0.411480755f},
-std::array<float,2>{0.302080214f, 0.834286928f},
-std::array<float,2>{0.830660582f, 0.572758079f},
-std::array<float,2>{0.0442768037f, 0.0821646377f},
-std::array<float,2>{0.992548287f, 0.203985751f},
-std::array<float,2>{0.191937655f, 0.697205245f},
-std::array<float,2>{0.584888995f, 0.923021078f},
-std::array<float,2>{0.424639702f, 0.368978858f},
-std::array<float,2>{0.987457097f, 0.311489761f},
-std::array<float,2>{0.20107317f, 0.946870565f},
-std::array<float,2>{0.593325675f, 0.68425411f},
-std::array<float,2>{0.430471092f, 0.127968237f},
-std::array<float,2>{0.749815941f, 0.0454405583f},
-std::array<float,2>{0.307982028f, 0.500435591f},
-std::array<float,2>{0.83853358f, 0.767904162f},
-std::array<float,2>{0.0339391343f, 0.478330135f},
-std::array<float,2>{0.515811741f, 0.423211366f},
-std::array<float,2>{0.455319554f, 0.825311244f},
-std::array<float,2>{0.913104534f, 0.589580476f},
-std::array<float,2>{0.153278902f, 0.0635012016f},
-std::array<float,2>{0.760663211f, 0.200779304f},
-std::array<float,2>{0.0908321366f, 0.717822731f},
-std::array<float,2>{0.646382868f, 0.910218656f},
-std::array<float,2>{0.341556311f, 0.347463697f},
-std::array<float,2>{0.850255609f, 0.451795816f},
-std::array<float,2>{0.00677029509f, 0.800376475f},
-std::array<float,2>{0.71846652f, 0.531492949f},
-std::array<float,2>{0.261397988f, 0.0311124362f},
-std::array<float,2>{0.606883705f, 0.183994249f},
-std::array<float,2>{0.390205294f, 0.638077617f},
-std::array<float,2>{0.948236704f, 0.990983188f},
-std::array<float,2>{0.230374038f, 0.263954133f},
-std::array<float,2>{0.663600147f, 0.335769117f},
-std::array<float,2>{0.348368108f, 0.87862426f},
-std::array<float,2>{0.783853471f, 0.723931313f},
-std::array<float,2>{0.12148542f, 0.226886615f},
-std::array<float,2>{0.887153447f, 0.100237027f},
-std::array<float,2>{0.160301462f, 0.609321117f},
-std::array<float,2>{0.54719609f, 0.871470153f},
-std::array<float,2>{0.470002502f, 0.38191843f},
-std::array<float,2>{0.932399392f, 0.405600727f},
-std::array<float,2>{0.126149446f, 0.847591758f},
-std::array<float,2>{0.507957578f, 0.622137606f},
-std::array<float,2>{0.439612538f, 0.123445995f},
-std::array<float,2>{0.633679628f, 0.236974895f},
-std::array<float,2>{0.31447652f, 0.736462653f},
-std::array<float,2>{0.773498774f, 0.900378585f},
-std::array<float,2>{0.0673700199f, 0.320283204f},
-std::array<float,2>{0.575769365f, 0.278866649f},
-std::array<float,2>{0.421085566f, 0.972454131f},
-std::array<float,2>{0.975751162f, 0.649809539f},
-std::array<float,2>{0.204562724f, 0.166962877f},
-std::array<float,2>{0.818752885f, 0.00917666871f},
-std::array<float,2>{0.0586186275f, 0.557390511f},
-std::array<float,2>{0.733118951f, 0.793939352f},
-std::array<float,2>{0.293117523f, 0.465233117f},
-std::array<float,2>{0.810125291f, 0.374535292f},
-std::array<float,2>{0.0980824679f, 0.926759362f},
-std::array<float,2>{0.671949208f, 0.702516496f},
-std::array<float,2>{0.365315974f, 0.208483651f},
-std::array<float,2>{0.546723425f, 0.0812178999f},
-std::array<float,2>{0.499669969f, 0.575236678f},
-std::array<float,2>{0.904460311f, 0.829894722f},
-std::array<float,2>{0.173485577f, 0.409159154f},
-std::array<float,2>{0.696089268f, 0.49884966f},
-std::array<float,2>{0.26744929f, 0.758510351f},
-std::array<float,2>{0.869989276f, 0.518662751f},
-std::array<float,2>{0.0265355501f, 0.0553711392f},
-std::array<float,2>{0.95589602f, 0.143914744f},
-std::array<float,2>{0.245352179f, 0.667888701f},
-std::array<float,2>{0.616852582f, 0.963141263f},
-std::array<float,2>{0.393490642f, 0.2864905f},
-std::array<float,2>{0.898086071f, 0.320369691f},
-std::array<float,2>{0.185472757f, 0.895592511f},
-std::array<float,2>{0.534339309f, 0.749623001f},
-std::array<float,2>{0.48680377f, 0.242785007f},
-std::array<float,2>{0.686021924f, 0.110512666f},
-std::array<float,2>{0.374218553f, 0.61361146f},
-std::array<float,2>{0.800711513f, 0.853917181f},
-std::array<float,2>{0.101915486f, 0.39595899f},
-std::array<float,2>{0.624186933f, 0.457437307f},
-std::array<float,2>{0.405966103f, 0.787942052f},
-std::array<float,2>{0.962504923f, 0.54872936f},
-std::array<float,2>{0.235546604f, 0.00292188744f},
-std::array<float,2>{0.866768599f, 0.161949471f},
-std::array<float,2>{0.0163028762f, 0.641834676f},
-std::array<float,2>{0.691102147f, 0.976934195f},
-std::array<float,2>{0.275301158f, 0.26936391f},
-std::array<float,2>{0.772596359f, 0.416659325f},
-std::array<float,2>{0.0763012543f, 0.838957131f},
-std::array<float,2>{0.62803781f, 0.564001799f},
-std::array<float,2>{0.325487316f, 0.0910105854f},
-std::array<float,2>{0.505515277f, 0.215310454f},
-std::array<float,2>{0.450817078f, 0.690390468f},
-std::array<float,2>{0.923839271f, 0.931400657f},
-std::array<float,2>{0.136196762f, 0.365464509f},
-std::array<float,2>{0.720056295f, 0.293310583f},
-std::array<float,2>{0.285016775f, 0.954997122f},
-std::array<float,2>{0.824376941f, 0.66170305f},
-std::array<float,2>{0.0512385443f, 0.152240202f},
-std::array<float,2>{0.977925301f, 0.052169174f},
-std::array<float,2>{0.214300618f, 0.530477703f},
-std::array<float,2>{0.569643557f, 0.757788718f},
-std::array<float,2>{0.411135137f, 0.487982929f},
-std::array<float,2>{0.939712942f, 0.476412296f},
-std::array<float,2>{0.220247447f, 0.779690325f},
-std::array<float,2>{0.598463356f, 0.511835158f},
-std::array<float,2>{0.37948674f, 0.0345023535f},
-std::array<float,2>{0.708017647f, 0.136393949f},
-std::array<float,2>{0.255001515f, 0.676044881f},
-std::array<float,2>{0.857075751f, 0.9444893f},
-std::array<float,2>{0.0153043447f, 0.301106483f},
-std::array<float,2>{0.5616166f, 0.357700318f},
-std::array<float,2>{0.484062463f, 0.921428144f},
-std::array<float,2>{0.87620765f, 0.709101737f},
-std::array<float,2>{0.167746484f, 0.187503338f},
-std::array<float,2>{0.790228248f, 0.074373737f},
-std::array<float,2>{0.116558895f, 0.57939887f},
-std::array<float,2>{0.664661407f, 0.818739593f},
-std::array<float,2>{0.354170561f, 0.432284057f},
-std::array<float,2>{0.835285246f, 0.253872395f},
-std::array<float,2>{0.0419561006f, 0.996594429f},
-std::array<float,2>{0.736986458f, 0.631031334f},
-std::array<float,2>{0.300078362f, 0.174699992f},
-std::array<float,2>{0.581781685f, 0.0179307628f},
-std::array<float,2>{0.426227808f, 0.543469548f},
-std::array<float,2>{0.997224867f, 0.805186152f},
-std::array<float,2>{0.191202715f, 0.440105766f},
-std::array<float,2>{0.653744459f, 0.387360543f},
-std::array<float,2>{0.332333654f, 0.864454389f},
-std::array<float,2>{0.752167583f, 0.5978356f},
-std::array<float,2>{0.0781359747f, 0.107636176f},
-std::array<float,2>{0.918542266f, 0.220692471f},
-std::array<float,2>{0.146446034f, 0.733333826f},
-std::array<float,2>{0.525667131f, 0.886742234f},
-std::array<float,2>{0.463764787f, 0.340829968f},
-std::array<float,2>{0.913567007f, 0.308994979f},
-std::array<float,2>{0.153058082f, 0.947515428f},
-std::array<float,2>{0.516028941f, 0.685934782f},
-std::array<float,2>{0.45541966f, 0.126270652f},
-std::array<float,2>{0.64616859f, 0.0447869152f},
-std::array<float,2>{0.341329545f, 0.503138304f},
-std::array<float,2>{0.760429859f, 0.765851736f},
-std::array<float,2>{0.0913016796f, 0.479188442f},
-std::array<float,2>{0.593727767f, 0.423975468f},
-std::array<float,2>{0.430412561f, 0.827794611f},
-std::array<float,2>{0.987777174f, 0.586118281f},
-std::array<float,2>{0.200746059f, 0.0653640255f},
-std::array<float,2>{0.838829041f, 0.201821208f},
-std::array<float,2>{0.0338635221f, 0.715645969f},
-std::array<float,2>{0.749588072f, 0.912700593f},
-std::array<float,2>{0.307717562f, 0.344590157f},
-std::array<float,2>{0.783951759f, 0.449596822f},
-std::array<float,2>{0.121243849f, 0.798680782f},
-std::array<float,2>{0.663851976f, 0.53342706f},
-std::array<float,2>{0.348599583f, 0.0279046949f},
-std::array<float,2>{0.546930075f, 0.186140195f},
-std::array<float,2>{0.469942182f, 0.639297843f},
-std::array<float,2>{0.886950612f, 0.98967278f},
-std::array<float,2>{0.160499573f, 0.262476802f},
-std::array<float,2>{0.71858108f, 0.33237806f},
-std::array<float,2>{0.261673182f, 0.875094295f},
-std::array<float,2>{0.85054332f, 0.725749791f},
-std::array<float,2>{0.00656270934f, 0.228736535f},
-std::array<float,2>{0.94789654f, 0.0991607159f},
-std::array<float,2>{0.230096593f, 0.605573833f},
-std::array<float,2>{0.606592953f, 0.874056697f},
-std::array<float,2>{0.390551716f, 0.379703164f},
-std::array<float,2>{0.976065159f, 0.40312165f},
-std::array<float,2>{0.204264641f, 0.845456123f},
-std::array<float,2>{0.576017857f, 0.624038458f},
-std::array<float,2>{0.42133677f, 0.121669263f},
-std::array<float,2>{0.733375669f, 0.23538366f},
-std::array<float,2>{0.293391526f, 0.734454274f},
-std::array<float,2>{0.818564653f, 0.901117384f},
-std::array<float,2>{0.0590086654f, 0.316432029f},
-std::array<float,2>{0.508063376f, 0.280253649f},
-std::array<float,2>{0.43983233f, 0.970055044f},
-std::array<float,2>{0.93236053f, 0.651050389f},
-std::array<float,2>{0.126284257f, 0.164314404f},
-std::array<float,2>{0.773771524f, 0.0101005742f},
-std::array<float,2>{0.0670422167f, 0.556227148f},
-std::array<float,2>{0.633372903f, 0.795379817f},
-std::array<float,2>{0.314742297f, 0.468124598f},
-std::array<float,2>{0.869698286f, 0.371682256f},
-std::array<float,2>{0.0267016981f, 0.928525567f},
-std::array<float,2>{0.695886552f, 0.700329125f},
-std::array<float,2>{0.267113686f, 0.209110975f},
-std::array<float,2>{0.617025733f, 0.0796290413f},
-std::array<float,2>{0.393286556f, 0.577532589f},
-std::array<float,2>{0.955709755f, 0.831100762f},
-std::array<float,2>{0.245505348f, 0.407227278f},
-std::array<float,2>{0.672242641f, 0.496469408f},
-std::array<float,2>{0.365592003f, 0.76003933f},
-std::array<float,2>{0.810341835f, 0.517270923f},
-std::array<float,2>{0.0976760089f, 0.0580025613f},
-std::array<float,2>{0.904760838f, 0.141532347f},
-std::array<float,2>{0.173823982f, 0.664273918f},
-std::array<float,2>{0.546597183f, 0.961607516f},
-std::array<float,2>{0.499844998f, 0.287384421f},
-std::array<float,2>{0.962843418f, 0.323438883f},
-std::array<float,2>{0.235654786f, 0.897061765f},
-std::array<float,2>{0.624347806f, 0.747996628f},
-std::array<float,2>{0.406151623f, 0.245604023f},
-std::array<float,2>{0.69139576f, 0.111363463f},
-std::array<float,2>{0.27495563f, 0.616308212f},
-std::array<float,2>{0.86706841f, 0.853168845f},
-std::array<float,2>{0.0164787043f, 0.397051036f},
-std::array<float,2>{0.534613907f, 0.460427314f},
-std::array<float,2>{0.486366749f, 0.785246313f},
-std::array<float,2>{0.898358822f, 0.549027503f},
-std::array<float,2>{0.18507117f, 0.00132310169f},
-std::array<float,2>{0.800377071f, 0.16233924f},
-std::array<float,2>{0.101759717f, 0.642933249f},
-std::array<float,2>{0.685702443f, 0.979124129f},
-std::array<float,2>{0.374473304f, 0.267403066f},
-std::array<float,2>{0.824699759f, 0.415696889f},
-std::array<float,2>{0.0509043634f, 0.836245f},
-std::array<float,2>{0.719875693f, 0.564941287f},
-std::array<float,2>{0.284732044f, 0.0926249847f},
-std::array<float,2>{0.569467306f, 0.218647629f},
-std::array<float,2>{0.411402792f, 0.688723922f},
-std::array<float,2>{0.977573156f, 0.933417499f},
-std::array<float,2>{0.213871107f, 0.363508642f},
-std::array<float,2>{0.62837863f, 0.296526164f},
-std::array<float,2>{0.325439125f, 0.956895351f},
-std::array<float,2>{0.772881925f, 0.662529469f},
-std::array<float,2>{0.0765421093f, 0.149502784f},
-std::array<float,2>{0.924165189f, 0.0533549897f},
-std::array<float,2>{0.135950983f, 0.527628899f},
-std::array<float,2>{0.50571537f, 0.755269647f},
-std::array<float,2>{0.451062411f, 0.48500675f},
-std::array<float,2>{0.876376092f, 0.473460674f},
-std::array<float,2>{0.167502224f, 0.778561532f},
-std::array<float,2>{0.561906815f, 0.513737977f},
-std::array<float,2>{0.484178483f, 0.0313899666f},
-std::array<float,2>{0.665012717f, 0.133851364f},
-std::array<float,2>{0.354286283f, 0.678556085f},
-std::array<float,2>{0.790433109f, 0.942547441f},
-std::array<float,2>{0.116360039f, 0.304450482f},
-std::array<float,2>{0.598190188f, 0.356734127f},
-std::array<float,2>{0.379834116f, 0.919385016f},
-std::array<float,2>{0.939588487f, 0.708570421f},
-std::array<float,2>{0.220479727f, 0.191202164f},
-std::array<float,2>{0.857346773f, 0.0768166929f},
-std::array<float,2>{0.0156140355f, 0.581073999f},
-std::array<float,2>{0.708465576f, 0.817458451f},
-std::array<float,2>{0.255354196f, 0.430149972f},
-std::array<float,2>{0.752314448f, 0.251559973f},
-std::array<float,2>{0.0784454569f, 0.999192059f},
-std::array<float,2>{0.653513551f, 0.629900873f},
-std::array<float,2>{0.332052827f, 0.172883675f},
-std::array<float,2>{0.525586009f, 0.0169358831f},
-std::array<float,2>{0.463519305f, 0.546492398f},
-std::array<float,2>{0.918821275f, 0.807844639f},
-std::array<float,2>{0.14623037f, 0.439250648f},
-std::array<float,2>{0.737090886f, 0.390024602f},
-std::array<float,2>{0.299949586f, 0.865362525f},
-std::array<float,2>{0.835105956f, 0.601101458f},
-std::array<float,2>{0.0417254567f, 0.107172392f},
-std::array<float,2>{0.997436166f, 0.22095634f},
-std::array<float,2>{0.191003785f, 0.730989993f},
-std::array<float,2>{0.581871152f, 0.889170527f},
-std::array<float,2>{0.42602101f, 0.342930943f},
-std::array<float,2>{0.989308059f, 0.273020834f},
-std::array<float,2>{0.197694868f, 0.982717633f},
-std::array<float,2>{0.589791715f, 0.645573795f},
-std::array<float,2>{0.435556382f, 0.157683238f},
-std::array<float,2>{0.743833899f, 0.0062740678f},
-std::array<float,2>{0.311758995f, 0.551570415f},
-std::array<float,2>{0.841755211f, 0.782506764f},
-std::array<float,2>{0.0379941612f, 0.455916852f},
-std::array<float,2>{0.51983428f, 0.393897086f},
-std::array<float,2>{0.460875481f, 0.855983257f},
-std::array<float,2>{0.908853531f, 0.61233139f},
-std::array<float,2>{0.148906052f, 0.114654414f},
-std::array<float,2>{0.764018357f, 0.248183191f},
-std::array<float,2>{0.0891089141f, 0.744342983f},
-std::array<float,2>{0.641071737f, 0.892723918f},
-std::array<float,2>{0.338016689f, 0.326609552f},
-std::array<float,2>{0.846568048f, 0.489493847f},
-std::array<float,2>{0.00172637764f, 0.751370132f},
-std::array<float,2>{0.713571072f, 0.524390638f},
-std::array<float,2>{0.263278931f, 0.0487792045f},
-std::array<float,2>{0.604090989f, 0.154615656f},
-std::array<float,2>{0.38644138f, 0.658351421f},
-std::array<float,2>{0.951459408f, 0.958812296f},
-std::array<float,2>{0.232532918f, 0.291082025f},
-std::array<float,2>{0.657103777f, 0.361854076f},
-std::array<float,2>{0.346047729f, 0.936577082f},
-std::array<float,2>{0.785991609f, 0.695259988f},
-std::array<float,2>{0.119440049f, 0.212180376f},
-std::array<float,2>{0.885048449f, 0.0898151696f},
-std::array<float,2>{0.156337827f, 0.570229232f},
-std::array<float,2>{0.552811861f, 0.842425525f},
-std::array<float,2>{0.475308746f, 0.41821f},
-std::array<float,2>{0.935851872f, 0.437036812f},
-std::array<float,2>{0.131531864f, 0.813313782f},
-std::array<float,2>{0.51440078f, 0.582690716f},
-std::array<float,2>{0.441891104f, 0.0717532784f},
-std::array<float,2>{0.638667643f, 0.194456071f},
-std::array<float,2>{0.316626549f, 0.706959307f},
-std::array<float,2>{0.780824482f, 0.915302336f},
-std::array<float,2>{0.0653506815f, 0.353144288f},
-std::array<float,2>{0.571058154f, 0.298293442f},
-std::array<float,2>{0.416066289f, 0.938397825f},
-std::array<float,2>{0.968948424f, 0.674588799f},
-std::array<float,2>{0.209695667f, 0.138144284f},
-std::array<float,2>{0.814355731f, 0.0383182727f},
-std::array<float,2>{0.0549858175f, 0.50832963f},
-std::array<float,2>{0.728241384f, 0.776695609f},
-std::array<float,2>{0.291930914f, 0.471025497f},
-std::array<float,2>{0.806432605f, 0.336891204f},
-std::array<float,2>{0.0944865942f, 0.885203898f},
-std::array<float,2>{0.676434636f, 0.727762997f},
-std::array<float,2>{0.362711757f, 0.222803935f},
-std::array<float,2>{0.542352736f, 0.105466709f},
-std::array<float,2>{0.493120492f, 0.596485436f},
-std::array<float,2>{0.898514748f, 0.860623717f},
-std::array<float,2>{0.177769586f, 0.382873803f},
-std::array<float,2>{0.701177001f, 0.44488591f},
-std::array<float,2>{0.269758224f, 0.81248492f},
-std::array<float,2>{0.874774814f, 0.541803896f},
-std::array<float,2>{0.0290063266f, 0.0202285983f},
-std::array<float,2>{0.9586941f, 0.179666057f},
-std::array<float,2>{0.246214047f, 0.625195324f},
-std::array<float,2>{0.610643625f, 0.993241608f},
-std::array<float,2>{0.398026645f, 0.254603297f},
-std::array<float,2>{0.89163202f, 0.349842519f},
-std::array<float,2>{0.183089688f, 0.907853961f},
-std::array<float,2>{0.536850095f, 0.713160932f},
-std::array<float,2>{0.489142746f, 0.195924342f},
-std::array<float,2>{0.681325078f, 0.0688579157f},
-std::array<float,2>{0.368074924f, 0.590820789f},
-std::array<float,2>{0.80187726f, 0.820390046f},
-std::array<float,2>{0.106829271f, 0.427060485f},
-std::array<float,2>{0.620478034f, 0.480900466f},
-std::array<float,2>{0.402157038f, 0.772100568f},
-std::array<float,2>{0.966470122f, 0.503921866f},
-std::array<float,2>{0.240027696f, 0.0416731499f},
-std::array<float,2>{0.860798657f, 0.132690817f},
-std::array<float,2>{0.0216705706f, 0.679905593f},
-std::array<float,2>{0.692310214f, 0.952515125f},
-std::array<float,2>{0.279685497f, 0.305135459f},
-std::array<float,2>{0.768880665f, 0.376026243f},
-std::array<float,2>{0.0710542127f, 0.869231224f},
-std::array<float,2>{0.632341325f, 0.602505326f},
-std::array<float,2>{0.322687447f, 0.0967936665f},
-std::array<float,2>{0.502341628f, 0.233053699f},
-std::array<float,2>{0.44916293f, 0.719352007f},
-std::array<float,2>{0.928785861f, 0.879944503f},
-std::array<float,2>{0.137248278f, 0.3285245f},
-std::array<float,2>{0.726226628f, 0.259558529f},
-std::array<float,2>{0.286463052f, 0.986213088f},
-std::array<float,2>{0.82079941f, 0.636067867f},
-std::array<float,2>{0.0487400554f, 0.182179183f},
-std::array<float,2>{0.98071301f, 0.0252694208f},
-std::array<float,2>{0.216623008f, 0.537112415f},
-std::array<float,2>{0.563763022f, 0.80207181f},
-std::array<float,2>{0.406450391f, 0.448526442f},
-std::array<float,2>{0.941423237f, 0.461442083f},
-std::array<float,2>{0.226397663f, 0.792114735f},
-std::array<float,2>{0.597489774f, 0.558724642f},
-std::array<float,2>{0.378283739f, 0.0138960639f},
-std::array<float,2>{0.704292953f, 0.171516523f},
-std::array<float,2>{0.251689047f, 0.656070888f},
-std::array<float,2>{0.854271233f, 0.975614369f},
-std::array<float,2>{0.00912013929f, 0.274918944f},
-std::array<float,2>{0.556493878f, 0.315518707f},
-std::array<float,2>{0.477514148f, 0.903131604f},
-std::array<float,2>{0.881478906f, 0.739818215f},
-std::array<float,2>{0.171170145f, 0.238669097f},
-std::array<float,2>{0.793242395f, 0.120053604f},
-std::array<float,2>{0.111024439f, 0.619986951f},
-std::array<float,2>{0.670142949f, 0.84938997f},
-std::array<float,2>{0.356795251f, 0.399483055f},
-std::array<float,2>{0.830829859f, 0.282639116f},
-std::array<float,2>{0.0441117324f, 0.968665659f},
-std::array<float,2>{0.740021586f, 0.669948578f},
-std::array<float,2>{0.301815599f, 0.147725806f},
-std::array<float,2>{0.584705532f, 0.0587938093f},
-std::array<float,2>{0.424392939f, 0.520964265f},
-std::array<float,2>{0.992259264f, 0.763154745f},
-std::array<float,2>{0.192157075f, 0.492822915f},
-std::array<float,2>{0.650534034f, 0.412611693f},
-std::array<float,2>{0.331887662f, 0.832192719f},
-std::array<float,2>{0.756738901f, 0.572095275f},
-std::array<float,2>{0.0853352249f, 0.0852778628f},
-std::array<float,2>{0.916141093f, 0.206446648f},
-std::array<float,2>{0.144262299f, 0.698663831f},
-std::array<float,2>{0.530595839f, 0.925313592f},
-std::array<float,2>{0.465926826f, 0.370794922f},
-std::array<float,2>{0.890301228f, 0.265295476f},
-std::array<float,2>{0.163235664f, 0.991301835f},
-std::array<float,2>{0.550484896f, 0.637177587f},
-std::array<float,2>{0.470834255f, 0.185392663f},
-std::array<float,2>{0.661404312f, 0.0294100177f},
-std::array<float,2>{0.351132631f, 0.532671034f},
-std::array<float,2>{0.782217264f, 0.799710214f},
-std::array<float,2>{0.123408705f, 0.452482164f},
-std::array<float,2>{0.608912826f, 0.381245911f},
-std::array<float,2>{0.387935549f, 0.872324169f},
-std::array<float,2>{0.946332991f, 0.607452571f},
-std::array<float,2>{0.226865247f, 0.101516746f},
-std::array<float,2>{0.849027991f, 0.22797367f},
-std::array<float,2>{0.00396070909f, 0.723255813f},
-std::array<float,2>{0.716220737f, 0.877784371f},
-std::array<float,2>{0.259626269f, 0.334818035f},
-std::array<float,2>{0.757877529f, 0.476731509f},
-std::array<float,2>{0.0927528515f, 0.769487023f},
-std::array<float,2>{0.647119224f, 0.501493454f},
-std::array<float,2>{0.342645854f, 0.0460098386f},
-std::array<float,2>{0.518926322f, 0.127848417f},
-std::array<float,2>{0.454660386f, 0.685091972f},
-std::array<float,2>{0.910647154f, 0.945785761f},
-std::array<float,2>{0.155125752f, 0.312495083f},
-std::array<float,2>{0.747054398f, 0.346407682f},
-std::array<float,2>{0.306183249f, 0.911156237f},
-std::array<float,2>{0.837127626f, 0.716857314f},
-std::array<float,2>{0.0321124233f, 0.199642777f},
-std::array<float,2>{0.985718012f, 0.0630812719f},
-std::array<float,2>{0.202006325f, 0.588355243f},
-std::array<float,2>{0.59095037f, 0.824822366f},
-std::array<float,2>{0.432023764f, 0.422419727f},
-std::array<float,2>{0.953157604f, 0.409917563f},
-std::array<float,2>{0.244124636f, 0.828818321f},
-std::array<float,2>{0.613425374f, 0.574776471f},
-std::array<float,2>{0.39209038f, 0.0806149766f},
-std::array<float,2>{0.697396874f, 0.207336023f},
-std::array<float,2>{0.269194543f, 0.701963663f},
-std::array<float,2>{0.868691266f, 0.926537275f},
-std::array<float,2>{0.0239812434f, 0.373115718f},
-std::array<float,2>{0.543066502f, 0.285713136f},
-std::array<float,2>{0.497856259f, 0.964603961f},
-std::array<float,2>{0.902620196f, 0.666156411f},
-std::array<float,2>{0.175252095f, 0.142845705f},
-std::array<float,2>{0.812018096f, 0.0563111901f},
-std::array<float,2>{0.0997518972f, 0.518324912f},
-std::array<float,2>{0.675428152f, 0.759328067f},
-std::array<float,2>{0.364984781f, 0.499945045f},
-std::array<float,2>{0.817851424f, 0.318424135f},
-std::array<float,2>{0.0606233254f, 0.898613214f},
-std::array<float,2>{0.73219794f, 0.737391949f},
-std::array<float,2>{0.295599371f, 0.237309799f},
-std::array<float,2>{0.576762617f, 0.1248421f},
-std::array<float,2>{0.418531418f, 0.621387601f},
-std::array<float,2>{0.974057674f, 0.846098423f},
-std::array<float,2>{0.205877289f, 0.404333979f},
-std::array<float,2>{0.636538625f, 0.466577619f},
-std::array<float,2>{0.314401716f, 0.794895709f},
-std::array<float,2>{0.775458336f, 0.558122993f},
-std::array<float,2>{0.0693794489f, 0.00867189001f},
-std::array<float,2>{0.93105942f, 0.167910576f},
-std::array<float,2>{0.127502695f, 0.649285018f},
-std::array<float,2>{0.510850906f, 0.970783055f},
-std::array<float,2>{0.438441902f, 0.277711391f},
-std::array<float,2>{0.979969025f, 0.366248369f},
-std::array<float,2>{0.21277757f, 0.930049956f},
-std::array<float,2>{0.568308294f, 0.691139817f},
-std::array<float,2>{0.412600189f, 0.216459438f},
-std::array<float,2>{0.721871734f, 0.090196088f},
-std::array<float,2>{0.281441718f, 0.562856019f},
-std::array<float,2>{0.828044355f, 0.838102102f},
-std::array<float,2>{0.0537910834f, 0.417116255f},
-std::array<float,2>{0.506359577f, 0.486765862f},
-std::array<float,2>{0.452103674f, 0.756293297f},
-std::array<float,2>{0.922760904f, 0.529776752f},
-std::array<float,2>{0.133980185f, 0.0514654852f},
-std::array<float,2>{0.771037519f, 0.151032552f},
-std::array<float,2>{0.0756050721f, 0.660910606f},
-std::array<float,2>{0.626106918f, 0.953415275f},
-std::array<float,2>{0.326611817f, 0.29488638f},
-std::array<float,2>{0.864970386f, 0.395231068f},
-std::array<float,2>{0.0180188734f, 0.854921222f},
-std::array<float,2>{0.689032853f, 0.614775062f},
-std::array<float,2>{0.275499046f, 0.109895229f},
-std::array<float,2>{0.621611893f, 0.243795574f},
-std::array<float,2>{0.40423575f, 0.748273313f},
-std::array<float,2>{0.962902486f, 0.895491242f},
-std::array<float,2>{0.236640304f, 0.322125107f},
-std::array<float,2>{0.684531987f, 0.268283814f},
-std::array<float,2>{0.372431338f, 0.977600276f},
-std::array<float,2>{0.797722876f, 0.641582131f},
-std::array<float,2>{0.103969142f, 0.16060178f},
-std::array<float,2>{0.894928992f, 0.00338066183f},
-std::array<float,2>{0.186955109f, 0.547537446f},
-std::array<float,2>{0.532617807f, 0.788987279f},
-std::array<float,2>{0.484566867f, 0.458755165f},
-std::array<float,2>{0.921184301f, 0.440444976f},
-std::array<float,2>{0.14809674f, 0.806276202f},
-std::array<float,2>{0.523611546f, 0.544416189f},
-std::array<float,2>{0.461844444f, 0.0189497173f},
-std::array<float,2>{0.654736876f, 0.175715819f},
-std::array<float,2>{0.335565805f, 0.632400751f},
-std::array<float,2>{0.75080663f, 0.99772948f},
-std::array<float,2>{0.0801615715f, 0.252894163f},
-std::array<float,2>{0.579630256f, 0.340292901f},
-std::array<float,2>{0.428680271f, 0.88784498f},
-std::array<float,2>{0.99982357f, 0.733886659f},
-std::array<float,2>{0.189434335f, 0.219703376f},
-std::array<float,2>{0.833498836f, 0.108407617f},
-std::array<float,2>{0.0391703136f, 0.599110484f},
-std::array<float,2>{0.735236108f, 0.863770366f},
-std::array<float,2>{0.298008323f, 0.388645589f},
-std::array<float,2>{0.791430593f, 0.301825225f},
-std::array<float,2>{0.113648601f, 0.944141924f},
-std::array<float,2>{0.66787833f, 0.67747736f},
-std::array<float,2>{0.352976948f, 0.135536447f},
-std::array<float,2>{0.55938518f, 0.0335758664f},
-std::array<float,2>{0.48202306f, 0.51366812f},
-std::array<float,2>{0.878130198f, 0.781180799f},
-std::array<float,2>{0.165865347f, 0.474716693f},
-std::array<float,2>{0.709720314f, 0.43337509f},
-std::array<float,2>{0.257468432f, 0.819403052f},
-std::array<float,2>{0.858449101f, 0.578476667f},
-std::array<float,2>{0.0120234517f, 0.0756159648f},
-std::array<float,2>{0.939339101f, 0.189434245f},
-std::array<float,2>{0.220943674f, 0.710721493f},
-std::array<float,2>{0.601187229f, 0.920414686f},
-std::array<float,2>{0.382580578f, 0.3585504f},
-std::array<float,2>{0.950695276f, 0.290056318f},
-std::array<float,2>{0.23174499f, 0.960244596f},
-std::array<float,2>{0.60330826f, 0.658003867f},
-std::array<float,2>{0.383986056f, 0.1533418f},
-std::array<float,2>{0.711054385f, 0.0506448448f},
-std::array<float,2>{0.263709247f, 0.526977122f},
-std::array<float,2>{0.844234347f, 0.753693819f},
-std::array<float,2>{0.00312398816f, 0.49178496f},
-std::array<float,2>{0.551898777f, 0.420850128f},
-std::array<float,2>{0.473010004f, 0.840418458f},
-std::array<float,2>{0.883056879f, 0.567445278f},
-std::array<float,2>{0.159564435f, 0.0862547532f},
-std::array<float,2>{0.788549662f, 0.213459224f},
-std::array<float,2>{0.118679889f, 0.692438602f},
-std::array<float,2>{0.659267843f, 0.933723688f},
-std::array<float,2>{0.343917727f, 0.359666586f},
-std::array<float,2>{0.843123078f, 0.454953402f},
-std::array<float,2>{0.0369280577f, 0.783529222f},
-std::array<float,2>{0.746003568f, 0.554276705f},
-std::array<float,2>{0.30869779f, 0.00487152813f},
-std::array<float,2>{0.587664545f, 0.158237368f},
-std::array<float,2>{0.433986634f, 0.647560418f},
-std::array<float,2>{0.991416395f, 0.980755091f},
-std::array<float,2>{0.19682847f, 0.269542962f},
-std::array<float,2>{0.643306911f, 0.325829864f},
-std::array<float,2>{0.337736577f, 0.890866101f},
-std::array<float,2>{0.762991369f, 0.742288709f},
-std::array<float,2>{0.086581625f, 0.246714145f},
-std::array<float,2>{0.907681406f, 0.115446806f},
-std::array<float,2>{0.151885763f, 0.610105157f},
-std::array<float,2>{0.522950113f, 0.857706308f},
-std::array<float,2>{0.458535105f, 0.390743941f},
-std::array<float,2>{0.901600718f, 0.384815544f},
-std::array<float,2>{0.177497968f, 0.861816823f},
-std::array<float,2>{0.539426565f, 0.595160902f},
-std::array<float,2>{0.495390654f, 0.10267783f},
-std::array<float,2>{0.679572463f, 0.225283727f},
-std::array<float,2>{0.359716892f, 0.73022002f},
-std::array<float,2>{0.807895005f, 0.883377314f},
-std::array<float,2>{0.0959124342f, 0.33810848f},
-std::array<float,2>{0.612239897f, 0.25688839f},
-std::array<float,2>{0.395010263f, 0.99543196f},
-std::array<float,2>{0.960072875f, 0.627894163f},
-std::array<float,2>{0.248181298f, 0.177069634f},
-std::array<float,2>{0.871732295f, 0.0216520634f},
-std::array<float,2>{0.0306558274f, 0.53951782f},
-std::array<float,2>{0.700409591f, 0.809540927f},
-std::array<float,2>{0.272544503f, 0.442384183f},
-std::array<float,2>{0.778729856f, 0.353536606f},
-std::array<float,2>{0.0642939508f, 0.917003989f},
-std::array<float,2>{0.639083743f, 0.704571486f},
-std::array<float,2>{0.319751829f, 0.191614538f},
-std::array<float,2>{0.512659609f, 0.0732886195f},
-std::array<float,2>{0.445310265f, 0.585083187f},
-std::array<float,2>{0.935527146f, 0.815323472f},
-std::array<float,2>{0.129327148f, 0.433899432f},
-std::array<float,2>{0.7289294f, 0.469434142f},
-std::array<float,2>{0.289124519f, 0.774325788f},
-std::array<float,2>{0.814674973f, 0.51133728f},
-std::array<float,2>{0.0581372716f, 0.0367008187f},
-std::array<float,2>{0.97094363f, 0.139738455f},
-std::array<float,2>{0.208511949f, 0.672431827f},
-std::array<float,2>{0.57304275f, 0.94003129f},
-std::array<float,2>{0.414770365f, 0.2997168f},
-std::array<float,2>{0.926423371f, 0.331993043f},
-std::array<float,2>{0.139226094f, 0.881722152f},
-std::array<float,2>{0.50008899f, 0.721391082f},
-std::array<float,2>{0.44722572f, 0.231527656f},
-std::array<float,2>{0.630205333f, 0.0953646898f},
-std::array<float,2>{0.321857601f, 0.603549421f},
-std::array<float,2>{0.766029716f, 0.868461728f},
-std::array<float,2>{0.0726736486f, 0.377751946f},
-std::array<float,2>{0.565344036f, 0.446750253f},
-std::array<float,2>{0.409281015f, 0.803602159f},
-std::array<float,2>{0.982455075f, 0.536266267f},
-std::array<float,2>{0.21772179f, 0.0265501142f},
-std::array<float,2>{0.823176324f, 0.179947004f},
-std::array<float,2>{0.0499433428f, 0.633112013f},
-std::array<float,2>{0.724237025f, 0.987408102f},
-std::array<float,2>{0.289022416f, 0.260745376f},
-std::array<float,2>{0.803178549f, 0.42779696f},
-std::array<float,2>{0.109193511f, 0.822973907f},
-std::array<float,2>{0.681691229f, 0.592837989f},
-std::array<float,2>{0.369444072f, 0.0677788109f},
-std::array<float,2>{0.538600624f, 0.199189588f},
-std::array<float,2>{0.491628289f, 0.712254763f},
-std::array<float,2>{0.893070161f, 0.908317506f},
-std::array<float,2>{0.180251792f, 0.347967416f},
-std::array<float,2>{0.695254803f, 0.308547437f},
-std::array<float,2>{0.279133797f, 0.949634254f},
-std::array<float,2>{0.862762988f, 0.683479071f},
-std::array<float,2>{0.0210540034f, 0.130109131f},
-std::array<float,2>{0.966897726f, 0.0403513871f},
-std::array<float,2>{0.241144627f, 0.506987751f},
-std::array<float,2>{0.617658675f, 0.771288574f},
-std::array<float,2>{0.398660779f, 0.482958883f},
-std::array<float,2>{0.994732738f, 0.495403469f},
-std::array<float,2>{0.193796441f, 0.765127301f},
-std::array<float,2>{0.583681881f, 0.523010015f},
-std::array<float,2>{0.422142059f, 0.0620399415f},
-std::array<float,2>{0.741356134f, 0.145512536f},
-std::array<float,2>{0.304363966f, 0.669480324f},
-std::array<float,2>{0.828821957f, 0.965471029f},
-std::array<float,2>{0.046716921f, 0.284304857f},
-std::array<float,2>{0.527818084f, 0.367854834f},
-std::array<float,2>{0.468690783f, 0.922019303f},
-std::array<float,2>{0.915650845f, 0.695372462f},
-std::array<float,2>{0.141231835f, 0.204153165f},
-std::array<float,2>{0.755093098f, 0.0833998471f},
-std::array<float,2>{0.0831397921f, 0.573661208f},
-std::array<float,2>{0.65005374f, 0.834974468f},
-std::array<float,2>{0.328151733f, 0.410368443f},
-std::array<float,2>{0.852763653f, 0.276665807f},
-std::array<float,2>{0.0112179965f, 0.973228872f},
-std::array<float,2>{0.706703484f, 0.654035687f},
-std::array<float,2>{0.252065569f, 0.168871954f},
-std::array<float,2>{0.594289422f, 0.0119021935f},
-std::array<float,2>{0.375742823f, 0.561662078f},
-std::array<float,2>{0.945101559f, 0.789734066f},
-std::array<float,2>{0.222881749f, 0.464379698f},
-std::array<float,2>{0.669320583f, 0.40067941f},
-std::array<float,2>{0.357603401f, 0.850790858f},
-std::array<float,2>{0.796435356f, 0.618966877f},
-std::array<float,2>{0.113235839f, 0.117845744f},
-std::array<float,2>{0.879538536f, 0.24043563f},
-std::array<float,2>{0.168322861f, 0.741018593f},
-std::array<float,2>{0.557761908f, 0.904601455f},
-std::array<float,2>{0.479536057f, 0.314114451f},
-std::array<float,2>{0.904144943f, 0.288275063f},
-std::array<float,2>{0.174228087f, 0.962620497f},
-std::array<float,2>{0.544414222f, 0.665850878f},
-std::array<float,2>{0.496269673f, 0.141676486f},
-std::array<float,2>{0.674571216f, 0.0575070307f},
-std::array<float,2>{0.363665491f, 0.516304255f},
-std::array<float,2>{0.811144471f, 0.76076144f},
-std::array<float,2>{0.101535805f, 0.497379363f},
-std::array<float,2>{0.614271224f, 0.407171786f},
-std::array<float,2>{0.390699059f, 0.830577731f},
-std::array<float,2>{0.954467595f, 0.576608181f},
-std::array<float,2>{0.242599443f, 0.078589581f},
-std::array<float,2>{0.86766845f, 0.210732922f},
-std::array<float,2>{0.0245102625f, 0.700127244f},
-std::array<float,2>{0.699156284f, 0.929285645f},
-std::array<float,2>{0.26815623f, 0.37238577f},
-std::array<float,2>{0.776545703f, 0.467543244f},
-std::array<float,2>{0.0686524659f, 0.796565413f},
-std::array<float,2>{0.635490119f, 0.555571795f},
-std::array<float,2>{0.312754929f, 0.0116947303f},
-std::array<float,2>{0.510741949f, 0.165852115f},
-std::array<float,2>{0.43862924f, 0.651684642f},
-std::array<float,2>{0.929796278f, 0.96946466f},
-std::array<float,2>{0.128379136f, 0.280916393f},
-std::array<float,2>{0.730699122f, 0.317952067f},
-std::array<float,2>{0.296615869f, 0.902219057f},
-std::array<float,2>{0.816430271f, 0.736259937f},
-std::array<float,2>{0.0621089153f, 0.234819919f},
-std::array<float,2>{0.973560631f, 0.122397445f},
-std::array<float,2>{0.206211179f, 0.623986363f},
-std::array<float,2>{0.577793777f, 0.84387821f},
-std::array<float,2>{0.419372231f, 0.403364927f},
-std::array<float,2>{0.946279049f, 0.380476683f},
-std::array<float,2>{0.228240401f, 0.873704493f},
-std::array<float,2>{0.607835233f, 0.607169449f},
-std::array<float,2>{0.38754335f, 0.0978772864f},
-std::array<float,2>{0.715245366f, 0.229599863f},
-std::array<float,2>{0.25796625f, 0.724984407f},
-std::array<float,2>{0.847912669f, 0.87605983f},
-std::array<float,2>{0.0056406376f, 0.333782077f},
-std::array<float,2>{0.549274206f, 0.263467878f},
-std::array<float,2>{0.471808016f, 0.988599837f},
-std::array<float,2>{0.888901711f, 0.640552163f},
-std::array<float,2>{0.162426636f, 0.186572269f},
-std::array<float,2>{0.782954276f, 0.029251622f},
-std::array<float,2>{0.12408793f, 0.534494758f},
-std::array<float,2>{0.660822392f, 0.797017038f},
-std::array<float,2>{0.350091815f, 0.450770319f},
-std::array<float,2>{0.836665213f, 0.345369697f},
-std::array<float,2>{0.0327656344f, 0.913913965f},
-std::array<float,2>{0.747109652f, 0.716296256f},
-std::array<float,2>{0.304779142f, 0.202959046f},
-std::array<float,2>{0.590226293f, 0.0655127391f},
-std::array<float,2>{0.433373153f, 0.587583423f},
-std::array<float,2>{0.984696329f, 0.826701164f},
-std::array<float,2>{0.202900678f, 0.425336689f},
-std::array<float,2>{0.647714317f, 0.480191201f},
-std::array<float,2>{0.343048781f, 0.766627967f},
-std::array<float,2>{0.759372234f, 0.502194524f},
-std::array<float,2>{0.0929296613f, 0.043913614f},
-std::array<float,2>{0.91205132f, 0.125393942f},
-std::array<float,2>{0.15562208f, 0.687235892f},
-std::array<float,2>{0.518086731f, 0.948857069f},
-std::array<float,2>{0.453766882f, 0.310121387f},
-std::array<float,2>{0.998670757f, 0.342772454f},
-std::array<float,2>{0.187903225f, 0.890491426f},
-std::array<float,2>{0.5788064f, 0.731490552f},
-std::array<float,2>{0.428916484f, 0.221872985f},
-std::array<float,2>{0.736106336f, 0.10566093f},
-std::array<float,2>{0.297311187f, 0.599831581f},
-std::array<float,2>{0.832921028f, 0.866813958f},
-std::array<float,2>{0.0409075543f, 0.389508754f},
-std::array<float,2>{0.524449825f, 0.438401312f},
-std::array<float,2>{0.46269986f, 0.80733496f},
-std::array<float,2>{0.920162737f, 0.545358717f},
-std::array<float,2>{0.147460893f, 0.0158788208f},
-std::array<float,2>{0.751237333f, 0.172226205f},
-std::array<float,2>{0.081696026f, 0.628997028f},
-std::array<float,2>{0.655579686f, 0.998072028f},
-std::array<float,2>{0.334465295f, 0.250022411f},
-std::array<float,2>{0.858359456f, 0.431504548f},
-std::array<float,2>{0.0133076627f, 0.817342579f},
-std::array<float,2>{0.710826457f, 0.580736101f},
-std::array<float,2>{0.256401062f, 0.0778228939f},
-std::array<float,2>{0.600368261f, 0.189971685f},
-std::array<float,2>{0.381457776f, 0.707850695f},
-std::array<float,2>{0.93841815f, 0.918144166f},
-std::array<float,2>{0.222113788f, 0.355497867f},
-std::array<float,2>{0.66640836f, 0.303104579f},
-std::array<float,2>{0.352131158f, 0.942258239f},
-std::array<float,2>{0.792167068f, 0.67934984f},
-std::array<float,2>{0.114717796f, 0.133692831f},
-std::array<float,2>{0.877050996f, 0.0327826589f},
-std::array<float,2>{0.164151296f, 0.515277445f},
-std::array<float,2>{0.560488403f, 0.777795017f},
-std::array<float,2>{0.481374234f, 0.474185705f},
-std::array<float,2>{0.92317158f, 0.485651582f},
-std::array<float,2>{0.133129254f, 0.754704833f},
-std::array<float,2>{0.507082462f, 0.528678596f},
-std::array<float,2>{0.452371478f, 0.0537332185f},
-std::array<float,2>{0.625102341f, 0.149020553f},
-std::array<float,2>{0.328031063f, 0.664022446f},
-std::array<float,2>{0.769966841f, 0.955159605f},
-std::array<float,2>{0.0746509507f, 0.295745164f},
-std::array<float,2>{0.566564023f, 0.364279509f},
-std::array<float,2>{0.413304865f, 0.932503879f},
-std::array<float,2>{0.978621423f, 0.688380301f},
-std::array<float,2>{0.211691707f, 0.217630208f},
-std::array<float,2>{0.826593101f, 0.0935529396f},
-std::array<float,2>{0.053210482f, 0.566392124f},
-std::array<float,2>{0.7214908f, 0.8371225f},
-std::array<float,2>{0.283064097f, 0.414337546f},
-std::array<float,2>{0.798395395f, 0.265851498f},
-std::array<float,2>{0.104942441f, 0.979873359f},
-std::array<float,2>{0.684814453f, 0.643651485f},
-std::array<float,2>{0.371330887f, 0.163435772f},
-std::array<float,2>{0.532211304f, 0.000924941327f},
-std::array<float,2>{0.48561421f, 0.549948454f},
-std::array<float,2>{0.896208346f, 0.786356032f},
-std::array<float,2>{0.185949042f, 0.459374249f},
-std::array<float,2>{0.687621474f, 0.397995025f},
-std::array<float,2>{0.276912659f, 0.851887763f},
-std::array<float,2>{0.863389909f, 0.616158605f},
-std::array<float,2>{0.0190260671f, 0.112316214f},
-std::array<float,2>{0.964410543f, 0.244869754f},
-std::array<float,2>{0.23768352f, 0.747052729f},
-std::array<float,2>{0.622844338f, 0.898233235f},
-std::array<float,2>{0.403282106f, 0.322387099f},
-std::array<float,2>{0.959827721f, 0.255383283f},
-std::array<float,2>{0.249541804f, 0.992269218f},
-std::array<float,2>{0.612626433f, 0.626168847f},
-std::array<float,2>{0.3956891f, 0.178320125f},
-std::array<float,2>{0.699385524f, 0.02111811f},
-std::array<float,2>{0.271903187f, 0.542905211f},
-std::array<float,2>{0.87277317f, 0.811381996f},
-std::array<float,2>{0.0294707604f, 0.443698049f},
-std::array<float,2>{0.540355921f, 0.38449645f},
-std::array<float,2>{0.49428457f, 0.86016345f},
-std::array<float,2>{0.901058555f, 0.596805274f},
-std::array<float,2>{0.176121548f, 0.103626497f},
-std::array<float,2>{0.806651175f, 0.224584028f},
-std::array<float,2>{0.0969596356f, 0.726786673f},
-std::array<float,2>{0.67859602f, 0.886197627f},
-std::array<float,2>{0.361213267f, 0.337647766f},
-std::array<float,2>{0.815909803f, 0.472270131f},
-std::array<float,2>{0.0571868047f, 0.776292443f},
-std::array<float,2>{0.730465829f, 0.509595454f},
-std::array<float,2>{0.290115952f, 0.0373053849f},
-std::array<float,2>{0.573468566f, 0.137339756f},
-std::array<float,2>{0.415967375f, 0.675687909f},
-std::array<float,2>{0.971980393f, 0.939074039f},
-std::array<float,2>{0.207101867f, 0.297564477f},
-std::array<float,2>{0.639863551f, 0.352380097f},
-std::array<float,2>{0.318814367f, 0.915021956f},
-std::array<float,2>{0.778164744f, 0.706012607f},
-std::array<float,2>{0.0626662821f, 0.193971425f},
-std::array<float,2>{0.93397826f, 0.0709188432f},
-std::array<float,2>{0.130824879f, 0.58344233f},
-std::array<float,2>{0.512702763f, 0.813820183f},
-std::array<float,2>{0.444119602f, 0.436355382f},
-std::array<float,2>{0.884335697f, 0.419499189f},
-std::array<float,2>{0.158885196f, 0.843680322f},
-std::array<float,2>{0.55107367f, 0.568769813f},
-std::array<float,2>{0.473749846f, 0.0884083062f},
-std::array<float,2>{0.659056187f, 0.211127639f},
-std::array<float,2>{0.344844639f, 0.694148123f},
-std::array<float,2>{0.7879318f, 0.936402738f},
-std::array<float,2>{0.117253721f, 0.363074481f},
-std::array<float,2>{0.602278292f, 0.29277432f},
-std::array<float,2>{0.383143336f, 0.957598448f},
-std::array<float,2>{0.94928664f, 0.659546196f},
-std::array<float,2>{0.230979338f, 0.156045541f},
-std::array<float,2>{0.845242202f, 0.0469551384f},
-std::array<float,2>{0.00252212095f, 0.524970412f},
-std::array<float,2>{0.712881505f, 0.750422895f},
-std::array<float,2>{0.265285671f, 0.488618195f},
-std::array<float,2>{0.762207091f, 0.327518106f},
-std::array<float,2>{0.0872968435f, 0.89434731f},
-std::array<float,2>{0.643938661f, 0.745934904f},
-std::array<float,2>{0.336299568f, 0.249200329f},
-std::array<float,2>{0.522241354f, 0.11366415f},
-std::array<float,2>{0.457437128f, 0.611407936f},
-std::array<float,2>{0.906289458f, 0.856532812f},
-std::array<float,2>{0.151115447f, 0.393014997f},
-std::array<float,2>{0.745024025f, 0.45690757f},
-std::array<float,2>{0.310536295f, 0.781975567f},
-std::array<float,2>{0.842006445f, 0.552485228f},
-std::array<float,2>{0.0356915183f, 0.00727666495f},
-std::array<float,2>{0.990854263f, 0.156562418f},
-std::array<float,2>{0.195636064f, 0.645082593f},
-std::array<float,2>{0.586472332f, 0.983713984f},
-std::array<float,2>{0.43476364f, 0.271811187f},
-std::array<float,2>{0.914837778f, 0.369653344f},
-std::array<float,2>{0.142111182f, 0.924052298f},
-std::array<float,2>{0.528454721f, 0.697821915f},
-std::array<float,2>{0.467010826f, 0.205981508f},
-std::array<float,2>{0.649351001f, 0.0843832642f},
-std::array<float,2>{0.329861283f, 0.570586026f},
-std::array<float,2>{0.754442453f, 0.833977282f},
-std::array<float,2>{0.0826279446f, 0.413497031f},
-std::array<float,2>{0.582488298f, 0.493654847f},
-std::array<float,2>{0.422951847f, 0.762663186f},
-std::array<float,2>{0.99567461f, 0.520291328f},
-std::array<float,2>{0.19501619f, 0.0600588396f},
-std::array<float,2>{0.829797566f, 0.147110596f},
-std::array<float,2>{0.0451340079f, 0.671001911f},
-std::array<float,2>{0.741043925f, 0.967265904f},
-std::array<float,2>{0.30350402f, 0.281865299f},
-std::array<float,2>{0.795194626f, 0.398878634f},
-std::array<float,2>{0.112264663f, 0.848256469f},
-std::array<float,2>{0.668823361f, 0.620210409f},
-std::array<float,2>{0.358707964f, 0.120190412f},
-std::array<float,2>{0.557332098f, 0.239977509f},
-std::array<float,2>{0.479134411f, 0.739232183f},
-std::array<float,2>{0.880804479f, 0.903524041f},
-std::array<float,2>{0.169590145f, 0.315408319f},
-std::array<float,2>{0.705380082f, 0.273677289f},
-std::array<float,2>{0.253314286f, 0.974877715f},
-std::array<float,2>{0.852198958f, 0.654869735f},
-std::array<float,2>{0.00991912931f, 0.170469224f},
-std::array<float,2>{0.944297552f, 0.01468952f},
-std::array<float,2>{0.22433129f, 0.560445786f},
-std::array<float,2>{0.595154822f, 0.791305184f},
-std::array<float,2>{0.376267195f, 0.462878972f},
-std::array<float,2>{0.984360516f, 0.447705626f},
-std::array<float,2>{0.218256459f, 0.801241338f},
-std::array<float,2>{0.566235542f, 0.53824681f},
-std::array<float,2>{0.409022659f, 0.0240284484f},
-std::array<float,2>{0.723469496f, 0.182821155f},
-std::array<float,2>{0.287425131f, 0.634963274f},
-std::array<float,2>{0.823874414f, 0.98447156f},
-std::array<float,2>{0.0492158122f, 0.258027405f},
-std::array<float,2>{0.501448214f, 0.330064416f},
-std::array<float,2>{0.4460392f, 0.878967404f},
-std::array<float,2>{0.927184403f, 0.720504701f},
-std::array<float,2>{0.140037388f, 0.234207243f},
-std::array<float,2>{0.767444432f, 0.0960487276f},
-std::array<float,2>{0.0740319043f, 0.602732182f},
-std::array<float,2>{0.629016995f, 0.870434284f},
-std::array<float,2>{0.321146607f, 0.375411838f},
-std::array<float,2>{0.862127781f, 0.306381017f},
-std::array<float,2>{0.0199690703f, 0.951515019f},
-std::array<float,2>{0.693756938f, 0.681396127f},
-std::array<float,2>{0.278073013f, 0.131741107f},
-std::array<float,2>{0.61875546f, 0.0426098034f},
-std::array<float,2>{0.399475157f, 0.505375803f},
-std::array<float,2>{0.968506992f, 0.772745669f},
-std::array<float,2>{0.241818532f, 0.481811643f},
-std::array<float,2>{0.682655811f, 0.426693946f},
-std::array<float,2>{0.370753676f, 0.821426451f},
-std::array<float,2>{0.804323375f, 0.590742886f},
-std::array<float,2>{0.107998215f, 0.0696159527f},
-std::array<float,2>{0.893634379f, 0.196399465f},
-std::array<float,2>{0.181359768f, 0.713925123f},
-std::array<float,2>{0.537180901f, 0.907057405f},
-std::array<float,2>{0.490889132f, 0.35143882f},
-std::array<float,2>{0.93264699f, 0.278354496f},
-std::array<float,2>{0.125157386f, 0.97174859f},
-std::array<float,2>{0.50936085f, 0.650033236f},
-std::array<float,2>{0.440454572f, 0.166086808f},
-std::array<float,2>{0.634642482f, 0.0093562901f},
-std::array<float,2>{0.315806568f, 0.55672878f},
-std::array<float,2>{0.774941921f, 0.793024182f},
-std::array<float,2>{0.0682717413f, 0.465796232f},
-std::array<float,2>{0.574691772f, 0.405929387f},
-std::array<float,2>{0.420028806f, 0.846721292f},
-std::array<float,2>{0.974757731f, 0.622566223f},
-std::array<float,2>{0.203655347f, 0.123837575f},
-std::array<float,2>{0.819532692f, 0.236521676f},
-std::array<float,2>{0.0601117648f, 0.737283707f},
-std::array<float,2>{0.734171808f, 0.899773896f},
-std::array<float,2>{0.294876993f, 0.319502562f},
-std::array<float,2>{0.809353948f, 0.49824661f},
-std::array<float,2>{0.099005729f, 0.75800693f},
-std::array<float,2>{0.673276186f, 0.519483745f},
-std::array<float,2>{0.366501689f, 0.0547837541f},
-std::array<float,2>{0.545045257f, 0.144360796f},
-std::array<float,2>{0.498831183f, 0.667210758f},
-std::array<float,2>{0.905367196f, 0.963759899f},
-std::array<float,2>{0.172389045f, 0.286689967f},
-std::array<float,2>{0.697062194f, 0.374122649f},
-std::array<float,2>{0.265824646f, 0.927729726f},
-std::array<float,2>{0.870436549f, 0.702822328f},
-std::array<float,2>{0.0259097703f, 0.208686188f},
-std::array<float,2>{0.956096768f, 0.0816908777f},
-std::array<float,2>{0.244959667f, 0.576102018f},
-std::array<float,2>{0.615357459f, 0.8294577f},
-std::array<float,2>{0.394426316f, 0.408261508f},
-std::array<float,2>{0.986350775f, 0.423584193f},
-std::array<float,2>{0.199645251f, 0.825863957f},
-std::array<float,2>{0.592586815f, 0.589138985f},
-std::array<float,2>{0.430779845f, 0.0641939044f},
-std::array<float,2>{0.748118222f, 0.200612187f},
-std::array<float,2>{0.307277739f, 0.718499899f},
-std::array<float,2>{0.839580238f, 0.910968661f},
-std::array<float,2>{0.0345280692f, 0.34695214f},
-std::array<float,2>{0.517039299f, 0.310851485f},
-std::array<float,2>{0.456322908f, 0.946523726f},
-std::array<float,2>{0.912650526f, 0.683893442f},
-std::array<float,2>{0.154234588f, 0.12845701f},
-std::array<float,2>{0.760963619f, 0.0449679494f},
-std::array<float,2>{0.0901831463f, 0.500786722f},
-std::array<float,2>{0.644937336f, 0.768412352f},
-std::array<float,2>{0.340537459f, 0.47799179f},
-std::array<float,2>{0.851533353f, 0.335131884f},
-std::array<float,2>{0.00733782398f, 0.878110945f},
-std::array<float,2>{0.7168504f, 0.724146903f},
-std::array<float,2>{0.260050058f, 0.227243841f},
-std::array<float,2>{0.605699003f, 0.0997388884f},
-std::array<float,2>{0.389072597f, 0.608465314f},
-std::array<float,2>{0.948480368f, 0.871707499f},
-std::array<float,2>{0.229473397f, 0.382488996f},
-std::array<float,2>{0.662764966f, 0.451185226f},
-std::array<float,2>{0.349007279f, 0.800043344f},
-std::array<float,2>{0.784435809f, 0.532132208f},
-std::array<float,2>{0.122692965f, 0.0305118468f},
-std::array<float,2>{0.88794589f, 0.184438258f},
-std::array<float,2>{0.162089005f, 0.638326049f},
-std::array<float,2>{0.548080623f, 0.990472376f},
-std::array<float,2>{0.469238609f, 0.264534265f},
-std::array<float,2>{0.940626025f, 0.358283609f},
-std::array<float,2>{0.219526574f, 0.921160042f},
-std::array<float,2>{0.599440515f, 0.709824741f},
-std::array<float,2>{0.379971474f, 0.188255578f},
-std::array<float,2>{0.707943082f, 0.0748494416f},
-std::array<float,2>{0.253985137f, 0.579669774f},
-std::array<float,2>{0.856326401f, 0.818873942f},
-std::array<float,2>{0.0139723131f, 0.432119966f},
-std::array<float,2>{0.561185896f, 0.475597858f},
-std::array<float,2>{0.482441604f, 0.779800415f},
-std::array<float,2>{0.87518841f, 0.512567878f},
-std::array<float,2>{0.166500613f, 0.0348007977f},
-std::array<float,2>{0.789235055f, 0.136028931f},
-std::array<float,2>{0.116069645f, 0.676664352f},
-std::array<float,2>{0.665533364f, 0.944881737f},
-std::array<float,2>{0.354831189f, 0.301399171f},
-std::array<float,2>{0.834805667f, 0.38677454f},
-std::array<float,2>{0.0423044339f, 0.865088761f},
-std::array<float,2>{0.737994134f, 0.598300397f},
-std::array<float,2>{0.299536616f, 0.107924581f},
-std::array<float,2>{0.580664873f, 0.220203325f},
-std::array<float,2>{0.427101105f, 0.732649982f},
-std::array<float,2>{0.996453702f, 0.887615204f},
-std::array<float,2>{0.18980746f, 0.341438979f},
-std::array<float,2>{0.652602077f, 0.253193945f},
-std::array<float,2>{0.333367229f, 0.99617368f},
-std::array<float,2>{0.753090382f, 0.631388426f},
-std::array<float,2>{0.079368256f, 0.173906431f},
-std::array<float,2>{0.919245481f, 0.0181410424f},
-std::array<float,2>{0.144646347f, 0.543317795f},
-std::array<float,2>{0.527221024f, 0.80470854f},
-std::array<float,2>{0.464323461f, 0.439544052f},
-std::array<float,2>{0.896677196f, 0.457898706f},
-std::array<float,2>{0.183859468f, 0.787414253f},
-std::array<float,2>{0.533872068f, 0.548304796f},
-std::array<float,2>{0.488032997f, 0.00231348351f},
-std::array<float,2>{0.687322974f, 0.16129908f},
-std::array<float,2>{0.373533666f, 0.642191231f},
-std::array<float,2>{0.799604833f, 0.977057576f},
-std::array<float,2>{0.103286624f, 0.268964499f},
-std::array<float,2>{0.623686433f, 0.321080357f},
-std::array<float,2>{0.404812455f, 0.896311462f},
-std::array<float,2>{0.961749315f, 0.749043703f},
-std::array<float,2>{0.235085204f, 0.242634848f},
-std::array<float,2>{0.865253627f, 0.111306474f},
-std::array<float,2>{0.0171750784f, 0.614127338f},
-std::array<float,2>{0.68988806f, 0.854119718f},
-std::array<float,2>{0.273555428f, 0.396216542f},
-std::array<float,2>{0.772186995f, 0.293469161f},
-std::array<float,2>{0.0777334571f, 0.954471529f},
-std::array<float,2>{0.627193213f, 0.661459982f},
-std::array<float,2>{0.32481575f, 0.151530802f},
-std::array<float,2>{0.50422287f, 0.0526465625f},
-std::array<float,2>{0.449966073f, 0.531092286f},
-std::array<float,2>{0.925247312f, 0.757155299f},
-std::array<float,2>{0.135486573f, 0.487519473f},
-std::array<float,2>{0.718792617f, 0.416402221f},
-std::array<float,2>{0.283508688f, 0.839575112f},
-std::array<float,2>{0.826105237f, 0.563906968f},
-std::array<float,2>{0.0519435033f, 0.0916181281f},
-std::array<float,2>{0.97695744f, 0.215591103f},
-std::array<float,2>{0.213773027f, 0.689605117f},
-std::array<float,2>{0.568805993f, 0.93109107f},
-std::array<float,2>{0.411118835f, 0.36580804f},
-std::array<float,2>{0.969920814f, 0.3000817f},
-std::array<float,2>{0.210125774f, 0.940757275f},
-std::array<float,2>{0.571808577f, 0.673289299f},
-std::array<float,2>{0.417478621f, 0.139473736f},
-std::array<float,2>{0.727523804f, 0.0358506665f},
-std::array<float,2>{0.292565882f, 0.510202587f},
-std::array<float,2>{0.812817574f, 0.77475059f},
-std::array<float,2>{0.0559036545f, 0.470514894f},
-std::array<float,2>{0.514729798f, 0.43526575f},
-std::array<float,2>{0.442872196f, 0.81602782f},
-std::array<float,2>{0.936826408f, 0.584874213f},
-std::array<float,2>{0.132350236f, 0.0730435848f},
-std::array<float,2>{0.779618084f, 0.192550316f},
-std::array<float,2>{0.0655088499f, 0.704021335f},
-std::array<float,2>{0.637272477f, 0.916066825f},
-std::array<float,2>{0.318103611f, 0.35536626f},
-std::array<float,2>{0.873224199f, 0.441535443f},
-std::array<float,2>{0.028154429f, 0.809804678f},
-std::array<float,2>{0.702616751f, 0.540581167f},
-std::array<float,2>{0.27124235f, 0.0226705056f},
-std::array<float,2>{0.610100269f, 0.176579654f},
-std::array<float,2>{0.396521688f, 0.627963424f},
-std::array<float,2>{0.957882881f, 0.99440062f},
-std::array<float,2>{0.247606799f, 0.256702989f},
-std::array<float,2>{0.677668095f, 0.339231104f},
-std::array<float,2>{0.361381352f, 0.8845945f},
-std::array<float,2>{0.805382013f, 0.729275525f},
-std::array<float,2>{0.0950817689f, 0.225955382f},
-std::array<float,2>{0.900012791f, 0.102302693f},
-std::array<float,2>{0.179243252f, 0.593997717f},
-std::array<float,2>{0.541701138f, 0.862432003f},
-std::array<float,2>{0.494082183f, 0.386336714f},
-std::array<float,2>{0.910137773f, 0.392437667f},
-std::array<float,2>{0.149549544f, 0.859223604f},
-std::array<float,2>{0.520831525f, 0.611071289f},
-std::array<float,2>{0.459106386f, 0.116339326f},
-std::array<float,2>{0.64228034f, 0.248005554f},
-std::array<float,2>{0.339119673f, 0.743633389f},
-std::array<float,2>{0.764786959f, 0.891682684f},
-std::array<float,2>{0.0884734541f, 0.325031877f},
-std::array<float,2>{0.58857125f, 0.271271557f},
-std::array<float,2>{0.436628789f, 0.982332528f},
-std::array<float,2>{0.988368273f, 0.647434711f},
-std::array<float,2>{0.198253885f, 0.159550309f},
-std::array<float,2>{0.84041214f, 0.0056272177f},
-std::array<float,2>{0.0390488058f, 0.553530037f},
-std::array<float,2>{0.74280405f, 0.785131156f},
-std::array<float,2>{0.311101168f, 0.453910142f},
-std::array<float,2>{0.786439776f, 0.361259192f},
-std::array<float,2>{0.120532528f, 0.935347259f},
-std::array<float,2>{0.657497466f, 0.692382157f},
-std::array<float,2>{0.347619712f, 0.214522019f},
-std::array<float,2>{0.553869367f, 0.0872466937f},
-std::array<float,2>{0.476384163f, 0.566516757f},
-std::array<float,2>{0.886187494f, 0.841164827f},
-std::array<float,2>{0.157975391f, 0.421051025f},
-std::array<float,2>{0.714389443f, 0.490293324f},
-std::array<float,2>{0.262545228f, 0.752839446f},
-std::array<float,2>{0.84697032f, 0.526141047f},
-std::array<float,2>{0.000404957682f, 0.0489745997f},
-std::array<float,2>{0.952505171f, 0.152927354f},
-std::array<float,2>{0.233899415f, 0.657100916f},
-std::array<float,2>{0.605291605f, 0.959706187f},
-std::array<float,2>{0.385640949f, 0.289319307f},
-std::array<float,2>{0.882407427f, 0.312971503f},
-std::array<float,2>{0.170487329f, 0.906104803f},
-std::array<float,2>{0.55497092f, 0.741890252f},
-std::array<float,2>{0.47761485f, 0.241439775f},
-std::array<float,2>{0.671514988f, 0.118887529f},
-std::array<float,2>{0.356255144f, 0.617360175f},
-std::array<float,2>{0.794693589f, 0.849766433f},
-std::array<float,2>{0.109836869f, 0.401888818f},
-std::array<float,2>{0.596436381f, 0.463407844f},
-std::array<float,2>{0.377875298f, 0.790550292f},
-std::array<float,2>{0.942646921f, 0.561275244f},
-std::array<float,2>{0.225297332f, 0.0127363922f},
-std::array<float,2>{0.854734004f, 0.169163778f},
-std::array<float,2>{0.0087530436f, 0.652815461f},
-std::array<float,2>{0.703151584f, 0.974429607f},
-std::array<float,2>{0.250377089f, 0.275448918f},
-std::array<float,2>{0.757330775f, 0.411846966f},
-std::array<float,2>{0.0846223459f, 0.83450824f},
-std::array<float,2>{0.652155519f, 0.57232964f},
-std::array<float,2>{0.331042439f, 0.0829747617f},
-std::array<float,2>{0.529913604f, 0.203522399f},
-std::array<float,2>{0.464918226f, 0.696767032f},
-std::array<float,2>{0.917242408f, 0.923766792f},
-std::array<float,2>{0.142881542f, 0.368190914f},
-std::array<float,2>{0.738877058f, 0.283551633f},
-std::array<float,2>{0.301541269f, 0.966123998f},
-std::array<float,2>{0.831637204f, 0.668341517f},
-std::array<float,2>{0.0432328582f, 0.145214006f},
-std::array<float,2>{0.993679047f, 0.061042048f},
-std::array<float,2>{0.193099201f, 0.522452354f},
-std::array<float,2>{0.585313201f, 0.763950288f},
-std::array<float,2>{0.42489785f, 0.494444579f},
-std::array<float,2>{0.964868069f, 0.483483374f},
-std::array<float,2>{0.238535598f, 0.769733012f},
-std::array<float,2>{0.61929667f, 0.506398261f},
-std::array<float,2>{0.400756538f, 0.0397731215f},
-std::array<float,2>{0.693280935f, 0.129573092f},
-std::array<float,2>{0.280701756f, 0.682147801f},
-std::array<float,2>{0.859472215f, 0.950442672f},
-std::array<float,2>{0.022846384f, 0.3067981f},
-std::array<float,2>{0.535869002f, 0.349194795f},
-std::array<float,2>{0.489976346f, 0.909972966f},
-std::array<float,2>{0.891197443f, 0.711603463f},
-std::array<float,2>{0.18202804f, 0.198137105f},
-std::array<float,2>{0.801299274f, 0.0673781559f},
-std::array<float,2>{0.106302217f, 0.5919559f},
-std::array<float,2>{0.68020612f, 0.824120283f},
-std::array<float,2>{0.368711442f, 0.429350644f},
-std::array<float,2>{0.821638346f, 0.260736853f},
-std::array<float,2>{0.0469806604f, 0.987118065f},
-std::array<float,2>{0.725029767f, 0.633890748f},
-std::array<float,2>{0.285508722f, 0.181432202f},
-std::array<float,2>{0.563262582f, 0.026065018f},
-std::array<float,2>{0.407591045f, 0.535972416f},
-std::array<float,2>{0.981916726f, 0.804539204f},
-std::array<float,2>{0.215814084f, 0.445742041f},
-std::array<float,2>{0.630889952f, 0.37829408f},
-std::array<float,2>{0.323496372f, 0.867932498f},
-std::array<float,2>{0.767951131f, 0.604494572f},
-std::array<float,2>{0.0721024573f, 0.0946424603f},
-std::array<float,2>{0.928590775f, 0.230973795f},
-std::array<float,2>{0.138096511f, 0.722140431f},
-std::array<float,2>{0.503224075f, 0.882079363f},
-std::array<float,2>{0.448229551f, 0.330094248f},
-std::array<float,2>{0.925683141f, 0.295307249f},
-std::array<float,2>{0.134911135f, 0.95589292f},
-std::array<float,2>{0.5048455f, 0.663383603f},
-std::array<float,2>{0.449620128f, 0.148641586f},
-std::array<float,2>{0.627676547f, 0.0546256602f},
-std::array<float,2>{0.324279189f, 0.52919364f},
-std::array<float,2>{0.77177006f, 0.754152775f},
-std::array<float,2>{0.0773367062f, 0.486154228f},
-std::array<float,2>{0.569096327f, 0.414579898f},
-std::array<float,2>{0.410343111f, 0.83746165f},
-std::array<float,2>{0.977190256f, 0.565450728f},
-std::array<float,2>{0.213258877f, 0.0931663886f},
-std::array<float,2>{0.825449765f, 0.216846645f},
-std::array<float,2>{0.052431725f, 0.687945485f},
-std::array<float,2>{0.719517827f, 0.93165344f},
-std::array<float,2>{0.283795148f, 0.364837974f},
-std::array<float,2>{0.799127996f, 0.459568053f},
-std::array<float,2>{0.102941789f, 0.787036896f},
-std::array<float,2>{0.686614573f, 0.550467432f},
-std::array<float,2>{0.37366268f, 0.000146148494f},
-std::array<float,2>{0.533399343f, 0.163707197f},
-std::array<float,2>{0.487500697f, 0.644501984f},
-std::array<float,2>{0.89703846f, 0.980459452f},
-std::array<float,2>{0.184207946f, 0.266276538f},
-std::array<float,2>{0.690107465f, 0.322773606f},
-std::array<float,2>{0.274060875f, 0.89774102f},
-std::array<float,2>{0.866205275f, 0.746153772f},
-std::array<float,2>{0.0167510808f, 0.244485885f},
-std::array<float,2>{0.960994363f, 0.113183595f},
-std::array<float,2>{0.234512135f, 0.615528524f},
-std::array<float,2>{0.623272479f, 0.852396667f},
-std::array<float,2>{0.404621273f, 0.397750646f},
-std::array<float,2>{0.996989965f, 0.388676614f},
-std::array<float,2>{0.190011784f, 0.866380215f},
-std::array<float,2>{0.580328643f, 0.600500166f},
-std::array<float,2>{0.427470088f, 0.106156103f},
-std::array<float,2>{0.737557113f, 0.222456053f},
-std::array<float,2>{0.299072444f, 0.732310832f},
-std::array<float,2>{0.834441841f, 0.890089095f},
-std::array<float,2>{0.0428765304f, 0.34211576f},
-std::array<float,2>{0.526430011f, 0.250844955f},
-std::array<float,2>{0.464800447f, 0.998745203f},
-std::array<float,2>{0.91944617f, 0.629709065f},
-std::array<float,2>{0.14528358f, 0.172808796f},
-std::array<float,2>{0.753866851f, 0.0162332579f},
-std::array<float,2>{0.0798065364f, 0.545849681f},
-std::array<float,2>{0.652933121f, 0.807037711f},
-std::array<float,2>{0.333728671f, 0.437987447f},
-std::array<float,2>{0.855570614f, 0.35623771f},
-std::array<float,2>{0.0143411737f, 0.918524683f},
-std::array<float,2>{0.707181096f, 0.707152963f},
-std::array<float,2>{0.254638195f, 0.189508483f},
-std::array<float,2>{0.598834336f, 0.0774459019f},
-std::array<float,2>{0.380434752f, 0.580448985f},
-std::array<float,2>{0.941059113f, 0.816631079f},
-std::array<float,2>{0.218831643f, 0.431058377f},
-std::array<float,2>{0.665187597f, 0.474042803f},
-std::array<float,2>{0.355227202f, 0.778087616f},
-std::array<float,2>{0.789898694f, 0.514941037f},
-std::array<float,2>{0.11528448f, 0.0324845575f},
-std::array<float,2>{0.875682712f, 0.133270681f},
-std::array<float,2>{0.166683689f, 0.679172873f},
-std::array<float,2>{0.560782492f, 0.941802979f},
-std::array<float,2>{0.483197451f, 0.303293198f},
-std::array<float,2>{0.94888711f, 0.333209276f},
-std::array<float,2>{0.228631273f, 0.876502573f},
-std::array<float,2>{0.60637188f, 0.725259244f},
-std::array<float,2>{0.389326692f, 0.23036623f},
-std::array<float,2>{0.717555225f, 0.0985108688f},
-std::array<float,2>{0.260461777f, 0.60650605f},
-std::array<float,2>{0.850860596f, 0.873444855f},
-std::array<float,2>{0.00693037594f, 0.380340219f},
-std::array<float,2>{0.54840672f, 0.450238943f},
-std::array<float,2>{0.469135255f, 0.79759109f},
-std::array<float,2>{0.888285577f, 0.535091817f},
-std::array<float,2>{0.161495492f, 0.0287197232f},
-std::array<float,2>{0.784900904f, 0.187241957f},
-std::array<float,2>{0.122378625f, 0.639851451f},
-std::array<float,2>{0.662564278f, 0.98916012f},
-std::array<float,2>{0.349149793f, 0.263070792f},
-std::array<float,2>{0.839092612f, 0.425002873f},
-std::array<float,2>{0.0349329375f, 0.826465368f},
-std::array<float,2>{0.748559535f, 0.587177813f},
-std::array<float,2>{0.307086408f, 0.0659286454f},
-std::array<float,2>{0.592094481f, 0.202328846f},
-std::array<float,2>{0.431342512f, 0.716393471f},
-std::array<float,2>{0.987235129f, 0.913510084f},
-std::array<float,2>{0.199910268f, 0.34473601f},
-std::array<float,2>{0.645025313f, 0.309896559f},
-std::array<float,2>{0.339859247f, 0.94836086f},
-std::array<float,2>{0.761287093f, 0.686823487f},
-std::array<float,2>{0.0907317996f, 0.125705197f},
-std::array<float,2>{0.912291944f, 0.043038886f},
-std::array<float,2>{0.153348729f, 0.502551079f},
-std::array<float,2>{0.517094493f, 0.767284393f},
-std::array<float,2>{0.456864297f, 0.479875058f},
-std::array<float,2>{0.905975163f, 0.497674525f},
-std::array<float,2>{0.172071904f, 0.761469603f},
-std::array<float,2>{0.545812964f, 0.515808523f},
-std::array<float,2>{0.498256564f, 0.0568781905f},
-std::array<float,2>{0.673369884f, 0.142313749f},
-std::array<float,2>{0.367123187f, 0.665116906f},
-std::array<float,2>{0.808618009f, 0.962126911f},
-std::array<float,2>{0.0994166061f, 0.289053053f},
-std::array<float,2>{0.615864515f, 0.372685462f},
-std::array<float,2>{0.393671066f, 0.928882897f},
-std::array<float,2>{0.956804335f, 0.69945997f},
-std::array<float,2>{0.244470119f, 0.210156724f},
-std::array<float,2>{0.870638967f, 0.0788617879f},
-std::array<float,2>{0.0256642699f, 0.577108026f},
-std::array<float,2>{0.696629286f, 0.830478609f},
-std::array<float,2>{0.266185671f, 0.406524509f},
-std::array<float,2>{0.774571657f, 0.280283183f},
-std::array<float,2>{0.0674775019f, 0.968868852f},
-std::array<float,2>{0.633946002f, 0.652240694f},
-std::array<float,2>{0.316182911f, 0.165341616f},
-std::array<float,2>{0.508868396f, 0.0110094827f},
-std::array<float,2>{0.440968543f, 0.554767549f},
-std::array<float,2>{0.933439493f, 0.795956016f},
-std::array<float,2>{0.125755951f, 0.466993958f},
-std::array<float,2>{0.733593702f, 0.404196143f},
-std::array<float,2>{0.294296116f, 0.84454155f},
-std::array<float,2>{0.820116937f, 0.623386264f},
-std::array<float,2>{0.0598750934f, 0.122596905f},
-std::array<float,2>{0.975441575f, 0.235044956f},
-std::array<float,2>{0.203319341f, 0.735782504f},
-std::array<float,2>{0.574848473f, 0.901434183f},
-std::array<float,2>{0.420862705f, 0.317626357f},
-std::array<float,2>{0.982156396f, 0.258435398f},
-std::array<float,2>{0.214891583f, 0.984973729f},
-std::array<float,2>{0.56272912f, 0.635611355f},
-std::array<float,2>{0.408072144f, 0.183288574f},
-std::array<float,2>{0.725369155f, 0.0236464683f},
-std::array<float,2>{0.285887629f, 0.538617671f},
-std::array<float,2>{0.821984947f, 0.801624954f},
-std::array<float,2>{0.0477020107f, 0.447787374f},
-std::array<float,2>{0.503478229f, 0.375908792f},
-std::array<float,2>{0.447607815f, 0.870987892f},
-std::array<float,2>{0.927866161f, 0.603508234f},
-std::array<float,2>{0.13830629f, 0.0962766856f},
-std::array<float,2>{0.76832509f, 0.233859733f},
-std::array<float,2>{0.0714376271f, 0.719969451f},
-std::array<float,2>{0.631624699f, 0.879675329f},
-std::array<float,2>{0.323914289f, 0.329140663f},
-std::array<float,2>{0.860235631f, 0.482004285f},
-std::array<float,2>{0.0231008511f, 0.773270309f},
-std::array<float,2>{0.692465901f, 0.505328178f},
-std::array<float,2>{0.280795872f, 0.0423058122f},
-std::array<float,2>{0.619672954f, 0.130970165f},
-std::array<float,2>{0.401029289f, 0.681100309f},
-std::array<float,2>{0.965358198f, 0.951793909f},
-std::array<float,2>{0.239226148f, 0.305749446f},
-std::array<float,2>{0.679792106f, 0.350738972f},
-std::array<float,2>{0.368476093f, 0.906627536f},
-std::array<float,2>{0.801136374f, 0.714755177f},
-std::array<float,2>{0.105472989f, 0.197045267f},
-std::array<float,2>{0.8910321f, 0.0699190795f},
-std::array<float,2>{0.182405844f, 0.590076029f},
-std::array<float,2>{0.53545624f, 0.822230697f},
-std::array<float,2>{0.489589751f, 0.426045567f},
-std::array<float,2>{0.917880476f, 0.413634449f},
-std::array<float,2>{0.143491596f, 0.833039463f},
-std::array<float,2>{0.529547513f, 0.571123719f},
-std::array<float,2>{0.465708196f, 0.0849604979f},
-std::array<float,2>{0.651598752f, 0.205251113f},
-std::array<float,2>{0.330523372f, 0.697460234f},
-std::array<float,2>{0.757275641f, 0.924457014f},
-std::array<float,2>{0.0843714997f, 0.369440407f},
-std::array<float,2>{0.585455239f, 0.281656086f},
-std::array<float,2>{0.425612241f, 0.967376649f},
-std::array<float,2>{0.993536115f, 0.671644509f},
-std::array<float,2>{0.192551404f, 0.146966249f},
-std::array<float,2>{0.831242502f, 0.0599415787f},
-std::array<float,2>{0.0437621474f, 0.520015419f},
-std::array<float,2>{0.738396168f, 0.76190722f},
-std::array<float,2>{0.301108152f, 0.493483186f},
-std::array<float,2>{0.79404074f, 0.314536601f},
-std::array<float,2>{0.10996294f, 0.903855264f},
-std::array<float,2>{0.671077192f, 0.738435447f},
-std::array<float,2>{0.355600774f, 0.239341795f},
-std::array<float,2>{0.555645168f, 0.121017314f},
-std::array<float,2>{0.478334218f, 0.621040106f},
-std::array<float,2>{0.882279336f, 0.847675681f},
-std::array<float,2>{0.17015554f, 0.39912346f},
-std::array<float,2>{0.703939438f, 0.462172031f},
-std::array<float,2>{0.250923663f, 0.791795611f},
-std::array<float,2>{0.855307937f, 0.559902608f},
-std::array<float,2>{0.00789952464f, 0.0155143421f},
-std::array<float,2>{0.942911685f, 0.170375854f},
-std::array<float,2>{0.224782705f, 0.654770374f},
-std::array<float,2>{0.595758557f, 0.975485504f},
-std::array<float,2>{0.377108425f, 0.274049312f},
-std::array<float,2>{0.886375606f, 0.362787187f},
-std::array<float,2>{0.157669485f, 0.935957611f},
-std::array<float,2>{0.554336548f, 0.693718791f},
-std::array<float,2>{0.475621849f, 0.211457327f},
-std::array<float,2>{0.657727957f, 0.0883650631f},
-std::array<float,2>{0.347161353f, 0.569277287f},
-std::array<float,2>{0.786961675f, 0.842956781f},
-std::array<float,2>{0.121043578f, 0.419252306f},
-std::array<float,2>{0.604568422f, 0.488778621f},
-std::array<float,2>{0.385027736f, 0.750600934f},
-std::array<float,2>{0.952932656f, 0.524787366f},
-std::array<float,2>{0.233642027f, 0.0476291664f},
-std::array<float,2>{0.847269595f, 0.155276284f},
-std::array<float,2>{0.000643054431f, 0.660032332f},
-std::array<float,2>{0.714108646f, 0.957425654f},
-std::array<float,2>{0.261894673f, 0.292227864f},
-std::array<float,2>{0.765154481f, 0.393366516f},
-std::array<float,2>{0.0880964249f, 0.856956542f},
-std::array<float,2>{0.641847014f, 0.612133503f},
-std::array<float,2>{0.339400887f, 0.114228949f},
-std::array<float,2>{0.521344006f, 0.249826819f},
-std::array<float,2>{0.459774643f, 0.745166063f},
-std::array<float,2>{0.909462214f, 0.893740833f},
-std::array<float,2>{0.149948776f, 0.327781707f},
-std::array<float,2>{0.742271662f, 0.272137046f},
-std::array<float,2>{0.310577303f, 0.984033227f},
-std::array<float,2>{0.840274692f, 0.644570708f},
-std::array<float,2>{0.0381087251f, 0.157053873f},
-std::array<float,2>{0.988826513f, 0.00772166438f},
-std::array<float,2>{0.199139506f, 0.551895618f},
-std::array<float,2>{0.588124931f, 0.781395614f},
-std::array<float,2>{0.437015533f, 0.45634228f},
-std::array<float,2>{0.957058012f, 0.444117069f},
-std::array<float,2>{0.247520551f, 0.810883284f},
-std::array<float,2>{0.609409153f, 0.54199475f},
-std::array<float,2>{0.397404671f, 0.0209156796f},
-std::array<float,2>{0.703054547f, 0.178181827f},
-std::array<float,2>{0.270573109f, 0.626827419f},
-std::array<float,2>{0.873745203f, 0.992947578f},
-std::array<float,2>{0.0275737327f, 0.254885703f},
-std::array<float,2>{0.541247368f, 0.337126821f},
-std::array<float,2>{0.493204057f, 0.88629204f},
-std::array<float,2>{0.899651289f, 0.727394104f},
-std::array<float,2>{0.179031044f, 0.223958358f},
-std::array<float,2>{0.805082202f, 0.104068488f},
-std::array<float,2>{0.0952336416f, 0.597509801f},
-std::array<float,2>{0.677238345f, 0.859567702f},
-std::array<float,2>{0.362036914f, 0.383823305f},
-std::array<float,2>{0.813456774f, 0.296912611f},
-std::array<float,2>{0.0563216172f, 0.938836515f},
-std::array<float,2>{0.726668715f, 0.675020456f},
-std::array<float,2>{0.29230848f, 0.13682586f},
-std::array<float,2>{0.571700811f, 0.0380467996f},
-std::array<float,2>{0.417691648f, 0.509067059f},
-std::array<float,2>{0.970396161f, 0.775405049f},
-std::array<float,2>{0.210907444f, 0.471687049f},
-std::array<float,2>{0.637106061f, 0.435831577f},
-std::array<float,2>{0.317847252f, 0.814221263f},
-std::array<float,2>{0.779902697f, 0.583624125f},
-std::array<float,2>{0.0660093054f, 0.0703143552f},
-std::array<float,2>{0.93747139f, 0.193712577f},
-std::array<float,2>{0.131865069f, 0.705153286f},
-std::array<float,2>{0.515589058f, 0.914281547f},
-std::array<float,2>{0.442456067f, 0.351575494f},
-std::array<float,2>{0.895966768f, 0.269266188f},
-std::array<float,2>{0.186466038f, 0.97661221f},
-std::array<float,2>{0.531659722f, 0.641915381f},
-std::array<float,2>{0.486287653f, 0.161631748f},
-std::array<float,2>{0.685512662f, 0.00265804934f},
-std::array<float,2>{0.371893227f, 0.548461854f},
-std::array<float,2>{0.798256636f, 0.787824273f},
-std::array<float,2>{0.105114959f, 0.457046062f},
-std::array<float,2>{0.622436106f, 0.395722777f},
-std::array<float,2>{0.402659804f, 0.853616536f},
-std::array<float,2>{0.96430403f, 0.613315821f},
-std::array<float,2>{0.237890735f, 0.110658847f},
-std::array<float,2>{0.864150405f, 0.243007064f},
-std::array<float,2>{0.0193203911f, 0.749815106f},
-std::array<float,2>{0.68825078f, 0.895830691f},
-std::array<float,2>{0.276633978f, 0.320744425f},
-std::array<float,2>{0.770234942f, 0.488256156f},
-std::array<float,2>{0.0747104883f, 0.757490396f},
-std::array<float,2>{0.625879765f, 0.530556798f},
-std::array<float,2>{0.327177644f, 0.051978346f},
-std::array<float,2>{0.507711411f, 0.152071416f},
-std::array<float,2>{0.452844352f, 0.662008166f},
-std::array<float,2>{0.923785508f, 0.954612076f},
-std::array<float,2>{0.133510739f, 0.293178588f},
-std::array<float,2>{0.720735133f, 0.365584403f},
-std::array<float,2>{0.282300532f, 0.931300163f},
-std::array<float,2>{0.82675308f, 0.690177917f},
-std::array<float,2>{0.0536426231f, 0.215059981f},
-std::array<float,2>{0.979111671f, 0.0912710428f},
-std::array<float,2>{0.211264789f, 0.564305186f},
-std::array<float,2>{0.56705898f, 0.839183211f},
-std::array<float,2>{0.413826287f, 0.416839778f},
-std::array<float,2>{0.937872767f, 0.432433784f},
-std::array<float,2>{0.222338066f, 0.818503976f},
-std::array<float,2>{0.599791169f, 0.57910651f},
-std::array<float,2>{0.380916029f, 0.0745839924f},
-std::array<float,2>{0.710012376f, 0.187971994f},
-std::array<float,2>{0.256177127f, 0.709377408f},
-std::array<float,2>{0.857424438f, 0.921660125f},
-std::array<float,2>{0.0131464843f, 0.357608378f},
-std::array<float,2>{0.55987525f, 0.300787598f},
-std::array<float,2>{0.480892986f, 0.944624662f},
-std::array<float,2>{0.877524972f, 0.675897479f},
-std::array<float,2>{0.164962128f, 0.136684299f},
-std::array<float,2>{0.792919934f, 0.0342916772f},
-std::array<float,2>{0.115197882f, 0.512018561f},
-std::array<float,2>{0.666908801f, 0.779536784f},
-std::array<float,2>{0.351694375f, 0.476206869f},
-std::array<float,2>{0.832375407f, 0.341143966f},
-std::array<float,2>{0.0403650738f, 0.886982083f},
-std::array<float,2>{0.735353768f, 0.732956946f},
-std::array<float,2>{0.297655374f, 0.220298409f},
-std::array<float,2>{0.578266025f, 0.107900321f},
-std::array<float,2>{0.429313302f, 0.598143578f},
-std::array<float,2>{0.998089969f, 0.864693642f},
-std::array<float,2>{0.188041478f, 0.387687802f},
-std::array<float,2>{0.65580827f, 0.440333605f},
-std::array<float,2>{0.334674358f, 0.805509031f},
-std::array<float,2>{0.751779795f, 0.543879926f},
-std::array<float,2>{0.0811120793f, 0.0177564826f},
-std::array<float,2>{0.920459867f, 0.174341261f},
-std::array<float,2>{0.146897689f, 0.631321967f},
-std::array<float,2>{0.525057077f, 0.996986628f},
-std::array<float,2>{0.461955607f, 0.253441036f},
-std::array<float,2>{0.984895527f, 0.3471784f},
-std::array<float,2>{0.202223435f, 0.910493731f},
-std::array<float,2>{0.590591133f, 0.718202889f},
-std::array<float,2>{0.432829589f, 0.2010369f},
-std::array<float,2>{0.748005152f, 0.0639527962f},
-std::array<float,2>{0.305587769f, 0.58981967f},
-std::array<float,2>{0.836234391f, 0.825456858f},
-std::array<float,2>{0.0323331095f, 0.422928035f},
-std::array<float,2>{0.517824054f, 0.47816214f},
-std::array<float,2>{0.453174561f, 0.767763793f},
-std::array<float,2>{0.911409974f, 0.500092328f},
-std::array<float,2>{0.156117618f, 0.0458623096f},
-std::array<float,2>{0.75919795f, 0.128404871f},
-std::array<float,2>{0.0935537443f, 0.684329033f},
-std::array<float,2>{0.648225009f, 0.94717443f},
-std::array<float,2>{0.343608797f, 0.311249554f},
-std::array<float,2>{0.848277748f, 0.382086098f},
-std::array<float,2>{0.00498324307f, 0.871201396f},
-std::array<float,2>{0.715343952f, 0.60889411f},
-std::array<float,2>{0.258459479f, 0.100533433f},
-std::array<float,2>{0.608119369f, 0.226746112f},
-std::array<float,2>{0.386855721f, 0.723681867f},
-std::array<float,2>{0.945370317f, 0.878842831f},
-std::array<float,2>{0.227912039f, 0.335676283f},
-std::array<float,2>{0.660518706f, 0.263709664f},
-std::array<float,2>{0.350504935f, 0.990808368f},
-std::array<float,2>{0.782642484f, 0.637895763f},
-std::array<float,2>{0.124557503f, 0.183715031f},
-std::array<float,2>{0.889191091f, 0.0308603682f},
-std::array<float,2>{0.163070381f, 0.531593502f},
-std::array<float,2>{0.549719274f, 0.800695419f},
-std::array<float,2>{0.472590595f, 0.452052325f},
-std::array<float,2>{0.930267215f, 0.464844406f},
-std::array<float,2>{0.128454298f, 0.793569207f},
-std::array<float,2>{0.510055602f, 0.55733335f},
-std::array<float,2>{0.439426363f, 0.00881180167f},
-std::array<float,2>{0.635179579f, 0.166563109f},
-std::array<float,2>{0.313397646f, 0.649496019f},
-std::array<float,2>{0.777052164f, 0.972263932f},
-std::array<float,2>{0.0690953955f, 0.279199749f},
-std::array<float,2>{0.577314436f, 0.319897592f},
-std::array<float,2>{0.419523746f, 0.899913788f},
-std::array<float,2>{0.97290498f, 0.736659825f},
-std::array<float,2>{0.20692417f, 0.237221017f},
-std::array<float,2>{0.816960454f, 0.123242415f},
-std::array<float,2>{0.0620007478f, 0.622442305f},
-std::array<float,2>{0.730987132f, 0.847335279f},
-std::array<float,2>{0.29637599f, 0.405390829f},
-std::array<float,2>{0.810927033f, 0.28614229f},
-std::array<float,2>{0.100983746f, 0.963075697f},
-std::array<float,2>{0.673981786f, 0.667610645f},
-std::array<float,2>{0.364241391f, 0.143561885f},
-std::array<float,2>{0.544869542f, 0.0554481782f},
-std::array<float,2>{0.496769875f, 0.518984735f},
-std::array<float,2>{0.903750956f, 0.758704066f},
-std::array<float,2>{0.17440176f, 0.498551548f},
-std::array<float,2>{0.698415279f, 0.408866972f},
-std::array<float,2>{0.267722845f, 0.829656005f},
-std::array<float,2>{0.867709756f, 0.575466275f},
-std::array<float,2>{0.0253548771f, 0.0815182477f},
-std::array<float,2>{0.954925179f, 0.208066523f},
-std::array<float,2>{0.243102208f, 0.702232838f},
-std::array<float,2>{0.615167141f, 0.927178383f},
-std::array<float,2>{0.391116142f, 0.374919444f},
-std::array<float,2>{0.968002439f, 0.307404935f},
-std::array<float,2>{0.241643146f, 0.950824678f},
-std::array<float,2>{0.61835295f, 0.6820544f},
-std::array<float,2>{0.400210708f, 0.128940672f},
-std::array<float,2>{0.694145679f, 0.0395180136f},
-std::array<float,2>{0.277652144f, 0.505955994f},
-std::array<float,2>{0.861669302f, 0.770255268f},
-std::array<float,2>{0.0200819839f, 0.484334975f},
-std::array<float,2>{0.538065314f, 0.42877385f},
-std::array<float,2>{0.490693301f, 0.823321879f},
-std::array<float,2>{0.894164085f, 0.59245342f},
-std::array<float,2>{0.180832952f, 0.0665761009f},
-std::array<float,2>{0.803884566f, 0.197728842f},
-std::array<float,2>{0.107671611f, 0.711339951f},
-std::array<float,2>{0.683437228f, 0.909339368f},
-std::array<float,2>{0.370521337f, 0.348916233f},
-std::array<float,2>{0.823356628f, 0.446010292f},
-std::array<float,2>{0.0497392714f, 0.803895473f},
-std::array<float,2>{0.72289741f, 0.535393059f},
-std::array<float,2>{0.287831485f, 0.0255063716f},
-std::array<float,2>{0.565692425f, 0.181125641f},
-std::array<float,2>{0.408214182f, 0.634318352f},
-std::array<float,2>{0.983767688f, 0.986353636f},
-std::array<float,2>{0.218580604f, 0.26019299f},
-std::array<float,2>{0.629597902f, 0.330670983f},
-std::array<float,2>{0.320333958f, 0.882718742f},
-std::array<float,2>{0.766926706f, 0.722513497f},
-std::array<float,2>{0.0736989975f, 0.230797186f},
-std::array<float,2>{0.927286923f, 0.0940180644f},
-std::array<float,2>{0.140217364f, 0.605217993f},
-std::array<float,2>{0.501720667f, 0.867638588f},
-std::array<float,2>{0.445607096f, 0.378666341f},
-std::array<float,2>{0.880006611f, 0.401654303f},
-std::array<float,2>{0.169196308f, 0.850389659f},
-std::array<float,2>{0.556693971f, 0.617689192f},
-std::array<float,2>{0.478678793f, 0.118188694f},
-std::array<float,2>{0.668148935f, 0.242169157f},
-std::array<float,2>{0.3588925f, 0.741636992f},
-std::array<float,2>{0.795552969f, 0.905579686f},
-std::array<float,2>{0.111637399f, 0.313293576f},
-std::array<float,2>{0.595494688f, 0.276326209f},
-std::array<float,2>{0.376544088f, 0.973814428f},
-std::array<float,2>{0.943696022f, 0.653231621f},
-std::array<float,2>{0.224085331f, 0.169504732f},
-std::array<float,2>{0.851990044f, 0.0136655178f},
-std::array<float,2>{0.0104438607f, 0.560776889f},
-std::array<float,2>{0.705738425f, 0.790093362f},
-std::array<float,2>{0.253438681f, 0.463009328f},
-std::array<float,2>{0.754133523f, 0.368823022f},
-std::array<float,2>{0.0823128447f, 0.923252821f},
-std::array<float,2>{0.648493946f, 0.696977079f},
-std::array<float,2>{0.329516232f, 0.203774214f},
-std::array<float,2>{0.52903235f, 0.0823036209f},
-std::array<float,2>{0.467755884f, 0.573190391f},
-std::array<float,2>{0.914237738f, 0.834152162f},
-std::array<float,2>{0.141926512f, 0.411158144f},
-std::array<float,2>{0.74070853f, 0.494712472f},
-std::array<float,2>{0.303221643f, 0.764569342f},
-std::array<float,2>{0.829554617f, 0.521601021f},
-std::array<float,2>{0.0456225798f, 0.0608261265f},
-std::array<float,2>{0.99553901f, 0.144966751f},
-std::array<float,2>{0.19463113f, 0.668574989f},
-std::array<float,2>{0.582847834f, 0.966366947f},
-std::array<float,2>{0.423635185f, 0.283931732f},
-std::array<float,2>{0.906765521f, 0.324699163f},
-std::array<float,2>{0.150868416f, 0.892183304f},
-std::array<float,2>{0.521549821f, 0.743717492f},
-std::array<float,2>{0.457764298f, 0.247322619f},
-std::array<float,2>{0.644454837f, 0.116796188f},
-std::array<float,2>{0.336522102f, 0.610481024f},
-std::array<float,2>{0.761855066f, 0.85880208f},
-std::array<float,2>{0.0878593624f, 0.39165777f},
-std::array<float,2>{0.586015403f, 0.453390628f},
-std::array<float,2>{0.435336977f, 0.784448206f},
-std::array<float,2>{0.9902426f, 0.55275327f},
-std::array<float,2>{0.195891127f, 0.00536048366f},
-std::array<float,2>{0.842748463f, 0.159886762f},
-std::array<float,2>{0.0352899097f, 0.646966398f},
-std::array<float,2>{0.744496703f, 0.98178941f},
-std::array<float,2>{0.309742898f, 0.270637512f},
-std::array<float,2>{0.787299216f, 0.42166087f},
-std::array<float,2>{0.117892534f, 0.84145999f},
-std::array<float,2>{0.658487499f, 0.567048132f},
-std::array<float,2>{0.345422745f, 0.0878732577f},
-std::array<float,2>{0.551453054f, 0.213905811f},
-std::array<float,2>{0.474122494f, 0.691746235f},
-std::array<float,2>{0.883795381f, 0.934915245f},
-std::array<float,2>{0.15847218f, 0.360605657f},
-std::array<float,2>{0.712215364f, 0.289594203f},
-std::array<float,2>{0.264790922f, 0.959045231f},
-std::array<float,2>{0.845194459f, 0.656278729f},
-std::array<float,2>{0.00235869037f, 0.15243502f},
-std::array<float,2>{0.949751914f, 0.0496312082f},
-std::array<float,2>{0.230922118f, 0.525808513f},
-std::array<float,2>{0.60200429f, 0.752120912f},
-std::array<float,2>{0.383331925f, 0.490826368f},
-std::array<float,2>{0.972258747f, 0.470139354f},
-std::array<float,2>{0.207543001f, 0.77530396f},
-std::array<float,2>{0.574052691f, 0.510599792f},
-std::array<float,2>{0.415511727f, 0.0353741832f},
-std::array<float,2>{0.72979176f, 0.139032185f},
-std::array<float,2>{0.290663749f, 0.673665404f},
-std::array<float,2>{0.816147506f, 0.941405118f},
-std::array<float,2>{0.0569554567f, 0.300679713f},
-std::array<float,2>{0.513338029f, 0.354574502f},
-std::array<float,2>{0.443546623f, 0.91669625f},
-std::array<float,2>{0.934313774f, 0.703522325f},
-std::array<float,2>{0.130046308f, 0.193282932f},
-std::array<float,2>{0.777372777f, 0.0722774044f},
-std::array<float,2>{0.0631630272f, 0.584452927f},
-std::array<float,2>{0.64037478f, 0.815443397f},
-std::array<float,2>{0.319272161f, 0.434956431f},
-std::array<float,2>{0.872224212f, 0.256247908f},
-std::array<float,2>{0.0299560428f, 0.994686544f},
-std::array<float,2>{0.699899614f, 0.62881887f},
-std::array<float,2>{0.272364378f, 0.176121965f},
-std::array<float,2>{0.612838686f, 0.0230894666f},
-std::array<float,2>{0.396024585f, 0.540222049f},
-std::array<float,2>{0.959326446f, 0.810364127f},
-std::array<float,2>{0.249322742f, 0.442281097f},
-std::array<float,2>{0.678207576f, 0.386048704f},
-std::array<float,2>{0.360698491f, 0.862797618f},
-std::array<float,2>{0.807246923f, 0.59424597f},
-std::array<float,2>{0.0973515064f, 0.101568647f},
-std::array<float,2>{0.90064913f, 0.226192847f},
-std::array<float,2>{0.176540717f, 0.728841126f},
-std::array<float,2>{0.540617824f, 0.883856177f},
-std::array<float,2>{0.495014608f, 0.339789212f},
-std::array<float,2>{0.878456712f, 0.303916454f},
-std::array<float,2>{0.165295035f, 0.943299234f},
-std::array<float,2>{0.558823586f, 0.677862108f},
-std::array<float,2>{0.481782436f, 0.134640738f},
-std::array<float,2>{0.667139947f, 0.0320629887f},
-std::array<float,2>{0.353482425f, 0.514548063f},
-std::array<float,2>{0.791725814f, 0.779116631f},
-std::array<float,2>{0.114163935f, 0.472956687f},
-std::array<float,2>{0.601066947f, 0.430496156f},
-std::array<float,2>{0.381921321f, 0.817973495f},
-std::array<float,2>{0.938893974f, 0.581746399f},
-std::array<float,2>{0.221660182f, 0.076404877f},
-std::array<float,2>{0.859168589f, 0.190672785f},
-std::array<float,2>{0.0124331024f, 0.708477437f},
-std::array<float,2>{0.709067404f, 0.91986537f},
-std::array<float,2>{0.256920308f, 0.357017547f},
-std::array<float,2>{0.750135958f, 0.438570261f},
-std::array<float,2>{0.0806918889f, 0.808475852f},
-std::array<float,2>{0.655049086f, 0.546331346f},
-std::array<float,2>{0.335037977f, 0.017353829f},
-std::array<float,2>{0.524386942f, 0.173643947f},
-std::array<float,2>{0.460996866f, 0.630621612f},
-std::array<float,2>{0.921439767f, 0.999979556f},
-std::array<float,2>{0.147934377f, 0.251240909f},
-std::array<float,2>{0.734799445f, 0.343433052f},
-std::array<float,2>{0.298616081f, 0.889107704f},
-std::array<float,2>{0.833250821f, 0.730572462f},
-std::array<float,2>{0.0398739949f, 0.221478119f},
-std::array<float,2>{0.99933815f, 0.106911123f},
-std::array<float,2>{0.188785031f, 0.600957692f},
-std::array<float,2>{0.579296589f, 0.866098464f},
-std::array<float,2>{0.427943766f, 0.3903476f},
-std::array<float,2>{0.963851333f, 0.396629304f},
-std::array<float,2>{0.237247378f, 0.85292381f},
-std::array<float,2>{0.62138474f, 0.616863191f},
-std::array<float,2>{0.403597832f, 0.111956909f},
-std::array<float,2>{0.688759625f, 0.245924532f},
-std::array<float,2>{0.276036173f, 0.747243226f},
-std::array<float,2>{0.86468333f, 0.896762669f},
-std::array<float,2>{0.0184928328f, 0.32407406f},
-std::array<float,2>{0.533071518f, 0.266858548f},
-std::array<float,2>{0.485333294f, 0.978806257f},
-std::array<float,2>{0.895250499f, 0.643455088f},
-std::array<float,2>{0.18715629f, 0.162954807f},
-std::array<float,2>{0.797333121f, 0.00167419901f},
-std::array<float,2>{0.104008608f, 0.549547315f},
-std::array<float,2>{0.683686793f, 0.785774529f},
-std::array<float,2>{0.373028338f, 0.460859478f},
-std::array<float,2>{0.827470064f, 0.363948733f},
-std::array<float,2>{0.054479368f, 0.932736158f},
-std::array<float,2>{0.722499788f, 0.689253271f},
-std::array<float,2>{0.282007039f, 0.217832372f},
-std::array<float,2>{0.567389905f, 0.092089206f},
-std::array<float,2>{0.412571102f, 0.565059781f},
-std::array<float,2>{0.980119109f, 0.8368572f},
-std::array<float,2>{0.212278619f, 0.415213823f},
-std::array<float,2>{0.626593828f, 0.4848032f},
-std::array<float,2>{0.326780945f, 0.755472124f},
-std::array<float,2>{0.770749688f, 0.528029203f},
-std::array<float,2>{0.07611195f, 0.0529516526f},
-std::array<float,2>{0.921963811f, 0.150154203f},
-std::array<float,2>{0.134695411f, 0.662878096f},
-std::array<float,2>{0.50611788f, 0.956494749f},
-std::array<float,2>{0.451607794f, 0.29628849f},
-std::array<float,2>{0.974285841f, 0.317177296f},
-std::array<float,2>{0.2051346f, 0.900801957f},
-std::array<float,2>{0.576494098f, 0.735261559f},
-std::array<float,2>{0.418367594f, 0.236312792f},
-std::array<float,2>{0.731864452f, 0.121155046f},
-std::array<float,2>{0.295301169f, 0.624986827f},
-std::array<float,2>{0.818208456f, 0.844785392f},
-std::array<float,2>{0.0615160055f, 0.402355373f},
-std::array<float,2>{0.511244774f, 0.468654126f},
-std::array<float,2>{0.437814087f, 0.795717239f},
-std::array<float,2>{0.931286931f, 0.555824161f},
-std::array<float,2>{0.127022505f, 0.0106219687f},
-std::array<float,2>{0.775909066f, 0.164602444f},
-std::array<float,2>{0.0702512562f, 0.650598109f},
-std::array<float,2>{0.635994971f, 0.970646441f},
-std::array<float,2>{0.31376037f, 0.279637069f},
-std::array<float,2>{0.868279278f, 0.408173054f},
-std::array<float,2>{0.0237525776f, 0.831862152f},
-std::array<float,2>{0.698216915f, 0.577803552f},
-std::array<float,2>{0.268586457f, 0.0795318186f},
-std::array<float,2>{0.613792598f, 0.20960471f},
-std::array<float,2>{0.391758084f, 0.700862408f},
-std::array<float,2>{0.953922987f, 0.927926779f},
-std::array<float,2>{0.243573695f, 0.371199489f},
-std::array<float,2>{0.675123572f, 0.288049847f},
-std::array<float,2>{0.364315778f, 0.960982084f},
-std::array<float,2>{0.811666548f, 0.664890766f},
-std::array<float,2>{0.100145042f, 0.140836909f},
-std::array<float,2>{0.902958512f, 0.0584622212f},
-std::array<float,2>{0.175669894f, 0.516748071f},
-std::array<float,2>{0.543830633f, 0.760586858f},
-std::array<float,2>{0.497492909f, 0.496654689f},
-std::array<float,2>{0.910491824f, 0.478717715f},
-std::array<float,2>{0.154518366f, 0.766251266f},
-std::array<float,2>{0.519459069f, 0.503437757f},
-std::array<float,2>{0.454495072f, 0.0442889854f},
-std::array<float,2>{0.646511793f, 0.126827896f},
-std::array<float,2>{0.342229664f, 0.686142683f},
-std::array<float,2>{0.758504331f, 0.947817147f},
-std::array<float,2>{0.092237249f, 0.309448063f},
-std::array<float,2>{0.591393352f, 0.343770921f},
-std::array<float,2>{0.432263017f, 0.912431359f},
-std::array<float,2>{0.986054838f, 0.715020895f},
-std::array<float,2>{0.201178297f, 0.201335624f},
-std::array<float,2>{0.837475419f, 0.0645793229f},
-std::array<float,2>{0.0316369757f, 0.586643696f},
-std::array<float,2>{0.746548653f, 0.827348351f},
-std::array<float,2>{0.305996269f, 0.424344391f},
-std::array<float,2>{0.781351924f, 0.261720389f},
-std::array<float,2>{0.123950161f, 0.990144849f},
-std::array<float,2>{0.661660373f, 0.639084399f},
-std::array<float,2>{0.350766838f, 0.185921788f},
-std::array<float,2>{0.549806535f, 0.027797902f},
-std::array<float,2>{0.471610963f, 0.533740938f},
-std::array<float,2>{0.889695346f, 0.79818964f},
-std::array<float,2>{0.163615912f, 0.450191528f},
-std::array<float,2>{0.71649915f, 0.379059136f},
-std::array<float,2>{0.259236664f, 0.874763072f},
-std::array<float,2>{0.849282801f, 0.60626024f},
-std::array<float,2>{0.00486197183f, 0.0989535004f},
-std::array<float,2>{0.946943402f, 0.229313746f},
-std::array<float,2>{0.227318257f, 0.726477563f},
-std::array<float,2>{0.608695805f, 0.875571191f},
-std::array<float,2>{0.388260394f, 0.332748353f},
-std::array<float,2>{0.944742978f, 0.274746954f},
-std::array<float,2>{0.223627806f, 0.976349235f},
-std::array<float,2>{0.593858361f, 0.655358374f},
-std::array<float,2>{0.375035912f, 0.171125636f},
-std::array<float,2>{0.706161618f, 0.0144266821f},
-std::array<float,2>{0.252533913f, 0.559522927f},
-std::array<float,2>{0.853184104f, 0.792759836f},
-std::array<float,2>{0.0115417186f, 0.460955799f},
-std::array<float,2>{0.558329821f, 0.399988264f},
-std::array<float,2>{0.480254829f, 0.849079311f},
-std::array<float,2>{0.87919122f, 0.619263589f},
-std::array<float,2>{0.16892378f, 0.119484939f},
-std::array<float,2>{0.79622519f, 0.238886133f},
-std::array<float,2>{0.112313919f, 0.739479423f},
-std::array<float,2>{0.669523239f, 0.902598083f},
-std::array<float,2>{0.358116865f, 0.316153377f},
-std::array<float,2>{0.828335643f, 0.492220551f},
-std::array<float,2>{0.0461101793f, 0.763309181f},
-std::array<float,2>{0.741975427f, 0.521021545f},
-std::array<float,2>{0.303767473f, 0.0594297498f},
-std::array<float,2>{0.583490431f, 0.148359418f},
-std::array<float,2>{0.422709167f, 0.670477986f},
-std::array<float,2>{0.994373083f, 0.967960894f},
-std::array<float,2>{0.193879604f, 0.283151895f},
-std::array<float,2>{0.64976728f, 0.370593607f},
-std::array<float,2>{0.328850567f, 0.925061703f},
-std::array<float,2>{0.755394161f, 0.699041128f},
-std::array<float,2>{0.0837846473f, 0.206653908f},
-std::array<float,2>{0.91543889f, 0.0854889005f},
-std::array<float,2>{0.140870303f, 0.571727157f},
-std::array<float,2>{0.52826941f, 0.83300519f},
-std::array<float,2>{0.468148798f, 0.412411094f},
-std::array<float,2>{0.892832816f, 0.427584916f},
-std::array<float,2>{0.180034265f, 0.820876598f},
-std::array<float,2>{0.538327396f, 0.591768146f},
-std::array<float,2>{0.491921395f, 0.0683661699f},
-std::array<float,2>{0.682543755f, 0.195495233f},
-std::array<float,2>{0.369631201f, 0.713765979f},
-std::array<float,2>{0.803375065f, 0.907341897f},
-std::array<float,2>{0.108468279f, 0.350165546f},
-std::array<float,2>{0.618001878f, 0.305325896f},
-std::array<float,2>{0.399286896f, 0.952851474f},
-std::array<float,2>{0.967654407f, 0.680178225f},
-std::array<float,2>{0.240647271f, 0.131981388f},
-std::array<float,2>{0.862852812f, 0.0415009111f},
-std::array<float,2>{0.0206100866f, 0.504873931f},
-std::array<float,2>{0.694718242f, 0.771489799f},
-std::array<float,2>{0.278651565f, 0.48134923f},
-std::array<float,2>{0.766181946f, 0.328888446f},
-std::array<float,2>{0.0731148645f, 0.880617857f},
-std::array<float,2>{0.630567431f, 0.719009221f},
-std::array<float,2>{0.32167834f, 0.232562259f},
-std::array<float,2>{0.500720263f, 0.0972864702f},
-std::array<float,2>{0.44668591f, 0.601764739f},
-std::array<float,2>{0.925909579f, 0.869671047f},
-std::array<float,2>{0.138685718f, 0.376829624f},
-std::array<float,2>{0.724053681f, 0.448806256f},
-std::array<float,2>{0.288348705f, 0.802601397f},
-std::array<float,2>{0.822288811f, 0.537751496f},
-std::array<float,2>{0.0505947247f, 0.024566425f},
-std::array<float,2>{0.983238339f, 0.181851283f},
-std::array<float,2>{0.217158496f, 0.636602223f},
-std::array<float,2>{0.564882815f, 0.985471189f},
-std::array<float,2>{0.40978688f, 0.258824348f},
-std::array<float,2>{0.9348557f, 0.352852404f},
-std::array<float,2>{0.129562795f, 0.915710807f},
-std::array<float,2>{0.511804998f, 0.706227183f},
-std::array<float,2>{0.444692433f, 0.195205688f},
-std::array<float,2>{0.639385641f, 0.0720702931f},
-std::array<float,2>{0.319865674f, 0.58209753f},
-std::array<float,2>{0.778905392f, 0.812656879f},
-std::array<float,2>{0.0638661757f, 0.436625123f},
-std::array<float,2>{0.572324038f, 0.471632868f},
-std::array<float,2>{0.41428861f, 0.777281582f},
-std::array<float,2>{0.971277297f, 0.50796926f},
-std::array<float,2>{0.208166927f, 0.0387283526f},
-std::array<float,2>{0.815103889f, 0.138330489f},
-std::array<float,2>{0.0577480048f, 0.674014032f},
-std::array<float,2>{0.729055107f, 0.937718391f},
-std::array<float,2>{0.28960073f, 0.298568696f},
-std::array<float,2>{0.808285832f, 0.383557111f},
-std::array<float,2>{0.0963252634f, 0.860917032f},
-std::array<float,2>{0.678808689f, 0.5961411f},
-std::array<float,2>{0.359986275f, 0.104786009f},
-std::array<float,2>{0.539859533f, 0.223412499f},
-std::array<float,2>{0.49580428f, 0.728221714f},
-std::array<float,2>{0.902063668f, 0.885659635f},
-std::array<float,2>{0.177076399f, 0.336180955f},
-std::array<float,2>{0.700810671f, 0.254082471f},
-std::array<float,2>{0.273328513f, 0.993933201f},
-std::array<float,2>{0.871313572f, 0.625656068f},
-std::array<float,2>{0.0310084093f, 0.179176643f},
-std::array<float,2>{0.960863769f, 0.0197147559f},
-std::array<float,2>{0.248886824f, 0.541397691f},
-std::array<float,2>{0.611495197f, 0.811812818f},
-std::array<float,2>{0.395055234f, 0.444740057f},
-std::array<float,2>{0.992055774f, 0.45508194f},
-std::array<float,2>{0.196622074f, 0.783033252f},
-std::array<float,2>{0.587308586f, 0.550859988f},
-std::array<float,2>{0.434263527f, 0.00651856232f},
-std::array<float,2>{0.745549738f, 0.158194065f},
-std::array<float,2>{0.309098065f, 0.646196723f},
-std::array<float,2>{0.843597531f, 0.983097911f},
-std::array<float,2>{0.0363637432f, 0.272653192f},
-std::array<float,2>{0.522580922f, 0.327068985f},
-std::array<float,2>{0.4583188f, 0.893325567f},
-std::array<float,2>{0.908180356f, 0.744678617f},
-std::array<float,2>{0.151764035f, 0.248773575f},
-std::array<float,2>{0.763262928f, 0.11510738f},
-std::array<float,2>{0.0860166699f, 0.613170505f},
-std::array<float,2>{0.642890275f, 0.855677009f},
-std::array<float,2>{0.337251782f, 0.394062966f},
-std::array<float,2>{0.844560564f, 0.291590542f},
-std::array<float,2>{0.00371953449f, 0.958140075f},
-std::array<float,2>{0.71187973f, 0.658983529f},
-std::array<float,2>{0.264605522f, 0.154835716f},
-std::array<float,2>{0.602602243f, 0.0478590503f},
-std::array<float,2>{0.384349972f, 0.52349329f},
-std::array<float,2>{0.950597823f, 0.751477361f},
-std::array<float,2>{0.232068807f, 0.490083218f},
-std::array<float,2>{0.659988046f, 0.418802947f},
-std::array<float,2>{0.344365865f, 0.842074275f},
-std::array<float,2>{0.788884223f, 0.569417059f},
-std::array<float,2>{0.11851494f, 0.0890657231f},
-std::array<float,2>{0.883414328f, 0.212461621f},
-std::array<float,2>{0.160068691f, 0.694343567f},
-std::array<float,2>{0.552500367f, 0.937304139f},
-std::array<float,2>{0.473527551f, 0.361484289f},
-std::array<float,2>{0.91844672f, 0.252409607f},
-std::array<float,2>{0.145520315f, 0.997362196f},
-std::array<float,2>{0.525928497f, 0.631888211f},
-std::array<float,2>{0.463325769f, 0.174894989f},
-std::array<float,2>{0.654040694f, 0.0190688726f},
-std::array<float,2>{0.332918286f, 0.544795036f},
-std::array<float,2>{0.752519011f, 0.805820465f},
-std::array<float,2>{0.0789351314f, 0.441089153f},
-std::array<float,2>{0.581124067f, 0.387700856f},
-std::array<float,2>{0.426619172f, 0.86371094f},
-std::array<float,2>{0.997989953f, 0.599570155f},
-std::array<float,2>{0.190602675f, 0.109319873f},
-std::array<float,2>{0.835889637f, 0.218750313f},
-std::array<float,2>{0.0412218273f, 0.733949423f},
-std::array<float,2>{0.736775577f, 0.888630211f},
-std::array<float,2>{0.300332725f, 0.34068799f},
-std::array<float,2>{0.790827394f, 0.475484192f},
-std::array<float,2>{0.116836488f, 0.780542552f},
-std::array<float,2>{0.664225101f, 0.512798369f},
-std::array<float,2>{0.353948295f, 0.0339731351f},
-std::array<float,2>{0.562102854f, 0.134986624f},
-std::array<float,2>{0.483423203f, 0.677126944f},
-std::array<float,2>{0.876835346f, 0.943414211f},
-std::array<float,2>{0.167221457f, 0.302395821f},
-std::array<float,2>{0.708852232f, 0.359203935f},
-std::array<float,2>{0.255821139f, 0.920369565f},
-std::array<float,2>{0.856693268f, 0.710413039f},
-std::array<float,2>{0.0149388043f, 0.188661069f},
-std::array<float,2>{0.940277517f, 0.0760720819f},
-std::array<float,2>{0.220000938f, 0.578912318f},
-std::array<float,2>{0.597754478f, 0.82012248f},
-std::array<float,2>{0.379171938f, 0.432858646f},
-std::array<float,2>{0.978148997f, 0.417577803f},
-std::array<float,2>{0.214587092f, 0.838757515f},
-std::array<float,2>{0.570155501f, 0.563295543f},
-std::array<float,2>{0.411918432f, 0.0908169225f},
-std::array<float,2>{0.720699966f, 0.216122642f},
-std::array<float,2>{0.284571499f, 0.690542936f},
-std::array<float,2>{0.824880123f, 0.930399656f},
-std::array<float,2>{0.0515764058f, 0.366742104f},
-std::array<float,2>{0.504962981f, 0.294164956f},
-std::array<float,2>{0.450524092f, 0.953960776f},
-std::array<float,2>{0.924768209f, 0.660524547f},
-std::array<float,2>{0.136532441f, 0.150450721f},
-std::array<float,2>{0.773263514f, 0.0511303693f},
-std::array<float,2>{0.0770419389f, 0.530235112f},
-std::array<float,2>{0.628810763f, 0.756798446f},
-std::array<float,2>{0.325965673f, 0.487232417f},
-std::array<float,2>{0.866380334f, 0.321369916f},
-std::array<float,2>{0.016024489f, 0.894780397f},
-std::array<float,2>{0.690817833f, 0.748929322f},
-std::array<float,2>{0.274487942f, 0.243234023f},
-std::array<float,2>{0.624949038f, 0.109697856f},
-std::array<float,2>{0.40529269f, 0.614363492f},
-std::array<float,2>{0.96194762f, 0.855141938f},
-std::array<float,2>{0.235899881f, 0.394563407f},
-std::array<float,2>{0.686306477f, 0.45847261f},
-std::array<float,2>{0.3747091f, 0.788324833f},
-std::array<float,2>{0.799826682f, 0.547029018f},
-std::array<float,2>{0.10250029f, 0.00376991881f},
-std::array<float,2>{0.897500336f, 0.161014974f},
-std::array<float,2>{0.184742376f, 0.640820324f},
-std::array<float,2>{0.534736514f, 0.97815913f},
-std::array<float,2>{0.486879349f, 0.267698318f},
-std::array<float,2>{0.955441833f, 0.373865634f},
-std::array<float,2>{0.245791897f, 0.926266909f},
-std::array<float,2>{0.616532326f, 0.701405346f},
-std::array<float,2>{0.392663777f, 0.208004236f},
-std::array<float,2>{0.695784748f, 0.0800861269f},
-std::array<float,2>{0.266996086f, 0.574607849f},
-std::array<float,2>{0.869249701f, 0.828136027f},
-std::array<float,2>{0.0271749664f, 0.40930292f},
-std::array<float,2>{0.546218812f, 0.499131322f},
-std::array<float,2>{0.499304682f, 0.759030998f},
-std::array<float,2>{0.904851854f, 0.517692685f},
-std::array<float,2>{0.173092186f, 0.0559688322f},
-std::array<float,2>{0.80992645f, 0.143242508f},
-std::array<float,2>{0.0985071138f, 0.666549802f},
-std::array<float,2>{0.672442257f, 0.964201808f},
-std::array<float,2>{0.366094589f, 0.285196066f},
-std::array<float,2>{0.819165051f, 0.405183256f},
-std::array<float,2>{0.059426222f, 0.846535861f},
-std::array<float,2>{0.732562065f, 0.621744335f},
-std::array<float,2>{0.293553203f, 0.124029398f},
-std::array<float,2>{0.575500727f, 0.238255233f},
-std::array<float,2>{0.421620786f, 0.738130569f},
-std::array<float,2>{0.976514935f, 0.899392068f},
-std::array<float,2>{0.2047645f, 0.318943411f},
-std::array<float,2>{0.633017063f, 0.277932882f},
-std::array<float,2>{0.315266311f, 0.97146821f},
-std::array<float,2>{0.774262071f, 0.648866534f},
-std::array<float,2>{0.066520147f, 0.167388663f},
-std::array<float,2>{0.932082951f, 0.00809915178f},
-std::array<float,2>{0.126783773f, 0.558076322f},
-std::array<float,2>{0.508532703f, 0.794157863f},
-std::array<float,2>{0.440063417f, 0.465885371f},
-std::array<float,2>{0.887619317f, 0.452833295f},
-std::array<float,2>{0.160759404f, 0.799226284f},
-std::array<float,2>{0.547485471f, 0.532845736f},
-std::array<float,2>{0.470458061f, 0.0298010129f},
-std::array<float,2>{0.663112462f, 0.184880152f},
-std::array<float,2>{0.34814176f, 0.637470245f},
-std::array<float,2>{0.78324157f, 0.992002666f},
-std::array<float,2>{0.121942937f, 0.265018314f},
-std::array<float,2>{0.607019305f, 0.334152162f},
-std::array<float,2>{0.389877528f, 0.877145946f},
-std::array<float,2>{0.947365403f, 0.722737253f},
-std::array<float,2>{0.229619876f, 0.228098661f},
-std::array<float,2>{0.850087106f, 0.101026073f},
-std::array<float,2>{0.00615084497f, 0.608080089f},
-std::array<float,2>{0.718158603f, 0.873040795f},
-std::array<float,2>{0.261043906f, 0.38144365f},
-std::array<float,2>{0.760217249f, 0.311806172f},
-std::array<float,2>{0.0917361677f, 0.945842683f},
-std::array<float,2>{0.645903885f, 0.68457371f},
-std::array<float,2>{0.340856075f, 0.127018094f},
-std::array<float,2>{0.516268611f, 0.0464882553f},
-std::array<float,2>{0.455812782f, 0.501276612f},
-std::array<float,2>{0.913619161f, 0.768789768f},
-std::array<float,2>{0.152769431f, 0.477122486f},
-std::array<float,2>{0.749333441f, 0.422349185f},
-std::array<float,2>{0.308537751f, 0.824551105f},
-std::array<float,2>{0.838027298f, 0.588583767f},
-std::array<float,2>{0.0333799906f, 0.0627372116f},
-std::array<float,2>{0.987817347f, 0.19986558f},
-std::array<float,2>{0.200234488f, 0.717493534f},
-std::array<float,2>{0.593149841f, 0.911869764f},
-std::array<float,2>{0.42969203f, 0.345783234f},
-std::array<float,2>{0.99271369f, 0.284962356f},
-std::array<float,2>{0.191697985f, 0.96517241f},
-std::array<float,2>{0.584149957f, 0.669265449f},
-std::array<float,2>{0.423911661f, 0.146080196f},
-std::array<float,2>{0.73960048f, 0.0618780442f},
-std::array<float,2>{0.302607298f, 0.522889853f},
-std::array<float,2>{0.830393553f, 0.765399337f},
-std::array<float,2>{0.0445228815f, 0.495978266f},
-std::array<float,2>{0.53080529f, 0.410821587f},
-std::array<float,2>{0.466612577f, 0.835687041f},
-std::array<float,2>{0.916918814f, 0.574014485f},
-std::array<float,2>{0.143974975f, 0.0836834311f},
-std::array<float,2>{0.75597167f, 0.204968125f},
-std::array<float,2>{0.0856055766f, 0.695827067f},
-std::array<float,2>{0.651215017f, 0.922740638f},
-std::array<float,2>{0.331116587f, 0.36766848f},
-std::array<float,2>{0.853527188f, 0.46399051f},
-std::array<float,2>{0.00969583075f, 0.789421797f},
-std::array<float,2>{0.705013156f, 0.562153816f},
-std::array<float,2>{0.251027703f, 0.0123403398f},
-std::array<float,2>{0.597157061f, 0.168341786f},
-std::array<float,2>{0.378661901f, 0.65351969f},
-std::array<float,2>{0.942061543f, 0.972848654f},
-std::array<float,2>{0.225851059f, 0.2773166f},
-std::array<float,2>{0.670467496f, 0.313610196f},
-std::array<float,2>{0.357402325f, 0.905251682f},
-std::array<float,2>{0.793764472f, 0.740553617f},
-std::array<float,2>{0.110580131f, 0.241013095f},
-std::array<float,2>{0.880886972f, 0.117437363f},
-std::array<float,2>{0.171815023f, 0.618536055f},
-std::array<float,2>{0.555845857f, 0.851265013f},
-std::array<float,2>{0.476795137f, 0.401082844f},
-std::array<float,2>{0.929242492f, 0.377107054f},
-std::array<float,2>{0.137132019f, 0.86872673f},
-std::array<float,2>{0.502471983f, 0.604165554f},
-std::array<float,2>{0.448476881f, 0.094731085f},
-std::array<float,2>{0.632009149f, 0.232306793f},
-std::array<float,2>{0.323191106f, 0.721082211f},
-std::array<float,2>{0.769182324f, 0.881311417f},
-std::array<float,2>{0.070353806f, 0.331081212f},
-std::array<float,2>{0.564092636f, 0.261328578f},
-std::array<float,2>{0.406895816f, 0.988247693f},
-std::array<float,2>{0.981201947f, 0.633584321f},
-std::array<float,2>{0.215870112f, 0.180432886f},
-std::array<float,2>{0.820932567f, 0.0270176176f},
-std::array<float,2>{0.0481501929f, 0.536997974f},
-std::array<float,2>{0.725943983f, 0.803122282f},
-std::array<float,2>{0.287042171f, 0.447078288f},
-std::array<float,2>{0.802688003f, 0.348585874f},
-std::array<float,2>{0.106998332f, 0.909022152f},
-std::array<float,2>{0.68080014f, 0.71243453f},
-std::array<float,2>{0.367195487f, 0.198656127f},
-std::array<float,2>{0.536514044f, 0.0680397823f},
-std::array<float,2>{0.488747984f, 0.59349978f},
-std::array<float,2>{0.892416775f, 0.822544813f},
-std::array<float,2>{0.183408529f, 0.428452522f},
-std::array<float,2>{0.691860557f, 0.482817382f},
-std::array<float,2>{0.279993504f, 0.77061975f},
-std::array<float,2>{0.861281931f, 0.507561088f},
-std::array<float,2>{0.0220428966f, 0.0405968204f},
-std::array<float,2>{0.966077566f, 0.130778715f},
-std::array<float,2>{0.239578977f, 0.682703197f},
-std::array<float,2>{0.620845795f, 0.94995898f},
-std::array<float,2>{0.401516497f, 0.307875752f},
-std::array<float,2>{0.899331093f, 0.338624418f},
-std::array<float,2>{0.178535998f, 0.882887602f},
-std::array<float,2>{0.54250592f, 0.729632199f},
-std::array<float,2>{0.492325366f, 0.224994436f},
-std::array<float,2>{0.67588222f, 0.103176512f},
-std::array<float,2>{0.362871885f, 0.595312715f},
-std::array<float,2>{0.806132674f, 0.861512542f},
-std::array<float,2>{0.0941080004f, 0.385389984f},
-std::array<float,2>{0.610991716f, 0.44330433f},
-std::array<float,2>{0.397942305f, 0.808893502f},
-std::array<float,2>{0.958271563f, 0.539905965f},
-std::array<float,2>{0.246981695f, 0.0219835471f},
-std::array<float,2>{0.874032319f, 0.177528962f},
-std::array<float,2>{0.0283503979f, 0.627363145f},
-std::array<float,2>{0.701875269f, 0.995893002f},
-std::array<float,2>{0.270205379f, 0.257706642f},
-std::array<float,2>{0.780310869f, 0.434107751f},
-std::array<float,2>{0.0648807287f, 0.814784229f},
-std::array<float,2>{0.637904823f, 0.58591181f},
-std::array<float,2>{0.317360878f, 0.0738933235f},
-std::array<float,2>{0.513768971f, 0.19228074f},
-std::array<float,2>{0.442332268f, 0.704767883f},
-std::array<float,2>{0.936057627f, 0.917502701f},
-std::array<float,2>{0.13105838f, 0.354175806f},
-std::array<float,2>{0.727963626f, 0.299302638f},
-std::array<float,2>{0.291194201f, 0.939899743f},
-std::array<float,2>{0.813500226f, 0.672285855f},
-std::array<float,2>{0.0556288846f, 0.140390739f},
-std::array<float,2>{0.969692588f, 0.036385648f},
-std::array<float,2>{0.209327847f, 0.511162341f},
-std::array<float,2>{0.570510268f, 0.773498237f},
-std::array<float,2>{0.416894257f, 0.468876749f},
-std::array<float,2>{0.951776147f, 0.491220653f},
-std::array<float,2>{0.233310819f, 0.753119648f},
-std::array<float,2>{0.603739858f, 0.526442826f},
-std::array<float,2>{0.385876536f, 0.0501036607f},
-std::array<float,2>{0.713152885f, 0.154056489f},
-std::array<float,2>{0.263104916f, 0.657482624f},
-std::array<float,2>{0.846099019f, 0.960570812f},
-std::array<float,2>{0.00137203129f, 0.290848136f},
-std::array<float,2>{0.553365052f, 0.360230714f},
-std::array<float,2>{0.47506538f, 0.934559345f},
-std::array<float,2>{0.885466635f, 0.692978799f},
-std::array<float,2>{0.157009214f, 0.213039264f},
-std::array<float,2>{0.785165966f, 0.0868547186f},
-std::array<float,2>{0.119751021f, 0.568144143f},
-std::array<float,2>{0.65640825f, 0.839907348f},
-std::array<float,2>{0.346247286f, 0.420373052f},
-std::array<float,2>{0.840851724f, 0.27012822f},
-std::array<float,2>{0.0371258855f, 0.981274784f},
-std::array<float,2>{0.743582964f, 0.648367882f},
-std::array<float,2>{0.312447935f, 0.158986568f},
-std::array<float,2>{0.589214265f, 0.00405494217f},
-std::array<float,2>{0.436254978f, 0.554071844f},
-std::array<float,2>{0.990120173f, 0.783777893f},
-std::array<float,2>{0.198171675f, 0.454458445f},
-std::array<float,2>{0.641529858f, 0.391522199f},
-std::array<float,2>{0.338764936f, 0.858022153f},
-std::array<float,2>{0.764397085f, 0.609604001f},
-std::array<float,2>{0.0893767029f, 0.116075091f},
-std::array<float,2>{0.908273458f, 0.246548951f},
-std::array<float,2>{0.148961395f, 0.742840052f},
-std::array<float,2>{0.520229518f, 0.89149487f},
-std::array<float,2>{0.460132927f, 0.325324059f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.142425165f, 0.400517613f},
-std::array<float,2>{0.712383866f, 0.930963099f},
-std::array<float,2>{0.275106549f, 0.738090396f},
-std::array<float,2>{0.853161991f, 0.0916727185f},
-std::array<float,2>{0.455711395f, 0.201388597f},
-std::array<float,2>{0.966103077f, 0.514084935f},
-std::array<float,2>{0.0530528165f, 0.779649317f},
-std::array<float,2>{0.501430929f, 0.335258245f},
-std::array<float,2>{0.117217131f, 0.0219182875f},
-std::array<float,2>{0.611301422f, 0.678603828f},
-std::array<float,2>{0.428827316f, 0.953943372f},
-std::array<float,2>{0.881074369f, 0.497925937f},
-std::array<float,2>{0.335434645f, 0.309210747f},
-std::array<float,2>{0.802195132f, 0.859575331f},
-std::array<float,2>{0.206153676f, 0.581011653f},
-std::array<float,2>{0.625257194f, 0.131284386f},
-std::array<float,2>{0.0105761318f, 0.367265522f},
-std::array<float,2>{0.559324443f, 0.788004637f},
-std::array<float,2>{0.478040516f, 0.555302501f},
-std::array<float,2>{0.990973234f, 0.237823531f},
-std::array<float,2>{0.295823097f, 0.0987367034f},
-std::array<float,2>{0.829508841f, 0.702806175f},
-std::array<float,2>{0.180666551f, 0.87962091f},
-std::array<float,2>{0.729854167f, 0.434262455f},
-std::array<float,2>{0.249291241f, 0.185403824f},
-std::array<float,2>{0.663768828f, 0.623696923f},
-std::array<float,2>{0.347159535f, 0.815817595f},
-std::array<float,2>{0.753271043f, 0.260459393f},
-std::array<float,2>{0.387260884f, 0.463280797f},
-std::array<float,2>{0.923618913f, 0.986057341f},
-std::array<float,2>{0.0878558606f, 0.638205051f},
-std::array<float,2>{0.580576301f, 0.0584610179f},
-std::array<float,2>{0.0723091215f, 0.474533647f},
-std::array<float,2>{0.564218163f, 0.939283907f},
-std::array<float,2>{0.405530572f, 0.663232446f},
-std::array<float,2>{0.921305954f, 0.0118959267f},
-std::array<float,2>{0.373406231f, 0.151650906f},
-std::array<float,2>{0.775333643f, 0.573230028f},
-std::array<float,2>{0.234079212f, 0.857503057f},
-std::array<float,2>{0.674762726f, 0.284653276f},
-std::array<float,2>{0.171619907f, 0.074657999f},
-std::array<float,2>{0.736613631f, 0.72250396f},
-std::array<float,2>{0.30674836f, 0.916896045f},
-std::array<float,2>{0.826372564f, 0.379874885f},
-std::array<float,2>{0.499971002f, 0.314130396f},
-std::array<float,2>{0.973926842f, 0.750400424f},
-std::array<float,2>{0.0231369995f, 0.518683374f},
-std::array<float,2>{0.541048586f, 0.205078885f},
-std::array<float,2>{0.195563927f, 0.272976637f},
-std::array<float,2>{0.643920064f, 0.840898991f},
-std::array<float,2>{0.322990268f, 0.594480991f},
-std::array<float,2>{0.790699124f, 0.16043289f},
-std::array<float,2>{0.41530481f, 0.0334632732f},
-std::array<float,2>{0.905151784f, 0.656184614f},
-std::array<float,2>{0.101469122f, 0.970588624f},
-std::array<float,2>{0.597994983f, 0.444360912f},
-std::array<float,2>{0.0407469757f, 0.231528237f},
-std::array<float,2>{0.518170238f, 0.542842686f},
-std::array<float,2>{0.440244406f, 0.803984225f},
-std::array<float,2>{0.947855651f, 0.35467276f},
-std::array<float,2>{0.257931232f, 0.418215036f},
-std::array<float,2>{0.865224123f, 0.899983943f},
-std::array<float,2>{0.125970542f, 0.710046172f},
-std::array<float,2>{0.699395359f, 0.1208198f},
-std::array<float,2>{0.224299446f, 0.452851743f},
-std::array<float,2>{0.682954907f, 0.977622747f},
-std::array<float,2>{0.366343945f, 0.647700369f},
-std::array<float,2>{0.772535861f, 0.0396852903f},
-std::array<float,2>{0.397180855f, 0.166189551f},
-std::array<float,2>{0.911432445f, 0.604901969f},
-std::array<float,2>{0.0658291206f, 0.833677232f},
-std::array<float,2>{0.571367383f, 0.276183218f},
-std::array<float,2>{0.0302969422f, 0.116238743f},
-std::array<float,2>{0.535748959f, 0.716614664f},
-std::array<float,2>{0.487217605f, 0.891770422f},
-std::array<float,2>{0.979755104f, 0.408682823f},
-std::array<float,2>{0.300670445f, 0.348275393f},
-std::array<float,2>{0.818742216f, 0.812356591f},
-std::array<float,2>{0.15727666f, 0.535612285f},
-std::array<float,2>{0.74444133f, 0.220789239f},
-std::array<float,2>{0.109055653f, 0.289847642f},
-std::array<float,2>{0.602470636f, 0.844481647f},
-std::array<float,2>{0.411913931f, 0.56912148f},
-std::array<float,2>{0.890814662f, 0.148124769f},
-std::array<float,2>{0.316133648f, 0.00587506033f},
-std::array<float,2>{0.78677839f, 0.665495634f},
-std::array<float,2>{0.187965125f, 0.945748389f},
-std::array<float,2>{0.649798095f, 0.477896571f},
-std::array<float,2>{0.14013432f, 0.21252887f},
-std::array<float,2>{0.693712354f, 0.526795328f},
-std::array<float,2>{0.255943686f, 0.758398294f},
-std::array<float,2>{0.868890464f, 0.326116413f},
-std::array<float,2>{0.448889762f, 0.386229038f},
-std::array<float,2>{0.938525319f, 0.9102723f},
-std::array<float,2>{0.0362822376f, 0.73268646f},
-std::array<float,2>{0.524679899f, 0.0668883696f},
-std::array<float,2>{0.0586465448f, 0.422640264f},
-std::array<float,2>{0.510611653f, 0.887428224f},
-std::array<float,2>{0.465378433f, 0.691952765f},
-std::array<float,2>{0.960445523f, 0.104285344f},
-std::array<float,2>{0.2666682f, 0.249400467f},
-std::array<float,2>{0.845052481f, 0.550623953f},
-std::array<float,2>{0.152522966f, 0.79670763f},
-std::array<float,2>{0.704481781f, 0.365973383f},
-std::array<float,2>{0.214849174f, 0.0534798577f},
-std::array<float,2>{0.637402654f, 0.631882429f},
-std::array<float,2>{0.341491997f, 0.994506359f},
-std::array<float,2>{0.807338715f, 0.459256679f},
-std::array<float,2>{0.430884212f, 0.253959566f},
-std::array<float,2>{0.887589574f, 0.826746881f},
-std::array<float,2>{0.112056695f, 0.614803612f},
-std::array<float,2>{0.623418272f, 0.179520965f},
-std::array<float,2>{0.177469239f, 0.339268416f},
-std::array<float,2>{0.726086557f, 0.766517937f},
-std::array<float,2>{0.284511954f, 0.503666401f},
-std::array<float,2>{0.836286902f, 0.191224962f},
-std::array<float,2>{0.472224563f, 0.0794161931f},
-std::array<float,2>{0.993865848f, 0.749556243f},
-std::array<float,2>{0.00186813844f, 0.925872862f},
-std::array<float,2>{0.55455941f, 0.396205038f},
-std::array<float,2>{0.0790524036f, 0.135978296f},
-std::array<float,2>{0.588770628f, 0.588406622f},
-std::array<float,2>{0.379407436f, 0.869089723f},
-std::array<float,2>{0.932940185f, 0.302583963f},
-std::array<float,2>{0.353787392f, 0.485876471f},
-std::array<float,2>{0.757927775f, 0.964598119f},
-std::array<float,2>{0.235694006f, 0.682712018f},
-std::array<float,2>{0.664391339f, 0.0259658676f},
-std::array<float,2>{0.160311788f, 0.495024025f},
-std::array<float,2>{0.746238947f, 0.958305061f},
-std::array<float,2>{0.301968366f, 0.672550142f},
-std::array<float,2>{0.816122949f, 0.0161632318f},
-std::array<float,2>{0.488304615f, 0.128258377f},
-std::array<float,2>{0.984338522f, 0.585651755f},
-std::array<float,2>{0.0249150097f, 0.863933146f},
-std::array<float,2>{0.534053564f, 0.305434734f},
-std::array<float,2>{0.0682695955f, 0.0897337496f},
-std::array<float,2>{0.575464189f, 0.741374135f},
-std::array<float,2>{0.391601861f, 0.936696589f},
-std::array<float,2>{0.909861207f, 0.404554605f},
-std::array<float,2>{0.359794408f, 0.331432551f},
-std::array<float,2>{0.768275261f, 0.776767433f},
-std::array<float,2>{0.219422251f, 0.50785464f},
-std::array<float,2>{0.687263012f, 0.196296126f},
-std::array<float,2>{0.033703953f, 0.262574881f},
-std::array<float,2>{0.527606726f, 0.818402588f},
-std::array<float,2>{0.449870616f, 0.619552076f},
-std::array<float,2>{0.942825854f, 0.181765407f},
-std::array<float,2>{0.253477871f, 0.0602447465f},
-std::array<float,2>{0.871578813f, 0.63537997f},
-std::array<float,2>{0.135753006f, 0.988287508f},
-std::array<float,2>{0.689685762f, 0.4665232f},
-std::array<float,2>{0.193329692f, 0.240099728f},
-std::array<float,2>{0.653018057f, 0.561395586f},
-std::array<float,2>{0.318300605f, 0.783973575f},
-std::array<float,2>{0.783854902f, 0.373424232f},
-std::array<float,2>{0.407395005f, 0.431949437f},
-std::array<float,2>{0.896625698f, 0.87505424f},
-std::array<float,2>{0.101776458f, 0.699083745f},
-std::array<float,2>{0.607603252f, 0.0943152979f},
-std::array<float,2>{0.114014156f, 0.376703173f},
-std::array<float,2>{0.619421482f, 0.920810521f},
-std::array<float,2>{0.434085548f, 0.724375844f},
-std::array<float,2>{0.88401705f, 0.0735329092f},
-std::array<float,2>{0.339370042f, 0.207079813f},
-std::array<float,2>{0.808855414f, 0.52307421f},
-std::array<float,2>{0.213226616f, 0.75465405f},
-std::array<float,2>{0.635872006f, 0.319262296f},
-std::array<float,2>{0.148900971f, 0.0106061446f},
-std::array<float,2>{0.708742261f, 0.660073936f},
-std::array<float,2>{0.272101521f, 0.941779315f},
-std::array<float,2>{0.848723948f, 0.470365942f},
-std::array<float,2>{0.463564843f, 0.285588264f},
-std::array<float,2>{0.954750657f, 0.852732301f},
-std::array<float,2>{0.0573098436f, 0.577618539f},
-std::array<float,2>{0.51261586f, 0.155809999f},
-std::array<float,2>{0.2417766f, 0.357829601f},
-std::array<float,2>{0.66976881f, 0.800559521f},
-std::array<float,2>{0.355930895f, 0.546114266f},
-std::array<float,2>{0.765592456f, 0.228424668f},
-std::array<float,2>{0.375759393f, 0.122725748f},
-std::array<float,2>{0.935753345f, 0.706648767f},
-std::array<float,2>{0.0823761895f, 0.906179309f},
-std::array<float,2>{0.592544794f, 0.414602697f},
-std::array<float,2>{0.0050985124f, 0.156989932f},
-std::array<float,2>{0.548526764f, 0.598678708f},
-std::array<float,2>{0.476318121f, 0.837226212f},
-std::array<float,2>{0.996428728f, 0.26716429f},
-std::array<float,2>{0.285923481f, 0.439415723f},
-std::array<float,2>{0.840352654f, 0.975724816f},
-std::array<float,2>{0.175770134f, 0.651160419f},
-std::array<float,2>{0.722062051f, 0.0360293053f},
-std::array<float,2>{0.210856289f, 0.412644804f},
-std::array<float,2>{0.629539967f, 0.895246923f},
-std::array<float,2>{0.331193596f, 0.714537799f},
-std::array<float,2>{0.800568521f, 0.10952241f},
-std::array<float,2>{0.422729462f, 0.22424069f},
-std::array<float,2>{0.878264487f, 0.534125268f},
-std::array<float,2>{0.123334929f, 0.806671619f},
-std::array<float,2>{0.613321722f, 0.345887244f},
-std::array<float,2>{0.0497298427f, 0.0464276895f},
-std::array<float,2>{0.507570744f, 0.644385755f},
-std::array<float,2>{0.457310855f, 0.983599961f},
-std::array<float,2>{0.962746561f, 0.448919713f},
-std::array<float,2>{0.278494f, 0.277935892f},
-std::array<float,2>{0.859270155f, 0.831541479f},
-std::array<float,2>{0.148312509f, 0.605921507f},
-std::array<float,2>{0.71757555f, 0.171446681f},
-std::array<float,2>{0.0899064988f, 0.321065575f},
-std::array<float,2>{0.582608283f, 0.761945248f},
-std::array<float,2>{0.386646122f, 0.529839218f},
-std::array<float,2>{0.927920401f, 0.217889324f},
-std::array<float,2>{0.347828418f, 0.0656880364f},
-std::array<float,2>{0.754639208f, 0.727650583f},
-std::array<float,2>{0.245798647f, 0.90678215f},
-std::array<float,2>{0.658580959f, 0.388800591f},
-std::array<float,2>{0.185107365f, 0.143680856f},
-std::array<float,2>{0.730769634f, 0.563280821f},
-std::array<float,2>{0.290039986f, 0.850841105f},
-std::array<float,2>{0.834017158f, 0.295855463f},
-std::array<float,2>{0.481449485f, 0.481339425f},
-std::array<float,2>{0.98461777f, 0.951949894f},
-std::array<float,2>{0.0156097487f, 0.670544028f},
-std::array<float,2>{0.557899594f, 0.00131961552f},
-std::array<float,2>{0.0178490784f, 0.453743398f},
-std::array<float,2>{0.543851256f, 0.998811781f},
-std::array<float,2>{0.493142337f, 0.626975179f},
-std::array<float,2>{0.969355106f, 0.0495156124f},
-std::array<float,2>{0.309947222f, 0.173521593f},
-std::array<float,2>{0.820875168f, 0.611996174f},
-std::array<float,2>{0.164164558f, 0.820586503f},
-std::array<float,2>{0.73843199f, 0.25223583f},
-std::array<float,2>{0.230148628f, 0.10744749f},
-std::array<float,2>{0.675885916f, 0.688851893f},
-std::array<float,2>{0.369934857f, 0.885028422f},
-std::array<float,2>{0.778023541f, 0.428642005f},
-std::array<float,2>{0.400095284f, 0.360553414f},
-std::array<float,2>{0.916217268f, 0.791458964f},
-std::array<float,2>{0.0752126798f, 0.552586615f},
-std::array<float,2>{0.569820762f, 0.244201928f},
-std::array<float,2>{0.129211381f, 0.297675073f},
-std::array<float,2>{0.697226226f, 0.871859491f},
-std::array<float,2>{0.261948794f, 0.590512753f},
-std::array<float,2>{0.862596989f, 0.13809675f},
-std::array<float,2>{0.441958398f, 0.0304602142f},
-std::array<float,2>{0.949259937f, 0.685932159f},
-std::array<float,2>{0.045300439f, 0.968518198f},
-std::array<float,2>{0.5205006f, 0.490323484f},
-std::array<float,2>{0.0972434729f, 0.192723349f},
-std::array<float,2>{0.594236195f, 0.505493999f},
-std::array<float,2>{0.418306947f, 0.770973623f},
-std::array<float,2>{0.899142027f, 0.342614114f},
-std::array<float,2>{0.325422525f, 0.394464821f},
-std::array<float,2>{0.795645118f, 0.922693491f},
-std::array<float,2>{0.20091559f, 0.743391693f},
-std::array<float,2>{0.648071647f, 0.0823720545f},
-std::array<float,2>{0.181903392f, 0.436022043f},
-std::array<float,2>{0.727648318f, 0.881022394f},
-std::array<float,2>{0.293043107f, 0.699385583f},
-std::array<float,2>{0.830618203f, 0.100964621f},
-std::array<float,2>{0.478830874f, 0.235400423f},
-std::array<float,2>{0.989161193f, 0.558519125f},
-std::array<float,2>{0.00926083792f, 0.787006378f},
-std::array<float,2>{0.561931789f, 0.370444149f},
-std::array<float,2>{0.0895955563f, 0.0565372333f},
-std::array<float,2>{0.57872957f, 0.640267134f},
-std::array<float,2>{0.390374124f, 0.986372769f},
-std::array<float,2>{0.9244048f, 0.46192205f},
-std::array<float,2>{0.343935013f, 0.258984894f},
-std::array<float,2>{0.750270844f, 0.813189924f},
-std::array<float,2>{0.24676995f, 0.622947931f},
-std::array<float,2>{0.66194272f, 0.187151551f},
-std::array<float,2>{0.050800506f, 0.333689123f},
-std::array<float,2>{0.502188981f, 0.778738141f},
-std::array<float,2>{0.453842312f, 0.512175918f},
-std::array<float,2>{0.96764046f, 0.200852171f},
-std::array<float,2>{0.276961029f, 0.0929859504f},
-std::array<float,2>{0.853808582f, 0.735822856f},
-std::array<float,2>{0.142679363f, 0.932793796f},
-std::array<float,2>{0.713953793f, 0.398683101f},
-std::array<float,2>{0.204435587f, 0.128948271f},
-std::array<float,2>{0.627201915f, 0.578938603f},
-std::array<float,2>{0.332580984f, 0.862049818f},
-std::array<float,2>{0.802758515f, 0.311436027f},
-std::array<float,2>{0.427509099f, 0.498819083f},
-std::array<float,2>{0.879651427f, 0.956405103f},
-std::array<float,2>{0.119891524f, 0.676256001f},
-std::array<float,2>{0.613194108f, 0.0205380172f},
-std::array<float,2>{0.0995476171f, 0.442284971f},
-std::array<float,2>{0.600375712f, 0.970769763f},
-std::array<float,2>{0.417759478f, 0.654056311f},
-std::array<float,2>{0.902649164f, 0.0320631973f},
-std::array<float,2>{0.321746022f, 0.16218932f},
-std::array<float,2>{0.792859495f, 0.597489953f},
-std::array<float,2>{0.197838381f, 0.84345597f},
-std::array<float,2>{0.642383635f, 0.270676047f},
-std::array<float,2>{0.12793088f, 0.118670821f},
-std::array<float,2>{0.70182699f, 0.708019674f},
-std::array<float,2>{0.261354297f, 0.901750803f},
-std::array<float,2>{0.866676211f, 0.421315581f},
-std::array<float,2>{0.437789112f, 0.352718174f},
-std::array<float,2>{0.946069717f, 0.801335871f},
-std::array<float,2>{0.0418792963f, 0.53978771f},
-std::array<float,2>{0.515981078f, 0.234071076f},
-std::array<float,2>{0.230875835f, 0.28190735f},
-std::array<float,2>{0.671932757f, 0.856655598f},
-std::array<float,2>{0.371492267f, 0.572003126f},
-std::array<float,2>{0.777108192f, 0.149787858f},
-std::array<float,2>{0.402477831f, 0.0144263394f},
-std::array<float,2>{0.919009924f, 0.660287678f},
-std::array<float,2>{0.0706529766f, 0.941304803f},
-std::array<float,2>{0.565985441f, 0.476400077f},
-std::array<float,2>{0.0195939187f, 0.204154149f},
-std::array<float,2>{0.540898323f, 0.5156582f},
-std::array<float,2>{0.496947229f, 0.753891349f},
-std::array<float,2>{0.976175487f, 0.314902335f},
-std::array<float,2>{0.30654034f, 0.38260296f},
-std::array<float,2>{0.826029181f, 0.915610135f},
-std::array<float,2>{0.168984711f, 0.719593883f},
-std::array<float,2>{0.735353649f, 0.0773665458f},
-std::array<float,2>{0.190631986f, 0.479071498f},
-std::array<float,2>{0.65120548f, 0.948962033f},
-std::array<float,2>{0.313548416f, 0.666337967f},
-std::array<float,2>{0.787786603f, 0.00461812457f},
-std::array<float,2>{0.412560433f, 0.145934656f},
-std::array<float,2>{0.893076837f, 0.567684412f},
-std::array<float,2>{0.107048757f, 0.845852852f},
-std::array<float,2>{0.605356157f, 0.292790085f},
-std::array<float,2>{0.0385600328f, 0.0700932592f},
-std::array<float,2>{0.525913596f, 0.731976986f},
-std::array<float,2>{0.446524084f, 0.91320318f},
-std::array<float,2>{0.939842463f, 0.383084863f},
-std::array<float,2>{0.255766809f, 0.32751891f},
-std::array<float,2>{0.871059895f, 0.760902464f},
-std::array<float,2>{0.136853248f, 0.523950756f},
-std::array<float,2>{0.692970097f, 0.214609891f},
-std::array<float,2>{0.0625431463f, 0.274293453f},
-std::array<float,2>{0.572543561f, 0.835909307f},
-std::array<float,2>{0.396294177f, 0.603165507f},
-std::array<float,2>{0.91254425f, 0.165511206f},
-std::array<float,2>{0.364539862f, 0.0413857214f},
-std::array<float,2>{0.770496428f, 0.645319045f},
-std::array<float,2>{0.226079762f, 0.979375184f},
-std::array<float,2>{0.680800915f, 0.449266344f},
-std::array<float,2>{0.159498677f, 0.220367521f},
-std::array<float,2>{0.74253881f, 0.537468374f},
-std::array<float,2>{0.298045158f, 0.809465826f},
-std::array<float,2>{0.817688227f, 0.349979341f},
-std::array<float,2>{0.484389335f, 0.40729934f},
-std::array<float,2>{0.977170229f, 0.893627286f},
-std::array<float,2>{0.0282781571f, 0.717547596f},
-std::array<float,2>{0.538849115f, 0.11473155f},
-std::array<float,2>{0.00387359783f, 0.397553623f},
-std::array<float,2>{0.552461207f, 0.927808583f},
-std::array<float,2>{0.468933523f, 0.746954024f},
-std::array<float,2>{0.994843543f, 0.0812597424f},
-std::array<float,2>{0.281372547f, 0.18801643f},
-std::array<float,2>{0.839729309f, 0.500974357f},
-std::array<float,2>{0.177867711f, 0.768585026f},
-std::array<float,2>{0.723380148f, 0.33622992f},
-std::array<float,2>{0.236594453f, 0.0237049013f},
-std::array<float,2>{0.66728586f, 0.680173039f},
-std::array<float,2>{0.351873666f, 0.962250471f},
-std::array<float,2>{0.761145949f, 0.487352878f},
-std::array<float,2>{0.381447196f, 0.303581268f},
-std::array<float,2>{0.930676699f, 0.870447636f},
-std::array<float,2>{0.0808905587f, 0.587861061f},
-std::array<float,2>{0.58726573f, 0.133808941f},
-std::array<float,2>{0.154644936f, 0.363392413f},
-std::array<float,2>{0.706955194f, 0.793207943f},
-std::array<float,2>{0.269032657f, 0.547943771f},
-std::array<float,2>{0.846216559f, 0.246320814f},
-std::array<float,2>{0.46706298f, 0.101950958f},
-std::array<float,2>{0.958440602f, 0.694852829f},
-std::array<float,2>{0.0614846572f, 0.889668465f},
-std::array<float,2>{0.509566963f, 0.425060958f},
-std::array<float,2>{0.110725172f, 0.176781416f},
-std::array<float,2>{0.622495055f, 0.616902947f},
-std::array<float,2>{0.432402492f, 0.824637353f},
-std::array<float,2>{0.890153289f, 0.257072777f},
-std::array<float,2>{0.341954887f, 0.457960278f},
-std::array<float,2>{0.805284739f, 0.994126379f},
-std::array<float,2>{0.217277333f, 0.629417121f},
-std::array<float,2>{0.639306307f, 0.0515534841f},
-std::array<float,2>{0.133764252f, 0.467473805f},
-std::array<float,2>{0.688436031f, 0.991208792f},
-std::array<float,2>{0.251174867f, 0.633832753f},
-std::array<float,2>{0.87350136f, 0.060885299f},
-std::array<float,2>{0.451945782f, 0.18084839f},
-std::array<float,2>{0.944316387f, 0.617989838f},
-std::array<float,2>{0.0314724073f, 0.817284107f},
-std::array<float,2>{0.531224132f, 0.264658689f},
-std::array<float,2>{0.104661457f, 0.0973422676f},
-std::array<float,2>{0.606329441f, 0.69654119f},
-std::array<float,2>{0.409296632f, 0.877377093f},
-std::array<float,2>{0.895631075f, 0.429883361f},
-std::array<float,2>{0.318362057f, 0.3725034f},
-std::array<float,2>{0.781300187f, 0.781992674f},
-std::array<float,2>{0.194242999f, 0.559111536f},
-std::array<float,2>{0.654644489f, 0.24112615f},
-std::array<float,2>{0.0264401548f, 0.307952493f},
-std::array<float,2>{0.532339394f, 0.867055714f},
-std::array<float,2>{0.490447134f, 0.582880199f},
-std::array<float,2>{0.981009722f, 0.125630662f},
-std::array<float,2>{0.304641694f, 0.0178755336f},
-std::array<float,2>{0.813183069f, 0.675710618f},
-std::array<float,2>{0.16214329f, 0.959157407f},
-std::array<float,2>{0.74874419f, 0.49289602f},
-std::array<float,2>{0.220761001f, 0.197878659f},
-std::array<float,2>{0.685373783f, 0.510078311f},
-std::array<float,2>{0.362027556f, 0.773646355f},
-std::array<float,2>{0.767226219f, 0.329532534f},
-std::array<float,2>{0.394067258f, 0.403810054f},
-std::array<float,2>{0.90690285f, 0.933738589f},
-std::array<float,2>{0.0697509199f, 0.739144087f},
-std::array<float,2>{0.577959478f, 0.0875000507f},
-std::array<float,2>{0.0844832659f, 0.417291313f},
-std::array<float,2>{0.590174735f, 0.903201699f},
-std::array<float,2>{0.37872988f, 0.704869926f},
-std::array<float,2>{0.934732735f, 0.123782732f},
-std::array<float,2>{0.358100027f, 0.229460597f},
-std::array<float,2>{0.762556553f, 0.542976677f},
-std::array<float,2>{0.239645734f, 0.797655344f},
-std::array<float,2>{0.670750201f, 0.35611859f},
-std::array<float,2>{0.172650933f, 0.0385369696f},
-std::array<float,2>{0.719621778f, 0.648755431f},
-std::array<float,2>{0.287326485f, 0.973559797f},
-std::array<float,2>{0.84193188f, 0.440538496f},
-std::array<float,2>{0.473372281f, 0.26950559f},
-std::array<float,2>{0.999543071f, 0.839240193f},
-std::array<float,2>{0.00729612075f, 0.600030601f},
-std::array<float,2>{0.549637139f, 0.158454746f},
-std::array<float,2>{0.212195173f, 0.316424817f},
-std::array<float,2>{0.633124173f, 0.75731498f},
-std::array<float,2>{0.337680787f, 0.520668268f},
-std::array<float,2>{0.812153399f, 0.209992617f},
-std::array<float,2>{0.436259419f, 0.0704531074f},
-std::array<float,2>{0.884920299f, 0.724680841f},
-std::array<float,2>{0.115888581f, 0.919880271f},
-std::array<float,2>{0.618343592f, 0.377329051f},
-std::array<float,2>{0.055506289f, 0.152499408f},
-std::array<float,2>{0.513799071f, 0.574637651f},
-std::array<float,2>{0.460995644f, 0.85486424f},
-std::array<float,2>{0.955147803f, 0.288824469f},
-std::array<float,2>{0.271168262f, 0.471443564f},
-std::array<float,2>{0.850062549f, 0.944818497f},
-std::array<float,2>{0.15127039f, 0.657817841f},
-std::array<float,2>{0.709733248f, 0.00935369823f},
-std::array<float,2>{0.24319768f, 0.38816461f},
-std::array<float,2>{0.658142865f, 0.908988774f},
-std::array<float,2>{0.34996739f, 0.728639007f},
-std::array<float,2>{0.756581724f, 0.0632162988f},
-std::array<float,2>{0.384321123f, 0.216792271f},
-std::array<float,2>{0.926900089f, 0.528590858f},
-std::array<float,2>{0.0927726701f, 0.764505625f},
-std::array<float,2>{0.585195184f, 0.322546512f},
-std::array<float,2>{0.0125821512f, 0.00207415479f},
-std::array<float,2>{0.55523181f, 0.669651151f},
-std::array<float,2>{0.482425869f, 0.950339019f},
-std::array<float,2>{0.986403406f, 0.483127058f},
-std::array<float,2>{0.291372657f, 0.294554681f},
-std::array<float,2>{0.832196772f, 0.848720431f},
-std::array<float,2>{0.187361673f, 0.564673901f},
-std::array<float,2>{0.734359443f, 0.141565681f},
-std::array<float,2>{0.122333996f, 0.344612926f},
-std::array<float,2>{0.615989029f, 0.806477726f},
-std::array<float,2>{0.42423293f, 0.531313002f},
-std::array<float,2>{0.876547575f, 0.225581408f},
-std::array<float,2>{0.329289675f, 0.113030463f},
-std::array<float,2>{0.798385978f, 0.712062538f},
-std::array<float,2>{0.207557127f, 0.897570968f},
-std::array<float,2>{0.631143272f, 0.411589503f},
-std::array<float,2>{0.145667061f, 0.169064552f},
-std::array<float,2>{0.71549207f, 0.607472539f},
-std::array<float,2>{0.280316591f, 0.828942835f},
-std::array<float,2>{0.857297838f, 0.281224042f},
-std::array<float,2>{0.460656375f, 0.446019232f},
-std::array<float,2>{0.963428795f, 0.981561661f},
-std::array<float,2>{0.0485696495f, 0.640962243f},
-std::array<float,2>{0.504324675f, 0.0433516279f},
-std::array<float,2>{0.0432929322f, 0.488533407f},
-std::array<float,2>{0.52163434f, 0.966262996f},
-std::array<float,2>{0.44494763f, 0.684472024f},
-std::array<float,2>{0.95278734f, 0.0285182856f},
-std::array<float,2>{0.264948308f, 0.139891014f},
-std::array<float,2>{0.859571695f, 0.592730939f},
-std::array<float,2>{0.132292822f, 0.873142302f},
-std::array<float,2>{0.69829452f, 0.299941868f},
-std::array<float,2>{0.201629087f, 0.0840396732f},
-std::array<float,2>{0.644598186f, 0.745219707f},
-std::array<float,2>{0.327503592f, 0.923875391f},
-std::array<float,2>{0.793710709f, 0.392569751f},
-std::array<float,2>{0.420924842f, 0.340914428f},
-std::array<float,2>{0.901193321f, 0.772980452f},
-std::array<float,2>{0.0946496129f, 0.506022155f},
-std::array<float,2>{0.59639883f, 0.195014611f},
-std::array<float,2>{0.166998655f, 0.250427991f},
-std::array<float,2>{0.740410388f, 0.823897541f},
-std::array<float,2>{0.312025011f, 0.610940933f},
-std::array<float,2>{0.823067784f, 0.174535632f},
-std::array<float,2>{0.49429366f, 0.0481932014f},
-std::array<float,2>{0.971416533f, 0.626892745f},
-std::array<float,2>{0.0159367379f, 0.996289253f},
-std::array<float,2>{0.545715034f, 0.456096083f},
-std::array<float,2>{0.0774840713f, 0.242968008f},
-std::array<float,2>{0.567531228f, 0.553774953f},
-std::array<float,2>{0.401988119f, 0.789586306f},
-std::array<float,2>{0.914065838f, 0.362792999f},
-std::array<float,2>{0.367442816f, 0.42655316f},
-std::array<float,2>{0.781036556f, 0.884167135f},
-std::array<float,2>{0.226821527f, 0.690450072f},
-std::array<float,2>{0.679371178f, 0.105850086f},
-std::array<float,2>{0.126243666f, 0.420048207f},
-std::array<float,2>{0.700349629f, 0.900769889f},
-std::array<float,2>{0.258930475f, 0.707303405f},
-std::array<float,2>{0.863314033f, 0.118140779f},
-std::array<float,2>{0.440443844f, 0.233369216f},
-std::array<float,2>{0.948689342f, 0.540164173f},
-std::array<float,2>{0.0395562053f, 0.80212611f},
-std::array<float,2>{0.519117117f, 0.352251679f},
-std::array<float,2>{0.0999285281f, 0.0326778553f},
-std::array<float,2>{0.599328518f, 0.653288484f},
-std::array<float,2>{0.414206356f, 0.971797168f},
-std::array<float,2>{0.905651331f, 0.442827463f},
-std::array<float,2>{0.323811114f, 0.270382702f},
-std::array<float,2>{0.789213896f, 0.842695594f},
-std::array<float,2>{0.196646288f, 0.595897675f},
-std::array<float,2>{0.643130958f, 0.16321151f},
-std::array<float,2>{0.0223903861f, 0.315803826f},
-std::array<float,2>{0.542220116f, 0.751966596f},
-std::array<float,2>{0.498799801f, 0.516957283f},
-std::array<float,2>{0.972874582f, 0.20397222f},
-std::array<float,2>{0.307718545f, 0.0770824254f},
-std::array<float,2>{0.827807546f, 0.719868481f},
-std::array<float,2>{0.170676649f, 0.91496712f},
-std::array<float,2>{0.737414479f, 0.381467164f},
-std::array<float,2>{0.233100459f, 0.149218306f},
-std::array<float,2>{0.675592959f, 0.570688307f},
-std::array<float,2>{0.374947578f, 0.856137574f},
-std::array<float,2>{0.774370432f, 0.283041596f},
-std::array<float,2>{0.404862463f, 0.474945337f},
-std::array<float,2>{0.920361698f, 0.940373421f},
-std::array<float,2>{0.0734489337f, 0.661984324f},
-std::array<float,2>{0.562727273f, 0.0150194978f},
-std::array<float,2>{0.0863163471f, 0.461118788f},
-std::array<float,2>{0.581559241f, 0.988147736f},
-std::array<float,2>{0.388344914f, 0.639518738f},
-std::array<float,2>{0.922719419f, 0.0553536937f},
-std::array<float,2>{0.346615553f, 0.1858854f},
-std::array<float,2>{0.752028525f, 0.621356368f},
-std::array<float,2>{0.248585939f, 0.813752353f},
-std::array<float,2>{0.662497997f, 0.258619785f},
-std::array<float,2>{0.179797083f, 0.100083597f},
-std::array<float,2>{0.729260147f, 0.700929999f},
-std::array<float,2>{0.296049416f, 0.88244313f},
-std::array<float,2>{0.829026461f, 0.436875582f},
-std::array<float,2>{0.477477729f, 0.369465172f},
-std::array<float,2>{0.991661489f, 0.785857499f},
-std::array<float,2>{0.0112584606f, 0.556873322f},
-std::array<float,2>{0.560040891f, 0.234654084f},
-std::array<float,2>{0.206053853f, 0.31159088f},
-std::array<float,2>{0.626922727f, 0.862845004f},
-std::array<float,2>{0.333990365f, 0.579901457f},
-std::array<float,2>{0.801140428f, 0.130221486f},
-std::array<float,2>{0.427764148f, 0.0200393852f},
-std::array<float,2>{0.881872118f, 0.677072823f},
-std::array<float,2>{0.119111985f, 0.955832064f},
-std::array<float,2>{0.61009115f, 0.499552399f},
-std::array<float,2>{0.0537736043f, 0.199265778f},
-std::array<float,2>{0.500235736f, 0.513151586f},
-std::array<float,2>{0.456631839f, 0.777850032f},
-std::array<float,2>{0.965435088f, 0.332881421f},
-std::array<float,2>{0.274403095f, 0.400296897f},
-std::array<float,2>{0.851644516f, 0.931821048f},
-std::array<float,2>{0.140745789f, 0.734440982f},
-std::array<float,2>{0.711394846f, 0.0922270268f},
-std::array<float,2>{0.23517935f, 0.486958683f},
-std::array<float,2>{0.665709257f, 0.961203039f},
-std::array<float,2>{0.355255812f, 0.680912673f},
-std::array<float,2>{0.758860528f, 0.0245579388f},
-std::array<float,2>{0.380209923f, 0.133531719f},
-std::array<float,2>{0.931814432f, 0.586511493f},
-std::array<float,2>{0.0798785985f, 0.869309723f},
-std::array<float,2>{0.589239895f, 0.304676145f},
-std::array<float,2>{0.000840234687f, 0.080892913f},
-std::array<float,2>{0.552974701f, 0.74709326f},
-std::array<float,2>{0.470911801f, 0.92926842f},
-std::array<float,2>{0.992756307f, 0.396828562f},
-std::array<float,2>{0.28346312f, 0.337531507f},
-std::array<float,2>{0.837094247f, 0.768238425f},
-std::array<float,2>{0.176296473f, 0.501233637f},
-std::array<float,2>{0.724695027f, 0.188665539f},
-std::array<float,2>{0.113154598f, 0.256082267f},
-std::array<float,2>{0.624820352f, 0.825273752f},
-std::array<float,2>{0.430557996f, 0.615327895f},
-std::array<float,2>{0.88770318f, 0.175972119f},
-std::array<float,2>{0.340139031f, 0.0518364944f},
-std::array<float,2>{0.80857861f, 0.630217254f},
-std::array<float,2>{0.216035739f, 0.992432356f},
-std::array<float,2>{0.638143361f, 0.458233654f},
-std::array<float,2>{0.153764725f, 0.247214973f},
-std::array<float,2>{0.703424215f, 0.546970248f},
-std::array<float,2>{0.266246468f, 0.794125736f},
-std::array<float,2>{0.843771636f, 0.364582747f},
-std::array<float,2>{0.466177076f, 0.42386353f},
-std::array<float,2>{0.959343016f, 0.889554441f},
-std::array<float,2>{0.059959732f, 0.694188476f},
-std::array<float,2>{0.510826588f, 0.103152379f},
-std::array<float,2>{0.0356662199f, 0.383986831f},
-std::array<float,2>{0.523570776f, 0.912910044f},
-std::array<float,2>{0.447817892f, 0.730604589f},
-std::array<float,2>{0.937857211f, 0.0689673796f},
-std::array<float,2>{0.257142901f, 0.213217393f},
-std::array<float,2>{0.867664576f, 0.52460283f},
-std::array<float,2>{0.138883367f, 0.760147095f},
-std::array<float,2>{0.694809377f, 0.326758713f},
-std::array<float,2>{0.189119279f, 0.00552453334f},
-std::array<float,2>{0.649210989f, 0.667735517f},
-std::array<float,2>{0.314963728f, 0.947940826f},
-std::array<float,2>{0.785595f, 0.479860157f},
-std::array<float,2>{0.410926908f, 0.291951895f},
-std::array<float,2>{0.892439187f, 0.84706831f},
-std::array<float,2>{0.107453756f, 0.567272544f},
-std::array<float,2>{0.602883637f, 0.145249605f},
-std::array<float,2>{0.156675786f, 0.351053536f},
-std::array<float,2>{0.745266736f, 0.810458481f},
-std::array<float,2>{0.299121588f, 0.53826499f},
-std::array<float,2>{0.819957256f, 0.218911096f},
-std::array<float,2>{0.487733573f, 0.114023626f},
-std::array<float,2>{0.978885233f, 0.718648732f},
-std::array<float,2>{0.0296169464f, 0.893204987f},
-std::array<float,2>{0.53629148f, 0.407108009f},
-std::array<float,2>{0.0652154759f, 0.165014759f},
-std::array<float,2>{0.571253717f, 0.601785123f},
-std::array<float,2>{0.398011446f, 0.834728062f},
-std::array<float,2>{0.910882235f, 0.274635553f},
-std::array<float,2>{0.365424067f, 0.450330615f},
-std::array<float,2>{0.771610558f, 0.979995072f},
-std::array<float,2>{0.223366618f, 0.646235764f},
-std::array<float,2>{0.681838453f, 0.0428023115f},
-std::array<float,2>{0.174709454f, 0.439957738f},
-std::array<float,2>{0.72147882f, 0.974572182f},
-std::array<float,2>{0.287079334f, 0.649489999f},
-std::array<float,2>{0.841448963f, 0.037664745f},
-std::array<float,2>{0.475131571f, 0.159937337f},
-std::array<float,2>{0.997162223f, 0.600909114f},
-std::array<float,2>{0.0042233537f, 0.837945819f},
-std::array<float,2>{0.547054172f, 0.267591298f},
-std::array<float,2>{0.0831964016f, 0.124500185f},
-std::array<float,2>{0.593691528f, 0.703699589f},
-std::array<float,2>{0.376228571f, 0.904066563f},
-std::array<float,2>{0.936606109f, 0.416354537f},
-std::array<float,2>{0.356807619f, 0.356782645f},
-std::array<float,2>{0.764250278f, 0.798643112f},
-std::array<float,2>{0.240928531f, 0.544872344f},
-std::array<float,2>{0.668840349f, 0.22999908f},
-std::array<float,2>{0.05856058f, 0.287614614f},
-std::array<float,2>{0.51291436f, 0.853530645f},
-std::array<float,2>{0.464014977f, 0.575592577f},
-std::array<float,2>{0.953341365f, 0.1535317f},
-std::array<float,2>{0.273170829f, 0.00800226349f},
-std::array<float,2>{0.847836018f, 0.656688571f},
-std::array<float,2>{0.150326341f, 0.94426167f},
-std::array<float,2>{0.707060158f, 0.472459942f},
-std::array<float,2>{0.214068905f, 0.209415212f},
-std::array<float,2>{0.634821355f, 0.520295441f},
-std::array<float,2>{0.338101953f, 0.756445408f},
-std::array<float,2>{0.810424387f, 0.317905664f},
-std::array<float,2>{0.435371429f, 0.378359288f},
-std::array<float,2>{0.883044958f, 0.91873467f},
-std::array<float,2>{0.115181349f, 0.726215005f},
-std::array<float,2>{0.620473385f, 0.0716781244f},
-std::array<float,2>{0.10305015f, 0.431581676f},
-std::array<float,2>{0.608683348f, 0.878588438f},
-std::array<float,2>{0.406369209f, 0.696225166f},
-std::array<float,2>{0.898435354f, 0.0963945165f},
-std::array<float,2>{0.316572368f, 0.241652444f},
-std::array<float,2>{0.784252644f, 0.560242951f},
-std::array<float,2>{0.192082569f, 0.78313452f},
-std::array<float,2>{0.653752506f, 0.371941179f},
-std::array<float,2>{0.135580838f, 0.0619325452f},
-std::array<float,2>{0.690814316f, 0.63355875f},
-std::array<float,2>{0.252189577f, 0.991447926f},
-std::array<float,2>{0.872515619f, 0.468728065f},
-std::array<float,2>{0.451132774f, 0.264086306f},
-std::array<float,2>{0.941484869f, 0.817459583f},
-std::array<float,2>{0.0345052965f, 0.619073153f},
-std::array<float,2>{0.528994203f, 0.180429325f},
-std::array<float,2>{0.219903186f, 0.328655064f},
-std::array<float,2>{0.685696423f, 0.774967074f},
-std::array<float,2>{0.3608661f, 0.511584759f},
-std::array<float,2>{0.768672824f, 0.19887355f},
-std::array<float,2>{0.391581655f, 0.0862223506f},
-std::array<float,2>{0.908835769f, 0.739972472f},
-std::array<float,2>{0.066460155f, 0.935208917f},
-std::array<float,2>{0.574687123f, 0.403317809f},
-std::array<float,2>{0.0243366882f, 0.126197249f},
-std::array<float,2>{0.534796f, 0.58368367f},
-std::array<float,2>{0.490087658f, 0.865338624f},
-std::array<float,2>{0.982976973f, 0.30696705f},
-std::array<float,2>{0.301331013f, 0.493956178f},
-std::array<float,2>{0.815122187f, 0.96083796f},
-std::array<float,2>{0.161611259f, 0.674011111f},
-std::array<float,2>{0.747827232f, 0.0194277968f},
-std::array<float,2>{0.200171247f, 0.390763134f},
-std::array<float,2>{0.64658314f, 0.925635993f},
-std::array<float,2>{0.324444056f, 0.744757295f},
-std::array<float,2>{0.796218812f, 0.0856086239f},
-std::array<float,2>{0.419270456f, 0.193574369f},
-std::array<float,2>{0.900300801f, 0.507803738f},
-std::array<float,2>{0.0963637978f, 0.772230446f},
-std::array<float,2>{0.595451057f, 0.340692669f},
-std::array<float,2>{0.0463341959f, 0.0282985419f},
-std::array<float,2>{0.52061373f, 0.684949756f},
-std::array<float,2>{0.443200201f, 0.965502679f},
-std::array<float,2>{0.950857103f, 0.489997715f},
-std::array<float,2>{0.262815714f, 0.299127132f},
-std::array<float,2>{0.861833453f, 0.87440902f},
-std::array<float,2>{0.130038291f, 0.593319297f},
-std::array<float,2>{0.696180165f, 0.138693228f},
-std::array<float,2>{0.0749417171f, 0.361655802f},
-std::array<float,2>{0.568425417f, 0.790635169f},
-std::array<float,2>{0.398503989f, 0.553342223f},
-std::array<float,2>{0.917833984f, 0.243661746f},
-std::array<float,2>{0.370208114f, 0.107279398f},
-std::array<float,2>{0.779225886f, 0.690079749f},
-std::array<float,2>{0.229433611f, 0.883230627f},
-std::array<float,2>{0.677528203f, 0.426893562f},
-std::array<float,2>{0.165522173f, 0.17502071f},
-std::array<float,2>{0.740058541f, 0.609901011f},
-std::array<float,2>{0.308804989f, 0.823148191f},
-std::array<float,2>{0.821562529f, 0.251377285f},
-std::array<float,2>{0.494139612f, 0.455962598f},
-std::array<float,2>{0.97000134f, 0.9979164f},
-std::array<float,2>{0.0193752926f, 0.625540376f},
-std::array<float,2>{0.544644773f, 0.0475510992f},
-std::array<float,2>{0.0145802675f, 0.48412925f},
-std::array<float,2>{0.557520688f, 0.949680865f},
-std::array<float,2>{0.48053512f, 0.668732285f},
-std::array<float,2>{0.985815823f, 0.00338431844f},
-std::array<float,2>{0.289217204f, 0.141998529f},
-std::array<float,2>{0.835666835f, 0.565966487f},
-std::array<float,2>{0.184446424f, 0.848157406f},
-std::array<float,2>{0.732128441f, 0.293633401f},
-std::array<float,2>{0.244438127f, 0.0634800792f},
-std::array<float,2>{0.660018623f, 0.729627848f},
-std::array<float,2>{0.34898299f, 0.909689546f},
-std::array<float,2>{0.755153239f, 0.387658298f},
-std::array<float,2>{0.38569957f, 0.324012637f},
-std::array<float,2>{0.929039955f, 0.765145719f},
-std::array<float,2>{0.0916504711f, 0.527543366f},
-std::array<float,2>{0.583232939f, 0.215443373f},
-std::array<float,2>{0.147230685f, 0.280227095f},
-std::array<float,2>{0.718156934f, 0.829665899f},
-std::array<float,2>{0.277634501f, 0.608491719f},
-std::array<float,2>{0.857436597f, 0.168049827f},
-std::array<float,2>{0.458622545f, 0.0441049971f},
-std::array<float,2>{0.961667895f, 0.642075956f},
-std::array<float,2>{0.0502490401f, 0.98069042f},
-std::array<float,2>{0.506700516f, 0.446477294f},
-std::array<float,2>{0.124451555f, 0.225901186f},
-std::array<float,2>{0.614969015f, 0.532653093f},
-std::array<float,2>{0.4238002f, 0.805096745f},
-std::array<float,2>{0.877308547f, 0.345540673f},
-std::array<float,2>{0.330096066f, 0.410681099f},
-std::array<float,2>{0.799364388f, 0.897333682f},
-std::array<float,2>{0.209774524f, 0.711887479f},
-std::array<float,2>{0.630721092f, 0.112284705f},
-std::array<float,2>{0.16840215f, 0.380763561f},
-std::array<float,2>{0.734787107f, 0.917517841f},
-std::array<float,2>{0.30488956f, 0.721342921f},
-std::array<float,2>{0.824409962f, 0.0753974319f},
-std::array<float,2>{0.497876763f, 0.206802726f},
-std::array<float,2>{0.974677384f, 0.517756283f},
-std::array<float,2>{0.0210623629f, 0.751098454f},
-std::array<float,2>{0.539776385f, 0.313347608f},
-std::array<float,2>{0.0720555484f, 0.0127063338f},
-std::array<float,2>{0.565210521f, 0.662955284f},
-std::array<float,2>{0.403888404f, 0.938120961f},
-std::array<float,2>{0.918888509f, 0.473105907f},
-std::array<float,2>{0.373018473f, 0.283286303f},
-std::array<float,2>{0.776256442f, 0.859187126f},
-std::array<float,2>{0.231912851f, 0.574092805f},
-std::array<float,2>{0.672996461f, 0.150950149f},
-std::array<float,2>{0.0428918079f, 0.354067415f},
-std::array<float,2>{0.516977787f, 0.803187907f},
-std::array<float,2>{0.438785493f, 0.541437507f},
-std::array<float,2>{0.946525931f, 0.230642304f},
-std::array<float,2>{0.260535806f, 0.119674981f},
-std::array<float,2>{0.865813136f, 0.709303796f},
-std::array<float,2>{0.127335086f, 0.898582935f},
-std::array<float,2>{0.702845216f, 0.419303477f},
-std::array<float,2>{0.198930249f, 0.161851838f},
-std::array<float,2>{0.641545951f, 0.595474899f},
-std::array<float,2>{0.321286917f, 0.840102255f},
-std::array<float,2>{0.791989982f, 0.271924198f},
-std::array<float,2>{0.416596711f, 0.443479955f},
-std::array<float,2>{0.903567612f, 0.969584703f},
-std::array<float,2>{0.0976714641f, 0.654672503f},
-std::array<float,2>{0.601067483f, 0.0344240367f},
-std::array<float,2>{0.120125927f, 0.496345907f},
-std::array<float,2>{0.611936688f, 0.954345644f},
-std::array<float,2>{0.426205575f, 0.679198384f},
-std::array<float,2>{0.880292773f, 0.0227685682f},
-std::array<float,2>{0.333966911f, 0.132362604f},
-std::array<float,2>{0.80462414f, 0.581426859f},
-std::array<float,2>{0.203854904f, 0.860929728f},
-std::array<float,2>{0.628121257f, 0.309735298f},
-std::array<float,2>{0.143934995f, 0.0902262405f},
-std::array<float,2>{0.71314913f, 0.736525059f},
-std::array<float,2>{0.275653034f, 0.930556834f},
-std::array<float,2>{0.854594529f, 0.40156877f},
-std::array<float,2>{0.454695106f, 0.334190786f},
-std::array<float,2>{0.968401134f, 0.780996442f},
-std::array<float,2>{0.0525157377f, 0.515539527f},
-std::array<float,2>{0.502946854f, 0.20269002f},
-std::array<float,2>{0.247840583f, 0.260753125f},
-std::array<float,2>{0.66060859f, 0.814548552f},
-std::array<float,2>{0.345417649f, 0.624899149f},
-std::array<float,2>{0.751536846f, 0.18419005f},
-std::array<float,2>{0.388961285f, 0.0575660653f},
-std::array<float,2>{0.925412536f, 0.637241125f},
-std::array<float,2>{0.0881884992f, 0.985126436f},
-std::array<float,2>{0.579904318f, 0.463911474f},
-std::array<float,2>{0.00835380983f, 0.236563787f},
-std::array<float,2>{0.561445177f, 0.556486249f},
-std::array<float,2>{0.480182171f, 0.788700819f},
-std::array<float,2>{0.990094721f, 0.369049698f},
-std::array<float,2>{0.294564784f, 0.434581369f},
-std::array<float,2>{0.831864834f, 0.880768836f},
-std::array<float,2>{0.182841644f, 0.701764405f},
-std::array<float,2>{0.727362335f, 0.0981779322f},
-std::array<float,2>{0.218241781f, 0.460521221f},
-std::array<float,2>{0.640358627f, 0.995196879f},
-std::array<float,2>{0.343484789f, 0.631385028f},
-std::array<float,2>{0.805777431f, 0.0544534624f},
-std::array<float,2>{0.433440953f, 0.177810341f},
-std::array<float,2>{0.889639258f, 0.613607764f},
-std::array<float,2>{0.110283092f, 0.827830434f},
-std::array<float,2>{0.622066677f, 0.255185694f},
-std::array<float,2>{0.0624189451f, 0.104856692f},
-std::array<float,2>{0.508778393f, 0.69290489f},
-std::array<float,2>{0.468032718f, 0.887770176f},
-std::array<float,2>{0.957318723f, 0.423724204f},
-std::array<float,2>{0.267854661f, 0.366413087f},
-std::array<float,2>{0.847195566f, 0.795728207f},
-std::array<float,2>{0.15545021f, 0.549225569f},
-std::array<float,2>{0.705118775f, 0.249004677f},
-std::array<float,2>{0.0812887922f, 0.301327378f},
-std::array<float,2>{0.586042643f, 0.867363989f},
-std::array<float,2>{0.382641643f, 0.589251399f},
-std::array<float,2>{0.929975331f, 0.135474801f},
-std::array<float,2>{0.352701992f, 0.0272166524f},
-std::array<float,2>{0.76049751f, 0.682471037f},
-std::array<float,2>{0.238093033f, 0.963341653f},
-std::array<float,2>{0.666473985f, 0.485199451f},
-std::array<float,2>{0.179356977f, 0.19031252f},
-std::array<float,2>{0.724013209f, 0.502440572f},
-std::array<float,2>{0.282875657f, 0.767451704f},
-std::array<float,2>{0.837918818f, 0.33832711f},
-std::array<float,2>{0.46987462f, 0.394560456f},
-std::array<float,2>{0.995479703f, 0.92738539f},
-std::array<float,2>{0.0023385298f, 0.748281538f},
-std::array<float,2>{0.551680148f, 0.0787142441f},
-std::array<float,2>{0.0289758574f, 0.409549028f},
-std::array<float,2>{0.537293971f, 0.890919924f},
-std::array<float,2>{0.4862957f, 0.714948833f},
-std::array<float,2>{0.977688491f, 0.116071716f},
-std::array<float,2>{0.297389328f, 0.222256497f},
-std::array<float,2>{0.817294359f, 0.537004232f},
-std::array<float,2>{0.158568949f, 0.810633838f},
-std::array<float,2>{0.743452787f, 0.349062979f},
-std::array<float,2>{0.224825382f, 0.0409852676f},
-std::array<float,2>{0.680397213f, 0.647215426f},
-std::array<float,2>{0.363673359f, 0.977345526f},
-std::array<float,2>{0.770780265f, 0.451478422f},
-std::array<float,2>{0.395345539f, 0.276734263f},
-std::array<float,2>{0.913467944f, 0.832278788f},
-std::array<float,2>{0.0643766746f, 0.604221165f},
-std::array<float,2>{0.573382854f, 0.167557985f},
-std::array<float,2>{0.137858033f, 0.324699491f},
-std::array<float,2>{0.691658795f, 0.759608686f},
-std::array<float,2>{0.254486561f, 0.526258349f},
-std::array<float,2>{0.869916201f, 0.211439371f},
-std::array<float,2>{0.445351392f, 0.0675347522f},
-std::array<float,2>{0.94069767f, 0.733798623f},
-std::array<float,2>{0.0376972035f, 0.911587417f},
-std::array<float,2>{0.527208924f, 0.384857565f},
-std::array<float,2>{0.106374629f, 0.146780729f},
-std::array<float,2>{0.603815794f, 0.569346011f},
-std::array<float,2>{0.41317454f, 0.844743848f},
-std::array<float,2>{0.893804967f, 0.29020223f},
-std::array<float,2>{0.312602162f, 0.477462173f},
-std::array<float,2>{0.78889823f, 0.946837544f},
-std::array<float,2>{0.189493254f, 0.664462984f},
-std::array<float,2>{0.652261913f, 0.00727685401f},
-std::array<float,2>{0.151651099f, 0.46887973f},
-std::array<float,2>{0.710136354f, 0.942495883f},
-std::array<float,2>{0.270041674f, 0.658244371f},
-std::array<float,2>{0.851423919f, 0.0108465031f},
-std::array<float,2>{0.462725282f, 0.155135438f},
-std::array<float,2>{0.956251502f, 0.57687211f},
-std::array<float,2>{0.0563512966f, 0.852361917f},
-std::array<float,2>{0.514786959f, 0.286998361f},
-std::array<float,2>{0.117016554f, 0.0727345496f},
-std::array<float,2>{0.617411971f, 0.722939968f},
-std::array<float,2>{0.437356949f, 0.921240747f},
-std::array<float,2>{0.886707067f, 0.375400871f},
-std::array<float,2>{0.336377382f, 0.319769204f},
-std::array<float,2>{0.811057925f, 0.755527794f},
-std::array<float,2>{0.21187596f, 0.521965861f},
-std::array<float,2>{0.634052217f, 0.208628297f},
-std::array<float,2>{0.00592885818f, 0.26648429f},
-std::array<float,2>{0.549834013f, 0.836251199f},
-std::array<float,2>{0.474374145f, 0.598396182f},
-std::array<float,2>{0.998650074f, 0.157486737f},
-std::array<float,2>{0.288896322f, 0.03707169f},
-std::array<float,2>{0.843092799f, 0.65214628f},
-std::array<float,2>{0.173588052f, 0.975419164f},
-std::array<float,2>{0.720575511f, 0.438026994f},
-std::array<float,2>{0.239189327f, 0.227143556f},
-std::array<float,2>{0.671105325f, 0.545384884f},
-std::array<float,2>{0.358567357f, 0.799343407f},
-std::array<float,2>{0.763005018f, 0.358650327f},
-std::array<float,2>{0.377012312f, 0.415816575f},
-std::array<float,2>{0.934537113f, 0.904678941f},
-std::array<float,2>{0.0854130983f, 0.706047893f},
-std::array<float,2>{0.591539919f, 0.12200661f},
-std::array<float,2>{0.0687007979f, 0.405974329f},
-std::array<float,2>{0.576581717f, 0.936300993f},
-std::array<float,2>{0.392661154f, 0.741058469f},
-std::array<float,2>{0.90766716f, 0.0881950036f},
-std::array<float,2>{0.362981856f, 0.195794061f},
-std::array<float,2>{0.766278446f, 0.509482384f},
-std::array<float,2>{0.222632453f, 0.775748312f},
-std::array<float,2>{0.68405062f, 0.33070454f},
-std::array<float,2>{0.163425297f, 0.0173058789f},
-std::array<float,2>{0.749706149f, 0.673470497f},
-std::array<float,2>{0.302864194f, 0.957280874f},
-std::array<float,2>{0.814398766f, 0.495548576f},
-std::array<float,2>{0.491420299f, 0.306141585f},
-std::array<float,2>{0.981716752f, 0.865188241f},
-std::array<float,2>{0.0262515657f, 0.584848166f},
-std::array<float,2>{0.532151937f, 0.12770769f},
-std::array<float,2>{0.19452095f, 0.374344856f},
-std::array<float,2>{0.65532583f, 0.785020709f},
-std::array<float,2>{0.320021003f, 0.561547339f},
-std::array<float,2>{0.782613575f, 0.239124164f},
-std::array<float,2>{0.408420891f, 0.0955122486f},
-std::array<float,2>{0.894952178f, 0.698160172f},
-std::array<float,2>{0.103598133f, 0.87660718f},
-std::array<float,2>{0.607079566f, 0.432637244f},
-std::array<float,2>{0.0328333564f, 0.182800427f},
-std::array<float,2>{0.529362917f, 0.620569587f},
-std::array<float,2>{0.45220077f, 0.820226729f},
-std::array<float,2>{0.945039809f, 0.263293415f},
-std::array<float,2>{0.25001049f, 0.465026677f},
-std::array<float,2>{0.874572933f, 0.989597321f},
-std::array<float,2>{0.134464115f, 0.636036336f},
-std::array<float,2>{0.688661754f, 0.05939316f},
-std::array<float,2>{0.228399679f, 0.429436594f},
-std::array<float,2>{0.677855432f, 0.886658728f},
-std::array<float,2>{0.368560523f, 0.687509716f},
-std::array<float,2>{0.77952528f, 0.10900832f},
-std::array<float,2>{0.400601685f, 0.245403782f},
-std::array<float,2>{0.915889919f, 0.550979674f},
-std::array<float,2>{0.0769747347f, 0.792442262f},
-std::array<float,2>{0.567032039f, 0.359657496f},
-std::array<float,2>{0.0172842406f, 0.0506292135f},
-std::array<float,2>{0.546414256f, 0.628325939f},
-std::array<float,2>{0.49551627f, 0.999382913f},
-std::array<float,2>{0.971682429f, 0.45448193f},
-std::array<float,2>{0.31127727f, 0.253456563f},
-std::array<float,2>{0.823393345f, 0.821893156f},
-std::array<float,2>{0.166889429f, 0.612733781f},
-std::array<float,2>{0.742021263f, 0.17276448f},
-std::array<float,2>{0.0949410573f, 0.343239039f},
-std::array<float,2>{0.596688032f, 0.769591272f},
-std::array<float,2>{0.42041564f, 0.504665136f},
-std::array<float,2>{0.90211904f, 0.192175061f},
-std::array<float,2>{0.326683611f, 0.0838093832f},
-std::array<float,2>{0.794104397f, 0.742204905f},
-std::array<float,2>{0.202464193f, 0.923503816f},
-std::array<float,2>{0.646281242f, 0.392613053f},
-std::array<float,2>{0.131194696f, 0.137142509f},
-std::array<float,2>{0.697412074f, 0.591243804f},
-std::array<float,2>{0.26377508f, 0.872710764f},
-std::array<float,2>{0.8610726f, 0.298568219f},
-std::array<float,2>{0.443892837f, 0.491583914f},
-std::array<float,2>{0.952125371f, 0.967053413f},
-std::array<float,2>{0.0443605892f, 0.687436998f},
-std::array<float,2>{0.522810519f, 0.0298798904f},
-std::array<float,2>{0.0470637716f, 0.447549999f},
-std::array<float,2>{0.505648613f, 0.982512474f},
-std::array<float,2>{0.459118247f, 0.643198371f},
-std::array<float,2>{0.964547932f, 0.0454039127f},
-std::array<float,2>{0.280225933f, 0.170449778f},
-std::array<float,2>{0.855984032f, 0.60691154f},
-std::array<float,2>{0.144700319f, 0.830168307f},
-std::array<float,2>{0.716316104f, 0.278383255f},
-std::array<float,2>{0.208723292f, 0.110886961f},
-std::array<float,2>{0.632146955f, 0.713453054f},
-std::array<float,2>{0.328783035f, 0.895679414f},
-std::array<float,2>{0.797278821f, 0.413643926f},
-std::array<float,2>{0.425341725f, 0.347248852f},
-std::array<float,2>{0.875459313f, 0.807646692f},
-std::array<float,2>{0.12192139f, 0.534326553f},
-std::array<float,2>{0.616697073f, 0.222839579f},
-std::array<float,2>{0.185621291f, 0.296217829f},
-std::array<float,2>{0.733167589f, 0.850124955f},
-std::array<float,2>{0.292847186f, 0.56423676f},
-std::array<float,2>{0.833265305f, 0.143520504f},
-std::array<float,2>{0.483894885f, 8.24651725e-05f},
-std::array<float,2>{0.987334669f, 0.671361208f},
-std::array<float,2>{0.0130303139f, 0.952669799f},
-std::array<float,2>{0.556521714f, 0.482365906f},
-std::array<float,2>{0.093171075f, 0.21724917f},
-std::array<float,2>{0.584081233f, 0.530348301f},
-std::array<float,2>{0.383464366f, 0.76310879f},
-std::array<float,2>{0.926509619f, 0.321642905f},
-std::array<float,2>{0.350946426f, 0.39001894f},
-std::array<float,2>{0.757369578f, 0.908087075f},
-std::array<float,2>{0.242626742f, 0.726659775f},
-std::array<float,2>{0.656528175f, 0.0648970753f},
-std::array<float,2>{0.139488593f, 0.385596573f},
-std::array<float,2>{0.695048034f, 0.912009239f},
-std::array<float,2>{0.257384539f, 0.734298229f},
-std::array<float,2>{0.867794335f, 0.0683010146f},
-std::array<float,2>{0.447435856f, 0.211353526f},
-std::array<float,2>{0.938424706f, 0.525400937f},
-std::array<float,2>{0.0353149772f, 0.75911063f},
-std::array<float,2>{0.524276793f, 0.325036287f},
-std::array<float,2>{0.108253516f, 0.00778879272f},
-std::array<float,2>{0.603293717f, 0.664623141f},
-std::array<float,2>{0.410181284f, 0.946439445f},
-std::array<float,2>{0.891790152f, 0.476887852f},
-std::array<float,2>{0.314938486f, 0.290958494f},
-std::array<float,2>{0.785890758f, 0.845345557f},
-std::array<float,2>{0.1887905f, 0.569981754f},
-std::array<float,2>{0.64892441f, 0.14734292f},
-std::array<float,2>{0.0298616719f, 0.34920004f},
-std::array<float,2>{0.53709811f, 0.811475813f},
-std::array<float,2>{0.488000304f, 0.536386251f},
-std::array<float,2>{0.979382992f, 0.221714586f},
-std::array<float,2>{0.299622566f, 0.115629606f},
-std::array<float,2>{0.81975764f, 0.715428174f},
-std::array<float,2>{0.156859651f, 0.891132534f},
-std::array<float,2>{0.746015191f, 0.409943819f},
-std::array<float,2>{0.222709656f, 0.167331114f},
-std::array<float,2>{0.682477176f, 0.603777528f},
-std::array<float,2>{0.366027713f, 0.832862914f},
-std::array<float,2>{0.772033513f, 0.276994675f},
-std::array<float,2>{0.397684008f, 0.451739222f},
-std::array<float,2>{0.910185874f, 0.976676404f},
-std::array<float,2>{0.0645121783f, 0.646652758f},
-std::array<float,2>{0.570591211f, 0.0401657335f},
-std::array<float,2>{0.0794495046f, 0.484463483f},
-std::array<float,2>{0.589793921f, 0.963785648f},
-std::array<float,2>{0.380672336f, 0.682116151f},
-std::array<float,2>{0.932283103f, 0.0267064385f},
-std::array<float,2>{0.354498863f, 0.1348667f},
-std::array<float,2>{0.759728134f, 0.58943218f},
-std::array<float,2>{0.234599277f, 0.867770851f},
-std::array<float,2>{0.66531986f, 0.30086869f},
-std::array<float,2>{0.175899133f, 0.0784468427f},
-std::array<float,2>{0.725456536f, 0.748623848f},
-std::array<float,2>{0.284012079f, 0.927170038f},
-std::array<float,2>{0.837526917f, 0.39541325f},
-std::array<float,2>{0.471519589f, 0.338503778f},
-std::array<float,2>{0.992383599f, 0.766672909f},
-std::array<float,2>{4.33526147e-05f, 0.502601624f},
-std::array<float,2>{0.553397655f, 0.189603508f},
-std::array<float,2>{0.216408476f, 0.255856782f},
-std::array<float,2>{0.638476551f, 0.827213883f},
-std::array<float,2>{0.340540469f, 0.614058912f},
-std::array<float,2>{0.807687283f, 0.17824848f},
-std::array<float,2>{0.429932028f, 0.0540285632f},
-std::array<float,2>{0.88855201f, 0.630907178f},
-std::array<float,2>{0.11235597f, 0.995667338f},
-std::array<float,2>{0.624029756f, 0.460243523f},
-std::array<float,2>{0.0600941069f, 0.248246238f},
-std::array<float,2>{0.511350632f, 0.549579144f},
-std::array<float,2>{0.466584802f, 0.795249641f},
-std::array<float,2>{0.959646761f, 0.366800278f},
-std::array<float,2>{0.265828788f, 0.423152566f},
-std::array<float,2>{0.844503641f, 0.888213992f},
-std::array<float,2>{0.154071793f, 0.692560494f},
-std::array<float,2>{0.703870833f, 0.105109826f},
-std::array<float,2>{0.248473063f, 0.46467182f},
-std::array<float,2>{0.662709177f, 0.98484844f},
-std::array<float,2>{0.346107602f, 0.637170374f},
-std::array<float,2>{0.752801478f, 0.0569295399f},
-std::array<float,2>{0.388151467f, 0.183790192f},
-std::array<float,2>{0.92234534f, 0.624393582f},
-std::array<float,2>{0.0867206976f, 0.814989805f},
-std::array<float,2>{0.581186593f, 0.261540383f},
-std::array<float,2>{0.0107710361f, 0.0980216414f},
-std::array<float,2>{0.56035018f, 0.701535165f},
-std::array<float,2>{0.476564705f, 0.87997067f},
-std::array<float,2>{0.991863012f, 0.435462952f},
-std::array<float,2>{0.296863735f, 0.368643105f},
-std::array<float,2>{0.828392506f, 0.78832674f},
-std::array<float,2>{0.180278659f, 0.555718124f},
-std::array<float,2>{0.728932261f, 0.236886114f},
-std::array<float,2>{0.118632682f, 0.310175687f},
-std::array<float,2>{0.609727144f, 0.860602558f},
-std::array<float,2>{0.428395599f, 0.581700444f},
-std::array<float,2>{0.882497489f, 0.132186398f},
-std::array<float,2>{0.334586859f, 0.023382606f},
-std::array<float,2>{0.801406026f, 0.679568708f},
-std::array<float,2>{0.20532468f, 0.955014586f},
-std::array<float,2>{0.626292109f, 0.497055322f},
-std::array<float,2>{0.141168922f, 0.202453524f},
-std::array<float,2>{0.711806417f, 0.5148803f},
-std::array<float,2>{0.273535728f, 0.78030163f},
-std::array<float,2>{0.852069676f, 0.334627002f},
-std::array<float,2>{0.456121683f, 0.402276695f},
-std::array<float,2>{0.965260744f, 0.929720759f},
-std::array<float,2>{0.0542163439f, 0.737037003f},
-std::array<float,2>{0.500971377f, 0.090587154f},
-std::array<float,2>{0.0391043425f, 0.419876218f},
-std::array<float,2>{0.518628061f, 0.899032831f},
-std::array<float,2>{0.441068023f, 0.70987922f},
-std::array<float,2>{0.948989093f, 0.119334556f},
-std::array<float,2>{0.259660572f, 0.231272474f},
-std::array<float,2>{0.86410886f, 0.541805387f},
-std::array<float,2>{0.126906335f, 0.803315401f},
-std::array<float,2>{0.701129496f, 0.353861004f},
-std::array<float,2>{0.196804404f, 0.0349204764f},
-std::array<float,2>{0.642938256f, 0.655261993f},
-std::array<float,2>{0.323452115f, 0.968869567f},
-std::array<float,2>{0.789907575f, 0.444151193f},
-std::array<float,2>{0.414949387f, 0.27228713f},
-std::array<float,2>{0.906180203f, 0.840686142f},
-std::array<float,2>{0.100235425f, 0.594729483f},
-std::array<float,2>{0.598747253f, 0.161293238f},
-std::array<float,2>{0.170110002f, 0.312814146f},
-std::array<float,2>{0.73788625f, 0.751809418f},
-std::array<float,2>{0.308187634f, 0.51842469f},
-std::array<float,2>{0.82736665f, 0.206359059f},
-std::array<float,2>{0.498493254f, 0.0759364069f},
-std::array<float,2>{0.973357081f, 0.720868111f},
-std::array<float,2>{0.0219557062f, 0.917155921f},
-std::array<float,2>{0.542810559f, 0.380243987f},
-std::array<float,2>{0.0740384087f, 0.150598362f},
-std::array<float,2>{0.563080013f, 0.573458612f},
-std::array<float,2>{0.404389679f, 0.858644783f},
-std::array<float,2>{0.920596063f, 0.28382504f},
-std::array<float,2>{0.374109268f, 0.473221332f},
-std::array<float,2>{0.773582458f, 0.93751663f},
-std::array<float,2>{0.232554868f, 0.662399888f},
-std::array<float,2>{0.675194144f, 0.0134188412f},
-std::array<float,2>{0.18392846f, 0.481514633f},
-std::array<float,2>{0.731470346f, 0.95262748f},
-std::array<float,2>{0.289681405f, 0.671821356f},
-std::array<float,2>{0.835148394f, 0.000771944702f},
-std::array<float,2>{0.481125474f, 0.142722413f},
-std::array<float,2>{0.986175537f, 0.563476741f},
-std::array<float,2>{0.013778083f, 0.850088596f},
-std::array<float,2>{0.557109654f, 0.296771914f},
-std::array<float,2>{0.0911682993f, 0.0651657656f},
-std::array<float,2>{0.583527923f, 0.727438271f},
-std::array<float,2>{0.385002941f, 0.907652199f},
-std::array<float,2>{0.929611683f, 0.390320629f},
-std::array<float,2>{0.349191755f, 0.322110534f},
-std::array<float,2>{0.75578016f, 0.76344347f},
-std::array<float,2>{0.244705811f, 0.530997396f},
-std::array<float,2>{0.65941453f, 0.217683926f},
-std::array<float,2>{0.0503400937f, 0.279103965f},
-std::array<float,2>{0.506345987f, 0.830654502f},
-std::array<float,2>{0.458220541f, 0.607370913f},
-std::array<float,2>{0.960977018f, 0.169926584f},
-std::array<float,2>{0.278213859f, 0.045854561f},
-std::array<float,2>{0.858247459f, 0.642904043f},
-std::array<float,2>{0.146725729f, 0.983141124f},
-std::array<float,2>{0.718540132f, 0.447755635f},
-std::array<float,2>{0.209006339f, 0.223307341f},
-std::array<float,2>{0.630161285f, 0.535037696f},
-std::array<float,2>{0.330924749f, 0.808206499f},
-std::array<float,2>{0.798844576f, 0.347008973f},
-std::array<float,2>{0.422874302f, 0.41322723f},
-std::array<float,2>{0.877529681f, 0.896235883f},
-std::array<float,2>{0.124914356f, 0.713335931f},
-std::array<float,2>{0.614327133f, 0.110807538f},
-std::array<float,2>{0.0960971415f, 0.393527806f},
-std::array<float,2>{0.595169842f, 0.923269331f},
-std::array<float,2>{0.419765174f, 0.743040025f},
-std::array<float,2>{0.899749219f, 0.0834447816f},
-std::array<float,2>{0.325071365f, 0.191482097f},
-std::array<float,2>{0.796590626f, 0.504092872f},
-std::array<float,2>{0.199321672f, 0.770301223f},
-std::array<float,2>{0.647055805f, 0.343412876f},
-std::array<float,2>{0.130374417f, 0.0293719806f},
-std::array<float,2>{0.69541806f, 0.686660647f},
-std::array<float,2>{0.263402522f, 0.967478156f},
-std::array<float,2>{0.861669421f, 0.49180454f},
-std::array<float,2>{0.442505717f, 0.298246175f},
-std::array<float,2>{0.950221121f, 0.872417271f},
-std::array<float,2>{0.0465350673f, 0.591477454f},
-std::array<float,2>{0.521071434f, 0.137576669f},
-std::array<float,2>{0.228577375f, 0.360118568f},
-std::array<float,2>{0.676813602f, 0.792900324f},
-std::array<float,2>{0.371078521f, 0.551465273f},
-std::array<float,2>{0.778555274f, 0.246002197f},
-std::array<float,2>{0.399337351f, 0.108701617f},
-std::array<float,2>{0.917381823f, 0.68835634f},
-std::array<float,2>{0.0744675174f, 0.88577646f},
-std::array<float,2>{0.569321394f, 0.429003835f},
-std::array<float,2>{0.0187607016f, 0.17187731f},
-std::array<float,2>{0.543998837f, 0.612899899f},
-std::array<float,2>{0.493574202f, 0.82159853f},
-std::array<float,2>{0.970274329f, 0.253382564f},
-std::array<float,2>{0.309549212f, 0.454595625f},
-std::array<float,2>{0.821961224f, 0.999930382f},
-std::array<float,2>{0.16601555f, 0.628657937f},
-std::array<float,2>{0.739651501f, 0.0499473587f},
-std::array<float,2>{0.191672966f, 0.433436066f},
-std::array<float,2>{0.654114723f, 0.876424134f},
-std::array<float,2>{0.316934705f, 0.697299719f},
-std::array<float,2>{0.784735084f, 0.0950336754f},
-std::array<float,2>{0.407109112f, 0.238632634f},
-std::array<float,2>{0.897854865f, 0.562498808f},
-std::array<float,2>{0.102841668f, 0.784461975f},
-std::array<float,2>{0.609295249f, 0.374969631f},
-std::array<float,2>{0.0350293964f, 0.0588131733f},
-std::array<float,2>{0.528501153f, 0.636643469f},
-std::array<float,2>{0.450592577f, 0.990043104f},
-std::array<float,2>{0.941929281f, 0.465425789f},
-std::array<float,2>{0.252741069f, 0.262803763f},
-std::array<float,2>{0.872896135f, 0.819521308f},
-std::array<float,2>{0.134959161f, 0.62105006f},
-std::array<float,2>{0.691065252f, 0.183261022f},
-std::array<float,2>{0.0670781061f, 0.330175161f},
-std::array<float,2>{0.575167239f, 0.776132584f},
-std::array<float,2>{0.390873373f, 0.50893563f},
-std::array<float,2>{0.908523083f, 0.195857972f},
-std::array<float,2>{0.360833704f, 0.0888121501f},
-std::array<float,2>{0.769263625f, 0.740451992f},
-std::array<float,2>{0.22055456f, 0.935636222f},
-std::array<float,2>{0.686422288f, 0.405540049f},
-std::array<float,2>{0.161680549f, 0.127362579f},
-std::array<float,2>{0.747252047f, 0.584462523f},
-std::array<float,2>{0.30088374f, 0.864409506f},
-std::array<float,2>{0.81458056f, 0.306274623f},
-std::array<float,2>{0.489617169f, 0.495816469f},
-std::array<float,2>{0.982501268f, 0.957672417f},
-std::array<float,2>{0.0237966776f, 0.672928035f},
-std::array<float,2>{0.534593284f, 0.0166469514f},
-std::array<float,2>{0.0045155636f, 0.437802941f},
-std::array<float,2>{0.547573984f, 0.974744201f},
-std::array<float,2>{0.474624217f, 0.651440382f},
-std::array<float,2>{0.997767746f, 0.0362454988f},
-std::array<float,2>{0.286368728f, 0.15791437f},
-std::array<float,2>{0.841088712f, 0.598068833f},
-std::array<float,2>{0.174221531f, 0.836541653f},
-std::array<float,2>{0.721007824f, 0.265768975f},
-std::array<float,2>{0.240661308f, 0.121249162f},
-std::array<float,2>{0.668431878f, 0.70537132f},
-std::array<float,2>{0.357125193f, 0.905228019f},
-std::array<float,2>{0.763871312f, 0.415087551f},
-std::array<float,2>{0.376818031f, 0.359078616f},
-std::array<float,2>{0.937342107f, 0.798879027f},
-std::array<float,2>{0.0836308151f, 0.545770407f},
-std::array<float,2>{0.592871428f, 0.226800382f},
-std::array<float,2>{0.149898738f, 0.286214799f},
-std::array<float,2>{0.707893133f, 0.851775467f},
-std::array<float,2>{0.272511423f, 0.576313496f},
-std::array<float,2>{0.848490834f, 0.15446274f},
-std::array<float,2>{0.464641929f, 0.0113380644f},
-std::array<float,2>{0.953742146f, 0.658823013f},
-std::array<float,2>{0.0579006225f, 0.942997813f},
-std::array<float,2>{0.513502002f, 0.469688326f},
-std::array<float,2>{0.114653893f, 0.208107084f},
-std::array<float,2>{0.620885134f, 0.522308469f},
-std::array<float,2>{0.435012341f, 0.755069792f},
-std::array<float,2>{0.883560479f, 0.319936156f},
-std::array<float,2>{0.338425457f, 0.375599653f},
-std::array<float,2>{0.809646428f, 0.921607435f},
-std::array<float,2>{0.214764684f, 0.723444819f},
-std::array<float,2>{0.635601401f, 0.0730154887f},
-std::array<float,2>{0.159177139f, 0.40668118f},
-std::array<float,2>{0.743830621f, 0.892805755f},
-std::array<float,2>{0.297103345f, 0.717941403f},
-std::array<float,2>{0.816766977f, 0.113415897f},
-std::array<float,2>{0.485701472f, 0.219471887f},
-std::array<float,2>{0.978360891f, 0.538574457f},
-std::array<float,2>{0.0287225209f, 0.809862733f},
-std::array<float,2>{0.537903309f, 0.351097435f},
-std::array<float,2>{0.0635685101f, 0.0423390903f},
-std::array<float,2>{0.57374227f, 0.645866036f},
-std::array<float,2>{0.394697189f, 0.979617178f},
-std::array<float,2>{0.913812518f, 0.451063722f},
-std::array<float,2>{0.364235073f, 0.275386155f},
-std::array<float,2>{0.771362245f, 0.834300697f},
-std::array<float,2>{0.225353733f, 0.602438867f},
-std::array<float,2>{0.680009961f, 0.164113119f},
-std::array<float,2>{0.0372614376f, 0.326238871f},
-std::array<float,2>{0.52642256f, 0.760432661f},
-std::array<float,2>{0.446157783f, 0.525363624f},
-std::array<float,2>{0.941147923f, 0.213709414f},
-std::array<float,2>{0.253907084f, 0.0684278607f},
-std::array<float,2>{0.869487107f, 0.731445193f},
-std::array<float,2>{0.138358384f, 0.912459612f},
-std::array<float,2>{0.692035913f, 0.384764731f},
-std::array<float,2>{0.190263882f, 0.144859493f},
-std::array<float,2>{0.651725411f, 0.566794097f},
-std::array<float,2>{0.31341508f, 0.847180545f},
-std::array<float,2>{0.788442791f, 0.291258365f},
-std::array<float,2>{0.413588941f, 0.480086297f},
-std::array<float,2>{0.894174457f, 0.947613776f},
-std::array<float,2>{0.105606109f, 0.667460024f},
-std::array<float,2>{0.604481101f, 0.00492712483f},
-std::array<float,2>{0.109834559f, 0.458518922f},
-std::array<float,2>{0.621166408f, 0.993098617f},
-std::array<float,2>{0.432900399f, 0.630799413f},
-std::array<float,2>{0.88898313f, 0.0525656603f},
-std::array<float,2>{0.343003869f, 0.176339239f},
-std::array<float,2>{0.806160569f, 0.615736187f},
-std::array<float,2>{0.21851705f, 0.825773299f},
-std::array<float,2>{0.639649034f, 0.256577998f},
-std::array<float,2>{0.15606387f, 0.102659531f},
-std::array<float,2>{0.706023991f, 0.693621278f},
-std::array<float,2>{0.268503785f, 0.888820112f},
-std::array<float,2>{0.847001255f, 0.424761802f},
-std::array<float,2>{0.468403906f, 0.365179241f},
-std::array<float,2>{0.957533479f, 0.794626415f},
-std::array<float,2>{0.0618517846f, 0.547391415f},
-std::array<float,2>{0.508213997f, 0.247566655f},
-std::array<float,2>{0.23777619f, 0.303840429f},
-std::array<float,2>{0.666837513f, 0.869947553f},
-std::array<float,2>{0.353276163f, 0.58605814f},
-std::array<float,2>{0.760226965f, 0.132851645f},
-std::array<float,2>{0.382017225f, 0.0250796694f},
-std::array<float,2>{0.93062216f, 0.681402504f},
-std::array<float,2>{0.0816847682f, 0.961784184f},
-std::array<float,2>{0.58650279f, 0.486607164f},
-std::array<float,2>{0.00265853852f, 0.189140111f},
-std::array<float,2>{0.551178515f, 0.501690149f},
-std::array<float,2>{0.470666409f, 0.767743766f},
-std::array<float,2>{0.995777905f, 0.33712399f},
-std::array<float,2>{0.282503337f, 0.397239655f},
-std::array<float,2>{0.838628411f, 0.928834081f},
-std::array<float,2>{0.179141387f, 0.747744918f},
-std::array<float,2>{0.724531233f, 0.0803033188f},
-std::array<float,2>{0.203312516f, 0.499343783f},
-std::array<float,2>{0.62849921f, 0.955135882f},
-std::array<float,2>{0.333018333f, 0.677656531f},
-std::array<float,2>{0.803731143f, 0.0196381751f},
-std::array<float,2>{0.4266451f, 0.130706906f},
-std::array<float,2>{0.880569279f, 0.579115629f},
-std::array<float,2>{0.120726213f, 0.862710953f},
-std::array<float,2>{0.611679912f, 0.312125236f},
-std::array<float,2>{0.052139841f, 0.0922867879f},
-std::array<float,2>{0.503515601f, 0.735225499f},
-std::array<float,2>{0.454206944f, 0.93249476f},
-std::array<float,2>{0.967831135f, 0.399893165f},
-std::array<float,2>{0.276162952f, 0.33214435f},
-std::array<float,2>{0.855122685f, 0.777501404f},
-std::array<float,2>{0.144446075f, 0.513378978f},
-std::array<float,2>{0.713693619f, 0.200084955f},
-std::array<float,2>{0.0885094181f, 0.258250326f},
-std::array<float,2>{0.579452395f, 0.814095974f},
-std::array<float,2>{0.389500976f, 0.621984065f},
-std::array<float,2>{0.92496568f, 0.186342761f},
-std::array<float,2>{0.344963193f, 0.0548135862f},
-std::array<float,2>{0.751219153f, 0.638907313f},
-std::array<float,2>{0.247133374f, 0.987393439f},
-std::array<float,2>{0.660713613f, 0.461605221f},
-std::array<float,2>{0.183463559f, 0.235340595f},
-std::array<float,2>{0.726821721f, 0.557350576f},
-std::array<float,2>{0.294184446f, 0.785300851f},
-std::array<float,2>{0.831116617f, 0.369808286f},
-std::array<float,2>{0.479673952f, 0.437230766f},
-std::array<float,2>{0.989720643f, 0.882190228f},
-std::array<float,2>{0.00827158988f, 0.700263977f},
-std::array<float,2>{0.561002314f, 0.100369677f},
-std::array<float,2>{0.0205689706f, 0.381306946f},
-std::array<float,2>{0.539439499f, 0.914340019f},
-std::array<float,2>{0.497506946f, 0.720369875f},
-std::array<float,2>{0.975512743f, 0.0762486458f},
-std::array<float,2>{0.30563727f, 0.203214958f},
-std::array<float,2>{0.824858963f, 0.517573118f},
-std::array<float,2>{0.168554321f, 0.752709389f},
-std::array<float,2>{0.735163867f, 0.316184312f},
-std::array<float,2>{0.232368693f, 0.0153740095f},
-std::array<float,2>{0.673679769f, 0.661569774f},
-std::array<float,2>{0.372375131f, 0.939911962f},
-std::array<float,2>{0.775838077f, 0.475201368f},
-std::array<float,2>{0.403390527f, 0.282470882f},
-std::array<float,2>{0.918436885f, 0.855845451f},
-std::array<float,2>{0.0713964328f, 0.571069539f},
-std::array<float,2>{0.564586937f, 0.148615584f},
-std::array<float,2>{0.127828583f, 0.351630121f},
-std::array<float,2>{0.702373028f, 0.802461267f},
-std::array<float,2>{0.260181814f, 0.540965796f},
-std::array<float,2>{0.865462363f, 0.232535258f},
-std::array<float,2>{0.439418346f, 0.117203362f},
-std::array<float,2>{0.94695735f, 0.707861364f},
-std::array<float,2>{0.0423851497f, 0.901290596f},
-std::array<float,2>{0.51756978f, 0.42052418f},
-std::array<float,2>{0.098392427f, 0.163853571f},
-std::array<float,2>{0.601147532f, 0.596667588f},
-std::array<float,2>{0.416397274f, 0.841805577f},
-std::array<float,2>{0.904093266f, 0.26984477f},
-std::array<float,2>{0.320629865f, 0.443135619f},
-std::array<float,2>{0.791304529f, 0.972213566f},
-std::array<float,2>{0.198514685f, 0.652650535f},
-std::array<float,2>{0.641013741f, 0.0331581682f},
-std::array<float,2>{0.145202577f, 0.44687894f},
-std::array<float,2>{0.716286838f, 0.981241286f},
-std::array<float,2>{0.279694468f, 0.642301321f},
-std::array<float,2>{0.855482936f, 0.0447043292f},
-std::array<float,2>{0.459757179f, 0.168487594f},
-std::array<float,2>{0.964126885f, 0.609146953f},
-std::array<float,2>{0.0477133319f, 0.829153538f},
-std::array<float,2>{0.50506103f, 0.27978465f},
-std::array<float,2>{0.121461608f, 0.11152643f},
-std::array<float,2>{0.616822004f, 0.7113235f},
-std::array<float,2>{0.42526716f, 0.896490335f},
-std::array<float,2>{0.875856757f, 0.41046983f},
-std::array<float,2>{0.328496635f, 0.344928563f},
-std::array<float,2>{0.797506392f, 0.805188894f},
-std::array<float,2>{0.208069265f, 0.532836437f},
-std::array<float,2>{0.632411182f, 0.226482332f},
-std::array<float,2>{0.0131999794f, 0.293393582f},
-std::array<float,2>{0.555962563f, 0.847740352f},
-std::array<float,2>{0.483595014f, 0.565900266f},
-std::array<float,2>{0.987826586f, 0.14233081f},
-std::array<float,2>{0.292344481f, 0.00358785386f},
-std::array<float,2>{0.833520174f, 0.668130398f},
-std::array<float,2>{0.186502725f, 0.949865103f},
-std::array<float,2>{0.732719541f, 0.483676016f},
-std::array<float,2>{0.243101299f, 0.215313032f},
-std::array<float,2>{0.656959355f, 0.527850151f},
-std::array<float,2>{0.351265639f, 0.765117824f},
-std::array<float,2>{0.757110178f, 0.323661983f},
-std::array<float,2>{0.383076698f, 0.386813372f},
-std::array<float,2>{0.926056147f, 0.909313142f},
-std::array<float,2>{0.0933881402f, 0.730380356f},
-std::array<float,2>{0.584889352f, 0.0641303957f},
-std::array<float,2>{0.0764587075f, 0.427535802f},
-std::array<float,2>{0.566732943f, 0.883449078f},
-std::array<float,2>{0.401344419f, 0.689748883f},
-std::array<float,2>{0.915517926f, 0.106726192f},
-std::array<float,2>{0.369025409f, 0.24323912f},
-std::array<float,2>{0.779925466f, 0.553078234f},
-std::array<float,2>{0.228006363f, 0.790077925f},
-std::array<float,2>{0.678265214f, 0.362163931f},
-std::array<float,2>{0.166499123f, 0.0473255999f},
-std::array<float,2>{0.74146682f, 0.625138223f},
-std::array<float,2>{0.310745269f, 0.997236013f},
-std::array<float,2>{0.824200749f, 0.455533236f},
-std::array<float,2>{0.495944887f, 0.251808494f},
-std::array<float,2>{0.972192883f, 0.822349072f},
-std::array<float,2>{0.0170637649f, 0.609784663f},
-std::array<float,2>{0.546333849f, 0.175377235f},
-std::array<float,2>{0.202853322f, 0.340105414f},
-std::array<float,2>{0.645523489f, 0.771593273f},
-std::array<float,2>{0.326542407f, 0.50713104f},
-std::array<float,2>{0.794527709f, 0.193991899f},
-std::array<float,2>{0.419970125f, 0.085032776f},
-std::array<float,2>{0.901394963f, 0.744403481f},
-std::array<float,2>{0.0954014063f, 0.925030351f},
-std::array<float,2>{0.597208202f, 0.391516298f},
-std::array<float,2>{0.0446851812f, 0.139547527f},
-std::array<float,2>{0.522952855f, 0.593127012f},
-std::array<float,2>{0.443536818f, 0.874557495f},
-std::array<float,2>{0.951285422f, 0.299534529f},
-std::array<float,2>{0.264394641f, 0.489631116f},
-std::array<float,2>{0.860448122f, 0.965171576f},
-std::array<float,2>{0.131823421f, 0.685307562f},
-std::array<float,2>{0.697756529f, 0.0275421254f},
-std::array<float,2>{0.221920431f, 0.402512282f},
-std::array<float,2>{0.684412599f, 0.935014725f},
-std::array<float,2>{0.362656951f, 0.739522994f},
-std::array<float,2>{0.765946269f, 0.0867440179f},
-std::array<float,2>{0.393373579f, 0.198596209f},
-std::array<float,2>{0.908005774f, 0.511120796f},
-std::array<float,2>{0.0693110675f, 0.774660528f},
-std::array<float,2>{0.576665819f, 0.328300297f},
-std::array<float,2>{0.0254885219f, 0.0189369284f},
-std::array<float,2>{0.531435072f, 0.674634337f},
-std::array<float,2>{0.491938502f, 0.960310996f},
-std::array<float,2>{0.982194722f, 0.493331313f},
-std::array<float,2>{0.303443998f, 0.307465017f},
-std::array<float,2>{0.813764215f, 0.865864277f},
-std::array<float,2>{0.16358003f, 0.583288252f},
-std::array<float,2>{0.749355197f, 0.126762241f},
-std::array<float,2>{0.104344688f, 0.371229619f},
-std::array<float,2>{0.606548309f, 0.782659411f},
-std::array<float,2>{0.409129798f, 0.559987724f},
-std::array<float,2>{0.895220816f, 0.241946667f},
-std::array<float,2>{0.319767177f, 0.0960779265f},
-std::array<float,2>{0.782982051f, 0.695699036f},
-std::array<float,2>{0.194851607f, 0.877933323f},
-std::array<float,2>{0.65597403f, 0.430776596f},
-std::array<float,2>{0.133810833f, 0.179707363f},
-std::array<float,2>{0.688979745f, 0.618414819f},
-std::array<float,2>{0.250757754f, 0.818025827f},
-std::array<float,2>{0.874244928f, 0.264427245f},
-std::array<float,2>{0.453113317f, 0.4680852f},
-std::array<float,2>{0.944644332f, 0.991824567f},
-std::array<float,2>{0.0324767195f, 0.633119404f},
-std::array<float,2>{0.529931188f, 0.0621745214f},
-std::array<float,2>{0.0559898093f, 0.471872211f},
-std::array<float,2>{0.51513952f, 0.943504274f},
-std::array<float,2>{0.462198198f, 0.656916976f},
-std::array<float,2>{0.956887901f, 0.00875493232f},
-std::array<float,2>{0.269927204f, 0.153835803f},
-std::array<float,2>{0.850817204f, 0.575796306f},
-std::array<float,2>{0.151933461f, 0.854119241f},
-std::array<float,2>{0.710622787f, 0.28729099f},
-std::array<float,2>{0.211340651f, 0.072071068f},
-std::array<float,2>{0.634667933f, 0.725627303f},
-std::array<float,2>{0.336587816f, 0.91823256f},
-std::array<float,2>{0.810648739f, 0.378831983f},
-std::array<float,2>{0.436956167f, 0.317662358f},
-std::array<float,2>{0.886059821f, 0.755870283f},
-std::array<float,2>{0.116357088f, 0.52000773f},
-std::array<float,2>{0.617694139f, 0.209807962f},
-std::array<float,2>{0.173149943f, 0.268365145f},
-std::array<float,2>{0.719906747f, 0.838423789f},
-std::array<float,2>{0.288246334f, 0.6012941f},
-std::array<float,2>{0.843390048f, 0.159428924f},
-std::array<float,2>{0.474017739f, 0.0374819003f},
-std::array<float,2>{0.998487711f, 0.65008527f},
-std::array<float,2>{0.00681882678f, 0.973852336f},
-std::array<float,2>{0.550452471f, 0.439498395f},
-std::array<float,2>{0.0854807496f, 0.229936704f},
-std::array<float,2>{0.591106951f, 0.54410255f},
-std::array<float,2>{0.377929509f, 0.798044205f},
-std::array<float,2>{0.933686018f, 0.356958359f},
-std::array<float,2>{0.359351337f, 0.416845918f},
-std::array<float,2>{0.763186276f, 0.903538644f},
-std::array<float,2>{0.238457173f, 0.70359832f},
-std::array<float,2>{0.671773016f, 0.124906659f},
-std::array<float,2>{0.152952552f, 0.425300598f},
-std::array<float,2>{0.704898715f, 0.890360534f},
-std::array<float,2>{0.26729238f, 0.694544733f},
-std::array<float,2>{0.845306873f, 0.102175631f},
-std::array<float,2>{0.464905143f, 0.246980637f},
-std::array<float,2>{0.960543811f, 0.54864949f},
-std::array<float,2>{0.0594881512f, 0.793729246f},
-std::array<float,2>{0.510156274f, 0.363999873f},
-std::array<float,2>{0.111477166f, 0.0508509763f},
-std::array<float,2>{0.62358743f, 0.629009426f},
-std::array<float,2>{0.431156665f, 0.993497729f},
-std::array<float,2>{0.886924326f, 0.457489491f},
-std::array<float,2>{0.341072917f, 0.2575638f},
-std::array<float,2>{0.806788802f, 0.824943662f},
-std::array<float,2>{0.215462714f, 0.616462469f},
-std::array<float,2>{0.636848509f, 0.177647308f},
-std::array<float,2>{0.0010215186f, 0.336824596f},
-std::array<float,2>{0.553916931f, 0.769271255f},
-std::array<float,2>{0.471807033f, 0.500038147f},
-std::array<float,2>{0.993601859f, 0.187798098f},
-std::array<float,2>{0.284798235f, 0.0818999261f},
-std::array<float,2>{0.836467743f, 0.746446073f},
-std::array<float,2>{0.176995933f, 0.928573251f},
-std::array<float,2>{0.725592971f, 0.398097485f},
-std::array<float,2>{0.236108616f, 0.134472862f},
-std::array<float,2>{0.664907753f, 0.586969256f},
-std::array<float,2>{0.354355901f, 0.870863497f},
-std::array<float,2>{0.758517265f, 0.302916944f},
-std::array<float,2>{0.379393369f, 0.48827669f},
-std::array<float,2>{0.933398366f, 0.962694645f},
-std::array<float,2>{0.0785993561f, 0.680347025f},
-std::array<float,2>{0.588095784f, 0.0240934398f},
-std::array<float,2>{0.0662725121f, 0.449939907f},
-std::array<float,2>{0.572237551f, 0.978833973f},
-std::array<float,2>{0.396865964f, 0.64463836f},
-std::array<float,2>{0.911919057f, 0.0418232717f},
-std::array<float,2>{0.366871953f, 0.165561855f},
-std::array<float,2>{0.773198187f, 0.602785289f},
-std::array<float,2>{0.223693237f, 0.835091114f},
-std::array<float,2>{0.683286548f, 0.273603201f},
-std::array<float,2>{0.157902777f, 0.115049727f},
-std::array<float,2>{0.745053947f, 0.717251956f},
-std::array<float,2>{0.300083101f, 0.894084096f},
-std::array<float,2>{0.819278896f, 0.40794006f},
-std::array<float,2>{0.486499548f, 0.350218058f},
-std::array<float,2>{0.980086565f, 0.808914423f},
-std::array<float,2>{0.0307796448f, 0.537805855f},
-std::array<float,2>{0.535281658f, 0.219727322f},
-std::array<float,2>{0.188181236f, 0.292138815f},
-std::array<float,2>{0.650023043f, 0.846262157f},
-std::array<float,2>{0.315438628f, 0.56820637f},
-std::array<float,2>{0.786574244f, 0.146405831f},
-std::array<float,2>{0.411568165f, 0.00435427018f},
-std::array<float,2>{0.89111656f, 0.666571081f},
-std::array<float,2>{0.108558357f, 0.948333323f},
-std::array<float,2>{0.60160476f, 0.478520006f},
-std::array<float,2>{0.0368759334f, 0.213948414f},
-std::array<float,2>{0.525220335f, 0.523601472f},
-std::array<float,2>{0.448360622f, 0.761410177f},
-std::array<float,2>{0.939393878f, 0.327691734f},
-std::array<float,2>{0.256824493f, 0.383404315f},
-std::array<float,2>{0.868534565f, 0.91404587f},
-std::array<float,2>{0.140268788f, 0.731808007f},
-std::array<float,2>{0.693997025f, 0.0697677955f},
-std::array<float,2>{0.233424276f, 0.475848019f},
-std::array<float,2>{0.674089074f, 0.940915942f},
-std::array<float,2>{0.373779267f, 0.660818934f},
-std::array<float,2>{0.774617076f, 0.0139286462f},
-std::array<float,2>{0.406087697f, 0.15004693f},
-std::array<float,2>{0.921729505f, 0.571313739f},
-std::array<float,2>{0.0731938258f, 0.857034206f},
-std::array<float,2>{0.563819051f, 0.281568766f},
-std::array<float,2>{0.0226707719f, 0.0780385584f},
-std::array<float,2>{0.541796744f, 0.719185174f},
-std::array<float,2>{0.499373406f, 0.91545558f},
-std::array<float,2>{0.974135995f, 0.382188946f},
-std::array<float,2>{0.307543725f, 0.315340459f},
-std::array<float,2>{0.826901436f, 0.753183365f},
-std::array<float,2>{0.171087816f, 0.51634562f},
-std::array<float,2>{0.736988723f, 0.20477058f},
-std::array<float,2>{0.100815475f, 0.271343589f},
-std::array<float,2>{0.598565459f, 0.842936218f},
-std::array<float,2>{0.415807188f, 0.596874893f},
-std::array<float,2>{0.904708087f, 0.162611306f},
-std::array<float,2>{0.322471917f, 0.0315713845f},
-std::array<float,2>{0.790122986f, 0.65338558f},
-std::array<float,2>{0.195853218f, 0.971402347f},
-std::array<float,2>{0.644222796f, 0.441447884f},
-std::array<float,2>{0.125187263f, 0.233832717f},
-std::array<float,2>{0.699990988f, 0.53910774f},
-std::array<float,2>{0.258670866f, 0.801131725f},
-std::array<float,2>{0.864511549f, 0.353512377f},
-std::array<float,2>{0.439649075f, 0.421706706f},
-std::array<float,2>{0.947599173f, 0.902229011f},
-std::array<float,2>{0.0401942357f, 0.708944798f},
-std::array<float,2>{0.517606497f, 0.118226245f},
-std::array<float,2>{0.0534518957f, 0.399048805f},
-std::array<float,2>{0.501833737f, 0.933244586f},
-std::array<float,2>{0.455551893f, 0.736202538f},
-std::array<float,2>{0.966382623f, 0.0934410244f},
-std::array<float,2>{0.274732262f, 0.200369164f},
-std::array<float,2>{0.852890968f, 0.512418151f},
-std::array<float,2>{0.141940713f, 0.77922231f},
-std::array<float,2>{0.712653935f, 0.333352268f},
-std::array<float,2>{0.206775665f, 0.0214510933f},
-std::array<float,2>{0.625797033f, 0.676293671f},
-std::array<float,2>{0.335865438f, 0.956700265f},
-std::array<float,2>{0.802508533f, 0.498259813f},
-std::array<float,2>{0.429463387f, 0.310853899f},
-std::array<float,2>{0.881510139f, 0.861712277f},
-std::array<float,2>{0.11770051f, 0.578349292f},
-std::array<float,2>{0.610457599f, 0.129810944f},
-std::array<float,2>{0.181364447f, 0.37064141f},
-std::array<float,2>{0.730227888f, 0.786328971f},
-std::array<float,2>{0.295208842f, 0.557630897f},
-std::array<float,2>{0.83005178f, 0.236145377f},
-std::array<float,2>{0.477859527f, 0.101401627f},
-std::array<float,2>{0.990285993f, 0.699792564f},
-std::array<float,2>{0.00980502646f, 0.881552279f},
-std::array<float,2>{0.559069037f, 0.436492383f},
-std::array<float,2>{0.0870281979f, 0.186712772f},
-std::array<float,2>{0.580387652f, 0.622243226f},
-std::array<float,2>{0.386750281f, 0.812596798f},
-std::array<float,2>{0.922950029f, 0.259658545f},
-std::array<float,2>{0.347510606f, 0.462844282f},
-std::array<float,2>{0.753494084f, 0.987219453f},
-std::array<float,2>{0.249937207f, 0.640038311f},
-std::array<float,2>{0.663374007f, 0.0559842102f},
-std::array<float,2>{0.164721847f, 0.45699966f},
-std::array<float,2>{0.738960028f, 0.996611953f},
-std::array<float,2>{0.310157508f, 0.626112938f},
-std::array<float,2>{0.820613742f, 0.0487760417f},
-std::array<float,2>{0.49244225f, 0.174249113f},
-std::array<float,2>{0.969196439f, 0.610465169f},
-std::array<float,2>{0.0184189249f, 0.823389351f},
-std::array<float,2>{0.543387651f, 0.250847518f},
-std::array<float,2>{0.0759917349f, 0.105962671f},
-std::array<float,2>{0.569846988f, 0.69105649f},
-std::array<float,2>{0.399861723f, 0.884677172f},
-std::array<float,2>{0.9169662f, 0.426195383f},
-std::array<float,2>{0.36930424f, 0.362778187f},
-std::array<float,2>{0.777483463f, 0.789444268f},
-std::array<float,2>{0.229716688f, 0.554369867f},
-std::array<float,2>{0.676633716f, 0.242583111f},
-std::array<float,2>{0.0456482694f, 0.300620466f},
-std::array<float,2>{0.520018399f, 0.873843491f},
-std::array<float,2>{0.44175452f, 0.592149138f},
-std::array<float,2>{0.949785173f, 0.14046739f},
-std::array<float,2>{0.262423486f, 0.0292120669f},
-std::array<float,2>{0.862984478f, 0.683732986f},
-std::array<float,2>{0.129420444f, 0.966483355f},
-std::array<float,2>{0.696632922f, 0.489210486f},
-std::array<float,2>{0.200658679f, 0.194521293f},
-std::array<float,2>{0.647609174f, 0.506685138f},
-std::array<float,2>{0.325941563f, 0.77282697f},
-std::array<float,2>{0.795215666f, 0.341612071f},
-std::array<float,2>{0.418715686f, 0.391833603f},
-std::array<float,2>{0.89867425f, 0.924728274f},
-std::array<float,2>{0.096854955f, 0.745756388f},
-std::array<float,2>{0.594425201f, 0.0848096013f},
-std::array<float,2>{0.123846494f, 0.412095129f},
-std::array<float,2>{0.614202797f, 0.898378909f},
-std::array<float,2>{0.422361106f, 0.712618113f},
-std::array<float,2>{0.878685772f, 0.112345561f},
-std::array<float,2>{0.331873387f, 0.224768177f},
-std::array<float,2>{0.800142646f, 0.531972945f},
-std::array<float,2>{0.210172042f, 0.805698693f},
-std::array<float,2>{0.628946006f, 0.343880802f},
-std::array<float,2>{0.147734955f, 0.0439158417f},
-std::array<float,2>{0.717226565f, 0.64116925f},
-std::array<float,2>{0.278859735f, 0.98214817f},
-std::array<float,2>{0.858842373f, 0.445558578f},
-std::array<float,2>{0.457930058f, 0.280445248f},
-std::array<float,2>{0.962014258f, 0.828462303f},
-std::array<float,2>{0.0493000858f, 0.608389378f},
-std::array<float,2>{0.506844103f, 0.169460371f},
-std::array<float,2>{0.245123908f, 0.323072582f},
-std::array<float,2>{0.658975661f, 0.763730884f},
-std::array<float,2>{0.34858349f, 0.529100299f},
-std::array<float,2>{0.754002512f, 0.216174945f},
-std::array<float,2>{0.386178523f, 0.0628378168f},
-std::array<float,2>{0.928664505f, 0.729277372f},
-std::array<float,2>{0.0907122269f, 0.90834105f},
-std::array<float,2>{0.582498908f, 0.388268292f},
-std::array<float,2>{0.0148090674f, 0.140946046f},
-std::array<float,2>{0.558454216f, 0.56524837f},
-std::array<float,2>{0.482186407f, 0.849575698f},
-std::array<float,2>{0.984864891f, 0.294070154f},
-std::array<float,2>{0.290974766f, 0.482435822f},
-std::array<float,2>{0.834854007f, 0.951147199f},
-std::array<float,2>{0.184791327f, 0.669418514f},
-std::array<float,2>{0.73142314f, 0.00267559825f},
-std::array<float,2>{0.21354124f, 0.3777439f},
-std::array<float,2>{0.636447191f, 0.918988645f},
-std::array<float,2>{0.339143932f, 0.725300133f},
-std::array<float,2>{0.809460938f, 0.0710894763f},
-std::array<float,2>{0.43363452f, 0.210479558f},
-std::array<float,2>{0.884532452f, 0.521035433f},
-std::array<float,2>{0.113681242f, 0.757718682f},
-std::array<float,2>{0.61987865f, 0.317322046f},
-std::array<float,2>{0.0569056943f, 0.008888226f},
-std::array<float,2>{0.511768818f, 0.65740329f},
-std::array<float,2>{0.4629668f, 0.945073426f},
-std::array<float,2>{0.954568148f, 0.470764488f},
-std::array<float,2>{0.271524429f, 0.288159639f},
-std::array<float,2>{0.849461913f, 0.855355918f},
-std::array<float,2>{0.149235278f, 0.574760973f},
-std::array<float,2>{0.708335638f, 0.152963415f},
-std::array<float,2>{0.0826657563f, 0.355747342f},
-std::array<float,2>{0.591998518f, 0.797159672f},
-std::array<float,2>{0.375125706f, 0.543545067f},
-std::array<float,2>{0.936193347f, 0.228940949f},
-std::array<float,2>{0.35621658f, 0.123123832f},
-std::array<float,2>{0.764884293f, 0.704217136f},
-std::array<float,2>{0.241263315f, 0.902801275f},
-std::array<float,2>{0.669003069f, 0.417793036f},
-std::array<float,2>{0.175150692f, 0.15897961f},
-std::array<float,2>{0.722385585f, 0.600129664f},
-std::array<float,2>{0.285392433f, 0.839532197f},
-std::array<float,2>{0.840119898f, 0.268579632f},
-std::array<float,2>{0.475918293f, 0.441244483f},
-std::array<float,2>{0.996904552f, 0.973053157f},
-std::array<float,2>{0.00562657183f, 0.649315238f},
-std::array<float,2>{0.547954202f, 0.0387178101f},
-std::array<float,2>{0.0245165713f, 0.492462844f},
-std::array<float,2>{0.533207536f, 0.959647417f},
-std::array<float,2>{0.489089876f, 0.674990833f},
-std::array<float,2>{0.983686984f, 0.0185032822f},
-std::array<float,2>{0.302705407f, 0.125114143f},
-std::array<float,2>{0.815639138f, 0.582373142f},
-std::array<float,2>{0.160920799f, 0.8662166f},
-std::array<float,2>{0.746735036f, 0.308591098f},
-std::array<float,2>{0.219096899f, 0.0873472616f},
-std::array<float,2>{0.686833501f, 0.738626003f},
-std::array<float,2>{0.360320002f, 0.934443951f},
-std::array<float,2>{0.767892659f, 0.403466851f},
-std::array<float,2>{0.39231202f, 0.33002606f},
-std::array<float,2>{0.909524858f, 0.773964167f},
-std::array<float,2>{0.0674341246f, 0.510734022f},
-std::array<float,2>{0.575828314f, 0.19735159f},
-std::array<float,2>{0.136363864f, 0.265590727f},
-std::array<float,2>{0.689988256f, 0.81687969f},
-std::array<float,2>{0.253218025f, 0.617318273f},
-std::array<float,2>{0.871807575f, 0.181218877f},
-std::array<float,2>{0.449228048f, 0.0614755116f},
-std::array<float,2>{0.94317466f, 0.634627104f},
-std::array<float,2>{0.0334500857f, 0.990569055f},
-std::array<float,2>{0.528255165f, 0.467187464f},
-std::array<float,2>{0.102419823f, 0.240545034f},
-std::array<float,2>{0.608311057f, 0.558815062f},
-std::array<float,2>{0.407944173f, 0.781686544f},
-std::array<float,2>{0.897236288f, 0.37270239f},
-std::array<float,2>{0.317522079f, 0.430410922f},
-std::array<float,2>{0.783629775f, 0.87746644f},
-std::array<float,2>{0.19272463f, 0.697152495f},
-std::array<float,2>{0.652358592f, 0.0968932435f},
-std::array<float,2>{0.178660765f, 0.395933837f},
-std::array<float,2>{0.723076046f, 0.926363707f},
-std::array<float,2>{0.282062382f, 0.749163091f},
-std::array<float,2>{0.839257836f, 0.07965222f},
-std::array<float,2>{0.469469577f, 0.190845951f},
-std::array<float,2>{0.994484544f, 0.503098965f},
-std::array<float,2>{0.0031525942f, 0.765846312f},
-std::array<float,2>{0.552189469f, 0.339666843f},
-std::array<float,2>{0.080280818f, 0.0254478212f},
-std::array<float,2>{0.587586761f, 0.683422506f},
-std::array<float,2>{0.381180346f, 0.964297593f},
-std::array<float,2>{0.931615651f, 0.48563385f},
-std::array<float,2>{0.35207355f, 0.301792055f},
-std::array<float,2>{0.761277616f, 0.868501544f},
-std::array<float,2>{0.237010956f, 0.587940276f},
-std::array<float,2>{0.66753453f, 0.136262774f},
-std::array<float,2>{0.0606781878f, 0.365263462f},
-std::array<float,2>{0.508980215f, 0.796209693f},
-std::array<float,2>{0.46765238f, 0.550254941f},
-std::array<float,2>{0.958764017f, 0.249829799f},
-std::array<float,2>{0.269407362f, 0.103707135f},
-std::array<float,2>{0.84589231f, 0.691478312f},
-std::array<float,2>{0.155128732f, 0.886799693f},
-std::array<float,2>{0.706537426f, 0.421956271f},
-std::array<float,2>{0.217311606f, 0.178996563f},
-std::array<float,2>{0.638680339f, 0.614360631f},
-std::array<float,2>{0.342377961f, 0.826415777f},
-std::array<float,2>{0.804751217f, 0.254529268f},
-std::array<float,2>{0.431886733f, 0.459924161f},
-std::array<float,2>{0.889795303f, 0.994744837f},
-std::array<float,2>{0.110916138f, 0.632458568f},
-std::array<float,2>{0.623004377f, 0.0531330481f},
-std::array<float,2>{0.106921703f, 0.47838214f},
-std::array<float,2>{0.604979753f, 0.946177363f},
-std::array<float,2>{0.412762165f, 0.665682197f},
-std::array<float,2>{0.892985225f, 0.00681363791f},
-std::array<float,2>{0.314378291f, 0.147798643f},
-std::array<float,2>{0.787502825f, 0.568638265f},
-std::array<float,2>{0.19123365f, 0.843880117f},
-std::array<float,2>{0.650433719f, 0.289434969f},
-std::array<float,2>{0.137372181f, 0.0672339499f},
-std::array<float,2>{0.692661047f, 0.732925713f},
-std::array<float,2>{0.255129516f, 0.910719395f},
-std::array<float,2>{0.870221853f, 0.386350304f},
-std::array<float,2>{0.447177172f, 0.325416207f},
-std::array<float,2>{0.940146327f, 0.757923245f},
-std::array<float,2>{0.0388739482f, 0.527034938f},
-std::array<float,2>{0.525405586f, 0.212159142f},
-std::array<float,2>{0.225791335f, 0.275404662f},
-std::array<float,2>{0.681481779f, 0.833407164f},
-std::array<float,2>{0.365017831f, 0.6052109f},
-std::array<float,2>{0.769832492f, 0.166938141f},
-std::array<float,2>{0.395720243f, 0.0391042493f},
-std::array<float,2>{0.912708044f, 0.648145199f},
-std::array<float,2>{0.063048549f, 0.978345215f},
-std::array<float,2>{0.573120534f, 0.452183306f},
-std::array<float,2>{0.0274157654f, 0.221631929f},
-std::array<float,2>{0.538434267f, 0.535763502f},
-std::array<float,2>{0.485142052f, 0.811952055f},
-std::array<float,2>{0.976889074f, 0.348120391f},
-std::array<float,2>{0.298419505f, 0.408827752f},
-std::array<float,2>{0.818057537f, 0.892494917f},
-std::array<float,2>{0.159803882f, 0.71586895f},
-std::array<float,2>{0.743072808f, 0.116890162f},
-std::array<float,2>{0.197379708f, 0.445153445f},
-std::array<float,2>{0.641715825f, 0.969919562f},
-std::array<float,2>{0.322087675f, 0.6553846f},
-std::array<float,2>{0.792262495f, 0.0340681747f},
-std::array<float,2>{0.417252302f, 0.160959542f},
-std::array<float,2>{0.903100252f, 0.593930125f},
-std::array<float,2>{0.0988848731f, 0.841484249f},
-std::array<float,2>{0.599694729f, 0.272787392f},
-std::array<float,2>{0.0413258038f, 0.12039046f},
-std::array<float,2>{0.516363382f, 0.710777402f},
-std::array<float,2>{0.438409984f, 0.899675965f},
-std::array<float,2>{0.945429683f, 0.418543518f},
-std::array<float,2>{0.260771275f, 0.355157822f},
-std::array<float,2>{0.866897702f, 0.804399192f},
-std::array<float,2>{0.128801435f, 0.542464912f},
-std::array<float,2>{0.701439023f, 0.232180938f},
-std::array<float,2>{0.0710430667f, 0.284844339f},
-std::array<float,2>{0.565851331f, 0.858389318f},
-std::array<float,2>{0.402859688f, 0.57240665f},
-std::array<float,2>{0.919896901f, 0.152069017f},
-std::array<float,2>{0.371847481f, 0.012332377f},
-std::array<float,2>{0.776609302f, 0.663993597f},
-std::array<float,2>{0.231352761f, 0.938534975f},
-std::array<float,2>{0.672605932f, 0.473832339f},
-std::array<float,2>{0.169604063f, 0.205767065f},
-std::array<float,2>{0.736272991f, 0.519286156f},
-std::array<float,2>{0.3056961f, 0.750938177f},
-std::array<float,2>{0.825592518f, 0.313609749f},
-std::array<float,2>{0.496198624f, 0.379324049f},
-std::array<float,2>{0.975690901f, 0.916315377f},
-std::array<float,2>{0.0200238638f, 0.721950114f},
-std::array<float,2>{0.540288985f, 0.0747269318f},
-std::array<float,2>{0.00939062238f, 0.433707803f},
-std::array<float,2>{0.562182784f, 0.879157126f},
-std::array<float,2>{0.47947064f, 0.702327132f},
-std::array<float,2>{0.988441288f, 0.0991652384f},
-std::array<float,2>{0.293663353f, 0.237430409f},
-std::array<float,2>{0.830129564f, 0.554984331f},
-std::array<float,2>{0.182297796f, 0.787372172f},
-std::array<float,2>{0.728362083f, 0.36796242f},
-std::array<float,2>{0.246164992f, 0.0580751859f},
-std::array<float,2>{0.661276877f, 0.63801223f},
-std::array<float,2>{0.344570249f, 0.98563242f},
-std::array<float,2>{0.750626147f, 0.463432312f},
-std::array<float,2>{0.389909446f, 0.259906918f},
-std::array<float,2>{0.923914194f, 0.816009581f},
-std::array<float,2>{0.0891761482f, 0.623206794f},
-std::array<float,2>{0.578175783f, 0.18465431f},
-std::array<float,2>{0.143446863f, 0.335936129f},
-std::array<float,2>{0.714660108f, 0.780045152f},
-std::array<float,2>{0.2765944f, 0.514370739f},
-std::array<float,2>{0.854063809f, 0.201887593f},
-std::array<float,2>{0.453399152f, 0.0912181139f},
-std::array<float,2>{0.967047036f, 0.737314284f},
-std::array<float,2>{0.0514510982f, 0.931522608f},
-std::array<float,2>{0.502852321f, 0.401224017f},
-std::array<float,2>{0.119369872f, 0.131817356f},
-std::array<float,2>{0.612499714f, 0.580529213f},
-std::array<float,2>{0.427083254f, 0.860037088f},
-std::array<float,2>{0.879223824f, 0.308948189f},
-std::array<float,2>{0.332325786f, 0.497334182f},
-std::array<float,2>{0.803637207f, 0.953485191f},
-std::array<float,2>{0.205049485f, 0.678102255f},
-std::array<float,2>{0.62745744f, 0.0221392624f},
-std::array<float,2>{0.132707417f, 0.490894854f},
-std::array<float,2>{0.698982835f, 0.967951715f},
-std::array<float,2>{0.265287042f, 0.686522543f},
-std::array<float,2>{0.859981298f, 0.0309241191f},
-std::array<float,2>{0.444594294f, 0.138400286f},
-std::array<float,2>{0.952295899f, 0.589953899f},
-std::array<float,2>{0.0437499471f, 0.871537924f},
-std::array<float,2>{0.522157311f, 0.296979219f},
-std::array<float,2>{0.0939426422f, 0.0826753378f},
-std::array<float,2>{0.596111596f, 0.74403125f},
-std::array<float,2>{0.42182821f, 0.922204018f},
-std::array<float,2>{0.900788903f, 0.393961191f},
-std::array<float,2>{0.327861041f, 0.342055112f},
-std::array<float,2>{0.793387651f, 0.771215498f},
-std::array<float,2>{0.20174183f, 0.505224526f},
-std::array<float,2>{0.645155668f, 0.193154037f},
-std::array<float,2>{0.0165435039f, 0.252738148f},
-std::array<float,2>{0.545028806f, 0.820918143f},
-std::array<float,2>{0.4947097f, 0.61177218f},
-std::array<float,2>{0.97110945f, 0.17316179f},
-std::array<float,2>{0.311527044f, 0.0490614139f},
-std::array<float,2>{0.822695494f, 0.627567887f},
-std::array<float,2>{0.16764994f, 0.998436391f},
-std::array<float,2>{0.740821779f, 0.453482389f},
-std::array<float,2>{0.227100223f, 0.244841531f},
-std::array<float,2>{0.678914905f, 0.552168906f},
-std::array<float,2>{0.367677391f, 0.791950941f},
-std::array<float,2>{0.780466735f, 0.361317039f},
-std::array<float,2>{0.401367605f, 0.428068787f},
-std::array<float,2>{0.914960504f, 0.885443687f},
-std::array<float,2>{0.0778943077f, 0.689159214f},
-std::array<float,2>{0.568125188f, 0.108065918f},
-std::array<float,2>{0.092197448f, 0.389402032f},
-std::array<float,2>{0.58590138f, 0.906592906f},
-std::array<float,2>{0.383831412f, 0.728287101f},
-std::array<float,2>{0.927555561f, 0.0664007366f},
-std::array<float,2>{0.350481212f, 0.218502209f},
-std::array<float,2>{0.756308496f, 0.529464006f},
-std::array<float,2>{0.244045854f, 0.762347043f},
-std::array<float,2>{0.657604992f, 0.320408344f},
-std::array<float,2>{0.186932608f, 0.00167397561f},
-std::array<float,2>{0.733649433f, 0.669931412f},
-std::array<float,2>{0.29157564f, 0.95150429f},
-std::array<float,2>{0.832745612f, 0.480507493f},
-std::array<float,2>{0.483023077f, 0.295007795f},
-std::array<float,2>{0.987226367f, 0.851446331f},
-std::array<float,2>{0.0121611189f, 0.562820017f},
-std::array<float,2>{0.554773688f, 0.144414946f},
-std::array<float,2>{0.207103446f, 0.346542984f},
-std::array<float,2>{0.63172859f, 0.807351768f},
-std::array<float,2>{0.329845607f, 0.533541799f},
-std::array<float,2>{0.797862053f, 0.224065095f},
-std::array<float,2>{0.424414843f, 0.110180616f},
-std::array<float,2>{0.876165271f, 0.713883936f},
-std::array<float,2>{0.122852169f, 0.894853294f},
-std::array<float,2>{0.615415692f, 0.412217826f},
-std::array<float,2>{0.0480479561f, 0.171141058f},
-std::array<float,2>{0.504814804f, 0.606232524f},
-std::array<float,2>{0.460106105f, 0.831876457f},
-std::array<float,2>{0.963275909f, 0.277821004f},
-std::array<float,2>{0.280791342f, 0.448662251f},
-std::array<float,2>{0.856597781f, 0.984121561f},
-std::array<float,2>{0.146415383f, 0.643796206f},
-std::array<float,2>{0.714959681f, 0.045945771f},
-std::array<float,2>{0.240126625f, 0.414529353f},
-std::array<float,2>{0.670233607f, 0.905571938f},
-std::array<float,2>{0.357747823f, 0.706230223f},
-std::array<float,2>{0.761987209f, 0.122414447f},
-std::array<float,2>{0.378146589f, 0.227788776f},
-std::array<float,2>{0.935496509f, 0.546555221f},
-std::array<float,2>{0.0841821134f, 0.799816728f},
-std::array<float,2>{0.590615869f, 0.358176649f},
-std::array<float,2>{0.00737522962f, 0.0355688445f},
-std::array<float,2>{0.548862875f, 0.65086925f},
-std::array<float,2>{0.472977519f, 0.976531863f},
-std::array<float,2>{0.999040544f, 0.438509315f},
-std::array<float,2>{0.287830085f, 0.266666681f},
-std::array<float,2>{0.842720687f, 0.837868273f},
-std::array<float,2>{0.172330588f, 0.599526584f},
-std::array<float,2>{0.71901387f, 0.156473443f},
-std::array<float,2>{0.115522504f, 0.318771213f},
-std::array<float,2>{0.618746102f, 0.75425005f},
-std::array<float,2>{0.435749978f, 0.522551775f},
-std::array<float,2>{0.885382056f, 0.207748801f},
-std::array<float,2>{0.337028027f, 0.0738797262f},
-std::array<float,2>{0.811715245f, 0.723735988f},
-std::array<float,2>{0.21244137f, 0.920174301f},
-std::array<float,2>{0.633485079f, 0.376013488f},
-std::array<float,2>{0.150849774f, 0.155295745f},
-std::array<float,2>{0.709053516f, 0.577689111f},
-std::array<float,2>{0.270754278f, 0.85326153f},
-std::array<float,2>{0.850214303f, 0.285735965f},
-std::array<float,2>{0.461573422f, 0.469777256f},
-std::array<float,2>{0.956029594f, 0.942116559f},
-std::array<float,2>{0.0550985448f, 0.659317434f},
-std::array<float,2>{0.514254034f, 0.0101907849f},
-std::array<float,2>{0.0320998356f, 0.465881109f},
-std::array<float,2>{0.530317783f, 0.989156604f},
-std::array<float,2>{0.451395839f, 0.634778917f},
-std::array<float,2>{0.943362653f, 0.0599900931f},
-std::array<float,2>{0.251713365f, 0.182185173f},
-std::array<float,2>{0.873677909f, 0.619988859f},
-std::array<float,2>{0.133159682f, 0.819324076f},
-std::array<float,2>{0.6876809f, 0.261760235f},
-std::array<float,2>{0.193714663f, 0.0939757004f},
-std::array<float,2>{0.654893517f, 0.698483109f},
-std::array<float,2>{0.319124907f, 0.875710905f},
-std::array<float,2>{0.781743765f, 0.432223678f},
-std::array<float,2>{0.40989843f, 0.373989105f},
-std::array<float,2>{0.896399796f, 0.783436537f},
-std::array<float,2>{0.105442591f, 0.560804963f},
-std::array<float,2>{0.605529249f, 0.239357486f},
-std::array<float,2>{0.162879318f, 0.305139363f},
-std::array<float,2>{0.748182237f, 0.863681018f},
-std::array<float,2>{0.303727329f, 0.585134923f},
-std::array<float,2>{0.8128528f, 0.128620178f},
-std::array<float,2>{0.491029501f, 0.0156874899f},
-std::array<float,2>{0.98057276f, 0.672017336f},
-std::array<float,2>{0.0270787086f, 0.958705783f},
-std::array<float,2>{0.533125937f, 0.494542301f},
-std::array<float,2>{0.0702154785f, 0.196807146f},
-std::array<float,2>{0.577572584f, 0.508471191f},
-std::array<float,2>{0.393959612f, 0.776994407f},
-std::array<float,2>{0.906360269f, 0.332030088f},
-std::array<float,2>{0.361560911f, 0.404889882f},
-std::array<float,2>{0.766892552f, 0.93737942f},
-std::array<float,2>{0.221638486f, 0.742106915f},
-std::array<float,2>{0.684718609f, 0.0892022029f},
-std::array<float,2>{0.130134642f, 0.393722326f},
-std::array<float,2>{0.695899069f, 0.922028005f},
-std::array<float,2>{0.263153493f, 0.743742764f},
-std::array<float,2>{0.862245739f, 0.0828090236f},
-std::array<float,2>{0.443075985f, 0.192938298f},
-std::array<float,2>{0.951151609f, 0.505025029f},
-std::array<float,2>{0.0461070612f, 0.771247089f},
-std::array<float,2>{0.520811796f, 0.342013389f},
-std::array<float,2>{0.0966704637f, 0.0310822148f},
-std::array<float,2>{0.595633328f, 0.686188757f},
-std::array<float,2>{0.419014722f, 0.968075752f},
-std::array<float,2>{0.900092363f, 0.491130888f},
-std::array<float,2>{0.324604422f, 0.297227621f},
-std::array<float,2>{0.796108246f, 0.871211588f},
-std::array<float,2>{0.199727789f, 0.590196967f},
-std::array<float,2>{0.646796167f, 0.138631612f},
-std::array<float,2>{0.0191571973f, 0.360908687f},
-std::array<float,2>{0.544788063f, 0.791660666f},
-std::array<float,2>{0.493666649f, 0.551909864f},
-std::array<float,2>{0.969942272f, 0.245076239f},
-std::array<float,2>{0.30897674f, 0.108282723f},
-std::array<float,2>{0.821409106f, 0.689268172f},
-std::array<float,2>{0.165061638f, 0.885722041f},
-std::array<float,2>{0.739846766f, 0.427899301f},
-std::array<float,2>{0.229072079f, 0.172930166f},
-std::array<float,2>{0.677247941f, 0.611527085f},
-std::array<float,2>{0.370473862f, 0.821284056f},
-std::array<float,2>{0.778902054f, 0.25260514f},
-std::array<float,2>{0.398715556f, 0.4531883f},
-std::array<float,2>{0.917678595f, 0.998272955f},
-std::array<float,2>{0.0751430616f, 0.627862096f},
-std::array<float,2>{0.568710148f, 0.0490953662f},
-std::array<float,2>{0.0915040448f, 0.480883181f},
-std::array<float,2>{0.583295822f, 0.951283276f},
-std::array<float,2>{0.385400057f, 0.670385361f},
-std::array<float,2>{0.928764999f, 0.00187440845f},
-std::array<float,2>{0.348754346f, 0.14406392f},
-std::array<float,2>{0.754956484f, 0.562571645f},
-std::array<float,2>{0.244141951f, 0.851136744f},
-std::array<float,2>{0.65986824f, 0.295408458f},
-std::array<float,2>{0.184250072f, 0.0659390986f},
-std::array<float,2>{0.732321858f, 0.728263617f},
-std::array<float,2>{0.289477915f, 0.906480312f},
-std::array<float,2>{0.835924149f, 0.389576167f},
-std::array<float,2>{0.480931789f, 0.320632994f},
-std::array<float,2>{0.985499382f, 0.76261574f},
-std::array<float,2>{0.0142300259f, 0.529730797f},
-std::array<float,2>{0.557311356f, 0.218654767f},
-std::array<float,2>{0.209529057f, 0.277537853f},
-std::array<float,2>{0.630502999f, 0.831708252f},
-std::array<float,2>{0.330413759f, 0.606084466f},
-std::array<float,2>{0.799707472f, 0.171361551f},
-std::array<float,2>{0.423473984f, 0.0462445691f},
-std::array<float,2>{0.877127647f, 0.643931329f},
-std::array<float,2>{0.124108098f, 0.98424989f},
-std::array<float,2>{0.615091026f, 0.448389083f},
-std::array<float,2>{0.0499665514f, 0.223835185f},
-std::array<float,2>{0.506508768f, 0.533276677f},
-std::array<float,2>{0.45889616f, 0.807477295f},
-std::array<float,2>{0.961774528f, 0.346318513f},
-std::array<float,2>{0.277519703f, 0.412496835f},
-std::array<float,2>{0.857782364f, 0.894774258f},
-std::array<float,2>{0.147215694f, 0.714341462f},
-std::array<float,2>{0.717956364f, 0.109927408f},
-std::array<float,2>{0.241025075f, 0.438922346f},
-std::array<float,2>{0.668570936f, 0.976229727f},
-std::array<float,2>{0.356601715f, 0.650414467f},
-std::array<float,2>{0.764518321f, 0.0352656581f},
-std::array<float,2>{0.376060963f, 0.15673548f},
-std::array<float,2>{0.936796486f, 0.599181235f},
-std::array<float,2>{0.0833776593f, 0.837621093f},
-std::array<float,2>{0.593478382f, 0.267085105f},
-std::array<float,2>{0.00409082789f, 0.122300684f},
-std::array<float,2>{0.547331274f, 0.706527829f},
-std::array<float,2>{0.47543487f, 0.90551132f},
-std::array<float,2>{0.99754864f, 0.41414851f},
-std::array<float,2>{0.286825448f, 0.358090281f},
-std::array<float,2>{0.841778874f, 0.800097108f},
-std::array<float,2>{0.174339652f, 0.546839356f},
-std::array<float,2>{0.721347988f, 0.227659628f},
-std::array<float,2>{0.114951245f, 0.285967767f},
-std::array<float,2>{0.620310485f, 0.853322744f},
-std::array<float,2>{0.435281873f, 0.577925861f},
-std::array<float,2>{0.883162081f, 0.155621931f},
-std::array<float,2>{0.338254213f, 0.00995027646f},
-std::array<float,2>{0.810210764f, 0.659521461f},
-std::array<float,2>{0.214325815f, 0.942334533f},
-std::array<float,2>{0.635202706f, 0.470200092f},
-std::array<float,2>{0.150024086f, 0.20788613f},
-std::array<float,2>{0.707350194f, 0.522892237f},
-std::array<float,2>{0.273332983f, 0.754144609f},
-std::array<float,2>{0.848064482f, 0.318464845f},
-std::array<float,2>{0.464336425f, 0.376339376f},
-std::array<float,2>{0.953580856f, 0.919923186f},
-std::array<float,2>{0.0581396446f, 0.724054039f},
-std::array<float,2>{0.513086498f, 0.0740603581f},
-std::array<float,2>{0.0343420245f, 0.432406813f},
-std::array<float,2>{0.529233277f, 0.875939906f},
-std::array<float,2>{0.450714588f, 0.698581815f},
-std::array<float,2>{0.941809058f, 0.094081223f},
-std::array<float,2>{0.252390534f, 0.239552155f},
-std::array<float,2>{0.872163594f, 0.56068939f},
-std::array<float,2>{0.135426879f, 0.7834934f},
-std::array<float,2>{0.690643609f, 0.373654544f},
-std::array<float,2>{0.192315549f, 0.0596593246f},
-std::array<float,2>{0.653461814f, 0.635202765f},
-std::array<float,2>{0.316779584f, 0.988946438f},
-std::array<float,2>{0.784510851f, 0.466285497f},
-std::array<float,2>{0.406590879f, 0.262063026f},
-std::array<float,2>{0.898021042f, 0.818870962f},
-std::array<float,2>{0.103413001f, 0.619804621f},
-std::array<float,2>{0.608587146f, 0.182443425f},
-std::array<float,2>{0.161261156f, 0.331549644f},
-std::array<float,2>{0.747728527f, 0.77733922f},
-std::array<float,2>{0.301639348f, 0.508623779f},
-std::array<float,2>{0.815241277f, 0.197049454f},
-std::array<float,2>{0.489950269f, 0.0890671387f},
-std::array<float,2>{0.983256757f, 0.741725862f},
-std::array<float,2>{0.0240063425f, 0.937159836f},
-std::array<float,2>{0.535081267f, 0.405209959f},
-std::array<float,2>{0.0668744668f, 0.128681779f},
-std::array<float,2>{0.574279726f, 0.585279465f},
-std::array<float,2>{0.391328216f, 0.863475323f},
-std::array<float,2>{0.90917021f, 0.304879904f},
-std::array<float,2>{0.361214072f, 0.49422586f},
-std::array<float,2>{0.768978357f, 0.958860815f},
-std::array<float,2>{0.22018449f, 0.672320306f},
-std::array<float,2>{0.68603456f, 0.0159888696f},
-std::array<float,2>{0.176528335f, 0.485467702f},
-std::array<float,2>{0.724875152f, 0.963918805f},
-std::array<float,2>{0.283204168f, 0.683158696f},
-std::array<float,2>{0.837254286f, 0.0257480945f},
-std::array<float,2>{0.471098155f, 0.136664808f},
-std::array<float,2>{0.992965221f, 0.588160396f},
-std::array<float,2>{0.000622810272f, 0.868359506f},
-std::array<float,2>{0.553047657f, 0.30205071f},
-std::array<float,2>{0.0798283443f, 0.079929553f},
-std::array<float,2>{0.589080215f, 0.749303699f},
-std::array<float,2>{0.380059391f, 0.92651999f},
-std::array<float,2>{0.932041764f, 0.395610899f},
-std::array<float,2>{0.355064273f, 0.339557618f},
-std::array<float,2>{0.759107411f, 0.765971541f},
-std::array<float,2>{0.235025942f, 0.503333986f},
-std::array<float,2>{0.665883362f, 0.190471664f},
-std::array<float,2>{0.0596737564f, 0.254875511f},
-std::array<float,2>{0.511001527f, 0.826436877f},
-std::array<float,2>{0.465908438f, 0.614736259f},
-std::array<float,2>{0.959137499f, 0.178843394f},
-std::array<float,2>{0.266377926f, 0.0527641922f},
-std::array<float,2>{0.844208956f, 0.632592797f},
-std::array<float,2>{0.153533548f, 0.994967401f},
-std::array<float,2>{0.703183115f, 0.459669918f},
-std::array<float,2>{0.216154337f, 0.24966459f},
-std::array<float,2>{0.637843966f, 0.550037801f},
-std::array<float,2>{0.339847147f, 0.795922875f},
-std::array<float,2>{0.808180869f, 0.365722507f},
-std::array<float,2>{0.430415124f, 0.42220062f},
-std::array<float,2>{0.888180792f, 0.887099028f},
-std::array<float,2>{0.11281205f, 0.69167465f},
-std::array<float,2>{0.624600828f, 0.103784375f},
-std::array<float,2>{0.107757226f, 0.386542499f},
-std::array<float,2>{0.602560282f, 0.911031485f},
-std::array<float,2>{0.410746425f, 0.733282864f},
-std::array<float,2>{0.892154872f, 0.0670782626f},
-std::array<float,2>{0.315200418f, 0.21204491f},
-std::array<float,2>{0.785306334f, 0.52733916f},
-std::array<float,2>{0.18929252f, 0.758214355f},
-std::array<float,2>{0.649048805f, 0.325478882f},
-std::array<float,2>{0.139055014f, 0.00643373327f},
-std::array<float,2>{0.694404066f, 0.66585803f},
-std::array<float,2>{0.256860614f, 0.945804298f},
-std::array<float,2>{0.867321134f, 0.47809267f},
-std::array<float,2>{0.448204935f, 0.289137423f},
-std::array<float,2>{0.937564313f, 0.844054461f},
-std::array<float,2>{0.0360153243f, 0.568432152f},
-std::array<float,2>{0.523905218f, 0.147599742f},
-std::array<float,2>{0.223582342f, 0.347683579f},
-std::array<float,2>{0.682052791f, 0.811529756f},
-std::array<float,2>{0.365551621f, 0.53599453f},
-std::array<float,2>{0.77181685f, 0.221277595f},
-std::array<float,2>{0.398249f, 0.116987482f},
-std::array<float,2>{0.91113019f, 0.716213584f},
-std::array<float,2>{0.0650855079f, 0.892287016f},
-std::array<float,2>{0.571010232f, 0.409038991f},
-std::array<float,2>{0.0295288917f, 0.166546792f},
-std::array<float,2>{0.536414623f, 0.605439603f},
-std::array<float,2>{0.487510175f, 0.833019793f},
-std::array<float,2>{0.978645861f, 0.275718868f},
-std::array<float,2>{0.299040586f, 0.452425718f},
-std::array<float,2>{0.820119917f, 0.978170276f},
-std::array<float,2>{0.156377256f, 0.648392379f},
-std::array<float,2>{0.745482385f, 0.0393074192f},
-std::array<float,2>{0.196306035f, 0.418762922f},
-std::array<float,2>{0.643513262f, 0.899560153f},
-std::array<float,2>{0.323995709f, 0.710459828f},
-std::array<float,2>{0.789482057f, 0.120173633f},
-std::array<float,2>{0.41441983f, 0.232109681f},
-std::array<float,2>{0.905377507f, 0.542222857f},
-std::array<float,2>{0.0998044088f, 0.804494083f},
-std::array<float,2>{0.599452376f, 0.355455905f},
-std::array<float,2>{0.03992524f, 0.0337314196f},
-std::array<float,2>{0.51942575f, 0.65567416f},
-std::array<float,2>{0.440820217f, 0.970133126f},
-std::array<float,2>{0.94831574f, 0.444903165f},
-std::array<float,2>{0.25911054f, 0.272485763f},
-std::array<float,2>{0.863618672f, 0.841716349f},
-std::array<float,2>{0.126173481f, 0.5940575f},
-std::array<float,2>{0.700459659f, 0.16069293f},
-std::array<float,2>{0.0735548362f, 0.313753277f},
-std::array<float,2>{0.562847793f, 0.750512898f},
-std::array<float,2>{0.40504995f, 0.519501686f},
-std::array<float,2>{0.920046568f, 0.205989525f},
-std::array<float,2>{0.374645442f, 0.0749542639f},
-std::array<float,2>{0.774059713f, 0.721723795f},
-std::array<float,2>{0.233187288f, 0.916208446f},
-std::array<float,2>{0.675346434f, 0.378923923f},
-std::array<float,2>{0.170525014f, 0.152338088f},
-std::array<float,2>{0.737617254f, 0.572667062f},
-std::array<float,2>{0.307985574f, 0.858028829f},
-std::array<float,2>{0.828010499f, 0.285039365f},
-std::array<float,2>{0.498651654f, 0.473966539f},
-std::array<float,2>{0.973055959f, 0.938908756f},
-std::array<float,2>{0.0220167749f, 0.663653076f},
-std::array<float,2>{0.542375505f, 0.0125598507f},
-std::array<float,2>{0.0116101112f, 0.463816613f},
-std::array<float,2>{0.559697449f, 0.985513031f},
-std::array<float,2>{0.477101207f, 0.637699783f},
-std::array<float,2>{0.991263807f, 0.0576450378f},
-std::array<float,2>{0.296160251f, 0.184937134f},
-std::array<float,2>{0.828645825f, 0.623362839f},
-std::array<float,2>{0.180060565f, 0.816205084f},
-std::array<float,2>{0.729032695f, 0.260119647f},
-std::array<float,2>{0.24889794f, 0.0993922874f},
-std::array<float,2>{0.662245035f, 0.702431262f},
-std::array<float,2>{0.346324712f, 0.878926754f},
-std::array<float,2>{0.752423465f, 0.433986425f},
-std::array<float,2>{0.388562709f, 0.367744207f},
-std::array<float,2>{0.922581017f, 0.787113607f},
-std::array<float,2>{0.0861182585f, 0.554695606f},
-std::array<float,2>{0.581826389f, 0.237555757f},
-std::array<float,2>{0.141106859f, 0.308823049f},
-std::array<float,2>{0.711099565f, 0.860318899f},
-std::array<float,2>{0.27406165f, 0.58011353f},
-std::array<float,2>{0.851992846f, 0.131382108f},
-std::array<float,2>{0.457028508f, 0.0222713351f},
-std::array<float,2>{0.965809345f, 0.677826524f},
-std::array<float,2>{0.0541732647f, 0.953264654f},
-std::array<float,2>{0.500473917f, 0.497250676f},
-std::array<float,2>{0.11888352f, 0.20196481f},
-std::array<float,2>{0.610158026f, 0.514598787f},
-std::array<float,2>{0.428065658f, 0.77978617f},
-std::array<float,2>{0.88225913f, 0.335523993f},
-std::array<float,2>{0.334246576f, 0.400999278f},
-std::array<float,2>{0.800957143f, 0.931212306f},
-std::array<float,2>{0.205723122f, 0.737647712f},
-std::array<float,2>{0.626481414f, 0.0909618139f},
-std::array<float,2>{0.166656032f, 0.425845325f},
-std::array<float,2>{0.741854787f, 0.884417534f},
-std::array<float,2>{0.311294079f, 0.691317201f},
-std::array<float,2>{0.823673129f, 0.10636384f},
-std::array<float,2>{0.495179981f, 0.242325366f},
-std::array<float,2>{0.971989274f, 0.554627061f},
-std::array<float,2>{0.0174498428f, 0.789183438f},
-std::array<float,2>{0.546658218f, 0.362337083f},
-std::array<float,2>{0.0768845901f, 0.0485317446f},
-std::array<float,2>{0.567206264f, 0.626369596f},
-std::array<float,2>{0.400738031f, 0.997015357f},
-std::array<float,2>{0.915752709f, 0.456583411f},
-std::array<float,2>{0.36830771f, 0.250591934f},
-std::array<float,2>{0.779738426f, 0.823693693f},
-std::array<float,2>{0.228132933f, 0.610763431f},
-std::array<float,2>{0.67814225f, 0.173835322f},
-std::array<float,2>{0.044099085f, 0.341531247f},
-std::array<float,2>{0.522534609f, 0.772638917f},
-std::array<float,2>{0.444171518f, 0.506553948f},
-std::array<float,2>{0.951841593f, 0.194603428f},
-std::array<float,2>{0.264006704f, 0.0846196041f},
-std::array<float,2>{0.861189365f, 0.745932221f},
-std::array<float,2>{0.131085441f, 0.924344242f},
-std::array<float,2>{0.697666407f, 0.392022043f},
-std::array<float,2>{0.202298507f, 0.140234992f},
-std::array<float,2>{0.646190941f, 0.591947615f},
-std::array<float,2>{0.326967001f, 0.873604178f},
-std::array<float,2>{0.794312179f, 0.300409496f},
-std::array<float,2>{0.42078957f, 0.488891095f},
-std::array<float,2>{0.901974857f, 0.966569602f},
-std::array<float,2>{0.0951007381f, 0.683900535f},
-std::array<float,2>{0.597150266f, 0.0290349294f},
-std::array<float,2>{0.121766619f, 0.445469648f},
-std::array<float,2>{0.616362333f, 0.982212007f},
-std::array<float,2>{0.425757438f, 0.6415115f},
-std::array<float,2>{0.875065804f, 0.0436153971f},
-std::array<float,2>{0.329098821f, 0.169746011f},
-std::array<float,2>{0.79693526f, 0.608150005f},
-std::array<float,2>{0.208980262f, 0.828298628f},
-std::array<float,2>{0.63203615f, 0.280562371f},
-std::array<float,2>{0.144986853f, 0.112635911f},
-std::array<float,2>{0.716709971f, 0.712846458f},
-std::array<float,2>{0.279875308f, 0.898022711f},
-std::array<float,2>{0.856329381f, 0.411697924f},
-std::array<float,2>{0.459314615f, 0.344075978f},
-std::array<float,2>{0.964817703f, 0.8060323f},
-std::array<float,2>{0.0473342128f, 0.532208204f},
-std::array<float,2>{0.50540328f, 0.225010157f},
-std::array<float,2>{0.242336437f, 0.294285357f},
-std::array<float,2>{0.656404912f, 0.849294543f},
-std::array<float,2>{0.350726604f, 0.565103889f},
-std::array<float,2>{0.757772386f, 0.140685305f},
-std::array<float,2>{0.383621842f, 0.00274610147f},
-std::array<float,2>{0.926549137f, 0.668990254f},
-std::array<float,2>{0.092784524f, 0.950826168f},
-std::array<float,2>{0.584253311f, 0.482743531f},
-std::array<float,2>{0.0127904722f, 0.216013893f},
-std::array<float,2>{0.55632174f, 0.528886616f},
-std::array<float,2>{0.484319538f, 0.764091432f},
-std::array<float,2>{0.987558663f, 0.322764218f},
-std::array<float,2>{0.292719096f, 0.388529897f},
-std::array<float,2>{0.833159208f, 0.908471763f},
-std::array<float,2>{0.185966581f, 0.729240179f},
-std::array<float,2>{0.73299104f, 0.0626848713f},
-std::array<float,2>{0.211579338f, 0.471091539f},
-std::array<float,2>{0.633904159f, 0.945054889f},
-std::array<float,2>{0.33603099f, 0.657645345f},
-std::array<float,2>{0.811364233f, 0.00917982683f},
-std::array<float,2>{0.437074095f, 0.153245851f},
-std::array<float,2>{0.886294365f, 0.575009882f},
-std::array<float,2>{0.116802193f, 0.855159581f},
-std::array<float,2>{0.617560804f, 0.288521975f},
-std::array<float,2>{0.0564286783f, 0.0708428323f},
-std::array<float,2>{0.515117407f, 0.725558639f},
-std::array<float,2>{0.462593317f, 0.919248641f},
-std::array<float,2>{0.95645988f, 0.377545685f},
-std::array<float,2>{0.270442903f, 0.317112386f},
-std::array<float,2>{0.851153672f, 0.757485449f},
-std::array<float,2>{0.151604474f, 0.521268189f},
-std::array<float,2>{0.710368156f, 0.210716829f},
-std::array<float,2>{0.0851014107f, 0.26898098f},
-std::array<float,2>{0.591632903f, 0.839700997f},
-std::array<float,2>{0.377349794f, 0.600427508f},
-std::array<float,2>{0.934177935f, 0.158890173f},
-std::array<float,2>{0.358749688f, 0.0390200093f},
-std::array<float,2>{0.762922823f, 0.649069369f},
-std::array<float,2>{0.238826573f, 0.972783029f},
-std::array<float,2>{0.671229184f, 0.441029012f},
-std::array<float,2>{0.173575029f, 0.228667706f},
-std::array<float,2>{0.720323324f, 0.543785751f},
-std::array<float,2>{0.288594067f, 0.797011375f},
-std::array<float,2>{0.842912495f, 0.3554717f},
-std::array<float,2>{0.474185973f, 0.417507708f},
-std::array<float,2>{0.998835981f, 0.902386308f},
-std::array<float,2>{0.00627323333f, 0.704534471f},
-std::array<float,2>{0.550266147f, 0.123293549f},
-std::array<float,2>{0.0259520821f, 0.403584123f},
-std::array<float,2>{0.531869531f, 0.934226215f},
-std::array<float,2>{0.491664141f, 0.738390684f},
-std::array<float,2>{0.981515169f, 0.0871121213f},
-std::array<float,2>{0.303002417f, 0.197748795f},
-std::array<float,2>{0.814144135f, 0.51027143f},
-std::array<float,2>{0.163273662f, 0.774305701f},
-std::array<float,2>{0.749866962f, 0.329643965f},
-std::array<float,2>{0.222326785f, 0.0180707313f},
-std::array<float,2>{0.683611095f, 0.675076067f},
-std::array<float,2>{0.363153279f, 0.959954381f},
-std::array<float,2>{0.766575694f, 0.492254138f},
-std::array<float,2>{0.392825991f, 0.308306813f},
-std::array<float,2>{0.907278538f, 0.866639256f},
-std::array<float,2>{0.0685455799f, 0.582141161f},
-std::array<float,2>{0.576372385f, 0.125311732f},
-std::array<float,2>{0.134651214f, 0.372835875f},
-std::array<float,2>{0.688735664f, 0.781451881f},
-std::array<float,2>{0.250380486f, 0.558871984f},
-std::array<float,2>{0.874816418f, 0.240328595f},
-std::array<float,2>{0.452490807f, 0.0971083269f},
-std::array<float,2>{0.945174992f, 0.696897805f},
-std::array<float,2>{0.0330262668f, 0.877869427f},
-std::array<float,2>{0.529738843f, 0.430446148f},
-std::array<float,2>{0.10390573f, 0.181434557f},
-std::array<float,2>{0.607352376f, 0.617449939f},
-std::array<float,2>{0.408450216f, 0.816643894f},
-std::array<float,2>{0.894685268f, 0.265372783f},
-std::array<float,2>{0.320085675f, 0.466944993f},
-std::array<float,2>{0.78228426f, 0.990272522f},
-std::array<float,2>{0.194600567f, 0.634335041f},
-std::array<float,2>{0.655613899f, 0.0611839704f},
-std::array<float,2>{0.155565783f, 0.457180083f},
-std::array<float,2>{0.705465078f, 0.993299425f},
-std::array<float,2>{0.26778692f, 0.62932986f},
-std::array<float,2>{0.847624719f, 0.051138632f},
-std::array<float,2>{0.467885703f, 0.177254021f},
-std::array<float,2>{0.957039952f, 0.616356254f},
-std::array<float,2>{0.0620359629f, 0.824956894f},
-std::array<float,2>{0.508495212f, 0.257584631f},
-std::array<float,2>{0.109933726f, 0.102343597f},
-std::array<float,2>{0.621628881f, 0.694651484f},
-std::array<float,2>{0.433226466f, 0.890454888f},
-std::array<float,2>{0.889332354f, 0.425779015f},
-std::array<float,2>{0.343579561f, 0.364126414f},
-std::array<float,2>{0.806081474f, 0.793524504f},
-std::array<float,2>{0.217991799f, 0.54843384f},
-std::array<float,2>{0.640557408f, 0.246736348f},
-std::array<float,2>{0.00213920511f, 0.303169131f},
-std::array<float,2>{0.551289618f, 0.870737731f},
-std::array<float,2>{0.470088035f, 0.587204218f},
-std::array<float,2>{0.995306551f, 0.134688422f},
-std::array<float,2>{0.283080518f, 0.0242994856f},
-std::array<float,2>{0.838313162f, 0.680561304f},
-std::array<float,2>{0.179494292f, 0.962584555f},
-std::array<float,2>{0.723818243f, 0.487954974f},
-std::array<float,2>{0.237863898f, 0.187727153f},
-std::array<float,2>{0.66616112f, 0.500407755f},
-std::array<float,2>{0.352933943f, 0.76940769f},
-std::array<float,2>{0.760697782f, 0.336617589f},
-std::array<float,2>{0.382355273f, 0.398403227f},
-std::array<float,2>{0.929890633f, 0.928249359f},
-std::array<float,2>{0.0814589486f, 0.746143401f},
-std::array<float,2>{0.586422205f, 0.0815657377f},
-std::array<float,2>{0.0639878958f, 0.407991767f},
-std::array<float,2>{0.573601842f, 0.894324899f},
-std::array<float,2>{0.395130843f, 0.717039943f},
-std::array<float,2>{0.913144946f, 0.114875972f},
-std::array<float,2>{0.363517821f, 0.220145285f},
-std::array<float,2>{0.770587623f, 0.537928641f},
-std::array<float,2>{0.224992394f, 0.808770776f},
-std::array<float,2>{0.680634499f, 0.350562066f},
-std::array<float,2>{0.158276394f, 0.0415670574f},
-std::array<float,2>{0.743186235f, 0.644931138f},
-std::array<float,2>{0.297636032f, 0.978599846f},
-std::array<float,2>{0.817014515f, 0.450066507f},
-std::array<float,2>{0.485949337f, 0.273801923f},
-std::array<float,2>{0.977864742f, 0.835415304f},
-std::array<float,2>{0.0291758813f, 0.602651298f},
-std::array<float,2>{0.537407041f, 0.166013822f},
-std::array<float,2>{0.189723954f, 0.328099191f},
-std::array<float,2>{0.651896238f, 0.761592329f},
-std::array<float,2>{0.312953025f, 0.523843884f},
-std::array<float,2>{0.788794994f, 0.214176759f},
-std::array<float,2>{0.413418531f, 0.0695053563f},
-std::array<float,2>{0.89368403f, 0.73144865f},
-std::array<float,2>{0.106103182f, 0.913751781f},
-std::array<float,2>{0.603742659f, 0.383775622f},
-std::array<float,2>{0.0378921442f, 0.146184608f},
-std::array<float,2>{0.526865542f, 0.568073988f},
-std::array<float,2>{0.445714295f, 0.846601903f},
-std::array<float,2>{0.940551281f, 0.292360574f},
-std::array<float,2>{0.254882246f, 0.478948683f},
-std::array<float,2>{0.86973691f, 0.948569536f},
-std::array<float,2>{0.138129145f, 0.666788161f},
-std::array<float,2>{0.691533148f, 0.00390839344f},
-std::array<float,2>{0.231513873f, 0.38200447f},
-std::array<float,2>{0.673335969f, 0.915094554f},
-std::array<float,2>{0.372725189f, 0.718772769f},
-std::array<float,2>{0.776053011f, 0.0778106153f},
-std::array<float,2>{0.40417403f, 0.204842031f},
-std::array<float,2>{0.918655157f, 0.516532898f},
-std::array<float,2>{0.0719293281f, 0.753040075f},
-std::array<float,2>{0.56506896f, 0.315076441f},
-std::array<float,2>{0.0213338081f, 0.0138777988f},
-std::array<float,2>{0.540023267f, 0.660989881f},
-std::array<float,2>{0.497715861f, 0.940602183f},
-std::array<float,2>{0.974907696f, 0.475788027f},
-std::array<float,2>{0.305141389f, 0.281260371f},
-std::array<float,2>{0.824480653f, 0.85730195f},
-std::array<float,2>{0.167974651f, 0.571676373f},
-std::array<float,2>{0.734451234f, 0.15029645f},
-std::array<float,2>{0.0979164541f, 0.35319823f},
-std::array<float,2>{0.600796998f, 0.800969899f},
-std::array<float,2>{0.416910321f, 0.53931278f},
-std::array<float,2>{0.903403223f, 0.233557403f},
-std::array<float,2>{0.321035087f, 0.118444107f},
-std::array<float,2>{0.791606486f, 0.708708465f},
-std::array<float,2>{0.199085072f, 0.901978314f},
-std::array<float,2>{0.641229153f, 0.421583623f},
-std::array<float,2>{0.12714f, 0.16295822f},
-std::array<float,2>{0.703034997f, 0.596951425f},
-std::array<float,2>{0.260320008f, 0.843020856f},
-std::array<float,2>{0.86619395f, 0.271180511f},
-std::array<float,2>{0.438528001f, 0.44187668f},
-std::array<float,2>{0.94664973f, 0.971596777f},
-std::array<float,2>{0.0425226055f, 0.653626978f},
-std::array<float,2>{0.516711235f, 0.0314677469f},
-std::array<float,2>{0.0524150468f, 0.498351753f},
-std::array<float,2>{0.503190815f, 0.956946135f},
-std::array<float,2>{0.454892397f, 0.676568687f},
-std::array<float,2>{0.968731821f, 0.0211574193f},
-std::array<float,2>{0.275428861f, 0.129501238f},
-std::array<float,2>{0.854930103f, 0.578557849f},
-std::array<float,2>{0.143775672f, 0.861405849f},
-std::array<float,2>{0.71311003f, 0.310569406f},
-std::array<float,2>{0.204036236f, 0.0936777592f},
-std::array<float,2>{0.628228545f, 0.735897601f},
-std::array<float,2>{0.333530217f, 0.933527708f},
-std::array<float,2>{0.804217815f, 0.399186552f},
-std::array<float,2>{0.42586574f, 0.333127409f},
-std::array<float,2>{0.879949212f, 0.778815806f},
-std::array<float,2>{0.120498478f, 0.512634575f},
-std::array<float,2>{0.612234771f, 0.200478896f},
-std::array<float,2>{0.182946444f, 0.259506524f},
-std::array<float,2>{0.727097273f, 0.812878072f},
-std::array<float,2>{0.294710934f, 0.62240243f},
-std::array<float,2>{0.831577659f, 0.186842874f},
-std::array<float,2>{0.480227917f, 0.055742912f},
-std::array<float,2>{0.989986658f, 0.639853895f},
-std::array<float,2>{0.00860174932f, 0.98685199f},
-std::array<float,2>{0.561114132f, 0.462541997f},
-std::array<float,2>{0.0879078507f, 0.235846996f},
-std::array<float,2>{0.579712629f, 0.558032691f},
-std::array<float,2>{0.388874978f, 0.786575198f},
-std::array<float,2>{0.92567122f, 0.370865583f},
-std::array<float,2>{0.345477432f, 0.436130762f},
-std::array<float,2>{0.751744032f, 0.881597996f},
-std::array<float,2>{0.247700766f, 0.700143993f},
-std::array<float,2>{0.660219193f, 0.101121552f},
-std::array<float,2>{0.147968531f, 0.410315007f},
-std::array<float,2>{0.717510223f, 0.896888077f},
-std::array<float,2>{0.278724015f, 0.711091042f},
-std::array<float,2>{0.85910362f, 0.111786313f},
-std::array<float,2>{0.457112014f, 0.226297006f},
-std::array<float,2>{0.962410092f, 0.533008039f},
-std::array<float,2>{0.0495458469f, 0.805516362f},
-std::array<float,2>{0.507505417f, 0.345080495f},
-std::array<float,2>{0.123103052f, 0.0445593446f},
-std::array<float,2>{0.613534987f, 0.642390251f},
-std::array<float,2>{0.42258957f, 0.981102645f},
-std::array<float,2>{0.878163815f, 0.447117418f},
-std::array<float,2>{0.331308097f, 0.279521316f},
-std::array<float,2>{0.800495505f, 0.829516768f},
-std::array<float,2>{0.210628867f, 0.609059572f},
-std::array<float,2>{0.629814386f, 0.16885449f},
-std::array<float,2>{0.0152414963f, 0.323244572f},
-std::array<float,2>{0.557768464f, 0.764752626f},
-std::array<float,2>{0.481931269f, 0.528171659f},
-std::array<float,2>{0.984754026f, 0.215029269f},
-std::array<float,2>{0.290293247f, 0.0644343644f},
-std::array<float,2>{0.834288418f, 0.730180204f},
-std::array<float,2>{0.185497552f, 0.909480512f},
-std::array<float,2>{0.730641484f, 0.386976898f},
-std::array<float,2>{0.245979384f, 0.142504334f},
-std::array<float,2>{0.658330858f, 0.565626264f},
-std::array<float,2>{0.348065913f, 0.848049402f},
-std::array<float,2>{0.754524529f, 0.293038726f},
-std::array<float,2>{0.38630408f, 0.483492672f},
-std::array<float,2>{0.92817682f, 0.949963748f},
-std::array<float,2>{0.0902229697f, 0.668224216f},
-std::array<float,2>{0.582894981f, 0.00369669101f},
-std::array<float,2>{0.0754850358f, 0.455104947f},
-std::array<float,2>{0.56937629f, 0.997332931f},
-std::array<float,2>{0.400204808f, 0.625252545f},
-std::array<float,2>{0.916440904f, 0.0469107963f},
-std::array<float,2>{0.369711757f, 0.175772712f},
-std::array<float,2>{0.778090715f, 0.609584749f},
-std::array<float,2>{0.23032257f, 0.822726071f},
-std::array<float,2>{0.676112592f, 0.251648247f},
-std::array<float,2>{0.164454892f, 0.106557749f},
-std::array<float,2>{0.738767087f, 0.68954128f},
-std::array<float,2>{0.309724301f, 0.883554935f},
-std::array<float,2>{0.821081758f, 0.427333057f},
-std::array<float,2>{0.492856145f, 0.361872435f},
-std::array<float,2>{0.969528675f, 0.790502191f},
-std::array<float,2>{0.0176027995f, 0.552921474f},
-std::array<float,2>{0.543658495f, 0.243577987f},
-std::array<float,2>{0.201089993f, 0.299761117f},
-std::array<float,2>{0.648313224f, 0.87486881f},
-std::array<float,2>{0.325543672f, 0.593014121f},
-std::array<float,2>{0.79575485f, 0.139322028f},
-std::array<float,2>{0.4180215f, 0.0278159585f},
-std::array<float,2>{0.89922744f, 0.685189664f},
-std::array<float,2>{0.097461015f, 0.965083599f},
-std::array<float,2>{0.593818724f, 0.489385158f},
-std::array<float,2>{0.0450658575f, 0.194144517f},
-std::array<float,2>{0.52026248f, 0.506915033f},
-std::array<float,2>{0.442227662f, 0.771809101f},
-std::array<float,2>{0.949626803f, 0.340087324f},
-std::array<float,2>{0.262067348f, 0.391201377f},
-std::array<float,2>{0.862374425f, 0.925111115f},
-std::array<float,2>{0.129123777f, 0.744248688f},
-std::array<float,2>{0.696826637f, 0.0854125991f},
-std::array<float,2>{0.219554424f, 0.493416637f},
-std::array<float,2>{0.687050283f, 0.960166693f},
-std::array<float,2>{0.359414548f, 0.674415767f},
-std::array<float,2>{0.768314958f, 0.0186307859f},
-std::array<float,2>{0.39201811f, 0.126661554f},
-std::array<float,2>{0.910012543f, 0.583174527f},
-std::array<float,2>{0.0679163486f, 0.866131723f},
-std::array<float,2>{0.575397611f, 0.307146013f},
-std::array<float,2>{0.0253040884f, 0.0865426213f},
-std::array<float,2>{0.533760786f, 0.739376307f},
-std::array<float,2>{0.488554806f, 0.934603035f},
-std::array<float,2>{0.983900189f, 0.402681559f},
-std::array<float,2>{0.302025914f, 0.328555733f},
-std::array<float,2>{0.816343248f, 0.774513364f},
-std::array<float,2>{0.160425127f, 0.51077497f},
-std::array<float,2>{0.746539235f, 0.198465109f},
-std::array<float,2>{0.101895303f, 0.264225394f},
-std::array<float,2>{0.607774973f, 0.818141162f},
-std::array<float,2>{0.407680213f, 0.618358076f},
-std::array<float,2>{0.896872759f, 0.180023029f},
-std::array<float,2>{0.318107277f, 0.0623113886f},
-std::array<float,2>{0.783961177f, 0.632911265f},
-std::array<float,2>{0.192909494f, 0.992098212f},
-std::array<float,2>{0.653184891f, 0.467934638f},
-std::array<float,2>{0.136222646f, 0.241813347f},
-std::array<float,2>{0.689788401f, 0.559665918f},
-std::array<float,2>{0.253697902f, 0.782271147f},
-std::array<float,2>{0.871138632f, 0.371567726f},
-std::array<float,2>{0.449966401f, 0.430988342f},
-std::array<float,2>{0.94261086f, 0.878222346f},
-std::array<float,2>{0.0340699255f, 0.69541508f},
-std::array<float,2>{0.527561247f, 0.0959181264f},
-std::array<float,2>{0.0574892201f, 0.378623933f},
-std::array<float,2>{0.512209833f, 0.91799897f},
-std::array<float,2>{0.463863552f, 0.726072729f},
-std::array<float,2>{0.954965115f, 0.0719076246f},
-std::array<float,2>{0.272381008f, 0.209548205f},
-std::array<float,2>{0.848982632f, 0.519725144f},
-std::array<float,2>{0.148663506f, 0.756262898f},
-std::array<float,2>{0.708606243f, 0.317595094f},
-std::array<float,2>{0.212896451f, 0.00842620339f},
-std::array<float,2>{0.636163473f, 0.657170653f},
-std::array<float,2>{0.339627832f, 0.943695068f},
-std::array<float,2>{0.808612704f, 0.472158968f},
-std::array<float,2>{0.434398353f, 0.287453651f},
-std::array<float,2>{0.884219468f, 0.854406536f},
-std::array<float,2>{0.113954954f, 0.575965464f},
-std::array<float,2>{0.619296491f, 0.154138878f},
-std::array<float,2>{0.175419733f, 0.357378453f},
-std::array<float,2>{0.721798599f, 0.798312843f},
-std::array<float,2>{0.285685718f, 0.544313252f},
-std::array<float,2>{0.840622723f, 0.229683757f},
-std::array<float,2>{0.476421684f, 0.124712385f},
-std::array<float,2>{0.996225417f, 0.70314467f},
-std::array<float,2>{0.00523887668f, 0.903647065f},
-std::array<float,2>{0.548626781f, 0.416639924f},
-std::array<float,2>{0.0822464153f, 0.15918304f},
-std::array<float,2>{0.592414021f, 0.601364911f},
-std::array<float,2>{0.375583023f, 0.83872354f},
-std::array<float,2>{0.935865879f, 0.268136591f},
-std::array<float,2>{0.3556602f, 0.439914793f},
-std::array<float,2>{0.765264511f, 0.973987937f},
-std::array<float,2>{0.241945699f, 0.650225818f},
-std::array<float,2>{0.669605494f, 0.0372168832f},
-std::array<float,2>{0.157619089f, 0.450776339f},
-std::array<float,2>{0.744330704f, 0.979979515f},
-std::array<float,2>{0.300421059f, 0.645590782f},
-std::array<float,2>{0.818424881f, 0.0420467257f},
-std::array<float,2>{0.486984819f, 0.164505094f},
-std::array<float,2>{0.979660749f, 0.602279365f},
-std::array<float,2>{0.030636305f, 0.834108472f},
-std::array<float,2>{0.536015511f, 0.275116146f},
-std::array<float,2>{0.0655528903f, 0.113729186f},
-std::array<float,2>{0.571615756f, 0.71814537f},
-std::array<float,2>{0.397399604f, 0.892944336f},
-std::array<float,2>{0.911367357f, 0.406325668f},
-std::array<float,2>{0.366546273f, 0.351384401f},
-std::array<float,2>{0.772784114f, 0.809784353f},
-std::array<float,2>{0.224494696f, 0.53882575f},
-std::array<float,2>{0.682815015f, 0.219661519f},
-std::array<float,2>{0.0364985168f, 0.29142043f},
-std::array<float,2>{0.524500072f, 0.847621441f},
-std::array<float,2>{0.449177593f, 0.566460431f},
-std::array<float,2>{0.938882113f, 0.144696027f},
-std::array<float,2>{0.256255627f, 0.00535701914f},
-std::array<float,2>{0.868961871f, 0.667223155f},
-std::array<float,2>{0.139755398f, 0.947493792f},
-std::array<float,2>{0.693600416f, 0.480443865f},
-std::array<float,2>{0.187665895f, 0.213604927f},
-std::array<float,2>{0.649538517f, 0.524912953f},
-std::array<float,2>{0.316334188f, 0.760552287f},
-std::array<float,2>{0.786961317f, 0.326620579f},
-std::array<float,2>{0.411679149f, 0.384309381f},
-std::array<float,2>{0.890880764f, 0.912320435f},
-std::array<float,2>{0.109188385f, 0.731089413f},
-std::array<float,2>{0.602212548f, 0.0686655715f},
-std::array<float,2>{0.112190343f, 0.424558491f},
-std::array<float,2>{0.623223543f, 0.888934731f},
-std::array<float,2>{0.430927157f, 0.693453252f},
-std::array<float,2>{0.887389421f, 0.102970324f},
-std::array<float,2>{0.341643244f, 0.248013452f},
-std::array<float,2>{0.807542682f, 0.547848344f},
-std::array<float,2>{0.215198755f, 0.794809699f},
-std::array<float,2>{0.637482107f, 0.364891976f},
-std::array<float,2>{0.152738824f, 0.0522845052f},
-std::array<float,2>{0.704254985f, 0.630602717f},
-std::array<float,2>{0.267056227f, 0.992822587f},
-std::array<float,2>{0.844844341f, 0.458803624f},
-std::array<float,2>{0.465679139f, 0.256684989f},
-std::array<float,2>{0.960099638f, 0.82598573f},
-std::array<float,2>{0.0588462129f, 0.616005898f},
-std::array<float,2>{0.510364592f, 0.176745966f},
-std::array<float,2>{0.235457182f, 0.337379396f},
-std::array<float,2>{0.664271593f, 0.767914951f},
-std::array<float,2>{0.353555053f, 0.501809239f},
-std::array<float,2>{0.758209884f, 0.189212605f},
-std::array<float,2>{0.379703462f, 0.0805255547f},
-std::array<float,2>{0.932728469f, 0.747809112f},
-std::array<float,2>{0.0786228254f, 0.929114521f},
-std::array<float,2>{0.588498294f, 0.397103041f},
-std::array<float,2>{0.00153114425f, 0.133237824f},
-std::array<float,2>{0.554286242f, 0.586271048f},
-std::array<float,2>{0.472440034f, 0.869797409f},
-std::array<float,2>{0.994041681f, 0.303991944f},
-std::array<float,2>{0.284267694f, 0.486376673f},
-std::array<float,2>{0.836157441f, 0.961625159f},
-std::array<float,2>{0.177633226f, 0.681247711f},
-std::array<float,2>{0.726553321f, 0.0253462028f},
-std::array<float,2>{0.206479058f, 0.399459392f},
-std::array<float,2>{0.625241458f, 0.9323349f},
-std::array<float,2>{0.335041821f, 0.735057235f},
-std::array<float,2>{0.801912606f, 0.0927144065f},
-std::array<float,2>{0.428970605f, 0.199796736f},
-std::array<float,2>{0.881149948f, 0.513551116f},
-std::array<float,2>{0.117461383f, 0.777700484f},
-std::array<float,2>{0.610916495f, 0.332485557f},
-std::array<float,2>{0.0529177561f, 0.0200105514f},
-std::array<float,2>{0.501121521f, 0.677486777f},
-std::array<float,2>{0.455855817f, 0.955505371f},
-std::array<float,2>{0.966046631f, 0.499050111f},
-std::array<float,2>{0.275268406f, 0.312326729f},
-std::array<float,2>{0.853320003f, 0.862452686f},
-std::array<float,2>{0.14225857f, 0.579367697f},
-std::array<float,2>{0.711920679f, 0.130515054f},
-std::array<float,2>{0.0874646828f, 0.369939744f},
-std::array<float,2>{0.580845714f, 0.78548032f},
-std::array<float,2>{0.387523532f, 0.557418823f},
-std::array<float,2>{0.923577428f, 0.23510316f},
-std::array<float,2>{0.346728623f, 0.100259617f},
-std::array<float,2>{0.753123581f, 0.700515389f},
-std::array<float,2>{0.249205858f, 0.881961703f},
-std::array<float,2>{0.663879335f, 0.437305838f},
-std::array<float,2>{0.181018382f, 0.186162472f},
-std::array<float,2>{0.729732156f, 0.621712565f},
-std::array<float,2>{0.295606852f, 0.814451873f},
-std::array<float,2>{0.829325974f, 0.258035511f},
-std::array<float,2>{0.478474528f, 0.461803108f},
-std::array<float,2>{0.990746975f, 0.987713873f},
-std::array<float,2>{0.0103212027f, 0.639111102f},
-std::array<float,2>{0.559350431f, 0.0550663769f},
-std::array<float,2>{0.0232029837f, 0.475534648f},
-std::array<float,2>{0.541397154f, 0.939651251f},
-std::array<float,2>{0.499649882f, 0.661328435f},
-std::array<float,2>{0.973866761f, 0.0154810091f},
-std::array<float,2>{0.307000905f, 0.148835927f},
-std::array<float,2>{0.826512337f, 0.570985019f},
-std::array<float,2>{0.171676815f, 0.855674505f},
-std::array<float,2>{0.7364586f, 0.282237947f},
-std::array<float,2>{0.234255433f, 0.0765974447f},
-std::array<float,2>{0.67436552f, 0.720584095f},
-std::array<float,2>{0.373226285f, 0.914290249f},
-std::array<float,2>{0.775127053f, 0.381033152f},
-std::array<float,2>{0.405315667f, 0.316022038f},
-std::array<float,2>{0.921099842f, 0.752601683f},
-std::array<float,2>{0.0725401416f, 0.517245948f},
-std::array<float,2>{0.564048767f, 0.203458652f},
-std::array<float,2>{0.125658408f, 0.269727975f},
-std::array<float,2>{0.699573994f, 0.842081845f},
-std::array<float,2>{0.258113414f, 0.59627527f},
-std::array<float,2>{0.864842772f, 0.163771287f},
-std::array<float,2>{0.440048188f, 0.03276572f},
-std::array<float,2>{0.948096812f, 0.652489543f},
-std::array<float,2>{0.0409460068f, 0.972488642f},
-std::array<float,2>{0.518496513f, 0.443067998f},
-std::array<float,2>{0.101306148f, 0.23273018f},
-std::array<float,2>{0.597747922f, 0.540703297f},
-std::array<float,2>{0.415065676f, 0.802594006f},
-std::array<float,2>{0.904950023f, 0.351968527f},
-std::array<float,2>{0.323051959f, 0.420669466f},
-std::array<float,2>{0.790851235f, 0.901025355f},
-std::array<float,2>{0.195352748f, 0.707689881f},
-std::array<float,2>{0.643571556f, 0.117562249f},
-std::array<float,2>{0.187189996f, 0.390395463f},
-std::array<float,2>{0.733895719f, 0.907253981f},
-std::array<float,2>{0.291162491f, 0.727169156f},
-std::array<float,2>{0.832478285f, 0.0654243305f},
-std::array<float,2>{0.482736558f, 0.217346281f},
-std::array<float,2>{0.986624122f, 0.531137168f},
-std::array<float,2>{0.0122533869f, 0.763383269f},
-std::array<float,2>{0.555624306f, 0.321893603f},
-std::array<float,2>{0.0925058499f, 0.00070818176f},
-std::array<float,2>{0.585412085f, 0.671409845f},
-std::array<float,2>{0.384694666f, 0.952275217f},
-std::array<float,2>{0.927167416f, 0.481776088f},
-std::array<float,2>{0.349719703f, 0.29650709f},
-std::array<float,2>{0.756750643f, 0.849612653f},
-std::array<float,2>{0.243535727f, 0.563872397f},
-std::array<float,2>{0.657813966f, 0.143026471f},
-std::array<float,2>{0.048600629f, 0.346705079f},
-std::array<float,2>{0.503974199f, 0.808485985f},
-std::array<float,2>{0.460749596f, 0.53469044f},
-std::array<float,2>{0.963654518f, 0.223459393f},
-std::array<float,2>{0.280574381f, 0.110518739f},
-std::array<float,2>{0.856979132f, 0.712915599f},
-std::array<float,2>{0.145918831f, 0.896254003f},
-std::array<float,2>{0.715636909f, 0.413330913f},
-std::array<float,2>{0.207986996f, 0.17023249f},
-std::array<float,2>{0.631079435f, 0.606997967f},
-std::array<float,2>{0.329542458f, 0.830874145f},
-std::array<float,2>{0.798823416f, 0.278987795f},
-std::array<float,2>{0.423833072f, 0.448218822f},
-std::array<float,2>{0.876743674f, 0.98324132f},
-std::array<float,2>{0.122076683f, 0.642636061f},
-std::array<float,2>{0.615944564f, 0.0454588681f},
-std::array<float,2>{0.0943226963f, 0.492006272f},
-std::array<float,2>{0.596446574f, 0.967646897f},
-std::array<float,2>{0.421213627f, 0.686876833f},
-std::array<float,2>{0.901087403f, 0.0297103915f},
-std::array<float,2>{0.327349782f, 0.137263209f},
-std::array<float,2>{0.793494463f, 0.59173739f},
-std::array<float,2>{0.20118697f, 0.872194648f},
-std::array<float,2>{0.644925535f, 0.297922045f},
-std::array<float,2>{0.131972089f, 0.0830345601f},
-std::array<float,2>{0.698562562f, 0.74291116f},
-std::array<float,2>{0.26485461f, 0.923066497f},
-std::array<float,2>{0.8597157f, 0.393080711f},
-std::array<float,2>{0.445162445f, 0.343600363f},
-std::array<float,2>{0.953103662f, 0.770109713f},
-std::array<float,2>{0.042985376f, 0.504372418f},
-std::array<float,2>{0.521796346f, 0.191810086f},
-std::array<float,2>{0.226796687f, 0.253121555f},
-std::array<float,2>{0.679562211f, 0.82143122f},
-std::array<float,2>{0.367307365f, 0.613110781f},
-std::array<float,2>{0.780893326f, 0.172167823f},
-std::array<float,2>{0.402147651f, 0.0500724912f},
-std::array<float,2>{0.914530218f, 0.628805339f},
-std::array<float,2>{0.0773796886f, 0.999708652f},
-std::array<float,2>{0.56784898f, 0.454983175f},
-std::array<float,2>{0.0158654694f, 0.245687813f},
-std::array<float,2>{0.545507491f, 0.551650107f},
-std::array<float,2>{0.494594127f, 0.792674363f},
-std::array<float,2>{0.971482575f, 0.36005941f},
-std::array<float,2>{0.31242165f, 0.428723633f},
-std::array<float,2>{0.82289511f, 0.886165023f},
-std::array<float,2>{0.16745235f, 0.688100219f},
-std::array<float,2>{0.740635693f, 0.108627088f},
-std::array<float,2>{0.193928376f, 0.465584904f},
-std::array<float,2>{0.654382288f, 0.989944637f},
-std::array<float,2>{0.318640292f, 0.63644892f},
-std::array<float,2>{0.781716168f, 0.0589487515f},
-std::array<float,2>{0.40943104f, 0.183390096f},
-std::array<float,2>{0.895983636f, 0.620690048f},
-std::array<float,2>{0.104875632f, 0.81978178f},
-std::array<float,2>{0.606188416f, 0.263176113f},
-std::array<float,2>{0.0315560363f, 0.0949208066f},
-std::array<float,2>{0.530910075f, 0.697512567f},
-std::array<float,2>{0.451869696f, 0.876052082f},
-std::array<float,2>{0.943878949f, 0.433105499f},
-std::array<float,2>{0.251236498f, 0.374729723f},
-std::array<float,2>{0.873075366f, 0.78435123f},
-std::array<float,2>{0.133364484f, 0.562195539f},
-std::array<float,2>{0.688087165f, 0.238350421f},
-std::array<float,2>{0.0694173276f, 0.306619287f},
-std::array<float,2>{0.577852488f, 0.864581347f},
-std::array<float,2>{0.394388765f, 0.584196806f},
-std::array<float,2>{0.907011151f, 0.127170458f},
-std::array<float,2>{0.362274289f, 0.0168495085f},
-std::array<float,2>{0.767477036f, 0.673208773f},
-std::array<float,2>{0.221151084f, 0.957783103f},
-std::array<float,2>{0.685067713f, 0.496049702f},
-std::array<float,2>{0.162387401f, 0.196153075f},
-std::array<float,2>{0.74890238f, 0.509079754f},
-std::array<float,2>{0.304277956f, 0.77596426f},
-std::array<float,2>{0.81331718f, 0.330456346f},
-std::array<float,2>{0.490709871f, 0.405399621f},
-std::array<float,2>{0.981422544f, 0.935947299f},
-std::array<float,2>{0.0267565195f, 0.740612149f},
-std::array<float,2>{0.532684982f, 0.0884640589f},
-std::array<float,2>{0.00705550332f, 0.415407777f},
-std::array<float,2>{0.549360037f, 0.904802859f},
-std::array<float,2>{0.473555297f, 0.705115259f},
-std::array<float,2>{0.99984479f, 0.121521428f},
-std::array<float,2>{0.287493199f, 0.22681196f},
-std::array<float,2>{0.842243493f, 0.545596302f},
-std::array<float,2>{0.172535554f, 0.799243689f},
-std::array<float,2>{0.719335079f, 0.359193057f},
-std::array<float,2>{0.239270031f, 0.036468938f},
-std::array<float,2>{0.670528829f, 0.651755512f},
-std::array<float,2>{0.35833326f, 0.974968314f},
-std::array<float,2>{0.762301266f, 0.437618554f},
-std::array<float,2>{0.378572524f, 0.265992373f},
-std::array<float,2>{0.935021996f, 0.836782396f},
-std::array<float,2>{0.0848003179f, 0.597837627f},
-std::array<float,2>{0.589930177f, 0.158003286f},
-std::array<float,2>{0.150936082f, 0.320159167f},
-std::array<float,2>{0.709533453f, 0.75514698f},
-std::array<float,2>{0.271261483f, 0.521983027f},
-std::array<float,2>{0.849818289f, 0.208444506f},
-std::array<float,2>{0.461322367f, 0.0727851093f},
-std::array<float,2>{0.955497682f, 0.723236561f},
-std::array<float,2>{0.0552288257f, 0.921732962f},
-std::array<float,2>{0.514011681f, 0.375750273f},
-std::array<float,2>{0.116124772f, 0.154695764f},
-std::array<float,2>{0.618619978f, 0.576483369f},
-std::array<float,2>{0.436283171f, 0.851975799f},
-std::array<float,2>{0.885166764f, 0.286621094f},
-std::array<float,2>{0.337521851f, 0.469287038f},
-std::array<float,2>{0.812357783f, 0.94327718f},
-std::array<float,2>{0.211961523f, 0.658980608f},
-std::array<float,2>{0.63295126f, 0.0115702264f},
-std::array<float,2>{0.13711907f, 0.476565659f},
-std::array<float,2>{0.693335176f, 0.946580172f},
-std::array<float,2>{0.255576462f, 0.664918959f},
-std::array<float,2>{0.870760977f, 0.00740610389f},
-std::array<float,2>{0.446628004f, 0.147158667f},
-std::array<float,2>{0.939578474f, 0.570250332f},
-std::array<float,2>{0.0383115932f, 0.845579922f},
-std::array<float,2>{0.526185036f, 0.290671289f},
-std::array<float,2>{0.10722515f, 0.0679027736f},
-std::array<float,2>{0.605202973f, 0.734084249f},
-std::array<float,2>{0.412216216f, 0.911860764f},
-std::array<float,2>{0.89335531f, 0.385489762f},
-std::array<float,2>{0.313814223f, 0.324885666f},
-std::array<float,2>{0.787990987f, 0.758932948f},
-std::array<float,2>{0.190679312f, 0.525752842f},
-std::array<float,2>{0.651032686f, 0.211160943f},
-std::array<float,2>{0.0279321074f, 0.277325273f},
-std::array<float,2>{0.538735628f, 0.832524955f},
-std::array<float,2>{0.484751105f, 0.603580594f},
-std::array<float,2>{0.97740078f, 0.167234361f},
-std::array<float,2>{0.298287302f, 0.0403317735f},
-std::array<float,2>{0.817614019f, 0.646813631f},
-std::array<float,2>{0.159335434f, 0.976949334f},
-std::array<float,2>{0.742345452f, 0.451912731f},
-std::array<float,2>{0.226511911f, 0.222063377f},
-std::array<float,2>{0.680941343f, 0.536203802f},
-std::array<float,2>{0.364440233f, 0.811225176f},
-std::array<float,2>{0.770113289f, 0.349538982f},
-std::array<float,2>{0.396001399f, 0.409699559f},
-std::array<float,2>{0.912198782f, 0.891451955f},
-std::array<float,2>{0.0629643947f, 0.715730429f},
-std::array<float,2>{0.572464705f, 0.115316734f},
-std::array<float,2>{0.0807099864f, 0.395192295f},
-std::array<float,2>{0.586923838f, 0.92685461f},
-std::array<float,2>{0.381825387f, 0.74900949f},
-std::array<float,2>{0.930925548f, 0.0782584548f},
-std::array<float,2>{0.35164836f, 0.189849496f},
-std::array<float,2>{0.760858119f, 0.502693295f},
-std::array<float,2>{0.236559525f, 0.766936183f},
-std::array<float,2>{0.667002738f, 0.338648707f},
-std::array<float,2>{0.178185865f, 0.0265951436f},
-std::array<float,2>{0.723498642f, 0.681866288f},
-std::array<float,2>{0.281641573f, 0.963597298f},
-std::array<float,2>{0.839373171f, 0.484789997f},
-std::array<float,2>{0.469047755f, 0.301116884f},
-std::array<float,2>{0.994953752f, 0.867938757f},
-std::array<float,2>{0.00342147774f, 0.589654028f},
-std::array<float,2>{0.552672625f, 0.135126978f},
-std::array<float,2>{0.216823608f, 0.367123455f},
-std::array<float,2>{0.639644325f, 0.794950902f},
-std::array<float,2>{0.342045814f, 0.549521387f},
-std::array<float,2>{0.805552483f, 0.248451054f},
-std::array<float,2>{0.432235301f, 0.105395593f},
-std::array<float,2>{0.890428364f, 0.692805052f},
-std::array<float,2>{0.110514045f, 0.888644397f},
-std::array<float,2>{0.622268021f, 0.423086166f},
-std::array<float,2>{0.0612720773f, 0.178554088f},
-std::array<float,2>{0.509303093f, 0.613823473f},
-std::array<float,2>{0.466830969f, 0.827430964f},
-std::array<float,2>{0.958182871f, 0.255415231f},
-std::array<float,2>{0.268719375f, 0.460099876f},
-std::array<float,2>{0.846499205f, 0.996046245f},
-std::array<float,2>{0.154418871f, 0.631191194f},
-std::array<float,2>{0.706738293f, 0.0537584275f},
-std::array<float,2>{0.246971935f, 0.435252726f},
-std::array<float,2>{0.661812961f, 0.880246162f},
-std::array<float,2>{0.344004184f, 0.70120573f},
-std::array<float,2>{0.750172317f, 0.0977358744f},
-std::array<float,2>{0.390455097f, 0.23721768f},
-std::array<float,2>{0.924779177f, 0.55592972f},
-std::array<float,2>{0.0896370709f, 0.788384557f},
-std::array<float,2>{0.578957617f, 0.36838311f},
-std::array<float,2>{0.00886093453f, 0.0566705875f},
-std::array<float,2>{0.561735392f, 0.636935532f},
-std::array<float,2>{0.47875762f, 0.984415174f},
-std::array<float,2>{0.988883972f, 0.464481264f},
-std::array<float,2>{0.293357521f, 0.261439711f},
-std::array<float,2>{0.830860138f, 0.815264463f},
-std::array<float,2>{0.181717619f, 0.624179482f},
-std::array<float,2>{0.727836668f, 0.183930784f},
-std::array<float,2>{0.119776949f, 0.334722579f},
-std::array<float,2>{0.612815738f, 0.780585349f},
-std::array<float,2>{0.427433699f, 0.514905572f},
-std::array<float,2>{0.879396737f, 0.202191308f},
-std::array<float,2>{0.3328453f, 0.0905753225f},
-std::array<float,2>{0.803093553f, 0.737304628f},
-std::array<float,2>{0.204240099f, 0.930101812f},
-std::array<float,2>{0.627147913f, 0.401933938f},
-std::array<float,2>{0.143055975f, 0.132049665f},
-std::array<float,2>{0.714313805f, 0.581896901f},
-std::array<float,2>{0.277186185f, 0.860527933f},
-std::array<float,2>{0.853589535f, 0.31032452f},
-std::array<float,2>{0.453876942f, 0.496587396f},
-std::array<float,2>{0.967376649f, 0.954833388f},
-std::array<float,2>{0.0511954129f, 0.679238617f},
-std::array<float,2>{0.502234638f, 0.023152329f},
-std::array<float,2>{0.0416398831f, 0.443953544f},
-std::array<float,2>{0.515677691f, 0.969142616f},
-std::array<float,2>{0.437617809f, 0.654854059f},
-std::array<float,2>{0.946029425f, 0.0348765887f},
-std::array<float,2>{0.261683851f, 0.161513299f},
-std::array<float,2>{0.866212606f, 0.595181584f},
-std::array<float,2>{0.128399909f, 0.840451956f},
-std::array<float,2>{0.702076256f, 0.272083968f},
-std::array<float,2>{0.198051453f, 0.119545259f},
-std::array<float,2>{0.642203033f, 0.709515274f},
-std::array<float,2>{0.32135421f, 0.899394691f},
-std::array<float,2>{0.792607188f, 0.419668078f},
-std::array<float,2>{0.417637795f, 0.353536487f},
-std::array<float,2>{0.902528763f, 0.803646147f},
-std::array<float,2>{0.0993433893f, 0.541593492f},
-std::array<float,2>{0.60018903f, 0.230961457f},
-std::array<float,2>{0.169344559f, 0.28400436f},
-std::array<float,2>{0.735661805f, 0.858564794f},
-std::array<float,2>{0.306281954f, 0.573609233f},
-std::array<float,2>{0.825737715f, 0.150664583f},
-std::array<float,2>{0.496657848f, 0.013548933f},
-std::array<float,2>{0.976367295f, 0.662109613f},
-std::array<float,2>{0.0198077112f, 0.937777579f},
-std::array<float,2>{0.540705323f, 0.473502666f},
-std::array<float,2>{0.0704532862f, 0.206113651f},
-std::array<float,2>{0.566210449f, 0.518266976f},
-std::array<float,2>{0.402624577f, 0.75169456f},
-std::array<float,2>{0.919300079f, 0.312697887f},
-std::array<float,2>{0.371252745f, 0.379971087f},
-std::array<float,2>{0.776959062f, 0.917431355f},
-std::array<float,2>{0.230505541f, 0.721102059f},
-std::array<float,2>{0.67212069f, 0.0757038444f},
-std::array<float,2>{0.14894636f, 0.375071496f},
-std::array<float,2>{0.708040178f, 0.921124041f},
-std::array<float,2>{0.271732271f, 0.722709835f},
-std::array<float,2>{0.849302411f, 0.0723299906f},
-std::array<float,2>{0.463219434f, 0.208878472f},
-std::array<float,2>{0.954297006f, 0.521631777f},
-std::array<float,2>{0.0567044243f, 0.755690455f},
-std::array<float,2>{0.512151897f, 0.319478214f},
-std::array<float,2>{0.113393694f, 0.0111604109f},
-std::array<float,2>{0.619841576f, 0.658554494f},
-std::array<float,2>{0.433894366f, 0.942642391f},
-std::array<float,2>{0.884394586f, 0.468997747f},
-std::array<float,2>{0.339028686f, 0.286656708f},
-std::array<float,2>{0.809267282f, 0.85226351f},
-std::array<float,2>{0.213699266f, 0.576918244f},
-std::array<float,2>{0.636648774f, 0.154876694f},
-std::array<float,2>{0.00548539683f, 0.358472139f},
-std::array<float,2>{0.548110783f, 0.799767792f},
-std::array<float,2>{0.475828618f, 0.544983506f},
-std::array<float,2>{0.996695399f, 0.227414966f},
-std::array<float,2>{0.285597473f, 0.121791057f},
-std::array<float,2>{0.83984983f, 0.705654025f},
-std::array<float,2>{0.174945265f, 0.904485464f},
-std::array<float,2>{0.722617686f, 0.415761769f},
-std::array<float,2>{0.241682649f, 0.157357603f},
-std::array<float,2>{0.669351518f, 0.598297715f},
-std::array<float,2>{0.356200129f, 0.836131692f},
-std::array<float,2>{0.76509577f, 0.266204387f},
-std::array<float,2>{0.375427485f, 0.438421249f},
-std::array<float,2>{0.936509907f, 0.975279152f},
-std::array<float,2>{0.083007358f, 0.65192908f},
-std::array<float,2>{0.592117131f, 0.0368577391f},
-std::array<float,2>{0.0677475855f, 0.495356023f},
-std::array<float,2>{0.576160789f, 0.957242608f},
-std::array<float,2>{0.392527819f, 0.673820615f},
-std::array<float,2>{0.909305573f, 0.0173366945f},
-std::array<float,2>{0.359891057f, 0.127650574f},
-std::array<float,2>{0.767722368f, 0.584665716f},
-std::array<float,2>{0.21886003f, 0.864785314f},
-std::array<float,2>{0.686677516f, 0.305887371f},
-std::array<float,2>{0.160886064f, 0.0880034566f},
-std::array<float,2>{0.74683851f, 0.740736246f},
-std::array<float,2>{0.302338183f, 0.936112702f},
-std::array<float,2>{0.815855861f, 0.406084001f},
-std::array<float,2>{0.488820791f, 0.330902815f},
-std::array<float,2>{0.983607471f, 0.7756055f},
-std::array<float,2>{0.024759464f, 0.509605408f},
-std::array<float,2>{0.53363651f, 0.195487827f},
-std::array<float,2>{0.192575708f, 0.26364094f},
-std::array<float,2>{0.652691245f, 0.81995976f},
-std::array<float,2>{0.317845851f, 0.620240867f},
-std::array<float,2>{0.783271372f, 0.18306917f},
-std::array<float,2>{0.407972157f, 0.0591927134f},
-std::array<float,2>{0.897137284f, 0.635977149f},
-std::array<float,2>{0.102236792f, 0.989305198f},
-std::array<float,2>{0.607979774f, 0.46525532f},
-std::array<float,2>{0.0333568864f, 0.238987193f},
-std::array<float,2>{0.528065503f, 0.561908841f},
-std::array<float,2>{0.449466944f, 0.784700274f},
-std::array<float,2>{0.94306016f, 0.374038845f},
-std::array<float,2>{0.253109276f, 0.4330329f},
-std::array<float,2>{0.871971786f, 0.876775384f},
-std::array<float,2>{0.136483967f, 0.69792515f},
-std::array<float,2>{0.690284014f, 0.0954238847f},
-std::array<float,2>{0.229774207f, 0.454132944f},
-std::array<float,2>{0.676362514f, 0.999123573f},
-std::array<float,2>{0.36951974f, 0.62802726f},
-std::array<float,2>{0.777677357f, 0.0504128188f},
-std::array<float,2>{0.399473161f, 0.172429845f},
-std::array<float,2>{0.916538715f, 0.612424135f},
-std::array<float,2>{0.0757601634f, 0.822175503f},
-std::array<float,2>{0.570292532f, 0.253704071f},
-std::array<float,2>{0.0182555709f, 0.109273002f},
-std::array<float,2>{0.543199778f, 0.687811017f},
-std::array<float,2>{0.492276758f, 0.886330187f},
-std::array<float,2>{0.968988657f, 0.42952615f},
-std::array<float,2>{0.310539097f, 0.35939905f},
-std::array<float,2>{0.820414662f, 0.792120576f},
-std::array<float,2>{0.164807767f, 0.551075697f},
-std::array<float,2>{0.73924768f, 0.245178089f},
-std::array<float,2>{0.0971159264f, 0.29862991f},
-std::array<float,2>{0.594598889f, 0.872862399f},
-std::array<float,2>{0.41846168f, 0.590822279f},
-std::array<float,2>{0.898801744f, 0.136896625f},
-std::array<float,2>{0.325874329f, 0.0300600659f},
-std::array<float,2>{0.795115471f, 0.687046409f},
-std::array<float,2>{0.20031251f, 0.967017353f},
-std::array<float,2>{0.647718728f, 0.491365194f},
-std::array<float,2>{0.129697338f, 0.191939309f},
-std::array<float,2>{0.696311355f, 0.504394531f},
-std::array<float,2>{0.262485147f, 0.769795001f},
-std::array<float,2>{0.863048732f, 0.342844307f},
-std::array<float,2>{0.4415254f, 0.39288494f},
-std::array<float,2>{0.950100005f, 0.9238258f},
-std::array<float,2>{0.0458257608f, 0.742598772f},
-std::array<float,2>{0.519737005f, 0.0835320652f},
-std::array<float,2>{0.048841998f, 0.413984388f},
-std::array<float,2>{0.507111311f, 0.89596802f},
-std::array<float,2>{0.457568496f, 0.71380651f},
-std::array<float,2>{0.96235168f, 0.111133665f},
-std::array<float,2>{0.27914837f, 0.2231199f},
-std::array<float,2>{0.858492076f, 0.534530044f},
-std::array<float,2>{0.147471786f, 0.80788821f},
-std::array<float,2>{0.716863871f, 0.347617149f},
-std::array<float,2>{0.210284218f, 0.0449627861f},
-std::array<float,2>{0.629159689f, 0.643393099f},
-std::array<float,2>{0.331761837f, 0.982795656f},
-std::array<float,2>{0.799849212f, 0.44746986f},
-std::array<float,2>{0.42188254f, 0.278577566f},
-std::array<float,2>{0.878467083f, 0.830347002f},
-std::array<float,2>{0.123601764f, 0.606669843f},
-std::array<float,2>{0.614010334f, 0.170839369f},
-std::array<float,2>{0.185058251f, 0.321314305f},
-std::array<float,2>{0.731170297f, 0.762712419f},
-std::array<float,2>{0.290530443f, 0.530569196f},
-std::array<float,2>{0.834682107f, 0.217023998f},
-std::array<float,2>{0.482041538f, 0.0646145418f},
-std::array<float,2>{0.985239863f, 0.727034867f},
-std::array<float,2>{0.0151279755f, 0.907853305f},
-std::array<float,2>{0.55817014f, 0.38986671f},
-std::array<float,2>{0.0905593932f, 0.143136203f},
-std::array<float,2>{0.582239747f, 0.564074814f},
-std::array<float,2>{0.385941178f, 0.850438833f},
-std::array<float,2>{0.92834115f, 0.295968294f},
-std::array<float,2>{0.348202348f, 0.48210907f},
-std::array<float,2>{0.754186094f, 0.95290184f},
-std::array<float,2>{0.245401695f, 0.670905411f},
-std::array<float,2>{0.658775806f, 0.000255324354f},
-std::array<float,2>{0.171171919f, 0.472821027f},
-std::array<float,2>{0.737144053f, 0.938331306f},
-std::array<float,2>{0.307359636f, 0.662673771f},
-std::array<float,2>{0.826981366f, 0.0130563555f},
-std::array<float,2>{0.49911204f, 0.151294157f},
-std::array<float,2>{0.974540234f, 0.573838115f},
-std::array<float,2>{0.0229180735f, 0.859030485f},
-std::array<float,2>{0.541710317f, 0.283643067f},
-std::array<float,2>{0.0729188621f, 0.075477615f},
-std::array<float,2>{0.563495576f, 0.721556187f},
-std::array<float,2>{0.40587768f, 0.917883039f},
-std::array<float,2>{0.921504974f, 0.380456448f},
-std::array<float,2>{0.373795122f, 0.313085377f},
-std::array<float,2>{0.774852693f, 0.751461208f},
-std::array<float,2>{0.23365134f, 0.51797843f},
-std::array<float,2>{0.67388624f, 0.206593454f},
-std::array<float,2>{0.0405266248f, 0.271718204f},
-std::array<float,2>{0.517936766f, 0.839848638f},
-std::array<float,2>{0.439778894f, 0.595454454f},
-std::array<float,2>{0.947286546f, 0.162063837f},
-std::array<float,2>{0.258407027f, 0.0341798291f},
-std::array<float,2>{0.864371121f, 0.65429765f},
-std::array<float,2>{0.125286698f, 0.969374776f},
-std::array<float,2>{0.699947834f, 0.443647444f},
-std::array<float,2>{0.19610332f, 0.230911747f},
-std::array<float,2>{0.644414306f, 0.541201174f},
-std::array<float,2>{0.322724193f, 0.802793741f},
-std::array<float,2>{0.790325165f, 0.354307353f},
-std::array<float,2>{0.415736467f, 0.419117391f},
-std::array<float,2>{0.904459715f, 0.898789287f},
-std::array<float,2>{0.10088589f, 0.709018946f},
-std::array<float,2>{0.598145068f, 0.119891427f},
-std::array<float,2>{0.118117414f, 0.401832283f},
-std::array<float,2>{0.610651195f, 0.930301189f},
-std::array<float,2>{0.42944029f, 0.736612022f},
-std::array<float,2>{0.881834924f, 0.0900462046f},
-std::array<float,2>{0.335475653f, 0.203089535f},
-std::array<float,2>{0.802382529f, 0.515216887f},
-std::array<float,2>{0.206822231f, 0.781074405f},
-std::array<float,2>{0.625624239f, 0.334337473f},
-std::array<float,2>{0.141630679f, 0.0225702375f},
-std::array<float,2>{0.712597668f, 0.678722799f},
-std::array<float,2>{0.274435014f, 0.954588115f},
-std::array<float,2>{0.852752507f, 0.496162385f},
-std::array<float,2>{0.455273926f, 0.309864014f},
-std::array<float,2>{0.966591477f, 0.86112994f},
-std::array<float,2>{0.053472355f, 0.581198573f},
-std::array<float,2>{0.501612842f, 0.132591024f},
-std::array<float,2>{0.249740258f, 0.368886888f},
-std::array<float,2>{0.663300872f, 0.788836718f},
-std::array<float,2>{0.347198516f, 0.556296706f},
-std::array<float,2>{0.753819644f, 0.236611858f},
-std::array<float,2>{0.386999607f, 0.0984953642f},
-std::array<float,2>{0.923105121f, 0.701949477f},
-std::array<float,2>{0.087319009f, 0.880524457f},
-std::array<float,2>{0.580211818f, 0.434835762f},
-std::array<float,2>{0.0101751667f, 0.184496582f},
-std::array<float,2>{0.558763742f, 0.624724507f},
-std::array<float,2>{0.477574408f, 0.814840913f},
-std::array<float,2>{0.990708411f, 0.261119634f},
-std::array<float,2>{0.29514274f, 0.464151174f},
-std::array<float,2>{0.829766393f, 0.98510462f},
-std::array<float,2>{0.181423128f, 0.63749969f},
-std::array<float,2>{0.730083823f, 0.0572571903f},
-std::array<float,2>{0.215752035f, 0.423518807f},
-std::array<float,2>{0.637070537f, 0.888014853f},
-std::array<float,2>{0.340932578f, 0.693143964f},
-std::array<float,2>{0.807115018f, 0.104690067f},
-std::array<float,2>{0.431487769f, 0.248740658f},
-std::array<float,2>{0.887063861f, 0.548899353f},
-std::array<float,2>{0.11160212f, 0.795530915f},
-std::array<float,2>{0.623808324f, 0.366559327f},
-std::array<float,2>{0.0591670796f, 0.0544129163f},
-std::array<float,2>{0.50983727f, 0.631615758f},
-std::array<float,2>{0.465105623f, 0.995500267f},
-std::array<float,2>{0.960791588f, 0.460713416f},
-std::array<float,2>{0.267430842f, 0.255010039f},
-std::array<float,2>{0.845527172f, 0.82791692f},
-std::array<float,2>{0.153103083f, 0.613328755f},
-std::array<float,2>{0.704811335f, 0.1782085f},
-std::array<float,2>{0.0783262178f, 0.337935537f},
-std::array<float,2>{0.588365853f, 0.767278433f},
-std::array<float,2>{0.379034758f, 0.502007067f},
-std::array<float,2>{0.933105767f, 0.190072417f},
-std::array<float,2>{0.35402891f, 0.0790270045f},
-std::array<float,2>{0.7587291f, 0.748309731f},
-std::array<float,2>{0.236030445f, 0.92761457f},
-std::array<float,2>{0.664710999f, 0.39481172f},
-std::array<float,2>{0.17701146f, 0.135558724f},
-std::array<float,2>{0.726021707f, 0.588870466f},
-std::array<float,2>{0.285137296f, 0.867466092f},
-std::array<float,2>{0.836742163f, 0.301558763f},
-std::array<float,2>{0.472089589f, 0.484948158f},
-std::array<float,2>{0.993258715f, 0.962923408f},
-std::array<float,2>{0.00125691481f, 0.682251096f},
-std::array<float,2>{0.554024041f, 0.0270638335f},
-std::array<float,2>{0.0311383903f, 0.451171964f},
-std::array<float,2>{0.535410941f, 0.977144957f},
-std::array<float,2>{0.486790746f, 0.64731729f},
-std::array<float,2>{0.980326593f, 0.0405486226f},
-std::array<float,2>{0.299865127f, 0.16793707f},
-std::array<float,2>{0.818900347f, 0.604339957f},
-std::array<float,2>{0.158037826f, 0.832259417f},
-std::array<float,2>{0.74483496f, 0.276540965f},
-std::array<float,2>{0.223898113f, 0.115829438f},
-std::array<float,2>{0.683400393f, 0.715137482f},
-std::array<float,2>{0.367011636f, 0.890782058f},
-std::array<float,2>{0.773091197f, 0.409180075f},
-std::array<float,2>{0.396651119f, 0.348847538f},
-std::array<float,2>{0.911775947f, 0.810993373f},
-std::array<float,2>{0.0659203306f, 0.536851645f},
-std::array<float,2>{0.571896851f, 0.222436994f},
-std::array<float,2>{0.140547082f, 0.29040435f},
-std::array<float,2>{0.694164455f, 0.845049262f},
-std::array<float,2>{0.25655061f, 0.569670439f},
-std::array<float,2>{0.86823982f, 0.146618649f},
-std::array<float,2>{0.448588818f, 0.00692406017f},
-std::array<float,2>{0.939202011f, 0.664273083f},
-std::array<float,2>{0.0367090479f, 0.94711858f},
-std::array<float,2>{0.525072515f, 0.477219909f},
-std::array<float,2>{0.108804777f, 0.211714983f},
-std::array<float,2>{0.601883233f, 0.526073873f},
-std::array<float,2>{0.411318988f, 0.759471059f},
-std::array<float,2>{0.891570389f, 0.324354708f},
-std::array<float,2>{0.315793842f, 0.385077029f},
-std::array<float,2>{0.786234319f, 0.911326885f},
-std::array<float,2>{0.188411951f, 0.733612299f},
-std::array<float,2>{0.650250614f, 0.0678307638f},
-std::array<float,2>{0.171919465f, 0.416257709f},
-std::array<float,2>{0.718831182f, 0.903815329f},
-std::array<float,2>{0.288017243f, 0.703956008f},
-std::array<float,2>{0.842364609f, 0.124160655f},
-std::array<float,2>{0.472686857f, 0.230251282f},
-std::array<float,2>{0.999509692f, 0.544616163f},
-std::array<float,2>{0.00763165485f, 0.798517108f},
-std::array<float,2>{0.549124539f, 0.356607676f},
-std::array<float,2>{0.0843553767f, 0.0380068421f},
-std::array<float,2>{0.590365052f, 0.649841249f},
-std::array<float,2>{0.378178298f, 0.974303722f},
-std::array<float,2>{0.93525368f, 0.440200239f},
-std::array<float,2>{0.357465744f, 0.268007606f},
-std::array<float,2>{0.761800349f, 0.838260531f},
-std::array<float,2>{0.23996383f, 0.600694478f},
-std::array<float,2>{0.670144081f, 0.159724221f},
-std::array<float,2>{0.0547555611f, 0.318228662f},
-std::array<float,2>{0.514517248f, 0.756662667f},
-std::array<float,2>{0.461897016f, 0.520055771f},
-std::array<float,2>{0.955642283f, 0.209148556f},
-std::array<float,2>{0.270654887f, 0.0713276863f},
-std::array<float,2>{0.850472152f, 0.726459384f},
-std::array<float,2>{0.150439233f, 0.918688595f},
-std::array<float,2>{0.709240973f, 0.378112853f},
-std::array<float,2>{0.212830976f, 0.153720379f},
-std::array<float,2>{0.633600533f, 0.575229764f},
-std::array<float,2>{0.337207645f, 0.853997946f},
-std::array<float,2>{0.811808348f, 0.288046241f},
-std::array<float,2>{0.436027437f, 0.472367644f},
-std::array<float,2>{0.885577381f, 0.944069564f},
-std::array<float,2>{0.115391873f, 0.656432629f},
-std::array<float,2>{0.619033813f, 0.0082231313f},
-std::array<float,2>{0.105064362f, 0.468497336f},
-std::array<float,2>{0.605879426f, 0.991526067f},
-std::array<float,2>{0.409998566f, 0.633502483f},
-std::array<float,2>{0.89611721f, 0.0615510829f},
-std::array<float,2>{0.318904668f, 0.180381685f},
-std::array<float,2>{0.78222549f, 0.61880219f},
-std::array<float,2>{0.193410814f, 0.817831755f},
-std::array<float,2>{0.655066729f, 0.263863236f},
-std::array<float,2>{0.133044347f, 0.0966532901f},
-std::array<float,2>{0.687842906f, 0.696026027f},
-std::array<float,2>{0.251604557f, 0.878708661f},
-std::array<float,2>{0.873902082f, 0.431219786f},
-std::array<float,2>{0.451565206f, 0.371666729f},
-std::array<float,2>{0.943773448f, 0.782892168f},
-std::array<float,2>{0.0318467543f, 0.560397625f},
-std::array<float,2>{0.530636311f, 0.24127689f},
-std::array<float,2>{0.221340552f, 0.306698591f},
-std::array<float,2>{0.684974611f, 0.865643799f},
-std::array<float,2>{0.361749619f, 0.583781004f},
-std::array<float,2>{0.766717732f, 0.126298696f},
-std::array<float,2>{0.393613964f, 0.0190437511f},
-std::array<float,2>{0.906514943f, 0.674266815f},
-std::array<float,2>{0.070058465f, 0.960657239f},
-std::array<float,2>{0.577252269f, 0.493875414f},
-std::array<float,2>{0.0271982923f, 0.199016839f},
-std::array<float,2>{0.532776177f, 0.511449456f},
-std::array<float,2>{0.490950048f, 0.775291026f},
-std::array<float,2>{0.980776787f, 0.328958005f},
-std::array<float,2>{0.303955227f, 0.402929485f},
-std::array<float,2>{0.812617481f, 0.935348034f},
-std::array<float,2>{0.16261901f, 0.740072131f},
-std::array<float,2>{0.748371482f, 0.0860501006f},
-std::array<float,2>{0.201952815f, 0.48988533f},
-std::array<float,2>{0.645331442f, 0.965679049f},
-std::array<float,2>{0.327887535f, 0.684786856f},
-std::array<float,2>{0.793177605f, 0.0279302802f},
-std::array<float,2>{0.421628654f, 0.138966963f},
-std::array<float,2>{0.90057075f, 0.593550742f},
-std::array<float,2>{0.0941973999f, 0.874133945f},
-std::array<float,2>{0.595857739f, 0.29891783f},
-std::array<float,2>{0.043612469f, 0.0858492479f},
-std::array<float,2>{0.522448123f, 0.744886577f},
-std::array<float,2>{0.44450435f, 0.925302386f},
-std::array<float,2>{0.952575326f, 0.390925854f},
-std::array<float,2>{0.265509725f, 0.340515673f},
-std::array<float,2>{0.860238373f, 0.772117674f},
-std::array<float,2>{0.132373989f, 0.507399797f},
-std::array<float,2>{0.698818386f, 0.193844736f},
-std::array<float,2>{0.0778643116f, 0.251081377f},
-std::array<float,2>{0.567973316f, 0.822755337f},
-std::array<float,2>{0.401819229f, 0.61029774f},
-std::array<float,2>{0.914705694f, 0.17516315f},
-std::array<float,2>{0.368123025f, 0.0477200933f},
-std::array<float,2>{0.780636847f, 0.625843048f},
-std::array<float,2>{0.227471277f, 0.997800469f},
-std::array<float,2>{0.679196775f, 0.455786794f},
-std::array<float,2>{0.167773485f, 0.243989334f},
-std::array<float,2>{0.741092086f, 0.553486884f},
-std::array<float,2>{0.311769903f, 0.790944755f},
-std::array<float,2>{0.822275639f, 0.361451685f},
-std::array<float,2>{0.494948059f, 0.427211583f},
-std::array<float,2>{0.970802665f, 0.883051097f},
-std::array<float,2>{0.0162569545f, 0.690357983f},
-std::array<float,2>{0.545188665f, 0.106984198f},
-std::array<float,2>{0.0118323499f, 0.387231439f},
-std::array<float,2>{0.554997385f, 0.910104573f},
-std::array<float,2>{0.483365476f, 0.729858756f},
-std::array<float,2>{0.986914694f, 0.0639446527f},
-std::array<float,2>{0.291785657f, 0.215597212f},
-std::array<float,2>{0.832874358f, 0.527717292f},
-std::array<float,2>{0.186731681f, 0.765442133f},
-std::array<float,2>{0.73361522f, 0.323742867f},
-std::array<float,2>{0.243812099f, 0.00302979932f},
-std::array<float,2>{0.657272816f, 0.668631911f},
-std::array<float,2>{0.350320309f, 0.949242294f},
-std::array<float,2>{0.755986392f, 0.484241843f},
-std::array<float,2>{0.384266049f, 0.293788314f},
-std::array<float,2>{0.927268386f, 0.848617792f},
-std::array<float,2>{0.0920017138f, 0.566280961f},
-std::array<float,2>{0.585607231f, 0.141791046f},
-std::array<float,2>{0.146229982f, 0.345424414f},
-std::array<float,2>{0.715272725f, 0.80478543f},
-std::array<float,2>{0.281226605f, 0.532289147f},
-std::array<float,2>{0.85670048f, 0.225828767f},
-std::array<float,2>{0.460384339f, 0.111916505f},
-std::array<float,2>{0.962903917f, 0.711572111f},
-std::array<float,2>{0.0481908843f, 0.897093236f},
-std::array<float,2>{0.504517317f, 0.411008686f},
-std::array<float,2>{0.12260294f, 0.168389022f},
-std::array<float,2>{0.615586758f, 0.608667016f},
-std::array<float,2>{0.424788922f, 0.829857588f},
-std::array<float,2>{0.876408756f, 0.279851228f},
-std::array<float,2>{0.329797357f, 0.446723461f},
-std::array<float,2>{0.798159242f, 0.980793834f},
-std::array<float,2>{0.207431421f, 0.641682446f},
-std::array<float,2>{0.631507576f, 0.0443471074f},
-std::array<float,2>{0.128659174f, 0.442557573f},
-std::array<float,2>{0.701335967f, 0.971957207f},
-std::array<float,2>{0.261098772f, 0.652881145f},
-std::array<float,2>{0.867014647f, 0.0323394462f},
-std::array<float,2>{0.438157022f, 0.16333127f},
-std::array<float,2>{0.945722401f, 0.596169114f},
-std::array<float,2>{0.0410194993f, 0.842432857f},
-std::array<float,2>{0.516190112f, 0.270115703f},
-std::array<float,2>{0.0988316834f, 0.117917895f},
-std::array<float,2>{0.600009382f, 0.707043231f},
-std::array<float,2>{0.417088807f, 0.90051806f},
-std::array<float,2>{0.903051436f, 0.420398533f},
-std::array<float,2>{0.321781844f, 0.35234794f},
-std::array<float,2>{0.792041481f, 0.80185622f},
-std::array<float,2>{0.197694868f, 0.540348709f},
-std::array<float,2>{0.641866088f, 0.232995048f},
-std::array<float,2>{0.0203870647f, 0.282837749f},
-std::array<float,2>{0.540078342f, 0.856299937f},
-std::array<float,2>{0.496398211f, 0.570424974f},
-std::array<float,2>{0.976073265f, 0.148940086f},
-std::array<float,2>{0.306091696f, 0.0147787835f},
-std::array<float,2>{0.825285852f, 0.661740899f},
-std::array<float,2>{0.169738322f, 0.940143883f},
-std::array<float,2>{0.736033022f, 0.474767238f},
-std::array<float,2>{0.231113315f, 0.203662917f},
-std::array<float,2>{0.672815144f, 0.516646683f},
-std::array<float,2>{0.371743947f, 0.75226742f},
-std::array<float,2>{0.776664555f, 0.31552124f},
-std::array<float,2>{0.403306633f, 0.381775409f},
-std::array<float,2>{0.91954726f, 0.914687812f},
-std::array<float,2>{0.0712185577f, 0.720150769f},
-std::array<float,2>{0.565512359f, 0.076818563f},
-std::array<float,2>{0.0889542922f, 0.436562628f},
-std::array<float,2>{0.578442514f, 0.882790208f},
-std::array<float,2>{0.38987118f, 0.70079875f},
-std::array<float,2>{0.924073577f, 0.0997121483f},
-std::array<float,2>{0.344261318f, 0.234540403f},
-std::array<float,2>{0.750880837f, 0.556909502f},
-std::array<float,2>{0.246432394f, 0.786035538f},
-std::array<float,2>{0.661421537f, 0.369177312f},
-std::array<float,2>{0.182403088f, 0.0554738753f},
-std::array<float,2>{0.728133082f, 0.639397085f},
-std::array<float,2>{0.293871373f, 0.987842739f},
-std::array<float,2>{0.830424607f, 0.461362749f},
-std::array<float,2>{0.479107171f, 0.258466929f},
-std::array<float,2>{0.988610327f, 0.813645244f},
-std::array<float,2>{0.00965255126f, 0.621238172f},
-std::array<float,2>{0.562359214f, 0.185668647f},
-std::array<float,2>{0.204738483f, 0.332673609f},
-std::array<float,2>{0.627842307f, 0.778211892f},
-std::array<float,2>{0.332253188f, 0.512854874f},
-std::array<float,2>{0.803328574f, 0.199574754f},
-std::array<float,2>{0.426862329f, 0.0918544158f},
-std::array<float,2>{0.878971159f, 0.734693885f},
-std::array<float,2>{0.119459957f, 0.932064891f},
-std::array<float,2>{0.61256063f, 0.400128871f},
-std::array<float,2>{0.0515355691f, 0.129969358f},
-std::array<float,2>{0.502471745f, 0.579765856f},
-std::array<float,2>{0.453315794f, 0.863175333f},
-std::array<float,2>{0.96686542f, 0.311923593f},
-std::array<float,2>{0.276745677f, 0.499799579f},
-std::array<float,2>{0.854353786f, 0.95573622f},
-std::array<float,2>{0.143221274f, 0.676903069f},
-std::array<float,2>{0.714386225f, 0.0203225315f},
-std::array<float,2>{0.237114564f, 0.396526277f},
-std::array<float,2>{0.667817593f, 0.929529369f},
-std::array<float,2>{0.352429271f, 0.747370124f},
-std::array<float,2>{0.761624575f, 0.0806474313f},
-std::array<float,2>{0.380952179f, 0.188800082f},
-std::array<float,2>{0.931371808f, 0.501083791f},
-std::array<float,2>{0.0803691521f, 0.768321276f},
-std::array<float,2>{0.587758899f, 0.337846935f},
-std::array<float,2>{0.00341636408f, 0.0246875882f},
-std::array<float,2>{0.551778555f, 0.680791378f},
-std::array<float,2>{0.469704151f, 0.961098611f},
-std::array<float,2>{0.994165421f, 0.487260103f},
-std::array<float,2>{0.281952381f, 0.304273516f},
-std::array<float,2>{0.839052618f, 0.869548321f},
-std::array<float,2>{0.178441942f, 0.586911798f},
-std::array<float,2>{0.72282964f, 0.133639947f},
-std::array<float,2>{0.111298867f, 0.364260077f},
-std::array<float,2>{0.622790337f, 0.79440093f},
-std::array<float,2>{0.431766778f, 0.547202289f},
-std::array<float,2>{0.88991493f, 0.247360542f},
-std::array<float,2>{0.342671067f, 0.103468366f},
-std::array<float,2>{0.805070758f, 0.694048464f},
-std::array<float,2>{0.217632741f, 0.889320433f},
-std::array<float,2>{0.638965905f, 0.424158722f},
-std::array<float,2>{0.154853284f, 0.176104531f},
-std::array<float,2>{0.706138611f, 0.615590572f},
-std::array<float,2>{0.269105703f, 0.825468659f},
-std::array<float,2>{0.846057236f, 0.256315768f},
-std::array<float,2>{0.467333645f, 0.458323777f},
-std::array<float,2>{0.95860517f, 0.992429316f},
-std::array<float,2>{0.0609491132f, 0.629929841f},
-std::array<float,2>{0.509193897f, 0.0521402992f},
-std::array<float,2>{0.0387451686f, 0.479521364f},
-std::array<float,2>{0.525668025f, 0.948019564f},
-std::array<float,2>{0.446986556f, 0.667587459f},
-std::array<float,2>{0.940209866f, 0.00574360648f},
-std::array<float,2>{0.254914969f, 0.145386517f},
-std::array<float,2>{0.870468378f, 0.567043006f},
-std::array<float,2>{0.137618333f, 0.846706808f},
-std::array<float,2>{0.692396939f, 0.291647822f},
-std::array<float,2>{0.191118702f, 0.0692550093f},
-std::array<float,2>{0.650695801f, 0.730806768f},
-std::array<float,2>{0.314123154f, 0.912791252f},
-std::array<float,2>{0.78734374f, 0.384247273f},
-std::array<float,2>{0.412950397f, 0.327094913f},
-std::array<float,2>{0.892766774f, 0.759883702f},
-std::array<float,2>{0.106610224f, 0.524795949f},
-std::array<float,2>{0.604636192f, 0.212968051f},
-std::array<float,2>{0.16009663f, 0.274824947f},
-std::array<float,2>{0.742899537f, 0.834660828f},
-std::array<float,2>{0.298807561f, 0.601956904f},
-std::array<float,2>{0.818261385f, 0.164647445f},
-std::array<float,2>{0.485019594f, 0.0426101238f},
-std::array<float,2>{0.976805866f, 0.646350801f},
-std::array<float,2>{0.0276986361f, 0.980387092f},
-std::array<float,2>{0.538197935f, 0.450613648f},
-std::array<float,2>{0.0634290352f, 0.219140008f},
-std::array<float,2>{0.572857022f, 0.538430333f},
-std::array<float,2>{0.395774692f, 0.810075939f},
-std::array<float,2>{0.912885129f, 0.350639492f},
-std::array<float,2>{0.364977896f, 0.406857491f},
-std::array<float,2>{0.769772351f, 0.89338547f},
-std::array<float,2>{0.22593312f, 0.718310118f},
-std::array<float,2>{0.681253374f, 0.113798067f},
-std::array<float,2>{0.135094672f, 0.430130541f},
-std::array<float,2>{0.691371024f, 0.877184331f},
-std::array<float,2>{0.25257796f, 0.696447372f},
-std::array<float,2>{0.872700214f, 0.0974735692f},
-std::array<float,2>{0.450226009f, 0.240898788f},
-std::array<float,2>{0.942247629f, 0.55947113f},
-std::array<float,2>{0.0347166695f, 0.781877935f},
-std::array<float,2>{0.528634012f, 0.372079432f},
-std::array<float,2>{0.102620706f, 0.0607594699f},
-std::array<float,2>{0.609080613f, 0.634237885f},
-std::array<float,2>{0.406753927f, 0.99082303f},
-std::array<float,2>{0.897645473f, 0.467618585f},
-std::array<float,2>{0.317327768f, 0.264998674f},
-std::array<float,2>{0.78495115f, 0.817106843f},
-std::array<float,2>{0.191630244f, 0.617690563f},
-std::array<float,2>{0.653980851f, 0.181071565f},
-std::array<float,2>{0.0235607047f, 0.32925117f},
-std::array<float,2>{0.534277678f, 0.773733318f},
-std::array<float,2>{0.489393204f, 0.509814739f},
-std::array<float,2>{0.98273629f, 0.198066965f},
-std::array<float,2>{0.301113456f, 0.0878119394f},
-std::array<float,2>{0.81482923f, 0.738988876f},
-std::array<float,2>{0.162043527f, 0.933850527f},
-std::array<float,2>{0.747398436f, 0.404196858f},
-std::array<float,2>{0.220317259f, 0.125816271f},
-std::array<float,2>{0.686131358f, 0.582601249f},
-std::array<float,2>{0.360460371f, 0.866823852f},
-std::array<float,2>{0.769486368f, 0.307763278f},
-std::array<float,2>{0.390747517f, 0.493121028f},
-std::array<float,2>{0.908346593f, 0.959438741f},
-std::array<float,2>{0.0671635419f, 0.675503254f},
-std::array<float,2>{0.574900031f, 0.0176470131f},
-std::array<float,2>{0.0837647691f, 0.440708578f},
-std::array<float,2>{0.593245625f, 0.973192394f},
-std::array<float,2>{0.376505226f, 0.648439586f},
-std::array<float,2>{0.9370206f, 0.0382645801f},
-std::array<float,2>{0.357321233f, 0.158395916f},
-std::array<float,2>{0.763961673f, 0.599774539f},
-std::array<float,2>{0.240320638f, 0.838988364f},
-std::array<float,2>{0.668100774f, 0.269245297f},
-std::array<float,2>{0.173952267f, 0.123751789f},
-std::array<float,2>{0.720738113f, 0.704769492f},
-std::array<float,2>{0.286581546f, 0.903000176f},
-std::array<float,2>{0.840847909f, 0.417158812f},
-std::array<float,2>{0.474949211f, 0.356324762f},
-std::array<float,2>{0.99782896f, 0.797424793f},
-std::array<float,2>{0.00466760295f, 0.543262243f},
-std::array<float,2>{0.547751248f, 0.229189023f},
-std::array<float,2>{0.214514613f, 0.288684994f},
-std::array<float,2>{0.635312855f, 0.854609847f},
-std::array<float,2>{0.338685095f, 0.574387848f},
-std::array<float,2>{0.80997175f, 0.152750343f},
-std::array<float,2>{0.434800118f, 0.00961925834f},
-std::array<float,2>{0.883347213f, 0.658022642f},
-std::array<float,2>{0.114404395f, 0.944434643f},
-std::array<float,2>{0.620674014f, 0.471295595f},
-std::array<float,2>{0.0576353371f, 0.210249677f},
-std::array<float,2>{0.513194919f, 0.520814002f},
-std::array<float,2>{0.464519054f, 0.757045627f},
-std::array<float,2>{0.953955889f, 0.316882521f},
-std::array<float,2>{0.272881299f, 0.377016276f},
-std::array<float,2>{0.848348439f, 0.919553697f},
-std::array<float,2>{0.149464265f, 0.725051939f},
-std::array<float,2>{0.707532167f, 0.0707974434f},
-std::array<float,2>{0.244967565f, 0.483252555f},
-std::array<float,2>{0.659427762f, 0.950466037f},
-std::array<float,2>{0.349387497f, 0.669889748f},
-std::array<float,2>{0.755523622f, 0.00219960487f},
-std::array<float,2>{0.385245055f, 0.141231f},
-std::array<float,2>{0.929276526f, 0.564745843f},
-std::array<float,2>{0.0908868015f, 0.848939419f},
-std::array<float,2>{0.583911359f, 0.294909716f},
-std::array<float,2>{0.0140627017f, 0.0634460077f},
-std::array<float,2>{0.556882203f, 0.728967249f},
-std::array<float,2>{0.48142001f, 0.90871644f},
-std::array<float,2>{0.986044943f, 0.387748122f},
-std::array<float,2>{0.289819449f, 0.322480142f},
-std::array<float,2>{0.83521533f, 0.764330566f},
-std::array<float,2>{0.183827072f, 0.528383315f},
-std::array<float,2>{0.731933057f, 0.216484904f},
-std::array<float,2>{0.124676287f, 0.281003922f},
-std::array<float,2>{0.614700615f, 0.828738391f},
-std::array<float,2>{0.423223048f, 0.607884228f},
-std::array<float,2>{0.877715349f, 0.169203207f},
-std::array<float,2>{0.330801547f, 0.0431818701f},
-std::array<float,2>{0.79909271f, 0.640716016f},
-std::array<float,2>{0.209466174f, 0.981754601f},
-std::array<float,2>{0.630111456f, 0.446234316f},
-std::array<float,2>{0.146881819f, 0.225206897f},
-std::array<float,2>{0.71845293f, 0.531666458f},
-std::array<float,2>{0.277863979f, 0.8061831f},
-std::array<float,2>{0.858062744f, 0.344370753f},
-std::array<float,2>{0.458373338f, 0.411327451f},
-std::array<float,2>{0.961414516f, 0.897751927f},
-std::array<float,2>{0.0507603325f, 0.712204337f},
-std::array<float,2>{0.506074131f, 0.113098904f},
-std::array<float,2>{0.0466667265f, 0.39215526f},
-std::array<float,2>{0.521342397f, 0.924267113f},
-std::array<float,2>{0.442869931f, 0.745438755f},
-std::array<float,2>{0.950501502f, 0.0842540935f},
-std::array<float,2>{0.263489425f, 0.195126623f},
-std::array<float,2>{0.861358881f, 0.506281793f},
-std::array<float,2>{0.130620465f, 0.773323596f},
-std::array<float,2>{0.695596039f, 0.341238528f},
-std::array<float,2>{0.199647129f, 0.0286449585f},
-std::array<float,2>{0.647422433f, 0.684189677f},
-std::array<float,2>{0.32477057f, 0.965826094f},
-std::array<float,2>{0.796850502f, 0.488357544f},
-std::array<float,2>{0.419520825f, 0.300276846f},
-std::array<float,2>{0.899462581f, 0.87334758f},
-std::array<float,2>{0.0957871303f, 0.592347026f},
-std::array<float,2>{0.594896078f, 0.139998719f},
-std::array<float,2>{0.165686324f, 0.363146663f},
-std::array<float,2>{0.739434898f, 0.790017843f},
-std::array<float,2>{0.309239566f, 0.554142118f},
-std::array<float,2>{0.822193325f, 0.242756546f},
-std::array<float,2>{0.4934026f, 0.10557434f},
-std::array<float,2>{0.970611572f, 0.690744817f},
-std::array<float,2>{0.0189089142f, 0.883802414f},
-std::array<float,2>{0.544401169f, 0.426495403f},
-std::array<float,2>{0.0742667094f, 0.174610272f},
-std::array<float,2>{0.569081366f, 0.611179948f},
-std::array<float,2>{0.399027526f, 0.824041188f},
-std::array<float,2>{0.917098999f, 0.250181168f},
-std::array<float,2>{0.370677531f, 0.456327528f},
-std::array<float,2>{0.778701782f, 0.996388316f},
-std::array<float,2>{0.228791535f, 0.626584411f},
-std::array<float,2>{0.677060544f, 0.0478913561f},
-std::array<float,2>{0.18053627f, 0.462236464f},
-std::array<float,2>{0.728717446f, 0.986805916f},
-std::array<float,2>{0.296613425f, 0.640471101f},
-std::array<float,2>{0.828341424f, 0.0563494302f},
-std::array<float,2>{0.47689116f, 0.187496439f},
-std::array<float,2>{0.991968751f, 0.622565448f},
-std::array<float,2>{0.0110046547f, 0.813423514f},
-std::array<float,2>{0.560102582f, 0.259176135f},
-std::array<float,2>{0.086552158f, 0.100780725f},
-std::array<float,2>{0.58134371f, 0.699676871f},
-std::array<float,2>{0.387933463f, 0.881332219f},
-std::array<float,2>{0.921897829f, 0.435560793f},
-std::array<float,2>{0.345913023f, 0.370355546f},
-std::array<float,2>{0.752666116f, 0.786768258f},
-std::array<float,2>{0.248180419f, 0.558337748f},
-std::array<float,2>{0.662853599f, 0.235704288f},
-std::array<float,2>{0.0545871519f, 0.31118542f},
-std::array<float,2>{0.500562906f, 0.862106383f},
-std::array<float,2>{0.456526786f, 0.578634024f},
-std::array<float,2>{0.965048134f, 0.129254296f},
-std::array<float,2>{0.273803979f, 0.020797817f},
-std::array<float,2>{0.852426231f, 0.675916314f},
-std::array<float,2>{0.141401842f, 0.956241667f},
-std::array<float,2>{0.711452901f, 0.498618066f},
-std::array<float,2>{0.205191374f, 0.201139554f},
-std::array<float,2>{0.626154065f, 0.511959851f},
-std::array<float,2>{0.334825128f, 0.778553367f},
-std::array<float,2>{0.801706672f, 0.333918482f},
-std::array<float,2>{0.428554654f, 0.39862746f},
-std::array<float,2>{0.882649839f, 0.932905018f},
-std::array<float,2>{0.118345551f, 0.735523105f},
-std::array<float,2>{0.609490693f, 0.0930279717f},
-std::array<float,2>{0.100430384f, 0.421063662f},
-std::array<float,2>{0.598917484f, 0.901441097f},
-std::array<float,2>{0.414559513f, 0.708332896f},
-std::array<float,2>{0.905821025f, 0.119019642f},
-std::array<float,2>{0.323518693f, 0.234266907f},
-std::array<float,2>{0.789678633f, 0.539923131f},
-std::array<float,2>{0.197123721f, 0.801615059f},
-std::array<float,2>{0.642634988f, 0.353014261f},
-std::array<float,2>{0.126622587f, 0.0319597162f},
-std::array<float,2>{0.700886309f, 0.654040277f},
-std::array<float,2>{0.259323001f, 0.971029282f},
-std::array<float,2>{0.863917947f, 0.441953063f},
-std::array<float,2>{0.44138214f, 0.270787477f},
-std::array<float,2>{0.948913693f, 0.84367466f},
-std::array<float,2>{0.0393137857f, 0.597310722f},
-std::array<float,2>{0.51894331f, 0.162500098f},
-std::array<float,2>{0.23276332f, 0.31445384f},
-std::array<float,2>{0.674867988f, 0.753561616f},
-std::array<float,2>{0.374320179f, 0.515922248f},
-std::array<float,2>{0.773812771f, 0.204432666f},
-std::array<float,2>{0.404608101f, 0.077405408f},
-std::array<float,2>{0.920828402f, 0.719259799f},
-std::array<float,2>{0.0738216937f, 0.915899992f},
-std::array<float,2>{0.563385963f, 0.382565886f},
-std::array<float,2>{0.0215691458f, 0.149599105f},
-std::array<float,2>{0.542719901f, 0.572053611f},
-std::array<float,2>{0.498181552f, 0.856832564f},
-std::array<float,2>{0.973529816f, 0.282096624f},
-std::array<float,2>{0.308586389f, 0.476087779f},
-std::array<float,2>{0.8276214f, 0.941049874f},
-std::array<float,2>{0.170284465f, 0.660467207f},
-std::array<float,2>{0.738064647f, 0.0142237823f},
-std::array<float,2>{0.188635945f, 0.382893354f},
-std::array<float,2>{0.648473144f, 0.913546979f},
-std::array<float,2>{0.314507812f, 0.732183039f},
-std::array<float,2>{0.785874903f, 0.0698781982f},
-std::array<float,2>{0.410466909f, 0.21450673f},
-std::array<float,2>{0.891924381f, 0.524347842f},
-std::array<float,2>{0.108031899f, 0.761122942f},
-std::array<float,2>{0.603251159f, 0.327269822f},
-std::array<float,2>{0.0355206467f, 0.00479592662f},
-std::array<float,2>{0.524008334f, 0.666237891f},
-std::array<float,2>{0.447655797f, 0.949104786f},
-std::array<float,2>{0.938220322f, 0.479346305f},
-std::array<float,2>{0.257729113f, 0.292689919f},
-std::array<float,2>{0.867956579f, 0.846017241f},
-std::array<float,2>{0.139185831f, 0.567541122f},
-std::array<float,2>{0.695132971f, 0.145543233f},
-std::array<float,2>{0.0649410561f, 0.349746436f},
-std::array<float,2>{0.570530653f, 0.809326112f},
-std::array<float,2>{0.397819281f, 0.537171781f},
-std::array<float,2>{0.910542548f, 0.220586106f},
-std::array<float,2>{0.365761459f, 0.1143189f},
-std::array<float,2>{0.772449732f, 0.717415154f},
-std::array<float,2>{0.222989544f, 0.894000292f},
-std::array<float,2>{0.682212234f, 0.407541454f},
-std::array<float,2>{0.157048166f, 0.165226534f},
-std::array<float,2>{0.745773196f, 0.603379905f},
-std::array<float,2>{0.299388766f, 0.83566004f},
-std::array<float,2>{0.819525659f, 0.274139702f},
-std::array<float,2>{0.488184005f, 0.449640542f},
-std::array<float,2>{0.9791435f, 0.979051709f},
-std::array<float,2>{0.0300559774f, 0.645227134f},
-std::array<float,2>{0.536834717f, 0.041202683f},
-std::array<float,2>{0.000329763076f, 0.487551123f},
-std::array<float,2>{0.553517342f, 0.96202147f},
-std::array<float,2>{0.47134304f, 0.679712653f},
-std::array<float,2>{0.992584586f, 0.0235713571f},
-std::array<float,2>{0.283897549f, 0.13423574f},
-std::array<float,2>{0.837794244f, 0.587529242f},
-std::array<float,2>{0.1761204f, 0.870181143f},
-std::array<float,2>{0.725143373f, 0.303329915f},
-std::array<float,2>{0.234715104f, 0.0815056711f},
-std::array<float,2>{0.665046811f, 0.74661088f},
-std::array<float,2>{0.354968399f, 0.92804271f},
-std::array<float,2>{0.759471536f, 0.397843659f},
-std::array<float,2>{0.380438358f, 0.336067617f},
-std::array<float,2>{0.932602704f, 0.769000173f},
-std::array<float,2>{0.0791875124f, 0.500519335f},
-std::array<float,2>{0.589586854f, 0.188399389f},
-std::array<float,2>{0.153991953f, 0.257178783f},
-std::array<float,2>{0.703725696f, 0.824447215f},
-std::array<float,2>{0.266084701f, 0.617036521f},
-std::array<float,2>{0.844249487f, 0.177181005f},
-std::array<float,2>{0.466549456f, 0.0512696244f},
-std::array<float,2>{0.959931612f, 0.629835963f},
-std::array<float,2>{0.0604029559f, 0.993729532f},
-std::array<float,2>{0.511584401f, 0.457652181f},
-std::array<float,2>{0.112714291f, 0.24634926f},
-std::array<float,2>{0.624479115f, 0.548285782f},
-std::array<float,2>{0.429698199f, 0.793259978f},
-std::array<float,2>{0.888373554f, 0.363632679f},
-std::array<float,2>{0.340634286f, 0.424940825f},
-std::array<float,2>{0.808098257f, 0.890069067f},
-std::array<float,2>{0.216646507f, 0.695078313f},
-std::array<float,2>{0.638361335f, 0.101692393f},
-std::array<float,2>{0.16390349f, 0.404333889f},
-std::array<float,2>{0.749090493f, 0.936974347f},
-std::array<float,2>{0.303617299f, 0.741689563f},
-std::array<float,2>{0.813651025f, 0.0894022062f},
-std::array<float,2>{0.492151588f, 0.196563736f},
-std::array<float,2>{0.981951594f, 0.508151531f},
-std::array<float,2>{0.025869431f, 0.776531219f},
-std::array<float,2>{0.53156811f, 0.331222147f},
-std::array<float,2>{0.0688634962f, 0.0165577997f},
-std::array<float,2>{0.576970577f, 0.672842085f},
-std::array<float,2>{0.393213779f, 0.958171964f},
-std::array<float,2>{0.907729626f, 0.494806916f},
-std::array<float,2>{0.362535f, 0.305231273f},
-std::array<float,2>{0.765649498f, 0.864114463f},
-std::array<float,2>{0.22214815f, 0.585784376f},
-std::array<float,2>{0.684171796f, 0.128034458f},
-std::array<float,2>{0.0323173366f, 0.37317574f},
-std::array<float,2>{0.530172348f, 0.783697426f},
-std::array<float,2>{0.4527767f, 0.561102152f},
-std::array<float,2>{0.944501162f, 0.239810035f},
-std::array<float,2>{0.250613779f, 0.0945378467f},
-std::array<float,2>{0.87430799f, 0.698944807f},
-std::array<float,2>{0.134271652f, 0.875377059f},
-std::array<float,2>{0.689355433f, 0.431716949f},
-std::array<float,2>{0.19527413f, 0.181911826f},
-std::array<float,2>{0.65618974f, 0.619145572f},
-std::array<float,2>{0.319369584f, 0.818739831f},
-std::array<float,2>{0.782852471f, 0.262350827f},
-std::array<float,2>{0.408788502f, 0.466649532f},
-std::array<float,2>{0.895321131f, 0.988705099f},
-std::array<float,2>{0.10424076f, 0.6357342f},
-std::array<float,2>{0.606771648f, 0.060418874f},
-std::array<float,2>{0.116504848f, 0.470560312f},
-std::array<float,2>{0.618091106f, 0.94142741f},
-std::array<float,2>{0.436681628f, 0.659766555f},
-std::array<float,2>{0.885749161f, 0.0103717744f},
-std::array<float,2>{0.336723864f, 0.156102642f},
-std::array<float,2>{0.811030149f, 0.577184975f},
-std::array<float,2>{0.211023107f, 0.852840245f},
-std::array<float,2>{0.634474099f, 0.2852211f},
-std::array<float,2>{0.152315155f, 0.0733851865f},
-std::array<float,2>{0.710825682f, 0.724160314f},
-std::array<float,2>{0.269585967f, 0.920478046f},
-std::array<float,2>{0.851068377f, 0.376915872f},
-std::array<float,2>{0.461919308f, 0.318901271f},
-std::array<float,2>{0.956576169f, 0.754611433f},
-std::array<float,2>{0.0557785779f, 0.523201942f},
-std::array<float,2>{0.515616953f, 0.20740597f},
-std::array<float,2>{0.23868385f, 0.267559707f},
-std::array<float,2>{0.671610415f, 0.836931288f},
-std::array<float,2>{0.35902673f, 0.599030614f},
-std::array<float,2>{0.763659239f, 0.15678516f},
-std::array<float,2>{0.377442062f, 0.035706263f},
-std::array<float,2>{0.93384558f, 0.650999904f},
-std::array<float,2>{0.0858234018f, 0.976058781f},
-std::array<float,2>{0.591001809f, 0.439166069f},
-std::array<float,2>{0.00645919982f, 0.228211462f},
-std::array<float,2>{0.550708652f, 0.546310067f},
-std::array<float,2>{0.4736498f, 0.800469935f},
-std::array<float,2>{0.998159111f, 0.357534677f},
-std::array<float,2>{0.288365394f, 0.414887726f},
-std::array<float,2>{0.8435148f, 0.905810893f},
-std::array<float,2>{0.172890395f, 0.706995785f},
-std::array<float,2>{0.720114172f, 0.122938924f},
-std::array<float,2>{0.208438128f, 0.449075937f},
-std::array<float,2>{0.632666826f, 0.983850181f},
-std::array<float,2>{0.328275949f, 0.644070327f},
-std::array<float,2>{0.797657073f, 0.0467852317f},
-std::array<float,2>{0.425012052f, 0.171686649f},
-std::array<float,2>{0.875697911f, 0.605642557f},
-std::array<float,2>{0.12125694f, 0.8311975f},
-std::array<float,2>{0.617179394f, 0.278300762f},
-std::array<float,2>{0.0475340262f, 0.109814547f},
-std::array<float,2>{0.505341887f, 0.714627266f},
-std::array<float,2>{0.459548682f, 0.89539212f},
-std::array<float,2>{0.964025199f, 0.412860096f},
-std::array<float,2>{0.279384792f, 0.346000284f},
-std::array<float,2>{0.855713248f, 0.80712539f},
-std::array<float,2>{0.14546746f, 0.53384918f},
-std::array<float,2>{0.715910494f, 0.224497736f},
-std::array<float,2>{0.0936168358f, 0.295455724f},
-std::array<float,2>{0.584665835f, 0.850672305f},
-std::array<float,2>{0.383009404f, 0.563015282f},
-std::array<float,2>{0.925995529f, 0.143988103f},
-std::array<float,2>{0.35155654f, 0.00116182363f},
-std::array<float,2>{0.7570467f, 0.670879304f},
-std::array<float,2>{0.242872357f, 0.951759338f},
-std::array<float,2>{0.657149374f, 0.481195688f},
-std::array<float,2>{0.186129406f, 0.218104571f},
-std::array<float,2>{0.732581496f, 0.530104101f},
-std::array<float,2>{0.292127222f, 0.762185574f},
-std::array<float,2>{0.833894968f, 0.32081151f},
-std::array<float,2>{0.483667731f, 0.388975948f},
-std::array<float,2>{0.988063395f, 0.907146394f},
-std::array<float,2>{0.0135785947f, 0.728002131f},
-std::array<float,2>{0.555744171f, 0.0655848384f},
-std::array<float,2>{0.0166618861f, 0.428287685f},
-std::array<float,2>{0.545949101f, 0.884870172f},
-std::array<float,2>{0.495619833f, 0.688590109f},
-std::array<float,2>{0.972623646f, 0.107872888f},
-std::array<float,2>{0.31090647f, 0.244430467f},
-std::array<float,2>{0.823887169f, 0.5523718f},
-std::array<float,2>{0.166050538f, 0.791185021f},
-std::array<float,2>{0.741389632f, 0.360640734f},
-std::array<float,2>{0.227766931f, 0.0496908985f},
-std::array<float,2>{0.678689361f, 0.62725848f},
-std::array<float,2>{0.368662357f, 0.998665154f},
-std::array<float,2>{0.780111194f, 0.454070091f},
-std::array<float,2>{0.401045412f, 0.252116978f},
-std::array<float,2>{0.915243506f, 0.820537627f},
-std::array<float,2>{0.076181367f, 0.612129092f},
-std::array<float,2>{0.566488445f, 0.173611104f},
-std::array<float,2>{0.131370425f, 0.342390478f},
-std::array<float,2>{0.698056996f, 0.770512819f},
-std::array<float,2>{0.26450491f, 0.505828023f},
-std::array<float,2>{0.860814631f, 0.192582101f},
-std::array<float,2>{0.4436149f, 0.0820499659f},
-std::array<float,2>{0.951659083f, 0.743509293f},
-std::array<float,2>{0.0445862114f, 0.922546506f},
-std::array<float,2>{0.523389399f, 0.394269407f},
-std::array<float,2>{0.0954902247f, 0.137876689f},
-std::array<float,2>{0.597650945f, 0.590582609f},
-std::array<float,2>{0.420393556f, 0.871728599f},
-std::array<float,2>{0.901632905f, 0.297479659f},
-std::array<float,2>{0.326246828f, 0.490545899f},
-std::array<float,2>{0.794813573f, 0.968396842f},
-std::array<float,2>{0.202997431f, 0.685548782f},
-std::array<float,2>{0.64588809f, 0.0306836143f},
-std::array<float,2>{0.144172028f, 0.497626364f},
-std::array<float,2>{0.713572323f, 0.953764439f},
-std::array<float,2>{0.276044935f, 0.67831099f},
-std::array<float,2>{0.855427861f, 0.0215202216f},
-std::array<float,2>{0.454575032f, 0.130884171f},
-std::array<float,2>{0.968117416f, 0.580630898f},
-std::array<float,2>{0.0518370345f, 0.859794617f},
-std::array<float,2>{0.503724277f, 0.309396893f},
-std::array<float,2>{0.121038988f, 0.091321446f},
-std::array<float,2>{0.611462414f, 0.737846017f},
-std::array<float,2>{0.426386297f, 0.930761755f},
-std::array<float,2>{0.880858004f, 0.400686413f},
-std::array<float,2>{0.333436817f, 0.335034549f},
-std::array<float,2>{0.804160416f, 0.779426932f},
-std::array<float,2>{0.203582719f, 0.513767719f},
-std::array<float,2>{0.628775895f, 0.201597527f},
-std::array<float,2>{0.00793158729f, 0.260541201f},
-std::array<float,2>{0.560738325f, 0.815616608f},
-std::array<float,2>{0.479917228f, 0.62399888f},
-std::array<float,2>{0.989414573f, 0.1851978f},
-std::array<float,2>{0.29440853f, 0.0581222773f},
-std::array<float,2>{0.831329584f, 0.63857013f},
-std::array<float,2>{0.183224484f, 0.98629266f},
-std::array<float,2>{0.726614892f, 0.462972879f},
-std::array<float,2>{0.247420013f, 0.238115296f},
-std::array<float,2>{0.661095858f, 0.555599511f},
-std::array<float,2>{0.34511289f, 0.787640631f},
-std::array<float,2>{0.751288772f, 0.367450655f},
-std::array<float,2>{0.389205575f, 0.434502602f},
-std::array<float,2>{0.925111473f, 0.879733205f},
-std::array<float,2>{0.088823311f, 0.703107417f},
-std::array<float,2>{0.579308629f, 0.0989200324f},
-std::array<float,2>{0.0716522336f, 0.379437834f},
-std::array<float,2>{0.564915597f, 0.916651309f},
-std::array<float,2>{0.40369156f, 0.722261906f},
-std::array<float,2>{0.918022752f, 0.0743575618f},
-std::array<float,2>{0.372236878f, 0.205409214f},
-std::array<float,2>{0.77557373f, 0.518903077f},
-std::array<float,2>{0.232147291f, 0.750066757f},
-std::array<float,2>{0.673427403f, 0.314325452f},
-std::array<float,2>{0.168914542f, 0.0121531077f},
-std::array<float,2>{0.734876335f, 0.663558364f},
-std::array<float,2>{0.305418044f, 0.939067185f},
-std::array<float,2>{0.825160921f, 0.474233449f},
-std::array<float,2>{0.497167528f, 0.284244567f},
-std::array<float,2>{0.975253701f, 0.85789746f},
-std::array<float,2>{0.0209729616f, 0.572867036f},
-std::array<float,2>{0.539242089f, 0.151379287f},
-std::array<float,2>{0.198352605f, 0.354927331f},
-std::array<float,2>{0.640761256f, 0.803862512f},
-std::array<float,2>{0.320358157f, 0.542568684f},
-std::array<float,2>{0.79111588f, 0.231735662f},
-std::array<float,2>{0.416036218f, 0.121053286f},
-std::array<float,2>{0.903885484f, 0.710283995f},
-std::array<float,2>{0.0982384533f, 0.900250316f},
-std::array<float,2>{0.60133779f, 0.418021172f},
-std::array<float,2>{0.042204719f, 0.160273314f},
-std::array<float,2>{0.517193973f, 0.594482601f},
-std::array<float,2>{0.43911615f, 0.841283441f},
-std::array<float,2>{0.947079062f, 0.273301661f},
-std::array<float,2>{0.259988546f, 0.44462496f},
-std::array<float,2>{0.865677595f, 0.970318437f},
-std::array<float,2>{0.127613291f, 0.655806184f},
-std::array<float,2>{0.702613473f, 0.033393763f},
-std::array<float,2>{0.225111768f, 0.408331186f},
-std::array<float,2>{0.679931581f, 0.891920149f},
-std::array<float,2>{0.363909513f, 0.716475308f},
-std::array<float,2>{0.771202624f, 0.116527669f},
-std::array<float,2>{0.394950002f, 0.221152857f},
-std::array<float,2>{0.913936973f, 0.535237491f},
-std::array<float,2>{0.0639172792f, 0.812139392f},
-std::array<float,2>{0.573983788f, 0.348433018f},
-std::array<float,2>{0.0284433011f, 0.0399959236f},
-std::array<float,2>{0.537688434f, 0.647708476f},
-std::array<float,2>{0.48535493f, 0.977795064f},
-std::array<float,2>{0.978161275f, 0.452900678f},
-std::array<float,2>{0.297231346f, 0.276096761f},
-std::array<float,2>{0.8165856f, 0.833753407f},
-std::array<float,2>{0.158789068f, 0.604611039f},
-std::array<float,2>{0.744097114f, 0.166325346f},
-std::array<float,2>{0.105752245f, 0.325846791f},
-std::array<float,2>{0.604212344f, 0.758648932f},
-std::array<float,2>{0.413952738f, 0.526504755f},
-std::array<float,2>{0.894455791f, 0.21274443f},
-std::array<float,2>{0.313052088f, 0.0666158199f},
-std::array<float,2>{0.788131714f, 0.732573032f},
-std::array<float,2>{0.190039217f, 0.910611331f},
-std::array<float,2>{0.651424289f, 0.385938823f},
-std::array<float,2>{0.138670668f, 0.148215339f},
-std::array<float,2>{0.692193687f, 0.5690431f},
-std::array<float,2>{0.25416705f, 0.844718039f},
-std::array<float,2>{0.869265676f, 0.289593488f},
-std::array<float,2>{0.446009368f, 0.477695882f},
-std::array<float,2>{0.94129324f, 0.945535362f},
-std::array<float,2>{0.0374473855f, 0.66519177f},
-std::array<float,2>{0.526812434f, 0.00611610152f},
-std::array<float,2>{0.061725419f, 0.459043831f},
-std::array<float,2>{0.507838786f, 0.994149029f},
-std::array<float,2>{0.468674809f, 0.632160544f},
-std::array<float,2>{0.957897186f, 0.0533939712f},
-std::array<float,2>{0.268210232f, 0.179335237f},
-std::array<float,2>{0.846798897f, 0.615157247f},
-std::array<float,2>{0.155828372f, 0.826941073f},
-std::array<float,2>{0.705638587f, 0.254351377f},
-std::array<float,2>{0.218285769f, 0.104176514f},
-std::array<float,2>{0.639993846f, 0.692353427f},
-std::array<float,2>{0.343112588f, 0.887624145f},
-std::array<float,2>{0.80642575f, 0.422483027f},
-std::array<float,2>{0.432631224f, 0.365872502f},
-std::array<float,2>{0.888758421f, 0.796505988f},
-std::array<float,2>{0.109441847f, 0.550397038f},
-std::array<float,2>{0.621513188f, 0.249255806f},
-std::array<float,2>{0.178896978f, 0.302365452f},
-std::array<float,2>{0.724347472f, 0.868658066f},
-std::array<float,2>{0.282263458f, 0.588806629f},
-std::array<float,2>{0.838556468f, 0.136072174f},
-std::array<float,2>{0.470293343f, 0.0261689499f},
-std::array<float,2>{0.99600625f, 0.682917595f},
-std::array<float,2>{0.00292260945f, 0.964778066f},
-std::array<float,2>{0.550800443f, 0.486109763f},
-std::array<float,2>{0.0819539428f, 0.191144392f},
-std::array<float,2>{0.586875439f, 0.503511965f},
-std::array<float,2>{0.382138789f, 0.766355395f},
-std::array<float,2>{0.93035239f, 0.339052796f},
-std::array<float,2>{0.353234082f, 0.396338224f},
-std::array<float,2>{0.759937763f, 0.926034212f},
-std::array<float,2>{0.237470135f, 0.749995589f},
-std::array<float,2>{0.666553378f, 0.0791414529f}}
\ No newline at end of file
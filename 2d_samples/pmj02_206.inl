@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.382189155f, 0.431909055f},
-std::array<float,2>{0.951087475f, 0.67539978f},
-std::array<float,2>{0.221062765f, 0.996489227f},
-std::array<float,2>{0.605540991f, 0.165067673f},
-std::array<float,2>{0.0656275898f, 0.0548240803f},
-std::array<float,2>{0.70454514f, 0.82468915f},
-std::array<float,2>{0.27210018f, 0.560050011f},
-std::array<float,2>{0.855324388f, 0.357200176f},
-std::array<float,2>{0.327378541f, 0.248445451f},
-std::array<float,2>{0.796299756f, 0.910054982f},
-std::array<float,2>{0.00682747364f, 0.697475076f},
-std::array<float,2>{0.65821892f, 0.46137169f},
-std::array<float,2>{0.132882014f, 0.27235195f},
-std::array<float,2>{0.50316304f, 0.620923042f},
-std::array<float,2>{0.457245946f, 0.802913964f},
-std::array<float,2>{0.905629337f, 0.0832262486f},
-std::array<float,2>{0.28384155f, 0.341807872f},
-std::array<float,2>{0.816736817f, 0.523543775f},
-std::array<float,2>{0.0974573791f, 0.855324447f},
-std::array<float,2>{0.74759531f, 0.0191692282f},
-std::array<float,2>{0.211650595f, 0.133972317f},
-std::array<float,2>{0.588107705f, 0.938976109f},
-std::array<float,2>{0.428655505f, 0.637246668f},
-std::array<float,2>{0.993940055f, 0.388569236f},
-std::array<float,2>{0.483941138f, 0.123173736f},
-std::array<float,2>{0.912626445f, 0.778991997f},
-std::array<float,2>{0.163391352f, 0.564147413f},
-std::array<float,2>{0.547740459f, 0.309661388f},
-std::array<float,2>{0.0588587672f, 0.478776902f},
-std::array<float,2>{0.649734557f, 0.748425543f},
-std::array<float,2>{0.361849546f, 0.899312794f},
-std::array<float,2>{0.780130625f, 0.216094136f},
-std::array<float,2>{0.441204637f, 0.293258816f},
-std::array<float,2>{0.889286697f, 0.588031054f},
-std::array<float,2>{0.153434664f, 0.750756204f},
-std::array<float,2>{0.519558549f, 0.102335677f},
-std::array<float,2>{0.0176461823f, 0.195643827f},
-std::array<float,2>{0.685451448f, 0.880669951f},
-std::array<float,2>{0.335674822f, 0.724990308f},
-std::array<float,2>{0.800059855f, 0.49794662f},
-std::array<float,2>{0.259636313f, 0.0130610121f},
-std::array<float,2>{0.8712008f, 0.874087393f},
-std::array<float,2>{0.0876468271f, 0.50953418f},
-std::array<float,2>{0.699172854f, 0.326144069f},
-std::array<float,2>{0.238142669f, 0.40207389f},
-std::array<float,2>{0.612529874f, 0.640842557f},
-std::array<float,2>{0.405006588f, 0.966426671f},
-std::array<float,2>{0.964912891f, 0.141057402f},
-std::array<float,2>{0.356292546f, 0.452263802f},
-std::array<float,2>{0.760310054f, 0.708099782f},
-std::array<float,2>{0.0333032459f, 0.925126791f},
-std::array<float,2>{0.636542737f, 0.221221194f},
-std::array<float,2>{0.179806545f, 0.0701689869f},
-std::array<float,2>{0.542719007f, 0.781617939f},
-std::array<float,2>{0.493974149f, 0.603749335f},
-std::array<float,2>{0.929734468f, 0.256883264f},
-std::array<float,2>{0.412983179f, 0.185797259f},
-std::array<float,2>{0.975702822f, 0.96968466f},
-std::array<float,2>{0.190906867f, 0.65854305f},
-std::array<float,2>{0.576790392f, 0.417706817f},
-std::array<float,2>{0.122150533f, 0.361168712f},
-std::array<float,2>{0.719019592f, 0.535074592f},
-std::array<float,2>{0.302571386f, 0.834858f},
-std::array<float,2>{0.841138601f, 0.0334766023f},
-std::array<float,2>{0.487567484f, 0.484717041f},
-std::array<float,2>{0.925458252f, 0.728748977f},
-std::array<float,2>{0.177871332f, 0.883134723f},
-std::array<float,2>{0.534986734f, 0.192650929f},
-std::array<float,2>{0.0405253582f, 0.100792743f},
-std::array<float,2>{0.63072747f, 0.759516299f},
-std::array<float,2>{0.351082951f, 0.578905404f},
-std::array<float,2>{0.756922901f, 0.284447253f},
-std::array<float,2>{0.309873849f, 0.149217591f},
-std::array<float,2>{0.834455788f, 0.95434469f},
-std::array<float,2>{0.115252472f, 0.648778975f},
-std::array<float,2>{0.728170455f, 0.393584579f},
-std::array<float,2>{0.199279442f, 0.315792352f},
-std::array<float,2>{0.56546849f, 0.506490409f},
-std::array<float,2>{0.418756872f, 0.865834534f},
-std::array<float,2>{0.981370568f, 0.00759638147f},
-std::array<float,2>{0.34256658f, 0.261901885f},
-std::array<float,2>{0.808924675f, 0.593987048f},
-std::array<float,2>{0.0289959516f, 0.793587565f},
-std::array<float,2>{0.675278902f, 0.0734566897f},
-std::array<float,2>{0.146268904f, 0.226887748f},
-std::array<float,2>{0.530841947f, 0.933863699f},
-std::array<float,2>{0.448438853f, 0.712221026f},
-std::array<float,2>{0.881484091f, 0.444022059f},
-std::array<float,2>{0.394287497f, 0.0458498821f},
-std::array<float,2>{0.959695339f, 0.836353421f},
-std::array<float,2>{0.245506942f, 0.543702126f},
-std::array<float,2>{0.621548176f, 0.368861198f},
-std::array<float,2>{0.0814439133f, 0.406578541f},
-std::array<float,2>{0.690653086f, 0.665100276f},
-std::array<float,2>{0.250897318f, 0.981259346f},
-std::array<float,2>{0.859738588f, 0.178662658f},
-std::array<float,2>{0.430672705f, 0.34390679f},
-std::array<float,2>{0.991904855f, 0.548481464f},
-std::array<float,2>{0.204821154f, 0.813697457f},
-std::array<float,2>{0.578475356f, 0.0522786118f},
-std::array<float,2>{0.104228884f, 0.16056551f},
-std::array<float,2>{0.734391093f, 0.990424812f},
-std::array<float,2>{0.291915327f, 0.684663653f},
-std::array<float,2>{0.825556815f, 0.424780995f},
-std::array<float,2>{0.370005399f, 0.0908046216f},
-std::array<float,2>{0.770913064f, 0.807813108f},
-std::array<float,2>{0.0470316783f, 0.612034202f},
-std::array<float,2>{0.642898262f, 0.275068045f},
-std::array<float,2>{0.165144518f, 0.455442965f},
-std::array<float,2>{0.556861222f, 0.694696188f},
-std::array<float,2>{0.46926859f, 0.917091787f},
-std::array<float,2>{0.915680826f, 0.240279749f},
-std::array<float,2>{0.276747912f, 0.381318301f},
-std::array<float,2>{0.844215631f, 0.632500231f},
-std::array<float,2>{0.0744344741f, 0.952636778f},
-std::array<float,2>{0.714729548f, 0.12700589f},
-std::array<float,2>{0.232582882f, 0.0296672527f},
-std::array<float,2>{0.597708344f, 0.846802413f},
-std::array<float,2>{0.3865152f, 0.517641902f},
-std::array<float,2>{0.938530743f, 0.332094997f},
-std::array<float,2>{0.464981019f, 0.20835267f},
-std::array<float,2>{0.89370352f, 0.897691071f},
-std::array<float,2>{0.132750645f, 0.738796592f},
-std::array<float,2>{0.50981158f, 0.473735869f},
-std::array<float,2>{0.00902549643f, 0.298355967f},
-std::array<float,2>{0.664977491f, 0.5772084f},
-std::array<float,2>{0.314332217f, 0.768232286f},
-std::array<float,2>{0.787768841f, 0.117059991f},
-std::array<float,2>{0.417946339f, 0.468391865f},
-std::array<float,2>{0.976730347f, 0.69951123f},
-std::array<float,2>{0.196701005f, 0.912636399f},
-std::array<float,2>{0.570067704f, 0.242536619f},
-std::array<float,2>{0.111590035f, 0.0785556361f},
-std::array<float,2>{0.731141567f, 0.797999322f},
-std::array<float,2>{0.307664752f, 0.621410429f},
-std::array<float,2>{0.829436898f, 0.268796712f},
-std::array<float,2>{0.345063686f, 0.168068081f},
-std::array<float,2>{0.750013947f, 0.994721293f},
-std::array<float,2>{0.0457386561f, 0.676203549f},
-std::array<float,2>{0.625548542f, 0.436261088f},
-std::array<float,2>{0.173577189f, 0.354260772f},
-std::array<float,2>{0.538745761f, 0.554897368f},
-std::array<float,2>{0.490188479f, 0.823349714f},
-std::array<float,2>{0.928507209f, 0.0599052943f},
-std::array<float,2>{0.256424338f, 0.306391478f},
-std::array<float,2>{0.863642812f, 0.568214238f},
-std::array<float,2>{0.0857418403f, 0.775815725f},
-std::array<float,2>{0.695127666f, 0.119698249f},
-std::array<float,2>{0.248302564f, 0.210975796f},
-std::array<float,2>{0.619126201f, 0.903925419f},
-std::array<float,2>{0.396739095f, 0.744863927f},
-std::array<float,2>{0.956324995f, 0.482515365f},
-std::array<float,2>{0.452527463f, 0.0217909496f},
-std::array<float,2>{0.875127077f, 0.855996251f},
-std::array<float,2>{0.141226411f, 0.530509293f},
-std::array<float,2>{0.525232553f, 0.338254035f},
-std::array<float,2>{0.0271609146f, 0.384094417f},
-std::array<float,2>{0.677239358f, 0.632837176f},
-std::array<float,2>{0.336569548f, 0.945282161f},
-std::array<float,2>{0.805024385f, 0.137823254f},
-std::array<float,2>{0.47297433f, 0.323699772f},
-std::array<float,2>{0.920761526f, 0.51229167f},
-std::array<float,2>{0.170316339f, 0.867756963f},
-std::array<float,2>{0.558703661f, 0.00896616466f},
-std::array<float,2>{0.0546704158f, 0.146495283f},
-std::array<float,2>{0.645539403f, 0.964092433f},
-std::array<float,2>{0.371496558f, 0.647785068f},
-std::array<float,2>{0.769074142f, 0.403215468f},
-std::array<float,2>{0.293472558f, 0.108531691f},
-std::array<float,2>{0.822986841f, 0.756144941f},
-std::array<float,2>{0.109346017f, 0.59213984f},
-std::array<float,2>{0.740689695f, 0.292881787f},
-std::array<float,2>{0.210870713f, 0.494180679f},
-std::array<float,2>{0.582924485f, 0.722632051f},
-std::array<float,2>{0.435626775f, 0.876145482f},
-std::array<float,2>{0.985218108f, 0.199786291f},
-std::array<float,2>{0.316856593f, 0.419607788f},
-std::array<float,2>{0.78456831f, 0.66326803f},
-std::array<float,2>{0.0150006013f, 0.972835302f},
-std::array<float,2>{0.668876767f, 0.182844967f},
-std::array<float,2>{0.125836179f, 0.0382631719f},
-std::array<float,2>{0.514480174f, 0.829204559f},
-std::array<float,2>{0.464025676f, 0.536242723f},
-std::array<float,2>{0.897149861f, 0.366542339f},
-std::array<float,2>{0.38766104f, 0.223811984f},
-std::array<float,2>{0.943949699f, 0.928810477f},
-std::array<float,2>{0.227431744f, 0.704349399f},
-std::array<float,2>{0.594189644f, 0.446540654f},
-std::array<float,2>{0.0733926594f, 0.252239615f},
-std::array<float,2>{0.718746006f, 0.605772376f},
-std::array<float,2>{0.280583531f, 0.785256147f},
-std::array<float,2>{0.850092471f, 0.0633033738f},
-std::array<float,2>{0.456783205f, 0.397583961f},
-std::array<float,2>{0.900631011f, 0.654376268f},
-std::array<float,2>{0.140380099f, 0.960476756f},
-std::array<float,2>{0.504018009f, 0.152573481f},
-std::array<float,2>{0.000623652886f, 0.00109498005f},
-std::array<float,2>{0.66363132f, 0.863102615f},
-std::array<float,2>{0.323917955f, 0.502737045f},
-std::array<float,2>{0.790556192f, 0.319236964f},
-std::array<float,2>{0.266247988f, 0.188023835f},
-std::array<float,2>{0.85775274f, 0.887429893f},
-std::array<float,2>{0.0696333945f, 0.73089844f},
-std::array<float,2>{0.707870126f, 0.489441156f},
-std::array<float,2>{0.225213483f, 0.288731545f},
-std::array<float,2>{0.604358733f, 0.584298074f},
-std::array<float,2>{0.377692252f, 0.762325644f},
-std::array<float,2>{0.947547495f, 0.0965744928f},
-std::array<float,2>{0.364210337f, 0.371674746f},
-std::array<float,2>{0.776116669f, 0.540870249f},
-std::array<float,2>{0.0580910407f, 0.843382716f},
-std::array<float,2>{0.653524339f, 0.040982686f},
-std::array<float,2>{0.159041464f, 0.172763154f},
-std::array<float,2>{0.551083326f, 0.978221595f},
-std::array<float,2>{0.480435461f, 0.669922113f},
-std::array<float,2>{0.906368494f, 0.411059499f},
-std::array<float,2>{0.425052017f, 0.077416949f},
-std::array<float,2>{0.997069836f, 0.790831864f},
-std::array<float,2>{0.216227651f, 0.597671211f},
-std::array<float,2>{0.591186047f, 0.261420429f},
-std::array<float,2>{0.0993768945f, 0.44062674f},
-std::array<float,2>{0.743344843f, 0.714852631f},
-std::array<float,2>{0.287122399f, 0.932398915f},
-std::array<float,2>{0.815422654f, 0.232446045f},
-std::array<float,2>{0.400843084f, 0.279779077f},
-std::array<float,2>{0.961854041f, 0.614145696f},
-std::array<float,2>{0.238572448f, 0.809907675f},
-std::array<float,2>{0.613986373f, 0.0871324241f},
-std::array<float,2>{0.0906782448f, 0.235911325f},
-std::array<float,2>{0.699406266f, 0.919845879f},
-std::array<float,2>{0.261914104f, 0.689599514f},
-std::array<float,2>{0.867391229f, 0.457509428f},
-std::array<float,2>{0.331334651f, 0.0503905118f},
-std::array<float,2>{0.802771568f, 0.819294512f},
-std::array<float,2>{0.0198181029f, 0.552227318f},
-std::array<float,2>{0.683472574f, 0.350884229f},
-std::array<float,2>{0.150476739f, 0.426323473f},
-std::array<float,2>{0.519159138f, 0.680403769f},
-std::array<float,2>{0.441776663f, 0.984492838f},
-std::array<float,2>{0.884541333f, 0.159184784f},
-std::array<float,2>{0.297379017f, 0.470075756f},
-std::array<float,2>{0.838571429f, 0.736238837f},
-std::array<float,2>{0.120609574f, 0.890683413f},
-std::array<float,2>{0.723244131f, 0.205181822f},
-std::array<float,2>{0.192070469f, 0.112022236f},
-std::array<float,2>{0.573481441f, 0.772382736f},
-std::array<float,2>{0.408623874f, 0.570458829f},
-std::array<float,2>{0.969854176f, 0.302704722f},
-std::array<float,2>{0.498773694f, 0.129019529f},
-std::array<float,2>{0.934545696f, 0.946184397f},
-std::array<float,2>{0.184801042f, 0.626498342f},
-std::array<float,2>{0.54403764f, 0.375071466f},
-std::array<float,2>{0.0357860811f, 0.328367263f},
-std::array<float,2>{0.638332605f, 0.522706389f},
-std::array<float,2>{0.354237616f, 0.850442827f},
-std::array<float,2>{0.76303637f, 0.0255410932f},
-std::array<float,2>{0.426375061f, 0.390558273f},
-std::array<float,2>{0.996046007f, 0.639169753f},
-std::array<float,2>{0.214798942f, 0.940364063f},
-std::array<float,2>{0.586810827f, 0.135721415f},
-std::array<float,2>{0.0943741947f, 0.0166305825f},
-std::array<float,2>{0.749186814f, 0.852647305f},
-std::array<float,2>{0.282433599f, 0.526890993f},
-std::array<float,2>{0.819811821f, 0.341485828f},
-std::array<float,2>{0.360954076f, 0.217448145f},
-std::array<float,2>{0.778970122f, 0.901376426f},
-std::array<float,2>{0.0605506971f, 0.747241259f},
-std::array<float,2>{0.650881052f, 0.477028519f},
-std::array<float,2>{0.16173701f, 0.311925679f},
-std::array<float,2>{0.54977423f, 0.564771593f},
-std::array<float,2>{0.482189f, 0.780661404f},
-std::array<float,2>{0.911959112f, 0.121147938f},
-std::array<float,2>{0.270321101f, 0.358303994f},
-std::array<float,2>{0.852544308f, 0.561950326f},
-std::array<float,2>{0.0638897419f, 0.827492058f},
-std::array<float,2>{0.706290483f, 0.0578847677f},
-std::array<float,2>{0.219250366f, 0.167687282f},
-std::array<float,2>{0.609033704f, 0.999191165f},
-std::array<float,2>{0.380530536f, 0.672995329f},
-std::array<float,2>{0.95307529f, 0.431610376f},
-std::array<float,2>{0.459015489f, 0.0856211782f},
-std::array<float,2>{0.903607905f, 0.800879598f},
-std::array<float,2>{0.135572419f, 0.619017184f},
-std::array<float,2>{0.500670016f, 0.271230996f},
-std::array<float,2>{0.00395679707f, 0.464674115f},
-std::array<float,2>{0.657142401f, 0.696335912f},
-std::array<float,2>{0.32517007f, 0.90736264f},
-std::array<float,2>{0.793755829f, 0.247477069f},
-std::array<float,2>{0.494697154f, 0.255369246f},
-std::array<float,2>{0.933037221f, 0.603397489f},
-std::array<float,2>{0.183037102f, 0.784832299f},
-std::array<float,2>{0.540154159f, 0.0671389326f},
-std::array<float,2>{0.032174062f, 0.219039708f},
-std::array<float,2>{0.633710563f, 0.922534704f},
-std::array<float,2>{0.357528687f, 0.709183812f},
-std::array<float,2>{0.75972724f, 0.450640768f},
-std::array<float,2>{0.303762287f, 0.0322768316f},
-std::array<float,2>{0.84290266f, 0.83379519f},
-std::array<float,2>{0.124633893f, 0.532652199f},
-std::array<float,2>{0.721603751f, 0.362616718f},
-std::array<float,2>{0.187510744f, 0.414979011f},
-std::array<float,2>{0.574815989f, 0.658075213f},
-std::array<float,2>{0.411775887f, 0.97170949f},
-std::array<float,2>{0.973889232f, 0.184035689f},
-std::array<float,2>{0.332324862f, 0.498969227f},
-std::array<float,2>{0.798643529f, 0.723424971f},
-std::array<float,2>{0.0169382337f, 0.88237524f},
-std::array<float,2>{0.686770022f, 0.197752059f},
-std::array<float,2>{0.154874638f, 0.1052389f},
-std::array<float,2>{0.522750974f, 0.752113283f},
-std::array<float,2>{0.437651962f, 0.586413264f},
-std::array<float,2>{0.887453914f, 0.296838343f},
-std::array<float,2>{0.40348199f, 0.144510597f},
-std::array<float,2>{0.967603087f, 0.968394995f},
-std::array<float,2>{0.234651625f, 0.643746912f},
-std::array<float,2>{0.609483778f, 0.400339961f},
-std::array<float,2>{0.0896713883f, 0.326638699f},
-std::array<float,2>{0.695385814f, 0.51104933f},
-std::array<float,2>{0.260202974f, 0.871470928f},
-std::array<float,2>{0.874160707f, 0.0137218647f},
-std::array<float,2>{0.446610749f, 0.442020297f},
-std::array<float,2>{0.878964841f, 0.713835061f},
-std::array<float,2>{0.146889389f, 0.93687278f},
-std::array<float,2>{0.52739203f, 0.228942871f},
-std::array<float,2>{0.0298089702f, 0.0706747845f},
-std::array<float,2>{0.67295891f, 0.795518935f},
-std::array<float,2>{0.340263486f, 0.59733361f},
-std::array<float,2>{0.811712205f, 0.263904542f},
-std::array<float,2>{0.252732933f, 0.176029712f},
-std::array<float,2>{0.862591088f, 0.983986676f},
-std::array<float,2>{0.0793150812f, 0.667419076f},
-std::array<float,2>{0.688260853f, 0.408722311f},
-std::array<float,2>{0.243799761f, 0.369765162f},
-std::array<float,2>{0.624363244f, 0.546128869f},
-std::array<float,2>{0.391940892f, 0.838767111f},
-std::array<float,2>{0.958845735f, 0.0429791696f},
-std::array<float,2>{0.348424971f, 0.28194505f},
-std::array<float,2>{0.754434824f, 0.581821501f},
-std::array<float,2>{0.0419383198f, 0.760210752f},
-std::array<float,2>{0.632770598f, 0.0987108573f},
-std::array<float,2>{0.176086172f, 0.194255039f},
-std::array<float,2>{0.532079756f, 0.885099113f},
-std::array<float,2>{0.48502773f, 0.72743988f},
-std::array<float,2>{0.921966136f, 0.486727476f},
-std::array<float,2>{0.420309752f, 0.00460923184f},
-std::array<float,2>{0.983189583f, 0.865029395f},
-std::array<float,2>{0.202678576f, 0.505250394f},
-std::array<float,2>{0.563622296f, 0.31427148f},
-std::array<float,2>{0.11330428f, 0.391548008f},
-std::array<float,2>{0.728536069f, 0.652005374f},
-std::array<float,2>{0.310616612f, 0.955198288f},
-std::array<float,2>{0.832930744f, 0.151339009f},
-std::array<float,2>{0.383838028f, 0.334952474f},
-std::array<float,2>{0.939581335f, 0.516719699f},
-std::array<float,2>{0.23181206f, 0.845035493f},
-std::array<float,2>{0.599816382f, 0.0280192252f},
-std::array<float,2>{0.0776226819f, 0.125674099f},
-std::array<float,2>{0.712265074f, 0.949777007f},
-std::array<float,2>{0.274756014f, 0.629900455f},
-std::array<float,2>{0.846835077f, 0.379356027f},
-std::array<float,2>{0.315104485f, 0.113511965f},
-std::array<float,2>{0.786099076f, 0.767110646f},
-std::array<float,2>{0.0100549459f, 0.575505555f},
-std::array<float,2>{0.666782618f, 0.300588489f},
-std::array<float,2>{0.129645839f, 0.476294607f},
-std::array<float,2>{0.509756923f, 0.741333067f},
-std::array<float,2>{0.466817468f, 0.895196497f},
-std::array<float,2>{0.891329885f, 0.210070282f},
-std::array<float,2>{0.290522635f, 0.422514558f},
-std::array<float,2>{0.827849388f, 0.687033057f},
-std::array<float,2>{0.102147005f, 0.989794493f},
-std::array<float,2>{0.736718237f, 0.163869619f},
-std::array<float,2>{0.205509737f, 0.0532433875f},
-std::array<float,2>{0.580706179f, 0.816330552f},
-std::array<float,2>{0.432244748f, 0.55070591f},
-std::array<float,2>{0.988303542f, 0.345819294f},
-std::array<float,2>{0.470892519f, 0.240071356f},
-std::array<float,2>{0.917055726f, 0.915958464f},
-std::array<float,2>{0.166775659f, 0.692772329f},
-std::array<float,2>{0.55631119f, 0.454571813f},
-std::array<float,2>{0.0504511632f, 0.277165532f},
-std::array<float,2>{0.642140806f, 0.609923363f},
-std::array<float,2>{0.367443413f, 0.805351138f},
-std::array<float,2>{0.77288866f, 0.0933321193f},
-std::array<float,2>{0.39596048f, 0.481220037f},
-std::array<float,2>{0.954302192f, 0.74335444f},
-std::array<float,2>{0.247030407f, 0.90474546f},
-std::array<float,2>{0.619977832f, 0.214017451f},
-std::array<float,2>{0.0822372809f, 0.117963642f},
-std::array<float,2>{0.691551208f, 0.773577571f},
-std::array<float,2>{0.254759252f, 0.570054889f},
-std::array<float,2>{0.867053151f, 0.308424503f},
-std::array<float,2>{0.339820892f, 0.13909623f},
-std::array<float,2>{0.807367623f, 0.942427278f},
-std::array<float,2>{0.0239484068f, 0.634814739f},
-std::array<float,2>{0.679491222f, 0.385515004f},
-std::array<float,2>{0.144365549f, 0.337443173f},
-std::array<float,2>{0.526673734f, 0.528717935f},
-std::array<float,2>{0.450619698f, 0.858955979f},
-std::array<float,2>{0.878734887f, 0.0201358851f},
-std::array<float,2>{0.304820329f, 0.265866399f},
-std::array<float,2>{0.831827521f, 0.623931348f},
-std::array<float,2>{0.110709317f, 0.799379528f},
-std::array<float,2>{0.733691394f, 0.0819225311f},
-std::array<float,2>{0.197788358f, 0.245159566f},
-std::array<float,2>{0.567519724f, 0.91194737f},
-std::array<float,2>{0.414904594f, 0.701441526f},
-std::array<float,2>{0.979134202f, 0.465526134f},
-std::array<float,2>{0.491031379f, 0.0607284866f},
-std::array<float,2>{0.926675379f, 0.820715129f},
-std::array<float,2>{0.174779743f, 0.55715549f},
-std::array<float,2>{0.535423458f, 0.353247166f},
-std::array<float,2>{0.0438172258f, 0.433802605f},
-std::array<float,2>{0.628050447f, 0.678530037f},
-std::array<float,2>{0.347632915f, 0.992203593f},
-std::array<float,2>{0.753388882f, 0.170298249f},
-std::array<float,2>{0.46134153f, 0.36396572f},
-std::array<float,2>{0.895668328f, 0.538925886f},
-std::array<float,2>{0.127517417f, 0.830703855f},
-std::array<float,2>{0.51188004f, 0.0365481041f},
-std::array<float,2>{0.0126601839f, 0.181476444f},
-std::array<float,2>{0.669989526f, 0.97511375f},
-std::array<float,2>{0.31859529f, 0.661307633f},
-std::array<float,2>{0.782625437f, 0.421102792f},
-std::array<float,2>{0.278059185f, 0.0663437322f},
-std::array<float,2>{0.847876728f, 0.788651168f},
-std::array<float,2>{0.070850648f, 0.608021915f},
-std::array<float,2>{0.716592968f, 0.250898927f},
-std::array<float,2>{0.229670808f, 0.447391599f},
-std::array<float,2>{0.59753406f, 0.706087887f},
-std::array<float,2>{0.390180498f, 0.926285267f},
-std::array<float,2>{0.942137539f, 0.22556217f},
-std::array<float,2>{0.374611199f, 0.404469788f},
-std::array<float,2>{0.767315805f, 0.646145821f},
-std::array<float,2>{0.0517059118f, 0.962410152f},
-std::array<float,2>{0.646514356f, 0.145431519f},
-std::array<float,2>{0.169469178f, 0.010350029f},
-std::array<float,2>{0.561248243f, 0.869607449f},
-std::array<float,2>{0.47555089f, 0.513744354f},
-std::array<float,2>{0.919215322f, 0.321489662f},
-std::array<float,2>{0.43491888f, 0.202544376f},
-std::array<float,2>{0.988043427f, 0.877226591f},
-std::array<float,2>{0.207108483f, 0.719259501f},
-std::array<float,2>{0.585864484f, 0.493912011f},
-std::array<float,2>{0.105627015f, 0.289627075f},
-std::array<float,2>{0.739956439f, 0.59013927f},
-std::array<float,2>{0.296683073f, 0.755718231f},
-std::array<float,2>{0.820447683f, 0.107239477f},
-std::array<float,2>{0.478138536f, 0.413996875f},
-std::array<float,2>{0.909963667f, 0.66989851f},
-std::array<float,2>{0.157458782f, 0.978954852f},
-std::array<float,2>{0.553802729f, 0.174562439f},
-std::array<float,2>{0.0555483475f, 0.0427799672f},
-std::array<float,2>{0.65493685f, 0.840523779f},
-std::array<float,2>{0.36610657f, 0.541734636f},
-std::array<float,2>{0.773491085f, 0.374152154f},
-std::array<float,2>{0.285631865f, 0.230567291f},
-std::array<float,2>{0.813563049f, 0.93062073f},
-std::array<float,2>{0.100653775f, 0.718037069f},
-std::array<float,2>{0.744657993f, 0.438764781f},
-std::array<float,2>{0.21768041f, 0.25816524f},
-std::array<float,2>{0.592617989f, 0.600869477f},
-std::array<float,2>{0.422406256f, 0.791035056f},
-std::array<float,2>{0.998178899f, 0.0754977316f},
-std::array<float,2>{0.321841866f, 0.31663093f},
-std::array<float,2>{0.791283786f, 0.501000941f},
-std::array<float,2>{0.0030038252f, 0.860381544f},
-std::array<float,2>{0.660234928f, 0.00197656802f},
-std::array<float,2>{0.137663931f, 0.154307351f},
-std::array<float,2>{0.507422388f, 0.957673788f},
-std::array<float,2>{0.45497337f, 0.653967083f},
-std::array<float,2>{0.898850679f, 0.395891488f},
-std::array<float,2>{0.376658648f, 0.0947507396f},
-std::array<float,2>{0.945972204f, 0.764616311f},
-std::array<float,2>{0.224327147f, 0.583675563f},
-std::array<float,2>{0.60166961f, 0.285464197f},
-std::array<float,2>{0.0676779076f, 0.492158651f},
-std::array<float,2>{0.71080935f, 0.733180404f},
-std::array<float,2>{0.267762661f, 0.889252007f},
-std::array<float,2>{0.856787801f, 0.190112412f},
-std::array<float,2>{0.406348288f, 0.303215921f},
-std::array<float,2>{0.9718647f, 0.572788894f},
-std::array<float,2>{0.19401449f, 0.771052659f},
-std::array<float,2>{0.570627928f, 0.109447792f},
-std::array<float,2>{0.117926173f, 0.204741791f},
-std::array<float,2>{0.725305855f, 0.893811643f},
-std::array<float,2>{0.299274236f, 0.736845255f},
-std::array<float,2>{0.836657763f, 0.472094476f},
-std::array<float,2>{0.351861805f, 0.0249289069f},
-std::array<float,2>{0.764473855f, 0.849135101f},
-std::array<float,2>{0.0388034582f, 0.520920634f},
-std::array<float,2>{0.639208436f, 0.331160575f},
-std::array<float,2>{0.187040657f, 0.377803475f},
-std::array<float,2>{0.5461362f, 0.628182948f},
-std::array<float,2>{0.497844696f, 0.947471142f},
-std::array<float,2>{0.93702805f, 0.131444171f},
-std::array<float,2>{0.264508128f, 0.460575789f},
-std::array<float,2>{0.870516717f, 0.689337611f},
-std::array<float,2>{0.0931461602f, 0.920210183f},
-std::array<float,2>{0.701855719f, 0.237084523f},
-std::array<float,2>{0.241241276f, 0.0895609036f},
-std::array<float,2>{0.615458429f, 0.810751677f},
-std::array<float,2>{0.400240868f, 0.615695715f},
-std::array<float,2>{0.964769185f, 0.278390437f},
-std::array<float,2>{0.444905549f, 0.156473652f},
-std::array<float,2>{0.885150671f, 0.988044918f},
-std::array<float,2>{0.149573952f, 0.68176192f},
-std::array<float,2>{0.515979469f, 0.427931577f},
-std::array<float,2>{0.0231811982f, 0.348098427f},
-std::array<float,2>{0.680841327f, 0.554527164f},
-std::array<float,2>{0.329649895f, 0.817923129f},
-std::array<float,2>{0.801057398f, 0.0477746502f},
-std::array<float,2>{0.410280913f, 0.416531593f},
-std::array<float,2>{0.973110139f, 0.660009861f},
-std::array<float,2>{0.189146101f, 0.970161676f},
-std::array<float,2>{0.575353622f, 0.186753541f},
-std::array<float,2>{0.123308852f, 0.0348723941f},
-std::array<float,2>{0.722452819f, 0.835905254f},
-std::array<float,2>{0.303119093f, 0.533886373f},
-std::array<float,2>{0.841888785f, 0.360109776f},
-std::array<float,2>{0.358821064f, 0.222541049f},
-std::array<float,2>{0.758580565f, 0.923983097f},
-std::array<float,2>{0.0324341431f, 0.707751811f},
-std::array<float,2>{0.633837104f, 0.451193392f},
-std::array<float,2>{0.182493955f, 0.25602892f},
-std::array<float,2>{0.539209306f, 0.605030894f},
-std::array<float,2>{0.495920122f, 0.782528639f},
-std::array<float,2>{0.932451546f, 0.0690640956f},
-std::array<float,2>{0.260797918f, 0.324605256f},
-std::array<float,2>{0.873508394f, 0.50861156f},
-std::array<float,2>{0.0888484418f, 0.873533249f},
-std::array<float,2>{0.697109699f, 0.0119501855f},
-std::array<float,2>{0.23595123f, 0.142474204f},
-std::array<float,2>{0.611271679f, 0.965035498f},
-std::array<float,2>{0.402386814f, 0.64200002f},
-std::array<float,2>{0.968729615f, 0.400801241f},
-std::array<float,2>{0.43888551f, 0.103027232f},
-std::array<float,2>{0.888215303f, 0.751704514f},
-std::array<float,2>{0.155781552f, 0.589482427f},
-std::array<float,2>{0.521585405f, 0.294603974f},
-std::array<float,2>{0.016293779f, 0.496553361f},
-std::array<float,2>{0.686155677f, 0.72651875f},
-std::array<float,2>{0.333429962f, 0.879741788f},
-std::array<float,2>{0.797709167f, 0.19670321f},
-std::array<float,2>{0.481268108f, 0.309213489f},
-std::array<float,2>{0.910453856f, 0.563466251f},
-std::array<float,2>{0.160671324f, 0.77753216f},
-std::array<float,2>{0.550450981f, 0.124343827f},
-std::array<float,2>{0.0618181042f, 0.215586424f},
-std::array<float,2>{0.651661098f, 0.899418175f},
-std::array<float,2>{0.359590709f, 0.749571145f},
-std::array<float,2>{0.778305113f, 0.479817778f},
-std::array<float,2>{0.281962305f, 0.0178854372f},
-std::array<float,2>{0.818531394f, 0.854189456f},
-std::array<float,2>{0.094995372f, 0.524834037f},
-std::array<float,2>{0.748065889f, 0.343110651f},
-std::array<float,2>{0.213525429f, 0.387124628f},
-std::array<float,2>{0.587862909f, 0.637989521f},
-std::array<float,2>{0.427524775f, 0.93794179f},
-std::array<float,2>{0.994631529f, 0.13293843f},
-std::array<float,2>{0.325596422f, 0.462134212f},
-std::array<float,2>{0.794471145f, 0.699174404f},
-std::array<float,2>{0.00511458935f, 0.908945978f},
-std::array<float,2>{0.657809019f, 0.249894962f},
-std::array<float,2>{0.136461139f, 0.0823955163f},
-std::array<float,2>{0.501240313f, 0.80388552f},
-std::array<float,2>{0.460404724f, 0.619971573f},
-std::array<float,2>{0.902804732f, 0.272980988f},
-std::array<float,2>{0.379530877f, 0.164130881f},
-std::array<float,2>{0.951601446f, 0.997203112f},
-std::array<float,2>{0.220605507f, 0.674399197f},
-std::array<float,2>{0.608339131f, 0.43345046f},
-std::array<float,2>{0.0632391572f, 0.356438309f},
-std::array<float,2>{0.705227911f, 0.55910635f},
-std::array<float,2>{0.270739645f, 0.8254233f},
-std::array<float,2>{0.852170944f, 0.0561789162f},
-std::array<float,2>{0.468002707f, 0.472930551f},
-std::array<float,2>{0.892444015f, 0.740086138f},
-std::array<float,2>{0.130843818f, 0.896747887f},
-std::array<float,2>{0.508156121f, 0.207844526f},
-std::array<float,2>{0.0116390781f, 0.115603141f},
-std::array<float,2>{0.667749345f, 0.769088328f},
-std::array<float,2>{0.315460593f, 0.577104211f},
-std::array<float,2>{0.786497295f, 0.297307104f},
-std::array<float,2>{0.27428785f, 0.12818788f},
-std::array<float,2>{0.84660846f, 0.951714396f},
-std::array<float,2>{0.0766625851f, 0.631374896f},
-std::array<float,2>{0.71149224f, 0.382546425f},
-std::array<float,2>{0.230501011f, 0.333824307f},
-std::array<float,2>{0.600654304f, 0.519424856f},
-std::array<float,2>{0.382855684f, 0.846525133f},
-std::array<float,2>{0.940872371f, 0.0309697911f},
-std::array<float,2>{0.3690193f, 0.273688883f},
-std::array<float,2>{0.772379279f, 0.613259971f},
-std::array<float,2>{0.0497401766f, 0.80754602f},
-std::array<float,2>{0.641034126f, 0.0915991664f},
-std::array<float,2>{0.167719588f, 0.241230741f},
-std::array<float,2>{0.554901779f, 0.916455448f},
-std::array<float,2>{0.472288191f, 0.694155693f},
-std::array<float,2>{0.916561544f, 0.456744194f},
-std::array<float,2>{0.43268615f, 0.05092033f},
-std::array<float,2>{0.989833593f, 0.813439727f},
-std::array<float,2>{0.206063002f, 0.547064245f},
-std::array<float,2>{0.581650972f, 0.345427215f},
-std::array<float,2>{0.103347547f, 0.425392449f},
-std::array<float,2>{0.737338483f, 0.684115469f},
-std::array<float,2>{0.28970319f, 0.991824627f},
-std::array<float,2>{0.826679289f, 0.161645681f},
-std::array<float,2>{0.39101553f, 0.367981285f},
-std::array<float,2>{0.958004653f, 0.544600606f},
-std::array<float,2>{0.242750958f, 0.837334692f},
-std::array<float,2>{0.623982012f, 0.0468346365f},
-std::array<float,2>{0.0781643167f, 0.179520741f},
-std::array<float,2>{0.688569844f, 0.981744468f},
-std::array<float,2>{0.25312078f, 0.66439122f},
-std::array<float,2>{0.86205858f, 0.407807738f},
-std::array<float,2>{0.341441393f, 0.0728719383f},
-std::array<float,2>{0.811062157f, 0.794577241f},
-std::array<float,2>{0.031018924f, 0.595064223f},
-std::array<float,2>{0.672518432f, 0.263436824f},
-std::array<float,2>{0.147994667f, 0.444396138f},
-std::array<float,2>{0.528492153f, 0.711215556f},
-std::array<float,2>{0.446114987f, 0.934827209f},
-std::array<float,2>{0.880496323f, 0.227883771f},
-std::array<float,2>{0.312174678f, 0.392592639f},
-std::array<float,2>{0.833844841f, 0.649764299f},
-std::array<float,2>{0.115219653f, 0.953163087f},
-std::array<float,2>{0.729553461f, 0.150028065f},
-std::array<float,2>{0.201566905f, 0.00609739544f},
-std::array<float,2>{0.563303888f, 0.866665304f},
-std::array<float,2>{0.421405017f, 0.507665515f},
-std::array<float,2>{0.984271109f, 0.314911276f},
-std::array<float,2>{0.485719979f, 0.191887647f},
-std::array<float,2>{0.923747182f, 0.884681225f},
-std::array<float,2>{0.177423462f, 0.730315208f},
-std::array<float,2>{0.532597303f, 0.486169338f},
-std::array<float,2>{0.0420494489f, 0.283508152f},
-std::array<float,2>{0.631338537f, 0.57973057f},
-std::array<float,2>{0.349414498f, 0.758185089f},
-std::array<float,2>{0.755070388f, 0.0997175649f},
-std::array<float,2>{0.389194876f, 0.446034193f},
-std::array<float,2>{0.943302333f, 0.704007089f},
-std::array<float,2>{0.229153693f, 0.928679287f},
-std::array<float,2>{0.596337438f, 0.223096415f},
-std::array<float,2>{0.0718959644f, 0.0641942918f},
-std::array<float,2>{0.715216875f, 0.786515713f},
-std::array<float,2>{0.278497308f, 0.606725276f},
-std::array<float,2>{0.849436104f, 0.253282905f},
-std::array<float,2>{0.319857985f, 0.182518929f},
-std::array<float,2>{0.781704605f, 0.974063039f},
-std::array<float,2>{0.0127402907f, 0.662508547f},
-std::array<float,2>{0.671782315f, 0.418474913f},
-std::array<float,2>{0.128355488f, 0.365386635f},
-std::array<float,2>{0.513622344f, 0.535353184f},
-std::array<float,2>{0.461943001f, 0.828267872f},
-std::array<float,2>{0.895005465f, 0.0378204733f},
-std::array<float,2>{0.295260966f, 0.291064113f},
-std::array<float,2>{0.822019339f, 0.593689799f},
-std::array<float,2>{0.106935211f, 0.757202685f},
-std::array<float,2>{0.738442004f, 0.108374834f},
-std::array<float,2>{0.208258972f, 0.200195357f},
-std::array<float,2>{0.584073246f, 0.875745296f},
-std::array<float,2>{0.434352338f, 0.721668065f},
-std::array<float,2>{0.98635757f, 0.495260566f},
-std::array<float,2>{0.47579065f, 0.00808910001f},
-std::array<float,2>{0.918177664f, 0.868364453f},
-std::array<float,2>{0.16814959f, 0.513036966f},
-std::array<float,2>{0.561817169f, 0.32228598f},
-std::array<float,2>{0.0519934371f, 0.404071599f},
-std::array<float,2>{0.64746505f, 0.646618664f},
-std::array<float,2>{0.37326616f, 0.963721991f},
-std::array<float,2>{0.766035378f, 0.147791758f},
-std::array<float,2>{0.449735373f, 0.339820713f},
-std::array<float,2>{0.877716124f, 0.529562414f},
-std::array<float,2>{0.142909944f, 0.857346892f},
-std::array<float,2>{0.526306212f, 0.0228039045f},
-std::array<float,2>{0.02496925f, 0.137600213f},
-std::array<float,2>{0.678640544f, 0.94359535f},
-std::array<float,2>{0.338362634f, 0.634630382f},
-std::array<float,2>{0.807813346f, 0.38339296f},
-std::array<float,2>{0.255089968f, 0.120910481f},
-std::array<float,2>{0.865274072f, 0.776516318f},
-std::array<float,2>{0.0835467428f, 0.567128599f},
-std::array<float,2>{0.693328023f, 0.305025011f},
-std::array<float,2>{0.247898802f, 0.484074622f},
-std::array<float,2>{0.620310426f, 0.745226443f},
-std::array<float,2>{0.395016938f, 0.902413785f},
-std::array<float,2>{0.953580558f, 0.212287784f},
-std::array<float,2>{0.345855594f, 0.436931551f},
-std::array<float,2>{0.752494037f, 0.67744416f},
-std::array<float,2>{0.0443958826f, 0.995869339f},
-std::array<float,2>{0.627003074f, 0.169662431f},
-std::array<float,2>{0.175122797f, 0.0588865578f},
-std::array<float,2>{0.536310732f, 0.822600901f},
-std::array<float,2>{0.491256416f, 0.55575639f},
-std::array<float,2>{0.926834702f, 0.354555398f},
-std::array<float,2>{0.415927202f, 0.243549332f},
-std::array<float,2>{0.980399609f, 0.913561523f},
-std::array<float,2>{0.198770896f, 0.700827479f},
-std::array<float,2>{0.56717968f, 0.467623711f},
-std::array<float,2>{0.10942556f, 0.267854154f},
-std::array<float,2>{0.733268321f, 0.622996747f},
-std::array<float,2>{0.306133717f, 0.797767043f},
-std::array<float,2>{0.830688417f, 0.0794631317f},
-std::array<float,2>{0.496616185f, 0.376038581f},
-std::array<float,2>{0.935770452f, 0.62551713f},
-std::array<float,2>{0.185760707f, 0.946457922f},
-std::array<float,2>{0.545818567f, 0.130298555f},
-std::array<float,2>{0.0374054983f, 0.0270506982f},
-std::array<float,2>{0.639950156f, 0.851511538f},
-std::array<float,2>{0.353507727f, 0.521730602f},
-std::array<float,2>{0.765178502f, 0.33005923f},
-std::array<float,2>{0.300267369f, 0.20667024f},
-std::array<float,2>{0.837775648f, 0.892105997f},
-std::array<float,2>{0.118797712f, 0.734398603f},
-std::array<float,2>{0.726086378f, 0.469316095f},
-std::array<float,2>{0.19484742f, 0.301714242f},
-std::array<float,2>{0.571999073f, 0.571679771f},
-std::array<float,2>{0.407909721f, 0.773209631f},
-std::array<float,2>{0.971367121f, 0.1124769f},
-std::array<float,2>{0.328397334f, 0.350471854f},
-std::array<float,2>{0.802020848f, 0.551583767f},
-std::array<float,2>{0.0221334118f, 0.820000947f},
-std::array<float,2>{0.680144548f, 0.0496045202f},
-std::array<float,2>{0.148757219f, 0.15880008f},
-std::array<float,2>{0.51691407f, 0.986026108f},
-std::array<float,2>{0.443547457f, 0.681166172f},
-std::array<float,2>{0.885946214f, 0.427687973f},
-std::array<float,2>{0.399231702f, 0.0860595703f},
-std::array<float,2>{0.963756323f, 0.809046626f},
-std::array<float,2>{0.240388677f, 0.614457607f},
-std::array<float,2>{0.617142558f, 0.280699223f},
-std::array<float,2>{0.0926527083f, 0.458730489f},
-std::array<float,2>{0.702479601f, 0.690443695f},
-std::array<float,2>{0.265390515f, 0.918394089f},
-std::array<float,2>{0.869620204f, 0.234978423f},
-std::array<float,2>{0.423482329f, 0.260364592f},
-std::array<float,2>{0.999345779f, 0.599176049f},
-std::array<float,2>{0.218526334f, 0.789984763f},
-std::array<float,2>{0.593257248f, 0.0762928352f},
-std::array<float,2>{0.100338347f, 0.234234467f},
-std::array<float,2>{0.745571434f, 0.933319986f},
-std::array<float,2>{0.286349267f, 0.716462076f},
-std::array<float,2>{0.812937856f, 0.439661175f},
-std::array<float,2>{0.366454571f, 0.0394706614f},
-std::array<float,2>{0.774867594f, 0.842638612f},
-std::array<float,2>{0.0560271703f, 0.539699912f},
-std::array<float,2>{0.656084776f, 0.372272879f},
-std::array<float,2>{0.156716213f, 0.411987364f},
-std::array<float,2>{0.553416729f, 0.671365321f},
-std::array<float,2>{0.476839125f, 0.976723075f},
-std::array<float,2>{0.908555686f, 0.173236087f},
-std::array<float,2>{0.268601984f, 0.488472015f},
-std::array<float,2>{0.855724812f, 0.732044458f},
-std::array<float,2>{0.0666497797f, 0.888477802f},
-std::array<float,2>{0.709714115f, 0.189287081f},
-std::array<float,2>{0.223050728f, 0.0967214406f},
-std::array<float,2>{0.603087127f, 0.762796283f},
-std::array<float,2>{0.375498176f, 0.585494637f},
-std::array<float,2>{0.947115839f, 0.287628591f},
-std::array<float,2>{0.45366028f, 0.153646797f},
-std::array<float,2>{0.900333822f, 0.959291458f},
-std::array<float,2>{0.138096631f, 0.655637264f},
-std::array<float,2>{0.506004035f, 0.396658212f},
-std::array<float,2>{0.00289006974f, 0.319383621f},
-std::array<float,2>{0.661855698f, 0.503111422f},
-std::array<float,2>{0.320891768f, 0.861998796f},
-std::array<float,2>{0.792209089f, 0.000306796719f},
-std::array<float,2>{0.406127065f, 0.398555487f},
-std::array<float,2>{0.966528356f, 0.642596662f},
-std::array<float,2>{0.236718819f, 0.96733743f},
-std::array<float,2>{0.6119802f, 0.142823994f},
-std::array<float,2>{0.0867166966f, 0.0148328654f},
-std::array<float,2>{0.697796583f, 0.87266773f},
-std::array<float,2>{0.258716643f, 0.5104298f},
-std::array<float,2>{0.872728288f, 0.327604234f},
-std::array<float,2>{0.334650666f, 0.199162617f},
-std::array<float,2>{0.799460471f, 0.881031156f},
-std::array<float,2>{0.0192887709f, 0.72369951f},
-std::array<float,2>{0.684258163f, 0.499080241f},
-std::array<float,2>{0.152748331f, 0.29514277f},
-std::array<float,2>{0.520676792f, 0.587419868f},
-std::array<float,2>{0.440061569f, 0.753201425f},
-std::array<float,2>{0.890126884f, 0.104328372f},
-std::array<float,2>{0.301410943f, 0.361517727f},
-std::array<float,2>{0.839969218f, 0.531652033f},
-std::array<float,2>{0.121888243f, 0.832962275f},
-std::array<float,2>{0.719744027f, 0.0319127962f},
-std::array<float,2>{0.190299362f, 0.184696615f},
-std::array<float,2>{0.577758789f, 0.971207798f},
-std::array<float,2>{0.413927644f, 0.657196403f},
-std::array<float,2>{0.975034952f, 0.415663242f},
-std::array<float,2>{0.492837548f, 0.0674397796f},
-std::array<float,2>{0.930845082f, 0.783883929f},
-std::array<float,2>{0.181583285f, 0.601827085f},
-std::array<float,2>{0.541655898f, 0.254157722f},
-std::array<float,2>{0.0348830149f, 0.449755579f},
-std::array<float,2>{0.635272264f, 0.710040212f},
-std::array<float,2>{0.356592059f, 0.923585713f},
-std::array<float,2>{0.761162281f, 0.220133588f},
-std::array<float,2>{0.458968699f, 0.269687921f},
-std::array<float,2>{0.904708862f, 0.617822111f},
-std::array<float,2>{0.134220496f, 0.801873386f},
-std::array<float,2>{0.502019465f, 0.0842508674f},
-std::array<float,2>{0.00715386122f, 0.246284723f},
-std::array<float,2>{0.659330428f, 0.906261861f},
-std::array<float,2>{0.326261491f, 0.695401967f},
-std::array<float,2>{0.795364738f, 0.463586539f},
-std::array<float,2>{0.272610754f, 0.0568801835f},
-std::array<float,2>{0.854319155f, 0.826246798f},
-std::array<float,2>{0.0649928376f, 0.560649812f},
-std::array<float,2>{0.703849852f, 0.358942568f},
-std::array<float,2>{0.222049534f, 0.429772764f},
-std::array<float,2>{0.607340336f, 0.672391295f},
-std::array<float,2>{0.380949318f, 0.998069525f},
-std::array<float,2>{0.949919283f, 0.166903839f},
-std::array<float,2>{0.363042861f, 0.478507698f},
-std::array<float,2>{0.7803514f, 0.746395767f},
-std::array<float,2>{0.0604581311f, 0.900707841f},
-std::array<float,2>{0.649354935f, 0.218095258f},
-std::array<float,2>{0.162133023f, 0.122762278f},
-std::array<float,2>{0.547881961f, 0.77944839f},
-std::array<float,2>{0.482884288f, 0.566265345f},
-std::array<float,2>{0.913495958f, 0.310756981f},
-std::array<float,2>{0.428971201f, 0.13581638f},
-std::array<float,2>{0.992403626f, 0.941105127f},
-std::array<float,2>{0.212040156f, 0.639797986f},
-std::array<float,2>{0.588881731f, 0.388774276f},
-std::array<float,2>{0.0965608805f, 0.339935213f},
-std::array<float,2>{0.746641815f, 0.525966704f},
-std::array<float,2>{0.284382194f, 0.851632059f},
-std::array<float,2>{0.817737103f, 0.0158908237f},
-std::array<float,2>{0.470466197f, 0.453295082f},
-std::array<float,2>{0.914307714f, 0.691898406f},
-std::array<float,2>{0.164400205f, 0.914369047f},
-std::array<float,2>{0.557718575f, 0.23869361f},
-std::array<float,2>{0.0484541096f, 0.0922660381f},
-std::array<float,2>{0.643672168f, 0.805891633f},
-std::array<float,2>{0.370800197f, 0.610410213f},
-std::array<float,2>{0.770459116f, 0.276233107f},
-std::array<float,2>{0.29296568f, 0.162973836f},
-std::array<float,2>{0.825170994f, 0.988654554f},
-std::array<float,2>{0.105363645f, 0.686126649f},
-std::array<float,2>{0.736192644f, 0.423324734f},
-std::array<float,2>{0.203446031f, 0.347585291f},
-std::array<float,2>{0.579297364f, 0.549189389f},
-std::array<float,2>{0.430534631f, 0.814604998f},
-std::array<float,2>{0.990267456f, 0.0542791709f},
-std::array<float,2>{0.312949121f, 0.299049616f},
-std::array<float,2>{0.788994312f, 0.57457298f},
-std::array<float,2>{0.00838010386f, 0.765831053f},
-std::array<float,2>{0.665888369f, 0.114982411f},
-std::array<float,2>{0.130905285f, 0.209679648f},
-std::array<float,2>{0.511318684f, 0.896298647f},
-std::array<float,2>{0.466784686f, 0.740271211f},
-std::array<float,2>{0.893487751f, 0.475292295f},
-std::array<float,2>{0.38491264f, 0.0288782995f},
-std::array<float,2>{0.938338995f, 0.843910933f},
-std::array<float,2>{0.234137088f, 0.516559005f},
-std::array<float,2>{0.599198639f, 0.3355124f},
-std::array<float,2>{0.0760333389f, 0.380243123f},
-std::array<float,2>{0.713191152f, 0.629083693f},
-std::array<float,2>{0.275696367f, 0.950411201f},
-std::array<float,2>{0.845627725f, 0.126285538f},
-std::array<float,2>{0.4190799f, 0.313428164f},
-std::array<float,2>{0.982239723f, 0.503957033f},
-std::array<float,2>{0.200712845f, 0.863628209f},
-std::array<float,2>{0.564811826f, 0.00561161758f},
-std::array<float,2>{0.116501734f, 0.152207538f},
-std::array<float,2>{0.726866543f, 0.956727922f},
-std::array<float,2>{0.308967263f, 0.651270211f},
-std::array<float,2>{0.83590436f, 0.392361552f},
-std::array<float,2>{0.35000515f, 0.0978825986f},
-std::array<float,2>{0.756088734f, 0.761684179f},
-std::array<float,2>{0.0392547101f, 0.580845535f},
-std::array<float,2>{0.629403293f, 0.282933593f},
-std::array<float,2>{0.179661006f, 0.488116056f},
-std::array<float,2>{0.53398335f, 0.727843761f},
-std::array<float,2>{0.486350894f, 0.886050284f},
-std::array<float,2>{0.924183965f, 0.195259482f},
-std::array<float,2>{0.250984788f, 0.410077631f},
-std::array<float,2>{0.861023903f, 0.666430414f},
-std::array<float,2>{0.0800993219f, 0.983258307f},
-std::array<float,2>{0.689866602f, 0.177166939f},
-std::array<float,2>{0.244506449f, 0.0441309847f},
-std::array<float,2>{0.622860909f, 0.839177787f},
-std::array<float,2>{0.392612904f, 0.544978797f},
-std::array<float,2>{0.960046828f, 0.37037316f},
-std::array<float,2>{0.447291464f, 0.230349869f},
-std::array<float,2>{0.882207096f, 0.935978174f},
-std::array<float,2>{0.145409957f, 0.713891506f},
-std::array<float,2>{0.530061364f, 0.442422867f},
-std::array<float,2>{0.0280528702f, 0.265031427f},
-std::array<float,2>{0.674731553f, 0.596120775f},
-std::array<float,2>{0.343259215f, 0.795922875f},
-std::array<float,2>{0.809795022f, 0.0719928443f},
-std::array<float,2>{0.437267154f, 0.492640376f},
-std::array<float,2>{0.985528111f, 0.720243216f},
-std::array<float,2>{0.209515497f, 0.878547311f},
-std::array<float,2>{0.58390981f, 0.201728821f},
-std::array<float,2>{0.107936643f, 0.105729118f},
-std::array<float,2>{0.741211891f, 0.754636109f},
-std::array<float,2>{0.294822216f, 0.591519952f},
-std::array<float,2>{0.823723078f, 0.290727139f},
-std::array<float,2>{0.372567892f, 0.145986676f},
-std::array<float,2>{0.767748356f, 0.961679578f},
-std::array<float,2>{0.0535433441f, 0.645209789f},
-std::array<float,2>{0.644610643f, 0.405282706f},
-std::array<float,2>{0.171194091f, 0.320835769f},
-std::array<float,2>{0.56013304f, 0.514977396f},
-std::array<float,2>{0.474146724f, 0.870857477f},
-std::array<float,2>{0.921426833f, 0.0111996951f},
-std::array<float,2>{0.27979207f, 0.251659602f},
-std::array<float,2>{0.850756943f, 0.608479738f},
-std::array<float,2>{0.072991848f, 0.788000047f},
-std::array<float,2>{0.717413306f, 0.0645353571f},
-std::array<float,2>{0.227683812f, 0.226054847f},
-std::array<float,2>{0.595241547f, 0.927456379f},
-std::array<float,2>{0.388647705f, 0.70576942f},
-std::array<float,2>{0.945189238f, 0.448281378f},
-std::array<float,2>{0.463390052f, 0.0353761315f},
-std::array<float,2>{0.898269057f, 0.831576884f},
-std::array<float,2>{0.126430735f, 0.537970483f},
-std::array<float,2>{0.515474558f, 0.364273459f},
-std::array<float,2>{0.0143128475f, 0.420483768f},
-std::array<float,2>{0.668951094f, 0.660548925f},
-std::array<float,2>{0.31798318f, 0.975612402f},
-std::array<float,2>{0.783466876f, 0.17970024f},
-std::array<float,2>{0.488783717f, 0.352185369f},
-std::array<float,2>{0.929195464f, 0.558264434f},
-std::array<float,2>{0.172798991f, 0.821429431f},
-std::array<float,2>{0.53781271f, 0.062300507f},
-std::array<float,2>{0.0468077101f, 0.171750113f},
-std::array<float,2>{0.626073301f, 0.993612885f},
-std::array<float,2>{0.343894631f, 0.678813636f},
-std::array<float,2>{0.751423001f, 0.434663028f},
-std::array<float,2>{0.306799352f, 0.0805902481f},
-std::array<float,2>{0.828476846f, 0.799901366f},
-std::array<float,2>{0.113139205f, 0.624871254f},
-std::array<float,2>{0.731889546f, 0.267334133f},
-std::array<float,2>{0.195479408f, 0.466504365f},
-std::array<float,2>{0.569131076f, 0.702485323f},
-std::array<float,2>{0.416742772f, 0.911114633f},
-std::array<float,2>{0.978323042f, 0.245070055f},
-std::array<float,2>{0.337589324f, 0.386647254f},
-std::array<float,2>{0.806057215f, 0.636134565f},
-std::array<float,2>{0.025661245f, 0.942189157f},
-std::array<float,2>{0.676339447f, 0.139700338f},
-std::array<float,2>{0.141718313f, 0.0205533467f},
-std::array<float,2>{0.524270415f, 0.858026743f},
-std::array<float,2>{0.45200786f, 0.528199553f},
-std::array<float,2>{0.876455963f, 0.335981399f},
-std::array<float,2>{0.397602797f, 0.213514075f},
-std::array<float,2>{0.95584482f, 0.90600878f},
-std::array<float,2>{0.249649554f, 0.742218494f},
-std::array<float,2>{0.617369771f, 0.481571257f},
-std::array<float,2>{0.0841807276f, 0.306935936f},
-std::array<float,2>{0.693893135f, 0.568902194f},
-std::array<float,2>{0.257027447f, 0.774464726f},
-std::array<float,2>{0.864511847f, 0.118798681f},
-std::array<float,2>{0.442462295f, 0.429202646f},
-std::array<float,2>{0.883682668f, 0.68279475f},
-std::array<float,2>{0.151998982f, 0.986938298f},
-std::array<float,2>{0.518065929f, 0.157361135f},
-std::array<float,2>{0.0207571983f, 0.0481401607f},
-std::array<float,2>{0.682395339f, 0.816904604f},
-std::array<float,2>{0.330649585f, 0.552979708f},
-std::array<float,2>{0.80441308f, 0.348985165f},
-std::array<float,2>{0.262923062f, 0.238214552f},
-std::array<float,2>{0.868987322f, 0.921054542f},
-std::array<float,2>{0.0910445824f, 0.687547445f},
-std::array<float,2>{0.70063287f, 0.459045023f},
-std::array<float,2>{0.239746332f, 0.27810353f},
-std::array<float,2>{0.61501497f, 0.616676211f},
-std::array<float,2>{0.401967883f, 0.811696291f},
-std::array<float,2>{0.962233365f, 0.0882576108f},
-std::array<float,2>{0.355363488f, 0.330802798f},
-std::array<float,2>{0.761795819f, 0.519624829f},
-std::array<float,2>{0.0370992832f, 0.848470211f},
-std::array<float,2>{0.637660503f, 0.0239106305f},
-std::array<float,2>{0.183772713f, 0.132267669f},
-std::array<float,2>{0.543134212f, 0.948759913f},
-std::array<float,2>{0.499610484f, 0.627573311f},
-std::array<float,2>{0.934799194f, 0.378712058f},
-std::array<float,2>{0.409448445f, 0.110999152f},
-std::array<float,2>{0.968938649f, 0.769750834f},
-std::array<float,2>{0.192559123f, 0.574195266f},
-std::array<float,2>{0.572356284f, 0.304256529f},
-std::array<float,2>{0.120012119f, 0.47082001f},
-std::array<float,2>{0.724279523f, 0.737721443f},
-std::array<float,2>{0.297868818f, 0.892852128f},
-std::array<float,2>{0.839783013f, 0.203757808f},
-std::array<float,2>{0.378210008f, 0.286481589f},
-std::array<float,2>{0.949140489f, 0.582786262f},
-std::array<float,2>{0.226265803f, 0.765454113f},
-std::array<float,2>{0.60457027f, 0.094481416f},
-std::array<float,2>{0.0685572773f, 0.190521941f},
-std::array<float,2>{0.708845139f, 0.890094817f},
-std::array<float,2>{0.266863912f, 0.733937621f},
-std::array<float,2>{0.859022141f, 0.490341991f},
-std::array<float,2>{0.322975367f, 0.00353698013f},
-std::array<float,2>{0.789519548f, 0.859583855f},
-std::array<float,2>{0.00125370454f, 0.500673234f},
-std::array<float,2>{0.662921786f, 0.318157583f},
-std::array<float,2>{0.139586642f, 0.395132214f},
-std::array<float,2>{0.505408466f, 0.652556419f},
-std::array<float,2>{0.455504864f, 0.958938658f},
-std::array<float,2>{0.901399732f, 0.156137079f},
-std::array<float,2>{0.288942039f, 0.438145727f},
-std::array<float,2>{0.816256225f, 0.717428386f},
-std::array<float,2>{0.0983973593f, 0.931606114f},
-std::array<float,2>{0.742515504f, 0.232030511f},
-std::array<float,2>{0.215236366f, 0.0743742883f},
-std::array<float,2>{0.590814233f, 0.792658448f},
-std::array<float,2>{0.424792588f, 0.600440562f},
-std::array<float,2>{0.997740209f, 0.258832216f},
-std::array<float,2>{0.479357868f, 0.174876764f},
-std::array<float,2>{0.907426596f, 0.979674101f},
-std::array<float,2>{0.159394652f, 0.668205082f},
-std::array<float,2>{0.552723408f, 0.412751138f},
-std::array<float,2>{0.05751542f, 0.374022216f},
-std::array<float,2>{0.653200746f, 0.542521715f},
-std::array<float,2>{0.364795476f, 0.841584563f},
-std::array<float,2>{0.776806355f, 0.0411158614f},
-std::array<float,2>{0.393458188f, 0.407593727f},
-std::array<float,2>{0.960728347f, 0.66474396f},
-std::array<float,2>{0.244722918f, 0.98224175f},
-std::array<float,2>{0.622144938f, 0.178793401f},
-std::array<float,2>{0.0808951706f, 0.0459043309f},
-std::array<float,2>{0.690138459f, 0.837821424f},
-std::array<float,2>{0.251890182f, 0.543971539f},
-std::array<float,2>{0.860407174f, 0.367669523f},
-std::array<float,2>{0.343426794f, 0.228423387f},
-std::array<float,2>{0.810466051f, 0.93549931f},
-std::array<float,2>{0.0275072753f, 0.711885035f},
-std::array<float,2>{0.674103558f, 0.444896817f},
-std::array<float,2>{0.14491801f, 0.262933731f},
-std::array<float,2>{0.529382169f, 0.595385969f},
-std::array<float,2>{0.448149085f, 0.794073522f},
-std::array<float,2>{0.882607698f, 0.0727142915f},
-std::array<float,2>{0.309090346f, 0.315145105f},
-std::array<float,2>{0.835012734f, 0.507102549f},
-std::array<float,2>{0.116885699f, 0.867097855f},
-std::array<float,2>{0.727164984f, 0.00637607882f},
-std::array<float,2>{0.200349271f, 0.149807513f},
-std::array<float,2>{0.565053642f, 0.953854859f},
-std::array<float,2>{0.419800192f, 0.65010792f},
-std::array<float,2>{0.981877983f, 0.393318743f},
-std::array<float,2>{0.486823767f, 0.100516789f},
-std::array<float,2>{0.924679577f, 0.75844264f},
-std::array<float,2>{0.178964302f, 0.579580367f},
-std::array<float,2>{0.533255935f, 0.283965409f},
-std::array<float,2>{0.0396547467f, 0.485399097f},
-std::array<float,2>{0.629223883f, 0.72967118f},
-std::array<float,2>{0.35011217f, 0.884082794f},
-std::array<float,2>{0.756361425f, 0.192346871f},
-std::array<float,2>{0.465885162f, 0.297398031f},
-std::array<float,2>{0.892717659f, 0.576485157f},
-std::array<float,2>{0.131792963f, 0.768714249f},
-std::array<float,2>{0.510893047f, 0.116173021f},
-std::array<float,2>{0.00811994076f, 0.207406417f},
-std::array<float,2>{0.665197551f, 0.897041917f},
-std::array<float,2>{0.313047707f, 0.739602923f},
-std::array<float,2>{0.788171351f, 0.473426014f},
-std::array<float,2>{0.276156604f, 0.0303753354f},
-std::array<float,2>{0.845211089f, 0.846031487f},
-std::array<float,2>{0.0755196586f, 0.518942535f},
-std::array<float,2>{0.713516057f, 0.333452731f},
-std::array<float,2>{0.233572364f, 0.382165521f},
-std::array<float,2>{0.598746359f, 0.63093853f},
-std::array<float,2>{0.385507762f, 0.951278448f},
-std::array<float,2>{0.937935174f, 0.128536835f},
-std::array<float,2>{0.370274454f, 0.456542313f},
-std::array<float,2>{0.770018756f, 0.693417013f},
-std::array<float,2>{0.047969088f, 0.916975856f},
-std::array<float,2>{0.644430518f, 0.241781801f},
-std::array<float,2>{0.164737687f, 0.0912052616f},
-std::array<float,2>{0.55828172f, 0.806727707f},
-std::array<float,2>{0.469746828f, 0.612345874f},
-std::array<float,2>{0.914551735f, 0.274039805f},
-std::array<float,2>{0.429824293f, 0.161147594f},
-std::array<float,2>{0.990963876f, 0.991471529f},
-std::array<float,2>{0.204033345f, 0.683967888f},
-std::array<float,2>{0.580077231f, 0.425193727f},
-std::array<float,2>{0.104863144f, 0.34520781f},
-std::array<float,2>{0.735390604f, 0.547464013f},
-std::array<float,2>{0.292330861f, 0.812554061f},
-std::array<float,2>{0.824586332f, 0.0512866117f},
-std::array<float,2>{0.483240485f, 0.480115891f},
-std::array<float,2>{0.913574457f, 0.749047577f},
-std::array<float,2>{0.162718982f, 0.900254965f},
-std::array<float,2>{0.548641205f, 0.215309888f},
-std::array<float,2>{0.0596318729f, 0.124605589f},
-std::array<float,2>{0.648670197f, 0.777964652f},
-std::array<float,2>{0.362376958f, 0.562806726f},
-std::array<float,2>{0.780886471f, 0.308639199f},
-std::array<float,2>{0.284967154f, 0.133669615f},
-std::array<float,2>{0.818166554f, 0.938276887f},
-std::array<float,2>{0.09590552f, 0.638280749f},
-std::array<float,2>{0.746366739f, 0.387329638f},
-std::array<float,2>{0.21265614f, 0.343498677f},
-std::array<float,2>{0.589794934f, 0.525025904f},
-std::array<float,2>{0.429200292f, 0.853613496f},
-std::array<float,2>{0.993087232f, 0.0183383673f},
-std::array<float,2>{0.326893479f, 0.272718221f},
-std::array<float,2>{0.795740128f, 0.619595349f},
-std::array<float,2>{0.00755999004f, 0.804463089f},
-std::array<float,2>{0.659879565f, 0.0827263519f},
-std::array<float,2>{0.134649858f, 0.249225333f},
-std::array<float,2>{0.502666175f, 0.9083938f},
-std::array<float,2>{0.458290398f, 0.698297262f},
-std::array<float,2>{0.904851496f, 0.462655753f},
-std::array<float,2>{0.381367922f, 0.0560112745f},
-std::array<float,2>{0.94965297f, 0.826006591f},
-std::array<float,2>{0.222591743f, 0.558700144f},
-std::array<float,2>{0.60685879f, 0.355566233f},
-std::array<float,2>{0.0644891113f, 0.432768106f},
-std::array<float,2>{0.703400373f, 0.674181938f},
-std::array<float,2>{0.27341339f, 0.997665703f},
-std::array<float,2>{0.853942335f, 0.164558947f},
-std::array<float,2>{0.413439363f, 0.359588057f},
-std::array<float,2>{0.975439727f, 0.533680141f},
-std::array<float,2>{0.189609244f, 0.835278273f},
-std::array<float,2>{0.577277124f, 0.0342031829f},
-std::array<float,2>{0.121575706f, 0.187231496f},
-std::array<float,2>{0.720215321f, 0.970319569f},
-std::array<float,2>{0.300942481f, 0.65921855f},
-std::array<float,2>{0.84052223f, 0.416338444f},
-std::array<float,2>{0.357122064f, 0.0684396774f},
-std::array<float,2>{0.761326671f, 0.783003151f},
-std::array<float,2>{0.0342795439f, 0.604560435f},
-std::array<float,2>{0.634991705f, 0.256813616f},
-std::array<float,2>{0.181010127f, 0.451676577f},
-std::array<float,2>{0.541255236f, 0.707294881f},
-std::array<float,2>{0.492670506f, 0.924775183f},
-std::array<float,2>{0.931621611f, 0.22180301f},
-std::array<float,2>{0.25783509f, 0.401241899f},
-std::array<float,2>{0.872368872f, 0.642309964f},
-std::array<float,2>{0.0863406062f, 0.965628743f},
-std::array<float,2>{0.697512031f, 0.141640693f},
-std::array<float,2>{0.2370148f, 0.0122267883f},
-std::array<float,2>{0.611703038f, 0.873773932f},
-std::array<float,2>{0.405741572f, 0.508202851f},
-std::array<float,2>{0.966042936f, 0.325164229f},
-std::array<float,2>{0.439670533f, 0.197051391f},
-std::array<float,2>{0.890264452f, 0.878937244f},
-std::array<float,2>{0.153183699f, 0.72589159f},
-std::array<float,2>{0.52116251f, 0.496884137f},
-std::array<float,2>{0.0190175045f, 0.294318736f},
-std::array<float,2>{0.683756948f, 0.589156151f},
-std::array<float,2>{0.334277153f, 0.751165092f},
-std::array<float,2>{0.798835278f, 0.103240751f},
-std::array<float,2>{0.423899204f, 0.440096408f},
-std::array<float,2>{0.997430444f, 0.71603328f},
-std::array<float,2>{0.21536532f, 0.932823122f},
-std::array<float,2>{0.589860082f, 0.233794868f},
-std::array<float,2>{0.0977662653f, 0.0771015435f},
-std::array<float,2>{0.742879033f, 0.78909409f},
-std::array<float,2>{0.28844884f, 0.598639846f},
-std::array<float,2>{0.815453231f, 0.260183454f},
-std::array<float,2>{0.36463508f, 0.173778147f},
-std::array<float,2>{0.777054787f, 0.977242768f},
-std::array<float,2>{0.056975197f, 0.671686232f},
-std::array<float,2>{0.652725101f, 0.411493033f},
-std::array<float,2>{0.1598396f, 0.372912437f},
-std::array<float,2>{0.55185771f, 0.539075732f},
-std::array<float,2>{0.478564173f, 0.842030048f},
-std::array<float,2>{0.907720864f, 0.0398829393f},
-std::array<float,2>{0.267255306f, 0.28711158f},
-std::array<float,2>{0.85863024f, 0.585289121f},
-std::array<float,2>{0.0692341328f, 0.763235748f},
-std::array<float,2>{0.708494842f, 0.0973800793f},
-std::array<float,2>{0.225674763f, 0.18874988f},
-std::array<float,2>{0.605101228f, 0.887704492f},
-std::array<float,2>{0.378582239f, 0.731471062f},
-std::array<float,2>{0.948253751f, 0.488798589f},
-std::array<float,2>{0.455718428f, 0.000830378849f},
-std::array<float,2>{0.902080595f, 0.861610055f},
-std::array<float,2>{0.139124885f, 0.503768742f},
-std::array<float,2>{0.505143762f, 0.320090532f},
-std::array<float,2>{0.00175128656f, 0.397298008f},
-std::array<float,2>{0.662525594f, 0.655784547f},
-std::array<float,2>{0.322419524f, 0.959622681f},
-std::array<float,2>{0.789675236f, 0.153854191f},
-std::array<float,2>{0.499386519f, 0.329149425f},
-std::array<float,2>{0.935486555f, 0.5224033f},
-std::array<float,2>{0.184181899f, 0.85077703f},
-std::array<float,2>{0.543770313f, 0.0267212242f},
-std::array<float,2>{0.0364296511f, 0.130497515f},
-std::array<float,2>{0.636970043f, 0.946942687f},
-std::array<float,2>{0.354596138f, 0.625251532f},
-std::array<float,2>{0.762470722f, 0.37659815f},
-std::array<float,2>{0.298742712f, 0.112802982f},
-std::array<float,2>{0.839065969f, 0.772636533f},
-std::array<float,2>{0.119440436f, 0.572009861f},
-std::array<float,2>{0.723753214f, 0.300845534f},
-std::array<float,2>{0.193216637f, 0.46878624f},
-std::array<float,2>{0.572983027f, 0.735136688f},
-std::array<float,2>{0.410128653f, 0.891699255f},
-std::array<float,2>{0.969568074f, 0.206306204f},
-std::array<float,2>{0.330516368f, 0.426841408f},
-std::array<float,2>{0.803763866f, 0.680742919f},
-std::array<float,2>{0.0211778246f, 0.985605478f},
-std::array<float,2>{0.681969523f, 0.158467457f},
-std::array<float,2>{0.151511461f, 0.0489916913f},
-std::array<float,2>{0.518145382f, 0.819608986f},
-std::array<float,2>{0.443314403f, 0.550898135f},
-std::array<float,2>{0.883017898f, 0.349838644f},
-std::array<float,2>{0.401384145f, 0.234801516f},
-std::array<float,2>{0.962645352f, 0.91856432f},
-std::array<float,2>{0.239727825f, 0.691285849f},
-std::array<float,2>{0.614311576f, 0.458276153f},
-std::array<float,2>{0.0915354341f, 0.280903578f},
-std::array<float,2>{0.701006711f, 0.614999473f},
-std::array<float,2>{0.263269454f, 0.809169888f},
-std::array<float,2>{0.868596792f, 0.0866183266f},
-std::array<float,2>{0.451297194f, 0.383123785f},
-std::array<float,2>{0.876855373f, 0.634046495f},
-std::array<float,2>{0.142421678f, 0.94396317f},
-std::array<float,2>{0.523712933f, 0.136803403f},
-std::array<float,2>{0.0262917448f, 0.023335645f},
-std::array<float,2>{0.675935447f, 0.856761754f},
-std::array<float,2>{0.337134331f, 0.53011477f},
-std::array<float,2>{0.806277812f, 0.338944972f},
-std::array<float,2>{0.257769138f, 0.212712318f},
-std::array<float,2>{0.864917099f, 0.902939737f},
-std::array<float,2>{0.0845513642f, 0.745708108f},
-std::array<float,2>{0.693830907f, 0.483710289f},
-std::array<float,2>{0.249128267f, 0.305378109f},
-std::array<float,2>{0.617679954f, 0.566883206f},
-std::array<float,2>{0.397981107f, 0.777164876f},
-std::array<float,2>{0.955540657f, 0.120523274f},
-std::array<float,2>{0.344695508f, 0.354991704f},
-std::array<float,2>{0.751514912f, 0.556540489f},
-std::array<float,2>{0.0460465066f, 0.822846651f},
-std::array<float,2>{0.626570225f, 0.0591746569f},
-std::array<float,2>{0.172112703f, 0.169131547f},
-std::array<float,2>{0.537168086f, 0.995473921f},
-std::array<float,2>{0.488461524f, 0.676818609f},
-std::array<float,2>{0.92951113f, 0.437219113f},
-std::array<float,2>{0.416389823f, 0.0795930997f},
-std::array<float,2>{0.977857888f, 0.797071815f},
-std::array<float,2>{0.195914924f, 0.622270703f},
-std::array<float,2>{0.56866622f, 0.268108904f},
-std::array<float,2>{0.112383425f, 0.467242807f},
-std::array<float,2>{0.732132018f, 0.70060873f},
-std::array<float,2>{0.307609409f, 0.913735926f},
-std::array<float,2>{0.828927279f, 0.243761912f},
-std::array<float,2>{0.387934536f, 0.253688604f},
-std::array<float,2>{0.944352031f, 0.606952369f},
-std::array<float,2>{0.228438705f, 0.787021458f},
-std::array<float,2>{0.594891667f, 0.0639248416f},
-std::array<float,2>{0.072539039f, 0.22348547f},
-std::array<float,2>{0.717012525f, 0.928169489f},
-std::array<float,2>{0.279776245f, 0.703487396f},
-std::array<float,2>{0.85116142f, 0.44542262f},
-std::array<float,2>{0.317505836f, 0.037261378f},
-std::array<float,2>{0.784083247f, 0.828895986f},
-std::array<float,2>{0.0139779719f, 0.535815954f},
-std::array<float,2>{0.669756949f, 0.365952671f},
-std::array<float,2>{0.126915127f, 0.417982429f},
-std::array<float,2>{0.515131056f, 0.662746966f},
-std::array<float,2>{0.463050097f, 0.974598289f},
-std::array<float,2>{0.897683799f, 0.181875288f},
-std::array<float,2>{0.294087529f, 0.496088296f},
-std::array<float,2>{0.823735476f, 0.72081542f},
-std::array<float,2>{0.107730515f, 0.875035703f},
-std::array<float,2>{0.741932154f, 0.200978875f},
-std::array<float,2>{0.209054947f, 0.107795537f},
-std::array<float,2>{0.583187938f, 0.757642567f},
-std::array<float,2>{0.436871707f, 0.592981458f},
-std::array<float,2>{0.985946536f, 0.291624308f},
-std::array<float,2>{0.473812044f, 0.148352399f},
-std::array<float,2>{0.921116889f, 0.963161528f},
-std::array<float,2>{0.171650127f, 0.647303581f},
-std::array<float,2>{0.559649408f, 0.403469503f},
-std::array<float,2>{0.0529330559f, 0.323067278f},
-std::array<float,2>{0.645361185f, 0.513353944f},
-std::array<float,2>{0.37217465f, 0.868688941f},
-std::array<float,2>{0.768415749f, 0.00844192784f},
-std::array<float,2>{0.421075165f, 0.392041206f},
-std::array<float,2>{0.983609498f, 0.650509298f},
-std::array<float,2>{0.20208776f, 0.956065834f},
-std::array<float,2>{0.5626899f, 0.151796728f},
-std::array<float,2>{0.114609204f, 0.00520540727f},
-std::array<float,2>{0.730225205f, 0.864169359f},
-std::array<float,2>{0.31177789f, 0.504807472f},
-std::array<float,2>{0.833486438f, 0.312590748f},
-std::array<float,2>{0.348925173f, 0.194438308f},
-std::array<float,2>{0.755667329f, 0.886303723f},
-std::array<float,2>{0.0426207148f, 0.72812134f},
-std::array<float,2>{0.631805241f, 0.487671405f},
-std::array<float,2>{0.177191854f, 0.282587886f},
-std::array<float,2>{0.533062875f, 0.580303192f},
-std::array<float,2>{0.486059397f, 0.760981739f},
-std::array<float,2>{0.923279822f, 0.09855856f},
-std::array<float,2>{0.253736645f, 0.370846301f},
-std::array<float,2>{0.86140722f, 0.545802116f},
-std::array<float,2>{0.0788916126f, 0.83975184f},
-std::array<float,2>{0.689273417f, 0.0444467738f},
-std::array<float,2>{0.24228996f, 0.177459136f},
-std::array<float,2>{0.623330653f, 0.982453048f},
-std::array<float,2>{0.391240448f, 0.666701317f},
-std::array<float,2>{0.957040131f, 0.409417659f},
-std::array<float,2>{0.445659459f, 0.0713689402f},
-std::array<float,2>{0.880327702f, 0.796423435f},
-std::array<float,2>{0.147781789f, 0.596571803f},
-std::array<float,2>{0.529097617f, 0.265188187f},
-std::array<float,2>{0.0306429658f, 0.442872226f},
-std::array<float,2>{0.672092974f, 0.714776099f},
-std::array<float,2>{0.340892404f, 0.936215162f},
-std::array<float,2>{0.810779154f, 0.229662508f},
-std::array<float,2>{0.472148389f, 0.275456786f},
-std::array<float,2>{0.916462123f, 0.611175358f},
-std::array<float,2>{0.167123243f, 0.80633384f},
-std::array<float,2>{0.555597544f, 0.0922923237f},
-std::array<float,2>{0.0490054302f, 0.23896049f},
-std::array<float,2>{0.641226649f, 0.914880931f},
-std::array<float,2>{0.368268669f, 0.691513956f},
-std::array<float,2>{0.771509588f, 0.453834683f},
-std::array<float,2>{0.289219171f, 0.0538583137f},
-std::array<float,2>{0.826464474f, 0.815132916f},
-std::array<float,2>{0.102997422f, 0.549508691f},
-std::array<float,2>{0.737947226f, 0.346980244f},
-std::array<float,2>{0.206726015f, 0.423406512f},
-std::array<float,2>{0.581495881f, 0.685984612f},
-std::array<float,2>{0.433196932f, 0.988864779f},
-std::array<float,2>{0.989563048f, 0.162190542f},
-std::array<float,2>{0.316158563f, 0.475058168f},
-std::array<float,2>{0.78707546f, 0.740891993f},
-std::array<float,2>{0.0110379374f, 0.89552772f},
-std::array<float,2>{0.667215109f, 0.209034517f},
-std::array<float,2>{0.130194351f, 0.114446081f},
-std::array<float,2>{0.508511722f, 0.766586304f},
-std::array<float,2>{0.468568087f, 0.575127065f},
-std::array<float,2>{0.891753495f, 0.299360693f},
-std::array<float,2>{0.383756578f, 0.126542583f},
-std::array<float,2>{0.941363513f, 0.950956941f},
-std::array<float,2>{0.231376156f, 0.629567206f},
-std::array<float,2>{0.601389229f, 0.380821109f},
-std::array<float,2>{0.0763813853f, 0.335433066f},
-std::array<float,2>{0.711405396f, 0.515696347f},
-std::array<float,2>{0.273774028f, 0.844440222f},
-std::array<float,2>{0.846065581f, 0.0285822731f},
-std::array<float,2>{0.46053648f, 0.463328391f},
-std::array<float,2>{0.903173983f, 0.696267605f},
-std::array<float,2>{0.13595514f, 0.90691185f},
-std::array<float,2>{0.501515329f, 0.246608675f},
-std::array<float,2>{0.00571561838f, 0.0849450231f},
-std::array<float,2>{0.657271206f, 0.802614152f},
-std::array<float,2>{0.325705171f, 0.61765492f},
-std::array<float,2>{0.794209778f, 0.270160466f},
-std::array<float,2>{0.271324575f, 0.166039169f},
-std::array<float,2>{0.851758778f, 0.998609662f},
-std::array<float,2>{0.062539652f, 0.671944499f},
-std::array<float,2>{0.705950499f, 0.43064332f},
-std::array<float,2>{0.220079646f, 0.35887894f},
-std::array<float,2>{0.607667148f, 0.561382115f},
-std::array<float,2>{0.378908366f, 0.826936245f},
-std::array<float,2>{0.951698124f, 0.0571893342f},
-std::array<float,2>{0.359873325f, 0.311386108f},
-std::array<float,2>{0.777792811f, 0.565656066f},
-std::array<float,2>{0.0622394308f, 0.780259848f},
-std::array<float,2>{0.652149379f, 0.122530431f},
-std::array<float,2>{0.160174116f, 0.218487144f},
-std::array<float,2>{0.550062895f, 0.901163459f},
-std::array<float,2>{0.480723292f, 0.74664098f},
-std::array<float,2>{0.91090256f, 0.477698833f},
-std::array<float,2>{0.427209407f, 0.0162121002f},
-std::array<float,2>{0.994546294f, 0.852175832f},
-std::array<float,2>{0.213313058f, 0.525599182f},
-std::array<float,2>{0.587379217f, 0.340765864f},
-std::array<float,2>{0.0954060704f, 0.389413059f},
-std::array<float,2>{0.748610675f, 0.640398681f},
-std::array<float,2>{0.281356514f, 0.940591633f},
-std::array<float,2>{0.819198608f, 0.136401579f},
-std::array<float,2>{0.403049558f, 0.327638328f},
-std::array<float,2>{0.9681831f, 0.510062873f},
-std::array<float,2>{0.235616222f, 0.872438788f},
-std::array<float,2>{0.610432923f, 0.0153438514f},
-std::array<float,2>{0.088201426f, 0.143361181f},
-std::array<float,2>{0.696498215f, 0.967267752f},
-std::array<float,2>{0.261408418f, 0.643256783f},
-std::array<float,2>{0.873955131f, 0.399056137f},
-std::array<float,2>{0.333593041f, 0.103559539f},
-std::array<float,2>{0.797181845f, 0.75362438f},
-std::array<float,2>{0.0159131996f, 0.587263346f},
-std::array<float,2>{0.685606062f, 0.2957941f},
-std::array<float,2>{0.155498415f, 0.499511749f},
-std::array<float,2>{0.522265613f, 0.724376142f},
-std::array<float,2>{0.439007849f, 0.8817662f},
-std::array<float,2>{0.887796938f, 0.198628038f},
-std::array<float,2>{0.303612918f, 0.415288806f},
-std::array<float,2>{0.842541933f, 0.656347692f},
-std::array<float,2>{0.123966582f, 0.971096933f},
-std::array<float,2>{0.722066522f, 0.185286954f},
-std::array<float,2>{0.188638702f, 0.0314421058f},
-std::array<float,2>{0.575813115f, 0.832064033f},
-std::array<float,2>{0.410827667f, 0.532070339f},
-std::array<float,2>{0.973335683f, 0.361985952f},
-std::array<float,2>{0.495282561f, 0.22037816f},
-std::array<float,2>{0.931778491f, 0.923129022f},
-std::array<float,2>{0.182107612f, 0.710744858f},
-std::array<float,2>{0.539656639f, 0.449565589f},
-std::array<float,2>{0.0330222882f, 0.254838645f},
-std::array<float,2>{0.634333193f, 0.602052033f},
-std::array<float,2>{0.359223425f, 0.783477247f},
-std::array<float,2>{0.757907331f, 0.0681699067f},
-std::array<float,2>{0.375220299f, 0.490973264f},
-std::array<float,2>{0.946449637f, 0.733862162f},
-std::array<float,2>{0.223259181f, 0.890532851f},
-std::array<float,2>{0.603008747f, 0.191384479f},
-std::array<float,2>{0.0670148656f, 0.0940566957f},
-std::array<float,2>{0.709258556f, 0.764735281f},
-std::array<float,2>{0.269351065f, 0.582340479f},
-std::array<float,2>{0.856428385f, 0.286817849f},
-std::array<float,2>{0.320668787f, 0.155390158f},
-std::array<float,2>{0.792935729f, 0.958428741f},
-std::array<float,2>{0.00222529727f, 0.653012276f},
-std::array<float,2>{0.661609471f, 0.394809365f},
-std::array<float,2>{0.138198718f, 0.317597598f},
-std::array<float,2>{0.50683248f, 0.500024676f},
-std::array<float,2>{0.453158319f, 0.860219538f},
-std::array<float,2>{0.899630129f, 0.00304267858f},
-std::array<float,2>{0.287011474f, 0.259632945f},
-std::array<float,2>{0.813133001f, 0.599862158f},
-std::array<float,2>{0.0996509865f, 0.792222917f},
-std::array<float,2>{0.745975971f, 0.0748403594f},
-std::array<float,2>{0.217993006f, 0.231681779f},
-std::array<float,2>{0.593575954f, 0.931052923f},
-std::array<float,2>{0.422973782f, 0.716852129f},
-std::array<float,2>{0.999915242f, 0.437629461f},
-std::array<float,2>{0.477073312f, 0.0415519476f},
-std::array<float,2>{0.909124374f, 0.840930045f},
-std::array<float,2>{0.156773865f, 0.542194307f},
-std::array<float,2>{0.553144932f, 0.373386443f},
-std::array<float,2>{0.0565724783f, 0.412444383f},
-std::array<float,2>{0.655437827f, 0.668871939f},
-std::array<float,2>{0.367043406f, 0.980252028f},
-std::array<float,2>{0.775256217f, 0.175357789f},
-std::array<float,2>{0.443992764f, 0.349380195f},
-std::array<float,2>{0.886527121f, 0.553467572f},
-std::array<float,2>{0.149189651f, 0.816505492f},
-std::array<float,2>{0.51757592f, 0.048484914f},
-std::array<float,2>{0.0215028021f, 0.158201307f},
-std::array<float,2>{0.680287361f, 0.986470044f},
-std::array<float,2>{0.328873664f, 0.683341026f},
-std::array<float,2>{0.802584171f, 0.428837806f},
-std::array<float,2>{0.264990062f, 0.0885896906f},
-std::array<float,2>{0.870016396f, 0.812062979f},
-std::array<float,2>{0.0918446928f, 0.617018878f},
-std::array<float,2>{0.702822149f, 0.277449638f},
-std::array<float,2>{0.24099794f, 0.459820658f},
-std::array<float,2>{0.616393209f, 0.688096344f},
-std::array<float,2>{0.398616463f, 0.921785593f},
-std::array<float,2>{0.962903142f, 0.23730731f},
-std::array<float,2>{0.352594554f, 0.378362894f},
-std::array<float,2>{0.76501435f, 0.627436221f},
-std::array<float,2>{0.0377937183f, 0.948309243f},
-std::array<float,2>{0.640379131f, 0.132679537f},
-std::array<float,2>{0.186359137f, 0.0239949804f},
-std::array<float,2>{0.545407295f, 0.847903252f},
-std::array<float,2>{0.496432036f, 0.520327508f},
-std::array<float,2>{0.936485291f, 0.330237478f},
-std::array<float,2>{0.407330692f, 0.203416973f},
-std::array<float,2>{0.970777273f, 0.893280447f},
-std::array<float,2>{0.194821626f, 0.738206387f},
-std::array<float,2>{0.571400583f, 0.471198112f},
-std::array<float,2>{0.118646443f, 0.304010093f},
-std::array<float,2>{0.725795746f, 0.573382974f},
-std::array<float,2>{0.300451875f, 0.770223081f},
-std::array<float,2>{0.837110877f, 0.110660903f},
-std::array<float,2>{0.492020637f, 0.435321987f},
-std::array<float,2>{0.92735672f, 0.67935127f},
-std::array<float,2>{0.17543368f, 0.99387902f},
-std::array<float,2>{0.536776125f, 0.171037078f},
-std::array<float,2>{0.0445503071f, 0.0616548508f},
-std::array<float,2>{0.627525747f, 0.821873009f},
-std::array<float,2>{0.346331418f, 0.557868063f},
-std::array<float,2>{0.752414465f, 0.351738036f},
-std::array<float,2>{0.30637899f, 0.244270116f},
-std::array<float,2>{0.830497086f, 0.910545826f},
-std::array<float,2>{0.110159233f, 0.702814519f},
-std::array<float,2>{0.732809484f, 0.466048628f},
-std::array<float,2>{0.198408201f, 0.266647726f},
-std::array<float,2>{0.566873491f, 0.624259055f},
-std::array<float,2>{0.41527614f, 0.800367236f},
-std::array<float,2>{0.979538918f, 0.0801333338f},
-std::array<float,2>{0.338642746f, 0.336589307f},
-std::array<float,2>{0.808117628f, 0.527695835f},
-std::array<float,2>{0.0247958694f, 0.857605457f},
-std::array<float,2>{0.678047597f, 0.0211907178f},
-std::array<float,2>{0.143086001f, 0.140464962f},
-std::array<float,2>{0.525557816f, 0.94161886f},
-std::array<float,2>{0.449271977f, 0.636668503f},
-std::array<float,2>{0.877342939f, 0.385981321f},
-std::array<float,2>{0.395387977f, 0.118213512f},
-std::array<float,2>{0.953814328f, 0.775282681f},
-std::array<float,2>{0.24753508f, 0.56872493f},
-std::array<float,2>{0.620965481f, 0.307345748f},
-std::array<float,2>{0.0833855867f, 0.48241663f},
-std::array<float,2>{0.692775011f, 0.742710471f},
-std::array<float,2>{0.255568743f, 0.905493796f},
-std::array<float,2>{0.86582005f, 0.213272423f},
-std::array<float,2>{0.433788061f, 0.290407896f},
-std::array<float,2>{0.987293363f, 0.591153383f},
-std::array<float,2>{0.208569065f, 0.754383802f},
-std::array<float,2>{0.584826589f, 0.106106758f},
-std::array<float,2>{0.106637128f, 0.201538324f},
-std::array<float,2>{0.739030123f, 0.878391147f},
-std::array<float,2>{0.295618206f, 0.720012903f},
-std::array<float,2>{0.821655035f, 0.493008554f},
-std::array<float,2>{0.373660803f, 0.0115388539f},
-std::array<float,2>{0.766493857f, 0.87031585f},
-std::array<float,2>{0.0527029447f, 0.515275598f},
-std::array<float,2>{0.648026586f, 0.32062605f},
-std::array<float,2>{0.168764591f, 0.406187832f},
-std::array<float,2>{0.56206125f, 0.644659221f},
-std::array<float,2>{0.476507246f, 0.961188734f},
-std::array<float,2>{0.9185462f, 0.146083593f},
-std::array<float,2>{0.278857529f, 0.449118435f},
-std::array<float,2>{0.848995268f, 0.705503166f},
-std::array<float,2>{0.0715917721f, 0.926786125f},
-std::array<float,2>{0.715332448f, 0.226229489f},
-std::array<float,2>{0.228661716f, 0.0652683526f},
-std::array<float,2>{0.595737398f, 0.787202537f},
-std::array<float,2>{0.38886252f, 0.609111369f},
-std::array<float,2>{0.942668676f, 0.251416445f},
-std::array<float,2>{0.462463826f, 0.180534288f},
-std::array<float,2>{0.895257235f, 0.976530313f},
-std::array<float,2>{0.128763095f, 0.661030531f},
-std::array<float,2>{0.51283133f, 0.420044184f},
-std::array<float,2>{0.0131913377f, 0.364955187f},
-std::array<float,2>{0.670980752f, 0.5371539f},
-std::array<float,2>{0.319438279f, 0.831118464f},
-std::array<float,2>{0.781986356f, 0.0357853211f},
-std::array<float,2>{0.431876123f, 0.424179792f},
-std::array<float,2>{0.988870025f, 0.685172379f},
-std::array<float,2>{0.205775544f, 0.991084158f},
-std::array<float,2>{0.580486298f, 0.160997212f},
-std::array<float,2>{0.101973481f, 0.0520810224f},
-std::array<float,2>{0.737098753f, 0.814049959f},
-std::array<float,2>{0.290571928f, 0.548303008f},
-std::array<float,2>{0.82732296f, 0.344709933f},
-std::array<float,2>{0.368023157f, 0.240983814f},
-std::array<float,2>{0.773277342f, 0.917968512f},
-std::array<float,2>{0.0501075797f, 0.695125222f},
-std::array<float,2>{0.641710281f, 0.45604822f},
-std::array<float,2>{0.16622369f, 0.274680197f},
-std::array<float,2>{0.555780888f, 0.611539841f},
-std::array<float,2>{0.471476376f, 0.808361232f},
-std::array<float,2>{0.917560756f, 0.0900363624f},
-std::array<float,2>{0.274924695f, 0.33256802f},
-std::array<float,2>{0.847512662f, 0.518136442f},
-std::array<float,2>{0.0779615045f, 0.847470403f},
-std::array<float,2>{0.71279037f, 0.030255923f},
-std::array<float,2>{0.23222734f, 0.1278736f},
-std::array<float,2>{0.600288451f, 0.952446043f},
-std::array<float,2>{0.384420961f, 0.631963074f},
-std::array<float,2>{0.940000892f, 0.381482363f},
-std::array<float,2>{0.467585653f, 0.116466455f},
-std::array<float,2>{0.890957415f, 0.767874539f},
-std::array<float,2>{0.129297286f, 0.57797122f},
-std::array<float,2>{0.508831859f, 0.297916681f},
-std::array<float,2>{0.0106896395f, 0.474416077f},
-std::array<float,2>{0.666018307f, 0.738708556f},
-std::array<float,2>{0.314755052f, 0.898304999f},
-std::array<float,2>{0.785552025f, 0.20888567f},
-std::array<float,2>{0.484656274f, 0.285095692f},
-std::array<float,2>{0.922766268f, 0.57819277f},
-std::array<float,2>{0.176744953f, 0.759003103f},
-std::array<float,2>{0.531478047f, 0.101277679f},
-std::array<float,2>{0.04123367f, 0.193109453f},
-std::array<float,2>{0.632188737f, 0.883608282f},
-std::array<float,2>{0.347880542f, 0.729395151f},
-std::array<float,2>{0.754234552f, 0.484990954f},
-std::array<float,2>{0.311085105f, 0.00705096778f},
-std::array<float,2>{0.832115591f, 0.8654598f},
-std::array<float,2>{0.11421261f, 0.506339252f},
-std::array<float,2>{0.729236007f, 0.316310942f},
-std::array<float,2>{0.202163234f, 0.394331068f},
-std::array<float,2>{0.564052641f, 0.649406433f},
-std::array<float,2>{0.420571625f, 0.955076993f},
-std::array<float,2>{0.982562125f, 0.14871192f},
-std::array<float,2>{0.340509892f, 0.443451881f},
-std::array<float,2>{0.812145233f, 0.712670803f},
-std::array<float,2>{0.029409118f, 0.934336007f},
-std::array<float,2>{0.673700452f, 0.227055773f},
-std::array<float,2>{0.147314057f, 0.0741958767f},
-std::array<float,2>{0.527917922f, 0.793045223f},
-std::array<float,2>{0.446808249f, 0.594488442f},
-std::array<float,2>{0.879529893f, 0.262647569f},
-std::array<float,2>{0.392404705f, 0.178031012f},
-std::array<float,2>{0.958367825f, 0.980810404f},
-std::array<float,2>{0.243389532f, 0.665749967f},
-std::array<float,2>{0.624965489f, 0.407172322f},
-std::array<float,2>{0.0797044486f, 0.368537545f},
-std::array<float,2>{0.687987506f, 0.543280125f},
-std::array<float,2>{0.252027124f, 0.836615205f},
-std::array<float,2>{0.862834454f, 0.0450249612f},
-std::array<float,2>{0.438330233f, 0.497124732f},
-std::array<float,2>{0.88718909f, 0.725302994f},
-std::array<float,2>{0.154381722f, 0.880292594f},
-std::array<float,2>{0.523030579f, 0.196226805f},
-std::array<float,2>{0.0174306948f, 0.101819225f},
-std::array<float,2>{0.687084436f, 0.750295222f},
-std::array<float,2>{0.332948893f, 0.588786602f},
-std::array<float,2>{0.798103809f, 0.293472379f},
-std::array<float,2>{0.260603845f, 0.141241193f},
-std::array<float,2>{0.874854565f, 0.966271162f},
-std::array<float,2>{0.0890406296f, 0.641343951f},
-std::array<float,2>{0.696217716f, 0.401410758f},
-std::array<float,2>{0.235033989f, 0.325242102f},
-std::array<float,2>{0.609927058f, 0.509027243f},
-std::array<float,2>{0.403964341f, 0.874934077f},
-std::array<float,2>{0.966801047f, 0.0133385938f},
-std::array<float,2>{0.358282298f, 0.257802725f},
-std::array<float,2>{0.759160221f, 0.604049146f},
-std::array<float,2>{0.0314522088f, 0.781900585f},
-std::array<float,2>{0.632986128f, 0.0696763471f},
-std::array<float,2>{0.183350876f, 0.220924884f},
-std::array<float,2>{0.540554941f, 0.925641716f},
-std::array<float,2>{0.494333297f, 0.708618402f},
-std::array<float,2>{0.933117509f, 0.452845812f},
-std::array<float,2>{0.411489934f, 0.0339396298f},
-std::array<float,2>{0.97424376f, 0.834365666f},
-std::array<float,2>{0.188453391f, 0.534247935f},
-std::array<float,2>{0.574600101f, 0.360807568f},
-std::array<float,2>{0.124030285f, 0.417131692f},
-std::array<float,2>{0.720855355f, 0.659145892f},
-std::array<float,2>{0.30441612f, 0.969141126f},
-std::array<float,2>{0.843367934f, 0.186404064f},
-std::array<float,2>{0.38018775f, 0.356761575f},
-std::array<float,2>{0.952408612f, 0.560317695f},
-std::array<float,2>{0.219184294f, 0.825160265f},
-std::array<float,2>{0.608671904f, 0.0554071181f},
-std::array<float,2>{0.064081572f, 0.165642574f},
-std::array<float,2>{0.706544578f, 0.996872246f},
-std::array<float,2>{0.269625574f, 0.675159812f},
-std::array<float,2>{0.853085279f, 0.432358593f},
-std::array<float,2>{0.324498415f, 0.083742924f},
-std::array<float,2>{0.793421328f, 0.803480983f},
-std::array<float,2>{0.00459801313f, 0.620314002f},
-std::array<float,2>{0.656561494f, 0.271618098f},
-std::array<float,2>{0.13487868f, 0.461829692f},
-std::array<float,2>{0.500108004f, 0.69816637f},
-std::array<float,2>{0.459615678f, 0.909206033f},
-std::array<float,2>{0.904124677f, 0.248630866f},
-std::array<float,2>{0.282942563f, 0.388063967f},
-std::array<float,2>{0.819983006f, 0.637019515f},
-std::array<float,2>{0.0941268802f, 0.938952804f},
-std::array<float,2>{0.749537647f, 0.134601951f},
-std::array<float,2>{0.214048937f, 0.0186206233f},
-std::array<float,2>{0.586125493f, 0.854736447f},
-std::array<float,2>{0.426137447f, 0.524030805f},
-std::array<float,2>{0.99538517f, 0.34268409f},
-std::array<float,2>{0.481896698f, 0.216684833f},
-std::array<float,2>{0.911604166f, 0.898483634f},
-std::array<float,2>{0.161265641f, 0.74899292f},
-std::array<float,2>{0.549312949f, 0.479049146f},
-std::array<float,2>{0.0610942543f, 0.31040445f},
-std::array<float,2>{0.650708079f, 0.563501179f},
-std::array<float,2>{0.360352308f, 0.778713226f},
-std::array<float,2>{0.778340995f, 0.123551004f},
-std::array<float,2>{0.399434149f, 0.457861513f},
-std::array<float,2>{0.96432513f, 0.690177619f},
-std::array<float,2>{0.241903737f, 0.919330239f},
-std::array<float,2>{0.615741014f, 0.235391021f},
-std::array<float,2>{0.0937042162f, 0.0878065974f},
-std::array<float,2>{0.701450825f, 0.810248137f},
-std::array<float,2>{0.263977945f, 0.61357826f},
-std::array<float,2>{0.870841503f, 0.280047894f},
-std::array<float,2>{0.329373181f, 0.159943074f},
-std::array<float,2>{0.80163312f, 0.985028803f},
-std::array<float,2>{0.0225281566f, 0.679706514f},
-std::array<float,2>{0.681595802f, 0.426252574f},
-std::array<float,2>{0.15038082f, 0.351552635f},
-std::array<float,2>{0.516508579f, 0.552625179f},
-std::array<float,2>{0.444421262f, 0.818387032f},
-std::array<float,2>{0.88555336f, 0.0501007512f},
-std::array<float,2>{0.2994757f, 0.301783234f},
-std::array<float,2>{0.836328447f, 0.570912957f},
-std::array<float,2>{0.117429823f, 0.771496475f},
-std::array<float,2>{0.724746108f, 0.111406401f},
-std::array<float,2>{0.193450809f, 0.205705732f},
-std::array<float,2>{0.570970178f, 0.891371369f},
-std::array<float,2>{0.407040745f, 0.735364854f},
-std::array<float,2>{0.972329021f, 0.470679998f},
-std::array<float,2>{0.497249424f, 0.0262262337f},
-std::array<float,2>{0.936836541f, 0.849796355f},
-std::array<float,2>{0.186573714f, 0.523205519f},
-std::array<float,2>{0.54657495f, 0.328717411f},
-std::array<float,2>{0.038179595f, 0.37594232f},
-std::array<float,2>{0.638789296f, 0.626431584f},
-std::array<float,2>{0.352464497f, 0.945577979f},
-std::array<float,2>{0.763854265f, 0.129624501f},
-std::array<float,2>{0.454231828f, 0.318386734f},
-std::array<float,2>{0.89930886f, 0.502368271f},
-std::array<float,2>{0.137022734f, 0.86244148f},
-std::array<float,2>{0.507234454f, 0.00171034865f},
-std::array<float,2>{0.00352793769f, 0.153256759f},
-std::array<float,2>{0.66083771f, 0.960160732f},
-std::array<float,2>{0.321421057f, 0.655059457f},
-std::array<float,2>{0.791730821f, 0.398125172f},
-std::array<float,2>{0.268504769f, 0.0958359689f},
-std::array<float,2>{0.857293665f, 0.761917174f},
-std::array<float,2>{0.068001166f, 0.584737659f},
-std::array<float,2>{0.710253954f, 0.288414031f},
-std::array<float,2>{0.224034384f, 0.489840657f},
-std::array<float,2>{0.602086365f, 0.731265187f},
-std::array<float,2>{0.37630716f, 0.886990249f},
-std::array<float,2>{0.945390761f, 0.187657475f},
-std::array<float,2>{0.365527451f, 0.410185248f},
-std::array<float,2>{0.774026275f, 0.670723319f},
-std::array<float,2>{0.0549124815f, 0.977617562f},
-std::array<float,2>{0.654560864f, 0.172338188f},
-std::array<float,2>{0.157998964f, 0.0403756797f},
-std::array<float,2>{0.554454565f, 0.84310025f},
-std::array<float,2>{0.477845401f, 0.540085554f},
-std::array<float,2>{0.909651637f, 0.371318191f},
-std::array<float,2>{0.421897948f, 0.232941017f},
-std::array<float,2>{0.99886626f, 0.931654394f},
-std::array<float,2>{0.217201009f, 0.71555233f},
-std::array<float,2>{0.592237592f, 0.441182077f},
-std::array<float,2>{0.101395458f, 0.260816783f},
-std::array<float,2>{0.744191051f, 0.598209977f},
-std::array<float,2>{0.285718113f, 0.790065229f},
-std::array<float,2>{0.814396501f, 0.0778885484f},
-std::array<float,2>{0.475091457f, 0.402516097f},
-std::array<float,2>{0.919623613f, 0.648124874f},
-std::array<float,2>{0.169075847f, 0.964422584f},
-std::array<float,2>{0.560690641f, 0.147353053f},
-std::array<float,2>{0.0511155427f, 0.00963005144f},
-std::array<float,2>{0.647454381f, 0.867421806f},
-std::array<float,2>{0.374154359f, 0.512092233f},
-std::array<float,2>{0.766704381f, 0.323848516f},
-std::array<float,2>{0.296008706f, 0.199336007f},
-std::array<float,2>{0.821033597f, 0.876514614f},
-std::array<float,2>{0.106205977f, 0.721794844f},
-std::array<float,2>{0.739582062f, 0.494679153f},
-std::array<float,2>{0.20754233f, 0.292309701f},
-std::array<float,2>{0.585179567f, 0.592449129f},
-std::array<float,2>{0.435339421f, 0.756698132f},
-std::array<float,2>{0.987398744f, 0.109337084f},
-std::array<float,2>{0.319081664f, 0.367017776f},
-std::array<float,2>{0.782923222f, 0.536799312f},
-std::array<float,2>{0.0118347565f, 0.829926372f},
-std::array<float,2>{0.670706451f, 0.0390304402f},
-std::array<float,2>{0.127397612f, 0.183497176f},
-std::array<float,2>{0.512410641f, 0.973572254f},
-std::array<float,2>{0.461780608f, 0.663884878f},
-std::array<float,2>{0.896255434f, 0.41914174f},
-std::array<float,2>{0.389826506f, 0.0627927482f},
-std::array<float,2>{0.941496432f, 0.78584069f},
-std::array<float,2>{0.230072081f, 0.606226683f},
-std::array<float,2>{0.596963584f, 0.252762586f},
-std::array<float,2>{0.0704657733f, 0.446869373f},
-std::array<float,2>{0.71596992f, 0.704752564f},
-std::array<float,2>{0.277806938f, 0.929629028f},
-std::array<float,2>{0.848321676f, 0.224489361f},
-std::array<float,2>{0.414431304f, 0.269477934f},
-std::array<float,2>{0.978776097f, 0.621782601f},
-std::array<float,2>{0.19756557f, 0.79868716f},
-std::array<float,2>{0.56812048f, 0.079019025f},
-std::array<float,2>{0.11102362f, 0.242975608f},
-std::array<float,2>{0.734163523f, 0.912526369f},
-std::array<float,2>{0.305618316f, 0.700193942f},
-std::array<float,2>{0.831176579f, 0.467956394f},
-std::array<float,2>{0.347123682f, 0.0604231805f},
-std::array<float,2>{0.753574848f, 0.823862731f},
-std::array<float,2>{0.0431218334f, 0.555514991f},
-std::array<float,2>{0.62865001f, 0.353958398f},
-std::array<float,2>{0.173891917f, 0.435843647f},
-std::array<float,2>{0.535896659f, 0.676384985f},
-std::array<float,2>{0.490379393f, 0.994395435f},
-std::array<float,2>{0.925971329f, 0.168901324f},
-std::array<float,2>{0.254178405f, 0.483093739f},
-std::array<float,2>{0.866558731f, 0.744524479f},
-std::array<float,2>{0.082879737f, 0.903740227f},
-std::array<float,2>{0.69207406f, 0.211769089f},
-std::array<float,2>{0.246447966f, 0.119181827f},
-std::array<float,2>{0.619398355f, 0.776016772f},
-std::array<float,2>{0.396056831f, 0.567476392f},
-std::array<float,2>{0.954865515f, 0.306092143f},
-std::array<float,2>{0.451073378f, 0.13832055f},
-std::array<float,2>{0.878112018f, 0.944571793f},
-std::array<float,2>{0.14374277f, 0.633432686f},
-std::array<float,2>{0.527106583f, 0.384757996f},
-std::array<float,2>{0.0237185545f, 0.338800818f},
-std::array<float,2>{0.678717673f, 0.531105995f},
-std::array<float,2>{0.339021623f, 0.855471253f},
-std::array<float,2>{0.806947291f, 0.0223560929f},
-std::array<float,2>{0.385866165f, 0.3795982f},
-std::array<float,2>{0.939041615f, 0.630675197f},
-std::array<float,2>{0.233299732f, 0.949395299f},
-std::array<float,2>{0.598363698f, 0.125476688f},
-std::array<float,2>{0.075156197f, 0.0274572782f},
-std::array<float,2>{0.714170218f, 0.845364273f},
-std::array<float,2>{0.277062982f, 0.517242074f},
-std::array<float,2>{0.844354868f, 0.334370852f},
-std::array<float,2>{0.313477069f, 0.210902795f},
-std::array<float,2>{0.787362814f, 0.894709468f},
-std::array<float,2>{0.00947114918f, 0.742007136f},
-std::array<float,2>{0.664179921f, 0.475925028f},
-std::array<float,2>{0.13231805f, 0.300189197f},
-std::array<float,2>{0.510688543f, 0.575809717f},
-std::array<float,2>{0.465435237f, 0.767044723f},
-std::array<float,2>{0.894285023f, 0.114126369f},
-std::array<float,2>{0.291124761f, 0.346284837f},
-std::array<float,2>{0.826074958f, 0.550029576f},
-std::array<float,2>{0.103834443f, 0.815659761f},
-std::array<float,2>{0.734975755f, 0.0529983006f},
-std::array<float,2>{0.204198942f, 0.163287953f},
-std::array<float,2>{0.578995228f, 0.989581347f},
-std::array<float,2>{0.43162787f, 0.686744928f},
-std::array<float,2>{0.991397381f, 0.422141075f},
-std::array<float,2>{0.469043016f, 0.0928359106f},
-std::array<float,2>{0.915086269f, 0.804927647f},
-std::array<float,2>{0.165758938f, 0.609841406f},
-std::array<float,2>{0.557193756f, 0.276677072f},
-std::array<float,2>{0.0473973192f, 0.454877585f},
-std::array<float,2>{0.643369853f, 0.692923129f},
-std::array<float,2>{0.369555891f, 0.915456116f},
-std::array<float,2>{0.771085858f, 0.239546001f},
-std::array<float,2>{0.449107379f, 0.264611095f},
-std::array<float,2>{0.880877733f, 0.597142994f},
-std::array<float,2>{0.14598535f, 0.794955254f},
-std::array<float,2>{0.530390322f, 0.0711101145f},
-std::array<float,2>{0.0284396838f, 0.229136258f},
-std::array<float,2>{0.675584376f, 0.937060237f},
-std::array<float,2>{0.342004389f, 0.713322759f},
-std::array<float,2>{0.809186995f, 0.441551298f},
-std::array<float,2>{0.250440359f, 0.0435949713f},
-std::array<float,2>{0.859934986f, 0.838376522f},
-std::array<float,2>{0.0819514766f, 0.546829641f},
-std::array<float,2>{0.691356719f, 0.369156748f},
-std::array<float,2>{0.245687947f, 0.408453077f},
-std::array<float,2>{0.621868551f, 0.667787015f},
-std::array<float,2>{0.393985301f, 0.983524382f},
-std::array<float,2>{0.959039092f, 0.176703781f},
-std::array<float,2>{0.350770056f, 0.486842573f},
-std::array<float,2>{0.757579327f, 0.726796627f},
-std::array<float,2>{0.0406989567f, 0.885297954f},
-std::array<float,2>{0.629933894f, 0.193468288f},
-std::array<float,2>{0.178628325f, 0.0994170606f},
-std::array<float,2>{0.53453064f, 0.760439813f},
-std::array<float,2>{0.488219053f, 0.58152312f},
-std::array<float,2>{0.925002813f, 0.281674355f},
-std::array<float,2>{0.417983264f, 0.150469199f},
-std::array<float,2>{0.980588555f, 0.956031084f},
-std::array<float,2>{0.200025871f, 0.651641667f},
-std::array<float,2>{0.566275716f, 0.391070843f},
-std::array<float,2>{0.116098031f, 0.313597023f},
-std::array<float,2>{0.727724373f, 0.505630076f},
-std::array<float,2>{0.310105056f, 0.864594042f},
-std::array<float,2>{0.834712029f, 0.00427238457f},
-std::array<float,2>{0.493267089f, 0.451106846f},
-std::array<float,2>{0.930549204f, 0.709880769f},
-std::array<float,2>{0.180621371f, 0.922176719f},
-std::array<float,2>{0.542281449f, 0.219613209f},
-std::array<float,2>{0.0340729468f, 0.0667953342f},
-std::array<float,2>{0.636068642f, 0.784336507f},
-std::array<float,2>{0.355858177f, 0.602709055f},
-std::array<float,2>{0.760125995f, 0.25561142f},
-std::array<float,2>{0.301860929f, 0.184204862f},
-std::array<float,2>{0.841666043f, 0.972415984f},
-std::array<float,2>{0.122580774f, 0.657551289f},
-std::array<float,2>{0.719381094f, 0.414093643f},
-std::array<float,2>{0.191258565f, 0.363160223f},
-std::array<float,2>{0.576479197f, 0.533157051f},
-std::array<float,2>{0.412258178f, 0.833154142f},
-std::array<float,2>{0.97644186f, 0.032855466f},
-std::array<float,2>{0.335071474f, 0.296295762f},
-std::array<float,2>{0.800297678f, 0.586459696f},
-std::array<float,2>{0.0181023888f, 0.752483428f},
-std::array<float,2>{0.684637487f, 0.104649387f},
-std::array<float,2>{0.154053375f, 0.197986051f},
-std::array<float,2>{0.520326376f, 0.882058978f},
-std::array<float,2>{0.440622419f, 0.72283566f},
-std::array<float,2>{0.888947129f, 0.498123914f},
-std::array<float,2>{0.404381007f, 0.014544135f},
-std::array<float,2>{0.965737104f, 0.871973753f},
-std::array<float,2>{0.237381846f, 0.511234701f},
-std::array<float,2>{0.613107502f, 0.326901108f},
-std::array<float,2>{0.0870587006f, 0.399563611f},
-std::array<float,2>{0.698460281f, 0.644446909f},
-std::array<float,2>{0.258829921f, 0.967865944f},
-std::array<float,2>{0.871927738f, 0.143802866f},
-std::array<float,2>{0.428038269f, 0.340986758f},
-std::array<float,2>{0.993261278f, 0.526597202f},
-std::array<float,2>{0.211272776f, 0.853159428f},
-std::array<float,2>{0.588450909f, 0.0171475299f},
-std::array<float,2>{0.0971089154f, 0.134815946f},
-std::array<float,2>{0.747283995f, 0.939533889f},
-std::array<float,2>{0.283446014f, 0.63896805f},
-std::array<float,2>{0.816925049f, 0.389702976f},
-std::array<float,2>{0.361619234f, 0.121959791f},
-std::array<float,2>{0.779347181f, 0.781240225f},
-std::array<float,2>{0.0595372356f, 0.56501019f},
-std::array<float,2>{0.650111973f, 0.312400013f},
-std::array<float,2>{0.163824514f, 0.477187604f},
-std::array<float,2>{0.547332227f, 0.747607231f},
-std::array<float,2>{0.483701557f, 0.902090669f},
-std::array<float,2>{0.912418187f, 0.217159003f},
-std::array<float,2>{0.271722645f, 0.430704892f},
-std::array<float,2>{0.854657292f, 0.673432767f},
-std::array<float,2>{0.0660190582f, 0.999715447f},
-std::array<float,2>{0.704674304f, 0.167467207f},
-std::array<float,2>{0.221330076f, 0.0584969781f},
-std::array<float,2>{0.606162429f, 0.827882767f},
-std::array<float,2>{0.382790118f, 0.562433898f},
-std::array<float,2>{0.950467944f, 0.357444972f},
-std::array<float,2>{0.457771242f, 0.247791991f},
-std::array<float,2>{0.905939817f, 0.907921851f},
-std::array<float,2>{0.133601889f, 0.697158277f},
-std::array<float,2>{0.503516018f, 0.46394828f},
-std::array<float,2>{0.00614638207f, 0.270809293f},
-std::array<float,2>{0.658945322f, 0.618383288f},
-std::array<float,2>{0.32788074f, 0.801535189f},
-std::array<float,2>{0.796750546f, 0.0850372016f},
-std::array<float,2>{0.408776075f, 0.472615361f},
-std::array<float,2>{0.970665097f, 0.73677963f},
-std::array<float,2>{0.191787645f, 0.894311786f},
-std::array<float,2>{0.573751926f, 0.204282433f},
-std::array<float,2>{0.120398931f, 0.110029057f},
-std::array<float,2>{0.722958088f, 0.770552933f},
-std::array<float,2>{0.297358841f, 0.572375417f},
-std::array<float,2>{0.838288903f, 0.30353868f},
-std::array<float,2>{0.35365054f, 0.131069496f},
-std::array<float,2>{0.763252497f, 0.948109448f},
-std::array<float,2>{0.0355859399f, 0.628465176f},
-std::array<float,2>{0.637759387f, 0.377328783f},
-std::array<float,2>{0.185142964f, 0.331913561f},
-std::array<float,2>{0.544801533f, 0.521397471f},
-std::array<float,2>{0.498375565f, 0.849077344f},
-std::array<float,2>{0.933997571f, 0.0246073287f},
-std::array<float,2>{0.262218684f, 0.279155672f},
-std::array<float,2>{0.867998898f, 0.615927517f},
-std::array<float,2>{0.0900622159f, 0.811348855f},
-std::array<float,2>{0.699767172f, 0.0889208242f},
-std::array<float,2>{0.238853425f, 0.236628905f},
-std::array<float,2>{0.613672614f, 0.920555651f},
-std::array<float,2>{0.400967896f, 0.688735783f},
-std::array<float,2>{0.960947275f, 0.459963769f},
-std::array<float,2>{0.442003906f, 0.0469162688f},
-std::array<float,2>{0.883794606f, 0.817749441f},
-std::array<float,2>{0.150911286f, 0.553839624f},
-std::array<float,2>{0.518839717f, 0.34853828f},
-std::array<float,2>{0.020456234f, 0.428490251f},
-std::array<float,2>{0.682935715f, 0.682344794f},
-std::array<float,2>{0.33183369f, 0.987715125f},
-std::array<float,2>{0.803620577f, 0.156929672f},
-std::array<float,2>{0.479972214f, 0.374730796f},
-std::array<float,2>{0.907107949f, 0.541297734f},
-std::array<float,2>{0.158429816f, 0.839978695f},
-std::array<float,2>{0.551445246f, 0.0421286374f},
-std::array<float,2>{0.05849595f, 0.173891112f},
-std::array<float,2>{0.654001176f, 0.979147017f},
-std::array<float,2>{0.363740504f, 0.66931808f},
-std::array<float,2>{0.775869608f, 0.413311243f},
-std::array<float,2>{0.287670404f, 0.0760504454f},
-std::array<float,2>{0.814911008f, 0.791983902f},
-std::array<float,2>{0.0986853093f, 0.601492763f},
-std::array<float,2>{0.743916512f, 0.258571327f},
-std::array<float,2>{0.216584384f, 0.43913424f},
-std::array<float,2>{0.591758013f, 0.718522966f},
-std::array<float,2>{0.425396383f, 0.930060148f},
-std::array<float,2>{0.996508718f, 0.231222123f},
-std::array<float,2>{0.323530525f, 0.396262139f},
-std::array<float,2>{0.790231705f, 0.653782368f},
-std::array<float,2>{0.000134083486f, 0.957223475f},
-std::array<float,2>{0.663539946f, 0.154912278f},
-std::array<float,2>{0.139757752f, 0.00285770278f},
-std::array<float,2>{0.50482744f, 0.861138046f},
-std::array<float,2>{0.456119537f, 0.501579523f},
-std::array<float,2>{0.901151836f, 0.317248821f},
-std::array<float,2>{0.377282679f, 0.189504519f},
-std::array<float,2>{0.94812566f, 0.889146149f},
-std::array<float,2>{0.224864706f, 0.732566953f},
-std::array<float,2>{0.603967249f, 0.491321206f},
-std::array<float,2>{0.0699586943f, 0.285839826f},
-std::array<float,2>{0.707363665f, 0.58348614f},
-std::array<float,2>{0.265842915f, 0.763762295f},
-std::array<float,2>{0.857933581f, 0.0952554345f},
-std::array<float,2>{0.464604497f, 0.421636224f},
-std::array<float,2>{0.896493495f, 0.661748052f},
-std::array<float,2>{0.125071079f, 0.974679828f},
-std::array<float,2>{0.513839304f, 0.181073278f},
-std::array<float,2>{0.0151614696f, 0.0366263129f},
-std::array<float,2>{0.667995155f, 0.830277801f},
-std::array<float,2>{0.316928655f, 0.538194299f},
-std::array<float,2>{0.784873545f, 0.363387287f},
-std::array<float,2>{0.280960619f, 0.224779814f},
-std::array<float,2>{0.850566149f, 0.925950944f},
-std::array<float,2>{0.0739462599f, 0.706868231f},
-std::array<float,2>{0.718190491f, 0.448187798f},
-std::array<float,2>{0.226587102f, 0.250166029f},
-std::array<float,2>{0.594376922f, 0.607656777f},
-std::array<float,2>{0.387132972f, 0.788492143f},
-std::array<float,2>{0.943380713f, 0.065791674f},
-std::array<float,2>{0.371894091f, 0.322168022f},
-std::array<float,2>{0.768989325f, 0.514165044f},
-std::array<float,2>{0.0540378168f, 0.869874299f},
-std::array<float,2>{0.646272361f, 0.0100094518f},
-std::array<float,2>{0.170658842f, 0.14492783f},
-std::array<float,2>{0.559233844f, 0.962114394f},
-std::array<float,2>{0.473481148f, 0.645988584f},
-std::array<float,2>{0.920216143f, 0.404849082f},
-std::array<float,2>{0.436409175f, 0.106462345f},
-std::array<float,2>{0.984798074f, 0.755244911f},
-std::array<float,2>{0.210029364f, 0.590599298f},
-std::array<float,2>{0.582436562f, 0.289173901f},
-std::array<float,2>{0.108399183f, 0.49341163f},
-std::array<float,2>{0.741074324f, 0.719129324f},
-std::array<float,2>{0.293356508f, 0.877920449f},
-std::array<float,2>{0.822450757f, 0.202789649f},
-std::array<float,2>{0.397296518f, 0.307826698f},
-std::array<float,2>{0.956990302f, 0.569657683f},
-std::array<float,2>{0.248838857f, 0.774112701f},
-std::array<float,2>{0.618647814f, 0.117372878f},
-std::array<float,2>{0.0853494704f, 0.214534312f},
-std::array<float,2>{0.694661856f, 0.905076385f},
-std::array<float,2>{0.25586763f, 0.743787467f},
-std::array<float,2>{0.863853097f, 0.480753452f},
-std::array<float,2>{0.336402386f, 0.0197305623f},
-std::array<float,2>{0.80539161f, 0.858704388f},
-std::array<float,2>{0.02652077f, 0.529111564f},
-std::array<float,2>{0.677274466f, 0.337297201f},
-std::array<float,2>{0.14088957f, 0.385071844f},
-std::array<float,2>{0.524682283f, 0.635681331f},
-std::array<float,2>{0.45286411f, 0.943345666f},
-std::array<float,2>{0.875615656f, 0.139452174f},
-std::array<float,2>{0.308452517f, 0.465323538f},
-std::array<float,2>{0.829732001f, 0.701687217f},
-std::array<float,2>{0.11199756f, 0.911409378f},
-std::array<float,2>{0.730922401f, 0.245686024f},
-std::array<float,2>{0.196976826f, 0.0814651698f},
-std::array<float,2>{0.569672704f, 0.798992753f},
-std::array<float,2>{0.416992426f, 0.623124421f},
-std::array<float,2>{0.977198124f, 0.266456574f},
-std::array<float,2>{0.489558578f, 0.170584857f},
-std::array<float,2>{0.927804291f, 0.993014753f},
-std::array<float,2>{0.173127562f, 0.678141832f},
-std::array<float,2>{0.538405597f, 0.434338361f},
-std::array<float,2>{0.0449823774f, 0.352560729f},
-std::array<float,2>{0.625459492f, 0.557104647f},
-std::array<float,2>{0.34541437f, 0.821134746f},
-std::array<float,2>{0.75082761f, 0.0612026937f},
-std::array<float,2>{0.386944652f, 0.418766022f},
-std::array<float,2>{0.943701684f, 0.662285745f},
-std::array<float,2>{0.226892099f, 0.973690987f},
-std::array<float,2>{0.594673216f, 0.182220712f},
-std::array<float,2>{0.0740922391f, 0.038049385f},
-std::array<float,2>{0.717916429f, 0.828408301f},
-std::array<float,2>{0.281062245f, 0.535541236f},
-std::array<float,2>{0.850103676f, 0.365593404f},
-std::array<float,2>{0.31714952f, 0.222848073f},
-std::array<float,2>{0.784953773f, 0.928270519f},
-std::array<float,2>{0.0154562099f, 0.70374006f},
-std::array<float,2>{0.668353021f, 0.446066201f},
-std::array<float,2>{0.125448495f, 0.253147811f},
-std::array<float,2>{0.514036417f, 0.606675446f},
-std::array<float,2>{0.464526802f, 0.786192954f},
-std::array<float,2>{0.89682281f, 0.0643799976f},
-std::array<float,2>{0.29306376f, 0.322615504f},
-std::array<float,2>{0.822603106f, 0.512725294f},
-std::array<float,2>{0.108744562f, 0.868516445f},
-std::array<float,2>{0.740786076f, 0.00783745013f},
-std::array<float,2>{0.210241541f, 0.147471279f},
-std::array<float,2>{0.582123816f, 0.963582516f},
-std::array<float,2>{0.436264813f, 0.646763563f},
-std::array<float,2>{0.984604597f, 0.4038091f},
-std::array<float,2>{0.473193973f, 0.10791254f},
-std::array<float,2>{0.920050502f, 0.756907761f},
-std::array<float,2>{0.170652807f, 0.593382716f},
-std::array<float,2>{0.559348166f, 0.291343272f},
-std::array<float,2>{0.0538446829f, 0.495488971f},
-std::array<float,2>{0.646025896f, 0.721428335f},
-std::array<float,2>{0.37178579f, 0.875532627f},
-std::array<float,2>{0.768652737f, 0.200678632f},
-std::array<float,2>{0.453111827f, 0.304704934f},
-std::array<float,2>{0.875755489f, 0.567142487f},
-std::array<float,2>{0.140715256f, 0.776755214f},
-std::array<float,2>{0.524617314f, 0.120840982f},
-std::array<float,2>{0.0267385151f, 0.212077051f},
-std::array<float,2>{0.677495658f, 0.902746975f},
-std::array<float,2>{0.336161822f, 0.745533168f},
-std::array<float,2>{0.805532932f, 0.484159112f},
-std::array<float,2>{0.256208241f, 0.0226315074f},
-std::array<float,2>{0.864023566f, 0.857170403f},
-std::array<float,2>{0.0851987153f, 0.529488742f},
-std::array<float,2>{0.694479525f, 0.339525968f},
-std::array<float,2>{0.248548657f, 0.383666366f},
-std::array<float,2>{0.618212581f, 0.634448051f},
-std::array<float,2>{0.397003084f, 0.943754852f},
-std::array<float,2>{0.956780553f, 0.137439921f},
-std::array<float,2>{0.345698655f, 0.467521161f},
-std::array<float,2>{0.750687897f, 0.701078355f},
-std::array<float,2>{0.0453474894f, 0.913199484f},
-std::array<float,2>{0.625064969f, 0.24319835f},
-std::array<float,2>{0.173029676f, 0.07922066f},
-std::array<float,2>{0.538133979f, 0.797431469f},
-std::array<float,2>{0.489399612f, 0.622681201f},
-std::array<float,2>{0.92799598f, 0.267766207f},
-std::array<float,2>{0.417284757f, 0.169856086f},
-std::array<float,2>{0.97737366f, 0.995720208f},
-std::array<float,2>{0.197265327f, 0.677505076f},
-std::array<float,2>{0.569435298f, 0.436621696f},
-std::array<float,2>{0.11219652f, 0.354845166f},
-std::array<float,2>{0.73057735f, 0.556048453f},
-std::array<float,2>{0.308141291f, 0.822373569f},
-std::array<float,2>{0.829945505f, 0.0587800145f},
-std::array<float,2>{0.49816829f, 0.469625771f},
-std::array<float,2>{0.933624864f, 0.734781206f},
-std::array<float,2>{0.185304552f, 0.892532647f},
-std::array<float,2>{0.544534981f, 0.206835464f},
-std::array<float,2>{0.0353640579f, 0.112757809f},
-std::array<float,2>{0.638000131f, 0.773054898f},
-std::array<float,2>{0.353769898f, 0.571436465f},
-std::array<float,2>{0.763492405f, 0.301398993f},
-std::array<float,2>{0.296917319f, 0.130100667f},
-std::array<float,2>{0.838002861f, 0.946625233f},
-std::array<float,2>{0.120192252f, 0.625811279f},
-std::array<float,2>{0.722657561f, 0.37628442f},
-std::array<float,2>{0.191610634f, 0.329669535f},
-std::array<float,2>{0.574120283f, 0.52153635f},
-std::array<float,2>{0.40917331f, 0.851283908f},
-std::array<float,2>{0.970403612f, 0.0273399223f},
-std::array<float,2>{0.331589431f, 0.280384064f},
-std::array<float,2>{0.80335182f, 0.614699006f},
-std::array<float,2>{0.0200748499f, 0.808830321f},
-std::array<float,2>{0.682683825f, 0.086423859f},
-std::array<float,2>{0.151287451f, 0.235228091f},
-std::array<float,2>{0.51879257f, 0.91819489f},
-std::array<float,2>{0.442178428f, 0.690760612f},
-std::array<float,2>{0.884140849f, 0.458953887f},
-std::array<float,2>{0.401269048f, 0.0495603569f},
-std::array<float,2>{0.961376965f, 0.82018292f},
-std::array<float,2>{0.239207059f, 0.551375031f},
-std::array<float,2>{0.613498986f, 0.350329012f},
-std::array<float,2>{0.0902218968f, 0.427358627f},
-std::array<float,2>{0.700188994f, 0.681489348f},
-std::array<float,2>{0.262485236f, 0.986091852f},
-std::array<float,2>{0.867798507f, 0.159051761f},
-std::array<float,2>{0.425653756f, 0.372372657f},
-std::array<float,2>{0.996154785f, 0.540035248f},
-std::array<float,2>{0.216462627f, 0.84229368f},
-std::array<float,2>{0.591371357f, 0.0393045992f},
-std::array<float,2>{0.0990191475f, 0.172885224f},
-std::array<float,2>{0.743725479f, 0.977037251f},
-std::array<float,2>{0.287935942f, 0.671033561f},
-std::array<float,2>{0.814610958f, 0.41172117f},
-std::array<float,2>{0.363393754f, 0.0765988752f},
-std::array<float,2>{0.775498033f, 0.789560854f},
-std::array<float,2>{0.0582373552f, 0.599455655f},
-std::array<float,2>{0.654295206f, 0.260608286f},
-std::array<float,2>{0.158554599f, 0.439876735f},
-std::array<float,2>{0.551584661f, 0.716625929f},
-std::array<float,2>{0.479536682f, 0.9335379f},
-std::array<float,2>{0.906924605f, 0.234070286f},
-std::array<float,2>{0.265913725f, 0.396742165f},
-std::array<float,2>{0.858330011f, 0.655384421f},
-std::array<float,2>{0.0702466965f, 0.959156156f},
-std::array<float,2>{0.70725143f, 0.15355666f},
-std::array<float,2>{0.224814236f, 0.000180289891f},
-std::array<float,2>{0.603693604f, 0.862182021f},
-std::array<float,2>{0.377097219f, 0.503263235f},
-std::array<float,2>{0.947936654f, 0.319756269f},
-std::array<float,2>{0.456534922f, 0.188973784f},
-std::array<float,2>{0.901095212f, 0.888378203f},
-std::array<float,2>{0.140011624f, 0.73241818f},
-std::array<float,2>{0.504565835f, 0.488539696f},
-std::array<float,2>{0.000269577984f, 0.287955552f},
-std::array<float,2>{0.663183212f, 0.585805237f},
-std::array<float,2>{0.323269069f, 0.76299417f},
-std::array<float,2>{0.790320635f, 0.0969556868f},
-std::array<float,2>{0.412593067f, 0.45164898f},
-std::array<float,2>{0.976082027f, 0.707809746f},
-std::array<float,2>{0.191019565f, 0.924269617f},
-std::array<float,2>{0.576391637f, 0.222324952f},
-std::array<float,2>{0.122820899f, 0.0693141147f},
-std::array<float,2>{0.719617546f, 0.782396674f},
-std::array<float,2>{0.302212268f, 0.605286777f},
-std::array<float,2>{0.841476083f, 0.256143153f},
-std::array<float,2>{0.3556014f, 0.186950281f},
-std::array<float,2>{0.759948969f, 0.969954371f},
-std::array<float,2>{0.0338030457f, 0.659892738f},
-std::array<float,2>{0.63582629f, 0.416819453f},
-std::array<float,2>{0.180258945f, 0.36004737f},
-std::array<float,2>{0.542135656f, 0.534097493f},
-std::array<float,2>{0.493414104f, 0.835479856f},
-std::array<float,2>{0.930318654f, 0.034944389f},
-std::array<float,2>{0.259261817f, 0.294752687f},
-std::array<float,2>{0.871780097f, 0.589694142f},
-std::array<float,2>{0.0872790739f, 0.751897693f},
-std::array<float,2>{0.698595345f, 0.102620922f},
-std::array<float,2>{0.237691641f, 0.196433514f},
-std::array<float,2>{0.612887919f, 0.879412293f},
-std::array<float,2>{0.404564828f, 0.726245821f},
-std::array<float,2>{0.965522349f, 0.496111214f},
-std::array<float,2>{0.4407911f, 0.0121072009f},
-std::array<float,2>{0.888774455f, 0.873257458f},
-std::array<float,2>{0.15391016f, 0.508403897f},
-std::array<float,2>{0.520221293f, 0.324247837f},
-std::array<float,2>{0.0184787028f, 0.400530308f},
-std::array<float,2>{0.684864342f, 0.641706884f},
-std::array<float,2>{0.335242897f, 0.965112805f},
-std::array<float,2>{0.800677896f, 0.142327711f},
-std::array<float,2>{0.483525306f, 0.342873842f},
-std::array<float,2>{0.912156701f, 0.524567068f},
-std::array<float,2>{0.163700745f, 0.854346395f},
-std::array<float,2>{0.546972692f, 0.0176334362f},
-std::array<float,2>{0.0592279844f, 0.133150846f},
-std::array<float,2>{0.650150001f, 0.937575459f},
-std::array<float,2>{0.361490399f, 0.637823761f},
-std::array<float,2>{0.779744029f, 0.386866868f},
-std::array<float,2>{0.283676982f, 0.12414892f},
-std::array<float,2>{0.817226529f, 0.777764857f},
-std::array<float,2>{0.0968281552f, 0.563179135f},
-std::array<float,2>{0.747407198f, 0.309492081f},
-std::array<float,2>{0.211086288f, 0.479570448f},
-std::array<float,2>{0.588704586f, 0.749790728f},
-std::array<float,2>{0.42778483f, 0.899715781f},
-std::array<float,2>{0.993640661f, 0.215379864f},
-std::array<float,2>{0.328040361f, 0.433246464f},
-std::array<float,2>{0.796540558f, 0.674653411f},
-std::array<float,2>{0.00590559933f, 0.997524738f},
-std::array<float,2>{0.658694565f, 0.164354503f},
-std::array<float,2>{0.133474305f, 0.056618467f},
-std::array<float,2>{0.503884733f, 0.825449705f},
-std::array<float,2>{0.457539976f, 0.559439003f},
-std::array<float,2>{0.906119585f, 0.356161356f},
-std::array<float,2>{0.382451177f, 0.249520257f},
-std::array<float,2>{0.950343907f, 0.908892572f},
-std::array<float,2>{0.221502677f, 0.698861957f},
-std::array<float,2>{0.60640353f, 0.462388963f},
-std::array<float,2>{0.0663439482f, 0.273339361f},
-std::array<float,2>{0.705022275f, 0.619648516f},
-std::array<float,2>{0.271860927f, 0.80414927f},
-std::array<float,2>{0.854871511f, 0.0822516233f},
-std::array<float,2>{0.465637088f, 0.382579297f},
-std::array<float,2>{0.894398868f, 0.631696045f},
-std::array<float,2>{0.132018745f, 0.952138424f},
-std::array<float,2>{0.510437608f, 0.128150716f},
-std::array<float,2>{0.00968604349f, 0.0310762525f},
-std::array<float,2>{0.664432049f, 0.846384645f},
-std::array<float,2>{0.313835204f, 0.519195139f},
-std::array<float,2>{0.787173331f, 0.333718836f},
-std::array<float,2>{0.27714783f, 0.207733661f},
-std::array<float,2>{0.844495296f, 0.896562397f},
-std::array<float,2>{0.0749149397f, 0.739874363f},
-std::array<float,2>{0.714046896f, 0.472673625f},
-std::array<float,2>{0.232961237f, 0.296946406f},
-std::array<float,2>{0.598552048f, 0.576727688f},
-std::array<float,2>{0.386042178f, 0.769430339f},
-std::array<float,2>{0.939439178f, 0.115419015f},
-std::array<float,2>{0.369288832f, 0.34552002f},
-std::array<float,2>{0.771289587f, 0.547335029f},
-std::array<float,2>{0.0477640927f, 0.813125014f},
-std::array<float,2>{0.643286705f, 0.0511081517f},
-std::array<float,2>{0.165996224f, 0.161935702f},
-std::array<float,2>{0.557421982f, 0.992128432f},
-std::array<float,2>{0.468830496f, 0.684345067f},
-std::array<float,2>{0.915478766f, 0.425601393f},
-std::array<float,2>{0.431305468f, 0.0914489999f},
-std::array<float,2>{0.9915663f, 0.807141721f},
-std::array<float,2>{0.204540476f, 0.612826288f},
-std::array<float,2>{0.578799069f, 0.273636967f},
-std::array<float,2>{0.103605956f, 0.456804186f},
-std::array<float,2>{0.735189617f, 0.694064796f},
-std::array<float,2>{0.291395932f, 0.91620183f},
-std::array<float,2>{0.825856388f, 0.241589442f},
-std::array<float,2>{0.393605381f, 0.263237178f},
-std::array<float,2>{0.959348977f, 0.594958603f},
-std::array<float,2>{0.245882615f, 0.794736564f},
-std::array<float,2>{0.621641338f, 0.0730890408f},
-std::array<float,2>{0.0815918297f, 0.227555722f},
-std::array<float,2>{0.691098571f, 0.934796512f},
-std::array<float,2>{0.250073791f, 0.711043179f},
-std::array<float,2>{0.860270381f, 0.444800556f},
-std::array<float,2>{0.342141569f, 0.0464268476f},
-std::array<float,2>{0.809401214f, 0.8371557f},
-std::array<float,2>{0.0286819693f, 0.544854701f},
-std::array<float,2>{0.675409138f, 0.367694825f},
-std::array<float,2>{0.145632774f, 0.408102542f},
-std::array<float,2>{0.530578852f, 0.664250612f},
-std::array<float,2>{0.44895348f, 0.981473327f},
-std::array<float,2>{0.881321788f, 0.179229543f},
-std::array<float,2>{0.310411334f, 0.4859851f},
-std::array<float,2>{0.834722936f, 0.730072796f},
-std::array<float,2>{0.115856089f, 0.884325981f},
-std::array<float,2>{0.728021622f, 0.191445589f},
-std::array<float,2>{0.19992514f, 0.100013167f},
-std::array<float,2>{0.566134155f, 0.758015752f},
-std::array<float,2>{0.418283015f, 0.580069602f},
-std::array<float,2>{0.980731368f, 0.283341885f},
-std::array<float,2>{0.48788321f, 0.150293529f},
-std::array<float,2>{0.925150037f, 0.953468442f},
-std::array<float,2>{0.178453088f, 0.649629891f},
-std::array<float,2>{0.534310222f, 0.392984658f},
-std::array<float,2>{0.0410135835f, 0.314630121f},
-std::array<float,2>{0.630135655f, 0.507338464f},
-std::array<float,2>{0.351026833f, 0.866378784f},
-std::array<float,2>{0.757430732f, 0.00618886296f},
-std::array<float,2>{0.435177505f, 0.405676156f},
-std::array<float,2>{0.987791538f, 0.645385087f},
-std::array<float,2>{0.207787186f, 0.961499214f},
-std::array<float,2>{0.585394263f, 0.14558503f},
-std::array<float,2>{0.106022626f, 0.0108554773f},
-std::array<float,2>{0.739395976f, 0.870686114f},
-std::array<float,2>{0.296237022f, 0.514774501f},
-std::array<float,2>{0.821119368f, 0.321201533f},
-std::array<float,2>{0.374308884f, 0.202037573f},
-std::array<float,2>{0.766918719f, 0.87886858f},
-std::array<float,2>{0.0508307256f, 0.720658958f},
-std::array<float,2>{0.647165358f, 0.492307097f},
-std::array<float,2>{0.169410452f, 0.290892124f},
-std::array<float,2>{0.560945928f, 0.591721833f},
-std::array<float,2>{0.474759817f, 0.754837036f},
-std::array<float,2>{0.919695675f, 0.105651088f},
-std::array<float,2>{0.277465463f, 0.364725828f},
-std::array<float,2>{0.848416626f, 0.537618041f},
-std::array<float,2>{0.0706834868f, 0.831843317f},
-std::array<float,2>{0.716081798f, 0.0355013683f},
-std::array<float,2>{0.230338424f, 0.180095926f},
-std::array<float,2>{0.59691757f, 0.975950301f},
-std::array<float,2>{0.389950991f, 0.66025269f},
-std::array<float,2>{0.941696763f, 0.420881361f},
-std::array<float,2>{0.46160385f, 0.0647343248f},
-std::array<float,2>{0.896166146f, 0.787731349f},
-std::array<float,2>{0.127010733f, 0.608778775f},
-std::array<float,2>{0.512639523f, 0.251735777f},
-std::array<float,2>{0.0121673392f, 0.448676735f},
-std::array<float,2>{0.670466542f, 0.70584929f},
-std::array<float,2>{0.319306403f, 0.927733183f},
-std::array<float,2>{0.783200443f, 0.225735962f},
-std::array<float,2>{0.490569353f, 0.267115384f},
-std::array<float,2>{0.926137507f, 0.624531329f},
-std::array<float,2>{0.174279481f, 0.800117493f},
-std::array<float,2>{0.535652399f, 0.0808745474f},
-std::array<float,2>{0.0433384478f, 0.244633436f},
-std::array<float,2>{0.628902316f, 0.910728872f},
-std::array<float,2>{0.346721858f, 0.702329457f},
-std::array<float,2>{0.753685951f, 0.466718078f},
-std::array<float,2>{0.305325001f, 0.0621234849f},
-std::array<float,2>{0.831343412f, 0.821609974f},
-std::array<float,2>{0.111245342f, 0.558396101f},
-std::array<float,2>{0.734031141f, 0.352484196f},
-std::array<float,2>{0.197406709f, 0.434855849f},
-std::array<float,2>{0.568100989f, 0.679120421f},
-std::array<float,2>{0.414292753f, 0.993363678f},
-std::array<float,2>{0.978700638f, 0.171431378f},
-std::array<float,2>{0.339237928f, 0.481907159f},
-std::array<float,2>{0.80684787f, 0.742584705f},
-std::array<float,2>{0.0236648805f, 0.905875802f},
-std::array<float,2>{0.679091454f, 0.213675976f},
-std::array<float,2>{0.143971071f, 0.11910639f},
-std::array<float,2>{0.526914537f, 0.774760067f},
-std::array<float,2>{0.45080325f, 0.569143772f},
-std::array<float,2>{0.878176272f, 0.306848288f},
-std::array<float,2>{0.396293819f, 0.140134901f},
-std::array<float,2>{0.954689801f, 0.942114592f},
-std::array<float,2>{0.24630779f, 0.635782003f},
-std::array<float,2>{0.619144857f, 0.386461914f},
-std::array<float,2>{0.0827076361f, 0.336286992f},
-std::array<float,2>{0.692246854f, 0.52806282f},
-std::array<float,2>{0.253978908f, 0.85821557f},
-std::array<float,2>{0.866285145f, 0.0209918842f},
-std::array<float,2>{0.44460395f, 0.459441155f},
-std::array<float,2>{0.885335445f, 0.687877297f},
-std::array<float,2>{0.15009205f, 0.92124337f},
-std::array<float,2>{0.516325235f, 0.237897813f},
-std::array<float,2>{0.0229451992f, 0.0879939124f},
-std::array<float,2>{0.681242526f, 0.811768174f},
-std::array<float,2>{0.329118788f, 0.616260231f},
-std::array<float,2>{0.801397145f, 0.277965844f},
-std::array<float,2>{0.263723761f, 0.157527879f},
-std::array<float,2>{0.871044278f, 0.987273991f},
-std::array<float,2>{0.0934911147f, 0.682908177f},
-std::array<float,2>{0.701383591f, 0.42953369f},
-std::array<float,2>{0.242107868f, 0.34875831f},
-std::array<float,2>{0.616038561f, 0.552793503f},
-std::array<float,2>{0.3997491f, 0.817183197f},
-std::array<float,2>{0.963896513f, 0.0479696244f},
-std::array<float,2>{0.352214307f, 0.304548085f},
-std::array<float,2>{0.764035881f, 0.573756874f},
-std::array<float,2>{0.0383488908f, 0.769847691f},
-std::array<float,2>{0.638917863f, 0.111244664f},
-std::array<float,2>{0.186798453f, 0.203930244f},
-std::array<float,2>{0.546724319f, 0.892614365f},
-std::array<float,2>{0.49747619f, 0.737395823f},
-std::array<float,2>{0.936699092f, 0.471049279f},
-std::array<float,2>{0.406801283f, 0.0235091746f},
-std::array<float,2>{0.972565472f, 0.848337889f},
-std::array<float,2>{0.19380334f, 0.519973457f},
-std::array<float,2>{0.571095765f, 0.330942422f},
-std::array<float,2>{0.117638364f, 0.378551424f},
-std::array<float,2>{0.725010514f, 0.627839267f},
-std::array<float,2>{0.299645573f, 0.949025393f},
-std::array<float,2>{0.836143374f, 0.131992131f},
-std::array<float,2>{0.376163155f, 0.318016082f},
-std::array<float,2>{0.945791066f, 0.5009377f},
-std::array<float,2>{0.223793253f, 0.859644353f},
-std::array<float,2>{0.602309823f, 0.00376997865f},
-std::array<float,2>{0.0682003051f, 0.155936405f},
-std::array<float,2>{0.710163414f, 0.958699048f},
-std::array<float,2>{0.268201411f, 0.65258801f},
-std::array<float,2>{0.857093155f, 0.395308614f},
-std::array<float,2>{0.321573317f, 0.0945031568f},
-std::array<float,2>{0.791810632f, 0.765310585f},
-std::array<float,2>{0.00370916515f, 0.582565129f},
-std::array<float,2>{0.66106236f, 0.286302447f},
-std::array<float,2>{0.13674663f, 0.490720272f},
-std::array<float,2>{0.506899834f, 0.734192491f},
-std::array<float,2>{0.454402447f, 0.889745116f},
-std::array<float,2>{0.899121046f, 0.190696329f},
-std::array<float,2>{0.285996765f, 0.412966013f},
-std::array<float,2>{0.814099669f, 0.668275595f},
-std::array<float,2>{0.101316482f, 0.979936302f},
-std::array<float,2>{0.744531035f, 0.175112024f},
-std::array<float,2>{0.216957107f, 0.0413890593f},
-std::array<float,2>{0.591945052f, 0.841330886f},
-std::array<float,2>{0.422346681f, 0.542829752f},
-std::array<float,2>{0.998564363f, 0.373681456f},
-std::array<float,2>{0.477611989f, 0.232259482f},
-std::array<float,2>{0.909379125f, 0.931340277f},
-std::array<float,2>{0.157849967f, 0.717767596f},
-std::array<float,2>{0.554439664f, 0.438387364f},
-std::array<float,2>{0.0550139807f, 0.259208471f},
-std::array<float,2>{0.654509366f, 0.600286543f},
-std::array<float,2>{0.365304589f, 0.792832613f},
-std::array<float,2>{0.774171174f, 0.0746994689f},
-std::array<float,2>{0.404185772f, 0.499342591f},
-std::array<float,2>{0.96705991f, 0.723956048f},
-std::array<float,2>{0.235127255f, 0.881213844f},
-std::array<float,2>{0.610335112f, 0.198927447f},
-std::array<float,2>{0.0892387554f, 0.104050525f},
-std::array<float,2>{0.695893168f, 0.753117442f},
-std::array<float,2>{0.260281235f, 0.587798297f},
-std::array<float,2>{0.874596059f, 0.29519996f},
-std::array<float,2>{0.332603931f, 0.142732367f},
-std::array<float,2>{0.798022509f, 0.967748702f},
-std::array<float,2>{0.017222641f, 0.643043876f},
-std::array<float,2>{0.687457085f, 0.398790121f},
-std::array<float,2>{0.154708698f, 0.327310979f},
-std::array<float,2>{0.52329427f, 0.510581672f},
-std::array<float,2>{0.438043028f, 0.87290746f},
-std::array<float,2>{0.886799991f, 0.014931744f},
-std::array<float,2>{0.304488719f, 0.253918558f},
-std::array<float,2>{0.843611479f, 0.601622939f},
-std::array<float,2>{0.124420084f, 0.784060717f},
-std::array<float,2>{0.721151412f, 0.0676911101f},
-std::array<float,2>{0.188102722f, 0.219796047f},
-std::array<float,2>{0.574420393f, 0.923474371f},
-std::array<float,2>{0.411156893f, 0.710426688f},
-std::array<float,2>{0.974386036f, 0.450090855f},
-std::array<float,2>{0.494525284f, 0.0320802853f},
-std::array<float,2>{0.933490157f, 0.832714498f},
-std::array<float,2>{0.18317686f, 0.53125149f},
-std::array<float,2>{0.54078418f, 0.361798912f},
-std::array<float,2>{0.0317031667f, 0.415786207f},
-std::array<float,2>{0.633210301f, 0.656770885f},
-std::array<float,2>{0.358085215f, 0.971599579f},
-std::array<float,2>{0.758962452f, 0.185015753f},
-std::array<float,2>{0.459858388f, 0.35918507f},
-std::array<float,2>{0.903986633f, 0.560843527f},
-std::array<float,2>{0.135040328f, 0.826446891f},
-std::array<float,2>{0.500488102f, 0.0571001582f},
-std::array<float,2>{0.00469477149f, 0.166732237f},
-std::array<float,2>{0.656309247f, 0.998442173f},
-std::array<float,2>{0.324449897f, 0.672646403f},
-std::array<float,2>{0.793067098f, 0.430148542f},
-std::array<float,2>{0.270004779f, 0.0840134025f},
-std::array<float,2>{0.85349822f, 0.802167892f},
-std::array<float,2>{0.0643513799f, 0.618126512f},
-std::array<float,2>{0.706929445f, 0.269919723f},
-std::array<float,2>{0.218758658f, 0.463730633f},
-std::array<float,2>{0.608495176f, 0.695648968f},
-std::array<float,2>{0.379921138f, 0.906606019f},
-std::array<float,2>{0.952159047f, 0.246460676f},
-std::array<float,2>{0.360734016f, 0.388922542f},
-std::array<float,2>{0.778784931f, 0.640114784f},
-std::array<float,2>{0.0614433959f, 0.941326618f},
-std::array<float,2>{0.650543511f, 0.136016682f},
-std::array<float,2>{0.161617398f, 0.0156563111f},
-std::array<float,2>{0.548873246f, 0.851814866f},
-std::array<float,2>{0.481453806f, 0.526353598f},
-std::array<float,2>{0.911217451f, 0.340298265f},
-std::array<float,2>{0.425854892f, 0.217912287f},
-std::array<float,2>{0.995208144f, 0.900502622f},
-std::array<float,2>{0.214235067f, 0.74624145f},
-std::array<float,2>{0.586261213f, 0.478147626f},
-std::array<float,2>{0.093751438f, 0.31084913f},
-std::array<float,2>{0.749956429f, 0.565974474f},
-std::array<float,2>{0.283148557f, 0.779566824f},
-std::array<float,2>{0.82007277f, 0.122956552f},
-std::array<float,2>{0.471262127f, 0.422902375f},
-std::array<float,2>{0.917795181f, 0.686405063f},
-std::array<float,2>{0.166363001f, 0.988355517f},
-std::array<float,2>{0.556152165f, 0.162722304f},
-std::array<float,2>{0.0498345681f, 0.0545777716f},
-std::array<float,2>{0.642009497f, 0.814812779f},
-std::array<float,2>{0.367899895f, 0.548834026f},
-std::array<float,2>{0.773141146f, 0.347382188f},
-std::array<float,2>{0.290804505f, 0.238318622f},
-std::array<float,2>{0.827577233f, 0.914276302f},
-std::array<float,2>{0.101599254f, 0.692270219f},
-std::array<float,2>{0.736973047f, 0.453465819f},
-std::array<float,2>{0.205996379f, 0.275975943f},
-std::array<float,2>{0.580145776f, 0.610694647f},
-std::array<float,2>{0.432077616f, 0.806121826f},
-std::array<float,2>{0.989247382f, 0.0920197666f},
-std::array<float,2>{0.314543903f, 0.335934907f},
-std::array<float,2>{0.785256386f, 0.516186297f},
-std::array<float,2>{0.0104723601f, 0.844002604f},
-std::array<float,2>{0.666398048f, 0.029233845f},
-std::array<float,2>{0.129035324f, 0.126169249f},
-std::array<float,2>{0.509136736f, 0.950497031f},
-std::array<float,2>{0.467406958f, 0.629317939f},
-std::array<float,2>{0.890783191f, 0.380074352f},
-std::array<float,2>{0.384551972f, 0.115111306f},
-std::array<float,2>{0.940186203f, 0.766022921f},
-std::array<float,2>{0.232101813f, 0.574427903f},
-std::array<float,2>{0.600347757f, 0.299198955f},
-std::array<float,2>{0.0776870772f, 0.475429893f},
-std::array<float,2>{0.712445974f, 0.740493298f},
-std::array<float,2>{0.275328249f, 0.896231055f},
-std::array<float,2>{0.847197115f, 0.209828585f},
-std::array<float,2>{0.420707375f, 0.28315717f},
-std::array<float,2>{0.982699394f, 0.580806971f},
-std::array<float,2>{0.202418149f, 0.761375666f},
-std::array<float,2>{0.564300418f, 0.0980779156f},
-std::array<float,2>{0.11396566f, 0.194954306f},
-std::array<float,2>{0.729340672f, 0.885780752f},
-std::array<float,2>{0.311521381f, 0.727582037f},
-std::array<float,2>{0.832309246f, 0.488003284f},
-std::array<float,2>{0.347992271f, 0.0057147895f},
-std::array<float,2>{0.754131675f, 0.863346219f},
-std::array<float,2>{0.0413235687f, 0.504176557f},
-std::array<float,2>{0.631873131f, 0.313183784f},
-std::array<float,2>{0.176294178f, 0.392197996f},
-std::array<float,2>{0.531663954f, 0.650883257f},
-std::array<float,2>{0.484584332f, 0.95701164f},
-std::array<float,2>{0.922565818f, 0.151952878f},
-std::array<float,2>{0.252429903f, 0.442789763f},
-std::array<float,2>{0.863054812f, 0.714291632f},
-std::array<float,2>{0.0799181461f, 0.935598373f},
-std::array<float,2>{0.687536538f, 0.229989275f},
-std::array<float,2>{0.243589193f, 0.0720657408f},
-std::array<float,2>{0.624710083f, 0.796195805f},
-std::array<float,2>{0.392316937f, 0.595883489f},
-std::array<float,2>{0.958240151f, 0.264811367f},
-std::array<float,2>{0.447061121f, 0.176932499f},
-std::array<float,2>{0.87977016f, 0.982965469f},
-std::array<float,2>{0.14700681f, 0.66609031f},
-std::array<float,2>{0.528237939f, 0.409686685f},
-std::array<float,2>{0.0297007263f, 0.370233059f},
-std::array<float,2>{0.673387706f, 0.545404375f},
-std::array<float,2>{0.340647817f, 0.839085877f},
-std::array<float,2>{0.812283993f, 0.0441895686f},
-std::array<float,2>{0.415400028f, 0.436342329f},
-std::array<float,2>{0.979905665f, 0.675993562f},
-std::array<float,2>{0.19866924f, 0.994905472f},
-std::array<float,2>{0.566595256f, 0.168243036f},
-std::array<float,2>{0.110009275f, 0.059588328f},
-std::array<float,2>{0.732576609f, 0.82360357f},
-std::array<float,2>{0.306514174f, 0.555127919f},
-std::array<float,2>{0.830302298f, 0.354033291f},
-std::array<float,2>{0.346531689f, 0.242229924f},
-std::array<float,2>{0.752191365f, 0.912876546f},
-std::array<float,2>{0.0447512604f, 0.699419618f},
-std::array<float,2>{0.62772131f, 0.4686037f},
-std::array<float,2>{0.17566587f, 0.268906146f},
-std::array<float,2>{0.536875904f, 0.621215403f},
-std::array<float,2>{0.491888434f, 0.798287272f},
-std::array<float,2>{0.927623928f, 0.0781899616f},
-std::array<float,2>{0.255785435f, 0.337901771f},
-std::array<float,2>{0.865972281f, 0.530640662f},
-std::array<float,2>{0.0832157433f, 0.856294453f},
-std::array<float,2>{0.692505956f, 0.0215892326f},
-std::array<float,2>{0.247084007f, 0.137983143f},
-std::array<float,2>{0.620608687f, 0.944826722f},
-std::array<float,2>{0.39509359f, 0.633148611f},
-std::array<float,2>{0.954033732f, 0.383796185f},
-std::array<float,2>{0.449506879f, 0.120004542f},
-std::array<float,2>{0.877000153f, 0.775551677f},
-std::array<float,2>{0.143489495f, 0.568073452f},
-std::array<float,2>{0.525823772f, 0.306622863f},
-std::array<float,2>{0.0245586075f, 0.482905775f},
-std::array<float,2>{0.677861869f, 0.744997025f},
-std::array<float,2>{0.338432968f, 0.90427196f},
-std::array<float,2>{0.808351159f, 0.211252719f},
-std::array<float,2>{0.47610268f, 0.292520672f},
-std::array<float,2>{0.918909252f, 0.591850698f},
-std::array<float,2>{0.168504581f, 0.755987227f},
-std::array<float,2>{0.562292576f, 0.108753838f},
-std::array<float,2>{0.0524309948f, 0.200139657f},
-std::array<float,2>{0.648433864f, 0.876445472f},
-std::array<float,2>{0.373980284f, 0.722214699f},
-std::array<float,2>{0.766164482f, 0.494500458f},
-std::array<float,2>{0.295733958f, 0.0092260344f},
-std::array<float,2>{0.82137996f, 0.868119419f},
-std::array<float,2>{0.106741093f, 0.512681425f},
-std::array<float,2>{0.738852859f, 0.323376238f},
-std::array<float,2>{0.208753005f, 0.4029468f},
-std::array<float,2>{0.5845716f, 0.647651553f},
-std::array<float,2>{0.433885038f, 0.964140058f},
-std::array<float,2>{0.98682636f, 0.14687638f},
-std::array<float,2>{0.319590986f, 0.446435064f},
-std::array<float,2>{0.781982303f, 0.704247892f},
-std::array<float,2>{0.0136586297f, 0.929109871f},
-std::array<float,2>{0.671175003f, 0.223916143f},
-std::array<float,2>{0.12861225f, 0.0631734058f},
-std::array<float,2>{0.513164461f, 0.785565138f},
-std::array<float,2>{0.462718338f, 0.605503619f},
-std::array<float,2>{0.895337224f, 0.252169371f},
-std::array<float,2>{0.389096469f, 0.182924137f},
-std::array<float,2>{0.942430973f, 0.972929597f},
-std::array<float,2>{0.228844568f, 0.663532078f},
-std::array<float,2>{0.596177578f, 0.419837594f},
-std::array<float,2>{0.0713184178f, 0.366219521f},
-std::array<float,2>{0.71577096f, 0.53656292f},
-std::array<float,2>{0.279185981f, 0.829375684f},
-std::array<float,2>{0.848671138f, 0.0385278501f},
-std::array<float,2>{0.453558266f, 0.489558309f},
-std::array<float,2>{0.899819195f, 0.730642796f},
-std::array<float,2>{0.138483375f, 0.887680411f},
-std::array<float,2>{0.506561339f, 0.188472867f},
-std::array<float,2>{0.00200559013f, 0.0962169841f},
-std::array<float,2>{0.661282301f, 0.762647033f},
-std::array<float,2>{0.320500523f, 0.584056437f},
-std::array<float,2>{0.792655647f, 0.288982242f},
-std::array<float,2>{0.269136935f, 0.152772084f},
-std::array<float,2>{0.855995178f, 0.960884392f},
-std::array<float,2>{0.0673354864f, 0.654736936f},
-std::array<float,2>{0.7090469f, 0.397752941f},
-std::array<float,2>{0.223420322f, 0.31900236f},
-std::array<float,2>{0.602680981f, 0.50262624f},
-std::array<float,2>{0.375418961f, 0.863001943f},
-std::array<float,2>{0.946727931f, 0.00136084552f},
-std::array<float,2>{0.366908789f, 0.261600494f},
-std::array<float,2>{0.774915457f, 0.597940147f},
-std::array<float,2>{0.0562255532f, 0.790603399f},
-std::array<float,2>{0.655543625f, 0.0771651864f},
-std::array<float,2>{0.157220438f, 0.232808694f},
-std::array<float,2>{0.552909493f, 0.932196438f},
-std::array<float,2>{0.477475762f, 0.715274274f},
-std::array<float,2>{0.908736765f, 0.440868348f},
-std::array<float,2>{0.423224032f, 0.0406508557f},
-std::array<float,2>{0.999610543f, 0.84365052f},
-std::array<float,2>{0.218087018f, 0.540563643f},
-std::array<float,2>{0.593466043f, 0.371904314f},
-std::array<float,2>{0.100072168f, 0.410659432f},
-std::array<float,2>{0.745766103f, 0.670199931f},
-std::array<float,2>{0.286788076f, 0.978354692f},
-std::array<float,2>{0.813236296f, 0.172480345f},
-std::array<float,2>{0.398717999f, 0.350767136f},
-std::array<float,2>{0.963186741f, 0.551879168f},
-std::array<float,2>{0.240812525f, 0.8188833f},
-std::array<float,2>{0.616573334f, 0.0506062061f},
-std::array<float,2>{0.092151545f, 0.159659326f},
-std::array<float,2>{0.703031421f, 0.984774053f},
-std::array<float,2>{0.264702827f, 0.680421591f},
-std::array<float,2>{0.869796813f, 0.426689506f},
-std::array<float,2>{0.328694224f, 0.087163955f},
-std::array<float,2>{0.802486897f, 0.809731603f},
-std::array<float,2>{0.0218399409f, 0.613931537f},
-std::array<float,2>{0.680451453f, 0.279383689f},
-std::array<float,2>{0.149025559f, 0.457131326f},
-std::array<float,2>{0.517166793f, 0.68992281f},
-std::array<float,2>{0.444273055f, 0.91950798f},
-std::array<float,2>{0.886403024f, 0.236177236f},
-std::array<float,2>{0.300537944f, 0.375263184f},
-std::array<float,2>{0.837164402f, 0.62687856f},
-std::array<float,2>{0.118232213f, 0.945948362f},
-std::array<float,2>{0.725927234f, 0.129219115f},
-std::array<float,2>{0.194536492f, 0.0256430171f},
-std::array<float,2>{0.571735024f, 0.850288749f},
-std::array<float,2>{0.407587945f, 0.522590637f},
-std::array<float,2>{0.971053123f, 0.328587353f},
-std::array<float,2>{0.496095747f, 0.205436021f},
-std::array<float,2>{0.936235547f, 0.891067982f},
-std::array<float,2>{0.186121345f, 0.735989749f},
-std::array<float,2>{0.545067072f, 0.469942182f},
-std::array<float,2>{0.0378779955f, 0.302309513f},
-std::array<float,2>{0.640439332f, 0.570588052f},
-std::array<float,2>{0.352865249f, 0.77217412f},
-std::array<float,2>{0.764867425f, 0.112079412f},
-std::array<float,2>{0.379209369f, 0.461180657f},
-std::array<float,2>{0.952086568f, 0.697578132f},
-std::array<float,2>{0.219759539f, 0.9097085f},
-std::array<float,2>{0.607633471f, 0.248166084f},
-std::array<float,2>{0.0627949312f, 0.0833915249f},
-std::array<float,2>{0.705729127f, 0.803139269f},
-std::array<float,2>{0.271119326f, 0.620740712f},
-std::array<float,2>{0.851833999f, 0.271977782f},
-std::array<float,2>{0.326000184f, 0.165404513f},
-std::array<float,2>{0.794120789f, 0.996328175f},
-std::array<float,2>{0.00554819871f, 0.675578237f},
-std::array<float,2>{0.657648921f, 0.431711167f},
-std::array<float,2>{0.136183247f, 0.357067168f},
-std::array<float,2>{0.501709282f, 0.55969429f},
-std::array<float,2>{0.460803479f, 0.82424444f},
-std::array<float,2>{0.902837753f, 0.0549698658f},
-std::array<float,2>{0.281681836f, 0.309910595f},
-std::array<float,2>{0.818994403f, 0.564219296f},
-std::array<float,2>{0.0955658704f, 0.779133141f},
-std::array<float,2>{0.748821318f, 0.123344585f},
-std::array<float,2>{0.212934345f, 0.21601133f},
-std::array<float,2>{0.587104797f, 0.899132192f},
-std::array<float,2>{0.426852137f, 0.748190165f},
-std::array<float,2>{0.994160593f, 0.478657842f},
-std::array<float,2>{0.480588734f, 0.0193431359f},
-std::array<float,2>{0.91069591f, 0.85509479f},
-std::array<float,2>{0.160468683f, 0.52387166f},
-std::array<float,2>{0.549952388f, 0.342047125f},
-std::array<float,2>{0.0622726232f, 0.388337493f},
-std::array<float,2>{0.652052581f, 0.63764292f},
-std::array<float,2>{0.360165536f, 0.939317524f},
-std::array<float,2>{0.777352989f, 0.134185612f},
-std::array<float,2>{0.439240783f, 0.325716883f},
-std::array<float,2>{0.888000965f, 0.509314239f},
-std::array<float,2>{0.155678704f, 0.874440789f},
-std::array<float,2>{0.521973133f, 0.0127764735f},
-std::array<float,2>{0.0157593377f, 0.14079538f},
-std::array<float,2>{0.685945809f, 0.96662432f},
-std::array<float,2>{0.33378613f, 0.640934289f},
-std::array<float,2>{0.796939671f, 0.402265042f},
-std::array<float,2>{0.261519343f, 0.102291845f},
-std::array<float,2>{0.873646379f, 0.750577807f},
-std::array<float,2>{0.0879862458f, 0.588304996f},
-std::array<float,2>{0.696755528f, 0.29311502f},
-std::array<float,2>{0.235426128f, 0.497601062f},
-std::array<float,2>{0.61067909f, 0.72480762f},
-std::array<float,2>{0.403312206f, 0.880409718f},
-std::array<float,2>{0.967931628f, 0.195313573f},
-std::array<float,2>{0.359120727f, 0.417954654f},
-std::array<float,2>{0.758171618f, 0.658406138f},
-std::array<float,2>{0.0328717902f, 0.969468713f},
-std::array<float,2>{0.634580433f, 0.185547948f},
-std::array<float,2>{0.181717813f, 0.0334413387f},
-std::array<float,2>{0.539876342f, 0.834640265f},
-std::array<float,2>{0.495427281f, 0.534722805f},
-std::array<float,2>{0.932078063f, 0.360917956f},
-std::array<float,2>{0.410900176f, 0.221563786f},
-std::array<float,2>{0.973511517f, 0.924815893f},
-std::array<float,2>{0.188738808f, 0.708462298f},
-std::array<float,2>{0.576073349f, 0.452548087f},
-std::array<float,2>{0.123622254f, 0.257136136f},
-std::array<float,2>{0.721921265f, 0.603836894f},
-std::array<float,2>{0.303416699f, 0.781269431f},
-std::array<float,2>{0.84248054f, 0.069876194f},
-std::array<float,2>{0.486113816f, 0.393902898f},
-std::array<float,2>{0.922936201f, 0.64862287f},
-std::array<float,2>{0.17693159f, 0.954423189f},
-std::array<float,2>{0.532717943f, 0.149010777f},
-std::array<float,2>{0.042848628f, 0.00745046092f},
-std::array<float,2>{0.631545722f, 0.86616993f},
-std::array<float,2>{0.34873262f, 0.50679189f},
-std::array<float,2>{0.755443394f, 0.315476209f},
-std::array<float,2>{0.311527967f, 0.192520663f},
-std::array<float,2>{0.833017766f, 0.882839382f},
-std::array<float,2>{0.114447445f, 0.728942573f},
-std::array<float,2>{0.730143249f, 0.484527618f},
-std::array<float,2>{0.201724857f, 0.284373611f},
-std::array<float,2>{0.562933385f, 0.578700364f},
-std::array<float,2>{0.421185374f, 0.759743869f},
-std::array<float,2>{0.983882964f, 0.100891188f},
-std::array<float,2>{0.341224581f, 0.368975013f},
-std::array<float,2>{0.81086868f, 0.543608844f},
-std::array<float,2>{0.0303932503f, 0.836158395f},
-std::array<float,2>{0.672313571f, 0.0456441082f},
-std::array<float,2>{0.147618562f, 0.178447515f},
-std::array<float,2>{0.529031813f, 0.981113791f},
-std::array<float,2>{0.44549793f, 0.665295839f},
-std::array<float,2>{0.879924655f, 0.406260282f},
-std::array<float,2>{0.391467214f, 0.0735519975f},
-std::array<float,2>{0.957338333f, 0.793716192f},
-std::array<float,2>{0.242464095f, 0.594112992f},
-std::array<float,2>{0.623274386f, 0.262017518f},
-std::array<float,2>{0.0787906125f, 0.444208771f},
-std::array<float,2>{0.689189076f, 0.712155819f},
-std::array<float,2>{0.253548145f, 0.933674097f},
-std::array<float,2>{0.861641943f, 0.226738557f},
-std::array<float,2>{0.433371127f, 0.275334388f},
-std::array<float,2>{0.98945123f, 0.612142801f},
-std::array<float,2>{0.206954688f, 0.808086753f},
-std::array<float,2>{0.581295669f, 0.0903354138f},
-std::array<float,2>{0.102774866f, 0.240496203f},
-std::array<float,2>{0.738090277f, 0.917422652f},
-std::array<float,2>{0.289500356f, 0.694485903f},
-std::array<float,2>{0.82622695f, 0.45526439f},
-std::array<float,2>{0.368606508f, 0.0526404232f},
-std::array<float,2>{0.771775365f, 0.813729107f},
-std::array<float,2>{0.0491097607f, 0.548774779f},
-std::array<float,2>{0.641458869f, 0.344159365f},
-std::array<float,2>{0.167406633f, 0.424524784f},
-std::array<float,2>{0.555395842f, 0.685003459f},
-std::array<float,2>{0.471864879f, 0.990608275f},
-std::array<float,2>{0.91620338f, 0.160390243f},
-std::array<float,2>{0.273600727f, 0.473889351f},
-std::array<float,2>{0.845846593f, 0.739242554f},
-std::array<float,2>{0.0764684752f, 0.897747934f},
-std::array<float,2>{0.710939288f, 0.208047196f},
-std::array<float,2>{0.230998516f, 0.116703041f},
-std::array<float,2>{0.601195633f, 0.768474936f},
-std::array<float,2>{0.383368611f, 0.577511847f},
-std::array<float,2>{0.941113174f, 0.298761129f},
-std::array<float,2>{0.46843794f, 0.127405047f},
-std::array<float,2>{0.891956925f, 0.953044116f},
-std::array<float,2>{0.129950196f, 0.632631898f},
-std::array<float,2>{0.508594155f, 0.381030262f},
-std::array<float,2>{0.0109766955f, 0.332449287f},
-std::array<float,2>{0.667318165f, 0.517850876f},
-std::array<float,2>{0.316329211f, 0.84703964f},
-std::array<float,2>{0.786750078f, 0.0293091163f},
-std::array<float,2>{0.398329109f, 0.385414064f},
-std::array<float,2>{0.955093324f, 0.635194898f},
-std::array<float,2>{0.249286875f, 0.942827106f},
-std::array<float,2>{0.617984653f, 0.138775751f},
-std::array<float,2>{0.0847331807f, 0.0205011088f},
-std::array<float,2>{0.693559349f, 0.859200656f},
-std::array<float,2>{0.257481098f, 0.52848208f},
-std::array<float,2>{0.865216374f, 0.337680697f},
-std::array<float,2>{0.337186188f, 0.214310467f},
-std::array<float,2>{0.806640446f, 0.904505312f},
-std::array<float,2>{0.0259417649f, 0.743611872f},
-std::array<float,2>{0.676101148f, 0.481008947f},
-std::array<float,2>{0.142227098f, 0.308243811f},
-std::array<float,2>{0.523482442f, 0.57017374f},
-std::array<float,2>{0.451609761f, 0.773686051f},
-std::array<float,2>{0.876543283f, 0.117915392f},
-std::array<float,2>{0.307145447f, 0.353285521f},
-std::array<float,2>{0.828770638f, 0.557389855f},
-std::array<float,2>{0.112664193f, 0.820461988f},
-std::array<float,2>{0.7321859f, 0.0608054996f},
-std::array<float,2>{0.196222395f, 0.170138136f},
-std::array<float,2>{0.568575382f, 0.992441058f},
-std::array<float,2>{0.416105837f, 0.678338826f},
-std::array<float,2>{0.977761805f, 0.433851153f},
-std::array<float,2>{0.488677502f, 0.0816149265f},
-std::array<float,2>{0.929381967f, 0.799610853f},
-std::array<float,2>{0.172184199f, 0.623553574f},
-std::array<float,2>{0.537475228f, 0.266062945f},
-std::array<float,2>{0.0462261401f, 0.465622097f},
-std::array<float,2>{0.626799226f, 0.701327085f},
-std::array<float,2>{0.344341069f, 0.911743641f},
-std::array<float,2>{0.751835287f, 0.245469198f},
-std::array<float,2>{0.463145375f, 0.250572652f},
-std::array<float,2>{0.897871375f, 0.608192384f},
-std::array<float,2>{0.126578435f, 0.789059818f},
-std::array<float,2>{0.51468271f, 0.066023849f},
-std::array<float,2>{0.0137501312f, 0.225116462f},
-std::array<float,2>{0.669616163f, 0.92671901f},
-std::array<float,2>{0.317669809f, 0.706528127f},
-std::array<float,2>{0.783801436f, 0.447593421f},
-std::array<float,2>{0.279425085f, 0.0363544077f},
-std::array<float,2>{0.851365566f, 0.830835521f},
-std::array<float,2>{0.0724311545f, 0.538688183f},
-std::array<float,2>{0.717084229f, 0.364248365f},
-std::array<float,2>{0.228255093f, 0.421158463f},
-std::array<float,2>{0.595112979f, 0.66159898f},
-std::array<float,2>{0.388052911f, 0.975508153f},
-std::array<float,2>{0.944665849f, 0.181331292f},
-std::array<float,2>{0.372512043f, 0.493851542f},
-std::array<float,2>{0.768103123f, 0.719525218f},
-std::array<float,2>{0.053082332f, 0.876978576f},
-std::array<float,2>{0.645088494f, 0.202227011f},
-std::array<float,2>{0.171457127f, 0.106965579f},
-std::array<float,2>{0.559985697f, 0.755447686f},
-std::array<float,2>{0.474061489f, 0.589895129f},
-std::array<float,2>{0.921155691f, 0.289889008f},
-std::array<float,2>{0.436733961f, 0.145162657f},
-std::array<float,2>{0.986115098f, 0.962781072f},
-std::array<float,2>{0.209471837f, 0.646473467f},
-std::array<float,2>{0.583311975f, 0.404617816f},
-std::array<float,2>{0.107458897f, 0.321644753f},
-std::array<float,2>{0.742007613f, 0.514158845f},
-std::array<float,2>{0.294280857f, 0.869382739f},
-std::array<float,2>{0.824035823f, 0.0106951445f},
-std::array<float,2>{0.478933305f, 0.438656598f},
-std::array<float,2>{0.908046782f, 0.717810869f},
-std::array<float,2>{0.16011925f, 0.930411637f},
-std::array<float,2>{0.552126825f, 0.230737954f},
-std::array<float,2>{0.0566918664f, 0.0753560439f},
-std::array<float,2>{0.65245837f, 0.791345477f},
-std::array<float,2>{0.364336222f, 0.60066998f},
-std::array<float,2>{0.777264357f, 0.257879823f},
-std::array<float,2>{0.288242906f, 0.174526066f},
-std::array<float,2>{0.815753222f, 0.978624165f},
-std::array<float,2>{0.0980088785f, 0.669532776f},
-std::array<float,2>{0.743160129f, 0.413702101f},
-std::array<float,2>{0.215648964f, 0.374357611f},
-std::array<float,2>{0.590327442f, 0.541953623f},
-std::array<float,2>{0.424156964f, 0.840653002f},
-std::array<float,2>{0.997271717f, 0.0427014418f},
-std::array<float,2>{0.322537005f, 0.285396159f},
-std::array<float,2>{0.789945245f, 0.583970189f},
-std::array<float,2>{0.0015042898f, 0.764197886f},
-std::array<float,2>{0.662343025f, 0.0950286612f},
-std::array<float,2>{0.138753369f, 0.190311819f},
-std::array<float,2>{0.504904985f, 0.889547765f},
-std::array<float,2>{0.455936641f, 0.733134389f},
-std::array<float,2>{0.902222216f, 0.491842926f},
-std::array<float,2>{0.37887162f, 0.0023169613f},
-std::array<float,2>{0.948727071f, 0.860668778f},
-std::array<float,2>{0.225893423f, 0.50124985f},
-std::array<float,2>{0.605319917f, 0.316855729f},
-std::array<float,2>{0.0688752905f, 0.395544291f},
-std::array<float,2>{0.70814991f, 0.654053509f},
-std::array<float,2>{0.267434597f, 0.957950354f},
-std::array<float,2>{0.8586694f, 0.154556766f},
-std::array<float,2>{0.409796268f, 0.331441879f},
-std::array<float,2>{0.969373763f, 0.520515144f},
-std::array<float,2>{0.192977935f, 0.84955734f},
-std::array<float,2>{0.573100746f, 0.0252297428f},
-std::array<float,2>{0.119145647f, 0.131699041f},
-std::array<float,2>{0.724018514f, 0.947529316f},
-std::array<float,2>{0.298531413f, 0.628011584f},
-std::array<float,2>{0.839209676f, 0.37749216f},
-std::array<float,2>{0.354945004f, 0.109767303f},
-std::array<float,2>{0.762299836f, 0.771410942f},
-std::array<float,2>{0.0362153724f, 0.573178351f},
-std::array<float,2>{0.636745095f, 0.302853107f},
-std::array<float,2>{0.184527054f, 0.471804202f},
-std::array<float,2>{0.543698967f, 0.737197697f},
-std::array<float,2>{0.499126405f, 0.893673718f},
-std::array<float,2>{0.935290277f, 0.204837948f},
-std::array<float,2>{0.263497591f, 0.428159684f},
-std::array<float,2>{0.86824882f, 0.682062984f},
-std::array<float,2>{0.0917344168f, 0.988002956f},
-std::array<float,2>{0.700851381f, 0.156573787f},
-std::array<float,2>{0.239464253f, 0.0475818776f},
-std::array<float,2>{0.614728749f, 0.818241954f},
-std::array<float,2>{0.401799619f, 0.5543468f},
-std::array<float,2>{0.962681413f, 0.347885042f},
-std::array<float,2>{0.443006992f, 0.23690854f},
-std::array<float,2>{0.883293808f, 0.919984519f},
-std::array<float,2>{0.151645526f, 0.689056337f},
-std::array<float,2>{0.518443763f, 0.460779786f},
-std::array<float,2>{0.021351818f, 0.278721869f},
-std::array<float,2>{0.681783199f, 0.615239203f},
-std::array<float,2>{0.330128014f, 0.811019897f},
-std::array<float,2>{0.804122448f, 0.0897276327f},
-std::array<float,2>{0.429584056f, 0.476803303f},
-std::array<float,2>{0.992705524f, 0.747464538f},
-std::array<float,2>{0.212447092f, 0.901855171f},
-std::array<float,2>{0.58946228f, 0.217772022f},
-std::array<float,2>{0.0959683508f, 0.121562444f},
-std::array<float,2>{0.746095538f, 0.780379534f},
-std::array<float,2>{0.284789145f, 0.564472795f},
-std::array<float,2>{0.817934334f, 0.311732173f},
-std::array<float,2>{0.362731338f, 0.135263517f},
-std::array<float,2>{0.781196654f, 0.940140963f},
-std::array<float,2>{0.0600168481f, 0.63960737f},
-std::array<float,2>{0.648798227f, 0.390213162f},
-std::array<float,2>{0.162868679f, 0.341762275f},
-std::array<float,2>{0.548555374f, 0.527287483f},
-std::array<float,2>{0.482982576f, 0.852848411f},
-std::array<float,2>{0.914030373f, 0.016969718f},
-std::array<float,2>{0.272991568f, 0.271420866f},
-std::array<float,2>{0.85369879f, 0.618802845f},
-std::array<float,2>{0.0649037808f, 0.801248312f},
-std::array<float,2>{0.703232527f, 0.0858094618f},
-std::array<float,2>{0.22219874f, 0.247081071f},
-std::array<float,2>{0.606446028f, 0.907702267f},
-std::array<float,2>{0.381703824f, 0.696668983f},
-std::array<float,2>{0.949368119f, 0.46442607f},
-std::array<float,2>{0.458211035f, 0.0577632599f},
-std::array<float,2>{0.905189216f, 0.827376962f},
-std::array<float,2>{0.134405509f, 0.561764419f},
-std::array<float,2>{0.502723098f, 0.358014494f},
-std::array<float,2>{0.00776957907f, 0.431363255f},
-std::array<float,2>{0.660064936f, 0.673109055f},
-std::array<float,2>{0.327082694f, 0.999497712f},
-std::array<float,2>{0.795533121f, 0.167884529f},
-std::array<float,2>{0.492281675f, 0.362379044f},
-std::array<float,2>{0.931162775f, 0.532273293f},
-std::array<float,2>{0.18088007f, 0.83359158f},
-std::array<float,2>{0.541299462f, 0.0326911248f},
-std::array<float,2>{0.0345080607f, 0.183820903f},
-std::array<float,2>{0.635198891f, 0.972102106f},
-std::array<float,2>{0.357284397f, 0.657777786f},
-std::array<float,2>{0.761666894f, 0.414674252f},
-std::array<float,2>{0.301113755f, 0.0669773966f},
-std::array<float,2>{0.840612292f, 0.784958184f},
-std::array<float,2>{0.121193178f, 0.60309124f},
-std::array<float,2>{0.720467925f, 0.255120009f},
-std::array<float,2>{0.189724416f, 0.450370371f},
-std::array<float,2>{0.577592313f, 0.709292889f},
-std::array<float,2>{0.413194239f, 0.922649443f},
-std::array<float,2>{0.975229144f, 0.218959361f},
-std::array<float,2>{0.334113389f, 0.400139391f},
-std::array<float,2>{0.799212217f, 0.643840134f},
-std::array<float,2>{0.0186388213f, 0.968595028f},
-std::array<float,2>{0.683991015f, 0.144187048f},
-std::array<float,2>{0.153034195f, 0.0139910663f},
-std::array<float,2>{0.521398723f, 0.871252835f},
-std::array<float,2>{0.439718753f, 0.510884702f},
-std::array<float,2>{0.890486419f, 0.326185942f},
-std::array<float,2>{0.405332923f, 0.19730036f},
-std::array<float,2>{0.966203988f, 0.882576764f},
-std::array<float,2>{0.237112239f, 0.723166585f},
-std::array<float,2>{0.611436665f, 0.498714715f},
-std::array<float,2>{0.085998483f, 0.296499193f},
-std::array<float,2>{0.697342694f, 0.586006641f},
-std::array<float,2>{0.258091211f, 0.752282441f},
-std::array<float,2>{0.872192323f, 0.104989544f},
-std::array<float,2>{0.447886735f, 0.409079581f},
-std::array<float,2>{0.882561624f, 0.667026818f},
-std::array<float,2>{0.144635007f, 0.984164119f},
-std::array<float,2>{0.529563844f, 0.175803021f},
-std::array<float,2>{0.0277228635f, 0.0432871208f},
-std::array<float,2>{0.674007058f, 0.83842504f},
-std::array<float,2>{0.343523234f, 0.546266377f},
-std::array<float,2>{0.810089052f, 0.369972676f},
-std::array<float,2>{0.251655281f, 0.228582844f},
-std::array<float,2>{0.860622585f, 0.936695278f},
-std::array<float,2>{0.0807007551f, 0.713449538f},
-std::array<float,2>{0.690334558f, 0.44219172f},
-std::array<float,2>{0.244892687f, 0.264109313f},
-std::array<float,2>{0.622377157f, 0.597555578f},
-std::array<float,2>{0.393158376f, 0.795667231f},
-std::array<float,2>{0.960645258f, 0.0704442412f},
-std::array<float,2>{0.350495607f, 0.31417042f},
-std::array<float,2>{0.75675422f, 0.504908204f},
-std::array<float,2>{0.0399148129f, 0.864969909f},
-std::array<float,2>{0.629009426f, 0.00485024741f},
-std::array<float,2>{0.178950146f, 0.151011512f},
-std::array<float,2>{0.53366524f, 0.955556512f},
-std::array<float,2>{0.487111181f, 0.652194917f},
-std::array<float,2>{0.924508929f, 0.391241848f},
-std::array<float,2>{0.419478863f, 0.0989587158f},
-std::array<float,2>{0.981682956f, 0.759968936f},
-std::array<float,2>{0.200551271f, 0.581761777f},
-std::array<float,2>{0.565304458f, 0.282045811f},
-std::array<float,2>{0.116973877f, 0.486537874f},
-std::array<float,2>{0.727327883f, 0.727065623f},
-std::array<float,2>{0.309388846f, 0.884947836f},
-std::array<float,2>{0.835249782f, 0.193908691f},
-std::array<float,2>{0.38529548f, 0.300522685f},
-std::array<float,2>{0.937732041f, 0.575375438f},
-std::array<float,2>{0.233646646f, 0.767484426f},
-std::array<float,2>{0.59910363f, 0.113594972f},
-std::array<float,2>{0.0752008185f, 0.210442662f},
-std::array<float,2>{0.713769138f, 0.895298243f},
-std::array<float,2>{0.276069522f, 0.741472363f},
-std::array<float,2>{0.844967127f, 0.476377308f},
-std::array<float,2>{0.313260257f, 0.0281187613f},
-std::array<float,2>{0.788384557f, 0.844758749f},
-std::array<float,2>{0.00796305947f, 0.517063558f},
-std::array<float,2>{0.66549629f, 0.33449921f},
-std::array<float,2>{0.131566867f, 0.3789891f},
-std::array<float,2>{0.511060059f, 0.63026315f},
-std::array<float,2>{0.466122568f, 0.949996173f},
-std::array<float,2>{0.89287132f, 0.125898868f},
-std::array<float,2>{0.292230576f, 0.454174131f},
-std::array<float,2>{0.824462056f, 0.692573369f},
-std::array<float,2>{0.104557797f, 0.915636837f},
-std::array<float,2>{0.735798895f, 0.239780456f},
-std::array<float,2>{0.203826353f, 0.0935686827f},
-std::array<float,2>{0.579716086f, 0.805536985f},
-std::array<float,2>{0.430008948f, 0.610194385f},
-std::array<float,2>{0.991146088f, 0.276934028f},
-std::array<float,2>{0.470192105f, 0.163585544f},
-std::array<float,2>{0.914956331f, 0.990137458f},
-std::array<float,2>{0.164806247f, 0.687482893f},
-std::array<float,2>{0.558536351f, 0.422771454f},
-std::array<float,2>{0.0483378768f, 0.346019298f},
-std::array<float,2>{0.644073427f, 0.550506055f},
-std::array<float,2>{0.370420188f, 0.816141486f},
-std::array<float,2>{0.769629121f, 0.0535786375f},
-std::array<float,2>{0.402282655f, 0.425827324f},
-std::array<float,2>{0.962001503f, 0.680006027f},
-std::array<float,2>{0.240223318f, 0.985274255f},
-std::array<float,2>{0.614973187f, 0.159813732f},
-std::array<float,2>{0.0912565812f, 0.0498180725f},
-std::array<float,2>{0.700429082f, 0.818816423f},
-std::array<float,2>{0.263131797f, 0.552391827f},
-std::array<float,2>{0.868888199f, 0.351103395f},
-std::array<float,2>{0.330823839f, 0.235668123f},
-std::array<float,2>{0.80464828f, 0.919071436f},
-std::array<float,2>{0.0206207111f, 0.690300822f},
-std::array<float,2>{0.682218194f, 0.457578927f},
-std::array<float,2>{0.152204722f, 0.279860914f},
-std::array<float,2>{0.517760932f, 0.613371491f},
-std::array<float,2>{0.442803979f, 0.810469925f},
-std::array<float,2>{0.883443534f, 0.0874959454f},
-std::array<float,2>{0.298255682f, 0.32899192f},
-std::array<float,2>{0.839357316f, 0.523168206f},
-std::array<float,2>{0.119865663f, 0.84987998f},
-std::array<float,2>{0.724510908f, 0.0260031074f},
-std::array<float,2>{0.19264093f, 0.129702821f},
-std::array<float,2>{0.572611332f, 0.945539773f},
-std::array<float,2>{0.409306109f, 0.626103342f},
-std::array<float,2>{0.969011188f, 0.375596046f},
-std::array<float,2>{0.499774992f, 0.111662216f},
-std::array<float,2>{0.935020268f, 0.771863818f},
-std::array<float,2>{0.183849871f, 0.571217239f},
-std::array<float,2>{0.543416262f, 0.302082747f},
-std::array<float,2>{0.0367619097f, 0.47034663f},
-std::array<float,2>{0.637448251f, 0.735604167f},
-std::array<float,2>{0.35511291f, 0.891256452f},
-std::array<float,2>{0.762037456f, 0.205824167f},
-std::array<float,2>{0.455312699f, 0.288121194f},
-std::array<float,2>{0.901643157f, 0.584495187f},
-std::array<float,2>{0.139299959f, 0.762111604f},
-std::array<float,2>{0.505729735f, 0.0960621163f},
-std::array<float,2>{0.00100263604f, 0.187824145f},
-std::array<float,2>{0.662768722f, 0.886733413f},
-std::array<float,2>{0.323113531f, 0.731180906f},
-std::array<float,2>{0.789147675f, 0.490203172f},
-std::array<float,2>{0.266681463f, 0.00168568094f},
-std::array<float,2>{0.859317958f, 0.862747729f},
-std::array<float,2>{0.0687772334f, 0.502179265f},
-std::array<float,2>{0.708554387f, 0.318670183f},
-std::array<float,2>{0.226553574f, 0.398363024f},
-std::array<float,2>{0.604911447f, 0.654909194f},
-std::array<float,2>{0.37795794f, 0.960295796f},
-std::array<float,2>{0.948824167f, 0.152922541f},
-std::array<float,2>{0.365079075f, 0.441093743f},
-std::array<float,2>{0.776407361f, 0.715596676f},
-std::array<float,2>{0.0573496595f, 0.931886673f},
-std::array<float,2>{0.653032362f, 0.23321718f},
-std::array<float,2>{0.159484148f, 0.0778527036f},
-std::array<float,2>{0.5523054f, 0.790454149f},
-std::array<float,2>{0.479044139f, 0.598520577f},
-std::array<float,2>{0.907631576f, 0.261068702f},
-std::array<float,2>{0.424418092f, 0.171900079f},
-std::array<float,2>{0.997915745f, 0.977934718f},
-std::array<float,2>{0.214971498f, 0.670545816f},
-std::array<float,2>{0.590516806f, 0.410611987f},
-std::array<float,2>{0.0982133672f, 0.371493191f},
-std::array<float,2>{0.742329538f, 0.540478289f},
-std::array<float,2>{0.288683593f, 0.842859209f},
-std::array<float,2>{0.815982759f, 0.0401327386f},
-std::array<float,2>{0.474465758f, 0.495066732f},
-std::array<float,2>{0.921756148f, 0.722049594f},
-std::array<float,2>{0.171005577f, 0.876944363f},
-std::array<float,2>{0.560520351f, 0.199487001f},
-std::array<float,2>{0.0533703715f, 0.109101862f},
-std::array<float,2>{0.64495492f, 0.75646162f},
-std::array<float,2>{0.372805268f, 0.592641711f},
-std::array<float,2>{0.767825067f, 0.292099327f},
-std::array<float,2>{0.294577301f, 0.147094667f},
-std::array<float,2>{0.823349833f, 0.964673579f},
-std::array<float,2>{0.108321436f, 0.648421884f},
-std::array<float,2>{0.741495073f, 0.402821153f},
-std::array<float,2>{0.209910989f, 0.324176043f},
-std::array<float,2>{0.583647788f, 0.511945009f},
-std::array<float,2>{0.437121779f, 0.867528379f},
-std::array<float,2>{0.98563242f, 0.00937786791f},
-std::array<float,2>{0.318244994f, 0.25259456f},
-std::array<float,2>{0.7832129f, 0.606131136f},
-std::array<float,2>{0.0144401733f, 0.785997629f},
-std::array<float,2>{0.669367373f, 0.0625158846f},
-std::array<float,2>{0.126100779f, 0.224177107f},
-std::array<float,2>{0.515279889f, 0.929352522f},
-std::array<float,2>{0.463832825f, 0.704885364f},
-std::array<float,2>{0.898156047f, 0.447224081f},
-std::array<float,2>{0.388210446f, 0.0386400707f},
-std::array<float,2>{0.944849253f, 0.829806626f},
-std::array<float,2>{0.227826357f, 0.536938429f},
-std::array<float,2>{0.595564842f, 0.366782308f},
-std::array<float,2>{0.0730374679f, 0.419222593f},
-std::array<float,2>{0.717690706f, 0.663713276f},
-std::array<float,2>{0.280162573f, 0.973385274f},
-std::array<float,2>{0.850835621f, 0.183190435f},
-std::array<float,2>{0.416858494f, 0.353700787f},
-std::array<float,2>{0.978164792f, 0.555218041f},
-std::array<float,2>{0.195709676f, 0.824090183f},
-std::array<float,2>{0.568878293f, 0.0601039641f},
-std::array<float,2>{0.11303588f, 0.16847688f},
-std::array<float,2>{0.73167187f, 0.994313061f},
-std::array<float,2>{0.30694446f, 0.676637888f},
-std::array<float,2>{0.828174114f, 0.435554087f},
-std::array<float,2>{0.344134152f, 0.078856267f},
-std::array<float,2>{0.751136363f, 0.79843837f},
-std::array<float,2>{0.0465104543f, 0.622041702f},
-std::array<float,2>{0.626320541f, 0.26918757f},
-std::array<float,2>{0.17259863f, 0.46824947f},
-std::array<float,2>{0.537968874f, 0.699797451f},
-std::array<float,2>{0.489204854f, 0.912255824f},
-std::array<float,2>{0.928833723f, 0.242915034f},
-std::array<float,2>{0.257310033f, 0.38441059f},
-std::array<float,2>{0.864369154f, 0.633610129f},
-std::array<float,2>{0.0843056217f, 0.944806635f},
-std::array<float,2>{0.69412905f, 0.138642356f},
-std::array<float,2>{0.249827772f, 0.0221199971f},
-std::array<float,2>{0.617635489f, 0.855813444f},
-std::array<float,2>{0.397730172f, 0.530915201f},
-std::array<float,2>{0.955724001f, 0.338520497f},
-std::array<float,2>{0.451731354f, 0.211505309f},
-std::array<float,2>{0.876076758f, 0.903546393f},
-std::array<float,2>{0.141890422f, 0.744166493f},
-std::array<float,2>{0.524124682f, 0.483339399f},
-std::array<float,2>{0.0254760608f, 0.305866867f},
-std::array<float,2>{0.676573992f, 0.567750335f},
-std::array<float,2>{0.337875038f, 0.776307762f},
-std::array<float,2>{0.805880487f, 0.119618028f},
-std::array<float,2>{0.430410177f, 0.455753744f},
-std::array<float,2>{0.990490258f, 0.694889963f},
-std::array<float,2>{0.203312784f, 0.91748333f},
-std::array<float,2>{0.57952702f, 0.240839735f},
-std::array<float,2>{0.105174422f, 0.0900879577f},
-std::array<float,2>{0.735902667f, 0.808208048f},
-std::array<float,2>{0.292720407f, 0.611756921f},
-std::array<float,2>{0.824848413f, 0.274644285f},
-std::array<float,2>{0.370937854f, 0.160741538f},
-std::array<float,2>{0.770177484f, 0.990819275f},
-std::array<float,2>{0.0485856645f, 0.685492337f},
-std::array<float,2>{0.643947124f, 0.42403087f},
-std::array<float,2>{0.164253771f, 0.34429571f},
-std::array<float,2>{0.557987392f, 0.547989666f},
-std::array<float,2>{0.470310301f, 0.814392209f},
-std::array<float,2>{0.914076626f, 0.051820837f},
-std::array<float,2>{0.275421828f, 0.29828316f},
-std::array<float,2>{0.845366597f, 0.57774806f},
-std::array<float,2>{0.0757133961f, 0.767640233f},
-std::array<float,2>{0.712955415f, 0.116437674f},
-std::array<float,2>{0.233997867f, 0.208710417f},
-std::array<float,2>{0.599369586f, 0.897966325f},
-std::array<float,2>{0.385245562f, 0.73835516f},
-std::array<float,2>{0.938001633f, 0.4741835f},
-std::array<float,2>{0.466455787f, 0.0298790187f},
-std::array<float,2>{0.893182337f, 0.847218156f},
-std::array<float,2>{0.131146327f, 0.51848948f},
-std::array<float,2>{0.511496305f, 0.332871974f},
-std::array<float,2>{0.00873463042f, 0.381709695f},
-std::array<float,2>{0.66570437f, 0.632244349f},
-std::array<float,2>{0.312742859f, 0.952231407f},
-std::array<float,2>{0.788711011f, 0.127498329f},
-std::array<float,2>{0.486710668f, 0.316055179f},
-std::array<float,2>{0.923936248f, 0.505869448f},
-std::array<float,2>{0.179386735f, 0.8654899f},
-std::array<float,2>{0.53392452f, 0.00720695267f},
-std::array<float,2>{0.0395015441f, 0.148618966f},
-std::array<float,2>{0.629801214f, 0.954729617f},
-std::array<float,2>{0.34962979f, 0.649058342f},
-std::array<float,2>{0.756161571f, 0.394166917f},
-std::array<float,2>{0.308605433f, 0.1013216f},
-std::array<float,2>{0.835646212f, 0.759165883f},
-std::array<float,2>{0.116268791f, 0.578554034f},
-std::array<float,2>{0.726629853f, 0.284799159f},
-std::array<float,2>{0.200959414f, 0.485325873f},
-std::array<float,2>{0.56447041f, 0.729076326f},
-std::array<float,2>{0.419346929f, 0.883390784f},
-std::array<float,2>{0.982163846f, 0.193282634f},
-std::array<float,2>{0.342960894f, 0.40688026f},
-std::array<float,2>{0.809833705f, 0.665901721f},
-std::array<float,2>{0.028120039f, 0.98067677f},
-std::array<float,2>{0.674429476f, 0.177844509f},
-std::array<float,2>{0.145128086f, 0.0453363322f},
-std::array<float,2>{0.529834151f, 0.836676419f},
-std::array<float,2>{0.44763273f, 0.543169618f},
-std::array<float,2>{0.88202548f, 0.368321121f},
-std::array<float,2>{0.39287138f, 0.227312341f},
-std::array<float,2>{0.960436344f, 0.934200585f},
-std::array<float,2>{0.244156152f, 0.712575436f},
-std::array<float,2>{0.622578502f, 0.443710119f},
-std::array<float,2>{0.0804000795f, 0.262318641f},
-std::array<float,2>{0.689566553f, 0.59432596f},
-std::array<float,2>{0.251390189f, 0.793331385f},
-std::array<float,2>{0.861212015f, 0.0738119856f},
-std::array<float,2>{0.440263897f, 0.401720613f},
-std::array<float,2>{0.889860392f, 0.641437531f},
-std::array<float,2>{0.152406737f, 0.965858698f},
-std::array<float,2>{0.520915508f, 0.14153792f},
-std::array<float,2>{0.019246988f, 0.0134940678f},
-std::array<float,2>{0.684499979f, 0.874531746f},
-std::array<float,2>{0.334787846f, 0.509167612f},
-std::array<float,2>{0.79970777f, 0.325580865f},
-std::array<float,2>{0.258419067f, 0.195876926f},
-std::array<float,2>{0.872870028f, 0.879974723f},
-std::array<float,2>{0.0864265859f, 0.725355804f},
-std::array<float,2>{0.698134899f, 0.497458458f},
-std::array<float,2>{0.236378342f, 0.293830156f},
-std::array<float,2>{0.612204492f, 0.588383317f},
-std::array<float,2>{0.405932933f, 0.750142694f},
-std::array<float,2>{0.966584146f, 0.10158667f},
-std::array<float,2>{0.356844544f, 0.360462248f},
-std::array<float,2>{0.760903239f, 0.534474254f},
-std::array<float,2>{0.034915641f, 0.834029436f},
-std::array<float,2>{0.635575831f, 0.0338571556f},
-std::array<float,2>{0.181278139f, 0.186128169f},
-std::array<float,2>{0.541964889f, 0.968878686f},
-std::array<float,2>{0.49315685f, 0.658700228f},
-std::array<float,2>{0.931126416f, 0.417424053f},
-std::array<float,2>{0.413678795f, 0.0694836825f},
-std::array<float,2>{0.974652886f, 0.782077968f},
-std::array<float,2>{0.189949259f, 0.604486346f},
-std::array<float,2>{0.577959895f, 0.257552952f},
-std::array<float,2>{0.121633045f, 0.452983111f},
-std::array<float,2>{0.720043361f, 0.708834231f},
-std::array<float,2>{0.30154717f, 0.925301909f},
-std::array<float,2>{0.840147674f, 0.221141145f},
-std::array<float,2>{0.381306738f, 0.271876305f},
-std::array<float,2>{0.950140297f, 0.620422125f},
-std::array<float,2>{0.221793428f, 0.803258598f},
-std::array<float,2>{0.607175887f, 0.0836454034f},
-std::array<float,2>{0.0654079169f, 0.248940662f},
-std::array<float,2>{0.704068899f, 0.909656227f},
-std::array<float,2>{0.27274105f, 0.69799459f},
-std::array<float,2>{0.854227245f, 0.46154961f},
-std::array<float,2>{0.326496094f, 0.0555623621f},
-std::array<float,2>{0.794995427f, 0.824942708f},
-std::array<float,2>{0.00686810911f, 0.560202479f},
-std::array<float,2>{0.659522533f, 0.356611073f},
-std::array<float,2>{0.133920923f, 0.432455808f},
-std::array<float,2>{0.502205014f, 0.674859285f},
-std::array<float,2>{0.4585554f, 0.996692181f},
-std::array<float,2>{0.904463947f, 0.165800706f},
-std::array<float,2>{0.284571558f, 0.479278147f},
-std::array<float,2>{0.817492425f, 0.748582244f},
-std::array<float,2>{0.0963501707f, 0.898921967f},
-std::array<float,2>{0.746970892f, 0.216382071f},
-std::array<float,2>{0.212364152f, 0.123820335f},
-std::array<float,2>{0.589266002f, 0.778367698f},
-std::array<float,2>{0.428763628f, 0.563764036f},
-std::array<float,2>{0.992521465f, 0.310127348f},
-std::array<float,2>{0.482592106f, 0.134407476f},
-std::array<float,2>{0.913123071f, 0.938694596f},
-std::array<float,2>{0.162514806f, 0.636931479f},
-std::array<float,2>{0.548339248f, 0.38785553f},
-std::array<float,2>{0.060195189f, 0.342339605f},
-std::array<float,2>{0.6489501f, 0.524226367f},
-std::array<float,2>{0.362911493f, 0.854598641f},
-std::array<float,2>{0.780631125f, 0.0190195348f},
-std::array<float,2>{0.408002794f, 0.377122283f},
-std::array<float,2>{0.971453607f, 0.628888965f},
-std::array<float,2>{0.195276424f, 0.947860599f},
-std::array<float,2>{0.57202673f, 0.131210715f},
-std::array<float,2>{0.119066477f, 0.0246837754f},
-std::array<float,2>{0.72654891f, 0.848744929f},
-std::array<float,2>{0.299990296f, 0.521183431f},
-std::array<float,2>{0.837426424f, 0.331651092f},
-std::array<float,2>{0.353081793f, 0.204416186f},
-std::array<float,2>{0.765533328f, 0.894242644f},
-std::array<float,2>{0.0373309851f, 0.736455977f},
-std::array<float,2>{0.639876783f, 0.472214788f},
-std::array<float,2>{0.185865745f, 0.303440988f},
-std::array<float,2>{0.545443237f, 0.572537541f},
-std::array<float,2>{0.496869564f, 0.770915687f},
-std::array<float,2>{0.93592459f, 0.110113725f},
-std::array<float,2>{0.265239209f, 0.348353684f},
-std::array<float,2>{0.869190454f, 0.554106057f},
-std::array<float,2>{0.0924904048f, 0.817430317f},
-std::array<float,2>{0.702238321f, 0.0473253727f},
-std::array<float,2>{0.240640178f, 0.157084793f},
-std::array<float,2>{0.616821587f, 0.987317801f},
-std::array<float,2>{0.399118274f, 0.682495832f},
-std::array<float,2>{0.963553309f, 0.42833069f},
-std::array<float,2>{0.443823874f, 0.0893198103f},
-std::array<float,2>{0.886154115f, 0.811242521f},
-std::array<float,2>{0.148586214f, 0.616134286f},
-std::array<float,2>{0.516655266f, 0.278963864f},
-std::array<float,2>{0.0222828221f, 0.460218787f},
-std::array<float,2>{0.67971772f, 0.688488781f},
-std::array<float,2>{0.328346014f, 0.920776665f},
-std::array<float,2>{0.801823735f, 0.236359969f},
-std::array<float,2>{0.476709962f, 0.258464664f},
-std::array<float,2>{0.908369541f, 0.601141632f},
-std::array<float,2>{0.156327143f, 0.791716754f},
-std::array<float,2>{0.553554356f, 0.0758917108f},
-std::array<float,2>{0.0558656752f, 0.230975136f},
-std::array<float,2>{0.655937731f, 0.929801822f},
-std::array<float,2>{0.366634399f, 0.718357682f},
-std::array<float,2>{0.774535239f, 0.439241409f},
-std::array<float,2>{0.286429018f, 0.0423516184f},
-std::array<float,2>{0.812734127f, 0.840125084f},
-std::array<float,2>{0.100450285f, 0.541226149f},
-std::array<float,2>{0.745218873f, 0.374929935f},
-std::array<float,2>{0.218279853f, 0.413333505f},
-std::array<float,2>{0.592958093f, 0.669149637f},
-std::array<float,2>{0.423827827f, 0.979480982f},
-std::array<float,2>{0.999161959f, 0.174074918f},
-std::array<float,2>{0.321229726f, 0.491623253f},
-std::array<float,2>{0.792478025f, 0.732826889f},
-std::array<float,2>{0.00254381122f, 0.888824522f},
-std::array<float,2>{0.662091017f, 0.189767629f},
-std::array<float,2>{0.137822986f, 0.0955105126f},
-std::array<float,2>{0.50611192f, 0.764114738f},
-std::array<float,2>{0.453979969f, 0.583012819f},
-std::array<float,2>{0.899966896f, 0.286128491f},
-std::array<float,2>{0.375758857f, 0.155190393f},
-std::array<float,2>{0.946828604f, 0.957378089f},
-std::array<float,2>{0.222776115f, 0.653420925f},
-std::array<float,2>{0.603383958f, 0.396214634f},
-std::array<float,2>{0.0667255819f, 0.316941261f},
-std::array<float,2>{0.709821999f, 0.501926601f},
-std::array<float,2>{0.26890105f, 0.860881031f},
-std::array<float,2>{0.855516255f, 0.00251632254f},
-std::array<float,2>{0.462201506f, 0.447986275f},
-std::array<float,2>{0.894653201f, 0.706608832f},
-std::array<float,2>{0.128031582f, 0.926173151f},
-std::array<float,2>{0.513320684f, 0.224959686f},
-std::array<float,2>{0.0131455846f, 0.065464206f},
-std::array<float,2>{0.671491921f, 0.788190782f},
-std::array<float,2>{0.320234835f, 0.607847035f},
-std::array<float,2>{0.781325936f, 0.25047034f},
-std::array<float,2>{0.278576076f, 0.180674762f},
-std::array<float,2>{0.849268556f, 0.975043654f},
-std::array<float,2>{0.0720370188f, 0.661990404f},
-std::array<float,2>{0.715077281f, 0.421454191f},
-std::array<float,2>{0.229281425f, 0.363570452f},
-std::array<float,2>{0.596589029f, 0.53854239f},
-std::array<float,2>{0.38942349f, 0.830433846f},
-std::array<float,2>{0.942886233f, 0.0370904654f},
-std::array<float,2>{0.373315692f, 0.289468884f},
-std::array<float,2>{0.76571703f, 0.59046185f},
-std::array<float,2>{0.0520454422f, 0.755027652f},
-std::array<float,2>{0.647854149f, 0.106704928f},
-std::array<float,2>{0.168251663f, 0.203107461f},
-std::array<float,2>{0.561632454f, 0.87764436f},
-std::array<float,2>{0.476039469f, 0.718972981f},
-std::array<float,2>{0.918237031f, 0.493296087f},
-std::array<float,2>{0.434159309f, 0.0102060344f},
-std::array<float,2>{0.986694336f, 0.869871736f},
-std::array<float,2>{0.208210722f, 0.514484048f},
-std::array<float,2>{0.584343851f, 0.32179895f},
-std::array<float,2>{0.107273564f, 0.405108243f},
-std::array<float,2>{0.738533437f, 0.645571947f},
-std::array<float,2>{0.295139462f, 0.962206841f},
-std::array<float,2>{0.822042763f, 0.144690394f},
-std::array<float,2>{0.394585997f, 0.337053895f},
-std::array<float,2>{0.953196287f, 0.528885543f},
-std::array<float,2>{0.24762477f, 0.858407319f},
-std::array<float,2>{0.620540082f, 0.0198426321f},
-std::array<float,2>{0.0838541985f, 0.139226139f},
-std::array<float,2>{0.693086267f, 0.942972958f},
-std::array<float,2>{0.255350053f, 0.635362029f},
-std::array<float,2>{0.865512133f, 0.384782791f},
-std::array<float,2>{0.33792007f, 0.117530294f},
-std::array<float,2>{0.807950795f, 0.774281919f},
-std::array<float,2>{0.0251546651f, 0.569508255f},
-std::array<float,2>{0.678461075f, 0.307926685f},
-std::array<float,2>{0.142647386f, 0.480560988f},
-std::array<float,2>{0.526096582f, 0.743994594f},
-std::array<float,2>{0.450014025f, 0.904850125f},
-std::array<float,2>{0.877469063f, 0.214785397f},
-std::array<float,2>{0.305825442f, 0.434161544f},
-std::array<float,2>{0.830890834f, 0.677855134f},
-std::array<float,2>{0.109844089f, 0.992809534f},
-std::array<float,2>{0.733029246f, 0.170702264f},
-std::array<float,2>{0.199117929f, 0.0613245554f},
-std::array<float,2>{0.567020774f, 0.821020722f},
-std::array<float,2>{0.415533096f, 0.556772113f},
-std::array<float,2>{0.980145752f, 0.35293901f},
-std::array<float,2>{0.491566867f, 0.246074349f},
-std::array<float,2>{0.927041233f, 0.91120851f},
-std::array<float,2>{0.174997702f, 0.701952398f},
-std::array<float,2>{0.536568165f, 0.465073079f},
-std::array<float,2>{0.0440434255f, 0.266308069f},
-std::array<float,2>{0.627282083f, 0.623405874f},
-std::array<float,2>{0.346058339f, 0.799108684f},
-std::array<float,2>{0.75290668f, 0.0810959786f},
-std::array<float,2>{0.383163929f, 0.475715011f},
-std::array<float,2>{0.940584421f, 0.74191767f},
-std::array<float,2>{0.230850354f, 0.89493072f},
-std::array<float,2>{0.600926578f, 0.210688278f},
-std::array<float,2>{0.0771174505f, 0.113787219f},
-std::array<float,2>{0.711787224f, 0.766838253f},
-std::array<float,2>{0.274001926f, 0.576047003f},
-std::array<float,2>{0.846393526f, 0.299889445f},
-std::array<float,2>{0.31573391f, 0.125035703f},
-std::array<float,2>{0.786143303f, 0.949666858f},
-std::array<float,2>{0.0113435471f, 0.630385041f},
-std::array<float,2>{0.667642772f, 0.379814595f},
-std::array<float,2>{0.130457014f, 0.334073573f},
-std::array<float,2>{0.507986069f, 0.517422497f},
-std::array<float,2>{0.468141109f, 0.845562041f},
-std::array<float,2>{0.892275274f, 0.0278142765f},
-std::array<float,2>{0.289827615f, 0.276493669f},
-std::array<float,2>{0.827143312f, 0.609618723f},
-std::array<float,2>{0.103119023f, 0.805082202f},
-std::array<float,2>{0.737761438f, 0.0930992141f},
-std::array<float,2>{0.206409603f, 0.239306569f},
-std::array<float,2>{0.58197999f, 0.91517508f},
-std::array<float,2>{0.433068752f, 0.693341553f},
-std::array<float,2>{0.990122855f, 0.454778045f},
-std::array<float,2>{0.472640306f, 0.0527429506f},
-std::array<float,2>{0.916903317f, 0.81572926f},
-std::array<float,2>{0.167939454f, 0.550212383f},
-std::array<float,2>{0.55499655f, 0.346476078f},
-std::array<float,2>{0.0494258627f, 0.421980917f},
-std::array<float,2>{0.640796006f, 0.686857462f},
-std::array<float,2>{0.368861169f, 0.989394426f},
-std::array<float,2>{0.772022963f, 0.163523689f},
-std::array<float,2>{0.445851117f, 0.369611502f},
-std::array<float,2>{0.880617559f, 0.546405435f},
-std::array<float,2>{0.148228645f, 0.838009953f},
-std::array<float,2>{0.528625906f, 0.0437157564f},
-std::array<float,2>{0.0307762474f, 0.176458269f},
-std::array<float,2>{0.672815919f, 0.98364377f},
-std::array<float,2>{0.341696382f, 0.667588055f},
-std::array<float,2>{0.811305285f, 0.408214301f},
-std::array<float,2>{0.253261387f, 0.0709447563f},
-std::array<float,2>{0.862252057f, 0.79534775f},
-std::array<float,2>{0.0784172937f, 0.596757948f},
-std::array<float,2>{0.688766956f, 0.264243722f},
-std::array<float,2>{0.243111685f, 0.441857874f},
-std::array<float,2>{0.623755336f, 0.713088632f},
-std::array<float,2>{0.390746027f, 0.937464654f},
-std::array<float,2>{0.957739294f, 0.229403794f},
-std::array<float,2>{0.349326521f, 0.390765071f},
-std::array<float,2>{0.755277038f, 0.651486695f},
-std::array<float,2>{0.0423842743f, 0.955726206f},
-std::array<float,2>{0.631096005f, 0.150824159f},
-std::array<float,2>{0.17766054f, 0.00394628802f},
-std::array<float,2>{0.532259703f, 0.864275217f},
-std::array<float,2>{0.485388696f, 0.505457699f},
-std::array<float,2>{0.92352283f, 0.313763112f},
-std::array<float,2>{0.421748787f, 0.193812653f},
-std::array<float,2>{0.983969092f, 0.885657012f},
-std::array<float,2>{0.201376945f, 0.726815581f},
-std::array<float,2>{0.563162684f, 0.487118632f},
-std::array<float,2>{0.11498604f, 0.281436592f},
-std::array<float,2>{0.729977012f, 0.581093907f},
-std::array<float,2>{0.312378258f, 0.760538638f},
-std::array<float,2>{0.833607614f, 0.0992680639f},
-std::array<float,2>{0.495670348f, 0.414400429f},
-std::array<float,2>{0.932181239f, 0.657462239f},
-std::array<float,2>{0.182257622f, 0.972225606f},
-std::array<float,2>{0.539462864f, 0.184414685f},
-std::array<float,2>{0.0326882079f, 0.0331795886f},
-std::array<float,2>{0.634039521f, 0.833345056f},
-std::array<float,2>{0.358567208f, 0.532750249f},
-std::array<float,2>{0.758360207f, 0.362965465f},
-std::array<float,2>{0.302854598f, 0.21934928f},
-std::array<float,2>{0.842199564f, 0.922081411f},
-std::array<float,2>{0.123072855f, 0.709488094f},
-std::array<float,2>{0.722312331f, 0.450910538f},
-std::array<float,2>{0.189358994f, 0.255706102f},
-std::array<float,2>{0.575529873f, 0.603000462f},
-std::array<float,2>{0.410474479f, 0.784642458f},
-std::array<float,2>{0.972775161f, 0.0665957481f},
-std::array<float,2>{0.333231002f, 0.326969713f},
-std::array<float,2>{0.797391891f, 0.511640728f},
-std::array<float,2>{0.0164810196f, 0.871752918f},
-std::array<float,2>{0.686333477f, 0.0142632537f},
-std::array<float,2>{0.156087831f, 0.143701941f},
-std::array<float,2>{0.521760583f, 0.968189061f},
-std::array<float,2>{0.438478947f, 0.644076228f},
-std::array<float,2>{0.888460875f, 0.399675936f},
-std::array<float,2>{0.402784348f, 0.104961783f},
-std::array<float,2>{0.968277097f, 0.752775967f},
-std::array<float,2>{0.236242473f, 0.586894274f},
-std::array<float,2>{0.611078739f, 0.295963913f},
-std::array<float,2>{0.0886150822f, 0.498439759f},
-std::array<float,2>{0.696854591f, 0.723050296f},
-std::array<float,2>{0.26117897f, 0.882302344f},
-std::array<float,2>{0.873177767f, 0.198065057f},
-std::array<float,2>{0.4273853f, 0.312136382f},
-std::array<float,2>{0.995069742f, 0.565291464f},
-std::array<float,2>{0.213819891f, 0.780928135f},
-std::array<float,2>{0.587406933f, 0.121652141f},
-std::array<float,2>{0.094744429f, 0.216854319f},
-std::array<float,2>{0.748322785f, 0.902235568f},
-std::array<float,2>{0.282000244f, 0.747820318f},
-std::array<float,2>{0.818619132f, 0.477354974f},
-std::array<float,2>{0.35963136f, 0.01747071f},
-std::array<float,2>{0.777950943f, 0.853349864f},
-std::array<float,2>{0.0617390685f, 0.526724875f},
-std::array<float,2>{0.651593387f, 0.341189861f},
-std::array<float,2>{0.160889611f, 0.39006269f},
-std::array<float,2>{0.550747991f, 0.638677776f},
-std::array<float,2>{0.480979592f, 0.939810514f},
-std::array<float,2>{0.910316229f, 0.135209337f},
-std::array<float,2>{0.27088502f, 0.464137048f},
-std::array<float,2>{0.852477074f, 0.696924746f},
-std::array<float,2>{0.0631536245f, 0.908172727f},
-std::array<float,2>{0.705527902f, 0.247838408f},
-std::array<float,2>{0.220285237f, 0.0854424834f},
-std::array<float,2>{0.607995152f, 0.801422894f},
-std::array<float,2>{0.379868418f, 0.618597925f},
-std::array<float,2>{0.9513399f, 0.270532668f},
-std::array<float,2>{0.459985107f, 0.167224586f},
-std::array<float,2>{0.902430713f, 0.99994719f},
-std::array<float,2>{0.136618376f, 0.673645139f},
-std::array<float,2>{0.500991702f, 0.431013852f},
-std::array<float,2>{0.00530668162f, 0.357766181f},
-std::array<float,2>{0.658078849f, 0.562124968f},
-std::array<float,2>{0.325288981f, 0.827707827f},
-std::array<float,2>{0.794894338f, 0.0581992827f},
-std::array<float,2>{0.422675341f, 0.411358654f},
-std::array<float,2>{0.998393953f, 0.671611786f},
-std::array<float,2>{0.217409983f, 0.977507532f},
-std::array<float,2>{0.592442513f, 0.173352644f},
-std::array<float,2>{0.100969531f, 0.0396660678f},
-std::array<float,2>{0.744893551f, 0.842176557f},
-std::array<float,2>{0.285353333f, 0.53953433f},
-std::array<float,2>{0.813804805f, 0.37270239f},
-std::array<float,2>{0.365796089f, 0.233479425f},
-std::array<float,2>{0.773741901f, 0.933102727f},
-std::array<float,2>{0.0552534461f, 0.716133893f},
-std::array<float,2>{0.655240834f, 0.440374732f},
-std::array<float,2>{0.157659292f, 0.259920359f},
-std::array<float,2>{0.554123938f, 0.598986089f},
-std::array<float,2>{0.47841385f, 0.789357781f},
-std::array<float,2>{0.909863949f, 0.0768654421f},
-std::array<float,2>{0.267963767f, 0.319881141f},
-std::array<float,2>{0.856589615f, 0.503418624f},
-std::array<float,2>{0.0674714595f, 0.861553192f},
-std::array<float,2>{0.710691512f, 0.000693196023f},
-std::array<float,2>{0.224403247f, 0.154282257f},
-std::array<float,2>{0.601957917f, 0.959919333f},
-std::array<float,2>{0.376930952f, 0.656145394f},
-std::array<float,2>{0.946252465f, 0.397108406f},
-std::array<float,2>{0.454791367f, 0.0975616649f},
-std::array<float,2>{0.898450673f, 0.763504267f},
-std::array<float,2>{0.137304977f, 0.585162818f},
-std::array<float,2>{0.507665455f, 0.287420452f},
-std::array<float,2>{0.00326655339f, 0.489155352f},
-std::array<float,2>{0.660416484f, 0.731792688f},
-std::array<float,2>{0.322070539f, 0.888087392f},
-std::array<float,2>{0.791190982f, 0.188691586f},
-std::array<float,2>{0.497782707f, 0.301110297f},
-std::array<float,2>{0.937360048f, 0.572065175f},
-std::array<float,2>{0.187292665f, 0.772896171f},
-std::array<float,2>{0.54636842f, 0.113121197f},
-std::array<float,2>{0.0388465263f, 0.206227705f},
-std::array<float,2>{0.639532924f, 0.892015994f},
-std::array<float,2>{0.351759464f, 0.73496002f},
-std::array<float,2>{0.764362872f, 0.46914205f},
-std::array<float,2>{0.298902154f, 0.0264035594f},
-std::array<float,2>{0.836877763f, 0.851015329f},
-std::array<float,2>{0.117709622f, 0.522216797f},
-std::array<float,2>{0.725429177f, 0.329358339f},
-std::array<float,2>{0.194190636f, 0.376744866f},
-std::array<float,2>{0.570537388f, 0.625140846f},
-std::array<float,2>{0.406728953f, 0.947190166f},
-std::array<float,2>{0.97203058f, 0.130738482f},
-std::array<float,2>{0.329934716f, 0.458084434f},
-std::array<float,2>{0.800980031f, 0.691146076f},
-std::array<float,2>{0.0233905595f, 0.918837249f},
-std::array<float,2>{0.681037843f, 0.234485328f},
-std::array<float,2>{0.149878621f, 0.0867776424f},
-std::array<float,2>{0.515659451f, 0.80933398f},
-std::array<float,2>{0.445236087f, 0.614868283f},
-std::array<float,2>{0.88492763f, 0.281036943f},
-std::array<float,2>{0.400133938f, 0.158414051f},
-std::array<float,2>{0.964364767f, 0.985549152f},
-std::array<float,2>{0.241595179f, 0.681045413f},
-std::array<float,2>{0.615513265f, 0.427232832f},
-std::array<float,2>{0.0929749012f, 0.349925399f},
-std::array<float,2>{0.701922238f, 0.551261961f},
-std::array<float,2>{0.264368534f, 0.819465995f},
-std::array<float,2>{0.870288551f, 0.0491299592f},
-std::array<float,2>{0.450293362f, 0.483601034f},
-std::array<float,2>{0.878440559f, 0.74601233f},
-std::array<float,2>{0.14408195f, 0.903289735f},
-std::array<float,2>{0.526590884f, 0.212637082f},
-std::array<float,2>{0.0242906231f, 0.120274201f},
-std::array<float,2>{0.679350376f, 0.776858509f},
-std::array<float,2>{0.339480579f, 0.566556871f},
-std::array<float,2>{0.807471991f, 0.305527091f},
-std::array<float,2>{0.254419833f, 0.137113124f},
-std::array<float,2>{0.866927028f, 0.944258034f},
-std::array<float,2>{0.0823463649f, 0.634004414f},
-std::array<float,2>{0.691741168f, 0.382902205f},
-std::array<float,2>{0.246779412f, 0.33934617f},
-std::array<float,2>{0.61983186f, 0.52984792f},
-std::array<float,2>{0.395561397f, 0.856582105f},
-std::array<float,2>{0.954538882f, 0.0229822379f},
-std::array<float,2>{0.347210944f, 0.268448591f},
-std::array<float,2>{0.753156543f, 0.622456729f},
-std::array<float,2>{0.0436287299f, 0.797148347f},
-std::array<float,2>{0.628319681f, 0.0799386352f},
-std::array<float,2>{0.174458504f, 0.244046062f},
-std::array<float,2>{0.535173595f, 0.913925648f},
-std::array<float,2>{0.490857244f, 0.700208664f},
-std::array<float,2>{0.926508665f, 0.466869205f},
-std::array<float,2>{0.414608568f, 0.0595184863f},
-std::array<float,2>{0.979334593f, 0.823110759f},
-std::array<float,2>{0.19820638f, 0.556180537f},
-std::array<float,2>{0.567719877f, 0.355268657f},
-std::array<float,2>{0.110541284f, 0.437459707f},
-std::array<float,2>{0.733522892f, 0.677193284f},
-std::array<float,2>{0.305002809f, 0.995347142f},
-std::array<float,2>{0.831714749f, 0.169289529f},
-std::array<float,2>{0.39062354f, 0.366025686f},
-std::array<float,2>{0.942336082f, 0.536067903f},
-std::array<float,2>{0.229830146f, 0.828778625f},
-std::array<float,2>{0.597193122f, 0.0375756361f},
-std::array<float,2>{0.0712139159f, 0.182052404f},
-std::array<float,2>{0.716522813f, 0.974170446f},
-std::array<float,2>{0.278106004f, 0.662882209f},
-std::array<float,2>{0.848093569f, 0.418371171f},
-std::array<float,2>{0.318657994f, 0.0635637641f},
-std::array<float,2>{0.782433152f, 0.786658525f},
-std::array<float,2>{0.0122895995f, 0.607243419f},
-std::array<float,2>{0.670337081f, 0.253553838f},
-std::array<float,2>{0.127822414f, 0.445695996f},
-std::array<float,2>{0.512199044f, 0.703153193f},
-std::array<float,2>{0.460992634f, 0.927895606f},
-std::array<float,2>{0.895909607f, 0.223185748f},
-std::array<float,2>{0.296402305f, 0.403747171f},
-std::array<float,2>{0.820709527f, 0.647022843f},
-std::array<float,2>{0.105749413f, 0.963130713f},
-std::array<float,2>{0.740104735f, 0.147986576f},
-std::array<float,2>{0.207332343f, 0.00872780476f},
-std::array<float,2>{0.585586071f, 0.869042456f},
-std::array<float,2>{0.434671462f, 0.513470411f},
-std::array<float,2>{0.987992823f, 0.322963387f},
-std::array<float,2>{0.475319326f, 0.200823456f},
-std::array<float,2>{0.919116914f, 0.875487447f},
-std::array<float,2>{0.169686407f, 0.721011817f},
-std::array<float,2>{0.561337233f, 0.495605797f},
-std::array<float,2>{0.0513922758f, 0.291748583f},
-std::array<float,2>{0.646837533f, 0.5930565f},
-std::array<float,2>{0.374959975f, 0.757338822f},
-std::array<float,2>{0.767388701f, 0.10761302f},
-std::array<float,2>{0.391660511f, 0.445224911f},
-std::array<float,2>{0.95866704f, 0.711561382f},
-std::array<float,2>{0.24402f, 0.935195029f},
-std::array<float,2>{0.624058843f, 0.228145987f},
-std::array<float,2>{0.079428494f, 0.0723264217f},
-std::array<float,2>{0.688221931f, 0.794417679f},
-std::array<float,2>{0.252681077f, 0.59570235f},
-std::array<float,2>{0.862464428f, 0.263076365f},
-std::array<float,2>{0.339982361f, 0.179029644f},
-std::array<float,2>{0.812000632f, 0.982143462f},
-std::array<float,2>{0.0301649999f, 0.664868772f},
-std::array<float,2>{0.673332036f, 0.407403231f},
-std::array<float,2>{0.146674797f, 0.367193997f},
-std::array<float,2>{0.527736187f, 0.544219136f},
-std::array<float,2>{0.446514875f, 0.837421656f},
-std::array<float,2>{0.879306614f, 0.0461843312f},
-std::array<float,2>{0.310944468f, 0.283914834f},
-std::array<float,2>{0.832722008f, 0.579286516f},
-std::array<float,2>{0.113684937f, 0.758612216f},
-std::array<float,2>{0.728914976f, 0.100329854f},
-std::array<float,2>{0.203041255f, 0.192089349f},
-std::array<float,2>{0.563734055f, 0.884028494f},
-std::array<float,2>{0.419935316f, 0.729767799f},
-std::array<float,2>{0.983115792f, 0.485663146f},
-std::array<float,2>{0.485159993f, 0.00665871659f},
-std::array<float,2>{0.922190309f, 0.866836011f},
-std::array<float,2>{0.175888464f, 0.50697279f},
-std::array<float,2>{0.531758666f, 0.315356195f},
-std::array<float,2>{0.0416756198f, 0.393210024f},
-std::array<float,2>{0.632383347f, 0.65033704f},
-std::array<float,2>{0.348271787f, 0.954096496f},
-std::array<float,2>{0.754679084f, 0.149442166f},
-std::array<float,2>{0.467125863f, 0.333240449f},
-std::array<float,2>{0.891541302f, 0.518732965f},
-std::array<float,2>{0.129426196f, 0.845786929f},
-std::array<float,2>{0.50937742f, 0.0305611081f},
-std::array<float,2>{0.00996350124f, 0.128815994f},
-std::array<float,2>{0.666590035f, 0.951569915f},
-std::array<float,2>{0.315398097f, 0.631327569f},
-std::array<float,2>{0.785767317f, 0.381876528f},
-std::array<float,2>{0.274499595f, 0.115895309f},
-std::array<float,2>{0.84698832f, 0.7690413f},
-std::array<float,2>{0.0772186518f, 0.576200008f},
-std::array<float,2>{0.7121315f, 0.297832578f},
-std::array<float,2>{0.231539726f, 0.473351806f},
-std::array<float,2>{0.600012779f, 0.739501178f},
-std::array<float,2>{0.38422963f, 0.897396088f},
-std::array<float,2>{0.939759731f, 0.207054257f},
-std::array<float,2>{0.367265373f, 0.424984246f},
-std::array<float,2>{0.772603512f, 0.683637857f},
-std::array<float,2>{0.0505671762f, 0.991232395f},
-std::array<float,2>{0.642407537f, 0.161480486f},
-std::array<float,2>{0.16654104f, 0.0516056046f},
-std::array<float,2>{0.556418777f, 0.812819719f},
-std::array<float,2>{0.471143663f, 0.547826648f},
-std::array<float,2>{0.917395532f, 0.344964862f},
-std::array<float,2>{0.432520539f, 0.242103964f},
-std::array<float,2>{0.98860991f, 0.916615725f},
-std::array<float,2>{0.205175534f, 0.693706155f},
-std::array<float,2>{0.5808568f, 0.456292599f},
-std::array<float,2>{0.102391407f, 0.274377018f},
-std::array<float,2>{0.736438453f, 0.612564623f},
-std::array<float,2>{0.290072381f, 0.807052016f},
-std::array<float,2>{0.827940166f, 0.0910351649f},
-std::array<float,2>{0.48209399f, 0.387528807f},
-std::array<float,2>{0.911744952f, 0.638522863f},
-std::array<float,2>{0.162098438f, 0.938044965f},
-std::array<float,2>{0.54954654f, 0.133312285f},
-std::array<float,2>{0.0610326231f, 0.0181472953f},
-std::array<float,2>{0.651196241f, 0.853813529f},
-std::array<float,2>{0.361253977f, 0.525213063f},
-std::array<float,2>{0.779124916f, 0.34374398f},
-std::array<float,2>{0.282620639f, 0.214996561f},
-std::array<float,2>{0.819437802f, 0.899952292f},
-std::array<float,2>{0.0945032388f, 0.749492526f},
-std::array<float,2>{0.749469042f, 0.480387628f},
-std::array<float,2>{0.214489058f, 0.308988839f},
-std::array<float,2>{0.586595893f, 0.562622726f},
-std::array<float,2>{0.426579535f, 0.778319538f},
-std::array<float,2>{0.995623708f, 0.124835327f},
-std::array<float,2>{0.324764401f, 0.355810672f},
-std::array<float,2>{0.793698668f, 0.558852911f},
-std::array<float,2>{0.00415748637f, 0.825829268f},
-std::array<float,2>{0.656905234f, 0.055680152f},
-std::array<float,2>{0.135467023f, 0.164968446f},
-std::array<float,2>{0.500960767f, 0.997905791f},
-std::array<float,2>{0.459275246f, 0.673928559f},
-std::array<float,2>{0.903339446f, 0.432920635f},
-std::array<float,2>{0.380723476f, 0.0828496888f},
-std::array<float,2>{0.952878535f, 0.804209232f},
-std::array<float,2>{0.219649851f, 0.619354188f},
-std::array<float,2>{0.609336019f, 0.272624731f},
-std::array<float,2>{0.063531369f, 0.462625861f},
-std::array<float,2>{0.70634824f, 0.698554456f},
-std::array<float,2>{0.270201236f, 0.908549964f},
-std::array<float,2>{0.85290426f, 0.249475077f},
-std::array<float,2>{0.412099153f, 0.256373584f},
-std::array<float,2>{0.973824084f, 0.604909599f},
-std::array<float,2>{0.187804863f, 0.782779872f},
-std::array<float,2>{0.575125396f, 0.0687762201f},
-std::array<float,2>{0.124846466f, 0.222043544f},
-std::array<float,2>{0.721372545f, 0.924516737f},
-std::array<float,2>{0.304132849f, 0.707232952f},
-std::array<float,2>{0.843049526f, 0.45192644f},
-std::array<float,2>{0.357866079f, 0.0344946347f},
-std::array<float,2>{0.75949657f, 0.83500725f},
-std::array<float,2>{0.0319575109f, 0.533403516f},
-std::array<float,2>{0.633324444f, 0.359675497f},
-std::array<float,2>{0.182673916f, 0.416178823f},
-std::array<float,2>{0.540363312f, 0.659570336f},
-std::array<float,2>{0.494955003f, 0.970673084f},
-std::array<float,2>{0.932817161f, 0.187427208f},
-std::array<float,2>{0.259871632f, 0.496597141f},
-std::array<float,2>{0.874283671f, 0.725590527f},
-std::array<float,2>{0.0894962922f, 0.879203379f},
-std::array<float,2>{0.69575882f, 0.196929201f},
-std::array<float,2>{0.234607697f, 0.103287205f},
-std::array<float,2>{0.609725833f, 0.751272738f},
-std::array<float,2>{0.403630495f, 0.589044631f},
-std::array<float,2>{0.967472136f, 0.294111133f},
-std::array<float,2>{0.43793118f, 0.142035291f},
-std::array<float,2>{0.887225449f, 0.965438902f},
-std::array<float,2>{0.155212343f, 0.642360687f},
-std::array<float,2>{0.522462189f, 0.401038259f},
-std::array<float,2>{0.0166708566f, 0.324885666f},
-std::array<float,2>{0.686528683f, 0.507906973f},
-std::array<float,2>{0.332187712f, 0.873980224f},
-std::array<float,2>{0.798418105f, 0.0126272999f},
-std::array<float,2>{0.377457678f, 0.394763559f},
-std::array<float,2>{0.947483122f, 0.653274059f},
-std::array<float,2>{0.225368068f, 0.958029926f},
-std::array<float,2>{0.604027987f, 0.155619115f},
-std::array<float,2>{0.0693415031f, 0.00334734167f},
-std::array<float,2>{0.707707345f, 0.860100448f},
-std::array<float,2>{0.266486555f, 0.500298798f},
-std::array<float,2>{0.857627451f, 0.317847222f},
-std::array<float,2>{0.324011296f, 0.191158116f},
-std::array<float,2>{0.790792882f, 0.890248239f},
-std::array<float,2>{0.000733402849f, 0.733605802f},
-std::array<float,2>{0.663987577f, 0.490875185f},
-std::array<float,2>{0.140383497f, 0.286938697f},
-std::array<float,2>{0.504229486f, 0.582148731f},
-std::array<float,2>{0.456914365f, 0.76496321f},
-std::array<float,2>{0.900849581f, 0.0939210579f},
-std::array<float,2>{0.287356079f, 0.373204917f},
-std::array<float,2>{0.81510973f, 0.54247719f},
-std::array<float,2>{0.0992751271f, 0.841118932f},
-std::array<float,2>{0.743433356f, 0.0418328159f},
-std::array<float,2>{0.2158916f, 0.175706252f},
-std::array<float,2>{0.590975046f, 0.980163217f},
-std::array<float,2>{0.424947351f, 0.668636203f},
-std::array<float,2>{0.996721208f, 0.412214875f},
-std::array<float,2>{0.480195433f, 0.0749587119f},
-std::array<float,2>{0.906563163f, 0.792375803f},
-std::array<float,2>{0.158788025f, 0.599651277f},
-std::array<float,2>{0.550942779f, 0.259497613f},
-std::array<float,2>{0.0578281991f, 0.437843323f},
-std::array<float,2>{0.653741181f, 0.717168093f},
-std::array<float,2>{0.363880306f, 0.930713236f},
-std::array<float,2>{0.776343107f, 0.231904626f},
-std::array<float,2>{0.441523314f, 0.277761728f},
-std::array<float,2>{0.88445574f, 0.616699636f},
-std::array<float,2>{0.150656253f, 0.81234175f},
-std::array<float,2>{0.519412756f, 0.0887985602f},
-std::array<float,2>{0.0196561441f, 0.237758085f},
-std::array<float,2>{0.683141172f, 0.921571374f},
-std::array<float,2>{0.331200153f, 0.688298166f},
-std::array<float,2>{0.803056955f, 0.459508628f},
-std::array<float,2>{0.261975557f, 0.0487221219f},
-std::array<float,2>{0.867505312f, 0.816761136f},
-std::array<float,2>{0.0904414132f, 0.553255022f},
-std::array<float,2>{0.69950074f, 0.349290192f},
-std::array<float,2>{0.238516137f, 0.428990036f},
-std::array<float,2>{0.614195466f, 0.683561087f},
-std::array<float,2>{0.400532871f, 0.986629307f},
-std::array<float,2>{0.961615026f, 0.157773674f},
-std::array<float,2>{0.35446167f, 0.471450537f},
-std::array<float,2>{0.762844026f, 0.737847209f},
-std::array<float,2>{0.0358966291f, 0.893330872f},
-std::array<float,2>{0.638477683f, 0.203287527f},
-std::array<float,2>{0.184967056f, 0.110589325f},
-std::array<float,2>{0.544391751f, 0.77039659f},
-std::array<float,2>{0.498815596f, 0.573545992f},
-std::array<float,2>{0.934154153f, 0.303754777f},
-std::array<float,2>{0.408338666f, 0.132350042f},
-std::array<float,2>{0.970044792f, 0.948672414f},
-std::array<float,2>{0.192301735f, 0.627022147f},
-std::array<float,2>{0.573649049f, 0.37798816f},
-std::array<float,2>{0.121018969f, 0.330428571f},
-std::array<float,2>{0.723558068f, 0.520033777f},
-std::array<float,2>{0.297818691f, 0.847841918f},
-std::array<float,2>{0.838723481f, 0.0243503544f},
-std::array<float,2>{0.489962548f, 0.466157794f},
-std::array<float,2>{0.928340435f, 0.703058004f},
-std::array<float,2>{0.173696607f, 0.910300016f},
-std::array<float,2>{0.538859963f, 0.244514212f},
-std::array<float,2>{0.0455650315f, 0.0804266483f},
-std::array<float,2>{0.625757158f, 0.800647557f},
-std::array<float,2>{0.344939172f, 0.624497831f},
-std::array<float,2>{0.750433922f, 0.267076522f},
-std::array<float,2>{0.308080792f, 0.17128408f},
-std::array<float,2>{0.829178751f, 0.993988276f},
-std::array<float,2>{0.111565486f, 0.679643691f},
-std::array<float,2>{0.731229484f, 0.435269386f},
-std::array<float,2>{0.196466967f, 0.351975709f},
-std::array<float,2>{0.570179105f, 0.557798207f},
-std::array<float,2>{0.417570412f, 0.822045505f},
-std::array<float,2>{0.976816595f, 0.0620094091f},
-std::array<float,2>{0.336691022f, 0.307411522f},
-std::array<float,2>{0.804889619f, 0.568449259f},
-std::array<float,2>{0.0270203222f, 0.774968743f},
-std::array<float,2>{0.676897109f, 0.118571952f},
-std::array<float,2>{0.141601011f, 0.213131145f},
-std::array<float,2>{0.5250597f, 0.905578554f},
-std::array<float,2>{0.452377707f, 0.74297899f},
-std::array<float,2>{0.875435412f, 0.482158571f},
-std::array<float,2>{0.396565586f, 0.0214477554f},
-std::array<float,2>{0.956233084f, 0.857698917f},
-std::array<float,2>{0.248257652f, 0.527450144f},
-std::array<float,2>{0.61884135f, 0.336742163f},
-std::array<float,2>{0.0856731087f, 0.386024296f},
-std::array<float,2>{0.694906652f, 0.63634187f},
-std::array<float,2>{0.256680608f, 0.941797256f},
-std::array<float,2>{0.863302529f, 0.140229881f},
-std::array<float,2>{0.435996771f, 0.32039541f},
-std::array<float,2>{0.984890938f, 0.515501916f},
-std::array<float,2>{0.210630208f, 0.870478153f},
-std::array<float,2>{0.582692146f, 0.0112504316f},
-std::array<float,2>{0.108950578f, 0.146289855f},
-std::array<float,2>{0.740421057f, 0.961111426f},
-std::array<float,2>{0.293722361f, 0.644858301f},
-std::array<float,2>{0.823056281f, 0.405824512f},
-std::array<float,2>{0.371170133f, 0.106381223f},
-std::array<float,2>{0.769408166f, 0.754082501f},
-std::array<float,2>{0.0542211086f, 0.590939701f},
-std::array<float,2>{0.645798564f, 0.290111452f},
-std::array<float,2>{0.170147359f, 0.492720217f},
-std::array<float,2>{0.559065402f, 0.719866514f},
-std::array<float,2>{0.472777367f, 0.878041387f},
-std::array<float,2>{0.920561671f, 0.201400995f},
-std::array<float,2>{0.280513048f, 0.420357555f},
-std::array<float,2>{0.849808753f, 0.660819232f},
-std::array<float,2>{0.0735750422f, 0.97621572f},
-std::array<float,2>{0.718393922f, 0.18027401f},
-std::array<float,2>{0.227144837f, 0.0359549262f},
-std::array<float,2>{0.593848884f, 0.831474245f},
-std::array<float,2>{0.387326956f, 0.537387133f},
-std::array<float,2>{0.944105208f, 0.365139872f},
-std::array<float,2>{0.464170396f, 0.226369172f},
-std::array<float,2>{0.897425175f, 0.927189589f},
-std::array<float,2>{0.125646651f, 0.705136538f},
-std::array<float,2>{0.514200747f, 0.448775977f},
-std::array<float,2>{0.0147860721f, 0.251172364f},
-std::array<float,2>{0.668696284f, 0.609225392f},
-std::array<float,2>{0.316563278f, 0.787568986f},
-std::array<float,2>{0.784190297f, 0.065113306f},
-std::array<float,2>{0.418688059f, 0.487499952f},
-std::array<float,2>{0.98117727f, 0.728350222f},
-std::array<float,2>{0.199585587f, 0.886536241f},
-std::array<float,2>{0.565873384f, 0.19468464f},
-std::array<float,2>{0.115505926f, 0.0982627571f},
-std::array<float,2>{0.728507936f, 0.761219084f},
-std::array<float,2>{0.30961895f, 0.580353796f},
-std::array<float,2>{0.834027946f, 0.282367796f},
-std::array<float,2>{0.351551026f, 0.151434541f},
-std::array<float,2>{0.757239223f, 0.956339777f},
-std::array<float,2>{0.0400440469f, 0.650859892f},
-std::array<float,2>{0.630559564f, 0.39172262f},
-std::array<float,2>{0.178163528f, 0.312967181f},
-std::array<float,2>{0.534687579f, 0.504430354f},
-std::array<float,2>{0.48734647f, 0.863838911f},
-std::array<float,2>{0.925584257f, 0.00505408132f},
-std::array<float,2>{0.250541627f, 0.26555869f},
-std::array<float,2>{0.85942322f, 0.596301079f},
-std::array<float,2>{0.0811831132f, 0.796826839f},
-std::array<float,2>{0.690726638f, 0.0715948939f},
-std::array<float,2>{0.245308757f, 0.229887098f},
-std::array<float,2>{0.621243179f, 0.936465859f},
-std::array<float,2>{0.394052088f, 0.714540422f},
-std::array<float,2>{0.95995158f, 0.443308085f},
-std::array<float,2>{0.44858253f, 0.0447348543f},
-std::array<float,2>{0.881729007f, 0.839406967f},
-std::array<float,2>{0.146233782f, 0.545556664f},
-std::array<float,2>{0.53112489f, 0.371080607f},
-std::array<float,2>{0.0292817149f, 0.409469128f},
-std::array<float,2>{0.674904585f, 0.666925788f},
-std::array<float,2>{0.34249419f, 0.982806146f},
-std::array<float,2>{0.808767557f, 0.177704096f},
-std::array<float,2>{0.469657809f, 0.346681237f},
-std::array<float,2>{0.915989935f, 0.549714506f},
-std::array<float,2>{0.16551429f, 0.815205634f},
-std::array<float,2>{0.556906879f, 0.0540464558f},
-std::array<float,2>{0.047166381f, 0.162499368f},
-std::array<float,2>{0.642624021f, 0.989093006f},
-std::array<float,2>{0.369841486f, 0.685740471f},
-std::array<float,2>{0.77074188f, 0.423766583f},
-std::array<float,2>{0.291534007f, 0.0926641971f},
-std::array<float,2>{0.825343847f, 0.806588948f},
-std::array<float,2>{0.104300126f, 0.611014843f},
-std::array<float,2>{0.73485589f, 0.275777668f},
-std::array<float,2>{0.204899698f, 0.453996271f},
-std::array<float,2>{0.578268051f, 0.691671968f},
-std::array<float,2>{0.430940181f, 0.914769292f},
-std::array<float,2>{0.992120564f, 0.239099354f},
-std::array<float,2>{0.31404984f, 0.380575448f},
-std::array<float,2>{0.788056016f, 0.629722357f},
-std::array<float,2>{0.00904932804f, 0.950764239f},
-std::array<float,2>{0.664563f, 0.126805186f},
-std::array<float,2>{0.132394373f, 0.0284900125f},
-std::array<float,2>{0.510226727f, 0.84449774f},
-std::array<float,2>{0.465171665f, 0.516096592f},
-std::array<float,2>{0.893803179f, 0.334977835f},
-std::array<float,2>{0.386402667f, 0.209264353f},
-std::array<float,2>{0.938747764f, 0.895769775f},
-std::array<float,2>{0.232887894f, 0.740994275f},
-std::array<float,2>{0.598028421f, 0.474707872f},
-std::array<float,2>{0.0745504126f, 0.299742162f},
-std::array<float,2>{0.714556992f, 0.574844301f},
-std::array<float,2>{0.276555449f, 0.766220808f},
-std::array<float,2>{0.843883753f, 0.114675947f},
-std::array<float,2>{0.457513183f, 0.430273205f},
-std::array<float,2>{0.905292511f, 0.672233045f},
-std::array<float,2>{0.133207589f, 0.998933077f},
-std::array<float,2>{0.503197134f, 0.166271791f},
-std::array<float,2>{0.00642719539f, 0.0574607551f},
-std::array<float,2>{0.658517361f, 0.826815784f},
-std::array<float,2>{0.327538937f, 0.561206341f},
-std::array<float,2>{0.796107292f, 0.358480632f},
-std::array<float,2>{0.272281438f, 0.246835217f},
-std::array<float,2>{0.855004013f, 0.907132149f},
-std::array<float,2>{0.0658013523f, 0.695914686f},
-std::array<float,2>{0.704259217f, 0.463126093f},
-std::array<float,2>{0.22081694f, 0.270458817f},
-std::array<float,2>{0.605894685f, 0.617362499f},
-std::array<float,2>{0.381953806f, 0.802296042f},
-std::array<float,2>{0.950765193f, 0.0845544711f},
-std::array<float,2>{0.36207968f, 0.340404749f},
-std::array<float,2>{0.779938638f, 0.525660515f},
-std::array<float,2>{0.0587957129f, 0.852511942f},
-std::array<float,2>{0.64963764f, 0.0164429117f},
-std::array<float,2>{0.163322553f, 0.136616796f},
-std::array<float,2>{0.547488391f, 0.940755486f},
-std::array<float,2>{0.484301329f, 0.64018321f},
-std::array<float,2>{0.913084388f, 0.389384389f},
-std::array<float,2>{0.428430349f, 0.12225008f},
-std::array<float,2>{0.993765771f, 0.779996216f},
-std::array<float,2>{0.211745068f, 0.565742791f},
-std::array<float,2>{0.588277519f, 0.31109187f},
-std::array<float,2>{0.0972033218f, 0.478018045f},
-std::array<float,2>{0.74795258f, 0.746985376f},
-std::array<float,2>{0.284021497f, 0.900909603f},
-std::array<float,2>{0.816444874f, 0.21865584f},
-std::array<float,2>{0.405089766f, 0.295594633f},
-std::array<float,2>{0.965197742f, 0.587109029f},
-std::array<float,2>{0.237933964f, 0.753889143f},
-std::array<float,2>{0.612631679f, 0.103820123f},
-std::array<float,2>{0.0875174552f, 0.198389068f},
-std::array<float,2>{0.698886752f, 0.881560743f},
-std::array<float,2>{0.25940913f, 0.724207103f},
-std::array<float,2>{0.871535003f, 0.499907643f},
-std::array<float,2>{0.335798711f, 0.0155491233f},
-std::array<float,2>{0.800000429f, 0.872084618f},
-std::array<float,2>{0.0180427767f, 0.50998497f},
-std::array<float,2>{0.685167968f, 0.327924818f},
-std::array<float,2>{0.153647244f, 0.39928171f},
-std::array<float,2>{0.519776106f, 0.643427968f},
-std::array<float,2>{0.441139519f, 0.966827273f},
-std::array<float,2>{0.889561653f, 0.143074363f},
-std::array<float,2>{0.302338958f, 0.449301958f},
-std::array<float,2>{0.841046989f, 0.710670531f},
-std::array<float,2>{0.122549765f, 0.922885716f},
-std::array<float,2>{0.718915045f, 0.220610678f},
-std::array<float,2>{0.190437838f, 0.0680831894f},
-std::array<float,2>{0.57705754f, 0.783259928f},
-std::array<float,2>{0.412836611f, 0.602478683f},
-std::array<float,2>{0.975943685f, 0.254420161f},
-std::array<float,2>{0.49378249f, 0.185449973f},
-std::array<float,2>{0.930056393f, 0.97094214f},
-std::array<float,2>{0.180095077f, 0.656716943f},
-std::array<float,2>{0.54291296f, 0.415060014f},
-std::array<float,2>{0.0336796008f, 0.362164855f},
-std::array<float,2>{0.636358738f, 0.531764269f},
-std::array<float,2>{0.356047153f, 0.832366645f},
-std::array<float,2>{0.760498166f, 0.0316489749f}}
\ No newline at end of file
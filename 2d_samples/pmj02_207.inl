@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.863577902f, 0.998458147f},
-std::array<float,2>{0.142441362f, 0.0209316164f},
-std::array<float,2>{0.658739567f, 0.458200961f},
-std::array<float,2>{0.303078115f, 0.71499455f},
-std::array<float,2>{0.580496728f, 0.624190748f},
-std::array<float,2>{0.421591192f, 0.257309973f},
-std::array<float,2>{0.983502924f, 0.183840737f},
-std::array<float,2>{0.0600255504f, 0.856729984f},
-std::array<float,2>{0.929091871f, 0.643009901f},
-std::array<float,2>{0.063462615f, 0.410501838f},
-std::array<float,2>{0.503328204f, 0.101820908f},
-std::array<float,2>{0.468811303f, 0.896225214f},
-std::array<float,2>{0.730470002f, 0.80764246f},
-std::array<float,2>{0.336040676f, 0.214969158f},
-std::array<float,2>{0.771762073f, 0.366540134f},
-std::array<float,2>{0.244971111f, 0.555438161f},
-std::array<float,2>{0.961820722f, 0.826306105f},
-std::array<float,2>{0.0203046501f, 0.148323044f},
-std::array<float,2>{0.610677242f, 0.3054775f},
-std::array<float,2>{0.383541912f, 0.57886374f},
-std::array<float,2>{0.645350337f, 0.724236548f},
-std::array<float,2>{0.258063912f, 0.484496713f},
-std::array<float,2>{0.841720939f, 0.0422433317f},
-std::array<float,2>{0.18499285f, 0.959611654f},
-std::array<float,2>{0.794766665f, 0.507894158f},
-std::array<float,2>{0.203544483f, 0.329605967f},
-std::array<float,2>{0.699491799f, 0.227321103f},
-std::array<float,2>{0.352508903f, 0.750225902f},
-std::array<float,2>{0.539838552f, 0.921284676f},
-std::array<float,2>{0.456169933f, 0.0842499584f},
-std::array<float,2>{0.903530896f, 0.398837507f},
-std::array<float,2>{0.111593455f, 0.682536483f},
-std::array<float,2>{0.878666878f, 0.87992996f},
-std::array<float,2>{0.0948852003f, 0.120785095f},
-std::array<float,2>{0.558916628f, 0.435940295f},
-std::array<float,2>{0.450096428f, 0.634506166f},
-std::array<float,2>{0.708434522f, 0.533632398f},
-std::array<float,2>{0.37139827f, 0.351776689f},
-std::array<float,2>{0.808892787f, 0.19676204f},
-std::array<float,2>{0.18904525f, 0.788346827f},
-std::array<float,2>{0.821561337f, 0.698381722f},
-std::array<float,2>{0.162776053f, 0.445412129f},
-std::array<float,2>{0.63218236f, 0.00987197272f},
-std::array<float,2>{0.270226389f, 0.971372068f},
-std::array<float,2>{0.597232699f, 0.860099316f},
-std::array<float,2>{0.40251106f, 0.166558161f},
-std::array<float,2>{0.949953079f, 0.271346241f},
-std::array<float,2>{0.00785974879f, 0.60474354f},
-std::array<float,2>{0.760409832f, 0.766601086f},
-std::array<float,2>{0.225431532f, 0.238948226f},
-std::array<float,2>{0.744251788f, 0.32453385f},
-std::array<float,2>{0.322364807f, 0.517521441f},
-std::array<float,2>{0.519262671f, 0.656810045f},
-std::array<float,2>{0.494584918f, 0.387974322f},
-std::array<float,2>{0.907408059f, 0.0746841654f},
-std::array<float,2>{0.0845202357f, 0.933793426f},
-std::array<float,2>{0.988581121f, 0.570748687f},
-std::array<float,2>{0.0351236612f, 0.287594914f},
-std::array<float,2>{0.563093305f, 0.139682844f},
-std::array<float,2>{0.42563805f, 0.834723711f},
-std::array<float,2>{0.681336403f, 0.951062441f},
-std::array<float,2>{0.292333633f, 0.0584926121f},
-std::array<float,2>{0.848834038f, 0.470171452f},
-std::array<float,2>{0.133445069f, 0.740595698f},
-std::array<float,2>{0.80348891f, 0.925878763f},
-std::array<float,2>{0.2012752f, 0.0649891645f},
-std::array<float,2>{0.717373431f, 0.382719457f},
-std::array<float,2>{0.363861471f, 0.665755451f},
-std::array<float,2>{0.550405562f, 0.52387917f},
-std::array<float,2>{0.43979606f, 0.317317843f},
-std::array<float,2>{0.885026813f, 0.24350445f},
-std::array<float,2>{0.106508695f, 0.778873861f},
-std::array<float,2>{0.937967956f, 0.748731434f},
-std::array<float,2>{0.00563503336f, 0.481076092f},
-std::array<float,2>{0.602353513f, 0.0484225079f},
-std::array<float,2>{0.392024487f, 0.941107213f},
-std::array<float,2>{0.637990594f, 0.839503884f},
-std::array<float,2>{0.276680171f, 0.129362822f},
-std::array<float,2>{0.817542672f, 0.290956348f},
-std::array<float,2>{0.164182469f, 0.56517005f},
-std::array<float,2>{0.918251991f, 0.793575823f},
-std::array<float,2>{0.0870563164f, 0.191460952f},
-std::array<float,2>{0.528511047f, 0.344028324f},
-std::array<float,2>{0.485666007f, 0.541132808f},
-std::array<float,2>{0.738864779f, 0.628757119f},
-std::array<float,2>{0.318020612f, 0.423019916f},
-std::array<float,2>{0.751923382f, 0.111730464f},
-std::array<float,2>{0.231051385f, 0.886841178f},
-std::array<float,2>{0.856865406f, 0.599602044f},
-std::array<float,2>{0.125969499f, 0.280610323f},
-std::array<float,2>{0.675140202f, 0.156978428f},
-std::array<float,2>{0.285907567f, 0.869446754f},
-std::array<float,2>{0.575765193f, 0.981951892f},
-std::array<float,2>{0.431436181f, 0.000696446223f},
-std::array<float,2>{0.994295478f, 0.439120471f},
-std::array<float,2>{0.0440781862f, 0.688936532f},
-std::array<float,2>{0.969126821f, 0.967914641f},
-std::array<float,2>{0.0497504324f, 0.0318527631f},
-std::array<float,2>{0.591739535f, 0.494030595f},
-std::array<float,2>{0.40852806f, 0.727269232f},
-std::array<float,2>{0.670369685f, 0.588367701f},
-std::array<float,2>{0.309805244f, 0.300035328f},
-std::array<float,2>{0.873432338f, 0.149796873f},
-std::array<float,2>{0.149530232f, 0.814338624f},
-std::array<float,2>{0.7770437f, 0.676244199f},
-std::array<float,2>{0.239947721f, 0.397181273f},
-std::array<float,2>{0.720979989f, 0.0902107954f},
-std::array<float,2>{0.331299782f, 0.908335626f},
-std::array<float,2>{0.512310982f, 0.760290563f},
-std::array<float,2>{0.482310057f, 0.222642943f},
-std::array<float,2>{0.934839487f, 0.34001109f},
-std::array<float,2>{0.0750316083f, 0.507714212f},
-std::array<float,2>{0.832458735f, 0.844843507f},
-std::array<float,2>{0.179629236f, 0.173135057f},
-std::array<float,2>{0.651072502f, 0.262946695f},
-std::array<float,2>{0.254287541f, 0.615323365f},
-std::array<float,2>{0.619067669f, 0.707671404f},
-std::array<float,2>{0.377157956f, 0.461332411f},
-std::array<float,2>{0.958883762f, 0.0311895367f},
-std::array<float,2>{0.0266375579f, 0.985503376f},
-std::array<float,2>{0.895279765f, 0.547693431f},
-std::array<float,2>{0.124683648f, 0.371996284f},
-std::array<float,2>{0.536673069f, 0.204460889f},
-std::array<float,2>{0.466758698f, 0.798810422f},
-std::array<float,2>{0.694124222f, 0.905112922f},
-std::array<float,2>{0.344314277f, 0.10086114f},
-std::array<float,2>{0.785221875f, 0.417985469f},
-std::array<float,2>{0.213378042f, 0.654854417f},
-std::array<float,2>{0.767359138f, 0.944739163f},
-std::array<float,2>{0.249395043f, 0.0531917028f},
-std::array<float,2>{0.729964972f, 0.479114801f},
-std::array<float,2>{0.342799753f, 0.744304717f},
-std::array<float,2>{0.505426407f, 0.568896174f},
-std::array<float,2>{0.474712372f, 0.29560405f},
-std::array<float,2>{0.922083795f, 0.128518894f},
-std::array<float,2>{0.069170922f, 0.842270494f},
-std::array<float,2>{0.980138659f, 0.670434415f},
-std::array<float,2>{0.055431962f, 0.376834303f},
-std::array<float,2>{0.585231423f, 0.0680873767f},
-std::array<float,2>{0.41774261f, 0.922841966f},
-std::array<float,2>{0.660868824f, 0.773689032f},
-std::array<float,2>{0.299467981f, 0.246268213f},
-std::array<float,2>{0.860679567f, 0.314946771f},
-std::array<float,2>{0.146470606f, 0.528631568f},
-std::array<float,2>{0.90160352f, 0.871894956f},
-std::array<float,2>{0.114966713f, 0.161164925f},
-std::array<float,2>{0.545204103f, 0.276245743f},
-std::array<float,2>{0.457209319f, 0.594221771f},
-std::array<float,2>{0.698834658f, 0.693657815f},
-std::array<float,2>{0.359249651f, 0.444808722f},
-std::array<float,2>{0.792939425f, 0.00510944612f},
-std::array<float,2>{0.209608063f, 0.980264187f},
-std::array<float,2>{0.838321805f, 0.546732962f},
-std::array<float,2>{0.182379499f, 0.34833923f},
-std::array<float,2>{0.640952945f, 0.188929945f},
-std::array<float,2>{0.264041692f, 0.790171683f},
-std::array<float,2>{0.616804779f, 0.885675311f},
-std::array<float,2>{0.389467239f, 0.114155054f},
-std::array<float,2>{0.965290666f, 0.426312566f},
-std::array<float,2>{0.0169081893f, 0.632374465f},
-std::array<float,2>{0.946050227f, 0.911666155f},
-std::array<float,2>{0.0149079338f, 0.0873168632f},
-std::array<float,2>{0.599765718f, 0.391911805f},
-std::array<float,2>{0.398636967f, 0.672086239f},
-std::array<float,2>{0.628659308f, 0.50020045f},
-std::array<float,2>{0.267468661f, 0.339210898f},
-std::array<float,2>{0.827755868f, 0.222884208f},
-std::array<float,2>{0.156479165f, 0.762467802f},
-std::array<float,2>{0.806692183f, 0.73104763f},
-std::array<float,2>{0.194385394f, 0.498108417f},
-std::array<float,2>{0.705589592f, 0.0373683088f},
-std::array<float,2>{0.367807657f, 0.961884618f},
-std::array<float,2>{0.556239903f, 0.819296718f},
-std::array<float,2>{0.449165255f, 0.152379662f},
-std::array<float,2>{0.879768014f, 0.302446157f},
-std::array<float,2>{0.0997232944f, 0.590470254f},
-std::array<float,2>{0.845759869f, 0.804640472f},
-std::array<float,2>{0.139840364f, 0.208141178f},
-std::array<float,2>{0.68617177f, 0.368758559f},
-std::array<float,2>{0.293824404f, 0.55375582f},
-std::array<float,2>{0.568343699f, 0.648910165f},
-std::array<float,2>{0.427214414f, 0.417308539f},
-std::array<float,2>{0.984931409f, 0.0961136892f},
-std::array<float,2>{0.0385150127f, 0.899181843f},
-std::array<float,2>{0.912674427f, 0.611032009f},
-std::array<float,2>{0.0810682327f, 0.260273874f},
-std::array<float,2>{0.519705057f, 0.177680567f},
-std::array<float,2>{0.496599495f, 0.847879827f},
-std::array<float,2>{0.747121871f, 0.990258098f},
-std::array<float,2>{0.324312001f, 0.0240432471f},
-std::array<float,2>{0.763655484f, 0.465704739f},
-std::array<float,2>{0.220825121f, 0.703980386f},
-std::array<float,2>{0.815332294f, 0.893875837f},
-std::array<float,2>{0.168588713f, 0.107921407f},
-std::array<float,2>{0.636061072f, 0.408586115f},
-std::array<float,2>{0.280772537f, 0.647872746f},
-std::array<float,2>{0.60814935f, 0.560554445f},
-std::array<float,2>{0.396242499f, 0.362643749f},
-std::array<float,2>{0.944158673f, 0.210991442f},
-std::array<float,2>{0.0028201472f, 0.809209824f},
-std::array<float,2>{0.887717605f, 0.714566052f},
-std::array<float,2>{0.103612289f, 0.454450816f},
-std::array<float,2>{0.554428339f, 0.0157704595f},
-std::array<float,2>{0.442509621f, 0.99412173f},
-std::array<float,2>{0.712917805f, 0.852700651f},
-std::array<float,2>{0.362960428f, 0.18091704f},
-std::array<float,2>{0.798481166f, 0.253333509f},
-std::array<float,2>{0.196432412f, 0.618789375f},
-std::array<float,2>{0.997734368f, 0.754214883f},
-std::array<float,2>{0.041043099f, 0.231897801f},
-std::array<float,2>{0.572406411f, 0.332844317f},
-std::array<float,2>{0.436577946f, 0.512529254f},
-std::array<float,2>{0.67853564f, 0.685629308f},
-std::array<float,2>{0.282813549f, 0.405458957f},
-std::array<float,2>{0.853850007f, 0.0801079348f},
-std::array<float,2>{0.131156087f, 0.915762126f},
-std::array<float,2>{0.757322729f, 0.582754731f},
-std::array<float,2>{0.228893846f, 0.309402138f},
-std::array<float,2>{0.734602511f, 0.14147754f},
-std::array<float,2>{0.315384775f, 0.824063361f},
-std::array<float,2>{0.525630534f, 0.953169942f},
-std::array<float,2>{0.49201104f, 0.0457232073f},
-std::array<float,2>{0.914954245f, 0.489544153f},
-std::array<float,2>{0.0903135613f, 0.721268773f},
-std::array<float,2>{0.930680454f, 0.973634362f},
-std::array<float,2>{0.073949255f, 0.0127990311f},
-std::array<float,2>{0.507849813f, 0.449258238f},
-std::array<float,2>{0.477781802f, 0.700479686f},
-std::array<float,2>{0.724957883f, 0.60853225f},
-std::array<float,2>{0.33453244f, 0.268695772f},
-std::array<float,2>{0.781170726f, 0.170188129f},
-std::array<float,2>{0.235230774f, 0.865652502f},
-std::array<float,2>{0.869719148f, 0.638288319f},
-std::array<float,2>{0.153620914f, 0.430258721f},
-std::array<float,2>{0.667377889f, 0.121840917f},
-std::array<float,2>{0.30856666f, 0.875905812f},
-std::array<float,2>{0.589628518f, 0.782048166f},
-std::array<float,2>{0.412820041f, 0.200233817f},
-std::array<float,2>{0.973226964f, 0.359274387f},
-std::array<float,2>{0.0538802072f, 0.535408318f},
-std::array<float,2>{0.782358706f, 0.830186069f},
-std::array<float,2>{0.217875391f, 0.133479252f},
-std::array<float,2>{0.689815998f, 0.284142882f},
-std::array<float,2>{0.350945324f, 0.575904667f},
-std::array<float,2>{0.533907294f, 0.736763775f},
-std::array<float,2>{0.463127851f, 0.47530356f},
-std::array<float,2>{0.891989589f, 0.0600793175f},
-std::array<float,2>{0.118468419f, 0.947430372f},
-std::array<float,2>{0.953701735f, 0.520233154f},
-std::array<float,2>{0.0302488413f, 0.32317096f},
-std::array<float,2>{0.623874128f, 0.237502038f},
-std::array<float,2>{0.379208773f, 0.770454943f},
-std::array<float,2>{0.654323876f, 0.930107832f},
-std::array<float,2>{0.251738131f, 0.0738179311f},
-std::array<float,2>{0.830717981f, 0.383158416f},
-std::array<float,2>{0.174680918f, 0.662743151f},
-std::array<float,2>{0.843391359f, 0.958708405f},
-std::array<float,2>{0.187121227f, 0.0407546572f},
-std::array<float,2>{0.647763312f, 0.486405879f},
-std::array<float,2>{0.25998196f, 0.725269496f},
-std::array<float,2>{0.612953484f, 0.581647277f},
-std::array<float,2>{0.38653326f, 0.307805926f},
-std::array<float,2>{0.963844597f, 0.144699588f},
-std::array<float,2>{0.0223571919f, 0.824804127f},
-std::array<float,2>{0.905657291f, 0.679951966f},
-std::array<float,2>{0.111246854f, 0.401307791f},
-std::array<float,2>{0.541023254f, 0.0834588483f},
-std::array<float,2>{0.453475416f, 0.918331802f},
-std::array<float,2>{0.70202446f, 0.753176987f},
-std::array<float,2>{0.353786021f, 0.229797512f},
-std::array<float,2>{0.795011938f, 0.331225216f},
-std::array<float,2>{0.205155075f, 0.510444462f},
-std::array<float,2>{0.980759084f, 0.858707428f},
-std::array<float,2>{0.0624167398f, 0.187431261f},
-std::array<float,2>{0.579519272f, 0.25480637f},
-std::array<float,2>{0.419471592f, 0.622017384f},
-std::array<float,2>{0.657186508f, 0.718623221f},
-std::array<float,2>{0.301053524f, 0.460659653f},
-std::array<float,2>{0.865451455f, 0.0214978922f},
-std::array<float,2>{0.144053593f, 0.996943355f},
-std::array<float,2>{0.770821691f, 0.557893634f},
-std::array<float,2>{0.243294075f, 0.363827169f},
-std::array<float,2>{0.733959973f, 0.218311027f},
-std::array<float,2>{0.339564443f, 0.80551815f},
-std::array<float,2>{0.500185192f, 0.896805644f},
-std::array<float,2>{0.471035421f, 0.104542084f},
-std::array<float,2>{0.927184522f, 0.413535655f},
-std::array<float,2>{0.0647338778f, 0.641550541f},
-std::array<float,2>{0.909753978f, 0.935828269f},
-std::array<float,2>{0.082908228f, 0.0770855397f},
-std::array<float,2>{0.516494036f, 0.390081018f},
-std::array<float,2>{0.494068742f, 0.659338713f},
-std::array<float,2>{0.74352926f, 0.519006193f},
-std::array<float,2>{0.322219878f, 0.326242477f},
-std::array<float,2>{0.759389102f, 0.240718618f},
-std::array<float,2>{0.222752914f, 0.768782437f},
-std::array<float,2>{0.851266623f, 0.738891542f},
-std::array<float,2>{0.136385843f, 0.471396357f},
-std::array<float,2>{0.682759225f, 0.055391375f},
-std::array<float,2>{0.289462179f, 0.951276004f},
-std::array<float,2>{0.564615905f, 0.832411587f},
-std::array<float,2>{0.42305705f, 0.138396725f},
-std::array<float,2>{0.990831375f, 0.286379725f},
-std::array<float,2>{0.0312873051f, 0.573149621f},
-std::array<float,2>{0.811321676f, 0.786275923f},
-std::array<float,2>{0.191019088f, 0.19852291f},
-std::array<float,2>{0.710847795f, 0.353923172f},
-std::array<float,2>{0.373223245f, 0.531672478f},
-std::array<float,2>{0.562308311f, 0.636182129f},
-std::array<float,2>{0.451209515f, 0.433629125f},
-std::array<float,2>{0.875132918f, 0.117712297f},
-std::array<float,2>{0.0974609032f, 0.881842375f},
-std::array<float,2>{0.952356935f, 0.601600349f},
-std::array<float,2>{0.0108898925f, 0.271779627f},
-std::array<float,2>{0.593943655f, 0.164551198f},
-std::array<float,2>{0.405192763f, 0.861424565f},
-std::array<float,2>{0.629450202f, 0.970106959f},
-std::array<float,2>{0.273083538f, 0.00950258691f},
-std::array<float,2>{0.823929429f, 0.447917998f},
-std::array<float,2>{0.161203176f, 0.696895063f},
-std::array<float,2>{0.753542781f, 0.889327824f},
-std::array<float,2>{0.232777804f, 0.110336713f},
-std::array<float,2>{0.742154777f, 0.425312489f},
-std::array<float,2>{0.319859087f, 0.625303864f},
-std::array<float,2>{0.530954123f, 0.540977716f},
-std::array<float,2>{0.487898678f, 0.345921367f},
-std::array<float,2>{0.920498967f, 0.195106596f},
-std::array<float,2>{0.089775376f, 0.79661566f},
-std::array<float,2>{0.993590653f, 0.690052032f},
-std::array<float,2>{0.0467433259f, 0.440982252f},
-std::array<float,2>{0.57708025f, 0.00371389673f},
-std::array<float,2>{0.43302837f, 0.98296392f},
-std::array<float,2>{0.672929943f, 0.867540061f},
-std::array<float,2>{0.288426399f, 0.159782365f},
-std::array<float,2>{0.85932827f, 0.277683616f},
-std::array<float,2>{0.128095105f, 0.59998256f},
-std::array<float,2>{0.883130968f, 0.781024218f},
-std::array<float,2>{0.108544394f, 0.244845226f},
-std::array<float,2>{0.54736203f, 0.319066852f},
-std::array<float,2>{0.439334095f, 0.526493073f},
-std::array<float,2>{0.714955926f, 0.667832136f},
-std::array<float,2>{0.366435915f, 0.379254669f},
-std::array<float,2>{0.802024424f, 0.0630851015f},
-std::array<float,2>{0.200965792f, 0.929557025f},
-std::array<float,2>{0.819518209f, 0.56293565f},
-std::array<float,2>{0.16739209f, 0.291108906f},
-std::array<float,2>{0.640191019f, 0.132629767f},
-std::array<float,2>{0.274572462f, 0.837029159f},
-std::array<float,2>{0.603745818f, 0.93852067f},
-std::array<float,2>{0.392907053f, 0.0492809005f},
-std::array<float,2>{0.94020772f, 0.482566655f},
-std::array<float,2>{0.00749429828f, 0.746244013f},
-std::array<float,2>{0.960732937f, 0.986945748f},
-std::array<float,2>{0.0244382657f, 0.0274801683f},
-std::array<float,2>{0.619912863f, 0.463093847f},
-std::array<float,2>{0.375721574f, 0.709671736f},
-std::array<float,2>{0.648959577f, 0.614900053f},
-std::array<float,2>{0.256280184f, 0.26387009f},
-std::array<float,2>{0.835160851f, 0.174217179f},
-std::array<float,2>{0.176710054f, 0.845877647f},
-std::array<float,2>{0.787126303f, 0.653454483f},
-std::array<float,2>{0.21212092f, 0.421024621f},
-std::array<float,2>{0.691898167f, 0.0976567119f},
-std::array<float,2>{0.346200436f, 0.903293073f},
-std::array<float,2>{0.537130475f, 0.798982978f},
-std::array<float,2>{0.468697965f, 0.205961391f},
-std::array<float,2>{0.897690237f, 0.374153703f},
-std::array<float,2>{0.121625133f, 0.550224483f},
-std::array<float,2>{0.872209668f, 0.814770579f},
-std::array<float,2>{0.150485799f, 0.15128538f},
-std::array<float,2>{0.669810474f, 0.298343092f},
-std::array<float,2>{0.310616106f, 0.587607443f},
-std::array<float,2>{0.593038619f, 0.728714168f},
-std::array<float,2>{0.406267226f, 0.495387673f},
-std::array<float,2>{0.972347677f, 0.0338238403f},
-std::array<float,2>{0.0484637581f, 0.965286553f},
-std::array<float,2>{0.936786771f, 0.50514549f},
-std::array<float,2>{0.0768636912f, 0.342018932f},
-std::array<float,2>{0.515617192f, 0.218981847f},
-std::array<float,2>{0.482442737f, 0.759689867f},
-std::array<float,2>{0.719501972f, 0.906440496f},
-std::array<float,2>{0.32985577f, 0.0931516513f},
-std::array<float,2>{0.774088264f, 0.396229446f},
-std::array<float,2>{0.241597071f, 0.679136455f},
-std::array<float,2>{0.789529741f, 0.978235304f},
-std::array<float,2>{0.207549334f, 0.00667076884f},
-std::array<float,2>{0.695782125f, 0.441615701f},
-std::array<float,2>{0.35586679f, 0.692923784f},
-std::array<float,2>{0.543896854f, 0.597037792f},
-std::array<float,2>{0.459739566f, 0.274765253f},
-std::array<float,2>{0.899204314f, 0.162500173f},
-std::array<float,2>{0.116423465f, 0.874049485f},
-std::array<float,2>{0.968537331f, 0.630040586f},
-std::array<float,2>{0.0182639826f, 0.428936392f},
-std::array<float,2>{0.61414361f, 0.115334935f},
-std::array<float,2>{0.386978954f, 0.88440156f},
-std::array<float,2>{0.64381355f, 0.792151868f},
-std::array<float,2>{0.262961715f, 0.191388309f},
-std::array<float,2>{0.836196065f, 0.349683225f},
-std::array<float,2>{0.180196181f, 0.543637693f},
-std::array<float,2>{0.925453722f, 0.840800107f},
-std::array<float,2>{0.0664126053f, 0.125890076f},
-std::array<float,2>{0.506676435f, 0.294920027f},
-std::array<float,2>{0.472940177f, 0.566932738f},
-std::array<float,2>{0.727047861f, 0.742560983f},
-std::array<float,2>{0.341680646f, 0.478338391f},
-std::array<float,2>{0.767911255f, 0.050798621f},
-std::array<float,2>{0.247918546f, 0.943012297f},
-std::array<float,2>{0.86328125f, 0.530908287f},
-std::array<float,2>{0.148060054f, 0.312754661f},
-std::array<float,2>{0.663379133f, 0.249223948f},
-std::array<float,2>{0.298315763f, 0.776472032f},
-std::array<float,2>{0.583002746f, 0.924105942f},
-std::array<float,2>{0.414970696f, 0.0697534382f},
-std::array<float,2>{0.976642191f, 0.377376974f},
-std::array<float,2>{0.0583267324f, 0.669183493f},
-std::array<float,2>{0.986727238f, 0.901822805f},
-std::array<float,2>{0.0363346115f, 0.0953403488f},
-std::array<float,2>{0.56845367f, 0.414321333f},
-std::array<float,2>{0.429610699f, 0.651433051f},
-std::array<float,2>{0.685544431f, 0.552709699f},
-std::array<float,2>{0.296111226f, 0.369529963f},
-std::array<float,2>{0.844107449f, 0.20981285f},
-std::array<float,2>{0.137711406f, 0.80083406f},
-std::array<float,2>{0.764587641f, 0.706299424f},
-std::array<float,2>{0.220288217f, 0.468381226f},
-std::array<float,2>{0.749548256f, 0.0267035868f},
-std::array<float,2>{0.327568531f, 0.989213169f},
-std::array<float,2>{0.522138476f, 0.851362348f},
-std::array<float,2>{0.49887234f, 0.179144964f},
-std::array<float,2>{0.912089229f, 0.257916063f},
-std::array<float,2>{0.0798212364f, 0.611557126f},
-std::array<float,2>{0.824915051f, 0.76562196f},
-std::array<float,2>{0.158481285f, 0.226548105f},
-std::array<float,2>{0.626050711f, 0.3364425f},
-std::array<float,2>{0.267989159f, 0.503125787f},
-std::array<float,2>{0.598149598f, 0.675231934f},
-std::array<float,2>{0.400999367f, 0.393277735f},
-std::array<float,2>{0.949213147f, 0.0882988498f},
-std::array<float,2>{0.0134302964f, 0.913805127f},
-std::array<float,2>{0.881471097f, 0.593521118f},
-std::array<float,2>{0.0985315219f, 0.304499835f},
-std::array<float,2>{0.556877136f, 0.154466599f},
-std::array<float,2>{0.446543604f, 0.816926956f},
-std::array<float,2>{0.704641581f, 0.964373887f},
-std::array<float,2>{0.369191706f, 0.035640005f},
-std::array<float,2>{0.805075228f, 0.497167468f},
-std::array<float,2>{0.192830294f, 0.732810318f},
-std::array<float,2>{0.85345304f, 0.916551709f},
-std::array<float,2>{0.128948271f, 0.0785394683f},
-std::array<float,2>{0.676621854f, 0.402915239f},
-std::array<float,2>{0.283667535f, 0.684177458f},
-std::array<float,2>{0.570436656f, 0.514274955f},
-std::array<float,2>{0.43552506f, 0.334022462f},
-std::array<float,2>{0.999089301f, 0.233834788f},
-std::array<float,2>{0.0391500071f, 0.756014526f},
-std::array<float,2>{0.916286051f, 0.720095336f},
-std::array<float,2>{0.0930431411f, 0.490723848f},
-std::array<float,2>{0.524296463f, 0.0435722321f},
-std::array<float,2>{0.48953563f, 0.955943406f},
-std::array<float,2>{0.73713547f, 0.820658267f},
-std::array<float,2>{0.313254327f, 0.143795803f},
-std::array<float,2>{0.755262136f, 0.311651349f},
-std::array<float,2>{0.227201402f, 0.584982634f},
-std::array<float,2>{0.941440284f, 0.810885012f},
-std::array<float,2>{0.00156613789f, 0.213127807f},
-std::array<float,2>{0.607417107f, 0.359720349f},
-std::array<float,2>{0.397455394f, 0.559082866f},
-std::array<float,2>{0.634527087f, 0.645089328f},
-std::array<float,2>{0.278555483f, 0.407183617f},
-std::array<float,2>{0.812876463f, 0.106090024f},
-std::array<float,2>{0.17150636f, 0.891221285f},
-std::array<float,2>{0.799928486f, 0.620556295f},
-std::array<float,2>{0.198620886f, 0.251437455f},
-std::array<float,2>{0.711834252f, 0.183054224f},
-std::array<float,2>{0.359992146f, 0.854398668f},
-std::array<float,2>{0.552099168f, 0.994929552f},
-std::array<float,2>{0.443652302f, 0.0185797475f},
-std::array<float,2>{0.890221119f, 0.456321627f},
-std::array<float,2>{0.102704808f, 0.71175164f},
-std::array<float,2>{0.892770529f, 0.945836306f},
-std::array<float,2>{0.120678507f, 0.0615711585f},
-std::array<float,2>{0.531680942f, 0.473631859f},
-std::array<float,2>{0.46100834f, 0.735521138f},
-std::array<float,2>{0.688416481f, 0.576451898f},
-std::array<float,2>{0.348770082f, 0.281510085f},
-std::array<float,2>{0.783965766f, 0.136655226f},
-std::array<float,2>{0.215563551f, 0.828164995f},
-std::array<float,2>{0.82844758f, 0.660627067f},
-std::array<float,2>{0.172489852f, 0.384998918f},
-std::array<float,2>{0.652908564f, 0.0717876256f},
-std::array<float,2>{0.253533244f, 0.933012486f},
-std::array<float,2>{0.623005509f, 0.771813035f},
-std::array<float,2>{0.382117867f, 0.235298485f},
-std::array<float,2>{0.955326796f, 0.321248621f},
-std::array<float,2>{0.0285759307f, 0.522633195f},
-std::array<float,2>{0.778717101f, 0.864383757f},
-std::array<float,2>{0.237842068f, 0.169175163f},
-std::array<float,2>{0.724418521f, 0.267274171f},
-std::array<float,2>{0.33228299f, 0.60686177f},
-std::array<float,2>{0.510055363f, 0.703093469f},
-std::array<float,2>{0.480373085f, 0.452287555f},
-std::array<float,2>{0.932145298f, 0.0141715743f},
-std::array<float,2>{0.0717710555f, 0.975267172f},
-std::array<float,2>{0.976373792f, 0.537252069f},
-std::array<float,2>{0.0521458127f, 0.356063902f},
-std::array<float,2>{0.586158156f, 0.201227993f},
-std::array<float,2>{0.410699099f, 0.784670949f},
-std::array<float,2>{0.664861977f, 0.87849921f},
-std::array<float,2>{0.30490163f, 0.123996913f},
-std::array<float,2>{0.867306173f, 0.43343249f},
-std::array<float,2>{0.155040041f, 0.639387906f},
-std::array<float,2>{0.82276845f, 0.972226858f},
-std::array<float,2>{0.160311237f, 0.0107980538f},
-std::array<float,2>{0.629906952f, 0.446666539f},
-std::array<float,2>{0.271967083f, 0.697883904f},
-std::array<float,2>{0.595057249f, 0.604359627f},
-std::array<float,2>{0.406209052f, 0.269544095f},
-std::array<float,2>{0.951909244f, 0.167531833f},
-std::array<float,2>{0.0101707755f, 0.8609128f},
-std::array<float,2>{0.876161993f, 0.632846236f},
-std::array<float,2>{0.0966659635f, 0.437043101f},
-std::array<float,2>{0.56081003f, 0.1198726f},
-std::array<float,2>{0.452613056f, 0.879416883f},
-std::array<float,2>{0.709094584f, 0.787677705f},
-std::array<float,2>{0.374807656f, 0.196120143f},
-std::array<float,2>{0.81195581f, 0.353418231f},
-std::array<float,2>{0.190175697f, 0.534199893f},
-std::array<float,2>{0.991977513f, 0.83553499f},
-std::array<float,2>{0.0331094973f, 0.139513955f},
-std::array<float,2>{0.565916777f, 0.288751811f},
-std::array<float,2>{0.422508806f, 0.572124183f},
-std::array<float,2>{0.6824947f, 0.741254628f},
-std::array<float,2>{0.290199369f, 0.469288647f},
-std::array<float,2>{0.850293994f, 0.0568981692f},
-std::array<float,2>{0.135200948f, 0.949877799f},
-std::array<float,2>{0.758584321f, 0.51592207f},
-std::array<float,2>{0.22380206f, 0.325815171f},
-std::array<float,2>{0.74311173f, 0.240127057f},
-std::array<float,2>{0.320892304f, 0.766692042f},
-std::array<float,2>{0.517202497f, 0.934720635f},
-std::array<float,2>{0.49264577f, 0.0754749104f},
-std::array<float,2>{0.908939004f, 0.387590677f},
-std::array<float,2>{0.0831819922f, 0.657359242f},
-std::array<float,2>{0.926238418f, 0.8946082f},
-std::array<float,2>{0.0655337572f, 0.102919906f},
-std::array<float,2>{0.501188278f, 0.411746711f},
-std::array<float,2>{0.472111791f, 0.643589139f},
-std::array<float,2>{0.732448101f, 0.555957794f},
-std::array<float,2>{0.338816434f, 0.365870655f},
-std::array<float,2>{0.769958377f, 0.216281265f},
-std::array<float,2>{0.24305819f, 0.807346404f},
-std::array<float,2>{0.867004097f, 0.716202497f},
-std::array<float,2>{0.143161505f, 0.457808107f},
-std::array<float,2>{0.657788575f, 0.020243112f},
-std::array<float,2>{0.302513957f, 0.999685645f},
-std::array<float,2>{0.57900399f, 0.855637908f},
-std::array<float,2>{0.418538064f, 0.184687302f},
-std::array<float,2>{0.981816649f, 0.256417423f},
-std::array<float,2>{0.060554523f, 0.623305857f},
-std::array<float,2>{0.796255529f, 0.751322269f},
-std::array<float,2>{0.206846207f, 0.228394285f},
-std::array<float,2>{0.70261997f, 0.329091042f},
-std::array<float,2>{0.355466217f, 0.509287655f},
-std::array<float,2>{0.542761564f, 0.6827088f},
-std::array<float,2>{0.454115599f, 0.400342345f},
-std::array<float,2>{0.904656708f, 0.0854673386f},
-std::array<float,2>{0.110345781f, 0.920839548f},
-std::array<float,2>{0.964163303f, 0.579738855f},
-std::array<float,2>{0.0226387307f, 0.306063592f},
-std::array<float,2>{0.612220228f, 0.14708066f},
-std::array<float,2>{0.385418564f, 0.827995896f},
-std::array<float,2>{0.647005975f, 0.960403323f},
-std::array<float,2>{0.261210173f, 0.0419708155f},
-std::array<float,2>{0.842496395f, 0.485594779f},
-std::array<float,2>{0.185585812f, 0.722970009f},
-std::array<float,2>{0.774425507f, 0.90960604f},
-std::array<float,2>{0.240743771f, 0.0913076103f},
-std::array<float,2>{0.720658243f, 0.397959113f},
-std::array<float,2>{0.32861644f, 0.677712917f},
-std::array<float,2>{0.513954163f, 0.5059762f},
-std::array<float,2>{0.484287769f, 0.341293097f},
-std::array<float,2>{0.936142147f, 0.221579045f},
-std::array<float,2>{0.0777420402f, 0.760838568f},
-std::array<float,2>{0.970915377f, 0.72795099f},
-std::array<float,2>{0.047824163f, 0.493120551f},
-std::array<float,2>{0.592362225f, 0.0327941366f},
-std::array<float,2>{0.407903045f, 0.966959298f},
-std::array<float,2>{0.668272376f, 0.812608659f},
-std::array<float,2>{0.312191039f, 0.149215281f},
-std::array<float,2>{0.871720254f, 0.299688965f},
-std::array<float,2>{0.152114868f, 0.589608669f},
-std::array<float,2>{0.897254527f, 0.797657132f},
-std::array<float,2>{0.122618273f, 0.203149274f},
-std::array<float,2>{0.538110852f, 0.372665375f},
-std::array<float,2>{0.467078149f, 0.548116505f},
-std::array<float,2>{0.692516863f, 0.656178772f},
-std::array<float,2>{0.346854001f, 0.41980651f},
-std::array<float,2>{0.788625538f, 0.0996297523f},
-std::array<float,2>{0.211670846f, 0.90546459f},
-std::array<float,2>{0.834625661f, 0.616460681f},
-std::array<float,2>{0.177294523f, 0.262400419f},
-std::array<float,2>{0.650332987f, 0.171946734f},
-std::array<float,2>{0.257090092f, 0.844695091f},
-std::array<float,2>{0.620487213f, 0.984990358f},
-std::array<float,2>{0.376160324f, 0.0294127278f},
-std::array<float,2>{0.959942639f, 0.462397546f},
-std::array<float,2>{0.024377523f, 0.708626688f},
-std::array<float,2>{0.941084683f, 0.939618349f},
-std::array<float,2>{0.00665571913f, 0.0470982045f},
-std::array<float,2>{0.605165482f, 0.482173681f},
-std::array<float,2>{0.393745869f, 0.749079227f},
-std::array<float,2>{0.638735235f, 0.566094577f},
-std::array<float,2>{0.274364948f, 0.289956301f},
-std::array<float,2>{0.818762481f, 0.130205199f},
-std::array<float,2>{0.166870058f, 0.838610351f},
-std::array<float,2>{0.801287591f, 0.664560318f},
-std::array<float,2>{0.199509844f, 0.381461173f},
-std::array<float,2>{0.716549695f, 0.0663731992f},
-std::array<float,2>{0.365513831f, 0.927407265f},
-std::array<float,2>{0.547925234f, 0.777995408f},
-std::array<float,2>{0.438399345f, 0.242258951f},
-std::array<float,2>{0.884529591f, 0.317937404f},
-std::array<float,2>{0.10804341f, 0.52527523f},
-std::array<float,2>{0.85756427f, 0.870479822f},
-std::array<float,2>{0.12768203f, 0.157262444f},
-std::array<float,2>{0.672500312f, 0.279967606f},
-std::array<float,2>{0.28794837f, 0.598232031f},
-std::array<float,2>{0.577758431f, 0.688311875f},
-std::array<float,2>{0.431999266f, 0.438389748f},
-std::array<float,2>{0.992930651f, 0.00186925114f},
-std::array<float,2>{0.0452275649f, 0.980757356f},
-std::array<float,2>{0.921396375f, 0.542818367f},
-std::array<float,2>{0.0879785866f, 0.345674753f},
-std::array<float,2>{0.530230939f, 0.192500293f},
-std::array<float,2>{0.487137824f, 0.794052124f},
-std::array<float,2>{0.740347326f, 0.88804698f},
-std::array<float,2>{0.318769097f, 0.11258778f},
-std::array<float,2>{0.752046287f, 0.422447413f},
-std::array<float,2>{0.233469456f, 0.627043545f},
-std::array<float,2>{0.806536376f, 0.962290883f},
-std::array<float,2>{0.19201152f, 0.0385845229f},
-std::array<float,2>{0.703537107f, 0.499376029f},
-std::array<float,2>{0.370124608f, 0.732280374f},
-std::array<float,2>{0.557695568f, 0.591302097f},
-std::array<float,2>{0.445450097f, 0.30127418f},
-std::array<float,2>{0.882532001f, 0.153675616f},
-std::array<float,2>{0.0993902013f, 0.820222855f},
-std::array<float,2>{0.9472785f, 0.673084497f},
-std::array<float,2>{0.0117252143f, 0.391138375f},
-std::array<float,2>{0.598728895f, 0.0863592923f},
-std::array<float,2>{0.402049899f, 0.91078645f},
-std::array<float,2>{0.625839233f, 0.762750924f},
-std::array<float,2>{0.268851697f, 0.224181458f},
-std::array<float,2>{0.825874388f, 0.338166416f},
-std::array<float,2>{0.159946188f, 0.50130862f},
-std::array<float,2>{0.910802841f, 0.849058568f},
-std::array<float,2>{0.0789229125f, 0.176420063f},
-std::array<float,2>{0.522824883f, 0.260821015f},
-std::array<float,2>{0.499387741f, 0.610322356f},
-std::array<float,2>{0.74858737f, 0.704795182f},
-std::array<float,2>{0.326407313f, 0.46617952f},
-std::array<float,2>{0.764926374f, 0.0245397948f},
-std::array<float,2>{0.219721273f, 0.99142611f},
-std::array<float,2>{0.845296204f, 0.553175807f},
-std::array<float,2>{0.13768813f, 0.368036062f},
-std::array<float,2>{0.684533238f, 0.207455367f},
-std::array<float,2>{0.29511562f, 0.803590715f},
-std::array<float,2>{0.569638908f, 0.899974942f},
-std::array<float,2>{0.428372025f, 0.0976029858f},
-std::array<float,2>{0.987960994f, 0.416357756f},
-std::array<float,2>{0.0359338224f, 0.649968684f},
-std::array<float,2>{0.977728605f, 0.923675597f},
-std::array<float,2>{0.0570519939f, 0.0669980869f},
-std::array<float,2>{0.583639085f, 0.375427246f},
-std::array<float,2>{0.415439934f, 0.671849072f},
-std::array<float,2>{0.662438512f, 0.527616084f},
-std::array<float,2>{0.297696859f, 0.316298336f},
-std::array<float,2>{0.862075567f, 0.247403458f},
-std::array<float,2>{0.146668926f, 0.774455488f},
-std::array<float,2>{0.769107997f, 0.745858192f},
-std::array<float,2>{0.246820182f, 0.480088741f},
-std::array<float,2>{0.727821767f, 0.0539570637f},
-std::array<float,2>{0.340225607f, 0.943447769f},
-std::array<float,2>{0.507284462f, 0.843008816f},
-std::array<float,2>{0.474450886f, 0.127668276f},
-std::array<float,2>{0.924472153f, 0.296341002f},
-std::array<float,2>{0.068208307f, 0.569469571f},
-std::array<float,2>{0.837785542f, 0.789870083f},
-std::array<float,2>{0.181623533f, 0.188095719f},
-std::array<float,2>{0.642845511f, 0.348911136f},
-std::array<float,2>{0.262276709f, 0.545647621f},
-std::array<float,2>{0.614468038f, 0.631172359f},
-std::array<float,2>{0.388399839f, 0.426959515f},
-std::array<float,2>{0.96685636f, 0.114271007f},
-std::array<float,2>{0.0193217602f, 0.8862077f},
-std::array<float,2>{0.900120318f, 0.595378697f},
-std::array<float,2>{0.11574582f, 0.27694869f},
-std::array<float,2>{0.544171751f, 0.160371929f},
-std::array<float,2>{0.460736722f, 0.87298286f},
-std::array<float,2>{0.696381748f, 0.979015887f},
-std::array<float,2>{0.357254416f, 0.00408166321f},
-std::array<float,2>{0.79081136f, 0.444231957f},
-std::array<float,2>{0.208402976f, 0.695018232f},
-std::array<float,2>{0.86833185f, 0.876779139f},
-std::array<float,2>{0.156099007f, 0.122837797f},
-std::array<float,2>{0.665588498f, 0.431249648f},
-std::array<float,2>{0.306427419f, 0.637049794f},
-std::array<float,2>{0.5878492f, 0.536719024f},
-std::array<float,2>{0.411993355f, 0.357736707f},
-std::array<float,2>{0.975046813f, 0.199308142f},
-std::array<float,2>{0.0511741675f, 0.78276366f},
-std::array<float,2>{0.932846129f, 0.699330389f},
-std::array<float,2>{0.0708208457f, 0.45054996f},
-std::array<float,2>{0.511454523f, 0.012556647f},
-std::array<float,2>{0.478634566f, 0.972917378f},
-std::array<float,2>{0.722777843f, 0.866645157f},
-std::array<float,2>{0.333622843f, 0.171535224f},
-std::array<float,2>{0.777501106f, 0.268491864f},
-std::array<float,2>{0.237015888f, 0.607953668f},
-std::array<float,2>{0.956890464f, 0.770941436f},
-std::array<float,2>{0.027554458f, 0.23723042f},
-std::array<float,2>{0.621832013f, 0.323287129f},
-std::array<float,2>{0.381199688f, 0.520823061f},
-std::array<float,2>{0.653808534f, 0.663205624f},
-std::array<float,2>{0.252592832f, 0.38453418f},
-std::array<float,2>{0.829775274f, 0.0731673017f},
-std::array<float,2>{0.173019096f, 0.930826485f},
-std::array<float,2>{0.78479743f, 0.574953735f},
-std::array<float,2>{0.216623425f, 0.284640789f},
-std::array<float,2>{0.688796878f, 0.134078443f},
-std::array<float,2>{0.347867101f, 0.831465125f},
-std::array<float,2>{0.533192694f, 0.948774517f},
-std::array<float,2>{0.462650359f, 0.0593451969f},
-std::array<float,2>{0.894507051f, 0.476455808f},
-std::array<float,2>{0.119469784f, 0.737805068f},
-std::array<float,2>{0.889164746f, 0.992190003f},
-std::array<float,2>{0.101874344f, 0.0173438396f},
-std::array<float,2>{0.55111599f, 0.453968197f},
-std::array<float,2>{0.444420248f, 0.713612139f},
-std::array<float,2>{0.712214291f, 0.617324769f},
-std::array<float,2>{0.361311436f, 0.25206241f},
-std::array<float,2>{0.798867702f, 0.180649713f},
-std::array<float,2>{0.198102653f, 0.852211416f},
-std::array<float,2>{0.814109206f, 0.647403359f},
-std::array<float,2>{0.170790985f, 0.409833372f},
-std::array<float,2>{0.633546829f, 0.108923405f},
-std::array<float,2>{0.277907431f, 0.892822146f},
-std::array<float,2>{0.605626404f, 0.810059786f},
-std::array<float,2>{0.398391813f, 0.21211578f},
-std::array<float,2>{0.942488968f, 0.361919731f},
-std::array<float,2>{0.000903342792f, 0.562029004f},
-std::array<float,2>{0.754447043f, 0.822965026f},
-std::array<float,2>{0.228059053f, 0.142148569f},
-std::array<float,2>{0.738090038f, 0.310298681f},
-std::array<float,2>{0.314069122f, 0.583231986f},
-std::array<float,2>{0.525280356f, 0.721998096f},
-std::array<float,2>{0.488618851f, 0.48833397f},
-std::array<float,2>{0.917657435f, 0.0459514633f},
-std::array<float,2>{0.0921919867f, 0.954737723f},
-std::array<float,2>{0.998378932f, 0.51346612f},
-std::array<float,2>{0.0406622291f, 0.333842218f},
-std::array<float,2>{0.571863294f, 0.231279522f},
-std::array<float,2>{0.434050977f, 0.754900396f},
-std::array<float,2>{0.676930785f, 0.914862156f},
-std::array<float,2>{0.284180909f, 0.0813080072f},
-std::array<float,2>{0.852450788f, 0.404869139f},
-std::array<float,2>{0.130651146f, 0.687488914f},
-std::array<float,2>{0.847967446f, 0.952794969f},
-std::array<float,2>{0.13465929f, 0.0559991263f},
-std::array<float,2>{0.679835856f, 0.471736223f},
-std::array<float,2>{0.291411579f, 0.739857197f},
-std::array<float,2>{0.564351797f, 0.573952675f},
-std::array<float,2>{0.424136549f, 0.285461903f},
-std::array<float,2>{0.989598274f, 0.137305006f},
-std::array<float,2>{0.0332476422f, 0.833837569f},
-std::array<float,2>{0.906396031f, 0.658516407f},
-std::array<float,2>{0.0855509341f, 0.389557451f},
-std::array<float,2>{0.518032789f, 0.0779309049f},
-std::array<float,2>{0.495138735f, 0.936989129f},
-std::array<float,2>{0.745348036f, 0.768025339f},
-std::array<float,2>{0.323555917f, 0.241646513f},
-std::array<float,2>{0.761400521f, 0.327790469f},
-std::array<float,2>{0.225614056f, 0.518518507f},
-std::array<float,2>{0.951156914f, 0.863160729f},
-std::array<float,2>{0.0095734559f, 0.165225506f},
-std::array<float,2>{0.596080184f, 0.27326104f},
-std::array<float,2>{0.403767049f, 0.603423059f},
-std::array<float,2>{0.631008923f, 0.696265817f},
-std::array<float,2>{0.270633548f, 0.448847532f},
-std::array<float,2>{0.821139336f, 0.00839511584f},
-std::array<float,2>{0.163207248f, 0.968849659f},
-std::array<float,2>{0.810130835f, 0.532937944f},
-std::array<float,2>{0.188080236f, 0.354893953f},
-std::array<float,2>{0.707644343f, 0.197856694f},
-std::array<float,2>{0.372404814f, 0.785706997f},
-std::array<float,2>{0.560086787f, 0.881435156f},
-std::array<float,2>{0.450704873f, 0.118520804f},
-std::array<float,2>{0.87734288f, 0.43475318f},
-std::array<float,2>{0.093933396f, 0.635550022f},
-std::array<float,2>{0.902552426f, 0.91977942f},
-std::array<float,2>{0.113203593f, 0.0829318985f},
-std::array<float,2>{0.540305734f, 0.401435852f},
-std::array<float,2>{0.455486357f, 0.681516349f},
-std::array<float,2>{0.700208247f, 0.510933995f},
-std::array<float,2>{0.352722257f, 0.330172926f},
-std::array<float,2>{0.793308079f, 0.229280099f},
-std::array<float,2>{0.204466566f, 0.752072155f},
-std::array<float,2>{0.84076035f, 0.725754201f},
-std::array<float,2>{0.184243783f, 0.487759084f},
-std::array<float,2>{0.645951867f, 0.0398403741f},
-std::array<float,2>{0.259177625f, 0.95729959f},
-std::array<float,2>{0.610022008f, 0.826072335f},
-std::array<float,2>{0.384356678f, 0.146095112f},
-std::array<float,2>{0.962790966f, 0.306654572f},
-std::array<float,2>{0.020808747f, 0.580979645f},
-std::array<float,2>{0.772687435f, 0.806554854f},
-std::array<float,2>{0.24560523f, 0.216932774f},
-std::array<float,2>{0.732104957f, 0.36520654f},
-std::array<float,2>{0.337607026f, 0.557351053f},
-std::array<float,2>{0.502604187f, 0.642288029f},
-std::array<float,2>{0.470582724f, 0.412501395f},
-std::array<float,2>{0.927808762f, 0.1035337f},
-std::array<float,2>{0.0635643154f, 0.897678673f},
-std::array<float,2>{0.983306289f, 0.622976422f},
-std::array<float,2>{0.0595266931f, 0.255463868f},
-std::array<float,2>{0.581579208f, 0.185761407f},
-std::array<float,2>{0.420312911f, 0.857425213f},
-std::array<float,2>{0.659579754f, 0.997215271f},
-std::array<float,2>{0.303874165f, 0.0230883081f},
-std::array<float,2>{0.864545047f, 0.459777057f},
-std::array<float,2>{0.141393542f, 0.716917694f},
-std::array<float,2>{0.78701365f, 0.903423309f},
-std::array<float,2>{0.213872269f, 0.0989330113f},
-std::array<float,2>{0.694703996f, 0.420852929f},
-std::array<float,2>{0.345474899f, 0.652895212f},
-std::array<float,2>{0.53585434f, 0.54947871f},
-std::array<float,2>{0.465502322f, 0.373230189f},
-std::array<float,2>{0.895650446f, 0.206545398f},
-std::array<float,2>{0.12340489f, 0.8001827f},
-std::array<float,2>{0.957306325f, 0.709987581f},
-std::array<float,2>{0.0254484881f, 0.464561194f},
-std::array<float,2>{0.617228091f, 0.028586844f},
-std::array<float,2>{0.378581882f, 0.987716734f},
-std::array<float,2>{0.652086735f, 0.847003281f},
-std::array<float,2>{0.255634636f, 0.175715491f},
-std::array<float,2>{0.833454907f, 0.265317202f},
-std::array<float,2>{0.178106934f, 0.613671899f},
-std::array<float,2>{0.933818161f, 0.758300066f},
-std::array<float,2>{0.0760778338f, 0.220338151f},
-std::array<float,2>{0.513052583f, 0.343146414f},
-std::array<float,2>{0.480639368f, 0.504453599f},
-std::array<float,2>{0.721694112f, 0.678027809f},
-std::array<float,2>{0.330115139f, 0.395121068f},
-std::array<float,2>{0.776045501f, 0.0921777859f},
-std::array<float,2>{0.238524333f, 0.907844007f},
-std::array<float,2>{0.87466222f, 0.586284041f},
-std::array<float,2>{0.148462206f, 0.29722029f},
-std::array<float,2>{0.671152592f, 0.151482031f},
-std::array<float,2>{0.309341073f, 0.816231191f},
-std::array<float,2>{0.590725482f, 0.966780603f},
-std::array<float,2>{0.410102636f, 0.034828607f},
-std::array<float,2>{0.970147431f, 0.494185865f},
-std::array<float,2>{0.0504054911f, 0.730250835f},
-std::array<float,2>{0.995419383f, 0.984001637f},
-std::array<float,2>{0.043153543f, 0.00278994814f},
-std::array<float,2>{0.574430168f, 0.439895451f},
-std::array<float,2>{0.430192053f, 0.690717161f},
-std::array<float,2>{0.674486816f, 0.601048708f},
-std::array<float,2>{0.286367059f, 0.278842658f},
-std::array<float,2>{0.856322765f, 0.158785343f},
-std::array<float,2>{0.126098007f, 0.869048417f},
-std::array<float,2>{0.750838637f, 0.626519501f},
-std::array<float,2>{0.232099444f, 0.424530029f},
-std::array<float,2>{0.740227103f, 0.110770389f},
-std::array<float,2>{0.316869676f, 0.890452147f},
-std::array<float,2>{0.528145969f, 0.795570612f},
-std::array<float,2>{0.484567225f, 0.193513736f},
-std::array<float,2>{0.918983877f, 0.347544163f},
-std::array<float,2>{0.0862451196f, 0.539379299f},
-std::array<float,2>{0.816967964f, 0.836211443f},
-std::array<float,2>{0.165050343f, 0.130962774f},
-std::array<float,2>{0.637509227f, 0.292014927f},
-std::array<float,2>{0.275818139f, 0.563492f},
-std::array<float,2>{0.602781415f, 0.747965574f},
-std::array<float,2>{0.391149849f, 0.484081268f},
-std::array<float,2>{0.938942075f, 0.0504677184f},
-std::array<float,2>{0.00419819169f, 0.937892795f},
-std::array<float,2>{0.886295855f, 0.525826871f},
-std::array<float,2>{0.10629715f, 0.31975463f},
-std::array<float,2>{0.549264193f, 0.24605304f},
-std::array<float,2>{0.440660179f, 0.779837847f},
-std::array<float,2>{0.718498588f, 0.928169429f},
-std::array<float,2>{0.365043908f, 0.0641684905f},
-std::array<float,2>{0.803891599f, 0.380176991f},
-std::array<float,2>{0.202807382f, 0.666312039f},
-std::array<float,2>{0.762095094f, 0.989532948f},
-std::array<float,2>{0.221700072f, 0.0263071693f},
-std::array<float,2>{0.746236563f, 0.466916651f},
-std::array<float,2>{0.325344354f, 0.705851376f},
-std::array<float,2>{0.52078104f, 0.613079488f},
-std::array<float,2>{0.497443855f, 0.259426206f},
-std::array<float,2>{0.913117588f, 0.178533062f},
-std::array<float,2>{0.0804074779f, 0.850168645f},
-std::array<float,2>{0.98592639f, 0.651136398f},
-std::array<float,2>{0.0380069502f, 0.415121049f},
-std::array<float,2>{0.566586673f, 0.0940064415f},
-std::array<float,2>{0.42604211f, 0.90039736f},
-std::array<float,2>{0.686799526f, 0.80247134f},
-std::array<float,2>{0.294079036f, 0.210488856f},
-std::array<float,2>{0.847064912f, 0.370611191f},
-std::array<float,2>{0.139616936f, 0.55159688f},
-std::array<float,2>{0.8803702f, 0.817739367f},
-std::array<float,2>{0.101008557f, 0.155750871f},
-std::array<float,2>{0.555326998f, 0.302894115f},
-std::array<float,2>{0.448236108f, 0.592620075f},
-std::array<float,2>{0.706199646f, 0.73340857f},
-std::array<float,2>{0.368810773f, 0.496876419f},
-std::array<float,2>{0.808382213f, 0.0364326909f},
-std::array<float,2>{0.193708062f, 0.963594079f},
-std::array<float,2>{0.826527834f, 0.502344787f},
-std::array<float,2>{0.157351702f, 0.337107956f},
-std::array<float,2>{0.627866626f, 0.225278273f},
-std::array<float,2>{0.265968978f, 0.764350891f},
-std::array<float,2>{0.600942969f, 0.91284591f},
-std::array<float,2>{0.400222629f, 0.0894861966f},
-std::array<float,2>{0.946470559f, 0.394408584f},
-std::array<float,2>{0.0145115387f, 0.673978031f},
-std::array<float,2>{0.966075003f, 0.8834306f},
-std::array<float,2>{0.0159221105f, 0.117149577f},
-std::array<float,2>{0.615538955f, 0.428150147f},
-std::array<float,2>{0.389930636f, 0.629759371f},
-std::array<float,2>{0.64236331f, 0.544318497f},
-std::array<float,2>{0.265193045f, 0.351224899f},
-std::array<float,2>{0.839373887f, 0.189995095f},
-std::array<float,2>{0.183466032f, 0.791663826f},
-std::array<float,2>{0.79125011f, 0.691998005f},
-std::array<float,2>{0.210693866f, 0.443234861f},
-std::array<float,2>{0.697667837f, 0.00704166945f},
-std::array<float,2>{0.358068943f, 0.977405131f},
-std::array<float,2>{0.54659611f, 0.873430431f},
-std::array<float,2>{0.458871335f, 0.163932085f},
-std::array<float,2>{0.900614798f, 0.274181068f},
-std::array<float,2>{0.11388047f, 0.59641391f},
-std::array<float,2>{0.859909654f, 0.776297688f},
-std::array<float,2>{0.145256341f, 0.248355821f},
-std::array<float,2>{0.661401153f, 0.31376189f},
-std::array<float,2>{0.300770074f, 0.530153155f},
-std::array<float,2>{0.584167063f, 0.668527067f},
-std::array<float,2>{0.416058272f, 0.378534079f},
-std::array<float,2>{0.978962302f, 0.0691155642f},
-std::array<float,2>{0.0563615412f, 0.925216615f},
-std::array<float,2>{0.923201859f, 0.567623734f},
-std::array<float,2>{0.0700907931f, 0.293109715f},
-std::array<float,2>{0.504661441f, 0.126746416f},
-std::array<float,2>{0.475701988f, 0.841480255f},
-std::array<float,2>{0.729053557f, 0.941846311f},
-std::array<float,2>{0.342001021f, 0.0523705818f},
-std::array<float,2>{0.766485631f, 0.476886749f},
-std::array<float,2>{0.249011859f, 0.743940771f},
-std::array<float,2>{0.831780851f, 0.931738198f},
-std::array<float,2>{0.175033778f, 0.0709841028f},
-std::array<float,2>{0.655832052f, 0.386257499f},
-std::array<float,2>{0.250695586f, 0.661191523f},
-std::array<float,2>{0.624323249f, 0.522006094f},
-std::array<float,2>{0.380514592f, 0.322244644f},
-std::array<float,2>{0.954965174f, 0.235413402f},
-std::array<float,2>{0.0305472463f, 0.773331523f},
-std::array<float,2>{0.89094913f, 0.735219896f},
-std::array<float,2>{0.118060753f, 0.47367689f},
-std::array<float,2>{0.534902453f, 0.0614777543f},
-std::array<float,2>{0.464302391f, 0.946943462f},
-std::array<float,2>{0.690677285f, 0.829215407f},
-std::array<float,2>{0.350357533f, 0.135709107f},
-std::array<float,2>{0.781307697f, 0.282235295f},
-std::array<float,2>{0.216906816f, 0.577430904f},
-std::array<float,2>{0.973890305f, 0.783661187f},
-std::array<float,2>{0.0536660552f, 0.202220485f},
-std::array<float,2>{0.588304579f, 0.35697341f},
-std::array<float,2>{0.413569421f, 0.538367391f},
-std::array<float,2>{0.666047394f, 0.640471816f},
-std::array<float,2>{0.306687027f, 0.431838274f},
-std::array<float,2>{0.87105155f, 0.124588586f},
-std::array<float,2>{0.15252459f, 0.877815068f},
-std::array<float,2>{0.779353619f, 0.606359839f},
-std::array<float,2>{0.235468149f, 0.266081691f},
-std::array<float,2>{0.726291418f, 0.168381184f},
-std::array<float,2>{0.335571647f, 0.863630772f},
-std::array<float,2>{0.508882105f, 0.976055086f},
-std::array<float,2>{0.476627111f, 0.0149635365f},
-std::array<float,2>{0.930032313f, 0.45131132f},
-std::array<float,2>{0.0729036406f, 0.701865137f},
-std::array<float,2>{0.915739834f, 0.956810713f},
-std::array<float,2>{0.0916221514f, 0.0445187278f},
-std::array<float,2>{0.526873648f, 0.491275012f},
-std::array<float,2>{0.4902578f, 0.718979776f},
-std::array<float,2>{0.735733807f, 0.584573448f},
-std::array<float,2>{0.31614849f, 0.311408013f},
-std::array<float,2>{0.756075203f, 0.142681822f},
-std::array<float,2>{0.229649365f, 0.821473956f},
-std::array<float,2>{0.855441391f, 0.685037017f},
-std::array<float,2>{0.132630214f, 0.403767884f},
-std::array<float,2>{0.679125071f, 0.0798994377f},
-std::array<float,2>{0.281732142f, 0.917673647f},
-std::array<float,2>{0.573544264f, 0.757089436f},
-std::array<float,2>{0.435645014f, 0.232918084f},
-std::array<float,2>{0.996887028f, 0.335074067f},
-std::array<float,2>{0.0420103408f, 0.514848173f},
-std::array<float,2>{0.796878576f, 0.855413377f},
-std::array<float,2>{0.195569083f, 0.182475969f},
-std::array<float,2>{0.714158893f, 0.250501245f},
-std::array<float,2>{0.361955762f, 0.619409859f},
-std::array<float,2>{0.55314517f, 0.712425292f},
-std::array<float,2>{0.44220984f, 0.455913574f},
-std::array<float,2>{0.887591958f, 0.0180627555f},
-std::array<float,2>{0.105388746f, 0.995634258f},
-std::array<float,2>{0.944731236f, 0.559741676f},
-std::array<float,2>{0.00296305423f, 0.360373408f},
-std::array<float,2>{0.60922116f, 0.214189395f},
-std::array<float,2>{0.394664258f, 0.811689496f},
-std::array<float,2>{0.634954929f, 0.892440319f},
-std::array<float,2>{0.280238986f, 0.107224293f},
-std::array<float,2>{0.815879047f, 0.407609046f},
-std::array<float,2>{0.169726059f, 0.646055043f},
-std::array<float,2>{0.855508745f, 0.981258154f},
-std::array<float,2>{0.126820207f, 0.000977888587f},
-std::array<float,2>{0.673838079f, 0.4379583f},
-std::array<float,2>{0.286851168f, 0.687663734f},
-std::array<float,2>{0.574875236f, 0.597971141f},
-std::array<float,2>{0.430011094f, 0.279412717f},
-std::array<float,2>{0.995775402f, 0.15791963f},
-std::array<float,2>{0.0439220034f, 0.870828807f},
-std::array<float,2>{0.919787526f, 0.627768815f},
-std::array<float,2>{0.0866199136f, 0.422180474f},
-std::array<float,2>{0.527668774f, 0.112973534f},
-std::array<float,2>{0.485262245f, 0.888557255f},
-std::array<float,2>{0.739636302f, 0.794758499f},
-std::array<float,2>{0.317339063f, 0.192955077f},
-std::array<float,2>{0.750180125f, 0.345039576f},
-std::array<float,2>{0.231927291f, 0.542227566f},
-std::array<float,2>{0.939009011f, 0.838238716f},
-std::array<float,2>{0.00460262736f, 0.130371571f},
-std::array<float,2>{0.60343945f, 0.289224118f},
-std::array<float,2>{0.390971065f, 0.565788746f},
-std::array<float,2>{0.636977255f, 0.749758005f},
-std::array<float,2>{0.276338518f, 0.481831759f},
-std::array<float,2>{0.816788495f, 0.0476268269f},
-std::array<float,2>{0.165660992f, 0.940067947f},
-std::array<float,2>{0.804320514f, 0.524454117f},
-std::array<float,2>{0.202295631f, 0.317628413f},
-std::array<float,2>{0.717828691f, 0.242976487f},
-std::array<float,2>{0.364449352f, 0.77746439f},
-std::array<float,2>{0.549434245f, 0.926912844f},
-std::array<float,2>{0.44097051f, 0.0656214952f},
-std::array<float,2>{0.886196554f, 0.380969107f},
-std::array<float,2>{0.105824448f, 0.664359808f},
-std::array<float,2>{0.896325231f, 0.906067193f},
-std::array<float,2>{0.123907872f, 0.100110799f},
-std::array<float,2>{0.535199106f, 0.419211537f},
-std::array<float,2>{0.46485582f, 0.655645013f},
-std::array<float,2>{0.694893062f, 0.548628509f},
-std::array<float,2>{0.345062315f, 0.372381121f},
-std::array<float,2>{0.786357403f, 0.203844547f},
-std::array<float,2>{0.214482218f, 0.797255337f},
-std::array<float,2>{0.833725154f, 0.708023667f},
-std::array<float,2>{0.178401336f, 0.462460756f},
-std::array<float,2>{0.651740253f, 0.0301242638f},
-std::array<float,2>{0.254959106f, 0.984525144f},
-std::array<float,2>{0.617726505f, 0.84415853f},
-std::array<float,2>{0.37827912f, 0.172782868f},
-std::array<float,2>{0.957531095f, 0.261806935f},
-std::array<float,2>{0.0259684902f, 0.617091119f},
-std::array<float,2>{0.77570051f, 0.761706293f},
-std::array<float,2>{0.239123106f, 0.221116722f},
-std::array<float,2>{0.722466826f, 0.341643631f},
-std::array<float,2>{0.330815047f, 0.506478608f},
-std::array<float,2>{0.51349932f, 0.677082241f},
-std::array<float,2>{0.481203765f, 0.397875398f},
-std::array<float,2>{0.934121728f, 0.091308631f},
-std::array<float,2>{0.0754279122f, 0.909925759f},
-std::array<float,2>{0.970309019f, 0.589069486f},
-std::array<float,2>{0.0502436347f, 0.299193084f},
-std::array<float,2>{0.590285718f, 0.148521289f},
-std::array<float,2>{0.409538478f, 0.813326597f},
-std::array<float,2>{0.671408951f, 0.96768707f},
-std::array<float,2>{0.308640093f, 0.0324999169f},
-std::array<float,2>{0.874059796f, 0.492571652f},
-std::array<float,2>{0.149384513f, 0.728435099f},
-std::array<float,2>{0.793874204f, 0.920114696f},
-std::array<float,2>{0.204987913f, 0.085057728f},
-std::array<float,2>{0.70089525f, 0.399768829f},
-std::array<float,2>{0.353316098f, 0.683220685f},
-std::array<float,2>{0.540839374f, 0.508835316f},
-std::array<float,2>{0.455836654f, 0.32848534f},
-std::array<float,2>{0.903015494f, 0.227652326f},
-std::array<float,2>{0.112701058f, 0.751520455f},
-std::array<float,2>{0.962349832f, 0.723342657f},
-std::array<float,2>{0.0211522058f, 0.486192793f},
-std::array<float,2>{0.609381199f, 0.0412517115f},
-std::array<float,2>{0.383936733f, 0.960675299f},
-std::array<float,2>{0.646053374f, 0.827591121f},
-std::array<float,2>{0.259396225f, 0.146720842f},
-std::array<float,2>{0.839874089f, 0.306240171f},
-std::array<float,2>{0.184072241f, 0.579513669f},
-std::array<float,2>{0.928548276f, 0.807044446f},
-std::array<float,2>{0.0642026588f, 0.216513395f},
-std::array<float,2>{0.502111614f, 0.365282148f},
-std::array<float,2>{0.469966084f, 0.55624485f},
-std::array<float,2>{0.731502593f, 0.644382894f},
-std::array<float,2>{0.337250888f, 0.411349148f},
-std::array<float,2>{0.773058176f, 0.10348253f},
-std::array<float,2>{0.246031389f, 0.895032823f},
-std::array<float,2>{0.864967942f, 0.623958766f},
-std::array<float,2>{0.140865669f, 0.256165415f},
-std::array<float,2>{0.659840167f, 0.185516432f},
-std::array<float,2>{0.304296434f, 0.856113315f},
-std::array<float,2>{0.581506252f, 0.999309003f},
-std::array<float,2>{0.420835286f, 0.0198314264f},
-std::array<float,2>{0.982607305f, 0.457384497f},
-std::array<float,2>{0.0590789802f, 0.716482639f},
-std::array<float,2>{0.990065336f, 0.949546874f},
-std::array<float,2>{0.0337901339f, 0.0575669818f},
-std::array<float,2>{0.563562214f, 0.469227284f},
-std::array<float,2>{0.424410105f, 0.741795182f},
-std::array<float,2>{0.680379331f, 0.571319818f},
-std::array<float,2>{0.291597992f, 0.288516372f},
-std::array<float,2>{0.848405004f, 0.138872668f},
-std::array<float,2>{0.133869708f, 0.835400879f},
-std::array<float,2>{0.761205375f, 0.657827079f},
-std::array<float,2>{0.22628504f, 0.387191474f},
-std::array<float,2>{0.74598664f, 0.0758754835f},
-std::array<float,2>{0.324030995f, 0.935476005f},
-std::array<float,2>{0.518286347f, 0.767171264f},
-std::array<float,2>{0.495855153f, 0.239483431f},
-std::array<float,2>{0.906821966f, 0.325346112f},
-std::array<float,2>{0.0852879807f, 0.516508579f},
-std::array<float,2>{0.820601344f, 0.860766947f},
-std::array<float,2>{0.163725987f, 0.167174622f},
-std::array<float,2>{0.631567955f, 0.270024598f},
-std::array<float,2>{0.271229953f, 0.603607535f},
-std::array<float,2>{0.596624076f, 0.697416008f},
-std::array<float,2>{0.404273152f, 0.447151095f},
-std::array<float,2>{0.950386584f, 0.0112667428f},
-std::array<float,2>{0.00904490892f, 0.972004354f},
-std::array<float,2>{0.877497852f, 0.534785807f},
-std::array<float,2>{0.0944933295f, 0.352907479f},
-std::array<float,2>{0.559710383f, 0.195396394f},
-std::array<float,2>{0.450402111f, 0.787468791f},
-std::array<float,2>{0.707513988f, 0.879024208f},
-std::array<float,2>{0.372863412f, 0.119292527f},
-std::array<float,2>{0.809799016f, 0.436910272f},
-std::array<float,2>{0.187564641f, 0.63346684f},
-std::array<float,2>{0.756803691f, 0.95422864f},
-std::array<float,2>{0.230060205f, 0.0464192033f},
-std::array<float,2>{0.736127317f, 0.488864064f},
-std::array<float,2>{0.315874159f, 0.722377598f},
-std::array<float,2>{0.526694417f, 0.583913028f},
-std::array<float,2>{0.49078238f, 0.309802294f},
-std::array<float,2>{0.915206432f, 0.141970679f},
-std::array<float,2>{0.0912244096f, 0.822412193f},
-std::array<float,2>{0.996186018f, 0.686953068f},
-std::array<float,2>{0.042731747f, 0.404300869f},
-std::array<float,2>{0.57403332f, 0.0820280984f},
-std::array<float,2>{0.436419576f, 0.914131939f},
-std::array<float,2>{0.679399192f, 0.755463898f},
-std::array<float,2>{0.281806558f, 0.230707794f},
-std::array<float,2>{0.854513049f, 0.333148628f},
-std::array<float,2>{0.132272109f, 0.512842834f},
-std::array<float,2>{0.886817515f, 0.851681411f},
-std::array<float,2>{0.104801945f, 0.17996788f},
-std::array<float,2>{0.553468347f, 0.252505451f},
-std::array<float,2>{0.44163397f, 0.618084788f},
-std::array<float,2>{0.714608133f, 0.713291109f},
-std::array<float,2>{0.361556739f, 0.453494668f},
-std::array<float,2>{0.797789514f, 0.0169944391f},
-std::array<float,2>{0.1959939f, 0.992948115f},
-std::array<float,2>{0.816222966f, 0.561908305f},
-std::array<float,2>{0.169249088f, 0.361648053f},
-std::array<float,2>{0.635372043f, 0.212799743f},
-std::array<float,2>{0.27975437f, 0.809656501f},
-std::array<float,2>{0.608546615f, 0.893158853f},
-std::array<float,2>{0.395406812f, 0.108544379f},
-std::array<float,2>{0.945024252f, 0.409227192f},
-std::array<float,2>{0.00372884655f, 0.64675045f},
-std::array<float,2>{0.954481483f, 0.931492329f},
-std::array<float,2>{0.031091664f, 0.0725234747f},
-std::array<float,2>{0.6246925f, 0.384042174f},
-std::array<float,2>{0.380213201f, 0.663839042f},
-std::array<float,2>{0.655327022f, 0.521070004f},
-std::array<float,2>{0.250315219f, 0.32411617f},
-std::array<float,2>{0.831480324f, 0.236454204f},
-std::array<float,2>{0.175426155f, 0.77100271f},
-std::array<float,2>{0.781751931f, 0.737648487f},
-std::array<float,2>{0.217453703f, 0.475860715f},
-std::array<float,2>{0.691378891f, 0.0587221421f},
-std::array<float,2>{0.349620104f, 0.948565245f},
-std::array<float,2>{0.534285247f, 0.831849158f},
-std::array<float,2>{0.464383185f, 0.134609893f},
-std::array<float,2>{0.891384721f, 0.284733444f},
-std::array<float,2>{0.117357448f, 0.574508131f},
-std::array<float,2>{0.870155454f, 0.782371998f},
-std::array<float,2>{0.152893767f, 0.200096577f},
-std::array<float,2>{0.666872382f, 0.358122677f},
-std::array<float,2>{0.307332307f, 0.536232352f},
-std::array<float,2>{0.588739991f, 0.637258053f},
-std::array<float,2>{0.413633913f, 0.431003392f},
-std::array<float,2>{0.974497616f, 0.122475445f},
-std::array<float,2>{0.0528239571f, 0.876381397f},
-std::array<float,2>{0.930634856f, 0.60788393f},
-std::array<float,2>{0.0724821463f, 0.26765734f},
-std::array<float,2>{0.509646356f, 0.171094596f},
-std::array<float,2>{0.477490962f, 0.8671453f},
-std::array<float,2>{0.725792944f, 0.973211169f},
-std::array<float,2>{0.335169017f, 0.0121321408f},
-std::array<float,2>{0.780026257f, 0.450832129f},
-std::array<float,2>{0.236130938f, 0.699998498f},
-std::array<float,2>{0.839226842f, 0.886691511f},
-std::array<float,2>{0.183029681f, 0.114919342f},
-std::array<float,2>{0.641939878f, 0.427578241f},
-std::array<float,2>{0.264782757f, 0.631605625f},
-std::array<float,2>{0.615986228f, 0.545156598f},
-std::array<float,2>{0.390163451f, 0.349472791f},
-std::array<float,2>{0.966363609f, 0.187956586f},
-std::array<float,2>{0.0164025407f, 0.789249003f},
-std::array<float,2>{0.901198804f, 0.694589317f},
-std::array<float,2>{0.113621846f, 0.443740219f},
-std::array<float,2>{0.546239257f, 0.0044914661f},
-std::array<float,2>{0.458140731f, 0.978924453f},
-std::array<float,2>{0.698061466f, 0.872260988f},
-std::array<float,2>{0.35776484f, 0.161085144f},
-std::array<float,2>{0.791964889f, 0.276747614f},
-std::array<float,2>{0.210178554f, 0.594924927f},
-std::array<float,2>{0.979044855f, 0.775224149f},
-std::array<float,2>{0.0557184704f, 0.247848839f},
-std::array<float,2>{0.584534168f, 0.315673739f},
-std::array<float,2>{0.416871399f, 0.528281152f},
-std::array<float,2>{0.662101746f, 0.671310544f},
-std::array<float,2>{0.299817085f, 0.375545144f},
-std::array<float,2>{0.859848261f, 0.0668863803f},
-std::array<float,2>{0.144941062f, 0.922929227f},
-std::array<float,2>{0.765708864f, 0.570156395f},
-std::array<float,2>{0.24845238f, 0.296738178f},
-std::array<float,2>{0.728581667f, 0.127112463f},
-std::array<float,2>{0.342586905f, 0.84359771f},
-std::array<float,2>{0.504095793f, 0.943958104f},
-std::array<float,2>{0.476128191f, 0.0543249361f},
-std::array<float,2>{0.923723817f, 0.479974806f},
-std::array<float,2>{0.0694479793f, 0.745263755f},
-std::array<float,2>{0.913643301f, 0.991790116f},
-std::array<float,2>{0.0805955827f, 0.0251830332f},
-std::array<float,2>{0.521016121f, 0.46646744f},
-std::array<float,2>{0.497562736f, 0.704203069f},
-std::array<float,2>{0.746852815f, 0.609783947f},
-std::array<float,2>{0.326093018f, 0.261334002f},
-std::array<float,2>{0.762603462f, 0.176054284f},
-std::array<float,2>{0.222267181f, 0.849299908f},
-std::array<float,2>{0.847352386f, 0.649688959f},
-std::array<float,2>{0.13876006f, 0.416595131f},
-std::array<float,2>{0.687443852f, 0.0969836488f},
-std::array<float,2>{0.294709563f, 0.899429142f},
-std::array<float,2>{0.566984832f, 0.802762568f},
-std::array<float,2>{0.426473767f, 0.208002657f},
-std::array<float,2>{0.985829949f, 0.367412269f},
-std::array<float,2>{0.0372619331f, 0.553243995f},
-std::array<float,2>{0.807681441f, 0.819805264f},
-std::array<float,2>{0.19409512f, 0.154083341f},
-std::array<float,2>{0.706676424f, 0.301032245f},
-std::array<float,2>{0.368553847f, 0.591513216f},
-std::array<float,2>{0.554989934f, 0.73152107f},
-std::array<float,2>{0.447280526f, 0.499800295f},
-std::array<float,2>{0.880401433f, 0.0382823311f},
-std::array<float,2>{0.101128221f, 0.962889373f},
-std::array<float,2>{0.946933568f, 0.501567841f},
-std::array<float,2>{0.0136859557f, 0.338388532f},
-std::array<float,2>{0.601241827f, 0.224021375f},
-std::array<float,2>{0.39959836f, 0.763392329f},
-std::array<float,2>{0.626997173f, 0.91062659f},
-std::array<float,2>{0.266270161f, 0.086772874f},
-std::array<float,2>{0.826808035f, 0.390980422f},
-std::array<float,2>{0.157827854f, 0.673588634f},
-std::array<float,2>{0.819081604f, 0.938243568f},
-std::array<float,2>{0.166298315f, 0.0500114188f},
-std::array<float,2>{0.639339209f, 0.483873218f},
-std::array<float,2>{0.273767769f, 0.747438431f},
-std::array<float,2>{0.604687274f, 0.564394176f},
-std::array<float,2>{0.394425839f, 0.292856604f},
-std::array<float,2>{0.940513372f, 0.131379008f},
-std::array<float,2>{0.00613606302f, 0.836453438f},
-std::array<float,2>{0.8842538f, 0.66663599f},
-std::array<float,2>{0.107833639f, 0.380451679f},
-std::array<float,2>{0.548785388f, 0.0639350191f},
-std::array<float,2>{0.437926769f, 0.92847681f},
-std::array<float,2>{0.716066599f, 0.779609501f},
-std::array<float,2>{0.366192669f, 0.245526671f},
-std::array<float,2>{0.800966382f, 0.320179641f},
-std::array<float,2>{0.200128585f, 0.526039958f},
-std::array<float,2>{0.992413819f, 0.868563414f},
-std::array<float,2>{0.0457406044f, 0.158625424f},
-std::array<float,2>{0.577245653f, 0.278518528f},
-std::array<float,2>{0.432613015f, 0.601286292f},
-std::array<float,2>{0.672092259f, 0.69111532f},
-std::array<float,2>{0.287168145f, 0.440176189f},
-std::array<float,2>{0.858034253f, 0.00221635937f},
-std::array<float,2>{0.12740688f, 0.983734965f},
-std::array<float,2>{0.752528131f, 0.539964378f},
-std::array<float,2>{0.234024778f, 0.346971571f},
-std::array<float,2>{0.741133869f, 0.194085941f},
-std::array<float,2>{0.319008559f, 0.795141637f},
-std::array<float,2>{0.529454291f, 0.889743209f},
-std::array<float,2>{0.486659557f, 0.110963851f},
-std::array<float,2>{0.921013474f, 0.424041033f},
-std::array<float,2>{0.0888023525f, 0.625983953f},
-std::array<float,2>{0.935861766f, 0.907390594f},
-std::array<float,2>{0.0771928355f, 0.0926385447f},
-std::array<float,2>{0.514480233f, 0.394542962f},
-std::array<float,2>{0.483608991f, 0.678440154f},
-std::array<float,2>{0.720057011f, 0.503906846f},
-std::array<float,2>{0.328576028f, 0.343705386f},
-std::array<float,2>{0.775155067f, 0.220119074f},
-std::array<float,2>{0.240265921f, 0.758451879f},
-std::array<float,2>{0.871509194f, 0.729905665f},
-std::array<float,2>{0.151844129f, 0.494852632f},
-std::array<float,2>{0.668874323f, 0.0345998593f},
-std::array<float,2>{0.311603099f, 0.96624583f},
-std::array<float,2>{0.592113912f, 0.815619051f},
-std::array<float,2>{0.407627821f, 0.151893064f},
-std::array<float,2>{0.971440792f, 0.297836095f},
-std::array<float,2>{0.047010757f, 0.58650142f},
-std::array<float,2>{0.788110733f, 0.800717711f},
-std::array<float,2>{0.211032331f, 0.206175566f},
-std::array<float,2>{0.693110526f, 0.37357226f},
-std::array<float,2>{0.347483724f, 0.549049616f},
-std::array<float,2>{0.538860261f, 0.652469575f},
-std::array<float,2>{0.46749723f, 0.419971257f},
-std::array<float,2>{0.896928608f, 0.0991325304f},
-std::array<float,2>{0.122427166f, 0.903953671f},
-std::array<float,2>{0.959212065f, 0.613967001f},
-std::array<float,2>{0.0238267407f, 0.265033782f},
-std::array<float,2>{0.620702446f, 0.174950272f},
-std::array<float,2>{0.376664937f, 0.847208798f},
-std::array<float,2>{0.649472833f, 0.988191724f},
-std::array<float,2>{0.257657766f, 0.028975172f},
-std::array<float,2>{0.834298909f, 0.464174241f},
-std::array<float,2>{0.177077293f, 0.710701108f},
-std::array<float,2>{0.770136595f, 0.898386598f},
-std::array<float,2>{0.242402494f, 0.104390062f},
-std::array<float,2>{0.733156621f, 0.412696213f},
-std::array<float,2>{0.338026911f, 0.642033994f},
-std::array<float,2>{0.501887918f, 0.556902289f},
-std::array<float,2>{0.472441018f, 0.36452359f},
-std::array<float,2>{0.926375866f, 0.217574105f},
-std::array<float,2>{0.0664039329f, 0.806146145f},
-std::array<float,2>{0.982020319f, 0.717561185f},
-std::array<float,2>{0.0614153259f, 0.459176153f},
-std::array<float,2>{0.578134835f, 0.0225652754f},
-std::array<float,2>{0.418158501f, 0.998039305f},
-std::array<float,2>{0.657492101f, 0.857912958f},
-std::array<float,2>{0.302027225f, 0.186221331f},
-std::array<float,2>{0.866354048f, 0.25523144f},
-std::array<float,2>{0.142653257f, 0.622450709f},
-std::array<float,2>{0.9050951f, 0.752919972f},
-std::array<float,2>{0.109498501f, 0.228727102f},
-std::array<float,2>{0.542161703f, 0.330690145f},
-std::array<float,2>{0.454818517f, 0.511634767f},
-std::array<float,2>{0.702965677f, 0.680870116f},
-std::array<float,2>{0.354785651f, 0.401862442f},
-std::array<float,2>{0.796811998f, 0.0822550207f},
-std::array<float,2>{0.206339821f, 0.91898042f},
-std::array<float,2>{0.842059195f, 0.580165446f},
-std::array<float,2>{0.186403453f, 0.307560325f},
-std::array<float,2>{0.646564722f, 0.145655155f},
-std::array<float,2>{0.261609346f, 0.8255952f},
-std::array<float,2>{0.611428082f, 0.957840681f},
-std::array<float,2>{0.38479507f, 0.0394291207f},
-std::array<float,2>{0.964359045f, 0.488045782f},
-std::array<float,2>{0.023087699f, 0.726449907f},
-std::array<float,2>{0.951208353f, 0.969507158f},
-std::array<float,2>{0.0106957415f, 0.00787470117f},
-std::array<float,2>{0.595420003f, 0.448277324f},
-std::array<float,2>{0.405294955f, 0.695567369f},
-std::array<float,2>{0.630659401f, 0.603017151f},
-std::array<float,2>{0.271977395f, 0.27267611f},
-std::array<float,2>{0.822710872f, 0.166001022f},
-std::array<float,2>{0.160726696f, 0.862565517f},
-std::array<float,2>{0.812062323f, 0.634961605f},
-std::array<float,2>{0.189529434f, 0.435110003f},
-std::array<float,2>{0.709716201f, 0.118652709f},
-std::array<float,2>{0.374328792f, 0.881075084f},
-std::array<float,2>{0.561283588f, 0.785165012f},
-std::array<float,2>{0.452832907f, 0.19739534f},
-std::array<float,2>{0.876525104f, 0.355088711f},
-std::array<float,2>{0.0959904417f, 0.532598078f},
-std::array<float,2>{0.849725664f, 0.833200455f},
-std::array<float,2>{0.135289267f, 0.136853814f},
-std::array<float,2>{0.682105184f, 0.285798103f},
-std::array<float,2>{0.290659666f, 0.573596001f},
-std::array<float,2>{0.566175461f, 0.739675701f},
-std::array<float,2>{0.42217949f, 0.472402811f},
-std::array<float,2>{0.991488338f, 0.0561583526f},
-std::array<float,2>{0.0324277692f, 0.952427804f},
-std::array<float,2>{0.908429325f, 0.517693579f},
-std::array<float,2>{0.0835790187f, 0.327427864f},
-std::array<float,2>{0.516723394f, 0.241705403f},
-std::array<float,2>{0.493025482f, 0.768102825f},
-std::array<float,2>{0.74257946f, 0.937018514f},
-std::array<float,2>{0.320416063f, 0.0772024617f},
-std::array<float,2>{0.758065104f, 0.388880551f},
-std::array<float,2>{0.224586606f, 0.658946693f},
-std::array<float,2>{0.799634635f, 0.995486379f},
-std::array<float,2>{0.19754453f, 0.018546477f},
-std::array<float,2>{0.71283555f, 0.455145091f},
-std::array<float,2>{0.360375971f, 0.711998641f},
-std::array<float,2>{0.551731408f, 0.619983137f},
-std::array<float,2>{0.444846511f, 0.250128895f},
-std::array<float,2>{0.888939381f, 0.182041511f},
-std::array<float,2>{0.102306627f, 0.854722559f},
-std::array<float,2>{0.943284869f, 0.64559561f},
-std::array<float,2>{0.00038676025f, 0.407910556f},
-std::array<float,2>{0.606136084f, 0.106668025f},
-std::array<float,2>{0.397883326f, 0.891691029f},
-std::array<float,2>{0.633225441f, 0.812140405f},
-std::array<float,2>{0.277603358f, 0.214687645f},
-std::array<float,2>{0.813717306f, 0.361157984f},
-std::array<float,2>{0.170363382f, 0.560458481f},
-std::array<float,2>{0.917461336f, 0.821888387f},
-std::array<float,2>{0.0924470052f, 0.143309832f},
-std::array<float,2>{0.524461925f, 0.310902596f},
-std::array<float,2>{0.489043593f, 0.584236622f},
-std::array<float,2>{0.737388611f, 0.719469905f},
-std::array<float,2>{0.313854247f, 0.491845876f},
-std::array<float,2>{0.754137635f, 0.0439824946f},
-std::array<float,2>{0.227954f, 0.956447005f},
-std::array<float,2>{0.852018535f, 0.515323162f},
-std::array<float,2>{0.130031586f, 0.335775971f},
-std::array<float,2>{0.677394211f, 0.232677877f},
-std::array<float,2>{0.284732938f, 0.757698953f},
-std::array<float,2>{0.571697533f, 0.917166591f},
-std::array<float,2>{0.434445888f, 0.0793015063f},
-std::array<float,2>{0.998656034f, 0.40424493f},
-std::array<float,2>{0.0400947258f, 0.685506523f},
-std::array<float,2>{0.975285351f, 0.877206206f},
-std::array<float,2>{0.0515411831f, 0.124154411f},
-std::array<float,2>{0.586968601f, 0.432242006f},
-std::array<float,2>{0.411575615f, 0.640133381f},
-std::array<float,2>{0.66510427f, 0.538953722f},
-std::array<float,2>{0.30595395f, 0.356853455f},
-std::array<float,2>{0.868898153f, 0.202718556f},
-std::array<float,2>{0.155589715f, 0.783921421f},
-std::array<float,2>{0.778013647f, 0.701235354f},
-std::array<float,2>{0.236486062f, 0.452141583f},
-std::array<float,2>{0.723362505f, 0.0153859081f},
-std::array<float,2>{0.333310246f, 0.976408422f},
-std::array<float,2>{0.511069655f, 0.863811195f},
-std::array<float,2>{0.479383081f, 0.168742955f},
-std::array<float,2>{0.93347609f, 0.266213536f},
-std::array<float,2>{0.070613645f, 0.605763435f},
-std::array<float,2>{0.829354286f, 0.77263093f},
-std::array<float,2>{0.173706517f, 0.235931993f},
-std::array<float,2>{0.653879344f, 0.321533948f},
-std::array<float,2>{0.252332658f, 0.521507204f},
-std::array<float,2>{0.621536374f, 0.661826193f},
-std::array<float,2>{0.381643534f, 0.385824174f},
-std::array<float,2>{0.956103563f, 0.0705775395f},
-std::array<float,2>{0.0282384604f, 0.93254751f},
-std::array<float,2>{0.893719077f, 0.577693582f},
-std::array<float,2>{0.119921498f, 0.282769799f},
-std::array<float,2>{0.532460928f, 0.135225534f},
-std::array<float,2>{0.462189466f, 0.829921246f},
-std::array<float,2>{0.689257979f, 0.946688831f},
-std::array<float,2>{0.348153293f, 0.0609582849f},
-std::array<float,2>{0.784596443f, 0.474565029f},
-std::array<float,2>{0.215989143f, 0.734825611f},
-std::array<float,2>{0.861663699f, 0.925576627f},
-std::array<float,2>{0.147336259f, 0.0683767349f},
-std::array<float,2>{0.662830412f, 0.378094643f},
-std::array<float,2>{0.297067732f, 0.668162644f},
-std::array<float,2>{0.583164454f, 0.529714763f},
-std::array<float,2>{0.415640116f, 0.314134687f},
-std::array<float,2>{0.978362501f, 0.248667508f},
-std::array<float,2>{0.0572847649f, 0.775780261f},
-std::array<float,2>{0.924202383f, 0.74325788f},
-std::array<float,2>{0.0675310344f, 0.477344602f},
-std::array<float,2>{0.5077461f, 0.0519879572f},
-std::array<float,2>{0.473959595f, 0.942283213f},
-std::array<float,2>{0.728495717f, 0.841300607f},
-std::array<float,2>{0.340698004f, 0.12644437f},
-std::array<float,2>{0.768714011f, 0.293554306f},
-std::array<float,2>{0.246240109f, 0.568213403f},
-std::array<float,2>{0.967423737f, 0.791155696f},
-std::array<float,2>{0.0189730041f, 0.189516351f},
-std::array<float,2>{0.615039825f, 0.350963265f},
-std::array<float,2>{0.38782689f, 0.544921458f},
-std::array<float,2>{0.64315927f, 0.629077554f},
-std::array<float,2>{0.26213634f, 0.428492337f},
-std::array<float,2>{0.837005556f, 0.11633724f},
-std::array<float,2>{0.18114461f, 0.882973671f},
-std::array<float,2>{0.790496886f, 0.595710814f},
-std::array<float,2>{0.208934352f, 0.273482233f},
-std::array<float,2>{0.697193563f, 0.163302943f},
-std::array<float,2>{0.35676834f, 0.873705804f},
-std::array<float,2>{0.544463456f, 0.976785719f},
-std::array<float,2>{0.460005283f, 0.00744616659f},
-std::array<float,2>{0.899873376f, 0.442793697f},
-std::array<float,2>{0.11527013f, 0.691455126f},
-std::array<float,2>{0.88215059f, 0.96334672f},
-std::array<float,2>{0.0989318565f, 0.0370861404f},
-std::array<float,2>{0.558300555f, 0.49615407f},
-std::array<float,2>{0.446001619f, 0.733938873f},
-std::array<float,2>{0.703985333f, 0.591811836f},
-std::array<float,2>{0.370738417f, 0.30366233f},
-std::array<float,2>{0.805946708f, 0.156107977f},
-std::array<float,2>{0.191727474f, 0.818277717f},
-std::array<float,2>{0.825278401f, 0.674434602f},
-std::array<float,2>{0.159199789f, 0.393730044f},
-std::array<float,2>{0.625285268f, 0.089263089f},
-std::array<float,2>{0.269227982f, 0.912114203f},
-std::array<float,2>{0.599577904f, 0.763859987f},
-std::array<float,2>{0.40158999f, 0.224861428f},
-std::array<float,2>{0.947955966f, 0.337832481f},
-std::array<float,2>{0.0124954227f, 0.502473891f},
-std::array<float,2>{0.765559793f, 0.84972924f},
-std::array<float,2>{0.219083428f, 0.177964702f},
-std::array<float,2>{0.748136401f, 0.258826256f},
-std::array<float,2>{0.326879889f, 0.612493694f},
-std::array<float,2>{0.523347676f, 0.705480397f},
-std::array<float,2>{0.499926895f, 0.46735999f},
-std::array<float,2>{0.910216451f, 0.0255475547f},
-std::array<float,2>{0.0783594251f, 0.99006933f},
-std::array<float,2>{0.987672329f, 0.55102247f},
-std::array<float,2>{0.0351634733f, 0.370349407f},
-std::array<float,2>{0.5698511f, 0.209978461f},
-std::array<float,2>{0.427841574f, 0.80194205f},
-std::array<float,2>{0.683685124f, 0.901034415f},
-std::array<float,2>{0.295524567f, 0.0945094526f},
-std::array<float,2>{0.844786525f, 0.41566655f},
-std::array<float,2>{0.136847198f, 0.650414884f},
-std::array<float,2>{0.835621357f, 0.986300409f},
-std::array<float,2>{0.176213831f, 0.0307185035f},
-std::array<float,2>{0.648604095f, 0.461625934f},
-std::array<float,2>{0.25677979f, 0.707247734f},
-std::array<float,2>{0.619320691f, 0.615967989f},
-std::array<float,2>{0.37506485f, 0.26336202f},
-std::array<float,2>{0.960245728f, 0.173740059f},
-std::array<float,2>{0.0252979994f, 0.845412552f},
-std::array<float,2>{0.897996128f, 0.654711545f},
-std::array<float,2>{0.121466435f, 0.41855672f},
-std::array<float,2>{0.538034618f, 0.101515673f},
-std::array<float,2>{0.467924237f, 0.90477705f},
-std::array<float,2>{0.69171381f, 0.798038721f},
-std::array<float,2>{0.345935971f, 0.204810694f},
-std::array<float,2>{0.787702084f, 0.37133804f},
-std::array<float,2>{0.21242106f, 0.546967804f},
-std::array<float,2>{0.971686542f, 0.813960731f},
-std::array<float,2>{0.0481553078f, 0.15005447f},
-std::array<float,2>{0.593610585f, 0.300406098f},
-std::array<float,2>{0.406852722f, 0.588554442f},
-std::array<float,2>{0.669396102f, 0.726664543f},
-std::array<float,2>{0.311486393f, 0.493446499f},
-std::array<float,2>{0.872931242f, 0.0314615592f},
-std::array<float,2>{0.151304573f, 0.968330324f},
-std::array<float,2>{0.773881793f, 0.507202148f},
-std::array<float,2>{0.242114007f, 0.340484977f},
-std::array<float,2>{0.719147801f, 0.222158268f},
-std::array<float,2>{0.32936424f, 0.759882331f},
-std::array<float,2>{0.514806688f, 0.908722103f},
-std::array<float,2>{0.483149707f, 0.0904204547f},
-std::array<float,2>{0.93745327f, 0.396710366f},
-std::array<float,2>{0.0765513107f, 0.676353991f},
-std::array<float,2>{0.920284331f, 0.887368143f},
-std::array<float,2>{0.0892167166f, 0.111992918f},
-std::array<float,2>{0.530274153f, 0.423527062f},
-std::array<float,2>{0.487627506f, 0.628337026f},
-std::array<float,2>{0.741541445f, 0.541681647f},
-std::array<float,2>{0.319481403f, 0.344408363f},
-std::array<float,2>{0.753147423f, 0.192163557f},
-std::array<float,2>{0.23318772f, 0.793400228f},
-std::array<float,2>{0.858885586f, 0.689094841f},
-std::array<float,2>{0.128550604f, 0.438669533f},
-std::array<float,2>{0.673364997f, 3.59773039e-05f},
-std::array<float,2>{0.288815439f, 0.981761098f},
-std::array<float,2>{0.576460063f, 0.869960308f},
-std::array<float,2>{0.433201075f, 0.156672299f},
-std::array<float,2>{0.993962109f, 0.281179786f},
-std::array<float,2>{0.0462033898f, 0.599112689f},
-std::array<float,2>{0.802724242f, 0.778330982f},
-std::array<float,2>{0.20058535f, 0.24383311f},
-std::array<float,2>{0.715576887f, 0.316414952f},
-std::array<float,2>{0.366929889f, 0.52424562f},
-std::array<float,2>{0.547543049f, 0.66532439f},
-std::array<float,2>{0.438507438f, 0.382205218f},
-std::array<float,2>{0.883425772f, 0.0645646602f},
-std::array<float,2>{0.108957052f, 0.926430881f},
-std::array<float,2>{0.939856946f, 0.564656377f},
-std::array<float,2>{0.00691069709f, 0.290457875f},
-std::array<float,2>{0.604463518f, 0.129419416f},
-std::array<float,2>{0.393332064f, 0.839338839f},
-std::array<float,2>{0.639703989f, 0.940753579f},
-std::array<float,2>{0.275100678f, 0.0482652038f},
-std::array<float,2>{0.820169151f, 0.480636358f},
-std::array<float,2>{0.167840153f, 0.748108327f},
-std::array<float,2>{0.759214461f, 0.934265614f},
-std::array<float,2>{0.223491058f, 0.0748431534f},
-std::array<float,2>{0.743754208f, 0.388551235f},
-std::array<float,2>{0.321602076f, 0.65666002f},
-std::array<float,2>{0.515669405f, 0.516841054f},
-std::array<float,2>{0.493302405f, 0.325042784f},
-std::array<float,2>{0.909324467f, 0.238717124f},
-std::array<float,2>{0.0823673829f, 0.766053975f},
-std::array<float,2>{0.990405917f, 0.740810692f},
-std::array<float,2>{0.0319695622f, 0.470686972f},
-std::array<float,2>{0.565151632f, 0.057736516f},
-std::array<float,2>{0.423664898f, 0.950610459f},
-std::array<float,2>{0.68315661f, 0.834375322f},
-std::array<float,2>{0.289593786f, 0.140437394f},
-std::array<float,2>{0.850810587f, 0.287946373f},
-std::array<float,2>{0.135855392f, 0.571025372f},
-std::array<float,2>{0.875849187f, 0.788704276f},
-std::array<float,2>{0.0971449614f, 0.196818262f},
-std::array<float,2>{0.561911166f, 0.352445632f},
-std::array<float,2>{0.451665699f, 0.533848226f},
-std::array<float,2>{0.710025787f, 0.633804023f},
-std::array<float,2>{0.373903364f, 0.436511219f},
-std::array<float,2>{0.810835838f, 0.120543323f},
-std::array<float,2>{0.190671399f, 0.880561411f},
-std::array<float,2>{0.823625326f, 0.605399191f},
-std::array<float,2>{0.161622271f, 0.270943284f},
-std::array<float,2>{0.629135251f, 0.166142106f},
-std::array<float,2>{0.272567213f, 0.859549403f},
-std::array<float,2>{0.594496667f, 0.971115589f},
-std::array<float,2>{0.404481351f, 0.010663636f},
-std::array<float,2>{0.953068197f, 0.445900679f},
-std::array<float,2>{0.0115221636f, 0.698860049f},
-std::array<float,2>{0.963112533f, 0.959153175f},
-std::array<float,2>{0.0217937902f, 0.0426695757f},
-std::array<float,2>{0.612769306f, 0.485028923f},
-std::array<float,2>{0.38574788f, 0.724108875f},
-std::array<float,2>{0.648130357f, 0.578298151f},
-std::array<float,2>{0.260430157f, 0.305032283f},
-std::array<float,2>{0.842987537f, 0.14751558f},
-std::array<float,2>{0.18699567f, 0.82701987f},
-std::array<float,2>{0.795751572f, 0.68205148f},
-std::array<float,2>{0.205623373f, 0.399045587f},
-std::array<float,2>{0.701317787f, 0.0848598257f},
-std::array<float,2>{0.354412824f, 0.921672523f},
-std::array<float,2>{0.541846633f, 0.75052923f},
-std::array<float,2>{0.454088539f, 0.226988524f},
-std::array<float,2>{0.906169236f, 0.329422951f},
-std::array<float,2>{0.110820077f, 0.508587122f},
-std::array<float,2>{0.865991056f, 0.85717988f},
-std::array<float,2>{0.143668011f, 0.18441835f},
-std::array<float,2>{0.65641278f, 0.257411003f},
-std::array<float,2>{0.301614434f, 0.62462765f},
-std::array<float,2>{0.579627931f, 0.715577126f},
-std::array<float,2>{0.419180155f, 0.45854938f},
-std::array<float,2>{0.981277943f, 0.0211685766f},
-std::array<float,2>{0.0618506931f, 0.998962879f},
-std::array<float,2>{0.92735678f, 0.554793477f},
-std::array<float,2>{0.0651606023f, 0.367112875f},
-std::array<float,2>{0.500876665f, 0.21536839f},
-std::array<float,2>{0.471303612f, 0.808407068f},
-std::array<float,2>{0.733595669f, 0.89562887f},
-std::array<float,2>{0.339338809f, 0.102446958f},
-std::array<float,2>{0.771039844f, 0.410735637f},
-std::array<float,2>{0.244135112f, 0.643223941f},
-std::array<float,2>{0.783332407f, 0.948107958f},
-std::array<float,2>{0.215122089f, 0.0600288101f},
-std::array<float,2>{0.68776989f, 0.474873483f},
-std::array<float,2>{0.349197179f, 0.737043858f},
-std::array<float,2>{0.531795204f, 0.575226426f},
-std::array<float,2>{0.461864203f, 0.283631444f},
-std::array<float,2>{0.893269241f, 0.133097798f},
-std::array<float,2>{0.120398961f, 0.830680609f},
-std::array<float,2>{0.955802917f, 0.66249764f},
-std::array<float,2>{0.029041307f, 0.383786201f},
-std::array<float,2>{0.622463584f, 0.0737173036f},
-std::array<float,2>{0.382573485f, 0.930388212f},
-std::array<float,2>{0.652619064f, 0.769985139f},
-std::array<float,2>{0.253044814f, 0.238268107f},
-std::array<float,2>{0.828950167f, 0.322408795f},
-std::array<float,2>{0.171887875f, 0.520017803f},
-std::array<float,2>{0.932096064f, 0.866121769f},
-std::array<float,2>{0.071818985f, 0.170730963f},
-std::array<float,2>{0.510472715f, 0.269312143f},
-std::array<float,2>{0.47971645f, 0.60933429f},
-std::array<float,2>{0.723937452f, 0.700792015f},
-std::array<float,2>{0.332716197f, 0.450118363f},
-std::array<float,2>{0.778846681f, 0.0132855484f},
-std::array<float,2>{0.237388164f, 0.9744699f},
-std::array<float,2>{0.868135452f, 0.535774648f},
-std::array<float,2>{0.154763997f, 0.358562082f},
-std::array<float,2>{0.664150238f, 0.201064184f},
-std::array<float,2>{0.305586964f, 0.781389713f},
-std::array<float,2>{0.586439669f, 0.875157356f},
-std::array<float,2>{0.41061148f, 0.121496186f},
-std::array<float,2>{0.97574991f, 0.429854035f},
-std::array<float,2>{0.0523055829f, 0.63792938f},
-std::array<float,2>{0.99990803f, 0.915513635f},
-std::array<float,2>{0.0398779958f, 0.0808988512f},
-std::array<float,2>{0.571024954f, 0.405820101f},
-std::array<float,2>{0.434916705f, 0.686064959f},
-std::array<float,2>{0.675891578f, 0.511867166f},
-std::array<float,2>{0.283998579f, 0.332202166f},
-std::array<float,2>{0.852757096f, 0.232252121f},
-std::array<float,2>{0.129538894f, 0.754732609f},
-std::array<float,2>{0.75560081f, 0.721085668f},
-std::array<float,2>{0.226837263f, 0.49019292f},
-std::array<float,2>{0.736808956f, 0.0453831963f},
-std::array<float,2>{0.312561542f, 0.953706503f},
-std::array<float,2>{0.523549199f, 0.823334813f},
-std::array<float,2>{0.489869863f, 0.140644863f},
-std::array<float,2>{0.916517556f, 0.308790922f},
-std::array<float,2>{0.093495734f, 0.582089126f},
-std::array<float,2>{0.813366413f, 0.808598578f},
-std::array<float,2>{0.171382755f, 0.211852238f},
-std::array<float,2>{0.633844376f, 0.362840146f},
-std::array<float,2>{0.279250473f, 0.561273456f},
-std::array<float,2>{0.606647313f, 0.648284495f},
-std::array<float,2>{0.396875769f, 0.408960134f},
-std::array<float,2>{0.942129195f, 0.107477129f},
-std::array<float,2>{0.00142311584f, 0.894131303f},
-std::array<float,2>{0.889954865f, 0.618204474f},
-std::array<float,2>{0.103331558f, 0.253437579f},
-std::array<float,2>{0.552469611f, 0.181401566f},
-std::array<float,2>{0.444131196f, 0.853432119f},
-std::array<float,2>{0.711398005f, 0.993251681f},
-std::array<float,2>{0.359559327f, 0.0164149683f},
-std::array<float,2>{0.800456285f, 0.454926968f},
-std::array<float,2>{0.199037045f, 0.71390295f},
-std::array<float,2>{0.844363093f, 0.898835957f},
-std::array<float,2>{0.138599679f, 0.0965105668f},
-std::array<float,2>{0.68491137f, 0.417805403f},
-std::array<float,2>{0.296726763f, 0.649301767f},
-std::array<float,2>{0.568888962f, 0.554265857f},
-std::array<float,2>{0.429118425f, 0.368635297f},
-std::array<float,2>{0.987053812f, 0.208783254f},
-std::array<float,2>{0.0367890224f, 0.803871572f},
-std::array<float,2>{0.911171615f, 0.703365624f},
-std::array<float,2>{0.0791068226f, 0.465237141f},
-std::array<float,2>{0.521653831f, 0.023637075f},
-std::array<float,2>{0.498343498f, 0.990811169f},
-std::array<float,2>{0.749201477f, 0.84841764f},
-std::array<float,2>{0.327929795f, 0.176804319f},
-std::array<float,2>{0.763959348f, 0.26017189f},
-std::array<float,2>{0.220094308f, 0.61064136f},
-std::array<float,2>{0.948695838f, 0.761925876f},
-std::array<float,2>{0.0131028527f, 0.22323972f},
-std::array<float,2>{0.597865701f, 0.339531332f},
-std::array<float,2>{0.400737703f, 0.500796616f},
-std::array<float,2>{0.626639426f, 0.672850907f},
-std::array<float,2>{0.268287867f, 0.392397642f},
-std::array<float,2>{0.824483931f, 0.0876926407f},
-std::array<float,2>{0.159162521f, 0.911146164f},
-std::array<float,2>{0.805206835f, 0.590020716f},
-std::array<float,2>{0.193170771f, 0.302069277f},
-std::array<float,2>{0.704188704f, 0.152922362f},
-std::array<float,2>{0.369698614f, 0.818690479f},
-std::array<float,2>{0.557288945f, 0.961339235f},
-std::array<float,2>{0.447146684f, 0.0376149826f},
-std::array<float,2>{0.88110584f, 0.498937994f},
-std::array<float,2>{0.097955741f, 0.730500817f},
-std::array<float,2>{0.898667395f, 0.979622066f},
-std::array<float,2>{0.117005892f, 0.00572146429f},
-std::array<float,2>{0.543036342f, 0.444861323f},
-std::array<float,2>{0.459349483f, 0.69413203f},
-std::array<float,2>{0.695869863f, 0.59472543f},
-std::array<float,2>{0.355996668f, 0.275553554f},
-std::array<float,2>{0.789690852f, 0.161731198f},
-std::array<float,2>{0.207435638f, 0.871397257f},
-std::array<float,2>{0.836499512f, 0.632215917f},
-std::array<float,2>{0.179744184f, 0.42605257f},
-std::array<float,2>{0.644205868f, 0.113757774f},
-std::array<float,2>{0.263450682f, 0.884875774f},
-std::array<float,2>{0.613292456f, 0.790767372f},
-std::array<float,2>{0.387685835f, 0.189239994f},
-std::array<float,2>{0.968099236f, 0.347747713f},
-std::array<float,2>{0.0180539098f, 0.545910895f},
-std::array<float,2>{0.768075705f, 0.842434525f},
-std::array<float,2>{0.247495741f, 0.12803261f},
-std::array<float,2>{0.727534533f, 0.295186371f},
-std::array<float,2>{0.341132939f, 0.568583012f},
-std::array<float,2>{0.506034076f, 0.745060444f},
-std::array<float,2>{0.473329812f, 0.478815943f},
-std::array<float,2>{0.925119877f, 0.053563714f},
-std::array<float,2>{0.0671650767f, 0.945150375f},
-std::array<float,2>{0.977100432f, 0.528975427f},
-std::array<float,2>{0.0578550324f, 0.314713806f},
-std::array<float,2>{0.582170188f, 0.246848434f},
-std::array<float,2>{0.414138913f, 0.774295092f},
-std::array<float,2>{0.663679123f, 0.922076285f},
-std::array<float,2>{0.298431605f, 0.0676620156f},
-std::array<float,2>{0.86260885f, 0.376039267f},
-std::array<float,2>{0.14764902f, 0.670083284f},
-std::array<float,2>{0.873938918f, 0.965720057f},
-std::array<float,2>{0.150289819f, 0.0333920531f},
-std::array<float,2>{0.670639753f, 0.495955676f},
-std::array<float,2>{0.310098767f, 0.729295015f},
-std::array<float,2>{0.591046214f, 0.586920023f},
-std::array<float,2>{0.408999532f, 0.297873735f},
-std::array<float,2>{0.969395638f, 0.150820091f},
-std::array<float,2>{0.0488434322f, 0.815092921f},
-std::array<float,2>{0.935489297f, 0.679559588f},
-std::array<float,2>{0.0742740631f, 0.39588052f},
-std::array<float,2>{0.511921942f, 0.0932837501f},
-std::array<float,2>{0.481887102f, 0.907038927f},
-std::array<float,2>{0.721546113f, 0.759088576f},
-std::array<float,2>{0.331600338f, 0.219528288f},
-std::array<float,2>{0.776605487f, 0.34272632f},
-std::array<float,2>{0.239376292f, 0.505600035f},
-std::array<float,2>{0.958171546f, 0.846564233f},
-std::array<float,2>{0.0272600036f, 0.174611852f},
-std::array<float,2>{0.61856997f, 0.264323294f},
-std::array<float,2>{0.377818942f, 0.614354312f},
-std::array<float,2>{0.650490582f, 0.709204495f},
-std::array<float,2>{0.254881769f, 0.463435441f},
-std::array<float,2>{0.832540929f, 0.0278925989f},
-std::array<float,2>{0.178795412f, 0.986331761f},
-std::array<float,2>{0.785924494f, 0.550328255f},
-std::array<float,2>{0.21374087f, 0.374915361f},
-std::array<float,2>{0.693701208f, 0.205528319f},
-std::array<float,2>{0.344111979f, 0.79965049f},
-std::array<float,2>{0.536234856f, 0.902628005f},
-std::array<float,2>{0.465836465f, 0.0982474238f},
-std::array<float,2>{0.894894183f, 0.421678573f},
-std::array<float,2>{0.12434008f, 0.653828263f},
-std::array<float,2>{0.885367393f, 0.929161966f},
-std::array<float,2>{0.107227542f, 0.0627403557f},
-std::array<float,2>{0.550058722f, 0.379728794f},
-std::array<float,2>{0.440026313f, 0.667035401f},
-std::array<float,2>{0.71723789f, 0.527276516f},
-std::array<float,2>{0.363287091f, 0.318599701f},
-std::array<float,2>{0.802996159f, 0.244224936f},
-std::array<float,2>{0.201689497f, 0.780520082f},
-std::array<float,2>{0.817974269f, 0.746875942f},
-std::array<float,2>{0.164862856f, 0.483322501f},
-std::array<float,2>{0.638266206f, 0.0496347398f},
-std::array<float,2>{0.276916593f, 0.939239621f},
-std::array<float,2>{0.60195142f, 0.837765992f},
-std::array<float,2>{0.392301559f, 0.131952137f},
-std::array<float,2>{0.938099504f, 0.291732401f},
-std::array<float,2>{0.00517731253f, 0.563147664f},
-std::array<float,2>{0.751155913f, 0.796224713f},
-std::array<float,2>{0.230478793f, 0.194620207f},
-std::array<float,2>{0.738372087f, 0.346562028f},
-std::array<float,2>{0.317437142f, 0.540168464f},
-std::array<float,2>{0.529155195f, 0.625552118f},
-std::array<float,2>{0.485968918f, 0.424986213f},
-std::array<float,2>{0.91893214f, 0.109722219f},
-std::array<float,2>{0.0876404718f, 0.888784409f},
-std::array<float,2>{0.994987786f, 0.600277424f},
-std::array<float,2>{0.0449043214f, 0.277998567f},
-std::array<float,2>{0.575513124f, 0.159622863f},
-std::array<float,2>{0.430963516f, 0.868004024f},
-std::array<float,2>{0.675546587f, 0.982635736f},
-std::array<float,2>{0.285479575f, 0.00296703842f},
-std::array<float,2>{0.857078135f, 0.440658897f},
-std::array<float,2>{0.12506707f, 0.689683676f},
-std::array<float,2>{0.809235811f, 0.882408202f},
-std::array<float,2>{0.188752726f, 0.117437951f},
-std::array<float,2>{0.708906353f, 0.434089392f},
-std::array<float,2>{0.371622354f, 0.636696458f},
-std::array<float,2>{0.559502184f, 0.532016635f},
-std::array<float,2>{0.449498981f, 0.354199678f},
-std::array<float,2>{0.878054023f, 0.198808178f},
-std::array<float,2>{0.0955127627f, 0.786976755f},
-std::array<float,2>{0.949596226f, 0.69659251f},
-std::array<float,2>{0.00857674517f, 0.447657436f},
-std::array<float,2>{0.596880376f, 0.00921140239f},
-std::array<float,2>{0.40288341f, 0.970530033f},
-std::array<float,2>{0.632764399f, 0.861820996f},
-std::array<float,2>{0.269542098f, 0.164230973f},
-std::array<float,2>{0.822140872f, 0.272184938f},
-std::array<float,2>{0.162354574f, 0.602391362f},
-std::array<float,2>{0.90809077f, 0.769230247f},
-std::array<float,2>{0.0840388238f, 0.241123095f},
-std::array<float,2>{0.518631816f, 0.327115655f},
-std::array<float,2>{0.494742304f, 0.519434154f},
-std::array<float,2>{0.745111346f, 0.65989238f},
-std::array<float,2>{0.322892338f, 0.390592813f},
-std::array<float,2>{0.759823799f, 0.0763742551f},
-std::array<float,2>{0.22500971f, 0.936433613f},
-std::array<float,2>{0.849157333f, 0.572655201f},
-std::array<float,2>{0.132997379f, 0.286964566f},
-std::array<float,2>{0.68093437f, 0.137904853f},
-std::array<float,2>{0.292773902f, 0.832661569f},
-std::array<float,2>{0.562935174f, 0.951716602f},
-std::array<float,2>{0.424940169f, 0.0551483259f},
-std::array<float,2>{0.989065051f, 0.47084704f},
-std::array<float,2>{0.0344685055f, 0.738340855f},
-std::array<float,2>{0.983930409f, 0.996278226f},
-std::array<float,2>{0.060092885f, 0.022168383f},
-std::array<float,2>{0.580704629f, 0.460178316f},
-std::array<float,2>{0.421262413f, 0.718157828f},
-std::array<float,2>{0.658630431f, 0.621347547f},
-std::array<float,2>{0.303624749f, 0.254335672f},
-std::array<float,2>{0.864082038f, 0.186658174f},
-std::array<float,2>{0.141631737f, 0.859119296f},
-std::array<float,2>{0.772035301f, 0.640634418f},
-std::array<float,2>{0.244151115f, 0.413875461f},
-std::array<float,2>{0.731241941f, 0.105271071f},
-std::array<float,2>{0.336761504f, 0.896984339f},
-std::array<float,2>{0.503586352f, 0.804910839f},
-std::array<float,2>{0.469401151f, 0.21808362f},
-std::array<float,2>{0.929347515f, 0.363416225f},
-std::array<float,2>{0.0627226606f, 0.55823338f},
-std::array<float,2>{0.841172755f, 0.824469626f},
-std::array<float,2>{0.185440838f, 0.145270571f},
-std::array<float,2>{0.644589126f, 0.30838716f},
-std::array<float,2>{0.258413881f, 0.581536531f},
-std::array<float,2>{0.611107826f, 0.724795997f},
-std::array<float,2>{0.38281706f, 0.486961633f},
-std::array<float,2>{0.960976481f, 0.040192537f},
-std::array<float,2>{0.0198221076f, 0.958036542f},
-std::array<float,2>{0.903869212f, 0.510043085f},
-std::array<float,2>{0.112059802f, 0.331820488f},
-std::array<float,2>{0.539119422f, 0.230356812f},
-std::array<float,2>{0.456866592f, 0.75354284f},
-std::array<float,2>{0.699750185f, 0.918595016f},
-std::array<float,2>{0.351639152f, 0.0838293135f},
-std::array<float,2>{0.794306338f, 0.400519341f},
-std::array<float,2>{0.203998327f, 0.6803177f},
-std::array<float,2>{0.780329704f, 0.974925876f},
-std::array<float,2>{0.234860078f, 0.0138030956f},
-std::array<float,2>{0.725299358f, 0.453068793f},
-std::array<float,2>{0.334230334f, 0.70243752f},
-std::array<float,2>{0.50851202f, 0.607058823f},
-std::array<float,2>{0.478337586f, 0.266805321f},
-std::array<float,2>{0.93160373f, 0.169571757f},
-std::array<float,2>{0.0736759827f, 0.864914715f},
-std::array<float,2>{0.973018467f, 0.639020741f},
-std::array<float,2>{0.0544502437f, 0.43281129f},
-std::array<float,2>{0.588944077f, 0.123299666f},
-std::array<float,2>{0.412457705f, 0.878280222f},
-std::array<float,2>{0.667815626f, 0.784578919f},
-std::array<float,2>{0.308102518f, 0.201689988f},
-std::array<float,2>{0.869335949f, 0.355505049f},
-std::array<float,2>{0.154063404f, 0.537676394f},
-std::array<float,2>{0.892378032f, 0.828958631f},
-std::array<float,2>{0.118971072f, 0.136097088f},
-std::array<float,2>{0.533307195f, 0.282044709f},
-std::array<float,2>{0.463624716f, 0.577088892f},
-std::array<float,2>{0.690062344f, 0.736168027f},
-std::array<float,2>{0.351376206f, 0.473053962f},
-std::array<float,2>{0.782754064f, 0.0623629503f},
-std::array<float,2>{0.218701109f, 0.94558847f},
-std::array<float,2>{0.830288649f, 0.522975564f},
-std::array<float,2>{0.173905641f, 0.320623994f},
-std::array<float,2>{0.654984057f, 0.234498248f},
-std::array<float,2>{0.25112465f, 0.772055268f},
-std::array<float,2>{0.62316215f, 0.933462799f},
-std::array<float,2>{0.379762232f, 0.0716473386f},
-std::array<float,2>{0.953159332f, 0.385457575f},
-std::array<float,2>{0.0293356162f, 0.66075182f},
-std::array<float,2>{0.943502069f, 0.890771329f},
-std::array<float,2>{0.00232124096f, 0.105828069f},
-std::array<float,2>{0.607881725f, 0.406328708f},
-std::array<float,2>{0.395905733f, 0.644758224f},
-std::array<float,2>{0.636452496f, 0.559045196f},
-std::array<float,2>{0.280579835f, 0.360336602f},
-std::array<float,2>{0.814787924f, 0.213607863f},
-std::array<float,2>{0.168372527f, 0.811089993f},
-std::array<float,2>{0.798128068f, 0.711028695f},
-std::array<float,2>{0.197212592f, 0.456844687f},
-std::array<float,2>{0.713561714f, 0.0191479698f},
-std::array<float,2>{0.362379462f, 0.994446456f},
-std::array<float,2>{0.553813159f, 0.853562057f},
-std::array<float,2>{0.443050325f, 0.183143631f},
-std::array<float,2>{0.888227105f, 0.251790971f},
-std::array<float,2>{0.104218066f, 0.621055603f},
-std::array<float,2>{0.854238927f, 0.756780505f},
-std::array<float,2>{0.131701753f, 0.234221205f},
-std::array<float,2>{0.677774847f, 0.334942162f},
-std::array<float,2>{0.282361329f, 0.513750315f},
-std::array<float,2>{0.573131144f, 0.683788121f},
-std::array<float,2>{0.437265962f, 0.402823091f},
-std::array<float,2>{0.997502029f, 0.0786543861f},
-std::array<float,2>{0.0419878885f, 0.916360378f},
-std::array<float,2>{0.91443187f, 0.585530043f},
-std::array<float,2>{0.0903602019f, 0.312069297f},
-std::array<float,2>{0.52629143f, 0.14436467f},
-std::array<float,2>{0.491231322f, 0.820835769f},
-std::array<float,2>{0.735066533f, 0.955540836f},
-std::array<float,2>{0.314501256f, 0.0429851413f},
-std::array<float,2>{0.757573903f, 0.490489542f},
-std::array<float,2>{0.229438141f, 0.720454931f},
-std::array<float,2>{0.827148497f, 0.913088381f},
-std::array<float,2>{0.156860664f, 0.0888102725f},
-std::array<float,2>{0.628107905f, 0.392722696f},
-std::array<float,2>{0.26672861f, 0.675509751f},
-std::array<float,2>{0.600535512f, 0.503745615f},
-std::array<float,2>{0.39920032f, 0.336367399f},
-std::array<float,2>{0.945591271f, 0.225693002f},
-std::array<float,2>{0.0152360257f, 0.764909089f},
-std::array<float,2>{0.879092336f, 0.733379602f},
-std::array<float,2>{0.100266665f, 0.497825384f},
-std::array<float,2>{0.555670738f, 0.0357362442f},
-std::array<float,2>{0.448309749f, 0.963936269f},
-std::array<float,2>{0.70524478f, 0.816830277f},
-std::array<float,2>{0.367548048f, 0.154796481f},
-std::array<float,2>{0.80739516f, 0.303973466f},
-std::array<float,2>{0.194858149f, 0.59313935f},
-std::array<float,2>{0.984472632f, 0.801673174f},
-std::array<float,2>{0.0387182832f, 0.209382534f},
-std::array<float,2>{0.567631781f, 0.370009392f},
-std::array<float,2>{0.427367538f, 0.552052259f},
-std::array<float,2>{0.685773909f, 0.652103186f},
-std::array<float,2>{0.293035865f, 0.414656311f},
-std::array<float,2>{0.84628886f, 0.0948239192f},
-std::array<float,2>{0.140242741f, 0.902101398f},
-std::array<float,2>{0.76295346f, 0.611925423f},
-std::array<float,2>{0.221305221f, 0.258649677f},
-std::array<float,2>{0.747735977f, 0.179571033f},
-std::array<float,2>{0.324812204f, 0.850909352f},
-std::array<float,2>{0.520071745f, 0.988762915f},
-std::array<float,2>{0.496301979f, 0.0272340905f},
-std::array<float,2>{0.912581563f, 0.468179226f},
-std::array<float,2>{0.0818058699f, 0.706766844f},
-std::array<float,2>{0.922675192f, 0.942604899f},
-std::array<float,2>{0.0685098097f, 0.0514865033f},
-std::array<float,2>{0.505178809f, 0.477799445f},
-std::array<float,2>{0.475108743f, 0.743059695f},
-std::array<float,2>{0.730385005f, 0.566428423f},
-std::array<float,2>{0.343413115f, 0.294238657f},
-std::array<float,2>{0.766871512f, 0.125321805f},
-std::array<float,2>{0.249797717f, 0.84029758f},
-std::array<float,2>{0.861070871f, 0.66973412f},
-std::array<float,2>{0.145760521f, 0.377835184f},
-std::array<float,2>{0.66042316f, 0.0701446384f},
-std::array<float,2>{0.299153119f, 0.92469573f},
-std::array<float,2>{0.585527956f, 0.777166963f},
-std::array<float,2>{0.417295128f, 0.249733508f},
-std::array<float,2>{0.979595125f, 0.313379824f},
-std::array<float,2>{0.0549472757f, 0.530565858f},
-std::array<float,2>{0.792131364f, 0.874644876f},
-std::array<float,2>{0.209143057f, 0.162749827f},
-std::array<float,2>{0.698246241f, 0.274962664f},
-std::array<float,2>{0.35853377f, 0.597251892f},
-std::array<float,2>{0.545446455f, 0.692386687f},
-std::array<float,2>{0.457918853f, 0.442036808f},
-std::array<float,2>{0.902083814f, 0.0059980927f},
-std::array<float,2>{0.114321917f, 0.977937877f},
-std::array<float,2>{0.965751588f, 0.543374896f},
-std::array<float,2>{0.0175132323f, 0.350397229f},
-std::array<float,2>{0.616374552f, 0.190583467f},
-std::array<float,2>{0.388729811f, 0.79280889f},
-std::array<float,2>{0.641122758f, 0.884008944f},
-std::array<float,2>{0.264473855f, 0.116027959f},
-std::array<float,2>{0.838677943f, 0.429516375f},
-std::array<float,2>{0.181971237f, 0.630585015f},
-std::array<float,2>{0.869512022f, 0.972702444f},
-std::array<float,2>{0.153915375f, 0.012355959f},
-std::array<float,2>{0.667494595f, 0.450231701f},
-std::array<float,2>{0.307786077f, 0.699568748f},
-std::array<float,2>{0.58918786f, 0.608389378f},
-std::array<float,2>{0.412218124f, 0.268270731f},
-std::array<float,2>{0.972761571f, 0.171737835f},
-std::array<float,2>{0.0543019883f, 0.866445005f},
-std::array<float,2>{0.931196213f, 0.636822104f},
-std::array<float,2>{0.0733307675f, 0.431601524f},
-std::array<float,2>{0.508758485f, 0.122651376f},
-std::array<float,2>{0.478121728f, 0.876578689f},
-std::array<float,2>{0.725431979f, 0.782959104f},
-std::array<float,2>{0.334060282f, 0.199674591f},
-std::array<float,2>{0.78071326f, 0.357548714f},
-std::array<float,2>{0.234474912f, 0.537079155f},
-std::array<float,2>{0.953542054f, 0.831181884f},
-std::array<float,2>{0.0296040364f, 0.133836508f},
-std::array<float,2>{0.62336117f, 0.284199387f},
-std::array<float,2>{0.37957558f, 0.574734032f},
-std::array<float,2>{0.655107737f, 0.738206863f},
-std::array<float,2>{0.251454294f, 0.476163149f},
-std::array<float,2>{0.830420792f, 0.0592857637f},
-std::array<float,2>{0.174289331f, 0.949105859f},
-std::array<float,2>{0.783162773f, 0.520576358f},
-std::array<float,2>{0.218276307f, 0.323573977f},
-std::array<float,2>{0.690299213f, 0.236933157f},
-std::array<float,2>{0.351290077f, 0.770590901f},
-std::array<float,2>{0.533575475f, 0.931120217f},
-std::array<float,2>{0.463425696f, 0.0727764294f},
-std::array<float,2>{0.892295539f, 0.384308845f},
-std::array<float,2>{0.11877045f, 0.663552225f},
-std::array<float,2>{0.888458729f, 0.892900109f},
-std::array<float,2>{0.104437932f, 0.109370314f},
-std::array<float,2>{0.554000437f, 0.410067171f},
-std::array<float,2>{0.443236411f, 0.647126913f},
-std::array<float,2>{0.713700235f, 0.562291026f},
-std::array<float,2>{0.362760127f, 0.362088084f},
-std::array<float,2>{0.797925293f, 0.212399125f},
-std::array<float,2>{0.197014824f, 0.810327888f},
-std::array<float,2>{0.81450063f, 0.713851154f},
-std::array<float,2>{0.168181568f, 0.453647137f},
-std::array<float,2>{0.636666298f, 0.0172384102f},
-std::array<float,2>{0.28033334f, 0.992500782f},
-std::array<float,2>{0.607508957f, 0.85242933f},
-std::array<float,2>{0.395723522f, 0.180234998f},
-std::array<float,2>{0.943806529f, 0.252280086f},
-std::array<float,2>{0.00217200629f, 0.617566824f},
-std::array<float,2>{0.757469594f, 0.755312264f},
-std::array<float,2>{0.229056209f, 0.23112458f},
-std::array<float,2>{0.735322058f, 0.333590508f},
-std::array<float,2>{0.314781368f, 0.513270795f},
-std::array<float,2>{0.525893986f, 0.687157154f},
-std::array<float,2>{0.491606474f, 0.405066848f},
-std::array<float,2>{0.914125025f, 0.0812699124f},
-std::array<float,2>{0.0906509236f, 0.914612412f},
-std::array<float,2>{0.997174501f, 0.583410382f},
-std::array<float,2>{0.0416596904f, 0.310508788f},
-std::array<float,2>{0.572911739f, 0.142486796f},
-std::array<float,2>{0.437069029f, 0.823010981f},
-std::array<float,2>{0.678019643f, 0.955054045f},
-std::array<float,2>{0.282577336f, 0.0461925417f},
-std::array<float,2>{0.854273796f, 0.488679796f},
-std::array<float,2>{0.131419256f, 0.721851647f},
-std::array<float,2>{0.807138026f, 0.911075652f},
-std::array<float,2>{0.195121765f, 0.0860152543f},
-std::array<float,2>{0.705563545f, 0.391362071f},
-std::array<float,2>{0.367266864f, 0.673195183f},
-std::array<float,2>{0.556038022f, 0.501112998f},
-std::array<float,2>{0.448536813f, 0.338128656f},
-std::array<float,2>{0.879343092f, 0.224465787f},
-std::array<float,2>{0.100510098f, 0.762981415f},
-std::array<float,2>{0.945538044f, 0.732007444f},
-std::array<float,2>{0.0154706612f, 0.499259621f},
-std::array<float,2>{0.600248575f, 0.0388978384f},
-std::array<float,2>{0.399087578f, 0.962080717f},
-std::array<float,2>{0.628409863f, 0.820023775f},
-std::array<float,2>{0.26688537f, 0.153366446f},
-std::array<float,2>{0.827587664f, 0.301579267f},
-std::array<float,2>{0.157062247f, 0.591057122f},
-std::array<float,2>{0.912273467f, 0.803288043f},
-std::array<float,2>{0.0817657709f, 0.207198992f},
-std::array<float,2>{0.520347476f, 0.367679924f},
-std::array<float,2>{0.496526241f, 0.552736461f},
-std::array<float,2>{0.747985959f, 0.650281012f},
-std::array<float,2>{0.325050533f, 0.416180283f},
-std::array<float,2>{0.762807488f, 0.097409904f},
-std::array<float,2>{0.221560329f, 0.900331676f},
-std::array<float,2>{0.846451342f, 0.60999608f},
-std::array<float,2>{0.140474319f, 0.26112318f},
-std::array<float,2>{0.685873151f, 0.176667958f},
-std::array<float,2>{0.293401003f, 0.848664999f},
-std::array<float,2>{0.567589462f, 0.991455555f},
-std::array<float,2>{0.427653551f, 0.0248856582f},
-std::array<float,2>{0.984790146f, 0.465918958f},
-std::array<float,2>{0.0388387442f, 0.705005646f},
-std::array<float,2>{0.979951799f, 0.943770707f},
-std::array<float,2>{0.0548694842f, 0.0538294986f},
-std::array<float,2>{0.585795403f, 0.48033762f},
-std::array<float,2>{0.417176455f, 0.745842278f},
-std::array<float,2>{0.660270154f, 0.569632769f},
-std::array<float,2>{0.298857093f, 0.296033949f},
-std::array<float,2>{0.861121655f, 0.127900198f},
-std::array<float,2>{0.145603344f, 0.843208194f},
-std::array<float,2>{0.766743839f, 0.671611488f},
-std::array<float,2>{0.249521822f, 0.375228584f},
-std::array<float,2>{0.730208397f, 0.0672077462f},
-std::array<float,2>{0.34367758f, 0.923493803f},
-std::array<float,2>{0.504895747f, 0.774841368f},
-std::array<float,2>{0.475431681f, 0.247299969f},
-std::array<float,2>{0.922368765f, 0.316003025f},
-std::array<float,2>{0.0688258708f, 0.527497113f},
-std::array<float,2>{0.838424325f, 0.872729063f},
-std::array<float,2>{0.181734368f, 0.160643175f},
-std::array<float,2>{0.641566694f, 0.277230024f},
-std::array<float,2>{0.264176935f, 0.595650673f},
-std::array<float,2>{0.616478622f, 0.695242524f},
-std::array<float,2>{0.388956994f, 0.444001257f},
-std::array<float,2>{0.965416968f, 0.00423891423f},
-std::array<float,2>{0.0171702411f, 0.979372621f},
-std::array<float,2>{0.902340531f, 0.545897007f},
-std::array<float,2>{0.114698559f, 0.348763019f},
-std::array<float,2>{0.545672894f, 0.188310772f},
-std::array<float,2>{0.457689792f, 0.789689779f},
-std::array<float,2>{0.698651612f, 0.885756135f},
-std::array<float,2>{0.358769476f, 0.114562966f},
-std::array<float,2>{0.792424023f, 0.427116156f},
-std::array<float,2>{0.209433481f, 0.63102603f},
-std::array<float,2>{0.776688278f, 0.967217743f},
-std::array<float,2>{0.239647701f, 0.0331534296f},
-std::array<float,2>{0.721344709f, 0.492751956f},
-std::array<float,2>{0.331818849f, 0.727780759f},
-std::array<float,2>{0.512076795f, 0.589440286f},
-std::array<float,2>{0.481535345f, 0.299462318f},
-std::array<float,2>{0.935076714f, 0.148986176f},
-std::array<float,2>{0.0746275485f, 0.812961519f},
-std::array<float,2>{0.969529867f, 0.677346706f},
-std::array<float,2>{0.0490900315f, 0.398248643f},
-std::array<float,2>{0.591108441f, 0.0910246372f},
-std::array<float,2>{0.408694476f, 0.909293234f},
-std::array<float,2>{0.670688272f, 0.761152506f},
-std::array<float,2>{0.310394019f, 0.221416101f},
-std::array<float,2>{0.873540401f, 0.340826839f},
-std::array<float,2>{0.14995192f, 0.50632298f},
-std::array<float,2>{0.89473623f, 0.8442536f},
-std::array<float,2>{0.124144107f, 0.172146395f},
-std::array<float,2>{0.536484301f, 0.262674898f},
-std::array<float,2>{0.466200978f, 0.616291463f},
-std::array<float,2>{0.693496048f, 0.708795726f},
-std::array<float,2>{0.343760192f, 0.462114155f},
-std::array<float,2>{0.785758436f, 0.0296031162f},
-std::array<float,2>{0.213447049f, 0.985225677f},
-std::array<float,2>{0.832965314f, 0.547855377f},
-std::array<float,2>{0.178986296f, 0.372906953f},
-std::array<float,2>{0.650636792f, 0.203424692f},
-std::array<float,2>{0.254466593f, 0.797492564f},
-std::array<float,2>{0.618362665f, 0.905650914f},
-std::array<float,2>{0.377598286f, 0.0999614969f},
-std::array<float,2>{0.958403468f, 0.419435263f},
-std::array<float,2>{0.0268674791f, 0.655967832f},
-std::array<float,2>{0.938236713f, 0.927501678f},
-std::array<float,2>{0.00507999631f, 0.0659962222f},
-std::array<float,2>{0.601687729f, 0.381753415f},
-std::array<float,2>{0.392401487f, 0.664915442f},
-std::array<float,2>{0.638502598f, 0.525130868f},
-std::array<float,2>{0.277236134f, 0.318157166f},
-std::array<float,2>{0.818235695f, 0.242575407f},
-std::array<float,2>{0.164598182f, 0.77817595f},
-std::array<float,2>{0.802864373f, 0.749273479f},
-std::array<float,2>{0.202095807f, 0.482299119f},
-std::array<float,2>{0.716911912f, 0.047333084f},
-std::array<float,2>{0.363717377f, 0.939843655f},
-std::array<float,2>{0.550004601f, 0.838718057f},
-std::array<float,2>{0.440194041f, 0.129896864f},
-std::array<float,2>{0.885702848f, 0.28967151f},
-std::array<float,2>{0.10707777f, 0.56631422f},
-std::array<float,2>{0.857333124f, 0.79422152f},
-std::array<float,2>{0.125377789f, 0.192662746f},
-std::array<float,2>{0.675339699f, 0.345265687f},
-std::array<float,2>{0.285185605f, 0.542707801f},
-std::array<float,2>{0.57534045f, 0.627411783f},
-std::array<float,2>{0.43078205f, 0.422796249f},
-std::array<float,2>{0.994744062f, 0.112388991f},
-std::array<float,2>{0.0446476601f, 0.887884676f},
-std::array<float,2>{0.918650687f, 0.598428488f},
-std::array<float,2>{0.087681599f, 0.28011477f},
-std::array<float,2>{0.528912783f, 0.157657191f},
-std::array<float,2>{0.486127853f, 0.870351434f},
-std::array<float,2>{0.73863709f, 0.980679154f},
-std::array<float,2>{0.317724377f, 0.00159139233f},
-std::array<float,2>{0.751411319f, 0.438032746f},
-std::array<float,2>{0.230761275f, 0.688127756f},
-std::array<float,2>{0.821991265f, 0.879814804f},
-std::array<float,2>{0.162217751f, 0.119898401f},
-std::array<float,2>{0.632553518f, 0.437419325f},
-std::array<float,2>{0.269928575f, 0.633082569f},
-std::array<float,2>{0.597024083f, 0.534626186f},
-std::array<float,2>{0.403218955f, 0.353044003f},
-std::array<float,2>{0.949396014f, 0.195815638f},
-std::array<float,2>{0.00842906162f, 0.787877738f},
-std::array<float,2>{0.878185272f, 0.698179483f},
-std::array<float,2>{0.0952976868f, 0.446503431f},
-std::array<float,2>{0.559304774f, 0.0109913889f},
-std::array<float,2>{0.44925198f, 0.972453117f},
-std::array<float,2>{0.708735526f, 0.861114979f},
-std::array<float,2>{0.372069716f, 0.167904735f},
-std::array<float,2>{0.809433103f, 0.269964337f},
-std::array<float,2>{0.188559994f, 0.604242682f},
-std::array<float,2>{0.988783419f, 0.767041922f},
-std::array<float,2>{0.0342027806f, 0.239870057f},
-std::array<float,2>{0.562622786f, 0.326048493f},
-std::array<float,2>{0.425189346f, 0.515706837f},
-std::array<float,2>{0.680695057f, 0.657613933f},
-std::array<float,2>{0.292503893f, 0.387220919f},
-std::array<float,2>{0.849520624f, 0.0753031671f},
-std::array<float,2>{0.133133516f, 0.934870422f},
-std::array<float,2>{0.760098815f, 0.571961761f},
-std::array<float,2>{0.22475858f, 0.288986325f},
-std::array<float,2>{0.744760513f, 0.139349476f},
-std::array<float,2>{0.3230654f, 0.835800648f},
-std::array<float,2>{0.518818557f, 0.950088024f},
-std::array<float,2>{0.495012224f, 0.0568111576f},
-std::array<float,2>{0.90778023f, 0.469679475f},
-std::array<float,2>{0.0843721554f, 0.741560817f},
-std::array<float,2>{0.929596007f, 0.999978602f},
-std::array<float,2>{0.0627592355f, 0.0204155743f},
-std::array<float,2>{0.503716111f, 0.457645893f},
-std::array<float,2>{0.469614208f, 0.716057181f},
-std::array<float,2>{0.731106758f, 0.623280942f},
-std::array<float,2>{0.336480945f, 0.256714314f},
-std::array<float,2>{0.772391558f, 0.184884787f},
-std::array<float,2>{0.244502172f, 0.855747044f},
-std::array<float,2>{0.863948286f, 0.643904746f},
-std::array<float,2>{0.142000765f, 0.411942422f},
-std::array<float,2>{0.658219278f, 0.102564245f},
-std::array<float,2>{0.303389341f, 0.894790053f},
-std::array<float,2>{0.58103925f, 0.807452023f},
-std::array<float,2>{0.421050131f, 0.216031402f},
-std::array<float,2>{0.98430407f, 0.366111755f},
-std::array<float,2>{0.0605126955f, 0.555761158f},
-std::array<float,2>{0.794185817f, 0.827857554f},
-std::array<float,2>{0.203822047f, 0.147389814f},
-std::array<float,2>{0.700027823f, 0.305760562f},
-std::array<float,2>{0.352016032f, 0.579945982f},
-std::array<float,2>{0.539309204f, 0.722774148f},
-std::array<float,2>{0.456714332f, 0.485708892f},
-std::array<float,2>{0.904293239f, 0.0415447392f},
-std::array<float,2>{0.11217618f, 0.959990084f},
-std::array<float,2>{0.961254656f, 0.509712338f},
-std::array<float,2>{0.0195789244f, 0.328770757f},
-std::array<float,2>{0.610901654f, 0.228063926f},
-std::array<float,2>{0.383135319f, 0.751128435f},
-std::array<float,2>{0.644885778f, 0.920471728f},
-std::array<float,2>{0.258693516f, 0.085708037f},
-std::array<float,2>{0.840991735f, 0.400042266f},
-std::array<float,2>{0.185250938f, 0.683062255f},
-std::array<float,2>{0.828851581f, 0.947116911f},
-std::array<float,2>{0.172354147f, 0.0610795505f},
-std::array<float,2>{0.65254885f, 0.474120051f},
-std::array<float,2>{0.253193647f, 0.734875381f},
-std::array<float,2>{0.622074902f, 0.577172637f},
-std::array<float,2>{0.382470995f, 0.282687634f},
-std::array<float,2>{0.955842912f, 0.135337114f},
-std::array<float,2>{0.0292153526f, 0.829405725f},
-std::array<float,2>{0.893425882f, 0.661482573f},
-std::array<float,2>{0.120305307f, 0.386527479f},
-std::array<float,2>{0.532028794f, 0.0710683838f},
-std::array<float,2>{0.461480647f, 0.931926191f},
-std::array<float,2>{0.687562406f, 0.773125887f},
-std::array<float,2>{0.349605232f, 0.235627607f},
-std::array<float,2>{0.78348738f, 0.322008044f},
-std::array<float,2>{0.214916021f, 0.522370458f},
-std::array<float,2>{0.975860834f, 0.863297284f},
-std::array<float,2>{0.0526636802f, 0.168158382f},
-std::array<float,2>{0.586756945f, 0.265786737f},
-std::array<float,2>{0.410362631f, 0.606038332f},
-std::array<float,2>{0.664536774f, 0.701956511f},
-std::array<float,2>{0.305365175f, 0.451439828f},
-std::array<float,2>{0.867875099f, 0.0148401167f},
-std::array<float,2>{0.154512882f, 0.975797236f},
-std::array<float,2>{0.779237986f, 0.538299382f},
-std::array<float,2>{0.237759888f, 0.357314974f},
-std::array<float,2>{0.723821223f, 0.202437177f},
-std::array<float,2>{0.332995117f, 0.783246696f},
-std::array<float,2>{0.510661721f, 0.87753731f},
-std::array<float,2>{0.479780257f, 0.124941669f},
-std::array<float,2>{0.931779683f, 0.431984603f},
-std::array<float,2>{0.0721265823f, 0.640258908f},
-std::array<float,2>{0.916976392f, 0.917964995f},
-std::array<float,2>{0.0935976356f, 0.0796600208f},
-std::array<float,2>{0.523922086f, 0.403486013f},
-std::array<float,2>{0.49008134f, 0.684746623f},
-std::array<float,2>{0.736412883f, 0.514956772f},
-std::array<float,2>{0.31276983f, 0.335346937f},
-std::array<float,2>{0.755684078f, 0.233322635f},
-std::array<float,2>{0.226717189f, 0.756852031f},
-std::array<float,2>{0.852803528f, 0.719096184f},
-std::array<float,2>{0.129713133f, 0.491575181f},
-std::array<float,2>{0.676208019f, 0.0447138175f},
-std::array<float,2>{0.283795208f, 0.956754684f},
-std::array<float,2>{0.571165323f, 0.821681976f},
-std::array<float,2>{0.434751391f, 0.143032119f},
-std::array<float,2>{0.999561846f, 0.311159551f},
-std::array<float,2>{0.0395728424f, 0.584812641f},
-std::array<float,2>{0.800652027f, 0.811789513f},
-std::array<float,2>{0.198957801f, 0.213880405f},
-std::array<float,2>{0.711148918f, 0.360821605f},
-std::array<float,2>{0.359711438f, 0.559999406f},
-std::array<float,2>{0.552500188f, 0.64639467f},
-std::array<float,2>{0.444067627f, 0.407411993f},
-std::array<float,2>{0.889686704f, 0.107010104f},
-std::array<float,2>{0.103062682f, 0.892261684f},
-std::array<float,2>{0.942319036f, 0.619224787f},
-std::array<float,2>{0.00104550109f, 0.25075388f},
-std::array<float,2>{0.606700003f, 0.182242319f},
-std::array<float,2>{0.396559805f, 0.855020106f},
-std::array<float,2>{0.634099424f, 0.996091962f},
-std::array<float,2>{0.278964639f, 0.0177983325f},
-std::array<float,2>{0.813051581f, 0.45573023f},
-std::array<float,2>{0.170975402f, 0.71267134f},
-std::array<float,2>{0.763774037f, 0.900699258f},
-std::array<float,2>{0.219921023f, 0.0938376859f},
-std::array<float,2>{0.749329686f, 0.415361375f},
-std::array<float,2>{0.327875495f, 0.651040196f},
-std::array<float,2>{0.521847963f, 0.551427066f},
-std::array<float,2>{0.498135179f, 0.370888621f},
-std::array<float,2>{0.911447644f, 0.210896686f},
-std::array<float,2>{0.0794163644f, 0.802510023f},
-std::array<float,2>{0.987137496f, 0.705682516f},
-std::array<float,2>{0.0369884931f, 0.467271715f},
-std::array<float,2>{0.569137037f, 0.0259598661f},
-std::array<float,2>{0.428751111f, 0.989470899f},
-std::array<float,2>{0.684679329f, 0.850408375f},
-std::array<float,2>{0.296465695f, 0.178241611f},
-std::array<float,2>{0.844572186f, 0.259748548f},
-std::array<float,2>{0.138307407f, 0.612798154f},
-std::array<float,2>{0.880928099f, 0.764438808f},
-std::array<float,2>{0.0978004783f, 0.225584775f},
-std::array<float,2>{0.557471991f, 0.337269962f},
-std::array<float,2>{0.446897358f, 0.502128243f},
-std::array<float,2>{0.704551399f, 0.67407769f},
-std::array<float,2>{0.36996901f, 0.394118041f},
-std::array<float,2>{0.805453479f, 0.0896891579f},
-std::array<float,2>{0.193043292f, 0.912674785f},
-std::array<float,2>{0.824275851f, 0.592347383f},
-std::array<float,2>{0.158839867f, 0.303209186f},
-std::array<float,2>{0.626784384f, 0.155392975f},
-std::array<float,2>{0.26841861f, 0.817475677f},
-std::array<float,2>{0.597916603f, 0.963865519f},
-std::array<float,2>{0.400563747f, 0.0362539142f},
-std::array<float,2>{0.948470056f, 0.496603966f},
-std::array<float,2>{0.0128466338f, 0.733721495f},
-std::array<float,2>{0.967836738f, 0.97707051f},
-std::array<float,2>{0.0177686587f, 0.00713963201f},
-std::array<float,2>{0.613683522f, 0.443072647f},
-std::array<float,2>{0.387295127f, 0.69231987f},
-std::array<float,2>{0.644359589f, 0.596638978f},
-std::array<float,2>{0.263333827f, 0.274101496f},
-std::array<float,2>{0.836812854f, 0.163582593f},
-std::array<float,2>{0.1800538f, 0.873054802f},
-std::array<float,2>{0.789872468f, 0.629460096f},
-std::array<float,2>{0.207076147f, 0.42790091f},
-std::array<float,2>{0.696231425f, 0.116793707f},
-std::array<float,2>{0.356411666f, 0.883600295f},
-std::array<float,2>{0.543249011f, 0.791862428f},
-std::array<float,2>{0.459149629f, 0.190269679f},
-std::array<float,2>{0.898854196f, 0.351395726f},
-std::array<float,2>{0.116834737f, 0.544121921f},
-std::array<float,2>{0.862319469f, 0.841633737f},
-std::array<float,2>{0.147803664f, 0.126485974f},
-std::array<float,2>{0.664003968f, 0.293362767f},
-std::array<float,2>{0.298707724f, 0.567691505f},
-std::array<float,2>{0.582515061f, 0.74386698f},
-std::array<float,2>{0.414313167f, 0.476656109f},
-std::array<float,2>{0.9774248f, 0.0525906049f},
-std::array<float,2>{0.0579277053f, 0.941572607f},
-std::array<float,2>{0.924961805f, 0.529952228f},
-std::array<float,2>{0.0670465305f, 0.313590258f},
-std::array<float,2>{0.506151795f, 0.248061076f},
-std::array<float,2>{0.473522037f, 0.776021361f},
-std::array<float,2>{0.727185071f, 0.925018907f},
-std::array<float,2>{0.341035932f, 0.0689533725f},
-std::array<float,2>{0.768324554f, 0.378844768f},
-std::array<float,2>{0.247165605f, 0.668872178f},
-std::array<float,2>{0.787845552f, 0.98747766f},
-std::array<float,2>{0.212669373f, 0.028526213f},
-std::array<float,2>{0.691412807f, 0.464795649f},
-std::array<float,2>{0.346138716f, 0.710385382f},
-std::array<float,2>{0.537739277f, 0.613316417f},
-std::array<float,2>{0.46803987f, 0.265562773f},
-std::array<float,2>{0.898257375f, 0.175317854f},
-std::array<float,2>{0.121111199f, 0.84679383f},
-std::array<float,2>{0.960172772f, 0.65322274f},
-std::array<float,2>{0.0249197278f, 0.420486361f},
-std::array<float,2>{0.619512916f, 0.0987034664f},
-std::array<float,2>{0.375473022f, 0.90361613f},
-std::array<float,2>{0.648778439f, 0.799903154f},
-std::array<float,2>{0.256473243f, 0.206901744f},
-std::array<float,2>{0.835909367f, 0.373498052f},
-std::array<float,2>{0.175874099f, 0.549728751f},
-std::array<float,2>{0.937072158f, 0.816096425f},
-std::array<float,2>{0.0761772394f, 0.15175806f},
-std::array<float,2>{0.514900208f, 0.296931118f},
-std::array<float,2>{0.483277917f, 0.585988641f},
-std::array<float,2>{0.718849421f, 0.730137408f},
-std::array<float,2>{0.329205096f, 0.494570643f},
-std::array<float,2>{0.773513734f, 0.0351115242f},
-std::array<float,2>{0.241868392f, 0.96647197f},
-std::array<float,2>{0.872574389f, 0.504811823f},
-std::array<float,2>{0.150990888f, 0.342931032f},
-std::array<float,2>{0.669161022f, 0.22051774f},
-std::array<float,2>{0.311093777f, 0.758024693f},
-std::array<float,2>{0.593448639f, 0.908034921f},
-std::array<float,2>{0.407205105f, 0.0919234753f},
-std::array<float,2>{0.972038686f, 0.395295918f},
-std::array<float,2>{0.0478777103f, 0.67793715f},
-std::array<float,2>{0.993797779f, 0.89035356f},
-std::array<float,2>{0.0461156741f, 0.110366769f},
-std::array<float,2>{0.576213241f, 0.424792737f},
-std::array<float,2>{0.433384985f, 0.626819789f},
-std::array<float,2>{0.673687816f, 0.53913641f},
-std::array<float,2>{0.289054841f, 0.347255826f},
-std::array<float,2>{0.858541846f, 0.193710849f},
-std::array<float,2>{0.128777698f, 0.795726538f},
-std::array<float,2>{0.753416836f, 0.690559328f},
-std::array<float,2>{0.232986599f, 0.439515382f},
-std::array<float,2>{0.74136591f, 0.00259976136f},
-std::array<float,2>{0.319766909f, 0.984240234f},
-std::array<float,2>{0.530572951f, 0.868653595f},
-std::array<float,2>{0.487372428f, 0.159044102f},
-std::array<float,2>{0.920117676f, 0.279234439f},
-std::array<float,2>{0.089038454f, 0.600776076f},
-std::array<float,2>{0.819855869f, 0.780246377f},
-std::array<float,2>{0.167626888f, 0.245806396f},
-std::array<float,2>{0.640030742f, 0.319472969f},
-std::array<float,2>{0.275277525f, 0.525614917f},
-std::array<float,2>{0.604161024f, 0.666210175f},
-std::array<float,2>{0.393277109f, 0.379918098f},
-std::array<float,2>{0.939543962f, 0.0642743334f},
-std::array<float,2>{0.00717489514f, 0.927951753f},
-std::array<float,2>{0.883711398f, 0.563803971f},
-std::array<float,2>{0.109317578f, 0.292263746f},
-std::array<float,2>{0.547611535f, 0.131171569f},
-std::array<float,2>{0.43895635f, 0.835995972f},
-std::array<float,2>{0.715366006f, 0.937618911f},
-std::array<float,2>{0.367120802f, 0.0506292693f},
-std::array<float,2>{0.802295506f, 0.484336048f},
-std::array<float,2>{0.200394854f, 0.747789085f},
-std::array<float,2>{0.850906014f, 0.93652916f},
-std::array<float,2>{0.136224791f, 0.0777750239f},
-std::array<float,2>{0.683376312f, 0.389264435f},
-std::array<float,2>{0.289809912f, 0.658416688f},
-std::array<float,2>{0.565411031f, 0.518265426f},
-std::array<float,2>{0.423453808f, 0.328034073f},
-std::array<float,2>{0.990582883f, 0.241219565f},
-std::array<float,2>{0.0321738198f, 0.767594934f},
-std::array<float,2>{0.909435689f, 0.740013719f},
-std::array<float,2>{0.0822595954f, 0.472071528f},
-std::array<float,2>{0.51607424f, 0.0557639264f},
-std::array<float,2>{0.493504614f, 0.953083813f},
-std::array<float,2>{0.744090736f, 0.83371377f},
-std::array<float,2>{0.32143873f, 0.137635559f},
-std::array<float,2>{0.759002566f, 0.285185575f},
-std::array<float,2>{0.223246336f, 0.574123502f},
-std::array<float,2>{0.95280993f, 0.785922647f},
-std::array<float,2>{0.0113489963f, 0.198006749f},
-std::array<float,2>{0.59431839f, 0.354539007f},
-std::array<float,2>{0.404715091f, 0.533067405f},
-std::array<float,2>{0.629241228f, 0.635267437f},
-std::array<float,2>{0.272923559f, 0.434899271f},
-std::array<float,2>{0.82345432f, 0.118362091f},
-std::array<float,2>{0.162059486f, 0.881721795f},
-std::array<float,2>{0.81057471f, 0.603199184f},
-std::array<float,2>{0.190856725f, 0.27295664f},
-std::array<float,2>{0.710360825f, 0.165348977f},
-std::array<float,2>{0.373653293f, 0.863035738f},
-std::array<float,2>{0.561731875f, 0.969153345f},
-std::array<float,2>{0.451986313f, 0.00863584969f},
-std::array<float,2>{0.875650525f, 0.449100971f},
-std::array<float,2>{0.0969047323f, 0.695883393f},
-std::array<float,2>{0.905957818f, 0.957187891f},
-std::array<float,2>{0.110411853f, 0.0397353619f},
-std::array<float,2>{0.541610241f, 0.487349033f},
-std::array<float,2>{0.453797638f, 0.725849807f},
-std::array<float,2>{0.701615393f, 0.580584645f},
-std::array<float,2>{0.354133815f, 0.306892455f},
-std::array<float,2>{0.795640409f, 0.14638783f},
-std::array<float,2>{0.205872834f, 0.825825334f},
-std::array<float,2>{0.843174934f, 0.681259215f},
-std::array<float,2>{0.186539844f, 0.401653349f},
-std::array<float,2>{0.648213685f, 0.0825207829f},
-std::array<float,2>{0.260634691f, 0.919542551f},
-std::array<float,2>{0.612508535f, 0.752403021f},
-std::array<float,2>{0.386101961f, 0.229052335f},
-std::array<float,2>{0.963170171f, 0.330481857f},
-std::array<float,2>{0.0215860605f, 0.511144817f},
-std::array<float,2>{0.771270633f, 0.857898533f},
-std::array<float,2>{0.243866146f, 0.18585366f},
-std::array<float,2>{0.73387903f, 0.255828828f},
-std::array<float,2>{0.338937402f, 0.622691274f},
-std::array<float,2>{0.500641882f, 0.717215061f},
-std::array<float,2>{0.471582144f, 0.459560335f},
-std::array<float,2>{0.927671313f, 0.0233189706f},
-std::array<float,2>{0.0652754307f, 0.997315288f},
-std::array<float,2>{0.981051147f, 0.557466865f},
-std::array<float,2>{0.0616640262f, 0.364985913f},
-std::array<float,2>{0.579918683f, 0.217070162f},
-std::array<float,2>{0.419288546f, 0.806357265f},
-std::array<float,2>{0.656546712f, 0.897762775f},
-std::array<float,2>{0.301324278f, 0.103929147f},
-std::array<float,2>{0.865846574f, 0.41234079f},
-std::array<float,2>{0.14390853f, 0.642456591f},
-std::array<float,2>{0.813829184f, 0.993893206f},
-std::array<float,2>{0.169983193f, 0.0159094147f},
-std::array<float,2>{0.633006752f, 0.454195589f},
-std::array<float,2>{0.277532548f, 0.714629829f},
-std::array<float,2>{0.606283247f, 0.618918359f},
-std::array<float,2>{0.397553831f, 0.252982527f},
-std::array<float,2>{0.943069339f, 0.180878863f},
-std::array<float,2>{0.000159265881f, 0.852841854f},
-std::array<float,2>{0.888858855f, 0.647593319f},
-std::array<float,2>{0.102243714f, 0.408253312f},
-std::array<float,2>{0.551300764f, 0.108224317f},
-std::array<float,2>{0.445305794f, 0.893673301f},
-std::array<float,2>{0.712438107f, 0.809462905f},
-std::array<float,2>{0.36065799f, 0.211423665f},
-std::array<float,2>{0.799512267f, 0.36251393f},
-std::array<float,2>{0.197414026f, 0.560794592f},
-std::array<float,2>{0.998979867f, 0.823835671f},
-std::array<float,2>{0.0402984731f, 0.141137972f},
-std::array<float,2>{0.571487665f, 0.309166551f},
-std::array<float,2>{0.434310913f, 0.582861304f},
-std::array<float,2>{0.677613974f, 0.721627653f},
-std::array<float,2>{0.285006821f, 0.48937121f},
-std::array<float,2>{0.851588607f, 0.0455567315f},
-std::array<float,2>{0.130201355f, 0.953396678f},
-std::array<float,2>{0.754184842f, 0.512255192f},
-std::array<float,2>{0.22764577f, 0.332666367f},
-std::array<float,2>{0.737703264f, 0.231629848f},
-std::array<float,2>{0.313600421f, 0.754116833f},
-std::array<float,2>{0.524763346f, 0.915929914f},
-std::array<float,2>{0.488901824f, 0.0803415477f},
-std::array<float,2>{0.917188168f, 0.405753881f},
-std::array<float,2>{0.0927096158f, 0.686013758f},
-std::array<float,2>{0.933139443f, 0.875514984f},
-std::array<float,2>{0.070501335f, 0.121769339f},
-std::array<float,2>{0.510965466f, 0.430639207f},
-std::array<float,2>{0.479162812f, 0.638537049f},
-std::array<float,2>{0.72345674f, 0.53524071f},
-std::array<float,2>{0.333175033f, 0.359059811f},
-std::array<float,2>{0.778292298f, 0.200463295f},
-std::array<float,2>{0.236694619f, 0.781871796f},
-std::array<float,2>{0.868696809f, 0.700333059f},
-std::array<float,2>{0.155371338f, 0.449705958f},
-std::array<float,2>{0.665332675f, 0.0129503962f},
-std::array<float,2>{0.305837721f, 0.973890781f},
-std::array<float,2>{0.587193251f, 0.865335226f},
-std::array<float,2>{0.411214679f, 0.170075938f},
-std::array<float,2>{0.975393653f, 0.268836707f},
-std::array<float,2>{0.0514823422f, 0.608820379f},
-std::array<float,2>{0.784299612f, 0.770124912f},
-std::array<float,2>{0.21617189f, 0.23770465f},
-std::array<float,2>{0.689105988f, 0.322916597f},
-std::array<float,2>{0.348486453f, 0.520328999f},
-std::array<float,2>{0.532690763f, 0.663024068f},
-std::array<float,2>{0.462070704f, 0.382864743f},
-std::array<float,2>{0.893961966f, 0.0739897341f},
-std::array<float,2>{0.119818218f, 0.929860651f},
-std::array<float,2>{0.956306458f, 0.576159954f},
-std::array<float,2>{0.028054541f, 0.283900678f},
-std::array<float,2>{0.621245742f, 0.133664563f},
-std::array<float,2>{0.381384104f, 0.830555141f},
-std::array<float,2>{0.654138207f, 0.947657764f},
-std::array<float,2>{0.252040327f, 0.0605232008f},
-std::array<float,2>{0.829163849f, 0.475441337f},
-std::array<float,2>{0.173536465f, 0.736485481f},
-std::array<float,2>{0.768953323f, 0.922379673f},
-std::array<float,2>{0.246376336f, 0.068175979f},
-std::array<float,2>{0.728046238f, 0.376528114f},
-std::array<float,2>{0.340412468f, 0.670686603f},
-std::array<float,2>{0.507371247f, 0.528331637f},
-std::array<float,2>{0.473700851f, 0.315195203f},
-std::array<float,2>{0.924012959f, 0.246346623f},
-std::array<float,2>{0.0678635165f, 0.773673654f},
-std::array<float,2>{0.978139997f, 0.744552851f},
-std::array<float,2>{0.0573775135f, 0.479253352f},
-std::array<float,2>{0.583291233f, 0.0527528226f},
-std::array<float,2>{0.415777773f, 0.944507957f},
-std::array<float,2>{0.662928104f, 0.841973305f},
-std::array<float,2>{0.297152668f, 0.128727689f},
-std::array<float,2>{0.861425877f, 0.295754969f},
-std::array<float,2>{0.147088155f, 0.569312572f},
-std::array<float,2>{0.899612069f, 0.790460229f},
-std::array<float,2>{0.115621544f, 0.188526168f},
-std::array<float,2>{0.544808567f, 0.348485202f},
-std::array<float,2>{0.460214943f, 0.546435058f},
-std::array<float,2>{0.697004914f, 0.632781982f},
-std::array<float,2>{0.356593281f, 0.426547855f},
-std::array<float,2>{0.790265143f, 0.114013344f},
-std::array<float,2>{0.208683819f, 0.885318458f},
-std::array<float,2>{0.837196052f, 0.593903661f},
-std::array<float,2>{0.180888817f, 0.276002109f},
-std::array<float,2>{0.643548369f, 0.161392078f},
-std::array<float,2>{0.261732996f, 0.871810913f},
-std::array<float,2>{0.614916384f, 0.980004251f},
-std::array<float,2>{0.388119966f, 0.0053115082f},
-std::array<float,2>{0.967604816f, 0.444341272f},
-std::array<float,2>{0.0186875798f, 0.693506479f},
-std::array<float,2>{0.948192716f, 0.961514771f},
-std::array<float,2>{0.0123523297f, 0.0371916629f},
-std::array<float,2>{0.599238098f, 0.498349786f},
-std::array<float,2>{0.40170157f, 0.731412888f},
-std::array<float,2>{0.625044942f, 0.590776801f},
-std::array<float,2>{0.269310296f, 0.30265215f},
-std::array<float,2>{0.825523317f, 0.152681589f},
-std::array<float,2>{0.159504369f, 0.818858802f},
-std::array<float,2>{0.805669069f, 0.672356904f},
-std::array<float,2>{0.191423312f, 0.391765654f},
-std::array<float,2>{0.703719616f, 0.0870538205f},
-std::array<float,2>{0.370943129f, 0.911975861f},
-std::array<float,2>{0.558433235f, 0.762233198f},
-std::array<float,2>{0.446169257f, 0.222991824f},
-std::array<float,2>{0.881965399f, 0.338987738f},
-std::array<float,2>{0.0988171399f, 0.500374615f},
-std::array<float,2>{0.845038593f, 0.848032475f},
-std::array<float,2>{0.137134224f, 0.177361935f},
-std::array<float,2>{0.683847964f, 0.260699421f},
-std::array<float,2>{0.295808613f, 0.611200452f},
-std::array<float,2>{0.570284426f, 0.703855038f},
-std::array<float,2>{0.427979529f, 0.465562224f},
-std::array<float,2>{0.987417459f, 0.0242251828f},
-std::array<float,2>{0.0354144908f, 0.990489841f},
-std::array<float,2>{0.910521924f, 0.554069102f},
-std::array<float,2>{0.0785018578f, 0.368926674f},
-std::array<float,2>{0.522976756f, 0.208304673f},
-std::array<float,2>{0.499605089f, 0.804207444f},
-std::array<float,2>{0.74836117f, 0.899067223f},
-std::array<float,2>{0.327081412f, 0.095877409f},
-std::array<float,2>{0.765175164f, 0.417079061f},
-std::array<float,2>{0.218808308f, 0.648658574f},
-std::array<float,2>{0.801087856f, 0.941168308f},
-std::array<float,2>{0.199908301f, 0.0485975519f},
-std::array<float,2>{0.71602881f, 0.481377274f},
-std::array<float,2>{0.365835249f, 0.748905301f},
-std::array<float,2>{0.548354447f, 0.565217674f},
-std::array<float,2>{0.437547565f, 0.29057458f},
-std::array<float,2>{0.883984506f, 0.129073784f},
-std::array<float,2>{0.107492752f, 0.839635909f},
-std::array<float,2>{0.940849304f, 0.665905654f},
-std::array<float,2>{0.0059626326f, 0.382489115f},
-std::array<float,2>{0.60492897f, 0.0652758703f},
-std::array<float,2>{0.394047767f, 0.926124036f},
-std::array<float,2>{0.639467061f, 0.779091775f},
-std::array<float,2>{0.273526698f, 0.243353307f},
-std::array<float,2>{0.819219053f, 0.317114711f},
-std::array<float,2>{0.166060582f, 0.523458481f},
-std::array<float,2>{0.921147108f, 0.869233966f},
-std::array<float,2>{0.0884242281f, 0.156995624f},
-std::array<float,2>{0.529585898f, 0.28028971f},
-std::array<float,2>{0.486454815f, 0.599340677f},
-std::array<float,2>{0.740899205f, 0.688714147f},
-std::array<float,2>{0.319200724f, 0.439221919f},
-std::array<float,2>{0.752892077f, 0.000783144904f},
-std::array<float,2>{0.234250918f, 0.982401192f},
-std::array<float,2>{0.858205974f, 0.541362524f},
-std::array<float,2>{0.127126694f, 0.343844533f},
-std::array<float,2>{0.672297597f, 0.191784143f},
-std::array<float,2>{0.287489325f, 0.793878794f},
-std::array<float,2>{0.577417374f, 0.887060106f},
-std::array<float,2>{0.432157785f, 0.111557625f},
-std::array<float,2>{0.9926579f, 0.42331782f},
-std::array<float,2>{0.0454631597f, 0.628451824f},
-std::array<float,2>{0.971230924f, 0.90861094f},
-std::array<float,2>{0.0472444706f, 0.0900625139f},
-std::array<float,2>{0.591969609f, 0.397356242f},
-std::array<float,2>{0.407401234f, 0.676016092f},
-std::array<float,2>{0.668498158f, 0.507409871f},
-std::array<float,2>{0.311873376f, 0.340125978f},
-std::array<float,2>{0.871197045f, 0.222182959f},
-std::array<float,2>{0.15139927f, 0.760657072f},
-std::array<float,2>{0.774907529f, 0.727301359f},
-std::array<float,2>{0.240534306f, 0.493656874f},
-std::array<float,2>{0.719842851f, 0.0321717784f},
-std::array<float,2>{0.328296721f, 0.96816361f},
-std::array<float,2>{0.514208138f, 0.813979208f},
-std::array<float,2>{0.483838826f, 0.149545729f},
-std::array<float,2>{0.935703337f, 0.300199062f},
-std::array<float,2>{0.0775705725f, 0.587932825f},
-std::array<float,2>{0.834117115f, 0.798362195f},
-std::array<float,2>{0.176871032f, 0.204146326f},
-std::array<float,2>{0.649719596f, 0.371816993f},
-std::array<float,2>{0.257335275f, 0.547514141f},
-std::array<float,2>{0.620862007f, 0.655039907f},
-std::array<float,2>{0.376765788f, 0.418271691f},
-std::array<float,2>{0.959339321f, 0.100786909f},
-std::array<float,2>{0.0234969929f, 0.904953957f},
-std::array<float,2>{0.896537483f, 0.615483522f},
-std::array<float,2>{0.122180581f, 0.262738049f},
-std::array<float,2>{0.538657188f, 0.172868565f},
-std::array<float,2>{0.46759057f, 0.845078051f},
-std::array<float,2>{0.693310797f, 0.985783041f},
-std::array<float,2>{0.34719336f, 0.0309883319f},
-std::array<float,2>{0.788390934f, 0.461048096f},
-std::array<float,2>{0.211236641f, 0.7079916f},
-std::array<float,2>{0.866600633f, 0.89640671f},
-std::array<float,2>{0.142905399f, 0.101644814f},
-std::array<float,2>{0.65725404f, 0.410202384f},
-std::array<float,2>{0.301855952f, 0.642652094f},
-std::array<float,2>{0.578423202f, 0.555320919f},
-std::array<float,2>{0.418381065f, 0.366240442f},
-std::array<float,2>{0.98232609f, 0.215250328f},
-std::array<float,2>{0.0610617884f, 0.808027148f},
-std::array<float,2>{0.926592469f, 0.715295196f},
-std::array<float,2>{0.0660775974f, 0.458260775f},
-std::array<float,2>{0.501593888f, 0.0205144007f},
-std::array<float,2>{0.472273886f, 0.998178363f},
-std::array<float,2>{0.733095646f, 0.856559813f},
-std::array<float,2>{0.338205665f, 0.183816329f},
-std::array<float,2>{0.770268083f, 0.256940335f},
-std::array<float,2>{0.242490068f, 0.624373496f},
-std::array<float,2>{0.964808822f, 0.7504282f},
-std::array<float,2>{0.0232317913f, 0.227092773f},
-std::array<float,2>{0.611622632f, 0.33006686f},
-std::array<float,2>{0.385125339f, 0.508083642f},
-std::array<float,2>{0.646842837f, 0.68213284f},
-std::array<float,2>{0.261449814f, 0.39853552f},
-std::array<float,2>{0.841837823f, 0.0841834694f},
-std::array<float,2>{0.186067015f, 0.921028495f},
-std::array<float,2>{0.796594024f, 0.57875371f},
-std::array<float,2>{0.206270918f, 0.305214614f},
-std::array<float,2>{0.702673495f, 0.148179576f},
-std::array<float,2>{0.354690552f, 0.826475859f},
-std::array<float,2>{0.542391896f, 0.959768355f},
-std::array<float,2>{0.454971462f, 0.0420892686f},
-std::array<float,2>{0.904861927f, 0.484808445f},
-std::array<float,2>{0.109727472f, 0.72455126f},
-std::array<float,2>{0.876889348f, 0.97156477f},
-std::array<float,2>{0.0959208533f, 0.0100321984f},
-std::array<float,2>{0.561236739f, 0.445591062f},
-std::array<float,2>{0.453060001f, 0.698647141f},
-std::array<float,2>{0.709932029f, 0.604616404f},
-std::array<float,2>{0.374148875f, 0.271116614f},
-std::array<float,2>{0.81240046f, 0.166829675f},
-std::array<float,2>{0.18989709f, 0.860110819f},
-std::array<float,2>{0.822293282f, 0.63460809f},
-std::array<float,2>{0.160933882f, 0.435587853f},
-std::array<float,2>{0.630516529f, 0.120946541f},
-std::array<float,2>{0.272245884f, 0.880302906f},
-std::array<float,2>{0.595631659f, 0.788095176f},
-std::array<float,2>{0.405534089f, 0.196336344f},
-std::array<float,2>{0.951564074f, 0.352042288f},
-std::array<float,2>{0.0103061609f, 0.533430696f},
-std::array<float,2>{0.7578125f, 0.834598422f},
-std::array<float,2>{0.224165231f, 0.139925599f},
-std::array<float,2>{0.742272973f, 0.287338406f},
-std::array<float,2>{0.320645839f, 0.570430994f},
-std::array<float,2>{0.517040908f, 0.740441442f},
-std::array<float,2>{0.492750049f, 0.469881415f},
-std::array<float,2>{0.908593357f, 0.0581108592f},
-std::array<float,2>{0.0839334056f, 0.950743198f},
-std::array<float,2>{0.991411984f, 0.517194927f},
-std::array<float,2>{0.0326880999f, 0.324380726f},
-std::array<float,2>{0.566092193f, 0.239254117f},
-std::array<float,2>{0.422049254f, 0.766148806f},
-std::array<float,2>{0.681759536f, 0.933954775f},
-std::array<float,2>{0.290961206f, 0.0743779466f},
-std::array<float,2>{0.849975646f, 0.387868315f},
-std::array<float,2>{0.135630876f, 0.657030225f},
-std::array<float,2>{0.854841471f, 0.955674887f},
-std::array<float,2>{0.131954342f, 0.0438204594f},
-std::array<float,2>{0.679665983f, 0.491168708f},
-std::array<float,2>{0.282174438f, 0.719804108f},
-std::array<float,2>{0.573904157f, 0.585263789f},
-std::array<float,2>{0.436081439f, 0.311811954f},
-std::array<float,2>{0.996360362f, 0.143991888f},
-std::array<float,2>{0.0426853187f, 0.820408583f},
-std::array<float,2>{0.915363371f, 0.684503913f},
-std::array<float,2>{0.0909175426f, 0.403165042f},
-std::array<float,2>{0.52644819f, 0.0782903656f},
-std::array<float,2>{0.491052777f, 0.916845143f},
-std::array<float,2>{0.73601824f, 0.756212354f},
-std::array<float,2>{0.315498918f, 0.233426705f},
-std::array<float,2>{0.756524086f, 0.334354609f},
-std::array<float,2>{0.230297387f, 0.514563799f},
-std::array<float,2>{0.945263743f, 0.85404247f},
-std::array<float,2>{0.00342083257f, 0.182726189f},
-std::array<float,2>{0.608862042f, 0.251146615f},
-std::array<float,2>{0.395208836f, 0.620320201f},
-std::array<float,2>{0.635543406f, 0.711509466f},
-std::array<float,2>{0.27933073f, 0.45628798f},
-std::array<float,2>{0.816013694f, 0.018883856f},
-std::array<float,2>{0.169174761f, 0.99486059f},
-std::array<float,2>{0.797572911f, 0.559366763f},
-std::array<float,2>{0.196197316f, 0.359559864f},
-std::array<float,2>{0.714486539f, 0.213309407f},
-std::array<float,2>{0.361662179f, 0.810753286f},
-std::array<float,2>{0.553230703f, 0.891465306f},
-std::array<float,2>{0.44181788f, 0.106249698f},
-std::array<float,2>{0.887154698f, 0.406848639f},
-std::array<float,2>{0.104571968f, 0.645439386f},
-std::array<float,2>{0.891130686f, 0.932688594f},
-std::array<float,2>{0.117660724f, 0.0722346604f},
-std::array<float,2>{0.534470677f, 0.385080874f},
-std::array<float,2>{0.464816123f, 0.660191357f},
-std::array<float,2>{0.691010773f, 0.5227651f},
-std::array<float,2>{0.349891037f, 0.320885271f},
-std::array<float,2>{0.782150805f, 0.235010043f},
-std::array<float,2>{0.217616111f, 0.771519005f},
-std::array<float,2>{0.831122935f, 0.735811949f},
-std::array<float,2>{0.175637126f, 0.473188668f},
-std::array<float,2>{0.655578077f, 0.0619619526f},
-std::array<float,2>{0.250193566f, 0.946284652f},
-std::array<float,2>{0.624880135f, 0.828578115f},
-std::array<float,2>{0.379903942f, 0.136258736f},
-std::array<float,2>{0.954212427f, 0.281464309f},
-std::array<float,2>{0.0308267195f, 0.57640785f},
-std::array<float,2>{0.780272424f, 0.78494066f},
-std::array<float,2>{0.235861331f, 0.201445386f},
-std::array<float,2>{0.725865185f, 0.356406331f},
-std::array<float,2>{0.335391968f, 0.53738451f},
-std::array<float,2>{0.509287655f, 0.639450073f},
-std::array<float,2>{0.477176458f, 0.433198839f},
-std::array<float,2>{0.930372179f, 0.123621196f},
-std::array<float,2>{0.0725247562f, 0.878795326f},
-std::array<float,2>{0.974223673f, 0.606563628f},
-std::array<float,2>{0.0530356243f, 0.267520249f},
-std::array<float,2>{0.588603556f, 0.169428214f},
-std::array<float,2>{0.414039969f, 0.864614964f},
-std::array<float,2>{0.666647255f, 0.975446999f},
-std::array<float,2>{0.307374001f, 0.0145526398f},
-std::array<float,2>{0.870392919f, 0.452501267f},
-std::array<float,2>{0.153112382f, 0.702721477f},
-std::array<float,2>{0.791584373f, 0.884667397f},
-std::array<float,2>{0.210417598f, 0.115584262f},
-std::array<float,2>{0.697882056f, 0.429083198f},
-std::array<float,2>{0.357576311f, 0.630190551f},
-std::array<float,2>{0.545909703f, 0.54392451f},
-std::array<float,2>{0.45838964f, 0.349911988f},
-std::array<float,2>{0.901073277f, 0.190986991f},
-std::array<float,2>{0.11331138f, 0.792376399f},
-std::array<float,2>{0.966709375f, 0.693268836f},
-std::array<float,2>{0.0161501281f, 0.441718876f},
-std::array<float,2>{0.615927279f, 0.00635904074f},
-std::array<float,2>{0.390572041f, 0.978476942f},
-std::array<float,2>{0.641774774f, 0.874493599f},
-std::array<float,2>{0.264924854f, 0.162139252f},
-std::array<float,2>{0.839111328f, 0.274590224f},
-std::array<float,2>{0.182855994f, 0.59692359f},
-std::array<float,2>{0.92339468f, 0.776670456f},
-std::array<float,2>{0.069771409f, 0.249434307f},
-std::array<float,2>{0.504367888f, 0.312638849f},
-std::array<float,2>{0.47653085f, 0.53116864f},
-std::array<float,2>{0.72880888f, 0.669328451f},
-std::array<float,2>{0.342399299f, 0.377163291f},
-std::array<float,2>{0.765919566f, 0.0694060773f},
-std::array<float,2>{0.248243228f, 0.923961937f},
-std::array<float,2>{0.859447241f, 0.567341089f},
-std::array<float,2>{0.144755438f, 0.294450611f},
-std::array<float,2>{0.661759973f, 0.125564754f},
-std::array<float,2>{0.300174236f, 0.840568066f},
-std::array<float,2>{0.584739864f, 0.943237245f},
-std::array<float,2>{0.416668177f, 0.0511406176f},
-std::array<float,2>{0.979297757f, 0.478208393f},
-std::array<float,2>{0.0561146922f, 0.742399514f},
-std::array<float,2>{0.98549521f, 0.98888725f},
-std::array<float,2>{0.0375148691f, 0.0265109725f},
-std::array<float,2>{0.567312956f, 0.468557745f},
-std::array<float,2>{0.426680058f, 0.706140339f},
-std::array<float,2>{0.687131047f, 0.611767232f},
-std::array<float,2>{0.294655293f, 0.258150816f},
-std::array<float,2>{0.847600043f, 0.178842023f},
-std::array<float,2>{0.139114514f, 0.851313293f},
-std::array<float,2>{0.762438357f, 0.651670277f},
-std::array<float,2>{0.222624287f, 0.414127231f},
-std::array<float,2>{0.746641874f, 0.0956289098f},
-std::array<float,2>{0.325835228f, 0.901532948f},
-std::array<float,2>{0.521462083f, 0.801260471f},
-std::array<float,2>{0.497988045f, 0.209644318f},
-std::array<float,2>{0.913841128f, 0.369279653f},
-std::array<float,2>{0.0809746757f, 0.552362025f},
-std::array<float,2>{0.827015519f, 0.817225039f},
-std::array<float,2>{0.158081308f, 0.154768512f},
-std::array<float,2>{0.627354085f, 0.304303676f},
-std::array<float,2>{0.266509444f, 0.593412638f},
-std::array<float,2>{0.60135287f, 0.732484043f},
-std::array<float,2>{0.399696738f, 0.497369826f},
-std::array<float,2>{0.94708395f, 0.0353670269f},
-std::array<float,2>{0.0139648775f, 0.964769721f},
-std::array<float,2>{0.880772948f, 0.503261447f},
-std::array<float,2>{0.101490423f, 0.336799771f},
-std::array<float,2>{0.554909527f, 0.226310179f},
-std::array<float,2>{0.447582185f, 0.765340149f},
-std::array<float,2>{0.7068156f, 0.913880825f},
-std::array<float,2>{0.368230343f, 0.0879787579f},
-std::array<float,2>{0.807976425f, 0.393526345f},
-std::array<float,2>{0.194088385f, 0.674815476f},
-std::array<float,2>{0.750297606f, 0.983371973f},
-std::array<float,2>{0.231681898f, 0.00345208705f},
-std::array<float,2>{0.739348412f, 0.441325247f},
-std::array<float,2>{0.316933006f, 0.690303087f},
-std::array<float,2>{0.527369618f, 0.599660039f},
-std::array<float,2>{0.484918892f, 0.277351022f},
-std::array<float,2>{0.91961062f, 0.160062894f},
-std::array<float,2>{0.0867287219f, 0.867395163f},
-std::array<float,2>{0.996059418f, 0.625219166f},
-std::array<float,2>{0.043524608f, 0.42575407f},
-std::array<float,2>{0.575175881f, 0.109938063f},
-std::array<float,2>{0.429700762f, 0.889519989f},
-std::array<float,2>{0.674146116f, 0.796742916f},
-std::array<float,2>{0.286877096f, 0.194961503f},
-std::array<float,2>{0.855877638f, 0.346143872f},
-std::array<float,2>{0.126643673f, 0.54053241f},
-std::array<float,2>{0.885945678f, 0.837357283f},
-std::array<float,2>{0.105609722f, 0.132380098f},
-std::array<float,2>{0.549797475f, 0.29139179f},
-std::array<float,2>{0.441168815f, 0.562609494f},
-std::array<float,2>{0.718127251f, 0.746465623f},
-std::array<float,2>{0.364558071f, 0.482806265f},
-std::array<float,2>{0.804459095f, 0.0488892533f},
-std::array<float,2>{0.202454224f, 0.938829899f},
-std::array<float,2>{0.816450238f, 0.526790917f},
-std::array<float,2>{0.165979281f, 0.319176912f},
-std::array<float,2>{0.636870086f, 0.244988993f},
-std::array<float,2>{0.276104718f, 0.780901968f},
-std::array<float,2>{0.603032708f, 0.929349601f},
-std::array<float,2>{0.39078483f, 0.0634022653f},
-std::array<float,2>{0.939342618f, 0.379130721f},
-std::array<float,2>{0.00472461618f, 0.667519271f},
-std::array<float,2>{0.957937241f, 0.902908266f},
-std::array<float,2>{0.0262635089f, 0.0979692489f},
-std::array<float,2>{0.618100524f, 0.421196133f},
-std::array<float,2>{0.378149033f, 0.65359664f},
-std::array<float,2>{0.651471078f, 0.549893141f},
-std::array<float,2>{0.255310684f, 0.374302328f},
-std::array<float,2>{0.833969474f, 0.205703065f},
-std::array<float,2>{0.178681046f, 0.799094319f},
-std::array<float,2>{0.78642261f, 0.709917843f},
-std::array<float,2>{0.214828029f, 0.463183552f},
-std::array<float,2>{0.695219994f, 0.0277254898f},
-std::array<float,2>{0.344933331f, 0.987093747f},
-std::array<float,2>{0.535453439f, 0.846029937f},
-std::array<float,2>{0.465303957f, 0.173863575f},
-std::array<float,2>{0.896178424f, 0.263981491f},
-std::array<float,2>{0.123690814f, 0.615098238f},
-std::array<float,2>{0.874410808f, 0.759288192f},
-std::array<float,2>{0.148941785f, 0.219011217f},
-std::array<float,2>{0.671782672f, 0.342231959f},
-std::array<float,2>{0.308913887f, 0.504942715f},
-std::array<float,2>{0.589854002f, 0.678726256f},
-std::array<float,2>{0.409267008f, 0.39646101f},
-std::array<float,2>{0.970598161f, 0.0929487571f},
-std::array<float,2>{0.0498875678f, 0.906706572f},
-std::array<float,2>{0.934490621f, 0.587837338f},
-std::array<float,2>{0.0756575167f, 0.298613638f},
-std::array<float,2>{0.513190091f, 0.150974289f},
-std::array<float,2>{0.48103115f, 0.814594269f},
-std::array<float,2>{0.722183347f, 0.965055048f},
-std::array<float,2>{0.330705076f, 0.0341780595f},
-std::array<float,2>{0.775523245f, 0.495252162f},
-std::array<float,2>{0.238932118f, 0.728835523f},
-std::array<float,2>{0.840098441f, 0.918174326f},
-std::array<float,2>{0.183674902f, 0.0830257088f},
-std::array<float,2>{0.64637959f, 0.40093413f},
-std::array<float,2>{0.259658396f, 0.679718375f},
-std::array<float,2>{0.609675467f, 0.510531068f},
-std::array<float,2>{0.384227425f, 0.331525534f},
-std::array<float,2>{0.962061584f, 0.229545802f},
-std::array<float,2>{0.0214353073f, 0.752986908f},
-std::array<float,2>{0.903244495f, 0.72547698f},
-std::array<float,2>{0.112353921f, 0.486808807f},
-std::array<float,2>{0.540589035f, 0.0409556888f},
-std::array<float,2>{0.455809146f, 0.958903849f},
-std::array<float,2>{0.701002419f, 0.825014412f},
-std::array<float,2>{0.353067011f, 0.145014584f},
-std::array<float,2>{0.793616116f, 0.307910293f},
-std::array<float,2>{0.204774693f, 0.581941187f},
-std::array<float,2>{0.982693195f, 0.80518955f},
-std::array<float,2>{0.0587344021f, 0.218685806f},
-std::array<float,2>{0.581274569f, 0.364224613f},
-std::array<float,2>{0.420464605f, 0.557780147f},
-std::array<float,2>{0.660047829f, 0.641143501f},
-std::array<float,2>{0.304652303f, 0.413099647f},
-std::array<float,2>{0.86514622f, 0.104863383f},
-std::array<float,2>{0.141016215f, 0.896605194f},
-std::array<float,2>{0.773408175f, 0.621583223f},
-std::array<float,2>{0.245813727f, 0.254394948f},
-std::array<float,2>{0.731764197f, 0.187038183f},
-std::array<float,2>{0.337147564f, 0.858638823f},
-std::array<float,2>{0.502356231f, 0.996598363f},
-std::array<float,2>{0.470111221f, 0.0218617022f},
-std::array<float,2>{0.92825222f, 0.460716218f},
-std::array<float,2>{0.0644286647f, 0.718299448f},
-std::array<float,2>{0.907215893f, 0.95165205f},
-std::array<float,2>{0.0850037709f, 0.0554417074f},
-std::array<float,2>{0.518497705f, 0.471520215f},
-std::array<float,2>{0.495736063f, 0.739115596f},
-std::array<float,2>{0.745639205f, 0.572972655f},
-std::array<float,2>{0.323834628f, 0.286313832f},
-std::array<float,2>{0.760804534f, 0.138521627f},
-std::array<float,2>{0.226465881f, 0.83203721f},
-std::array<float,2>{0.848264039f, 0.659460247f},
-std::array<float,2>{0.134116501f, 0.389820844f},
-std::array<float,2>{0.680627286f, 0.0768433735f},
-std::array<float,2>{0.29186523f, 0.935710907f},
-std::array<float,2>{0.563759983f, 0.768840253f},
-std::array<float,2>{0.424693197f, 0.240250736f},
-std::array<float,2>{0.98992902f, 0.326610297f},
-std::array<float,2>{0.0341722891f, 0.518756449f},
-std::array<float,2>{0.809892833f, 0.861693203f},
-std::array<float,2>{0.187895924f, 0.164941683f},
-std::array<float,2>{0.70716542f, 0.271511137f},
-std::array<float,2>{0.372661352f, 0.601926386f},
-std::array<float,2>{0.560022533f, 0.697167158f},
-std::array<float,2>{0.450463414f, 0.448184997f},
-std::array<float,2>{0.877740026f, 0.00955884811f},
-std::array<float,2>{0.0944236591f, 0.969928741f},
-std::array<float,2>{0.950601816f, 0.531373978f},
-std::array<float,2>{0.00892120693f, 0.353560269f},
-std::array<float,2>{0.596415222f, 0.198389515f},
-std::array<float,2>{0.403896034f, 0.786387026f},
-std::array<float,2>{0.631706119f, 0.88218838f},
-std::array<float,2>{0.271368682f, 0.118062191f},
-std::array<float,2>{0.820365071f, 0.434012026f},
-std::array<float,2>{0.163845867f, 0.635927022f},
-std::array<float,2>{0.84669596f, 0.991175473f},
-std::array<float,2>{0.139168978f, 0.0237244461f},
-std::array<float,2>{0.686596096f, 0.464883745f},
-std::array<float,2>{0.294221282f, 0.70346576f},
-std::array<float,2>{0.566791356f, 0.610529006f},
-std::array<float,2>{0.425947368f, 0.259807378f},
-std::array<float,2>{0.986314893f, 0.177168399f},
-std::array<float,2>{0.037784785f, 0.84828943f},
-std::array<float,2>{0.913484037f, 0.648995042f},
-std::array<float,2>{0.0802171007f, 0.417614162f},
-std::array<float,2>{0.520519078f, 0.0963296294f},
-std::array<float,2>{0.497106284f, 0.898617446f},
-std::array<float,2>{0.74654609f, 0.804050446f},
-std::array<float,2>{0.325602412f, 0.208550602f},
-std::array<float,2>{0.76185137f, 0.368317246f},
-std::array<float,2>{0.222003892f, 0.554593027f},
-std::array<float,2>{0.946627021f, 0.818517506f},
-std::array<float,2>{0.0143478597f, 0.153108135f},
-std::array<float,2>{0.600627959f, 0.301974237f},
-std::array<float,2>{0.399958014f, 0.590233803f},
-std::array<float,2>{0.627546191f, 0.730955064f},
-std::array<float,2>{0.265712887f, 0.498645633f},
-std::array<float,2>{0.826223612f, 0.0379086025f},
-std::array<float,2>{0.157675311f, 0.961131096f},
-std::array<float,2>{0.808331251f, 0.500490785f},
-std::array<float,2>{0.193436608f, 0.339704067f},
-std::array<float,2>{0.706508994f, 0.223607153f},
-std::array<float,2>{0.368952453f, 0.761964321f},
-std::array<float,2>{0.555442989f, 0.911458313f},
-std::array<float,2>{0.447914511f, 0.0875557363f},
-std::array<float,2>{0.880031109f, 0.392212003f},
-std::array<float,2>{0.100663766f, 0.672603548f},
-std::array<float,2>{0.900796592f, 0.885027468f},
-std::array<float,2>{0.114214689f, 0.113381289f},
-std::array<float,2>{0.546761751f, 0.425857186f},
-std::array<float,2>{0.458636403f, 0.632064164f},
-std::array<float,2>{0.69738102f, 0.546193004f},
-std::array<float,2>{0.358351886f, 0.348109275f},
-std::array<float,2>{0.79128629f, 0.189119428f},
-std::array<float,2>{0.210572317f, 0.79091239f},
-std::array<float,2>{0.839721143f, 0.693944156f},
-std::array<float,2>{0.183197454f, 0.445092529f},
-std::array<float,2>{0.642301619f, 0.0054984726f},
-std::array<float,2>{0.265414357f, 0.979909003f},
-std::array<float,2>{0.615276515f, 0.871299207f},
-std::array<float,2>{0.389658689f, 0.161911547f},
-std::array<float,2>{0.966050565f, 0.275719315f},
-std::array<float,2>{0.0157264154f, 0.594327748f},
-std::array<float,2>{0.766217649f, 0.774066746f},
-std::array<float,2>{0.248770013f, 0.246755391f},
-std::array<float,2>{0.72937125f, 0.314692616f},
-std::array<float,2>{0.342239767f, 0.529109478f},
-std::array<float,2>{0.504591823f, 0.670295358f},
-std::array<float,2>{0.47587651f, 0.37635687f},
-std::array<float,2>{0.922988474f, 0.0675877482f},
-std::array<float,2>{0.069866173f, 0.922201812f},
-std::array<float,2>{0.978737414f, 0.568679333f},
-std::array<float,2>{0.0564529188f, 0.294936597f},
-std::array<float,2>{0.584339797f, 0.128367826f},
-std::array<float,2>{0.416392714f, 0.842551529f},
-std::array<float,2>{0.661261559f, 0.944969833f},
-std::array<float,2>{0.300437927f, 0.0532952286f},
-std::array<float,2>{0.86013484f, 0.47859481f},
-std::array<float,2>{0.145417958f, 0.74468112f},
-std::array<float,2>{0.781653762f, 0.930553794f},
-std::array<float,2>{0.217156619f, 0.0733774081f},
-std::array<float,2>{0.690620601f, 0.38336134f},
-std::array<float,2>{0.350102484f, 0.662173569f},
-std::array<float,2>{0.534957409f, 0.519680262f},
-std::array<float,2>{0.464087069f, 0.322620928f},
-std::array<float,2>{0.890838146f, 0.23796916f},
-std::array<float,2>{0.11771892f, 0.76967895f},
-std::array<float,2>{0.954754174f, 0.737202168f},
-std::array<float,2>{0.0304016024f, 0.474796206f},
-std::array<float,2>{0.624266863f, 0.0596637465f},
-std::array<float,2>{0.380651265f, 0.94791019f},
-std::array<float,2>{0.656090558f, 0.830974817f},
-std::array<float,2>{0.250828594f, 0.132910088f},
-std::array<float,2>{0.831791222f, 0.283392906f},
-std::array<float,2>{0.175197706f, 0.575449586f},
-std::array<float,2>{0.929790735f, 0.781719387f},
-std::array<float,2>{0.0732000172f, 0.20092313f},
-std::array<float,2>{0.50903976f, 0.35885793f},
-std::array<float,2>{0.477017552f, 0.535927832f},
-std::array<float,2>{0.726381361f, 0.638017118f},
-std::array<float,2>{0.33589834f, 0.429956198f},
-std::array<float,2>{0.779697478f, 0.121183224f},
-std::array<float,2>{0.235816717f, 0.875298202f},
-std::array<float,2>{0.870723903f, 0.609084129f},
-std::array<float,2>{0.152729616f, 0.26921162f},
-std::array<float,2>{0.66643852f, 0.170549855f},
-std::array<float,2>{0.306914836f, 0.865966141f},
-std::array<float,2>{0.587908268f, 0.974189818f},
-std::array<float,2>{0.413226485f, 0.0135061136f},
-std::array<float,2>{0.973792613f, 0.449779332f},
-std::array<float,2>{0.0533326901f, 0.701081634f},
-std::array<float,2>{0.996666729f, 0.95389837f},
-std::array<float,2>{0.0422600098f, 0.0450088717f},
-std::array<float,2>{0.573301852f, 0.489756912f},
-std::array<float,2>{0.435962021f, 0.720869362f},
-std::array<float,2>{0.678780496f, 0.582313538f},
-std::array<float,2>{0.281359196f, 0.308965802f},
-std::array<float,2>{0.855209887f, 0.140935153f},
-std::array<float,2>{0.132402629f, 0.823688745f},
-std::array<float,2>{0.756231725f, 0.68640244f},
-std::array<float,2>{0.22990559f, 0.406067908f},
-std::array<float,2>{0.735408962f, 0.0805668607f},
-std::array<float,2>{0.316241711f, 0.915166616f},
-std::array<float,2>{0.527101994f, 0.754496455f},
-std::array<float,2>{0.490629345f, 0.23196882f},
-std::array<float,2>{0.915897608f, 0.332441121f},
-std::array<float,2>{0.0914855897f, 0.512055218f},
-std::array<float,2>{0.81559211f, 0.853040695f},
-std::array<float,2>{0.169515714f, 0.181194231f},
-std::array<float,2>{0.635180712f, 0.253900468f},
-std::array<float,2>{0.280015647f, 0.618439078f},
-std::array<float,2>{0.60894531f, 0.714338958f},
-std::array<float,2>{0.394953042f, 0.454726845f},
-std::array<float,2>{0.944372177f, 0.0162671637f},
-std::array<float,2>{0.00334552815f, 0.993443966f},
-std::array<float,2>{0.887310326f, 0.561306655f},
-std::array<float,2>{0.104988284f, 0.363050938f},
-std::array<float,2>{0.552797556f, 0.211453602f},
-std::array<float,2>{0.441957206f, 0.808990657f},
-std::array<float,2>{0.71406579f, 0.894363523f},
-std::array<float,2>{0.362134069f, 0.107808575f},
-std::array<float,2>{0.797166288f, 0.408868223f},
-std::array<float,2>{0.195330128f, 0.647977769f},
-std::array<float,2>{0.76155901f, 0.950422764f},
-std::array<float,2>{0.225931719f, 0.0580557622f},
-std::array<float,2>{0.745589852f, 0.470359027f},
-std::array<float,2>{0.323307484f, 0.741028786f},
-std::array<float,2>{0.517623425f, 0.57113868f},
-std::array<float,2>{0.49553892f, 0.287797958f},
-std::array<float,2>{0.906546175f, 0.140141964f},
-std::array<float,2>{0.0857710987f, 0.834215939f},
-std::array<float,2>{0.989489436f, 0.656374693f},
-std::array<float,2>{0.0335499868f, 0.388418585f},
-std::array<float,2>{0.564138293f, 0.0750755444f},
-std::array<float,2>{0.424017251f, 0.934399724f},
-std::array<float,2>{0.679969668f, 0.765804768f},
-std::array<float,2>{0.29102537f, 0.238350704f},
-std::array<float,2>{0.84782362f, 0.324892014f},
-std::array<float,2>{0.134455115f, 0.516989708f},
-std::array<float,2>{0.877142131f, 0.859678388f},
-std::array<float,2>{0.0941322148f, 0.166447073f},
-std::array<float,2>{0.560470164f, 0.270696372f},
-std::array<float,2>{0.451031864f, 0.605189741f},
-std::array<float,2>{0.707926154f, 0.699027061f},
-std::array<float,2>{0.372199118f, 0.446277201f},
-std::array<float,2>{0.810339808f, 0.0103557734f},
-std::array<float,2>{0.188314527f, 0.970895052f},
-std::array<float,2>{0.820895791f, 0.534159184f},
-std::array<float,2>{0.163470417f, 0.352154315f},
-std::array<float,2>{0.631124079f, 0.197042242f},
-std::array<float,2>{0.270801097f, 0.788986444f},
-std::array<float,2>{0.595763266f, 0.88063252f},
-std::array<float,2>{0.403532684f, 0.120129749f},
-std::array<float,2>{0.950850129f, 0.436264008f},
-std::array<float,2>{0.00932148192f, 0.634103775f},
-std::array<float,2>{0.962489307f, 0.921555459f},
-std::array<float,2>{0.0206416547f, 0.0846936181f},
-std::array<float,2>{0.610320389f, 0.399221092f},
-std::array<float,2>{0.384523898f, 0.681836486f},
-std::array<float,2>{0.64552474f, 0.508469641f},
-std::array<float,2>{0.258936197f, 0.329108268f},
-std::array<float,2>{0.84049201f, 0.226642802f},
-std::array<float,2>{0.184533864f, 0.750940502f},
-std::array<float,2>{0.793040335f, 0.72384876f},
-std::array<float,2>{0.204179153f, 0.485138416f},
-std::array<float,2>{0.700615346f, 0.042900335f},
-std::array<float,2>{0.353010088f, 0.959241509f},
-std::array<float,2>{0.540220201f, 0.826722741f},
-std::array<float,2>{0.455187947f, 0.147747189f},
-std::array<float,2>{0.902592957f, 0.304921538f},
-std::array<float,2>{0.112965584f, 0.578499377f},
-std::array<float,2>{0.864396453f, 0.808333933f},
-std::array<float,2>{0.141190499f, 0.215800479f},
-std::array<float,2>{0.659418821f, 0.366792589f},
-std::array<float,2>{0.304160446f, 0.555150211f},
-std::array<float,2>{0.581808031f, 0.643424928f},
-std::array<float,2>{0.420078784f, 0.411053598f},
-std::array<float,2>{0.982942879f, 0.102190793f},
-std::array<float,2>{0.0592836104f, 0.895921171f},
-std::array<float,2>{0.928121209f, 0.624972999f},
-std::array<float,2>{0.0638972521f, 0.257687598f},
-std::array<float,2>{0.5027439f, 0.18419838f},
-std::array<float,2>{0.470414221f, 0.857055306f},
-std::array<float,2>{0.732274234f, 0.998675883f},
-std::array<float,2>{0.337676316f, 0.0214528535f},
-std::array<float,2>{0.772724509f, 0.458958924f},
-std::array<float,2>{0.245210782f, 0.715397716f},
-std::array<float,2>{0.833150387f, 0.90437007f},
-std::array<float,2>{0.177947894f, 0.101264119f},
-std::array<float,2>{0.652178407f, 0.418856204f},
-std::array<float,2>{0.25542593f, 0.654472828f},
-std::array<float,2>{0.617478848f, 0.547133386f},
-std::array<float,2>{0.378744483f, 0.371298939f},
-std::array<float,2>{0.957237661f, 0.205049738f},
-std::array<float,2>{0.0258680005f, 0.798181236f},
-std::array<float,2>{0.895991325f, 0.707292378f},
-std::array<float,2>{0.123172551f, 0.461765587f},
-std::array<float,2>{0.53606528f, 0.030439496f},
-std::array<float,2>{0.465639591f, 0.98592329f},
-std::array<float,2>{0.694420338f, 0.845539153f},
-std::array<float,2>{0.345300764f, 0.173400968f},
-std::array<float,2>{0.786701143f, 0.263461471f},
-std::array<float,2>{0.21412833f, 0.615846634f},
-std::array<float,2>{0.969949841f, 0.760102093f},
-std::array<float,2>{0.0506015718f, 0.22182861f},
-std::array<float,2>{0.590561152f, 0.340744674f},
-std::array<float,2>{0.409815788f, 0.506841123f},
-std::array<float,2>{0.670989096f, 0.676568031f},
-std::array<float,2>{0.309223264f, 0.396921873f},
-std::array<float,2>{0.874974012f, 0.0907130465f},
-std::array<float,2>{0.148721054f, 0.9090361f},
-std::array<float,2>{0.776273191f, 0.588817894f},
-std::array<float,2>{0.23863475f, 0.300738275f},
-std::array<float,2>{0.722053111f, 0.150247127f},
-std::array<float,2>{0.330352962f, 0.813635588f},
-std::array<float,2>{0.51280582f, 0.968685389f},
-std::array<float,2>{0.48088181f, 0.0315592177f},
-std::array<float,2>{0.933963358f, 0.493256688f},
-std::array<float,2>{0.0759166032f, 0.726813257f},
-std::array<float,2>{0.919426799f, 0.981603205f},
-std::array<float,2>{0.0860489756f, 0.000336891244f},
-std::array<float,2>{0.52790904f, 0.43878299f},
-std::array<float,2>{0.484630346f, 0.689311922f},
-std::array<float,2>{0.739888608f, 0.598635197f},
-std::array<float,2>{0.316436976f, 0.280783653f},
-std::array<float,2>{0.750608921f, 0.156419307f},
-std::array<float,2>{0.232242018f, 0.869863987f},
-std::array<float,2>{0.856151521f, 0.628146648f},
-std::array<float,2>{0.126403734f, 0.423764795f},
-std::array<float,2>{0.674631834f, 0.112247936f},
-std::array<float,2>{0.286398679f, 0.887484312f},
-std::array<float,2>{0.574564755f, 0.793178558f},
-std::array<float,2>{0.430583745f, 0.19197619f},
-std::array<float,2>{0.99527806f, 0.34458515f},
-std::array<float,2>{0.0434228256f, 0.541839659f},
-std::array<float,2>{0.804096878f, 0.83891207f},
-std::array<float,2>{0.203003123f, 0.129739672f},
-std::array<float,2>{0.718727589f, 0.290043026f},
-std::array<float,2>{0.364948153f, 0.564879239f},
-std::array<float,2>{0.549015701f, 0.748436987f},
-std::array<float,2>{0.440719873f, 0.480745137f},
-std::array<float,2>{0.886574805f, 0.0479224063f},
-std::array<float,2>{0.106146097f, 0.940466166f},
-std::array<float,2>{0.938703656f, 0.524126649f},
-std::array<float,2>{0.00392332999f, 0.316821009f},
-std::array<float,2>{0.602936268f, 0.244128048f},
-std::array<float,2>{0.391457319f, 0.778799295f},
-std::array<float,2>{0.637316585f, 0.926635861f},
-std::array<float,2>{0.275527537f, 0.0649267659f},
-std::array<float,2>{0.817346931f, 0.381946266f},
-std::array<float,2>{0.165452808f, 0.665154397f},
-std::array<float,2>{0.826084971f, 0.964215755f},
-std::array<float,2>{0.159902677f, 0.0360850431f},
-std::array<float,2>{0.625549316f, 0.497710198f},
-std::array<float,2>{0.268662453f, 0.733002305f},
-std::array<float,2>{0.599054396f, 0.5928725f},
-std::array<float,2>{0.402132571f, 0.303774744f},
-std::array<float,2>{0.94756186f, 0.155210659f},
-std::array<float,2>{0.0120633906f, 0.81648314f},
-std::array<float,2>{0.882630169f, 0.675704658f},
-std::array<float,2>{0.0993090123f, 0.392886341f},
-std::array<float,2>{0.557984233f, 0.0885889754f},
-std::array<float,2>{0.445667744f, 0.913552821f},
-std::array<float,2>{0.703139663f, 0.764886022f},
-std::array<float,2>{0.370570183f, 0.225881532f},
-std::array<float,2>{0.806311846f, 0.336074501f},
-std::array<float,2>{0.192250848f, 0.503591657f},
-std::array<float,2>{0.988095045f, 0.850816965f},
-std::array<float,2>{0.0358747169f, 0.179285794f},
-std::array<float,2>{0.569385946f, 0.258522749f},
-std::array<float,2>{0.428568095f, 0.612294734f},
-std::array<float,2>{0.684254706f, 0.706824481f},
-std::array<float,2>{0.295320213f, 0.467853576f},
-std::array<float,2>{0.845512867f, 0.0270467326f},
-std::array<float,2>{0.137431994f, 0.988403916f},
-std::array<float,2>{0.764686346f, 0.551806629f},
-std::array<float,2>{0.219333261f, 0.369796455f},
-std::array<float,2>{0.748826087f, 0.209029838f},
-std::array<float,2>{0.326599687f, 0.801497221f},
-std::array<float,2>{0.522634506f, 0.901971281f},
-std::array<float,2>{0.499061376f, 0.0950551108f},
-std::array<float,2>{0.910953701f, 0.414811224f},
-std::array<float,2>{0.0787042975f, 0.651982903f},
-std::array<float,2>{0.924603105f, 0.924373686f},
-std::array<float,2>{0.0679649934f, 0.070058085f},
-std::array<float,2>{0.506983161f, 0.377577245f},
-std::array<float,2>{0.474192351f, 0.669435501f},
-std::array<float,2>{0.727604508f, 0.530452251f},
-std::array<float,2>{0.339891434f, 0.313177139f},
-std::array<float,2>{0.769432008f, 0.249866694f},
-std::array<float,2>{0.246951103f, 0.777052045f},
-std::array<float,2>{0.862012982f, 0.74268955f},
-std::array<float,2>{0.146880656f, 0.477593362f},
-std::array<float,2>{0.662173986f, 0.0516459458f},
-std::array<float,2>{0.297373086f, 0.942664146f},
-std::array<float,2>{0.583758473f, 0.840006351f},
-std::array<float,2>{0.415243864f, 0.125132158f},
-std::array<float,2>{0.977855086f, 0.294039369f},
-std::array<float,2>{0.0568712093f, 0.566754222f},
-std::array<float,2>{0.790691912f, 0.792584538f},
-std::array<float,2>{0.208193198f, 0.190821841f},
-std::array<float,2>{0.696748674f, 0.350185007f},
-std::array<float,2>{0.356999487f, 0.543056965f},
-std::array<float,2>{0.544391811f, 0.630822003f},
-std::array<float,2>{0.460549086f, 0.429252088f},
-std::array<float,2>{0.900220513f, 0.115834907f},
-std::array<float,2>{0.116145924f, 0.884077251f},
-std::array<float,2>{0.967268169f, 0.597412825f},
-std::array<float,2>{0.0192114655f, 0.275328845f},
-std::array<float,2>{0.614593387f, 0.162997633f},
-std::array<float,2>{0.388622016f, 0.874897718f},
-std::array<float,2>{0.642742693f, 0.977746606f},
-std::array<float,2>{0.262462258f, 0.0061207111f},
-std::array<float,2>{0.837548852f, 0.442232758f},
-std::array<float,2>{0.181226015f, 0.692759037f},
-std::array<float,2>{0.777596653f, 0.878001511f},
-std::array<float,2>{0.237211123f, 0.123253636f},
-std::array<float,2>{0.722922564f, 0.432969838f},
-std::array<float,2>{0.333961427f, 0.638831258f},
-std::array<float,2>{0.511594713f, 0.537897646f},
-std::array<float,2>{0.478827357f, 0.355945736f},
-std::array<float,2>{0.933104098f, 0.202091426f},
-std::array<float,2>{0.0711947978f, 0.784285665f},
-std::array<float,2>{0.974850297f, 0.702234268f},
-std::array<float,2>{0.0508541465f, 0.45276162f},
-std::array<float,2>{0.587565362f, 0.0140822064f},
-std::array<float,2>{0.411766112f, 0.974624932f},
-std::array<float,2>{0.666003823f, 0.865088999f},
-std::array<float,2>{0.306358397f, 0.169753909f},
-std::array<float,2>{0.868472457f, 0.26697287f},
-std::array<float,2>{0.155997083f, 0.607276142f},
-std::array<float,2>{0.894112825f, 0.772356689f},
-std::array<float,2>{0.119168572f, 0.234757707f},
-std::array<float,2>{0.532836139f, 0.320343941f},
-std::array<float,2>{0.462613225f, 0.523244739f},
-std::array<float,2>{0.688691437f, 0.660921633f},
-std::array<float,2>{0.347903758f, 0.385706425f},
-std::array<float,2>{0.785084546f, 0.0713404343f},
-std::array<float,2>{0.216389477f, 0.933183849f},
-std::array<float,2>{0.830046833f, 0.57673198f},
-std::array<float,2>{0.173217103f, 0.281814754f},
-std::array<float,2>{0.653551161f, 0.135941282f},
-std::array<float,2>{0.252786696f, 0.828643084f},
-std::array<float,2>{0.621692955f, 0.945409119f},
-std::array<float,2>{0.38090989f, 0.0620834492f},
-std::array<float,2>{0.956615925f, 0.472819805f},
-std::array<float,2>{0.0277824011f, 0.736067474f},
-std::array<float,2>{0.942855477f, 0.994190753f},
-std::array<float,2>{0.000659410609f, 0.0193768665f},
-std::array<float,2>{0.605830431f, 0.456684381f},
-std::array<float,2>{0.398182571f, 0.711408973f},
-std::array<float,2>{0.633301497f, 0.620759189f},
-std::array<float,2>{0.278144389f, 0.251683921f},
-std::array<float,2>{0.814264715f, 0.18345122f},
-std::array<float,2>{0.170588225f, 0.853937149f},
-std::array<float,2>{0.799147487f, 0.645010054f},
-std::array<float,2>{0.197929069f, 0.406514317f},
-std::array<float,2>{0.712115407f, 0.105616644f},
-std::array<float,2>{0.360966533f, 0.891049862f},
-std::array<float,2>{0.551019907f, 0.811520755f},
-std::array<float,2>{0.444718808f, 0.213755384f},
-std::array<float,2>{0.889586031f, 0.359982014f},
-std::array<float,2>{0.101625308f, 0.558621764f},
-std::array<float,2>{0.852161169f, 0.821253419f},
-std::array<float,2>{0.130396277f, 0.144136652f},
-std::array<float,2>{0.677147508f, 0.312314034f},
-std::array<float,2>{0.284501284f, 0.585727215f},
-std::array<float,2>{0.572139978f, 0.720591784f},
-std::array<float,2>{0.433775753f, 0.490378499f},
-std::array<float,2>{0.998221338f, 0.0433127359f},
-std::array<float,2>{0.040907532f, 0.95528394f},
-std::array<float,2>{0.917786658f, 0.513947725f},
-std::array<float,2>{0.0918414891f, 0.334647357f},
-std::array<float,2>{0.524971485f, 0.23398605f},
-std::array<float,2>{0.48843497f, 0.756357133f},
-std::array<float,2>{0.737934113f, 0.916250467f},
-std::array<float,2>{0.314363539f, 0.078973338f},
-std::array<float,2>{0.754735529f, 0.402493477f},
-std::array<float,2>{0.228455052f, 0.68399483f},
-std::array<float,2>{0.811554968f, 0.970457435f},
-std::array<float,2>{0.190389991f, 0.00903309137f},
-std::array<float,2>{0.709382951f, 0.447383761f},
-std::array<float,2>{0.374750912f, 0.696312904f},
-std::array<float,2>{0.560659885f, 0.602277994f},
-std::array<float,2>{0.452167749f, 0.272277862f},
-std::array<float,2>{0.87623173f, 0.164365202f},
-std::array<float,2>{0.0964109078f, 0.862298906f},
-std::array<float,2>{0.951743305f, 0.636305213f},
-std::array<float,2>{0.00986823719f, 0.434438884f},
-std::array<float,2>{0.594908774f, 0.117420107f},
-std::array<float,2>{0.405771852f, 0.882720649f},
-std::array<float,2>{0.630175829f, 0.786825061f},
-std::array<float,2>{0.271727026f, 0.199081704f},
-std::array<float,2>{0.823165894f, 0.35427922f},
-std::array<float,2>{0.160471708f, 0.531926572f},
-std::array<float,2>{0.908724606f, 0.832820415f},
-std::array<float,2>{0.0833909065f, 0.137959734f},
-std::array<float,2>{0.517574668f, 0.286787927f},
-std::array<float,2>{0.492388606f, 0.572448254f},
-std::array<float,2>{0.742885172f, 0.738578916f},
-std::array<float,2>{0.32122767f, 0.471072108f},
-std::array<float,2>{0.758511424f, 0.0548494086f},
-std::array<float,2>{0.224082276f, 0.952084243f},
-std::array<float,2>{0.850552857f, 0.519234061f},
-std::array<float,2>{0.13480933f, 0.326836795f},
-std::array<float,2>{0.682214499f, 0.240826339f},
-std::array<float,2>{0.290402025f, 0.76943028f},
-std::array<float,2>{0.565657735f, 0.936167121f},
-std::array<float,2>{0.422732681f, 0.0764845908f},
-std::array<float,2>{0.991874456f, 0.390351862f},
-std::array<float,2>{0.0328246951f, 0.659993529f},
-std::array<float,2>{0.981532812f, 0.897289693f},
-std::array<float,2>{0.0608909391f, 0.105066046f},
-std::array<float,2>{0.578763962f, 0.413707316f},
-std::array<float,2>{0.4187195f, 0.641021669f},
-std::array<float,2>{0.658005059f, 0.558525503f},
-std::array<float,2>{0.302260429f, 0.363567352f},
-std::array<float,2>{0.866831779f, 0.217928573f},
-std::array<float,2>{0.143501699f, 0.805140495f},
-std::array<float,2>{0.769691825f, 0.717962742f},
-std::array<float,2>{0.242821008f, 0.460345805f},
-std::array<float,2>{0.732790887f, 0.0223123915f},
-std::array<float,2>{0.338428706f, 0.996421278f},
-std::array<float,2>{0.501266003f, 0.859214842f},
-std::array<float,2>{0.471815825f, 0.187005445f},
-std::array<float,2>{0.925842047f, 0.253997773f},
-std::array<float,2>{0.0657297969f, 0.621205688f},
-std::array<float,2>{0.842693985f, 0.753699481f},
-std::array<float,2>{0.185897022f, 0.230028957f},
-std::array<float,2>{0.647265792f, 0.331632465f},
-std::array<float,2>{0.260886788f, 0.509949446f},
-std::array<float,2>{0.611862481f, 0.680617452f},
-std::array<float,2>{0.385579795f, 0.400849879f},
-std::array<float,2>{0.964078188f, 0.0835515633f},
-std::array<float,2>{0.0227908995f, 0.918836474f},
-std::array<float,2>{0.904443502f, 0.581078887f},
-std::array<float,2>{0.110044479f, 0.308337748f},
-std::array<float,2>{0.542575121f, 0.145263508f},
-std::array<float,2>{0.454364419f, 0.824329197f},
-std::array<float,2>{0.702334821f, 0.958433568f},
-std::array<float,2>{0.355066776f, 0.0404796936f},
-std::array<float,2>{0.796077728f, 0.487301737f},
-std::array<float,2>{0.206781566f, 0.724921942f},
-std::array<float,2>{0.872059464f, 0.906761706f},
-std::array<float,2>{0.151908904f, 0.0935829878f},
-std::array<float,2>{0.668176293f, 0.395529479f},
-std::array<float,2>{0.312306672f, 0.679348052f},
-std::array<float,2>{0.592657983f, 0.505764008f},
-std::array<float,2>{0.408185601f, 0.342403919f},
-std::array<float,2>{0.97104758f, 0.219253525f},
-std::array<float,2>{0.0475422405f, 0.758991241f},
-std::array<float,2>{0.936430573f, 0.729225636f},
-std::array<float,2>{0.0779876858f, 0.495829642f},
-std::array<float,2>{0.513768792f, 0.0335126556f},
-std::array<float,2>{0.483948797f, 0.965568006f},
-std::array<float,2>{0.720321894f, 0.815353453f},
-std::array<float,2>{0.329064488f, 0.150514707f},
-std::array<float,2>{0.774890959f, 0.298312068f},
-std::array<float,2>{0.241000086f, 0.587382734f},
-std::array<float,2>{0.959710121f, 0.799384534f},
-std::array<float,2>{0.0239829458f, 0.205165312f},
-std::array<float,2>{0.620303333f, 0.374568164f},
-std::array<float,2>{0.376353145f, 0.550713181f},
-std::array<float,2>{0.650022328f, 0.654223561f},
-std::array<float,2>{0.256878227f, 0.421401471f},
-std::array<float,2>{0.834803939f, 0.098537609f},
-std::array<float,2>{0.17754449f, 0.90236491f},
-std::array<float,2>{0.789023757f, 0.614530206f},
-std::array<float,2>{0.211560085f, 0.264496744f},
-std::array<float,2>{0.692816436f, 0.17432417f},
-std::array<float,2>{0.347094476f, 0.846421838f},
-std::array<float,2>{0.538525045f, 0.986799479f},
-std::array<float,2>{0.466987431f, 0.028250454f},
-std::array<float,2>{0.897185206f, 0.463832736f},
-std::array<float,2>{0.123026885f, 0.70937103f},
-std::array<float,2>{0.884406269f, 0.939020872f},
-std::array<float,2>{0.108284004f, 0.0494824573f},
-std::array<float,2>{0.548155606f, 0.483007461f},
-std::array<float,2>{0.438178688f, 0.74666518f},
-std::array<float,2>{0.716686845f, 0.563434601f},
-std::array<float,2>{0.365289181f, 0.291952491f},
-std::array<float,2>{0.80163312f, 0.13211675f},
-std::array<float,2>{0.199413911f, 0.837536037f},
-std::array<float,2>{0.818361998f, 0.667431235f},
-std::array<float,2>{0.16662921f, 0.379520029f},
-std::array<float,2>{0.638919771f, 0.0628247559f},
-std::array<float,2>{0.274142891f, 0.928751171f},
-std::array<float,2>{0.605302095f, 0.780292809f},
-std::array<float,2>{0.393911153f, 0.244512692f},
-std::array<float,2>{0.941264629f, 0.318784118f},
-std::array<float,2>{0.00646813354f, 0.526871681f},
-std::array<float,2>{0.752378941f, 0.867776811f},
-std::array<float,2>{0.233755827f, 0.159266546f},
-std::array<float,2>{0.740721107f, 0.278283447f},
-std::array<float,2>{0.318598866f, 0.600444019f},
-std::array<float,2>{0.529883802f, 0.689783394f},
-std::array<float,2>{0.486975223f, 0.440788388f},
-std::array<float,2>{0.92169714f, 0.00334642082f},
-std::array<float,2>{0.0881929323f, 0.982680857f},
-std::array<float,2>{0.992728949f, 0.540352523f},
-std::array<float,2>{0.0450767875f, 0.346336037f},
-std::array<float,2>{0.578060806f, 0.194360331f},
-std::array<float,2>{0.431863934f, 0.795942128f},
-std::array<float,2>{0.672792614f, 0.889075458f},
-std::array<float,2>{0.28760916f, 0.109417997f},
-std::array<float,2>{0.857880771f, 0.425236881f},
-std::array<float,2>{0.127780944f, 0.625904024f},
-std::array<float,2>{0.836002171f, 0.978555322f},
-std::array<float,2>{0.180549741f, 0.00483253226f},
-std::array<float,2>{0.643585622f, 0.443450212f},
-std::array<float,2>{0.262711585f, 0.694520473f},
-std::array<float,2>{0.613853335f, 0.59511441f},
-std::array<float,2>{0.386869818f, 0.276524216f},
-std::array<float,2>{0.968407035f, 0.160652041f},
-std::array<float,2>{0.0185162611f, 0.872370601f},
-std::array<float,2>{0.899063945f, 0.631510317f},
-std::array<float,2>{0.116595164f, 0.427321613f},
-std::array<float,2>{0.543617964f, 0.115166895f},
-std::array<float,2>{0.459546089f, 0.886321187f},
-std::array<float,2>{0.695330381f, 0.789380908f},
-std::array<float,2>{0.35553655f, 0.187710509f},
-std::array<float,2>{0.789072216f, 0.349287659f},
-std::array<float,2>{0.207846701f, 0.545224011f},
-std::array<float,2>{0.976974249f, 0.84346801f},
-std::array<float,2>{0.0583563335f, 0.127267867f},
-std::array<float,2>{0.58275795f, 0.296609312f},
-std::array<float,2>{0.414578378f, 0.569886386f},
-std::array<float,2>{0.663228333f, 0.745462596f},
-std::array<float,2>{0.298066884f, 0.479602158f},
-std::array<float,2>{0.862859845f, 0.0546768792f},
-std::array<float,2>{0.14821443f, 0.94426322f},
-std::array<float,2>{0.767659605f, 0.527879536f},
-std::array<float,2>{0.247564241f, 0.315822572f},
-std::array<float,2>{0.726574421f, 0.247609034f},
-std::array<float,2>{0.341471642f, 0.775129795f},
-std::array<float,2>{0.506559908f, 0.923318386f},
-std::array<float,2>{0.472797722f, 0.0666075796f},
-std::array<float,2>{0.925689518f, 0.375797778f},
-std::array<float,2>{0.0667785108f, 0.670917869f},
-std::array<float,2>{0.911623299f, 0.899718583f},
-std::array<float,2>{0.0800026134f, 0.0967470706f},
-std::array<float,2>{0.522336841f, 0.416833192f},
-std::array<float,2>{0.498634636f, 0.649653912f},
-std::array<float,2>{0.749837995f, 0.553563535f},
-std::array<float,2>{0.327317387f, 0.367672414f},
-std::array<float,2>{0.764395118f, 0.207702696f},
-std::array<float,2>{0.220497027f, 0.803132355f},
-std::array<float,2>{0.843837738f, 0.70447439f},
-std::array<float,2>{0.137984708f, 0.46679005f},
-std::array<float,2>{0.685155451f, 0.0249528047f},
-std::array<float,2>{0.296258152f, 0.992019773f},
-std::array<float,2>{0.568696797f, 0.849408031f},
-std::array<float,2>{0.429402858f, 0.175970197f},
-std::array<float,2>{0.986536324f, 0.261601657f},
-std::array<float,2>{0.0363866054f, 0.609522939f},
-std::array<float,2>{0.804833174f, 0.763505101f},
-std::array<float,2>{0.192391708f, 0.223729849f},
-std::array<float,2>{0.705050588f, 0.338647753f},
-std::array<float,2>{0.369521767f, 0.501915395f},
-std::array<float,2>{0.557095766f, 0.673382342f},
-std::array<float,2>{0.446310639f, 0.390809655f},
-std::array<float,2>{0.881667912f, 0.0865344256f},
-std::array<float,2>{0.0982346162f, 0.91025281f},
-std::array<float,2>{0.948918283f, 0.591654897f},
-std::array<float,2>{0.0132553559f, 0.300818771f},
-std::array<float,2>{0.598594069f, 0.153938666f},
-std::array<float,2>{0.401161462f, 0.819544137f},
-std::array<float,2>{0.626403689f, 0.9624843f},
-std::array<float,2>{0.267735541f, 0.0384805426f},
-std::array<float,2>{0.82506603f, 0.499669105f},
-std::array<float,2>{0.158228785f, 0.731898129f},
-std::array<float,2>{0.754993677f, 0.914416552f},
-std::array<float,2>{0.227466896f, 0.081629999f},
-std::array<float,2>{0.736940444f, 0.404703766f},
-std::array<float,2>{0.313019246f, 0.686762393f},
-std::array<float,2>{0.523971379f, 0.51312089f},
-std::array<float,2>{0.489428878f, 0.333255798f},
-std::array<float,2>{0.916226447f, 0.230877876f},
-std::array<float,2>{0.0928147882f, 0.755840957f},
-std::array<float,2>{0.999313295f, 0.722565413f},
-std::array<float,2>{0.0395155996f, 0.489248931f},
-std::array<float,2>{0.570737064f, 0.0467576645f},
-std::array<float,2>{0.435146749f, 0.954468787f},
-std::array<float,2>{0.676383853f, 0.822624326f},
-std::array<float,2>{0.283445805f, 0.141679153f},
-std::array<float,2>{0.853156626f, 0.30996269f},
-std::array<float,2>{0.129338294f, 0.583512008f},
-std::array<float,2>{0.890619278f, 0.809891105f},
-std::array<float,2>{0.102951072f, 0.212441698f},
-std::array<float,2>{0.551990092f, 0.361448258f},
-std::array<float,2>{0.443590403f, 0.561753154f},
-std::array<float,2>{0.711594701f, 0.646529138f},
-std::array<float,2>{0.360124618f, 0.409449935f},
-std::array<float,2>{0.800253093f, 0.108755805f},
-std::array<float,2>{0.198485032f, 0.893503129f},
-std::array<float,2>{0.812574506f, 0.617732048f},
-std::array<float,2>{0.171818793f, 0.25272122f},
-std::array<float,2>{0.634487152f, 0.179839537f},
-std::array<float,2>{0.278770328f, 0.85186255f},
-std::array<float,2>{0.607173026f, 0.992720544f},
-std::array<float,2>{0.397004753f, 0.0166839026f},
-std::array<float,2>{0.94185698f, 0.453285009f},
-std::array<float,2>{0.00174937467f, 0.712928236f},
-std::array<float,2>{0.955081582f, 0.948459685f},
-std::array<float,2>{0.0284394249f, 0.0590055771f},
-std::array<float,2>{0.622650266f, 0.475610822f},
-std::array<float,2>{0.382047534f, 0.737397432f},
-std::array<float,2>{0.653278708f, 0.574297249f},
-std::array<float,2>{0.253797084f, 0.285021484f},
-std::array<float,2>{0.828285336f, 0.134338528f},
-std::array<float,2>{0.17268163f, 0.831619978f},
-std::array<float,2>{0.783792615f, 0.663756907f},
-std::array<float,2>{0.215640202f, 0.383902282f},
-std::array<float,2>{0.688164592f, 0.0723306164f},
-std::array<float,2>{0.348897457f, 0.931331217f},
-std::array<float,2>{0.531280696f, 0.771435797f},
-std::array<float,2>{0.461311102f, 0.236719385f},
-std::array<float,2>{0.892959297f, 0.323773503f},
-std::array<float,2>{0.120924689f, 0.521241844f},
-std::array<float,2>{0.867503762f, 0.866919756f},
-std::array<float,2>{0.154951304f, 0.171207413f},
-std::array<float,2>{0.664779186f, 0.267972827f},
-std::array<float,2>{0.305042148f, 0.607544005f},
-std::array<float,2>{0.586365938f, 0.699757993f},
-std::array<float,2>{0.411011577f, 0.450930238f},
-std::array<float,2>{0.976210892f, 0.0118198171f},
-std::array<float,2>{0.0519721471f, 0.973479688f},
-std::array<float,2>{0.932419538f, 0.536434472f},
-std::array<float,2>{0.0715323612f, 0.358348966f},
-std::array<float,2>{0.509862065f, 0.199900866f},
-std::array<float,2>{0.48013702f, 0.7824862f},
-std::array<float,2>{0.724349797f, 0.876178205f},
-std::array<float,2>{0.332212985f, 0.122314155f},
-std::array<float,2>{0.778520346f, 0.430734426f},
-std::array<float,2>{0.238156989f, 0.637566745f},
-std::array<float,2>{0.795337796f, 0.960757375f},
-std::array<float,2>{0.205504388f, 0.0412620194f},
-std::array<float,2>{0.701824307f, 0.48587507f},
-std::array<float,2>{0.353552014f, 0.723421931f},
-std::array<float,2>{0.541452765f, 0.579143941f},
-std::array<float,2>{0.453333467f, 0.306404918f},
-std::array<float,2>{0.905502915f, 0.146943465f},
-std::array<float,2>{0.110927619f, 0.827361107f},
-std::array<float,2>{0.963561714f, 0.683444917f},
-std::array<float,2>{0.0221867152f, 0.399621844f},
-std::array<float,2>{0.613200068f, 0.085350886f},
-std::array<float,2>{0.386302501f, 0.920405149f},
-std::array<float,2>{0.647593021f, 0.751917541f},
-std::array<float,2>{0.260168701f, 0.22791113f},
-std::array<float,2>{0.843645632f, 0.328299105f},
-std::array<float,2>{0.187462881f, 0.509254277f},
-std::array<float,2>{0.926825404f, 0.856206954f},
-std::array<float,2>{0.0645620227f, 0.185214207f},
-std::array<float,2>{0.50036931f, 0.256024987f},
-std::array<float,2>{0.470941126f, 0.623672247f},
-std::array<float,2>{0.734254539f, 0.716684639f},
-std::array<float,2>{0.339749396f, 0.457267404f},
-std::array<float,2>{0.770534396f, 0.0195365287f},
-std::array<float,2>{0.243554205f, 0.999202669f},
-std::array<float,2>{0.865555823f, 0.556483984f},
-std::array<float,2>{0.144453898f, 0.365484744f},
-std::array<float,2>{0.656911612f, 0.216715395f},
-std::array<float,2>{0.300975353f, 0.806707203f},
-std::array<float,2>{0.579291642f, 0.895329416f},
-std::array<float,2>{0.419877887f, 0.103037305f},
-std::array<float,2>{0.98062247f, 0.411394387f},
-std::array<float,2>{0.0622275509f, 0.644121349f},
-std::array<float,2>{0.991208792f, 0.935074151f},
-std::array<float,2>{0.0315584168f, 0.0761623457f},
-std::array<float,2>{0.564849496f, 0.38689515f},
-std::array<float,2>{0.423098654f, 0.658044875f},
-std::array<float,2>{0.683061004f, 0.516137421f},
-std::array<float,2>{0.289148927f, 0.325498432f},
-std::array<float,2>{0.85145396f, 0.23963058f},
-std::array<float,2>{0.136490285f, 0.767420888f},
-std::array<float,2>{0.759588838f, 0.742185593f},
-std::array<float,2>{0.22308594f, 0.468979567f},
-std::array<float,2>{0.743235946f, 0.0572993867f},
-std::array<float,2>{0.322007567f, 0.949375927f},
-std::array<float,2>{0.516228676f, 0.835133851f},
-std::array<float,2>{0.49385187f, 0.139109701f},
-std::array<float,2>{0.910002053f, 0.288155526f},
-std::array<float,2>{0.0827035606f, 0.571715295f},
-std::array<float,2>{0.824044883f, 0.787352264f},
-std::array<float,2>{0.161434501f, 0.195667118f},
-std::array<float,2>{0.629849076f, 0.352599263f},
-std::array<float,2>{0.2733877f, 0.535117388f},
-std::array<float,2>{0.594198465f, 0.633741498f},
-std::array<float,2>{0.404843539f, 0.436612993f},
-std::array<float,2>{0.952512324f, 0.1194271f},
-std::array<float,2>{0.011009953f, 0.879262567f},
-std::array<float,2>{0.875295043f, 0.603799284f},
-std::array<float,2>{0.0971689671f, 0.270438701f},
-std::array<float,2>{0.562195122f, 0.167282864f},
-std::array<float,2>{0.45153144f, 0.860526145f},
-std::array<float,2>{0.710481167f, 0.971918106f},
-std::array<float,2>{0.373347133f, 0.011476404f},
-std::array<float,2>{0.811080337f, 0.44682163f},
-std::array<float,2>{0.191224977f, 0.697530508f},
-std::array<float,2>{0.85896188f, 0.888236284f},
-std::array<float,2>{0.128186435f, 0.113110818f},
-std::array<float,2>{0.673292339f, 0.421933681f},
-std::array<float,2>{0.288288176f, 0.627601027f},
-std::array<float,2>{0.576851249f, 0.542272925f},
-std::array<float,2>{0.432742745f, 0.344873488f},
-std::array<float,2>{0.99336791f, 0.193296149f},
-std::array<float,2>{0.0465874672f, 0.794668615f},
-std::array<float,2>{0.920876205f, 0.687872469f},
-std::array<float,2>{0.0895192623f, 0.437522531f},
-std::array<float,2>{0.53123337f, 0.00143495901f},
-std::array<float,2>{0.488097072f, 0.981105089f},
-std::array<float,2>{0.741877139f, 0.87087965f},
-std::array<float,2>{0.320250154f, 0.157974973f},
-std::array<float,2>{0.753687024f, 0.279759139f},
-std::array<float,2>{0.232503399f, 0.597671747f},
-std::array<float,2>{0.939974546f, 0.777626574f},
-std::array<float,2>{0.00778110325f, 0.242864475f},
-std::array<float,2>{0.603915393f, 0.317421794f},
-std::array<float,2>{0.392673284f, 0.524823368f},
-std::array<float,2>{0.640439212f, 0.66417259f},
-std::array<float,2>{0.27471748f, 0.381256461f},
-std::array<float,2>{0.819651306f, 0.0658114925f},
-std::array<float,2>{0.167211041f, 0.927131534f},
-std::array<float,2>{0.80180335f, 0.565567851f},
-std::array<float,2>{0.200801492f, 0.289525777f},
-std::array<float,2>{0.715316236f, 0.130797476f},
-std::array<float,2>{0.366687417f, 0.838018656f},
-std::array<float,2>{0.546896815f, 0.940386295f},
-std::array<float,2>{0.439206988f, 0.0473683253f},
-std::array<float,2>{0.882896304f, 0.481671065f},
-std::array<float,2>{0.108736165f, 0.749610066f},
-std::array<float,2>{0.89773047f, 0.984720469f},
-std::array<float,2>{0.121833697f, 0.0299899206f},
-std::array<float,2>{0.537512839f, 0.462856501f},
-std::array<float,2>{0.46841687f, 0.708267808f},
-std::array<float,2>{0.692327738f, 0.616823256f},
-std::array<float,2>{0.346551985f, 0.262000859f},
-std::array<float,2>{0.787452102f, 0.172484726f},
-std::array<float,2>{0.212309092f, 0.843972623f},
-std::array<float,2>{0.835212648f, 0.655393004f},
-std::array<float,2>{0.17647025f, 0.419108599f},
-std::array<float,2>{0.649278283f, 0.100397013f},
-std::array<float,2>{0.255885571f, 0.905976117f},
-std::array<float,2>{0.619831324f, 0.796984732f},
-std::array<float,2>{0.375842482f, 0.204073727f},
-std::array<float,2>{0.960663199f, 0.372251809f},
-std::array<float,2>{0.0248653237f, 0.548548043f},
-std::array<float,2>{0.774354219f, 0.813096106f},
-std::array<float,2>{0.241395742f, 0.14872168f},
-std::array<float,2>{0.719315827f, 0.299006402f},
-std::array<float,2>{0.329725295f, 0.589247882f},
-std::array<float,2>{0.515341699f, 0.728055656f},
-std::array<float,2>{0.482796162f, 0.492296666f},
-std::array<float,2>{0.936717272f, 0.0324222893f},
-std::array<float,2>{0.0770488605f, 0.96750164f},
-std::array<float,2>{0.972454965f, 0.506653607f},
-std::array<float,2>{0.0485883541f, 0.341346383f},
-std::array<float,2>{0.592875898f, 0.220767438f},
-std::array<float,2>{0.406702071f, 0.76134181f},
-std::array<float,2>{0.669546187f, 0.909761012f},
-std::array<float,2>{0.310799927f, 0.0915791541f},
-std::array<float,2>{0.872511983f, 0.397569031f},
-std::array<float,2>{0.15078792f, 0.67693603f},
-std::array<float,2>{0.860366702f, 0.942052901f},
-std::array<float,2>{0.146037683f, 0.0520086065f},
-std::array<float,2>{0.661126375f, 0.477059394f},
-std::array<float,2>{0.299764305f, 0.743540168f},
-std::array<float,2>{0.585007548f, 0.567886829f},
-std::array<float,2>{0.417618513f, 0.293793321f},
-std::array<float,2>{0.980281949f, 0.126083538f},
-std::array<float,2>{0.0553853773f, 0.840935349f},
-std::array<float,2>{0.922206163f, 0.66826582f},
-std::array<float,2>{0.0689577088f, 0.378270864f},
-std::array<float,2>{0.505778015f, 0.0686648563f},
-std::array<float,2>{0.474863738f, 0.925414681f},
-std::array<float,2>{0.729709446f, 0.775633693f},
-std::array<float,2>{0.343184799f, 0.249006599f},
-std::array<float,2>{0.76724422f, 0.314246714f},
-std::array<float,2>{0.249248073f, 0.529343486f},
-std::array<float,2>{0.964907289f, 0.873933852f},
-std::array<float,2>{0.0168433208f, 0.163391411f},
-std::array<float,2>{0.617171526f, 0.273788214f},
-std::array<float,2>{0.389304817f, 0.596128881f},
-std::array<float,2>{0.640779316f, 0.691696167f},
-std::array<float,2>{0.263717204f, 0.442616165f},
-std::array<float,2>{0.838117063f, 0.00758631434f},
-std::array<float,2>{0.182271689f, 0.977043748f},
-std::array<float,2>{0.792530835f, 0.544589877f},
-std::array<float,2>{0.209859446f, 0.350589693f},
-std::array<float,2>{0.699215293f, 0.189708695f},
-std::array<float,2>{0.358969599f, 0.79132694f},
-std::array<float,2>{0.545082927f, 0.883263826f},
-std::array<float,2>{0.45736596f, 0.116644055f},
-std::array<float,2>{0.901673913f, 0.428390026f},
-std::array<float,2>{0.115177661f, 0.629214048f},
-std::array<float,2>{0.879450321f, 0.91235745f},
-std::array<float,2>{0.0998855159f, 0.0888779014f},
-std::array<float,2>{0.556490481f, 0.393812716f},
-std::array<float,2>{0.448875099f, 0.67463541f},
-std::array<float,2>{0.706035554f, 0.502790332f},
-std::array<float,2>{0.368040711f, 0.337495923f},
-std::array<float,2>{0.807104051f, 0.224653423f},
-std::array<float,2>{0.1946688f, 0.764004171f},
-std::array<float,2>{0.828007638f, 0.734204471f},
-std::array<float,2>{0.156567037f, 0.496496886f},
-std::array<float,2>{0.628711104f, 0.0366839431f},
-std::array<float,2>{0.267196864f, 0.963133156f},
-std::array<float,2>{0.599968493f, 0.818077266f},
-std::array<float,2>{0.398816198f, 0.15582417f},
-std::array<float,2>{0.946029305f, 0.303287208f},
-std::array<float,2>{0.0146493455f, 0.592132688f},
-std::array<float,2>{0.763357759f, 0.802130938f},
-std::array<float,2>{0.221141517f, 0.210315466f},
-std::array<float,2>{0.747348487f, 0.370561153f},
-std::array<float,2>{0.324634671f, 0.551205754f},
-std::array<float,2>{0.519803286f, 0.650722921f},
-std::array<float,2>{0.496948421f, 0.415996671f},
-std::array<float,2>{0.913010716f, 0.0944459364f},
-std::array<float,2>{0.0813795179f, 0.901226759f},
-std::array<float,2>{0.985272586f, 0.612724781f},
-std::array<float,2>{0.0382270701f, 0.259136647f},
-std::array<float,2>{0.568076313f, 0.178212896f},
-std::array<float,2>{0.426821083f, 0.849865794f},
-std::array<float,2>{0.686484694f, 0.989747763f},
-std::array<float,2>{0.293650568f, 0.0257927291f},
-std::array<float,2>{0.846087277f, 0.467770636f},
-std::array<float,2>{0.139986709f, 0.705176175f},
-std::array<float,2>{0.798588932f, 0.892026067f},
-std::array<float,2>{0.19666107f, 0.106786661f},
-std::array<float,2>{0.71317786f, 0.408082008f},
-std::array<float,2>{0.363132894f, 0.645841539f},
-std::array<float,2>{0.554559052f, 0.560249567f},
-std::array<float,2>{0.442687631f, 0.361028969f},
-std::array<float,2>{0.888077974f, 0.214561135f},
-std::array<float,2>{0.103975981f, 0.812368453f},
-std::array<float,2>{0.9439466f, 0.712322176f},
-std::array<float,2>{0.00245527201f, 0.455543131f},
-std::array<float,2>{0.608337224f, 0.0182445794f},
-std::array<float,2>{0.396060973f, 0.995316565f},
-std::array<float,2>{0.635803521f, 0.854961216f},
-std::array<float,2>{0.28108263f, 0.181824058f},
-std::array<float,2>{0.81499058f, 0.250475377f},
-std::array<float,2>{0.168883651f, 0.619684279f},
-std::array<float,2>{0.914662957f, 0.757406414f},
-std::array<float,2>{0.0899437964f, 0.232440934f},
-std::array<float,2>{0.525736272f, 0.33561489f},
-std::array<float,2>{0.491904408f, 0.515485168f},
-std::array<float,2>{0.734771729f, 0.685292065f},
-std::array<float,2>{0.3150599f, 0.403919041f},
-std::array<float,2>{0.756929696f, 0.0794899091f},
-std::array<float,2>{0.228651181f, 0.917306066f},
-std::array<float,2>{0.853759348f, 0.584161699f},
-std::array<float,2>{0.130999148f, 0.310588658f},
-std::array<float,2>{0.67841959f, 0.143525213f},
-std::array<float,2>{0.2830365f, 0.82215029f},
-std::array<float,2>{0.572545767f, 0.956161439f},
-std::array<float,2>{0.436872184f, 0.0441994853f},
-std::array<float,2>{0.997822523f, 0.492073625f},
-std::array<float,2>{0.041453477f, 0.719680429f},
-std::array<float,2>{0.973471165f, 0.976281524f},
-std::array<float,2>{0.0541857965f, 0.0152081773f},
-std::array<float,2>{0.589492559f, 0.451889932f},
-std::array<float,2>{0.413074255f, 0.701573372f},
-std::array<float,2>{0.667209864f, 0.605634868f},
-std::array<float,2>{0.308124214f, 0.266377091f},
-std::array<float,2>{0.870076299f, 0.168623686f},
-std::array<float,2>{0.153387696f, 0.864045978f},
-std::array<float,2>{0.780833483f, 0.639711916f},
-std::array<float,2>{0.234878853f, 0.432440877f},
-std::array<float,2>{0.724674404f, 0.124438465f},
-std::array<float,2>{0.334927738f, 0.876993835f},
-std::array<float,2>{0.50808531f, 0.784023643f},
-std::array<float,2>{0.477912605f, 0.202915445f},
-std::array<float,2>{0.930920243f, 0.356671453f},
-std::array<float,2>{0.0741752982f, 0.538712859f},
-std::array<float,2>{0.830953658f, 0.829817414f},
-std::array<float,2>{0.174461663f, 0.134925872f},
-std::array<float,2>{0.654611349f, 0.283131331f},
-std::array<float,2>{0.251547515f, 0.578052819f},
-std::array<float,2>{0.623561084f, 0.734383464f},
-std::array<float,2>{0.379115254f, 0.474203289f},
-std::array<float,2>{0.953907311f, 0.0607549995f},
-std::array<float,2>{0.0298019033f, 0.946337938f},
-std::array<float,2>{0.891608298f, 0.521965563f},
-std::array<float,2>{0.1182632f, 0.321396679f},
-std::array<float,2>{0.534061611f, 0.236231431f},
-std::array<float,2>{0.463220835f, 0.772787452f},
-std::array<float,2>{0.689558566f, 0.932211578f},
-std::array<float,2>{0.35076493f, 0.070532538f},
-std::array<float,2>{0.782666266f, 0.38607192f},
-std::array<float,2>{0.21821627f, 0.661888063f},
-std::array<float,2>{0.771547139f, 0.997650921f},
-std::array<float,2>{0.244740739f, 0.022720281f},
-std::array<float,2>{0.730789244f, 0.459442616f},
-std::array<float,2>{0.33628118f, 0.717510402f},
-std::array<float,2>{0.503122807f, 0.622232616f},
-std::array<float,2>{0.469149321f, 0.254884481f},
-std::array<float,2>{0.928881168f, 0.18638885f},
-std::array<float,2>{0.0629954562f, 0.858221412f},
-std::array<float,2>{0.983767688f, 0.641652346f},
-std::array<float,2>{0.0597784966f, 0.41291675f},
-std::array<float,2>{0.580241263f, 0.104067452f},
-std::array<float,2>{0.421667218f, 0.898118794f},
-std::array<float,2>{0.658943534f, 0.805776656f},
-std::array<float,2>{0.302924603f, 0.217444345f},
-std::array<float,2>{0.863294899f, 0.364421338f},
-std::array<float,2>{0.142106846f, 0.556828678f},
-std::array<float,2>{0.903592348f, 0.825341523f},
-std::array<float,2>{0.111367777f, 0.14577125f},
-std::array<float,2>{0.539746761f, 0.307289332f},
-std::array<float,2>{0.456313193f, 0.58048749f},
-std::array<float,2>{0.699317276f, 0.726304293f},
-std::array<float,2>{0.352061152f, 0.487935126f},
-std::array<float,2>{0.79445529f, 0.0390802324f},
-std::array<float,2>{0.203311339f, 0.957530975f},
-std::array<float,2>{0.841451824f, 0.511258364f},
-std::array<float,2>{0.184651449f, 0.330884069f},
-std::array<float,2>{0.645236969f, 0.228827789f},
-std::array<float,2>{0.257984132f, 0.752634048f},
-std::array<float,2>{0.61042136f, 0.919362903f},
-std::array<float,2>{0.383552939f, 0.0824910998f},
-std::array<float,2>{0.961430788f, 0.402125567f},
-std::array<float,2>{0.0201729555f, 0.680910587f},
-std::array<float,2>{0.949887514f, 0.881205678f},
-std::array<float,2>{0.0080840867f, 0.119000547f},
-std::array<float,2>{0.597461998f, 0.435533881f},
-std::array<float,2>{0.402599871f, 0.635021329f},
-std::array<float,2>{0.631882668f, 0.532342911f},
-std::array<float,2>{0.270506293f, 0.355422854f},
-std::array<float,2>{0.821442425f, 0.19775179f},
-std::array<float,2>{0.162928566f, 0.785404682f},
-std::array<float,2>{0.808640957f, 0.695422709f},
-std::array<float,2>{0.189236358f, 0.448605388f},
-std::array<float,2>{0.708028615f, 0.00817013718f},
-std::array<float,2>{0.371257246f, 0.969380021f},
-std::array<float,2>{0.558834016f, 0.862306595f},
-std::array<float,2>{0.449774504f, 0.165536776f},
-std::array<float,2>{0.878457189f, 0.272892028f},
-std::array<float,2>{0.095041208f, 0.602556527f},
-std::array<float,2>{0.848980904f, 0.768547058f},
-std::array<float,2>{0.13377291f, 0.24199909f},
-std::array<float,2>{0.681513429f, 0.327378124f},
-std::array<float,2>{0.292139918f, 0.518052936f},
-std::array<float,2>{0.563393176f, 0.658881843f},
-std::array<float,2>{0.425448149f, 0.389066041f},
-std::array<float,2>{0.988467872f, 0.0775800496f},
-std::array<float,2>{0.0348258279f, 0.937489927f},
-std::array<float,2>{0.907475293f, 0.573249578f},
-std::array<float,2>{0.0847192481f, 0.285927594f},
-std::array<float,2>{0.51932019f, 0.1370029f},
-std::array<float,2>{0.494377851f, 0.833299756f},
-std::array<float,2>{0.744401932f, 0.952232659f},
-std::array<float,2>{0.322528094f, 0.0565956123f},
-std::array<float,2>{0.760711372f, 0.472600251f},
-std::array<float,2>{0.225234866f, 0.739494801f},
-std::array<float,2>{0.817687511f, 0.928320467f},
-std::array<float,2>{0.164539859f, 0.0634920523f},
-std::array<float,2>{0.637752533f, 0.380694747f},
-std::array<float,2>{0.276593029f, 0.666887879f},
-std::array<float,2>{0.602112889f, 0.52629596f},
-std::array<float,2>{0.391778022f, 0.319834709f},
-std::array<float,2>{0.937631786f, 0.245341495f},
-std::array<float,2>{0.00553855719f, 0.779528201f},
-std::array<float,2>{0.884888053f, 0.747168362f},
-std::array<float,2>{0.106901892f, 0.48363331f},
-std::array<float,2>{0.550541639f, 0.0501539446f},
-std::array<float,2>{0.439608127f, 0.938132465f},
-std::array<float,2>{0.717605889f, 0.836790621f},
-std::array<float,2>{0.364104986f, 0.131768078f},
-std::array<float,2>{0.803270221f, 0.29260987f},
-std::array<float,2>{0.201574445f, 0.564067662f},
-std::array<float,2>{0.994388878f, 0.795326054f},
-std::array<float,2>{0.0443049222f, 0.194104984f},
-std::array<float,2>{0.576136112f, 0.346801579f},
-std::array<float,2>{0.431299478f, 0.539779186f},
-std::array<float,2>{0.67488277f, 0.626302421f},
-std::array<float,2>{0.285649776f, 0.424195647f},
-std::array<float,2>{0.856495976f, 0.111304134f},
-std::array<float,2>{0.125530675f, 0.890054166f},
-std::array<float,2>{0.751529932f, 0.60139358f},
-std::array<float,2>{0.23142229f, 0.27865383f},
-std::array<float,2>{0.739037514f, 0.158284158f},
-std::array<float,2>{0.318317264f, 0.86828059f},
-std::array<float,2>{0.528674245f, 0.983553708f},
-std::array<float,2>{0.48536244f, 0.00201708637f},
-std::array<float,2>{0.918048799f, 0.440196604f},
-std::array<float,2>{0.0873889551f, 0.691207767f},
-std::array<float,2>{0.934694052f, 0.96582824f},
-std::array<float,2>{0.0749443024f, 0.0342056379f},
-std::array<float,2>{0.512493432f, 0.494943351f},
-std::array<float,2>{0.481951296f, 0.729723454f},
-std::array<float,2>{0.72093612f, 0.586675048f},
-std::array<float,2>{0.331192046f, 0.297401726f},
-std::array<float,2>{0.777161479f, 0.152243599f},
-std::array<float,2>{0.240150362f, 0.815907598f},
-std::array<float,2>{0.873193264f, 0.678479254f},
-std::array<float,2>{0.149756089f, 0.39498356f},
-std::array<float,2>{0.669929802f, 0.0923380256f},
-std::array<float,2>{0.309864372f, 0.90748769f},
-std::array<float,2>{0.591320932f, 0.758766115f},
-std::array<float,2>{0.40823108f, 0.219924495f},
-std::array<float,2>{0.968810141f, 0.343423516f},
-std::array<float,2>{0.0495165549f, 0.504171014f},
-std::array<float,2>{0.785534918f, 0.847564042f},
-std::array<float,2>{0.212997019f, 0.175150797f},
-std::array<float,2>{0.693904161f, 0.264870971f},
-std::array<float,2>{0.344554603f, 0.614120662f},
-std::array<float,2>{0.536940336f, 0.710536718f},
-std::array<float,2>{0.466498077f, 0.463941932f},
-std::array<float,2>{0.895087183f, 0.0292529557f},
-std::array<float,2>{0.124977246f, 0.987925708f},
-std::array<float,2>{0.958547831f, 0.549218535f},
-std::array<float,2>{0.0265294909f, 0.373826146f},
-std::array<float,2>{0.618886411f, 0.206350088f},
-std::array<float,2>{0.377433091f, 0.80032146f},
-std::array<float,2>{0.651191652f, 0.904122889f},
-std::array<float,2>{0.254128903f, 0.0995255932f},
-std::array<float,2>{0.832238376f, 0.420397133f},
-std::array<float,2>{0.179412082f, 0.652599275f}}
\ No newline at end of file
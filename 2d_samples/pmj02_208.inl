@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.14388521f, 0.00683080964f},
-std::array<float,2>{0.546821058f, 0.954541802f},
-std::array<float,2>{0.322733134f, 0.530412316f},
-std::array<float,2>{0.77538377f, 0.331199586f},
-std::array<float,2>{0.406787068f, 0.395704597f},
-std::array<float,2>{0.999126196f, 0.680080295f},
-std::array<float,2>{0.0324394777f, 0.81352216f},
-std::array<float,2>{0.652954996f, 0.208904803f},
-std::array<float,2>{0.252456278f, 0.161289826f},
-std::array<float,2>{0.87173605f, 0.790202141f},
-std::array<float,2>{0.192669645f, 0.695165813f},
-std::array<float,2>{0.60273999f, 0.443311989f},
-std::array<float,2>{0.093047522f, 0.276364803f},
-std::array<float,2>{0.70732379f, 0.58368963f},
-std::array<float,2>{0.485178858f, 0.878252387f},
-std::array<float,2>{0.885963738f, 0.0713559464f},
-std::array<float,2>{0.00531835761f, 0.238493443f},
-std::array<float,2>{0.673135638f, 0.866183221f},
-std::array<float,2>{0.383927882f, 0.642365992f},
-std::array<float,2>{0.959502101f, 0.413970739f},
-std::array<float,2>{0.346651137f, 0.369903058f},
-std::array<float,2>{0.790955186f, 0.540347815f},
-std::array<float,2>{0.178782165f, 0.984990776f},
-std::array<float,2>{0.505130827f, 0.0534955375f},
-std::array<float,2>{0.446669817f, 0.115209848f},
-std::array<float,2>{0.923684299f, 0.935767829f},
-std::array<float,2>{0.114095822f, 0.604357362f},
-std::array<float,2>{0.747871101f, 0.29204008f},
-std::array<float,2>{0.239534721f, 0.496734738f},
-std::array<float,2>{0.580522418f, 0.733891249f},
-std::array<float,2>{0.286082476f, 0.754904032f},
-std::array<float,2>{0.822117627f, 0.142459378f},
-std::array<float,2>{0.204697594f, 0.13320227f},
-std::array<float,2>{0.617928565f, 0.77799511f},
-std::array<float,2>{0.271605372f, 0.746298909f},
-std::array<float,2>{0.849996328f, 0.474025816f},
-std::array<float,2>{0.476306766f, 0.29803592f},
-std::array<float,2>{0.892474651f, 0.620085001f},
-std::array<float,2>{0.0653480887f, 0.919015706f},
-std::array<float,2>{0.691959143f, 0.107198305f},
-std::array<float,2>{0.334180832f, 0.0436919443f},
-std::array<float,2>{0.752811074f, 0.970261395f},
-std::array<float,2>{0.130138353f, 0.559535623f},
-std::array<float,2>{0.560453236f, 0.348868489f},
-std::array<float,2>{0.0518944263f, 0.432572395f},
-std::array<float,2>{0.629983425f, 0.625167251f},
-std::array<float,2>{0.431852371f, 0.848917127f},
-std::array<float,2>{0.976755142f, 0.232827216f},
-std::array<float,2>{0.0942903459f, 0.0881700516f},
-std::array<float,2>{0.730647981f, 0.898530662f},
-std::array<float,2>{0.466751277f, 0.571009576f},
-std::array<float,2>{0.916051865f, 0.25359866f},
-std::array<float,2>{0.311580092f, 0.462074697f},
-std::array<float,2>{0.837592244f, 0.70924449f},
-std::array<float,2>{0.227672622f, 0.798407197f},
-std::array<float,2>{0.565546453f, 0.182851195f},
-std::array<float,2>{0.396942437f, 0.191237167f},
-std::array<float,2>{0.941148639f, 0.838092029f},
-std::array<float,2>{0.0286377929f, 0.670542777f},
-std::array<float,2>{0.671747804f, 0.375879973f},
-std::array<float,2>{0.161816642f, 0.325562775f},
-std::array<float,2>{0.522122443f, 0.505319357f},
-std::array<float,2>{0.364053607f, 0.946216822f},
-std::array<float,2>{0.802425683f, 0.0247160569f},
-std::array<float,2>{0.21888417f, 0.101066642f},
-std::array<float,2>{0.574919224f, 0.909855187f},
-std::array<float,2>{0.300396711f, 0.614585459f},
-std::array<float,2>{0.828669429f, 0.311742425f},
-std::array<float,2>{0.459899455f, 0.481749654f},
-std::array<float,2>{0.911082208f, 0.734950066f},
-std::array<float,2>{0.106759489f, 0.772268891f},
-std::array<float,2>{0.724274874f, 0.132600904f},
-std::array<float,2>{0.37285009f, 0.219455108f},
-std::array<float,2>{0.810451031f, 0.856699824f},
-std::array<float,2>{0.169090286f, 0.639052868f},
-std::array<float,2>{0.527851284f, 0.424740791f},
-std::array<float,2>{0.0190426409f, 0.355752647f},
-std::array<float,2>{0.661241591f, 0.550434172f},
-std::array<float,2>{0.405221134f, 0.982200742f},
-std::array<float,2>{0.94973737f, 0.0338527076f},
-std::array<float,2>{0.0751140788f, 0.177298009f},
-std::array<float,2>{0.702067137f, 0.809840977f},
-std::array<float,2>{0.480703354f, 0.71582818f},
-std::array<float,2>{0.9040851f, 0.460733771f},
-std::array<float,2>{0.274581075f, 0.264869899f},
-std::array<float,2>{0.85443747f, 0.563384473f},
-std::array<float,2>{0.217734829f, 0.895316899f},
-std::array<float,2>{0.611320734f, 0.0814122558f},
-std::array<float,2>{0.426406324f, 0.021442946f},
-std::array<float,2>{0.970499039f, 0.940553308f},
-std::array<float,2>{0.0591289438f, 0.510728478f},
-std::array<float,2>{0.635437906f, 0.318530828f},
-std::array<float,2>{0.139862522f, 0.383101106f},
-std::array<float,2>{0.551318109f, 0.6611377f},
-std::array<float,2>{0.343717068f, 0.830604553f},
-std::array<float,2>{0.765008271f, 0.198697016f},
-std::array<float,2>{0.180913284f, 0.216389462f},
-std::array<float,2>{0.509958088f, 0.828096747f},
-std::array<float,2>{0.35701856f, 0.67622757f},
-std::array<float,2>{0.781530261f, 0.405820668f},
-std::array<float,2>{0.377973974f, 0.339040995f},
-std::array<float,2>{0.961668789f, 0.522419572f},
-std::array<float,2>{0.0138466479f, 0.963710189f},
-std::array<float,2>{0.685743272f, 0.0143757146f},
-std::array<float,2>{0.294311494f, 0.0696909502f},
-std::array<float,2>{0.815242946f, 0.890153289f},
-std::array<float,2>{0.248199508f, 0.58716929f},
-std::array<float,2>{0.586587071f, 0.267427474f},
-std::array<float,2>{0.120602161f, 0.451811761f},
-std::array<float,2>{0.739833295f, 0.696743429f},
-std::array<float,2>{0.442407638f, 0.788244724f},
-std::array<float,2>{0.934052467f, 0.166812539f},
-std::array<float,2>{0.0411777869f, 0.0614910945f},
-std::array<float,2>{0.642473578f, 0.993978083f},
-std::array<float,2>{0.417548925f, 0.536071599f},
-std::array<float,2>{0.987581015f, 0.360669434f},
-std::array<float,2>{0.317530543f, 0.417343229f},
-std::array<float,2>{0.773056626f, 0.653239071f},
-std::array<float,2>{0.153322384f, 0.873230278f},
-std::array<float,2>{0.532046497f, 0.244173691f},
-std::array<float,2>{0.49701637f, 0.152884007f},
-std::array<float,2>{0.879836738f, 0.765543938f},
-std::array<float,2>{0.0833032876f, 0.726233244f},
-std::array<float,2>{0.716477096f, 0.490627617f},
-std::array<float,2>{0.202714711f, 0.283334047f},
-std::array<float,2>{0.600719273f, 0.601153314f},
-std::array<float,2>{0.264928043f, 0.924295306f},
-std::array<float,2>{0.865558803f, 0.122382596f},
-std::array<float,2>{0.167006478f, 0.0762076825f},
-std::array<float,2>{0.524285018f, 0.881113946f},
-std::array<float,2>{0.368479133f, 0.579057455f},
-std::array<float,2>{0.804738045f, 0.279761404f},
-std::array<float,2>{0.398939043f, 0.440072447f},
-std::array<float,2>{0.947332382f, 0.688977957f},
-std::array<float,2>{0.0219439194f, 0.796246409f},
-std::array<float,2>{0.657382786f, 0.158143848f},
-std::array<float,2>{0.304488957f, 0.206509471f},
-std::array<float,2>{0.832312763f, 0.816974461f},
-std::array<float,2>{0.225291431f, 0.685527146f},
-std::array<float,2>{0.572790086f, 0.392394722f},
-std::array<float,2>{0.102511689f, 0.333271295f},
-std::array<float,2>{0.722317696f, 0.526536584f},
-std::array<float,2>{0.454137534f, 0.960419416f},
-std::array<float,2>{0.908209443f, 0.000852164463f},
-std::array<float,2>{0.0547455512f, 0.144831911f},
-std::array<float,2>{0.639278769f, 0.752496541f},
-std::array<float,2>{0.424496144f, 0.728807747f},
-std::array<float,2>{0.975567877f, 0.494912654f},
-std::array<float,2>{0.339152902f, 0.294591606f},
-std::array<float,2>{0.758612931f, 0.607305348f},
-std::array<float,2>{0.136217043f, 0.932061017f},
-std::array<float,2>{0.547727048f, 0.111499406f},
-std::array<float,2>{0.479835153f, 0.0507769436f},
-std::array<float,2>{0.901771426f, 0.988792598f},
-std::array<float,2>{0.0727224126f, 0.545169353f},
-std::array<float,2>{0.695535362f, 0.373480767f},
-std::array<float,2>{0.211175144f, 0.409138411f},
-std::array<float,2>{0.613884211f, 0.64828366f},
-std::array<float,2>{0.278657109f, 0.862455666f},
-std::array<float,2>{0.85577327f, 0.235072464f},
-std::array<float,2>{0.245694369f, 0.226696253f},
-std::array<float,2>{0.592203557f, 0.845390856f},
-std::array<float,2>{0.29214865f, 0.631064773f},
-std::array<float,2>{0.81790638f, 0.436206639f},
-std::array<float,2>{0.440492511f, 0.344168156f},
-std::array<float,2>{0.93308866f, 0.555256486f},
-std::array<float,2>{0.123276107f, 0.97295469f},
-std::array<float,2>{0.734460533f, 0.0429432318f},
-std::array<float,2>{0.354278117f, 0.102607466f},
-std::array<float,2>{0.787421405f, 0.914758682f},
-std::array<float,2>{0.18365024f, 0.623358786f},
-std::array<float,2>{0.512037575f, 0.303554207f},
-std::array<float,2>{0.00818163902f, 0.469491154f},
-std::array<float,2>{0.679767013f, 0.74503231f},
-std::array<float,2>{0.381439567f, 0.775979877f},
-std::array<float,2>{0.965610206f, 0.136913911f},
-std::array<float,2>{0.0807370469f, 0.0280458517f},
-std::array<float,2>{0.714650214f, 0.950237572f},
-std::array<float,2>{0.492998511f, 0.503676713f},
-std::array<float,2>{0.878528357f, 0.32058841f},
-std::array<float,2>{0.260654032f, 0.381178796f},
-std::array<float,2>{0.861353695f, 0.667290628f},
-std::array<float,2>{0.19765988f, 0.843659937f},
-std::array<float,2>{0.594274819f, 0.191595882f},
-std::array<float,2>{0.420342922f, 0.187238529f},
-std::array<float,2>{0.989657581f, 0.804617047f},
-std::array<float,2>{0.0444718525f, 0.706526339f},
-std::array<float,2>{0.645230174f, 0.467360318f},
-std::array<float,2>{0.149512216f, 0.256766081f},
-std::array<float,2>{0.536174893f, 0.575219274f},
-std::array<float,2>{0.316094041f, 0.905586779f},
-std::array<float,2>{0.768801391f, 0.0922694653f},
-std::array<float,2>{0.191354737f, 0.0359042212f},
-std::array<float,2>{0.608694136f, 0.976729751f},
-std::array<float,2>{0.255152434f, 0.553806901f},
-std::array<float,2>{0.869425118f, 0.352575123f},
-std::array<float,2>{0.490928143f, 0.426735759f},
-std::array<float,2>{0.890577793f, 0.63642174f},
-std::array<float,2>{0.0868649334f, 0.854664922f},
-std::array<float,2>{0.706875801f, 0.223520875f},
-std::array<float,2>{0.328054637f, 0.126203537f},
-std::array<float,2>{0.778239489f, 0.766750216f},
-std::array<float,2>{0.14504829f, 0.738543034f},
-std::array<float,2>{0.539784074f, 0.477641523f},
-std::array<float,2>{0.0385269746f, 0.305170327f},
-std::array<float,2>{0.651998758f, 0.612415075f},
-std::array<float,2>{0.411953747f, 0.912975311f},
-std::array<float,2>{0.995593727f, 0.0951966569f},
-std::array<float,2>{0.109781168f, 0.201635689f},
-std::array<float,2>{0.742575586f, 0.835446477f},
-std::array<float,2>{0.453025281f, 0.659698546f},
-std::array<float,2>{0.929632545f, 0.39054051f},
-std::array<float,2>{0.283414632f, 0.315140873f},
-std::array<float,2>{0.827117443f, 0.512146354f},
-std::array<float,2>{0.234702036f, 0.943252265f},
-std::array<float,2>{0.585824549f, 0.0168158337f},
-std::array<float,2>{0.387658298f, 0.0859135687f},
-std::array<float,2>{0.953668714f, 0.893275082f},
-std::array<float,2>{0.00339891342f, 0.567568481f},
-std::array<float,2>{0.677064419f, 0.258453786f},
-std::array<float,2>{0.172967046f, 0.454024285f},
-std::array<float,2>{0.500839531f, 0.713202536f},
-std::array<float,2>{0.350106359f, 0.807894111f},
-std::array<float,2>{0.795343995f, 0.173556983f},
-std::array<float,2>{0.127843276f, 0.169186398f},
-std::array<float,2>{0.556987703f, 0.784569144f},
-std::array<float,2>{0.330378443f, 0.702020049f},
-std::array<float,2>{0.757374942f, 0.447652638f},
-std::array<float,2>{0.434901983f, 0.272446007f},
-std::array<float,2>{0.981862128f, 0.591126859f},
-std::array<float,2>{0.0469247513f, 0.884773672f},
-std::array<float,2>{0.625770152f, 0.0644056052f},
-std::array<float,2>{0.266580939f, 0.0101919994f},
-std::array<float,2>{0.847043514f, 0.96620512f},
-std::array<float,2>{0.209050193f, 0.518019676f},
-std::array<float,2>{0.621279597f, 0.340300232f},
-std::array<float,2>{0.0697294846f, 0.40197897f},
-std::array<float,2>{0.688696802f, 0.672156155f},
-std::array<float,2>{0.470991194f, 0.823524415f},
-std::array<float,2>{0.897735655f, 0.211372316f},
-std::array<float,2>{0.0269962177f, 0.120112114f},
-std::array<float,2>{0.666974545f, 0.928812087f},
-std::array<float,2>{0.393444091f, 0.594022751f},
-std::array<float,2>{0.943254292f, 0.285758823f},
-std::array<float,2>{0.360224158f, 0.48817575f},
-std::array<float,2>{0.798468232f, 0.722142279f},
-std::array<float,2>{0.158414066f, 0.761331499f},
-std::array<float,2>{0.516166508f, 0.150805578f},
-std::array<float,2>{0.462973207f, 0.248849347f},
-std::array<float,2>{0.921193123f, 0.868655324f},
-std::array<float,2>{0.0991398469f, 0.652109265f},
-std::array<float,2>{0.72840941f, 0.418014348f},
-std::array<float,2>{0.233371094f, 0.364875972f},
-std::array<float,2>{0.569293976f, 0.532643318f},
-std::array<float,2>{0.306894749f, 0.997911811f},
-std::array<float,2>{0.841299891f, 0.054757107f},
-std::array<float,2>{0.176507071f, 0.052533824f},
-std::array<float,2>{0.505883873f, 0.987455606f},
-std::array<float,2>{0.344266772f, 0.541055918f},
-std::array<float,2>{0.792831779f, 0.368503183f},
-std::array<float,2>{0.384809196f, 0.410928577f},
-std::array<float,2>{0.957636595f, 0.644078374f},
-std::array<float,2>{0.00710731279f, 0.864070117f},
-std::array<float,2>{0.674512923f, 0.241598055f},
-std::array<float,2>{0.287303776f, 0.14416562f},
-std::array<float,2>{0.82415992f, 0.757189691f},
-std::array<float,2>{0.240527108f, 0.73093307f},
-std::array<float,2>{0.578491628f, 0.498571724f},
-std::array<float,2>{0.115813076f, 0.290483952f},
-std::array<float,2>{0.749190986f, 0.601594865f},
-std::array<float,2>{0.447436094f, 0.934898853f},
-std::array<float,2>{0.923833668f, 0.116798148f},
-std::array<float,2>{0.0340088904f, 0.210427538f},
-std::array<float,2>{0.654580235f, 0.815251052f},
-std::array<float,2>{0.409512579f, 0.682173133f},
-std::array<float,2>{0.997900903f, 0.396802783f},
-std::array<float,2>{0.320934743f, 0.329117417f},
-std::array<float,2>{0.776395798f, 0.528173983f},
-std::array<float,2>{0.140655994f, 0.955233514f},
-std::array<float,2>{0.544678748f, 0.00443796534f},
-std::array<float,2>{0.487268746f, 0.0731365308f},
-std::array<float,2>{0.884034991f, 0.876589477f},
-std::array<float,2>{0.0909119472f, 0.58569026f},
-std::array<float,2>{0.709664822f, 0.273920417f},
-std::array<float,2>{0.195166036f, 0.445163816f},
-std::array<float,2>{0.605130792f, 0.692749321f},
-std::array<float,2>{0.250408769f, 0.792620003f},
-std::array<float,2>{0.873057008f, 0.162231907f},
-std::array<float,2>{0.228990316f, 0.181098551f},
-std::array<float,2>{0.563318908f, 0.80022347f},
-std::array<float,2>{0.309054524f, 0.707152963f},
-std::array<float,2>{0.838349938f, 0.463873267f},
-std::array<float,2>{0.468532383f, 0.251019299f},
-std::array<float,2>{0.9158746f, 0.573682964f},
-std::array<float,2>{0.0959313884f, 0.901061356f},
-std::array<float,2>{0.732999444f, 0.0864430293f},
-std::array<float,2>{0.366105735f, 0.0254773498f},
-std::array<float,2>{0.803892314f, 0.948063672f},
-std::array<float,2>{0.162792072f, 0.507761776f},
-std::array<float,2>{0.519888461f, 0.327870101f},
-std::array<float,2>{0.0309210718f, 0.377017796f},
-std::array<float,2>{0.668192565f, 0.669107974f},
-std::array<float,2>{0.395894736f, 0.836754799f},
-std::array<float,2>{0.938068867f, 0.189080194f},
-std::array<float,2>{0.0633229986f, 0.108208999f},
-std::array<float,2>{0.69436866f, 0.920514107f},
-std::array<float,2>{0.474425495f, 0.619134784f},
-std::array<float,2>{0.893562317f, 0.299889773f},
-std::array<float,2>{0.269852221f, 0.475895673f},
-std::array<float,2>{0.847939312f, 0.748770416f},
-std::array<float,2>{0.206358671f, 0.779609919f},
-std::array<float,2>{0.620271683f, 0.136236295f},
-std::array<float,2>{0.430536687f, 0.230850637f},
-std::array<float,2>{0.978544474f, 0.850245714f},
-std::array<float,2>{0.0537046976f, 0.62722075f},
-std::array<float,2>{0.631163716f, 0.431536078f},
-std::array<float,2>{0.132096529f, 0.349675894f},
-std::array<float,2>{0.561567068f, 0.560722947f},
-std::array<float,2>{0.333678961f, 0.971458852f},
-std::array<float,2>{0.75157398f, 0.0463417284f},
-std::array<float,2>{0.216354042f, 0.0789676085f},
-std::array<float,2>{0.612154722f, 0.89720434f},
-std::array<float,2>{0.275654197f, 0.566095531f},
-std::array<float,2>{0.852053165f, 0.262874454f},
-std::array<float,2>{0.483136415f, 0.457973331f},
-std::array<float,2>{0.905520737f, 0.718239963f},
-std::array<float,2>{0.0771283135f, 0.810937166f},
-std::array<float,2>{0.700336218f, 0.179122701f},
-std::array<float,2>{0.341426522f, 0.19672969f},
-std::array<float,2>{0.762534082f, 0.828730941f},
-std::array<float,2>{0.137664065f, 0.662367821f},
-std::array<float,2>{0.553118527f, 0.385550559f},
-std::array<float,2>{0.0619330443f, 0.318140835f},
-std::array<float,2>{0.634704649f, 0.507992923f},
-std::array<float,2>{0.428700566f, 0.938388228f},
-std::array<float,2>{0.971827269f, 0.0233819187f},
-std::array<float,2>{0.108564846f, 0.12929f},
-std::array<float,2>{0.726039231f, 0.769657373f},
-std::array<float,2>{0.4570328f, 0.736477196f},
-std::array<float,2>{0.913047433f, 0.483495563f},
-std::array<float,2>{0.297980636f, 0.308980703f},
-std::array<float,2>{0.83016479f, 0.615590096f},
-std::array<float,2>{0.220764607f, 0.907962322f},
-std::array<float,2>{0.576780617f, 0.0982067436f},
-std::array<float,2>{0.4025051f, 0.031936802f},
-std::array<float,2>{0.951687038f, 0.98433882f},
-std::array<float,2>{0.0158415865f, 0.548583329f},
-std::array<float,2>{0.662793696f, 0.358374178f},
-std::array<float,2>{0.171665967f, 0.422160238f},
-std::array<float,2>{0.531043351f, 0.637270808f},
-std::array<float,2>{0.373883069f, 0.8574242f},
-std::array<float,2>{0.81167984f, 0.221321478f},
-std::array<float,2>{0.15570119f, 0.242480621f},
-std::array<float,2>{0.534787893f, 0.871158183f},
-std::array<float,2>{0.318600506f, 0.655873477f},
-std::array<float,2>{0.769851565f, 0.414839536f},
-std::array<float,2>{0.415539861f, 0.362239987f},
-std::array<float,2>{0.985697985f, 0.538662791f},
-std::array<float,2>{0.0405083485f, 0.995572984f},
-std::array<float,2>{0.643102765f, 0.0599472411f},
-std::array<float,2>{0.263243407f, 0.124699704f},
-std::array<float,2>{0.865032256f, 0.922454178f},
-std::array<float,2>{0.199483246f, 0.599159241f},
-std::array<float,2>{0.597677827f, 0.281852424f},
-std::array<float,2>{0.0840694308f, 0.489804655f},
-std::array<float,2>{0.717617214f, 0.723308682f},
-std::array<float,2>{0.498668015f, 0.763228476f},
-std::array<float,2>{0.882719815f, 0.155436441f},
-std::array<float,2>{0.0124285817f, 0.0132436333f},
-std::array<float,2>{0.685513914f, 0.960971177f},
-std::array<float,2>{0.375960857f, 0.520092845f},
-std::array<float,2>{0.963910878f, 0.33737281f},
-std::array<float,2>{0.357937276f, 0.402381331f},
-std::array<float,2>{0.783525527f, 0.679315805f},
-std::array<float,2>{0.181642577f, 0.826013446f},
-std::array<float,2>{0.508829176f, 0.218342692f},
-std::array<float,2>{0.444204658f, 0.165147662f},
-std::array<float,2>{0.936490476f, 0.786328316f},
-std::array<float,2>{0.117586397f, 0.697801888f},
-std::array<float,2>{0.741862297f, 0.449906707f},
-std::array<float,2>{0.247769073f, 0.268815547f},
-std::array<float,2>{0.5879879f, 0.588040113f},
-std::array<float,2>{0.296527982f, 0.887591839f},
-std::array<float,2>{0.814309299f, 0.0683396161f},
-std::array<float,2>{0.134166345f, 0.110469133f},
-std::array<float,2>{0.55057323f, 0.93025142f},
-std::array<float,2>{0.335953057f, 0.60870266f},
-std::array<float,2>{0.760467052f, 0.295739949f},
-std::array<float,2>{0.423657119f, 0.494087905f},
-std::array<float,2>{0.973396242f, 0.726662636f},
-std::array<float,2>{0.0584577471f, 0.750770032f},
-std::array<float,2>{0.638235152f, 0.148415953f},
-std::array<float,2>{0.280318677f, 0.23671031f},
-std::array<float,2>{0.858457446f, 0.860244274f},
-std::array<float,2>{0.214829534f, 0.644702613f},
-std::array<float,2>{0.616443455f, 0.407672256f},
-std::array<float,2>{0.0710980073f, 0.372061878f},
-std::array<float,2>{0.698944867f, 0.544851124f},
-std::array<float,2>{0.47683683f, 0.991107047f},
-std::array<float,2>{0.899306476f, 0.0476416573f},
-std::array<float,2>{0.0204549097f, 0.158558995f},
-std::array<float,2>{0.659638762f, 0.793062329f},
-std::array<float,2>{0.401320189f, 0.690488517f},
-std::array<float,2>{0.946585059f, 0.439395487f},
-std::array<float,2>{0.370163828f, 0.279234499f},
-std::array<float,2>{0.806676805f, 0.581936121f},
-std::array<float,2>{0.164836988f, 0.879258394f},
-std::array<float,2>{0.525959074f, 0.0744900703f},
-std::array<float,2>{0.45543918f, 0.00196082634f},
-std::array<float,2>{0.906250238f, 0.957591474f},
-std::array<float,2>{0.105162427f, 0.524763405f},
-std::array<float,2>{0.719824195f, 0.335156947f},
-std::array<float,2>{0.224150836f, 0.39276883f},
-std::array<float,2>{0.57124716f, 0.686416745f},
-std::array<float,2>{0.301214337f, 0.82000494f},
-std::array<float,2>{0.835063577f, 0.204704911f},
-std::array<float,2>{0.195557714f, 0.19435592f},
-std::array<float,2>{0.597117305f, 0.841466129f},
-std::array<float,2>{0.258864105f, 0.665922105f},
-std::array<float,2>{0.860385656f, 0.379168808f},
-std::array<float,2>{0.495845646f, 0.324118525f},
-std::array<float,2>{0.876837432f, 0.501943886f},
-std::array<float,2>{0.0781254917f, 0.951856077f},
-std::array<float,2>{0.71286428f, 0.0307127945f},
-std::array<float,2>{0.31378457f, 0.0911705792f},
-std::array<float,2>{0.765867829f, 0.903868735f},
-std::array<float,2>{0.152071416f, 0.577841103f},
-std::array<float,2>{0.538092852f, 0.254822731f},
-std::array<float,2>{0.0465896912f, 0.465462893f},
-std::array<float,2>{0.646974683f, 0.704773962f},
-std::array<float,2>{0.419686288f, 0.801360607f},
-std::array<float,2>{0.990556598f, 0.185289457f},
-std::array<float,2>{0.12155693f, 0.0402584411f},
-std::array<float,2>{0.736851275f, 0.975865662f},
-std::array<float,2>{0.438373983f, 0.557377636f},
-std::array<float,2>{0.931006014f, 0.34588334f},
-std::array<float,2>{0.290850341f, 0.43434912f},
-std::array<float,2>{0.819588602f, 0.630281806f},
-std::array<float,2>{0.243727207f, 0.847483397f},
-std::array<float,2>{0.590346754f, 0.229466334f},
-std::array<float,2>{0.380499333f, 0.140249908f},
-std::array<float,2>{0.968622804f, 0.773988128f},
-std::array<float,2>{0.00985295605f, 0.742249489f},
-std::array<float,2>{0.682230175f, 0.471061945f},
-std::array<float,2>{0.185651943f, 0.302393436f},
-std::array<float,2>{0.515482247f, 0.621637404f},
-std::array<float,2>{0.353448838f, 0.916020989f},
-std::array<float,2>{0.786919117f, 0.104506381f},
-std::array<float,2>{0.237092167f, 0.0190603156f},
-std::array<float,2>{0.583628476f, 0.945273578f},
-std::array<float,2>{0.282202989f, 0.513808608f},
-std::array<float,2>{0.824506938f, 0.31337136f},
-std::array<float,2>{0.450567335f, 0.386801273f},
-std::array<float,2>{0.925883651f, 0.657836556f},
-std::array<float,2>{0.111513071f, 0.832556188f},
-std::array<float,2>{0.744646251f, 0.20102945f},
-std::array<float,2>{0.34842667f, 0.174237937f},
-std::array<float,2>{0.793999612f, 0.806580186f},
-std::array<float,2>{0.17494224f, 0.71126616f},
-std::array<float,2>{0.502310276f, 0.455641806f},
-std::array<float,2>{0.00134143687f, 0.260638148f},
-std::array<float,2>{0.678152978f, 0.568478405f},
-std::array<float,2>{0.389475793f, 0.892087698f},
-std::array<float,2>{0.955078721f, 0.0826624632f},
-std::array<float,2>{0.0889187232f, 0.226043016f},
-std::array<float,2>{0.704656005f, 0.852149129f},
-std::array<float,2>{0.489952236f, 0.634424508f},
-std::array<float,2>{0.887697399f, 0.428276986f},
-std::array<float,2>{0.256168365f, 0.354284793f},
-std::array<float,2>{0.868485689f, 0.552075744f},
-std::array<float,2>{0.189335093f, 0.978917778f},
-std::array<float,2>{0.606838167f, 0.038327273f},
-std::array<float,2>{0.412975073f, 0.0960189179f},
-std::array<float,2>{0.993687689f, 0.911308646f},
-std::array<float,2>{0.0356590189f, 0.610244215f},
-std::array<float,2>{0.649661064f, 0.306780487f},
-std::array<float,2>{0.147387758f, 0.479805827f},
-std::array<float,2>{0.54258287f, 0.741204739f},
-std::array<float,2>{0.325343192f, 0.768259406f},
-std::array<float,2>{0.779582262f, 0.127945781f},
-std::array<float,2>{0.15811877f, 0.150252432f},
-std::array<float,2>{0.518420219f, 0.758075655f},
-std::array<float,2>{0.361408561f, 0.71886903f},
-std::array<float,2>{0.800526679f, 0.484876394f},
-std::array<float,2>{0.39075914f, 0.287525475f},
-std::array<float,2>{0.944610775f, 0.597220361f},
-std::array<float,2>{0.023885699f, 0.927716196f},
-std::array<float,2>{0.664656818f, 0.118476845f},
-std::array<float,2>{0.304895252f, 0.0572712757f},
-std::array<float,2>{0.842451155f, 0.999627292f},
-std::array<float,2>{0.230523869f, 0.534546196f},
-std::array<float,2>{0.567428291f, 0.366818547f},
-std::array<float,2>{0.100641593f, 0.420803219f},
-std::array<float,2>{0.729285061f, 0.650371432f},
-std::array<float,2>{0.461791873f, 0.869217575f},
-std::array<float,2>{0.919311225f, 0.24740985f},
-std::array<float,2>{0.0504320897f, 0.0648776516f},
-std::array<float,2>{0.627820373f, 0.88357091f},
-std::array<float,2>{0.437372446f, 0.592400491f},
-std::array<float,2>{0.983957946f, 0.270921141f},
-std::array<float,2>{0.32826671f, 0.445366949f},
-std::array<float,2>{0.755764723f, 0.70102644f},
-std::array<float,2>{0.125803635f, 0.78131181f},
-std::array<float,2>{0.555312514f, 0.171100125f},
-std::array<float,2>{0.469105363f, 0.213737294f},
-std::array<float,2>{0.894938409f, 0.820384622f},
-std::array<float,2>{0.0673379824f, 0.675701857f},
-std::array<float,2>{0.689954996f, 0.398557007f},
-std::array<float,2>{0.208120733f, 0.34317717f},
-std::array<float,2>{0.623937428f, 0.516623676f},
-std::array<float,2>{0.268257409f, 0.968264461f},
-std::array<float,2>{0.844066918f, 0.00870026462f},
-std::array<float,2>{0.163887113f, 0.0238641128f},
-std::array<float,2>{0.521318972f, 0.946634173f},
-std::array<float,2>{0.366492063f, 0.504797697f},
-std::array<float,2>{0.803646088f, 0.32445243f},
-std::array<float,2>{0.394683689f, 0.376063079f},
-std::array<float,2>{0.938684702f, 0.671867847f},
-std::array<float,2>{0.029350711f, 0.83893621f},
-std::array<float,2>{0.669528663f, 0.189685732f},
-std::array<float,2>{0.310420662f, 0.182296067f},
-std::array<float,2>{0.839398801f, 0.797657132f},
-std::array<float,2>{0.229598641f, 0.710456908f},
-std::array<float,2>{0.563954055f, 0.461175025f},
-std::array<float,2>{0.0967383683f, 0.252536744f},
-std::array<float,2>{0.733614564f, 0.571747422f},
-std::array<float,2>{0.466915697f, 0.900192916f},
-std::array<float,2>{0.914925754f, 0.089711681f},
-std::array<float,2>{0.0543420091f, 0.234103322f},
-std::array<float,2>{0.632739365f, 0.848335624f},
-std::array<float,2>{0.431258202f, 0.626269221f},
-std::array<float,2>{0.979960322f, 0.433382481f},
-std::array<float,2>{0.332988828f, 0.347908616f},
-std::array<float,2>{0.750611246f, 0.560076833f},
-std::array<float,2>{0.13136898f, 0.969067335f},
-std::array<float,2>{0.560826361f, 0.0446390547f},
-std::array<float,2>{0.473588198f, 0.105729125f},
-std::array<float,2>{0.89343071f, 0.918496966f},
-std::array<float,2>{0.0643211305f, 0.62013942f},
-std::array<float,2>{0.693885803f, 0.297127813f},
-std::array<float,2>{0.205828503f, 0.473358989f},
-std::array<float,2>{0.620112777f, 0.747466803f},
-std::array<float,2>{0.271435022f, 0.779188991f},
-std::array<float,2>{0.8489784f, 0.134581387f},
-std::array<float,2>{0.241632611f, 0.140914008f},
-std::array<float,2>{0.579623401f, 0.754120946f},
-std::array<float,2>{0.288646996f, 0.73314631f},
-std::array<float,2>{0.822749019f, 0.497105539f},
-std::array<float,2>{0.449028343f, 0.291313112f},
-std::array<float,2>{0.924892366f, 0.605437934f},
-std::array<float,2>{0.116320856f, 0.937426448f},
-std::array<float,2>{0.7482391f, 0.114155039f},
-std::array<float,2>{0.345197767f, 0.0541592278f},
-std::array<float,2>{0.791216731f, 0.986284375f},
-std::array<float,2>{0.177719042f, 0.53961277f},
-std::array<float,2>{0.507272363f, 0.370950133f},
-std::array<float,2>{0.00607621577f, 0.412203759f},
-std::array<float,2>{0.67547369f, 0.641251743f},
-std::array<float,2>{0.386619359f, 0.867102206f},
-std::array<float,2>{0.958675981f, 0.239460468f},
-std::array<float,2>{0.0904665962f, 0.0706420317f},
-std::array<float,2>{0.710507274f, 0.877565682f},
-std::array<float,2>{0.487564027f, 0.582624733f},
-std::array<float,2>{0.883773923f, 0.2771056f},
-std::array<float,2>{0.251184523f, 0.442026615f},
-std::array<float,2>{0.874356627f, 0.693822086f},
-std::array<float,2>{0.194170073f, 0.789931595f},
-std::array<float,2>{0.603617191f, 0.160327494f},
-std::array<float,2>{0.408364087f, 0.207179755f},
-std::array<float,2>{0.996487796f, 0.812823474f},
-std::array<float,2>{0.0343335234f, 0.680763125f},
-std::array<float,2>{0.655889809f, 0.39494893f},
-std::array<float,2>{0.142402977f, 0.330211192f},
-std::array<float,2>{0.543584347f, 0.529891372f},
-std::array<float,2>{0.321683794f, 0.953521073f},
-std::array<float,2>{0.77635169f, 0.00727879489f},
-std::array<float,2>{0.200454354f, 0.12179292f},
-std::array<float,2>{0.599248707f, 0.925773859f},
-std::array<float,2>{0.262261719f, 0.599611938f},
-std::array<float,2>{0.863557994f, 0.284253389f},
-std::array<float,2>{0.499493808f, 0.491934389f},
-std::array<float,2>{0.881546736f, 0.724611402f},
-std::array<float,2>{0.085827969f, 0.764332414f},
-std::array<float,2>{0.718099117f, 0.153746232f},
-std::array<float,2>{0.319744885f, 0.246019691f},
-std::array<float,2>{0.770821333f, 0.874389231f},
-std::array<float,2>{0.154826552f, 0.654001594f},
-std::array<float,2>{0.533373594f, 0.416961968f},
-std::array<float,2>{0.0390869565f, 0.359920979f},
-std::array<float,2>{0.643721819f, 0.536947489f},
-std::array<float,2>{0.414460778f, 0.992462039f},
-std::array<float,2>{0.984916329f, 0.0623895489f},
-std::array<float,2>{0.11884097f, 0.167920023f},
-std::array<float,2>{0.741039515f, 0.787859976f},
-std::array<float,2>{0.444411218f, 0.695800245f},
-std::array<float,2>{0.936683774f, 0.452565193f},
-std::array<float,2>{0.29548794f, 0.266371608f},
-std::array<float,2>{0.813239515f, 0.586212397f},
-std::array<float,2>{0.24642776f, 0.889613152f},
-std::array<float,2>{0.589421093f, 0.0691916719f},
-std::array<float,2>{0.376676172f, 0.014703122f},
-std::array<float,2>{0.963352025f, 0.963890851f},
-std::array<float,2>{0.0136311781f, 0.522977531f},
-std::array<float,2>{0.684538722f, 0.338666767f},
-std::array<float,2>{0.182705685f, 0.40478158f},
-std::array<float,2>{0.508432448f, 0.676932395f},
-std::array<float,2>{0.358545572f, 0.827011168f},
-std::array<float,2>{0.784698546f, 0.215562388f},
-std::array<float,2>{0.137806877f, 0.197487131f},
-std::array<float,2>{0.553807557f, 0.831183791f},
-std::array<float,2>{0.34050861f, 0.660585761f},
-std::array<float,2>{0.763449252f, 0.383951962f},
-std::array<float,2>{0.42898941f, 0.319395483f},
-std::array<float,2>{0.971244812f, 0.51128149f},
-std::array<float,2>{0.0612063818f, 0.940060556f},
-std::array<float,2>{0.633024752f, 0.0202232283f},
-std::array<float,2>{0.276767045f, 0.0804452971f},
-std::array<float,2>{0.852854729f, 0.895942867f},
-std::array<float,2>{0.215811774f, 0.564058542f},
-std::array<float,2>{0.61300844f, 0.264525354f},
-std::array<float,2>{0.077395834f, 0.459196419f},
-std::array<float,2>{0.699504375f, 0.714874983f},
-std::array<float,2>{0.483622491f, 0.80920881f},
-std::array<float,2>{0.904957294f, 0.1765019f},
-std::array<float,2>{0.017504856f, 0.034530703f},
-std::array<float,2>{0.663441122f, 0.980853677f},
-std::array<float,2>{0.403778672f, 0.549747765f},
-std::array<float,2>{0.952437758f, 0.357070029f},
-std::array<float,2>{0.374950171f, 0.424889952f},
-std::array<float,2>{0.811100483f, 0.640141845f},
-std::array<float,2>{0.169974357f, 0.856097758f},
-std::array<float,2>{0.529772103f, 0.220253885f},
-std::array<float,2>{0.458241522f, 0.131816834f},
-std::array<float,2>{0.913119197f, 0.772777855f},
-std::array<float,2>{0.108265169f, 0.735847533f},
-std::array<float,2>{0.725511491f, 0.481112927f},
-std::array<float,2>{0.222098947f, 0.311352015f},
-std::array<float,2>{0.577970803f, 0.613853991f},
-std::array<float,2>{0.296952546f, 0.908599675f},
-std::array<float,2>{0.831769347f, 0.10041485f},
-std::array<float,2>{0.151330516f, 0.0935504884f},
-std::array<float,2>{0.537293971f, 0.904678762f},
-std::array<float,2>{0.312728673f, 0.574679911f},
-std::array<float,2>{0.767458022f, 0.257517576f},
-std::array<float,2>{0.418323129f, 0.468117058f},
-std::array<float,2>{0.991908371f, 0.705718398f},
-std::array<float,2>{0.0455455072f, 0.802852154f},
-std::array<float,2>{0.647777855f, 0.185946926f},
-std::array<float,2>{0.257815927f, 0.192428231f},
-std::array<float,2>{0.85948503f, 0.842164993f},
-std::array<float,2>{0.197176933f, 0.666741133f},
-std::array<float,2>{0.595773101f, 0.382800728f},
-std::array<float,2>{0.0792044103f, 0.32190904f},
-std::array<float,2>{0.711483598f, 0.501999676f},
-std::array<float,2>{0.494943023f, 0.949819148f},
-std::array<float,2>{0.875518858f, 0.029090913f},
-std::array<float,2>{0.0108484924f, 0.137956217f},
-std::array<float,2>{0.683370888f, 0.776857972f},
-std::array<float,2>{0.379327834f, 0.74551034f},
-std::array<float,2>{0.967759788f, 0.470605165f},
-std::array<float,2>{0.352534235f, 0.304542363f},
-std::array<float,2>{0.785632908f, 0.624148011f},
-std::array<float,2>{0.187151819f, 0.915745556f},
-std::array<float,2>{0.51434201f, 0.101872474f},
-std::array<float,2>{0.438614219f, 0.0419919379f},
-std::array<float,2>{0.93020159f, 0.973703742f},
-std::array<float,2>{0.122985899f, 0.555860579f},
-std::array<float,2>{0.737959862f, 0.344924241f},
-std::array<float,2>{0.242491707f, 0.437095404f},
-std::array<float,2>{0.591550708f, 0.632460475f},
-std::array<float,2>{0.289512753f, 0.844706953f},
-std::array<float,2>{0.818402529f, 0.22813718f},
-std::array<float,2>{0.213389918f, 0.236019641f},
-std::array<float,2>{0.615658104f, 0.861918747f},
-std::array<float,2>{0.27972883f, 0.646570861f},
-std::array<float,2>{0.857593119f, 0.409782261f},
-std::array<float,2>{0.478369415f, 0.374449074f},
-std::array<float,2>{0.899911463f, 0.545955539f},
-std::array<float,2>{0.0716686174f, 0.990109801f},
-std::array<float,2>{0.697717309f, 0.0497666821f},
-std::array<float,2>{0.337575495f, 0.112444319f},
-std::array<float,2>{0.761303008f, 0.933534563f},
-std::array<float,2>{0.133250609f, 0.605666757f},
-std::array<float,2>{0.548927307f, 0.29314813f},
-std::array<float,2>{0.0570469946f, 0.495390922f},
-std::array<float,2>{0.637003601f, 0.729714096f},
-std::array<float,2>{0.422093809f, 0.753157794f},
-std::array<float,2>{0.973887503f, 0.145965859f},
-std::array<float,2>{0.10356722f, 0.0011261882f},
-std::array<float,2>{0.719167173f, 0.95955056f},
-std::array<float,2>{0.45661664f, 0.525696933f},
-std::array<float,2>{0.907954574f, 0.33275637f},
-std::array<float,2>{0.302516252f, 0.391533822f},
-std::array<float,2>{0.834291041f, 0.683727145f},
-std::array<float,2>{0.223370552f, 0.817463934f},
-std::array<float,2>{0.571796179f, 0.205726191f},
-std::array<float,2>{0.401786536f, 0.156831771f},
-std::array<float,2>{0.946209371f, 0.795749307f},
-std::array<float,2>{0.0214735102f, 0.687980473f},
-std::array<float,2>{0.658268273f, 0.440815628f},
-std::array<float,2>{0.165105432f, 0.280551583f},
-std::array<float,2>{0.527308881f, 0.579247653f},
-std::array<float,2>{0.369215071f, 0.882570446f},
-std::array<float,2>{0.808410883f, 0.0774542317f},
-std::array<float,2>{0.232266933f, 0.0556919575f},
-std::array<float,2>{0.566434443f, 0.996612787f},
-std::array<float,2>{0.306444377f, 0.532202005f},
-std::array<float,2>{0.843159497f, 0.363615066f},
-std::array<float,2>{0.462482184f, 0.419766515f},
-std::array<float,2>{0.918539405f, 0.650828004f},
-std::array<float,2>{0.100057691f, 0.867909074f},
-std::array<float,2>{0.730116844f, 0.249801353f},
-std::array<float,2>{0.362987667f, 0.151852146f},
-std::array<float,2>{0.79902041f, 0.760149479f},
-std::array<float,2>{0.157221258f, 0.721069813f},
-std::array<float,2>{0.518989205f, 0.487154067f},
-std::array<float,2>{0.0246470943f, 0.286508709f},
-std::array<float,2>{0.665103972f, 0.594741881f},
-std::array<float,2>{0.392060459f, 0.928397357f},
-std::array<float,2>{0.943919361f, 0.120737374f},
-std::array<float,2>{0.0683084354f, 0.212730631f},
-std::array<float,2>{0.691129386f, 0.823121786f},
-std::array<float,2>{0.470654547f, 0.673351169f},
-std::array<float,2>{0.895827889f, 0.401227087f},
-std::array<float,2>{0.268771112f, 0.341685772f},
-std::array<float,2>{0.845111847f, 0.519503355f},
-std::array<float,2>{0.207171187f, 0.965736747f},
-std::array<float,2>{0.62468034f, 0.0111295525f},
-std::array<float,2>{0.436337143f, 0.0630541369f},
-std::array<float,2>{0.982912481f, 0.886360645f},
-std::array<float,2>{0.0495176576f, 0.590580285f},
-std::array<float,2>{0.628905594f, 0.273350269f},
-std::array<float,2>{0.126771972f, 0.448447496f},
-std::array<float,2>{0.556141436f, 0.702579737f},
-std::array<float,2>{0.329231888f, 0.783765495f},
-std::array<float,2>{0.754407406f, 0.168260098f},
-std::array<float,2>{0.174636349f, 0.172176778f},
-std::array<float,2>{0.503370166f, 0.807501018f},
-std::array<float,2>{0.349107295f, 0.714147449f},
-std::array<float,2>{0.793868601f, 0.45454216f},
-std::array<float,2>{0.390340209f, 0.259004116f},
-std::array<float,2>{0.956893504f, 0.566510916f},
-std::array<float,2>{0.000103684957f, 0.894060016f},
-std::array<float,2>{0.679356396f, 0.0847774073f},
-std::array<float,2>{0.282406747f, 0.0165140498f},
-std::array<float,2>{0.825988591f, 0.9420017f},
-std::array<float,2>{0.237320587f, 0.513625503f},
-std::array<float,2>{0.582655072f, 0.316159815f},
-std::array<float,2>{0.112473451f, 0.38955155f},
-std::array<float,2>{0.746074259f, 0.658473015f},
-std::array<float,2>{0.450181395f, 0.834333479f},
-std::array<float,2>{0.927602053f, 0.202600867f},
-std::array<float,2>{0.0368936956f, 0.0942134708f},
-std::array<float,2>{0.648684382f, 0.913125336f},
-std::array<float,2>{0.413317889f, 0.611710727f},
-std::array<float,2>{0.992538631f, 0.306105465f},
-std::array<float,2>{0.324269533f, 0.477410108f},
-std::array<float,2>{0.780421615f, 0.739936233f},
-std::array<float,2>{0.147727787f, 0.765803695f},
-std::array<float,2>{0.541336417f, 0.125818372f},
-std::array<float,2>{0.488434643f, 0.224201068f},
-std::array<float,2>{0.887094319f, 0.853535414f},
-std::array<float,2>{0.0881580934f, 0.634934008f},
-std::array<float,2>{0.703981817f, 0.427409291f},
-std::array<float,2>{0.188276529f, 0.351640314f},
-std::array<float,2>{0.606113732f, 0.55335927f},
-std::array<float,2>{0.257383168f, 0.977852285f},
-std::array<float,2>{0.86773473f, 0.0370916277f},
-std::array<float,2>{0.129600063f, 0.0458317287f},
-std::array<float,2>{0.558948755f, 0.971695125f},
-std::array<float,2>{0.335141599f, 0.562489271f},
-std::array<float,2>{0.753280878f, 0.35074237f},
-std::array<float,2>{0.432684749f, 0.430608958f},
-std::array<float,2>{0.978383362f, 0.628796637f},
-std::array<float,2>{0.0508583412f, 0.851184905f},
-std::array<float,2>{0.629078627f, 0.232323423f},
-std::array<float,2>{0.272539258f, 0.135487214f},
-std::array<float,2>{0.851534367f, 0.780998409f},
-std::array<float,2>{0.203928828f, 0.74935472f},
-std::array<float,2>{0.618322909f, 0.474804431f},
-std::array<float,2>{0.0660073757f, 0.299482107f},
-std::array<float,2>{0.693074167f, 0.617201924f},
-std::array<float,2>{0.475486398f, 0.921702087f},
-std::array<float,2>{0.891168952f, 0.10883227f},
-std::array<float,2>{0.0282589663f, 0.187577724f},
-std::array<float,2>{0.670149982f, 0.837228715f},
-std::array<float,2>{0.397792161f, 0.668376923f},
-std::array<float,2>{0.939548373f, 0.378577143f},
-std::array<float,2>{0.364362568f, 0.32706818f},
-std::array<float,2>{0.801214397f, 0.506338716f},
-std::array<float,2>{0.160968572f, 0.948463261f},
-std::array<float,2>{0.52335161f, 0.0269401483f},
-std::array<float,2>{0.465282738f, 0.0876128897f},
-std::array<float,2>{0.917238176f, 0.901434243f},
-std::array<float,2>{0.0949334428f, 0.573040545f},
-std::array<float,2>{0.731716156f, 0.250375688f},
-std::array<float,2>{0.227393121f, 0.463738978f},
-std::array<float,2>{0.564595938f, 0.708984315f},
-std::array<float,2>{0.310677618f, 0.799094021f},
-std::array<float,2>{0.836546719f, 0.180111215f},
-std::array<float,2>{0.191786349f, 0.163677037f},
-std::array<float,2>{0.60199362f, 0.791788578f},
-std::array<float,2>{0.253030002f, 0.692272246f},
-std::array<float,2>{0.872315943f, 0.443597585f},
-std::array<float,2>{0.485402495f, 0.274429917f},
-std::array<float,2>{0.885389447f, 0.584799826f},
-std::array<float,2>{0.0927116051f, 0.875488281f},
-std::array<float,2>{0.70824492f, 0.0740632117f},
-std::array<float,2>{0.323670477f, 0.0052917921f},
-std::array<float,2>{0.774363518f, 0.956940591f},
-std::array<float,2>{0.14270106f, 0.529125392f},
-std::array<float,2>{0.54561615f, 0.328714848f},
-std::array<float,2>{0.0321349055f, 0.397805035f},
-std::array<float,2>{0.653493166f, 0.682619691f},
-std::array<float,2>{0.407233089f, 0.815992832f},
-std::array<float,2>{0.998772979f, 0.208995193f},
-std::array<float,2>{0.114845335f, 0.115850128f},
-std::array<float,2>{0.746359289f, 0.93420136f},
-std::array<float,2>{0.446247309f, 0.603105426f},
-std::array<float,2>{0.922027647f, 0.28982082f},
-std::array<float,2>{0.28700611f, 0.499028951f},
-std::array<float,2>{0.821269751f, 0.732375205f},
-std::array<float,2>{0.239229381f, 0.756044686f},
-std::array<float,2>{0.581938744f, 0.143465281f},
-std::array<float,2>{0.382952183f, 0.240292221f},
-std::array<float,2>{0.960720003f, 0.86458993f},
-std::array<float,2>{0.00464691408f, 0.643361747f},
-std::array<float,2>{0.672783732f, 0.411441445f},
-std::array<float,2>{0.17831704f, 0.367706418f},
-std::array<float,2>{0.503956378f, 0.542099535f},
-std::array<float,2>{0.347479969f, 0.986896992f},
-std::array<float,2>{0.78951031f, 0.0516971909f},
-std::array<float,2>{0.24958165f, 0.066910401f},
-std::array<float,2>{0.587781191f, 0.888234675f},
-std::array<float,2>{0.293555081f, 0.58936131f},
-std::array<float,2>{0.815763175f, 0.268324673f},
-std::array<float,2>{0.442260444f, 0.451003015f},
-std::array<float,2>{0.935281992f, 0.698707819f},
-std::array<float,2>{0.119951025f, 0.786005557f},
-std::array<float,2>{0.738389254f, 0.164914027f},
-std::array<float,2>{0.356440663f, 0.217560917f},
-std::array<float,2>{0.782577217f, 0.824355662f},
-std::array<float,2>{0.180165514f, 0.678055704f},
-std::array<float,2>{0.511663139f, 0.403774053f},
-std::array<float,2>{0.0148882493f, 0.336622745f},
-std::array<float,2>{0.686579883f, 0.52131927f},
-std::array<float,2>{0.377462924f, 0.962617099f},
-std::array<float,2>{0.962581933f, 0.0117941257f},
-std::array<float,2>{0.0824403763f, 0.154773027f},
-std::array<float,2>{0.715635061f, 0.762404203f},
-std::array<float,2>{0.497142583f, 0.72444427f},
-std::array<float,2>{0.879961491f, 0.488481253f},
-std::array<float,2>{0.264388382f, 0.283081919f},
-std::array<float,2>{0.866868794f, 0.59772861f},
-std::array<float,2>{0.201300964f, 0.923452199f},
-std::array<float,2>{0.600169778f, 0.123974532f},
-std::array<float,2>{0.4169119f, 0.0593808778f},
-std::array<float,2>{0.986897469f, 0.994959116f},
-std::array<float,2>{0.0423916839f, 0.53725785f},
-std::array<float,2>{0.641568065f, 0.363002598f},
-std::array<float,2>{0.153257102f, 0.415459037f},
-std::array<float,2>{0.532384932f, 0.655057073f},
-std::array<float,2>{0.316795558f, 0.872137785f},
-std::array<float,2>{0.771522522f, 0.243303522f},
-std::array<float,2>{0.168028027f, 0.222367227f},
-std::array<float,2>{0.52897048f, 0.858877182f},
-std::array<float,2>{0.37156871f, 0.638499618f},
-std::array<float,2>{0.80923897f, 0.423476309f},
-std::array<float,2>{0.405825526f, 0.359200835f},
-std::array<float,2>{0.950584888f, 0.547805369f},
-std::array<float,2>{0.0185280219f, 0.983273089f},
-std::array<float,2>{0.660745621f, 0.0325419605f},
-std::array<float,2>{0.299456179f, 0.0991049483f},
-std::array<float,2>{0.829174697f, 0.906919301f},
-std::array<float,2>{0.220547155f, 0.616646707f},
-std::array<float,2>{0.575328231f, 0.310406536f},
-std::array<float,2>{0.106364392f, 0.483337611f},
-std::array<float,2>{0.723433733f, 0.737543523f},
-std::array<float,2>{0.460647821f, 0.770594478f},
-std::array<float,2>{0.911311686f, 0.130416647f},
-std::array<float,2>{0.0596332923f, 0.0224095359f},
-std::array<float,2>{0.635790944f, 0.939078033f},
-std::array<float,2>{0.427040607f, 0.509465218f},
-std::array<float,2>{0.969676971f, 0.317134351f},
-std::array<float,2>{0.342551708f, 0.38612777f},
-std::array<float,2>{0.764170289f, 0.663567245f},
-std::array<float,2>{0.139547184f, 0.829897344f},
-std::array<float,2>{0.551775694f, 0.196246192f},
-std::array<float,2>{0.481637627f, 0.178344205f},
-std::array<float,2>{0.902808189f, 0.811641097f},
-std::array<float,2>{0.0756174922f, 0.717322707f},
-std::array<float,2>{0.702779055f, 0.458624005f},
-std::array<float,2>{0.218563989f, 0.262087524f},
-std::array<float,2>{0.609705746f, 0.565354943f},
-std::array<float,2>{0.273976386f, 0.898239851f},
-std::array<float,2>{0.854889035f, 0.0794608742f},
-std::array<float,2>{0.184980586f, 0.104291081f},
-std::array<float,2>{0.512962699f, 0.91745621f},
-std::array<float,2>{0.355400205f, 0.622134924f},
-std::array<float,2>{0.788295925f, 0.301259011f},
-std::array<float,2>{0.382530689f, 0.472282112f},
-std::array<float,2>{0.965842187f, 0.743395865f},
-std::array<float,2>{0.0092379041f, 0.77454412f},
-std::array<float,2>{0.681466579f, 0.138744161f},
-std::array<float,2>{0.291297197f, 0.229665101f},
-std::array<float,2>{0.81665051f, 0.845870197f},
-std::array<float,2>{0.2443517f, 0.629274487f},
-std::array<float,2>{0.593546033f, 0.435329825f},
-std::array<float,2>{0.124689825f, 0.347364634f},
-std::array<float,2>{0.735980809f, 0.557772934f},
-std::array<float,2>{0.43998307f, 0.975564361f},
-std::array<float,2>{0.932169855f, 0.0397754163f},
-std::array<float,2>{0.04353543f, 0.183921352f},
-std::array<float,2>{0.646206677f, 0.80232656f},
-std::array<float,2>{0.421168089f, 0.703135073f},
-std::array<float,2>{0.988826036f, 0.465877354f},
-std::array<float,2>{0.315354615f, 0.254977375f},
-std::array<float,2>{0.768525541f, 0.57623148f},
-std::array<float,2>{0.149280146f, 0.902522147f},
-std::array<float,2>{0.535348475f, 0.0900775716f},
-std::array<float,2>{0.493423849f, 0.0298653208f},
-std::array<float,2>{0.877643585f, 0.95219475f},
-std::array<float,2>{0.081113793f, 0.500510931f},
-std::array<float,2>{0.713678718f, 0.322675288f},
-std::array<float,2>{0.199125946f, 0.380342036f},
-std::array<float,2>{0.595565438f, 0.664264023f},
-std::array<float,2>{0.260890514f, 0.840549588f},
-std::array<float,2>{0.863151014f, 0.194143221f},
-std::array<float,2>{0.225753799f, 0.203527123f},
-std::array<float,2>{0.573316514f, 0.819273174f},
-std::array<float,2>{0.303352743f, 0.68749094f},
-std::array<float,2>{0.833052099f, 0.394244224f},
-std::array<float,2>{0.453366429f, 0.334479451f},
-std::array<float,2>{0.909949303f, 0.523978293f},
-std::array<float,2>{0.102725387f, 0.958272874f},
-std::array<float,2>{0.721212447f, 0.00389627297f},
-std::array<float,2>{0.367886573f, 0.0758298412f},
-std::array<float,2>{0.80579704f, 0.880423546f},
-std::array<float,2>{0.166107312f, 0.580540538f},
-std::array<float,2>{0.525085688f, 0.277439028f},
-std::array<float,2>{0.0229794551f, 0.437863499f},
-std::array<float,2>{0.656334877f, 0.689750195f},
-std::array<float,2>{0.400099754f, 0.794578075f},
-std::array<float,2>{0.94826442f, 0.159645647f},
-std::array<float,2>{0.0735609904f, 0.0484290272f},
-std::array<float,2>{0.69673574f, 0.991923809f},
-std::array<float,2>{0.478803098f, 0.54339391f},
-std::array<float,2>{0.901322782f, 0.373001814f},
-std::array<float,2>{0.277566135f, 0.407057196f},
-std::array<float,2>{0.856725097f, 0.645775676f},
-std::array<float,2>{0.212106913f, 0.8611871f},
-std::array<float,2>{0.614835978f, 0.238254651f},
-std::array<float,2>{0.425480068f, 0.14723669f},
-std::array<float,2>{0.975962996f, 0.75110513f},
-std::array<float,2>{0.0562938191f, 0.728159666f},
-std::array<float,2>{0.640431523f, 0.492444485f},
-std::array<float,2>{0.13571997f, 0.296044677f},
-std::array<float,2>{0.547921896f, 0.607760072f},
-std::array<float,2>{0.337921798f, 0.93090713f},
-std::array<float,2>{0.759599566f, 0.109651484f},
-std::array<float,2>{0.210478842f, 0.0095613692f},
-std::array<float,2>{0.622618675f, 0.967474163f},
-std::array<float,2>{0.267519325f, 0.515663028f},
-std::array<float,2>{0.845912755f, 0.342752635f},
-std::array<float,2>{0.472600579f, 0.399623126f},
-std::array<float,2>{0.896950543f, 0.674446702f},
-std::array<float,2>{0.0692185834f, 0.821638882f},
-std::array<float,2>{0.688260853f, 0.2140349f},
-std::array<float,2>{0.331069291f, 0.17003499f},
-std::array<float,2>{0.756342173f, 0.782393694f},
-std::array<float,2>{0.128367186f, 0.699376106f},
-std::array<float,2>{0.558442593f, 0.446502805f},
-std::array<float,2>{0.0481486283f, 0.269551665f},
-std::array<float,2>{0.626207292f, 0.593424737f},
-std::array<float,2>{0.434468478f, 0.883948028f},
-std::array<float,2>{0.980697811f, 0.0660170317f},
-std::array<float,2>{0.098175019f, 0.246761441f},
-std::array<float,2>{0.727019668f, 0.870163262f},
-std::array<float,2>{0.463905841f, 0.64932698f},
-std::array<float,2>{0.920824289f, 0.421181321f},
-std::array<float,2>{0.308135897f, 0.365693927f},
-std::array<float,2>{0.84008497f, 0.533333778f},
-std::array<float,2>{0.233459517f, 0.998947322f},
-std::array<float,2>{0.570089221f, 0.0585736111f},
-std::array<float,2>{0.394343853f, 0.117368087f},
-std::array<float,2>{0.941657126f, 0.926648676f},
-std::array<float,2>{0.0256662443f, 0.595876098f},
-std::array<float,2>{0.667488992f, 0.288476855f},
-std::array<float,2>{0.160101503f, 0.486261576f},
-std::array<float,2>{0.517295539f, 0.720675409f},
-std::array<float,2>{0.360477149f, 0.759155393f},
-std::array<float,2>{0.797587991f, 0.148463398f},
-std::array<float,2>{0.146006033f, 0.127223656f},
-std::array<float,2>{0.540855289f, 0.768868208f},
-std::array<float,2>{0.326713175f, 0.741855502f},
-std::array<float,2>{0.778719902f, 0.479204714f},
-std::array<float,2>{0.411131173f, 0.308062524f},
-std::array<float,2>{0.994249642f, 0.610888302f},
-std::array<float,2>{0.0372010209f, 0.910515308f},
-std::array<float,2>{0.650875151f, 0.0973515436f},
-std::array<float,2>{0.254258662f, 0.0374820456f},
-std::array<float,2>{0.870628834f, 0.980309725f},
-std::array<float,2>{0.189485893f, 0.551445186f},
-std::array<float,2>{0.607974231f, 0.355372995f},
-std::array<float,2>{0.0875978619f, 0.429290801f},
-std::array<float,2>{0.706038296f, 0.633076668f},
-std::array<float,2>{0.4917638f, 0.852797747f},
-std::array<float,2>{0.889369369f, 0.225319907f},
-std::array<float,2>{0.00280004949f, 0.0839717388f},
-std::array<float,2>{0.676442802f, 0.891315937f},
-std::array<float,2>{0.388218433f, 0.570127964f},
-std::array<float,2>{0.954891801f, 0.261418283f},
-std::array<float,2>{0.35114789f, 0.456160069f},
-std::array<float,2>{0.796153426f, 0.712684333f},
-std::array<float,2>{0.172296301f, 0.804699063f},
-std::array<float,2>{0.501308739f, 0.174897537f},
-std::array<float,2>{0.45151341f, 0.199869961f},
-std::array<float,2>{0.927970707f, 0.833294153f},
-std::array<float,2>{0.110445231f, 0.656443775f},
-std::array<float,2>{0.743937671f, 0.388527691f},
-std::array<float,2>{0.236026078f, 0.3141945f},
-std::array<float,2>{0.584807575f, 0.515115678f},
-std::array<float,2>{0.284905374f, 0.943506122f},
-std::array<float,2>{0.827455163f, 0.0181668922f},
-std::array<float,2>{0.139151648f, 0.0198626295f},
-std::array<float,2>{0.552249372f, 0.939516664f},
-std::array<float,2>{0.342238009f, 0.510878801f},
-std::array<float,2>{0.764039159f, 0.320184469f},
-std::array<float,2>{0.427366912f, 0.384318799f},
-std::array<float,2>{0.968806684f, 0.660941005f},
-std::array<float,2>{0.0604828522f, 0.83180958f},
-std::array<float,2>{0.636445343f, 0.198161438f},
-std::array<float,2>{0.273765892f, 0.175951421f},
-std::array<float,2>{0.855407834f, 0.808725536f},
-std::array<float,2>{0.218127966f, 0.715742528f},
-std::array<float,2>{0.610037446f, 0.459779829f},
-std::array<float,2>{0.0759169161f, 0.263750225f},
-std::array<float,2>{0.702606499f, 0.563719988f},
-std::array<float,2>{0.482102722f, 0.896479785f},
-std::array<float,2>{0.902949333f, 0.0807205066f},
-std::array<float,2>{0.0179428216f, 0.21985966f},
-std::array<float,2>{0.660353184f, 0.855814159f},
-std::array<float,2>{0.405309349f, 0.639838457f},
-std::array<float,2>{0.95082587f, 0.425411552f},
-std::array<float,2>{0.371858001f, 0.356492311f},
-std::array<float,2>{0.80871588f, 0.548912704f},
-std::array<float,2>{0.168642879f, 0.981054008f},
-std::array<float,2>{0.528775096f, 0.0348707549f},
-std::array<float,2>{0.460168093f, 0.0998205543f},
-std::array<float,2>{0.911738813f, 0.908932149f},
-std::array<float,2>{0.105723105f, 0.613753378f},
-std::array<float,2>{0.722803414f, 0.310580999f},
-std::array<float,2>{0.220152825f, 0.480825514f},
-std::array<float,2>{0.575988173f, 0.735471606f},
-std::array<float,2>{0.298962027f, 0.773245335f},
-std::array<float,2>{0.829796255f, 0.13129358f},
-std::array<float,2>{0.202090934f, 0.154219702f},
-std::array<float,2>{0.600033045f, 0.764093935f},
-std::array<float,2>{0.263856411f, 0.72522974f},
-std::array<float,2>{0.866391301f, 0.49126628f},
-std::array<float,2>{0.497907728f, 0.285056353f},
-std::array<float,2>{0.880576491f, 0.600394309f},
-std::array<float,2>{0.0827016532f, 0.924808621f},
-std::array<float,2>{0.715198398f, 0.121498048f},
-std::array<float,2>{0.317025721f, 0.0615408532f},
-std::array<float,2>{0.772081852f, 0.993022501f},
-std::array<float,2>{0.152566567f, 0.536299407f},
-std::array<float,2>{0.532786012f, 0.359491229f},
-std::array<float,2>{0.0428964905f, 0.416447341f},
-std::array<float,2>{0.640776694f, 0.65371573f},
-std::array<float,2>{0.416444391f, 0.874857366f},
-std::array<float,2>{0.986684382f, 0.245572463f},
-std::array<float,2>{0.119342856f, 0.0684456229f},
-std::array<float,2>{0.7392084f, 0.889071584f},
-std::array<float,2>{0.441473246f, 0.586437702f},
-std::array<float,2>{0.934870481f, 0.265715182f},
-std::array<float,2>{0.293216676f, 0.452937782f},
-std::array<float,2>{0.816301763f, 0.696272075f},
-std::array<float,2>{0.249129012f, 0.787300706f},
-std::array<float,2>{0.586914182f, 0.167318821f},
-std::array<float,2>{0.377334982f, 0.21503973f},
-std::array<float,2>{0.961969674f, 0.82653749f},
-std::array<float,2>{0.0153806787f, 0.6774773f},
-std::array<float,2>{0.687498808f, 0.404802769f},
-std::array<float,2>{0.180409372f, 0.338043094f},
-std::array<float,2>{0.510854661f, 0.522829592f},
-std::array<float,2>{0.355597019f, 0.96442908f},
-std::array<float,2>{0.783128977f, 0.0153822023f},
-std::array<float,2>{0.238714606f, 0.113664627f},
-std::array<float,2>{0.581137478f, 0.936906576f},
-std::array<float,2>{0.286508203f, 0.604752362f},
-std::array<float,2>{0.820506871f, 0.291945249f},
-std::array<float,2>{0.445566893f, 0.497582555f},
-std::array<float,2>{0.92274189f, 0.732905924f},
-std::array<float,2>{0.114710823f, 0.754616618f},
-std::array<float,2>{0.746970952f, 0.141215324f},
-std::array<float,2>{0.346825987f, 0.2399382f},
-std::array<float,2>{0.789745629f, 0.866361499f},
-std::array<float,2>{0.177961513f, 0.64076066f},
-std::array<float,2>{0.504638493f, 0.413048655f},
-std::array<float,2>{0.00435520709f, 0.370152086f},
-std::array<float,2>{0.67218703f, 0.539327383f},
-std::array<float,2>{0.383454621f, 0.985684276f},
-std::array<float,2>{0.960375011f, 0.0545256436f},
-std::array<float,2>{0.0922308639f, 0.161110505f},
-std::array<float,2>{0.708769441f, 0.78915751f},
-std::array<float,2>{0.486076683f, 0.693969488f},
-std::array<float,2>{0.88521421f, 0.441635936f},
-std::array<float,2>{0.253806204f, 0.276556343f},
-std::array<float,2>{0.87291491f, 0.582213044f},
-std::array<float,2>{0.192328408f, 0.877371311f},
-std::array<float,2>{0.6025365f, 0.0712157562f},
-std::array<float,2>{0.407833993f, 0.00775843346f},
-std::array<float,2>{0.998294711f, 0.954060733f},
-std::array<float,2>{0.0317035057f, 0.529602408f},
-std::array<float,2>{0.654250801f, 0.33086738f},
-std::array<float,2>{0.143125474f, 0.395185828f},
-std::array<float,2>{0.545237839f, 0.681635261f},
-std::array<float,2>{0.323996246f, 0.813270807f},
-std::array<float,2>{0.773738742f, 0.207710624f},
-std::array<float,2>{0.160503745f, 0.190253004f},
-std::array<float,2>{0.522623837f, 0.839806378f},
-std::array<float,2>{0.36500752f, 0.671084821f},
-std::array<float,2>{0.801684082f, 0.376798034f},
-std::array<float,2>{0.397963405f, 0.324889183f},
-std::array<float,2>{0.940408885f, 0.504240513f},
-std::array<float,2>{0.0274294019f, 0.947149992f},
-std::array<float,2>{0.670533121f, 0.024051439f},
-std::array<float,2>{0.311461508f, 0.0890462697f},
-std::array<float,2>{0.836224973f, 0.899794161f},
-std::array<float,2>{0.22662513f, 0.572253525f},
-std::array<float,2>{0.565080225f, 0.252423137f},
-std::array<float,2>{0.0955745652f, 0.46171692f},
-std::array<float,2>{0.732050657f, 0.710071445f},
-std::array<float,2>{0.465621352f, 0.797288358f},
-std::array<float,2>{0.917623341f, 0.181876287f},
-std::array<float,2>{0.0515050963f, 0.0439490862f},
-std::array<float,2>{0.629631639f, 0.969485164f},
-std::array<float,2>{0.433458507f, 0.56002599f},
-std::array<float,2>{0.977841437f, 0.348560512f},
-std::array<float,2>{0.335543513f, 0.432893813f},
-std::array<float,2>{0.753444493f, 0.626640856f},
-std::array<float,2>{0.129327849f, 0.847883701f},
-std::array<float,2>{0.559100807f, 0.233776391f},
-std::array<float,2>{0.474817097f, 0.134113446f},
-std::array<float,2>{0.89073813f, 0.778482735f},
-std::array<float,2>{0.0654871464f, 0.748041034f},
-std::array<float,2>{0.692543983f, 0.4729532f},
-std::array<float,2>{0.203560725f, 0.297752589f},
-std::array<float,2>{0.618983805f, 0.620756447f},
-std::array<float,2>{0.273174316f, 0.918337345f},
-std::array<float,2>{0.851041675f, 0.106217824f},
-std::array<float,2>{0.172569692f, 0.0843556002f},
-std::array<float,2>{0.501925111f, 0.893712699f},
-std::array<float,2>{0.350638121f, 0.5673455f},
-std::array<float,2>{0.796852291f, 0.259703666f},
-std::array<float,2>{0.387724966f, 0.454841048f},
-std::array<float,2>{0.954137802f, 0.714531362f},
-std::array<float,2>{0.00241938606f, 0.806706488f},
-std::array<float,2>{0.676073313f, 0.172506154f},
-std::array<float,2>{0.284405679f, 0.202872261f},
-std::array<float,2>{0.827653706f, 0.834955573f},
-std::array<float,2>{0.235379681f, 0.658996463f},
-std::array<float,2>{0.584045351f, 0.389027208f},
-std::array<float,2>{0.110880531f, 0.315661609f},
-std::array<float,2>{0.743623555f, 0.512876272f},
-std::array<float,2>{0.452034712f, 0.941409051f},
-std::array<float,2>{0.928234398f, 0.0158743486f},
-std::array<float,2>{0.0379898883f, 0.125481859f},
-std::array<float,2>{0.651268303f, 0.766148508f},
-std::array<float,2>{0.410353929f, 0.739625871f},
-std::array<float,2>{0.994999349f, 0.476613164f},
-std::array<float,2>{0.326189309f, 0.30640915f},
-std::array<float,2>{0.779064953f, 0.611864209f},
-std::array<float,2>{0.145654589f, 0.913734615f},
-std::array<float,2>{0.540427148f, 0.0944223776f},
-std::array<float,2>{0.491350353f, 0.0366087556f},
-std::array<float,2>{0.889106095f, 0.978210092f},
-std::array<float,2>{0.0870229155f, 0.552802026f},
-std::array<float,2>{0.705404878f, 0.352053404f},
-std::array<float,2>{0.190251723f, 0.426810503f},
-std::array<float,2>{0.607737899f, 0.635340273f},
-std::array<float,2>{0.254718482f, 0.854153752f},
-std::array<float,2>{0.870159984f, 0.223699912f},
-std::array<float,2>{0.234212086f, 0.249183625f},
-std::array<float,2>{0.569529414f, 0.867630661f},
-std::array<float,2>{0.307769775f, 0.650972486f},
-std::array<float,2>{0.84038645f, 0.419102222f},
-std::array<float,2>{0.464707315f, 0.364224762f},
-std::array<float,2>{0.919995189f, 0.531303346f},
-std::array<float,2>{0.0978941023f, 0.996415377f},
-std::array<float,2>{0.727081299f, 0.0564033426f},
-std::array<float,2>{0.361250162f, 0.120156646f},
-std::array<float,2>{0.7972399f, 0.927817345f},
-std::array<float,2>{0.159222364f, 0.595507979f},
-std::array<float,2>{0.517022133f, 0.286912411f},
-std::array<float,2>{0.0260942988f, 0.486492068f},
-std::array<float,2>{0.667224348f, 0.721651316f},
-std::array<float,2>{0.393975407f, 0.760728896f},
-std::array<float,2>{0.94209969f, 0.151915297f},
-std::array<float,2>{0.0685172454f, 0.0114996303f},
-std::array<float,2>{0.687834501f, 0.964996636f},
-std::array<float,2>{0.472150058f, 0.518710077f},
-std::array<float,2>{0.897126675f, 0.341225803f},
-std::array<float,2>{0.266694695f, 0.400624037f},
-std::array<float,2>{0.846228957f, 0.673264027f},
-std::array<float,2>{0.210073054f, 0.822312534f},
-std::array<float,2>{0.622172594f, 0.212357536f},
-std::array<float,2>{0.433594972f, 0.168630183f},
-std::array<float,2>{0.981313825f, 0.783628106f},
-std::array<float,2>{0.0484417975f, 0.702812493f},
-std::array<float,2>{0.626582682f, 0.449205518f},
-std::array<float,2>{0.128881603f, 0.272644162f},
-std::array<float,2>{0.557629049f, 0.590200245f},
-std::array<float,2>{0.331768066f, 0.88575387f},
-std::array<float,2>{0.756799936f, 0.0626663864f},
-std::array<float,2>{0.212772727f, 0.0491989516f},
-std::array<float,2>{0.614712119f, 0.989316285f},
-std::array<float,2>{0.278044909f, 0.546578228f},
-std::array<float,2>{0.857091606f, 0.374802947f},
-std::array<float,2>{0.479350477f, 0.409549743f},
-std::array<float,2>{0.90073365f, 0.647455752f},
-std::array<float,2>{0.0742180869f, 0.861473441f},
-std::array<float,2>{0.697214782f, 0.235473871f},
-std::array<float,2>{0.338458031f, 0.146215826f},
-std::array<float,2>{0.758905768f, 0.753479779f},
-std::array<float,2>{0.134786412f, 0.730436206f},
-std::array<float,2>{0.548344433f, 0.495702147f},
-std::array<float,2>{0.0558592454f, 0.293848425f},
-std::array<float,2>{0.640120208f, 0.60602206f},
-std::array<float,2>{0.424831778f, 0.933000922f},
-std::array<float,2>{0.976357758f, 0.112908557f},
-std::array<float,2>{0.103509918f, 0.205407172f},
-std::array<float,2>{0.720767319f, 0.818085551f},
-std::array<float,2>{0.453877538f, 0.684228778f},
-std::array<float,2>{0.909369946f, 0.390983135f},
-std::array<float,2>{0.303114206f, 0.332223892f},
-std::array<float,2>{0.833643436f, 0.526222289f},
-std::array<float,2>{0.226364359f, 0.95902431f},
-std::array<float,2>{0.57385987f, 0.00183677697f},
-std::array<float,2>{0.399817526f, 0.077805452f},
-std::array<float,2>{0.949119151f, 0.882146358f},
-std::array<float,2>{0.0226096231f, 0.579923868f},
-std::array<float,2>{0.657222748f, 0.281091571f},
-std::array<float,2>{0.16652371f, 0.441338629f},
-std::array<float,2>{0.524676859f, 0.688139141f},
-std::array<float,2>{0.367437452f, 0.795308292f},
-std::array<float,2>{0.806600928f, 0.156273812f},
-std::array<float,2>{0.148568511f, 0.186216861f},
-std::array<float,2>{0.535664082f, 0.803373873f},
-std::array<float,2>{0.314646393f, 0.70526731f},
-std::array<float,2>{0.767625153f, 0.468459427f},
-std::array<float,2>{0.421406358f, 0.256856054f},
-std::array<float,2>{0.988495529f, 0.5749107f},
-std::array<float,2>{0.0432314835f, 0.904898942f},
-std::array<float,2>{0.645930767f, 0.0930414796f},
-std::array<float,2>{0.2613056f, 0.0283360239f},
-std::array<float,2>{0.862416208f, 0.949670911f},
-std::array<float,2>{0.198364422f, 0.502883136f},
-std::array<float,2>{0.594819486f, 0.321564436f},
-std::array<float,2>{0.0818407014f, 0.381902844f},
-std::array<float,2>{0.71320188f, 0.666032553f},
-std::array<float,2>{0.494097382f, 0.842690051f},
-std::array<float,2>{0.877232194f, 0.19323425f},
-std::array<float,2>{0.00957426801f, 0.102297254f},
-std::array<float,2>{0.680897415f, 0.915208757f},
-std::array<float,2>{0.38186577f, 0.624559999f},
-std::array<float,2>{0.966326833f, 0.304196388f},
-std::array<float,2>{0.354682148f, 0.470059484f},
-std::array<float,2>{0.788859725f, 0.745946288f},
-std::array<float,2>{0.185221404f, 0.776842058f},
-std::array<float,2>{0.513216972f, 0.138605997f},
-std::array<float,2>{0.439812064f, 0.227907971f},
-std::array<float,2>{0.931995213f, 0.843951523f},
-std::array<float,2>{0.124460928f, 0.632169724f},
-std::array<float,2>{0.73554796f, 0.436687112f},
-std::array<float,2>{0.244632587f, 0.34527728f},
-std::array<float,2>{0.592778146f, 0.556467056f},
-std::array<float,2>{0.291842878f, 0.974463642f},
-std::array<float,2>{0.81711328f, 0.0411056355f},
-std::array<float,2>{0.170813918f, 0.033143416f},
-std::array<float,2>{0.529956877f, 0.982490718f},
-std::array<float,2>{0.374499261f, 0.546948373f},
-std::array<float,2>{0.810723186f, 0.358605325f},
-std::array<float,2>{0.404167742f, 0.423140943f},
-std::array<float,2>{0.952787697f, 0.638126791f},
-std::array<float,2>{0.0167729463f, 0.859151363f},
-std::array<float,2>{0.66404748f, 0.222086191f},
-std::array<float,2>{0.297528177f, 0.130259827f},
-std::array<float,2>{0.831351042f, 0.77137357f},
-std::array<float,2>{0.222404882f, 0.738107085f},
-std::array<float,2>{0.577508926f, 0.48249799f},
-std::array<float,2>{0.107735127f, 0.30963546f},
-std::array<float,2>{0.724868298f, 0.617096126f},
-std::array<float,2>{0.458973706f, 0.906544209f},
-std::array<float,2>{0.913891613f, 0.0995436832f},
-std::array<float,2>{0.0609486289f, 0.195455521f},
-std::array<float,2>{0.633305311f, 0.829463601f},
-std::array<float,2>{0.429212958f, 0.663921416f},
-std::array<float,2>{0.970885098f, 0.386446148f},
-std::array<float,2>{0.340216428f, 0.316705465f},
-std::array<float,2>{0.763098717f, 0.509111345f},
-std::array<float,2>{0.138477251f, 0.938762128f},
-std::array<float,2>{0.554364979f, 0.0217968393f},
-std::array<float,2>{0.484277993f, 0.0796856433f},
-std::array<float,2>{0.904409826f, 0.897545815f},
-std::array<float,2>{0.07801155f, 0.564580262f},
-std::array<float,2>{0.699990511f, 0.262642354f},
-std::array<float,2>{0.215201631f, 0.458429635f},
-std::array<float,2>{0.6123209f, 0.717078626f},
-std::array<float,2>{0.277068943f, 0.812314928f},
-std::array<float,2>{0.853416383f, 0.177802071f},
-std::array<float,2>{0.246781006f, 0.164104059f},
-std::array<float,2>{0.589353979f, 0.785493851f},
-std::array<float,2>{0.295404643f, 0.698749065f},
-std::array<float,2>{0.812754154f, 0.450284332f},
-std::array<float,2>{0.444967747f, 0.267867297f},
-std::array<float,2>{0.937388837f, 0.589227915f},
-std::array<float,2>{0.118551865f, 0.887950778f},
-std::array<float,2>{0.740461469f, 0.0666603372f},
-std::array<float,2>{0.359373748f, 0.0124529134f},
-std::array<float,2>{0.784551144f, 0.961963177f},
-std::array<float,2>{0.183539286f, 0.520832121f},
-std::array<float,2>{0.508216977f, 0.336019307f},
-std::array<float,2>{0.0128855044f, 0.403971314f},
-std::array<float,2>{0.683934689f, 0.678666413f},
-std::array<float,2>{0.376366079f, 0.824780703f},
-std::array<float,2>{0.96346724f, 0.21696946f},
-std::array<float,2>{0.0851707906f, 0.123190358f},
-std::array<float,2>{0.718689442f, 0.922987819f},
-std::array<float,2>{0.499519706f, 0.598209679f},
-std::array<float,2>{0.881033361f, 0.282513738f},
-std::array<float,2>{0.261773646f, 0.489237338f},
-std::array<float,2>{0.863868773f, 0.724116206f},
-std::array<float,2>{0.200710982f, 0.761726975f},
-std::array<float,2>{0.598981798f, 0.155095518f},
-std::array<float,2>{0.414879799f, 0.244137943f},
-std::array<float,2>{0.984803021f, 0.872941256f},
-std::array<float,2>{0.0398225002f, 0.654708445f},
-std::array<float,2>{0.644320965f, 0.415707618f},
-std::array<float,2>{0.154374495f, 0.36235553f},
-std::array<float,2>{0.534114063f, 0.537914753f},
-std::array<float,2>{0.320308626f, 0.994325817f},
-std::array<float,2>{0.771147251f, 0.0587005168f},
-std::array<float,2>{0.193452314f, 0.0733622536f},
-std::array<float,2>{0.604051054f, 0.87592417f},
-std::array<float,2>{0.251466423f, 0.584023535f},
-std::array<float,2>{0.87498498f, 0.275340497f},
-std::array<float,2>{0.487911999f, 0.443971425f},
-std::array<float,2>{0.882944107f, 0.691411614f},
-std::array<float,2>{0.089996852f, 0.791047812f},
-std::array<float,2>{0.710167706f, 0.163406849f},
-std::array<float,2>{0.32197392f, 0.209854767f},
-std::array<float,2>{0.775596559f, 0.815839529f},
-std::array<float,2>{0.141839281f, 0.683420658f},
-std::array<float,2>{0.543381453f, 0.398434073f},
-std::array<float,2>{0.0349643677f, 0.328516781f},
-std::array<float,2>{0.655578911f, 0.528603733f},
-std::array<float,2>{0.409081727f, 0.956479967f},
-std::array<float,2>{0.996788025f, 0.00545167597f},
-std::array<float,2>{0.116805345f, 0.143008322f},
-std::array<float,2>{0.748684406f, 0.756610572f},
-std::array<float,2>{0.448480606f, 0.731767774f},
-std::array<float,2>{0.925617993f, 0.499769986f},
-std::array<float,2>{0.288291782f, 0.289316028f},
-std::array<float,2>{0.822759449f, 0.602968872f},
-std::array<float,2>{0.241910905f, 0.933678567f},
-std::array<float,2>{0.57922864f, 0.115235426f},
-std::array<float,2>{0.385773718f, 0.0508159809f},
-std::array<float,2>{0.958394587f, 0.986707211f},
-std::array<float,2>{0.00666865008f, 0.542806029f},
-std::array<float,2>{0.674996078f, 0.367616236f},
-std::array<float,2>{0.177004591f, 0.411878645f},
-std::array<float,2>{0.507527411f, 0.642651796f},
-std::array<float,2>{0.345468372f, 0.865207314f},
-std::array<float,2>{0.791716397f, 0.240900993f},
-std::array<float,2>{0.131292924f, 0.231897175f},
-std::array<float,2>{0.561340213f, 0.850823998f},
-std::array<float,2>{0.332222044f, 0.628196716f},
-std::array<float,2>{0.750467658f, 0.430162609f},
-std::array<float,2>{0.431011736f, 0.351244152f},
-std::array<float,2>{0.980337679f, 0.561939597f},
-std::array<float,2>{0.0541408807f, 0.972544253f},
-std::array<float,2>{0.632320523f, 0.0450349711f},
-std::array<float,2>{0.270994186f, 0.109033778f},
-std::array<float,2>{0.849212646f, 0.921031237f},
-std::array<float,2>{0.205129102f, 0.618123114f},
-std::array<float,2>{0.619243503f, 0.299078643f},
-std::array<float,2>{0.0638295263f, 0.475368828f},
-std::array<float,2>{0.693456531f, 0.749525011f},
-std::array<float,2>{0.472990751f, 0.78044343f},
-std::array<float,2>{0.892772675f, 0.134963706f},
-std::array<float,2>{0.0302546378f, 0.0267966129f},
-std::array<float,2>{0.669330776f, 0.949154794f},
-std::array<float,2>{0.395110011f, 0.506684124f},
-std::array<float,2>{0.939285994f, 0.326587468f},
-std::array<float,2>{0.366717726f, 0.378238559f},
-std::array<float,2>{0.802841842f, 0.668736279f},
-std::array<float,2>{0.163399696f, 0.837537766f},
-std::array<float,2>{0.520913661f, 0.188028976f},
-std::array<float,2>{0.467663974f, 0.180270731f},
-std::array<float,2>{0.914411724f, 0.799665809f},
-std::array<float,2>{0.0973517522f, 0.708157778f},
-std::array<float,2>{0.733891129f, 0.463129133f},
-std::array<float,2>{0.230327904f, 0.250897974f},
-std::array<float,2>{0.564026833f, 0.572523415f},
-std::array<float,2>{0.309839219f, 0.901930869f},
-std::array<float,2>{0.839038253f, 0.0871931538f},
-std::array<float,2>{0.148372039f, 0.0967860296f},
-std::array<float,2>{0.541633308f, 0.910827935f},
-std::array<float,2>{0.325188547f, 0.610533118f},
-std::array<float,2>{0.781185091f, 0.308333576f},
-std::array<float,2>{0.413980544f, 0.478990048f},
-std::array<float,2>{0.992729902f, 0.741285682f},
-std::array<float,2>{0.036254216f, 0.769435942f},
-std::array<float,2>{0.649146914f, 0.12778154f},
-std::array<float,2>{0.257098049f, 0.224962801f},
-std::array<float,2>{0.867370188f, 0.853162825f},
-std::array<float,2>{0.187863335f, 0.633773565f},
-std::array<float,2>{0.605745852f, 0.429198384f},
-std::array<float,2>{0.0885442421f, 0.354734421f},
-std::array<float,2>{0.703130841f, 0.55093801f},
-std::array<float,2>{0.488783449f, 0.979705393f},
-std::array<float,2>{0.887567401f, 0.0376515202f},
-std::array<float,2>{0.000526890857f, 0.175503179f},
-std::array<float,2>{0.679020643f, 0.805627048f},
-std::array<float,2>{0.38976863f, 0.712076485f},
-std::array<float,2>{0.956275284f, 0.45697394f},
-std::array<float,2>{0.34959203f, 0.261155665f},
-std::array<float,2>{0.793408513f, 0.569607019f},
-std::array<float,2>{0.17425324f, 0.890995979f},
-std::array<float,2>{0.503652692f, 0.0834097266f},
-std::array<float,2>{0.449308723f, 0.0179741811f},
-std::array<float,2>{0.927056611f, 0.944022f},
-std::array<float,2>{0.112887979f, 0.515342236f},
-std::array<float,2>{0.745508909f, 0.313636541f},
-std::array<float,2>{0.237824574f, 0.387917697f},
-std::array<float,2>{0.582064152f, 0.656752288f},
-std::array<float,2>{0.283061832f, 0.833505332f},
-std::array<float,2>{0.825419009f, 0.199267626f},
-std::array<float,2>{0.207941756f, 0.214601725f},
-std::array<float,2>{0.624504745f, 0.822216868f},
-std::array<float,2>{0.269492f, 0.673908234f},
-std::array<float,2>{0.845676064f, 0.400293857f},
-std::array<float,2>{0.46990335f, 0.341996074f},
-std::array<float,2>{0.896350801f, 0.516539156f},
-std::array<float,2>{0.067781575f, 0.966953576f},
-std::array<float,2>{0.690912366f, 0.00884649716f},
-std::array<float,2>{0.329869866f, 0.0658336431f},
-std::array<float,2>{0.754030824f, 0.884698689f},
-std::array<float,2>{0.126230195f, 0.593098283f},
-std::array<float,2>{0.556188524f, 0.270308316f},
-std::array<float,2>{0.0488385484f, 0.446982235f},
-std::array<float,2>{0.628393948f, 0.700152218f},
-std::array<float,2>{0.435610741f, 0.782790124f},
-std::array<float,2>{0.982747674f, 0.170871213f},
-std::array<float,2>{0.100313053f, 0.057858903f},
-std::array<float,2>{0.729537845f, 0.998297334f},
-std::array<float,2>{0.461949319f, 0.533902645f},
-std::array<float,2>{0.918073237f, 0.3658804f},
-std::array<float,2>{0.306013614f, 0.421675861f},
-std::array<float,2>{0.84344548f, 0.648502946f},
-std::array<float,2>{0.231751695f, 0.871006787f},
-std::array<float,2>{0.567370653f, 0.246391296f},
-std::array<float,2>{0.392165124f, 0.149256036f},
-std::array<float,2>{0.94341594f, 0.759668469f},
-std::array<float,2>{0.0250445306f, 0.720088303f},
-std::array<float,2>{0.665835679f, 0.485443681f},
-std::array<float,2>{0.15647164f, 0.288894832f},
-std::array<float,2>{0.51934588f, 0.596388221f},
-std::array<float,2>{0.362675458f, 0.925882339f},
-std::array<float,2>{0.799734712f, 0.117730662f},
-std::array<float,2>{0.222754583f, 0.00308176386f},
-std::array<float,2>{0.571667075f, 0.958610952f},
-std::array<float,2>{0.302100301f, 0.523574352f},
-std::array<float,2>{0.834511638f, 0.334333301f},
-std::array<float,2>{0.456154197f, 0.393903822f},
-std::array<float,2>{0.907354832f, 0.686980963f},
-std::array<float,2>{0.10421098f, 0.818625808f},
-std::array<float,2>{0.719542265f, 0.203795791f},
-std::array<float,2>{0.370056331f, 0.160153985f},
-std::array<float,2>{0.808104515f, 0.794149399f},
-std::array<float,2>{0.165757298f, 0.690159202f},
-std::array<float,2>{0.526591599f, 0.438133091f},
-std::array<float,2>{0.020771265f, 0.278004497f},
-std::array<float,2>{0.65891999f, 0.580883503f},
-std::array<float,2>{0.402172387f, 0.880162776f},
-std::array<float,2>{0.945525527f, 0.075395979f},
-std::array<float,2>{0.0722177252f, 0.237658575f},
-std::array<float,2>{0.698135316f, 0.860781848f},
-std::array<float,2>{0.477991998f, 0.646322548f},
-std::array<float,2>{0.899779797f, 0.4064143f},
-std::array<float,2>{0.279882401f, 0.372373641f},
-std::array<float,2>{0.85801053f, 0.543626308f},
-std::array<float,2>{0.213333338f, 0.991468608f},
-std::array<float,2>{0.616059124f, 0.0478782579f},
-std::array<float,2>{0.422417432f, 0.110086419f},
-std::array<float,2>{0.974238575f, 0.931566596f},
-std::array<float,2>{0.0574292727f, 0.608301818f},
-std::array<float,2>{0.637650967f, 0.296628535f},
-std::array<float,2>{0.133604929f, 0.492991179f},
-std::array<float,2>{0.549763381f, 0.7279917f},
-std::array<float,2>{0.337376654f, 0.751522422f},
-std::array<float,2>{0.760985017f, 0.146616101f},
-std::array<float,2>{0.186928988f, 0.139296994f},
-std::array<float,2>{0.513982117f, 0.775159538f},
-std::array<float,2>{0.351994723f, 0.744113266f},
-std::array<float,2>{0.785679817f, 0.472106814f},
-std::array<float,2>{0.379619479f, 0.30145669f},
-std::array<float,2>{0.966855824f, 0.622934461f},
-std::array<float,2>{0.0112445736f, 0.917607844f},
-std::array<float,2>{0.682885468f, 0.103947386f},
-std::array<float,2>{0.289714813f, 0.0392664336f},
-std::array<float,2>{0.818893552f, 0.97482866f},
-std::array<float,2>{0.242714852f, 0.558407485f},
-std::array<float,2>{0.591027915f, 0.346914977f},
-std::array<float,2>{0.122294776f, 0.434818715f},
-std::array<float,2>{0.7377038f, 0.62977469f},
-std::array<float,2>{0.439425826f, 0.846270442f},
-std::array<float,2>{0.929692507f, 0.230025217f},
-std::array<float,2>{0.0451535285f, 0.0908161104f},
-std::array<float,2>{0.648044288f, 0.902985215f},
-std::array<float,2>{0.418535531f, 0.576921642f},
-std::array<float,2>{0.991522074f, 0.255422175f},
-std::array<float,2>{0.313447028f, 0.466313243f},
-std::array<float,2>{0.766867697f, 0.703661919f},
-std::array<float,2>{0.150810912f, 0.802029073f},
-std::array<float,2>{0.53791827f, 0.184110299f},
-std::array<float,2>{0.494609743f, 0.19358027f},
-std::array<float,2>{0.875407219f, 0.839908361f},
-std::array<float,2>{0.0797483698f, 0.664589822f},
-std::array<float,2>{0.711418211f, 0.380673558f},
-std::array<float,2>{0.196432799f, 0.322895944f},
-std::array<float,2>{0.596365273f, 0.500009358f},
-std::array<float,2>{0.258467585f, 0.952837825f},
-std::array<float,2>{0.86004281f, 0.0296407212f},
-std::array<float,2>{0.182294115f, 0.0141470497f},
-std::array<float,2>{0.509426415f, 0.963316023f},
-std::array<float,2>{0.357425153f, 0.52194941f},
-std::array<float,2>{0.783820033f, 0.339431942f},
-std::array<float,2>{0.375214845f, 0.405560464f},
-std::array<float,2>{0.964751065f, 0.676341116f},
-std::array<float,2>{0.0118200947f, 0.82750231f},
-std::array<float,2>{0.684921563f, 0.216270268f},
-std::array<float,2>{0.296147168f, 0.166286871f},
-std::array<float,2>{0.813900888f, 0.788921058f},
-std::array<float,2>{0.24747926f, 0.696945965f},
-std::array<float,2>{0.588660181f, 0.451652467f},
-std::array<float,2>{0.118020311f, 0.266997516f},
-std::array<float,2>{0.741438806f, 0.587421417f},
-std::array<float,2>{0.443627954f, 0.889755249f},
-std::array<float,2>{0.935890555f, 0.0699806511f},
-std::array<float,2>{0.0406823605f, 0.245020956f},
-std::array<float,2>{0.643057525f, 0.873952329f},
-std::array<float,2>{0.415202707f, 0.652797461f},
-std::array<float,2>{0.985941648f, 0.417674899f},
-std::array<float,2>{0.318886131f, 0.361323416f},
-std::array<float,2>{0.770222127f, 0.535246432f},
-std::array<float,2>{0.156148389f, 0.993330181f},
-std::array<float,2>{0.534519851f, 0.0607481375f},
-std::array<float,2>{0.498522907f, 0.122696854f},
-std::array<float,2>{0.882294297f, 0.924718022f},
-std::array<float,2>{0.0848521814f, 0.600734472f},
-std::array<float,2>{0.716980278f, 0.283990085f},
-std::array<float,2>{0.200018629f, 0.491153955f},
-std::array<float,2>{0.598246217f, 0.725613177f},
-std::array<float,2>{0.263085246f, 0.76494354f},
-std::array<float,2>{0.864703834f, 0.152779117f},
-std::array<float,2>{0.221374571f, 0.132032081f},
-std::array<float,2>{0.57626003f, 0.77196157f},
-std::array<float,2>{0.298574895f, 0.734856009f},
-std::array<float,2>{0.830925465f, 0.48239246f},
-std::array<float,2>{0.45761928f, 0.312103689f},
-std::array<float,2>{0.912457824f, 0.614748836f},
-std::array<float,2>{0.10926412f, 0.909663916f},
-std::array<float,2>{0.726442754f, 0.101473987f},
-std::array<float,2>{0.373104751f, 0.0333239324f},
-std::array<float,2>{0.812281013f, 0.981677413f},
-std::array<float,2>{0.171186507f, 0.550028205f},
-std::array<float,2>{0.530456007f, 0.356378764f},
-std::array<float,2>{0.0164048038f, 0.424089998f},
-std::array<float,2>{0.662143111f, 0.639265001f},
-std::array<float,2>{0.402887881f, 0.857341647f},
-std::array<float,2>{0.951352596f, 0.218810484f},
-std::array<float,2>{0.0762716457f, 0.0816697702f},
-std::array<float,2>{0.700921953f, 0.89488852f},
-std::array<float,2>{0.482888162f, 0.56279707f},
-std::array<float,2>{0.905890584f, 0.265482128f},
-std::array<float,2>{0.276251107f, 0.460360855f},
-std::array<float,2>{0.851683021f, 0.716406584f},
-std::array<float,2>{0.216115341f, 0.810140967f},
-std::array<float,2>{0.611448407f, 0.17723389f},
-std::array<float,2>{0.428028315f, 0.198946372f},
-std::array<float,2>{0.972210646f, 0.830193758f},
-std::array<float,2>{0.0620515719f, 0.662073731f},
-std::array<float,2>{0.633871377f, 0.383461803f},
-std::array<float,2>{0.136830524f, 0.319032431f},
-std::array<float,2>{0.553478062f, 0.509794235f},
-std::array<float,2>{0.340918541f, 0.941098571f},
-std::array<float,2>{0.762121558f, 0.0207047332f},
-std::array<float,2>{0.206604257f, 0.106602013f},
-std::array<float,2>{0.620719731f, 0.919542253f},
-std::array<float,2>{0.270337373f, 0.619372427f},
-std::array<float,2>{0.848156989f, 0.298597068f},
-std::array<float,2>{0.473776489f, 0.474376947f},
-std::array<float,2>{0.894065022f, 0.746649265f},
-std::array<float,2>{0.062610209f, 0.777640283f},
-std::array<float,2>{0.695309818f, 0.133622676f},
-std::array<float,2>{0.333200991f, 0.233128414f},
-std::array<float,2>{0.75136286f, 0.84952414f},
-std::array<float,2>{0.132637799f, 0.625490427f},
-std::array<float,2>{0.562378347f, 0.431996346f},
-std::array<float,2>{0.0529126972f, 0.349236816f},
-std::array<float,2>{0.63164109f, 0.559069335f},
-std::array<float,2>{0.429872543f, 0.969956875f},
-std::array<float,2>{0.979394555f, 0.0430788733f},
-std::array<float,2>{0.0961949304f, 0.183568224f},
-std::array<float,2>{0.732837677f, 0.798002839f},
-std::array<float,2>{0.467933685f, 0.709627509f},
-std::array<float,2>{0.915179968f, 0.462443233f},
-std::array<float,2>{0.309195012f, 0.252993166f},
-std::array<float,2>{0.838557661f, 0.570587695f},
-std::array<float,2>{0.229261607f, 0.899090469f},
-std::array<float,2>{0.562986612f, 0.0883819386f},
-std::array<float,2>{0.396196544f, 0.0253233425f},
-std::array<float,2>{0.937919796f, 0.945762217f},
-std::array<float,2>{0.0307204612f, 0.505811751f},
-std::array<float,2>{0.668777585f, 0.32588917f},
-std::array<float,2>{0.162178144f, 0.375010759f},
-std::array<float,2>{0.520430624f, 0.670076728f},
-std::array<float,2>{0.365349412f, 0.838575602f},
-std::array<float,2>{0.804320514f, 0.190793887f},
-std::array<float,2>{0.141483173f, 0.20818454f},
-std::array<float,2>{0.544326186f, 0.814072251f},
-std::array<float,2>{0.32034874f, 0.680488229f},
-std::array<float,2>{0.776982129f, 0.396203727f},
-std::array<float,2>{0.409876585f, 0.331910133f},
-std::array<float,2>{0.99738878f, 0.531020045f},
-std::array<float,2>{0.0336214416f, 0.954724014f},
-std::array<float,2>{0.655162692f, 0.0063067684f},
-std::array<float,2>{0.250681996f, 0.0719702095f},
-std::array<float,2>{0.873880625f, 0.878603637f},
-std::array<float,2>{0.194565907f, 0.58319217f},
-std::array<float,2>{0.604799867f, 0.275586993f},
-std::array<float,2>{0.0917678103f, 0.442431182f},
-std::array<float,2>{0.709423244f, 0.694704056f},
-std::array<float,2>{0.486797959f, 0.79096669f},
-std::array<float,2>{0.884591281f, 0.161913782f},
-std::array<float,2>{0.00771142915f, 0.0531998202f},
-std::array<float,2>{0.674275279f, 0.984504282f},
-std::array<float,2>{0.385597974f, 0.540536702f},
-std::array<float,2>{0.957157731f, 0.369239569f},
-std::array<float,2>{0.344186842f, 0.413175732f},
-std::array<float,2>{0.792457104f, 0.641694009f},
-std::array<float,2>{0.175936699f, 0.865236342f},
-std::array<float,2>{0.506632745f, 0.239154801f},
-std::array<float,2>{0.4478921f, 0.141886815f},
-std::array<float,2>{0.924787641f, 0.755648494f},
-std::array<float,2>{0.115477026f, 0.733398795f},
-std::array<float,2>{0.749821424f, 0.496345609f},
-std::array<float,2>{0.241141021f, 0.292755991f},
-std::array<float,2>{0.578988314f, 0.603682876f},
-std::array<float,2>{0.287616134f, 0.936053634f},
-std::array<float,2>{0.823607445f, 0.114563636f},
-std::array<float,2>{0.125356093f, 0.063960582f},
-std::array<float,2>{0.555099547f, 0.885657191f},
-std::array<float,2>{0.328814387f, 0.591646433f},
-std::array<float,2>{0.755252361f, 0.271861017f},
-std::array<float,2>{0.436539024f, 0.447964281f},
-std::array<float,2>{0.983713388f, 0.70154953f},
-std::array<float,2>{0.0502410941f, 0.785059571f},
-std::array<float,2>{0.627031922f, 0.16966325f},
-std::array<float,2>{0.267948598f, 0.211509615f},
-std::array<float,2>{0.84442395f, 0.824122071f},
-std::array<float,2>{0.208616182f, 0.672558963f},
-std::array<float,2>{0.623454869f, 0.401832491f},
-std::array<float,2>{0.0666642338f, 0.340670794f},
-std::array<float,2>{0.68967551f, 0.518473506f},
-std::array<float,2>{0.469612211f, 0.966339052f},
-std::array<float,2>{0.895243466f, 0.0106114913f},
-std::array<float,2>{0.0241040904f, 0.151078001f},
-std::array<float,2>{0.664394975f, 0.760897636f},
-std::array<float,2>{0.391496748f, 0.722466588f},
-std::array<float,2>{0.944915354f, 0.487437159f},
-std::array<float,2>{0.3619048f, 0.28522104f},
-std::array<float,2>{0.799977183f, 0.59435457f},
-std::array<float,2>{0.157661259f, 0.929679573f},
-std::array<float,2>{0.517760396f, 0.119442567f},
-std::array<float,2>{0.461117566f, 0.0554615371f},
-std::array<float,2>{0.919874132f, 0.997387886f},
-std::array<float,2>{0.101436019f, 0.533125103f},
-std::array<float,2>{0.728722036f, 0.364589959f},
-std::array<float,2>{0.231274977f, 0.418777317f},
-std::array<float,2>{0.568023443f, 0.651850224f},
-std::array<float,2>{0.305562168f, 0.868228674f},
-std::array<float,2>{0.842086256f, 0.248387098f},
-std::array<float,2>{0.188706204f, 0.22287178f},
-std::array<float,2>{0.607396483f, 0.85507834f},
-std::array<float,2>{0.25649792f, 0.636191607f},
-std::array<float,2>{0.86868453f, 0.426062554f},
-std::array<float,2>{0.489281148f, 0.353381217f},
-std::array<float,2>{0.888477266f, 0.554360032f},
-std::array<float,2>{0.0897790417f, 0.977137089f},
-std::array<float,2>{0.704446137f, 0.0353806391f},
-std::array<float,2>{0.325817049f, 0.0954928622f},
-std::array<float,2>{0.780084908f, 0.912475646f},
-std::array<float,2>{0.146693319f, 0.612838984f},
-std::array<float,2>{0.54228884f, 0.305518687f},
-std::array<float,2>{0.0352374353f, 0.478376329f},
-std::array<float,2>{0.65029645f, 0.73897022f},
-std::array<float,2>{0.412571996f, 0.7671206f},
-std::array<float,2>{0.993301392f, 0.126483738f},
-std::array<float,2>{0.111956395f, 0.0171691217f},
-std::array<float,2>{0.744333088f, 0.942703187f},
-std::array<float,2>{0.451101482f, 0.512411773f},
-std::array<float,2>{0.926333845f, 0.314522862f},
-std::array<float,2>{0.28169322f, 0.389882028f},
-std::array<float,2>{0.825046539f, 0.659431159f},
-std::array<float,2>{0.23677884f, 0.835580528f},
-std::array<float,2>{0.583060741f, 0.201773688f},
-std::array<float,2>{0.388861626f, 0.172976106f},
-std::array<float,2>{0.955672026f, 0.808113039f},
-std::array<float,2>{0.0015379641f, 0.71341151f},
-std::array<float,2>{0.678705215f, 0.453598738f},
-std::array<float,2>{0.175354674f, 0.257922053f},
-std::array<float,2>{0.502617061f, 0.568232417f},
-std::array<float,2>{0.34786576f, 0.893033624f},
-std::array<float,2>{0.794745326f, 0.0850854591f},
-std::array<float,2>{0.24360019f, 0.0421909541f},
-std::array<float,2>{0.59010011f, 0.973170221f},
-std::array<float,2>{0.290526778f, 0.555083036f},
-std::array<float,2>{0.819972694f, 0.344310552f},
-std::array<float,2>{0.437974393f, 0.435866892f},
-std::array<float,2>{0.931405485f, 0.631533802f},
-std::array<float,2>{0.122026064f, 0.844866931f},
-std::array<float,2>{0.736535132f, 0.227257907f},
-std::array<float,2>{0.352986842f, 0.137510613f},
-std::array<float,2>{0.786611497f, 0.775687158f},
-std::array<float,2>{0.186518222f, 0.74438262f},
-std::array<float,2>{0.5148893f, 0.469183266f},
-std::array<float,2>{0.0104803117f, 0.303164899f},
-std::array<float,2>{0.681998253f, 0.62356627f},
-std::array<float,2>{0.380307049f, 0.9141137f},
-std::array<float,2>{0.968061805f, 0.103293687f},
-std::array<float,2>{0.078958936f, 0.192256883f},
-std::array<float,2>{0.712156773f, 0.84318471f},
-std::array<float,2>{0.49542883f, 0.667511642f},
-std::array<float,2>{0.876325309f, 0.381595731f},
-std::array<float,2>{0.259693861f, 0.321038991f},
-std::array<float,2>{0.860968232f, 0.503021777f},
-std::array<float,2>{0.195927545f, 0.951011419f},
-std::array<float,2>{0.597270668f, 0.027633654f},
-std::array<float,2>{0.419066161f, 0.0927045643f},
-std::array<float,2>{0.990867078f, 0.906050205f},
-std::array<float,2>{0.0462578051f, 0.575837731f},
-std::array<float,2>{0.646501005f, 0.256012887f},
-std::array<float,2>{0.151600271f, 0.466849774f},
-std::array<float,2>{0.538707793f, 0.706543386f},
-std::array<float,2>{0.314196378f, 0.803981185f},
-std::array<float,2>{0.766577482f, 0.186536446f},
-std::array<float,2>{0.164435968f, 0.157514349f},
-std::array<float,2>{0.525533855f, 0.796413004f},
-std::array<float,2>{0.371046722f, 0.688864052f},
-std::array<float,2>{0.807220638f, 0.439933807f},
-std::array<float,2>{0.400619626f, 0.2802504f},
-std::array<float,2>{0.946785629f, 0.578221202f},
-std::array<float,2>{0.0197974294f, 0.881634116f},
-std::array<float,2>{0.66014725f, 0.0770227239f},
-std::array<float,2>{0.30158034f, 0.000102327649f},
-std::array<float,2>{0.835537851f, 0.960826576f},
-std::array<float,2>{0.22377716f, 0.527076364f},
-std::array<float,2>{0.570594668f, 0.333666146f},
-std::array<float,2>{0.104520716f, 0.392070264f},
-std::array<float,2>{0.7203269f, 0.684683204f},
-std::array<float,2>{0.455938071f, 0.816456139f},
-std::array<float,2>{0.906749427f, 0.206993073f},
-std::array<float,2>{0.0578204244f, 0.111853361f},
-std::array<float,2>{0.637748003f, 0.932614863f},
-std::array<float,2>{0.422876984f, 0.606527507f},
-std::array<float,2>{0.972914517f, 0.294261932f},
-std::array<float,2>{0.336593956f, 0.494251609f},
-std::array<float,2>{0.759829164f, 0.729335368f},
-std::array<float,2>{0.134536877f, 0.752106607f},
-std::array<float,2>{0.550175667f, 0.145412862f},
-std::array<float,2>{0.477271229f, 0.23471646f},
-std::array<float,2>{0.898458004f, 0.863151014f},
-std::array<float,2>{0.0707508847f, 0.64752233f},
-std::array<float,2>{0.698287904f, 0.408553988f},
-std::array<float,2>{0.214018628f, 0.373921186f},
-std::array<float,2>{0.616950572f, 0.545876026f},
-std::array<float,2>{0.280796081f, 0.988367558f},
-std::array<float,2>{0.859371483f, 0.0502650551f},
-std::array<float,2>{0.153969243f, 0.0601852424f},
-std::array<float,2>{0.53131336f, 0.995824993f},
-std::array<float,2>{0.318149924f, 0.538558245f},
-std::array<float,2>{0.772707582f, 0.36178574f},
-std::array<float,2>{0.417209268f, 0.414390087f},
-std::array<float,2>{0.988057733f, 0.655486465f},
-std::array<float,2>{0.041629564f, 0.871600389f},
-std::array<float,2>{0.641689658f, 0.243062198f},
-std::array<float,2>{0.265273392f, 0.156053171f},
-std::array<float,2>{0.866048515f, 0.762929678f},
-std::array<float,2>{0.202201217f, 0.722717404f},
-std::array<float,2>{0.601417005f, 0.489451319f},
-std::array<float,2>{0.0838479772f, 0.281261116f},
-std::array<float,2>{0.715923727f, 0.598710299f},
-std::array<float,2>{0.496513575f, 0.921902061f},
-std::array<float,2>{0.879349351f, 0.124367602f},
-std::array<float,2>{0.0143603217f, 0.217896417f},
-std::array<float,2>{0.686278522f, 0.8256675f},
-std::array<float,2>{0.378655076f, 0.679047585f},
-std::array<float,2>{0.961183667f, 0.403216869f},
-std::array<float,2>{0.356698632f, 0.337650478f},
-std::array<float,2>{0.782064319f, 0.519633412f},
-std::array<float,2>{0.181154653f, 0.961799681f},
-std::array<float,2>{0.510313928f, 0.0130561804f},
-std::array<float,2>{0.442907065f, 0.0675247535f},
-std::array<float,2>{0.93422389f, 0.886755824f},
-std::array<float,2>{0.121077172f, 0.58851099f},
-std::array<float,2>{0.739428163f, 0.269473702f},
-std::array<float,2>{0.248634085f, 0.449550897f},
-std::array<float,2>{0.586039186f, 0.697629869f},
-std::array<float,2>{0.294511318f, 0.787007868f},
-std::array<float,2>{0.814765275f, 0.166006967f},
-std::array<float,2>{0.217154384f, 0.179264933f},
-std::array<float,2>{0.610830784f, 0.811036825f},
-std::array<float,2>{0.275247514f, 0.718590736f},
-std::array<float,2>{0.853677034f, 0.457179993f},
-std::array<float,2>{0.481300682f, 0.263524085f},
-std::array<float,2>{0.903768241f, 0.5654549f},
-std::array<float,2>{0.0746180117f, 0.896814823f},
-std::array<float,2>{0.701291621f, 0.078453593f},
-std::array<float,2>{0.342786819f, 0.0228182822f},
-std::array<float,2>{0.765254259f, 0.937739313f},
-std::array<float,2>{0.140372381f, 0.508322239f},
-std::array<float,2>{0.551033616f, 0.317727864f},
-std::array<float,2>{0.0586459003f, 0.385063201f},
-std::array<float,2>{0.635070086f, 0.662819684f},
-std::array<float,2>{0.425967604f, 0.828178167f},
-std::array<float,2>{0.970099092f, 0.19704932f},
-std::array<float,2>{0.107370682f, 0.0977071449f},
-std::array<float,2>{0.723867834f, 0.907288134f},
-std::array<float,2>{0.459305227f, 0.616183043f},
-std::array<float,2>{0.910591602f, 0.309540033f},
-std::array<float,2>{0.300183088f, 0.483987838f},
-std::array<float,2>{0.82821101f, 0.737138927f},
-std::array<float,2>{0.219366521f, 0.770461857f},
-std::array<float,2>{0.574524343f, 0.129727244f},
-std::array<float,2>{0.40438354f, 0.221145004f},
-std::array<float,2>{0.9492805f, 0.858394861f},
-std::array<float,2>{0.0192999411f, 0.636846781f},
-std::array<float,2>{0.661917984f, 0.422770441f},
-std::array<float,2>{0.169454619f, 0.357675791f},
-std::array<float,2>{0.527539909f, 0.548128486f},
-std::array<float,2>{0.37247628f, 0.983637452f},
-std::array<float,2>{0.80998379f, 0.0316725448f},
-std::array<float,2>{0.228041574f, 0.0860371366f},
-std::array<float,2>{0.566035211f, 0.90076232f},
-std::array<float,2>{0.312149316f, 0.574056089f},
-std::array<float,2>{0.837370217f, 0.251874596f},
-std::array<float,2>{0.466239184f, 0.464557141f},
-std::array<float,2>{0.916992068f, 0.707895219f},
-std::array<float,2>{0.0937948376f, 0.800575197f},
-std::array<float,2>{0.731230736f, 0.18126224f},
-std::array<float,2>{0.363734037f, 0.1887528f},
-std::array<float,2>{0.801871538f, 0.836049616f},
-std::array<float,2>{0.161430448f, 0.669717908f},
-std::array<float,2>{0.521695316f, 0.377922148f},
-std::array<float,2>{0.0289205331f, 0.327591449f},
-std::array<float,2>{0.671243012f, 0.507057905f},
-std::array<float,2>{0.397304326f, 0.947341383f},
-std::array<float,2>{0.940548956f, 0.0260669775f},
-std::array<float,2>{0.0645761266f, 0.135775194f},
-std::array<float,2>{0.691408277f, 0.779920518f},
-std::array<float,2>{0.475884944f, 0.748275578f},
-std::array<float,2>{0.891685009f, 0.476136953f},
-std::array<float,2>{0.272331834f, 0.300318122f},
-std::array<float,2>{0.850325465f, 0.618247867f},
-std::array<float,2>{0.20421271f, 0.920226932f},
-std::array<float,2>{0.617225587f, 0.107649587f},
-std::array<float,2>{0.432432801f, 0.0465622135f},
-std::array<float,2>{0.977318048f, 0.971139193f},
-std::array<float,2>{0.0522753671f, 0.561037242f},
-std::array<float,2>{0.630842745f, 0.350215852f},
-std::array<float,2>{0.130714044f, 0.431037754f},
-std::array<float,2>{0.559984744f, 0.627565384f},
-std::array<float,2>{0.334831357f, 0.850044787f},
-std::array<float,2>{0.752181232f, 0.231349975f},
-std::array<float,2>{0.17957443f, 0.242163748f},
-std::array<float,2>{0.505485594f, 0.86335063f},
-std::array<float,2>{0.345984459f, 0.643908501f},
-std::array<float,2>{0.790242136f, 0.410260886f},
-std::array<float,2>{0.384761751f, 0.369051993f},
-std::array<float,2>{0.959414065f, 0.541603863f},
-std::array<float,2>{0.00567780249f, 0.987961352f},
-std::array<float,2>{0.673550606f, 0.0520603955f},
-std::array<float,2>{0.285338312f, 0.116256088f},
-std::array<float,2>{0.82153368f, 0.935205221f},
-std::array<float,2>{0.239876449f, 0.602403581f},
-std::array<float,2>{0.580788374f, 0.290617287f},
-std::array<float,2>{0.113369912f, 0.498336941f},
-std::array<float,2>{0.747228682f, 0.731020212f},
-std::array<float,2>{0.446965426f, 0.757360637f},
-std::array<float,2>{0.923031151f, 0.143752679f},
-std::array<float,2>{0.0330796726f, 0.0040260246f},
-std::array<float,2>{0.65282166f, 0.955905974f},
-std::array<float,2>{0.406614006f, 0.527466357f},
-std::array<float,2>{0.999656379f, 0.329893857f},
-std::array<float,2>{0.322922945f, 0.397187352f},
-std::array<float,2>{0.774421632f, 0.682082593f},
-std::array<float,2>{0.144513533f, 0.814484f},
-std::array<float,2>{0.546175361f, 0.210467085f},
-std::array<float,2>{0.48450613f, 0.163004592f},
-std::array<float,2>{0.886373222f, 0.791994274f},
-std::array<float,2>{0.0933078229f, 0.693300784f},
-std::array<float,2>{0.707742095f, 0.444672465f},
-std::array<float,2>{0.193243667f, 0.274182886f},
-std::array<float,2>{0.603440762f, 0.585337937f},
-std::array<float,2>{0.252329946f, 0.87603128f},
-std::array<float,2>{0.871140063f, 0.0726596639f},
-std::array<float,2>{0.159120828f, 0.119010538f},
-std::array<float,2>{0.515714467f, 0.926858783f},
-std::array<float,2>{0.359789282f, 0.596918941f},
-std::array<float,2>{0.798175395f, 0.287823439f},
-std::array<float,2>{0.392632872f, 0.484379441f},
-std::array<float,2>{0.942856848f, 0.719529092f},
-std::array<float,2>{0.0264132041f, 0.75831002f},
-std::array<float,2>{0.666459382f, 0.149479702f},
-std::array<float,2>{0.307201326f, 0.247614205f},
-std::array<float,2>{0.841440499f, 0.869782269f},
-std::array<float,2>{0.232438073f, 0.649745703f},
-std::array<float,2>{0.568574667f, 0.420209706f},
-std::array<float,2>{0.0990558416f, 0.366539568f},
-std::array<float,2>{0.727705717f, 0.534731925f},
-std::array<float,2>{0.463836998f, 0.999142587f},
-std::array<float,2>{0.921603322f, 0.0566439182f},
-std::array<float,2>{0.0478192754f, 0.171736509f},
-std::array<float,2>{0.625319004f, 0.781973779f},
-std::array<float,2>{0.435218453f, 0.700456679f},
-std::array<float,2>{0.982409179f, 0.446078897f},
-std::array<float,2>{0.330783308f, 0.271052241f},
-std::array<float,2>{0.756868541f, 0.591866374f},
-std::array<float,2>{0.127006412f, 0.883072376f},
-std::array<float,2>{0.557169914f, 0.065271765f},
-std::array<float,2>{0.471473753f, 0.00799321197f},
-std::array<float,2>{0.898000956f, 0.967949688f},
-std::array<float,2>{0.0698566735f, 0.51742655f},
-std::array<float,2>{0.689308763f, 0.343446523f},
-std::array<float,2>{0.209825188f, 0.399115831f},
-std::array<float,2>{0.621963322f, 0.675277889f},
-std::array<float,2>{0.265719533f, 0.82106787f},
-std::array<float,2>{0.847472072f, 0.213319018f},
-std::array<float,2>{0.235071868f, 0.200268596f},
-std::array<float,2>{0.585274398f, 0.832070649f},
-std::array<float,2>{0.28413859f, 0.657671452f},
-std::array<float,2>{0.826403379f, 0.387331694f},
-std::array<float,2>{0.45222497f, 0.312541097f},
-std::array<float,2>{0.929160476f, 0.514209032f},
-std::array<float,2>{0.110208407f, 0.944415808f},
-std::array<float,2>{0.743122756f, 0.0187529698f},
-std::array<float,2>{0.349794447f, 0.08233729f},
-std::array<float,2>{0.795436442f, 0.892119348f},
-std::array<float,2>{0.17338115f, 0.569313884f},
-std::array<float,2>{0.500074208f, 0.259941608f},
-std::array<float,2>{0.00349967089f, 0.45513764f},
-std::array<float,2>{0.677534282f, 0.711589038f},
-std::array<float,2>{0.386945993f, 0.805780768f},
-std::array<float,2>{0.953439355f, 0.174617425f},
-std::array<float,2>{0.085987702f, 0.0388297886f},
-std::array<float,2>{0.706085205f, 0.979234517f},
-std::array<float,2>{0.490339488f, 0.552487254f},
-std::array<float,2>{0.889870822f, 0.353811473f},
-std::array<float,2>{0.25567922f, 0.428051561f},
-std::array<float,2>{0.870091021f, 0.634188056f},
-std::array<float,2>{0.190872297f, 0.851806164f},
-std::array<float,2>{0.609085798f, 0.226437822f},
-std::array<float,2>{0.41144526f, 0.12843366f},
-std::array<float,2>{0.995811462f, 0.767610192f},
-std::array<float,2>{0.0388127416f, 0.740457952f},
-std::array<float,2>{0.651781917f, 0.480073482f},
-std::array<float,2>{0.144599333f, 0.307612985f},
-std::array<float,2>{0.539495468f, 0.609838128f},
-std::array<float,2>{0.327268839f, 0.911913216f},
-std::array<float,2>{0.777639806f, 0.0966350958f},
-std::array<float,2>{0.198076859f, 0.0308314655f},
-std::array<float,2>{0.593996763f, 0.951521695f},
-std::array<float,2>{0.260197163f, 0.501337826f},
-std::array<float,2>{0.862111032f, 0.323652118f},
-std::array<float,2>{0.492374986f, 0.379818231f},
-std::array<float,2>{0.878380716f, 0.665501118f},
-std::array<float,2>{0.0801140517f, 0.840898812f},
-std::array<float,2>{0.713913381f, 0.194888145f},
-std::array<float,2>{0.315778047f, 0.185054228f},
-std::array<float,2>{0.769513905f, 0.801200151f},
-std::array<float,2>{0.150206164f, 0.70453316f},
-std::array<float,2>{0.53703779f, 0.465032279f},
-std::array<float,2>{0.0441520363f, 0.254079759f},
-std::array<float,2>{0.644691527f, 0.577187061f},
-std::array<float,2>{0.420733452f, 0.903330147f},
-std::array<float,2>{0.990221202f, 0.0915531516f},
-std::array<float,2>{0.123851269f, 0.229003593f},
-std::array<float,2>{0.734941661f, 0.84701395f},
-std::array<float,2>{0.441389263f, 0.63058579f},
-std::array<float,2>{0.933141351f, 0.433820575f},
-std::array<float,2>{0.292554736f, 0.346611291f},
-std::array<float,2>{0.817745209f, 0.556875288f},
-std::array<float,2>{0.245162979f, 0.976105869f},
-std::array<float,2>{0.59245646f, 0.0405680239f},
-std::array<float,2>{0.381070673f, 0.104997456f},
-std::array<float,2>{0.965288401f, 0.916689217f},
-std::array<float,2>{0.00845157169f, 0.621201873f},
-std::array<float,2>{0.680348337f, 0.301944226f},
-std::array<float,2>{0.184421644f, 0.471612602f},
-std::array<float,2>{0.512318909f, 0.742768705f},
-std::array<float,2>{0.353685081f, 0.773920596f},
-std::array<float,2>{0.787822902f, 0.140132308f},
-std::array<float,2>{0.136643395f, 0.14756611f},
-std::array<float,2>{0.547227204f, 0.750032425f},
-std::array<float,2>{0.339810699f, 0.727083147f},
-std::array<float,2>{0.757875204f, 0.493442267f},
-std::array<float,2>{0.424122304f, 0.295230567f},
-std::array<float,2>{0.974814713f, 0.609115422f},
-std::array<float,2>{0.0556181781f, 0.930107415f},
-std::array<float,2>{0.639000714f, 0.111295044f},
-std::array<float,2>{0.278960228f, 0.0471911542f},
-std::array<float,2>{0.856289268f, 0.990288973f},
-std::array<float,2>{0.211825669f, 0.543999851f},
-std::array<float,2>{0.613444984f, 0.371120363f},
-std::array<float,2>{0.0728099793f, 0.40797013f},
-std::array<float,2>{0.695974171f, 0.64502728f},
-std::array<float,2>{0.480009466f, 0.859413862f},
-std::array<float,2>{0.901961684f, 0.237130389f},
-std::array<float,2>{0.0222807061f, 0.0749269128f},
-std::array<float,2>{0.657761872f, 0.879722834f},
-std::array<float,2>{0.398891926f, 0.581408978f},
-std::array<float,2>{0.948229432f, 0.278793365f},
-std::array<float,2>{0.368950635f, 0.43882072f},
-std::array<float,2>{0.80521667f, 0.691125453f},
-std::array<float,2>{0.167714015f, 0.793562651f},
-std::array<float,2>{0.523610413f, 0.159033731f},
-std::array<float,2>{0.454983473f, 0.20453018f},
-std::array<float,2>{0.909023881f, 0.819805861f},
-std::array<float,2>{0.101800285f, 0.685583711f},
-std::array<float,2>{0.721782684f, 0.393180102f},
-std::array<float,2>{0.224852338f, 0.33583793f},
-std::array<float,2>{0.572593749f, 0.525231421f},
-std::array<float,2>{0.303831637f, 0.957331359f},
-std::array<float,2>{0.832731664f, 0.00284103723f},
-std::array<float,2>{0.149930641f, 0.0290399883f},
-std::array<float,2>{0.536687076f, 0.950073361f},
-std::array<float,2>{0.315597773f, 0.502275884f},
-std::array<float,2>{0.769283831f, 0.322184324f},
-std::array<float,2>{0.420586288f, 0.382559717f},
-std::array<float,2>{0.989898741f, 0.666780472f},
-std::array<float,2>{0.0442587212f, 0.841952562f},
-std::array<float,2>{0.644848824f, 0.192859545f},
-std::array<float,2>{0.259886622f, 0.185754433f},
-std::array<float,2>{0.861968458f, 0.802979946f},
-std::array<float,2>{0.197807893f, 0.706018388f},
-std::array<float,2>{0.593768895f, 0.4678455f},
-std::array<float,2>{0.0804413036f, 0.257806391f},
-std::array<float,2>{0.71432066f, 0.574376643f},
-std::array<float,2>{0.492446959f, 0.904508889f},
-std::array<float,2>{0.877984941f, 0.0934167877f},
-std::array<float,2>{0.00864030793f, 0.228388488f},
-std::array<float,2>{0.680594385f, 0.844291687f},
-std::array<float,2>{0.381258577f, 0.632630944f},
-std::array<float,2>{0.965031087f, 0.437492043f},
-std::array<float,2>{0.353923559f, 0.345060647f},
-std::array<float,2>{0.787912846f, 0.556025088f},
-std::array<float,2>{0.184145525f, 0.973905504f},
-std::array<float,2>{0.512558162f, 0.0415546186f},
-std::array<float,2>{0.441090375f, 0.101633258f},
-std::array<float,2>{0.933585465f, 0.915933132f},
-std::array<float,2>{0.123642452f, 0.624441147f},
-std::array<float,2>{0.735116005f, 0.304362267f},
-std::array<float,2>{0.245414272f, 0.470269471f},
-std::array<float,2>{0.59254396f, 0.745311975f},
-std::array<float,2>{0.292789459f, 0.777176082f},
-std::array<float,2>{0.817575216f, 0.137754515f},
-std::array<float,2>{0.211603239f, 0.145552263f},
-std::array<float,2>{0.613668144f, 0.753251374f},
-std::array<float,2>{0.279130071f, 0.729786456f},
-std::array<float,2>{0.855969787f, 0.495339423f},
-std::array<float,2>{0.480433941f, 0.293285877f},
-std::array<float,2>{0.902274787f, 0.605750203f},
-std::array<float,2>{0.0730333626f, 0.933187068f},
-std::array<float,2>{0.696117699f, 0.112570621f},
-std::array<float,2>{0.339580953f, 0.0493244976f},
-std::array<float,2>{0.758118987f, 0.989796519f},
-std::array<float,2>{0.136357158f, 0.546377659f},
-std::array<float,2>{0.547078967f, 0.374183476f},
-std::array<float,2>{0.0552132279f, 0.410107017f},
-std::array<float,2>{0.638898849f, 0.646935582f},
-std::array<float,2>{0.423875183f, 0.862148464f},
-std::array<float,2>{0.974893391f, 0.236210823f},
-std::array<float,2>{0.101829633f, 0.0771722794f},
-std::array<float,2>{0.72205317f, 0.882519782f},
-std::array<float,2>{0.454714388f, 0.57951647f},
-std::array<float,2>{0.908934891f, 0.280395776f},
-std::array<float,2>{0.304174721f, 0.440489292f},
-std::array<float,2>{0.832891405f, 0.687603593f},
-std::array<float,2>{0.22496444f, 0.795427263f},
-std::array<float,2>{0.572455227f, 0.156998366f},
-std::array<float,2>{0.398571342f, 0.206007138f},
-std::array<float,2>{0.947772801f, 0.817714334f},
-std::array<float,2>{0.0221587196f, 0.68394053f},
-std::array<float,2>{0.657997906f, 0.391350299f},
-std::array<float,2>{0.167885691f, 0.332788438f},
-std::array<float,2>{0.52379024f, 0.525608897f},
-std::array<float,2>{0.368705153f, 0.959739208f},
-std::array<float,2>{0.805622816f, 0.00128412794f},
-std::array<float,2>{0.232870445f, 0.121032856f},
-std::array<float,2>{0.568778336f, 0.928546607f},
-std::array<float,2>{0.307473838f, 0.595184922f},
-std::array<float,2>{0.841556966f, 0.286366612f},
-std::array<float,2>{0.463451475f, 0.486894071f},
-std::array<float,2>{0.921828628f, 0.720764279f},
-std::array<float,2>{0.0986394212f, 0.759918392f},
-std::array<float,2>{0.72799176f, 0.151481301f},
-std::array<float,2>{0.359489024f, 0.249717101f},
-std::array<float,2>{0.797987521f, 0.868010759f},
-std::array<float,2>{0.158904076f, 0.650594175f},
-std::array<float,2>{0.516041815f, 0.419479847f},
-std::array<float,2>{0.0268213972f, 0.363333672f},
-std::array<float,2>{0.666216373f, 0.531817615f},
-std::array<float,2>{0.392886907f, 0.996991158f},
-std::array<float,2>{0.942443371f, 0.0559328087f},
-std::array<float,2>{0.0702213645f, 0.168210864f},
-std::array<float,2>{0.689093828f, 0.78399086f},
-std::array<float,2>{0.471357346f, 0.702377856f},
-std::array<float,2>{0.8984043f, 0.448495328f},
-std::array<float,2>{0.266031832f, 0.273065329f},
-std::array<float,2>{0.847323179f, 0.590533018f},
-std::array<float,2>{0.209549114f, 0.886598527f},
-std::array<float,2>{0.621664643f, 0.0633797646f},
-std::array<float,2>{0.435491234f, 0.0108144116f},
-std::array<float,2>{0.982136965f, 0.965337873f},
-std::array<float,2>{0.047406584f, 0.519058943f},
-std::array<float,2>{0.625040948f, 0.341356874f},
-std::array<float,2>{0.127377689f, 0.401039034f},
-std::array<float,2>{0.55754137f, 0.67378813f},
-std::array<float,2>{0.330984116f, 0.822876871f},
-std::array<float,2>{0.757246912f, 0.212428927f},
-std::array<float,2>{0.173587278f, 0.202237725f},
-std::array<float,2>{0.500329852f, 0.834162652f},
-std::array<float,2>{0.350090235f, 0.658288479f},
-std::array<float,2>{0.795891106f, 0.389356583f},
-std::array<float,2>{0.387091368f, 0.316369206f},
-std::array<float,2>{0.953307509f, 0.513328075f},
-std::array<float,2>{0.0037305057f, 0.942180812f},
-std::array<float,2>{0.677262843f, 0.0163553264f},
-std::array<float,2>{0.283826798f, 0.0846621022f},
-std::array<float,2>{0.826535583f, 0.894459963f},
-std::array<float,2>{0.235250145f, 0.566802382f},
-std::array<float,2>{0.585056841f, 0.259053051f},
-std::array<float,2>{0.110025421f, 0.454278529f},
-std::array<float,2>{0.742757738f, 0.714095354f},
-std::array<float,2>{0.452444792f, 0.807205737f},
-std::array<float,2>{0.928715289f, 0.172048837f},
-std::array<float,2>{0.0388486087f, 0.0367274135f},
-std::array<float,2>{0.651461959f, 0.977604926f},
-std::array<float,2>{0.411374062f, 0.553564191f},
-std::array<float,2>{0.995935023f, 0.351961315f},
-std::array<float,2>{0.327502847f, 0.427539408f},
-std::array<float,2>{0.777478695f, 0.635185957f},
-std::array<float,2>{0.144813329f, 0.853974879f},
-std::array<float,2>{0.539220333f, 0.224523857f},
-std::array<float,2>{0.490481973f, 0.125581771f},
-std::array<float,2>{0.889988124f, 0.766057491f},
-std::array<float,2>{0.0862094238f, 0.740025997f},
-std::array<float,2>{0.706379414f, 0.477146238f},
-std::array<float,2>{0.190614477f, 0.305835247f},
-std::array<float,2>{0.609144509f, 0.611357152f},
-std::array<float,2>{0.255508721f, 0.913465977f},
-std::array<float,2>{0.86966002f, 0.0939911976f},
-std::array<float,2>{0.161367506f, 0.0895778909f},
-std::array<float,2>{0.521888018f, 0.899969757f},
-std::array<float,2>{0.36345911f, 0.571320415f},
-std::array<float,2>{0.802173793f, 0.252748549f},
-std::array<float,2>{0.39719069f, 0.461372703f},
-std::array<float,2>{0.940781415f, 0.710811257f},
-std::array<float,2>{0.0291570555f, 0.797372758f},
-std::array<float,2>{0.671022594f, 0.182407051f},
-std::array<float,2>{0.312423766f, 0.189711049f},
-std::array<float,2>{0.83704716f, 0.839249313f},
-std::array<float,2>{0.22841695f, 0.671427965f},
-std::array<float,2>{0.566373348f, 0.376279175f},
-std::array<float,2>{0.0940246433f, 0.324663728f},
-std::array<float,2>{0.730965197f, 0.504565835f},
-std::array<float,2>{0.465974003f, 0.946336031f},
-std::array<float,2>{0.916719615f, 0.0236695297f},
-std::array<float,2>{0.0525241792f, 0.134386808f},
-std::array<float,2>{0.630396366f, 0.779043734f},
-std::array<float,2>{0.432315081f, 0.747136652f},
-std::array<float,2>{0.977130234f, 0.473506957f},
-std::array<float,2>{0.334642231f, 0.296975672f},
-std::array<float,2>{0.752409339f, 0.620602965f},
-std::array<float,2>{0.130421638f, 0.918807447f},
-std::array<float,2>{0.559711516f, 0.105655298f},
-std::array<float,2>{0.475680679f, 0.0448353663f},
-std::array<float,2>{0.892086864f, 0.968946397f},
-std::array<float,2>{0.0649404526f, 0.56054318f},
-std::array<float,2>{0.691704571f, 0.347677797f},
-std::array<float,2>{0.204495326f, 0.43328926f},
-std::array<float,2>{0.617659628f, 0.626190245f},
-std::array<float,2>{0.272099078f, 0.848554075f},
-std::array<float,2>{0.850352526f, 0.234316394f},
-std::array<float,2>{0.24001734f, 0.239723071f},
-std::array<float,2>{0.580927491f, 0.866931438f},
-std::array<float,2>{0.285415441f, 0.641480088f},
-std::array<float,2>{0.821423888f, 0.412430793f},
-std::array<float,2>{0.44723779f, 0.370747626f},
-std::array<float,2>{0.923217416f, 0.539862752f},
-std::array<float,2>{0.113549665f, 0.985926211f},
-std::array<float,2>{0.747480452f, 0.0538348444f},
-std::array<float,2>{0.345758975f, 0.113918461f},
-std::array<float,2>{0.790340066f, 0.937219918f},
-std::array<float,2>{0.179396167f, 0.605044305f},
-std::array<float,2>{0.505821943f, 0.29107967f},
-std::array<float,2>{0.00548188481f, 0.497315884f},
-std::array<float,2>{0.673818827f, 0.733179688f},
-std::array<float,2>{0.384485483f, 0.754354715f},
-std::array<float,2>{0.959056437f, 0.140819043f},
-std::array<float,2>{0.0935353488f, 0.00688948762f},
-std::array<float,2>{0.707995772f, 0.953232169f},
-std::array<float,2>{0.484735936f, 0.530158222f},
-std::array<float,2>{0.886689603f, 0.330413908f},
-std::array<float,2>{0.252142519f, 0.394727409f},
-std::array<float,2>{0.871379614f, 0.681020796f},
-std::array<float,2>{0.193075329f, 0.812698007f},
-std::array<float,2>{0.60304141f, 0.207293049f},
-std::array<float,2>{0.406387895f, 0.160502046f},
-std::array<float,2>{0.999860644f, 0.789740026f},
-std::array<float,2>{0.0329202265f, 0.693387985f},
-std::array<float,2>{0.65248698f, 0.442365646f},
-std::array<float,2>{0.144047171f, 0.276863217f},
-std::array<float,2>{0.546043158f, 0.582808912f},
-std::array<float,2>{0.323156685f, 0.877768874f},
-std::array<float,2>{0.774838984f, 0.0703974888f},
-std::array<float,2>{0.202496454f, 0.0621627495f},
-std::array<float,2>{0.601078629f, 0.992321074f},
-std::array<float,2>{0.265565962f, 0.536670566f},
-std::array<float,2>{0.865732431f, 0.360231519f},
-std::array<float,2>{0.496196598f, 0.416559279f},
-std::array<float,2>{0.879137695f, 0.654281855f},
-std::array<float,2>{0.0837387592f, 0.874258041f},
-std::array<float,2>{0.71623683f, 0.245822027f},
-std::array<float,2>{0.318038642f, 0.153419048f},
-std::array<float,2>{0.772634506f, 0.76458919f},
-std::array<float,2>{0.15413335f, 0.724988282f},
-std::array<float,2>{0.531621456f, 0.492111772f},
-std::array<float,2>{0.0419308431f, 0.284555942f},
-std::array<float,2>{0.641981065f, 0.600018501f},
-std::array<float,2>{0.417244434f, 0.925516248f},
-std::array<float,2>{0.988028407f, 0.122025378f},
-std::array<float,2>{0.120815538f, 0.215742663f},
-std::array<float,2>{0.739517808f, 0.826765954f},
-std::array<float,2>{0.443209648f, 0.677240551f},
-std::array<float,2>{0.934455514f, 0.404496104f},
-std::array<float,2>{0.294732869f, 0.338497341f},
-std::array<float,2>{0.814661443f, 0.523214102f},
-std::array<float,2>{0.248814106f, 0.964256227f},
-std::array<float,2>{0.586252987f, 0.0149331177f},
-std::array<float,2>{0.378748268f, 0.0690158531f},
-std::array<float,2>{0.961146414f, 0.889257908f},
-std::array<float,2>{0.0144190919f, 0.586138427f},
-std::array<float,2>{0.686461806f, 0.266303599f},
-std::array<float,2>{0.181453004f, 0.452373534f},
-std::array<float,2>{0.510654867f, 0.695316195f},
-std::array<float,2>{0.356604844f, 0.787840784f},
-std::array<float,2>{0.781979382f, 0.167540103f},
-std::array<float,2>{0.140412584f, 0.176564038f},
-std::array<float,2>{0.55094856f, 0.809498072f},
-std::array<float,2>{0.3431997f, 0.715268016f},
-std::array<float,2>{0.765492499f, 0.459327072f},
-std::array<float,2>{0.426029563f, 0.264340729f},
-std::array<float,2>{0.9698506f, 0.564417303f},
-std::array<float,2>{0.0588440523f, 0.895571172f},
-std::array<float,2>{0.634939373f, 0.080173701f},
-std::array<float,2>{0.275138915f, 0.0203647409f},
-std::array<float,2>{0.853953898f, 0.940279007f},
-std::array<float,2>{0.216880649f, 0.51162523f},
-std::array<float,2>{0.610584021f, 0.319780648f},
-std::array<float,2>{0.074452728f, 0.3841784f},
-std::array<float,2>{0.701452076f, 0.660217106f},
-std::array<float,2>{0.481120884f, 0.831338286f},
-std::array<float,2>{0.903424799f, 0.197527364f},
-std::array<float,2>{0.0191131458f, 0.100303374f},
-std::array<float,2>{0.661797583f, 0.908351004f},
-std::array<float,2>{0.404597521f, 0.614154041f},
-std::array<float,2>{0.949473143f, 0.311115921f},
-std::array<float,2>{0.372184724f, 0.481244832f},
-std::array<float,2>{0.809770346f, 0.73627466f},
-std::array<float,2>{0.16981408f, 0.772623241f},
-std::array<float,2>{0.527616858f, 0.131536007f},
-std::array<float,2>{0.459197074f, 0.220657706f},
-std::array<float,2>{0.91025126f, 0.856330752f},
-std::array<float,2>{0.107112013f, 0.640522063f},
-std::array<float,2>{0.724105239f, 0.425209701f},
-std::array<float,2>{0.219613001f, 0.357250899f},
-std::array<float,2>{0.574362755f, 0.549342573f},
-std::array<float,2>{0.3000305f, 0.980600476f},
-std::array<float,2>{0.828580201f, 0.0342988558f},
-std::array<float,2>{0.186145872f, 0.0398603491f},
-std::array<float,2>{0.515098512f, 0.975104511f},
-std::array<float,2>{0.352707475f, 0.558077753f},
-std::array<float,2>{0.786178887f, 0.34741655f},
-std::array<float,2>{0.380088806f, 0.435281336f},
-std::array<float,2>{0.967909753f, 0.629098415f},
-std::array<float,2>{0.0105217192f, 0.846152246f},
-std::array<float,2>{0.681788146f, 0.229843467f},
-std::array<float,2>{0.290178359f, 0.139155626f},
-std::array<float,2>{0.820268154f, 0.774796188f},
-std::array<float,2>{0.243244261f, 0.743566692f},
-std::array<float,2>{0.590084136f, 0.472533941f},
-std::array<float,2>{0.121623918f, 0.300985187f},
-std::array<float,2>{0.736627102f, 0.622317731f},
-std::array<float,2>{0.437614202f, 0.917114913f},
-std::array<float,2>{0.931388915f, 0.104043826f},
-std::array<float,2>{0.045900695f, 0.194035143f},
-std::array<float,2>{0.646908939f, 0.840589762f},
-std::array<float,2>{0.419239372f, 0.664411485f},
-std::array<float,2>{0.9909935f, 0.379967988f},
-std::array<float,2>{0.314332694f, 0.322421104f},
-std::array<float,2>{0.766199529f, 0.500796735f},
-std::array<float,2>{0.151684776f, 0.952512741f},
-std::array<float,2>{0.538995385f, 0.0302285142f},
-std::array<float,2>{0.495297134f, 0.090270482f},
-std::array<float,2>{0.876145005f, 0.90270704f},
-std::array<float,2>{0.0786597133f, 0.576480627f},
-std::array<float,2>{0.712391496f, 0.255356073f},
-std::array<float,2>{0.19618772f, 0.466196716f},
-std::array<float,2>{0.597484171f, 0.70347321f},
-std::array<float,2>{0.25941354f, 0.802677333f},
-std::array<float,2>{0.861139297f, 0.183710098f},
-std::array<float,2>{0.224053979f, 0.159332678f},
-std::array<float,2>{0.570384681f, 0.794689953f},
-std::array<float,2>{0.301423162f, 0.689558804f},
-std::array<float,2>{0.835932255f, 0.43763271f},
-std::array<float,2>{0.455624521f, 0.277774096f},
-std::array<float,2>{0.90716213f, 0.580202222f},
-std::array<float,2>{0.104832627f, 0.880819917f},
-std::array<float,2>{0.720652044f, 0.0761107132f},
-std::array<float,2>{0.370837867f, 0.00355980592f},
-std::array<float,2>{0.807522237f, 0.958040416f},
-std::array<float,2>{0.164252743f, 0.524304032f},
-std::array<float,2>{0.525788307f, 0.334942579f},
-std::array<float,2>{0.01958731f, 0.394503981f},
-std::array<float,2>{0.659773648f, 0.687187493f},
-std::array<float,2>{0.40084216f, 0.819030046f},
-std::array<float,2>{0.947194159f, 0.203265801f},
-std::array<float,2>{0.0704073235f, 0.109582648f},
-std::array<float,2>{0.698710263f, 0.931120038f},
-std::array<float,2>{0.477517813f, 0.607455611f},
-std::array<float,2>{0.89871341f, 0.296340168f},
-std::array<float,2>{0.281244904f, 0.492239565f},
-std::array<float,2>{0.858917773f, 0.728498518f},
-std::array<float,2>{0.214174211f, 0.751242459f},
-std::array<float,2>{0.616828918f, 0.147120982f},
-std::array<float,2>{0.4231534f, 0.237920389f},
-std::array<float,2>{0.972896576f, 0.860917449f},
-std::array<float,2>{0.0580613315f, 0.645703554f},
-std::array<float,2>{0.637980461f, 0.406972051f},
-std::array<float,2>{0.134496897f, 0.37276867f},
-std::array<float,2>{0.549917936f, 0.543004692f},
-std::array<float,2>{0.336906761f, 0.992021918f},
-std::array<float,2>{0.760219336f, 0.0487972759f},
-std::array<float,2>{0.208973899f, 0.0664028749f},
-std::array<float,2>{0.623139858f, 0.884237707f},
-std::array<float,2>{0.26775983f, 0.593712091f},
-std::array<float,2>{0.844702423f, 0.269868791f},
-std::array<float,2>{0.469420433f, 0.446639121f},
-std::array<float,2>{0.895359099f, 0.699578285f},
-std::array<float,2>{0.0664451793f, 0.782693505f},
-std::array<float,2>{0.689723253f, 0.170346692f},
-std::array<float,2>{0.328919649f, 0.214193404f},
-std::array<float,2>{0.754955828f, 0.821482003f},
-std::array<float,2>{0.12509118f, 0.67472434f},
-std::array<float,2>{0.554689109f, 0.399732918f},
-std::array<float,2>{0.0498187542f, 0.342330098f},
-std::array<float,2>{0.627204418f, 0.516040087f},
-std::array<float,2>{0.436842293f, 0.967570126f},
-std::array<float,2>{0.983516514f, 0.00938836485f},
-std::array<float,2>{0.101273857f, 0.148873255f},
-std::array<float,2>{0.728944242f, 0.758805096f},
-std::array<float,2>{0.461245239f, 0.720419288f},
-std::array<float,2>{0.919465482f, 0.48607409f},
-std::array<float,2>{0.305373937f, 0.288113683f},
-std::array<float,2>{0.841936111f, 0.596012056f},
-std::array<float,2>{0.231079102f, 0.926397204f},
-std::array<float,2>{0.568254828f, 0.117612891f},
-std::array<float,2>{0.39127782f, 0.0581657737f},
-std::array<float,2>{0.945133626f, 0.998702645f},
-std::array<float,2>{0.0242348462f, 0.533665001f},
-std::array<float,2>{0.664128721f, 0.36528337f},
-std::array<float,2>{0.157288268f, 0.421041012f},
-std::array<float,2>{0.51804018f, 0.648937941f},
-std::array<float,2>{0.362065762f, 0.870406926f},
-std::array<float,2>{0.800057828f, 0.246934831f},
-std::array<float,2>{0.146879643f, 0.225372672f},
-std::array<float,2>{0.542098641f, 0.852622688f},
-std::array<float,2>{0.326074302f, 0.632840574f},
-std::array<float,2>{0.779815257f, 0.429536134f},
-std::array<float,2>{0.412257463f, 0.355071932f},
-std::array<float,2>{0.993640721f, 0.551622748f},
-std::array<float,2>{0.0356422029f, 0.980045855f},
-std::array<float,2>{0.649991632f, 0.0372080542f},
-std::array<float,2>{0.256654412f, 0.0974743515f},
-std::array<float,2>{0.869105518f, 0.910237372f},
-std::array<float,2>{0.188901037f, 0.611229122f},
-std::array<float,2>{0.607004762f, 0.307748109f},
-std::array<float,2>{0.0895907134f, 0.479267925f},
-std::array<float,2>{0.70418185f, 0.74201417f},
-std::array<float,2>{0.489662647f, 0.768781126f},
-std::array<float,2>{0.888374448f, 0.127060279f},
-std::array<float,2>{0.00184656493f, 0.0183307957f},
-std::array<float,2>{0.67823416f, 0.943631053f},
-std::array<float,2>{0.388922662f, 0.514770687f},
-std::array<float,2>{0.95598197f, 0.314328671f},
-std::array<float,2>{0.347917795f, 0.388226986f},
-std::array<float,2>{0.794457316f, 0.65664953f},
-std::array<float,2>{0.175626099f, 0.833114743f},
-std::array<float,2>{0.502886891f, 0.199961558f},
-std::array<float,2>{0.450850129f, 0.175086096f},
-std::array<float,2>{0.92675519f, 0.805161893f},
-std::array<float,2>{0.112063527f, 0.712421536f},
-std::array<float,2>{0.744543493f, 0.456496805f},
-std::array<float,2>{0.236489326f, 0.261583179f},
-std::array<float,2>{0.583415329f, 0.569955945f},
-std::array<float,2>{0.28139779f, 0.891598701f},
-std::array<float,2>{0.824845552f, 0.0835657343f},
-std::array<float,2>{0.132470623f, 0.108543269f},
-std::array<float,2>{0.562075675f, 0.921560526f},
-std::array<float,2>{0.333432376f, 0.617543638f},
-std::array<float,2>{0.751085162f, 0.299771607f},
-std::array<float,2>{0.430061907f, 0.47492221f},
-std::array<float,2>{0.979118109f, 0.749125957f},
-std::array<float,2>{0.0529809482f, 0.781158149f},
-std::array<float,2>{0.631366313f, 0.135520637f},
-std::array<float,2>{0.27014935f, 0.232134104f},
-std::array<float,2>{0.848443747f, 0.851388097f},
-std::array<float,2>{0.206911519f, 0.628656566f},
-std::array<float,2>{0.62101841f, 0.430204481f},
-std::array<float,2>{0.0627665296f, 0.350874394f},
-std::array<float,2>{0.694880962f, 0.56212014f},
-std::array<float,2>{0.473879606f, 0.972036958f},
-std::array<float,2>{0.894524097f, 0.0456199311f},
-std::array<float,2>{0.0304034241f, 0.179744646f},
-std::array<float,2>{0.668500841f, 0.799021006f},
-std::array<float,2>{0.396412075f, 0.708548903f},
-std::array<float,2>{0.937508464f, 0.463508636f},
-std::array<float,2>{0.365572602f, 0.250198364f},
-std::array<float,2>{0.804530799f, 0.572798491f},
-std::array<float,2>{0.162487566f, 0.901631117f},
-std::array<float,2>{0.52014482f, 0.0877206028f},
-std::array<float,2>{0.468115211f, 0.0272087827f},
-std::array<float,2>{0.915513277f, 0.94856286f},
-std::array<float,2>{0.0966608673f, 0.506060719f},
-std::array<float,2>{0.732584476f, 0.326901138f},
-std::array<float,2>{0.229112029f, 0.378688067f},
-std::array<float,2>{0.562633395f, 0.667996824f},
-std::array<float,2>{0.309558094f, 0.837086558f},
-std::array<float,2>{0.838700891f, 0.187901586f},
-std::array<float,2>{0.194704339f, 0.209305212f},
-std::array<float,2>{0.604681671f, 0.816271067f},
-std::array<float,2>{0.250777721f, 0.682869732f},
-std::array<float,2>{0.873555005f, 0.397589266f},
-std::array<float,2>{0.486505479f, 0.328925908f},
-std::array<float,2>{0.884385705f, 0.528898597f},
-std::array<float,2>{0.0914504156f, 0.956706882f},
-std::array<float,2>{0.709011495f, 0.00508647878f},
-std::array<float,2>{0.320779204f, 0.0737369508f},
-std::array<float,2>{0.777119398f, 0.875153661f},
-std::array<float,2>{0.141270161f, 0.584528983f},
-std::array<float,2>{0.544151783f, 0.274812579f},
-std::array<float,2>{0.0333425105f, 0.443709791f},
-std::array<float,2>{0.655019462f, 0.69196564f},
-std::array<float,2>{0.410078973f, 0.79168278f},
-std::array<float,2>{0.997128367f, 0.1639494f},
-std::array<float,2>{0.115709461f, 0.0512900762f},
-std::array<float,2>{0.749578953f, 0.987259448f},
-std::array<float,2>{0.448030323f, 0.542474866f},
-std::array<float,2>{0.924530447f, 0.368067056f},
-std::array<float,2>{0.288082123f, 0.411367685f},
-std::array<float,2>{0.823418796f, 0.643176734f},
-std::array<float,2>{0.240783304f, 0.864442229f},
-std::array<float,2>{0.578812778f, 0.24048686f},
-std::array<float,2>{0.385480195f, 0.143127158f},
-std::array<float,2>{0.957352102f, 0.756239235f},
-std::array<float,2>{0.0075536822f, 0.731933832f},
-std::array<float,2>{0.674033046f, 0.499432296f},
-std::array<float,2>{0.176235154f, 0.289724112f},
-std::array<float,2>{0.506576419f, 0.603403747f},
-std::array<float,2>{0.343816876f, 0.934465766f},
-std::array<float,2>{0.792048216f, 0.1161578f},
-std::array<float,2>{0.247103348f, 0.0120052062f},
-std::array<float,2>{0.588596225f, 0.962802172f},
-std::array<float,2>{0.296038896f, 0.521015048f},
-std::array<float,2>{0.81365639f, 0.336672843f},
-std::array<float,2>{0.443410903f, 0.403541714f},
-std::array<float,2>{0.935618162f, 0.677957952f},
-std::array<float,2>{0.11780981f, 0.824619532f},
-std::array<float,2>{0.741487324f, 0.217452794f},
-std::array<float,2>{0.357676774f, 0.16478017f},
-std::array<float,2>{0.784164548f, 0.785863757f},
-std::array<float,2>{0.182420954f, 0.698437095f},
-std::array<float,2>{0.509645462f, 0.450916886f},
-std::array<float,2>{0.0120794699f, 0.268096745f},
-std::array<float,2>{0.684616327f, 0.589840412f},
-std::array<float,2>{0.375453979f, 0.888618052f},
-std::array<float,2>{0.964566648f, 0.0673480108f},
-std::array<float,2>{0.0846395046f, 0.24362959f},
-std::array<float,2>{0.717212796f, 0.872323215f},
-std::array<float,2>{0.498079091f, 0.654790699f},
-std::array<float,2>{0.881922424f, 0.415168583f},
-std::array<float,2>{0.262894154f, 0.363067359f},
-std::array<float,2>{0.86441344f, 0.537561655f},
-std::array<float,2>{0.199869275f, 0.994682074f},
-std::array<float,2>{0.598593831f, 0.0592367724f},
-std::array<float,2>{0.415412188f, 0.123768866f},
-std::array<float,2>{0.986120403f, 0.923797607f},
-std::array<float,2>{0.040862143f, 0.598100662f},
-std::array<float,2>{0.642731905f, 0.282928884f},
-std::array<float,2>{0.155960336f, 0.488560617f},
-std::array<float,2>{0.534221172f, 0.724351406f},
-std::array<float,2>{0.319235831f, 0.762501061f},
-std::array<float,2>{0.770463765f, 0.154477671f},
-std::array<float,2>{0.171119153f, 0.13063623f},
-std::array<float,2>{0.530754328f, 0.770809829f},
-std::array<float,2>{0.373293847f, 0.737719834f},
-std::array<float,2>{0.812241733f, 0.482951045f},
-std::array<float,2>{0.403271109f, 0.310077369f},
-std::array<float,2>{0.951429188f, 0.616268694f},
-std::array<float,2>{0.0163265597f, 0.906995237f},
-std::array<float,2>{0.662486911f, 0.098711282f},
-std::array<float,2>{0.298723429f, 0.032258939f},
-std::array<float,2>{0.830662191f, 0.983041704f},
-std::array<float,2>{0.221582815f, 0.547546804f},
-std::array<float,2>{0.576646805f, 0.359011114f},
-std::array<float,2>{0.108963445f, 0.423757881f},
-std::array<float,2>{0.726251841f, 0.638237774f},
-std::array<float,2>{0.45797202f, 0.858555138f},
-std::array<float,2>{0.912112892f, 0.222628653f},
-std::array<float,2>{0.0623764917f, 0.0791298151f},
-std::array<float,2>{0.634080946f, 0.898000002f},
-std::array<float,2>{0.42793712f, 0.564992726f},
-std::array<float,2>{0.972652614f, 0.261767328f},
-std::array<float,2>{0.341157764f, 0.458912939f},
-std::array<float,2>{0.761771739f, 0.717724442f},
-std::array<float,2>{0.137155101f, 0.811839223f},
-std::array<float,2>{0.553293586f, 0.178697288f},
-std::array<float,2>{0.482540727f, 0.195872307f},
-std::array<float,2>{0.906034529f, 0.829651237f},
-std::array<float,2>{0.0764260069f, 0.663161695f},
-std::array<float,2>{0.70098412f, 0.385883898f},
-std::array<float,2>{0.215964571f, 0.317297369f},
-std::array<float,2>{0.611647666f, 0.509625137f},
-std::array<float,2>{0.275991529f, 0.939267576f},
-std::array<float,2>{0.851885259f, 0.0221939702f},
-std::array<float,2>{0.165850401f, 0.000594892015f},
-std::array<float,2>{0.52665174f, 0.960041761f},
-std::array<float,2>{0.369692951f, 0.526758134f},
-std::array<float,2>{0.807722211f, 0.33320868f},
-std::array<float,2>{0.401938647f, 0.392150819f},
-std::array<float,2>{0.945577323f, 0.685167789f},
-std::array<float,2>{0.0206710435f, 0.817227066f},
-std::array<float,2>{0.658970833f, 0.206111431f},
-std::array<float,2>{0.301918924f, 0.157906488f},
-std::array<float,2>{0.834953249f, 0.795919538f},
-std::array<float,2>{0.223026484f, 0.689258039f},
-std::array<float,2>{0.571300447f, 0.440238446f},
-std::array<float,2>{0.104282573f, 0.279302269f},
-std::array<float,2>{0.719241977f, 0.578779936f},
-std::array<float,2>{0.456461042f, 0.880898297f},
-std::array<float,2>{0.907624602f, 0.0766121224f},
-std::array<float,2>{0.0572126396f, 0.235221744f},
-std::array<float,2>{0.637243032f, 0.862586915f},
-std::array<float,2>{0.422758907f, 0.648189783f},
-std::array<float,2>{0.974558294f, 0.408886224f},
-std::array<float,2>{0.336967915f, 0.37306264f},
-std::array<float,2>{0.761180401f, 0.54498142f},
-std::array<float,2>{0.133376986f, 0.989091694f},
-std::array<float,2>{0.549491942f, 0.0505049787f},
-std::array<float,2>{0.477591395f, 0.111724213f},
-std::array<float,2>{0.899607718f, 0.93178606f},
-std::array<float,2>{0.0719386712f, 0.607043862f},
-std::array<float,2>{0.697928488f, 0.294857591f},
-std::array<float,2>{0.212948576f, 0.494764149f},
-std::array<float,2>{0.615943432f, 0.728618741f},
-std::array<float,2>{0.280206531f, 0.752816856f},
-std::array<float,2>{0.858304799f, 0.144628182f},
-std::array<float,2>{0.243081555f, 0.137081593f},
-std::array<float,2>{0.591193199f, 0.776138067f},
-std::array<float,2>{0.290017068f, 0.744839728f},
-std::array<float,2>{0.819092393f, 0.469238818f},
-std::array<float,2>{0.439155966f, 0.303319305f},
-std::array<float,2>{0.929970741f, 0.623277068f},
-std::array<float,2>{0.122373156f, 0.91494596f},
-std::array<float,2>{0.737406492f, 0.10283301f},
-std::array<float,2>{0.351613104f, 0.0425025113f},
-std::array<float,2>{0.786066651f, 0.972680211f},
-std::array<float,2>{0.18671599f, 0.555562258f},
-std::array<float,2>{0.5138219f, 0.343857557f},
-std::array<float,2>{0.0115362871f, 0.43638283f},
-std::array<float,2>{0.682661474f, 0.631205022f},
-std::array<float,2>{0.379655957f, 0.845508635f},
-std::array<float,2>{0.967075408f, 0.227000758f},
-std::array<float,2>{0.0798486844f, 0.0918897092f},
-std::array<float,2>{0.711055219f, 0.905406237f},
-std::array<float,2>{0.494331568f, 0.575669527f},
-std::array<float,2>{0.875223815f, 0.256538272f},
-std::array<float,2>{0.258566111f, 0.467720479f},
-std::array<float,2>{0.860255122f, 0.706079245f},
-std::array<float,2>{0.196594596f, 0.804293931f},
-std::array<float,2>{0.596631885f, 0.187346071f},
-std::array<float,2>{0.418828756f, 0.191669255f},
-std::array<float,2>{0.991366327f, 0.843438745f},
-std::array<float,2>{0.0452835485f, 0.667230606f},
-std::array<float,2>{0.64836818f, 0.381027997f},
-std::array<float,2>{0.15051727f, 0.320414305f},
-std::array<float,2>{0.537734747f, 0.503419757f},
-std::array<float,2>{0.313163757f, 0.950504839f},
-std::array<float,2>{0.766712844f, 0.0283167604f},
-std::array<float,2>{0.187548548f, 0.094888486f},
-std::array<float,2>{0.605547726f, 0.912628174f},
-std::array<float,2>{0.256906122f, 0.612711728f},
-std::array<float,2>{0.867525399f, 0.304911911f},
-std::array<float,2>{0.489149421f, 0.477893412f},
-std::array<float,2>{0.88743335f, 0.738415778f},
-std::array<float,2>{0.0886329487f, 0.766873419f},
-std::array<float,2>{0.703503311f, 0.126426756f},
-std::array<float,2>{0.32481426f, 0.223375052f},
-std::array<float,2>{0.780979276f, 0.854978919f},
-std::array<float,2>{0.148098484f, 0.636478126f},
-std::array<float,2>{0.541751623f, 0.426496089f},
-std::array<float,2>{0.0364566706f, 0.352913201f},
-std::array<float,2>{0.649206638f, 0.554197431f},
-std::array<float,2>{0.413723201f, 0.97696346f},
-std::array<float,2>{0.993012846f, 0.0358368829f},
-std::array<float,2>{0.113137804f, 0.173592031f},
-std::array<float,2>{0.745302618f, 0.80770725f},
-std::array<float,2>{0.449540555f, 0.713133156f},
-std::array<float,2>{0.926843464f, 0.453838468f},
-std::array<float,2>{0.282943636f, 0.258713245f},
-std::array<float,2>{0.82556814f, 0.56770134f},
-std::array<float,2>{0.238087028f, 0.893394291f},
-std::array<float,2>{0.582429886f, 0.0856089666f},
-std::array<float,2>{0.390000701f, 0.0170120094f},
-std::array<float,2>{0.956511676f, 0.94292587f},
-std::array<float,2>{0.000827461656f, 0.511928439f},
-std::array<float,2>{0.678892791f, 0.315357357f},
-std::array<float,2>{0.173976079f, 0.390171409f},
-std::array<float,2>{0.503841162f, 0.660027385f},
-std::array<float,2>{0.349348217f, 0.835104585f},
-std::array<float,2>{0.7931422f, 0.201313257f},
-std::array<float,2>{0.126052141f, 0.211036235f},
-std::array<float,2>{0.556481242f, 0.823352814f},
-std::array<float,2>{0.329782695f, 0.672063947f},
-std::array<float,2>{0.754285514f, 0.402319789f},
-std::array<float,2>{0.435985982f, 0.340054303f},
-std::array<float,2>{0.982507825f, 0.517691076f},
-std::array<float,2>{0.0492997803f, 0.965926111f},
-std::array<float,2>{0.628129244f, 0.00978119764f},
-std::array<float,2>{0.269152999f, 0.0640338212f},
-std::array<float,2>{0.845363617f, 0.885012448f},
-std::array<float,2>{0.207564443f, 0.590958059f},
-std::array<float,2>{0.62425679f, 0.272017866f},
-std::array<float,2>{0.0674662441f, 0.447385848f},
-std::array<float,2>{0.690641344f, 0.701883912f},
-std::array<float,2>{0.470034122f, 0.78425318f},
-std::array<float,2>{0.896208763f, 0.169197008f},
-std::array<float,2>{0.0253326427f, 0.0551529229f},
-std::array<float,2>{0.665591419f, 0.997749567f},
-std::array<float,2>{0.392442197f, 0.532240033f},
-std::array<float,2>{0.943809748f, 0.365009904f},
-std::array<float,2>{0.362419784f, 0.418249965f},
-std::array<float,2>{0.79935199f, 0.651911378f},
-std::array<float,2>{0.156566128f, 0.868988514f},
-std::array<float,2>{0.51915729f, 0.248735592f},
-std::array<float,2>{0.462323546f, 0.150611997f},
-std::array<float,2>{0.918257415f, 0.761718273f},
-std::array<float,2>{0.10042534f, 0.721802354f},
-std::array<float,2>{0.729951143f, 0.487812161f},
-std::array<float,2>{0.231588081f, 0.286071271f},
-std::array<float,2>{0.56699878f, 0.593901098f},
-std::array<float,2>{0.305812508f, 0.92915076f},
-std::array<float,2>{0.843576193f, 0.119714476f},
-std::array<float,2>{0.141963229f, 0.0716252774f},
-std::array<float,2>{0.542973697f, 0.878050804f},
-std::array<float,2>{0.322067618f, 0.583819449f},
-std::array<float,2>{0.775843561f, 0.276050657f},
-std::array<float,2>{0.408803821f, 0.442981899f},
-std::array<float,2>{0.996865869f, 0.694976687f},
-std::array<float,2>{0.0347188674f, 0.790392578f},
-std::array<float,2>{0.655423045f, 0.161401987f},
-std::array<float,2>{0.251933426f, 0.208733216f},
-std::array<float,2>{0.874647737f, 0.813877821f},
-std::array<float,2>{0.193627939f, 0.679755151f},
-std::array<float,2>{0.604371786f, 0.395970315f},
-std::array<float,2>{0.0902532637f, 0.331391901f},
-std::array<float,2>{0.710432768f, 0.530549586f},
-std::array<float,2>{0.488228619f, 0.954250872f},
-std::array<float,2>{0.883169413f, 0.00654348405f},
-std::array<float,2>{0.00638659252f, 0.142196417f},
-std::array<float,2>{0.675275326f, 0.755249143f},
-std::array<float,2>{0.386092156f, 0.734326005f},
-std::array<float,2>{0.958225369f, 0.496827066f},
-std::array<float,2>{0.345254034f, 0.292460978f},
-std::array<float,2>{0.791793227f, 0.604202986f},
-std::array<float,2>{0.176904082f, 0.935793996f},
-std::array<float,2>{0.507627845f, 0.114961244f},
-std::array<float,2>{0.448590398f, 0.0534172505f},
-std::array<float,2>{0.925457537f, 0.985296309f},
-std::array<float,2>{0.117124707f, 0.54016149f},
-std::array<float,2>{0.748927772f, 0.369836748f},
-std::array<float,2>{0.242099032f, 0.413747251f},
-std::array<float,2>{0.579357743f, 0.642206907f},
-std::array<float,2>{0.288440704f, 0.865913153f},
-std::array<float,2>{0.823097825f, 0.238564327f},
-std::array<float,2>{0.20551616f, 0.232476234f},
-std::array<float,2>{0.619627774f, 0.848693073f},
-std::array<float,2>{0.270534962f, 0.625387073f},
-std::array<float,2>{0.849526584f, 0.432233065f},
-std::array<float,2>{0.472664028f, 0.349057913f},
-std::array<float,2>{0.893021941f, 0.559137881f},
-std::array<float,2>{0.0635204092f, 0.97046423f},
-std::array<float,2>{0.693812251f, 0.0437616445f},
-std::array<float,2>{0.332517475f, 0.107031256f},
-std::array<float,2>{0.750035942f, 0.9193542f},
-std::array<float,2>{0.131078079f, 0.619743764f},
-std::array<float,2>{0.561044872f, 0.298142463f},
-std::array<float,2>{0.0538058504f, 0.473838627f},
-std::array<float,2>{0.631903887f, 0.746487916f},
-std::array<float,2>{0.430817395f, 0.778314531f},
-std::array<float,2>{0.980169892f, 0.133047149f},
-std::array<float,2>{0.0974464044f, 0.0244611409f},
-std::array<float,2>{0.734176159f, 0.946024954f},
-std::array<float,2>{0.467387527f, 0.505091667f},
-std::array<float,2>{0.914305449f, 0.325303942f},
-std::array<float,2>{0.309593707f, 0.375509679f},
-std::array<float,2>{0.839330196f, 0.670693874f},
-std::array<float,2>{0.230202571f, 0.83823663f},
-std::array<float,2>{0.564404547f, 0.1909931f},
-std::array<float,2>{0.395461231f, 0.182930186f},
-std::array<float,2>{0.939197063f, 0.798664927f},
-std::array<float,2>{0.0299638957f, 0.70904696f},
-std::array<float,2>{0.669126868f, 0.462181717f},
-std::array<float,2>{0.163298607f, 0.253831685f},
-std::array<float,2>{0.520596683f, 0.571221948f},
-std::array<float,2>{0.366948992f, 0.898810148f},
-std::array<float,2>{0.803085387f, 0.0880890489f},
-std::array<float,2>{0.222628117f, 0.0339922793f},
-std::array<float,2>{0.577289104f, 0.982068598f},
-std::array<float,2>{0.29779461f, 0.550632477f},
-std::array<float,2>{0.831249118f, 0.355600893f},
-std::array<float,2>{0.458649665f, 0.424400568f},
-std::array<float,2>{0.913666129f, 0.638872504f},
-std::array<float,2>{0.107635945f, 0.856619537f},
-std::array<float,2>{0.724739373f, 0.219578147f},
-std::array<float,2>{0.37403512f, 0.132533491f},
-std::array<float,2>{0.810947359f, 0.772143185f},
-std::array<float,2>{0.170499444f, 0.735240161f},
-std::array<float,2>{0.530076981f, 0.481467277f},
-std::array<float,2>{0.0169692691f, 0.312011182f},
-std::array<float,2>{0.663751125f, 0.614429295f},
-std::array<float,2>{0.403825074f, 0.909951806f},
-std::array<float,2>{0.952951252f, 0.100646175f},
-std::array<float,2>{0.0777026713f, 0.198467001f},
-std::array<float,2>{0.699889481f, 0.830938101f},
-std::array<float,2>{0.483959794f, 0.661429942f},
-std::array<float,2>{0.904633939f, 0.382907778f},
-std::array<float,2>{0.277115762f, 0.318845391f},
-std::array<float,2>{0.85326004f, 0.510255158f},
-std::array<float,2>{0.215080798f, 0.940879285f},
-std::array<float,2>{0.612618804f, 0.0212311447f},
-std::array<float,2>{0.429460078f, 0.0812941268f},
-std::array<float,2>{0.971075237f, 0.895042837f},
-std::array<float,2>{0.0605956875f, 0.563146889f},
-std::array<float,2>{0.633727491f, 0.26510486f},
-std::array<float,2>{0.138243288f, 0.460471034f},
-std::array<float,2>{0.554602027f, 0.716178358f},
-std::array<float,2>{0.340073764f, 0.809809268f},
-std::array<float,2>{0.762835205f, 0.177576721f},
-std::array<float,2>{0.183242708f, 0.166695669f},
-std::array<float,2>{0.508010209f, 0.788418412f},
-std::array<float,2>{0.359032422f, 0.696363151f},
-std::array<float,2>{0.784325063f, 0.451984406f},
-std::array<float,2>{0.376189977f, 0.267234981f},
-std::array<float,2>{0.963644326f, 0.587056398f},
-std::array<float,2>{0.0129958736f, 0.890485585f},
-std::array<float,2>{0.683654249f, 0.0693804771f},
-std::array<float,2>{0.295063525f, 0.014481415f},
-std::array<float,2>{0.812538862f, 0.963564098f},
-std::array<float,2>{0.246959105f, 0.522045076f},
-std::array<float,2>{0.589061439f, 0.339244813f},
-std::array<float,2>{0.118385881f, 0.406038791f},
-std::array<float,2>{0.740530789f, 0.675941586f},
-std::array<float,2>{0.445158303f, 0.827706158f},
-std::array<float,2>{0.937092364f, 0.216573104f},
-std::array<float,2>{0.0397520103f, 0.122212842f},
-std::array<float,2>{0.644097686f, 0.924065411f},
-std::array<float,2>{0.414724022f, 0.601346672f},
-std::array<float,2>{0.984491587f, 0.283572733f},
-std::array<float,2>{0.319999695f, 0.490407437f},
-std::array<float,2>{0.771474957f, 0.72652787f},
-std::array<float,2>{0.154654682f, 0.765170217f},
-std::array<float,2>{0.533818781f, 0.153154969f},
-std::array<float,2>{0.499972671f, 0.244467482f},
-std::array<float,2>{0.881190717f, 0.873403132f},
-std::array<float,2>{0.0852672011f, 0.652894735f},
-std::array<float,2>{0.718369842f, 0.417006612f},
-std::array<float,2>{0.20098716f, 0.360385388f},
-std::array<float,2>{0.598650038f, 0.535804391f},
-std::array<float,2>{0.261992335f, 0.993840814f},
-std::array<float,2>{0.864171624f, 0.0611522421f},
-std::array<float,2>{0.1352382f, 0.0474983305f},
-std::array<float,2>{0.548656404f, 0.990822375f},
-std::array<float,2>{0.338637561f, 0.544436455f},
-std::array<float,2>{0.759131312f, 0.371685356f},
-std::array<float,2>{0.425106913f, 0.407233238f},
-std::array<float,2>{0.976156652f, 0.645005941f},
-std::array<float,2>{0.0560665429f, 0.860081851f},
-std::array<float,2>{0.639830053f, 0.236571804f},
-std::array<float,2>{0.278253257f, 0.148059994f},
-std::array<float,2>{0.857266724f, 0.750689149f},
-std::array<float,2>{0.212420225f, 0.726933062f},
-std::array<float,2>{0.614262342f, 0.49379918f},
-std::array<float,2>{0.0737437084f, 0.295589894f},
-std::array<float,2>{0.696843922f, 0.608608186f},
-std::array<float,2>{0.47923395f, 0.93059212f},
-std::array<float,2>{0.900487423f, 0.110806704f},
-std::array<float,2>{0.022714695f, 0.204992935f},
-std::array<float,2>{0.656897247f, 0.820182681f},
-std::array<float,2>{0.399437547f, 0.686086833f},
-std::array<float,2>{0.948743582f, 0.392985523f},
-std::array<float,2>{0.367335349f, 0.335334122f},
-std::array<float,2>{0.806212604f, 0.524575651f},
-std::array<float,2>{0.166853711f, 0.957805812f},
-std::array<float,2>{0.52441889f, 0.00233867532f},
-std::array<float,2>{0.453668445f, 0.074357219f},
-std::array<float,2>{0.909614444f, 0.879004776f},
-std::array<float,2>{0.103135556f, 0.581628144f},
-std::array<float,2>{0.721114218f, 0.278903544f},
-std::array<float,2>{0.226256564f, 0.439136952f},
-std::array<float,2>{0.574017525f, 0.69082886f},
-std::array<float,2>{0.302904516f, 0.793326259f},
-std::array<float,2>{0.833975792f, 0.158417806f},
-std::array<float,2>{0.198656261f, 0.185345769f},
-std::array<float,2>{0.595144987f, 0.801680744f},
-std::array<float,2>{0.261499912f, 0.704934835f},
-std::array<float,2>{0.862633228f, 0.465671778f},
-std::array<float,2>{0.493805349f, 0.254529595f},
-std::array<float,2>{0.87716347f, 0.577892721f},
-std::array<float,2>{0.081593439f, 0.904225945f},
-std::array<float,2>{0.712899566f, 0.0910157263f},
-std::array<float,2>{0.314706892f, 0.0304764584f},
-std::array<float,2>{0.767899334f, 0.952102423f},
-std::array<float,2>{0.148809895f, 0.501566529f},
-std::array<float,2>{0.536065042f, 0.323945761f},
-std::array<float,2>{0.0430255048f, 0.378948003f},
-std::array<float,2>{0.645751357f, 0.665609658f},
-std::array<float,2>{0.421679616f, 0.84168452f},
-std::array<float,2>{0.988581836f, 0.194706529f},
-std::array<float,2>{0.124214895f, 0.104782805f},
-std::array<float,2>{0.73574543f, 0.91638273f},
-std::array<float,2>{0.439668417f, 0.62201184f},
-std::array<float,2>{0.9317711f, 0.302553475f},
-std::array<float,2>{0.291701674f, 0.470776826f},
-std::array<float,2>{0.817330837f, 0.74256438f},
-std::array<float,2>{0.244964629f, 0.77439183f},
-std::array<float,2>{0.593193591f, 0.140465036f},
-std::array<float,2>{0.382137448f, 0.229244292f},
-std::array<float,2>{0.966653883f, 0.847330511f},
-std::array<float,2>{0.00950188097f, 0.630077899f},
-std::array<float,2>{0.680931032f, 0.434173256f},
-std::array<float,2>{0.185470998f, 0.346017599f},
-std::array<float,2>{0.513632894f, 0.557135522f},
-std::array<float,2>{0.354747951f, 0.975775957f},
-std::array<float,2>{0.788587391f, 0.0403695479f},
-std::array<float,2>{0.235710427f, 0.0827657804f},
-std::array<float,2>{0.584460378f, 0.891673803f},
-std::array<float,2>{0.284530848f, 0.568676651f},
-std::array<float,2>{0.828056633f, 0.260261059f},
-std::array<float,2>{0.451823413f, 0.456023604f},
-std::array<float,2>{0.928551853f, 0.711084008f},
-std::array<float,2>{0.111164875f, 0.80621779f},
-std::array<float,2>{0.743285775f, 0.17398189f},
-std::array<float,2>{0.351066232f, 0.200853646f},
-std::array<float,2>{0.796452463f, 0.832905829f},
-std::array<float,2>{0.172640085f, 0.657975137f},
-std::array<float,2>{0.501542866f, 0.387120903f},
-std::array<float,2>{0.00202560914f, 0.313217849f},
-std::array<float,2>{0.675909638f, 0.513953865f},
-std::array<float,2>{0.388018131f, 0.945003033f},
-std::array<float,2>{0.95447135f, 0.0193585064f},
-std::array<float,2>{0.087321341f, 0.128268346f},
-std::array<float,2>{0.705207944f, 0.768542528f},
-std::array<float,2>{0.491655707f, 0.740789354f},
-std::array<float,2>{0.888736784f, 0.479699492f},
-std::array<float,2>{0.254443377f, 0.307112366f},
-std::array<float,2>{0.870530725f, 0.609869719f},
-std::array<float,2>{0.190156609f, 0.911502302f},
-std::array<float,2>{0.607522249f, 0.0959162191f},
-std::array<float,2>{0.410580337f, 0.0383537635f},
-std::array<float,2>{0.99471736f, 0.978680193f},
-std::array<float,2>{0.0377686433f, 0.551964223f},
-std::array<float,2>{0.651017427f, 0.354077041f},
-std::array<float,2>{0.145818114f, 0.42852205f},
-std::array<float,2>{0.540089071f, 0.63456893f},
-std::array<float,2>{0.326455027f, 0.852354825f},
-std::array<float,2>{0.779030383f, 0.225622505f},
-std::array<float,2>{0.159476578f, 0.247252569f},
-std::array<float,2>{0.516666651f, 0.869443536f},
-std::array<float,2>{0.360888749f, 0.650114775f},
-std::array<float,2>{0.796918392f, 0.420521915f},
-std::array<float,2>{0.393777341f, 0.367039859f},
-std::array<float,2>{0.942317665f, 0.534288108f},
-std::array<float,2>{0.0261514448f, 0.999841332f},
-std::array<float,2>{0.667405069f, 0.0573771559f},
-std::array<float,2>{0.307988375f, 0.118176021f},
-std::array<float,2>{0.840818822f, 0.92729038f},
-std::array<float,2>{0.234042242f, 0.597442806f},
-std::array<float,2>{0.569664657f, 0.287347019f},
-std::array<float,2>{0.098022759f, 0.485336602f},
-std::array<float,2>{0.727390707f, 0.719078898f},
-std::array<float,2>{0.464598864f, 0.757897139f},
-std::array<float,2>{0.920178473f, 0.150086284f},
-std::array<float,2>{0.0486075953f, 0.00845034979f},
-std::array<float,2>{0.62686342f, 0.968594074f},
-std::array<float,2>{0.433922976f, 0.516944349f},
-std::array<float,2>{0.981077433f, 0.342811316f},
-std::array<float,2>{0.33185637f, 0.398774326f},
-std::array<float,2>{0.756484985f, 0.675356567f},
-std::array<float,2>{0.12864317f, 0.820605755f},
-std::array<float,2>{0.557882905f, 0.213448092f},
-std::array<float,2>{0.471720278f, 0.171323687f},
-std::array<float,2>{0.897412181f, 0.781539917f},
-std::array<float,2>{0.0687502697f, 0.700724065f},
-std::array<float,2>{0.687514782f, 0.445687413f},
-std::array<float,2>{0.210394621f, 0.270710498f},
-std::array<float,2>{0.622505426f, 0.592696309f},
-std::array<float,2>{0.266852856f, 0.883405209f},
-std::array<float,2>{0.846540391f, 0.0646063164f},
-std::array<float,2>{0.17816101f, 0.116954826f},
-std::array<float,2>{0.504729688f, 0.934769869f},
-std::array<float,2>{0.347013444f, 0.601992667f},
-std::array<float,2>{0.789878845f, 0.290092081f},
-std::array<float,2>{0.383649796f, 0.49894619f},
-std::array<float,2>{0.960158825f, 0.730615854f},
-std::array<float,2>{0.00411234517f, 0.757020831f},
-std::array<float,2>{0.672029197f, 0.144432053f},
-std::array<float,2>{0.286298305f, 0.241211668f},
-std::array<float,2>{0.82055831f, 0.863786459f},
-std::array<float,2>{0.238427714f, 0.644457996f},
-std::array<float,2>{0.581500173f, 0.410651743f},
-std::array<float,2>{0.11445003f, 0.368324667f},
-std::array<float,2>{0.746647656f, 0.541486323f},
-std::array<float,2>{0.445457846f, 0.987763107f},
-std::array<float,2>{0.922551572f, 0.0524045005f},
-std::array<float,2>{0.031432718f, 0.162463143f},
-std::array<float,2>{0.653877914f, 0.79284209f},
-std::array<float,2>{0.408051074f, 0.692599654f},
-std::array<float,2>{0.998137593f, 0.444975883f},
-std::array<float,2>{0.323831886f, 0.273607552f},
-std::array<float,2>{0.773520887f, 0.585814536f},
-std::array<float,2>{0.14345932f, 0.876804411f},
-std::array<float,2>{0.545057833f, 0.0729824975f},
-std::array<float,2>{0.486090273f, 0.00483492436f},
-std::array<float,2>{0.88491255f, 0.955350161f},
-std::array<float,2>{0.0918943286f, 0.527855337f},
-std::array<float,2>{0.708737552f, 0.329449207f},
-std::array<float,2>{0.192109615f, 0.396703124f},
-std::array<float,2>{0.602152109f, 0.682462573f},
-std::array<float,2>{0.253421068f, 0.814963102f},
-std::array<float,2>{0.872769952f, 0.209999844f},
-std::array<float,2>{0.226816759f, 0.189386696f},
-std::array<float,2>{0.565387309f, 0.836581528f},
-std::array<float,2>{0.311180413f, 0.669323564f},
-std::array<float,2>{0.836079121f, 0.377308786f},
-std::array<float,2>{0.465492696f, 0.328086555f},
-std::array<float,2>{0.917893827f, 0.507393777f},
-std::array<float,2>{0.0953733996f, 0.947969675f},
-std::array<float,2>{0.732383668f, 0.025680609f},
-std::array<float,2>{0.364753664f, 0.0867287964f},
-std::array<float,2>{0.801484227f, 0.901246727f},
-std::array<float,2>{0.160289764f, 0.573298216f},
-std::array<float,2>{0.522751153f, 0.251408935f},
-std::array<float,2>{0.0277122948f, 0.46411711f},
-std::array<float,2>{0.670725942f, 0.707390666f},
-std::array<float,2>{0.398208618f, 0.799853683f},
-std::array<float,2>{0.940069377f, 0.180746332f},
-std::array<float,2>{0.0657408014f, 0.0460438356f},
-std::array<float,2>{0.692770243f, 0.971426904f},
-std::array<float,2>{0.474903882f, 0.560890913f},
-std::array<float,2>{0.891085863f, 0.349855959f},
-std::array<float,2>{0.273411423f, 0.431377649f},
-std::array<float,2>{0.850796998f, 0.627181709f},
-std::array<float,2>{0.203358278f, 0.850501895f},
-std::array<float,2>{0.618781447f, 0.230595291f},
-std::array<float,2>{0.433207273f, 0.13648434f},
-std::array<float,2>{0.977659523f, 0.779463649f},
-std::array<float,2>{0.0517015196f, 0.748994946f},
-std::array<float,2>{0.629781246f, 0.475795209f},
-std::array<float,2>{0.128947645f, 0.300255835f},
-std::array<float,2>{0.559398174f, 0.618879974f},
-std::array<float,2>{0.33589229f, 0.920672119f},
-std::array<float,2>{0.753793895f, 0.108068272f},
-std::array<float,2>{0.217993826f, 0.0230293628f},
-std::array<float,2>{0.610287368f, 0.938013613f},
-std::array<float,2>{0.27345404f, 0.508157372f},
-std::array<float,2>{0.855151355f, 0.318114132f},
-std::array<float,2>{0.482404977f, 0.385389894f},
-std::array<float,2>{0.903082907f, 0.662345707f},
-std::array<float,2>{0.0760833994f, 0.829085052f},
-std::array<float,2>{0.702252805f, 0.19646363f},
-std::array<float,2>{0.341797054f, 0.17889446f},
-std::array<float,2>{0.763715386f, 0.810656488f},
-std::array<float,2>{0.138902918f, 0.717909515f},
-std::array<float,2>{0.55266428f, 0.457535654f},
-std::array<float,2>{0.0601823106f, 0.262982965f},
-std::array<float,2>{0.636654854f, 0.566369355f},
-std::array<float,2>{0.427667558f, 0.897347212f},
-std::array<float,2>{0.969156086f, 0.078681007f},
-std::array<float,2>{0.105567612f, 0.221515357f},
-std::array<float,2>{0.72297442f, 0.857785165f},
-std::array<float,2>{0.460343987f, 0.637641788f},
-std::array<float,2>{0.912029505f, 0.42210868f},
-std::array<float,2>{0.299128503f, 0.357974887f},
-std::array<float,2>{0.83006078f, 0.548647523f},
-std::array<float,2>{0.219815075f, 0.984074295f},
-std::array<float,2>{0.575773597f, 0.032110773f},
-std::array<float,2>{0.405548632f, 0.0984057412f},
-std::array<float,2>{0.950981081f, 0.90772891f},
-std::array<float,2>{0.0176492054f, 0.615427792f},
-std::array<float,2>{0.660522759f, 0.308615118f},
-std::array<float,2>{0.168828771f, 0.483886003f},
-std::array<float,2>{0.528543293f, 0.736800849f},
-std::array<float,2>{0.371659875f, 0.770005703f},
-std::array<float,2>{0.808855951f, 0.128949985f},
-std::array<float,2>{0.152719915f, 0.155580908f},
-std::array<float,2>{0.533064842f, 0.763582289f},
-std::array<float,2>{0.317286968f, 0.7234869f},
-std::array<float,2>{0.772448301f, 0.490086704f},
-std::array<float,2>{0.416024327f, 0.282064915f},
-std::array<float,2>{0.986393869f, 0.599549472f},
-std::array<float,2>{0.0425618626f, 0.922654688f},
-std::array<float,2>{0.64093256f, 0.124819301f},
-std::array<float,2>{0.263998806f, 0.0596940853f},
-std::array<float,2>{0.866506517f, 0.995328605f},
-std::array<float,2>{0.20188196f, 0.538886964f},
-std::array<float,2>{0.59977895f, 0.362055898f},
-std::array<float,2>{0.0829035416f, 0.414604902f},
-std::array<float,2>{0.714979947f, 0.656158149f},
-std::array<float,2>{0.497673541f, 0.871364415f},
-std::array<float,2>{0.880823433f, 0.242361635f},
-std::array<float,2>{0.015610802f, 0.0678997785f},
-std::array<float,2>{0.687138438f, 0.88721174f},
-std::array<float,2>{0.377074659f, 0.588238657f},
-std::array<float,2>{0.962206066f, 0.268675834f},
-std::array<float,2>{0.35577774f, 0.450017869f},
-std::array<float,2>{0.782915235f, 0.698140323f},
-std::array<float,2>{0.180619836f, 0.786467731f},
-std::array<float,2>{0.511009991f, 0.165365741f},
-std::array<float,2>{0.441695958f, 0.218631178f},
-std::array<float,2>{0.934583247f, 0.82586664f},
-std::array<float,2>{0.119474582f, 0.679463685f},
-std::array<float,2>{0.738962591f, 0.402773947f},
-std::array<float,2>{0.249358073f, 0.337075084f},
-std::array<float,2>{0.587227166f, 0.520394266f},
-std::array<float,2>{0.293074757f, 0.961275756f},
-std::array<float,2>{0.816063583f, 0.0135385552f},
-std::array<float,2>{0.128015414f, 0.0104697356f},
-std::array<float,2>{0.558274925f, 0.966653705f},
-std::array<float,2>{0.331361324f, 0.518251717f},
-std::array<float,2>{0.756096244f, 0.340347886f},
-std::array<float,2>{0.43416217f, 0.401509613f},
-std::array<float,2>{0.980894089f, 0.672684789f},
-std::array<float,2>{0.0480444208f, 0.823853254f},
-std::array<float,2>{0.626435697f, 0.211678401f},
-std::array<float,2>{0.267326385f, 0.169821933f},
-std::array<float,2>{0.845975816f, 0.784725964f},
-std::array<float,2>{0.210706994f, 0.701373219f},
-std::array<float,2>{0.622837543f, 0.448167711f},
-std::array<float,2>{0.0688509941f, 0.271655858f},
-std::array<float,2>{0.688134909f, 0.591335058f},
-std::array<float,2>{0.472255021f, 0.885421216f},
-std::array<float,2>{0.896531403f, 0.0636436641f},
-std::array<float,2>{0.0255288444f, 0.248144284f},
-std::array<float,2>{0.667830288f, 0.868481398f},
-std::array<float,2>{0.394196212f, 0.651377022f},
-std::array<float,2>{0.941619754f, 0.418651849f},
-std::array<float,2>{0.360696256f, 0.364310592f},
-std::array<float,2>{0.797674477f, 0.532881141f},
-std::array<float,2>{0.159849137f, 0.997175992f},
-std::array<float,2>{0.517481744f, 0.0553480685f},
-std::array<float,2>{0.464335054f, 0.119295493f},
-std::array<float,2>{0.920613706f, 0.929413855f},
-std::array<float,2>{0.0984863862f, 0.594640911f},
-std::array<float,2>{0.726701677f, 0.285448462f},
-std::array<float,2>{0.233710438f, 0.487622499f},
-std::array<float,2>{0.569933593f, 0.722395897f},
-std::array<float,2>{0.308506966f, 0.761043668f},
-std::array<float,2>{0.840144575f, 0.151283741f},
-std::array<float,2>{0.189881966f, 0.126873836f},
-std::array<float,2>{0.608242691f, 0.767433345f},
-std::array<float,2>{0.253907084f, 0.739042222f},
-std::array<float,2>{0.871044457f, 0.478215218f},
-std::array<float,2>{0.492139429f, 0.305341721f},
-std::array<float,2>{0.889456213f, 0.613054752f},
-std::array<float,2>{0.0877103359f, 0.912135243f},
-std::array<float,2>{0.705589533f, 0.0954246596f},
-std::array<float,2>{0.327069074f, 0.0355405174f},
-std::array<float,2>{0.778400064f, 0.977523148f},
-std::array<float,2>{0.146466821f, 0.554680467f},
-std::array<float,2>{0.540705025f, 0.35317862f},
-std::array<float,2>{0.0374292508f, 0.425887764f},
-std::array<float,2>{0.650574982f, 0.63580972f},
-std::array<float,2>{0.41074425f, 0.855369151f},
-std::array<float,2>{0.994556248f, 0.223143041f},
-std::array<float,2>{0.110773601f, 0.0853475928f},
-std::array<float,2>{0.743856668f, 0.892664611f},
-std::array<float,2>{0.45119977f, 0.567941308f},
-std::array<float,2>{0.927988768f, 0.258183718f},
-std::array<float,2>{0.28512466f, 0.453138173f},
-std::array<float,2>{0.827288985f, 0.713822007f},
-std::array<float,2>{0.236090422f, 0.808362544f},
-std::array<float,2>{0.584667385f, 0.173284575f},
-std::array<float,2>{0.388472676f, 0.201950952f},
-std::array<float,2>{0.954683959f, 0.835812151f},
-std::array<float,2>{0.00249794684f, 0.659376204f},
-std::array<float,2>{0.67657882f, 0.390058011f},
-std::array<float,2>{0.171978936f, 0.314699709f},
-std::array<float,2>{0.501218379f, 0.512470484f},
-std::array<float,2>{0.351539761f, 0.942386985f},
-std::array<float,2>{0.795898736f, 0.017504273f},
-std::array<float,2>{0.24442865f, 0.103207022f},
-std::array<float,2>{0.593443513f, 0.914379299f},
-std::array<float,2>{0.291180611f, 0.623978436f},
-std::array<float,2>{0.816496074f, 0.302787185f},
-std::array<float,2>{0.44027859f, 0.468800426f},
-std::array<float,2>{0.932373047f, 0.744504154f},
-std::array<float,2>{0.124778159f, 0.775431335f},
-std::array<float,2>{0.736245453f, 0.137378946f},
-std::array<float,2>{0.355003357f, 0.227411836f},
-std::array<float,2>{0.788342893f, 0.845104635f},
-std::array<float,2>{0.184601486f, 0.631835341f},
-std::array<float,2>{0.512856543f, 0.435642481f},
-std::array<float,2>{0.00880435202f, 0.34453392f},
-std::array<float,2>{0.681228518f, 0.55475229f},
-std::array<float,2>{0.382636309f, 0.973424494f},
-std::array<float,2>{0.966131449f, 0.042299442f},
-std::array<float,2>{0.0814178959f, 0.186779082f},
-std::array<float,2>{0.713562369f, 0.803755939f},
-std::array<float,2>{0.493222684f, 0.706893265f},
-std::array<float,2>{0.87771368f, 0.467217624f},
-std::array<float,2>{0.261089444f, 0.256290197f},
-std::array<float,2>{0.862847269f, 0.575969338f},
-std::array<float,2>{0.198942259f, 0.905935764f},
-std::array<float,2>{0.595432818f, 0.0924807861f},
-std::array<float,2>{0.421047986f, 0.0274857078f},
-std::array<float,2>{0.989088476f, 0.950756609f},
-std::array<float,2>{0.0438815691f, 0.503382742f},
-std::array<float,2>{0.646437526f, 0.321218312f},
-std::array<float,2>{0.149131119f, 0.38136813f},
-std::array<float,2>{0.535404205f, 0.667919755f},
-std::array<float,2>{0.315080553f, 0.842859626f},
-std::array<float,2>{0.768074751f, 0.191961229f},
-std::array<float,2>{0.166349679f, 0.206665903f},
-std::array<float,2>{0.525210023f, 0.816826582f},
-std::array<float,2>{0.367999911f, 0.685038209f},
-std::array<float,2>{0.806071818f, 0.391740322f},
-std::array<float,2>{0.400191396f, 0.333797157f},
-std::array<float,2>{0.948578119f, 0.527279735f},
-std::array<float,2>{0.0233491659f, 0.96068275f},
-std::array<float,2>{0.656718254f, 0.000407367916f},
-std::array<float,2>{0.303664446f, 0.076805681f},
-std::array<float,2>{0.83332175f, 0.88140893f},
-std::array<float,2>{0.225891054f, 0.578523636f},
-std::array<float,2>{0.573563755f, 0.279990137f},
-std::array<float,2>{0.102824911f, 0.439461052f},
-std::array<float,2>{0.721664786f, 0.688570797f},
-std::array<float,2>{0.45350197f, 0.796775162f},
-std::array<float,2>{0.909753919f, 0.157315984f},
-std::array<float,2>{0.0565036535f, 0.0499557219f},
-std::array<float,2>{0.640225351f, 0.988755941f},
-std::array<float,2>{0.425587684f, 0.545484662f},
-std::array<float,2>{0.975765347f, 0.373676807f},
-std::array<float,2>{0.338239878f, 0.408264101f},
-std::array<float,2>{0.759403229f, 0.647936523f},
-std::array<float,2>{0.13526395f, 0.863001585f},
-std::array<float,2>{0.548198223f, 0.234534442f},
-std::array<float,2>{0.478674531f, 0.145220175f},
-std::array<float,2>{0.901091874f, 0.752394259f},
-std::array<float,2>{0.0733699873f, 0.729157448f},
-std::array<float,2>{0.696492314f, 0.494398862f},
-std::array<float,2>{0.212295488f, 0.294129938f},
-std::array<float,2>{0.615023673f, 0.606817544f},
-std::array<float,2>{0.277697563f, 0.932355464f},
-std::array<float,2>{0.856584132f, 0.112158813f},
-std::array<float,2>{0.179891959f, 0.0702603757f},
-std::array<float,2>{0.51132673f, 0.890114665f},
-std::array<float,2>{0.356022865f, 0.587666929f},
-std::array<float,2>{0.782365561f, 0.266705096f},
-std::array<float,2>{0.377919137f, 0.451179504f},
-std::array<float,2>{0.962650418f, 0.697244465f},
-std::array<float,2>{0.0148984715f, 0.788739741f},
-std::array<float,2>{0.686848223f, 0.16603595f},
-std::array<float,2>{0.293754995f, 0.216004491f},
-std::array<float,2>{0.815553606f, 0.827223361f},
-std::array<float,2>{0.249912053f, 0.676569879f},
-std::array<float,2>{0.587579131f, 0.405303091f},
-std::array<float,2>{0.119838871f, 0.33983472f},
-std::array<float,2>{0.738743603f, 0.521726966f},
-std::array<float,2>{0.441935718f, 0.963017225f},
-std::array<float,2>{0.935379267f, 0.0138565851f},
-std::array<float,2>{0.0420083813f, 0.152411386f},
-std::array<float,2>{0.641345322f, 0.764889717f},
-std::array<float,2>{0.416555643f, 0.725911379f},
-std::array<float,2>{0.98708421f, 0.490811229f},
-std::array<float,2>{0.316578865f, 0.283698916f},
-std::array<float,2>{0.771829665f, 0.600909054f},
-std::array<float,2>{0.152953893f, 0.924549401f},
-std::array<float,2>{0.532552958f, 0.123025253f},
-std::array<float,2>{0.497368664f, 0.061016757f},
-std::array<float,2>{0.880259335f, 0.993616998f},
-std::array<float,2>{0.082086727f, 0.53562814f},
-std::array<float,2>{0.715494752f, 0.360873759f},
-std::array<float,2>{0.201487958f, 0.417943567f},
-std::array<float,2>{0.600463331f, 0.652447522f},
-std::array<float,2>{0.264488637f, 0.873580396f},
-std::array<float,2>{0.867141426f, 0.244691655f},
-std::array<float,2>{0.220426694f, 0.219138801f},
-std::array<float,2>{0.575566292f, 0.856938601f},
-std::array<float,2>{0.299800932f, 0.639512718f},
-std::array<float,2>{0.829365015f, 0.423898399f},
-std::array<float,2>{0.460912168f, 0.355982155f},
-std::array<float,2>{0.911572337f, 0.550172806f},
-std::array<float,2>{0.10598211f, 0.981883287f},
-std::array<float,2>{0.723152876f, 0.0336224698f},
-std::array<float,2>{0.371127039f, 0.101253219f},
-std::array<float,2>{0.809517682f, 0.90938735f},
-std::array<float,2>{0.168434709f, 0.615125954f},
-std::array<float,2>{0.529149592f, 0.312353075f},
-std::array<float,2>{0.0180977564f, 0.482086986f},
-std::array<float,2>{0.660913825f, 0.734461367f},
-std::array<float,2>{0.406086892f, 0.771669924f},
-std::array<float,2>{0.950392783f, 0.132233873f},
-std::array<float,2>{0.0753396153f, 0.0209149495f},
-std::array<float,2>{0.703122973f, 0.941211879f},
-std::array<float,2>{0.481804639f, 0.51005429f},
-std::array<float,2>{0.902467728f, 0.319185883f},
-std::array<float,2>{0.274338007f, 0.383622259f},
-std::array<float,2>{0.854605258f, 0.661728323f},
-std::array<float,2>{0.218275592f, 0.83055532f},
-std::array<float,2>{0.609489381f, 0.199092209f},
-std::array<float,2>{0.426855505f, 0.17684342f},
-std::array<float,2>{0.969387949f, 0.810520172f},
-std::array<float,2>{0.059980955f, 0.716796279f},
-std::array<float,2>{0.635987282f, 0.460172296f},
-std::array<float,2>{0.139294609f, 0.265223473f},
-std::array<float,2>{0.552239299f, 0.562586308f},
-std::array<float,2>{0.342340231f, 0.89465034f},
-std::array<float,2>{0.764511824f, 0.0819817558f},
-std::array<float,2>{0.203701183f, 0.0433386639f},
-std::array<float,2>{0.618534565f, 0.969990909f},
-std::array<float,2>{0.272837073f, 0.55870378f},
-std::array<float,2>{0.851268828f, 0.349435061f},
-std::array<float,2>{0.475150406f, 0.431799591f},
-std::array<float,2>{0.891361475f, 0.625741065f},
-std::array<float,2>{0.0662264824f, 0.849327266f},
-std::array<float,2>{0.693267405f, 0.233376071f},
-std::array<float,2>{0.33540231f, 0.133418426f},
-std::array<float,2>{0.752949238f, 0.777544558f},
-std::array<float,2>{0.129878789f, 0.746981621f},
-std::array<float,2>{0.558715403f, 0.474231809f},
-std::array<float,2>{0.051138781f, 0.298560351f},
-std::array<float,2>{0.629374325f, 0.619627416f},
-std::array<float,2>{0.4329485f, 0.919798017f},
-std::array<float,2>{0.978052258f, 0.106829889f},
-std::array<float,2>{0.0952022672f, 0.190486372f},
-std::array<float,2>{0.731486559f, 0.838685393f},
-std::array<float,2>{0.464901626f, 0.670254409f},
-std::array<float,2>{0.917029202f, 0.375348866f},
-std::array<float,2>{0.310820222f, 0.326154411f},
-std::array<float,2>{0.836674333f, 0.50553441f},
-std::array<float,2>{0.227070406f, 0.945487201f},
-std::array<float,2>{0.564924955f, 0.025083648f},
-std::array<float,2>{0.397584587f, 0.08876618f},
-std::array<float,2>{0.939794838f, 0.899223268f},
-std::array<float,2>{0.0280235931f, 0.570346296f},
-std::array<float,2>{0.670332611f, 0.253339171f},
-std::array<float,2>{0.160854533f, 0.462733656f},
-std::array<float,2>{0.523179352f, 0.709866703f},
-std::array<float,2>{0.364581704f, 0.79822439f},
-std::array<float,2>{0.801023543f, 0.183217168f},
-std::array<float,2>{0.142949641f, 0.16179131f},
-std::array<float,2>{0.545689106f, 0.790736258f},
-std::array<float,2>{0.323455781f, 0.694516659f},
-std::array<float,2>{0.774062574f, 0.442687541f},
-std::array<float,2>{0.407563418f, 0.275703758f},
-std::array<float,2>{0.998842597f, 0.583351135f},
-std::array<float,2>{0.0318133458f, 0.878789485f},
-std::array<float,2>{0.653726876f, 0.0721210539f},
-std::array<float,2>{0.253201336f, 0.00605349708f},
-std::array<float,2>{0.87222451f, 0.954934955f},
-std::array<float,2>{0.191624776f, 0.530843318f},
-std::array<float,2>{0.601668119f, 0.331595302f},
-std::array<float,2>{0.09232416f, 0.396367043f},
-std::array<float,2>{0.708295465f, 0.680347323f},
-std::array<float,2>{0.485712618f, 0.814307749f},
-std::array<float,2>{0.885626853f, 0.208394468f},
-std::array<float,2>{0.00460625999f, 0.114420637f},
-std::array<float,2>{0.672603071f, 0.936302483f},
-std::array<float,2>{0.383138388f, 0.603791595f},
-std::array<float,2>{0.960478604f, 0.292525738f},
-std::array<float,2>{0.347282976f, 0.496337771f},
-std::array<float,2>{0.789118111f, 0.733644962f},
-std::array<float,2>{0.178601563f, 0.755379081f},
-std::array<float,2>{0.504275322f, 0.141672462f},
-std::array<float,2>{0.445805877f, 0.239001244f},
-std::array<float,2>{0.922311544f, 0.865528703f},
-std::array<float,2>{0.115080468f, 0.641879737f},
-std::array<float,2>{0.746189117f, 0.413348407f},
-std::array<float,2>{0.238979846f, 0.369603276f},
-std::array<float,2>{0.581648827f, 0.540950954f},
-std::array<float,2>{0.286846668f, 0.984722555f},
-std::array<float,2>{0.820877731f, 0.0529121943f},
-std::array<float,2>{0.156951636f, 0.0570241958f},
-std::array<float,2>{0.518558741f, 0.999376953f},
-std::array<float,2>{0.363068193f, 0.534964681f},
-std::array<float,2>{0.799238622f, 0.366421759f},
-std::array<float,2>{0.391731173f, 0.419950634f},
-std::array<float,2>{0.944201171f, 0.649527013f},
-std::array<float,2>{0.0248697232f, 0.869976878f},
-std::array<float,2>{0.665418267f, 0.248043865f},
-std::array<float,2>{0.306200117f, 0.149734184f},
-std::array<float,2>{0.842932165f, 0.758578956f},
-std::array<float,2>{0.232075602f, 0.719292462f},
-std::array<float,2>{0.566665947f, 0.484783143f},
-std::array<float,2>{0.0998002291f, 0.288000226f},
-std::array<float,2>{0.730358601f, 0.59701854f},
-std::array<float,2>{0.462651849f, 0.927215099f},
-std::array<float,2>{0.918719411f, 0.118681528f},
-std::array<float,2>{0.0496877469f, 0.213043496f},
-std::array<float,2>{0.628574193f, 0.821000159f},
-std::array<float,2>{0.436257958f, 0.674962699f},
-std::array<float,2>{0.983192265f, 0.399322331f},
-std::array<float,2>{0.329438746f, 0.343572557f},
-std::array<float,2>{0.754798949f, 0.517142892f},
-std::array<float,2>{0.126697466f, 0.968025446f},
-std::array<float,2>{0.555848718f, 0.00828393269f},
-std::array<float,2>{0.47022599f, 0.0650044903f},
-std::array<float,2>{0.895748079f, 0.882819235f},
-std::array<float,2>{0.0680248439f, 0.592234015f},
-std::array<float,2>{0.691196978f, 0.271381766f},
-std::array<float,2>{0.20732072f, 0.445904672f},
-std::array<float,2>{0.624881744f, 0.700418353f},
-std::array<float,2>{0.268804938f, 0.782181203f},
-std::array<float,2>{0.844749093f, 0.171413034f},
-std::array<float,2>{0.237564832f, 0.174467519f},
-std::array<float,2>{0.582875192f, 0.805941701f},
-std::array<float,2>{0.282625288f, 0.71189487f},
-std::array<float,2>{0.82574904f, 0.455495209f},
-std::array<float,2>{0.449707478f, 0.260221928f},
-std::array<float,2>{0.927350819f, 0.568987727f},
-std::array<float,2>{0.112636626f, 0.892562628f},
-std::array<float,2>{0.745666564f, 0.08209043f},
-std::array<float,2>{0.348718762f, 0.0188150201f},
-std::array<float,2>{0.793480814f, 0.944730341f},
-std::array<float,2>{0.174408257f, 0.514566422f},
-std::array<float,2>{0.503162861f, 0.312773645f},
-std::array<float,2>{0.000396438263f, 0.387592852f},
-std::array<float,2>{0.67955035f, 0.657389104f},
-std::array<float,2>{0.390505403f, 0.8323282f},
-std::array<float,2>{0.956638336f, 0.200592086f},
-std::array<float,2>{0.0879618749f, 0.0963360071f},
-std::array<float,2>{0.703639328f, 0.911843538f},
-std::array<float,2>{0.488532096f, 0.609615743f},
-std::array<float,2>{0.886835515f, 0.307297021f},
-std::array<float,2>{0.257728994f, 0.48033154f},
-std::array<float,2>{0.868046343f, 0.740678906f},
-std::array<float,2>{0.188141644f, 0.767862022f},
-std::array<float,2>{0.606337726f, 0.128882512f},
-std::array<float,2>{0.413341552f, 0.226168215f},
-std::array<float,2>{0.992337048f, 0.851898968f},
-std::array<float,2>{0.0367006361f, 0.634025455f},
-std::array<float,2>{0.64845866f, 0.42792955f},
-std::array<float,2>{0.147645906f, 0.353597999f},
-std::array<float,2>{0.541036129f, 0.55252701f},
-std::array<float,2>{0.32461068f, 0.979423761f},
-std::array<float,2>{0.780534208f, 0.0386820212f},
-std::array<float,2>{0.196957812f, 0.091380991f},
-std::array<float,2>{0.595957279f, 0.903594792f},
-std::array<float,2>{0.258179039f, 0.577614129f},
-std::array<float,2>{0.859761119f, 0.254257143f},
-std::array<float,2>{0.494864315f, 0.46527344f},
-std::array<float,2>{0.875868976f, 0.704308331f},
-std::array<float,2>{0.0795129389f, 0.800898314f},
-std::array<float,2>{0.711794794f, 0.184801638f},
-std::array<float,2>{0.312913001f, 0.195262536f},
-std::array<float,2>{0.767145574f, 0.84128511f},
-std::array<float,2>{0.150911257f, 0.665123403f},
-std::array<float,2>{0.537380338f, 0.379450142f},
-std::array<float,2>{0.045744963f, 0.323282212f},
-std::array<float,2>{0.647484243f, 0.501127183f},
-std::array<float,2>{0.418068469f, 0.951259196f},
-std::array<float,2>{0.992007673f, 0.031124454f},
-std::array<float,2>{0.122772805f, 0.13973321f},
-std::array<float,2>{0.738155127f, 0.773575127f},
-std::array<float,2>{0.43889007f, 0.74309063f},
-std::array<float,2>{0.930501759f, 0.471275747f},
-std::array<float,2>{0.289278656f, 0.302079052f},
-std::array<float,2>{0.818806648f, 0.621581852f},
-std::array<float,2>{0.242328078f, 0.916898549f},
-std::array<float,2>{0.591674685f, 0.10539002f},
-std::array<float,2>{0.378969729f, 0.0409944579f},
-std::array<float,2>{0.967348456f, 0.976420879f},
-std::array<float,2>{0.0110961217f, 0.556943655f},
-std::array<float,2>{0.68311727f, 0.34629494f},
-std::array<float,2>{0.187308848f, 0.43401283f},
-std::array<float,2>{0.514585078f, 0.630627215f},
-std::array<float,2>{0.352218717f, 0.846753478f},
-std::array<float,2>{0.785395384f, 0.228642091f},
-std::array<float,2>{0.132840842f, 0.237029508f},
-std::array<float,2>{0.549215376f, 0.859634817f},
-std::array<float,2>{0.33770445f, 0.645507216f},
-std::array<float,2>{0.76154083f, 0.407751858f},
-std::array<float,2>{0.422206521f, 0.371399373f},
-std::array<float,2>{0.973678946f, 0.544358432f},
-std::array<float,2>{0.0568543933f, 0.990582466f},
-std::array<float,2>{0.636877596f, 0.0470471382f},
-std::array<float,2>{0.279377133f, 0.110952675f},
-std::array<float,2>{0.857894838f, 0.929795742f},
-std::array<float,2>{0.213685527f, 0.609312475f},
-std::array<float,2>{0.615453482f, 0.295149267f},
-std::array<float,2>{0.0714095011f, 0.493331492f},
-std::array<float,2>{0.697341979f, 0.7273404f},
-std::array<float,2>{0.478225857f, 0.75032407f},
-std::array<float,2>{0.900238514f, 0.147904798f},
-std::array<float,2>{0.0212064814f, 0.00262506143f},
-std::array<float,2>{0.658488214f, 0.957184851f},
-std::array<float,2>{0.401498199f, 0.525108874f},
-std::array<float,2>{0.945976079f, 0.335458517f},
-std::array<float,2>{0.369397789f, 0.393471211f},
-std::array<float,2>{0.808268487f, 0.685832024f},
-std::array<float,2>{0.165471688f, 0.819452465f},
-std::array<float,2>{0.527073801f, 0.204163224f},
-std::array<float,2>{0.456873387f, 0.158881322f},
-std::array<float,2>{0.908165753f, 0.793814123f},
-std::array<float,2>{0.103862196f, 0.691218913f},
-std::array<float,2>{0.718867481f, 0.43871668f},
-std::array<float,2>{0.223616168f, 0.278361142f},
-std::array<float,2>{0.57202965f, 0.581111133f},
-std::array<float,2>{0.302287221f, 0.879399955f},
-std::array<float,2>{0.834029734f, 0.075075388f},
-std::array<float,2>{0.155214056f, 0.124239631f},
-std::array<float,2>{0.533637702f, 0.922266722f},
-std::array<float,2>{0.319514781f, 0.598902106f},
-std::array<float,2>{0.77071619f, 0.281604975f},
-std::array<float,2>{0.414231718f, 0.489711463f},
-std::array<float,2>{0.985268652f, 0.723046124f},
-std::array<float,2>{0.0395272523f, 0.763099432f},
-std::array<float,2>{0.643897533f, 0.155984253f},
-std::array<float,2>{0.262670547f, 0.242675975f},
-std::array<float,2>{0.863515735f, 0.872056901f},
-std::array<float,2>{0.200297982f, 0.65561676f},
-std::array<float,2>{0.599573255f, 0.414063662f},
-std::array<float,2>{0.0854701027f, 0.361357272f},
-std::array<float,2>{0.717983305f, 0.538265944f},
-std::array<float,2>{0.499191761f, 0.996085584f},
-std::array<float,2>{0.881749749f, 0.060304556f},
-std::array<float,2>{0.0132948784f, 0.165619761f},
-std::array<float,2>{0.684273422f, 0.786634684f},
-std::array<float,2>{0.376901388f, 0.697278142f},
-std::array<float,2>{0.962989986f, 0.4494479f},
-std::array<float,2>{0.358878016f, 0.269170016f},
-std::array<float,2>{0.784977138f, 0.588747919f},
-std::array<float,2>{0.182970062f, 0.887047231f},
-std::array<float,2>{0.508567333f, 0.067742832f},
-std::array<float,2>{0.444678128f, 0.0128160371f},
-std::array<float,2>{0.936957538f, 0.961503327f},
-std::array<float,2>{0.118986756f, 0.51985538f},
-std::array<float,2>{0.740726769f, 0.337544799f},
-std::array<float,2>{0.246284619f, 0.402975678f},
-std::array<float,2>{0.5897035f, 0.678914189f},
-std::array<float,2>{0.295795709f, 0.825196505f},
-std::array<float,2>{0.813040257f, 0.218033761f},
-std::array<float,2>{0.215375632f, 0.196868226f},
-std::array<float,2>{0.613246202f, 0.828412235f},
-std::array<float,2>{0.276478112f, 0.662917435f},
-std::array<float,2>{0.852775455f, 0.384945333f},
-std::array<float,2>{0.48373428f, 0.317459553f},
-std::array<float,2>{0.905143142f, 0.508559525f},
-std::array<float,2>{0.077253893f, 0.937981009f},
-std::array<float,2>{0.699240923f, 0.0224755593f},
-std::array<float,2>{0.340708703f, 0.0782948807f},
-std::array<float,2>{0.763371348f, 0.896706581f},
-std::array<float,2>{0.138161778f, 0.565720439f},
-std::array<float,2>{0.554104567f, 0.263319075f},
-std::array<float,2>{0.061325565f, 0.457473308f},
-std::array<float,2>{0.6331563f, 0.718278408f},
-std::array<float,2>{0.428889424f, 0.81144011f},
-std::array<float,2>{0.971511483f, 0.179461241f},
-std::array<float,2>{0.108138211f, 0.0313680768f},
-std::array<float,2>{0.725304186f, 0.983651936f},
-std::array<float,2>{0.45832473f, 0.548019946f},
-std::array<float,2>{0.913470626f, 0.357579917f},
-std::array<float,2>{0.297208816f, 0.422596872f},
-std::array<float,2>{0.831792831f, 0.637111783f},
-std::array<float,2>{0.221801594f, 0.858033001f},
-std::array<float,2>{0.577656269f, 0.220906377f},
-std::array<float,2>{0.403423369f, 0.129587486f},
-std::array<float,2>{0.952327669f, 0.770096421f},
-std::array<float,2>{0.0171313323f, 0.736830652f},
-std::array<float,2>{0.663224578f, 0.484144539f},
-std::array<float,2>{0.170201063f, 0.30932188f},
-std::array<float,2>{0.52943027f, 0.615872741f},
-std::array<float,2>{0.374646306f, 0.907669365f},
-std::array<float,2>{0.811298251f, 0.0980961025f},
-std::array<float,2>{0.229900301f, 0.0263448805f},
-std::array<float,2>{0.563668668f, 0.947722912f},
-std::array<float,2>{0.310191184f, 0.507114053f},
-std::array<float,2>{0.839695215f, 0.327234149f},
-std::array<float,2>{0.467180371f, 0.377458692f},
-std::array<float,2>{0.914566517f, 0.66956526f},
-std::array<float,2>{0.0971356407f, 0.836333156f},
-std::array<float,2>{0.733727038f, 0.188578799f},
-std::array<float,2>{0.366430223f, 0.181411326f},
-std::array<float,2>{0.803307354f, 0.800512671f},
-std::array<float,2>{0.163674042f, 0.70751977f},
-std::array<float,2>{0.52112639f, 0.464780897f},
-std::array<float,2>{0.0297092013f, 0.251648098f},
-std::array<float,2>{0.669752955f, 0.573921561f},
-std::array<float,2>{0.394814521f, 0.900472224f},
-std::array<float,2>{0.938860714f, 0.0862651914f},
-std::array<float,2>{0.0640389025f, 0.230984524f},
-std::array<float,2>{0.694293261f, 0.84962368f},
-std::array<float,2>{0.4732894f, 0.62775743f},
-std::array<float,2>{0.893216789f, 0.430759013f},
-std::array<float,2>{0.271107495f, 0.35056442f},
-std::array<float,2>{0.848796546f, 0.56149286f},
-std::array<float,2>{0.205723941f, 0.970844209f},
-std::array<float,2>{0.619815767f, 0.0467908755f},
-std::array<float,2>{0.431506962f, 0.107666939f},
-std::array<float,2>{0.97973454f, 0.920081377f},
-std::array<float,2>{0.0546313711f, 0.618575096f},
-std::array<float,2>{0.63239944f, 0.300720066f},
-std::array<float,2>{0.131773561f, 0.476351798f},
-std::array<float,2>{0.56065321f, 0.748356462f},
-std::array<float,2>{0.332728952f, 0.780216455f},
-std::array<float,2>{0.750773549f, 0.136155143f},
-std::array<float,2>{0.177267179f, 0.143821493f},
-std::array<float,2>{0.506896377f, 0.757780969f},
-std::array<float,2>{0.344870865f, 0.731204629f},
-std::array<float,2>{0.791419208f, 0.498287797f},
-std::array<float,2>{0.38643536f, 0.291004211f},
-std::array<float,2>{0.958778977f, 0.602214456f},
-std::array<float,2>{0.00614192802f, 0.935527623f},
-std::array<float,2>{0.675631106f, 0.116549894f},
-std::array<float,2>{0.289009988f, 0.0519495644f},
-std::array<float,2>{0.822307348f, 0.988273323f},
-std::array<float,2>{0.241402835f, 0.541851342f},
-std::array<float,2>{0.579869092f, 0.368652791f},
-std::array<float,2>{0.116611421f, 0.410605311f},
-std::array<float,2>{0.748341799f, 0.643593371f},
-std::array<float,2>{0.448815584f, 0.863561332f},
-std::array<float,2>{0.925116122f, 0.241923228f},
-std::array<float,2>{0.0345132276f, 0.0723899454f},
-std::array<float,2>{0.656219721f, 0.8762483f},
-std::array<float,2>{0.408658415f, 0.585090816f},
-std::array<float,2>{0.996214628f, 0.274058729f},
-std::array<float,2>{0.321422189f, 0.444486141f},
-std::array<float,2>{0.775951564f, 0.692934573f},
-std::array<float,2>{0.142154977f, 0.792419016f},
-std::array<float,2>{0.543883264f, 0.162743121f},
-std::array<float,2>{0.487305075f, 0.210696891f},
-std::array<float,2>{0.883396745f, 0.814704597f},
-std::array<float,2>{0.0907207429f, 0.681768894f},
-std::array<float,2>{0.710914075f, 0.397417367f},
-std::array<float,2>{0.193990141f, 0.329814136f},
-std::array<float,2>{0.603782892f, 0.5277493f},
-std::array<float,2>{0.251366436f, 0.955805779f},
-std::array<float,2>{0.874240637f, 0.00419885293f},
-std::array<float,2>{0.1751035f, 0.0156658515f},
-std::array<float,2>{0.502124369f, 0.941808462f},
-std::array<float,2>{0.348313004f, 0.513083935f},
-std::array<float,2>{0.794410288f, 0.315869123f},
-std::array<float,2>{0.389328122f, 0.388792187f},
-std::array<float,2>{0.955444753f, 0.65871346f},
-std::array<float,2>{0.00111350662f, 0.834697306f},
-std::array<float,2>{0.677904725f, 0.202953964f},
-std::array<float,2>{0.281759024f, 0.172623202f},
-std::array<float,2>{0.82423687f, 0.807121634f},
-std::array<float,2>{0.23692219f, 0.714784443f},
-std::array<float,2>{0.583763003f, 0.454825521f},
-std::array<float,2>{0.111717418f, 0.259311557f},
-std::array<float,2>{0.744954765f, 0.566927135f},
-std::array<float,2>{0.450379997f, 0.89396131f},
-std::array<float,2>{0.926207781f, 0.0842114016f},
-std::array<float,2>{0.0359554291f, 0.224067867f},
-std::array<float,2>{0.649537206f, 0.854298532f},
-std::array<float,2>{0.412707388f, 0.63564676f},
-std::array<float,2>{0.993972421f, 0.427005023f},
-std::array<float,2>{0.325683504f, 0.352395415f},
-std::array<float,2>{0.779490173f, 0.553148985f},
-std::array<float,2>{0.147095442f, 0.978344858f},
-std::array<float,2>{0.542747915f, 0.0361396596f},
-std::array<float,2>{0.490058541f, 0.0945978463f},
-std::array<float,2>{0.888125479f, 0.914051712f},
-std::array<float,2>{0.0893526748f, 0.612142563f},
-std::array<float,2>{0.704932094f, 0.306173414f},
-std::array<float,2>{0.189180374f, 0.476903826f},
-std::array<float,2>{0.606653988f, 0.739392996f},
-std::array<float,2>{0.255888939f, 0.766511381f},
-std::array<float,2>{0.86828649f, 0.125226602f},
-std::array<float,2>{0.230827332f, 0.152240068f},
-std::array<float,2>{0.567842543f, 0.760384262f},
-std::array<float,2>{0.305007577f, 0.721271276f},
-std::array<float,2>{0.842649579f, 0.486619532f},
-std::array<float,2>{0.461480141f, 0.286845446f},
-std::array<float,2>{0.919109344f, 0.595283508f},
-std::array<float,2>{0.100893736f, 0.928112984f},
-std::array<float,2>{0.729210913f, 0.120504469f},
-std::array<float,2>{0.361739099f, 0.0563453026f},
-std::array<float,2>{0.800566614f, 0.996277928f},
-std::array<float,2>{0.15794301f, 0.531708896f},
-std::array<float,2>{0.518139124f, 0.363899231f},
-std::array<float,2>{0.0236551668f, 0.419305801f},
-std::array<float,2>{0.664828002f, 0.65126276f},
-std::array<float,2>{0.390987456f, 0.867345631f},
-std::array<float,2>{0.944572628f, 0.249290124f},
-std::array<float,2>{0.0670350045f, 0.0628663078f},
-std::array<float,2>{0.6902318f, 0.886194944f},
-std::array<float,2>{0.468913317f, 0.589946449f},
-std::array<float,2>{0.894735217f, 0.272944421f},
-std::array<float,2>{0.26848951f, 0.448940098f},
-std::array<float,2>{0.84399277f, 0.702907801f},
-std::array<float,2>{0.20835422f, 0.783441365f},
-std::array<float,2>{0.623567939f, 0.168894023f},
-std::array<float,2>{0.43715179f, 0.212156147f},
-std::array<float,2>{0.984370828f, 0.82274729f},
-std::array<float,2>{0.0505728908f, 0.672897577f},
-std::array<float,2>{0.627640069f, 0.400674701f},
-std::array<float,2>{0.12567091f, 0.340830892f},
-std::array<float,2>{0.555468678f, 0.519006491f},
-std::array<float,2>{0.328447461f, 0.96526885f},
-std::array<float,2>{0.755560875f, 0.0114592565f},
-std::array<float,2>{0.214488551f, 0.113037519f},
-std::array<float,2>{0.616566122f, 0.932830393f},
-std::array<float,2>{0.280560762f, 0.606236815f},
-std::array<float,2>{0.858739495f, 0.293483734f},
-std::array<float,2>{0.476628751f, 0.495958477f},
-std::array<float,2>{0.899066567f, 0.730178952f},
-std::array<float,2>{0.0710302144f, 0.753712118f},
-std::array<float,2>{0.699194133f, 0.146329507f},
-std::array<float,2>{0.336324185f, 0.235835314f},
-std::array<float,2>{0.760633588f, 0.861698687f},
-std::array<float,2>{0.134012595f, 0.647016406f},
-std::array<float,2>{0.550442219f, 0.409275591f},
-std::array<float,2>{0.0583417751f, 0.374636203f},
-std::array<float,2>{0.638465047f, 0.546874404f},
-std::array<float,2>{0.423484623f, 0.989699781f},
-std::array<float,2>{0.973331392f, 0.0488603674f},
-std::array<float,2>{0.105455182f, 0.156503722f},
-std::array<float,2>{0.719979644f, 0.79507786f},
-std::array<float,2>{0.455294579f, 0.688299298f},
-std::array<float,2>{0.906496942f, 0.440955937f},
-std::array<float,2>{0.300911278f, 0.280884922f},
-std::array<float,2>{0.835210979f, 0.579685986f},
-std::array<float,2>{0.224449232f, 0.881965697f},
-std::array<float,2>{0.570943296f, 0.0780151412f},
-std::array<float,2>{0.400972188f, 0.00162639539f},
-std::array<float,2>{0.946312368f, 0.95933789f},
-std::array<float,2>{0.020153679f, 0.525956631f},
-std::array<float,2>{0.659188151f, 0.332282692f},
-std::array<float,2>{0.164725885f, 0.39076218f},
-std::array<float,2>{0.526207089f, 0.684526205f},
-std::array<float,2>{0.370543242f, 0.818236649f},
-std::array<float,2>{0.807014525f, 0.205128029f},
-std::array<float,2>{0.152125835f, 0.193020135f},
-std::array<float,2>{0.538545251f, 0.842416644f},
-std::array<float,2>{0.313709289f, 0.666415513f},
-std::array<float,2>{0.765994847f, 0.382110894f},
-std::array<float,2>{0.41955778f, 0.321375787f},
-std::array<float,2>{0.990290105f, 0.502611339f},
-std::array<float,2>{0.0467554294f, 0.949296594f},
-std::array<float,2>{0.647431552f, 0.0285883099f},
-std::array<float,2>{0.259260952f, 0.0928079784f},
-std::array<float,2>{0.860678434f, 0.905243099f},
-std::array<float,2>{0.195484027f, 0.575011432f},
-std::array<float,2>{0.596736908f, 0.257281482f},
-std::array<float,2>{0.078409344f, 0.468715698f},
-std::array<float,2>{0.712562859f, 0.705336332f},
-std::array<float,2>{0.495888829f, 0.803611994f},
-std::array<float,2>{0.876704037f, 0.186472759f},
-std::array<float,2>{0.0101825828f, 0.0413980149f},
-std::array<float,2>{0.682536304f, 0.97434622f},
-std::array<float,2>{0.380844593f, 0.556172252f},
-std::array<float,2>{0.968400061f, 0.345499158f},
-std::array<float,2>{0.353030324f, 0.43679437f},
-std::array<float,2>{0.786764979f, 0.631840706f},
-std::array<float,2>{0.185804129f, 0.844029844f},
-std::array<float,2>{0.515315592f, 0.227689117f},
-std::array<float,2>{0.438144445f, 0.138240322f},
-std::array<float,2>{0.930770159f, 0.776528299f},
-std::array<float,2>{0.121108688f, 0.74572897f},
-std::array<float,2>{0.737097859f, 0.469926178f},
-std::array<float,2>{0.244046926f, 0.303777277f},
-std::array<float,2>{0.590642214f, 0.624930382f},
-std::array<float,2>{0.290749848f, 0.915431499f},
-std::array<float,2>{0.819459736f, 0.102055401f},
-std::array<float,2>{0.137389287f, 0.0808483139f},
-std::array<float,2>{0.55285579f, 0.89619118f},
-std::array<float,2>{0.3416031f, 0.563902974f},
-std::array<float,2>{0.76225239f, 0.263981968f},
-std::array<float,2>{0.428380221f, 0.459522367f},
-std::array<float,2>{0.972080886f, 0.715337932f},
-std::array<float,2>{0.061762549f, 0.808903217f},
-std::array<float,2>{0.634407461f, 0.176133856f},
-std::array<float,2>{0.275399953f, 0.197836697f},
-std::array<float,2>{0.852317154f, 0.831571221f},
-std::array<float,2>{0.216691002f, 0.660784066f},
-std::array<float,2>{0.611988306f, 0.384580731f},
-std::array<float,2>{0.0768777356f, 0.320000291f},
-std::array<float,2>{0.700440466f, 0.510987222f},
-std::array<float,2>{0.483222932f, 0.939924538f},
-std::array<float,2>{0.905281246f, 0.0196418706f},
-std::array<float,2>{0.0160467979f, 0.130917802f},
-std::array<float,2>{0.66287148f, 0.773183763f},
-std::array<float,2>{0.402683139f, 0.73578018f},
-std::array<float,2>{0.952133954f, 0.480473727f},
-std::array<float,2>{0.373645067f, 0.310957372f},
-std::array<float,2>{0.811924517f, 0.613511682f},
-std::array<float,2>{0.171574652f, 0.908978224f},
-std::array<float,2>{0.530993819f, 0.10004691f},
-std::array<float,2>{0.457481861f, 0.0351404883f},
-std::array<float,2>{0.912827373f, 0.98128897f},
-std::array<float,2>{0.108655758f, 0.549314737f},
-std::array<float,2>{0.725629151f, 0.356728107f},
-std::array<float,2>{0.221159428f, 0.425711304f},
-std::array<float,2>{0.577127576f, 0.639935791f},
-std::array<float,2>{0.298220247f, 0.855670929f},
-std::array<float,2>{0.830377817f, 0.220199898f},
-std::array<float,2>{0.199425757f, 0.24523066f},
-std::array<float,2>{0.598040283f, 0.874646366f},
-std::array<float,2>{0.263624728f, 0.653505206f},
-std::array<float,2>{0.864987135f, 0.416158259f},
-std::array<float,2>{0.498977661f, 0.359861404f},
-std::array<float,2>{0.882470429f, 0.536394119f},
-std::array<float,2>{0.0842648596f, 0.992732465f},
-std::array<float,2>{0.717413306f, 0.0617947876f},
-std::array<float,2>{0.318841636f, 0.121325172f},
-std::array<float,2>{0.769595802f, 0.925061882f},
-std::array<float,2>{0.155428797f, 0.600290596f},
-std::array<float,2>{0.534996986f, 0.284850955f},
-std::array<float,2>{0.040132042f, 0.491661102f},
-std::array<float,2>{0.643393397f, 0.725551605f},
-std::array<float,2>{0.415875852f, 0.763912022f},
-std::array<float,2>{0.985416591f, 0.153819665f},
-std::array<float,2>{0.117329553f, 0.0152773047f},
-std::array<float,2>{0.742014289f, 0.964744151f},
-std::array<float,2>{0.443878263f, 0.522701919f},
-std::array<float,2>{0.936047971f, 0.338250518f},
-std::array<float,2>{0.296720982f, 0.405186862f},
-std::array<float,2>{0.813977659f, 0.677702248f},
-std::array<float,2>{0.247947693f, 0.826336682f},
-std::array<float,2>{0.588268995f, 0.215285614f},
-std::array<float,2>{0.375701398f, 0.167103857f},
-std::array<float,2>{0.964123666f, 0.787524283f},
-std::array<float,2>{0.0126403235f, 0.695818722f},
-std::array<float,2>{0.685075641f, 0.45269385f},
-std::array<float,2>{0.181971312f, 0.266062409f},
-std::array<float,2>{0.509157002f, 0.586849511f},
-std::array<float,2>{0.358231455f, 0.888736606f},
-std::array<float,2>{0.783367991f, 0.0687224641f},
-std::array<float,2>{0.240399063f, 0.0543741807f},
-std::array<float,2>{0.578178287f, 0.985387266f},
-std::array<float,2>{0.287575722f, 0.539098263f},
-std::array<float,2>{0.823763132f, 0.37052846f},
-std::array<float,2>{0.447691172f, 0.412751704f},
-std::array<float,2>{0.924263239f, 0.641030967f},
-std::array<float,2>{0.116157278f, 0.866569638f},
-std::array<float,2>{0.749305308f, 0.2400015f},
-std::array<float,2>{0.344548643f, 0.141485348f},
-std::array<float,2>{0.792723238f, 0.754772961f},
-std::array<float,2>{0.176591858f, 0.732496202f},
-std::array<float,2>{0.506157398f, 0.497906804f},
-std::array<float,2>{0.00698781339f, 0.291593254f},
-std::array<float,2>{0.67456609f, 0.604718089f},
-std::array<float,2>{0.38509801f, 0.936710179f},
-std::array<float,2>{0.957988918f, 0.113511726f},
-std::array<float,2>{0.0911943391f, 0.207795471f},
-std::array<float,2>{0.709811866f, 0.813161612f},
-std::array<float,2>{0.486864299f, 0.681335449f},
-std::array<float,2>{0.883861423f, 0.395434201f},
-std::array<float,2>{0.250062555f, 0.330739796f},
-std::array<float,2>{0.873521566f, 0.529385209f},
-std::array<float,2>{0.19504194f, 0.95372498f},
-std::array<float,2>{0.605244756f, 0.0074914149f},
-std::array<float,2>{0.409288108f, 0.0708254576f},
-std::array<float,2>{0.99774766f, 0.877195001f},
-std::array<float,2>{0.0337537378f, 0.582490802f},
-std::array<float,2>{0.654328287f, 0.276642859f},
-std::array<float,2>{0.140889779f, 0.441789865f},
-std::array<float,2>{0.544628441f, 0.694204807f},
-std::array<float,2>{0.321168244f, 0.789484143f},
-std::array<float,2>{0.776620209f, 0.160753593f},
-std::array<float,2>{0.162848815f, 0.182108119f},
-std::array<float,2>{0.519531846f, 0.797010362f},
-std::array<float,2>{0.365940779f, 0.710214734f},
-std::array<float,2>{0.803960085f, 0.461536884f},
-std::array<float,2>{0.395716697f, 0.252015948f},
-std::array<float,2>{0.938454032f, 0.571937382f},
-std::array<float,2>{0.0312435552f, 0.899613738f},
-std::array<float,2>{0.668427587f, 0.0892606154f},
-std::array<float,2>{0.308794171f, 0.0242011994f},
-std::array<float,2>{0.838067949f, 0.946920037f},
-std::array<float,2>{0.228523001f, 0.503943861f},
-std::array<float,2>{0.563217163f, 0.324961156f},
-std::array<float,2>{0.0959513485f, 0.376693755f},
-std::array<float,2>{0.733176649f, 0.671316504f},
-std::array<float,2>{0.468408287f, 0.83939606f},
-std::array<float,2>{0.915556848f, 0.190110311f},
-std::array<float,2>{0.0533063337f, 0.106144108f},
-std::array<float,2>{0.63099438f, 0.918091059f},
-std::array<float,2>{0.430271477f, 0.621036053f},
-std::array<float,2>{0.978918791f, 0.29741618f},
-std::array<float,2>{0.333871931f, 0.472827822f},
-std::array<float,2>{0.75195086f, 0.747622192f},
-std::array<float,2>{0.132060602f, 0.77859056f},
-std::array<float,2>{0.561947525f, 0.133817062f},
-std::array<float,2>{0.474147141f, 0.23349835f},
-std::array<float,2>{0.893829405f, 0.84798044f},
-std::array<float,2>{0.0631777272f, 0.626847923f},
-std::array<float,2>{0.69468683f, 0.432698369f},
-std::array<float,2>{0.206251815f, 0.348371089f},
-std::array<float,2>{0.620378017f, 0.559713304f},
-std::array<float,2>{0.269604206f, 0.969317079f},
-std::array<float,2>{0.847846091f, 0.0442036912f},
-std::array<float,2>{0.145425901f, 0.0379567668f},
-std::array<float,2>{0.539809465f, 0.979903579f},
-std::array<float,2>{0.327666163f, 0.551031828f},
-std::array<float,2>{0.778027594f, 0.354873091f},
-std::array<float,2>{0.411651611f, 0.428811282f},
-std::array<float,2>{0.995183587f, 0.633446157f},
-std::array<float,2>{0.0381202325f, 0.853295505f},
-std::array<float,2>{0.652230322f, 0.22477299f},
-std::array<float,2>{0.255121857f, 0.127499387f},
-std::array<float,2>{0.869217873f, 0.769068599f},
-std::array<float,2>{0.191154793f, 0.741485715f},
-std::array<float,2>{0.608630121f, 0.478718549f},
-std::array<float,2>{0.0864531994f, 0.308528155f},
-std::array<float,2>{0.706580222f, 0.610695779f},
-std::array<float,2>{0.491209328f, 0.911086619f},
-std::array<float,2>{0.890225112f, 0.0970681831f},
-std::array<float,2>{0.00308790919f, 0.199515209f},
-std::array<float,2>{0.676863492f, 0.833892405f},
-std::array<float,2>{0.387264997f, 0.657193363f},
-std::array<float,2>{0.953902066f, 0.387977868f},
-std::array<float,2>{0.350480795f, 0.313791424f},
-std::array<float,2>{0.795004606f, 0.515438914f},
-std::array<float,2>{0.173333645f, 0.944194734f},
-std::array<float,2>{0.50063324f, 0.0177516658f},
-std::array<float,2>{0.452708423f, 0.0830268562f},
-std::array<float,2>{0.929344773f, 0.890636623f},
-std::array<float,2>{0.109462783f, 0.569482803f},
-std::array<float,2>{0.74241066f, 0.260892957f},
-std::array<float,2>{0.234541968f, 0.456686229f},
-std::array<float,2>{0.585561275f, 0.712340951f},
-std::array<float,2>{0.283643782f, 0.805351555f},
-std::array<float,2>{0.826890171f, 0.175678864f},
-std::array<float,2>{0.209409609f, 0.170579523f},
-std::array<float,2>{0.621552169f, 0.783073843f},
-std::array<float,2>{0.266217858f, 0.699936271f},
-std::array<float,2>{0.846821129f, 0.447262436f},
-std::array<float,2>{0.470728308f, 0.270182341f},
-std::array<float,2>{0.897616923f, 0.592847168f},
-std::array<float,2>{0.0694465116f, 0.88448894f},
-std::array<float,2>{0.688920677f, 0.065526627f},
-std::array<float,2>{0.330225796f, 0.00919610169f},
-std::array<float,2>{0.757615209f, 0.967176676f},
-std::array<float,2>{0.127681106f, 0.516280651f},
-std::array<float,2>{0.556854904f, 0.342143238f},
-std::array<float,2>{0.0472005643f, 0.400106102f},
-std::array<float,2>{0.625647247f, 0.674127877f},
-std::array<float,2>{0.434732884f, 0.821903884f},
-std::array<float,2>{0.981541157f, 0.214476556f},
-std::array<float,2>{0.0995609239f, 0.117922917f},
-std::array<float,2>{0.728122234f, 0.926113963f},
-std::array<float,2>{0.463245511f, 0.596451163f},
-std::array<float,2>{0.920918763f, 0.288686126f},
-std::array<float,2>{0.306880265f, 0.485652447f},
-std::array<float,2>{0.840934694f, 0.719892144f},
-std::array<float,2>{0.2329804f, 0.759305954f},
-std::array<float,2>{0.568989158f, 0.148977801f},
-std::array<float,2>{0.393108189f, 0.246322349f},
-std::array<float,2>{0.943089902f, 0.870608032f},
-std::array<float,2>{0.0271656141f, 0.648873568f},
-std::array<float,2>{0.66653353f, 0.421459556f},
-std::array<float,2>{0.158646345f, 0.366092443f},
-std::array<float,2>{0.516407669f, 0.534133732f},
-std::array<float,2>{0.359997332f, 0.998282254f},
-std::array<float,2>{0.798791766f, 0.058050815f},
-std::array<float,2>{0.22544843f, 0.0754456222f},
-std::array<float,2>{0.573011339f, 0.879898369f},
-std::array<float,2>{0.304280967f, 0.58060348f},
-std::array<float,2>{0.832156956f, 0.278310776f},
-std::array<float,2>{0.454363108f, 0.438307405f},
-std::array<float,2>{0.908583224f, 0.690397084f},
-std::array<float,2>{0.102259763f, 0.794313371f},
-std::array<float,2>{0.722483695f, 0.159765333f},
-std::array<float,2>{0.36823827f, 0.204022825f},
-std::array<float,2>{0.805099249f, 0.818584681f},
-std::array<float,2>{0.167388082f, 0.686608791f},
-std::array<float,2>{0.524133623f, 0.393673033f},
-std::array<float,2>{0.0214899518f, 0.334160864f},
-std::array<float,2>{0.657549918f, 0.523878813f},
-std::array<float,2>{0.399283379f, 0.958844662f},
-std::array<float,2>{0.947640896f, 0.00322188996f},
-std::array<float,2>{0.0722894892f, 0.146931872f},
-std::array<float,2>{0.69559592f, 0.751841307f},
-std::array<float,2>{0.479505897f, 0.727705479f},
-std::array<float,2>{0.901529551f, 0.492724776f},
-std::array<float,2>{0.278501272f, 0.296863049f},
-std::array<float,2>{0.85550034f, 0.607910514f},
-std::array<float,2>{0.211267143f, 0.931245744f},
-std::array<float,2>{0.614019394f, 0.110314585f},
-std::array<float,2>{0.424580634f, 0.0480992943f},
-std::array<float,2>{0.975239754f, 0.991356552f},
-std::array<float,2>{0.0550934896f, 0.543793142f},
-std::array<float,2>{0.639497995f, 0.372116566f},
-std::array<float,2>{0.135879517f, 0.406714886f},
-std::array<float,2>{0.547365069f, 0.64621681f},
-std::array<float,2>{0.338895291f, 0.860448897f},
-std::array<float,2>{0.758400023f, 0.237541035f},
-std::array<float,2>{0.183995336f, 0.230444893f},
-std::array<float,2>{0.511758626f, 0.846443832f},
-std::array<float,2>{0.354236484f, 0.629451931f},
-std::array<float,2>{0.787311614f, 0.434802949f},
-std::array<float,2>{0.381810188f, 0.347039789f},
-std::array<float,2>{0.965396643f, 0.558342278f},
-std::array<float,2>{0.00791118108f, 0.974865377f},
-std::array<float,2>{0.68014729f, 0.0394955464f},
-std::array<float,2>{0.292416245f, 0.103621513f},
-std::array<float,2>{0.818230033f, 0.917953134f},
-std::array<float,2>{0.246033281f, 0.622759163f},
-std::array<float,2>{0.592028201f, 0.301712006f},
-std::array<float,2>{0.123336717f, 0.47192046f},
-std::array<float,2>{0.734748602f, 0.743825555f},
-std::array<float,2>{0.440854549f, 0.774992466f},
-std::array<float,2>{0.932778358f, 0.139645621f},
-std::array<float,2>{0.0449052751f, 0.0294815842f},
-std::array<float,2>{0.645370066f, 0.952937484f},
-std::array<float,2>{0.420008838f, 0.500340104f},
-std::array<float,2>{0.989379704f, 0.323003471f},
-std::array<float,2>{0.316256464f, 0.38053745f},
-std::array<float,2>{0.768572211f, 0.664921284f},
-std::array<float,2>{0.14970158f, 0.84012109f},
-std::array<float,2>{0.536458611f, 0.193699554f},
-std::array<float,2>{0.492728025f, 0.184384987f},
-std::array<float,2>{0.878691077f, 0.801970899f},
-std::array<float,2>{0.081005685f, 0.703922391f},
-std::array<float,2>{0.714390874f, 0.466706604f},
-std::array<float,2>{0.197404072f, 0.255619794f},
-std::array<float,2>{0.594699681f, 0.576853216f},
-std::array<float,2>{0.260362178f, 0.903219402f},
-std::array<float,2>{0.861768723f, 0.0904124826f},
-std::array<float,2>{0.169344619f, 0.0992620364f},
-std::array<float,2>{0.528234661f, 0.906429231f},
-std::array<float,2>{0.372757137f, 0.61683929f},
-std::array<float,2>{0.810280442f, 0.309951961f},
-std::array<float,2>{0.404925287f, 0.482867092f},
-std::array<float,2>{0.950128198f, 0.737926841f},
-std::array<float,2>{0.0186753441f, 0.771076858f},
-std::array<float,2>{0.661455393f, 0.130012199f},
-std::array<float,2>{0.300763965f, 0.22175388f},
-std::array<float,2>{0.829099059f, 0.859029472f},
-std::array<float,2>{0.219100505f, 0.637704909f},
-std::array<float,2>{0.575194299f, 0.423063755f},
-std::array<float,2>{0.106490664f, 0.358735621f},
-std::array<float,2>{0.724538088f, 0.547143877f},
-std::array<float,2>{0.459700882f, 0.982894897f},
-std::array<float,2>{0.910729766f, 0.032864593f},
-std::array<float,2>{0.05944103f, 0.177992672f},
-std::array<float,2>{0.635565817f, 0.81211096f},
-std::array<float,2>{0.426657587f, 0.717027962f},
-std::array<float,2>{0.970248461f, 0.458130717f},
-std::array<float,2>{0.34348309f, 0.262208581f},
-std::array<float,2>{0.76469624f, 0.564786434f},
-std::array<float,2>{0.14001897f, 0.897829533f},
-std::array<float,2>{0.551638663f, 0.0798806176f},
-std::array<float,2>{0.480788797f, 0.0216625426f},
-std::array<float,2>{0.904013157f, 0.938510001f},
-std::array<float,2>{0.0749066547f, 0.508851707f},
-std::array<float,2>{0.70169276f, 0.316609561f},
-std::array<float,2>{0.21739158f, 0.386698127f},
-std::array<float,2>{0.610978305f, 0.663704336f},
-std::array<float,2>{0.27478075f, 0.829182744f},
-std::array<float,2>{0.854174256f, 0.195666745f},
-std::array<float,2>{0.248430088f, 0.217199251f},
-std::array<float,2>{0.586703539f, 0.825058281f},
-std::array<float,2>{0.294086397f, 0.678370535f},
-std::array<float,2>{0.815184236f, 0.404142052f},
-std::array<float,2>{0.442744613f, 0.33623603f},
-std::array<float,2>{0.933681309f, 0.520525813f},
-std::array<float,2>{0.120326869f, 0.962299287f},
-std::array<float,2>{0.740222216f, 0.0124263661f},
-std::array<float,2>{0.357397377f, 0.0666333362f},
-std::array<float,2>{0.781437099f, 0.887782574f},
-std::array<float,2>{0.180855632f, 0.588881671f},
-std::array<float,2>{0.510137618f, 0.267761856f},
-std::array<float,2>{0.0139993904f, 0.450574696f},
-std::array<float,2>{0.685831726f, 0.699127018f},
-std::array<float,2>{0.378409922f, 0.785339773f},
-std::array<float,2>{0.96170336f, 0.16449751f},
-std::array<float,2>{0.0832115412f, 0.0588731393f},
-std::array<float,2>{0.716646254f, 0.994627774f},
-std::array<float,2>{0.496674716f, 0.537696242f},
-std::array<float,2>{0.879398584f, 0.362555325f},
-std::array<float,2>{0.264671534f, 0.415783405f},
-std::array<float,2>{0.865273535f, 0.654435277f},
-std::array<float,2>{0.202897698f, 0.872681856f},
-std::array<float,2>{0.600933075f, 0.24372226f},
-std::array<float,2>{0.417931408f, 0.154806733f},
-std::array<float,2>{0.987408519f, 0.761966407f},
-std::array<float,2>{0.0414246805f, 0.723705709f},
-std::array<float,2>{0.642280281f, 0.488886505f},
-std::array<float,2>{0.153599456f, 0.282384336f},
-std::array<float,2>{0.531743109f, 0.598421514f},
-std::array<float,2>{0.317859173f, 0.923203886f},
-std::array<float,2>{0.773315549f, 0.123386435f},
-std::array<float,2>{0.192404538f, 0.00584705779f},
-std::array<float,2>{0.602818668f, 0.95613116f},
-std::array<float,2>{0.252773315f, 0.528563738f},
-std::array<float,2>{0.871891439f, 0.32828632f},
-std::array<float,2>{0.484864622f, 0.398148358f},
-std::array<float,2>{0.886081576f, 0.683260918f},
-std::array<float,2>{0.0929529741f, 0.815441251f},
-std::array<float,2>{0.707150757f, 0.209564358f},
-std::array<float,2>{0.322286934f, 0.163255006f},
-std::array<float,2>{0.775028944f, 0.791466236f},
-std::array<float,2>{0.143651545f, 0.691850305f},
-std::array<float,2>{0.546566904f, 0.444096267f},
-std::array<float,2>{0.0326791257f, 0.274976254f},
-std::array<float,2>{0.653087497f, 0.584360301f},
-std::array<float,2>{0.407095581f, 0.875494838f},
-std::array<float,2>{0.999504328f, 0.0737042651f},
-std::array<float,2>{0.113980107f, 0.241182804f},
-std::array<float,2>{0.747769773f, 0.864748657f},
-std::array<float,2>{0.446485221f, 0.642919481f},
-std::array<float,2>{0.92342478f, 0.41178605f},
-std::array<float,2>{0.285815924f, 0.367367566f},
-std::array<float,2>{0.821898699f, 0.542630613f},
-std::array<float,2>{0.239450783f, 0.986498594f},
-std::array<float,2>{0.580119431f, 0.0511756055f},
-std::array<float,2>{0.384234756f, 0.115632936f},
-std::array<float,2>{0.959779859f, 0.933901846f},
-std::array<float,2>{0.00501243072f, 0.602715015f},
-std::array<float,2>{0.672976494f, 0.28912735f},
-std::array<float,2>{0.179089248f, 0.4995673f},
-std::array<float,2>{0.505114019f, 0.731474042f},
-std::array<float,2>{0.346382469f, 0.756543577f},
-std::array<float,2>{0.790646017f, 0.142706484f},
-std::array<float,2>{0.130062133f, 0.135173097f},
-std::array<float,2>{0.560280383f, 0.780608833f},
-std::array<float,2>{0.334352136f, 0.749816656f},
-std::array<float,2>{0.75260812f, 0.475285321f},
-std::array<float,2>{0.432115644f, 0.299057662f},
-std::array<float,2>{0.976911664f, 0.617766142f},
-std::array<float,2>{0.0520133898f, 0.92132175f},
-std::array<float,2>{0.630212486f, 0.109191783f},
-std::array<float,2>{0.271899998f, 0.0453938246f},
-std::array<float,2>{0.849720538f, 0.972313523f},
-std::array<float,2>{0.205059439f, 0.561731637f},
-std::array<float,2>{0.617773831f, 0.351466894f},
-std::array<float,2>{0.0650182143f, 0.429712683f},
-std::array<float,2>{0.692278326f, 0.628047705f},
-std::array<float,2>{0.476343483f, 0.851029992f},
-std::array<float,2>{0.892121017f, 0.231588513f},
-std::array<float,2>{0.0284440853f, 0.087085411f},
-std::array<float,2>{0.671624482f, 0.902151406f},
-std::array<float,2>{0.396559536f, 0.57238394f},
-std::array<float,2>{0.941273034f, 0.250511795f},
-std::array<float,2>{0.363866925f, 0.463334799f},
-std::array<float,2>{0.802494347f, 0.708438218f},
-std::array<float,2>{0.162075058f, 0.799537539f},
-std::array<float,2>{0.522372901f, 0.180617973f},
-std::array<float,2>{0.46640107f, 0.188369185f},
-std::array<float,2>{0.916401863f, 0.837667525f},
-std::array<float,2>{0.0945214257f, 0.668645859f},
-std::array<float,2>{0.73080796f, 0.377966911f},
-std::array<float,2>{0.227880612f, 0.326262772f},
-std::array<float,2>{0.565735221f, 0.506578982f},
-std::array<float,2>{0.311808318f, 0.948782146f},
-std::array<float,2>{0.837736368f, 0.0264390893f}}
\ No newline at end of file
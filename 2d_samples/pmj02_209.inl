@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.102749676f, 0.451601088f},
-std::array<float,2>{0.54032433f, 0.54366219f},
-std::array<float,2>{0.886810899f, 0.0462579913f},
-std::array<float,2>{0.486435622f, 0.998414636f},
-std::array<float,2>{0.286614448f, 0.158483714f},
-std::array<float,2>{0.825028419f, 0.776157975f},
-std::array<float,2>{0.632407546f, 0.255786151f},
-std::array<float,2>{0.174458221f, 0.66271764f},
-std::array<float,2>{0.411032438f, 0.360011071f},
-std::array<float,2>{0.938182592f, 0.731715024f},
-std::array<float,2>{0.582780242f, 0.24785614f},
-std::array<float,2>{0.00813189335f, 0.838935196f},
-std::array<float,2>{0.232775018f, 0.111199476f},
-std::array<float,2>{0.722719193f, 0.917982161f},
-std::array<float,2>{0.752879143f, 0.42514953f},
-std::array<float,2>{0.34620285f, 0.604897857f},
-std::array<float,2>{0.154975325f, 0.284089625f},
-std::array<float,2>{0.684036911f, 0.635260642f},
-std::array<float,2>{0.855451822f, 0.129995868f},
-std::array<float,2>{0.256017178f, 0.788167715f},
-std::array<float,2>{0.437510997f, 0.00248645665f},
-std::array<float,2>{0.929421723f, 0.945297122f},
-std::array<float,2>{0.523238063f, 0.489453346f},
-std::array<float,2>{0.0823372677f, 0.521297693f},
-std::array<float,2>{0.3379879f, 0.405661047f},
-std::array<float,2>{0.789065003f, 0.577861249f},
-std::array<float,2>{0.704006255f, 0.0859497115f},
-std::array<float,2>{0.218423322f, 0.884526074f},
-std::array<float,2>{0.0452397317f, 0.207669422f},
-std::array<float,2>{0.600713134f, 0.874655068f},
-std::array<float,2>{0.980337262f, 0.328731298f},
-std::array<float,2>{0.393452883f, 0.694051683f},
-std::array<float,2>{0.196065113f, 0.416821927f},
-std::array<float,2>{0.689516425f, 0.617106557f},
-std::array<float,2>{0.803188324f, 0.105131336f},
-std::array<float,2>{0.312540442f, 0.931810796f},
-std::array<float,2>{0.378326476f, 0.23346734f},
-std::array<float,2>{0.998762131f, 0.814302683f},
-std::array<float,2>{0.623486936f, 0.359073162f},
-std::array<float,2>{0.0619651712f, 0.742359996f},
-std::array<float,2>{0.27159521f, 0.275523037f},
-std::array<float,2>{0.862403631f, 0.677982152f},
-std::array<float,2>{0.66490519f, 0.185205385f},
-std::array<float,2>{0.128273308f, 0.762207508f},
-std::array<float,2>{0.0644042715f, 0.0532262474f},
-std::array<float,2>{0.500223458f, 0.976748705f},
-std::array<float,2>{0.909707606f, 0.457954407f},
-std::array<float,2>{0.458229423f, 0.549816966f},
-std::array<float,2>{0.0268072281f, 0.324356109f},
-std::array<float,2>{0.565377593f, 0.705879271f},
-std::array<float,2>{0.953475058f, 0.192491129f},
-std::array<float,2>{0.435976893f, 0.854545355f},
-std::array<float,2>{0.36681357f, 0.0697585568f},
-std::array<float,2>{0.768526673f, 0.892149329f},
-std::array<float,2>{0.743663073f, 0.39052698f},
-std::array<float,2>{0.24784857f, 0.582316577f},
-std::array<float,2>{0.475873917f, 0.47524935f},
-std::array<float,2>{0.906057537f, 0.5106197f},
-std::array<float,2>{0.562255979f, 0.0229135323f},
-std::array<float,2>{0.110647492f, 0.962404728f},
-std::array<float,2>{0.15943113f, 0.147533789f},
-std::array<float,2>{0.64389509f, 0.800258696f},
-std::array<float,2>{0.843156219f, 0.298093915f},
-std::array<float,2>{0.29764843f, 0.641092598f},
-std::array<float,2>{0.0537519231f, 0.379059821f},
-std::array<float,2>{0.609502912f, 0.590771556f},
-std::array<float,2>{0.989777863f, 0.073710978f},
-std::array<float,2>{0.383132517f, 0.900818884f},
-std::array<float,2>{0.321466714f, 0.201706693f},
-std::array<float,2>{0.811648846f, 0.847577095f},
-std::array<float,2>{0.698157668f, 0.316264719f},
-std::array<float,2>{0.189264238f, 0.71760565f},
-std::array<float,2>{0.461262822f, 0.309713989f},
-std::array<float,2>{0.917668283f, 0.649635792f},
-std::array<float,2>{0.514486611f, 0.151892871f},
-std::array<float,2>{0.0746095851f, 0.806998134f},
-std::array<float,2>{0.138128638f, 0.0302884225f},
-std::array<float,2>{0.658355713f, 0.959997535f},
-std::array<float,2>{0.867273688f, 0.478665501f},
-std::array<float,2>{0.280610114f, 0.500675201f},
-std::array<float,2>{0.237258568f, 0.349912614f},
-std::array<float,2>{0.734773338f, 0.740983129f},
-std::array<float,2>{0.781120956f, 0.224079788f},
-std::array<float,2>{0.371819764f, 0.821644843f},
-std::array<float,2>{0.427763641f, 0.0967852846f},
-std::array<float,2>{0.965872407f, 0.925862551f},
-std::array<float,2>{0.57128346f, 0.413000703f},
-std::array<float,2>{0.0206863284f, 0.621434331f},
-std::array<float,2>{0.307181835f, 0.462225258f},
-std::array<float,2>{0.828213215f, 0.557851672f},
-std::array<float,2>{0.655388236f, 0.0554604605f},
-std::array<float,2>{0.164800018f, 0.976459384f},
-std::array<float,2>{0.119358584f, 0.176048577f},
-std::array<float,2>{0.547943473f, 0.75152117f},
-std::array<float,2>{0.892944276f, 0.272217691f},
-std::array<float,2>{0.479055524f, 0.684722841f},
-std::array<float,2>{0.186798647f, 0.499887764f},
-std::array<float,2>{0.639829397f, 0.529313862f},
-std::array<float,2>{0.815453291f, 0.0085052317f},
-std::array<float,2>{0.293498635f, 0.948752046f},
-std::array<float,2>{0.494733334f, 0.133040309f},
-std::array<float,2>{0.875714362f, 0.789293408f},
-std::array<float,2>{0.53168118f, 0.293399721f},
-std::array<float,2>{0.0951118544f, 0.626848459f},
-std::array<float,2>{0.358813822f, 0.338196248f},
-std::array<float,2>{0.760108054f, 0.699247956f},
-std::array<float,2>{0.728306293f, 0.216068998f},
-std::array<float,2>{0.224310979f, 0.865158081f},
-std::array<float,2>{0.00215614564f, 0.0854358375f},
-std::array<float,2>{0.587426543f, 0.877937019f},
-std::array<float,2>{0.951250136f, 0.397951454f},
-std::array<float,2>{0.415384948f, 0.567964375f},
-std::array<float,2>{0.0867746398f, 0.258027613f},
-std::array<float,2>{0.527145088f, 0.666483641f},
-std::array<float,2>{0.931712091f, 0.169011414f},
-std::array<float,2>{0.452548146f, 0.773065209f},
-std::array<float,2>{0.26483494f, 0.031547606f},
-std::array<float,2>{0.845793366f, 0.987422049f},
-std::array<float,2>{0.673987389f, 0.442703575f},
-std::array<float,2>{0.141303644f, 0.534634531f},
-std::array<float,2>{0.398804039f, 0.433897674f},
-std::array<float,2>{0.975750089f, 0.59445703f},
-std::array<float,2>{0.609012485f, 0.117260054f},
-std::array<float,2>{0.0316745192f, 0.91140914f},
-std::array<float,2>{0.210230812f, 0.234977931f},
-std::array<float,2>{0.714538038f, 0.830320001f},
-std::array<float,2>{0.78526324f, 0.373888224f},
-std::array<float,2>{0.33543697f, 0.719726562f},
-std::array<float,2>{0.014062644f, 0.483526766f},
-std::array<float,2>{0.581342757f, 0.504434347f},
-std::array<float,2>{0.945116341f, 0.0234544594f},
-std::array<float,2>{0.406343728f, 0.953559697f},
-std::array<float,2>{0.348815918f, 0.15511702f},
-std::array<float,2>{0.755994439f, 0.810550928f},
-std::array<float,2>{0.721054912f, 0.306581199f},
-std::array<float,2>{0.229219258f, 0.654604435f},
-std::array<float,2>{0.489224315f, 0.318364769f},
-std::array<float,2>{0.882878244f, 0.713072419f},
-std::array<float,2>{0.543714166f, 0.199201956f},
-std::array<float,2>{0.108495809f, 0.849296808f},
-std::array<float,2>{0.176746324f, 0.0747724622f},
-std::array<float,2>{0.628003538f, 0.903363407f},
-std::array<float,2>{0.823936284f, 0.376428157f},
-std::array<float,2>{0.283264369f, 0.586043715f},
-std::array<float,2>{0.21328643f, 0.26682806f},
-std::array<float,2>{0.708172798f, 0.681048155f},
-std::array<float,2>{0.793590903f, 0.175135076f},
-std::array<float,2>{0.342273414f, 0.756485343f},
-std::array<float,2>{0.398156732f, 0.0611803681f},
-std::array<float,2>{0.982141852f, 0.970124006f},
-std::array<float,2>{0.595756769f, 0.466412991f},
-std::array<float,2>{0.0394452251f, 0.560793996f},
-std::array<float,2>{0.253598928f, 0.40735212f},
-std::array<float,2>{0.857203841f, 0.620345056f},
-std::array<float,2>{0.68171066f, 0.101479776f},
-std::array<float,2>{0.151341259f, 0.924654365f},
-std::array<float,2>{0.0790378228f, 0.221625566f},
-std::array<float,2>{0.516646385f, 0.826178968f},
-std::array<float,2>{0.925656974f, 0.346149206f},
-std::array<float,2>{0.444246709f, 0.738013804f},
-std::array<float,2>{0.1300859f, 0.393679291f},
-std::array<float,2>{0.668639779f, 0.563376963f},
-std::array<float,2>{0.864577353f, 0.0818725154f},
-std::array<float,2>{0.268747658f, 0.879818141f},
-std::array<float,2>{0.456335932f, 0.213321134f},
-std::array<float,2>{0.912015259f, 0.860955238f},
-std::array<float,2>{0.505010366f, 0.340807348f},
-std::array<float,2>{0.0670805573f, 0.697553098f},
-std::array<float,2>{0.319854349f, 0.292540789f},
-std::array<float,2>{0.799064517f, 0.632517397f},
-std::array<float,2>{0.692110062f, 0.138018087f},
-std::array<float,2>{0.202741534f, 0.795665026f},
-std::array<float,2>{0.0570895188f, 0.013315212f},
-std::array<float,2>{0.617692292f, 0.95113188f},
-std::array<float,2>{0.993408978f, 0.49417004f},
-std::array<float,2>{0.380464196f, 0.52651608f},
-std::array<float,2>{0.116406344f, 0.36995703f},
-std::array<float,2>{0.555967748f, 0.724685729f},
-std::array<float,2>{0.900066912f, 0.2405826f},
-std::array<float,2>{0.469209701f, 0.833566844f},
-std::array<float,2>{0.301293463f, 0.12123172f},
-std::array<float,2>{0.838828981f, 0.908993483f},
-std::array<float,2>{0.645750046f, 0.433350086f},
-std::array<float,2>{0.163909823f, 0.597875535f},
-std::array<float,2>{0.432923287f, 0.438975155f},
-std::array<float,2>{0.960629642f, 0.536097765f},
-std::array<float,2>{0.568075001f, 0.0376469567f},
-std::array<float,2>{0.0297903791f, 0.990273416f},
-std::array<float,2>{0.244652584f, 0.165079519f},
-std::array<float,2>{0.748651326f, 0.766083062f},
-std::array<float,2>{0.772024214f, 0.26204735f},
-std::array<float,2>{0.360242695f, 0.669058621f},
-std::array<float,2>{0.0741783753f, 0.427209288f},
-std::array<float,2>{0.508926034f, 0.608525097f},
-std::array<float,2>{0.919205785f, 0.115421593f},
-std::array<float,2>{0.468240082f, 0.917120874f},
-std::array<float,2>{0.273941755f, 0.244853288f},
-std::array<float,2>{0.873652518f, 0.842184246f},
-std::array<float,2>{0.662471712f, 0.364363343f},
-std::array<float,2>{0.133631185f, 0.729679048f},
-std::array<float,2>{0.388688147f, 0.251811773f},
-std::array<float,2>{0.987701237f, 0.658596277f},
-std::array<float,2>{0.613926172f, 0.162371457f},
-std::array<float,2>{0.0469475761f, 0.779601634f},
-std::array<float,2>{0.191534668f, 0.0406148359f},
-std::array<float,2>{0.701910496f, 0.992701113f},
-std::array<float,2>{0.80828172f, 0.448908031f},
-std::array<float,2>{0.328081995f, 0.540102661f},
-std::array<float,2>{0.16817449f, 0.333572209f},
-std::array<float,2>{0.651202679f, 0.68967092f},
-std::array<float,2>{0.832927406f, 0.203224123f},
-std::array<float,2>{0.311635494f, 0.869415045f},
-std::array<float,2>{0.480691075f, 0.0913796499f},
-std::array<float,2>{0.897177517f, 0.88880074f},
-std::array<float,2>{0.551466048f, 0.401194155f},
-std::array<float,2>{0.122997575f, 0.571181595f},
-std::array<float,2>{0.368208945f, 0.48753044f},
-std::array<float,2>{0.776866615f, 0.519522309f},
-std::array<float,2>{0.739422083f, 0.00516964449f},
-std::array<float,2>{0.240362644f, 0.938203394f},
-std::array<float,2>{0.0174670145f, 0.128780574f},
-std::array<float,2>{0.575109184f, 0.78421545f},
-std::array<float,2>{0.96444869f, 0.28645277f},
-std::array<float,2>{0.423489898f, 0.63965261f},
-std::array<float,2>{0.222043782f, 0.453194976f},
-std::array<float,2>{0.73055166f, 0.550884843f},
-std::array<float,2>{0.762715101f, 0.0498718619f},
-std::array<float,2>{0.354420543f, 0.98125726f},
-std::array<float,2>{0.421799213f, 0.181048334f},
-std::array<float,2>{0.946946383f, 0.758075893f},
-std::array<float,2>{0.59122467f, 0.280421644f},
-std::array<float,2>{0.00665906165f, 0.674577057f},
-std::array<float,2>{0.290762633f, 0.351856053f},
-std::array<float,2>{0.820015311f, 0.746115267f},
-std::array<float,2>{0.633407831f, 0.228874654f},
-std::array<float,2>{0.180021703f, 0.817870021f},
-std::array<float,2>{0.0995196477f, 0.106094636f},
-std::array<float,2>{0.538588703f, 0.936887503f},
-std::array<float,2>{0.882490098f, 0.421784133f},
-std::array<float,2>{0.498560429f, 0.613019228f},
-std::array<float,2>{0.0379752815f, 0.304276526f},
-std::array<float,2>{0.60473752f, 0.644805729f},
-std::array<float,2>{0.971278727f, 0.141794577f},
-std::array<float,2>{0.404906392f, 0.804545283f},
-std::array<float,2>{0.328834325f, 0.0161491092f},
-std::array<float,2>{0.783775151f, 0.96590817f},
-std::array<float,2>{0.716977119f, 0.46983096f},
-std::array<float,2>{0.205761611f, 0.515015781f},
-std::array<float,2>{0.446272314f, 0.385034055f},
-std::array<float,2>{0.933718741f, 0.579771996f},
-std::array<float,2>{0.530336916f, 0.0625445098f},
-std::array<float,2>{0.093456693f, 0.897175133f},
-std::array<float,2>{0.147592694f, 0.189748302f},
-std::array<float,2>{0.677201509f, 0.856923997f},
-std::array<float,2>{0.848187864f, 0.320790052f},
-std::array<float,2>{0.258243918f, 0.710438669f},
-std::array<float,2>{0.0852396935f, 0.49027589f},
-std::array<float,2>{0.519656062f, 0.52198565f},
-std::array<float,2>{0.926908791f, 0.000315218931f},
-std::array<float,2>{0.44007352f, 0.942966521f},
-std::array<float,2>{0.255259603f, 0.132377192f},
-std::array<float,2>{0.85211724f, 0.785791397f},
-std::array<float,2>{0.686079323f, 0.282978475f},
-std::array<float,2>{0.153531566f, 0.632834971f},
-std::array<float,2>{0.391839296f, 0.331420243f},
-std::array<float,2>{0.9771474f, 0.691751897f},
-std::array<float,2>{0.598136425f, 0.210229084f},
-std::array<float,2>{0.0448328182f, 0.872112513f},
-std::array<float,2>{0.216549978f, 0.0882868916f},
-std::array<float,2>{0.705188572f, 0.884869158f},
-std::array<float,2>{0.792447746f, 0.403888762f},
-std::array<float,2>{0.336855382f, 0.575298548f},
-std::array<float,2>{0.172145188f, 0.256802022f},
-std::array<float,2>{0.63047868f, 0.660952747f},
-std::array<float,2>{0.826210141f, 0.157742441f},
-std::array<float,2>{0.288965404f, 0.775215268f},
-std::array<float,2>{0.484729409f, 0.0440161303f},
-std::array<float,2>{0.890057266f, 0.997624338f},
-std::array<float,2>{0.541639149f, 0.45019418f},
-std::array<float,2>{0.104890116f, 0.546161473f},
-std::array<float,2>{0.344944686f, 0.42234832f},
-std::array<float,2>{0.750224769f, 0.601599634f},
-std::array<float,2>{0.725337505f, 0.112104021f},
-std::array<float,2>{0.230718151f, 0.920915246f},
-std::array<float,2>{0.00993131287f, 0.248729661f},
-std::array<float,2>{0.584859788f, 0.836338639f},
-std::array<float,2>{0.941382766f, 0.361585081f},
-std::array<float,2>{0.413977981f, 0.733898222f},
-std::array<float,2>{0.248341322f, 0.386977673f},
-std::array<float,2>{0.745540798f, 0.584875464f},
-std::array<float,2>{0.767436624f, 0.0667498037f},
-std::array<float,2>{0.363777518f, 0.893771172f},
-std::array<float,2>{0.433789551f, 0.194225103f},
-std::array<float,2>{0.956786633f, 0.852314472f},
-std::array<float,2>{0.563012123f, 0.327284038f},
-std::array<float,2>{0.0246793944f, 0.70474714f},
-std::array<float,2>{0.299054474f, 0.298903167f},
-std::array<float,2>{0.840878546f, 0.642814517f},
-std::array<float,2>{0.642523527f, 0.14579612f},
-std::array<float,2>{0.157099038f, 0.797022462f},
-std::array<float,2>{0.113233946f, 0.021182565f},
-std::array<float,2>{0.559732497f, 0.963386536f},
-std::array<float,2>{0.903999925f, 0.474478036f},
-std::array<float,2>{0.473786354f, 0.508053601f},
-std::array<float,2>{0.060439799f, 0.356826276f},
-std::array<float,2>{0.621996462f, 0.745542109f},
-std::array<float,2>{0.997249782f, 0.231964231f},
-std::array<float,2>{0.375255853f, 0.815541327f},
-std::array<float,2>{0.316019595f, 0.101812646f},
-std::array<float,2>{0.802283823f, 0.930414677f},
-std::array<float,2>{0.688964188f, 0.415842712f},
-std::array<float,2>{0.198293507f, 0.613815486f},
-std::array<float,2>{0.459800929f, 0.46045512f},
-std::array<float,2>{0.907009423f, 0.547219455f},
-std::array<float,2>{0.503727555f, 0.0513428487f},
-std::array<float,2>{0.0659740493f, 0.979186356f},
-std::array<float,2>{0.125838935f, 0.186753795f},
-std::array<float,2>{0.667669296f, 0.763967872f},
-std::array<float,2>{0.85994935f, 0.273775846f},
-std::array<float,2>{0.270918727f, 0.676580966f},
-std::array<float,2>{0.0218482949f, 0.410869837f},
-std::array<float,2>{0.573078394f, 0.623114467f},
-std::array<float,2>{0.967706025f, 0.0951544419f},
-std::array<float,2>{0.426886052f, 0.927933633f},
-std::array<float,2>{0.37423408f, 0.226215944f},
-std::array<float,2>{0.777643025f, 0.822903752f},
-std::array<float,2>{0.737946689f, 0.347958922f},
-std::array<float,2>{0.235876873f, 0.739921689f},
-std::array<float,2>{0.47726056f, 0.271090329f},
-std::array<float,2>{0.890760779f, 0.685741186f},
-std::array<float,2>{0.550059915f, 0.179416135f},
-std::array<float,2>{0.118508443f, 0.752197385f},
-std::array<float,2>{0.166634083f, 0.0571600236f},
-std::array<float,2>{0.653624177f, 0.973850608f},
-std::array<float,2>{0.831643105f, 0.464110315f},
-std::array<float,2>{0.304834813f, 0.555109203f},
-std::array<float,2>{0.189604387f, 0.314112604f},
-std::array<float,2>{0.697216451f, 0.716394186f},
-std::array<float,2>{0.809568703f, 0.200492799f},
-std::array<float,2>{0.323699772f, 0.843823254f},
-std::array<float,2>{0.386382371f, 0.0708769187f},
-std::array<float,2>{0.991242468f, 0.899338841f},
-std::array<float,2>{0.612028599f, 0.382429957f},
-std::array<float,2>{0.0526519306f, 0.592476368f},
-std::array<float,2>{0.278328776f, 0.476803005f},
-std::array<float,2>{0.869933665f, 0.502638578f},
-std::array<float,2>{0.656709373f, 0.0284467358f},
-std::array<float,2>{0.139496967f, 0.958331108f},
-std::array<float,2>{0.0777051225f, 0.149237812f},
-std::array<float,2>{0.512741566f, 0.805262983f},
-std::array<float,2>{0.915963829f, 0.31148079f},
-std::array<float,2>{0.463987648f, 0.651570022f},
-std::array<float,2>{0.143220186f, 0.443918288f},
-std::array<float,2>{0.672371626f, 0.532193184f},
-std::array<float,2>{0.845021188f, 0.0349639244f},
-std::array<float,2>{0.261840671f, 0.986235738f},
-std::array<float,2>{0.450535953f, 0.170608997f},
-std::array<float,2>{0.930515707f, 0.769646525f},
-std::array<float,2>{0.524426877f, 0.261053383f},
-std::array<float,2>{0.0884227753f, 0.664721489f},
-std::array<float,2>{0.332647473f, 0.371794432f},
-std::array<float,2>{0.787836492f, 0.721182048f},
-std::array<float,2>{0.712766826f, 0.23811847f},
-std::array<float,2>{0.208165541f, 0.82971555f},
-std::array<float,2>{0.0349043421f, 0.120681621f},
-std::array<float,2>{0.606382072f, 0.91283232f},
-std::array<float,2>{0.974041402f, 0.435890198f},
-std::array<float,2>{0.401045382f, 0.596508622f},
-std::array<float,2>{0.0964437798f, 0.295749098f},
-std::array<float,2>{0.534896374f, 0.628319323f},
-std::array<float,2>{0.878159165f, 0.135316581f},
-std::array<float,2>{0.492246389f, 0.791952431f},
-std::array<float,2>{0.295640409f, 0.0102918101f},
-std::array<float,2>{0.813998997f, 0.946879447f},
-std::array<float,2>{0.638302863f, 0.496654093f},
-std::array<float,2>{0.18510589f, 0.529201806f},
-std::array<float,2>{0.417309374f, 0.394704372f},
-std::array<float,2>{0.949539721f, 0.568836153f},
-std::array<float,2>{0.588015497f, 0.0830823556f},
-std::array<float,2>{0.000348643604f, 0.875588715f},
-std::array<float,2>{0.224804372f, 0.218465462f},
-std::array<float,2>{0.730332613f, 0.865953743f},
-std::array<float,2>{0.757820427f, 0.337226689f},
-std::array<float,2>{0.357061446f, 0.701544166f},
-std::array<float,2>{0.0418695658f, 0.467265099f},
-std::array<float,2>{0.594988704f, 0.559954882f},
-std::array<float,2>{0.984051228f, 0.0601907633f},
-std::array<float,2>{0.395950019f, 0.972524345f},
-std::array<float,2>{0.340138823f, 0.172670349f},
-std::array<float,2>{0.795087337f, 0.755025506f},
-std::array<float,2>{0.710486233f, 0.26821956f},
-std::array<float,2>{0.212655917f, 0.68231082f},
-std::array<float,2>{0.441744953f, 0.344243288f},
-std::array<float,2>{0.922656536f, 0.735340774f},
-std::array<float,2>{0.518661141f, 0.219724312f},
-std::array<float,2>{0.0807441399f, 0.82596606f},
-std::array<float,2>{0.149020657f, 0.0977533534f},
-std::array<float,2>{0.680103362f, 0.92349267f},
-std::array<float,2>{0.858009279f, 0.408617258f},
-std::array<float,2>{0.251396418f, 0.61775136f},
-std::array<float,2>{0.228230506f, 0.307321817f},
-std::array<float,2>{0.71991396f, 0.652673244f},
-std::array<float,2>{0.75451231f, 0.152969643f},
-std::array<float,2>{0.350068539f, 0.809726477f},
-std::array<float,2>{0.408679366f, 0.0267625246f},
-std::array<float,2>{0.942845702f, 0.955173314f},
-std::array<float,2>{0.578264654f, 0.480524629f},
-std::array<float,2>{0.013564731f, 0.507302821f},
-std::array<float,2>{0.281311542f, 0.377720922f},
-std::array<float,2>{0.821370602f, 0.587973177f},
-std::array<float,2>{0.626412272f, 0.0779000446f},
-std::array<float,2>{0.179667085f, 0.904865026f},
-std::array<float,2>{0.10659866f, 0.195895791f},
-std::array<float,2>{0.54609555f, 0.849929452f},
-std::array<float,2>{0.886497915f, 0.317351162f},
-std::array<float,2>{0.490909249f, 0.711675763f},
-std::array<float,2>{0.160242215f, 0.430406153f},
-std::array<float,2>{0.6474877f, 0.599965751f},
-std::array<float,2>{0.837675989f, 0.123202652f},
-std::array<float,2>{0.303280592f, 0.906766713f},
-std::array<float,2>{0.472342283f, 0.238407791f},
-std::array<float,2>{0.901985824f, 0.835817337f},
-std::array<float,2>{0.557151139f, 0.368772954f},
-std::array<float,2>{0.113977119f, 0.723300397f},
-std::array<float,2>{0.361559421f, 0.264809251f},
-std::array<float,2>{0.769655049f, 0.671195686f},
-std::array<float,2>{0.746808052f, 0.166569814f},
-std::array<float,2>{0.242328689f, 0.76922524f},
-std::array<float,2>{0.0279495027f, 0.0366918817f},
-std::array<float,2>{0.570003927f, 0.99002856f},
-std::array<float,2>{0.957210481f, 0.440955639f},
-std::array<float,2>{0.430330694f, 0.537598789f},
-std::array<float,2>{0.0696255937f, 0.342748135f},
-std::array<float,2>{0.506843626f, 0.697051764f},
-std::array<float,2>{0.912355125f, 0.21175836f},
-std::array<float,2>{0.454610616f, 0.862002134f},
-std::array<float,2>{0.267078817f, 0.0782225132f},
-std::array<float,2>{0.865306854f, 0.881509721f},
-std::array<float,2>{0.671307921f, 0.392168045f},
-std::array<float,2>{0.132637784f, 0.56576252f},
-std::array<float,2>{0.381780386f, 0.493077159f},
-std::array<float,2>{0.995433092f, 0.525109887f},
-std::array<float,2>{0.619937479f, 0.0153685482f},
-std::array<float,2>{0.0548412427f, 0.951616466f},
-std::array<float,2>{0.199247137f, 0.139926404f},
-std::array<float,2>{0.694459617f, 0.794837534f},
-std::array<float,2>{0.798043072f, 0.289565474f},
-std::array<float,2>{0.31682986f, 0.630398571f},
-std::array<float,2>{0.123966113f, 0.399475247f},
-std::array<float,2>{0.554276466f, 0.573330581f},
-std::array<float,2>{0.895819306f, 0.0934945196f},
-std::array<float,2>{0.482477933f, 0.886897326f},
-std::array<float,2>{0.308926463f, 0.205338582f},
-std::array<float,2>{0.834720075f, 0.868814647f},
-std::array<float,2>{0.650175512f, 0.335361063f},
-std::array<float,2>{0.171147972f, 0.689351916f},
-std::array<float,2>{0.424648285f, 0.28854543f},
-std::array<float,2>{0.9619385f, 0.637830615f},
-std::array<float,2>{0.57736969f, 0.125224322f},
-std::array<float,2>{0.0193244833f, 0.782751262f},
-std::array<float,2>{0.240168497f, 0.00760098873f},
-std::array<float,2>{0.741790116f, 0.939621031f},
-std::array<float,2>{0.775009513f, 0.485268652f},
-std::array<float,2>{0.370496154f, 0.516279519f},
-std::array<float,2>{0.136152208f, 0.366925418f},
-std::array<float,2>{0.662103772f, 0.727078915f},
-std::array<float,2>{0.872841001f, 0.24294059f},
-std::array<float,2>{0.27573809f, 0.841129184f},
-std::array<float,2>{0.466067195f, 0.114307508f},
-std::array<float,2>{0.92064321f, 0.914189696f},
-std::array<float,2>{0.510378957f, 0.428288132f},
-std::array<float,2>{0.0711410865f, 0.606520772f},
-std::array<float,2>{0.325261861f, 0.446141571f},
-std::array<float,2>{0.80534178f, 0.541345477f},
-std::array<float,2>{0.700068474f, 0.0415555835f},
-std::array<float,2>{0.193487108f, 0.995338559f},
-std::array<float,2>{0.0499011911f, 0.161967143f},
-std::array<float,2>{0.615314484f, 0.777554214f},
-std::array<float,2>{0.985124052f, 0.253668457f},
-std::array<float,2>{0.388492554f, 0.657790124f},
-std::array<float,2>{0.204899654f, 0.471582413f},
-std::array<float,2>{0.716002405f, 0.513086438f},
-std::array<float,2>{0.781909704f, 0.0181348678f},
-std::array<float,2>{0.33008194f, 0.968185127f},
-std::array<float,2>{0.403422177f, 0.142949581f},
-std::array<float,2>{0.969310999f, 0.801133752f},
-std::array<float,2>{0.603341341f, 0.30267787f},
-std::array<float,2>{0.0357049443f, 0.647297204f},
-std::array<float,2>{0.26131618f, 0.322388321f},
-std::array<float,2>{0.851471722f, 0.707280576f},
-std::array<float,2>{0.67918694f, 0.188771784f},
-std::array<float,2>{0.145686522f, 0.857613325f},
-std::array<float,2>{0.0912235007f, 0.0648798123f},
-std::array<float,2>{0.527598798f, 0.896222055f},
-std::array<float,2>{0.936594367f, 0.384018868f},
-std::array<float,2>{0.448763818f, 0.581320465f},
-std::array<float,2>{0.00498587685f, 0.278861433f},
-std::array<float,2>{0.593236923f, 0.673168123f},
-std::array<float,2>{0.949215293f, 0.182458743f},
-std::array<float,2>{0.419363886f, 0.761603892f},
-std::array<float,2>{0.352871776f, 0.0477614142f},
-std::array<float,2>{0.76463455f, 0.983259201f},
-std::array<float,2>{0.732459486f, 0.456090093f},
-std::array<float,2>{0.219584078f, 0.553674519f},
-std::array<float,2>{0.497275174f, 0.419411987f},
-std::array<float,2>{0.879219294f, 0.609615922f},
-std::array<float,2>{0.536372662f, 0.10817834f},
-std::array<float,2>{0.100109167f, 0.935312688f},
-std::array<float,2>{0.183560774f, 0.22756137f},
-std::array<float,2>{0.635645092f, 0.818775237f},
-std::array<float,2>{0.818072319f, 0.354527265f},
-std::array<float,2>{0.291855842f, 0.749476194f},
-std::array<float,2>{0.0648429245f, 0.458341688f},
-std::array<float,2>{0.502289355f, 0.549654007f},
-std::array<float,2>{0.907323301f, 0.0541931801f},
-std::array<float,2>{0.460336328f, 0.978396833f},
-std::array<float,2>{0.269792199f, 0.184145674f},
-std::array<float,2>{0.860697269f, 0.762774885f},
-std::array<float,2>{0.666113138f, 0.277069271f},
-std::array<float,2>{0.126414627f, 0.6791749f},
-std::array<float,2>{0.376948684f, 0.357797116f},
-std::array<float,2>{0.996958137f, 0.743860662f},
-std::array<float,2>{0.622536361f, 0.232803941f},
-std::array<float,2>{0.0586053953f, 0.812959611f},
-std::array<float,2>{0.197476968f, 0.103681989f},
-std::array<float,2>{0.688328683f, 0.933576763f},
-std::array<float,2>{0.800952911f, 0.417709678f},
-std::array<float,2>{0.315075457f, 0.615503669f},
-std::array<float,2>{0.157525748f, 0.297266692f},
-std::array<float,2>{0.64152211f, 0.641857266f},
-std::array<float,2>{0.840506375f, 0.14712368f},
-std::array<float,2>{0.299901366f, 0.799697161f},
-std::array<float,2>{0.473514885f, 0.0214933604f},
-std::array<float,2>{0.902795255f, 0.961598098f},
-std::array<float,2>{0.558988094f, 0.476228714f},
-std::array<float,2>{0.111598648f, 0.511376143f},
-std::array<float,2>{0.364870995f, 0.389508575f},
-std::array<float,2>{0.766121089f, 0.58340168f},
-std::array<float,2>{0.744284213f, 0.0689780489f},
-std::array<float,2>{0.24954991f, 0.891223311f},
-std::array<float,2>{0.024318656f, 0.191830277f},
-std::array<float,2>{0.564287901f, 0.854303598f},
-std::array<float,2>{0.955948293f, 0.325678706f},
-std::array<float,2>{0.434998393f, 0.706095576f},
-std::array<float,2>{0.231539667f, 0.424488366f},
-std::array<float,2>{0.726282954f, 0.604179561f},
-std::array<float,2>{0.751616418f, 0.11017181f},
-std::array<float,2>{0.344044358f, 0.919680536f},
-std::array<float,2>{0.412405759f, 0.246933773f},
-std::array<float,2>{0.939632654f, 0.838702381f},
-std::array<float,2>{0.585339367f, 0.360462904f},
-std::array<float,2>{0.0112895872f, 0.73091352f},
-std::array<float,2>{0.288006455f, 0.254120916f},
-std::array<float,2>{0.828090906f, 0.663552046f},
-std::array<float,2>{0.629339874f, 0.15946871f},
-std::array<float,2>{0.173690245f, 0.77721715f},
-std::array<float,2>{0.104242399f, 0.0452256054f},
-std::array<float,2>{0.542320967f, 0.999738336f},
-std::array<float,2>{0.888837993f, 0.452719122f},
-std::array<float,2>{0.485544235f, 0.544116914f},
-std::array<float,2>{0.0431414023f, 0.329915076f},
-std::array<float,2>{0.599568307f, 0.694751084f},
-std::array<float,2>{0.978035092f, 0.208314478f},
-std::array<float,2>{0.390924454f, 0.873942852f},
-std::array<float,2>{0.337700903f, 0.0872824192f},
-std::array<float,2>{0.791023135f, 0.882990718f},
-std::array<float,2>{0.706223667f, 0.404554814f},
-std::array<float,2>{0.215254739f, 0.576201618f},
-std::array<float,2>{0.440819234f, 0.488478482f},
-std::array<float,2>{0.925970197f, 0.520250618f},
-std::array<float,2>{0.521357954f, 0.00350665394f},
-std::array<float,2>{0.0842389613f, 0.944049239f},
-std::array<float,2>{0.152856201f, 0.129099354f},
-std::array<float,2>{0.687042117f, 0.787251115f},
-std::array<float,2>{0.852704048f, 0.284802765f},
-std::array<float,2>{0.254048318f, 0.636195123f},
-std::array<float,2>{0.00121108617f, 0.397357136f},
-std::array<float,2>{0.589240909f, 0.567263544f},
-std::array<float,2>{0.950722873f, 0.0847753137f},
-std::array<float,2>{0.416635007f, 0.877423227f},
-std::array<float,2>{0.356263876f, 0.215600893f},
-std::array<float,2>{0.758969903f, 0.863643646f},
-std::array<float,2>{0.72868681f, 0.338950008f},
-std::array<float,2>{0.225694224f, 0.701121271f},
-std::array<float,2>{0.493446559f, 0.293979675f},
-std::array<float,2>{0.87716341f, 0.625390887f},
-std::array<float,2>{0.533344984f, 0.134670332f},
-std::array<float,2>{0.0973325744f, 0.790924191f},
-std::array<float,2>{0.183841467f, 0.00881923456f},
-std::array<float,2>{0.637199879f, 0.947461843f},
-std::array<float,2>{0.813453674f, 0.498573691f},
-std::array<float,2>{0.295934111f, 0.530641079f},
-std::array<float,2>{0.207207412f, 0.374039054f},
-std::array<float,2>{0.711512208f, 0.720106423f},
-std::array<float,2>{0.78851074f, 0.236080468f},
-std::array<float,2>{0.333654672f, 0.831694722f},
-std::array<float,2>{0.402166635f, 0.118269205f},
-std::array<float,2>{0.972851038f, 0.91062665f},
-std::array<float,2>{0.60733062f, 0.43477124f},
-std::array<float,2>{0.0334105045f, 0.595538616f},
-std::array<float,2>{0.262998641f, 0.4422023f},
-std::array<float,2>{0.843759298f, 0.533686042f},
-std::array<float,2>{0.673401237f, 0.0326672979f},
-std::array<float,2>{0.143920824f, 0.986678243f},
-std::array<float,2>{0.089076899f, 0.168069109f},
-std::array<float,2>{0.524205685f, 0.772359788f},
-std::array<float,2>{0.931141794f, 0.259588987f},
-std::array<float,2>{0.450091094f, 0.667217016f},
-std::array<float,2>{0.139682993f, 0.479706019f},
-std::array<float,2>{0.657606602f, 0.501836002f},
-std::array<float,2>{0.870369017f, 0.0300826058f},
-std::array<float,2>{0.277686954f, 0.959081829f},
-std::array<float,2>{0.463705003f, 0.150679648f},
-std::array<float,2>{0.914310515f, 0.808347166f},
-std::array<float,2>{0.511767089f, 0.308853149f},
-std::array<float,2>{0.076725632f, 0.648544669f},
-std::array<float,2>{0.323009938f, 0.314885437f},
-std::array<float,2>{0.809836686f, 0.718666852f},
-std::array<float,2>{0.695893466f, 0.202666178f},
-std::array<float,2>{0.19109875f, 0.846264303f},
-std::array<float,2>{0.0510731079f, 0.0728062764f},
-std::array<float,2>{0.612845182f, 0.901808679f},
-std::array<float,2>{0.990518808f, 0.380163372f},
-std::array<float,2>{0.385572433f, 0.591119051f},
-std::array<float,2>{0.117760047f, 0.272540301f},
-std::array<float,2>{0.549162626f, 0.684524119f},
-std::array<float,2>{0.892475784f, 0.176958352f},
-std::array<float,2>{0.478463858f, 0.750955999f},
-std::array<float,2>{0.305994213f, 0.05632177f},
-std::array<float,2>{0.830309153f, 0.974816799f},
-std::array<float,2>{0.652655721f, 0.46131438f},
-std::array<float,2>{0.167879f, 0.556815803f},
-std::array<float,2>{0.426089674f, 0.413284987f},
-std::array<float,2>{0.968694627f, 0.622796953f},
-std::array<float,2>{0.573676646f, 0.0963149294f},
-std::array<float,2>{0.0229338743f, 0.927049458f},
-std::array<float,2>{0.235029936f, 0.222684994f},
-std::array<float,2>{0.736409962f, 0.820502937f},
-std::array<float,2>{0.778555572f, 0.351390421f},
-std::array<float,2>{0.373837292f, 0.741945326f},
-std::array<float,2>{0.0565355532f, 0.495777309f},
-std::array<float,2>{0.620500565f, 0.526008427f},
-std::array<float,2>{0.994478524f, 0.0120583968f},
-std::array<float,2>{0.38248238f, 0.94968611f},
-std::array<float,2>{0.317397475f, 0.137269646f},
-std::array<float,2>{0.797082543f, 0.796447694f},
-std::array<float,2>{0.693519413f, 0.29173106f},
-std::array<float,2>{0.200629205f, 0.630938828f},
-std::array<float,2>{0.453373134f, 0.340850979f},
-std::array<float,2>{0.913830817f, 0.698704183f},
-std::array<float,2>{0.506742299f, 0.214453265f},
-std::array<float,2>{0.069327198f, 0.860235155f},
-std::array<float,2>{0.131670192f, 0.0801572204f},
-std::array<float,2>{0.670550823f, 0.88003099f},
-std::array<float,2>{0.866472304f, 0.393431991f},
-std::array<float,2>{0.265683562f, 0.563846767f},
-std::array<float,2>{0.243250564f, 0.263297349f},
-std::array<float,2>{0.747168481f, 0.66811657f},
-std::array<float,2>{0.770617783f, 0.164139912f},
-std::array<float,2>{0.362451881f, 0.767334938f},
-std::array<float,2>{0.430968463f, 0.0383422486f},
-std::array<float,2>{0.958074749f, 0.9916026f},
-std::array<float,2>{0.569174111f, 0.437883407f},
-std::array<float,2>{0.0287066866f, 0.536580384f},
-std::array<float,2>{0.30399254f, 0.432316333f},
-std::array<float,2>{0.836611867f, 0.599474549f},
-std::array<float,2>{0.646829307f, 0.122325704f},
-std::array<float,2>{0.161627308f, 0.910107493f},
-std::array<float,2>{0.115082577f, 0.24186869f},
-std::array<float,2>{0.557801008f, 0.832372665f},
-std::array<float,2>{0.900411665f, 0.371012598f},
-std::array<float,2>{0.471438736f, 0.726455152f},
-std::array<float,2>{0.178052247f, 0.375720918f},
-std::array<float,2>{0.625006676f, 0.587428331f},
-std::array<float,2>{0.820508718f, 0.0757642537f},
-std::array<float,2>{0.283165455f, 0.902900398f},
-std::array<float,2>{0.49169749f, 0.197324291f},
-std::array<float,2>{0.885051489f, 0.847990513f},
-std::array<float,2>{0.545379817f, 0.319753736f},
-std::array<float,2>{0.106355868f, 0.714386702f},
-std::array<float,2>{0.350749582f, 0.305190146f},
-std::array<float,2>{0.755291224f, 0.655768692f},
-std::array<float,2>{0.719411433f, 0.155419782f},
-std::array<float,2>{0.227184176f, 0.81154865f},
-std::array<float,2>{0.0121357795f, 0.0250649657f},
-std::array<float,2>{0.579737663f, 0.954318821f},
-std::array<float,2>{0.941777885f, 0.482866973f},
-std::array<float,2>{0.409501702f, 0.505432725f},
-std::array<float,2>{0.0815622061f, 0.346881479f},
-std::array<float,2>{0.518349469f, 0.736974478f},
-std::array<float,2>{0.923695147f, 0.22208263f},
-std::array<float,2>{0.442443609f, 0.827199042f},
-std::array<float,2>{0.250552148f, 0.100107156f},
-std::array<float,2>{0.858411849f, 0.925301433f},
-std::array<float,2>{0.681293786f, 0.406486452f},
-std::array<float,2>{0.15008983f, 0.619671941f},
-std::array<float,2>{0.395152986f, 0.465026736f},
-std::array<float,2>{0.983310819f, 0.562327683f},
-std::array<float,2>{0.594413161f, 0.0622713454f},
-std::array<float,2>{0.0422680192f, 0.969139516f},
-std::array<float,2>{0.210951209f, 0.174293593f},
-std::array<float,2>{0.709437251f, 0.757026792f},
-std::array<float,2>{0.796062112f, 0.266480416f},
-std::array<float,2>{0.341222733f, 0.680643797f},
-std::array<float,2>{0.101236962f, 0.420668542f},
-std::array<float,2>{0.535221398f, 0.611453652f},
-std::array<float,2>{0.880112708f, 0.107002169f},
-std::array<float,2>{0.496403188f, 0.936468899f},
-std::array<float,2>{0.292086124f, 0.229533181f},
-std::array<float,2>{0.816798449f, 0.816966236f},
-std::array<float,2>{0.636080623f, 0.352763742f},
-std::array<float,2>{0.181783259f, 0.747764289f},
-std::array<float,2>{0.418939143f, 0.280162424f},
-std::array<float,2>{0.948133826f, 0.67544049f},
-std::array<float,2>{0.591832042f, 0.180658534f},
-std::array<float,2>{0.00406374084f, 0.758919537f},
-std::array<float,2>{0.219828144f, 0.0492393561f},
-std::array<float,2>{0.734258711f, 0.982220471f},
-std::array<float,2>{0.765449882f, 0.454590112f},
-std::array<float,2>{0.352057993f, 0.551826954f},
-std::array<float,2>{0.145379618f, 0.322049886f},
-std::array<float,2>{0.677800059f, 0.709093153f},
-std::array<float,2>{0.850047767f, 0.191347808f},
-std::array<float,2>{0.25997594f, 0.856237352f},
-std::array<float,2>{0.447462648f, 0.0641963109f},
-std::array<float,2>{0.936386466f, 0.898186088f},
-std::array<float,2>{0.528455198f, 0.386153489f},
-std::array<float,2>{0.090744935f, 0.578352034f},
-std::array<float,2>{0.33136636f, 0.468789399f},
-std::array<float,2>{0.782583475f, 0.514098048f},
-std::array<float,2>{0.715387762f, 0.0168513935f},
-std::array<float,2>{0.203265622f, 0.965199053f},
-std::array<float,2>{0.0369167626f, 0.140657634f},
-std::array<float,2>{0.601581514f, 0.802876472f},
-std::array<float,2>{0.970154881f, 0.303062618f},
-std::array<float,2>{0.402669072f, 0.646273255f},
-std::array<float,2>{0.195205942f, 0.447540373f},
-std::array<float,2>{0.700862825f, 0.539648175f},
-std::array<float,2>{0.806069016f, 0.0393688567f},
-std::array<float,2>{0.324459344f, 0.99337101f},
-std::array<float,2>{0.386833817f, 0.163988799f},
-std::array<float,2>{0.98597759f, 0.780987084f},
-std::array<float,2>{0.616618276f, 0.250856161f},
-std::array<float,2>{0.0488932431f, 0.659356058f},
-std::array<float,2>{0.27637583f, 0.363551944f},
-std::array<float,2>{0.87143594f, 0.728665292f},
-std::array<float,2>{0.661031961f, 0.245181307f},
-std::array<float,2>{0.135452941f, 0.843435585f},
-std::array<float,2>{0.0720463991f, 0.116882756f},
-std::array<float,2>{0.511446059f, 0.916051447f},
-std::array<float,2>{0.921115398f, 0.426499665f},
-std::array<float,2>{0.464964271f, 0.607594311f},
-std::array<float,2>{0.0185252167f, 0.285605699f},
-std::array<float,2>{0.57714653f, 0.639182627f},
-std::array<float,2>{0.961054623f, 0.127075091f},
-std::array<float,2>{0.424898148f, 0.783765614f},
-std::array<float,2>{0.369644016f, 0.00464481302f},
-std::array<float,2>{0.773711503f, 0.938757658f},
-std::array<float,2>{0.74082309f, 0.486737728f},
-std::array<float,2>{0.239109576f, 0.518018663f},
-std::array<float,2>{0.484095395f, 0.401541203f},
-std::array<float,2>{0.894922435f, 0.571676433f},
-std::array<float,2>{0.553031147f, 0.0905759707f},
-std::array<float,2>{0.124189995f, 0.890221834f},
-std::array<float,2>{0.170749977f, 0.204367965f},
-std::array<float,2>{0.648706198f, 0.870715261f},
-std::array<float,2>{0.835474849f, 0.332392246f},
-std::array<float,2>{0.309960723f, 0.690486491f},
-std::array<float,2>{0.110294268f, 0.473148912f},
-std::array<float,2>{0.56091851f, 0.508996487f},
-std::array<float,2>{0.904669821f, 0.0200901832f},
-std::array<float,2>{0.47554636f, 0.964199364f},
-std::array<float,2>{0.298097283f, 0.144833311f},
-std::array<float,2>{0.84275049f, 0.798620403f},
-std::array<float,2>{0.643215477f, 0.300597221f},
-std::array<float,2>{0.158763632f, 0.643928349f},
-std::array<float,2>{0.437296927f, 0.32630983f},
-std::array<float,2>{0.954632461f, 0.703308761f},
-std::array<float,2>{0.566325486f, 0.194507256f},
-std::array<float,2>{0.0257822704f, 0.852598071f},
-std::array<float,2>{0.246626079f, 0.0676391721f},
-std::array<float,2>{0.743053555f, 0.892871737f},
-std::array<float,2>{0.768994153f, 0.38857308f},
-std::array<float,2>{0.366200954f, 0.585379124f},
-std::array<float,2>{0.127224579f, 0.274940372f},
-std::array<float,2>{0.665744007f, 0.677155197f},
-std::array<float,2>{0.86214602f, 0.186397746f},
-std::array<float,2>{0.272678375f, 0.765395343f},
-std::array<float,2>{0.457491994f, 0.0524283983f},
-std::array<float,2>{0.908807516f, 0.97953707f},
-std::array<float,2>{0.501861334f, 0.45962137f},
-std::array<float,2>{0.0634489655f, 0.548356652f},
-std::array<float,2>{0.314009964f, 0.414868146f},
-std::array<float,2>{0.804638922f, 0.615046501f},
-std::array<float,2>{0.6907233f, 0.103035457f},
-std::array<float,2>{0.197197393f, 0.931451917f},
-std::array<float,2>{0.0606982075f, 0.231165275f},
-std::array<float,2>{0.624259293f, 0.815158546f},
-std::array<float,2>{0.999506772f, 0.35559684f},
-std::array<float,2>{0.377471f, 0.744319499f},
-std::array<float,2>{0.216943875f, 0.403279215f},
-std::array<float,2>{0.704711556f, 0.574436247f},
-std::array<float,2>{0.790555f, 0.0897718444f},
-std::array<float,2>{0.339158624f, 0.885992706f},
-std::array<float,2>{0.393887579f, 0.209129706f},
-std::array<float,2>{0.978643179f, 0.872060359f},
-std::array<float,2>{0.600178301f, 0.330552995f},
-std::array<float,2>{0.0467139482f, 0.69302541f},
-std::array<float,2>{0.256999552f, 0.281405598f},
-std::array<float,2>{0.853650093f, 0.634155273f},
-std::array<float,2>{0.684921563f, 0.131627411f},
-std::array<float,2>{0.155759826f, 0.786622882f},
-std::array<float,2>{0.0838177055f, 0.00151400245f},
-std::array<float,2>{0.522143185f, 0.942146778f},
-std::array<float,2>{0.928377211f, 0.491302341f},
-std::array<float,2>{0.439035356f, 0.52340126f},
-std::array<float,2>{0.00975949317f, 0.363250911f},
-std::array<float,2>{0.583685219f, 0.732450426f},
-std::array<float,2>{0.938521683f, 0.249211237f},
-std::array<float,2>{0.411897808f, 0.837008536f},
-std::array<float,2>{0.346698284f, 0.113082863f},
-std::array<float,2>{0.75377214f, 0.920088887f},
-std::array<float,2>{0.724246502f, 0.42328462f},
-std::array<float,2>{0.233972311f, 0.60324198f},
-std::array<float,2>{0.487579405f, 0.450705767f},
-std::array<float,2>{0.888198674f, 0.545075655f},
-std::array<float,2>{0.539130688f, 0.0436636172f},
-std::array<float,2>{0.101710148f, 0.996365488f},
-std::array<float,2>{0.174976826f, 0.156658649f},
-std::array<float,2>{0.631258428f, 0.774141788f},
-std::array<float,2>{0.825908959f, 0.257801175f},
-std::array<float,2>{0.285689265f, 0.66173631f},
-std::array<float,2>{0.0323140547f, 0.437097013f},
-std::array<float,2>{0.607428551f, 0.597484231f},
-std::array<float,2>{0.975481212f, 0.11939469f},
-std::array<float,2>{0.39964509f, 0.913279414f},
-std::array<float,2>{0.334677637f, 0.236908883f},
-std::array<float,2>{0.786204219f, 0.828418493f},
-std::array<float,2>{0.713068247f, 0.372905463f},
-std::array<float,2>{0.209044009f, 0.721715152f},
-std::array<float,2>{0.451899588f, 0.259767681f},
-std::array<float,2>{0.933262408f, 0.665301681f},
-std::array<float,2>{0.526350498f, 0.171504989f},
-std::array<float,2>{0.0878270268f, 0.770926952f},
-std::array<float,2>{0.142115444f, 0.0341371074f},
-std::array<float,2>{0.675452292f, 0.984723747f},
-std::array<float,2>{0.847290695f, 0.445264369f},
-std::array<float,2>{0.26382938f, 0.532696545f},
-std::array<float,2>{0.222823977f, 0.336110532f},
-std::array<float,2>{0.727067947f, 0.702610731f},
-std::array<float,2>{0.760760128f, 0.217178404f},
-std::array<float,2>{0.358254105f, 0.866879582f},
-std::array<float,2>{0.414396852f, 0.0823907107f},
-std::array<float,2>{0.952362001f, 0.876720071f},
-std::array<float,2>{0.586180031f, 0.39635551f},
-std::array<float,2>{0.00316661177f, 0.569680393f},
-std::array<float,2>{0.294659168f, 0.497271359f},
-std::array<float,2>{0.815188348f, 0.527860701f},
-std::array<float,2>{0.638706982f, 0.0115682287f},
-std::array<float,2>{0.186515182f, 0.945958197f},
-std::array<float,2>{0.0946125686f, 0.136533454f},
-std::array<float,2>{0.533075392f, 0.792256773f},
-std::array<float,2>{0.87676239f, 0.296640724f},
-std::array<float,2>{0.495179027f, 0.62745738f},
-std::array<float,2>{0.165897667f, 0.463787049f},
-std::array<float,2>{0.654967427f, 0.555736125f},
-std::array<float,2>{0.829923391f, 0.0576637611f},
-std::array<float,2>{0.308124125f, 0.973561287f},
-std::array<float,2>{0.48021403f, 0.178373709f},
-std::array<float,2>{0.894137144f, 0.753712595f},
-std::array<float,2>{0.547297239f, 0.269977838f},
-std::array<float,2>{0.120415032f, 0.686853707f},
-std::array<float,2>{0.372777641f, 0.349461198f},
-std::array<float,2>{0.780093849f, 0.738631487f},
-std::array<float,2>{0.735757351f, 0.225004122f},
-std::array<float,2>{0.238140732f, 0.823639691f},
-std::array<float,2>{0.019548608f, 0.0942811295f},
-std::array<float,2>{0.571604788f, 0.928956687f},
-std::array<float,2>{0.965566814f, 0.411351204f},
-std::array<float,2>{0.42889145f, 0.624045491f},
-std::array<float,2>{0.0759744421f, 0.311891198f},
-std::array<float,2>{0.51465857f, 0.650976777f},
-std::array<float,2>{0.916848838f, 0.149745002f},
-std::array<float,2>{0.462185949f, 0.806039333f},
-std::array<float,2>{0.279424131f, 0.0276223626f},
-std::array<float,2>{0.868671f, 0.957437456f},
-std::array<float,2>{0.659250736f, 0.478210747f},
-std::array<float,2>{0.137549013f, 0.503857136f},
-std::array<float,2>{0.384190708f, 0.38158983f},
-std::array<float,2>{0.988714635f, 0.593642116f},
-std::array<float,2>{0.610668838f, 0.0719867945f},
-std::array<float,2>{0.0533809997f, 0.899794996f},
-std::array<float,2>{0.188200846f, 0.199672416f},
-std::array<float,2>{0.698931992f, 0.844825804f},
-std::array<float,2>{0.810664415f, 0.312687814f},
-std::array<float,2>{0.320725828f, 0.715058148f},
-std::array<float,2>{0.031215772f, 0.439952284f},
-std::array<float,2>{0.567186236f, 0.538471222f},
-std::array<float,2>{0.959779322f, 0.0361237824f},
-std::array<float,2>{0.432331115f, 0.98909694f},
-std::array<float,2>{0.360445142f, 0.167027712f},
-std::array<float,2>{0.772775173f, 0.768329501f},
-std::array<float,2>{0.749718904f, 0.264440209f},
-std::array<float,2>{0.245515257f, 0.67003715f},
-std::array<float,2>{0.47058183f, 0.367580056f},
-std::array<float,2>{0.898785472f, 0.723654151f},
-std::array<float,2>{0.555122435f, 0.23927778f},
-std::array<float,2>{0.115252495f, 0.834425211f},
-std::array<float,2>{0.162950695f, 0.124540962f},
-std::array<float,2>{0.645298064f, 0.907708228f},
-std::array<float,2>{0.839167237f, 0.430800676f},
-std::array<float,2>{0.301787645f, 0.600970149f},
-std::array<float,2>{0.201414958f, 0.290717036f},
-std::array<float,2>{0.692450404f, 0.629186928f},
-std::array<float,2>{0.799847722f, 0.138988256f},
-std::array<float,2>{0.318976223f, 0.793412268f},
-std::array<float,2>{0.379534006f, 0.013676188f},
-std::array<float,2>{0.992952347f, 0.952880383f},
-std::array<float,2>{0.618989825f, 0.493907362f},
-std::array<float,2>{0.0582699962f, 0.524374127f},
-std::array<float,2>{0.267970592f, 0.391103297f},
-std::array<float,2>{0.863440573f, 0.564842641f},
-std::array<float,2>{0.669441819f, 0.0792550519f},
-std::array<float,2>{0.129521534f, 0.882190228f},
-std::array<float,2>{0.0682431236f, 0.212867886f},
-std::array<float,2>{0.50430429f, 0.862945497f},
-std::array<float,2>{0.910855651f, 0.342827767f},
-std::array<float,2>{0.455990463f, 0.696172178f},
-std::array<float,2>{0.151472792f, 0.409421921f},
-std::array<float,2>{0.683256686f, 0.618500531f},
-std::array<float,2>{0.856266439f, 0.0995456204f},
-std::array<float,2>{0.252132863f, 0.921994925f},
-std::array<float,2>{0.444521815f, 0.22060509f},
-std::array<float,2>{0.92388314f, 0.824693084f},
-std::array<float,2>{0.516385376f, 0.344788164f},
-std::array<float,2>{0.0794852972f, 0.735685587f},
-std::array<float,2>{0.343465239f, 0.268873215f},
-std::array<float,2>{0.794846475f, 0.682718456f},
-std::array<float,2>{0.707625747f, 0.173297703f},
-std::array<float,2>{0.214761794f, 0.754646659f},
-std::array<float,2>{0.040049918f, 0.0587098375f},
-std::array<float,2>{0.596876085f, 0.971131921f},
-std::array<float,2>{0.981151283f, 0.468213141f},
-std::array<float,2>{0.397107303f, 0.559254348f},
-std::array<float,2>{0.108032674f, 0.318047702f},
-std::array<float,2>{0.544573247f, 0.712504625f},
-std::array<float,2>{0.883823216f, 0.19676958f},
-std::array<float,2>{0.489925385f, 0.851376593f},
-std::array<float,2>{0.284406751f, 0.0766851902f},
-std::array<float,2>{0.822282791f, 0.905579269f},
-std::array<float,2>{0.62751323f, 0.378633559f},
-std::array<float,2>{0.177417636f, 0.58961916f},
-std::array<float,2>{0.407647878f, 0.481938034f},
-std::array<float,2>{0.944114506f, 0.506815374f},
-std::array<float,2>{0.580411077f, 0.0256261025f},
-std::array<float,2>{0.0149276638f, 0.956852436f},
-std::array<float,2>{0.229647264f, 0.153886005f},
-std::array<float,2>{0.72252208f, 0.808823943f},
-std::array<float,2>{0.757529795f, 0.307971179f},
-std::array<float,2>{0.347706199f, 0.65367949f},
-std::array<float,2>{0.0922204554f, 0.383501351f},
-std::array<float,2>{0.529416978f, 0.580386817f},
-std::array<float,2>{0.934832454f, 0.0661283359f},
-std::array<float,2>{0.447264731f, 0.894683301f},
-std::array<float,2>{0.259017885f, 0.188200161f},
-std::array<float,2>{0.849039495f, 0.858581305f},
-std::array<float,2>{0.67628473f, 0.32415837f},
-std::array<float,2>{0.147128671f, 0.708913565f},
-std::array<float,2>{0.405416638f, 0.30125773f},
-std::array<float,2>{0.971908212f, 0.648253977f},
-std::array<float,2>{0.603851497f, 0.143912464f},
-std::array<float,2>{0.0390031599f, 0.802441835f},
-std::array<float,2>{0.206551909f, 0.0186409783f},
-std::array<float,2>{0.718595326f, 0.967611313f},
-std::array<float,2>{0.784530759f, 0.472654104f},
-std::array<float,2>{0.329724729f, 0.512385964f},
-std::array<float,2>{0.180850074f, 0.354453713f},
-std::array<float,2>{0.634167314f, 0.748618841f},
-std::array<float,2>{0.818699121f, 0.226879418f},
-std::array<float,2>{0.289705426f, 0.820131123f},
-std::array<float,2>{0.499354005f, 0.109098002f},
-std::array<float,2>{0.880958319f, 0.93403405f},
-std::array<float,2>{0.537171364f, 0.418287963f},
-std::array<float,2>{0.0984840244f, 0.610554636f},
-std::array<float,2>{0.355355084f, 0.455662698f},
-std::array<float,2>{0.762530029f, 0.554335654f},
-std::array<float,2>{0.731981516f, 0.0478889719f},
-std::array<float,2>{0.221333221f, 0.983503163f},
-std::array<float,2>{0.0074125817f, 0.183388099f},
-std::array<float,2>{0.590621948f, 0.760678411f},
-std::array<float,2>{0.945544481f, 0.277859062f},
-std::array<float,2>{0.419952184f, 0.672321737f},
-std::array<float,2>{0.241276935f, 0.485727578f},
-std::array<float,2>{0.738493025f, 0.516698837f},
-std::array<float,2>{0.775937855f, 0.00637895241f},
-std::array<float,2>{0.368116945f, 0.940683484f},
-std::array<float,2>{0.422807187f, 0.126563042f},
-std::array<float,2>{0.963826001f, 0.781484425f},
-std::array<float,2>{0.576054454f, 0.287240744f},
-std::array<float,2>{0.0160934739f, 0.637147427f},
-std::array<float,2>{0.31084767f, 0.334739536f},
-std::array<float,2>{0.833742797f, 0.688003898f},
-std::array<float,2>{0.651637435f, 0.206383958f},
-std::array<float,2>{0.16909115f, 0.867501378f},
-std::array<float,2>{0.122049354f, 0.0925517604f},
-std::array<float,2>{0.552157402f, 0.888404846f},
-std::array<float,2>{0.897938788f, 0.398851037f},
-std::array<float,2>{0.482174873f, 0.573230922f},
-std::array<float,2>{0.048745349f, 0.252669662f},
-std::array<float,2>{0.6143139f, 0.657025993f},
-std::array<float,2>{0.987237155f, 0.160252795f},
-std::array<float,2>{0.390206754f, 0.778503358f},
-std::array<float,2>{0.326526225f, 0.0429156497f},
-std::array<float,2>{0.807118416f, 0.994832814f},
-std::array<float,2>{0.70224148f, 0.44650209f},
-std::array<float,2>{0.192519262f, 0.542316318f},
-std::array<float,2>{0.467234075f, 0.429151565f},
-std::array<float,2>{0.918896079f, 0.606052279f},
-std::array<float,2>{0.507843494f, 0.11336489f},
-std::array<float,2>{0.0728436559f, 0.915296853f},
-std::array<float,2>{0.133943751f, 0.243859962f},
-std::array<float,2>{0.663471341f, 0.840482116f},
-std::array<float,2>{0.874540389f, 0.366104871f},
-std::array<float,2>{0.274726033f, 0.728399158f},
-std::array<float,2>{0.120654501f, 0.461675882f},
-std::array<float,2>{0.547526836f, 0.557491779f},
-std::array<float,2>{0.893811762f, 0.0561417863f},
-std::array<float,2>{0.479890764f, 0.975102305f},
-std::array<float,2>{0.307889938f, 0.1774728f},
-std::array<float,2>{0.829301417f, 0.750069439f},
-std::array<float,2>{0.654332817f, 0.273029208f},
-std::array<float,2>{0.165260583f, 0.68385607f},
-std::array<float,2>{0.429315329f, 0.35076347f},
-std::array<float,2>{0.965029001f, 0.741590738f},
-std::array<float,2>{0.57222122f, 0.223553404f},
-std::array<float,2>{0.0202943925f, 0.821024954f},
-std::array<float,2>{0.237537876f, 0.0961270183f},
-std::array<float,2>{0.736159384f, 0.927648425f},
-std::array<float,2>{0.77950412f, 0.413990676f},
-std::array<float,2>{0.372109383f, 0.622483552f},
-std::array<float,2>{0.136740491f, 0.309402168f},
-std::array<float,2>{0.659969866f, 0.649310946f},
-std::array<float,2>{0.868540227f, 0.151362121f},
-std::array<float,2>{0.279915541f, 0.808070779f},
-std::array<float,2>{0.462807357f, 0.0293040182f},
-std::array<float,2>{0.916118503f, 0.959570408f},
-std::array<float,2>{0.51552695f, 0.480034202f},
-std::array<float,2>{0.0755806044f, 0.501235545f},
-std::array<float,2>{0.321250319f, 0.380444497f},
-std::array<float,2>{0.811139941f, 0.591496348f},
-std::array<float,2>{0.698435724f, 0.0724378377f},
-std::array<float,2>{0.187698781f, 0.901928008f},
-std::array<float,2>{0.0528022759f, 0.202187642f},
-std::array<float,2>{0.61084795f, 0.846155524f},
-std::array<float,2>{0.988812268f, 0.315392137f},
-std::array<float,2>{0.384440511f, 0.718236208f},
-std::array<float,2>{0.209483013f, 0.435410202f},
-std::array<float,2>{0.713629127f, 0.595028996f},
-std::array<float,2>{0.786688805f, 0.119083233f},
-std::array<float,2>{0.334375679f, 0.911037087f},
-std::array<float,2>{0.400390208f, 0.235477239f},
-std::array<float,2>{0.974639535f, 0.831245303f},
-std::array<float,2>{0.608131528f, 0.37486586f},
-std::array<float,2>{0.0330006219f, 0.720339477f},
-std::array<float,2>{0.264538556f, 0.259111047f},
-std::array<float,2>{0.846784294f, 0.667721093f},
-std::array<float,2>{0.675014734f, 0.168659642f},
-std::array<float,2>{0.14181459f, 0.771533072f},
-std::array<float,2>{0.0870503485f, 0.0331340916f},
-std::array<float,2>{0.525769711f, 0.987218916f},
-std::array<float,2>{0.933078766f, 0.441728741f},
-std::array<float,2>{0.451241255f, 0.534164608f},
-std::array<float,2>{0.00369339855f, 0.339439869f},
-std::array<float,2>{0.586608231f, 0.700246334f},
-std::array<float,2>{0.952987611f, 0.215272516f},
-std::array<float,2>{0.41475749f, 0.864235997f},
-std::array<float,2>{0.357433707f, 0.0840483755f},
-std::array<float,2>{0.761339664f, 0.877782702f},
-std::array<float,2>{0.72666961f, 0.39686197f},
-std::array<float,2>{0.223539725f, 0.566883147f},
-std::array<float,2>{0.495802552f, 0.498366386f},
-std::array<float,2>{0.876082242f, 0.531120777f},
-std::array<float,2>{0.532471478f, 0.00946693867f},
-std::array<float,2>{0.0942005217f, 0.948171735f},
-std::array<float,2>{0.185781747f, 0.134094939f},
-std::array<float,2>{0.639613092f, 0.790301144f},
-std::array<float,2>{0.814830065f, 0.294759065f},
-std::array<float,2>{0.293965042f, 0.625705183f},
-std::array<float,2>{0.0461635515f, 0.404845178f},
-std::array<float,2>{0.59968704f, 0.577070415f},
-std::array<float,2>{0.979253411f, 0.0876719803f},
-std::array<float,2>{0.394388407f, 0.883427739f},
-std::array<float,2>{0.339736313f, 0.208517149f},
-std::array<float,2>{0.790462017f, 0.873288691f},
-std::array<float,2>{0.704368472f, 0.329570532f},
-std::array<float,2>{0.217290029f, 0.695094287f},
-std::array<float,2>{0.438553333f, 0.284252882f},
-std::array<float,2>{0.927822769f, 0.636579394f},
-std::array<float,2>{0.521585941f, 0.129711062f},
-std::array<float,2>{0.0832656994f, 0.788025439f},
-std::array<float,2>{0.156171158f, 0.00301486952f},
-std::array<float,2>{0.685205102f, 0.943602324f},
-std::array<float,2>{0.854421258f, 0.488798678f},
-std::array<float,2>{0.257713467f, 0.519537508f},
-std::array<float,2>{0.233688757f, 0.360879004f},
-std::array<float,2>{0.72382015f, 0.731027246f},
-std::array<float,2>{0.75336647f, 0.246557638f},
-std::array<float,2>{0.347175419f, 0.838359594f},
-std::array<float,2>{0.411170989f, 0.109738335f},
-std::array<float,2>{0.938967526f, 0.919172883f},
-std::array<float,2>{0.583112895f, 0.423967659f},
-std::array<float,2>{0.0092386771f, 0.603723884f},
-std::array<float,2>{0.285565764f, 0.452587694f},
-std::array<float,2>{0.825326145f, 0.544612646f},
-std::array<float,2>{0.631478906f, 0.0458149426f},
-std::array<float,2>{0.175589293f, 0.999462485f},
-std::array<float,2>{0.102308653f, 0.159841105f},
-std::array<float,2>{0.53957504f, 0.776412606f},
-std::array<float,2>{0.887764871f, 0.254773825f},
-std::array<float,2>{0.488262951f, 0.663775086f},
-std::array<float,2>{0.158245161f, 0.475943744f},
-std::array<float,2>{0.642687082f, 0.511108279f},
-std::array<float,2>{0.842121482f, 0.0220890809f},
-std::array<float,2>{0.298353434f, 0.961317837f},
-std::array<float,2>{0.474685967f, 0.14668557f},
-std::array<float,2>{0.904815674f, 0.799139977f},
-std::array<float,2>{0.56105727f, 0.297704041f},
-std::array<float,2>{0.109580964f, 0.642138422f},
-std::array<float,2>{0.365508556f, 0.326107174f},
-std::array<float,2>{0.769486189f, 0.70695591f},
-std::array<float,2>{0.742418587f, 0.19207567f},
-std::array<float,2>{0.246348053f, 0.853552878f},
-std::array<float,2>{0.0260690339f, 0.0684854612f},
-std::array<float,2>{0.565444827f, 0.890745938f},
-std::array<float,2>{0.954290271f, 0.389056712f},
-std::array<float,2>{0.436983496f, 0.5836851f},
-std::array<float,2>{0.0628344193f, 0.276446819f},
-std::array<float,2>{0.501367629f, 0.679543078f},
-std::array<float,2>{0.908614159f, 0.183921412f},
-std::array<float,2>{0.457667559f, 0.763506055f},
-std::array<float,2>{0.273354858f, 0.0545096435f},
-std::array<float,2>{0.861530304f, 0.977654755f},
-std::array<float,2>{0.665441155f, 0.458943933f},
-std::array<float,2>{0.127917841f, 0.54926753f},
-std::array<float,2>{0.377250642f, 0.41717419f},
-std::array<float,2>{0.999699652f, 0.616117895f},
-std::array<float,2>{0.62484622f, 0.104036316f},
-std::array<float,2>{0.0613512844f, 0.932968318f},
-std::array<float,2>{0.196485266f, 0.233034134f},
-std::array<float,2>{0.691389263f, 0.813134372f},
-std::array<float,2>{0.804131329f, 0.358174831f},
-std::array<float,2>{0.313611984f, 0.743569553f},
-std::array<float,2>{0.0161403995f, 0.487084687f},
-std::array<float,2>{0.575511098f, 0.51821667f},
-std::array<float,2>{0.963023961f, 0.00435173232f},
-std::array<float,2>{0.421936929f, 0.939397633f},
-std::array<float,2>{0.367450148f, 0.127906755f},
-std::array<float,2>{0.775707543f, 0.783310652f},
-std::array<float,2>{0.738803387f, 0.286078811f},
-std::array<float,2>{0.241960406f, 0.639064372f},
-std::array<float,2>{0.481819779f, 0.332685053f},
-std::array<float,2>{0.898292065f, 0.691075504f},
-std::array<float,2>{0.552438557f, 0.204906821f},
-std::array<float,2>{0.121192999f, 0.870273709f},
-std::array<float,2>{0.169634223f, 0.0899701864f},
-std::array<float,2>{0.652128279f, 0.89001596f},
-std::array<float,2>{0.833241463f, 0.402161598f},
-std::array<float,2>{0.311347604f, 0.571981966f},
-std::array<float,2>{0.193216562f, 0.250407785f},
-std::array<float,2>{0.703120649f, 0.659939766f},
-std::array<float,2>{0.807427943f, 0.163496703f},
-std::array<float,2>{0.327116877f, 0.78061384f},
-std::array<float,2>{0.390022546f, 0.0396978855f},
-std::array<float,2>{0.986650229f, 0.99397552f},
-std::array<float,2>{0.615207374f, 0.4478558f},
-std::array<float,2>{0.0482374132f, 0.53920126f},
-std::array<float,2>{0.275024921f, 0.425908625f},
-std::array<float,2>{0.8742221f, 0.608166575f},
-std::array<float,2>{0.663756192f, 0.116647117f},
-std::array<float,2>{0.134448841f, 0.916520596f},
-std::array<float,2>{0.0723997727f, 0.245767429f},
-std::array<float,2>{0.508360803f, 0.843150556f},
-std::array<float,2>{0.918001473f, 0.363991469f},
-std::array<float,2>{0.467569888f, 0.729224801f},
-std::array<float,2>{0.146712989f, 0.386425555f},
-std::array<float,2>{0.67593646f, 0.579093993f},
-std::array<float,2>{0.849461079f, 0.0637667328f},
-std::array<float,2>{0.259492755f, 0.897878885f},
-std::array<float,2>{0.446662933f, 0.190786302f},
-std::array<float,2>{0.935515165f, 0.855913579f},
-std::array<float,2>{0.530013323f, 0.321451217f},
-std::array<float,2>{0.0926154107f, 0.709780812f},
-std::array<float,2>{0.329526156f, 0.303637773f},
-std::array<float,2>{0.784778595f, 0.645810366f},
-std::array<float,2>{0.717971921f, 0.141584218f},
-std::array<float,2>{0.206398562f, 0.803627133f},
-std::array<float,2>{0.0383270383f, 0.0175744537f},
-std::array<float,2>{0.604233801f, 0.965608299f},
-std::array<float,2>{0.972376645f, 0.469652027f},
-std::array<float,2>{0.406163692f, 0.514273286f},
-std::array<float,2>{0.0981214195f, 0.353355199f},
-std::array<float,2>{0.537744105f, 0.74747622f},
-std::array<float,2>{0.881601512f, 0.230369925f},
-std::array<float,2>{0.499677151f, 0.816445351f},
-std::array<float,2>{0.289323181f, 0.106809579f},
-std::array<float,2>{0.819127321f, 0.935783029f},
-std::array<float,2>{0.63462317f, 0.420015246f},
-std::array<float,2>{0.181453809f, 0.612063229f},
-std::array<float,2>{0.420719177f, 0.454188168f},
-std::array<float,2>{0.946215808f, 0.552250803f},
-std::array<float,2>{0.590272009f, 0.0493608601f},
-std::array<float,2>{0.00730766961f, 0.981531501f},
-std::array<float,2>{0.220848799f, 0.180045977f},
-std::array<float,2>{0.731458485f, 0.759708643f},
-std::array<float,2>{0.762141228f, 0.279612631f},
-std::array<float,2>{0.354544967f, 0.675106406f},
-std::array<float,2>{0.0798085183f, 0.406900823f},
-std::array<float,2>{0.51562953f, 0.619333863f},
-std::array<float,2>{0.924394608f, 0.100034043f},
-std::array<float,2>{0.445180088f, 0.925086439f},
-std::array<float,2>{0.25259617f, 0.222236931f},
-std::array<float,2>{0.855682611f, 0.828099966f},
-std::array<float,2>{0.682880402f, 0.34744969f},
-std::array<float,2>{0.152274773f, 0.73635f},
-std::array<float,2>{0.39652884f, 0.265917569f},
-std::array<float,2>{0.980802834f, 0.6801548f},
-std::array<float,2>{0.597272158f, 0.174651206f},
-std::array<float,2>{0.0405661203f, 0.75746429f},
-std::array<float,2>{0.214210197f, 0.0616648346f},
-std::array<float,2>{0.70742321f, 0.969677687f},
-std::array<float,2>{0.794412911f, 0.465771407f},
-std::array<float,2>{0.343215466f, 0.561914206f},
-std::array<float,2>{0.177129105f, 0.319863051f},
-std::array<float,2>{0.62705642f, 0.714006662f},
-std::array<float,2>{0.822840035f, 0.19817096f},
-std::array<float,2>{0.284884542f, 0.848147392f},
-std::array<float,2>{0.489556402f, 0.0755461603f},
-std::array<float,2>{0.884571195f, 0.902683675f},
-std::array<float,2>{0.54411447f, 0.375403047f},
-std::array<float,2>{0.107637636f, 0.587006867f},
-std::array<float,2>{0.348459244f, 0.483049452f},
-std::array<float,2>{0.757240415f, 0.505112112f},
-std::array<float,2>{0.721972883f, 0.0247323103f},
-std::array<float,2>{0.230446428f, 0.954646885f},
-std::array<float,2>{0.0155722238f, 0.156114668f},
-std::array<float,2>{0.580694556f, 0.812417269f},
-std::array<float,2>{0.943739176f, 0.304741234f},
-std::array<float,2>{0.408002079f, 0.65558517f},
-std::array<float,2>{0.245617852f, 0.437990725f},
-std::array<float,2>{0.749265611f, 0.536794364f},
-std::array<float,2>{0.773127556f, 0.0385820158f},
-std::array<float,2>{0.361229032f, 0.991897106f},
-std::array<float,2>{0.431865782f, 0.164699256f},
-std::array<float,2>{0.959235072f, 0.767064869f},
-std::array<float,2>{0.566456497f, 0.262889326f},
-std::array<float,2>{0.0306723397f, 0.66873765f},
-std::array<float,2>{0.302660018f, 0.370468944f},
-std::array<float,2>{0.839527905f, 0.725806773f},
-std::array<float,2>{0.644557953f, 0.24139908f},
-std::array<float,2>{0.162525073f, 0.832560301f},
-std::array<float,2>{0.115875497f, 0.122894309f},
-std::array<float,2>{0.555327237f, 0.909492791f},
-std::array<float,2>{0.899134934f, 0.432003021f},
-std::array<float,2>{0.470021397f, 0.598884702f},
-std::array<float,2>{0.0578451492f, 0.29120025f},
-std::array<float,2>{0.61857897f, 0.631749213f},
-std::array<float,2>{0.992450237f, 0.136956662f},
-std::array<float,2>{0.379025728f, 0.79594326f},
-std::array<float,2>{0.318494946f, 0.0125287278f},
-std::array<float,2>{0.800558567f, 0.949761868f},
-std::array<float,2>{0.693034291f, 0.495383918f},
-std::array<float,2>{0.201723889f, 0.525768816f},
-std::array<float,2>{0.455234438f, 0.392846316f},
-std::array<float,2>{0.910273373f, 0.564050555f},
-std::array<float,2>{0.504679024f, 0.0807355344f},
-std::array<float,2>{0.0674807057f, 0.880644262f},
-std::array<float,2>{0.12923789f, 0.213876158f},
-std::array<float,2>{0.668968618f, 0.859470487f},
-std::array<float,2>{0.863832355f, 0.341761768f},
-std::array<float,2>{0.268240601f, 0.699048936f},
-std::array<float,2>{0.0764888078f, 0.477575272f},
-std::array<float,2>{0.512578487f, 0.503063262f},
-std::array<float,2>{0.914882481f, 0.0280433893f},
-std::array<float,2>{0.462953687f, 0.957965612f},
-std::array<float,2>{0.277978063f, 0.150317594f},
-std::array<float,2>{0.870654345f, 0.806249201f},
-std::array<float,2>{0.658170998f, 0.312135071f},
-std::array<float,2>{0.140356004f, 0.650466025f},
-std::array<float,2>{0.384873897f, 0.313077748f},
-std::array<float,2>{0.991210163f, 0.715793133f},
-std::array<float,2>{0.612670302f, 0.199988335f},
-std::array<float,2>{0.0515547991f, 0.845405579f},
-std::array<float,2>{0.190706491f, 0.0714311451f},
-std::array<float,2>{0.695488513f, 0.89999336f},
-std::array<float,2>{0.810390949f, 0.380954564f},
-std::array<float,2>{0.322518915f, 0.593252778f},
-std::array<float,2>{0.167077467f, 0.270433187f},
-std::array<float,2>{0.652947366f, 0.687362075f},
-std::array<float,2>{0.830933452f, 0.177923396f},
-std::array<float,2>{0.306199819f, 0.752983689f},
-std::array<float,2>{0.477545589f, 0.0581295751f},
-std::array<float,2>{0.891905725f, 0.973115385f},
-std::array<float,2>{0.54965502f, 0.462957352f},
-std::array<float,2>{0.11720708f, 0.556502521f},
-std::array<float,2>{0.373068631f, 0.412038058f},
-std::array<float,2>{0.778972268f, 0.624660611f},
-std::array<float,2>{0.737195611f, 0.0940275043f},
-std::array<float,2>{0.234399706f, 0.929348826f},
-std::array<float,2>{0.0234225392f, 0.22556071f},
-std::array<float,2>{0.573790371f, 0.823917329f},
-std::array<float,2>{0.968080461f, 0.348713905f},
-std::array<float,2>{0.426563889f, 0.738859415f},
-std::array<float,2>{0.226514548f, 0.395656943f},
-std::array<float,2>{0.7290923f, 0.570023417f},
-std::array<float,2>{0.759506583f, 0.0826317817f},
-std::array<float,2>{0.355657786f, 0.876172125f},
-std::array<float,2>{0.416207761f, 0.21741949f},
-std::array<float,2>{0.9504686f, 0.866353571f},
-std::array<float,2>{0.589680552f, 0.336780429f},
-std::array<float,2>{0.00172803178f, 0.703107238f},
-std::array<float,2>{0.296491444f, 0.295954555f},
-std::array<float,2>{0.812795579f, 0.627436161f},
-std::array<float,2>{0.637305856f, 0.13590616f},
-std::array<float,2>{0.184545189f, 0.792567492f},
-std::array<float,2>{0.0967516601f, 0.0110395439f},
-std::array<float,2>{0.533729076f, 0.945790529f},
-std::array<float,2>{0.877726316f, 0.497923493f},
-std::array<float,2>{0.494033337f, 0.527355313f},
-std::array<float,2>{0.0340863355f, 0.372080535f},
-std::array<float,2>{0.606846809f, 0.722648263f},
-std::array<float,2>{0.97340858f, 0.236737117f},
-std::array<float,2>{0.401491582f, 0.828986168f},
-std::array<float,2>{0.333040833f, 0.1197832f},
-std::array<float,2>{0.788754642f, 0.913965464f},
-std::array<float,2>{0.711085558f, 0.436817765f},
-std::array<float,2>{0.207928479f, 0.5969491f},
-std::array<float,2>{0.449308693f, 0.444569826f},
-std::array<float,2>{0.931395531f, 0.532970428f},
-std::array<float,2>{0.523708165f, 0.0336548872f},
-std::array<float,2>{0.0898430273f, 0.985328794f},
-std::array<float,2>{0.14448072f, 0.171377629f},
-std::array<float,2>{0.67327261f, 0.771417499f},
-std::array<float,2>{0.84464401f, 0.260462135f},
-std::array<float,2>{0.263642937f, 0.665617526f},
-std::array<float,2>{0.0110719372f, 0.423631907f},
-std::array<float,2>{0.585695267f, 0.603002906f},
-std::array<float,2>{0.94030571f, 0.112770185f},
-std::array<float,2>{0.412923425f, 0.920696616f},
-std::array<float,2>{0.344251394f, 0.249521226f},
-std::array<float,2>{0.751143873f, 0.837784231f},
-std::array<float,2>{0.725685179f, 0.362584352f},
-std::array<float,2>{0.232382834f, 0.733147681f},
-std::array<float,2>{0.486041695f, 0.257056564f},
-std::array<float,2>{0.889624834f, 0.661340654f},
-std::array<float,2>{0.542848289f, 0.157023162f},
-std::array<float,2>{0.103658184f, 0.773834825f},
-std::array<float,2>{0.173337251f, 0.0431352593f},
-std::array<float,2>{0.629812658f, 0.996747971f},
-std::array<float,2>{0.827438891f, 0.450443506f},
-std::array<float,2>{0.287444711f, 0.545883656f},
-std::array<float,2>{0.215811521f, 0.330850124f},
-std::array<float,2>{0.706618428f, 0.692729354f},
-std::array<float,2>{0.79161799f, 0.209677711f},
-std::array<float,2>{0.337004811f, 0.871314287f},
-std::array<float,2>{0.391228229f, 0.0891056955f},
-std::array<float,2>{0.977611005f, 0.886531532f},
-std::array<float,2>{0.598845184f, 0.402553201f},
-std::array<float,2>{0.043781653f, 0.574954808f},
-std::array<float,2>{0.254770398f, 0.491882145f},
-std::array<float,2>{0.853175282f, 0.522566497f},
-std::array<float,2>{0.686734676f, 0.00131126062f},
-std::array<float,2>{0.15241693f, 0.941700757f},
-std::array<float,2>{0.0846853778f, 0.131157517f},
-std::array<float,2>{0.520594537f, 0.786539376f},
-std::array<float,2>{0.926370203f, 0.282027423f},
-std::array<float,2>{0.44130224f, 0.634439886f},
-std::array<float,2>{0.126809597f, 0.459298283f},
-std::array<float,2>{0.666782379f, 0.548133492f},
-std::array<float,2>{0.860850513f, 0.0520420335f},
-std::array<float,2>{0.270212978f, 0.980351865f},
-std::array<float,2>{0.460530162f, 0.185768142f},
-std::array<float,2>{0.907791793f, 0.76487577f},
-std::array<float,2>{0.50260359f, 0.274634778f},
-std::array<float,2>{0.0651778579f, 0.677294791f},
-std::array<float,2>{0.314643294f, 0.356204391f},
-std::array<float,2>{0.801594436f, 0.745103776f},
-std::array<float,2>{0.687564135f, 0.230904967f},
-std::array<float,2>{0.198220044f, 0.814745843f},
-std::array<float,2>{0.0594031364f, 0.102736324f},
-std::array<float,2>{0.622753799f, 0.930832207f},
-std::array<float,2>{0.996338725f, 0.414485127f},
-std::array<float,2>{0.376179338f, 0.614567518f},
-std::array<float,2>{0.112036139f, 0.29993248f},
-std::array<float,2>{0.559496164f, 0.644405842f},
-std::array<float,2>{0.902909875f, 0.145306394f},
-std::array<float,2>{0.472878903f, 0.798162103f},
-std::array<float,2>{0.300416738f, 0.0195961464f},
-std::array<float,2>{0.840094507f, 0.9647609f},
-std::array<float,2>{0.641005456f, 0.472704619f},
-std::array<float,2>{0.158062086f, 0.50957948f},
-std::array<float,2>{0.435312957f, 0.387940377f},
-std::array<float,2>{0.955118299f, 0.585663378f},
-std::array<float,2>{0.563937008f, 0.0682783127f},
-std::array<float,2>{0.0238131527f, 0.893158913f},
-std::array<float,2>{0.249369755f, 0.194999203f},
-std::array<float,2>{0.744663894f, 0.85315299f},
-std::array<float,2>{0.765690267f, 0.326851606f},
-std::array<float,2>{0.364735991f, 0.704009116f},
-std::array<float,2>{0.049491737f, 0.446810305f},
-std::array<float,2>{0.616759717f, 0.542963922f},
-std::array<float,2>{0.985772371f, 0.0420857705f},
-std::array<float,2>{0.387496591f, 0.994404852f},
-std::array<float,2>{0.324987322f, 0.161068633f},
-std::array<float,2>{0.80615449f, 0.77883184f},
-std::array<float,2>{0.700284004f, 0.25243035f},
-std::array<float,2>{0.194380939f, 0.65661335f},
-std::array<float,2>{0.465701669f, 0.365670472f},
-std::array<float,2>{0.921804905f, 0.727661788f},
-std::array<float,2>{0.511040151f, 0.243389383f},
-std::array<float,2>{0.0715224668f, 0.839994013f},
-std::array<float,2>{0.135177165f, 0.11388091f},
-std::array<float,2>{0.660615087f, 0.916010141f},
-std::array<float,2>{0.871720552f, 0.429664433f},
-std::array<float,2>{0.276967794f, 0.605684936f},
-std::array<float,2>{0.238758698f, 0.287890494f},
-std::array<float,2>{0.740500927f, 0.637388289f},
-std::array<float,2>{0.774159431f, 0.126211986f},
-std::array<float,2>{0.369249076f, 0.782000601f},
-std::array<float,2>{0.425667763f, 0.00621965947f},
-std::array<float,2>{0.961618423f, 0.940937042f},
-std::array<float,2>{0.576237798f, 0.486119121f},
-std::array<float,2>{0.0180012751f, 0.51720196f},
-std::array<float,2>{0.310494095f, 0.398952872f},
-std::array<float,2>{0.835306108f, 0.572324693f},
-std::array<float,2>{0.649108171f, 0.0918357447f},
-std::array<float,2>{0.17033264f, 0.887701511f},
-std::array<float,2>{0.124552354f, 0.206576094f},
-std::array<float,2>{0.553567648f, 0.867909491f},
-std::array<float,2>{0.89524889f, 0.33404091f},
-std::array<float,2>{0.483770877f, 0.687944531f},
-std::array<float,2>{0.182383567f, 0.418531716f},
-std::array<float,2>{0.636315286f, 0.611091852f},
-std::array<float,2>{0.817039669f, 0.108639382f},
-std::array<float,2>{0.292774826f, 0.934189498f},
-std::array<float,2>{0.496895313f, 0.227462947f},
-std::array<float,2>{0.880591929f, 0.819411337f},
-std::array<float,2>{0.535666227f, 0.353753358f},
-std::array<float,2>{0.100999855f, 0.748212874f},
-std::array<float,2>{0.35200429f, 0.277619004f},
-std::array<float,2>{0.764976084f, 0.672525227f},
-std::array<float,2>{0.733639538f, 0.18303521f},
-std::array<float,2>{0.220602781f, 0.759808481f},
-std::array<float,2>{0.0044115046f, 0.048748333f},
-std::array<float,2>{0.592392504f, 0.984162807f},
-std::array<float,2>{0.947413385f, 0.455177277f},
-std::array<float,2>{0.418430835f, 0.55396539f},
-std::array<float,2>{0.090140298f, 0.323719412f},
-std::array<float,2>{0.529017329f, 0.708388865f},
-std::array<float,2>{0.935890853f, 0.187941492f},
-std::array<float,2>{0.447761863f, 0.859100163f},
-std::array<float,2>{0.260602295f, 0.0656437799f},
-std::array<float,2>{0.850174606f, 0.895051301f},
-std::array<float,2>{0.67833513f, 0.383219212f},
-std::array<float,2>{0.144956172f, 0.580580294f},
-std::array<float,2>{0.403172404f, 0.471836239f},
-std::array<float,2>{0.970248044f, 0.511939526f},
-std::array<float,2>{0.602251887f, 0.0194617007f},
-std::array<float,2>{0.0366041549f, 0.967159152f},
-std::array<float,2>{0.203917846f, 0.144328311f},
-std::array<float,2>{0.715312898f, 0.801900864f},
-std::array<float,2>{0.782723606f, 0.301752985f},
-std::array<float,2>{0.331642181f, 0.647798538f},
-std::array<float,2>{0.105755687f, 0.378027916f},
-std::array<float,2>{0.545516193f, 0.589130938f},
-std::array<float,2>{0.885477662f, 0.0765987337f},
-std::array<float,2>{0.491948903f, 0.906104624f},
-std::array<float,2>{0.282262176f, 0.197239295f},
-std::array<float,2>{0.820802271f, 0.850635886f},
-std::array<float,2>{0.625790596f, 0.317612618f},
-std::array<float,2>{0.178572968f, 0.712005079f},
-std::array<float,2>{0.409907401f, 0.308218151f},
-std::array<float,2>{0.942101777f, 0.654234469f},
-std::array<float,2>{0.579401374f, 0.153638229f},
-std::array<float,2>{0.0126820551f, 0.809466243f},
-std::array<float,2>{0.226971403f, 0.0259742737f},
-std::array<float,2>{0.718868196f, 0.956322134f},
-std::array<float,2>{0.755652487f, 0.481518f},
-std::array<float,2>{0.351197869f, 0.506227493f},
-std::array<float,2>{0.149824664f, 0.345365465f},
-std::array<float,2>{0.680777013f, 0.736028254f},
-std::array<float,2>{0.859291673f, 0.220059678f},
-std::array<float,2>{0.250012755f, 0.824864626f},
-std::array<float,2>{0.442979574f, 0.0989614651f},
-std::array<float,2>{0.923059583f, 0.922759712f},
-std::array<float,2>{0.517641187f, 0.409850985f},
-std::array<float,2>{0.0811492056f, 0.618860126f},
-std::array<float,2>{0.341520101f, 0.468383819f},
-std::array<float,2>{0.796669483f, 0.558818638f},
-std::array<float,2>{0.709669411f, 0.0593278334f},
-std::array<float,2>{0.211752445f, 0.971440494f},
-std::array<float,2>{0.0427158996f, 0.173687518f},
-std::array<float,2>{0.593866825f, 0.754196942f},
-std::array<float,2>{0.982695341f, 0.269413114f},
-std::array<float,2>{0.395006984f, 0.68338716f},
-std::array<float,2>{0.200903505f, 0.493458807f},
-std::array<float,2>{0.694190025f, 0.523741782f},
-std::array<float,2>{0.797577381f, 0.0144966478f},
-std::array<float,2>{0.318062037f, 0.952195466f},
-std::array<float,2>{0.382187068f, 0.139249906f},
-std::array<float,2>{0.994757593f, 0.793922007f},
-std::array<float,2>{0.620962977f, 0.290416151f},
-std::array<float,2>{0.0559996776f, 0.629734039f},
-std::array<float,2>{0.266229302f, 0.343393028f},
-std::array<float,2>{0.867149651f, 0.695619345f},
-std::array<float,2>{0.669923186f, 0.212233663f},
-std::array<float,2>{0.131322861f, 0.862341583f},
-std::array<float,2>{0.0686882511f, 0.079832308f},
-std::array<float,2>{0.50594902f, 0.882777691f},
-std::array<float,2>{0.913416982f, 0.39139232f},
-std::array<float,2>{0.453969121f, 0.565355361f},
-std::array<float,2>{0.0289926808f, 0.264148921f},
-std::array<float,2>{0.568711996f, 0.67051661f},
-std::array<float,2>{0.958707094f, 0.167485282f},
-std::array<float,2>{0.431611091f, 0.767840326f},
-std::array<float,2>{0.36282903f, 0.0352878831f},
-std::array<float,2>{0.771457672f, 0.988747001f},
-std::array<float,2>{0.747615993f, 0.439470261f},
-std::array<float,2>{0.243703216f, 0.538832188f},
-std::array<float,2>{0.470919847f, 0.431625456f},
-std::array<float,2>{0.90092814f, 0.601213753f},
-std::array<float,2>{0.558531106f, 0.124073736f},
-std::array<float,2>{0.114665039f, 0.907977998f},
-std::array<float,2>{0.161289364f, 0.240209639f},
-std::array<float,2>{0.647191525f, 0.834885657f},
-std::array<float,2>{0.836006165f, 0.367713362f},
-std::array<float,2>{0.304418802f, 0.724171698f},
-std::array<float,2>{0.0883386731f, 0.443334162f},
-std::array<float,2>{0.525108278f, 0.534881949f},
-std::array<float,2>{0.929967761f, 0.0320010632f},
-std::array<float,2>{0.45072332f, 0.988245487f},
-std::array<float,2>{0.262551397f, 0.169901907f},
-std::array<float,2>{0.845589578f, 0.772891819f},
-std::array<float,2>{0.672120929f, 0.258592606f},
-std::array<float,2>{0.142690212f, 0.666852713f},
-std::array<float,2>{0.400533706f, 0.373146921f},
-std::array<float,2>{0.974239171f, 0.719135046f},
-std::array<float,2>{0.605732143f, 0.234667733f},
-std::array<float,2>{0.0342933312f, 0.830650926f},
-std::array<float,2>{0.208706781f, 0.118011519f},
-std::array<float,2>{0.712081313f, 0.911908329f},
-std::array<float,2>{0.787169695f, 0.434149027f},
-std::array<float,2>{0.332200497f, 0.59378624f},
-std::array<float,2>{0.184579954f, 0.293667674f},
-std::array<float,2>{0.637867153f, 0.626144528f},
-std::array<float,2>{0.813650548f, 0.133375347f},
-std::array<float,2>{0.294987917f, 0.789934456f},
-std::array<float,2>{0.493153483f, 0.00782213639f},
-std::array<float,2>{0.878687859f, 0.948599398f},
-std::array<float,2>{0.534355819f, 0.499204248f},
-std::array<float,2>{0.095761098f, 0.529982805f},
-std::array<float,2>{0.356497496f, 0.397769809f},
-std::array<float,2>{0.758787811f, 0.567653656f},
-std::array<float,2>{0.729619384f, 0.0858008265f},
-std::array<float,2>{0.225438118f, 0.878666759f},
-std::array<float,2>{0.000941482373f, 0.216488272f},
-std::array<float,2>{0.588389039f, 0.864407837f},
-std::array<float,2>{0.949889719f, 0.338555217f},
-std::array<float,2>{0.417484283f, 0.700175464f},
-std::array<float,2>{0.235412925f, 0.412290603f},
-std::array<float,2>{0.737559557f, 0.62187326f},
-std::array<float,2>{0.777999401f, 0.0974413231f},
-std::array<float,2>{0.374859154f, 0.926436484f},
-std::array<float,2>{0.427654326f, 0.224582464f},
-std::array<float,2>{0.967261255f, 0.821984887f},
-std::array<float,2>{0.572288275f, 0.350434184f},
-std::array<float,2>{0.0220499001f, 0.740568042f},
-std::array<float,2>{0.305321306f, 0.271545887f},
-std::array<float,2>{0.831277609f, 0.685365081f},
-std::array<float,2>{0.654080629f, 0.176658079f},
-std::array<float,2>{0.166032404f, 0.751164913f},
-std::array<float,2>{0.118943378f, 0.0547542572f},
-std::array<float,2>{0.550706446f, 0.975983083f},
-std::array<float,2>{0.891321898f, 0.462558389f},
-std::array<float,2>{0.476983517f, 0.558132172f},
-std::array<float,2>{0.0521519221f, 0.315483809f},
-std::array<float,2>{0.611374497f, 0.717009723f},
-std::array<float,2>{0.99174118f, 0.201186776f},
-std::array<float,2>{0.38599965f, 0.846959472f},
-std::array<float,2>{0.324117303f, 0.0741237998f},
-std::array<float,2>{0.808748841f, 0.901102602f},
-std::array<float,2>{0.69675386f, 0.379460722f},
-std::array<float,2>{0.190326989f, 0.590111971f},
-std::array<float,2>{0.464605898f, 0.479483187f},
-std::array<float,2>{0.915504634f, 0.500398576f},
-std::array<float,2>{0.513259828f, 0.0311905332f},
-std::array<float,2>{0.0773628876f, 0.960555971f},
-std::array<float,2>{0.139030114f, 0.151805684f},
-std::array<float,2>{0.6571697f, 0.807161748f},
-std::array<float,2>{0.869303823f, 0.310430408f},
-std::array<float,2>{0.279221922f, 0.649955451f},
-std::array<float,2>{0.0249810424f, 0.389679223f},
-std::array<float,2>{0.562521338f, 0.582640707f},
-std::array<float,2>{0.95648849f, 0.0700151175f},
-std::array<float,2>{0.434191614f, 0.891671479f},
-std::array<float,2>{0.363370538f, 0.193130001f},
-std::array<float,2>{0.766764522f, 0.855399609f},
-std::array<float,2>{0.745785892f, 0.324945062f},
-std::array<float,2>{0.248617068f, 0.705523312f},
-std::array<float,2>{0.474272817f, 0.298483759f},
-std::array<float,2>{0.903323233f, 0.64155072f},
-std::array<float,2>{0.560168386f, 0.14841269f},
-std::array<float,2>{0.112411641f, 0.800406992f},
-std::array<float,2>{0.156360716f, 0.0231965557f},
-std::array<float,2>{0.641635358f, 0.962099075f},
-std::array<float,2>{0.841323853f, 0.474763125f},
-std::array<float,2>{0.29935503f, 0.509882092f},
-std::array<float,2>{0.198864505f, 0.358468443f},
-std::array<float,2>{0.689383686f, 0.742842436f},
-std::array<float,2>{0.802039802f, 0.234335274f},
-std::array<float,2>{0.31567955f, 0.813858092f},
-std::array<float,2>{0.375829816f, 0.104910441f},
-std::array<float,2>{0.997621298f, 0.932279587f},
-std::array<float,2>{0.621295214f, 0.416120023f},
-std::array<float,2>{0.059818387f, 0.616490781f},
-std::array<float,2>{0.271317542f, 0.457218885f},
-std::array<float,2>{0.859789848f, 0.550624311f},
-std::array<float,2>{0.667328417f, 0.0528873168f},
-std::array<float,2>{0.125345409f, 0.977053165f},
-std::array<float,2>{0.065438129f, 0.184892878f},
-std::array<float,2>{0.503214478f, 0.761952519f},
-std::array<float,2>{0.90672034f, 0.276184708f},
-std::array<float,2>{0.459381074f, 0.678688765f},
-std::array<float,2>{0.154020816f, 0.489877313f},
-std::array<float,2>{0.685672402f, 0.520917177f},
-std::array<float,2>{0.851852655f, 0.00233836332f},
-std::array<float,2>{0.255749404f, 0.94443351f},
-std::array<float,2>{0.439871877f, 0.130373478f},
-std::array<float,2>{0.927257895f, 0.788911045f},
-std::array<float,2>{0.520339966f, 0.283683866f},
-std::array<float,2>{0.0858617872f, 0.635105252f},
-std::array<float,2>{0.33609578f, 0.328291535f},
-std::array<float,2>{0.792588592f, 0.693557262f},
-std::array<float,2>{0.705693603f, 0.207204357f},
-std::array<float,2>{0.216224596f, 0.874409974f},
-std::array<float,2>{0.0443867296f, 0.0866745412f},
-std::array<float,2>{0.598303616f, 0.883790016f},
-std::array<float,2>{0.9769243f, 0.405771166f},
-std::array<float,2>{0.392445952f, 0.577185154f},
-std::array<float,2>{0.105441675f, 0.255034566f},
-std::array<float,2>{0.541235387f, 0.662517667f},
-std::array<float,2>{0.890440762f, 0.159015089f},
-std::array<float,2>{0.48494184f, 0.775557101f},
-std::array<float,2>{0.28848955f, 0.0465530902f},
-std::array<float,2>{0.826726973f, 0.99874109f},
-std::array<float,2>{0.630254745f, 0.452147752f},
-std::array<float,2>{0.172521099f, 0.543389082f},
-std::array<float,2>{0.413446307f, 0.42576018f},
-std::array<float,2>{0.940553665f, 0.605267465f},
-std::array<float,2>{0.584291697f, 0.110550903f},
-std::array<float,2>{0.0102713155f, 0.918941677f},
-std::array<float,2>{0.230972394f, 0.247310147f},
-std::array<float,2>{0.724932313f, 0.839560688f},
-std::array<float,2>{0.750566721f, 0.359582156f},
-std::array<float,2>{0.345667094f, 0.732029617f},
-std::array<float,2>{0.0354280844f, 0.470631182f},
-std::array<float,2>{0.602812231f, 0.51544261f},
-std::array<float,2>{0.969232142f, 0.0160669442f},
-std::array<float,2>{0.404108644f, 0.966545403f},
-std::array<float,2>{0.330817401f, 0.142343491f},
-std::array<float,2>{0.781352937f, 0.803900063f},
-std::array<float,2>{0.716453493f, 0.304006308f},
-std::array<float,2>{0.204533771f, 0.645476758f},
-std::array<float,2>{0.448369443f, 0.320870042f},
-std::array<float,2>{0.937226653f, 0.710707128f},
-std::array<float,2>{0.528148592f, 0.190191269f},
-std::array<float,2>{0.0914967805f, 0.857170582f},
-std::array<float,2>{0.146444291f, 0.0630623177f},
-std::array<float,2>{0.679595947f, 0.896798134f},
-std::array<float,2>{0.850672424f, 0.385370016f},
-std::array<float,2>{0.261033505f, 0.57922858f},
-std::array<float,2>{0.219233707f, 0.281021029f},
-std::array<float,2>{0.73320812f, 0.674152017f},
-std::array<float,2>{0.764043629f, 0.181586355f},
-std::array<float,2>{0.353421211f, 0.758549452f},
-std::array<float,2>{0.419569224f, 0.0503211841f},
-std::array<float,2>{0.948348343f, 0.980773866f},
-std::array<float,2>{0.593539596f, 0.453705966f},
-std::array<float,2>{0.00585789327f, 0.551707685f},
-std::array<float,2>{0.29115206f, 0.420902133f},
-std::array<float,2>{0.817694604f, 0.612598777f},
-std::array<float,2>{0.635224104f, 0.105483271f},
-std::array<float,2>{0.18264243f, 0.937115848f},
-std::array<float,2>{0.100057371f, 0.22912243f},
-std::array<float,2>{0.537054002f, 0.818217456f},
-std::array<float,2>{0.879724622f, 0.35218513f},
-std::array<float,2>{0.497783303f, 0.746912181f},
-std::array<float,2>{0.171690971f, 0.400630683f},
-std::array<float,2>{0.649849594f, 0.570632756f},
-std::array<float,2>{0.834374905f, 0.0908626169f},
-std::array<float,2>{0.309152126f, 0.889523089f},
-std::array<float,2>{0.483311504f, 0.203620881f},
-std::array<float,2>{0.896081924f, 0.869710565f},
-std::array<float,2>{0.554061651f, 0.333265007f},
-std::array<float,2>{0.123425357f, 0.690151989f},
-std::array<float,2>{0.3709777f, 0.286836207f},
-std::array<float,2>{0.774871469f, 0.640268981f},
-std::array<float,2>{0.74160105f, 0.12812008f},
-std::array<float,2>{0.239559278f, 0.784851551f},
-std::array<float,2>{0.0186714455f, 0.00562436506f},
-std::array<float,2>{0.578085065f, 0.937689304f},
-std::array<float,2>{0.962612152f, 0.48819226f},
-std::array<float,2>{0.424123317f, 0.518961847f},
-std::array<float,2>{0.0706477687f, 0.365068018f},
-std::array<float,2>{0.509954095f, 0.73013711f},
-std::array<float,2>{0.920232832f, 0.244465575f},
-std::array<float,2>{0.466342121f, 0.842348993f},
-std::array<float,2>{0.276222765f, 0.115847737f},
-std::array<float,2>{0.872119069f, 0.917918801f},
-std::array<float,2>{0.661445379f, 0.427505344f},
-std::array<float,2>{0.136557907f, 0.609171331f},
-std::array<float,2>{0.387784153f, 0.448545843f},
-std::array<float,2>{0.984513521f, 0.540687203f},
-std::array<float,2>{0.615965843f, 0.0404183604f},
-std::array<float,2>{0.0505222976f, 0.992248893f},
-std::array<float,2>{0.19390741f, 0.162871733f},
-std::array<float,2>{0.699666321f, 0.779973388f},
-std::array<float,2>{0.805103302f, 0.250994563f},
-std::array<float,2>{0.326155752f, 0.658713281f},
-std::array<float,2>{0.113460772f, 0.433002025f},
-std::array<float,2>{0.556648552f, 0.598407626f},
-std::array<float,2>{0.901760221f, 0.121706158f},
-std::array<float,2>{0.472004473f, 0.908681393f},
-std::array<float,2>{0.303185672f, 0.240942776f},
-std::array<float,2>{0.837368429f, 0.83332634f},
-std::array<float,2>{0.647977054f, 0.369411409f},
-std::array<float,2>{0.160839126f, 0.725571036f},
-std::array<float,2>{0.429742068f, 0.26233536f},
-std::array<float,2>{0.957519591f, 0.669611156f},
-std::array<float,2>{0.569555521f, 0.165994167f},
-std::array<float,2>{0.0274619907f, 0.766202152f},
-std::array<float,2>{0.242969453f, 0.0371971093f},
-std::array<float,2>{0.746158779f, 0.991132915f},
-std::array<float,2>{0.770430207f, 0.438778639f},
-std::array<float,2>{0.362009525f, 0.53541255f},
-std::array<float,2>{0.13231422f, 0.340150237f},
-std::array<float,2>{0.671733975f, 0.698164701f},
-std::array<float,2>{0.865817368f, 0.213637054f},
-std::array<float,2>{0.267108172f, 0.860814154f},
-std::array<float,2>{0.4543612f, 0.0813132524f},
-std::array<float,2>{0.912959278f, 0.878932416f},
-std::array<float,2>{0.507397354f, 0.394392878f},
-std::array<float,2>{0.070311524f, 0.562696099f},
-std::array<float,2>{0.317241192f, 0.4950023f},
-std::array<float,2>{0.798713505f, 0.527324975f},
-std::array<float,2>{0.695151508f, 0.0130980797f},
-std::array<float,2>{0.200053558f, 0.950652659f},
-std::array<float,2>{0.0556187145f, 0.138660505f},
-std::array<float,2>{0.619606793f, 0.79525274f},
-std::array<float,2>{0.995702744f, 0.292339087f},
-std::array<float,2>{0.381195813f, 0.632184923f},
-std::array<float,2>{0.212236896f, 0.466039777f},
-std::array<float,2>{0.710154891f, 0.561291516f},
-std::array<float,2>{0.79568404f, 0.060823191f},
-std::array<float,2>{0.34038353f, 0.970564008f},
-std::array<float,2>{0.396302134f, 0.175360695f},
-std::array<float,2>{0.983581781f, 0.756271422f},
-std::array<float,2>{0.595516205f, 0.267176807f},
-std::array<float,2>{0.0411888286f, 0.68158263f},
-std::array<float,2>{0.251585335f, 0.346519977f},
-std::array<float,2>{0.857583225f, 0.737763226f},
-std::array<float,2>{0.680568099f, 0.221003726f},
-std::array<float,2>{0.148678064f, 0.827079833f},
-std::array<float,2>{0.0804918334f, 0.100746498f},
-std::array<float,2>{0.519497514f, 0.924007237f},
-std::array<float,2>{0.922079444f, 0.407870948f},
-std::array<float,2>{0.441963583f, 0.620914161f},
-std::array<float,2>{0.0127363941f, 0.305763036f},
-std::array<float,2>{0.578903973f, 0.654939353f},
-std::array<float,2>{0.943274081f, 0.154685229f},
-std::array<float,2>{0.409021378f, 0.811365604f},
-std::array<float,2>{0.350473225f, 0.0243777707f},
-std::array<float,2>{0.754008234f, 0.953816295f},
-std::array<float,2>{0.720703125f, 0.484343112f},
-std::array<float,2>{0.227552414f, 0.504006028f},
-std::array<float,2>{0.490650713f, 0.376789361f},
-std::array<float,2>{0.885911405f, 0.586854577f},
-std::array<float,2>{0.5465675f, 0.0746102706f},
-std::array<float,2>{0.107190363f, 0.90411216f},
-std::array<float,2>{0.178719819f, 0.198428035f},
-std::array<float,2>{0.626782537f, 0.848651886f},
-std::array<float,2>{0.822084367f, 0.319039702f},
-std::array<float,2>{0.282029331f, 0.713627577f},
-std::array<float,2>{0.0954787582f, 0.496258885f},
-std::array<float,2>{0.531992733f, 0.528627038f},
-std::array<float,2>{0.875242233f, 0.00986363087f},
-std::array<float,2>{0.494580477f, 0.946481109f},
-std::array<float,2>{0.29345277f, 0.134990469f},
-std::array<float,2>{0.816226125f, 0.791221619f},
-std::array<float,2>{0.640173912f, 0.295133054f},
-std::array<float,2>{0.187284276f, 0.628429592f},
-std::array<float,2>{0.415936112f, 0.337785244f},
-std::array<float,2>{0.951705277f, 0.702002764f},
-std::array<float,2>{0.587034345f, 0.218227744f},
-std::array<float,2>{0.00279259286f, 0.865708411f},
-std::array<float,2>{0.224079624f, 0.0837458894f},
-std::array<float,2>{0.727920413f, 0.875388563f},
-std::array<float,2>{0.760493517f, 0.395269275f},
-std::array<float,2>{0.359108001f, 0.569128335f},
-std::array<float,2>{0.140889466f, 0.261646628f},
-std::array<float,2>{0.674384654f, 0.664166868f},
-std::array<float,2>{0.846368194f, 0.170063406f},
-std::array<float,2>{0.265617281f, 0.770137548f},
-std::array<float,2>{0.453054667f, 0.0341962427f},
-std::array<float,2>{0.932484627f, 0.985668182f},
-std::array<float,2>{0.526570678f, 0.443830937f},
-std::array<float,2>{0.086184144f, 0.531485379f},
-std::array<float,2>{0.335788697f, 0.436307102f},
-std::array<float,2>{0.785765886f, 0.596061826f},
-std::array<float,2>{0.714054644f, 0.120204642f},
-std::array<float,2>{0.210911706f, 0.912387609f},
-std::array<float,2>{0.0317604989f, 0.237784564f},
-std::array<float,2>{0.608535826f, 0.829524994f},
-std::array<float,2>{0.976147056f, 0.371452153f},
-std::array<float,2>{0.399313211f, 0.72130549f},
-std::array<float,2>{0.188789308f, 0.381962568f},
-std::array<float,2>{0.697720766f, 0.591881275f},
-std::array<float,2>{0.812135696f, 0.0704979077f},
-std::array<float,2>{0.32214421f, 0.898778379f},
-std::array<float,2>{0.383417308f, 0.200768426f},
-std::array<float,2>{0.989471257f, 0.844461977f},
-std::array<float,2>{0.610018134f, 0.313963026f},
-std::array<float,2>{0.0543789975f, 0.715924203f},
-std::array<float,2>{0.281127483f, 0.310769498f},
-std::array<float,2>{0.867761791f, 0.652051926f},
-std::array<float,2>{0.659072161f, 0.148456916f},
-std::array<float,2>{0.138372868f, 0.804753304f},
-std::array<float,2>{0.0748333558f, 0.0289181508f},
-std::array<float,2>{0.514040768f, 0.958692551f},
-std::array<float,2>{0.917180657f, 0.477366298f},
-std::array<float,2>{0.461723089f, 0.501964927f},
-std::array<float,2>{0.0210920442f, 0.348374158f},
-std::array<float,2>{0.570637941f, 0.739409089f},
-std::array<float,2>{0.966573238f, 0.225749165f},
-std::array<float,2>{0.428275317f, 0.82237488f},
-std::array<float,2>{0.371251851f, 0.0952409953f},
-std::array<float,2>{0.780649126f, 0.928485692f},
-std::array<float,2>{0.73531425f, 0.410416007f},
-std::array<float,2>{0.236421213f, 0.623974383f},
-std::array<float,2>{0.478773624f, 0.464453608f},
-std::array<float,2>{0.893475235f, 0.555327237f},
-std::array<float,2>{0.548410475f, 0.057002198f},
-std::array<float,2>{0.120028421f, 0.974385858f},
-std::array<float,2>{0.164227605f, 0.179026216f},
-std::array<float,2>{0.655927658f, 0.752747953f},
-std::array<float,2>{0.828955531f, 0.27071017f},
-std::array<float,2>{0.306943893f, 0.686128855f},
-std::array<float,2>{0.0620524585f, 0.415120989f},
-std::array<float,2>{0.623702884f, 0.613439977f},
-std::array<float,2>{0.998064458f, 0.102167904f},
-std::array<float,2>{0.378719449f, 0.929864466f},
-std::array<float,2>{0.313233644f, 0.231473401f},
-std::array<float,2>{0.803389072f, 0.815970421f},
-std::array<float,2>{0.690328121f, 0.357209146f},
-std::array<float,2>{0.195588157f, 0.746035695f},
-std::array<float,2>{0.458762676f, 0.273981065f},
-std::array<float,2>{0.909541368f, 0.676111162f},
-std::array<float,2>{0.500655353f, 0.187476426f},
-std::array<float,2>{0.0637192875f, 0.764483809f},
-std::array<float,2>{0.128476664f, 0.0509183109f},
-std::array<float,2>{0.664324045f, 0.978847384f},
-std::array<float,2>{0.863203704f, 0.460070491f},
-std::array<float,2>{0.27209264f, 0.547494352f},
-std::array<float,2>{0.247495577f, 0.327866852f},
-std::array<float,2>{0.743518293f, 0.704125166f},
-std::array<float,2>{0.768064082f, 0.193625569f},
-std::array<float,2>{0.366237551f, 0.851654649f},
-std::array<float,2>{0.436322868f, 0.0671008304f},
-std::array<float,2>{0.954072893f, 0.894513071f},
-std::array<float,2>{0.564760625f, 0.387244701f},
-std::array<float,2>{0.0269279517f, 0.584413588f},
-std::array<float,2>{0.297149569f, 0.473726094f},
-std::array<float,2>{0.843424916f, 0.508580327f},
-std::array<float,2>{0.644494534f, 0.0206234809f},
-std::array<float,2>{0.159735277f, 0.962926388f},
-std::array<float,2>{0.111138664f, 0.146405563f},
-std::array<float,2>{0.561866879f, 0.797748923f},
-std::array<float,2>{0.905641854f, 0.299530923f},
-std::array<float,2>{0.47634995f, 0.643523753f},
-std::array<float,2>{0.174239337f, 0.449451089f},
-std::array<float,2>{0.632199049f, 0.546452999f},
-std::array<float,2>{0.82455045f, 0.0447852947f},
-std::array<float,2>{0.287095785f, 0.997345746f},
-std::array<float,2>{0.487005651f, 0.157701969f},
-std::array<float,2>{0.887276053f, 0.774715483f},
-std::array<float,2>{0.540788889f, 0.256108493f},
-std::array<float,2>{0.10348779f, 0.660347044f},
-std::array<float,2>{0.345788151f, 0.361947507f},
-std::array<float,2>{0.752290487f, 0.733413994f},
-std::array<float,2>{0.723351955f, 0.24820213f},
-std::array<float,2>{0.233026639f, 0.836568892f},
-std::array<float,2>{0.00876301061f, 0.111396067f},
-std::array<float,2>{0.582508743f, 0.921557426f},
-std::array<float,2>{0.93754667f, 0.422711879f},
-std::array<float,2>{0.410482585f, 0.602229238f},
-std::array<float,2>{0.0826102942f, 0.282268107f},
-std::array<float,2>{0.522484541f, 0.633490205f},
-std::array<float,2>{0.928816855f, 0.132265225f},
-std::array<float,2>{0.438357979f, 0.785501182f},
-std::array<float,2>{0.25681591f, 0.000850652519f},
-std::array<float,2>{0.854722679f, 0.942841828f},
-std::array<float,2>{0.684442222f, 0.490822405f},
-std::array<float,2>{0.154527649f, 0.521593511f},
-std::array<float,2>{0.392637283f, 0.40367505f},
-std::array<float,2>{0.979609787f, 0.575862825f},
-std::array<float,2>{0.60128361f, 0.0886032954f},
-std::array<float,2>{0.045639623f, 0.885569751f},
-std::array<float,2>{0.218177661f, 0.210719347f},
-std::array<float,2>{0.703393459f, 0.872581601f},
-std::array<float,2>{0.78976655f, 0.331756324f},
-std::array<float,2>{0.338434935f, 0.691917002f},
-std::array<float,2>{0.0061839507f, 0.456798643f},
-std::array<float,2>{0.591509402f, 0.552784085f},
-std::array<float,2>{0.946403265f, 0.0469666198f},
-std::array<float,2>{0.42112416f, 0.982901871f},
-std::array<float,2>{0.353722602f, 0.182014421f},
-std::array<float,2>{0.763337374f, 0.761030197f},
-std::array<float,2>{0.731299758f, 0.278760135f},
-std::array<float,2>{0.22235027f, 0.673723221f},
-std::array<float,2>{0.498215258f, 0.355220705f},
-std::array<float,2>{0.882269263f, 0.749967635f},
-std::array<float,2>{0.538470805f, 0.228046447f},
-std::array<float,2>{0.0986768231f, 0.818978369f},
-std::array<float,2>{0.180483595f, 0.107614204f},
-std::array<float,2>{0.633030415f, 0.93460077f},
-std::array<float,2>{0.819718003f, 0.419473708f},
-std::array<float,2>{0.290095896f, 0.61025399f},
-std::array<float,2>{0.205147475f, 0.301810771f},
-std::array<float,2>{0.717289507f, 0.646562099f},
-std::array<float,2>{0.783620596f, 0.143068433f},
-std::array<float,2>{0.328453988f, 0.801332951f},
-std::array<float,2>{0.404456645f, 0.0177310631f},
-std::array<float,2>{0.970783472f, 0.968645096f},
-std::array<float,2>{0.605089962f, 0.471095622f},
-std::array<float,2>{0.0373231582f, 0.513666153f},
-std::array<float,2>{0.25837779f, 0.384447157f},
-std::array<float,2>{0.84799403f, 0.581654787f},
-std::array<float,2>{0.677666426f, 0.0649841502f},
-std::array<float,2>{0.148420021f, 0.895715058f},
-std::array<float,2>{0.0931704938f, 0.189148843f},
-std::array<float,2>{0.53101927f, 0.858317256f},
-std::array<float,2>{0.934146523f, 0.323143929f},
-std::array<float,2>{0.44554159f, 0.707715213f},
-std::array<float,2>{0.133061767f, 0.427865535f},
-std::array<float,2>{0.662643969f, 0.607325673f},
-std::array<float,2>{0.873388827f, 0.115057155f},
-std::array<float,2>{0.273769528f, 0.914795756f},
-std::array<float,2>{0.468726397f, 0.242190599f},
-std::array<float,2>{0.919469774f, 0.841605186f},
-std::array<float,2>{0.509762287f, 0.366575241f},
-std::array<float,2>{0.0735377297f, 0.726938784f},
-std::array<float,2>{0.327182472f, 0.253165483f},
-std::array<float,2>{0.808070004f, 0.65748632f},
-std::array<float,2>{0.701355457f, 0.161534905f},
-std::array<float,2>{0.192178562f, 0.777836025f},
-std::array<float,2>{0.0478369519f, 0.0411689766f},
-std::array<float,2>{0.613398612f, 0.995666504f},
-std::array<float,2>{0.987872958f, 0.44562006f},
-std::array<float,2>{0.389276028f, 0.541593492f},
-std::array<float,2>{0.122169532f, 0.335454524f},
-std::array<float,2>{0.550988019f, 0.688623428f},
-std::array<float,2>{0.896550119f, 0.205989808f},
-std::array<float,2>{0.481406987f, 0.868400753f},
-std::array<float,2>{0.312145859f, 0.0931325331f},
-std::array<float,2>{0.832109809f, 0.887636006f},
-std::array<float,2>{0.650716186f, 0.39996925f},
-std::array<float,2>{0.168692857f, 0.574069262f},
-std::array<float,2>{0.423283398f, 0.484500706f},
-std::array<float,2>{0.963894486f, 0.515913367f},
-std::array<float,2>{0.574581861f, 0.00720342854f},
-std::array<float,2>{0.0167929195f, 0.940008342f},
-std::array<float,2>{0.241110742f, 0.125618517f},
-std::array<float,2>{0.74006784f, 0.78260994f},
-std::array<float,2>{0.776684165f, 0.289057583f},
-std::array<float,2>{0.368948907f, 0.63827014f},
-std::array<float,2>{0.066808559f, 0.391845524f},
-std::array<float,2>{0.505846083f, 0.566000581f},
-std::array<float,2>{0.911380529f, 0.0787473395f},
-std::array<float,2>{0.45678553f, 0.881029725f},
-std::array<float,2>{0.269250154f, 0.211076185f},
-std::array<float,2>{0.865032732f, 0.861399114f},
-std::array<float,2>{0.668138206f, 0.341823578f},
-std::array<float,2>{0.130400091f, 0.696724653f},
-std::array<float,2>{0.380169839f, 0.28913492f},
-std::array<float,2>{0.993741989f, 0.63015765f},
-std::array<float,2>{0.617272615f, 0.14040336f},
-std::array<float,2>{0.0572659969f, 0.793971777f},
-std::array<float,2>{0.202441812f, 0.014839231f},
-std::array<float,2>{0.691618621f, 0.952085257f},
-std::array<float,2>{0.799630046f, 0.492220223f},
-std::array<float,2>{0.319645315f, 0.524716139f},
-std::array<float,2>{0.163344324f, 0.36822927f},
-std::array<float,2>{0.646125972f, 0.722844362f},
-std::array<float,2>{0.8382864f, 0.238808081f},
-std::array<float,2>{0.300910622f, 0.835382462f},
-std::array<float,2>{0.469260454f, 0.123815596f},
-std::array<float,2>{0.899888217f, 0.906543672f},
-std::array<float,2>{0.556301832f, 0.430089295f},
-std::array<float,2>{0.117135957f, 0.600126505f},
-std::array<float,2>{0.359603941f, 0.440840453f},
-std::array<float,2>{0.771881044f, 0.537268579f},
-std::array<float,2>{0.74838227f, 0.0364879556f},
-std::array<float,2>{0.244252518f, 0.989287496f},
-std::array<float,2>{0.0296248365f, 0.166328967f},
-std::array<float,2>{0.567691684f, 0.768996f},
-std::array<float,2>{0.960336566f, 0.265526116f},
-std::array<float,2>{0.433220088f, 0.671653926f},
-std::array<float,2>{0.228667825f, 0.481184721f},
-std::array<float,2>{0.721385419f, 0.507683277f},
-std::array<float,2>{0.756771564f, 0.0268610138f},
-std::array<float,2>{0.349560589f, 0.95589602f},
-std::array<float,2>{0.406794488f, 0.15258719f},
-std::array<float,2>{0.944737673f, 0.8101542f},
-std::array<float,2>{0.581560314f, 0.306659102f},
-std::array<float,2>{0.0142323198f, 0.653068483f},
-std::array<float,2>{0.284096152f, 0.316815555f},
-std::array<float,2>{0.823541999f, 0.711147308f},
-std::array<float,2>{0.62868762f, 0.195535764f},
-std::array<float,2>{0.176231429f, 0.850186229f},
-std::array<float,2>{0.109315947f, 0.0775556341f},
-std::array<float,2>{0.543065369f, 0.904725254f},
-std::array<float,2>{0.883507788f, 0.377078176f},
-std::array<float,2>{0.48837468f, 0.588482022f},
-std::array<float,2>{0.0399029925f, 0.267747223f},
-std::array<float,2>{0.596425474f, 0.681693673f},
-std::array<float,2>{0.981564105f, 0.172136948f},
-std::array<float,2>{0.397920489f, 0.755438507f},
-std::array<float,2>{0.342338622f, 0.0596231706f},
-std::array<float,2>{0.793345809f, 0.971794546f},
-std::array<float,2>{0.708980441f, 0.467306256f},
-std::array<float,2>{0.213537514f, 0.560413122f},
-std::array<float,2>{0.44345656f, 0.409148723f},
-std::array<float,2>{0.924952269f, 0.617641449f},
-std::array<float,2>{0.517379165f, 0.0986016616f},
-std::array<float,2>{0.0782244802f, 0.922969937f},
-std::array<float,2>{0.150465131f, 0.218840048f},
-std::array<float,2>{0.682587683f, 0.825244904f},
-std::array<float,2>{0.856447339f, 0.344129592f},
-std::array<float,2>{0.253371775f, 0.734428585f},
-std::array<float,2>{0.115702294f, 0.438635975f},
-std::array<float,2>{0.554705203f, 0.535234511f},
-std::array<float,2>{0.898492575f, 0.0374716744f},
-std::array<float,2>{0.470300198f, 0.990793765f},
-std::array<float,2>{0.302055627f, 0.165732443f},
-std::array<float,2>{0.838912308f, 0.766549647f},
-std::array<float,2>{0.645203829f, 0.262495518f},
-std::array<float,2>{0.162649095f, 0.669705153f},
-std::array<float,2>{0.432590246f, 0.369310021f},
-std::array<float,2>{0.959521711f, 0.725156188f},
-std::array<float,2>{0.567044675f, 0.241151229f},
-std::array<float,2>{0.0308118574f, 0.833186805f},
-std::array<float,2>{0.245194063f, 0.121912114f},
-std::array<float,2>{0.749948442f, 0.908361197f},
-std::array<float,2>{0.772553563f, 0.432792962f},
-std::array<float,2>{0.360775143f, 0.598350346f},
-std::array<float,2>{0.129676536f, 0.292186856f},
-std::array<float,2>{0.669748485f, 0.631946564f},
-std::array<float,2>{0.863756776f, 0.138201356f},
-std::array<float,2>{0.267735779f, 0.794968367f},
-std::array<float,2>{0.455693424f, 0.0127846207f},
-std::array<float,2>{0.910970271f, 0.950223863f},
-std::array<float,2>{0.504093111f, 0.494696736f},
-std::array<float,2>{0.0679576769f, 0.526905596f},
-std::array<float,2>{0.319335341f, 0.394213438f},
-std::array<float,2>{0.800248802f, 0.56277281f},
-std::array<float,2>{0.692826033f, 0.0812329575f},
-std::array<float,2>{0.201421648f, 0.879313409f},
-std::array<float,2>{0.0583579168f, 0.213547155f},
-std::array<float,2>{0.618707418f, 0.86049521f},
-std::array<float,2>{0.99274081f, 0.340084076f},
-std::array<float,2>{0.379772186f, 0.697937846f},
-std::array<float,2>{0.214594498f, 0.407999903f},
-std::array<float,2>{0.707833886f, 0.6206429f},
-std::array<float,2>{0.794582486f, 0.100986987f},
-std::array<float,2>{0.343546957f, 0.924190819f},
-std::array<float,2>{0.397307724f, 0.220780879f},
-std::array<float,2>{0.981420338f, 0.826812983f},
-std::array<float,2>{0.5970397f, 0.346207201f},
-std::array<float,2>{0.0403137356f, 0.737437785f},
-std::array<float,2>{0.252282083f, 0.267459899f},
-std::array<float,2>{0.856171846f, 0.68126601f},
-std::array<float,2>{0.683573902f, 0.175669432f},
-std::array<float,2>{0.151626736f, 0.755878031f},
-std::array<float,2>{0.0791960955f, 0.060715694f},
-std::array<float,2>{0.516153455f, 0.970447719f},
-std::array<float,2>{0.924250484f, 0.466147184f},
-std::array<float,2>{0.444689035f, 0.561257482f},
-std::array<float,2>{0.0147953108f, 0.319177091f},
-std::array<float,2>{0.580205381f, 0.713572502f},
-std::array<float,2>{0.944001317f, 0.198618338f},
-std::array<float,2>{0.40743947f, 0.848919809f},
-std::array<float,2>{0.348015994f, 0.0742241144f},
-std::array<float,2>{0.757702529f, 0.903940558f},
-std::array<float,2>{0.722228825f, 0.376510501f},
-std::array<float,2>{0.229748428f, 0.586558998f},
-std::array<float,2>{0.490033209f, 0.484129369f},
-std::array<float,2>{0.884273648f, 0.504153609f},
-std::array<float,2>{0.54489702f, 0.0241354201f},
-std::array<float,2>{0.108365573f, 0.954039931f},
-std::array<float,2>{0.177620634f, 0.154489934f},
-std::array<float,2>{0.627830207f, 0.811146438f},
-std::array<float,2>{0.822526932f, 0.305998206f},
-std::array<float,2>{0.284609944f, 0.655202985f},
-std::array<float,2>{0.0388122723f, 0.385700822f},
-std::array<float,2>{0.603565633f, 0.579523087f},
-std::array<float,2>{0.972112179f, 0.0633105263f},
-std::array<float,2>{0.405630171f, 0.896514118f},
-std::array<float,2>{0.329853892f, 0.190111756f},
-std::array<float,2>{0.784360826f, 0.85730952f},
-std::array<float,2>{0.718296051f, 0.321133018f},
-std::array<float,2>{0.206922531f, 0.710660756f},
-std::array<float,2>{0.446873248f, 0.303922445f},
-std::array<float,2>{0.934712529f, 0.645189941f},
-std::array<float,2>{0.529765248f, 0.142176747f},
-std::array<float,2>{0.091916807f, 0.804082811f},
-std::array<float,2>{0.147306129f, 0.0157893337f},
-std::array<float,2>{0.676662922f, 0.966775f},
-std::array<float,2>{0.848635077f, 0.470365226f},
-std::array<float,2>{0.25907594f, 0.515164077f},
-std::array<float,2>{0.221452236f, 0.352476984f},
-std::array<float,2>{0.732274711f, 0.746801019f},
-std::array<float,2>{0.762383044f, 0.229385257f},
-std::array<float,2>{0.355101168f, 0.818029821f},
-std::array<float,2>{0.420396984f, 0.1057439f},
-std::array<float,2>{0.9457165f, 0.937382936f},
-std::array<float,2>{0.590537906f, 0.421246588f},
-std::array<float,2>{0.0077621555f, 0.612312973f},
-std::array<float,2>{0.290024698f, 0.453969955f},
-std::array<float,2>{0.818501413f, 0.551409602f},
-std::array<float,2>{0.633949995f, 0.0506728739f},
-std::array<float,2>{0.181094944f, 0.980486631f},
-std::array<float,2>{0.0983450338f, 0.181221798f},
-std::array<float,2>{0.537573874f, 0.758399129f},
-std::array<float,2>{0.881132066f, 0.280964822f},
-std::array<float,2>{0.499223292f, 0.673996449f},
-std::array<float,2>{0.169248864f, 0.487856686f},
-std::array<float,2>{0.651520133f, 0.518723011f},
-std::array<float,2>{0.83349812f, 0.00554176001f},
-std::array<float,2>{0.310762912f, 0.937918305f},
-std::array<float,2>{0.482259661f, 0.128241032f},
-std::array<float,2>{0.897626221f, 0.784939229f},
-std::array<float,2>{0.551849067f, 0.287061304f},
-std::array<float,2>{0.12175899f, 0.640427709f},
-std::array<float,2>{0.36787501f, 0.333140105f},
-std::array<float,2>{0.776335478f, 0.690315425f},
-std::array<float,2>{0.738586962f, 0.203963205f},
-std::array<float,2>{0.24164483f, 0.87007606f},
-std::array<float,2>{0.015640337f, 0.0912287086f},
-std::array<float,2>{0.575707376f, 0.88930732f},
-std::array<float,2>{0.963620245f, 0.400866508f},
-std::array<float,2>{0.422530413f, 0.570325434f},
-std::array<float,2>{0.0730576888f, 0.251412809f},
-std::array<float,2>{0.508093715f, 0.658960164f},
-std::array<float,2>{0.918632507f, 0.162780389f},
-std::array<float,2>{0.466808498f, 0.780207276f},
-std::array<float,2>{0.274465829f, 0.0402005054f},
-std::array<float,2>{0.874766886f, 0.992655516f},
-std::array<float,2>{0.663285732f, 0.4482584f},
-std::array<float,2>{0.134177685f, 0.540872335f},
-std::array<float,2>{0.390522301f, 0.427307934f},
-std::array<float,2>{0.986825407f, 0.608897924f},
-std::array<float,2>{0.614672542f, 0.115999117f},
-std::array<float,2>{0.0484530181f, 0.917565346f},
-std::array<float,2>{0.192834616f, 0.244357407f},
-std::array<float,2>{0.702543557f, 0.842764378f},
-std::array<float,2>{0.80687362f, 0.364941359f},
-std::array<float,2>{0.326307654f, 0.730322838f},
-std::array<float,2>{0.0254588071f, 0.474996567f},
-std::array<float,2>{0.566105425f, 0.510051429f},
-std::array<float,2>{0.954968572f, 0.0231530201f},
-std::array<float,2>{0.437104285f, 0.962283731f},
-std::array<float,2>{0.365852505f, 0.148118317f},
-std::array<float,2>{0.768557966f, 0.800605536f},
-std::array<float,2>{0.742842019f, 0.298805863f},
-std::array<float,2>{0.247048438f, 0.641230881f},
-std::array<float,2>{0.475268483f, 0.324982911f},
-std::array<float,2>{0.904398382f, 0.705184698f},
-std::array<float,2>{0.560684383f, 0.192977965f},
-std::array<float,2>{0.109984845f, 0.855087578f},
-std::array<float,2>{0.159028858f, 0.0702279061f},
-std::array<float,2>{0.643334568f, 0.89189893f},
-std::array<float,2>{0.842448056f, 0.389924169f},
-std::array<float,2>{0.297955513f, 0.58279705f},
-std::array<float,2>{0.19682765f, 0.275937915f},
-std::array<float,2>{0.69054985f, 0.67826426f},
-std::array<float,2>{0.804418027f, 0.184587926f},
-std::array<float,2>{0.31434077f, 0.76218307f},
-std::array<float,2>{0.377884418f, 0.0531109609f},
-std::array<float,2>{0.999104977f, 0.977421343f},
-std::array<float,2>{0.624306083f, 0.457467735f},
-std::array<float,2>{0.0609605871f, 0.55031234f},
-std::array<float,2>{0.272849441f, 0.416488081f},
-std::array<float,2>{0.861958802f, 0.616342366f},
-std::array<float,2>{0.665863514f, 0.104551673f},
-std::array<float,2>{0.127004594f, 0.932499051f},
-std::array<float,2>{0.0630814508f, 0.233906969f},
-std::array<float,2>{0.501645446f, 0.813480735f},
-std::array<float,2>{0.909179151f, 0.358863294f},
-std::array<float,2>{0.457219422f, 0.742961764f},
-std::array<float,2>{0.155291513f, 0.406247258f},
-std::array<float,2>{0.684753537f, 0.577591598f},
-std::array<float,2>{0.853775918f, 0.0865150243f},
-std::array<float,2>{0.257113665f, 0.884087265f},
-std::array<float,2>{0.439325392f, 0.207478374f},
-std::array<float,2>{0.928671241f, 0.874078631f},
-std::array<float,2>{0.52223295f, 0.328471065f},
-std::array<float,2>{0.0835819095f, 0.693699718f},
-std::array<float,2>{0.338983208f, 0.283420533f},
-std::array<float,2>{0.790979028f, 0.634999514f},
-std::array<float,2>{0.704837978f, 0.130718395f},
-std::array<float,2>{0.217086896f, 0.788733125f},
-std::array<float,2>{0.0463871695f, 0.00214501284f},
-std::array<float,2>{0.600436091f, 0.944594383f},
-std::array<float,2>{0.978810787f, 0.49002406f},
-std::array<float,2>{0.393671185f, 0.52053529f},
-std::array<float,2>{0.101813823f, 0.359690517f},
-std::array<float,2>{0.539488614f, 0.732283592f},
-std::array<float,2>{0.888519526f, 0.247558191f},
-std::array<float,2>{0.487330407f, 0.839716077f},
-std::array<float,2>{0.285899311f, 0.110741921f},
-std::array<float,2>{0.826028287f, 0.918604136f},
-std::array<float,2>{0.631018698f, 0.42551586f},
-std::array<float,2>{0.175250947f, 0.605180383f},
-std::array<float,2>{0.411651939f, 0.451714098f},
-std::array<float,2>{0.938791692f, 0.543058395f},
-std::array<float,2>{0.583837628f, 0.0468204953f},
-std::array<float,2>{0.00942012016f, 0.998881161f},
-std::array<float,2>{0.234343156f, 0.158737957f},
-std::array<float,2>{0.724538028f, 0.775841832f},
-std::array<float,2>{0.75363332f, 0.255177677f},
-std::array<float,2>{0.347063959f, 0.662127972f},
-std::array<float,2>{0.0876177028f, 0.434545994f},
-std::array<float,2>{0.526061237f, 0.594045401f},
-std::array<float,2>{0.933385313f, 0.117873177f},
-std::array<float,2>{0.451952577f, 0.911658645f},
-std::array<float,2>{0.264086723f, 0.234583437f},
-std::array<float,2>{0.847540677f, 0.83084029f},
-std::array<float,2>{0.675571561f, 0.373500168f},
-std::array<float,2>{0.142387688f, 0.718875766f},
-std::array<float,2>{0.399811387f, 0.258517832f},
-std::array<float,2>{0.975161552f, 0.666727483f},
-std::array<float,2>{0.607907116f, 0.169588149f},
-std::array<float,2>{0.0326069482f, 0.772623003f},
-std::array<float,2>{0.209281817f, 0.0319632143f},
-std::array<float,2>{0.713371992f, 0.987954617f},
-std::array<float,2>{0.786398351f, 0.442966431f},
-std::array<float,2>{0.334742606f, 0.534939528f},
-std::array<float,2>{0.186150149f, 0.338843197f},
-std::array<float,2>{0.639055312f, 0.699763417f},
-std::array<float,2>{0.8149876f, 0.216763258f},
-std::array<float,2>{0.294693917f, 0.864636362f},
-std::array<float,2>{0.495471925f, 0.0855342001f},
-std::array<float,2>{0.876466393f, 0.878542781f},
-std::array<float,2>{0.532819986f, 0.397617817f},
-std::array<float,2>{0.0943640172f, 0.567613065f},
-std::array<float,2>{0.358132005f, 0.499332994f},
-std::array<float,2>{0.761166632f, 0.530158699f},
-std::array<float,2>{0.727401912f, 0.00821931381f},
-std::array<float,2>{0.222929254f, 0.948396623f},
-std::array<float,2>{0.00336693274f, 0.133720785f},
-std::array<float,2>{0.586336911f, 0.789573193f},
-std::array<float,2>{0.952500582f, 0.293718725f},
-std::array<float,2>{0.41429171f, 0.626319587f},
-std::array<float,2>{0.237988308f, 0.462780893f},
-std::array<float,2>{0.735386312f, 0.558548033f},
-std::array<float,2>{0.779907048f, 0.0551460125f},
-std::array<float,2>{0.37295115f, 0.975727439f},
-std::array<float,2>{0.429182798f, 0.176476806f},
-std::array<float,2>{0.965625167f, 0.751259983f},
-std::array<float,2>{0.571502507f, 0.271789312f},
-std::array<float,2>{0.0198698286f, 0.685234487f},
-std::array<float,2>{0.308467835f, 0.350167632f},
-std::array<float,2>{0.829750359f, 0.740278542f},
-std::array<float,2>{0.655214071f, 0.224133924f},
-std::array<float,2>{0.165607587f, 0.822260022f},
-std::array<float,2>{0.120125443f, 0.097343199f},
-std::array<float,2>{0.547044694f, 0.926634729f},
-std::array<float,2>{0.894392788f, 0.412566811f},
-std::array<float,2>{0.480265677f, 0.621716976f},
-std::array<float,2>{0.0535125621f, 0.310252726f},
-std::array<float,2>{0.61044085f, 0.650243938f},
-std::array<float,2>{0.988386035f, 0.151410267f},
-std::array<float,2>{0.383965582f, 0.807583213f},
-std::array<float,2>{0.320544422f, 0.030923415f},
-std::array<float,2>{0.810948133f, 0.960896552f},
-std::array<float,2>{0.699162543f, 0.479228258f},
-std::array<float,2>{0.188382626f, 0.50002116f},
-std::array<float,2>{0.461917698f, 0.37963897f},
-std::array<float,2>{0.916509569f, 0.589895964f},
-std::array<float,2>{0.515107512f, 0.0739265308f},
-std::array<float,2>{0.075921908f, 0.901233017f},
-std::array<float,2>{0.137337551f, 0.201584533f},
-std::array<float,2>{0.659573495f, 0.846894145f},
-std::array<float,2>{0.868981302f, 0.315864235f},
-std::array<float,2>{0.279600561f, 0.717199802f},
-std::array<float,2>{0.0690248311f, 0.49244684f},
-std::array<float,2>{0.506379187f, 0.524610758f},
-std::array<float,2>{0.913704515f, 0.0150188785f},
-std::array<float,2>{0.453180015f, 0.951673269f},
-std::array<float,2>{0.266038209f, 0.140231654f},
-std::array<float,2>{0.866263866f, 0.794413209f},
-std::array<float,2>{0.670827389f, 0.289391607f},
-std::array<float,2>{0.131489024f, 0.63008672f},
-std::array<float,2>{0.382568568f, 0.342175573f},
-std::array<float,2>{0.994187295f, 0.69649905f},
-std::array<float,2>{0.620289028f, 0.211251453f},
-std::array<float,2>{0.0563678481f, 0.861712098f},
-std::array<float,2>{0.200333863f, 0.0789530501f},
-std::array<float,2>{0.693671048f, 0.881227255f},
-std::array<float,2>{0.797120035f, 0.392020792f},
-std::array<float,2>{0.317773521f, 0.566368222f},
-std::array<float,2>{0.162072077f, 0.265268743f},
-std::array<float,2>{0.646555662f, 0.67139262f},
-std::array<float,2>{0.836715639f, 0.166090056f},
-std::array<float,2>{0.303775489f, 0.768659651f},
-std::array<float,2>{0.47138232f, 0.0363521837f},
-std::array<float,2>{0.900637865f, 0.989719391f},
-std::array<float,2>{0.557926774f, 0.440603435f},
-std::array<float,2>{0.114771843f, 0.537463188f},
-std::array<float,2>{0.362699807f, 0.429893494f},
-std::array<float,2>{0.770790756f, 0.600540698f},
-std::array<float,2>{0.747522771f, 0.123700328f},
-std::array<float,2>{0.243633971f, 0.906408131f},
-std::array<float,2>{0.0283848308f, 0.239045084f},
-std::array<float,2>{0.569031298f, 0.835045815f},
-std::array<float,2>{0.958292544f, 0.368450403f},
-std::array<float,2>{0.430804729f, 0.7229321f},
-std::array<float,2>{0.227346882f, 0.377419919f},
-std::array<float,2>{0.719577134f, 0.588837802f},
-std::array<float,2>{0.755072951f, 0.077194348f},
-std::array<float,2>{0.350939751f, 0.904307008f},
-std::array<float,2>{0.409234315f, 0.195654064f},
-std::array<float,2>{0.941620648f, 0.850501955f},
-std::array<float,2>{0.579959869f, 0.31659171f},
-std::array<float,2>{0.0118202483f, 0.71121031f},
-std::array<float,2>{0.282931179f, 0.306905925f},
-std::array<float,2>{0.820602298f, 0.653080881f},
-std::array<float,2>{0.62543416f, 0.152814448f},
-std::array<float,2>{0.177973911f, 0.810478806f},
-std::array<float,2>{0.106018059f, 0.0273106787f},
-std::array<float,2>{0.544927657f, 0.955731392f},
-std::array<float,2>{0.884939194f, 0.481251776f},
-std::array<float,2>{0.491395116f, 0.507542729f},
-std::array<float,2>{0.0421764478f, 0.343841255f},
-std::array<float,2>{0.594563603f, 0.734768987f},
-std::array<float,2>{0.983000338f, 0.219158053f},
-std::array<float,2>{0.39537701f, 0.825440884f},
-std::array<float,2>{0.340957969f, 0.0982876047f},
-std::array<float,2>{0.796383381f, 0.923153341f},
-std::array<float,2>{0.709015012f, 0.408730716f},
-std::array<float,2>{0.211378142f, 0.617227316f},
-std::array<float,2>{0.442697883f, 0.467534184f},
-std::array<float,2>{0.923345327f, 0.56022191f},
-std::array<float,2>{0.518222928f, 0.0598890409f},
-std::array<float,2>{0.0819769874f, 0.9719432f},
-std::array<float,2>{0.150234014f, 0.171999604f},
-std::array<float,2>{0.681505024f, 0.755621016f},
-std::array<float,2>{0.858839691f, 0.267956585f},
-std::array<float,2>{0.250802517f, 0.682051718f},
-std::array<float,2>{0.0042382516f, 0.419908881f},
-std::array<float,2>{0.59209007f, 0.610028565f},
-std::array<float,2>{0.947967768f, 0.107872568f},
-std::array<float,2>{0.418482035f, 0.934843302f},
-std::array<float,2>{0.35250476f, 0.228425413f},
-std::array<float,2>{0.76521492f, 0.819246352f},
-std::array<float,2>{0.734088302f, 0.355299592f},
-std::array<float,2>{0.220205203f, 0.749736071f},
-std::array<float,2>{0.496295094f, 0.278418183f},
-std::array<float,2>{0.880282819f, 0.673455358f},
-std::array<float,2>{0.53554213f, 0.181719154f},
-std::array<float,2>{0.101368219f, 0.760828853f},
-std::array<float,2>{0.181889579f, 0.0472719632f},
-std::array<float,2>{0.635934711f, 0.982446074f},
-std::array<float,2>{0.816515446f, 0.456640989f},
-std::array<float,2>{0.292478353f, 0.553200424f},
-std::array<float,2>{0.203591004f, 0.322838724f},
-std::array<float,2>{0.715778112f, 0.707801282f},
-std::array<float,2>{0.782457292f, 0.189252451f},
-std::array<float,2>{0.331088603f, 0.858128488f},
-std::array<float,2>{0.402395368f, 0.065358609f},
-std::array<float,2>{0.969800472f, 0.89594686f},
-std::array<float,2>{0.601847708f, 0.384765327f},
-std::array<float,2>{0.0366836004f, 0.581962466f},
-std::array<float,2>{0.260156602f, 0.47092396f},
-std::array<float,2>{0.8497383f, 0.513270974f},
-std::array<float,2>{0.678038538f, 0.018064715f},
-std::array<float,2>{0.145055369f, 0.968486488f},
-std::array<float,2>{0.0903466865f, 0.143340498f},
-std::array<float,2>{0.528606236f, 0.801600993f},
-std::array<float,2>{0.936140418f, 0.302120298f},
-std::array<float,2>{0.447720706f, 0.646859527f},
-std::array<float,2>{0.135518149f, 0.445326537f},
-std::array<float,2>{0.660661995f, 0.541789293f},
-std::array<float,2>{0.871243954f, 0.0414521918f},
-std::array<float,2>{0.27675882f, 0.995922327f},
-std::array<float,2>{0.465132177f, 0.16134721f},
-std::array<float,2>{0.921195686f, 0.778192282f},
-std::array<float,2>{0.511600018f, 0.253257245f},
-std::array<float,2>{0.0720046237f, 0.657365739f},
-std::array<float,2>{0.324469924f, 0.366329491f},
-std::array<float,2>{0.805869281f, 0.72659415f},
-std::array<float,2>{0.701093137f, 0.242576987f},
-std::array<float,2>{0.194981322f, 0.841341674f},
-std::array<float,2>{0.0490763336f, 0.11475718f},
-std::array<float,2>{0.616256714f, 0.914708197f},
-std::array<float,2>{0.986132503f, 0.428026944f},
-std::array<float,2>{0.387029231f, 0.607076883f},
-std::array<float,2>{0.124404579f, 0.288679063f},
-std::array<float,2>{0.552763999f, 0.638595045f},
-std::array<float,2>{0.894720554f, 0.125805661f},
-std::array<float,2>{0.484162569f, 0.782453656f},
-std::array<float,2>{0.309668213f, 0.00704980968f},
-std::array<float,2>{0.835722744f, 0.940188587f},
-std::array<float,2>{0.648447573f, 0.484694421f},
-std::array<float,2>{0.170497507f, 0.515727878f},
-std::array<float,2>{0.425186276f, 0.400376499f},
-std::array<float,2>{0.961424887f, 0.573740065f},
-std::array<float,2>{0.576804817f, 0.0928978026f},
-std::array<float,2>{0.0181984827f, 0.887408555f},
-std::array<float,2>{0.238887772f, 0.20573622f},
-std::array<float,2>{0.741085887f, 0.868446827f},
-std::array<float,2>{0.773518145f, 0.33571592f},
-std::array<float,2>{0.369939387f, 0.688747644f},
-std::array<float,2>{0.0589645095f, 0.460220158f},
-std::array<float,2>{0.622283041f, 0.547824085f},
-std::array<float,2>{0.996617079f, 0.0511046015f},
-std::array<float,2>{0.376493275f, 0.978551865f},
-std::array<float,2>{0.315393925f, 0.187075123f},
-std::array<float,2>{0.801169872f, 0.764202893f},
-std::array<float,2>{0.688151956f, 0.274347991f},
-std::array<float,2>{0.197630599f, 0.675982594f},
-std::array<float,2>{0.460161865f, 0.356964976f},
-std::array<float,2>{0.907570839f, 0.745804667f},
-std::array<float,2>{0.502064228f, 0.23177883f},
-std::array<float,2>{0.0645676553f, 0.81632942f},
-std::array<float,2>{0.12608391f, 0.102405064f},
-std::array<float,2>{0.666259944f, 0.930150688f},
-std::array<float,2>{0.860370398f, 0.415308982f},
-std::array<float,2>{0.269532651f, 0.613726974f},
-std::array<float,2>{0.249969199f, 0.299769759f},
-std::array<float,2>{0.744394362f, 0.643200874f},
-std::array<float,2>{0.766358674f, 0.146098584f},
-std::array<float,2>{0.36516133f, 0.797546387f},
-std::array<float,2>{0.434796512f, 0.0208277311f},
-std::array<float,2>{0.955708683f, 0.963354528f},
-std::array<float,2>{0.564025044f, 0.473905772f},
-std::array<float,2>{0.0241283793f, 0.508394241f},
-std::array<float,2>{0.300109893f, 0.387691319f},
-std::array<float,2>{0.840753734f, 0.584039748f},
-std::array<float,2>{0.641184628f, 0.0671686754f},
-std::array<float,2>{0.157244816f, 0.89420104f},
-std::array<float,2>{0.111464098f, 0.193500072f},
-std::array<float,2>{0.558636248f, 0.851846278f},
-std::array<float,2>{0.902444065f, 0.327888638f},
-std::array<float,2>{0.473362237f, 0.704418302f},
-std::array<float,2>{0.173367053f, 0.422518998f},
-std::array<float,2>{0.629022181f, 0.602437735f},
-std::array<float,2>{0.827877998f, 0.111739509f},
-std::array<float,2>{0.28770268f, 0.921838105f},
-std::array<float,2>{0.485836267f, 0.248331442f},
-std::array<float,2>{0.888946474f, 0.836767852f},
-std::array<float,2>{0.542102993f, 0.362071902f},
-std::array<float,2>{0.104409426f, 0.7338534f},
-std::array<float,2>{0.343841881f, 0.256091237f},
-std::array<float,2>{0.75188005f, 0.660436988f},
-std::array<float,2>{0.726501465f, 0.157281935f},
-std::array<float,2>{0.231891319f, 0.774585009f},
-std::array<float,2>{0.0115332128f, 0.0444795564f},
-std::array<float,2>{0.585033417f, 0.99726969f},
-std::array<float,2>{0.93980372f, 0.449642181f},
-std::array<float,2>{0.412230909f, 0.54683727f},
-std::array<float,2>{0.0840873793f, 0.33201471f},
-std::array<float,2>{0.521130443f, 0.692357421f},
-std::array<float,2>{0.92615515f, 0.210659683f},
-std::array<float,2>{0.44046396f, 0.87284255f},
-std::array<float,2>{0.25424087f, 0.08864934f},
-std::array<float,2>{0.852955282f, 0.885384321f},
-std::array<float,2>{0.687398851f, 0.403365076f},
-std::array<float,2>{0.15308395f, 0.576007187f},
-std::array<float,2>{0.390843332f, 0.491134524f},
-std::array<float,2>{0.978496194f, 0.521789014f},
-std::array<float,2>{0.599206746f, 0.000654375763f},
-std::array<float,2>{0.0433695875f, 0.942448139f},
-std::array<float,2>{0.214912206f, 0.13199088f},
-std::array<float,2>{0.70650208f, 0.785169184f},
-std::array<float,2>{0.79135412f, 0.282628417f},
-std::array<float,2>{0.337441593f, 0.63354826f},
-std::array<float,2>{0.0975299031f, 0.395135075f},
-std::array<float,2>{0.533685029f, 0.569003284f},
-std::array<float,2>{0.877244651f, 0.0836825222f},
-std::array<float,2>{0.493383825f, 0.875028729f},
-std::array<float,2>{0.296349287f, 0.217816681f},
-std::array<float,2>{0.81301409f, 0.865313649f},
-std::array<float,2>{0.63689518f, 0.337508738f},
-std::array<float,2>{0.183599383f, 0.701880753f},
-std::array<float,2>{0.41694662f, 0.295312285f},
-std::array<float,2>{0.951119661f, 0.628731906f},
-std::array<float,2>{0.588902831f, 0.135082379f},
-std::array<float,2>{0.00136300549f, 0.791301131f},
-std::array<float,2>{0.225867137f, 0.0100286677f},
-std::array<float,2>{0.728937447f, 0.94653368f},
-std::array<float,2>{0.759149849f, 0.496388644f},
-std::array<float,2>{0.356185853f, 0.528472722f},
-std::array<float,2>{0.143739581f, 0.371235579f},
-std::array<float,2>{0.673780918f, 0.721657097f},
-std::array<float,2>{0.844200313f, 0.237473205f},
-std::array<float,2>{0.262875468f, 0.829223633f},
-std::array<float,2>{0.44972229f, 0.120523557f},
-std::array<float,2>{0.930734575f, 0.912346363f},
-std::array<float,2>{0.524121463f, 0.436089993f},
-std::array<float,2>{0.0893257335f, 0.595746219f},
-std::array<float,2>{0.333939165f, 0.44354251f},
-std::array<float,2>{0.788163602f, 0.531590164f},
-std::array<float,2>{0.711720109f, 0.0344732739f},
-std::array<float,2>{0.207417399f, 0.98555249f},
-std::array<float,2>{0.0336415693f, 0.17026794f},
-std::array<float,2>{0.607019663f, 0.770444691f},
-std::array<float,2>{0.972936749f, 0.261458278f},
-std::array<float,2>{0.401887566f, 0.664330423f},
-std::array<float,2>{0.191242203f, 0.477078766f},
-std::array<float,2>{0.696061134f, 0.502344072f},
-std::array<float,2>{0.809680223f, 0.0292486902f},
-std::array<float,2>{0.322878599f, 0.958817482f},
-std::array<float,2>{0.385373861f, 0.148859367f},
-std::array<float,2>{0.990237534f, 0.804998934f},
-std::array<float,2>{0.613096833f, 0.310906142f},
-std::array<float,2>{0.0509669483f, 0.652318716f},
-std::array<float,2>{0.277552485f, 0.313645869f},
-std::array<float,2>{0.870336294f, 0.716270804f},
-std::array<float,2>{0.657305837f, 0.2010324f},
-std::array<float,2>{0.139990538f, 0.844512224f},
-std::array<float,2>{0.0769623592f, 0.0706013143f},
-std::array<float,2>{0.512161136f, 0.898527741f},
-std::array<float,2>{0.914169967f, 0.382181078f},
-std::array<float,2>{0.463425457f, 0.592131734f},
-std::array<float,2>{0.0226543248f, 0.27084282f},
-std::array<float,2>{0.57332021f, 0.686421335f},
-std::array<float,2>{0.968394518f, 0.178953081f},
-std::array<float,2>{0.425822198f, 0.752607703f},
-std::array<float,2>{0.373537809f, 0.0567181073f},
-std::array<float,2>{0.778669059f, 0.974290371f},
-std::array<float,2>{0.736626029f, 0.464768857f},
-std::array<float,2>{0.235269755f, 0.555618048f},
-std::array<float,2>{0.478143454f, 0.410184085f},
-std::array<float,2>{0.892193139f, 0.623766899f},
-std::array<float,2>{0.548871577f, 0.0954637975f},
-std::array<float,2>{0.118118703f, 0.928427517f},
-std::array<float,2>{0.167680085f, 0.226016834f},
-std::array<float,2>{0.652493417f, 0.822743893f},
-std::array<float,2>{0.830380499f, 0.348522335f},
-std::array<float,2>{0.305738121f, 0.739601076f},
-std::array<float,2>{0.0808651075f, 0.4653427f},
-std::array<float,2>{0.51896292f, 0.561623871f},
-std::array<float,2>{0.922581434f, 0.0617963448f},
-std::array<float,2>{0.441481113f, 0.969466627f},
-std::array<float,2>{0.251174301f, 0.174444661f},
-std::array<float,2>{0.858264446f, 0.75761658f},
-std::array<float,2>{0.67975384f, 0.265671194f},
-std::array<float,2>{0.149378255f, 0.679791033f},
-std::array<float,2>{0.395554423f, 0.347192496f},
-std::array<float,2>{0.984190285f, 0.736590445f},
-std::array<float,2>{0.594823837f, 0.222553954f},
-std::array<float,2>{0.0415396728f, 0.827707589f},
-std::array<float,2>{0.212459818f, 0.0997506604f},
-std::array<float,2>{0.710932434f, 0.925011039f},
-std::array<float,2>{0.795361996f, 0.407104403f},
-std::array<float,2>{0.339933395f, 0.619577706f},
-std::array<float,2>{0.179246321f, 0.305058658f},
-std::array<float,2>{0.626181543f, 0.655504405f},
-std::array<float,2>{0.821749389f, 0.155997828f},
-std::array<float,2>{0.281660229f, 0.812111914f},
-std::array<float,2>{0.491086334f, 0.0244697072f},
-std::array<float,2>{0.886278272f, 0.95505929f},
-std::array<float,2>{0.546305597f, 0.483277828f},
-std::array<float,2>{0.106709935f, 0.505227506f},
-std::array<float,2>{0.349817514f, 0.37508902f},
-std::array<float,2>{0.754868925f, 0.587166309f},
-std::array<float,2>{0.720037997f, 0.0754193515f},
-std::array<float,2>{0.228512481f, 0.902587771f},
-std::array<float,2>{0.0132630868f, 0.197950006f},
-std::array<float,2>{0.578534067f, 0.848538637f},
-std::array<float,2>{0.942541063f, 0.32028085f},
-std::array<float,2>{0.408311248f, 0.714219213f},
-std::array<float,2>{0.242543951f, 0.431806147f},
-std::array<float,2>{0.746902168f, 0.598635495f},
-std::array<float,2>{0.769846141f, 0.122709028f},
-std::array<float,2>{0.361698151f, 0.909376323f},
-std::array<float,2>{0.430431664f, 0.241477713f},
-std::array<float,2>{0.957356513f, 0.832956433f},
-std::array<float,2>{0.570300341f, 0.370199859f},
-std::array<float,2>{0.0280856192f, 0.725954533f},
-std::array<float,2>{0.303540051f, 0.263068914f},
-std::array<float,2>{0.837578118f, 0.668689728f},
-std::array<float,2>{0.64775157f, 0.164978445f},
-std::array<float,2>{0.160461128f, 0.766777217f},
-std::array<float,2>{0.114161894f, 0.0388972573f},
-std::array<float,2>{0.557463348f, 0.992067695f},
-std::array<float,2>{0.902110279f, 0.438352138f},
-std::array<float,2>{0.472532213f, 0.536926389f},
-std::array<float,2>{0.0550837889f, 0.341480613f},
-std::array<float,2>{0.61974144f, 0.69890511f},
-std::array<float,2>{0.995343447f, 0.21412392f},
-std::array<float,2>{0.381398976f, 0.859845877f},
-std::array<float,2>{0.316579849f, 0.0808132589f},
-std::array<float,2>{0.798324704f, 0.88038528f},
-std::array<float,2>{0.694682181f, 0.392591834f},
-std::array<float,2>{0.199625671f, 0.564371765f},
-std::array<float,2>{0.455049127f, 0.495160967f},
-std::array<float,2>{0.91216749f, 0.52553302f},
-std::array<float,2>{0.507167757f, 0.0124402689f},
-std::array<float,2>{0.0695453137f, 0.950025856f},
-std::array<float,2>{0.13241148f, 0.137013137f},
-std::array<float,2>{0.670966268f, 0.796167016f},
-std::array<float,2>{0.865699351f, 0.29148218f},
-std::array<float,2>{0.266650528f, 0.631578088f},
-std::array<float,2>{0.0191113912f, 0.401917666f},
-std::array<float,2>{0.577558458f, 0.57215035f},
-std::array<float,2>{0.962184012f, 0.0903048888f},
-std::array<float,2>{0.424375683f, 0.889672458f},
-std::array<float,2>{0.370237738f, 0.204807922f},
-std::array<float,2>{0.775212586f, 0.870409846f},
-std::array<float,2>{0.742016375f, 0.332856268f},
-std::array<float,2>{0.239807308f, 0.691274226f},
-std::array<float,2>{0.482818663f, 0.285785466f},
-std::array<float,2>{0.895523667f, 0.638866842f},
-std::array<float,2>{0.554469168f, 0.12750563f},
-std::array<float,2>{0.123555444f, 0.78345722f},
-std::array<float,2>{0.170915499f, 0.00394635741f},
-std::array<float,2>{0.649927139f, 0.939029098f},
-std::array<float,2>{0.834693789f, 0.48695004f},
-std::array<float,2>{0.308705807f, 0.518449128f},
-std::array<float,2>{0.193777651f, 0.364226252f},
-std::array<float,2>{0.699777961f, 0.729293048f},
-std::array<float,2>{0.805564284f, 0.245850161f},
-std::array<float,2>{0.325488359f, 0.842881799f},
-std::array<float,2>{0.388411611f, 0.11623238f},
-std::array<float,2>{0.985000551f, 0.916848183f},
-std::array<float,2>{0.615550518f, 0.426193565f},
-std::array<float,2>{0.0500819162f, 0.608115196f},
-std::array<float,2>{0.275535971f, 0.448013902f},
-std::array<float,2>{0.872799516f, 0.539445579f},
-std::array<float,2>{0.661683202f, 0.0398745947f},
-std::array<float,2>{0.135920659f, 0.993818521f},
-std::array<float,2>{0.0709709823f, 0.163209021f},
-std::array<float,2>{0.51072681f, 0.780283213f},
-std::array<float,2>{0.92076236f, 0.25023374f},
-std::array<float,2>{0.465933561f, 0.659815431f},
-std::array<float,2>{0.145867631f, 0.469338894f},
-std::array<float,2>{0.678906977f, 0.514415681f},
-std::array<float,2>{0.851277232f, 0.0171616245f},
-std::array<float,2>{0.261611223f, 0.965561986f},
-std::array<float,2>{0.449036211f, 0.141199395f},
-std::array<float,2>{0.936985016f, 0.803388476f},
-std::array<float,2>{0.52737999f, 0.303424001f},
-std::array<float,2>{0.0909662768f, 0.645730972f},
-std::array<float,2>{0.33054322f, 0.321606338f},
-std::array<float,2>{0.782008111f, 0.709651351f},
-std::array<float,2>{0.716068625f, 0.190582663f},
-std::array<float,2>{0.204749778f, 0.855503678f},
-std::array<float,2>{0.0359632298f, 0.0634881631f},
-std::array<float,2>{0.60315603f, 0.897532344f},
-std::array<float,2>{0.969492614f, 0.386678159f},
-std::array<float,2>{0.403618544f, 0.578614593f},
-std::array<float,2>{0.100392528f, 0.27941972f},
-std::array<float,2>{0.536443472f, 0.674982667f},
-std::array<float,2>{0.878914058f, 0.179731146f},
-std::array<float,2>{0.497434765f, 0.759495556f},
-std::array<float,2>{0.291508317f, 0.0496622473f},
-std::array<float,2>{0.818328738f, 0.981800079f},
-std::array<float,2>{0.635462224f, 0.454453409f},
-std::array<float,2>{0.183203414f, 0.552593052f},
-std::array<float,2>{0.419011265f, 0.420195252f},
-std::array<float,2>{0.948737442f, 0.611827433f},
-std::array<float,2>{0.592948675f, 0.106552616f},
-std::array<float,2>{0.00524660759f, 0.935869277f},
-std::array<float,2>{0.219463095f, 0.230015457f},
-std::array<float,2>{0.732711911f, 0.816718042f},
-std::array<float,2>{0.764395416f, 0.353059053f},
-std::array<float,2>{0.35257104f, 0.747178972f},
-std::array<float,2>{0.0445105247f, 0.489215106f},
-std::array<float,2>{0.597678006f, 0.519872546f},
-std::array<float,2>{0.977432668f, 0.00328829885f},
-std::array<float,2>{0.392029345f, 0.943607092f},
-std::array<float,2>{0.336482614f, 0.12952508f},
-std::array<float,2>{0.792150974f, 0.787686825f},
-std::array<float,2>{0.705368996f, 0.284575611f},
-std::array<float,2>{0.216723144f, 0.636439264f},
-std::array<float,2>{0.440391123f, 0.329113156f},
-std::array<float,2>{0.9270311f, 0.695053935f},
-std::array<float,2>{0.519814134f, 0.208744258f},
-std::array<float,2>{0.0851855651f, 0.873381019f},
-std::array<float,2>{0.153604686f, 0.0875938013f},
-std::array<float,2>{0.686393142f, 0.88375026f},
-std::array<float,2>{0.852358401f, 0.405108154f},
-std::array<float,2>{0.254938185f, 0.576872468f},
-std::array<float,2>{0.230652243f, 0.254457086f},
-std::array<float,2>{0.725369096f, 0.664051116f},
-std::array<float,2>{0.750363588f, 0.160084844f},
-std::array<float,2>{0.345158219f, 0.776793897f},
-std::array<float,2>{0.413747847f, 0.0454228558f},
-std::array<float,2>{0.941144645f, 0.99914068f},
-std::array<float,2>{0.584485948f, 0.452172548f},
-std::array<float,2>{0.010132269f, 0.544767499f},
-std::array<float,2>{0.288632423f, 0.424265057f},
-std::array<float,2>{0.826492131f, 0.603943467f},
-std::array<float,2>{0.630625308f, 0.109427296f},
-std::array<float,2>{0.172092021f, 0.919426143f},
-std::array<float,2>{0.104734875f, 0.246164858f},
-std::array<float,2>{0.541856468f, 0.837980509f},
-std::array<float,2>{0.889778495f, 0.361248821f},
-std::array<float,2>{0.484482199f, 0.731433749f},
-std::array<float,2>{0.156889498f, 0.38878569f},
-std::array<float,2>{0.642304122f, 0.583964705f},
-std::array<float,2>{0.841064811f, 0.0686591566f},
-std::array<float,2>{0.299178034f, 0.890870333f},
-std::array<float,2>{0.474103928f, 0.192171216f},
-std::array<float,2>{0.904167593f, 0.853865147f},
-std::array<float,2>{0.559849679f, 0.325742185f},
-std::array<float,2>{0.112839147f, 0.706556976f},
-std::array<float,2>{0.364185959f, 0.297448575f},
-std::array<float,2>{0.767292917f, 0.642338753f},
-std::array<float,2>{0.745118141f, 0.146756172f},
-std::array<float,2>{0.248146683f, 0.799023271f},
-std::array<float,2>{0.0245913956f, 0.0223578606f},
-std::array<float,2>{0.563421428f, 0.960957825f},
-std::array<float,2>{0.956965804f, 0.475605071f},
-std::array<float,2>{0.433871597f, 0.51081419f},
-std::array<float,2>{0.0661681667f, 0.358055443f},
-std::array<float,2>{0.503517628f, 0.743207932f},
-std::array<float,2>{0.906961262f, 0.233278915f},
-std::array<float,2>{0.459562033f, 0.813317895f},
-std::array<float,2>{0.27054283f, 0.104262762f},
-std::array<float,2>{0.860172808f, 0.9326666f},
-std::array<float,2>{0.667822301f, 0.417327762f},
-std::array<float,2>{0.125495926f, 0.615757644f},
-std::array<float,2>{0.375115752f, 0.458669454f},
-std::array<float,2>{0.997500122f, 0.548921168f},
-std::array<float,2>{0.621799052f, 0.0542176366f},
-std::array<float,2>{0.0602362119f, 0.977951288f},
-std::array<float,2>{0.198540792f, 0.183696315f},
-std::array<float,2>{0.68869108f, 0.763327658f},
-std::array<float,2>{0.802558482f, 0.276790947f},
-std::array<float,2>{0.316394657f, 0.679430246f},
-std::array<float,2>{0.118309669f, 0.413815975f},
-std::array<float,2>{0.549870551f, 0.622184634f},
-std::array<float,2>{0.890971005f, 0.0957377851f},
-std::array<float,2>{0.477374524f, 0.927420616f},
-std::array<float,2>{0.305145681f, 0.223383427f},
-std::array<float,2>{0.831898391f, 0.821065187f},
-std::array<float,2>{0.653424859f, 0.350842386f},
-std::array<float,2>{0.166936144f, 0.741220891f},
-std::array<float,2>{0.427242935f, 0.273262054f},
-std::array<float,2>{0.967314661f, 0.683785379f},
-std::array<float,2>{0.572977662f, 0.177674502f},
-std::array<float,2>{0.0216685683f, 0.750252485f},
-std::array<float,2>{0.236125201f, 0.0558794104f},
-std::array<float,2>{0.738063157f, 0.975401223f},
-std::array<float,2>{0.777420223f, 0.461554676f},
-std::array<float,2>{0.374381721f, 0.557312131f},
-std::array<float,2>{0.139172763f, 0.315167785f},
-std::array<float,2>{0.656476974f, 0.717858255f},
-std::array<float,2>{0.869669914f, 0.202543676f},
-std::array<float,2>{0.278662652f, 0.84580785f},
-std::array<float,2>{0.464268535f, 0.0726809725f},
-std::array<float,2>{0.915586889f, 0.902204931f},
-std::array<float,2>{0.513076663f, 0.380828619f},
-std::array<float,2>{0.077922143f, 0.591626763f},
-std::array<float,2>{0.323293656f, 0.480314404f},
-std::array<float,2>{0.809308052f, 0.501051366f},
-std::array<float,2>{0.696893752f, 0.0295492671f},
-std::array<float,2>{0.189784899f, 0.959947288f},
-std::array<float,2>{0.0522876941f, 0.150951847f},
-std::array<float,2>{0.612265766f, 0.807770967f},
-std::array<float,2>{0.991654456f, 0.309316605f},
-std::array<float,2>{0.386611164f, 0.649050236f},
-std::array<float,2>{0.208307639f, 0.441514313f},
-std::array<float,2>{0.712571084f, 0.53376025f},
-std::array<float,2>{0.787922204f, 0.0327499807f},
-std::array<float,2>{0.332929999f, 0.986955106f},
-std::array<float,2>{0.401301205f, 0.168736786f},
-std::array<float,2>{0.973785877f, 0.771882594f},
-std::array<float,2>{0.606194317f, 0.258818299f},
-std::array<float,2>{0.0351127051f, 0.667735457f},
-std::array<float,2>{0.262202173f, 0.374575466f},
-std::array<float,2>{0.84479785f, 0.720638096f},
-std::array<float,2>{0.672749043f, 0.235809445f},
-std::array<float,2>{0.143442184f, 0.831362665f},
-std::array<float,2>{0.0886531025f, 0.118783951f},
-std::array<float,2>{0.524862349f, 0.910729587f},
-std::array<float,2>{0.930197775f, 0.435106367f},
-std::array<float,2>{0.450209558f, 0.594969869f},
-std::array<float,2>{2.1644908e-05f, 0.294603437f},
-std::array<float,2>{0.588216424f, 0.625911891f},
-std::array<float,2>{0.949392855f, 0.133967504f},
-std::array<float,2>{0.417110384f, 0.790131211f},
-std::array<float,2>{0.357361823f, 0.00959353428f},
-std::array<float,2>{0.758183718f, 0.947790384f},
-std::array<float,2>{0.730092585f, 0.498090059f},
-std::array<float,2>{0.224874571f, 0.530827641f},
-std::array<float,2>{0.492468596f, 0.396552503f},
-std::array<float,2>{0.878208518f, 0.566639185f},
-std::array<float,2>{0.534954727f, 0.0842912942f},
-std::array<float,2>{0.0963841081f, 0.877579153f},
-std::array<float,2>{0.185461596f, 0.215067104f},
-std::array<float,2>{0.638662517f, 0.863777936f},
-std::array<float,2>{0.814228117f, 0.339794219f},
-std::array<float,2>{0.2956824f, 0.700652778f},
-std::array<float,2>{0.108878866f, 0.481833369f},
-std::array<float,2>{0.543514907f, 0.505860925f},
-std::array<float,2>{0.883289754f, 0.0262242965f},
-std::array<float,2>{0.488961875f, 0.956079423f},
-std::array<float,2>{0.283668339f, 0.153337866f},
-std::array<float,2>{0.824199975f, 0.809098125f},
-std::array<float,2>{0.628358901f, 0.308466703f},
-std::array<float,2>{0.176442444f, 0.653879404f},
-std::array<float,2>{0.40661937f, 0.317694992f},
-std::array<float,2>{0.944914043f, 0.712288678f},
-std::array<float,2>{0.58129549f, 0.196993396f},
-std::array<float,2>{0.0138564594f, 0.850892007f},
-std::array<float,2>{0.229264602f, 0.0762413293f},
-std::array<float,2>{0.720871687f, 0.905769944f},
-std::array<float,2>{0.756198704f, 0.378396273f},
-std::array<float,2>{0.348971695f, 0.589065254f},
-std::array<float,2>{0.150950506f, 0.269216359f},
-std::array<float,2>{0.682018578f, 0.683329999f},
-std::array<float,2>{0.857137263f, 0.173518926f},
-std::array<float,2>{0.25382778f, 0.753927588f},
-std::array<float,2>{0.443943262f, 0.0592112169f},
-std::array<float,2>{0.925349891f, 0.971243441f},
-std::array<float,2>{0.516889572f, 0.468572199f},
-std::array<float,2>{0.0788202882f, 0.559000015f},
-std::array<float,2>{0.341991514f, 0.410084248f},
-std::array<float,2>{0.793821931f, 0.619108796f},
-std::array<float,2>{0.708336949f, 0.0987153128f},
-std::array<float,2>{0.213000163f, 0.922530949f},
-std::array<float,2>{0.0392044f, 0.219821706f},
-std::array<float,2>{0.59601599f, 0.825080752f},
-std::array<float,2>{0.982227683f, 0.345662981f},
-std::array<float,2>{0.398313761f, 0.736101687f},
-std::array<float,2>{0.202909663f, 0.391338885f},
-std::array<float,2>{0.692168295f, 0.565162361f},
-std::array<float,2>{0.799164951f, 0.0800320953f},
-std::array<float,2>{0.320138365f, 0.882536411f},
-std::array<float,2>{0.380731493f, 0.21208559f},
-std::array<float,2>{0.993401229f, 0.862749934f},
-std::array<float,2>{0.618069887f, 0.343523234f},
-std::array<float,2>{0.0567452051f, 0.695323169f},
-std::array<float,2>{0.268829793f, 0.290074229f},
-std::array<float,2>{0.864281058f, 0.629574001f},
-std::array<float,2>{0.66871196f, 0.139640018f},
-std::array<float,2>{0.130307987f, 0.793601215f},
-std::array<float,2>{0.0672129989f, 0.014193587f},
-std::array<float,2>{0.505340874f, 0.952442288f},
-std::array<float,2>{0.911747336f, 0.493281096f},
-std::array<float,2>{0.456128806f, 0.523541212f},
-std::array<float,2>{0.0301399883f, 0.367954195f},
-std::array<float,2>{0.568334997f, 0.724486053f},
-std::array<float,2>{0.960923016f, 0.239813119f},
-std::array<float,2>{0.432644129f, 0.834695637f},
-std::array<float,2>{0.360025257f, 0.124276288f},
-std::array<float,2>{0.77239114f, 0.907838345f},
-std::array<float,2>{0.748818278f, 0.431301326f},
-std::array<float,2>{0.245067075f, 0.601482213f},
-std::array<float,2>{0.468931019f, 0.439707994f},
-std::array<float,2>{0.900186062f, 0.538763106f},
-std::array<float,2>{0.555744469f, 0.0356400423f},
-std::array<float,2>{0.116588213f, 0.988479972f},
-std::array<float,2>{0.163800508f, 0.167951375f},
-std::array<float,2>{0.645955801f, 0.767809331f},
-std::array<float,2>{0.83856678f, 0.263769865f},
-std::array<float,2>{0.301519126f, 0.670868397f},
-std::array<float,2>{0.047216814f, 0.429430485f},
-std::array<float,2>{0.614136875f, 0.605858922f},
-std::array<float,2>{0.987396777f, 0.114248067f},
-std::array<float,2>{0.388936758f, 0.915588081f},
-std::array<float,2>{0.327737987f, 0.243495941f},
-std::array<float,2>{0.808439434f, 0.840225399f},
-std::array<float,2>{0.701747f, 0.365454018f},
-std::array<float,2>{0.191869333f, 0.727940679f},
-std::array<float,2>{0.467819005f, 0.252101541f},
-std::array<float,2>{0.919150352f, 0.656399608f},
-std::array<float,2>{0.50910759f, 0.16066654f},
-std::array<float,2>{0.0737425908f, 0.779181957f},
-std::array<float,2>{0.133393601f, 0.0422619991f},
-std::array<float,2>{0.662141442f, 0.994278371f},
-std::array<float,2>{0.873848498f, 0.447092295f},
-std::array<float,2>{0.274298757f, 0.542679906f},
-std::array<float,2>{0.240487501f, 0.334427983f},
-std::array<float,2>{0.739516795f, 0.687698126f},
-std::array<float,2>{0.77727586f, 0.206968427f},
-std::array<float,2>{0.368542135f, 0.86798048f},
-std::array<float,2>{0.42371282f, 0.0920979381f},
-std::array<float,2>{0.964805067f, 0.887975514f},
-std::array<float,2>{0.574824572f, 0.39938271f},
-std::array<float,2>{0.017136395f, 0.57267952f},
-std::array<float,2>{0.311791539f, 0.485924065f},
-std::array<float,2>{0.832558453f, 0.517451167f},
-std::array<float,2>{0.650895894f, 0.00605085026f},
-std::array<float,2>{0.168327063f, 0.94136256f},
-std::array<float,2>{0.12273863f, 0.126270905f},
-std::array<float,2>{0.551639855f, 0.781823158f},
-std::array<float,2>{0.897356689f, 0.287683278f},
-std::array<float,2>{0.480795652f, 0.637512505f},
-std::array<float,2>{0.179896727f, 0.455500036f},
-std::array<float,2>{0.633778811f, 0.553758383f},
-std::array<float,2>{0.820192397f, 0.0484237522f},
-std::array<float,2>{0.290878594f, 0.983983338f},
-std::array<float,2>{0.499014378f, 0.182715967f},
-std::array<float,2>{0.882646441f, 0.760235369f},
-std::array<float,2>{0.538941026f, 0.277373791f},
-std::array<float,2>{0.0992535725f, 0.672812045f},
-std::array<float,2>{0.35406512f, 0.353799373f},
-std::array<float,2>{0.762963057f, 0.748355329f},
-std::array<float,2>{0.730845094f, 0.227291405f},
-std::array<float,2>{0.22186321f, 0.819801211f},
-std::array<float,2>{0.00644731242f, 0.108782873f},
-std::array<float,2>{0.591017604f, 0.934493124f},
-std::array<float,2>{0.94703728f, 0.418714345f},
-std::array<float,2>{0.421464235f, 0.610944211f},
-std::array<float,2>{0.0936198086f, 0.301313818f},
-std::array<float,2>{0.530730903f, 0.647574604f},
-std::array<float,2>{0.933888793f, 0.144075915f},
-std::array<float,2>{0.445847511f, 0.802237511f},
-std::array<float,2>{0.257954627f, 0.0192695502f},
-std::array<float,2>{0.848459899f, 0.966941416f},
-std::array<float,2>{0.676793456f, 0.472103f},
-std::array<float,2>{0.147786111f, 0.511964679f},
-std::array<float,2>{0.405083537f, 0.382817715f},
-std::array<float,2>{0.971605659f, 0.580959857f},
-std::array<float,2>{0.604505301f, 0.0657903031f},
-std::array<float,2>{0.0377277061f, 0.895457745f},
-std::array<float,2>{0.206012115f, 0.187669218f},
-std::array<float,2>{0.717282653f, 0.859194815f},
-std::array<float,2>{0.784139514f, 0.323281467f},
-std::array<float,2>{0.328965247f, 0.708129168f},
-std::array<float,2>{0.00783811137f, 0.450397968f},
-std::array<float,2>{0.582609773f, 0.545601368f},
-std::array<float,2>{0.938272178f, 0.0433899797f},
-std::array<float,2>{0.410788745f, 0.996877789f},
-std::array<float,2>{0.346623391f, 0.156927258f},
-std::array<float,2>{0.752676368f, 0.773681045f},
-std::array<float,2>{0.723031819f, 0.257212758f},
-std::array<float,2>{0.232606858f, 0.661426008f},
-std::array<float,2>{0.486629903f, 0.362512201f},
-std::array<float,2>{0.887098908f, 0.733204603f},
-std::array<float,2>{0.540072918f, 0.249831006f},
-std::array<float,2>{0.102936074f, 0.837433279f},
-std::array<float,2>{0.174567997f, 0.112485029f},
-std::array<float,2>{0.632687151f, 0.920643926f},
-std::array<float,2>{0.824887991f, 0.423354685f},
-std::array<float,2>{0.2861678f, 0.602578044f},
-std::array<float,2>{0.218516752f, 0.281924933f},
-std::array<float,2>{0.703685701f, 0.634525836f},
-std::array<float,2>{0.789338946f, 0.130957991f},
-std::array<float,2>{0.33826974f, 0.786337137f},
-std::array<float,2>{0.393219441f, 0.00114642933f},
-std::array<float,2>{0.980089307f, 0.941551328f},
-std::array<float,2>{0.600933433f, 0.491972715f},
-std::array<float,2>{0.0449376479f, 0.522769868f},
-std::array<float,2>{0.256271183f, 0.40272066f},
-std::array<float,2>{0.855014503f, 0.574915588f},
-std::array<float,2>{0.683707297f, 0.0892464295f},
-std::array<float,2>{0.155093715f, 0.886240244f},
-std::array<float,2>{0.0822300985f, 0.209879935f},
-std::array<float,2>{0.522951961f, 0.871503651f},
-std::array<float,2>{0.929604769f, 0.330584407f},
-std::array<float,2>{0.437923968f, 0.692391336f},
-std::array<float,2>{0.128118679f, 0.414154291f},
-std::array<float,2>{0.664612472f, 0.614286721f},
-std::array<float,2>{0.86274755f, 0.103004314f},
-std::array<float,2>{0.271925777f, 0.931136787f},
-std::array<float,2>{0.458485574f, 0.230588913f},
-std::array<float,2>{0.910086155f, 0.814649224f},
-std::array<float,2>{0.500278234f, 0.356168032f},
-std::array<float,2>{0.0641201362f, 0.744804919f},
-std::array<float,2>{0.312810123f, 0.274840027f},
-std::array<float,2>{0.802838326f, 0.677618384f},
-std::array<float,2>{0.68989706f, 0.185936481f},
-std::array<float,2>{0.195979044f, 0.765011072f},
-std::array<float,2>{0.0617466792f, 0.0517691635f},
-std::array<float,2>{0.623156786f, 0.980164826f},
-std::array<float,2>{0.998912692f, 0.45908159f},
-std::array<float,2>{0.377988189f, 0.547913015f},
-std::array<float,2>{0.110398494f, 0.327081084f},
-std::array<float,2>{0.562189043f, 0.703679621f},
-std::array<float,2>{0.905806005f, 0.195186004f},
-std::array<float,2>{0.475809664f, 0.853351831f},
-std::array<float,2>{0.297496527f, 0.0680491105f},
-std::array<float,2>{0.842824697f, 0.89345634f},
-std::array<float,2>{0.643787622f, 0.387816668f},
-std::array<float,2>{0.159378707f, 0.585790753f},
-std::array<float,2>{0.43556565f, 0.47309196f},
-std::array<float,2>{0.953327477f, 0.509384394f},
-std::array<float,2>{0.56507653f, 0.0197766777f},
-std::array<float,2>{0.0265590958f, 0.964543581f},
-std::array<float,2>{0.247765049f, 0.145070314f},
-std::array<float,2>{0.744011045f, 0.798063397f},
-std::array<float,2>{0.768297553f, 0.300137013f},
-std::array<float,2>{0.367051721f, 0.644190252f},
-std::array<float,2>{0.0742946565f, 0.381336957f},
-std::array<float,2>{0.514253318f, 0.5930022f},
-std::array<float,2>{0.917829752f, 0.0716590583f},
-std::array<float,2>{0.461047113f, 0.900261104f},
-std::array<float,2>{0.2804856f, 0.199731082f},
-std::array<float,2>{0.867649019f, 0.845499337f},
-std::array<float,2>{0.658637404f, 0.31326887f},
-std::array<float,2>{0.137923837f, 0.715452552f},
-std::array<float,2>{0.382818639f, 0.312449425f},
-std::array<float,2>{0.990158558f, 0.650847971f},
-std::array<float,2>{0.609756172f, 0.150054604f},
-std::array<float,2>{0.0541160889f, 0.8066383f},
-std::array<float,2>{0.189202055f, 0.0281340908f},
-std::array<float,2>{0.697822452f, 0.957634687f},
-std::array<float,2>{0.811946392f, 0.477857918f},
-std::array<float,2>{0.321677476f, 0.50320971f},
-std::array<float,2>{0.164640203f, 0.348960787f},
-std::array<float,2>{0.655590236f, 0.739224374f},
-std::array<float,2>{0.828372359f, 0.225313321f},
-std::array<float,2>{0.307613879f, 0.824143589f},
-std::array<float,2>{0.479368329f, 0.0939122662f},
-std::array<float,2>{0.892752588f, 0.929547012f},
-std::array<float,2>{0.548171043f, 0.411762536f},
-std::array<float,2>{0.119432248f, 0.624872446f},
-std::array<float,2>{0.372064292f, 0.463310897f},
-std::array<float,2>{0.780838788f, 0.556367397f},
-std::array<float,2>{0.734597385f, 0.0585592762f},
-std::array<float,2>{0.237018958f, 0.972678721f},
-std::array<float,2>{0.0209129695f, 0.178058937f},
-std::array<float,2>{0.570810974f, 0.753178775f},
-std::array<float,2>{0.966091335f, 0.270095795f},
-std::array<float,2>{0.428104728f, 0.687179446f},
-std::array<float,2>{0.224545985f, 0.497784704f},
-std::array<float,2>{0.72811532f, 0.527700067f},
-std::array<float,2>{0.75988239f, 0.0107918885f},
-std::array<float,2>{0.358631015f, 0.945381701f},
-std::array<float,2>{0.415250957f, 0.136108801f},
-std::array<float,2>{0.951603234f, 0.792803407f},
-std::array<float,2>{0.587870836f, 0.296259671f},
-std::array<float,2>{0.00222858996f, 0.62703079f},
-std::array<float,2>{0.293781996f, 0.336585909f},
-std::array<float,2>{0.815677047f, 0.702711403f},
-std::array<float,2>{0.63997066f, 0.217671037f},
-std::array<float,2>{0.186569095f, 0.866654038f},
-std::array<float,2>{0.0948287398f, 0.0828267336f},
-std::array<float,2>{0.531252027f, 0.876280725f},
-std::array<float,2>{0.875779808f, 0.395821244f},
-std::array<float,2>{0.494968981f, 0.57009095f},
-std::array<float,2>{0.0314883776f, 0.260730356f},
-std::array<float,2>{0.609314978f, 0.665782392f},
-std::array<float,2>{0.975883722f, 0.170942709f},
-std::array<float,2>{0.398485035f, 0.771006823f},
-std::array<float,2>{0.334984571f, 0.0334052071f},
-std::array<float,2>{0.785432816f, 0.985004365f},
-std::array<float,2>{0.714807689f, 0.44479987f},
-std::array<float,2>{0.210129157f, 0.532755375f},
-std::array<float,2>{0.452325404f, 0.436628401f},
-std::array<float,2>{0.932046652f, 0.596734405f},
-std::array<float,2>{0.526929736f, 0.119909555f},
-std::array<float,2>{0.0866311193f, 0.913818181f},
-std::array<float,2>{0.141418248f, 0.236520007f},
-std::array<float,2>{0.674188375f, 0.828699648f},
-std::array<float,2>{0.846013546f, 0.372336239f},
-std::array<float,2>{0.264892727f, 0.722280264f},
-std::array<float,2>{0.0989471152f, 0.455068052f},
-std::array<float,2>{0.538276553f, 0.552138865f},
-std::array<float,2>{0.881970942f, 0.0489946418f},
-std::array<float,2>{0.498304725f, 0.981952786f},
-std::array<float,2>{0.290434331f, 0.180406332f},
-std::array<float,2>{0.819454193f, 0.759091139f},
-std::array<float,2>{0.633237422f, 0.279959768f},
-std::array<float,2>{0.180406049f, 0.675580025f},
-std::array<float,2>{0.421363264f, 0.352968335f},
-std::array<float,2>{0.94674933f, 0.748028636f},
-std::array<float,2>{0.591707945f, 0.229946867f},
-std::array<float,2>{0.00603622338f, 0.817289889f},
-std::array<float,2>{0.222592309f, 0.107289493f},
-std::array<float,2>{0.73105526f, 0.936038256f},
-std::array<float,2>{0.763575673f, 0.420582592f},
-std::array<float,2>{0.353774309f, 0.611636937f},
-std::array<float,2>{0.148066536f, 0.302738219f},
-std::array<float,2>{0.677386463f, 0.646222532f},
-std::array<float,2>{0.847885549f, 0.140919119f},
-std::array<float,2>{0.258696377f, 0.803161383f},
-std::array<float,2>{0.445571065f, 0.0166429598f},
-std::array<float,2>{0.934538126f, 0.964862287f},
-std::array<float,2>{0.530792832f, 0.469129324f},
-std::array<float,2>{0.0929375812f, 0.513741791f},
-std::array<float,2>{0.328195274f, 0.385923684f},
-std::array<float,2>{0.783365488f, 0.578427851f},
-std::array<float,2>{0.717561364f, 0.0643383935f},
-std::array<float,2>{0.205462903f, 0.898333251f},
-std::array<float,2>{0.0373646282f, 0.190973312f},
-std::array<float,2>{0.605376363f, 0.855995238f},
-std::array<float,2>{0.971135914f, 0.321942896f},
-std::array<float,2>{0.404557556f, 0.709234416f},
-std::array<float,2>{0.192138433f, 0.426526099f},
-std::array<float,2>{0.701496542f, 0.607717752f},
-std::array<float,2>{0.807725906f, 0.117139988f},
-std::array<float,2>{0.327618152f, 0.916380167f},
-std::array<float,2>{0.389444172f, 0.245549276f},
-std::array<float,2>{0.988050818f, 0.843542516f},
-std::array<float,2>{0.613753617f, 0.363469809f},
-std::array<float,2>{0.0475053377f, 0.728967667f},
-std::array<float,2>{0.273625135f, 0.250586987f},
-std::array<float,2>{0.873285711f, 0.659475446f},
-std::array<float,2>{0.663036525f, 0.163616568f},
-std::array<float,2>{0.132844433f, 0.781226873f},
-std::array<float,2>{0.0732792094f, 0.0391676016f},
-std::array<float,2>{0.509407878f, 0.993433475f},
-std::array<float,2>{0.919706166f, 0.447489083f},
-std::array<float,2>{0.468481362f, 0.539850414f},
-std::array<float,2>{0.0170533136f, 0.332147479f},
-std::array<float,2>{0.574436367f, 0.690717459f},
-std::array<float,2>{0.96433872f, 0.204286218f},
-std::array<float,2>{0.423019916f, 0.870975375f},
-std::array<float,2>{0.368876487f, 0.0906351507f},
-std::array<float,2>{0.776381552f, 0.890496671f},
-std::array<float,2>{0.739977539f, 0.40180558f},
-std::array<float,2>{0.240844235f, 0.571325362f},
-std::array<float,2>{0.481108606f, 0.486552715f},
-std::array<float,2>{0.896895111f, 0.517616868f},
-std::array<float,2>{0.551260591f, 0.00450867182f},
-std::array<float,2>{0.122336216f, 0.9387182f},
-std::array<float,2>{0.168789029f, 0.127280325f},
-std::array<float,2>{0.650561154f, 0.783989787f},
-std::array<float,2>{0.832495749f, 0.285252005f},
-std::array<float,2>{0.312368661f, 0.639603913f},
-std::array<float,2>{0.0574513152f, 0.393105567f},
-std::array<float,2>{0.617462337f, 0.563581049f},
-std::array<float,2>{0.994000733f, 0.080351159f},
-std::array<float,2>{0.380046666f, 0.880313754f},
-std::array<float,2>{0.319383979f, 0.214654833f},
-std::array<float,2>{0.79939729f, 0.859990597f},
-std::array<float,2>{0.691835225f, 0.341152608f},
-std::array<float,2>{0.202171817f, 0.698333323f},
-std::array<float,2>{0.456837207f, 0.291886985f},
-std::array<float,2>{0.911335409f, 0.631346166f},
-std::array<float,2>{0.505480349f, 0.137605354f},
-std::array<float,2>{0.0665989146f, 0.796779037f},
-std::array<float,2>{0.130828917f, 0.0118587501f},
-std::array<float,2>{0.668226719f, 0.949448824f},
-std::array<float,2>{0.864781857f, 0.495925248f},
-std::array<float,2>{0.269342691f, 0.526184857f},
-std::array<float,2>{0.244514287f, 0.370727926f},
-std::array<float,2>{0.748237073f, 0.726178467f},
-std::array<float,2>{0.771623671f, 0.242113486f},
-std::array<float,2>{0.359759748f, 0.832139671f},
-std::array<float,2>{0.43345502f, 0.122239381f},
-std::array<float,2>{0.960068166f, 0.909715772f},
-std::array<float,2>{0.567446053f, 0.432377785f},
-std::array<float,2>{0.0293666422f, 0.599339485f},
-std::array<float,2>{0.301180035f, 0.4376674f},
-std::array<float,2>{0.838128388f, 0.536241472f},
-std::array<float,2>{0.64643085f, 0.0382323712f},
-std::array<float,2>{0.163161114f, 0.991262317f},
-std::array<float,2>{0.116736799f, 0.164322585f},
-std::array<float,2>{0.55650121f, 0.76730746f},
-std::array<float,2>{0.899595797f, 0.263433784f},
-std::array<float,2>{0.469553709f, 0.668333948f},
-std::array<float,2>{0.175825745f, 0.482632101f},
-std::array<float,2>{0.628637433f, 0.505818248f},
-std::array<float,2>{0.823246837f, 0.0252899975f},
-std::array<float,2>{0.283704609f, 0.954350233f},
-std::array<float,2>{0.488749504f, 0.155582532f},
-std::array<float,2>{0.883775473f, 0.811962545f},
-std::array<float,2>{0.543259799f, 0.305510461f},
-std::array<float,2>{0.108956061f, 0.656028092f},
-std::array<float,2>{0.349299908f, 0.319509864f},
-std::array<float,2>{0.756431818f, 0.714636266f},
-std::array<float,2>{0.721493542f, 0.197540492f},
-std::array<float,2>{0.228822932f, 0.847860634f},
-std::array<float,2>{0.0144092785f, 0.0761633441f},
-std::array<float,2>{0.581808984f, 0.903164029f},
-std::array<float,2>{0.944424093f, 0.375917703f},
-std::array<float,2>{0.407155931f, 0.587680697f},
-std::array<float,2>{0.0785025358f, 0.266163468f},
-std::array<float,2>{0.517106652f, 0.68041563f},
-std::array<float,2>{0.925208509f, 0.17400828f},
-std::array<float,2>{0.443760395f, 0.757238865f},
-std::array<float,2>{0.25304395f, 0.0620700568f},
-std::array<float,2>{0.856723368f, 0.968845963f},
-std::array<float,2>{0.682275534f, 0.465255082f},
-std::array<float,2>{0.150696144f, 0.562043786f},
-std::array<float,2>{0.39762035f, 0.406630993f},
-std::array<float,2>{0.981786251f, 0.619931817f},
-std::array<float,2>{0.596560359f, 0.100495443f},
-std::array<float,2>{0.0396942943f, 0.925696552f},
-std::array<float,2>{0.213661715f, 0.221793413f},
-std::array<float,2>{0.708527088f, 0.82741195f},
-std::array<float,2>{0.793151677f, 0.347088307f},
-std::array<float,2>{0.342556179f, 0.737290323f},
-std::array<float,2>{0.00267699338f, 0.498805463f},
-std::array<float,2>{0.587341726f, 0.530294538f},
-std::array<float,2>{0.951998353f, 0.00927019212f},
-std::array<float,2>{0.415657908f, 0.947677612f},
-std::array<float,2>{0.359286606f, 0.134388313f},
-std::array<float,2>{0.760681272f, 0.790578842f},
-std::array<float,2>{0.727674961f, 0.29441151f},
-std::array<float,2>{0.223791257f, 0.625220299f},
-std::array<float,2>{0.494202256f, 0.339305252f},
-std::array<float,2>{0.875349641f, 0.700778365f},
-std::array<float,2>{0.531785369f, 0.215362787f},
-std::array<float,2>{0.095363766f, 0.863382697f},
-std::array<float,2>{0.187145919f, 0.0844860524f},
-std::array<float,2>{0.640414774f, 0.87712115f},
-std::array<float,2>{0.816100776f, 0.396980256f},
-std::array<float,2>{0.293172807f, 0.567092836f},
-std::array<float,2>{0.210677072f, 0.259386301f},
-std::array<float,2>{0.714290321f, 0.667282999f},
-std::array<float,2>{0.785923719f, 0.168431267f},
-std::array<float,2>{0.335484236f, 0.772030115f},
-std::array<float,2>{0.399044842f, 0.0324269198f},
-std::array<float,2>{0.976319671f, 0.986376464f},
-std::array<float,2>{0.608781934f, 0.441977501f},
-std::array<float,2>{0.032030873f, 0.533343792f},
-std::array<float,2>{0.26534304f, 0.43503806f},
-std::array<float,2>{0.84665823f, 0.59544307f},
-std::array<float,2>{0.674699783f, 0.118644744f},
-std::array<float,2>{0.140722439f, 0.910302937f},
-std::array<float,2>{0.0861728638f, 0.236128971f},
-std::array<float,2>{0.526627362f, 0.831790924f},
-std::array<float,2>{0.93223232f, 0.374500722f},
-std::array<float,2>{0.45274061f, 0.719922483f},
-std::array<float,2>{0.13851212f, 0.379884005f},
-std::array<float,2>{0.658791959f, 0.591022372f},
-std::array<float,2>{0.867992163f, 0.0732156336f},
-std::array<float,2>{0.280762464f, 0.901465595f},
-std::array<float,2>{0.461636722f, 0.202977568f},
-std::array<float,2>{0.917474568f, 0.846501946f},
-std::array<float,2>{0.513912559f, 0.314516127f},
-std::array<float,2>{0.0750726461f, 0.718478739f},
-std::array<float,2>{0.321811587f, 0.308694154f},
-std::array<float,2>{0.812341928f, 0.64870429f},
-std::array<float,2>{0.697486937f, 0.150525436f},
-std::array<float,2>{0.188537121f, 0.80850178f},
-std::array<float,2>{0.0545385703f, 0.0300109871f},
-std::array<float,2>{0.61025089f, 0.959413409f},
-std::array<float,2>{0.989657938f, 0.479839534f},
-std::array<float,2>{0.383774698f, 0.501705706f},
-std::array<float,2>{0.11964485f, 0.351316065f},
-std::array<float,2>{0.548748434f, 0.74184984f},
-std::array<float,2>{0.89308095f, 0.223120794f},
-std::array<float,2>{0.478533149f, 0.820611775f},
-std::array<float,2>{0.30681619f, 0.0965948999f},
-std::array<float,2>{0.828669429f, 0.926894307f},
-std::array<float,2>{0.656200647f, 0.413397253f},
-std::array<float,2>{0.164540678f, 0.622916162f},
-std::array<float,2>{0.428682089f, 0.460945308f},
-std::array<float,2>{0.966520607f, 0.556901395f},
-std::array<float,2>{0.57031548f, 0.0566402487f},
-std::array<float,2>{0.0213976838f, 0.974962711f},
-std::array<float,2>{0.236793831f, 0.177217513f},
-std::array<float,2>{0.734896064f, 0.750545919f},
-std::array<float,2>{0.780449629f, 0.272779077f},
-std::array<float,2>{0.371521682f, 0.684123755f},
-std::array<float,2>{0.0638518408f, 0.417883784f},
-std::array<float,2>{0.500756323f, 0.615272939f},
-std::array<float,2>{0.909336984f, 0.103866845f},
-std::array<float,2>{0.458629668f, 0.93317616f},
-std::array<float,2>{0.272246808f, 0.232662499f},
-std::array<float,2>{0.862873971f, 0.812689781f},
-std::array<float,2>{0.664196372f, 0.35763979f},
-std::array<float,2>{0.12881811f, 0.744056761f},
-std::array<float,2>{0.378579587f, 0.277151346f},
-std::array<float,2>{0.99835813f, 0.678752303f},
-std::array<float,2>{0.623872101f, 0.184382513f},
-std::array<float,2>{0.0623735599f, 0.763148367f},
-std::array<float,2>{0.195438281f, 0.0538408831f},
-std::array<float,2>{0.690037787f, 0.978121698f},
-std::array<float,2>{0.803689539f, 0.458114535f},
-std::array<float,2>{0.313178092f, 0.549342453f},
-std::array<float,2>{0.159958065f, 0.325413793f},
-std::array<float,2>{0.644259036f, 0.706502557f},
-std::array<float,2>{0.843507111f, 0.191452876f},
-std::array<float,2>{0.297068924f, 0.854167879f},
-std::array<float,2>{0.476213098f, 0.0691947117f},
-std::array<float,2>{0.905434191f, 0.891520262f},
-std::array<float,2>{0.561706901f, 0.389292091f},
-std::array<float,2>{0.110997081f, 0.583062053f},
-std::array<float,2>{0.366500676f, 0.476517826f},
-std::array<float,2>{0.76767838f, 0.511593223f},
-std::array<float,2>{0.743189991f, 0.0217904784f},
-std::array<float,2>{0.247090325f, 0.961731553f},
-std::array<float,2>{0.0273353141f, 0.147222236f},
-std::array<float,2>{0.564683199f, 0.799422622f},
-std::array<float,2>{0.953781545f, 0.297032952f},
-std::array<float,2>{0.436104059f, 0.641809523f},
-std::array<float,2>{0.233205676f, 0.452922761f},
-std::array<float,2>{0.72352159f, 0.544323385f},
-std::array<float,2>{0.752093077f, 0.0450517125f},
-std::array<float,2>{0.346039832f, 0.999784648f},
-std::array<float,2>{0.410231858f, 0.159191594f},
-std::array<float,2>{0.937960505f, 0.776927888f},
-std::array<float,2>{0.582272351f, 0.254289657f},
-std::array<float,2>{0.00850012153f, 0.663086891f},
-std::array<float,2>{0.286791056f, 0.360674053f},
-std::array<float,2>{0.824434876f, 0.730705678f},
-std::array<float,2>{0.632079899f, 0.246636391f},
-std::array<float,2>{0.173906952f, 0.838489294f},
-std::array<float,2>{0.103110082f, 0.109915778f},
-std::array<float,2>{0.540613949f, 0.919575989f},
-std::array<float,2>{0.887671411f, 0.424657762f},
-std::array<float,2>{0.487128943f, 0.604403615f},
-std::array<float,2>{0.0458255969f, 0.284995109f},
-std::array<float,2>{0.601365745f, 0.635765731f},
-std::array<float,2>{0.979804456f, 0.129326805f},
-std::array<float,2>{0.392962873f, 0.787539721f},
-std::array<float,2>{0.338769972f, 0.00372642768f},
-std::array<float,2>{0.789868295f, 0.944254816f},
-std::array<float,2>{0.703326583f, 0.488607764f},
-std::array<float,2>{0.217971295f, 0.520457566f},
-std::array<float,2>{0.438215345f, 0.404400021f},
-std::array<float,2>{0.929036558f, 0.576597631f},
-std::array<float,2>{0.522736192f, 0.087027587f},
-std::array<float,2>{0.0829862356f, 0.883255899f},
-std::array<float,2>{0.154619202f, 0.208199874f},
-std::array<float,2>{0.684229016f, 0.873593628f},
-std::array<float,2>{0.854770184f, 0.329592943f},
-std::array<float,2>{0.256531984f, 0.694544494f},
-std::array<float,2>{0.0916010216f, 0.472318321f},
-std::array<float,2>{0.528036356f, 0.512676775f},
-std::array<float,2>{0.937273026f, 0.0188796204f},
-std::array<float,2>{0.448666811f, 0.967319369f},
-std::array<float,2>{0.260919183f, 0.143733606f},
-std::array<float,2>{0.851038277f, 0.802520514f},
-std::array<float,2>{0.679422379f, 0.300784022f},
-std::array<float,2>{0.146175876f, 0.647961617f},
-std::array<float,2>{0.403900266f, 0.323861659f},
-std::array<float,2>{0.968982935f, 0.708598316f},
-std::array<float,2>{0.602611244f, 0.188294485f},
-std::array<float,2>{0.0352439396f, 0.858742774f},
-std::array<float,2>{0.204265833f, 0.0664040595f},
-std::array<float,2>{0.716604233f, 0.894862056f},
-std::array<float,2>{0.781536162f, 0.383555114f},
-std::array<float,2>{0.330663621f, 0.580154955f},
-std::array<float,2>{0.18298842f, 0.278189212f},
-std::array<float,2>{0.634920537f, 0.672015667f},
-std::array<float,2>{0.817531943f, 0.183254823f},
-std::array<float,2>{0.291342169f, 0.760459602f},
-std::array<float,2>{0.497860014f, 0.0481087081f},
-std::array<float,2>{0.87957114f, 0.98384285f},
-std::array<float,2>{0.536700845f, 0.455919772f},
-std::array<float,2>{0.0998278707f, 0.554597557f},
-std::array<float,2>{0.353072703f, 0.418175787f},
-std::array<float,2>{0.76387924f, 0.610763609f},
-std::array<float,2>{0.733010888f, 0.109137654f},
-std::array<float,2>{0.218764707f, 0.933737576f},
-std::array<float,2>{0.00550434506f, 0.226717964f},
-std::array<float,2>{0.593294442f, 0.819862962f},
-std::array<float,2>{0.948708951f, 0.35402745f},
-std::array<float,2>{0.419697106f, 0.74880445f},
-std::array<float,2>{0.239329964f, 0.398545772f},
-std::array<float,2>{0.741361082f, 0.572896183f},
-std::array<float,2>{0.774514258f, 0.0923425406f},
-std::array<float,2>{0.370742679f, 0.88861382f},
-std::array<float,2>{0.42386356f, 0.206173122f},
-std::array<float,2>{0.96271944f, 0.867389143f},
-std::array<float,2>{0.577757716f, 0.334638f},
-std::array<float,2>{0.0190170277f, 0.688251734f},
-std::array<float,2>{0.309332997f, 0.287526637f},
-std::array<float,2>{0.834095359f, 0.6367715f},
-std::array<float,2>{0.649576962f, 0.126773179f},
-std::array<float,2>{0.171558514f, 0.781588316f},
-std::array<float,2>{0.123234816f, 0.00680143526f},
-std::array<float,2>{0.5539397f, 0.940572202f},
-std::array<float,2>{0.896294117f, 0.485452503f},
-std::array<float,2>{0.483068347f, 0.516963542f},
-std::array<float,2>{0.0507247262f, 0.365775794f},
-std::array<float,2>{0.61612618f, 0.728096187f},
-std::array<float,2>{0.984688044f, 0.24412109f},
-std::array<float,2>{0.388164282f, 0.840819716f},
-std::array<float,2>{0.325701475f, 0.113648146f},
-std::array<float,2>{0.804825962f, 0.915245116f},
-std::array<float,2>{0.699307144f, 0.428855568f},
-std::array<float,2>{0.194315925f, 0.60631299f},
-std::array<float,2>{0.466772199f, 0.446583718f},
-std::array<float,2>{0.920036137f, 0.542160511f},
-std::array<float,2>{0.510243058f, 0.0424889065f},
-std::array<float,2>{0.0705314949f, 0.994982004f},
-std::array<float,2>{0.136369959f, 0.160557121f},
-std::array<float,2>{0.661362112f, 0.778740823f},
-std::array<float,2>{0.872513592f, 0.252717495f},
-std::array<float,2>{0.275954753f, 0.656908691f},
-std::array<float,2>{0.0277501363f, 0.431063235f},
-std::array<float,2>{0.569590449f, 0.600765526f},
-std::array<float,2>{0.957858741f, 0.124899551f},
-std::array<float,2>{0.430149466f, 0.907355189f},
-std::array<float,2>{0.362244904f, 0.239551455f},
-std::array<float,2>{0.770258784f, 0.834182322f},
-std::array<float,2>{0.746424973f, 0.367402583f},
-std::array<float,2>{0.242784441f, 0.723974705f},
-std::array<float,2>{0.47172457f, 0.264193445f},
-std::array<float,2>{0.901376128f, 0.670249403f},
-std::array<float,2>{0.556929111f, 0.167398646f},
-std::array<float,2>{0.113636561f, 0.768150926f},
-std::array<float,2>{0.160965428f, 0.0357467383f},
-std::array<float,2>{0.648321092f, 0.988795638f},
-std::array<float,2>{0.837083757f, 0.440206856f},
-std::array<float,2>{0.302814871f, 0.538185894f},
-std::array<float,2>{0.199835628f, 0.343111604f},
-std::array<float,2>{0.695041001f, 0.695904195f},
-std::array<float,2>{0.798534572f, 0.212549478f},
-std::array<float,2>{0.316913366f, 0.863088965f},
-std::array<float,2>{0.380866826f, 0.0795549154f},
-std::array<float,2>{0.995923758f, 0.881924152f},
-std::array<float,2>{0.619162738f, 0.390657455f},
-std::array<float,2>{0.0553458743f, 0.564603984f},
-std::array<float,2>{0.267456889f, 0.493782252f},
-std::array<float,2>{0.866202533f, 0.523988307f},
-std::array<float,2>{0.671394825f, 0.0141454572f},
-std::array<float,2>{0.13187474f, 0.952959239f},
-std::array<float,2>{0.069868587f, 0.138866812f},
-std::array<float,2>{0.50770539f, 0.793185294f},
-std::array<float,2>{0.912726879f, 0.290886104f},
-std::array<float,2>{0.45419386f, 0.629005194f},
-std::array<float,2>{0.148871094f, 0.467865229f},
-std::array<float,2>{0.680200934f, 0.559496999f},
-std::array<float,2>{0.857792318f, 0.0588688403f},
-std::array<float,2>{0.251740038f, 0.97089529f},
-std::array<float,2>{0.442255855f, 0.172995061f},
-std::array<float,2>{0.922253132f, 0.754437327f},
-std::array<float,2>{0.519190311f, 0.268586814f},
-std::array<float,2>{0.080105409f, 0.683069289f},
-std::array<float,2>{0.34071514f, 0.345145077f},
-std::array<float,2>{0.795633852f, 0.735433578f},
-std::array<float,2>{0.710288882f, 0.220434994f},
-std::array<float,2>{0.211994916f, 0.824354887f},
-std::array<float,2>{0.0413456075f, 0.0993506238f},
-std::array<float,2>{0.595281601f, 0.922358334f},
-std::array<float,2>{0.983756721f, 0.409536451f},
-std::array<float,2>{0.396061599f, 0.618381143f},
-std::array<float,2>{0.10697601f, 0.307831615f},
-std::array<float,2>{0.546631157f, 0.653513014f},
-std::array<float,2>{0.886066854f, 0.154102728f},
-std::array<float,2>{0.490295529f, 0.809041321f},
-std::array<float,2>{0.281958252f, 0.0257530641f},
-std::array<float,2>{0.821964681f, 0.956774652f},
-std::array<float,2>{0.626681328f, 0.482201129f},
-std::array<float,2>{0.178979024f, 0.506543517f},
-std::array<float,2>{0.408746958f, 0.378803015f},
-std::array<float,2>{0.942975163f, 0.589502156f},
-std::array<float,2>{0.57877636f, 0.0770707503f},
-std::array<float,2>{0.0130935209f, 0.905402541f},
-std::array<float,2>{0.22786808f, 0.196519837f},
-std::array<float,2>{0.720392048f, 0.851288974f},
-std::array<float,2>{0.754338861f, 0.318230093f},
-std::array<float,2>{0.350178123f, 0.712856114f},
-std::array<float,2>{0.0344976485f, 0.445034295f},
-std::array<float,2>{0.605663598f, 0.532294333f},
-std::array<float,2>{0.974420249f, 0.0338328443f},
-std::array<float,2>{0.40064764f, 0.984376907f},
-std::array<float,2>{0.332448512f, 0.17183435f},
-std::array<float,2>{0.787522972f, 0.770739496f},
-std::array<float,2>{0.712267339f, 0.26024729f},
-std::array<float,2>{0.208869532f, 0.665120721f},
-std::array<float,2>{0.450980157f, 0.372756034f},
-std::array<float,2>{0.929889739f, 0.722050726f},
-std::array<float,2>{0.525181532f, 0.237296388f},
-std::array<float,2>{0.087960884f, 0.82818383f},
-std::array<float,2>{0.143049225f, 0.119368263f},
-std::array<float,2>{0.672047734f, 0.913432479f},
-std::array<float,2>{0.845249712f, 0.437420368f},
-std::array<float,2>{0.262313277f, 0.597391605f},
-std::array<float,2>{0.225339025f, 0.296573848f},
-std::array<float,2>{0.72985822f, 0.627789557f},
-std::array<float,2>{0.758395791f, 0.136399984f},
-std::array<float,2>{0.356889397f, 0.791997671f},
-std::array<float,2>{0.417741209f, 0.0113988928f},
-std::array<float,2>{0.950046599f, 0.946211457f},
-std::array<float,2>{0.588749766f, 0.497376621f},
-std::array<float,2>{0.000550447614f, 0.52815336f},
-std::array<float,2>{0.295398802f, 0.396145374f},
-std::array<float,2>{0.813867688f, 0.569453418f},
-std::array<float,2>{0.638016105f, 0.0821764618f},
-std::array<float,2>{0.184947446f, 0.876488566f},
-std::array<float,2>{0.0960610956f, 0.21680364f},
-std::array<float,2>{0.534623563f, 0.86695087f},
-std::array<float,2>{0.878616273f, 0.336222142f},
-std::array<float,2>{0.492751539f, 0.702251494f},
-std::array<float,2>{0.16637066f, 0.411574394f},
-std::array<float,2>{0.653910875f, 0.624430716f},
-std::array<float,2>{0.831479192f, 0.0945282131f},
-std::array<float,2>{0.305657655f, 0.92881155f},
-std::array<float,2>{0.476653695f, 0.224784866f},
-std::array<float,2>{0.891432047f, 0.823342383f},
-std::array<float,2>{0.550467968f, 0.3493599f},
-std::array<float,2>{0.118660532f, 0.738500178f},
-std::array<float,2>{0.374607652f, 0.269668102f},
-std::array<float,2>{0.778117955f, 0.686741352f},
-std::array<float,2>{0.73754257f, 0.178606898f},
-std::array<float,2>{0.235601887f, 0.753570855f},
-std::array<float,2>{0.022367442f, 0.0580573939f},
-std::array<float,2>{0.572510362f, 0.97331202f},
-std::array<float,2>{0.967002869f, 0.46361348f},
-std::array<float,2>{0.427471668f, 0.55595845f},
-std::array<float,2>{0.077451393f, 0.312922597f},
-std::array<float,2>{0.513533592f, 0.715169609f},
-std::array<float,2>{0.915186048f, 0.199236229f},
-std::array<float,2>{0.464408904f, 0.845149457f},
-std::array<float,2>{0.278949082f, 0.0720290467f},
-std::array<float,2>{0.869407952f, 0.89965266f},
-std::array<float,2>{0.656910181f, 0.381660193f},
-std::array<float,2>{0.138846725f, 0.59343785f},
-std::array<float,2>{0.385825992f, 0.478313595f},
-std::array<float,2>{0.991950691f, 0.503495097f},
-std::array<float,2>{0.611622274f, 0.0273564104f},
-std::array<float,2>{0.0518178195f, 0.957272053f},
-std::array<float,2>{0.190102935f, 0.149637461f},
-std::array<float,2>{0.696421623f, 0.805883229f},
-std::array<float,2>{0.80893892f, 0.311634362f},
-std::array<float,2>{0.323974282f, 0.651292324f},
-std::array<float,2>{0.112581782f, 0.388353974f},
-std::array<float,2>{0.560495734f, 0.585173965f},
-std::array<float,2>{0.903596938f, 0.0675519183f},
-std::array<float,2>{0.474519581f, 0.892622292f},
-std::array<float,2>{0.299585462f, 0.194697037f},
-std::array<float,2>{0.841739297f, 0.852964044f},
-std::array<float,2>{0.641982436f, 0.326438218f},
-std::array<float,2>{0.156534106f, 0.7035954f},
-std::array<float,2>{0.434424907f, 0.300423414f},
-std::array<float,2>{0.956201792f, 0.643701851f},
-std::array<float,2>{0.56288892f, 0.144673824f},
-std::array<float,2>{0.0251812469f, 0.798570216f},
-std::array<float,2>{0.248973981f, 0.02028515f},
-std::array<float,2>{0.745954454f, 0.964043021f},
-std::array<float,2>{0.767014623f, 0.473444551f},
-std::array<float,2>{0.363766849f, 0.509127498f},
-std::array<float,2>{0.125079334f, 0.355844527f},
-std::array<float,2>{0.667086184f, 0.744517863f},
-std::array<float,2>{0.859411657f, 0.231431797f},
-std::array<float,2>{0.271210462f, 0.815371037f},
-std::array<float,2>{0.459051222f, 0.103443474f},
-std::array<float,2>{0.906283259f, 0.931182444f},
-std::array<float,2>{0.503130078f, 0.414692819f},
-std::array<float,2>{0.0656918064f, 0.614857137f},
-std::array<float,2>{0.315553397f, 0.459909827f},
-std::array<float,2>{0.802001536f, 0.548813224f},
-std::array<float,2>{0.688977718f, 0.0526743978f},
-std::array<float,2>{0.199188784f, 0.979919612f},
-std::array<float,2>{0.0597060919f, 0.186249375f},
-std::array<float,2>{0.621448398f, 0.765257716f},
-std::array<float,2>{0.998042107f, 0.275299639f},
-std::array<float,2>{0.375703335f, 0.676853359f},
-std::array<float,2>{0.215899795f, 0.491694868f},
-std::array<float,2>{0.705974936f, 0.523116648f},
-std::array<float,2>{0.792748034f, 0.00184820918f},
-std::array<float,2>{0.336281925f, 0.942076802f},
-std::array<float,2>{0.392129898f, 0.131511793f},
-std::array<float,2>{0.976719558f, 0.787027955f},
-std::array<float,2>{0.59854275f, 0.281582832f},
-std::array<float,2>{0.0440287739f, 0.633828342f},
-std::array<float,2>{0.255417526f, 0.330215394f},
-std::array<float,2>{0.851576567f, 0.693227828f},
-std::array<float,2>{0.685876369f, 0.209310576f},
-std::array<float,2>{0.154113233f, 0.871641278f},
-std::array<float,2>{0.0856907815f, 0.0893982947f},
-std::array<float,2>{0.520176768f, 0.88598609f},
-std::array<float,2>{0.9274984f, 0.403024167f},
-std::array<float,2>{0.439629525f, 0.5746907f},
-std::array<float,2>{0.0106155602f, 0.25746572f},
-std::array<float,2>{0.584134936f, 0.662106276f},
-std::array<float,2>{0.940840304f, 0.156491905f},
-std::array<float,2>{0.413241684f, 0.774396598f},
-std::array<float,2>{0.345240206f, 0.0438062251f},
-std::array<float,2>{0.750925362f, 0.996101975f},
-std::array<float,2>{0.72473067f, 0.451146364f},
-std::array<float,2>{0.23142004f, 0.545254111f},
-std::array<float,2>{0.485147566f, 0.422898293f},
-std::array<float,2>{0.890372097f, 0.603296876f},
-std::array<float,2>{0.541416407f, 0.11290583f},
-std::array<float,2>{0.105123088f, 0.920282185f},
-std::array<float,2>{0.172709271f, 0.24933584f},
-std::array<float,2>{0.630047023f, 0.837233484f},
-std::array<float,2>{0.826906562f, 0.362859994f},
-std::array<float,2>{0.288142145f, 0.732825994f},
-std::array<float,2>{0.0717527866f, 0.449077189f},
-std::array<float,2>{0.51097852f, 0.540336847f},
-std::array<float,2>{0.921498418f, 0.0409753844f},
-std::array<float,2>{0.465511858f, 0.99296838f},
-std::array<float,2>{0.277119756f, 0.162244439f},
-std::array<float,2>{0.872038126f, 0.779314995f},
-std::array<float,2>{0.660223663f, 0.251621664f},
-std::array<float,2>{0.134780556f, 0.65821141f},
-std::array<float,2>{0.387448847f, 0.364543051f},
-std::array<float,2>{0.985541523f, 0.729787886f},
-std::array<float,2>{0.617051244f, 0.244922623f},
-std::array<float,2>{0.049581483f, 0.841890395f},
-std::array<float,2>{0.194654018f, 0.115589209f},
-std::array<float,2>{0.70063442f, 0.917381108f},
-std::array<float,2>{0.806509912f, 0.426769972f},
-std::array<float,2>{0.324819416f, 0.608863056f},
-std::array<float,2>{0.170066983f, 0.286299646f},
-std::array<float,2>{0.649272621f, 0.639934003f},
-std::array<float,2>{0.835171103f, 0.128625289f},
-std::array<float,2>{0.310158134f, 0.784585357f},
-std::array<float,2>{0.48353672f, 0.00489234366f},
-std::array<float,2>{0.895401359f, 0.938475966f},
-std::array<float,2>{0.553394556f, 0.487776548f},
-std::array<float,2>{0.12490876f, 0.519239128f},
-std::array<float,2>{0.369417727f, 0.401000202f},
-std::array<float,2>{0.774372399f, 0.570871353f},
-std::array<float,2>{0.740288258f, 0.0916009769f},
-std::array<float,2>{0.23834841f, 0.889116645f},
-std::array<float,2>{0.0177491028f, 0.203414649f},
-std::array<float,2>{0.576470912f, 0.869341612f},
-std::array<float,2>{0.96186018f, 0.33385399f},
-std::array<float,2>{0.425522149f, 0.689738989f},
-std::array<float,2>{0.220306188f, 0.421624482f},
-std::array<float,2>{0.733782232f, 0.613222063f},
-std::array<float,2>{0.764685631f, 0.10635715f},
-std::array<float,2>{0.35178417f, 0.93660146f},
-std::array<float,2>{0.418008298f, 0.228684247f},
-std::array<float,2>{0.947587132f, 0.817397177f},
-std::array<float,2>{0.592629015f, 0.35161683f},
-std::array<float,2>{0.00485868286f, 0.746471345f},
-std::array<float,2>{0.292634845f, 0.280623764f},
-std::array<float,2>{0.817234516f, 0.674393892f},
-std::array<float,2>{0.636527896f, 0.180761948f},
-std::array<float,2>{0.182269424f, 0.757992327f},
-std::array<float,2>{0.100640841f, 0.0501302816f},
-std::array<float,2>{0.536008239f, 0.981169581f},
-std::array<float,2>{0.880648136f, 0.45360142f},
-std::array<float,2>{0.496615529f, 0.551100731f},
-std::array<float,2>{0.0363601632f, 0.320394486f},
-std::array<float,2>{0.602506876f, 0.71013391f},
-std::array<float,2>{0.970659375f, 0.189609766f},
-std::array<float,2>{0.403014332f, 0.856591642f},
-std::array<float,2>{0.331843376f, 0.0629446357f},
-std::array<float,2>{0.783098459f, 0.897402704f},
-std::array<float,2>{0.714848936f, 0.384977818f},
-std::array<float,2>{0.203806788f, 0.580033123f},
-std::array<float,2>{0.448201269f, 0.469980985f},
-std::array<float,2>{0.935707092f, 0.514885902f},
-std::array<float,2>{0.529194534f, 0.0165127199f},
-std::array<float,2>{0.0900408775f, 0.966065288f},
-std::array<float,2>{0.144700125f, 0.142043233f},
-std::array<float,2>{0.678530395f, 0.804383993f},
-std::array<float,2>{0.850408792f, 0.304540843f},
-std::array<float,2>{0.260476381f, 0.644646525f},
-std::array<float,2>{0.0124067841f, 0.376055717f},
-std::array<float,2>{0.579232514f, 0.586214662f},
-std::array<float,2>{0.942374825f, 0.075077869f},
-std::array<float,2>{0.410069048f, 0.903631926f},
-std::array<float,2>{0.351512671f, 0.198769808f},
-std::array<float,2>{0.755408466f, 0.849586844f},
-std::array<float,2>{0.71921128f, 0.318783641f},
-std::array<float,2>{0.226804197f, 0.713320911f},
-std::array<float,2>{0.491785645f, 0.306370467f},
-std::array<float,2>{0.885532141f, 0.654484272f},
-std::array<float,2>{0.545665503f, 0.154812947f},
-std::array<float,2>{0.105621114f, 0.810854018f},
-std::array<float,2>{0.178307027f, 0.0237922687f},
-std::array<float,2>{0.625512421f, 0.953333735f},
-std::array<float,2>{0.821194112f, 0.483674079f},
-std::array<float,2>{0.282550454f, 0.504693031f},
-std::array<float,2>{0.211458206f, 0.345811099f},
-std::array<float,2>{0.709758818f, 0.738171458f},
-std::array<float,2>{0.796405315f, 0.221410602f},
-std::array<float,2>{0.341779143f, 0.826437354f},
-std::array<float,2>{0.394589335f, 0.101150997f},
-std::array<float,2>{0.982616603f, 0.924410164f},
-std::array<float,2>{0.594042003f, 0.407554179f},
-std::array<float,2>{0.0428675748f, 0.620491445f},
-std::array<float,2>{0.250409663f, 0.46670416f},
-std::array<float,2>{0.858979702f, 0.560651362f},
-std::array<float,2>{0.681102276f, 0.0614812821f},
-std::array<float,2>{0.149589524f, 0.969853461f},
-std::array<float,2>{0.0815311298f, 0.174901307f},
-std::array<float,2>{0.517841578f, 0.756620467f},
-std::array<float,2>{0.923224092f, 0.267022699f},
-std::array<float,2>{0.443334877f, 0.680701077f},
-std::array<float,2>{0.13094601f, 0.494547337f},
-std::array<float,2>{0.670311809f, 0.52680558f},
-std::array<float,2>{0.866880476f, 0.0136563191f},
-std::array<float,2>{0.266426921f, 0.950750351f},
-std::array<float,2>{0.453668892f, 0.137780339f},
-std::array<float,2>{0.913229167f, 0.795621395f},
-std::array<float,2>{0.50616622f, 0.292814314f},
-std::array<float,2>{0.0684218183f, 0.632732809f},
-std::array<float,2>{0.318279803f, 0.340393603f},
-std::array<float,2>{0.797846913f, 0.697278857f},
-std::array<float,2>{0.69394511f, 0.21304208f},
-std::array<float,2>{0.20099774f, 0.861195862f},
-std::array<float,2>{0.0557471812f, 0.0816795304f},
-std::array<float,2>{0.620680928f, 0.879617572f},
-std::array<float,2>{0.995023131f, 0.39383164f},
-std::array<float,2>{0.382027417f, 0.563056111f},
-std::array<float,2>{0.114494108f, 0.261718988f},
-std::array<float,2>{0.558247149f, 0.669386804f},
-std::array<float,2>{0.901135325f, 0.165443048f},
-std::array<float,2>{0.471173555f, 0.765822649f},
-std::array<float,2>{0.304457188f, 0.0379938222f},
-std::array<float,2>{0.836376846f, 0.990649581f},
-std::array<float,2>{0.647316515f, 0.439241946f},
-std::array<float,2>{0.161449149f, 0.535849273f},
-std::array<float,2>{0.431334049f, 0.433152318f},
-std::array<float,2>{0.958803475f, 0.597942412f},
-std::array<float,2>{0.568573475f, 0.121418417f},
-std::array<float,2>{0.0292846132f, 0.908800125f},
-std::array<float,2>{0.244083852f, 0.240298688f},
-std::array<float,2>{0.74791801f, 0.833788514f},
-std::array<float,2>{0.771080017f, 0.369847834f},
-std::array<float,2>{0.363206685f, 0.724949002f},
-std::array<float,2>{0.0512874983f, 0.478836477f},
-std::array<float,2>{0.612517416f, 0.500964105f},
-std::array<float,2>{0.990865469f, 0.0305537693f},
-std::array<float,2>{0.385048538f, 0.960439146f},
-std::array<float,2>{0.322500497f, 0.152191833f},
-std::array<float,2>{0.810250819f, 0.806690335f},
-std::array<float,2>{0.695593417f, 0.309847444f},
-std::array<float,2>{0.190478146f, 0.649882138f},
-std::array<float,2>{0.463146746f, 0.31592834f},
-std::array<float,2>{0.914593399f, 0.717320085f},
-std::array<float,2>{0.512227893f, 0.202071711f},
-std::array<float,2>{0.0762316287f, 0.847192466f},
-std::array<float,2>{0.14045018f, 0.0734805912f},
-std::array<float,2>{0.657946408f, 0.900562108f},
-std::array<float,2>{0.870966733f, 0.379392892f},
-std::array<float,2>{0.27818948f, 0.590373516f},
-std::array<float,2>{0.234785885f, 0.272061944f},
-std::array<float,2>{0.736830592f, 0.684844613f},
-std::array<float,2>{0.779182851f, 0.1760028f},
-std::array<float,2>{0.373422384f, 0.751730263f},
-std::array<float,2>{0.426323891f, 0.0553512014f},
-std::array<float,2>{0.967878282f, 0.976285756f},
-std::array<float,2>{0.574141443f, 0.461957246f},
-std::array<float,2>{0.0230473243f, 0.557873845f},
-std::array<float,2>{0.306411177f, 0.412715971f},
-std::array<float,2>{0.83069396f, 0.621318519f},
-std::array<float,2>{0.653155386f, 0.0969392136f},
-std::array<float,2>{0.167305842f, 0.926034391f},
-std::array<float,2>{0.117622733f, 0.223854914f},
-std::array<float,2>{0.549553156f, 0.821365356f},
-std::array<float,2>{0.891718924f, 0.349795401f},
-std::array<float,2>{0.478022724f, 0.740752995f},
-std::array<float,2>{0.184255391f, 0.398229182f},
-std::array<float,2>{0.637509048f, 0.568229914f},
-std::array<float,2>{0.812503457f, 0.0851311237f},
-std::array<float,2>{0.296863914f, 0.878382325f},
-std::array<float,2>{0.493788153f, 0.215981066f},
-std::array<float,2>{0.877503455f, 0.864770472f},
-std::array<float,2>{0.534145832f, 0.337893248f},
-std::array<float,2>{0.09712217f, 0.699512124f},
-std::array<float,2>{0.355821967f, 0.292972922f},
-std::array<float,2>{0.759692907f, 0.626697659f},
-std::array<float,2>{0.729293942f, 0.133224308f},
-std::array<float,2>{0.226129457f, 0.789327562f},
-std::array<float,2>{0.00153905794f, 0.00858644582f},
-std::array<float,2>{0.589423358f, 0.949145019f},
-std::array<float,2>{0.950436413f, 0.499571592f},
-std::array<float,2>{0.416312128f, 0.529766738f},
-std::array<float,2>{0.0895576626f, 0.373651475f},
-std::array<float,2>{0.523465812f, 0.719299257f},
-std::array<float,2>{0.931514978f, 0.235241324f},
-std::array<float,2>{0.449559689f, 0.83041352f},
-std::array<float,2>{0.263382554f, 0.117647439f},
-std::array<float,2>{0.844355941f, 0.911144137f},
-std::array<float,2>{0.672870159f, 0.433596969f},
-std::array<float,2>{0.144284457f, 0.594705641f},
-std::array<float,2>{0.401801646f, 0.442548603f},
-std::array<float,2>{0.973146021f, 0.534377038f},
-std::array<float,2>{0.606475055f, 0.0313839503f},
-std::array<float,2>{0.0337899402f, 0.987657249f},
-std::array<float,2>{0.207664132f, 0.169313401f},
-std::array<float,2>{0.71141541f, 0.773385167f},
-std::array<float,2>{0.789012671f, 0.258218616f},
-std::array<float,2>{0.333385944f, 0.666144729f},
-std::array<float,2>{0.103776187f, 0.424941361f},
-std::array<float,2>{0.542719126f, 0.604510903f},
-std::array<float,2>{0.889198244f, 0.111011617f},
-std::array<float,2>{0.48613432f, 0.918369293f},
-std::array<float,2>{0.28720361f, 0.247660145f},
-std::array<float,2>{0.827298224f, 0.839267731f},
-std::array<float,2>{0.629397571f, 0.360199898f},
-std::array<float,2>{0.172875464f, 0.731677473f},
-std::array<float,2>{0.4127042f, 0.255577117f},
-std::array<float,2>{0.940061033f, 0.663026333f},
-std::array<float,2>{0.585620046f, 0.158412784f},
-std::array<float,2>{0.0109396195f, 0.775941133f},
-std::array<float,2>{0.232080042f, 0.0460327007f},
-std::array<float,2>{0.725834846f, 0.998205364f},
-std::array<float,2>{0.751461387f, 0.451385647f},
-std::array<float,2>{0.344685495f, 0.543832839f},
-std::array<float,2>{0.152670309f, 0.328968227f},
-std::array<float,2>{0.686825871f, 0.694238901f},
-std::array<float,2>{0.853332877f, 0.207950503f},
-std::array<float,2>{0.254600763f, 0.874985695f},
-std::array<float,2>{0.44105348f, 0.086263679f},
-std::array<float,2>{0.926586688f, 0.884312928f},
-std::array<float,2>{0.520959973f, 0.405364782f},
-std::array<float,2>{0.0847742185f, 0.57802695f},
-std::array<float,2>{0.337353349f, 0.489728004f},
-std::array<float,2>{0.791824162f, 0.521124542f},
-std::array<float,2>{0.706906617f, 0.00291877356f},
-std::array<float,2>{0.215422839f, 0.944829822f},
-std::array<float,2>{0.0435083881f, 0.130215898f},
-std::array<float,2>{0.599036515f, 0.788568318f},
-std::array<float,2>{0.977784157f, 0.283914626f},
-std::array<float,2>{0.391400367f, 0.635571539f},
-std::array<float,2>{0.197861686f, 0.457693875f},
-std::array<float,2>{0.687910378f, 0.550144494f},
-std::array<float,2>{0.801503301f, 0.0536678396f},
-std::array<float,2>{0.314763755f, 0.976960897f},
-std::array<float,2>{0.376231641f, 0.185463369f},
-std::array<float,2>{0.996249557f, 0.762554228f},
-std::array<float,2>{0.622852445f, 0.275784731f},
-std::array<float,2>{0.059136793f, 0.677878439f},
-std::array<float,2>{0.270499378f, 0.359132469f},
-std::array<float,2>{0.861269355f, 0.742572665f},
-std::array<float,2>{0.666597009f, 0.233691543f},
-std::array<float,2>{0.126467198f, 0.813983202f},
-std::array<float,2>{0.0653486401f, 0.10531193f},
-std::array<float,2>{0.50286597f, 0.931951463f},
-std::array<float,2>{0.908012033f, 0.416618854f},
-std::array<float,2>{0.46072641f, 0.616710246f},
-std::array<float,2>{0.0236568432f, 0.298150092f},
-std::array<float,2>{0.563589036f, 0.640752077f},
-std::array<float,2>{0.955347121f, 0.147875756f},
-std::array<float,2>{0.435070008f, 0.800041258f},
-std::array<float,2>{0.364289314f, 0.0225625969f},
-std::array<float,2>{0.765951693f, 0.962885976f},
-std::array<float,2>{0.745002627f, 0.475413322f},
-std::array<float,2>{0.249090657f, 0.510437965f},
-std::array<float,2>{0.473131537f, 0.390306175f},
-std::array<float,2>{0.903230667f, 0.58204776f},
-std::array<float,2>{0.559221625f, 0.0695369616f},
-std::array<float,2>{0.112065144f, 0.892399728f},
-std::array<float,2>{0.157911271f, 0.192641377f},
-std::array<float,2>{0.640752614f, 0.854761183f},
-std::array<float,2>{0.83986479f, 0.324511409f},
-std::array<float,2>{0.300758272f, 0.70571512f},
-std::array<float,2>{0.121408202f, 0.484916359f},
-std::array<float,2>{0.552598059f, 0.516422093f},
-std::array<float,2>{0.898094952f, 0.00744117796f},
-std::array<float,2>{0.481663883f, 0.93971628f},
-std::array<float,2>{0.311264247f, 0.125429779f},
-std::array<float,2>{0.833428323f, 0.783124387f},
-std::array<float,2>{0.651953399f, 0.288249969f},
-std::array<float,2>{0.169838697f, 0.638105035f},
-std::array<float,2>{0.422279298f, 0.33501175f},
-std::array<float,2>{0.963200986f, 0.688981891f},
-std::array<float,2>{0.575271487f, 0.205226511f},
-std::array<float,2>{0.0165388286f, 0.86896646f},
-std::array<float,2>{0.241873175f, 0.0935633928f},
-std::array<float,2>{0.739071548f, 0.886964023f},
-std::array<float,2>{0.775500774f, 0.399816722f},
-std::array<float,2>{0.367267251f, 0.573687732f},
-std::array<float,2>{0.134648949f, 0.253508776f},
-std::array<float,2>{0.663867652f, 0.658141255f},
-std::array<float,2>{0.874472857f, 0.161815882f},
-std::array<float,2>{0.275180042f, 0.777803838f},
-std::array<float,2>{0.46738264f, 0.0417875089f},
-std::array<float,2>{0.918408036f, 0.995472789f},
-std::array<float,2>{0.50865072f, 0.445960104f},
-std::array<float,2>{0.0726453066f, 0.541234374f},
-std::array<float,2>{0.326690584f, 0.428582281f},
-std::array<float,2>{0.807242632f, 0.606695235f},
-std::array<float,2>{0.702707589f, 0.114506066f},
-std::array<float,2>{0.193059698f, 0.914393961f},
-std::array<float,2>{0.0480887257f, 0.242863402f},
-std::array<float,2>{0.614779711f, 0.840952516f},
-std::array<float,2>{0.986370265f, 0.367023826f},
-std::array<float,2>{0.389827043f, 0.727531791f},
-std::array<float,2>{0.206059337f, 0.384172797f},
-std::array<float,2>{0.718075335f, 0.581263125f},
-std::array<float,2>{0.784957588f, 0.0646690875f},
-std::array<float,2>{0.329245776f, 0.896421134f},
-std::array<float,2>{0.406004786f, 0.188611135f},
-std::array<float,2>{0.972648263f, 0.85785085f},
-std::array<float,2>{0.604309499f, 0.322703451f},
-std::array<float,2>{0.0384834185f, 0.707202554f},
-std::array<float,2>{0.25973314f, 0.302399457f},
-std::array<float,2>{0.849139869f, 0.646998525f},
-std::array<float,2>{0.676099837f, 0.142586157f},
-std::array<float,2>{0.146908075f, 0.801009238f},
-std::array<float,2>{0.092516847f, 0.0185206849f},
-std::array<float,2>{0.530135036f, 0.967942595f},
-std::array<float,2>{0.935229123f, 0.471427053f},
-std::array<float,2>{0.4463799f, 0.512748122f},
-std::array<float,2>{0.0069711511f, 0.354757041f},
-std::array<float,2>{0.589957476f, 0.749066949f},
-std::array<float,2>{0.945918322f, 0.227848336f},
-std::array<float,2>{0.420609653f, 0.818386555f},
-std::array<float,2>{0.354780495f, 0.108096898f},
-std::array<float,2>{0.761892378f, 0.935120642f},
-std::array<float,2>{0.731900394f, 0.4191688f},
-std::array<float,2>{0.221159279f, 0.609717727f},
-std::array<float,2>{0.49998191f, 0.456435919f},
-std::array<float,2>{0.881349146f, 0.553406239f},
-std::array<float,2>{0.538056254f, 0.0475718305f},
-std::array<float,2>{0.0976906568f, 0.983087718f},
-std::array<float,2>{0.18139492f, 0.182360709f},
-std::array<float,2>{0.634496927f, 0.76145649f},
-std::array<float,2>{0.818946779f, 0.279166222f},
-std::array<float,2>{0.289162636f, 0.672946095f},
-std::array<float,2>{0.0408936739f, 0.408349663f},
-std::array<float,2>{0.597579658f, 0.618059397f},
-std::array<float,2>{0.980518162f, 0.0981208682f},
-std::array<float,2>{0.396891862f, 0.923698843f},
-std::array<float,2>{0.342791587f, 0.219381452f},
-std::array<float,2>{0.794034719f, 0.82591188f},
-std::array<float,2>{0.707241178f, 0.344499528f},
-std::array<float,2>{0.21391505f, 0.735103607f},
-std::array<float,2>{0.444834858f, 0.268467844f},
-std::array<float,2>{0.924623966f, 0.68257767f},
-std::array<float,2>{0.51591897f, 0.172374785f},
-std::array<float,2>{0.0799948648f, 0.755183339f},
-std::array<float,2>{0.151940376f, 0.0604574271f},
-std::array<float,2>{0.682759583f, 0.972213745f},
-std::array<float,2>{0.855891049f, 0.466881931f},
-std::array<float,2>{0.252824038f, 0.55970192f},
-std::array<float,2>{0.230020225f, 0.317118764f},
-std::array<float,2>{0.721871078f, 0.711547792f},
-std::array<float,2>{0.756862998f, 0.196128592f},
-std::array<float,2>{0.348288387f, 0.849786103f},
-std::array<float,2>{0.407908857f, 0.0776831657f},
-std::array<float,2>{0.943599105f, 0.905107796f},
-std::array<float,2>{0.580872118f, 0.37745443f},
-std::array<float,2>{0.0153202945f, 0.58831048f},
-std::array<float,2>{0.285021871f, 0.480948925f},
-std::array<float,2>{0.823117018f, 0.506886899f},
-std::array<float,2>{0.627402782f, 0.026398629f},
-std::array<float,2>{0.176769987f, 0.955410182f},
-std::array<float,2>{0.107737526f, 0.153296486f},
-std::array<float,2>{0.54442817f, 0.810051978f},
-std::array<float,2>{0.884465992f, 0.307504654f},
-std::array<float,2>{0.489400417f, 0.652368367f},
-std::array<float,2>{0.162330702f, 0.441209346f},
-std::array<float,2>{0.644993901f, 0.537908912f},
-std::array<float,2>{0.83966881f, 0.0370178521f},
-std::array<float,2>{0.302471995f, 0.989843249f},
-std::array<float,2>{0.469755709f, 0.166952327f},
-std::array<float,2>{0.899346173f, 0.76940161f},
-std::array<float,2>{0.555442929f, 0.26511541f},
-std::array<float,2>{0.116178401f, 0.670999467f},
-std::array<float,2>{0.360967755f, 0.368922621f},
-std::array<float,2>{0.773377419f, 0.723597884f},
-std::array<float,2>{0.749283493f, 0.238613248f},
-std::array<float,2>{0.246062383f, 0.835478604f},
-std::array<float,2>{0.0303058065f, 0.123400897f},
-std::array<float,2>{0.56682384f, 0.906988442f},
-std::array<float,2>{0.959141195f, 0.430541545f},
-std::array<float,2>{0.432010561f, 0.59980768f},
-std::array<float,2>{0.0676847845f, 0.290023208f},
-std::array<float,2>{0.504613817f, 0.63064307f},
-std::array<float,2>{0.910404205f, 0.139881834f},
-std::array<float,2>{0.455445141f, 0.79452908f},
-std::array<float,2>{0.268401772f, 0.0156168556f},
-std::array<float,2>{0.864105523f, 0.951175332f},
-std::array<float,2>{0.66937083f, 0.492798626f},
-std::array<float,2>{0.129146487f, 0.525196195f},
-std::array<float,2>{0.379255712f, 0.392561972f},
-std::array<float,2>{0.992217958f, 0.565590441f},
-std::array<float,2>{0.618245125f, 0.0784521848f},
-std::array<float,2>{0.0579242222f, 0.881615102f},
-std::array<float,2>{0.202007145f, 0.211457118f},
-std::array<float,2>{0.693270028f, 0.862263918f},
-std::array<float,2>{0.800391614f, 0.342351794f},
-std::array<float,2>{0.318758905f, 0.696963131f},
-std::array<float,2>{0.0202445164f, 0.4642075f},
-std::array<float,2>{0.572014391f, 0.554887652f},
-std::array<float,2>{0.965135694f, 0.0573823154f},
-std::array<float,2>{0.429672033f, 0.973909736f},
-std::array<float,2>{0.372516364f, 0.179570317f},
-std::array<float,2>{0.779702246f, 0.752097547f},
-std::array<float,2>{0.735955119f, 0.271450579f},
-std::array<float,2>{0.237759113f, 0.685964763f},
-std::array<float,2>{0.479681611f, 0.347786963f},
-std::array<float,2>{0.893744707f, 0.740111709f},
-std::array<float,2>{0.547775984f, 0.226387411f},
-std::array<float,2>{0.120900795f, 0.823030531f},
-std::array<float,2>{0.165526047f, 0.0947876722f},
-std::array<float,2>{0.654649019f, 0.928114653f},
-std::array<float,2>{0.829440594f, 0.41106084f},
-std::array<float,2>{0.307776749f, 0.623361826f},
-std::array<float,2>{0.18790625f, 0.311262697f},
-std::array<float,2>{0.698627591f, 0.651756406f},
-std::array<float,2>{0.811440885f, 0.149059728f},
-std::array<float,2>{0.320978194f, 0.805626929f},
-std::array<float,2>{0.384553224f, 0.0286472645f},
-std::array<float,2>{0.989023924f, 0.958153903f},
-std::array<float,2>{0.611308277f, 0.476903677f},
-std::array<float,2>{0.0530735925f, 0.502803385f},
-std::array<float,2>{0.280131608f, 0.382672906f},
-std::array<float,2>{0.868332088f, 0.592711687f},
-std::array<float,2>{0.659860373f, 0.0710935444f},
-std::array<float,2>{0.137100354f, 0.899105608f},
-std::array<float,2>{0.0754343271f, 0.200268567f},
-std::array<float,2>{0.515250862f, 0.844205797f},
-std::array<float,2>{0.916273594f, 0.314268142f},
-std::array<float,2>{0.462639749f, 0.71659869f},
-std::array<float,2>{0.141886652f, 0.435750782f},
-std::array<float,2>{0.675051928f, 0.596274614f},
-std::array<float,2>{0.84696269f, 0.120915316f},
-std::array<float,2>{0.264296591f, 0.912941754f},
-std::array<float,2>{0.451584905f, 0.237884507f},
-std::array<float,2>{0.932823181f, 0.83000958f},
-std::array<float,2>{0.525449574f, 0.372025222f},
-std::array<float,2>{0.0872900262f, 0.720718622f},
-std::array<float,2>{0.334082961f, 0.260946423f},
-std::array<float,2>{0.78690213f, 0.664838791f},
-std::array<float,2>{0.713532388f, 0.170840561f},
-std::array<float,2>{0.209805191f, 0.769986153f},
-std::array<float,2>{0.0329063386f, 0.0347435325f},
-std::array<float,2>{0.608387649f, 0.986078501f},
-std::array<float,2>{0.974861383f, 0.444218367f},
-std::array<float,2>{0.400130391f, 0.531881094f},
-std::array<float,2>{0.0939271823f, 0.337027818f},
-std::array<float,2>{0.532451272f, 0.701276958f},
-std::array<float,2>{0.876317322f, 0.21871303f},
-std::array<float,2>{0.495908648f, 0.866013408f},
-std::array<float,2>{0.294326901f, 0.0833222792f},
-std::array<float,2>{0.814624369f, 0.875823855f},
-std::array<float,2>{0.639335096f, 0.394810885f},
-std::array<float,2>{0.185954526f, 0.568380892f},
-std::array<float,2>{0.414958656f, 0.496845275f},
-std::array<float,2>{0.95264864f, 0.529010713f},
-std::array<float,2>{0.586903393f, 0.0106134973f},
-std::array<float,2>{0.00359138194f, 0.947080374f},
-std::array<float,2>{0.223197743f, 0.135547534f},
-std::array<float,2>{0.72701937f, 0.791568875f},
-std::array<float,2>{0.761671484f, 0.295623243f},
-std::array<float,2>{0.357775569f, 0.628026605f},
-std::array<float,2>{0.0832360312f, 0.404295683f},
-std::array<float,2>{0.521846592f, 0.575665891f},
-std::array<float,2>{0.928062022f, 0.0879179761f},
-std::array<float,2>{0.438765019f, 0.885136724f},
-std::array<float,2>{0.257410645f, 0.210048988f},
-std::array<float,2>{0.854109049f, 0.872534275f},
-std::array<float,2>{0.685376287f, 0.331243724f},
-std::array<float,2>{0.155986831f, 0.691458106f},
-std::array<float,2>{0.394049138f, 0.282920927f},
-std::array<float,2>{0.979197443f, 0.633135319f},
-std::array<float,2>{0.599874675f, 0.132601053f},
-std::array<float,2>{0.046100866f, 0.785907388f},
-std::array<float,2>{0.21761629f, 0.000147399434f},
-std::array<float,2>{0.704300642f, 0.94327873f},
-std::array<float,2>{0.790041506f, 0.490717471f},
-std::array<float,2>{0.339558721f, 0.522408128f},
-std::array<float,2>{0.175455749f, 0.361379892f},
-std::array<float,2>{0.631734908f, 0.734181046f},
-std::array<float,2>{0.825467587f, 0.248916715f},
-std::array<float,2>{0.285280436f, 0.836174965f},
-std::array<float,2>{0.487958312f, 0.112018548f},
-std::array<float,2>{0.887962401f, 0.921199083f},
-std::array<float,2>{0.539811313f, 0.422015905f},
-std::array<float,2>{0.102148257f, 0.601998448f},
-std::array<float,2>{0.347428679f, 0.449932307f},
-std::array<float,2>{0.753103018f, 0.546025753f},
-std::array<float,2>{0.723911881f, 0.044422593f},
-std::array<float,2>{0.233566537f, 0.998031855f},
-std::array<float,2>{0.00880919676f, 0.158037812f},
-std::array<float,2>{0.583385348f, 0.775102735f},
-std::array<float,2>{0.939409256f, 0.256471485f},
-std::array<float,2>{0.411454469f, 0.660715103f},
-std::array<float,2>{0.246234775f, 0.474330366f},
-std::array<float,2>{0.742482305f, 0.508168578f},
-std::array<float,2>{0.769249737f, 0.0213619471f},
-std::array<float,2>{0.365445375f, 0.963687837f},
-std::array<float,2>{0.43673858f, 0.14551267f},
-std::array<float,2>{0.95449394f, 0.79713887f},
-std::array<float,2>{0.565885663f, 0.299148977f},
-std::array<float,2>{0.0261370204f, 0.642957509f},
-std::array<float,2>{0.298643649f, 0.327596724f},
-std::array<float,2>{0.841955721f, 0.704898059f},
-std::array<float,2>{0.642856181f, 0.194035932f},
-std::array<float,2>{0.158511505f, 0.852142513f},
-std::array<float,2>{0.109705053f, 0.0666000322f},
-std::array<float,2>{0.561326683f, 0.893878698f},
-std::array<float,2>{0.905123234f, 0.386921376f},
-std::array<float,2>{0.474910438f, 0.584571064f},
-std::array<float,2>{0.0610384718f, 0.273502946f},
-std::array<float,2>{0.624748945f, 0.676464021f},
-std::array<float,2>{0.999937773f, 0.186978519f},
-std::array<float,2>{0.377119988f, 0.763723552f},
-std::array<float,2>{0.313765943f, 0.0515552647f},
-std::array<float,2>{0.803845048f, 0.979387999f},
-std::array<float,2>{0.690991044f, 0.460897058f},
-std::array<float,2>{0.196625873f, 0.547111452f},
-std::array<float,2>{0.457803398f, 0.415686578f},
-std::array<float,2>{0.90829879f, 0.614067972f},
-std::array<float,2>{0.501212597f, 0.101687029f},
-std::array<float,2>{0.0625238046f, 0.930430472f},
-std::array<float,2>{0.127479151f, 0.232217565f},
-std::array<float,2>{0.665079772f, 0.815848589f},
-std::array<float,2>{0.861748278f, 0.356464416f},
-std::array<float,2>{0.273149699f, 0.745229423f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.808457911f, 0.72159493f},
-std::array<float,2>{0.185144961f, 0.0428078547f},
-std::array<float,2>{0.529370606f, 0.365116805f},
-std::array<float,2>{0.305914104f, 0.867895603f},
-std::array<float,2>{0.706639051f, 0.887097955f},
-std::array<float,2>{0.395159334f, 0.443625718f},
-std::array<float,2>{0.87563771f, 0.242955729f},
-std::array<float,2>{0.042110078f, 0.623138309f},
-std::array<float,2>{0.997658968f, 0.811301887f},
-std::array<float,2>{0.112471916f, 0.251498848f},
-std::array<float,2>{0.664678693f, 0.116377406f},
-std::array<float,2>{0.460618019f, 0.653626621f},
-std::array<float,2>{0.589874327f, 0.545865417f},
-std::array<float,2>{0.368368089f, 0.142908961f},
-std::array<float,2>{0.872153521f, 0.40451166f},
-std::array<float,2>{0.240413114f, 0.991925001f},
-std::array<float,2>{0.906303823f, 0.569183469f},
-std::array<float,2>{0.000168541636f, 0.215477765f},
-std::array<float,2>{0.739351749f, 0.477662116f},
-std::array<float,2>{0.428969175f, 0.918729246f},
-std::array<float,2>{0.534644663f, 0.812852144f},
-std::array<float,2>{0.250391603f, 0.31582436f},
-std::array<float,2>{0.771111965f, 0.0181267112f},
-std::array<float,2>{0.135400668f, 0.706077039f},
-std::array<float,2>{0.837253392f, 0.948214889f},
-std::array<float,2>{0.195028856f, 0.421453476f},
-std::array<float,2>{0.612210333f, 0.183761925f},
-std::array<float,2>{0.333566844f, 0.502736092f},
-std::array<float,2>{0.653290749f, 0.68208313f},
-std::array<float,2>{0.47136271f, 0.0811893493f},
-std::array<float,2>{0.948661625f, 0.302797854f},
-std::array<float,2>{0.0726483539f, 0.762923896f},
-std::array<float,2>{0.967745245f, 0.636778474f},
-std::array<float,2>{0.0857285038f, 0.0948327109f},
-std::array<float,2>{0.625803292f, 0.268484443f},
-std::array<float,2>{0.485897034f, 0.782407165f},
-std::array<float,2>{0.595340967f, 0.981731296f},
-std::array<float,2>{0.319752991f, 0.376637816f},
-std::array<float,2>{0.816447616f, 0.131928235f},
-std::array<float,2>{0.206453025f, 0.561140954f},
-std::array<float,2>{0.764475763f, 0.857514977f},
-std::array<float,2>{0.154076219f, 0.344615042f},
-std::array<float,2>{0.551596344f, 0.0540691875f},
-std::array<float,2>{0.271892011f, 0.736313641f},
-std::array<float,2>{0.723104596f, 0.598763466f},
-std::array<float,2>{0.41776377f, 0.231246233f},
-std::array<float,2>{0.931379914f, 0.457326978f},
-std::array<float,2>{0.0253776684f, 0.899220943f},
-std::array<float,2>{0.856325567f, 0.526243806f},
-std::array<float,2>{0.220757246f, 0.161551252f},
-std::array<float,2>{0.57549125f, 0.432984561f},
-std::array<float,2>{0.34641993f, 0.955402136f},
-std::array<float,2>{0.682463646f, 0.773443937f},
-std::array<float,2>{0.446416944f, 0.29682368f},
-std::array<float,2>{0.976551473f, 0.0647377446f},
-std::array<float,2>{0.0941456705f, 0.658110142f},
-std::array<float,2>{0.898154855f, 0.934501946f},
-std::array<float,2>{0.0525205024f, 0.489987999f},
-std::array<float,2>{0.693245173f, 0.191488147f},
-std::array<float,2>{0.382762313f, 0.592603385f},
-std::array<float,2>{0.513053954f, 0.696399808f},
-std::array<float,2>{0.289966434f, 0.0139494473f},
-std::array<float,2>{0.781678081f, 0.330920994f},
-std::array<float,2>{0.166809127f, 0.839160502f},
-std::array<float,2>{0.823839664f, 0.670706749f},
-std::array<float,2>{0.217802837f, 0.071813561f},
-std::array<float,2>{0.605963349f, 0.2844854f},
-std::array<float,2>{0.327237308f, 0.766308784f},
-std::array<float,2>{0.633251131f, 0.964888155f},
-std::array<float,2>{0.494353056f, 0.427705199f},
-std::array<float,2>{0.953181744f, 0.170458853f},
-std::array<float,2>{0.0874530748f, 0.518485725f},
-std::array<float,2>{0.923105597f, 0.835195303f},
-std::array<float,2>{0.0215397216f, 0.339675009f},
-std::array<float,2>{0.733033895f, 0.000459451374f},
-std::array<float,2>{0.409467667f, 0.694287121f},
-std::array<float,2>{0.554790199f, 0.585473835f},
-std::array<float,2>{0.280298293f, 0.197300091f},
-std::array<float,2>{0.750613689f, 0.493838429f},
-std::array<float,2>{0.144291088f, 0.922490001f},
-std::array<float,2>{0.978173077f, 0.551870584f},
-std::array<float,2>{0.104193538f, 0.138990611f},
-std::array<float,2>{0.674399436f, 0.383169383f},
-std::array<float,2>{0.442593426f, 0.973083854f},
-std::array<float,2>{0.565857112f, 0.79199481f},
-std::array<float,2>{0.355391771f, 0.279702067f},
-std::array<float,2>{0.844488442f, 0.105001748f},
-std::array<float,2>{0.226870969f, 0.625058472f},
-std::array<float,2>{0.789188981f, 0.893114269f},
-std::array<float,2>{0.160598963f, 0.463652849f},
-std::array<float,2>{0.504392147f, 0.22425352f},
-std::array<float,2>{0.283057094f, 0.607730567f},
-std::array<float,2>{0.700023055f, 0.748127282f},
-std::array<float,2>{0.386421025f, 0.0591042191f},
-std::array<float,2>{0.900264621f, 0.359112471f},
-std::array<float,2>{0.05559773f, 0.847082794f},
-std::array<float,2>{0.88982147f, 0.715129852f},
-std::array<float,2>{0.0331668481f, 0.0301986467f},
-std::array<float,2>{0.715825438f, 0.32449469f},
-std::array<float,2>{0.402053267f, 0.821445286f},
-std::array<float,2>{0.521655917f, 0.912672818f},
-std::array<float,2>{0.298107922f, 0.472823709f},
-std::array<float,2>{0.799653411f, 0.205685034f},
-std::array<float,2>{0.175150663f, 0.573689461f},
-std::array<float,2>{0.862265766f, 0.750287712f},
-std::array<float,2>{0.242634729f, 0.307979286f},
-std::array<float,2>{0.579866707f, 0.0860447884f},
-std::array<float,2>{0.363894612f, 0.67956382f},
-std::array<float,2>{0.661361456f, 0.515505016f},
-std::array<float,2>{0.462580264f, 0.173686147f},
-std::array<float,2>{0.991858125f, 0.40732491f},
-std::array<float,2>{0.121173277f, 0.942313612f},
-std::array<float,2>{0.778141916f, 0.611353993f},
-std::array<float,2>{0.13215071f, 0.234684974f},
-std::array<float,2>{0.543452322f, 0.451606035f},
-std::array<float,2>{0.260807663f, 0.881392241f},
-std::array<float,2>{0.746874332f, 0.863789856f},
-std::array<float,2>{0.432612658f, 0.369980514f},
-std::array<float,2>{0.917273462f, 0.0336086303f},
-std::array<float,2>{0.00901672617f, 0.730172694f},
-std::array<float,2>{0.939218938f, 0.993414521f},
-std::array<float,2>{0.0658517778f, 0.394996077f},
-std::array<float,2>{0.643043756f, 0.153746843f},
-std::array<float,2>{0.480081439f, 0.535262287f},
-std::array<float,2>{0.617232919f, 0.640698254f},
-std::array<float,2>{0.340367049f, 0.117244102f},
-std::array<float,2>{0.83022666f, 0.259693056f},
-std::array<float,2>{0.196716398f, 0.800951362f},
-std::array<float,2>{0.757502556f, 0.651280582f},
-std::array<float,2>{0.147301883f, 0.112452827f},
-std::array<float,2>{0.559972942f, 0.256391764f},
-std::array<float,2>{0.273879826f, 0.805467784f},
-std::array<float,2>{0.727327347f, 0.985785484f},
-std::array<float,2>{0.41282174f, 0.401678979f},
-std::array<float,2>{0.928542137f, 0.146946713f},
-std::array<float,2>{0.0179449711f, 0.540922821f},
-std::array<float,2>{0.95990628f, 0.872606099f},
-std::array<float,2>{0.0912812576f, 0.361619949f},
-std::array<float,2>{0.639431655f, 0.046386797f},
-std::array<float,2>{0.49832204f, 0.723363876f},
-std::array<float,2>{0.603397548f, 0.618065f},
-std::array<float,2>{0.321244329f, 0.249816582f},
-std::array<float,2>{0.827450216f, 0.44035545f},
-std::array<float,2>{0.214289844f, 0.886381924f},
-std::array<float,2>{0.906056821f, 0.505894005f},
-std::array<float,2>{0.0619168766f, 0.179729164f},
-std::array<float,2>{0.696271002f, 0.41768375f},
-std::array<float,2>{0.388563514f, 0.952076912f},
-std::array<float,2>{0.502411962f, 0.760265052f},
-std::array<float,2>{0.285481095f, 0.300627768f},
-std::array<float,2>{0.795475483f, 0.085475035f},
-std::array<float,2>{0.159415007f, 0.687266409f},
-std::array<float,2>{0.848294556f, 0.91554451f},
-std::array<float,2>{0.230887473f, 0.481509238f},
-std::array<float,2>{0.567217708f, 0.211928025f},
-std::array<float,2>{0.356374621f, 0.562621653f},
-std::array<float,2>{0.675851166f, 0.70767504f},
-std::array<float,2>{0.441146582f, 0.0198282059f},
-std::array<float,2>{0.981130362f, 0.317055136f},
-std::array<float,2>{0.108297408f, 0.817082167f},
-std::array<float,2>{0.987382233f, 0.739951909f},
-std::array<float,2>{0.117937773f, 0.0468953997f},
-std::array<float,2>{0.656287074f, 0.347658783f},
-std::array<float,2>{0.467171401f, 0.852270782f},
-std::array<float,2>{0.583777547f, 0.905563593f},
-std::array<float,2>{0.36060971f, 0.454893082f},
-std::array<float,2>{0.8633039f, 0.229478091f},
-std::array<float,2>{0.24921371f, 0.59394604f},
-std::array<float,2>{0.802759826f, 0.78626591f},
-std::array<float,2>{0.176777795f, 0.270925224f},
-std::array<float,2>{0.51867789f, 0.099380672f},
-std::array<float,2>{0.304192215f, 0.636077046f},
-std::array<float,2>{0.714138985f, 0.556301594f},
-std::array<float,2>{0.40374133f, 0.128586069f},
-std::array<float,2>{0.88454622f, 0.38156271f},
-std::array<float,2>{0.0355728231f, 0.978916168f},
-std::array<float,2>{0.832639098f, 0.586367071f},
-std::array<float,2>{0.201552927f, 0.191050842f},
-std::array<float,2>{0.624009788f, 0.48769626f},
-std::array<float,2>{0.339304179f, 0.930648804f},
-std::array<float,2>{0.64762187f, 0.841282427f},
-std::array<float,2>{0.482265085f, 0.333247572f},
-std::array<float,2>{0.944143772f, 0.00822485052f},
-std::array<float,2>{0.0669045299f, 0.699430048f},
-std::array<float,2>{0.919400275f, 0.959261835f},
-std::array<float,2>{0.0120838406f, 0.435000837f},
-std::array<float,2>{0.744789124f, 0.1587383f},
-std::array<float,2>{0.435654461f, 0.528558016f},
-std::array<float,2>{0.541088641f, 0.661876202f},
-std::array<float,2>{0.264253587f, 0.0699896291f},
-std::array<float,2>{0.77680558f, 0.290792823f},
-std::array<float,2>{0.126949266f, 0.780677199f},
-std::array<float,2>{0.870573521f, 0.689231932f},
-std::array<float,2>{0.235920981f, 0.00502621569f},
-std::array<float,2>{0.58671546f, 0.340969622f},
-std::array<float,2>{0.371966243f, 0.831242919f},
-std::array<float,2>{0.668570757f, 0.927112162f},
-std::array<float,2>{0.454637676f, 0.499522299f},
-std::array<float,2>{0.994374573f, 0.199936599f},
-std::array<float,2>{0.114285253f, 0.581577122f},
-std::array<float,2>{0.880513191f, 0.77166599f},
-std::array<float,2>{0.04538735f, 0.285405725f},
-std::array<float,2>{0.709676862f, 0.0743039921f},
-std::array<float,2>{0.391973495f, 0.665974498f},
-std::array<float,2>{0.524594128f, 0.521453202f},
-std::array<float,2>{0.309057802f, 0.165131226f},
-std::array<float,2>{0.809103966f, 0.424631864f},
-std::array<float,2>{0.182670921f, 0.961045086f},
-std::array<float,2>{0.950789213f, 0.602002084f},
-std::array<float,2>{0.0766945407f, 0.220065013f},
-std::array<float,2>{0.649912238f, 0.467537582f},
-std::array<float,2>{0.475543588f, 0.898416162f},
-std::array<float,2>{0.616335034f, 0.850707412f},
-std::array<float,2>{0.328561783f, 0.352893293f},
-std::array<float,2>{0.841683805f, 0.0571338423f},
-std::array<float,2>{0.190633908f, 0.7436921f},
-std::array<float,2>{0.768915057f, 0.970397353f},
-std::array<float,2>{0.140468866f, 0.389722586f},
-std::array<float,2>{0.536828518f, 0.134183779f},
-std::array<float,2>{0.253964424f, 0.547189295f},
-std::array<float,2>{0.736532271f, 0.630092084f},
-std::array<float,2>{0.423251033f, 0.106112368f},
-std::array<float,2>{0.910973072f, 0.275079608f},
-std::array<float,2>{0.00626219669f, 0.795231462f},
-std::array<float,2>{0.936279476f, 0.673374772f},
-std::array<float,2>{0.0274415594f, 0.0909229368f},
-std::array<float,2>{0.722143114f, 0.309433609f},
-std::array<float,2>{0.419864178f, 0.756276786f},
-std::array<float,2>{0.550275505f, 0.938854516f},
-std::array<float,2>{0.267464787f, 0.413083464f},
-std::array<float,2>{0.758232236f, 0.17603986f},
-std::array<float,2>{0.15145354f, 0.510703444f},
-std::array<float,2>{0.812970936f, 0.825086117f},
-std::array<float,2>{0.209011912f, 0.322942257f},
-std::array<float,2>{0.601517916f, 0.0241396874f},
-std::array<float,2>{0.31286934f, 0.714441001f},
-std::array<float,2>{0.629152834f, 0.577937543f},
-std::array<float,2>{0.490077078f, 0.207163826f},
-std::array<float,2>{0.964589655f, 0.471271694f},
-std::array<float,2>{0.0787134022f, 0.908481598f},
-std::array<float,2>{0.788461149f, 0.532161593f},
-std::array<float,2>{0.169825777f, 0.151465103f},
-std::array<float,2>{0.510050058f, 0.390677035f},
-std::array<float,2>{0.293506235f, 0.996251345f},
-std::array<float,2>{0.68895191f, 0.797519326f},
-std::array<float,2>{0.375826687f, 0.264003515f},
-std::array<float,2>{0.893144667f, 0.123153172f},
-std::array<float,2>{0.0475503206f, 0.647217631f},
-std::array<float,2>{0.970184267f, 0.878154635f},
-std::array<float,2>{0.101057f, 0.448988527f},
-std::array<float,2>{0.686639667f, 0.239575252f},
-std::array<float,2>{0.450269639f, 0.615380228f},
-std::array<float,2>{0.573835731f, 0.733671904f},
-std::array<float,2>{0.349137157f, 0.0360644013f},
-std::array<float,2>{0.851617873f, 0.37371254f},
-std::array<float,2>{0.223504841f, 0.862347841f},
-std::array<float,2>{0.772400975f, 0.703602433f},
-std::array<float,2>{0.134044349f, 0.0168232415f},
-std::array<float,2>{0.533123136f, 0.312549829f},
-std::array<float,2>{0.252950907f, 0.814988911f},
-std::array<float,2>{0.741057456f, 0.920094609f},
-std::array<float,2>{0.425922602f, 0.479358554f},
-std::array<float,2>{0.908792615f, 0.217184991f},
-std::array<float,2>{0.00315490318f, 0.567283988f},
-std::array<float,2>{0.946992576f, 0.764423251f},
-std::array<float,2>{0.0715305582f, 0.300939441f},
-std::array<float,2>{0.655484259f, 0.079064101f},
-std::array<float,2>{0.47006166f, 0.680436194f},
-std::array<float,2>{0.611112297f, 0.501443267f},
-std::array<float,2>{0.335584015f, 0.186825648f},
-std::array<float,2>{0.838206887f, 0.41906935f},
-std::array<float,2>{0.19315204f, 0.945776105f},
-std::array<float,2>{0.877714753f, 0.622537673f},
-std::array<float,2>{0.0407552086f, 0.244922966f},
-std::array<float,2>{0.704619467f, 0.442351758f},
-std::array<float,2>{0.397666246f, 0.889805973f},
-std::array<float,2>{0.528173029f, 0.871035218f},
-std::array<float,2>{0.307015896f, 0.367045432f},
-std::array<float,2>{0.805654049f, 0.0397041962f},
-std::array<float,2>{0.186045215f, 0.719337344f},
-std::array<float,2>{0.874665856f, 0.989527285f},
-std::array<float,2>{0.238938361f, 0.404143721f},
-std::array<float,2>{0.592035651f, 0.142394438f},
-std::array<float,2>{0.370051473f, 0.544840872f},
-std::array<float,2>{0.667765558f, 0.656170249f},
-std::array<float,2>{0.457356304f, 0.114163257f},
-std::array<float,2>{0.999809682f, 0.253368348f},
-std::array<float,2>{0.11012058f, 0.810119271f},
-std::array<float,2>{0.972735047f, 0.658386648f},
-std::array<float,2>{0.0963605791f, 0.0635758042f},
-std::array<float,2>{0.681078494f, 0.293553501f},
-std::array<float,2>{0.447352678f, 0.775516987f},
-std::array<float,2>{0.576764524f, 0.954699993f},
-std::array<float,2>{0.344238907f, 0.431424975f},
-std::array<float,2>{0.859174609f, 0.163471684f},
-std::array<float,2>{0.219321072f, 0.524051726f},
-std::array<float,2>{0.784378886f, 0.837011218f},
-std::array<float,2>{0.16525498f, 0.329499155f},
-std::array<float,2>{0.51438272f, 0.0129446182f},
-std::array<float,2>{0.292041153f, 0.69801116f},
-std::array<float,2>{0.694091558f, 0.591041744f},
-std::array<float,2>{0.380005509f, 0.193408147f},
-std::array<float,2>{0.895380735f, 0.491873682f},
-std::array<float,2>{0.0533853956f, 0.936677575f},
-std::array<float,2>{0.820273936f, 0.559418142f},
-std::array<float,2>{0.203657746f, 0.130323663f},
-std::array<float,2>{0.596295595f, 0.377693146f},
-std::array<float,2>{0.317191184f, 0.982597053f},
-std::array<float,2>{0.628269732f, 0.784787536f},
-std::array<float,2>{0.487187624f, 0.265797734f},
-std::array<float,2>{0.965390503f, 0.0975954533f},
-std::array<float,2>{0.0821850449f, 0.639790535f},
-std::array<float,2>{0.932382822f, 0.901013136f},
-std::array<float,2>{0.0271539204f, 0.460510612f},
-std::array<float,2>{0.724619389f, 0.23362124f},
-std::array<float,2>{0.414983988f, 0.601238251f},
-std::array<float,2>{0.553111196f, 0.736895442f},
-std::array<float,2>{0.269692004f, 0.0521474257f},
-std::array<float,2>{0.763363063f, 0.346632183f},
-std::array<float,2>{0.154809907f, 0.855895519f},
-std::array<float,2>{0.84724915f, 0.627218068f},
-std::array<float,2>{0.230367228f, 0.102069035f},
-std::array<float,2>{0.562960923f, 0.277409375f},
-std::array<float,2>{0.353306383f, 0.78930223f},
-std::array<float,2>{0.673235118f, 0.975821018f},
-std::array<float,2>{0.444043368f, 0.386328042f},
-std::array<float,2>{0.980409861f, 0.136961251f},
-std::array<float,2>{0.102750808f, 0.553796053f},
-std::array<float,2>{0.901776433f, 0.844153345f},
-std::array<float,2>{0.0573491305f, 0.355937362f},
-std::array<float,2>{0.702338278f, 0.061781317f},
-std::array<float,2>{0.383238971f, 0.747346401f},
-std::array<float,2>{0.506508052f, 0.606054366f},
-std::array<float,2>{0.283511251f, 0.22568351f},
-std::array<float,2>{0.791931152f, 0.462447584f},
-std::array<float,2>{0.162695363f, 0.890764177f},
-std::array<float,2>{0.955212951f, 0.516996264f},
-std::array<float,2>{0.0895282552f, 0.169856265f},
-std::array<float,2>{0.635494769f, 0.429447263f},
-std::array<float,2>{0.492638528f, 0.968395472f},
-std::array<float,2>{0.609223962f, 0.767760038f},
-std::array<float,2>{0.324979067f, 0.282045513f},
-std::array<float,2>{0.821375847f, 0.0724771172f},
-std::array<float,2>{0.216491386f, 0.668074608f},
-std::array<float,2>{0.752753437f, 0.924729109f},
-std::array<float,2>{0.141232565f, 0.495743424f},
-std::array<float,2>{0.55700469f, 0.195768639f},
-std::array<float,2>{0.277651429f, 0.583351016f},
-std::array<float,2>{0.731269181f, 0.691556394f},
-std::array<float,2>{0.406785339f, 0.00338596641f},
-std::array<float,2>{0.925264001f, 0.337809652f},
-std::array<float,2>{0.021418592f, 0.832615554f},
-std::array<float,2>{0.914717019f, 0.727902412f},
-std::array<float,2>{0.0113329608f, 0.0320215225f},
-std::array<float,2>{0.748295724f, 0.367549092f},
-std::array<float,2>{0.430975825f, 0.865781307f},
-std::array<float,2>{0.545071363f, 0.879941404f},
-std::array<float,2>{0.258130968f, 0.449369103f},
-std::array<float,2>{0.779445171f, 0.236775815f},
-std::array<float,2>{0.129904807f, 0.609835804f},
-std::array<float,2>{0.829945147f, 0.803158104f},
-std::array<float,2>{0.198744029f, 0.260934144f},
-std::array<float,2>{0.620015979f, 0.120046213f},
-std::array<float,2>{0.342862636f, 0.644083858f},
-std::array<float,2>{0.641765058f, 0.537280381f},
-std::array<float,2>{0.477271527f, 0.155864209f},
-std::array<float,2>{0.940214813f, 0.398345143f},
-std::array<float,2>{0.0644269958f, 0.995409191f},
-std::array<float,2>{0.797519505f, 0.571968555f},
-std::array<float,2>{0.173295364f, 0.203359738f},
-std::array<float,2>{0.520561278f, 0.475594819f},
-std::array<float,2>{0.300124079f, 0.911475778f},
-std::array<float,2>{0.717569232f, 0.823535204f},
-std::array<float,2>{0.399900049f, 0.326663107f},
-std::array<float,2>{0.888277054f, 0.028153602f},
-std::array<float,2>{0.0351446606f, 0.717478156f},
-std::array<float,2>{0.989841461f, 0.944170535f},
-std::array<float,2>{0.124778822f, 0.40948084f},
-std::array<float,2>{0.663963139f, 0.174648881f},
-std::array<float,2>{0.464273393f, 0.51334089f},
-std::array<float,2>{0.581785738f, 0.676203072f},
-std::array<float,2>{0.365960389f, 0.0884386525f},
-std::array<float,2>{0.85998714f, 0.306596935f},
-std::array<float,2>{0.244953603f, 0.753052473f},
-std::array<float,2>{0.794783354f, 0.68371278f},
-std::array<float,2>{0.156280428f, 0.0834036022f},
-std::array<float,2>{0.501663983f, 0.297525227f},
-std::array<float,2>{0.288516581f, 0.759248435f},
-std::array<float,2>{0.699180305f, 0.950997472f},
-std::array<float,2>{0.390036285f, 0.414494753f},
-std::array<float,2>{0.902617753f, 0.183231175f},
-std::array<float,2>{0.0588651337f, 0.504384518f},
-std::array<float,2>{0.983186364f, 0.819120586f},
-std::array<float,2>{0.106887132f, 0.319334567f},
-std::array<float,2>{0.679487169f, 0.022861097f},
-std::array<float,2>{0.438167781f, 0.7096228f},
-std::array<float,2>{0.569396913f, 0.565270483f},
-std::array<float,2>{0.358776987f, 0.213202536f},
-std::array<float,2>{0.850608289f, 0.483667791f},
-std::array<float,2>{0.233548686f, 0.916620791f},
-std::array<float,2>{0.927402258f, 0.541075349f},
-std::array<float,2>{0.016663529f, 0.145175427f},
-std::array<float,2>{0.729850531f, 0.398702621f},
-std::array<float,2>{0.411003917f, 0.987649679f},
-std::array<float,2>{0.561891794f, 0.807620347f},
-std::array<float,2>{0.277254939f, 0.253913313f},
-std::array<float,2>{0.754662633f, 0.109461442f},
-std::array<float,2>{0.145284802f, 0.649723291f},
-std::array<float,2>{0.825725555f, 0.883854568f},
-std::array<float,2>{0.212124392f, 0.437733114f},
-std::array<float,2>{0.605276585f, 0.247046486f},
-std::array<float,2>{0.322541565f, 0.620760798f},
-std::array<float,2>{0.637627244f, 0.726374567f},
-std::array<float,2>{0.497218281f, 0.0446551852f},
-std::array<float,2>{0.957729101f, 0.359890968f},
-std::array<float,2>{0.0933250636f, 0.874123335f},
-std::array<float,2>{0.94192934f, 0.701262891f},
-std::array<float,2>{0.0699952096f, 0.0104666194f},
-std::array<float,2>{0.646243513f, 0.335146159f},
-std::array<float,2>{0.483326912f, 0.842086852f},
-std::array<float,2>{0.622832716f, 0.933352888f},
-std::array<float,2>{0.33672145f, 0.48481822f},
-std::array<float,2>{0.834409356f, 0.188177571f},
-std::array<float,2>{0.200908482f, 0.589062512f},
-std::array<float,2>{0.774588466f, 0.778311431f},
-std::array<float,2>{0.128456593f, 0.292551845f},
-std::array<float,2>{0.539998353f, 0.0679345578f},
-std::array<float,2>{0.262805343f, 0.663775384f},
-std::array<float,2>{0.742650688f, 0.530190766f},
-std::array<float,2>{0.434972942f, 0.156695575f},
-std::array<float,2>{0.920800209f, 0.435674042f},
-std::array<float,2>{0.0136885084f, 0.957257032f},
-std::array<float,2>{0.866470754f, 0.596797764f},
-std::array<float,2>{0.24749805f, 0.227126688f},
-std::array<float,2>{0.58527565f, 0.456122071f},
-std::array<float,2>{0.362276226f, 0.903892756f},
-std::array<float,2>{0.659729898f, 0.854885638f},
-std::array<float,2>{0.464931518f, 0.351548344f},
-std::array<float,2>{0.986020148f, 0.0489201546f},
-std::array<float,2>{0.120157279f, 0.741430402f},
-std::array<float,2>{0.88531357f, 0.977192104f},
-std::array<float,2>{0.0373290665f, 0.379731923f},
-std::array<float,2>{0.712209463f, 0.126364902f},
-std::array<float,2>{0.404425323f, 0.557792485f},
-std::array<float,2>{0.517397642f, 0.634733915f},
-std::array<float,2>{0.302150488f, 0.101080783f},
-std::array<float,2>{0.802372754f, 0.272770703f},
-std::array<float,2>{0.177985042f, 0.787531257f},
-std::array<float,2>{0.843167782f, 0.745277226f},
-std::array<float,2>{0.188181013f, 0.0550271124f},
-std::array<float,2>{0.614408553f, 0.353828102f},
-std::array<float,2>{0.331315488f, 0.849571407f},
-std::array<float,2>{0.650948167f, 0.894889653f},
-std::array<float,2>{0.473785877f, 0.465962261f},
-std::array<float,2>{0.951503515f, 0.222563252f},
-std::array<float,2>{0.0751423761f, 0.604874432f},
-std::array<float,2>{0.91257894f, 0.794354498f},
-std::array<float,2>{0.00393730495f, 0.276612967f},
-std::array<float,2>{0.734460175f, 0.108673662f},
-std::array<float,2>{0.424528718f, 0.631727099f},
-std::array<float,2>{0.537247777f, 0.55002594f},
-std::array<float,2>{0.256759942f, 0.136451706f},
-std::array<float,2>{0.767361403f, 0.388408542f},
-std::array<float,2>{0.138667554f, 0.97111249f},
-std::array<float,2>{0.993326485f, 0.579614103f},
-std::array<float,2>{0.116107322f, 0.20119755f},
-std::array<float,2>{0.670204639f, 0.496326089f},
-std::array<float,2>{0.456095457f, 0.929294825f},
-std::array<float,2>{0.589195549f, 0.830037415f},
-std::array<float,2>{0.373884529f, 0.342467606f},
-std::array<float,2>{0.867992342f, 0.00721092941f},
-std::array<float,2>{0.2373171f, 0.690324605f},
-std::array<float,2>{0.811592877f, 0.963475108f},
-std::array<float,2>{0.180256978f, 0.423186392f},
-std::array<float,2>{0.526269197f, 0.167167664f},
-std::array<float,2>{0.311489671f, 0.522408545f},
-std::array<float,2>{0.708177209f, 0.667377591f},
-std::array<float,2>{0.392970949f, 0.0766470209f},
-std::array<float,2>{0.882746756f, 0.28825894f},
-std::array<float,2>{0.043982558f, 0.770471573f},
-std::array<float,2>{0.891651392f, 0.645760417f},
-std::array<float,2>{0.0498020649f, 0.122544341f},
-std::array<float,2>{0.690548599f, 0.263436824f},
-std::array<float,2>{0.378249705f, 0.799463391f},
-std::array<float,2>{0.509164512f, 0.998353481f},
-std::array<float,2>{0.296408564f, 0.3931472f},
-std::array<float,2>{0.785856605f, 0.149156809f},
-std::array<float,2>{0.17066595f, 0.533350825f},
-std::array<float,2>{0.853544414f, 0.860022902f},
-std::array<float,2>{0.225717008f, 0.372705013f},
-std::array<float,2>{0.571887553f, 0.0381085128f},
-std::array<float,2>{0.349827051f, 0.731238663f},
-std::array<float,2>{0.685431242f, 0.613889635f},
-std::array<float,2>{0.451440781f, 0.240707561f},
-std::array<float,2>{0.972318351f, 0.446199954f},
-std::array<float,2>{0.0986804739f, 0.875844359f},
-std::array<float,2>{0.760884821f, 0.509201586f},
-std::array<float,2>{0.149121642f, 0.178539976f},
-std::array<float,2>{0.546954691f, 0.41180709f},
-std::array<float,2>{0.269244045f, 0.939789653f},
-std::array<float,2>{0.719907939f, 0.754625916f},
-std::array<float,2>{0.421623111f, 0.312118351f},
-std::array<float,2>{0.934322715f, 0.0923202857f},
-std::array<float,2>{0.0304144528f, 0.673829854f},
-std::array<float,2>{0.962330043f, 0.907596529f},
-std::array<float,2>{0.0810065866f, 0.470050216f},
-std::array<float,2>{0.632356226f, 0.209988222f},
-std::array<float,2>{0.491946191f, 0.576149344f},
-std::array<float,2>{0.598120987f, 0.71243608f},
-std::array<float,2>{0.315759182f, 0.027306078f},
-std::array<float,2>{0.81521821f, 0.321832955f},
-std::array<float,2>{0.207703754f, 0.826362193f},
-std::array<float,2>{0.76234436f, 0.735285103f},
-std::array<float,2>{0.156110734f, 0.053549204f},
-std::array<float,2>{0.553802311f, 0.344732672f},
-std::array<float,2>{0.270834029f, 0.858741522f},
-std::array<float,2>{0.726348877f, 0.900372088f},
-std::array<float,2>{0.415990233f, 0.458610386f},
-std::array<float,2>{0.933476269f, 0.232399374f},
-std::array<float,2>{0.0263581071f, 0.598377764f},
-std::array<float,2>{0.965970278f, 0.781432927f},
-std::array<float,2>{0.0831553042f, 0.268935621f},
-std::array<float,2>{0.627165496f, 0.0946263373f},
-std::array<float,2>{0.487356991f, 0.637976944f},
-std::array<float,2>{0.597560167f, 0.562318385f},
-std::array<float,2>{0.317898631f, 0.131353468f},
-std::array<float,2>{0.818808019f, 0.375882149f},
-std::array<float,2>{0.204899684f, 0.980918109f},
-std::array<float,2>{0.896302402f, 0.593037963f},
-std::array<float,2>{0.0543800034f, 0.19260481f},
-std::array<float,2>{0.694523215f, 0.489233285f},
-std::array<float,2>{0.379504174f, 0.935303867f},
-std::array<float,2>{0.514989972f, 0.83795321f},
-std::array<float,2>{0.291447937f, 0.33156091f},
-std::array<float,2>{0.783766329f, 0.0154647073f},
-std::array<float,2>{0.164342418f, 0.695967317f},
-std::array<float,2>{0.858231843f, 0.956530452f},
-std::array<float,2>{0.220680609f, 0.432164371f},
-std::array<float,2>{0.577720463f, 0.160568163f},
-std::array<float,2>{0.344948858f, 0.527242899f},
-std::array<float,2>{0.680081427f, 0.657158852f},
-std::array<float,2>{0.448464185f, 0.0657273978f},
-std::array<float,2>{0.974289894f, 0.29576084f},
-std::array<float,2>{0.0971232206f, 0.774822116f},
-std::array<float,2>{0.998531163f, 0.653114974f},
-std::array<float,2>{0.110685281f, 0.115669109f},
-std::array<float,2>{0.666110337f, 0.25070864f},
-std::array<float,2>{0.458164334f, 0.812473834f},
-std::array<float,2>{0.59295243f, 0.990917504f},
-std::array<float,2>{0.370147079f, 0.405432492f},
-std::array<float,2>{0.873500764f, 0.144376591f},
-std::array<float,2>{0.239783704f, 0.546663463f},
-std::array<float,2>{0.806454182f, 0.868567467f},
-std::array<float,2>{0.187312856f, 0.363466829f},
-std::array<float,2>{0.529194891f, 0.0414876975f},
-std::array<float,2>{0.307643265f, 0.721797407f},
-std::array<float,2>{0.703350365f, 0.624676228f},
-std::array<float,2>{0.3971968f, 0.243165106f},
-std::array<float,2>{0.878133237f, 0.445290834f},
-std::array<float,2>{0.0396928079f, 0.888569713f},
-std::array<float,2>{0.839547813f, 0.503156364f},
-std::array<float,2>{0.192325816f, 0.184852853f},
-std::array<float,2>{0.610222697f, 0.42073822f},
-std::array<float,2>{0.334944963f, 0.948263526f},
-std::array<float,2>{0.654575288f, 0.761789739f},
-std::array<float,2>{0.469385833f, 0.304329038f},
-std::array<float,2>{0.945600629f, 0.0803097934f},
-std::array<float,2>{0.0711829737f, 0.68343246f},
-std::array<float,2>{0.910004616f, 0.919458628f},
-std::array<float,2>{0.00258308859f, 0.477159649f},
-std::array<float,2>{0.741224587f, 0.216422826f},
-std::array<float,2>{0.427361816f, 0.569341362f},
-std::array<float,2>{0.531627536f, 0.705220342f},
-std::array<float,2>{0.252486318f, 0.0186694749f},
-std::array<float,2>{0.772666872f, 0.31498912f},
-std::array<float,2>{0.133070901f, 0.813987255f},
-std::array<float,2>{0.860897779f, 0.678559363f},
-std::array<float,2>{0.245758578f, 0.0872922987f},
-std::array<float,2>{0.580248237f, 0.307260931f},
-std::array<float,2>{0.366470784f, 0.751800895f},
-std::array<float,2>{0.662826777f, 0.943068981f},
-std::array<float,2>{0.463259906f, 0.407070071f},
-std::array<float,2>{0.988809943f, 0.172170565f},
-std::array<float,2>{0.123253025f, 0.514560461f},
-std::array<float,2>{0.887311399f, 0.820338607f},
-std::array<float,2>{0.0335857756f, 0.325682849f},
-std::array<float,2>{0.718032181f, 0.0302857347f},
-std::array<float,2>{0.399344951f, 0.716406226f},
-std::array<float,2>{0.519903719f, 0.572681785f},
-std::array<float,2>{0.29905358f, 0.206911415f},
-std::array<float,2>{0.798075736f, 0.474443704f},
-std::array<float,2>{0.171946645f, 0.9132815f},
-std::array<float,2>{0.940545321f, 0.536400676f},
-std::array<float,2>{0.0631434321f, 0.153171718f},
-std::array<float,2>{0.641539872f, 0.395866007f},
-std::array<float,2>{0.477724999f, 0.992854297f},
-std::array<float,2>{0.620534718f, 0.802035153f},
-std::array<float,2>{0.342687488f, 0.258551389f},
-std::array<float,2>{0.828387678f, 0.119046785f},
-std::array<float,2>{0.197963402f, 0.641626954f},
-std::array<float,2>{0.78115654f, 0.882390022f},
-std::array<float,2>{0.129395187f, 0.452898145f},
-std::array<float,2>{0.546421289f, 0.236140668f},
-std::array<float,2>{0.259223759f, 0.613071382f},
-std::array<float,2>{0.749230981f, 0.729262233f},
-std::array<float,2>{0.430257767f, 0.0350867398f},
-std::array<float,2>{0.915922463f, 0.370850891f},
-std::array<float,2>{0.00993406773f, 0.864773095f},
-std::array<float,2>{0.924394786f, 0.694950044f},
-std::array<float,2>{0.019672554f, 0.0010211051f},
-std::array<float,2>{0.73150593f, 0.338278472f},
-std::array<float,2>{0.408053607f, 0.834162652f},
-std::array<float,2>{0.558275342f, 0.923567891f},
-std::array<float,2>{0.279064476f, 0.492211282f},
-std::array<float,2>{0.753638625f, 0.199019656f},
-std::array<float,2>{0.142460093f, 0.58450222f},
-std::array<float,2>{0.820720613f, 0.766706824f},
-std::array<float,2>{0.215664193f, 0.283581913f},
-std::array<float,2>{0.608356237f, 0.0708044395f},
-std::array<float,2>{0.325624019f, 0.671600401f},
-std::array<float,2>{0.636529386f, 0.519453943f},
-std::array<float,2>{0.493997097f, 0.171745047f},
-std::array<float,2>{0.957027972f, 0.426543742f},
-std::array<float,2>{0.0884068385f, 0.966661453f},
-std::array<float,2>{0.792823136f, 0.609055996f},
-std::array<float,2>{0.163830787f, 0.223547906f},
-std::array<float,2>{0.507600904f, 0.46461603f},
-std::array<float,2>{0.284673899f, 0.894063592f},
-std::array<float,2>{0.702027023f, 0.846014619f},
-std::array<float,2>{0.383832604f, 0.358265191f},
-std::array<float,2>{0.901353002f, 0.0604249239f},
-std::array<float,2>{0.0579678603f, 0.749102354f},
-std::array<float,2>{0.978861153f, 0.974176705f},
-std::array<float,2>{0.102229379f, 0.384363264f},
-std::array<float,2>{0.672321618f, 0.139682174f},
-std::array<float,2>{0.445119113f, 0.551343024f},
-std::array<float,2>{0.564162254f, 0.626250803f},
-std::array<float,2>{0.352193236f, 0.103773773f},
-std::array<float,2>{0.846083105f, 0.280871809f},
-std::array<float,2>{0.229145393f, 0.791093528f},
-std::array<float,2>{0.801036477f, 0.634931147f},
-std::array<float,2>{0.179351464f, 0.0979724228f},
-std::array<float,2>{0.516096354f, 0.269964218f},
-std::array<float,2>{0.301397562f, 0.785685956f},
-std::array<float,2>{0.711463153f, 0.980165422f},
-std::array<float,2>{0.405510128f, 0.382084578f},
-std::array<float,2>{0.886613846f, 0.127569377f},
-std::array<float,2>{0.0385926701f, 0.555069923f},
-std::array<float,2>{0.984828293f, 0.85296607f},
-std::array<float,2>{0.119490005f, 0.349543333f},
-std::array<float,2>{0.658453107f, 0.0484937318f},
-std::array<float,2>{0.466794759f, 0.738591433f},
-std::array<float,2>{0.584854364f, 0.595672727f},
-std::array<float,2>{0.362913966f, 0.229768068f},
-std::array<float,2>{0.865657628f, 0.453201145f},
-std::array<float,2>{0.246782973f, 0.90449512f},
-std::array<float,2>{0.92161572f, 0.528256297f},
-std::array<float,2>{0.0154314321f, 0.159501702f},
-std::array<float,2>{0.743266344f, 0.434396327f},
-std::array<float,2>{0.434185207f, 0.960285008f},
-std::array<float,2>{0.540381551f, 0.779862583f},
-std::array<float,2>{0.262041479f, 0.289625227f},
-std::array<float,2>{0.773947418f, 0.0687319338f},
-std::array<float,2>{0.127023995f, 0.660204768f},
-std::array<float,2>{0.835845411f, 0.930893838f},
-std::array<float,2>{0.199264482f, 0.486805916f},
-std::array<float,2>{0.62152034f, 0.190187007f},
-std::array<float,2>{0.337732255f, 0.586921751f},
-std::array<float,2>{0.645100176f, 0.700533628f},
-std::array<float,2>{0.484187812f, 0.00890464708f},
-std::array<float,2>{0.943210721f, 0.332546085f},
-std::array<float,2>{0.0691911355f, 0.840553105f},
-std::array<float,2>{0.958555639f, 0.724536359f},
-std::array<float,2>{0.0921078026f, 0.0453733057f},
-std::array<float,2>{0.638388634f, 0.363140494f},
-std::array<float,2>{0.496608794f, 0.871823251f},
-std::array<float,2>{0.603767931f, 0.884951651f},
-std::array<float,2>{0.323434532f, 0.440879166f},
-std::array<float,2>{0.824506521f, 0.248534128f},
-std::array<float,2>{0.211184189f, 0.618210316f},
-std::array<float,2>{0.75581193f, 0.80610013f},
-std::array<float,2>{0.145990968f, 0.257691443f},
-std::array<float,2>{0.56096071f, 0.111703277f},
-std::array<float,2>{0.275556237f, 0.652157247f},
-std::array<float,2>{0.729357004f, 0.539705634f},
-std::array<float,2>{0.411956608f, 0.14767839f},
-std::array<float,2>{0.926666558f, 0.401166409f},
-std::array<float,2>{0.0161039699f, 0.984771013f},
-std::array<float,2>{0.849958837f, 0.563797712f},
-std::array<float,2>{0.233344942f, 0.211441219f},
-std::array<float,2>{0.568696499f, 0.481032729f},
-std::array<float,2>{0.357493877f, 0.9148103f},
-std::array<float,2>{0.678308189f, 0.818036318f},
-std::array<float,2>{0.438861519f, 0.318295538f},
-std::array<float,2>{0.983644724f, 0.020815134f},
-std::array<float,2>{0.105773665f, 0.708303928f},
-std::array<float,2>{0.90362823f, 0.952559352f},
-std::array<float,2>{0.0597579777f, 0.41666466f},
-std::array<float,2>{0.697631359f, 0.181148544f},
-std::array<float,2>{0.389541775f, 0.507347703f},
-std::array<float,2>{0.50025022f, 0.686477423f},
-std::array<float,2>{0.287738949f, 0.0841092542f},
-std::array<float,2>{0.793739498f, 0.299143493f},
-std::array<float,2>{0.158137918f, 0.761051595f},
-std::array<float,2>{0.81552875f, 0.713137686f},
-std::array<float,2>{0.208303839f, 0.0246667136f},
-std::array<float,2>{0.598715782f, 0.323988408f},
-std::array<float,2>{0.315060675f, 0.825432837f},
-std::array<float,2>{0.63180995f, 0.910085618f},
-std::array<float,2>{0.491209269f, 0.471811712f},
-std::array<float,2>{0.961833954f, 0.208497688f},
-std::array<float,2>{0.0810943171f, 0.576651096f},
-std::array<float,2>{0.935060799f, 0.757530391f},
-std::array<float,2>{0.0300800763f, 0.30980134f},
-std::array<float,2>{0.718997419f, 0.0906971022f},
-std::array<float,2>{0.420858711f, 0.672048032f},
-std::array<float,2>{0.548514724f, 0.51168102f},
-std::array<float,2>{0.267996997f, 0.177712649f},
-std::array<float,2>{0.760588348f, 0.4131791f},
-std::array<float,2>{0.149901032f, 0.937700272f},
-std::array<float,2>{0.971424162f, 0.616826117f},
-std::array<float,2>{0.0983827636f, 0.238419831f},
-std::array<float,2>{0.68415463f, 0.447990239f},
-std::array<float,2>{0.452351958f, 0.877779484f},
-std::array<float,2>{0.570380449f, 0.862176359f},
-std::array<float,2>{0.350779921f, 0.374886543f},
-std::array<float,2>{0.855222166f, 0.0365635417f},
-std::array<float,2>{0.225322112f, 0.733276546f},
-std::array<float,2>{0.786794066f, 0.997716665f},
-std::array<float,2>{0.17180568f, 0.392395437f},
-std::array<float,2>{0.508038759f, 0.150672585f},
-std::array<float,2>{0.295470119f, 0.532464743f},
-std::array<float,2>{0.690098822f, 0.647961855f},
-std::array<float,2>{0.377252817f, 0.124043964f},
-std::array<float,2>{0.890831947f, 0.265112311f},
-std::array<float,2>{0.0503787547f, 0.798677027f},
-std::array<float,2>{0.881038666f, 0.664958894f},
-std::array<float,2>{0.0433006138f, 0.0755265728f},
-std::array<float,2>{0.707988441f, 0.287071615f},
-std::array<float,2>{0.394431651f, 0.773414433f},
-std::array<float,2>{0.526374638f, 0.962297261f},
-std::array<float,2>{0.31204775f, 0.424993277f},
-std::array<float,2>{0.810793817f, 0.164098486f},
-std::array<float,2>{0.181027099f, 0.51962018f},
-std::array<float,2>{0.868241012f, 0.830269158f},
-std::array<float,2>{0.237171605f, 0.340027243f},
-std::array<float,2>{0.587942243f, 0.00438988954f},
-std::array<float,2>{0.374141425f, 0.688278496f},
-std::array<float,2>{0.670989394f, 0.581022441f},
-std::array<float,2>{0.455891788f, 0.201163799f},
-std::array<float,2>{0.9931041f, 0.498931944f},
-std::array<float,2>{0.117175467f, 0.926532924f},
-std::array<float,2>{0.76656419f, 0.54849112f},
-std::array<float,2>{0.137249097f, 0.133598119f},
-std::array<float,2>{0.538299441f, 0.388759673f},
-std::array<float,2>{0.257474959f, 0.969146788f},
-std::array<float,2>{0.735628426f, 0.796728432f},
-std::array<float,2>{0.425196975f, 0.273602366f},
-std::array<float,2>{0.913851619f, 0.107251465f},
-std::array<float,2>{0.00501166191f, 0.629364431f},
-std::array<float,2>{0.952905834f, 0.896554768f},
-std::array<float,2>{0.075759083f, 0.467870325f},
-std::array<float,2>{0.651551485f, 0.218916446f},
-std::array<float,2>{0.47335577f, 0.602714121f},
-std::array<float,2>{0.613808393f, 0.742603302f},
-std::array<float,2>{0.33103466f, 0.0584313124f},
-std::array<float,2>{0.842302024f, 0.351611108f},
-std::array<float,2>{0.189126536f, 0.850179493f},
-std::array<float,2>{0.782410383f, 0.698322773f},
-std::array<float,2>{0.167735696f, 0.0125103388f},
-std::array<float,2>{0.511904418f, 0.328544587f},
-std::array<float,2>{0.290624768f, 0.836818755f},
-std::array<float,2>{0.692152917f, 0.935597301f},
-std::array<float,2>{0.381137639f, 0.49061814f},
-std::array<float,2>{0.897428989f, 0.195054352f},
-std::array<float,2>{0.0517045222f, 0.590437651f},
-std::array<float,2>{0.974991024f, 0.776781201f},
-std::array<float,2>{0.0948262066f, 0.294882596f},
-std::array<float,2>{0.683179796f, 0.0627120882f},
-std::array<float,2>{0.445366919f, 0.659193277f},
-std::array<float,2>{0.574698687f, 0.52448523f},
-std::array<float,2>{0.346932977f, 0.162972391f},
-std::array<float,2>{0.856947184f, 0.430660278f},
-std::array<float,2>{0.222257972f, 0.953779876f},
-std::array<float,2>{0.930084109f, 0.60016048f},
-std::array<float,2>{0.0238618981f, 0.232619226f},
-std::array<float,2>{0.724141836f, 0.45968917f},
-std::array<float,2>{0.416209757f, 0.901592851f},
-std::array<float,2>{0.552136719f, 0.857120275f},
-std::array<float,2>{0.272601724f, 0.347034544f},
-std::array<float,2>{0.765032351f, 0.050853543f},
-std::array<float,2>{0.152561814f, 0.73734647f},
-std::array<float,2>{0.818322003f, 0.984083772f},
-std::array<float,2>{0.205529854f, 0.378597975f},
-std::array<float,2>{0.594593585f, 0.129298285f},
-std::array<float,2>{0.318739206f, 0.560300469f},
-std::array<float,2>{0.626675904f, 0.638908327f},
-std::array<float,2>{0.484460205f, 0.0959136486f},
-std::array<float,2>{0.968341053f, 0.267452955f},
-std::array<float,2>{0.0839949772f, 0.783681512f},
-std::array<float,2>{0.948116243f, 0.681111872f},
-std::array<float,2>{0.0733782798f, 0.0799577013f},
-std::array<float,2>{0.653437853f, 0.302231401f},
-std::array<float,2>{0.472468615f, 0.765166163f},
-std::array<float,2>{0.613122702f, 0.947067022f},
-std::array<float,2>{0.33229062f, 0.418902218f},
-std::array<float,2>{0.836191058f, 0.185713917f},
-std::array<float,2>{0.193635643f, 0.500629723f},
-std::array<float,2>{0.770193875f, 0.815562248f},
-std::array<float,2>{0.13640824f, 0.313758641f},
-std::array<float,2>{0.533491373f, 0.0158750396f},
-std::array<float,2>{0.251417607f, 0.704619944f},
-std::array<float,2>{0.73905915f, 0.567867994f},
-std::array<float,2>{0.42832166f, 0.218554124f},
-std::array<float,2>{0.908011496f, 0.479511857f},
-std::array<float,2>{0.00149182323f, 0.921743214f},
-std::array<float,2>{0.871692777f, 0.543828964f},
-std::array<float,2>{0.241371885f, 0.14084661f},
-std::array<float,2>{0.591426611f, 0.402772337f},
-std::array<float,2>{0.367267221f, 0.988489449f},
-std::array<float,2>{0.665157437f, 0.808722615f},
-std::array<float,2>{0.459077209f, 0.252237678f},
-std::array<float,2>{0.996862531f, 0.114469796f},
-std::array<float,2>{0.111970283f, 0.65505439f},
-std::array<float,2>{0.876729667f, 0.889522851f},
-std::array<float,2>{0.0415470153f, 0.44276166f},
-std::array<float,2>{0.705144703f, 0.245185912f},
-std::array<float,2>{0.395519167f, 0.621254623f},
-std::array<float,2>{0.531196177f, 0.720642567f},
-std::array<float,2>{0.30514276f, 0.0403379947f},
-std::array<float,2>{0.80712527f, 0.3658351f},
-std::array<float,2>{0.184462607f, 0.869913578f},
-std::array<float,2>{0.831393301f, 0.643075228f},
-std::array<float,2>{0.195386842f, 0.120248795f},
-std::array<float,2>{0.619022608f, 0.260176092f},
-std::array<float,2>{0.341417193f, 0.804444432f},
-std::array<float,2>{0.643893778f, 0.994872689f},
-std::array<float,2>{0.478791952f, 0.396618485f},
-std::array<float,2>{0.938469231f, 0.155225769f},
-std::array<float,2>{0.0650419891f, 0.53863585f},
-std::array<float,2>{0.916761339f, 0.866402686f},
-std::array<float,2>{0.00860423036f, 0.368859977f},
-std::array<float,2>{0.747736275f, 0.0326932743f},
-std::array<float,2>{0.433129847f, 0.727114737f},
-std::array<float,2>{0.54455775f, 0.610754013f},
-std::array<float,2>{0.259896934f, 0.238087192f},
-std::array<float,2>{0.77845037f, 0.45076713f},
-std::array<float,2>{0.131672159f, 0.879392326f},
-std::array<float,2>{0.990527213f, 0.512506783f},
-std::array<float,2>{0.122379892f, 0.175591215f},
-std::array<float,2>{0.660793066f, 0.408983171f},
-std::array<float,2>{0.461762995f, 0.944651961f},
-std::array<float,2>{0.578315973f, 0.752533615f},
-std::array<float,2>{0.365162462f, 0.305534601f},
-std::array<float,2>{0.862774193f, 0.0889222473f},
-std::array<float,2>{0.24317421f, 0.677178204f},
-std::array<float,2>{0.800474405f, 0.91016078f},
-std::array<float,2>{0.174478367f, 0.475049525f},
-std::array<float,2>{0.522972524f, 0.204722971f},
-std::array<float,2>{0.297001719f, 0.570628047f},
-std::array<float,2>{0.715445101f, 0.717874229f},
-std::array<float,2>{0.401007533f, 0.0286914725f},
-std::array<float,2>{0.889359057f, 0.327733815f},
-std::array<float,2>{0.0314737f, 0.823153257f},
-std::array<float,2>{0.898490667f, 0.746262312f},
-std::array<float,2>{0.0561762564f, 0.0614164546f},
-std::array<float,2>{0.70095557f, 0.356607884f},
-std::array<float,2>{0.384891242f, 0.844987988f},
-std::array<float,2>{0.50549382f, 0.892333448f},
-std::array<float,2>{0.281557113f, 0.461419731f},
-std::array<float,2>{0.790969372f, 0.225086391f},
-std::array<float,2>{0.161325872f, 0.606871486f},
-std::array<float,2>{0.845661581f, 0.790212691f},
-std::array<float,2>{0.22828868f, 0.278594911f},
-std::array<float,2>{0.564983189f, 0.103323057f},
-std::array<float,2>{0.353555173f, 0.628342628f},
-std::array<float,2>{0.674881101f, 0.552779973f},
-std::array<float,2>{0.441940516f, 0.137930915f},
-std::array<float,2>{0.976979256f, 0.385710537f},
-std::array<float,2>{0.104945578f, 0.975584388f},
-std::array<float,2>{0.751767457f, 0.582974136f},
-std::array<float,2>{0.143185034f, 0.196426749f},
-std::array<float,2>{0.555865049f, 0.494820088f},
-std::array<float,2>{0.279359549f, 0.925156713f},
-std::array<float,2>{0.733924687f, 0.833070278f},
-std::array<float,2>{0.40867281f, 0.336687386f},
-std::array<float,2>{0.922614336f, 0.00202880171f},
-std::array<float,2>{0.0233165119f, 0.692508638f},
-std::array<float,2>{0.954437077f, 0.967559814f},
-std::array<float,2>{0.0862965062f, 0.428481042f},
-std::array<float,2>{0.634747446f, 0.168342531f},
-std::array<float,2>{0.495358288f, 0.515900016f},
-std::array<float,2>{0.60680896f, 0.669917762f},
-std::array<float,2>{0.326187015f, 0.0734110847f},
-std::array<float,2>{0.822588086f, 0.282386631f},
-std::array<float,2>{0.216944575f, 0.768751979f},
-std::array<float,2>{0.775491536f, 0.662763655f},
-std::array<float,2>{0.12541151f, 0.0669073835f},
-std::array<float,2>{0.542196512f, 0.29107818f},
-std::array<float,2>{0.265337467f, 0.779129803f},
-std::array<float,2>{0.745254397f, 0.958581865f},
-std::array<float,2>{0.436787128f, 0.436861753f},
-std::array<float,2>{0.918841124f, 0.157435805f},
-std::array<float,2>{0.0134413112f, 0.531026542f},
-std::array<float,2>{0.945037365f, 0.843167663f},
-std::array<float,2>{0.067794174f, 0.334804535f},
-std::array<float,2>{0.646489978f, 0.0114256414f},
-std::array<float,2>{0.480953127f, 0.703057766f},
-std::array<float,2>{0.624862254f, 0.588690341f},
-std::array<float,2>{0.338473588f, 0.188918591f},
-std::array<float,2>{0.833811581f, 0.486103833f},
-std::array<float,2>{0.203107849f, 0.932179272f},
-std::array<float,2>{0.882999539f, 0.557487786f},
-std::array<float,2>{0.0361850038f, 0.125298232f},
-std::array<float,2>{0.713400006f, 0.380002409f},
-std::array<float,2>{0.403137267f, 0.977667212f},
-std::array<float,2>{0.517861545f, 0.788750648f},
-std::array<float,2>{0.302867323f, 0.272360176f},
-std::array<float,2>{0.804514945f, 0.100096539f},
-std::array<float,2>{0.176290497f, 0.632911146f},
-std::array<float,2>{0.864949703f, 0.902584612f},
-std::array<float,2>{0.248453006f, 0.455249757f},
-std::array<float,2>{0.582723081f, 0.227628157f},
-std::array<float,2>{0.360045016f, 0.596605957f},
-std::array<float,2>{0.657794833f, 0.740693629f},
-std::array<float,2>{0.468382537f, 0.0503018796f},
-std::array<float,2>{0.987139821f, 0.349641234f},
-std::array<float,2>{0.11868339f, 0.853767991f},
-std::array<float,2>{0.981907368f, 0.710506856f},
-std::array<float,2>{0.108820669f, 0.0215989742f},
-std::array<float,2>{0.67770052f, 0.31952849f},
-std::array<float,2>{0.439572394f, 0.81981194f},
-std::array<float,2>{0.567446232f, 0.917772889f},
-std::array<float,2>{0.356712788f, 0.482518762f},
-std::array<float,2>{0.8488397f, 0.214208558f},
-std::array<float,2>{0.231900156f, 0.566018522f},
-std::array<float,2>{0.796455085f, 0.758666635f},
-std::array<float,2>{0.158288479f, 0.298225313f},
-std::array<float,2>{0.503603399f, 0.0826798901f},
-std::array<float,2>{0.28617242f, 0.684881032f},
-std::array<float,2>{0.697035611f, 0.505312204f},
-std::array<float,2>{0.386730134f, 0.181975588f},
-std::array<float,2>{0.905174136f, 0.415876001f},
-std::array<float,2>{0.0605477095f, 0.95010221f},
-std::array<float,2>{0.826798856f, 0.619489193f},
-std::array<float,2>{0.213172436f, 0.247392058f},
-std::array<float,2>{0.602014482f, 0.438487053f},
-std::array<float,2>{0.321422756f, 0.883171618f},
-std::array<float,2>{0.640022755f, 0.873051107f},
-std::array<float,2>{0.499203533f, 0.360511869f},
-std::array<float,2>{0.960921288f, 0.043450918f},
-std::array<float,2>{0.0905340165f, 0.724852741f},
-std::array<float,2>{0.92950654f, 0.986486793f},
-std::array<float,2>{0.0192867629f, 0.400153607f},
-std::array<float,2>{0.72773701f, 0.14647983f},
-std::array<float,2>{0.413633555f, 0.542032063f},
-std::array<float,2>{0.559446573f, 0.648795366f},
-std::array<float,2>{0.274447024f, 0.111190811f},
-std::array<float,2>{0.756092191f, 0.255598158f},
-std::array<float,2>{0.147944137f, 0.807581425f},
-std::array<float,2>{0.853363514f, 0.731887281f},
-std::array<float,2>{0.224050492f, 0.0374067463f},
-std::array<float,2>{0.572654903f, 0.371227801f},
-std::array<float,2>{0.347871751f, 0.861242771f},
-std::array<float,2>{0.6858024f, 0.876736641f},
-std::array<float,2>{0.450081319f, 0.447173774f},
-std::array<float,2>{0.968767583f, 0.242003664f},
-std::array<float,2>{0.0999308079f, 0.614414752f},
-std::array<float,2>{0.894127905f, 0.800092757f},
-std::array<float,2>{0.0482060872f, 0.261797041f},
-std::array<float,2>{0.688301682f, 0.121287324f},
-std::array<float,2>{0.37606898f, 0.644860804f},
-std::array<float,2>{0.511663079f, 0.535021305f},
-std::array<float,2>{0.294824034f, 0.149730563f},
-std::array<float,2>{0.787875473f, 0.394042701f},
-std::array<float,2>{0.168198571f, 0.99980253f},
-std::array<float,2>{0.963077426f, 0.574275613f},
-std::array<float,2>{0.0799769834f, 0.209336936f},
-std::array<float,2>{0.630572557f, 0.468924791f},
-std::array<float,2>{0.488840729f, 0.90641135f},
-std::array<float,2>{0.600023866f, 0.828037202f},
-std::array<float,2>{0.314214975f, 0.320596457f},
-std::array<float,2>{0.813762903f, 0.0255709458f},
-std::array<float,2>{0.210708052f, 0.711309969f},
-std::array<float,2>{0.759573579f, 0.940483809f},
-std::array<float,2>{0.150865346f, 0.410763711f},
-std::array<float,2>{0.548882306f, 0.179468229f},
-std::array<float,2>{0.265638262f, 0.508717775f},
-std::array<float,2>{0.720859408f, 0.674913406f},
-std::array<float,2>{0.418275356f, 0.0929168612f},
-std::array<float,2>{0.936879337f, 0.31148836f},
-std::array<float,2>{0.02920633f, 0.755540729f},
-std::array<float,2>{0.911394417f, 0.632784247f},
-std::array<float,2>{0.00718312105f, 0.107779123f},
-std::array<float,2>{0.737848461f, 0.275836676f},
-std::array<float,2>{0.422407299f, 0.793483615f},
-std::array<float,2>{0.536119819f, 0.971987247f},
-std::array<float,2>{0.255199999f, 0.387271017f},
-std::array<float,2>{0.76826936f, 0.134939477f},
-std::array<float,2>{0.139260069f, 0.549106419f},
-std::array<float,2>{0.840588331f, 0.848312199f},
-std::array<float,2>{0.189517036f, 0.354768604f},
-std::array<float,2>{0.616164684f, 0.0563244149f},
-std::array<float,2>{0.329918265f, 0.744270623f},
-std::array<float,2>{0.648665845f, 0.603908896f},
-std::array<float,2>{0.476525515f, 0.221009567f},
-std::array<float,2>{0.949447691f, 0.465037286f},
-std::array<float,2>{0.0773893744f, 0.896438897f},
-std::array<float,2>{0.809924304f, 0.523046672f},
-std::array<float,2>{0.182418406f, 0.166536763f},
-std::array<float,2>{0.524282932f, 0.422496557f},
-std::array<float,2>{0.310048312f, 0.964185119f},
-std::array<float,2>{0.710371792f, 0.771186233f},
-std::array<float,2>{0.39157176f, 0.287611514f},
-std::array<float,2>{0.879673183f, 0.0778647438f},
-std::array<float,2>{0.0460251644f, 0.666283667f},
-std::array<float,2>{0.995628059f, 0.927790284f},
-std::array<float,2>{0.113524362f, 0.497734129f},
-std::array<float,2>{0.669428587f, 0.202724025f},
-std::array<float,2>{0.453185111f, 0.578732967f},
-std::array<float,2>{0.587409437f, 0.691204369f},
-std::array<float,2>{0.372187972f, 0.0067047542f},
-std::array<float,2>{0.869645119f, 0.343473941f},
-std::array<float,2>{0.23528643f, 0.828560889f},
-std::array<float,2>{0.790418565f, 0.749749243f},
-std::array<float,2>{0.162023962f, 0.0597702265f},
-std::array<float,2>{0.505090535f, 0.357826889f},
-std::array<float,2>{0.282172531f, 0.846246898f},
-std::array<float,2>{0.700327933f, 0.893917382f},
-std::array<float,2>{0.385542214f, 0.464244902f},
-std::array<float,2>{0.899317801f, 0.222874239f},
-std::array<float,2>{0.0556696914f, 0.608726859f},
-std::array<float,2>{0.977094352f, 0.791988432f},
-std::array<float,2>{0.105062567f, 0.280545354f},
-std::array<float,2>{0.675676227f, 0.104099482f},
-std::array<float,2>{0.441534281f, 0.626932681f},
-std::array<float,2>{0.564714432f, 0.550894499f},
-std::array<float,2>{0.354160637f, 0.140320227f},
-std::array<float,2>{0.845204711f, 0.383861691f},
-std::array<float,2>{0.227612808f, 0.973705053f},
-std::array<float,2>{0.922159791f, 0.584257722f},
-std::array<float,2>{0.0229236297f, 0.198465273f},
-std::array<float,2>{0.733697295f, 0.492789924f},
-std::array<float,2>{0.408708394f, 0.923193157f},
-std::array<float,2>{0.556624055f, 0.834545493f},
-std::array<float,2>{0.279891044f, 0.338558197f},
-std::array<float,2>{0.750981629f, 0.00183134945f},
-std::array<float,2>{0.14283295f, 0.694805443f},
-std::array<float,2>{0.823151946f, 0.965998054f},
-std::array<float,2>{0.217542589f, 0.425886512f},
-std::array<float,2>{0.607322633f, 0.171152204f},
-std::array<float,2>{0.32697928f, 0.51886946f},
-std::array<float,2>{0.634060681f, 0.671140194f},
-std::array<float,2>{0.495744675f, 0.0706659853f},
-std::array<float,2>{0.954979718f, 0.28382802f},
-std::array<float,2>{0.0866855159f, 0.76728636f},
-std::array<float,2>{0.937608123f, 0.642123342f},
-std::array<float,2>{0.0647253245f, 0.118446916f},
-std::array<float,2>{0.644138217f, 0.258019835f},
-std::array<float,2>{0.479229778f, 0.802426696f},
-std::array<float,2>{0.618611872f, 0.99229598f},
-std::array<float,2>{0.341168106f, 0.396238118f},
-std::array<float,2>{0.831703305f, 0.152344599f},
-std::array<float,2>{0.196070999f, 0.536847532f},
-std::array<float,2>{0.779135585f, 0.86471808f},
-std::array<float,2>{0.130876973f, 0.370336801f},
-std::array<float,2>{0.544020176f, 0.0346677713f},
-std::array<float,2>{0.260587633f, 0.728823304f},
-std::array<float,2>{0.747511506f, 0.612359166f},
-std::array<float,2>{0.433066845f, 0.235388637f},
-std::array<float,2>{0.916451335f, 0.452523798f},
-std::array<float,2>{0.007959635f, 0.882243991f},
-std::array<float,2>{0.862996221f, 0.514001906f},
-std::array<float,2>{0.243821383f, 0.172812805f},
-std::array<float,2>{0.579060435f, 0.406724602f},
-std::array<float,2>{0.364659339f, 0.94239068f},
-std::array<float,2>{0.660380363f, 0.751157641f},
-std::array<float,2>{0.461390078f, 0.307016015f},
-std::array<float,2>{0.991082132f, 0.0876401216f},
-std::array<float,2>{0.122623429f, 0.678141654f},
-std::array<float,2>{0.889125168f, 0.913598776f},
-std::array<float,2>{0.032096196f, 0.473708034f},
-std::array<float,2>{0.714986682f, 0.206488684f},
-std::array<float,2>{0.40062207f, 0.572895646f},
-std::array<float,2>{0.522590578f, 0.715967655f},
-std::array<float,2>{0.297507346f, 0.0308132302f},
-std::array<float,2>{0.799868405f, 0.325765789f},
-std::array<float,2>{0.17417796f, 0.821010649f},
-std::array<float,2>{0.836843014f, 0.682664454f},
-std::array<float,2>{0.194292784f, 0.0807006881f},
-std::array<float,2>{0.612324834f, 0.303876132f},
-std::array<float,2>{0.332991153f, 0.762361348f},
-std::array<float,2>{0.654184222f, 0.949015319f},
-std::array<float,2>{0.47171402f, 0.419993043f},
-std::array<float,2>{0.947672665f, 0.185059175f},
-std::array<float,2>{0.0739517063f, 0.503727019f},
-std::array<float,2>{0.907451272f, 0.813486516f},
-std::array<float,2>{0.001080413f, 0.314830571f},
-std::array<float,2>{0.738737345f, 0.0193667002f},
-std::array<float,2>{0.427737832f, 0.705797672f},
-std::array<float,2>{0.533934414f, 0.569924176f},
-std::array<float,2>{0.251660675f, 0.215883493f},
-std::array<float,2>{0.769617558f, 0.476778895f},
-std::array<float,2>{0.1361361f, 0.919048965f},
-std::array<float,2>{0.996560693f, 0.546164691f},
-std::array<float,2>{0.111765362f, 0.143825904f},
-std::array<float,2>{0.665925026f, 0.406071991f},
-std::array<float,2>{0.459924579f, 0.990260184f},
-std::array<float,2>{0.591203809f, 0.81172353f},
-std::array<float,2>{0.367908299f, 0.250020266f},
-std::array<float,2>{0.871204376f, 0.115842953f},
-std::array<float,2>{0.241735116f, 0.652665854f},
-std::array<float,2>{0.807524145f, 0.887739778f},
-std::array<float,2>{0.183711156f, 0.444484502f},
-std::array<float,2>{0.530449331f, 0.243729651f},
-std::array<float,2>{0.305317104f, 0.624451101f},
-std::array<float,2>{0.705585063f, 0.722256184f},
-std::array<float,2>{0.396285564f, 0.0416778177f},
-std::array<float,2>{0.876147985f, 0.363799632f},
-std::array<float,2>{0.0411571562f, 0.868770361f},
-std::array<float,2>{0.896917284f, 0.695504904f},
-std::array<float,2>{0.0508424602f, 0.0148482118f},
-std::array<float,2>{0.691814005f, 0.331139088f},
-std::array<float,2>{0.3816531f, 0.838572621f},
-std::array<float,2>{0.512549341f, 0.934740305f},
-std::array<float,2>{0.290077984f, 0.48867318f},
-std::array<float,2>{0.783125103f, 0.193241462f},
-std::array<float,2>{0.167036027f, 0.593279541f},
-std::array<float,2>{0.856498599f, 0.774929106f},
-std::array<float,2>{0.222054616f, 0.295029998f},
-std::array<float,2>{0.574757576f, 0.0660197064f},
-std::array<float,2>{0.347545624f, 0.656524479f},
-std::array<float,2>{0.68280375f, 0.52674669f},
-std::array<float,2>{0.445998013f, 0.161013916f},
-std::array<float,2>{0.975502372f, 0.431657284f},
-std::array<float,2>{0.0952765718f, 0.95681566f},
-std::array<float,2>{0.765228808f, 0.598011374f},
-std::array<float,2>{0.153035045f, 0.231874377f},
-std::array<float,2>{0.552587569f, 0.458371937f},
-std::array<float,2>{0.273422003f, 0.899702311f},
-std::array<float,2>{0.723861158f, 0.859109282f},
-std::array<float,2>{0.416786045f, 0.345436573f},
-std::array<float,2>{0.930663407f, 0.0528675951f},
-std::array<float,2>{0.0241780542f, 0.73484534f},
-std::array<float,2>{0.967989564f, 0.981041193f},
-std::array<float,2>{0.0848077387f, 0.375476241f},
-std::array<float,2>{0.626386464f, 0.130968496f},
-std::array<float,2>{0.48527348f, 0.561968029f},
-std::array<float,2>{0.593772411f, 0.63838923f},
-std::array<float,2>{0.318885088f, 0.0938621089f},
-std::array<float,2>{0.817712963f, 0.269112557f},
-std::array<float,2>{0.205789462f, 0.781877935f},
-std::array<float,2>{0.767905593f, 0.629572988f},
-std::array<float,2>{0.139001966f, 0.106621429f},
-std::array<float,2>{0.535501719f, 0.274208218f},
-std::array<float,2>{0.255441248f, 0.796190619f},
-std::array<float,2>{0.737770915f, 0.969465792f},
-std::array<float,2>{0.422090799f, 0.389591038f},
-std::array<float,2>{0.911932111f, 0.133005187f},
-std::array<float,2>{0.00762107596f, 0.548114061f},
-std::array<float,2>{0.949928224f, 0.849717617f},
-std::array<float,2>{0.0776378587f, 0.352410525f},
-std::array<float,2>{0.649282515f, 0.0579409897f},
-std::array<float,2>{0.475827098f, 0.743156791f},
-std::array<float,2>{0.615593016f, 0.603267491f},
-std::array<float,2>{0.329340279f, 0.219648883f},
-std::array<float,2>{0.840287328f, 0.468559712f},
-std::array<float,2>{0.190132782f, 0.89704746f},
-std::array<float,2>{0.879035532f, 0.520103216f},
-std::array<float,2>{0.0468428396f, 0.164674774f},
-std::array<float,2>{0.710621595f, 0.425693303f},
-std::array<float,2>{0.390829265f, 0.962714016f},
-std::array<float,2>{0.523460031f, 0.77265799f},
-std::array<float,2>{0.310251474f, 0.286185384f},
-std::array<float,2>{0.810422659f, 0.0758743733f},
-std::array<float,2>{0.181671441f, 0.664428413f},
-std::array<float,2>{0.869456649f, 0.926044524f},
-std::array<float,2>{0.234575927f, 0.498485386f},
-std::array<float,2>{0.587156296f, 0.200506404f},
-std::array<float,2>{0.372830719f, 0.580523133f},
-std::array<float,2>{0.669554055f, 0.687759101f},
-std::array<float,2>{0.453760624f, 0.00449140323f},
-std::array<float,2>{0.995200217f, 0.340581566f},
-std::array<float,2>{0.114022598f, 0.830586433f},
-std::array<float,2>{0.969664633f, 0.732476294f},
-std::array<float,2>{0.100389093f, 0.036846213f},
-std::array<float,2>{0.686295807f, 0.374363333f},
-std::array<float,2>{0.449620366f, 0.861507833f},
-std::array<float,2>{0.572838545f, 0.877111077f},
-std::array<float,2>{0.348623157f, 0.447506428f},
-std::array<float,2>{0.85282433f, 0.239241645f},
-std::array<float,2>{0.224471286f, 0.616485894f},
-std::array<float,2>{0.787185431f, 0.797932088f},
-std::array<float,2>{0.168518931f, 0.265175074f},
-std::array<float,2>{0.510879457f, 0.124917194f},
-std::array<float,2>{0.294077933f, 0.647925496f},
-std::array<float,2>{0.687698901f, 0.532902837f},
-std::array<float,2>{0.376668543f, 0.151031017f},
-std::array<float,2>{0.893614769f, 0.39203319f},
-std::array<float,2>{0.0486015826f, 0.997242928f},
-std::array<float,2>{0.814260364f, 0.577027202f},
-std::array<float,2>{0.21001403f, 0.208022237f},
-std::array<float,2>{0.600101769f, 0.472556442f},
-std::array<float,2>{0.313581675f, 0.909622788f},
-std::array<float,2>{0.630353093f, 0.82579565f},
-std::array<float,2>{0.488704622f, 0.32349959f},
-std::array<float,2>{0.963782847f, 0.025027629f},
-std::array<float,2>{0.0794210657f, 0.713566124f},
-std::array<float,2>{0.937139869f, 0.938168168f},
-std::array<float,2>{0.0283446144f, 0.41358763f},
-std::array<float,2>{0.721338868f, 0.176762372f},
-std::array<float,2>{0.418763638f, 0.510759115f},
-std::array<float,2>{0.549677074f, 0.672570527f},
-std::array<float,2>{0.266550213f, 0.0899741575f},
-std::array<float,2>{0.758808374f, 0.310490876f},
-std::array<float,2>{0.151290938f, 0.757021785f},
-std::array<float,2>{0.849562049f, 0.708574474f},
-std::array<float,2>{0.232318312f, 0.02099723f},
-std::array<float,2>{0.567998469f, 0.317631692f},
-std::array<float,2>{0.35711804f, 0.817824244f},
-std::array<float,2>{0.676874578f, 0.914235175f},
-std::array<float,2>{0.439967692f, 0.480806112f},
-std::array<float,2>{0.982308388f, 0.21112448f},
-std::array<float,2>{0.108890966f, 0.564215362f},
-std::array<float,2>{0.904762328f, 0.761591673f},
-std::array<float,2>{0.0615055189f, 0.299457937f},
-std::array<float,2>{0.69677496f, 0.0847575739f},
-std::array<float,2>{0.38726002f, 0.685593486f},
-std::array<float,2>{0.503309727f, 0.507019877f},
-std::array<float,2>{0.287033647f, 0.181606174f},
-std::array<float,2>{0.796040654f, 0.416094869f},
-std::array<float,2>{0.158923626f, 0.953062415f},
-std::array<float,2>{0.960247219f, 0.618860006f},
-std::array<float,2>{0.0898514092f, 0.248706996f},
-std::array<float,2>{0.640587568f, 0.441283554f},
-std::array<float,2>{0.499599636f, 0.885396898f},
-std::array<float,2>{0.602115512f, 0.871387482f},
-std::array<float,2>{0.322079033f, 0.36256218f},
-std::array<float,2>{0.826291263f, 0.0457655564f},
-std::array<float,2>{0.213802367f, 0.723889351f},
-std::array<float,2>{0.756643653f, 0.985327899f},
-std::array<float,2>{0.14818193f, 0.40073213f},
-std::array<float,2>{0.558611333f, 0.148001969f},
-std::array<float,2>{0.274909675f, 0.539349139f},
-std::array<float,2>{0.728393018f, 0.651505351f},
-std::array<float,2>{0.413510442f, 0.112064943f},
-std::array<float,2>{0.928921878f, 0.25712654f},
-std::array<float,2>{0.0189005584f, 0.806285441f},
-std::array<float,2>{0.918030262f, 0.661023974f},
-std::array<float,2>{0.0129956631f, 0.069057174f},
-std::array<float,2>{0.745716929f, 0.289084196f},
-std::array<float,2>{0.437294066f, 0.779752135f},
-std::array<float,2>{0.542845786f, 0.960626841f},
-std::array<float,2>{0.264975935f, 0.433594048f},
-std::array<float,2>{0.776165605f, 0.159986809f},
-std::array<float,2>{0.125549793f, 0.527560949f},
-std::array<float,2>{0.833323598f, 0.840114832f},
-std::array<float,2>{0.2024813f, 0.33236748f},
-std::array<float,2>{0.624065995f, 0.00972801168f},
-std::array<float,2>{0.338184506f, 0.701139569f},
-std::array<float,2>{0.647094965f, 0.587830544f},
-std::array<float,2>{0.481253296f, 0.189901248f},
-std::array<float,2>{0.944815397f, 0.486829996f},
-std::array<float,2>{0.068124488f, 0.931583047f},
-std::array<float,2>{0.803840697f, 0.555315077f},
-std::array<float,2>{0.176263914f, 0.12724261f},
-std::array<float,2>{0.518099904f, 0.382808447f},
-std::array<float,2>{0.303512782f, 0.979714811f},
-std::array<float,2>{0.712903261f, 0.785310388f},
-std::array<float,2>{0.402767807f, 0.270470798f},
-std::array<float,2>{0.883464396f, 0.0983488411f},
-std::array<float,2>{0.0366942659f, 0.635737419f},
-std::array<float,2>{0.986572802f, 0.90510118f},
-std::array<float,2>{0.118260615f, 0.453616351f},
-std::array<float,2>{0.657403827f, 0.230414435f},
-std::array<float,2>{0.467899859f, 0.594769716f},
-std::array<float,2>{0.582461834f, 0.738816559f},
-std::array<float,2>{0.359378666f, 0.0480255373f},
-std::array<float,2>{0.864358604f, 0.349002182f},
-std::array<float,2>{0.248801723f, 0.853421271f},
-std::array<float,2>{0.753287971f, 0.693115115f},
-std::array<float,2>{0.141887337f, 0.00253532641f},
-std::array<float,2>{0.557826996f, 0.336020589f},
-std::array<float,2>{0.278796583f, 0.833607137f},
-std::array<float,2>{0.732067287f, 0.925701976f},
-std::array<float,2>{0.407516748f, 0.494404048f},
-std::array<float,2>{0.92413944f, 0.196998373f},
-std::array<float,2>{0.0203010589f, 0.582164705f},
-std::array<float,2>{0.956265867f, 0.769235253f},
-std::array<float,2>{0.088206403f, 0.283173263f},
-std::array<float,2>{0.63620913f, 0.0738270283f},
-std::array<float,2>{0.493269205f, 0.669250667f},
-std::array<float,2>{0.607843697f, 0.516376793f},
-std::array<float,2>{0.326135606f, 0.168622583f},
-std::array<float,2>{0.821068764f, 0.428145945f},
-std::array<float,2>{0.214970931f, 0.966974139f},
-std::array<float,2>{0.900468767f, 0.606979251f},
-std::array<float,2>{0.0585385561f, 0.225136518f},
-std::array<float,2>{0.701358497f, 0.461517423f},
-std::array<float,2>{0.384570926f, 0.892033279f},
-std::array<float,2>{0.507015228f, 0.84568435f},
-std::array<float,2>{0.284605712f, 0.35740456f},
-std::array<float,2>{0.792241514f, 0.060989812f},
-std::array<float,2>{0.163382694f, 0.74670583f},
-std::array<float,2>{0.846644938f, 0.974796534f},
-std::array<float,2>{0.22888045f, 0.385174721f},
-std::array<float,2>{0.563883007f, 0.138445556f},
-std::array<float,2>{0.351845384f, 0.55361563f},
-std::array<float,2>{0.672392011f, 0.628535986f},
-std::array<float,2>{0.444806725f, 0.102552891f},
-std::array<float,2>{0.97947973f, 0.279213637f},
-std::array<float,2>{0.101872265f, 0.790815473f},
-std::array<float,2>{0.988721848f, 0.677730441f},
-std::array<float,2>{0.1239281f, 0.0895338356f},
-std::array<float,2>{0.662432551f, 0.304836839f},
-std::array<float,2>{0.463699162f, 0.752400696f},
-std::array<float,2>{0.580702782f, 0.945271075f},
-std::array<float,2>{0.367057711f, 0.408684641f},
-std::array<float,2>{0.860621274f, 0.174869046f},
-std::array<float,2>{0.245430529f, 0.511906743f},
-std::array<float,2>{0.798632383f, 0.822560012f},
-std::array<float,2>{0.172524139f, 0.327601969f},
-std::array<float,2>{0.520329535f, 0.0291184373f},
-std::array<float,2>{0.299397022f, 0.718625307f},
-std::array<float,2>{0.718708038f, 0.571058273f},
-std::array<float,2>{0.398769528f, 0.204418838f},
-std::array<float,2>{0.887081087f, 0.475152194f},
-std::array<float,2>{0.0339417048f, 0.910801828f},
-std::array<float,2>{0.828747749f, 0.538272619f},
-std::array<float,2>{0.197690696f, 0.15462558f},
-std::array<float,2>{0.620830894f, 0.39709726f},
-std::array<float,2>{0.342196465f, 0.994497418f},
-std::array<float,2>{0.64066571f, 0.803819597f},
-std::array<float,2>{0.478188694f, 0.260557264f},
-std::array<float,2>{0.941049039f, 0.120651968f},
-std::array<float,2>{0.0629786104f, 0.643052936f},
-std::array<float,2>{0.915120184f, 0.879837871f},
-std::array<float,2>{0.0106174303f, 0.450677454f},
-std::array<float,2>{0.749639034f, 0.237532049f},
-std::array<float,2>{0.429701269f, 0.610876799f},
-std::array<float,2>{0.545936763f, 0.7270208f},
-std::array<float,2>{0.25966984f, 0.0327489935f},
-std::array<float,2>{0.780333757f, 0.36856401f},
-std::array<float,2>{0.129016414f, 0.866831601f},
-std::array<float,2>{0.873641074f, 0.654769599f},
-std::array<float,2>{0.239553615f, 0.115176402f},
-std::array<float,2>{0.593552887f, 0.252766252f},
-std::array<float,2>{0.371013194f, 0.80931735f},
-std::array<float,2>{0.666871607f, 0.989236474f},
-std::array<float,2>{0.458568633f, 0.403230697f},
-std::array<float,2>{0.99860692f, 0.141309112f},
-std::array<float,2>{0.110880695f, 0.542976439f},
-std::array<float,2>{0.878424525f, 0.869595468f},
-std::array<float,2>{0.0392366722f, 0.365588903f},
-std::array<float,2>{0.703995049f, 0.0407536365f},
-std::array<float,2>{0.396749049f, 0.720025778f},
-std::array<float,2>{0.528710663f, 0.621887386f},
-std::array<float,2>{0.308288813f, 0.246056646f},
-std::array<float,2>{0.805701435f, 0.443273693f},
-std::array<float,2>{0.186546206f, 0.888934493f},
-std::array<float,2>{0.945930004f, 0.500431478f},
-std::array<float,2>{0.0704899281f, 0.186135098f},
-std::array<float,2>{0.655097246f, 0.418340236f},
-std::array<float,2>{0.468979269f, 0.946684718f},
-std::array<float,2>{0.6097399f, 0.764769197f},
-std::array<float,2>{0.334179282f, 0.302357793f},
-std::array<float,2>{0.839313507f, 0.0791282207f},
-std::array<float,2>{0.191854402f, 0.681173384f},
-std::array<float,2>{0.773148179f, 0.921212792f},
-std::array<float,2>{0.133695409f, 0.480273902f},
-std::array<float,2>{0.531968474f, 0.217874348f},
-std::array<float,2>{0.252422214f, 0.568270028f},
-std::array<float,2>{0.741786301f, 0.704426825f},
-std::array<float,2>{0.426875532f, 0.0162676163f},
-std::array<float,2>{0.909227192f, 0.314308882f},
-std::array<float,2>{0.0020758803f, 0.816204846f},
-std::array<float,2>{0.933031142f, 0.738022566f},
-std::array<float,2>{0.0255195368f, 0.0516954809f},
-std::array<float,2>{0.72591567f, 0.347376049f},
-std::array<float,2>{0.4153983f, 0.856473565f},
-std::array<float,2>{0.554433763f, 0.902039111f},
-std::array<float,2>{0.271406651f, 0.459054381f},
-std::array<float,2>{0.761753619f, 0.233055294f},
-std::array<float,2>{0.155567795f, 0.599840701f},
-std::array<float,2>{0.818977833f, 0.78369683f},
-std::array<float,2>{0.204141602f, 0.266868174f},
-std::array<float,2>{0.59702301f, 0.0965863243f},
-std::array<float,2>{0.317662984f, 0.639539421f},
-std::array<float,2>{0.627513945f, 0.559723377f},
-std::array<float,2>{0.487871259f, 0.129406542f},
-std::array<float,2>{0.966425061f, 0.377990127f},
-std::array<float,2>{0.0837024376f, 0.983551919f},
-std::array<float,2>{0.783504963f, 0.590180039f},
-std::array<float,2>{0.164962307f, 0.19445911f},
-std::array<float,2>{0.515612662f, 0.490723729f},
-std::array<float,2>{0.291539729f, 0.936285019f},
-std::array<float,2>{0.694854915f, 0.83613044f},
-std::array<float,2>{0.379292041f, 0.328633308f},
-std::array<float,2>{0.895554721f, 0.0119475769f},
-std::array<float,2>{0.0540259741f, 0.699177265f},
-std::array<float,2>{0.973747492f, 0.95348537f},
-std::array<float,2>{0.0975880995f, 0.43007192f},
-std::array<float,2>{0.680223346f, 0.162211314f},
-std::array<float,2>{0.448855966f, 0.525389075f},
-std::array<float,2>{0.577621758f, 0.660034478f},
-std::array<float,2>{0.345443279f, 0.0632645562f},
-std::array<float,2>{0.857891619f, 0.294324905f},
-std::array<float,2>{0.220042095f, 0.776959658f},
-std::array<float,2>{0.811155796f, 0.666558921f},
-std::array<float,2>{0.181250751f, 0.077478148f},
-std::array<float,2>{0.527283192f, 0.287131548f},
-std::array<float,2>{0.311910987f, 0.770745158f},
-std::array<float,2>{0.707405925f, 0.964364827f},
-std::array<float,2>{0.393638134f, 0.422287762f},
-std::array<float,2>{0.881509602f, 0.166460171f},
-std::array<float,2>{0.0438964851f, 0.522600591f},
-std::array<float,2>{0.992662668f, 0.828781784f},
-std::array<float,2>{0.116373025f, 0.342944831f},
-std::array<float,2>{0.671600044f, 0.00612833444f},
-std::array<float,2>{0.455127865f, 0.690737247f},
-std::array<float,2>{0.588637531f, 0.578256845f},
-std::array<float,2>{0.37480253f, 0.202331349f},
-std::array<float,2>{0.868717313f, 0.497218788f},
-std::array<float,2>{0.236692593f, 0.928514063f},
-std::array<float,2>{0.913511336f, 0.549505174f},
-std::array<float,2>{0.00565689988f, 0.135699138f},
-std::array<float,2>{0.736270666f, 0.386850804f},
-std::array<float,2>{0.425599962f, 0.972497225f},
-std::array<float,2>{0.538767099f, 0.793146014f},
-std::array<float,2>{0.256836861f, 0.276238382f},
-std::array<float,2>{0.766026139f, 0.108138867f},
-std::array<float,2>{0.137205675f, 0.631875992f},
-std::array<float,2>{0.842138946f, 0.895709932f},
-std::array<float,2>{0.188830853f, 0.465729684f},
-std::array<float,2>{0.613555193f, 0.221440211f},
-std::array<float,2>{0.330361456f, 0.604221642f},
-std::array<float,2>{0.652233362f, 0.745065033f},
-std::array<float,2>{0.473087788f, 0.0559050255f},
-std::array<float,2>{0.952467442f, 0.355366409f},
-std::array<float,2>{0.0753312111f, 0.848116457f},
-std::array<float,2>{0.961014152f, 0.711648047f},
-std::array<float,2>{0.081595324f, 0.0258866344f},
-std::array<float,2>{0.631142974f, 0.321003675f},
-std::array<float,2>{0.490574062f, 0.82756567f},
-std::array<float,2>{0.599537849f, 0.906902552f},
-std::array<float,2>{0.314749837f, 0.469508857f},
-std::array<float,2>{0.816370547f, 0.209876642f},
-std::array<float,2>{0.208626926f, 0.574986458f},
-std::array<float,2>{0.759982705f, 0.755107164f},
-std::array<float,2>{0.149954423f, 0.31096825f},
-std::array<float,2>{0.548013568f, 0.093678616f},
-std::array<float,2>{0.268214852f, 0.675768137f},
-std::array<float,2>{0.719327867f, 0.507889807f},
-std::array<float,2>{0.420059055f, 0.179031476f},
-std::array<float,2>{0.93498522f, 0.410576999f},
-std::array<float,2>{0.0293991826f, 0.941356361f},
-std::array<float,2>{0.854666233f, 0.615010858f},
-std::array<float,2>{0.22463955f, 0.241542399f},
-std::array<float,2>{0.570978343f, 0.446500599f},
-std::array<float,2>{0.351115048f, 0.876037955f},
-std::array<float,2>{0.683811307f, 0.860543847f},
-std::array<float,2>{0.452853739f, 0.372051686f},
-std::array<float,2>{0.970832288f, 0.0376975425f},
-std::array<float,2>{0.0979496241f, 0.732256889f},
-std::array<float,2>{0.891445637f, 0.999067008f},
-std::array<float,2>{0.0500397719f, 0.394401222f},
-std::array<float,2>{0.689905882f, 0.150065452f},
-std::array<float,2>{0.37756753f, 0.534434378f},
-std::array<float,2>{0.508372486f, 0.645110905f},
-std::array<float,2>{0.295047909f, 0.121840738f},
-std::array<float,2>{0.786325514f, 0.262513667f},
-std::array<float,2>{0.171059594f, 0.800739169f},
-std::array<float,2>{0.825010359f, 0.7252298f},
-std::array<float,2>{0.211457908f, 0.0438463725f},
-std::array<float,2>{0.60440892f, 0.360904157f},
-std::array<float,2>{0.324193269f, 0.873779714f},
-std::array<float,2>{0.637769103f, 0.883455575f},
-std::array<float,2>{0.496567726f, 0.439340621f},
-std::array<float,2>{0.958403707f, 0.247914597f},
-std::array<float,2>{0.0924240723f, 0.619759858f},
-std::array<float,2>{0.926193655f, 0.806923449f},
-std::array<float,2>{0.0161997341f, 0.254894674f},
-std::array<float,2>{0.728589058f, 0.11042054f},
-std::array<float,2>{0.411208063f, 0.648986161f},
-std::array<float,2>{0.561188042f, 0.54284066f},
-std::array<float,2>{0.276050448f, 0.145768389f},
-std::array<float,2>{0.755069613f, 0.399646521f},
-std::array<float,2>{0.146194547f, 0.986927032f},
-std::array<float,2>{0.98411274f, 0.565840006f},
-std::array<float,2>{0.106202245f, 0.214825064f},
-std::array<float,2>{0.677890062f, 0.483011812f},
-std::array<float,2>{0.439232618f, 0.917035103f},
-std::array<float,2>{0.569248378f, 0.819984615f},
-std::array<float,2>{0.358077586f, 0.319828212f},
-std::array<float,2>{0.850253701f, 0.0223958809f},
-std::array<float,2>{0.232573569f, 0.710231364f},
-std::array<float,2>{0.79308939f, 0.949516833f},
-std::array<float,2>{0.157389775f, 0.415148735f},
-std::array<float,2>{0.500650823f, 0.182148337f},
-std::array<float,2>{0.287264884f, 0.50557667f},
-std::array<float,2>{0.698064506f, 0.685226679f},
-std::array<float,2>{0.388850898f, 0.0823463723f},
-std::array<float,2>{0.9038679f, 0.298457682f},
-std::array<float,2>{0.0601935722f, 0.758091331f},
-std::array<float,2>{0.885813892f, 0.633659661f},
-std::array<float,2>{0.0382063389f, 0.100315496f},
-std::array<float,2>{0.711173058f, 0.271750569f},
-std::array<float,2>{0.406150848f, 0.788205922f},
-std::array<float,2>{0.516475201f, 0.97818625f},
-std::array<float,2>{0.301252753f, 0.38047573f},
-std::array<float,2>{0.801501215f, 0.125883698f},
-std::array<float,2>{0.178769529f, 0.556771457f},
-std::array<float,2>{0.865727723f, 0.854286194f},
-std::array<float,2>{0.246429414f, 0.350410581f},
-std::array<float,2>{0.584354401f, 0.0501722991f},
-std::array<float,2>{0.362372935f, 0.741074443f},
-std::array<float,2>{0.659022152f, 0.595923781f},
-std::array<float,2>{0.466249168f, 0.228428915f},
-std::array<float,2>{0.985053897f, 0.455637008f},
-std::array<float,2>{0.119998515f, 0.902924597f},
-std::array<float,2>{0.773614585f, 0.530540049f},
-std::array<float,2>{0.127602741f, 0.158052787f},
-std::array<float,2>{0.540668488f, 0.437285006f},
-std::array<float,2>{0.262683034f, 0.958149672f},
-std::array<float,2>{0.74402076f, 0.77845937f},
-std::array<float,2>{0.433715701f, 0.291505396f},
-std::array<float,2>{0.921182632f, 0.0666576475f},
-std::array<float,2>{0.0151173985f, 0.662238002f},
-std::array<float,2>{0.94284308f, 0.932056963f},
-std::array<float,2>{0.0685133114f, 0.485496461f},
-std::array<float,2>{0.644677818f, 0.189432442f},
-std::array<float,2>{0.483510345f, 0.588355303f},
-std::array<float,2>{0.622002482f, 0.70235008f},
-std::array<float,2>{0.337363034f, 0.0107461074f},
-std::array<float,2>{0.835401058f, 0.334352881f},
-std::array<float,2>{0.199713394f, 0.843426943f},
-std::array<float,2>{0.780251741f, 0.729811192f},
-std::array<float,2>{0.130652159f, 0.0338026062f},
-std::array<float,2>{0.545864284f, 0.369623899f},
-std::array<float,2>{0.258342415f, 0.863476515f},
-std::array<float,2>{0.748757303f, 0.881238282f},
-std::array<float,2>{0.431384861f, 0.452058107f},
-std::array<float,2>{0.91419816f, 0.234899312f},
-std::array<float,2>{0.0109121585f, 0.612172008f},
-std::array<float,2>{0.939595461f, 0.801481247f},
-std::array<float,2>{0.0637300387f, 0.259174705f},
-std::array<float,2>{0.642120421f, 0.117831677f},
-std::array<float,2>{0.477037132f, 0.641213179f},
-std::array<float,2>{0.619281709f, 0.536046088f},
-std::array<float,2>{0.343628615f, 0.154153526f},
-std::array<float,2>{0.829307139f, 0.395473182f},
-std::array<float,2>{0.198555991f, 0.99387604f},
-std::array<float,2>{0.888079405f, 0.57382977f},
-std::array<float,2>{0.0344844535f, 0.205207735f},
-std::array<float,2>{0.717065156f, 0.47345075f},
-std::array<float,2>{0.400366575f, 0.912207663f},
-std::array<float,2>{0.521132588f, 0.82219547f},
-std::array<float,2>{0.300555587f, 0.324707568f},
-std::array<float,2>{0.79726696f, 0.0294750202f},
-std::array<float,2>{0.173649818f, 0.715597451f},
-std::array<float,2>{0.859485567f, 0.941716611f},
-std::array<float,2>{0.244546801f, 0.408050865f},
-std::array<float,2>{0.581349909f, 0.173202485f},
-std::array<float,2>{0.365552485f, 0.514932096f},
-std::array<float,2>{0.663134575f, 0.678897738f},
-std::array<float,2>{0.464700073f, 0.0869098827f},
-std::array<float,2>{0.989435971f, 0.308560759f},
-std::array<float,2>{0.124236278f, 0.750778019f},
-std::array<float,2>{0.97961396f, 0.625530541f},
-std::array<float,2>{0.103403136f, 0.104529031f},
-std::array<float,2>{0.673364282f, 0.280107796f},
-std::array<float,2>{0.443379134f, 0.79249084f},
-std::array<float,2>{0.562989295f, 0.973425627f},
-std::array<float,2>{0.35255444f, 0.383476585f},
-std::array<float,2>{0.847005606f, 0.139622495f},
-std::array<float,2>{0.229736686f, 0.552640796f},
-std::array<float,2>{0.791046321f, 0.847531855f},
-std::array<float,2>{0.16226235f, 0.358591437f},
-std::array<float,2>{0.506002069f, 0.0589121431f},
-std::array<float,2>{0.284057707f, 0.748649895f},
-std::array<float,2>{0.702697158f, 0.608367741f},
-std::array<float,2>{0.383707047f, 0.223661184f},
-std::array<float,2>{0.901888549f, 0.463375688f},
-std::array<float,2>{0.0570378527f, 0.892684579f},
-std::array<float,2>{0.821987569f, 0.51794225f},
-std::array<float,2>{0.215839222f, 0.170212299f},
-std::array<float,2>{0.608519256f, 0.426979482f},
-std::array<float,2>{0.324703306f, 0.965750039f},
-std::array<float,2>{0.635163784f, 0.7660923f},
-std::array<float,2>{0.493116111f, 0.284931481f},
-std::array<float,2>{0.955931544f, 0.0714497864f},
-std::array<float,2>{0.0893497467f, 0.670174599f},
-std::array<float,2>{0.925316691f, 0.922222674f},
-std::array<float,2>{0.0208280906f, 0.493468404f},
-std::array<float,2>{0.730632246f, 0.197857901f},
-std::array<float,2>{0.406540334f, 0.585431755f},
-std::array<float,2>{0.557498813f, 0.693510771f},
-std::array<float,2>{0.278291345f, 0.000948139408f},
-std::array<float,2>{0.752187967f, 0.339347273f},
-std::array<float,2>{0.140838757f, 0.835604727f},
-std::array<float,2>{0.858820617f, 0.657453716f},
-std::array<float,2>{0.218817234f, 0.0650225207f},
-std::array<float,2>{0.576324999f, 0.29601568f},
-std::array<float,2>{0.344029427f, 0.774108529f},
-std::array<float,2>{0.681562126f, 0.955604792f},
-std::array<float,2>{0.448174775f, 0.433458477f},
-std::array<float,2>{0.973478615f, 0.161643982f},
-std::array<float,2>{0.0957833081f, 0.525451899f},
-std::array<float,2>{0.894670784f, 0.839390278f},
-std::array<float,2>{0.0529493429f, 0.330169499f},
-std::array<float,2>{0.69337213f, 0.0141998213f},
-std::array<float,2>{0.380727291f, 0.696983933f},
-std::array<float,2>{0.513766408f, 0.592218161f},
-std::array<float,2>{0.292948276f, 0.192130387f},
-std::array<float,2>{0.785130262f, 0.489366263f},
-std::array<float,2>{0.165806487f, 0.933634102f},
-std::array<float,2>{0.964914858f, 0.560736299f},
-std::array<float,2>{0.0826273263f, 0.132582113f},
-std::array<float,2>{0.628710568f, 0.376262605f},
-std::array<float,2>{0.486736894f, 0.981949925f},
-std::array<float,2>{0.595711946f, 0.782744408f},
-std::array<float,2>{0.3167198f, 0.267816514f},
-std::array<float,2>{0.819549441f, 0.0956300199f},
-std::array<float,2>{0.203485727f, 0.637288868f},
-std::array<float,2>{0.763110042f, 0.89879775f},
-std::array<float,2>{0.154526874f, 0.457803249f},
-std::array<float,2>{0.553587556f, 0.230638742f},
-std::array<float,2>{0.270063072f, 0.599386692f},
-std::array<float,2>{0.725356162f, 0.735622108f},
-std::array<float,2>{0.414356977f, 0.054353863f},
-std::array<float,2>{0.932106853f, 0.343934298f},
-std::array<float,2>{0.0265365262f, 0.857950866f},
-std::array<float,2>{0.908444226f, 0.70688796f},
-std::array<float,2>{0.00385826617f, 0.0179980919f},
-std::array<float,2>{0.740622759f, 0.316247255f},
-std::array<float,2>{0.426280648f, 0.813283563f},
-std::array<float,2>{0.532678604f, 0.918314397f},
-std::array<float,2>{0.253666371f, 0.478129685f},
-std::array<float,2>{0.77157861f, 0.21499528f},
-std::array<float,2>{0.134593576f, 0.568713605f},
-std::array<float,2>{0.838575423f, 0.763440847f},
-std::array<float,2>{0.192527995f, 0.303533405f},
-std::array<float,2>{0.610765576f, 0.0819441229f},
-std::array<float,2>{0.335223258f, 0.68242979f},
-std::array<float,2>{0.656171262f, 0.502270877f},
-std::array<float,2>{0.470491886f, 0.184186161f},
-std::array<float,2>{0.94664669f, 0.421235293f},
-std::array<float,2>{0.0717936009f, 0.947575688f},
-std::array<float,2>{0.804878652f, 0.623910189f},
-std::array<float,2>{0.18574971f, 0.242645919f},
-std::array<float,2>{0.52746737f, 0.444235086f},
-std::array<float,2>{0.307207167f, 0.887618959f},
-std::array<float,2>{0.704463482f, 0.867195427f},
-std::array<float,2>{0.398420602f, 0.364346713f},
-std::array<float,2>{0.876953661f, 0.0421529412f},
-std::array<float,2>{0.0400861949f, 0.720968306f},
-std::array<float,2>{0.999427855f, 0.991567016f},
-std::array<float,2>{0.109450497f, 0.404920161f},
-std::array<float,2>{0.667281687f, 0.143445998f},
-std::array<float,2>{0.457739353f, 0.545256436f},
-std::array<float,2>{0.592316389f, 0.653832674f},
-std::array<float,2>{0.369450033f, 0.117059276f},
-std::array<float,2>{0.874117494f, 0.251034588f},
-std::array<float,2>{0.238582864f, 0.810854375f},
-std::array<float,2>{0.785440922f, 0.646915257f},
-std::array<float,2>{0.170089975f, 0.123719491f},
-std::array<float,2>{0.50963062f, 0.264473885f},
-std::array<float,2>{0.296379983f, 0.797092497f},
-std::array<float,2>{0.691210568f, 0.996630371f},
-std::array<float,2>{0.378733546f, 0.391379744f},
-std::array<float,2>{0.892102718f, 0.152156964f},
-std::array<float,2>{0.049153395f, 0.531464696f},
-std::array<float,2>{0.97169745f, 0.863155961f},
-std::array<float,2>{0.0992661268f, 0.373501033f},
-std::array<float,2>{0.684967697f, 0.0355329327f},
-std::array<float,2>{0.451705813f, 0.733932376f},
-std::array<float,2>{0.571605682f, 0.615860701f},
-std::array<float,2>{0.350219786f, 0.239920825f},
-std::array<float,2>{0.854463935f, 0.448273301f},
-std::array<float,2>{0.226207808f, 0.878806829f},
-std::array<float,2>{0.933641016f, 0.509930253f},
-std::array<float,2>{0.0310310256f, 0.176495478f},
-std::array<float,2>{0.720558643f, 0.412189841f},
-std::array<float,2>{0.421134055f, 0.939055741f},
-std::array<float,2>{0.547584295f, 0.756465733f},
-std::array<float,2>{0.268667936f, 0.308972985f},
-std::array<float,2>{0.761247873f, 0.0916955695f},
-std::array<float,2>{0.148482978f, 0.673234582f},
-std::array<float,2>{0.814835966f, 0.908737302f},
-std::array<float,2>{0.207464203f, 0.470770985f},
-std::array<float,2>{0.598618627f, 0.20774962f},
-std::array<float,2>{0.316120118f, 0.577504218f},
-std::array<float,2>{0.63188976f, 0.713984787f},
-std::array<float,2>{0.491560727f, 0.0234853793f},
-std::array<float,2>{0.962888837f, 0.322727889f},
-std::array<float,2>{0.0804873407f, 0.824447274f},
-std::array<float,2>{0.951852262f, 0.743640006f},
-std::array<float,2>{0.0744068325f, 0.0568968095f},
-std::array<float,2>{0.650708377f, 0.353280425f},
-std::array<float,2>{0.474286497f, 0.851383388f},
-std::array<float,2>{0.615226626f, 0.897484541f},
-std::array<float,2>{0.331649125f, 0.46719107f},
-std::array<float,2>{0.843283772f, 0.220574304f},
-std::array<float,2>{0.187519282f, 0.602182567f},
-std::array<float,2>{0.766717613f, 0.795808375f},
-std::array<float,2>{0.137858033f, 0.274779886f},
-std::array<float,2>{0.53767848f, 0.105547026f},
-std::array<float,2>{0.256124675f, 0.630534351f},
-std::array<float,2>{0.735085309f, 0.547773659f},
-std::array<float,2>{0.424255252f, 0.134585187f},
-std::array<float,2>{0.912986994f, 0.390283644f},
-std::array<float,2>{0.00482180296f, 0.969773352f},
-std::array<float,2>{0.867482126f, 0.581536353f},
-std::array<float,2>{0.238028318f, 0.199558511f},
-std::array<float,2>{0.589380324f, 0.499208838f},
-std::array<float,2>{0.373135626f, 0.92761445f},
-std::array<float,2>{0.670849323f, 0.831978321f},
-std::array<float,2>{0.456916213f, 0.3414644f},
-std::array<float,2>{0.993890524f, 0.00549038826f},
-std::array<float,2>{0.115286328f, 0.688487589f},
-std::array<float,2>{0.882157505f, 0.961728454f},
-std::array<float,2>{0.044743102f, 0.423871815f},
-std::array<float,2>{0.708539009f, 0.166006729f},
-std::array<float,2>{0.393480986f, 0.520633757f},
-std::array<float,2>{0.525533855f, 0.6652264f},
-std::array<float,2>{0.310651392f, 0.0751382113f},
-std::array<float,2>{0.812069654f, 0.285644621f},
-std::array<float,2>{0.179907933f, 0.771983624f},
-std::array<float,2>{0.834704638f, 0.699890614f},
-std::array<float,2>{0.200429767f, 0.00850842055f},
-std::array<float,2>{0.622130275f, 0.333699137f},
-std::array<float,2>{0.336312473f, 0.841394186f},
-std::array<float,2>{0.645841002f, 0.930060565f},
-std::array<float,2>{0.482900709f, 0.488011122f},
-std::array<float,2>{0.941871345f, 0.190871969f},
-std::array<float,2>{0.069543846f, 0.586621583f},
-std::array<float,2>{0.920107663f, 0.780845642f},
-std::array<float,2>{0.0144160232f, 0.290056556f},
-std::array<float,2>{0.74285531f, 0.0697473139f},
-std::array<float,2>{0.435186863f, 0.661323488f},
-std::array<float,2>{0.539464951f, 0.528835833f},
-std::array<float,2>{0.26336804f, 0.158338189f},
-std::array<float,2>{0.775366485f, 0.435266197f},
-std::array<float,2>{0.128209949f, 0.959515691f},
-std::array<float,2>{0.985549927f, 0.594420314f},
-std::array<float,2>{0.120743312f, 0.228554711f},
-std::array<float,2>{0.659456074f, 0.454131067f},
-std::array<float,2>{0.465558648f, 0.905780613f},
-std::array<float,2>{0.585665166f, 0.851763129f},
-std::array<float,2>{0.361650646f, 0.348220915f},
-std::array<float,2>{0.867083132f, 0.0475350134f},
-std::array<float,2>{0.247924253f, 0.739585519f},
-std::array<float,2>{0.802100658f, 0.979294956f},
-std::array<float,2>{0.178297028f, 0.38126716f},
-std::array<float,2>{0.516763985f, 0.128223181f},
-std::array<float,2>{0.302422076f, 0.555947542f},
-std::array<float,2>{0.71242708f, 0.636320472f},
-std::array<float,2>{0.404838741f, 0.0986635834f},
-std::array<float,2>{0.885139883f, 0.271481633f},
-std::array<float,2>{0.0379682034f, 0.786939144f},
-std::array<float,2>{0.903046131f, 0.686545491f},
-std::array<float,2>{0.059089683f, 0.0852062181f},
-std::array<float,2>{0.698714137f, 0.299934536f},
-std::array<float,2>{0.390196264f, 0.760095239f},
-std::array<float,2>{0.501328468f, 0.951248586f},
-std::array<float,2>{0.288712472f, 0.417162776f},
-std::array<float,2>{0.794017196f, 0.180458292f},
-std::array<float,2>{0.157010138f, 0.506802559f},
-std::array<float,2>{0.851472259f, 0.816643655f},
-std::array<float,2>{0.234114394f, 0.316645145f},
-std::array<float,2>{0.570159614f, 0.020312719f},
-std::array<float,2>{0.359284729f, 0.707246721f},
-std::array<float,2>{0.678946316f, 0.563230515f},
-std::array<float,2>{0.437925071f, 0.212726533f},
-std::array<float,2>{0.982882738f, 0.482212186f},
-std::array<float,2>{0.107070513f, 0.915411711f},
-std::array<float,2>{0.754212081f, 0.54040736f},
-std::array<float,2>{0.144932553f, 0.147392854f},
-std::array<float,2>{0.562369347f, 0.401893318f},
-std::array<float,2>{0.276789904f, 0.986262023f},
-std::array<float,2>{0.730410159f, 0.804893434f},
-std::array<float,2>{0.410400212f, 0.256005198f},
-std::array<float,2>{0.927042961f, 0.113004655f},
-std::array<float,2>{0.0174053013f, 0.650873959f},
-std::array<float,2>{0.957207918f, 0.886208236f},
-std::array<float,2>{0.0929863378f, 0.439620495f},
-std::array<float,2>{0.637016296f, 0.249178261f},
-std::array<float,2>{0.498023629f, 0.617537856f},
-std::array<float,2>{0.604921401f, 0.72279346f},
-std::array<float,2>{0.323239297f, 0.0459818281f},
-std::array<float,2>{0.825597465f, 0.361923963f},
-std::array<float,2>{0.212633729f, 0.872130394f},
-std::array<float,2>{0.798859596f, 0.716889381f},
-std::array<float,2>{0.17551288f, 0.027540721f},
-std::array<float,2>{0.522431076f, 0.326344728f},
-std::array<float,2>{0.298516661f, 0.824107826f},
-std::array<float,2>{0.716524005f, 0.911899984f},
-std::array<float,2>{0.401702285f, 0.476130664f},
-std::array<float,2>{0.89040935f, 0.203702629f},
-std::array<float,2>{0.0323434845f, 0.571405053f},
-std::array<float,2>{0.99168247f, 0.753488123f},
-std::array<float,2>{0.121793039f, 0.305697888f},
-std::array<float,2>{0.661741734f, 0.0878991112f},
-std::array<float,2>{0.46224755f, 0.676617384f},
-std::array<float,2>{0.579259515f, 0.513054669f},
-std::array<float,2>{0.363582551f, 0.173995778f},
-std::array<float,2>{0.861454427f, 0.409793913f},
-std::array<float,2>{0.2428931f, 0.943708658f},
-std::array<float,2>{0.917583108f, 0.610137403f},
-std::array<float,2>{0.00951126777f, 0.237242296f},
-std::array<float,2>{0.746289611f, 0.449783117f},
-std::array<float,2>{0.431960106f, 0.880431294f},
-std::array<float,2>{0.543884277f, 0.865280092f},
-std::array<float,2>{0.261567324f, 0.367859334f},
-std::array<float,2>{0.777603209f, 0.0313737094f},
-std::array<float,2>{0.132776633f, 0.728221655f},
-std::array<float,2>{0.830961704f, 0.996086001f},
-std::array<float,2>{0.196912855f, 0.397516996f},
-std::array<float,2>{0.617694318f, 0.155399203f},
-std::array<float,2>{0.34010002f, 0.537954986f},
-std::array<float,2>{0.6435197f, 0.643828094f},
-std::array<float,2>{0.479869634f, 0.119343251f},
-std::array<float,2>{0.938616872f, 0.261673361f},
-std::array<float,2>{0.0660850331f, 0.803242147f},
-std::array<float,2>{0.9540658f, 0.668843091f},
-std::array<float,2>{0.0871284679f, 0.0730957314f},
-std::array<float,2>{0.633733034f, 0.281266212f},
-std::array<float,2>{0.494708776f, 0.76845783f},
-std::array<float,2>{0.605656147f, 0.968170822f},
-std::array<float,2>{0.327945739f, 0.429087371f},
-std::array<float,2>{0.823687136f, 0.169124499f},
-std::array<float,2>{0.218445286f, 0.517363787f},
-std::array<float,2>{0.750199437f, 0.832292914f},
-std::array<float,2>{0.143714339f, 0.337046504f},
-std::array<float,2>{0.555494785f, 0.00386148342f},
-std::array<float,2>{0.28121689f, 0.692374349f},
-std::array<float,2>{0.732790351f, 0.583843887f},
-std::array<float,2>{0.410060108f, 0.195945725f},
-std::array<float,2>{0.923795998f, 0.495454639f},
-std::array<float,2>{0.02241854f, 0.923899412f},
-std::array<float,2>{0.844061792f, 0.554481089f},
-std::array<float,2>{0.227160409f, 0.137534454f},
-std::array<float,2>{0.566031039f, 0.386012912f},
-std::array<float,2>{0.354940057f, 0.976464391f},
-std::array<float,2>{0.673991442f, 0.789772809f},
-std::array<float,2>{0.443223059f, 0.278198332f},
-std::array<float,2>{0.977552414f, 0.10159529f},
-std::array<float,2>{0.103840247f, 0.627841651f},
-std::array<float,2>{0.899814665f, 0.891352475f},
-std::array<float,2>{0.054909803f, 0.461969882f},
-std::array<float,2>{0.69956094f, 0.226459011f},
-std::array<float,2>{0.385982156f, 0.605893195f},
-std::array<float,2>{0.50461024f, 0.747587442f},
-std::array<float,2>{0.282412916f, 0.0620940328f},
-std::array<float,2>{0.789970338f, 0.356204301f},
-std::array<float,2>{0.161059991f, 0.844706833f},
-std::array<float,2>{0.817151248f, 0.640361488f},
-std::array<float,2>{0.206969857f, 0.0966918543f},
-std::array<float,2>{0.594812274f, 0.266465187f},
-std::array<float,2>{0.320267826f, 0.784368992f},
-std::array<float,2>{0.625458777f, 0.983273983f},
-std::array<float,2>{0.485588491f, 0.377271026f},
-std::array<float,2>{0.966902077f, 0.13064453f},
-std::array<float,2>{0.0851984471f, 0.558719277f},
-std::array<float,2>{0.930839479f, 0.856149733f},
-std::array<float,2>{0.0248812381f, 0.345873058f},
-std::array<float,2>{0.723204672f, 0.0523362905f},
-std::array<float,2>{0.417182207f, 0.736681461f},
-std::array<float,2>{0.55113554f, 0.600785971f},
-std::array<float,2>{0.272300929f, 0.234001517f},
-std::array<float,2>{0.763815641f, 0.460039496f},
-std::array<float,2>{0.153506249f, 0.900728881f},
-std::array<float,2>{0.97571522f, 0.523496568f},
-std::array<float,2>{0.0946549475f, 0.163907006f},
-std::array<float,2>{0.682061851f, 0.430897653f},
-std::array<float,2>{0.446939379f, 0.954407215f},
-std::array<float,2>{0.575736284f, 0.776173949f},
-std::array<float,2>{0.345828533f, 0.293312013f},
-std::array<float,2>{0.855859101f, 0.0644322559f},
-std::array<float,2>{0.22157006f, 0.658721566f},
-std::array<float,2>{0.782108843f, 0.937349975f},
-std::array<float,2>{0.166248783f, 0.491381496f},
-std::array<float,2>{0.513191998f, 0.194086939f},
-std::array<float,2>{0.289237231f, 0.591393948f},
-std::array<float,2>{0.692609012f, 0.697434843f},
-std::array<float,2>{0.381891221f, 0.0134492358f},
-std::array<float,2>{0.897577584f, 0.329609215f},
-std::array<float,2>{0.052231621f, 0.837826312f},
-std::array<float,2>{0.875064909f, 0.718879402f},
-std::array<float,2>{0.0426351391f, 0.0391438976f},
-std::array<float,2>{0.706376255f, 0.366365522f},
-std::array<float,2>{0.394737452f, 0.870144606f},
-std::array<float,2>{0.529964983f, 0.890430212f},
-std::array<float,2>{0.306481779f, 0.441771746f},
-std::array<float,2>{0.807814777f, 0.244423673f},
-std::array<float,2>{0.185042188f, 0.622973084f},
-std::array<float,2>{0.872990608f, 0.809804738f},
-std::array<float,2>{0.240726188f, 0.253588051f},
-std::array<float,2>{0.590591013f, 0.113286011f},
-std::array<float,2>{0.368849367f, 0.655579627f},
-std::array<float,2>{0.664440215f, 0.5441432f},
-std::array<float,2>{0.460137099f, 0.141618416f},
-std::array<float,2>{0.997263014f, 0.403367519f},
-std::array<float,2>{0.113047294f, 0.99022603f},
-std::array<float,2>{0.770811081f, 0.566671073f},
-std::array<float,2>{0.135096371f, 0.217561454f},
-std::array<float,2>{0.534900665f, 0.478735209f},
-std::array<float,2>{0.250830233f, 0.920851588f},
-std::array<float,2>{0.739809453f, 0.81487447f},
-std::array<float,2>{0.429340839f, 0.313047707f},
-std::array<float,2>{0.906930923f, 0.0172862429f},
-std::array<float,2>{0.000810067635f, 0.703885794f},
-std::array<float,2>{0.949009955f, 0.94606781f},
-std::array<float,2>{0.0732337311f, 0.419730604f},
-std::array<float,2>{0.652567387f, 0.187183857f},
-std::array<float,2>{0.470950186f, 0.501822114f},
-std::array<float,2>{0.611421645f, 0.679726899f},
-std::array<float,2>{0.333483845f, 0.0781726092f},
-std::array<float,2>{0.837637782f, 0.301510662f},
-std::array<float,2>{0.194368914f, 0.764065206f},
-std::array<float,2>{0.758753777f, 0.674391627f},
-std::array<float,2>{0.152208582f, 0.0918486267f},
-std::array<float,2>{0.550633192f, 0.311919153f},
-std::array<float,2>{0.266713589f, 0.754271805f},
-std::array<float,2>{0.722585499f, 0.94041127f},
-std::array<float,2>{0.419253111f, 0.411249489f},
-std::array<float,2>{0.935860276f, 0.17817153f},
-std::array<float,2>{0.0280756615f, 0.509405494f},
-std::array<float,2>{0.964013994f, 0.826838017f},
-std::array<float,2>{0.0786097273f, 0.321742237f},
-std::array<float,2>{0.629857361f, 0.0266894065f},
-std::array<float,2>{0.489590377f, 0.712003648f},
-std::array<float,2>{0.600835681f, 0.575323641f},
-std::array<float,2>{0.313136965f, 0.210639134f},
-std::array<float,2>{0.813307762f, 0.470251143f},
-std::array<float,2>{0.209805146f, 0.907971621f},
-std::array<float,2>{0.892901897f, 0.533918142f},
-std::array<float,2>{0.0472421162f, 0.148683503f},
-std::array<float,2>{0.689079702f, 0.392674327f},
-std::array<float,2>{0.375387639f, 0.998778641f},
-std::array<float,2>{0.510611773f, 0.799114347f},
-std::array<float,2>{0.293110102f, 0.262831479f},
-std::array<float,2>{0.788589716f, 0.122624166f},
-std::array<float,2>{0.169081703f, 0.646453798f},
-std::array<float,2>{0.852260172f, 0.875361502f},
-std::array<float,2>{0.222851962f, 0.445626557f},
-std::array<float,2>{0.573441744f, 0.241135895f},
-std::array<float,2>{0.349068463f, 0.613307297f},
-std::array<float,2>{0.687238216f, 0.730802f},
-std::array<float,2>{0.450725466f, 0.0390022732f},
-std::array<float,2>{0.970378816f, 0.372214168f},
-std::array<float,2>{0.101213947f, 0.859655678f},
-std::array<float,2>{0.994816542f, 0.689835429f},
-std::array<float,2>{0.11499095f, 0.00743902195f},
-std::array<float,2>{0.66814965f, 0.341971368f},
-std::array<float,2>{0.45448038f, 0.829504132f},
-std::array<float,2>{0.586237133f, 0.928908169f},
-std::array<float,2>{0.371259063f, 0.497017145f},
-std::array<float,2>{0.871026754f, 0.201757461f},
-std::array<float,2>{0.235373899f, 0.579406917f},
-std::array<float,2>{0.808901429f, 0.769962668f},
-std::array<float,2>{0.183533356f, 0.288631082f},
-std::array<float,2>{0.525313318f, 0.0768899545f},
-std::array<float,2>{0.309279174f, 0.667915285f},
-std::array<float,2>{0.709260106f, 0.52161485f},
-std::array<float,2>{0.392392486f, 0.16779153f},
-std::array<float,2>{0.879944503f, 0.423346758f},
-std::array<float,2>{0.0457477197f, 0.962996662f},
-std::array<float,2>{0.840919733f, 0.605378628f},
-std::array<float,2>{0.19103004f, 0.22190854f},
-std::array<float,2>{0.616972327f, 0.4663167f},
-std::array<float,2>{0.328807831f, 0.895278692f},
-std::array<float,2>{0.649504304f, 0.849016726f},
-std::array<float,2>{0.475007445f, 0.354266226f},
-std::array<float,2>{0.950424016f, 0.0553790927f},
-std::array<float,2>{0.0764493719f, 0.746044636f},
-std::array<float,2>{0.910358429f, 0.971576154f},
-std::array<float,2>{0.00651512388f, 0.388158202f},
-std::array<float,2>{0.737273812f, 0.136111245f},
-std::array<float,2>{0.423379421f, 0.550654113f},
-std::array<float,2>{0.536150098f, 0.631284297f},
-std::array<float,2>{0.254701704f, 0.109300189f},
-std::array<float,2>{0.769194245f, 0.277267426f},
-std::array<float,2>{0.140126824f, 0.794515014f},
-std::array<float,2>{0.863783538f, 0.741962969f},
-std::array<float,2>{0.249726236f, 0.0496651605f},
-std::array<float,2>{0.583266795f, 0.350978225f},
-std::array<float,2>{0.361105651f, 0.855430424f},
-std::array<float,2>{0.657124698f, 0.903563321f},
-std::array<float,2>{0.467605263f, 0.456737787f},
-std::array<float,2>{0.988145351f, 0.226952463f},
-std::array<float,2>{0.117662065f, 0.597221494f},
-std::array<float,2>{0.883810222f, 0.787697196f},
-std::array<float,2>{0.0358879231f, 0.273003429f},
-std::array<float,2>{0.714424312f, 0.10107103f},
-std::array<float,2>{0.403867632f, 0.633941829f},
-std::array<float,2>{0.519133925f, 0.558229983f},
-std::array<float,2>{0.304563195f, 0.126733303f},
-std::array<float,2>{0.803488255f, 0.379306495f},
-std::array<float,2>{0.177572265f, 0.97682941f},
-std::array<float,2>{0.943535626f, 0.589367151f},
-std::array<float,2>{0.0665157735f, 0.187911734f},
-std::array<float,2>{0.648276031f, 0.485263109f},
-std::array<float,2>{0.481932551f, 0.93262291f},
-std::array<float,2>{0.623304546f, 0.842377007f},
-std::array<float,2>{0.339752495f, 0.335868776f},
-std::array<float,2>{0.832511604f, 0.0099707637f},
-std::array<float,2>{0.20167838f, 0.701772749f},
-std::array<float,2>{0.777097046f, 0.957675338f},
-std::array<float,2>{0.126293465f, 0.436047703f},
-std::array<float,2>{0.541957021f, 0.157051012f},
-std::array<float,2>{0.263825834f, 0.529426336f},
-std::array<float,2>{0.74453634f, 0.663359046f},
-std::array<float,2>{0.436229438f, 0.0677985176f},
-std::array<float,2>{0.91979605f, 0.292472571f},
-std::array<float,2>{0.0125349071f, 0.777453661f},
-std::array<float,2>{0.927893043f, 0.650157452f},
-std::array<float,2>{0.018237669f, 0.110172778f},
-std::array<float,2>{0.726788461f, 0.254800826f},
-std::array<float,2>{0.412523568f, 0.808289468f},
-std::array<float,2>{0.560423791f, 0.987804949f},
-std::array<float,2>{0.274214447f, 0.398989201f},
-std::array<float,2>{0.756950915f, 0.144731984f},
-std::array<float,2>{0.146877378f, 0.541752934f},
-std::array<float,2>{0.827966273f, 0.874853969f},
-std::array<float,2>{0.214441761f, 0.359572709f},
-std::array<float,2>{0.602996707f, 0.0439744107f},
-std::array<float,2>{0.32065621f, 0.725720346f},
-std::array<float,2>{0.638830245f, 0.620413899f},
-std::array<float,2>{0.498699456f, 0.246377096f},
-std::array<float,2>{0.959077835f, 0.438062578f},
-std::array<float,2>{0.0917797908f, 0.884736955f},
-std::array<float,2>{0.79492259f, 0.504457116f},
-std::array<float,2>{0.159758136f, 0.182986259f},
-std::array<float,2>{0.502654314f, 0.414902389f},
-std::array<float,2>{0.285811394f, 0.950415671f},
-std::array<float,2>{0.695719123f, 0.759318769f},
-std::array<float,2>{0.388005495f, 0.297269017f},
-std::array<float,2>{0.905282199f, 0.0836832896f},
-std::array<float,2>{0.0623946376f, 0.684255004f},
-std::array<float,2>{0.980761886f, 0.916154087f},
-std::array<float,2>{0.107716091f, 0.48396799f},
-std::array<float,2>{0.676445186f, 0.213804096f},
-std::array<float,2>{0.440487772f, 0.564794064f},
-std::array<float,2>{0.566698372f, 0.709386408f},
-std::array<float,2>{0.355754137f, 0.0232464522f},
-std::array<float,2>{0.847705305f, 0.318813294f},
-std::array<float,2>{0.231352687f, 0.818395972f},
-std::array<float,2>{0.787692189f, 0.734300792f},
-std::array<float,2>{0.168338835f, 0.0353066362f},
-std::array<float,2>{0.511429191f, 0.373094827f},
-std::array<float,2>{0.294549078f, 0.862909675f},
-std::array<float,2>{0.688070774f, 0.878520608f},
-std::array<float,2>{0.376446426f, 0.448719621f},
-std::array<float,2>{0.894340575f, 0.24008289f},
-std::array<float,2>{0.0480209477f, 0.615970075f},
-std::array<float,2>{0.969067216f, 0.797136545f},
-std::array<float,2>{0.0998506695f, 0.264320433f},
-std::array<float,2>{0.685601711f, 0.123799674f},
-std::array<float,2>{0.449777722f, 0.646643758f},
-std::array<float,2>{0.572296798f, 0.531714559f},
-std::array<float,2>{0.347946882f, 0.15193136f},
-std::array<float,2>{0.853241026f, 0.39132002f},
-std::array<float,2>{0.223801672f, 0.996906877f},
-std::array<float,2>{0.936707437f, 0.577257454f},
-std::array<float,2>{0.029020397f, 0.207848251f},
-std::array<float,2>{0.721103489f, 0.470978886f},
-std::array<float,2>{0.417998642f, 0.909032345f},
-std::array<float,2>{0.549220622f, 0.824583411f},
-std::array<float,2>{0.266057789f, 0.322487354f},
-std::array<float,2>{0.759381056f, 0.023772141f},
-std::array<float,2>{0.150465667f, 0.714200079f},
-std::array<float,2>{0.813496888f, 0.9393664f},
-std::array<float,2>{0.210502476f, 0.412520885f},
-std::array<float,2>{0.599835813f, 0.176718324f},
-std::array<float,2>{0.314128309f, 0.510055959f},
-std::array<float,2>{0.630633295f, 0.672901273f},
-std::array<float,2>{0.489240378f, 0.0915261954f},
-std::array<float,2>{0.963317931f, 0.308755338f},
-std::array<float,2>{0.0798077583f, 0.756711721f},
-std::array<float,2>{0.949533582f, 0.630777717f},
-std::array<float,2>{0.0774141252f, 0.105949439f},
-std::array<float,2>{0.648796499f, 0.27460292f},
-std::array<float,2>{0.476150692f, 0.795442045f},
-std::array<float,2>{0.61592555f, 0.97013545f},
-std::array<float,2>{0.329773247f, 0.390465617f},
-std::array<float,2>{0.840386033f, 0.13430503f},
-std::array<float,2>{0.189902455f, 0.547588468f},
-std::array<float,2>{0.768467128f, 0.85128212f},
-std::array<float,2>{0.139576063f, 0.353169352f},
-std::array<float,2>{0.535801589f, 0.0566564575f},
-std::array<float,2>{0.254883856f, 0.743166864f},
-std::array<float,2>{0.738192201f, 0.602426112f},
-std::array<float,2>{0.422694027f, 0.220320538f},
-std::array<float,2>{0.911193132f, 0.466941565f},
-std::array<float,2>{0.00701115467f, 0.897925377f},
-std::array<float,2>{0.870013535f, 0.520900488f},
-std::array<float,2>{0.234965265f, 0.165691525f},
-std::array<float,2>{0.587722659f, 0.42431581f},
-std::array<float,2>{0.372517675f, 0.961586297f},
-std::array<float,2>{0.668983459f, 0.772314608f},
-std::array<float,2>{0.453457355f, 0.286115408f},
-std::array<float,2>{0.996059775f, 0.0749056414f},
-std::array<float,2>{0.113629393f, 0.665311038f},
-std::array<float,2>{0.879622698f, 0.927352309f},
-std::array<float,2>{0.0462998003f, 0.499486685f},
-std::array<float,2>{0.709975719f, 0.199256346f},
-std::array<float,2>{0.391257763f, 0.581116974f},
-std::array<float,2>{0.523949921f, 0.688939869f},
-std::array<float,2>{0.309687406f, 0.00566679472f},
-std::array<float,2>{0.809772789f, 0.341783196f},
-std::array<float,2>{0.182261348f, 0.83165735f},
-std::array<float,2>{0.8336519f, 0.661425412f},
-std::array<float,2>{0.202731654f, 0.0694927946f},
-std::array<float,2>{0.624551713f, 0.290432751f},
-std::array<float,2>{0.338798344f, 0.781165481f},
-std::array<float,2>{0.646884203f, 0.959948003f},
-std::array<float,2>{0.480556458f, 0.435460627f},
-std::array<float,2>{0.945228398f, 0.158649996f},
-std::array<float,2>{0.0675666407f, 0.529184282f},
-std::array<float,2>{0.918568611f, 0.841670215f},
-std::array<float,2>{0.0132476911f, 0.333962679f},
-std::array<float,2>{0.74543649f, 0.00874029938f},
-std::array<float,2>{0.436576396f, 0.700008869f},
-std::array<float,2>{0.542383432f, 0.586806655f},
-std::array<float,2>{0.265418053f, 0.19065477f},
-std::array<float,2>{0.775638878f, 0.488270134f},
-std::array<float,2>{0.125209332f, 0.929898977f},
-std::array<float,2>{0.986980438f, 0.555907011f},
-std::array<float,2>{0.119025484f, 0.128047243f},
-std::array<float,2>{0.658072293f, 0.381005436f},
-std::array<float,2>{0.468512028f, 0.979244649f},
-std::array<float,2>{0.583005011f, 0.78669399f},
-std::array<float,2>{0.360276401f, 0.271072f},
-std::array<float,2>{0.865199029f, 0.0990598053f},
-std::array<float,2>{0.248098433f, 0.636658788f},
-std::array<float,2>{0.804383278f, 0.906244516f},
-std::array<float,2>{0.176695094f, 0.454524994f},
-std::array<float,2>{0.517796099f, 0.228849798f},
-std::array<float,2>{0.303172827f, 0.594569981f},
-std::array<float,2>{0.713623405f, 0.739430904f},
-std::array<float,2>{0.403023303f, 0.0477600507f},
-std::array<float,2>{0.883123875f, 0.348471016f},
-std::array<float,2>{0.0364040844f, 0.851813495f},
-std::array<float,2>{0.904851794f, 0.707312286f},
-std::array<float,2>{0.0609256327f, 0.0201432295f},
-std::array<float,2>{0.696939766f, 0.31674701f},
-std::array<float,2>{0.387102187f, 0.816867769f},
-std::array<float,2>{0.503900528f, 0.915134549f},
-std::array<float,2>{0.286427379f, 0.482077897f},
-std::array<float,2>{0.796681046f, 0.212571695f},
-std::array<float,2>{0.158452749f, 0.563342571f},
-std::array<float,2>{0.848932505f, 0.759889364f},
-std::array<float,2>{0.231636897f, 0.300199658f},
-std::array<float,2>{0.567813039f, 0.0850088894f},
-std::array<float,2>{0.35656935f, 0.686863065f},
-std::array<float,2>{0.677444458f, 0.506449223f},
-std::array<float,2>{0.439887434f, 0.180272803f},
-std::array<float,2>{0.981464207f, 0.417270809f},
-std::array<float,2>{0.108639635f, 0.951479256f},
-std::array<float,2>{0.756152153f, 0.617315531f},
-std::array<float,2>{0.147515416f, 0.24934043f},
-std::array<float,2>{0.559186816f, 0.439831495f},
-std::array<float,2>{0.274758995f, 0.885867596f},
-std::array<float,2>{0.72798425f, 0.872488618f},
-std::array<float,2>{0.413838685f, 0.362134278f},
-std::array<float,2>{0.929220796f, 0.0463281609f},
-std::array<float,2>{0.0193746295f, 0.723060548f},
-std::array<float,2>{0.960651278f, 0.985975444f},
-std::array<float,2>{0.0907763243f, 0.402128875f},
-std::array<float,2>{0.639814019f, 0.147004306f},
-std::array<float,2>{0.499307007f, 0.540078521f},
-std::array<float,2>{0.601675808f, 0.650482535f},
-std::array<float,2>{0.321767777f, 0.113100871f},
-std::array<float,2>{0.826935291f, 0.256335109f},
-std::array<float,2>{0.213064313f, 0.805117786f},
-std::array<float,2>{0.778564572f, 0.64145422f},
-std::array<float,2>{0.131435484f, 0.117927335f},
-std::array<float,2>{0.544680238f, 0.258910984f},
-std::array<float,2>{0.260205507f, 0.801528454f},
-std::array<float,2>{0.747934282f, 0.994058549f},
-std::array<float,2>{0.433413178f, 0.395248473f},
-std::array<float,2>{0.916578293f, 0.153880015f},
-std::array<float,2>{0.00833699666f, 0.53572464f},
-std::array<float,2>{0.93821919f, 0.863580346f},
-std::array<float,2>{0.0652863532f, 0.36936903f},
-std::array<float,2>{0.643592954f, 0.034117274f},
-std::array<float,2>{0.478648871f, 0.729703605f},
-std::array<float,2>{0.618713915f, 0.611969054f},
-std::array<float,2>{0.341590464f, 0.235146269f},
-std::array<float,2>{0.831268907f, 0.451843947f},
-std::array<float,2>{0.195795044f, 0.88095963f},
-std::array<float,2>{0.889555991f, 0.514721453f},
-std::array<float,2>{0.0316411592f, 0.172863215f},
-std::array<float,2>{0.715806186f, 0.407860219f},
-std::array<float,2>{0.401151925f, 0.941571772f},
-std::array<float,2>{0.523237586f, 0.750690758f},
-std::array<float,2>{0.297238678f, 0.308191091f},
-std::array<float,2>{0.80061537f, 0.0865672082f},
-std::array<float,2>{0.174588099f, 0.679195344f},
-std::array<float,2>{0.862462401f, 0.912473381f},
-std::array<float,2>{0.243512377f, 0.473208368f},
-std::array<float,2>{0.57847327f, 0.205347806f},
-std::array<float,2>{0.36489442f, 0.574136317f},
-std::array<float,2>{0.661123335f, 0.715521336f},
-std::array<float,2>{0.461667567f, 0.0296843182f},
-std::array<float,2>{0.990441561f, 0.325167298f},
-std::array<float,2>{0.122228287f, 0.821804702f},
-std::array<float,2>{0.976774216f, 0.748976171f},
-std::array<float,2>{0.104729734f, 0.0587886795f},
-std::array<float,2>{0.675262928f, 0.358870864f},
-std::array<float,2>{0.442283332f, 0.84729737f},
-std::array<float,2>{0.565240622f, 0.893011987f},
-std::array<float,2>{0.353844464f, 0.46304521f},
-std::array<float,2>{0.84537065f, 0.223908231f},
-std::array<float,2>{0.228270039f, 0.607944548f},
-std::array<float,2>{0.790770411f, 0.792841434f},
-std::array<float,2>{0.161493763f, 0.279936612f},
-std::array<float,2>{0.505773485f, 0.104828238f},
-std::array<float,2>{0.281412572f, 0.625808716f},
-std::array<float,2>{0.700683773f, 0.552456558f},
-std::array<float,2>{0.385075986f, 0.139396295f},
-std::array<float,2>{0.898855746f, 0.383582652f},
-std::array<float,2>{0.0565317459f, 0.973349214f},
-std::array<float,2>{0.822373331f, 0.585019946f},
-std::array<float,2>{0.217207134f, 0.198149413f},
-std::array<float,2>{0.606450438f, 0.493232012f},
-std::array<float,2>{0.326585203f, 0.921890914f},
-std::array<float,2>{0.634510815f, 0.835912168f},
-std::array<float,2>{0.495515257f, 0.338905126f},
-std::array<float,2>{0.954132736f, 0.000629651302f},
-std::array<float,2>{0.0860459954f, 0.693788588f},
-std::array<float,2>{0.922549725f, 0.965371609f},
-std::array<float,2>{0.0230024289f, 0.42711845f},
-std::array<float,2>{0.73427397f, 0.170106798f},
-std::array<float,2>{0.408303499f, 0.517791629f},
-std::array<float,2>{0.556020617f, 0.670095146f},
-std::array<float,2>{0.279690623f, 0.0717313886f},
-std::array<float,2>{0.751568794f, 0.284729511f},
-std::array<float,2>{0.143513635f, 0.765678227f},
-std::array<float,2>{0.857230067f, 0.697166085f},
-std::array<float,2>{0.222629502f, 0.0144239627f},
-std::array<float,2>{0.574286282f, 0.33036229f},
-std::array<float,2>{0.346681058f, 0.839827716f},
-std::array<float,2>{0.683386385f, 0.933973908f},
-std::array<float,2>{0.445568204f, 0.489519775f},
-std::array<float,2>{0.97474575f, 0.192213103f},
-std::array<float,2>{0.094997108f, 0.591883123f},
-std::array<float,2>{0.897122145f, 0.77425456f},
-std::array<float,2>{0.0513423942f, 0.296183854f},
-std::array<float,2>{0.691975176f, 0.065202184f},
-std::array<float,2>{0.380891144f, 0.657488823f},
-std::array<float,2>{0.512023032f, 0.525713027f},
-std::array<float,2>{0.290821671f, 0.161927611f},
-std::array<float,2>{0.782609224f, 0.433266968f},
-std::array<float,2>{0.167636648f, 0.955920458f},
-std::array<float,2>{0.968708754f, 0.599315882f},
-std::array<float,2>{0.0843069404f, 0.230942875f},
-std::array<float,2>{0.626711011f, 0.457747847f},
-std::array<float,2>{0.484656543f, 0.898674548f},
-std::array<float,2>{0.594293594f, 0.858341813f},
-std::array<float,2>{0.318438679f, 0.3440772f},
-std::array<float,2>{0.817881346f, 0.0544874519f},
-std::array<float,2>{0.205230445f, 0.735380471f},
-std::array<float,2>{0.764766037f, 0.982273281f},
-std::array<float,2>{0.152792364f, 0.376214474f},
-std::array<float,2>{0.551982105f, 0.132326782f},
-std::array<float,2>{0.272913277f, 0.560913682f},
-std::array<float,2>{0.724542677f, 0.637484014f},
-std::array<float,2>{0.416334867f, 0.0952995196f},
-std::array<float,2>{0.929874897f, 0.26804933f},
-std::array<float,2>{0.0235173907f, 0.783000827f},
-std::array<float,2>{0.907844961f, 0.682362854f},
-std::array<float,2>{0.00190411997f, 0.0817099959f},
-std::array<float,2>{0.738817811f, 0.303442448f},
-std::array<float,2>{0.428494662f, 0.763245225f},
-std::array<float,2>{0.533233941f, 0.947363675f},
-std::array<float,2>{0.250983924f, 0.421016544f},
-std::array<float,2>{0.770316601f, 0.18451333f},
-std::array<float,2>{0.136608154f, 0.502104461f},
-std::array<float,2>{0.836132467f, 0.813168764f},
-std::array<float,2>{0.193451494f, 0.316010952f},
-std::array<float,2>{0.612970114f, 0.0175787285f},
-std::array<float,2>{0.332169414f, 0.706699669f},
-std::array<float,2>{0.653651834f, 0.56845355f},
-std::array<float,2>{0.472336769f, 0.215151593f},
-std::array<float,2>{0.947901726f, 0.47836864f},
-std::array<float,2>{0.0737245306f, 0.91798985f},
-std::array<float,2>{0.806777239f, 0.54504925f},
-std::array<float,2>{0.184277773f, 0.14321214f},
-std::array<float,2>{0.530869067f, 0.405200541f},
-std::array<float,2>{0.304823607f, 0.991351902f},
-std::array<float,2>{0.705412567f, 0.81064564f},
-std::array<float,2>{0.395965546f, 0.251454413f},
-std::array<float,2>{0.876551986f, 0.11680387f},
-std::array<float,2>{0.0417830497f, 0.65412879f},
-std::array<float,2>{0.996640384f, 0.887283802f},
-std::array<float,2>{0.112272017f, 0.443913519f},
-std::array<float,2>{0.665506721f, 0.242229119f},
-std::array<float,2>{0.459275097f, 0.623657346f},
-std::array<float,2>{0.591704607f, 0.720925272f},
-std::array<float,2>{0.367561609f, 0.0423885994f},
-std::array<float,2>{0.872053087f, 0.364589751f},
-std::array<float,2>{0.241600335f, 0.867469788f},
-std::array<float,2>{0.760492504f, 0.712284625f},
-std::array<float,2>{0.14960137f, 0.02656921f},
-std::array<float,2>{0.548722863f, 0.321330518f},
-std::array<float,2>{0.267795235f, 0.827147961f},
-std::array<float,2>{0.718851686f, 0.907917857f},
-std::array<float,2>{0.420546114f, 0.47048074f},
-std::array<float,2>{0.935529768f, 0.210736707f},
-std::array<float,2>{0.0300070494f, 0.575619221f},
-std::array<float,2>{0.961513996f, 0.754088998f},
-std::array<float,2>{0.0813640803f, 0.311648935f},
-std::array<float,2>{0.631575584f, 0.0922486261f},
-std::array<float,2>{0.49092406f, 0.67469877f},
-std::array<float,2>{0.599033296f, 0.509657323f},
-std::array<float,2>{0.315216243f, 0.177800834f},
-std::array<float,2>{0.815895617f, 0.411474109f},
-std::array<float,2>{0.208056167f, 0.940119982f},
-std::array<float,2>{0.890983403f, 0.613588572f},
-std::array<float,2>{0.0507477447f, 0.240798339f},
-std::array<float,2>{0.690316379f, 0.445326507f},
-std::array<float,2>{0.377100915f, 0.875113666f},
-std::array<float,2>{0.508166909f, 0.859526157f},
-std::array<float,2>{0.295826852f, 0.372474641f},
-std::array<float,2>{0.786893249f, 0.0387548581f},
-std::array<float,2>{0.171609744f, 0.730476379f},
-std::array<float,2>{0.855278552f, 0.998786926f},
-std::array<float,2>{0.225420475f, 0.392994553f},
-std::array<float,2>{0.570777595f, 0.148587018f},
-std::array<float,2>{0.350890785f, 0.533941507f},
-std::array<float,2>{0.684378922f, 0.646236539f},
-std::array<float,2>{0.452578515f, 0.12281435f},
-std::array<float,2>{0.971443534f, 0.263102442f},
-std::array<float,2>{0.0984175801f, 0.79895103f},
-std::array<float,2>{0.992807388f, 0.667488992f},
-std::array<float,2>{0.116765365f, 0.0770058036f},
-std::array<float,2>{0.671234787f, 0.288851202f},
-std::array<float,2>{0.455714017f, 0.769535303f},
-std::array<float,2>{0.588256299f, 0.963202536f},
-std::array<float,2>{0.374396801f, 0.423602164f},
-std::array<float,2>{0.868418634f, 0.167667463f},
-std::array<float,2>{0.236843854f, 0.521929264f},
-std::array<float,2>{0.810721874f, 0.829253972f},
-std::array<float,2>{0.180827752f, 0.342101395f},
-std::array<float,2>{0.52667141f, 0.00778737105f},
-std::array<float,2>{0.312341541f, 0.689459622f},
-std::array<float,2>{0.707647443f, 0.579264939f},
-std::array<float,2>{0.394244045f, 0.202000484f},
-std::array<float,2>{0.881189823f, 0.496664912f},
-std::array<float,2>{0.0432031341f, 0.929089785f},
-std::array<float,2>{0.842642605f, 0.550311863f},
-std::array<float,2>{0.189220592f, 0.135838091f},
-std::array<float,2>{0.614253104f, 0.387835205f},
-std::array<float,2>{0.330568701f, 0.971269548f},
-std::array<float,2>{0.651710153f, 0.794835567f},
-std::array<float,2>{0.473490238f, 0.277016968f},
-std::array<float,2>{0.952694833f, 0.109049194f},
-std::array<float,2>{0.07611496f, 0.630961895f},
-std::array<float,2>{0.913735211f, 0.895146191f},
-std::array<float,2>{0.00518681901f, 0.466659784f},
-std::array<float,2>{0.735415578f, 0.22201021f},
-std::array<float,2>{0.424833417f, 0.605031729f},
-std::array<float,2>{0.538563013f, 0.745817184f},
-std::array<float,2>{0.257761002f, 0.0554925352f},
-std::array<float,2>{0.766222477f, 0.354040384f},
-std::array<float,2>{0.137614176f, 0.848683298f},
-std::array<float,2>{0.865326524f, 0.634145319f},
-std::array<float,2>{0.246878535f, 0.100749291f},
-std::array<float,2>{0.584613383f, 0.273375511f},
-std::array<float,2>{0.363159865f, 0.787948728f},
-std::array<float,2>{0.658235729f, 0.976635277f},
-std::array<float,2>{0.466446996f, 0.379104942f},
-std::array<float,2>{0.984464347f, 0.126705572f},
-std::array<float,2>{0.119221754f, 0.558390975f},
-std::array<float,2>{0.886319101f, 0.855048001f},
-std::array<float,2>{0.0389009044f, 0.350781143f},
-std::array<float,2>{0.711696267f, 0.0493411124f},
-std::array<float,2>{0.405755639f, 0.74189955f},
-std::array<float,2>{0.515645266f, 0.597498834f},
-std::array<float,2>{0.30158329f, 0.226587161f},
-std::array<float,2>{0.800877512f, 0.456982195f},
-std::array<float,2>{0.179666966f, 0.903657496f},
-std::array<float,2>{0.94296813f, 0.529581845f},
-std::array<float,2>{0.0690179765f, 0.156813547f},
-std::array<float,2>{0.64532572f, 0.436489314f},
-std::array<float,2>{0.484017849f, 0.957839787f},
-std::array<float,2>{0.621135831f, 0.777767062f},
-std::array<float,2>{0.337585866f, 0.292114615f},
-std::array<float,2>{0.835627675f, 0.0675508976f},
-std::array<float,2>{0.199562401f, 0.66322571f},
-std::array<float,2>{0.774303079f, 0.932927251f},
-std::array<float,2>{0.127413169f, 0.484971851f},
-std::array<float,2>{0.540157974f, 0.187653422f},
-std::array<float,2>{0.26186198f, 0.58975774f},
-std::array<float,2>{0.74351728f, 0.702001512f},
-std::array<float,2>{0.434565276f, 0.0102238953f},
-std::array<float,2>{0.92166692f, 0.335650384f},
-std::array<float,2>{0.0153315691f, 0.842728078f},
-std::array<float,2>{0.926333725f, 0.725886703f},
-std::array<float,2>{0.0158316139f, 0.044198297f},
-std::array<float,2>{0.729090512f, 0.359710127f},
-std::array<float,2>{0.411695391f, 0.874526799f},
-std::array<float,2>{0.560732305f, 0.884490907f},
-std::array<float,2>{0.275710911f, 0.438459247f},
-std::array<float,2>{0.755512714f, 0.246299788f},
-std::array<float,2>{0.145512372f, 0.620211244f},
-std::array<float,2>{0.824361444f, 0.808390796f},
-std::array<float,2>{0.211109847f, 0.254522443f},
-std::array<float,2>{0.60374552f, 0.110058494f},
-std::array<float,2>{0.323688805f, 0.650012612f},
-std::array<float,2>{0.638517916f, 0.541747451f},
-std::array<float,2>{0.496988684f, 0.144813657f},
-std::array<float,2>{0.958797574f, 0.399359018f},
-std::array<float,2>{0.0918865204f, 0.988163829f},
-std::array<float,2>{0.793661416f, 0.5645594f},
-std::array<float,2>{0.157900199f, 0.213456288f},
-std::array<float,2>{0.500070512f, 0.484271139f},
-std::array<float,2>{0.287912399f, 0.916393399f},
-std::array<float,2>{0.697328329f, 0.818841875f},
-std::array<float,2>{0.389345765f, 0.318439841f},
-std::array<float,2>{0.903554976f, 0.0229927897f},
-std::array<float,2>{0.0598900728f, 0.709112465f},
-std::array<float,2>{0.983426154f, 0.95054847f},
-std::array<float,2>{0.10562396f, 0.414680034f},
-std::array<float,2>{0.67859f, 0.182782531f},
-std::array<float,2>{0.438664585f, 0.504716933f},
-std::array<float,2>{0.568543375f, 0.68439579f},
-std::array<float,2>{0.357746929f, 0.0838744193f},
-std::array<float,2>{0.849690735f, 0.296953112f},
-std::array<float,2>{0.232960492f, 0.759746552f},
-std::array<float,2>{0.798189342f, 0.676446915f},
-std::array<float,2>{0.172284916f, 0.0881423727f},
-std::array<float,2>{0.519575179f, 0.305928767f},
-std::array<float,2>{0.299087971f, 0.753880203f},
-std::array<float,2>{0.717802882f, 0.943457961f},
-std::array<float,2>{0.398987174f, 0.409941345f},
-std::array<float,2>{0.887552559f, 0.174133211f},
-std::array<float,2>{0.0332361162f, 0.512775719f},
-std::array<float,2>{0.989076853f, 0.82392168f},
-std::array<float,2>{0.123488627f, 0.326431602f},
-std::array<float,2>{0.662879527f, 0.0276665315f},
-std::array<float,2>{0.462939024f, 0.717069924f},
-std::array<float,2>{0.580553651f, 0.571752489f},
-std::array<float,2>{0.366280735f, 0.20409447f},
-std::array<float,2>{0.86130172f, 0.476552606f},
-std::array<float,2>{0.245919019f, 0.911734462f},
-std::array<float,2>{0.9155671f, 0.537802219f},
-std::array<float,2>{0.0102277678f, 0.155696303f},
-std::array<float,2>{0.749280095f, 0.397848457f},
-std::array<float,2>{0.430442244f, 0.995786726f},
-std::array<float,2>{0.546692312f, 0.80360955f},
-std::array<float,2>{0.258940935f, 0.261406511f},
-std::array<float,2>{0.780803382f, 0.119426697f},
-std::array<float,2>{0.129793599f, 0.643697083f},
-std::array<float,2>{0.828177512f, 0.880782664f},
-std::array<float,2>{0.198223829f, 0.450040907f},
-std::array<float,2>{0.620255709f, 0.236948207f},
-std::array<float,2>{0.342495054f, 0.610061228f},
-std::array<float,2>{0.641172051f, 0.72843951f},
-std::array<float,2>{0.477852315f, 0.0316596255f},
-std::array<float,2>{0.940798104f, 0.368120521f},
-std::array<float,2>{0.0634560958f, 0.865701616f},
-std::array<float,2>{0.956592739f, 0.692103267f},
-std::array<float,2>{0.0886464342f, 0.00353819365f},
-std::array<float,2>{0.636356592f, 0.337323993f},
-std::array<float,2>{0.493793845f, 0.832133412f},
-std::array<float,2>{0.60804975f, 0.924295604f},
-std::array<float,2>{0.325201094f, 0.495314151f},
-std::array<float,2>{0.820478082f, 0.196272492f},
-std::array<float,2>{0.215370879f, 0.583516717f},
-std::array<float,2>{0.753745317f, 0.768084705f},
-std::array<float,2>{0.142176345f, 0.281509459f},
-std::array<float,2>{0.558370829f, 0.0728508756f},
-std::array<float,2>{0.278964221f, 0.66860342f},
-std::array<float,2>{0.731774509f, 0.517146349f},
-std::array<float,2>{0.407785147f, 0.169380754f},
-std::array<float,2>{0.924702108f, 0.42874667f},
-std::array<float,2>{0.0198861975f, 0.967807055f},
-std::array<float,2>{0.845779657f, 0.605631948f},
-std::array<float,2>{0.229349717f, 0.226175874f},
-std::array<float,2>{0.564245343f, 0.462315381f},
-std::array<float,2>{0.352357447f, 0.891510069f},
-std::array<float,2>{0.671984971f, 0.844442189f},
-std::array<float,2>{0.445035487f, 0.356100082f},
-std::array<float,2>{0.97868073f, 0.0624363273f},
-std::array<float,2>{0.102333903f, 0.747927248f},
-std::array<float,2>{0.901117504f, 0.976269603f},
-std::array<float,2>{0.0577857271f, 0.385761619f},
-std::array<float,2>{0.701833308f, 0.137438446f},
-std::array<float,2>{0.384239167f, 0.554358304f},
-std::array<float,2>{0.50754106f, 0.627488911f},
-std::array<float,2>{0.28496626f, 0.101808935f},
-std::array<float,2>{0.792513788f, 0.277899057f},
-std::array<float,2>{0.163642421f, 0.789868772f},
-std::array<float,2>{0.818499804f, 0.736464918f},
-std::array<float,2>{0.204745635f, 0.0526212528f},
-std::array<float,2>{0.597279847f, 0.346113861f},
-std::array<float,2>{0.318131864f, 0.856397331f},
-std::array<float,2>{0.627367795f, 0.900492787f},
-std::array<float,2>{0.487573981f, 0.460256696f},
-std::array<float,2>{0.966241717f, 0.234360009f},
-std::array<float,2>{0.0834263042f, 0.600900054f},
-std::array<float,2>{0.933306694f, 0.784598053f},
-std::array<float,2>{0.0259974711f, 0.266260356f},
-std::array<float,2>{0.726276517f, 0.0971141085f},
-std::array<float,2>{0.415678471f, 0.640618622f},
-std::array<float,2>{0.554145277f, 0.558919907f},
-std::array<float,2>{0.27068463f, 0.130592719f},
-std::array<float,2>{0.762526512f, 0.37706998f},
-std::array<float,2>{0.155921549f, 0.983055294f},
-std::array<float,2>{0.974568069f, 0.591761649f},
-std::array<float,2>{0.096797213f, 0.194148779f},
-std::array<float,2>{0.679870248f, 0.491525531f},
-std::array<float,2>{0.448683172f, 0.937143505f},
-std::array<float,2>{0.578039944f, 0.837521553f},
-std::array<float,2>{0.345168978f, 0.329969615f},
-std::array<float,2>{0.858100176f, 0.013285405f},
-std::array<float,2>{0.220399216f, 0.697563469f},
-std::array<float,2>{0.784049928f, 0.954312146f},
-std::array<float,2>{0.164114952f, 0.43107295f},
-std::array<float,2>{0.514769971f, 0.163735136f},
-std::array<float,2>{0.2912018f, 0.523818374f},
-std::array<float,2>{0.694715023f, 0.659173489f},
-std::array<float,2>{0.379868716f, 0.0641907826f},
-std::array<float,2>{0.896039486f, 0.293104619f},
-std::array<float,2>{0.0546685085f, 0.776037574f},
-std::array<float,2>{0.878382444f, 0.655437231f},
-std::array<float,2>{0.0399301797f, 0.11357297f},
-std::array<float,2>{0.703538001f, 0.253811121f},
-std::array<float,2>{0.397400975f, 0.810030758f},
-std::array<float,2>{0.528864324f, 0.989830196f},
-std::array<float,2>{0.307909518f, 0.403782964f},
-std::array<float,2>{0.806196272f, 0.141910523f},
-std::array<float,2>{0.187211275f, 0.544356585f},
-std::array<float,2>{0.873082161f, 0.870416224f},
-std::array<float,2>{0.23999618f, 0.366574645f},
-std::array<float,2>{0.593200445f, 0.0394632556f},
-std::array<float,2>{0.370451212f, 0.719165742f},
-std::array<float,2>{0.666339278f, 0.622582614f},
-std::array<float,2>{0.458483249f, 0.244297892f},
-std::array<float,2>{0.99815625f, 0.441591412f},
-std::array<float,2>{0.110424064f, 0.890186429f},
-std::array<float,2>{0.772939384f, 0.501656115f},
-std::array<float,2>{0.133034438f, 0.187489688f},
-std::array<float,2>{0.531444311f, 0.419624269f},
-std::array<float,2>{0.25289315f, 0.946004987f},
-std::array<float,2>{0.741658032f, 0.76377207f},
-std::array<float,2>{0.427608669f, 0.301725745f},
-std::array<float,2>{0.909853756f, 0.078491509f},
-std::array<float,2>{0.00283175148f, 0.680081487f},
-std::array<float,2>{0.945556045f, 0.92062372f},
-std::array<float,2>{0.070901826f, 0.478843987f},
-std::array<float,2>{0.654367507f, 0.217316642f},
-std::array<float,2>{0.469686061f, 0.566510499f},
-std::array<float,2>{0.610095978f, 0.703759909f},
-std::array<float,2>{0.334602445f, 0.0173913464f},
-std::array<float,2>{0.839793622f, 0.313443661f},
-std::array<float,2>{0.191933602f, 0.814549565f},
-std::array<float,2>{0.7672351f, 0.742760599f},
-std::array<float,2>{0.138339981f, 0.0576885119f},
-std::array<float,2>{0.5374493f, 0.352220118f},
-std::array<float,2>{0.25647825f, 0.849962413f},
-std::array<float,2>{0.734668672f, 0.897294164f},
-std::array<float,2>{0.424602985f, 0.468267024f},
-std::array<float,2>{0.912338436f, 0.219436198f},
-std::array<float,2>{0.00422486477f, 0.603435516f},
-std::array<float,2>{0.951237977f, 0.795996964f},
-std::array<float,2>{0.0749464929f, 0.273972034f},
-std::array<float,2>{0.651133657f, 0.106722198f},
-std::array<float,2>{0.473906726f, 0.629858196f},
-std::array<float,2>{0.614581108f, 0.547997534f},
-std::array<float,2>{0.33122322f, 0.133237183f},
-std::array<float,2>{0.842788339f, 0.389278203f},
-std::array<float,2>{0.188329101f, 0.969564438f},
-std::array<float,2>{0.882560253f, 0.580100834f},
-std::array<float,2>{0.0444220677f, 0.20023638f},
-std::array<float,2>{0.708314478f, 0.498102576f},
-std::array<float,2>{0.392752022f, 0.925832331f},
-std::array<float,2>{0.525991082f, 0.830888033f},
-std::array<float,2>{0.311199516f, 0.34035328f},
-std::array<float,2>{0.8118729f, 0.00481226388f},
-std::array<float,2>{0.180424795f, 0.687624633f},
-std::array<float,2>{0.867678046f, 0.962581217f},
-std::array<float,2>{0.237594962f, 0.42544657f},
-std::array<float,2>{0.589096725f, 0.165020555f},
-std::array<float,2>{0.373698592f, 0.52026844f},
-std::array<float,2>{0.670013011f, 0.664110839f},
-std::array<float,2>{0.456504613f, 0.0759693459f},
-std::array<float,2>{0.993498385f, 0.286578119f},
-std::array<float,2>{0.115867294f, 0.77293849f},
-std::array<float,2>{0.972439468f, 0.647683918f},
-std::array<float,2>{0.0988829508f, 0.124570556f},
-std::array<float,2>{0.68521142f, 0.265491843f},
-std::array<float,2>{0.451412708f, 0.798307121f},
-std::array<float,2>{0.572218895f, 0.997465193f},
-std::array<float,2>{0.349883586f, 0.391795158f},
-std::array<float,2>{0.85395515f, 0.151200339f},
-std::array<float,2>{0.225896612f, 0.533157289f},
-std::array<float,2>{0.786108077f, 0.861634791f},
-std::array<float,2>{0.170615867f, 0.374092251f},
-std::array<float,2>{0.508903086f, 0.0370572247f},
-std::array<float,2>{0.296697944f, 0.732805133f},
-std::array<float,2>{0.690861225f, 0.616276443f},
-std::array<float,2>{0.378038317f, 0.238827124f},
-std::array<float,2>{0.891985059f, 0.447633773f},
-std::array<float,2>{0.0495107435f, 0.877365232f},
-std::array<float,2>{0.815122902f, 0.511001527f},
-std::array<float,2>{0.2079712f, 0.1770394f},
-std::array<float,2>{0.59770453f, 0.413869351f},
-std::array<float,2>{0.315472543f, 0.938326061f},
-std::array<float,2>{0.632759392f, 0.757284164f},
-std::array<float,2>{0.49183017f, 0.310066044f},
-std::array<float,2>{0.961986363f, 0.0902534872f},
-std::array<float,2>{0.0806726515f, 0.67260766f},
-std::array<float,2>{0.934525609f, 0.909331441f},
-std::array<float,2>{0.0306887887f, 0.472175062f},
-std::array<float,2>{0.720077813f, 0.208329171f},
-std::array<float,2>{0.421818405f, 0.576817274f},
-std::array<float,2>{0.547124863f, 0.713694751f},
-std::array<float,2>{0.269510001f, 0.0253489446f},
-std::array<float,2>{0.761020243f, 0.323481202f},
-std::array<float,2>{0.149251655f, 0.825944901f},
-std::array<float,2>{0.850921929f, 0.685818195f},
-std::array<float,2>{0.233671188f, 0.0847080648f},
-std::array<float,2>{0.569783092f, 0.29960832f},
-std::array<float,2>{0.358442307f, 0.761295259f},
-std::array<float,2>{0.679224312f, 0.952689707f},
-std::array<float,2>{0.438427746f, 0.416374564f},
-std::array<float,2>{0.982940316f, 0.18130666f},
-std::array<float,2>{0.106633857f, 0.507097483f},
-std::array<float,2>{0.902539611f, 0.817401648f},
-std::array<float,2>{0.0587275065f, 0.317500919f},
-std::array<float,2>{0.698919058f, 0.021439096f},
-std::array<float,2>{0.389855772f, 0.708952069f},
-std::array<float,2>{0.501902938f, 0.563977838f},
-std::array<float,2>{0.28832376f, 0.211331859f},
-std::array<float,2>{0.794559896f, 0.480576605f},
-std::array<float,2>{0.156535938f, 0.914491832f},
-std::array<float,2>{0.957848787f, 0.539113104f},
-std::array<float,2>{0.0936946198f, 0.148317888f},
-std::array<float,2>{0.63744688f, 0.400437832f},
-std::array<float,2>{0.497409403f, 0.985064149f},
-std::array<float,2>{0.605149269f, 0.806479692f},
-std::array<float,2>{0.322424501f, 0.256950617f},
-std::array<float,2>{0.826104999f, 0.111995362f},
-std::array<float,2>{0.212183222f, 0.651808023f},
-std::array<float,2>{0.754517734f, 0.8856951f},
-std::array<float,2>{0.145133778f, 0.441085786f},
-std::array<float,2>{0.561617553f, 0.249012396f},
-std::array<float,2>{0.277087629f, 0.618914247f},
-std::array<float,2>{0.72958076f, 0.723692119f},
-std::array<float,2>{0.410711318f, 0.0455825739f},
-std::array<float,2>{0.927535474f, 0.362480462f},
-std::array<float,2>{0.0170043036f, 0.871264577f},
-std::array<float,2>{0.920583546f, 0.700830102f},
-std::array<float,2>{0.0139887342f, 0.00932092685f},
-std::array<float,2>{0.742240429f, 0.332122773f},
-std::array<float,2>{0.434777379f, 0.839928329f},
-std::array<float,2>{0.539576232f, 0.931196153f},
-std::array<float,2>{0.263012856f, 0.487237513f},
-std::array<float,2>{0.774807572f, 0.189611405f},
-std::array<float,2>{0.128735438f, 0.587472141f},
-std::array<float,2>{0.83407712f, 0.779465854f},
-std::array<float,2>{0.200934723f, 0.289376169f},
-std::array<float,2>{0.622729123f, 0.0692401826f},
-std::array<float,2>{0.336456448f, 0.660820186f},
-std::array<float,2>{0.64616698f, 0.527606487f},
-std::array<float,2>{0.483020633f, 0.159860432f},
-std::array<float,2>{0.942322373f, 0.434052289f},
-std::array<float,2>{0.0702505931f, 0.96074152f},
-std::array<float,2>{0.802667558f, 0.594988465f},
-std::array<float,2>{0.177843422f, 0.230117634f},
-std::array<float,2>{0.517151415f, 0.45387581f},
-std::array<float,2>{0.301810861f, 0.904916763f},
-std::array<float,2>{0.712154925f, 0.853079975f},
-std::array<float,2>{0.404632747f, 0.348732799f},
-std::array<float,2>{0.885685802f, 0.0483166613f},
-std::array<float,2>{0.0375115573f, 0.739077628f},
-std::array<float,2>{0.986244977f, 0.97977072f},
-std::array<float,2>{0.120406918f, 0.38243717f},
-std::array<float,2>{0.660051644f, 0.12705566f},
-std::array<float,2>{0.465310156f, 0.55565834f},
-std::array<float,2>{0.585082948f, 0.635259211f},
-std::array<float,2>{0.361963779f, 0.098507002f},
-std::array<float,2>{0.866442919f, 0.270069033f},
-std::array<float,2>{0.247143969f, 0.785600305f},
-std::array<float,2>{0.791605949f, 0.626618445f},
-std::array<float,2>{0.163061023f, 0.104275525f},
-std::array<float,2>{0.506695211f, 0.280413032f},
-std::array<float,2>{0.283256233f, 0.791652262f},
-std::array<float,2>{0.702564001f, 0.973974586f},
-std::array<float,2>{0.383050501f, 0.384258032f},
-std::array<float,2>{0.901505172f, 0.140411586f},
-std::array<float,2>{0.0575620048f, 0.551075935f},
-std::array<float,2>{0.980145454f, 0.846595168f},
-std::array<float,2>{0.102826051f, 0.35766077f},
-std::array<float,2>{0.672983587f, 0.0600446723f},
-std::array<float,2>{0.444268435f, 0.749823093f},
-std::array<float,2>{0.56261009f, 0.608481824f},
-std::array<float,2>{0.353097469f, 0.223095492f},
-std::array<float,2>{0.847537696f, 0.464106262f},
-std::array<float,2>{0.230041727f, 0.893793643f},
-std::array<float,2>{0.924962521f, 0.518738031f},
-std::array<float,2>{0.0210670568f, 0.171110034f},
-std::array<float,2>{0.731198847f, 0.426247716f},
-std::array<float,2>{0.407013685f, 0.966091156f},
-std::array<float,2>{0.55669719f, 0.767476559f},
-std::array<float,2>{0.277371913f, 0.284142733f},
-std::array<float,2>{0.752453923f, 0.0705394819f},
-std::array<float,2>{0.14137058f, 0.671282887f},
-std::array<float,2>{0.821683884f, 0.922877967f},
-std::array<float,2>{0.216765687f, 0.49304986f},
-std::array<float,2>{0.609043181f, 0.198525071f},
-std::array<float,2>{0.324787825f, 0.584065855f},
-std::array<float,2>{0.635667682f, 0.694573641f},
-std::array<float,2>{0.492405802f, 0.00152833888f},
-std::array<float,2>{0.95538944f, 0.338715136f},
-std::array<float,2>{0.0896261483f, 0.834785223f},
-std::array<float,2>{0.93998903f, 0.728556633f},
-std::array<float,2>{0.0641568899f, 0.0342368484f},
-std::array<float,2>{0.642069161f, 0.370446682f},
-std::array<float,2>{0.47742793f, 0.864294112f},
-std::array<float,2>{0.619790614f, 0.882030368f},
-std::array<float,2>{0.343056321f, 0.452249706f},
-std::array<float,2>{0.82965827f, 0.235616535f},
-std::array<float,2>{0.199017838f, 0.612787902f},
-std::array<float,2>{0.779693425f, 0.802529395f},
-std::array<float,2>{0.130304918f, 0.258087337f},
-std::array<float,2>{0.545326889f, 0.118266396f},
-std::array<float,2>{0.258051217f, 0.642574668f},
-std::array<float,2>{0.74811095f, 0.537026703f},
-std::array<float,2>{0.430710942f, 0.152696148f},
-std::array<float,2>{0.914824426f, 0.396331489f},
-std::array<float,2>{0.0115931928f, 0.99245739f},
-std::array<float,2>{0.860161364f, 0.573099136f},
-std::array<float,2>{0.244694799f, 0.206201613f},
-std::array<float,2>{0.581991315f, 0.474028617f},
-std::array<float,2>{0.366096586f, 0.913971663f},
-std::array<float,2>{0.663793921f, 0.821072221f},
-std::array<float,2>{0.463897347f, 0.326138586f},
-std::array<float,2>{0.990043581f, 0.0311545189f},
-std::array<float,2>{0.124665633f, 0.716224551f},
-std::array<float,2>{0.888478875f, 0.942795277f},
-std::array<float,2>{0.034896519f, 0.406484067f},
-std::array<float,2>{0.717520177f, 0.172542766f},
-std::array<float,2>{0.399590433f, 0.513746321f},
-std::array<float,2>{0.520944059f, 0.677865088f},
-std::array<float,2>{0.299828947f, 0.0876616538f},
-std::array<float,2>{0.797684073f, 0.306724608f},
-std::array<float,2>{0.173080832f, 0.751379251f},
-std::array<float,2>{0.837918699f, 0.705986381f},
-std::array<float,2>{0.19290252f, 0.0190536771f},
-std::array<float,2>{0.61097765f, 0.31449756f},
-std::array<float,2>{0.33574453f, 0.813776493f},
-std::array<float,2>{0.655538559f, 0.919355154f},
-std::array<float,2>{0.469802499f, 0.476855069f},
-std::array<float,2>{0.947109282f, 0.216233149f},
-std::array<float,2>{0.0715904757f, 0.570185423f},
-std::array<float,2>{0.90915978f, 0.762519479f},
-std::array<float,2>{0.00338126812f, 0.303957552f},
-std::array<float,2>{0.74073559f, 0.0809327066f},
-std::array<float,2>{0.426099986f, 0.682888031f},
-std::array<float,2>{0.532934189f, 0.503617048f},
-std::array<float,2>{0.253191501f, 0.185388848f},
-std::array<float,2>{0.772113025f, 0.420262516f},
-std::array<float,2>{0.133902416f, 0.948912382f},
-std::array<float,2>{0.999649465f, 0.624063849f},
-std::array<float,2>{0.110052235f, 0.244054094f},
-std::array<float,2>{0.667548001f, 0.444643646f},
-std::array<float,2>{0.457052916f, 0.8881253f},
-std::array<float,2>{0.592125773f, 0.868920028f},
-std::array<float,2>{0.3696509f, 0.364193708f},
-std::array<float,2>{0.874923229f, 0.0418575071f},
-std::array<float,2>{0.239039704f, 0.722456455f},
-std::array<float,2>{0.805214345f, 0.990480542f},
-std::array<float,2>{0.186393425f, 0.405838072f},
-std::array<float,2>{0.527971268f, 0.143614843f},
-std::array<float,2>{0.306718349f, 0.546008527f},
-std::array<float,2>{0.704950452f, 0.652348042f},
-std::array<float,2>{0.397862077f, 0.116047226f},
-std::array<float,2>{0.877574265f, 0.25039202f},
-std::array<float,2>{0.0409622826f, 0.812009394f},
-std::array<float,2>{0.895024657f, 0.656309485f},
-std::array<float,2>{0.0535739399f, 0.0663788915f},
-std::array<float,2>{0.694210947f, 0.29534936f},
-std::array<float,2>{0.380345255f, 0.775338292f},
-std::array<float,2>{0.514478683f, 0.956667781f},
-std::array<float,2>{0.29228127f, 0.431944847f},
-std::array<float,2>{0.784425497f, 0.160666555f},
-std::array<float,2>{0.16549997f, 0.526512504f},
-std::array<float,2>{0.859060228f, 0.838761866f},
-std::array<float,2>{0.219663903f, 0.331510276f},
-std::array<float,2>{0.577125371f, 0.0148968901f},
-std::array<float,2>{0.344604611f, 0.695746243f},
-std::array<float,2>{0.680893004f, 0.593571246f},
-std::array<float,2>{0.447673708f, 0.192927971f},
-std::array<float,2>{0.973038137f, 0.488439232f},
-std::array<float,2>{0.0965055972f, 0.934996068f},
-std::array<float,2>{0.763593972f, 0.561576128f},
-std::array<float,2>{0.155108124f, 0.131320208f},
-std::array<float,2>{0.552929878f, 0.37503621f},
-std::array<float,2>{0.269830555f, 0.981425405f},
-std::array<float,2>{0.725073218f, 0.782223105f},
-std::array<float,2>{0.414717764f, 0.269310564f},
-std::array<float,2>{0.93235606f, 0.0940608382f},
-std::array<float,2>{0.0270838253f, 0.638488948f},
-std::array<float,2>{0.965759277f, 0.899446368f},
-std::array<float,2>{0.0822776705f, 0.458095491f},
-std::array<float,2>{0.628075242f, 0.231667802f},
-std::array<float,2>{0.486822903f, 0.59781599f},
-std::array<float,2>{0.596563995f, 0.734539926f},
-std::array<float,2>{0.317137778f, 0.053101372f},
-std::array<float,2>{0.819950104f, 0.345467299f},
-std::array<float,2>{0.203965575f, 0.859320283f},
-std::array<float,2>{0.809349358f, 0.690630734f},
-std::array<float,2>{0.183066145f, 0.0060722027f},
-std::array<float,2>{0.524775803f, 0.343147993f},
-std::array<float,2>{0.308736533f, 0.829073131f},
-std::array<float,2>{0.709933341f, 0.928280294f},
-std::array<float,2>{0.391781837f, 0.497349828f},
-std::array<float,2>{0.880732298f, 0.202475309f},
-std::array<float,2>{0.045064114f, 0.578451276f},
-std::array<float,2>{0.994585752f, 0.770840347f},
-std::array<float,2>{0.114711411f, 0.287523687f},
-std::array<float,2>{0.668790281f, 0.0773512945f},
-std::array<float,2>{0.454902112f, 0.666770577f},
-std::array<float,2>{0.586639524f, 0.522897482f},
-std::array<float,2>{0.371659875f, 0.166021004f},
-std::array<float,2>{0.870241702f, 0.421925277f},
-std::array<float,2>{0.236150518f, 0.964623392f},
-std::array<float,2>{0.910782278f, 0.604285598f},
-std::array<float,2>{0.00598382531f, 0.221334502f},
-std::array<float,2>{0.736757815f, 0.465557337f},
-std::array<float,2>{0.422988057f, 0.895792246f},
-std::array<float,2>{0.536949992f, 0.847778022f},
-std::array<float,2>{0.254281372f, 0.35506472f},
-std::array<float,2>{0.768723786f, 0.056008555f},
-std::array<float,2>{0.140282974f, 0.74475193f},
-std::array<float,2>{0.84154135f, 0.972198308f},
-std::array<float,2>{0.190846086f, 0.387147576f},
-std::array<float,2>{0.616520643f, 0.135305658f},
-std::array<float,2>{0.328287154f, 0.54974997f},
-std::array<float,2>{0.650148332f, 0.632144153f},
-std::array<float,2>{0.475188375f, 0.108331591f},
-std::array<float,2>{0.951100469f, 0.275885612f},
-std::array<float,2>{0.0771481246f, 0.793325722f},
-std::array<float,2>{0.964697003f, 0.675296009f},
-std::array<float,2>{0.0788968503f, 0.0932961255f},
-std::array<float,2>{0.628997624f, 0.310559601f},
-std::array<float,2>{0.489986777f, 0.755285919f},
-std::array<float,2>{0.601263225f, 0.941151857f},
-std::array<float,2>{0.31268543f, 0.41024965f},
-std::array<float,2>{0.812573731f, 0.178911567f},
-std::array<float,2>{0.209316239f, 0.508207321f},
-std::array<float,2>{0.757988811f, 0.827318013f},
-std::array<float,2>{0.151829436f, 0.321183413f},
-std::array<float,2>{0.5498721f, 0.0261846595f},
-std::array<float,2>{0.267133534f, 0.71178335f},
-std::array<float,2>{0.721862316f, 0.574889421f},
-std::array<float,2>{0.419495404f, 0.209494621f},
-std::array<float,2>{0.936190367f, 0.469399512f},
-std::array<float,2>{0.0277720019f, 0.9072209f},
-std::array<float,2>{0.851993382f, 0.534189165f},
-std::array<float,2>{0.22320132f, 0.150336549f},
-std::array<float,2>{0.57403779f, 0.394171447f},
-std::array<float,2>{0.34954524f, 0.999459445f},
-std::array<float,2>{0.686848283f, 0.800437391f},
-std::array<float,2>{0.450640738f, 0.262288988f},
-std::array<float,2>{0.969949305f, 0.121648751f},
-std::array<float,2>{0.100702561f, 0.645330548f},
-std::array<float,2>{0.893352091f, 0.876389205f},
-std::array<float,2>{0.0476453006f, 0.446541816f},
-std::array<float,2>{0.688693881f, 0.241370544f},
-std::array<float,2>{0.375645548f, 0.614828885f},
-std::array<float,2>{0.509851396f, 0.732092798f},
-std::array<float,2>{0.293810159f, 0.0379300229f},
-std::array<float,2>{0.788206458f, 0.371740699f},
-std::array<float,2>{0.169653252f, 0.86069411f},
-std::array<float,2>{0.827272177f, 0.649337888f},
-std::array<float,2>{0.213926047f, 0.110740893f},
-std::array<float,2>{0.603146732f, 0.255367398f},
-std::array<float,2>{0.320870787f, 0.806845844f},
-std::array<float,2>{0.63922292f, 0.987089872f},
-std::array<float,2>{0.498120487f, 0.399674326f},
-std::array<float,2>{0.959557176f, 0.145599112f},
-std::array<float,2>{0.0909823999f, 0.542633832f},
-std::array<float,2>{0.928400278f, 0.873753726f},
-std::array<float,2>{0.0176875275f, 0.36124894f},
-std::array<float,2>{0.727214038f, 0.0434933715f},
-std::array<float,2>{0.412950128f, 0.725356221f},
-std::array<float,2>{0.559783936f, 0.619971216f},
-std::array<float,2>{0.273580045f, 0.247659624f},
-std::array<float,2>{0.757808506f, 0.438971907f},
-std::array<float,2>{0.147177979f, 0.883574724f},
-std::array<float,2>{0.981226802f, 0.50581032f},
-std::array<float,2>{0.108059458f, 0.182491377f},
-std::array<float,2>{0.676256657f, 0.415509701f},
-std::array<float,2>{0.441257268f, 0.949257255f},
-std::array<float,2>{0.566899538f, 0.757887363f},
-std::array<float,2>{0.356021225f, 0.298795372f},
-std::array<float,2>{0.848424852f, 0.082100451f},
-std::array<float,2>{0.230652943f, 0.685407817f},
-std::array<float,2>{0.795750737f, 0.917298675f},
-std::array<float,2>{0.159591272f, 0.483171612f},
-std::array<float,2>{0.502133965f, 0.214480311f},
-std::array<float,2>{0.285214901f, 0.565632999f},
-std::array<float,2>{0.695839405f, 0.710156381f},
-std::array<float,2>{0.388294309f, 0.0221510343f},
-std::array<float,2>{0.905810952f, 0.320236474f},
-std::array<float,2>{0.0617548674f, 0.820216537f},
-std::array<float,2>{0.884505212f, 0.740875125f},
-std::array<float,2>{0.0352969691f, 0.0498642027f},
-std::array<float,2>{0.71397388f, 0.350227177f},
-std::array<float,2>{0.403561056f, 0.85407716f},
-std::array<float,2>{0.518853664f, 0.903291881f},
-std::array<float,2>{0.303898811f, 0.455871582f},
-std::array<float,2>{0.803135693f, 0.228132427f},
-std::array<float,2>{0.17703265f, 0.596093118f},
-std::array<float,2>{0.863752127f, 0.788520813f},
-std::array<float,2>{0.249379724f, 0.271589339f},
-std::array<float,2>{0.583605111f, 0.100476436f},
-std::array<float,2>{0.360445648f, 0.633458078f},
-std::array<float,2>{0.656585097f, 0.556972444f},
-std::array<float,2>{0.466863126f, 0.125558436f},
-std::array<float,2>{0.987576485f, 0.380678922f},
-std::array<float,2>{0.117891528f, 0.978469014f},
-std::array<float,2>{0.776423454f, 0.587989509f},
-std::array<float,2>{0.126503572f, 0.189177737f},
-std::array<float,2>{0.541365206f, 0.485669017f},
-std::array<float,2>{0.264531225f, 0.931721687f},
-std::array<float,2>{0.745080709f, 0.843737304f},
-std::array<float,2>{0.435806364f, 0.334207922f},
-std::array<float,2>{0.91901654f, 0.0110394992f},
-std::array<float,2>{0.0117320977f, 0.702534318f},
-std::array<float,2>{0.94398582f, 0.958384097f},
-std::array<float,2>{0.0673275888f, 0.437062383f},
-std::array<float,2>{0.647916317f, 0.157929733f},
-std::array<float,2>{0.482053041f, 0.530311584f},
-std::array<float,2>{0.62363565f, 0.662407994f},
-std::array<float,2>{0.33893314f, 0.0665099472f},
-std::array<float,2>{0.832952678f, 0.291826665f},
-std::array<float,2>{0.201319784f, 0.77865392f},
-std::array<float,2>{0.750746906f, 0.669171214f},
-std::array<float,2>{0.144148201f, 0.074189432f},
-std::array<float,2>{0.554932952f, 0.282789499f},
-std::array<float,2>{0.280719101f, 0.76929909f},
-std::array<float,2>{0.733365476f, 0.967283487f},
-std::array<float,2>{0.4093211f, 0.427825838f},
-std::array<float,2>{0.923011124f, 0.168779746f},
-std::array<float,2>{0.0218597036f, 0.51621753f},
-std::array<float,2>{0.953526437f, 0.833846331f},
-std::array<float,2>{0.0877061412f, 0.336306006f},
-std::array<float,2>{0.632911146f, 0.00270341942f},
-std::array<float,2>{0.494595081f, 0.693217278f},
-std::array<float,2>{0.606395483f, 0.582490861f},
-std::array<float,2>{0.32752794f, 0.197195277f},
-std::array<float,2>{0.824059069f, 0.494337052f},
-std::array<float,2>{0.218077421f, 0.925526679f},
-std::array<float,2>{0.900022864f, 0.553327501f},
-std::array<float,2>{0.0552681983f, 0.138220742f},
-std::array<float,2>{0.699732482f, 0.384936273f},
-std::array<float,2>{0.386633694f, 0.975030839f},
-std::array<float,2>{0.503948867f, 0.790643752f},
-std::array<float,2>{0.282853037f, 0.278972089f},
-std::array<float,2>{0.789514124f, 0.10290125f},
-std::array<float,2>{0.160373718f, 0.62881428f},
-std::array<float,2>{0.844471157f, 0.891604543f},
-std::array<float,2>{0.226733506f, 0.461704642f},
-std::array<float,2>{0.565640271f, 0.22557354f},
-std::array<float,2>{0.354988039f, 0.607405543f},
-std::array<float,2>{0.674791574f, 0.746983886f},
-std::array<float,2>{0.442819864f, 0.0606525056f},
-std::array<float,2>{0.978401005f, 0.357107908f},
-std::array<float,2>{0.10429091f, 0.845223367f},
-std::array<float,2>{0.992046714f, 0.718370557f},
-std::array<float,2>{0.121398591f, 0.0290278923f},
-std::array<float,2>{0.661472917f, 0.327177912f},
-std::array<float,2>{0.462704927f, 0.822502911f},
-std::array<float,2>{0.579803169f, 0.911067128f},
-std::array<float,2>{0.36406973f, 0.475464821f},
-std::array<float,2>{0.861928046f, 0.204245359f},
-std::array<float,2>{0.242385909f, 0.570803761f},
-std::array<float,2>{0.799447954f, 0.752195001f},
-std::array<float,2>{0.174832687f, 0.3050991f},
-std::array<float,2>{0.5219118f, 0.0896373689f},
-std::array<float,2>{0.297953963f, 0.677332044f},
-std::array<float,2>{0.716107309f, 0.512037158f},
-std::array<float,2>{0.402153939f, 0.175114289f},
-std::array<float,2>{0.88997978f, 0.408300459f},
-std::array<float,2>{0.0327275097f, 0.944900632f},
-std::array<float,2>{0.830436051f, 0.611205757f},
-std::array<float,2>{0.196311027f, 0.237744987f},
-std::array<float,2>{0.617667615f, 0.45032689f},
-std::array<float,2>{0.340731889f, 0.879637361f},
-std::array<float,2>{0.642641068f, 0.86718595f},
-std::array<float,2>{0.480309457f, 0.368373841f},
-std::array<float,2>{0.939099789f, 0.03296078f},
-std::array<float,2>{0.065604277f, 0.726684332f},
-std::array<float,2>{0.917176783f, 0.994243562f},
-std::array<float,2>{0.00910111051f, 0.397328138f},
-std::array<float,2>{0.746727526f, 0.154457942f},
-std::array<float,2>{0.432225138f, 0.538476706f},
-std::array<float,2>{0.543136656f, 0.642664909f},
-std::array<float,2>{0.261105835f, 0.121044278f},
-std::array<float,2>{0.77786684f, 0.260468334f},
-std::array<float,2>{0.132041693f, 0.804131985f},
-std::array<float,2>{0.872412562f, 0.719857693f},
-std::array<float,2>{0.240553543f, 0.0409175865f},
-std::array<float,2>{0.590165973f, 0.365435541f},
-std::array<float,2>{0.368468016f, 0.869304717f},
-std::array<float,2>{0.664848626f, 0.888693213f},
-std::array<float,2>{0.460900754f, 0.442938358f},
-std::array<float,2>{0.997984231f, 0.245699286f},
-std::array<float,2>{0.112586528f, 0.621773064f},
-std::array<float,2>{0.875965774f, 0.809380114f},
-std::array<float,2>{0.0423712619f, 0.252679408f},
-std::array<float,2>{0.706984937f, 0.114937246f},
-std::array<float,2>{0.395277917f, 0.654458344f},
-std::array<float,2>{0.52975589f, 0.543331027f},
-std::array<float,2>{0.305745572f, 0.1414323f},
-std::array<float,2>{0.808198929f, 0.402925998f},
-std::array<float,2>{0.185487002f, 0.988816738f},
-std::array<float,2>{0.948439777f, 0.567993343f},
-std::array<float,2>{0.0724077225f, 0.218203783f},
-std::array<float,2>{0.652923346f, 0.480105549f},
-std::array<float,2>{0.471503913f, 0.920991957f},
-std::array<float,2>{0.612040401f, 0.816049516f},
-std::array<float,2>{0.333804876f, 0.314143956f},
-std::array<float,2>{0.837035358f, 0.0165694021f},
-std::array<float,2>{0.195171699f, 0.704208612f},
-std::array<float,2>{0.771242559f, 0.946443141f},
-std::array<float,2>{0.135666162f, 0.418114543f},
-std::array<float,2>{0.534316778f, 0.18641524f},
-std::array<float,2>{0.25007394f, 0.500093639f},
-std::array<float,2>{0.739532828f, 0.681638002f},
-std::array<float,2>{0.428731292f, 0.0795607194f},
-std::array<float,2>{0.906705558f, 0.302572936f},
-std::array<float,2>{0.000259333348f, 0.765064538f},
-std::array<float,2>{0.931584716f, 0.639400303f},
-std::array<float,2>{0.0249926616f, 0.0963394791f},
-std::array<float,2>{0.722804606f, 0.266651928f},
-std::array<float,2>{0.417508453f, 0.784154654f},
-std::array<float,2>{0.551505387f, 0.983885527f},
-std::array<float,2>{0.271694958f, 0.378322989f},
-std::array<float,2>{0.764268994f, 0.129826248f},
-std::array<float,2>{0.154051498f, 0.559999108f},
-std::array<float,2>{0.816660106f, 0.85676825f},
-std::array<float,2>{0.206136316f, 0.347483337f},
-std::array<float,2>{0.595655501f, 0.0514823049f},
-std::array<float,2>{0.319451928f, 0.738083184f},
-std::array<float,2>{0.625717521f, 0.599980712f},
-std::array<float,2>{0.486093402f, 0.233290613f},
-std::array<float,2>{0.967385232f, 0.459286422f},
-std::array<float,2>{0.0856532678f, 0.902265251f},
-std::array<float,2>{0.781284213f, 0.525136292f},
-std::array<float,2>{0.16670303f, 0.1625828f},
-std::array<float,2>{0.51274246f, 0.429878771f},
-std::array<float,2>{0.289762855f, 0.953146398f},
-std::array<float,2>{0.692884088f, 0.777242064f},
-std::array<float,2>{0.382329822f, 0.294073731f},
-std::array<float,2>{0.898233414f, 0.0631584302f},
-std::array<float,2>{0.0522945635f, 0.659763515f},
-std::array<float,2>{0.976111174f, 0.936047614f},
-std::array<float,2>{0.0938033909f, 0.49098444f},
-std::array<float,2>{0.682205975f, 0.194806993f},
-std::array<float,2>{0.446695387f, 0.589869022f},
-std::array<float,2>{0.575356364f, 0.69886899f},
-std::array<float,2>{0.346603185f, 0.0120610092f},
-std::array<float,2>{0.856001318f, 0.328895837f},
-std::array<float,2>{0.221134901f, 0.836276889f},
-std::array<float,2>{0.803429902f, 0.738419414f},
-std::array<float,2>{0.177359298f, 0.0487676412f},
-std::array<float,2>{0.519407451f, 0.349259436f},
-std::array<float,2>{0.304409117f, 0.852773488f},
-std::array<float,2>{0.71477741f, 0.904673696f},
-std::array<float,2>{0.40415284f, 0.453410029f},
-std::array<float,2>{0.884156108f, 0.229678184f},
-std::array<float,2>{0.0358898491f, 0.595233798f},
-std::array<float,2>{0.987955809f, 0.786123037f},
-std::array<float,2>{0.117302127f, 0.269605726f},
-std::array<float,2>{0.656930029f, 0.0977584049f},
-std::array<float,2>{0.467406154f, 0.635080695f},
-std::array<float,2>{0.583230495f, 0.554691851f},
-std::array<float,2>{0.360894918f, 0.127846181f},
-std::array<float,2>{0.864224494f, 0.382034898f},
-std::array<float,2>{0.249887526f, 0.980258167f},
-std::array<float,2>{0.919501901f, 0.587339461f},
-std::array<float,2>{0.0123333894f, 0.189996615f},
-std::array<float,2>{0.744223833f, 0.486565232f},
-std::array<float,2>{0.436421543f, 0.930981636f},
-std::array<float,2>{0.541599631f, 0.840611935f},
-std::array<float,2>{0.264021486f, 0.332984746f},
-std::array<float,2>{0.777334094f, 0.00906157587f},
-std::array<float,2>{0.126207471f, 0.700363517f},
-std::array<float,2>{0.832177818f, 0.960080147f},
-std::array<float,2>{0.201958656f, 0.434114933f},
-std::array<float,2>{0.623057783f, 0.159409702f},
-std::array<float,2>{0.339435756f, 0.527974129f},
-std::array<float,2>{0.648016572f, 0.660411417f},
-std::array<float,2>{0.481490761f, 0.0684190467f},
-std::array<float,2>{0.943628669f, 0.289936781f},
-std::array<float,2>{0.0668051019f, 0.780129075f},
-std::array<float,2>{0.959300041f, 0.652006269f},
-std::array<float,2>{0.091333352f, 0.111433133f},
-std::array<float,2>{0.63895154f, 0.257497758f},
-std::array<float,2>{0.498833388f, 0.805704117f},
-std::array<float,2>{0.602568507f, 0.984551549f},
-std::array<float,2>{0.320342392f, 0.4009552f},
-std::array<float,2>{0.827681959f, 0.147889182f},
-std::array<float,2>{0.21474804f, 0.539948165f},
-std::array<float,2>{0.757173359f, 0.871920288f},
-std::array<float,2>{0.146565065f, 0.362936646f},
-std::array<float,2>{0.560236692f, 0.0449393913f},
-std::array<float,2>{0.274135381f, 0.724188745f},
-std::array<float,2>{0.726974368f, 0.618568063f},
-std::array<float,2>{0.412311614f, 0.248200372f},
-std::array<float,2>{0.9281587f, 0.440476388f},
-std::array<float,2>{0.0185474698f, 0.885023296f},
-std::array<float,2>{0.848126352f, 0.507633328f},
-std::array<float,2>{0.231026381f, 0.1807331f},
-std::array<float,2>{0.566625535f, 0.416907132f},
-std::array<float,2>{0.355535656f, 0.952162147f},
-std::array<float,2>{0.676572978f, 0.76086843f},
-std::array<float,2>{0.440846086f, 0.299022794f},
-std::array<float,2>{0.980497479f, 0.0843271166f},
-std::array<float,2>{0.107582718f, 0.68616271f},
-std::array<float,2>{0.905582011f, 0.914610267f},
-std::array<float,2>{0.0621058904f, 0.481420189f},
-std::array<float,2>{0.69533664f, 0.211723357f},
-std::array<float,2>{0.387884468f, 0.563667238f},
-std::array<float,2>{0.502814114f, 0.70801568f},
-std::array<float,2>{0.285914809f, 0.0205529258f},
-std::array<float,2>{0.795342028f, 0.317934096f},
-std::array<float,2>{0.159943342f, 0.818289042f},
-std::array<float,2>{0.813080728f, 0.672270238f},
-std::array<float,2>{0.209494919f, 0.0903622657f},
-std::array<float,2>{0.600636423f, 0.309897274f},
-std::array<float,2>{0.313305825f, 0.757612646f},
-std::array<float,2>{0.629535556f, 0.937861443f},
-std::array<float,2>{0.48927933f, 0.413388997f},
-std::array<float,2>{0.964161515f, 0.177294239f},
-std::array<float,2>{0.0782993808f, 0.511274099f},
-std::array<float,2>{0.935652673f, 0.825506628f},
-std::array<float,2>{0.0280800853f, 0.323940486f},
-std::array<float,2>{0.722357929f, 0.024546124f},
-std::array<float,2>{0.419134378f, 0.713001549f},
-std::array<float,2>{0.550436556f, 0.576268256f},
-std::array<float,2>{0.266916096f, 0.208901227f},
-std::array<float,2>{0.75851953f, 0.471926838f},
-std::array<float,2>{0.152074367f, 0.909781218f},
-std::array<float,2>{0.970559418f, 0.532630622f},
-std::array<float,2>{0.101378039f, 0.150584862f},
-std::array<float,2>{0.687384903f, 0.392232329f},
-std::array<float,2>{0.45094642f, 0.998021722f},
-std::array<float,2>{0.573645055f, 0.798377991f},
-std::array<float,2>{0.34869495f, 0.264690012f},
-std::array<float,2>{0.852447987f, 0.124405086f},
-std::array<float,2>{0.223053455f, 0.648427248f},
-std::array<float,2>{0.78891784f, 0.877606988f},
-std::array<float,2>{0.16923368f, 0.448239565f},
-std::array<float,2>{0.510443866f, 0.238541409f},
-std::array<float,2>{0.293391705f, 0.617139041f},
-std::array<float,2>{0.689404666f, 0.73309803f},
-std::array<float,2>{0.375179857f, 0.0362844989f},
-std::array<float,2>{0.892746508f, 0.374647796f},
-std::array<float,2>{0.0469357222f, 0.86183238f},
-std::array<float,2>{0.880225718f, 0.688227057f},
-std::array<float,2>{0.0454855673f, 0.00391090801f},
-std::array<float,2>{0.709099293f, 0.340231061f},
-std::array<float,2>{0.392129004f, 0.830523372f},
-std::array<float,2>{0.525102377f, 0.926398456f},
-std::array<float,2>{0.309355259f, 0.49875015f},
-std::array<float,2>{0.808604479f, 0.200873375f},
-std::array<float,2>{0.183255136f, 0.580755532f},
-std::array<float,2>{0.870681524f, 0.773190856f},
-std::array<float,2>{0.235689715f, 0.286855459f},
-std::array<float,2>{0.586091816f, 0.0752978623f},
-std::array<float,2>{0.371341705f, 0.664659977f},
-std::array<float,2>{0.668267012f, 0.520014286f},
-std::array<float,2>{0.454162657f, 0.164471984f},
-std::array<float,2>{0.995044708f, 0.425144047f},
-std::array<float,2>{0.114941992f, 0.961996675f},
-std::array<float,2>{0.769352198f, 0.603017211f},
-std::array<float,2>{0.139651552f, 0.219138131f},
-std::array<float,2>{0.536590159f, 0.46807611f},
-std::array<float,2>{0.254411519f, 0.896922231f},
-std::array<float,2>{0.736947238f, 0.85054636f},
-std::array<float,2>{0.423701525f, 0.352047265f},
-std::array<float,2>{0.910519838f, 0.0581546277f},
-std::array<float,2>{0.0066874153f, 0.742306411f},
-std::array<float,2>{0.950594366f, 0.968876302f},
-std::array<float,2>{0.0763943717f, 0.389049709f},
-std::array<float,2>{0.649689615f, 0.133421585f},
-std::array<float,2>{0.47465834f, 0.548772156f},
-std::array<float,2>{0.616835892f, 0.629070461f},
-std::array<float,2>{0.328877807f, 0.10696698f},
-std::array<float,2>{0.841117024f, 0.273864061f},
-std::array<float,2>{0.191298991f, 0.796617925f},
-std::array<float,2>{0.763970554f, 0.637933552f},
-std::array<float,2>{0.153765932f, 0.0944403484f},
-std::array<float,2>{0.550805628f, 0.268642873f},
-std::array<float,2>{0.272039205f, 0.781534374f},
-std::array<float,2>{0.723595381f, 0.980647087f},
-std::array<float,2>{0.417453885f, 0.375658929f},
-std::array<float,2>{0.931022465f, 0.131626114f},
-std::array<float,2>{0.0246111769f, 0.562192619f},
-std::array<float,2>{0.967183709f, 0.858620107f},
-std::array<float,2>{0.0852482915f, 0.345010161f},
-std::array<float,2>{0.625172913f, 0.0532874987f},
-std::array<float,2>{0.485825211f, 0.73486501f},
-std::array<float,2>{0.595073521f, 0.598573744f},
-std::array<float,2>{0.319849789f, 0.231965274f},
-std::array<float,2>{0.817004561f, 0.45888719f},
-std::array<float,2>{0.206724733f, 0.899986863f},
-std::array<float,2>{0.897808731f, 0.526964128f},
-std::array<float,2>{0.0517707132f, 0.1603477f},
-std::array<float,2>{0.692727089f, 0.432613879f},
-std::array<float,2>{0.382246196f, 0.956218302f},
-std::array<float,2>{0.513664365f, 0.77464968f},
-std::array<float,2>{0.289340556f, 0.295620531f},
-std::array<float,2>{0.781786263f, 0.0654605478f},
-std::array<float,2>{0.166348591f, 0.656756759f},
-std::array<float,2>{0.855582774f, 0.935143948f},
-std::array<float,2>{0.221272424f, 0.48898685f},
-std::array<float,2>{0.575985909f, 0.192685351f},
-std::array<float,2>{0.346095473f, 0.592786491f},
-std::array<float,2>{0.681882024f, 0.696077526f},
-std::array<float,2>{0.447045118f, 0.0151995821f},
-std::array<float,2>{0.975952685f, 0.331948578f},
-std::array<float,2>{0.0943607539f, 0.838299394f},
-std::array<float,2>{0.99736464f, 0.721986592f},
-std::array<float,2>{0.112810269f, 0.0411198512f},
-std::array<float,2>{0.664087117f, 0.363702774f},
-std::array<float,2>{0.460257441f, 0.868285596f},
-std::array<float,2>{0.590342343f, 0.88824743f},
-std::array<float,2>{0.369122446f, 0.44497484f},
-std::array<float,2>{0.872735322f, 0.243500143f},
-std::array<float,2>{0.241049856f, 0.624971926f},
-std::array<float,2>{0.808079422f, 0.812113762f},
-std::array<float,2>{0.184715569f, 0.250833243f},
-std::array<float,2>{0.530230641f, 0.115350612f},
-std::array<float,2>{0.306256056f, 0.652881563f},
-std::array<float,2>{0.706069887f, 0.546627045f},
-std::array<float,2>{0.394779891f, 0.144263864f},
-std::array<float,2>{0.875358462f, 0.40575093f},
-std::array<float,2>{0.0427364781f, 0.990985394f},
-std::array<float,2>{0.837821782f, 0.569757104f},
-std::array<float,2>{0.194684908f, 0.216634288f},
-std::array<float,2>{0.611639202f, 0.477365375f},
-std::array<float,2>{0.333228856f, 0.919901252f},
-std::array<float,2>{0.652782202f, 0.814219654f},
-std::array<float,2>{0.470749825f, 0.315255731f},
-std::array<float,2>{0.948821127f, 0.0188416988f},
-std::array<float,2>{0.072980471f, 0.705457866f},
-std::array<float,2>{0.907118499f, 0.948631942f},
-std::array<float,2>{0.00056475756f, 0.420486152f},
-std::array<float,2>{0.740079999f, 0.184718013f},
-std::array<float,2>{0.429568589f, 0.503296077f},
-std::array<float,2>{0.535054207f, 0.683302164f},
-std::array<float,2>{0.250640988f, 0.0805188417f},
-std::array<float,2>{0.770586848f, 0.304633975f},
-std::array<float,2>{0.134894237f, 0.762072504f},
-std::array<float,2>{0.861664951f, 0.716668189f},
-std::array<float,2>{0.242989972f, 0.0305772014f},
-std::array<float,2>{0.579563081f, 0.325375825f},
-std::array<float,2>{0.363398939f, 0.820590675f},
-std::array<float,2>{0.661940277f, 0.913389266f},
-std::array<float,2>{0.462053835f, 0.474244565f},
-std::array<float,2>{0.991252124f, 0.206667393f},
-std::array<float,2>{0.121903293f, 0.572456896f},
-std::array<float,2>{0.890199959f, 0.751571834f},
-std::array<float,2>{0.0326018743f, 0.307489932f},
-std::array<float,2>{0.716556787f, 0.0870357156f},
-std::array<float,2>{0.401517957f, 0.678439915f},
-std::array<float,2>{0.522152424f, 0.514336288f},
-std::array<float,2>{0.298719287f, 0.172069266f},
-std::array<float,2>{0.799158514f, 0.40678665f},
-std::array<float,2>{0.175557077f, 0.943139851f},
-std::array<float,2>{0.93885088f, 0.612840056f},
-std::array<float,2>{0.0662754402f, 0.23588115f},
-std::array<float,2>{0.643138468f, 0.452803314f},
-std::array<float,2>{0.47952643f, 0.882801116f},
-std::array<float,2>{0.618113995f, 0.86517632f},
-std::array<float,2>{0.339972228f, 0.370819569f},
-std::array<float,2>{0.830570102f, 0.0347165354f},
-std::array<float,2>{0.197041899f, 0.729074478f},
-std::array<float,2>{0.777429879f, 0.99314642f},
-std::array<float,2>{0.132421732f, 0.395529568f},
-std::array<float,2>{0.543520033f, 0.15297015f},
-std::array<float,2>{0.261290193f, 0.536140919f},
-std::array<float,2>{0.746543586f, 0.641997755f},
-std::array<float,2>{0.431762457f, 0.1187023f},
-std::array<float,2>{0.917770624f, 0.258352488f},
-std::array<float,2>{0.0096905902f, 0.801970243f},
-std::array<float,2>{0.923351347f, 0.671797574f},
-std::array<float,2>{0.0221083816f, 0.0710472837f},
-std::array<float,2>{0.732596636f, 0.28331086f},
-std::array<float,2>{0.409843743f, 0.76701653f},
-std::array<float,2>{0.555284858f, 0.966399789f},
-std::array<float,2>{0.280952305f, 0.426419497f},
-std::array<float,2>{0.750467002f, 0.171481103f},
-std::array<float,2>{0.144004807f, 0.519051969f},
-std::array<float,2>{0.823380053f, 0.834459841f},
-std::array<float,2>{0.218546689f, 0.338080227f},
-std::array<float,2>{0.605764449f, 0.00142597954f},
-std::array<float,2>{0.327673733f, 0.695109725f},
-std::array<float,2>{0.633536637f, 0.584731698f},
-std::array<float,2>{0.494957685f, 0.198919341f},
-std::array<float,2>{0.953790665f, 0.492549121f},
-std::array<float,2>{0.0873925909f, 0.923803568f},
-std::array<float,2>{0.789756954f, 0.551730037f},
-std::array<float,2>{0.160884202f, 0.140105292f},
-std::array<float,2>{0.504658937f, 0.384680361f},
-std::array<float,2>{0.282509834f, 0.974383473f},
-std::array<float,2>{0.699271858f, 0.791330218f},
-std::array<float,2>{0.386126876f, 0.281098872f},
-std::array<float,2>{0.899626434f, 0.103592291f},
-std::array<float,2>{0.0550480075f, 0.62616837f},
-std::array<float,2>{0.978019238f, 0.894307971f},
-std::array<float,2>{0.103520006f, 0.464511096f},
-std::array<float,2>{0.67424643f, 0.223200515f},
-std::array<float,2>{0.443098187f, 0.609307289f},
-std::array<float,2>{0.566267908f, 0.749447763f},
-std::array<float,2>{0.354676217f, 0.0602753721f},
-std::array<float,2>{0.843949795f, 0.357948601f},
-std::array<float,2>{0.227355585f, 0.845934391f},
-std::array<float,2>{0.774919748f, 0.702774346f},
-std::array<float,2>{0.127983227f, 0.0115197636f},
-std::array<float,2>{0.539278209f, 0.334505707f},
-std::array<float,2>{0.263474137f, 0.842907012f},
-std::array<float,2>{0.743034422f, 0.932422578f},
-std::array<float,2>{0.435416907f, 0.486020505f},
-std::array<float,2>{0.920177877f, 0.188663796f},
-std::array<float,2>{0.0142289512f, 0.588584483f},
-std::array<float,2>{0.941439569f, 0.779030979f},
-std::array<float,2>{0.0695890486f, 0.291295856f},
-std::array<float,2>{0.645638347f, 0.0671684593f},
-std::array<float,2>{0.482577205f, 0.662880778f},
-std::array<float,2>{0.622541189f, 0.530874968f},
-std::array<float,2>{0.336180359f, 0.157487214f},
-std::array<float,2>{0.834760129f, 0.436655819f},
-std::array<float,2>{0.200683475f, 0.958964884f},
-std::array<float,2>{0.884772658f, 0.59641844f},
-std::array<float,2>{0.0376590937f, 0.227786005f},
-std::array<float,2>{0.712700844f, 0.455422491f},
-std::array<float,2>{0.405038565f, 0.902830422f},
-std::array<float,2>{0.516976416f, 0.85362339f},
-std::array<float,2>{0.302618802f, 0.34996146f},
-std::array<float,2>{0.801977098f, 0.0506130345f},
-std::array<float,2>{0.178595841f, 0.74042958f},
-std::array<float,2>{0.866846502f, 0.977986753f},
-std::array<float,2>{0.247789964f, 0.380273789f},
-std::array<float,2>{0.585694253f, 0.125061706f},
-std::array<float,2>{0.361428887f, 0.557234883f},
-std::array<float,2>{0.659313858f, 0.633194327f},
-std::array<float,2>{0.465637952f, 0.0998484492f},
-std::array<float,2>{0.985646248f, 0.272017717f},
-std::array<float,2>{0.120896801f, 0.789046645f},
-std::array<float,2>{0.982473731f, 0.684650064f},
-std::array<float,2>{0.107218862f, 0.0829636678f},
-std::array<float,2>{0.679163337f, 0.297925413f},
-std::array<float,2>{0.437622726f, 0.758303046f},
-std::array<float,2>{0.569844127f, 0.949880719f},
-std::array<float,2>{0.358918577f, 0.415736109f},
-std::array<float,2>{0.851212919f, 0.181802928f},
-std::array<float,2>{0.234198824f, 0.504942596f},
-std::array<float,2>{0.794254601f, 0.819362581f},
-std::array<float,2>{0.156970486f, 0.319726288f},
-std::array<float,2>{0.501133859f, 0.0217814092f},
-std::array<float,2>{0.288856685f, 0.710835099f},
-std::array<float,2>{0.698408902f, 0.566322088f},
-std::array<float,2>{0.390488327f, 0.213986844f},
-std::array<float,2>{0.903116941f, 0.482683271f},
-std::array<float,2>{0.0594512708f, 0.917691052f},
-std::array<float,2>{0.825392723f, 0.542243183f},
-std::array<float,2>{0.212701023f, 0.146236718f},
-std::array<float,2>{0.604584634f, 0.400015354f},
-std::array<float,2>{0.322930217f, 0.986594856f},
-std::array<float,2>{0.636786938f, 0.807199597f},
-std::array<float,2>{0.497709662f, 0.255669862f},
-std::array<float,2>{0.957473159f, 0.111063927f},
-std::array<float,2>{0.0932018012f, 0.648448169f},
-std::array<float,2>{0.926906168f, 0.882828116f},
-std::array<float,2>{0.0172861144f, 0.438862801f},
-std::array<float,2>{0.730161786f, 0.247158647f},
-std::array<float,2>{0.410643369f, 0.619140744f},
-std::array<float,2>{0.562149882f, 0.724859178f},
-std::array<float,2>{0.27660504f, 0.0429957025f},
-std::array<float,2>{0.75395602f, 0.360747874f},
-std::array<float,2>{0.144618899f, 0.873306632f},
-std::array<float,2>{0.854238927f, 0.644603908f},
-std::array<float,2>{0.226322427f, 0.121377371f},
-std::array<float,2>{0.571347952f, 0.262175351f},
-std::array<float,2>{0.350358486f, 0.7999174f},
-std::array<float,2>{0.684705019f, 0.999680102f},
-std::array<float,2>{0.451912284f, 0.393698782f},
-std::array<float,2>{0.972090662f, 0.149432912f},
-std::array<float,2>{0.0996006206f, 0.534773707f},
-std::array<float,2>{0.8924523f, 0.860957026f},
-std::array<float,2>{0.0488435216f, 0.371491432f},
-std::array<float,2>{0.691008329f, 0.0373344719f},
-std::array<float,2>{0.3785052f, 0.731546581f},
-std::array<float,2>{0.509286404f, 0.614613414f},
-std::array<float,2>{0.295921624f, 0.241846338f},
-std::array<float,2>{0.785229385f, 0.446858168f},
-std::array<float,2>{0.170343712f, 0.876661777f},
-std::array<float,2>{0.962447882f, 0.508436322f},
-std::array<float,2>{0.0802510753f, 0.179426029f},
-std::array<float,2>{0.632244587f, 0.411097139f},
-std::array<float,2>{0.491453737f, 0.940786302f},
-std::array<float,2>{0.598243535f, 0.755786359f},
-std::array<float,2>{0.316355467f, 0.311149716f},
-std::array<float,2>{0.814623535f, 0.0932061449f},
-std::array<float,2>{0.207237184f, 0.675250888f},
-std::array<float,2>{0.761633337f, 0.906654716f},
-std::array<float,2>{0.14884463f, 0.469111472f},
-std::array<float,2>{0.547851324f, 0.209201083f},
-std::array<float,2>{0.26881814f, 0.574498832f},
-std::array<float,2>{0.720333457f, 0.711086273f},
-std::array<float,2>{0.421146125f, 0.0257689059f},
-std::array<float,2>{0.934036374f, 0.320469946f},
-std::array<float,2>{0.030982038f, 0.827697933f},
-std::array<float,2>{0.912805617f, 0.74444294f},
-std::array<float,2>{0.00447078422f, 0.0565176234f},
-std::array<float,2>{0.735327303f, 0.354528844f},
-std::array<float,2>{0.423917264f, 0.848565519f},
-std::array<float,2>{0.537889957f, 0.896164954f},
-std::array<float,2>{0.256033868f, 0.46513027f},
-std::array<float,2>{0.766972363f, 0.220767424f},
-std::array<float,2>{0.138085887f, 0.603649795f},
-std::array<float,2>{0.843558967f, 0.793789804f},
-std::array<float,2>{0.187906504f, 0.275443912f},
-std::array<float,2>{0.614964545f, 0.107614316f},
-std::array<float,2>{0.331816107f, 0.632324278f},
-std::array<float,2>{0.650511622f, 0.548905671f},
-std::array<float,2>{0.474403471f, 0.135227278f},
-std::array<float,2>{0.952090383f, 0.387455881f},
-std::array<float,2>{0.0745909438f, 0.97185272f},
-std::array<float,2>{0.812264204f, 0.579033196f},
-std::array<float,2>{0.180103019f, 0.202929154f},
-std::array<float,2>{0.525777578f, 0.497880101f},
-std::array<float,2>{0.310820043f, 0.928140283f},
-std::array<float,2>{0.708887458f, 0.828236938f},
-std::array<float,2>{0.393305242f, 0.343691379f},
-std::array<float,2>{0.882058084f, 0.00650165183f},
-std::array<float,2>{0.0445961468f, 0.69106847f},
-std::array<float,2>{0.994075298f, 0.964015365f},
-std::array<float,2>{0.115654677f, 0.4227238f},
-std::array<float,2>{0.670637608f, 0.166900098f},
-std::array<float,2>{0.456727535f, 0.523332059f},
-std::array<float,2>{0.589781582f, 0.666215956f},
-std::array<float,2>{0.373305172f, 0.0781099647f},
-std::array<float,2>{0.867405117f, 0.288064152f},
-std::array<float,2>{0.238216996f, 0.771329045f},
-std::array<float,2>{0.784778893f, 0.659647405f},
-std::array<float,2>{0.165691704f, 0.0628710911f},
-std::array<float,2>{0.513958335f, 0.294438004f},
-std::array<float,2>{0.292521447f, 0.776587427f},
-std::array<float,2>{0.693655133f, 0.954087496f},
-std::array<float,2>{0.380449921f, 0.430239111f},
-std::array<float,2>{0.894946516f, 0.162776247f},
-std::array<float,2>{0.0531240851f, 0.524736524f},
-std::array<float,2>{0.973224878f, 0.836503506f},
-std::array<float,2>{0.0961174145f, 0.328243524f},
-std::array<float,2>{0.681388438f, 0.0122940242f},
-std::array<float,2>{0.447810829f, 0.69858551f},
-std::array<float,2>{0.576490879f, 0.590601325f},
-std::array<float,2>{0.343978614f, 0.195244551f},
-std::array<float,2>{0.858432353f, 0.49040553f},
-std::array<float,2>{0.219167456f, 0.936030984f},
-std::array<float,2>{0.931838155f, 0.560385346f},
-std::array<float,2>{0.0267664082f, 0.128998443f},
-std::array<float,2>{0.725257099f, 0.378878564f},
-std::array<float,2>{0.414262384f, 0.984133363f},
-std::array<float,2>{0.553310037f, 0.783399999f},
-std::array<float,2>{0.270468503f, 0.267318726f},
-std::array<float,2>{0.762933254f, 0.0959573984f},
-std::array<float,2>{0.154654011f, 0.639000893f},
-std::array<float,2>{0.819722772f, 0.901688695f},
-std::array<float,2>{0.203291327f, 0.459782451f},
-std::array<float,2>{0.595949769f, 0.232729942f},
-std::array<float,2>{0.316579103f, 0.600525916f},
-std::array<float,2>{0.628564119f, 0.737617493f},
-std::array<float,2>{0.486408263f, 0.0510830767f},
-std::array<float,2>{0.965134382f, 0.346812248f},
-std::array<float,2>{0.0828691199f, 0.857204139f},
-std::array<float,2>{0.946531415f, 0.704945803f},
-std::array<float,2>{0.0720845833f, 0.0156977512f},
-std::array<float,2>{0.655907452f, 0.313508093f},
-std::array<float,2>{0.470228225f, 0.815687418f},
-std::array<float,2>{0.610424638f, 0.921599329f},
-std::array<float,2>{0.33513546f, 0.479950637f},
-std::array<float,2>{0.838683248f, 0.218353525f},
-std::array<float,2>{0.192765653f, 0.567401111f},
-std::array<float,2>{0.771929502f, 0.765535295f},
-std::array<float,2>{0.13434127f, 0.301989585f},
-std::array<float,2>{0.53231132f, 0.0796466172f},
-std::array<float,2>{0.253503859f, 0.68084842f},
-std::array<float,2>{0.740342617f, 0.500826538f},
-std::array<float,2>{0.42675069f, 0.185857788f},
-std::array<float,2>{0.908617556f, 0.418474108f},
-std::array<float,2>{0.00349995447f, 0.946838021f},
-std::array<float,2>{0.874383032f, 0.621506155f},
-std::array<float,2>{0.238466814f, 0.245404407f},
-std::array<float,2>{0.592743158f, 0.442601204f},
-std::array<float,2>{0.369341969f, 0.889404058f},
-std::array<float,2>{0.667062759f, 0.869817436f},
-std::array<float,2>{0.457781285f, 0.366128653f},
-std::array<float,2>{0.999092817f, 0.0401562043f},
-std::array<float,2>{0.109689623f, 0.720329285f},
-std::array<float,2>{0.87725544f, 0.98864311f},
-std::array<float,2>{0.0402917974f, 0.402397066f},
-std::array<float,2>{0.704226494f, 0.141097367f},
-std::array<float,2>{0.398157954f, 0.543529928f},
-std::array<float,2>{0.527797103f, 0.654959023f},
-std::array<float,2>{0.307503015f, 0.114644781f},
-std::array<float,2>{0.80515492f, 0.252048314f},
-std::array<float,2>{0.185795173f, 0.808876932f},
-std::array<float,2>{0.829480827f, 0.727352679f},
-std::array<float,2>{0.198330984f, 0.0323644467f},
-std::array<float,2>{0.619409144f, 0.369047433f},
-std::array<float,2>{0.343483567f, 0.866599619f},
-std::array<float,2>{0.642541707f, 0.87903285f},
-std::array<float,2>{0.476574928f, 0.450943798f},
-std::array<float,2>{0.939774096f, 0.237993404f},
-std::array<float,2>{0.0637179092f, 0.610575795f},
-std::array<float,2>{0.914357543f, 0.804279625f},
-std::array<float,2>{0.011137452f, 0.259892076f},
-std::array<float,2>{0.74898535f, 0.120566234f},
-std::array<float,2>{0.431610227f, 0.643508017f},
-std::array<float,2>{0.54541862f, 0.538900793f},
-std::array<float,2>{0.25873366f, 0.154901654f},
-std::array<float,2>{0.779955626f, 0.396755427f},
-std::array<float,2>{0.130593002f, 0.994913697f},
-std::array<float,2>{0.98963964f, 0.570430219f},
-std::array<float,2>{0.12442331f, 0.204902127f},
-std::array<float,2>{0.663491845f, 0.474788845f},
-std::array<float,2>{0.464372784f, 0.910639882f},
-std::array<float,2>{0.581091642f, 0.822966754f},
-std::array<float,2>{0.365246296f, 0.327952236f},
-std::array<float,2>{0.8597458f, 0.0284822602f},
-std::array<float,2>{0.244166613f, 0.718184531f},
-std::array<float,2>{0.797048867f, 0.944463015f},
-std::array<float,2>{0.173344716f, 0.408802748f},
-std::array<float,2>{0.521454334f, 0.175409347f},
-std::array<float,2>{0.300503612f, 0.512361765f},
-std::array<float,2>{0.716861486f, 0.676989555f},
-std::array<float,2>{0.40014255f, 0.0891418457f},
-std::array<float,2>{0.887740374f, 0.305243194f},
-std::array<float,2>{0.0342956223f, 0.7527861f},
-std::array<float,2>{0.902229548f, 0.627961636f},
-std::array<float,2>{0.0568843484f, 0.103246473f},
-std::array<float,2>{0.703120887f, 0.278557658f},
-std::array<float,2>{0.383341908f, 0.790403545f},
-std::array<float,2>{0.506140947f, 0.975237608f},
-std::array<float,2>{0.283742905f, 0.385305405f},
-std::array<float,2>{0.791488171f, 0.138165891f},
-std::array<float,2>{0.16256544f, 0.55315125f},
-std::array<float,2>{0.846759379f, 0.844954967f},
-std::array<float,2>{0.229576707f, 0.356749743f},
-std::array<float,2>{0.563393474f, 0.0612784065f},
-std::array<float,2>{0.352977425f, 0.746418297f},
-std::array<float,2>{0.673800528f, 0.60662818f},
-std::array<float,2>{0.443747789f, 0.224660471f},
-std::array<float,2>{0.979795992f, 0.461123288f},
-std::array<float,2>{0.103047982f, 0.892398894f},
-std::array<float,2>{0.752231419f, 0.515633166f},
-std::array<float,2>{0.140882567f, 0.168012738f},
-std::array<float,2>{0.557184398f, 0.428323746f},
-std::array<float,2>{0.277987719f, 0.967346072f},
-std::array<float,2>{0.730734885f, 0.768991947f},
-std::array<float,2>{0.406481683f, 0.282496005f},
-std::array<float,2>{0.925690234f, 0.0735893771f},
-std::array<float,2>{0.020525204f, 0.669563711f},
-std::array<float,2>{0.955807984f, 0.924818575f},
-std::array<float,2>{0.0889410973f, 0.494910687f},
-std::array<float,2>{0.634888053f, 0.196714446f},
-std::array<float,2>{0.492771208f, 0.582732081f},
-std::array<float,2>{0.608650029f, 0.692695677f},
-std::array<float,2>{0.324411273f, 0.0022314121f},
-std::array<float,2>{0.822178781f, 0.336606264f},
-std::array<float,2>{0.216097623f, 0.83340615f},
-std::array<float,2>{0.755146325f, 0.723438382f},
-std::array<float,2>{0.146242008f, 0.0466393381f},
-std::array<float,2>{0.561305821f, 0.361331701f},
-std::array<float,2>{0.276326805f, 0.873046279f},
-std::array<float,2>{0.728996098f, 0.886568606f},
-std::array<float,2>{0.411499768f, 0.440021455f},
-std::array<float,2>{0.925847173f, 0.249658346f},
-std::array<float,2>{0.0165538937f, 0.617808282f},
-std::array<float,2>{0.958170772f, 0.805205464f},
-std::array<float,2>{0.0926621631f, 0.256623894f},
-std::array<float,2>{0.638094544f, 0.112688586f},
-std::array<float,2>{0.496335149f, 0.651089609f},
-std::array<float,2>{0.604050457f, 0.540697634f},
-std::array<float,2>{0.323839754f, 0.146681175f},
-std::array<float,2>{0.824934006f, 0.401578426f},
-std::array<float,2>{0.211769506f, 0.985395968f},
-std::array<float,2>{0.904059708f, 0.562874973f},
-std::array<float,2>{0.0605435409f, 0.212280735f},
-std::array<float,2>{0.697837174f, 0.481752276f},
-std::array<float,2>{0.388970435f, 0.915999949f},
-std::array<float,2>{0.500892103f, 0.817217827f},
-std::array<float,2>{0.287367165f, 0.317266643f},
-std::array<float,2>{0.793308437f, 0.0197100714f},
-std::array<float,2>{0.157527f, 0.707841575f},
-std::array<float,2>{0.850554585f, 0.951730847f},
-std::array<float,2>{0.232757568f, 0.417867661f},
-std::array<float,2>{0.568889916f, 0.179985464f},
-std::array<float,2>{0.358219266f, 0.506302536f},
-std::array<float,2>{0.67799896f, 0.687255621f},
-std::array<float,2>{0.439047992f, 0.0859334171f},
-std::array<float,2>{0.984324634f, 0.300496727f},
-std::array<float,2>{0.106185719f, 0.760535777f},
-std::array<float,2>{0.985274255f, 0.635820985f},
-std::array<float,2>{0.11978519f, 0.0992453843f},
-std::array<float,2>{0.658855498f, 0.270746559f},
-std::array<float,2>{0.466031492f, 0.786535501f},
-std::array<float,2>{0.584200382f, 0.978658438f},
-std::array<float,2>{0.362656385f, 0.381813824f},
-std::array<float,2>{0.866169274f, 0.128728405f},
-std::array<float,2>{0.246282116f, 0.556632936f},
-std::array<float,2>{0.801689804f, 0.852306962f},
-std::array<float,2>{0.179050609f, 0.347963989f},
-std::array<float,2>{0.516280472f, 0.0472591184f},
-std::array<float,2>{0.300976396f, 0.740109682f},
-std::array<float,2>{0.711201847f, 0.594126582f},
-std::array<float,2>{0.405985862f, 0.22913909f},
-std::array<float,2>{0.886207759f, 0.454688311f},
-std::array<float,2>{0.038340833f, 0.905482829f},
-std::array<float,2>{0.835001171f, 0.528745353f},
-std::array<float,2>{0.200150952f, 0.159062564f},
-std::array<float,2>{0.621753216f, 0.434571236f},
-std::array<float,2>{0.336949974f, 0.959198296f},
-std::array<float,2>{0.644894242f, 0.780455589f},
-std::array<float,2>{0.483698905f, 0.290701747f},
-std::array<float,2>{0.94258517f, 0.0701149106f},
-std::array<float,2>{0.0688170791f, 0.661854684f},
-std::array<float,2>{0.921117723f, 0.930340111f},
-std::array<float,2>{0.0148503864f, 0.487481177f},
-std::array<float,2>{0.743705511f, 0.191197753f},
-std::array<float,2>{0.433924288f, 0.586076677f},
-std::array<float,2>{0.540811539f, 0.699524283f},
-std::array<float,2>{0.26224643f, 0.00798082352f},
-std::array<float,2>{0.773815393f, 0.333365589f},
-std::array<float,2>{0.127913892f, 0.841040552f},
-std::array<float,2>{0.868988693f, 0.665753186f},
-std::array<float,2>{0.23651059f, 0.0747026354f},
-std::array<float,2>{0.588482022f, 0.285194099f},
-std::array<float,2>{0.374592215f, 0.771959305f},
-std::array<float,2>{0.67186749f, 0.961316645f},
-std::array<float,2>{0.455459505f, 0.424447745f},
-std::array<float,2>{0.992213309f, 0.165330485f},
-std::array<float,2>{0.116472669f, 0.521116495f},
-std::array<float,2>{0.881681621f, 0.831385851f},
-std::array<float,2>{0.0436684117f, 0.341242731f},
-std::array<float,2>{0.707092166f, 0.00526917912f},
-std::array<float,2>{0.394011319f, 0.689133048f},
-std::array<float,2>{0.526955783f, 0.581924438f},
-std::array<float,2>{0.311686903f, 0.199952945f},
-std::array<float,2>{0.811396301f, 0.499864787f},
-std::array<float,2>{0.181408122f, 0.926954389f},
-std::array<float,2>{0.952333152f, 0.546933413f},
-std::array<float,2>{0.0755365491f, 0.133864418f},
-std::array<float,2>{0.652057528f, 0.390073687f},
-std::array<float,2>{0.472842097f, 0.970475316f},
-std::array<float,2>{0.613346219f, 0.795063376f},
-std::array<float,2>{0.330235273f, 0.275363863f},
-std::array<float,2>{0.841878057f, 0.106325828f},
-std::array<float,2>{0.188499942f, 0.630239069f},
-std::array<float,2>{0.765851676f, 0.898166001f},
-std::array<float,2>{0.136816263f, 0.467459589f},
-std::array<float,2>{0.538884819f, 0.219923422f},
-std::array<float,2>{0.257163793f, 0.601571202f},
-std::array<float,2>{0.735878646f, 0.74395138f},
-std::array<float,2>{0.425528973f, 0.0575754307f},
-std::array<float,2>{0.91314584f, 0.35264954f},
-std::array<float,2>{0.00547960168f, 0.850986123f},
-std::array<float,2>{0.93474859f, 0.714818716f},
-std::array<float,2>{0.0296890344f, 0.0243500005f},
-std::array<float,2>{0.719633996f, 0.323149711f},
-std::array<float,2>{0.420264512f, 0.824853003f},
-std::array<float,2>{0.548154533f, 0.908209682f},
-std::array<float,2>{0.268424869f, 0.471637756f},
-std::array<float,2>{0.760111868f, 0.207420856f},
-std::array<float,2>{0.150211453f, 0.577859342f},
-std::array<float,2>{0.815980315f, 0.755961001f},
-std::array<float,2>{0.208959967f, 0.309216946f},
-std::array<float,2>{0.599218845f, 0.0912322178f},
-std::array<float,2>{0.314664811f, 0.673799813f},
-std::array<float,2>{0.630911708f, 0.510312617f},
-std::array<float,2>{0.490289241f, 0.175790578f},
-std::array<float,2>{0.96119386f, 0.412808061f},
-std::array<float,2>{0.0818940029f, 0.93855983f},
-std::array<float,2>{0.786481261f, 0.615497291f},
-std::array<float,2>{0.17135419f, 0.23944883f},
-std::array<float,2>{0.508554339f, 0.448861182f},
-std::array<float,2>{0.295250177f, 0.878286242f},
-std::array<float,2>{0.689648986f, 0.862554252f},
-std::array<float,2>{0.377777338f, 0.37391308f},
-std::array<float,2>{0.891335428f, 0.0356961936f},
-std::array<float,2>{0.0502661169f, 0.73354274f},
-std::array<float,2>{0.970987916f, 0.99653852f},
-std::array<float,2>{0.0977294222f, 0.390973657f},
-std::array<float,2>{0.684078157f, 0.151848301f},
-std::array<float,2>{0.452966362f, 0.531829596f},
-std::array<float,2>{0.571144819f, 0.647209942f},
-std::array<float,2>{0.351442665f, 0.123514622f},
-std::array<float,2>{0.854890764f, 0.263822943f},
-std::array<float,2>{0.225072518f, 0.797847688f},
-std::array<float,2>{0.805922687f, 0.653457761f},
-std::array<float,2>{0.186934426f, 0.116497688f},
-std::array<float,2>{0.528391182f, 0.251921266f},
-std::array<float,2>{0.308398068f, 0.811062813f},
-std::array<float,2>{0.703807414f, 0.992119431f},
-std::array<float,2>{0.396549731f, 0.404683352f},
-std::array<float,2>{0.878773451f, 0.142806664f},
-std::array<float,2>{0.039523989f, 0.545566916f},
-std::array<float,2>{0.998870015f, 0.868120313f},
-std::array<float,2>{0.111311197f, 0.364899129f},
-std::array<float,2>{0.66661334f, 0.0425964482f},
-std::array<float,2>{0.458773404f, 0.721397221f},
-std::array<float,2>{0.593295991f, 0.623506427f},
-std::array<float,2>{0.370734304f, 0.242875025f},
-std::array<float,2>{0.873973131f, 0.443410069f},
-std::array<float,2>{0.239390433f, 0.886893988f},
-std::array<float,2>{0.909431756f, 0.502518237f},
-std::array<float,2>{0.00238721352f, 0.184016243f},
-std::array<float,2>{0.742047668f, 0.421762764f},
-std::array<float,2>{0.427132308f, 0.947906196f},
-std::array<float,2>{0.532073677f, 0.763134062f},
-std::array<float,2>{0.2521483f, 0.3031196f},
-std::array<float,2>{0.773331523f, 0.0813118219f},
-std::array<float,2>{0.133408383f, 0.681857705f},
-std::array<float,2>{0.838885486f, 0.918677926f},
-std::array<float,2>{0.191550419f, 0.477979273f},
-std::array<float,2>{0.609394491f, 0.215819985f},
-std::array<float,2>{0.334367454f, 0.569037259f},
-std::array<float,2>{0.654895008f, 0.706408978f},
-std::array<float,2>{0.469174564f, 0.0183370803f},
-std::array<float,2>{0.946048319f, 0.315632343f},
-std::array<float,2>{0.0705938339f, 0.812737226f},
-std::array<float,2>{0.966714144f, 0.736067653f},
-std::array<float,2>{0.0838874802f, 0.0538611263f},
-std::array<float,2>{0.627866209f, 0.344476402f},
-std::array<float,2>{0.488182068f, 0.857866585f},
-std::array<float,2>{0.596764624f, 0.899086773f},
-std::array<float,2>{0.317566395f, 0.457198977f},
-std::array<float,2>{0.819267809f, 0.231125116f},
-std::array<float,2>{0.204489872f, 0.599086583f},
-std::array<float,2>{0.762150347f, 0.782694519f},
-std::array<float,2>{0.155446798f, 0.26822859f},
-std::array<float,2>{0.554618895f, 0.0949808359f},
-std::array<float,2>{0.270996362f, 0.637124419f},
-std::array<float,2>{0.725742698f, 0.561400831f},
-std::array<float,2>{0.415243208f, 0.132159144f},
-std::array<float,2>{0.932724178f, 0.376811892f},
-std::array<float,2>{0.0257009249f, 0.981589675f},
-std::array<float,2>{0.857465684f, 0.5923599f},
-std::array<float,2>{0.219738305f, 0.191790178f},
-std::array<float,2>{0.577238381f, 0.490202844f},
-std::array<float,2>{0.345495194f, 0.934190452f},
-std::array<float,2>{0.680460632f, 0.839034736f},
-std::array<float,2>{0.449036717f, 0.330632627f},
-std::array<float,2>{0.973996162f, 0.013843012f},
-std::array<float,2>{0.0973872095f, 0.696767569f},
-std::array<float,2>{0.895854115f, 0.955180526f},
-std::array<float,2>{0.0537576936f, 0.43272078f},
-std::array<float,2>{0.695306063f, 0.161285043f},
-std::array<float,2>{0.379115462f, 0.525984108f},
-std::array<float,2>{0.515300691f, 0.657931983f},
-std::array<float,2>{0.291832358f, 0.0645478889f},
-std::array<float,2>{0.783308029f, 0.296601981f},
-std::array<float,2>{0.164665699f, 0.773871541f},
-std::array<float,2>{0.8209427f, 0.694019377f},
-std::array<float,2>{0.215183213f, 0.000115516232f},
-std::array<float,2>{0.607538104f, 0.33951816f},
-std::array<float,2>{0.325779855f, 0.835426152f},
-std::array<float,2>{0.635783553f, 0.922727048f},
-std::array<float,2>{0.493629634f, 0.493981421f},
-std::array<float,2>{0.956320226f, 0.197554201f},
-std::array<float,2>{0.087990202f, 0.585832357f},
-std::array<float,2>{0.924054444f, 0.766439617f},
-std::array<float,2>{0.0200279746f, 0.284326941f},
-std::array<float,2>{0.732286692f, 0.072192423f},
-std::array<float,2>{0.407425344f, 0.670595229f},
-std::array<float,2>{0.557916403f, 0.518158078f},
-std::array<float,2>{0.278477758f, 0.17069605f},
-std::array<float,2>{0.753133416f, 0.427389115f},
-std::array<float,2>{0.14164111f, 0.965111792f},
-std::array<float,2>{0.979160011f, 0.607581913f},
-std::array<float,2>{0.101654224f, 0.224384472f},
-std::array<float,2>{0.672720373f, 0.463546783f},
-std::array<float,2>{0.444564641f, 0.893433511f},
-std::array<float,2>{0.563689232f, 0.846862197f},
-std::array<float,2>{0.351685524f, 0.359307855f},
-std::array<float,2>{0.846384168f, 0.0593351126f},
-std::array<float,2>{0.228638038f, 0.748325288f},
-std::array<float,2>{0.792021632f, 0.972658575f},
-std::array<float,2>{0.163103253f, 0.382906556f},
-std::array<float,2>{0.507226408f, 0.138872862f},
-std::array<float,2>{0.284213394f, 0.552036405f},
-std::array<float,2>{0.701454997f, 0.625289738f},
-std::array<float,2>{0.384319782f, 0.10546691f},
-std::array<float,2>{0.900672555f, 0.279350936f},
-std::array<float,2>{0.0581598878f, 0.79230237f},
-std::array<float,2>{0.886884034f, 0.67923665f},
-std::array<float,2>{0.0338138491f, 0.0863171518f},
-std::array<float,2>{0.718340158f, 0.307811499f},
-std::array<float,2>{0.398513556f, 0.750148356f},
-std::array<float,2>{0.520243704f, 0.942127109f},
-std::array<float,2>{0.299591541f, 0.407597333f},
-std::array<float,2>{0.79834789f, 0.173454538f},
-std::array<float,2>{0.172805771f, 0.515284181f},
-std::array<float,2>{0.8604514f, 0.821716189f},
-std::array<float,2>{0.245301843f, 0.324368894f},
-std::array<float,2>{0.580920458f, 0.029871596f},
-std::array<float,2>{0.36688295f, 0.714931488f},
-std::array<float,2>{0.662242651f, 0.573360682f},
-std::array<float,2>{0.463590324f, 0.2059239f},
-std::array<float,2>{0.988420904f, 0.473089039f},
-std::array<float,2>{0.123552427f, 0.912990928f},
-std::array<float,2>{0.78071785f, 0.535580993f},
-std::array<float,2>{0.129151925f, 0.153454661f},
-std::array<float,2>{0.546198726f, 0.394645065f},
-std::array<float,2>{0.259349197f, 0.993272662f},
-std::array<float,2>{0.749756038f, 0.801222861f},
-std::array<float,2>{0.430029362f, 0.259426385f},
-std::array<float,2>{0.915345669f, 0.117673725f},
-std::array<float,2>{0.0103459116f, 0.641052604f},
-std::array<float,2>{0.941257417f, 0.881753802f},
-std::array<float,2>{0.0627285317f, 0.451296687f},
-std::array<float,2>{0.640878439f, 0.234444708f},
-std::array<float,2>{0.478449762f, 0.61172843f},
-std::array<float,2>{0.620945394f, 0.730343342f},
-std::array<float,2>{0.341853082f, 0.0334337652f},
-std::array<float,2>{0.829015374f, 0.36974591f},
-std::array<float,2>{0.197309107f, 0.864122987f},
-std::array<float,2>{0.79622817f, 0.709797263f},
-std::array<float,2>{0.159098759f, 0.0225835741f},
-std::array<float,2>{0.503018856f, 0.318997502f},
-std::array<float,2>{0.286728173f, 0.818970263f},
-std::array<float,2>{0.696319222f, 0.916823208f},
-std::array<float,2>{0.387529552f, 0.483439296f},
-std::array<float,2>{0.90437746f, 0.213016629f},
-std::array<float,2>{0.0611410365f, 0.564942658f},
-std::array<float,2>{0.982013583f, 0.758988857f},
-std::array<float,2>{0.109146871f, 0.297740132f},
-std::array<float,2>{0.677101254f, 0.0830725804f},
-std::array<float,2>{0.440351814f, 0.684053242f},
-std::array<float,2>{0.568317771f, 0.504115701f},
-std::array<float,2>{0.35732618f, 0.183507621f},
-std::array<float,2>{0.849335074f, 0.414152265f},
-std::array<float,2>{0.232166588f, 0.950854123f},
-std::array<float,2>{0.929005086f, 0.620885134f},
-std::array<float,2>{0.0186258573f, 0.246743575f},
-std::array<float,2>{0.728139699f, 0.437797427f},
-std::array<float,2>{0.413170785f, 0.884212792f},
-std::array<float,2>{0.558862746f, 0.874391913f},
-std::array<float,2>{0.27525872f, 0.360218346f},
-std::array<float,2>{0.756529033f, 0.0448327698f},
-std::array<float,2>{0.148260191f, 0.726300359f},
-std::array<float,2>{0.826632679f, 0.987526774f},
-std::array<float,2>{0.213547781f, 0.398454517f},
-std::array<float,2>{0.602511227f, 0.145304814f},
-std::array<float,2>{0.321966499f, 0.541418672f},
-std::array<float,2>{0.64034009f, 0.649510443f},
-std::array<float,2>{0.499982208f, 0.109706789f},
-std::array<float,2>{0.960164964f, 0.254243165f},
-std::array<float,2>{0.090277642f, 0.80795747f},
-std::array<float,2>{0.944437027f, 0.664037824f},
-std::array<float,2>{0.0679400563f, 0.0681268796f},
-std::array<float,2>{0.647389174f, 0.292852879f},
-std::array<float,2>{0.480991483f, 0.778041244f},
-std::array<float,2>{0.624411702f, 0.957441449f},
-std::array<float,2>{0.338032395f, 0.435900301f},
-std::array<float,2>{0.833183289f, 0.156468719f},
-std::array<float,2>{0.202318475f, 0.529967487f},
-std::array<float,2>{0.776068628f, 0.841917336f},
-std::array<float,2>{0.125783369f, 0.335416228f},
-std::array<float,2>{0.542684793f, 0.0105874147f},
-std::array<float,2>{0.264734358f, 0.701562166f},
-std::array<float,2>{0.745923638f, 0.589216769f},
-std::array<float,2>{0.437041789f, 0.188452139f},
-std::array<float,2>{0.918299317f, 0.484473646f},
-std::array<float,2>{0.0127027174f, 0.93315351f},
-std::array<float,2>{0.864679337f, 0.558040679f},
-std::array<float,2>{0.24877575f, 0.126212522f},
-std::array<float,2>{0.58208245f, 0.379506022f},
-std::array<float,2>{0.359693557f, 0.97752744f},
-std::array<float,2>{0.657649994f, 0.78718251f},
-std::array<float,2>{0.468175828f, 0.272495776f},
-std::array<float,2>{0.986482501f, 0.101326764f},
-std::array<float,2>{0.118528686f, 0.634493291f},
-std::array<float,2>{0.883706152f, 0.904093266f},
-std::array<float,2>{0.0369835235f, 0.45631367f},
-std::array<float,2>{0.713323116f, 0.227411851f},
-std::array<float,2>{0.402528673f, 0.597030818f},
-std::array<float,2>{0.518351018f, 0.741460264f},
-std::array<float,2>{0.303310275f, 0.0492301546f},
-std::array<float,2>{0.804122388f, 0.351205289f},
-std::array<float,2>{0.175799221f, 0.854658663f},
-std::array<float,2>{0.840073347f, 0.631489635f},
-std::array<float,2>{0.190332472f, 0.108599059f},
-std::array<float,2>{0.615382135f, 0.276533902f},
-std::array<float,2>{0.329480439f, 0.794097185f},
-std::array<float,2>{0.649042308f, 0.970866442f},
-std::array<float,2>{0.475830674f, 0.388488859f},
-std::array<float,2>{0.95003897f, 0.136476651f},
-std::array<float,2>{0.0779417381f, 0.550119221f},
-std::array<float,2>{0.91179204f, 0.849130392f},
-std::array<float,2>{0.00744308578f, 0.353630871f},
-std::array<float,2>{0.737530828f, 0.0549203902f},
-std::array<float,2>{0.422218502f, 0.74546355f},
-std::array<float,2>{0.535368204f, 0.604632199f},
-std::array<float,2>{0.255774409f, 0.222328722f},
-std::array<float,2>{0.767643392f, 0.466237456f},
-std::array<float,2>{0.138853684f, 0.89465332f},
-std::array<float,2>{0.995439708f, 0.522025704f},
-std::array<float,2>{0.113937445f, 0.167310774f},
-std::array<float,2>{0.669786096f, 0.422929257f},
-std::array<float,2>{0.453980625f, 0.96379739f},
-std::array<float,2>{0.587345183f, 0.770117223f},
-std::array<float,2>{0.37275961f, 0.288404971f},
-std::array<float,2>{0.86928767f, 0.0763637573f},
-std::array<float,2>{0.234688714f, 0.667017937f},
-std::array<float,2>{0.810242653f, 0.929668009f},
-std::array<float,2>{0.182105407f, 0.49656406f},
-std::array<float,2>{0.523899555f, 0.201422065f},
-std::array<float,2>{0.310496002f, 0.579977691f},
-std::array<float,2>{0.710904121f, 0.689978302f},
-std::array<float,2>{0.390896738f, 0.00707644597f},
-std::array<float,2>{0.879378319f, 0.342597991f},
-std::array<float,2>{0.0464645922f, 0.829817772f},
-std::array<float,2>{0.893960416f, 0.731146038f},
-std::array<float,2>{0.048476629f, 0.0385312885f},
-std::array<float,2>{0.687745452f, 0.372858405f},
-std::array<float,2>{0.376752585f, 0.860192537f},
-std::array<float,2>{0.511160016f, 0.875525892f},
-std::array<float,2>{0.294349402f, 0.445892274f},
-std::array<float,2>{0.787444472f, 0.240252763f},
-std::array<float,2>{0.168897673f, 0.614150703f},
-std::array<float,2>{0.85266453f, 0.79959029f},
-std::array<float,2>{0.224252492f, 0.263299614f},
-std::array<float,2>{0.573051453f, 0.12211854f},
-std::array<float,2>{0.348233134f, 0.645605087f},
-std::array<float,2>{0.686252236f, 0.53353554f},
-std::array<float,2>{0.449369818f, 0.149300441f},
-std::array<float,2>{0.969403028f, 0.393504143f},
-std::array<float,2>{0.100126967f, 0.998280764f},
-std::array<float,2>{0.759261489f, 0.575907052f},
-std::array<float,2>{0.151023835f, 0.210397661f},
-std::array<float,2>{0.549536347f, 0.469743639f},
-std::array<float,2>{0.266296864f, 0.907422364f},
-std::array<float,2>{0.7215029f, 0.82656765f},
-std::array<float,2>{0.418548793f, 0.322104305f},
-std::array<float,2>{0.937305391f, 0.026997285f},
-std::array<float,2>{0.0287655313f, 0.712799072f},
-std::array<float,2>{0.963401854f, 0.939609349f},
-std::array<float,2>{0.0792808309f, 0.411911815f},
-std::array<float,2>{0.629936814f, 0.178225219f},
-std::array<float,2>{0.488318682f, 0.50900358f},
-std::array<float,2>{0.600363612f, 0.674163401f},
-std::array<float,2>{0.313932657f, 0.0926268101f},
-std::array<float,2>{0.814034045f, 0.312278867f},
-std::array<float,2>{0.210215211f, 0.7547732f},
-std::array<float,2>{0.770010352f, 0.680397868f},
-std::array<float,2>{0.135883823f, 0.07866624f},
-std::array<float,2>{0.534019232f, 0.30114454f},
-std::array<float,2>{0.251867741f, 0.764298975f},
-std::array<float,2>{0.738448918f, 0.945387185f},
-std::array<float,2>{0.427981108f, 0.419307381f},
-std::array<float,2>{0.907503426f, 0.186638311f},
-std::array<float,2>{0.0012319464f, 0.501057029f},
-std::array<float,2>{0.947318733f, 0.815316737f},
-std::array<float,2>{0.0741185248f, 0.312859595f},
-std::array<float,2>{0.653905511f, 0.0169227086f},
-std::array<float,2>{0.471977204f, 0.703340948f},
-std::array<float,2>{0.61271733f, 0.566934586f},
-std::array<float,2>{0.332682848f, 0.216811478f},
-std::array<float,2>{0.836540997f, 0.479024947f},
-std::array<float,2>{0.194022357f, 0.920247853f},
-std::array<float,2>{0.876443148f, 0.544590712f},
-std::array<float,2>{0.0414027646f, 0.142205372f},
-std::array<float,2>{0.706024706f, 0.403823882f},
-std::array<float,2>{0.396237701f, 0.989342332f},
-std::array<float,2>{0.530740738f, 0.810420871f},
-std::array<float,2>{0.305641681f, 0.253087223f},
-std::array<float,2>{0.807365179f, 0.113912396f},
-std::array<float,2>{0.184047684f, 0.655872285f},
-std::array<float,2>{0.871544778f, 0.890067697f},
-std::array<float,2>{0.241949201f, 0.442078263f},
-std::array<float,2>{0.591028035f, 0.244666964f},
-std::array<float,2>{0.368144482f, 0.622134745f},
-std::array<float,2>{0.665616572f, 0.719639838f},
-std::array<float,2>{0.459691882f, 0.0399050042f},
-std::array<float,2>{0.996266901f, 0.366849393f},
-std::array<float,2>{0.111365326f, 0.870820284f},
-std::array<float,2>{0.975233078f, 0.697967231f},
-std::array<float,2>{0.0954798386f, 0.0128249098f},
-std::array<float,2>{0.682991445f, 0.329163343f},
-std::array<float,2>{0.446244001f, 0.837165713f},
-std::array<float,2>{0.575056374f, 0.936791897f},
-std::array<float,2>{0.347366333f, 0.491944224f},
-std::array<float,2>{0.856698871f, 0.193804756f},
-std::array<float,2>{0.221811876f, 0.591144979f},
-std::array<float,2>{0.782855153f, 0.775842667f},
-std::array<float,2>{0.167288512f, 0.293869168f},
-std::array<float,2>{0.512360394f, 0.0639590919f},
-std::array<float,2>{0.290396392f, 0.65864116f},
-std::array<float,2>{0.691537201f, 0.524281621f},
-std::array<float,2>{0.381480753f, 0.163178265f},
-std::array<float,2>{0.896580517f, 0.431168467f},
-std::array<float,2>{0.0511068478f, 0.954982162f},
-std::array<float,2>{0.817614377f, 0.601519048f},
-std::array<float,2>{0.205862939f, 0.233829454f},
-std::array<float,2>{0.594159603f, 0.4606947f},
-std::array<float,2>{0.319291711f, 0.901154697f},
-std::array<float,2>{0.626085222f, 0.855579555f},
-std::array<float,2>{0.485023052f, 0.346336216f},
-std::array<float,2>{0.96820277f, 0.0518373065f},
-std::array<float,2>{0.0846422166f, 0.73730284f},
-std::array<float,2>{0.93031764f, 0.982839823f},
-std::array<float,2>{0.0241246615f, 0.377492458f},
-std::array<float,2>{0.724018753f, 0.129894227f},
-std::array<float,2>{0.416622281f, 0.559149623f},
-std::array<float,2>{0.55242461f, 0.639939964f},
-std::array<float,2>{0.273071915f, 0.0972101539f},
-std::array<float,2>{0.765426457f, 0.266068548f},
-std::array<float,2>{0.153319448f, 0.785134554f},
-std::array<float,2>{0.844766796f, 0.747129798f},
-std::array<float,2>{0.227931365f, 0.0616029352f},
-std::array<float,2>{0.564608276f, 0.355704814f},
-std::array<float,2>{0.354280949f, 0.843817294f},
-std::array<float,2>{0.675424933f, 0.890887141f},
-std::array<float,2>{0.441885531f, 0.46279335f},
-std::array<float,2>{0.977351129f, 0.225975424f},
-std::array<float,2>{0.105460376f, 0.606223464f},
-std::array<float,2>{0.899130583f, 0.789435923f},
-std::array<float,2>{0.0560220852f, 0.27760306f},
-std::array<float,2>{0.70066911f, 0.10231784f},
-std::array<float,2>{0.385405868f, 0.627171218f},
-std::array<float,2>{0.505304813f, 0.554029405f},
-std::array<float,2>{0.281892955f, 0.137133822f},
-std::array<float,2>{0.790096641f, 0.386712939f},
-std::array<float,2>{0.161659941f, 0.975968242f},
-std::array<float,2>{0.954783201f, 0.583088756f},
-std::array<float,2>{0.0865846574f, 0.195413694f},
-std::array<float,2>{0.633797407f, 0.495870501f},
-std::array<float,2>{0.495973974f, 0.924334466f},
-std::array<float,2>{0.607056022f, 0.832903266f},
-std::array<float,2>{0.326788813f, 0.337531686f},
-std::array<float,2>{0.822913706f, 0.00298408046f},
-std::array<float,2>{0.217352033f, 0.69184649f},
-std::array<float,2>{0.751248956f, 0.968725562f},
-std::array<float,2>{0.142635509f, 0.429330707f},
-std::array<float,2>{0.556274414f, 0.169654399f},
-std::array<float,2>{0.280177385f, 0.516789794f},
-std::array<float,2>{0.733539999f, 0.668325961f},
-std::array<float,2>{0.408991724f, 0.072735332f},
-std::array<float,2>{0.921938896f, 0.281924576f},
-std::array<float,2>{0.0226168465f, 0.767837942f},
-std::array<float,2>{0.916219234f, 0.644372046f},
-std::array<float,2>{0.00813228823f, 0.119852267f},
-std::array<float,2>{0.747159779f, 0.26100266f},
-std::array<float,2>{0.432745278f, 0.802874267f},
-std::array<float,2>{0.544372737f, 0.995221257f},
-std::array<float,2>{0.26026997f, 0.398029327f},
-std::array<float,2>{0.779048324f, 0.156185567f},
-std::array<float,2>{0.131279469f, 0.537527263f},
-std::array<float,2>{0.832010567f, 0.866006434f},
-std::array<float,2>{0.195831701f, 0.367197782f},
-std::array<float,2>{0.6181885f, 0.0317585059f},
-std::array<float,2>{0.340847254f, 0.727711201f},
-std::array<float,2>{0.644486368f, 0.609571159f},
-std::array<float,2>{0.479400486f, 0.236561775f},
-std::array<float,2>{0.937884986f, 0.449700266f},
-std::array<float,2>{0.0645388216f, 0.880337f},
-std::array<float,2>{0.800195694f, 0.513463199f},
-std::array<float,2>{0.173838437f, 0.174322903f},
-std::array<float,2>{0.522735536f, 0.409250081f},
-std::array<float,2>{0.297733575f, 0.943928897f},
-std::array<float,2>{0.715151846f, 0.753186524f},
-std::array<float,2>{0.400855005f, 0.306219816f},
-std::array<float,2>{0.88880682f, 0.0888066068f},
-std::array<float,2>{0.0319083706f, 0.675886989f},
-std::array<float,2>{0.990943968f, 0.911307693f},
-std::array<float,2>{0.122934341f, 0.475857258f},
-std::array<float,2>{0.660598338f, 0.203461573f},
-std::array<float,2>{0.461080313f, 0.572172582f},
-std::array<float,2>{0.578763604f, 0.71762681f},
-std::array<float,2>{0.364308566f, 0.0280701965f},
-std::array<float,2>{0.863143444f, 0.32693395f},
-std::array<float,2>{0.244090632f, 0.823459268f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.071850881f, 0.242209271f},
-std::array<float,2>{0.858985782f, 0.806765437f},
-std::array<float,2>{0.476927876f, 0.73858577f},
-std::array<float,2>{0.500389755f, 0.291925013f},
-std::array<float,2>{0.301496208f, 0.482122064f},
-std::array<float,2>{0.728028953f, 0.56751591f},
-std::array<float,2>{0.180439889f, 0.97067982f},
-std::array<float,2>{0.888286471f, 0.0314853787f},
-std::array<float,2>{0.2336521f, 0.365010649f},
-std::array<float,2>{0.957488298f, 0.646555722f},
-std::array<float,2>{0.374054402f, 0.874108255f},
-std::array<float,2>{0.644942343f, 0.174957231f},
-std::array<float,2>{0.432584256f, 0.0667799115f},
-std::array<float,2>{0.605614245f, 0.890745699f},
-std::array<float,2>{0.0330795683f, 0.54249692f},
-std::array<float,2>{0.783751965f, 0.430686861f},
-std::array<float,2>{0.139902338f, 0.00612459099f},
-std::array<float,2>{0.914961576f, 0.959213257f},
-std::array<float,2>{0.279462844f, 0.60733366f},
-std::array<float,2>{0.711270392f, 0.456403315f},
-std::array<float,2>{0.449179977f, 0.260425091f},
-std::array<float,2>{0.554927826f, 0.713814795f},
-std::array<float,2>{0.119544081f, 0.762160182f},
-std::array<float,2>{0.837335289f, 0.192075878f},
-std::array<float,2>{0.0288682338f, 0.379860848f},
-std::array<float,2>{0.75637114f, 0.517750144f},
-std::array<float,2>{0.404105902f, 0.920143843f},
-std::array<float,2>{0.579171777f, 0.0939344689f},
-std::array<float,2>{0.340674907f, 0.152330309f},
-std::array<float,2>{0.657058239f, 0.842371643f},
-std::array<float,2>{0.197104409f, 0.661679447f},
-std::array<float,2>{0.995946288f, 0.316834658f},
-std::array<float,2>{0.206923649f, 0.171387315f},
-std::array<float,2>{0.980648458f, 0.846948206f},
-std::array<float,2>{0.315202892f, 0.6324808f},
-std::array<float,2>{0.674967468f, 0.350990474f},
-std::array<float,2>{0.381603092f, 0.416712672f},
-std::array<float,2>{0.569999754f, 0.556735039f},
-std::array<float,2>{0.00115319947f, 0.885909677f},
-std::array<float,2>{0.77562511f, 0.0829189941f},
-std::array<float,2>{0.107526779f, 0.306509227f},
-std::array<float,2>{0.819555879f, 0.725323558f},
-std::array<float,2>{0.461083621f, 0.782946348f},
-std::array<float,2>{0.545532227f, 0.228750899f},
-std::array<float,2>{0.255778164f, 0.0624438263f},
-std::array<float,2>{0.698596478f, 0.992322981f},
-std::array<float,2>{0.153741419f, 0.581934035f},
-std::array<float,2>{0.923392415f, 0.491726726f},
-std::array<float,2>{0.0623876117f, 0.110997483f},
-std::array<float,2>{0.804393411f, 0.923030615f},
-std::array<float,2>{0.414199054f, 0.507119775f},
-std::array<float,2>{0.621243775f, 0.394733131f},
-std::array<float,2>{0.351861656f, 0.342354357f},
-std::array<float,2>{0.636024117f, 0.67947495f},
-std::array<float,2>{0.247409493f, 0.817797363f},
-std::array<float,2>{0.94072926f, 0.135790184f},
-std::array<float,2>{0.163488969f, 0.440202892f},
-std::array<float,2>{0.903229058f, 0.619984746f},
-std::array<float,2>{0.28676033f, 0.938628018f},
-std::array<float,2>{0.734609544f, 0.0263237897f},
-std::array<float,2>{0.498081625f, 0.203212798f},
-std::array<float,2>{0.529753566f, 0.778119206f},
-std::array<float,2>{0.0797036812f, 0.694351554f},
-std::array<float,2>{0.872261465f, 0.27167356f},
-std::array<float,2>{0.0153739061f, 0.129557014f},
-std::array<float,2>{0.770023108f, 0.824132621f},
-std::array<float,2>{0.387402564f, 0.681130111f},
-std::array<float,2>{0.57218802f, 0.334807664f},
-std::array<float,2>{0.326042593f, 0.402015805f},
-std::array<float,2>{0.685704768f, 0.511443794f},
-std::array<float,2>{0.216165975f, 0.936623275f},
-std::array<float,2>{0.973908424f, 0.122424871f},
-std::array<float,2>{0.141834542f, 0.276327163f},
-std::array<float,2>{0.932272077f, 0.70235157f},
-std::array<float,2>{0.263983518f, 0.766878664f},
-std::array<float,2>{0.689268589f, 0.215937123f},
-std::array<float,2>{0.459027976f, 0.0231139101f},
-std::array<float,2>{0.537288189f, 0.947822392f},
-std::array<float,2>{0.101035513f, 0.609551549f},
-std::array<float,2>{0.820350409f, 0.45092389f},
-std::array<float,2>{0.239748955f, 0.0918970406f},
-std::array<float,2>{0.951898992f, 0.880919814f},
-std::array<float,2>{0.347735852f, 0.547407508f},
-std::array<float,2>{0.630309761f, 0.413345814f},
-std::array<float,2>{0.409275591f, 0.356015533f},
-std::array<float,2>{0.610281467f, 0.637162268f},
-std::array<float,2>{0.0509660952f, 0.858949482f},
-std::array<float,2>{0.810826004f, 0.156665295f},
-std::array<float,2>{0.0913897604f, 0.495218456f},
-std::array<float,2>{0.86102587f, 0.587714493f},
-std::array<float,2>{0.489202678f, 0.992123961f},
-std::array<float,2>{0.518867016f, 0.0506028943f},
-std::array<float,2>{0.292437553f, 0.222476304f},
-std::array<float,2>{0.749252439f, 0.795313478f},
-std::array<float,2>{0.164512038f, 0.733487606f},
-std::array<float,2>{0.891158581f, 0.30095312f},
-std::array<float,2>{0.175702587f, 0.200042292f},
-std::array<float,2>{0.881605387f, 0.755552053f},
-std::array<float,2>{0.312099367f, 0.706750453f},
-std::array<float,2>{0.721424937f, 0.252389431f},
-std::array<float,2>{0.47654134f, 0.467289537f},
-std::array<float,2>{0.511380911f, 0.5968467f},
-std::array<float,2>{0.064063184f, 0.965782046f},
-std::array<float,2>{0.851217151f, 0.0153433392f},
-std::array<float,2>{0.0392706059f, 0.323546916f},
-std::array<float,2>{0.7894333f, 0.671543598f},
-std::array<float,2>{0.42345041f, 0.835716784f},
-std::array<float,2>{0.599182129f, 0.142801866f},
-std::array<float,2>{0.363316685f, 0.106086105f},
-std::array<float,2>{0.654271126f, 0.907078266f},
-std::array<float,2>{0.225700438f, 0.526560962f},
-std::array<float,2>{0.962212622f, 0.386520565f},
-std::array<float,2>{0.115120515f, 0.0407023728f},
-std::array<float,2>{0.830533147f, 0.980171382f},
-std::array<float,2>{0.440996498f, 0.571902215f},
-std::array<float,2>{0.550061762f, 0.469139934f},
-std::array<float,2>{0.268231243f, 0.28469187f},
-std::array<float,2>{0.706388891f, 0.748855948f},
-std::array<float,2>{0.129463464f, 0.803325951f},
-std::array<float,2>{0.90922606f, 0.240438119f},
-std::array<float,2>{0.188769996f, 0.426266342f},
-std::array<float,2>{0.989090562f, 0.534399569f},
-std::array<float,2>{0.332711637f, 0.905397654f},
-std::array<float,2>{0.66729033f, 0.0758360848f},
-std::array<float,2>{0.393378526f, 0.187181994f},
-std::array<float,2>{0.587646782f, 0.861838579f},
-std::array<float,2>{0.0189575739f, 0.651769221f},
-std::array<float,2>{0.763628602f, 0.36873877f},
-std::array<float,2>{0.0942526087f, 0.177341536f},
-std::array<float,2>{0.82560873f, 0.870851219f},
-std::array<float,2>{0.455998242f, 0.64187336f},
-std::array<float,2>{0.534108877f, 0.3617495f},
-std::array<float,2>{0.259373337f, 0.434239239f},
-std::array<float,2>{0.694851935f, 0.545047522f},
-std::array<float,2>{0.14504379f, 0.894988775f},
-std::array<float,2>{0.934154272f, 0.0647656694f},
-std::array<float,2>{0.212617323f, 0.295783281f},
-std::array<float,2>{0.970993876f, 0.737011969f},
-std::array<float,2>{0.3212125f, 0.811965525f},
-std::array<float,2>{0.680006385f, 0.249479786f},
-std::array<float,2>{0.38643232f, 0.0373566933f},
-std::array<float,2>{0.577920735f, 0.975768507f},
-std::array<float,2>{0.0102571985f, 0.564025879f},
-std::array<float,2>{0.765853643f, 0.476876169f},
-std::array<float,2>{0.171118394f, 0.101444162f},
-std::array<float,2>{0.897780597f, 0.914854467f},
-std::array<float,2>{0.294451088f, 0.522415161f},
-std::array<float,2>{0.745953918f, 0.375768274f},
-std::array<float,2>{0.486164838f, 0.31340307f},
-std::array<float,2>{0.521612525f, 0.660131216f},
-std::array<float,2>{0.086200051f, 0.838030875f},
-std::array<float,2>{0.866687119f, 0.155768648f},
-std::array<float,2>{0.0494580716f, 0.460116237f},
-std::array<float,2>{0.806070626f, 0.60278362f},
-std::array<float,2>{0.413492054f, 0.956393063f},
-std::array<float,2>{0.614051223f, 0.00140191265f},
-std::array<float,2>{0.343840331f, 0.189515963f},
-std::array<float,2>{0.626922369f, 0.761246145f},
-std::array<float,2>{0.235153809f, 0.716498137f},
-std::array<float,2>{0.948567271f, 0.265586793f},
-std::array<float,2>{0.220794812f, 0.233325258f},
-std::array<float,2>{0.968318105f, 0.787200868f},
-std::array<float,2>{0.35993135f, 0.719309151f},
-std::array<float,2>{0.650880337f, 0.308871001f},
-std::array<float,2>{0.429038405f, 0.486318618f},
-std::array<float,2>{0.594229579f, 0.58542335f},
-std::array<float,2>{0.0444478095f, 0.997942388f},
-std::array<float,2>{0.793617249f, 0.0570486709f},
-std::array<float,2>{0.0686929375f, 0.34651643f},
-std::array<float,2>{0.844244242f, 0.626123428f},
-std::array<float,2>{0.471110225f, 0.849416077f},
-std::array<float,2>{0.515425861f, 0.166550234f},
-std::array<float,2>{0.30479756f, 0.0808942989f},
-std::array<float,2>{0.726154268f, 0.888935447f},
-std::array<float,2>{0.177052632f, 0.559282959f},
-std::array<float,2>{0.875702858f, 0.420865566f},
-std::array<float,2>{0.0203067735f, 0.0277749225f},
-std::array<float,2>{0.757898808f, 0.9437415f},
-std::array<float,2>{0.394662738f, 0.624166906f},
-std::array<float,2>{0.590258241f, 0.441632658f},
-std::array<float,2>{0.328816503f, 0.268737465f},
-std::array<float,2>{0.671110928f, 0.68827188f},
-std::array<float,2>{0.195267543f, 0.775863171f},
-std::array<float,2>{0.986409187f, 0.20852001f},
-std::array<float,2>{0.12810868f, 0.393490851f},
-std::array<float,2>{0.911587715f, 0.503709912f},
-std::array<float,2>{0.272554547f, 0.927559197f},
-std::array<float,2>{0.708689511f, 0.117087513f},
-std::array<float,2>{0.443803072f, 0.140195698f},
-std::array<float,2>{0.55308789f, 0.814365089f},
-std::array<float,2>{0.109519981f, 0.674203694f},
-std::array<float,2>{0.834001899f, 0.337873846f},
-std::array<float,2>{0.0387824178f, 0.211145684f},
-std::array<float,2>{0.787786663f, 0.770978928f},
-std::array<float,2>{0.436446905f, 0.696655989f},
-std::array<float,2>{0.60318619f, 0.281214327f},
-std::array<float,2>{0.370168f, 0.446264893f},
-std::array<float,2>{0.642251909f, 0.61617136f},
-std::array<float,2>{0.227272063f, 0.950728655f},
-std::array<float,2>{0.953527868f, 0.018538706f},
-std::array<float,2>{0.18677859f, 0.331145406f},
-std::array<float,2>{0.884366393f, 0.686556816f},
-std::array<float,2>{0.299218178f, 0.825120091f},
-std::array<float,2>{0.731033027f, 0.127840042f},
-std::array<float,2>{0.483452737f, 0.119247653f},
-std::array<float,2>{0.506346703f, 0.932015181f},
-std::array<float,2>{0.0763106272f, 0.512683868f},
-std::array<float,2>{0.853963971f, 0.402397454f},
-std::array<float,2>{0.201887563f, 0.0511653572f},
-std::array<float,2>{0.998885095f, 0.987999082f},
-std::array<float,2>{0.3376773f, 0.591359317f},
-std::array<float,2>{0.662150025f, 0.496106386f},
-std::array<float,2>{0.400066853f, 0.300643444f},
-std::array<float,2>{0.583746433f, 0.726881921f},
-std::array<float,2>{0.0248643197f, 0.789063275f},
-std::array<float,2>{0.751606762f, 0.224068701f},
-std::array<float,2>{0.12147259f, 0.406333476f},
-std::array<float,2>{0.842342138f, 0.553367138f},
-std::array<float,2>{0.450845391f, 0.878584325f},
-std::array<float,2>{0.558688641f, 0.0886562541f},
-std::array<float,2>{0.275279343f, 0.163016111f},
-std::array<float,2>{0.718179286f, 0.852428794f},
-std::array<float,2>{0.134572119f, 0.634010732f},
-std::array<float,2>{0.920846164f, 0.353353888f},
-std::array<float,2>{0.148810074f, 0.148177341f},
-std::array<float,2>{0.928995788f, 0.829388201f},
-std::array<float,2>{0.253341824f, 0.667082131f},
-std::array<float,2>{0.700682998f, 0.327938914f},
-std::array<float,2>{0.467178553f, 0.38951087f},
-std::array<float,2>{0.540671349f, 0.529307544f},
-std::array<float,2>{0.101985745f, 0.911219358f},
-std::array<float,2>{0.815506995f, 0.104031697f},
-std::array<float,2>{0.00716361823f, 0.254881144f},
-std::array<float,2>{0.779580474f, 0.707048953f},
-std::array<float,2>{0.377128094f, 0.752164543f},
-std::array<float,2>{0.566341758f, 0.198965564f},
-std::array<float,2>{0.31928581f, 0.00956482347f},
-std::array<float,2>{0.679520607f, 0.963564813f},
-std::array<float,2>{0.210899219f, 0.598462105f},
-std::array<float,2>{0.97881192f, 0.463080883f},
-std::array<float,2>{0.0834805742f, 0.0718942806f},
-std::array<float,2>{0.869412184f, 0.901138902f},
-std::array<float,2>{0.49451679f, 0.537127435f},
-std::array<float,2>{0.524849474f, 0.422929704f},
-std::array<float,2>{0.283122689f, 0.372657478f},
-std::array<float,2>{0.739543796f, 0.653890014f},
-std::array<float,2>{0.156986892f, 0.866117895f},
-std::array<float,2>{0.900782168f, 0.182826728f},
-std::array<float,2>{0.245569378f, 0.473908603f},
-std::array<float,2>{0.943299294f, 0.57546562f},
-std::array<float,2>{0.357909083f, 0.982461631f},
-std::array<float,2>{0.640425503f, 0.0450914837f},
-std::array<float,2>{0.420084208f, 0.237039089f},
-std::array<float,2>{0.618901372f, 0.798245132f},
-std::array<float,2>{0.0548615754f, 0.74602598f},
-std::array<float,2>{0.797121644f, 0.2868554f},
-std::array<float,2>{0.118461438f, 0.194014326f},
-std::array<float,2>{0.839065135f, 0.764232993f},
-std::array<float,2>{0.445492595f, 0.711245298f},
-std::array<float,2>{0.558482468f, 0.258324087f},
-std::array<float,2>{0.279230505f, 0.455063641f},
-std::array<float,2>{0.713504314f, 0.608998477f},
-std::array<float,2>{0.137457043f, 0.95767045f},
-std::array<float,2>{0.917041719f, 0.00555909006f},
-std::array<float,2>{0.197720766f, 0.31874156f},
-std::array<float,2>{0.993209898f, 0.66258055f},
-std::array<float,2>{0.341977924f, 0.840132773f},
-std::array<float,2>{0.659938931f, 0.150344416f},
-std::array<float,2>{0.404982507f, 0.0976525471f},
-std::array<float,2>{0.581250906f, 0.918903351f},
-std::array<float,2>{0.030699376f, 0.51642561f},
-std::array<float,2>{0.754392862f, 0.382095903f},
-std::array<float,2>{0.182817146f, 0.0338747762f},
-std::array<float,2>{0.889384568f, 0.972267151f},
-std::array<float,2>{0.303347647f, 0.570018709f},
-std::array<float,2>{0.729863703f, 0.484049052f},
-std::array<float,2>{0.478629649f, 0.28932485f},
-std::array<float,2>{0.502072394f, 0.740781903f},
-std::array<float,2>{0.07374046f, 0.806039155f},
-std::array<float,2>{0.85656333f, 0.244776323f},
-std::array<float,2>{0.0338829793f, 0.432383448f},
-std::array<float,2>{0.781850278f, 0.540615976f},
-std::array<float,2>{0.43138355f, 0.893840671f},
-std::array<float,2>{0.609161496f, 0.0690542236f},
-std::array<float,2>{0.371225744f, 0.171986982f},
-std::array<float,2>{0.647690296f, 0.871942282f},
-std::array<float,2>{0.231492192f, 0.644770503f},
-std::array<float,2>{0.959945858f, 0.366526753f},
-std::array<float,2>{0.249462113f, 0.133840024f},
-std::array<float,2>{0.938784301f, 0.819482207f},
-std::array<float,2>{0.354383826f, 0.676944375f},
-std::array<float,2>{0.632921219f, 0.341460854f},
-std::array<float,2>{0.417562991f, 0.398422331f},
-std::array<float,2>{0.623562336f, 0.50562042f},
-std::array<float,2>{0.0603844561f, 0.923982918f},
-std::array<float,2>{0.802363694f, 0.112381294f},
-std::array<float,2>{0.0815315321f, 0.269990325f},
-std::array<float,2>{0.874645948f, 0.693169236f},
-std::array<float,2>{0.496235788f, 0.780505836f},
-std::array<float,2>{0.528252542f, 0.205567494f},
-std::array<float,2>{0.287556767f, 0.0238039177f},
-std::array<float,2>{0.737931371f, 0.940131605f},
-std::array<float,2>{0.162040934f, 0.618253827f},
-std::array<float,2>{0.905037284f, 0.438362539f},
-std::array<float,2>{0.00303482823f, 0.0843353644f},
-std::array<float,2>{0.774645388f, 0.883967042f},
-std::array<float,2>{0.37934798f, 0.556493998f},
-std::array<float,2>{0.567450881f, 0.415168524f},
-std::array<float,2>{0.31335929f, 0.348375708f},
-std::array<float,2>{0.673825324f, 0.630534649f},
-std::array<float,2>{0.204783753f, 0.843832374f},
-std::array<float,2>{0.982508898f, 0.168539479f},
-std::array<float,2>{0.154403716f, 0.488520771f},
-std::array<float,2>{0.92486006f, 0.578251481f},
-std::array<float,2>{0.257602423f, 0.994286299f},
-std::array<float,2>{0.695578396f, 0.0594646856f},
-std::array<float,2>{0.464047819f, 0.227114752f},
-std::array<float,2>{0.543522656f, 0.783846617f},
-std::array<float,2>{0.107252829f, 0.724236786f},
-std::array<float,2>{0.81796813f, 0.308512509f},
-std::array<float,2>{0.0536752939f, 0.158284828f},
-std::array<float,2>{0.810034871f, 0.856020391f},
-std::array<float,2>{0.406613618f, 0.63913703f},
-std::array<float,2>{0.612811387f, 0.358716905f},
-std::array<float,2>{0.351543278f, 0.410285145f},
-std::array<float,2>{0.632137477f, 0.549615026f},
-std::array<float,2>{0.242022425f, 0.87937814f},
-std::array<float,2>{0.949313164f, 0.0907398015f},
-std::array<float,2>{0.166204438f, 0.30468595f},
-std::array<float,2>{0.894147158f, 0.732015252f},
-std::array<float,2>{0.289517432f, 0.793059826f},
-std::array<float,2>{0.746904016f, 0.220444381f},
-std::array<float,2>{0.490341067f, 0.047833886f},
-std::array<float,2>{0.516327679f, 0.988818884f},
-std::array<float,2>{0.0922509357f, 0.58851707f},
-std::array<float,2>{0.862327576f, 0.494024873f},
-std::array<float,2>{0.217933372f, 0.123937063f},
-std::array<float,2>{0.97559166f, 0.934000611f},
-std::array<float,2>{0.32635656f, 0.508520663f},
-std::array<float,2>{0.684816957f, 0.400111765f},
-std::array<float,2>{0.389295787f, 0.333299518f},
-std::array<float,2>{0.573260248f, 0.683399916f},
-std::array<float,2>{0.0119265448f, 0.82048434f},
-std::array<float,2>{0.77307862f, 0.130967259f},
-std::array<float,2>{0.0984593108f, 0.451508582f},
-std::array<float,2>{0.822925627f, 0.61283201f},
-std::array<float,2>{0.457896322f, 0.946947813f},
-std::array<float,2>{0.535230756f, 0.0196664855f},
-std::array<float,2>{0.262227535f, 0.216937914f},
-std::array<float,2>{0.691065252f, 0.767873168f},
-std::array<float,2>{0.14302662f, 0.699294806f},
-std::array<float,2>{0.929843366f, 0.273567498f},
-std::array<float,2>{0.131851524f, 0.239832506f},
-std::array<float,2>{0.90696311f, 0.800816476f},
-std::array<float,2>{0.267201632f, 0.746220887f},
-std::array<float,2>{0.704450607f, 0.282156587f},
-std::array<float,2>{0.438808978f, 0.471501619f},
-std::array<float,2>{0.548117161f, 0.574146092f},
-std::array<float,2>{0.115580291f, 0.977674425f},
-std::array<float,2>{0.829296052f, 0.0419612266f},
-std::array<float,2>{0.0165324062f, 0.369950056f},
-std::array<float,2>{0.7642712f, 0.649891317f},
-std::array<float,2>{0.391764492f, 0.860103786f},
-std::array<float,2>{0.587953985f, 0.184377179f},
-std::array<float,2>{0.334077358f, 0.0773899779f},
-std::array<float,2>{0.664628267f, 0.903813124f},
-std::array<float,2>{0.190265536f, 0.532929897f},
-std::array<float,2>{0.991566122f, 0.429314137f},
-std::array<float,2>{0.0644763708f, 0.0132957296f},
-std::array<float,2>{0.849262536f, 0.966817558f},
-std::array<float,2>{0.473674238f, 0.594860315f},
-std::array<float,2>{0.508439004f, 0.466305882f},
-std::array<float,2>{0.308797628f, 0.251775444f},
-std::array<float,2>{0.720545411f, 0.704085469f},
-std::array<float,2>{0.172720715f, 0.757478654f},
-std::array<float,2>{0.880411267f, 0.202593803f},
-std::array<float,2>{0.223349229f, 0.383786082f},
-std::array<float,2>{0.964498818f, 0.523862839f},
-std::array<float,2>{0.36637041f, 0.909966409f},
-std::array<float,2>{0.654880226f, 0.108625084f},
-std::array<float,2>{0.425392568f, 0.141139045f},
-std::array<float,2>{0.600868702f, 0.832268953f},
-std::array<float,2>{0.0427381098f, 0.66824466f},
-std::array<float,2>{0.792583168f, 0.322227359f},
-std::array<float,2>{0.0897282287f, 0.152542129f},
-std::array<float,2>{0.863450229f, 0.836652398f},
-std::array<float,2>{0.486899257f, 0.656731904f},
-std::array<float,2>{0.520421743f, 0.315879971f},
-std::array<float,2>{0.295886457f, 0.377720922f},
-std::array<float,2>{0.743547201f, 0.521227419f},
-std::array<float,2>{0.168470472f, 0.916261733f},
-std::array<float,2>{0.894705713f, 0.09822952f},
-std::array<float,2>{0.237721384f, 0.262396157f},
-std::array<float,2>{0.94723618f, 0.717868567f},
-std::array<float,2>{0.34660095f, 0.758276522f},
-std::array<float,2>{0.627691448f, 0.188624367f},
-std::array<float,2>{0.411870569f, 0.00389917241f},
-std::array<float,2>{0.615991652f, 0.954633236f},
-std::array<float,2>{0.0481307693f, 0.604807556f},
-std::array<float,2>{0.806952655f, 0.458713233f},
-std::array<float,2>{0.148049012f, 0.0642115623f},
-std::array<float,2>{0.93566376f, 0.896712184f},
-std::array<float,2>{0.259875298f, 0.543923259f},
-std::array<float,2>{0.692198932f, 0.436213166f},
-std::array<float,2>{0.454765469f, 0.361200899f},
-std::array<float,2>{0.532190681f, 0.642953098f},
-std::array<float,2>{0.0973310769f, 0.868269026f},
-std::array<float,2>{0.827565432f, 0.179341838f},
-std::array<float,2>{0.00800376851f, 0.478716403f},
-std::array<float,2>{0.768388093f, 0.565215528f},
-std::array<float,2>{0.382869184f, 0.974466383f},
-std::array<float,2>{0.575411975f, 0.0369457379f},
-std::array<float,2>{0.323830754f, 0.247212648f},
-std::array<float,2>{0.683582187f, 0.810407758f},
-std::array<float,2>{0.21313186f, 0.734983265f},
-std::array<float,2>{0.97032845f, 0.294617265f},
-std::array<float,2>{0.192878455f, 0.210012123f},
-std::array<float,2>{0.985735476f, 0.774247825f},
-std::array<float,2>{0.330781013f, 0.690810382f},
-std::array<float,2>{0.669518113f, 0.267522216f},
-std::array<float,2>{0.397783875f, 0.444059014f},
-std::array<float,2>{0.592187345f, 0.621208847f},
-std::array<float,2>{0.0220116265f, 0.942149937f},
-std::array<float,2>{0.760164917f, 0.0307826679f},
-std::array<float,2>{0.113208413f, 0.337942332f},
-std::array<float,2>{0.832428038f, 0.673730612f},
-std::array<float,2>{0.442310333f, 0.815167665f},
-std::array<float,2>{0.551794112f, 0.137039617f},
-std::array<float,2>{0.269752353f, 0.115220122f},
-std::array<float,2>{0.709674954f, 0.92863065f},
-std::array<float,2>{0.125393301f, 0.500705242f},
-std::array<float,2>{0.912504494f, 0.391036153f},
-std::array<float,2>{0.0457356982f, 0.0565392487f},
-std::array<float,2>{0.795461297f, 0.999972403f},
-std::array<float,2>{0.426999837f, 0.583416879f},
-std::array<float,2>{0.596768737f, 0.486646175f},
-std::array<float,2>{0.3616561f, 0.312264413f},
-std::array<float,2>{0.649747729f, 0.721665144f},
-std::array<float,2>{0.219072998f, 0.78640461f},
-std::array<float,2>{0.966756046f, 0.231587261f},
-std::array<float,2>{0.178639069f, 0.418896407f},
-std::array<float,2>{0.878638566f, 0.562402666f},
-std::array<float,2>{0.308579594f, 0.888162494f},
-std::array<float,2>{0.723164201f, 0.0787852481f},
-std::array<float,2>{0.468973607f, 0.164772391f},
-std::array<float,2>{0.513587058f, 0.850402772f},
-std::array<float,2>{0.0682513416f, 0.627769232f},
-std::array<float,2>{0.846683204f, 0.34473002f},
-std::array<float,2>{0.0253929645f, 0.225892842f},
-std::array<float,2>{0.753425062f, 0.791641831f},
-std::array<float,2>{0.401407033f, 0.730270863f},
-std::array<float,2>{0.584310174f, 0.298178822f},
-std::array<float,2>{0.339307874f, 0.499657631f},
-std::array<float,2>{0.661387444f, 0.592044711f},
-std::array<float,2>{0.200158536f, 0.985277772f},
-std::array<float,2>{0.996270478f, 0.053382352f},
-std::array<float,2>{0.135332465f, 0.354116917f},
-std::array<float,2>{0.918995976f, 0.63572228f},
-std::array<float,2>{0.276787937f, 0.854934633f},
-std::array<float,2>{0.716627836f, 0.161878809f},
-std::array<float,2>{0.451279581f, 0.0867789462f},
-std::array<float,2>{0.561175227f, 0.875688076f},
-std::array<float,2>{0.123217486f, 0.552277148f},
-std::array<float,2>{0.839859247f, 0.409620017f},
-std::array<float,2>{0.230322599f, 0.0173547845f},
-std::array<float,2>{0.95606333f, 0.951217711f},
-std::array<float,2>{0.367977083f, 0.614420891f},
-std::array<float,2>{0.643514156f, 0.448247552f},
-std::array<float,2>{0.433939487f, 0.278885663f},
-std::array<float,2>{0.603553295f, 0.697682202f},
-std::array<float,2>{0.0355922356f, 0.771859765f},
-std::array<float,2>{0.785792291f, 0.214596123f},
-std::array<float,2>{0.0749493092f, 0.406184793f},
-std::array<float,2>{0.852118313f, 0.514581501f},
-std::array<float,2>{0.481082827f, 0.93116492f},
-std::array<float,2>{0.50432384f, 0.118487097f},
-std::array<float,2>{0.297872096f, 0.125870436f},
-std::array<float,2>{0.734071672f, 0.8279984f},
-std::array<float,2>{0.183636531f, 0.683912396f},
-std::array<float,2>{0.886484802f, 0.328414768f},
-std::array<float,2>{0.159411505f, 0.180079147f},
-std::array<float,2>{0.899659574f, 0.863423288f},
-std::array<float,2>{0.284474432f, 0.654467225f},
-std::array<float,2>{0.740757823f, 0.373184383f},
-std::array<float,2>{0.492567331f, 0.425108194f},
-std::array<float,2>{0.52588743f, 0.53665477f},
-std::array<float,2>{0.0843691379f, 0.900143147f},
-std::array<float,2>{0.868022621f, 0.0729894117f},
-std::array<float,2>{0.0583039895f, 0.288937777f},
-std::array<float,2>{0.799025178f, 0.742757618f},
-std::array<float,2>{0.419826835f, 0.800544322f},
-std::array<float,2>{0.619154096f, 0.235361457f},
-std::array<float,2>{0.356123298f, 0.0446547791f},
-std::array<float,2>{0.638064563f, 0.980746686f},
-std::array<float,2>{0.244034216f, 0.57636714f},
-std::array<float,2>{0.944219053f, 0.47530058f},
-std::array<float,2>{0.104740791f, 0.101968236f},
-std::array<float,2>{0.813703656f, 0.912579179f},
-std::array<float,2>{0.466378063f, 0.528884888f},
-std::array<float,2>{0.541908324f, 0.386720419f},
-std::array<float,2>{0.251809716f, 0.325880915f},
-std::array<float,2>{0.702854395f, 0.665021539f},
-std::array<float,2>{0.15166226f, 0.83096689f},
-std::array<float,2>{0.927068591f, 0.146178678f},
-std::array<float,2>{0.207092106f, 0.46197015f},
-std::array<float,2>{0.976839185f, 0.600063384f},
-std::array<float,2>{0.317217439f, 0.961589217f},
-std::array<float,2>{0.677670479f, 0.00987634063f},
-std::array<float,2>{0.376330137f, 0.196569815f},
-std::array<float,2>{0.562603414f, 0.750707328f},
-std::array<float,2>{0.00562284375f, 0.709735215f},
-std::array<float,2>{0.777943194f, 0.256205618f},
-std::array<float,2>{0.106330365f, 0.229582012f},
-std::array<float,2>{0.817039788f, 0.781256616f},
-std::array<float,2>{0.463481575f, 0.725916266f},
-std::array<float,2>{0.544510603f, 0.304925978f},
-std::array<float,2>{0.256055623f, 0.491134703f},
-std::array<float,2>{0.696612775f, 0.580402076f},
-std::array<float,2>{0.155835792f, 0.993266284f},
-std::array<float,2>{0.924331307f, 0.0608671866f},
-std::array<float,2>{0.203718245f, 0.349787623f},
-std::array<float,2>{0.983647883f, 0.631145835f},
-std::array<float,2>{0.313980311f, 0.846063435f},
-std::array<float,2>{0.67249012f, 0.170644432f},
-std::array<float,2>{0.380545765f, 0.0837856382f},
-std::array<float,2>{0.56655705f, 0.885163605f},
-std::array<float,2>{0.00217717397f, 0.557633936f},
-std::array<float,2>{0.773865163f, 0.417894334f},
-std::array<float,2>{0.160621807f, 0.0264373831f},
-std::array<float,2>{0.906141281f, 0.937900126f},
-std::array<float,2>{0.288258672f, 0.620390952f},
-std::array<float,2>{0.737271547f, 0.441399008f},
-std::array<float,2>{0.497545063f, 0.272964329f},
-std::array<float,2>{0.529030263f, 0.694231868f},
-std::array<float,2>{0.0801906884f, 0.779259086f},
-std::array<float,2>{0.873512328f, 0.204344019f},
-std::array<float,2>{0.0594317354f, 0.396027088f},
-std::array<float,2>{0.800835848f, 0.505939007f},
-std::array<float,2>{0.416961223f, 0.922243357f},
-std::array<float,2>{0.624797881f, 0.109516792f},
-std::array<float,2>{0.354838818f, 0.135189459f},
-std::array<float,2>{0.634401441f, 0.817092657f},
-std::array<float,2>{0.248461872f, 0.67817235f},
-std::array<float,2>{0.937606454f, 0.342882037f},
-std::array<float,2>{0.231301382f, 0.173852354f},
-std::array<float,2>{0.960929155f, 0.873636603f},
-std::array<float,2>{0.37212196f, 0.647660315f},
-std::array<float,2>{0.647165835f, 0.363539487f},
-std::array<float,2>{0.429758608f, 0.430562884f},
-std::array<float,2>{0.608365953f, 0.541682124f},
-std::array<float,2>{0.0342207476f, 0.89182663f},
-std::array<float,2>{0.782669067f, 0.0681023821f},
-std::array<float,2>{0.0731028542f, 0.292859256f},
-std::array<float,2>{0.855959296f, 0.739864409f},
-std::array<float,2>{0.480418235f, 0.808331788f},
-std::array<float,2>{0.50293678f, 0.244014293f},
-std::array<float,2>{0.304216802f, 0.0326224267f},
-std::array<float,2>{0.728903472f, 0.969654918f},
-std::array<float,2>{0.181711853f, 0.567272902f},
-std::array<float,2>{0.890078843f, 0.480995089f},
-std::array<float,2>{0.0298829544f, 0.0952883065f},
-std::array<float,2>{0.755398154f, 0.92185396f},
-std::array<float,2>{0.406241357f, 0.519451082f},
-std::array<float,2>{0.580820858f, 0.380346686f},
-std::array<float,2>{0.343600988f, 0.31815362f},
-std::array<float,2>{0.658966243f, 0.660815537f},
-std::array<float,2>{0.198761508f, 0.843099236f},
-std::array<float,2>{0.992410421f, 0.151293769f},
-std::array<float,2>{0.138196662f, 0.455514222f},
-std::array<float,2>{0.916507959f, 0.606156409f},
-std::array<float,2>{0.278212577f, 0.960793853f},
-std::array<float,2>{0.714838743f, 0.00707869278f},
-std::array<float,2>{0.446900934f, 0.192993343f},
-std::array<float,2>{0.556956291f, 0.763372779f},
-std::array<float,2>{0.117802553f, 0.713916183f},
-std::array<float,2>{0.838786602f, 0.261545897f},
-std::array<float,2>{0.0419921577f, 0.143627495f},
-std::array<float,2>{0.79193747f, 0.834841371f},
-std::array<float,2>{0.424737453f, 0.67024833f},
-std::array<float,2>{0.599931061f, 0.323095441f},
-std::array<float,2>{0.365729451f, 0.384949148f},
-std::array<float,2>{0.655618846f, 0.525597274f},
-std::array<float,2>{0.223778918f, 0.908137441f},
-std::array<float,2>{0.963106334f, 0.106921464f},
-std::array<float,2>{0.173378095f, 0.253660887f},
-std::array<float,2>{0.879768014f, 0.705823183f},
-std::array<float,2>{0.310245931f, 0.754178584f},
-std::array<float,2>{0.718873382f, 0.200627193f},
-std::array<float,2>{0.473489046f, 0.014577263f},
-std::array<float,2>{0.50972271f, 0.96590507f},
-std::array<float,2>{0.0659436733f, 0.596534014f},
-std::array<float,2>{0.848233461f, 0.468654007f},
-std::array<float,2>{0.190643668f, 0.074534826f},
-std::array<float,2>{0.990661919f, 0.904536188f},
-std::array<float,2>{0.335925341f, 0.533944726f},
-std::array<float,2>{0.665940523f, 0.427261323f},
-std::array<float,2>{0.390966207f, 0.367244452f},
-std::array<float,2>{0.589759231f, 0.650436103f},
-std::array<float,2>{0.01674648f, 0.862504959f},
-std::array<float,2>{0.764710426f, 0.185999334f},
-std::array<float,2>{0.116232127f, 0.470096081f},
-std::array<float,2>{0.828323841f, 0.570464551f},
-std::array<float,2>{0.438413113f, 0.978671551f},
-std::array<float,2>{0.547821701f, 0.0390905365f},
-std::array<float,2>{0.266219229f, 0.24197045f},
-std::array<float,2>{0.703687429f, 0.803954124f},
-std::array<float,2>{0.131736279f, 0.749165058f},
-std::array<float,2>{0.907379329f, 0.283769071f},
-std::array<float,2>{0.144107789f, 0.215626732f},
-std::array<float,2>{0.931162417f, 0.765875995f},
-std::array<float,2>{0.263665438f, 0.701388001f},
-std::array<float,2>{0.689689457f, 0.276417017f},
-std::array<float,2>{0.458734155f, 0.449644089f},
-std::array<float,2>{0.536402702f, 0.610888243f},
-std::array<float,2>{0.0989199728f, 0.949167013f},
-std::array<float,2>{0.823491395f, 0.021679515f},
-std::array<float,2>{0.0136096692f, 0.335094184f},
-std::array<float,2>{0.772133648f, 0.680259645f},
-std::array<float,2>{0.390464514f, 0.822384834f},
-std::array<float,2>{0.573022366f, 0.130428791f},
-std::array<float,2>{0.32750994f, 0.121946625f},
-std::array<float,2>{0.683714688f, 0.935570717f},
-std::array<float,2>{0.217486322f, 0.510277092f},
-std::array<float,2>{0.975167632f, 0.400898665f},
-std::array<float,2>{0.093329519f, 0.049762141f},
-std::array<float,2>{0.861500263f, 0.99088347f},
-std::array<float,2>{0.491930991f, 0.586322546f},
-std::array<float,2>{0.51727891f, 0.494296849f},
-std::array<float,2>{0.290271401f, 0.302128375f},
-std::array<float,2>{0.747189879f, 0.732475758f},
-std::array<float,2>{0.167915419f, 0.796384096f},
-std::array<float,2>{0.893444538f, 0.220873848f},
-std::array<float,2>{0.240383282f, 0.412239164f},
-std::array<float,2>{0.950908244f, 0.548355103f},
-std::array<float,2>{0.350282669f, 0.881980956f},
-std::array<float,2>{0.631022334f, 0.0937417969f},
-std::array<float,2>{0.408152401f, 0.15789026f},
-std::array<float,2>{0.611801088f, 0.857899308f},
-std::array<float,2>{0.0546687804f, 0.638015449f},
-std::array<float,2>{0.809521616f, 0.356450081f},
-std::array<float,2>{0.0666158721f, 0.167963862f},
-std::array<float,2>{0.846377373f, 0.847732663f},
-std::array<float,2>{0.469919384f, 0.625706613f},
-std::array<float,2>{0.512185931f, 0.347351372f},
-std::array<float,2>{0.306676149f, 0.421098232f},
-std::array<float,2>{0.723772645f, 0.560039699f},
-std::array<float,2>{0.178724125f, 0.89010191f},
-std::array<float,2>{0.877658427f, 0.0811155662f},
-std::array<float,2>{0.220236242f, 0.310287207f},
-std::array<float,2>{0.965164363f, 0.719800651f},
-std::array<float,2>{0.362708151f, 0.788555026f},
-std::array<float,2>{0.649111152f, 0.233487144f},
-std::array<float,2>{0.426304221f, 0.0583559126f},
-std::array<float,2>{0.596226275f, 0.996295154f},
-std::array<float,2>{0.0464917719f, 0.584781766f},
-std::array<float,2>{0.795905471f, 0.484466851f},
-std::array<float,2>{0.126369923f, 0.115896292f},
-std::array<float,2>{0.913544357f, 0.925972223f},
-std::array<float,2>{0.270581633f, 0.502898753f},
-std::array<float,2>{0.71045059f, 0.394488603f},
-std::array<float,2>{0.443174601f, 0.336033493f},
-std::array<float,2>{0.551604986f, 0.675633848f},
-std::array<float,2>{0.111668482f, 0.81277746f},
-std::array<float,2>{0.833726823f, 0.138915494f},
-std::array<float,2>{0.0233985353f, 0.442407429f},
-std::array<float,2>{0.760886252f, 0.623084784f},
-std::array<float,2>{0.397239506f, 0.945134997f},
-std::array<float,2>{0.592966497f, 0.0289341174f},
-std::array<float,2>{0.331773371f, 0.207176149f},
-std::array<float,2>{0.668205738f, 0.776552618f},
-std::array<float,2>{0.192275718f, 0.689439595f},
-std::array<float,2>{0.984651029f, 0.268065929f},
-std::array<float,2>{0.214714304f, 0.248226434f},
-std::array<float,2>{0.969035506f, 0.811510742f},
-std::array<float,2>{0.322689801f, 0.73731029f},
-std::array<float,2>{0.682560444f, 0.296282053f},
-std::array<float,2>{0.384164423f, 0.478320479f},
-std::array<float,2>{0.575004935f, 0.563131988f},
-std::array<float,2>{0.00937374495f, 0.975003421f},
-std::array<float,2>{0.768781364f, 0.0384929664f},
-std::array<float,2>{0.0959259495f, 0.362740546f},
-std::array<float,2>{0.826742053f, 0.640836835f},
-std::array<float,2>{0.453670651f, 0.87000984f},
-std::array<float,2>{0.532627761f, 0.176411927f},
-std::array<float,2>{0.261553675f, 0.0661181882f},
-std::array<float,2>{0.692389488f, 0.895977259f},
-std::array<float,2>{0.146613508f, 0.546749055f},
-std::array<float,2>{0.936525702f, 0.435411155f},
-std::array<float,2>{0.047125902f, 0.000661677041f},
-std::array<float,2>{0.807678759f, 0.955531895f},
-std::array<float,2>{0.410981774f, 0.602425754f},
-std::array<float,2>{0.616679311f, 0.459757209f},
-std::array<float,2>{0.346838921f, 0.263713032f},
-std::array<float,2>{0.62821573f, 0.715816259f},
-std::array<float,2>{0.237026647f, 0.75997138f},
-std::array<float,2>{0.945721924f, 0.191358224f},
-std::array<float,2>{0.169416502f, 0.376019567f},
-std::array<float,2>{0.895749867f, 0.522522867f},
-std::array<float,2>{0.296677351f, 0.915295064f},
-std::array<float,2>{0.742907465f, 0.0998183489f},
-std::array<float,2>{0.487496644f, 0.155185282f},
-std::array<float,2>{0.520520031f, 0.839681149f},
-std::array<float,2>{0.0879349858f, 0.658852041f},
-std::array<float,2>{0.864358068f, 0.314405829f},
-std::array<float,2>{0.00458061974f, 0.197764546f},
-std::array<float,2>{0.778803289f, 0.753884733f},
-std::array<float,2>{0.375954717f, 0.708788157f},
-std::array<float,2>{0.564210951f, 0.254973054f},
-std::array<float,2>{0.31742841f, 0.464299202f},
-std::array<float,2>{0.676088154f, 0.599413693f},
-std::array<float,2>{0.208440587f, 0.964645028f},
-std::array<float,2>{0.978498638f, 0.00863999501f},
-std::array<float,2>{0.150831074f, 0.326864392f},
-std::array<float,2>{0.926267028f, 0.666662097f},
-std::array<float,2>{0.250169158f, 0.829051673f},
-std::array<float,2>{0.701441288f, 0.146897212f},
-std::array<float,2>{0.465409666f, 0.104916729f},
-std::array<float,2>{0.542639256f, 0.910458744f},
-std::array<float,2>{0.104246497f, 0.531216562f},
-std::array<float,2>{0.812688172f, 0.390472949f},
-std::array<float,2>{0.242307633f, 0.0467493907f},
-std::array<float,2>{0.944785833f, 0.984185278f},
-std::array<float,2>{0.357362062f, 0.574628055f},
-std::array<float,2>{0.637079656f, 0.473414123f},
-std::array<float,2>{0.418698937f, 0.285176188f},
-std::array<float,2>{0.620200574f, 0.744411826f},
-std::array<float,2>{0.0573899411f, 0.7974599f},
-std::array<float,2>{0.80026269f, 0.238274276f},
-std::array<float,2>{0.0859353542f, 0.422533244f},
-std::array<float,2>{0.868581474f, 0.53871274f},
-std::array<float,2>{0.493886739f, 0.902266622f},
-std::array<float,2>{0.526628733f, 0.0708802268f},
-std::array<float,2>{0.283979058f, 0.181802034f},
-std::array<float,2>{0.741941035f, 0.866316557f},
-std::array<float,2>{0.159114316f, 0.65317589f},
-std::array<float,2>{0.898679495f, 0.371372908f},
-std::array<float,2>{0.185046643f, 0.128857225f},
-std::array<float,2>{0.885181069f, 0.825925767f},
-std::array<float,2>{0.297388762f, 0.686329782f},
-std::array<float,2>{0.732795954f, 0.330694348f},
-std::array<float,2>{0.481957823f, 0.403421551f},
-std::array<float,2>{0.505003572f, 0.513329327f},
-std::array<float,2>{0.0752094239f, 0.933132172f},
-std::array<float,2>{0.853140712f, 0.12068662f},
-std::array<float,2>{0.0370911434f, 0.279575855f},
-std::array<float,2>{0.786704957f, 0.695928395f},
-std::array<float,2>{0.435341299f, 0.770085752f},
-std::array<float,2>{0.604859471f, 0.212653145f},
-std::array<float,2>{0.369128078f, 0.0186735392f},
-std::array<float,2>{0.643765926f, 0.949269831f},
-std::array<float,2>{0.228937641f, 0.61653918f},
-std::array<float,2>{0.955852985f, 0.446706861f},
-std::array<float,2>{0.12430498f, 0.089399755f},
-std::array<float,2>{0.841480792f, 0.876961946f},
-std::array<float,2>{0.452581823f, 0.554639339f},
-std::array<float,2>{0.562464893f, 0.40747267f},
-std::array<float,2>{0.275765181f, 0.352092743f},
-std::array<float,2>{0.71571219f, 0.633624613f},
-std::array<float,2>{0.136409357f, 0.853200018f},
-std::array<float,2>{0.918806076f, 0.163391754f},
-std::array<float,2>{0.20022656f, 0.497497946f},
-std::array<float,2>{0.99717623f, 0.590334952f},
-std::array<float,2>{0.338410735f, 0.986420333f},
-std::array<float,2>{0.660331666f, 0.0526216514f},
-std::array<float,2>{0.400715441f, 0.222728461f},
-std::array<float,2>{0.58524406f, 0.790312827f},
-std::array<float,2>{0.0269423556f, 0.727842808f},
-std::array<float,2>{0.752349496f, 0.299420655f},
-std::array<float,2>{0.0784713253f, 0.206315234f},
-std::array<float,2>{0.871311367f, 0.779803336f},
-std::array<float,2>{0.499834746f, 0.692232966f},
-std::array<float,2>{0.530324221f, 0.270643711f},
-std::array<float,2>{0.285716325f, 0.438819259f},
-std::array<float,2>{0.736243486f, 0.617441118f},
-std::array<float,2>{0.163033456f, 0.940735877f},
-std::array<float,2>{0.904109955f, 0.0250266548f},
-std::array<float,2>{0.246780232f, 0.340016425f},
-std::array<float,2>{0.940115094f, 0.676244318f},
-std::array<float,2>{0.353082538f, 0.819030523f},
-std::array<float,2>{0.635637164f, 0.133552507f},
-std::array<float,2>{0.415342927f, 0.112059891f},
-std::array<float,2>{0.622868776f, 0.925552487f},
-std::array<float,2>{0.0613097511f, 0.50468272f},
-std::array<float,2>{0.803093076f, 0.397320509f},
-std::array<float,2>{0.153026596f, 0.0603951812f},
-std::array<float,2>{0.922550678f, 0.995756924f},
-std::array<float,2>{0.25473991f, 0.579342365f},
-std::array<float,2>{0.697387099f, 0.489467204f},
-std::array<float,2>{0.462533146f, 0.307014465f},
-std::array<float,2>{0.54617548f, 0.723418593f},
-std::array<float,2>{0.109249614f, 0.78470546f},
-std::array<float,2>{0.819306314f, 0.228127286f},
-std::array<float,2>{0.000898722035f, 0.41429776f},
-std::array<float,2>{0.776631653f, 0.554733694f},
-std::array<float,2>{0.382067531f, 0.883510768f},
-std::array<float,2>{0.569068134f, 0.0856952891f},
-std::array<float,2>{0.316101581f, 0.169524387f},
-std::array<float,2>{0.674445212f, 0.844740272f},
-std::array<float,2>{0.205966219f, 0.629573345f},
-std::array<float,2>{0.981499195f, 0.348938137f},
-std::array<float,2>{0.195680559f, 0.148960367f},
-std::array<float,2>{0.994209409f, 0.84144789f},
-std::array<float,2>{0.340963542f, 0.663814485f},
-std::array<float,2>{0.657836258f, 0.319685936f},
-std::array<float,2>{0.40309298f, 0.380897641f},
-std::array<float,2>{0.578671634f, 0.517136574f},
-std::array<float,2>{0.0277324487f, 0.91942203f},
-std::array<float,2>{0.757174373f, 0.0959926099f},
-std::array<float,2>{0.120435961f, 0.258811086f},
-std::array<float,2>{0.836724639f, 0.712048829f},
-std::array<float,2>{0.447482646f, 0.765149534f},
-std::array<float,2>{0.555738628f, 0.194473594f},
-std::array<float,2>{0.280569047f, 0.00450440357f},
-std::array<float,2>{0.71238482f, 0.958837509f},
-std::array<float,2>{0.139200732f, 0.608294487f},
-std::array<float,2>{0.915049851f, 0.453651428f},
-std::array<float,2>{0.0317057036f, 0.0698781535f},
-std::array<float,2>{0.78468734f, 0.893242717f},
-std::array<float,2>{0.433234751f, 0.539313912f},
-std::array<float,2>{0.607313693f, 0.433407366f},
-std::array<float,2>{0.373439938f, 0.365859151f},
-std::array<float,2>{0.646209598f, 0.645728052f},
-std::array<float,2>{0.232617259f, 0.872983158f},
-std::array<float,2>{0.958243906f, 0.173773929f},
-std::array<float,2>{0.180914044f, 0.483291984f},
-std::array<float,2>{0.887321055f, 0.568491757f},
-std::array<float,2>{0.302503258f, 0.971555531f},
-std::array<float,2>{0.72704649f, 0.0346772261f},
-std::array<float,2>{0.47807765f, 0.245864287f},
-std::array<float,2>{0.500979602f, 0.804871082f},
-std::array<float,2>{0.0707112998f, 0.741563022f},
-std::array<float,2>{0.858248889f, 0.290385127f},
-std::array<float,2>{0.0179064162f, 0.185047463f},
-std::array<float,2>{0.761951745f, 0.860823214f},
-std::array<float,2>{0.394515097f, 0.648640096f},
-std::array<float,2>{0.586768866f, 0.370490283f},
-std::array<float,2>{0.333895266f, 0.427764237f},
-std::array<float,2>{0.66677922f, 0.531957507f},
-std::array<float,2>{0.188171655f, 0.903062522f},
-std::array<float,2>{0.989287496f, 0.0761774331f},
-std::array<float,2>{0.130216017f, 0.283013314f},
-std::array<float,2>{0.908690095f, 0.747837126f},
-std::array<float,2>{0.268947601f, 0.802077532f},
-std::array<float,2>{0.705291033f, 0.238824964f},
-std::array<float,2>{0.440000623f, 0.0427593105f},
-std::array<float,2>{0.549047709f, 0.977128744f},
-std::array<float,2>{0.113714762f, 0.57289964f},
-std::array<float,2>{0.831730843f, 0.47238332f},
-std::array<float,2>{0.225232482f, 0.10785611f},
-std::array<float,2>{0.961500347f, 0.908286512f},
-std::array<float,2>{0.364731282f, 0.524890661f},
-std::array<float,2>{0.653155923f, 0.384468198f},
-std::array<float,2>{0.422194809f, 0.321265072f},
-std::array<float,2>{0.598257542f, 0.669279814f},
-std::array<float,2>{0.0407654457f, 0.833793998f},
-std::array<float,2>{0.790786445f, 0.142411873f},
-std::array<float,2>{0.0632678568f, 0.465195805f},
-std::array<float,2>{0.849667192f, 0.594430625f},
-std::array<float,2>{0.475397259f, 0.968001544f},
-std::array<float,2>{0.510224402f, 0.0122381989f},
-std::array<float,2>{0.31087321f, 0.201735094f},
-std::array<float,2>{0.721854448f, 0.755963504f},
-std::array<float,2>{0.173857197f, 0.704651654f},
-std::array<float,2>{0.882619381f, 0.250304192f},
-std::array<float,2>{0.16561988f, 0.219287902f},
-std::array<float,2>{0.892375231f, 0.794492006f},
-std::array<float,2>{0.291022301f, 0.730653346f},
-std::array<float,2>{0.748678863f, 0.303358465f},
-std::array<float,2>{0.489885211f, 0.492773831f},
-std::array<float,2>{0.518128455f, 0.589806259f},
-std::array<float,2>{0.0905090943f, 0.989304602f},
-std::array<float,2>{0.85974437f, 0.0482434705f},
-std::array<float,2>{0.0518936887f, 0.357571125f},
-std::array<float,2>{0.812404335f, 0.639765263f},
-std::array<float,2>{0.40885511f, 0.857166469f},
-std::array<float,2>{0.610830665f, 0.15927577f},
-std::array<float,2>{0.349526048f, 0.0912548304f},
-std::array<float,2>{0.629039943f, 0.880104959f},
-std::array<float,2>{0.238792658f, 0.550488651f},
-std::array<float,2>{0.952965438f, 0.411723167f},
-std::array<float,2>{0.100340873f, 0.0211903416f},
-std::array<float,2>{0.822059393f, 0.945626259f},
-std::array<float,2>{0.460194647f, 0.611840904f},
-std::array<float,2>{0.538553119f, 0.452338725f},
-std::array<float,2>{0.265426725f, 0.274711937f},
-std::array<float,2>{0.687870324f, 0.700590909f},
-std::array<float,2>{0.140916437f, 0.76908654f},
-std::array<float,2>{0.933361053f, 0.218382075f},
-std::array<float,2>{0.215435073f, 0.39843905f},
-std::array<float,2>{0.972871602f, 0.509430587f},
-std::array<float,2>{0.324856043f, 0.935365558f},
-std::array<float,2>{0.687107325f, 0.124723658f},
-std::array<float,2>{0.387905985f, 0.131965429f},
-std::array<float,2>{0.570811629f, 0.822085619f},
-std::array<float,2>{0.0145069091f, 0.682211101f},
-std::array<float,2>{0.77082485f, 0.332906157f},
-std::array<float,2>{0.110859685f, 0.138229206f},
-std::array<float,2>{0.835101783f, 0.815700471f},
-std::array<float,2>{0.444843858f, 0.672078967f},
-std::array<float,2>{0.554566562f, 0.339601696f},
-std::array<float,2>{0.272021502f, 0.392137021f},
-std::array<float,2>{0.707328677f, 0.50140959f},
-std::array<float,2>{0.127678141f, 0.928745151f},
-std::array<float,2>{0.910474181f, 0.113287307f},
-std::array<float,2>{0.193414494f, 0.266450346f},
-std::array<float,2>{0.987339556f, 0.689556062f},
-std::array<float,2>{0.329255491f, 0.774974763f},
-std::array<float,2>{0.670060933f, 0.209788516f},
-std::array<float,2>{0.396450758f, 0.0296963975f},
-std::array<float,2>{0.591520786f, 0.942949831f},
-std::array<float,2>{0.0214683469f, 0.622087836f},
-std::array<float,2>{0.75931412f, 0.444431007f},
-std::array<float,2>{0.176284686f, 0.0791276544f},
-std::array<float,2>{0.876834095f, 0.887230873f},
-std::array<float,2>{0.306457132f, 0.560859203f},
-std::array<float,2>{0.724853456f, 0.419646472f},
-std::array<float,2>{0.47205475f, 0.344450593f},
-std::array<float,2>{0.513873756f, 0.628221631f},
-std::array<float,2>{0.0697298571f, 0.851388812f},
-std::array<float,2>{0.845392048f, 0.165978059f},
-std::array<float,2>{0.0433158502f, 0.488271177f},
-std::array<float,2>{0.793959498f, 0.582316518f},
-std::array<float,2>{0.428616643f, 0.999011219f},
-std::array<float,2>{0.595610678f, 0.0553567857f},
-std::array<float,2>{0.360870689f, 0.230485231f},
-std::array<float,2>{0.652048826f, 0.785984993f},
-std::array<float,2>{0.222574636f, 0.722242296f},
-std::array<float,2>{0.967419267f, 0.311392456f},
-std::array<float,2>{0.235536277f, 0.187895492f},
-std::array<float,2>{0.948085308f, 0.759449899f},
-std::array<float,2>{0.34475413f, 0.716940105f},
-std::array<float,2>{0.625217378f, 0.262779981f},
-std::array<float,2>{0.412123054f, 0.457612634f},
-std::array<float,2>{0.614536762f, 0.60358578f},
-std::array<float,2>{0.0506777987f, 0.953556359f},
-std::array<float,2>{0.805179477f, 0.00263568689f},
-std::array<float,2>{0.087391071f, 0.315089375f},
-std::array<float,2>{0.865689278f, 0.657475948f},
-std::array<float,2>{0.484620482f, 0.837800443f},
-std::array<float,2>{0.522715807f, 0.153816387f},
-std::array<float,2>{0.293822914f, 0.0986566395f},
-std::array<float,2>{0.744600773f, 0.917129874f},
-std::array<float,2>{0.170834452f, 0.520154715f},
-std::array<float,2>{0.897292137f, 0.378334671f},
-std::array<float,2>{0.0114932526f, 0.0352016278f},
-std::array<float,2>{0.766839385f, 0.972791255f},
-std::array<float,2>{0.384765863f, 0.565914869f},
-std::array<float,2>{0.577028453f, 0.480365455f},
-std::array<float,2>{0.321632445f, 0.29373318f},
-std::array<float,2>{0.68075484f, 0.735940397f},
-std::array<float,2>{0.211092174f, 0.809404552f},
-std::array<float,2>{0.972497046f, 0.24639219f},
-std::array<float,2>{0.145743996f, 0.437475234f},
-std::array<float,2>{0.934708595f, 0.544673026f},
-std::array<float,2>{0.258074194f, 0.897849679f},
-std::array<float,2>{0.694074333f, 0.0629675463f},
-std::array<float,2>{0.456233352f, 0.178294033f},
-std::array<float,2>{0.534540653f, 0.867220223f},
-std::array<float,2>{0.0948007405f, 0.644401908f},
-std::array<float,2>{0.824383914f, 0.360117674f},
-std::array<float,2>{0.0562118217f, 0.234413713f},
-std::array<float,2>{0.798703849f, 0.799464583f},
-std::array<float,2>{0.421455264f, 0.743834674f},
-std::array<float,2>{0.617342055f, 0.287885755f},
-std::array<float,2>{0.359070003f, 0.476207554f},
-std::array<float,2>{0.639594376f, 0.577377558f},
-std::array<float,2>{0.245025367f, 0.98158586f},
-std::array<float,2>{0.94234705f, 0.0432957001f},
-std::array<float,2>{0.1576325f, 0.37432918f},
-std::array<float,2>{0.901794672f, 0.655310631f},
-std::array<float,2>{0.281374723f, 0.864561141f},
-std::array<float,2>{0.738296747f, 0.181599751f},
-std::array<float,2>{0.495937616f, 0.0740298852f},
-std::array<float,2>{0.523980737f, 0.898665905f},
-std::array<float,2>{0.0829804912f, 0.535652041f},
-std::array<float,2>{0.870472431f, 0.424063087f},
-std::array<float,2>{0.209936082f, 0.0114242034f},
-std::array<float,2>{0.97950685f, 0.96192503f},
-std::array<float,2>{0.319968373f, 0.601346254f},
-std::array<float,2>{0.677863955f, 0.461464018f},
-std::array<float,2>{0.378717005f, 0.257389456f},
-std::array<float,2>{0.565147042f, 0.710777402f},
-std::array<float,2>{0.00588433491f, 0.751079977f},
-std::array<float,2>{0.78083849f, 0.196286127f},
-std::array<float,2>{0.103032485f, 0.387763739f},
-std::array<float,2>{0.815373421f, 0.528120577f},
-std::array<float,2>{0.468121797f, 0.913468599f},
-std::array<float,2>{0.539812565f, 0.103355907f},
-std::array<float,2>{0.25285688f, 0.145429179f},
-std::array<float,2>{0.69935739f, 0.831511915f},
-std::array<float,2>{0.149742454f, 0.665390193f},
-std::array<float,2>{0.928577244f, 0.324330091f},
-std::array<float,2>{0.133206069f, 0.160472646f},
-std::array<float,2>{0.92110616f, 0.85407114f},
-std::array<float,2>{0.273839176f, 0.636217833f},
-std::array<float,2>{0.717298985f, 0.355243951f},
-std::array<float,2>{0.449340165f, 0.408608675f},
-std::array<float,2>{0.560125411f, 0.550993681f},
-std::array<float,2>{0.122989021f, 0.87680614f},
-std::array<float,2>{0.843702614f, 0.0870579407f},
-std::array<float,2>{0.0235836618f, 0.297740787f},
-std::array<float,2>{0.750888586f, 0.729404032f},
-std::array<float,2>{0.399401963f, 0.792574108f},
-std::array<float,2>{0.582769454f, 0.225164667f},
-std::array<float,2>{0.336304426f, 0.0541000627f},
-std::array<float,2>{0.663115084f, 0.98538053f},
-std::array<float,2>{0.202381194f, 0.593307376f},
-std::array<float,2>{0.999718785f, 0.498793811f},
-std::array<float,2>{0.0779910088f, 0.118076436f},
-std::array<float,2>{0.855278134f, 0.930137455f},
-std::array<float,2>{0.482594073f, 0.515175045f},
-std::array<float,2>{0.507574677f, 0.404670119f},
-std::array<float,2>{0.300509512f, 0.329504728f},
-std::array<float,2>{0.731996059f, 0.684709668f},
-std::array<float,2>{0.185718089f, 0.826364815f},
-std::array<float,2>{0.883564472f, 0.126774207f},
-std::array<float,2>{0.228076324f, 0.447423935f},
-std::array<float,2>{0.954619884f, 0.614186168f},
-std::array<float,2>{0.369205564f, 0.952517033f},
-std::array<float,2>{0.640760005f, 0.0156486388f},
-std::array<float,2>{0.436734498f, 0.21372658f},
-std::array<float,2>{0.601569414f, 0.772625864f},
-std::array<float,2>{0.0379899964f, 0.698705435f},
-std::array<float,2>{0.788369536f, 0.278098136f},
-std::array<float,2>{0.0899387449f, 0.221590459f},
-std::array<float,2>{0.860303164f, 0.796527326f},
-std::array<float,2>{0.48973459f, 0.733023286f},
-std::array<float,2>{0.517669439f, 0.302485913f},
-std::array<float,2>{0.291817069f, 0.494795769f},
-std::array<float,2>{0.748289168f, 0.586536944f},
-std::array<float,2>{0.165256307f, 0.990423739f},
-std::array<float,2>{0.891867399f, 0.04904259f},
-std::array<float,2>{0.238373891f, 0.357398272f},
-std::array<float,2>{0.952469051f, 0.638587475f},
-std::array<float,2>{0.348820001f, 0.858161867f},
-std::array<float,2>{0.629790783f, 0.157377139f},
-std::array<float,2>{0.408410728f, 0.0929318517f},
-std::array<float,2>{0.611320376f, 0.882629752f},
-std::array<float,2>{0.0525572225f, 0.548065186f},
-std::array<float,2>{0.811822832f, 0.412712246f},
-std::array<float,2>{0.141334072f, 0.022134617f},
-std::array<float,2>{0.933101714f, 0.948335052f},
-std::array<float,2>{0.264687628f, 0.610739708f},
-std::array<float,2>{0.688334048f, 0.449916065f},
-std::array<float,2>{0.460460305f, 0.276970565f},
-std::array<float,2>{0.538697302f, 0.701975286f},
-std::array<float,2>{0.0999112874f, 0.766423285f},
-std::array<float,2>{0.821451485f, 0.214900166f},
-std::array<float,2>{0.0140217524f, 0.400591046f},
-std::array<float,2>{0.771131217f, 0.510196567f},
-std::array<float,2>{0.388669461f, 0.936373174f},
-std::array<float,2>{0.570705175f, 0.121574804f},
-std::array<float,2>{0.324645102f, 0.130281344f},
-std::array<float,2>{0.686948955f, 0.822770417f},
-std::array<float,2>{0.215082049f, 0.680066764f},
-std::array<float,2>{0.973510563f, 0.335618526f},
-std::array<float,2>{0.187648937f, 0.186518073f},
-std::array<float,2>{0.989765048f, 0.863149822f},
-std::array<float,2>{0.333020002f, 0.651170135f},
-std::array<float,2>{0.666404903f, 0.367915899f},
-std::array<float,2>{0.393774152f, 0.426950186f},
-std::array<float,2>{0.586021543f, 0.533573806f},
-std::array<float,2>{0.018369142f, 0.904851854f},
-std::array<float,2>{0.762588143f, 0.0750787556f},
-std::array<float,2>{0.114125453f, 0.283515632f},
-std::array<float,2>{0.831240535f, 0.749971449f},
-std::array<float,2>{0.439833969f, 0.804564953f},
-std::array<float,2>{0.549348831f, 0.241215616f},
-std::array<float,2>{0.269324034f, 0.0397600681f},
-std::array<float,2>{0.705919802f, 0.979238272f},
-std::array<float,2>{0.130758733f, 0.570916057f},
-std::array<float,2>{0.908799052f, 0.470367491f},
-std::array<float,2>{0.0400848202f, 0.106938958f},
-std::array<float,2>{0.790167451f, 0.907705069f},
-std::array<float,2>{0.422372997f, 0.52594769f},
-std::array<float,2>{0.597684264f, 0.385726273f},
-std::array<float,2>{0.365199476f, 0.322648048f},
-std::array<float,2>{0.652529657f, 0.670709789f},
-std::array<float,2>{0.224906206f, 0.834286213f},
-std::array<float,2>{0.961286128f, 0.144174144f},
-std::array<float,2>{0.174473539f, 0.46825555f},
-std::array<float,2>{0.882041693f, 0.596180379f},
-std::array<float,2>{0.311506391f, 0.96648097f},
-std::array<float,2>{0.72247833f, 0.0140170185f},
-std::array<float,2>{0.47495091f, 0.201104537f},
-std::array<float,2>{0.510615408f, 0.75445646f},
-std::array<float,2>{0.062714994f, 0.705202103f},
-std::array<float,2>{0.850209475f, 0.253131002f},
-std::array<float,2>{0.0280005597f, 0.150516212f},
-std::array<float,2>{0.757358313f, 0.84366703f},
-std::array<float,2>{0.402608067f, 0.660172582f},
-std::array<float,2>{0.578386247f, 0.317815155f},
-std::array<float,2>{0.341318578f, 0.380698323f},
-std::array<float,2>{0.657247365f, 0.518816113f},
-std::array<float,2>{0.196006238f, 0.92103976f},
-std::array<float,2>{0.994629383f, 0.0952118859f},
-std::array<float,2>{0.139030144f, 0.260825008f},
-std::array<float,2>{0.915969193f, 0.714757562f},
-std::array<float,2>{0.280878425f, 0.763017237f},
-std::array<float,2>{0.712792873f, 0.192785665f},
-std::array<float,2>{0.448187232f, 0.00776186865f},
-std::array<float,2>{0.556209922f, 0.960003078f},
-std::array<float,2>{0.120784655f, 0.605781138f},
-std::array<float,2>{0.836294234f, 0.456019312f},
-std::array<float,2>{0.23296766f, 0.0676674768f},
-std::array<float,2>{0.95876956f, 0.892355859f},
-std::array<float,2>{0.373752445f, 0.541125953f},
-std::array<float,2>{0.645664632f, 0.430040747f},
-std::array<float,2>{0.432930768f, 0.363973618f},
-std::array<float,2>{0.606625319f, 0.648055911f},
-std::array<float,2>{0.0321496092f, 0.873084545f},
-std::array<float,2>{0.784562886f, 0.174360618f},
-std::array<float,2>{0.0711859837f, 0.480874598f},
-std::array<float,2>{0.857425153f, 0.566552222f},
-std::array<float,2>{0.477736861f, 0.968791723f},
-std::array<float,2>{0.501615524f, 0.0331134498f},
-std::array<float,2>{0.302225143f, 0.243379623f},
-std::array<float,2>{0.727181017f, 0.807893872f},
-std::array<float,2>{0.181413352f, 0.739714324f},
-std::array<float,2>{0.886891961f, 0.292318523f},
-std::array<float,2>{0.162530795f, 0.204657704f},
-std::array<float,2>{0.903577507f, 0.77870369f},
-std::array<float,2>{0.285447866f, 0.693722665f},
-std::array<float,2>{0.735521674f, 0.272752166f},
-std::array<float,2>{0.49903971f, 0.440898657f},
-std::array<float,2>{0.530838251f, 0.620708585f},
-std::array<float,2>{0.0786303952f, 0.938280404f},
-std::array<float,2>{0.872011721f, 0.0271932539f},
-std::array<float,2>{0.0609275512f, 0.343266577f},
-std::array<float,2>{0.803280652f, 0.678242922f},
-std::array<float,2>{0.415822804f, 0.816800892f},
-std::array<float,2>{0.622491777f, 0.135367945f},
-std::array<float,2>{0.352623403f, 0.110011555f},
-std::array<float,2>{0.635051548f, 0.922616363f},
-std::array<float,2>{0.246236697f, 0.506489933f},
-std::array<float,2>{0.939687669f, 0.395663053f},
-std::array<float,2>{0.108399034f, 0.0612685084f},
-std::array<float,2>{0.818769157f, 0.993831456f},
-std::array<float,2>{0.461942583f, 0.580925286f},
-std::array<float,2>{0.546496451f, 0.490375906f},
-std::array<float,2>{0.254131794f, 0.305320799f},
-std::array<float,2>{0.697802961f, 0.72640264f},
-std::array<float,2>{0.152375013f, 0.782119691f},
-std::array<float,2>{0.921940923f, 0.230291411f},
-std::array<float,2>{0.205203757f, 0.417222649f},
-std::array<float,2>{0.982031643f, 0.558426976f},
-std::array<float,2>{0.315444112f, 0.885666966f},
-std::array<float,2>{0.673881054f, 0.0833859444f},
-std::array<float,2>{0.382459015f, 0.169924513f},
-std::array<float,2>{0.568821371f, 0.84623903f},
-std::array<float,2>{6.21059808e-05f, 0.631661713f},
-std::array<float,2>{0.777240872f, 0.350190699f},
-std::array<float,2>{0.122109175f, 0.163805246f},
-std::array<float,2>{0.843225777f, 0.852879405f},
-std::array<float,2>{0.450036198f, 0.633272529f},
-std::array<float,2>{0.559861779f, 0.351595759f},
-std::array<float,2>{0.274150312f, 0.408112019f},
-std::array<float,2>{0.716923594f, 0.553824663f},
-std::array<float,2>{0.133703753f, 0.877492547f},
-std::array<float,2>{0.921714544f, 0.088913016f},
-std::array<float,2>{0.202684209f, 0.299071759f},
-std::array<float,2>{0.999137759f, 0.728441477f},
-std::array<float,2>{0.336778641f, 0.790931463f},
-std::array<float,2>{0.663954914f, 0.223285809f},
-std::array<float,2>{0.398517281f, 0.0522064641f},
-std::array<float,2>{0.582234144f, 0.987175226f},
-std::array<float,2>{0.0240051877f, 0.590148687f},
-std::array<float,2>{0.750355661f, 0.497706115f},
-std::array<float,2>{0.186089709f, 0.120432101f},
-std::array<float,2>{0.883019149f, 0.933086634f},
-std::array<float,2>{0.300276756f, 0.512893558f},
-std::array<float,2>{0.731546283f, 0.403912544f},
-std::array<float,2>{0.483100355f, 0.330377221f},
-std::array<float,2>{0.507024348f, 0.685760915f},
-std::array<float,2>{0.0774556994f, 0.825568318f},
-std::array<float,2>{0.854635715f, 0.128399879f},
-std::array<float,2>{0.037489064f, 0.447196543f},
-std::array<float,2>{0.788963318f, 0.617093682f},
-std::array<float,2>{0.437069833f, 0.949853539f},
-std::array<float,2>{0.602248967f, 0.019084651f},
-std::array<float,2>{0.369857967f, 0.211980537f},
-std::array<float,2>{0.641503036f, 0.76957047f},
-std::array<float,2>{0.227981538f, 0.695664108f},
-std::array<float,2>{0.954189479f, 0.279816359f},
-std::array<float,2>{0.244367152f, 0.237696603f},
-std::array<float,2>{0.941488743f, 0.797193468f},
-std::array<float,2>{0.358853072f, 0.744967163f},
-std::array<float,2>{0.639099658f, 0.28573367f},
-std::array<float,2>{0.421308935f, 0.473137975f},
-std::array<float,2>{0.617844164f, 0.574792445f},
-std::array<float,2>{0.056040749f, 0.983623266f},
-std::array<float,2>{0.798141718f, 0.0462186933f},
-std::array<float,2>{0.0822374523f, 0.371599048f},
-std::array<float,2>{0.870672286f, 0.652436137f},
-std::array<float,2>{0.495520592f, 0.86682415f},
-std::array<float,2>{0.523893118f, 0.182568654f},
-std::array<float,2>{0.282113194f, 0.0707354397f},
-std::array<float,2>{0.739040256f, 0.901522815f},
-std::array<float,2>{0.158124924f, 0.538532674f},
-std::array<float,2>{0.902158797f, 0.422197223f},
-std::array<float,2>{0.00654380675f, 0.00819944777f},
-std::array<float,2>{0.780653954f, 0.963897288f},
-std::array<float,2>{0.378132522f, 0.598906517f},
-std::array<float,2>{0.564552248f, 0.464490503f},
-std::array<float,2>{0.319518387f, 0.255662858f},
-std::array<float,2>{0.678223729f, 0.708043396f},
-std::array<float,2>{0.209408611f, 0.753196239f},
-std::array<float,2>{0.9799909f, 0.197580501f},
-std::array<float,2>{0.150188416f, 0.389858931f},
-std::array<float,2>{0.927930653f, 0.530298114f},
-std::array<float,2>{0.252410501f, 0.911049485f},
-std::array<float,2>{0.700082302f, 0.105073504f},
-std::array<float,2>{0.468493551f, 0.147395432f},
-std::array<float,2>{0.539550066f, 0.828159034f},
-std::array<float,2>{0.10280519f, 0.666422963f},
-std::array<float,2>{0.814755559f, 0.326393396f},
-std::array<float,2>{0.0502482019f, 0.190678105f},
-std::array<float,2>{0.804748058f, 0.760260761f},
-std::array<float,2>{0.412726074f, 0.715226233f},
-std::array<float,2>{0.615064561f, 0.264271766f},
-std::array<float,2>{0.345502764f, 0.459075898f},
-std::array<float,2>{0.625948846f, 0.601969957f},
-std::array<float,2>{0.236278415f, 0.955679357f},
-std::array<float,2>{0.947751522f, 6.00375606e-05f},
-std::array<float,2>{0.170140445f, 0.313497066f},
-std::array<float,2>{0.896699429f, 0.658211708f},
-std::array<float,2>{0.293141007f, 0.839158058f},
-std::array<float,2>{0.744768381f, 0.154421642f},
-std::array<float,2>{0.485165f, 0.10013184f},
-std::array<float,2>{0.523164451f, 0.91584903f},
-std::array<float,2>{0.0877316296f, 0.523021877f},
-std::array<float,2>{0.865866184f, 0.376483887f},
-std::array<float,2>{0.211576477f, 0.0388766415f},
-std::array<float,2>{0.97176528f, 0.975563765f},
-std::array<float,2>{0.322196126f, 0.562879205f},
-std::array<float,2>{0.681188583f, 0.47756806f},
-std::array<float,2>{0.38551867f, 0.296499312f},
-std::array<float,2>{0.576388001f, 0.73802954f},
-std::array<float,2>{0.0107966326f, 0.811027884f},
-std::array<float,2>{0.767283618f, 0.248791084f},
-std::array<float,2>{0.0953610837f, 0.434882015f},
-std::array<float,2>{0.825085521f, 0.546096504f},
-std::array<float,2>{0.456740528f, 0.896275342f},
-std::array<float,2>{0.535089731f, 0.0655953884f},
-std::array<float,2>{0.25851807f, 0.176151797f},
-std::array<float,2>{0.693539798f, 0.869331956f},
-std::array<float,2>{0.146454826f, 0.641593039f},
-std::array<float,2>{0.935181797f, 0.362891465f},
-std::array<float,2>{0.127046198f, 0.139568061f},
-std::array<float,2>{0.911122799f, 0.813439906f},
-std::array<float,2>{0.271672577f, 0.675279438f},
-std::array<float,2>{0.707540452f, 0.336459011f},
-std::array<float,2>{0.444455266f, 0.393866271f},
-std::array<float,2>{0.553775489f, 0.502052367f},
-std::array<float,2>{0.110711433f, 0.926359832f},
-std::array<float,2>{0.835618496f, 0.115656003f},
-std::array<float,2>{0.0208385438f, 0.268516153f},
-std::array<float,2>{0.758870304f, 0.688810468f},
-std::array<float,2>{0.395792156f, 0.77723819f},
-std::array<float,2>{0.590920448f, 0.207545176f},
-std::array<float,2>{0.330007195f, 0.0284052528f},
-std::array<float,2>{0.670629203f, 0.944402933f},
-std::array<float,2>{0.194050327f, 0.623873115f},
-std::array<float,2>{0.987944782f, 0.443026096f},
-std::array<float,2>{0.069953762f, 0.0818079039f},
-std::array<float,2>{0.844813883f, 0.890218616f},
-std::array<float,2>{0.472449243f, 0.560495734f},
-std::array<float,2>{0.514167666f, 0.421644092f},
-std::array<float,2>{0.305763692f, 0.346893191f},
-std::array<float,2>{0.725344896f, 0.625289619f},
-std::array<float,2>{0.175991684f, 0.848604023f},
-std::array<float,2>{0.876153588f, 0.167123333f},
-std::array<float,2>{0.222146824f, 0.485192031f},
-std::array<float,2>{0.96686697f, 0.584261775f},
-std::array<float,2>{0.360669166f, 0.996788085f},
-std::array<float,2>{0.651710987f, 0.0579601936f},
-std::array<float,2>{0.427829564f, 0.23416473f},
-std::array<float,2>{0.594790637f, 0.78880012f},
-std::array<float,2>{0.0434798598f, 0.720466137f},
-std::array<float,2>{0.794885933f, 0.309942663f},
-std::array<float,2>{0.0991358832f, 0.218180835f},
-std::array<float,2>{0.82420826f, 0.768624723f},
-std::array<float,2>{0.458289564f, 0.700911522f},
-std::array<float,2>{0.536776721f, 0.275328785f},
-std::array<float,2>{0.262917191f, 0.452797562f},
-std::array<float,2>{0.690305173f, 0.611471176f},
-std::array<float,2>{0.143842623f, 0.946266115f},
-std::array<float,2>{0.931071579f, 0.0209598094f},
-std::array<float,2>{0.217173129f, 0.332462072f},
-std::array<float,2>{0.974878252f, 0.681818187f},
-std::array<float,2>{0.327643186f, 0.821718156f},
-std::array<float,2>{0.684467435f, 0.132417843f},
-std::array<float,2>{0.389810294f, 0.124162383f},
-std::array<float,2>{0.572398841f, 0.934632957f},
-std::array<float,2>{0.0130058005f, 0.508924067f},
-std::array<float,2>{0.77168417f, 0.399076939f},
-std::array<float,2>{0.167184263f, 0.0485638492f},
-std::array<float,2>{0.892907858f, 0.989978433f},
-std::array<float,2>{0.290889144f, 0.588922799f},
-std::array<float,2>{0.747879386f, 0.492325515f},
-std::array<float,2>{0.49161607f, 0.303003013f},
-std::array<float,2>{0.516613007f, 0.731287003f},
-std::array<float,2>{0.0928685367f, 0.794041395f},
-std::array<float,2>{0.86182338f, 0.21881488f},
-std::array<float,2>{0.05406297f, 0.411318988f},
-std::array<float,2>{0.808994651f, 0.549855828f},
-std::array<float,2>{0.407562435f, 0.8806566f},
-std::array<float,2>{0.612164795f, 0.0915044025f},
-std::array<float,2>{0.34969461f, 0.159697056f},
-std::array<float,2>{0.631450117f, 0.856643736f},
-std::array<float,2>{0.240754887f, 0.640319705f},
-std::array<float,2>{0.950469971f, 0.358252138f},
-std::array<float,2>{0.224368408f, 0.142022297f},
-std::array<float,2>{0.963736415f, 0.833112121f},
-std::array<float,2>{0.365386724f, 0.669744313f},
-std::array<float,2>{0.656042278f, 0.320333511f},
-std::array<float,2>{0.42416814f, 0.383989006f},
-std::array<float,2>{0.600247562f, 0.525158823f},
-std::array<float,2>{0.0410680771f, 0.908700109f},
-std::array<float,2>{0.791244209f, 0.107989855f},
-std::array<float,2>{0.0654708743f, 0.250944465f},
-std::array<float,2>{0.848127246f, 0.704206705f},
-std::array<float,2>{0.472919315f, 0.756673396f},
-std::array<float,2>{0.509119511f, 0.201450512f},
-std::array<float,2>{0.309956759f, 0.0118952245f},
-std::array<float,2>{0.719654262f, 0.968453944f},
-std::array<float,2>{0.173024818f, 0.594140708f},
-std::array<float,2>{0.879064798f, 0.465610296f},
-std::array<float,2>{0.0172518995f, 0.0768198967f},
-std::array<float,2>{0.765504956f, 0.902475655f},
-std::array<float,2>{0.391184449f, 0.531483114f},
-std::array<float,2>{0.589299381f, 0.428616464f},
-std::array<float,2>{0.335220546f, 0.370806277f},
-std::array<float,2>{0.665238142f, 0.649182141f},
-std::array<float,2>{0.191285849f, 0.86130172f},
-std::array<float,2>{0.991052151f, 0.185350597f},
-std::array<float,2>{0.131113425f, 0.472089499f},
-std::array<float,2>{0.907760024f, 0.572681427f},
-std::array<float,2>{0.26605463f, 0.976800919f},
-std::array<float,2>{0.703547359f, 0.042114377f},
-std::array<float,2>{0.437512845f, 0.238492563f},
-std::array<float,2>{0.547156155f, 0.802499175f},
-std::array<float,2>{0.116878115f, 0.74730581f},
-std::array<float,2>{0.829027414f, 0.282289535f},
-std::array<float,2>{0.0346933641f, 0.173005536f},
-std::array<float,2>{0.783188641f, 0.872073889f},
-std::array<float,2>{0.430408329f, 0.646352291f},
-std::array<float,2>{0.607497156f, 0.365651906f},
-std::array<float,2>{0.372579604f, 0.433021903f},
-std::array<float,2>{0.646876156f, 0.539794683f},
-std::array<float,2>{0.23048833f, 0.892650843f},
-std::array<float,2>{0.960222006f, 0.0695066229f},
-std::array<float,2>{0.182195574f, 0.290656775f},
-std::array<float,2>{0.890145063f, 0.741916001f},
-std::array<float,2>{0.303892702f, 0.805515289f},
-std::array<float,2>{0.729392946f, 0.24517104f},
-std::array<float,2>{0.479801595f, 0.0343950018f},
-std::array<float,2>{0.503744602f, 0.970838606f},
-std::array<float,2>{0.072495766f, 0.568999231f},
-std::array<float,2>{0.855843306f, 0.482805938f},
-std::array<float,2>{0.198257968f, 0.0962063521f},
-std::array<float,2>{0.992769599f, 0.91945821f},
-std::array<float,2>{0.342804909f, 0.51661998f},
-std::array<float,2>{0.658373535f, 0.381376505f},
-std::array<float,2>{0.405701965f, 0.319843382f},
-std::array<float,2>{0.580147028f, 0.6633237f},
-std::array<float,2>{0.0293290634f, 0.841039717f},
-std::array<float,2>{0.754884839f, 0.148569494f},
-std::array<float,2>{0.11736574f, 0.453487426f},
-std::array<float,2>{0.838165283f, 0.607869685f},
-std::array<float,2>{0.446576804f, 0.958176911f},
-std::array<float,2>{0.557391584f, 0.00420652097f},
-std::array<float,2>{0.277792424f, 0.195303515f},
-std::array<float,2>{0.714217603f, 0.765099347f},
-std::array<float,2>{0.138054699f, 0.712879181f},
-std::array<float,2>{0.916176498f, 0.259386659f},
-std::array<float,2>{0.155382857f, 0.227701381f},
-std::array<float,2>{0.924027205f, 0.78434509f},
-std::array<float,2>{0.256675154f, 0.72303164f},
-std::array<float,2>{0.696994722f, 0.307544887f},
-std::array<float,2>{0.463115007f, 0.489936918f},
-std::array<float,2>{0.544375539f, 0.579725564f},
-std::array<float,2>{0.105499461f, 0.995269775f},
-std::array<float,2>{0.81648308f, 0.0597515069f},
-std::array<float,2>{0.00265369052f, 0.349529713f},
-std::array<float,2>{0.774225116f, 0.628938913f},
-std::array<float,2>{0.380157948f, 0.84541738f},
-std::array<float,2>{0.566998661f, 0.169287369f},
-std::array<float,2>{0.313600034f, 0.0850581974f},
-std::array<float,2>{0.67200017f, 0.883178055f},
-std::array<float,2>{0.203612655f, 0.555251002f},
-std::array<float,2>{0.984264731f, 0.414782822f},
-std::array<float,2>{0.0806885511f, 0.024560051f},
-std::array<float,2>{0.873967886f, 0.941180408f},
-std::array<float,2>{0.49793905f, 0.617772698f},
-std::array<float,2>{0.528388858f, 0.439414352f},
-std::array<float,2>{0.289043367f, 0.271109611f},
-std::array<float,2>{0.736588538f, 0.691636503f},
-std::array<float,2>{0.160955206f, 0.779590964f},
-std::array<float,2>{0.905537724f, 0.206579089f},
-std::array<float,2>{0.248636484f, 0.396922141f},
-std::array<float,2>{0.938129425f, 0.504080474f},
-std::array<float,2>{0.355063975f, 0.924873233f},
-std::array<float,2>{0.63419348f, 0.111468986f},
-std::array<float,2>{0.416175574f, 0.132815674f},
-std::array<float,2>{0.62423414f, 0.818727255f},
-std::array<float,2>{0.0588940829f, 0.676446617f},
-std::array<float,2>{0.80152297f, 0.340662271f},
-std::array<float,2>{0.0758974627f, 0.126367569f},
-std::array<float,2>{0.852850854f, 0.826955676f},
-std::array<float,2>{0.481532693f, 0.685238063f},
-std::array<float,2>{0.505618095f, 0.329729378f},
-std::array<float,2>{0.297244579f, 0.40506804f},
-std::array<float,2>{0.733139455f, 0.514874816f},
-std::array<float,2>{0.185156479f, 0.930637598f},
-std::array<float,2>{0.885458112f, 0.117347509f},
-std::array<float,2>{0.229279533f, 0.277704716f},
-std::array<float,2>{0.955356658f, 0.699155152f},
-std::array<float,2>{0.368465722f, 0.773156047f},
-std::array<float,2>{0.644493282f, 0.213200018f},
-std::array<float,2>{0.435042143f, 0.0163390413f},
-std::array<float,2>{0.605412841f, 0.953062594f},
-std::array<float,2>{0.0365129597f, 0.613383055f},
-std::array<float,2>{0.786589146f, 0.448127389f},
-std::array<float,2>{0.135788858f, 0.0875083879f},
-std::array<float,2>{0.918277919f, 0.876204014f},
-std::array<float,2>{0.275953531f, 0.551291287f},
-std::array<float,2>{0.715283275f, 0.408943444f},
-std::array<float,2>{0.452683955f, 0.354505599f},
-std::array<float,2>{0.561951578f, 0.636502564f},
-std::array<float,2>{0.124793664f, 0.853553712f},
-std::array<float,2>{0.841225564f, 0.160757437f},
-std::array<float,2>{0.0268035159f, 0.498388141f},
-std::array<float,2>{0.752453327f, 0.59319979f},
-std::array<float,2>{0.401230246f, 0.986055911f},
-std::array<float,2>{0.58583796f, 0.0543738678f},
-std::array<float,2>{0.338093549f, 0.224831313f},
-std::array<float,2>{0.66111064f, 0.792249024f},
-std::array<float,2>{0.201139852f, 0.72899127f},
-std::array<float,2>{0.997761011f, 0.296927661f},
-std::array<float,2>{0.208915353f, 0.195462614f},
-std::array<float,2>{0.977558374f, 0.751818061f},
-std::array<float,2>{0.318212718f, 0.710042715f},
-std::array<float,2>{0.676365376f, 0.256960809f},
-std::array<float,2>{0.375257611f, 0.460951179f},
-std::array<float,2>{0.563818753f, 0.600870132f},
-std::array<float,2>{0.00408823369f, 0.962699234f},
-std::array<float,2>{0.779137075f, 0.0108423848f},
-std::array<float,2>{0.103675097f, 0.325120151f},
-std::array<float,2>{0.813390374f, 0.66556865f},
-std::array<float,2>{0.464874148f, 0.831802011f},
-std::array<float,2>{0.542025149f, 0.144631356f},
-std::array<float,2>{0.25062269f, 0.102858476f},
-std::array<float,2>{0.702108443f, 0.913716912f},
-std::array<float,2>{0.151332185f, 0.52759558f},
-std::array<float,2>{0.926652789f, 0.388451993f},
-std::array<float,2>{0.056763079f, 0.0438051969f},
-std::array<float,2>{0.800428092f, 0.982174277f},
-std::array<float,2>{0.418432564f, 0.577937722f},
-std::array<float,2>{0.620625913f, 0.475749582f},
-std::array<float,2>{0.356460392f, 0.28734675f},
-std::array<float,2>{0.637628615f, 0.743243456f},
-std::array<float,2>{0.242995575f, 0.79884398f},
-std::array<float,2>{0.944998443f, 0.235213593f},
-std::array<float,2>{0.158431366f, 0.424662203f},
-std::array<float,2>{0.89940691f, 0.535220444f},
-std::array<float,2>{0.283568233f, 0.899064183f},
-std::array<float,2>{0.741550386f, 0.0734100044f},
-std::array<float,2>{0.49323979f, 0.180778444f},
-std::array<float,2>{0.526891768f, 0.864864051f},
-std::array<float,2>{0.0850108862f, 0.656142831f},
-std::array<float,2>{0.868732631f, 0.37473473f},
-std::array<float,2>{0.00896468945f, 0.246761441f},
-std::array<float,2>{0.769195557f, 0.808832467f},
-std::array<float,2>{0.384280235f, 0.735441983f},
-std::array<float,2>{0.574244082f, 0.293162435f},
-std::array<float,2>{0.323224187f, 0.479567438f},
-std::array<float,2>{0.681841612f, 0.566056013f},
-std::array<float,2>{0.214239582f, 0.973410547f},
-std::array<float,2>{0.969244778f, 0.0358947292f},
-std::array<float,2>{0.147256091f, 0.35977301f},
-std::array<float,2>{0.937267065f, 0.643854797f},
-std::array<float,2>{0.261160254f, 0.868123412f},
-std::array<float,2>{0.692905903f, 0.178038061f},
-std::array<float,2>{0.453267664f, 0.0632396191f},
-std::array<float,2>{0.533144116f, 0.898033261f},
-std::array<float,2>{0.0963609368f, 0.544038773f},
-std::array<float,2>{0.826443136f, 0.43662256f},
-std::array<float,2>{0.236683369f, 0.00239512627f},
-std::array<float,2>{0.946156621f, 0.954015613f},
-std::array<float,2>{0.347276926f, 0.604371369f},
-std::array<float,2>{0.628463805f, 0.457492858f},
-std::array<float,2>{0.410431564f, 0.26339978f},
-std::array<float,2>{0.6168589f, 0.717314482f},
-std::array<float,2>{0.0475041233f, 0.758974075f},
-std::array<float,2>{0.808566093f, 0.18834962f},
-std::array<float,2>{0.088592574f, 0.378534287f},
-std::array<float,2>{0.864907265f, 0.519609272f},
-std::array<float,2>{0.487970591f, 0.917803168f},
-std::array<float,2>{0.521356583f, 0.099312827f},
-std::array<float,2>{0.296121389f, 0.153735995f},
-std::array<float,2>{0.742386281f, 0.837334335f},
-std::array<float,2>{0.169896185f, 0.657978892f},
-std::array<float,2>{0.896412671f, 0.314539701f},
-std::array<float,2>{0.179359451f, 0.165045351f},
-std::array<float,2>{0.877384007f, 0.850813329f},
-std::array<float,2>{0.307191283f, 0.628425002f},
-std::array<float,2>{0.724374354f, 0.344172537f},
-std::array<float,2>{0.47067821f, 0.419391334f},
-std::array<float,2>{0.512215674f, 0.56146884f},
-std::array<float,2>{0.0673250854f, 0.886801362f},
-std::array<float,2>{0.845889688f, 0.0800279006f},
-std::array<float,2>{0.0459554084f, 0.310726047f},
-std::array<float,2>{0.796616673f, 0.722106218f},
-std::array<float,2>{0.42590785f, 0.785247087f},
-std::array<float,2>{0.596160173f, 0.231356055f},
-std::array<float,2>{0.362812579f, 0.0551703498f},
-std::array<float,2>{0.648491263f, 0.998488963f},
-std::array<float,2>{0.220176458f, 0.582870007f},
-std::array<float,2>{0.965337932f, 0.487733722f},
-std::array<float,2>{0.111903578f, 0.113980807f},
-std::array<float,2>{0.833159089f, 0.929360926f},
-std::array<float,2>{0.442685902f, 0.501496732f},
-std::array<float,2>{0.551142216f, 0.392002255f},
-std::array<float,2>{0.271339923f, 0.33935234f},
-std::array<float,2>{0.710110009f, 0.672387421f},
-std::array<float,2>{0.126881927f, 0.81627661f},
-std::array<float,2>{0.91357851f, 0.138006106f},
-std::array<float,2>{0.191414475f, 0.444969535f},
-std::array<float,2>{0.98497355f, 0.622956157f},
-std::array<float,2>{0.331091106f, 0.942793429f},
-std::array<float,2>{0.668840468f, 0.0302389842f},
-std::array<float,2>{0.396927029f, 0.209195003f},
-std::array<float,2>{0.593419671f, 0.774788678f},
-std::array<float,2>{0.0227690116f, 0.690100253f},
-std::array<float,2>{0.761250436f, 0.265988469f},
-std::array<float,2>{0.116114207f, 0.241103366f},
-std::array<float,2>{0.829856753f, 0.803081751f},
-std::array<float,2>{0.439094335f, 0.748097897f},
-std::array<float,2>{0.548798501f, 0.284421772f},
-std::array<float,2>{0.266760468f, 0.469656438f},
-std::array<float,2>{0.704916835f, 0.571664453f},
-std::array<float,2>{0.132630691f, 0.979578733f},
-std::array<float,2>{0.906703949f, 0.040408846f},
-std::array<float,2>{0.189889356f, 0.368193179f},
-std::array<float,2>{0.991866887f, 0.65214175f},
-std::array<float,2>{0.334649533f, 0.86151737f},
-std::array<float,2>{0.664225161f, 0.186808079f},
-std::array<float,2>{0.392122328f, 0.0753481612f},
-std::array<float,2>{0.588509619f, 0.906002641f},
-std::array<float,2>{0.0159364417f, 0.534854412f},
-std::array<float,2>{0.764027536f, 0.426466197f},
-std::array<float,2>{0.17210941f, 0.0149928983f},
-std::array<float,2>{0.880328238f, 0.965002179f},
-std::array<float,2>{0.309314072f, 0.597454071f},
-std::array<float,2>{0.720169067f, 0.46683681f},
-std::array<float,2>{0.474490196f, 0.252485067f},
-std::array<float,2>{0.507954895f, 0.706127822f},
-std::array<float,2>{0.065395467f, 0.754956901f},
-std::array<float,2>{0.848942518f, 0.199267477f},
-std::array<float,2>{0.042275846f, 0.385883689f},
-std::array<float,2>{0.792321861f, 0.526934743f},
-std::array<float,2>{0.424973339f, 0.906729281f},
-std::array<float,2>{0.601391554f, 0.105476491f},
-std::array<float,2>{0.366717547f, 0.143375307f},
-std::array<float,2>{0.65459317f, 0.835266769f},
-std::array<float,2>{0.223116279f, 0.671256959f},
-std::array<float,2>{0.964111805f, 0.324201733f},
-std::array<float,2>{0.241368607f, 0.157001421f},
-std::array<float,2>{0.95000869f, 0.858494103f},
-std::array<float,2>{0.350946903f, 0.637302876f},
-std::array<float,2>{0.6324808f, 0.35556072f},
-std::array<float,2>{0.406938761f, 0.413927883f},
-std::array<float,2>{0.612512171f, 0.547234952f},
-std::array<float,2>{0.052939456f, 0.881629169f},
-std::array<float,2>{0.810213923f, 0.0926076472f},
-std::array<float,2>{0.0927082226f, 0.301301867f},
-std::array<float,2>{0.862847626f, 0.733910501f},
-std::array<float,2>{0.491077185f, 0.795889378f},
-std::array<float,2>{0.515831888f, 0.221968725f},
-std::array<float,2>{0.289677173f, 0.0498291366f},
-std::array<float,2>{0.746246099f, 0.991242647f},
-std::array<float,2>{0.166880623f, 0.587257624f},
-std::array<float,2>{0.893814981f, 0.495822608f},
-std::array<float,2>{0.0122819962f, 0.1228339f},
-std::array<float,2>{0.772657514f, 0.937321961f},
-std::array<float,2>{0.38899985f, 0.510818958f},
-std::array<float,2>{0.573979318f, 0.401459128f},
-std::array<float,2>{0.326978028f, 0.334118366f},
-std::array<float,2>{0.685531318f, 0.68151933f},
-std::array<float,2>{0.218431041f, 0.82368052f},
-std::array<float,2>{0.976169765f, 0.129037619f},
-std::array<float,2>{0.143343106f, 0.450528681f},
-std::array<float,2>{0.930501342f, 0.609928191f},
-std::array<float,2>{0.262133896f, 0.947363377f},
-std::array<float,2>{0.690495729f, 0.0227153692f},
-std::array<float,2>{0.457490355f, 0.21672231f},
-std::array<float,2>{0.536028206f, 0.767416298f},
-std::array<float,2>{0.0981100872f, 0.702665269f},
-std::array<float,2>{0.822449207f, 0.27550599f},
-std::array<float,2>{0.0595942698f, 0.136332318f},
-std::array<float,2>{0.80212146f, 0.818327248f},
-std::array<float,2>{0.4170084f, 0.679026723f},
-std::array<float,2>{0.623186171f, 0.342120379f},
-std::array<float,2>{0.353993595f, 0.395370007f},
-std::array<float,2>{0.633459866f, 0.507524133f},
-std::array<float,2>{0.249732167f, 0.923499823f},
-std::array<float,2>{0.939001858f, 0.110634193f},
-std::array<float,2>{0.161605388f, 0.272107333f},
-std::array<float,2>{0.904611051f, 0.694972157f},
-std::array<float,2>{0.287615627f, 0.777450681f},
-std::array<float,2>{0.737496376f, 0.204084948f},
-std::array<float,2>{0.496974707f, 0.0255432837f},
-std::array<float,2>{0.527570188f, 0.939101279f},
-std::array<float,2>{0.0815814286f, 0.619192302f},
-std::array<float,2>{0.874353051f, 0.439681917f},
-std::array<float,2>{0.204559475f, 0.0823716894f},
-std::array<float,2>{0.983287156f, 0.886573076f},
-std::array<float,2>{0.312678605f, 0.557397902f},
-std::array<float,2>{0.673164606f, 0.416148901f},
-std::array<float,2>{0.379745454f, 0.351172656f},
-std::array<float,2>{0.568231463f, 0.631969094f},
-std::array<float,2>{0.00364325382f, 0.847549021f},
-std::array<float,2>{0.775137484f, 0.171107933f},
-std::array<float,2>{0.106766373f, 0.491442204f},
-std::array<float,2>{0.817587554f, 0.581156433f},
-std::array<float,2>{0.464521289f, 0.993138373f},
-std::array<float,2>{0.543290794f, 0.0617315061f},
-std::array<float,2>{0.257015407f, 0.22929652f},
-std::array<float,2>{0.696089983f, 0.782401979f},
-std::array<float,2>{0.155131295f, 0.725005209f},
-std::array<float,2>{0.92565155f, 0.30587092f},
-std::array<float,2>{0.136967525f, 0.191587731f},
-std::array<float,2>{0.917514801f, 0.762357831f},
-std::array<float,2>{0.278570175f, 0.713183761f},
-std::array<float,2>{0.712937832f, 0.260008633f},
-std::array<float,2>{0.446081668f, 0.456602126f},
-std::array<float,2>{0.557856739f, 0.606674731f},
-std::array<float,2>{0.118925363f, 0.95964098f},
-std::array<float,2>{0.839814663f, 0.0068071261f},
-std::array<float,2>{0.031150924f, 0.316905409f},
-std::array<float,2>{0.754522502f, 0.661284804f},
-std::array<float,2>{0.404638231f, 0.842129588f},
-std::array<float,2>{0.582001209f, 0.151561007f},
-std::array<float,2>{0.342347711f, 0.0944986865f},
-std::array<float,2>{0.659400284f, 0.920643032f},
-std::array<float,2>{0.197887331f, 0.518275738f},
-std::array<float,2>{0.993682683f, 0.378919095f},
-std::array<float,2>{0.0732424259f, 0.0321482681f},
-std::array<float,2>{0.857294559f, 0.970133603f},
-std::array<float,2>{0.479341507f, 0.568265796f},
-std::array<float,2>{0.502851844f, 0.481903464f},
-std::array<float,2>{0.303012371f, 0.291390866f},
-std::array<float,2>{0.730161071f, 0.739252508f},
-std::array<float,2>{0.183380872f, 0.807347178f},
-std::array<float,2>{0.888985991f, 0.242996782f},
-std::array<float,2>{0.2324128f, 0.431414127f},
-std::array<float,2>{0.959318578f, 0.542137861f},
-std::array<float,2>{0.371919483f, 0.891566396f},
-std::array<float,2>{0.647962987f, 0.0670587197f},
-std::array<float,2>{0.430977643f, 0.175541222f},
-std::array<float,2>{0.608494401f, 0.874862254f},
-std::array<float,2>{0.0335734114f, 0.647121072f},
-std::array<float,2>{0.781617641f, 0.364613473f},
-std::array<float,2>{0.0847330391f, 0.183287188f},
-std::array<float,2>{0.867402554f, 0.865705431f},
-std::array<float,2>{0.49309805f, 0.653539896f},
-std::array<float,2>{0.525570869f, 0.372445822f},
-std::array<float,2>{0.284980655f, 0.423763335f},
-std::array<float,2>{0.740253329f, 0.537681639f},
-std::array<float,2>{0.159866899f, 0.900718391f},
-std::array<float,2>{0.900166869f, 0.0716904029f},
-std::array<float,2>{0.243329197f, 0.286310136f},
-std::array<float,2>{0.943549871f, 0.745423377f},
-std::array<float,2>{0.355617821f, 0.798442423f},
-std::array<float,2>{0.638373792f, 0.236712977f},
-std::array<float,2>{0.419135869f, 0.0457989275f},
-std::array<float,2>{0.619691908f, 0.98298645f},
-std::array<float,2>{0.0579910763f, 0.575716078f},
-std::array<float,2>{0.799580455f, 0.474557549f},
-std::array<float,2>{0.152298898f, 0.103677563f},
-std::array<float,2>{0.927383423f, 0.911951303f},
-std::array<float,2>{0.25118804f, 0.52994138f},
-std::array<float,2>{0.702582836f, 0.388721347f},
-std::array<float,2>{0.466142565f, 0.327368855f},
-std::array<float,2>{0.54105401f, 0.667480707f},
-std::array<float,2>{0.105149947f, 0.829736948f},
-std::array<float,2>{0.814210474f, 0.147902459f},
-std::array<float,2>{0.00496528763f, 0.463757843f},
-std::array<float,2>{0.777693868f, 0.597784519f},
-std::array<float,2>{0.376578182f, 0.963187695f},
-std::array<float,2>{0.563135445f, 0.00882112887f},
-std::array<float,2>{0.316747218f, 0.19836393f},
-std::array<float,2>{0.676887572f, 0.752660215f},
-std::array<float,2>{0.207702935f, 0.707722366f},
-std::array<float,2>{0.977193832f, 0.254389733f},
-std::array<float,2>{0.199484289f, 0.224540189f},
-std::array<float,2>{0.996756077f, 0.789922237f},
-std::array<float,2>{0.339830995f, 0.727496624f},
-std::array<float,2>{0.661723197f, 0.299849093f},
-std::array<float,2>{0.402336359f, 0.497026175f},
-std::array<float,2>{0.584881008f, 0.590851128f},
-std::array<float,2>{0.0262092054f, 0.987441659f},
-std::array<float,2>{0.753402054f, 0.0512766205f},
-std::array<float,2>{0.123994835f, 0.352833748f},
-std::array<float,2>{0.840740263f, 0.63447535f},
-std::array<float,2>{0.452072859f, 0.851632237f},
-std::array<float,2>{0.560618997f, 0.162184864f},
-std::array<float,2>{0.276983917f, 0.0883411393f},
-std::array<float,2>{0.715990424f, 0.878081799f},
-std::array<float,2>{0.135231435f, 0.552903175f},
-std::array<float,2>{0.919814467f, 0.406974196f},
-std::array<float,2>{0.0360386856f, 0.0178240966f},
-std::array<float,2>{0.785238922f, 0.95029515f},
-std::array<float,2>{0.434249133f, 0.615346253f},
-std::array<float,2>{0.604071915f, 0.445526958f},
-std::array<float,2>{0.367617995f, 0.280544996f},
-std::array<float,2>{0.642813623f, 0.696846306f},
-std::array<float,2>{0.229636744f, 0.771315694f},
-std::array<float,2>{0.956725299f, 0.211528555f},
-std::array<float,2>{0.184233621f, 0.402909845f},
-std::array<float,2>{0.886165619f, 0.512035012f},
-std::array<float,2>{0.298597485f, 0.932460308f},
-std::array<float,2>{0.733857691f, 0.119966514f},
-std::array<float,2>{0.480562896f, 0.126982793f},
-std::array<float,2>{0.504766047f, 0.824366927f},
-std::array<float,2>{0.074520424f, 0.687464297f},
-std::array<float,2>{0.851591349f, 0.331758946f},
-std::array<float,2>{0.0216221958f, 0.208490223f},
-std::array<float,2>{0.760413706f, 0.775935292f},
-std::array<float,2>{0.398389608f, 0.687699914f},
-std::array<float,2>{0.592475057f, 0.269485503f},
-std::array<float,2>{0.330408812f, 0.442132145f},
-std::array<float,2>{0.668979824f, 0.624588788f},
-std::array<float,2>{0.192749366f, 0.944182754f},
-std::array<float,2>{0.985940635f, 0.0278912764f},
-std::array<float,2>{0.125783235f, 0.336931854f},
-std::array<float,2>{0.912894547f, 0.67449379f},
-std::array<float,2>{0.270054132f, 0.813886881f},
-std::array<float,2>{0.709376097f, 0.13981171f},
-std::array<float,2>{0.441737115f, 0.116637744f},
-std::array<float,2>{0.552369118f, 0.926906705f},
-std::array<float,2>{0.11268346f, 0.503146052f},
-std::array<float,2>{0.832877338f, 0.392896056f},
-std::array<float,2>{0.219561607f, 0.0571722798f},
-std::array<float,2>{0.965928316f, 0.997355938f},
-std::array<float,2>{0.361979067f, 0.585532725f},
-std::array<float,2>{0.650001526f, 0.485741913f},
-std::array<float,2>{0.427461624f, 0.309142917f},
-std::array<float,2>{0.597390115f, 0.719098926f},
-std::array<float,2>{0.0450507924f, 0.788049877f},
-std::array<float,2>{0.795188963f, 0.232678711f},
-std::array<float,2>{0.0674404874f, 0.420347005f},
-std::array<float,2>{0.847393394f, 0.558632374f},
-std::array<float,2>{0.469519436f, 0.889275372f},
-std::array<float,2>{0.512911737f, 0.080190517f},
-std::array<float,2>{0.307962745f, 0.166186959f},
-std::array<float,2>{0.722703934f, 0.848955929f},
-std::array<float,2>{0.177977964f, 0.626779377f},
-std::array<float,2>{0.87832588f, 0.346098304f},
-std::array<float,2>{0.168431491f, 0.155643597f},
-std::array<float,2>{0.895347953f, 0.838507175f},
-std::array<float,2>{0.295209169f, 0.65951544f},
-std::array<float,2>{0.743979156f, 0.312561691f},
-std::array<float,2>{0.486332983f, 0.375252694f},
-std::array<float,2>{0.519967496f, 0.521497846f},
-std::array<float,2>{0.0893353894f, 0.914346635f},
-std::array<float,2>{0.863962412f, 0.100955129f},
-std::array<float,2>{0.0488179661f, 0.264926583f},
-std::array<float,2>{0.807186306f, 0.716252863f},
-std::array<float,2>{0.411285579f, 0.761143804f},
-std::array<float,2>{0.615648687f, 0.189950213f},
-std::array<float,2>{0.345934749f, 0.00149633281f},
-std::array<float,2>{0.626962245f, 0.956798017f},
-std::array<float,2>{0.238215253f, 0.603190243f},
-std::array<float,2>{0.946311951f, 0.460833043f},
-std::array<float,2>{0.0967553407f, 0.0650978014f},
-std::array<float,2>{0.827703357f, 0.89525187f},
-std::array<float,2>{0.454361022f, 0.545733631f},
-std::array<float,2>{0.531692803f, 0.434043795f},
-std::array<float,2>{0.260332346f, 0.362106562f},
-std::array<float,2>{0.691800475f, 0.642200589f},
-std::array<float,2>{0.147523001f, 0.870319188f},
-std::array<float,2>{0.936298192f, 0.177167147f},
-std::array<float,2>{0.21376577f, 0.477473438f},
-std::array<float,2>{0.969864309f, 0.563605964f},
-std::array<float,2>{0.323627055f, 0.976121008f},
-std::array<float,2>{0.683003962f, 0.0379480347f},
-std::array<float,2>{0.383402973f, 0.249853179f},
-std::array<float,2>{0.575715899f, 0.812397003f},
-std::array<float,2>{0.00847309083f, 0.736641467f},
-std::array<float,2>{0.76770395f, 0.295370013f},
-std::array<float,2>{0.0636279583f, 0.202666685f},
-std::array<float,2>{0.850903213f, 0.757110894f},
-std::array<float,2>{0.47594884f, 0.703237832f},
-std::array<float,2>{0.510829747f, 0.25115481f},
-std::array<float,2>{0.311871052f, 0.466629773f},
-std::array<float,2>{0.720718384f, 0.595692158f},
-std::array<float,2>{0.175248429f, 0.967476308f},
-std::array<float,2>{0.880952001f, 0.0131414915f},
-std::array<float,2>{0.226263061f, 0.321667224f},
-std::array<float,2>{0.962595463f, 0.668489516f},
-std::array<float,2>{0.364050776f, 0.832813144f},
-std::array<float,2>{0.653331041f, 0.140652895f},
-std::array<float,2>{0.422854453f, 0.109085292f},
-std::array<float,2>{0.599068046f, 0.909626961f},
-std::array<float,2>{0.0400221162f, 0.523967564f},
-std::array<float,2>{0.789671779f, 0.382917881f},
-std::array<float,2>{0.129360557f, 0.041419737f},
-std::array<float,2>{0.909878254f, 0.97824645f},
-std::array<float,2>{0.26769194f, 0.573343277f},
-std::array<float,2>{0.707017779f, 0.470743686f},
-std::array<float,2>{0.440433383f, 0.281565785f},
-std::array<float,2>{0.55052489f, 0.746713996f},
-std::array<float,2>{0.114458866f, 0.801666737f},
-std::array<float,2>{0.830798328f, 0.239535689f},
-std::array<float,2>{0.0192942359f, 0.429168314f},
-std::array<float,2>{0.762888849f, 0.532519341f},
-std::array<float,2>{0.392974317f, 0.903485358f},
-std::array<float,2>{0.587117016f, 0.0779720545f},
-std::array<float,2>{0.332424939f, 0.183737069f},
-std::array<float,2>{0.667532563f, 0.859771371f},
-std::array<float,2>{0.189364687f, 0.650050223f},
-std::array<float,2>{0.988385856f, 0.36960277f},
-std::array<float,2>{0.216346219f, 0.131546184f},
-std::array<float,2>{0.974574804f, 0.820973575f},
-std::array<float,2>{0.325311363f, 0.682808936f},
-std::array<float,2>{0.686473608f, 0.333717436f},
-std::array<float,2>{0.386784166f, 0.399773091f},
-std::array<float,2>{0.571291327f, 0.507867992f},
-std::array<float,2>{0.0148684466f, 0.93452543f},
-std::array<float,2>{0.769887209f, 0.123292461f},
-std::array<float,2>{0.101258904f, 0.274229497f},
-std::array<float,2>{0.821082592f, 0.699790895f},
-std::array<float,2>{0.459478527f, 0.768376946f},
-std::array<float,2>{0.537839532f, 0.217445016f},
-std::array<float,2>{0.264231116f, 0.0202592872f},
-std::array<float,2>{0.688725948f, 0.946596563f},
-std::array<float,2>{0.142324835f, 0.612598598f},
-std::array<float,2>{0.931745291f, 0.452053934f},
-std::array<float,2>{0.0515479483f, 0.0901958495f},
-std::array<float,2>{0.811088085f, 0.879523516f},
-std::array<float,2>{0.409890413f, 0.549186647f},
-std::array<float,2>{0.609623492f, 0.410817623f},
-std::array<float,2>{0.348174363f, 0.359195054f},
-std::array<float,2>{0.630746126f, 0.639227152f},
-std::array<float,2>{0.239263609f, 0.855934501f},
-std::array<float,2>{0.951184452f, 0.158804983f},
-std::array<float,2>{0.164801046f, 0.493393898f},
-std::array<float,2>{0.890719593f, 0.588260829f},
-std::array<float,2>{0.292582184f, 0.988293707f},
-std::array<float,2>{0.749800682f, 0.0470611341f},
-std::array<float,2>{0.488686115f, 0.219998196f},
-std::array<float,2>{0.51928395f, 0.793627739f},
-std::array<float,2>{0.0910282806f, 0.731640697f},
-std::array<float,2>{0.860433936f, 0.304163158f},
-std::array<float,2>{0.00166359323f, 0.168103352f},
-std::array<float,2>{0.776344597f, 0.844461501f},
-std::array<float,2>{0.380943984f, 0.6302917f},
-std::array<float,2>{0.569362342f, 0.348091304f},
-std::array<float,2>{0.314935714f, 0.415795982f},
-std::array<float,2>{0.6753757f, 0.555874765f},
-std::array<float,2>{0.206242293f, 0.884504199f},
-std::array<float,2>{0.981252372f, 0.0849092975f},
-std::array<float,2>{0.154053718f, 0.307940871f},
-std::array<float,2>{0.923032165f, 0.723809063f},
-std::array<float,2>{0.255300999f, 0.783433259f},
-std::array<float,2>{0.699143052f, 0.226831496f},
-std::array<float,2>{0.461722016f, 0.0587587319f},
-std::array<float,2>{0.545051336f, 0.99496609f},
-std::array<float,2>{0.108284235f, 0.57871145f},
-std::array<float,2>{0.81995368f, 0.489116281f},
-std::array<float,2>{0.247769639f, 0.112795748f},
-std::array<float,2>{0.941183925f, 0.924474001f},
-std::array<float,2>{0.352164775f, 0.505149841f},
-std::array<float,2>{0.636445582f, 0.397660464f},
-std::array<float,2>{0.414874882f, 0.340911031f},
-std::array<float,2>{0.62161231f, 0.677561164f},
-std::array<float,2>{0.0619905293f, 0.820107698f},
-std::array<float,2>{0.803975999f, 0.134669259f},
-std::array<float,2>{0.0794591382f, 0.437981099f},
-std::array<float,2>{0.873010814f, 0.618728161f},
-std::array<float,2>{0.49884811f, 0.939622283f},
-std::array<float,2>{0.529824257f, 0.0243079327f},
-std::array<float,2>{0.286575049f, 0.205187842f},
-std::array<float,2>{0.735183537f, 0.78106308f},
-std::array<float,2>{0.163774163f, 0.692675292f},
-std::array<float,2>{0.902511954f, 0.270251751f},
-std::array<float,2>{0.179847762f, 0.244466439f},
-std::array<float,2>{0.88806814f, 0.806354165f},
-std::array<float,2>{0.300924897f, 0.740700483f},
-std::array<float,2>{0.727761149f, 0.289865434f},
-std::array<float,2>{0.477214962f, 0.483710349f},
-std::array<float,2>{0.500780821f, 0.569662154f},
-std::array<float,2>{0.0714687631f, 0.97182411f},
-std::array<float,2>{0.85856545f, 0.033406958f},
-std::array<float,2>{0.0326365232f, 0.367162794f},
-std::array<float,2>{0.7835958f, 0.645462692f},
-std::array<float,2>{0.431757689f, 0.871549308f},
-std::array<float,2>{0.606295049f, 0.172577932f},
-std::array<float,2>{0.374919206f, 0.0688357949f},
-std::array<float,2>{0.645493031f, 0.894423842f},
-std::array<float,2>{0.233977646f, 0.540212572f},
-std::array<float,2>{0.95794487f, 0.432059705f},
-std::array<float,2>{0.119993754f, 0.00521260593f},
-std::array<float,2>{0.837415636f, 0.957161784f},
-std::array<float,2>{0.448336601f, 0.608661473f},
-std::array<float,2>{0.555390656f, 0.454216927f},
-std::array<float,2>{0.280043155f, 0.25785476f},
-std::array<float,2>{0.711869359f, 0.711536229f},
-std::array<float,2>{0.140566036f, 0.763919532f},
-std::array<float,2>{0.914548874f, 0.193783656f},
-std::array<float,2>{0.1965435f, 0.38255924f},
-std::array<float,2>{0.995249152f, 0.516093552f},
-std::array<float,2>{0.339895576f, 0.918412447f},
-std::array<float,2>{0.656530857f, 0.0968485549f},
-std::array<float,2>{0.403800875f, 0.149854288f},
-std::array<float,2>{0.580057025f, 0.84050715f},
-std::array<float,2>{0.0283648837f, 0.662664831f},
-std::array<float,2>{0.756287992f, 0.318903744f},
-std::array<float,2>{0.102056436f, 0.145545647f},
-std::array<float,2>{0.816141844f, 0.830223799f},
-std::array<float,2>{0.467601746f, 0.664239824f},
-std::array<float,2>{0.540497184f, 0.32522139f},
-std::array<float,2>{0.253541112f, 0.387655973f},
-std::array<float,2>{0.701125979f, 0.528623104f},
-std::array<float,2>{0.149274871f, 0.913049698f},
-std::array<float,2>{0.929319561f, 0.102170289f},
-std::array<float,2>{0.210402429f, 0.256501585f},
-std::array<float,2>{0.979098499f, 0.709394872f},
-std::array<float,2>{0.318380713f, 0.750430524f},
-std::array<float,2>{0.678861916f, 0.197192013f},
-std::array<float,2>{0.377667338f, 0.010700535f},
-std::array<float,2>{0.565580606f, 0.961102784f},
-std::array<float,2>{0.0073536397f, 0.600141704f},
-std::array<float,2>{0.779801488f, 0.462823719f},
-std::array<float,2>{0.156573877f, 0.0725984648f},
-std::array<float,2>{0.900936186f, 0.899563611f},
-std::array<float,2>{0.282498151f, 0.536512136f},
-std::array<float,2>{0.739793897f, 0.425416142f},
-std::array<float,2>{0.494856387f, 0.373783708f},
-std::array<float,2>{0.525216341f, 0.654985487f},
-std::array<float,2>{0.0835582539f, 0.864156842f},
-std::array<float,2>{0.870078444f, 0.180391029f},
-std::array<float,2>{0.0552503467f, 0.474755347f},
-std::array<float,2>{0.797626257f, 0.576890588f},
-std::array<float,2>{0.420526952f, 0.981048226f},
-std::array<float,2>{0.618204236f, 0.044140283f},
-std::array<float,2>{0.358363092f, 0.235843197f},
-std::array<float,2>{0.64011699f, 0.800100923f},
-std::array<float,2>{0.24596937f, 0.742240369f},
-std::array<float,2>{0.942756116f, 0.288491815f},
-std::array<float,2>{0.226911649f, 0.213980287f},
-std::array<float,2>{0.953973591f, 0.772130966f},
-std::array<float,2>{0.370642424f, 0.698170543f},
-std::array<float,2>{0.641706705f, 0.278645992f},
-std::array<float,2>{0.435710281f, 0.449201643f},
-std::array<float,2>{0.602683067f, 0.614953876f},
-std::array<float,2>{0.0382910781f, 0.951915264f},
-std::array<float,2>{0.787163854f, 0.0167844109f},
-std::array<float,2>{0.0766975805f, 0.329070181f},
-std::array<float,2>{0.854466379f, 0.684424162f},
-std::array<float,2>{0.48409307f, 0.827488005f},
-std::array<float,2>{0.50680846f, 0.125310868f},
-std::array<float,2>{0.299773455f, 0.119017743f},
-std::array<float,2>{0.730743527f, 0.931137621f},
-std::array<float,2>{0.187066838f, 0.513901949f},
-std::array<float,2>{0.883789182f, 0.405440599f},
-std::array<float,2>{0.0249853749f, 0.0529880412f},
-std::array<float,2>{0.75110358f, 0.984536409f},
-std::array<float,2>{0.399469584f, 0.592412829f},
-std::array<float,2>{0.583424866f, 0.499492079f},
-std::array<float,2>{0.336983234f, 0.298754036f},
-std::array<float,2>{0.662702799f, 0.72985369f},
-std::array<float,2>{0.201658249f, 0.791285634f},
-std::array<float,2>{0.998131037f, 0.226102769f},
-std::array<float,2>{0.134168163f, 0.409981757f},
-std::array<float,2>{0.920364141f, 0.55210346f},
-std::array<float,2>{0.274826288f, 0.875092387f},
-std::array<float,2>{0.718566358f, 0.0861312747f},
-std::array<float,2>{0.450464755f, 0.161336347f},
-std::array<float,2>{0.559446454f, 0.855024993f},
-std::array<float,2>{0.121655881f, 0.63504231f},
-std::array<float,2>{0.841817558f, 0.353921503f},
-std::array<float,2>{0.0440553948f, 0.23197104f},
-std::array<float,2>{0.793026984f, 0.786683917f},
-std::array<float,2>{0.429382026f, 0.721090853f},
-std::array<float,2>{0.594559431f, 0.311929792f},
-std::array<float,2>{0.359449148f, 0.487281442f},
-std::array<float,2>{0.650727451f, 0.583799124f},
-std::array<float,2>{0.22156997f, 0.999194682f},
-std::array<float,2>{0.96802479f, 0.0557669625f},
-std::array<float,2>{0.177534953f, 0.345344305f},
-std::array<float,2>{0.875184953f, 0.627087176f},
-std::array<float,2>{0.305491865f, 0.849945247f},
-std::array<float,2>{0.726050615f, 0.164324f},
-std::array<float,2>{0.471518576f, 0.0785188451f},
-std::array<float,2>{0.514661193f, 0.888385952f},
-std::array<float,2>{0.0693220645f, 0.561711192f},
-std::array<float,2>{0.844221115f, 0.418253183f},
-std::array<float,2>{0.194409102f, 0.0304275956f},
-std::array<float,2>{0.987189531f, 0.941788375f},
-std::array<float,2>{0.328488648f, 0.621685565f},
-std::array<float,2>{0.671626329f, 0.44367227f},
-std::array<float,2>{0.395336181f, 0.266980827f},
-std::array<float,2>{0.590756416f, 0.691153288f},
-std::array<float,2>{0.0198828746f, 0.773741126f},
-std::array<float,2>{0.758426905f, 0.210728243f},
-std::array<float,2>{0.110210739f, 0.391492844f},
-std::array<float,2>{0.834702075f, 0.500286341f},
-std::array<float,2>{0.443931311f, 0.927893758f},
-std::array<float,2>{0.553532183f, 0.114449166f},
-std::array<float,2>{0.27334258f, 0.137302116f},
-std::array<float,2>{0.708428502f, 0.814623892f},
-std::array<float,2>{0.128496513f, 0.673201025f},
-std::array<float,2>{0.911673665f, 0.338674933f},
-std::array<float,2>{0.144975424f, 0.178774029f},
-std::array<float,2>{0.933762133f, 0.869013727f},
-std::array<float,2>{0.259024292f, 0.643111706f},
-std::array<float,2>{0.694484174f, 0.36058262f},
-std::array<float,2>{0.455348969f, 0.435806155f},
-std::array<float,2>{0.533632934f, 0.543430924f},
-std::array<float,2>{0.0941805393f, 0.897081137f},
-std::array<float,2>{0.825886726f, 0.0638477206f},
-std::array<float,2>{0.00981150661f, 0.294315696f},
-std::array<float,2>{0.766584754f, 0.734457612f},
-std::array<float,2>{0.385992169f, 0.809615552f},
-std::array<float,2>{0.577237248f, 0.247687504f},
-std::array<float,2>{0.320741266f, 0.0362287126f},
-std::array<float,2>{0.680343986f, 0.974022031f},
-std::array<float,2>{0.212076679f, 0.564552486f},
-std::array<float,2>{0.971663356f, 0.479143173f},
-std::array<float,2>{0.0866687f, 0.0979437307f},
-std::array<float,2>{0.86683321f, 0.916976094f},
-std::array<float,2>{0.48544094f, 0.520917833f},
-std::array<float,2>{0.522400558f, 0.377326161f},
-std::array<float,2>{0.294016123f, 0.315963328f},
-std::array<float,2>{0.745233476f, 0.657095671f},
-std::array<float,2>{0.171604186f, 0.836088836f},
-std::array<float,2>{0.897994339f, 0.153017774f},
-std::array<float,2>{0.234542638f, 0.458399296f},
-std::array<float,2>{0.949147165f, 0.605162978f},
-std::array<float,2>{0.344505131f, 0.954230666f},
-std::array<float,2>{0.626106441f, 0.00329052261f},
-std::array<float,2>{0.41396001f, 0.189273387f},
-std::array<float,2>{0.613367915f, 0.758684933f},
-std::array<float,2>{0.0490243472f, 0.718705416f},
-std::array<float,2>{0.806636631f, 0.261749953f},
-std::array<float,2>{0.082570456f, 0.236426964f},
-std::array<float,2>{0.87034744f, 0.798707426f},
-std::array<float,2>{0.495723248f, 0.745292842f},
-std::array<float,2>{0.524350226f, 0.286416322f},
-std::array<float,2>{0.281732529f, 0.474335402f},
-std::array<float,2>{0.738722265f, 0.575999796f},
-std::array<float,2>{0.157243237f, 0.983298242f},
-std::array<float,2>{0.901531041f, 0.0455365777f},
-std::array<float,2>{0.244827807f, 0.372118801f},
-std::array<float,2>{0.942047417f, 0.653786898f},
-std::array<float,2>{0.359367788f, 0.865266263f},
-std::array<float,2>{0.639334917f, 0.183526635f},
-std::array<float,2>{0.421683967f, 0.0714817941f},
-std::array<float,2>{0.617540658f, 0.900597274f},
-std::array<float,2>{0.0564945191f, 0.538083673f},
-std::array<float,2>{0.798487723f, 0.42347616f},
-std::array<float,2>{0.149650767f, 0.00904254802f},
-std::array<float,2>{0.928228915f, 0.963057518f},
-std::array<float,2>{0.252537847f, 0.59806031f},
-std::array<float,2>{0.699606538f, 0.463498533f},
-std::array<float,2>{0.467974931f, 0.254135817f},
-std::array<float,2>{0.539614558f, 0.707894862f},
-std::array<float,2>{0.10341946f, 0.75286752f},
-std::array<float,2>{0.815102816f, 0.198584765f},
-std::array<float,2>{0.00611379417f, 0.38907516f},
-std::array<float,2>{0.781085908f, 0.530248523f},
-std::array<float,2>{0.37858811f, 0.911847353f},
-std::array<float,2>{0.565407455f, 0.103995435f},
-std::array<float,2>{0.320071459f, 0.147677377f},
-std::array<float,2>{0.678218544f, 0.829922855f},
-std::array<float,2>{0.209596261f, 0.667892814f},
-std::array<float,2>{0.979838073f, 0.327630788f},
-std::array<float,2>{0.202482179f, 0.162461072f},
-std::array<float,2>{0.999795616f, 0.851866007f},
-std::array<float,2>{0.336041361f, 0.634619534f},
-std::array<float,2>{0.66339922f, 0.352589935f},
-std::array<float,2>{0.398950756f, 0.407172263f},
-std::array<float,2>{0.582604289f, 0.552987814f},
-std::array<float,2>{0.0237900876f, 0.878187537f},
-std::array<float,2>{0.750654399f, 0.0878947079f},
-std::array<float,2>{0.122776136f, 0.300060242f},
-std::array<float,2>{0.843315005f, 0.727106631f},
-std::array<float,2>{0.449463248f, 0.789725244f},
-std::array<float,2>{0.56051749f, 0.224198878f},
-std::array<float,2>{0.273500055f, 0.0516793802f},
-std::array<float,2>{0.717544496f, 0.987676322f},
-std::array<float,2>{0.132868409f, 0.59127593f},
-std::array<float,2>{0.921330035f, 0.496774048f},
-std::array<float,2>{0.0377510674f, 0.119705878f},
-std::array<float,2>{0.788124919f, 0.932267666f},
-std::array<float,2>{0.436927229f, 0.511952996f},
-std::array<float,2>{0.601904929f, 0.403266937f},
-std::array<float,2>{0.36961332f, 0.331903785f},
-std::array<float,2>{0.641036034f, 0.687022567f},
-std::array<float,2>{0.228273124f, 0.824488699f},
-std::array<float,2>{0.955070674f, 0.127424523f},
-std::array<float,2>{0.185882479f, 0.445752889f},
-std::array<float,2>{0.883409441f, 0.615699053f},
-std::array<float,2>{0.300762713f, 0.950663328f},
-std::array<float,2>{0.732382178f, 0.0178090185f},
-std::array<float,2>{0.482703418f, 0.211871386f},
-std::array<float,2>{0.507428885f, 0.771185577f},
-std::array<float,2>{0.0778021738f, 0.697191656f},
-std::array<float,2>{0.855203092f, 0.280312598f},
-std::array<float,2>{0.0211698599f, 0.140013888f},
-std::array<float,2>{0.759700537f, 0.813554108f},
-std::array<float,2>{0.396177441f, 0.674604952f},
-std::array<float,2>{0.591656387f, 0.337306112f},
-std::array<float,2>{0.32948491f, 0.392677158f},
-std::array<float,2>{0.670330048f, 0.503416479f},
-std::array<float,2>{0.193731382f, 0.927011073f},
-std::array<float,2>{0.98768276f, 0.116352968f},
-std::array<float,2>{0.127737045f, 0.269141465f},
-std::array<float,2>{0.910278976f, 0.687833786f},
-std::array<float,2>{0.27238518f, 0.77613008f},
-std::array<float,2>{0.707114339f, 0.208171636f},
-std::array<float,2>{0.445143104f, 0.0280999299f},
-std::array<float,2>{0.554340422f, 0.943893194f},
-std::array<float,2>{0.111248314f, 0.624880195f},
-std::array<float,2>{0.83533901f, 0.442284167f},
-std::array<float,2>{0.222334921f, 0.080463782f},
-std::array<float,2>{0.967734694f, 0.889613569f},
-std::array<float,2>{0.36114338f, 0.559069872f},
-std::array<float,2>{0.652182341f, 0.420140445f},
-std::array<float,2>{0.428248107f, 0.345708817f},
-std::array<float,2>{0.595300317f, 0.626708388f},
-std::array<float,2>{0.0429877341f, 0.84874332f},
-std::array<float,2>{0.794391513f, 0.166479528f},
-std::array<float,2>{0.0694875345f, 0.485544324f},
-std::array<float,2>{0.845606804f, 0.585769176f},
-std::array<float,2>{0.471738905f, 0.997305989f},
-std::array<float,2>{0.513917029f, 0.0574285872f},
-std::array<float,2>{0.30624032f, 0.232649133f},
-std::array<float,2>{0.72491616f, 0.787810206f},
-std::array<float,2>{0.176724449f, 0.718881905f},
-std::array<float,2>{0.876701415f, 0.309529901f},
-std::array<float,2>{0.170503482f, 0.190369561f},
-std::array<float,2>{0.897043586f, 0.760982335f},
-std::array<float,2>{0.293487161f, 0.715941429f},
-std::array<float,2>{0.744157732f, 0.264791965f},
-std::array<float,2>{0.484394401f, 0.460519999f},
-std::array<float,2>{0.522576034f, 0.603438377f},
-std::array<float,2>{0.0870568305f, 0.956751049f},
-std::array<float,2>{0.865374386f, 0.00174143189f},
-std::array<float,2>{0.0505223945f, 0.312754154f},
-std::array<float,2>{0.805474818f, 0.659335554f},
-std::array<float,2>{0.412392735f, 0.838714421f},
-std::array<float,2>{0.614412606f, 0.155296236f},
-std::array<float,2>{0.345071495f, 0.100811452f},
-std::array<float,2>{0.625278115f, 0.914103091f},
-std::array<float,2>{0.235782921f, 0.521943271f},
-std::array<float,2>{0.947901785f, 0.375032544f},
-std::array<float,2>{0.0951416492f, 0.0377246588f},
-std::array<float,2>{0.824603856f, 0.976442516f},
-std::array<float,2>{0.45630461f, 0.563899994f},
-std::array<float,2>{0.534417391f, 0.4772093f},
-std::array<float,2>{0.257997334f, 0.294964105f},
-std::array<float,2>{0.694103181f, 0.736559033f},
-std::array<float,2>{0.145934135f, 0.812039673f},
-std::array<float,2>{0.934968352f, 0.249519572f},
-std::array<float,2>{0.211260736f, 0.433699727f},
-std::array<float,2>{0.972216964f, 0.545597255f},
-std::array<float,2>{0.321429282f, 0.895400465f},
-std::array<float,2>{0.681105316f, 0.0654127151f},
-std::array<float,2>{0.385167867f, 0.176969618f},
-std::array<float,2>{0.576678157f, 0.870369613f},
-std::array<float,2>{0.0112935873f, 0.642422795f},
-std::array<float,2>{0.766936481f, 0.361867964f},
-std::array<float,2>{0.113408938f, 0.186535284f},
-std::array<float,2>{0.832004368f, 0.861753821f},
-std::array<float,2>{0.440323085f, 0.651984751f},
-std::array<float,2>{0.549185514f, 0.368417799f},
-std::array<float,2>{0.268712103f, 0.426652521f},
-std::array<float,2>{0.705384552f, 0.535037994f},
-std::array<float,2>{0.130044848f, 0.906050622f},
-std::array<float,2>{0.908206999f, 0.0754758492f},
-std::array<float,2>{0.188467145f, 0.284568667f},
-std::array<float,2>{0.989641726f, 0.748300493f},
-std::array<float,2>{0.333533973f, 0.802816451f},
-std::array<float,2>{0.666627288f, 0.240904391f},
-std::array<float,2>{0.394251913f, 0.0402791761f},
-std::array<float,2>{0.586499989f, 0.97989738f},
-std::array<float,2>{0.0176338982f, 0.571409166f},
-std::array<float,2>{0.762021184f, 0.469296783f},
-std::array<float,2>{0.174138114f, 0.105872184f},
-std::array<float,2>{0.882431924f, 0.906432867f},
-std::array<float,2>{0.310671717f, 0.527314067f},
-std::array<float,2>{0.722046018f, 0.386005968f},
-std::array<float,2>{0.475164354f, 0.323936075f},
-std::array<float,2>{0.509970307f, 0.670997918f},
-std::array<float,2>{0.0631963834f, 0.834961176f},
-std::array<float,2>{0.849912703f, 0.143277898f},
-std::array<float,2>{0.0409774855f, 0.46717298f},
-std::array<float,2>{0.79071486f, 0.597185135f},
-std::array<float,2>{0.422111303f, 0.965185463f},
-std::array<float,2>{0.598505378f, 0.0148396753f},
-std::array<float,2>{0.364311427f, 0.199479282f},
-std::array<float,2>{0.652864635f, 0.755354404f},
-std::array<float,2>{0.225346357f, 0.706454098f},
-std::array<float,2>{0.961671054f, 0.252707779f},
-std::array<float,2>{0.239192873f, 0.221684679f},
-std::array<float,2>{0.952824831f, 0.795525551f},
-std::array<float,2>{0.349202216f, 0.734302521f},
-std::array<float,2>{0.629277766f, 0.301676929f},
-std::array<float,2>{0.408962011f, 0.496072501f},
-std::array<float,2>{0.610555351f, 0.58709234f},
-std::array<float,2>{0.0522189774f, 0.991508126f},
-std::array<float,2>{0.812153161f, 0.0501094572f},
-std::array<float,2>{0.0906080306f, 0.355826348f},
-std::array<float,2>{0.859551966f, 0.63745904f},
-std::array<float,2>{0.490148246f, 0.858833313f},
-std::array<float,2>{0.518364668f, 0.156902656f},
-std::array<float,2>{0.291358173f, 0.0924996659f},
-std::array<float,2>{0.74882102f, 0.881409109f},
-std::array<float,2>{0.165933236f, 0.54711777f},
-std::array<float,2>{0.892146647f, 0.413649231f},
-std::array<float,2>{0.0143375993f, 0.0225720033f},
-std::array<float,2>{0.770720482f, 0.947709203f},
-std::array<float,2>{0.388146728f, 0.610282183f},
-std::array<float,2>{0.571282744f, 0.450320363f},
-std::array<float,2>{0.324979603f, 0.275806218f},
-std::array<float,2>{0.687417328f, 0.703040302f},
-std::array<float,2>{0.215610445f, 0.767202675f},
-std::array<float,2>{0.973143995f, 0.216472626f},
-std::array<float,2>{0.1408225f, 0.401742518f},
-std::array<float,2>{0.933266759f, 0.511032343f},
-std::array<float,2>{0.265147239f, 0.937241971f},
-std::array<float,2>{0.687511861f, 0.122619972f},
-std::array<float,2>{0.460387737f, 0.129171968f},
-std::array<float,2>{0.538149238f, 0.823364913f},
-std::array<float,2>{0.100395292f, 0.681280792f},
-std::array<float,2>{0.82182765f, 0.334337056f},
-std::array<float,2>{0.0612376742f, 0.203855455f},
-std::array<float,2>{0.802806556f, 0.777796805f},
-std::array<float,2>{0.415096819f, 0.695089698f},
-std::array<float,2>{0.622772455f, 0.272398978f},
-std::array<float,2>{0.353369117f, 0.439840376f},
-std::array<float,2>{0.635358095f, 0.619414628f},
-std::array<float,2>{0.246999189f, 0.939391017f},
-std::array<float,2>{0.940274656f, 0.0257743262f},
-std::array<float,2>{0.162691757f, 0.341952592f},
-std::array<float,2>{0.903862953f, 0.678814769f},
-std::array<float,2>{0.286097407f, 0.817979395f},
-std::array<float,2>{0.736036062f, 0.136633337f},
-std::array<float,2>{0.499707073f, 0.110488832f},
-std::array<float,2>{0.530587733f, 0.923780203f},
-std::array<float,2>{0.0783558935f, 0.507791877f},
-std::array<float,2>{0.87147516f, 0.395164132f},
-std::array<float,2>{0.205622315f, 0.0618280061f},
-std::array<float,2>{0.981828392f, 0.992712617f},
-std::array<float,2>{0.316350281f, 0.5814026f},
-std::array<float,2>{0.674684942f, 0.491675019f},
-std::array<float,2>{0.382227778f, 0.306042939f},
-std::array<float,2>{0.569123566f, 0.724787235f},
-std::array<float,2>{0.000595736026f, 0.782549083f},
-std::array<float,2>{0.776530623f, 0.229246706f},
-std::array<float,2>{0.108986318f, 0.416413069f},
-std::array<float,2>{0.819051027f, 0.557206154f},
-std::array<float,2>{0.462829977f, 0.886384487f},
-std::array<float,2>{0.546097577f, 0.0820649713f},
-std::array<float,2>{0.254590005f, 0.171185598f},
-std::array<float,2>{0.697646141f, 0.847254336f},
-std::array<float,2>{0.153158665f, 0.632299781f},
-std::array<float,2>{0.922652602f, 0.351440251f},
-std::array<float,2>{0.139490128f, 0.151673302f},
-std::array<float,2>{0.915322781f, 0.841843128f},
-std::array<float,2>{0.280336082f, 0.661466539f},
-std::array<float,2>{0.71205157f, 0.317228526f},
-std::array<float,2>{0.447729796f, 0.379270941f},
-std::array<float,2>{0.555928469f, 0.518391848f},
-std::array<float,2>{0.120132253f, 0.920725226f},
-std::array<float,2>{0.836478949f, 0.0943378285f},
-std::array<float,2>{0.027434716f, 0.260015488f},
-std::array<float,2>{0.75699532f, 0.712946892f},
-std::array<float,2>{0.402984202f, 0.762613833f},
-std::array<float,2>{0.579055727f, 0.191694617f},
-std::array<float,2>{0.341271967f, 0.00653564138f},
-std::array<float,2>{0.65808332f, 0.959956706f},
-std::array<float,2>{0.195394963f, 0.606752276f},
-std::array<float,2>{0.994527638f, 0.456853509f},
-std::array<float,2>{0.0704186484f, 0.0673037842f},
-std::array<float,2>{0.858031332f, 0.891162813f},
-std::array<float,2>{0.478337079f, 0.542278469f},
-std::array<float,2>{0.501360953f, 0.431167334f},
-std::array<float,2>{0.30236873f, 0.364491731f},
-std::array<float,2>{0.726654828f, 0.647249579f},
-std::array<float,2>{0.180878654f, 0.874523044f},
-std::array<float,2>{0.887533903f, 0.175453901f},
-std::array<float,2>{0.23289597f, 0.481665671f},
-std::array<float,2>{0.958312571f, 0.568023264f},
-std::array<float,2>{0.373290688f, 0.969788909f},
-std::array<float,2>{0.646275103f, 0.0318342559f},
-std::array<float,2>{0.433586627f, 0.242736444f},
-std::array<float,2>{0.60716182f, 0.807540536f},
-std::array<float,2>{0.0313433073f, 0.738825917f},
-std::array<float,2>{0.78502357f, 0.291017205f},
-std::array<float,2>{0.104279168f, 0.19678326f},
-std::array<float,2>{0.812878788f, 0.750185728f},
-std::array<float,2>{0.465668708f, 0.708993852f},
-std::array<float,2>{0.542787254f, 0.256683439f},
-std::array<float,2>{0.25035733f, 0.462536305f},
-std::array<float,2>{0.701297998f, 0.600577414f},
-std::array<float,2>{0.150551647f, 0.96136421f},
-std::array<float,2>{0.925881863f, 0.0104530128f},
-std::array<float,2>{0.208088785f, 0.325644225f},
-std::array<float,2>{0.978075206f, 0.664488852f},
-std::array<float,2>{0.31774807f, 0.830342591f},
-std::array<float,2>{0.675986826f, 0.145956516f},
-std::array<float,2>{0.375613511f, 0.10232354f},
-std::array<float,2>{0.564031422f, 0.912619412f},
-std::array<float,2>{0.00472121034f, 0.528561771f},
-std::array<float,2>{0.778397501f, 0.387239903f},
-std::array<float,2>{0.15875791f, 0.0443772338f},
-std::array<float,2>{0.898848176f, 0.981242836f},
-std::array<float,2>{0.283925325f, 0.577147961f},
-std::array<float,2>{0.742090642f, 0.475077242f},
-std::array<float,2>{0.494076967f, 0.288097709f},
-std::array<float,2>{0.526546121f, 0.742497385f},
-std::array<float,2>{0.0854561031f, 0.800011218f},
-std::array<float,2>{0.868345678f, 0.23623319f},
-std::array<float,2>{0.0572018623f, 0.425620049f},
-std::array<float,2>{0.800027668f, 0.536252797f},
-std::array<float,2>{0.418944269f, 0.899852216f},
-std::array<float,2>{0.620522499f, 0.0724627748f},
-std::array<float,2>{0.356975168f, 0.180571496f},
-std::array<float,2>{0.636917651f, 0.863930583f},
-std::array<float,2>{0.242639393f, 0.655050159f},
-std::array<float,2>{0.944342613f, 0.373552203f},
-std::array<float,2>{0.228581548f, 0.125235423f},
-std::array<float,2>{0.955604851f, 0.827286065f},
-std::array<float,2>{0.368884146f, 0.684209585f},
-std::array<float,2>{0.644006133f, 0.328658581f},
-std::array<float,2>{0.435260504f, 0.405582547f},
-std::array<float,2>{0.604593277f, 0.513927877f},
-std::array<float,2>{0.0367918834f, 0.930838943f},
-std::array<float,2>{0.786896467f, 0.118813507f},
-std::array<float,2>{0.0754678622f, 0.27842325f},
-std::array<float,2>{0.853505671f, 0.697926223f},
-std::array<float,2>{0.482221127f, 0.772306681f},
-std::array<float,2>{0.505192816f, 0.214179367f},
-std::array<float,2>{0.297698289f, 0.0169957988f},
-std::array<float,2>{0.732555866f, 0.951902986f},
-std::array<float,2>{0.184715629f, 0.615081012f},
-std::array<float,2>{0.885006011f, 0.448856086f},
-std::array<float,2>{0.0272755604f, 0.0862478092f},
-std::array<float,2>{0.752148926f, 0.875387788f},
-std::array<float,2>{0.40061599f, 0.551915407f},
-std::array<float,2>{0.585116684f, 0.409746855f},
-std::array<float,2>{0.338862538f, 0.353564411f},
-std::array<float,2>{0.660603285f, 0.634780884f},
-std::array<float,2>{0.200470209f, 0.85533452f},
-std::array<float,2>{0.997317314f, 0.161594689f},
-std::array<float,2>{0.136711836f, 0.499115586f},
-std::array<float,2>{0.918682754f, 0.592689931f},
-std::array<float,2>{0.275572002f, 0.984826148f},
-std::array<float,2>{0.715385079f, 0.0529492795f},
-std::array<float,2>{0.452250898f, 0.226385996f},
-std::array<float,2>{0.562243581f, 0.791230559f},
-std::array<float,2>{0.124063164f, 0.729707599f},
-std::array<float,2>{0.841762424f, 0.298446178f},
-std::array<float,2>{0.0467569157f, 0.164254189f},
-std::array<float,2>{0.796180129f, 0.849646747f},
-std::array<float,2>{0.426657557f, 0.627323806f},
-std::array<float,2>{0.596563041f, 0.345583618f},
-std::array<float,2>{0.362357229f, 0.418125004f},
-std::array<float,2>{0.649271488f, 0.561786115f},
-std::array<float,2>{0.220541179f, 0.888438582f},
-std::array<float,2>{0.965007365f, 0.0782146975f},
-std::array<float,2>{0.178990096f, 0.311587274f},
-std::array<float,2>{0.877912521f, 0.720837474f},
-std::array<float,2>{0.307126313f, 0.786942303f},
-std::array<float,2>{0.724061191f, 0.232303202f},
-std::array<float,2>{0.470110089f, 0.0560404658f},
-std::array<float,2>{0.511859f, 0.999384105f},
-std::array<float,2>{0.0668027103f, 0.583513439f},
-std::array<float,2>{0.846569419f, 0.487020731f},
-std::array<float,2>{0.192135319f, 0.114704989f},
-std::array<float,2>{0.984466195f, 0.928100944f},
-std::array<float,2>{0.331790894f, 0.500065148f},
-std::array<float,2>{0.668329537f, 0.391173571f},
-std::array<float,2>{0.397042751f, 0.338569343f},
-std::array<float,2>{0.593198895f, 0.673070073f},
-std::array<float,2>{0.023050271f, 0.814900875f},
-std::array<float,2>{0.761185646f, 0.13748692f},
-std::array<float,2>{0.11140503f, 0.443377405f},
-std::array<float,2>{0.833803952f, 0.62194705f},
-std::array<float,2>{0.443059742f, 0.941583991f},
-std::array<float,2>{0.551403642f, 0.0306108911f},
-std::array<float,2>{0.270976096f, 0.210604191f},
-std::array<float,2>{0.710777521f, 0.773591578f},
-std::array<float,2>{0.125998423f, 0.691203117f},
-std::array<float,2>{0.913326144f, 0.266706884f},
-std::array<float,2>{0.14694728f, 0.247817427f},
-std::array<float,2>{0.936930478f, 0.809911549f},
-std::array<float,2>{0.261336923f, 0.734773576f},
-std::array<float,2>{0.692806721f, 0.294126779f},
-std::array<float,2>{0.454088062f, 0.479453564f},
-std::array<float,2>{0.53234905f, 0.564858854f},
-std::array<float,2>{0.0961124748f, 0.973709047f},
-std::array<float,2>{0.82694298f, 0.036392346f},
-std::array<float,2>{0.00955637638f, 0.360647798f},
-std::array<float,2>{0.7689417f, 0.643431008f},
-std::array<float,2>{0.383927941f, 0.868851602f},
-std::array<float,2>{0.574872136f, 0.179145724f},
-std::array<float,2>{0.322446436f, 0.0636722967f},
-std::array<float,2>{0.682272375f, 0.897424161f},
-std::array<float,2>{0.214566559f, 0.543075264f},
-std::array<float,2>{0.9688043f, 0.435652912f},
-std::array<float,2>{0.0881621167f, 0.00316008809f},
-std::array<float,2>{0.864730537f, 0.954579592f},
-std::array<float,2>{0.487753689f, 0.6052441f},
-std::array<float,2>{0.520988405f, 0.458148122f},
-std::array<float,2>{0.296615481f, 0.262045473f},
-std::array<float,2>{0.743118465f, 0.718284905f},
-std::array<float,2>{0.168963909f, 0.758366346f},
-std::array<float,2>{0.89589572f, 0.189157858f},
-std::array<float,2>{0.237193033f, 0.377067119f},
-std::array<float,2>{0.94537884f, 0.5207358f},
-std::array<float,2>{0.346952498f, 0.916703761f},
-std::array<float,2>{0.628082216f, 0.0978973061f},
-std::array<float,2>{0.410806f, 0.153117463f},
-std::array<float,2>{0.616284132f, 0.836225271f},
-std::array<float,2>{0.0470462553f, 0.656802714f},
-std::array<float,2>{0.808099449f, 0.316284806f},
-std::array<float,2>{0.0662853494f, 0.140945092f},
-std::array<float,2>{0.848505318f, 0.832721233f},
-std::array<float,2>{0.473378658f, 0.668720484f},
-std::array<float,2>{0.509494364f, 0.321389437f},
-std::array<float,2>{0.310382903f, 0.383105159f},
-std::array<float,2>{0.719064176f, 0.524396002f},
-std::array<float,2>{0.173814774f, 0.909271002f},
-std::array<float,2>{0.879511774f, 0.109151907f},
-std::array<float,2>{0.224093109f, 0.251352459f},
-std::array<float,2>{0.963314176f, 0.703534067f},
-std::array<float,2>{0.366041511f, 0.75697279f},
-std::array<float,2>{0.655284941f, 0.20302026f},
-std::array<float,2>{0.424415082f, 0.0128853945f},
-std::array<float,2>{0.599642634f, 0.967736363f},
-std::array<float,2>{0.0417436585f, 0.595349014f},
-std::array<float,2>{0.791509211f, 0.466469556f},
-std::array<float,2>{0.131440744f, 0.0777913779f},
-std::array<float,2>{0.907532573f, 0.903760731f},
-std::array<float,2>{0.266405076f, 0.532260597f},
-std::array<float,2>{0.703900456f, 0.428950667f},
-std::array<float,2>{0.438183695f, 0.369196236f},
-std::array<float,2>{0.547511935f, 0.650214136f},
-std::array<float,2>{0.116672687f, 0.85939467f},
-std::array<float,2>{0.828387737f, 0.183937103f},
-std::array<float,2>{0.0169472359f, 0.471048713f},
-std::array<float,2>{0.76510489f, 0.573555648f},
-std::array<float,2>{0.390821844f, 0.978311419f},
-std::array<float,2>{0.589589715f, 0.0412053615f},
-std::array<float,2>{0.335545182f, 0.239366636f},
-std::array<float,2>{0.665554225f, 0.801467001f},
-std::array<float,2>{0.190761164f, 0.747035921f},
-std::array<float,2>{0.990386009f, 0.281449735f},
-std::array<float,2>{0.217621014f, 0.217556402f},
-std::array<float,2>{0.975539982f, 0.768212616f},
-std::array<float,2>{0.327160984f, 0.700184941f},
-std::array<float,2>{0.683890522f, 0.273943663f},
-std::array<float,2>{0.390159398f, 0.451802522f},
-std::array<float,2>{0.572829962f, 0.612332821f},
-std::array<float,2>{0.0132762315f, 0.946481764f},
-std::array<float,2>{0.772357941f, 0.0203642752f},
-std::array<float,2>{0.0988672376f, 0.333955765f},
-std::array<float,2>{0.823405743f, 0.682987332f},
-std::array<float,2>{0.458749801f, 0.821188867f},
-std::array<float,2>{0.536133468f, 0.131797582f},
-std::array<float,2>{0.263391733f, 0.123207472f},
-std::array<float,2>{0.689781606f, 0.9342646f},
-std::array<float,2>{0.144483969f, 0.508271039f},
-std::array<float,2>{0.931640327f, 0.399505228f},
-std::array<float,2>{0.0544078909f, 0.0472244695f},
-std::array<float,2>{0.809306085f, 0.988605678f},
-std::array<float,2>{0.407824039f, 0.587990105f},
-std::array<float,2>{0.611430407f, 0.493610978f},
-std::array<float,2>{0.350398332f, 0.303781658f},
-std::array<float,2>{0.631287992f, 0.731919646f},
-std::array<float,2>{0.240564436f, 0.793746173f},
-std::array<float,2>{0.951102495f, 0.219863877f},
-std::array<float,2>{0.167510107f, 0.411070228f},
-std::array<float,2>{0.893222988f, 0.549002469f},
-std::array<float,2>{0.290433913f, 0.879708707f},
-std::array<float,2>{0.747368813f, 0.0899328589f},
-std::array<float,2>{0.492037088f, 0.15911673f},
-std::array<float,2>{0.517385483f, 0.855665505f},
-std::array<float,2>{0.0935118124f, 0.639559031f},
-std::array<float,2>{0.861762464f, 0.359091818f},
-std::array<float,2>{0.00229252875f, 0.22671631f},
-std::array<float,2>{0.773482502f, 0.783562124f},
-std::array<float,2>{0.380716026f, 0.724048615f},
-std::array<float,2>{0.56672585f, 0.307789624f},
-std::array<float,2>{0.314410508f, 0.488982439f},
-std::array<float,2>{0.672749519f, 0.57887578f},
-std::array<float,2>{0.203974068f, 0.994659364f},
-std::array<float,2>{0.983628631f, 0.0588705428f},
-std::array<float,2>{0.156186566f, 0.34769085f},
-std::array<float,2>{0.924572706f, 0.629886925f},
-std::array<float,2>{0.25625059f, 0.844681144f},
-std::array<float,2>{0.69647342f, 0.168439239f},
-std::array<float,2>{0.463641375f, 0.0845580995f},
-std::array<float,2>{0.544803023f, 0.884534121f},
-std::array<float,2>{0.106142215f, 0.555954933f},
-std::array<float,2>{0.817205846f, 0.415687442f},
-std::array<float,2>{0.248081937f, 0.0239776541f},
-std::array<float,2>{0.937805474f, 0.939723432f},
-std::array<float,2>{0.354494512f, 0.618921518f},
-std::array<float,2>{0.634703338f, 0.437526703f},
-std::array<float,2>{0.416652918f, 0.270385414f},
-std::array<float,2>{0.624649048f, 0.692593575f},
-std::array<float,2>{0.0593185872f, 0.780845523f},
-std::array<float,2>{0.801034808f, 0.205337092f},
-std::array<float,2>{0.0805222541f, 0.397869974f},
-std::array<float,2>{0.873288035f, 0.505064785f},
-std::array<float,2>{0.497167528f, 0.924675524f},
-std::array<float,2>{0.529081702f, 0.113141872f},
-std::array<float,2>{0.288543314f, 0.134494245f},
-std::array<float,2>{0.736858249f, 0.820026815f},
-std::array<float,2>{0.160271257f, 0.677265465f},
-std::array<float,2>{0.905787349f, 0.341089576f},
-std::array<float,2>{0.181983754f, 0.172841087f},
-std::array<float,2>{0.889696956f, 0.871119201f},
-std::array<float,2>{0.304482162f, 0.645193219f},
-std::array<float,2>{0.728658319f, 0.366934866f},
-std::array<float,2>{0.48003605f, 0.431762844f},
-std::array<float,2>{0.503262222f, 0.540331304f},
-std::array<float,2>{0.0728217885f, 0.894097865f},
-std::array<float,2>{0.856406689f, 0.0684917122f},
-std::array<float,2>{0.0345814563f, 0.289725751f},
-std::array<float,2>{0.782387733f, 0.740288973f},
-std::array<float,2>{0.430147111f, 0.806550682f},
-std::array<float,2>{0.608012795f, 0.244347155f},
-std::array<float,2>{0.372319698f, 0.0334973224f},
-std::array<float,2>{0.647239923f, 0.972162127f},
-std::array<float,2>{0.231022075f, 0.569350004f},
-std::array<float,2>{0.960535467f, 0.483499885f},
-std::array<float,2>{0.117982648f, 0.0971379131f},
-std::array<float,2>{0.838547945f, 0.918210626f},
-std::array<float,2>{0.447179049f, 0.515788317f},
-std::array<float,2>{0.556651175f, 0.382706463f},
-std::array<float,2>{0.27785337f, 0.319108397f},
-std::array<float,2>{0.714416444f, 0.662969232f},
-std::array<float,2>{0.138644651f, 0.840664983f},
-std::array<float,2>{0.916896999f, 0.149655908f},
-std::array<float,2>{0.199068919f, 0.454510212f},
-std::array<float,2>{0.992548823f, 0.608552694f},
-std::array<float,2>{0.343492746f, 0.9573102f},
-std::array<float,2>{0.658741295f, 0.00508836797f},
-std::array<float,2>{0.405789524f, 0.193375096f},
-std::array<float,2>{0.580691695f, 0.76387316f},
-std::array<float,2>{0.0301246904f, 0.711907148f},
-std::array<float,2>{0.75567168f, 0.258110493f},
-std::array<float,2>{0.123440497f, 0.223478273f},
-std::array<float,2>{0.840292275f, 0.790629387f},
-std::array<float,2>{0.451458514f, 0.728080094f},
-std::array<float,2>{0.561319232f, 0.299087703f},
-std::array<float,2>{0.276416987f, 0.498000532f},
-std::array<float,2>{0.716434896f, 0.590028703f},
-std::array<float,2>{0.135621578f, 0.986933231f},
-std::array<float,2>{0.91923219f, 0.0518104732f},
-std::array<float,2>{0.199814171f, 0.35201773f},
-std::array<float,2>{0.996443272f, 0.632890344f},
-std::array<float,2>{0.338978976f, 0.852754056f},
-std::array<float,2>{0.66119945f, 0.163827777f},
-std::array<float,2>{0.401713014f, 0.0891306326f},
-std::array<float,2>{0.584127665f, 0.877744496f},
-std::array<float,2>{0.025642883f, 0.554191411f},
-std::array<float,2>{0.753673673f, 0.40782389f},
-std::array<float,2>{0.184056714f, 0.0193071906f},
-std::array<float,2>{0.886323214f, 0.950093806f},
-std::array<float,2>{0.298194349f, 0.616771519f},
-std::array<float,2>{0.734319329f, 0.446947217f},
-std::array<float,2>{0.48124963f, 0.280255854f},
-std::array<float,2>{0.503913641f, 0.695538759f},
-std::array<float,2>{0.0751817003f, 0.769950151f},
-std::array<float,2>{0.85238719f, 0.212379128f},
-std::array<float,2>{0.0353397205f, 0.404172868f},
-std::array<float,2>{0.786028743f, 0.512987196f},
-std::array<float,2>{0.433742017f, 0.932787895f},
-std::array<float,2>{0.603941619f, 0.120259009f},
-std::array<float,2>{0.367793381f, 0.128020331f},
-std::array<float,2>{0.643306077f, 0.825209379f},
-std::array<float,2>{0.230134815f, 0.685829222f},
-std::array<float,2>{0.956522644f, 0.330086291f},
-std::array<float,2>{0.243775308f, 0.182262734f},
-std::array<float,2>{0.944061637f, 0.86706847f},
-std::array<float,2>{0.356437147f, 0.652666509f},
-std::array<float,2>{0.637778103f, 0.371949852f},
-std::array<float,2>{0.419536501f, 0.421999812f},
-std::array<float,2>{0.619596839f, 0.538282454f},
-std::array<float,2>{0.0585362054f, 0.901802063f},
-std::array<float,2>{0.799090505f, 0.070336096f},
-std::array<float,2>{0.0841676891f, 0.285975486f},
-std::array<float,2>{0.867792368f, 0.744841456f},
-std::array<float,2>{0.492199242f, 0.79701668f},
-std::array<float,2>{0.526336968f, 0.237488523f},
-std::array<float,2>{0.284350693f, 0.0461029969f},
-std::array<float,2>{0.740968525f, 0.983804524f},
-std::array<float,2>{0.159456402f, 0.575104952f},
-std::array<float,2>{0.899563968f, 0.472737551f},
-std::array<float,2>{0.00549840601f, 0.105318449f},
-std::array<float,2>{0.778152108f, 0.910850704f},
-std::array<float,2>{0.376119792f, 0.530530691f},
-std::array<float,2>{0.562946796f, 0.389950216f},
-std::array<float,2>{0.317113638f, 0.326440632f},
-std::array<float,2>{0.677405238f, 0.66621536f},
-std::array<float,2>{0.20729892f, 0.828560114f},
-std::array<float,2>{0.976598442f, 0.146989748f},
-std::array<float,2>{0.151544049f, 0.464645237f},
-std::array<float,2>{0.926876366f, 0.59872663f},
-std::array<float,2>{0.251532674f, 0.964228511f},
-std::array<float,2>{0.702987373f, 0.00782715064f},
-std::array<float,2>{0.466635346f, 0.197496921f},
-std::array<float,2>{0.541534066f, 0.753037214f},
-std::array<float,2>{0.104671545f, 0.708357155f},
-std::array<float,2>{0.813777745f, 0.255440831f},
-std::array<float,2>{0.0478795059f, 0.154604718f},
-std::array<float,2>{0.80687207f, 0.839102864f},
-std::array<float,2>{0.411742687f, 0.658542395f},
-std::array<float,2>{0.615729928f, 0.313768208f},
-std::array<float,2>{0.346361578f, 0.376949519f},
-std::array<float,2>{0.627580166f, 0.523306549f},
-std::array<float,2>{0.237546876f, 0.915664792f},
-std::array<float,2>{0.946891963f, 0.100512102f},
-std::array<float,2>{0.168932378f, 0.264440536f},
-std::array<float,2>{0.894896626f, 0.715040445f},
-std::array<float,2>{0.295415074f, 0.760695457f},
-std::array<float,2>{0.743323624f, 0.190461084f},
-std::array<float,2>{0.487122983f, 0.000377993943f},
-std::array<float,2>{0.52024895f, 0.956014633f},
-std::array<float,2>{0.0893685296f, 0.601707757f},
-std::array<float,2>{0.863609493f, 0.459433734f},
-std::array<float,2>{0.213160336f, 0.0657245964f},
-std::array<float,2>{0.970639884f, 0.896194279f},
-std::array<float,2>{0.324011415f, 0.546254396f},
-std::array<float,2>{0.683276951f, 0.434724659f},
-std::array<float,2>{0.383063883f, 0.363222748f},
-std::array<float,2>{0.575558364f, 0.641324043f},
-std::array<float,2>{0.0080672903f, 0.869521439f},
-std::array<float,2>{0.768299818f, 0.175856858f},
-std::array<float,2>{0.0976264402f, 0.477900445f},
-std::array<float,2>{0.827307522f, 0.562710106f},
-std::array<float,2>{0.454875767f, 0.975315988f},
-std::array<float,2>{0.531851768f, 0.0386738032f},
-std::array<float,2>{0.260059953f, 0.248711184f},
-std::array<float,2>{0.692137182f, 0.810779214f},
-std::array<float,2>{0.148194075f, 0.738202393f},
-std::array<float,2>{0.935992479f, 0.296783656f},
-std::array<float,2>{0.125096008f, 0.208001748f},
-std::array<float,2>{0.91212815f, 0.776869833f},
-std::array<float,2>{0.269784451f, 0.6885131f},
-std::array<float,2>{0.70988977f, 0.26808095f},
-std::array<float,2>{0.44208017f, 0.44328016f},
-std::array<float,2>{0.552229226f, 0.623639524f},
-std::array<float,2>{0.112863988f, 0.944742262f},
-std::array<float,2>{0.832127571f, 0.028638931f},
-std::array<float,2>{0.022296967f, 0.336793602f},
-std::array<float,2>{0.75993973f, 0.674806237f},
-std::array<float,2>{0.397522569f, 0.813042819f},
-std::array<float,2>{0.591821551f, 0.13933976f},
-std::array<float,2>{0.330963552f, 0.1154617f},
-std::array<float,2>{0.66979593f, 0.92655611f},
-std::array<float,2>{0.193134204f, 0.502368331f},
-std::array<float,2>{0.985358834f, 0.393705577f},
-std::array<float,2>{0.0679455325f, 0.0577960126f},
-std::array<float,2>{0.847137213f, 0.996851742f},
-std::array<float,2>{0.469219893f, 0.584110081f},
-std::array<float,2>{0.513281584f, 0.484911442f},
-std::array<float,2>{0.30811885f, 0.30966568f},
-std::array<float,2>{0.723388851f, 0.720288694f},
-std::array<float,2>{0.178287551f, 0.788905919f},
-std::array<float,2>{0.878793895f, 0.233963504f},
-std::array<float,2>{0.218922079f, 0.421548367f},
-std::array<float,2>{0.966466665f, 0.560278118f},
-std::array<float,2>{0.361366719f, 0.890423298f},
-std::array<float,2>{0.649483442f, 0.08172068f},
-std::array<float,2>{0.427007794f, 0.167473704f},
-std::array<float,2>{0.597095251f, 0.84818089f},
-std::array<float,2>{0.0456089489f, 0.625135243f},
-std::array<float,2>{0.795733392f, 0.347064376f},
-std::array<float,2>{0.0918688774f, 0.15752463f},
-std::array<float,2>{0.862679601f, 0.858038604f},
-std::array<float,2>{0.49054268f, 0.638394356f},
-std::array<float,2>{0.516596317f, 0.356958896f},
-std::array<float,2>{0.289195269f, 0.412899345f},
-std::array<float,2>{0.746789813f, 0.548245966f},
-std::array<float,2>{0.166490614f, 0.882389367f},
-std::array<float,2>{0.894373655f, 0.0931198373f},
-std::array<float,2>{0.241822451f, 0.302706897f},
-std::array<float,2>{0.949554861f, 0.733154655f},
-std::array<float,2>{0.351286948f, 0.796825886f},
-std::array<float,2>{0.631946683f, 0.221410647f},
-std::array<float,2>{0.406270921f, 0.0491047204f},
-std::array<float,2>{0.613122523f, 0.990625679f},
-std::array<float,2>{0.0532769524f, 0.586904049f},
-std::array<float,2>{0.809732735f, 0.495069325f},
-std::array<float,2>{0.142756522f, 0.121270463f},
-std::array<float,2>{0.930016816f, 0.936198413f},
-std::array<float,2>{0.26251334f, 0.509799659f},
-std::array<float,2>{0.691404402f, 0.4008663f},
-std::array<float,2>{0.457672596f, 0.335783094f},
-std::array<float,2>{0.535590827f, 0.67980963f},
-std::array<float,2>{0.0982898995f, 0.823163271f},
-std::array<float,2>{0.823008776f, 0.130033091f},
-std::array<float,2>{0.0120343762f, 0.449981391f},
-std::array<float,2>{0.773389578f, 0.610516369f},
-std::array<float,2>{0.38959977f, 0.948541403f},
-std::array<float,2>{0.573522866f, 0.0224206951f},
-std::array<float,2>{0.326555938f, 0.215282336f},
-std::array<float,2>{0.684740901f, 0.766352355f},
-std::array<float,2>{0.218255267f, 0.701801002f},
-std::array<float,2>{0.976061106f, 0.27728346f},
-std::array<float,2>{0.190150231f, 0.241678566f},
-std::array<float,2>{0.991426587f, 0.804431915f},
-std::array<float,2>{0.334238023f, 0.749563813f},
-std::array<float,2>{0.6649459f, 0.283370018f},
-std::array<float,2>{0.392063528f, 0.470550746f},
-std::array<float,2>{0.588212729f, 0.571139395f},
-std::array<float,2>{0.0163513143f, 0.979333758f},
-std::array<float,2>{0.764412224f, 0.0400116146f},
-std::array<float,2>{0.115309693f, 0.368020505f},
-std::array<float,2>{0.829417229f, 0.650997758f},
-std::array<float,2>{0.438512474f, 0.862948418f},
-std::array<float,2>{0.547856867f, 0.186206684f},
-std::array<float,2>{0.267490774f, 0.0747104734f},
-std::array<float,2>{0.704301596f, 0.905176461f},
-std::array<float,2>{0.132163346f, 0.533350408f},
-std::array<float,2>{0.907010078f, 0.427196383f},
-std::array<float,2>{0.0425051898f, 0.0138602005f},
-std::array<float,2>{0.792735636f, 0.966577351f},
-std::array<float,2>{0.425615817f, 0.595910072f},
-std::array<float,2>{0.60076654f, 0.467898309f},
-std::array<float,2>{0.366558373f, 0.253184527f},
-std::array<float,2>{0.655107796f, 0.705378592f},
-std::array<float,2>{0.22356686f, 0.754677713f},
-std::array<float,2>{0.964663804f, 0.200760156f},
-std::array<float,2>{0.172566026f, 0.385458589f},
-std::array<float,2>{0.880784392f, 0.526165664f},
-std::array<float,2>{0.308881968f, 0.907425284f},
-std::array<float,2>{0.720359325f, 0.107421309f},
-std::array<float,2>{0.473927408f, 0.144507125f},
-std::array<float,2>{0.508597553f, 0.834148228f},
-std::array<float,2>{0.064758271f, 0.670634568f},
-std::array<float,2>{0.849445164f, 0.322449744f},
-std::array<float,2>{0.0304425713f, 0.192554995f},
-std::array<float,2>{0.754090726f, 0.762777686f},
-std::array<float,2>{0.405249804f, 0.714592218f},
-std::array<float,2>{0.58134234f, 0.261135489f},
-std::array<float,2>{0.342245996f, 0.45570302f},
-std::array<float,2>{0.659724176f, 0.605658114f},
-std::array<float,2>{0.197302133f, 0.960303485f},
-std::array<float,2>{0.993426204f, 0.00737625174f},
-std::array<float,2>{0.137298599f, 0.317533702f},
-std::array<float,2>{0.917284369f, 0.660436392f},
-std::array<float,2>{0.279004484f, 0.843332291f},
-std::array<float,2>{0.71374929f, 0.150777787f},
-std::array<float,2>{0.445654988f, 0.0948173851f},
-std::array<float,2>{0.558115304f, 0.921348512f},
-std::array<float,2>{0.118336201f, 0.518578529f},
-std::array<float,2>{0.839118838f, 0.380423695f},
-std::array<float,2>{0.231904775f, 0.0329452567f},
-std::array<float,2>{0.959599197f, 0.969074368f},
-std::array<float,2>{0.371393383f, 0.566716671f},
-std::array<float,2>{0.647848368f, 0.480560422f},
-std::array<float,2>{0.431481123f, 0.292033106f},
-std::array<float,2>{0.609056532f, 0.739459813f},
-std::array<float,2>{0.0341529921f, 0.807654321f},
-std::array<float,2>{0.782218754f, 0.243568838f},
-std::array<float,2>{0.0741931051f, 0.429706603f},
-std::array<float,2>{0.856908739f, 0.541300356f},
-std::array<float,2>{0.478767425f, 0.892219067f},
-std::array<float,2>{0.502228856f, 0.067393586f},
-std::array<float,2>{0.303481311f, 0.174756378f},
-std::array<float,2>{0.729678929f, 0.873320699f},
-std::array<float,2>{0.183018714f, 0.648395956f},
-std::array<float,2>{0.889586031f, 0.364055067f},
-std::array<float,2>{0.161840662f, 0.135652468f},
-std::array<float,2>{0.905004263f, 0.816555977f},
-std::array<float,2>{0.287131399f, 0.678541958f},
-std::array<float,2>{0.73826164f, 0.343553275f},
-std::array<float,2>{0.496380359f, 0.395769656f},
-std::array<float,2>{0.52800566f, 0.506787837f},
-std::array<float,2>{0.0812683254f, 0.922536194f},
-std::array<float,2>{0.874997854f, 0.110226989f},
-std::array<float,2>{0.0601747893f, 0.272697061f},
-std::array<float,2>{0.802630067f, 0.693450689f},
-std::array<float,2>{0.417767316f, 0.778336048f},
-std::array<float,2>{0.623807967f, 0.2049914f},
-std::array<float,2>{0.354033113f, 0.0270179454f},
-std::array<float,2>{0.633098364f, 0.938039362f},
-std::array<float,2>{0.249139935f, 0.620881319f},
-std::array<float,2>{0.938715935f, 0.44066f},
-std::array<float,2>{0.107099265f, 0.0831533968f},
-std::array<float,2>{0.818339884f, 0.885357201f},
-std::array<float,2>{0.464134365f, 0.558313906f},
-std::array<float,2>{0.543880939f, 0.417236358f},
-std::array<float,2>{0.257405788f, 0.350534081f},
-std::array<float,2>{0.695500016f, 0.631371677f},
-std::array<float,2>{0.154773697f, 0.846575856f},
-std::array<float,2>{0.925161004f, 0.1703576f},
-std::array<float,2>{0.20485124f, 0.490537763f},
-std::array<float,2>{0.982707322f, 0.58070159f},
-std::array<float,2>{0.313025117f, 0.993931711f},
-std::array<float,2>{0.673450351f, 0.0613635965f},
-std::array<float,2>{0.379103899f, 0.23015064f},
-std::array<float,2>{0.567693233f, 0.78197217f},
-std::array<float,2>{0.00327870576f, 0.726295352f},
-std::array<float,2>{0.774698734f, 0.305445343f},
-std::array<float,2>{0.0764465258f, 0.213128343f},
-std::array<float,2>{0.853705466f, 0.773398578f},
-std::array<float,2>{0.483759761f, 0.698878706f},
-std::array<float,2>{0.505951643f, 0.277462423f},
-std::array<float,2>{0.298926502f, 0.447991431f},
-std::array<float,2>{0.731257439f, 0.613672256f},
-std::array<float,2>{0.186686307f, 0.95266813f},
-std::array<float,2>{0.884728491f, 0.0164337885f},
-std::array<float,2>{0.227495015f, 0.329920202f},
-std::array<float,2>{0.95334363f, 0.685404956f},
-std::array<float,2>{0.370527387f, 0.826702476f},
-std::array<float,2>{0.642481267f, 0.126118273f},
-std::array<float,2>{0.436203361f, 0.117644086f},
-std::array<float,2>{0.603485167f, 0.930316389f},
-std::array<float,2>{0.0389347859f, 0.515001774f},
-std::array<float,2>{0.788050175f, 0.404940486f},
-std::array<float,2>{0.134307951f, 0.0546862781f},
-std::array<float,2>{0.920584679f, 0.986210406f},
-std::array<float,2>{0.275108397f, 0.592899561f},
-std::array<float,2>{0.717890143f, 0.498075366f},
-std::array<float,2>{0.451058716f, 0.297314882f},
-std::array<float,2>{0.558909535f, 0.728622139f},
-std::array<float,2>{0.121216781f, 0.792104006f},
-std::array<float,2>{0.842559636f, 0.224989682f},
-std::array<float,2>{0.0246156882f, 0.408693194f},
-std::array<float,2>{0.751755953f, 0.551551044f},
-std::array<float,2>{0.400278419f, 0.876362026f},
-std::array<float,2>{0.583669186f, 0.0877507105f},
-std::array<float,2>{0.337427557f, 0.160999104f},
-std::array<float,2>{0.662376881f, 0.853862107f},
-std::array<float,2>{0.202120587f, 0.636369407f},
-std::array<float,2>{0.998635113f, 0.354749918f},
-std::array<float,2>{0.210504606f, 0.144821763f},
-std::array<float,2>{0.978547394f, 0.831564069f},
-std::array<float,2>{0.318985164f, 0.666013539f},
-std::array<float,2>{0.679330945f, 0.324800283f},
-std::array<float,2>{0.377291888f, 0.388210595f},
-std::array<float,2>{0.565991819f, 0.527517974f},
-std::array<float,2>{0.00703282841f, 0.913933635f},
-std::array<float,2>{0.779438674f, 0.102619156f},
-std::array<float,2>{0.101752318f, 0.257102966f},
-std::array<float,2>{0.815836906f, 0.710277021f},
-std::array<float,2>{0.466935962f, 0.751518965f},
-std::array<float,2>{0.540961802f, 0.195706889f},
-std::array<float,2>{0.253003687f, 0.0110419998f},
-std::array<float,2>{0.700434327f, 0.962480366f},
-std::array<float,2>{0.148500174f, 0.600700557f},
-std::array<float,2>{0.928920507f, 0.461425513f},
-std::array<float,2>{0.0549519844f, 0.0737201944f},
-std::array<float,2>{0.796983957f, 0.899346828f},
-std::array<float,2>{0.420344472f, 0.535509348f},
-std::array<float,2>{0.618864775f, 0.424385816f},
-std::array<float,2>{0.357594341f, 0.374794006f},
-std::array<float,2>{0.640289843f, 0.655845404f},
-std::array<float,2>{0.245154917f, 0.865140975f},
-std::array<float,2>{0.943074107f, 0.180935398f},
-std::array<float,2>{0.156951144f, 0.475831896f},
-std::array<float,2>{0.90046984f, 0.577833593f},
-std::array<float,2>{0.282729149f, 0.982288718f},
-std::array<float,2>{0.739323258f, 0.0435273685f},
-std::array<float,2>{0.494275123f, 0.234918818f},
-std::array<float,2>{0.524483621f, 0.799202263f},
-std::array<float,2>{0.0831309929f, 0.743418396f},
-std::array<float,2>{0.869199634f, 0.287446678f},
-std::array<float,2>{0.0106553249f, 0.177858621f},
-std::array<float,2>{0.76598829f, 0.867799878f},
-std::array<float,2>{0.3865605f, 0.643560767f},
-std::array<float,2>{0.577658355f, 0.359595627f},
-std::array<float,2>{0.320895642f, 0.436983109f},
-std::array<float,2>{0.679763496f, 0.544423759f},
-std::array<float,2>{0.212744743f, 0.898235023f},
-std::array<float,2>{0.970708191f, 0.0630801693f},
-std::array<float,2>{0.145446882f, 0.293387622f},
-std::array<float,2>{0.934470892f, 0.735783339f},
-std::array<float,2>{0.259525448f, 0.80907613f},
-std::array<float,2>{0.695249915f, 0.246876061f},
-std::array<float,2>{0.455747664f, 0.0356847495f},
-std::array<float,2>{0.533698261f, 0.973385811f},
-std::array<float,2>{0.0946859494f, 0.566265166f},
-std::array<float,2>{0.825354815f, 0.479961187f},
-std::array<float,2>{0.235021114f, 0.0994758382f},
-std::array<float,2>{0.948483944f, 0.917697072f},
-std::array<float,2>{0.344145924f, 0.51980561f},
-std::array<float,2>{0.626540124f, 0.378766537f},
-std::array<float,2>{0.413167685f, 0.314725071f},
-std::array<float,2>{0.613968074f, 0.657907009f},
-std::array<float,2>{0.0497353151f, 0.837099493f},
-std::array<float,2>{0.80586952f, 0.153415188f},
-std::array<float,2>{0.0861676782f, 0.457251072f},
-std::array<float,2>{0.866403997f, 0.604180753f},
-std::array<float,2>{0.485950589f, 0.953668296f},
-std::array<float,2>{0.521929085f, 0.00208881171f},
-std::array<float,2>{0.29483667f, 0.188187197f},
-std::array<float,2>{0.745781779f, 0.759037077f},
-std::array<float,2>{0.171356291f, 0.717577755f},
-std::array<float,2>{0.897700846f, 0.2635445f},
-std::array<float,2>{0.176898226f, 0.231041521f},
-std::array<float,2>{0.875792027f, 0.785477161f},
-std::array<float,2>{0.305169791f, 0.721897304f},
-std::array<float,2>{0.72655791f, 0.310984701f},
-std::array<float,2>{0.470738322f, 0.487402886f},
-std::array<float,2>{0.515185773f, 0.582578659f},
-std::array<float,2>{0.0685058013f, 0.998119056f},
-std::array<float,2>{0.844674349f, 0.0547315218f},
-std::array<float,2>{0.044741828f, 0.343829453f},
-std::array<float,2>{0.793839097f, 0.628679276f},
-std::array<float,2>{0.428831786f, 0.8509534f},
-std::array<float,2>{0.593849063f, 0.165336609f},
-std::array<float,2>{0.360248834f, 0.0796890631f},
-std::array<float,2>{0.651236594f, 0.887200892f},
-std::array<float,2>{0.221068144f, 0.561197162f},
-std::array<float,2>{0.968735278f, 0.419179022f},
-std::array<float,2>{0.109702207f, 0.0298235323f},
-std::array<float,2>{0.834265828f, 0.942458749f},
-std::array<float,2>{0.443515658f, 0.622780979f},
-std::array<float,2>{0.55296123f, 0.445156038f},
-std::array<float,2>{0.272841454f, 0.265731007f},
-std::array<float,2>{0.708863914f, 0.690338671f},
-std::array<float,2>{0.128342152f, 0.774627924f},
-std::array<float,2>{0.911314487f, 0.209407926f},
-std::array<float,2>{0.194861114f, 0.391691089f},
-std::array<float,2>{0.98669982f, 0.501813591f},
-std::array<float,2>{0.329038471f, 0.929590881f},
-std::array<float,2>{0.67115587f, 0.114115059f},
-std::array<float,2>{0.394879848f, 0.137873203f},
-std::array<float,2>{0.589947641f, 0.81614542f},
-std::array<float,2>{0.0202257596f, 0.672621429f},
-std::array<float,2>{0.758107364f, 0.33909139f},
-std::array<float,2>{0.100709982f, 0.13271004f},
-std::array<float,2>{0.820718646f, 0.821313858f},
-std::array<float,2>{0.459252268f, 0.681892693f},
-std::array<float,2>{0.537473083f, 0.332074046f},
-std::array<float,2>{0.263782531f, 0.399346232f},
-std::array<float,2>{0.689160883f, 0.509043932f},
-std::array<float,2>{0.141850263f, 0.934927285f},
-std::array<float,2>{0.932453096f, 0.124282464f},
-std::array<float,2>{0.216038704f, 0.275023043f},
-std::array<float,2>{0.973720253f, 0.701003134f},
-std::array<float,2>{0.325773358f, 0.768879354f},
-std::array<float,2>{0.686008334f, 0.217888653f},
-std::array<float,2>{0.387588024f, 0.0205301195f},
-std::array<float,2>{0.571868181f, 0.945887983f},
-std::array<float,2>{0.0154355988f, 0.61181426f},
-std::array<float,2>{0.770329595f, 0.453044266f},
-std::array<float,2>{0.164223939f, 0.0915701836f},
-std::array<float,2>{0.891409934f, 0.880582392f},
-std::array<float,2>{0.292152077f, 0.55015254f},
-std::array<float,2>{0.749346793f, 0.411524862f},
-std::array<float,2>{0.488771826f, 0.357943922f},
-std::array<float,2>{0.518609464f, 0.640466154f},
-std::array<float,2>{0.0915941745f, 0.856847882f},
-std::array<float,2>{0.861324072f, 0.160111606f},
-std::array<float,2>{0.0511187874f, 0.492588848f},
-std::array<float,2>{0.81071353f, 0.589348018f},
-std::array<float,2>{0.409650415f, 0.990213335f},
-std::array<float,2>{0.609992027f, 0.0487632118f},
-std::array<float,2>{0.348114967f, 0.219222322f},
-std::array<float,2>{0.630085528f, 0.794209003f},
-std::array<float,2>{0.240083858f, 0.731200099f},
-std::array<float,2>{0.951983392f, 0.302903295f},
-std::array<float,2>{0.225919396f, 0.201198041f},
-std::array<float,2>{0.961947799f, 0.756546497f},
-std::array<float,2>{0.363594621f, 0.70438534f},
-std::array<float,2>{0.654015958f, 0.250536561f},
-std::array<float,2>{0.42361933f, 0.465505034f},
-std::array<float,2>{0.599398077f, 0.593823791f},
-std::array<float,2>{0.0393183157f, 0.968618274f},
-std::array<float,2>{0.78914845f, 0.0121157104f},
-std::array<float,2>{0.0643181205f, 0.320685118f},
-std::array<float,2>{0.851548076f, 0.66960448f},
-std::array<float,2>{0.476134837f, 0.83329457f},
-std::array<float,2>{0.511641979f, 0.141694143f},
-std::array<float,2>{0.312330931f, 0.108375944f},
-std::array<float,2>{0.721443951f, 0.909042418f},
-std::array<float,2>{0.175383165f, 0.525108337f},
-std::array<float,2>{0.881562591f, 0.384038687f},
-std::array<float,2>{0.0186102986f, 0.0423201397f},
-std::array<float,2>{0.763223767f, 0.976845562f},
-std::array<float,2>{0.393124044f, 0.572404444f},
-std::array<float,2>{0.587565839f, 0.471865714f},
-std::array<float,2>{0.332840443f, 0.282685518f},
-std::array<float,2>{0.667178154f, 0.747338474f},
-std::array<float,2>{0.188653827f, 0.802312374f},
-std::array<float,2>{0.988807261f, 0.238732308f},
-std::array<float,2>{0.12987496f, 0.428427577f},
-std::array<float,2>{0.909424901f, 0.531575084f},
-std::array<float,2>{0.268361241f, 0.902645886f},
-std::array<float,2>{0.706232131f, 0.0769124329f},
-std::array<float,2>{0.441379458f, 0.185185194f},
-std::array<float,2>{0.549858451f, 0.86097616f},
-std::array<float,2>{0.114989862f, 0.648958981f},
-std::array<float,2>{0.830094934f, 0.371014893f},
-std::array<float,2>{0.0328213833f, 0.245550349f},
-std::array<float,2>{0.783973932f, 0.805408537f},
-std::array<float,2>{0.432341576f, 0.742166638f},
-std::array<float,2>{0.605809569f, 0.290924847f},
-std::array<float,2>{0.374290913f, 0.482597739f},
-std::array<float,2>{0.644594431f, 0.569278538f},
-std::array<float,2>{0.233536899f, 0.971137404f},
-std::array<float,2>{0.957170486f, 0.0345964171f},
-std::array<float,2>{0.180407375f, 0.365240812f},
-std::array<float,2>{0.88845402f, 0.646022081f},
-std::array<float,2>{0.301543891f, 0.872379839f},
-std::array<float,2>{0.728430033f, 0.173315272f},
-std::array<float,2>{0.476803392f, 0.0696971193f},
-std::array<float,2>{0.500026703f, 0.892826259f},
-std::array<float,2>{0.0721689835f, 0.539876461f},
-std::array<float,2>{0.859220326f, 0.432703912f},
-std::array<float,2>{0.196980178f, 0.00404438563f},
-std::array<float,2>{0.99581033f, 0.958390653f},
-std::array<float,2>{0.340430319f, 0.607551038f},
-std::array<float,2>{0.656903803f, 0.453237653f},
-std::array<float,2>{0.403813154f, 0.259653389f},
-std::array<float,2>{0.579382598f, 0.712416112f},
-std::array<float,2>{0.0290724393f, 0.764728963f},
-std::array<float,2>{0.75662756f, 0.194833383f},
-std::array<float,2>{0.119256504f, 0.381688774f},
-std::array<float,2>{0.836916506f, 0.516919255f},
-std::array<float,2>{0.448952138f, 0.919759572f},
-std::array<float,2>{0.555015922f, 0.0965693444f},
-std::array<float,2>{0.279693544f, 0.148805007f},
-std::array<float,2>{0.711103797f, 0.841308355f},
-std::array<float,2>{0.139756724f, 0.663418114f},
-std::array<float,2>{0.914657652f, 0.320241779f},
-std::array<float,2>{0.15350306f, 0.169037685f},
-std::array<float,2>{0.923696756f, 0.845574617f},
-std::array<float,2>{0.255612016f, 0.62928772f},
-std::array<float,2>{0.698400974f, 0.349147856f},
-std::array<float,2>{0.461273313f, 0.41497606f},
-std::array<float,2>{0.545875132f, 0.555660725f},
-std::array<float,2>{0.10783796f, 0.882864475f},
-std::array<float,2>{0.819696844f, 0.0852845311f},
-std::array<float,2>{0.00130289095f, 0.307284683f},
-std::array<float,2>{0.77584672f, 0.72273922f},
-std::array<float,2>{0.381381541f, 0.784453154f},
-std::array<float,2>{0.570300877f, 0.227865458f},
-std::array<float,2>{0.315161556f, 0.0598965548f},
-std::array<float,2>{0.675117791f, 0.995419264f},
-std::array<float,2>{0.206711337f, 0.579857528f},
-std::array<float,2>{0.980835915f, 0.489999235f},
-std::array<float,2>{0.080041267f, 0.111693479f},
-std::array<float,2>{0.872375727f, 0.925241649f},
-std::array<float,2>{0.498320609f, 0.50416249f},
-std::array<float,2>{0.529431343f, 0.396536112f},
-std::array<float,2>{0.286984593f, 0.340482235f},
-std::array<float,2>{0.734665394f, 0.676541924f},
-std::array<float,2>{0.1633064f, 0.818392158f},
-std::array<float,2>{0.902936876f, 0.133152008f},
-std::array<float,2>{0.247134477f, 0.43919149f},
-std::array<float,2>{0.940483332f, 0.618080318f},
-std::array<float,2>{0.351637453f, 0.941126704f},
-std::array<float,2>{0.635773122f, 0.0247389227f},
-std::array<float,2>{0.414545834f, 0.206863463f},
-std::array<float,2>{0.621557951f, 0.77937144f},
-std::array<float,2>{0.0621277429f, 0.6916852f},
-std::array<float,2>{0.804676294f, 0.271438718f},
-std::array<float,2>{0.0690328851f, 0.233752221f},
-std::array<float,2>{0.843861938f, 0.788190663f},
-std::array<float,2>{0.471393317f, 0.720121801f},
-std::array<float,2>{0.515135825f, 0.310505509f},
-std::array<float,2>{0.305217773f, 0.48463586f},
-std::array<float,2>{0.725637197f, 0.584544778f},
-std::array<float,2>{0.177320063f, 0.996483982f},
-std::array<float,2>{0.875314355f, 0.0582041964f},
-std::array<float,2>{0.22119984f, 0.347449183f},
-std::array<float,2>{0.967988312f, 0.625833035f},
-std::array<float,2>{0.35973525f, 0.84804821f},
-std::array<float,2>{0.650630593f, 0.167638093f},
-std::array<float,2>{0.429609299f, 0.0813986808f},
-std::array<float,2>{0.59443891f, 0.889721453f},
-std::array<float,2>{0.0442223437f, 0.559625804f},
-std::array<float,2>{0.793255568f, 0.421302497f},
-std::array<float,2>{0.128862113f, 0.0292260908f},
-std::array<float,2>{0.911963105f, 0.944994986f},
-std::array<float,2>{0.273177326f, 0.623291314f},
-std::array<float,2>{0.708114862f, 0.442715436f},
-std::array<float,2>{0.444145411f, 0.267744213f},
-std::array<float,2>{0.553425372f, 0.689115107f},
-std::array<float,2>{0.109885216f, 0.776720822f},
-std::array<float,2>{0.834774673f, 0.20742102f},
-std::array<float,2>{0.0197163317f, 0.39405033f},
-std::array<float,2>{0.758587539f, 0.502642512f},
-std::array<float,2>{0.395254761f, 0.926094234f},
-std::array<float,2>{0.590401649f, 0.116064653f},
-std::array<float,2>{0.328172237f, 0.139142781f},
-std::array<float,2>{0.671777487f, 0.812631071f},
-std::array<float,2>{0.194727123f, 0.675355554f},
-std::array<float,2>{0.98702544f, 0.336216301f},
-std::array<float,2>{0.212327361f, 0.176592812f},
-std::array<float,2>{0.971335232f, 0.869669497f},
-std::array<float,2>{0.320526838f, 0.641078711f},
-std::array<float,2>{0.680462301f, 0.362355232f},
-std::array<float,2>{0.385821104f, 0.435137719f},
-std::array<float,2>{0.577561378f, 0.546411693f},
-std::array<float,2>{0.010163907f, 0.895561993f},
-std::array<float,2>{0.76628691f, 0.0663971677f},
-std::array<float,2>{0.0938436538f, 0.295936525f},
-std::array<float,2>{0.82614392f, 0.737704277f},
-std::array<float,2>{0.455266297f, 0.811061203f},
-std::array<float,2>{0.533444166f, 0.248401985f},
-std::array<float,2>{0.259067804f, 0.0381493866f},
-std::array<float,2>{0.694803596f, 0.974826753f},
-std::array<float,2>{0.144548491f, 0.563258469f},
-std::array<float,2>{0.933959424f, 0.478161186f},
-std::array<float,2>{0.0491053015f, 0.100006662f},
-std::array<float,2>{0.806246996f, 0.91526866f},
-std::array<float,2>{0.413701802f, 0.522790015f},
-std::array<float,2>{0.613683641f, 0.376351595f},
-std::array<float,2>{0.344392598f, 0.314181417f},
-std::array<float,2>{0.626365423f, 0.659151435f},
-std::array<float,2>{0.234745875f, 0.83935833f},
-std::array<float,2>{0.948773265f, 0.154801935f},
-std::array<float,2>{0.171866983f, 0.459695667f},
-std::array<float,2>{0.898263156f, 0.602199733f},
-std::array<float,2>{0.294357061f, 0.955311656f},
-std::array<float,2>{0.745517969f, 0.0007964049f},
-std::array<float,2>{0.485693127f, 0.190988138f},
-std::array<float,2>{0.522168517f, 0.760156751f},
-std::array<float,2>{0.0867957175f, 0.715556324f},
-std::array<float,2>{0.867067397f, 0.26406014f},
-std::array<float,2>{0.0077720019f, 0.146577939f},
-std::array<float,2>{0.780129492f, 0.82877773f},
-std::array<float,2>{0.377889901f, 0.666841924f},
-std::array<float,2>{0.565791011f, 0.326974541f},
-std::array<float,2>{0.318650931f, 0.390195459f},
-std::array<float,2>{0.679036975f, 0.530925214f},
-std::array<float,2>{0.210169256f, 0.910184562f},
-std::array<float,2>{0.979428172f, 0.104586363f},
-std::array<float,2>{0.149166942f, 0.255306423f},
-std::array<float,2>{0.929501057f, 0.708626449f},
-std::array<float,2>{0.253760457f, 0.753549576f},
-std::array<float,2>{0.700746715f, 0.198148593f},
-std::array<float,2>{0.467354178f, 0.00850216765f},
-std::array<float,2>{0.540274203f, 0.964410722f},
-std::array<float,2>{0.102450117f, 0.599251449f},
-std::array<float,2>{0.816399038f, 0.464095533f},
-std::array<float,2>{0.245739073f, 0.0712852553f},
-std::array<float,2>{0.942582428f, 0.901898086f},
-std::array<float,2>{0.358009934f, 0.538989365f},
-std::array<float,2>{0.639695168f, 0.422850668f},
-std::array<float,2>{0.420843959f, 0.371294022f},
-std::array<float,2>{0.618469715f, 0.653071821f},
-std::array<float,2>{0.0555090606f, 0.866655171f},
-std::array<float,2>{0.797596097f, 0.182112798f},
-std::array<float,2>{0.0837832093f, 0.473265797f},
-std::array<float,2>{0.86970371f, 0.574366212f},
-std::array<float,2>{0.495022565f, 0.984019876f},
-std::array<float,2>{0.524991095f, 0.0465548001f},
-std::array<float,2>{0.28240189f, 0.237844095f},
-std::array<float,2>{0.740079999f, 0.797679603f},
-std::array<float,2>{0.156361282f, 0.744171798f},
-std::array<float,2>{0.901328027f, 0.2855694f},
-std::array<float,2>{0.187396824f, 0.212544516f},
-std::array<float,2>{0.884228528f, 0.7704252f},
-std::array<float,2>{0.299430996f, 0.696225166f},
-std::array<float,2>{0.730701804f, 0.27935338f},
-std::array<float,2>{0.484342247f, 0.446502328f},
-std::array<float,2>{0.506493151f, 0.616383255f},
-std::array<float,2>{0.0770044029f, 0.949627042f},
-std::array<float,2>{0.85409379f, 0.0189937223f},
-std::array<float,2>{0.0385049805f, 0.330968797f},
-std::array<float,2>{0.787556767f, 0.686255455f},
-std::array<float,2>{0.435868353f, 0.826020539f},
-std::array<float,2>{0.603018463f, 0.128468066f},
-std::array<float,2>{0.37100026f, 0.120890513f},
-std::array<float,2>{0.641866922f, 0.933546603f},
-std::array<float,2>{0.226743564f, 0.513589919f},
-std::array<float,2>{0.953649104f, 0.403719544f},
-std::array<float,2>{0.122053623f, 0.0524268039f},
-std::array<float,2>{0.842220664f, 0.98672384f},
-std::array<float,2>{0.450288832f, 0.590706766f},
-std::array<float,2>{0.559176922f, 0.497225791f},
-std::array<float,2>{0.274572372f, 0.299766511f},
-std::array<float,2>{0.718495429f, 0.727619946f},
-std::array<float,2>{0.13402082f, 0.790182173f},
-std::array<float,2>{0.920125306f, 0.223039314f},
-std::array<float,2>{0.201214209f, 0.40744552f},
-std::array<float,2>{0.998517036f, 0.554326355f},
-std::array<float,2>{0.337348104f, 0.877209544f},
-std::array<float,2>{0.662923217f, 0.0897944197f},
-std::array<float,2>{0.399827868f, 0.163288176f},
-std::array<float,2>{0.583040118f, 0.853296936f},
-std::array<float,2>{0.0252455007f, 0.633437812f},
-std::array<float,2>{0.75141412f, 0.352432579f},
-std::array<float,2>{0.107989952f, 0.170808107f},
-std::array<float,2>{0.820092499f, 0.845843911f},
-std::array<float,2>{0.461634219f, 0.630897522f},
-std::array<float,2>{0.545340657f, 0.35007441f},
-std::array<float,2>{0.255079269f, 0.41749841f},
-std::array<float,2>{0.698923051f, 0.557949781f},
-std::array<float,2>{0.154032379f, 0.884767771f},
-std::array<float,2>{0.923125982f, 0.0835876837f},
-std::array<float,2>{0.206412017f, 0.304973423f},
-std::array<float,2>{0.980993569f, 0.72571373f},
-std::array<float,2>{0.31453985f, 0.781602919f},
-std::array<float,2>{0.675677359f, 0.229738414f},
-std::array<float,2>{0.381263137f, 0.0606983751f},
-std::array<float,2>{0.569756866f, 0.993543386f},
-std::array<float,2>{0.00176876073f, 0.58009392f},
-std::array<float,2>{0.7760818f, 0.490841091f},
-std::array<float,2>{0.163975671f, 0.109857962f},
-std::array<float,2>{0.902669966f, 0.922067761f},
-std::array<float,2>{0.286199272f, 0.506317794f},
-std::array<float,2>{0.735006928f, 0.396412522f},
-std::array<float,2>{0.498538375f, 0.343252331f},
-std::array<float,2>{0.530200064f, 0.677934885f},
-std::array<float,2>{0.0792084113f, 0.817269921f},
-std::array<float,2>{0.87260741f, 0.134881839f},
-std::array<float,2>{0.0617074072f, 0.440959811f},
-std::array<float,2>{0.803945899f, 0.620326459f},
-std::array<float,2>{0.414632529f, 0.937700927f},
-std::array<float,2>{0.621999979f, 0.0267355964f},
-std::array<float,2>{0.352495581f, 0.204547152f},
-std::array<float,2>{0.636511683f, 0.778850853f},
-std::array<float,2>{0.248021036f, 0.693869472f},
-std::array<float,2>{0.941022575f, 0.27336359f},
-std::array<float,2>{0.234244555f, 0.243712574f},
-std::array<float,2>{0.957622349f, 0.808356345f},
-std::array<float,2>{0.374672234f, 0.740070343f},
-std::array<float,2>{0.645032525f, 0.292562872f},
-std::array<float,2>{0.431899428f, 0.48129952f},
-std::array<float,2>{0.605959296f, 0.566937625f},
-std::array<float,2>{0.0324622281f, 0.969315827f},
-std::array<float,2>{0.783293009f, 0.0324074328f},
-std::array<float,2>{0.0717086494f, 0.363512963f},
-std::array<float,2>{0.858754218f, 0.647762954f},
-std::array<float,2>{0.477537394f, 0.873948753f},
-std::array<float,2>{0.500508487f, 0.174139306f},
-std::array<float,2>{0.301080525f, 0.0682297051f},
-std::array<float,2>{0.727964938f, 0.891908646f},
-std::array<float,2>{0.180004478f, 0.54181695f},
-std::array<float,2>{0.887819588f, 0.430361956f},
-std::array<float,2>{0.0286690444f, 0.00714510633f},
-std::array<float,2>{0.755942822f, 0.960487902f},
-std::array<float,2>{0.403481305f, 0.606275678f},
-std::array<float,2>{0.57969141f, 0.455104709f},
-std::array<float,2>{0.340303898f, 0.261296362f},
-std::array<float,2>{0.656401575f, 0.71420902f},
-std::array<float,2>{0.196507588f, 0.763530493f},
-std::array<float,2>{0.995578051f, 0.193269745f},
-std::array<float,2>{0.140221015f, 0.380015254f},
-std::array<float,2>{0.914287269f, 0.519104719f},
-std::array<float,2>{0.279914975f, 0.921423078f},
-std::array<float,2>{0.711593866f, 0.0955409482f},
-std::array<float,2>{0.448498398f, 0.151122555f},
-std::array<float,2>{0.555559218f, 0.842843831f},
-std::array<float,2>{0.11973583f, 0.661077261f},
-std::array<float,2>{0.837800562f, 0.317971438f},
-std::array<float,2>{0.0396470129f, 0.200386658f},
-std::array<float,2>{0.789822161f, 0.753907502f},
-std::array<float,2>{0.423139244f, 0.70570153f},
-std::array<float,2>{0.59885025f, 0.253850281f},
-std::array<float,2>{0.363935977f, 0.468391746f},
-std::array<float,2>{0.653590381f, 0.596338749f},
-std::array<float,2>{0.226331502f, 0.966194212f},
-std::array<float,2>{0.962653935f, 0.0143416487f},
-std::array<float,2>{0.174982399f, 0.322937816f},
-std::array<float,2>{0.88124609f, 0.670155227f},
-std::array<float,2>{0.311735094f, 0.834484816f},
-std::array<float,2>{0.720976293f, 0.14388679f},
-std::array<float,2>{0.475670934f, 0.106623664f},
-std::array<float,2>{0.5111655f, 0.907739341f},
-std::array<float,2>{0.0639154464f, 0.525662184f},
-std::array<float,2>{0.850821078f, 0.385057956f},
-std::array<float,2>{0.189159095f, 0.0394192375f},
-std::array<float,2>{0.988733113f, 0.978878736f},
-std::array<float,2>{0.332145691f, 0.570606649f},
-std::array<float,2>{0.667944372f, 0.469832361f},
-std::array<float,2>{0.392605364f, 0.284088075f},
-std::array<float,2>{0.587251425f, 0.749394298f},
-std::array<float,2>{0.0191301312f, 0.804135978f},
-std::array<float,2>{0.763039589f, 0.241804227f},
-std::array<float,2>{0.114604898f, 0.427561939f},
-std::array<float,2>{0.830812097f, 0.533711314f},
-std::array<float,2>{0.440894157f, 0.904731989f},
-std::array<float,2>{0.550731897f, 0.074410215f},
-std::array<float,2>{0.268019736f, 0.185696587f},
-std::array<float,2>{0.706755221f, 0.862746358f},
-std::array<float,2>{0.129053161f, 0.650852084f},
-std::array<float,2>{0.909996629f, 0.367672563f},
-std::array<float,2>{0.142526358f, 0.130821869f},
-std::array<float,2>{0.932002544f, 0.822601676f},
-std::array<float,2>{0.264620602f, 0.680502474f},
-std::array<float,2>{0.688628018f, 0.335383415f},
-std::array<float,2>{0.4597947f, 0.401169956f},
-std::array<float,2>{0.537928879f, 0.510721266f},
-std::array<float,2>{0.101410411f, 0.935939491f},
-std::array<float,2>{0.820815921f, 0.121819496f},
-std::array<float,2>{0.0150185497f, 0.276777357f},
-std::array<float,2>{0.769616604f, 0.7015481f},
-std::array<float,2>{0.387120098f, 0.765779912f},
-std::array<float,2>{0.571638942f, 0.215464205f},
-std::array<float,2>{0.325629354f, 0.0218581706f},
-std::array<float,2>{0.686154485f, 0.948927045f},
-std::array<float,2>{0.216600388f, 0.611284256f},
-std::array<float,2>{0.974212885f, 0.449422121f},
-std::array<float,2>{0.0913005844f, 0.09342397f},
-std::array<float,2>{0.860765457f, 0.882158935f},
-std::array<float,2>{0.488376826f, 0.548774362f},
-std::array<float,2>{0.519377708f, 0.412518322f},
-std::array<float,2>{0.292950302f, 0.356732428f},
-std::array<float,2>{0.749638617f, 0.637914479f},
-std::array<float,2>{0.164700672f, 0.857440829f},
-std::array<float,2>{0.890938163f, 0.158101931f},
-std::array<float,2>{0.239740908f, 0.494437069f},
-std::array<float,2>{0.951474965f, 0.586024106f},
-std::array<float,2>{0.348564714f, 0.990967929f},
-std::array<float,2>{0.630464971f, 0.0493700467f},
-std::array<float,2>{0.410059482f, 0.221088201f},
-std::array<float,2>{0.609536409f, 0.796102226f},
-std::array<float,2>{0.0513820909f, 0.732719243f},
-std::array<float,2>{0.811401188f, 0.30196619f},
-std::array<float,2>{0.11233253f, 0.209670559f},
-std::array<float,2>{0.832721353f, 0.775317729f},
-std::array<float,2>{0.441490859f, 0.689707041f},
-std::array<float,2>{0.552624464f, 0.266139686f},
-std::array<float,2>{0.270284474f, 0.444751918f},
-std::array<float,2>{0.709054708f, 0.622324884f},
-std::array<float,2>{0.125627562f, 0.943246007f},
-std::array<float,2>{0.912613988f, 0.0293656103f},
-std::array<float,2>{0.192400843f, 0.339446455f},
-std::array<float,2>{0.98609966f, 0.672148108f},
-std::array<float,2>{0.330087215f, 0.815579116f},
-std::array<float,2>{0.669291854f, 0.13854523f},
-std::array<float,2>{0.398025781f, 0.113593608f},
-std::array<float,2>{0.592672765f, 0.929004252f},
-std::array<float,2>{0.0218869448f, 0.501138031f},
-std::array<float,2>{0.760699689f, 0.392571539f},
-std::array<float,2>{0.178220525f, 0.0555354021f},
-std::array<float,2>{0.878071964f, 0.998604953f},
-std::array<float,2>{0.307745904f, 0.582167387f},
-std::array<float,2>{0.723077059f, 0.487890989f},
-std::array<float,2>{0.469466478f, 0.311133891f},
-std::array<float,2>{0.513002098f, 0.722570777f},
-std::array<float,2>{0.0677469894f, 0.785883427f},
-std::array<float,2>{0.847439468f, 0.230915308f},
-std::array<float,2>{0.0453709997f, 0.419896305f},
-std::array<float,2>{0.795087099f, 0.560577214f},
-std::array<float,2>{0.427561194f, 0.887556493f},
-std::array<float,2>{0.59754765f, 0.0795229301f},
-std::array<float,2>{0.362185538f, 0.165576279f},
-std::array<float,2>{0.650271356f, 0.85125649f},
-std::array<float,2>{0.21946612f, 0.628026903f},
-std::array<float,2>{0.966155291f, 0.344542265f},
-std::array<float,2>{0.237884924f, 0.154174f},
-std::array<float,2>{0.946741283f, 0.837549031f},
-std::array<float,2>{0.346147269f, 0.657434046f},
-std::array<float,2>{0.627279103f, 0.315409988f},
-std::array<float,2>{0.411484152f, 0.378115118f},
-std::array<float,2>{0.615338385f, 0.520307064f},
-std::array<float,2>{0.048470743f, 0.91732198f},
-std::array<float,2>{0.80746448f, 0.098999396f},
-std::array<float,2>{0.0889103785f, 0.263026863f},
-std::array<float,2>{0.864185929f, 0.717044115f},
-std::array<float,2>{0.486683249f, 0.759577215f},
-std::array<float,2>{0.519763052f, 0.187677354f},
-std::array<float,2>{0.295136333f, 0.00278282235f},
-std::array<float,2>{0.743858516f, 0.953190327f},
-std::array<float,2>{0.167973787f, 0.603913426f},
-std::array<float,2>{0.895127118f, 0.457937211f},
-std::array<float,2>{0.00875418633f, 0.0627338216f},
-std::array<float,2>{0.768040001f, 0.89764756f},
-std::array<float,2>{0.383556157f, 0.544753075f},
-std::array<float,2>{0.576036274f, 0.437254727f},
-std::array<float,2>{0.323331028f, 0.359986663f},
-std::array<float,2>{0.682783842f, 0.644081354f},
-std::array<float,2>{0.213562414f, 0.867492735f},
-std::array<float,2>{0.970076561f, 0.178639308f},
-std::array<float,2>{0.147868648f, 0.480135173f},
-std::array<float,2>{0.936153829f, 0.56563884f},
-std::array<float,2>{0.260708094f, 0.973103881f},
-std::array<float,2>{0.69157052f, 0.0355992988f},
-std::array<float,2>{0.454338998f, 0.246237695f},
-std::array<float,2>{0.531490207f, 0.809300125f},
-std::array<float,2>{0.0970482454f, 0.736252308f},
-std::array<float,2>{0.827887833f, 0.293611854f},
-std::array<float,2>{0.0576797202f, 0.181228548f},
-std::array<float,2>{0.799377263f, 0.864362895f},
-std::array<float,2>{0.419192016f, 0.655631781f},
-std::array<float,2>{0.619877219f, 0.37403363f},
-std::array<float,2>{0.355842203f, 0.424296141f},
-std::array<float,2>{0.638551295f, 0.536087036f},
-std::array<float,2>{0.243459716f, 0.898682714f},
-std::array<float,2>{0.94375658f, 0.073865734f},
-std::array<float,2>{0.159934565f, 0.287747175f},
-std::array<float,2>{0.899935663f, 0.744063795f},
-std::array<float,2>{0.284908056f, 0.799639761f},
-std::array<float,2>{0.740690947f, 0.234709874f},
-std::array<float,2>{0.492714256f, 0.0431403108f},
-std::array<float,2>{0.525779426f, 0.981715918f},
-std::array<float,2>{0.0846442878f, 0.577512503f},
-std::array<float,2>{0.867458284f, 0.476419538f},
-std::array<float,2>{0.207978413f, 0.103101596f},
-std::array<float,2>{0.977483988f, 0.913159311f},
-std::array<float,2>{0.316624701f, 0.528001606f},
-std::array<float,2>{0.677100301f, 0.387948841f},
-std::array<float,2>{0.376886576f, 0.324667573f},
-std::array<float,2>{0.563475847f, 0.665145695f},
-std::array<float,2>{0.00519521441f, 0.831064105f},
-std::array<float,2>{0.777451515f, 0.145039499f},
-std::array<float,2>{0.10535381f, 0.461769015f},
-std::array<float,2>{0.81415987f, 0.601198375f},
-std::array<float,2>{0.466027498f, 0.962244749f},
-std::array<float,2>{0.541389167f, 0.011621302f},
-std::array<float,2>{0.25145182f, 0.19598949f},
-std::array<float,2>{0.702201784f, 0.751377165f},
-std::array<float,2>{0.151875228f, 0.710505724f},
-std::array<float,2>{0.927670002f, 0.257755995f},
-std::array<float,2>{0.134841591f, 0.225355223f},
-std::array<float,2>{0.919475555f, 0.792808712f},
-std::array<float,2>{0.277285874f, 0.72921896f},
-std::array<float,2>{0.716197431f, 0.297511667f},
-std::array<float,2>{0.451739728f, 0.498557895f},
-std::array<float,2>{0.560815036f, 0.593583465f},
-std::array<float,2>{0.123754442f, 0.985798776f},
-std::array<float,2>{0.840452433f, 0.0538235456f},
-std::array<float,2>{0.0259594787f, 0.355072796f},
-std::array<float,2>{0.753081977f, 0.635752201f},
-std::array<float,2>{0.402034551f, 0.854254544f},
-std::array<float,2>{0.584538996f, 0.160280839f},
-std::array<float,2>{0.339590788f, 0.0872167796f},
-std::array<float,2>{0.662097573f, 0.876588047f},
-std::array<float,2>{0.19933486f, 0.551213801f},
-std::array<float,2>{0.99689883f, 0.408352196f},
-std::array<float,2>{0.0742901638f, 0.0159344673f},
-std::array<float,2>{0.851866841f, 0.952348471f},
-std::array<float,2>{0.480748475f, 0.613879263f},
-std::array<float,2>{0.504495919f, 0.447722286f},
-std::array<float,2>{0.2985605f, 0.277842999f},
-std::array<float,2>{0.733413637f, 0.698253691f},
-std::array<float,2>{0.18448925f, 0.772736967f},
-std::array<float,2>{0.88595432f, 0.213561028f},
-std::array<float,2>{0.22976096f, 0.404438943f},
-std::array<float,2>{0.956812739f, 0.515393913f},
-std::array<float,2>{0.367249638f, 0.92970109f},
-std::array<float,2>{0.642879665f, 0.117918529f},
-std::array<float,2>{0.434471041f, 0.126536191f},
-std::array<float,2>{0.604450703f, 0.826462746f},
-std::array<float,2>{0.0356867947f, 0.68494153f},
-std::array<float,2>{0.785608947f, 0.329202652f},
-std::array<float,2>{0.0818152055f, 0.133439258f},
-std::array<float,2>{0.874075115f, 0.819244266f},
-std::array<float,2>{0.496745557f, 0.675889194f},
-std::array<float,2>{0.527711153f, 0.340251833f},
-std::array<float,2>{0.288053632f, 0.397121936f},
-std::array<float,2>{0.737792969f, 0.504502535f},
-std::array<float,2>{0.161305949f, 0.925453961f},
-std::array<float,2>{0.904413998f, 0.112193979f},
-std::array<float,2>{0.249790996f, 0.270823449f},
-std::array<float,2>{0.939290166f, 0.691898286f},
-std::array<float,2>{0.353646874f, 0.780170023f},
-std::array<float,2>{0.633569717f, 0.206224903f},
-std::array<float,2>{0.417323589f, 0.0253399648f},
-std::array<float,2>{0.623449981f, 0.940494537f},
-std::array<float,2>{0.0600171275f, 0.617265582f},
-std::array<float,2>{0.801827252f, 0.438693792f},
-std::array<float,2>{0.154963911f, 0.0855309442f},
-std::array<float,2>{0.925436854f, 0.883571982f},
-std::array<float,2>{0.257290184f, 0.554959118f},
-std::array<float,2>{0.695970535f, 0.414443046f},
-std::array<float,2>{0.46476391f, 0.348876327f},
-std::array<float,2>{0.542969823f, 0.629840434f},
-std::array<float,2>{0.106519274f, 0.845125794f},
-std::array<float,2>{0.817818761f, 0.169870973f},
-std::array<float,2>{0.00370531087f, 0.489655048f},
-std::array<float,2>{0.775305212f, 0.579539716f},
-std::array<float,2>{0.379554898f, 0.996061683f},
-std::array<float,2>{0.568095922f, 0.0601278096f},
-std::array<float,2>{0.312775165f, 0.22850816f},
-std::array<float,2>{0.673057973f, 0.785005331f},
-std::array<float,2>{0.204261944f, 0.723271906f},
-std::array<float,2>{0.983152986f, 0.306790769f},
-std::array<float,2>{0.198086873f, 0.194622129f},
-std::array<float,2>{0.994083583f, 0.765424788f},
-std::array<float,2>{0.342665732f, 0.712282896f},
-std::array<float,2>{0.659461141f, 0.259182781f},
-std::array<float,2>{0.404389501f, 0.453989863f},
-std::array<float,2>{0.581686556f, 0.608104765f},
-std::array<float,2>{0.0309143141f, 0.95856601f},
-std::array<float,2>{0.754725397f, 0.00465723453f},
-std::array<float,2>{0.118737802f, 0.319520622f},
-std::array<float,2>{0.839434922f, 0.663976312f},
-std::array<float,2>{0.445998132f, 0.841553926f},
-std::array<float,2>{0.557885766f, 0.14922139f},
-std::array<float,2>{0.278563499f, 0.0959431604f},
-std::array<float,2>{0.713169277f, 0.919004381f},
-std::array<float,2>{0.136887267f, 0.517392039f},
-std::array<float,2>{0.917909682f, 0.381113201f},
-std::array<float,2>{0.0332678109f, 0.0351499096f},
-std::array<float,2>{0.781449616f, 0.971333265f},
-std::array<float,2>{0.430795044f, 0.568777382f},
-std::array<float,2>{0.608831704f, 0.482938886f},
-std::array<float,2>{0.371744424f, 0.290227622f},
-std::array<float,2>{0.648404837f, 0.74131614f},
-std::array<float,2>{0.231961027f, 0.804972172f},
-std::array<float,2>{0.959214985f, 0.245626241f},
-std::array<float,2>{0.183192536f, 0.433214605f},
-std::array<float,2>{0.888849795f, 0.539121449f},
-std::array<float,2>{0.302767187f, 0.893538833f},
-std::array<float,2>{0.730412006f, 0.0701408312f},
-std::array<float,2>{0.479170352f, 0.173428953f},
-std::array<float,2>{0.502604246f, 0.87264508f},
-std::array<float,2>{0.0735031068f, 0.645807922f},
-std::array<float,2>{0.8571015f, 0.366152912f},
-std::array<float,2>{0.015860837f, 0.239184141f},
-std::array<float,2>{0.763867319f, 0.801910579f},
-std::array<float,2>{0.392443657f, 0.747599602f},
-std::array<float,2>{0.588834524f, 0.282766193f},
-std::array<float,2>{0.334827662f, 0.472513258f},
-std::array<float,2>{0.66439265f, 0.573155224f},
-std::array<float,2>{0.189678416f, 0.977417946f},
-std::array<float,2>{0.992126405f, 0.0426998474f},
-std::array<float,2>{0.132527962f, 0.37032488f},
-std::array<float,2>{0.906359196f, 0.648837328f},
-std::array<float,2>{0.267050117f, 0.860384107f},
-std::array<float,2>{0.704822838f, 0.184605092f},
-std::array<float,2>{0.439338803f, 0.076456584f},
-std::array<float,2>{0.548565865f, 0.903147161f},
-std::array<float,2>{0.115728691f, 0.532112598f},
-std::array<float,2>{0.829770923f, 0.428015232f},
-std::array<float,2>{0.222659051f, 0.0125198774f},
-std::array<float,2>{0.963894784f, 0.968168139f},
-std::array<float,2>{0.367006987f, 0.594717264f},
-std::array<float,2>{0.654383183f, 0.464845926f},
-std::array<float,2>{0.425196677f, 0.250047743f},
-std::array<float,2>{0.601150692f, 0.704839826f},
-std::array<float,2>{0.0421159603f, 0.756203115f},
-std::array<float,2>{0.792235851f, 0.201974809f},
-std::array<float,2>{0.0650722533f, 0.384654015f},
-std::array<float,2>{0.848838866f, 0.524478316f},
-std::array<float,2>{0.47414875f, 0.908507884f},
-std::array<float,2>{0.508207738f, 0.107423432f},
-std::array<float,2>{0.309518754f, 0.142191797f},
-std::array<float,2>{0.719927907f, 0.833657146f},
-std::array<float,2>{0.172301635f, 0.668991208f},
-std::array<float,2>{0.879965544f, 0.320829004f},
-std::array<float,2>{0.16668357f, 0.15943031f},
-std::array<float,2>{0.893722415f, 0.857180834f},
-std::array<float,2>{0.289852142f, 0.640050173f},
-std::array<float,2>{0.746480644f, 0.357723266f},
-std::array<float,2>{0.490813255f, 0.412017882f},
-std::array<float,2>{0.516079545f, 0.550755203f},
-std::array<float,2>{0.0923781097f, 0.880198896f},
-std::array<float,2>{0.863119245f, 0.0909485742f},
-std::array<float,2>{0.053029459f, 0.303609729f},
-std::array<float,2>{0.810347795f, 0.730939865f},
-std::array<float,2>{0.407073438f, 0.79471755f},
-std::array<float,2>{0.612597644f, 0.219606951f},
-std::array<float,2>{0.350618929f, 0.0480723418f},
-std::array<float,2>{0.632779837f, 0.989616036f},
-std::array<float,2>{0.241659895f, 0.589537323f},
-std::array<float,2>{0.949822605f, 0.492962182f},
-std::array<float,2>{0.0977053046f, 0.124871559f},
-std::array<float,2>{0.822654188f, 0.935220778f},
-std::array<float,2>{0.45727095f, 0.509668112f},
-std::array<float,2>{0.535687804f, 0.398920059f},
-std::array<float,2>{0.261913776f, 0.332588583f},
-std::array<float,2>{0.690895855f, 0.682404041f},
-std::array<float,2>{0.143202782f, 0.82193768f},
-std::array<float,2>{0.930299163f, 0.132235855f},
-std::array<float,2>{0.218560323f, 0.452481687f},
-std::array<float,2>{0.976377904f, 0.612101853f},
-std::array<float,2>{0.326818615f, 0.945483506f},
-std::array<float,2>{0.685116708f, 0.0214493256f},
-std::array<float,2>{0.388861716f, 0.218616769f},
-std::array<float,2>{0.573911369f, 0.769359827f},
-std::array<float,2>{0.0126614468f, 0.700425386f},
-std::array<float,2>{0.772939742f, 0.274421692f},
-std::array<float,2>{0.0966722295f, 0.249226153f},
-std::array<float,2>{0.826268017f, 0.811662436f},
-std::array<float,2>{0.45352596f, 0.737090826f},
-std::array<float,2>{0.53286463f, 0.295633256f},
-std::array<float,2>{0.260802299f, 0.47659272f},
-std::array<float,2>{0.693126142f, 0.564272225f},
-std::array<float,2>{0.147121042f, 0.975967169f},
-std::array<float,2>{0.937253416f, 0.0372697599f},
-std::array<float,2>{0.213909045f, 0.361495584f},
-std::array<float,2>{0.969677389f, 0.641629517f},
-std::array<float,2>{0.322938293f, 0.870740473f},
-std::array<float,2>{0.682128251f, 0.177493617f},
-std::array<float,2>{0.384697646f, 0.0646558776f},
-std::array<float,2>{0.57460469f, 0.894671977f},
-std::array<float,2>{0.00926388614f, 0.545313537f},
-std::array<float,2>{0.769334137f, 0.434356332f},
-std::array<float,2>{0.169456229f, 0.00121473009f},
-std::array<float,2>{0.896211505f, 0.956285954f},
-std::array<float,2>{0.296373248f, 0.602739453f},
-std::array<float,2>{0.742583752f, 0.460417092f},
-std::array<float,2>{0.488123804f, 0.26520741f},
-std::array<float,2>{0.521030068f, 0.716679752f},
-std::array<float,2>{0.0887386054f, 0.761489213f},
-std::array<float,2>{0.865175128f, 0.189908609f},
-std::array<float,2>{0.0477138981f, 0.375724792f},
-std::array<float,2>{0.8082847f, 0.522013485f},
-std::array<float,2>{0.410209239f, 0.914631963f},
-std::array<float,2>{0.617017269f, 0.101117231f},
-std::array<float,2>{0.347609341f, 0.156197488f},
-std::array<float,2>{0.628872037f, 0.838314116f},
-std::array<float,2>{0.236410037f, 0.659892261f},
-std::array<float,2>{0.945847869f, 0.31303519f},
-std::array<float,2>{0.219932422f, 0.166837707f},
-std::array<float,2>{0.965732634f, 0.849260926f},
-std::array<float,2>{0.363155872f, 0.626240671f},
-std::array<float,2>{0.648761928f, 0.346199036f},
-std::array<float,2>{0.426056355f, 0.420453936f},
-std::array<float,2>{0.595746636f, 0.559557378f},
-std::array<float,2>{0.0461641662f, 0.88871938f},
-std::array<float,2>{0.796799839f, 0.080679059f},
-std::array<float,2>{0.0670332089f, 0.30875656f},
-std::array<float,2>{0.84605211f, 0.719543219f},
-std::array<float,2>{0.470320523f, 0.787476063f},
-std::array<float,2>{0.512554288f, 0.232942179f},
-std::array<float,2>{0.307553679f, 0.0568531156f},
-std::array<float,2>{0.724248409f, 0.997641027f},
-std::array<float,2>{0.179560497f, 0.585096478f},
-std::array<float,2>{0.877027452f, 0.486028343f},
-std::array<float,2>{0.0226219874f, 0.116719447f},
-std::array<float,2>{0.761540055f, 0.927318037f},
-std::array<float,2>{0.396606117f, 0.503628075f},
-std::array<float,2>{0.593588471f, 0.393213749f},
-std::array<float,2>{0.331415296f, 0.337595135f},
-std::array<float,2>{0.668691874f, 0.673904777f},
-std::array<float,2>{0.191718206f, 0.814141095f},
-std::array<float,2>{0.985239685f, 0.140464202f},
-std::array<float,2>{0.126493275f, 0.441869855f},
-std::array<float,2>{0.913973868f, 0.624297917f},
-std::array<float,2>{0.271185726f, 0.943542719f},
-std::array<float,2>{0.710397184f, 0.0273807198f},
-std::array<float,2>{0.44255954f, 0.208964095f},
-std::array<float,2>{0.55083859f, 0.775511205f},
-std::array<float,2>{0.112150975f, 0.688220561f},
-std::array<float,2>{0.833422005f, 0.268968403f},
-std::array<float,2>{0.0362294391f, 0.127496988f},
-std::array<float,2>{0.786134422f, 0.824742913f},
-std::array<float,2>{0.434627056f, 0.686965704f},
-std::array<float,2>{0.605131209f, 0.331420124f},
-std::array<float,2>{0.368386894f, 0.402627885f},
-std::array<float,2>{0.644161999f, 0.512400448f},
-std::array<float,2>{0.22909151f, 0.931660473f},
-std::array<float,2>{0.955131114f, 0.119607791f},
-std::array<float,2>{0.185479715f, 0.280937999f},
-std::array<float,2>{0.885535419f, 0.696515739f},
-std::array<float,2>{0.296885073f, 0.770728469f},
-std::array<float,2>{0.733172059f, 0.21142f},
-std::array<float,2>{0.481932074f, 0.0181450229f},
-std::array<float,2>{0.505535424f, 0.951104701f},
-std::array<float,2>{0.076105237f, 0.615851879f},
-std::array<float,2>{0.852685452f, 0.445913672f},
-std::array<float,2>{0.200716868f, 0.088402316f},
-std::array<float,2>{0.99803704f, 0.878893495f},
-std::array<float,2>{0.338266462f, 0.553527117f},
-std::array<float,2>{0.660832405f, 0.406606376f},
-std::array<float,2>{0.400886059f, 0.353182465f},
-std::array<float,2>{0.585653305f, 0.634164155f},
-std::array<float,2>{0.0265235957f, 0.852089703f},
-std::array<float,2>{0.752735198f, 0.162787616f},
-std::array<float,2>{0.124574997f, 0.496462137f},
-std::array<float,2>{0.840851188f, 0.591725528f},
-std::array<float,2>{0.452963084f, 0.988227785f},
-std::array<float,2>{0.561765134f, 0.0508162491f},
-std::array<float,2>{0.276248097f, 0.223815531f},
-std::array<float,2>{0.714850843f, 0.789454281f},
-std::array<float,2>{0.135996625f, 0.726625741f},
-std::array<float,2>{0.918183446f, 0.300322443f},
-std::array<float,2>{0.151056826f, 0.199069619f},
-std::array<float,2>{0.926359832f, 0.752226889f},
-std::array<float,2>{0.25080964f, 0.707463086f},
-std::array<float,2>{0.701702714f, 0.254395038f},
-std::array<float,2>{0.465097576f, 0.463162392f},
-std::array<float,2>{0.542394698f, 0.598164022f},
-std::array<float,2>{0.10385374f, 0.963684499f},
-std::array<float,2>{0.813135147f, 0.0094060665f},
-std::array<float,2>{0.00423061708f, 0.327638984f},
-std::array<float,2>{0.778844059f, 0.667321682f},
-std::array<float,2>{0.375219971f, 0.829330146f},
-std::array<float,2>{0.563517153f, 0.148193642f},
-std::array<float,2>{0.317932934f, 0.104291044f},
-std::array<float,2>{0.676584244f, 0.911542594f},
-std::array<float,2>{0.208572298f, 0.529640138f},
-std::array<float,2>{0.977986991f, 0.38927871f},
-std::array<float,2>{0.0854119062f, 0.0452686548f},
-std::array<float,2>{0.868982971f, 0.982716858f},
-std::array<float,2>{0.493575633f, 0.575206697f},
-std::array<float,2>{0.527340591f, 0.47367844f},
-std::array<float,2>{0.283287942f, 0.287045687f},
-std::array<float,2>{0.741443872f, 0.745847881f},
-std::array<float,2>{0.158634335f, 0.797965288f},
-std::array<float,2>{0.899087012f, 0.237088934f},
-std::array<float,2>{0.24288854f, 0.423204571f},
-std::array<float,2>{0.945172429f, 0.537369013f},
-std::array<float,2>{0.356924951f, 0.901001096f},
-std::array<float,2>{0.637397826f, 0.0721790791f},
-std::array<float,2>{0.418165356f, 0.182889074f},
-std::array<float,2>{0.62106365f, 0.86587733f},
-std::array<float,2>{0.0570478477f, 0.65414381f},
-std::array<float,2>{0.800596535f, 0.372931629f},
-std::array<float,2>{0.0726123005f, 0.175162882f},
-std::array<float,2>{0.855479658f, 0.874498725f},
-std::array<float,2>{0.479586214f, 0.6469087f},
-std::array<float,2>{0.503537297f, 0.364793092f},
-std::array<float,2>{0.304031581f, 0.431022525f},
-std::array<float,2>{0.729056001f, 0.542918861f},
-std::array<float,2>{0.182474241f, 0.891067922f},
-std::array<float,2>{0.890583515f, 0.0665879548f},
-std::array<float,2>{0.230954319f, 0.291629732f},
-std::array<float,2>{0.959979236f, 0.73847723f},
-std::array<float,2>{0.372893244f, 0.80708766f},
-std::array<float,2>{0.646723568f, 0.242525175f},
-std::array<float,2>{0.430606276f, 0.031499397f},
-std::array<float,2>{0.607876837f, 0.970349848f},
-std::array<float,2>{0.0350789055f, 0.56770134f},
-std::array<float,2>{0.782865703f, 0.482404441f},
-std::array<float,2>{0.137721941f, 0.094192028f},
-std::array<float,2>{0.91638124f, 0.920222878f},
-std::array<float,2>{0.277463824f, 0.517957926f},
-std::array<float,2>{0.713929236f, 0.379516542f},
-std::array<float,2>{0.446524084f, 0.316594839f},
-std::array<float,2>{0.557176411f, 0.662032843f},
-std::array<float,2>{0.117577888f, 0.842586517f},
-std::array<float,2>{0.837987363f, 0.151931331f},
-std::array<float,2>{0.0297748093f, 0.456082404f},
-std::array<float,2>{0.755360067f, 0.607144237f},
-std::array<float,2>{0.405424863f, 0.959250093f},
-std::array<float,2>{0.580399036f, 0.00596915092f},
-std::array<float,2>{0.343154132f, 0.192199856f},
-std::array<float,2>{0.658459187f, 0.761857867f},
-std::array<float,2>{0.198654652f, 0.713527858f},
-std::array<float,2>{0.993042588f, 0.260687411f},
-std::array<float,2>{0.203166768f, 0.228816211f},
-std::array<float,2>{0.983922243f, 0.78296417f},
-std::array<float,2>{0.313785881f, 0.725364268f},
-std::array<float,2>{0.6722247f, 0.306385458f},
-std::array<float,2>{0.380071342f, 0.491996169f},
-std::array<float,2>{0.567225754f, 0.581683099f},
-std::array<float,2>{0.00292584742f, 0.99266845f},
-std::array<float,2>{0.774157524f, 0.0621970966f},
-std::array<float,2>{0.10576424f, 0.350737423f},
-std::array<float,2>{0.816837072f, 0.632621884f},
-std::array<float,2>{0.463354558f, 0.846699178f},
-std::array<float,2>{0.544129252f, 0.171740189f},
-std::array<float,2>{0.256497115f, 0.0826048255f},
-std::array<float,2>{0.697039843f, 0.886019588f},
-std::array<float,2>{0.155596405f, 0.557042181f},
-std::array<float,2>{0.924304247f, 0.416979969f},
-std::array<float,2>{0.0588031672f, 0.0259813033f},
-std::array<float,2>{0.80131793f, 0.938898385f},
-std::array<float,2>{0.416416436f, 0.619819522f},
-std::array<float,2>{0.624484003f, 0.439959705f},
-std::array<float,2>{0.355246902f, 0.271901876f},
-std::array<float,2>{0.63392216f, 0.694687426f},
-std::array<float,2>{0.248983204f, 0.77804929f},
-std::array<float,2>{0.938324213f, 0.203471035f},
-std::array<float,2>{0.160658479f, 0.395004898f},
-std::array<float,2>{0.905373633f, 0.507029831f},
-std::array<float,2>{0.288612753f, 0.923196137f},
-std::array<float,2>{0.736455679f, 0.111138269f},
-std::array<float,2>{0.497722447f, 0.136076108f},
-std::array<float,2>{0.528666735f, 0.817607462f},
-std::array<float,2>{0.0809055343f, 0.679356754f},
-std::array<float,2>{0.873649955f, 0.342628747f},
-std::array<float,2>{0.0127991159f, 0.216122374f},
-std::array<float,2>{0.771914601f, 0.76660502f},
-std::array<float,2>{0.390132636f, 0.702620685f},
-std::array<float,2>{0.572740018f, 0.27603057f},
-std::array<float,2>{0.328012794f, 0.451099336f},
-std::array<float,2>{0.684209347f, 0.609801114f},
-std::array<float,2>{0.216971338f, 0.948072374f},
-std::array<float,2>{0.974812925f, 0.0232539997f},
-std::array<float,2>{0.143667266f, 0.334631801f},
-std::array<float,2>{0.930774748f, 0.68073535f},
-std::array<float,2>{0.262957066f, 0.823736727f},
-std::array<float,2>{0.690113962f, 0.129869178f},
-std::array<float,2>{0.458093405f, 0.122210607f},
-std::array<float,2>{0.537050426f, 0.9368397f},
-std::array<float,2>{0.0994293094f, 0.511605322f},
-std::array<float,2>{0.823773324f, 0.402216971f},
-std::array<float,2>{0.240982592f, 0.0505036302f},
-std::array<float,2>{0.950259328f, 0.991751015f},
-std::array<float,2>{0.349856019f, 0.587603509f},
-std::array<float,2>{0.631765544f, 0.495537132f},
-std::array<float,2>{0.407306433f, 0.301223963f},
-std::array<float,2>{0.611913025f, 0.733785331f},
-std::array<float,2>{0.0537748225f, 0.795163155f},
-std::array<float,2>{0.808760643f, 0.222307429f},
-std::array<float,2>{0.0931061804f, 0.413287193f},
-std::array<float,2>{0.862250984f, 0.547635019f},
-std::array<float,2>{0.491318762f, 0.881115675f},
-std::array<float,2>{0.517007053f, 0.0921415836f},
-std::array<float,2>{0.290666938f, 0.15640603f},
-std::array<float,2>{0.747687638f, 0.859212279f},
-std::array<float,2>{0.167258903f, 0.636885405f},
-std::array<float,2>{0.892742515f, 0.356247246f},
-std::array<float,2>{0.173139587f, 0.143037543f},
-std::array<float,2>{0.8792032f, 0.835551679f},
-std::array<float,2>{0.309582829f, 0.671732247f},
-std::array<float,2>{0.719317198f, 0.32344979f},
-std::array<float,2>{0.472896963f, 0.386232287f},
-std::array<float,2>{0.508983314f, 0.526679099f},
-std::array<float,2>{0.0657263994f, 0.906848013f},
-std::array<float,2>{0.847874701f, 0.106268309f},
-std::array<float,2>{0.0413277484f, 0.251983434f},
-std::array<float,2>{0.791280925f, 0.706891358f},
-std::array<float,2>{0.424037397f, 0.755834162f},
-std::array<float,2>{0.600459456f, 0.199746549f},
-std::array<float,2>{0.365633786f, 0.0154829836f},
-std::array<float,2>{0.655798674f, 0.965548992f},
-std::array<float,2>{0.224304885f, 0.597071409f},
-std::array<float,2>{0.963496685f, 0.467746198f},
-std::array<float,2>{0.116998807f, 0.0759363919f},
-std::array<float,2>{0.828674793f, 0.905706763f},
-std::array<float,2>{0.437868506f, 0.534448326f},
-std::array<float,2>{0.546996713f, 0.425835043f},
-std::array<float,2>{0.265722871f, 0.369113773f},
-std::array<float,2>{0.703278303f, 0.651463866f},
-std::array<float,2>{0.130990937f, 0.862283289f},
-std::array<float,2>{0.90811938f, 0.187349379f},
-std::array<float,2>{0.190952346f, 0.468843758f},
-std::array<float,2>{0.990856886f, 0.57210511f},
-std::array<float,2>{0.335062146f, 0.980281115f},
-std::array<float,2>{0.665427625f, 0.0408643f},
-std::array<float,2>{0.391573489f, 0.24055095f},
-std::array<float,2>{0.589015126f, 0.803649008f},
-std::array<float,2>{0.0173599441f, 0.748611629f},
-std::array<float,2>{0.765361965f, 0.28503868f},
-std::array<float,2>{0.0874888822f, 0.188766822f},
-std::array<float,2>{0.866169691f, 0.757997692f},
-std::array<float,2>{0.484941155f, 0.718028903f},
-std::array<float,2>{0.523310423f, 0.262581497f},
-std::array<float,2>{0.293260694f, 0.458806723f},
-std::array<float,2>{0.74502933f, 0.604655921f},
-std::array<float,2>{0.170371652f, 0.954881966f},
-std::array<float,2>{0.896948755f, 0.00349863968f},
-std::array<float,2>{0.235990793f, 0.315598965f},
-std::array<float,2>{0.947396994f, 0.656330764f},
-std::array<float,2>{0.345399559f, 0.836912155f},
-std::array<float,2>{0.625556648f, 0.15266335f},
-std::array<float,2>{0.412911743f, 0.0985281542f},
-std::array<float,2>{0.614956737f, 0.916207135f},
-std::array<float,2>{0.0499540903f, 0.521282852f},
-std::array<float,2>{0.805084467f, 0.377576858f},
-std::array<float,2>{0.146226749f, 0.0366409756f},
-std::array<float,2>{0.935500026f, 0.974319875f},
-std::array<float,2>{0.25876236f, 0.565110147f},
-std::array<float,2>{0.693810701f, 0.478939146f},
-std::array<float,2>{0.457015187f, 0.29472512f},
-std::array<float,2>{0.534826398f, 0.735183477f},
-std::array<float,2>{0.0955307707f, 0.81012553f},
-std::array<float,2>{0.824755311f, 0.247445896f},
-std::array<float,2>{0.0111683365f, 0.436286241f},
-std::array<float,2>{0.767456055f, 0.543651819f},
-std::array<float,2>{0.38546598f, 0.896920681f},
-std::array<float,2>{0.576444566f, 0.0642043799f},
-std::array<float,2>{0.321926236f, 0.179539859f},
-std::array<float,2>{0.681601226f, 0.86845994f},
-std::array<float,2>{0.211731642f, 0.64280045f},
-std::array<float,2>{0.972134113f, 0.360908121f},
-std::array<float,2>{0.194300294f, 0.136943042f},
-std::array<float,2>{0.988185883f, 0.815292597f},
-std::array<float,2>{0.329826713f, 0.673495233f},
-std::array<float,2>{0.670746624f, 0.338233471f},
-std::array<float,2>{0.395664841f, 0.390779555f},
-std::array<float,2>{0.591266334f, 0.500871241f},
-std::array<float,2>{0.0205398425f, 0.928314388f},
-std::array<float,2>{0.759037793f, 0.114927903f},
-std::array<float,2>{0.110530145f, 0.267173976f},
-std::array<float,2>{0.835749328f, 0.690623403f},
-std::array<float,2>{0.444597811f, 0.774077117f},
-std::array<float,2>{0.554006398f, 0.210273877f},
-std::array<float,2>{0.271759242f, 0.0311698075f},
-std::array<float,2>{0.707945585f, 0.941961467f},
-std::array<float,2>{0.127242327f, 0.621384323f},
-std::array<float,2>{0.91069144f, 0.444228262f},
-std::array<float,2>{0.0439275987f, 0.0789209977f},
-std::array<float,2>{0.794527769f, 0.887800574f},
-std::array<float,2>{0.42799744f, 0.56212008f},
-std::array<float,2>{0.59504205f, 0.418613404f},
-std::array<float,2>{0.360399216f, 0.345033228f},
-std::array<float,2>{0.651469648f, 0.627519429f},
-std::array<float,2>{0.221844956f, 0.850276411f},
-std::array<float,2>{0.967046797f, 0.164870009f},
-std::array<float,2>{0.176193848f, 0.486509264f},
-std::array<float,2>{0.876376748f, 0.583250463f},
-std::array<float,2>{0.306099713f, 0.999736369f},
-std::array<float,2>{0.725322187f, 0.0561776496f},
-std::array<float,2>{0.472192109f, 0.23173973f},
-std::array<float,2>{0.514493227f, 0.786172211f},
-std::array<float,2>{0.0702537745f, 0.72126919f},
-std::array<float,2>{0.845195413f, 0.312167674f},
-std::array<float,2>{0.024197055f, 0.161850139f},
-std::array<float,2>{0.750051796f, 0.85469842f},
-std::array<float,2>{0.398706973f, 0.635439396f},
-std::array<float,2>{0.5824278f, 0.354448527f},
-std::array<float,2>{0.336593032f, 0.409236819f},
-std::array<float,2>{0.663782477f, 0.552592337f},
-std::array<float,2>{0.203107968f, 0.875826716f},
-std::array<float,2>{0.99937284f, 0.0866033584f},
-std::array<float,2>{0.133495539f, 0.298087656f},
-std::array<float,2>{0.921568155f, 0.729987621f},
-std::array<float,2>{0.274300516f, 0.791920543f},
-std::array<float,2>{0.717118442f, 0.225639388f},
-std::array<float,2>{0.44989565f, 0.0535844937f},
-std::array<float,2>{0.559591889f, 0.985029519f},
-std::array<float,2>{0.122349255f, 0.591920078f},
-std::array<float,2>{0.842858076f, 0.499769568f},
-std::array<float,2>{0.227723449f, 0.118404455f},
-std::array<float,2>{0.954393625f, 0.931575358f},
-std::array<float,2>{0.369898379f, 0.514385819f},
-std::array<float,2>{0.641273379f, 0.405945688f},
-std::array<float,2>{0.437333763f, 0.32830599f},
-std::array<float,2>{0.602417111f, 0.68373847f},
-std::array<float,2>{0.0372422673f, 0.827695072f},
-std::array<float,2>{0.788686097f, 0.125527471f},
-std::array<float,2>{0.0772186294f, 0.448530525f},
-std::array<float,2>{0.854844928f, 0.614596069f},
-std::array<float,2>{0.483320117f, 0.951624334f},
-std::array<float,2>{0.507171035f, 0.0173017476f},
-std::array<float,2>{0.299938589f, 0.214620277f},
-std::array<float,2>{0.731711805f, 0.771641314f},
-std::array<float,2>{0.186415687f, 0.697299957f},
-std::array<float,2>{0.883230388f, 0.27920264f},
-std::array<float,2>{0.157738164f, 0.235800281f},
-std::array<float,2>{0.902098656f, 0.800518334f},
-std::array<float,2>{0.281775087f, 0.743059635f},
-std::array<float,2>{0.738840818f, 0.288797557f},
-std::array<float,2>{0.495298445f, 0.475529432f},
-std::array<float,2>{0.523468614f, 0.576562285f},
-std::array<float,2>{0.0824787244f, 0.980609059f},
-std::array<float,2>{0.870883048f, 0.0448428355f},
-std::array<float,2>{0.0557618365f, 0.373496115f},
-std::array<float,2>{0.797890365f, 0.6545614f},
-std::array<float,2>{0.420949101f, 0.863634348f},
-std::array<float,2>{0.618013859f, 0.179899395f},
-std::array<float,2>{0.35850504f, 0.0732418969f},
-std::array<float,2>{0.638854563f, 0.900196791f},
-std::array<float,2>{0.244609922f, 0.537054002f},
-std::array<float,2>{0.941676617f, 0.424950659f},
-std::array<float,2>{0.1027584f, 0.0100855995f},
-std::array<float,2>{0.81447798f, 0.961713672f},
-std::array<float,2>{0.468523949f, 0.599781692f},
-std::array<float,2>{0.539240718f, 0.462346375f},
-std::array<float,2>{0.252132267f, 0.255913079f},
-std::array<float,2>{0.69979167f, 0.70958823f},
-std::array<float,2>{0.149941474f, 0.750771105f},
-std::array<float,2>{0.928175509f, 0.19635348f},
-std::array<float,2>{0.209158272f, 0.387142092f},
-std::array<float,2>{0.980460048f, 0.529090106f},
-std::array<float,2>{0.319661647f, 0.912229955f},
-std::array<float,2>{0.678692579f, 0.101577319f},
-std::array<float,2>{0.378228933f, 0.146283641f},
-std::array<float,2>{0.564867079f, 0.830745518f},
-std::array<float,2>{0.00683346111f, 0.66468519f},
-std::array<float,2>{0.780412555f, 0.326032996f},
-std::array<float,2>{0.120883539f, 0.150136128f},
-std::array<float,2>{0.836047709f, 0.840040088f},
-std::array<float,2>{0.447919309f, 0.662254632f},
-std::array<float,2>{0.556533158f, 0.318398505f},
-std::array<float,2>{0.281200916f, 0.382061243f},
-std::array<float,2>{0.712554097f, 0.516296148f},
-std::array<float,2>{0.138880596f, 0.918595791f},
-std::array<float,2>{0.915654242f, 0.0973576084f},
-std::array<float,2>{0.196136773f, 0.258614033f},
-std::array<float,2>{0.995003164f, 0.71096766f},
-std::array<float,2>{0.341617107f, 0.764493823f},
-std::array<float,2>{0.657670379f, 0.194145441f},
-std::array<float,2>{0.402419358f, 0.00572789274f},
-std::array<float,2>{0.578299582f, 0.957876027f},
-std::array<float,2>{0.0282925759f, 0.609231353f},
-std::array<float,2>{0.757762194f, 0.454736233f},
-std::array<float,2>{0.181270689f, 0.0692732558f},
-std::array<float,2>{0.88696599f, 0.893647909f},
-std::array<float,2>{0.301758766f, 0.540978014f},
-std::array<float,2>{0.727394581f, 0.432189584f},
-std::array<float,2>{0.478015184f, 0.366226465f},
-std::array<float,2>{0.501806259f, 0.645003498f},
-std::array<float,2>{0.0710088685f, 0.871759593f},
-std::array<float,2>{0.857778728f, 0.17228055f},
-std::array<float,2>{0.0319607183f, 0.484296322f},
-std::array<float,2>{0.784246981f, 0.570225477f},
-std::array<float,2>{0.432844996f, 0.972549856f},
-std::array<float,2>{0.606787086f, 0.0339752994f},
-std::array<float,2>{0.373784721f, 0.244954318f},
-std::array<float,2>{0.645958483f, 0.805680633f},
-std::array<float,2>{0.233291417f, 0.741070509f},
-std::array<float,2>{0.958534896f, 0.28918612f},
-std::array<float,2>{0.246449545f, 0.205863476f},
-std::array<float,2>{0.939719975f, 0.780635238f},
-std::array<float,2>{0.352811217f, 0.693092227f},
-std::array<float,2>{0.634767532f, 0.269630343f},
-std::array<float,2>{0.41555655f, 0.438080668f},
-std::array<float,2>{0.622217f, 0.618628681f},
-std::array<float,2>{0.060714934f, 0.9403615f},
-std::array<float,2>{0.803670824f, 0.0236160848f},
-std::array<float,2>{0.0788730308f, 0.341785818f},
-std::array<float,2>{0.871716738f, 0.677091837f},
-std::array<float,2>{0.499361515f, 0.819678187f},
-std::array<float,2>{0.531117976f, 0.134159923f},
-std::array<float,2>{0.285387516f, 0.112690546f},
-std::array<float,2>{0.73580879f, 0.924216628f},
-std::array<float,2>{0.16230996f, 0.505377412f},
-std::array<float,2>{0.903349757f, 0.398029655f},
-std::array<float,2>{0.000248323224f, 0.059132956f},
-std::array<float,2>{0.777097166f, 0.994555414f},
-std::array<float,2>{0.38267687f, 0.578466177f},
-std::array<float,2>{0.568478644f, 0.488734961f},
-std::array<float,2>{0.315811396f, 0.308345616f},
-std::array<float,2>{0.674088717f, 0.724482119f},
-std::array<float,2>{0.205415338f, 0.784169376f},
-std::array<float,2>{0.982357383f, 0.227312446f},
-std::array<float,2>{0.152604461f, 0.415291458f},
-std::array<float,2>{0.922257304f, 0.556275189f},
-std::array<float,2>{0.25437656f, 0.884079158f},
-std::array<float,2>{0.698174477f, 0.0840158686f},
-std::array<float,2>{0.462206334f, 0.168863818f},
-std::array<float,2>{0.546800733f, 0.844048023f},
-std::array<float,2>{0.108717084f, 0.630735695f},
-std::array<float,2>{0.81839931f, 0.348439604f},
-std::array<float,2>{0.0522990078f, 0.220502168f},
-std::array<float,2>{0.811664224f, 0.793400526f},
-std::array<float,2>{0.408554703f, 0.732408285f},
-std::array<float,2>{0.61090517f, 0.304276586f},
-std::array<float,2>{0.348994881f, 0.493831635f},
-std::array<float,2>{0.629522979f, 0.588816047f},
-std::array<float,2>{0.238676101f, 0.9890154f},
-std::array<float,2>{0.952358544f, 0.0475982167f},
-std::array<float,2>{0.165502667f, 0.358526111f},
-std::array<float,2>{0.891716003f, 0.63890785f},
-std::array<float,2>{0.291577071f, 0.856292784f},
-std::array<float,2>{0.748335779f, 0.158635736f},
-std::array<float,2>{0.489291102f, 0.0903537199f},
-std::array<float,2>{0.517951012f, 0.879048347f},
-std::array<float,2>{0.0901613981f, 0.54938674f},
-std::array<float,2>{0.859869778f, 0.410421908f},
-std::array<float,2>{0.215121225f, 0.0199456867f},
-std::array<float,2>{0.973207176f, 0.947164536f},
-std::array<float,2>{0.324271411f, 0.613048494f},
-std::array<float,2>{0.686757743f, 0.451221973f},
-std::array<float,2>{0.388338476f, 0.273786604f},
-std::array<float,2>{0.570334435f, 0.699667037f},
-std::array<float,2>{0.013723189f, 0.767619789f},
-std::array<float,2>{0.771287858f, 0.217264757f},
-std::array<float,2>{0.0997493342f, 0.40020895f},
-std::array<float,2>{0.821742415f, 0.508547425f},
-std::array<float,2>{0.460882634f, 0.933669329f},
-std::array<float,2>{0.539028108f, 0.123535924f},
-std::array<float,2>{0.265093803f, 0.131107762f},
-std::array<float,2>{0.688098431f, 0.820775688f},
-std::array<float,2>{0.141537011f, 0.683217466f},
-std::array<float,2>{0.932791531f, 0.333250731f},
-std::array<float,2>{0.130567878f, 0.184251964f},
-std::array<float,2>{0.909020007f, 0.860258281f},
-std::array<float,2>{0.269195467f, 0.649541497f},
-std::array<float,2>{0.705592573f, 0.369742662f},
-std::array<float,2>{0.439518809f, 0.429663301f},
-std::array<float,2>{0.54965812f, 0.533182383f},
-std::array<float,2>{0.113784537f, 0.904226005f},
-std::array<float,2>{0.831388593f, 0.0775004327f},
-std::array<float,2>{0.0182251483f, 0.281774312f},
-std::array<float,2>{0.762207508f, 0.746400595f},
-std::array<float,2>{0.39384225f, 0.80119276f},
-std::array<float,2>{0.586392105f, 0.240003422f},
-std::array<float,2>{0.333327323f, 0.0416687727f},
-std::array<float,2>{0.666074812f, 0.977841735f},
-std::array<float,2>{0.187934786f, 0.573867321f},
-std::array<float,2>{0.990007997f, 0.471322328f},
-std::array<float,2>{0.0628796592f, 0.108794212f},
-std::array<float,2>{0.850371778f, 0.909896135f},
-std::array<float,2>{0.474827617f, 0.523681581f},
-std::array<float,2>{0.510460794f, 0.383459717f},
-std::array<float,2>{0.311236799f, 0.321995616f},
-std::array<float,2>{0.722317457f, 0.66816783f},
-std::array<float,2>{0.174702585f, 0.832411587f},
-std::array<float,2>{0.882115543f, 0.141409576f},
-std::array<float,2>{0.224619135f, 0.465985328f},
-std::array<float,2>{0.961029172f, 0.59517312f},
-std::array<float,2>{0.364890993f, 0.96723932f},
-std::array<float,2>{0.652729094f, 0.0136699909f},
-std::array<float,2>{0.422763109f, 0.202245459f},
-std::array<float,2>{0.597929239f, 0.757611275f},
-std::array<float,2>{0.0403555073f, 0.703816414f},
-std::array<float,2>{0.790410221f, 0.251527458f}}
\ No newline at end of file
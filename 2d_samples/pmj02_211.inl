@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.246623144f, 0.522330582f},
-std::array<float,2>{0.716081321f, 0.24788025f},
-std::array<float,2>{0.827460468f, 0.773626864f},
-std::array<float,2>{0.255328f, 0.366287768f},
-std::array<float,2>{0.39995724f, 0.973798215f},
-std::array<float,2>{0.917856812f, 0.389622509f},
-std::array<float,2>{0.620854497f, 0.716489494f},
-std::array<float,2>{0.0340077281f, 0.0793195218f},
-std::array<float,2>{0.0922347233f, 0.825892329f},
-std::array<float,2>{0.558835626f, 0.286533803f},
-std::array<float,2>{0.994111538f, 0.589381218f},
-std::array<float,2>{0.477094561f, 0.167284116f},
-std::array<float,2>{0.37489748f, 0.664617717f},
-std::array<float,2>{0.784058332f, 0.04731635f},
-std::array<float,2>{0.681116223f, 0.927343488f},
-std::array<float,2>{0.162369102f, 0.466931969f},
-std::array<float,2>{0.0139541775f, 0.749803603f},
-std::array<float,2>{0.580731094f, 0.118565924f},
-std::array<float,2>{0.904709756f, 0.941075385f},
-std::array<float,2>{0.426364958f, 0.422737032f},
-std::array<float,2>{0.286697298f, 0.783573329f},
-std::array<float,2>{0.849933922f, 0.33728826f},
-std::array<float,2>{0.728019476f, 0.531960368f},
-std::array<float,2>{0.215558529f, 0.20752041f},
-std::array<float,2>{0.143068925f, 0.897018611f},
-std::array<float,2>{0.629023075f, 0.474686444f},
-std::array<float,2>{0.766003549f, 0.647515714f},
-std::array<float,2>{0.332318336f, 0.0138099482f},
-std::array<float,2>{0.462593585f, 0.6149261f},
-std::array<float,2>{0.963358462f, 0.144754916f},
-std::array<float,2>{0.529546082f, 0.858744204f},
-std::array<float,2>{0.108832888f, 0.253959298f},
-std::array<float,2>{0.186545715f, 0.631330073f},
-std::array<float,2>{0.669237494f, 0.0299116224f},
-std::array<float,2>{0.805355668f, 0.877286375f},
-std::array<float,2>{0.355855227f, 0.498762041f},
-std::array<float,2>{0.488891006f, 0.867872894f},
-std::array<float,2>{0.972857773f, 0.271514624f},
-std::array<float,2>{0.533104897f, 0.608725548f},
-std::array<float,2>{0.0656389147f, 0.130156592f},
-std::array<float,2>{0.056066718f, 0.956475556f},
-std::array<float,2>{0.597109854f, 0.407809734f},
-std::array<float,2>{0.931183398f, 0.724291801f},
-std::array<float,2>{0.3836734f, 0.0973819196f},
-std::array<float,2>{0.274970502f, 0.553557038f},
-std::array<float,2>{0.829593718f, 0.188511387f},
-std::array<float,2>{0.696704328f, 0.8007586f},
-std::array<float,2>{0.219292372f, 0.314250231f},
-std::array<float,2>{0.121649981f, 0.56601584f},
-std::array<float,2>{0.509272277f, 0.184490055f},
-std::array<float,2>{0.944551528f, 0.840507209f},
-std::array<float,2>{0.445127457f, 0.301698446f},
-std::array<float,2>{0.319245934f, 0.915746391f},
-std::array<float,2>{0.758791029f, 0.442436278f},
-std::array<float,2>{0.655054569f, 0.67277503f},
-std::array<float,2>{0.128438905f, 0.0317737274f},
-std::array<float,2>{0.196932763f, 0.752607763f},
-std::array<float,2>{0.744517148f, 0.347382575f},
-std::array<float,2>{0.863217294f, 0.501588225f},
-std::array<float,2>{0.306463301f, 0.23064582f},
-std::array<float,2>{0.414636075f, 0.693175137f},
-std::array<float,2>{0.884110868f, 0.0757655874f},
-std::array<float,2>{0.563168049f, 0.996502399f},
-std::array<float,2>{0.0199807566f, 0.396478087f},
-std::array<float,2>{0.137327224f, 0.597043514f},
-std::array<float,2>{0.64283967f, 0.13915357f},
-std::array<float,2>{0.754641116f, 0.866077602f},
-std::array<float,2>{0.325307488f, 0.274680316f},
-std::array<float,2>{0.451934874f, 0.890307665f},
-std::array<float,2>{0.95218128f, 0.489019036f},
-std::array<float,2>{0.506452739f, 0.63312012f},
-std::array<float,2>{0.112059027f, 0.0194779076f},
-std::array<float,2>{0.0292512421f, 0.805498898f},
-std::array<float,2>{0.573830366f, 0.324489683f},
-std::array<float,2>{0.875059485f, 0.559380114f},
-std::array<float,2>{0.409459144f, 0.196670428f},
-std::array<float,2>{0.301546216f, 0.726655424f},
-std::array<float,2>{0.868998885f, 0.105305396f},
-std::array<float,2>{0.740189552f, 0.961054504f},
-std::array<float,2>{0.191822886f, 0.416680753f},
-std::array<float,2>{0.072162576f, 0.682177424f},
-std::array<float,2>{0.539309382f, 0.0421314985f},
-std::array<float,2>{0.980485201f, 0.909079969f},
-std::array<float,2>{0.493647218f, 0.447478086f},
-std::array<float,2>{0.349263251f, 0.835854113f},
-std::array<float,2>{0.801845849f, 0.312199652f},
-std::array<float,2>{0.657149911f, 0.57733202f},
-std::array<float,2>{0.177512437f, 0.177900478f},
-std::array<float,2>{0.229387462f, 0.989737988f},
-std::array<float,2>{0.692958832f, 0.399931669f},
-std::array<float,2>{0.838896275f, 0.69944936f},
-std::array<float,2>{0.268723011f, 0.0644781888f},
-std::array<float,2>{0.377034158f, 0.510212421f},
-std::array<float,2>{0.929552138f, 0.226108521f},
-std::array<float,2>{0.607207f, 0.760414898f},
-std::array<float,2>{0.0475039817f, 0.351826251f},
-std::array<float,2>{0.2103623f, 0.703269601f},
-std::array<float,2>{0.721368253f, 0.0864207149f},
-std::array<float,2>{0.852360368f, 0.982872188f},
-std::array<float,2>{0.292838544f, 0.376698941f},
-std::array<float,2>{0.434310645f, 0.769143224f},
-std::array<float,2>{0.890646815f, 0.372848213f},
-std::array<float,2>{0.586111963f, 0.525957286f},
-std::array<float,2>{0.00558720622f, 0.238237455f},
-std::array<float,2>{0.0956741571f, 0.936472058f},
-std::array<float,2>{0.522027373f, 0.455290824f},
-std::array<float,2>{0.955077469f, 0.657626688f},
-std::array<float,2>{0.460276067f, 0.0559127145f},
-std::array<float,2>{0.340339482f, 0.579174519f},
-std::array<float,2>{0.780462623f, 0.159883782f},
-std::array<float,2>{0.638044417f, 0.818378747f},
-std::array<float,2>{0.156174213f, 0.290464878f},
-std::array<float,2>{0.0425850265f, 0.543981791f},
-std::array<float,2>{0.614046156f, 0.214118198f},
-std::array<float,2>{0.912095249f, 0.789285779f},
-std::array<float,2>{0.395201832f, 0.331816077f},
-std::array<float,2>{0.264078468f, 0.94868803f},
-std::array<float,2>{0.81538409f, 0.437302172f},
-std::array<float,2>{0.703754127f, 0.73848325f},
-std::array<float,2>{0.239864111f, 0.113873266f},
-std::array<float,2>{0.164837494f, 0.844676971f},
-std::array<float,2>{0.675951362f, 0.265197039f},
-std::array<float,2>{0.79179126f, 0.618662953f},
-std::array<float,2>{0.364875406f, 0.153051436f},
-std::array<float,2>{0.475211531f, 0.65105319f},
-std::array<float,2>{0.988448024f, 0.00615858473f},
-std::array<float,2>{0.550287783f, 0.903557718f},
-std::array<float,2>{0.0848134756f, 0.482052326f},
-std::array<float,2>{0.187571496f, 0.591713607f},
-std::array<float,2>{0.735130787f, 0.168836251f},
-std::array<float,2>{0.872258842f, 0.823271513f},
-std::array<float,2>{0.296891332f, 0.284870923f},
-std::array<float,2>{0.413154215f, 0.925231993f},
-std::array<float,2>{0.882219493f, 0.464096576f},
-std::array<float,2>{0.575991333f, 0.670460582f},
-std::array<float,2>{0.0262881219f, 0.0512019508f},
-std::array<float,2>{0.11360871f, 0.778704524f},
-std::array<float,2>{0.503871799f, 0.362864196f},
-std::array<float,2>{0.946974754f, 0.517511487f},
-std::array<float,2>{0.448474497f, 0.242291451f},
-std::array<float,2>{0.322307497f, 0.711398304f},
-std::array<float,2>{0.752852857f, 0.0856122151f},
-std::array<float,2>{0.645801723f, 0.969461143f},
-std::array<float,2>{0.133511975f, 0.384765595f},
-std::array<float,2>{0.051637046f, 0.643245041f},
-std::array<float,2>{0.604206264f, 0.011587007f},
-std::array<float,2>{0.922063172f, 0.892013133f},
-std::array<float,2>{0.38244763f, 0.472284555f},
-std::array<float,2>{0.270522118f, 0.852383316f},
-std::array<float,2>{0.840212166f, 0.250398338f},
-std::array<float,2>{0.688051283f, 0.612907588f},
-std::array<float,2>{0.230758682f, 0.142839104f},
-std::array<float,2>{0.174367204f, 0.942979991f},
-std::array<float,2>{0.663200557f, 0.428867906f},
-std::array<float,2>{0.800171494f, 0.743585348f},
-std::array<float,2>{0.34681794f, 0.123553514f},
-std::array<float,2>{0.496753991f, 0.535716236f},
-std::array<float,2>{0.979478121f, 0.203965917f},
-std::array<float,2>{0.5457533f, 0.787790179f},
-std::array<float,2>{0.0760313421f, 0.34175089f},
-std::array<float,2>{0.149788737f, 0.719361603f},
-std::array<float,2>{0.634648025f, 0.100188084f},
-std::array<float,2>{0.773680091f, 0.960226715f},
-std::array<float,2>{0.337773591f, 0.411678612f},
-std::array<float,2>{0.454682976f, 0.804403841f},
-std::array<float,2>{0.959949553f, 0.316417575f},
-std::array<float,2>{0.519069195f, 0.550284803f},
-std::array<float,2>{0.10106001f, 0.195262477f},
-std::array<float,2>{0.000981512247f, 0.879800498f},
-std::array<float,2>{0.592428565f, 0.493472844f},
-std::array<float,2>{0.897140086f, 0.625655413f},
-std::array<float,2>{0.431018323f, 0.0243822783f},
-std::array<float,2>{0.293827504f, 0.60241133f},
-std::array<float,2>{0.856006086f, 0.127557024f},
-std::array<float,2>{0.723115802f, 0.872945249f},
-std::array<float,2>{0.205363572f, 0.269502074f},
-std::array<float,2>{0.0790533423f, 0.507252514f},
-std::array<float,2>{0.554160833f, 0.227629676f},
-std::array<float,2>{0.98717761f, 0.754690111f},
-std::array<float,2>{0.47225517f, 0.350920737f},
-std::array<float,2>{0.360168964f, 0.9957605f},
-std::array<float,2>{0.79354161f, 0.392536908f},
-std::array<float,2>{0.674652219f, 0.690738022f},
-std::array<float,2>{0.170116857f, 0.0711576194f},
-std::array<float,2>{0.234552279f, 0.838477194f},
-std::array<float,2>{0.707064271f, 0.298434943f},
-std::array<float,2>{0.81722331f, 0.567449689f},
-std::array<float,2>{0.261196584f, 0.180964738f},
-std::array<float,2>{0.390803367f, 0.679288626f},
-std::array<float,2>{0.90772897f, 0.0356423371f},
-std::array<float,2>{0.61035794f, 0.919568479f},
-std::array<float,2>{0.0457600206f, 0.438553929f},
-std::array<float,2>{0.156912982f, 0.555013359f},
-std::array<float,2>{0.686466217f, 0.202838495f},
-std::array<float,2>{0.787172914f, 0.810973346f},
-std::array<float,2>{0.369146585f, 0.322931916f},
-std::array<float,2>{0.483169973f, 0.968539655f},
-std::array<float,2>{0.998823106f, 0.42159009f},
-std::array<float,2>{0.555846691f, 0.734059513f},
-std::array<float,2>{0.0866398439f, 0.106490597f},
-std::array<float,2>{0.0354968645f, 0.860820353f},
-std::array<float,2>{0.623991609f, 0.27985844f},
-std::array<float,2>{0.919328928f, 0.601458549f},
-std::array<float,2>{0.402613729f, 0.133045897f},
-std::array<float,2>{0.253172964f, 0.640532017f},
-std::array<float,2>{0.820934355f, 0.0224917382f},
-std::array<float,2>{0.714404881f, 0.886601567f},
-std::array<float,2>{0.24440819f, 0.484489441f},
-std::array<float,2>{0.10267289f, 0.6982373f},
-std::array<float,2>{0.523504555f, 0.0673722774f},
-std::array<float,2>{0.96644628f, 0.984536529f},
-std::array<float,2>{0.465370089f, 0.40260309f},
-std::array<float,2>{0.328574508f, 0.762344658f},
-std::array<float,2>{0.770528018f, 0.35772571f},
-std::array<float,2>{0.626994312f, 0.512644589f},
-std::array<float,2>{0.146102905f, 0.219602659f},
-std::array<float,2>{0.214112222f, 0.912892759f},
-std::array<float,2>{0.734218419f, 0.45141542f},
-std::array<float,2>{0.845935881f, 0.685772061f},
-std::array<float,2>{0.283243835f, 0.0459836908f},
-std::array<float,2>{0.423088312f, 0.570758879f},
-std::array<float,2>{0.901784778f, 0.174967051f},
-std::array<float,2>{0.58261466f, 0.829607189f},
-std::array<float,2>{0.00803120062f, 0.307492048f},
-std::array<float,2>{0.224804953f, 0.662775934f},
-std::array<float,2>{0.701737046f, 0.0600010753f},
-std::array<float,2>{0.833175719f, 0.933376849f},
-std::array<float,2>{0.28107667f, 0.457727671f},
-std::array<float,2>{0.389030159f, 0.814737976f},
-std::array<float,2>{0.935518265f, 0.293702751f},
-std::array<float,2>{0.599024832f, 0.585164487f},
-std::array<float,2>{0.0622348525f, 0.16267623f},
-std::array<float,2>{0.0679134429f, 0.978157759f},
-std::array<float,2>{0.535601854f, 0.379198432f},
-std::array<float,2>{0.971078098f, 0.708043039f},
-std::array<float,2>{0.485413641f, 0.0907533541f},
-std::array<float,2>{0.354759812f, 0.53069514f},
-std::array<float,2>{0.810624599f, 0.241645306f},
-std::array<float,2>{0.665325522f, 0.770895839f},
-std::array<float,2>{0.181928232f, 0.368906975f},
-std::array<float,2>{0.016986357f, 0.623449922f},
-std::array<float,2>{0.568622053f, 0.151861221f},
-std::array<float,2>{0.88867414f, 0.851009667f},
-std::array<float,2>{0.418252051f, 0.259328485f},
-std::array<float,2>{0.309272051f, 0.901297092f},
-std::array<float,2>{0.865450799f, 0.479190171f},
-std::array<float,2>{0.747205019f, 0.653834105f},
-std::array<float,2>{0.202220351f, 0.00130194926f},
-std::array<float,2>{0.132162735f, 0.793662071f},
-std::array<float,2>{0.651930094f, 0.334314734f},
-std::array<float,2>{0.764471292f, 0.539082944f},
-std::array<float,2>{0.315244526f, 0.218392998f},
-std::array<float,2>{0.439727277f, 0.734990478f},
-std::array<float,2>{0.938955903f, 0.110707268f},
-std::array<float,2>{0.515154481f, 0.950442433f},
-std::array<float,2>{0.12102972f, 0.432272971f},
-std::array<float,2>{0.217943892f, 0.534584343f},
-std::array<float,2>{0.729862809f, 0.21086809f},
-std::array<float,2>{0.847868562f, 0.781372845f},
-std::array<float,2>{0.287689269f, 0.338799894f},
-std::array<float,2>{0.428474605f, 0.939441502f},
-std::array<float,2>{0.903056324f, 0.425199151f},
-std::array<float,2>{0.579027772f, 0.747042894f},
-std::array<float,2>{0.0135614872f, 0.120952383f},
-std::array<float,2>{0.107304581f, 0.855870366f},
-std::array<float,2>{0.528912425f, 0.255975574f},
-std::array<float,2>{0.961410224f, 0.617018878f},
-std::array<float,2>{0.463528872f, 0.14776504f},
-std::array<float,2>{0.334841609f, 0.646286488f},
-std::array<float,2>{0.768555582f, 0.0136700375f},
-std::array<float,2>{0.630984962f, 0.895882726f},
-std::array<float,2>{0.14232941f, 0.474166185f},
-std::array<float,2>{0.03197629f, 0.717973173f},
-std::array<float,2>{0.618411839f, 0.0817131996f},
-std::array<float,2>{0.914970338f, 0.975370526f},
-std::array<float,2>{0.400981635f, 0.387182325f},
-std::array<float,2>{0.257739097f, 0.776487172f},
-std::array<float,2>{0.826044858f, 0.36430198f},
-std::array<float,2>{0.716821969f, 0.521451831f},
-std::array<float,2>{0.248281077f, 0.249167651f},
-std::array<float,2>{0.161926925f, 0.928016663f},
-std::array<float,2>{0.682183743f, 0.466382533f},
-std::array<float,2>{0.782652378f, 0.667875469f},
-std::array<float,2>{0.372926503f, 0.0503592789f},
-std::array<float,2>{0.48039031f, 0.585976243f},
-std::array<float,2>{0.994170487f, 0.165001422f},
-std::array<float,2>{0.561627686f, 0.826508403f},
-std::array<float,2>{0.091228269f, 0.287405699f},
-std::array<float,2>{0.126677379f, 0.67414403f},
-std::array<float,2>{0.652808607f, 0.0349367075f},
-std::array<float,2>{0.760339439f, 0.917468488f},
-std::array<float,2>{0.31757006f, 0.443823963f},
-std::array<float,2>{0.442807049f, 0.842095792f},
-std::array<float,2>{0.942436159f, 0.304021955f},
-std::array<float,2>{0.510050416f, 0.563871562f},
-std::array<float,2>{0.124725059f, 0.186073929f},
-std::array<float,2>{0.0217260513f, 0.999895215f},
-std::array<float,2>{0.565075517f, 0.397224516f},
-std::array<float,2>{0.885166287f, 0.694584668f},
-std::array<float,2>{0.417959273f, 0.0774289593f},
-std::array<float,2>{0.307144493f, 0.503011763f},
-std::array<float,2>{0.859852672f, 0.232586995f},
-std::array<float,2>{0.74305433f, 0.7514925f},
-std::array<float,2>{0.199124753f, 0.344260216f},
-std::array<float,2>{0.0641775504f, 0.605765164f},
-std::array<float,2>{0.534858763f, 0.132341102f},
-std::array<float,2>{0.974983454f, 0.869611681f},
-std::array<float,2>{0.49200505f, 0.270159811f},
-std::array<float,2>{0.35770905f, 0.876930773f},
-std::array<float,2>{0.806855261f, 0.497613966f},
-std::array<float,2>{0.671316564f, 0.628933489f},
-std::array<float,2>{0.184239522f, 0.0281505585f},
-std::array<float,2>{0.222171798f, 0.797555089f},
-std::array<float,2>{0.697865903f, 0.315184891f},
-std::array<float,2>{0.831555545f, 0.552634418f},
-std::array<float,2>{0.275522292f, 0.191314653f},
-std::array<float,2>{0.386433721f, 0.724865913f},
-std::array<float,2>{0.933072567f, 0.0948429182f},
-std::array<float,2>{0.595224977f, 0.95362848f},
-std::array<float,2>{0.0579966307f, 0.409414262f},
-std::array<float,2>{0.178752303f, 0.575407743f},
-std::array<float,2>{0.659084558f, 0.177289248f},
-std::array<float,2>{0.804226756f, 0.833074808f},
-std::array<float,2>{0.350126266f, 0.309861094f},
-std::array<float,2>{0.495446473f, 0.906275511f},
-std::array<float,2>{0.98285383f, 0.446944416f},
-std::array<float,2>{0.542890847f, 0.679705203f},
-std::array<float,2>{0.0737097189f, 0.0409687981f},
-std::array<float,2>{0.0500114039f, 0.759674013f},
-std::array<float,2>{0.6089468f, 0.353977591f},
-std::array<float,2>{0.926770508f, 0.508329749f},
-std::array<float,2>{0.375006229f, 0.222903863f},
-std::array<float,2>{0.266491026f, 0.702810287f},
-std::array<float,2>{0.837005913f, 0.0629323199f},
-std::array<float,2>{0.69385463f, 0.990982056f},
-std::array<float,2>{0.227998167f, 0.401246846f},
-std::array<float,2>{0.111271955f, 0.634798408f},
-std::array<float,2>{0.504165709f, 0.0165193696f},
-std::array<float,2>{0.950498044f, 0.887751758f},
-std::array<float,2>{0.450001121f, 0.492112577f},
-std::array<float,2>{0.326362759f, 0.864257753f},
-std::array<float,2>{0.757550597f, 0.277227938f},
-std::array<float,2>{0.6406371f, 0.595108986f},
-std::array<float,2>{0.139568135f, 0.138352245f},
-std::array<float,2>{0.194109425f, 0.963939428f},
-std::array<float,2>{0.741810024f, 0.415983826f},
-std::array<float,2>{0.869410515f, 0.728627622f},
-std::array<float,2>{0.304493904f, 0.102922909f},
-std::array<float,2>{0.407137096f, 0.561700046f},
-std::array<float,2>{0.877409577f, 0.197385028f},
-std::array<float,2>{0.570570469f, 0.807302177f},
-std::array<float,2>{0.0301797427f, 0.327621996f},
-std::array<float,2>{0.240466326f, 0.740714252f},
-std::array<float,2>{0.70550853f, 0.115828007f},
-std::array<float,2>{0.812833965f, 0.946896791f},
-std::array<float,2>{0.263368011f, 0.4354029f},
-std::array<float,2>{0.398242682f, 0.792227983f},
-std::array<float,2>{0.912429988f, 0.328200549f},
-std::array<float,2>{0.615952909f, 0.545249581f},
-std::array<float,2>{0.0400127806f, 0.212366551f},
-std::array<float,2>{0.0830630511f, 0.905698299f},
-std::array<float,2>{0.547823548f, 0.483153433f},
-std::array<float,2>{0.990583003f, 0.648686707f},
-std::array<float,2>{0.474127412f, 0.00473348284f},
-std::array<float,2>{0.366825223f, 0.620565832f},
-std::array<float,2>{0.790040672f, 0.155327171f},
-std::array<float,2>{0.679368973f, 0.846177459f},
-std::array<float,2>{0.167697892f, 0.262484699f},
-std::array<float,2>{0.00595749076f, 0.524028003f},
-std::array<float,2>{0.588089943f, 0.234634891f},
-std::array<float,2>{0.893613815f, 0.766307473f},
-std::array<float,2>{0.435758442f, 0.374169886f},
-std::array<float,2>{0.289567471f, 0.981967866f},
-std::array<float,2>{0.855013072f, 0.378252447f},
-std::array<float,2>{0.718948543f, 0.705165565f},
-std::array<float,2>{0.208937794f, 0.0893877968f},
-std::array<float,2>{0.152709678f, 0.818010211f},
-std::array<float,2>{0.640248418f, 0.291490257f},
-std::array<float,2>{0.778749704f, 0.580528319f},
-std::array<float,2>{0.343052328f, 0.157006815f},
-std::array<float,2>{0.458089292f, 0.658743262f},
-std::array<float,2>{0.95643574f, 0.0569894239f},
-std::array<float,2>{0.520743549f, 0.934084237f},
-std::array<float,2>{0.0965676084f, 0.454356849f},
-std::array<float,2>{0.232717931f, 0.611022472f},
-std::array<float,2>{0.690696299f, 0.141819045f},
-std::array<float,2>{0.842411995f, 0.85443449f},
-std::array<float,2>{0.272995532f, 0.252011716f},
-std::array<float,2>{0.380128652f, 0.893582821f},
-std::array<float,2>{0.924109697f, 0.470256925f},
-std::array<float,2>{0.601911664f, 0.640650272f},
-std::array<float,2>{0.0531061813f, 0.00960514508f},
-std::array<float,2>{0.0777706057f, 0.786376715f},
-std::array<float,2>{0.544651508f, 0.342227846f},
-std::array<float,2>{0.976848543f, 0.537937641f},
-std::array<float,2>{0.499918193f, 0.20679763f},
-std::array<float,2>{0.344124466f, 0.745590746f},
-std::array<float,2>{0.798308551f, 0.121552885f},
-std::array<float,2>{0.661957383f, 0.944922209f},
-std::array<float,2>{0.173361599f, 0.426900685f},
-std::array<float,2>{0.0253895074f, 0.66833663f},
-std::array<float,2>{0.577537894f, 0.0541771352f},
-std::array<float,2>{0.879953086f, 0.922313452f},
-std::array<float,2>{0.410604239f, 0.461908072f},
-std::array<float,2>{0.300458997f, 0.82047379f},
-std::array<float,2>{0.873253644f, 0.281904191f},
-std::array<float,2>{0.738158643f, 0.591821849f},
-std::array<float,2>{0.189487696f, 0.170038447f},
-std::array<float,2>{0.135629997f, 0.971489251f},
-std::array<float,2>{0.646903574f, 0.385047793f},
-std::array<float,2>{0.751569271f, 0.712966323f},
-std::array<float,2>{0.322107911f, 0.0836147964f},
-std::array<float,2>{0.445862561f, 0.51758337f},
-std::array<float,2>{0.948705673f, 0.245410189f},
-std::array<float,2>{0.500555873f, 0.780647635f},
-std::array<float,2>{0.116022922f, 0.360187769f},
-std::array<float,2>{0.169249818f, 0.687974691f},
-std::array<float,2>{0.673443139f, 0.0726692379f},
-std::array<float,2>{0.79536128f, 0.992918789f},
-std::array<float,2>{0.362058908f, 0.392882347f},
-std::array<float,2>{0.470667601f, 0.757569015f},
-std::array<float,2>{0.985162735f, 0.349565327f},
-std::array<float,2>{0.551377416f, 0.504054248f},
-std::array<float,2>{0.0814310908f, 0.229476497f},
-std::array<float,2>{0.0439609885f, 0.921241105f},
-std::array<float,2>{0.612638593f, 0.440536559f},
-std::array<float,2>{0.909664512f, 0.676856518f},
-std::array<float,2>{0.394325912f, 0.0376277827f},
-std::array<float,2>{0.259160846f, 0.568909228f},
-std::array<float,2>{0.818955719f, 0.182776958f},
-std::array<float,2>{0.709189057f, 0.837366581f},
-std::array<float,2>{0.236583143f, 0.299708933f},
-std::array<float,2>{0.0995345935f, 0.548481226f},
-std::array<float,2>{0.517215908f, 0.191552252f},
-std::array<float,2>{0.957630396f, 0.802089274f},
-std::array<float,2>{0.455354095f, 0.320151269f},
-std::array<float,2>{0.338829368f, 0.957923889f},
-std::array<float,2>{0.777252436f, 0.412642062f},
-std::array<float,2>{0.635218382f, 0.722052872f},
-std::array<float,2>{0.151904076f, 0.0977989063f},
-std::array<float,2>{0.204293579f, 0.873892128f},
-std::array<float,2>{0.725489497f, 0.265791357f},
-std::array<float,2>{0.858873725f, 0.604811132f},
-std::array<float,2>{0.296609014f, 0.126148522f},
-std::array<float,2>{0.432940513f, 0.628450274f},
-std::array<float,2>{0.895321667f, 0.0255338121f},
-std::array<float,2>{0.58987689f, 0.881321788f},
-std::array<float,2>{0.00351288076f, 0.495216131f},
-std::array<float,2>{0.14830409f, 0.515479207f},
-std::array<float,2>{0.626467824f, 0.221926555f},
-std::array<float,2>{0.773234665f, 0.764838159f},
-std::array<float,2>{0.330242842f, 0.356284052f},
-std::array<float,2>{0.466819823f, 0.987416148f},
-std::array<float,2>{0.967014551f, 0.404626817f},
-std::array<float,2>{0.525987685f, 0.696859598f},
-std::array<float,2>{0.105208017f, 0.0690348595f},
-std::array<float,2>{0.0108547052f, 0.83118993f},
-std::array<float,2>{0.584369063f, 0.306126565f},
-std::array<float,2>{0.898811936f, 0.572965503f},
-std::array<float,2>{0.424656093f, 0.173389345f},
-std::array<float,2>{0.282636255f, 0.684246123f},
-std::array<float,2>{0.8456043f, 0.0435757786f},
-std::array<float,2>{0.730587542f, 0.912097156f},
-std::array<float,2>{0.211668819f, 0.450414836f},
-std::array<float,2>{0.0880572423f, 0.730652332f},
-std::array<float,2>{0.556785464f, 0.10829819f},
-std::array<float,2>{0.996560931f, 0.965435624f},
-std::array<float,2>{0.482076764f, 0.419086009f},
-std::array<float,2>{0.368163526f, 0.809514284f},
-std::array<float,2>{0.785811126f, 0.321332306f},
-std::array<float,2>{0.68439585f, 0.556891263f},
-std::array<float,2>{0.160131961f, 0.199550971f},
-std::array<float,2>{0.243936807f, 0.883388996f},
-std::array<float,2>{0.71144551f, 0.486627698f},
-std::array<float,2>{0.82237345f, 0.638292789f},
-std::array<float,2>{0.251341879f, 0.0204663835f},
-std::array<float,2>{0.405803174f, 0.598944128f},
-std::array<float,2>{0.920744181f, 0.13478522f},
-std::array<float,2>{0.621500432f, 0.861521363f},
-std::array<float,2>{0.0380850397f, 0.27844736f},
-std::array<float,2>{0.200685591f, 0.655228317f},
-std::array<float,2>{0.748963177f, 0.00376302889f},
-std::array<float,2>{0.865205526f, 0.899103403f},
-std::array<float,2>{0.311546981f, 0.476782233f},
-std::array<float,2>{0.420434743f, 0.848689318f},
-std::array<float,2>{0.888266265f, 0.2614896f},
-std::array<float,2>{0.568134546f, 0.622876287f},
-std::array<float,2>{0.0182414167f, 0.149796784f},
-std::array<float,2>{0.118910365f, 0.951754868f},
-std::array<float,2>{0.511970282f, 0.430083394f},
-std::array<float,2>{0.939525187f, 0.738156319f},
-std::array<float,2>{0.437684774f, 0.113206908f},
-std::array<float,2>{0.312552422f, 0.542081475f},
-std::array<float,2>{0.76323843f, 0.214905798f},
-std::array<float,2>{0.649054706f, 0.79660356f},
-std::array<float,2>{0.130348802f, 0.332120091f},
-std::array<float,2>{0.059544988f, 0.583318532f},
-std::array<float,2>{0.600290895f, 0.161475703f},
-std::array<float,2>{0.935770094f, 0.812577486f},
-std::array<float,2>{0.388505012f, 0.296046525f},
-std::array<float,2>{0.278467625f, 0.931437671f},
-std::array<float,2>{0.835157156f, 0.459004045f},
-std::array<float,2>{0.700481117f, 0.660955727f},
-std::array<float,2>{0.223280028f, 0.0618386827f},
-std::array<float,2>{0.180793568f, 0.771794498f},
-std::array<float,2>{0.666839063f, 0.370472461f},
-std::array<float,2>{0.810051739f, 0.529001296f},
-std::array<float,2>{0.353140205f, 0.238571122f},
-std::array<float,2>{0.48657003f, 0.709530413f},
-std::array<float,2>{0.96984601f, 0.092238456f},
-std::array<float,2>{0.538417339f, 0.979317427f},
-std::array<float,2>{0.0692401454f, 0.381101072f},
-std::array<float,2>{0.1977088f, 0.500538468f},
-std::array<float,2>{0.743583083f, 0.232276186f},
-std::array<float,2>{0.861153305f, 0.753713667f},
-std::array<float,2>{0.308431417f, 0.346302837f},
-std::array<float,2>{0.416441768f, 0.99756521f},
-std::array<float,2>{0.886002779f, 0.394794017f},
-std::array<float,2>{0.565757871f, 0.691760778f},
-std::array<float,2>{0.0227765981f, 0.0743714571f},
-std::array<float,2>{0.123904355f, 0.841644824f},
-std::array<float,2>{0.511654615f, 0.30232507f},
-std::array<float,2>{0.941837311f, 0.56445688f},
-std::array<float,2>{0.441420466f, 0.185286909f},
-std::array<float,2>{0.316853583f, 0.673464715f},
-std::array<float,2>{0.760967314f, 0.0323906876f},
-std::array<float,2>{0.653857708f, 0.914130688f},
-std::array<float,2>{0.125061661f, 0.44231692f},
-std::array<float,2>{0.0575059839f, 0.723192513f},
-std::array<float,2>{0.594209373f, 0.0965885296f},
-std::array<float,2>{0.93227309f, 0.955921113f},
-std::array<float,2>{0.385187656f, 0.40658024f},
-std::array<float,2>{0.27703169f, 0.799111128f},
-std::array<float,2>{0.831038773f, 0.313048422f},
-std::array<float,2>{0.698753357f, 0.553945839f},
-std::array<float,2>{0.221283466f, 0.18819575f},
-std::array<float,2>{0.184605777f, 0.878691554f},
-std::array<float,2>{0.669966817f, 0.499539226f},
-std::array<float,2>{0.807759762f, 0.632267416f},
-std::array<float,2>{0.358868062f, 0.0304936208f},
-std::array<float,2>{0.490287453f, 0.607528806f},
-std::array<float,2>{0.976117551f, 0.129109368f},
-std::array<float,2>{0.533615768f, 0.869045436f},
-std::array<float,2>{0.0631123856f, 0.273205072f},
-std::array<float,2>{0.140965879f, 0.647297144f},
-std::array<float,2>{0.632308602f, 0.0154434107f},
-std::array<float,2>{0.768327177f, 0.897729874f},
-std::array<float,2>{0.33502093f, 0.476044834f},
-std::array<float,2>{0.463918328f, 0.857507169f},
-std::array<float,2>{0.962507129f, 0.25530386f},
-std::array<float,2>{0.527382016f, 0.613944232f},
-std::array<float,2>{0.105805553f, 0.146465629f},
-std::array<float,2>{0.0126613555f, 0.939729929f},
-std::array<float,2>{0.579565704f, 0.423338264f},
-std::array<float,2>{0.904212117f, 0.748581707f},
-std::array<float,2>{0.428888351f, 0.117443912f},
-std::array<float,2>{0.289023697f, 0.533035159f},
-std::array<float,2>{0.849101901f, 0.20804067f},
-std::array<float,2>{0.729248643f, 0.785056651f},
-std::array<float,2>{0.21683456f, 0.3366431f},
-std::array<float,2>{0.0898875222f, 0.588028908f},
-std::array<float,2>{0.561479151f, 0.166273952f},
-std::array<float,2>{0.995427012f, 0.824267328f},
-std::array<float,2>{0.478788733f, 0.285176814f},
-std::array<float,2>{0.371219963f, 0.92612648f},
-std::array<float,2>{0.78141135f, 0.467857122f},
-std::array<float,2>{0.682943463f, 0.665680885f},
-std::array<float,2>{0.161106423f, 0.048768796f},
-std::array<float,2>{0.249149501f, 0.77493906f},
-std::array<float,2>{0.717776895f, 0.365397692f},
-std::array<float,2>{0.82441026f, 0.522470534f},
-std::array<float,2>{0.256578326f, 0.246804059f},
-std::array<float,2>{0.401564121f, 0.715394974f},
-std::array<float,2>{0.915493488f, 0.0781268328f},
-std::array<float,2>{0.617531657f, 0.973238766f},
-std::array<float,2>{0.0326987766f, 0.390428007f},
-std::array<float,2>{0.166081354f, 0.61769706f},
-std::array<float,2>{0.678046882f, 0.153513581f},
-std::array<float,2>{0.789533257f, 0.845381618f},
-std::array<float,2>{0.365989089f, 0.264411002f},
-std::array<float,2>{0.473510295f, 0.902443051f},
-std::array<float,2>{0.991579413f, 0.480967849f},
-std::array<float,2>{0.548028886f, 0.651719093f},
-std::array<float,2>{0.082848832f, 0.00727932202f},
-std::array<float,2>{0.0406564772f, 0.790103197f},
-std::array<float,2>{0.616736352f, 0.330414593f},
-std::array<float,2>{0.913232267f, 0.543869674f},
-std::array<float,2>{0.397317141f, 0.213398844f},
-std::array<float,2>{0.261726975f, 0.739494264f},
-std::array<float,2>{0.813668072f, 0.115218066f},
-std::array<float,2>{0.706797838f, 0.947612107f},
-std::array<float,2>{0.241412103f, 0.435680449f},
-std::array<float,2>{0.0969052017f, 0.656560063f},
-std::array<float,2>{0.520455301f, 0.0550551899f},
-std::array<float,2>{0.955821991f, 0.937183022f},
-std::array<float,2>{0.457139045f, 0.456983417f},
-std::array<float,2>{0.342420071f, 0.819904566f},
-std::array<float,2>{0.778155088f, 0.289301485f},
-std::array<float,2>{0.639155924f, 0.579075933f},
-std::array<float,2>{0.153878719f, 0.158283323f},
-std::array<float,2>{0.207126081f, 0.9838925f},
-std::array<float,2>{0.720562041f, 0.375569344f},
-std::array<float,2>{0.853557527f, 0.704470634f},
-std::array<float,2>{0.290872246f, 0.0878636092f},
-std::array<float,2>{0.437206179f, 0.52719003f},
-std::array<float,2>{0.892938018f, 0.236383587f},
-std::array<float,2>{0.589497387f, 0.767797053f},
-std::array<float,2>{0.00761641329f, 0.371991843f},
-std::array<float,2>{0.227064595f, 0.700512946f},
-std::array<float,2>{0.695221484f, 0.0659354031f},
-std::array<float,2>{0.836182058f, 0.989161193f},
-std::array<float,2>{0.267456234f, 0.399019033f},
-std::array<float,2>{0.376499146f, 0.761419117f},
-std::array<float,2>{0.926723182f, 0.353261769f},
-std::array<float,2>{0.60754168f, 0.510747492f},
-std::array<float,2>{0.0490023717f, 0.225201681f},
-std::array<float,2>{0.0725709051f, 0.90951705f},
-std::array<float,2>{0.541053236f, 0.448800355f},
-std::array<float,2>{0.983459711f, 0.683323324f},
-std::array<float,2>{0.494331479f, 0.0418321863f},
-std::array<float,2>{0.350792825f, 0.576480389f},
-std::array<float,2>{0.80323416f, 0.178966612f},
-std::array<float,2>{0.659747958f, 0.83449167f},
-std::array<float,2>{0.178055674f, 0.311119616f},
-std::array<float,2>{0.0310152154f, 0.560288489f},
-std::array<float,2>{0.571369946f, 0.195371598f},
-std::array<float,2>{0.878355384f, 0.806603372f},
-std::array<float,2>{0.407882273f, 0.325385779f},
-std::array<float,2>{0.303266883f, 0.962700427f},
-std::array<float,2>{0.870594561f, 0.417470664f},
-std::array<float,2>{0.740295768f, 0.72779119f},
-std::array<float,2>{0.194476753f, 0.103694968f},
-std::array<float,2>{0.139823094f, 0.86634922f},
-std::array<float,2>{0.642102659f, 0.274097025f},
-std::array<float,2>{0.756427526f, 0.596405625f},
-std::array<float,2>{0.327353179f, 0.139825135f},
-std::array<float,2>{0.451153398f, 0.634083867f},
-std::array<float,2>{0.950003982f, 0.0181180853f},
-std::array<float,2>{0.505359769f, 0.889369607f},
-std::array<float,2>{0.110287368f, 0.489787579f},
-std::array<float,2>{0.237316802f, 0.566715717f},
-std::array<float,2>{0.710670888f, 0.179993823f},
-std::array<float,2>{0.819432795f, 0.839246511f},
-std::array<float,2>{0.258203775f, 0.296888053f},
-std::array<float,2>{0.392796546f, 0.918914139f},
-std::array<float,2>{0.908393204f, 0.437532604f},
-std::array<float,2>{0.612030208f, 0.678600669f},
-std::array<float,2>{0.0433462299f, 0.0367252752f},
-std::array<float,2>{0.0804351717f, 0.755780697f},
-std::array<float,2>{0.551909387f, 0.350405782f},
-std::array<float,2>{0.985953212f, 0.506583631f},
-std::array<float,2>{0.468956083f, 0.226843461f},
-std::array<float,2>{0.362485588f, 0.690289795f},
-std::array<float,2>{0.796466112f, 0.0722416639f},
-std::array<float,2>{0.672828257f, 0.994371235f},
-std::array<float,2>{0.168743193f, 0.390828043f},
-std::array<float,2>{0.00261099078f, 0.626147151f},
-std::array<float,2>{0.591416657f, 0.0249433666f},
-std::array<float,2>{0.895804703f, 0.880151868f},
-std::array<float,2>{0.432352781f, 0.492835015f},
-std::array<float,2>{0.295844227f, 0.87127161f},
-std::array<float,2>{0.85754621f, 0.267654926f},
-std::array<float,2>{0.72642529f, 0.60309422f},
-std::array<float,2>{0.20391877f, 0.128301471f},
-std::array<float,2>{0.151359349f, 0.959436476f},
-std::array<float,2>{0.636026204f, 0.410887957f},
-std::array<float,2>{0.775844753f, 0.719752491f},
-std::array<float,2>{0.338987231f, 0.101126388f},
-std::array<float,2>{0.456687331f, 0.549257934f},
-std::array<float,2>{0.958289087f, 0.194186822f},
-std::array<float,2>{0.51614219f, 0.802937627f},
-std::array<float,2>{0.0979828015f, 0.318083912f},
-std::array<float,2>{0.172210708f, 0.742917597f},
-std::array<float,2>{0.660836041f, 0.124886572f},
-std::array<float,2>{0.797145247f, 0.942011476f},
-std::array<float,2>{0.345356941f, 0.428637654f},
-std::array<float,2>{0.498172194f, 0.78900975f},
-std::array<float,2>{0.97795105f, 0.34069401f},
-std::array<float,2>{0.543763518f, 0.536685526f},
-std::array<float,2>{0.0767755136f, 0.204435259f},
-std::array<float,2>{0.0538401008f, 0.891310036f},
-std::array<float,2>{0.603074908f, 0.470920563f},
-std::array<float,2>{0.925392747f, 0.643917441f},
-std::array<float,2>{0.379716247f, 0.0101352828f},
-std::array<float,2>{0.2723355f, 0.611971438f},
-std::array<float,2>{0.843001246f, 0.143947631f},
-std::array<float,2>{0.689453363f, 0.853007078f},
-std::array<float,2>{0.233846724f, 0.251004815f},
-std::array<float,2>{0.116404682f, 0.515960872f},
-std::array<float,2>{0.501034498f, 0.243866906f},
-std::array<float,2>{0.947558045f, 0.777875602f},
-std::array<float,2>{0.446471781f, 0.362164915f},
-std::array<float,2>{0.320609272f, 0.96986711f},
-std::array<float,2>{0.750011861f, 0.38320902f},
-std::array<float,2>{0.648246467f, 0.712439179f},
-std::array<float,2>{0.136088565f, 0.08448302f},
-std::array<float,2>{0.190798998f, 0.822429895f},
-std::array<float,2>{0.737133026f, 0.283245146f},
-std::array<float,2>{0.87473613f, 0.590100765f},
-std::array<float,2>{0.299773335f, 0.169688731f},
-std::array<float,2>{0.411172301f, 0.671866834f},
-std::array<float,2>{0.878977597f, 0.0519232899f},
-std::array<float,2>{0.576781154f, 0.92405504f},
-std::array<float,2>{0.0236530732f, 0.463245213f},
-std::array<float,2>{0.128999934f, 0.540982842f},
-std::array<float,2>{0.650005817f, 0.217535287f},
-std::array<float,2>{0.76205349f, 0.794107616f},
-std::array<float,2>{0.314253241f, 0.335553855f},
-std::array<float,2>{0.439182281f, 0.949688733f},
-std::array<float,2>{0.940545022f, 0.433111608f},
-std::array<float,2>{0.513472557f, 0.735496044f},
-std::array<float,2>{0.117934301f, 0.109814405f},
-std::array<float,2>{0.019232206f, 0.849629045f},
-std::array<float,2>{0.567193687f, 0.258157164f},
-std::array<float,2>{0.887093365f, 0.624818385f},
-std::array<float,2>{0.421602339f, 0.150855094f},
-std::array<float,2>{0.311114192f, 0.652669311f},
-std::array<float,2>{0.863941431f, 9.93706417e-05f},
-std::array<float,2>{0.749444485f, 0.902119756f},
-std::array<float,2>{0.199396282f, 0.479634315f},
-std::array<float,2>{0.0701478347f, 0.707980394f},
-std::array<float,2>{0.53807652f, 0.0912099779f},
-std::array<float,2>{0.969372094f, 0.977379978f},
-std::array<float,2>{0.487657547f, 0.380363435f},
-std::array<float,2>{0.352162272f, 0.769807816f},
-std::array<float,2>{0.809011996f, 0.36779654f},
-std::array<float,2>{0.667445898f, 0.530245662f},
-std::array<float,2>{0.179978251f, 0.240338132f},
-std::array<float,2>{0.224468261f, 0.93224889f},
-std::array<float,2>{0.699658871f, 0.458499581f},
-std::array<float,2>{0.834693432f, 0.66370374f},
-std::array<float,2>{0.277733624f, 0.059111882f},
-std::array<float,2>{0.386862129f, 0.58461833f},
-std::array<float,2>{0.93657434f, 0.163265258f},
-std::array<float,2>{0.600820899f, 0.816117764f},
-std::array<float,2>{0.0603012629f, 0.294889927f},
-std::array<float,2>{0.212537989f, 0.686897576f},
-std::array<float,2>{0.732052505f, 0.0453625694f},
-std::array<float,2>{0.844292402f, 0.913437724f},
-std::array<float,2>{0.281774938f, 0.4522627f},
-std::array<float,2>{0.42488727f, 0.829000354f},
-std::array<float,2>{0.899606884f, 0.307964772f},
-std::array<float,2>{0.585270405f, 0.572007179f},
-std::array<float,2>{0.00996526796f, 0.174470022f},
-std::array<float,2>{0.103904799f, 0.986253262f},
-std::array<float,2>{0.527286708f, 0.403349042f},
-std::array<float,2>{0.968161225f, 0.698675156f},
-std::array<float,2>{0.468396246f, 0.0681972876f},
-std::array<float,2>{0.331531823f, 0.513076007f},
-std::array<float,2>{0.771981776f, 0.220243797f},
-std::array<float,2>{0.625550568f, 0.763277173f},
-std::array<float,2>{0.146826133f, 0.359000504f},
-std::array<float,2>{0.0390356332f, 0.599841237f},
-std::array<float,2>{0.622282147f, 0.134110391f},
-std::array<float,2>{0.921522498f, 0.8595469f},
-std::array<float,2>{0.40516609f, 0.280567646f},
-std::array<float,2>{0.250008732f, 0.885661602f},
-std::array<float,2>{0.82382828f, 0.485384464f},
-std::array<float,2>{0.712255836f, 0.638861835f},
-std::array<float,2>{0.242936626f, 0.022089351f},
-std::array<float,2>{0.158615068f, 0.812320709f},
-std::array<float,2>{0.68533504f, 0.324054629f},
-std::array<float,2>{0.78704685f, 0.55620873f},
-std::array<float,2>{0.368190974f, 0.201627001f},
-std::array<float,2>{0.480846763f, 0.732658803f},
-std::array<float,2>{0.997931659f, 0.106011495f},
-std::array<float,2>{0.558205068f, 0.966917753f},
-std::array<float,2>{0.0893760622f, 0.420405507f},
-std::array<float,2>{0.220641449f, 0.550898492f},
-std::array<float,2>{0.695968628f, 0.190329567f},
-std::array<float,2>{0.828572035f, 0.798702359f},
-std::array<float,2>{0.273520589f, 0.31549564f},
-std::array<float,2>{0.384676725f, 0.955015123f},
-std::array<float,2>{0.93044436f, 0.408356398f},
-std::array<float,2>{0.596416175f, 0.725860715f},
-std::array<float,2>{0.0555560216f, 0.0942998007f},
-std::array<float,2>{0.0653170571f, 0.870700717f},
-std::array<float,2>{0.531908095f, 0.270959556f},
-std::array<float,2>{0.973805964f, 0.60728693f},
-std::array<float,2>{0.489810467f, 0.131338641f},
-std::array<float,2>{0.357367098f, 0.630708992f},
-std::array<float,2>{0.806215346f, 0.0290368889f},
-std::array<float,2>{0.667988539f, 0.875872433f},
-std::array<float,2>{0.18622838f, 0.497057855f},
-std::array<float,2>{0.0209846273f, 0.69358629f},
-std::array<float,2>{0.564317465f, 0.0763348639f},
-std::array<float,2>{0.883445323f, 0.998595238f},
-std::array<float,2>{0.415918976f, 0.397733897f},
-std::array<float,2>{0.305282772f, 0.750705481f},
-std::array<float,2>{0.861371934f, 0.345514715f},
-std::array<float,2>{0.745936871f, 0.502066135f},
-std::array<float,2>{0.195367828f, 0.233540103f},
-std::array<float,2>{0.127003461f, 0.916137099f},
-std::array<float,2>{0.65582633f, 0.445189953f},
-std::array<float,2>{0.758284509f, 0.675067365f},
-std::array<float,2>{0.319872946f, 0.034120705f},
-std::array<float,2>{0.4437837f, 0.562592685f},
-std::array<float,2>{0.944218099f, 0.186566278f},
-std::array<float,2>{0.507888675f, 0.843571067f},
-std::array<float,2>{0.123043075f, 0.302758396f},
-std::array<float,2>{0.16327928f, 0.666106224f},
-std::array<float,2>{0.679802835f, 0.0491350852f},
-std::array<float,2>{0.784330249f, 0.929484725f},
-std::array<float,2>{0.373814583f, 0.465751946f},
-std::array<float,2>{0.478443891f, 0.827406287f},
-std::array<float,2>{0.992624879f, 0.288827986f},
-std::array<float,2>{0.56005466f, 0.587280452f},
-std::array<float,2>{0.0928002223f, 0.165965378f},
-std::array<float,2>{0.0350160226f, 0.976328552f},
-std::array<float,2>{0.619207323f, 0.387860328f},
-std::array<float,2>{0.916634977f, 0.717376411f},
-std::array<float,2>{0.398808718f, 0.0806454718f},
-std::array<float,2>{0.254595757f, 0.520482719f},
-std::array<float,2>{0.82655108f, 0.248204872f},
-std::array<float,2>{0.715689361f, 0.776091695f},
-std::array<float,2>{0.247554883f, 0.363452405f},
-std::array<float,2>{0.107444912f, 0.615777552f},
-std::array<float,2>{0.530383527f, 0.14653334f},
-std::array<float,2>{0.963903666f, 0.85688293f},
-std::array<float,2>{0.46113202f, 0.256872177f},
-std::array<float,2>{0.33381781f, 0.895280361f},
-std::array<float,2>{0.766747594f, 0.473324329f},
-std::array<float,2>{0.630171359f, 0.645494223f},
-std::array<float,2>{0.143920988f, 0.0124778422f},
-std::array<float,2>{0.216508329f, 0.783058822f},
-std::array<float,2>{0.727316141f, 0.339635044f},
-std::array<float,2>{0.850593567f, 0.533309817f},
-std::array<float,2>{0.285286486f, 0.2099002f},
-std::array<float,2>{0.427128494f, 0.747280061f},
-std::array<float,2>{0.905645788f, 0.119588755f},
-std::array<float,2>{0.581165433f, 0.937921405f},
-std::array<float,2>{0.0149959503f, 0.424408644f},
-std::array<float,2>{0.154754236f, 0.581089914f},
-std::array<float,2>{0.637442589f, 0.157604441f},
-std::array<float,2>{0.779466093f, 0.816882849f},
-std::array<float,2>{0.340878874f, 0.292431891f},
-std::array<float,2>{0.459327906f, 0.935383797f},
-std::array<float,2>{0.953496993f, 0.454078913f},
-std::array<float,2>{0.52329123f, 0.660073578f},
-std::array<float,2>{0.0942607f, 0.0577350594f},
-std::array<float,2>{0.00467150379f, 0.766987801f},
-std::array<float,2>{0.586960375f, 0.373078644f},
-std::array<float,2>{0.891688108f, 0.524882853f},
-std::array<float,2>{0.43544507f, 0.23584269f},
-std::array<float,2>{0.291099012f, 0.706300855f},
-std::array<float,2>{0.852573276f, 0.0887068287f},
-std::array<float,2>{0.722647309f, 0.981112242f},
-std::array<float,2>{0.209426448f, 0.377361029f},
-std::array<float,2>{0.085734129f, 0.650331378f},
-std::array<float,2>{0.548943877f, 0.00536230672f},
-std::array<float,2>{0.989861786f, 0.904818952f},
-std::array<float,2>{0.4758012f, 0.484008044f},
-std::array<float,2>{0.363757402f, 0.847460568f},
-std::array<float,2>{0.792175889f, 0.263047576f},
-std::array<float,2>{0.677406013f, 0.619977832f},
-std::array<float,2>{0.165236369f, 0.155101612f},
-std::array<float,2>{0.239234895f, 0.946277916f},
-std::array<float,2>{0.704481781f, 0.434504449f},
-std::array<float,2>{0.815968633f, 0.741317272f},
-std::array<float,2>{0.265438408f, 0.116700388f},
-std::array<float,2>{0.396428198f, 0.5468027f},
-std::array<float,2>{0.910791039f, 0.211063668f},
-std::array<float,2>{0.614465475f, 0.791487694f},
-std::array<float,2>{0.0411586054f, 0.329138845f},
-std::array<float,2>{0.192936912f, 0.730053127f},
-std::array<float,2>{0.738336623f, 0.102306016f},
-std::array<float,2>{0.867916286f, 0.963024676f},
-std::array<float,2>{0.302471429f, 0.414943427f},
-std::array<float,2>{0.408408076f, 0.807878792f},
-std::array<float,2>{0.876928031f, 0.327015936f},
-std::array<float,2>{0.573085785f, 0.561383724f},
-std::array<float,2>{0.0278747324f, 0.198940411f},
-std::array<float,2>{0.11255943f, 0.887547255f},
-std::array<float,2>{0.507445216f, 0.490356266f},
-std::array<float,2>{0.952021003f, 0.636332572f},
-std::array<float,2>{0.452307194f, 0.0174140483f},
-std::array<float,2>{0.325038493f, 0.594550014f},
-std::array<float,2>{0.75531286f, 0.137679532f},
-std::array<float,2>{0.643642724f, 0.86516726f},
-std::array<float,2>{0.138136789f, 0.276313871f},
-std::array<float,2>{0.0485246964f, 0.509503424f},
-std::array<float,2>{0.605842948f, 0.223822162f},
-std::array<float,2>{0.928203523f, 0.758693576f},
-std::array<float,2>{0.378857791f, 0.354891509f},
-std::array<float,2>{0.268169761f, 0.991802156f},
-std::array<float,2>{0.838389039f, 0.401654452f},
-std::array<float,2>{0.69220078f, 0.701903224f},
-std::array<float,2>{0.229691565f, 0.0641856492f},
-std::array<float,2>{0.176713362f, 0.832577407f},
-std::array<float,2>{0.657310724f, 0.308622062f},
-std::array<float,2>{0.80086118f, 0.575005472f},
-std::array<float,2>{0.348320395f, 0.176125646f},
-std::array<float,2>{0.492920905f, 0.680857956f},
-std::array<float,2>{0.98233819f, 0.0391994007f},
-std::array<float,2>{0.540458977f, 0.908065677f},
-std::array<float,2>{0.0710793212f, 0.445560485f},
-std::array<float,2>{0.206077397f, 0.603522122f},
-std::array<float,2>{0.724238217f, 0.125582919f},
-std::array<float,2>{0.856544733f, 0.87414813f},
-std::array<float,2>{0.294746935f, 0.26729542f},
-std::array<float,2>{0.430104584f, 0.882510066f},
-std::array<float,2>{0.898415208f, 0.49429214f},
-std::array<float,2>{0.59312278f, 0.627240777f},
-std::array<float,2>{0.000769465696f, 0.0266066901f},
-std::array<float,2>{0.0999763981f, 0.801500201f},
-std::array<float,2>{0.518466711f, 0.319182694f},
-std::array<float,2>{0.960770488f, 0.547421873f},
-std::array<float,2>{0.453927547f, 0.192626446f},
-std::array<float,2>{0.336700708f, 0.720727921f},
-std::array<float,2>{0.775242448f, 0.0993869081f},
-std::array<float,2>{0.633707345f, 0.958425939f},
-std::array<float,2>{0.148713738f, 0.413682759f},
-std::array<float,2>{0.0464552902f, 0.67639935f},
-std::array<float,2>{0.610128105f, 0.0385314152f},
-std::array<float,2>{0.907179356f, 0.920106113f},
-std::array<float,2>{0.392048478f, 0.440267533f},
-std::array<float,2>{0.259981155f, 0.836176515f},
-std::array<float,2>{0.817641914f, 0.300532669f},
-std::array<float,2>{0.708283484f, 0.569764853f},
-std::array<float,2>{0.235858098f, 0.182137623f},
-std::array<float,2>{0.171714187f, 0.993319988f},
-std::array<float,2>{0.675234556f, 0.393565357f},
-std::array<float,2>{0.794194102f, 0.688994467f},
-std::array<float,2>{0.36109516f, 0.0737801045f},
-std::array<float,2>{0.471478969f, 0.505562544f},
-std::array<float,2>{0.987632692f, 0.23004213f},
-std::array<float,2>{0.553247631f, 0.755864799f},
-std::array<float,2>{0.0793222412f, 0.348190486f},
-std::array<float,2>{0.13460201f, 0.714030206f},
-std::array<float,2>{0.644864976f, 0.0826379359f},
-std::array<float,2>{0.753368735f, 0.971764505f},
-std::array<float,2>{0.323282897f, 0.386648476f},
-std::array<float,2>{0.447372198f, 0.779928684f},
-std::array<float,2>{0.946155667f, 0.36042136f},
-std::array<float,2>{0.502244115f, 0.519159794f},
-std::array<float,2>{0.115118332f, 0.244164422f},
-std::array<float,2>{0.0265457202f, 0.923051953f},
-std::array<float,2>{0.575084031f, 0.46283263f},
-std::array<float,2>{0.881273746f, 0.669062972f},
-std::array<float,2>{0.413069904f, 0.0531856231f},
-std::array<float,2>{0.298691899f, 0.593153f},
-std::array<float,2>{0.871775091f, 0.171691388f},
-std::array<float,2>{0.736043453f, 0.821478724f},
-std::array<float,2>{0.188991725f, 0.282353312f},
-std::array<float,2>{0.074274078f, 0.538501859f},
-std::array<float,2>{0.545941591f, 0.206018046f},
-std::array<float,2>{0.979740918f, 0.785909474f},
-std::array<float,2>{0.497180283f, 0.343469918f},
-std::array<float,2>{0.345852971f, 0.944104135f},
-std::array<float,2>{0.79920733f, 0.426529676f},
-std::array<float,2>{0.66262269f, 0.744732559f},
-std::array<float,2>{0.175249577f, 0.122195117f},
-std::array<float,2>{0.231541947f, 0.854706407f},
-std::array<float,2>{0.689358175f, 0.252979904f},
-std::array<float,2>{0.841236234f, 0.610029161f},
-std::array<float,2>{0.270463914f, 0.141283661f},
-std::array<float,2>{0.381314903f, 0.641778409f},
-std::array<float,2>{0.922994256f, 0.00787773076f},
-std::array<float,2>{0.605061591f, 0.892772555f},
-std::array<float,2>{0.0520350635f, 0.4692927f},
-std::array<float,2>{0.183481276f, 0.52737242f},
-std::array<float,2>{0.664833903f, 0.240184948f},
-std::array<float,2>{0.811783969f, 0.772932649f},
-std::array<float,2>{0.354374141f, 0.369520038f},
-std::array<float,2>{0.485018015f, 0.980339646f},
-std::array<float,2>{0.972409844f, 0.382047832f},
-std::array<float,2>{0.536532104f, 0.710834742f},
-std::array<float,2>{0.0669467822f, 0.0936171114f},
-std::array<float,2>{0.0607150793f, 0.813815951f},
-std::array<float,2>{0.59773314f, 0.29566738f},
-std::array<float,2>{0.934349597f, 0.582609713f},
-std::array<float,2>{0.390612185f, 0.160853431f},
-std::array<float,2>{0.279828876f, 0.661797762f},
-std::array<float,2>{0.832711697f, 0.0613186061f},
-std::array<float,2>{0.702392519f, 0.92983216f},
-std::array<float,2>{0.225930735f, 0.460840791f},
-std::array<float,2>{0.119258389f, 0.737201333f},
-std::array<float,2>{0.513921499f, 0.1114785f},
-std::array<float,2>{0.937599778f, 0.952877343f},
-std::array<float,2>{0.440965861f, 0.430833787f},
-std::array<float,2>{0.316405445f, 0.79549551f},
-std::array<float,2>{0.765558243f, 0.333021522f},
-std::array<float,2>{0.650800109f, 0.541885793f},
-std::array<float,2>{0.131206557f, 0.216422439f},
-std::array<float,2>{0.201743096f, 0.900330007f},
-std::array<float,2>{0.746818125f, 0.478059143f},
-std::array<float,2>{0.866815984f, 0.655780137f},
-std::array<float,2>{0.309824288f, 0.00274823071f},
-std::array<float,2>{0.419747889f, 0.62173754f},
-std::array<float,2>{0.889751852f, 0.149241149f},
-std::array<float,2>{0.569461942f, 0.847754836f},
-std::array<float,2>{0.0157872699f, 0.260487229f},
-std::array<float,2>{0.245862082f, 0.636753857f},
-std::array<float,2>{0.713089049f, 0.0214155111f},
-std::array<float,2>{0.822092175f, 0.884481728f},
-std::array<float,2>{0.252282679f, 0.488028944f},
-std::array<float,2>{0.403559536f, 0.862906992f},
-std::array<float,2>{0.918058157f, 0.278030753f},
-std::array<float,2>{0.624749601f, 0.598181367f},
-std::array<float,2>{0.0363887139f, 0.135825828f},
-std::array<float,2>{0.0871524885f, 0.96614176f},
-std::array<float,2>{0.555586159f, 0.418705463f},
-std::array<float,2>{0.999918878f, 0.731497407f},
-std::array<float,2>{0.484107018f, 0.108440742f},
-std::array<float,2>{0.370539367f, 0.558100343f},
-std::array<float,2>{0.788169324f, 0.200349033f},
-std::array<float,2>{0.687195957f, 0.809998631f},
-std::array<float,2>{0.157245144f, 0.320802838f},
-std::array<float,2>{0.00918560941f, 0.573592544f},
-std::array<float,2>{0.583428085f, 0.172259912f},
-std::array<float,2>{0.901051879f, 0.830332577f},
-std::array<float,2>{0.422579139f, 0.304882288f},
-std::array<float,2>{0.284762353f, 0.910656691f},
-std::array<float,2>{0.847421944f, 0.4492746f},
-std::array<float,2>{0.732594609f, 0.685506463f},
-std::array<float,2>{0.213270143f, 0.0449128114f},
-std::array<float,2>{0.145475507f, 0.763976753f},
-std::array<float,2>{0.628641903f, 0.356851846f},
-std::array<float,2>{0.769749343f, 0.513877451f},
-std::array<float,2>{0.329200506f, 0.221513242f},
-std::array<float,2>{0.466241479f, 0.695672929f},
-std::array<float,2>{0.96514523f, 0.0700650215f},
-std::array<float,2>{0.524477839f, 0.987295449f},
-std::array<float,2>{0.101656638f, 0.405796915f},
-std::array<float,2>{0.230272546f, 0.511554718f},
-std::array<float,2>{0.691542566f, 0.224653497f},
-std::array<float,2>{0.837982118f, 0.760873377f},
-std::array<float,2>{0.268027782f, 0.352569222f},
-std::array<float,2>{0.378317416f, 0.988519073f},
-std::array<float,2>{0.928402305f, 0.398802727f},
-std::array<float,2>{0.605983377f, 0.700869083f},
-std::array<float,2>{0.0482106581f, 0.0656322092f},
-std::array<float,2>{0.070527114f, 0.834443271f},
-std::array<float,2>{0.540543973f, 0.310579121f},
-std::array<float,2>{0.981635451f, 0.577141762f},
-std::array<float,2>{0.492325574f, 0.179621205f},
-std::array<float,2>{0.347774833f, 0.682656944f},
-std::array<float,2>{0.801567078f, 0.0412874334f},
-std::array<float,2>{0.65811646f, 0.909733176f},
-std::array<float,2>{0.176064447f, 0.4485614f},
-std::array<float,2>{0.0274444371f, 0.72840786f},
-std::array<float,2>{0.572580874f, 0.10444589f},
-std::array<float,2>{0.876090348f, 0.962014854f},
-std::array<float,2>{0.409097105f, 0.417966515f},
-std::array<float,2>{0.301823258f, 0.806037247f},
-std::array<float,2>{0.867361486f, 0.32596761f},
-std::array<float,2>{0.738850117f, 0.559673131f},
-std::array<float,2>{0.192794487f, 0.196280479f},
-std::array<float,2>{0.138353333f, 0.889119387f},
-std::array<float,2>{0.644421518f, 0.489284486f},
-std::array<float,2>{0.755721629f, 0.634764016f},
-std::array<float,2>{0.324552745f, 0.0179465655f},
-std::array<float,2>{0.453096867f, 0.595846117f},
-std::array<float,2>{0.951402128f, 0.140399039f},
-std::array<float,2>{0.507112741f, 0.866775274f},
-std::array<float,2>{0.113235034f, 0.273457885f},
-std::array<float,2>{0.16598013f, 0.65202409f},
-std::array<float,2>{0.677180529f, 0.00744851399f},
-std::array<float,2>{0.792693555f, 0.902835548f},
-std::array<float,2>{0.363849401f, 0.480830044f},
-std::array<float,2>{0.476170838f, 0.845125079f},
-std::array<float,2>{0.989709735f, 0.263702661f},
-std::array<float,2>{0.549520671f, 0.617329538f},
-std::array<float,2>{0.0853829086f, 0.153833777f},
-std::array<float,2>{0.041535683f, 0.948057473f},
-std::array<float,2>{0.61499542f, 0.436122149f},
-std::array<float,2>{0.910340548f, 0.739773333f},
-std::array<float,2>{0.395858794f, 0.114470832f},
-std::array<float,2>{0.264784634f, 0.54306078f},
-std::array<float,2>{0.815747023f, 0.21303308f},
-std::array<float,2>{0.704916894f, 0.790823519f},
-std::array<float,2>{0.238467991f, 0.330726564f},
-std::array<float,2>{0.0938829109f, 0.578469098f},
-std::array<float,2>{0.52262032f, 0.159176394f},
-std::array<float,2>{0.953632891f, 0.819382489f},
-std::array<float,2>{0.459749192f, 0.289648652f},
-std::array<float,2>{0.341546476f, 0.936882138f},
-std::array<float,2>{0.779786766f, 0.456182927f},
-std::array<float,2>{0.636951387f, 0.657132566f},
-std::array<float,2>{0.155120507f, 0.0556442961f},
-std::array<float,2>{0.209718421f, 0.768487155f},
-std::array<float,2>{0.722016275f, 0.371180236f},
-std::array<float,2>{0.853506029f, 0.526521385f},
-std::array<float,2>{0.291900575f, 0.237158805f},
-std::array<float,2>{0.434709758f, 0.704842865f},
-std::array<float,2>{0.892420173f, 0.0869436711f},
-std::array<float,2>{0.587742925f, 0.983804584f},
-std::array<float,2>{0.00437512388f, 0.375193328f},
-std::array<float,2>{0.144240305f, 0.613405883f},
-std::array<float,2>{0.63069284f, 0.145684361f},
-std::array<float,2>{0.767447829f, 0.858303249f},
-std::array<float,2>{0.333080828f, 0.255685925f},
-std::array<float,2>{0.461906761f, 0.898267984f},
-std::array<float,2>{0.96469444f, 0.47631079f},
-std::array<float,2>{0.531172335f, 0.646610677f},
-std::array<float,2>{0.108319573f, 0.0148944492f},
-std::array<float,2>{0.0156087158f, 0.784273326f},
-std::array<float,2>{0.58195281f, 0.336298496f},
-std::array<float,2>{0.905840814f, 0.5323475f},
-std::array<float,2>{0.427527457f, 0.208583146f},
-std::array<float,2>{0.285789341f, 0.748416007f},
-std::array<float,2>{0.851534069f, 0.117794164f},
-std::array<float,2>{0.726911724f, 0.940083861f},
-std::array<float,2>{0.21610108f, 0.423634708f},
-std::array<float,2>{0.0937196165f, 0.665442288f},
-std::array<float,2>{0.56014353f, 0.0483212024f},
-std::array<float,2>{0.993149281f, 0.926403463f},
-std::array<float,2>{0.477547258f, 0.468685359f},
-std::array<float,2>{0.373307765f, 0.82499516f},
-std::array<float,2>{0.784963727f, 0.286067873f},
-std::array<float,2>{0.68058002f, 0.588426352f},
-std::array<float,2>{0.16402933f, 0.166610494f},
-std::array<float,2>{0.247576088f, 0.972677767f},
-std::array<float,2>{0.715206683f, 0.389836282f},
-std::array<float,2>{0.826683939f, 0.715089321f},
-std::array<float,2>{0.25410074f, 0.0789495632f},
-std::array<float,2>{0.399181575f, 0.523394346f},
-std::array<float,2>{0.916372418f, 0.246130809f},
-std::array<float,2>{0.619999528f, 0.774846196f},
-std::array<float,2>{0.0342510976f, 0.365888268f},
-std::array<float,2>{0.196261913f, 0.692138553f},
-std::array<float,2>{0.745442569f, 0.0748674199f},
-std::array<float,2>{0.862218738f, 0.997216463f},
-std::array<float,2>{0.304798901f, 0.395237625f},
-std::array<float,2>{0.415457636f, 0.75314796f},
-std::array<float,2>{0.883081853f, 0.346029073f},
-std::array<float,2>{0.563755572f, 0.500244319f},
-std::array<float,2>{0.0212882943f, 0.23177354f},
-std::array<float,2>{0.122465789f, 0.914979219f},
-std::array<float,2>{0.508415997f, 0.441556841f},
-std::array<float,2>{0.943636954f, 0.673237979f},
-std::array<float,2>{0.444334298f, 0.0330081992f},
-std::array<float,2>{0.319637746f, 0.565322101f},
-std::array<float,2>{0.758598208f, 0.184944913f},
-std::array<float,2>{0.65528065f, 0.840923667f},
-std::array<float,2>{0.127585366f, 0.302089989f},
-std::array<float,2>{0.0547506064f, 0.554454148f},
-std::array<float,2>{0.595796287f, 0.187731922f},
-std::array<float,2>{0.930098355f, 0.799376011f},
-std::array<float,2>{0.38423866f, 0.312954575f},
-std::array<float,2>{0.274105549f, 0.955500066f},
-std::array<float,2>{0.829042435f, 0.40700984f},
-std::array<float,2>{0.695794344f, 0.722890139f},
-std::array<float,2>{0.219777852f, 0.095912911f},
-std::array<float,2>{0.185996294f, 0.868605435f},
-std::array<float,2>{0.668502033f, 0.272822946f},
-std::array<float,2>{0.805785358f, 0.608299673f},
-std::array<float,2>{0.356829315f, 0.129831553f},
-std::array<float,2>{0.489330322f, 0.632583737f},
-std::array<float,2>{0.974360585f, 0.0311061963f},
-std::array<float,2>{0.531369865f, 0.877953649f},
-std::array<float,2>{0.0649379864f, 0.499365926f},
-std::array<float,2>{0.213434681f, 0.571706355f},
-std::array<float,2>{0.732927501f, 0.17391865f},
-std::array<float,2>{0.846952558f, 0.828233659f},
-std::array<float,2>{0.284416616f, 0.308426142f},
-std::array<float,2>{0.42195642f, 0.913661838f},
-std::array<float,2>{0.900423229f, 0.452891678f},
-std::array<float,2>{0.583623886f, 0.687095404f},
-std::array<float,2>{0.00960520655f, 0.045590952f},
-std::array<float,2>{0.102164134f, 0.763006747f},
-std::array<float,2>{0.525055707f, 0.358686417f},
-std::array<float,2>{0.965376914f, 0.513629496f},
-std::array<float,2>{0.466669083f, 0.220194742f},
-std::array<float,2>{0.329697639f, 0.699083984f},
-std::array<float,2>{0.770289063f, 0.0674709007f},
-std::array<float,2>{0.628143728f, 0.985426486f},
-std::array<float,2>{0.14488481f, 0.404036224f},
-std::array<float,2>{0.0366750807f, 0.639306843f},
-std::array<float,2>{0.624323726f, 0.0216611922f},
-std::array<float,2>{0.918815672f, 0.885222971f},
-std::array<float,2>{0.404073924f, 0.485953152f},
-std::array<float,2>{0.252786338f, 0.86020416f},
-std::array<float,2>{0.821357429f, 0.280858636f},
-std::array<float,2>{0.713612914f, 0.600242615f},
-std::array<float,2>{0.245418847f, 0.134307846f},
-std::array<float,2>{0.15785417f, 0.967533886f},
-std::array<float,2>{0.686990201f, 0.420488954f},
-std::array<float,2>{0.78888762f, 0.733179152f},
-std::array<float,2>{0.370692343f, 0.105829418f},
-std::array<float,2>{0.483825386f, 0.555977046f},
-std::array<float,2>{0.999222577f, 0.201725751f},
-std::array<float,2>{0.555174947f, 0.811546087f},
-std::array<float,2>{0.0874877274f, 0.323524415f},
-std::array<float,2>{0.131591409f, 0.736143947f},
-std::array<float,2>{0.651095748f, 0.110133722f},
-std::array<float,2>{0.765131474f, 0.949708879f},
-std::array<float,2>{0.315502346f, 0.432837516f},
-std::array<float,2>{0.44046253f, 0.794884622f},
-std::array<float,2>{0.938375354f, 0.335301191f},
-std::array<float,2>{0.514410555f, 0.540270209f},
-std::array<float,2>{0.119630083f, 0.217217058f},
-std::array<float,2>{0.0165957566f, 0.901397765f},
-std::array<float,2>{0.569929361f, 0.480270773f},
-std::array<float,2>{0.890470147f, 0.652989209f},
-std::array<float,2>{0.419029087f, 0.000869195559f},
-std::array<float,2>{0.310127169f, 0.624475002f},
-std::array<float,2>{0.866232097f, 0.15101549f},
-std::array<float,2>{0.746469557f, 0.85032177f},
-std::array<float,2>{0.201416314f, 0.258597463f},
-std::array<float,2>{0.0668796748f, 0.529362142f},
-std::array<float,2>{0.536908329f, 0.241182461f},
-std::array<float,2>{0.97198683f, 0.770253658f},
-std::array<float,2>{0.484397978f, 0.367298216f},
-std::array<float,2>{0.353874803f, 0.977048099f},
-std::array<float,2>{0.812135458f, 0.380474657f},
-std::array<float,2>{0.66442734f, 0.707289159f},
-std::array<float,2>{0.182952404f, 0.0916441381f},
-std::array<float,2>{0.226455316f, 0.815721631f},
-std::array<float,2>{0.702725887f, 0.294034809f},
-std::array<float,2>{0.832449496f, 0.584458947f},
-std::array<float,2>{0.279642045f, 0.163971812f},
-std::array<float,2>{0.389799446f, 0.663416564f},
-std::array<float,2>{0.933653235f, 0.0588657036f},
-std::array<float,2>{0.598499596f, 0.931850493f},
-std::array<float,2>{0.061249759f, 0.458400279f},
-std::array<float,2>{0.175295725f, 0.536480784f},
-std::array<float,2>{0.662302196f, 0.20466578f},
-std::array<float,2>{0.799331665f, 0.788416922f},
-std::array<float,2>{0.346556634f, 0.339989543f},
-std::array<float,2>{0.497744501f, 0.941668451f},
-std::array<float,2>{0.980467379f, 0.428032964f},
-std::array<float,2>{0.546665013f, 0.742599189f},
-std::array<float,2>{0.0750739425f, 0.124150515f},
-std::array<float,2>{0.0522890538f, 0.853504837f},
-std::array<float,2>{0.604610801f, 0.251715213f},
-std::array<float,2>{0.923730254f, 0.611364067f},
-std::array<float,2>{0.38153109f, 0.144477531f},
-std::array<float,2>{0.269718051f, 0.644494474f},
-std::array<float,2>{0.841571629f, 0.010347872f},
-std::array<float,2>{0.688535213f, 0.890830994f},
-std::array<float,2>{0.232215032f, 0.471558124f},
-std::array<float,2>{0.114550151f, 0.712047875f},
-std::array<float,2>{0.502872288f, 0.0840103999f},
-std::array<float,2>{0.945789993f, 0.970380485f},
-std::array<float,2>{0.447958231f, 0.38356334f},
-std::array<float,2>{0.324022859f, 0.777754068f},
-std::array<float,2>{0.753449857f, 0.3613846f},
-std::array<float,2>{0.645121872f, 0.516394734f},
-std::array<float,2>{0.133975953f, 0.243344605f},
-std::array<float,2>{0.188603118f, 0.924385011f},
-std::array<float,2>{0.735564351f, 0.46378997f},
-std::array<float,2>{0.871555269f, 0.671273172f},
-std::array<float,2>{0.298305154f, 0.0525980778f},
-std::array<float,2>{0.412151039f, 0.590656042f},
-std::array<float,2>{0.881745219f, 0.169183806f},
-std::array<float,2>{0.574661195f, 0.823164821f},
-std::array<float,2>{0.0272488594f, 0.283955961f},
-std::array<float,2>{0.235415831f, 0.677946627f},
-std::array<float,2>{0.708799839f, 0.0364478752f},
-std::array<float,2>{0.818050086f, 0.917987406f},
-std::array<float,2>{0.260495633f, 0.438108087f},
-std::array<float,2>{0.392507762f, 0.839513421f},
-std::array<float,2>{0.906441689f, 0.297651231f},
-std::array<float,2>{0.609687984f, 0.567215681f},
-std::array<float,2>{0.0460803099f, 0.180199936f},
-std::array<float,2>{0.0796810761f, 0.99482131f},
-std::array<float,2>{0.553090334f, 0.391403377f},
-std::array<float,2>{0.987807751f, 0.689717293f},
-std::array<float,2>{0.471154273f, 0.0715697408f},
-std::array<float,2>{0.360447377f, 0.506094933f},
-std::array<float,2>{0.794541419f, 0.227233648f},
-std::array<float,2>{0.675337553f, 0.755083501f},
-std::array<float,2>{0.171032697f, 0.349718511f},
-std::array<float,2>{0.000346719753f, 0.602636933f},
-std::array<float,2>{0.59349972f, 0.128512457f},
-std::array<float,2>{0.897584796f, 0.871951282f},
-std::array<float,2>{0.430596322f, 0.268470466f},
-std::array<float,2>{0.294120014f, 0.880407214f},
-std::array<float,2>{0.85695833f, 0.492671311f},
-std::array<float,2>{0.724093139f, 0.626789987f},
-std::array<float,2>{0.206761926f, 0.0245437603f},
-std::array<float,2>{0.149350226f, 0.803567588f},
-std::array<float,2>{0.633056819f, 0.317501694f},
-std::array<float,2>{0.774605155f, 0.549326897f},
-std::array<float,2>{0.336305439f, 0.193387985f},
-std::array<float,2>{0.453572094f, 0.720294237f},
-std::array<float,2>{0.960150301f, 0.100640759f},
-std::array<float,2>{0.517675161f, 0.959866226f},
-std::array<float,2>{0.100484572f, 0.410304278f},
-std::array<float,2>{0.19503136f, 0.560617507f},
-std::array<float,2>{0.741136134f, 0.198616803f},
-std::array<float,2>{0.870752573f, 0.808291733f},
-std::array<float,2>{0.303193659f, 0.326488972f},
-std::array<float,2>{0.407361895f, 0.963663518f},
-std::array<float,2>{0.878780782f, 0.414519876f},
-std::array<float,2>{0.571904361f, 0.729943931f},
-std::array<float,2>{0.030750718f, 0.101934761f},
-std::array<float,2>{0.109817162f, 0.864586711f},
-std::array<float,2>{0.505400896f, 0.275843441f},
-std::array<float,2>{0.949397683f, 0.594186783f},
-std::array<float,2>{0.450349241f, 0.136949226f},
-std::array<float,2>{0.327927202f, 0.635912657f},
-std::array<float,2>{0.755968273f, 0.0168751273f},
-std::array<float,2>{0.641940534f, 0.887011111f},
-std::array<float,2>{0.140598595f, 0.491103709f},
-std::array<float,2>{0.049758222f, 0.701243699f},
-std::array<float,2>{0.607965231f, 0.0637818277f},
-std::array<float,2>{0.926063895f, 0.991484821f},
-std::array<float,2>{0.376303226f, 0.401987612f},
-std::array<float,2>{0.26666376f, 0.758073688f},
-std::array<float,2>{0.836861253f, 0.355399221f},
-std::array<float,2>{0.694752753f, 0.509202719f},
-std::array<float,2>{0.226612598f, 0.224462152f},
-std::array<float,2>{0.178231195f, 0.90731281f},
-std::array<float,2>{0.659649968f, 0.446198225f},
-std::array<float,2>{0.803145885f, 0.681253314f},
-std::array<float,2>{0.351488799f, 0.0400006734f},
-std::array<float,2>{0.494816184f, 0.574557006f},
-std::array<float,2>{0.983922362f, 0.176677704f},
-std::array<float,2>{0.541670799f, 0.832375586f},
-std::array<float,2>{0.0728613138f, 0.309556782f},
-std::array<float,2>{0.153494269f, 0.659269929f},
-std::array<float,2>{0.639192283f, 0.0583531596f},
-std::array<float,2>{0.777346849f, 0.934841931f},
-std::array<float,2>{0.342003852f, 0.453534067f},
-std::array<float,2>{0.457597822f, 0.817000568f},
-std::array<float,2>{0.955103755f, 0.292502433f},
-std::array<float,2>{0.52001071f, 0.582024813f},
-std::array<float,2>{0.0974196568f, 0.157972902f},
-std::array<float,2>{0.00700607803f, 0.980498731f},
-std::array<float,2>{0.588938892f, 0.377607673f},
-std::array<float,2>{0.893550217f, 0.706568658f},
-std::array<float,2>{0.436808884f, 0.088022545f},
-std::array<float,2>{0.290157378f, 0.525107741f},
-std::array<float,2>{0.854277015f, 0.235581741f},
-std::array<float,2>{0.720084786f, 0.767124116f},
-std::array<float,2>{0.207781792f, 0.373768449f},
-std::array<float,2>{0.0821355432f, 0.619369566f},
-std::array<float,2>{0.54852128f, 0.154581323f},
-std::array<float,2>{0.992185116f, 0.84685266f},
-std::array<float,2>{0.472974211f, 0.263587624f},
-std::array<float,2>{0.365714282f, 0.904340327f},
-std::array<float,2>{0.789973199f, 0.483565509f},
-std::array<float,2>{0.67850709f, 0.649436355f},
-std::array<float,2>{0.166787431f, 0.00578794256f},
-std::array<float,2>{0.24185659f, 0.791731775f},
-std::array<float,2>{0.706102014f, 0.330027103f},
-std::array<float,2>{0.81439805f, 0.546309412f},
-std::array<float,2>{0.26261279f, 0.21180816f},
-std::array<float,2>{0.396691799f, 0.741749763f},
-std::array<float,2>{0.913674831f, 0.116227545f},
-std::array<float,2>{0.616498053f, 0.945590377f},
-std::array<float,2>{0.0400760211f, 0.433795571f},
-std::array<float,2>{0.160257995f, 0.587444961f},
-std::array<float,2>{0.683179796f, 0.165172577f},
-std::array<float,2>{0.782198071f, 0.82796222f},
-std::array<float,2>{0.371668756f, 0.288110852f},
-std::array<float,2>{0.479162782f, 0.929017544f},
-std::array<float,2>{0.996012628f, 0.465202272f},
-std::array<float,2>{0.560647845f, 0.666616023f},
-std::array<float,2>{0.0906077474f, 0.0497404337f},
-std::array<float,2>{0.03272539f, 0.775773168f},
-std::array<float,2>{0.618151128f, 0.363876522f},
-std::array<float,2>{0.915714025f, 0.519888222f},
-std::array<float,2>{0.402015179f, 0.248835176f},
-std::array<float,2>{0.256068021f, 0.716852844f},
-std::array<float,2>{0.824775755f, 0.0803538039f},
-std::array<float,2>{0.71849525f, 0.975990295f},
-std::array<float,2>{0.249665201f, 0.388580352f},
-std::array<float,2>{0.106388859f, 0.644967854f},
-std::array<float,2>{0.528055191f, 0.0121245757f},
-std::array<float,2>{0.96223098f, 0.894848824f},
-std::array<float,2>{0.464359224f, 0.472946763f},
-std::array<float,2>{0.335811317f, 0.856996596f},
-std::array<float,2>{0.767874897f, 0.257458746f},
-std::array<float,2>{0.632432759f, 0.615475774f},
-std::array<float,2>{0.141569927f, 0.147226781f},
-std::array<float,2>{0.217349038f, 0.938292146f},
-std::array<float,2>{0.728644073f, 0.424086154f},
-std::array<float,2>{0.849278212f, 0.747975051f},
-std::array<float,2>{0.288265437f, 0.119791627f},
-std::array<float,2>{0.429249972f, 0.534139931f},
-std::array<float,2>{0.903804302f, 0.209142551f},
-std::array<float,2>{0.579821408f, 0.782671988f},
-std::array<float,2>{0.0119575793f, 0.339306921f},
-std::array<float,2>{0.22079818f, 0.726416171f},
-std::array<float,2>{0.698640704f, 0.0941049904f},
-std::array<float,2>{0.830160141f, 0.95415628f},
-std::array<float,2>{0.276540756f, 0.408703268f},
-std::array<float,2>{0.385432482f, 0.798048973f},
-std::array<float,2>{0.93180263f, 0.316364229f},
-std::array<float,2>{0.594696343f, 0.551357746f},
-std::array<float,2>{0.0567852147f, 0.189566016f},
-std::array<float,2>{0.0626827106f, 0.87538749f},
-std::array<float,2>{0.533964872f, 0.496169001f},
-std::array<float,2>{0.975716114f, 0.630137384f},
-std::array<float,2>{0.491010398f, 0.0287493467f},
-std::array<float,2>{0.358959794f, 0.606782019f},
-std::array<float,2>{0.808335721f, 0.131813303f},
-std::array<float,2>{0.670694888f, 0.870544314f},
-std::array<float,2>{0.185161799f, 0.271130681f},
-std::array<float,2>{0.0230809804f, 0.502790391f},
-std::array<float,2>{0.566211462f, 0.234248608f},
-std::array<float,2>{0.886664271f, 0.750395477f},
-std::array<float,2>{0.416757882f, 0.344737619f},
-std::array<float,2>{0.307738006f, 0.998465776f},
-std::array<float,2>{0.860478282f, 0.398387253f},
-std::array<float,2>{0.74400717f, 0.694288135f},
-std::array<float,2>{0.198086053f, 0.0766805112f},
-std::array<float,2>{0.125746936f, 0.843193948f},
-std::array<float,2>{0.65344882f, 0.303698987f},
-std::array<float,2>{0.761318445f, 0.563415051f},
-std::array<float,2>{0.31717205f, 0.1874827f},
-std::array<float,2>{0.442352206f, 0.675740182f},
-std::array<float,2>{0.942234576f, 0.0332499221f},
-std::array<float,2>{0.510793746f, 0.916632295f},
-std::array<float,2>{0.123057067f, 0.444488943f},
-std::array<float,2>{0.242318794f, 0.59789896f},
-std::array<float,2>{0.71267128f, 0.136317328f},
-std::array<float,2>{0.823507667f, 0.862606764f},
-std::array<float,2>{0.250878215f, 0.277593613f},
-std::array<float,2>{0.404725105f, 0.88392365f},
-std::array<float,2>{0.921209633f, 0.487315625f},
-std::array<float,2>{0.622650623f, 0.637214005f},
-std::array<float,2>{0.0384465903f, 0.0209070481f},
-std::array<float,2>{0.0888951048f, 0.810420036f},
-std::array<float,2>{0.55808866f, 0.320337087f},
-std::array<float,2>{0.997439444f, 0.558489978f},
-std::array<float,2>{0.480964422f, 0.200754762f},
-std::array<float,2>{0.369046569f, 0.732206881f},
-std::array<float,2>{0.786515176f, 0.108931795f},
-std::array<float,2>{0.684579909f, 0.966787934f},
-std::array<float,2>{0.15914017f, 0.418289244f},
-std::array<float,2>{0.0105106561f, 0.684920669f},
-std::array<float,2>{0.585849166f, 0.0443239883f},
-std::array<float,2>{0.899914622f, 0.910382569f},
-std::array<float,2>{0.425409377f, 0.44985196f},
-std::array<float,2>{0.28169623f, 0.831035972f},
-std::array<float,2>{0.844190717f, 0.305574864f},
-std::array<float,2>{0.731862605f, 0.573795617f},
-std::array<float,2>{0.212056175f, 0.172597378f},
-std::array<float,2>{0.147366598f, 0.986609876f},
-std::array<float,2>{0.625207186f, 0.405645847f},
-std::array<float,2>{0.771497726f, 0.696288526f},
-std::array<float,2>{0.331787527f, 0.0696271956f},
-std::array<float,2>{0.467795789f, 0.514406443f},
-std::array<float,2>{0.968380153f, 0.220968023f},
-std::array<float,2>{0.526537657f, 0.764201403f},
-std::array<float,2>{0.104267374f, 0.357248217f},
-std::array<float,2>{0.180359274f, 0.710421443f},
-std::array<float,2>{0.667634666f, 0.0927777886f},
-std::array<float,2>{0.80947125f, 0.979503214f},
-std::array<float,2>{0.351976663f, 0.382614315f},
-std::array<float,2>{0.488276094f, 0.773075044f},
-std::array<float,2>{0.968751669f, 0.369843185f},
-std::array<float,2>{0.537451982f, 0.528145194f},
-std::array<float,2>{0.0696259961f, 0.239710286f},
-std::array<float,2>{0.0597584471f, 0.930632651f},
-std::array<float,2>{0.601299226f, 0.460291684f},
-std::array<float,2>{0.93721813f, 0.661407769f},
-std::array<float,2>{0.387242407f, 0.0606671683f},
-std::array<float,2>{0.277995497f, 0.582081854f},
-std::array<float,2>{0.834437966f, 0.160551459f},
-std::array<float,2>{0.69992429f, 0.814204454f},
-std::array<float,2>{0.223692074f, 0.295222878f},
-std::array<float,2>{0.117431894f, 0.541243792f},
-std::array<float,2>{0.51278758f, 0.215982586f},
-std::array<float,2>{0.940957606f, 0.794927239f},
-std::array<float,2>{0.438682795f, 0.33365187f},
-std::array<float,2>{0.313530266f, 0.952543736f},
-std::array<float,2>{0.762295842f, 0.431288511f},
-std::array<float,2>{0.649439454f, 0.736813664f},
-std::array<float,2>{0.129683435f, 0.111972488f},
-std::array<float,2>{0.200094253f, 0.848195851f},
-std::array<float,2>{0.749786973f, 0.259869069f},
-std::array<float,2>{0.863535166f, 0.62124151f},
-std::array<float,2>{0.310674399f, 0.148549259f},
-std::array<float,2>{0.421338499f, 0.65531081f},
-std::array<float,2>{0.88734901f, 0.0020600541f},
-std::array<float,2>{0.566630065f, 0.899530888f},
-std::array<float,2>{0.0188845266f, 0.477572709f},
-std::array<float,2>{0.136590064f, 0.519007921f},
-std::array<float,2>{0.647489011f, 0.245010883f},
-std::array<float,2>{0.750964344f, 0.779543579f},
-std::array<float,2>{0.321127295f, 0.360946536f},
-std::array<float,2>{0.447003543f, 0.972618639f},
-std::array<float,2>{0.948101997f, 0.38597849f},
-std::array<float,2>{0.501869142f, 0.714455903f},
-std::array<float,2>{0.117139257f, 0.0822102204f},
-std::array<float,2>{0.0242114943f, 0.822137833f},
-std::array<float,2>{0.576491416f, 0.282725781f},
-std::array<float,2>{0.879829049f, 0.593394697f},
-std::array<float,2>{0.411720365f, 0.170979708f},
-std::array<float,2>{0.299290299f, 0.669744253f},
-std::array<float,2>{0.874391139f, 0.0536171608f},
-std::array<float,2>{0.736644745f, 0.923703492f},
-std::array<float,2>{0.191016883f, 0.462354839f},
-std::array<float,2>{0.0762513578f, 0.74436605f},
-std::array<float,2>{0.542974293f, 0.122932643f},
-std::array<float,2>{0.978445828f, 0.943760991f},
-std::array<float,2>{0.498939693f, 0.425866842f},
-std::array<float,2>{0.344936907f, 0.785589218f},
-std::array<float,2>{0.797716558f, 0.342817366f},
-std::array<float,2>{0.660357773f, 0.538728952f},
-std::array<float,2>{0.172837317f, 0.20515351f},
-std::array<float,2>{0.234021425f, 0.893112123f},
-std::array<float,2>{0.69010973f, 0.469170719f},
-std::array<float,2>{0.843283951f, 0.642445743f},
-std::array<float,2>{0.271906018f, 0.00854571443f},
-std::array<float,2>{0.379258275f, 0.609417021f},
-std::array<float,2>{0.925163209f, 0.140973851f},
-std::array<float,2>{0.602791965f, 0.85519731f},
-std::array<float,2>{0.0544218794f, 0.253567278f},
-std::array<float,2>{0.203437045f, 0.62760514f},
-std::array<float,2>{0.726016879f, 0.0272299405f},
-std::array<float,2>{0.858215153f, 0.882216632f},
-std::array<float,2>{0.29520759f, 0.495048583f},
-std::array<float,2>{0.431704223f, 0.874977469f},
-std::array<float,2>{0.896377027f, 0.26676479f},
-std::array<float,2>{0.590854228f, 0.60409224f},
-std::array<float,2>{0.00233289483f, 0.125082776f},
-std::array<float,2>{0.0984054506f, 0.95857209f},
-std::array<float,2>{0.515874207f, 0.413196653f},
-std::array<float,2>{0.9588328f, 0.721222222f},
-std::array<float,2>{0.456151098f, 0.0990891308f},
-std::array<float,2>{0.339631706f, 0.547000825f},
-std::array<float,2>{0.776162267f, 0.193274349f},
-std::array<float,2>{0.636506617f, 0.801003456f},
-std::array<float,2>{0.150410309f, 0.318373829f},
-std::array<float,2>{0.043645829f, 0.570132613f},
-std::array<float,2>{0.611621022f, 0.181705475f},
-std::array<float,2>{0.90892297f, 0.836433947f},
-std::array<float,2>{0.393125087f, 0.299890369f},
-std::array<float,2>{0.258385152f, 0.920558929f},
-std::array<float,2>{0.819944918f, 0.439608127f},
-std::array<float,2>{0.710398912f, 0.67592895f},
-std::array<float,2>{0.238106892f, 0.0390455499f},
-std::array<float,2>{0.168242738f, 0.756350935f},
-std::array<float,2>{0.672132671f, 0.347899556f},
-std::array<float,2>{0.796078622f, 0.505153179f},
-std::array<float,2>{0.362925768f, 0.229879528f},
-std::array<float,2>{0.469557852f, 0.688755274f},
-std::array<float,2>{0.985475361f, 0.073645629f},
-std::array<float,2>{0.552549422f, 0.993718743f},
-std::array<float,2>{0.080765985f, 0.39414528f},
-std::array<float,2>{0.208469242f, 0.525437355f},
-std::array<float,2>{0.71948123f, 0.237734199f},
-std::array<float,2>{0.854957461f, 0.768713832f},
-std::array<float,2>{0.289325356f, 0.372076511f},
-std::array<float,2>{0.436210245f, 0.982966363f},
-std::array<float,2>{0.894397199f, 0.37611717f},
-std::array<float,2>{0.58882302f, 0.703738511f},
-std::array<float,2>{0.00656105066f, 0.0864631459f},
-std::array<float,2>{0.0957438499f, 0.819152832f},
-std::array<float,2>{0.52107662f, 0.290986657f},
-std::array<float,2>{0.956862867f, 0.57993418f},
-std::array<float,2>{0.458952397f, 0.159237698f},
-std::array<float,2>{0.343676955f, 0.657920957f},
-std::array<float,2>{0.77925688f, 0.0564242862f},
-std::array<float,2>{0.640090346f, 0.935904384f},
-std::array<float,2>{0.152899176f, 0.455601811f},
-std::array<float,2>{0.0393843651f, 0.738883972f},
-std::array<float,2>{0.615341067f, 0.113493755f},
-std::array<float,2>{0.912940681f, 0.948933005f},
-std::array<float,2>{0.397549003f, 0.436996281f},
-std::array<float,2>{0.263137788f, 0.789573014f},
-std::array<float,2>{0.813365936f, 0.331444681f},
-std::array<float,2>{0.705925107f, 0.544871032f},
-std::array<float,2>{0.240823179f, 0.214568108f},
-std::array<float,2>{0.167141974f, 0.904202342f},
-std::array<float,2>{0.679159701f, 0.481893212f},
-std::array<float,2>{0.790779889f, 0.650722206f},
-std::array<float,2>{0.366273135f, 0.00667892024f},
-std::array<float,2>{0.473830909f, 0.618200183f},
-std::array<float,2>{0.991014123f, 0.15258272f},
-std::array<float,2>{0.54719311f, 0.844119549f},
-std::array<float,2>{0.0839104131f, 0.265094906f},
-std::array<float,2>{0.139096946f, 0.63343817f},
-std::array<float,2>{0.641221106f, 0.0190401077f},
-std::array<float,2>{0.757087469f, 0.889701903f},
-std::array<float,2>{0.326769441f, 0.488339216f},
-std::array<float,2>{0.449240535f, 0.865455091f},
-std::array<float,2>{0.950745583f, 0.275309592f},
-std::array<float,2>{0.504838765f, 0.597268403f},
-std::array<float,2>{0.110697843f, 0.139233887f},
-std::array<float,2>{0.0295808036f, 0.961538374f},
-std::array<float,2>{0.570925117f, 0.416378617f},
-std::array<float,2>{0.877501428f, 0.727501452f},
-std::array<float,2>{0.406263024f, 0.104909115f},
-std::array<float,2>{0.303974152f, 0.558739424f},
-std::array<float,2>{0.869643807f, 0.196791112f},
-std::array<float,2>{0.741475999f, 0.804853499f},
-std::array<float,2>{0.193748444f, 0.324826121f},
-std::array<float,2>{0.073831372f, 0.577732503f},
-std::array<float,2>{0.542042911f, 0.178517818f},
-std::array<float,2>{0.983308375f, 0.83499378f},
-std::array<float,2>{0.495956004f, 0.31200397f},
-std::array<float,2>{0.349981904f, 0.908383012f},
-std::array<float,2>{0.803807914f, 0.447967649f},
-std::array<float,2>{0.658358157f, 0.681911588f},
-std::array<float,2>{0.179379791f, 0.0425530709f},
-std::array<float,2>{0.228219524f, 0.759964049f},
-std::array<float,2>{0.693720222f, 0.352192849f},
-std::array<float,2>{0.837719202f, 0.51032871f},
-std::array<float,2>{0.265753359f, 0.225941867f},
-std::array<float,2>{0.375587225f, 0.699855864f},
-std::array<float,2>{0.927646875f, 0.0651787296f},
-std::array<float,2>{0.608576834f, 0.989931464f},
-std::array<float,2>{0.0507554524f, 0.399531245f},
-std::array<float,2>{0.183929116f, 0.609310865f},
-std::array<float,2>{0.671492696f, 0.130611613f},
-std::array<float,2>{0.807202399f, 0.867395163f},
-std::array<float,2>{0.35803467f, 0.272049338f},
-std::array<float,2>{0.491375178f, 0.877837837f},
-std::array<float,2>{0.975477576f, 0.498119354f},
-std::array<float,2>{0.534203291f, 0.631684184f},
-std::array<float,2>{0.0638249218f, 0.0296673588f},
-std::array<float,2>{0.0581691153f, 0.800115705f},
-std::array<float,2>{0.595154405f, 0.313542485f},
-std::array<float,2>{0.933327079f, 0.552751422f},
-std::array<float,2>{0.385863155f, 0.188965231f},
-std::array<float,2>{0.275882483f, 0.723970652f},
-std::array<float,2>{0.83124423f, 0.0967730805f},
-std::array<float,2>{0.697670817f, 0.956704915f},
-std::array<float,2>{0.221710458f, 0.407430112f},
-std::array<float,2>{0.124128841f, 0.671963036f},
-std::array<float,2>{0.510301173f, 0.031303633f},
-std::array<float,2>{0.942992985f, 0.915436685f},
-std::array<float,2>{0.442978501f, 0.44295761f},
-std::array<float,2>{0.318345815f, 0.840050578f},
-std::array<float,2>{0.759911478f, 0.30114001f},
-std::array<float,2>{0.65306741f, 0.565817893f},
-std::array<float,2>{0.126183003f, 0.183815867f},
-std::array<float,2>{0.198564038f, 0.996967137f},
-std::array<float,2>{0.74221772f, 0.395888239f},
-std::array<float,2>{0.860027075f, 0.692610264f},
-std::array<float,2>{0.306668639f, 0.0754723847f},
-std::array<float,2>{0.417228341f, 0.501216173f},
-std::array<float,2>{0.885739207f, 0.230986267f},
-std::array<float,2>{0.564716697f, 0.752352715f},
-std::array<float,2>{0.0221257154f, 0.346756667f},
-std::array<float,2>{0.248808831f, 0.715915322f},
-std::array<float,2>{0.717591584f, 0.0796567351f},
-std::array<float,2>{0.825507998f, 0.974588394f},
-std::array<float,2>{0.256916851f, 0.388696045f},
-std::array<float,2>{0.400593132f, 0.774348438f},
-std::array<float,2>{0.914357185f, 0.366933376f},
-std::array<float,2>{0.618888676f, 0.521582842f},
-std::array<float,2>{0.0315427035f, 0.247316912f},
-std::array<float,2>{0.0915771201f, 0.926818132f},
-std::array<float,2>{0.562078416f, 0.467503488f},
-std::array<float,2>{0.995086968f, 0.66409725f},
-std::array<float,2>{0.479748517f, 0.047766149f},
-std::array<float,2>{0.372541755f, 0.589315951f},
-std::array<float,2>{0.782927692f, 0.167697355f},
-std::array<float,2>{0.681681395f, 0.825432718f},
-std::array<float,2>{0.161508337f, 0.286973685f},
-std::array<float,2>{0.012808782f, 0.531647563f},
-std::array<float,2>{0.57851547f, 0.207383946f},
-std::array<float,2>{0.902691007f, 0.783924043f},
-std::array<float,2>{0.428112447f, 0.337566376f},
-std::array<float,2>{0.287128448f, 0.940850914f},
-std::array<float,2>{0.848565221f, 0.422269344f},
-std::array<float,2>{0.730322659f, 0.749267459f},
-std::array<float,2>{0.218291819f, 0.118746497f},
-std::array<float,2>{0.141668886f, 0.85923326f},
-std::array<float,2>{0.63157773f, 0.254439265f},
-std::array<float,2>{0.769042969f, 0.614563584f},
-std::array<float,2>{0.334271163f, 0.145238951f},
-std::array<float,2>{0.463056386f, 0.648429632f},
-std::array<float,2>{0.961872518f, 0.0141900396f},
-std::array<float,2>{0.528429806f, 0.896761298f},
-std::array<float,2>{0.106549308f, 0.475235641f},
-std::array<float,2>{0.222667605f, 0.585800827f},
-std::array<float,2>{0.700938344f, 0.162586764f},
-std::array<float,2>{0.835893631f, 0.815179884f},
-std::array<float,2>{0.279152304f, 0.293075383f},
-std::array<float,2>{0.387717396f, 0.932654738f},
-std::array<float,2>{0.936179817f, 0.457048893f},
-std::array<float,2>{0.599989712f, 0.662250996f},
-std::array<float,2>{0.0590150096f, 0.06054575f},
-std::array<float,2>{0.0686284378f, 0.771246731f},
-std::array<float,2>{0.538580477f, 0.368171334f},
-std::array<float,2>{0.970314741f, 0.531054497f},
-std::array<float,2>{0.48712185f, 0.241978616f},
-std::array<float,2>{0.352633893f, 0.708591998f},
-std::array<float,2>{0.810389578f, 0.0900408998f},
-std::array<float,2>{0.666279495f, 0.977934361f},
-std::array<float,2>{0.1814363f, 0.379819304f},
-std::array<float,2>{0.0180649348f, 0.653801918f},
-std::array<float,2>{0.567819715f, 0.00171784149f},
-std::array<float,2>{0.887945533f, 0.900595248f},
-std::array<float,2>{0.420258373f, 0.478840858f},
-std::array<float,2>{0.312022686f, 0.851409435f},
-std::array<float,2>{0.864723444f, 0.259238064f},
-std::array<float,2>{0.748454571f, 0.623761237f},
-std::array<float,2>{0.200237915f, 0.151371613f},
-std::array<float,2>{0.130420297f, 0.951069415f},
-std::array<float,2>{0.648870051f, 0.432045192f},
-std::array<float,2>{0.762739897f, 0.734420598f},
-std::array<float,2>{0.313248485f, 0.111280113f},
-std::array<float,2>{0.438474685f, 0.539828956f},
-std::array<float,2>{0.940042317f, 0.218246996f},
-std::array<float,2>{0.512433469f, 0.793337464f},
-std::array<float,2>{0.11862091f, 0.334516972f},
-std::array<float,2>{0.159360409f, 0.733822763f},
-std::array<float,2>{0.683676243f, 0.107124135f},
-std::array<float,2>{0.785223246f, 0.968060315f},
-std::array<float,2>{0.367194921f, 0.420915961f},
-std::array<float,2>{0.481925339f, 0.81135565f},
-std::array<float,2>{0.997003853f, 0.322444022f},
-std::array<float,2>{0.557295382f, 0.555552423f},
-std::array<float,2>{0.0885218009f, 0.20244348f},
-std::array<float,2>{0.0374053754f, 0.885773301f},
-std::array<float,2>{0.621959925f, 0.48522827f},
-std::array<float,2>{0.920381367f, 0.639857173f},
-std::array<float,2>{0.405569196f, 0.0229837243f},
-std::array<float,2>{0.251513392f, 0.600685954f},
-std::array<float,2>{0.822755635f, 0.133369491f},
-std::array<float,2>{0.711060345f, 0.86089617f},
-std::array<float,2>{0.243382707f, 0.27957508f},
-std::array<float,2>{0.104970038f, 0.511853218f},
-std::array<float,2>{0.525859177f, 0.218942896f},
-std::array<float,2>{0.967423379f, 0.762102783f},
-std::array<float,2>{0.467570186f, 0.35801813f},
-std::array<float,2>{0.330840558f, 0.985187113f},
-std::array<float,2>{0.772665918f, 0.40326041f},
-std::array<float,2>{0.62604475f, 0.697646976f},
-std::array<float,2>{0.14789696f, 0.0665660053f},
-std::array<float,2>{0.211003914f, 0.829377055f},
-std::array<float,2>{0.731225789f, 0.306655794f},
-std::array<float,2>{0.845010459f, 0.571110427f},
-std::array<float,2>{0.283096373f, 0.175458997f},
-std::array<float,2>{0.424229026f, 0.686432779f},
-std::array<float,2>{0.89900142f, 0.04640764f},
-std::array<float,2>{0.584806502f, 0.912575364f},
-std::array<float,2>{0.0114966528f, 0.45168066f},
-std::array<float,2>{0.151638091f, 0.550497472f},
-std::array<float,2>{0.635317087f, 0.194580644f},
-std::array<float,2>{0.7767241f, 0.804136395f},
-std::array<float,2>{0.338186741f, 0.316902727f},
-std::array<float,2>{0.455749422f, 0.960745871f},
-std::array<float,2>{0.95726949f, 0.411485285f},
-std::array<float,2>{0.516913593f, 0.718929172f},
-std::array<float,2>{0.0990513191f, 0.100061655f},
-std::array<float,2>{0.00297967764f, 0.872189879f},
-std::array<float,2>{0.590428829f, 0.268843263f},
-std::array<float,2>{0.894740224f, 0.602016687f},
-std::array<float,2>{0.433120251f, 0.127397552f},
-std::array<float,2>{0.29624179f, 0.625433922f},
-std::array<float,2>{0.858975887f, 0.0234923232f},
-std::array<float,2>{0.724797964f, 0.879372001f},
-std::array<float,2>{0.20469974f, 0.493772089f},
-std::array<float,2>{0.0820176378f, 0.690936625f},
-std::array<float,2>{0.550852597f, 0.0705886856f},
-std::array<float,2>{0.984613061f, 0.995319366f},
-std::array<float,2>{0.470012754f, 0.391857326f},
-std::array<float,2>{0.36175552f, 0.754047215f},
-std::array<float,2>{0.795840144f, 0.351210147f},
-std::array<float,2>{0.673097074f, 0.50774622f},
-std::array<float,2>{0.16990599f, 0.22835958f},
-std::array<float,2>{0.237138197f, 0.919052243f},
-std::array<float,2>{0.709767342f, 0.439173967f},
-std::array<float,2>{0.818635464f, 0.678902566f},
-std::array<float,2>{0.259621084f, 0.0360069945f},
-std::array<float,2>{0.394031644f, 0.568214715f},
-std::array<float,2>{0.91001761f, 0.181377858f},
-std::array<float,2>{0.613122106f, 0.837978721f},
-std::array<float,2>{0.0445858426f, 0.298204124f},
-std::array<float,2>{0.189981103f, 0.670152605f},
-std::array<float,2>{0.737569511f, 0.051750645f},
-std::array<float,2>{0.874021411f, 0.925460696f},
-std::array<float,2>{0.299919575f, 0.46472156f},
-std::array<float,2>{0.410875708f, 0.824103594f},
-std::array<float,2>{0.880444646f, 0.284496844f},
-std::array<float,2>{0.577748477f, 0.591192842f},
-std::array<float,2>{0.0247542411f, 0.168340147f},
-std::array<float,2>{0.115307078f, 0.968766391f},
-std::array<float,2>{0.500291228f, 0.383890182f},
-std::array<float,2>{0.948771477f, 0.711521149f},
-std::array<float,2>{0.445608974f, 0.0850876272f},
-std::array<float,2>{0.321440727f, 0.516829491f},
-std::array<float,2>{0.75127703f, 0.24268122f},
-std::array<float,2>{0.647179067f, 0.778877735f},
-std::array<float,2>{0.134991273f, 0.362359971f},
-std::array<float,2>{0.0535444766f, 0.612551153f},
-std::array<float,2>{0.602251172f, 0.143268287f},
-std::array<float,2>{0.924368262f, 0.851845264f},
-std::array<float,2>{0.38042742f, 0.250765264f},
-std::array<float,2>{0.272708863f, 0.892530322f},
-std::array<float,2>{0.842249751f, 0.471815974f},
-std::array<float,2>{0.691373289f, 0.642729402f},
-std::array<float,2>{0.232937023f, 0.0108252987f},
-std::array<float,2>{0.173329011f, 0.787416816f},
-std::array<float,2>{0.661369085f, 0.34129855f},
-std::array<float,2>{0.798689067f, 0.535618842f},
-std::array<float,2>{0.344697893f, 0.203138351f},
-std::array<float,2>{0.499128014f, 0.74380064f},
-std::array<float,2>{0.977385044f, 0.123525746f},
-std::array<float,2>{0.54404974f, 0.942636669f},
-std::array<float,2>{0.0772321671f, 0.429301322f},
-std::array<float,2>{0.239508644f, 0.545840085f},
-std::array<float,2>{0.703570724f, 0.212554336f},
-std::array<float,2>{0.81468761f, 0.792591035f},
-std::array<float,2>{0.264463782f, 0.328635663f},
-std::array<float,2>{0.394804895f, 0.946333706f},
-std::array<float,2>{0.911245465f, 0.434632272f},
-std::array<float,2>{0.613565683f, 0.741062105f},
-std::array<float,2>{0.0423298851f, 0.115698002f},
-std::array<float,2>{0.0841396973f, 0.846499979f},
-std::array<float,2>{0.550553262f, 0.262152284f},
-std::array<float,2>{0.989135146f, 0.620842159f},
-std::array<float,2>{0.474814922f, 0.156231433f},
-std::array<float,2>{0.364413321f, 0.648972988f},
-std::array<float,2>{0.791213274f, 0.00404656446f},
-std::array<float,2>{0.676603317f, 0.906223595f},
-std::array<float,2>{0.164233059f, 0.482651085f},
-std::array<float,2>{0.00506594172f, 0.705651343f},
-std::array<float,2>{0.586615801f, 0.0889137015f},
-std::array<float,2>{0.891588748f, 0.981513083f},
-std::array<float,2>{0.433687717f, 0.378717601f},
-std::array<float,2>{0.292303562f, 0.765804946f},
-std::array<float,2>{0.851835847f, 0.374898463f},
-std::array<float,2>{0.720739007f, 0.523852229f},
-std::array<float,2>{0.21048373f, 0.235166818f},
-std::array<float,2>{0.155296981f, 0.933645248f},
-std::array<float,2>{0.63843441f, 0.454821408f},
-std::array<float,2>{0.780959904f, 0.658588767f},
-std::array<float,2>{0.340013057f, 0.0575172119f},
-std::array<float,2>{0.460714877f, 0.580652356f},
-std::array<float,2>{0.954149902f, 0.156722844f},
-std::array<float,2>{0.521670461f, 0.817679346f},
-std::array<float,2>{0.0950946584f, 0.29197365f},
-std::array<float,2>{0.177029014f, 0.680303633f},
-std::array<float,2>{0.656464696f, 0.0400463901f},
-std::array<float,2>{0.802502513f, 0.906879604f},
-std::array<float,2>{0.349120975f, 0.446747601f},
-std::array<float,2>{0.493748754f, 0.833530486f},
-std::array<float,2>{0.98098892f, 0.310329586f},
-std::array<float,2>{0.539671361f, 0.576062858f},
-std::array<float,2>{0.0713089332f, 0.17712158f},
-std::array<float,2>{0.0469159037f, 0.990393579f},
-std::array<float,2>{0.606775045f, 0.400763184f},
-std::array<float,2>{0.928922951f, 0.702254832f},
-std::array<float,2>{0.377914041f, 0.0633963421f},
-std::array<float,2>{0.269181669f, 0.508296132f},
-std::array<float,2>{0.839365542f, 0.223203674f},
-std::array<float,2>{0.692798376f, 0.759139717f},
-std::array<float,2>{0.228912741f, 0.35418129f},
-std::array<float,2>{0.111744463f, 0.59531951f},
-std::array<float,2>{0.50618279f, 0.137755007f},
-std::array<float,2>{0.952694476f, 0.863566995f},
-std::array<float,2>{0.451197296f, 0.276803404f},
-std::array<float,2>{0.326141059f, 0.888231277f},
-std::array<float,2>{0.753920972f, 0.491593301f},
-std::array<float,2>{0.64350003f, 0.635559559f},
-std::array<float,2>{0.136881128f, 0.0156923346f},
-std::array<float,2>{0.191970527f, 0.806805968f},
-std::array<float,2>{0.739643693f, 0.327779055f},
-std::array<float,2>{0.868235469f, 0.562066197f},
-std::array<float,2>{0.300983101f, 0.198201373f},
-std::array<float,2>{0.410093158f, 0.729042113f},
-std::array<float,2>{0.875700712f, 0.103162289f},
-std::array<float,2>{0.573588133f, 0.964485049f},
-std::array<float,2>{0.0285988729f, 0.415338606f},
-std::array<float,2>{0.128346965f, 0.564124167f},
-std::array<float,2>{0.654382706f, 0.185763881f},
-std::array<float,2>{0.759425223f, 0.842378318f},
-std::array<float,2>{0.318789452f, 0.304661542f},
-std::array<float,2>{0.444412291f, 0.917533875f},
-std::array<float,2>{0.945062935f, 0.444203198f},
-std::array<float,2>{0.509300113f, 0.674587607f},
-std::array<float,2>{0.121130295f, 0.0342724919f},
-std::array<float,2>{0.0201894678f, 0.751042366f},
-std::array<float,2>{0.562924206f, 0.343805283f},
-std::array<float,2>{0.884714901f, 0.503466189f},
-std::array<float,2>{0.414275199f, 0.233342752f},
-std::array<float,2>{0.305798948f, 0.694959879f},
-std::array<float,2>{0.862439871f, 0.0780860484f},
-std::array<float,2>{0.745020747f, 0.999094605f},
-std::array<float,2>{0.196639195f, 0.396516234f},
-std::array<float,2>{0.0662194267f, 0.629568994f},
-std::array<float,2>{0.532648563f, 0.0275137294f},
-std::array<float,2>{0.973285913f, 0.876087666f},
-std::array<float,2>{0.488444299f, 0.497531086f},
-std::array<float,2>{0.356230259f, 0.869708538f},
-std::array<float,2>{0.805041909f, 0.269688576f},
-std::array<float,2>{0.669475019f, 0.606425464f},
-std::array<float,2>{0.187268525f, 0.131870151f},
-std::array<float,2>{0.219001994f, 0.953144073f},
-std::array<float,2>{0.697209001f, 0.410002708f},
-std::array<float,2>{0.829405129f, 0.725537896f},
-std::array<float,2>{0.274522394f, 0.0954929441f},
-std::array<float,2>{0.382989883f, 0.551877379f},
-std::array<float,2>{0.93093437f, 0.190810949f},
-std::array<float,2>{0.597216189f, 0.797048032f},
-std::array<float,2>{0.0562601574f, 0.314792633f},
-std::array<float,2>{0.215326905f, 0.746126533f},
-std::array<float,2>{0.72840029f, 0.120276801f},
-std::array<float,2>{0.850361526f, 0.938567519f},
-std::array<float,2>{0.286445051f, 0.425356925f},
-std::array<float,2>{0.425890625f, 0.78210324f},
-std::array<float,2>{0.904795825f, 0.338288128f},
-std::array<float,2>{0.580156028f, 0.535125852f},
-std::array<float,2>{0.0146362558f, 0.210088313f},
-std::array<float,2>{0.10937392f, 0.896226823f},
-std::array<float,2>{0.530216992f, 0.473879457f},
-std::array<float,2>{0.963861942f, 0.645846426f},
-std::array<float,2>{0.462197185f, 0.0130983312f},
-std::array<float,2>{0.332762718f, 0.616391242f},
-std::array<float,2>{0.766195774f, 0.148342386f},
-std::array<float,2>{0.629410863f, 0.856268346f},
-std::array<float,2>{0.14262408f, 0.256705821f},
-std::array<float,2>{0.0334013253f, 0.520926476f},
-std::array<float,2>{0.62026751f, 0.249987677f},
-std::array<float,2>{0.917007208f, 0.777216256f},
-std::array<float,2>{0.399497181f, 0.364775956f},
-std::array<float,2>{0.255705625f, 0.974844575f},
-std::array<float,2>{0.828012109f, 0.387682915f},
-std::array<float,2>{0.716474712f, 0.7184425f},
-std::array<float,2>{0.246353701f, 0.0811111331f},
-std::array<float,2>{0.163081989f, 0.826768041f},
-std::array<float,2>{0.681348264f, 0.28788361f},
-std::array<float,2>{0.783214927f, 0.586471021f},
-std::array<float,2>{0.374129683f, 0.164517209f},
-std::array<float,2>{0.476792216f, 0.667048097f},
-std::array<float,2>{0.993485332f, 0.0500984415f},
-std::array<float,2>{0.559102476f, 0.928279102f},
-std::array<float,2>{0.0925687402f, 0.465886891f},
-std::array<float,2>{0.20294401f, 0.622412622f},
-std::array<float,2>{0.74763906f, 0.150135309f},
-std::array<float,2>{0.866000593f, 0.84945035f},
-std::array<float,2>{0.30884403f, 0.261201054f},
-std::array<float,2>{0.418907404f, 0.898479164f},
-std::array<float,2>{0.889338493f, 0.477302074f},
-std::array<float,2>{0.56897074f, 0.65476191f},
-std::array<float,2>{0.0175631922f, 0.00297101703f},
-std::array<float,2>{0.120126568f, 0.796188295f},
-std::array<float,2>{0.514894485f, 0.332569271f},
-std::array<float,2>{0.939361513f, 0.542580307f},
-std::array<float,2>{0.440369099f, 0.215685561f},
-std::array<float,2>{0.314569473f, 0.737606227f},
-std::array<float,2>{0.763846695f, 0.112468176f},
-std::array<float,2>{0.651588023f, 0.9515751f},
-std::array<float,2>{0.13242285f, 0.430279434f},
-std::array<float,2>{0.0616669282f, 0.660564721f},
-std::array<float,2>{0.599490225f, 0.0622741878f},
-std::array<float,2>{0.934897721f, 0.931025267f},
-std::array<float,2>{0.389205605f, 0.459715873f},
-std::array<float,2>{0.28029871f, 0.813000381f},
-std::array<float,2>{0.833741665f, 0.29646045f},
-std::array<float,2>{0.701324642f, 0.583821714f},
-std::array<float,2>{0.225235179f, 0.161754414f},
-std::array<float,2>{0.182552636f, 0.978843868f},
-std::array<float,2>{0.665660977f, 0.381501824f},
-std::array<float,2>{0.811189413f, 0.709093988f},
-std::array<float,2>{0.35520336f, 0.0927115828f},
-std::array<float,2>{0.486158103f, 0.528350294f},
-std::array<float,2>{0.971342146f, 0.239160687f},
-std::array<float,2>{0.536069989f, 0.772156477f},
-std::array<float,2>{0.0674564689f, 0.370843589f},
-std::array<float,2>{0.145555943f, 0.696412504f},
-std::array<float,2>{0.627762377f, 0.068439573f},
-std::array<float,2>{0.771202743f, 0.988235176f},
-std::array<float,2>{0.328768671f, 0.40493682f},
-std::array<float,2>{0.465024531f, 0.765305817f},
-std::array<float,2>{0.966242313f, 0.35564211f},
-std::array<float,2>{0.524005055f, 0.514677286f},
-std::array<float,2>{0.103289604f, 0.222535416f},
-std::array<float,2>{0.00855206512f, 0.911251485f},
-std::array<float,2>{0.582161486f, 0.450761974f},
-std::array<float,2>{0.901890516f, 0.683939755f},
-std::array<float,2>{0.42378062f, 0.0433360003f},
-std::array<float,2>{0.283724278f, 0.572687089f},
-std::array<float,2>{0.846419394f, 0.173317939f},
-std::array<float,2>{0.733405173f, 0.831918538f},
-std::array<float,2>{0.214618802f, 0.306297362f},
-std::array<float,2>{0.086182408f, 0.557198763f},
-std::array<float,2>{0.556369483f, 0.19987835f},
-std::array<float,2>{0.998146653f, 0.808621824f},
-std::array<float,2>{0.482777685f, 0.322135806f},
-std::array<float,2>{0.370088845f, 0.96519208f},
-std::array<float,2>{0.787677705f, 0.419567198f},
-std::array<float,2>{0.685994565f, 0.731208026f},
-std::array<float,2>{0.156307384f, 0.107643306f},
-std::array<float,2>{0.244854003f, 0.862063706f},
-std::array<float,2>{0.714204669f, 0.278930873f},
-std::array<float,2>{0.820561171f, 0.5991925f},
-std::array<float,2>{0.2534796f, 0.135537311f},
-std::array<float,2>{0.403174728f, 0.638030052f},
-std::array<float,2>{0.919625461f, 0.0197377149f},
-std::array<float,2>{0.623212814f, 0.883075297f},
-std::array<float,2>{0.0357399657f, 0.48726216f},
-std::array<float,2>{0.170779616f, 0.504761398f},
-std::array<float,2>{0.673875093f, 0.228632718f},
-std::array<float,2>{0.793032825f, 0.756915808f},
-std::array<float,2>{0.359571308f, 0.348829985f},
-std::array<float,2>{0.471873105f, 0.992515028f},
-std::array<float,2>{0.986792266f, 0.393547475f},
-std::array<float,2>{0.554583609f, 0.68810612f},
-std::array<float,2>{0.0784698054f, 0.0730499402f},
-std::array<float,2>{0.0451831855f, 0.837732077f},
-std::array<float,2>{0.611156046f, 0.299091399f},
-std::array<float,2>{0.907412887f, 0.568452895f},
-std::array<float,2>{0.391198963f, 0.183346704f},
-std::array<float,2>{0.261266589f, 0.677642107f},
-std::array<float,2>{0.816849291f, 0.0374121182f},
-std::array<float,2>{0.707521737f, 0.921540916f},
-std::array<float,2>{0.235270992f, 0.440979153f},
-std::array<float,2>{0.101388447f, 0.72262305f},
-std::array<float,2>{0.518565893f, 0.0985268801f},
-std::array<float,2>{0.959108472f, 0.957230091f},
-std::array<float,2>{0.454170823f, 0.412243217f},
-std::array<float,2>{0.337301791f, 0.802404702f},
-std::array<float,2>{0.774030685f, 0.319498509f},
-std::array<float,2>{0.634042025f, 0.547918737f},
-std::array<float,2>{0.150001287f, 0.192155346f},
-std::array<float,2>{0.205975473f, 0.881488383f},
-std::array<float,2>{0.723240197f, 0.496004581f},
-std::array<float,2>{0.855817735f, 0.627987802f},
-std::array<float,2>{0.293333769f, 0.0259203389f},
-std::array<float,2>{0.431496352f, 0.605328023f},
-std::array<float,2>{0.896710277f, 0.126862571f},
-std::array<float,2>{0.59221977f, 0.873223662f},
-std::array<float,2>{0.00166716077f, 0.26637128f},
-std::array<float,2>{0.231333822f, 0.641436756f},
-std::array<float,2>{0.687776029f, 0.00882327929f},
-std::array<float,2>{0.840713859f, 0.894326568f},
-std::array<float,2>{0.271403611f, 0.470077276f},
-std::array<float,2>{0.382194549f, 0.853583217f},
-std::array<float,2>{0.922661483f, 0.252836823f},
-std::array<float,2>{0.603828013f, 0.610790133f},
-std::array<float,2>{0.0510772355f, 0.142362505f},
-std::array<float,2>{0.0755702183f, 0.944640338f},
-std::array<float,2>{0.545095682f, 0.427721858f},
-std::array<float,2>{0.978672743f, 0.745820165f},
-std::array<float,2>{0.496096432f, 0.121839225f},
-std::array<float,2>{0.347262412f, 0.53748399f},
-std::array<float,2>{0.800763249f, 0.206161186f},
-std::array<float,2>{0.663892508f, 0.786736071f},
-std::array<float,2>{0.174008355f, 0.342738152f},
-std::array<float,2>{0.0258520134f, 0.592598915f},
-std::array<float,2>{0.575208485f, 0.170499548f},
-std::array<float,2>{0.882564783f, 0.8208341f},
-std::array<float,2>{0.413790971f, 0.281351268f},
-std::array<float,2>{0.297393978f, 0.922513127f},
-std::array<float,2>{0.873009801f, 0.461023867f},
-std::array<float,2>{0.734503984f, 0.668478072f},
-std::array<float,2>{0.188387468f, 0.054442402f},
-std::array<float,2>{0.13327302f, 0.781184018f},
-std::array<float,2>{0.646200061f, 0.359622657f},
-std::array<float,2>{0.752137125f, 0.518191934f},
-std::array<float,2>{0.32286796f, 0.245742887f},
-std::array<float,2>{0.448731065f, 0.713738084f},
-std::array<float,2>{0.946291268f, 0.0833533928f},
-std::array<float,2>{0.503233492f, 0.971186101f},
-std::array<float,2>{0.114111751f, 0.385508716f},
-std::array<float,2>{0.225739062f, 0.530927837f},
-std::array<float,2>{0.702477396f, 0.241817251f},
-std::array<float,2>{0.832939386f, 0.771221519f},
-std::array<float,2>{0.280245602f, 0.368574083f},
-std::array<float,2>{0.390148789f, 0.977554321f},
-std::array<float,2>{0.934189737f, 0.379594535f},
-std::array<float,2>{0.597904384f, 0.708800435f},
-std::array<float,2>{0.0610131137f, 0.0901311338f},
-std::array<float,2>{0.0673378557f, 0.815320492f},
-std::array<float,2>{0.536252439f, 0.293323517f},
-std::array<float,2>{0.972631276f, 0.585640848f},
-std::array<float,2>{0.485323519f, 0.162347883f},
-std::array<float,2>{0.354224205f, 0.662518263f},
-std::array<float,2>{0.811523795f, 0.0602892451f},
-std::array<float,2>{0.664737642f, 0.93303746f},
-std::array<float,2>{0.183323354f, 0.45748809f},
-std::array<float,2>{0.0160136465f, 0.734826982f},
-std::array<float,2>{0.569690704f, 0.110896654f},
-std::array<float,2>{0.890066266f, 0.950688422f},
-std::array<float,2>{0.41946426f, 0.431682527f},
-std::array<float,2>{0.309739739f, 0.793118477f},
-std::array<float,2>{0.86717248f, 0.3349078f},
-std::array<float,2>{0.746894717f, 0.539722264f},
-std::array<float,2>{0.202013284f, 0.217982903f},
-std::array<float,2>{0.130886212f, 0.900722623f},
-std::array<float,2>{0.650597155f, 0.478644103f},
-std::array<float,2>{0.765181065f, 0.653403401f},
-std::array<float,2>{0.316057593f, 0.00157107983f},
-std::array<float,2>{0.441352874f, 0.623949051f},
-std::array<float,2>{0.937906563f, 0.151662603f},
-std::array<float,2>{0.513906181f, 0.851171911f},
-std::array<float,2>{0.119468801f, 0.25889039f},
-std::array<float,2>{0.157513067f, 0.640103102f},
-std::array<float,2>{0.687311292f, 0.023229558f},
-std::array<float,2>{0.788548052f, 0.886037886f},
-std::array<float,2>{0.370276064f, 0.48488158f},
-std::array<float,2>{0.484263927f, 0.861146331f},
-std::array<float,2>{0.999599993f, 0.279474914f},
-std::array<float,2>{0.555347502f, 0.600830734f},
-std::array<float,2>{0.0873253569f, 0.133685559f},
-std::array<float,2>{0.0361627191f, 0.967787921f},
-std::array<float,2>{0.624958336f, 0.421164006f},
-std::array<float,2>{0.91833967f, 0.733439863f},
-std::array<float,2>{0.403600991f, 0.107244387f},
-std::array<float,2>{0.252122343f, 0.555301309f},
-std::array<float,2>{0.821822703f, 0.202308238f},
-std::array<float,2>{0.713251889f, 0.811060607f},
-std::array<float,2>{0.245614856f, 0.322622746f},
-std::array<float,2>{0.101945631f, 0.570833445f},
-std::array<float,2>{0.524771333f, 0.17557846f},
-std::array<float,2>{0.964971364f, 0.829119742f},
-std::array<float,2>{0.465985984f, 0.307119608f},
-std::array<float,2>{0.329496443f, 0.912215054f},
-std::array<float,2>{0.769963264f, 0.45193997f},
-std::array<float,2>{0.628867507f, 0.686081648f},
-std::array<float,2>{0.145196214f, 0.046649605f},
-std::array<float,2>{0.213064447f, 0.761887729f},
-std::array<float,2>{0.732707739f, 0.358325571f},
-std::array<float,2>{0.847278297f, 0.511998057f},
-std::array<float,2>{0.284997255f, 0.219236463f},
-std::array<float,2>{0.422843099f, 0.697411895f},
-std::array<float,2>{0.90118444f, 0.0667616129f},
-std::array<float,2>{0.583030045f, 0.984993458f},
-std::array<float,2>{0.00893254392f, 0.402983487f},
-std::array<float,2>{0.148588583f, 0.601698399f},
-std::array<float,2>{0.633376956f, 0.127031371f},
-std::array<float,2>{0.774903834f, 0.872503161f},
-std::array<float,2>{0.336526692f, 0.268611103f},
-std::array<float,2>{0.453799933f, 0.87905705f},
-std::array<float,2>{0.96065259f, 0.4939605f},
-std::array<float,2>{0.518086374f, 0.625237823f},
-std::array<float,2>{0.0997471884f, 0.0238065738f},
-std::array<float,2>{0.00063880271f, 0.803800583f},
-std::array<float,2>{0.592842698f, 0.317239285f},
-std::array<float,2>{0.898028791f, 0.550719321f},
-std::array<float,2>{0.429926395f, 0.194498345f},
-std::array<float,2>{0.294655234f, 0.719124973f},
-std::array<float,2>{0.856710255f, 0.0997693762f},
-std::array<float,2>{0.724396884f, 0.96055311f},
-std::array<float,2>{0.206452146f, 0.411227524f},
-std::array<float,2>{0.0795500651f, 0.679001093f},
-std::array<float,2>{0.553624511f, 0.0358652771f},
-std::array<float,2>{0.987410009f, 0.919393122f},
-std::array<float,2>{0.47135374f, 0.439423501f},
-std::array<float,2>{0.360885024f, 0.838217616f},
-std::array<float,2>{0.794139445f, 0.298014432f},
-std::array<float,2>{0.675006688f, 0.568053424f},
-std::array<float,2>{0.171437874f, 0.18155168f},
-std::array<float,2>{0.2362912f, 0.995542288f},
-std::array<float,2>{0.708067119f, 0.391822428f},
-std::array<float,2>{0.817415357f, 0.691294014f},
-std::array<float,2>{0.260055453f, 0.0704219937f},
-std::array<float,2>{0.39179796f, 0.507448494f},
-std::array<float,2>{0.90675956f, 0.228247926f},
-std::array<float,2>{0.610003591f, 0.754163027f},
-std::array<float,2>{0.0467627235f, 0.351344407f},
-std::array<float,2>{0.189425021f, 0.711901844f},
-std::array<float,2>{0.736132681f, 0.0854256749f},
-std::array<float,2>{0.871919036f, 0.969136059f},
-std::array<float,2>{0.298492014f, 0.384186506f},
-std::array<float,2>{0.412790269f, 0.779236436f},
-std::array<float,2>{0.880949259f, 0.362569809f},
-std::array<float,2>{0.574857712f, 0.516946077f},
-std::array<float,2>{0.0267521217f, 0.24311167f},
-std::array<float,2>{0.114968441f, 0.925681651f},
-std::array<float,2>{0.502067327f, 0.464461833f},
-std::array<float,2>{0.946042717f, 0.670210063f},
-std::array<float,2>{0.447514981f, 0.051456593f},
-std::array<float,2>{0.323600322f, 0.590999782f},
-std::array<float,2>{0.753028452f, 0.168160424f},
-std::array<float,2>{0.644532561f, 0.823941469f},
-std::array<float,2>{0.134494156f, 0.284193188f},
-std::array<float,2>{0.0518140979f, 0.53525883f},
-std::array<float,2>{0.60544461f, 0.203468308f},
-std::array<float,2>{0.923228264f, 0.787185133f},
-std::array<float,2>{0.38086915f, 0.340925694f},
-std::array<float,2>{0.270224929f, 0.942553282f},
-std::array<float,2>{0.840945065f, 0.429634571f},
-std::array<float,2>{0.689071059f, 0.744050086f},
-std::array<float,2>{0.231756166f, 0.123169117f},
-std::array<float,2>{0.174955234f, 0.8517766f},
-std::array<float,2>{0.663069308f, 0.250517011f},
-std::array<float,2>{0.79887265f, 0.612386942f},
-std::array<float,2>{0.346170545f, 0.143455356f},
-std::array<float,2>{0.497505367f, 0.642913342f},
-std::array<float,2>{0.979704201f, 0.011053497f},
-std::array<float,2>{0.546339393f, 0.892303705f},
-std::array<float,2>{0.0747051835f, 0.472059906f},
-std::array<float,2>{0.209081009f, 0.57960248f},
-std::array<float,2>{0.722224355f, 0.15963538f},
-std::array<float,2>{0.852981567f, 0.818870962f},
-std::array<float,2>{0.291377962f, 0.290694565f},
-std::array<float,2>{0.435207963f, 0.93570298f},
-std::array<float,2>{0.892080903f, 0.455935419f},
-std::array<float,2>{0.587163091f, 0.658112407f},
-std::array<float,2>{0.0045004678f, 0.0563569032f},
-std::array<float,2>{0.0945984349f, 0.768951058f},
-std::array<float,2>{0.523134112f, 0.372545093f},
-std::array<float,2>{0.953285396f, 0.52578634f},
-std::array<float,2>{0.458997518f, 0.23746033f},
-std::array<float,2>{0.341197222f, 0.703956962f},
-std::array<float,2>{0.779546976f, 0.086884819f},
-std::array<float,2>{0.637530208f, 0.98328042f},
-std::array<float,2>{0.154390499f, 0.376436204f},
-std::array<float,2>{0.0414424688f, 0.650620401f},
-std::array<float,2>{0.614524126f, 0.00647376338f},
-std::array<float,2>{0.911095798f, 0.903861105f},
-std::array<float,2>{0.396192074f, 0.481482923f},
-std::array<float,2>{0.265181124f, 0.843818605f},
-std::array<float,2>{0.816188097f, 0.26488024f},
-std::array<float,2>{0.704221368f, 0.618651032f},
-std::array<float,2>{0.238826126f, 0.152626738f},
-std::array<float,2>{0.165404886f, 0.948991776f},
-std::array<float,2>{0.677525997f, 0.436728984f},
-std::array<float,2>{0.792244315f, 0.739117801f},
-std::array<float,2>{0.363431901f, 0.113747291f},
-std::array<float,2>{0.476003259f, 0.544515312f},
-std::array<float,2>{0.990079939f, 0.21474278f},
-std::array<float,2>{0.549314618f, 0.789885402f},
-std::array<float,2>{0.0856591165f, 0.331178129f},
-std::array<float,2>{0.137748301f, 0.727189004f},
-std::array<float,2>{0.643861532f, 0.104508296f},
-std::array<float,2>{0.755073488f, 0.961687028f},
-std::array<float,2>{0.324750781f, 0.416077673f},
-std::array<float,2>{0.452588558f, 0.804968357f},
-std::array<float,2>{0.951727569f, 0.32505241f},
-std::array<float,2>{0.507713914f, 0.558843255f},
-std::array<float,2>{0.112488918f, 0.197110757f},
-std::array<float,2>{0.0281762928f, 0.889958799f},
-std::array<float,2>{0.572798491f, 0.48857519f},
-std::array<float,2>{0.876680851f, 0.633655846f},
-std::array<float,2>{0.408587456f, 0.0187550634f},
-std::array<float,2>{0.302581877f, 0.597468197f},
-std::array<float,2>{0.868040085f, 0.13949202f},
-std::array<float,2>{0.738633513f, 0.86551851f},
-std::array<float,2>{0.193228692f, 0.275006264f},
-std::array<float,2>{0.0709939077f, 0.510663927f},
-std::array<float,2>{0.540124714f, 0.225597978f},
-std::array<float,2>{0.982086957f, 0.760103226f},
-std::array<float,2>{0.492790103f, 0.352296889f},
-std::array<float,2>{0.348534495f, 0.99009645f},
-std::array<float,2>{0.80105561f, 0.399683058f},
-std::array<float,2>{0.65762341f, 0.700124741f},
-std::array<float,2>{0.176463142f, 0.0653044507f},
-std::array<float,2>{0.229943871f, 0.835252583f},
-std::array<float,2>{0.692026496f, 0.311612248f},
-std::array<float,2>{0.838780642f, 0.578084111f},
-std::array<float,2>{0.268507242f, 0.178228959f},
-std::array<float,2>{0.378574699f, 0.681669652f},
-std::array<float,2>{0.92778188f, 0.0427650884f},
-std::array<float,2>{0.605539799f, 0.908457458f},
-std::array<float,2>{0.048746258f, 0.448168337f},
-std::array<float,2>{0.18636857f, 0.553000808f},
-std::array<float,2>{0.668339431f, 0.189290777f},
-std::array<float,2>{0.806584358f, 0.799962521f},
-std::array<float,2>{0.357137382f, 0.313894153f},
-std::array<float,2>{0.490198344f, 0.956847548f},
-std::array<float,2>{0.973961592f, 0.407489508f},
-std::array<float,2>{0.53219533f, 0.723863125f},
-std::array<float,2>{0.0649706945f, 0.0971271172f},
-std::array<float,2>{0.055419419f, 0.867507994f},
-std::array<float,2>{0.596584499f, 0.272337198f},
-std::array<float,2>{0.930235565f, 0.609077096f},
-std::array<float,2>{0.384381294f, 0.130831584f},
-std::array<float,2>{0.273849905f, 0.631413579f},
-std::array<float,2>{0.828173161f, 0.029530352f},
-std::array<float,2>{0.696053445f, 0.877666175f},
-std::array<float,2>{0.220428705f, 0.498499751f},
-std::array<float,2>{0.122784175f, 0.692786515f},
-std::array<float,2>{0.508267999f, 0.0752097815f},
-std::array<float,2>{0.943947613f, 0.996675372f},
-std::array<float,2>{0.443383455f, 0.395626158f},
-std::array<float,2>{0.320068955f, 0.751962245f},
-std::array<float,2>{0.758017361f, 0.347133636f},
-std::array<float,2>{0.656237602f, 0.501402736f},
-std::array<float,2>{0.127420351f, 0.23138167f},
-std::array<float,2>{0.195668668f, 0.915216148f},
-std::array<float,2>{0.745656908f, 0.443331838f},
-std::array<float,2>{0.861714065f, 0.672129989f},
-std::array<float,2>{0.305469066f, 0.0315886289f},
-std::array<float,2>{0.415654451f, 0.565492332f},
-std::array<float,2>{0.883590162f, 0.184047431f},
-std::array<float,2>{0.564181209f, 0.84015727f},
-std::array<float,2>{0.0207112227f, 0.300908178f},
-std::array<float,2>{0.247145817f, 0.664317071f},
-std::array<float,2>{0.715558946f, 0.0474690087f},
-std::array<float,2>{0.826328993f, 0.927169085f},
-std::array<float,2>{0.254845619f, 0.46769315f},
-std::array<float,2>{0.398451477f, 0.825555861f},
-std::array<float,2>{0.916916668f, 0.286669642f},
-std::array<float,2>{0.619442642f, 0.589098394f},
-std::array<float,2>{0.0347454138f, 0.167778507f},
-std::array<float,2>{0.0930538028f, 0.974324822f},
-std::array<float,2>{0.559785664f, 0.389137179f},
-std::array<float,2>{0.992240727f, 0.716231346f},
-std::array<float,2>{0.478082418f, 0.0799843669f},
-std::array<float,2>{0.373682648f, 0.521953285f},
-std::array<float,2>{0.784624875f, 0.247226179f},
-std::array<float,2>{0.680112898f, 0.774050474f},
-std::array<float,2>{0.163561687f, 0.367051035f},
-std::array<float,2>{0.0147203989f, 0.61427629f},
-std::array<float,2>{0.581394076f, 0.145323589f},
-std::array<float,2>{0.905443728f, 0.859089375f},
-std::array<float,2>{0.426873624f, 0.254681885f},
-std::array<float,2>{0.285490513f, 0.896500885f},
-std::array<float,2>{0.850898504f, 0.475465208f},
-std::array<float,2>{0.72709769f, 0.648137212f},
-std::array<float,2>{0.216784388f, 0.014467556f},
-std::array<float,2>{0.143645003f, 0.784083188f},
-std::array<float,2>{0.629999697f, 0.337728351f},
-std::array<float,2>{0.766860008f, 0.531255782f},
-std::array<float,2>{0.33368507f, 0.20725596f},
-std::array<float,2>{0.461310863f, 0.749269962f},
-std::array<float,2>{0.964318931f, 0.119135857f},
-std::array<float,2>{0.530617118f, 0.940481365f},
-std::array<float,2>{0.1077298f, 0.422061622f},
-std::array<float,2>{0.199560761f, 0.542874396f},
-std::array<float,2>{0.749193251f, 0.215440303f},
-std::array<float,2>{0.864139438f, 0.795900106f},
-std::array<float,2>{0.311496347f, 0.332960904f},
-std::array<float,2>{0.421710521f, 0.951264739f},
-std::array<float,2>{0.886835873f, 0.430454284f},
-std::array<float,2>{0.566967368f, 0.737478793f},
-std::array<float,2>{0.0194265768f, 0.112551041f},
-std::array<float,2>{0.117695883f, 0.84921515f},
-std::array<float,2>{0.513255954f, 0.260971576f},
-std::array<float,2>{0.940733969f, 0.622264445f},
-std::array<float,2>{0.439421952f, 0.150212586f},
-std::array<float,2>{0.313970596f, 0.654354095f},
-std::array<float,2>{0.761766613f, 0.00323411566f},
-std::array<float,2>{0.650382161f, 0.898686469f},
-std::array<float,2>{0.129155248f, 0.477202743f},
-std::array<float,2>{0.0605248176f, 0.709440172f},
-std::array<float,2>{0.601046264f, 0.0925204381f},
-std::array<float,2>{0.936962008f, 0.978681028f},
-std::array<float,2>{0.386984706f, 0.38179183f},
-std::array<float,2>{0.277524084f, 0.77240026f},
-std::array<float,2>{0.834865272f, 0.371013373f},
-std::array<float,2>{0.69934994f, 0.528690159f},
-std::array<float,2>{0.224316522f, 0.238850623f},
-std::array<float,2>{0.179826736f, 0.930701017f},
-std::array<float,2>{0.667136967f, 0.45985654f},
-std::array<float,2>{0.808695376f, 0.660163105f},
-std::array<float,2>{0.35232687f, 0.0620193854f},
-std::array<float,2>{0.487356603f, 0.583636284f},
-std::array<float,2>{0.969718158f, 0.161912322f},
-std::array<float,2>{0.537813962f, 0.813244641f},
-std::array<float,2>{0.06989564f, 0.296743572f},
-std::array<float,2>{0.146570429f, 0.683622479f},
-std::array<float,2>{0.625801027f, 0.043023508f},
-std::array<float,2>{0.772417545f, 0.911619544f},
-std::array<float,2>{0.331285298f, 0.451119065f},
-std::array<float,2>{0.468586743f, 0.831667781f},
-std::array<float,2>{0.967780173f, 0.306501687f},
-std::array<float,2>{0.526963115f, 0.57242322f},
-std::array<float,2>{0.103597246f, 0.173026249f},
-std::array<float,2>{0.0100663388f, 0.987959027f},
-std::array<float,2>{0.584995389f, 0.40513891f},
-std::array<float,2>{0.899727821f, 0.696721852f},
-std::array<float,2>{0.42524609f, 0.0686263815f},
-std::array<float,2>{0.282134295f, 0.515046418f},
-std::array<float,2>{0.844645619f, 0.222363085f},
-std::array<float,2>{0.732193649f, 0.765564024f},
-std::array<float,2>{0.212797299f, 0.355912596f},
-std::array<float,2>{0.0897957832f, 0.5993976f},
-std::array<float,2>{0.558461666f, 0.135335669f},
-std::array<float,2>{0.997619331f, 0.86183399f},
-std::array<float,2>{0.480608582f, 0.279136777f},
-std::array<float,2>{0.368614435f, 0.882816195f},
-std::array<float,2>{0.786633134f, 0.486984491f},
-std::array<float,2>{0.685108542f, 0.637867749f},
-std::array<float,2>{0.158241376f, 0.0199317634f},
-std::array<float,2>{0.242712095f, 0.809081674f},
-std::array<float,2>{0.712149024f, 0.321967065f},
-std::array<float,2>{0.824008882f, 0.557395101f},
-std::array<float,2>{0.25045833f, 0.200038031f},
-std::array<float,2>{0.405018628f, 0.731008291f},
-std::array<float,2>{0.921783507f, 0.10778854f},
-std::array<float,2>{0.62248683f, 0.964991093f},
-std::array<float,2>{0.0386494622f, 0.419743359f},
-std::array<float,2>{0.168572873f, 0.568761766f},
-std::array<float,2>{0.672497272f, 0.183448792f},
-std::array<float,2>{0.796707273f, 0.837419033f},
-std::array<float,2>{0.362667352f, 0.298866481f},
-std::array<float,2>{0.469006568f, 0.9217785f},
-std::array<float,2>{0.986167192f, 0.441371441f},
-std::array<float,2>{0.552031636f, 0.677288651f},
-std::array<float,2>{0.0801444948f, 0.0373143107f},
-std::array<float,2>{0.043189358f, 0.757155001f},
-std::array<float,2>{0.612230778f, 0.348968625f},
-std::array<float,2>{0.908559799f, 0.504612386f},
-std::array<float,2>{0.392857224f, 0.228884891f},
-std::array<float,2>{0.257826835f, 0.688395381f},
-std::array<float,2>{0.819613457f, 0.0728683472f},
-std::array<float,2>{0.710862875f, 0.992385209f},
-std::array<float,2>{0.237609714f, 0.393152773f},
-std::array<float,2>{0.0977732465f, 0.628381252f},
-std::array<float,2>{0.516456783f, 0.0261984132f},
-std::array<float,2>{0.958069086f, 0.881706953f},
-std::array<float,2>{0.457015216f, 0.495770305f},
-std::array<float,2>{0.339157254f, 0.873364508f},
-std::array<float,2>{0.775566816f, 0.266130239f},
-std::array<float,2>{0.635783434f, 0.605089366f},
-std::array<float,2>{0.151005179f, 0.126690775f},
-std::array<float,2>{0.203670859f, 0.957426429f},
-std::array<float,2>{0.726290524f, 0.412431777f},
-std::array<float,2>{0.85783273f, 0.722386897f},
-std::array<float,2>{0.295498103f, 0.0982115269f},
-std::array<float,2>{0.432393372f, 0.548263788f},
-std::array<float,2>{0.895724893f, 0.192117006f},
-std::array<float,2>{0.591792703f, 0.802686334f},
-std::array<float,2>{0.00282136397f, 0.319808394f},
-std::array<float,2>{0.233560175f, 0.74596405f},
-std::array<float,2>{0.689925313f, 0.121711411f},
-std::array<float,2>{0.843101144f, 0.944370508f},
-std::array<float,2>{0.272014856f, 0.427405685f},
-std::array<float,2>{0.37953189f, 0.786903203f},
-std::array<float,2>{0.925641656f, 0.342424214f},
-std::array<float,2>{0.603288114f, 0.537242413f},
-std::array<float,2>{0.0539647005f, 0.206361651f},
-std::array<float,2>{0.0771074221f, 0.894206166f},
-std::array<float,2>{0.543687284f, 0.469855756f},
-std::array<float,2>{0.977665305f, 0.641327024f},
-std::array<float,2>{0.498363405f, 0.00906587858f},
-std::array<float,2>{0.345524698f, 0.610561907f},
-std::array<float,2>{0.797049582f, 0.142229721f},
-std::array<float,2>{0.661051929f, 0.853778839f},
-std::array<float,2>{0.172015876f, 0.252653897f},
-std::array<float,2>{0.0237084627f, 0.51843214f},
-std::array<float,2>{0.576981544f, 0.246010914f},
-std::array<float,2>{0.879336298f, 0.780866742f},
-std::array<float,2>{0.411489278f, 0.35958305f},
-std::array<float,2>{0.299394339f, 0.970796764f},
-std::array<float,2>{0.874945819f, 0.385419816f},
-std::array<float,2>{0.736972988f, 0.713529468f},
-std::array<float,2>{0.190596431f, 0.0831068978f},
-std::array<float,2>{0.135900095f, 0.821083844f},
-std::array<float,2>{0.648091733f, 0.281609237f},
-std::array<float,2>{0.750268698f, 0.592479646f},
-std::array<float,2>{0.320382416f, 0.17067565f},
-std::array<float,2>{0.446534187f, 0.66871798f},
-std::array<float,2>{0.947313488f, 0.0545933433f},
-std::array<float,2>{0.501348555f, 0.922614396f},
-std::array<float,2>{0.116657346f, 0.46132037f},
-std::array<float,2>{0.241662249f, 0.620895028f},
-std::array<float,2>{0.706783295f, 0.155848965f},
-std::array<float,2>{0.8139503f, 0.846378386f},
-std::array<float,2>{0.262150109f, 0.261879623f},
-std::array<float,2>{0.397078156f, 0.905796528f},
-std::array<float,2>{0.913514197f, 0.482774377f},
-std::array<float,2>{0.617099047f, 0.649381816f},
-std::array<float,2>{0.0407945774f, 0.00429322477f},
-std::array<float,2>{0.0826043859f, 0.792946458f},
-std::array<float,2>{0.548195362f, 0.328983635f},
-std::array<float,2>{0.991238832f, 0.545614123f},
-std::array<float,2>{0.473183125f, 0.212853968f},
-std::array<float,2>{0.365875453f, 0.74072814f},
-std::array<float,2>{0.789148033f, 0.115397386f},
-std::array<float,2>{0.677975714f, 0.946744978f},
-std::array<float,2>{0.16644676f, 0.435043067f},
-std::array<float,2>{0.00751285581f, 0.658293188f},
-std::array<float,2>{0.589607596f, 0.0573203899f},
-std::array<float,2>{0.892667592f, 0.933949292f},
-std::array<float,2>{0.437392801f, 0.454943061f},
-std::array<float,2>{0.290694326f, 0.817563176f},
-std::array<float,2>{0.853914976f, 0.291687459f},
-std::array<float,2>{0.720446289f, 0.581026196f},
-std::array<float,2>{0.207451329f, 0.156372875f},
-std::array<float,2>{0.154101506f, 0.981707215f},
-std::array<float,2>{0.638710022f, 0.3785128f},
-std::array<float,2>{0.777968585f, 0.705959737f},
-std::array<float,2>{0.342575043f, 0.089174442f},
-std::array<float,2>{0.457482278f, 0.523612082f},
-std::array<float,2>{0.955674112f, 0.235016361f},
-std::array<float,2>{0.520096958f, 0.766031325f},
-std::array<float,2>{0.097160317f, 0.374746293f},
-std::array<float,2>{0.177919909f, 0.702551544f},
-std::array<float,2>{0.659914374f, 0.0630464852f},
-std::array<float,2>{0.803664029f, 0.990670085f},
-std::array<float,2>{0.350847363f, 0.40048337f},
-std::array<float,2>{0.494456947f, 0.758897126f},
-std::array<float,2>{0.983706653f, 0.35449037f},
-std::array<float,2>{0.541343987f, 0.507871628f},
-std::array<float,2>{0.0724691674f, 0.223462999f},
-std::array<float,2>{0.0491926596f, 0.907188416f},
-std::array<float,2>{0.607793987f, 0.446508408f},
-std::array<float,2>{0.926284492f, 0.680618882f},
-std::array<float,2>{0.376796812f, 0.0404701345f},
-std::array<float,2>{0.267235756f, 0.575789154f},
-std::array<float,2>{0.83609122f, 0.176903099f},
-std::array<float,2>{0.695047975f, 0.833917618f},
-std::array<float,2>{0.227326646f, 0.310071021f},
-std::array<float,2>{0.110089093f, 0.562493801f},
-std::array<float,2>{0.505105495f, 0.19796066f},
-std::array<float,2>{0.949800611f, 0.807029545f},
-std::array<float,2>{0.450772941f, 0.328049034f},
-std::array<float,2>{0.327579021f, 0.96467036f},
-std::array<float,2>{0.756740749f, 0.41523248f},
-std::array<float,2>{0.642440438f, 0.729368508f},
-std::array<float,2>{0.140065983f, 0.103502601f},
-std::array<float,2>{0.194714367f, 0.863491118f},
-std::array<float,2>{0.740483344f, 0.276520848f},
-std::array<float,2>{0.870254457f, 0.595694721f},
-std::array<float,2>{0.303614795f, 0.138146386f},
-std::array<float,2>{0.407994479f, 0.635352314f},
-std::array<float,2>{0.878004432f, 0.0160418507f},
-std::array<float,2>{0.571538508f, 0.888574541f},
-std::array<float,2>{0.0307639465f, 0.491227567f},
-std::array<float,2>{0.125472352f, 0.503714204f},
-std::array<float,2>{0.65415144f, 0.233033806f},
-std::array<float,2>{0.761177897f, 0.751347899f},
-std::array<float,2>{0.31660527f, 0.34405306f},
-std::array<float,2>{0.441865981f, 0.999411762f},
-std::array<float,2>{0.941539526f, 0.396865875f},
-std::array<float,2>{0.51143837f, 0.695122778f},
-std::array<float,2>{0.123621337f, 0.0776823834f},
-std::array<float,2>{0.0225518588f, 0.842756808f},
-std::array<float,2>{0.565538287f, 0.304350793f},
-std::array<float,2>{0.885742188f, 0.564427137f},
-std::array<float,2>{0.416091412f, 0.18580094f},
-std::array<float,2>{0.308269233f, 0.674530447f},
-std::array<float,2>{0.860936522f, 0.0345972851f},
-std::array<float,2>{0.743324578f, 0.917809188f},
-std::array<float,2>{0.197505683f, 0.443958849f},
-std::array<float,2>{0.0632421896f, 0.725166678f},
-std::array<float,2>{0.533354104f, 0.0953927264f},
-std::array<float,2>{0.976508737f, 0.953447223f},
-std::array<float,2>{0.490690619f, 0.409815907f},
-std::array<float,2>{0.35859713f, 0.797300696f},
-std::array<float,2>{0.80787921f, 0.314654589f},
-std::array<float,2>{0.670364857f, 0.552027285f},
-std::array<float,2>{0.184909537f, 0.190550417f},
-std::array<float,2>{0.221568987f, 0.87643379f},
-std::array<float,2>{0.699147522f, 0.497240186f},
-std::array<float,2>{0.830746472f, 0.629728556f},
-std::array<float,2>{0.277265489f, 0.0277955309f},
-std::array<float,2>{0.384919703f, 0.606199682f},
-std::array<float,2>{0.932472706f, 0.132247433f},
-std::array<float,2>{0.593818605f, 0.86998409f},
-std::array<float,2>{0.0572038814f, 0.269924492f},
-std::array<float,2>{0.217078149f, 0.645686984f},
-std::array<float,2>{0.729231596f, 0.0128011899f},
-std::array<float,2>{0.848766088f, 0.896297395f},
-std::array<float,2>{0.28868717f, 0.473717153f},
-std::array<float,2>{0.428966075f, 0.856131613f},
-std::array<float,2>{0.903916597f, 0.256388038f},
-std::array<float,2>{0.579300046f, 0.61651808f},
-std::array<float,2>{0.0124372477f, 0.148034945f},
-std::array<float,2>{0.105620362f, 0.938765407f},
-std::array<float,2>{0.527764738f, 0.425593644f},
-std::array<float,2>{0.962747097f, 0.746402621f},
-std::array<float,2>{0.464218348f, 0.120521612f},
-std::array<float,2>{0.335389376f, 0.534701645f},
-std::array<float,2>{0.768221974f, 0.210377783f},
-std::array<float,2>{0.631955028f, 0.781878293f},
-std::array<float,2>{0.140838519f, 0.337955832f},
-std::array<float,2>{0.0324093625f, 0.586911142f},
-std::array<float,2>{0.617259085f, 0.164243788f},
-std::array<float,2>{0.915153921f, 0.826948822f},
-std::array<float,2>{0.401845276f, 0.287739843f},
-std::array<float,2>{0.256611645f, 0.928687394f},
-std::array<float,2>{0.82466644f, 0.466105163f},
-std::array<float,2>{0.718252242f, 0.667413294f},
-std::array<float,2>{0.249284297f, 0.0499978997f},
-std::array<float,2>{0.160748601f, 0.777082145f},
-std::array<float,2>{0.682652295f, 0.36515218f},
-std::array<float,2>{0.781604469f, 0.520686269f},
-std::array<float,2>{0.371394902f, 0.249674693f},
-std::array<float,2>{0.478709131f, 0.718700945f},
-std::array<float,2>{0.995143235f, 0.0814096853f},
-std::array<float,2>{0.561233997f, 0.975052476f},
-std::array<float,2>{0.0902639478f, 0.387401253f},
-std::array<float,2>{0.21176976f, 0.513393521f},
-std::array<float,2>{0.730806351f, 0.21992299f},
-std::array<float,2>{0.845383346f, 0.762875617f},
-std::array<float,2>{0.282316446f, 0.358476698f},
-std::array<float,2>{0.424411923f, 0.985837698f},
-std::array<float,2>{0.898566544f, 0.404151142f},
-std::array<float,2>{0.584158123f, 0.698895276f},
-std::array<float,2>{0.0110442853f, 0.0677658319f},
-std::array<float,2>{0.105342656f, 0.82851392f},
-std::array<float,2>{0.526143909f, 0.308284432f},
-std::array<float,2>{0.967109203f, 0.571366966f},
-std::array<float,2>{0.467174649f, 0.17425397f},
-std::array<float,2>{0.330450296f, 0.687495589f},
-std::array<float,2>{0.773178041f, 0.045893535f},
-std::array<float,2>{0.626765549f, 0.913953781f},
-std::array<float,2>{0.148091599f, 0.452723622f},
-std::array<float,2>{0.0378056839f, 0.733102262f},
-std::array<float,2>{0.621177137f, 0.105644859f},
-std::array<float,2>{0.920445085f, 0.967379987f},
-std::array<float,2>{0.406050771f, 0.42080602f},
-std::array<float,2>{0.251153409f, 0.811999381f},
-std::array<float,2>{0.822608709f, 0.323460728f},
-std::array<float,2>{0.711746097f, 0.555747628f},
-std::array<float,2>{0.243841499f, 0.202040374f},
-std::array<float,2>{0.159845084f, 0.884979904f},
-std::array<float,2>{0.684087098f, 0.486194372f},
-std::array<float,2>{0.786070347f, 0.639429688f},
-std::array<float,2>{0.367799699f, 0.0219143815f},
-std::array<float,2>{0.482414573f, 0.600414336f},
-std::array<float,2>{0.996264517f, 0.134599432f},
-std::array<float,2>{0.557060599f, 0.860017955f},
-std::array<float,2>{0.0882407501f, 0.281015754f},
-std::array<float,2>{0.130094066f, 0.653096914f},
-std::array<float,2>{0.649276257f, 0.000731077685f},
-std::array<float,2>{0.763517618f, 0.901693881f},
-std::array<float,2>{0.31290406f, 0.480150104f},
-std::array<float,2>{0.437929481f, 0.850430787f},
-std::array<float,2>{0.939736366f, 0.258370876f},
-std::array<float,2>{0.511726737f, 0.624044538f},
-std::array<float,2>{0.118778147f, 0.15113461f},
-std::array<float,2>{0.0183144324f, 0.950192273f},
-std::array<float,2>{0.567926586f, 0.432916313f},
-std::array<float,2>{0.8885144f, 0.735913157f},
-std::array<float,2>{0.420809507f, 0.110020421f},
-std::array<float,2>{0.311913222f, 0.54034853f},
-std::array<float,2>{0.864881694f, 0.216987908f},
-std::array<float,2>{0.74875319f, 0.794474423f},
-std::array<float,2>{0.201013282f, 0.334971339f},
-std::array<float,2>{0.0690684468f, 0.584064007f},
-std::array<float,2>{0.538246095f, 0.163731039f},
-std::array<float,2>{0.970141828f, 0.815439224f},
-std::array<float,2>{0.486725092f, 0.294280559f},
-std::array<float,2>{0.353301018f, 0.931944966f},
-std::array<float,2>{0.8097772f, 0.458020508f},
-std::array<float,2>{0.666640222f, 0.663324416f},
-std::array<float,2>{0.181125864f, 0.0586038716f},
-std::array<float,2>{0.223604783f, 0.770270348f},
-std::array<float,2>{0.700317025f, 0.367550373f},
-std::array<float,2>{0.835411489f, 0.529765964f},
-std::array<float,2>{0.278651714f, 0.240827963f},
-std::array<float,2>{0.388374269f, 0.707147717f},
-std::array<float,2>{0.935804784f, 0.0915313512f},
-std::array<float,2>{0.600446284f, 0.976724386f},
-std::array<float,2>{0.059103258f, 0.380758315f},
-std::array<float,2>{0.173801139f, 0.611589551f},
-std::array<float,2>{0.661644399f, 0.144069538f},
-std::array<float,2>{0.798005104f, 0.85308212f},
-std::array<float,2>{0.343933344f, 0.251507044f},
-std::array<float,2>{0.499750823f, 0.890915692f},
-std::array<float,2>{0.97678113f, 0.47135964f},
-std::array<float,2>{0.54483366f, 0.64416194f},
-std::array<float,2>{0.0779403001f, 0.010653913f},
-std::array<float,2>{0.0527371205f, 0.788223505f},
-std::array<float,2>{0.601668f, 0.340125412f},
-std::array<float,2>{0.92407012f, 0.536135674f},
-std::array<float,2>{0.380120635f, 0.204865545f},
-std::array<float,2>{0.27332592f, 0.74238646f},
-std::array<float,2>{0.842637181f, 0.124507606f},
-std::array<float,2>{0.690621257f, 0.941610456f},
-std::array<float,2>{0.232646778f, 0.427957058f},
-std::array<float,2>{0.115744926f, 0.67099613f},
-std::array<float,2>{0.500878215f, 0.0523203611f},
-std::array<float,2>{0.948416889f, 0.924566746f},
-std::array<float,2>{0.446182311f, 0.463527322f},
-std::array<float,2>{0.32195574f, 0.82285887f},
-std::array<float,2>{0.751806557f, 0.283811986f},
-std::array<float,2>{0.64666456f, 0.590484381f},
-std::array<float,2>{0.135414869f, 0.169400707f},
-std::array<float,2>{0.189834699f, 0.970655501f},
-std::array<float,2>{0.73802042f, 0.383543044f},
-std::array<float,2>{0.873434722f, 0.712222874f},
-std::array<float,2>{0.300765544f, 0.0843179524f},
-std::array<float,2>{0.410166472f, 0.516275764f},
-std::array<float,2>{0.88018775f, 0.24343583f},
-std::array<float,2>{0.577199936f, 0.777561247f},
-std::array<float,2>{0.0251170024f, 0.361630291f},
-std::array<float,2>{0.236385822f, 0.689665318f},
-std::array<float,2>{0.709403515f, 0.071289584f},
-std::array<float,2>{0.819178522f, 0.994897485f},
-std::array<float,2>{0.259013206f, 0.391248882f},
-std::array<float,2>{0.394261479f, 0.755353928f},
-std::array<float,2>{0.909216702f, 0.349975288f},
-std::array<float,2>{0.612315059f, 0.506284952f},
-std::array<float,2>{0.0443332642f, 0.227303013f},
-std::array<float,2>{0.0811260268f, 0.918219984f},
-std::array<float,2>{0.551681936f, 0.43830198f},
-std::array<float,2>{0.984988391f, 0.678218901f},
-std::array<float,2>{0.470440358f, 0.0363133326f},
-std::array<float,2>{0.362283826f, 0.56701082f},
-std::array<float,2>{0.795132875f, 0.180424705f},
-std::array<float,2>{0.673723221f, 0.839782894f},
-std::array<float,2>{0.169019118f, 0.297505915f},
-std::array<float,2>{0.00383799849f, 0.549649775f},
-std::array<float,2>{0.590114236f, 0.193733886f},
-std::array<float,2>{0.895256877f, 0.803239226f},
-std::array<float,2>{0.432830215f, 0.317818761f},
-std::array<float,2>{0.296835691f, 0.959644854f},
-std::array<float,2>{0.858503759f, 0.410546213f},
-std::array<float,2>{0.725130856f, 0.720572472f},
-std::array<float,2>{0.204431251f, 0.100992218f},
-std::array<float,2>{0.152210221f, 0.871622562f},
-std::array<float,2>{0.634816587f, 0.268204957f},
-std::array<float,2>{0.776975989f, 0.602959037f},
-std::array<float,2>{0.338603497f, 0.128664613f},
-std::array<float,2>{0.455143958f, 0.626567304f},
-std::array<float,2>{0.957834303f, 0.024658883f},
-std::array<float,2>{0.517356157f, 0.880819619f},
-std::array<float,2>{0.0992818028f, 0.492256045f},
-std::array<float,2>{0.227765739f, 0.576715708f},
-std::array<float,2>{0.694201171f, 0.179218471f},
-std::array<float,2>{0.837269306f, 0.834057868f},
-std::array<float,2>{0.266340017f, 0.311009884f},
-std::array<float,2>{0.375330389f, 0.909979999f},
-std::array<float,2>{0.927024245f, 0.448289484f},
-std::array<float,2>{0.609311044f, 0.683007479f},
-std::array<float,2>{0.050227873f, 0.0410443991f},
-std::array<float,2>{0.0734515488f, 0.761223733f},
-std::array<float,2>{0.542494535f, 0.352815449f},
-std::array<float,2>{0.982629597f, 0.511381984f},
-std::array<float,2>{0.495156288f, 0.224923208f},
-std::array<float,2>{0.350459069f, 0.70102793f},
-std::array<float,2>{0.804498851f, 0.0657589883f},
-std::array<float,2>{0.658777416f, 0.988623321f},
-std::array<float,2>{0.179112613f, 0.398597896f},
-std::array<float,2>{0.0298806243f, 0.634471297f},
-std::array<float,2>{0.57035917f, 0.0175984129f},
-std::array<float,2>{0.877016127f, 0.88869673f},
-std::array<float,2>{0.406982303f, 0.489591777f},
-std::array<float,2>{0.304228723f, 0.867058754f},
-std::array<float,2>{0.86924988f, 0.273763537f},
-std::array<float,2>{0.741994321f, 0.596016169f},
-std::array<float,2>{0.194016457f, 0.140187398f},
-std::array<float,2>{0.139344797f, 0.96223563f},
-std::array<float,2>{0.640965939f, 0.417689443f},
-std::array<float,2>{0.757598042f, 0.728252888f},
-std::array<float,2>{0.326564848f, 0.104225621f},
-std::array<float,2>{0.449832737f, 0.56004709f},
-std::array<float,2>{0.950323105f, 0.19601056f},
-std::array<float,2>{0.504095495f, 0.805859745f},
-std::array<float,2>{0.110954024f, 0.325825572f},
-std::array<float,2>{0.167893365f, 0.740076125f},
-std::array<float,2>{0.679446995f, 0.114639863f},
-std::array<float,2>{0.790292144f, 0.947993696f},
-std::array<float,2>{0.367088556f, 0.436501205f},
-std::array<float,2>{0.474526435f, 0.790598154f},
-std::array<float,2>{0.990291834f, 0.330941796f},
-std::array<float,2>{0.547430456f, 0.543390453f},
-std::array<float,2>{0.0833028853f, 0.213337287f},
-std::array<float,2>{0.0395896658f, 0.903204739f},
-std::array<float,2>{0.616069376f, 0.480479062f},
-std::array<float,2>{0.912244976f, 0.652241588f},
-std::array<float,2>{0.39798528f, 0.00773962634f},
-std::array<float,2>{0.263617009f, 0.617569625f},
-std::array<float,2>{0.812537909f, 0.154059723f},
-std::array<float,2>{0.705107152f, 0.844810545f},
-std::array<float,2>{0.240499258f, 0.264097065f},
-std::array<float,2>{0.0964274704f, 0.526687443f},
-std::array<float,2>{0.520856798f, 0.236923248f},
-std::array<float,2>{0.956292748f, 0.768068075f},
-std::array<float,2>{0.458413929f, 0.371392787f},
-std::array<float,2>{0.342881382f, 0.98349452f},
-std::array<float,2>{0.778553665f, 0.375268877f},
-std::array<float,2>{0.640600026f, 0.704706252f},
-std::array<float,2>{0.152544945f, 0.0873299092f},
-std::array<float,2>{0.208612829f, 0.819781959f},
-std::array<float,2>{0.719002783f, 0.289884478f},
-std::array<float,2>{0.855368495f, 0.578362584f},
-std::array<float,2>{0.290027857f, 0.158715621f},
-std::array<float,2>{0.435994744f, 0.656750262f},
-std::array<float,2>{0.894005597f, 0.0552943908f},
-std::array<float,2>{0.588232636f, 0.936524868f},
-std::array<float,2>{0.00630744174f, 0.456308603f},
-std::array<float,2>{0.142433122f, 0.532471478f},
-std::array<float,2>{0.631278813f, 0.208774626f},
-std::array<float,2>{0.769041002f, 0.784618735f},
-std::array<float,2>{0.33449772f, 0.336158395f},
-std::array<float,2>{0.463742435f, 0.940199316f},
-std::array<float,2>{0.9610008f, 0.423373461f},
-std::array<float,2>{0.529138207f, 0.748209357f},
-std::array<float,2>{0.107034616f, 0.117962018f},
-std::array<float,2>{0.0133482991f, 0.858070195f},
-std::array<float,2>{0.578751445f, 0.255536467f},
-std::array<float,2>{0.903297782f, 0.613723695f},
-std::array<float,2>{0.428455979f, 0.145939007f},
-std::array<float,2>{0.287852943f, 0.646906078f},
-std::array<float,2>{0.847927034f, 0.0147766722f},
-std::array<float,2>{0.729509294f, 0.898099303f},
-std::array<float,2>{0.218196601f, 0.47638309f},
-std::array<float,2>{0.0909600481f, 0.714980781f},
-std::array<float,2>{0.561812103f, 0.0787138194f},
-std::array<float,2>{0.994393408f, 0.973059416f},
-std::array<float,2>{0.480087668f, 0.390079886f},
-std::array<float,2>{0.372638226f, 0.774536431f},
-std::array<float,2>{0.782451093f, 0.366024375f},
-std::array<float,2>{0.682473421f, 0.523180604f},
-std::array<float,2>{0.161773354f, 0.24651356f},
-std::array<float,2>{0.248503298f, 0.92671746f},
-std::array<float,2>{0.717045188f, 0.468474358f},
-std::array<float,2>{0.825701952f, 0.665204644f},
-std::array<float,2>{0.257493794f, 0.0479175486f},
-std::array<float,2>{0.401277632f, 0.588704467f},
-std::array<float,2>{0.914566755f, 0.166906923f},
-std::array<float,2>{0.618229568f, 0.824899971f},
-std::array<float,2>{0.0321266986f, 0.285683066f},
-std::array<float,2>{0.198868066f, 0.672908008f},
-std::array<float,2>{0.742699623f, 0.0328410231f},
-std::array<float,2>{0.859418392f, 0.914748907f},
-std::array<float,2>{0.307406843f, 0.441755295f},
-std::array<float,2>{0.417574108f, 0.841239929f},
-std::array<float,2>{0.884852588f, 0.301950365f},
-std::array<float,2>{0.565248489f, 0.565048337f},
-std::array<float,2>{0.0219288282f, 0.184712589f},
-std::array<float,2>{0.124806061f, 0.997418523f},
-std::array<float,2>{0.509862423f, 0.395457745f},
-std::array<float,2>{0.942836046f, 0.692235112f},
-std::array<float,2>{0.442529321f, 0.0749741718f},
-std::array<float,2>{0.317692995f, 0.500137627f},
-std::array<float,2>{0.760535538f, 0.231604293f},
-std::array<float,2>{0.652510345f, 0.753261566f},
-std::array<float,2>{0.12694858f, 0.345805705f},
-std::array<float,2>{0.0577959418f, 0.608055353f},
-std::array<float,2>{0.59557265f, 0.129608423f},
-std::array<float,2>{0.932695031f, 0.868401587f},
-std::array<float,2>{0.386644155f, 0.272524923f},
-std::array<float,2>{0.275659889f, 0.878279328f},
-std::array<float,2>{0.831960499f, 0.499188125f},
-std::array<float,2>{0.698214114f, 0.632497072f},
-std::array<float,2>{0.222453356f, 0.0308582578f},
-std::array<float,2>{0.184568152f, 0.799661815f},
-std::array<float,2>{0.670996964f, 0.312727898f},
-std::array<float,2>{0.806896746f, 0.55428189f},
-std::array<float,2>{0.357600957f, 0.18776311f},
-std::array<float,2>{0.491719812f, 0.722944975f},
-std::array<float,2>{0.974626482f, 0.0961630791f},
-std::array<float,2>{0.535145462f, 0.95529598f},
-std::array<float,2>{0.0644318685f, 0.406954736f},
-std::array<float,2>{0.244216979f, 0.558133781f},
-std::array<float,2>{0.714724302f, 0.200963274f},
-std::array<float,2>{0.821050704f, 0.810194731f},
-std::array<float,2>{0.253398538f, 0.320691437f},
-std::array<float,2>{0.402504951f, 0.96636939f},
-std::array<float,2>{0.919062138f, 0.418131232f},
-std::array<float,2>{0.623558462f, 0.73214227f},
-std::array<float,2>{0.0352173671f, 0.109297253f},
-std::array<float,2>{0.0868230537f, 0.862438023f},
-std::array<float,2>{0.556070328f, 0.277344823f},
-std::array<float,2>{0.998733342f, 0.597912014f},
-std::array<float,2>{0.483080715f, 0.136542171f},
-std::array<float,2>{0.369514912f, 0.637506425f},
-std::array<float,2>{0.787453353f, 0.0206109975f},
-std::array<float,2>{0.686220944f, 0.884188592f},
-std::array<float,2>{0.157070845f, 0.487596631f},
-std::array<float,2>{0.00827709585f, 0.695951104f},
-std::array<float,2>{0.583001256f, 0.0695719942f},
-std::array<float,2>{0.901458561f, 0.986365736f},
-std::array<float,2>{0.42320928f, 0.405317008f},
-std::array<float,2>{0.283608675f, 0.764531195f},
-std::array<float,2>{0.846170723f, 0.357134879f},
-std::array<float,2>{0.733948052f, 0.51436621f},
-std::array<float,2>{0.214027032f, 0.220941633f},
-std::array<float,2>{0.146484077f, 0.91052562f},
-std::array<float,2>{0.627284348f, 0.450108498f},
-std::array<float,2>{0.770840168f, 0.684796095f},
-std::array<float,2>{0.328293711f, 0.0441417769f},
-std::array<float,2>{0.465684831f, 0.574172378f},
-std::array<float,2>{0.966692924f, 0.172730759f},
-std::array<float,2>{0.5238958f, 0.830595136f},
-std::array<float,2>{0.102893688f, 0.305190116f},
-std::array<float,2>{0.181688383f, 0.661365509f},
-std::array<float,2>{0.665047109f, 0.0609424338f},
-std::array<float,2>{0.810923576f, 0.93019253f},
-std::array<float,2>{0.354505211f, 0.460042238f},
-std::array<float,2>{0.48570317f, 0.814449012f},
-std::array<float,2>{0.970778644f, 0.294930488f},
-std::array<float,2>{0.535233438f, 0.582313716f},
-std::array<float,2>{0.0681707188f, 0.160356939f},
-std::array<float,2>{0.0623150505f, 0.979804277f},
-std::array<float,2>{0.598847449f, 0.382510364f},
-std::array<float,2>{0.935288906f, 0.709962249f},
-std::array<float,2>{0.388852715f, 0.0930619836f},
-std::array<float,2>{0.280807137f, 0.527908325f},
-std::array<float,2>{0.833370924f, 0.239388958f},
-std::array<float,2>{0.702121794f, 0.773271263f},
-std::array<float,2>{0.224880815f, 0.370005757f},
-std::array<float,2>{0.120795205f, 0.621358395f},
-std::array<float,2>{0.515576422f, 0.148885533f},
-std::array<float,2>{0.938540876f, 0.848526478f},
-std::array<float,2>{0.439536214f, 0.260011822f},
-std::array<float,2>{0.314981371f, 0.899875879f},
-std::array<float,2>{0.764249444f, 0.477933943f},
-std::array<float,2>{0.652158141f, 0.655734599f},
-std::array<float,2>{0.13206163f, 0.00227226573f},
-std::array<float,2>{0.202461049f, 0.795338571f},
-std::array<float,2>{0.747439086f, 0.333883584f},
-std::array<float,2>{0.865608752f, 0.541291833f},
-std::array<float,2>{0.309369534f, 0.216160357f},
-std::array<float,2>{0.418180883f, 0.736428976f},
-std::array<float,2>{0.889131069f, 0.112244613f},
-std::array<float,2>{0.568467677f, 0.952356637f},
-std::array<float,2>{0.016684996f, 0.431562662f},
-std::array<float,2>{0.13358888f, 0.593624592f},
-std::array<float,2>{0.645554066f, 0.171174839f},
-std::array<float,2>{0.752610981f, 0.821848989f},
-std::array<float,2>{0.32271266f, 0.283202082f},
-std::array<float,2>{0.448521346f, 0.923547864f},
-std::array<float,2>{0.947236001f, 0.462154001f},
-std::array<float,2>{0.503589272f, 0.669620216f},
-std::array<float,2>{0.113443717f, 0.0532367267f},
-std::array<float,2>{0.0260884855f, 0.779317439f},
-std::array<float,2>{0.575865388f, 0.361224949f},
-std::array<float,2>{0.882001102f, 0.518616974f},
-std::array<float,2>{0.413507998f, 0.244681239f},
-std::array<float,2>{0.297348291f, 0.714836955f},
-std::array<float,2>{0.87232852f, 0.0823627487f},
-std::array<float,2>{0.734936774f, 0.97225529f},
-std::array<float,2>{0.187752217f, 0.385991395f},
-std::array<float,2>{0.0758528709f, 0.642235816f},
-std::array<float,2>{0.545530796f, 0.00850256905f},
-std::array<float,2>{0.979104698f, 0.893324137f},
-std::array<float,2>{0.497013628f, 0.468946427f},
-std::array<float,2>{0.346943945f, 0.855228722f},
-std::array<float,2>{0.799826741f, 0.253865868f},
-std::array<float,2>{0.663452446f, 0.609654963f},
-std::array<float,2>{0.174635142f, 0.140661776f},
-std::array<float,2>{0.230626583f, 0.94344312f},
-std::array<float,2>{0.688392282f, 0.426141173f},
-std::array<float,2>{0.840039253f, 0.744532645f},
-std::array<float,2>{0.270961463f, 0.122598864f},
-std::array<float,2>{0.382675052f, 0.539028287f},
-std::array<float,2>{0.922282755f, 0.20545435f},
-std::array<float,2>{0.604403198f, 0.785315394f},
-std::array<float,2>{0.0513035022f, 0.343097836f},
-std::array<float,2>{0.205274731f, 0.72163403f},
-std::array<float,2>{0.722840607f, 0.0987562984f},
-std::array<float,2>{0.856428623f, 0.958845496f},
-std::array<float,2>{0.293471098f, 0.413508087f},
-std::array<float,2>{0.430842161f, 0.801087379f},
-std::array<float,2>{0.897413611f, 0.318762958f},
-std::array<float,2>{0.592552423f, 0.547170639f},
-std::array<float,2>{0.00128768315f, 0.192916915f},
-std::array<float,2>{0.100771941f, 0.881885529f},
-std::array<float,2>{0.519515336f, 0.494754136f},
-std::array<float,2>{0.959542751f, 0.627869666f},
-std::array<float,2>{0.454945177f, 0.0269074254f},
-std::array<float,2>{0.337413549f, 0.60431087f},
-std::array<float,2>{0.773799241f, 0.125461638f},
-std::array<float,2>{0.63446945f, 0.87456733f},
-std::array<float,2>{0.149616078f, 0.266880721f},
-std::array<float,2>{0.0456370711f, 0.505120099f},
-std::array<float,2>{0.61081624f, 0.229558378f},
-std::array<float,2>{0.908065736f, 0.75661546f},
-std::array<float,2>{0.391112655f, 0.348032236f},
-std::array<float,2>{0.260937601f, 0.994047344f},
-std::array<float,2>{0.816994131f, 0.394437134f},
-std::array<float,2>{0.707480729f, 0.688483715f},
-std::array<float,2>{0.234824017f, 0.073302798f},
-std::array<float,2>{0.1703033f, 0.836875677f},
-std::array<float,2>{0.674335122f, 0.300220758f},
-std::array<float,2>{0.793769836f, 0.569901347f},
-std::array<float,2>{0.360059887f, 0.181947052f},
-std::array<float,2>{0.472641617f, 0.676202178f},
-std::array<float,2>{0.986872256f, 0.0385754816f},
-std::array<float,2>{0.553814292f, 0.92075634f},
-std::array<float,2>{0.0786303356f, 0.439877659f},
-std::array<float,2>{0.191451252f, 0.593901515f},
-std::array<float,2>{0.739760637f, 0.137009844f},
-std::array<float,2>{0.868831992f, 0.864298642f},
-std::array<float,2>{0.301499844f, 0.275474757f},
-std::array<float,2>{0.40920344f, 0.886749625f},
-std::array<float,2>{0.875314772f, 0.490750074f},
-std::array<float,2>{0.574081838f, 0.636065423f},
-std::array<float,2>{0.0289375689f, 0.0166977402f},
-std::array<float,2>{0.112266891f, 0.808367431f},
-std::array<float,2>{0.506631553f, 0.326293468f},
-std::array<float,2>{0.952535272f, 0.561024129f},
-std::array<float,2>{0.45186761f, 0.198378891f},
-std::array<float,2>{0.325589776f, 0.729547322f},
-std::array<float,2>{0.75458771f, 0.10162209f},
-std::array<float,2>{0.642653346f, 0.963425636f},
-std::array<float,2>{0.137582242f, 0.414069444f},
-std::array<float,2>{0.0476581864f, 0.681466639f},
-std::array<float,2>{0.607119977f, 0.0396335125f},
-std::array<float,2>{0.929238439f, 0.907671452f},
-std::array<float,2>{0.377380013f, 0.44596076f},
-std::array<float,2>{0.268899441f, 0.832233906f},
-std::array<float,2>{0.839274526f, 0.30911696f},
-std::array<float,2>{0.693350375f, 0.574340224f},
-std::array<float,2>{0.229070693f, 0.176316813f},
-std::array<float,2>{0.177402571f, 0.991233706f},
-std::array<float,2>{0.656747282f, 0.402140886f},
-std::array<float,2>{0.802029908f, 0.70155412f},
-std::array<float,2>{0.349445283f, 0.0636455268f},
-std::array<float,2>{0.493305236f, 0.508951545f},
-std::array<float,2>{0.980747044f, 0.224148303f},
-std::array<float,2>{0.539296329f, 0.757950187f},
-std::array<float,2>{0.0720086545f, 0.355210453f},
-std::array<float,2>{0.155936927f, 0.706850588f},
-std::array<float,2>{0.63792932f, 0.0883106217f},
-std::array<float,2>{0.780705094f, 0.980729938f},
-std::array<float,2>{0.340797216f, 0.377884448f},
-std::array<float,2>{0.460069656f, 0.767463326f},
-std::array<float,2>{0.954621255f, 0.373782486f},
-std::array<float,2>{0.522428632f, 0.525351465f},
-std::array<float,2>{0.0953145772f, 0.235832766f},
-std::array<float,2>{0.00583682628f, 0.93467176f},
-std::array<float,2>{0.586270273f, 0.45335871f},
-std::array<float,2>{0.891104758f, 0.659469008f},
-std::array<float,2>{0.43456021f, 0.0581559166f},
-std::array<float,2>{0.292545706f, 0.581548691f},
-std::array<float,2>{0.852175474f, 0.157867759f},
-std::array<float,2>{0.721448123f, 0.817175746f},
-std::array<float,2>{0.210144818f, 0.292844892f},
-std::array<float,2>{0.0846181512f, 0.546009958f},
-std::array<float,2>{0.549853086f, 0.211428046f},
-std::array<float,2>{0.988752484f, 0.791959941f},
-std::array<float,2>{0.475432456f, 0.329670787f},
-std::array<float,2>{0.365093827f, 0.945340335f},
-std::array<float,2>{0.791615963f, 0.433992624f},
-std::array<float,2>{0.676034927f, 0.741978109f},
-std::array<float,2>{0.164598808f, 0.1165957f},
-std::array<float,2>{0.24004814f, 0.846979737f},
-std::array<float,2>{0.703921497f, 0.263338536f},
-std::array<float,2>{0.815151453f, 0.61953336f},
-std::array<float,2>{0.263876826f, 0.154466763f},
-std::array<float,2>{0.395343959f, 0.649728298f},
-std::array<float,2>{0.911715686f, 0.00539834378f},
-std::array<float,2>{0.613920987f, 0.9045645f},
-std::array<float,2>{0.0428986065f, 0.48372829f},
-std::array<float,2>{0.162246957f, 0.519713223f},
-std::array<float,2>{0.680871606f, 0.248661444f},
-std::array<float,2>{0.783859193f, 0.775596917f},
-std::array<float,2>{0.374744624f, 0.364055932f},
-std::array<float,2>{0.477457911f, 0.975663364f},
-std::array<float,2>{0.993801713f, 0.388234317f},
-std::array<float,2>{0.558990002f, 0.717178285f},
-std::array<float,2>{0.092040047f, 0.0801362917f},
-std::array<float,2>{0.0338819399f, 0.827866435f},
-std::array<float,2>{0.620790482f, 0.288341552f},
-std::array<float,2>{0.917667866f, 0.587768018f},
-std::array<float,2>{0.40021956f, 0.165385142f},
-std::array<float,2>{0.255023092f, 0.666938603f},
-std::array<float,2>{0.827272952f, 0.0493178219f},
-std::array<float,2>{0.715913832f, 0.92878443f},
-std::array<float,2>{0.24695158f, 0.464904726f},
-std::array<float,2>{0.108524419f, 0.74760437f},
-std::array<float,2>{0.529459417f, 0.119981997f},
-std::array<float,2>{0.963003695f, 0.93819952f},
-std::array<float,2>{0.462834895f, 0.423893631f},
-std::array<float,2>{0.332150966f, 0.782369852f},
-std::array<float,2>{0.765640199f, 0.338918358f},
-std::array<float,2>{0.62918514f, 0.533914685f},
-std::array<float,2>{0.14351511f, 0.209243417f},
-std::array<float,2>{0.215709597f, 0.894753098f},
-std::array<float,2>{0.727728009f, 0.472709626f},
-std::array<float,2>{0.849752724f, 0.644554377f},
-std::array<float,2>{0.286905587f, 0.0119253369f},
-std::array<float,2>{0.426664621f, 0.615576863f},
-std::array<float,2>{0.90434444f, 0.146983385f},
-std::array<float,2>{0.580933094f, 0.85722661f},
-std::array<float,2>{0.0137317553f, 0.257629484f},
-std::array<float,2>{0.219495863f, 0.630107641f},
-std::array<float,2>{0.69652766f, 0.0284417793f},
-std::array<float,2>{0.830004692f, 0.875155389f},
-std::array<float,2>{0.275318295f, 0.496357054f},
-std::array<float,2>{0.383499861f, 0.870230794f},
-std::array<float,2>{0.931451917f, 0.271363348f},
-std::array<float,2>{0.596832931f, 0.606563389f},
-std::array<float,2>{0.0556980819f, 0.131376833f},
-std::array<float,2>{0.0658463165f, 0.954505682f},
-std::array<float,2>{0.532717824f, 0.409079403f},
-std::array<float,2>{0.973059356f, 0.726100206f},
-std::array<float,2>{0.489155799f, 0.0937568471f},
-std::array<float,2>{0.3555502f, 0.551739573f},
-std::array<float,2>{0.805451989f, 0.189811274f},
-std::array<float,2>{0.66897589f, 0.798298955f},
-std::array<float,2>{0.186941087f, 0.316139191f},
-std::array<float,2>{0.0195704307f, 0.563035786f},
-std::array<float,2>{0.563410163f, 0.18715784f},
-std::array<float,2>{0.883997798f, 0.842882752f},
-std::array<float,2>{0.414957404f, 0.303241879f},
-std::array<float,2>{0.30636248f, 0.916885018f},
-std::array<float,2>{0.862861693f, 0.44477722f},
-std::array<float,2>{0.744206369f, 0.675457478f},
-std::array<float,2>{0.197158575f, 0.0335749276f},
-std::array<float,2>{0.128840834f, 0.750068724f},
-std::array<float,2>{0.654819548f, 0.345162988f},
-std::array<float,2>{0.759093881f, 0.502599478f},
-std::array<float,2>{0.318960339f, 0.234054893f},
-std::array<float,2>{0.444899827f, 0.694014668f},
-std::array<float,2>{0.944646835f, 0.0769055858f},
-std::array<float,2>{0.508900166f, 0.998059213f},
-std::array<float,2>{0.121846057f, 0.398028702f},
-std::array<float,2>{0.234944969f, 0.506634891f},
-std::array<float,2>{0.707841992f, 0.226565212f},
-std::array<float,2>{0.816427767f, 0.755401969f},
-std::array<float,2>{0.261666775f, 0.350312412f},
-std::array<float,2>{0.391461283f, 0.994405985f},
-std::array<float,2>{0.907611966f, 0.390878439f},
-std::array<float,2>{0.611031771f, 0.690034926f},
-std::array<float,2>{0.0449962504f, 0.0719337836f},
-std::array<float,2>{0.0781477392f, 0.838902295f},
-std::array<float,2>{0.554270506f, 0.297203928f},
-std::array<float,2>{0.986533463f, 0.566544473f},
-std::array<float,2>{0.471929312f, 0.179862767f},
-std::array<float,2>{0.359785497f, 0.678368509f},
-std::array<float,2>{0.79335326f, 0.0370060876f},
-std::array<float,2>{0.674271703f, 0.918612361f},
-std::array<float,2>{0.17061834f, 0.437941372f},
-std::array<float,2>{0.00192444853f, 0.720033288f},
-std::array<float,2>{0.591964126f, 0.101425804f},
-std::array<float,2>{0.89674747f, 0.959183693f},
-std::array<float,2>{0.431271642f, 0.410976261f},
-std::array<float,2>{0.292982191f, 0.802998483f},
-std::array<float,2>{0.855668128f, 0.318178564f},
-std::array<float,2>{0.723579347f, 0.549034178f},
-std::array<float,2>{0.205807611f, 0.193893284f},
-std::array<float,2>{0.150152177f, 0.87995553f},
-std::array<float,2>{0.633825421f, 0.49298504f},
-std::array<float,2>{0.774392426f, 0.62629807f},
-std::array<float,2>{0.336976618f, 0.0251591224f},
-std::array<float,2>{0.454420626f, 0.603329241f},
-std::array<float,2>{0.959414244f, 0.128069714f},
-std::array<float,2>{0.518910408f, 0.871407866f},
-std::array<float,2>{0.101302668f, 0.267855644f},
-std::array<float,2>{0.174259037f, 0.643664658f},
-std::array<float,2>{0.663671851f, 0.00980049931f},
-std::array<float,2>{0.800428092f, 0.891444385f},
-std::array<float,2>{0.347546935f, 0.471126527f},
-std::array<float,2>{0.496474475f, 0.852657497f},
-std::array<float,2>{0.978824079f, 0.251371026f},
-std::array<float,2>{0.545314074f, 0.612079561f},
-std::array<float,2>{0.0753212422f, 0.143693104f},
-std::array<float,2>{0.0509249829f, 0.942203343f},
-std::array<float,2>{0.603526771f, 0.428279489f},
-std::array<float,2>{0.922432363f, 0.743073285f},
-std::array<float,2>{0.381970733f, 0.124704652f},
-std::array<float,2>{0.27120924f, 0.536954582f},
-std::array<float,2>{0.840388477f, 0.204269379f},
-std::array<float,2>{0.687554777f, 0.78857702f},
-std::array<float,2>{0.231028765f, 0.340469956f},
-std::array<float,2>{0.113975771f, 0.590001881f},
-std::array<float,2>{0.502931416f, 0.169629976f},
-std::array<float,2>{0.946641326f, 0.822621822f},
-std::array<float,2>{0.44921571f, 0.283610016f},
-std::array<float,2>{0.323188633f, 0.924258411f},
-std::array<float,2>{0.752398014f, 0.463027418f},
-std::array<float,2>{0.646326303f, 0.671399295f},
-std::array<float,2>{0.132915631f, 0.0520427451f},
-std::array<float,2>{0.188021556f, 0.77829057f},
-std::array<float,2>{0.734811544f, 0.361820161f},
-std::array<float,2>{0.872592509f, 0.515681028f},
-std::array<float,2>{0.297621667f, 0.244130254f},
-std::array<float,2>{0.413862139f, 0.712647855f},
-std::array<float,2>{0.882645011f, 0.0847829357f},
-std::array<float,2>{0.575517118f, 0.970095932f},
-std::array<float,2>{0.0254297629f, 0.383013159f},
-std::array<float,2>{0.132711038f, 0.624638677f},
-std::array<float,2>{0.651678205f, 0.150607452f},
-std::array<float,2>{0.763985097f, 0.85001725f},
-std::array<float,2>{0.314769655f, 0.257886469f},
-std::array<float,2>{0.44005543f, 0.902054787f},
-std::array<float,2>{0.939160883f, 0.47978276f},
-std::array<float,2>{0.514830709f, 0.652381241f},
-std::array<float,2>{0.120596506f, 0.000344953558f},
-std::array<float,2>{0.0171556678f, 0.794381499f},
-std::array<float,2>{0.569172621f, 0.335728437f},
-std::array<float,2>{0.889630735f, 0.54063344f},
-std::array<float,2>{0.418462723f, 0.217441037f},
-std::array<float,2>{0.308743268f, 0.735827327f},
-std::array<float,2>{0.865957201f, 0.109490111f},
-std::array<float,2>{0.747832298f, 0.949329972f},
-std::array<float,2>{0.202762529f, 0.433559567f},
-std::array<float,2>{0.0677051544f, 0.664043367f},
-std::array<float,2>{0.535698295f, 0.0595435351f},
-std::array<float,2>{0.9715361f, 0.932395279f},
-std::array<float,2>{0.486016959f, 0.458933115f},
-std::array<float,2>{0.355258286f, 0.816353619f},
-std::array<float,2>{0.811379671f, 0.294492126f},
-std::array<float,2>{0.665888488f, 0.584745288f},
-std::array<float,2>{0.182173476f, 0.163489759f},
-std::array<float,2>{0.22538273f, 0.977189243f},
-std::array<float,2>{0.701456487f, 0.379933745f},
-std::array<float,2>{0.833589017f, 0.707661748f},
-std::array<float,2>{0.280752927f, 0.0910438299f},
-std::array<float,2>{0.389451116f, 0.529852867f},
-std::array<float,2>{0.934608877f, 0.240540966f},
-std::array<float,2>{0.599124312f, 0.769675255f},
-std::array<float,2>{0.0619434379f, 0.368099451f},
-std::array<float,2>{0.214410812f, 0.698365808f},
-std::array<float,2>{0.733823955f, 0.0679953769f},
-std::array<float,2>{0.846620977f, 0.985906065f},
-std::array<float,2>{0.284156263f, 0.403772533f},
-std::array<float,2>{0.423575968f, 0.763506532f},
-std::array<float,2>{0.902320564f, 0.359144628f},
-std::array<float,2>{0.582423508f, 0.51279515f},
-std::array<float,2>{0.0083620213f, 0.220690325f},
-std::array<float,2>{0.10317421f, 0.913184822f},
-std::array<float,2>{0.524196267f, 0.452403963f},
-std::array<float,2>{0.965907753f, 0.686719596f},
-std::array<float,2>{0.465114892f, 0.0451647863f},
-std::array<float,2>{0.328885615f, 0.57222259f},
-std::array<float,2>{0.771401107f, 0.174734131f},
-std::array<float,2>{0.62745446f, 0.828641534f},
-std::array<float,2>{0.145766079f, 0.307716191f},
-std::array<float,2>{0.036120262f, 0.556517005f},
-std::array<float,2>{0.623421729f, 0.201380491f},
-std::array<float,2>{0.919891477f, 0.812089145f},
-std::array<float,2>{0.402960837f, 0.323799044f},
-std::array<float,2>{0.253796369f, 0.967127442f},
-std::array<float,2>{0.820484638f, 0.41996631f},
-std::array<float,2>{0.713899314f, 0.732802153f},
-std::array<float,2>{0.244910151f, 0.106365807f},
-std::array<float,2>{0.156719774f, 0.859665275f},
-std::array<float,2>{0.685610294f, 0.280357689f},
-std::array<float,2>{0.788017154f, 0.599988222f},
-std::array<float,2>{0.369836569f, 0.134000927f},
-std::array<float,2>{0.482425153f, 0.638978779f},
-std::array<float,2>{0.998500407f, 0.0222512241f},
-std::array<float,2>{0.55645448f, 0.88542062f},
-std::array<float,2>{0.0860060304f, 0.485733122f},
-std::array<float,2>{0.19645825f, 0.564831138f},
-std::array<float,2>{0.744820118f, 0.185426056f},
-std::array<float,2>{0.862724781f, 0.841487348f},
-std::array<float,2>{0.305944949f, 0.302599221f},
-std::array<float,2>{0.414354354f, 0.914500058f},
-std::array<float,2>{0.884464264f, 0.442001522f},
-std::array<float,2>{0.562520564f, 0.673615515f},
-std::array<float,2>{0.0203367919f, 0.0325732976f},
-std::array<float,2>{0.121465839f, 0.753473461f},
-std::array<float,2>{0.509579659f, 0.346502841f},
-std::array<float,2>{0.945146739f, 0.500875652f},
-std::array<float,2>{0.444807112f, 0.231958896f},
-std::array<float,2>{0.318407834f, 0.691499114f},
-std::array<float,2>{0.759625316f, 0.0744890049f},
-std::array<float,2>{0.654563129f, 0.997934222f},
-std::array<float,2>{0.12802121f, 0.39455682f},
-std::array<float,2>{0.0564113446f, 0.632050693f},
-std::array<float,2>{0.597614527f, 0.0306701493f},
-std::array<float,2>{0.930677235f, 0.878564656f},
-std::array<float,2>{0.383231401f, 0.499830812f},
-std::array<float,2>{0.274866134f, 0.868794203f},
-std::array<float,2>{0.829323411f, 0.273132384f},
-std::array<float,2>{0.69702065f, 0.607799113f},
-std::array<float,2>{0.218855575f, 0.129191697f},
-std::array<float,2>{0.187143728f, 0.955647707f},
-std::array<float,2>{0.669737458f, 0.406437397f},
-std::array<float,2>{0.804751575f, 0.723536491f},
-std::array<float,2>{0.356174648f, 0.0963120088f},
-std::array<float,2>{0.488631368f, 0.554073095f},
-std::array<float,2>{0.973602176f, 0.188408941f},
-std::array<float,2>{0.532266438f, 0.799009979f},
-std::array<float,2>{0.066149883f, 0.31328997f},
-std::array<float,2>{0.143060699f, 0.748946726f},
-std::array<float,2>{0.62979728f, 0.117330618f},
-std::array<float,2>{0.766462266f, 0.939574718f},
-std::array<float,2>{0.332925379f, 0.42302528f},
-std::array<float,2>{0.461984038f, 0.784704626f},
-std::array<float,2>{0.963400841f, 0.336677462f},
-std::array<float,2>{0.529811919f, 0.532815099f},
-std::array<float,2>{0.108899906f, 0.20839785f},
-std::array<float,2>{0.0142052611f, 0.897507906f},
-std::array<float,2>{0.580561101f, 0.475742728f},
-std::array<float,2>{0.905249953f, 0.647147238f},
-std::array<float,2>{0.426139206f, 0.0152683659f},
-std::array<float,2>{0.286227614f, 0.614210367f},
-std::array<float,2>{0.850225449f, 0.146212548f},
-std::array<float,2>{0.728232205f, 0.857817829f},
-std::array<float,2>{0.214857936f, 0.255035549f},
-std::array<float,2>{0.0922924429f, 0.522752225f},
-std::array<float,2>{0.559357405f, 0.246956602f},
-std::array<float,2>{0.993222833f, 0.775342643f},
-std::array<float,2>{0.477014542f, 0.365582913f},
-std::array<float,2>{0.374333143f, 0.973522246f},
-std::array<float,2>{0.783599079f, 0.390326381f},
-std::array<float,2>{0.681596279f, 0.715697169f},
-std::array<float,2>{0.162618309f, 0.0784479529f},
-std::array<float,2>{0.246145576f, 0.824621201f},
-std::array<float,2>{0.716696084f, 0.285411179f},
-std::array<float,2>{0.827710986f, 0.58816427f},
-std::array<float,2>{0.255594969f, 0.166240916f},
-std::array<float,2>{0.399768144f, 0.665951729f},
-std::array<float,2>{0.917262495f, 0.0483398475f},
-std::array<float,2>{0.620393872f, 0.925910652f},
-std::array<float,2>{0.0335019007f, 0.46825394f},
-std::array<float,2>{0.164475784f, 0.543606341f},
-std::array<float,2>{0.676352441f, 0.213744372f},
-std::array<float,2>{0.791296721f, 0.790309548f},
-std::array<float,2>{0.364725709f, 0.330271661f},
-std::array<float,2>{0.474961579f, 0.947361112f},
-std::array<float,2>{0.988903821f, 0.435836166f},
-std::array<float,2>{0.550427616f, 0.739629507f},
-std::array<float,2>{0.0844055489f, 0.114857242f},
-std::array<float,2>{0.0420791619f, 0.845506072f},
-std::array<float,2>{0.613510609f, 0.264389485f},
-std::array<float,2>{0.91146642f, 0.618066728f},
-std::array<float,2>{0.394707799f, 0.153687149f},
-std::array<float,2>{0.264230698f, 0.651546299f},
-std::array<float,2>{0.814847767f, 0.00689145364f},
-std::array<float,2>{0.703306019f, 0.902742565f},
-std::array<float,2>{0.239417136f, 0.481318146f},
-std::array<float,2>{0.0947721675f, 0.704179406f},
-std::array<float,2>{0.521767318f, 0.0876142606f},
-std::array<float,2>{0.954487145f, 0.984365106f},
-std::array<float,2>{0.460688889f, 0.375911683f},
-std::array<float,2>{0.340183794f, 0.767943859f},
-std::array<float,2>{0.78114295f, 0.371638834f},
-std::array<float,2>{0.638379693f, 0.526966512f},
-std::array<float,2>{0.15564476f, 0.236589208f},
-std::array<float,2>{0.210926011f, 0.937295675f},
-std::array<float,2>{0.721030474f, 0.456651628f},
-std::array<float,2>{0.851784527f, 0.656438351f},
-std::array<float,2>{0.292082667f, 0.0548936948f},
-std::array<float,2>{0.433838516f, 0.578649521f},
-std::array<float,2>{0.891206741f, 0.158611864f},
-std::array<float,2>{0.586701214f, 0.820127845f},
-std::array<float,2>{0.00520206569f, 0.289401829f},
-std::array<float,2>{0.228649408f, 0.683417737f},
-std::array<float,2>{0.692553401f, 0.0416135304f},
-std::array<float,2>{0.839823842f, 0.909366429f},
-std::array<float,2>{0.269376338f, 0.449196726f},
-std::array<float,2>{0.377667904f, 0.83475697f},
-std::array<float,2>{0.929094791f, 0.311521113f},
-std::array<float,2>{0.606473446f, 0.576391995f},
-std::array<float,2>{0.0473486036f, 0.178914323f},
-std::array<float,2>{0.071762085f, 0.988971293f},
-std::array<float,2>{0.539990067f, 0.399179429f},
-std::array<float,2>{0.981226325f, 0.700291693f},
-std::array<float,2>{0.49392131f, 0.0662997067f},
-std::array<float,2>{0.348698616f, 0.51115334f},
-std::array<float,2>{0.802381814f, 0.225431398f},
-std::array<float,2>{0.656553745f, 0.761599779f},
-std::array<float,2>{0.176797837f, 0.353329331f},
-std::array<float,2>{0.0284064654f, 0.596571207f},
-std::array<float,2>{0.573343575f, 0.140022144f},
-std::array<float,2>{0.875896037f, 0.866465032f},
-std::array<float,2>{0.409728855f, 0.274366438f},
-std::array<float,2>{0.301143974f, 0.88955158f},
-std::array<float,2>{0.868581653f, 0.49006626f},
-std::array<float,2>{0.73943007f, 0.634011209f},
-std::array<float,2>{0.19227238f, 0.0183929652f},
-std::array<float,2>{0.137111381f, 0.806246758f},
-std::array<float,2>{0.643237531f, 0.325563848f},
-std::array<float,2>{0.754380167f, 0.560473144f},
-std::array<float,2>{0.325691342f, 0.195674986f},
-std::array<float,2>{0.451575458f, 0.727686167f},
-std::array<float,2>{0.952900231f, 0.103989266f},
-std::array<float,2>{0.505971432f, 0.96263504f},
-std::array<float,2>{0.111473843f, 0.417089015f},
-std::array<float,2>{0.205072269f, 0.547660649f},
-std::array<float,2>{0.724985778f, 0.192796037f},
-std::array<float,2>{0.859325945f, 0.801695526f},
-std::array<float,2>{0.295987457f, 0.319058865f},
-std::array<float,2>{0.433482707f, 0.958147466f},
-std::array<float,2>{0.894776881f, 0.413916349f},
-std::array<float,2>{0.590818763f, 0.721113145f},
-std::array<float,2>{0.00331755984f, 0.0993008986f},
-std::array<float,2>{0.0986728221f, 0.874410868f},
-std::array<float,2>{0.51670891f, 0.267376363f},
-std::array<float,2>{0.957299471f, 0.603932619f},
-std::array<float,2>{0.455883056f, 0.12580505f},
-std::array<float,2>{0.337931901f, 0.627126038f},
-std::array<float,2>{0.77640444f, 0.0266453847f},
-std::array<float,2>{0.635674357f, 0.88267678f},
-std::array<float,2>{0.151470795f, 0.494564086f},
-std::array<float,2>{0.0447806083f, 0.689290404f},
-std::array<float,2>{0.612810016f, 0.0741955191f},
-std::array<float,2>{0.909761727f, 0.993468404f},
-std::array<float,2>{0.39356789f, 0.393944025f},
-std::array<float,2>{0.259355277f, 0.756286442f},
-std::array<float,2>{0.81858629f, 0.348626018f},
-std::array<float,2>{0.709535062f, 0.505616188f},
-std::array<float,2>{0.236882553f, 0.230347469f},
-std::array<float,2>{0.169478923f, 0.920173049f},
-std::array<float,2>{0.672985554f, 0.439964801f},
-std::array<float,2>{0.795466959f, 0.676741421f},
-std::array<float,2>{0.361331701f, 0.0382840186f},
-std::array<float,2>{0.469886631f, 0.569497168f},
-std::array<float,2>{0.984763205f, 0.182573169f},
-std::array<float,2>{0.551267028f, 0.836292744f},
-std::array<float,2>{0.0817027092f, 0.300672531f},
-std::array<float,2>{0.135102034f, 0.669351399f},
-std::array<float,2>{0.647348762f, 0.0529616997f},
-std::array<float,2>{0.751034737f, 0.923269451f},
-std::array<float,2>{0.321549118f, 0.462634772f},
-std::array<float,2>{0.445464671f, 0.821668446f},
-std::array<float,2>{0.949128211f, 0.282648653f},
-std::array<float,2>{0.500155807f, 0.592836142f},
-std::array<float,2>{0.115711868f, 0.171587154f},
-std::array<float,2>{0.0244941507f, 0.972025216f},
-std::array<float,2>{0.578102052f, 0.386268109f},
-std::array<float,2>{0.880760849f, 0.714164019f},
-std::array<float,2>{0.41108489f, 0.0828425661f},
-std::array<float,2>{0.300116271f, 0.51938802f},
-std::array<float,2>{0.873673081f, 0.244587198f},
-std::array<float,2>{0.737447202f, 0.780254602f},
-std::array<float,2>{0.190263301f, 0.360824853f},
-std::array<float,2>{0.077508539f, 0.610171854f},
-std::array<float,2>{0.544270635f, 0.141582906f},
-std::array<float,2>{0.977293789f, 0.854899049f},
-std::array<float,2>{0.499454141f, 0.253337473f},
-std::array<float,2>{0.344466835f, 0.892982006f},
-std::array<float,2>{0.798506856f, 0.469611853f},
-std::array<float,2>{0.66144681f, 0.641904414f},
-std::array<float,2>{0.172911912f, 0.00814406853f},
-std::array<float,2>{0.233242825f, 0.785741687f},
-std::array<float,2>{0.691016436f, 0.343743116f},
-std::array<float,2>{0.841883302f, 0.538197339f},
-std::array<float,2>{0.272488356f, 0.205621809f},
-std::array<float,2>{0.380763054f, 0.745092452f},
-std::array<float,2>{0.924794018f, 0.122444451f},
-std::array<float,2>{0.602450967f, 0.943871439f},
-std::array<float,2>{0.0534594618f, 0.426367015f},
-std::array<float,2>{0.181231454f, 0.582953632f},
-std::array<float,2>{0.666074038f, 0.161098167f},
-std::array<float,2>{0.810102165f, 0.813517749f},
-std::array<float,2>{0.35301742f, 0.295645356f},
-std::array<float,2>{0.48700881f, 0.930124521f},
-std::array<float,2>{0.970689416f, 0.460520059f},
-std::array<float,2>{0.538832724f, 0.662072182f},
-std::array<float,2>{0.0685688779f, 0.0610794239f},
-std::array<float,2>{0.0588022694f, 0.772491395f},
-std::array<float,2>{0.599772155f, 0.369322181f},
-std::array<float,2>{0.936358571f, 0.527819872f},
-std::array<float,2>{0.388039619f, 0.239974678f},
-std::array<float,2>{0.279022932f, 0.710651517f},
-std::array<float,2>{0.835524976f, 0.0933525339f},
-std::array<float,2>{0.700799644f, 0.980137646f},
-std::array<float,2>{0.22296527f, 0.382226914f},
-std::array<float,2>{0.118282944f, 0.656143129f},
-std::array<float,2>{0.512534201f, 0.00265593361f},
-std::array<float,2>{0.940278649f, 0.900057495f},
-std::array<float,2>{0.438076466f, 0.478340954f},
-std::array<float,2>{0.313004494f, 0.847935557f},
-std::array<float,2>{0.763157547f, 0.260550559f},
-std::array<float,2>{0.64845109f, 0.621897221f},
-std::array<float,2>{0.130630493f, 0.149150327f},
-std::array<float,2>{0.20053485f, 0.952918589f},
-std::array<float,2>{0.748202443f, 0.431022018f},
-std::array<float,2>{0.864414811f, 0.736925781f},
-std::array<float,2>{0.312265694f, 0.111693837f},
-std::array<float,2>{0.42014882f, 0.541644514f},
-std::array<float,2>{0.887744546f, 0.216607571f},
-std::array<float,2>{0.567561984f, 0.795728862f},
-std::array<float,2>{0.017727565f, 0.333449215f},
-std::array<float,2>{0.243603602f, 0.731791317f},
-std::array<float,2>{0.711215496f, 0.108780563f},
-std::array<float,2>{0.823074937f, 0.965860724f},
-std::array<float,2>{0.251916975f, 0.41853407f},
-std::array<float,2>{0.405502141f, 0.809613585f},
-std::array<float,2>{0.919983149f, 0.321144283f},
-std::array<float,2>{0.621764183f, 0.557768345f},
-std::array<float,2>{0.0373377427f, 0.200569928f},
-std::array<float,2>{0.0886231437f, 0.88473016f},
-std::array<float,2>{0.55751425f, 0.488138944f},
-std::array<float,2>{0.996599019f, 0.637093782f},
-std::array<float,2>{0.481541306f, 0.0211221054f},
-std::array<float,2>{0.367607653f, 0.598465323f},
-std::array<float,2>{0.78553617f, 0.136004508f},
-std::array<float,2>{0.684016764f, 0.863173962f},
-std::array<float,2>{0.159426361f, 0.278082818f},
-std::array<float,2>{0.0112563893f, 0.514103591f},
-std::array<float,2>{0.584640861f, 0.221263006f},
-std::array<float,2>{0.899262965f, 0.763895452f},
-std::array<float,2>{0.423936814f, 0.356643945f},
-std::array<float,2>{0.282947153f, 0.98686552f},
-std::array<float,2>{0.844910383f, 0.406061739f},
-std::array<float,2>{0.731122196f, 0.69541961f},
-std::array<float,2>{0.211266249f, 0.0702406317f},
-std::array<float,2>{0.147482052f, 0.830276668f},
-std::array<float,2>{0.626385391f, 0.305132568f},
-std::array<float,2>{0.772740722f, 0.573308349f},
-std::array<float,2>{0.330771834f, 0.171959698f},
-std::array<float,2>{0.467434764f, 0.685258687f},
-std::array<float,2>{0.967619658f, 0.044646129f},
-std::array<float,2>{0.525609553f, 0.911039531f},
-std::array<float,2>{0.104622275f, 0.449617326f},
-std::array<float,2>{0.222104207f, 0.607113063f},
-std::array<float,2>{0.69743824f, 0.130988941f},
-std::array<float,2>{0.831442356f, 0.870852232f},
-std::array<float,2>{0.2763381f, 0.270600319f},
-std::array<float,2>{0.385993659f, 0.875659585f},
-std::array<float,2>{0.93347764f, 0.496686608f},
-std::array<float,2>{0.594909847f, 0.630606115f},
-std::array<float,2>{0.0585512668f, 0.0290579107f},
-std::array<float,2>{0.0635572374f, 0.798374772f},
-std::array<float,2>{0.534538925f, 0.315857232f},
-std::array<float,2>{0.975117028f, 0.551197112f},
-std::array<float,2>{0.491585284f, 0.190059349f},
-std::array<float,2>{0.358346075f, 0.725664735f},
-std::array<float,2>{0.807480395f, 0.0947156549f},
-std::array<float,2>{0.671849608f, 0.954725206f},
-std::array<float,2>{0.183658242f, 0.408535153f},
-std::array<float,2>{0.0223736539f, 0.674852192f},
-std::array<float,2>{0.564628422f, 0.0337846391f},
-std::array<float,2>{0.885478556f, 0.916269898f},
-std::array<float,2>{0.417461663f, 0.444875509f},
-std::array<float,2>{0.306966305f, 0.843358219f},
-std::array<float,2>{0.860300541f, 0.303008378f},
-std::array<float,2>{0.742648602f, 0.562925696f},
-std::array<float,2>{0.1984092f, 0.186770737f},
-std::array<float,2>{0.12642245f, 0.998975098f},
-std::array<float,2>{0.653166533f, 0.39768374f},
-std::array<float,2>{0.760242701f, 0.693655252f},
-std::array<float,2>{0.318087339f, 0.0765036494f},
-std::array<float,2>{0.443344504f, 0.502222657f},
-std::array<float,2>{0.943337977f, 0.233642906f},
-std::array<float,2>{0.510577202f, 0.750858843f},
-std::array<float,2>{0.124490753f, 0.34529075f},
-std::array<float,2>{0.161284089f, 0.717574298f},
-std::array<float,2>{0.682065308f, 0.0808820277f},
-std::array<float,2>{0.783068538f, 0.976094246f},
-std::array<float,2>{0.372235149f, 0.388160586f},
-std::array<float,2>{0.479559988f, 0.776193976f},
-std::array<float,2>{0.994753361f, 0.363700092f},
-std::array<float,2>{0.56248486f, 0.52013278f},
-std::array<float,2>{0.0913460925f, 0.248478875f},
-std::array<float,2>{0.0312955678f, 0.929372668f},
-std::array<float,2>{0.61890465f, 0.465501308f},
-std::array<float,2>{0.914155543f, 0.666471124f},
-std::array<float,2>{0.400663644f, 0.0489508919f},
-std::array<float,2>{0.257238418f, 0.586952686f},
-std::array<float,2>{0.825338662f, 0.165705174f},
-std::array<float,2>{0.717499137f, 0.827196121f},
-std::array<float,2>{0.248677358f, 0.288812757f},
-std::array<float,2>{0.106743731f, 0.533667743f},
-std::array<float,2>{0.528660953f, 0.209553853f},
-std::array<float,2>{0.961609185f, 0.782740116f},
-std::array<float,2>{0.463317633f, 0.339521885f},
-std::array<float,2>{0.334008217f, 0.937520325f},
-std::array<float,2>{0.769366443f, 0.424779058f},
-std::array<float,2>{0.631793022f, 0.747418404f},
-std::array<float,2>{0.141863808f, 0.119193278f},
-std::array<float,2>{0.218719721f, 0.856486499f},
-std::array<float,2>{0.730106831f, 0.25716719f},
-std::array<float,2>{0.848335862f, 0.616029024f},
-std::array<float,2>{0.287549973f, 0.146854922f},
-std::array<float,2>{0.427783191f, 0.645079076f},
-std::array<float,2>{0.902456462f, 0.012408183f},
-std::array<float,2>{0.5782516f, 0.895076454f},
-std::array<float,2>{0.013179278f, 0.473527133f},
-std::array<float,2>{0.15319553f, 0.524492383f},
-std::array<float,2>{0.639661729f, 0.236220255f},
-std::array<float,2>{0.779011548f, 0.766655564f},
-std::array<float,2>{0.343431592f, 0.373297125f},
-std::array<float,2>{0.458630472f, 0.981315911f},
-std::array<float,2>{0.956658483f, 0.376957387f},
-std::array<float,2>{0.52126801f, 0.706296146f},
-std::array<float,2>{0.0961408392f, 0.088541545f},
-std::array<float,2>{0.00670627924f, 0.816590905f},
-std::array<float,2>{0.588485837f, 0.292176247f},
-std::array<float,2>{0.894146502f, 0.581352353f},
-std::array<float,2>{0.436441064f, 0.157311022f},
-std::array<float,2>{0.289275318f, 0.659814715f},
-std::array<float,2>{0.854662657f, 0.0579420812f},
-std::array<float,2>{0.71952188f, 0.935219705f},
-std::array<float,2>{0.208093435f, 0.453659028f},
-std::array<float,2>{0.083643809f, 0.741590381f},
-std::array<float,2>{0.547014773f, 0.117039874f},
-std::array<float,2>{0.990898132f, 0.945957899f},
-std::array<float,2>{0.47401613f, 0.434295088f},
-std::array<float,2>{0.366511613f, 0.791231573f},
-std::array<float,2>{0.790623784f, 0.329585344f},
-std::array<float,2>{0.678825438f, 0.546418309f},
-std::array<float,2>{0.16730836f, 0.21133846f},
-std::array<float,2>{0.241032615f, 0.905112982f},
-std::array<float,2>{0.705604017f, 0.484294295f},
-std::array<float,2>{0.813005567f, 0.649994016f},
-std::array<float,2>{0.262706488f, 0.00495660771f},
-std::array<float,2>{0.397905886f, 0.619713426f},
-std::array<float,2>{0.912814677f, 0.154886335f},
-std::array<float,2>{0.61563015f, 0.847204149f},
-std::array<float,2>{0.0391988009f, 0.262887567f},
-std::array<float,2>{0.193377733f, 0.636612177f},
-std::array<float,2>{0.741388202f, 0.0172134414f},
-std::array<float,2>{0.87007606f, 0.887327254f},
-std::array<float,2>{0.303945214f, 0.490643531f},
-std::array<float,2>{0.406618446f, 0.864816606f},
-std::array<float,2>{0.877694249f, 0.275933653f},
-std::array<float,2>{0.571241081f, 0.59424144f},
-std::array<float,2>{0.0293134544f, 0.137446091f},
-std::array<float,2>{0.11053057f, 0.963224769f},
-std::array<float,2>{0.504545093f, 0.414748609f},
-std::array<float,2>{0.951158464f, 0.73041749f},
-std::array<float,2>{0.449608713f, 0.102193326f},
-std::array<float,2>{0.327126533f, 0.561116934f},
-std::array<float,2>{0.757041991f, 0.199015692f},
-std::array<float,2>{0.641572535f, 0.807726324f},
-std::array<float,2>{0.138754919f, 0.326820284f},
-std::array<float,2>{0.0504832529f, 0.574873269f},
-std::array<float,2>{0.608838916f, 0.175828651f},
-std::array<float,2>{0.927431822f, 0.832878768f},
-std::array<float,2>{0.375835568f, 0.30904299f},
-std::array<float,2>{0.265907943f, 0.907795966f},
-std::array<float,2>{0.837602496f, 0.445314795f},
-std::array<float,2>{0.693495631f, 0.681146741f},
-std::array<float,2>{0.228380397f, 0.0393248945f},
-std::array<float,2>{0.179463312f, 0.758351207f},
-std::array<float,2>{0.658453166f, 0.35469678f},
-std::array<float,2>{0.804188848f, 0.509695709f},
-std::array<float,2>{0.349729449f, 0.223910645f},
-std::array<float,2>{0.495633274f, 0.701997697f},
-std::array<float,2>{0.983148813f, 0.0642476752f},
-std::array<float,2>{0.542284727f, 0.992066383f},
-std::array<float,2>{0.0741926953f, 0.401432097f},
-std::array<float,2>{0.191181391f, 0.517238379f},
-std::array<float,2>{0.736359596f, 0.242453068f},
-std::array<float,2>{0.874136865f, 0.778403938f},
-std::array<float,2>{0.298968822f, 0.363148451f},
-std::array<float,2>{0.412073016f, 0.969649673f},
-std::array<float,2>{0.879459262f, 0.384310991f},
-std::array<float,2>{0.576392114f, 0.710981846f},
-std::array<float,2>{0.0241481382f, 0.0859284103f},
-std::array<float,2>{0.116738379f, 0.823609054f},
-std::array<float,2>{0.501634777f, 0.28507483f},
-std::array<float,2>{0.947942078f, 0.591396153f},
-std::array<float,2>{0.447038412f, 0.168500006f},
-std::array<float,2>{0.320989728f, 0.670841694f},
-std::array<float,2>{0.750709713f, 0.0508327223f},
-std::array<float,2>{0.647737682f, 0.925021291f},
-std::array<float,2>{0.136313125f, 0.46419698f},
-std::array<float,2>{0.0546603091f, 0.743213415f},
-std::array<float,2>{0.602547526f, 0.123876832f},
-std::array<float,2>{0.924862504f, 0.943193376f},
-std::array<float,2>{0.379039019f, 0.429077864f},
-std::array<float,2>{0.271621227f, 0.787936926f},
-std::array<float,2>{0.84357971f, 0.341531903f},
-std::array<float,2>{0.690323472f, 0.536100924f},
-std::array<float,2>{0.234237522f, 0.203854218f},
-std::array<float,2>{0.172493488f, 0.891831696f},
-std::array<float,2>{0.660626352f, 0.472637087f},
-std::array<float,2>{0.797393024f, 0.643441319f},
-std::array<float,2>{0.345102519f, 0.0113069089f},
-std::array<float,2>{0.498601675f, 0.613238811f},
-std::array<float,2>{0.978226602f, 0.142731339f},
-std::array<float,2>{0.543358862f, 0.852164507f},
-std::array<float,2>{0.076652132f, 0.250014931f},
-std::array<float,2>{0.150781304f, 0.625805438f},
-std::array<float,2>{0.636249006f, 0.0239397902f},
-std::array<float,2>{0.775918424f, 0.879524827f},
-std::array<float,2>{0.33953926f, 0.49330008f},
-std::array<float,2>{0.456397414f, 0.872649968f},
-std::array<float,2>{0.958564997f, 0.26922673f},
-std::array<float,2>{0.515721142f, 0.602270782f},
-std::array<float,2>{0.0983032659f, 0.127885878f},
-std::array<float,2>{0.00206652377f, 0.960031927f},
-std::array<float,2>{0.591181934f, 0.41197902f},
-std::array<float,2>{0.896052182f, 0.719693005f},
-std::array<float,2>{0.432022452f, 0.100425228f},
-std::array<float,2>{0.295135468f, 0.549810648f},
-std::array<float,2>{0.858052194f, 0.195042267f},
-std::array<float,2>{0.72579807f, 0.804605603f},
-std::array<float,2>{0.203221262f, 0.316830873f},
-std::array<float,2>{0.080862239f, 0.56784004f},
-std::array<float,2>{0.552312732f, 0.180860132f},
-std::array<float,2>{0.985803008f, 0.838731229f},
-std::array<float,2>{0.469385892f, 0.29877466f},
-std::array<float,2>{0.363108307f, 0.91985327f},
-std::array<float,2>{0.796381295f, 0.438909084f},
-std::array<float,2>{0.671929121f, 0.679673672f},
-std::array<float,2>{0.16819565f, 0.0352015793f},
-std::array<float,2>{0.237976134f, 0.754430532f},
-std::array<float,2>{0.710019767f, 0.350651741f},
-std::array<float,2>{0.820190191f, 0.506883264f},
-std::array<float,2>{0.258554518f, 0.227868333f},
-std::array<float,2>{0.393316895f, 0.690570116f},
-std::array<float,2>{0.909154952f, 0.0710433722f},
-std::array<float,2>{0.611446381f, 0.995891094f},
-std::array<float,2>{0.0437485389f, 0.392333001f},
-std::array<float,2>{0.158713654f, 0.601241827f},
-std::array<float,2>{0.684954047f, 0.133115187f},
-std::array<float,2>{0.786301672f, 0.860463202f},
-std::array<float,2>{0.368678212f, 0.280084014f},
-std::array<float,2>{0.481432945f, 0.88644737f},
-std::array<float,2>{0.997098386f, 0.484846532f},
-std::array<float,2>{0.557706594f, 0.640147924f},
-std::array<float,2>{0.0892527327f, 0.022811735f},
-std::array<float,2>{0.0382038057f, 0.810749292f},
-std::array<float,2>{0.622924209f, 0.323097527f},
-std::array<float,2>{0.921018243f, 0.55485791f},
-std::array<float,2>{0.404407203f, 0.203063592f},
-std::array<float,2>{0.250510752f, 0.734374642f},
-std::array<float,2>{0.823464513f, 0.106710911f},
-std::array<float,2>{0.712488413f, 0.968272865f},
-std::array<float,2>{0.24251011f, 0.421631128f},
-std::array<float,2>{0.104193963f, 0.685801566f},
-std::array<float,2>{0.526684284f, 0.0462060384f},
-std::array<float,2>{0.968706012f, 0.912694097f},
-std::array<float,2>{0.468044877f, 0.451608717f},
-std::array<float,2>{0.331567645f, 0.829903424f},
-std::array<float,2>{0.771822989f, 0.307254165f},
-std::array<float,2>{0.625346005f, 0.570328295f},
-std::array<float,2>{0.146975145f, 0.17513597f},
-std::array<float,2>{0.212249011f, 0.984784365f},
-std::array<float,2>{0.731505156f, 0.402522117f},
-std::array<float,2>{0.843949616f, 0.697935522f},
-std::array<float,2>{0.281426042f, 0.0669795796f},
-std::array<float,2>{0.425767273f, 0.512275398f},
-std::array<float,2>{0.900149763f, 0.219400495f},
-std::array<float,2>{0.585462093f, 0.762502491f},
-std::array<float,2>{0.0103102f, 0.357556522f},
-std::array<float,2>{0.224071845f, 0.708454669f},
-std::array<float,2>{0.700179696f, 0.0903829634f},
-std::array<float,2>{0.834196985f, 0.978370309f},
-std::array<float,2>{0.278301716f, 0.378994226f},
-std::array<float,2>{0.387460947f, 0.770639598f},
-std::array<float,2>{0.937413752f, 0.368798107f},
-std::array<float,2>{0.601468623f, 0.530419648f},
-std::array<float,2>{0.0598692782f, 0.241318822f},
-std::array<float,2>{0.0693917051f, 0.933209658f},
-std::array<float,2>{0.537180841f, 0.45781067f},
-std::array<float,2>{0.969086349f, 0.663023293f},
-std::array<float,2>{0.487808794f, 0.0596624315f},
-std::array<float,2>{0.351587713f, 0.585373223f},
-std::array<float,2>{0.809222639f, 0.163073942f},
-std::array<float,2>{0.667811334f, 0.814526141f},
-std::array<float,2>{0.180467576f, 0.293542206f},
-std::array<float,2>{0.0187650081f, 0.539381921f},
-std::array<float,2>{0.566779077f, 0.218697295f},
-std::array<float,2>{0.887504518f, 0.793772221f},
-std::array<float,2>{0.42107445f, 0.334043205f},
-std::array<float,2>{0.310862243f, 0.950293005f},
-std::array<float,2>{0.863296807f, 0.432595849f},
-std::array<float,2>{0.74960655f, 0.73526305f},
-std::array<float,2>{0.199766263f, 0.110487543f},
-std::array<float,2>{0.129563019f, 0.850614786f},
-std::array<float,2>{0.649843395f, 0.259579927f},
-std::array<float,2>{0.762667835f, 0.623217404f},
-std::array<float,2>{0.313914418f, 0.152311727f},
-std::array<float,2>{0.438824207f, 0.65408659f},
-std::array<float,2>{0.941328883f, 0.00121776422f},
-std::array<float,2>{0.513049126f, 0.901077986f},
-std::array<float,2>{0.117342845f, 0.479287386f},
-std::array<float,2>{0.249954939f, 0.589713991f},
-std::array<float,2>{0.718617797f, 0.167113647f},
-std::array<float,2>{0.825069487f, 0.826124251f},
-std::array<float,2>{0.256163687f, 0.286259413f},
-std::array<float,2>{0.402136564f, 0.927697539f},
-std::array<float,2>{0.915930986f, 0.467264742f},
-std::array<float,2>{0.617861748f, 0.664824128f},
-std::array<float,2>{0.0330647491f, 0.0469341651f},
-std::array<float,2>{0.0905323103f, 0.773771346f},
-std::array<float,2>{0.560952425f, 0.366678357f},
-std::array<float,2>{0.995657027f, 0.522163987f},
-std::array<float,2>{0.479340464f, 0.247751474f},
-std::array<float,2>{0.372011036f, 0.716736078f},
-std::array<float,2>{0.781958878f, 0.079359211f},
-std::array<float,2>{0.683533251f, 0.973942637f},
-std::array<float,2>{0.160479769f, 0.389348984f},
-std::array<float,2>{0.0121416096f, 0.647856295f},
-std::array<float,2>{0.58004874f, 0.0140065486f},
-std::array<float,2>{0.903368533f, 0.897305787f},
-std::array<float,2>{0.429685742f, 0.474964291f},
-std::array<float,2>{0.288546205f, 0.858486295f},
-std::array<float,2>{0.849520206f, 0.254233181f},
-std::array<float,2>{0.728830338f, 0.615234256f},
-std::array<float,2>{0.217701241f, 0.144997731f},
-std::array<float,2>{0.141233414f, 0.941248775f},
-std::array<float,2>{0.632741272f, 0.422427356f},
-std::array<float,2>{0.767670512f, 0.749612927f},
-std::array<float,2>{0.335654467f, 0.118298136f},
-std::array<float,2>{0.464621216f, 0.532153189f},
-std::array<float,2>{0.96191889f, 0.208003625f},
-std::array<float,2>{0.528087854f, 0.78336668f},
-std::array<float,2>{0.106042512f, 0.336915284f},
-std::array<float,2>{0.185417756f, 0.724580407f},
-std::array<float,2>{0.6705212f, 0.0976321399f},
-std::array<float,2>{0.808565438f, 0.956170857f},
-std::array<float,2>{0.35918951f, 0.408062994f},
-std::array<float,2>{0.490957916f, 0.800408781f},
-std::array<float,2>{0.975924194f, 0.314089805f},
-std::array<float,2>{0.533810616f, 0.553231776f},
-std::array<float,2>{0.0628391281f, 0.188833311f},
-std::array<float,2>{0.0570002347f, 0.877087176f},
-std::array<float,2>{0.594359159f, 0.498901337f},
-std::array<float,2>{0.931986272f, 0.631021082f},
-std::array<float,2>{0.385592699f, 0.0300741177f},
-std::array<float,2>{0.276631534f, 0.608523607f},
-std::array<float,2>{0.83044982f, 0.130082726f},
-std::array<float,2>{0.698479593f, 0.8679353f},
-std::array<float,2>{0.221038058f, 0.271841496f},
-std::array<float,2>{0.123454794f, 0.501792312f},
-std::array<float,2>{0.511006296f, 0.230883494f},
-std::array<float,2>{0.942035139f, 0.752913356f},
-std::array<float,2>{0.442086697f, 0.347412527f},
-std::array<float,2>{0.317033976f, 0.996161222f},
-std::array<float,2>{0.761713147f, 0.39619115f},
-std::array<float,2>{0.653633595f, 0.692952871f},
-std::array<float,2>{0.12550132f, 0.0761504173f},
-std::array<float,2>{0.197941571f, 0.840759635f},
-std::array<float,2>{0.743762434f, 0.30138737f},
-std::array<float,2>{0.860672593f, 0.566391408f},
-std::array<float,2>{0.308103293f, 0.184288964f},
-std::array<float,2>{0.416719019f, 0.672415137f},
-std::array<float,2>{0.886238515f, 0.0320532769f},
-std::array<float,2>{0.565929592f, 0.915854335f},
-std::array<float,2>{0.0233136248f, 0.442766011f},
-std::array<float,2>{0.140346959f, 0.559142351f},
-std::array<float,2>{0.641818166f, 0.196405053f},
-std::array<float,2>{0.756130517f, 0.805178523f},
-std::array<float,2>{0.327641934f, 0.324360102f},
-std::array<float,2>{0.450623482f, 0.961211562f},
-std::array<float,2>{0.949700058f, 0.416836292f},
-std::array<float,2>{0.505629301f, 0.727004707f},
-std::array<float,2>{0.109569781f, 0.105204388f},
-std::array<float,2>{0.0302869398f, 0.865879178f},
-std::array<float,2>{0.572217047f, 0.274537593f},
-std::array<float,2>{0.878474355f, 0.596750975f},
-std::array<float,2>{0.407491744f, 0.138720781f},
-std::array<float,2>{0.302884787f, 0.63288337f},
-std::array<float,2>{0.870912433f, 0.0190853849f},
-std::array<float,2>{0.740761876f, 0.890410185f},
-std::array<float,2>{0.195102766f, 0.48878634f},
-std::array<float,2>{0.0732184127f, 0.699567199f},
-std::array<float,2>{0.541875601f, 0.0646998137f},
-std::array<float,2>{0.98426795f, 0.989454865f},
-std::array<float,2>{0.495003223f, 0.400193781f},
-std::array<float,2>{0.35111025f, 0.760557711f},
-std::array<float,2>{0.802924216f, 0.351715386f},
-std::array<float,2>{0.65918988f, 0.5097875f},
-std::array<float,2>{0.178518966f, 0.226362303f},
-std::array<float,2>{0.226814955f, 0.908781409f},
-std::array<float,2>{0.694402933f, 0.447581142f},
-std::array<float,2>{0.836547613f, 0.682523191f},
-std::array<float,2>{0.267017126f, 0.0422939248f},
-std::array<float,2>{0.376046658f, 0.577484488f},
-std::array<float,2>{0.925822198f, 0.178045347f},
-std::array<float,2>{0.608296454f, 0.835591733f},
-std::array<float,2>{0.0494804643f, 0.312431216f},
-std::array<float,2>{0.207541466f, 0.65735358f},
-std::array<float,2>{0.719818652f, 0.0558770783f},
-std::array<float,2>{0.854186535f, 0.936107934f},
-std::array<float,2>{0.290318012f, 0.455419958f},
-std::array<float,2>{0.43673259f, 0.818606317f},
-std::array<float,2>{0.893168688f, 0.290204197f},
-std::array<float,2>{0.589195251f, 0.579556167f},
-std::array<float,2>{0.00725535164f, 0.159954444f},
-std::array<float,2>{0.0971802771f, 0.982614815f},
-std::array<float,2>{0.519538522f, 0.376728237f},
-std::array<float,2>{0.955373049f, 0.703528404f},
-std::array<float,2>{0.457960069f, 0.0861590952f},
-std::array<float,2>{0.342114747f, 0.526284337f},
-std::array<float,2>{0.777708352f, 0.237819046f},
-std::array<float,2>{0.639498413f, 0.769302011f},
-std::array<float,2>{0.153645486f, 0.372731626f},
-std::array<float,2>{0.0404898971f, 0.618996859f},
-std::array<float,2>{0.616383612f, 0.153186888f},
-std::array<float,2>{0.913916111f, 0.844442725f},
-std::array<float,2>{0.396833539f, 0.265443206f},
-std::array<float,2>{0.262366951f, 0.903604746f},
-std::array<float,2>{0.814042211f, 0.482320279f},
-std::array<float,2>{0.706329346f, 0.651232004f},
-std::array<float,2>{0.24205257f, 0.00589049468f},
-std::array<float,2>{0.166747957f, 0.789355755f},
-std::array<float,2>{0.678414106f, 0.331634313f},
-std::array<float,2>{0.789727747f, 0.544423342f},
-std::array<float,2>{0.365357667f, 0.213941455f},
-std::array<float,2>{0.472880393f, 0.73875314f},
-std::array<float,2>{0.99188149f, 0.114046f},
-std::array<float,2>{0.548608959f, 0.948282719f},
-std::array<float,2>{0.0823667645f, 0.437219858f},
-std::array<float,2>{0.232010916f, 0.537706256f},
-std::array<float,2>{0.688827574f, 0.206680998f},
-std::array<float,2>{0.841531277f, 0.786451817f},
-std::array<float,2>{0.269881696f, 0.341908902f},
-std::array<float,2>{0.381815642f, 0.945269942f},
-std::array<float,2>{0.923433542f, 0.42720437f},
-std::array<float,2>{0.604911804f, 0.745321274f},
-std::array<float,2>{0.0524968579f, 0.121202618f},
-std::array<float,2>{0.0749052614f, 0.854063272f},
-std::array<float,2>{0.546412528f, 0.252207041f},
-std::array<float,2>{0.980167687f, 0.611207187f},
-std::array<float,2>{0.498013139f, 0.141939178f},
-std::array<float,2>{0.346230268f, 0.640962005f},
-std::array<float,2>{0.79961884f, 0.00951015204f},
-std::array<float,2>{0.662518084f, 0.893847227f},
-std::array<float,2>{0.175672323f, 0.470495522f},
-std::array<float,2>{0.0269613266f, 0.713257194f},
-std::array<float,2>{0.574280202f, 0.0837667212f},
-std::array<float,2>{0.881575286f, 0.971428692f},
-std::array<float,2>{0.412462801f, 0.384971619f},
-std::array<float,2>{0.297962666f, 0.780455112f},
-std::array<float,2>{0.871272147f, 0.360042274f},
-std::array<float,2>{0.735810459f, 0.517891765f},
-std::array<float,2>{0.188738659f, 0.24518761f},
-std::array<float,2>{0.13414453f, 0.922111332f},
-std::array<float,2>{0.645472705f, 0.461537331f},
-std::array<float,2>{0.753723681f, 0.668099344f},
-std::array<float,2>{0.323928565f, 0.0538136624f},
-std::array<float,2>{0.448146462f, 0.592258513f},
-std::array<float,2>{0.945435226f, 0.170184404f},
-std::array<float,2>{0.502667665f, 0.82078898f},
-std::array<float,2>{0.114463426f, 0.282159567f},
-std::array<float,2>{0.171253383f, 0.677059174f},
-std::array<float,2>{0.675773859f, 0.0380485281f},
-std::array<float,2>{0.794829667f, 0.92098403f},
-std::array<float,2>{0.360656768f, 0.440868825f},
-std::array<float,2>{0.470760792f, 0.837047875f},
-std::array<float,2>{0.988197029f, 0.29934001f},
-std::array<float,2>{0.552837253f, 0.569120646f},
-std::array<float,2>{0.0800698772f, 0.183043122f},
-std::array<float,2>{0.0463517942f, 0.992956281f},
-std::array<float,2>{0.609387815f, 0.392662466f},
-std::array<float,2>{0.906715095f, 0.687660575f},
-std::array<float,2>{0.392247915f, 0.0723823011f},
-std::array<float,2>{0.260660917f, 0.504393339f},
-std::array<float,2>{0.818206072f, 0.229124174f},
-std::array<float,2>{0.708580315f, 0.757521272f},
-std::array<float,2>{0.23580268f, 0.349313349f},
-std::array<float,2>{0.100261457f, 0.604522049f},
-std::array<float,2>{0.517892718f, 0.126385644f},
-std::array<float,2>{0.960343957f, 0.873776615f},
-std::array<float,2>{0.453349918f, 0.266072363f},
-std::array<float,2>{0.336176902f, 0.881016254f},
-std::array<float,2>{0.774897516f, 0.495428115f},
-std::array<float,2>{0.632914007f, 0.628736854f},
-std::array<float,2>{0.149018556f, 0.0257731471f},
-std::array<float,2>{0.206859022f, 0.801941931f},
-std::array<float,2>{0.723746181f, 0.319875956f},
-std::array<float,2>{0.857259512f, 0.548727334f},
-std::array<float,2>{0.294262379f, 0.191693678f},
-std::array<float,2>{0.430305332f, 0.721742153f},
-std::array<float,2>{0.897816181f, 0.0979556739f},
-std::array<float,2>{0.593746245f, 0.95752418f},
-std::array<float,2>{0.000103056125f, 0.413072228f},
-std::array<float,2>{0.144717246f, 0.57308203f},
-std::array<float,2>{0.628230214f, 0.173684224f},
-std::array<float,2>{0.770112216f, 0.831520081f},
-std::array<float,2>{0.330006838f, 0.305673748f},
-std::array<float,2>{0.466512889f, 0.91177845f},
-std::array<float,2>{0.965652227f, 0.450652331f},
-std::array<float,2>{0.525214255f, 0.684453726f},
-std::array<float,2>{0.102487445f, 0.0437333062f},
-std::array<float,2>{0.00930198468f, 0.76511389f},
-std::array<float,2>{0.583862185f, 0.356072754f},
-std::array<float,2>{0.90080303f, 0.515275896f},
-std::array<float,2>{0.42233026f, 0.221910074f},
-std::array<float,2>{0.284570366f, 0.697065771f},
-std::array<float,2>{0.846689165f, 0.0692817494f},
-std::array<float,2>{0.733291447f, 0.987578809f},
-std::array<float,2>{0.213655591f, 0.40447098f},
-std::array<float,2>{0.0877745375f, 0.638627887f},
-std::array<float,2>{0.554897308f, 0.0200741757f},
-std::array<float,2>{0.999457538f, 0.883584201f},
-std::array<float,2>{0.483546853f, 0.486355513f},
-std::array<float,2>{0.37093091f, 0.86166811f},
-std::array<float,2>{0.788598597f, 0.27869761f},
-std::array<float,2>{0.68662256f, 0.598816514f},
-std::array<float,2>{0.158100545f, 0.135203421f},
-std::array<float,2>{0.24525243f, 0.965778947f},
-std::array<float,2>{0.713663757f, 0.419195265f},
-std::array<float,2>{0.821750939f, 0.730794072f},
-std::array<float,2>{0.252635092f, 0.107960649f},
-std::array<float,2>{0.404018193f, 0.556881189f},
-std::array<float,2>{0.918571889f, 0.199262783f},
-std::array<float,2>{0.624044061f, 0.809241176f},
-std::array<float,2>{0.0370280519f, 0.321549982f},
-std::array<float,2>{0.201414362f, 0.737911761f},
-std::array<float,2>{0.74622345f, 0.112864204f},
-std::array<float,2>{0.866682649f, 0.951972663f},
-std::array<float,2>{0.310513973f, 0.429829001f},
-std::array<float,2>{0.419229716f, 0.796836495f},
-std::array<float,2>{0.890287876f, 0.33238405f},
-std::array<float,2>{0.570186257f, 0.542264581f},
-std::array<float,2>{0.0163426716f, 0.215196088f},
-std::array<float,2>{0.119965881f, 0.899284542f},
-std::array<float,2>{0.514342904f, 0.476921558f},
-std::array<float,2>{0.938222945f, 0.654960275f},
-std::array<float,2>{0.440737545f, 0.00361033762f},
-std::array<float,2>{0.315883219f, 0.622782588f},
-std::array<float,2>{0.7647475f, 0.149426356f},
-std::array<float,2>{0.651242018f, 0.849013686f},
-std::array<float,2>{0.131763861f, 0.261474401f},
-std::array<float,2>{0.0613433383f, 0.52928257f},
-std::array<float,2>{0.598305583f, 0.238305017f},
-std::array<float,2>{0.934009194f, 0.771642625f},
-std::array<float,2>{0.390022635f, 0.370197624f},
-std::array<float,2>{0.279333055f, 0.979050756f},
-std::array<float,2>{0.832137883f, 0.381308645f},
-std::array<float,2>{0.702935576f, 0.709859252f},
-std::array<float,2>{0.226109624f, 0.092016764f},
-std::array<float,2>{0.182783201f, 0.81286478f},
-std::array<float,2>{0.664173007f, 0.29622221f},
-std::array<float,2>{0.812341571f, 0.5831424f},
-std::array<float,2>{0.353619426f, 0.161297694f},
-std::array<float,2>{0.484806627f, 0.660677731f},
-std::array<float,2>{0.971869409f, 0.0617195703f},
-std::array<float,2>{0.536721706f, 0.931354105f},
-std::array<float,2>{0.0664774403f, 0.459309757f},
-std::array<float,2>{0.216010943f, 0.61680907f},
-std::array<float,2>{0.726639092f, 0.147573501f},
-std::array<float,2>{0.851140261f, 0.85563767f},
-std::array<float,2>{0.286050081f, 0.256150156f},
-std::array<float,2>{0.427452058f, 0.895657957f},
-std::array<float,2>{0.906100094f, 0.474384308f},
-std::array<float,2>{0.581696153f, 0.646164596f},
-std::array<float,2>{0.0152911311f, 0.0132438689f},
-std::array<float,2>{0.108012512f, 0.781600177f},
-std::array<float,2>{0.530892193f, 0.338588446f},
-std::array<float,2>{0.964403689f, 0.534194052f},
-std::array<float,2>{0.461661339f, 0.210631058f},
-std::array<float,2>{0.333294749f, 0.746659577f},
-std::array<float,2>{0.767244279f, 0.120843187f},
-std::array<float,2>{0.630607843f, 0.939104438f},
-std::array<float,2>{0.144348279f, 0.424934775f},
-std::array<float,2>{0.0345259495f, 0.667548716f},
-std::array<float,2>{0.619775474f, 0.0507444963f},
-std::array<float,2>{0.916206121f, 0.927946925f},
-std::array<float,2>{0.399052978f, 0.466687173f},
-std::array<float,2>{0.254218966f, 0.826323628f},
-std::array<float,2>{0.826932371f, 0.287268788f},
-std::array<float,2>{0.714977324f, 0.586238146f},
-std::array<float,2>{0.248012692f, 0.164676562f},
-std::array<float,2>{0.163786083f, 0.97510308f},
-std::array<float,2>{0.680305779f, 0.38687548f},
-std::array<float,2>{0.784753025f, 0.718253911f},
-std::array<float,2>{0.373211235f, 0.0818469301f},
-std::array<float,2>{0.477982193f, 0.521000326f},
-std::array<float,2>{0.992751539f, 0.249420837f},
-std::array<float,2>{0.560509264f, 0.776719391f},
-std::array<float,2>{0.0934934393f, 0.364676058f},
-std::array<float,2>{0.127786681f, 0.694432557f},
-std::array<float,2>{0.655730844f, 0.0773041472f},
-std::array<float,2>{0.758304536f, 0.999740124f},
-std::array<float,2>{0.319484115f, 0.396978199f},
-std::array<float,2>{0.44388777f, 0.751801312f},
-std::array<float,2>{0.943512738f, 0.344714046f},
-std::array<float,2>{0.508548856f, 0.503387988f},
-std::array<float,2>{0.122244082f, 0.232830465f},
-std::array<float,2>{0.0211774502f, 0.916993499f},
-std::array<float,2>{0.563684404f, 0.443519115f},
-std::array<float,2>{0.883050442f, 0.674057484f},
-std::array<float,2>{0.415185541f, 0.0348446406f},
-std::array<float,2>{0.30504474f, 0.563480258f},
-std::array<float,2>{0.861831546f, 0.186351404f},
-std::array<float,2>{0.745271385f, 0.841991544f},
-std::array<float,2>{0.195863664f, 0.30384475f},
-std::array<float,2>{0.0645093918f, 0.552461684f},
-std::array<float,2>{0.531670392f, 0.19108057f},
-std::array<float,2>{0.974579096f, 0.797704995f},
-std::array<float,2>{0.489569306f, 0.315235347f},
-std::array<float,2>{0.356685609f, 0.954097331f},
-std::array<float,2>{0.806046546f, 0.409495771f},
-std::array<float,2>{0.668819726f, 0.724612832f},
-std::array<float,2>{0.185616881f, 0.0951954126f},
-std::array<float,2>{0.220051989f, 0.86930418f},
-std::array<float,2>{0.69549787f, 0.270503581f},
-std::array<float,2>{0.828833103f, 0.605481684f},
-std::array<float,2>{0.274235189f, 0.132678568f},
-std::array<float,2>{0.383888721f, 0.629197776f},
-std::array<float,2>{0.92976886f, 0.0278434549f},
-std::array<float,2>{0.596051216f, 0.876604974f},
-std::array<float,2>{0.0550982989f, 0.497912616f},
-std::array<float,2>{0.175958619f, 0.508684814f},
-std::array<float,2>{0.657726765f, 0.222756892f},
-std::array<float,2>{0.801498055f, 0.759492636f},
-std::array<float,2>{0.347945333f, 0.353698671f},
-std::array<float,2>{0.492597967f, 0.990760982f},
-std::array<float,2>{0.981777489f, 0.400961518f},
-std::array<float,2>{0.540820599f, 0.703030944f},
-std::array<float,2>{0.0706445053f, 0.0625677183f},
-std::array<float,2>{0.047884021f, 0.833496094f},
-std::array<float,2>{0.606245458f, 0.309619606f},
-std::array<float,2>{0.928637624f, 0.575655758f},
-std::array<float,2>{0.377967417f, 0.177648902f},
-std::array<float,2>{0.267768681f, 0.679961562f},
-std::array<float,2>{0.838196099f, 0.0405963287f},
-std::array<float,2>{0.691651523f, 0.906585157f},
-std::array<float,2>{0.230156824f, 0.447046071f},
-std::array<float,2>{0.112926185f, 0.728771567f},
-std::array<float,2>{0.506958842f, 0.102740109f},
-std::array<float,2>{0.951555014f, 0.964282036f},
-std::array<float,2>{0.452693224f, 0.415750504f},
-std::array<float,2>{0.324435472f, 0.807532132f},
-std::array<float,2>{0.755459845f, 0.327209681f},
-std::array<float,2>{0.644107342f, 0.561807334f},
-std::array<float,2>{0.138599873f, 0.197726786f},
-std::array<float,2>{0.192457587f, 0.888164997f},
-std::array<float,2>{0.739033818f, 0.491931766f},
-std::array<float,2>{0.867603719f, 0.635241807f},
-std::array<float,2>{0.302066058f, 0.0161379203f},
-std::array<float,2>{0.408883095f, 0.594808161f},
-std::array<float,2>{0.876234174f, 0.138456717f},
-std::array<float,2>{0.572418928f, 0.863912344f},
-std::array<float,2>{0.0278110392f, 0.276899755f},
-std::array<float,2>{0.238751516f, 0.648536205f},
-std::array<float,2>{0.704783022f, 0.00440755906f},
-std::array<float,2>{0.81545496f, 0.905315638f},
-std::array<float,2>{0.264948249f, 0.483337611f},
-std::array<float,2>{0.395572007f, 0.845746934f},
-std::array<float,2>{0.910635293f, 0.262382746f},
-std::array<float,2>{0.614783883f, 0.620251775f},
-std::array<float,2>{0.0418448709f, 0.155699417f},
-std::array<float,2>{0.0849880874f, 0.947211981f},
-std::array<float,2>{0.549781203f, 0.435106784f},
-std::array<float,2>{0.989476442f, 0.7403543f},
-std::array<float,2>{0.476402581f, 0.116149373f},
-std::array<float,2>{0.364015549f, 0.545021296f},
-std::array<float,2>{0.79296273f, 0.211918756f},
-std::array<float,2>{0.676919937f, 0.79248029f},
-std::array<float,2>{0.165703103f, 0.328598857f},
-std::array<float,2>{0.00400429219f, 0.580167353f},
-std::array<float,2>{0.587611377f, 0.156822726f},
-std::array<float,2>{0.892098427f, 0.818231344f},
-std::array<float,2>{0.434960276f, 0.291022927f},
-std::array<float,2>{0.291663349f, 0.934393048f},
-std::array<float,2>{0.853149772f, 0.454270869f},
-std::array<float,2>{0.721696556f, 0.659152806f},
-std::array<float,2>{0.209554747f, 0.056718424f},
-std::array<float,2>{0.154956341f, 0.766569674f},
-std::array<float,2>{0.636990011f, 0.374457687f},
-std::array<float,2>{0.780041933f, 0.524267673f},
-std::array<float,2>{0.341697037f, 0.234417796f},
-std::array<float,2>{0.459663957f, 0.705450535f},
-std::array<float,2>{0.953940451f, 0.0896061435f},
-std::array<float,2>{0.522853553f, 0.982294202f},
-std::array<float,2>{0.0940704644f, 0.377930999f}}
\ No newline at end of file
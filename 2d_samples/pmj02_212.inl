@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.884656608f, 0.456424147f},
-std::array<float,2>{0.331891f, 0.934501529f},
-std::array<float,2>{0.0205545891f, 0.0474371351f},
-std::array<float,2>{0.525278687f, 0.612580538f},
-std::array<float,2>{0.698903382f, 0.21927461f},
-std::array<float,2>{0.194646895f, 0.671814024f},
-std::array<float,2>{0.448976099f, 0.278928757f},
-std::array<float,2>{0.85216856f, 0.782528043f},
-std::array<float,2>{0.805459559f, 0.0846486017f},
-std::array<float,2>{0.42849803f, 0.527594149f},
-std::array<float,2>{0.139493242f, 0.384707868f},
-std::array<float,2>{0.660117328f, 0.982863963f},
-std::array<float,2>{0.620556176f, 0.352769464f},
-std::array<float,2>{0.0803148374f, 0.837632656f},
-std::array<float,2>{0.305926621f, 0.150502205f},
-std::array<float,2>{0.983815074f, 0.697224915f},
-std::array<float,2>{0.814022481f, 0.287664205f},
-std::array<float,2>{0.479945123f, 0.750244439f},
-std::array<float,2>{0.245844871f, 0.210029438f},
-std::array<float,2>{0.720781386f, 0.646795154f},
-std::array<float,2>{0.559660733f, 0.00166901457f},
-std::array<float,2>{0.0534797683f, 0.583049715f},
-std::array<float,2>{0.362853378f, 0.472831309f},
-std::array<float,2>{0.929445207f, 0.883861005f},
-std::array<float,2>{0.966385663f, 0.179752171f},
-std::array<float,2>{0.257985771f, 0.740920126f},
-std::array<float,2>{0.117954217f, 0.343204856f},
-std::array<float,2>{0.593432546f, 0.871713698f},
-std::array<float,2>{0.644704342f, 0.426760972f},
-std::array<float,2>{0.182913005f, 0.940148056f},
-std::array<float,2>{0.40257135f, 0.102963373f},
-std::array<float,2>{0.768134117f, 0.549060166f},
-std::array<float,2>{0.756027579f, 0.395686448f},
-std::array<float,2>{0.386902422f, 0.994311929f},
-std::array<float,2>{0.163172305f, 0.0667163879f},
-std::array<float,2>{0.640286982f, 0.515245795f},
-std::array<float,2>{0.574700415f, 0.138590172f},
-std::array<float,2>{0.0992911309f, 0.707148075f},
-std::array<float,2>{0.280083209f, 0.368232548f},
-std::array<float,2>{0.949613631f, 0.82506305f},
-std::array<float,2>{0.909391463f, 0.0316410698f},
-std::array<float,2>{0.349828035f, 0.602194607f},
-std::array<float,2>{0.0325164981f, 0.439709991f},
-std::array<float,2>{0.543870509f, 0.91391331f},
-std::array<float,2>{0.744941652f, 0.254168183f},
-std::array<float,2>{0.225580201f, 0.805989444f},
-std::array<float,2>{0.487170428f, 0.249061957f},
-std::array<float,2>{0.83234036f, 0.682186544f},
-std::array<float,2>{0.997617126f, 0.314206988f},
-std::array<float,2>{0.287804037f, 0.844702363f},
-std::array<float,2>{0.0745334849f, 0.161219418f},
-std::array<float,2>{0.603569984f, 0.723223209f},
-std::array<float,2>{0.679618776f, 0.123958021f},
-std::array<float,2>{0.145863697f, 0.545650482f},
-std::array<float,2>{0.416376978f, 0.418155611f},
-std::array<float,2>{0.795956492f, 0.959279478f},
-std::array<float,2>{0.87225157f, 0.192554638f},
-std::array<float,2>{0.455524713f, 0.632489383f},
-std::array<float,2>{0.204672575f, 0.298546284f},
-std::array<float,2>{0.708523571f, 0.774849713f},
-std::array<float,2>{0.507848561f, 0.497152328f},
-std::array<float,2>{0.00741198706f, 0.898985505f},
-std::array<float,2>{0.325775594f, 0.0308109075f},
-std::array<float,2>{0.903477252f, 0.566723228f},
-std::array<float,2>{0.942360878f, 0.411575794f},
-std::array<float,2>{0.268802732f, 0.964385152f},
-std::array<float,2>{0.107092477f, 0.111399263f},
-std::array<float,2>{0.563536227f, 0.537754774f},
-std::array<float,2>{0.629866481f, 0.170749664f},
-std::array<float,2>{0.165489897f, 0.732865334f},
-std::array<float,2>{0.379003495f, 0.323489785f},
-std::array<float,2>{0.761232197f, 0.85687989f},
-std::array<float,2>{0.840273499f, 0.0229996815f},
-std::array<float,2>{0.499143779f, 0.577390432f},
-std::array<float,2>{0.231655255f, 0.484613687f},
-std::array<float,2>{0.738436401f, 0.890816629f},
-std::array<float,2>{0.538660884f, 0.307099283f},
-std::array<float,2>{0.0463939346f, 0.765927732f},
-std::array<float,2>{0.355071515f, 0.196658328f},
-std::array<float,2>{0.916447997f, 0.638435423f},
-std::array<float,2>{0.788875282f, 0.364467829f},
-std::array<float,2>{0.407335758f, 0.818617582f},
-std::array<float,2>{0.15451777f, 0.130048394f},
-std::array<float,2>{0.680142641f, 0.713487267f},
-std::array<float,2>{0.596416771f, 0.0755686909f},
-std::array<float,2>{0.067261897f, 0.507741511f},
-std::array<float,2>{0.290180057f, 0.398497105f},
-std::array<float,2>{0.984682441f, 0.988934994f},
-std::array<float,2>{0.89694649f, 0.23716487f},
-std::array<float,2>{0.317810178f, 0.679287851f},
-std::array<float,2>{0.012170895f, 0.259056538f},
-std::array<float,2>{0.500041306f, 0.803540587f},
-std::array<float,2>{0.714194894f, 0.445716053f},
-std::array<float,2>{0.216751322f, 0.921292722f},
-std::array<float,2>{0.463373721f, 0.0466872752f},
-std::array<float,2>{0.865960956f, 0.59573853f},
-std::array<float,2>{0.848972619f, 0.482543886f},
-std::array<float,2>{0.439335108f, 0.875724256f},
-std::array<float,2>{0.201915026f, 0.0130480798f},
-std::array<float,2>{0.692334712f, 0.587595642f},
-std::array<float,2>{0.521030188f, 0.215321124f},
-std::array<float,2>{0.0254426971f, 0.652311206f},
-std::array<float,2>{0.337458074f, 0.292569071f},
-std::array<float,2>{0.878983498f, 0.762056172f},
-std::array<float,2>{0.97344774f, 0.100277551f},
-std::array<float,2>{0.297059894f, 0.560192347f},
-std::array<float,2>{0.0882817283f, 0.430227727f},
-std::array<float,2>{0.614721358f, 0.946466386f},
-std::array<float,2>{0.665747583f, 0.331280053f},
-std::array<float,2>{0.125198036f, 0.865560472f},
-std::array<float,2>{0.432110488f, 0.176052153f},
-std::array<float,2>{0.798755109f, 0.743786335f},
-std::array<float,2>{0.934796333f, 0.27173999f},
-std::array<float,2>{0.367952704f, 0.7936517f},
-std::array<float,2>{0.0621595681f, 0.22887142f},
-std::array<float,2>{0.548702598f, 0.659119368f},
-std::array<float,2>{0.729303002f, 0.0619630925f},
-std::array<float,2>{0.238716111f, 0.618381202f},
-std::array<float,2>{0.474873871f, 0.467450052f},
-std::array<float,2>{0.823657036f, 0.929177284f},
-std::array<float,2>{0.781101406f, 0.14699173f},
-std::array<float,2>{0.397031218f, 0.695163786f},
-std::array<float,2>{0.171913415f, 0.351184189f},
-std::array<float,2>{0.650732338f, 0.833197534f},
-std::array<float,2>{0.581519663f, 0.378752738f},
-std::array<float,2>{0.11230725f, 0.974560738f},
-std::array<float,2>{0.250603169f, 0.0880210176f},
-std::array<float,2>{0.958973229f, 0.519830108f},
-std::array<float,2>{0.977916658f, 0.490289897f},
-std::array<float,2>{0.309300691f, 0.895206273f},
-std::array<float,2>{0.083817184f, 0.0176288672f},
-std::array<float,2>{0.622245014f, 0.571026623f},
-std::array<float,2>{0.661880493f, 0.199317604f},
-std::array<float,2>{0.134307206f, 0.635784149f},
-std::array<float,2>{0.425012022f, 0.310582995f},
-std::array<float,2>{0.809696734f, 0.77060324f},
-std::array<float,2>{0.857939839f, 0.115375586f},
-std::array<float,2>{0.450371176f, 0.534344852f},
-std::array<float,2>{0.18791163f, 0.407035947f},
-std::array<float,2>{0.701807201f, 0.967662632f},
-std::array<float,2>{0.529372275f, 0.324841857f},
-std::array<float,2>{0.0164217781f, 0.852887869f},
-std::array<float,2>{0.332061201f, 0.166817844f},
-std::array<float,2>{0.888449073f, 0.726921201f},
-std::array<float,2>{0.770454943f, 0.263456941f},
-std::array<float,2>{0.398950666f, 0.79861331f},
-std::array<float,2>{0.183916584f, 0.24192287f},
-std::array<float,2>{0.643407524f, 0.673510134f},
-std::array<float,2>{0.587810874f, 0.0424150042f},
-std::array<float,2>{0.122143805f, 0.599367976f},
-std::array<float,2>{0.265423119f, 0.449409395f},
-std::array<float,2>{0.962090254f, 0.914266288f},
-std::array<float,2>{0.922113299f, 0.126385838f},
-std::array<float,2>{0.365839481f, 0.71591562f},
-std::array<float,2>{0.0500394255f, 0.359940499f},
-std::array<float,2>{0.556232214f, 0.814984381f},
-std::array<float,2>{0.724268138f, 0.405040443f},
-std::array<float,2>{0.2498274f, 0.985598862f},
-std::array<float,2>{0.480549693f, 0.0736512393f},
-std::array<float,2>{0.819078326f, 0.502635717f},
-std::array<float,2>{0.831992984f, 0.4352597f},
-std::array<float,2>{0.489176899f, 0.952452779f},
-std::array<float,2>{0.221040532f, 0.09512721f},
-std::array<float,2>{0.7479105f, 0.556146085f},
-std::array<float,2>{0.539891124f, 0.174719438f},
-std::array<float,2>{0.0387929417f, 0.747913837f},
-std::array<float,2>{0.346424341f, 0.333038718f},
-std::array<float,2>{0.913396716f, 0.861514688f},
-std::array<float,2>{0.947959602f, 0.00804010406f},
-std::array<float,2>{0.274152994f, 0.592156351f},
-std::array<float,2>{0.094320327f, 0.479425728f},
-std::array<float,2>{0.570540011f, 0.882499576f},
-std::array<float,2>{0.636708617f, 0.295537204f},
-std::array<float,2>{0.16014044f, 0.760892153f},
-std::array<float,2>{0.384307653f, 0.212290913f},
-std::array<float,2>{0.753045917f, 0.655427039f},
-std::array<float,2>{0.900238276f, 0.344435245f},
-std::array<float,2>{0.323070407f, 0.829806149f},
-std::array<float,2>{0.00270827883f, 0.144288689f},
-std::array<float,2>{0.515525639f, 0.688718915f},
-std::array<float,2>{0.70688802f, 0.0923795477f},
-std::array<float,2>{0.210287094f, 0.51732856f},
-std::array<float,2>{0.46010372f, 0.380508244f},
-std::array<float,2>{0.870074451f, 0.97130698f},
-std::array<float,2>{0.789446473f, 0.231341958f},
-std::array<float,2>{0.421139508f, 0.663466632f},
-std::array<float,2>{0.142734602f, 0.268894613f},
-std::array<float,2>{0.672552288f, 0.792870998f},
-std::array<float,2>{0.607534111f, 0.463996887f},
-std::array<float,2>{0.0721938238f, 0.925628543f},
-std::array<float,2>{0.283264518f, 0.0553609021f},
-std::array<float,2>{0.994054258f, 0.624786496f},
-std::array<float,2>{0.920110703f, 0.386852294f},
-std::array<float,2>{0.358504117f, 0.978595495f},
-std::array<float,2>{0.0414512865f, 0.0805825964f},
-std::array<float,2>{0.534173131f, 0.523627758f},
-std::array<float,2>{0.735672057f, 0.153939947f},
-std::array<float,2>{0.228674382f, 0.700730503f},
-std::array<float,2>{0.493227333f, 0.357085645f},
-std::array<float,2>{0.837586761f, 0.843704402f},
-std::array<float,2>{0.763514161f, 0.0514674187f},
-std::array<float,2>{0.378021061f, 0.614797831f},
-std::array<float,2>{0.16829592f, 0.458480746f},
-std::array<float,2>{0.626646936f, 0.931549728f},
-std::array<float,2>{0.567741513f, 0.273987085f},
-std::array<float,2>{0.102454334f, 0.787142158f},
-std::array<float,2>{0.273366183f, 0.22456497f},
-std::array<float,2>{0.940798998f, 0.667325199f},
-std::array<float,2>{0.859536886f, 0.339007705f},
-std::array<float,2>{0.466051549f, 0.870919704f},
-std::array<float,2>{0.214250758f, 0.184242025f},
-std::array<float,2>{0.718508244f, 0.735992849f},
-std::array<float,2>{0.505828977f, 0.105976284f},
-std::array<float,2>{0.0105780447f, 0.554438531f},
-std::array<float,2>{0.313376188f, 0.423893183f},
-std::array<float,2>{0.894205034f, 0.943720639f},
-std::array<float,2>{0.98904562f, 0.204534709f},
-std::array<float,2>{0.296200365f, 0.644155204f},
-std::array<float,2>{0.0629188195f, 0.283963978f},
-std::array<float,2>{0.600166202f, 0.754662633f},
-std::array<float,2>{0.687411427f, 0.469062656f},
-std::array<float,2>{0.150294155f, 0.888286948f},
-std::array<float,2>{0.413018525f, 0.00753252162f},
-std::array<float,2>{0.784348369f, 0.579514265f},
-std::array<float,2>{0.801097572f, 0.441676587f},
-std::array<float,2>{0.43557933f, 0.908516467f},
-std::array<float,2>{0.130416244f, 0.0352643766f},
-std::array<float,2>{0.669319034f, 0.607322454f},
-std::array<float,2>{0.612730622f, 0.243449762f},
-std::array<float,2>{0.0929202214f, 0.685553193f},
-std::array<float,2>{0.303025544f, 0.253118366f},
-std::array<float,2>{0.971807778f, 0.812154055f},
-std::array<float,2>{0.876728415f, 0.0648435354f},
-std::array<float,2>{0.340760171f, 0.510813117f},
-std::array<float,2>{0.0287227314f, 0.392300218f},
-std::array<float,2>{0.517697752f, 0.999426246f},
-std::array<float,2>{0.68945986f, 0.374369532f},
-std::array<float,2>{0.197374076f, 0.820738077f},
-std::array<float,2>{0.444891781f, 0.133648828f},
-std::array<float,2>{0.845209956f, 0.705588937f},
-std::array<float,2>{0.956532657f, 0.30249539f},
-std::array<float,2>{0.256403148f, 0.780384719f},
-std::array<float,2>{0.114116505f, 0.189630762f},
-std::array<float,2>{0.582704246f, 0.627850652f},
-std::array<float,2>{0.654717922f, 0.0253834277f},
-std::array<float,2>{0.17609483f, 0.563128471f},
-std::array<float,2>{0.392657936f, 0.495221764f},
-std::array<float,2>{0.774672389f, 0.906188369f},
-std::array<float,2>{0.824994028f, 0.159273073f},
-std::array<float,2>{0.468878508f, 0.720775187f},
-std::array<float,2>{0.235775843f, 0.316590667f},
-std::array<float,2>{0.730615318f, 0.849535882f},
-std::array<float,2>{0.551500022f, 0.417518258f},
-std::array<float,2>{0.0585401803f, 0.956521511f},
-std::array<float,2>{0.373606533f, 0.119352728f},
-std::array<float,2>{0.929700494f, 0.541858494f},
-std::array<float,2>{0.92717433f, 0.476472586f},
-std::array<float,2>{0.360723257f, 0.884858072f},
-std::array<float,2>{0.0521893166f, 0.00217579282f},
-std::array<float,2>{0.560859025f, 0.584678292f},
-std::array<float,2>{0.719656825f, 0.207608536f},
-std::array<float,2>{0.243201807f, 0.644901752f},
-std::array<float,2>{0.477193117f, 0.286831647f},
-std::array<float,2>{0.815277874f, 0.752098203f},
-std::array<float,2>{0.765672803f, 0.104693867f},
-std::array<float,2>{0.40618825f, 0.548412979f},
-std::array<float,2>{0.180838391f, 0.428964257f},
-std::array<float,2>{0.646939278f, 0.938540399f},
-std::array<float,2>{0.59161067f, 0.341276169f},
-std::array<float,2>{0.119409427f, 0.874807656f},
-std::array<float,2>{0.260604352f, 0.182311699f},
-std::array<float,2>{0.966864645f, 0.739697754f},
-std::array<float,2>{0.85493964f, 0.280059397f},
-std::array<float,2>{0.446098179f, 0.785100043f},
-std::array<float,2>{0.192513421f, 0.22148864f},
-std::array<float,2>{0.695425808f, 0.668510079f},
-std::array<float,2>{0.52556479f, 0.0490369052f},
-std::array<float,2>{0.0219408348f, 0.609874904f},
-std::array<float,2>{0.329193056f, 0.454722196f},
-std::array<float,2>{0.886063695f, 0.935661435f},
-std::array<float,2>{0.980929554f, 0.150156036f},
-std::array<float,2>{0.307211041f, 0.698715627f},
-std::array<float,2>{0.0793474987f, 0.355221093f},
-std::array<float,2>{0.618124962f, 0.838787496f},
-std::array<float,2>{0.657328844f, 0.385327369f},
-std::array<float,2>{0.13693729f, 0.980626523f},
-std::array<float,2>{0.427614659f, 0.0825734511f},
-std::array<float,2>{0.806722522f, 0.530580461f},
-std::array<float,2>{0.793013573f, 0.421774119f},
-std::array<float,2>{0.414096355f, 0.957889557f},
-std::array<float,2>{0.147249445f, 0.121257782f},
-std::array<float,2>{0.676482975f, 0.544677496f},
-std::array<float,2>{0.602203071f, 0.163088486f},
-std::array<float,2>{0.0769962296f, 0.725920677f},
-std::array<float,2>{0.287040234f, 0.314829439f},
-std::array<float,2>{0.99810338f, 0.847060978f},
-std::array<float,2>{0.904739261f, 0.0277744234f},
-std::array<float,2>{0.326329976f, 0.56952697f},
-std::array<float,2>{0.00511596026f, 0.49836126f},
-std::array<float,2>{0.510822892f, 0.901845217f},
-std::array<float,2>{0.710307837f, 0.300424367f},
-std::array<float,2>{0.20664233f, 0.775519311f},
-std::array<float,2>{0.453879952f, 0.194009334f},
-std::array<float,2>{0.874473393f, 0.630222559f},
-std::array<float,2>{0.951789558f, 0.369321465f},
-std::array<float,2>{0.27819562f, 0.82749939f},
-std::array<float,2>{0.0999963656f, 0.139641479f},
-std::array<float,2>{0.577914238f, 0.709527671f},
-std::array<float,2>{0.637271941f, 0.0685516447f},
-std::array<float,2>{0.160277039f, 0.513419449f},
-std::array<float,2>{0.389448464f, 0.396933526f},
-std::array<float,2>{0.755651534f, 0.992454767f},
-std::array<float,2>{0.834782839f, 0.247302771f},
-std::array<float,2>{0.485098779f, 0.680776894f},
-std::array<float,2>{0.223028407f, 0.257487029f},
-std::array<float,2>{0.742643237f, 0.807436466f},
-std::array<float,2>{0.546168923f, 0.437868416f},
-std::array<float,2>{0.0341996439f, 0.911931396f},
-std::array<float,2>{0.348938346f, 0.0350870937f},
-std::array<float,2>{0.906375647f, 0.604370534f},
-std::array<float,2>{0.986561775f, 0.401046276f},
-std::array<float,2>{0.292661935f, 0.99135381f},
-std::array<float,2>{0.068594031f, 0.0762217343f},
-std::array<float,2>{0.595689774f, 0.503964484f},
-std::array<float,2>{0.681719899f, 0.131118864f},
-std::array<float,2>{0.152868271f, 0.711500883f},
-std::array<float,2>{0.410151243f, 0.366841912f},
-std::array<float,2>{0.786536455f, 0.816536307f},
-std::array<float,2>{0.863373399f, 0.0448314622f},
-std::array<float,2>{0.462098897f, 0.594638884f},
-std::array<float,2>{0.218388498f, 0.448909193f},
-std::array<float,2>{0.711207151f, 0.918537199f},
-std::array<float,2>{0.502830744f, 0.260406256f},
-std::array<float,2>{0.0148860114f, 0.801053822f},
-std::array<float,2>{0.318527788f, 0.236157417f},
-std::array<float,2>{0.895567179f, 0.677515149f},
-std::array<float,2>{0.759537518f, 0.321373284f},
-std::array<float,2>{0.382753968f, 0.857894421f},
-std::array<float,2>{0.167329043f, 0.168861866f},
-std::array<float,2>{0.631363571f, 0.730677724f},
-std::array<float,2>{0.565475583f, 0.110315315f},
-std::array<float,2>{0.108357117f, 0.536222994f},
-std::array<float,2>{0.26732114f, 0.413347721f},
-std::array<float,2>{0.945064425f, 0.962735116f},
-std::array<float,2>{0.914173484f, 0.198212266f},
-std::array<float,2>{0.352404207f, 0.640573919f},
-std::array<float,2>{0.0432931036f, 0.305312783f},
-std::array<float,2>{0.535629511f, 0.769157171f},
-std::array<float,2>{0.741232157f, 0.487831056f},
-std::array<float,2>{0.232992858f, 0.892624795f},
-std::array<float,2>{0.49647823f, 0.0203534048f},
-std::array<float,2>{0.842281699f, 0.574820459f},
-std::array<float,2>{0.820395291f, 0.465099633f},
-std::array<float,2>{0.474046946f, 0.926081538f},
-std::array<float,2>{0.241223872f, 0.059542086f},
-std::array<float,2>{0.727880716f, 0.620499432f},
-std::array<float,2>{0.548847735f, 0.227588013f},
-std::array<float,2>{0.0590850003f, 0.656959474f},
-std::array<float,2>{0.370573312f, 0.270323306f},
-std::array<float,2>{0.936813593f, 0.79639554f},
-std::array<float,2>{0.959480464f, 0.0861642361f},
-std::array<float,2>{0.25274542f, 0.523052454f},
-std::array<float,2>{0.110904299f, 0.375765651f},
-std::array<float,2>{0.578476489f, 0.974978328f},
-std::array<float,2>{0.64850539f, 0.349550039f},
-std::array<float,2>{0.175100297f, 0.834439635f},
-std::array<float,2>{0.396218896f, 0.145796224f},
-std::array<float,2>{0.777679801f, 0.692557514f},
-std::array<float,2>{0.881467521f, 0.290179849f},
-std::array<float,2>{0.338918507f, 0.764710188f},
-std::array<float,2>{0.0244999509f, 0.217326656f},
-std::array<float,2>{0.522750318f, 0.649236798f},
-std::array<float,2>{0.694611132f, 0.0140365427f},
-std::array<float,2>{0.201058373f, 0.588867128f},
-std::array<float,2>{0.44133693f, 0.481711388f},
-std::array<float,2>{0.851207197f, 0.877847254f},
-std::array<float,2>{0.800202668f, 0.178969055f},
-std::array<float,2>{0.43085289f, 0.744355321f},
-std::array<float,2>{0.127969608f, 0.328838319f},
-std::array<float,2>{0.667339444f, 0.864601672f},
-std::array<float,2>{0.615686834f, 0.433249652f},
-std::array<float,2>{0.0878796577f, 0.94817704f},
-std::array<float,2>{0.299963415f, 0.0989063531f},
-std::array<float,2>{0.975661099f, 0.560721636f},
-std::array<float,2>{0.963829935f, 0.452181786f},
-std::array<float,2>{0.262626141f, 0.917125404f},
-std::array<float,2>{0.124053709f, 0.0403975546f},
-std::array<float,2>{0.58949703f, 0.600838125f},
-std::array<float,2>{0.642005205f, 0.238813847f},
-std::array<float,2>{0.187299594f, 0.674721479f},
-std::array<float,2>{0.401851177f, 0.263721079f},
-std::array<float,2>{0.771968007f, 0.799942851f},
-std::array<float,2>{0.817908823f, 0.0720021352f},
-std::array<float,2>{0.482744396f, 0.500485837f},
-std::array<float,2>{0.246271923f, 0.403826416f},
-std::array<float,2>{0.725502372f, 0.987173557f},
-std::array<float,2>{0.557171404f, 0.361860782f},
-std::array<float,2>{0.047387518f, 0.813232005f},
-std::array<float,2>{0.364927441f, 0.128150925f},
-std::array<float,2>{0.925272405f, 0.717850447f},
-std::array<float,2>{0.812014163f, 0.310281068f},
-std::array<float,2>{0.42307511f, 0.771948099f},
-std::array<float,2>{0.135220096f, 0.201700225f},
-std::array<float,2>{0.662548065f, 0.633473337f},
-std::array<float,2>{0.623587132f, 0.0165970139f},
-std::array<float,2>{0.0846582204f, 0.573609591f},
-std::array<float,2>{0.310769498f, 0.489539415f},
-std::array<float,2>{0.978663504f, 0.896484613f},
-std::array<float,2>{0.889103174f, 0.164404869f},
-std::array<float,2>{0.335247785f, 0.729540169f},
-std::array<float,2>{0.0177829489f, 0.326535314f},
-std::array<float,2>{0.528794825f, 0.853696287f},
-std::array<float,2>{0.70024848f, 0.409275174f},
-std::array<float,2>{0.190561742f, 0.965893149f},
-std::array<float,2>{0.452642024f, 0.11375834f},
-std::array<float,2>{0.856492877f, 0.531687915f},
-std::array<float,2>{0.868269145f, 0.382364988f},
-std::array<float,2>{0.458811551f, 0.969331026f},
-std::array<float,2>{0.208726615f, 0.0900241882f},
-std::array<float,2>{0.703448355f, 0.518181264f},
-std::array<float,2>{0.511949837f, 0.140975282f},
-std::array<float,2>{0.0015386974f, 0.68969506f},
-std::array<float,2>{0.320486516f, 0.346042722f},
-std::array<float,2>{0.900589049f, 0.830805659f},
-std::array<float,2>{0.994713962f, 0.0583145134f},
-std::array<float,2>{0.282487303f, 0.622465014f},
-std::array<float,2>{0.0729955435f, 0.461033404f},
-std::array<float,2>{0.605555058f, 0.923393071f},
-std::array<float,2>{0.674329221f, 0.266235173f},
-std::array<float,2>{0.140675351f, 0.790507019f},
-std::array<float,2>{0.418872446f, 0.234035075f},
-std::array<float,2>{0.79141593f, 0.660815358f},
-std::array<float,2>{0.91032809f, 0.334110588f},
-std::array<float,2>{0.34385702f, 0.859920323f},
-std::array<float,2>{0.0370390154f, 0.172676533f},
-std::array<float,2>{0.541610599f, 0.748479903f},
-std::array<float,2>{0.749303043f, 0.0959037691f},
-std::array<float,2>{0.219345257f, 0.557699561f},
-std::array<float,2>{0.490879267f, 0.436047465f},
-std::array<float,2>{0.829300106f, 0.950264156f},
-std::array<float,2>{0.751075685f, 0.213814601f},
-std::array<float,2>{0.38544628f, 0.653191984f},
-std::array<float,2>{0.156988978f, 0.293210059f},
-std::array<float,2>{0.63328433f, 0.758942783f},
-std::array<float,2>{0.572787523f, 0.476990044f},
-std::array<float,2>{0.0973225161f, 0.880690396f},
-std::array<float,2>{0.275837511f, 0.0104234088f},
-std::array<float,2>{0.946050882f, 0.591049612f},
-std::array<float,2>{0.891426444f, 0.422389627f},
-std::array<float,2>{0.316141993f, 0.942309439f},
-std::array<float,2>{0.00937704183f, 0.108943358f},
-std::array<float,2>{0.507016659f, 0.55166024f},
-std::array<float,2>{0.716211796f, 0.186639473f},
-std::array<float,2>{0.211123645f, 0.737361252f},
-std::array<float,2>{0.467967302f, 0.33756718f},
-std::array<float,2>{0.862696826f, 0.868541181f},
-std::array<float,2>{0.781395257f, 0.00474266382f},
-std::array<float,2>{0.411197662f, 0.581955075f},
-std::array<float,2>{0.151905745f, 0.472198009f},
-std::array<float,2>{0.685301781f, 0.889960527f},
-std::array<float,2>{0.598815441f, 0.283077747f},
-std::array<float,2>{0.065517351f, 0.757060766f},
-std::array<float,2>{0.294804543f, 0.205352783f},
-std::array<float,2>{0.991994679f, 0.641225755f},
-std::array<float,2>{0.837952018f, 0.358436555f},
-std::array<float,2>{0.494594872f, 0.841558933f},
-std::array<float,2>{0.227407306f, 0.154300705f},
-std::array<float,2>{0.737973154f, 0.70198071f},
-std::array<float,2>{0.53157419f, 0.0792630836f},
-std::array<float,2>{0.0406910628f, 0.52653271f},
-std::array<float,2>{0.356537789f, 0.389973134f},
-std::array<float,2>{0.918142021f, 0.978149533f},
-std::array<float,2>{0.938353956f, 0.226031706f},
-std::array<float,2>{0.270783782f, 0.664067924f},
-std::array<float,2>{0.104657218f, 0.276046306f},
-std::array<float,2>{0.570293367f, 0.786852062f},
-std::array<float,2>{0.627107441f, 0.460887581f},
-std::array<float,2>{0.171450734f, 0.93270576f},
-std::array<float,2>{0.375748783f, 0.0542379022f},
-std::array<float,2>{0.764069319f, 0.616539836f},
-std::array<float,2>{0.776412606f, 0.492570251f},
-std::array<float,2>{0.391738832f, 0.90236491f},
-std::array<float,2>{0.178168461f, 0.0268727727f},
-std::array<float,2>{0.652669787f, 0.565775752f},
-std::array<float,2>{0.584228575f, 0.187859386f},
-std::array<float,2>{0.115279585f, 0.625867724f},
-std::array<float,2>{0.254232109f, 0.304615796f},
-std::array<float,2>{0.954256773f, 0.778140724f},
-std::array<float,2>{0.932165325f, 0.118647337f},
-std::array<float,2>{0.372394681f, 0.54027468f},
-std::array<float,2>{0.0556346923f, 0.415899575f},
-std::array<float,2>{0.55454582f, 0.954375207f},
-std::array<float,2>{0.732716322f, 0.31883657f},
-std::array<float,2>{0.23823978f, 0.850690961f},
-std::array<float,2>{0.472164482f, 0.157678872f},
-std::array<float,2>{0.826748252f, 0.719605505f},
-std::array<float,2>{0.969115853f, 0.251235723f},
-std::array<float,2>{0.30200389f, 0.810186625f},
-std::array<float,2>{0.091620326f, 0.244715586f},
-std::array<float,2>{0.611056983f, 0.684161901f},
-std::array<float,2>{0.671863139f, 0.0381864458f},
-std::array<float,2>{0.132784098f, 0.609216511f},
-std::array<float,2>{0.433832228f, 0.44480595f},
-std::array<float,2>{0.803771198f, 0.906898916f},
-std::array<float,2>{0.846882522f, 0.135780498f},
-std::array<float,2>{0.4428657f, 0.703396738f},
-std::array<float,2>{0.196807057f, 0.371391386f},
-std::array<float,2>{0.68840909f, 0.823714077f},
-std::array<float,2>{0.516512036f, 0.393941194f},
-std::array<float,2>{0.0310845207f, 0.996912122f},
-std::array<float,2>{0.343338132f, 0.0632044524f},
-std::array<float,2>{0.87720269f, 0.509200394f},
-std::array<float,2>{0.908059955f, 0.440674067f},
-std::array<float,2>{0.347977549f, 0.912529945f},
-std::array<float,2>{0.0339590497f, 0.0330085009f},
-std::array<float,2>{0.545302331f, 0.603272259f},
-std::array<float,2>{0.743376672f, 0.248570189f},
-std::array<float,2>{0.223958209f, 0.682690144f},
-std::array<float,2>{0.485709757f, 0.255326092f},
-std::array<float,2>{0.835920513f, 0.805602014f},
-std::array<float,2>{0.754194856f, 0.0675337911f},
-std::array<float,2>{0.390315205f, 0.514395773f},
-std::array<float,2>{0.161916018f, 0.395357102f},
-std::array<float,2>{0.638293386f, 0.995673954f},
-std::array<float,2>{0.576320827f, 0.368128419f},
-std::array<float,2>{0.101264864f, 0.825260699f},
-std::array<float,2>{0.278438866f, 0.137460783f},
-std::array<float,2>{0.952545464f, 0.708129704f},
-std::array<float,2>{0.873792648f, 0.297329813f},
-std::array<float,2>{0.454908252f, 0.773963273f},
-std::array<float,2>{0.205879942f, 0.191464365f},
-std::array<float,2>{0.709038794f, 0.631315291f},
-std::array<float,2>{0.510253072f, 0.02957475f},
-std::array<float,2>{0.00483539514f, 0.56807524f},
-std::array<float,2>{0.327981412f, 0.49705857f},
-std::array<float,2>{0.905953944f, 0.899584532f},
-std::array<float,2>{0.99936837f, 0.160832182f},
-std::array<float,2>{0.285212249f, 0.724303722f},
-std::array<float,2>{0.077731289f, 0.312501162f},
-std::array<float,2>{0.602901638f, 0.844802916f},
-std::array<float,2>{0.677086949f, 0.419145674f},
-std::array<float,2>{0.148424059f, 0.96040988f},
-std::array<float,2>{0.415458024f, 0.124632001f},
-std::array<float,2>{0.79488647f, 0.546239793f},
-std::array<float,2>{0.808365703f, 0.383125246f},
-std::array<float,2>{0.426633239f, 0.983493805f},
-std::array<float,2>{0.138124853f, 0.0852218494f},
-std::array<float,2>{0.656344295f, 0.528559089f},
-std::array<float,2>{0.618804097f, 0.151665464f},
-std::array<float,2>{0.0783413202f, 0.696244657f},
-std::array<float,2>{0.308145404f, 0.352195323f},
-std::array<float,2>{0.981925547f, 0.836729765f},
-std::array<float,2>{0.885625541f, 0.0479732417f},
-std::array<float,2>{0.329082996f, 0.612291574f},
-std::array<float,2>{0.023181349f, 0.455627084f},
-std::array<float,2>{0.527164459f, 0.935070932f},
-std::array<float,2>{0.696452081f, 0.277443856f},
-std::array<float,2>{0.191494748f, 0.782081366f},
-std::array<float,2>{0.446291983f, 0.219881013f},
-std::array<float,2>{0.854400635f, 0.67051065f},
-std::array<float,2>{0.968193173f, 0.342609197f},
-std::array<float,2>{0.261553764f, 0.872474909f},
-std::array<float,2>{0.121074945f, 0.181505516f},
-std::array<float,2>{0.590156615f, 0.74197787f},
-std::array<float,2>{0.648310721f, 0.101838082f},
-std::array<float,2>{0.17997168f, 0.549925625f},
-std::array<float,2>{0.40458703f, 0.426279366f},
-std::array<float,2>{0.767378092f, 0.940563262f},
-std::array<float,2>{0.815439761f, 0.209193796f},
-std::array<float,2>{0.478063822f, 0.648248136f},
-std::array<float,2>{0.242707133f, 0.288269758f},
-std::array<float,2>{0.720152438f, 0.751149178f},
-std::array<float,2>{0.562138498f, 0.474046856f},
-std::array<float,2>{0.0512112081f, 0.883046985f},
-std::array<float,2>{0.360255569f, 5.18926972e-05f},
-std::array<float,2>{0.926105559f, 0.582513094f},
-std::array<float,2>{0.974969685f, 0.430900604f},
-std::array<float,2>{0.299285442f, 0.945328951f},
-std::array<float,2>{0.0863981247f, 0.101181887f},
-std::array<float,2>{0.616610229f, 0.559371829f},
-std::array<float,2>{0.666727543f, 0.177726567f},
-std::array<float,2>{0.127544746f, 0.742693484f},
-std::array<float,2>{0.42972818f, 0.330274493f},
-std::array<float,2>{0.799240232f, 0.867084622f},
-std::array<float,2>{0.850244999f, 0.011726819f},
-std::array<float,2>{0.439938426f, 0.586886466f},
-std::array<float,2>{0.19957225f, 0.483824372f},
-std::array<float,2>{0.694019854f, 0.876908302f},
-std::array<float,2>{0.522407889f, 0.291157126f},
-std::array<float,2>{0.0242480468f, 0.763286531f},
-std::array<float,2>{0.33813405f, 0.21667999f},
-std::array<float,2>{0.882767797f, 0.651151597f},
-std::array<float,2>{0.77837503f, 0.3498092f},
-std::array<float,2>{0.394876271f, 0.832355797f},
-std::array<float,2>{0.17475602f, 0.147675261f},
-std::array<float,2>{0.649483562f, 0.694156587f},
-std::array<float,2>{0.579343915f, 0.0890998766f},
-std::array<float,2>{0.110132411f, 0.521386504f},
-std::array<float,2>{0.253362507f, 0.377594918f},
-std::array<float,2>{0.960073233f, 0.973576009f},
-std::array<float,2>{0.935967803f, 0.22953923f},
-std::array<float,2>{0.369467616f, 0.659712672f},
-std::array<float,2>{0.0603527017f, 0.273413152f},
-std::array<float,2>{0.550238848f, 0.79420501f},
-std::array<float,2>{0.727131605f, 0.467888653f},
-std::array<float,2>{0.24026835f, 0.9285267f},
-std::array<float,2>{0.472878903f, 0.0607878566f},
-std::array<float,2>{0.821325719f, 0.618088782f},
-std::array<float,2>{0.842823625f, 0.48591581f},
-std::array<float,2>{0.497664958f, 0.891749024f},
-std::array<float,2>{0.233951524f, 0.0222603399f},
-std::array<float,2>{0.740404904f, 0.577090323f},
-std::array<float,2>{0.53615433f, 0.196269587f},
-std::array<float,2>{0.0444644727f, 0.636872768f},
-std::array<float,2>{0.352550656f, 0.30790326f},
-std::array<float,2>{0.915463984f, 0.767399371f},
-std::array<float,2>{0.94423306f, 0.112828664f},
-std::array<float,2>{0.265781254f, 0.538160801f},
-std::array<float,2>{0.108775005f, 0.411087722f},
-std::array<float,2>{0.56491673f, 0.96367085f},
-std::array<float,2>{0.631915927f, 0.322307378f},
-std::array<float,2>{0.166964412f, 0.855832696f},
-std::array<float,2>{0.381220967f, 0.171800464f},
-std::array<float,2>{0.758700669f, 0.73348701f},
-std::array<float,2>{0.894848824f, 0.257964045f},
-std::array<float,2>{0.320076734f, 0.803895593f},
-std::array<float,2>{0.014532716f, 0.238182977f},
-std::array<float,2>{0.503605306f, 0.678039432f},
-std::array<float,2>{0.712530196f, 0.045034796f},
-std::array<float,2>{0.216842771f, 0.596772254f},
-std::array<float,2>{0.461161882f, 0.446551204f},
-std::array<float,2>{0.865006626f, 0.92007339f},
-std::array<float,2>{0.785457194f, 0.129304647f},
-std::array<float,2>{0.408679187f, 0.714368403f},
-std::array<float,2>{0.153967291f, 0.363483548f},
-std::array<float,2>{0.683386922f, 0.819872439f},
-std::array<float,2>{0.594608843f, 0.399584979f},
-std::array<float,2>{0.0699873939f, 0.990042329f},
-std::array<float,2>{0.29124701f, 0.0742494389f},
-std::array<float,2>{0.987424493f, 0.506026447f},
-std::array<float,2>{0.947122931f, 0.480265141f},
-std::array<float,2>{0.276488811f, 0.881616473f},
-std::array<float,2>{0.0965271592f, 0.00932580791f},
-std::array<float,2>{0.57329762f, 0.593574405f},
-std::array<float,2>{0.633978903f, 0.211039722f},
-std::array<float,2>{0.157281816f, 0.655264795f},
-std::array<float,2>{0.38609606f, 0.296048522f},
-std::array<float,2>{0.75012958f, 0.759860754f},
-std::array<float,2>{0.828172863f, 0.0944727734f},
-std::array<float,2>{0.491532385f, 0.555192471f},
-std::array<float,2>{0.220122591f, 0.434123695f},
-std::array<float,2>{0.748114586f, 0.951413453f},
-std::array<float,2>{0.542527676f, 0.332513362f},
-std::array<float,2>{0.0352432132f, 0.863112748f},
-std::array<float,2>{0.34535417f, 0.175562263f},
-std::array<float,2>{0.91209203f, 0.746994555f},
-std::array<float,2>{0.792562485f, 0.268483818f},
-std::array<float,2>{0.418993145f, 0.791123509f},
-std::array<float,2>{0.141708359f, 0.231866583f},
-std::array<float,2>{0.675340533f, 0.662508547f},
-std::array<float,2>{0.607010603f, 0.0560660698f},
-std::array<float,2>{0.0735056922f, 0.623052657f},
-std::array<float,2>{0.281604916f, 0.462964118f},
-std::array<float,2>{0.995567858f, 0.923931181f},
-std::array<float,2>{0.901922107f, 0.14284122f},
-std::array<float,2>{0.321456879f, 0.688167036f},
-std::array<float,2>{0.000666888722f, 0.344952792f},
-std::array<float,2>{0.513577402f, 0.828920901f},
-std::array<float,2>{0.704355061f, 0.379734397f},
-std::array<float,2>{0.207873955f, 0.9725914f},
-std::array<float,2>{0.457399547f, 0.0927905813f},
-std::array<float,2>{0.867831469f, 0.515764594f},
-std::array<float,2>{0.856013596f, 0.407421798f},
-std::array<float,2>{0.45138678f, 0.968493819f},
-std::array<float,2>{0.190417677f, 0.117053762f},
-std::array<float,2>{0.700116694f, 0.533814132f},
-std::array<float,2>{0.527999938f, 0.167130142f},
-std::array<float,2>{0.0192609224f, 0.727917254f},
-std::array<float,2>{0.334296644f, 0.325416476f},
-std::array<float,2>{0.890517414f, 0.852281868f},
-std::array<float,2>{0.980304122f, 0.0185960978f},
-std::array<float,2>{0.311727643f, 0.571741164f},
-std::array<float,2>{0.0849649683f, 0.491759032f},
-std::array<float,2>{0.624293804f, 0.896255314f},
-std::array<float,2>{0.663751185f, 0.311715335f},
-std::array<float,2>{0.136410356f, 0.770120144f},
-std::array<float,2>{0.422034264f, 0.200282142f},
-std::array<float,2>{0.810771525f, 0.63517803f},
-std::array<float,2>{0.924596429f, 0.360948235f},
-std::array<float,2>{0.363436133f, 0.815562546f},
-std::array<float,2>{0.0479443707f, 0.125703916f},
-std::array<float,2>{0.558251917f, 0.715240479f},
-std::array<float,2>{0.726123452f, 0.072915934f},
-std::array<float,2>{0.247572631f, 0.503127456f},
-std::array<float,2>{0.483474672f, 0.405409098f},
-std::array<float,2>{0.816467822f, 0.984628916f},
-std::array<float,2>{0.77318418f, 0.240385428f},
-std::array<float,2>{0.400535494f, 0.67222178f},
-std::array<float,2>{0.185994938f, 0.262554586f},
-std::array<float,2>{0.641177237f, 0.797442019f},
-std::array<float,2>{0.588320196f, 0.450421333f},
-std::array<float,2>{0.123481594f, 0.915328324f},
-std::array<float,2>{0.263424903f, 0.0415907241f},
-std::array<float,2>{0.964073002f, 0.598521233f},
-std::array<float,2>{0.878792644f, 0.390912682f},
-std::array<float,2>{0.342297792f, 0.99864459f},
-std::array<float,2>{0.0300863311f, 0.0663599595f},
-std::array<float,2>{0.516954958f, 0.510348678f},
-std::array<float,2>{0.689272463f, 0.134718269f},
-std::array<float,2>{0.195654705f, 0.706939518f},
-std::array<float,2>{0.442136645f, 0.373732716f},
-std::array<float,2>{0.846447408f, 0.821458936f},
-std::array<float,2>{0.803321838f, 0.0364871994f},
-std::array<float,2>{0.434946805f, 0.606120408f},
-std::array<float,2>{0.131713122f, 0.443234473f},
-std::array<float,2>{0.670720398f, 0.910107255f},
-std::array<float,2>{0.609722197f, 0.252670228f},
-std::array<float,2>{0.0905846432f, 0.811359704f},
-std::array<float,2>{0.30159992f, 0.242511719f},
-std::array<float,2>{0.970526695f, 0.6872949f},
-std::array<float,2>{0.827171028f, 0.318215042f},
-std::array<float,2>{0.470845848f, 0.848521948f},
-std::array<float,2>{0.237083718f, 0.15896666f},
-std::array<float,2>{0.733842134f, 0.721947789f},
-std::array<float,2>{0.552897871f, 0.120213598f},
-std::array<float,2>{0.0565641001f, 0.54259181f},
-std::array<float,2>{0.371492833f, 0.416973829f},
-std::array<float,2>{0.932689488f, 0.956023395f},
-std::array<float,2>{0.953343987f, 0.19116658f},
-std::array<float,2>{0.255447477f, 0.628661394f},
-std::array<float,2>{0.116510361f, 0.300944805f},
-std::array<float,2>{0.585503519f, 0.779448986f},
-std::array<float,2>{0.654135108f, 0.495035738f},
-std::array<float,2>{0.178815439f, 0.904640913f},
-std::array<float,2>{0.390845418f, 0.0236256272f},
-std::array<float,2>{0.77634716f, 0.563865423f},
-std::array<float,2>{0.76511544f, 0.457066089f},
-std::array<float,2>{0.376301616f, 0.929697096f},
-std::array<float,2>{0.170310631f, 0.0521086901f},
-std::array<float,2>{0.628736079f, 0.614226341f},
-std::array<float,2>{0.56899637f, 0.223631993f},
-std::array<float,2>{0.104350403f, 0.666953087f},
-std::array<float,2>{0.270217657f, 0.275317848f},
-std::array<float,2>{0.938499629f, 0.788226962f},
-std::array<float,2>{0.919765592f, 0.0814790204f},
-std::array<float,2>{0.356100261f, 0.524963856f},
-std::array<float,2>{0.0391400941f, 0.38838312f},
-std::array<float,2>{0.532615304f, 0.979838133f},
-std::array<float,2>{0.736464024f, 0.355697036f},
-std::array<float,2>{0.227995723f, 0.842539489f},
-std::array<float,2>{0.495488822f, 0.152441546f},
-std::array<float,2>{0.839470208f, 0.699521363f},
-std::array<float,2>{0.99104923f, 0.284906685f},
-std::array<float,2>{0.29313615f, 0.755241334f},
-std::array<float,2>{0.0651915893f, 0.204059094f},
-std::array<float,2>{0.598204494f, 0.642707348f},
-std::array<float,2>{0.684315026f, 0.00607103622f},
-std::array<float,2>{0.150428593f, 0.578799188f},
-std::array<float,2>{0.410500497f, 0.470298201f},
-std::array<float,2>{0.782742798f, 0.887505054f},
-std::array<float,2>{0.861641705f, 0.185340852f},
-std::array<float,2>{0.467543572f, 0.735117376f},
-std::array<float,2>{0.212200627f, 0.338011712f},
-std::array<float,2>{0.714924634f, 0.869314015f},
-std::array<float,2>{0.505877674f, 0.424903244f},
-std::array<float,2>{0.00791076105f, 0.945238829f},
-std::array<float,2>{0.314591587f, 0.107200436f},
-std::array<float,2>{0.89190948f, 0.553027987f},
-std::array<float,2>{0.902846336f, 0.499167383f},
-std::array<float,2>{0.324789941f, 0.901205122f},
-std::array<float,2>{0.00660889922f, 0.028890891f},
-std::array<float,2>{0.509637296f, 0.568781197f},
-std::array<float,2>{0.707473934f, 0.194931537f},
-std::array<float,2>{0.203408033f, 0.629763901f},
-std::array<float,2>{0.456813067f, 0.298950225f},
-std::array<float,2>{0.871219873f, 0.776870728f},
-std::array<float,2>{0.795585334f, 0.122634895f},
-std::array<float,2>{0.417285979f, 0.54302454f},
-std::array<float,2>{0.144947618f, 0.420162439f},
-std::array<float,2>{0.678337336f, 0.958230138f},
-std::array<float,2>{0.605029225f, 0.315505713f},
-std::array<float,2>{0.0760662556f, 0.845994055f},
-std::array<float,2>{0.288259864f, 0.163039282f},
-std::array<float,2>{0.997030795f, 0.725275874f},
-std::array<float,2>{0.833802164f, 0.256234586f},
-std::array<float,2>{0.48767069f, 0.808149993f},
-std::array<float,2>{0.226267934f, 0.246967509f},
-std::array<float,2>{0.745327294f, 0.680658221f},
-std::array<float,2>{0.544232905f, 0.0341449007f},
-std::array<float,2>{0.0320674703f, 0.604826987f},
-std::array<float,2>{0.351558685f, 0.439385712f},
-std::array<float,2>{0.908734381f, 0.911106169f},
-std::array<float,2>{0.950642228f, 0.14007692f},
-std::array<float,2>{0.280548364f, 0.710718811f},
-std::array<float,2>{0.0985206291f, 0.370631546f},
-std::array<float,2>{0.576002061f, 0.82663852f},
-std::array<float,2>{0.639568508f, 0.397692382f},
-std::array<float,2>{0.162202597f, 0.993675649f},
-std::array<float,2>{0.387933075f, 0.0699076504f},
-std::array<float,2>{0.757747173f, 0.512114584f},
-std::array<float,2>{0.769309878f, 0.427975684f},
-std::array<float,2>{0.403529763f, 0.93761909f},
-std::array<float,2>{0.181952864f, 0.104423538f},
-std::array<float,2>{0.645538032f, 0.547679067f},
-std::array<float,2>{0.59236753f, 0.182951003f},
-std::array<float,2>{0.119087718f, 0.738354087f},
-std::array<float,2>{0.25912416f, 0.340497732f},
-std::array<float,2>{0.965780795f, 0.873960853f},
-std::array<float,2>{0.928398848f, 0.00347668817f},
-std::array<float,2>{0.36168471f, 0.58573699f},
-std::array<float,2>{0.0543966815f, 0.474667728f},
-std::array<float,2>{0.558714867f, 0.886006117f},
-std::array<float,2>{0.72173965f, 0.286107242f},
-std::array<float,2>{0.244385988f, 0.753510952f},
-std::array<float,2>{0.478772193f, 0.208151162f},
-std::array<float,2>{0.812800646f, 0.645828962f},
-std::array<float,2>{0.983352959f, 0.354416579f},
-std::array<float,2>{0.305031359f, 0.839721322f},
-std::array<float,2>{0.0813408345f, 0.149061888f},
-std::array<float,2>{0.619698167f, 0.698221564f},
-std::array<float,2>{0.658334494f, 0.0837924629f},
-std::array<float,2>{0.140472755f, 0.529306471f},
-std::array<float,2>{0.42942065f, 0.385843724f},
-std::array<float,2>{0.806467593f, 0.981717169f},
-std::array<float,2>{0.853071392f, 0.222568259f},
-std::array<float,2>{0.447545737f, 0.669894695f},
-std::array<float,2>{0.193897843f, 0.280720621f},
-std::array<float,2>{0.698147357f, 0.784130037f},
-std::array<float,2>{0.524327576f, 0.453200728f},
-std::array<float,2>{0.0201924611f, 0.936926126f},
-std::array<float,2>{0.330102623f, 0.0505176559f},
-std::array<float,2>{0.883509815f, 0.610999525f},
-std::array<float,2>{0.957599998f, 0.376809925f},
-std::array<float,2>{0.251656473f, 0.976314545f},
-std::array<float,2>{0.111384735f, 0.0873431191f},
-std::array<float,2>{0.580254376f, 0.522148609f},
-std::array<float,2>{0.652013481f, 0.145404816f},
-std::array<float,2>{0.173625752f, 0.691660583f},
-std::array<float,2>{0.398129672f, 0.34778592f},
-std::array<float,2>{0.779386103f, 0.835241914f},
-std::array<float,2>{0.823233962f, 0.0603696592f},
-std::array<float,2>{0.476228952f, 0.619936109f},
-std::array<float,2>{0.239322096f, 0.466044307f},
-std::array<float,2>{0.729524851f, 0.927073419f},
-std::array<float,2>{0.54756546f, 0.270594269f},
-std::array<float,2>{0.0612933189f, 0.795659602f},
-std::array<float,2>{0.368855387f, 0.226587936f},
-std::array<float,2>{0.934422731f, 0.657311141f},
-std::array<float,2>{0.797706246f, 0.329426914f},
-std::array<float,2>{0.433357835f, 0.86413306f},
-std::array<float,2>{0.126702532f, 0.177992493f},
-std::array<float,2>{0.66496712f, 0.746028423f},
-std::array<float,2>{0.614218831f, 0.0983852372f},
-std::array<float,2>{0.0897598788f, 0.562157929f},
-std::array<float,2>{0.297961563f, 0.432506323f},
-std::array<float,2>{0.973737895f, 0.949116111f},
-std::array<float,2>{0.880313396f, 0.218093216f},
-std::array<float,2>{0.336223364f, 0.649707794f},
-std::array<float,2>{0.0273074899f, 0.28995052f},
-std::array<float,2>{0.520201862f, 0.763933599f},
-std::array<float,2>{0.692662835f, 0.480612695f},
-std::array<float,2>{0.202350721f, 0.878834665f},
-std::array<float,2>{0.437819988f, 0.0153470542f},
-std::array<float,2>{0.848305702f, 0.589540899f},
-std::array<float,2>{0.866787195f, 0.447483569f},
-std::array<float,2>{0.464586675f, 0.919711411f},
-std::array<float,2>{0.215659007f, 0.0433309935f},
-std::array<float,2>{0.713000357f, 0.594928145f},
-std::array<float,2>{0.500985563f, 0.234899744f},
-std::array<float,2>{0.0131412437f, 0.676391423f},
-std::array<float,2>{0.316458076f, 0.261050344f},
-std::array<float,2>{0.897567928f, 0.802672625f},
-std::array<float,2>{0.985480905f, 0.077636078f},
-std::array<float,2>{0.289373636f, 0.505045891f},
-std::array<float,2>{0.067978926f, 0.401777238f},
-std::array<float,2>{0.597431421f, 0.99071157f},
-std::array<float,2>{0.68091625f, 0.365421265f},
-std::array<float,2>{0.155978054f, 0.818123639f},
-std::array<float,2>{0.406942457f, 0.131892458f},
-std::array<float,2>{0.787666857f, 0.712519526f},
-std::array<float,2>{0.917819321f, 0.305801243f},
-std::array<float,2>{0.354105443f, 0.767669916f},
-std::array<float,2>{0.0457240604f, 0.198418126f},
-std::array<float,2>{0.537874162f, 0.639182925f},
-std::array<float,2>{0.739974439f, 0.0205881577f},
-std::array<float,2>{0.230881929f, 0.575975597f},
-std::array<float,2>{0.498600036f, 0.486937165f},
-std::array<float,2>{0.841054678f, 0.894097507f},
-std::array<float,2>{0.76045835f, 0.169902489f},
-std::array<float,2>{0.380329818f, 0.731910944f},
-std::array<float,2>{0.164902329f, 0.320461035f},
-std::array<float,2>{0.630584359f, 0.85930723f},
-std::array<float,2>{0.562726378f, 0.412819505f},
-std::array<float,2>{0.105906978f, 0.960977018f},
-std::array<float,2>{0.267880768f, 0.111066133f},
-std::array<float,2>{0.942387164f, 0.535409331f},
-std::array<float,2>{0.993108869f, 0.462324739f},
-std::array<float,2>{0.284462363f, 0.922823906f},
-std::array<float,2>{0.0711019561f, 0.0567358918f},
-std::array<float,2>{0.608652532f, 0.621592283f},
-std::array<float,2>{0.673778653f, 0.232978433f},
-std::array<float,2>{0.144245267f, 0.661211848f},
-std::array<float,2>{0.420504093f, 0.267148793f},
-std::array<float,2>{0.79043138f, 0.789961696f},
-std::array<float,2>{0.870560646f, 0.0914985687f},
-std::array<float,2>{0.459746629f, 0.51901859f},
-std::array<float,2>{0.209178895f, 0.381598622f},
-std::array<float,2>{0.705129981f, 0.970497906f},
-std::array<float,2>{0.51437813f, 0.347123891f},
-std::array<float,2>{0.00300608389f, 0.831269264f},
-std::array<float,2>{0.323555082f, 0.142053977f},
-std::array<float,2>{0.898731828f, 0.691039979f},
-std::array<float,2>{0.752313495f, 0.294601321f},
-std::array<float,2>{0.382843554f, 0.758760214f},
-std::array<float,2>{0.158243552f, 0.214791581f},
-std::array<float,2>{0.635271847f, 0.65345633f},
-std::array<float,2>{0.572224557f, 0.0110175898f},
-std::array<float,2>{0.0955813006f, 0.590709507f},
-std::array<float,2>{0.275121927f, 0.478087515f},
-std::array<float,2>{0.948458433f, 0.879593968f},
-std::array<float,2>{0.912476957f, 0.173251107f},
-std::array<float,2>{0.346709371f, 0.749026895f},
-std::array<float,2>{0.0373119265f, 0.335412264f},
-std::array<float,2>{0.540103078f, 0.860759497f},
-std::array<float,2>{0.746749878f, 0.437491775f},
-std::array<float,2>{0.222189263f, 0.950035453f},
-std::array<float,2>{0.489487261f, 0.0967864543f},
-std::array<float,2>{0.8305884f, 0.556868792f},
-std::array<float,2>{0.819655478f, 0.402354509f},
-std::array<float,2>{0.481968015f, 0.987463474f},
-std::array<float,2>{0.248608157f, 0.0710370168f},
-std::array<float,2>{0.722787499f, 0.501801193f},
-std::array<float,2>{0.554753304f, 0.127158731f},
-std::array<float,2>{0.0492512025f, 0.716981828f},
-std::array<float,2>{0.366217375f, 0.362536579f},
-std::array<float,2>{0.923013985f, 0.813914001f},
-std::array<float,2>{0.961252511f, 0.0398850702f},
-std::array<float,2>{0.264111221f, 0.600423515f},
-std::array<float,2>{0.121303879f, 0.451370716f},
-std::array<float,2>{0.585978091f, 0.916145027f},
-std::array<float,2>{0.644210458f, 0.26513955f},
-std::array<float,2>{0.185441926f, 0.799202085f},
-std::array<float,2>{0.400346905f, 0.23995173f},
-std::array<float,2>{0.771148503f, 0.675071537f},
-std::array<float,2>{0.88760215f, 0.327211231f},
-std::array<float,2>{0.33389318f, 0.855193496f},
-std::array<float,2>{0.0168114342f, 0.165498778f},
-std::array<float,2>{0.530580461f, 0.728793502f},
-std::array<float,2>{0.702951491f, 0.114337094f},
-std::array<float,2>{0.188828975f, 0.532346427f},
-std::array<float,2>{0.44935298f, 0.40836224f},
-std::array<float,2>{0.859209418f, 0.965102077f},
-std::array<float,2>{0.808729649f, 0.202862188f},
-std::array<float,2>{0.424400926f, 0.634409428f},
-std::array<float,2>{0.133429036f, 0.308850884f},
-std::array<float,2>{0.660480022f, 0.772536337f},
-std::array<float,2>{0.621385276f, 0.488502204f},
-std::array<float,2>{0.0828160942f, 0.897779584f},
-std::array<float,2>{0.309885383f, 0.0173505489f},
-std::array<float,2>{0.977335751f, 0.572659075f},
-std::array<float,2>{0.930756271f, 0.414702654f},
-std::array<float,2>{0.374803901f, 0.953858614f},
-std::array<float,2>{0.057466235f, 0.117464751f},
-std::array<float,2>{0.552127421f, 0.539420724f},
-std::array<float,2>{0.731922925f, 0.156924576f},
-std::array<float,2>{0.235199094f, 0.72041291f},
-std::array<float,2>{0.469985455f, 0.320216805f},
-std::array<float,2>{0.825392306f, 0.85036552f},
-std::array<float,2>{0.773623705f, 0.0262636375f},
-std::array<float,2>{0.393856049f, 0.565257788f},
-std::array<float,2>{0.177383825f, 0.493907511f},
-std::array<float,2>{0.655878723f, 0.903682053f},
-std::array<float,2>{0.583690464f, 0.303390741f},
-std::array<float,2>{0.114410423f, 0.778988481f},
-std::array<float,2>{0.257252157f, 0.188599408f},
-std::array<float,2>{0.955182195f, 0.626035571f},
-std::array<float,2>{0.843788087f, 0.372485131f},
-std::array<float,2>{0.443902522f, 0.822816849f},
-std::array<float,2>{0.199111819f, 0.134778678f},
-std::array<float,2>{0.691108346f, 0.704444885f},
-std::array<float,2>{0.518848717f, 0.0637378544f},
-std::array<float,2>{0.0281337593f, 0.508155048f},
-std::array<float,2>{0.341302782f, 0.392613441f},
-std::array<float,2>{0.875581741f, 0.99714303f},
-std::array<float,2>{0.971115112f, 0.246003196f},
-std::array<float,2>{0.303899288f, 0.685434222f},
-std::array<float,2>{0.092471011f, 0.250504822f},
-std::array<float,2>{0.611647069f, 0.809082687f},
-std::array<float,2>{0.66799438f, 0.443639606f},
-std::array<float,2>{0.129253015f, 0.90781939f},
-std::array<float,2>{0.436699748f, 0.0371852852f},
-std::array<float,2>{0.802256286f, 0.607660472f},
-std::array<float,2>{0.783859074f, 0.470779121f},
-std::array<float,2>{0.413604587f, 0.889092565f},
-std::array<float,2>{0.148813754f, 0.00559100136f},
-std::array<float,2>{0.685791492f, 0.580241144f},
-std::array<float,2>{0.601160526f, 0.206429958f},
-std::array<float,2>{0.0643365085f, 0.641613483f},
-std::array<float,2>{0.295731395f, 0.282127053f},
-std::array<float,2>{0.990162551f, 0.756233037f},
-std::array<float,2>{0.893103898f, 0.107806429f},
-std::array<float,2>{0.314295262f, 0.551977336f},
-std::array<float,2>{0.0114662852f, 0.423106968f},
-std::array<float,2>{0.503987014f, 0.942866445f},
-std::array<float,2>{0.717324436f, 0.336722791f},
-std::array<float,2>{0.213514477f, 0.86774087f},
-std::array<float,2>{0.465383142f, 0.186518833f},
-std::array<float,2>{0.860352159f, 0.736328363f},
-std::array<float,2>{0.939510703f, 0.277118742f},
-std::array<float,2>{0.27220279f, 0.786084354f},
-std::array<float,2>{0.102875762f, 0.225327373f},
-std::array<float,2>{0.566645145f, 0.665064991f},
-std::array<float,2>{0.625891447f, 0.0531464703f},
-std::array<float,2>{0.169497222f, 0.615513444f},
-std::array<float,2>{0.377426475f, 0.459917277f},
-std::array<float,2>{0.762630045f, 0.93220073f},
-std::array<float,2>{0.836726189f, 0.156231448f},
-std::array<float,2>{0.492499024f, 0.702478468f},
-std::array<float,2>{0.230468616f, 0.358260751f},
-std::array<float,2>{0.734773636f, 0.840537548f},
-std::array<float,2>{0.534514725f, 0.388744444f},
-std::array<float,2>{0.0425623767f, 0.976740479f},
-std::array<float,2>{0.358205348f, 0.0785207599f},
-std::array<float,2>{0.921748102f, 0.525436342f},
-std::array<float,2>{0.89824003f, 0.446869671f},
-std::array<float,2>{0.317360371f, 0.920866668f},
-std::array<float,2>{0.0134187583f, 0.0457614288f},
-std::array<float,2>{0.501620173f, 0.597377241f},
-std::array<float,2>{0.713435829f, 0.23764959f},
-std::array<float,2>{0.214978948f, 0.678459942f},
-std::array<float,2>{0.463943601f, 0.25838542f},
-std::array<float,2>{0.866392851f, 0.80430603f},
-std::array<float,2>{0.787288785f, 0.0750430375f},
-std::array<float,2>{0.406291038f, 0.506438613f},
-std::array<float,2>{0.155452788f, 0.400107473f},
-std::array<float,2>{0.681597114f, 0.989347696f},
-std::array<float,2>{0.596834481f, 0.364106387f},
-std::array<float,2>{0.067451641f, 0.819484413f},
-std::array<float,2>{0.28979966f, 0.129771262f},
-std::array<float,2>{0.986085236f, 0.714138508f},
-std::array<float,2>{0.841460407f, 0.308123171f},
-std::array<float,2>{0.498252988f, 0.766793787f},
-std::array<float,2>{0.23097457f, 0.195436895f},
-std::array<float,2>{0.739742935f, 0.637432098f},
-std::array<float,2>{0.53716433f, 0.0216566566f},
-std::array<float,2>{0.0449892916f, 0.576597571f},
-std::array<float,2>{0.353883088f, 0.485744864f},
-std::array<float,2>{0.917429984f, 0.8925699f},
-std::array<float,2>{0.943208992f, 0.171141788f},
-std::array<float,2>{0.26834172f, 0.734251142f},
-std::array<float,2>{0.10620077f, 0.322886109f},
-std::array<float,2>{0.563331842f, 0.85631752f},
-std::array<float,2>{0.630065382f, 0.410603821f},
-std::array<float,2>{0.164202929f, 0.963314712f},
-std::array<float,2>{0.380391479f, 0.112567149f},
-std::array<float,2>{0.76010412f, 0.538842142f},
-std::array<float,2>{0.780232489f, 0.37708813f},
-std::array<float,2>{0.397684813f, 0.972822547f},
-std::array<float,2>{0.172978833f, 0.0897832066f},
-std::array<float,2>{0.651455522f, 0.52051878f},
-std::array<float,2>{0.580684602f, 0.148089603f},
-std::array<float,2>{0.111818291f, 0.693473816f},
-std::array<float,2>{0.25110516f, 0.350270867f},
-std::array<float,2>{0.957262576f, 0.832952201f},
-std::array<float,2>{0.933870018f, 0.0612148419f},
-std::array<float,2>{0.368471503f, 0.617643893f},
-std::array<float,2>{0.0607149079f, 0.468555033f},
-std::array<float,2>{0.547296584f, 0.928152025f},
-std::array<float,2>{0.730322301f, 0.272828758f},
-std::array<float,2>{0.240211695f, 0.794714034f},
-std::array<float,2>{0.475883961f, 0.230044454f},
-std::array<float,2>{0.82260555f, 0.659383297f},
-std::array<float,2>{0.974125087f, 0.330813438f},
-std::array<float,2>{0.298434287f, 0.866624475f},
-std::array<float,2>{0.0890495256f, 0.176805079f},
-std::array<float,2>{0.613420486f, 0.742618859f},
-std::array<float,2>{0.664339185f, 0.100724176f},
-std::array<float,2>{0.126080692f, 0.558835864f},
-std::array<float,2>{0.433040112f, 0.431589454f},
-std::array<float,2>{0.797038496f, 0.946183443f},
-std::array<float,2>{0.84785229f, 0.215906128f},
-std::array<float,2>{0.438057154f, 0.650650561f},
-std::array<float,2>{0.20277746f, 0.291786849f},
-std::array<float,2>{0.693340302f, 0.763089299f},
-std::array<float,2>{0.519720376f, 0.484267443f},
-std::array<float,2>{0.0264510382f, 0.876000106f},
-std::array<float,2>{0.336525142f, 0.0122365756f},
-std::array<float,2>{0.880787313f, 0.585960627f},
-std::array<float,2>{0.964959204f, 0.426104486f},
-std::array<float,2>{0.259592742f, 0.940942764f},
-std::array<float,2>{0.118289106f, 0.102261893f},
-std::array<float,2>{0.592187047f, 0.550553977f},
-std::array<float,2>{0.646060884f, 0.180702448f},
-std::array<float,2>{0.18253544f, 0.741435826f},
-std::array<float,2>{0.40384534f, 0.342128068f},
-std::array<float,2>{0.76886183f, 0.8728441f},
-std::array<float,2>{0.813362718f, 0.00095186074f},
-std::array<float,2>{0.479154527f, 0.582624614f},
-std::array<float,2>{0.245013982f, 0.474589556f},
-std::array<float,2>{0.722257316f, 0.883529305f},
-std::array<float,2>{0.559304833f, 0.288733691f},
-std::array<float,2>{0.0538456403f, 0.751537204f},
-std::array<float,2>{0.361965358f, 0.209672481f},
-std::array<float,2>{0.927745461f, 0.647538126f},
-std::array<float,2>{0.806127429f, 0.351739019f},
-std::array<float,2>{0.42879042f, 0.836390674f},
-std::array<float,2>{0.139935657f, 0.152024314f},
-std::array<float,2>{0.659141958f, 0.695443928f},
-std::array<float,2>{0.619244874f, 0.0857412294f},
-std::array<float,2>{0.0819293261f, 0.528929055f},
-std::array<float,2>{0.305301309f, 0.383668303f},
-std::array<float,2>{0.982701063f, 0.984001338f},
-std::array<float,2>{0.883243144f, 0.220666721f},
-std::array<float,2>{0.330761284f, 0.670332789f},
-std::array<float,2>{0.019612046f, 0.27822274f},
-std::array<float,2>{0.523753464f, 0.781499982f},
-std::array<float,2>{0.697699785f, 0.455165803f},
-std::array<float,2>{0.19376038f, 0.934858859f},
-std::array<float,2>{0.448114067f, 0.0487649031f},
-std::array<float,2>{0.852795422f, 0.611340404f},
-std::array<float,2>{0.871726573f, 0.496126473f},
-std::array<float,2>{0.456125259f, 0.900030077f},
-std::array<float,2>{0.203883559f, 0.0299026817f},
-std::array<float,2>{0.707662106f, 0.567602694f},
-std::array<float,2>{0.508990943f, 0.191957131f},
-std::array<float,2>{0.00595117314f, 0.63150692f},
-std::array<float,2>{0.324323952f, 0.297758788f},
-std::array<float,2>{0.902740955f, 0.773494363f},
-std::array<float,2>{0.996409833f, 0.124202885f},
-std::array<float,2>{0.288907886f, 0.546665907f},
-std::array<float,2>{0.0754198357f, 0.419790506f},
-std::array<float,2>{0.604628325f, 0.960652828f},
-std::array<float,2>{0.677741289f, 0.313230842f},
-std::array<float,2>{0.145373672f, 0.845395803f},
-std::array<float,2>{0.417607337f, 0.160383761f},
-std::array<float,2>{0.795319736f, 0.723689497f},
-std::array<float,2>{0.9086712f, 0.255387515f},
-std::array<float,2>{0.350659192f, 0.804875433f},
-std::array<float,2>{0.0317080915f, 0.24845539f},
-std::array<float,2>{0.544905663f, 0.683226824f},
-std::array<float,2>{0.745626986f, 0.0324133672f},
-std::array<float,2>{0.225833371f, 0.602573335f},
-std::array<float,2>{0.488261372f, 0.441259086f},
-std::array<float,2>{0.833436191f, 0.912668347f},
-std::array<float,2>{0.756909668f, 0.136823654f},
-std::array<float,2>{0.388511449f, 0.708695948f},
-std::array<float,2>{0.162683949f, 0.367393136f},
-std::array<float,2>{0.638763189f, 0.825796545f},
-std::array<float,2>{0.575437784f, 0.394931167f},
-std::array<float,2>{0.0978623033f, 0.995157957f},
-std::array<float,2>{0.281163782f, 0.0679155812f},
-std::array<float,2>{0.951030254f, 0.513748348f},
-std::array<float,2>{0.989458621f, 0.470017165f},
-std::array<float,2>{0.294963837f, 0.886776686f},
-std::array<float,2>{0.0638534799f, 0.00637748092f},
-std::array<float,2>{0.600820899f, 0.578358054f},
-std::array<float,2>{0.686069667f, 0.203196034f},
-std::array<float,2>{0.149077237f, 0.643228352f},
-std::array<float,2>{0.41340676f, 0.284564167f},
-std::array<float,2>{0.783305764f, 0.75571847f},
-std::array<float,2>{0.861221611f, 0.106906727f},
-std::array<float,2>{0.464907199f, 0.553459167f},
-std::array<float,2>{0.213179842f, 0.425471604f},
-std::array<float,2>{0.71723783f, 0.944355309f},
-std::array<float,2>{0.504800856f, 0.338760972f},
-std::array<float,2>{0.0107916463f, 0.869910359f},
-std::array<float,2>{0.313747853f, 0.184984639f},
-std::array<float,2>{0.89293021f, 0.734739423f},
-std::array<float,2>{0.761879444f, 0.274847597f},
-std::array<float,2>{0.377465487f, 0.788915634f},
-std::array<float,2>{0.169408128f, 0.222808138f},
-std::array<float,2>{0.625008643f, 0.666113019f},
-std::array<float,2>{0.567299962f, 0.0522556454f},
-std::array<float,2>{0.10349866f, 0.613737404f},
-std::array<float,2>{0.271489263f, 0.457575113f},
-std::array<float,2>{0.940236568f, 0.93052268f},
-std::array<float,2>{0.920981169f, 0.153175905f},
-std::array<float,2>{0.357850432f, 0.700080633f},
-std::array<float,2>{0.04215746f, 0.356029481f},
-std::array<float,2>{0.534679294f, 0.841829896f},
-std::array<float,2>{0.734976828f, 0.387883723f},
-std::array<float,2>{0.229769498f, 0.980397582f},
-std::array<float,2>{0.493025005f, 0.081702821f},
-std::array<float,2>{0.83602649f, 0.52453953f},
-std::array<float,2>{0.825763941f, 0.416029006f},
-std::array<float,2>{0.47065556f, 0.955291271f},
-std::array<float,2>{0.234485015f, 0.120768912f},
-std::array<float,2>{0.732289732f, 0.542247117f},
-std::array<float,2>{0.552532613f, 0.158363447f},
-std::array<float,2>{0.0569435433f, 0.722356617f},
-std::array<float,2>{0.374308676f, 0.317847252f},
-std::array<float,2>{0.931260228f, 0.848030925f},
-std::array<float,2>{0.95598489f, 0.0243438594f},
-std::array<float,2>{0.257659107f, 0.564192951f},
-std::array<float,2>{0.114820287f, 0.494396657f},
-std::array<float,2>{0.583227277f, 0.904984295f},
-std::array<float,2>{0.655362368f, 0.301489472f},
-std::array<float,2>{0.176850766f, 0.779879987f},
-std::array<float,2>{0.394325644f, 0.190854117f},
-std::array<float,2>{0.774187684f, 0.628203094f},
-std::array<float,2>{0.875158429f, 0.373478681f},
-std::array<float,2>{0.34156692f, 0.822183371f},
-std::array<float,2>{0.0277964883f, 0.13410826f},
-std::array<float,2>{0.519476056f, 0.706454933f},
-std::array<float,2>{0.690851033f, 0.0658058822f},
-std::array<float,2>{0.198301703f, 0.509930432f},
-std::array<float,2>{0.443630129f, 0.391132563f},
-std::array<float,2>{0.844555855f, 0.998517394f},
-std::array<float,2>{0.801958144f, 0.242996484f},
-std::array<float,2>{0.437037885f, 0.686857522f},
-std::array<float,2>{0.129874185f, 0.252133906f},
-std::array<float,2>{0.668838799f, 0.810843349f},
-std::array<float,2>{0.611833096f, 0.442652911f},
-std::array<float,2>{0.0921213329f, 0.909343243f},
-std::array<float,2>{0.304289758f, 0.0368619859f},
-std::array<float,2>{0.971215248f, 0.60579741f},
-std::array<float,2>{0.923405588f, 0.40607661f},
-std::array<float,2>{0.367038012f, 0.985056758f},
-std::array<float,2>{0.0496393591f, 0.0725441054f},
-std::array<float,2>{0.555333316f, 0.503492475f},
-std::array<float,2>{0.723489523f, 0.125142843f},
-std::array<float,2>{0.248134896f, 0.715343177f},
-std::array<float,2>{0.481457502f, 0.360588014f},
-std::array<float,2>{0.819885373f, 0.81618607f},
-std::array<float,2>{0.770575881f, 0.0413437672f},
-std::array<float,2>{0.399604589f, 0.597973704f},
-std::array<float,2>{0.185000867f, 0.450925946f},
-std::array<float,2>{0.643713176f, 0.91564244f},
-std::array<float,2>{0.586877882f, 0.261845201f},
-std::array<float,2>{0.121731497f, 0.796916842f},
-std::array<float,2>{0.26430288f, 0.24113822f},
-std::array<float,2>{0.96156162f, 0.672480106f},
-std::array<float,2>{0.858535111f, 0.325933009f},
-std::array<float,2>{0.450109839f, 0.851607859f},
-std::array<float,2>{0.189193457f, 0.16753158f},
-std::array<float,2>{0.70229578f, 0.728338897f},
-std::array<float,2>{0.530987859f, 0.116403788f},
-std::array<float,2>{0.0174526051f, 0.533254445f},
-std::array<float,2>{0.333424568f, 0.407865018f},
-std::array<float,2>{0.886925697f, 0.967805088f},
-std::array<float,2>{0.976615906f, 0.200804278f},
-std::array<float,2>{0.310063303f, 0.635528684f},
-std::array<float,2>{0.0820507854f, 0.312311023f},
-std::array<float,2>{0.621650577f, 0.769632041f},
-std::array<float,2>{0.660935462f, 0.491459668f},
-std::array<float,2>{0.133166537f, 0.895552814f},
-std::array<float,2>{0.424051642f, 0.0191954207f},
-std::array<float,2>{0.809486628f, 0.571884573f},
-std::array<float,2>{0.790568531f, 0.463585585f},
-std::array<float,2>{0.420207202f, 0.924586236f},
-std::array<float,2>{0.143962249f, 0.0562439859f},
-std::array<float,2>{0.672989666f, 0.62368089f},
-std::array<float,2>{0.609138012f, 0.231955633f},
-std::array<float,2>{0.0704306215f, 0.662629068f},
-std::array<float,2>{0.284738868f, 0.267980874f},
-std::array<float,2>{0.992555201f, 0.791722894f},
-std::array<float,2>{0.899162233f, 0.0937050506f},
-std::array<float,2>{0.324192464f, 0.516410112f},
-std::array<float,2>{0.0035600944f, 0.379123569f},
-std::array<float,2>{0.513784766f, 0.97168088f},
-std::array<float,2>{0.705596447f, 0.345247775f},
-std::array<float,2>{0.209792152f, 0.828371227f},
-std::array<float,2>{0.459342539f, 0.143470347f},
-std::array<float,2>{0.870880365f, 0.687790871f},
-std::array<float,2>{0.949038029f, 0.296759039f},
-std::array<float,2>{0.274461061f, 0.760472953f},
-std::array<float,2>{0.0951121598f, 0.211857378f},
-std::array<float,2>{0.571602345f, 0.654759526f},
-std::array<float,2>{0.634857595f, 0.00926067028f},
-std::array<float,2>{0.159011185f, 0.593248844f},
-std::array<float,2>{0.383546591f, 0.479676485f},
-std::array<float,2>{0.752455652f, 0.881321609f},
-std::array<float,2>{0.830385864f, 0.174914598f},
-std::array<float,2>{0.489893138f, 0.746444821f},
-std::array<float,2>{0.22192952f, 0.332643449f},
-std::array<float,2>{0.746254444f, 0.862586737f},
-std::array<float,2>{0.540731728f, 0.43370685f},
-std::array<float,2>{0.037729919f, 0.951734781f},
-std::array<float,2>{0.347220242f, 0.0941747427f},
-std::array<float,2>{0.912973344f, 0.554983556f},
-std::array<float,2>{0.915563583f, 0.486799985f},
-std::array<float,2>{0.353248328f, 0.893611968f},
-std::array<float,2>{0.0440402143f, 0.0211194903f},
-std::array<float,2>{0.536896944f, 0.575450063f},
-std::array<float,2>{0.740825534f, 0.198896334f},
-std::array<float,2>{0.233653277f, 0.639131665f},
-std::array<float,2>{0.497269839f, 0.306208462f},
-std::array<float,2>{0.843278587f, 0.768334568f},
-std::array<float,2>{0.757981122f, 0.11067649f},
-std::array<float,2>{0.381406397f, 0.5359779f},
-std::array<float,2>{0.166194141f, 0.41231057f},
-std::array<float,2>{0.632589877f, 0.961623132f},
-std::array<float,2>{0.565393448f, 0.321191877f},
-std::array<float,2>{0.109361775f, 0.858504534f},
-std::array<float,2>{0.26652661f, 0.169406548f},
-std::array<float,2>{0.943547606f, 0.732331097f},
-std::array<float,2>{0.86473459f, 0.261440277f},
-std::array<float,2>{0.461619526f, 0.801868677f},
-std::array<float,2>{0.21738179f, 0.234850138f},
-std::array<float,2>{0.712032378f, 0.67587775f},
-std::array<float,2>{0.503414154f, 0.0438106731f},
-std::array<float,2>{0.0138358446f, 0.59526062f},
-std::array<float,2>{0.319813073f, 0.448166728f},
-std::array<float,2>{0.895176768f, 0.919097543f},
-std::array<float,2>{0.987905443f, 0.132324636f},
-std::array<float,2>{0.291895837f, 0.712087333f},
-std::array<float,2>{0.0695626587f, 0.365850478f},
-std::array<float,2>{0.594195962f, 0.817868412f},
-std::array<float,2>{0.682853818f, 0.402089268f},
-std::array<float,2>{0.153602481f, 0.99079746f},
-std::array<float,2>{0.408818454f, 0.077824384f},
-std::array<float,2>{0.786026776f, 0.505456567f},
-std::array<float,2>{0.799404442f, 0.432097822f},
-std::array<float,2>{0.430430502f, 0.948262215f},
-std::array<float,2>{0.127346814f, 0.0977379158f},
-std::array<float,2>{0.666201472f, 0.561954379f},
-std::array<float,2>{0.616824687f, 0.178226709f},
-std::array<float,2>{0.086597614f, 0.745183349f},
-std::array<float,2>{0.299379736f, 0.329860121f},
-std::array<float,2>{0.975226164f, 0.863447666f},
-std::array<float,2>{0.882161081f, 0.014890315f},
-std::array<float,2>{0.338553876f, 0.588907778f},
-std::array<float,2>{0.0235198345f, 0.481293708f},
-std::array<float,2>{0.5219239f, 0.878415704f},
-std::array<float,2>{0.693471253f, 0.289209366f},
-std::array<float,2>{0.199760869f, 0.764547884f},
-std::array<float,2>{0.440037936f, 0.218634814f},
-std::array<float,2>{0.8496297f, 0.650197208f},
-std::array<float,2>{0.9606691f, 0.348171741f},
-std::array<float,2>{0.25366044f, 0.835792661f},
-std::array<float,2>{0.109531358f, 0.144868538f},
-std::array<float,2>{0.579615355f, 0.691921592f},
-std::array<float,2>{0.650368035f, 0.0877848715f},
-std::array<float,2>{0.174200594f, 0.521826208f},
-std::array<float,2>{0.395070583f, 0.376331419f},
-std::array<float,2>{0.779214442f, 0.975906789f},
-std::array<float,2>{0.82215327f, 0.22710155f},
-std::array<float,2>{0.473278373f, 0.658078194f},
-std::array<float,2>{0.240990728f, 0.271362215f},
-std::array<float,2>{0.726822376f, 0.795025885f},
-std::array<float,2>{0.550310552f, 0.466348976f},
-std::array<float,2>{0.0598266572f, 0.927583098f},
-std::array<float,2>{0.3700504f, 0.0597621761f},
-std::array<float,2>{0.936137438f, 0.619172096f},
-std::array<float,2>{0.982364595f, 0.386667699f},
-std::array<float,2>{0.307890534f, 0.98228085f},
-std::array<float,2>{0.0789366364f, 0.0831885412f},
-std::array<float,2>{0.618301034f, 0.530145228f},
-std::array<float,2>{0.656985581f, 0.148518145f},
-std::array<float,2>{0.138504669f, 0.697725952f},
-std::array<float,2>{0.426264405f, 0.353830338f},
-std::array<float,2>{0.807676673f, 0.838923454f},
-std::array<float,2>{0.853515923f, 0.0498443097f},
-std::array<float,2>{0.447151035f, 0.610720158f},
-std::array<float,2>{0.192088395f, 0.453879207f},
-std::array<float,2>{0.697161198f, 0.937021017f},
-std::array<float,2>{0.526722133f, 0.280964017f},
-std::array<float,2>{0.0229256637f, 0.783361435f},
-std::array<float,2>{0.328536481f, 0.222010702f},
-std::array<float,2>{0.885235548f, 0.669337392f},
-std::array<float,2>{0.766681254f, 0.340207279f},
-std::array<float,2>{0.404824883f, 0.87328732f},
-std::array<float,2>{0.180372447f, 0.183358088f},
-std::array<float,2>{0.647669733f, 0.738820672f},
-std::array<float,2>{0.590414822f, 0.103765197f},
-std::array<float,2>{0.120193347f, 0.547024608f},
-std::array<float,2>{0.260919124f, 0.428595394f},
-std::array<float,2>{0.968693435f, 0.938033342f},
-std::array<float,2>{0.926418662f, 0.208790988f},
-std::array<float,2>{0.359414756f, 0.646025717f},
-std::array<float,2>{0.0515474752f, 0.28539601f},
-std::array<float,2>{0.561826944f, 0.752966642f},
-std::array<float,2>{0.720221341f, 0.475123495f},
-std::array<float,2>{0.242249846f, 0.886310339f},
-std::array<float,2>{0.477804333f, 0.00304467045f},
-std::array<float,2>{0.816068232f, 0.585434914f},
-std::array<float,2>{0.835086346f, 0.438483834f},
-std::array<float,2>{0.486220419f, 0.910170257f},
-std::array<float,2>{0.224604964f, 0.0332122557f},
-std::array<float,2>{0.743880749f, 0.605200768f},
-std::array<float,2>{0.545505762f, 0.246247038f},
-std::array<float,2>{0.0333044268f, 0.67975837f},
-std::array<float,2>{0.348378152f, 0.256347954f},
-std::array<float,2>{0.907620013f, 0.807855606f},
-std::array<float,2>{0.952944517f, 0.0695800781f},
-std::array<float,2>{0.278902739f, 0.512397945f},
-std::array<float,2>{0.100997254f, 0.398103207f},
-std::array<float,2>{0.576889157f, 0.993294179f},
-std::array<float,2>{0.638038635f, 0.370224714f},
-std::array<float,2>{0.161268592f, 0.826980531f},
-std::array<float,2>{0.389978081f, 0.140483916f},
-std::array<float,2>{0.754501879f, 0.710038781f},
-std::array<float,2>{0.905408323f, 0.299664587f},
-std::array<float,2>{0.327151984f, 0.776665568f},
-std::array<float,2>{0.00404770439f, 0.19470939f},
-std::array<float,2>{0.510418475f, 0.629026473f},
-std::array<float,2>{0.709680498f, 0.0286444705f},
-std::array<float,2>{0.205159158f, 0.569233298f},
-std::array<float,2>{0.454111069f, 0.499520361f},
-std::array<float,2>{0.873062968f, 0.900490165f},
-std::array<float,2>{0.794193864f, 0.162501469f},
-std::array<float,2>{0.415684134f, 0.724614441f},
-std::array<float,2>{0.147506237f, 0.316293925f},
-std::array<float,2>{0.677438438f, 0.846320391f},
-std::array<float,2>{0.603099406f, 0.420438528f},
-std::array<float,2>{0.0775952414f, 0.958584905f},
-std::array<float,2>{0.285788387f, 0.12220148f},
-std::array<float,2>{0.99988234f, 0.543498874f},
-std::array<float,2>{0.939036429f, 0.459348232f},
-std::array<float,2>{0.269609958f, 0.931648493f},
-std::array<float,2>{0.103890277f, 0.0532326363f},
-std::array<float,2>{0.568488479f, 0.616096497f},
-std::array<float,2>{0.628077865f, 0.224619344f},
-std::array<float,2>{0.170675039f, 0.665871203f},
-std::array<float,2>{0.376485825f, 0.276471585f},
-std::array<float,2>{0.765402615f, 0.785614133f},
-std::array<float,2>{0.839283168f, 0.0787599012f},
-std::array<float,2>{0.495784342f, 0.526050508f},
-std::array<float,2>{0.228265926f, 0.389630377f},
-std::array<float,2>{0.737214804f, 0.977360606f},
-std::array<float,2>{0.532806754f, 0.357830495f},
-std::array<float,2>{0.0399838239f, 0.83997941f},
-std::array<float,2>{0.35566321f, 0.15573208f},
-std::array<float,2>{0.919399738f, 0.702644885f},
-std::array<float,2>{0.782609642f, 0.281409919f},
-std::array<float,2>{0.410799503f, 0.756523073f},
-std::array<float,2>{0.150951192f, 0.206987709f},
-std::array<float,2>{0.683829665f, 0.642548382f},
-std::array<float,2>{0.597727835f, 0.00519753713f},
-std::array<float,2>{0.064939186f, 0.580635667f},
-std::array<float,2>{0.293620378f, 0.471432418f},
-std::array<float,2>{0.990408838f, 0.889207006f},
-std::array<float,2>{0.892455161f, 0.185945928f},
-std::array<float,2>{0.315021157f, 0.737221956f},
-std::array<float,2>{0.00837764796f, 0.336147279f},
-std::array<float,2>{0.506591499f, 0.867533088f},
-std::array<float,2>{0.715676129f, 0.423542947f},
-std::array<float,2>{0.212525532f, 0.943246603f},
-std::array<float,2>{0.467256933f, 0.108150072f},
-std::array<float,2>{0.861966312f, 0.55236131f},
-std::array<float,2>{0.846167028f, 0.393540531f},
-std::array<float,2>{0.441406429f, 0.997732043f},
-std::array<float,2>{0.196284354f, 0.0640268102f},
-std::array<float,2>{0.688615739f, 0.50860554f},
-std::array<float,2>{0.51733458f, 0.135312736f},
-std::array<float,2>{0.0294001549f, 0.704866707f},
-std::array<float,2>{0.342193544f, 0.372657031f},
-std::array<float,2>{0.878117621f, 0.822351217f},
-std::array<float,2>{0.970016837f, 0.0377685726f},
-std::array<float,2>{0.301221222f, 0.608031631f},
-std::array<float,2>{0.0901585445f, 0.44409579f},
-std::array<float,2>{0.610020101f, 0.907387376f},
-std::array<float,2>{0.670069754f, 0.250442713f},
-std::array<float,2>{0.13109611f, 0.808792591f},
-std::array<float,2>{0.435186505f, 0.245275959f},
-std::array<float,2>{0.802813768f, 0.684946239f},
-std::array<float,2>{0.933473945f, 0.319573224f},
-std::array<float,2>{0.371652991f, 0.850049257f},
-std::array<float,2>{0.0559706837f, 0.156555608f},
-std::array<float,2>{0.553496361f, 0.719817877f},
-std::array<float,2>{0.734308898f, 0.11782933f},
-std::array<float,2>{0.236546189f, 0.539806783f},
-std::array<float,2>{0.471666783f, 0.414393544f},
-std::array<float,2>{0.827945471f, 0.953290462f},
-std::array<float,2>{0.775399745f, 0.189243659f},
-std::array<float,2>{0.391520649f, 0.62674886f},
-std::array<float,2>{0.17964232f, 0.302901596f},
-std::array<float,2>{0.653346717f, 0.778370082f},
-std::array<float,2>{0.585410833f, 0.493632078f},
-std::array<float,2>{0.117085278f, 0.90408951f},
-std::array<float,2>{0.254990906f, 0.0254726186f},
-std::array<float,2>{0.953890622f, 0.564790726f},
-std::array<float,2>{0.889916182f, 0.408807516f},
-std::array<float,2>{0.33468768f, 0.965421617f},
-std::array<float,2>{0.0189556051f, 0.115224227f},
-std::array<float,2>{0.527781308f, 0.533174634f},
-std::array<float,2>{0.699620903f, 0.165647104f},
-std::array<float,2>{0.189859048f, 0.729069471f},
-std::array<float,2>{0.452102363f, 0.327897757f},
-std::array<float,2>{0.855597734f, 0.854524255f},
-std::array<float,2>{0.811173439f, 0.0166868865f},
-std::array<float,2>{0.422710896f, 0.573095739f},
-std::array<float,2>{0.136155382f, 0.489099979f},
-std::array<float,2>{0.663187385f, 0.898045301f},
-std::array<float,2>{0.62489301f, 0.309468806f},
-std::array<float,2>{0.085756205f, 0.772975802f},
-std::array<float,2>{0.312466383f, 0.202196702f},
-std::array<float,2>{0.97989428f, 0.633872032f},
-std::array<float,2>{0.81735307f, 0.362923682f},
-std::array<float,2>{0.484196693f, 0.814332604f},
-std::array<float,2>{0.247500494f, 0.127677709f},
-std::array<float,2>{0.72600162f, 0.717760921f},
-std::array<float,2>{0.557716191f, 0.070477277f},
-std::array<float,2>{0.048623357f, 0.501039147f},
-std::array<float,2>{0.364093095f, 0.402863026f},
-std::array<float,2>{0.923972905f, 0.988034546f},
-std::array<float,2>{0.964700997f, 0.23951605f},
-std::array<float,2>{0.2627545f, 0.675723374f},
-std::array<float,2>{0.12355724f, 0.264909238f},
-std::array<float,2>{0.588726699f, 0.799452722f},
-std::array<float,2>{0.640764534f, 0.451700598f},
-std::array<float,2>{0.186512277f, 0.91686213f},
-std::array<float,2>{0.401177108f, 0.0393293016f},
-std::array<float,2>{0.772761583f, 0.5997352f},
-std::array<float,2>{0.750623524f, 0.477984846f},
-std::array<float,2>{0.386566132f, 0.879124939f},
-std::array<float,2>{0.158164769f, 0.0116272047f},
-std::array<float,2>{0.634656787f, 0.590071082f},
-std::array<float,2>{0.573846221f, 0.214114726f},
-std::array<float,2>{0.0961082801f, 0.6541062f},
-std::array<float,2>{0.27723217f, 0.294248968f},
-std::array<float,2>{0.946664453f, 0.758051574f},
-std::array<float,2>{0.911428034f, 0.0974723473f},
-std::array<float,2>{0.34515065f, 0.557416975f},
-std::array<float,2>{0.0358315855f, 0.436832637f},
-std::array<float,2>{0.542305171f, 0.949658453f},
-std::array<float,2>{0.748598874f, 0.335902333f},
-std::array<float,2>{0.220576212f, 0.860849261f},
-std::array<float,2>{0.49176386f, 0.173349142f},
-std::array<float,2>{0.828901589f, 0.749836802f},
-std::array<float,2>{0.995767832f, 0.266904056f},
-std::array<float,2>{0.281742156f, 0.789178789f},
-std::array<float,2>{0.074095279f, 0.232652351f},
-std::array<float,2>{0.606719732f, 0.661706746f},
-std::array<float,2>{0.67524159f, 0.0571863167f},
-std::array<float,2>{0.142527059f, 0.621367693f},
-std::array<float,2>{0.419785887f, 0.462870985f},
-std::array<float,2>{0.792394757f, 0.92226702f},
-std::array<float,2>{0.867385685f, 0.142379165f},
-std::array<float,2>{0.457904905f, 0.690806031f},
-std::array<float,2>{0.20706512f, 0.347243547f},
-std::array<float,2>{0.705067813f, 0.831587911f},
-std::array<float,2>{0.512974322f, 0.381213069f},
-std::array<float,2>{6.83921535e-05f, 0.969859004f},
-std::array<float,2>{0.32183072f, 0.0911444575f},
-std::array<float,2>{0.901788533f, 0.519421577f},
-std::array<float,2>{0.937415063f, 0.467098713f},
-std::array<float,2>{0.370686233f, 0.92937839f},
-std::array<float,2>{0.0586569346f, 0.0623375624f},
-std::array<float,2>{0.549646318f, 0.61892426f},
-std::array<float,2>{0.728495777f, 0.22918956f},
-std::array<float,2>{0.241995379f, 0.65859139f},
-std::array<float,2>{0.474399745f, 0.272061259f},
-std::array<float,2>{0.820966005f, 0.793441355f},
-std::array<float,2>{0.7782287f, 0.0884382352f},
-std::array<float,2>{0.395531863f, 0.520123243f},
-std::array<float,2>{0.175350606f, 0.37836951f},
-std::array<float,2>{0.649148881f, 0.974079072f},
-std::array<float,2>{0.578991652f, 0.35078004f},
-std::array<float,2>{0.110571794f, 0.83391881f},
-std::array<float,2>{0.2520881f, 0.146747246f},
-std::array<float,2>{0.959272504f, 0.694416404f},
-std::array<float,2>{0.850927114f, 0.292315513f},
-std::array<float,2>{0.440917194f, 0.76242584f},
-std::array<float,2>{0.200537503f, 0.21562621f},
-std::array<float,2>{0.695069313f, 0.651735842f},
-std::array<float,2>{0.523414135f, 0.0135921063f},
-std::array<float,2>{0.0251090191f, 0.586996794f},
-std::array<float,2>{0.339752972f, 0.48322171f},
-std::array<float,2>{0.881004214f, 0.875371873f},
-std::array<float,2>{0.976549029f, 0.17639178f},
-std::array<float,2>{0.300698042f, 0.743285775f},
-std::array<float,2>{0.0872896388f, 0.331866443f},
-std::array<float,2>{0.615924776f, 0.866069376f},
-std::array<float,2>{0.667960048f, 0.429956943f},
-std::array<float,2>{0.128821045f, 0.946918547f},
-std::array<float,2>{0.431535155f, 0.0996957868f},
-std::array<float,2>{0.800458431f, 0.559939444f},
-std::array<float,2>{0.786956072f, 0.399309397f},
-std::array<float,2>{0.409240186f, 0.988537192f},
-std::array<float,2>{0.152539f, 0.0761479065f},
-std::array<float,2>{0.682199955f, 0.507104874f},
-std::array<float,2>{0.594741344f, 0.130558655f},
-std::array<float,2>{0.0691742674f, 0.713028371f},
-std::array<float,2>{0.292348742f, 0.3650648f},
-std::array<float,2>{0.986834049f, 0.819223762f},
-std::array<float,2>{0.89636761f, 0.0462718531f},
-std::array<float,2>{0.31906563f, 0.596645892f},
-std::array<float,2>{0.0155431936f, 0.445823491f},
-std::array<float,2>{0.50239557f, 0.921441853f},
-std::array<float,2>{0.711435914f, 0.259415209f},
-std::array<float,2>{0.217902109f, 0.803140283f},
-std::array<float,2>{0.462843895f, 0.236799538f},
-std::array<float,2>{0.863864839f, 0.679108024f},
-std::array<float,2>{0.944689155f, 0.32408902f},
-std::array<float,2>{0.266721874f, 0.857314825f},
-std::array<float,2>{0.107590988f, 0.17021355f},
-std::array<float,2>{0.566003203f, 0.733345568f},
-std::array<float,2>{0.630902231f, 0.112219334f},
-std::array<float,2>{0.167736113f, 0.537489593f},
-std::array<float,2>{0.381895691f, 0.411718309f},
-std::array<float,2>{0.75879401f, 0.964308262f},
-std::array<float,2>{0.842318594f, 0.19688274f},
-std::array<float,2>{0.49695152f, 0.637961566f},
-std::array<float,2>{0.232800201f, 0.30751577f},
-std::array<float,2>{0.741848648f, 0.766344428f},
-std::array<float,2>{0.536008596f, 0.485142112f},
-std::array<float,2>{0.0435626395f, 0.891398013f},
-std::array<float,2>{0.351647794f, 0.0229261592f},
-std::array<float,2>{0.914701521f, 0.577665389f},
-std::array<float,2>{0.998950958f, 0.41849497f},
-std::array<float,2>{0.286174178f, 0.959958136f},
-std::array<float,2>{0.0766495019f, 0.123446487f},
-std::array<float,2>{0.601999581f, 0.544977188f},
-std::array<float,2>{0.675890386f, 0.1617544f},
-std::array<float,2>{0.146547601f, 0.72298795f},
-std::array<float,2>{0.41488719f, 0.313674569f},
-std::array<float,2>{0.793596864f, 0.844005227f},
-std::array<float,2>{0.874765038f, 0.0305868722f},
-std::array<float,2>{0.453294069f, 0.566999853f},
-std::array<float,2>{0.206316233f, 0.497630805f},
-std::array<float,2>{0.710826218f, 0.898867428f},
-std::array<float,2>{0.511341333f, 0.297855228f},
-std::array<float,2>{0.00566042354f, 0.775187552f},
-std::array<float,2>{0.326712072f, 0.192909628f},
-std::array<float,2>{0.905057788f, 0.63221854f},
-std::array<float,2>{0.755318284f, 0.369012445f},
-std::array<float,2>{0.389048278f, 0.824686229f},
-std::array<float,2>{0.160742491f, 0.137872994f},
-std::array<float,2>{0.63705641f, 0.707625151f},
-std::array<float,2>{0.577288747f, 0.0673640817f},
-std::array<float,2>{0.100428231f, 0.514883816f},
-std::array<float,2>{0.277494669f, 0.396299899f},
-std::array<float,2>{0.951521397f, 0.994719386f},
-std::array<float,2>{0.907087326f, 0.249801517f},
-std::array<float,2>{0.349286854f, 0.681800246f},
-std::array<float,2>{0.0350449644f, 0.254638493f},
-std::array<float,2>{0.546740949f, 0.80645597f},
-std::array<float,2>{0.743016779f, 0.44027245f},
-std::array<float,2>{0.223239347f, 0.91325742f},
-std::array<float,2>{0.484666228f, 0.0318197086f},
-std::array<float,2>{0.83423686f, 0.601775169f},
-std::array<float,2>{0.814665318f, 0.473451167f},
-std::array<float,2>{0.476800352f, 0.884397686f},
-std::array<float,2>{0.243852735f, 0.00123600417f},
-std::array<float,2>{0.719075918f, 0.583642304f},
-std::array<float,2>{0.561473668f, 0.21091336f},
-std::array<float,2>{0.052688159f, 0.647143483f},
-std::array<float,2>{0.361229897f, 0.287287146f},
-std::array<float,2>{0.927497387f, 0.750706911f},
-std::array<float,2>{0.96767956f, 0.103333086f},
-std::array<float,2>{0.260212898f, 0.549390197f},
-std::array<float,2>{0.119670443f, 0.427246869f},
-std::array<float,2>{0.591193438f, 0.939733505f},
-std::array<float,2>{0.646995604f, 0.343588412f},
-std::array<float,2>{0.181614563f, 0.871130764f},
-std::array<float,2>{0.405328363f, 0.180248439f},
-std::array<float,2>{0.766174853f, 0.740390539f},
-std::array<float,2>{0.886458993f, 0.278725237f},
-std::array<float,2>{0.329604834f, 0.783007264f},
-std::array<float,2>{0.0221436508f, 0.218963489f},
-std::array<float,2>{0.526305437f, 0.671157062f},
-std::array<float,2>{0.696200311f, 0.0471100248f},
-std::array<float,2>{0.193049058f, 0.613173544f},
-std::array<float,2>{0.445528716f, 0.45690605f},
-std::array<float,2>{0.855413079f, 0.933774948f},
-std::array<float,2>{0.807607114f, 0.151165441f},
-std::array<float,2>{0.426849544f, 0.696598411f},
-std::array<float,2>{0.137586772f, 0.353399575f},
-std::array<float,2>{0.658052742f, 0.83725822f},
-std::array<float,2>{0.617209136f, 0.384193391f},
-std::array<float,2>{0.0798946321f, 0.983365238f},
-std::array<float,2>{0.306876659f, 0.0840348899f},
-std::array<float,2>{0.981435776f, 0.528267384f},
-std::array<float,2>{0.95479095f, 0.49598816f},
-std::array<float,2>{0.254708469f, 0.905321181f},
-std::array<float,2>{0.115755476f, 0.0247022323f},
-std::array<float,2>{0.584592819f, 0.562569141f},
-std::array<float,2>{0.653001964f, 0.19025518f},
-std::array<float,2>{0.178405553f, 0.627016902f},
-std::array<float,2>{0.392442495f, 0.302036434f},
-std::array<float,2>{0.777299285f, 0.781025648f},
-std::array<float,2>{0.826326132f, 0.120036177f},
-std::array<float,2>{0.472583532f, 0.54126966f},
-std::array<float,2>{0.237758458f, 0.417290777f},
-std::array<float,2>{0.733337164f, 0.956817925f},
-std::array<float,2>{0.554114878f, 0.317329586f},
-std::array<float,2>{0.054735247f, 0.848983526f},
-std::array<float,2>{0.372820169f, 0.159818679f},
-std::array<float,2>{0.931767166f, 0.72163552f},
-std::array<float,2>{0.80443114f, 0.253812701f},
-std::array<float,2>{0.434418201f, 0.811622798f},
-std::array<float,2>{0.132112205f, 0.243864104f},
-std::array<float,2>{0.671218455f, 0.686146259f},
-std::array<float,2>{0.610352516f, 0.036029581f},
-std::array<float,2>{0.0908551514f, 0.606678426f},
-std::array<float,2>{0.30262363f, 0.442367375f},
-std::array<float,2>{0.969495654f, 0.908911049f},
-std::array<float,2>{0.877792954f, 0.13325347f},
-std::array<float,2>{0.342997044f, 0.705167294f},
-std::array<float,2>{0.0303418376f, 0.374971002f},
-std::array<float,2>{0.516100943f, 0.8208763f},
-std::array<float,2>{0.687744796f, 0.391886383f},
-std::array<float,2>{0.19659549f, 0.999677718f},
-std::array<float,2>{0.443225682f, 0.065274328f},
-std::array<float,2>{0.84750104f, 0.511510968f},
-std::array<float,2>{0.862905204f, 0.424635857f},
-std::array<float,2>{0.468583882f, 0.944223046f},
-std::array<float,2>{0.211677656f, 0.105880253f},
-std::array<float,2>{0.716784298f, 0.554080725f},
-std::array<float,2>{0.507365048f, 0.183878511f},
-std::array<float,2>{0.00914537534f, 0.735592902f},
-std::array<float,2>{0.315835804f, 0.339775234f},
-std::array<float,2>{0.890789509f, 0.870495319f},
-std::array<float,2>{0.991279185f, 0.00699752569f},
-std::array<float,2>{0.294000119f, 0.579844713f},
-std::array<float,2>{0.0662192851f, 0.469545901f},
-std::array<float,2>{0.599142671f, 0.888097882f},
-std::array<float,2>{0.684735954f, 0.283474565f},
-std::array<float,2>{0.151573583f, 0.754329145f},
-std::array<float,2>{0.411647856f, 0.204758182f},
-std::array<float,2>{0.782101035f, 0.643662989f},
-std::array<float,2>{0.918566823f, 0.356473774f},
-std::array<float,2>{0.357406139f, 0.843076468f},
-std::array<float,2>{0.0404453725f, 0.153710246f},
-std::array<float,2>{0.532055795f, 0.700675666f},
-std::array<float,2>{0.737632513f, 0.0805401653f},
-std::array<float,2>{0.226783454f, 0.524028659f},
-std::array<float,2>{0.494688004f, 0.387626797f},
-std::array<float,2>{0.838522077f, 0.979260206f},
-std::array<float,2>{0.764374912f, 0.223923013f},
-std::array<float,2>{0.375247151f, 0.667869866f},
-std::array<float,2>{0.17123279f, 0.273668796f},
-std::array<float,2>{0.627708077f, 0.787902892f},
-std::array<float,2>{0.5695526f, 0.458604455f},
-std::array<float,2>{0.105366729f, 0.930801213f},
-std::array<float,2>{0.271062523f, 0.0509239398f},
-std::array<float,2>{0.937846482f, 0.614417851f},
-std::array<float,2>{0.901183069f, 0.379909009f},
-std::array<float,2>{0.320874125f, 0.971033394f},
-std::array<float,2>{0.00120926031f, 0.0920869857f},
-std::array<float,2>{0.512352884f, 0.517011106f},
-std::array<float,2>{0.70362103f, 0.143690228f},
-std::array<float,2>{0.208109811f, 0.689302623f},
-std::array<float,2>{0.458131671f, 0.343888968f},
-std::array<float,2>{0.869114161f, 0.829423666f},
-std::array<float,2>{0.791629553f, 0.0548656397f},
-std::array<float,2>{0.418020189f, 0.624308288f},
-std::array<float,2>{0.141436949f, 0.464550883f},
-std::array<float,2>{0.674071133f, 0.925218821f},
-std::array<float,2>{0.606426358f, 0.269289881f},
-std::array<float,2>{0.0724255964f, 0.792247176f},
-std::array<float,2>{0.282717139f, 0.230560154f},
-std::array<float,2>{0.994154513f, 0.663758934f},
-std::array<float,2>{0.829892814f, 0.333788872f},
-std::array<float,2>{0.49058041f, 0.862214506f},
-std::array<float,2>{0.21920459f, 0.173846886f},
-std::array<float,2>{0.749988973f, 0.747406363f},
-std::array<float,2>{0.541136742f, 0.0956824124f},
-std::array<float,2>{0.0363299958f, 0.556421876f},
-std::array<float,2>{0.344338f, 0.434790343f},
-std::array<float,2>{0.910789192f, 0.952919841f},
-std::array<float,2>{0.945791185f, 0.212671354f},
-std::array<float,2>{0.276014984f, 0.656104028f},
-std::array<float,2>{0.0968345553f, 0.295327514f},
-std::array<float,2>{0.572320044f, 0.761336684f},
-std::array<float,2>{0.633312404f, 0.478976339f},
-std::array<float,2>{0.156662166f, 0.882150233f},
-std::array<float,2>{0.385046452f, 0.00876659714f},
-std::array<float,2>{0.751941741f, 0.592433989f},
-std::array<float,2>{0.772176266f, 0.450119048f},
-std::array<float,2>{0.402267784f, 0.915009439f},
-std::array<float,2>{0.186834276f, 0.042590104f},
-std::array<float,2>{0.642338753f, 0.5989905f},
-std::array<float,2>{0.58909446f, 0.241431862f},
-std::array<float,2>{0.124815919f, 0.673105955f},
-std::array<float,2>{0.262069911f, 0.263014942f},
-std::array<float,2>{0.963315487f, 0.79831028f},
-std::array<float,2>{0.925661862f, 0.0741895214f},
-std::array<float,2>{0.364708185f, 0.502242029f},
-std::array<float,2>{0.0471125953f, 0.40470463f},
-std::array<float,2>{0.556976199f, 0.986058652f},
-std::array<float,2>{0.724919379f, 0.359679013f},
-std::array<float,2>{0.246602386f, 0.814467549f},
-std::array<float,2>{0.483079046f, 0.126671076f},
-std::array<float,2>{0.817609727f, 0.716370046f},
-std::array<float,2>{0.97915256f, 0.311329246f},
-std::array<float,2>{0.311505586f, 0.771334171f},
-std::array<float,2>{0.0841443762f, 0.199941918f},
-std::array<float,2>{0.62310344f, 0.636384428f},
-std::array<float,2>{0.662840605f, 0.0180782247f},
-std::array<float,2>{0.135293022f, 0.570467174f},
-std::array<float,2>{0.423707187f, 0.490872681f},
-std::array<float,2>{0.811549723f, 0.894815266f},
-std::array<float,2>{0.856951177f, 0.166336328f},
-std::array<float,2>{0.452214986f, 0.727171004f},
-std::array<float,2>{0.190973118f, 0.324380577f},
-std::array<float,2>{0.701036394f, 0.853316307f},
-std::array<float,2>{0.529131174f, 0.406588048f},
-std::array<float,2>{0.0182405524f, 0.967252254f},
-std::array<float,2>{0.335493386f, 0.116131291f},
-std::array<float,2>{0.889315486f, 0.535013616f},
-std::array<float,2>{0.879877567f, 0.482361078f},
-std::array<float,2>{0.337274611f, 0.877366424f},
-std::array<float,2>{0.0263018031f, 0.014379493f},
-std::array<float,2>{0.520842075f, 0.587970972f},
-std::array<float,2>{0.691679239f, 0.217052862f},
-std::array<float,2>{0.201294616f, 0.648888052f},
-std::array<float,2>{0.438854605f, 0.290579736f},
-std::array<float,2>{0.849450409f, 0.765513659f},
-std::array<float,2>{0.797906637f, 0.0995996445f},
-std::array<float,2>{0.432402045f, 0.561383963f},
-std::array<float,2>{0.12584886f, 0.432827264f},
-std::array<float,2>{0.665443361f, 0.947487414f},
-std::array<float,2>{0.614990413f, 0.328612387f},
-std::array<float,2>{0.0886120722f, 0.865071297f},
-std::array<float,2>{0.297684193f, 0.179466292f},
-std::array<float,2>{0.972901702f, 0.745089948f},
-std::array<float,2>{0.823910713f, 0.269635975f},
-std::array<float,2>{0.475437105f, 0.795955002f},
-std::array<float,2>{0.238803059f, 0.228440493f},
-std::array<float,2>{0.728855252f, 0.656584561f},
-std::array<float,2>{0.548173726f, 0.0586479083f},
-std::array<float,2>{0.0619978718f, 0.62098664f},
-std::array<float,2>{0.367472321f, 0.465525866f},
-std::array<float,2>{0.935332239f, 0.926579297f},
-std::array<float,2>{0.958197117f, 0.146110952f},
-std::array<float,2>{0.250041574f, 0.693016231f},
-std::array<float,2>{0.113103315f, 0.348976612f},
-std::array<float,2>{0.581597388f, 0.834657371f},
-std::array<float,2>{0.650945485f, 0.375038117f},
-std::array<float,2>{0.172698677f, 0.97511822f},
-std::array<float,2>{0.396718681f, 0.0868887305f},
-std::array<float,2>{0.780297101f, 0.522920549f},
-std::array<float,2>{0.760836065f, 0.413766563f},
-std::array<float,2>{0.379868656f, 0.961977303f},
-std::array<float,2>{0.165821284f, 0.109465785f},
-std::array<float,2>{0.629124701f, 0.537078798f},
-std::array<float,2>{0.564383447f, 0.168399245f},
-std::array<float,2>{0.106843174f, 0.731096983f},
-std::array<float,2>{0.269339263f, 0.321902722f},
-std::array<float,2>{0.941498399f, 0.858118117f},
-std::array<float,2>{0.91691643f, 0.0195857715f},
-std::array<float,2>{0.354800165f, 0.574264407f},
-std::array<float,2>{0.0459090024f, 0.487722427f},
-std::array<float,2>{0.538556814f, 0.893459976f},
-std::array<float,2>{0.739173174f, 0.304694921f},
-std::array<float,2>{0.232054859f, 0.768643022f},
-std::array<float,2>{0.499814361f, 0.197360963f},
-std::array<float,2>{0.840520859f, 0.64000684f},
-std::array<float,2>{0.985222757f, 0.366692811f},
-std::array<float,2>{0.290814638f, 0.81694144f},
-std::array<float,2>{0.0668458045f, 0.1313494f},
-std::array<float,2>{0.595858872f, 0.711297035f},
-std::array<float,2>{0.68042028f, 0.0771094933f},
-std::array<float,2>{0.154965311f, 0.504461884f},
-std::array<float,2>{0.408113033f, 0.400618136f},
-std::array<float,2>{0.788386405f, 0.991735041f},
-std::array<float,2>{0.865351021f, 0.235701844f},
-std::array<float,2>{0.463447899f, 0.677203298f},
-std::array<float,2>{0.216063946f, 0.259871513f},
-std::array<float,2>{0.714793682f, 0.801427722f},
-std::array<float,2>{0.500907183f, 0.448480368f},
-std::array<float,2>{0.0122379279f, 0.918262243f},
-std::array<float,2>{0.318255126f, 0.0440799929f},
-std::array<float,2>{0.897328854f, 0.59389925f},
-std::array<float,2>{0.950155616f, 0.397121102f},
-std::array<float,2>{0.27951625f, 0.992704391f},
-std::array<float,2>{0.0989826396f, 0.0689356327f},
-std::array<float,2>{0.574799001f, 0.512838602f},
-std::array<float,2>{0.639796197f, 0.138995841f},
-std::array<float,2>{0.163902938f, 0.709055543f},
-std::array<float,2>{0.387453586f, 0.370011687f},
-std::array<float,2>{0.75680697f, 0.82773298f},
-std::array<float,2>{0.832993388f, 0.0346645676f},
-std::array<float,2>{0.486796677f, 0.603585899f},
-std::array<float,2>{0.225013375f, 0.438434333f},
-std::array<float,2>{0.744370818f, 0.911601961f},
-std::array<float,2>{0.543058038f, 0.256998807f},
-std::array<float,2>{0.0330338851f, 0.807076812f},
-std::array<float,2>{0.350392759f, 0.248002306f},
-std::array<float,2>{0.909803748f, 0.681531131f},
-std::array<float,2>{0.796397448f, 0.315318137f},
-std::array<float,2>{0.416530281f, 0.847337723f},
-std::array<float,2>{0.146460056f, 0.163893014f},
-std::array<float,2>{0.678957641f, 0.726339459f},
-std::array<float,2>{0.604236126f, 0.121740565f},
-std::array<float,2>{0.0750056878f, 0.544034958f},
-std::array<float,2>{0.287174791f, 0.421028286f},
-std::array<float,2>{0.997200727f, 0.957316637f},
-std::array<float,2>{0.904035509f, 0.193399087f},
-std::array<float,2>{0.325584084f, 0.630383492f},
-std::array<float,2>{0.00693176361f, 0.2999852f},
-std::array<float,2>{0.508407414f, 0.776355028f},
-std::array<float,2>{0.708411038f, 0.498640269f},
-std::array<float,2>{0.204122931f, 0.901911378f},
-std::array<float,2>{0.45560655f, 0.0283063557f},
-std::array<float,2>{0.87257129f, 0.57017082f},
-std::array<float,2>{0.851672769f, 0.454525322f},
-std::array<float,2>{0.448407441f, 0.936221659f},
-std::array<float,2>{0.195312068f, 0.049430389f},
-std::array<float,2>{0.698283136f, 0.609669685f},
-std::array<float,2>{0.524719775f, 0.221124366f},
-std::array<float,2>{0.0210161544f, 0.668187618f},
-std::array<float,2>{0.331096143f, 0.279706925f},
-std::array<float,2>{0.884212077f, 0.784646869f},
-std::array<float,2>{0.984074473f, 0.0820566639f},
-std::array<float,2>{0.306301594f, 0.53103435f},
-std::array<float,2>{0.0807214901f, 0.385170221f},
-std::array<float,2>{0.620945752f, 0.981424153f},
-std::array<float,2>{0.659218967f, 0.354608357f},
-std::array<float,2>{0.138678119f, 0.838114321f},
-std::array<float,2>{0.427888215f, 0.149784938f},
-std::array<float,2>{0.80517453f, 0.69899112f},
-std::array<float,2>{0.928880215f, 0.286539793f},
-std::array<float,2>{0.362560153f, 0.752592444f},
-std::array<float,2>{0.0531734973f, 0.20709838f},
-std::array<float,2>{0.560542583f, 0.645304978f},
-std::array<float,2>{0.721246719f, 0.00251028198f},
-std::array<float,2>{0.245587781f, 0.584178269f},
-std::array<float,2>{0.480169445f, 0.475987256f},
-std::array<float,2>{0.813684702f, 0.885469556f},
-std::array<float,2>{0.767617583f, 0.181928083f},
-std::array<float,2>{0.402894408f, 0.739911735f},
-std::array<float,2>{0.183381513f, 0.34137693f},
-std::array<float,2>{0.645133674f, 0.874244034f},
-std::array<float,2>{0.593131542f, 0.429669142f},
-std::array<float,2>{0.117540315f, 0.939135015f},
-std::array<float,2>{0.258700579f, 0.105389908f},
-std::array<float,2>{0.966106296f, 0.547941804f},
-std::array<float,2>{0.972227156f, 0.445076346f},
-std::array<float,2>{0.303424835f, 0.906715393f},
-std::array<float,2>{0.09366633f, 0.0385843515f},
-std::array<float,2>{0.613155127f, 0.608859539f},
-std::array<float,2>{0.66980052f, 0.244526371f},
-std::array<float,2>{0.130225718f, 0.683821678f},
-std::array<float,2>{0.436341345f, 0.251913935f},
-std::array<float,2>{0.801745474f, 0.809642315f},
-std::array<float,2>{0.845280707f, 0.0628851354f},
-std::array<float,2>{0.444799304f, 0.50968194f},
-std::array<float,2>{0.197756052f, 0.394235015f},
-std::array<float,2>{0.689965665f, 0.996493518f},
-std::array<float,2>{0.518425822f, 0.371879309f},
-std::array<float,2>{0.0289078411f, 0.823908508f},
-std::array<float,2>{0.339963198f, 0.136700481f},
-std::array<float,2>{0.876304984f, 0.703842402f},
-std::array<float,2>{0.775370479f, 0.304151773f},
-std::array<float,2>{0.393336475f, 0.777746618f},
-std::array<float,2>{0.17650716f, 0.188088685f},
-std::array<float,2>{0.655194283f, 0.625257552f},
-std::array<float,2>{0.582388282f, 0.0263903011f},
-std::array<float,2>{0.113285288f, 0.566002965f},
-std::array<float,2>{0.256238401f, 0.492699355f},
-std::array<float,2>{0.957010746f, 0.902931333f},
-std::array<float,2>{0.930231214f, 0.158142388f},
-std::array<float,2>{0.373249352f, 0.719112992f},
-std::array<float,2>{0.0577050149f, 0.319064885f},
-std::array<float,2>{0.551243842f, 0.85144335f},
-std::array<float,2>{0.731417775f, 0.415237337f},
-std::array<float,2>{0.236120284f, 0.955043554f},
-std::array<float,2>{0.469666719f, 0.118732214f},
-std::array<float,2>{0.82461977f, 0.540906847f},
-std::array<float,2>{0.837336183f, 0.390304178f},
-std::array<float,2>{0.493865281f, 0.977678776f},
-std::array<float,2>{0.229315847f, 0.0796433613f},
-std::array<float,2>{0.73620975f, 0.526918113f},
-std::array<float,2>{0.533514023f, 0.155254439f},
-std::array<float,2>{0.041513253f, 0.701544583f},
-std::array<float,2>{0.359184295f, 0.359176904f},
-std::array<float,2>{0.920565009f, 0.841081202f},
-std::array<float,2>{0.941013455f, 0.0541675054f},
-std::array<float,2>{0.272483408f, 0.616764128f},
-std::array<float,2>{0.101968877f, 0.459999323f},
-std::array<float,2>{0.568210721f, 0.933400512f},
-std::array<float,2>{0.626175284f, 0.275645912f},
-std::array<float,2>{0.168728575f, 0.786239147f},
-std::array<float,2>{0.37859416f, 0.226256266f},
-std::array<float,2>{0.762913525f, 0.664783061f},
-std::array<float,2>{0.893892705f, 0.336986631f},
-std::array<float,2>{0.312920362f, 0.868706405f},
-std::array<float,2>{0.0101285614f, 0.187449694f},
-std::array<float,2>{0.505275607f, 0.738115549f},
-std::array<float,2>{0.718097866f, 0.108792394f},
-std::array<float,2>{0.214576796f, 0.550973594f},
-std::array<float,2>{0.46678856f, 0.422260076f},
-std::array<float,2>{0.859994233f, 0.941670537f},
-std::array<float,2>{0.78502059f, 0.205634713f},
-std::array<float,2>{0.41232273f, 0.640774548f},
-std::array<float,2>{0.149611503f, 0.282292634f},
-std::array<float,2>{0.686863065f, 0.757532179f},
-std::array<float,2>{0.599899769f, 0.472086906f},
-std::array<float,2>{0.0633121133f, 0.890583634f},
-std::array<float,2>{0.296774209f, 0.00407754211f},
-std::array<float,2>{0.988472223f, 0.581238866f},
-std::array<float,2>{0.913700342f, 0.435851872f},
-std::array<float,2>{0.346047938f, 0.951082885f},
-std::array<float,2>{0.0381556042f, 0.09665858f},
-std::array<float,2>{0.539512813f, 0.558246672f},
-std::array<float,2>{0.747484326f, 0.171935946f},
-std::array<float,2>{0.221443102f, 0.749016166f},
-std::array<float,2>{0.488669395f, 0.33492434f},
-std::array<float,2>{0.83111769f, 0.859773993f},
-std::array<float,2>{0.753699481f, 0.00987064559f},
-std::array<float,2>{0.384102136f, 0.591676235f},
-std::array<float,2>{0.159447268f, 0.477230102f},
-std::array<float,2>{0.635951221f, 0.880223691f},
-std::array<float,2>{0.570924759f, 0.293848485f},
-std::array<float,2>{0.09404926f, 0.75971657f},
-std::array<float,2>{0.273601443f, 0.213161141f},
-std::array<float,2>{0.947320998f, 0.652623117f},
-std::array<float,2>{0.869523406f, 0.346501291f},
-std::array<float,2>{0.460781395f, 0.830118775f},
-std::array<float,2>{0.210466683f, 0.141298711f},
-std::array<float,2>{0.706291497f, 0.690058351f},
-std::array<float,2>{0.51467818f, 0.0904498622f},
-std::array<float,2>{0.00233369833f, 0.5178442f},
-std::array<float,2>{0.322405756f, 0.382007003f},
-std::array<float,2>{0.899740219f, 0.968960822f},
-std::array<float,2>{0.99362427f, 0.233743325f},
-std::array<float,2>{0.284148186f, 0.660523117f},
-std::array<float,2>{0.0716868341f, 0.265909135f},
-std::array<float,2>{0.608285189f, 0.790788352f},
-std::array<float,2>{0.671901464f, 0.461566418f},
-std::array<float,2>{0.143130764f, 0.923119485f},
-std::array<float,2>{0.421722531f, 0.0577991456f},
-std::array<float,2>{0.78983885f, 0.622625649f},
-std::array<float,2>{0.810361981f, 0.489758134f},
-std::array<float,2>{0.425504744f, 0.89705044f},
-std::array<float,2>{0.133833781f, 0.0158996284f},
-std::array<float,2>{0.661566317f, 0.573782146f},
-std::array<float,2>{0.622624218f, 0.201554447f},
-std::array<float,2>{0.0831073672f, 0.632915378f},
-std::array<float,2>{0.308973342f, 0.309701025f},
-std::array<float,2>{0.978268921f, 0.772398055f},
-std::array<float,2>{0.887786448f, 0.113924749f},
-std::array<float,2>{0.332899809f, 0.532108307f},
-std::array<float,2>{0.0160507783f, 0.40986979f},
-std::array<float,2>{0.530003905f, 0.966421604f},
-std::array<float,2>{0.701639593f, 0.326731354f},
-std::array<float,2>{0.18841897f, 0.854309738f},
-std::array<float,2>{0.450968206f, 0.164994255f},
-std::array<float,2>{0.857900143f, 0.730080903f},
-std::array<float,2>{0.962520242f, 0.264255524f},
-std::array<float,2>{0.264763147f, 0.800574243f},
-std::array<float,2>{0.122701854f, 0.238601089f},
-std::array<float,2>{0.587330043f, 0.674093127f},
-std::array<float,2>{0.642963529f, 0.0406045131f},
-std::array<float,2>{0.184541583f, 0.601175308f},
-std::array<float,2>{0.39881438f, 0.453011215f},
-std::array<float,2>{0.769726276f, 0.917684078f},
-std::array<float,2>{0.818608224f, 0.128459468f},
-std::array<float,2>{0.481020987f, 0.718489468f},
-std::array<float,2>{0.249212936f, 0.361497015f},
-std::array<float,2>{0.723907709f, 0.812777936f},
-std::array<float,2>{0.556013882f, 0.403433472f},
-std::array<float,2>{0.0503946841f, 0.986633062f},
-std::array<float,2>{0.365645587f, 0.0716003478f},
-std::array<float,2>{0.922762215f, 0.500637233f},
-std::array<float,2>{0.898604453f, 0.464655489f},
-std::array<float,2>{0.323289573f, 0.92503953f},
-std::array<float,2>{0.00332026603f, 0.0551691875f},
-std::array<float,2>{0.514433622f, 0.624201834f},
-std::array<float,2>{0.705358505f, 0.230836391f},
-std::array<float,2>{0.209341571f, 0.663924873f},
-std::array<float,2>{0.459691465f, 0.26904422f},
-std::array<float,2>{0.87025106f, 0.792016983f},
-std::array<float,2>{0.790247142f, 0.0918691009f},
-std::array<float,2>{0.420847535f, 0.516845286f},
-std::array<float,2>{0.144496292f, 0.380240142f},
-std::array<float,2>{0.673578322f, 0.970791698f},
-std::array<float,2>{0.608400941f, 0.344217181f},
-std::array<float,2>{0.0708086416f, 0.82924366f},
-std::array<float,2>{0.284316808f, 0.143922463f},
-std::array<float,2>{0.992867827f, 0.689171493f},
-std::array<float,2>{0.830935001f, 0.29510951f},
-std::array<float,2>{0.489513397f, 0.761499047f},
-std::array<float,2>{0.222538963f, 0.212633342f},
-std::array<float,2>{0.747064173f, 0.656004727f},
-std::array<float,2>{0.540426791f, 0.00842433795f},
-std::array<float,2>{0.0374867767f, 0.592570841f},
-std::array<float,2>{0.346931845f, 0.478549272f},
-std::array<float,2>{0.912271321f, 0.882001281f},
-std::array<float,2>{0.948710024f, 0.174090907f},
-std::array<float,2>{0.275376707f, 0.747205317f},
-std::array<float,2>{0.0954399481f, 0.33357203f},
-std::array<float,2>{0.571805298f, 0.861963272f},
-std::array<float,2>{0.635682344f, 0.434857905f},
-std::array<float,2>{0.158582062f, 0.952786446f},
-std::array<float,2>{0.383254498f, 0.095259048f},
-std::array<float,2>{0.752102554f, 0.556240857f},
-std::array<float,2>{0.771269441f, 0.404340237f},
-std::array<float,2>{0.400102705f, 0.986140132f},
-std::array<float,2>{0.185291514f, 0.0737620741f},
-std::array<float,2>{0.644370377f, 0.502049208f},
-std::array<float,2>{0.586412966f, 0.126816064f},
-std::array<float,2>{0.121381879f, 0.716722131f},
-std::array<float,2>{0.263836801f, 0.359479845f},
-std::array<float,2>{0.960967243f, 0.814721286f},
-std::array<float,2>{0.9233284f, 0.0427827947f},
-std::array<float,2>{0.366649657f, 0.598745346f},
-std::array<float,2>{0.0489161611f, 0.449856043f},
-std::array<float,2>{0.555063426f, 0.914553344f},
-std::array<float,2>{0.722960413f, 0.262793988f},
-std::array<float,2>{0.248843983f, 0.797977865f},
-std::array<float,2>{0.482250035f, 0.241685554f},
-std::array<float,2>{0.819376349f, 0.672961533f},
-std::array<float,2>{0.977269351f, 0.324698716f},
-std::array<float,2>{0.309645146f, 0.853120983f},
-std::array<float,2>{0.0826762244f, 0.16616863f},
-std::array<float,2>{0.62113452f, 0.727419913f},
-std::array<float,2>{0.660313427f, 0.11590001f},
-std::array<float,2>{0.133633658f, 0.534707785f},
-std::array<float,2>{0.424681306f, 0.406300157f},
-std::array<float,2>{0.808928728f, 0.966984212f},
-std::array<float,2>{0.858899176f, 0.200184047f},
-std::array<float,2>{0.449671715f, 0.636483908f},
-std::array<float,2>{0.188708559f, 0.311156541f},
-std::array<float,2>{0.702838957f, 0.771223545f},
-std::array<float,2>{0.530426741f, 0.491203576f},
-std::array<float,2>{0.0169833135f, 0.894604445f},
-std::array<float,2>{0.333721459f, 0.0184770003f},
-std::array<float,2>{0.887286305f, 0.570610821f},
-std::array<float,2>{0.955559969f, 0.417158216f},
-std::array<float,2>{0.256931514f, 0.956735313f},
-std::array<float,2>{0.114513345f, 0.119759768f},
-std::array<float,2>{0.583831429f, 0.541086972f},
-std::array<float,2>{0.656058609f, 0.159996241f},
-std::array<float,2>{0.177504376f, 0.721407294f},
-std::array<float,2>{0.393711001f, 0.317002892f},
-std::array<float,2>{0.773821354f, 0.848792672f},
-std::array<float,2>{0.825620949f, 0.0244937073f},
-std::array<float,2>{0.469772339f, 0.562888145f},
-std::array<float,2>{0.235046253f, 0.495679438f},
-std::array<float,2>{0.731680751f, 0.905606091f},
-std::array<float,2>{0.551930428f, 0.301917315f},
-std::array<float,2>{0.0571404845f, 0.780977011f},
-std::array<float,2>{0.374559313f, 0.190100566f},
-std::array<float,2>{0.931030154f, 0.627222776f},
-std::array<float,2>{0.802623034f, 0.374684185f},
-std::array<float,2>{0.436784774f, 0.821206689f},
-std::array<float,2>{0.129144534f, 0.133035719f},
-std::array<float,2>{0.668372929f, 0.705514193f},
-std::array<float,2>{0.611432135f, 0.065126434f},
-std::array<float,2>{0.0926663056f, 0.511261165f},
-std::array<float,2>{0.304023325f, 0.391619623f},
-std::array<float,2>{0.970723569f, 0.999958038f},
-std::array<float,2>{0.875880957f, 0.244088113f},
-std::array<float,2>{0.340951443f, 0.68644309f},
-std::array<float,2>{0.027945349f, 0.253658146f},
-std::array<float,2>{0.518719614f, 0.811974466f},
-std::array<float,2>{0.691384435f, 0.441949725f},
-std::array<float,2>{0.198737711f, 0.908958912f},
-std::array<float,2>{0.444191724f, 0.0358327515f},
-std::array<float,2>{0.843994677f, 0.606839716f},
-std::array<float,2>{0.860756695f, 0.469291627f},
-std::array<float,2>{0.465581745f, 0.887825251f},
-std::array<float,2>{0.213820055f, 0.00728772208f},
-std::array<float,2>{0.717569649f, 0.579660118f},
-std::array<float,2>{0.504253864f, 0.204896033f},
-std::array<float,2>{0.0116478512f, 0.643975019f},
-std::array<float,2>{0.31399861f, 0.283203781f},
-std::array<float,2>{0.893514395f, 0.754125416f},
-std::array<float,2>{0.989839137f, 0.105494671f},
-std::array<float,2>{0.29561606f, 0.553910315f},
-std::array<float,2>{0.0640838817f, 0.424555063f},
-std::array<float,2>{0.601324856f, 0.944077313f},
-std::array<float,2>{0.685688496f, 0.33959952f},
-std::array<float,2>{0.14856115f, 0.870270371f},
-std::array<float,2>{0.413903892f, 0.183821321f},
-std::array<float,2>{0.784038901f, 0.735619187f},
-std::array<float,2>{0.921511114f, 0.273778796f},
-std::array<float,2>{0.358007342f, 0.787705719f},
-std::array<float,2>{0.0429205485f, 0.223855376f},
-std::array<float,2>{0.534239054f, 0.667565823f},
-std::array<float,2>{0.734523177f, 0.051027067f},
-std::array<float,2>{0.230167255f, 0.614628255f},
-std::array<float,2>{0.492258251f, 0.458843052f},
-std::array<float,2>{0.836638629f, 0.931003809f},
-std::array<float,2>{0.762335002f, 0.15344581f},
-std::array<float,2>{0.37703529f, 0.700413764f},
-std::array<float,2>{0.169802889f, 0.356744617f},
-std::array<float,2>{0.625499725f, 0.842918873f},
-std::array<float,2>{0.566792071f, 0.387449652f},
-std::array<float,2>{0.102564991f, 0.9790591f},
-std::array<float,2>{0.272380233f, 0.0802107155f},
-std::array<float,2>{0.93977052f, 0.524255931f},
-std::array<float,2>{0.996798277f, 0.497827739f},
-std::array<float,2>{0.288507342f, 0.898548126f},
-std::array<float,2>{0.0758492574f, 0.0304104257f},
-std::array<float,2>{0.605447292f, 0.567378998f},
-std::array<float,2>{0.678573966f, 0.193215311f},
-std::array<float,2>{0.144550592f, 0.631864905f},
-std::array<float,2>{0.417083174f, 0.298135698f},
-std::array<float,2>{0.79568696f, 0.775124609f},
-std::array<float,2>{0.871365726f, 0.123286046f},
-std::array<float,2>{0.456572562f, 0.545338273f},
-std::array<float,2>{0.203296274f, 0.418792725f},
-std::array<float,2>{0.707192361f, 0.959634244f},
-std::array<float,2>{0.50943172f, 0.313730896f},
-std::array<float,2>{0.00639308942f, 0.843884051f},
-std::array<float,2>{0.325100273f, 0.162041247f},
-std::array<float,2>{0.903169274f, 0.722835839f},
-std::array<float,2>{0.757497847f, 0.254652202f},
-std::array<float,2>{0.387989253f, 0.806339979f},
-std::array<float,2>{0.162498266f, 0.24973999f},
-std::array<float,2>{0.639377654f, 0.681972802f},
-std::array<float,2>{0.575704336f, 0.032049913f},
-std::array<float,2>{0.0981980041f, 0.60195905f},
-std::array<float,2>{0.28031531f, 0.440102786f},
-std::array<float,2>{0.950279415f, 0.913343251f},
-std::array<float,2>{0.909093559f, 0.138059169f},
-std::array<float,2>{0.351111084f, 0.707976878f},
-std::array<float,2>{0.0317910984f, 0.368704706f},
-std::array<float,2>{0.544065595f, 0.824324071f},
-std::array<float,2>{0.745486915f, 0.396190524f},
-std::array<float,2>{0.226446003f, 0.995017767f},
-std::array<float,2>{0.487499028f, 0.0670092776f},
-std::array<float,2>{0.833653986f, 0.514903724f},
-std::array<float,2>{0.812648058f, 0.427571893f},
-std::array<float,2>{0.478574246f, 0.939630687f},
-std::array<float,2>{0.244317412f, 0.10314852f},
-std::array<float,2>{0.721979856f, 0.54976052f},
-std::array<float,2>{0.558845103f, 0.180598393f},
-std::array<float,2>{0.054520499f, 0.74058789f},
-std::array<float,2>{0.361395359f, 0.343401968f},
-std::array<float,2>{0.928506911f, 0.871553421f},
-std::array<float,2>{0.965402901f, 0.00117161544f},
-std::array<float,2>{0.258953035f, 0.583889544f},
-std::array<float,2>{0.11871969f, 0.47317034f},
-std::array<float,2>{0.592638195f, 0.884622753f},
-std::array<float,2>{0.645762265f, 0.287558049f},
-std::array<float,2>{0.181659132f, 0.750949502f},
-std::array<float,2>{0.403691202f, 0.210535914f},
-std::array<float,2>{0.769234955f, 0.647404492f},
-std::array<float,2>{0.88370502f, 0.353092462f},
-std::array<float,2>{0.330491185f, 0.837040365f},
-std::array<float,2>{0.0205068197f, 0.150913954f},
-std::array<float,2>{0.523947835f, 0.696320117f},
-std::array<float,2>{0.697775424f, 0.0844135284f},
-std::array<float,2>{0.194223911f, 0.527883053f},
-std::array<float,2>{0.447375655f, 0.38397637f},
-std::array<float,2>{0.853384733f, 0.983146727f},
-std::array<float,2>{0.806319892f, 0.2191903f},
-std::array<float,2>{0.429589868f, 0.67099309f},
-std::array<float,2>{0.140356973f, 0.278372347f},
-std::array<float,2>{0.658690393f, 0.782928288f},
-std::array<float,2>{0.620012879f, 0.456785589f},
-std::array<float,2>{0.0812686309f, 0.93401432f},
-std::array<float,2>{0.304812312f, 0.0471585244f},
-std::array<float,2>{0.982995331f, 0.612894714f},
-std::array<float,2>{0.934144676f, 0.378032625f},
-std::array<float,2>{0.368906081f, 0.973642647f},
-std::array<float,2>{0.0612610579f, 0.0887747705f},
-std::array<float,2>{0.547836483f, 0.520394981f},
-std::array<float,2>{0.729793549f, 0.146555275f},
-std::array<float,2>{0.23952046f, 0.694802403f},
-std::array<float,2>{0.476481199f, 0.350988567f},
-std::array<float,2>{0.822912335f, 0.83367312f},
-std::array<float,2>{0.779565752f, 0.0620163493f},
-std::array<float,2>{0.39830327f, 0.61866051f},
-std::array<float,2>{0.173467785f, 0.466822237f},
-std::array<float,2>{0.652181029f, 0.929564118f},
-std::array<float,2>{0.580353141f, 0.272325963f},
-std::array<float,2>{0.111678161f, 0.793068826f},
-std::array<float,2>{0.251719922f, 0.229314059f},
-std::array<float,2>{0.957933545f, 0.658282757f},
-std::array<float,2>{0.848504364f, 0.331786633f},
-std::array<float,2>{0.437704355f, 0.86585772f},
-std::array<float,2>{0.202630028f, 0.176731288f},
-std::array<float,2>{0.69260782f, 0.743647873f},
-std::array<float,2>{0.520452321f, 0.0998827964f},
-std::array<float,2>{0.0270903669f, 0.559656143f},
-std::array<float,2>{0.336076707f, 0.429888219f},
-std::array<float,2>{0.880076706f, 0.947228968f},
-std::array<float,2>{0.974028051f, 0.215427205f},
-std::array<float,2>{0.298208028f, 0.651607215f},
-std::array<float,2>{0.0895824209f, 0.292177856f},
-std::array<float,2>{0.613819301f, 0.762586772f},
-std::array<float,2>{0.664560795f, 0.483041137f},
-std::array<float,2>{0.126830295f, 0.875102758f},
-std::array<float,2>{0.43329075f, 0.013253781f},
-std::array<float,2>{0.79754132f, 0.587295413f},
-std::array<float,2>{0.787951231f, 0.446252733f},
-std::array<float,2>{0.407162875f, 0.921649873f},
-std::array<float,2>{0.15612869f, 0.046117872f},
-std::array<float,2>{0.680753887f, 0.596335173f},
-std::array<float,2>{0.597316265f, 0.236482248f},
-std::array<float,2>{0.068159312f, 0.678822696f},
-std::array<float,2>{0.289299726f, 0.259571999f},
-std::array<float,2>{0.985621214f, 0.802911699f},
-std::array<float,2>{0.897791803f, 0.0757423788f},
-std::array<float,2>{0.316826373f, 0.506955624f},
-std::array<float,2>{0.0128203528f, 0.399018407f},
-std::array<float,2>{0.501376331f, 0.988309801f},
-std::array<float,2>{0.713315904f, 0.364798069f},
-std::array<float,2>{0.215554669f, 0.819022954f},
-std::array<float,2>{0.46477133f, 0.13076219f},
-std::array<float,2>{0.867170513f, 0.713187754f},
-std::array<float,2>{0.94286257f, 0.307348788f},
-std::array<float,2>{0.26777029f, 0.766389012f},
-std::array<float,2>{0.105543748f, 0.197023422f},
-std::array<float,2>{0.562872231f, 0.637858212f},
-std::array<float,2>{0.63080132f, 0.022616528f},
-std::array<float,2>{0.164704651f, 0.577921689f},
-std::array<float,2>{0.380089104f, 0.484899908f},
-std::array<float,2>{0.760623455f, 0.891128778f},
-std::array<float,2>{0.841125071f, 0.170012325f},
-std::array<float,2>{0.498976111f, 0.733142734f},
-std::array<float,2>{0.230665475f, 0.323913634f},
-std::array<float,2>{0.740135789f, 0.857010126f},
-std::array<float,2>{0.537695944f, 0.411890596f},
-std::array<float,2>{0.0454809368f, 0.964052856f},
-std::array<float,2>{0.354295284f, 0.11184781f},
-std::array<float,2>{0.91759479f, 0.537158132f},
-std::array<float,2>{0.911753595f, 0.477451503f},
-std::array<float,2>{0.34559834f, 0.879903078f},
-std::array<float,2>{0.0354064368f, 0.0101924231f},
-std::array<float,2>{0.542948186f, 0.591429949f},
-std::array<float,2>{0.748350501f, 0.213069811f},
-std::array<float,2>{0.219759256f, 0.652402699f},
-std::array<float,2>{0.491307259f, 0.293503791f},
-std::array<float,2>{0.828491628f, 0.75944519f},
-std::array<float,2>{0.750248253f, 0.0963462517f},
-std::array<float,2>{0.385938764f, 0.558570743f},
-std::array<float,2>{0.157590821f, 0.435546994f},
-std::array<float,2>{0.634192646f, 0.950730741f},
-std::array<float,2>{0.573523402f, 0.334486365f},
-std::array<float,2>{0.0962857977f, 0.859523773f},
-std::array<float,2>{0.276631206f, 0.172318429f},
-std::array<float,2>{0.946881533f, 0.748758674f},
-std::array<float,2>{0.868085265f, 0.265740782f},
-std::array<float,2>{0.457227051f, 0.790652215f},
-std::array<float,2>{0.20765388f, 0.233622685f},
-std::array<float,2>{0.704199791f, 0.660378754f},
-std::array<float,2>{0.513188839f, 0.058025077f},
-std::array<float,2>{0.000732838875f, 0.622875452f},
-std::array<float,2>{0.321734399f, 0.461866558f},
-std::array<float,2>{0.902125776f, 0.923071444f},
-std::array<float,2>{0.995288074f, 0.141479194f},
-std::array<float,2>{0.281331033f, 0.690281689f},
-std::array<float,2>{0.0733660981f, 0.346419305f},
-std::array<float,2>{0.607413948f, 0.830352545f},
-std::array<float,2>{0.675604641f, 0.382118911f},
-std::array<float,2>{0.141949475f, 0.969076514f},
-std::array<float,2>{0.41937387f, 0.0906828493f},
-std::array<float,2>{0.792759299f, 0.517637968f},
-std::array<float,2>{0.810902417f, 0.410048753f},
-std::array<float,2>{0.422160149f, 0.966635466f},
-std::array<float,2>{0.136703774f, 0.114136808f},
-std::array<float,2>{0.663944066f, 0.531804383f},
-std::array<float,2>{0.62425071f, 0.164758876f},
-std::array<float,2>{0.0852816105f, 0.730395675f},
-std::array<float,2>{0.311793238f, 0.326935768f},
-std::array<float,2>{0.980179787f, 0.854082704f},
-std::array<float,2>{0.890327692f, 0.0158418659f},
-std::array<float,2>{0.334000826f, 0.574180365f},
-std::array<float,2>{0.019354457f, 0.490226179f},
-std::array<float,2>{0.528229177f, 0.897347152f},
-std::array<float,2>{0.699745059f, 0.309945226f},
-std::array<float,2>{0.190168321f, 0.771975577f},
-std::array<float,2>{0.451471567f, 0.201239973f},
-std::array<float,2>{0.856280327f, 0.633110583f},
-std::array<float,2>{0.964275301f, 0.361645788f},
-std::array<float,2>{0.26346153f, 0.812681556f},
-std::array<float,2>{0.123049952f, 0.128753126f},
-std::array<float,2>{0.587978125f, 0.718688548f},
-std::array<float,2>{0.641406953f, 0.0713451654f},
-std::array<float,2>{0.1855921f, 0.500750601f},
-std::array<float,2>{0.400646448f, 0.403665543f},
-std::array<float,2>{0.773253858f, 0.986563444f},
-std::array<float,2>{0.816748917f, 0.238294318f},
-std::array<float,2>{0.483679175f, 0.673989475f},
-std::array<float,2>{0.247987077f, 0.264542103f},
-std::array<float,2>{0.726484179f, 0.800447822f},
-std::array<float,2>{0.558522105f, 0.452727556f},
-std::array<float,2>{0.0482216068f, 0.917755961f},
-std::array<float,2>{0.363591194f, 0.0408562422f},
-std::array<float,2>{0.924323559f, 0.601541817f},
-std::array<float,2>{0.970240593f, 0.394438297f},
-std::array<float,2>{0.301345348f, 0.996217012f},
-std::array<float,2>{0.0904900655f, 0.0626914948f},
-std::array<float,2>{0.609497488f, 0.50941819f},
-std::array<float,2>{0.670431316f, 0.136382386f},
-std::array<float,2>{0.131483972f, 0.703988612f},
-std::array<float,2>{0.434806734f, 0.371688694f},
-std::array<float,2>{0.803691506f, 0.824086547f},
-std::array<float,2>{0.846365035f, 0.0389704518f},
-std::array<float,2>{0.442369848f, 0.608417928f},
-std::array<float,2>{0.195391402f, 0.444945037f},
-std::array<float,2>{0.689141393f, 0.906352997f},
-std::array<float,2>{0.516822338f, 0.251465589f},
-std::array<float,2>{0.029805081f, 0.810002327f},
-std::array<float,2>{0.342645735f, 0.244248852f},
-std::array<float,2>{0.878422439f, 0.684071302f},
-std::array<float,2>{0.775957048f, 0.319194913f},
-std::array<float,2>{0.391112745f, 0.851138771f},
-std::array<float,2>{0.179136232f, 0.157902077f},
-std::array<float,2>{0.653815508f, 0.718856156f},
-std::array<float,2>{0.585717142f, 0.11910256f},
-std::array<float,2>{0.116315447f, 0.540698707f},
-std::array<float,2>{0.255714476f, 0.415319741f},
-std::array<float,2>{0.953579307f, 0.954633355f},
-std::array<float,2>{0.933094561f, 0.188302591f},
-std::array<float,2>{0.371211141f, 0.625102222f},
-std::array<float,2>{0.0562385768f, 0.303869396f},
-std::array<float,2>{0.553218246f, 0.777546823f},
-std::array<float,2>{0.733484924f, 0.4929232f},
-std::array<float,2>{0.236837417f, 0.903302729f},
-std::array<float,2>{0.470982581f, 0.0266413987f},
-std::array<float,2>{0.827547312f, 0.566269159f},
-std::array<float,2>{0.839823782f, 0.460247338f},
-std::array<float,2>{0.495127112f, 0.933129013f},
-std::array<float,2>{0.227773502f, 0.0537142456f},
-std::array<float,2>{0.73678273f, 0.617087185f},
-std::array<float,2>{0.532244027f, 0.226467684f},
-std::array<float,2>{0.0393537618f, 0.664841533f},
-std::array<float,2>{0.356361747f, 0.275393754f},
-std::array<float,2>{0.919567227f, 0.786536217f},
-std::array<float,2>{0.938918412f, 0.0799506903f},
-std::array<float,2>{0.270399809f, 0.527178526f},
-std::array<float,2>{0.104237452f, 0.39054054f},
-std::array<float,2>{0.569236279f, 0.977836132f},
-std::array<float,2>{0.62849021f, 0.358936042f},
-std::array<float,2>{0.170039102f, 0.8409307f},
-std::array<float,2>{0.376109213f, 0.154962584f},
-std::array<float,2>{0.764674187f, 0.701403022f},
-std::array<float,2>{0.891764462f, 0.282572746f},
-std::array<float,2>{0.314794421f, 0.757735968f},
-std::array<float,2>{0.00825490523f, 0.205985308f},
-std::array<float,2>{0.506213307f, 0.640952826f},
-std::array<float,2>{0.715260744f, 0.00417935429f},
-std::array<float,2>{0.212001204f, 0.581428766f},
-std::array<float,2>{0.467518151f, 0.471898466f},
-std::array<float,2>{0.861386299f, 0.89027983f},
-std::array<float,2>{0.783158064f, 0.187084138f},
-std::array<float,2>{0.410239786f, 0.737905145f},
-std::array<float,2>{0.150651574f, 0.337219596f},
-std::array<float,2>{0.684449732f, 0.86894536f},
-std::array<float,2>{0.598396003f, 0.421976805f},
-std::array<float,2>{0.0649758875f, 0.941641331f},
-std::array<float,2>{0.293433964f, 0.108587258f},
-std::array<float,2>{0.990958571f, 0.551182985f},
-std::array<float,2>{0.952357292f, 0.438046604f},
-std::array<float,2>{0.278693408f, 0.911345184f},
-std::array<float,2>{0.101367131f, 0.0343628675f},
-std::array<float,2>{0.576607764f, 0.603868365f},
-std::array<float,2>{0.638504982f, 0.247681037f},
-std::array<float,2>{0.161861584f, 0.681388676f},
-std::array<float,2>{0.390594453f, 0.257097453f},
-std::array<float,2>{0.753956556f, 0.806705773f},
-std::array<float,2>{0.835606217f, 0.0691567287f},
-std::array<float,2>{0.485407531f, 0.5131194f},
-std::array<float,2>{0.223637238f, 0.397316605f},
-std::array<float,2>{0.743490219f, 0.992942572f},
-std::array<float,2>{0.545066833f, 0.369818687f},
-std::array<float,2>{0.0338255279f, 0.82789278f},
-std::array<float,2>{0.347776026f, 0.138707995f},
-std::array<float,2>{0.907775939f, 0.709253013f},
-std::array<float,2>{0.794442654f, 0.300054073f},
-std::array<float,2>{0.41514203f, 0.775912702f},
-std::array<float,2>{0.148138344f, 0.193703219f},
-std::array<float,2>{0.67685461f, 0.630803466f},
-std::array<float,2>{0.602661192f, 0.028044451f},
-std::array<float,2>{0.0780295432f, 0.56983614f},
-std::array<float,2>{0.285416245f, 0.49881196f},
-std::array<float,2>{0.99906683f, 0.902309537f},
-std::array<float,2>{0.906149268f, 0.163593858f},
-std::array<float,2>{0.327836931f, 0.726094484f},
-std::array<float,2>{0.00462579075f, 0.315176755f},
-std::array<float,2>{0.509997308f, 0.847569227f},
-std::array<float,2>{0.709312856f, 0.421322197f},
-std::array<float,2>{0.205692276f, 0.957048357f},
-std::array<float,2>{0.454645246f, 0.12197502f},
-std::array<float,2>{0.873546779f, 0.544210196f},
-std::array<float,2>{0.854173779f, 0.384942085f},
-std::array<float,2>{0.446617186f, 0.98114419f},
-std::array<float,2>{0.191738859f, 0.0824504048f},
-std::array<float,2>{0.696537554f, 0.53093493f},
-std::array<float,2>{0.526897132f, 0.149449438f},
-std::array<float,2>{0.0234134141f, 0.698784113f},
-std::array<float,2>{0.328754902f, 0.354764581f},
-std::array<float,2>{0.885262549f, 0.838263273f},
-std::array<float,2>{0.981529295f, 0.0495994315f},
-std::array<float,2>{0.308511019f, 0.609606385f},
-std::array<float,2>{0.0784200504f, 0.454266846f},
-std::array<float,2>{0.618926525f, 0.9362818f},
-std::array<float,2>{0.656736732f, 0.279425085f},
-std::array<float,2>{0.137829915f, 0.784365833f},
-std::array<float,2>{0.426354676f, 0.22076349f},
-std::array<float,2>{0.808240056f, 0.668408394f},
-std::array<float,2>{0.925978601f, 0.341653377f},
-std::array<float,2>{0.359996617f, 0.874387443f},
-std::array<float,2>{0.0508248731f, 0.181652069f},
-std::array<float,2>{0.562323332f, 0.740053415f},
-std::array<float,2>{0.719765127f, 0.105093136f},
-std::array<float,2>{0.24296926f, 0.548132718f},
-std::array<float,2>{0.478393823f, 0.429414183f},
-std::array<float,2>{0.815682828f, 0.939345002f},
-std::array<float,2>{0.767265141f, 0.207450613f},
-std::array<float,2>{0.404476762f, 0.645183027f},
-std::array<float,2>{0.179766595f, 0.286311895f},
-std::array<float,2>{0.647951305f, 0.752744317f},
-std::array<float,2>{0.590052783f, 0.475700021f},
-std::array<float,2>{0.1207873f, 0.885731697f},
-std::array<float,2>{0.26146099f, 0.00274945516f},
-std::array<float,2>{0.967870116f, 0.584433913f},
-std::array<float,2>{0.882362783f, 0.433070511f},
-std::array<float,2>{0.338175744f, 0.947599828f},
-std::array<float,2>{0.0239591207f, 0.0992494002f},
-std::array<float,2>{0.522160709f, 0.561100721f},
-std::array<float,2>{0.694223642f, 0.179442897f},
-std::array<float,2>{0.199225172f, 0.744764149f},
-std::array<float,2>{0.439595848f, 0.328182459f},
-std::array<float,2>{0.850350678f, 0.86481154f},
-std::array<float,2>{0.798883021f, 0.014571513f},
-std::array<float,2>{0.429934919f, 0.588364184f},
-std::array<float,2>{0.127879515f, 0.482008666f},
-std::array<float,2>{0.666826725f, 0.877091289f},
-std::array<float,2>{0.616364062f, 0.290981889f},
-std::array<float,2>{0.0861179903f, 0.765184879f},
-std::array<float,2>{0.298904449f, 0.21694015f},
-std::array<float,2>{0.974789619f, 0.648589611f},
-std::array<float,2>{0.821654439f, 0.348734319f},
-std::array<float,2>{0.473136216f, 0.834846377f},
-std::array<float,2>{0.240493685f, 0.146274671f},
-std::array<float,2>{0.727329314f, 0.693191409f},
-std::array<float,2>{0.550021946f, 0.0864845291f},
-std::array<float,2>{0.0601531342f, 0.522680223f},
-std::array<float,2>{0.369346559f, 0.375364363f},
-std::array<float,2>{0.935658991f, 0.975584149f},
-std::array<float,2>{0.960227847f, 0.22806178f},
-std::array<float,2>{0.253094077f, 0.656344116f},
-std::array<float,2>{0.109992623f, 0.2698358f},
-std::array<float,2>{0.579408586f, 0.796169639f},
-std::array<float,2>{0.649665952f, 0.46570316f},
-std::array<float,2>{0.174469203f, 0.926501036f},
-std::array<float,2>{0.394746661f, 0.0588883087f},
-std::array<float,2>{0.778590441f, 0.620641351f},
-std::array<float,2>{0.75834924f, 0.487414896f},
-std::array<float,2>{0.380902648f, 0.893265128f},
-std::array<float,2>{0.166618511f, 0.0199152194f},
-std::array<float,2>{0.632163346f, 0.574679732f},
-std::array<float,2>{0.564492583f, 0.197521344f},
-std::array<float,2>{0.108417369f, 0.639688909f},
-std::array<float,2>{0.266112685f, 0.304968923f},
-std::array<float,2>{0.943933606f, 0.768889308f},
-std::array<float,2>{0.915245831f, 0.10980574f},
-std::array<float,2>{0.352901489f, 0.53682822f},
-std::array<float,2>{0.0448531322f, 0.413916439f},
-std::array<float,2>{0.536598921f, 0.962343276f},
-std::array<float,2>{0.740578294f, 0.322057992f},
-std::array<float,2>{0.234156296f, 0.858391702f},
-std::array<float,2>{0.498016775f, 0.167999685f},
-std::array<float,2>{0.843145549f, 0.731209338f},
-std::array<float,2>{0.98755008f, 0.260119617f},
-std::array<float,2>{0.291311383f, 0.801714838f},
-std::array<float,2>{0.0701853558f, 0.235377684f},
-std::array<float,2>{0.594261825f, 0.676814735f},
-std::array<float,2>{0.683292389f, 0.0442168228f},
-std::array<float,2>{0.154211059f, 0.594126523f},
-std::array<float,2>{0.40831992f, 0.448730081f},
-std::array<float,2>{0.785156786f, 0.918150425f},
-std::array<float,2>{0.864970922f, 0.131596684f},
-std::array<float,2>{0.461272359f, 0.7109586f},
-std::array<float,2>{0.217073292f, 0.366215885f},
-std::array<float,2>{0.712695062f, 0.817368031f},
-std::array<float,2>{0.503897607f, 0.400708258f},
-std::array<float,2>{0.0143779451f, 0.992115855f},
-std::array<float,2>{0.320065081f, 0.0768545046f},
-std::array<float,2>{0.894634545f, 0.504688323f},
-std::array<float,2>{0.924921215f, 0.450942367f},
-std::array<float,2>{0.365013987f, 0.915975809f},
-std::array<float,2>{0.0476331674f, 0.0410929956f},
-std::array<float,2>{0.557547867f, 0.597678185f},
-std::array<float,2>{0.725135982f, 0.240926847f},
-std::array<float,2>{0.246568352f, 0.672722995f},
-std::array<float,2>{0.482562423f, 0.262134463f},
-std::array<float,2>{0.818128705f, 0.797332704f},
-std::array<float,2>{0.771524549f, 0.0723871589f},
-std::array<float,2>{0.401554793f, 0.503684938f},
-std::array<float,2>{0.18709527f, 0.405855805f},
-std::array<float,2>{0.641613841f, 0.98521924f},
-std::array<float,2>{0.589701653f, 0.360758573f},
-std::array<float,2>{0.124498822f, 0.816051424f},
-std::array<float,2>{0.26226458f, 0.125252008f},
-std::array<float,2>{0.963521183f, 0.715652645f},
-std::array<float,2>{0.856689632f, 0.312101007f},
-std::array<float,2>{0.453020453f, 0.76978159f},
-std::array<float,2>{0.19078958f, 0.201064125f},
-std::array<float,2>{0.700468123f, 0.635475218f},
-std::array<float,2>{0.528430343f, 0.0193568692f},
-std::array<float,2>{0.0178866349f, 0.572246969f},
-std::array<float,2>{0.335102409f, 0.49136883f},
-std::array<float,2>{0.888737857f, 0.895861506f},
-std::array<float,2>{0.978821933f, 0.16779837f},
-std::array<float,2>{0.310839593f, 0.728209555f},
-std::array<float,2>{0.0848063007f, 0.325811982f},
-std::array<float,2>{0.623811364f, 0.851935744f},
-std::array<float,2>{0.662212193f, 0.408129036f},
-std::array<float,2>{0.134926572f, 0.968158305f},
-std::array<float,2>{0.423329204f, 0.116686478f},
-std::array<float,2>{0.812476039f, 0.533589602f},
-std::array<float,2>{0.791149914f, 0.379348546f},
-std::array<float,2>{0.418571711f, 0.972000539f},
-std::array<float,2>{0.141043305f, 0.0935001299f},
-std::array<float,2>{0.674800873f, 0.516333401f},
-std::array<float,2>{0.6059165f, 0.143175423f},
-std::array<float,2>{0.0730620995f, 0.687513947f},
-std::array<float,2>{0.282429725f, 0.34558934f},
-std::array<float,2>{0.994973063f, 0.828277588f},
-std::array<float,2>{0.900841832f, 0.0564079545f},
-std::array<float,2>{0.320659161f, 0.623874128f},
-std::array<float,2>{0.00176615361f, 0.463629246f},
-std::array<float,2>{0.512023509f, 0.924437881f},
-std::array<float,2>{0.70316577f, 0.267589509f},
-std::array<float,2>{0.208745927f, 0.79188627f},
-std::array<float,2>{0.458515555f, 0.232269078f},
-std::array<float,2>{0.868629813f, 0.662872553f},
-std::array<float,2>{0.945902586f, 0.332871407f},
-std::array<float,2>{0.275427461f, 0.862540126f},
-std::array<float,2>{0.0974605307f, 0.175255641f},
-std::array<float,2>{0.573210418f, 0.746254504f},
-std::array<float,2>{0.632896423f, 0.0937564969f},
-std::array<float,2>{0.156849071f, 0.554861844f},
-std::array<float,2>{0.385527343f, 0.433965832f},
-std::array<float,2>{0.751346111f, 0.951968372f},
-std::array<float,2>{0.829447091f, 0.211498395f},
-std::array<float,2>{0.491096497f, 0.654386878f},
-std::array<float,2>{0.219696805f, 0.296474248f},
-std::array<float,2>{0.749050319f, 0.760592341f},
-std::array<float,2>{0.541792691f, 0.479946762f},
-std::array<float,2>{0.0366947129f, 0.881100893f},
-std::array<float,2>{0.344236076f, 0.00883628242f},
-std::array<float,2>{0.910609066f, 0.592847884f},
-std::array<float,2>{0.991887927f, 0.425588369f},
-std::array<float,2>{0.29462859f, 0.944627821f},
-std::array<float,2>{0.0656941906f, 0.106640659f},
-std::array<float,2>{0.598997772f, 0.553570628f},
-std::array<float,2>{0.685425162f, 0.184690267f},
-std::array<float,2>{0.152289346f, 0.734617293f},
-std::array<float,2>{0.41143474f, 0.33856529f},
-std::array<float,2>{0.781580746f, 0.869761109f},
-std::array<float,2>{0.862528324f, 0.00677096192f},
-std::array<float,2>{0.468153626f, 0.578592718f},
-std::array<float,2>{0.211260915f, 0.469961613f},
-std::array<float,2>{0.715916216f, 0.8870309f},
-std::array<float,2>{0.5070889f, 0.284234345f},
-std::array<float,2>{0.00964043103f, 0.755406439f},
-std::array<float,2>{0.316277683f, 0.203583315f},
-std::array<float,2>{0.891133487f, 0.64352113f},
-std::array<float,2>{0.763864577f, 0.356348604f},
-std::array<float,2>{0.37571013f, 0.842161655f},
-std::array<float,2>{0.171644777f, 0.152862445f},
-std::array<float,2>{0.627244055f, 0.699830711f},
-std::array<float,2>{0.569894791f, 0.081946753f},
-std::array<float,2>{0.104867443f, 0.524861753f},
-std::array<float,2>{0.270635992f, 0.388168067f},
-std::array<float,2>{0.938141644f, 0.980176389f},
-std::array<float,2>{0.918380141f, 0.222959518f},
-std::array<float,2>{0.356702387f, 0.666435599f},
-std::array<float,2>{0.0409086905f, 0.274529994f},
-std::array<float,2>{0.531471014f, 0.788764238f},
-std::array<float,2>{0.738094151f, 0.457837939f},
-std::array<float,2>{0.22711429f, 0.930297017f},
-std::array<float,2>{0.494205356f, 0.0527008809f},
-std::array<float,2>{0.838309348f, 0.613282084f},
-std::array<float,2>{0.827077389f, 0.494187295f},
-std::array<float,2>{0.471709222f, 0.905144155f},
-std::array<float,2>{0.237984717f, 0.0241263639f},
-std::array<float,2>{0.732456326f, 0.564232945f},
-std::array<float,2>{0.554308772f, 0.190581709f},
-std::array<float,2>{0.0552708209f, 0.6280424f},
-std::array<float,2>{0.372267723f, 0.301637352f},
-std::array<float,2>{0.932443619f, 0.780259907f},
-std::array<float,2>{0.954376757f, 0.120996647f},
-std::array<float,2>{0.254032552f, 0.542011619f},
-std::array<float,2>{0.115611903f, 0.416495472f},
-std::array<float,2>{0.584097266f, 0.955530107f},
-std::array<float,2>{0.652390599f, 0.317420721f},
-std::array<float,2>{0.177859992f, 0.847747564f},
-std::array<float,2>{0.39201358f, 0.158516243f},
-std::array<float,2>{0.776787698f, 0.722639084f},
-std::array<float,2>{0.877125859f, 0.252371341f},
-std::array<float,2>{0.343617618f, 0.810679018f},
-std::array<float,2>{0.0308906026f, 0.242797017f},
-std::array<float,2>{0.516171992f, 0.686662257f},
-std::array<float,2>{0.688210249f, 0.0371052213f},
-std::array<float,2>{0.197198808f, 0.605503857f},
-std::array<float,2>{0.442553937f, 0.442523539f},
-std::array<float,2>{0.847095609f, 0.909561336f},
-std::array<float,2>{0.804121733f, 0.133903518f},
-std::array<float,2>{0.433915287f, 0.706264973f},
-std::array<float,2>{0.13232775f, 0.37319091f},
-std::array<float,2>{0.671542883f, 0.82197696f},
-std::array<float,2>{0.611106873f, 0.39145869f},
-std::array<float,2>{0.0914466307f, 0.99807477f},
-std::array<float,2>{0.301949114f, 0.0654939711f},
-std::array<float,2>{0.968956411f, 0.510048151f},
-std::array<float,2>{0.967058182f, 0.474336982f},
-std::array<float,2>{0.260275573f, 0.883706987f},
-std::array<float,2>{0.119299494f, 0.000609125535f},
-std::array<float,2>{0.591411829f, 0.582896888f},
-std::array<float,2>{0.646605551f, 0.209808528f},
-std::array<float,2>{0.181030303f, 0.647804439f},
-std::array<float,2>{0.405966848f, 0.288978845f},
-std::array<float,2>{0.76602149f, 0.751753807f},
-std::array<float,2>{0.815045953f, 0.102374069f},
-std::array<float,2>{0.477398157f, 0.550524175f},
-std::array<float,2>{0.243544683f, 0.425788462f},
-std::array<float,2>{0.719248414f, 0.941172659f},
-std::array<float,2>{0.560627162f, 0.341913879f},
-std::array<float,2>{0.0517789349f, 0.87272799f},
-std::array<float,2>{0.360488653f, 0.180984512f},
-std::array<float,2>{0.926945448f, 0.741516769f},
-std::array<float,2>{0.806895554f, 0.278066427f},
-std::array<float,2>{0.427475601f, 0.781376362f},
-std::array<float,2>{0.137085333f, 0.220322758f},
-std::array<float,2>{0.657607555f, 0.670020878f},
-std::array<float,2>{0.617775083f, 0.04840561f},
-std::array<float,2>{0.0791094005f, 0.611739933f},
-std::array<float,2>{0.307539493f, 0.455353796f},
-std::array<float,2>{0.980491877f, 0.934630334f},
-std::array<float,2>{0.885915399f, 0.152166784f},
-std::array<float,2>{0.329445302f, 0.695618153f},
-std::array<float,2>{0.0216146111f, 0.352027327f},
-std::array<float,2>{0.525731325f, 0.836083651f},
-std::array<float,2>{0.69577235f, 0.383537054f},
-std::array<float,2>{0.192840427f, 0.98437053f},
-std::array<float,2>{0.445971519f, 0.0854756162f},
-std::array<float,2>{0.854662776f, 0.529207706f},
-std::array<float,2>{0.874133289f, 0.41964522f},
-std::array<float,2>{0.45372656f, 0.960740626f},
-std::array<float,2>{0.206950456f, 0.124416851f},
-std::array<float,2>{0.710153639f, 0.546551228f},
-std::array<float,2>{0.511119485f, 0.160401523f},
-std::array<float,2>{0.00526995212f, 0.723905325f},
-std::array<float,2>{0.326605558f, 0.313325912f},
-std::array<float,2>{0.904409528f, 0.845474601f},
-std::array<float,2>{0.998475015f, 0.0301336925f},
-std::array<float,2>{0.286646634f, 0.567740262f},
-std::array<float,2>{0.0768144131f, 0.496416509f},
-std::array<float,2>{0.602432847f, 0.900317013f},
-std::array<float,2>{0.676678181f, 0.297466964f},
-std::array<float,2>{0.147186592f, 0.773790359f},
-std::array<float,2>{0.414350003f, 0.19231157f},
-std::array<float,2>{0.793318629f, 0.631615281f},
-std::array<float,2>{0.906611383f, 0.367554218f},
-std::array<float,2>{0.34880659f, 0.825963497f},
-std::array<float,2>{0.0344320871f, 0.137126043f},
-std::array<float,2>{0.546023905f, 0.708740771f},
-std::array<float,2>{0.742298663f, 0.0682512373f},
-std::array<float,2>{0.22286506f, 0.514010191f},
-std::array<float,2>{0.485183865f, 0.39471668f},
-std::array<float,2>{0.834554732f, 0.995439827f},
-std::array<float,2>{0.75554812f, 0.248096615f},
-std::array<float,2>{0.38929069f, 0.683537602f},
-std::array<float,2>{0.160405099f, 0.255622029f},
-std::array<float,2>{0.637580276f, 0.805074215f},
-std::array<float,2>{0.577809393f, 0.441006064f},
-std::array<float,2>{0.0996863395f, 0.912917733f},
-std::array<float,2>{0.27804336f, 0.0325814672f},
-std::array<float,2>{0.951997757f, 0.602860212f},
-std::array<float,2>{0.895926058f, 0.400187373f},
-std::array<float,2>{0.318701178f, 0.989605188f},
-std::array<float,2>{0.0149743166f, 0.074910745f},
-std::array<float,2>{0.502640903f, 0.506819904f},
-std::array<float,2>{0.710946977f, 0.129441291f},
-std::array<float,2>{0.21864213f, 0.713925004f},
-std::array<float,2>{0.462272376f, 0.363964736f},
-std::array<float,2>{0.863680124f, 0.819630563f},
-std::array<float,2>{0.786214828f, 0.0456314236f},
-std::array<float,2>{0.409767896f, 0.597459137f},
-std::array<float,2>{0.153316021f, 0.447028309f},
-std::array<float,2>{0.682030082f, 0.92048645f},
-std::array<float,2>{0.595394135f, 0.258608609f},
-std::array<float,2>{0.0686215907f, 0.80457139f},
-std::array<float,2>{0.292898566f, 0.237536997f},
-std::array<float,2>{0.986705542f, 0.678700924f},
-std::array<float,2>{0.841964245f, 0.323035866f},
-std::array<float,2>{0.496118367f, 0.856084824f},
-std::array<float,2>{0.233301729f, 0.171251506f},
-std::array<float,2>{0.741613746f, 0.734057724f},
-std::array<float,2>{0.53517288f, 0.112445526f},
-std::array<float,2>{0.0431872867f, 0.538624406f},
-std::array<float,2>{0.352165848f, 0.41025877f},
-std::array<float,2>{0.914433777f, 0.963048339f},
-std::array<float,2>{0.945071936f, 0.195755944f},
-std::array<float,2>{0.26741001f, 0.637674928f},
-std::array<float,2>{0.107926644f, 0.308542073f},
-std::array<float,2>{0.565784335f, 0.767070174f},
-std::array<float,2>{0.631796658f, 0.48548758f},
-std::array<float,2>{0.167215496f, 0.892273068f},
-std::array<float,2>{0.382361293f, 0.021729704f},
-std::array<float,2>{0.759509981f, 0.576308846f},
-std::array<float,2>{0.777546942f, 0.468363911f},
-std::array<float,2>{0.396325171f, 0.927929223f},
-std::array<float,2>{0.174879521f, 0.0614459105f},
-std::array<float,2>{0.648733318f, 0.617422938f},
-std::array<float,2>{0.57820034f, 0.230424479f},
-std::array<float,2>{0.111189008f, 0.659566939f},
-std::array<float,2>{0.252503067f, 0.2724998f},
-std::array<float,2>{0.959825814f, 0.794484437f},
-std::array<float,2>{0.93654269f, 0.0894868374f},
-std::array<float,2>{0.370136112f, 0.520780504f},
-std::array<float,2>{0.0593997166f, 0.377264977f},
-std::array<float,2>{0.549133897f, 0.972901702f},
-std::array<float,2>{0.727677822f, 0.35055384f},
-std::array<float,2>{0.241592646f, 0.832560956f},
-std::array<float,2>{0.473709106f, 0.148260877f},
-std::array<float,2>{0.820663452f, 0.693815649f},
-std::array<float,2>{0.976037621f, 0.291523814f},
-std::array<float,2>{0.300219864f, 0.762838125f},
-std::array<float,2>{0.0874527991f, 0.21626021f},
-std::array<float,2>{0.615387678f, 0.650507331f},
-std::array<float,2>{0.667098463f, 0.0126628969f},
-std::array<float,2>{0.128309846f, 0.586378157f},
-std::array<float,2>{0.430970967f, 0.484024465f},
-std::array<float,2>{0.799868882f, 0.876316965f},
-std::array<float,2>{0.851417065f, 0.177230984f},
-std::array<float,2>{0.440993577f, 0.742242157f},
-std::array<float,2>{0.200872973f, 0.330643415f},
-std::array<float,2>{0.69454807f, 0.866334617f},
-std::array<float,2>{0.522570014f, 0.43119368f},
-std::array<float,2>{0.0247642435f, 0.945986748f},
-std::array<float,2>{0.339334548f, 0.100868225f},
-std::array<float,2>{0.881606042f, 0.55899781f},
-std::array<float,2>{0.888289809f, 0.48878029f},
-std::array<float,2>{0.332286686f, 0.89837718f},
-std::array<float,2>{0.0161556136f, 0.0169508513f},
-std::array<float,2>{0.529551983f, 0.57277596f},
-std::array<float,2>{0.701963782f, 0.202427372f},
-std::array<float,2>{0.187577277f, 0.634056211f},
-std::array<float,2>{0.45057863f, 0.309094608f},
-std::array<float,2>{0.858176947f, 0.773276627f},
-std::array<float,2>{0.809899032f, 0.11481756f},
-std::array<float,2>{0.425257951f, 0.532716453f},
-std::array<float,2>{0.134549662f, 0.408972919f},
-std::array<float,2>{0.66179204f, 0.965649366f},
-std::array<float,2>{0.622422695f, 0.327684999f},
-std::array<float,2>{0.0836459696f, 0.854801178f},
-std::array<float,2>{0.309403807f, 0.165847212f},
-std::array<float,2>{0.977727115f, 0.729336083f},
-std::array<float,2>{0.819313049f, 0.264763296f},
-std::array<float,2>{0.480850279f, 0.79960227f},
-std::array<float,2>{0.249678165f, 0.239407569f},
-std::array<float,2>{0.724385023f, 0.675377488f},
-std::array<float,2>{0.556477308f, 0.0391624719f},
-std::array<float,2>{0.0500718243f, 0.600004971f},
-std::array<float,2>{0.366116852f, 0.452145725f},
-std::array<float,2>{0.922289014f, 0.916593373f},
-std::array<float,2>{0.962190747f, 0.127704531f},
-std::array<float,2>{0.265338033f, 0.717299461f},
-std::array<float,2>{0.12233749f, 0.363267809f},
-std::array<float,2>{0.587550938f, 0.814124048f},
-std::array<float,2>{0.643106282f, 0.403104424f},
-std::array<float,2>{0.183730096f, 0.988110125f},
-std::array<float,2>{0.399170548f, 0.0706963092f},
-std::array<float,2>{0.770046234f, 0.501368225f},
-std::array<float,2>{0.753371775f, 0.436553031f},
-std::array<float,2>{0.384656221f, 0.94928658f},
-std::array<float,2>{0.159766361f, 0.0973209664f},
-std::array<float,2>{0.63630712f, 0.557343304f},
-std::array<float,2>{0.570717275f, 0.173661843f},
-std::array<float,2>{0.0946888179f, 0.749666333f},
-std::array<float,2>{0.274279147f, 0.335591018f},
-std::array<float,2>{0.948123634f, 0.861131072f},
-std::array<float,2>{0.913311958f, 0.0112663209f},
-std::array<float,2>{0.346460253f, 0.590175152f},
-std::array<float,2>{0.0388677604f, 0.477638036f},
-std::array<float,2>{0.539791465f, 0.879294157f},
-std::array<float,2>{0.747659028f, 0.29413563f},
-std::array<float,2>{0.220782772f, 0.758206725f},
-std::array<float,2>{0.488935769f, 0.213957369f},
-std::array<float,2>{0.831601799f, 0.654037058f},
-std::array<float,2>{0.993728995f, 0.347558975f},
-std::array<float,2>{0.283691108f, 0.831967533f},
-std::array<float,2>{0.0719196275f, 0.14231424f},
-std::array<float,2>{0.60773927f, 0.690647304f},
-std::array<float,2>{0.672745049f, 0.0910627395f},
-std::array<float,2>{0.142995387f, 0.519221902f},
-std::array<float,2>{0.421344727f, 0.380907267f},
-std::array<float,2>{0.789069951f, 0.9699862f},
-std::array<float,2>{0.869755924f, 0.232739449f},
-std::array<float,2>{0.460386962f, 0.661967218f},
-std::array<float,2>{0.210169032f, 0.266768187f},
-std::array<float,2>{0.706583202f, 0.789456844f},
-std::array<float,2>{0.515331388f, 0.462632418f},
-std::array<float,2>{0.0025634456f, 0.922017932f},
-std::array<float,2>{0.322979808f, 0.0575416349f},
-std::array<float,2>{0.900101721f, 0.621142626f},
-std::array<float,2>{0.940647483f, 0.38929525f},
-std::array<float,2>{0.273062855f, 0.97721225f},
-std::array<float,2>{0.102079704f, 0.079036884f},
-std::array<float,2>{0.567489982f, 0.526359797f},
-std::array<float,2>{0.626793206f, 0.155279756f},
-std::array<float,2>{0.168031752f, 0.703027308f},
-std::array<float,2>{0.378207266f, 0.357517034f},
-std::array<float,2>{0.763416708f, 0.840322435f},
-std::array<float,2>{0.837771177f, 0.0535965897f},
-std::array<float,2>{0.49351579f, 0.61590004f},
-std::array<float,2>{0.228910506f, 0.459203094f},
-std::array<float,2>{0.735512972f, 0.931994557f},
-std::array<float,2>{0.533718526f, 0.276665241f},
-std::array<float,2>{0.0411422737f, 0.785203457f},
-std::array<float,2>{0.358759373f, 0.224921376f},
-std::array<float,2>{0.920176327f, 0.665528893f},
-std::array<float,2>{0.784566939f, 0.336191267f},
-std::array<float,2>{0.412761927f, 0.867232621f},
-std::array<float,2>{0.149958119f, 0.185562223f},
-std::array<float,2>{0.687242329f, 0.737008452f},
-std::array<float,2>{0.600400627f, 0.10821528f},
-std::array<float,2>{0.062685065f, 0.552640617f},
-std::array<float,2>{0.295989037f, 0.423816144f},
-std::array<float,2>{0.988996923f, 0.942881942f},
-std::array<float,2>{0.894458175f, 0.206543386f},
-std::array<float,2>{0.313021302f, 0.642254293f},
-std::array<float,2>{0.0103749838f, 0.281575173f},
-std::array<float,2>{0.505375445f, 0.756754041f},
-std::array<float,2>{0.718304038f, 0.47148931f},
-std::array<float,2>{0.214063495f, 0.889429152f},
-std::array<float,2>{0.466235876f, 0.00505214976f},
-std::array<float,2>{0.859646797f, 0.580924034f},
-std::array<float,2>{0.844766557f, 0.443904519f},
-std::array<float,2>{0.445175231f, 0.907617569f},
-std::array<float,2>{0.197603226f, 0.0378911458f},
-std::array<float,2>{0.689794302f, 0.608363748f},
-std::array<float,2>{0.517970026f, 0.245566875f},
-std::array<float,2>{0.0284812264f, 0.684709311f},
-std::array<float,2>{0.340449095f, 0.25009793f},
-std::array<float,2>{0.876535296f, 0.808849037f},
-std::array<float,2>{0.971987605f, 0.0642574728f},
-std::array<float,2>{0.302830756f, 0.508479536f},
-std::array<float,2>{0.0930639729f, 0.393131405f},
-std::array<float,2>{0.612470448f, 0.997937262f},
-std::array<float,2>{0.66914922f, 0.372968644f},
-std::array<float,2>{0.130620286f, 0.822713137f},
-std::array<float,2>{0.435991794f, 0.135665238f},
-std::array<float,2>{0.800822675f, 0.704795539f},
-std::array<float,2>{0.930031896f, 0.303103715f},
-std::array<float,2>{0.373880029f, 0.778800964f},
-std::array<float,2>{0.0582827963f, 0.189017951f},
-std::array<float,2>{0.551736593f, 0.62655127f},
-std::array<float,2>{0.73071748f, 0.0257800147f},
-std::array<float,2>{0.235374555f, 0.564683378f},
-std::array<float,2>{0.469073474f, 0.493343204f},
-std::array<float,2>{0.824826956f, 0.903979719f},
-std::array<float,2>{0.774540305f, 0.15632467f},
-std::array<float,2>{0.3930237f, 0.720178604f},
-std::array<float,2>{0.175834522f, 0.319728225f},
-std::array<float,2>{0.65438354f, 0.849657357f},
-std::array<float,2>{0.582871437f, 0.414297491f},
-std::array<float,2>{0.113858193f, 0.953431547f},
-std::array<float,2>{0.256626606f, 0.117974609f},
-std::array<float,2>{0.956063747f, 0.539657176f},
-std::array<float,2>{0.983475924f, 0.453722f},
-std::array<float,2>{0.305890769f, 0.937367201f},
-std::array<float,2>{0.0803259984f, 0.0501357168f},
-std::array<float,2>{0.620180666f, 0.61058712f},
-std::array<float,2>{0.659831882f, 0.221726596f},
-std::array<float,2>{0.139360502f, 0.669117749f},
-std::array<float,2>{0.428317457f, 0.281018674f},
-std::array<float,2>{0.805353761f, 0.783598423f},
-std::array<float,2>{0.852419794f, 0.0833095387f},
-std::array<float,2>{0.448969901f, 0.52981621f},
-std::array<float,2>{0.194478437f, 0.386235505f},
-std::array<float,2>{0.69915247f, 0.982019126f},
-std::array<float,2>{0.525001645f, 0.353520453f},
-std::array<float,2>{0.0209058728f, 0.839333892f},
-std::array<float,2>{0.331600785f, 0.14891541f},
-std::array<float,2>{0.884427488f, 0.697265983f},
-std::array<float,2>{0.768548369f, 0.285641164f},
-std::array<float,2>{0.402722001f, 0.753249526f},
-std::array<float,2>{0.182721958f, 0.208610758f},
-std::array<float,2>{0.644843698f, 0.646420181f},
-std::array<float,2>{0.593604326f, 0.00319833029f},
-std::array<float,2>{0.117734477f, 0.585077524f},
-std::array<float,2>{0.258145183f, 0.475418746f},
-std::array<float,2>{0.966668844f, 0.886668861f},
-std::array<float,2>{0.929399788f, 0.183133408f},
-std::array<float,2>{0.363081187f, 0.739022315f},
-std::array<float,2>{0.0532978252f, 0.340019345f},
-std::array<float,2>{0.559982061f, 0.87345916f},
-std::array<float,2>{0.721128464f, 0.428314388f},
-std::array<float,2>{0.245858163f, 0.938329637f},
-std::array<float,2>{0.479603767f, 0.103570305f},
-std::array<float,2>{0.81427145f, 0.547196925f},
-std::array<float,2>{0.832116842f, 0.398304135f},
-std::array<float,2>{0.486962914f, 0.993625343f},
-std::array<float,2>{0.225109056f, 0.0695229322f},
-std::array<float,2>{0.744812548f, 0.51267451f},
-std::array<float,2>{0.543555319f, 0.140280709f},
-std::array<float,2>{0.0323608704f, 0.710401833f},
-std::array<float,2>{0.349919856f, 0.370413363f},
-std::array<float,2>{0.909520328f, 0.826748133f},
-std::array<float,2>{0.949267209f, 0.0334522538f},
-std::array<float,2>{0.279925197f, 0.605338275f},
-std::array<float,2>{0.0995849371f, 0.438832045f},
-std::array<float,2>{0.574430525f, 0.910475254f},
-std::array<float,2>{0.640425622f, 0.256614625f},
-std::array<float,2>{0.163433298f, 0.80793798f},
-std::array<float,2>{0.387116045f, 0.246562257f},
-std::array<float,2>{0.75613606f, 0.679947972f},
-std::array<float,2>{0.90380156f, 0.316061318f},
-std::array<float,2>{0.326169968f, 0.846538961f},
-std::array<float,2>{0.00772068137f, 0.16234225f},
-std::array<float,2>{0.508178353f, 0.724971592f},
-std::array<float,2>{0.708822489f, 0.122516096f},
-std::array<float,2>{0.204904154f, 0.543719471f},
-std::array<float,2>{0.455156058f, 0.420787901f},
-std::array<float,2>{0.872331262f, 0.958815992f},
-std::array<float,2>{0.796345353f, 0.194454089f},
-std::array<float,2>{0.416049868f, 0.629223287f},
-std::array<float,2>{0.145683601f, 0.299553871f},
-std::array<float,2>{0.67941916f, 0.776575089f},
-std::array<float,2>{0.603810966f, 0.499962687f},
-std::array<float,2>{0.0743873119f, 0.900746703f},
-std::array<float,2>{0.288004786f, 0.0285371318f},
-std::array<float,2>{0.997983456f, 0.569012225f},
-std::array<float,2>{0.91604811f, 0.412578344f},
-std::array<float,2>{0.355351686f, 0.961906672f},
-std::array<float,2>{0.0466573052f, 0.110505216f},
-std::array<float,2>{0.539033115f, 0.535769999f},
-std::array<float,2>{0.738572061f, 0.16915755f},
-std::array<float,2>{0.231690794f, 0.732169688f},
-std::array<float,2>{0.499362826f, 0.320912898f},
-std::array<float,2>{0.839881003f, 0.858679414f},
-std::array<float,2>{0.761508763f, 0.0214653425f},
-std::array<float,2>{0.37937957f, 0.575414956f},
-std::array<float,2>{0.165217802f, 0.486470878f},
-std::array<float,2>{0.629504263f, 0.893983364f},
-std::array<float,2>{0.56394738f, 0.306594044f},
-std::array<float,2>{0.107405372f, 0.768145502f},
-std::array<float,2>{0.268588841f, 0.199129567f},
-std::array<float,2>{0.942123234f, 0.63878721f},
-std::array<float,2>{0.866107345f, 0.365985513f},
-std::array<float,2>{0.463091999f, 0.81757164f},
-std::array<float,2>{0.216504857f, 0.132770419f},
-std::array<float,2>{0.713876903f, 0.712356865f},
-std::array<float,2>{0.500323653f, 0.0779423937f},
-std::array<float,2>{0.0118268011f, 0.505804002f},
-std::array<float,2>{0.317485958f, 0.40220958f},
-std::array<float,2>{0.896694899f, 0.991005838f},
-std::array<float,2>{0.984417617f, 0.234399587f},
-std::array<float,2>{0.290486872f, 0.676086485f},
-std::array<float,2>{0.0670002177f, 0.261545151f},
-std::array<float,2>{0.596487939f, 0.802010477f},
-std::array<float,2>{0.679867446f, 0.447784781f},
-std::array<float,2>{0.15469712f, 0.919244707f},
-std::array<float,2>{0.407533675f, 0.0436887927f},
-std::array<float,2>{0.788800776f, 0.595644176f},
-std::array<float,2>{0.798545361f, 0.481146991f},
-std::array<float,2>{0.431746542f, 0.878131986f},
-std::array<float,2>{0.12525633f, 0.0149557786f},
-std::array<float,2>{0.665779889f, 0.58931911f},
-std::array<float,2>{0.614379466f, 0.218502417f},
-std::array<float,2>{0.0878973082f, 0.649918795f},
-std::array<float,2>{0.297276139f, 0.28943935f},
-std::array<float,2>{0.973374546f, 0.764296234f},
-std::array<float,2>{0.879325271f, 0.0980530754f},
-std::array<float,2>{0.337852061f, 0.561742902f},
-std::array<float,2>{0.0257988404f, 0.431764871f},
-std::array<float,2>{0.521360576f, 0.948677778f},
-std::array<float,2>{0.691897869f, 0.329674333f},
-std::array<float,2>{0.201831669f, 0.863640666f},
-std::array<float,2>{0.438993245f, 0.178668395f},
-std::array<float,2>{0.848675191f, 0.745387495f},
-std::array<float,2>{0.958693922f, 0.271007568f},
-std::array<float,2>{0.250740677f, 0.795226812f},
-std::array<float,2>{0.112698823f, 0.227366537f},
-std::array<float,2>{0.581219256f, 0.65785265f},
-std::array<float,2>{0.650600493f, 0.0599270761f},
-std::array<float,2>{0.172168553f, 0.619617283f},
-std::array<float,2>{0.397452384f, 0.466661543f},
-std::array<float,2>{0.780868769f, 0.927434802f},
-std::array<float,2>{0.82348156f, 0.144548714f},
-std::array<float,2>{0.474818289f, 0.692269742f},
-std::array<float,2>{0.238368616f, 0.348581851f},
-std::array<float,2>{0.729147911f, 0.835566521f},
-std::array<float,2>{0.548497438f, 0.376140237f},
-std::array<float,2>{0.0623645857f, 0.975783527f},
-std::array<float,2>{0.367896646f, 0.087434791f},
-std::array<float,2>{0.934829652f, 0.521602154f},
-std::array<float,2>{0.875997484f, 0.443058729f},
-std::array<float,2>{0.340102226f, 0.909806192f},
-std::array<float,2>{0.0292520635f, 0.0362733193f},
-std::array<float,2>{0.518092513f, 0.606254697f},
-std::array<float,2>{0.690238535f, 0.242295951f},
-std::array<float,2>{0.198231608f, 0.687186241f},
-std::array<float,2>{0.444448233f, 0.25288862f},
-std::array<float,2>{0.845482647f, 0.811042726f},
-std::array<float,2>{0.801511288f, 0.0659450442f},
-std::array<float,2>{0.436275005f, 0.510696471f},
-std::array<float,2>{0.129987732f, 0.390700817f},
-std::array<float,2>{0.669457853f, 0.998915911f},
-std::array<float,2>{0.612984776f, 0.373983711f},
-std::array<float,2>{0.0934367254f, 0.821602166f},
-std::array<float,2>{0.303535461f, 0.134429649f},
-std::array<float,2>{0.972441852f, 0.706629574f},
-std::array<float,2>{0.824389458f, 0.301190108f},
-std::array<float,2>{0.469436198f, 0.779693604f},
-std::array<float,2>{0.235909f, 0.191085339f},
-std::array<float,2>{0.730992436f, 0.628662765f},
-std::array<float,2>{0.550983667f, 0.0237847492f},
-std::array<float,2>{0.0580117404f, 0.563476682f},
-std::array<float,2>{0.373436898f, 0.494863749f},
-std::array<float,2>{0.930514753f, 0.904363275f},
-std::array<float,2>{0.956544876f, 0.158727184f},
-std::array<float,2>{0.25588131f, 0.721727192f},
-std::array<float,2>{0.113560766f, 0.317923605f},
-std::array<float,2>{0.582252979f, 0.848232985f},
-std::array<float,2>{0.654791594f, 0.416514486f},
-std::array<float,2>{0.176603422f, 0.95579499f},
-std::array<float,2>{0.39308694f, 0.120508693f},
-std::array<float,2>{0.775070369f, 0.542868733f},
-std::array<float,2>{0.76314503f, 0.388455927f},
-std::array<float,2>{0.37881732f, 0.979718029f},
-std::array<float,2>{0.168512821f, 0.0812708884f},
-std::array<float,2>{0.62623167f, 0.52517283f},
-std::array<float,2>{0.567905724f, 0.152625382f},
-std::array<float,2>{0.101799533f, 0.699460626f},
-std::array<float,2>{0.272729427f, 0.355943501f},
-std::array<float,2>{0.941294432f, 0.842496157f},
-std::array<float,2>{0.920871496f, 0.051954519f},
-std::array<float,2>{0.359109312f, 0.613798678f},
-std::array<float,2>{0.0418789871f, 0.457381606f},
-std::array<float,2>{0.533317149f, 0.930060387f},
-std::array<float,2>{0.73591584f, 0.275101215f},
-std::array<float,2>{0.229029059f, 0.788480043f},
-std::array<float,2>{0.493951648f, 0.223371401f},
-std::array<float,2>{0.837139964f, 0.666544259f},
-std::array<float,2>{0.988558352f, 0.338179618f},
-std::array<float,2>{0.296510041f, 0.869405866f},
-std::array<float,2>{0.0631942675f, 0.185286999f},
-std::array<float,2>{0.599684119f, 0.73508203f},
-std::array<float,2>{0.686691344f, 0.107126392f},
-std::array<float,2>{0.149771914f, 0.552824497f},
-std::array<float,2>{0.412404954f, 0.425198317f},
-std::array<float,2>{0.784668446f, 0.94492799f},
-std::array<float,2>{0.86014843f, 0.203643605f},
-std::array<float,2>{0.466378212f, 0.643006623f},
-std::array<float,2>{0.214772165f, 0.284914672f},
-std::array<float,2>{0.717826724f, 0.755086362f},
-std::array<float,2>{0.50494957f, 0.470641702f},
-std::array<float,2>{0.00993439183f, 0.887258351f},
-std::array<float,2>{0.312600046f, 0.00622229278f},
-std::array<float,2>{0.893766344f, 0.578927934f},
-std::array<float,2>{0.947664022f, 0.434465587f},
-std::array<float,2>{0.273886353f, 0.951465607f},
-std::array<float,2>{0.093803592f, 0.0947164744f},
-std::array<float,2>{0.571169019f, 0.555468738f},
-std::array<float,2>{0.636027157f, 0.175311059f},
-std::array<float,2>{0.159246445f, 0.746748924f},
-std::array<float,2>{0.383881837f, 0.332118213f},
-std::array<float,2>{0.753572941f, 0.862933576f},
-std::array<float,2>{0.831502914f, 0.00972792413f},
-std::array<float,2>{0.488442004f, 0.593441963f},
-std::array<float,2>{0.221216559f, 0.480065286f},
-std::array<float,2>{0.747140467f, 0.881366611f},
-std::array<float,2>{0.539181769f, 0.296347946f},
-std::array<float,2>{0.0384731814f, 0.760117531f},
-std::array<float,2>{0.345730156f, 0.211297914f},
-std::array<float,2>{0.913842797f, 0.654968619f},
-std::array<float,2>{0.789655447f, 0.345178246f},
-std::array<float,2>{0.421575993f, 0.828855693f},
-std::array<float,2>{0.143515781f, 0.142656803f},
-std::array<float,2>{0.672319889f, 0.688232839f},
-std::array<float,2>{0.608061492f, 0.0932028666f},
-std::array<float,2>{0.0713103339f, 0.516006827f},
-std::array<float,2>{0.283803642f, 0.379450798f},
-std::array<float,2>{0.993189514f, 0.972192645f},
-std::array<float,2>{0.89941752f, 0.231532916f},
-std::array<float,2>{0.322745144f, 0.662186742f},
-std::array<float,2>{0.00207339716f, 0.26808992f},
-std::array<float,2>{0.51496613f, 0.791496456f},
-std::array<float,2>{0.706390858f, 0.463197529f},
-std::array<float,2>{0.210807443f, 0.924275279f},
-std::array<float,2>{0.460561007f, 0.0558851361f},
-std::array<float,2>{0.869355798f, 0.623354673f},
-std::array<float,2>{0.85753113f, 0.492094547f},
-std::array<float,2>{0.450688064f, 0.896155536f},
-std::array<float,2>{0.188135296f, 0.0188847743f},
-std::array<float,2>{0.701355875f, 0.571432173f},
-std::array<float,2>{0.530110955f, 0.200553268f},
-std::array<float,2>{0.0156814381f, 0.634899437f},
-std::array<float,2>{0.332606614f, 0.311793476f},
-std::array<float,2>{0.88800633f, 0.770484388f},
-std::array<float,2>{0.97843802f, 0.116828986f},
-std::array<float,2>{0.308748752f, 0.534138322f},
-std::array<float,2>{0.0834012479f, 0.407544464f},
-std::array<float,2>{0.62304461f, 0.968591273f},
-std::array<float,2>{0.661170125f, 0.325503945f},
-std::array<float,2>{0.134106934f, 0.852500319f},
-std::array<float,2>{0.4255853f, 0.167268097f},
-std::array<float,2>{0.810144246f, 0.727752328f},
-std::array<float,2>{0.922432721f, 0.262261599f},
-std::array<float,2>{0.365335882f, 0.797702849f},
-std::array<float,2>{0.0507675521f, 0.240574688f},
-std::array<float,2>{0.555745304f, 0.672098935f},
-std::array<float,2>{0.72378552f, 0.041964259f},
-std::array<float,2>{0.249403954f, 0.598380089f},
-std::array<float,2>{0.481270581f, 0.450521708f},
-std::array<float,2>{0.818373322f, 0.915206134f},
-std::array<float,2>{0.769852757f, 0.125965565f},
-std::array<float,2>{0.398661971f, 0.715068579f},
-std::array<float,2>{0.184201613f, 0.361300856f},
-std::array<float,2>{0.642720699f, 0.815717876f},
-std::array<float,2>{0.587082744f, 0.405537337f},
-std::array<float,2>{0.122861393f, 0.984438896f},
-std::array<float,2>{0.264992237f, 0.0732320249f},
-std::array<float,2>{0.962841988f, 0.503324807f},
-std::array<float,2>{0.972803414f, 0.483454019f},
-std::array<float,2>{0.29753089f, 0.876523793f},
-std::array<float,2>{0.0886807218f, 0.0119911721f},
-std::array<float,2>{0.614777684f, 0.586584568f},
-std::array<float,2>{0.665169895f, 0.216404855f},
-std::array<float,2>{0.125531286f, 0.650930822f},
-std::array<float,2>{0.432195276f, 0.291266531f},
-std::array<float,2>{0.79830128f, 0.763667583f},
-std::array<float,2>{0.849175274f, 0.101514682f},
-std::array<float,2>{0.438499331f, 0.559211373f},
-std::array<float,2>{0.201617196f, 0.431123912f},
-std::array<float,2>{0.691557109f, 0.945762575f},
-std::array<float,2>{0.520651519f, 0.330453008f},
-std::array<float,2>{0.0259316172f, 0.866927505f},
-std::array<float,2>{0.337111413f, 0.177456021f},
-std::array<float,2>{0.879577219f, 0.743139684f},
-std::array<float,2>{0.780667961f, 0.273030609f},
-std::array<float,2>{0.396866649f, 0.794142485f},
-std::array<float,2>{0.17247884f, 0.229773134f},
-std::array<float,2>{0.651312232f, 0.660028636f},
-std::array<float,2>{0.581874788f, 0.0608976595f},
-std::array<float,2>{0.112997361f, 0.617854655f},
-std::array<float,2>{0.250314564f, 0.468108892f},
-std::array<float,2>{0.958431959f, 0.928231835f},
-std::array<float,2>{0.935167789f, 0.14783217f},
-std::array<float,2>{0.367337883f, 0.694081366f},
-std::array<float,2>{0.0616819635f, 0.350008309f},
-std::array<float,2>{0.547880828f, 0.83209765f},
-std::array<float,2>{0.728702724f, 0.377897888f},
-std::array<float,2>{0.239247739f, 0.973271728f},
-std::array<float,2>{0.47514236f, 0.0892882273f},
-std::array<float,2>{0.824091852f, 0.521144569f},
-std::array<float,2>{0.840680599f, 0.410887957f},
-std::array<float,2>{0.499606073f, 0.963533044f},
-std::array<float,2>{0.232386455f, 0.113054976f},
-std::array<float,2>{0.738797843f, 0.538343668f},
-std::array<float,2>{0.538201153f, 0.171525866f},
-std::array<float,2>{0.0461611673f, 0.733757973f},
-std::array<float,2>{0.354664624f, 0.322654784f},
-std::array<float,2>{0.916729271f, 0.855590403f},
-std::array<float,2>{0.941758454f, 0.0221441928f},
-std::array<float,2>{0.269204557f, 0.57675755f},
-std::array<float,2>{0.106661707f, 0.486175388f},
-std::array<float,2>{0.564081073f, 0.891938388f},
-std::array<float,2>{0.629295707f, 0.307744592f},
-std::array<float,2>{0.165600836f, 0.767188609f},
-std::array<float,2>{0.379497975f, 0.196006924f},
-std::array<float,2>{0.760988951f, 0.636970103f},
-std::array<float,2>{0.897083104f, 0.363591671f},
-std::array<float,2>{0.317967266f, 0.820303142f},
-std::array<float,2>{0.0125765232f, 0.129141361f},
-std::array<float,2>{0.500705183f, 0.714752495f},
-std::array<float,2>{0.714466035f, 0.0746737197f},
-std::array<float,2>{0.216139093f, 0.506305933f},
-std::array<float,2>{0.463661581f, 0.39985773f},
-std::array<float,2>{0.865525365f, 0.989835083f},
-std::array<float,2>{0.788240075f, 0.238028333f},
-std::array<float,2>{0.407849163f, 0.677820146f},
-std::array<float,2>{0.155095652f, 0.258238673f},
-std::array<float,2>{0.680210829f, 0.803967237f},
-std::array<float,2>{0.596007764f, 0.446382135f},
-std::array<float,2>{0.0664109811f, 0.920372069f},
-std::array<float,2>{0.290590584f, 0.0452242978f},
-std::array<float,2>{0.985036433f, 0.597044885f},
-std::array<float,2>{0.910061598f, 0.395195514f},
-std::array<float,2>{0.350143224f, 0.995910704f},
-std::array<float,2>{0.0327994563f, 0.0677818581f},
-std::array<float,2>{0.543386996f, 0.514582634f},
-std::array<float,2>{0.744422138f, 0.137215599f},
-std::array<float,2>{0.22463508f, 0.708436966f},
-std::array<float,2>{0.486525178f, 0.367798358f},
-std::array<float,2>{0.832712173f, 0.82549727f},
-std::array<float,2>{0.756446064f, 0.0327384546f},
-std::array<float,2>{0.387223065f, 0.603263617f},
-std::array<float,2>{0.163706839f, 0.440439552f},
-std::array<float,2>{0.640100837f, 0.912335455f},
-std::array<float,2>{0.575150073f, 0.254889548f},
-std::array<float,2>{0.0986607224f, 0.80528456f},
-std::array<float,2>{0.279588968f, 0.248997048f},
-std::array<float,2>{0.949914396f, 0.683083177f},
-std::array<float,2>{0.87293309f, 0.312808722f},
-std::array<float,2>{0.455913275f, 0.845083714f},
-std::array<float,2>{0.204525143f, 0.160984695f},
-std::array<float,2>{0.70808202f, 0.72456193f},
-std::array<float,2>{0.508561015f, 0.124795899f},
-std::array<float,2>{0.00718316669f, 0.546018243f},
-std::array<float,2>{0.325362265f, 0.419427305f},
-std::array<float,2>{0.904124856f, 0.960133672f},
-std::array<float,2>{0.997496426f, 0.191703513f},
-std::array<float,2>{0.287539184f, 0.631002307f},
-std::array<float,2>{0.0748904869f, 0.29710412f},
-std::array<float,2>{0.604361892f, 0.774336159f},
-std::array<float,2>{0.678721249f, 0.496776015f},
-std::array<float,2>{0.146122992f, 0.899658799f},
-std::array<float,2>{0.416768074f, 0.0295034777f},
-std::array<float,2>{0.796811759f, 0.568349898f},
-std::array<float,2>{0.804710031f, 0.455956042f},
-std::array<float,2>{0.428166151f, 0.935355663f},
-std::array<float,2>{0.1390398f, 0.0482440591f},
-std::array<float,2>{0.659600794f, 0.611964703f},
-std::array<float,2>{0.620734394f, 0.220140457f},
-std::array<float,2>{0.0808701664f, 0.670686483f},
-std::array<float,2>{0.306611955f, 0.277730495f},
-std::array<float,2>{0.984360635f, 0.781878531f},
-std::array<float,2>{0.883815765f, 0.0849992931f},
-std::array<float,2>{0.331306696f, 0.528655827f},
-std::array<float,2>{0.0213814378f, 0.382910728f},
-std::array<float,2>{0.52444464f, 0.983778954f},
-std::array<float,2>{0.698523164f, 0.352372944f},
-std::array<float,2>{0.194922745f, 0.836503983f},
-std::array<float,2>{0.448512107f, 0.151409507f},
-std::array<float,2>{0.852032423f, 0.696023881f},
-std::array<float,2>{0.966056824f, 0.28846994f},
-std::array<float,2>{0.258422941f, 0.751444221f},
-std::array<float,2>{0.117260337f, 0.209324539f},
-std::array<float,2>{0.592832506f, 0.648180306f},
-std::array<float,2>{0.645431995f, 0.000330995128f},
-std::array<float,2>{0.183121666f, 0.582060635f},
-std::array<float,2>{0.403171778f, 0.473839045f},
-std::array<float,2>{0.767890036f, 0.883066952f},
-std::array<float,2>{0.813789129f, 0.18126893f},
-std::array<float,2>{0.480374068f, 0.741935432f},
-std::array<float,2>{0.245136648f, 0.34251225f},
-std::array<float,2>{0.721611679f, 0.872180104f},
-std::array<float,2>{0.56023711f, 0.426524609f},
-std::array<float,2>{0.0529542938f, 0.940850079f},
-std::array<float,2>{0.362394214f, 0.101689629f},
-std::array<float,2>{0.929190636f, 0.550207257f},
-std::array<float,2>{0.932064295f, 0.493652403f},
-std::array<float,2>{0.372726768f, 0.903492868f},
-std::array<float,2>{0.055000145f, 0.0259020142f},
-std::array<float,2>{0.553910971f, 0.564970434f},
-std::array<float,2>{0.733096778f, 0.188833579f},
-std::array<float,2>{0.237374946f, 0.626407444f},
-std::array<float,2>{0.472385705f, 0.303475916f},
-std::array<float,2>{0.826619744f, 0.779080868f},
-std::array<float,2>{0.776867509f, 0.117421761f},
-std::array<float,2>{0.392281413f, 0.539124429f},
-std::array<float,2>{0.178508654f, 0.414804339f},
-std::array<float,2>{0.653097093f, 0.953708529f},
-std::array<float,2>{0.58480382f, 0.319871873f},
-std::array<float,2>{0.116010681f, 0.850172281f},
-std::array<float,2>{0.254463375f, 0.157019287f},
-std::array<float,2>{0.95490396f, 0.720585406f},
-std::array<float,2>{0.847350836f, 0.250897408f},
-std::array<float,2>{0.443083227f, 0.809449255f},
-std::array<float,2>{0.196362212f, 0.245607585f},
-std::array<float,2>{0.687506557f, 0.685095072f},
-std::array<float,2>{0.515847981f, 0.0375052691f},
-std::array<float,2>{0.0307277776f, 0.607728183f},
-std::array<float,2>{0.343138605f, 0.443392575f},
-std::array<float,2>{0.877534568f, 0.908194959f},
-std::array<float,2>{0.969391704f, 0.135175616f},
-std::array<float,2>{0.302361459f, 0.704316676f},
-std::array<float,2>{0.0912934691f, 0.372137606f},
-std::array<float,2>{0.61076653f, 0.823206782f},
-std::array<float,2>{0.670973778f, 0.392980158f},
-std::array<float,2>{0.132054508f, 0.997401953f},
-std::array<float,2>{0.434265167f, 0.0636445805f},
-std::array<float,2>{0.804500222f, 0.507976234f},
-std::array<float,2>{0.781779289f, 0.422874689f},
-std::array<float,2>{0.412103862f, 0.942559779f},
-std::array<float,2>{0.151719242f, 0.107577287f},
-std::array<float,2>{0.685021043f, 0.552241147f},
-std::array<float,2>{0.599561036f, 0.186177596f},
-std::array<float,2>{0.0661156327f, 0.73663646f},
-std::array<float,2>{0.294302404f, 0.336542785f},
-std::array<float,2>{0.991593063f, 0.868122697f},
-std::array<float,2>{0.891015291f, 0.0056704795f},
-std::array<float,2>{0.315464586f, 0.580440223f},
-std::array<float,2>{0.00887545571f, 0.47111699f},
-std::array<float,2>{0.507617652f, 0.88882637f},
-std::array<float,2>{0.716519475f, 0.281871736f},
-std::array<float,2>{0.211662695f, 0.756073952f},
-std::array<float,2>{0.468286395f, 0.2061079f},
-std::array<float,2>{0.863233745f, 0.6419819f},
-std::array<float,2>{0.93773061f, 0.358150482f},
-std::array<float,2>{0.271291137f, 0.840605319f},
-std::array<float,2>{0.105156779f, 0.155957848f},
-std::array<float,2>{0.569636762f, 0.702175081f},
-std::array<float,2>{0.627537131f, 0.0782173276f},
-std::array<float,2>{0.170903102f, 0.52582705f},
-std::array<float,2>{0.375179946f, 0.389142454f},
-std::array<float,2>{0.764629364f, 0.977042735f},
-std::array<float,2>{0.838702798f, 0.22551775f},
-std::array<float,2>{0.494956166f, 0.665469944f},
-std::array<float,2>{0.226810977f, 0.276935965f},
-std::array<float,2>{0.737523079f, 0.78584522f},
-std::array<float,2>{0.531762302f, 0.45955044f},
-std::array<float,2>{0.0401251055f, 0.932610393f},
-std::array<float,2>{0.357095748f, 0.0527691543f},
-std::array<float,2>{0.91878736f, 0.615296423f},
-std::array<float,2>{0.99454999f, 0.381539255f},
-std::array<float,2>{0.283130974f, 0.970377505f},
-std::array<float,2>{0.0726189092f, 0.0916992575f},
-std::array<float,2>{0.606058955f, 0.518678129f},
-std::array<float,2>{0.674249887f, 0.141759336f},
-std::array<float,2>{0.141353846f, 0.691357851f},
-std::array<float,2>{0.418222934f, 0.34668541f},
-std::array<float,2>{0.791865468f, 0.83154124f},
-std::array<float,2>{0.868711531f, 0.0568970703f},
-std::array<float,2>{0.458342254f, 0.621937275f},
-std::array<float,2>{0.208258301f, 0.462081969f},
-std::array<float,2>{0.703879595f, 0.922521472f},
-std::array<float,2>{0.512579381f, 0.267338991f},
-std::array<float,2>{0.00122557336f, 0.789566398f},
-std::array<float,2>{0.321079731f, 0.233215988f},
-std::array<float,2>{0.90089947f, 0.661452651f},
-std::array<float,2>{0.75162071f, 0.335116386f},
-std::array<float,2>{0.384913713f, 0.86036092f},
-std::array<float,2>{0.156380892f, 0.173027053f},
-std::array<float,2>{0.633624196f, 0.749492943f},
-std::array<float,2>{0.57259655f, 0.0970014408f},
-std::array<float,2>{0.0969522744f, 0.556914628f},
-std::array<float,2>{0.276182652f, 0.437118411f},
-std::array<float,2>{0.945411146f, 0.949804306f},
-std::array<float,2>{0.911107123f, 0.214534357f},
-std::array<float,2>{0.344565004f, 0.653750598f},
-std::array<float,2>{0.0365086943f, 0.294813484f},
-std::array<float,2>{0.541403592f, 0.758414924f},
-std::array<float,2>{0.749516129f, 0.478338808f},
-std::array<float,2>{0.218813732f, 0.879855335f},
-std::array<float,2>{0.49031201f, 0.0108845122f},
-std::array<float,2>{0.829649925f, 0.590359986f},
-std::array<float,2>{0.817679107f, 0.451571256f},
-std::array<float,2>{0.483173609f, 0.916438401f},
-std::array<float,2>{0.246915147f, 0.0396371707f},
-std::array<float,2>{0.724627972f, 0.600203395f},
-std::array<float,2>{0.556700647f, 0.240192503f},
-std::array<float,2>{0.0473074988f, 0.674944282f},
-std::array<float,2>{0.364435554f, 0.265498787f},
-std::array<float,2>{0.925376892f, 0.799060762f},
-std::array<float,2>{0.962971151f, 0.0711735114f},
-std::array<float,2>{0.261759698f, 0.501592338f},
-std::array<float,2>{0.124674365f, 0.40282625f},
-std::array<float,2>{0.589162767f, 0.98755151f},
-std::array<float,2>{0.642233133f, 0.362633586f},
-std::array<float,2>{0.186533168f, 0.813656688f},
-std::array<float,2>{0.401998907f, 0.127365664f},
-std::array<float,2>{0.77242744f, 0.717256546f},
-std::array<float,2>{0.88942492f, 0.308635533f},
-std::array<float,2>{0.335837543f, 0.772842824f},
-std::array<float,2>{0.0183920115f, 0.202911034f},
-std::array<float,2>{0.528885603f, 0.634569705f},
-std::array<float,2>{0.700769424f, 0.0172576588f},
-std::array<float,2>{0.191402286f, 0.572446823f},
-std::array<float,2>{0.452434123f, 0.48853448f},
-std::array<float,2>{0.857323527f, 0.897663236f},
-std::array<float,2>{0.811938524f, 0.16507557f},
-std::array<float,2>{0.423460215f, 0.72873199f},
-std::array<float,2>{0.13554205f, 0.327592969f},
-std::array<float,2>{0.662913144f, 0.855282068f},
-std::array<float,2>{0.62338078f, 0.408466876f},
-std::array<float,2>{0.0843058079f, 0.965085089f},
-std::array<float,2>{0.311222315f, 0.114588283f},
-std::array<float,2>{0.979321837f, 0.532714307f},
-std::array<float,2>{0.959044278f, 0.466223091f},
-std::array<float,2>{0.252216011f, 0.926864445f},
-std::array<float,2>{0.110740654f, 0.0602303892f},
-std::array<float,2>{0.578618109f, 0.619776189f},
-std::array<float,2>{0.649348795f, 0.226906776f},
-std::array<float,2>{0.175765634f, 0.657506406f},
-std::array<float,2>{0.395938426f, 0.270764738f},
-std::array<float,2>{0.778033555f, 0.795579851f},
-std::array<float,2>{0.821053386f, 0.0869456232f},
-std::array<float,2>{0.47417295f, 0.522322953f},
-std::array<float,2>{0.241783187f, 0.376708359f},
-std::array<float,2>{0.728080392f, 0.976468086f},
-std::array<float,2>{0.5494349f, 0.34793818f},
-std::array<float,2>{0.059073478f, 0.83505863f},
-std::array<float,2>{0.370934576f, 0.145211235f},
-std::array<float,2>{0.937046707f, 0.691511214f},
-std::array<float,2>{0.800750852f, 0.289713234f},
-std::array<float,2>{0.431218117f, 0.763677835f},
-std::array<float,2>{0.128453806f, 0.217914149f},
-std::array<float,2>{0.667545855f, 0.649573982f},
-std::array<float,2>{0.615984559f, 0.0155064007f},
-std::array<float,2>{0.0870660767f, 0.589743018f},
-std::array<float,2>{0.300382257f, 0.480812848f},
-std::array<float,2>{0.976200223f, 0.878501058f},
-std::array<float,2>{0.881115735f, 0.177970156f},
-std::array<float,2>{0.33942169f, 0.745836139f},
-std::array<float,2>{0.0252026152f, 0.329328924f},
-std::array<float,2>{0.523036838f, 0.863992751f},
-std::array<float,2>{0.694826186f, 0.432184607f},
-std::array<float,2>{0.200358778f, 0.948827088f},
-std::array<float,2>{0.440614551f, 0.0985037982f},
-std::array<float,2>{0.85061276f, 0.56235081f},
-std::array<float,2>{0.864045739f, 0.401498377f},
-std::array<float,2>{0.462559372f, 0.990266562f},
-std::array<float,2>{0.218115464f, 0.0771934018f},
-std::array<float,2>{0.711843193f, 0.505238414f},
-std::array<float,2>{0.501977563f, 0.132317573f},
-std::array<float,2>{0.0153408656f, 0.712707102f},
-std::array<float,2>{0.319191843f, 0.365680069f},
-std::array<float,2>{0.896044195f, 0.817989409f},
-std::array<float,2>{0.98717773f, 0.0431993566f},
-std::array<float,2>{0.292117447f, 0.595029294f},
-std::array<float,2>{0.0690027401f, 0.447515875f},
-std::array<float,2>{0.595139623f, 0.919550955f},
-std::array<float,2>{0.682492495f, 0.260842741f},
-std::array<float,2>{0.152673483f, 0.802465975f},
-std::array<float,2>{0.409566849f, 0.235214263f},
-std::array<float,2>{0.786675215f, 0.676607668f},
-std::array<float,2>{0.914948583f, 0.320748478f},
-std::array<float,2>{0.351847947f, 0.859074712f},
-std::array<float,2>{0.0438408889f, 0.169601381f},
-std::array<float,2>{0.535860837f, 0.731523871f},
-std::array<float,2>{0.742137194f, 0.111172765f},
-std::array<float,2>{0.232607022f, 0.535271764f},
-std::array<float,2>{0.496760398f, 0.413073838f},
-std::array<float,2>{0.842563212f, 0.961197376f},
-std::array<float,2>{0.759255886f, 0.198653832f},
-std::array<float,2>{0.382306397f, 0.639414549f},
-std::array<float,2>{0.167681932f, 0.305946797f},
-std::array<float,2>{0.631269336f, 0.767838299f},
-std::array<float,2>{0.566174567f, 0.487072915f},
-std::array<float,2>{0.1079081f, 0.894375563f},
-std::array<float,2>{0.267006159f, 0.0209690426f},
-std::array<float,2>{0.944439828f, 0.575707138f},
-std::array<float,2>{0.904833555f, 0.420197845f},
-std::array<float,2>{0.327065796f, 0.95840466f},
-std::array<float,2>{0.00551670743f, 0.122923829f},
-std::array<float,2>{0.511695862f, 0.543254495f},
-std::array<float,2>{0.710687101f, 0.16276522f},
-std::array<float,2>{0.206288368f, 0.725581467f},
-std::array<float,2>{0.453600049f, 0.315687895f},
-std::array<float,2>{0.874676347f, 0.845813215f},
-std::array<float,2>{0.793908298f, 0.0292696059f},
-std::array<float,2>{0.414689779f, 0.568578184f},
-std::array<float,2>{0.146773741f, 0.499294221f},
-std::array<float,2>{0.676183045f, 0.900880814f},
-std::array<float,2>{0.60166353f, 0.299131215f},
-std::array<float,2>{0.0762499571f, 0.777259111f},
-std::array<float,2>{0.286489278f, 0.195271939f},
-std::array<float,2>{0.998702347f, 0.629555047f},
-std::array<float,2>{0.834072888f, 0.370989561f},
-std::array<float,2>{0.484422803f, 0.826185465f},
-std::array<float,2>{0.223455861f, 0.139797673f},
-std::array<float,2>{0.742784739f, 0.710514307f},
-std::array<float,2>{0.546484947f, 0.0701154917f},
-std::array<float,2>{0.0348070078f, 0.511788368f},
-std::array<float,2>{0.34956345f, 0.39771083f},
-std::array<float,2>{0.906929433f, 0.993949592f},
-std::array<float,2>{0.951295614f, 0.246589556f},
-std::array<float,2>{0.277689338f, 0.680346906f},
-std::array<float,2>{0.100203373f, 0.256041408f},
-std::array<float,2>{0.577557266f, 0.80852437f},
-std::array<float,2>{0.636888087f, 0.439171851f},
-std::array<float,2>{0.161009714f, 0.91078794f},
-std::array<float,2>{0.388871014f, 0.033718735f},
-std::array<float,2>{0.7550897f, 0.60472095f},
-std::array<float,2>{0.766521752f, 0.474962145f},
-std::array<float,2>{0.405610979f, 0.885906577f},
-std::array<float,2>{0.181284443f, 0.00374314003f},
-std::array<float,2>{0.647314191f, 0.585473716f},
-std::array<float,2>{0.590921581f, 0.208489656f},
-std::array<float,2>{0.12003427f, 0.645623803f},
-std::array<float,2>{0.259880662f, 0.285711884f},
-std::array<float,2>{0.967351198f, 0.753836572f},
-std::array<float,2>{0.927370667f, 0.104239322f},
-std::array<float,2>{0.361046553f, 0.547409713f},
-std::array<float,2>{0.0523139685f, 0.428168744f},
-std::array<float,2>{0.561251879f, 0.937761784f},
-std::array<float,2>{0.718831718f, 0.340723634f},
-std::array<float,2>{0.243930295f, 0.873616457f},
-std::array<float,2>{0.476954132f, 0.18279849f},
-std::array<float,2>{0.814850628f, 0.73869884f},
-std::array<float,2>{0.9811638f, 0.280286789f},
-std::array<float,2>{0.306996554f, 0.78390044f},
-std::array<float,2>{0.0797639415f, 0.222338483f},
-std::array<float,2>{0.617614985f, 0.66955179f},
-std::array<float,2>{0.657888651f, 0.0505462922f},
-std::array<float,2>{0.137316495f, 0.61124146f},
-std::array<float,2>{0.427163124f, 0.45349735f},
-std::array<float,2>{0.807307541f, 0.936555088f},
-std::array<float,2>{0.85505873f, 0.149230108f},
-std::array<float,2>{0.445652097f, 0.697933197f},
-std::array<float,2>{0.193263069f, 0.354223669f},
-std::array<float,2>{0.69586885f, 0.839450121f},
-std::array<float,2>{0.526104152f, 0.386101067f},
-std::array<float,2>{0.0223366674f, 0.981464326f},
-std::array<float,2>{0.330019444f, 0.0835744292f},
-std::array<float,2>{0.886716008f, 0.529613495f},
-std::array<float,2>{0.919110775f, 0.45823282f},
-std::array<float,2>{0.35575819f, 0.931334257f},
-std::array<float,2>{0.0396289676f, 0.0516722165f},
-std::array<float,2>{0.533091307f, 0.615187347f},
-std::array<float,2>{0.736884773f, 0.224286035f},
-std::array<float,2>{0.228307575f, 0.667160094f},
-std::array<float,2>{0.495902032f, 0.274302185f},
-std::array<float,2>{0.838959634f, 0.787392199f},
-std::array<float,2>{0.765333295f, 0.0810182318f},
-std::array<float,2>{0.376945138f, 0.523790538f},
-std::array<float,2>{0.170474544f, 0.386992276f},
-std::array<float,2>{0.628354609f, 0.978916824f},
-std::array<float,2>{0.568659663f, 0.357311636f},
-std::array<float,2>{0.10373646f, 0.843285024f},
-std::array<float,2>{0.26998502f, 0.154262275f},
-std::array<float,2>{0.939426124f, 0.701014042f},
-std::array<float,2>{0.862154365f, 0.283913791f},
-std::array<float,2>{0.46693778f, 0.754554152f},
-std::array<float,2>{0.212686568f, 0.204227105f},
-std::array<float,2>{0.715503037f, 0.644460857f},
-std::array<float,2>{0.506835699f, 0.00760731753f},
-std::array<float,2>{0.00878449809f, 0.579298496f},
-std::array<float,2>{0.315395206f, 0.468928218f},
-std::array<float,2>{0.892253041f, 0.888428628f},
-std::array<float,2>{0.990712523f, 0.184348449f},
-std::array<float,2>{0.293716758f, 0.736103654f},
-std::array<float,2>{0.0646079108f, 0.339331597f},
-std::array<float,2>{0.59790051f, 0.870693445f},
-std::array<float,2>{0.684009731f, 0.424193174f},
-std::array<float,2>{0.15122515f, 0.943445504f},
-std::array<float,2>{0.411014825f, 0.106293432f},
-std::array<float,2>{0.782299638f, 0.554575741f},
-std::array<float,2>{0.803034425f, 0.392349929f},
-std::array<float,2>{0.4355416f, 0.999053478f},
-std::array<float,2>{0.131186947f, 0.0644977614f},
-std::array<float,2>{0.670227051f, 0.511016428f},
-std::array<float,2>{0.610300004f, 0.133538574f},
-std::array<float,2>{0.0900320262f, 0.70602268f},
-std::array<float,2>{0.300807208f, 0.374105543f},
-std::array<float,2>{0.969954789f, 0.820472479f},
-std::array<float,2>{0.878200471f, 0.0355417654f},
-std::array<float,2>{0.341938645f, 0.607089162f},
-std::array<float,2>{0.0297082011f, 0.44163096f},
-std::array<float,2>{0.517244399f, 0.908407688f},
-std::array<float,2>{0.688728273f, 0.253287584f},
-std::array<float,2>{0.195971414f, 0.812481046f},
-std::array<float,2>{0.441778064f, 0.24321866f},
-std::array<float,2>{0.845764279f, 0.685963452f},
-std::array<float,2>{0.953641832f, 0.316793382f},
-std::array<float,2>{0.255204558f, 0.849196315f},
-std::array<float,2>{0.116926648f, 0.159551576f},
-std::array<float,2>{0.58504498f, 0.721145749f},
-std::array<float,2>{0.653743148f, 0.119428366f},
-std::array<float,2>{0.179348558f, 0.541686833f},
-std::array<float,2>{0.391205549f, 0.417828858f},
-std::array<float,2>{0.775801122f, 0.956243992f},
-std::array<float,2>{0.827859282f, 0.189876735f},
-std::array<float,2>{0.471277833f, 0.627536237f},
-std::array<float,2>{0.236797392f, 0.302273571f},
-std::array<float,2>{0.734083831f, 0.78053546f},
-std::array<float,2>{0.553224206f, 0.495405078f},
-std::array<float,2>{0.0559007302f, 0.90589571f},
-std::array<float,2>{0.371928275f, 0.0250328835f},
-std::array<float,2>{0.933216572f, 0.563395023f},
-std::array<float,2>{0.979537308f, 0.406908512f},
-std::array<float,2>{0.312045544f, 0.967302382f},
-std::array<float,2>{0.0854931548f, 0.115493022f},
-std::array<float,2>{0.624705851f, 0.534539223f},
-std::array<float,2>{0.663486898f, 0.166525513f},
-std::array<float,2>{0.135742605f, 0.726720095f},
-std::array<float,2>{0.422576696f, 0.324954808f},
-std::array<float,2>{0.811356902f, 0.852659106f},
-std::array<float,2>{0.855930865f, 0.0179553945f},
-std::array<float,2>{0.451781452f, 0.571221471f},
-std::array<float,2>{0.189517736f, 0.490533799f},
-std::array<float,2>{0.699258626f, 0.895365357f},
-std::array<float,2>{0.527387202f, 0.310820103f},
-std::array<float,2>{0.0187173486f, 0.770766675f},
-std::array<float,2>{0.334911168f, 0.199525595f},
-std::array<float,2>{0.889714777f, 0.636195421f},
-std::array<float,2>{0.77255857f, 0.360334903f},
-std::array<float,2>{0.401065975f, 0.815379262f},
-std::array<float,2>{0.186210454f, 0.126170367f},
-std::array<float,2>{0.640942097f, 0.716258347f},
-std::array<float,2>{0.588404f, 0.0732944086f},
-std::array<float,2>{0.123784825f, 0.502871096f},
-std::array<float,2>{0.26298967f, 0.404884189f},
-std::array<float,2>{0.964391649f, 0.985493064f},
-std::array<float,2>{0.924195945f, 0.242056549f},
-std::array<float,2>{0.363996089f, 0.673629761f},
-std::array<float,2>{0.0484805033f, 0.2633816f},
-std::array<float,2>{0.558040559f, 0.798344195f},
-std::array<float,2>{0.725752234f, 0.449573427f},
-std::array<float,2>{0.247080609f, 0.91438663f},
-std::array<float,2>{0.484081358f, 0.0421400331f},
-std::array<float,2>{0.817063212f, 0.599285483f},
-std::array<float,2>{0.828736126f, 0.479053915f},
-std::array<float,2>{0.492140234f, 0.882575333f},
-std::array<float,2>{0.220336959f, 0.00827711727f},
-std::array<float,2>{0.748825133f, 0.591980577f},
-std::array<float,2>{0.542168677f, 0.212020651f},
-std::array<float,2>{0.0361183248f, 0.655618787f},
-std::array<float,2>{0.344835371f, 0.29584381f},
-std::array<float,2>{0.911335111f, 0.76113838f},
-std::array<float,2>{0.946330667f, 0.0948966593f},
-std::array<float,2>{0.27687642f, 0.55566591f},
-std::array<float,2>{0.0957545564f, 0.435473531f},
-std::array<float,2>{0.574188471f, 0.952365875f},
-std::array<float,2>{0.634441435f, 0.333410889f},
-std::array<float,2>{0.157724872f, 0.861692727f},
-std::array<float,2>{0.386340946f, 0.174543336f},
-std::array<float,2>{0.750956237f, 0.747713208f},
-std::array<float,2>{0.901542842f, 0.268665612f},
-std::array<float,2>{0.322250187f, 0.792659581f},
-std::array<float,2>{0.000419142307f, 0.231099784f},
-std::array<float,2>{0.512917638f, 0.663146079f},
-std::array<float,2>{0.704778135f, 0.055521667f},
-std::array<float,2>{0.207276046f, 0.624711573f},
-std::array<float,2>{0.457739502f, 0.464297414f},
-std::array<float,2>{0.867563903f, 0.925469995f},
-std::array<float,2>{0.792236149f, 0.144251138f},
-std::array<float,2>{0.419586658f, 0.688818097f},
-std::array<float,2>{0.142115906f, 0.344613045f},
-std::array<float,2>{0.674969494f, 0.830068827f},
-std::array<float,2>{0.606519818f, 0.38082695f},
-std::array<float,2>{0.0738367587f, 0.971536815f},
-std::array<float,2>{0.282209188f, 0.0927637666f},
-std::array<float,2>{0.995934367f, 0.517489016f},
-std::array<float,2>{0.943763018f, 0.484689683f},
-std::array<float,2>{0.26612556f, 0.890935481f},
-std::array<float,2>{0.108987957f, 0.0234077983f},
-std::array<float,2>{0.565002799f, 0.57751292f},
-std::array<float,2>{0.632438123f, 0.196500376f},
-std::array<float,2>{0.166292235f, 0.63833046f},
-std::array<float,2>{0.381807417f, 0.306720436f},
-std::array<float,2>{0.758250713f, 0.765697002f},
-std::array<float,2>{0.84357506f, 0.111759901f},
-std::array<float,2>{0.497532517f, 0.538060844f},
-std::array<float,2>{0.233594194f, 0.411272913f},
-std::array<float,2>{0.741150796f, 0.964705646f},
-std::array<float,2>{0.536639273f, 0.323298514f},
-std::array<float,2>{0.0443836115f, 0.856667995f},
-std::array<float,2>{0.353470802f, 0.170630857f},
-std::array<float,2>{0.915809572f, 0.732521832f},
-std::array<float,2>{0.785712659f, 0.258942276f},
-std::array<float,2>{0.409043193f, 0.803441525f},
-std::array<float,2>{0.153389499f, 0.236985862f},
-std::array<float,2>{0.683004797f, 0.679457188f},
-std::array<float,2>{0.593932271f, 0.0463912264f},
-std::array<float,2>{0.0696385801f, 0.596071959f},
-std::array<float,2>{0.291723728f, 0.445471942f},
-std::array<float,2>{0.988050699f, 0.921099424f},
-std::array<float,2>{0.895455241f, 0.130309224f},
-std::array<float,2>{0.319550276f, 0.7136603f},
-std::array<float,2>{0.0139330747f, 0.364683092f},
-std::array<float,2>{0.503066659f, 0.818499386f},
-std::array<float,2>{0.712160647f, 0.398841202f},
-std::array<float,2>{0.21756728f, 0.989241004f},
-std::array<float,2>{0.461770028f, 0.0753375366f},
-std::array<float,2>{0.864385605f, 0.507445157f},
-std::array<float,2>{0.849926591f, 0.430659801f},
-std::array<float,2>{0.440347552f, 0.946542203f},
-std::array<float,2>{0.199969873f, 0.100358739f},
-std::array<float,2>{0.693711102f, 0.560319185f},
-std::array<float,2>{0.521563351f, 0.175861821f},
-std::array<float,2>{0.0239248835f, 0.743923724f},
-std::array<float,2>{0.338653624f, 0.331319332f},
-std::array<float,2>{0.881980956f, 0.865276098f},
-std::array<float,2>{0.975387812f, 0.0128686186f},
-std::array<float,2>{0.299768627f, 0.587659597f},
-std::array<float,2>{0.0867803693f, 0.482706785f},
-std::array<float,2>{0.617095232f, 0.875815988f},
-std::array<float,2>{0.666403055f, 0.292755395f},
-std::array<float,2>{0.126988038f, 0.76195395f},
-std::array<float,2>{0.43021518f, 0.214986533f},
-std::array<float,2>{0.799563944f, 0.651886106f},
-std::array<float,2>{0.936503291f, 0.351337612f},
-std::array<float,2>{0.369688243f, 0.833364308f},
-std::array<float,2>{0.0598046593f, 0.147445798f},
-std::array<float,2>{0.550671518f, 0.694982171f},
-std::array<float,2>{0.726567626f, 0.0883420929f},
-std::array<float,2>{0.240740359f, 0.519712448f},
-std::array<float,2>{0.47354877f, 0.37852782f},
-std::array<float,2>{0.821965933f, 0.974276423f},
-std::array<float,2>{0.778974652f, 0.228718475f},
-std::array<float,2>{0.395488888f, 0.658798099f},
-std::array<float,2>{0.173881933f, 0.27168259f},
-std::array<float,2>{0.649964333f, 0.793923199f},
-std::array<float,2>{0.579866171f, 0.467684776f},
-std::array<float,2>{0.109659702f, 0.928811252f},
-std::array<float,2>{0.253841728f, 0.0617624633f},
-std::array<float,2>{0.960754693f, 0.618472874f},
-std::array<float,2>{0.884916306f, 0.384517938f},
-std::array<float,2>{0.328192472f, 0.982649386f},
-std::array<float,2>{0.0225887373f, 0.0848536268f},
-std::array<float,2>{0.526500225f, 0.527380586f},
-std::array<float,2>{0.696916997f, 0.150772288f},
-std::array<float,2>{0.192224279f, 0.696796119f},
-std::array<float,2>{0.447005451f, 0.352800131f},
-std::array<float,2>{0.853918731f, 0.837767601f},
-std::array<float,2>{0.808061779f, 0.0476289354f},
-std::array<float,2>{0.425860137f, 0.612322748f},
-std::array<float,2>{0.138257474f, 0.456152588f},
-std::array<float,2>{0.6567958f, 0.934239626f},
-std::array<float,2>{0.618578553f, 0.279126257f},
-std::array<float,2>{0.0787268877f, 0.78223443f},
-std::array<float,2>{0.307620406f, 0.219507471f},
-std::array<float,2>{0.982057393f, 0.671442509f},
-std::array<float,2>{0.81626755f, 0.342890859f},
-std::array<float,2>{0.47759372f, 0.871912956f},
-std::array<float,2>{0.242630839f, 0.180117309f},
-std::array<float,2>{0.720462799f, 0.74107188f},
-std::array<float,2>{0.561733663f, 0.102587245f},
-std::array<float,2>{0.0513406284f, 0.549199462f},
-std::array<float,2>{0.359740794f, 0.427153558f},
-std::array<float,2>{0.926750302f, 0.94039005f},
-std::array<float,2>{0.968449414f, 0.210371107f},
-std::array<float,2>{0.261097819f, 0.646706402f},
-std::array<float,2>{0.120445244f, 0.28795439f},
-std::array<float,2>{0.590610325f, 0.750061572f},
-std::array<float,2>{0.647874534f, 0.472910583f},
-std::array<float,2>{0.180495977f, 0.884248197f},
-std::array<float,2>{0.4052535f, 0.0017450311f},
-std::array<float,2>{0.766996324f, 0.58341229f},
-std::array<float,2>{0.754718661f, 0.439608037f},
-std::array<float,2>{0.389767349f, 0.913787842f},
-std::array<float,2>{0.161514476f, 0.0313587226f},
-std::array<float,2>{0.637892544f, 0.602477968f},
-std::array<float,2>{0.576910019f, 0.249296471f},
-std::array<float,2>{0.100667909f, 0.682611644f},
-std::array<float,2>{0.279263079f, 0.25409624f},
-std::array<float,2>{0.952720881f, 0.805772662f},
-std::array<float,2>{0.907388508f, 0.066518575f},
-std::array<float,2>{0.348571658f, 0.515531361f},
-std::array<float,2>{0.0336717516f, 0.395759046f},
-std::array<float,2>{0.545837224f, 0.994401872f},
-std::array<float,2>{0.744049668f, 0.368430436f},
-std::array<float,2>{0.224356294f, 0.824902534f},
-std::array<float,2>{0.485924006f, 0.13837114f},
-std::array<float,2>{0.835230827f, 0.707349777f},
-std::array<float,2>{0.999550998f, 0.298645884f},
-std::array<float,2>{0.285942674f, 0.774568498f},
-std::array<float,2>{0.0772091746f, 0.192670599f},
-std::array<float,2>{0.603424847f, 0.632776737f},
-std::array<float,2>{0.677729964f, 0.0311986562f},
-std::array<float,2>{0.147732496f, 0.566568792f},
-std::array<float,2>{0.415965945f, 0.497440815f},
-std::array<float,2>{0.794094682f, 0.899349451f},
-std::array<float,2>{0.873350799f, 0.161605924f},
-std::array<float,2>{0.45448947f, 0.723528743f},
-std::array<float,2>{0.205518484f, 0.314306319f},
-std::array<float,2>{0.709756851f, 0.844400585f},
-std::array<float,2>{0.510666609f, 0.418384582f},
-std::array<float,2>{0.00438691443f, 0.959036171f},
-std::array<float,2>{0.327463627f, 0.123579845f},
-std::array<float,2>{0.905567288f, 0.545739055f},
-std::array<float,2>{0.89275974f, 0.472595453f},
-std::array<float,2>{0.313701153f, 0.889800072f},
-std::array<float,2>{0.0110906679f, 0.00448915921f},
-std::array<float,2>{0.504593492f, 0.581732273f},
-std::array<float,2>{0.716892064f, 0.205318853f},
-std::array<float,2>{0.21306102f, 0.641415656f},
-std::array<float,2>{0.465095788f, 0.282884687f},
-std::array<float,2>{0.860921979f, 0.757191658f},
-std::array<float,2>{0.783591509f, 0.109150216f},
-std::array<float,2>{0.413200855f, 0.551476896f},
-std::array<float,2>{0.14933528f, 0.422774464f},
-std::array<float,2>{0.686449945f, 0.941949725f},
-std::array<float,2>{0.600869656f, 0.337804854f},
-std::array<float,2>{0.0636928231f, 0.868247569f},
-std::array<float,2>{0.295175076f, 0.186821476f},
-std::array<float,2>{0.989511192f, 0.737755716f},
-std::array<float,2>{0.836328208f, 0.276354611f},
-std::array<float,2>{0.492844135f, 0.786949813f},
-std::array<float,2>{0.229717657f, 0.225638688f},
-std::array<float,2>{0.73533988f, 0.664390385f},
-std::array<float,2>{0.534979403f, 0.0546500534f},
-std::array<float,2>{0.0424658209f, 0.616402924f},
-std::array<float,2>{0.357440352f, 0.460463613f},
-std::array<float,2>{0.921340287f, 0.932980299f},
-std::array<float,2>{0.940166295f, 0.15474762f},
-std::array<float,2>{0.27186811f, 0.701695383f},
-std::array<float,2>{0.103140593f, 0.358743608f},
-std::array<float,2>{0.567075372f, 0.841356099f},
-std::array<float,2>{0.625341356f, 0.389764518f},
-std::array<float,2>{0.169104069f, 0.978334546f},
-std::array<float,2>{0.377736896f, 0.0795898065f},
-std::array<float,2>{0.762025476f, 0.526807189f},
-std::array<float,2>{0.774123192f, 0.415627956f},
-std::array<float,2>{0.39405489f, 0.954268634f},
-std::array<float,2>{0.177232563f, 0.118301779f},
-std::array<float,2>{0.655527234f, 0.540296018f},
-std::array<float,2>{0.583293021f, 0.157297522f},
-std::array<float,2>{0.115056142f, 0.719239831f},
-std::array<float,2>{0.25739482f, 0.318370402f},
-std::array<float,2>{0.95581001f, 0.851067007f},
-std::array<float,2>{0.931415737f, 0.0273184255f},
-std::array<float,2>{0.374158651f, 0.565500915f},
-std::array<float,2>{0.0567362122f, 0.492235899f},
-std::array<float,2>{0.552477658f, 0.902654231f},
-std::array<float,2>{0.732018411f, 0.304308116f},
-std::array<float,2>{0.234814078f, 0.778017521f},
-std::array<float,2>{0.470452458f, 0.187709108f},
-std::array<float,2>{0.826057613f, 0.62569499f},
-std::array<float,2>{0.971652389f, 0.371283293f},
-std::array<float,2>{0.304550201f, 0.823363483f},
-std::array<float,2>{0.0918469951f, 0.136065543f},
-std::array<float,2>{0.61222297f, 0.703194559f},
-std::array<float,2>{0.668552995f, 0.0633572191f},
-std::array<float,2>{0.129467487f, 0.508937478f},
-std::array<float,2>{0.437386602f, 0.393622011f},
-std::array<float,2>{0.802037776f, 0.99674046f},
-std::array<float,2>{0.844397128f, 0.245032907f},
-std::array<float,2>{0.443575889f, 0.684524536f},
-std::array<float,2>{0.198490232f, 0.251207113f},
-std::array<float,2>{0.690490425f, 0.81037724f},
-std::array<float,2>{0.519060671f, 0.444358796f},
-std::array<float,2>{0.0275017042f, 0.907133579f},
-std::array<float,2>{0.341392994f, 0.0384111367f},
-std::array<float,2>{0.875395238f, 0.608934104f},
-std::array<float,2>{0.961735606f, 0.404107243f},
-std::array<float,2>{0.26458165f, 0.986953914f},
-std::array<float,2>{0.121978216f, 0.072095789f},
-std::array<float,2>{0.586496115f, 0.500033736f},
-std::array<float,2>{0.64385283f, 0.128295526f},
-std::array<float,2>{0.184807286f, 0.718035221f},
-std::array<float,2>{0.399861455f, 0.362219274f},
-std::array<float,2>{0.770995378f, 0.813331902f},
-std::array<float,2>{0.820284247f, 0.0400783643f},
-std::array<float,2>{0.481869787f, 0.600665987f},
-std::array<float,2>{0.248387963f, 0.452631801f},
-std::array<float,2>{0.723195374f, 0.917302787f},
-std::array<float,2>{0.555435061f, 0.263950646f},
-std::array<float,2>{0.0494788811f, 0.80019784f},
-std::array<float,2>{0.366773486f, 0.239208877f},
-std::array<float,2>{0.923756242f, 0.674431384f},
-std::array<float,2>{0.809262455f, 0.326217353f},
-std::array<float,2>{0.424211055f, 0.853811204f},
-std::array<float,2>{0.132932335f, 0.164291278f},
-std::array<float,2>{0.660714567f, 0.729760706f},
-std::array<float,2>{0.621924341f, 0.113445096f},
-std::array<float,2>{0.0824797824f, 0.531417787f},
-std::array<float,2>{0.310471594f, 0.409509122f},
-std::array<float,2>{0.976898313f, 0.966088474f},
-std::array<float,2>{0.887019992f, 0.202113718f},
-std::array<float,2>{0.33315894f, 0.633571267f},
-std::array<float,2>{0.0172639713f, 0.310309082f},
-std::array<float,2>{0.531206548f, 0.77172333f},
-std::array<float,2>{0.702420294f, 0.489411801f},
-std::array<float,2>{0.189305544f, 0.896971226f},
-std::array<float,2>{0.449760586f, 0.0162266698f},
-std::array<float,2>{0.858830512f, 0.57327193f},
-std::array<float,2>{0.870758235f, 0.461218864f},
-std::array<float,2>{0.459094048f, 0.923749447f},
-std::array<float,2>{0.209541216f, 0.0584389046f},
-std::array<float,2>{0.706019044f, 0.62227416f},
-std::array<float,2>{0.514016509f, 0.234135434f},
-std::array<float,2>{0.00389934098f, 0.6610623f},
-std::array<float,2>{0.323783129f, 0.266451895f},
-std::array<float,2>{0.899309754f, 0.790179789f},
-std::array<float,2>{0.992243528f, 0.0902266204f},
-std::array<float,2>{0.284912497f, 0.518371522f},
-std::array<float,2>{0.0705857649f, 0.382676452f},
-std::array<float,2>{0.609043539f, 0.969572902f},
-std::array<float,2>{0.673151612f, 0.345857948f},
-std::array<float,2>{0.143597722f, 0.830888093f},
-std::array<float,2>{0.419962913f, 0.140643001f},
-std::array<float,2>{0.790993452f, 0.68986243f},
-std::array<float,2>{0.912681937f, 0.293447018f},
-std::array<float,2>{0.347468793f, 0.759149909f},
-std::array<float,2>{0.0380148701f, 0.213401556f},
-std::array<float,2>{0.540998697f, 0.652843893f},
-std::array<float,2>{0.746438265f, 0.0105812801f},
-std::array<float,2>{0.221837208f, 0.59127152f},
-std::array<float,2>{0.490197033f, 0.476749808f},
-std::array<float,2>{0.830228209f, 0.880421281f},
-std::array<float,2>{0.752838016f, 0.17250371f},
-std::array<float,2>{0.383474022f, 0.748062789f},
-std::array<float,2>{0.158718362f, 0.334418952f},
-std::array<float,2>{0.63524276f, 0.86020714f},
-std::array<float,2>{0.571461856f, 0.436386704f},
-std::array<float,2>{0.0947361514f, 0.950449765f},
-std::array<float,2>{0.274815559f, 0.0960704684f},
-std::array<float,2>{0.948910296f, 0.558064401f},
-std::array<float,2>{0.985894978f, 0.448987305f},
-std::array<float,2>{0.28971228f, 0.918755949f},
-std::array<float,2>{0.0677508563f, 0.044665765f},
-std::array<float,2>{0.597007155f, 0.594407737f},
-std::array<float,2>{0.681335092f, 0.235860094f},
-std::array<float,2>{0.155560687f, 0.677399039f},
-std::array<float,2>{0.406546056f, 0.260602921f},
-std::array<float,2>{0.787481844f, 0.800817668f},
-std::array<float,2>{0.866546571f, 0.076649569f},
-std::array<float,2>{0.464280486f, 0.504347563f},
-std::array<float,2>{0.215145469f, 0.401271492f},
-std::array<float,2>{0.713797688f, 0.991499364f},
-std::array<float,2>{0.501742661f, 0.367106736f},
-std::array<float,2>{0.0135432119f, 0.816673934f},
-std::array<float,2>{0.316931874f, 0.131093621f},
-std::array<float,2>{0.898083031f, 0.711695731f},
-std::array<float,2>{0.759864569f, 0.305545747f},
-std::array<float,2>{0.380691707f, 0.769526064f},
-std::array<float,2>{0.164408401f, 0.197821692f},
-std::array<float,2>{0.630222797f, 0.64019376f},
-std::array<float,2>{0.563011646f, 0.020175809f},
-std::array<float,2>{0.106362082f, 0.575112224f},
-std::array<float,2>{0.268217772f, 0.488269806f},
-std::array<float,2>{0.942993641f, 0.89283967f},
-std::array<float,2>{0.917024851f, 0.168462843f},
-std::array<float,2>{0.353746414f, 0.73081392f},
-std::array<float,2>{0.0454010852f, 0.321773708f},
-std::array<float,2>{0.537389398f, 0.85766238f},
-std::array<float,2>{0.739435613f, 0.413172096f},
-std::array<float,2>{0.231295526f, 0.962416768f},
-std::array<float,2>{0.498381972f, 0.109958f},
-std::array<float,2>{0.841777861f, 0.536618888f},
-std::array<float,2>{0.82230252f, 0.375516921f},
-std::array<float,2>{0.475740105f, 0.974677026f},
-std::array<float,2>{0.239869371f, 0.0862208158f},
-std::array<float,2>{0.730000496f, 0.523334026f},
-std::array<float,2>{0.546919823f, 0.145578712f},
-std::array<float,2>{0.0608185008f, 0.692716479f},
-std::array<float,2>{0.368387371f, 0.349340528f},
-std::array<float,2>{0.933730364f, 0.834169149f},
-std::array<float,2>{0.957295477f, 0.0591273457f},
-std::array<float,2>{0.251331747f, 0.620151222f},
-std::array<float,2>{0.112272434f, 0.465032458f},
-std::array<float,2>{0.58085227f, 0.92588681f},
-std::array<float,2>{0.651643753f, 0.270133674f},
-std::array<float,2>{0.173276678f, 0.796862721f},
-std::array<float,2>{0.397901028f, 0.227884948f},
-std::array<float,2>{0.7799353f, 0.657023013f},
-std::array<float,2>{0.88055861f, 0.328985572f},
-std::array<float,2>{0.336906224f, 0.864469528f},
-std::array<float,2>{0.0267894883f, 0.178733796f},
-std::array<float,2>{0.519816995f, 0.744557202f},
-std::array<float,2>{0.693039f, 0.0987678617f},
-std::array<float,2>{0.203041896f, 0.560999334f},
-std::array<float,2>{0.438272178f, 0.433569819f},
-std::array<float,2>{0.847974896f, 0.94784987f},
-std::array<float,2>{0.79712081f, 0.217660248f},
-std::array<float,2>{0.432766855f, 0.649166882f},
-std::array<float,2>{0.126450658f, 0.290284485f},
-std::array<float,2>{0.6642887f, 0.765006125f},
-std::array<float,2>{0.613701582f, 0.481541991f},
-std::array<float,2>{0.0892836228f, 0.877604723f},
-std::array<float,2>{0.298654526f, 0.0137927365f},
-std::array<float,2>{0.97438091f, 0.588426292f},
-std::array<float,2>{0.928209662f, 0.428745002f},
-std::array<float,2>{0.362163872f, 0.938791037f},
-std::array<float,2>{0.0540618971f, 0.104750387f},
-std::array<float,2>{0.559428453f, 0.548665762f},
-std::array<float,2>{0.72246021f, 0.182398647f},
-std::array<float,2>{0.24467434f, 0.739276171f},
-std::array<float,2>{0.479317367f, 0.340881377f},
-std::array<float,2>{0.813086629f, 0.874520898f},
-std::array<float,2>{0.76858902f, 0.0023956201f},
-std::array<float,2>{0.404243559f, 0.584768176f},
-std::array<float,2>{0.182229117f, 0.476167113f},
-std::array<float,2>{0.646285057f, 0.885121882f},
-std::array<float,2>{0.591982305f, 0.28689748f},
-std::array<float,2>{0.118546113f, 0.752225876f},
-std::array<float,2>{0.259419382f, 0.207880408f},
-std::array<float,2>{0.965150118f, 0.644577444f},
-std::array<float,2>{0.852760136f, 0.355363846f},
-std::array<float,2>{0.447920382f, 0.838492155f},
-std::array<float,2>{0.19353877f, 0.150078461f},
-std::array<float,2>{0.697472155f, 0.698294878f},
-std::array<float,2>{0.523603082f, 0.0828613415f},
-std::array<float,2>{0.0199875832f, 0.530338049f},
-std::array<float,2>{0.331033826f, 0.385556459f},
-std::array<float,2>{0.882974982f, 0.980762959f},
-std::array<float,2>{0.982534051f, 0.221426502f},
-std::array<float,2>{0.305632174f, 0.668729067f},
-std::array<float,2>{0.0815644264f, 0.279934406f},
-std::array<float,2>{0.619494021f, 0.784904182f},
-std::array<float,2>{0.658693194f, 0.455020487f},
-std::array<float,2>{0.139802232f, 0.936032534f},
-std::array<float,2>{0.429068297f, 0.0492702387f},
-std::array<float,2>{0.805810988f, 0.610286295f},
-std::array<float,2>{0.79507637f, 0.49824813f},
-std::array<float,2>{0.417895287f, 0.901487231f},
-std::array<float,2>{0.145151511f, 0.0274050999f},
-std::array<float,2>{0.678179681f, 0.569663882f},
-std::array<float,2>{0.604911625f, 0.194270939f},
-std::array<float,2>{0.0755061284f, 0.629890442f},
-std::array<float,2>{0.288782269f, 0.300711274f},
-std::array<float,2>{0.996337235f, 0.775830388f},
-std::array<float,2>{0.902516663f, 0.121450596f},
-std::array<float,2>{0.324641198f, 0.544917285f},
-std::array<float,2>{0.00615131296f, 0.421560735f},
-std::array<float,2>{0.509218097f, 0.957757354f},
-std::array<float,2>{0.707885206f, 0.314559788f},
-std::array<float,2>{0.203637332f, 0.846859157f},
-std::array<float,2>{0.456402928f, 0.163526207f},
-std::array<float,2>{0.871978998f, 0.725619197f},
-std::array<float,2>{0.950744212f, 0.257669985f},
-std::array<float,2>{0.280838579f, 0.807188511f},
-std::array<float,2>{0.0979092941f, 0.24737443f},
-std::array<float,2>{0.575631261f, 0.681092978f},
-std::array<float,2>{0.639038086f, 0.0347975455f},
-std::array<float,2>{0.162998855f, 0.604220748f},
-std::array<float,2>{0.388357699f, 0.437654942f},
-std::array<float,2>{0.757233799f, 0.911767483f},
-std::array<float,2>{0.833050728f, 0.13939324f},
-std::array<float,2>{0.487815499f, 0.709740758f},
-std::array<float,2>{0.225809932f, 0.369471759f},
-std::array<float,2>{0.746080816f, 0.827167571f},
-std::array<float,2>{0.544636011f, 0.396683872f},
-std::array<float,2>{0.0314414538f, 0.992320955f},
-std::array<float,2>{0.350844085f, 0.068812713f},
-std::array<float,2>{0.908247769f, 0.513555944f}}
\ No newline at end of file
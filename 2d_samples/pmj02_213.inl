@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.079271853f, 0.469156504f},
-std::array<float,2>{0.79395473f, 0.968956888f},
-std::array<float,2>{0.697199047f, 0.221903622f},
-std::array<float,2>{0.343362004f, 0.669263124f},
-std::array<float,2>{0.485405266f, 0.00120611582f},
-std::array<float,2>{0.560128033f, 0.531306922f},
-std::array<float,2>{0.897313476f, 0.307049453f},
-std::array<float,2>{0.202772632f, 0.8058424f},
-std::array<float,2>{0.291205019f, 0.33484745f},
-std::array<float,2>{0.643994033f, 0.829318345f},
-std::array<float,2>{0.865203977f, 0.116980448f},
-std::array<float,2>{0.0624229982f, 0.607171535f},
-std::array<float,2>{0.152605668f, 0.173043996f},
-std::array<float,2>{0.982564509f, 0.700855196f},
-std::array<float,2>{0.572626054f, 0.375531256f},
-std::array<float,2>{0.432097405f, 0.90131557f},
-std::array<float,2>{0.219649702f, 0.272287309f},
-std::array<float,2>{0.933412731f, 0.762671888f},
-std::array<float,2>{0.512512028f, 0.043495845f},
-std::array<float,2>{0.45416677f, 0.500380099f},
-std::array<float,2>{0.353332669f, 0.210895702f},
-std::array<float,2>{0.721370876f, 0.651207983f},
-std::array<float,2>{0.780275047f, 0.443091393f},
-std::array<float,2>{0.120537207f, 0.95479548f},
-std::array<float,2>{0.404567003f, 0.410025358f},
-std::array<float,2>{0.594671011f, 0.934799075f},
-std::array<float,2>{0.946963489f, 0.144320279f},
-std::array<float,2>{0.172693923f, 0.739833415f},
-std::array<float,2>{0.0196930021f, 0.0654975325f},
-std::array<float,2>{0.827369571f, 0.587389886f},
-std::array<float,2>{0.670125604f, 0.347479045f},
-std::array<float,2>{0.279431641f, 0.859449685f},
-std::array<float,2>{0.167382032f, 0.403856814f},
-std::array<float,2>{0.95674479f, 0.882284582f},
-std::array<float,2>{0.616514325f, 0.159268841f},
-std::array<float,2>{0.379817247f, 0.715083122f},
-std::array<float,2>{0.255622715f, 0.0937687531f},
-std::array<float,2>{0.684443772f, 0.623073757f},
-std::array<float,2>{0.841784716f, 0.327522039f},
-std::array<float,2>{2.30344904e-05f, 0.815571904f},
-std::array<float,2>{0.438961983f, 0.281854004f},
-std::array<float,2>{0.524517179f, 0.791666806f},
-std::array<float,2>{0.909417808f, 0.0254484229f},
-std::array<float,2>{0.238768116f, 0.556569457f},
-std::array<float,2>{0.0957491398f, 0.246177554f},
-std::array<float,2>{0.750902355f, 0.676618934f},
-std::array<float,2>{0.735163391f, 0.496508718f},
-std::array<float,2>{0.368153244f, 0.990238011f},
-std::array<float,2>{0.0351029001f, 0.369622529f},
-std::array<float,2>{0.856078625f, 0.847617626f},
-std::array<float,2>{0.635413349f, 0.0868082568f},
-std::array<float,2>{0.303522915f, 0.563579261f},
-std::array<float,2>{0.417636663f, 0.125807554f},
-std::array<float,2>{0.582271218f, 0.731960475f},
-std::array<float,2>{0.996736825f, 0.437293679f},
-std::array<float,2>{0.136317417f, 0.914348006f},
-std::array<float,2>{0.314345926f, 0.460050493f},
-std::array<float,2>{0.715603113f, 0.950072348f},
-std::array<float,2>{0.807434201f, 0.190011919f},
-std::array<float,2>{0.0695539564f, 0.629968405f},
-std::array<float,2>{0.205162823f, 0.0547260456f},
-std::array<float,2>{0.883034527f, 0.516458392f},
-std::array<float,2>{0.538134336f, 0.261078596f},
-std::array<float,2>{0.479641736f, 0.776922643f},
-std::array<float,2>{0.0112132486f, 0.426227719f},
-std::array<float,2>{0.832643688f, 0.907744884f},
-std::array<float,2>{0.675235391f, 0.136170566f},
-std::array<float,2>{0.26123634f, 0.720230758f},
-std::array<float,2>{0.384197563f, 0.0844920278f},
-std::array<float,2>{0.622237682f, 0.575085282f},
-std::array<float,2>{0.96327126f, 0.363550544f},
-std::array<float,2>{0.162733868f, 0.854628265f},
-std::array<float,2>{0.363966286f, 0.253914982f},
-std::array<float,2>{0.742283702f, 0.772972822f},
-std::array<float,2>{0.763211489f, 0.0483283885f},
-std::array<float,2>{0.10923557f, 0.524579883f},
-std::array<float,2>{0.246504545f, 0.196680412f},
-std::array<float,2>{0.916710556f, 0.636734486f},
-std::array<float,2>{0.520921171f, 0.464123994f},
-std::array<float,2>{0.452760279f, 0.941063643f},
-std::array<float,2>{0.129230231f, 0.318318874f},
-std::array<float,2>{0.990394831f, 0.820491076f},
-std::array<float,2>{0.588352621f, 0.101587184f},
-std::array<float,2>{0.413662672f, 0.615729809f},
-std::array<float,2>{0.31244576f, 0.165748417f},
-std::array<float,2>{0.629915893f, 0.706729293f},
-std::array<float,2>{0.846324265f, 0.392722785f},
-std::array<float,2>{0.0392768048f, 0.886057973f},
-std::array<float,2>{0.469109297f, 0.487278044f},
-std::array<float,2>{0.544372439f, 0.997016788f},
-std::array<float,2>{0.877824068f, 0.240689695f},
-std::array<float,2>{0.215124294f, 0.680136085f},
-std::array<float,2>{0.077590622f, 0.0182455983f},
-std::array<float,2>{0.802526355f, 0.552053571f},
-std::array<float,2>{0.710013866f, 0.289393306f},
-std::array<float,2>{0.323609233f, 0.78562963f},
-std::array<float,2>{0.194267452f, 0.447782367f},
-std::array<float,2>{0.899935603f, 0.965163231f},
-std::array<float,2>{0.551430702f, 0.215152308f},
-std::array<float,2>{0.49221009f, 0.641123891f},
-std::array<float,2>{0.33022806f, 0.0334872194f},
-std::array<float,2>{0.689613879f, 0.510899425f},
-std::array<float,2>{0.782493114f, 0.278325707f},
-std::array<float,2>{0.0904336646f, 0.751782715f},
-std::array<float,2>{0.424289405f, 0.355242878f},
-std::array<float,2>{0.563860774f, 0.86900413f},
-std::array<float,2>{0.975941181f, 0.0704304948f},
-std::array<float,2>{0.144111708f, 0.580479741f},
-std::array<float,2>{0.0519710928f, 0.153444007f},
-std::array<float,2>{0.871762693f, 0.746770799f},
-std::array<float,2>{0.654797375f, 0.419907629f},
-std::array<float,2>{0.28849417f, 0.927192867f},
-std::array<float,2>{0.11456538f, 0.300613999f},
-std::array<float,2>{0.767026424f, 0.803559005f},
-std::array<float,2>{0.728853643f, 0.0138504542f},
-std::array<float,2>{0.345152915f, 0.544633269f},
-std::array<float,2>{0.461837947f, 0.229464546f},
-std::array<float,2>{0.503609419f, 0.65704608f},
-std::array<float,2>{0.928265512f, 0.478295535f},
-std::array<float,2>{0.231751353f, 0.979871452f},
-std::array<float,2>{0.268155664f, 0.38918823f},
-std::array<float,2>{0.660054624f, 0.896476805f},
-std::array<float,2>{0.817147136f, 0.184543222f},
-std::array<float,2>{0.0249362607f, 0.691672206f},
-std::array<float,2>{0.183999419f, 0.123568967f},
-std::array<float,2>{0.940820217f, 0.601044536f},
-std::array<float,2>{0.609334707f, 0.338205457f},
-std::array<float,2>{0.398337692f, 0.837375283f},
-std::array<float,2>{0.0578818098f, 0.464960366f},
-std::array<float,2>{0.859580815f, 0.943985403f},
-std::array<float,2>{0.645934701f, 0.201182544f},
-std::array<float,2>{0.294793457f, 0.635706067f},
-std::array<float,2>{0.434985429f, 0.0519154295f},
-std::array<float,2>{0.575309098f, 0.528097272f},
-std::array<float,2>{0.976775825f, 0.251872897f},
-std::array<float,2>{0.151272789f, 0.768725634f},
-std::array<float,2>{0.338623703f, 0.359665811f},
-std::array<float,2>{0.700504005f, 0.859298766f},
-std::array<float,2>{0.791238308f, 0.0791372582f},
-std::array<float,2>{0.0834286958f, 0.573478401f},
-std::array<float,2>{0.196224242f, 0.137757808f},
-std::array<float,2>{0.891100466f, 0.725393176f},
-std::array<float,2>{0.557435632f, 0.422833562f},
-std::array<float,2>{0.489287943f, 0.913339436f},
-std::array<float,2>{0.175960138f, 0.296628445f},
-std::array<float,2>{0.951704502f, 0.784555554f},
-std::array<float,2>{0.598106563f, 0.0230989642f},
-std::array<float,2>{0.399561137f, 0.54691565f},
-std::array<float,2>{0.275156856f, 0.237110078f},
-std::array<float,2>{0.665448308f, 0.685789108f},
-std::array<float,2>{0.822435439f, 0.490074098f},
-std::array<float,2>{0.0174118467f, 0.992800772f},
-std::array<float,2>{0.457758993f, 0.39760676f},
-std::array<float,2>{0.511461854f, 0.889473677f},
-std::array<float,2>{0.935773313f, 0.168087855f},
-std::array<float,2>{0.223929793f, 0.709505796f},
-std::array<float,2>{0.122531615f, 0.108230345f},
-std::array<float,2>{0.775287807f, 0.612621963f},
-std::array<float,2>{0.722851694f, 0.312560916f},
-std::array<float,2>{0.355739623f, 0.824997485f},
-std::array<float,2>{0.235175982f, 0.41443038f},
-std::array<float,2>{0.913079619f, 0.923900127f},
-std::array<float,2>{0.528736115f, 0.152285367f},
-std::array<float,2>{0.443334997f, 0.743109822f},
-std::array<float,2>{0.37355572f, 0.0779094025f},
-std::array<float,2>{0.741690636f, 0.585498691f},
-std::array<float,2>{0.754825175f, 0.35547173f},
-std::array<float,2>{0.0977571458f, 0.873775065f},
-std::array<float,2>{0.377069861f, 0.275888383f},
-std::array<float,2>{0.611874521f, 0.756136f},
-std::array<float,2>{0.959468603f, 0.0372648798f},
-std::array<float,2>{0.169618607f, 0.512202322f},
-std::array<float,2>{0.00483150128f, 0.212737367f},
-std::array<float,2>{0.837290823f, 0.646240771f},
-std::array<float,2>{0.680381536f, 0.452497244f},
-std::array<float,2>{0.253079563f, 0.963018775f},
-std::array<float,2>{0.0635324046f, 0.341168314f},
-std::array<float,2>{0.811561525f, 0.842467904f},
-std::array<float,2>{0.71462667f, 0.119200535f},
-std::array<float,2>{0.317057699f, 0.597084999f},
-std::array<float,2>{0.482713163f, 0.181452543f},
-std::array<float,2>{0.532825291f, 0.690246522f},
-std::array<float,2>{0.889317095f, 0.384209931f},
-std::array<float,2>{0.208893448f, 0.891700506f},
-std::array<float,2>{0.299960226f, 0.481844664f},
-std::array<float,2>{0.637871504f, 0.9829849f},
-std::array<float,2>{0.854393661f, 0.230795428f},
-std::array<float,2>{0.037038058f, 0.662448585f},
-std::array<float,2>{0.138429493f, 0.0110791558f},
-std::array<float,2>{0.994868398f, 0.541890979f},
-std::array<float,2>{0.579572856f, 0.30241847f},
-std::array<float,2>{0.419714004f, 0.798706412f},
-std::array<float,2>{0.104143083f, 0.381016552f},
-std::array<float,2>{0.760115981f, 0.90592593f},
-std::array<float,2>{0.746894181f, 0.176771298f},
-std::array<float,2>{0.362267494f, 0.695696592f},
-std::array<float,2>{0.446401834f, 0.112436481f},
-std::array<float,2>{0.516463757f, 0.60318166f},
-std::array<float,2>{0.920429349f, 0.329503208f},
-std::array<float,2>{0.243000731f, 0.833544254f},
-std::array<float,2>{0.261804044f, 0.310786337f},
-std::array<float,2>{0.679179311f, 0.811328173f},
-std::array<float,2>{0.830772698f, 0.00717522157f},
-std::array<float,2>{0.0129944673f, 0.536764741f},
-std::array<float,2>{0.157855138f, 0.225688964f},
-std::array<float,2>{0.966723382f, 0.667149603f},
-std::array<float,2>{0.61886847f, 0.474380463f},
-std::array<float,2>{0.388826728f, 0.97566849f},
-std::array<float,2>{0.213420033f, 0.349222749f},
-std::array<float,2>{0.881182253f, 0.865926206f},
-std::array<float,2>{0.542867303f, 0.0702784434f},
-std::array<float,2>{0.475038826f, 0.59005034f},
-std::array<float,2>{0.325490862f, 0.144716278f},
-std::array<float,2>{0.705786228f, 0.736620069f},
-std::array<float,2>{0.797249556f, 0.410480708f},
-std::array<float,2>{0.0706010833f, 0.93186003f},
-std::array<float,2>{0.406850249f, 0.439216793f},
-std::array<float,2>{0.591994047f, 0.959518969f},
-std::array<float,2>{0.986422539f, 0.205849677f},
-std::array<float,2>{0.126905248f, 0.652568161f},
-std::array<float,2>{0.043490544f, 0.0424001813f},
-std::array<float,2>{0.849368751f, 0.504882514f},
-std::array<float,2>{0.626312852f, 0.266989559f},
-std::array<float,2>{0.307167739f, 0.760624349f},
-std::array<float,2>{0.146227077f, 0.495792717f},
-std::array<float,2>{0.969972074f, 0.98658824f},
-std::array<float,2>{0.568288267f, 0.245893523f},
-std::array<float,2>{0.426730394f, 0.674986899f},
-std::array<float,2>{0.284474552f, 0.0286475811f},
-std::array<float,2>{0.648477256f, 0.559293449f},
-std::array<float,2>{0.869202316f, 0.287305087f},
-std::array<float,2>{0.0503999032f, 0.794919729f},
-std::array<float,2>{0.498079538f, 0.320689291f},
-std::array<float,2>{0.547528148f, 0.816876233f},
-std::array<float,2>{0.903094769f, 0.100860201f},
-std::array<float,2>{0.187891155f, 0.617257535f},
-std::array<float,2>{0.0881458297f, 0.161332652f},
-std::array<float,2>{0.787439167f, 0.713762403f},
-std::array<float,2>{0.694205523f, 0.402191043f},
-std::array<float,2>{0.335071445f, 0.87699002f},
-std::array<float,2>{0.0285082217f, 0.265129358f},
-std::array<float,2>{0.81535542f, 0.779450834f},
-std::array<float,2>{0.661875904f, 0.0602699071f},
-std::array<float,2>{0.270113707f, 0.523082852f},
-std::array<float,2>{0.394272864f, 0.193216443f},
-std::array<float,2>{0.604342401f, 0.626525581f},
-std::array<float,2>{0.942109525f, 0.453466803f},
-std::array<float,2>{0.180534109f, 0.946812391f},
-std::array<float,2>{0.348190397f, 0.43006289f},
-std::array<float,2>{0.731761158f, 0.921423256f},
-std::array<float,2>{0.77296555f, 0.132549584f},
-std::array<float,2>{0.112322554f, 0.729432821f},
-std::array<float,2>{0.227732256f, 0.0916077048f},
-std::array<float,2>{0.923477352f, 0.569516957f},
-std::array<float,2>{0.505285263f, 0.373870403f},
-std::array<float,2>{0.466288865f, 0.848164141f},
-std::array<float,2>{0.11801637f, 0.444324434f},
-std::array<float,2>{0.779133141f, 0.956771314f},
-std::array<float,2>{0.718788803f, 0.208881125f},
-std::array<float,2>{0.354075521f, 0.649884641f},
-std::array<float,2>{0.456823975f, 0.0456825867f},
-std::array<float,2>{0.514494777f, 0.503482342f},
-std::array<float,2>{0.931476891f, 0.270359278f},
-std::array<float,2>{0.221154287f, 0.763753772f},
-std::array<float,2>{0.277424186f, 0.345538318f},
-std::array<float,2>{0.669762194f, 0.862980664f},
-std::array<float,2>{0.825046539f, 0.0639494658f},
-std::array<float,2>{0.0229091533f, 0.588089168f},
-std::array<float,2>{0.175659776f, 0.140850976f},
-std::array<float,2>{0.948369682f, 0.741047025f},
-std::array<float,2>{0.595949173f, 0.407887846f},
-std::array<float,2>{0.403374314f, 0.935931027f},
-std::array<float,2>{0.201059759f, 0.306591421f},
-std::array<float,2>{0.896309495f, 0.80694133f},
-std::array<float,2>{0.561508656f, 0.00372270774f},
-std::array<float,2>{0.486740142f, 0.534215152f},
-std::array<float,2>{0.340429157f, 0.219352931f},
-std::array<float,2>{0.698897719f, 0.67063868f},
-std::array<float,2>{0.795156837f, 0.471051365f},
-std::array<float,2>{0.0812546685f, 0.972455859f},
-std::array<float,2>{0.430618197f, 0.377040714f},
-std::array<float,2>{0.570959091f, 0.899605513f},
-std::array<float,2>{0.981737375f, 0.173938915f},
-std::array<float,2>{0.154564023f, 0.701687455f},
-std::array<float,2>{0.0593838692f, 0.114142373f},
-std::array<float,2>{0.865797222f, 0.607753754f},
-std::array<float,2>{0.640973568f, 0.333978385f},
-std::array<float,2>{0.290459812f, 0.831078708f},
-std::array<float,2>{0.134189159f, 0.43395552f},
-std::array<float,2>{0.999796033f, 0.916895986f},
-std::array<float,2>{0.584170759f, 0.128234193f},
-std::array<float,2>{0.414604902f, 0.733363271f},
-std::array<float,2>{0.300887316f, 0.0884349942f},
-std::array<float,2>{0.634227693f, 0.565656841f},
-std::array<float,2>{0.857586503f, 0.368029505f},
-std::array<float,2>{0.0326172784f, 0.845690668f},
-std::array<float,2>{0.477647245f, 0.25798887f},
-std::array<float,2>{0.536967158f, 0.775012493f},
-std::array<float,2>{0.886379123f, 0.0574237108f},
-std::array<float,2>{0.20376794f, 0.518567204f},
-std::array<float,2>{0.0680264533f, 0.18756038f},
-std::array<float,2>{0.805492342f, 0.631537616f},
-std::array<float,2>{0.717692256f, 0.457607538f},
-std::array<float,2>{0.316153377f, 0.952670097f},
-std::array<float,2>{0.00259213243f, 0.325709939f},
-std::array<float,2>{0.842507839f, 0.814023614f},
-std::array<float,2>{0.687167585f, 0.0969832689f},
-std::array<float,2>{0.256674498f, 0.621902823f},
-std::array<float,2>{0.381229043f, 0.157104164f},
-std::array<float,2>{0.614528298f, 0.717073143f},
-std::array<float,2>{0.954355657f, 0.405960292f},
-std::array<float,2>{0.16467911f, 0.880223274f},
-std::array<float,2>{0.369284213f, 0.498885095f},
-std::array<float,2>{0.737745523f, 0.988509953f},
-std::array<float,2>{0.753307223f, 0.248403907f},
-std::array<float,2>{0.0941942409f, 0.678928554f},
-std::array<float,2>{0.24097769f, 0.0249989331f},
-std::array<float,2>{0.907984257f, 0.557858109f},
-std::array<float,2>{0.527206123f, 0.283776939f},
-std::array<float,2>{0.439807743f, 0.789135635f},
-std::array<float,2>{0.0422526151f, 0.392082423f},
-std::array<float,2>{0.844455779f, 0.882868469f},
-std::array<float,2>{0.631616056f, 0.16778855f},
-std::array<float,2>{0.30870679f, 0.703539073f},
-std::array<float,2>{0.410589963f, 0.104614176f},
-std::array<float,2>{0.586293578f, 0.615186989f},
-std::array<float,2>{0.988668382f, 0.318516672f},
-std::array<float,2>{0.131323293f, 0.823007286f},
-std::array<float,2>{0.320963234f, 0.292328119f},
-std::array<float,2>{0.707898438f, 0.788172126f},
-std::array<float,2>{0.803189337f, 0.0162041262f},
-std::array<float,2>{0.0757365748f, 0.55433619f},
-std::array<float,2>{0.217178032f, 0.239533678f},
-std::array<float,2>{0.875187337f, 0.682005346f},
-std::array<float,2>{0.546736419f, 0.485226572f},
-std::array<float,2>{0.472332895f, 0.998488963f},
-std::array<float,2>{0.161683023f, 0.365737826f},
-std::array<float,2>{0.961625814f, 0.8521083f},
-std::array<float,2>{0.624281287f, 0.0827208757f},
-std::array<float,2>{0.384838313f, 0.5773018f},
-std::array<float,2>{0.258867919f, 0.134596407f},
-std::array<float,2>{0.673269928f, 0.722088456f},
-std::array<float,2>{0.834223986f, 0.428504884f},
-std::array<float,2>{0.00785302185f, 0.909450471f},
-std::array<float,2>{0.450755805f, 0.462056398f},
-std::array<float,2>{0.522928536f, 0.938325405f},
-std::array<float,2>{0.914107561f, 0.198760211f},
-std::array<float,2>{0.248225719f, 0.639390588f},
-std::array<float,2>{0.106100649f, 0.0506595001f},
-std::array<float,2>{0.764406621f, 0.526335061f},
-std::array<float,2>{0.744218528f, 0.256965995f},
-std::array<float,2>{0.36524415f, 0.769883692f},
-std::array<float,2>{0.232718661f, 0.479888707f},
-std::array<float,2>{0.927067637f, 0.976582825f},
-std::array<float,2>{0.500553668f, 0.228003517f},
-std::array<float,2>{0.463851422f, 0.660052121f},
-std::array<float,2>{0.346807152f, 0.0118942708f},
-std::array<float,2>{0.728006005f, 0.545238614f},
-std::array<float,2>{0.768619835f, 0.297260106f},
-std::array<float,2>{0.11660368f, 0.801519752f},
-std::array<float,2>{0.395418137f, 0.336225152f},
-std::array<float,2>{0.60662061f, 0.838339567f},
-std::array<float,2>{0.938060582f, 0.122245811f},
-std::array<float,2>{0.186572298f, 0.599446237f},
-std::array<float,2>{0.0260987636f, 0.18730031f},
-std::array<float,2>{0.818634748f, 0.694938242f},
-std::array<float,2>{0.658039153f, 0.388551235f},
-std::array<float,2>{0.26677981f, 0.897658646f},
-std::array<float,2>{0.0932015702f, 0.280190974f},
-std::array<float,2>{0.784253359f, 0.752188325f},
-std::array<float,2>{0.687774062f, 0.0319094136f},
-std::array<float,2>{0.329973966f, 0.508458436f},
-std::array<float,2>{0.49485141f, 0.216839328f},
-std::array<float,2>{0.553725541f, 0.643642724f},
-std::array<float,2>{0.900937021f, 0.445529044f},
-std::array<float,2>{0.193275034f, 0.968741179f},
-std::array<float,2>{0.286815196f, 0.421340108f},
-std::array<float,2>{0.653832436f, 0.928371787f},
-std::array<float,2>{0.874636292f, 0.154915601f},
-std::array<float,2>{0.0539316908f, 0.749207854f},
-std::array<float,2>{0.141020358f, 0.0731470287f},
-std::array<float,2>{0.973709166f, 0.578244805f},
-std::array<float,2>{0.564486265f, 0.353229403f},
-std::array<float,2>{0.421995729f, 0.869725943f},
-std::array<float,2>{0.0194539502f, 0.491094649f},
-std::array<float,2>{0.821363807f, 0.995748639f},
-std::array<float,2>{0.667410493f, 0.235049546f},
-std::array<float,2>{0.277178377f, 0.684244394f},
-std::array<float,2>{0.402016699f, 0.0202689003f},
-std::array<float,2>{0.60116142f, 0.550554156f},
-std::array<float,2>{0.95033139f, 0.294478595f},
-std::array<float,2>{0.178481996f, 0.782463789f},
-std::array<float,2>{0.358363092f, 0.314856529f},
-std::array<float,2>{0.724641621f, 0.827308834f},
-std::array<float,2>{0.775881171f, 0.105781741f},
-std::array<float,2>{0.124129519f, 0.610526145f},
-std::array<float,2>{0.226426914f, 0.170368642f},
-std::array<float,2>{0.934790134f, 0.707420528f},
-std::array<float,2>{0.508410454f, 0.39574334f},
-std::array<float,2>{0.460469782f, 0.887044966f},
-std::array<float,2>{0.148536652f, 0.25301525f},
-std::array<float,2>{0.979533434f, 0.766146541f},
-std::array<float,2>{0.577058315f, 0.0541092865f},
-std::array<float,2>{0.437066376f, 0.530116677f},
-std::array<float,2>{0.295986265f, 0.199450463f},
-std::array<float,2>{0.647934079f, 0.634024441f},
-std::array<float,2>{0.861409307f, 0.466995835f},
-std::array<float,2>{0.0563082583f, 0.941575289f},
-std::array<float,2>{0.491584152f, 0.42392388f},
-std::array<float,2>{0.556110144f, 0.911582053f},
-std::array<float,2>{0.893489897f, 0.139334425f},
-std::array<float,2>{0.198052585f, 0.724084973f},
-std::array<float,2>{0.0851415172f, 0.080843851f},
-std::array<float,2>{0.789728403f, 0.570390165f},
-std::array<float,2>{0.701883316f, 0.361437917f},
-std::array<float,2>{0.337013572f, 0.855674803f},
-std::array<float,2>{0.209471136f, 0.385174543f},
-std::array<float,2>{0.887397408f, 0.893053651f},
-std::array<float,2>{0.533296406f, 0.181849152f},
-std::array<float,2>{0.481557608f, 0.688891947f},
-std::array<float,2>{0.318680406f, 0.117871895f},
-std::array<float,2>{0.711290836f, 0.593812287f},
-std::array<float,2>{0.808968008f, 0.341979116f},
-std::array<float,2>{0.0662294328f, 0.840431213f},
-std::array<float,2>{0.42031309f, 0.303894043f},
-std::array<float,2>{0.581039488f, 0.800755262f},
-std::array<float,2>{0.993409991f, 0.0094551472f},
-std::array<float,2>{0.140329346f, 0.540963352f},
-std::array<float,2>{0.0387647003f, 0.233017445f},
-std::array<float,2>{0.85327059f, 0.662037373f},
-std::array<float,2>{0.639539123f, 0.484163523f},
-std::array<float,2>{0.29850319f, 0.982105911f},
-std::array<float,2>{0.099987708f, 0.357858449f},
-std::array<float,2>{0.757623792f, 0.871236622f},
-std::array<float,2>{0.739396334f, 0.0759602785f},
-std::array<float,2>{0.371963888f, 0.583940446f},
-std::array<float,2>{0.445254058f, 0.148887828f},
-std::array<float,2>{0.530405045f, 0.744203091f},
-std::array<float,2>{0.910236776f, 0.41746214f},
-std::array<float,2>{0.236556917f, 0.92269069f},
-std::array<float,2>{0.251768291f, 0.4508515f},
-std::array<float,2>{0.682935894f, 0.961180627f},
-std::array<float,2>{0.837896228f, 0.213399932f},
-std::array<float,2>{0.00599347241f, 0.647108972f},
-std::array<float,2>{0.170128778f, 0.0356911719f},
-std::array<float,2>{0.958250523f, 0.514346004f},
-std::array<float,2>{0.610484362f, 0.275293857f},
-std::array<float,2>{0.375871062f, 0.754729688f},
-std::array<float,2>{0.0733302385f, 0.412871152f},
-std::array<float,2>{0.798865438f, 0.930083692f},
-std::array<float,2>{0.703674257f, 0.146683916f},
-std::array<float,2>{0.326951057f, 0.736024797f},
-std::array<float,2>{0.472854108f, 0.067190513f},
-std::array<float,2>{0.540897429f, 0.591913581f},
-std::array<float,2>{0.880532384f, 0.350757211f},
-std::array<float,2>{0.212615833f, 0.864408493f},
-std::array<float,2>{0.304840922f, 0.268018663f},
-std::array<float,2>{0.628363073f, 0.758832097f},
-std::array<float,2>{0.849730909f, 0.0394619592f},
-std::array<float,2>{0.0454771519f, 0.506558657f},
-std::array<float,2>{0.128901511f, 0.203749269f},
-std::array<float,2>{0.985832691f, 0.655432343f},
-std::array<float,2>{0.590284169f, 0.441214114f},
-std::array<float,2>{0.409650415f, 0.958240926f},
-std::array<float,2>{0.244911224f, 0.331345975f},
-std::array<float,2>{0.91952908f, 0.835389674f},
-std::array<float,2>{0.51891619f, 0.110768363f},
-std::array<float,2>{0.44899258f, 0.603568435f},
-std::array<float,2>{0.360842705f, 0.179683551f},
-std::array<float,2>{0.748087406f, 0.698520839f},
-std::array<float,2>{0.75857228f, 0.380055815f},
-std::array<float,2>{0.103088424f, 0.904079854f},
-std::array<float,2>{0.386967391f, 0.474830538f},
-std::array<float,2>{0.619431496f, 0.974294662f},
-std::array<float,2>{0.967057407f, 0.224030167f},
-std::array<float,2>{0.159644365f, 0.665078819f},
-std::array<float,2>{0.0145972269f, 0.00466041081f},
-std::array<float,2>{0.828434527f, 0.537364662f},
-std::array<float,2>{0.677326679f, 0.309258163f},
-std::array<float,2>{0.265184373f, 0.809096932f},
-std::array<float,2>{0.183077618f, 0.456487358f},
-std::array<float,2>{0.943699718f, 0.9482705f},
-std::array<float,2>{0.602375746f, 0.194846183f},
-std::array<float,2>{0.39133656f, 0.62868762f},
-std::array<float,2>{0.271728337f, 0.0621410124f},
-std::array<float,2>{0.66212225f, 0.520636201f},
-std::array<float,2>{0.813936174f, 0.262680531f},
-std::array<float,2>{0.0310222991f, 0.77845335f},
-std::array<float,2>{0.46765244f, 0.37110424f},
-std::array<float,2>{0.506734788f, 0.851227343f},
-std::array<float,2>{0.925076246f, 0.0919800997f},
-std::array<float,2>{0.229122058f, 0.566657305f},
-std::array<float,2>{0.11105115f, 0.129176185f},
-std::array<float,2>{0.769770443f, 0.727902234f},
-std::array<float,2>{0.732660055f, 0.433375657f},
-std::array<float,2>{0.350037813f, 0.918027341f},
-std::array<float,2>{0.0482521839f, 0.28703025f},
-std::array<float,2>{0.867567778f, 0.795680642f},
-std::array<float,2>{0.651808679f, 0.0308381226f},
-std::array<float,2>{0.282639146f, 0.56092298f},
-std::array<float,2>{0.428405315f, 0.243337691f},
-std::array<float,2>{0.570284128f, 0.673758864f},
-std::array<float,2>{0.972245514f, 0.493767709f},
-std::array<float,2>{0.148104578f, 0.984790027f},
-std::array<float,2>{0.33276695f, 0.399466097f},
-std::array<float,2>{0.692124069f, 0.875566304f},
-std::array<float,2>{0.786166489f, 0.163190961f},
-std::array<float,2>{0.0875914693f, 0.712001979f},
-std::array<float,2>{0.190268427f, 0.0990419164f},
-std::array<float,2>{0.904346168f, 0.620345116f},
-std::array<float,2>{0.550036609f, 0.322435379f},
-std::array<float,2>{0.496621311f, 0.818745077f},
-std::array<float,2>{0.0691749975f, 0.458545685f},
-std::array<float,2>{0.8084535f, 0.952115774f},
-std::array<float,2>{0.716243982f, 0.189366877f},
-std::array<float,2>{0.312637687f, 0.632615805f},
-std::array<float,2>{0.478826731f, 0.0576248281f},
-std::array<float,2>{0.537390172f, 0.517924726f},
-std::array<float,2>{0.884209394f, 0.259510696f},
-std::array<float,2>{0.206410185f, 0.773763955f},
-std::array<float,2>{0.30464375f, 0.368724644f},
-std::array<float,2>{0.636367619f, 0.844720662f},
-std::array<float,2>{0.857382119f, 0.0896762609f},
-std::array<float,2>{0.0333218761f, 0.564564824f},
-std::array<float,2>{0.135290056f, 0.127786219f},
-std::array<float,2>{0.997140706f, 0.734055281f},
-std::array<float,2>{0.583825767f, 0.434682637f},
-std::array<float,2>{0.416905195f, 0.917187572f},
-std::array<float,2>{0.2394972f, 0.284772366f},
-std::array<float,2>{0.908991456f, 0.790733933f},
-std::array<float,2>{0.523857951f, 0.0235875957f},
-std::array<float,2>{0.437638342f, 0.556837499f},
-std::array<float,2>{0.368805856f, 0.24905777f},
-std::array<float,2>{0.736085773f, 0.677987337f},
-std::array<float,2>{0.751445353f, 0.499599665f},
-std::array<float,2>{0.0969766006f, 0.990131557f},
-std::array<float,2>{0.38005802f, 0.404543698f},
-std::array<float,2>{0.616129696f, 0.879801989f},
-std::array<float,2>{0.955272436f, 0.157335714f},
-std::array<float,2>{0.166813642f, 0.717826247f},
-std::array<float,2>{0.00104385102f, 0.0961619616f},
-std::array<float,2>{0.840471566f, 0.622834384f},
-std::array<float,2>{0.685061574f, 0.325104475f},
-std::array<float,2>{0.25453791f, 0.812884152f},
-std::array<float,2>{0.17292954f, 0.4065907f},
-std::array<float,2>{0.945978999f, 0.936663091f},
-std::array<float,2>{0.595105946f, 0.141655028f},
-std::array<float,2>{0.405901462f, 0.741323769f},
-std::array<float,2>{0.280425161f, 0.0632244796f},
-std::array<float,2>{0.671258807f, 0.589605927f},
-std::array<float,2>{0.826891124f, 0.34388873f},
-std::array<float,2>{0.0205351729f, 0.861662269f},
-std::array<float,2>{0.454095811f, 0.271372378f},
-std::array<float,2>{0.513421834f, 0.765379012f},
-std::array<float,2>{0.93248564f, 0.046688199f},
-std::array<float,2>{0.220016107f, 0.502076328f},
-std::array<float,2>{0.119957209f, 0.20776622f},
-std::array<float,2>{0.779835582f, 0.649379075f},
-std::array<float,2>{0.721798599f, 0.444424152f},
-std::array<float,2>{0.35156256f, 0.955486178f},
-std::array<float,2>{0.0614287145f, 0.332737803f},
-std::array<float,2>{0.864032865f, 0.830726326f},
-std::array<float,2>{0.643212438f, 0.114875086f},
-std::array<float,2>{0.292951494f, 0.608481348f},
-std::array<float,2>{0.433178276f, 0.175509736f},
-std::array<float,2>{0.573982596f, 0.702331662f},
-std::array<float,2>{0.983973324f, 0.378662795f},
-std::array<float,2>{0.154032469f, 0.898518503f},
-std::array<float,2>{0.342376202f, 0.472204506f},
-std::array<float,2>{0.696240842f, 0.971154809f},
-std::array<float,2>{0.793728113f, 0.220422164f},
-std::array<float,2>{0.0787134022f, 0.671667874f},
-std::array<float,2>{0.202106148f, 0.00267126272f},
-std::array<float,2>{0.898247421f, 0.534162283f},
-std::array<float,2>{0.558991134f, 0.305413723f},
-std::array<float,2>{0.485311419f, 0.807757258f},
-std::array<float,2>{0.0240412708f, 0.3874138f},
-std::array<float,2>{0.817641616f, 0.896852434f},
-std::array<float,2>{0.659167111f, 0.186496362f},
-std::array<float,2>{0.268578023f, 0.694046259f},
-std::array<float,2>{0.396656573f, 0.121637233f},
-std::array<float,2>{0.60810411f, 0.598467886f},
-std::array<float,2>{0.940259635f, 0.337146401f},
-std::array<float,2>{0.185386375f, 0.839512885f},
-std::array<float,2>{0.343869805f, 0.298681885f},
-std::array<float,2>{0.73010695f, 0.802017093f},
-std::array<float,2>{0.765980542f, 0.0133088324f},
-std::array<float,2>{0.114100099f, 0.546071827f},
-std::array<float,2>{0.231052101f, 0.226623029f},
-std::array<float,2>{0.92897588f, 0.659012198f},
-std::array<float,2>{0.502856672f, 0.47899884f},
-std::array<float,2>{0.46220687f, 0.977984488f},
-std::array<float,2>{0.142685935f, 0.351929605f},
-std::array<float,2>{0.975560009f, 0.870773017f},
-std::array<float,2>{0.563319147f, 0.0740892217f},
-std::array<float,2>{0.425671875f, 0.580056071f},
-std::array<float,2>{0.28754583f, 0.155375898f},
-std::array<float,2>{0.655518651f, 0.74822104f},
-std::array<float,2>{0.872107983f, 0.420784473f},
-std::array<float,2>{0.0516360514f, 0.929395974f},
-std::array<float,2>{0.49336645f, 0.446420193f},
-std::array<float,2>{0.552079141f, 0.967042744f},
-std::array<float,2>{0.898872852f, 0.217900157f},
-std::array<float,2>{0.194548801f, 0.642737687f},
-std::array<float,2>{0.0911529735f, 0.0324219055f},
-std::array<float,2>{0.781877995f, 0.50942868f},
-std::array<float,2>{0.691385806f, 0.280712306f},
-std::array<float,2>{0.331716299f, 0.753674209f},
-std::array<float,2>{0.216541678f, 0.485459656f},
-std::array<float,2>{0.878000081f, 0.999637544f},
-std::array<float,2>{0.543759882f, 0.238698334f},
-std::array<float,2>{0.470283151f, 0.683578908f},
-std::array<float,2>{0.322691411f, 0.0173115656f},
-std::array<float,2>{0.709757507f, 0.553089619f},
-std::array<float,2>{0.801266968f, 0.291144937f},
-std::array<float,2>{0.0765457749f, 0.78713119f},
-std::array<float,2>{0.412197948f, 0.319927514f},
-std::array<float,2>{0.588945508f, 0.823828876f},
-std::array<float,2>{0.992168844f, 0.10425169f},
-std::array<float,2>{0.130609855f, 0.61397177f},
-std::array<float,2>{0.0407915935f, 0.166789591f},
-std::array<float,2>{0.847308636f, 0.704315424f},
-std::array<float,2>{0.629383147f, 0.391220123f},
-std::array<float,2>{0.310872674f, 0.884656489f},
-std::array<float,2>{0.107919663f, 0.256246358f},
-std::array<float,2>{0.76246804f, 0.770654082f},
-std::array<float,2>{0.743522644f, 0.0494606122f},
-std::array<float,2>{0.365054697f, 0.527125239f},
-std::array<float,2>{0.451977074f, 0.197538108f},
-std::array<float,2>{0.519977629f, 0.639946103f},
-std::array<float,2>{0.917613804f, 0.461249828f},
-std::array<float,2>{0.247493684f, 0.938542902f},
-std::array<float,2>{0.25989303f, 0.429135114f},
-std::array<float,2>{0.67383033f, 0.908871293f},
-std::array<float,2>{0.83351171f, 0.133542269f},
-std::array<float,2>{0.0103226556f, 0.720972776f},
-std::array<float,2>{0.163981989f, 0.0831481144f},
-std::array<float,2>{0.964701533f, 0.576485515f},
-std::array<float,2>{0.62152791f, 0.366727978f},
-std::array<float,2>{0.383538514f, 0.852903843f},
-std::array<float,2>{0.0359965451f, 0.483247548f},
-std::array<float,2>{0.855360091f, 0.981298447f},
-std::array<float,2>{0.637066126f, 0.233953461f},
-std::array<float,2>{0.299313992f, 0.660400689f},
-std::array<float,2>{0.418388009f, 0.00819281954f},
-std::array<float,2>{0.57833308f, 0.539470196f},
-std::array<float,2>{0.995347798f, 0.303709358f},
-std::array<float,2>{0.137385353f, 0.799202502f},
-std::array<float,2>{0.318044931f, 0.343167663f},
-std::array<float,2>{0.71323812f, 0.840874612f},
-std::array<float,2>{0.811176658f, 0.118345588f},
-std::array<float,2>{0.0631489232f, 0.595671237f},
-std::array<float,2>{0.207725763f, 0.183093905f},
-std::array<float,2>{0.890546322f, 0.687819302f},
-std::array<float,2>{0.531724155f, 0.386621326f},
-std::array<float,2>{0.484195113f, 0.894355893f},
-std::array<float,2>{0.168942541f, 0.274314702f},
-std::array<float,2>{0.960381091f, 0.755061388f},
-std::array<float,2>{0.612338245f, 0.0369978733f},
-std::array<float,2>{0.37850976f, 0.514914095f},
-std::array<float,2>{0.252071053f, 0.214737698f},
-std::array<float,2>{0.680722833f, 0.648434639f},
-std::array<float,2>{0.835959792f, 0.449465245f},
-std::array<float,2>{0.0051325215f, 0.961990952f},
-std::array<float,2>{0.441990614f, 0.416481733f},
-std::array<float,2>{0.527686536f, 0.922952294f},
-std::array<float,2>{0.913419843f, 0.149880111f},
-std::array<float,2>{0.235516801f, 0.7456671f},
-std::array<float,2>{0.0991438627f, 0.0750677213f},
-std::array<float,2>{0.755758703f, 0.58220011f},
-std::array<float,2>{0.741166055f, 0.359180152f},
-std::array<float,2>{0.374763876f, 0.872729123f},
-std::array<float,2>{0.22283268f, 0.39539212f},
-std::array<float,2>{0.936895788f, 0.888041675f},
-std::array<float,2>{0.509802461f, 0.171837345f},
-std::array<float,2>{0.458946168f, 0.708297133f},
-std::array<float,2>{0.356534094f, 0.10653539f},
-std::array<float,2>{0.724302113f, 0.610050142f},
-std::array<float,2>{0.773804128f, 0.316097647f},
-std::array<float,2>{0.121991724f, 0.826524615f},
-std::array<float,2>{0.398807049f, 0.293108106f},
-std::array<float,2>{0.599239469f, 0.781466603f},
-std::array<float,2>{0.95241487f, 0.0213600714f},
-std::array<float,2>{0.177210122f, 0.548875809f},
-std::array<float,2>{0.0162468646f, 0.235475391f},
-std::array<float,2>{0.82330972f, 0.685393393f},
-std::array<float,2>{0.664869666f, 0.491627514f},
-std::array<float,2>{0.273743808f, 0.994275093f},
-std::array<float,2>{0.0825949758f, 0.363037556f},
-std::array<float,2>{0.792350411f, 0.856733739f},
-std::array<float,2>{0.699863732f, 0.0816548988f},
-std::array<float,2>{0.339727759f, 0.571342587f},
-std::array<float,2>{0.488860071f, 0.140137121f},
-std::array<float,2>{0.558320165f, 0.722827852f},
-std::array<float,2>{0.891768813f, 0.425127238f},
-std::array<float,2>{0.196936443f, 0.910211146f},
-std::array<float,2>{0.293787152f, 0.468033314f},
-std::array<float,2>{0.645417333f, 0.94258517f},
-std::array<float,2>{0.860708177f, 0.200592935f},
-std::array<float,2>{0.0573353097f, 0.633729517f},
-std::array<float,2>{0.151621893f, 0.0530227311f},
-std::array<float,2>{0.978181541f, 0.530954897f},
-std::array<float,2>{0.574392498f, 0.252521873f},
-std::array<float,2>{0.433648437f, 0.767521441f},
-std::array<float,2>{0.111998521f, 0.432516724f},
-std::array<float,2>{0.772296548f, 0.919408381f},
-std::array<float,2>{0.731169224f, 0.13026458f},
-std::array<float,2>{0.349536151f, 0.727220356f},
-std::array<float,2>{0.465611428f, 0.0929027274f},
-std::array<float,2>{0.50484705f, 0.56759876f},
-std::array<float,2>{0.922759533f, 0.372340024f},
-std::array<float,2>{0.227041796f, 0.849910736f},
-std::array<float,2>{0.270819366f, 0.263501406f},
-std::array<float,2>{0.661027074f, 0.778289557f},
-std::array<float,2>{0.815730929f, 0.0607284345f},
-std::array<float,2>{0.0275638737f, 0.519631863f},
-std::array<float,2>{0.181233644f, 0.194327772f},
-std::array<float,2>{0.942840219f, 0.627373576f},
-std::array<float,2>{0.604609966f, 0.455531269f},
-std::array<float,2>{0.392857999f, 0.948213339f},
-std::array<float,2>{0.188660428f, 0.323389828f},
-std::array<float,2>{0.904000819f, 0.820158184f},
-std::array<float,2>{0.548416495f, 0.0984399617f},
-std::array<float,2>{0.499744117f, 0.619951069f},
-std::array<float,2>{0.33440882f, 0.162691161f},
-std::array<float,2>{0.694655597f, 0.711513698f},
-std::array<float,2>{0.788155258f, 0.399152577f},
-std::array<float,2>{0.0897635147f, 0.87688756f},
-std::array<float,2>{0.427473277f, 0.492606938f},
-std::array<float,2>{0.566830814f, 0.986189187f},
-std::array<float,2>{0.969569921f, 0.242193609f},
-std::array<float,2>{0.144565403f, 0.67227906f},
-std::array<float,2>{0.0489712059f, 0.0294124838f},
-std::array<float,2>{0.870203614f, 0.561584592f},
-std::array<float,2>{0.650250316f, 0.285177469f},
-std::array<float,2>{0.283252954f, 0.796665907f},
-std::array<float,2>{0.125337183f, 0.440180838f},
-std::array<float,2>{0.987332404f, 0.957279146f},
-std::array<float,2>{0.593678057f, 0.20469372f},
-std::array<float,2>{0.407463431f, 0.654895842f},
-std::array<float,2>{0.308558971f, 0.0402112678f},
-std::array<float,2>{0.625411987f, 0.50711894f},
-std::array<float,2>{0.848399997f, 0.268847108f},
-std::array<float,2>{0.0444656499f, 0.75848937f},
-std::array<float,2>{0.475726575f, 0.350454211f},
-std::array<float,2>{0.541738153f, 0.864186883f},
-std::array<float,2>{0.882170439f, 0.0682188496f},
-std::array<float,2>{0.213993058f, 0.592930198f},
-std::array<float,2>{0.0717772394f, 0.147541121f},
-std::array<float,2>{0.798763573f, 0.735196829f},
-std::array<float,2>{0.706635237f, 0.413881272f},
-std::array<float,2>{0.324963838f, 0.931323051f},
-std::array<float,2>{0.0120742312f, 0.310063243f},
-std::array<float,2>{0.831493258f, 0.810190976f},
-std::array<float,2>{0.678473115f, 0.00542726275f},
-std::array<float,2>{0.262969583f, 0.538898826f},
-std::array<float,2>{0.390353322f, 0.222843111f},
-std::array<float,2>{0.618063033f, 0.664386332f},
-std::array<float,2>{0.965353668f, 0.476398766f},
-std::array<float,2>{0.156761363f, 0.973631501f},
-std::array<float,2>{0.362916052f, 0.379816264f},
-std::array<float,2>{0.747507811f, 0.902617991f},
-std::array<float,2>{0.761110425f, 0.178631902f},
-std::array<float,2>{0.105242468f, 0.698199868f},
-std::array<float,2>{0.243658945f, 0.109641753f},
-std::array<float,2>{0.9212479f, 0.604957163f},
-std::array<float,2>{0.517276525f, 0.33053571f},
-std::array<float,2>{0.446162581f, 0.834170759f},
-std::array<float,2>{0.0952478349f, 0.497889906f},
-std::array<float,2>{0.752487957f, 0.991323531f},
-std::array<float,2>{0.736884892f, 0.247610554f},
-std::array<float,2>{0.370959729f, 0.677733719f},
-std::array<float,2>{0.441110969f, 0.0272762105f},
-std::array<float,2>{0.525874197f, 0.555641949f},
-std::array<float,2>{0.906642079f, 0.282732546f},
-std::array<float,2>{0.241346449f, 0.792439282f},
-std::array<float,2>{0.257330209f, 0.326445729f},
-std::array<float,2>{0.685762405f, 0.814751863f},
-std::array<float,2>{0.84298557f, 0.0950544029f},
-std::array<float,2>{0.00322373817f, 0.624405086f},
-std::array<float,2>{0.165619791f, 0.15826498f},
-std::array<float,2>{0.953728795f, 0.71667546f},
-std::array<float,2>{0.613785565f, 0.402524233f},
-std::array<float,2>{0.3826873f, 0.881658435f},
-std::array<float,2>{0.204821706f, 0.260022789f},
-std::array<float,2>{0.884971559f, 0.775582135f},
-std::array<float,2>{0.535624623f, 0.0562058389f},
-std::array<float,2>{0.476592481f, 0.517242491f},
-std::array<float,2>{0.31540373f, 0.190665871f},
-std::array<float,2>{0.718597174f, 0.629680276f},
-std::array<float,2>{0.806592405f, 0.459513932f},
-std::array<float,2>{0.0672437102f, 0.951163709f},
-std::array<float,2>{0.415539294f, 0.436082423f},
-std::array<float,2>{0.58520025f, 0.915097237f},
-std::array<float,2>{0.998132408f, 0.126377091f},
-std::array<float,2>{0.132998556f, 0.730572879f},
-std::array<float,2>{0.032067582f, 0.0873357579f},
-std::array<float,2>{0.859223783f, 0.563468397f},
-std::array<float,2>{0.633666635f, 0.371054083f},
-std::array<float,2>{0.301840484f, 0.846316457f},
-std::array<float,2>{0.155349135f, 0.376835287f},
-std::array<float,2>{0.980701864f, 0.901694119f},
-std::array<float,2>{0.571985304f, 0.1728089f},
-std::array<float,2>{0.431554317f, 0.699423552f},
-std::array<float,2>{0.289189905f, 0.115609773f},
-std::array<float,2>{0.642506123f, 0.606039464f},
-std::array<float,2>{0.866604149f, 0.335839331f},
-std::array<float,2>{0.0595920011f, 0.828637719f},
-std::array<float,2>{0.487638921f, 0.308070034f},
-std::array<float,2>{0.561959505f, 0.805473506f},
-std::array<float,2>{0.895130336f, 0.000876517734f},
-std::array<float,2>{0.199994043f, 0.532974362f},
-std::array<float,2>{0.080269292f, 0.221561372f},
-std::array<float,2>{0.796785951f, 0.668530822f},
-std::array<float,2>{0.697616041f, 0.470195711f},
-std::array<float,2>{0.34147042f, 0.969802797f},
-std::array<float,2>{0.0218085703f, 0.34622395f},
-std::array<float,2>{0.825600803f, 0.860746801f},
-std::array<float,2>{0.668180645f, 0.0648984909f},
-std::array<float,2>{0.279284328f, 0.586156547f},
-std::array<float,2>{0.402851522f, 0.143554121f},
-std::array<float,2>{0.597412109f, 0.738353789f},
-std::array<float,2>{0.947426915f, 0.408279747f},
-std::array<float,2>{0.174041659f, 0.933665633f},
-std::array<float,2>{0.354964882f, 0.442014635f},
-std::array<float,2>{0.719750822f, 0.954100072f},
-std::array<float,2>{0.777925491f, 0.20993638f},
-std::array<float,2>{0.11822132f, 0.651539743f},
-std::array<float,2>{0.221985087f, 0.0445328094f},
-std::array<float,2>{0.929941654f, 0.50153023f},
-std::array<float,2>{0.515521169f, 0.273354024f},
-std::array<float,2>{0.455410123f, 0.762995481f},
-std::array<float,2>{0.0535402521f, 0.418728024f},
-std::array<float,2>{0.873960555f, 0.926436543f},
-std::array<float,2>{0.653121293f, 0.152624011f},
-std::array<float,2>{0.285873413f, 0.747843146f},
-std::array<float,2>{0.423352093f, 0.0717119575f},
-std::array<float,2>{0.56594491f, 0.581576943f},
-std::array<float,2>{0.97357142f, 0.353751451f},
-std::array<float,2>{0.142017648f, 0.867734253f},
-std::array<float,2>{0.328300267f, 0.278009295f},
-std::array<float,2>{0.688841879f, 0.750855923f},
-std::array<float,2>{0.783933282f, 0.034905348f},
-std::array<float,2>{0.0925953686f, 0.510152221f},
-std::array<float,2>{0.191807643f, 0.216529265f},
-std::array<float,2>{0.902064025f, 0.64175427f},
-std::array<float,2>{0.553643227f, 0.449181825f},
-std::array<float,2>{0.495724201f, 0.966400027f},
-std::array<float,2>{0.18582423f, 0.33895883f},
-std::array<float,2>{0.938926995f, 0.836465478f},
-std::array<float,2>{0.606344879f, 0.124444686f},
-std::array<float,2>{0.395806044f, 0.60000962f},
-std::array<float,2>{0.266181946f, 0.184950843f},
-std::array<float,2>{0.656563938f, 0.692425311f},
-std::array<float,2>{0.819347739f, 0.39055863f},
-std::array<float,2>{0.0270355102f, 0.895490825f},
-std::array<float,2>{0.464730769f, 0.477043688f},
-std::array<float,2>{0.501116335f, 0.978594422f},
-std::array<float,2>{0.926000774f, 0.230229899f},
-std::array<float,2>{0.234020934f, 0.657593966f},
-std::array<float,2>{0.115501978f, 0.0153361475f},
-std::array<float,2>{0.768008292f, 0.543808341f},
-std::array<float,2>{0.727522016f, 0.298932195f},
-std::array<float,2>{0.346650004f, 0.804085195f},
-std::array<float,2>{0.249073938f, 0.463436276f},
-std::array<float,2>{0.915216625f, 0.939701855f},
-std::array<float,2>{0.522279143f, 0.196200177f},
-std::array<float,2>{0.44926995f, 0.638536096f},
-std::array<float,2>{0.366303563f, 0.0478465781f},
-std::array<float,2>{0.745924473f, 0.524173439f},
-std::array<float,2>{0.764946282f, 0.255260408f},
-std::array<float,2>{0.106653541f, 0.771547675f},
-std::array<float,2>{0.386213154f, 0.36464256f},
-std::array<float,2>{0.623588383f, 0.854031742f},
-std::array<float,2>{0.962177813f, 0.0852547884f},
-std::array<float,2>{0.160845906f, 0.575368524f},
-std::array<float,2>{0.00943322573f, 0.135168001f},
-std::array<float,2>{0.835649967f, 0.718802691f},
-std::array<float,2>{0.672042847f, 0.427029103f},
-std::array<float,2>{0.258617729f, 0.906814337f},
-std::array<float,2>{0.0743094534f, 0.290247679f},
-std::array<float,2>{0.804040849f, 0.786205232f},
-std::array<float,2>{0.708243012f, 0.0185651798f},
-std::array<float,2>{0.321562439f, 0.551379442f},
-std::array<float,2>{0.470742136f, 0.241789266f},
-std::array<float,2>{0.545108616f, 0.680885315f},
-std::array<float,2>{0.876532495f, 0.487433404f},
-std::array<float,2>{0.218443975f, 0.997240067f},
-std::array<float,2>{0.3096371f, 0.393574804f},
-std::array<float,2>{0.631967306f, 0.885163546f},
-std::array<float,2>{0.844852567f, 0.164205208f},
-std::array<float,2>{0.0410636626f, 0.705144227f},
-std::array<float,2>{0.131998897f, 0.102878429f},
-std::array<float,2>{0.989300609f, 0.616239667f},
-std::array<float,2>{0.587308407f, 0.317081094f},
-std::array<float,2>{0.411194265f, 0.821439564f},
-std::array<float,2>{0.00731175393f, 0.452053994f},
-std::array<float,2>{0.839717329f, 0.964610219f},
-std::array<float,2>{0.682235301f, 0.211866125f},
-std::array<float,2>{0.250307918f, 0.644565463f},
-std::array<float,2>{0.376953065f, 0.0388822816f},
-std::array<float,2>{0.610198915f, 0.513190866f},
-std::array<float,2>{0.957783461f, 0.2766518f},
-std::array<float,2>{0.171416089f, 0.756949067f},
-std::array<float,2>{0.373025119f, 0.356798589f},
-std::array<float,2>{0.739053905f, 0.87403208f},
-std::array<float,2>{0.756698608f, 0.0768928379f},
-std::array<float,2>{0.101495594f, 0.584770083f},
-std::array<float,2>{0.238064229f, 0.15134199f},
-std::array<float,2>{0.911735415f, 0.743663728f},
-std::array<float,2>{0.530266941f, 0.415889204f},
-std::array<float,2>{0.443880022f, 0.925111294f},
-std::array<float,2>{0.139641136f, 0.301615924f},
-std::array<float,2>{0.992940187f, 0.797799826f},
-std::array<float,2>{0.581793725f, 0.0105976695f},
-std::array<float,2>{0.42127493f, 0.542771101f},
-std::array<float,2>{0.297636241f, 0.232322037f},
-std::array<float,2>{0.640510559f, 0.664013088f},
-std::array<float,2>{0.851674438f, 0.480496973f},
-std::array<float,2>{0.0373976938f, 0.983926117f},
-std::array<float,2>{0.481077373f, 0.383406281f},
-std::array<float,2>{0.534918547f, 0.891125262f},
-std::array<float,2>{0.888268948f, 0.180428177f},
-std::array<float,2>{0.210051686f, 0.690951824f},
-std::array<float,2>{0.0650884435f, 0.120303288f},
-std::array<float,2>{0.809926093f, 0.595886409f},
-std::array<float,2>{0.712743521f, 0.340012461f},
-std::array<float,2>{0.319631487f, 0.843687832f},
-std::array<float,2>{0.198873833f, 0.423429817f},
-std::array<float,2>{0.894277096f, 0.912593424f},
-std::array<float,2>{0.555623055f, 0.137316182f},
-std::array<float,2>{0.490647912f, 0.725835443f},
-std::array<float,2>{0.336488634f, 0.0787022263f},
-std::array<float,2>{0.702944219f, 0.573214769f},
-std::array<float,2>{0.79036957f, 0.361155123f},
-std::array<float,2>{0.0843610093f, 0.857458651f},
-std::array<float,2>{0.435820639f, 0.250759363f},
-std::array<float,2>{0.577391565f, 0.768043876f},
-std::array<float,2>{0.97943151f, 0.051680427f},
-std::array<float,2>{0.150266632f, 0.52927494f},
-std::array<float,2>{0.0551450066f, 0.203028366f},
-std::array<float,2>{0.862808287f, 0.63580364f},
-std::array<float,2>{0.646899104f, 0.466762215f},
-std::array<float,2>{0.295458496f, 0.94495219f},
-std::array<float,2>{0.123789005f, 0.313494563f},
-std::array<float,2>{0.776877761f, 0.825260043f},
-std::array<float,2>{0.725821853f, 0.108546779f},
-std::array<float,2>{0.358851194f, 0.611774743f},
-std::array<float,2>{0.459191799f, 0.169132844f},
-std::array<float,2>{0.509240866f, 0.710274398f},
-std::array<float,2>{0.933732212f, 0.397308767f},
-std::array<float,2>{0.225363463f, 0.890138209f},
-std::array<float,2>{0.275412321f, 0.488741755f},
-std::array<float,2>{0.666651785f, 0.993431747f},
-std::array<float,2>{0.820548952f, 0.238179445f},
-std::array<float,2>{0.0180610679f, 0.6867342f},
-std::array<float,2>{0.179047123f, 0.0219235606f},
-std::array<float,2>{0.950187266f, 0.548036098f},
-std::array<float,2>{0.600464284f, 0.295264572f},
-std::array<float,2>{0.400796115f, 0.783364356f},
-std::array<float,2>{0.0862158984f, 0.400584161f},
-std::array<float,2>{0.785330474f, 0.878171682f},
-std::array<float,2>{0.692403316f, 0.161086932f},
-std::array<float,2>{0.333346128f, 0.714660048f},
-std::array<float,2>{0.497483641f, 0.0997599959f},
-std::array<float,2>{0.549293876f, 0.618629336f},
-std::array<float,2>{0.905564189f, 0.321703225f},
-std::array<float,2>{0.191069186f, 0.817550123f},
-std::array<float,2>{0.281374127f, 0.288897008f},
-std::array<float,2>{0.650679111f, 0.792970419f},
-std::array<float,2>{0.868468165f, 0.0274933558f},
-std::array<float,2>{0.0471433252f, 0.560495496f},
-std::array<float,2>{0.146641478f, 0.24458845f},
-std::array<float,2>{0.970707476f, 0.674770057f},
-std::array<float,2>{0.569028676f, 0.494204193f},
-std::array<float,2>{0.429390252f, 0.988198042f},
-std::array<float,2>{0.230239317f, 0.374515146f},
-std::array<float,2>{0.923989475f, 0.848875284f},
-std::array<float,2>{0.507729411f, 0.0902969316f},
-std::array<float,2>{0.468187988f, 0.568785608f},
-std::array<float,2>{0.350983977f, 0.131390527f},
-std::array<float,2>{0.73382467f, 0.730033278f},
-std::array<float,2>{0.770952702f, 0.431298405f},
-std::array<float,2>{0.109884992f, 0.920515835f},
-std::array<float,2>{0.392074466f, 0.454792172f},
-std::array<float,2>{0.602928996f, 0.945897579f},
-std::array<float,2>{0.944648564f, 0.192343831f},
-std::array<float,2>{0.181981593f, 0.625556827f},
-std::array<float,2>{0.0302634407f, 0.0594044738f},
-std::array<float,2>{0.813400924f, 0.522212982f},
-std::array<float,2>{0.66318512f, 0.26442939f},
-std::array<float,2>{0.273102582f, 0.780361295f},
-std::array<float,2>{0.158769384f, 0.473416388f},
-std::array<float,2>{0.968402803f, 0.974668562f},
-std::array<float,2>{0.620198727f, 0.225528494f},
-std::array<float,2>{0.38800773f, 0.666385949f},
-std::array<float,2>{0.264572173f, 0.00637050858f},
-std::array<float,2>{0.676568389f, 0.535855114f},
-std::array<float,2>{0.829569399f, 0.312145501f},
-std::array<float,2>{0.0147698941f, 0.811924636f},
-std::array<float,2>{0.447654217f, 0.328579724f},
-std::array<float,2>{0.5176121f, 0.832905889f},
-std::array<float,2>{0.918737352f, 0.111915357f},
-std::array<float,2>{0.245799482f, 0.602140784f},
-std::array<float,2>{0.102221072f, 0.176748306f},
-std::array<float,2>{0.759247601f, 0.69668901f},
-std::array<float,2>{0.749825895f, 0.381900251f},
-std::array<float,2>{0.359947354f, 0.904851079f},
-std::array<float,2>{0.0464314334f, 0.266238987f},
-std::array<float,2>{0.850822985f, 0.760917842f},
-std::array<float,2>{0.627075672f, 0.0419557318f},
-std::array<float,2>{0.306421131f, 0.505463243f},
-std::array<float,2>{0.409166932f, 0.206682146f},
-std::array<float,2>{0.591146886f, 0.653422058f},
-std::array<float,2>{0.985053837f, 0.437725544f},
-std::array<float,2>{0.127467453f, 0.960784853f},
-std::array<float,2>{0.327656895f, 0.41150856f},
-std::array<float,2>{0.704881132f, 0.933251321f},
-std::array<float,2>{0.799944997f, 0.146088749f},
-std::array<float,2>{0.0727954656f, 0.737853944f},
-std::array<float,2>{0.211335078f, 0.0690013915f},
-std::array<float,2>{0.879558206f, 0.591771722f},
-std::array<float,2>{0.539919674f, 0.348210156f},
-std::array<float,2>{0.474261761f, 0.866847157f},
-std::array<float,2>{0.0770606995f, 0.487827778f},
-std::array<float,2>{0.801753938f, 0.997614026f},
-std::array<float,2>{0.70945847f, 0.241369337f},
-std::array<float,2>{0.322876006f, 0.681313097f},
-std::array<float,2>{0.469933301f, 0.0192187298f},
-std::array<float,2>{0.543255448f, 0.550987005f},
-std::array<float,2>{0.878872633f, 0.290529281f},
-std::array<float,2>{0.216162845f, 0.786735833f},
-std::array<float,2>{0.311475426f, 0.316835791f},
-std::array<float,2>{0.629847884f, 0.822115898f},
-std::array<float,2>{0.846934795f, 0.103268377f},
-std::array<float,2>{0.0401447751f, 0.617044747f},
-std::array<float,2>{0.130016848f, 0.164650545f},
-std::array<float,2>{0.991494358f, 0.706053078f},
-std::array<float,2>{0.589494586f, 0.39433974f},
-std::array<float,2>{0.4129439f, 0.885290742f},
-std::array<float,2>{0.247615546f, 0.255809754f},
-std::array<float,2>{0.917318225f, 0.772280514f},
-std::array<float,2>{0.520481169f, 0.0471182503f},
-std::array<float,2>{0.451426923f, 0.52354753f},
-std::array<float,2>{0.364502639f, 0.195663005f},
-std::array<float,2>{0.743952811f, 0.637896895f},
-std::array<float,2>{0.76173228f, 0.463217199f},
-std::array<float,2>{0.107571088f, 0.940368354f},
-std::array<float,2>{0.382907599f, 0.427452117f},
-std::array<float,2>{0.621985078f, 0.906293929f},
-std::array<float,2>{0.964254439f, 0.135589704f},
-std::array<float,2>{0.16328837f, 0.719604492f},
-std::array<float,2>{0.0102234902f, 0.0859069526f},
-std::array<float,2>{0.833267748f, 0.575736642f},
-std::array<float,2>{0.67434442f, 0.36501348f},
-std::array<float,2>{0.260297984f, 0.853600144f},
-std::array<float,2>{0.184952244f, 0.389929116f},
-std::array<float,2>{0.939499557f, 0.894782901f},
-std::array<float,2>{0.607666373f, 0.18531464f},
-std::array<float,2>{0.397122025f, 0.692933738f},
-std::array<float,2>{0.269525379f, 0.124733135f},
-std::array<float,2>{0.658225298f, 0.60022819f},
-std::array<float,2>{0.818150222f, 0.339417517f},
-std::array<float,2>{0.0236748569f, 0.836418927f},
-std::array<float,2>{0.462446749f, 0.2993792f},
-std::array<float,2>{0.502369523f, 0.804502785f},
-std::array<float,2>{0.929473877f, 0.0149831213f},
-std::array<float,2>{0.230585992f, 0.543331921f},
-std::array<float,2>{0.113608427f, 0.22989127f},
-std::array<float,2>{0.766383648f, 0.658155084f},
-std::array<float,2>{0.729734063f, 0.477502823f},
-std::array<float,2>{0.344257087f, 0.979268551f},
-std::array<float,2>{0.0509218425f, 0.354237527f},
-std::array<float,2>{0.872905552f, 0.867278278f},
-std::array<float,2>{0.655932724f, 0.0717789531f},
-std::array<float,2>{0.287680984f, 0.581146479f},
-std::array<float,2>{0.425167531f, 0.153088272f},
-std::array<float,2>{0.562678695f, 0.747526169f},
-std::array<float,2>{0.974826157f, 0.41802907f},
-std::array<float,2>{0.143413693f, 0.92607969f},
-std::array<float,2>{0.331394643f, 0.448651165f},
-std::array<float,2>{0.690810919f, 0.96601671f},
-std::array<float,2>{0.781476557f, 0.215832278f},
-std::array<float,2>{0.0915065035f, 0.642131448f},
-std::array<float,2>{0.194893375f, 0.0344770551f},
-std::array<float,2>{0.899143875f, 0.510667086f},
-std::array<float,2>{0.552704632f, 0.277534932f},
-std::array<float,2>{0.493911594f, 0.750092506f},
-std::array<float,2>{0.0212296266f, 0.409117341f},
-std::array<float,2>{0.826472223f, 0.934438765f},
-std::array<float,2>{0.671493292f, 0.143011212f},
-std::array<float,2>{0.280970126f, 0.73904568f},
-std::array<float,2>{0.405484408f, 0.0654127374f},
-std::array<float,2>{0.595578134f, 0.586432099f},
-std::array<float,2>{0.945607483f, 0.34606719f},
-std::array<float,2>{0.173701346f, 0.861150026f},
-std::array<float,2>{0.352360189f, 0.272498012f},
-std::array<float,2>{0.722651064f, 0.763511598f},
-std::array<float,2>{0.779518664f, 0.0442837477f},
-std::array<float,2>{0.119241685f, 0.501176238f},
-std::array<float,2>{0.220569462f, 0.209076852f},
-std::array<float,2>{0.932087183f, 0.652032137f},
-std::array<float,2>{0.512726068f, 0.441576481f},
-std::array<float,2>{0.45359984f, 0.953402698f},
-std::array<float,2>{0.15370512f, 0.335171819f},
-std::array<float,2>{0.983762383f, 0.828594089f},
-std::array<float,2>{0.573294342f, 0.116021261f},
-std::array<float,2>{0.432773948f, 0.60549897f},
-std::array<float,2>{0.29213956f, 0.172104567f},
-std::array<float,2>{0.642585635f, 0.700112104f},
-std::array<float,2>{0.863584995f, 0.3762348f},
-std::array<float,2>{0.0607921965f, 0.90188849f},
-std::array<float,2>{0.484570682f, 0.47052592f},
-std::array<float,2>{0.559165299f, 0.970302522f},
-std::array<float,2>{0.897629201f, 0.221077129f},
-std::array<float,2>{0.201235384f, 0.668384969f},
-std::array<float,2>{0.0781750455f, 0.000101257559f},
-std::array<float,2>{0.793364227f, 0.532330573f},
-std::array<float,2>{0.695456564f, 0.308511257f},
-std::array<float,2>{0.341808289f, 0.804802716f},
-std::array<float,2>{0.206679851f, 0.459441841f},
-std::array<float,2>{0.884593129f, 0.950349212f},
-std::array<float,2>{0.537922859f, 0.191140383f},
-std::array<float,2>{0.47903353f, 0.629308522f},
-std::array<float,2>{0.313250482f, 0.056148313f},
-std::array<float,2>{0.716554284f, 0.517082214f},
-std::array<float,2>{0.807672322f, 0.260343492f},
-std::array<float,2>{0.0683863908f, 0.776017725f},
-std::array<float,2>{0.416379064f, 0.370176494f},
-std::array<float,2>{0.583195388f, 0.845959365f},
-std::array<float,2>{0.997660041f, 0.0877627358f},
-std::array<float,2>{0.134870157f, 0.562696338f},
-std::array<float,2>{0.0337830521f, 0.126687154f},
-std::array<float,2>{0.856877744f, 0.731347382f},
-std::array<float,2>{0.636021376f, 0.435862541f},
-std::array<float,2>{0.304160833f, 0.915955424f},
-std::array<float,2>{0.0971808285f, 0.282529444f},
-std::array<float,2>{0.751793206f, 0.792591512f},
-std::array<float,2>{0.735368073f, 0.0266825985f},
-std::array<float,2>{0.368290871f, 0.555036008f},
-std::array<float,2>{0.43826744f, 0.247507662f},
-std::array<float,2>{0.524072587f, 0.677066803f},
-std::array<float,2>{0.908529341f, 0.497172594f},
-std::array<float,2>{0.240043595f, 0.991878211f},
-std::array<float,2>{0.254016697f, 0.403091341f},
-std::array<float,2>{0.684898198f, 0.881089509f},
-std::array<float,2>{0.840139329f, 0.158774838f},
-std::array<float,2>{0.00155277038f, 0.716038406f},
-std::array<float,2>{0.166083321f, 0.0953879058f},
-std::array<float,2>{0.955957353f, 0.624974132f},
-std::array<float,2>{0.615389347f, 0.326703697f},
-std::array<float,2>{0.380650848f, 0.81528002f},
-std::array<float,2>{0.0439829826f, 0.43829155f},
-std::array<float,2>{0.847796857f, 0.960196674f},
-std::array<float,2>{0.62591213f, 0.206057847f},
-std::array<float,2>{0.308093399f, 0.654187381f},
-std::array<float,2>{0.40787524f, 0.0411047935f},
-std::array<float,2>{0.593004644f, 0.505122364f},
-std::array<float,2>{0.988117933f, 0.266033322f},
-std::array<float,2>{0.125908509f, 0.761559427f},
-std::array<float,2>{0.324398309f, 0.347814798f},
-std::array<float,2>{0.706309021f, 0.866409063f},
-std::array<float,2>{0.798251271f, 0.0686322004f},
-std::array<float,2>{0.0721681044f, 0.591297448f},
-std::array<float,2>{0.214552894f, 0.145738482f},
-std::array<float,2>{0.88242209f, 0.737598479f},
-std::array<float,2>{0.541433156f, 0.412009239f},
-std::array<float,2>{0.4764539f, 0.932694554f},
-std::array<float,2>{0.156562686f, 0.311637163f},
-std::array<float,2>{0.965080738f, 0.812485695f},
-std::array<float,2>{0.617623508f, 0.00623459695f},
-std::array<float,2>{0.389662713f, 0.535284579f},
-std::array<float,2>{0.263429314f, 0.224652812f},
-std::array<float,2>{0.678211749f, 0.666508019f},
-std::array<float,2>{0.831782281f, 0.47268483f},
-std::array<float,2>{0.0122324666f, 0.975226998f},
-std::array<float,2>{0.445770651f, 0.38249281f},
-std::array<float,2>{0.516998351f, 0.90469259f},
-std::array<float,2>{0.921556592f, 0.176137373f},
-std::array<float,2>{0.243635654f, 0.696913302f},
-std::array<float,2>{0.10483934f, 0.111776799f},
-std::array<float,2>{0.761703014f, 0.6019876f},
-std::array<float,2>{0.747789025f, 0.328960299f},
-std::array<float,2>{0.362419784f, 0.832400084f},
-std::array<float,2>{0.227198422f, 0.430838525f},
-std::array<float,2>{0.922165692f, 0.920360208f},
-std::array<float,2>{0.504077017f, 0.131155372f},
-std::array<float,2>{0.465131849f, 0.72982502f},
-std::array<float,2>{0.348791659f, 0.0905520096f},
-std::array<float,2>{0.730543971f, 0.569288433f},
-std::array<float,2>{0.77192229f, 0.374509215f},
-std::array<float,2>{0.111386538f, 0.849584877f},
-std::array<float,2>{0.393209845f, 0.263855487f},
-std::array<float,2>{0.605278552f, 0.781114817f},
-std::array<float,2>{0.943206131f, 0.0586014576f},
-std::array<float,2>{0.180716157f, 0.521905303f},
-std::array<float,2>{0.0283185095f, 0.191857696f},
-std::array<float,2>{0.816392362f, 0.625002742f},
-std::array<float,2>{0.660251915f, 0.454539627f},
-std::array<float,2>{0.271009952f, 0.945775568f},
-std::array<float,2>{0.0889228508f, 0.321784794f},
-std::array<float,2>{0.788998842f, 0.818158686f},
-std::array<float,2>{0.695102572f, 0.100523733f},
-std::array<float,2>{0.334944874f, 0.61907053f},
-std::array<float,2>{0.499136269f, 0.160420716f},
-std::array<float,2>{0.548135161f, 0.713955641f},
-std::array<float,2>{0.903598309f, 0.401073784f},
-std::array<float,2>{0.189111143f, 0.878856778f},
-std::array<float,2>{0.283768773f, 0.495093226f},
-std::array<float,2>{0.64956671f, 0.987490058f},
-std::array<float,2>{0.871045053f, 0.244848773f},
-std::array<float,2>{0.0495447405f, 0.674214303f},
-std::array<float,2>{0.145115077f, 0.0282069892f},
-std::array<float,2>{0.969025254f, 0.559676528f},
-std::array<float,2>{0.567277312f, 0.28856194f},
-std::array<float,2>{0.426825672f, 0.793599963f},
-std::array<float,2>{0.121439531f, 0.396504223f},
-std::array<float,2>{0.774322093f, 0.889835f},
-std::array<float,2>{0.724075377f, 0.169797555f},
-std::array<float,2>{0.357230812f, 0.710451484f},
-std::array<float,2>{0.458464473f, 0.108961172f},
-std::array<float,2>{0.510647476f, 0.611965895f},
-std::array<float,2>{0.937343478f, 0.314045966f},
-std::array<float,2>{0.223495841f, 0.825741291f},
-std::array<float,2>{0.274018675f, 0.295608521f},
-std::array<float,2>{0.664222419f, 0.783863544f},
-std::array<float,2>{0.824214458f, 0.0220355745f},
-std::array<float,2>{0.0159400869f, 0.548759103f},
-std::array<float,2>{0.177409738f, 0.237585112f},
-std::array<float,2>{0.952930868f, 0.687079728f},
-std::array<float,2>{0.59883517f, 0.488883376f},
-std::array<float,2>{0.399367899f, 0.994087279f},
-std::array<float,2>{0.196567908f, 0.360799819f},
-std::array<float,2>{0.892282486f, 0.858148038f},
-std::array<float,2>{0.55781436f, 0.0782692879f},
-std::array<float,2>{0.488666296f, 0.572565198f},
-std::array<float,2>{0.338870287f, 0.136866868f},
-std::array<float,2>{0.699690878f, 0.726321757f},
-std::array<float,2>{0.792802453f, 0.422917157f},
-std::array<float,2>{0.0824167579f, 0.912676632f},
-std::array<float,2>{0.434435666f, 0.46589911f},
-std::array<float,2>{0.574928343f, 0.944635808f},
-std::array<float,2>{0.977582991f, 0.202375501f},
-std::array<float,2>{0.152211607f, 0.636484504f},
-std::array<float,2>{0.0570490845f, 0.0508210026f},
-std::array<float,2>{0.861045599f, 0.528690875f},
-std::array<float,2>{0.644686222f, 0.250071734f},
-std::array<float,2>{0.29343465f, 0.768305242f},
-std::array<float,2>{0.137053907f, 0.480969936f},
-std::array<float,2>{0.995642185f, 0.983740568f},
-std::array<float,2>{0.578700304f, 0.231630534f},
-std::array<float,2>{0.418711692f, 0.663242579f},
-std::array<float,2>{0.299688846f, 0.00991778355f},
-std::array<float,2>{0.637236238f, 0.542170763f},
-std::array<float,2>{0.854752183f, 0.300869048f},
-std::array<float,2>{0.035160061f, 0.797222376f},
-std::array<float,2>{0.4834342f, 0.340429544f},
-std::array<float,2>{0.532038808f, 0.842882633f},
-std::array<float,2>{0.889971256f, 0.120968901f},
-std::array<float,2>{0.207340628f, 0.596486509f},
-std::array<float,2>{0.0626350269f, 0.18002452f},
-std::array<float,2>{0.810747027f, 0.690830171f},
-std::array<float,2>{0.713800311f, 0.383062363f},
-std::array<float,2>{0.31767115f, 0.890912771f},
-std::array<float,2>{0.00583545864f, 0.277122915f},
-std::array<float,2>{0.836511374f, 0.757360935f},
-std::array<float,2>{0.681179345f, 0.0380885638f},
-std::array<float,2>{0.252731651f, 0.513110459f},
-std::array<float,2>{0.37827611f, 0.211000606f},
-std::array<float,2>{0.612863064f, 0.645474255f},
-std::array<float,2>{0.960624695f, 0.45119524f},
-std::array<float,2>{0.167988241f, 0.964241803f},
-std::array<float,2>{0.3744542f, 0.415424109f},
-std::array<float,2>{0.740647733f, 0.925329804f},
-std::array<float,2>{0.755102456f, 0.15062204f},
-std::array<float,2>{0.0987994671f, 0.743359566f},
-std::array<float,2>{0.235976219f, 0.0761982501f},
-std::array<float,2>{0.913652897f, 0.584261954f},
-std::array<float,2>{0.528015435f, 0.357107639f},
-std::array<float,2>{0.441431612f, 0.874914169f},
-std::array<float,2>{0.107138403f, 0.46167621f},
-std::array<float,2>{0.765529037f, 0.939295769f},
-std::array<float,2>{0.745321751f, 0.197901189f},
-std::array<float,2>{0.367074072f, 0.640180886f},
-std::array<float,2>{0.449743122f, 0.0491972566f},
-std::array<float,2>{0.521761596f, 0.526711583f},
-std::array<float,2>{0.91564703f, 0.256831318f},
-std::array<float,2>{0.249521479f, 0.771181107f},
-std::array<float,2>{0.258032709f, 0.36633417f},
-std::array<float,2>{0.672420323f, 0.853207767f},
-std::array<float,2>{0.835327506f, 0.0839452296f},
-std::array<float,2>{0.00913630519f, 0.576827824f},
-std::array<float,2>{0.160538718f, 0.132877961f},
-std::array<float,2>{0.962618411f, 0.721322298f},
-std::array<float,2>{0.623461008f, 0.429417759f},
-std::array<float,2>{0.38654536f, 0.908596396f},
-std::array<float,2>{0.217954293f, 0.291621357f},
-std::array<float,2>{0.876098752f, 0.788042963f},
-std::array<float,2>{0.54548192f, 0.0167825948f},
-std::array<float,2>{0.471206397f, 0.553256094f},
-std::array<float,2>{0.32185474f, 0.238774508f},
-std::array<float,2>{0.708884895f, 0.682762563f},
-std::array<float,2>{0.804350793f, 0.485987842f},
-std::array<float,2>{0.0747899488f, 0.999186099f},
-std::array<float,2>{0.411922634f, 0.390983135f},
-std::array<float,2>{0.58747834f, 0.883936465f},
-std::array<float,2>{0.990108192f, 0.166295007f},
-std::array<float,2>{0.132713735f, 0.704992115f},
-std::array<float,2>{0.0415665098f, 0.103588104f},
-std::array<float,2>{0.845400095f, 0.613495767f},
-std::array<float,2>{0.632684469f, 0.319526315f},
-std::array<float,2>{0.310215473f, 0.82372719f},
-std::array<float,2>{0.142413244f, 0.420271665f},
-std::array<float,2>{0.973088264f, 0.928854406f},
-std::array<float,2>{0.565874755f, 0.155878752f},
-std::array<float,2>{0.422861218f, 0.74857533f},
-std::array<float,2>{0.285320401f, 0.073548466f},
-std::array<float,2>{0.652754664f, 0.579347193f},
-std::array<float,2>{0.873343587f, 0.352461964f},
-std::array<float,2>{0.0530203134f, 0.870401025f},
-std::array<float,2>{0.495435327f, 0.281053603f},
-std::array<float,2>{0.553072989f, 0.753334045f},
-std::array<float,2>{0.901576281f, 0.0328388549f},
-std::array<float,2>{0.191983595f, 0.509085476f},
-std::array<float,2>{0.0919500291f, 0.218443781f},
-std::array<float,2>{0.783392072f, 0.643203616f},
-std::array<float,2>{0.689161658f, 0.447107822f},
-std::array<float,2>{0.328618765f, 0.967458069f},
-std::array<float,2>{0.0268135723f, 0.337851763f},
-std::array<float,2>{0.820052803f, 0.838922918f},
-std::array<float,2>{0.657205164f, 0.121551625f},
-std::array<float,2>{0.265867949f, 0.598023057f},
-std::array<float,2>{0.396377087f, 0.185547173f},
-std::array<float,2>{0.605588794f, 0.693628848f},
-std::array<float,2>{0.939385474f, 0.387100071f},
-std::array<float,2>{0.186169803f, 0.897252738f},
-std::array<float,2>{0.34598574f, 0.479254931f},
-std::array<float,2>{0.726638079f, 0.978400052f},
-std::array<float,2>{0.76835674f, 0.227488264f},
-std::array<float,2>{0.115898386f, 0.658465207f},
-std::array<float,2>{0.23374474f, 0.0130792884f},
-std::array<float,2>{0.926460683f, 0.546805859f},
-std::array<float,2>{0.501592219f, 0.298332423f},
-std::array<float,2>{0.464157879f, 0.802299321f},
-std::array<float,2>{0.060123682f, 0.378088564f},
-std::array<float,2>{0.867024183f, 0.899336755f},
-std::array<float,2>{0.641658008f, 0.174874961f},
-std::array<float,2>{0.289754152f, 0.702661633f},
-std::array<float,2>{0.430691093f, 0.114484183f},
-std::array<float,2>{0.571434379f, 0.609373987f},
-std::array<float,2>{0.981159747f, 0.332290441f},
-std::array<float,2>{0.155873656f, 0.830414712f},
-std::array<float,2>{0.341109008f, 0.305122763f},
-std::array<float,2>{0.697758496f, 0.808226347f},
-std::array<float,2>{0.796036005f, 0.00198229193f},
-std::array<float,2>{0.0808694065f, 0.533640623f},
-std::array<float,2>{0.199577495f, 0.22019738f},
-std::array<float,2>{0.894604504f, 0.671294689f},
-std::array<float,2>{0.562154472f, 0.472133994f},
-std::array<float,2>{0.488178551f, 0.971573472f},
-std::array<float,2>{0.174475342f, 0.344620973f},
-std::array<float,2>{0.947779834f, 0.861923337f},
-std::array<float,2>{0.596853912f, 0.0628462657f},
-std::array<float,2>{0.402665854f, 0.589280963f},
-std::array<float,2>{0.278410673f, 0.142350525f},
-std::array<float,2>{0.668686271f, 0.742041886f},
-std::array<float,2>{0.826087356f, 0.406742871f},
-std::array<float,2>{0.0223030318f, 0.93747896f},
-std::array<float,2>{0.455704689f, 0.444972426f},
-std::array<float,2>{0.515106261f, 0.955821574f},
-std::array<float,2>{0.930492759f, 0.207514688f},
-std::array<float,2>{0.222294614f, 0.648452818f},
-std::array<float,2>{0.118981458f, 0.0461540185f},
-std::array<float,2>{0.777372479f, 0.502584994f},
-std::array<float,2>{0.720381498f, 0.270783544f},
-std::array<float,2>{0.355334282f, 0.764991999f},
-std::array<float,2>{0.241945684f, 0.49926734f},
-std::array<float,2>{0.907206118f, 0.989496648f},
-std::array<float,2>{0.525924027f, 0.249789551f},
-std::array<float,2>{0.440578282f, 0.678465009f},
-std::array<float,2>{0.370205671f, 0.0241136923f},
-std::array<float,2>{0.736680627f, 0.557132244f},
-std::array<float,2>{0.752192259f, 0.284430593f},
-std::array<float,2>{0.0951152444f, 0.790523529f},
-std::array<float,2>{0.38217783f, 0.324224859f},
-std::array<float,2>{0.613359272f, 0.813028097f},
-std::array<float,2>{0.953398705f, 0.0963342488f},
-std::array<float,2>{0.165070534f, 0.62215966f},
-std::array<float,2>{0.00367217511f, 0.157813743f},
-std::array<float,2>{0.843264103f, 0.718474209f},
-std::array<float,2>{0.686356664f, 0.405037254f},
-std::array<float,2>{0.25716877f, 0.87904036f},
-std::array<float,2>{0.0666244626f, 0.258991122f},
-std::array<float,2>{0.805821002f, 0.774175406f},
-std::array<float,2>{0.718029082f, 0.0584254265f},
-std::array<float,2>{0.314772427f, 0.518141806f},
-std::array<float,2>{0.477211177f, 0.188852519f},
-std::array<float,2>{0.535669088f, 0.632121742f},
-std::array<float,2>{0.885533392f, 0.458364785f},
-std::array<float,2>{0.204272389f, 0.951536179f},
-std::array<float,2>{0.302562445f, 0.435344279f},
-std::array<float,2>{0.632834733f, 0.917683721f},
-std::array<float,2>{0.85874778f, 0.127243146f},
-std::array<float,2>{0.0314339176f, 0.73379904f},
-std::array<float,2>{0.133608162f, 0.0891198367f},
-std::array<float,2>{0.998696923f, 0.565365314f},
-std::array<float,2>{0.585490346f, 0.368562192f},
-std::array<float,2>{0.415179491f, 0.843951583f},
-std::array<float,2>{0.0152405975f, 0.475672752f},
-std::array<float,2>{0.829899251f, 0.972933769f},
-std::array<float,2>{0.675884247f, 0.223226249f},
-std::array<float,2>{0.263945401f, 0.664596498f},
-std::array<float,2>{0.388367742f, 0.0051347944f},
-std::array<float,2>{0.620900035f, 0.538174093f},
-std::array<float,2>{0.967853844f, 0.30966273f},
-std::array<float,2>{0.158669084f, 0.809731364f},
-std::array<float,2>{0.35943222f, 0.330744982f},
-std::array<float,2>{0.749361098f, 0.834796488f},
-std::array<float,2>{0.759601951f, 0.1098952f},
-std::array<float,2>{0.102045938f, 0.605238676f},
-std::array<float,2>{0.245174959f, 0.177888051f},
-std::array<float,2>{0.918100357f, 0.69727397f},
-std::array<float,2>{0.51811409f, 0.379125834f},
-std::array<float,2>{0.447769493f, 0.903246999f},
-std::array<float,2>{0.127076909f, 0.269387484f},
-std::array<float,2>{0.984499872f, 0.758265793f},
-std::array<float,2>{0.591792703f, 0.0408673882f},
-std::array<float,2>{0.408653319f, 0.507679284f},
-std::array<float,2>{0.305777282f, 0.204582483f},
-std::array<float,2>{0.627672493f, 0.654314876f},
-std::array<float,2>{0.851526022f, 0.439820945f},
-std::array<float,2>{0.045979552f, 0.957724035f},
-std::array<float,2>{0.473917395f, 0.413409442f},
-std::array<float,2>{0.539236307f, 0.9310956f},
-std::array<float,2>{0.8792184f, 0.148388684f},
-std::array<float,2>{0.211515278f, 0.734589756f},
-std::array<float,2>{0.0725282729f, 0.0676241443f},
-std::array<float,2>{0.800410509f, 0.593613923f},
-std::array<float,2>{0.704103053f, 0.349907994f},
-std::array<float,2>{0.327543288f, 0.863486648f},
-std::array<float,2>{0.190555528f, 0.39852947f},
-std::array<float,2>{0.905959666f, 0.876460135f},
-std::array<float,2>{0.549700379f, 0.162114173f},
-std::array<float,2>{0.497873962f, 0.711109281f},
-std::array<float,2>{0.333798826f, 0.0978644118f},
-std::array<float,2>{0.6929335f, 0.619589984f},
-std::array<float,2>{0.785744011f, 0.324067056f},
-std::array<float,2>{0.0867233649f, 0.819666266f},
-std::array<float,2>{0.42909503f, 0.286054999f},
-std::array<float,2>{0.568410635f, 0.796265543f},
-std::array<float,2>{0.971299112f, 0.0301775578f},
-std::array<float,2>{0.147167116f, 0.562455893f},
-std::array<float,2>{0.0477985367f, 0.243039086f},
-std::array<float,2>{0.868718624f, 0.672479212f},
-std::array<float,2>{0.651156068f, 0.492723823f},
-std::array<float,2>{0.281777948f, 0.985641479f},
-std::array<float,2>{0.109704264f, 0.372802854f},
-std::array<float,2>{0.771087945f, 0.850230992f},
-std::array<float,2>{0.734336734f, 0.0935225189f},
-std::array<float,2>{0.351473391f, 0.567964971f},
-std::array<float,2>{0.468389958f, 0.130574331f},
-std::array<float,2>{0.506916165f, 0.726746976f},
-std::array<float,2>{0.924328387f, 0.431698889f},
-std::array<float,2>{0.229638487f, 0.919537246f},
-std::array<float,2>{0.272774398f, 0.455951095f},
-std::array<float,2>{0.664057255f, 0.9475649f},
-std::array<float,2>{0.812984645f, 0.193802983f},
-std::array<float,2>{0.0297396872f, 0.627478004f},
-std::array<float,2>{0.182276919f, 0.0610863268f},
-std::array<float,2>{0.944948733f, 0.520238698f},
-std::array<float,2>{0.603144646f, 0.262809366f},
-std::array<float,2>{0.392199486f, 0.777503133f},
-std::array<float,2>{0.0845776424f, 0.425597876f},
-std::array<float,2>{0.790959239f, 0.910735786f},
-std::array<float,2>{0.702239037f, 0.139921024f},
-std::array<float,2>{0.336044759f, 0.72317785f},
-std::array<float,2>{0.491042197f, 0.0812433362f},
-std::array<float,2>{0.555016816f, 0.571979761f},
-std::array<float,2>{0.893971145f, 0.36262995f},
-std::array<float,2>{0.198599294f, 0.857158661f},
-std::array<float,2>{0.295143843f, 0.252364039f},
-std::array<float,2>{0.64726454f, 0.766789913f},
-std::array<float,2>{0.862703145f, 0.0536387898f},
-std::array<float,2>{0.0552052967f, 0.530534029f},
-std::array<float,2>{0.149884909f, 0.201045662f},
-std::array<float,2>{0.978747845f, 0.633033633f},
-std::array<float,2>{0.577868938f, 0.468352348f},
-std::array<float,2>{0.436318874f, 0.943247974f},
-std::array<float,2>{0.224899441f, 0.315613449f},
-std::array<float,2>{0.934466362f, 0.826786876f},
-std::array<float,2>{0.509712279f, 0.107313909f},
-std::array<float,2>{0.459698945f, 0.609634101f},
-std::array<float,2>{0.359054953f, 0.171307728f},
-std::array<float,2>{0.726229966f, 0.70850116f},
-std::array<float,2>{0.776590645f, 0.394736558f},
-std::array<float,2>{0.123210132f, 0.888670504f},
-std::array<float,2>{0.400963008f, 0.492002726f},
-std::array<float,2>{0.599841833f, 0.994985044f},
-std::array<float,2>{0.949562609f, 0.235987097f},
-std::array<float,2>{0.179470643f, 0.684852481f},
-std::array<float,2>{0.0180926044f, 0.0206237435f},
-std::array<float,2>{0.821078956f, 0.549401045f},
-std::array<float,2>{0.666316569f, 0.293644041f},
-std::array<float,2>{0.275984049f, 0.781822681f},
-std::array<float,2>{0.171265081f, 0.450163126f},
-std::array<float,2>{0.957211614f, 0.962424278f},
-std::array<float,2>{0.609592319f, 0.214079693f},
-std::array<float,2>{0.376394898f, 0.647706687f},
-std::array<float,2>{0.250777066f, 0.0363301896f},
-std::array<float,2>{0.681831717f, 0.515260696f},
-std::array<float,2>{0.838900268f, 0.273645133f},
-std::array<float,2>{0.00740372809f, 0.755551338f},
-std::array<float,2>{0.443497747f, 0.358629525f},
-std::array<float,2>{0.529767931f, 0.872264683f},
-std::array<float,2>{0.911136031f, 0.0745871887f},
-std::array<float,2>{0.237702817f, 0.582644224f},
-std::array<float,2>{0.100723363f, 0.150331676f},
-std::array<float,2>{0.755951703f, 0.745278895f},
-std::array<float,2>{0.738464713f, 0.416895658f},
-std::array<float,2>{0.372475564f, 0.92375797f},
-std::array<float,2>{0.0380514562f, 0.302839637f},
-std::array<float,2>{0.852051258f, 0.799711108f},
-std::array<float,2>{0.640026808f, 0.00856124517f},
-std::array<float,2>{0.296934843f, 0.53997618f},
-std::array<float,2>{0.421529323f, 0.233425513f},
-std::array<float,2>{0.581374586f, 0.660922766f},
-std::array<float,2>{0.992668808f, 0.482427329f},
-std::array<float,2>{0.138975427f, 0.980893552f},
-std::array<float,2>{0.320067525f, 0.386045486f},
-std::array<float,2>{0.711950779f, 0.894030631f},
-std::array<float,2>{0.810331106f, 0.183495477f},
-std::array<float,2>{0.0644656196f, 0.688447952f},
-std::array<float,2>{0.21060887f, 0.11881429f},
-std::array<float,2>{0.887885153f, 0.595037937f},
-std::array<float,2>{0.534515977f, 0.343391985f},
-std::array<float,2>{0.480673134f, 0.841596127f},
-std::array<float,2>{0.0898619369f, 0.44604677f},
-std::array<float,2>{0.782939315f, 0.967978895f},
-std::array<float,2>{0.690081358f, 0.217766732f},
-std::array<float,2>{0.330670387f, 0.644100308f},
-std::array<float,2>{0.492983431f, 0.0317222252f},
-std::array<float,2>{0.551040888f, 0.508136213f},
-std::array<float,2>{0.89967674f, 0.279429287f},
-std::array<float,2>{0.193612844f, 0.752838135f},
-std::array<float,2>{0.288907498f, 0.352616042f},
-std::array<float,2>{0.654620886f, 0.86939317f},
-std::array<float,2>{0.87124145f, 0.0723940656f},
-std::array<float,2>{0.0525615066f, 0.57881552f},
-std::array<float,2>{0.143840998f, 0.154508904f},
-std::array<float,2>{0.976209819f, 0.749684095f},
-std::array<float,2>{0.564401627f, 0.42140013f},
-std::array<float,2>{0.424551427f, 0.928100824f},
-std::array<float,2>{0.231959805f, 0.2976951f},
-std::array<float,2>{0.927767217f, 0.800998271f},
-std::array<float,2>{0.503032684f, 0.0125760492f},
-std::array<float,2>{0.461174548f, 0.545434117f},
-std::array<float,2>{0.345653027f, 0.228300691f},
-std::array<float,2>{0.729046226f, 0.659211695f},
-std::array<float,2>{0.76729393f, 0.480217934f},
-std::array<float,2>{0.114819653f, 0.977150142f},
-std::array<float,2>{0.397683293f, 0.387864262f},
-std::array<float,2>{0.608560562f, 0.898420513f},
-std::array<float,2>{0.941381633f, 0.186618924f},
-std::array<float,2>{0.18442376f, 0.694790602f},
-std::array<float,2>{0.0246628951f, 0.122897446f},
-std::array<float,2>{0.816525042f, 0.598965466f},
-std::array<float,2>{0.659591615f, 0.336807102f},
-std::array<float,2>{0.267917871f, 0.838657498f},
-std::array<float,2>{0.162530854f, 0.427761316f},
-std::array<float,2>{0.963632286f, 0.90991503f},
-std::array<float,2>{0.622591436f, 0.134051323f},
-std::array<float,2>{0.384299219f, 0.722258568f},
-std::array<float,2>{0.260823756f, 0.0823203847f},
-std::array<float,2>{0.675433695f, 0.577642858f},
-std::array<float,2>{0.83236587f, 0.365511388f},
-std::array<float,2>{0.0112836743f, 0.851602793f},
-std::array<float,2>{0.452328652f, 0.257526487f},
-std::array<float,2>{0.521072984f, 0.770217896f},
-std::array<float,2>{0.916453481f, 0.0500774644f},
-std::array<float,2>{0.246683419f, 0.525686383f},
-std::array<float,2>{0.108741924f, 0.198341534f},
-std::array<float,2>{0.762853503f, 0.639113605f},
-std::array<float,2>{0.743119359f, 0.46260643f},
-std::array<float,2>{0.363286018f, 0.937672496f},
-std::array<float,2>{0.0395864733f, 0.319139481f},
-std::array<float,2>{0.845955431f, 0.822355866f},
-std::array<float,2>{0.630545557f, 0.105151705f},
-std::array<float,2>{0.311899602f, 0.614626586f},
-std::array<float,2>{0.413199812f, 0.167379588f},
-std::array<float,2>{0.588423133f, 0.703833342f},
-std::array<float,2>{0.990751803f, 0.392299891f},
-std::array<float,2>{0.129720181f, 0.883717239f},
-std::array<float,2>{0.323758185f, 0.48464945f},
-std::array<float,2>{0.710925817f, 0.998665333f},
-std::array<float,2>{0.802237451f, 0.240177974f},
-std::array<float,2>{0.0777986944f, 0.682334602f},
-std::array<float,2>{0.215570033f, 0.0159913283f},
-std::array<float,2>{0.877382159f, 0.553988397f},
-std::array<float,2>{0.5445925f, 0.292688459f},
-std::array<float,2>{0.469393164f, 0.788812876f},
-std::array<float,2>{0.000722454628f, 0.405684561f},
-std::array<float,2>{0.841120064f, 0.880807579f},
-std::array<float,2>{0.68361485f, 0.156656459f},
-std::array<float,2>{0.255368561f, 0.717556536f},
-std::array<float,2>{0.379045814f, 0.0974182263f},
-std::array<float,2>{0.616778314f, 0.621124625f},
-std::array<float,2>{0.95621258f, 0.325506061f},
-std::array<float,2>{0.167871028f, 0.813637614f},
-std::array<float,2>{0.367402047f, 0.283632815f},
-std::array<float,2>{0.734634817f, 0.789969862f},
-std::array<float,2>{0.750306666f, 0.0246068873f},
-std::array<float,2>{0.0965681821f, 0.558526337f},
-std::array<float,2>{0.239236757f, 0.248689815f},
-std::array<float,2>{0.909996748f, 0.679371178f},
-std::array<float,2>{0.525286794f, 0.498190671f},
-std::array<float,2>{0.439040393f, 0.989223421f},
-std::array<float,2>{0.135814041f, 0.367256075f},
-std::array<float,2>{0.996524096f, 0.844926298f},
-std::array<float,2>{0.582883239f, 0.0881370679f},
-std::array<float,2>{0.417434812f, 0.566071868f},
-std::array<float,2>{0.30318445f, 0.128611252f},
-std::array<float,2>{0.635064244f, 0.732463837f},
-std::array<float,2>{0.855882227f, 0.434456289f},
-std::array<float,2>{0.0342599228f, 0.916459501f},
-std::array<float,2>{0.480084181f, 0.457360506f},
-std::array<float,2>{0.538650751f, 0.952239692f},
-std::array<float,2>{0.883767486f, 0.188129753f},
-std::array<float,2>{0.205765992f, 0.631161094f},
-std::array<float,2>{0.0701487884f, 0.0568668991f},
-std::array<float,2>{0.807082474f, 0.519192994f},
-std::array<float,2>{0.715228856f, 0.258381844f},
-std::array<float,2>{0.3138071f, 0.774593174f},
-std::array<float,2>{0.202419698f, 0.471305043f},
-std::array<float,2>{0.896643698f, 0.972027421f},
-std::array<float,2>{0.559771836f, 0.218781307f},
-std::array<float,2>{0.48621124f, 0.670070827f},
-std::array<float,2>{0.343023747f, 0.00310643809f},
-std::array<float,2>{0.696760356f, 0.534708381f},
-std::array<float,2>{0.794596493f, 0.30608505f},
-std::array<float,2>{0.0796165466f, 0.807487905f},
-std::array<float,2>{0.43237415f, 0.333423257f},
-std::array<float,2>{0.572840214f, 0.831993282f},
-std::array<float,2>{0.983263195f, 0.113516681f},
-std::array<float,2>{0.1529098f, 0.608252406f},
-std::array<float,2>{0.0618377887f, 0.174576402f},
-std::array<float,2>{0.864443719f, 0.701495409f},
-std::array<float,2>{0.644473374f, 0.377721846f},
-std::array<float,2>{0.291638076f, 0.900328457f},
-std::array<float,2>{0.120797336f, 0.269540399f},
-std::array<float,2>{0.781188607f, 0.764179826f},
-std::array<float,2>{0.721035182f, 0.0453981683f},
-std::array<float,2>{0.352593303f, 0.503117263f},
-std::array<float,2>{0.455004334f, 0.208323553f},
-std::array<float,2>{0.512193322f, 0.649983644f},
-std::array<float,2>{0.932736039f, 0.443472624f},
-std::array<float,2>{0.219090819f, 0.956067502f},
-std::array<float,2>{0.280041873f, 0.407334596f},
-std::array<float,2>{0.670528471f, 0.936399281f},
-std::array<float,2>{0.827937007f, 0.141576171f},
-std::array<float,2>{0.0204332955f, 0.740696311f},
-std::array<float,2>{0.172131464f, 0.0641886294f},
-std::array<float,2>{0.946336031f, 0.588560641f},
-std::array<float,2>{0.594063222f, 0.344959229f},
-std::array<float,2>{0.405064642f, 0.862739742f},
-std::array<float,2>{0.0498580746f, 0.493361682f},
-std::array<float,2>{0.869986296f, 0.985316038f},
-std::array<float,2>{0.649393499f, 0.2438014f},
-std::array<float,2>{0.28484115f, 0.672967672f},
-std::array<float,2>{0.426122904f, 0.0303847771f},
-std::array<float,2>{0.567607701f, 0.561055362f},
-std::array<float,2>{0.970513701f, 0.2862266f},
-std::array<float,2>{0.145576715f, 0.795095265f},
-std::array<float,2>{0.33547765f, 0.3229011f},
-std::array<float,2>{0.693426847f, 0.81924963f},
-std::array<float,2>{0.787935078f, 0.099181287f},
-std::array<float,2>{0.0888253674f, 0.620906472f},
-std::array<float,2>{0.188358724f, 0.163833514f},
-std::array<float,2>{0.902381539f, 0.712609529f},
-std::array<float,2>{0.547012806f, 0.400107116f},
-std::array<float,2>{0.498641491f, 0.875249565f},
-std::array<float,2>{0.179901689f, 0.261986524f},
-std::array<float,2>{0.941549659f, 0.779072881f},
-std::array<float,2>{0.603966892f, 0.0615662187f},
-std::array<float,2>{0.393624127f, 0.521307707f},
-std::array<float,2>{0.269622684f, 0.19472529f},
-std::array<float,2>{0.661337674f, 0.62815845f},
-std::array<float,2>{0.814763129f, 0.456927747f},
-std::array<float,2>{0.0292469542f, 0.948861063f},
-std::array<float,2>{0.466359377f, 0.432699949f},
-std::array<float,2>{0.505660295f, 0.918533444f},
-std::array<float,2>{0.923183739f, 0.129547119f},
-std::array<float,2>{0.228115439f, 0.728317857f},
-std::array<float,2>{0.113272943f, 0.0926408246f},
-std::array<float,2>{0.772527516f, 0.567207634f},
-std::array<float,2>{0.732266665f, 0.371836305f},
-std::array<float,2>{0.34806779f, 0.850739956f},
-std::array<float,2>{0.242638558f, 0.380527765f},
-std::array<float,2>{0.919935942f, 0.903536201f},
-std::array<float,2>{0.515766144f, 0.179129973f},
-std::array<float,2>{0.446965635f, 0.69921577f},
-std::array<float,2>{0.361619294f, 0.111142784f},
-std::array<float,2>{0.746539354f, 0.604165316f},
-std::array<float,2>{0.760275662f, 0.331847399f},
-std::array<float,2>{0.103791058f, 0.835636556f},
-std::array<float,2>{0.38941744f, 0.308713704f},
-std::array<float,2>{0.618565559f, 0.809056103f},
-std::array<float,2>{0.966243446f, 0.00391249871f},
-std::array<float,2>{0.157378614f, 0.538026571f},
-std::array<float,2>{0.0136590479f, 0.224205717f},
-std::array<float,2>{0.830207884f, 0.665957332f},
-std::array<float,2>{0.679652274f, 0.47539559f},
-std::array<float,2>{0.262418866f, 0.973701358f},
-std::array<float,2>{0.0710991994f, 0.351142853f},
-std::array<float,2>{0.797442973f, 0.86518091f},
-std::array<float,2>{0.705436468f, 0.0666625202f},
-std::array<float,2>{0.326150507f, 0.592295289f},
-std::array<float,2>{0.475217372f, 0.147343829f},
-std::array<float,2>{0.542021394f, 0.735394835f},
-std::array<float,2>{0.88140595f, 0.412274569f},
-std::array<float,2>{0.213163003f, 0.930516839f},
-std::array<float,2>{0.306643099f, 0.440917194f},
-std::array<float,2>{0.626721859f, 0.958724439f},
-std::array<float,2>{0.848667204f, 0.203444421f},
-std::array<float,2>{0.0431046486f, 0.656210899f},
-std::array<float,2>{0.126023695f, 0.0396245271f},
-std::array<float,2>{0.987036526f, 0.506275952f},
-std::array<float,2>{0.592458487f, 0.268196553f},
-std::array<float,2>{0.406324685f, 0.759397626f},
-std::array<float,2>{0.0982815474f, 0.417496264f},
-std::array<float,2>{0.753916383f, 0.921918869f},
-std::array<float,2>{0.741948903f, 0.149292946f},
-std::array<float,2>{0.373267919f, 0.745066702f},
-std::array<float,2>{0.442668378f, 0.0753961578f},
-std::array<float,2>{0.529198885f, 0.583253264f},
-std::array<float,2>{0.91213727f, 0.358048439f},
-std::array<float,2>{0.234572336f, 0.871995926f},
-std::array<float,2>{0.253493935f, 0.274831414f},
-std::array<float,2>{0.679974675f, 0.753928244f},
-std::array<float,2>{0.837756753f, 0.0353918411f},
-std::array<float,2>{0.00409923308f, 0.514066219f},
-std::array<float,2>{0.168968692f, 0.213286668f},
-std::array<float,2>{0.959708929f, 0.646622181f},
-std::array<float,2>{0.611687958f, 0.45061934f},
-std::array<float,2>{0.377760708f, 0.961507201f},
-std::array<float,2>{0.208131701f, 0.342717528f},
-std::array<float,2>{0.888792038f, 0.83998251f},
-std::array<float,2>{0.532451451f, 0.117362544f},
-std::array<float,2>{0.483020365f, 0.594412982f},
-std::array<float,2>{0.31653443f, 0.182267904f},
-std::array<float,2>{0.713977993f, 0.689154267f},
-std::array<float,2>{0.812207997f, 0.385522425f},
-std::array<float,2>{0.0644144863f, 0.893208086f},
-std::array<float,2>{0.419353783f, 0.483612001f},
-std::array<float,2>{0.579734862f, 0.981628776f},
-std::array<float,2>{0.994508982f, 0.232628956f},
-std::array<float,2>{0.137905344f, 0.661602199f},
-std::array<float,2>{0.0365720056f, 0.00926493108f},
-std::array<float,2>{0.853528976f, 0.540315926f},
-std::array<float,2>{0.638242602f, 0.304671556f},
-std::array<float,2>{0.300530076f, 0.800052106f},
-std::array<float,2>{0.150539666f, 0.467453122f},
-std::array<float,2>{0.977387428f, 0.941977859f},
-std::array<float,2>{0.575714886f, 0.200162157f},
-std::array<float,2>{0.435474962f, 0.634290636f},
-std::array<float,2>{0.294361591f, 0.0544240214f},
-std::array<float,2>{0.64620024f, 0.529513657f},
-std::array<float,2>{0.859898329f, 0.253594697f},
-std::array<float,2>{0.0584403239f, 0.765705228f},
-std::array<float,2>{0.489803076f, 0.36220026f},
-std::array<float,2>{0.557012916f, 0.855968535f},
-std::array<float,2>{0.891539037f, 0.0804052204f},
-std::array<float,2>{0.195374832f, 0.570903718f},
-std::array<float,2>{0.0838469416f, 0.139061913f},
-std::array<float,2>{0.791757643f, 0.724595249f},
-std::array<float,2>{0.700755477f, 0.424495578f},
-std::array<float,2>{0.338281006f, 0.911671698f},
-std::array<float,2>{0.0169741772f, 0.294026375f},
-std::array<float,2>{0.822955608f, 0.782996774f},
-std::array<float,2>{0.665889919f, 0.0196763426f},
-std::array<float,2>{0.274539351f, 0.550103605f},
-std::array<float,2>{0.399954647f, 0.234591842f},
-std::array<float,2>{0.598504722f, 0.683842897f},
-std::array<float,2>{0.951319754f, 0.490341097f},
-std::array<float,2>{0.176343784f, 0.995325208f},
-std::array<float,2>{0.356044948f, 0.396232128f},
-std::array<float,2>{0.723616719f, 0.887373507f},
-std::array<float,2>{0.774739623f, 0.170561433f},
-std::array<float,2>{0.123045124f, 0.707765162f},
-std::array<float,2>{0.224482566f, 0.106143638f},
-std::array<float,2>{0.936069667f, 0.611136794f},
-std::array<float,2>{0.511083603f, 0.315171033f},
-std::array<float,2>{0.457335144f, 0.82801652f},
-std::array<float,2>{0.117170915f, 0.477887213f},
-std::array<float,2>{0.769245625f, 0.980414808f},
-std::array<float,2>{0.728350222f, 0.228779539f},
-std::array<float,2>{0.347430915f, 0.656650484f},
-std::array<float,2>{0.4632321f, 0.0142779918f},
-std::array<float,2>{0.500381947f, 0.544021726f},
-std::array<float,2>{0.927666724f, 0.299968362f},
-std::array<float,2>{0.233288899f, 0.802923203f},
-std::array<float,2>{0.267190963f, 0.338621229f},
-std::array<float,2>{0.657283187f, 0.837783098f},
-std::array<float,2>{0.819074929f, 0.123333603f},
-std::array<float,2>{0.0256780647f, 0.601285219f},
-std::array<float,2>{0.187231004f, 0.183908954f},
-std::array<float,2>{0.937739551f, 0.691944838f},
-std::array<float,2>{0.606973171f, 0.388900101f},
-std::array<float,2>{0.394819796f, 0.89567256f},
-std::array<float,2>{0.192848608f, 0.279102206f},
-std::array<float,2>{0.900687933f, 0.751120269f},
-std::array<float,2>{0.554629743f, 0.0339619815f},
-std::array<float,2>{0.494293809f, 0.511518717f},
-std::array<float,2>{0.329445183f, 0.21541658f},
-std::array<float,2>{0.688426435f, 0.641032398f},
-std::array<float,2>{0.784685016f, 0.447373599f},
-std::array<float,2>{0.0936455652f, 0.965622246f},
-std::array<float,2>{0.422741711f, 0.419151127f},
-std::array<float,2>{0.56502831f, 0.927461684f},
-std::array<float,2>{0.974567413f, 0.153909132f},
-std::array<float,2>{0.141365588f, 0.74620235f},
-std::array<float,2>{0.0542794168f, 0.0712492615f},
-std::array<float,2>{0.874506831f, 0.580943286f},
-std::array<float,2>{0.653668642f, 0.354827642f},
-std::array<float,2>{0.286280662f, 0.868366063f},
-std::array<float,2>{0.131437317f, 0.39339155f},
-std::array<float,2>{0.988960087f, 0.886545837f},
-std::array<float,2>{0.586504221f, 0.165240332f},
-std::array<float,2>{0.410748333f, 0.706283867f},
-std::array<float,2>{0.309202224f, 0.102210745f},
-std::array<float,2>{0.63112545f, 0.615437329f},
-std::array<float,2>{0.843895197f, 0.31771633f},
-std::array<float,2>{0.042880971f, 0.820967376f},
-std::array<float,2>{0.471904874f, 0.289645463f},
-std::array<float,2>{0.546185374f, 0.785900235f},
-std::array<float,2>{0.875751853f, 0.0178022608f},
-std::array<float,2>{0.217562303f, 0.55255121f},
-std::array<float,2>{0.0755358636f, 0.241090685f},
-std::array<float,2>{0.803693891f, 0.680513799f},
-std::array<float,2>{0.707455575f, 0.486744881f},
-std::array<float,2>{0.320449531f, 0.996346653f},
-std::array<float,2>{0.00848758407f, 0.364104122f},
-std::array<float,2>{0.834812105f, 0.855236769f},
-std::array<float,2>{0.673669159f, 0.0842164531f},
-std::array<float,2>{0.259590596f, 0.574654698f},
-std::array<float,2>{0.385741442f, 0.136522278f},
-std::array<float,2>{0.624840319f, 0.719833255f},
-std::array<float,2>{0.961071968f, 0.426567197f},
-std::array<float,2>{0.161348119f, 0.907265246f},
-std::array<float,2>{0.365996897f, 0.464612633f},
-std::array<float,2>{0.745093286f, 0.940471888f},
-std::array<float,2>{0.763985276f, 0.197059289f},
-std::array<float,2>{0.105543524f, 0.637261331f},
-std::array<float,2>{0.248960003f, 0.0483733751f},
-std::array<float,2>{0.914864361f, 0.525302112f},
-std::array<float,2>{0.523146689f, 0.254524589f},
-std::array<float,2>{0.450633138f, 0.772803128f},
-std::array<float,2>{0.0329375602f, 0.436617911f},
-std::array<float,2>{0.857971668f, 0.914633512f},
-std::array<float,2>{0.634590089f, 0.125209868f},
-std::array<float,2>{0.301477551f, 0.731559753f},
-std::array<float,2>{0.414243162f, 0.0863980949f},
-std::array<float,2>{0.58450824f, 0.56430763f},
-std::array<float,2>{0.999433041f, 0.369751304f},
-std::array<float,2>{0.134666353f, 0.847137034f},
-std::array<float,2>{0.315804273f, 0.261306643f},
-std::array<float,2>{0.716823339f, 0.776414275f},
-std::array<float,2>{0.804914176f, 0.0552674234f},
-std::array<float,2>{0.0675678551f, 0.515662253f},
-std::array<float,2>{0.203295723f, 0.189573869f},
-std::array<float,2>{0.886096358f, 0.630828977f},
-std::array<float,2>{0.536437392f, 0.4605937f},
-std::array<float,2>{0.478250086f, 0.949630499f},
-std::array<float,2>{0.164221346f, 0.328054547f},
-std::array<float,2>{0.955077767f, 0.816223145f},
-std::array<float,2>{0.614954233f, 0.0944408327f},
-std::array<float,2>{0.381364644f, 0.623619318f},
-std::array<float,2>{0.255954742f, 0.160141736f},
-std::array<float,2>{0.686900198f, 0.715386391f},
-std::array<float,2>{0.841896594f, 0.403774589f},
-std::array<float,2>{0.002048644f, 0.882346809f},
-std::array<float,2>{0.440274477f, 0.496712714f},
-std::array<float,2>{0.526770651f, 0.990942597f},
-std::array<float,2>{0.907415867f, 0.246625006f},
-std::array<float,2>{0.240712002f, 0.675911725f},
-std::array<float,2>{0.0945700258f, 0.0263345577f},
-std::array<float,2>{0.753774822f, 0.556092918f},
-std::array<float,2>{0.737934411f, 0.281539798f},
-std::array<float,2>{0.370020896f, 0.791387498f},
-std::array<float,2>{0.221605629f, 0.442794323f},
-std::array<float,2>{0.931033432f, 0.954525471f},
-std::array<float,2>{0.514059007f, 0.210004374f},
-std::array<float,2>{0.456328273f, 0.650701106f},
-std::array<float,2>{0.353892416f, 0.0429914631f},
-std::array<float,2>{0.719620526f, 0.500590801f},
-std::array<float,2>{0.778407931f, 0.271568954f},
-std::array<float,2>{0.117357463f, 0.761790752f},
-std::array<float,2>{0.403901815f, 0.346749246f},
-std::array<float,2>{0.596338034f, 0.860245347f},
-std::array<float,2>{0.948758841f, 0.0660369992f},
-std::array<float,2>{0.174845085f, 0.587408006f},
-std::array<float,2>{0.0232715551f, 0.143895552f},
-std::array<float,2>{0.824237347f, 0.739324868f},
-std::array<float,2>{0.669421434f, 0.409486145f},
-std::array<float,2>{0.27822569f, 0.93552202f},
-std::array<float,2>{0.0820105597f, 0.30761531f},
-std::array<float,2>{0.795772314f, 0.806223512f},
-std::array<float,2>{0.698349237f, 0.00159557699f},
-std::array<float,2>{0.340024889f, 0.532151222f},
-std::array<float,2>{0.487186313f, 0.222186968f},
-std::array<float,2>{0.560638905f, 0.669768631f},
-std::array<float,2>{0.895565033f, 0.46924758f},
-std::array<float,2>{0.200640067f, 0.969634652f},
-std::array<float,2>{0.290638208f, 0.375485569f},
-std::array<float,2>{0.641486168f, 0.900713086f},
-std::array<float,2>{0.865696132f, 0.173589513f},
-std::array<float,2>{0.0586730801f, 0.700520337f},
-std::array<float,2>{0.154918626f, 0.116580844f},
-std::array<float,2>{0.982394814f, 0.606868505f},
-std::array<float,2>{0.570695221f, 0.333991259f},
-std::array<float,2>{0.429900348f, 0.829984784f},
-std::array<float,2>{0.0304759555f, 0.453656524f},
-std::array<float,2>{0.814162374f, 0.946668327f},
-std::array<float,2>{0.66276294f, 0.19255273f},
-std::array<float,2>{0.271990329f, 0.626313627f},
-std::array<float,2>{0.390755236f, 0.0600150563f},
-std::array<float,2>{0.601853192f, 0.522539139f},
-std::array<float,2>{0.943881333f, 0.265525162f},
-std::array<float,2>{0.183249012f, 0.780092537f},
-std::array<float,2>{0.350307405f, 0.373418033f},
-std::array<float,2>{0.73302561f, 0.84812969f},
-std::array<float,2>{0.77019453f, 0.0910328925f},
-std::array<float,2>{0.110647149f, 0.570143759f},
-std::array<float,2>{0.228538603f, 0.132139266f},
-std::array<float,2>{0.925516784f, 0.728809774f},
-std::array<float,2>{0.506040692f, 0.430548519f},
-std::array<float,2>{0.467183232f, 0.921294749f},
-std::array<float,2>{0.147821397f, 0.287817448f},
-std::array<float,2>{0.972153187f, 0.794330835f},
-std::array<float,2>{0.569402218f, 0.0288872495f},
-std::array<float,2>{0.42811361f, 0.559045196f},
-std::array<float,2>{0.283048898f, 0.245563686f},
-std::array<float,2>{0.65187782f, 0.675472677f},
-std::array<float,2>{0.86779958f, 0.495122939f},
-std::array<float,2>{0.0486616492f, 0.986950636f},
-std::array<float,2>{0.496109277f, 0.401753306f},
-std::array<float,2>{0.550741971f, 0.877604485f},
-std::array<float,2>{0.905089438f, 0.161936358f},
-std::array<float,2>{0.189880982f, 0.712955475f},
-std::array<float,2>{0.0869650543f, 0.10135439f},
-std::array<float,2>{0.786854208f, 0.617976427f},
-std::array<float,2>{0.691732883f, 0.320944548f},
-std::array<float,2>{0.33243522f, 0.817127168f},
-std::array<float,2>{0.212197691f, 0.410661787f},
-std::array<float,2>{0.879999518f, 0.932376564f},
-std::array<float,2>{0.54031539f, 0.145310104f},
-std::array<float,2>{0.473526239f, 0.736834288f},
-std::array<float,2>{0.326196671f, 0.0693448484f},
-std::array<float,2>{0.703509152f, 0.590644121f},
-std::array<float,2>{0.799438357f, 0.348851621f},
-std::array<float,2>{0.0741532147f, 0.865644991f},
-std::array<float,2>{0.409702092f, 0.267389566f},
-std::array<float,2>{0.590610027f, 0.759842992f},
-std::array<float,2>{0.986277163f, 0.0425275788f},
-std::array<float,2>{0.128183976f, 0.504208088f},
-std::array<float,2>{0.0450418554f, 0.205392957f},
-std::array<float,2>{0.850273609f, 0.653318465f},
-std::array<float,2>{0.628461123f, 0.43863371f},
-std::array<float,2>{0.30520615f, 0.959298372f},
-std::array<float,2>{0.102689408f, 0.330021411f},
-std::array<float,2>{0.758031964f, 0.833429515f},
-std::array<float,2>{0.748906374f, 0.113085583f},
-std::array<float,2>{0.360380948f, 0.60301733f},
-std::array<float,2>{0.448567659f, 0.177357867f},
-std::array<float,2>{0.519145608f, 0.695919693f},
-std::array<float,2>{0.919361174f, 0.381363273f},
-std::array<float,2>{0.244176596f, 0.905466318f},
-std::array<float,2>{0.264977962f, 0.474057257f},
-std::array<float,2>{0.676858604f, 0.976329923f},
-std::array<float,2>{0.829051077f, 0.226254016f},
-std::array<float,2>{0.0138602648f, 0.667925775f},
-std::array<float,2>{0.159786239f, 0.00758733274f},
-std::array<float,2>{0.967438817f, 0.536149144f},
-std::array<float,2>{0.620105088f, 0.311298132f},
-std::array<float,2>{0.387599468f, 0.810790181f},
-std::array<float,2>{0.0654740483f, 0.384599149f},
-std::array<float,2>{0.809110165f, 0.892568469f},
-std::array<float,2>{0.711875379f, 0.180712327f},
-std::array<float,2>{0.319216102f, 0.689684272f},
-std::array<float,2>{0.482219368f, 0.119918056f},
-std::array<float,2>{0.533845246f, 0.597621322f},
-std::array<float,2>{0.88687849f, 0.341616809f},
-std::array<float,2>{0.209743232f, 0.841965735f},
-std::array<float,2>{0.29816553f, 0.302026808f},
-std::array<float,2>{0.639065623f, 0.797873199f},
-std::array<float,2>{0.852696419f, 0.0115640024f},
-std::array<float,2>{0.0381175689f, 0.541035712f},
-std::array<float,2>{0.13968493f, 0.231341183f},
-std::array<float,2>{0.993943572f, 0.662690461f},
-std::array<float,2>{0.580343246f, 0.482123822f},
-std::array<float,2>{0.420489997f, 0.982550323f},
-std::array<float,2>{0.237064168f, 0.356115162f},
-std::array<float,2>{0.910779953f, 0.873088479f},
-std::array<float,2>{0.530973971f, 0.0775563642f},
-std::array<float,2>{0.444675595f, 0.585246205f},
-std::array<float,2>{0.371285468f, 0.151716247f},
-std::array<float,2>{0.740183055f, 0.742208242f},
-std::array<float,2>{0.756887436f, 0.415033072f},
-std::array<float,2>{0.100332662f, 0.924568653f},
-std::array<float,2>{0.375263691f, 0.452761501f},
-std::array<float,2>{0.610868692f, 0.963383436f},
-std::array<float,2>{0.958546817f, 0.212375298f},
-std::array<float,2>{0.170735568f, 0.645858347f},
-std::array<float,2>{0.00645589968f, 0.0376641639f},
-std::array<float,2>{0.838518381f, 0.512685657f},
-std::array<float,2>{0.683404148f, 0.275851876f},
-std::array<float,2>{0.251066953f, 0.756447554f},
-std::array<float,2>{0.178201765f, 0.489340395f},
-std::array<float,2>{0.951057136f, 0.992581666f},
-std::array<float,2>{0.601023912f, 0.236813068f},
-std::array<float,2>{0.401545495f, 0.686510503f},
-std::array<float,2>{0.276681095f, 0.0229027066f},
-std::array<float,2>{0.667778075f, 0.547496974f},
-std::array<float,2>{0.822139025f, 0.295963377f},
-std::array<float,2>{0.0189614892f, 0.785140634f},
-std::array<float,2>{0.460152626f, 0.313105822f},
-std::array<float,2>{0.50807035f, 0.824221611f},
-std::array<float,2>{0.935496807f, 0.107723944f},
-std::array<float,2>{0.225763127f, 0.612951517f},
-std::array<float,2>{0.124704503f, 0.168461531f},
-std::array<float,2>{0.775738895f, 0.70946008f},
-std::array<float,2>{0.725278378f, 0.398206323f},
-std::array<float,2>{0.357522726f, 0.888944268f},
-std::array<float,2>{0.0560409129f, 0.251007855f},
-std::array<float,2>{0.862189949f, 0.769152641f},
-std::array<float,2>{0.648199737f, 0.0525729619f},
-std::array<float,2>{0.296468556f, 0.527643979f},
-std::array<float,2>{0.436943918f, 0.201896235f},
-std::array<float,2>{0.576329708f, 0.63511312f},
-std::array<float,2>{0.980419159f, 0.465442568f},
-std::array<float,2>{0.149182156f, 0.943495154f},
-std::array<float,2>{0.337884158f, 0.42233783f},
-std::array<float,2>{0.701221764f, 0.913825393f},
-std::array<float,2>{0.789400995f, 0.138514116f},
-std::array<float,2>{0.0856322721f, 0.725051701f},
-std::array<float,2>{0.197652906f, 0.0796747729f},
-std::array<float,2>{0.892766058f, 0.574046552f},
-std::array<float,2>{0.556257367f, 0.360287666f},
-std::array<float,2>{0.491876066f, 0.858805776f},
-std::array<float,2>{0.0633644685f, 0.482303619f},
-std::array<float,2>{0.811499536f, 0.982692838f},
-std::array<float,2>{0.7129336f, 0.231187761f},
-std::array<float,2>{0.318353534f, 0.663078785f},
-std::array<float,2>{0.483934253f, 0.011415557f},
-std::array<float,2>{0.531481087f, 0.541335881f},
-std::array<float,2>{0.890280187f, 0.301836491f},
-std::array<float,2>{0.207891896f, 0.798215985f},
-std::array<float,2>{0.298938364f, 0.341360807f},
-std::array<float,2>{0.636846125f, 0.842101276f},
-std::array<float,2>{0.855063319f, 0.119636565f},
-std::array<float,2>{0.0357794538f, 0.597222567f},
-std::array<float,2>{0.137575939f, 0.181136817f},
-std::array<float,2>{0.995506525f, 0.689892709f},
-std::array<float,2>{0.578479946f, 0.384459972f},
-std::array<float,2>{0.418083608f, 0.892307878f},
-std::array<float,2>{0.235599861f, 0.275522232f},
-std::array<float,2>{0.913243175f, 0.756634951f},
-std::array<float,2>{0.52749306f, 0.0378585011f},
-std::array<float,2>{0.442364961f, 0.512324035f},
-std::array<float,2>{0.374665946f, 0.211933583f},
-std::array<float,2>{0.740953088f, 0.645579159f},
-std::array<float,2>{0.755578339f, 0.453069955f},
-std::array<float,2>{0.0995100811f, 0.963724732f},
-std::array<float,2>{0.378760904f, 0.414607048f},
-std::array<float,2>{0.61276263f, 0.924404025f},
-std::array<float,2>{0.960200489f, 0.151378259f},
-std::array<float,2>{0.16850251f, 0.742533028f},
-std::array<float,2>{0.00508679869f, 0.0773108453f},
-std::array<float,2>{0.836324096f, 0.585116148f},
-std::array<float,2>{0.680915415f, 0.356307536f},
-std::array<float,2>{0.252414495f, 0.87335366f},
-std::array<float,2>{0.176892757f, 0.39800024f},
-std::array<float,2>{0.952325463f, 0.888879418f},
-std::array<float,2>{0.599542737f, 0.168927088f},
-std::array<float,2>{0.398548722f, 0.709148109f},
-std::array<float,2>{0.273623616f, 0.107510924f},
-std::array<float,2>{0.664777815f, 0.613269269f},
-std::array<float,2>{0.823633611f, 0.313285112f},
-std::array<float,2>{0.0165178031f, 0.824585795f},
-std::array<float,2>{0.458633512f, 0.296160936f},
-std::array<float,2>{0.510010898f, 0.784888208f},
-std::array<float,2>{0.936748564f, 0.0224924851f},
-std::array<float,2>{0.222972453f, 0.547700644f},
-std::array<float,2>{0.12181142f, 0.236406997f},
-std::array<float,2>{0.773490727f, 0.686081886f},
-std::array<float,2>{0.724441588f, 0.489610255f},
-std::array<float,2>{0.356773347f, 0.992303491f},
-std::array<float,2>{0.0575741082f, 0.359881252f},
-std::array<float,2>{0.860593915f, 0.858412087f},
-std::array<float,2>{0.645247757f, 0.0799810588f},
-std::array<float,2>{0.293559223f, 0.573790729f},
-std::array<float,2>{0.433986336f, 0.138260379f},
-std::array<float,2>{0.574488759f, 0.724660039f},
-std::array<float,2>{0.978292704f, 0.42204231f},
-std::array<float,2>{0.15155682f, 0.913668215f},
-std::array<float,2>{0.339581639f, 0.465766162f},
-std::array<float,2>{0.700023651f, 0.943801165f},
-std::array<float,2>{0.792058706f, 0.201935098f},
-std::array<float,2>{0.0829773843f, 0.634807229f},
-std::array<float,2>{0.197095081f, 0.0522836968f},
-std::array<float,2>{0.891860843f, 0.527540505f},
-std::array<float,2>{0.558355689f, 0.251323223f},
-std::array<float,2>{0.489185601f, 0.769454598f},
-std::array<float,2>{0.0276745558f, 0.430269867f},
-std::array<float,2>{0.815575242f, 0.92102021f},
-std::array<float,2>{0.660681129f, 0.131921843f},
-std::array<float,2>{0.270553499f, 0.728647232f},
-std::array<float,2>{0.392643243f, 0.0911415815f},
-std::array<float,2>{0.604840577f, 0.569840193f},
-std::array<float,2>{0.942535162f, 0.373283833f},
-std::array<float,2>{0.18162562f, 0.847815752f},
-std::array<float,2>{0.34932372f, 0.265301377f},
-std::array<float,2>{0.731392562f, 0.779815912f},
-std::array<float,2>{0.772195756f, 0.0597924218f},
-std::array<float,2>{0.112125464f, 0.522882164f},
-std::array<float,2>{0.226640016f, 0.192703396f},
-std::array<float,2>{0.922380567f, 0.626192153f},
-std::array<float,2>{0.504489303f, 0.454090834f},
-std::array<float,2>{0.465550989f, 0.946289837f},
-std::array<float,2>{0.144898579f, 0.321262568f},
-std::array<float,2>{0.969373882f, 0.817190528f},
-std::array<float,2>{0.566572547f, 0.101181753f},
-std::array<float,2>{0.427511305f, 0.617855012f},
-std::array<float,2>{0.283665597f, 0.161776513f},
-std::array<float,2>{0.650095522f, 0.713293612f},
-std::array<float,2>{0.870538771f, 0.401606441f},
-std::array<float,2>{0.0492038913f, 0.877689481f},
-std::array<float,2>{0.499819756f, 0.49559027f},
-std::array<float,2>{0.548663378f, 0.987070143f},
-std::array<float,2>{0.904157162f, 0.245327502f},
-std::array<float,2>{0.18891573f, 0.675683856f},
-std::array<float,2>{0.0893694088f, 0.0292184278f},
-std::array<float,2>{0.788480639f, 0.558727145f},
-std::array<float,2>{0.694465041f, 0.288049549f},
-std::array<float,2>{0.334034383f, 0.794155478f},
-std::array<float,2>{0.214134216f, 0.438896865f},
-std::array<float,2>{0.882064998f, 0.959189475f},
-std::array<float,2>{0.541833103f, 0.205242664f},
-std::array<float,2>{0.475920826f, 0.652914405f},
-std::array<float,2>{0.324820489f, 0.0427478887f},
-std::array<float,2>{0.706979752f, 0.503919899f},
-std::array<float,2>{0.798348069f, 0.267188013f},
-std::array<float,2>{0.0713564157f, 0.76022625f},
-std::array<float,2>{0.407527804f, 0.348926246f},
-std::array<float,2>{0.593493342f, 0.865472734f},
-std::array<float,2>{0.987728655f, 0.0697022676f},
-std::array<float,2>{0.12503399f, 0.590505421f},
-std::array<float,2>{0.044726938f, 0.145216018f},
-std::array<float,2>{0.84833622f, 0.7372908f},
-std::array<float,2>{0.625019312f, 0.411070108f},
-std::array<float,2>{0.308281362f, 0.932370603f},
-std::array<float,2>{0.105098315f, 0.311277956f},
-std::array<float,2>{0.760807991f, 0.810947657f},
-std::array<float,2>{0.74720937f, 0.00753059518f},
-std::array<float,2>{0.3631078f, 0.536426961f},
-std::array<float,2>{0.445861071f, 0.226535872f},
-std::array<float,2>{0.517492175f, 0.667620659f},
-std::array<float,2>{0.920952797f, 0.473736078f},
-std::array<float,2>{0.24397473f, 0.976157844f},
-std::array<float,2>{0.262793779f, 0.381718129f},
-std::array<float,2>{0.678433895f, 0.905639231f},
-std::array<float,2>{0.831240833f, 0.177663043f},
-std::array<float,2>{0.0118227899f, 0.696121097f},
-std::array<float,2>{0.157146841f, 0.112820521f},
-std::array<float,2>{0.965630293f, 0.602654338f},
-std::array<float,2>{0.617882609f, 0.329752892f},
-std::array<float,2>{0.390471458f, 0.833112597f},
-std::array<float,2>{0.0335712917f, 0.460853428f},
-std::array<float,2>{0.856962681f, 0.94930321f},
-std::array<float,2>{0.636514127f, 0.189878955f},
-std::array<float,2>{0.304231167f, 0.630382419f},
-std::array<float,2>{0.416536897f, 0.0554871745f},
-std::array<float,2>{0.58357662f, 0.515980661f},
-std::array<float,2>{0.997427881f, 0.261610031f},
-std::array<float,2>{0.13571398f, 0.776726961f},
-std::array<float,2>{0.312827408f, 0.369971693f},
-std::array<float,2>{0.715911567f, 0.846778274f},
-std::array<float,2>{0.808120131f, 0.0859433338f},
-std::array<float,2>{0.0688912347f, 0.564123392f},
-std::array<float,2>{0.206234381f, 0.125328764f},
-std::array<float,2>{0.883894324f, 0.731820166f},
-std::array<float,2>{0.537173331f, 0.436950296f},
-std::array<float,2>{0.478650868f, 0.914948225f},
-std::array<float,2>{0.166586071f, 0.281489849f},
-std::array<float,2>{0.95555222f, 0.791136801f},
-std::array<float,2>{0.615755379f, 0.0259835832f},
-std::array<float,2>{0.380222142f, 0.555756569f},
-std::array<float,2>{0.254766852f, 0.246982396f},
-std::array<float,2>{0.685512125f, 0.676142454f},
-std::array<float,2>{0.840771735f, 0.496965706f},
-std::array<float,2>{0.00130706816f, 0.991093755f},
-std::array<float,2>{0.43791607f, 0.403361648f},
-std::array<float,2>{0.523466945f, 0.882577658f},
-std::array<float,2>{0.908757806f, 0.159798667f},
-std::array<float,2>{0.23953855f, 0.715680838f},
-std::array<float,2>{0.0967131555f, 0.0945671573f},
-std::array<float,2>{0.751211762f, 0.624015272f},
-std::array<float,2>{0.735883534f, 0.327814937f},
-std::array<float,2>{0.369137049f, 0.815947115f},
-std::array<float,2>{0.219860718f, 0.40937385f},
-std::array<float,2>{0.932309151f, 0.935169339f},
-std::array<float,2>{0.513585567f, 0.14373073f},
-std::array<float,2>{0.453694969f, 0.739703655f},
-std::array<float,2>{0.351961493f, 0.0662336871f},
-std::array<float,2>{0.721958041f, 0.587677717f},
-std::array<float,2>{0.780230641f, 0.347017169f},
-std::array<float,2>{0.119734146f, 0.8599599f},
-std::array<float,2>{0.406043887f, 0.271928787f},
-std::array<float,2>{0.594897509f, 0.762036979f},
-std::array<float,2>{0.946230233f, 0.043225579f},
-std::array<float,2>{0.17318891f, 0.50092119f},
-std::array<float,2>{0.0208142065f, 0.210266665f},
-std::array<float,2>{0.826987207f, 0.650521398f},
-std::array<float,2>{0.671136975f, 0.44258368f},
-std::array<float,2>{0.280693173f, 0.954134345f},
-std::array<float,2>{0.0789237767f, 0.33440268f},
-std::array<float,2>{0.793586433f, 0.829616845f},
-std::array<float,2>{0.696037352f, 0.116329893f},
-std::array<float,2>{0.342721403f, 0.606584549f},
-std::array<float,2>{0.485093802f, 0.173373371f},
-std::array<float,2>{0.558646858f, 0.700432837f},
-std::array<float,2>{0.898129523f, 0.375086308f},
-std::array<float,2>{0.201897204f, 0.900598586f},
-std::array<float,2>{0.292556614f, 0.46955198f},
-std::array<float,2>{0.643380821f, 0.969355941f},
-std::array<float,2>{0.863905907f, 0.222641617f},
-std::array<float,2>{0.0610851459f, 0.669475317f},
-std::array<float,2>{0.154139191f, 0.00171487895f},
-std::array<float,2>{0.984292507f, 0.531845629f},
-std::array<float,2>{0.57392627f, 0.307134598f},
-std::array<float,2>{0.433526278f, 0.806552052f},
-std::array<float,2>{0.11380294f, 0.388973027f},
-std::array<float,2>{0.765711963f, 0.895778537f},
-std::array<float,2>{0.730365872f, 0.183631808f},
-std::array<float,2>{0.344144583f, 0.692348897f},
-std::array<float,2>{0.462085754f, 0.123122036f},
-std::array<float,2>{0.502469003f, 0.60136348f},
-std::array<float,2>{0.928849578f, 0.338691443f},
-std::array<float,2>{0.231322274f, 0.8374542f},
-std::array<float,2>{0.268985331f, 0.300246507f},
-std::array<float,2>{0.658898354f, 0.803215146f},
-std::array<float,2>{0.817551851f, 0.0145611726f},
-std::array<float,2>{0.0242838971f, 0.544263482f},
-std::array<float,2>{0.18511726f, 0.228582442f},
-std::array<float,2>{0.940132439f, 0.656465888f},
-std::array<float,2>{0.608290672f, 0.477763265f},
-std::array<float,2>{0.39683485f, 0.980102777f},
-std::array<float,2>{0.194665208f, 0.354568869f},
-std::array<float,2>{0.89847213f, 0.868642032f},
-std::array<float,2>{0.551784694f, 0.0710034519f},
-std::array<float,2>{0.493559629f, 0.580721378f},
-std::array<float,2>{0.33199957f, 0.154210031f},
-std::array<float,2>{0.69094789f, 0.746541202f},
-std::array<float,2>{0.782151282f, 0.419322759f},
-std::array<float,2>{0.0909941196f, 0.927648187f},
-std::array<float,2>{0.425366461f, 0.447584033f},
-std::array<float,2>{0.563068569f, 0.965335429f},
-std::array<float,2>{0.975223303f, 0.215684563f},
-std::array<float,2>{0.142847791f, 0.640855968f},
-std::array<float,2>{0.051382307f, 0.0337060131f},
-std::array<float,2>{0.872546434f, 0.511445999f},
-std::array<float,2>{0.655294538f, 0.278894573f},
-std::array<float,2>{0.287284762f, 0.751319826f},
-std::array<float,2>{0.130787402f, 0.486478388f},
-std::array<float,2>{0.991921306f, 0.996264875f},
-std::array<float,2>{0.589130223f, 0.240940705f},
-std::array<float,2>{0.412583023f, 0.680347383f},
-std::array<float,2>{0.310653776f, 0.0178366844f},
-std::array<float,2>{0.629038036f, 0.552435398f},
-std::array<float,2>{0.847609997f, 0.289982438f},
-std::array<float,2>{0.0406821035f, 0.785775959f},
-std::array<float,2>{0.470492333f, 0.317585409f},
-std::array<float,2>{0.543584049f, 0.821118951f},
-std::array<float,2>{0.878257275f, 0.102355018f},
-std::array<float,2>{0.216565818f, 0.615596294f},
-std::array<float,2>{0.0763307139f, 0.16546984f},
-std::array<float,2>{0.800948381f, 0.706534922f},
-std::array<float,2>{0.709638655f, 0.393126249f},
-std::array<float,2>{0.322424382f, 0.88641727f},
-std::array<float,2>{0.0106145795f, 0.254672199f},
-std::array<float,2>{0.833744347f, 0.772466838f},
-std::array<float,2>{0.674152076f, 0.048653245f},
-std::array<float,2>{0.260253131f, 0.524982393f},
-std::array<float,2>{0.383672208f, 0.196908072f},
-std::array<float,2>{0.62130177f, 0.637673736f},
-std::array<float,2>{0.964523375f, 0.464494288f},
-std::array<float,2>{0.16368635f, 0.940823734f},
-std::array<float,2>{0.364803851f, 0.426418066f},
-std::array<float,2>{0.743191898f, 0.90762645f},
-std::array<float,2>{0.762236238f, 0.136452168f},
-std::array<float,2>{0.10821861f, 0.720072389f},
-std::array<float,2>{0.247120619f, 0.0843473077f},
-std::array<float,2>{0.917731225f, 0.574229598f},
-std::array<float,2>{0.519751847f, 0.363952905f},
-std::array<float,2>{0.451779097f, 0.855195582f},
-std::array<float,2>{0.101284966f, 0.450428188f},
-std::array<float,2>{0.756460726f, 0.961826384f},
-std::array<float,2>{0.738926768f, 0.212984964f},
-std::array<float,2>{0.372778475f, 0.646783233f},
-std::array<float,2>{0.444182187f, 0.0355714522f},
-std::array<float,2>{0.529861093f, 0.513911068f},
-std::array<float,2>{0.911993861f, 0.274620384f},
-std::array<float,2>{0.238018349f, 0.754275918f},
-std::array<float,2>{0.2500754f, 0.358344197f},
-std::array<float,2>{0.68242687f, 0.871631503f},
-std::array<float,2>{0.839482486f, 0.0755172297f},
-std::array<float,2>{0.00696618948f, 0.583117247f},
-std::array<float,2>{0.171864927f, 0.14909178f},
-std::array<float,2>{0.95767957f, 0.744745731f},
-std::array<float,2>{0.60995245f, 0.417808026f},
-std::array<float,2>{0.376554847f, 0.922330081f},
-std::array<float,2>{0.210413471f, 0.304312706f},
-std::array<float,2>{0.888625801f, 0.799864054f},
-std::array<float,2>{0.534819305f, 0.00894086808f},
-std::array<float,2>{0.481211066f, 0.540270805f},
-std::array<float,2>{0.319476426f, 0.232699752f},
-std::array<float,2>{0.712589741f, 0.661165357f},
-std::array<float,2>{0.809700251f, 0.483878076f},
-std::array<float,2>{0.0652147233f, 0.981880665f},
-std::array<float,2>{0.42094481f, 0.385267645f},
-std::array<float,2>{0.581776798f, 0.893405378f},
-std::array<float,2>{0.992756605f, 0.182445288f},
-std::array<float,2>{0.139305994f, 0.689334691f},
-std::array<float,2>{0.0373409837f, 0.117539257f},
-std::array<float,2>{0.852024794f, 0.594588041f},
-std::array<float,2>{0.640314877f, 0.342386901f},
-std::array<float,2>{0.29741919f, 0.840198874f},
-std::array<float,2>{0.150113508f, 0.424670488f},
-std::array<float,2>{0.979125381f, 0.912091136f},
-std::array<float,2>{0.577449441f, 0.138810635f},
-std::array<float,2>{0.435583711f, 0.724196553f},
-std::array<float,2>{0.295882225f, 0.0803089589f},
-std::array<float,2>{0.64654237f, 0.571140587f},
-std::array<float,2>{0.863135695f, 0.361998826f},
-std::array<float,2>{0.0548665784f, 0.856294632f},
-std::array<float,2>{0.490340292f, 0.253732592f},
-std::array<float,2>{0.555340528f, 0.76598537f},
-std::array<float,2>{0.894432306f, 0.0545367971f},
-std::array<float,2>{0.199017733f, 0.52954483f},
-std::array<float,2>{0.084225826f, 0.199924424f},
-std::array<float,2>{0.79014653f, 0.63474834f},
-std::array<float,2>{0.702650011f, 0.467706203f},
-std::array<float,2>{0.336765856f, 0.942301691f},
-std::array<float,2>{0.0175894313f, 0.315242887f},
-std::array<float,2>{0.82076627f, 0.827659786f},
-std::array<float,2>{0.666755378f, 0.106249571f},
-std::array<float,2>{0.275783151f, 0.610925913f},
-std::array<float,2>{0.40061456f, 0.170742676f},
-std::array<float,2>{0.600339472f, 0.707551777f},
-std::array<float,2>{0.949836671f, 0.396458119f},
-std::array<float,2>{0.17888695f, 0.887575507f},
-std::array<float,2>{0.358514041f, 0.490653932f},
-std::array<float,2>{0.725891054f, 0.995585144f},
-std::array<float,2>{0.777140319f, 0.234808683f},
-std::array<float,2>{0.123611115f, 0.683800817f},
-std::array<float,2>{0.225215822f, 0.0199228395f},
-std::array<float,2>{0.933887839f, 0.550021887f},
-std::array<float,2>{0.50894171f, 0.29430446f},
-std::array<float,2>{0.459280372f, 0.782796144f},
-std::array<float,2>{0.0469376594f, 0.400368929f},
-std::array<float,2>{0.868203521f, 0.875132501f},
-std::array<float,2>{0.650518954f, 0.163618669f},
-std::array<float,2>{0.281636596f, 0.712739468f},
-std::array<float,2>{0.429465562f, 0.0995154977f},
-std::array<float,2>{0.569288552f, 0.620808065f},
-std::array<float,2>{0.971104801f, 0.323026061f},
-std::array<float,2>{0.146876261f, 0.818992734f},
-std::array<float,2>{0.333146214f, 0.286545306f},
-std::array<float,2>{0.692767382f, 0.795396388f},
-std::array<float,2>{0.78554666f, 0.0305786021f},
-std::array<float,2>{0.0860263705f, 0.561507821f},
-std::array<float,2>{0.191313878f, 0.244044408f},
-std::array<float,2>{0.905489087f, 0.673150718f},
-std::array<float,2>{0.548847318f, 0.493471533f},
-std::array<float,2>{0.497283787f, 0.984941423f},
-std::array<float,2>{0.181800425f, 0.371716827f},
-std::array<float,2>{0.944558084f, 0.850834846f},
-std::array<float,2>{0.602635086f, 0.0923607126f},
-std::array<float,2>{0.39174521f, 0.566986859f},
-std::array<float,2>{0.273335218f, 0.129733741f},
-std::array<float,2>{0.663541734f, 0.728044569f},
-std::array<float,2>{0.813127398f, 0.433047354f},
-std::array<float,2>{0.0299692582f, 0.918822825f},
-std::array<float,2>{0.467775255f, 0.456669301f},
-std::array<float,2>{0.507479548f, 0.94910413f},
-std::array<float,2>{0.924162567f, 0.194441929f},
-std::array<float,2>{0.230179951f, 0.628245831f},
-std::array<float,2>{0.110118538f, 0.0619476773f},
-std::array<float,2>{0.770653486f, 0.521105111f},
-std::array<float,2>{0.733487368f, 0.261837155f},
-std::array<float,2>{0.350649208f, 0.778875887f},
-std::array<float,2>{0.246090725f, 0.475106388f},
-std::array<float,2>{0.918692768f, 0.973958671f},
-std::array<float,2>{0.517972291f, 0.224591374f},
-std::array<float,2>{0.447505951f, 0.6656003f},
-std::array<float,2>{0.36026001f, 0.00431736885f},
-std::array<float,2>{0.749630272f, 0.53762567f},
-std::array<float,2>{0.758819759f, 0.308847427f},
-std::array<float,2>{0.10249041f, 0.808615625f},
-std::array<float,2>{0.387750804f, 0.331694037f},
-std::array<float,2>{0.620451152f, 0.835713923f},
-std::array<float,2>{0.968509793f, 0.111041233f},
-std::array<float,2>{0.159048319f, 0.604410291f},
-std::array<float,2>{0.0151286237f, 0.17873998f},
-std::array<float,2>{0.829107642f, 0.698881447f},
-std::array<float,2>{0.676508844f, 0.380822927f},
-std::array<float,2>{0.264331788f, 0.903576791f},
-std::array<float,2>{0.0732186288f, 0.268437594f},
-std::array<float,2>{0.800259054f, 0.759529769f},
-std::array<float,2>{0.704593241f, 0.0399676859f},
-std::array<float,2>{0.327950031f, 0.506103158f},
-std::array<float,2>{0.474556297f, 0.203160107f},
-std::array<float,2>{0.539598823f, 0.655895174f},
-std::array<float,2>{0.879822612f, 0.440615535f},
-std::array<float,2>{0.210985556f, 0.958947957f},
-std::array<float,2>{0.306192398f, 0.412596285f},
-std::array<float,2>{0.627306104f, 0.930389106f},
-std::array<float,2>{0.850832462f, 0.147213191f},
-std::array<float,2>{0.046749007f, 0.735657573f},
-std::array<float,2>{0.127873331f, 0.0664996505f},
-std::array<float,2>{0.985319078f, 0.592692316f},
-std::array<float,2>{0.591032088f, 0.351461202f},
-std::array<float,2>{0.408810258f, 0.864937305f},
-std::array<float,2>{0.00295290956f, 0.498422146f},
-std::array<float,2>{0.843132973f, 0.988862455f},
-std::array<float,2>{0.685880721f, 0.248944014f},
-std::array<float,2>{0.257595122f, 0.679552138f},
-std::array<float,2>{0.382539362f, 0.0246890131f},
-std::array<float,2>{0.614175379f, 0.558284342f},
-std::array<float,2>{0.95404613f, 0.283325791f},
-std::array<float,2>{0.16591309f, 0.78968811f},
-std::array<float,2>{0.370833188f, 0.325313509f},
-std::array<float,2>{0.737098634f, 0.813903391f},
-std::array<float,2>{0.752923369f, 0.0973218679f},
-std::array<float,2>{0.095500946f, 0.621404111f},
-std::array<float,2>{0.241604671f, 0.156445876f},
-std::array<float,2>{0.906388879f, 0.717472196f},
-std::array<float,2>{0.525571585f, 0.405279666f},
-std::array<float,2>{0.441302657f, 0.880416632f},
-std::array<float,2>{0.133143067f, 0.258586556f},
-std::array<float,2>{0.998498976f, 0.774864376f},
-std::array<float,2>{0.585404992f, 0.0570509285f},
-std::array<float,2>{0.415851057f, 0.519396424f},
-std::array<float,2>{0.302182525f, 0.188396022f},
-std::array<float,2>{0.633402109f, 0.631046474f},
-std::array<float,2>{0.858889699f, 0.457139403f},
-std::array<float,2>{0.0319606289f, 0.95248276f},
-std::array<float,2>{0.476894289f, 0.434218317f},
-std::array<float,2>{0.535209f, 0.916193604f},
-std::array<float,2>{0.885063112f, 0.128821984f},
-std::array<float,2>{0.204908937f, 0.732892156f},
-std::array<float,2>{0.0669768378f, 0.0881121457f},
-std::array<float,2>{0.806391954f, 0.566375017f},
-std::array<float,2>{0.718414247f, 0.367580563f},
-std::array<float,2>{0.315016508f, 0.845131576f},
-std::array<float,2>{0.199774519f, 0.377455503f},
-std::array<float,2>{0.895476222f, 0.89990437f},
-std::array<float,2>{0.561527848f, 0.174466044f},
-std::array<float,2>{0.487541229f, 0.701204896f},
-std::array<float,2>{0.341632783f, 0.113633707f},
-std::array<float,2>{0.697320759f, 0.608035982f},
-std::array<float,2>{0.796627283f, 0.333138406f},
-std::array<float,2>{0.0805268958f, 0.831578076f},
-std::array<float,2>{0.431367278f, 0.305719942f},
-std::array<float,2>{0.57221812f, 0.807216823f},
-std::array<float,2>{0.980773866f, 0.00332073891f},
-std::array<float,2>{0.155593827f, 0.534926653f},
-std::array<float,2>{0.0598675907f, 0.219209835f},
-std::array<float,2>{0.866419554f, 0.670221686f},
-std::array<float,2>{0.6421507f, 0.47147581f},
-std::array<float,2>{0.289404094f, 0.971700847f},
-std::array<float,2>{0.118410401f, 0.345214248f},
-std::array<float,2>{0.778198242f, 0.862340331f},
-std::array<float,2>{0.719972372f, 0.0643801764f},
-std::array<float,2>{0.354735643f, 0.588754535f},
-std::array<float,2>{0.455103248f, 0.141353145f},
-std::array<float,2>{0.515143156f, 0.740423799f},
-std::array<float,2>{0.92989862f, 0.407489717f},
-std::array<float,2>{0.221737117f, 0.936190367f},
-std::array<float,2>{0.279007167f, 0.443675578f},
-std::array<float,2>{0.668391824f, 0.956368744f},
-std::array<float,2>{0.825334251f, 0.208166927f},
-std::array<float,2>{0.0215301979f, 0.650294781f},
-std::array<float,2>{0.174097165f, 0.0450397246f},
-std::array<float,2>{0.947571099f, 0.503275752f},
-std::array<float,2>{0.597652256f, 0.269800037f},
-std::array<float,2>{0.403180301f, 0.764486432f},
-std::array<float,2>{0.092391789f, 0.421731144f},
-std::array<float,2>{0.784016132f, 0.927741826f},
-std::array<float,2>{0.688684464f, 0.15470627f},
-std::array<float,2>{0.32853058f, 0.749785244f},
-std::array<float,2>{0.495907664f, 0.0726588964f},
-std::array<float,2>{0.553228974f, 0.579060972f},
-std::array<float,2>{0.902289569f, 0.352999955f},
-std::array<float,2>{0.191464305f, 0.869296372f},
-std::array<float,2>{0.286031038f, 0.279726446f},
-std::array<float,2>{0.65298146f, 0.752453089f},
-std::array<float,2>{0.873731196f, 0.0314255431f},
-std::array<float,2>{0.0534384996f, 0.507930398f},
-std::array<float,2>{0.141692698f, 0.217420965f},
-std::array<float,2>{0.973359108f, 0.644501805f},
-std::array<float,2>{0.566282868f, 0.446019262f},
-std::array<float,2>{0.423602551f, 0.968143106f},
-std::array<float,2>{0.234190211f, 0.336569935f},
-std::array<float,2>{0.926233411f, 0.838386774f},
-std::array<float,2>{0.501302421f, 0.12267217f},
-std::array<float,2>{0.464544296f, 0.598777473f},
-std::array<float,2>{0.346408337f, 0.186797291f},
-std::array<float,2>{0.727173984f, 0.694509089f},
-std::array<float,2>{0.7677266f, 0.388115764f},
-std::array<float,2>{0.115470365f, 0.898180664f},
-std::array<float,2>{0.395728588f, 0.480425447f},
-std::array<float,2>{0.606115937f, 0.977533221f},
-std::array<float,2>{0.938599765f, 0.228127047f},
-std::array<float,2>{0.185602114f, 0.659496069f},
-std::array<float,2>{0.0272261649f, 0.0123071205f},
-std::array<float,2>{0.819717884f, 0.54583019f},
-std::array<float,2>{0.656473041f, 0.29739368f},
-std::array<float,2>{0.266454846f, 0.801204801f},
-std::array<float,2>{0.1611166f, 0.462882668f},
-std::array<float,2>{0.961917877f, 0.937808573f},
-std::array<float,2>{0.623837411f, 0.198680371f},
-std::array<float,2>{0.385870665f, 0.638860106f},
-std::array<float,2>{0.25834161f, 0.0498549417f},
-std::array<float,2>{0.67226845f, 0.525495768f},
-std::array<float,2>{0.835930109f, 0.257737011f},
-std::array<float,2>{0.00957472716f, 0.770318925f},
-std::array<float,2>{0.449577689f, 0.365373909f},
-std::array<float,2>{0.522105634f, 0.852027059f},
-std::array<float,2>{0.915411949f, 0.0822668523f},
-std::array<float,2>{0.249427438f, 0.577961028f},
-std::array<float,2>{0.106801026f, 0.134007946f},
-std::array<float,2>{0.764685094f, 0.722562611f},
-std::array<float,2>{0.74579823f, 0.428160816f},
-std::array<float,2>{0.366676599f, 0.909789979f},
-std::array<float,2>{0.0414815024f, 0.292873263f},
-std::array<float,2>{0.845204771f, 0.788951635f},
-std::array<float,2>{0.632091582f, 0.0158136785f},
-std::array<float,2>{0.310020983f, 0.553772151f},
-std::array<float,2>{0.411492854f, 0.239856109f},
-std::array<float,2>{0.587070167f, 0.682503581f},
-std::array<float,2>{0.989672363f, 0.48454693f},
-std::array<float,2>{0.132187799f, 0.998886526f},
-std::array<float,2>{0.32135582f, 0.392479271f},
-std::array<float,2>{0.708393514f, 0.883316219f},
-std::array<float,2>{0.80379951f, 0.167138189f},
-std::array<float,2>{0.0744700581f, 0.703982294f},
-std::array<float,2>{0.218658969f, 0.105236158f},
-std::array<float,2>{0.876891136f, 0.614495218f},
-std::array<float,2>{0.545296669f, 0.319051385f},
-std::array<float,2>{0.471054077f, 0.82270962f},
-std::array<float,2>{0.0832375884f, 0.468558937f},
-std::array<float,2>{0.79139626f, 0.943068743f},
-std::array<float,2>{0.700368702f, 0.200904429f},
-std::array<float,2>{0.338606745f, 0.633235216f},
-std::array<float,2>{0.48965621f, 0.0534065142f},
-std::array<float,2>{0.557269096f, 0.530347943f},
-std::array<float,2>{0.890636921f, 0.252020836f},
-std::array<float,2>{0.196000114f, 0.767015338f},
-std::array<float,2>{0.29448846f, 0.362388879f},
-std::array<float,2>{0.645688415f, 0.857268035f},
-std::array<float,2>{0.859802723f, 0.0813950747f},
-std::array<float,2>{0.0577617586f, 0.572043359f},
-std::array<float,2>{0.151061043f, 0.139828846f},
-std::array<float,2>{0.976850748f, 0.72339958f},
-std::array<float,2>{0.575617433f, 0.425379515f},
-std::array<float,2>{0.434804112f, 0.911117852f},
-std::array<float,2>{0.223673522f, 0.29379046f},
-std::array<float,2>{0.935884476f, 0.782071233f},
-std::array<float,2>{0.511536837f, 0.0207577795f},
-std::array<float,2>{0.457847893f, 0.549737394f},
-std::array<float,2>{0.355587929f, 0.236203685f},
-std::array<float,2>{0.723088562f, 0.684736729f},
-std::array<float,2>{0.775116444f, 0.491873354f},
-std::array<float,2>{0.122256212f, 0.994743526f},
-std::array<float,2>{0.399689317f, 0.394905597f},
-std::array<float,2>{0.597895265f, 0.88842535f},
-std::array<float,2>{0.952106416f, 0.170911759f},
-std::array<float,2>{0.176216409f, 0.708821535f},
-std::array<float,2>{0.0171702784f, 0.107158475f},
-std::array<float,2>{0.822746277f, 0.609585285f},
-std::array<float,2>{0.665097237f, 0.31568101f},
-std::array<float,2>{0.275086522f, 0.82705909f},
-std::array<float,2>{0.169691995f, 0.416728109f},
-std::array<float,2>{0.959203005f, 0.923442602f},
-std::array<float,2>{0.612277448f, 0.150001064f},
-std::array<float,2>{0.37737596f, 0.745524764f},
-std::array<float,2>{0.253283381f, 0.0743525103f},
-std::array<float,2>{0.680442631f, 0.582971513f},
-std::array<float,2>{0.836924732f, 0.358829588f},
-std::array<float,2>{0.00458289031f, 0.872462392f},
-std::array<float,2>{0.443083942f, 0.273910254f},
-std::array<float,2>{0.528403044f, 0.755749404f},
-std::array<float,2>{0.912652135f, 0.0364381224f},
-std::array<float,2>{0.234967068f, 0.515613198f},
-std::array<float,2>{0.0980529562f, 0.214216217f},
-std::array<float,2>{0.754570067f, 0.647670925f},
-std::array<float,2>{0.741362929f, 0.449893802f},
-std::array<float,2>{0.373785019f, 0.962665796f},
-std::array<float,2>{0.0366832241f, 0.343647212f},
-std::array<float,2>{0.854124069f, 0.841491222f},
-std::array<float,2>{0.63802731f, 0.118923768f},
-std::array<float,2>{0.300072283f, 0.594934523f},
-std::array<float,2>{0.419493467f, 0.183239982f},
-std::array<float,2>{0.579274833f, 0.68819195f},
-std::array<float,2>{0.994993508f, 0.385782003f},
-std::array<float,2>{0.138280198f, 0.893793225f},
-std::array<float,2>{0.317266703f, 0.482759446f},
-std::array<float,2>{0.714379072f, 0.980642438f},
-std::array<float,2>{0.811890006f, 0.233736768f},
-std::array<float,2>{0.0639229119f, 0.660726309f},
-std::array<float,2>{0.208582133f, 0.00836919528f},
-std::array<float,2>{0.889634013f, 0.539681077f},
-std::array<float,2>{0.532986939f, 0.303007752f},
-std::array<float,2>{0.482483089f, 0.799419999f},
-std::array<float,2>{0.0128772268f, 0.379250228f},
-std::array<float,2>{0.830885887f, 0.903074324f},
-std::array<float,2>{0.678783357f, 0.178191215f},
-std::array<float,2>{0.262174606f, 0.697592795f},
-std::array<float,2>{0.389026791f, 0.110188246f},
-std::array<float,2>{0.619010508f, 0.605041087f},
-std::array<float,2>{0.966494203f, 0.331030339f},
-std::array<float,2>{0.158146486f, 0.834567845f},
-std::array<float,2>{0.361985654f, 0.309996843f},
-std::array<float,2>{0.746694624f, 0.809835017f},
-std::array<float,2>{0.759793878f, 0.00496902782f},
-std::array<float,2>{0.104358956f, 0.538363874f},
-std::array<float,2>{0.242694631f, 0.223609254f},
-std::array<float,2>{0.92085433f, 0.664838731f},
-std::array<float,2>{0.516325772f, 0.47591722f},
-std::array<float,2>{0.446776748f, 0.972804606f},
-std::array<float,2>{0.126467988f, 0.349827677f},
-std::array<float,2>{0.986762106f, 0.863631845f},
-std::array<float,2>{0.59223485f, 0.0677536353f},
-std::array<float,2>{0.407018661f, 0.593270838f},
-std::array<float,2>{0.307522267f, 0.148018256f},
-std::array<float,2>{0.626161039f, 0.734837592f},
-std::array<float,2>{0.84932965f, 0.413238108f},
-std::array<float,2>{0.0438116565f, 0.930853486f},
-std::array<float,2>{0.47467041f, 0.439619571f},
-std::array<float,2>{0.542502284f, 0.957827091f},
-std::array<float,2>{0.880870521f, 0.204177201f},
-std::array<float,2>{0.213632554f, 0.654679179f},
-std::array<float,2>{0.0703926831f, 0.0407418273f},
-std::array<float,2>{0.796882868f, 0.507514477f},
-std::array<float,2>{0.705983758f, 0.269175589f},
-std::array<float,2>{0.325196177f, 0.757882714f},
-std::array<float,2>{0.18760474f, 0.493000925f},
-std::array<float,2>{0.902858615f, 0.985521376f},
-std::array<float,2>{0.547699809f, 0.242712617f},
-std::array<float,2>{0.498419464f, 0.672611713f},
-std::array<float,2>{0.335213214f, 0.0298465285f},
-std::array<float,2>{0.693856895f, 0.562196374f},
-std::array<float,2>{0.787218392f, 0.285792857f},
-std::array<float,2>{0.0881258547f, 0.796033502f},
-std::array<float,2>{0.426392645f, 0.323943049f},
-std::array<float,2>{0.568060875f, 0.819377244f},
-std::array<float,2>{0.969877183f, 0.0980229601f},
-std::array<float,2>{0.146267012f, 0.619295895f},
-std::array<float,2>{0.0505828299f, 0.162523225f},
-std::array<float,2>{0.869403481f, 0.711352229f},
-std::array<float,2>{0.64868474f, 0.398688614f},
-std::array<float,2>{0.284370661f, 0.876045883f},
-std::array<float,2>{0.112581775f, 0.263053596f},
-std::array<float,2>{0.773254037f, 0.777804255f},
-std::array<float,2>{0.731492877f, 0.0614337139f},
-std::array<float,2>{0.348457634f, 0.520283639f},
-std::array<float,2>{0.465909451f, 0.193412542f},
-std::array<float,2>{0.505002379f, 0.627707124f},
-std::array<float,2>{0.923825502f, 0.455591232f},
-std::array<float,2>{0.227975667f, 0.947432518f},
-std::array<float,2>{0.270264596f, 0.431886137f},
-std::array<float,2>{0.661678016f, 0.919822454f},
-std::array<float,2>{0.815161288f, 0.13080807f},
-std::array<float,2>{0.0285809822f, 0.726869881f},
-std::array<float,2>{0.180412918f, 0.093311049f},
-std::array<float,2>{0.94218576f, 0.568300426f},
-std::array<float,2>{0.60421133f, 0.372584522f},
-std::array<float,2>{0.394379437f, 0.850423872f},
-std::array<float,2>{0.0622223355f, 0.471803308f},
-std::array<float,2>{0.86481601f, 0.971270263f},
-std::array<float,2>{0.643647969f, 0.219808504f},
-std::array<float,2>{0.291283339f, 0.671016455f},
-std::array<float,2>{0.431868792f, 0.00243314123f},
-std::array<float,2>{0.572327912f, 0.533265948f},
-std::array<float,2>{0.982702553f, 0.304920256f},
-std::array<float,2>{0.152435824f, 0.808415234f},
-std::array<float,2>{0.343693167f, 0.332243651f},
-std::array<float,2>{0.696904361f, 0.830196261f},
-std::array<float,2>{0.794356644f, 0.114548855f},
-std::array<float,2>{0.0794892758f, 0.608920217f},
-std::array<float,2>{0.203047514f, 0.175257027f},
-std::array<float,2>{0.897062302f, 0.703102589f},
-std::array<float,2>{0.560353577f, 0.37830165f},
-std::array<float,2>{0.485732794f, 0.899029374f},
-std::array<float,2>{0.172550306f, 0.270586431f},
-std::array<float,2>{0.947192609f, 0.764666915f},
-std::array<float,2>{0.594260991f, 0.0459952503f},
-std::array<float,2>{0.404507548f, 0.502780318f},
-std::array<float,2>{0.279624492f, 0.207126915f},
-std::array<float,2>{0.670180321f, 0.648748994f},
-std::array<float,2>{0.82751447f, 0.445105314f},
-std::array<float,2>{0.0198765621f, 0.955759287f},
-std::array<float,2>{0.454393446f, 0.407101631f},
-std::array<float,2>{0.512247622f, 0.93718791f},
-std::array<float,2>{0.933214486f, 0.142231017f},
-std::array<float,2>{0.219332814f, 0.741886079f},
-std::array<float,2>{0.120269425f, 0.0625520051f},
-std::array<float,2>{0.78070873f, 0.589043438f},
-std::array<float,2>{0.721616507f, 0.344357729f},
-std::array<float,2>{0.353065252f, 0.862104595f},
-std::array<float,2>{0.238342613f, 0.404797882f},
-std::array<float,2>{0.909557283f, 0.879245579f},
-std::array<float,2>{0.524771333f, 0.158115312f},
-std::array<float,2>{0.438595146f, 0.718633711f},
-std::array<float,2>{0.367916852f, 0.0965283215f},
-std::array<float,2>{0.735052466f, 0.622427523f},
-std::array<float,2>{0.750597119f, 0.324656934f},
-std::array<float,2>{0.0960775837f, 0.813328266f},
-std::array<float,2>{0.379522115f, 0.284361392f},
-std::array<float,2>{0.616233051f, 0.790261924f},
-std::array<float,2>{0.956846118f, 0.0243641771f},
-std::array<float,2>{0.167210042f, 0.557513893f},
-std::array<float,2>{0.000472918124f, 0.249619037f},
-std::array<float,2>{0.841524065f, 0.678656578f},
-std::array<float,2>{0.684197664f, 0.499429733f},
-std::array<float,2>{0.255371988f, 0.989734054f},
-std::array<float,2>{0.0697853193f, 0.368173391f},
-std::array<float,2>{0.807339489f, 0.844042599f},
-std::array<float,2>{0.715390205f, 0.0891066492f},
-std::array<float,2>{0.314023167f, 0.565104723f},
-std::array<float,2>{0.479769796f, 0.127064645f},
-std::array<float,2>{0.538447082f, 0.733531833f},
-std::array<float,2>{0.883118331f, 0.435181171f},
-std::array<float,2>{0.205442816f, 0.917916834f},
-std::array<float,2>{0.303234518f, 0.458083779f},
-std::array<float,2>{0.635600984f, 0.951200843f},
-std::array<float,2>{0.856366277f, 0.188622266f},
-std::array<float,2>{0.0346816666f, 0.632079124f},
-std::array<float,2>{0.136707798f, 0.0583277978f},
-std::array<float,2>{0.996929348f, 0.518376887f},
-std::array<float,2>{0.58238107f, 0.259234458f},
-std::array<float,2>{0.417868823f, 0.774142683f},
-std::array<float,2>{0.109112926f, 0.429478407f},
-std::array<float,2>{0.763457656f, 0.908231914f},
-std::array<float,2>{0.742506921f, 0.133186817f},
-std::array<float,2>{0.364148527f, 0.72156471f},
-std::array<float,2>{0.452957422f, 0.083631359f},
-std::array<float,2>{0.520691395f, 0.576992273f},
-std::array<float,2>{0.91675967f, 0.366662741f},
-std::array<float,2>{0.246172428f, 0.853491247f},
-std::array<float,2>{0.261562288f, 0.256570816f},
-std::array<float,2>{0.674991608f, 0.771328568f},
-std::array<float,2>{0.832782507f, 0.0490605235f},
-std::array<float,2>{0.0109550729f, 0.526528239f},
-std::array<float,2>{0.162847534f, 0.198092297f},
-std::array<float,2>{0.963051379f, 0.640544116f},
-std::array<float,2>{0.622426152f, 0.461545944f},
-std::array<float,2>{0.383828491f, 0.939046562f},
-std::array<float,2>{0.214885607f, 0.319586724f},
-std::array<float,2>{0.8775087f, 0.823357165f},
-std::array<float,2>{0.543947935f, 0.103891335f},
-std::array<float,2>{0.4689143f, 0.613668263f},
-std::array<float,2>{0.323323905f, 0.166088164f},
-std::array<float,2>{0.710376918f, 0.704776704f},
-std::array<float,2>{0.802473545f, 0.390802801f},
-std::array<float,2>{0.0773473978f, 0.884055734f},
-std::array<float,2>{0.414031029f, 0.486148953f},
-std::array<float,2>{0.58807981f, 0.999419749f},
-std::array<float,2>{0.990565181f, 0.239257812f},
-std::array<float,2>{0.129002765f, 0.682935774f},
-std::array<float,2>{0.0393119827f, 0.0169951133f},
-std::array<float,2>{0.846517146f, 0.553556859f},
-std::array<float,2>{0.630225182f, 0.29197225f},
-std::array<float,2>{0.312225759f, 0.787831008f},
-std::array<float,2>{0.144477218f, 0.446781725f},
-std::array<float,2>{0.975775003f, 0.96753937f},
-std::array<float,2>{0.563590884f, 0.218616843f},
-std::array<float,2>{0.424065024f, 0.643542945f},
-std::array<float,2>{0.288269788f, 0.0331343561f},
-std::array<float,2>{0.655068517f, 0.508981884f},
-std::array<float,2>{0.872012794f, 0.280896187f},
-std::array<float,2>{0.0520459786f, 0.753021896f},
-std::array<float,2>{0.492670655f, 0.352267832f},
-std::array<float,2>{0.551743031f, 0.87018615f},
-std::array<float,2>{0.900283873f, 0.0734475404f},
-std::array<float,2>{0.194037363f, 0.579292536f},
-std::array<float,2>{0.0908095688f, 0.156022102f},
-std::array<float,2>{0.782425642f, 0.748781204f},
-std::array<float,2>{0.689869404f, 0.419952184f},
-std::array<float,2>{0.330403239f, 0.929094791f},
-std::array<float,2>{0.0252578203f, 0.297937393f},
-std::array<float,2>{0.817056537f, 0.802673757f},
-std::array<float,2>{0.659707069f, 0.0129299127f},
-std::array<float,2>{0.268453091f, 0.546525419f},
-std::array<float,2>{0.3980501f, 0.227159217f},
-std::array<float,2>{0.609005749f, 0.658435762f},
-std::array<float,2>{0.940475941f, 0.479160428f},
-std::array<float,2>{0.183708385f, 0.978218555f},
-std::array<float,2>{0.34490642f, 0.386944354f},
-std::array<float,2>{0.728593588f, 0.896981776f},
-std::array<float,2>{0.766633272f, 0.18596527f},
-std::array<float,2>{0.114318408f, 0.693381488f},
-std::array<float,2>{0.231519237f, 0.12117181f},
-std::array<float,2>{0.928632617f, 0.59771359f},
-std::array<float,2>{0.503729343f, 0.337586462f},
-std::array<float,2>{0.461507529f, 0.839210391f},
-std::array<float,2>{0.124270573f, 0.489188194f},
-std::array<float,2>{0.776131213f, 0.993810415f},
-std::array<float,2>{0.725075126f, 0.237467632f},
-std::array<float,2>{0.358090848f, 0.68730098f},
-std::array<float,2>{0.46080777f, 0.022315111f},
-std::array<float,2>{0.508752406f, 0.548552394f},
-std::array<float,2>{0.935047925f, 0.295815438f},
-std::array<float,2>{0.226312041f, 0.783980906f},
-std::array<float,2>{0.27706477f, 0.314316124f},
-std::array<float,2>{0.667073846f, 0.826099813f},
-std::array<float,2>{0.821583688f, 0.109225199f},
-std::array<float,2>{0.0191365592f, 0.612164259f},
-std::array<float,2>{0.178460613f, 0.169581786f},
-std::array<float,2>{0.950605512f, 0.710878909f},
-std::array<float,2>{0.601499856f, 0.396748424f},
-std::array<float,2>{0.402307391f, 0.889934719f},
-std::array<float,2>{0.197838441f, 0.250394642f},
-std::array<float,2>{0.893282294f, 0.768371224f},
-std::array<float,2>{0.555694282f, 0.05109936f},
-std::array<float,2>{0.491406918f, 0.52839303f},
-std::array<float,2>{0.337337852f, 0.202408016f},
-std::array<float,2>{0.701923609f, 0.636294603f},
-std::array<float,2>{0.78993839f, 0.46606496f},
-std::array<float,2>{0.0853969082f, 0.94447881f},
-std::array<float,2>{0.437394798f, 0.423100144f},
-std::array<float,2>{0.576794624f, 0.912877381f},
-std::array<float,2>{0.979939759f, 0.137116715f},
-std::array<float,2>{0.148743421f, 0.726293981f},
-std::array<float,2>{0.056545902f, 0.0784969628f},
-std::array<float,2>{0.861611724f, 0.572296321f},
-std::array<float,2>{0.647694945f, 0.36041835f},
-std::array<float,2>{0.296347558f, 0.858336926f},
-std::array<float,2>{0.140550047f, 0.383030295f},
-std::array<float,2>{0.993373215f, 0.890821397f},
-std::array<float,2>{0.580684602f, 0.179798424f},
-std::array<float,2>{0.419933558f, 0.690556526f},
-std::array<float,2>{0.298807412f, 0.120833099f},
-std::array<float,2>{0.639255643f, 0.59620887f},
-std::array<float,2>{0.853499651f, 0.340704083f},
-std::array<float,2>{0.0389237478f, 0.843018115f},
-std::array<float,2>{0.481927931f, 0.301171988f},
-std::array<float,2>{0.533495128f, 0.797034621f},
-std::array<float,2>{0.88747412f, 0.0101989172f},
-std::array<float,2>{0.209113285f, 0.542332411f},
-std::array<float,2>{0.0660649687f, 0.231795713f},
-std::array<float,2>{0.808638632f, 0.663556457f},
-std::array<float,2>{0.710979283f, 0.481408209f},
-std::array<float,2>{0.318408728f, 0.983607113f},
-std::array<float,2>{0.00629578065f, 0.357404023f},
-std::array<float,2>{0.838350475f, 0.874754965f},
-std::array<float,2>{0.682804525f, 0.076585494f},
-std::array<float,2>{0.251488686f, 0.584185064f},
-std::array<float,2>{0.375681549f, 0.150865704f},
-std::array<float,2>{0.610817134f, 0.743520916f},
-std::array<float,2>{0.958474278f, 0.415077478f},
-std::array<float,2>{0.170250386f, 0.925576448f},
-std::array<float,2>{0.371802717f, 0.451576322f},
-std::array<float,2>{0.739683926f, 0.96388787f},
-std::array<float,2>{0.757567048f, 0.211325452f},
-std::array<float,2>{0.0996128768f, 0.645205677f},
-std::array<float,2>{0.236718103f, 0.038558647f},
-std::array<float,2>{0.91056478f, 0.512736797f},
-std::array<float,2>{0.530581653f, 0.277060002f},
-std::array<float,2>{0.444893897f, 0.757601261f},
-std::array<float,2>{0.0458761156f, 0.411729962f},
-std::array<float,2>{0.849933028f, 0.932864606f},
-std::array<float,2>{0.628044784f, 0.145886257f},
-std::array<float,2>{0.305063725f, 0.737314224f},
-std::array<float,2>{0.409218669f, 0.0685423091f},
-std::array<float,2>{0.58999896f, 0.591022491f},
-std::array<float,2>{0.985475123f, 0.3479684f},
-std::array<float,2>{0.128429577f, 0.866489172f},
-std::array<float,2>{0.32677725f, 0.265856177f},
-std::array<float,2>{0.704059303f, 0.761406779f},
-std::array<float,2>{0.799282193f, 0.0413010828f},
-std::array<float,2>{0.0736710653f, 0.505259514f},
-std::array<float,2>{0.212868556f, 0.206349209f},
-std::array<float,2>{0.880734563f, 0.653903723f},
-std::array<float,2>{0.540682971f, 0.43819055f},
-std::array<float,2>{0.473126113f, 0.960378528f},
-std::array<float,2>{0.159404755f, 0.32880491f},
-std::array<float,2>{0.966942132f, 0.832116306f},
-std::array<float,2>{0.619375706f, 0.11139892f},
-std::array<float,2>{0.386827081f, 0.601679623f},
-std::array<float,2>{0.265506804f, 0.175819322f},
-std::array<float,2>{0.677669644f, 0.697191477f},
-std::array<float,2>{0.828362703f, 0.382776231f},
-std::array<float,2>{0.0142032923f, 0.904414892f},
-std::array<float,2>{0.448929131f, 0.473035187f},
-std::array<float,2>{0.518652499f, 0.975576937f},
-std::array<float,2>{0.919840634f, 0.225057781f},
-std::array<float,2>{0.24484542f, 0.666910291f},
-std::array<float,2>{0.103371724f, 0.00597624714f},
-std::array<float,2>{0.758408248f, 0.535482883f},
-std::array<float,2>{0.748385489f, 0.311797798f},
-std::array<float,2>{0.361168414f, 0.81203562f},
-std::array<float,2>{0.229302824f, 0.454313219f},
-std::array<float,2>{0.924998164f, 0.945450485f},
-std::array<float,2>{0.506572008f, 0.191409722f},
-std::array<float,2>{0.467379034f, 0.625332057f},
-std::array<float,2>{0.349737585f, 0.059014421f},
-std::array<float,2>{0.732694447f, 0.521728039f},
-std::array<float,2>{0.77001518f, 0.264026076f},
-std::array<float,2>{0.111327834f, 0.780849338f},
-std::array<float,2>{0.391521513f, 0.37409395f},
-std::array<float,2>{0.602068663f, 0.849134564f},
-std::array<float,2>{0.943421602f, 0.090714924f},
-std::array<float,2>{0.18278411f, 0.56893146f},
-std::array<float,2>{0.0308412258f, 0.130916089f},
-std::array<float,2>{0.81370151f, 0.729502559f},
-std::array<float,2>{0.662486196f, 0.431131393f},
-std::array<float,2>{0.271755308f, 0.920003891f},
-std::array<float,2>{0.0877733976f, 0.288258731f},
-std::array<float,2>{0.786501765f, 0.793808103f},
-std::array<float,2>{0.692346096f, 0.0278578047f},
-std::array<float,2>{0.332554817f, 0.560013354f},
-std::array<float,2>{0.497037947f, 0.245071694f},
-std::array<float,2>{0.550081432f, 0.673937678f},
-std::array<float,2>{0.904646993f, 0.494847f},
-std::array<float,2>{0.190065175f, 0.987782776f},
-std::array<float,2>{0.282372147f, 0.401358634f},
-std::array<float,2>{0.651393056f, 0.878525734f},
-std::array<float,2>{0.867383599f, 0.160228416f},
-std::array<float,2>{0.0480569229f, 0.714271605f},
-std::array<float,2>{0.148348302f, 0.10012196f},
-std::array<float,2>{0.972475588f, 0.618849277f},
-std::array<float,2>{0.570052564f, 0.322058856f},
-std::array<float,2>{0.428636879f, 0.817915738f},
-std::array<float,2>{0.0225496162f, 0.441858768f},
-std::array<float,2>{0.824760854f, 0.953139007f},
-std::array<float,2>{0.66948545f, 0.209337354f},
-std::array<float,2>{0.277735114f, 0.652277112f},
-std::array<float,2>{0.403595001f, 0.0441578999f},
-std::array<float,2>{0.595931768f, 0.501347899f},
-std::array<float,2>{0.948656857f, 0.27287963f},
-std::array<float,2>{0.175347045f, 0.763349652f},
-std::array<float,2>{0.354433596f, 0.345846057f},
-std::array<float,2>{0.71907407f, 0.860928237f},
-std::array<float,2>{0.779015601f, 0.0651194006f},
-std::array<float,2>{0.11768619f, 0.586911082f},
-std::array<float,2>{0.220876411f, 0.142659351f},
-std::array<float,2>{0.931239784f, 0.738939941f},
-std::array<float,2>{0.514199615f, 0.40877378f},
-std::array<float,2>{0.456599385f, 0.93416518f},
-std::array<float,2>{0.154356733f, 0.30827716f},
-std::array<float,2>{0.981506824f, 0.805054128f},
-std::array<float,2>{0.571228325f, 0.000467339909f},
-std::array<float,2>{0.430265874f, 0.532700181f},
-std::array<float,2>{0.290149271f, 0.220841885f},
-std::array<float,2>{0.6406582f, 0.668204248f},
-std::array<float,2>{0.866188347f, 0.470331103f},
-std::array<float,2>{0.0592115261f, 0.970656216f},
-std::array<float,2>{0.48634997f, 0.376115203f},
-std::array<float,2>{0.56106019f, 0.902308106f},
-std::array<float,2>{0.895998836f, 0.172258362f},
-std::array<float,2>{0.200820401f, 0.699905097f},
-std::array<float,2>{0.081428051f, 0.115947977f},
-std::array<float,2>{0.795299053f, 0.605774164f},
-std::array<float,2>{0.699162066f, 0.335247189f},
-std::array<float,2>{0.340714246f, 0.828179717f},
-std::array<float,2>{0.203869328f, 0.435673386f},
-std::array<float,2>{0.886577845f, 0.915722072f},
-std::array<float,2>{0.536676109f, 0.12681894f},
-std::array<float,2>{0.47781834f, 0.731193244f},
-std::array<float,2>{0.316322118f, 0.0874420851f},
-std::array<float,2>{0.717353761f, 0.562975347f},
-std::array<float,2>{0.805185258f, 0.37060231f},
-std::array<float,2>{0.0682474077f, 0.845754921f},
-std::array<float,2>{0.414991707f, 0.260578543f},
-std::array<float,2>{0.584284544f, 0.776260078f},
-std::array<float,2>{0.999665797f, 0.0558412671f},
-std::array<float,2>{0.134030446f, 0.516622961f},
-std::array<float,2>{0.0322720855f, 0.191268802f},
-std::array<float,2>{0.857890129f, 0.628973067f},
-std::array<float,2>{0.633930564f, 0.459035188f},
-std::array<float,2>{0.301200777f, 0.950623155f},
-std::array<float,2>{0.0937910751f, 0.327134192f},
-std::array<float,2>{0.753093958f, 0.81505847f},
-std::array<float,2>{0.737514913f, 0.0955353603f},
-std::array<float,2>{0.369615138f, 0.6245718f},
-std::array<float,2>{0.439569235f, 0.159050077f},
-std::array<float,2>{0.526914239f, 0.716210067f},
-std::array<float,2>{0.907892406f, 0.403064132f},
-std::array<float,2>{0.240770862f, 0.881237745f},
-std::array<float,2>{0.256402403f, 0.497455299f},
-std::array<float,2>{0.687435448f, 0.992050707f},
-std::array<float,2>{0.842758358f, 0.247114569f},
-std::array<float,2>{0.00281177787f, 0.676930487f},
-std::array<float,2>{0.164985761f, 0.026457129f},
-std::array<float,2>{0.954338431f, 0.554717898f},
-std::array<float,2>{0.614324927f, 0.282467365f},
-std::array<float,2>{0.381084085f, 0.792871654f},
-std::array<float,2>{0.0759881511f, 0.394252568f},
-std::array<float,2>{0.802854896f, 0.885572374f},
-std::array<float,2>{0.707620859f, 0.164955631f},
-std::array<float,2>{0.321068615f, 0.705703974f},
-std::array<float,2>{0.472475231f, 0.103431337f},
-std::array<float,2>{0.54651624f, 0.61687398f},
-std::array<float,2>{0.875336766f, 0.31657204f},
-std::array<float,2>{0.217008829f, 0.821802914f},
-std::array<float,2>{0.309017152f, 0.291006386f},
-std::array<float,2>{0.63135463f, 0.787018538f},
-std::array<float,2>{0.844666421f, 0.0194378197f},
-std::array<float,2>{0.0421234779f, 0.551197052f},
-std::array<float,2>{0.131051898f, 0.241623402f},
-std::array<float,2>{0.988356471f, 0.681428075f},
-std::array<float,2>{0.585945785f, 0.488132626f},
-std::array<float,2>{0.410283059f, 0.997888267f},
-std::array<float,2>{0.248313472f, 0.364858776f},
-std::array<float,2>{0.914370239f, 0.853858352f},
-std::array<float,2>{0.522464216f, 0.0854528323f},
-std::array<float,2>{0.451009154f, 0.57609129f},
-std::array<float,2>{0.365569562f, 0.135452628f},
-std::array<float,2>{0.744456589f, 0.719399333f},
-std::array<float,2>{0.764370501f, 0.427543253f},
-std::array<float,2>{0.106357843f, 0.906543136f},
-std::array<float,2>{0.3850362f, 0.463081449f},
-std::array<float,2>{0.624249041f, 0.940060794f},
-std::array<float,2>{0.961797297f, 0.19533059f},
-std::array<float,2>{0.161981925f, 0.637958109f},
-std::array<float,2>{0.00819013733f, 0.047149118f},
-std::array<float,2>{0.834370673f, 0.52369231f},
-std::array<float,2>{0.672967017f, 0.25546217f},
-std::array<float,2>{0.259143353f, 0.772085428f},
-std::array<float,2>{0.186860278f, 0.477212489f},
-std::array<float,2>{0.938386738f, 0.979193926f},
-std::array<float,2>{0.606781602f, 0.22952646f},
-std::array<float,2>{0.395245463f, 0.657722116f},
-std::array<float,2>{0.267003149f, 0.014886274f},
-std::array<float,2>{0.657802939f, 0.543099761f},
-std::array<float,2>{0.818580329f, 0.299609214f},
-std::array<float,2>{0.0261438265f, 0.804363966f},
-std::array<float,2>{0.463601053f, 0.339801282f},
-std::array<float,2>{0.500879109f, 0.836134493f},
-std::array<float,2>{0.926922739f, 0.124768525f},
-std::array<float,2>{0.23263739f, 0.600358844f},
-std::array<float,2>{0.116288193f, 0.18529959f},
-std::array<float,2>{0.768864095f, 0.693157971f},
-std::array<float,2>{0.727667153f, 0.389685482f},
-std::array<float,2>{0.346957088f, 0.894668877f},
-std::array<float,2>{0.0541841201f, 0.277804047f},
-std::array<float,2>{0.874933898f, 0.750413835f},
-std::array<float,2>{0.654224396f, 0.0342273898f},
-std::array<float,2>{0.287062109f, 0.510265887f},
-std::array<float,2>{0.422153503f, 0.216201082f},
-std::array<float,2>{0.564787328f, 0.642376721f},
-std::array<float,2>{0.974021256f, 0.448440582f},
-std::array<float,2>{0.140674487f, 0.966105938f},
-std::array<float,2>{0.329810411f, 0.41835928f},
-std::array<float,2>{0.687687695f, 0.925963759f},
-std::array<float,2>{0.784507573f, 0.152909085f},
-std::array<float,2>{0.0928812772f, 0.747128665f},
-std::array<float,2>{0.193095118f, 0.0721083358f},
-std::array<float,2>{0.90129292f, 0.581301332f},
-std::array<float,2>{0.554054618f, 0.354256749f},
-std::array<float,2>{0.495026022f, 0.867633939f},
-std::array<float,2>{0.0886057764f, 0.494416535f},
-std::array<float,2>{0.787811756f, 0.987964809f},
-std::array<float,2>{0.693793118f, 0.244279921f},
-std::array<float,2>{0.335783541f, 0.674387097f},
-std::array<float,2>{0.498787224f, 0.0276033618f},
-std::array<float,2>{0.547228932f, 0.56015259f},
-std::array<float,2>{0.902658522f, 0.288639575f},
-std::array<float,2>{0.188036904f, 0.793253779f},
-std::array<float,2>{0.285075366f, 0.321343124f},
-std::array<float,2>{0.649085701f, 0.817684591f},
-std::array<float,2>{0.869637072f, 0.0999017656f},
-std::array<float,2>{0.050207831f, 0.618238091f},
-std::array<float,2>{0.145850539f, 0.16069904f},
-std::array<float,2>{0.970395625f, 0.714550793f},
-std::array<float,2>{0.567773342f, 0.400713593f},
-std::array<float,2>{0.425966054f, 0.87836796f},
-std::array<float,2>{0.228355631f, 0.264265656f},
-std::array<float,2>{0.92293489f, 0.78062278f},
-std::array<float,2>{0.505455375f, 0.0593097433f},
-std::array<float,2>{0.466625243f, 0.52238065f},
-std::array<float,2>{0.347886413f, 0.191976607f},
-std::array<float,2>{0.731993198f, 0.625808895f},
-std::array<float,2>{0.77288276f, 0.455031574f},
-std::array<float,2>{0.112814143f, 0.946095169f},
-std::array<float,2>{0.394022614f, 0.43157053f},
-std::array<float,2>{0.603532135f, 0.920802116f},
-std::array<float,2>{0.941838145f, 0.1317662f},
-std::array<float,2>{0.180020377f, 0.730433285f},
-std::array<float,2>{0.0290079843f, 0.0898854882f},
-std::array<float,2>{0.814685106f, 0.568377197f},
-std::array<float,2>{0.661379039f, 0.374985069f},
-std::array<float,2>{0.269825488f, 0.849015772f},
-std::array<float,2>{0.157523707f, 0.382315099f},
-std::array<float,2>{0.966040492f, 0.905182838f},
-std::array<float,2>{0.618273199f, 0.176468506f},
-std::array<float,2>{0.389179677f, 0.696400642f},
-std::array<float,2>{0.262540221f, 0.112120122f},
-std::array<float,2>{0.679436207f, 0.602472305f},
-std::array<float,2>{0.830352306f, 0.328295857f},
-std::array<float,2>{0.013361319f, 0.832730532f},
-std::array<float,2>{0.447206348f, 0.312403709f},
-std::array<float,2>{0.51589179f, 0.811764956f},
-std::array<float,2>{0.920179605f, 0.00659927865f},
-std::array<float,2>{0.24236533f, 0.535930336f},
-std::array<float,2>{0.103516325f, 0.225300908f},
-std::array<float,2>{0.760533452f, 0.666232765f},
-std::array<float,2>{0.746157765f, 0.473148495f},
-std::array<float,2>{0.361557215f, 0.974892855f},
-std::array<float,2>{0.0432227105f, 0.348461926f},
-std::array<float,2>{0.848888099f, 0.867144585f},
-std::array<float,2>{0.626519442f, 0.0692317784f},
-std::array<float,2>{0.3071042f, 0.591326714f},
-std::array<float,2>{0.406638563f, 0.146469966f},
-std::array<float,2>{0.592598617f, 0.738240361f},
-std::array<float,2>{0.98717308f, 0.411224872f},
-std::array<float,2>{0.126406208f, 0.93339622f},
-std::array<float,2>{0.325842857f, 0.437962174f},
-std::array<float,2>{0.705119669f, 0.960564733f},
-std::array<float,2>{0.797790706f, 0.20685935f},
-std::array<float,2>{0.071034655f, 0.653592825f},
-std::array<float,2>{0.213100702f, 0.0417236909f},
-std::array<float,2>{0.881679773f, 0.505836606f},
-std::array<float,2>{0.542293608f, 0.266549975f},
-std::array<float,2>{0.475428373f, 0.761026084f},
-std::array<float,2>{0.00418521324f, 0.415633142f},
-std::array<float,2>{0.837473273f, 0.924961209f},
-std::array<float,2>{0.679852605f, 0.151099324f},
-std::array<float,2>{0.253676325f, 0.744067252f},
-std::array<float,2>{0.377523214f, 0.0769473463f},
-std::array<float,2>{0.611560464f, 0.584595501f},
-std::array<float,2>{0.959769249f, 0.356630445f},
-std::array<float,2>{0.169219285f, 0.874473095f},
-std::array<float,2>{0.373305261f, 0.276373774f},
-std::array<float,2>{0.741795063f, 0.757288575f},
-std::array<float,2>{0.754242957f, 0.0387820974f},
-std::array<float,2>{0.0986062735f, 0.513649583f},
-std::array<float,2>{0.234663129f, 0.211450502f},
-std::array<float,2>{0.912471354f, 0.644967556f},
-std::array<float,2>{0.528988123f, 0.451738209f},
-std::array<float,2>{0.442384988f, 0.964521885f},
-std::array<float,2>{0.137976363f, 0.34026441f},
-std::array<float,2>{0.994265854f, 0.843355536f},
-std::array<float,2>{0.580028534f, 0.120443776f},
-std::array<float,2>{0.41903609f, 0.596148849f},
-std::array<float,2>{0.300699681f, 0.180242002f},
-std::array<float,2>{0.63853997f, 0.691195309f},
-std::array<float,2>{0.853977144f, 0.383688807f},
-std::array<float,2>{0.036154002f, 0.891539752f},
-std::array<float,2>{0.48334074f, 0.480722696f},
-std::array<float,2>{0.532552779f, 0.984235883f},
-std::array<float,2>{0.889076829f, 0.23202467f},
-std::array<float,2>{0.208383352f, 0.663628757f},
-std::array<float,2>{0.0641251877f, 0.0103345318f},
-std::array<float,2>{0.812311888f, 0.542586207f},
-std::array<float,2>{0.714209378f, 0.301277161f},
-std::array<float,2>{0.316886127f, 0.797489464f},
-std::array<float,2>{0.195786312f, 0.466534704f},
-std::array<float,2>{0.891174197f, 0.945093095f},
-std::array<float,2>{0.556883872f, 0.202762038f},
-std::array<float,2>{0.490130842f, 0.63609606f},
-std::array<float,2>{0.338016331f, 0.0513804927f},
-std::array<float,2>{0.700961709f, 0.528895497f},
-std::array<float,2>{0.791553617f, 0.250723183f},
-std::array<float,2>{0.0836233422f, 0.76764673f},
-std::array<float,2>{0.435281664f, 0.361071467f},
-std::array<float,2>{0.576131701f, 0.857843876f},
-std::array<float,2>{0.977073252f, 0.0789767206f},
-std::array<float,2>{0.150639698f, 0.57287991f},
-std::array<float,2>{0.0583260879f, 0.137453899f},
-std::array<float,2>{0.860229492f, 0.725649714f},
-std::array<float,2>{0.64643991f, 0.423633546f},
-std::array<float,2>{0.293955684f, 0.912297726f},
-std::array<float,2>{0.122792393f, 0.294996262f},
-std::array<float,2>{0.77453804f, 0.783635378f},
-std::array<float,2>{0.723145545f, 0.0217265934f},
-std::array<float,2>{0.356439829f, 0.548107624f},
-std::array<float,2>{0.457082748f, 0.237815991f},
-std::array<float,2>{0.510853052f, 0.686843336f},
-std::array<float,2>{0.936299503f, 0.488327473f},
-std::array<float,2>{0.224194482f, 0.993336678f},
-std::array<float,2>{0.274668843f, 0.397058308f},
-std::array<float,2>{0.665692449f, 0.890432954f},
-std::array<float,2>{0.823118985f, 0.169234082f},
-std::array<float,2>{0.0167931691f, 0.710164964f},
-std::array<float,2>{0.176643878f, 0.108698443f},
-std::array<float,2>{0.951458335f, 0.611384273f},
-std::array<float,2>{0.59835428f, 0.313759476f},
-std::array<float,2>{0.400318295f, 0.825638473f},
-std::array<float,2>{0.0523327813f, 0.448752046f},
-std::array<float,2>{0.871431887f, 0.966760933f},
-std::array<float,2>{0.654313743f, 0.216612518f},
-std::array<float,2>{0.288753808f, 0.642007291f},
-std::array<float,2>{0.424769849f, 0.0351431742f},
-std::array<float,2>{0.564034402f, 0.509989619f},
-std::array<float,2>{0.976428151f, 0.278210968f},
-std::array<float,2>{0.143750757f, 0.750593901f},
-std::array<float,2>{0.330893874f, 0.353922963f},
-std::array<float,2>{0.690372288f, 0.867974401f},
-std::array<float,2>{0.783158064f, 0.0712973475f},
-std::array<float,2>{0.0902797654f, 0.581976652f},
-std::array<float,2>{0.193575397f, 0.152473673f},
-std::array<float,2>{0.899589658f, 0.747582793f},
-std::array<float,2>{0.550817728f, 0.418622732f},
-std::array<float,2>{0.492720038f, 0.926723719f},
-std::array<float,2>{0.184149116f, 0.299141496f},
-std::array<float,2>{0.941036284f, 0.803922534f},
-std::array<float,2>{0.608851373f, 0.0154871615f},
-std::array<float,2>{0.397802085f, 0.543534696f},
-std::array<float,2>{0.267664433f, 0.230189681f},
-std::array<float,2>{0.659360766f, 0.657286346f},
-std::array<float,2>{0.816764534f, 0.476723462f},
-std::array<float,2>{0.0245685689f, 0.978923976f},
-std::array<float,2>{0.46126619f, 0.390149057f},
-std::array<float,2>{0.503319442f, 0.895185053f},
-std::array<float,2>{0.928154588f, 0.184731588f},
-std::array<float,2>{0.232260182f, 0.692797244f},
-std::array<float,2>{0.115126222f, 0.124208614f},
-std::array<float,2>{0.767520726f, 0.599655867f},
-std::array<float,2>{0.729453146f, 0.339178264f},
-std::array<float,2>{0.345251799f, 0.836688221f},
-std::array<float,2>{0.247052625f, 0.426810473f},
-std::array<float,2>{0.916219175f, 0.907091022f},
-std::array<float,2>{0.521318853f, 0.134929135f},
-std::array<float,2>{0.452432811f, 0.719040036f},
-std::array<float,2>{0.363594741f, 0.0850132853f},
-std::array<float,2>{0.74276787f, 0.575459123f},
-std::array<float,2>{0.76306653f, 0.364442617f},
-std::array<float,2>{0.108604416f, 0.854288042f},
-std::array<float,2>{0.384557158f, 0.255043924f},
-std::array<float,2>{0.622939587f, 0.771870375f},
-std::array<float,2>{0.963516831f, 0.0475837775f},
-std::array<float,2>{0.162295237f, 0.524046183f},
-std::array<float,2>{0.0115904827f, 0.196009859f},
-std::array<float,2>{0.832065701f, 0.638354003f},
-std::array<float,2>{0.675722957f, 0.46376422f},
-std::array<float,2>{0.261161298f, 0.939550877f},
-std::array<float,2>{0.0780252144f, 0.317199111f},
-std::array<float,2>{0.801763117f, 0.821650267f},
-std::array<float,2>{0.71050179f, 0.10271623f},
-std::array<float,2>{0.324139863f, 0.61664927f},
-std::array<float,2>{0.469685435f, 0.164403319f},
-std::array<float,2>{0.544678628f, 0.705414116f},
-std::array<float,2>{0.87702316f, 0.393978775f},
-std::array<float,2>{0.215585157f, 0.884871423f},
-std::array<float,2>{0.311703563f, 0.487616628f},
-std::array<float,2>{0.630727589f, 0.99748081f},
-std::array<float,2>{0.845769107f, 0.242041752f},
-std::array<float,2>{0.0399834327f, 0.681121409f},
-std::array<float,2>{0.129523993f, 0.0189486388f},
-std::array<float,2>{0.991013229f, 0.551558912f},
-std::array<float,2>{0.588739097f, 0.290468544f},
-std::array<float,2>{0.413559526f, 0.786524057f},
-std::array<float,2>{0.0962750241f, 0.402671605f},
-std::array<float,2>{0.750085533f, 0.881378472f},
-std::array<float,2>{0.734423518f, 0.158641413f},
-std::array<float,2>{0.367656559f, 0.716378272f},
-std::array<float,2>{0.439427674f, 0.0948570445f},
-std::array<float,2>{0.525111616f, 0.624078393f},
-std::array<float,2>{0.909779429f, 0.326285332f},
-std::array<float,2>{0.238770157f, 0.814668f},
-std::array<float,2>{0.255030841f, 0.283136815f},
-std::array<float,2>{0.683851242f, 0.792214811f},
-std::array<float,2>{0.840999007f, 0.0269217547f},
-std::array<float,2>{0.000919851766f, 0.555253804f},
-std::array<float,2>{0.167695135f, 0.247844219f},
-std::array<float,2>{0.956424117f, 0.677482724f},
-std::array<float,2>{0.616977274f, 0.49766919f},
-std::array<float,2>{0.379368871f, 0.991505206f},
-std::array<float,2>{0.205839366f, 0.370829046f},
-std::array<float,2>{0.883374155f, 0.846463025f},
-std::array<float,2>{0.538891196f, 0.0869220123f},
-std::array<float,2>{0.480225056f, 0.563167989f},
-std::array<float,2>{0.313693225f, 0.125986233f},
-std::array<float,2>{0.714979708f, 0.730842173f},
-std::array<float,2>{0.806816816f, 0.436400622f},
-std::array<float,2>{0.0700649321f, 0.915526509f},
-std::array<float,2>{0.41715008f, 0.459818006f},
-std::array<float,2>{0.582653463f, 0.950721323f},
-std::array<float,2>{0.996275961f, 0.190816849f},
-std::array<float,2>{0.136036843f, 0.629463971f},
-std::array<float,2>{0.0345617831f, 0.056636177f},
-std::array<float,2>{0.85552448f, 0.517549753f},
-std::array<float,2>{0.634913802f, 0.25977248f},
-std::array<float,2>{0.302867949f, 0.775698602f},
-std::array<float,2>{0.153160274f, 0.469903886f},
-std::array<float,2>{0.983119786f, 0.970082045f},
-std::array<float,2>{0.573006034f, 0.221404374f},
-std::array<float,2>{0.432232946f, 0.668775618f},
-std::array<float,2>{0.291899383f, 0.000578867737f},
-std::array<float,2>{0.644248188f, 0.532900333f},
-std::array<float,2>{0.864509225f, 0.30775553f},
-std::array<float,2>{0.061656449f, 0.805374563f},
-std::array<float,2>{0.485926092f, 0.335611165f},
-std::array<float,2>{0.559978247f, 0.828860223f},
-std::array<float,2>{0.896905065f, 0.115377121f},
-std::array<float,2>{0.202273354f, 0.606337488f},
-std::array<float,2>{0.0800264627f, 0.172532454f},
-std::array<float,2>{0.794685721f, 0.699511647f},
-std::array<float,2>{0.696453333f, 0.376550645f},
-std::array<float,2>{0.342804998f, 0.901443064f},
-std::array<float,2>{0.0202265009f, 0.27300331f},
-std::array<float,2>{0.827815115f, 0.762893558f},
-std::array<float,2>{0.670737922f, 0.0449086651f},
-std::array<float,2>{0.279969215f, 0.501859426f},
-std::array<float,2>{0.404816389f, 0.209689036f},
-std::array<float,2>{0.593935728f, 0.651611388f},
-std::array<float,2>{0.946604311f, 0.44226715f},
-std::array<float,2>{0.171938404f, 0.953644574f},
-std::array<float,2>{0.352915674f, 0.40865761f},
-std::array<float,2>{0.720834136f, 0.933967113f},
-std::array<float,2>{0.780967832f, 0.143171638f},
-std::array<float,2>{0.120959908f, 0.738700867f},
-std::array<float,2>{0.218966067f, 0.0646355152f},
-std::array<float,2>{0.932950437f, 0.586248875f},
-std::array<float,2>{0.51190114f, 0.346512407f},
-std::array<float,2>{0.454758257f, 0.8604092f},
-std::array<float,2>{0.11053171f, 0.455170393f},
-std::array<float,2>{0.770354033f, 0.947966874f},
-std::array<float,2>{0.733187556f, 0.193906516f},
-std::array<float,2>{0.350469589f, 0.627083123f},
-std::array<float,2>{0.466918468f, 0.0608237647f},
-std::array<float,2>{0.506221414f, 0.520009339f},
-std::array<float,2>{0.925589025f, 0.263296753f},
-std::array<float,2>{0.228837177f, 0.778044403f},
-std::array<float,2>{0.272347689f, 0.372106135f},
-std::array<float,2>{0.662938952f, 0.849619806f},
-std::array<float,2>{0.814390838f, 0.0931541398f},
-std::array<float,2>{0.0307249017f, 0.567704141f},
-std::array<float,2>{0.183465004f, 0.130062565f},
-std::array<float,2>{0.944260776f, 0.727319837f},
-std::array<float,2>{0.601589084f, 0.432208002f},
-std::array<float,2>{0.390942812f, 0.919004917f},
-std::array<float,2>{0.189614639f, 0.285435021f},
-std::array<float,2>{0.90478909f, 0.796511531f},
-std::array<float,2>{0.550371528f, 0.0296285115f},
-std::array<float,2>{0.496409863f, 0.562000632f},
-std::array<float,2>{0.332238346f, 0.242612988f},
-std::array<float,2>{0.691466689f, 0.671953261f},
-std::array<float,2>{0.787008584f, 0.492206931f},
-std::array<float,2>{0.0872259587f, 0.985925853f},
-std::array<float,2>{0.427835286f, 0.399231642f},
-std::array<float,2>{0.569668412f, 0.876606345f},
-std::array<float,2>{0.971799195f, 0.162940934f},
-std::array<float,2>{0.147463903f, 0.71175319f},
-std::array<float,2>{0.0483429208f, 0.0983037725f},
-std::array<float,2>{0.868013978f, 0.619648159f},
-std::array<float,2>{0.652242899f, 0.323502868f},
-std::array<float,2>{0.282831997f, 0.819975913f},
-std::array<float,2>{0.128033072f, 0.413605452f},
-std::array<float,2>{0.98585391f, 0.931590438f},
-std::array<float,2>{0.590473294f, 0.147794455f},
-std::array<float,2>{0.410092294f, 0.735053957f},
-std::array<float,2>{0.305462569f, 0.0679825991f},
-std::array<float,2>{0.628843009f, 0.593073964f},
-std::array<float,2>{0.850407839f, 0.350317299f},
-std::array<float,2>{0.0454018824f, 0.863903761f},
-std::array<float,2>{0.473298669f, 0.268564224f},
-std::array<float,2>{0.54026413f, 0.758696437f},
-std::array<float,2>{0.880155921f, 0.0403649621f},
-std::array<float,2>{0.211967468f, 0.506842136f},
-std::array<float,2>{0.0738734826f, 0.204908311f},
-std::array<float,2>{0.799754441f, 0.655138373f},
-std::array<float,2>{0.703251958f, 0.440230697f},
-std::array<float,2>{0.326581448f, 0.957115889f},
-std::array<float,2>{0.0140495673f, 0.330248326f},
-std::array<float,2>{0.8288306f, 0.834383488f},
-std::array<float,2>{0.677233338f, 0.109598115f},
-std::array<float,2>{0.264794022f, 0.604579031f},
-std::array<float,2>{0.38724947f, 0.178318754f},
-std::array<float,2>{0.619775534f, 0.697781861f},
-std::array<float,2>{0.967716455f, 0.379409283f},
-std::array<float,2>{0.15993388f, 0.902475119f},
-std::array<float,2>{0.3607153f, 0.476158231f},
-std::array<float,2>{0.748696208f, 0.973149836f},
-std::array<float,2>{0.75817585f, 0.223001108f},
-std::array<float,2>{0.102985553f, 0.66417855f},
-std::array<float,2>{0.244592845f, 0.00565528916f},
-std::array<float,2>{0.919174254f, 0.538605034f},
-std::array<float,2>{0.519340873f, 0.310407847f},
-std::array<float,2>{0.448394507f, 0.810392499f},
-std::array<float,2>{0.0384875983f, 0.386237711f},
-std::array<float,2>{0.852817893f, 0.894176245f},
-std::array<float,2>{0.638732314f, 0.182638675f},
-std::array<float,2>{0.29789564f, 0.687595963f},
-std::array<float,2>{0.420706868f, 0.11847461f},
-std::array<float,2>{0.58013171f, 0.595229149f},
-std::array<float,2>{0.99368012f, 0.342967987f},
-std::array<float,2>{0.140048802f, 0.841260016f},
-std::array<float,2>{0.318991393f, 0.303331375f},
-std::array<float,2>{0.711645305f, 0.799058914f},
-std::array<float,2>{0.809520066f, 0.00791608449f},
-std::array<float,2>{0.0658084825f, 0.53913939f},
-std::array<float,2>{0.209507555f, 0.234373629f},
-std::array<float,2>{0.887049675f, 0.660335422f},
-std::array<float,2>{0.533947527f, 0.483121574f},
-std::array<float,2>{0.482014775f, 0.981090903f},
-std::array<float,2>{0.170454264f, 0.359099656f},
-std::array<float,2>{0.958810151f, 0.87294656f},
-std::array<float,2>{0.611093342f, 0.0748913959f},
-std::array<float,2>{0.375173658f, 0.582444429f},
-std::array<float,2>{0.251233041f, 0.149645388f},
-std::array<float,2>{0.683310628f, 0.745892704f},
-std::array<float,2>{0.83868587f, 0.416208029f},
-std::array<float,2>{0.00660223328f, 0.923134387f},
-std::array<float,2>{0.444410533f, 0.449414492f},
-std::array<float,2>{0.531203985f, 0.962289155f},
-std::array<float,2>{0.910966277f, 0.214533269f},
-std::array<float,2>{0.236849546f, 0.648116052f},
-std::array<float,2>{0.100525104f, 0.0367439128f},
-std::array<float,2>{0.757251859f, 0.514885008f},
-std::array<float,2>{0.739764273f, 0.274084806f},
-std::array<float,2>{0.371541083f, 0.755331159f},
-std::array<float,2>{0.225891337f, 0.491338283f},
-std::array<float,2>{0.93507719f, 0.994469285f},
-std::array<float,2>{0.508022785f, 0.235741302f},
-std::array<float,2>{0.460276097f, 0.685279191f},
-std::array<float,2>{0.357667178f, 0.0210713446f},
-std::array<float,2>{0.725344419f, 0.549156904f},
-std::array<float,2>{0.775399268f, 0.293447047f},
-std::array<float,2>{0.124953143f, 0.781645775f},
-std::array<float,2>{0.401775092f, 0.31632185f},
-std::array<float,2>{0.600647449f, 0.826352537f},
-std::array<float,2>{0.950690985f, 0.106864639f},
-std::array<float,2>{0.177776083f, 0.610267699f},
-std::array<float,2>{0.0186816771f, 0.171607658f},
-std::array<float,2>{0.821806133f, 0.708070993f},
-std::array<float,2>{0.667686641f, 0.395169079f},
-std::array<float,2>{0.276564687f, 0.887750208f},
-std::array<float,2>{0.0857711956f, 0.252757967f},
-std::array<float,2>{0.789177656f, 0.767133474f},
-std::array<float,2>{0.70156616f, 0.0528443344f},
-std::array<float,2>{0.33751446f, 0.531145155f},
-std::array<float,2>{0.492122442f, 0.200283557f},
-std::array<float,2>{0.556629777f, 0.633397281f},
-std::array<float,2>{0.892843902f, 0.467927754f},
-std::array<float,2>{0.197324187f, 0.942773283f},
-std::array<float,2>{0.296736389f, 0.424822807f},
-std::array<float,2>{0.648048162f, 0.91054225f},
-std::array<float,2>{0.861873329f, 0.140413746f},
-std::array<float,2>{0.0557337366f, 0.722985089f},
-std::array<float,2>{0.148933515f, 0.0819882303f},
-std::array<float,2>{0.980025768f, 0.571773648f},
-std::array<float,2>{0.576656163f, 0.362829536f},
-std::array<float,2>{0.436702847f, 0.856567442f},
-std::array<float,2>{0.0254288856f, 0.478547066f},
-std::array<float,2>{0.819127679f, 0.977564037f},
-std::array<float,2>{0.657686472f, 0.227040425f},
-std::array<float,2>{0.267366141f, 0.658720672f},
-std::array<float,2>{0.394717634f, 0.0134763308f},
-std::array<float,2>{0.607378244f, 0.546198666f},
-std::array<float,2>{0.937776208f, 0.29839462f},
-std::array<float,2>{0.18731001f, 0.802000523f},
-std::array<float,2>{0.347183526f, 0.337192625f},
-std::array<float,2>{0.728135824f, 0.839698434f},
-std::array<float,2>{0.769322753f, 0.121931054f},
-std::array<float,2>{0.116860665f, 0.598232687f},
-std::array<float,2>{0.233143196f, 0.186148867f},
-std::array<float,2>{0.927480698f, 0.694327414f},
-std::array<float,2>{0.500182927f, 0.38764891f},
-std::array<float,2>{0.46303314f, 0.896541238f},
-std::array<float,2>{0.141186863f, 0.280342191f},
-std::array<float,2>{0.974305153f, 0.753477097f},
-std::array<float,2>{0.565403163f, 0.0326595046f},
-std::array<float,2>{0.422583282f, 0.509617746f},
-std::array<float,2>{0.286506385f, 0.218102425f},
-std::array<float,2>{0.653419495f, 0.642908394f},
-std::array<float,2>{0.874070585f, 0.446655005f},
-std::array<float,2>{0.0545693673f, 0.966821313f},
-std::array<float,2>{0.494608223f, 0.420572311f},
-std::array<float,2>{0.554241836f, 0.929576576f},
-std::array<float,2>{0.90053457f, 0.155616656f},
-std::array<float,2>{0.192604437f, 0.748491883f},
-std::array<float,2>{0.0933420584f, 0.0737528354f},
-std::array<float,2>{0.785070002f, 0.579782963f},
-std::array<float,2>{0.688134193f, 0.351614654f},
-std::array<float,2>{0.329136819f, 0.870851934f},
-std::array<float,2>{0.217300192f, 0.39152199f},
-std::array<float,2>{0.875529885f, 0.884466887f},
-std::array<float,2>{0.546064734f, 0.16663231f},
-std::array<float,2>{0.472039551f, 0.704368949f},
-std::array<float,2>{0.320720196f, 0.104226664f},
-std::array<float,2>{0.707252085f, 0.614229858f},
-std::array<float,2>{0.803259492f, 0.320193559f},
-std::array<float,2>{0.075283058f, 0.824027061f},
-std::array<float,2>{0.410945237f, 0.291453063f},
-std::array<float,2>{0.586719871f, 0.787375391f},
-std::array<float,2>{0.989136159f, 0.017416032f},
-std::array<float,2>{0.131831512f, 0.552747965f},
-std::array<float,2>{0.042539984f, 0.238466427f},
-std::array<float,2>{0.844124854f, 0.68327409f},
-std::array<float,2>{0.631026745f, 0.48570931f},
-std::array<float,2>{0.309340179f, 0.99999392f},
-std::array<float,2>{0.105922669f, 0.367086083f},
-std::array<float,2>{0.763786972f, 0.852726758f},
-std::array<float,2>{0.744789004f, 0.0833641663f},
-std::array<float,2>{0.365737617f, 0.576231241f},
-std::array<float,2>{0.450229108f, 0.133574769f},
-std::array<float,2>{0.523203373f, 0.720852971f},
-std::array<float,2>{0.914615929f, 0.428726017f},
-std::array<float,2>{0.248584673f, 0.909102559f},
-std::array<float,2>{0.259380639f, 0.46113804f},
-std::array<float,2>{0.673390687f, 0.938900888f},
-std::array<float,2>{0.834670365f, 0.197461188f},
-std::array<float,2>{0.00865768455f, 0.639870524f},
-std::array<float,2>{0.161428481f, 0.0495785475f},
-std::array<float,2>{0.961387873f, 0.52685976f},
-std::array<float,2>{0.624585509f, 0.255883873f},
-std::array<float,2>{0.38542673f, 0.770843208f},
-std::array<float,2>{0.0677398965f, 0.434951097f},
-std::array<float,2>{0.805065632f, 0.917460442f},
-std::array<float,2>{0.717156529f, 0.127650276f},
-std::array<float,2>{0.315658927f, 0.734203577f},
-std::array<float,2>{0.478363961f, 0.0894754305f},
-std::array<float,2>{0.536180973f, 0.564791739f},
-std::array<float,2>{0.885980844f, 0.368948519f},
-std::array<float,2>{0.203556255f, 0.844387293f},
-std::array<float,2>{0.301523209f, 0.259571254f},
-std::array<float,2>{0.634513795f, 0.773681402f},
-std::array<float,2>{0.858155072f, 0.0580876246f},
-std::array<float,2>{0.0330274142f, 0.517769516f},
-std::array<float,2>{0.134287611f, 0.188980162f},
-std::array<float,2>{0.99911505f, 0.632434309f},
-std::array<float,2>{0.584960043f, 0.458937198f},
-std::array<float,2>{0.414390683f, 0.95183444f},
-std::array<float,2>{0.240442753f, 0.324723244f},
-std::array<float,2>{0.907619536f, 0.812601924f},
-std::array<float,2>{0.526606977f, 0.095885776f},
-std::array<float,2>{0.439990699f, 0.622691929f},
-std::array<float,2>{0.369836181f, 0.157643586f},
-std::array<float,2>{0.738050878f, 0.718174398f},
-std::array<float,2>{0.753492832f, 0.404474735f},
-std::array<float,2>{0.094389677f, 0.879483163f},
-std::array<float,2>{0.381717205f, 0.499955118f},
-std::array<float,2>{0.615018845f, 0.989881277f},
-std::array<float,2>{0.954660833f, 0.249398753f},
-std::array<float,2>{0.16446206f, 0.677800059f},
-std::array<float,2>{0.00230489275f, 0.023737438f},
-std::array<float,2>{0.842229307f, 0.557015717f},
-std::array<float,2>{0.686752856f, 0.285129726f},
-std::array<float,2>{0.256220073f, 0.790861964f},
-std::array<float,2>{0.175052479f, 0.444665998f},
-std::array<float,2>{0.949157655f, 0.955199599f},
-std::array<float,2>{0.596449673f, 0.207634926f},
-std::array<float,2>{0.404171526f, 0.649144709f},
-std::array<float,2>{0.277893513f, 0.0464037508f},
-std::array<float,2>{0.66899395f, 0.502338111f},
-std::array<float,2>{0.824575186f, 0.271087915f},
-std::array<float,2>{0.0231748354f, 0.765443087f},
-std::array<float,2>{0.456111521f, 0.344237834f},
-std::array<float,2>{0.513695657f, 0.861443698f},
-std::array<float,2>{0.930674851f, 0.063466385f},
-std::array<float,2>{0.221324876f, 0.589506507f},
-std::array<float,2>{0.117500372f, 0.14187701f},
-std::array<float,2>{0.778681695f, 0.741548479f},
-std::array<float,2>{0.719323158f, 0.406353772f},
-std::array<float,2>{0.353629559f, 0.936878622f},
-std::array<float,2>{0.0588620715f, 0.30563134f},
-std::array<float,2>{0.865370631f, 0.808030188f},
-std::array<float,2>{0.64126718f, 0.00286742928f},
-std::array<float,2>{0.291001916f, 0.533756971f},
-std::array<float,2>{0.430146545f, 0.220477417f},
-std::array<float,2>{0.570382893f, 0.671619833f},
-std::array<float,2>{0.982030511f, 0.472650677f},
-std::array<float,2>{0.155031234f, 0.97085315f},
-std::array<float,2>{0.340123057f, 0.378583252f},
-std::array<float,2>{0.69851315f, 0.898822069f},
-std::array<float,2>{0.795572162f, 0.17563045f},
-std::array<float,2>{0.0817057416f, 0.702408552f},
-std::array<float,2>{0.20042637f, 0.115050606f},
-std::array<float,2>{0.895901144f, 0.608802378f},
-std::array<float,2>{0.56082952f, 0.332983375f},
-std::array<float,2>{0.486963838f, 0.830912054f},
-std::array<float,2>{0.071805872f, 0.441066235f},
-std::array<float,2>{0.798025429f, 0.958300292f},
-std::array<float,2>{0.706259429f, 0.204044759f},
-std::array<float,2>{0.324562848f, 0.655522943f},
-std::array<float,2>{0.476136535f, 0.0391362682f},
-std::array<float,2>{0.541190326f, 0.506748676f},
-std::array<float,2>{0.882763684f, 0.267663926f},
-std::array<float,2>{0.214704409f, 0.75907439f},
-std::array<float,2>{0.307791322f, 0.350966036f},
-std::array<float,2>{0.625492811f, 0.864716411f},
-std::array<float,2>{0.848039091f, 0.0669815615f},
-std::array<float,2>{0.0442972854f, 0.592146873f},
-std::array<float,2>{0.125677973f, 0.146735832f},
-std::array<float,2>{0.987872362f, 0.736088932f},
-std::array<float,2>{0.593132615f, 0.412603319f},
-std::array<float,2>{0.407965124f, 0.929876029f},
-std::array<float,2>{0.243382454f, 0.309339643f},
-std::array<float,2>{0.921742558f, 0.80950284f},
-std::array<float,2>{0.516651869f, 0.00447837869f},
-std::array<float,2>{0.445470184f, 0.537283599f},
-std::array<float,2>{0.362598836f, 0.223792434f},
-std::array<float,2>{0.747994244f, 0.665430903f},
-std::array<float,2>{0.761288345f, 0.474876732f},
-std::array<float,2>{0.104578711f, 0.974562407f},
-std::array<float,2>{0.389971823f, 0.380346775f},
-std::array<float,2>{0.617199183f, 0.903966427f},
-std::array<float,2>{0.965094984f, 0.179332241f},
-std::array<float,2>{0.15646264f, 0.698373139f},
-std::array<float,2>{0.0125817722f, 0.110468835f},
-std::array<float,2>{0.831882536f, 0.60377574f},
-std::array<float,2>{0.677942038f, 0.331087172f},
-std::array<float,2>{0.26321131f, 0.834992349f},
-std::array<float,2>{0.181143582f, 0.433201671f},
-std::array<float,2>{0.942992151f, 0.918310881f},
-std::array<float,2>{0.605104625f, 0.129021585f},
-std::array<float,2>{0.39347738f, 0.727642119f},
-std::array<float,2>{0.271306634f, 0.0922844708f},
-std::array<float,2>{0.660441458f, 0.566539228f},
-std::array<float,2>{0.816141963f, 0.371384889f},
-std::array<float,2>{0.0280083548f, 0.851323009f},
-std::array<float,2>{0.464892477f, 0.262304068f},
-std::array<float,2>{0.504235327f, 0.77874434f},
-std::array<float,2>{0.921934724f, 0.0623109713f},
-std::array<float,2>{0.227527261f, 0.520764172f},
-std::array<float,2>{0.11179921f, 0.195211709f},
-std::array<float,2>{0.77172488f, 0.628514469f},
-std::array<float,2>{0.730914176f, 0.45618543f},
-std::array<float,2>{0.34908244f, 0.948676288f},
-std::array<float,2>{0.0496889539f, 0.32257393f},
-std::array<float,2>{0.870647371f, 0.818376243f},
-std::array<float,2>{0.649674952f, 0.098641783f},
-std::array<float,2>{0.283984303f, 0.620562792f},
-std::array<float,2>{0.427242458f, 0.163331524f},
-std::array<float,2>{0.567093372f, 0.712286294f},
-std::array<float,2>{0.968864799f, 0.399860442f},
-std::array<float,2>{0.145500317f, 0.875962377f},
-std::array<float,2>{0.33463046f, 0.494037867f},
-std::array<float,2>{0.695053875f, 0.984443009f},
-std::array<float,2>{0.788603008f, 0.24345392f},
-std::array<float,2>{0.0892360732f, 0.673397958f},
-std::array<float,2>{0.189278588f, 0.031133255f},
-std::array<float,2>{0.90339011f, 0.560733318f},
-std::array<float,2>{0.547914207f, 0.286830753f},
-std::array<float,2>{0.49926874f, 0.795590639f},
-std::array<float,2>{0.0156879574f, 0.395808816f},
-std::array<float,2>{0.823808372f, 0.886920273f},
-std::array<float,2>{0.664394319f, 0.169938624f},
-std::array<float,2>{0.274224102f, 0.707159579f},
-std::array<float,2>{0.399164766f, 0.105519772f},
-std::array<float,2>{0.598933995f, 0.610657156f},
-std::array<float,2>{0.952661932f, 0.314622343f},
-std::array<float,2>{0.177733749f, 0.827615619f},
-std::array<float,2>{0.357043684f, 0.294787139f},
-std::array<float,2>{0.72387135f, 0.782628f},
-std::array<float,2>{0.774056911f, 0.0200600736f},
-std::array<float,2>{0.121122792f, 0.550516546f},
-std::array<float,2>{0.22333242f, 0.235291928f},
-std::array<float,2>{0.937252223f, 0.684479058f},
-std::array<float,2>{0.510452032f, 0.490828067f},
-std::array<float,2>{0.458169013f, 0.996021688f},
-std::array<float,2>{0.152075768f, 0.361731619f},
-std::array<float,2>{0.977793574f, 0.855752528f},
-std::array<float,2>{0.575134993f, 0.0807544142f},
-std::array<float,2>{0.434139967f, 0.570669353f},
-std::array<float,2>{0.293108642f, 0.139442787f},
-std::array<float,2>{0.644860566f, 0.723641336f},
-std::array<float,2>{0.861148655f, 0.42408675f},
-std::array<float,2>{0.0566886477f, 0.911285579f},
-std::array<float,2>{0.488324344f, 0.4672153f},
-std::array<float,2>{0.558076024f, 0.941673279f},
-std::array<float,2>{0.892536163f, 0.199690536f},
-std::array<float,2>{0.196418718f, 0.634251058f},
-std::array<float,2>{0.08223515f, 0.0537365973f},
-std::array<float,2>{0.792521179f, 0.529913306f},
-std::array<float,2>{0.699288785f, 0.253232151f},
-std::array<float,2>{0.339235246f, 0.766566455f},
-std::array<float,2>{0.20721823f, 0.483975083f},
-std::array<float,2>{0.889761984f, 0.98233974f},
-std::array<float,2>{0.531799674f, 0.233229265f},
-std::array<float,2>{0.483761072f, 0.661672413f},
-std::array<float,2>{0.317516446f, 0.00953779835f},
-std::array<float,2>{0.71347487f, 0.540678203f},
-std::array<float,2>{0.810817242f, 0.304110289f},
-std::array<float,2>{0.0629724041f, 0.800463617f},
-std::array<float,2>{0.418536663f, 0.342168421f},
-std::array<float,2>{0.579027534f, 0.84070003f},
-std::array<float,2>{0.995871246f, 0.118105263f},
-std::array<float,2>{0.136736378f, 0.594121754f},
-std::array<float,2>{0.0354041196f, 0.181902781f},
-std::array<float,2>{0.854584098f, 0.688572466f},
-std::array<float,2>{0.637467563f, 0.38477093f},
-std::array<float,2>{0.299353063f, 0.892664611f},
-std::array<float,2>{0.099086687f, 0.274908811f},
-std::array<float,2>{0.755261242f, 0.75462997f},
-std::array<float,2>{0.740349174f, 0.0360965393f},
-std::array<float,2>{0.374168485f, 0.514465988f},
-std::array<float,2>{0.441824943f, 0.213717148f},
-std::array<float,2>{0.528196454f, 0.647456169f},
-std::array<float,2>{0.913910031f, 0.450931221f},
-std::array<float,2>{0.236183256f, 0.961335778f},
-std::array<float,2>{0.252449989f, 0.417045504f},
-std::array<float,2>{0.681575179f, 0.9225263f},
-std::array<float,2>{0.836752295f, 0.148492083f},
-std::array<float,2>{0.00548415724f, 0.744400918f},
-std::array<float,2>{0.168421969f, 0.0758142695f},
-std::array<float,2>{0.960844278f, 0.583566725f},
-std::array<float,2>{0.613279521f, 0.357530415f},
-std::array<float,2>{0.378102362f, 0.871426344f},
-std::array<float,2>{0.040366888f, 0.485024422f},
-std::array<float,2>{0.846747458f, 0.998075247f},
-std::array<float,2>{0.629395545f, 0.239416644f},
-std::array<float,2>{0.31116271f, 0.681849122f},
-std::array<float,2>{0.412726313f, 0.016382942f},
-std::array<float,2>{0.589790404f, 0.554657042f},
-std::array<float,2>{0.991237581f, 0.292227328f},
-std::array<float,2>{0.130291656f, 0.788352907f},
-std::array<float,2>{0.323209643f, 0.318678081f},
-std::array<float,2>{0.709124207f, 0.822849393f},
-std::array<float,2>{0.801348686f, 0.104813218f},
-std::array<float,2>{0.0767634287f, 0.614798188f},
-std::array<float,2>{0.216062218f, 0.167721376f},
-std::array<float,2>{0.87859416f, 0.703243077f},
-std::array<float,2>{0.542994261f, 0.391714215f},
-std::array<float,2>{0.47013399f, 0.883070767f},
-std::array<float,2>{0.163540617f, 0.257124931f},
-std::array<float,2>{0.963980734f, 0.769760787f},
-std::array<float,2>{0.621816158f, 0.0505155213f},
-std::array<float,2>{0.383271843f, 0.525948048f},
-std::array<float,2>{0.260671616f, 0.199217632f},
-std::array<float,2>{0.67466408f, 0.639578998f},
-std::array<float,2>{0.83317709f, 0.462319016f},
-std::array<float,2>{0.00981957372f, 0.938039899f},
-std::array<float,2>{0.451311529f, 0.428366363f},
-std::array<float,2>{0.520190299f, 0.909361243f},
-std::array<float,2>{0.917035699f, 0.13443929f},
-std::array<float,2>{0.247981578f, 0.72173357f},
-std::array<float,2>{0.107672662f, 0.0828487128f},
-std::array<float,2>{0.762155652f, 0.577553093f},
-std::array<float,2>{0.743862391f, 0.366178721f},
-std::array<float,2>{0.364420563f, 0.852464199f},
-std::array<float,2>{0.230890781f, 0.388217479f},
-std::array<float,2>{0.929337502f, 0.897939384f},
-std::array<float,2>{0.502022862f, 0.187040702f},
-std::array<float,2>{0.462749481f, 0.695255399f},
-std::array<float,2>{0.344485074f, 0.122456744f},
-std::array<float,2>{0.729807377f, 0.599162877f},
-std::array<float,2>{0.766140461f, 0.336180657f},
-std::array<float,2>{0.113421917f, 0.838129759f},
-std::array<float,2>{0.39745608f, 0.296909183f},
-std::array<float,2>{0.607585669f, 0.801475227f},
-std::array<float,2>{0.939842761f, 0.0121273408f},
-std::array<float,2>{0.184658289f, 0.545137286f},
-std::array<float,2>{0.0237475391f, 0.227773845f},
-std::array<float,2>{0.817936957f, 0.659902036f},
-std::array<float,2>{0.658527613f, 0.479701281f},
-std::array<float,2>{0.269091308f, 0.976889133f},
-std::array<float,2>{0.0917949975f, 0.353513122f},
-std::array<float,2>{0.781668544f, 0.870043039f},
-std::array<float,2>{0.690653145f, 0.0729606599f},
-std::array<float,2>{0.331055433f, 0.578570485f},
-std::array<float,2>{0.49376604f, 0.155074373f},
-std::array<float,2>{0.552259386f, 0.749296784f},
-std::array<float,2>{0.899358451f, 0.421073347f},
-std::array<float,2>{0.195238799f, 0.928525388f},
-std::array<float,2>{0.287905991f, 0.445585161f},
-std::array<float,2>{0.656127453f, 0.968266428f},
-std::array<float,2>{0.872577548f, 0.217180684f},
-std::array<float,2>{0.0510754064f, 0.643933833f},
-std::array<float,2>{0.143180922f, 0.0320274271f},
-std::array<float,2>{0.974860072f, 0.508788645f},
-std::array<float,2>{0.562954187f, 0.279824048f},
-std::array<float,2>{0.42484498f, 0.752413332f},
-std::array<float,2>{0.119587645f, 0.40797314f},
-std::array<float,2>{0.779782772f, 0.935768008f},
-std::array<float,2>{0.722232699f, 0.140881822f},
-std::array<float,2>{0.352185756f, 0.740935445f},
-std::array<float,2>{0.453137934f, 0.0636184663f},
-std::array<float,2>{0.513003647f, 0.588209391f},
-std::array<float,2>{0.931823611f, 0.345362514f},
-std::array<float,2>{0.220246896f, 0.863131344f},
-std::array<float,2>{0.281074643f, 0.27010408f},
-std::array<float,2>{0.671840727f, 0.764125884f},
-std::array<float,2>{0.826385438f, 0.0456142835f},
-std::array<float,2>{0.021382181f, 0.503753901f},
-std::array<float,2>{0.173397645f, 0.20865041f},
-std::array<float,2>{0.945428491f, 0.649576187f},
-std::array<float,2>{0.595446587f, 0.444073319f},
-std::array<float,2>{0.405696094f, 0.956979096f},
-std::array<float,2>{0.201519072f, 0.333638936f},
-std::array<float,2>{0.897846758f, 0.831498504f},
-std::array<float,2>{0.559516609f, 0.113919288f},
-std::array<float,2>{0.484629691f, 0.607425392f},
-std::array<float,2>{0.342200071f, 0.1741101f},
-std::array<float,2>{0.695623696f, 0.701953709f},
-std::array<float,2>{0.793076813f, 0.37742281f},
-std::array<float,2>{0.0784667432f, 0.899755001f},
-std::array<float,2>{0.432921022f, 0.470726192f},
-std::array<float,2>{0.573667407f, 0.97230792f},
-std::array<float,2>{0.98345685f, 0.21969974f},
-std::array<float,2>{0.153381333f, 0.670711577f},
-std::array<float,2>{0.0607753433f, 0.00359681062f},
-std::array<float,2>{0.863518953f, 0.53466028f},
-std::array<float,2>{0.64289695f, 0.306207329f},
-std::array<float,2>{0.292479724f, 0.80670172f},
-std::array<float,2>{0.135199755f, 0.457927644f},
-std::array<float,2>{0.997833252f, 0.952982962f},
-std::array<float,2>{0.583494902f, 0.187924325f},
-std::array<float,2>{0.416210443f, 0.631817281f},
-std::array<float,2>{0.303819239f, 0.0573095977f},
-std::array<float,2>{0.635942221f, 0.518903077f},
-std::array<float,2>{0.85654676f, 0.258239299f},
-std::array<float,2>{0.0340464748f, 0.775154531f},
-std::array<float,2>{0.479408473f, 0.367749542f},
-std::array<float,2>{0.53766185f, 0.845355511f},
-std::array<float,2>{0.884334207f, 0.0886830017f},
-std::array<float,2>{0.206945151f, 0.565791011f},
-std::array<float,2>{0.0687612891f, 0.128000751f},
-std::array<float,2>{0.807907522f, 0.73298806f},
-std::array<float,2>{0.716363788f, 0.433648556f},
-std::array<float,2>{0.313159138f, 0.916598797f},
-std::array<float,2>{0.00188009976f, 0.284079343f},
-std::array<float,2>{0.839873612f, 0.789463341f},
-std::array<float,2>{0.68465668f, 0.025358934f},
-std::array<float,2>{0.254387707f, 0.558031619f},
-std::array<float,2>{0.380610794f, 0.248075962f},
-std::array<float,2>{0.615664363f, 0.679153621f},
-std::array<float,2>{0.955653071f, 0.498561651f},
-std::array<float,2>{0.166497037f, 0.988556206f},
-std::array<float,2>{0.368419558f, 0.406189322f},
-std::array<float,2>{0.735787392f, 0.880100071f},
-std::array<float,2>{0.751683414f, 0.156819746f},
-std::array<float,2>{0.0976478755f, 0.716803789f},
-std::array<float,2>{0.239844024f, 0.0968555585f},
-std::array<float,2>{0.908303857f, 0.621807337f},
-std::array<float,2>{0.524288595f, 0.326094598f},
-std::array<float,2>{0.438061118f, 0.814243734f},
-std::array<float,2>{0.101672761f, 0.474302948f},
-std::array<float,2>{0.759375334f, 0.975919008f},
-std::array<float,2>{0.749034286f, 0.225858033f},
-std::array<float,2>{0.359853595f, 0.667439163f},
-std::array<float,2>{0.448140562f, 0.00702061737f},
-std::array<float,2>{0.51848346f, 0.537007272f},
-std::array<float,2>{0.918285549f, 0.310945272f},
-std::array<float,2>{0.245543003f, 0.811135828f},
-std::array<float,2>{0.26381287f, 0.329159409f},
-std::array<float,2>{0.676079929f, 0.833858073f},
-std::array<float,2>{0.829818845f, 0.112744987f},
-std::array<float,2>{0.0156098213f, 0.603297293f},
-std::array<float,2>{0.158253342f, 0.177188754f},
-std::array<float,2>{0.968196034f, 0.695460439f},
-std::array<float,2>{0.620812953f, 0.381268531f},
-std::array<float,2>{0.388494372f, 0.906109214f},
-std::array<float,2>{0.211705476f, 0.266744614f},
-std::array<float,2>{0.878935039f, 0.760305524f},
-std::array<float,2>{0.539516211f, 0.042094335f},
-std::array<float,2>{0.473798573f, 0.50459373f},
-std::array<float,2>{0.327333778f, 0.205628932f},
-std::array<float,2>{0.70436877f, 0.652609766f},
-std::array<float,2>{0.800589919f, 0.439129531f},
-std::array<float,2>{0.0724052042f, 0.959944189f},
-std::array<float,2>{0.408206493f, 0.410259515f},
-std::array<float,2>{0.591475606f, 0.932014108f},
-std::array<float,2>{0.984840572f, 0.144988626f},
-std::array<float,2>{0.127310798f, 0.736440897f},
-std::array<float,2>{0.0462971441f, 0.0699490607f},
-std::array<float,2>{0.851233542f, 0.590120614f},
-std::array<float,2>{0.627759218f, 0.349529803f},
-std::array<float,2>{0.305911571f, 0.866104603f},
-std::array<float,2>{0.147444412f, 0.401918977f},
-std::array<float,2>{0.971459389f, 0.877259076f},
-std::array<float,2>{0.568662465f, 0.161381438f},
-std::array<float,2>{0.428771287f, 0.71341902f},
-std::array<float,2>{0.28199783f, 0.100614071f},
-std::array<float,2>{0.65088886f, 0.61760205f},
-std::array<float,2>{0.869047403f, 0.320490509f},
-std::array<float,2>{0.047599908f, 0.816539645f},
-std::array<float,2>{0.497603148f, 0.287544847f},
-std::array<float,2>{0.549483538f, 0.794439375f},
-std::array<float,2>{0.906157136f, 0.0285582263f},
-std::array<float,2>{0.190707475f, 0.559346735f},
-std::array<float,2>{0.0865986645f, 0.245620579f},
-std::array<float,2>{0.785910964f, 0.675248682f},
-std::array<float,2>{0.693332136f, 0.495995313f},
-std::array<float,2>{0.333519638f, 0.986553431f},
-std::array<float,2>{0.0293491762f, 0.373543173f},
-std::array<float,2>{0.812623382f, 0.848407328f},
-std::array<float,2>{0.663784087f, 0.0915406868f},
-std::array<float,2>{0.272632539f, 0.569627166f},
-std::array<float,2>{0.392511994f, 0.132614523f},
-std::array<float,2>{0.603453398f, 0.72906214f},
-std::array<float,2>{0.9450984f, 0.429777443f},
-std::array<float,2>{0.182454303f, 0.921679437f},
-std::array<float,2>{0.351184517f, 0.453181416f},
-std::array<float,2>{0.733935595f, 0.947128654f},
-std::array<float,2>{0.771402836f, 0.193003789f},
-std::array<float,2>{0.109488331f, 0.62673068f},
-std::array<float,2>{0.229808077f, 0.0603145435f},
-std::array<float,2>{0.924765527f, 0.523250818f},
-std::array<float,2>{0.507322788f, 0.26467371f},
-std::array<float,2>{0.468584299f, 0.779735386f},
-std::array<float,2>{0.0554939769f, 0.42239958f},
-std::array<float,2>{0.862308204f, 0.913150668f},
-std::array<float,2>{0.64713347f, 0.137995243f},
-std::array<float,2>{0.295330912f, 0.725161254f},
-std::array<float,2>{0.436183274f, 0.0794618204f},
-std::array<float,2>{0.577984035f, 0.573709667f},
-std::array<float,2>{0.978959143f, 0.359596103f},
-std::array<float,2>{0.14958711f, 0.859123826f},
-std::array<float,2>{0.336245209f, 0.251559973f},
-std::array<float,2>{0.702482581f, 0.768830657f},
-std::array<float,2>{0.790685058f, 0.0521517657f},
-std::array<float,2>{0.0847727805f, 0.528021872f},
-std::array<float,2>{0.198254898f, 0.201509506f},
-std::array<float,2>{0.893732607f, 0.635254025f},
-std::array<float,2>{0.554908872f, 0.465199262f},
-std::array<float,2>{0.490875006f, 0.944198608f},
-std::array<float,2>{0.17924878f, 0.31275332f},
-std::array<float,2>{0.949421406f, 0.82492888f},
-std::array<float,2>{0.600049973f, 0.107990749f},
-std::array<float,2>{0.401213825f, 0.612376034f},
-std::array<float,2>{0.276223212f, 0.168443382f},
-std::array<float,2>{0.666193664f, 0.709775805f},
-std::array<float,2>{0.821012497f, 0.397908837f},
-std::array<float,2>{0.0183670614f, 0.889209867f},
-std::array<float,2>{0.459924668f, 0.489920408f},
-std::array<float,2>{0.509424865f, 0.993056715f},
-std::array<float,2>{0.934089065f, 0.236905828f},
-std::array<float,2>{0.224678293f, 0.685922444f},
-std::array<float,2>{0.123337366f, 0.0233934782f},
-std::array<float,2>{0.776766539f, 0.54730171f},
-std::array<float,2>{0.726376057f, 0.296847403f},
-std::array<float,2>{0.359162807f, 0.784213364f},
-std::array<float,2>{0.237318486f, 0.452318162f},
-std::array<float,2>{0.911430061f, 0.96332854f},
-std::array<float,2>{0.529315233f, 0.21255143f},
-std::array<float,2>{0.443774074f, 0.646211743f},
-std::array<float,2>{0.372311354f, 0.0375138186f},
-std::array<float,2>{0.738586068f, 0.511845112f},
-std::array<float,2>{0.756197512f, 0.276293457f},
-std::array<float,2>{0.101030432f, 0.756046951f},
-std::array<float,2>{0.376154423f, 0.355764627f},
-std::array<float,2>{0.609706819f, 0.873975754f},
-std::array<float,2>{0.957419276f, 0.0777790919f},
-std::array<float,2>{0.171034202f, 0.585792184f},
-std::array<float,2>{0.0077014626f, 0.152082339f},
-std::array<float,2>{0.839246154f, 0.74268055f},
-std::array<float,2>{0.682095647f, 0.414137065f},
-std::array<float,2>{0.250610292f, 0.924258411f},
-std::array<float,2>{0.0649361759f, 0.302682579f},
-std::array<float,2>{0.810281634f, 0.798370063f},
-std::array<float,2>{0.712270558f, 0.0109456787f},
-std::array<float,2>{0.320096731f, 0.541728854f},
-std::array<float,2>{0.480834574f, 0.230489671f},
-std::array<float,2>{0.534212768f, 0.662318766f},
-std::array<float,2>{0.888154685f, 0.481637627f},
-std::array<float,2>{0.210698396f, 0.983181834f},
-std::array<float,2>{0.297179163f, 0.383799702f},
-std::array<float,2>{0.639665306f, 0.891992688f},
-std::array<float,2>{0.852337837f, 0.181187227f},
-std::array<float,2>{0.0378267244f, 0.690052152f},
-std::array<float,2>{0.138824955f, 0.119607233f},
-std::array<float,2>{0.992256165f, 0.596895158f},
-std::array<float,2>{0.581061482f, 0.341063857f},
-std::array<float,2>{0.421803683f, 0.842668176f},
-std::array<float,2>{0.00890551135f, 0.463901073f},
-std::array<float,2>{0.834967256f, 0.94117558f},
-std::array<float,2>{0.672833502f, 0.196467385f},
-std::array<float,2>{0.258077472f, 0.637090862f},
-std::array<float,2>{0.386374414f, 0.0479089394f},
-std::array<float,2>{0.623268366f, 0.524869859f},
-std::array<float,2>{0.962757945f, 0.254307657f},
-std::array<float,2>{0.160290956f, 0.773199975f},
-std::array<float,2>{0.366744488f, 0.363498688f},
-std::array<float,2>{0.745444834f, 0.854789555f},
-std::array<float,2>{0.765241802f, 0.084754914f},
-std::array<float,2>{0.107296526f, 0.574718654f},
-std::array<float,2>{0.249824762f, 0.135867417f},
-std::array<float,2>{0.915793955f, 0.720547855f},
-std::array<float,2>{0.521626353f, 0.425866455f},
-std::array<float,2>{0.450139761f, 0.908181548f},
-std::array<float,2>{0.132360652f, 0.289170206f},
-std::array<float,2>{0.989977121f, 0.785235286f},
-std::array<float,2>{0.587815642f, 0.0184582416f},
-std::array<float,2>{0.411858857f, 0.551866591f},
-std::array<float,2>{0.31039989f, 0.240294531f},
-std::array<float,2>{0.632568061f, 0.679716885f},
-std::array<float,2>{0.845579684f, 0.486853004f},
-std::array<float,2>{0.0419149511f, 0.996817291f},
-std::array<float,2>{0.471488476f, 0.392822891f},
-std::array<float,2>{0.545732975f, 0.885937572f},
-std::array<float,2>{0.876442254f, 0.165916294f},
-std::array<float,2>{0.218145162f, 0.70679903f},
-std::array<float,2>{0.0749714226f, 0.102005318f},
-std::array<float,2>{0.80459857f, 0.616085827f},
-std::array<float,2>{0.708692551f, 0.31794849f},
-std::array<float,2>{0.322043329f, 0.820793808f},
-std::array<float,2>{0.192139596f, 0.419517845f},
-std::array<float,2>{0.901639283f, 0.926968753f},
-std::array<float,2>{0.55294919f, 0.153717205f},
-std::array<float,2>{0.495132267f, 0.746898711f},
-std::array<float,2>{0.328950524f, 0.0705953762f},
-std::array<float,2>{0.689395308f, 0.580105484f},
-std::array<float,2>{0.783504188f, 0.354990214f},
-std::array<float,2>{0.0920917988f, 0.868797123f},
-std::array<float,2>{0.423185796f, 0.27856794f},
-std::array<float,2>{0.565435886f, 0.751505494f},
-std::array<float,2>{0.972853363f, 0.0333993286f},
-std::array<float,2>{0.142100573f, 0.5112288f},
-std::array<float,2>{0.0527609922f, 0.214900717f},
-std::array<float,2>{0.873267055f, 0.641397715f},
-std::array<float,2>{0.652373731f, 0.448156029f},
-std::array<float,2>{0.285526723f, 0.965009212f},
-std::array<float,2>{0.116036542f, 0.338071406f},
-std::array<float,2>{0.76806891f, 0.836983919f},
-std::array<float,2>{0.726831079f, 0.123807512f},
-std::array<float,2>{0.34579283f, 0.600623488f},
-std::array<float,2>{0.463952035f, 0.184318885f},
-std::array<float,2>{0.501760423f, 0.691508353f},
-std::array<float,2>{0.926657081f, 0.389600426f},
-std::array<float,2>{0.233444154f, 0.896092355f},
-std::array<float,2>{0.266042024f, 0.478049219f},
-std::array<float,2>{0.656869769f, 0.979671776f},
-std::array<float,2>{0.820242465f, 0.229096875f},
-std::array<float,2>{0.0265865922f, 0.656810462f},
-std::array<float,2>{0.186464056f, 0.0140245343f},
-std::array<float,2>{0.939175904f, 0.544859409f},
-std::array<float,2>{0.605763733f, 0.300304919f},
-std::array<float,2>{0.396106988f, 0.803452909f},
-std::array<float,2>{0.0806506127f, 0.375951946f},
-std::array<float,2>{0.796370208f, 0.901018262f},
-std::array<float,2>{0.698073804f, 0.173162624f},
-std::array<float,2>{0.341005057f, 0.701149642f},
-std::array<float,2>{0.487912238f, 0.116916671f},
-std::array<float,2>{0.562260449f, 0.607185543f},
-std::array<float,2>{0.895012498f, 0.334485233f},
-std::array<float,2>{0.199290648f, 0.829422653f},
-std::array<float,2>{0.289870143f, 0.306836039f},
-std::array<float,2>{0.642050445f, 0.806029797f},
-std::array<float,2>{0.866806328f, 0.0013127944f},
-std::array<float,2>{0.0604225919f, 0.531567156f},
-std::array<float,2>{0.156184301f, 0.222163752f},
-std::array<float,2>{0.981228113f, 0.668975413f},
-std::array<float,2>{0.571668983f, 0.468755096f},
-std::array<float,2>{0.431121588f, 0.969089866f},
-std::array<float,2>{0.222634017f, 0.347264588f},
-std::array<float,2>{0.930207908f, 0.859769642f},
-std::array<float,2>{0.514813125f, 0.0658030435f},
-std::array<float,2>{0.456041366f, 0.587158084f},
-std::array<float,2>{0.355088323f, 0.144182801f},
-std::array<float,2>{0.7205562f, 0.740073204f},
-std::array<float,2>{0.777661324f, 0.409764022f},
-std::array<float,2>{0.118655875f, 0.934981108f},
-std::array<float,2>{0.402498066f, 0.44314906f},
-std::array<float,2>{0.596960485f, 0.954902112f},
-std::array<float,2>{0.948065281f, 0.210567191f},
-std::array<float,2>{0.174590975f, 0.650912583f},
-std::array<float,2>{0.0220354926f, 0.0438994095f},
-std::array<float,2>{0.825754285f, 0.500143707f},
-std::array<float,2>{0.668809116f, 0.271975517f},
-std::array<float,2>{0.278623551f, 0.762349665f},
-std::array<float,2>{0.165330365f, 0.49627614f},
-std::array<float,2>{0.953182161f, 0.990708709f},
-std::array<float,2>{0.613683164f, 0.246412531f},
-std::array<float,2>{0.381887913f, 0.676436722f},
-std::array<float,2>{0.256836563f, 0.0256624408f},
-std::array<float,2>{0.686110556f, 0.556314468f},
-std::array<float,2>{0.843728781f, 0.282068402f},
-std::array<float,2>{0.00357166864f, 0.791851878f},
-std::array<float,2>{0.44075346f, 0.327263981f},
-std::array<float,2>{0.526362002f, 0.815760732f},
-std::array<float,2>{0.906765401f, 0.0941067636f},
-std::array<float,2>{0.241712555f, 0.623324692f},
-std::array<float,2>{0.0947840586f, 0.159547299f},
-std::array<float,2>{0.752234161f, 0.715309381f},
-std::array<float,2>{0.736486018f, 0.404262155f},
-std::array<float,2>{0.370415866f, 0.881949186f},
-std::array<float,2>{0.0315670632f, 0.260889858f},
-std::array<float,2>{0.858433902f, 0.777223051f},
-std::array<float,2>{0.633110762f, 0.0551618263f},
-std::array<float,2>{0.302480519f, 0.51628226f},
-std::array<float,2>{0.415507555f, 0.190403953f},
-std::array<float,2>{0.585931718f, 0.630210817f},
-std::array<float,2>{0.998846829f, 0.460447907f},
-std::array<float,2>{0.133403257f, 0.949772418f},
-std::array<float,2>{0.314619929f, 0.437083095f},
-std::array<float,2>{0.717897415f, 0.914104819f},
-std::array<float,2>{0.805977404f, 0.125577182f},
-std::array<float,2>{0.0666535422f, 0.732406974f},
-std::array<float,2>{0.204504818f, 0.08656317f},
-std::array<float,2>{0.885343969f, 0.563841045f},
-std::array<float,2>{0.536063612f, 0.369197011f},
-std::array<float,2>{0.477331728f, 0.847299933f}}
\ No newline at end of file
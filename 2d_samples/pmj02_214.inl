@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.87313956f, 0.64201659f},
-std::array<float,2>{0.251205981f, 0.29196924f},
-std::array<float,2>{0.138916433f, 0.97276634f},
-std::array<float,2>{0.527260244f, 0.199216962f},
-std::array<float,2>{0.704676449f, 0.761006832f},
-std::array<float,2>{0.087358743f, 0.00851761643f},
-std::array<float,2>{0.380357713f, 0.546306849f},
-std::array<float,2>{0.969933331f, 0.458093703f},
-std::array<float,2>{0.591180027f, 0.605426311f},
-std::array<float,2>{0.187912315f, 0.409272462f},
-std::array<float,2>{0.37006098f, 0.841034472f},
-std::array<float,2>{0.77792424f, 0.112140052f},
-std::array<float,2>{0.904640853f, 0.875493407f},
-std::array<float,2>{0.458926916f, 0.183456972f},
-std::array<float,2>{0.0529965498f, 0.711931288f},
-std::array<float,2>{0.652514517f, 0.322637737f},
-std::array<float,2>{0.938299775f, 0.513060331f},
-std::array<float,2>{0.433350116f, 0.4809919f},
-std::array<float,2>{0.111443967f, 0.811936677f},
-std::array<float,2>{0.744421244f, 0.0342536531f},
-std::array<float,2>{0.537572026f, 0.965396702f},
-std::array<float,2>{0.162327424f, 0.23376371f},
-std::array<float,2>{0.283159912f, 0.684300601f},
-std::array<float,2>{0.838972211f, 0.264873207f},
-std::array<float,2>{0.661413968f, 0.747632921f},
-std::array<float,2>{0.0109074153f, 0.346199185f},
-std::array<float,2>{0.48643434f, 0.906427145f},
-std::array<float,2>{0.937254727f, 0.127990797f},
-std::array<float,2>{0.80844295f, 0.847719431f},
-std::array<float,2>{0.329358876f, 0.0811414942f},
-std::array<float,2>{0.227886438f, 0.592393041f},
-std::array<float,2>{0.624805868f, 0.382265508f},
-std::array<float,2>{0.763868868f, 0.570105731f},
-std::array<float,2>{0.34679848f, 0.403400928f},
-std::array<float,2>{0.20999828f, 0.86255151f},
-std::array<float,2>{0.56583178f, 0.0724949837f},
-std::array<float,2>{0.625435889f, 0.925566018f},
-std::array<float,2>{0.0386925563f, 0.150090948f},
-std::array<float,2>{0.442222208f, 0.729904354f},
-std::array<float,2>{0.876989007f, 0.374304771f},
-std::array<float,2>{0.505009592f, 0.661521375f},
-std::array<float,2>{0.147285208f, 0.279569745f},
-std::array<float,2>{0.280541837f, 0.944639087f},
-std::array<float,2>{0.849792063f, 0.246828452f},
-std::array<float,2>{0.987092733f, 0.793686986f},
-std::array<float,2>{0.400659412f, 0.0505509563f},
-std::array<float,2>{0.0680433884f, 0.522094131f},
-std::array<float,2>{0.697546661f, 0.491987556f},
-std::array<float,2>{0.918400943f, 0.694997072f},
-std::array<float,2>{0.478141457f, 0.335530281f},
-std::array<float,2>{0.0157331657f, 0.895743847f},
-std::array<float,2>{0.684596241f, 0.168882757f},
-std::array<float,2>{0.600735784f, 0.817068875f},
-std::array<float,2>{0.235684052f, 0.105392002f},
-std::array<float,2>{0.316177845f, 0.619851589f},
-std::array<float,2>{0.791605592f, 0.437273353f},
-std::array<float,2>{0.730966628f, 0.559729218f},
-std::array<float,2>{0.0994832441f, 0.447629243f},
-std::array<float,2>{0.414111137f, 0.776486635f},
-std::array<float,2>{0.954149902f, 0.0156735107f},
-std::array<float,2>{0.825449407f, 0.991230607f},
-std::array<float,2>{0.311771244f, 0.218612224f},
-std::array<float,2>{0.177603215f, 0.631385803f},
-std::array<float,2>{0.555031717f, 0.306892842f},
-std::array<float,2>{0.787006199f, 0.722975075f},
-std::array<float,2>{0.326449275f, 0.366080701f},
-std::array<float,2>{0.249282584f, 0.930692554f},
-std::array<float,2>{0.608595967f, 0.14410387f},
-std::array<float,2>{0.672230422f, 0.867850959f},
-std::array<float,2>{0.024804363f, 0.0700714067f},
-std::array<float,2>{0.476387352f, 0.572702587f},
-std::array<float,2>{0.909564435f, 0.395331472f},
-std::array<float,2>{0.554059982f, 0.526069403f},
-std::array<float,2>{0.179961875f, 0.497591794f},
-std::array<float,2>{0.302182287f, 0.787276924f},
-std::array<float,2>{0.81667012f, 0.054886084f},
-std::array<float,2>{0.96331346f, 0.948614061f},
-std::array<float,2>{0.410375357f, 0.236372054f},
-std::array<float,2>{0.107410081f, 0.664544165f},
-std::array<float,2>{0.723451376f, 0.270967126f},
-std::array<float,2>{0.885620475f, 0.616157115f},
-std::array<float,2>{0.446393341f, 0.428809017f},
-std::array<float,2>{0.0427302457f, 0.822030723f},
-std::array<float,2>{0.635710716f, 0.0959405899f},
-std::array<float,2>{0.570336759f, 0.899307668f},
-std::array<float,2>{0.217169076f, 0.159015f},
-std::array<float,2>{0.357052475f, 0.702569306f},
-std::array<float,2>{0.755982876f, 0.341886669f},
-std::array<float,2>{0.694571912f, 0.636590004f},
-std::array<float,2>{0.0723536313f, 0.299743116f},
-std::array<float,2>{0.390743434f, 0.998037338f},
-std::array<float,2>{0.996757269f, 0.203581899f},
-std::array<float,2>{0.854875684f, 0.769705594f},
-std::array<float,2>{0.27176705f, 0.0287077855f},
-std::array<float,2>{0.155637577f, 0.546993911f},
-std::array<float,2>{0.512284756f, 0.439839512f},
-std::array<float,2>{0.828340113f, 0.53304106f},
-std::array<float,2>{0.294871181f, 0.463650286f},
-std::array<float,2>{0.169225663f, 0.750082731f},
-std::array<float,2>{0.546551764f, 0.00510218646f},
-std::array<float,2>{0.740476787f, 0.983474851f},
-std::array<float,2>{0.117878839f, 0.191214383f},
-std::array<float,2>{0.428913087f, 0.650804281f},
-std::array<float,2>{0.947555125f, 0.286287099f},
-std::array<float,2>{0.616645575f, 0.706268966f},
-std::array<float,2>{0.224075422f, 0.317738712f},
-std::array<float,2>{0.343570322f, 0.887795746f},
-std::array<float,2>{0.799757659f, 0.178124905f},
-std::array<float,2>{0.926430166f, 0.835310638f},
-std::array<float,2>{0.493679851f, 0.122294493f},
-std::array<float,2>{0.00735074934f, 0.599561214f},
-std::array<float,2>{0.667767048f, 0.416557342f},
-std::array<float,2>{0.981490016f, 0.676460564f},
-std::array<float,2>{0.390498608f, 0.255101115f},
-std::array<float,2>{0.0821500346f, 0.959739387f},
-std::array<float,2>{0.712398529f, 0.221907094f},
-std::array<float,2>{0.520829618f, 0.798528254f},
-std::array<float,2>{0.12953122f, 0.0396551676f},
-std::array<float,2>{0.262956172f, 0.506864488f},
-std::array<float,2>{0.860768259f, 0.474758446f},
-std::array<float,2>{0.64822197f, 0.583241642f},
-std::array<float,2>{0.0572715886f, 0.388263404f},
-std::array<float,2>{0.463819087f, 0.85440439f},
-std::array<float,2>{0.895384908f, 0.0916701034f},
-std::array<float,2>{0.769476295f, 0.920917213f},
-std::array<float,2>{0.362247169f, 0.136620581f},
-std::array<float,2>{0.196209192f, 0.735500216f},
-std::array<float,2>{0.582430065f, 0.35341686f},
-std::array<float,2>{0.814589143f, 0.715607107f},
-std::array<float,2>{0.297608972f, 0.327215433f},
-std::array<float,2>{0.18460229f, 0.879678607f},
-std::array<float,2>{0.548093677f, 0.184211507f},
-std::array<float,2>{0.7191028f, 0.838873863f},
-std::array<float,2>{0.101925217f, 0.116949394f},
-std::array<float,2>{0.408510506f, 0.606592476f},
-std::array<float,2>{0.968572676f, 0.412086219f},
-std::array<float,2>{0.605414867f, 0.541820228f},
-std::array<float,2>{0.245938823f, 0.455009997f},
-std::array<float,2>{0.324151397f, 0.763114691f},
-std::array<float,2>{0.781484067f, 0.0140312295f},
-std::array<float,2>{0.91034925f, 0.969653308f},
-std::array<float,2>{0.470178038f, 0.20134379f},
-std::array<float,2>{0.0277785752f, 0.644868731f},
-std::array<float,2>{0.679011226f, 0.294523776f},
-std::array<float,2>{0.993885458f, 0.586437643f},
-std::array<float,2>{0.397837937f, 0.376346976f},
-std::array<float,2>{0.077377364f, 0.846994162f},
-std::array<float,2>{0.689394712f, 0.0822300166f},
-std::array<float,2>{0.510648012f, 0.912257671f},
-std::array<float,2>{0.151327088f, 0.129667535f},
-std::array<float,2>{0.266344845f, 0.744648695f},
-std::array<float,2>{0.85873872f, 0.348788619f},
-std::array<float,2>{0.637861133f, 0.68229425f},
-std::array<float,2>{0.0441029742f, 0.259643048f},
-std::array<float,2>{0.452625781f, 0.961618841f},
-std::array<float,2>{0.886776984f, 0.227714255f},
-std::array<float,2>{0.752714515f, 0.806363463f},
-std::array<float,2>{0.35528177f, 0.0378801972f},
-std::array<float,2>{0.212556258f, 0.507944345f},
-std::array<float,2>{0.574813962f, 0.479222685f},
-std::array<float,2>{0.802951336f, 0.519240856f},
-std::array<float,2>{0.336942285f, 0.487644821f},
-std::array<float,2>{0.219985381f, 0.789510548f},
-std::array<float,2>{0.612759054f, 0.0523663871f},
-std::array<float,2>{0.67141664f, 0.939718068f},
-std::array<float,2>{0.00301104761f, 0.245278105f},
-std::array<float,2>{0.499416769f, 0.657444119f},
-std::array<float,2>{0.922758877f, 0.274141848f},
-std::array<float,2>{0.54239428f, 0.733412385f},
-std::array<float,2>{0.165258259f, 0.369886875f},
-std::array<float,2>{0.291544646f, 0.928962827f},
-std::array<float,2>{0.834843516f, 0.152873263f},
-std::array<float,2>{0.950221896f, 0.864493191f},
-std::array<float,2>{0.422006458f, 0.0762190521f},
-std::array<float,2>{0.122518025f, 0.565695643f},
-std::array<float,2>{0.735613465f, 0.399878263f},
-std::array<float,2>{0.892638564f, 0.625526905f},
-std::array<float,2>{0.465190679f, 0.31170243f},
-std::array<float,2>{0.0587062202f, 0.987531424f},
-std::array<float,2>{0.641570807f, 0.213091016f},
-std::array<float,2>{0.580576062f, 0.781152189f},
-std::array<float,2>{0.20256719f, 0.0227394272f},
-std::array<float,2>{0.366756827f, 0.555868506f},
-std::array<float,2>{0.769824147f, 0.450459898f},
-std::array<float,2>{0.71847707f, 0.623400033f},
-std::array<float,2>{0.0788559616f, 0.431904614f},
-std::array<float,2>{0.383023471f, 0.815536082f},
-std::array<float,2>{0.979411662f, 0.108297743f},
-std::array<float,2>{0.864891171f, 0.894129455f},
-std::array<float,2>{0.258566588f, 0.166909561f},
-std::array<float,2>{0.127754793f, 0.689327955f},
-std::array<float,2>{0.516900957f, 0.329119086f},
-std::array<float,2>{0.773719072f, 0.669954658f},
-std::array<float,2>{0.374208808f, 0.268898368f},
-std::array<float,2>{0.194061205f, 0.952896714f},
-std::array<float,2>{0.589317501f, 0.24021399f},
-std::array<float,2>{0.648652315f, 0.782414854f},
-std::array<float,2>{0.0489066876f, 0.0600661896f},
-std::array<float,2>{0.456267476f, 0.528707147f},
-std::array<float,2>{0.90181756f, 0.494709373f},
-std::array<float,2>{0.528967798f, 0.575549603f},
-std::array<float,2>{0.133345515f, 0.390826613f},
-std::array<float,2>{0.257169068f, 0.872473359f},
-std::array<float,2>{0.869920731f, 0.0653430223f},
-std::array<float,2>{0.974171102f, 0.934112608f},
-std::array<float,2>{0.378708214f, 0.145816237f},
-std::array<float,2>{0.0906826109f, 0.721438766f},
-std::array<float,2>{0.70935744f, 0.360147089f},
-std::array<float,2>{0.932698488f, 0.554678798f},
-std::array<float,2>{0.488714606f, 0.443962842f},
-std::array<float,2>{0.015112754f, 0.76920557f},
-std::array<float,2>{0.656353891f, 0.026424231f},
-std::array<float,2>{0.619486511f, 0.994983733f},
-std::array<float,2>{0.230687186f, 0.210274398f},
-std::array<float,2>{0.333379596f, 0.638324916f},
-std::array<float,2>{0.810456991f, 0.301664323f},
-std::array<float,2>{0.747596085f, 0.696413696f},
-std::array<float,2>{0.113579839f, 0.338368028f},
-std::array<float,2>{0.434904516f, 0.904550612f},
-std::array<float,2>{0.942910671f, 0.161513463f},
-std::array<float,2>{0.840935767f, 0.824257851f},
-std::array<float,2>{0.288571179f, 0.0990365967f},
-std::array<float,2>{0.159020692f, 0.612000167f},
-std::array<float,2>{0.533659697f, 0.425531626f},
-std::array<float,2>{0.84733665f, 0.594644547f},
-std::array<float,2>{0.274837524f, 0.420729816f},
-std::array<float,2>{0.142109066f, 0.831754327f},
-std::array<float,2>{0.500836313f, 0.117843114f},
-std::array<float,2>{0.701282859f, 0.883649468f},
-std::array<float,2>{0.0646558776f, 0.174366847f},
-std::array<float,2>{0.404734641f, 0.708991289f},
-std::array<float,2>{0.988972127f, 0.313820153f},
-std::array<float,2>{0.568811953f, 0.654475868f},
-std::array<float,2>{0.205903605f, 0.282049149f},
-std::array<float,2>{0.348189771f, 0.979314804f},
-std::array<float,2>{0.761054873f, 0.192117244f},
-std::array<float,2>{0.879280448f, 0.755084813f},
-std::array<float,2>{0.438597918f, 0.00115840079f},
-std::array<float,2>{0.0346494503f, 0.538309515f},
-std::array<float,2>{0.630278528f, 0.467828989f},
-std::array<float,2>{0.959145308f, 0.739153147f},
-std::array<float,2>{0.419305801f, 0.355988652f},
-std::array<float,2>{0.0972229764f, 0.915533304f},
-std::array<float,2>{0.729348481f, 0.140407026f},
-std::array<float,2>{0.560109198f, 0.857902586f},
-std::array<float,2>{0.173001513f, 0.0881943628f},
-std::array<float,2>{0.307697594f, 0.58195281f},
-std::array<float,2>{0.823893785f, 0.384241343f},
-std::array<float,2>{0.683424771f, 0.500715137f},
-std::array<float,2>{0.0198017918f, 0.46966067f},
-std::array<float,2>{0.484186977f, 0.803257346f},
-std::array<float,2>{0.916152477f, 0.0434766188f},
-std::array<float,2>{0.794981718f, 0.956947207f},
-std::array<float,2>{0.319611579f, 0.224778414f},
-std::array<float,2>{0.241485536f, 0.673124135f},
-std::array<float,2>{0.595026612f, 0.252800792f},
-std::array<float,2>{0.837303519f, 0.687133253f},
-std::array<float,2>{0.28391552f, 0.263487577f},
-std::array<float,2>{0.160762727f, 0.968337238f},
-std::array<float,2>{0.536685526f, 0.230518073f},
-std::array<float,2>{0.743523955f, 0.810087979f},
-std::array<float,2>{0.10988076f, 0.0317917131f},
-std::array<float,2>{0.431256652f, 0.515562892f},
-std::array<float,2>{0.939513385f, 0.483097941f},
-std::array<float,2>{0.622340202f, 0.590168059f},
-std::array<float,2>{0.229943305f, 0.379703045f},
-std::array<float,2>{0.330475897f, 0.850007057f},
-std::array<float,2>{0.805084825f, 0.0796600059f},
-std::array<float,2>{0.935393274f, 0.909282565f},
-std::array<float,2>{0.485549361f, 0.126131088f},
-std::array<float,2>{0.00930138584f, 0.748103917f},
-std::array<float,2>{0.66393131f, 0.344277531f},
-std::array<float,2>{0.971203029f, 0.543700993f},
-std::array<float,2>{0.382148623f, 0.460166425f},
-std::array<float,2>{0.0881168023f, 0.758041382f},
-std::array<float,2>{0.706895471f, 0.00987228192f},
-std::array<float,2>{0.525100291f, 0.975211382f},
-std::array<float,2>{0.137804076f, 0.197086737f},
-std::array<float,2>{0.252965182f, 0.643476903f},
-std::array<float,2>{0.872971952f, 0.289432406f},
-std::array<float,2>{0.655195355f, 0.712978661f},
-std::array<float,2>{0.0524609871f, 0.322132975f},
-std::array<float,2>{0.460109681f, 0.87726748f},
-std::array<float,2>{0.904136956f, 0.180802226f},
-std::array<float,2>{0.779931128f, 0.842599988f},
-std::array<float,2>{0.369073302f, 0.110761881f},
-std::array<float,2>{0.190738946f, 0.602842569f},
-std::array<float,2>{0.593307912f, 0.407504767f},
-std::array<float,2>{0.789846301f, 0.618835151f},
-std::array<float,2>{0.314109832f, 0.434817791f},
-std::array<float,2>{0.238083035f, 0.818718672f},
-std::array<float,2>{0.598226249f, 0.102099471f},
-std::array<float,2>{0.686121881f, 0.897048295f},
-std::array<float,2>{0.018167546f, 0.170047045f},
-std::array<float,2>{0.479379833f, 0.692845404f},
-std::array<float,2>{0.921736002f, 0.333301097f},
-std::array<float,2>{0.557429016f, 0.629130304f},
-std::array<float,2>{0.17906034f, 0.30533579f},
-std::array<float,2>{0.309053272f, 0.98975563f},
-std::array<float,2>{0.82724148f, 0.215476975f},
-std::array<float,2>{0.955119908f, 0.774359584f},
-std::array<float,2>{0.417775244f, 0.0191395637f},
-std::array<float,2>{0.1013484f, 0.561373353f},
-std::array<float,2>{0.733586013f, 0.445984751f},
-std::array<float,2>{0.875683486f, 0.728069425f},
-std::array<float,2>{0.444506496f, 0.371386081f},
-std::array<float,2>{0.0365726054f, 0.922839403f},
-std::array<float,2>{0.628633022f, 0.151666179f},
-std::array<float,2>{0.563702762f, 0.859657288f},
-std::array<float,2>{0.207067758f, 0.071933873f},
-std::array<float,2>{0.345420241f, 0.567506552f},
-std::array<float,2>{0.762762487f, 0.405650228f},
-std::array<float,2>{0.696409643f, 0.520613194f},
-std::array<float,2>{0.0697052628f, 0.490083337f},
-std::array<float,2>{0.3997145f, 0.796174288f},
-std::array<float,2>{0.985509276f, 0.047292389f},
-std::array<float,2>{0.848547757f, 0.942516744f},
-std::array<float,2>{0.27845934f, 0.249160424f},
-std::array<float,2>{0.145608664f, 0.662264109f},
-std::array<float,2>{0.506630421f, 0.278219134f},
-std::array<float,2>{0.754287481f, 0.699941099f},
-std::array<float,2>{0.35829097f, 0.341007024f},
-std::array<float,2>{0.216752946f, 0.900579631f},
-std::array<float,2>{0.572926044f, 0.157207698f},
-std::array<float,2>{0.634305418f, 0.823316753f},
-std::array<float,2>{0.0400334485f, 0.0942792371f},
-std::array<float,2>{0.447546542f, 0.613374472f},
-std::array<float,2>{0.883586645f, 0.426754296f},
-std::array<float,2>{0.515370607f, 0.548962414f},
-std::array<float,2>{0.153682709f, 0.438168764f},
-std::array<float,2>{0.27089715f, 0.772762299f},
-std::array<float,2>{0.852833331f, 0.0292969048f},
-std::array<float,2>{0.998626113f, 0.999578118f},
-std::array<float,2>{0.392650336f, 0.205632687f},
-std::array<float,2>{0.0721445009f, 0.633311927f},
-std::array<float,2>{0.692830384f, 0.297766685f},
-std::array<float,2>{0.907491207f, 0.572115123f},
-std::array<float,2>{0.473941326f, 0.398281276f},
-std::array<float,2>{0.0261828452f, 0.870450914f},
-std::array<float,2>{0.675135434f, 0.0666153207f},
-std::array<float,2>{0.606493652f, 0.932857633f},
-std::array<float,2>{0.247640297f, 0.141247287f},
-std::array<float,2>{0.324257761f, 0.724730372f},
-std::array<float,2>{0.788641512f, 0.364154041f},
-std::array<float,2>{0.72600919f, 0.666355133f},
-std::array<float,2>{0.108530521f, 0.272073597f},
-std::array<float,2>{0.413881809f, 0.946802855f},
-std::array<float,2>{0.961726248f, 0.234529227f},
-std::array<float,2>{0.819635451f, 0.785888374f},
-std::array<float,2>{0.303935736f, 0.0580066405f},
-std::array<float,2>{0.182831392f, 0.523979545f},
-std::array<float,2>{0.552259803f, 0.499514848f},
-std::array<float,2>{0.861870885f, 0.505706072f},
-std::array<float,2>{0.265030891f, 0.473035693f},
-std::array<float,2>{0.132407099f, 0.800234437f},
-std::array<float,2>{0.521958411f, 0.0413081944f},
-std::array<float,2>{0.713815689f, 0.958317459f},
-std::array<float,2>{0.085118711f, 0.219729885f},
-std::array<float,2>{0.388466626f, 0.678885937f},
-std::array<float,2>{0.983344376f, 0.257169247f},
-std::array<float,2>{0.584364057f, 0.73651129f},
-std::array<float,2>{0.198031679f, 0.355251908f},
-std::array<float,2>{0.360043138f, 0.918405533f},
-std::array<float,2>{0.766559899f, 0.134200484f},
-std::array<float,2>{0.896537483f, 0.851745665f},
-std::array<float,2>{0.461877346f, 0.0926082134f},
-std::array<float,2>{0.0561487377f, 0.585024893f},
-std::array<float,2>{0.644739032f, 0.38913092f},
-std::array<float,2>{0.946452975f, 0.64899224f},
-std::array<float,2>{0.427372396f, 0.288512349f},
-std::array<float,2>{0.120189354f, 0.981118023f},
-std::array<float,2>{0.738792479f, 0.187837049f},
-std::array<float,2>{0.543034136f, 0.752047122f},
-std::array<float,2>{0.171523198f, 0.0059211133f},
-std::array<float,2>{0.296052516f, 0.534377337f},
-std::array<float,2>{0.83118403f, 0.462167531f},
-std::array<float,2>{0.664108813f, 0.599714637f},
-std::array<float,2>{0.00512597477f, 0.414275795f},
-std::array<float,2>{0.494227707f, 0.833500683f},
-std::array<float,2>{0.929518402f, 0.124784797f},
-std::array<float,2>{0.797940254f, 0.890168667f},
-std::array<float,2>{0.340717971f, 0.177065194f},
-std::array<float,2>{0.226412028f, 0.704881012f},
-std::array<float,2>{0.61466229f, 0.319921046f},
-std::array<float,2>{0.856121659f, 0.742620409f},
-std::array<float,2>{0.267914504f, 0.349785864f},
-std::array<float,2>{0.149215549f, 0.91023612f},
-std::array<float,2>{0.507985055f, 0.131424785f},
-std::array<float,2>{0.690517783f, 0.845220804f},
-std::array<float,2>{0.0747973472f, 0.0853662714f},
-std::array<float,2>{0.39501825f, 0.588023722f},
-std::array<float,2>{0.99532485f, 0.377525687f},
-std::array<float,2>{0.576770782f, 0.511082947f},
-std::array<float,2>{0.214489222f, 0.477663606f},
-std::array<float,2>{0.351841748f, 0.807216227f},
-std::array<float,2>{0.751740336f, 0.0362866968f},
-std::array<float,2>{0.889638424f, 0.963342726f},
-std::array<float,2>{0.450104177f, 0.229111999f},
-std::array<float,2>{0.0455030575f, 0.681596398f},
-std::array<float,2>{0.639419079f, 0.260611564f},
-std::array<float,2>{0.965267003f, 0.608936548f},
-std::array<float,2>{0.407279313f, 0.412199706f},
-std::array<float,2>{0.103866652f, 0.836893201f},
-std::array<float,2>{0.722237468f, 0.113371924f},
-std::array<float,2>{0.550275683f, 0.881939054f},
-std::array<float,2>{0.18618916f, 0.187146187f},
-std::array<float,2>{0.299556673f, 0.7174564f},
-std::array<float,2>{0.813775659f, 0.325822145f},
-std::array<float,2>{0.677666545f, 0.64709264f},
-std::array<float,2>{0.0307469144f, 0.295406491f},
-std::array<float,2>{0.471650213f, 0.970855057f},
-std::array<float,2>{0.913917422f, 0.199668422f},
-std::array<float,2>{0.784964025f, 0.765581548f},
-std::array<float,2>{0.320896626f, 0.0122702345f},
-std::array<float,2>{0.24247992f, 0.539508104f},
-std::array<float,2>{0.603067696f, 0.455786735f},
-std::array<float,2>{0.772416532f, 0.557268918f},
-std::array<float,2>{0.365029901f, 0.452483594f},
-std::array<float,2>{0.20003584f, 0.777944148f},
-std::array<float,2>{0.578726351f, 0.0196581706f},
-std::array<float,2>{0.643196762f, 0.984864473f},
-std::array<float,2>{0.0614790916f, 0.211380243f},
-std::array<float,2>{0.468496799f, 0.628265142f},
-std::array<float,2>{0.89129138f, 0.309961975f},
-std::array<float,2>{0.519332051f, 0.689708889f},
-std::array<float,2>{0.126757175f, 0.330872625f},
-std::array<float,2>{0.260270178f, 0.891392291f},
-std::array<float,2>{0.86685276f, 0.16414991f},
-std::array<float,2>{0.977812827f, 0.81316936f},
-std::array<float,2>{0.384853065f, 0.107344121f},
-std::array<float,2>{0.0819430053f, 0.623031139f},
-std::array<float,2>{0.715929031f, 0.431401163f},
-std::array<float,2>{0.925045609f, 0.659270704f},
-std::array<float,2>{0.496581405f, 0.275396407f},
-std::array<float,2>{0.0013255832f, 0.938601851f},
-std::array<float,2>{0.668412864f, 0.244103685f},
-std::array<float,2>{0.611279488f, 0.791661978f},
-std::array<float,2>{0.221633077f, 0.0529140718f},
-std::array<float,2>{0.337965667f, 0.515967786f},
-std::array<float,2>{0.80127871f, 0.48565197f},
-std::array<float,2>{0.7363469f, 0.564184785f},
-std::array<float,2>{0.124987528f, 0.402157038f},
-std::array<float,2>{0.425288767f, 0.866874039f},
-std::array<float,2>{0.951925576f, 0.07591708f},
-std::array<float,2>{0.833881259f, 0.927136481f},
-std::array<float,2>{0.290067613f, 0.155801922f},
-std::array<float,2>{0.167750031f, 0.731738985f},
-std::array<float,2>{0.540959716f, 0.369102985f},
-std::array<float,2>{0.811839879f, 0.639770508f},
-std::array<float,2>{0.335337669f, 0.302987754f},
-std::array<float,2>{0.23381269f, 0.994033992f},
-std::array<float,2>{0.618793547f, 0.208515063f},
-std::array<float,2>{0.658408403f, 0.766358554f},
-std::array<float,2>{0.0131731657f, 0.0236249119f},
-std::array<float,2>{0.49025315f, 0.552501917f},
-std::array<float,2>{0.929873228f, 0.443056464f},
-std::array<float,2>{0.531998992f, 0.609808803f},
-std::array<float,2>{0.156876996f, 0.423611552f},
-std::array<float,2>{0.285595208f, 0.826948047f},
-std::array<float,2>{0.843109965f, 0.100998104f},
-std::array<float,2>{0.943526149f, 0.903465867f},
-std::array<float,2>{0.436554909f, 0.163370624f},
-std::array<float,2>{0.11616189f, 0.698693275f},
-std::array<float,2>{0.749917984f, 0.336690128f},
-std::array<float,2>{0.899270236f, 0.52941072f},
-std::array<float,2>{0.454502851f, 0.492775142f},
-std::array<float,2>{0.0474231392f, 0.783350348f},
-std::array<float,2>{0.651438832f, 0.0613491796f},
-std::array<float,2>{0.587341726f, 0.950370431f},
-std::array<float,2>{0.193262085f, 0.241709411f},
-std::array<float,2>{0.371924579f, 0.668737829f},
-std::array<float,2>{0.776482999f, 0.266255528f},
-std::array<float,2>{0.708046257f, 0.71934104f},
-std::array<float,2>{0.0930368528f, 0.362015516f},
-std::array<float,2>{0.376796573f, 0.936234355f},
-std::array<float,2>{0.976472616f, 0.147557408f},
-std::array<float,2>{0.86774379f, 0.873545051f},
-std::array<float,2>{0.255160302f, 0.0635400936f},
-std::array<float,2>{0.136714593f, 0.576525807f},
-std::array<float,2>{0.529475331f, 0.393931597f},
-std::array<float,2>{0.821697414f, 0.578374684f},
-std::array<float,2>{0.305703819f, 0.3851237f},
-std::array<float,2>{0.175142854f, 0.85728693f},
-std::array<float,2>{0.56072855f, 0.0862457082f},
-std::array<float,2>{0.728124619f, 0.917443275f},
-std::array<float,2>{0.0944116339f, 0.13705115f},
-std::array<float,2>{0.420550197f, 0.741561711f},
-std::array<float,2>{0.957537353f, 0.357498705f},
-std::array<float,2>{0.595954299f, 0.675546944f},
-std::array<float,2>{0.239529163f, 0.25069955f},
-std::array<float,2>{0.318170428f, 0.953833342f},
-std::array<float,2>{0.79352206f, 0.224331111f},
-std::array<float,2>{0.915631175f, 0.800836384f},
-std::array<float,2>{0.482135981f, 0.0449943952f},
-std::array<float,2>{0.0217566751f, 0.503450751f},
-std::array<float,2>{0.681427419f, 0.471111417f},
-std::array<float,2>{0.991750598f, 0.707286417f},
-std::array<float,2>{0.40421167f, 0.315558195f},
-std::array<float,2>{0.0631854609f, 0.885883391f},
-std::array<float,2>{0.699932873f, 0.172481522f},
-std::array<float,2>{0.502338409f, 0.829613984f},
-std::array<float,2>{0.142740756f, 0.120671973f},
-std::array<float,2>{0.276686251f, 0.596792161f},
-std::array<float,2>{0.843949616f, 0.419534087f},
-std::array<float,2>{0.632595181f, 0.535329103f},
-std::array<float,2>{0.0327315368f, 0.466626316f},
-std::array<float,2>{0.440911353f, 0.757344723f},
-std::array<float,2>{0.882054389f, 0.00306773093f},
-std::array<float,2>{0.75832355f, 0.97662127f},
-std::array<float,2>{0.349781901f, 0.194190055f},
-std::array<float,2>{0.203461796f, 0.653248668f},
-std::array<float,2>{0.567637324f, 0.284589142f},
-std::array<float,2>{0.851444364f, 0.66333431f},
-std::array<float,2>{0.279637903f, 0.278708547f},
-std::array<float,2>{0.147999629f, 0.942070365f},
-std::array<float,2>{0.504051387f, 0.248505816f},
-std::array<float,2>{0.698871374f, 0.795307457f},
-std::array<float,2>{0.0671720356f, 0.0484665036f},
-std::array<float,2>{0.402290851f, 0.519736588f},
-std::array<float,2>{0.987706006f, 0.489107162f},
-std::array<float,2>{0.564705551f, 0.567175806f},
-std::array<float,2>{0.209644258f, 0.404374331f},
-std::array<float,2>{0.346580774f, 0.861085176f},
-std::array<float,2>{0.765104175f, 0.0710310563f},
-std::array<float,2>{0.878763556f, 0.923266113f},
-std::array<float,2>{0.442712754f, 0.150951877f},
-std::array<float,2>{0.0377429798f, 0.72753042f},
-std::array<float,2>{0.626018882f, 0.372907102f},
-std::array<float,2>{0.953529119f, 0.562061965f},
-std::array<float,2>{0.415042013f, 0.447143525f},
-std::array<float,2>{0.0983618647f, 0.774604201f},
-std::array<float,2>{0.731782913f, 0.0184289478f},
-std::array<float,2>{0.555842459f, 0.988758624f},
-std::array<float,2>{0.176326945f, 0.216500551f},
-std::array<float,2>{0.311365813f, 0.630738437f},
-std::array<float,2>{0.824609876f, 0.305960685f},
-std::array<float,2>{0.684486866f, 0.691909432f},
-std::array<float,2>{0.0174861569f, 0.33275187f},
-std::array<float,2>{0.476956636f, 0.897630334f},
-std::array<float,2>{0.91894865f, 0.171499759f},
-std::array<float,2>{0.792329669f, 0.819957614f},
-std::array<float,2>{0.314576596f, 0.102865323f},
-std::array<float,2>{0.234391227f, 0.617724836f},
-std::array<float,2>{0.599750519f, 0.433594763f},
-std::array<float,2>{0.779028654f, 0.602190256f},
-std::array<float,2>{0.370835364f, 0.406603992f},
-std::array<float,2>{0.189346164f, 0.843452334f},
-std::array<float,2>{0.590756774f, 0.109986044f},
-std::array<float,2>{0.654227674f, 0.878868997f},
-std::array<float,2>{0.0546712615f, 0.179994643f},
-std::array<float,2>{0.45763725f, 0.714440644f},
-std::array<float,2>{0.905277073f, 0.320734978f},
-std::array<float,2>{0.525603175f, 0.643813014f},
-std::array<float,2>{0.140327469f, 0.290444344f},
-std::array<float,2>{0.25067991f, 0.97587508f},
-std::array<float,2>{0.874504805f, 0.196046725f},
-std::array<float,2>{0.969725311f, 0.759534776f},
-std::array<float,2>{0.379651874f, 0.0114741642f},
-std::array<float,2>{0.0863430202f, 0.544117689f},
-std::array<float,2>{0.703368545f, 0.459256828f},
-std::array<float,2>{0.9359833f, 0.749396086f},
-std::array<float,2>{0.487414926f, 0.345648915f},
-std::array<float,2>{0.0101146512f, 0.908626795f},
-std::array<float,2>{0.660765648f, 0.125880107f},
-std::array<float,2>{0.623341799f, 0.850585938f},
-std::array<float,2>{0.227083012f, 0.0783878565f},
-std::array<float,2>{0.328847021f, 0.591033399f},
-std::array<float,2>{0.807270765f, 0.380530506f},
-std::array<float,2>{0.746092916f, 0.514395118f},
-std::array<float,2>{0.113280043f, 0.48424378f},
-std::array<float,2>{0.432407081f, 0.808852136f},
-std::array<float,2>{0.939366341f, 0.0330074541f},
-std::array<float,2>{0.838074267f, 0.966961682f},
-std::array<float,2>{0.281804711f, 0.231658936f},
-std::array<float,2>{0.163363561f, 0.6857512f},
-std::array<float,2>{0.538795292f, 0.262036502f},
-std::array<float,2>{0.800665617f, 0.703866363f},
-std::array<float,2>{0.34242487f, 0.318983674f},
-std::array<float,2>{0.222852722f, 0.889613867f},
-std::array<float,2>{0.615705073f, 0.176746592f},
-std::array<float,2>{0.666668713f, 0.832377553f},
-std::array<float,2>{0.00665810704f, 0.123189732f},
-std::array<float,2>{0.493143648f, 0.600935996f},
-std::array<float,2>{0.927006423f, 0.415799052f},
-std::array<float,2>{0.545608759f, 0.534150481f},
-std::array<float,2>{0.168717235f, 0.460979313f},
-std::array<float,2>{0.293408602f, 0.752982557f},
-std::array<float,2>{0.829258621f, 0.00773119275f},
-std::array<float,2>{0.948980451f, 0.981579006f},
-std::array<float,2>{0.428246647f, 0.1892827f},
-std::array<float,2>{0.118942961f, 0.650304615f},
-std::array<float,2>{0.741286457f, 0.28734833f},
-std::array<float,2>{0.895999849f, 0.584313989f},
-std::array<float,2>{0.464186728f, 0.389732748f},
-std::array<float,2>{0.0578835532f, 0.853497803f},
-std::array<float,2>{0.646708488f, 0.093732819f},
-std::array<float,2>{0.583660543f, 0.919440985f},
-std::array<float,2>{0.19692874f, 0.133097202f},
-std::array<float,2>{0.362936139f, 0.73763907f},
-std::array<float,2>{0.767972231f, 0.353912055f},
-std::array<float,2>{0.711308002f, 0.678539276f},
-std::array<float,2>{0.0836919323f, 0.256295711f},
-std::array<float,2>{0.388973504f, 0.957161188f},
-std::array<float,2>{0.980824411f, 0.219452918f},
-std::array<float,2>{0.859708488f, 0.799114466f},
-std::array<float,2>{0.261808336f, 0.0425242744f},
-std::array<float,2>{0.13053979f, 0.504211426f},
-std::array<float,2>{0.520244837f, 0.473871499f},
-std::array<float,2>{0.817417622f, 0.52488786f},
-std::array<float,2>{0.301604688f, 0.499022514f},
-std::array<float,2>{0.181161806f, 0.786368072f},
-std::array<float,2>{0.552861333f, 0.0568538457f},
-std::array<float,2>{0.723687112f, 0.946191907f},
-std::array<float,2>{0.105519399f, 0.23554109f},
-std::array<float,2>{0.411675662f, 0.66702342f},
-std::array<float,2>{0.963867664f, 0.272663802f},
-std::array<float,2>{0.607725382f, 0.726202309f},
-std::array<float,2>{0.248059347f, 0.364767432f},
-std::array<float,2>{0.327466965f, 0.932399809f},
-std::array<float,2>{0.785441816f, 0.142240465f},
-std::array<float,2>{0.908593476f, 0.86982733f},
-std::array<float,2>{0.475199074f, 0.0673858672f},
-std::array<float,2>{0.0237618983f, 0.571034193f},
-std::array<float,2>{0.673334777f, 0.397335619f},
-std::array<float,2>{0.997210085f, 0.634536922f},
-std::array<float,2>{0.391623437f, 0.29872334f},
-std::array<float,2>{0.0736270174f, 0.998472154f},
-std::array<float,2>{0.694072783f, 0.206497222f},
-std::array<float,2>{0.513006985f, 0.771899641f},
-std::array<float,2>{0.155258194f, 0.0303484667f},
-std::array<float,2>{0.273287803f, 0.550061762f},
-std::array<float,2>{0.85416609f, 0.438610554f},
-std::array<float,2>{0.636496365f, 0.615163684f},
-std::array<float,2>{0.0415336043f, 0.427607059f},
-std::array<float,2>{0.44547385f, 0.822948396f},
-std::array<float,2>{0.886297464f, 0.0953118578f},
-std::array<float,2>{0.757032216f, 0.902313769f},
-std::array<float,2>{0.355869234f, 0.158052489f},
-std::array<float,2>{0.218282044f, 0.700573623f},
-std::array<float,2>{0.571653545f, 0.340040773f},
-std::array<float,2>{0.835416734f, 0.730920136f},
-std::array<float,2>{0.292274773f, 0.367405087f},
-std::array<float,2>{0.164487928f, 0.926555634f},
-std::array<float,2>{0.541043162f, 0.154563919f},
-std::array<float,2>{0.735013485f, 0.865592837f},
-std::array<float,2>{0.122008368f, 0.0749670118f},
-std::array<float,2>{0.423621535f, 0.562996149f},
-std::array<float,2>{0.9493348f, 0.400978386f},
-std::array<float,2>{0.611813486f, 0.517152309f},
-std::array<float,2>{0.219012141f, 0.48527059f},
-std::array<float,2>{0.33670789f, 0.792747974f},
-std::array<float,2>{0.804416716f, 0.0539996959f},
-std::array<float,2>{0.923816204f, 0.937546432f},
-std::array<float,2>{0.498396337f, 0.242864192f},
-std::array<float,2>{0.00243346859f, 0.658572793f},
-std::array<float,2>{0.670005918f, 0.276429206f},
-std::array<float,2>{0.979734063f, 0.621477008f},
-std::array<float,2>{0.384555846f, 0.430144548f},
-std::array<float,2>{0.0800031647f, 0.813847721f},
-std::array<float,2>{0.717709064f, 0.106076241f},
-std::array<float,2>{0.515779138f, 0.891876698f},
-std::array<float,2>{0.128421038f, 0.165486529f},
-std::array<float,2>{0.258930206f, 0.690574408f},
-std::array<float,2>{0.863440096f, 0.331320554f},
-std::array<float,2>{0.642007053f, 0.626973569f},
-std::array<float,2>{0.0597463883f, 0.308814853f},
-std::array<float,2>{0.46656999f, 0.985874653f},
-std::array<float,2>{0.89440316f, 0.212491795f},
-std::array<float,2>{0.771073103f, 0.779147327f},
-std::array<float,2>{0.365862638f, 0.0208484717f},
-std::array<float,2>{0.202023208f, 0.557988763f},
-std::array<float,2>{0.58192867f, 0.451665103f},
-std::array<float,2>{0.782391369f, 0.540177941f},
-std::array<float,2>{0.323113471f, 0.456569254f},
-std::array<float,2>{0.244516537f, 0.764178157f},
-std::array<float,2>{0.603677213f, 0.0131682754f},
-std::array<float,2>{0.678086102f, 0.972588837f},
-std::array<float,2>{0.0288114715f, 0.200650766f},
-std::array<float,2>{0.46963644f, 0.648269594f},
-std::array<float,2>{0.911707222f, 0.29618293f},
-std::array<float,2>{0.547019005f, 0.718126118f},
-std::array<float,2>{0.184439749f, 0.325113744f},
-std::array<float,2>{0.298146755f, 0.88091135f},
-std::array<float,2>{0.816190779f, 0.185831934f},
-std::array<float,2>{0.967762113f, 0.837803364f},
-std::array<float,2>{0.409708709f, 0.114912383f},
-std::array<float,2>{0.10351456f, 0.608143866f},
-std::array<float,2>{0.72013694f, 0.413377523f},
-std::array<float,2>{0.888157547f, 0.680396616f},
-std::array<float,2>{0.451670259f, 0.261163771f},
-std::array<float,2>{0.0432498418f, 0.964604855f},
-std::array<float,2>{0.636722803f, 0.229563788f},
-std::array<float,2>{0.575231194f, 0.80825454f},
-std::array<float,2>{0.211327404f, 0.0353109986f},
-std::array<float,2>{0.353855252f, 0.510478914f},
-std::array<float,2>{0.753021598f, 0.476959258f},
-std::array<float,2>{0.688322246f, 0.589006662f},
-std::array<float,2>{0.076519303f, 0.378250986f},
-std::array<float,2>{0.396602541f, 0.844528496f},
-std::array<float,2>{0.992386401f, 0.0846866667f},
-std::array<float,2>{0.858171582f, 0.911150157f},
-std::array<float,2>{0.267095417f, 0.132061362f},
-std::array<float,2>{0.151787415f, 0.743746161f},
-std::array<float,2>{0.511710167f, 0.350898206f},
-std::array<float,2>{0.760148525f, 0.654053509f},
-std::array<float,2>{0.349556774f, 0.284156948f},
-std::array<float,2>{0.206635103f, 0.977873504f},
-std::array<float,2>{0.569500446f, 0.194354087f},
-std::array<float,2>{0.629360259f, 0.756134808f},
-std::array<float,2>{0.0340590701f, 0.00264215888f},
-std::array<float,2>{0.438125312f, 0.536759675f},
-std::array<float,2>{0.880737245f, 0.465426177f},
-std::array<float,2>{0.501765966f, 0.596577048f},
-std::array<float,2>{0.141109332f, 0.418008178f},
-std::array<float,2>{0.273983747f, 0.828301966f},
-std::array<float,2>{0.845770359f, 0.119517453f},
-std::array<float,2>{0.9896366f, 0.884898424f},
-std::array<float,2>{0.405802876f, 0.17313017f},
-std::array<float,2>{0.0656209141f, 0.708233118f},
-std::array<float,2>{0.703014851f, 0.315108031f},
-std::array<float,2>{0.917854369f, 0.50252074f},
-std::array<float,2>{0.482556522f, 0.472518325f},
-std::array<float,2>{0.0213491023f, 0.801908433f},
-std::array<float,2>{0.682553709f, 0.0466292836f},
-std::array<float,2>{0.594477773f, 0.954389751f},
-std::array<float,2>{0.240803808f, 0.223474354f},
-std::array<float,2>{0.318371624f, 0.673949301f},
-std::array<float,2>{0.796338439f, 0.251751244f},
-std::array<float,2>{0.729946256f, 0.740573287f},
-std::array<float,2>{0.0957149714f, 0.358405799f},
-std::array<float,2>{0.418269157f, 0.916216731f},
-std::array<float,2>{0.960786998f, 0.138600498f},
-std::array<float,2>{0.82289052f, 0.855880558f},
-std::array<float,2>{0.30710116f, 0.0876529664f},
-std::array<float,2>{0.172261804f, 0.579116523f},
-std::array<float,2>{0.559267461f, 0.386536181f},
-std::array<float,2>{0.870709836f, 0.577947795f},
-std::array<float,2>{0.256347984f, 0.393527269f},
-std::array<float,2>{0.13427113f, 0.874950051f},
-std::array<float,2>{0.527406573f, 0.0628594682f},
-std::array<float,2>{0.710484326f, 0.93683815f},
-std::array<float,2>{0.0916256905f, 0.146908179f},
-std::array<float,2>{0.377040982f, 0.720360756f},
-std::array<float,2>{0.972914398f, 0.362926573f},
-std::array<float,2>{0.588792384f, 0.668980718f},
-std::array<float,2>{0.195133552f, 0.267493516f},
-std::array<float,2>{0.373443544f, 0.94932431f},
-std::array<float,2>{0.774987996f, 0.24066247f},
-std::array<float,2>{0.901175499f, 0.784244418f},
-std::array<float,2>{0.45600459f, 0.0618255734f},
-std::array<float,2>{0.0502013154f, 0.531246305f},
-std::array<float,2>{0.649994493f, 0.493260115f},
-std::array<float,2>{0.94199115f, 0.698041439f},
-std::array<float,2>{0.434111357f, 0.336987764f},
-std::array<float,2>{0.114964433f, 0.902983069f},
-std::array<float,2>{0.746988237f, 0.162281424f},
-std::array<float,2>{0.535097897f, 0.827837169f},
-std::array<float,2>{0.159699917f, 0.100064076f},
-std::array<float,2>{0.287462562f, 0.610532343f},
-std::array<float,2>{0.839903593f, 0.422283798f},
-std::array<float,2>{0.657296956f, 0.551207364f},
-std::array<float,2>{0.0142617626f, 0.441469491f},
-std::array<float,2>{0.489432812f, 0.767403483f},
-std::array<float,2>{0.931975305f, 0.0248222873f},
-std::array<float,2>{0.809295297f, 0.992726386f},
-std::array<float,2>{0.332311422f, 0.207621217f},
-std::array<float,2>{0.231959283f, 0.638928831f},
-std::array<float,2>{0.620445013f, 0.303910404f},
-std::array<float,2>{0.826373994f, 0.632791758f},
-std::array<float,2>{0.310141921f, 0.30790779f},
-std::array<float,2>{0.178370804f, 0.990430117f},
-std::array<float,2>{0.558223546f, 0.217677534f},
-std::array<float,2>{0.732722819f, 0.776104748f},
-std::array<float,2>{0.099863112f, 0.0175363962f},
-std::array<float,2>{0.416794449f, 0.55930835f},
-std::array<float,2>{0.957030296f, 0.448422045f},
-std::array<float,2>{0.598989308f, 0.620809615f},
-std::array<float,2>{0.237034619f, 0.436440408f},
-std::array<float,2>{0.312714279f, 0.817819655f},
-std::array<float,2>{0.790645421f, 0.104254939f},
-std::array<float,2>{0.919935107f, 0.895163357f},
-std::array<float,2>{0.480314553f, 0.168949068f},
-std::array<float,2>{0.0190532878f, 0.693791687f},
-std::array<float,2>{0.68740654f, 0.33468616f},
-std::array<float,2>{0.984945536f, 0.523152411f},
-std::array<float,2>{0.39935407f, 0.490671635f},
-std::array<float,2>{0.0684777722f, 0.794197679f},
-std::array<float,2>{0.695804954f, 0.0492561907f},
-std::array<float,2>{0.507421672f, 0.944208026f},
-std::array<float,2>{0.145391941f, 0.247806922f},
-std::array<float,2>{0.277571857f, 0.661112309f},
-std::array<float,2>{0.849382997f, 0.28055048f},
-std::array<float,2>{0.627576649f, 0.729473472f},
-std::array<float,2>{0.0353994183f, 0.373983979f},
-std::array<float,2>{0.444196314f, 0.924796939f},
-std::array<float,2>{0.876510203f, 0.149259523f},
-std::array<float,2>{0.761962354f, 0.861946106f},
-std::array<float,2>{0.344575405f, 0.0733635724f},
-std::array<float,2>{0.208117336f, 0.569126308f},
-std::array<float,2>{0.562682748f, 0.403308183f},
-std::array<float,2>{0.80608809f, 0.593139648f},
-std::array<float,2>{0.331969529f, 0.381664395f},
-std::array<float,2>{0.229206949f, 0.849070013f},
-std::array<float,2>{0.621658444f, 0.0803595334f},
-std::array<float,2>{0.662692487f, 0.907453179f},
-std::array<float,2>{0.0086450018f, 0.127784744f},
-std::array<float,2>{0.485142499f, 0.746459961f},
-std::array<float,2>{0.93370831f, 0.347055167f},
-std::array<float,2>{0.535204232f, 0.684739172f},
-std::array<float,2>{0.161680058f, 0.263867468f},
-std::array<float,2>{0.284516662f, 0.966021895f},
-std::array<float,2>{0.836683571f, 0.232472837f},
-std::array<float,2>{0.940616667f, 0.810813785f},
-std::array<float,2>{0.42998457f, 0.0334547982f},
-std::array<float,2>{0.110737465f, 0.512501299f},
-std::array<float,2>{0.742646933f, 0.481780291f},
-std::array<float,2>{0.902718306f, 0.711689174f},
-std::array<float,2>{0.45920071f, 0.323340565f},
-std::array<float,2>{0.0514089614f, 0.876316607f},
-std::array<float,2>{0.656092882f, 0.182131007f},
-std::array<float,2>{0.591975391f, 0.840229094f},
-std::array<float,2>{0.190001085f, 0.112488687f},
-std::array<float,2>{0.36810714f, 0.603852928f},
-std::array<float,2>{0.780343771f, 0.408921957f},
-std::array<float,2>{0.705472052f, 0.545111895f},
-std::array<float,2>{0.089710921f, 0.457985163f},
-std::array<float,2>{0.381394207f, 0.760260761f},
-std::array<float,2>{0.972535968f, 0.00916553289f},
-std::array<float,2>{0.87180239f, 0.973699272f},
-std::array<float,2>{0.252517819f, 0.197380558f},
-std::array<float,2>{0.136759177f, 0.640946031f},
-std::array<float,2>{0.524051487f, 0.292660445f},
-std::array<float,2>{0.766774952f, 0.735286295f},
-std::array<float,2>{0.361265182f, 0.352275431f},
-std::array<float,2>{0.198932469f, 0.920755506f},
-std::array<float,2>{0.585092843f, 0.13500911f},
-std::array<float,2>{0.64566052f, 0.854965627f},
-std::array<float,2>{0.0547816642f, 0.0905478075f},
-std::array<float,2>{0.46222946f, 0.582903147f},
-std::array<float,2>{0.897825301f, 0.386998534f},
-std::array<float,2>{0.52316159f, 0.506201982f},
-std::array<float,2>{0.131188303f, 0.476097167f},
-std::array<float,2>{0.264090359f, 0.797492087f},
-std::array<float,2>{0.86295408f, 0.0401945747f},
-std::array<float,2>{0.984006584f, 0.960213363f},
-std::array<float,2>{0.387298673f, 0.221016839f},
-std::array<float,2>{0.0846359506f, 0.676945269f},
-std::array<float,2>{0.714766204f, 0.254213959f},
-std::array<float,2>{0.928701699f, 0.598135591f},
-std::array<float,2>{0.495796323f, 0.41773203f},
-std::array<float,2>{0.00433482742f, 0.834258974f},
-std::array<float,2>{0.665106595f, 0.121497892f},
-std::array<float,2>{0.614166796f, 0.887566566f},
-std::array<float,2>{0.22528328f, 0.178845227f},
-std::array<float,2>{0.340903759f, 0.705315113f},
-std::array<float,2>{0.797474921f, 0.316490412f},
-std::array<float,2>{0.739661276f, 0.651828647f},
-std::array<float,2>{0.119425856f, 0.285229623f},
-std::array<float,2>{0.426000625f, 0.982739389f},
-std::array<float,2>{0.946287453f, 0.190338135f},
-std::array<float,2>{0.830459476f, 0.751887679f},
-std::array<float,2>{0.295149833f, 0.0047965697f},
-std::array<float,2>{0.170671195f, 0.531636536f},
-std::array<float,2>{0.544095695f, 0.464192539f},
-std::array<float,2>{0.851728439f, 0.54871732f},
-std::array<float,2>{0.270247757f, 0.441008478f},
-std::array<float,2>{0.152654305f, 0.771443009f},
-std::array<float,2>{0.514354587f, 0.02742997f},
-std::array<float,2>{0.691733897f, 0.996981859f},
-std::array<float,2>{0.0705587864f, 0.204676107f},
-std::array<float,2>{0.394303322f, 0.63538909f},
-std::array<float,2>{0.999976814f, 0.300039053f},
-std::array<float,2>{0.573740005f, 0.701860607f},
-std::array<float,2>{0.214943349f, 0.343272269f},
-std::array<float,2>{0.358414203f, 0.900253534f},
-std::array<float,2>{0.755354285f, 0.159352943f},
-std::array<float,2>{0.884444833f, 0.820466697f},
-std::array<float,2>{0.448387116f, 0.0967603177f},
-std::array<float,2>{0.0407798812f, 0.616835594f},
-std::array<float,2>{0.633128524f, 0.428365588f},
-std::array<float,2>{0.962483525f, 0.665694714f},
-std::array<float,2>{0.412851214f, 0.269532114f},
-std::array<float,2>{0.108345218f, 0.947791398f},
-std::array<float,2>{0.724928796f, 0.237563193f},
-std::array<float,2>{0.551350296f, 0.788440406f},
-std::array<float,2>{0.181689262f, 0.0564757958f},
-std::array<float,2>{0.303453654f, 0.526741564f},
-std::array<float,2>{0.818829179f, 0.496984452f},
-std::array<float,2>{0.674502313f, 0.573463619f},
-std::array<float,2>{0.0269835573f, 0.395838201f},
-std::array<float,2>{0.47282207f, 0.868823349f},
-std::array<float,2>{0.906906486f, 0.0683869347f},
-std::array<float,2>{0.78721118f, 0.929797649f},
-std::array<float,2>{0.325927645f, 0.142820179f},
-std::array<float,2>{0.246920168f, 0.724451184f},
-std::array<float,2>{0.605966866f, 0.366644084f},
-std::array<float,2>{0.86585021f, 0.687921703f},
-std::array<float,2>{0.261394739f, 0.329078376f},
-std::array<float,2>{0.125322327f, 0.892808378f},
-std::array<float,2>{0.5181638f, 0.167886332f},
-std::array<float,2>{0.71508342f, 0.815263033f},
-std::array<float,2>{0.0803668424f, 0.109359756f},
-std::array<float,2>{0.386180818f, 0.6249789f},
-std::array<float,2>{0.976951122f, 0.433474809f},
-std::array<float,2>{0.579536021f, 0.555536509f},
-std::array<float,2>{0.200780526f, 0.449731529f},
-std::array<float,2>{0.363479316f, 0.780242562f},
-std::array<float,2>{0.773118794f, 0.0218762793f},
-std::array<float,2>{0.891610205f, 0.986701548f},
-std::array<float,2>{0.467600912f, 0.214252397f},
-std::array<float,2>{0.0622382313f, 0.626889706f},
-std::array<float,2>{0.643902004f, 0.310860336f},
-std::array<float,2>{0.952798426f, 0.565106571f},
-std::array<float,2>{0.4240596f, 0.39895311f},
-std::array<float,2>{0.123708673f, 0.864184439f},
-std::array<float,2>{0.737681448f, 0.0775141343f},
-std::array<float,2>{0.53982091f, 0.928356528f},
-std::array<float,2>{0.166380569f, 0.153480291f},
-std::array<float,2>{0.289105296f, 0.733305693f},
-std::array<float,2>{0.832479239f, 0.370592684f},
-std::array<float,2>{0.669342935f, 0.656989396f},
-std::array<float,2>{0.000881926622f, 0.274699003f},
-std::array<float,2>{0.497158617f, 0.941210032f},
-std::array<float,2>{0.924576402f, 0.244219258f},
-std::array<float,2>{0.802159429f, 0.790915847f},
-std::array<float,2>{0.339462817f, 0.0511203744f},
-std::array<float,2>{0.222223848f, 0.518216968f},
-std::array<float,2>{0.609394372f, 0.486528665f},
-std::array<float,2>{0.750841796f, 0.509694278f},
-std::array<float,2>{0.353463978f, 0.480283082f},
-std::array<float,2>{0.21351406f, 0.804977298f},
-std::array<float,2>{0.577899635f, 0.038286075f},
-std::array<float,2>{0.639654875f, 0.962706685f},
-std::array<float,2>{0.0459694602f, 0.227060691f},
-std::array<float,2>{0.45062837f, 0.683096528f},
-std::array<float,2>{0.890490711f, 0.258500397f},
-std::array<float,2>{0.509393811f, 0.745953918f},
-std::array<float,2>{0.149864212f, 0.347764492f},
-std::array<float,2>{0.268703461f, 0.913751721f},
-std::array<float,2>{0.857289433f, 0.129986644f},
-std::array<float,2>{0.994467199f, 0.846072614f},
-std::array<float,2>{0.39553377f, 0.0836188719f},
-std::array<float,2>{0.0760715082f, 0.587017f},
-std::array<float,2>{0.68952018f, 0.375161797f},
-std::array<float,2>{0.912155032f, 0.645530999f},
-std::array<float,2>{0.472588778f, 0.293039978f},
-std::array<float,2>{0.0302154366f, 0.969813287f},
-std::array<float,2>{0.676071227f, 0.202379555f},
-std::array<float,2>{0.602514386f, 0.761936784f},
-std::array<float,2>{0.243242055f, 0.0149089713f},
-std::array<float,2>{0.321325153f, 0.542381883f},
-std::array<float,2>{0.783865273f, 0.453933537f},
-std::array<float,2>{0.72084415f, 0.606137455f},
-std::array<float,2>{0.10514351f, 0.410403818f},
-std::array<float,2>{0.406968385f, 0.838146448f},
-std::array<float,2>{0.9658705f, 0.11579746f},
-std::array<float,2>{0.812956214f, 0.880084038f},
-std::array<float,2>{0.300254941f, 0.184888467f},
-std::array<float,2>{0.18702729f, 0.716096938f},
-std::array<float,2>{0.549679458f, 0.32638061f},
-std::array<float,2>{0.794872999f, 0.672814548f},
-std::array<float,2>{0.316976607f, 0.253117561f},
-std::array<float,2>{0.238375381f, 0.955440104f},
-std::array<float,2>{0.597069025f, 0.226460367f},
-std::array<float,2>{0.680191815f, 0.80397886f},
-std::array<float,2>{0.0226015486f, 0.0445853807f},
-std::array<float,2>{0.481287569f, 0.501560152f},
-std::array<float,2>{0.914634168f, 0.469940037f},
-std::array<float,2>{0.562155604f, 0.580505311f},
-std::array<float,2>{0.173852533f, 0.383375198f},
-std::array<float,2>{0.30480212f, 0.858410716f},
-std::array<float,2>{0.821253836f, 0.089794971f},
-std::array<float,2>{0.958554864f, 0.914111733f},
-std::array<float,2>{0.421210259f, 0.138874471f},
-std::array<float,2>{0.0954949558f, 0.739532769f},
-std::array<float,2>{0.727425933f, 0.357307523f},
-std::array<float,2>{0.881779075f, 0.537629247f},
-std::array<float,2>{0.439923018f, 0.467422426f},
-std::array<float,2>{0.0313832536f, 0.754463494f},
-std::array<float,2>{0.63148421f, 0.000761920412f},
-std::array<float,2>{0.567353487f, 0.979555488f},
-std::array<float,2>{0.204683945f, 0.192827269f},
-std::array<float,2>{0.351235181f, 0.655798078f},
-std::array<float,2>{0.758933842f, 0.282664716f},
-std::array<float,2>{0.700688004f, 0.710479796f},
-std::array<float,2>{0.0638320595f, 0.313363135f},
-std::array<float,2>{0.402582526f, 0.883856952f},
-std::array<float,2>{0.990364492f, 0.175147563f},
-std::array<float,2>{0.844929934f, 0.830419838f},
-std::array<float,2>{0.276190042f, 0.118967704f},
-std::array<float,2>{0.143912971f, 0.595066845f},
-std::array<float,2>{0.503190875f, 0.421707988f},
-std::array<float,2>{0.842644453f, 0.613126278f},
-std::array<float,2>{0.286275148f, 0.424107909f},
-std::array<float,2>{0.158032805f, 0.826036811f},
-std::array<float,2>{0.532835186f, 0.0978614241f},
-std::array<float,2>{0.748546302f, 0.905404806f},
-std::array<float,2>{0.116399728f, 0.160175487f},
-std::array<float,2>{0.436304986f, 0.695462584f},
-std::array<float,2>{0.944537699f, 0.339826345f},
-std::array<float,2>{0.617201507f, 0.637672067f},
-std::array<float,2>{0.233131081f, 0.302135915f},
-std::array<float,2>{0.334049881f, 0.995967925f},
-std::array<float,2>{0.811188579f, 0.209261373f},
-std::array<float,2>{0.931083977f, 0.767962217f},
-std::array<float,2>{0.491419047f, 0.0255339406f},
-std::array<float,2>{0.0120454375f, 0.552786827f},
-std::array<float,2>{0.659934759f, 0.444761127f},
-std::array<float,2>{0.97471118f, 0.722545922f},
-std::array<float,2>{0.375017077f, 0.361265719f},
-std::array<float,2>{0.0921709761f, 0.935130954f},
-std::array<float,2>{0.707425892f, 0.14498435f},
-std::array<float,2>{0.53072083f, 0.871510148f},
-std::array<float,2>{0.135665298f, 0.065997459f},
-std::array<float,2>{0.25415656f, 0.574230671f},
-std::array<float,2>{0.868410051f, 0.392313987f},
-std::array<float,2>{0.650795698f, 0.527717948f},
-std::array<float,2>{0.0480557755f, 0.495834976f},
-std::array<float,2>{0.453795373f, 0.78161478f},
-std::array<float,2>{0.900254548f, 0.0586178228f},
-std::array<float,2>{0.776360393f, 0.95209372f},
-std::array<float,2>{0.372349799f, 0.238721102f},
-std::array<float,2>{0.191697598f, 0.671127319f},
-std::array<float,2>{0.586813688f, 0.268169463f},
-std::array<float,2>{0.853745997f, 0.635094464f},
-std::array<float,2>{0.272672445f, 0.300671101f},
-std::array<float,2>{0.154671133f, 0.996470213f},
-std::array<float,2>{0.513373733f, 0.204403266f},
-std::array<float,2>{0.693710864f, 0.770708621f},
-std::array<float,2>{0.0739837587f, 0.0278901756f},
-std::array<float,2>{0.392507851f, 0.548171461f},
-std::array<float,2>{0.997674584f, 0.440824419f},
-std::array<float,2>{0.571989f, 0.61634928f},
-std::array<float,2>{0.217780173f, 0.428155124f},
-std::array<float,2>{0.355979979f, 0.821219206f},
-std::array<float,2>{0.757769287f, 0.0974816531f},
-std::array<float,2>{0.886064708f, 0.899617851f},
-std::array<float,2>{0.446042806f, 0.160028592f},
-std::array<float,2>{0.0412436426f, 0.701194048f},
-std::array<float,2>{0.635834813f, 0.342975795f},
-std::array<float,2>{0.964650989f, 0.527099609f},
-std::array<float,2>{0.41132021f, 0.496414036f},
-std::array<float,2>{0.106130436f, 0.78886801f},
-std::array<float,2>{0.724321365f, 0.0558439754f},
-std::array<float,2>{0.553275406f, 0.947696745f},
-std::array<float,2>{0.180972412f, 0.237950385f},
-std::array<float,2>{0.30083093f, 0.665129423f},
-std::array<float,2>{0.818087935f, 0.270271063f},
-std::array<float,2>{0.673533738f, 0.724098206f},
-std::array<float,2>{0.0239792671f, 0.366804749f},
-std::array<float,2>{0.475024819f, 0.93042326f},
-std::array<float,2>{0.909110069f, 0.143090859f},
-std::array<float,2>{0.786003351f, 0.868371427f},
-std::array<float,2>{0.32764557f, 0.0691730529f},
-std::array<float,2>{0.248941243f, 0.573746622f},
-std::array<float,2>{0.608340502f, 0.396444798f},
-std::array<float,2>{0.768522799f, 0.582183659f},
-std::array<float,2>{0.362636f, 0.387648225f},
-std::array<float,2>{0.196473032f, 0.855041087f},
-std::array<float,2>{0.583436012f, 0.090032734f},
-std::array<float,2>{0.647377193f, 0.919959068f},
-std::array<float,2>{0.058140792f, 0.1355609f},
-std::array<float,2>{0.464463055f, 0.734521747f},
-std::array<float,2>{0.895762146f, 0.351869226f},
-std::array<float,2>{0.519971132f, 0.677581787f},
-std::array<float,2>{0.130039006f, 0.254395664f},
-std::array<float,2>{0.262661099f, 0.960856259f},
-std::array<float,2>{0.859930992f, 0.221387729f},
-std::array<float,2>{0.981139123f, 0.797082067f},
-std::array<float,2>{0.389520377f, 0.0405636579f},
-std::array<float,2>{0.0831043124f, 0.506726503f},
-std::array<float,2>{0.711439371f, 0.475985438f},
-std::array<float,2>{0.927650809f, 0.705912292f},
-std::array<float,2>{0.49261108f, 0.316969007f},
-std::array<float,2>{0.00590502331f, 0.886897147f},
-std::array<float,2>{0.666026473f, 0.179576024f},
-std::array<float,2>{0.616205335f, 0.834795952f},
-std::array<float,2>{0.223185435f, 0.121713325f},
-std::array<float,2>{0.342162222f, 0.598197103f},
-std::array<float,2>{0.800290942f, 0.417233288f},
-std::array<float,2>{0.741798639f, 0.531979382f},
-std::array<float,2>{0.118177064f, 0.464531898f},
-std::array<float,2>{0.427951783f, 0.751081944f},
-std::array<float,2>{0.94853127f, 0.00423776219f},
-std::array<float,2>{0.82992214f, 0.983278215f},
-std::array<float,2>{0.293828994f, 0.18945916f},
-std::array<float,2>{0.167980954f, 0.651911378f},
-std::array<float,2>{0.544998169f, 0.285704643f},
-std::array<float,2>{0.806711912f, 0.746973097f},
-std::array<float,2>{0.328168988f, 0.347237885f},
-std::array<float,2>{0.226768017f, 0.90779376f},
-std::array<float,2>{0.623841047f, 0.127063215f},
-std::array<float,2>{0.660307705f, 0.849376202f},
-std::array<float,2>{0.0105520394f, 0.0808570459f},
-std::array<float,2>{0.487953782f, 0.593649387f},
-std::array<float,2>{0.936088562f, 0.381007552f},
-std::array<float,2>{0.538431048f, 0.511982501f},
-std::array<float,2>{0.163692296f, 0.482140958f},
-std::array<float,2>{0.281358391f, 0.811363161f},
-std::array<float,2>{0.838771164f, 0.0341551043f},
-std::array<float,2>{0.938543022f, 0.966465533f},
-std::array<float,2>{0.431890011f, 0.233136505f},
-std::array<float,2>{0.112368807f, 0.685324073f},
-std::array<float,2>{0.745482922f, 0.264536351f},
-std::array<float,2>{0.905828059f, 0.604254425f},
-std::array<float,2>{0.457391322f, 0.408434123f},
-std::array<float,2>{0.0540927388f, 0.840784431f},
-std::array<float,2>{0.653570831f, 0.112941794f},
-std::array<float,2>{0.590138197f, 0.876634896f},
-std::array<float,2>{0.18870227f, 0.181798056f},
-std::array<float,2>{0.37041229f, 0.711070478f},
-std::array<float,2>{0.778621733f, 0.324208796f},
-std::array<float,2>{0.703774273f, 0.641566217f},
-std::array<float,2>{0.0864689276f, 0.292091191f},
-std::array<float,2>{0.379219085f, 0.974446654f},
-std::array<float,2>{0.968904674f, 0.197996572f},
-std::array<float,2>{0.874522507f, 0.76020664f},
-std::array<float,2>{0.250421703f, 0.0097287409f},
-std::array<float,2>{0.140090451f, 0.545493722f},
-std::array<float,2>{0.52616024f, 0.457492381f},
-std::array<float,2>{0.824921429f, 0.559040785f},
-std::array<float,2>{0.310661882f, 0.449059993f},
-std::array<float,2>{0.175990462f, 0.775512993f},
-std::array<float,2>{0.556283534f, 0.0166833289f},
-std::array<float,2>{0.732223034f, 0.991123617f},
-std::array<float,2>{0.0978742689f, 0.216801435f},
-std::array<float,2>{0.41552949f, 0.632290542f},
-std::array<float,2>{0.953694999f, 0.308385998f},
-std::array<float,2>{0.600355029f, 0.69409287f},
-std::array<float,2>{0.234971061f, 0.334044486f},
-std::array<float,2>{0.315148234f, 0.894660234f},
-std::array<float,2>{0.792765677f, 0.169788048f},
-std::array<float,2>{0.919528186f, 0.818265021f},
-std::array<float,2>{0.477419198f, 0.103744447f},
-std::array<float,2>{0.0167091787f, 0.620172322f},
-std::array<float,2>{0.683719158f, 0.43595019f},
-std::array<float,2>{0.987807453f, 0.660578609f},
-std::array<float,2>{0.401521772f, 0.281052262f},
-std::array<float,2>{0.0667119026f, 0.943435788f},
-std::array<float,2>{0.698366344f, 0.247444019f},
-std::array<float,2>{0.504429758f, 0.794790924f},
-std::array<float,2>{0.14786303f, 0.049482733f},
-std::array<float,2>{0.279977351f, 0.522708297f},
-std::array<float,2>{0.850803912f, 0.490866899f},
-std::array<float,2>{0.626688898f, 0.568435073f},
-std::array<float,2>{0.0373109505f, 0.402772307f},
-std::array<float,2>{0.442883968f, 0.861406028f},
-std::array<float,2>{0.877991319f, 0.0740505978f},
-std::array<float,2>{0.765176952f, 0.923904657f},
-std::array<float,2>{0.345736742f, 0.148608208f},
-std::array<float,2>{0.209320053f, 0.728720665f},
-std::array<float,2>{0.565222323f, 0.373320371f},
-std::array<float,2>{0.84051013f, 0.695950449f},
-std::array<float,2>{0.287824869f, 0.339309037f},
-std::array<float,2>{0.159622803f, 0.906225085f},
-std::array<float,2>{0.534634352f, 0.160864934f},
-std::array<float,2>{0.746240139f, 0.825593114f},
-std::array<float,2>{0.114561655f, 0.0983892903f},
-std::array<float,2>{0.433666021f, 0.612478673f},
-std::array<float,2>{0.941447437f, 0.424702346f},
-std::array<float,2>{0.621059835f, 0.553362966f},
-std::array<float,2>{0.231476948f, 0.445261806f},
-std::array<float,2>{0.332560509f, 0.768336654f},
-std::array<float,2>{0.808909774f, 0.0262196604f},
-std::array<float,2>{0.93256247f, 0.995303512f},
-std::array<float,2>{0.490152895f, 0.209577352f},
-std::array<float,2>{0.013785393f, 0.636925459f},
-std::array<float,2>{0.657906473f, 0.302719086f},
-std::array<float,2>{0.973320842f, 0.57491827f},
-std::array<float,2>{0.377767175f, 0.392087162f},
-std::array<float,2>{0.0910921618f, 0.871716261f},
-std::array<float,2>{0.710323751f, 0.0659025311f},
-std::array<float,2>{0.528273582f, 0.934807241f},
-std::array<float,2>{0.134634539f, 0.14518559f},
-std::array<float,2>{0.256156951f, 0.721862257f},
-std::array<float,2>{0.87029916f, 0.360585183f},
-std::array<float,2>{0.649687946f, 0.671445906f},
-std::array<float,2>{0.050773941f, 0.267945647f},
-std::array<float,2>{0.455209494f, 0.951466501f},
-std::array<float,2>{0.900686681f, 0.239118919f},
-std::array<float,2>{0.774483562f, 0.782163262f},
-std::array<float,2>{0.37382102f, 0.0591638945f},
-std::array<float,2>{0.194504887f, 0.527966201f},
-std::array<float,2>{0.588291228f, 0.495470375f},
-std::array<float,2>{0.796818674f, 0.501307309f},
-std::array<float,2>{0.319237322f, 0.470232964f},
-std::array<float,2>{0.240609616f, 0.804266274f},
-std::array<float,2>{0.593816578f, 0.0441450216f},
-std::array<float,2>{0.681947172f, 0.95584327f},
-std::array<float,2>{0.0208077729f, 0.22589916f},
-std::array<float,2>{0.483358473f, 0.672175586f},
-std::array<float,2>{0.917250574f, 0.253485024f},
-std::array<float,2>{0.558722794f, 0.740025163f},
-std::array<float,2>{0.172429562f, 0.356875122f},
-std::array<float,2>{0.307275087f, 0.914709747f},
-std::array<float,2>{0.822436154f, 0.139478862f},
-std::array<float,2>{0.960411191f, 0.859190166f},
-std::array<float,2>{0.418750137f, 0.0893531665f},
-std::array<float,2>{0.0962068066f, 0.580693245f},
-std::array<float,2>{0.730182648f, 0.38292253f},
-std::array<float,2>{0.880190432f, 0.655713618f},
-std::array<float,2>{0.437693268f, 0.282960743f},
-std::array<float,2>{0.0335150659f, 0.980039477f},
-std::array<float,2>{0.629398465f, 0.193121687f},
-std::array<float,2>{0.57028681f, 0.754134476f},
-std::array<float,2>{0.206415117f, 9.37384393e-05f},
-std::array<float,2>{0.348732829f, 0.537279606f},
-std::array<float,2>{0.760403991f, 0.466838777f},
-std::array<float,2>{0.702619612f, 0.5954355f},
-std::array<float,2>{0.0661169738f, 0.421287268f},
-std::array<float,2>{0.405380338f, 0.830572128f},
-std::array<float,2>{0.989894092f, 0.118225686f},
-std::array<float,2>{0.846267581f, 0.884405017f},
-std::array<float,2>{0.273615777f, 0.175702482f},
-std::array<float,2>{0.141497508f, 0.710436702f},
-std::array<float,2>{0.501185298f, 0.312588811f},
-std::array<float,2>{0.753495693f, 0.683593333f},
-std::array<float,2>{0.354193866f, 0.258088171f},
-std::array<float,2>{0.211620212f, 0.96227026f},
-std::array<float,2>{0.575775206f, 0.226844758f},
-std::array<float,2>{0.637403369f, 0.805181324f},
-std::array<float,2>{0.0435327515f, 0.0388439037f},
-std::array<float,2>{0.451374799f, 0.509168804f},
-std::array<float,2>{0.888372838f, 0.479574591f},
-std::array<float,2>{0.510994494f, 0.587535977f},
-std::array<float,2>{0.152072161f, 0.375881404f},
-std::array<float,2>{0.266756058f, 0.846529365f},
-std::array<float,2>{0.857523024f, 0.0832682103f},
-std::array<float,2>{0.992973626f, 0.913299561f},
-std::array<float,2>{0.397048771f, 0.130477861f},
-std::array<float,2>{0.0769650191f, 0.745200038f},
-std::array<float,2>{0.687964678f, 0.348293096f},
-std::array<float,2>{0.911291838f, 0.542810857f},
-std::array<float,2>{0.469011337f, 0.453178972f},
-std::array<float,2>{0.0283909943f, 0.762483239f},
-std::array<float,2>{0.678274155f, 0.0154805444f},
-std::array<float,2>{0.604093075f, 0.970590532f},
-std::array<float,2>{0.245037913f, 0.203046277f},
-std::array<float,2>{0.322543591f, 0.646067142f},
-std::array<float,2>{0.783035636f, 0.293547422f},
-std::array<float,2>{0.720264912f, 0.716538429f},
-std::array<float,2>{0.102855958f, 0.326764554f},
-std::array<float,2>{0.409665167f, 0.880726993f},
-std::array<float,2>{0.967044592f, 0.185422406f},
-std::array<float,2>{0.815796196f, 0.838729262f},
-std::array<float,2>{0.298789382f, 0.115713879f},
-std::array<float,2>{0.183774322f, 0.605910897f},
-std::array<float,2>{0.547396004f, 0.411031067f},
-std::array<float,2>{0.863926589f, 0.62411046f},
-std::array<float,2>{0.259367853f, 0.43287614f},
-std::array<float,2>{0.128080577f, 0.814834297f},
-std::array<float,2>{0.516293108f, 0.10845042f},
-std::array<float,2>{0.717213273f, 0.893350005f},
-std::array<float,2>{0.0792669505f, 0.167284667f},
-std::array<float,2>{0.384199381f, 0.688278735f},
-std::array<float,2>{0.980089009f, 0.328227937f},
-std::array<float,2>{0.581128895f, 0.625982583f},
-std::array<float,2>{0.201553732f, 0.311445564f},
-std::array<float,2>{0.365370601f, 0.986993313f},
-std::array<float,2>{0.77091068f, 0.214794934f},
-std::array<float,2>{0.893618166f, 0.77965939f},
-std::array<float,2>{0.466093659f, 0.0224575214f},
-std::array<float,2>{0.06044323f, 0.555151939f},
-std::array<float,2>{0.642209589f, 0.449592501f},
-std::array<float,2>{0.949961901f, 0.732597768f},
-std::array<float,2>{0.423032016f, 0.371000111f},
-std::array<float,2>{0.121431537f, 0.928007364f},
-std::array<float,2>{0.734417796f, 0.153837487f},
-std::array<float,2>{0.541947782f, 0.863722622f},
-std::array<float,2>{0.164926678f, 0.0778904185f},
-std::array<float,2>{0.292746663f, 0.564719737f},
-std::array<float,2>{0.835578561f, 0.398650497f},
-std::array<float,2>{0.670745313f, 0.517582059f},
-std::array<float,2>{0.00281794881f, 0.487096608f},
-std::array<float,2>{0.498772681f, 0.790117383f},
-std::array<float,2>{0.923332572f, 0.0516557619f},
-std::array<float,2>{0.803877473f, 0.940889835f},
-std::array<float,2>{0.336384267f, 0.245030239f},
-std::array<float,2>{0.219391972f, 0.656410336f},
-std::array<float,2>{0.611917734f, 0.275336206f},
-std::array<float,2>{0.818880558f, 0.667860746f},
-std::array<float,2>{0.303057164f, 0.273007363f},
-std::array<float,2>{0.182429209f, 0.945677996f},
-std::array<float,2>{0.550797343f, 0.236220807f},
-std::array<float,2>{0.725144148f, 0.787073135f},
-std::array<float,2>{0.107878886f, 0.0575837456f},
-std::array<float,2>{0.412477046f, 0.524936259f},
-std::array<float,2>{0.962082505f, 0.498074949f},
-std::array<float,2>{0.605894268f, 0.570645452f},
-std::array<float,2>{0.246183529f, 0.396824926f},
-std::array<float,2>{0.325511307f, 0.869270384f},
-std::array<float,2>{0.788047791f, 0.0681003854f},
-std::array<float,2>{0.906729817f, 0.931953371f},
-std::array<float,2>{0.473256916f, 0.14169091f},
-std::array<float,2>{0.0264449622f, 0.726048291f},
-std::array<float,2>{0.674191058f, 0.364389986f},
-std::array<float,2>{0.999039114f, 0.550572097f},
-std::array<float,2>{0.393894017f, 0.43900165f},
-std::array<float,2>{0.0712606609f, 0.772298038f},
-std::array<float,2>{0.692282498f, 0.0311719924f},
-std::array<float,2>{0.514054954f, 0.998999715f},
-std::array<float,2>{0.153141722f, 0.206958041f},
-std::array<float,2>{0.269803673f, 0.633856714f},
-std::array<float,2>{0.852093399f, 0.297967345f},
-std::array<float,2>{0.63368696f, 0.700687349f},
-std::array<float,2>{0.0405181497f, 0.34035641f},
-std::array<float,2>{0.449025184f, 0.901683927f},
-std::array<float,2>{0.88402307f, 0.15770033f},
-std::array<float,2>{0.755679309f, 0.822405338f},
-std::array<float,2>{0.358899593f, 0.0950628817f},
-std::array<float,2>{0.21551697f, 0.614416003f},
-std::array<float,2>{0.573296249f, 0.427127093f},
-std::array<float,2>{0.797128618f, 0.601260185f},
-std::array<float,2>{0.341736317f, 0.415412873f},
-std::array<float,2>{0.225002974f, 0.832997024f},
-std::array<float,2>{0.613616943f, 0.123634018f},
-std::array<float,2>{0.665830076f, 0.888980031f},
-std::array<float,2>{0.00488019828f, 0.175961971f},
-std::array<float,2>{0.495422989f, 0.703179598f},
-std::array<float,2>{0.928077519f, 0.318683982f},
-std::array<float,2>{0.544438541f, 0.649424374f},
-std::array<float,2>{0.170390695f, 0.287859172f},
-std::array<float,2>{0.295538634f, 0.98233211f},
-std::array<float,2>{0.830606282f, 0.188609049f},
-std::array<float,2>{0.945392311f, 0.753898323f},
-std::array<float,2>{0.426456749f, 0.00686427765f},
-std::array<float,2>{0.120084442f, 0.533430696f},
-std::array<float,2>{0.740158021f, 0.461505234f},
-std::array<float,2>{0.898133993f, 0.738146365f},
-std::array<float,2>{0.462483943f, 0.354224265f},
-std::array<float,2>{0.0555827692f, 0.919054568f},
-std::array<float,2>{0.646102607f, 0.133346617f},
-std::array<float,2>{0.585711539f, 0.852704823f},
-std::array<float,2>{0.198650241f, 0.0930929333f},
-std::array<float,2>{0.360647857f, 0.584651649f},
-std::array<float,2>{0.767287731f, 0.390512884f},
-std::array<float,2>{0.714157939f, 0.504555583f},
-std::array<float,2>{0.0842311457f, 0.47449854f},
-std::array<float,2>{0.386824101f, 0.799760938f},
-std::array<float,2>{0.98384881f, 0.0423094854f},
-std::array<float,2>{0.862700582f, 0.957647204f},
-std::array<float,2>{0.264436424f, 0.219113007f},
-std::array<float,2>{0.13167654f, 0.678058505f},
-std::array<float,2>{0.522526026f, 0.256808728f},
-std::array<float,2>{0.781074047f, 0.713874519f},
-std::array<float,2>{0.367206454f, 0.320930272f},
-std::array<float,2>{0.189807728f, 0.878280938f},
-std::array<float,2>{0.592334688f, 0.180330232f},
-std::array<float,2>{0.655646145f, 0.842815936f},
-std::array<float,2>{0.0512412526f, 0.109612159f},
-std::array<float,2>{0.459775299f, 0.601933002f},
-std::array<float,2>{0.90324235f, 0.406778544f},
-std::array<float,2>{0.523790061f, 0.544862866f},
-std::array<float,2>{0.137314826f, 0.459959298f},
-std::array<float,2>{0.252181828f, 0.758984447f},
-std::array<float,2>{0.871440768f, 0.010824617f},
-std::array<float,2>{0.971900761f, 0.976433277f},
-std::array<float,2>{0.381074876f, 0.195772156f},
-std::array<float,2>{0.0888757408f, 0.644163966f},
-std::array<float,2>{0.70585984f, 0.290979028f},
-std::array<float,2>{0.93434f, 0.591520846f},
-std::array<float,2>{0.48475486f, 0.380069703f},
-std::array<float,2>{0.00788257644f, 0.85145545f},
-std::array<float,2>{0.662532628f, 0.0790345967f},
-std::array<float,2>{0.621242225f, 0.908787847f},
-std::array<float,2>{0.228910834f, 0.125301957f},
-std::array<float,2>{0.331294596f, 0.749818861f},
-std::array<float,2>{0.806302011f, 0.345152229f},
-std::array<float,2>{0.742964685f, 0.68637985f},
-std::array<float,2>{0.111306079f, 0.262369901f},
-std::array<float,2>{0.430478036f, 0.967537522f},
-std::array<float,2>{0.941000581f, 0.231986672f},
-std::array<float,2>{0.836421072f, 0.809382915f},
-std::array<float,2>{0.285090536f, 0.0322943404f},
-std::array<float,2>{0.161373347f, 0.513974488f},
-std::array<float,2>{0.535680532f, 0.483868182f},
-std::array<float,2>{0.848875463f, 0.520367026f},
-std::array<float,2>{0.277948737f, 0.488373786f},
-std::array<float,2>{0.144765794f, 0.795772672f},
-std::array<float,2>{0.506866753f, 0.0480161868f},
-std::array<float,2>{0.695729613f, 0.941509783f},
-std::array<float,2>{0.0689893439f, 0.248966873f},
-std::array<float,2>{0.398599803f, 0.6637429f},
-std::array<float,2>{0.984771848f, 0.279088229f},
-std::array<float,2>{0.563076079f, 0.726823986f},
-std::array<float,2>{0.208657369f, 0.372155458f},
-std::array<float,2>{0.344115913f, 0.923767328f},
-std::array<float,2>{0.762369215f, 0.150667071f},
-std::array<float,2>{0.876227677f, 0.860765696f},
-std::array<float,2>{0.443392128f, 0.0704906434f},
-std::array<float,2>{0.0358975157f, 0.566609681f},
-std::array<float,2>{0.627230763f, 0.405180126f},
-std::array<float,2>{0.956319749f, 0.630256295f},
-std::array<float,2>{0.416080117f, 0.306315064f},
-std::array<float,2>{0.100202449f, 0.989169359f},
-std::array<float,2>{0.733152449f, 0.216117248f},
-std::array<float,2>{0.557954431f, 0.774946272f},
-std::array<float,2>{0.178160086f, 0.0178987067f},
-std::array<float,2>{0.310032248f, 0.561849952f},
-std::array<float,2>{0.826675296f, 0.446660787f},
-std::array<float,2>{0.686851323f, 0.617537498f},
-std::array<float,2>{0.0190428179f, 0.434354424f},
-std::array<float,2>{0.479722083f, 0.819570005f},
-std::array<float,2>{0.920562327f, 0.103139728f},
-std::array<float,2>{0.790132046f, 0.898160934f},
-std::array<float,2>{0.313179582f, 0.170927092f},
-std::array<float,2>{0.23646237f, 0.691521645f},
-std::array<float,2>{0.599242151f, 0.332200855f},
-std::array<float,2>{0.868764043f, 0.720163524f},
-std::array<float,2>{0.254630923f, 0.362390459f},
-std::array<float,2>{0.135025606f, 0.937283099f},
-std::array<float,2>{0.531086147f, 0.147203103f},
-std::array<float,2>{0.70771879f, 0.87428993f},
-std::array<float,2>{0.0926435739f, 0.063073881f},
-std::array<float,2>{0.375876576f, 0.57733041f},
-std::array<float,2>{0.975145578f, 0.392796725f},
-std::array<float,2>{0.586398244f, 0.530497432f},
-std::array<float,2>{0.192178592f, 0.493673623f},
-std::array<float,2>{0.372851312f, 0.784730911f},
-std::array<float,2>{0.77540952f, 0.0621692725f},
-std::array<float,2>{0.899851322f, 0.949824691f},
-std::array<float,2>{0.453189552f, 0.240959138f},
-std::array<float,2>{0.0485414229f, 0.669551194f},
-std::array<float,2>{0.6510185f, 0.266659021f},
-std::array<float,2>{0.945150435f, 0.611100018f},
-std::array<float,2>{0.435686052f, 0.422735035f},
-std::array<float,2>{0.116745226f, 0.827313483f},
-std::array<float,2>{0.748461902f, 0.10040424f},
-std::array<float,2>{0.53268069f, 0.902787924f},
-std::array<float,2>{0.157469839f, 0.162763864f},
-std::array<float,2>{0.286667794f, 0.697298884f},
-std::array<float,2>{0.841870368f, 0.337443024f},
-std::array<float,2>{0.659376442f, 0.639183879f},
-std::array<float,2>{0.0124238171f, 0.304608017f},
-std::array<float,2>{0.491880387f, 0.992667496f},
-std::array<float,2>{0.931222618f, 0.207197621f},
-std::array<float,2>{0.810702503f, 0.766634285f},
-std::array<float,2>{0.334911793f, 0.0251815133f},
-std::array<float,2>{0.232520133f, 0.551614523f},
-std::array<float,2>{0.617987335f, 0.441916496f},
-std::array<float,2>{0.759765446f, 0.536450386f},
-std::array<float,2>{0.351063728f, 0.464862883f},
-std::array<float,2>{0.2044539f, 0.756703913f},
-std::array<float,2>{0.566604555f, 0.0021973534f},
-std::array<float,2>{0.631192923f, 0.978388548f},
-std::array<float,2>{0.0317447186f, 0.19509159f},
-std::array<float,2>{0.440183401f, 0.653343916f},
-std::array<float,2>{0.881186545f, 0.283262372f},
-std::array<float,2>{0.503882349f, 0.708651185f},
-std::array<float,2>{0.14441897f, 0.314796835f},
-std::array<float,2>{0.275690198f, 0.885416985f},
-std::array<float,2>{0.845617652f, 0.173426941f},
-std::array<float,2>{0.991140783f, 0.828784883f},
-std::array<float,2>{0.403208375f, 0.120106138f},
-std::array<float,2>{0.0643752143f, 0.595838547f},
-std::array<float,2>{0.700658023f, 0.418939978f},
-std::array<float,2>{0.914234102f, 0.67466867f},
-std::array<float,2>{0.480593204f, 0.251329511f},
-std::array<float,2>{0.0230173133f, 0.954893291f},
-std::array<float,2>{0.67994833f, 0.222864196f},
-std::array<float,2>{0.597177267f, 0.802728117f},
-std::array<float,2>{0.239180908f, 0.0463232733f},
-std::array<float,2>{0.316782743f, 0.50213176f},
-std::array<float,2>{0.79426378f, 0.472099513f},
-std::array<float,2>{0.726648569f, 0.579796672f},
-std::array<float,2>{0.0951000154f, 0.386160105f},
-std::array<float,2>{0.421480358f, 0.856122911f},
-std::array<float,2>{0.958061934f, 0.0871321112f},
-std::array<float,2>{0.820404768f, 0.916883588f},
-std::array<float,2>{0.305244386f, 0.138122395f},
-std::array<float,2>{0.174608111f, 0.74116236f},
-std::array<float,2>{0.561716974f, 0.358943403f},
-std::array<float,2>{0.783573925f, 0.647716641f},
-std::array<float,2>{0.322004855f, 0.29672426f},
-std::array<float,2>{0.243964389f, 0.972075582f},
-std::array<float,2>{0.601889014f, 0.201029301f},
-std::array<float,2>{0.676456511f, 0.763788521f},
-std::array<float,2>{0.0294223782f, 0.0132852849f},
-std::array<float,2>{0.472105443f, 0.5407902f},
-std::array<float,2>{0.912897229f, 0.456067324f},
-std::array<float,2>{0.548988283f, 0.607448339f},
-std::array<float,2>{0.186822474f, 0.413848013f},
-std::array<float,2>{0.300581336f, 0.837394357f},
-std::array<float,2>{0.813220561f, 0.1145432f},
-std::array<float,2>{0.966495275f, 0.881688237f},
-std::array<float,2>{0.406492352f, 0.186069891f},
-std::array<float,2>{0.104961619f, 0.718702793f},
-std::array<float,2>{0.721529305f, 0.324705482f},
-std::array<float,2>{0.890102804f, 0.510108948f},
-std::array<float,2>{0.450998276f, 0.477061212f},
-std::array<float,2>{0.0467018001f, 0.807712317f},
-std::array<float,2>{0.640611112f, 0.035661716f},
-std::array<float,2>{0.577514887f, 0.964066863f},
-std::array<float,2>{0.212905675f, 0.230309367f},
-std::array<float,2>{0.352719456f, 0.680162966f},
-std::array<float,2>{0.750432968f, 0.261578381f},
-std::array<float,2>{0.690285742f, 0.743636668f},
-std::array<float,2>{0.0756612197f, 0.351183921f},
-std::array<float,2>{0.396187931f, 0.911634684f},
-std::array<float,2>{0.995104134f, 0.132585555f},
-std::array<float,2>{0.856509447f, 0.843762457f},
-std::array<float,2>{0.269089282f, 0.0842934698f},
-std::array<float,2>{0.150179744f, 0.589548826f},
-std::array<float,2>{0.509238243f, 0.378782034f},
-std::array<float,2>{0.832692802f, 0.562522054f},
-std::array<float,2>{0.289572567f, 0.400431484f},
-std::array<float,2>{0.166977182f, 0.866090655f},
-std::array<float,2>{0.539208055f, 0.0746659711f},
-std::array<float,2>{0.737870395f, 0.925913095f},
-std::array<float,2>{0.12318594f, 0.154900819f},
-std::array<float,2>{0.424356699f, 0.731240034f},
-std::array<float,2>{0.952622592f, 0.368095666f},
-std::array<float,2>{0.610321879f, 0.658750594f},
-std::array<float,2>{0.221974343f, 0.276972353f},
-std::array<float,2>{0.338983715f, 0.938060522f},
-std::array<float,2>{0.802523553f, 0.242226526f},
-std::array<float,2>{0.923995316f, 0.792125821f},
-std::array<float,2>{0.497677118f, 0.0544576347f},
-std::array<float,2>{0.000112155525f, 0.516733289f},
-std::array<float,2>{0.669752479f, 0.484508812f},
-std::array<float,2>{0.977089107f, 0.691296041f},
-std::array<float,2>{0.386489481f, 0.331605732f},
-std::array<float,2>{0.0806293041f, 0.892311633f},
-std::array<float,2>{0.715445817f, 0.165651083f},
-std::array<float,2>{0.517783225f, 0.81409961f},
-std::array<float,2>{0.125515416f, 0.105560713f},
-std::array<float,2>{0.260830909f, 0.622017503f},
-std::array<float,2>{0.865532994f, 0.430262476f},
-std::array<float,2>{0.644273937f, 0.558437526f},
-std::array<float,2>{0.0616117679f, 0.45143348f},
-std::array<float,2>{0.467247784f, 0.7785092f},
-std::array<float,2>{0.892258167f, 0.0213575158f},
-std::array<float,2>{0.772939205f, 0.985734999f},
-std::array<float,2>{0.363882303f, 0.211923599f},
-std::array<float,2>{0.200222462f, 0.62762928f},
-std::array<float,2>{0.579907477f, 0.309310794f},
-std::array<float,2>{0.861079812f, 0.679483593f},
-std::array<float,2>{0.26342234f, 0.257519275f},
-std::array<float,2>{0.129044786f, 0.958822846f},
-std::array<float,2>{0.521022975f, 0.220399976f},
-std::array<float,2>{0.712642014f, 0.800483584f},
-std::array<float,2>{0.082827054f, 0.0416910462f},
-std::array<float,2>{0.389743567f, 0.50531131f},
-std::array<float,2>{0.982238114f, 0.473618984f},
-std::array<float,2>{0.58259052f, 0.58564353f},
-std::array<float,2>{0.195365414f, 0.389386624f},
-std::array<float,2>{0.361784935f, 0.852329731f},
-std::array<float,2>{0.768927395f, 0.0918729231f},
-std::array<float,2>{0.894813418f, 0.91865027f},
-std::array<float,2>{0.463374853f, 0.134528458f},
-std::array<float,2>{0.0566800684f, 0.736999035f},
-std::array<float,2>{0.647610605f, 0.354790568f},
-std::array<float,2>{0.948173881f, 0.534744799f},
-std::array<float,2>{0.429524034f, 0.462872714f},
-std::array<float,2>{0.117250219f, 0.752715826f},
-std::array<float,2>{0.740760267f, 0.0064469967f},
-std::array<float,2>{0.546114385f, 0.980950117f},
-std::array<float,2>{0.169463292f, 0.18800734f},
-std::array<float,2>{0.294245303f, 0.648578644f},
-std::array<float,2>{0.828841984f, 0.288925439f},
-std::array<float,2>{0.667041659f, 0.704262733f},
-std::array<float,2>{0.00684979232f, 0.31968683f},
-std::array<float,2>{0.493239284f, 0.889932752f},
-std::array<float,2>{0.926157117f, 0.177373648f},
-std::array<float,2>{0.79909724f, 0.833090961f},
-std::array<float,2>{0.342834473f, 0.124071494f},
-std::array<float,2>{0.224607468f, 0.600231886f},
-std::array<float,2>{0.616762102f, 0.4149324f},
-std::array<float,2>{0.756407619f, 0.614234447f},
-std::array<float,2>{0.356909424f, 0.426221609f},
-std::array<float,2>{0.217713073f, 0.824154675f},
-std::array<float,2>{0.571130335f, 0.0940934122f},
-std::array<float,2>{0.635158241f, 0.901226223f},
-std::array<float,2>{0.0424051732f, 0.15631327f},
-std::array<float,2>{0.446875513f, 0.699618995f},
-std::array<float,2>{0.884820342f, 0.341428488f},
-std::array<float,2>{0.511801302f, 0.63308233f},
-std::array<float,2>{0.156237051f, 0.296982646f},
-std::array<float,2>{0.27236408f, 0.999333739f},
-std::array<float,2>{0.855408847f, 0.205422148f},
-std::array<float,2>{0.996572614f, 0.773081779f},
-std::array<float,2>{0.391473264f, 0.0302259494f},
-std::array<float,2>{0.0732255504f, 0.549553096f},
-std::array<float,2>{0.695233941f, 0.437630773f},
-std::array<float,2>{0.909794509f, 0.72515893f},
-std::array<float,2>{0.475616902f, 0.363567859f},
-std::array<float,2>{0.0249481592f, 0.933228731f},
-std::array<float,2>{0.672657132f, 0.141090855f},
-std::array<float,2>{0.608897924f, 0.8709355f},
-std::array<float,2>{0.249954745f, 0.0670095012f},
-std::array<float,2>{0.327095807f, 0.571567297f},
-std::array<float,2>{0.786280155f, 0.397461802f},
-std::array<float,2>{0.723093212f, 0.523886085f},
-std::array<float,2>{0.106867947f, 0.499089271f},
-std::array<float,2>{0.410735399f, 0.785642564f},
-std::array<float,2>{0.963670135f, 0.0582369678f},
-std::array<float,2>{0.81716615f, 0.946462214f},
-std::array<float,2>{0.302533418f, 0.235315531f},
-std::array<float,2>{0.180649728f, 0.666967213f},
-std::array<float,2>{0.554499567f, 0.271883011f},
-std::array<float,2>{0.791262329f, 0.693100214f},
-std::array<float,2>{0.315665841f, 0.333632737f},
-std::array<float,2>{0.236220106f, 0.896521926f},
-std::array<float,2>{0.601234615f, 0.170481354f},
-std::array<float,2>{0.685343385f, 0.819171011f},
-std::array<float,2>{0.0164510235f, 0.101987198f},
-std::array<float,2>{0.477975935f, 0.618565381f},
-std::array<float,2>{0.918759167f, 0.435087144f},
-std::array<float,2>{0.555441678f, 0.560829103f},
-std::array<float,2>{0.176968783f, 0.445693374f},
-std::array<float,2>{0.312276989f, 0.773617089f},
-std::array<float,2>{0.82590872f, 0.0190115832f},
-std::array<float,2>{0.954808712f, 0.989349782f},
-std::array<float,2>{0.41470027f, 0.215322897f},
-std::array<float,2>{0.0989084914f, 0.629651785f},
-std::array<float,2>{0.730484903f, 0.305135399f},
-std::array<float,2>{0.877840042f, 0.568086982f},
-std::array<float,2>{0.441862851f, 0.405814022f},
-std::array<float,2>{0.0383020155f, 0.860325158f},
-std::array<float,2>{0.625527799f, 0.0714519024f},
-std::array<float,2>{0.565975904f, 0.922051251f},
-std::array<float,2>{0.210565388f, 0.152263537f},
-std::array<float,2>{0.347183198f, 0.727861702f},
-std::array<float,2>{0.76453644f, 0.371951401f},
-std::array<float,2>{0.697961032f, 0.662858665f},
-std::array<float,2>{0.0677323863f, 0.277541667f},
-std::array<float,2>{0.401007146f, 0.943174541f},
-std::array<float,2>{0.986552179f, 0.249618828f},
-std::array<float,2>{0.850274801f, 0.796775818f},
-std::array<float,2>{0.28082943f, 0.0475225449f},
-std::array<float,2>{0.146824479f, 0.521339655f},
-std::array<float,2>{0.505500793f, 0.489642441f},
-std::array<float,2>{0.839426935f, 0.515104711f},
-std::array<float,2>{0.282391459f, 0.482812494f},
-std::array<float,2>{0.163071662f, 0.80984962f},
-std::array<float,2>{0.537755787f, 0.0316850729f},
-std::array<float,2>{0.744880259f, 0.968067288f},
-std::array<float,2>{0.112179562f, 0.230995312f},
-std::array<float,2>{0.432659745f, 0.686659873f},
-std::array<float,2>{0.937696636f, 0.263005286f},
-std::array<float,2>{0.624282539f, 0.749001622f},
-std::array<float,2>{0.228188172f, 0.343930364f},
-std::array<float,2>{0.329978734f, 0.909781873f},
-std::array<float,2>{0.807862341f, 0.12670894f},
-std::array<float,2>{0.936715126f, 0.850354552f},
-std::array<float,2>{0.487250865f, 0.0791273117f},
-std::array<float,2>{0.0112774288f, 0.590557456f},
-std::array<float,2>{0.661632717f, 0.378994197f},
-std::array<float,2>{0.970661461f, 0.642669797f},
-std::array<float,2>{0.380755335f, 0.289601684f},
-std::array<float,2>{0.0876765996f, 0.974748552f},
-std::array<float,2>{0.704250038f, 0.196618587f},
-std::array<float,2>{0.526604772f, 0.758374453f},
-std::array<float,2>{0.139354005f, 0.0107169496f},
-std::array<float,2>{0.251738131f, 0.543016136f},
-std::array<float,2>{0.87361455f, 0.460769951f},
-std::array<float,2>{0.653302431f, 0.603328884f},
-std::array<float,2>{0.0534830056f, 0.407857716f},
-std::array<float,2>{0.458364457f, 0.842267931f},
-std::array<float,2>{0.90489012f, 0.110929862f},
-std::array<float,2>{0.777477503f, 0.877821147f},
-std::array<float,2>{0.369280487f, 0.181250855f},
-std::array<float,2>{0.188377261f, 0.713585675f},
-std::array<float,2>{0.591630042f, 0.321544141f},
-std::array<float,2>{0.823256552f, 0.742149472f},
-std::array<float,2>{0.308370322f, 0.358203232f},
-std::array<float,2>{0.1736788f, 0.917661607f},
-std::array<float,2>{0.559759915f, 0.137425989f},
-std::array<float,2>{0.728932619f, 0.856675148f},
-std::array<float,2>{0.096897766f, 0.0868418217f},
-std::array<float,2>{0.419842511f, 0.578794539f},
-std::array<float,2>{0.95987916f, 0.385345906f},
-std::array<float,2>{0.595393717f, 0.502987027f},
-std::array<float,2>{0.24208495f, 0.471630543f},
-std::array<float,2>{0.319911003f, 0.801490128f},
-std::array<float,2>{0.795646846f, 0.0455856137f},
-std::array<float,2>{0.916554511f, 0.953401029f},
-std::array<float,2>{0.483619064f, 0.223734587f},
-std::array<float,2>{0.0200512577f, 0.674981296f},
-std::array<float,2>{0.682920396f, 0.25029093f},
-std::array<float,2>{0.98874265f, 0.59763211f},
-std::array<float,2>{0.405004412f, 0.419206053f},
-std::array<float,2>{0.0651112348f, 0.829137623f},
-std::array<float,2>{0.701821566f, 0.120220594f},
-std::array<float,2>{0.500061214f, 0.886276186f},
-std::array<float,2>{0.141880214f, 0.172173306f},
-std::array<float,2>{0.274923176f, 0.70764941f},
-std::array<float,2>{0.846841097f, 0.316255093f},
-std::array<float,2>{0.630602181f, 0.652650058f},
-std::array<float,2>{0.0351120569f, 0.284804195f},
-std::array<float,2>{0.439321667f, 0.977072716f},
-std::array<float,2>{0.879640222f, 0.193795919f},
-std::array<float,2>{0.761232138f, 0.757321835f},
-std::array<float,2>{0.347774655f, 0.00370719656f},
-std::array<float,2>{0.205149978f, 0.535810053f},
-std::array<float,2>{0.569099009f, 0.466214508f},
-std::array<float,2>{0.809943914f, 0.55202502f},
-std::array<float,2>{0.333820432f, 0.442756742f},
-std::array<float,2>{0.231260389f, 0.766046345f},
-std::array<float,2>{0.61998111f, 0.0239586681f},
-std::array<float,2>{0.657105625f, 0.993533432f},
-std::array<float,2>{0.0151891261f, 0.20844835f},
-std::array<float,2>{0.488810718f, 0.640232325f},
-std::array<float,2>{0.933458447f, 0.303403288f},
-std::array<float,2>{0.533845425f, 0.698754907f},
-std::array<float,2>{0.158683941f, 0.336056799f},
-std::array<float,2>{0.28857857f, 0.904022753f},
-std::array<float,2>{0.84174782f, 0.164004669f},
-std::array<float,2>{0.942619264f, 0.826199532f},
-std::array<float,2>{0.435364604f, 0.101418033f},
-std::array<float,2>{0.114121176f, 0.610245883f},
-std::array<float,2>{0.747436762f, 0.423305899f},
-std::array<float,2>{0.902132988f, 0.668290198f},
-std::array<float,2>{0.456857502f, 0.265837818f},
-std::array<float,2>{0.0497545674f, 0.951154292f},
-std::array<float,2>{0.64912653f, 0.241373643f},
-std::array<float,2>{0.589497864f, 0.783753753f},
-std::array<float,2>{0.19346568f, 0.0609623529f},
-std::array<float,2>{0.374687284f, 0.530029178f},
-std::array<float,2>{0.7743209f, 0.492668271f},
-std::array<float,2>{0.709571302f, 0.576868892f},
-std::array<float,2>{0.0900851935f, 0.394497961f},
-std::array<float,2>{0.378048539f, 0.873250127f},
-std::array<float,2>{0.974105716f, 0.0640208796f},
-std::array<float,2>{0.869359732f, 0.935906351f},
-std::array<float,2>{0.257690161f, 0.14841406f},
-std::array<float,2>{0.133290067f, 0.719075203f},
-std::array<float,2>{0.528569818f, 0.361548394f},
-std::array<float,2>{0.770335436f, 0.628798664f},
-std::array<float,2>{0.366314143f, 0.310539603f},
-std::array<float,2>{0.202990174f, 0.984492838f},
-std::array<float,2>{0.580219865f, 0.211480975f},
-std::array<float,2>{0.640748262f, 0.77746141f},
-std::array<float,2>{0.0591526292f, 0.0203644708f},
-std::array<float,2>{0.465515018f, 0.557113051f},
-std::array<float,2>{0.893225849f, 0.45284757f},
-std::array<float,2>{0.517357826f, 0.622201145f},
-std::array<float,2>{0.127127886f, 0.430748492f},
-std::array<float,2>{0.25793913f, 0.812842965f},
-std::array<float,2>{0.864584208f, 0.106877536f},
-std::array<float,2>{0.978883445f, 0.89110142f},
-std::array<float,2>{0.383464336f, 0.164727062f},
-std::array<float,2>{0.0784271061f, 0.690243959f},
-std::array<float,2>{0.718092203f, 0.330173135f},
-std::array<float,2>{0.921923637f, 0.516177297f},
-std::array<float,2>{0.499790728f, 0.486091733f},
-std::array<float,2>{0.0034898119f, 0.791124105f},
-std::array<float,2>{0.67123729f, 0.0534124859f},
-std::array<float,2>{0.613001645f, 0.9393574f},
-std::array<float,2>{0.220437899f, 0.243456915f},
-std::array<float,2>{0.337544322f, 0.660067141f},
-std::array<float,2>{0.803637326f, 0.276358724f},
-std::array<float,2>{0.736025393f, 0.732160151f},
-std::array<float,2>{0.12278644f, 0.368342817f},
-std::array<float,2>{0.42283389f, 0.927490771f},
-std::array<float,2>{0.950774014f, 0.155435786f},
-std::array<float,2>{0.834168136f, 0.866268814f},
-std::array<float,2>{0.29129073f, 0.0752113983f},
-std::array<float,2>{0.165887371f, 0.563702643f},
-std::array<float,2>{0.542703688f, 0.401603103f},
-std::array<float,2>{0.859022081f, 0.588469803f},
-std::array<float,2>{0.265952528f, 0.377376825f},
-std::array<float,2>{0.150572181f, 0.84520936f},
-std::array<float,2>{0.510056138f, 0.0854889452f},
-std::array<float,2>{0.688619614f, 0.910740197f},
-std::array<float,2>{0.0779408813f, 0.131073967f},
-std::array<float,2>{0.39823696f, 0.742679179f},
-std::array<float,2>{0.993527889f, 0.350553751f},
-std::array<float,2>{0.57436651f, 0.680749893f},
-std::array<float,2>{0.212054566f, 0.259801418f},
-std::array<float,2>{0.354555309f, 0.963674784f},
-std::array<float,2>{0.752095461f, 0.228984267f},
-std::array<float,2>{0.887636542f, 0.806770623f},
-std::array<float,2>{0.453020811f, 0.0370227136f},
-std::array<float,2>{0.0446763411f, 0.511608541f},
-std::array<float,2>{0.638213098f, 0.478087664f},
-std::array<float,2>{0.967885673f, 0.716845095f},
-std::array<float,2>{0.409035832f, 0.32566303f},
-std::array<float,2>{0.102287531f, 0.882613778f},
-std::array<float,2>{0.719457984f, 0.18696107f},
-std::array<float,2>{0.548465014f, 0.836418331f},
-std::array<float,2>{0.18534191f, 0.113940582f},
-std::array<float,2>{0.297195196f, 0.608803868f},
-std::array<float,2>{0.814973891f, 0.412774891f},
-std::array<float,2>{0.679268122f, 0.539749503f},
-std::array<float,2>{0.028171381f, 0.455270201f},
-std::array<float,2>{0.470544547f, 0.764962673f},
-std::array<float,2>{0.91108948f, 0.0120701585f},
-std::array<float,2>{0.781900823f, 0.971307337f},
-std::array<float,2>{0.323381841f, 0.19984892f},
-std::array<float,2>{0.245410278f, 0.646744013f},
-std::array<float,2>{0.60460335f, 0.295802504f},
-std::array<float,2>{0.831827283f, 0.651159644f},
-std::array<float,2>{0.296677202f, 0.286795318f},
-std::array<float,2>{0.171263948f, 0.984369636f},
-std::array<float,2>{0.543785393f, 0.190469369f},
-std::array<float,2>{0.738667548f, 0.750781894f},
-std::array<float,2>{0.121076114f, 0.00575697236f},
-std::array<float,2>{0.4272241f, 0.53249675f},
-std::array<float,2>{0.946854472f, 0.463057995f},
-std::array<float,2>{0.614970505f, 0.598956883f},
-std::array<float,2>{0.225736633f, 0.416019142f},
-std::array<float,2>{0.339959413f, 0.835507393f},
-std::array<float,2>{0.798660934f, 0.122896865f},
-std::array<float,2>{0.928728998f, 0.888515472f},
-std::array<float,2>{0.494745553f, 0.178488687f},
-std::array<float,2>{0.00559829455f, 0.706778705f},
-std::array<float,2>{0.664949417f, 0.318323731f},
-std::array<float,2>{0.982826769f, 0.507688046f},
-std::array<float,2>{0.387930214f, 0.475484759f},
-std::array<float,2>{0.0854535997f, 0.79826045f},
-std::array<float,2>{0.713194013f, 0.0392669886f},
-std::array<float,2>{0.522388875f, 0.959013164f},
-std::array<float,2>{0.132084653f, 0.222200245f},
-std::array<float,2>{0.265507728f, 0.675849378f},
-std::array<float,2>{0.861581147f, 0.255842835f},
-std::array<float,2>{0.645477235f, 0.7361781f},
-std::array<float,2>{0.0564304926f, 0.352936745f},
-std::array<float,2>{0.461265981f, 0.921453357f},
-std::array<float,2>{0.897301316f, 0.135932297f},
-std::array<float,2>{0.765637398f, 0.853632987f},
-std::array<float,2>{0.359773904f, 0.0910132155f},
-std::array<float,2>{0.197413608f, 0.583588183f},
-std::array<float,2>{0.584921539f, 0.387791663f},
-std::array<float,2>{0.788459718f, 0.572935402f},
-std::array<float,2>{0.325006038f, 0.394606829f},
-std::array<float,2>{0.247253254f, 0.867304087f},
-std::array<float,2>{0.607305408f, 0.0693454668f},
-std::array<float,2>{0.675522447f, 0.93140918f},
-std::array<float,2>{0.0258702431f, 0.14365226f},
-std::array<float,2>{0.474429429f, 0.723181844f},
-std::array<float,2>{0.908165455f, 0.365262926f},
-std::array<float,2>{0.551884115f, 0.664996922f},
-std::array<float,2>{0.183247969f, 0.271079272f},
-std::array<float,2>{0.304531723f, 0.949004114f},
-std::array<float,2>{0.82019037f, 0.237084195f},
-std::array<float,2>{0.960945427f, 0.788081169f},
-std::array<float,2>{0.413271397f, 0.0555391572f},
-std::array<float,2>{0.109293327f, 0.525620043f},
-std::array<float,2>{0.726288676f, 0.497112811f},
-std::array<float,2>{0.883270323f, 0.702704251f},
-std::array<float,2>{0.448194712f, 0.342672855f},
-std::array<float,2>{0.0393232517f, 0.898710489f},
-std::array<float,2>{0.633976638f, 0.158299729f},
-std::array<float,2>{0.572339296f, 0.82168144f},
-std::array<float,2>{0.216167822f, 0.096535027f},
-std::array<float,2>{0.357575804f, 0.615684152f},
-std::array<float,2>{0.754644454f, 0.429225892f},
-std::array<float,2>{0.693249464f, 0.54771018f},
-std::array<float,2>{0.0716311112f, 0.44008553f},
-std::array<float,2>{0.393195659f, 0.770027041f},
-std::array<float,2>{0.998176515f, 0.0288580935f},
-std::array<float,2>{0.853227139f, 0.997144878f},
-std::array<float,2>{0.271405607f, 0.203635111f},
-std::array<float,2>{0.153902769f, 0.635756195f},
-std::array<float,2>{0.514969945f, 0.299254715f},
-std::array<float,2>{0.763301194f, 0.73038286f},
-std::array<float,2>{0.345018595f, 0.374619693f},
-std::array<float,2>{0.207636222f, 0.924847901f},
-std::array<float,2>{0.563993573f, 0.149504289f},
-std::array<float,2>{0.627960801f, 0.862852335f},
-std::array<float,2>{0.0370075107f, 0.0730135068f},
-std::array<float,2>{0.444896162f, 0.569823384f},
-std::array<float,2>{0.875423193f, 0.403989911f},
-std::array<float,2>{0.506239772f, 0.52183038f},
-std::array<float,2>{0.146224007f, 0.491378427f},
-std::array<float,2>{0.278920561f, 0.793071091f},
-std::array<float,2>{0.847933948f, 0.0501109175f},
-std::array<float,2>{0.98622334f, 0.945013165f},
-std::array<float,2>{0.400109589f, 0.246133775f},
-std::array<float,2>{0.069905974f, 0.66202879f},
-std::array<float,2>{0.697060585f, 0.280003995f},
-std::array<float,2>{0.921096206f, 0.619161785f},
-std::array<float,2>{0.478784651f, 0.436691314f},
-std::array<float,2>{0.0178811792f, 0.816568613f},
-std::array<float,2>{0.686017692f, 0.104899272f},
-std::array<float,2>{0.597858787f, 0.896131158f},
-std::array<float,2>{0.237315133f, 0.168065175f},
-std::array<float,2>{0.313836217f, 0.694648623f},
-std::array<float,2>{0.789302647f, 0.33507517f},
-std::array<float,2>{0.733935416f, 0.631063044f},
-std::array<float,2>{0.101065479f, 0.307290256f},
-std::array<float,2>{0.417189658f, 0.99173528f},
-std::array<float,2>{0.955651999f, 0.217822015f},
-std::array<float,2>{0.827984273f, 0.77704823f},
-std::array<float,2>{0.309339374f, 0.0161927957f},
-std::array<float,2>{0.179500461f, 0.560454726f},
-std::array<float,2>{0.557074845f, 0.447778136f},
-std::array<float,2>{0.872307062f, 0.546478152f},
-std::array<float,2>{0.253530204f, 0.458702147f},
-std::array<float,2>{0.138227582f, 0.761511683f},
-std::array<float,2>{0.524869978f, 0.00807313807f},
-std::array<float,2>{0.706280708f, 0.973317564f},
-std::array<float,2>{0.0886883363f, 0.198472589f},
-std::array<float,2>{0.382509142f, 0.642359018f},
-std::array<float,2>{0.970973313f, 0.291381478f},
-std::array<float,2>{0.593238235f, 0.712695837f},
-std::array<float,2>{0.191260159f, 0.323047072f},
-std::array<float,2>{0.3684192f, 0.875279844f},
-std::array<float,2>{0.779512584f, 0.183079407f},
-std::array<float,2>{0.903456032f, 0.841359735f},
-std::array<float,2>{0.460537851f, 0.111662939f},
-std::array<float,2>{0.0520454235f, 0.604531169f},
-std::array<float,2>{0.654432416f, 0.409902483f},
-std::array<float,2>{0.94037807f, 0.683615267f},
-std::array<float,2>{0.430794924f, 0.265336394f},
-std::array<float,2>{0.109676123f, 0.964996994f},
-std::array<float,2>{0.743987143f, 0.234095767f},
-std::array<float,2>{0.536440313f, 0.812389851f},
-std::array<float,2>{0.160362214f, 0.0348945931f},
-std::array<float,2>{0.28355509f, 0.513555467f},
-std::array<float,2>{0.837497175f, 0.480631948f},
-std::array<float,2>{0.663569093f, 0.592182457f},
-std::array<float,2>{0.00903988536f, 0.382808417f},
-std::array<float,2>{0.486137867f, 0.848340869f},
-std::array<float,2>{0.935004294f, 0.0816105455f},
-std::array<float,2>{0.80534023f, 0.906894565f},
-std::array<float,2>{0.331021786f, 0.128448218f},
-std::array<float,2>{0.230302319f, 0.747298837f},
-std::array<float,2>{0.622591138f, 0.345794916f},
-std::array<float,2>{0.84467113f, 0.709756494f},
-std::array<float,2>{0.277309895f, 0.314187407f},
-std::array<float,2>{0.143256888f, 0.883011103f},
-std::array<float,2>{0.502738118f, 0.174138516f},
-std::array<float,2>{0.699459314f, 0.831213653f},
-std::array<float,2>{0.0626038313f, 0.11744155f},
-std::array<float,2>{0.403374761f, 0.594062328f},
-std::array<float,2>{0.991665006f, 0.42008099f},
-std::array<float,2>{0.56802541f, 0.538868368f},
-std::array<float,2>{0.204002634f, 0.468412876f},
-std::array<float,2>{0.350403249f, 0.755657911f},
-std::array<float,2>{0.7581411f, 0.00169631105f},
-std::array<float,2>{0.882329941f, 0.978564918f},
-std::array<float,2>{0.44126001f, 0.191531152f},
-std::array<float,2>{0.0324256755f, 0.654823899f},
-std::array<float,2>{0.632241428f, 0.28166011f},
-std::array<float,2>{0.957404554f, 0.581454515f},
-std::array<float,2>{0.420055717f, 0.384761393f},
-std::array<float,2>{0.0939918011f, 0.858362734f},
-std::array<float,2>{0.72774303f, 0.0888089538f},
-std::array<float,2>{0.561332345f, 0.915477276f},
-std::array<float,2>{0.175642639f, 0.139840722f},
-std::array<float,2>{0.306261688f, 0.738600135f},
-std::array<float,2>{0.822019041f, 0.355646491f},
-std::array<float,2>{0.68078196f, 0.673566163f},
-std::array<float,2>{0.0222686362f, 0.252026051f},
-std::array<float,2>{0.481569618f, 0.95620811f},
-std::array<float,2>{0.915148914f, 0.225410447f},
-std::array<float,2>{0.793106079f, 0.803118289f},
-std::array<float,2>{0.317766726f, 0.0431052186f},
-std::array<float,2>{0.239812851f, 0.500345826f},
-std::array<float,2>{0.596247554f, 0.469022542f},
-std::array<float,2>{0.776931882f, 0.529071808f},
-std::array<float,2>{0.371194661f, 0.494552433f},
-std::array<float,2>{0.192646056f, 0.782895148f},
-std::array<float,2>{0.587778032f, 0.0599627644f},
-std::array<float,2>{0.652168274f, 0.952242613f},
-std::array<float,2>{0.0472442843f, 0.239490271f},
-std::array<float,2>{0.454876393f, 0.670427442f},
-std::array<float,2>{0.898640811f, 0.269105762f},
-std::array<float,2>{0.530106306f, 0.721183121f},
-std::array<float,2>{0.13577944f, 0.359501243f},
-std::array<float,2>{0.255758435f, 0.933734894f},
-std::array<float,2>{0.867347658f, 0.146138504f},
-std::array<float,2>{0.975771427f, 0.873045504f},
-std::array<float,2>{0.376103044f, 0.0646106303f},
-std::array<float,2>{0.093375437f, 0.57612294f},
-std::array<float,2>{0.708588421f, 0.391419113f},
-std::array<float,2>{0.930302739f, 0.637698412f},
-std::array<float,2>{0.49118346f, 0.30085969f},
-std::array<float,2>{0.0134695377f, 0.994531512f},
-std::array<float,2>{0.658882976f, 0.210872501f},
-std::array<float,2>{0.61822021f, 0.768832803f},
-std::array<float,2>{0.234152153f, 0.027118668f},
-std::array<float,2>{0.335455954f, 0.554071486f},
-std::array<float,2>{0.812421143f, 0.443469286f},
-std::array<float,2>{0.749144793f, 0.61134845f},
-std::array<float,2>{0.115494326f, 0.425020814f},
-std::array<float,2>{0.437293738f, 0.824810386f},
-std::array<float,2>{0.943960667f, 0.0992011353f},
-std::array<float,2>{0.84359026f, 0.905040681f},
-std::array<float,2>{0.285665452f, 0.161700413f},
-std::array<float,2>{0.156351209f, 0.697235703f},
-std::array<float,2>{0.531674683f, 0.338681698f},
-std::array<float,2>{0.800937474f, 0.658062637f},
-std::array<float,2>{0.338514984f, 0.27390939f},
-std::array<float,2>{0.221173704f, 0.940090418f},
-std::array<float,2>{0.610826194f, 0.245819956f},
-std::array<float,2>{0.668487847f, 0.789747238f},
-std::array<float,2>{0.00180828152f, 0.0519160666f},
-std::array<float,2>{0.496690452f, 0.518560588f},
-std::array<float,2>{0.925494254f, 0.488081723f},
-std::array<float,2>{0.540175438f, 0.566218674f},
-std::array<float,2>{0.167328298f, 0.400015742f},
-std::array<float,2>{0.290703923f, 0.86484921f},
-std::array<float,2>{0.83305347f, 0.0767384842f},
-std::array<float,2>{0.951561749f, 0.929674804f},
-std::array<float,2>{0.425579607f, 0.152795792f},
-std::array<float,2>{0.124416023f, 0.734130502f},
-std::array<float,2>{0.7369712f, 0.369381517f},
-std::array<float,2>{0.890886426f, 0.55620718f},
-std::array<float,2>{0.467838556f, 0.451161087f},
-std::array<float,2>{0.0609894507f, 0.780473053f},
-std::array<float,2>{0.642736495f, 0.023153903f},
-std::array<float,2>{0.57831496f, 0.988136172f},
-std::array<float,2>{0.199627876f, 0.213567346f},
-std::array<float,2>{0.364287198f, 0.625194192f},
-std::array<float,2>{0.771620512f, 0.312027901f},
-std::array<float,2>{0.716695547f, 0.68878293f},
-std::array<float,2>{0.0814823508f, 0.330046088f},
-std::array<float,2>{0.385259867f, 0.893745959f},
-std::array<float,2>{0.978359103f, 0.166263416f},
-std::array<float,2>{0.866292f, 0.816404641f},
-std::array<float,2>{0.260126233f, 0.107481435f},
-std::array<float,2>{0.12646082f, 0.623793304f},
-std::array<float,2>{0.518898368f, 0.432608604f},
-std::array<float,2>{0.814021349f, 0.607292354f},
-std::array<float,2>{0.298957378f, 0.41147697f},
-std::array<float,2>{0.185570613f, 0.839526832f},
-std::array<float,2>{0.550508678f, 0.11641518f},
-std::array<float,2>{0.722101092f, 0.87923497f},
-std::array<float,2>{0.104276545f, 0.183841497f},
-std::array<float,2>{0.408020079f, 0.715066433f},
-std::array<float,2>{0.965611041f, 0.3277933f},
-std::array<float,2>{0.602924466f, 0.645074368f},
-std::array<float,2>{0.242779374f, 0.294034451f},
-std::array<float,2>{0.32034117f, 0.968919218f},
-std::array<float,2>{0.784474492f, 0.20196262f},
-std::array<float,2>{0.913129032f, 0.763529241f},
-std::array<float,2>{0.470739186f, 0.014374705f},
-std::array<float,2>{0.0311975107f, 0.541286707f},
-std::array<float,2>{0.67687875f, 0.454122871f},
-std::array<float,2>{0.99565649f, 0.744542539f},
-std::array<float,2>{0.395268142f, 0.349175572f},
-std::array<float,2>{0.0746357515f, 0.913071692f},
-std::array<float,2>{0.690973759f, 0.129095703f},
-std::array<float,2>{0.508490145f, 0.847442329f},
-std::array<float,2>{0.148709133f, 0.0829270706f},
-std::array<float,2>{0.268330514f, 0.586371958f},
-std::array<float,2>{0.855558038f, 0.376717806f},
-std::array<float,2>{0.639022052f, 0.508333027f},
-std::array<float,2>{0.0449312404f, 0.478878677f},
-std::array<float,2>{0.449438363f, 0.806067705f},
-std::array<float,2>{0.888946414f, 0.0372164026f},
-std::array<float,2>{0.75128299f, 0.96102792f},
-std::array<float,2>{0.352079362f, 0.228090703f},
-std::array<float,2>{0.214304239f, 0.68171072f},
-std::array<float,2>{0.576657414f, 0.259104282f},
-std::array<float,2>{0.845964849f, 0.655205965f},
-std::array<float,2>{0.274180144f, 0.281333655f},
-std::array<float,2>{0.140662909f, 0.978826106f},
-std::array<float,2>{0.50150913f, 0.191849709f},
-std::array<float,2>{0.702644467f, 0.7554878f},
-std::array<float,2>{0.0658707023f, 0.00186372222f},
-std::array<float,2>{0.40611282f, 0.538694799f},
-std::array<float,2>{0.989384055f, 0.468744159f},
-std::array<float,2>{0.569701433f, 0.593802631f},
-std::array<float,2>{0.20699735f, 0.420288652f},
-std::array<float,2>{0.349210858f, 0.83136791f},
-std::array<float,2>{0.759961724f, 0.117309332f},
-std::array<float,2>{0.880544841f, 0.883086145f},
-std::array<float,2>{0.438243568f, 0.173875302f},
-std::array<float,2>{0.033693213f, 0.709595323f},
-std::array<float,2>{0.628913701f, 0.314358234f},
-std::array<float,2>{0.960633576f, 0.500198424f},
-std::array<float,2>{0.418182909f, 0.468902022f},
-std::array<float,2>{0.0961764008f, 0.802849412f},
-std::array<float,2>{0.729504406f, 0.0432806239f},
-std::array<float,2>{0.55939281f, 0.956370175f},
-std::array<float,2>{0.171954006f, 0.225298032f},
-std::array<float,2>{0.306837618f, 0.673623443f},
-std::array<float,2>{0.82314086f, 0.252217293f},
-std::array<float,2>{0.682294726f, 0.738381624f},
-std::array<float,2>{0.0211979002f, 0.355852574f},
-std::array<float,2>{0.482866317f, 0.915125251f},
-std::array<float,2>{0.917677045f, 0.140021369f},
-std::array<float,2>{0.795979381f, 0.858060837f},
-std::array<float,2>{0.318756163f, 0.088619262f},
-std::array<float,2>{0.240993619f, 0.581161082f},
-std::array<float,2>{0.594635725f, 0.384398937f},
-std::array<float,2>{0.77532953f, 0.575850129f},
-std::array<float,2>{0.373273462f, 0.391274691f},
-std::array<float,2>{0.194988802f, 0.872615397f},
-std::array<float,2>{0.588401973f, 0.0648234263f},
-std::array<float,2>{0.650302052f, 0.933858097f},
-std::array<float,2>{0.0500193685f, 0.146377623f},
-std::array<float,2>{0.455595791f, 0.720830858f},
-std::array<float,2>{0.900921643f, 0.359710753f},
-std::array<float,2>{0.527592182f, 0.670803964f},
-std::array<float,2>{0.133871496f, 0.269472003f},
-std::array<float,2>{0.256715804f, 0.952575266f},
-std::array<float,2>{0.871002614f, 0.239723101f},
-std::array<float,2>{0.972795844f, 0.78301847f},
-std::array<float,2>{0.377281874f, 0.0595978722f},
-std::array<float,2>{0.0914127305f, 0.529042125f},
-std::array<float,2>{0.710709989f, 0.494328141f},
-std::array<float,2>{0.931814492f, 0.696839809f},
-std::array<float,2>{0.489581496f, 0.338549823f},
-std::array<float,2>{0.0146015389f, 0.904918492f},
-std::array<float,2>{0.657619953f, 0.162f},
-std::array<float,2>{0.620119452f, 0.825167477f},
-std::array<float,2>{0.232323095f, 0.0994340926f},
-std::array<float,2>{0.33224079f, 0.611699879f},
-std::array<float,2>{0.809425473f, 0.425083041f},
-std::array<float,2>{0.746583045f, 0.553852081f},
-std::array<float,2>{0.115126461f, 0.443642169f},
-std::array<float,2>{0.4343521f, 0.768715858f},
-std::array<float,2>{0.942284524f, 0.0268775057f},
-std::array<float,2>{0.840145171f, 0.994318247f},
-std::array<float,2>{0.287116349f, 0.210586846f},
-std::array<float,2>{0.160012677f, 0.637974322f},
-std::array<float,2>{0.534738123f, 0.301051944f},
-std::array<float,2>{0.804513216f, 0.734331012f},
-std::array<float,2>{0.336508274f, 0.369591504f},
-std::array<float,2>{0.218895406f, 0.929402232f},
-std::array<float,2>{0.611521304f, 0.1524795f},
-std::array<float,2>{0.670315862f, 0.865050554f},
-std::array<float,2>{0.00203387206f, 0.0771400332f},
-std::array<float,2>{0.498248965f, 0.566109478f},
-std::array<float,2>{0.92334187f, 0.400335193f},
-std::array<float,2>{0.541412592f, 0.518932402f},
-std::array<float,2>{0.16430147f, 0.487838596f},
-std::array<float,2>{0.292203337f, 0.789912522f},
-std::array<float,2>{0.835164368f, 0.0520414859f},
-std::array<float,2>{0.949497461f, 0.940232217f},
-std::array<float,2>{0.423506945f, 0.245963648f},
-std::array<float,2>{0.121610805f, 0.657949328f},
-std::array<float,2>{0.735155225f, 0.27359125f},
-std::array<float,2>{0.894057214f, 0.623748958f},
-std::array<float,2>{0.466319591f, 0.432317197f},
-std::array<float,2>{0.0599377975f, 0.816121936f},
-std::array<float,2>{0.641745865f, 0.107698888f},
-std::array<float,2>{0.581773281f, 0.893929541f},
-std::array<float,2>{0.201702744f, 0.166166469f},
-std::array<float,2>{0.366119146f, 0.688574731f},
-std::array<float,2>{0.771323323f, 0.329726189f},
-std::array<float,2>{0.717350662f, 0.625391781f},
-std::array<float,2>{0.079702206f, 0.312454462f},
-std::array<float,2>{0.384382874f, 0.987966955f},
-std::array<float,2>{0.97987324f, 0.213817865f},
-std::array<float,2>{0.863718092f, 0.780640543f},
-std::array<float,2>{0.259253442f, 0.0232553761f},
-std::array<float,2>{0.128887698f, 0.556535363f},
-std::array<float,2>{0.51596874f, 0.450773716f},
-std::array<float,2>{0.815957129f, 0.541098177f},
-std::array<float,2>{0.297975153f, 0.454551518f},
-std::array<float,2>{0.184268102f, 0.763312936f},
-std::array<float,2>{0.547144175f, 0.0144251138f},
-std::array<float,2>{0.719828486f, 0.969126463f},
-std::array<float,2>{0.103066154f, 0.201835692f},
-std::array<float,2>{0.410069078f, 0.645307541f},
-std::array<float,2>{0.96752584f, 0.294362038f},
-std::array<float,2>{0.603935003f, 0.715224504f},
-std::array<float,2>{0.244254708f, 0.328115016f},
-std::array<float,2>{0.322931349f, 0.879009485f},
-std::array<float,2>{0.782521725f, 0.183801949f},
-std::array<float,2>{0.911971927f, 0.83971262f},
-std::array<float,2>{0.469415367f, 0.116699055f},
-std::array<float,2>{0.02922884f, 0.607105255f},
-std::array<float,2>{0.677929819f, 0.411260068f},
-std::array<float,2>{0.992493689f, 0.682066321f},
-std::array<float,2>{0.396901309f, 0.258922994f},
-std::array<float,2>{0.0762297735f, 0.961240113f},
-std::array<float,2>{0.688186526f, 0.22836861f},
-std::array<float,2>{0.511294484f, 0.805684209f},
-std::array<float,2>{0.151526406f, 0.0373887531f},
-std::array<float,2>{0.267413497f, 0.508627713f},
-std::array<float,2>{0.857947588f, 0.478729308f},
-std::array<float,2>{0.637005568f, 0.585977137f},
-std::array<float,2>{0.0431544632f, 0.376640797f},
-std::array<float,2>{0.452103227f, 0.847296774f},
-std::array<float,2>{0.88771522f, 0.0825446174f},
-std::array<float,2>{0.753360152f, 0.912768543f},
-std::array<float,2>{0.353630602f, 0.129196972f},
-std::array<float,2>{0.211131334f, 0.74434793f},
-std::array<float,2>{0.575492382f, 0.349393994f},
-std::array<float,2>{0.829389989f, 0.706894755f},
-std::array<float,2>{0.293064684f, 0.317900717f},
-std::array<float,2>{0.168488666f, 0.888418674f},
-std::array<float,2>{0.545865357f, 0.178309277f},
-std::array<float,2>{0.741568983f, 0.835887611f},
-std::array<float,2>{0.118822955f, 0.12262629f},
-std::array<float,2>{0.428567052f, 0.598674655f},
-std::array<float,2>{0.948928654f, 0.416486472f},
-std::array<float,2>{0.615296721f, 0.532232523f},
-std::array<float,2>{0.223062441f, 0.463356137f},
-std::array<float,2>{0.342588514f, 0.750725925f},
-std::array<float,2>{0.80029434f, 0.00538882101f},
-std::array<float,2>{0.926852524f, 0.983893335f},
-std::array<float,2>{0.492886662f, 0.190687597f},
-std::array<float,2>{0.00655124942f, 0.651078224f},
-std::array<float,2>{0.666894853f, 0.287051409f},
-std::array<float,2>{0.980489612f, 0.583959997f},
-std::array<float,2>{0.388892263f, 0.38805294f},
-std::array<float,2>{0.0837981924f, 0.853794932f},
-std::array<float,2>{0.711098492f, 0.0910677016f},
-std::array<float,2>{0.520502746f, 0.921850979f},
-std::array<float,2>{0.130775973f, 0.136076182f},
-std::array<float,2>{0.262193292f, 0.736065269f},
-std::array<float,2>{0.859519958f, 0.352759212f},
-std::array<float,2>{0.646921277f, 0.676210701f},
-std::array<float,2>{0.0576214753f, 0.255433351f},
-std::array<float,2>{0.464046389f, 0.959241986f},
-std::array<float,2>{0.896348536f, 0.222617105f},
-std::array<float,2>{0.767794669f, 0.798038542f},
-std::array<float,2>{0.363215655f, 0.0393695533f},
-std::array<float,2>{0.197197467f, 0.507566452f},
-std::array<float,2>{0.583907068f, 0.475263864f},
-std::array<float,2>{0.785314679f, 0.52577728f},
-std::array<float,2>{0.327355742f, 0.497450948f},
-std::array<float,2>{0.248488143f, 0.787795365f},
-std::array<float,2>{0.607425153f, 0.0553960986f},
-std::array<float,2>{0.672861516f, 0.948788345f},
-std::array<float,2>{0.0235872082f, 0.236914501f},
-std::array<float,2>{0.475513101f, 0.664665163f},
-std::array<float,2>{0.908440053f, 0.271301538f},
-std::array<float,2>{0.553048849f, 0.723595798f},
-std::array<float,2>{0.181431383f, 0.365718424f},
-std::array<float,2>{0.301466078f, 0.931242764f},
-std::array<float,2>{0.817746639f, 0.143836886f},
-std::array<float,2>{0.964154184f, 0.867557347f},
-std::array<float,2>{0.412010759f, 0.0696147978f},
-std::array<float,2>{0.105943203f, 0.573093891f},
-std::array<float,2>{0.723901689f, 0.394952297f},
-std::array<float,2>{0.886493504f, 0.63603425f},
-std::array<float,2>{0.44568938f, 0.298871398f},
-std::array<float,2>{0.0419894867f, 0.997541726f},
-std::array<float,2>{0.636452675f, 0.204041496f},
-std::array<float,2>{0.57135421f, 0.770404041f},
-std::array<float,2>{0.21873045f, 0.0292388592f},
-std::array<float,2>{0.355544358f, 0.547501981f},
-std::array<float,2>{0.757128417f, 0.440308541f},
-std::array<float,2>{0.694264531f, 0.615443051f},
-std::array<float,2>{0.0732574314f, 0.429622501f},
-std::array<float,2>{0.391846746f, 0.821319938f},
-std::array<float,2>{0.997543752f, 0.0962546095f},
-std::array<float,2>{0.854480088f, 0.898612916f},
-std::array<float,2>{0.272964954f, 0.158571154f},
-std::array<float,2>{0.154933259f, 0.702954054f},
-std::array<float,2>{0.51284039f, 0.342528015f},
-std::array<float,2>{0.764677227f, 0.661846519f},
-std::array<float,2>{0.346328408f, 0.280182511f},
-std::array<float,2>{0.209819227f, 0.94507122f},
-std::array<float,2>{0.56462276f, 0.246572584f},
-std::array<float,2>{0.62632817f, 0.793234468f},
-std::array<float,2>{0.0380252749f, 0.049999617f},
-std::array<float,2>{0.442491233f, 0.52166903f},
-std::array<float,2>{0.878629804f, 0.491472095f},
-std::array<float,2>{0.504207015f, 0.569493711f},
-std::array<float,2>{0.148374707f, 0.404282451f},
-std::array<float,2>{0.279380322f, 0.863086164f},
-std::array<float,2>{0.851276159f, 0.0729059502f},
-std::array<float,2>{0.987363756f, 0.925142586f},
-std::array<float,2>{0.402082086f, 0.149727687f},
-std::array<float,2>{0.0669902042f, 0.730104804f},
-std::array<float,2>{0.699202418f, 0.374996781f},
-std::array<float,2>{0.919230878f, 0.560250878f},
-std::array<float,2>{0.476618528f, 0.448117495f},
-std::array<float,2>{0.0170966536f, 0.777335167f},
-std::array<float,2>{0.684138358f, 0.0164519697f},
-std::array<float,2>{0.599966586f, 0.991954863f},
-std::array<float,2>{0.234822661f, 0.218076184f},
-std::array<float,2>{0.314841688f, 0.631335258f},
-std::array<float,2>{0.792125344f, 0.30739519f},
-std::array<float,2>{0.731569111f, 0.694337428f},
-std::array<float,2>{0.0984514058f, 0.335212976f},
-std::array<float,2>{0.415500313f, 0.896351695f},
-std::array<float,2>{0.953367233f, 0.168351114f},
-std::array<float,2>{0.824364066f, 0.816757679f},
-std::array<float,2>{0.31120798f, 0.104593404f},
-std::array<float,2>{0.176586613f, 0.619585037f},
-std::array<float,2>{0.555972278f, 0.436885506f},
-std::array<float,2>{0.874199986f, 0.604806006f},
-std::array<float,2>{0.250789195f, 0.409946322f},
-std::array<float,2>{0.140584543f, 0.841715336f},
-std::array<float,2>{0.525847614f, 0.11134512f},
-std::array<float,2>{0.7035712f, 0.875108302f},
-std::array<float,2>{0.0861198902f, 0.182712764f},
-std::array<float,2>{0.37962389f, 0.712442696f},
-std::array<float,2>{0.969348431f, 0.32291159f},
-std::array<float,2>{0.590336919f, 0.642132044f},
-std::array<float,2>{0.189107209f, 0.291064948f},
-std::array<float,2>{0.370980829f, 0.973562181f},
-std::array<float,2>{0.779129207f, 0.198570982f},
-std::array<float,2>{0.905737281f, 0.761348844f},
-std::array<float,2>{0.457849354f, 0.00803643744f},
-std::array<float,2>{0.0542034358f, 0.546701908f},
-std::array<float,2>{0.653949916f, 0.458974481f},
-std::array<float,2>{0.938993514f, 0.747455537f},
-std::array<float,2>{0.432251632f, 0.346132785f},
-std::array<float,2>{0.112942837f, 0.907071531f},
-std::array<float,2>{0.745636165f, 0.128719717f},
-std::array<float,2>{0.538834751f, 0.848471045f},
-std::array<float,2>{0.163154975f, 0.0819760188f},
-std::array<float,2>{0.28206116f, 0.59186089f},
-std::array<float,2>{0.838349223f, 0.38243556f},
-std::array<float,2>{0.661024451f, 0.513345361f},
-std::array<float,2>{0.00985193904f, 0.480938047f},
-std::array<float,2>{0.487582326f, 0.812246084f},
-std::array<float,2>{0.935584366f, 0.0350966677f},
-std::array<float,2>{0.807493627f, 0.965248704f},
-std::array<float,2>{0.328965873f, 0.234341964f},
-std::array<float,2>{0.227480844f, 0.683974385f},
-std::array<float,2>{0.623217583f, 0.265500933f},
-std::array<float,2>{0.820824325f, 0.675278783f},
-std::array<float,2>{0.304956138f, 0.250174075f},
-std::array<float,2>{0.174080983f, 0.953131795f},
-std::array<float,2>{0.562433302f, 0.224091142f},
-std::array<float,2>{0.72705549f, 0.801529646f},
-std::array<float,2>{0.0954378396f, 0.0456832089f},
-std::array<float,2>{0.420918345f, 0.503339767f},
-std::array<float,2>{0.958948255f, 0.471432537f},
-std::array<float,2>{0.596774936f, 0.578894556f},
-std::array<float,2>{0.238645837f, 0.38556239f},
-std::array<float,2>{0.317212194f, 0.856824338f},
-std::array<float,2>{0.794493496f, 0.0865023062f},
-std::array<float,2>{0.915002406f, 0.917743623f},
-std::array<float,2>{0.480959475f, 0.137683213f},
-std::array<float,2>{0.0227881577f, 0.741901457f},
-std::array<float,2>{0.68047744f, 0.35797444f},
-std::array<float,2>{0.990648866f, 0.536040664f},
-std::array<float,2>{0.402706772f, 0.465904206f},
-std::array<float,2>{0.063539058f, 0.757064521f},
-std::array<float,2>{0.700973392f, 0.00351845007f},
-std::array<float,2>{0.503142118f, 0.977389097f},
-std::array<float,2>{0.143660143f, 0.193462417f},
-std::array<float,2>{0.275958687f, 0.652491689f},
-std::array<float,2>{0.845065773f, 0.285045773f},
-std::array<float,2>{0.631748617f, 0.707904637f},
-std::array<float,2>{0.0316878334f, 0.31608668f},
-std::array<float,2>{0.439579844f, 0.886499405f},
-std::array<float,2>{0.881473064f, 0.171956673f},
-std::array<float,2>{0.759243071f, 0.829414427f},
-std::array<float,2>{0.351372421f, 0.120528385f},
-std::array<float,2>{0.20483844f, 0.59721303f},
-std::array<float,2>{0.567058384f, 0.419115216f},
-std::array<float,2>{0.811467826f, 0.61007005f},
-std::array<float,2>{0.334378123f, 0.42293784f},
-std::array<float,2>{0.233361915f, 0.826542318f},
-std::array<float,2>{0.617625356f, 0.101286061f},
-std::array<float,2>{0.659774542f, 0.904139459f},
-std::array<float,2>{0.0118409581f, 0.16381754f},
-std::array<float,2>{0.49154678f, 0.699079454f},
-std::array<float,2>{0.930798292f, 0.336221427f},
-std::array<float,2>{0.533166945f, 0.640446126f},
-std::array<float,2>{0.157724142f, 0.303704351f},
-std::array<float,2>{0.286456823f, 0.99335736f},
-std::array<float,2>{0.842384398f, 0.208052188f},
-std::array<float,2>{0.944768965f, 0.765711248f},
-std::array<float,2>{0.436171144f, 0.0243494269f},
-std::array<float,2>{0.116539828f, 0.55192405f},
-std::array<float,2>{0.749016821f, 0.44243443f},
-std::array<float,2>{0.899950922f, 0.718792915f},
-std::array<float,2>{0.453924209f, 0.361574769f},
-std::array<float,2>{0.0482680164f, 0.935774863f},
-std::array<float,2>{0.650499642f, 0.148101002f},
-std::array<float,2>{0.586570978f, 0.873442531f},
-std::array<float,2>{0.191459343f, 0.0643755272f},
-std::array<float,2>{0.372229099f, 0.576905966f},
-std::array<float,2>{0.775966287f, 0.394067138f},
-std::array<float,2>{0.707184792f, 0.530180812f},
-std::array<float,2>{0.0920311809f, 0.492431521f},
-std::array<float,2>{0.375276446f, 0.784162462f},
-std::array<float,2>{0.97493124f, 0.0607491694f},
-std::array<float,2>{0.868220568f, 0.950753212f},
-std::array<float,2>{0.254060894f, 0.241507739f},
-std::array<float,2>{0.135395363f, 0.668112636f},
-std::array<float,2>{0.530412018f, 0.265931547f},
-std::array<float,2>{0.773376644f, 0.690026104f},
-std::array<float,2>{0.363714606f, 0.330420792f},
-std::array<float,2>{0.200955078f, 0.890735269f},
-std::array<float,2>{0.579190135f, 0.164938241f},
-std::array<float,2>{0.643586755f, 0.812709808f},
-std::array<float,2>{0.0622925162f, 0.106676608f},
-std::array<float,2>{0.467337698f, 0.622322381f},
-std::array<float,2>{0.892013729f, 0.431044459f},
-std::array<float,2>{0.518377006f, 0.556783557f},
-std::array<float,2>{0.125084311f, 0.452998698f},
-std::array<float,2>{0.261478007f, 0.777724206f},
-std::array<float,2>{0.866052568f, 0.0202510618f},
-std::array<float,2>{0.976620793f, 0.984853566f},
-std::array<float,2>{0.385804653f, 0.211731717f},
-std::array<float,2>{0.0801606029f, 0.628440499f},
-std::array<float,2>{0.715142369f, 0.310274124f},
-std::array<float,2>{0.924522758f, 0.563890398f},
-std::array<float,2>{0.497411996f, 0.401618272f},
-std::array<float,2>{0.000675054267f, 0.866633534f},
-std::array<float,2>{0.669077635f, 0.0756030306f},
-std::array<float,2>{0.609811485f, 0.92730391f},
-std::array<float,2>{0.222467855f, 0.155563548f},
-std::array<float,2>{0.339810461f, 0.732411385f},
-std::array<float,2>{0.801783442f, 0.368504226f},
-std::array<float,2>{0.737340093f, 0.659769177f},
-std::array<float,2>{0.123959132f, 0.275935352f},
-std::array<float,2>{0.424102515f, 0.939180732f},
-std::array<float,2>{0.952896118f, 0.243218556f},
-std::array<float,2>{0.832093358f, 0.791269958f},
-std::array<float,2>{0.289357185f, 0.0536793694f},
-std::array<float,2>{0.166236207f, 0.516377509f},
-std::array<float,2>{0.539737046f, 0.485984415f},
-std::array<float,2>{0.857032478f, 0.511466026f},
-std::array<float,2>{0.268924832f, 0.47850588f},
-std::array<float,2>{0.149548158f, 0.806963682f},
-std::array<float,2>{0.509595275f, 0.03678919f},
-std::array<float,2>{0.689727008f, 0.963578999f},
-std::array<float,2>{0.0757034346f, 0.228713945f},
-std::array<float,2>{0.395815581f, 0.681091368f},
-std::array<float,2>{0.994251728f, 0.260241866f},
-std::array<float,2>{0.577859342f, 0.743061364f},
-std::array<float,2>{0.213789463f, 0.350193411f},
-std::array<float,2>{0.353080958f, 0.911051035f},
-std::array<float,2>{0.750673234f, 0.13122119f},
-std::array<float,2>{0.890198946f, 0.84486109f},
-std::array<float,2>{0.450392485f, 0.0858070478f},
-std::array<float,2>{0.0463333204f, 0.588831723f},
-std::array<float,2>{0.640056372f, 0.377101332f},
-std::array<float,2>{0.966273546f, 0.646592677f},
-std::array<float,2>{0.407064408f, 0.295603573f},
-std::array<float,2>{0.105389245f, 0.971667528f},
-std::array<float,2>{0.720990241f, 0.200165972f},
-std::array<float,2>{0.549473166f, 0.764700174f},
-std::array<float,2>{0.187481254f, 0.0117679872f},
-std::array<float,2>{0.299831152f, 0.539823234f},
-std::array<float,2>{0.812570989f, 0.455501556f},
-std::array<float,2>{0.675943673f, 0.608456373f},
-std::array<float,2>{0.0299286246f, 0.412932098f},
-std::array<float,2>{0.472196043f, 0.836063564f},
-std::array<float,2>{0.912426293f, 0.114083931f},
-std::array<float,2>{0.783972502f, 0.882366478f},
-std::array<float,2>{0.321647972f, 0.186648667f},
-std::array<float,2>{0.243605956f, 0.717222989f},
-std::array<float,2>{0.602164626f, 0.32530272f},
-std::array<float,2>{0.8631863f, 0.737147927f},
-std::array<float,2>{0.263899803f, 0.354536086f},
-std::array<float,2>{0.130975083f, 0.918875396f},
-std::array<float,2>{0.523241878f, 0.13431333f},
-std::array<float,2>{0.714474082f, 0.852212727f},
-std::array<float,2>{0.0848901793f, 0.0920926705f},
-std::array<float,2>{0.387547463f, 0.585704982f},
-std::array<float,2>{0.984267473f, 0.389451563f},
-std::array<float,2>{0.585367322f, 0.505047262f},
-std::array<float,2>{0.19903481f, 0.473162681f},
-std::array<float,2>{0.360851854f, 0.800580144f},
-std::array<float,2>{0.767003596f, 0.041777242f},
-std::array<float,2>{0.89765662f, 0.958606303f},
-std::array<float,2>{0.462114841f, 0.220638141f},
-std::array<float,2>{0.0550280735f, 0.679388225f},
-std::array<float,2>{0.645956516f, 0.257753432f},
-std::array<float,2>{0.945914924f, 0.600527585f},
-std::array<float,2>{0.426049501f, 0.414644241f},
-std::array<float,2>{0.119203866f, 0.833341658f},
-std::array<float,2>{0.739375353f, 0.124492452f},
-std::array<float,2>{0.544230819f, 0.889649153f},
-std::array<float,2>{0.17041491f, 0.177691713f},
-std::array<float,2>{0.295378685f, 0.704379082f},
-std::array<float,2>{0.83027339f, 0.319373608f},
-std::array<float,2>{0.665407658f, 0.648753762f},
-std::array<float,2>{0.00400906149f, 0.288635492f},
-std::array<float,2>{0.495959401f, 0.980537236f},
-std::array<float,2>{0.928298473f, 0.188411295f},
-std::array<float,2>{0.797794044f, 0.752600253f},
-std::array<float,2>{0.341207951f, 0.00669027539f},
-std::array<float,2>{0.225473776f, 0.535079837f},
-std::array<float,2>{0.613928616f, 0.462604135f},
-std::array<float,2>{0.754979849f, 0.549736381f},
-std::array<float,2>{0.358820707f, 0.437818974f},
-std::array<float,2>{0.215211287f, 0.773273885f},
-std::array<float,2>{0.574136913f, 0.0298546758f},
-std::array<float,2>{0.632955432f, 0.99922806f},
-std::array<float,2>{0.0406362601f, 0.205301806f},
-std::array<float,2>{0.448503971f, 0.633041322f},
-std::array<float,2>{0.884742975f, 0.297250241f},
-std::array<float,2>{0.514592707f, 0.699379921f},
-std::array<float,2>{0.152396441f, 0.341701388f},
-std::array<float,2>{0.270266533f, 0.900926709f},
-std::array<float,2>{0.851927817f, 0.156572461f},
-std::array<float,2>{0.999554098f, 0.823833883f},
-std::array<float,2>{0.394131303f, 0.0938753635f},
-std::array<float,2>{0.070511654f, 0.61401087f},
-std::array<float,2>{0.691639662f, 0.426018834f},
-std::array<float,2>{0.907092988f, 0.666638255f},
-std::array<float,2>{0.472938716f, 0.271527916f},
-std::array<float,2>{0.027316533f, 0.946753323f},
-std::array<float,2>{0.674629629f, 0.234997854f},
-std::array<float,2>{0.60638684f, 0.785369456f},
-std::array<float,2>{0.246716544f, 0.0583585985f},
-std::array<float,2>{0.326122642f, 0.523666739f},
-std::array<float,2>{0.787501335f, 0.499325097f},
-std::array<float,2>{0.724707961f, 0.571406662f},
-std::array<float,2>{0.108138956f, 0.397793472f},
-std::array<float,2>{0.412791908f, 0.870726764f},
-std::array<float,2>{0.962658346f, 0.0671480671f},
-std::array<float,2>{0.818391383f, 0.933566928f},
-std::array<float,2>{0.303635776f, 0.140684187f},
-std::array<float,2>{0.181982473f, 0.725524664f},
-std::array<float,2>{0.551517904f, 0.363501638f},
-std::array<float,2>{0.790863216f, 0.629567206f},
-std::array<float,2>{0.312852532f, 0.304877728f},
-std::array<float,2>{0.23716341f, 0.989612103f},
-std::array<float,2>{0.598796487f, 0.214953095f},
-std::array<float,2>{0.687126756f, 0.773840606f},
-std::array<float,2>{0.0193348173f, 0.0186463278f},
-std::array<float,2>{0.480036438f, 0.560548782f},
-std::array<float,2>{0.920177579f, 0.445499629f},
-std::array<float,2>{0.558572471f, 0.618186533f},
-std::array<float,2>{0.178582877f, 0.435501695f},
-std::array<float,2>{0.310480863f, 0.819074214f},
-std::array<float,2>{0.826616406f, 0.101685926f},
-std::array<float,2>{0.956653893f, 0.896753788f},
-std::array<float,2>{0.416690767f, 0.170804188f},
-std::array<float,2>{0.0997791812f, 0.69318223f},
-std::array<float,2>{0.732563794f, 0.33378768f},
-std::array<float,2>{0.876775324f, 0.521134496f},
-std::array<float,2>{0.444060713f, 0.489405662f},
-std::array<float,2>{0.0354098082f, 0.796506405f},
-std::array<float,2>{0.627790749f, 0.0477670059f},
-std::array<float,2>{0.562912822f, 0.94297868f},
-std::array<float,2>{0.208379865f, 0.249768734f},
-std::array<float,2>{0.344342798f, 0.662748218f},
-std::array<float,2>{0.762087882f, 0.277799278f},
-std::array<float,2>{0.696256638f, 0.727671266f},
-std::array<float,2>{0.0686876774f, 0.371731877f},
-std::array<float,2>{0.399015546f, 0.922229469f},
-std::array<float,2>{0.985195875f, 0.151985183f},
-std::array<float,2>{0.849177361f, 0.860081971f},
-std::array<float,2>{0.277598649f, 0.0717029348f},
-std::array<float,2>{0.145087957f, 0.56813556f},
-std::array<float,2>{0.507787704f, 0.40614301f},
-std::array<float,2>{0.836618841f, 0.590751112f},
-std::array<float,2>{0.284411579f, 0.379168093f},
-std::array<float,2>{0.162041351f, 0.850099087f},
-std::array<float,2>{0.535533369f, 0.0794635639f},
-std::array<float,2>{0.742314875f, 0.909976006f},
-std::array<float,2>{0.110559709f, 0.126862973f},
-std::array<float,2>{0.429773539f, 0.748772264f},
-std::array<float,2>{0.940711081f, 0.344183475f},
-std::array<float,2>{0.621879756f, 0.686981559f},
-std::array<float,2>{0.229337171f, 0.262881726f},
-std::array<float,2>{0.331672251f, 0.96784693f},
-std::array<float,2>{0.805730939f, 0.231298581f},
-std::array<float,2>{0.933867514f, 0.809654772f},
-std::array<float,2>{0.484958917f, 0.0314260609f},
-std::array<float,2>{0.00831982959f, 0.5148049f},
-std::array<float,2>{0.663063467f, 0.482590705f},
-std::array<float,2>{0.972285271f, 0.713764131f},
-std::array<float,2>{0.381611437f, 0.321365982f},
-std::array<float,2>{0.0893669575f, 0.877472401f},
-std::array<float,2>{0.705303431f, 0.181542039f},
-std::array<float,2>{0.524311364f, 0.841977894f},
-std::array<float,2>{0.137166113f, 0.111319229f},
-std::array<float,2>{0.252823174f, 0.603143692f},
-std::array<float,2>{0.87203455f, 0.40817064f},
-std::array<float,2>{0.655906439f, 0.543228865f},
-std::array<float,2>{0.0516347848f, 0.460541815f},
-std::array<float,2>{0.459336013f, 0.758690238f},
-std::array<float,2>{0.902543068f, 0.0104090152f},
-std::array<float,2>{0.780723095f, 0.974903703f},
-std::array<float,2>{0.367687643f, 0.196308225f},
-std::array<float,2>{0.19038488f, 0.643060386f},
-std::array<float,2>{0.592043459f, 0.289922863f},
-std::array<float,2>{0.869871855f, 0.669906437f},
-std::array<float,2>{0.256894976f, 0.266862035f},
-std::array<float,2>{0.133713037f, 0.949982345f},
-std::array<float,2>{0.529292583f, 0.241191104f},
-std::array<float,2>{0.709153235f, 0.785126507f},
-std::array<float,2>{0.0904572755f, 0.0623603165f},
-std::array<float,2>{0.378575146f, 0.530517876f},
-std::array<float,2>{0.974420965f, 0.493945509f},
-std::array<float,2>{0.589081228f, 0.5775823f},
-std::array<float,2>{0.194328755f, 0.392836571f},
-std::array<float,2>{0.374348968f, 0.874165714f},
-std::array<float,2>{0.773592591f, 0.0632513687f},
-std::array<float,2>{0.901512027f, 0.937123597f},
-std::array<float,2>{0.456401855f, 0.147279918f},
-std::array<float,2>{0.049316179f, 0.719827652f},
-std::array<float,2>{0.648836315f, 0.362662405f},
-std::array<float,2>{0.943278491f, 0.551317751f},
-std::array<float,2>{0.434670061f, 0.442307591f},
-std::array<float,2>{0.113425389f, 0.76685822f},
-std::array<float,2>{0.74792105f, 0.0251227729f},
-std::array<float,2>{0.533278584f, 0.99232316f},
-std::array<float,2>{0.158769473f, 0.207459867f},
-std::array<float,2>{0.288223952f, 0.639483452f},
-std::array<float,2>{0.841161728f, 0.304297656f},
-std::array<float,2>{0.656705856f, 0.697597325f},
-std::array<float,2>{0.0148097677f, 0.337774128f},
-std::array<float,2>{0.488329738f, 0.902511239f},
-std::array<float,2>{0.932861388f, 0.162916094f},
-std::array<float,2>{0.810119152f, 0.827542186f},
-std::array<float,2>{0.333110899f, 0.100307092f},
-std::array<float,2>{0.230906308f, 0.610944688f},
-std::array<float,2>{0.619291246f, 0.42246151f},
-std::array<float,2>{0.760970592f, 0.596014261f},
-std::array<float,2>{0.348483652f, 0.418457866f},
-std::array<float,2>{0.205804974f, 0.828872085f},
-std::array<float,2>{0.568413734f, 0.119733468f},
-std::array<float,2>{0.629997432f, 0.885663033f},
-std::array<float,2>{0.0343415253f, 0.173614517f},
-std::array<float,2>{0.438923538f, 0.708868206f},
-std::array<float,2>{0.878969252f, 0.314520627f},
-std::array<float,2>{0.500681639f, 0.653681695f},
-std::array<float,2>{0.142456934f, 0.283472836f},
-std::array<float,2>{0.274537474f, 0.978040457f},
-std::array<float,2>{0.84762758f, 0.195010826f},
-std::array<float,2>{0.989021599f, 0.756485939f},
-std::array<float,2>{0.404426068f, 0.00218920549f},
-std::array<float,2>{0.06485416f, 0.536156476f},
-std::array<float,2>{0.701502025f, 0.465152711f},
-std::array<float,2>{0.916423321f, 0.740918159f},
-std::array<float,2>{0.48410818f, 0.359330118f},
-std::array<float,2>{0.0196519122f, 0.916600883f},
-std::array<float,2>{0.683155894f, 0.137777299f},
-std::array<float,2>{0.594939053f, 0.856407583f},
-std::array<float,2>{0.241314292f, 0.087183401f},
-std::array<float,2>{0.319543421f, 0.579914451f},
-std::array<float,2>{0.795291662f, 0.38588649f},
-std::array<float,2>{0.729128718f, 0.502221048f},
-std::array<float,2>{0.0975181982f, 0.471789092f},
-std::array<float,2>{0.419001132f, 0.802250683f},
-std::array<float,2>{0.959233105f, 0.0460568741f},
-std::array<float,2>{0.82397598f, 0.954766333f},
-std::array<float,2>{0.307920784f, 0.222938046f},
-std::array<float,2>{0.173280358f, 0.674488664f},
-std::array<float,2>{0.56035018f, 0.251156151f},
-std::array<float,2>{0.781660795f, 0.718273878f},
-std::array<float,2>{0.323849708f, 0.324266702f},
-std::array<float,2>{0.245646983f, 0.881479144f},
-std::array<float,2>{0.605030119f, 0.186337262f},
-std::array<float,2>{0.678858995f, 0.83713603f},
-std::array<float,2>{0.0273462087f, 0.114265598f},
-std::array<float,2>{0.469868243f, 0.607749641f},
-std::array<float,2>{0.910547316f, 0.413630664f},
-std::array<float,2>{0.548206449f, 0.54054296f},
-std::array<float,2>{0.185005754f, 0.456381112f},
-std::array<float,2>{0.297598928f, 0.76406616f},
-std::array<float,2>{0.814836621f, 0.0134380488f},
-std::array<float,2>{0.968311071f, 0.971754134f},
-std::array<float,2>{0.408246219f, 0.200726748f},
-std::array<float,2>{0.101627037f, 0.647583723f},
-std::array<float,2>{0.718833387f, 0.296406031f},
-std::array<float,2>{0.887097836f, 0.589660347f},
-std::array<float,2>{0.452341169f, 0.378526598f},
-std::array<float,2>{0.0443347655f, 0.844120324f},
-std::array<float,2>{0.637998044f, 0.084173806f},
-std::array<float,2>{0.575154781f, 0.911914825f},
-std::array<float,2>{0.212730765f, 0.132457152f},
-std::array<float,2>{0.355219543f, 0.743392944f},
-std::array<float,2>{0.752656937f, 0.351481378f},
-std::array<float,2>{0.689175129f, 0.679696023f},
-std::array<float,2>{0.0775544271f, 0.261343032f},
-std::array<float,2>{0.397534132f, 0.964329064f},
-std::array<float,2>{0.993945956f, 0.230197072f},
-std::array<float,2>{0.858597815f, 0.807885289f},
-std::array<float,2>{0.266402215f, 0.0359108821f},
-std::array<float,2>{0.150944099f, 0.509970009f},
-std::array<float,2>{0.51027447f, 0.477302879f},
-std::array<float,2>{0.834502876f, 0.51691246f},
-std::array<float,2>{0.291873187f, 0.484817922f},
-std::array<float,2>{0.165502265f, 0.792426288f},
-std::array<float,2>{0.542165995f, 0.0542608723f},
-std::array<float,2>{0.735423863f, 0.938262105f},
-std::array<float,2>{0.122221835f, 0.242659673f},
-std::array<float,2>{0.422260165f, 0.65902549f},
-std::array<float,2>{0.950475395f, 0.277259618f},
-std::array<float,2>{0.612447798f, 0.730988264f},
-std::array<float,2>{0.219737783f, 0.367878199f},
-std::array<float,2>{0.337282687f, 0.926131785f},
-std::array<float,2>{0.803176165f, 0.155178517f},
-std::array<float,2>{0.922393918f, 0.86589849f},
-std::array<float,2>{0.499101877f, 0.0743222535f},
-std::array<float,2>{0.00320651033f, 0.562759995f},
-std::array<float,2>{0.671656013f, 0.400861591f},
-std::array<float,2>{0.979199946f, 0.627853155f},
-std::array<float,2>{0.383196712f, 0.309450328f},
-std::array<float,2>{0.0790697783f, 0.985366225f},
-std::array<float,2>{0.718509316f, 0.212216616f},
-std::array<float,2>{0.516641557f, 0.778774202f},
-std::array<float,2>{0.127542138f, 0.0212101508f},
-std::array<float,2>{0.2584005f, 0.558293402f},
-std::array<float,2>{0.865114808f, 0.4511953f},
-std::array<float,2>{0.641342223f, 0.621693373f},
-std::array<float,2>{0.0588696189f, 0.430606097f},
-std::array<float,2>{0.464987218f, 0.814359903f},
-std::array<float,2>{0.89292562f, 0.105803542f},
-std::array<float,2>{0.769719541f, 0.892419279f},
-std::array<float,2>{0.367184758f, 0.166015431f},
-std::array<float,2>{0.202181518f, 0.691145778f},
-std::array<float,2>{0.580921888f, 0.331811696f},
-std::array<float,2>{0.816444218f, 0.725616395f},
-std::array<float,2>{0.301870704f, 0.364623547f},
-std::array<float,2>{0.179798558f, 0.931727111f},
-std::array<float,2>{0.55392766f, 0.142079577f},
-std::array<float,2>{0.723261774f, 0.869484246f},
-std::array<float,2>{0.107072391f, 0.0683157295f},
-std::array<float,2>{0.410598516f, 0.570412874f},
-std::array<float,2>{0.962971807f, 0.396509022f},
-std::array<float,2>{0.608647108f, 0.525153518f},
-std::array<float,2>{0.24904266f, 0.498528779f},
-std::array<float,2>{0.326244384f, 0.786659062f},
-std::array<float,2>{0.786650062f, 0.0572977252f},
-std::array<float,2>{0.909336209f, 0.945337474f},
-std::array<float,2>{0.476076335f, 0.235873193f},
-std::array<float,2>{0.0245584715f, 0.667633772f},
-std::array<float,2>{0.671940386f, 0.27320984f},
-std::array<float,2>{0.99688381f, 0.614503562f},
-std::array<float,2>{0.391039342f, 0.426796854f},
-std::array<float,2>{0.0727506131f, 0.822676122f},
-std::array<float,2>{0.694816768f, 0.0949200988f},
-std::array<float,2>{0.512533188f, 0.901560187f},
-std::array<float,2>{0.15533033f, 0.15744929f},
-std::array<float,2>{0.27161029f, 0.700993836f},
-std::array<float,2>{0.854689837f, 0.340722024f},
-std::array<float,2>{0.635391712f, 0.63423121f},
-std::array<float,2>{0.0426883548f, 0.298215389f},
-std::array<float,2>{0.446668983f, 0.99876076f},
-std::array<float,2>{0.885303915f, 0.206611902f},
-std::array<float,2>{0.756206572f, 0.772041023f},
-std::array<float,2>{0.357183516f, 0.0309839565f},
-std::array<float,2>{0.217034653f, 0.550360799f},
-std::array<float,2>{0.570753098f, 0.439385116f},
-std::array<float,2>{0.799507856f, 0.533545971f},
-std::array<float,2>{0.343464494f, 0.461802989f},
-std::array<float,2>{0.223788723f, 0.753538013f},
-std::array<float,2>{0.616331279f, 0.00729809841f},
-std::array<float,2>{0.667665482f, 0.981969297f},
-std::array<float,2>{0.00772074284f, 0.188802257f},
-std::array<float,2>{0.493999779f, 0.649857581f},
-std::array<float,2>{0.926570117f, 0.287834585f},
-std::array<float,2>{0.546662807f, 0.7034536f},
-std::array<float,2>{0.169098228f, 0.318595648f},
-std::array<float,2>{0.294644147f, 0.888847947f},
-std::array<float,2>{0.828555465f, 0.176208228f},
-std::array<float,2>{0.947435617f, 0.832549393f},
-std::array<float,2>{0.42900908f, 0.123802319f},
-std::array<float,2>{0.117986254f, 0.601540565f},
-std::array<float,2>{0.740613699f, 0.415187091f},
-std::array<float,2>{0.895199895f, 0.677767277f},
-std::array<float,2>{0.463523507f, 0.256418198f},
-std::array<float,2>{0.0576024316f, 0.957864881f},
-std::array<float,2>{0.647988558f, 0.218966573f},
-std::array<float,2>{0.582050443f, 0.799490452f},
-std::array<float,2>{0.195970029f, 0.0419970527f},
-std::array<float,2>{0.361937612f, 0.504729569f},
-std::array<float,2>{0.769154847f, 0.474284321f},
-std::array<float,2>{0.712099254f, 0.584958732f},
-std::array<float,2>{0.0823026747f, 0.390318245f},
-std::array<float,2>{0.39023605f, 0.852897346f},
-std::array<float,2>{0.981892824f, 0.0928238556f},
-std::array<float,2>{0.860441208f, 0.919264555f},
-std::array<float,2>{0.26273638f, 0.133593172f},
-std::array<float,2>{0.129655808f, 0.737799525f},
-std::array<float,2>{0.520703077f, 0.354455769f},
-std::array<float,2>{0.778112352f, 0.644489706f},
-std::array<float,2>{0.369685233f, 0.29058513f},
-std::array<float,2>{0.187603608f, 0.976109684f},
-std::array<float,2>{0.590829372f, 0.195499316f},
-std::array<float,2>{0.652588248f, 0.759200752f},
-std::array<float,2>{0.0528172515f, 0.0110411383f},
-std::array<float,2>{0.45859006f, 0.54453969f},
-std::array<float,2>{0.904399812f, 0.459557474f},
-std::array<float,2>{0.526928902f, 0.601587057f},
-std::array<float,2>{0.138872921f, 0.407069385f},
-std::array<float,2>{0.251461565f, 0.843103468f},
-std::array<float,2>{0.873293936f, 0.109697692f},
-std::array<float,2>{0.970198274f, 0.877989411f},
-std::array<float,2>{0.380054414f, 0.180658951f},
-std::array<float,2>{0.0870573074f, 0.714336157f},
-std::array<float,2>{0.704926014f, 0.321116298f},
-std::array<float,2>{0.937367618f, 0.513848543f},
-std::array<float,2>{0.486740023f, 0.483462095f},
-std::array<float,2>{0.0111166034f, 0.809154868f},
-std::array<float,2>{0.661188722f, 0.0327047259f},
-std::array<float,2>{0.624740243f, 0.967418253f},
-std::array<float,2>{0.227657616f, 0.232321694f},
-std::array<float,2>{0.329148859f, 0.686205447f},
-std::array<float,2>{0.808329463f, 0.262571096f},
-std::array<float,2>{0.744202137f, 0.749704778f},
-std::array<float,2>{0.111599527f, 0.344734639f},
-std::array<float,2>{0.433248609f, 0.909093678f},
-std::array<float,2>{0.938088536f, 0.125130236f},
-std::array<float,2>{0.839292049f, 0.851213992f},
-std::array<float,2>{0.282863766f, 0.0788186938f},
-std::array<float,2>{0.16256763f, 0.591685236f},
-std::array<float,2>{0.537225246f, 0.380178094f},
-std::array<float,2>{0.849905491f, 0.566824555f},
-std::array<float,2>{0.280336171f, 0.404977798f},
-std::array<float,2>{0.14717561f, 0.860497832f},
-std::array<float,2>{0.505173504f, 0.0707366094f},
-std::array<float,2>{0.697449684f, 0.92343992f},
-std::array<float,2>{0.068153955f, 0.150467321f},
-std::array<float,2>{0.400521785f, 0.726594329f},
-std::array<float,2>{0.986885488f, 0.372366607f},
-std::array<float,2>{0.56565541f, 0.663905084f},
-std::array<float,2>{0.210361764f, 0.278940082f},
-std::array<float,2>{0.347160816f, 0.941662192f},
-std::array<float,2>{0.763937593f, 0.248636097f},
-std::array<float,2>{0.877350271f, 0.795584679f},
-std::array<float,2>{0.44194746f, 0.0483171232f},
-std::array<float,2>{0.0390316658f, 0.520053267f},
-std::array<float,2>{0.625089526f, 0.488665789f},
-std::array<float,2>{0.954370379f, 0.691805243f},
-std::array<float,2>{0.414432019f, 0.332480311f},
-std::array<float,2>{0.0991451293f, 0.89827317f},
-std::array<float,2>{0.731358588f, 0.171287566f},
-std::array<float,2>{0.554714561f, 0.819605708f},
-std::array<float,2>{0.177276745f, 0.103305228f},
-std::array<float,2>{0.311668605f, 0.617263794f},
-std::array<float,2>{0.825404465f, 0.434152156f},
-std::array<float,2>{0.684865654f, 0.561655641f},
-std::array<float,2>{0.015989786f, 0.446505159f},
-std::array<float,2>{0.47836116f, 0.775161207f},
-std::array<float,2>{0.918119669f, 0.0176247954f},
-std::array<float,2>{0.791862309f, 0.988938987f},
-std::array<float,2>{0.315956354f, 0.215856999f},
-std::array<float,2>{0.235401243f, 0.630061924f},
-std::array<float,2>{0.60083282f, 0.306452811f},
-std::array<float,2>{0.842790842f, 0.637202442f},
-std::array<float,2>{0.285249382f, 0.302387267f},
-std::array<float,2>{0.157164767f, 0.995527804f},
-std::array<float,2>{0.531964242f, 0.209770188f},
-std::array<float,2>{0.749519885f, 0.768081188f},
-std::array<float,2>{0.115870178f, 0.0260748733f},
-std::array<float,2>{0.43696928f, 0.553483248f},
-std::array<float,2>{0.943637669f, 0.444869339f},
-std::array<float,2>{0.618978739f, 0.612689793f},
-std::array<float,2>{0.233455732f, 0.424327701f},
-std::array<float,2>{0.335005105f, 0.8253389f},
-std::array<float,2>{0.811730266f, 0.098272942f},
-std::array<float,2>{0.930138946f, 0.905904055f},
-std::array<float,2>{0.490632564f, 0.160994872f},
-std::array<float,2>{0.0129194465f, 0.696115136f},
-std::array<float,2>{0.658691347f, 0.339055866f},
-std::array<float,2>{0.976132751f, 0.528186858f},
-std::array<float,2>{0.376570165f, 0.495119661f},
-std::array<float,2>{0.0927755311f, 0.78174752f},
-std::array<float,2>{0.708309948f, 0.0595597625f},
-std::array<float,2>{0.529650509f, 0.951344788f},
-std::array<float,2>{0.136381477f, 0.238996968f},
-std::array<float,2>{0.254933983f, 0.671743453f},
-std::array<float,2>{0.867940247f, 0.267642409f},
-std::array<float,2>{0.651808798f, 0.722109914f},
-std::array<float,2>{0.0477579609f, 0.360649318f},
-std::array<float,2>{0.454227448f, 0.934894025f},
-std::array<float,2>{0.899094403f, 0.145413578f},
-std::array<float,2>{0.776669741f, 0.871858895f},
-std::array<float,2>{0.371627301f, 0.06543874f},
-std::array<float,2>{0.192905307f, 0.574967682f},
-std::array<float,2>{0.586989582f, 0.391695738f},
-std::array<float,2>{0.793739498f, 0.580819488f},
-std::array<float,2>{0.317895025f, 0.383129388f},
-std::array<float,2>{0.239450708f, 0.858898103f},
-std::array<float,2>{0.595931947f, 0.088921316f},
-std::array<float,2>{0.68139267f, 0.91484803f},
-std::array<float,2>{0.0216880757f, 0.13936466f},
-std::array<float,2>{0.482400656f, 0.739827752f},
-std::array<float,2>{0.915980101f, 0.356497109f},
-std::array<float,2>{0.560838401f, 0.672050953f},
-std::array<float,2>{0.174989924f, 0.25383088f},
-std::array<float,2>{0.305919021f, 0.955747545f},
-std::array<float,2>{0.821484268f, 0.225608289f},
-std::array<float,2>{0.957829535f, 0.804485261f},
-std::array<float,2>{0.42079711f, 0.0444280468f},
-std::array<float,2>{0.0945640206f, 0.501084089f},
-std::array<float,2>{0.728488922f, 0.470542073f},
-std::array<float,2>{0.882084131f, 0.710009694f},
-std::array<float,2>{0.440591007f, 0.31285876f},
-std::array<float,2>{0.033162497f, 0.884638846f},
-std::array<float,2>{0.632415593f, 0.175384611f},
-std::array<float,2>{0.567392647f, 0.830974042f},
-std::array<float,2>{0.203246906f, 0.118410952f},
-std::array<float,2>{0.350064307f, 0.595656574f},
-std::array<float,2>{0.758714139f, 0.421114147f},
-std::array<float,2>{0.699976146f, 0.537468016f},
-std::array<float,2>{0.0633925498f, 0.467086554f},
-std::array<float,2>{0.403820336f, 0.754178941f},
-std::array<float,2>{0.992033064f, 0.000440149481f},
-std::array<float,2>{0.844174743f, 0.980443716f},
-std::array<float,2>{0.276579976f, 0.19298394f},
-std::array<float,2>{0.142849699f, 0.655510664f},
-std::array<float,2>{0.502019107f, 0.282727182f},
-std::array<float,2>{0.751552045f, 0.745406389f},
-std::array<float,2>{0.351626366f, 0.348613352f},
-std::array<float,2>{0.214770496f, 0.913421035f},
-std::array<float,2>{0.576922119f, 0.130780995f},
-std::array<float,2>{0.639200628f, 0.846414804f},
-std::array<float,2>{0.0457994826f, 0.0831961632f},
-std::array<float,2>{0.449755639f, 0.587698936f},
-std::array<float,2>{0.889335036f, 0.375579029f},
-std::array<float,2>{0.508105338f, 0.508834302f},
-std::array<float,2>{0.149076194f, 0.479743332f},
-std::array<float,2>{0.267780602f, 0.8055709f},
-std::array<float,2>{0.856227398f, 0.0387267508f},
-std::array<float,2>{0.995542526f, 0.962018192f},
-std::array<float,2>{0.394695133f, 0.226751804f},
-std::array<float,2>{0.0750806928f, 0.683318257f},
-std::array<float,2>{0.690770507f, 0.258051187f},
-std::array<float,2>{0.913809061f, 0.605651379f},
-std::array<float,2>{0.471247047f, 0.410749733f},
-std::array<float,2>{0.0302851088f, 0.838552892f},
-std::array<float,2>{0.677310169f, 0.115355611f},
-std::array<float,2>{0.603506386f, 0.880384326f},
-std::array<float,2>{0.242402956f, 0.185271978f},
-std::array<float,2>{0.321281999f, 0.716568768f},
-std::array<float,2>{0.784702539f, 0.327026427f},
-std::array<float,2>{0.722499609f, 0.646393895f},
-std::array<float,2>{0.103593633f, 0.293798178f},
-std::array<float,2>{0.407481521f, 0.970451295f},
-std::array<float,2>{0.965071619f, 0.202857375f},
-std::array<float,2>{0.81362915f, 0.762414694f},
-std::array<float,2>{0.299731314f, 0.0152102215f},
-std::array<float,2>{0.18628411f, 0.542562544f},
-std::array<float,2>{0.549916744f, 0.453487962f},
-std::array<float,2>{0.867040694f, 0.554795146f},
-std::array<float,2>{0.260685384f, 0.449223071f},
-std::array<float,2>{0.126484856f, 0.77942878f},
-std::array<float,2>{0.519166291f, 0.0221454576f},
-std::array<float,2>{0.716126859f, 0.987099707f},
-std::array<float,2>{0.0816315189f, 0.214461014f},
-std::array<float,2>{0.385229468f, 0.626231372f},
-std::array<float,2>{0.977752924f, 0.31116274f},
-std::array<float,2>{0.578969181f, 0.68800956f},
-std::array<float,2>{0.199802727f, 0.328407496f},
-std::array<float,2>{0.364847988f, 0.893193185f},
-std::array<float,2>{0.772017121f, 0.167122245f},
-std::array<float,2>{0.891594887f, 0.814588189f},
-std::array<float,2>{0.468697727f, 0.108760931f},
-std::array<float,2>{0.0611854009f, 0.624369621f},
-std::array<float,2>{0.643480599f, 0.432826221f},
-std::array<float,2>{0.951675773f, 0.656500101f},
-std::array<float,2>{0.424966842f, 0.275009245f},
-std::array<float,2>{0.124690153f, 0.940532506f},
-std::array<float,2>{0.736637175f, 0.244822159f},
-std::array<float,2>{0.540558457f, 0.790395498f},
-std::array<float,2>{0.167707503f, 0.0514101759f},
-std::array<float,2>{0.290347755f, 0.518026829f},
-std::array<float,2>{0.833551824f, 0.486825228f},
-std::array<float,2>{0.668072999f, 0.564585149f},
-std::array<float,2>{0.00120682863f, 0.398851871f},
-std::array<float,2>{0.496210128f, 0.863485396f},
-std::array<float,2>{0.925051808f, 0.0777745992f},
-std::array<float,2>{0.80167377f, 0.927930057f},
-std::array<float,2>{0.338327676f, 0.154187962f},
-std::array<float,2>{0.221315578f, 0.732898653f},
-std::array<float,2>{0.61087364f, 0.370739907f},
-std::array<float,2>{0.852731586f, 0.701564074f},
-std::array<float,2>{0.270583391f, 0.343239605f},
-std::array<float,2>{0.153458163f, 0.899684608f},
-std::array<float,2>{0.515387774f, 0.15986684f},
-std::array<float,2>{0.692424595f, 0.821040213f},
-std::array<float,2>{0.0718200207f, 0.097355172f},
-std::array<float,2>{0.392830282f, 0.61664623f},
-std::array<float,2>{0.998800814f, 0.427953213f},
-std::array<float,2>{0.573232174f, 0.547995448f},
-std::array<float,2>{0.216417238f, 0.440589428f},
-std::array<float,2>{0.358057052f, 0.7708745f},
-std::array<float,2>{0.754019737f, 0.0283177309f},
-std::array<float,2>{0.883359611f, 0.996138692f},
-std::array<float,2>{0.447406739f, 0.204140946f},
-std::array<float,2>{0.0397437736f, 0.634835362f},
-std::array<float,2>{0.634555221f, 0.300329894f},
-std::array<float,2>{0.961563408f, 0.573979139f},
-std::array<float,2>{0.413804591f, 0.396192253f},
-std::array<float,2>{0.108735047f, 0.86864835f},
-std::array<float,2>{0.725604236f, 0.0689614266f},
-std::array<float,2>{0.55258435f, 0.930293262f},
-std::array<float,2>{0.183046088f, 0.143429548f},
-std::array<float,2>{0.304059774f, 0.723654747f},
-std::array<float,2>{0.819470048f, 0.367003292f},
-std::array<float,2>{0.67504102f, 0.665293217f},
-std::array<float,2>{0.0259438194f, 0.270209789f},
-std::array<float,2>{0.473647833f, 0.947509706f},
-std::array<float,2>{0.90741837f, 0.238194495f},
-std::array<float,2>{0.788833439f, 0.788607955f},
-std::array<float,2>{0.324655741f, 0.0559902713f},
-std::array<float,2>{0.247999981f, 0.526874661f},
-std::array<float,2>{0.606864452f, 0.496237695f},
-std::array<float,2>{0.766122341f, 0.506484509f},
-std::array<float,2>{0.360162973f, 0.475693852f},
-std::array<float,2>{0.197857708f, 0.797299623f},
-std::array<float,2>{0.584192812f, 0.0409978218f},
-std::array<float,2>{0.644887924f, 0.960622251f},
-std::array<float,2>{0.0558492914f, 0.221602917f},
-std::array<float,2>{0.461590409f, 0.677473783f},
-std::array<float,2>{0.896760881f, 0.25486061f},
-std::array<float,2>{0.521702588f, 0.734661996f},
-std::array<float,2>{0.132588103f, 0.351792902f},
-std::array<float,2>{0.264804006f, 0.920300007f},
-std::array<float,2>{0.862295568f, 0.135297731f},
-std::array<float,2>{0.983083665f, 0.855289876f},
-std::array<float,2>{0.388377279f, 0.0902317762f},
-std::array<float,2>{0.0852750093f, 0.58228898f},
-std::array<float,2>{0.713467896f, 0.38723731f},
-std::array<float,2>{0.929342628f, 0.652330101f},
-std::array<float,2>{0.494584471f, 0.286040246f},
-std::array<float,2>{0.00536528882f, 0.98314774f},
-std::array<float,2>{0.664412737f, 0.189755514f},
-std::array<float,2>{0.614298999f, 0.751415491f},
-std::array<float,2>{0.226290748f, 0.00407474348f},
-std::array<float,2>{0.34038201f, 0.532002866f},
-std::array<float,2>{0.798102081f, 0.464666873f},
-std::array<float,2>{0.739067137f, 0.598588407f},
-std::array<float,2>{0.120498806f, 0.417328566f},
-std::array<float,2>{0.427692533f, 0.834506333f},
-std::array<float,2>{0.946635008f, 0.121924616f},
-std::array<float,2>{0.831541896f, 0.887058914f},
-std::array<float,2>{0.296288341f, 0.17926465f},
-std::array<float,2>{0.171859294f, 0.705791235f},
-std::array<float,2>{0.54322803f, 0.317185134f},
-std::array<float,2>{0.804835916f, 0.685113311f},
-std::array<float,2>{0.330130935f, 0.264371634f},
-std::array<float,2>{0.22950764f, 0.96676141f},
-std::array<float,2>{0.622197688f, 0.233229801f},
-std::array<float,2>{0.663720787f, 0.811196208f},
-std::array<float,2>{0.00973644201f, 0.0337653831f},
-std::array<float,2>{0.485800147f, 0.511955678f},
-std::array<float,2>{0.935134768f, 0.48227042f},
-std::array<float,2>{0.537027776f, 0.59329313f},
-std::array<float,2>{0.161041096f, 0.381224126f},
-std::array<float,2>{0.284128636f, 0.849345744f},
-std::array<float,2>{0.836957335f, 0.0807824582f},
-std::array<float,2>{0.939724445f, 0.908059895f},
-std::array<float,2>{0.431513309f, 0.127431631f},
-std::array<float,2>{0.110308766f, 0.746619582f},
-std::array<float,2>{0.743290126f, 0.347621709f},
-std::array<float,2>{0.904026926f, 0.545713842f},
-std::array<float,2>{0.46028015f, 0.457221717f},
-std::array<float,2>{0.0527114682f, 0.759830356f},
-std::array<float,2>{0.655026913f, 0.0093955528f},
-std::array<float,2>{0.593555987f, 0.974182367f},
-std::array<float,2>{0.190450013f, 0.198018879f},
-std::array<float,2>{0.368664473f, 0.641252637f},
-std::array<float,2>{0.780086458f, 0.292424232f},
-std::array<float,2>{0.706665754f, 0.711378038f},
-std::array<float,2>{0.0881538913f, 0.323860466f},
-std::array<float,2>{0.382056832f, 0.876735151f},
-std::array<float,2>{0.97147423f, 0.182103693f},
-std::array<float,2>{0.872790992f, 0.840559602f},
-std::array<float,2>{0.253219664f, 0.113242753f},
-std::array<float,2>{0.138114691f, 0.604045808f},
-std::array<float,2>{0.525348783f, 0.40862152f},
-std::array<float,2>{0.827506244f, 0.620426714f},
-std::array<float,2>{0.308704495f, 0.435570538f},
-std::array<float,2>{0.178761825f, 0.818057775f},
-std::array<float,2>{0.557224989f, 0.103882797f},
-std::array<float,2>{0.733645678f, 0.895013034f},
-std::array<float,2>{0.101264037f, 0.169576123f},
-std::array<float,2>{0.417540163f, 0.694076478f},
-std::array<float,2>{0.955405533f, 0.334341675f},
-std::array<float,2>{0.598497987f, 0.631917536f},
-std::array<float,2>{0.237844825f, 0.308177948f},
-std::array<float,2>{0.314374954f, 0.990937173f},
-std::array<float,2>{0.789650977f, 0.217047065f},
-std::array<float,2>{0.921452224f, 0.775667429f},
-std::array<float,2>{0.47908321f, 0.0170337074f},
-std::array<float,2>{0.0183303468f, 0.558756053f},
-std::array<float,2>{0.686413467f, 0.44873172f},
-std::array<float,2>{0.985617459f, 0.728869915f},
-std::array<float,2>{0.399462253f, 0.373180211f},
-std::array<float,2>{0.0694093853f, 0.92411226f},
-std::array<float,2>{0.696728289f, 0.14878504f},
-std::array<float,2>{0.506395817f, 0.861745179f},
-std::array<float,2>{0.145877779f, 0.07386107f},
-std::array<float,2>{0.27874741f, 0.568653822f},
-std::array<float,2>{0.848328352f, 0.402436376f},
-std::array<float,2>{0.628886282f, 0.522561729f},
-std::array<float,2>{0.0363507569f, 0.490986407f},
-std::array<float,2>{0.444712341f, 0.794490755f},
-std::array<float,2>{0.875929058f, 0.0497329533f},
-std::array<float,2>{0.763167262f, 0.943764865f},
-std::array<float,2>{0.345595211f, 0.247256607f},
-std::array<float,2>{0.207423702f, 0.660316765f},
-std::array<float,2>{0.563765168f, 0.28093788f},
-std::array<float,2>{0.864499688f, 0.626580656f},
-std::array<float,2>{0.258075237f, 0.310593814f},
-std::array<float,2>{0.127216682f, 0.98640281f},
-std::array<float,2>{0.517100215f, 0.213928878f},
-std::array<float,2>{0.717839897f, 0.780016124f},
-std::array<float,2>{0.0782001615f, 0.0216634851f},
-std::array<float,2>{0.383635491f, 0.555237591f},
-std::array<float,2>{0.978751421f, 0.449960858f},
-std::array<float,2>{0.580435157f, 0.624691427f},
-std::array<float,2>{0.2027933f, 0.433310032f},
-std::array<float,2>{0.366668582f, 0.81513685f},
-std::array<float,2>{0.770080745f, 0.109109104f},
-std::array<float,2>{0.893327236f, 0.893048048f},
-std::array<float,2>{0.465603769f, 0.167576641f},
-std::array<float,2>{0.0594674684f, 0.687678993f},
-std::array<float,2>{0.641008139f, 0.328652978f},
-std::array<float,2>{0.951109469f, 0.518455505f},
-std::array<float,2>{0.422436595f, 0.48667863f},
-std::array<float,2>{0.122859702f, 0.790551066f},
-std::array<float,2>{0.736319244f, 0.0508851968f},
-std::array<float,2>{0.542761683f, 0.940975487f},
-std::array<float,2>{0.165640578f, 0.244394764f},
-std::array<float,2>{0.29116255f, 0.656916857f},
-std::array<float,2>{0.834463477f, 0.27461502f},
-std::array<float,2>{0.670963347f, 0.732945025f},
-std::array<float,2>{0.00368788792f, 0.370287508f},
-std::array<float,2>{0.499565959f, 0.92848891f},
-std::array<float,2>{0.922167122f, 0.153723106f},
-std::array<float,2>{0.803431213f, 0.863890052f},
-std::array<float,2>{0.33788988f, 0.0772156864f},
-std::array<float,2>{0.220510393f, 0.565296888f},
-std::array<float,2>{0.613123775f, 0.399303824f},
-std::array<float,2>{0.75222224f, 0.587253332f},
-std::array<float,2>{0.354844838f, 0.375402927f},
-std::array<float,2>{0.212332085f, 0.845831275f},
-std::array<float,2>{0.574536383f, 0.0839746371f},
-std::array<float,2>{0.638602912f, 0.91392982f},
-std::array<float,2>{0.0448228344f, 0.130250081f},
-std::array<float,2>{0.452675372f, 0.745622575f},
-std::array<float,2>{0.887267828f, 0.348073572f},
-std::array<float,2>{0.509900331f, 0.682716966f},
-std::array<float,2>{0.150668129f, 0.258740604f},
-std::array<float,2>{0.265688926f, 0.96262157f},
-std::array<float,2>{0.859220505f, 0.22740899f},
-std::array<float,2>{0.993174314f, 0.804797888f},
-std::array<float,2>{0.398156106f, 0.0383728668f},
-std::array<float,2>{0.0778196529f, 0.509292483f},
-std::array<float,2>{0.688751996f, 0.480115592f},
-std::array<float,2>{0.910646617f, 0.715858936f},
-std::array<float,2>{0.47027263f, 0.326593935f},
-std::array<float,2>{0.0279210228f, 0.880250633f},
-std::array<float,2>{0.679667652f, 0.184805915f},
-std::array<float,2>{0.604844987f, 0.838097394f},
-std::array<float,2>{0.245226264f, 0.116158903f},
-std::array<float,2>{0.32359001f, 0.60644424f},
-std::array<float,2>{0.782083392f, 0.410172492f},
-std::array<float,2>{0.719669104f, 0.542220414f},
-std::array<float,2>{0.102366395f, 0.453650385f},
-std::array<float,2>{0.408929139f, 0.762082458f},
-std::array<float,2>{0.968118191f, 0.0148863606f},
-std::array<float,2>{0.815331399f, 0.970136046f},
-std::array<float,2>{0.297014892f, 0.202587813f},
-std::array<float,2>{0.185083404f, 0.645946026f},
-std::array<float,2>{0.548702657f, 0.293310761f},
-std::array<float,2>{0.795746922f, 0.739409089f},
-std::array<float,2>{0.320254683f, 0.357131481f},
-std::array<float,2>{0.24174349f, 0.914393485f},
-std::array<float,2>{0.595520437f, 0.139002949f},
-std::array<float,2>{0.682714403f, 0.858880579f},
-std::array<float,2>{0.0203541182f, 0.0894962847f},
-std::array<float,2>{0.48383975f, 0.580290616f},
-std::array<float,2>{0.916858971f, 0.383547723f},
-std::array<float,2>{0.55996567f, 0.501922488f},
-std::array<float,2>{0.173496485f, 0.47011289f},
-std::array<float,2>{0.308127493f, 0.803752542f},
-std::array<float,2>{0.823620856f, 0.0447849073f},
-std::array<float,2>{0.959587395f, 0.955268681f},
-std::array<float,2>{0.419661582f, 0.226097181f},
-std::array<float,2>{0.0971105024f, 0.672387183f},
-std::array<float,2>{0.728588045f, 0.253353357f},
-std::array<float,2>{0.879442275f, 0.59480828f},
-std::array<float,2>{0.439071834f, 0.421585441f},
-std::array<float,2>{0.0347660966f, 0.830283999f},
-std::array<float,2>{0.630730748f, 0.118786909f},
-std::array<float,2>{0.568883002f, 0.884269536f},
-std::array<float,2>{0.20554094f, 0.174982503f},
-std::array<float,2>{0.348117143f, 0.710904419f},
-std::array<float,2>{0.761599123f, 0.313083738f},
-std::array<float,2>{0.702112317f, 0.656095326f},
-std::array<float,2>{0.0653233305f, 0.282277822f},
-std::array<float,2>{0.405206829f, 0.979810417f},
-std::array<float,2>{0.988318801f, 0.192465931f},
-std::array<float,2>{0.847023547f, 0.754704118f},
-std::array<float,2>{0.275328338f, 0.000501176168f},
-std::array<float,2>{0.141780257f, 0.538018882f},
-std::array<float,2>{0.500363648f, 0.46754992f},
-std::array<float,2>{0.841494381f, 0.553029537f},
-std::array<float,2>{0.28900516f, 0.44445622f},
-std::array<float,2>{0.158340499f, 0.767819345f},
-std::array<float,2>{0.533936143f, 0.0256683845f},
-std::array<float,2>{0.74708432f, 0.995724499f},
-std::array<float,2>{0.114005707f, 0.209100351f},
-std::array<float,2>{0.435198069f, 0.637278616f},
-std::array<float,2>{0.942815781f, 0.301863015f},
-std::array<float,2>{0.619644046f, 0.695662558f},
-std::array<float,2>{0.231072336f, 0.339379132f},
-std::array<float,2>{0.333689094f, 0.90556556f},
-std::array<float,2>{0.80971086f, 0.160468861f},
-std::array<float,2>{0.93334198f, 0.825797856f},
-std::array<float,2>{0.489064425f, 0.0980710015f},
-std::array<float,2>{0.0156122632f, 0.612881839f},
-std::array<float,2>{0.656784236f, 0.423993528f},
-std::array<float,2>{0.97370708f, 0.671337843f},
-std::array<float,2>{0.378183633f, 0.268470943f},
-std::array<float,2>{0.090123646f, 0.95178318f},
-std::array<float,2>{0.709900379f, 0.238490134f},
-std::array<float,2>{0.528334796f, 0.781281829f},
-std::array<float,2>{0.132908985f, 0.0588676967f},
-std::array<float,2>{0.257475585f, 0.527367115f},
-std::array<float,2>{0.869569182f, 0.495881766f},
-std::array<float,2>{0.64939779f, 0.574580908f},
-std::array<float,2>{0.0495117232f, 0.39238289f},
-std::array<float,2>{0.456748873f, 0.871318579f},
-std::array<float,2>{0.901913464f, 0.0662752613f},
-std::array<float,2>{0.774131656f, 0.935365915f},
-std::array<float,2>{0.374767244f, 0.144581228f},
-std::array<float,2>{0.193612218f, 0.722376406f},
-std::array<float,2>{0.589812756f, 0.361002535f},
-std::array<float,2>{0.826038539f, 0.693476439f},
-std::array<float,2>{0.312102735f, 0.334858f},
-std::array<float,2>{0.177126542f, 0.895296514f},
-std::array<float,2>{0.555213749f, 0.169338882f},
-std::array<float,2>{0.730899453f, 0.817528129f},
-std::array<float,2>{0.0987824276f, 0.104103938f},
-std::array<float,2>{0.41503194f, 0.620922804f},
-std::array<float,2>{0.954889476f, 0.43615824f},
-std::array<float,2>{0.601559937f, 0.559407353f},
-std::array<float,2>{0.236073434f, 0.448584974f},
-std::array<float,2>{0.315711707f, 0.776215017f},
-std::array<float,2>{0.79112792f, 0.0171704516f},
-std::array<float,2>{0.918631494f, 0.990527034f},
-std::array<float,2>{0.477618456f, 0.217298985f},
-std::array<float,2>{0.0162455142f, 0.632328749f},
-std::array<float,2>{0.685120106f, 0.30785948f},
-std::array<float,2>{0.986796558f, 0.568923891f},
-std::array<float,2>{0.401320219f, 0.402893484f},
-std::array<float,2>{0.0675592944f, 0.862204611f},
-std::array<float,2>{0.698237777f, 0.0735499635f},
-std::array<float,2>{0.505732656f, 0.924407542f},
-std::array<float,2>{0.146706805f, 0.149089783f},
-std::array<float,2>{0.281063467f, 0.729109824f},
-std::array<float,2>{0.850583434f, 0.3736009f},
-std::array<float,2>{0.62596029f, 0.660692871f},
-std::array<float,2>{0.0384531915f, 0.280450374f},
-std::array<float,2>{0.441456139f, 0.943975925f},
-std::array<float,2>{0.877587318f, 0.24772732f},
-std::array<float,2>{0.764302671f, 0.794009387f},
-std::array<float,2>{0.347426414f, 0.0490673035f},
-std::array<float,2>{0.210891724f, 0.523389578f},
-std::array<float,2>{0.566344738f, 0.490293473f},
-std::array<float,2>{0.807632387f, 0.512251854f},
-std::array<float,2>{0.329749137f, 0.481456578f},
-std::array<float,2>{0.228372484f, 0.810705125f},
-std::array<float,2>{0.624172509f, 0.0332380235f},
-std::array<float,2>{0.66189003f, 0.966237009f},
-std::array<float,2>{0.0115152793f, 0.23270008f},
-std::array<float,2>{0.486890048f, 0.684854209f},
-std::array<float,2>{0.936942518f, 0.263948709f},
-std::array<float,2>{0.537968993f, 0.74615562f},
-std::array<float,2>{0.162711307f, 0.346743256f},
-std::array<float,2>{0.282623142f, 0.907670259f},
-std::array<float,2>{0.839785576f, 0.127641827f},
-std::array<float,2>{0.937967896f, 0.848730922f},
-std::array<float,2>{0.432907552f, 0.0803010911f},
-std::array<float,2>{0.111921236f, 0.592908978f},
-std::array<float,2>{0.744815767f, 0.381544083f},
-std::array<float,2>{0.905157685f, 0.64069438f},
-std::array<float,2>{0.458051324f, 0.292757064f},
-std::array<float,2>{0.053293325f, 0.974047124f},
-std::array<float,2>{0.652848363f, 0.197719157f},
-std::array<float,2>{0.591406286f, 0.760518193f},
-std::array<float,2>{0.188149512f, 0.00891289208f},
-std::array<float,2>{0.369581908f, 0.545228481f},
-std::array<float,2>{0.777613342f, 0.457760572f},
-std::array<float,2>{0.70455277f, 0.603695929f},
-std::array<float,2>{0.0875769332f, 0.409111261f},
-std::array<float,2>{0.380581975f, 0.840049148f},
-std::array<float,2>{0.970377028f, 0.112569563f},
-std::array<float,2>{0.873904884f, 0.87602967f},
-std::array<float,2>{0.251480192f, 0.182511672f},
-std::array<float,2>{0.139460027f, 0.711472452f},
-std::array<float,2>{0.526823699f, 0.323668152f},
-std::array<float,2>{0.768579721f, 0.677074194f},
-std::array<float,2>{0.36135444f, 0.253954649f},
-std::array<float,2>{0.195677355f, 0.960047722f},
-std::array<float,2>{0.582844496f, 0.220806554f},
-std::array<float,2>{0.647725105f, 0.797644019f},
-std::array<float,2>{0.0570345484f, 0.0402955413f},
-std::array<float,2>{0.46301052f, 0.505941868f},
-std::array<float,2>{0.894604862f, 0.476503253f},
-std::array<float,2>{0.521306515f, 0.582623482f},
-std::array<float,2>{0.129158601f, 0.386950374f},
-std::array<float,2>{0.263659835f, 0.854528725f},
-std::array<float,2>{0.86129576f, 0.0905967131f},
-std::array<float,2>{0.981974363f, 0.920540988f},
-std::array<float,2>{0.390005589f, 0.135189548f},
-std::array<float,2>{0.0825494975f, 0.735019743f},
-std::array<float,2>{0.712757707f, 0.352404475f},
-std::array<float,2>{0.925912857f, 0.531460702f},
-std::array<float,2>{0.493408322f, 0.463919938f},
-std::array<float,2>{0.00708964001f, 0.751490116f},
-std::array<float,2>{0.667304456f, 0.00449877745f},
-std::array<float,2>{0.617019713f, 0.98244077f},
-std::array<float,2>{0.224218547f, 0.189972296f},
-std::array<float,2>{0.343061268f, 0.651573181f},
-std::array<float,2>{0.798941433f, 0.285593867f},
-std::array<float,2>{0.740990222f, 0.705368936f},
-std::array<float,2>{0.117497921f, 0.316869169f},
-std::array<float,2>{0.429221034f, 0.887389243f},
-std::array<float,2>{0.947884798f, 0.1791794f},
-std::array<float,2>{0.828868926f, 0.834137321f},
-std::array<float,2>{0.293994695f, 0.121231213f},
-std::array<float,2>{0.16980432f, 0.597826779f},
-std::array<float,2>{0.546277881f, 0.417679906f},
-std::array<float,2>{0.855211377f, 0.617111146f},
-std::array<float,2>{0.272060841f, 0.428650141f},
-std::array<float,2>{0.155987635f, 0.820629537f},
-std::array<float,2>{0.512097001f, 0.0969703197f},
-std::array<float,2>{0.694905639f, 0.900025845f},
-std::array<float,2>{0.0728341416f, 0.159620956f},
-std::array<float,2>{0.391262442f, 0.702040374f},
-std::array<float,2>{0.996276259f, 0.343618155f},
-std::array<float,2>{0.57085222f, 0.635542691f},
-std::array<float,2>{0.217308342f, 0.300278485f},
-std::array<float,2>{0.356590241f, 0.996757567f},
-std::array<float,2>{0.756655276f, 0.205036595f},
-std::array<float,2>{0.885198057f, 0.771232069f},
-std::array<float,2>{0.447255164f, 0.0276121814f},
-std::array<float,2>{0.0421203114f, 0.548419118f},
-std::array<float,2>{0.634981275f, 0.441387415f},
-std::array<float,2>{0.96344012f, 0.724165022f},
-std::array<float,2>{0.411040217f, 0.366275787f},
-std::array<float,2>{0.106563471f, 0.930064261f},
-std::array<float,2>{0.722742736f, 0.143022731f},
-std::array<float,2>{0.554260314f, 0.869074881f},
-std::array<float,2>{0.180348411f, 0.0687300116f},
-std::array<float,2>{0.302489638f, 0.573513091f},
-std::array<float,2>{0.817029774f, 0.395623744f},
-std::array<float,2>{0.672375262f, 0.526464343f},
-std::array<float,2>{0.0251694415f, 0.496630341f},
-std::array<float,2>{0.476067454f, 0.788303614f},
-std::array<float,2>{0.91002506f, 0.0562006347f},
-std::array<float,2>{0.786619902f, 0.948011279f},
-std::array<float,2>{0.326713145f, 0.237427846f},
-std::array<float,2>{0.249555901f, 0.665999711f},
-std::array<float,2>{0.609207749f, 0.269854665f},
-std::array<float,2>{0.833493471f, 0.65841186f},
-std::array<float,2>{0.291004151f, 0.27663964f},
-std::array<float,2>{0.167061657f, 0.937976122f},
-std::array<float,2>{0.54047066f, 0.242937312f},
-std::array<float,2>{0.737074137f, 0.792499006f},
-std::array<float,2>{0.124190986f, 0.0537774861f},
-std::array<float,2>{0.42548722f, 0.51756084f},
-std::array<float,2>{0.951240063f, 0.485102177f},
-std::array<float,2>{0.610387146f, 0.563453138f},
-std::array<float,2>{0.220845386f, 0.401228279f},
-std::array<float,2>{0.338710725f, 0.865237832f},
-std::array<float,2>{0.801173091f, 0.0748312548f},
-std::array<float,2>{0.925538659f, 0.926476717f},
-std::array<float,2>{0.496841788f, 0.154534787f},
-std::array<float,2>{0.00155468355f, 0.73061651f},
-std::array<float,2>{0.668734133f, 0.367589891f},
-std::array<float,2>{0.978054583f, 0.557784736f},
-std::array<float,2>{0.385553747f, 0.452106863f},
-std::array<float,2>{0.0812544823f, 0.778847754f},
-std::array<float,2>{0.716420233f, 0.0207327362f},
-std::array<float,2>{0.518585205f, 0.986157894f},
-std::array<float,2>{0.126167789f, 0.212763399f},
-std::array<float,2>{0.259957403f, 0.627423167f},
-std::array<float,2>{0.866548896f, 0.309006304f},
-std::array<float,2>{0.642946482f, 0.690687716f},
-std::array<float,2>{0.0605669878f, 0.331276029f},
-std::array<float,2>{0.468145907f, 0.891720414f},
-std::array<float,2>{0.890715063f, 0.16512841f},
-std::array<float,2>{0.771966994f, 0.813629687f},
-std::array<float,2>{0.364595413f, 0.106302433f},
-std::array<float,2>{0.199456751f, 0.621185601f},
-std::array<float,2>{0.57852447f, 0.429808229f},
-std::array<float,2>{0.784227073f, 0.608165264f},
-std::array<float,2>{0.320733905f, 0.413233876f},
-std::array<float,2>{0.242982581f, 0.837418199f},
-std::array<float,2>{0.602770388f, 0.115127601f},
-std::array<float,2>{0.677057147f, 0.88126874f},
-std::array<float,2>{0.0307739731f, 0.185641587f},
-std::array<float,2>{0.47106263f, 0.717976868f},
-std::array<float,2>{0.91346997f, 0.32485351f},
-std::array<float,2>{0.550654471f, 0.648099005f},
-std::array<float,2>{0.185860187f, 0.295988053f},
-std::array<float,2>{0.299206078f, 0.972359121f},
-std::array<float,2>{0.814447522f, 0.200279608f},
-std::array<float,2>{0.965358377f, 0.764446557f},
-std::array<float,2>{0.407940894f, 0.0129007865f},
-std::array<float,2>{0.104076616f, 0.540519595f},
-std::array<float,2>{0.721840441f, 0.456962526f},
-std::array<float,2>{0.888882756f, 0.743943214f},
-std::array<float,2>{0.449706674f, 0.350603044f},
-std::array<float,2>{0.0453195423f, 0.911574602f},
-std::array<float,2>{0.638876259f, 0.132220775f},
-std::array<float,2>{0.576287627f, 0.844336987f},
-std::array<float,2>{0.213981435f, 0.0848740563f},
-std::array<float,2>{0.352298558f, 0.589256227f},
-std::array<float,2>{0.751180947f, 0.37802121f},
-std::array<float,2>{0.691205561f, 0.510680974f},
-std::array<float,2>{0.0743298233f, 0.476749986f},
-std::array<float,2>{0.395070881f, 0.808579564f},
-std::array<float,2>{0.995870709f, 0.0355316252f},
-std::array<float,2>{0.85592109f, 0.964500546f},
-std::array<float,2>{0.268211722f, 0.229959562f},
-std::array<float,2>{0.148661286f, 0.680521846f},
-std::array<float,2>{0.508633733f, 0.260853112f},
-std::array<float,2>{0.757959366f, 0.708429575f},
-std::array<float,2>{0.350104868f, 0.315264255f},
-std::array<float,2>{0.203810334f, 0.885186911f},
-std::array<float,2>{0.568317413f, 0.173015356f},
-std::array<float,2>{0.631933153f, 0.828574955f},
-std::array<float,2>{0.0326302163f, 0.119218692f},
-std::array<float,2>{0.441080958f, 0.596246541f},
-std::array<float,2>{0.882734776f, 0.418321162f},
-std::array<float,2>{0.502475142f, 0.536981046f},
-std::array<float,2>{0.143469974f, 0.465635926f},
-std::array<float,2>{0.277057618f, 0.756096363f},
-std::array<float,2>{0.844294012f, 0.00279564527f},
-std::array<float,2>{0.991222024f, 0.977721095f},
-std::array<float,2>{0.403780252f, 0.194753438f},
-std::array<float,2>{0.0629249662f, 0.654025912f},
-std::array<float,2>{0.699518919f, 0.28375271f},
-std::array<float,2>{0.915469229f, 0.579368412f},
-std::array<float,2>{0.481862724f, 0.386438519f},
-std::array<float,2>{0.0220705383f, 0.855532706f},
-std::array<float,2>{0.681047916f, 0.0874693543f},
-std::array<float,2>{0.596579731f, 0.916462302f},
-std::array<float,2>{0.240080148f, 0.138259202f},
-std::array<float,2>{0.317518413f, 0.740250587f},
-std::array<float,2>{0.79342109f, 0.358879477f},
-std::array<float,2>{0.727961898f, 0.674272656f},
-std::array<float,2>{0.0941778719f, 0.251518846f},
-std::array<float,2>{0.420404911f, 0.954203129f},
-std::array<float,2>{0.957110822f, 0.223289415f},
-std::array<float,2>{0.822116017f, 0.802058101f},
-std::array<float,2>{0.306540877f, 0.0468203239f},
-std::array<float,2>{0.175364152f, 0.502889931f},
-std::array<float,2>{0.561142087f, 0.472369999f},
-std::array<float,2>{0.867576182f, 0.530933022f},
-std::array<float,2>{0.255443454f, 0.493618816f},
-std::array<float,2>{0.135986641f, 0.784541309f},
-std::array<float,2>{0.529859483f, 0.0617456436f},
-std::array<float,2>{0.708831072f, 0.949518144f},
-std::array<float,2>{0.0935567766f, 0.240293413f},
-std::array<float,2>{0.376399398f, 0.669218957f},
-std::array<float,2>{0.975844502f, 0.267121851f},
-std::array<float,2>{0.587429941f, 0.720585704f},
-std::array<float,2>{0.192521557f, 0.363059074f},
-std::array<float,2>{0.371371686f, 0.936684787f},
-std::array<float,2>{0.777136385f, 0.146671861f},
-std::array<float,2>{0.898775816f, 0.874720156f},
-std::array<float,2>{0.454661161f, 0.0625295937f},
-std::array<float,2>{0.0469111316f, 0.577655554f},
-std::array<float,2>{0.65206635f, 0.393182456f},
-std::array<float,2>{0.9441697f, 0.638903975f},
-std::array<float,2>{0.437119454f, 0.304136992f},
-std::array<float,2>{0.115382306f, 0.993139088f},
-std::array<float,2>{0.749434471f, 0.207816526f},
-std::array<float,2>{0.531445563f, 0.76729995f},
-std::array<float,2>{0.156688794f, 0.024626676f},
-std::array<float,2>{0.285940975f, 0.550866663f},
-std::array<float,2>{0.843467176f, 0.441719413f},
-std::array<float,2>{0.659066379f, 0.610658884f},
-std::array<float,2>{0.0134220906f, 0.422065377f},
-std::array<float,2>{0.490856141f, 0.827964842f},
-std::array<float,2>{0.93043673f, 0.0998399854f},
-std::array<float,2>{0.812243223f, 0.903279901f},
-std::array<float,2>{0.335897267f, 0.162416697f},
-std::array<float,2>{0.233891219f, 0.697782278f},
-std::array<float,2>{0.618541777f, 0.33720243f},
-std::array<float,2>{0.847899258f, 0.727281809f},
-std::array<float,2>{0.279152304f, 0.37274459f},
-std::array<float,2>{0.146317869f, 0.922934234f},
-std::array<float,2>{0.505872846f, 0.151248604f},
-std::array<float,2>{0.696810544f, 0.86100477f},
-std::array<float,2>{0.0702762827f, 0.0712771639f},
-std::array<float,2>{0.40031898f, 0.566946089f},
-std::array<float,2>{0.985978067f, 0.404663086f},
-std::array<float,2>{0.564440131f, 0.519818723f},
-std::array<float,2>{0.207871616f, 0.488801211f},
-std::array<float,2>{0.344784081f, 0.794997931f},
-std::array<float,2>{0.763436735f, 0.048655428f},
-std::array<float,2>{0.875091732f, 0.942336142f},
-std::array<float,2>{0.445265621f, 0.248066857f},
-std::array<float,2>{0.0368644483f, 0.663206339f},
-std::array<float,2>{0.628349841f, 0.27839455f},
-std::array<float,2>{0.955960691f, 0.618097544f},
-std::array<float,2>{0.417414814f, 0.433882296f},
-std::array<float,2>{0.100718193f, 0.820087492f},
-std::array<float,2>{0.734239578f, 0.102753147f},
-std::array<float,2>{0.556844413f, 0.897936702f},
-std::array<float,2>{0.179235488f, 0.171804622f},
-std::array<float,2>{0.309297234f, 0.692338526f},
-std::array<float,2>{0.827803135f, 0.332879961f},
-std::array<float,2>{0.685669243f, 0.630385756f},
-std::array<float,2>{0.0178158488f, 0.305793434f},
-std::array<float,2>{0.478755653f, 0.988394499f},
-std::array<float,2>{0.921196759f, 0.216589943f},
-std::array<float,2>{0.789338529f, 0.774820566f},
-std::array<float,2>{0.313717127f, 0.0182811115f},
-std::array<float,2>{0.237632856f, 0.562330902f},
-std::array<float,2>{0.598129034f, 0.446948171f},
-std::array<float,2>{0.779781938f, 0.544389665f},
-std::array<float,2>{0.368203998f, 0.459129989f},
-std::array<float,2>{0.190939754f, 0.759514749f},
-std::array<float,2>{0.59284538f, 0.0114974165f},
-std::array<float,2>{0.654558659f, 0.975647748f},
-std::array<float,2>{0.0518362708f, 0.195958331f},
-std::array<float,2>{0.460725605f, 0.643642843f},
-std::array<float,2>{0.903606713f, 0.290098935f},
-std::array<float,2>{0.524468362f, 0.714644372f},
-std::array<float,2>{0.138492316f, 0.320438325f},
-std::array<float,2>{0.253829539f, 0.878483891f},
-std::array<float,2>{0.872443497f, 0.179914206f},
-std::array<float,2>{0.970804453f, 0.843735158f},
-std::array<float,2>{0.382578373f, 0.110227317f},
-std::array<float,2>{0.0884082764f, 0.602326453f},
-std::array<float,2>{0.706513524f, 0.406316757f},
-std::array<float,2>{0.934600055f, 0.685852885f},
-std::array<float,2>{0.486029118f, 0.261951178f},
-std::array<float,2>{0.00891278684f, 0.967131197f},
-std::array<float,2>{0.663130164f, 0.231906787f},
-std::array<float,2>{0.623014867f, 0.8087098f},
-std::array<float,2>{0.229986146f, 0.0327635631f},
-std::array<float,2>{0.330662727f, 0.514574111f},
-std::array<float,2>{0.805507004f, 0.484076887f},
-std::array<float,2>{0.743890226f, 0.591117561f},
-std::array<float,2>{0.109593272f, 0.380694747f},
-std::array<float,2>{0.43105793f, 0.851034462f},
-std::array<float,2>{0.940031886f, 0.0781746358f},
-std::array<float,2>{0.837657034f, 0.90828371f},
-std::array<float,2>{0.283419251f, 0.125546589f},
-std::array<float,2>{0.160437062f, 0.749038815f},
-std::array<float,2>{0.536328495f, 0.345260322f},
-std::array<float,2>{0.798365653f, 0.650136411f},
-std::array<float,2>{0.340215474f, 0.287417263f},
-std::array<float,2>{0.225840703f, 0.981828868f},
-std::array<float,2>{0.615153611f, 0.189036593f},
-std::array<float,2>{0.664615095f, 0.753260612f},
-std::array<float,2>{0.00582568673f, 0.00743534137f},
-std::array<float,2>{0.49491626f, 0.533838332f},
-std::array<float,2>{0.929109275f, 0.461359262f},
-std::array<float,2>{0.54349035f, 0.600625575f},
-std::array<float,2>{0.171081215f, 0.415671378f},
-std::array<float,2>{0.29660815f, 0.832064092f},
-std::array<float,2>{0.831649065f, 0.123327009f},
-std::array<float,2>{0.947036922f, 0.889277756f},
-std::array<float,2>{0.426829666f, 0.176331952f},
-std::array<float,2>{0.120801173f, 0.703851938f},
-std::array<float,2>{0.738508761f, 0.319335788f},
-std::array<float,2>{0.897199571f, 0.503926337f},
-std::array<float,2>{0.461119533f, 0.474018186f},
-std::array<float,2>{0.0561558716f, 0.798949897f},
-std::array<float,2>{0.645073473f, 0.0428620428f},
-std::array<float,2>{0.58459729f, 0.95730418f},
-std::array<float,2>{0.197752416f, 0.219524741f},
-std::array<float,2>{0.359400064f, 0.678343534f},
-std::array<float,2>{0.766000748f, 0.255896807f},
-std::array<float,2>{0.712984264f, 0.737356305f},
-std::array<float,2>{0.0857645273f, 0.353754908f},
-std::array<float,2>{0.388017982f, 0.91979152f},
-std::array<float,2>{0.982510626f, 0.132874206f},
-std::array<float,2>{0.861449778f, 0.853096962f},
-std::array<float,2>{0.265345961f, 0.0934613943f},
-std::array<float,2>{0.132032067f, 0.584077895f},
-std::array<float,2>{0.522123635f, 0.38991037f},
-std::array<float,2>{0.820037007f, 0.57126677f},
-std::array<float,2>{0.304439366f, 0.396988928f},
-std::array<float,2>{0.183476612f, 0.869940639f},
-std::array<float,2>{0.552162349f, 0.0678136051f},
-std::array<float,2>{0.72650975f, 0.932338238f},
-std::array<float,2>{0.108964249f, 0.142365977f},
-std::array<float,2>{0.413438767f, 0.72647649f},
-std::array<float,2>{0.961376965f, 0.365136683f},
-std::array<float,2>{0.60715133f, 0.667281568f},
-std::array<float,2>{0.247341111f, 0.272728473f},
-std::array<float,2>{0.324814707f, 0.946038961f},
-std::array<float,2>{0.788158476f, 0.235728711f},
-std::array<float,2>{0.907887161f, 0.786568165f},
-std::array<float,2>{0.474236757f, 0.0569557846f},
-std::array<float,2>{0.0254780017f, 0.524558902f},
-std::array<float,2>{0.675695419f, 0.498657733f},
-std::array<float,2>{0.998463094f, 0.70027411f},
-std::array<float,2>{0.393389046f, 0.34019351f},
-std::array<float,2>{0.0714750737f, 0.902012765f},
-std::array<float,2>{0.692955017f, 0.157796934f},
-std::array<float,2>{0.514718473f, 0.82312268f},
-std::array<float,2>{0.154204443f, 0.0956865698f},
-std::array<float,2>{0.271114647f, 0.614778697f},
-std::array<float,2>{0.853446484f, 0.427298099f},
-std::array<float,2>{0.634145439f, 0.549885452f},
-std::array<float,2>{0.0391101018f, 0.438769996f},
-std::array<float,2>{0.447768092f, 0.771508932f},
-std::array<float,2>{0.882953584f, 0.0307610463f},
-std::array<float,2>{0.754576623f, 0.998142898f},
-std::array<float,2>{0.357851982f, 0.206295252f},
-std::array<float,2>{0.215865672f, 0.634427249f},
-std::array<float,2>{0.57268846f, 0.29844588f},
-std::array<float,2>{0.857833922f, 0.681378841f},
-std::array<float,2>{0.267061383f, 0.260471731f},
-std::array<float,2>{0.152337208f, 0.963113546f},
-std::array<float,2>{0.510888577f, 0.229489535f},
-std::array<float,2>{0.68751055f, 0.807408869f},
-std::array<float,2>{0.0768985003f, 0.0366070569f},
-std::array<float,2>{0.39724651f, 0.510956645f},
-std::array<float,2>{0.992747843f, 0.477867186f},
-std::array<float,2>{0.576034307f, 0.588282704f},
-std::array<float,2>{0.211783901f, 0.377840817f},
-std::array<float,2>{0.354361445f, 0.845661879f},
-std::array<float,2>{0.753880799f, 0.0851877183f},
-std::array<float,2>{0.888477921f, 0.910629511f},
-std::array<float,2>{0.451457351f, 0.131741568f},
-std::array<float,2>{0.0439100266f, 0.742318928f},
-std::array<float,2>{0.637517154f, 0.350042224f},
-std::array<float,2>{0.967022002f, 0.5391137f},
-std::array<float,2>{0.409350991f, 0.455905378f},
-std::array<float,2>{0.102625184f, 0.765310943f},
-std::array<float,2>{0.720513046f, 0.0126636783f},
-std::array<float,2>{0.547804117f, 0.97115618f},
-std::array<float,2>{0.183845133f, 0.199397445f},
-std::array<float,2>{0.298567742f, 0.647449255f},
-std::array<float,2>{0.815478027f, 0.29493916f},
-std::array<float,2>{0.678477764f, 0.717757821f},
-std::array<float,2>{0.0286739636f, 0.325936228f},
-std::array<float,2>{0.468772918f, 0.882128537f},
-std::array<float,2>{0.911515355f, 0.187375635f},
-std::array<float,2>{0.782931805f, 0.836437523f},
-std::array<float,2>{0.322282344f, 0.113612056f},
-std::array<float,2>{0.244641542f, 0.609371364f},
-std::array<float,2>{0.604364932f, 0.412383258f},
-std::array<float,2>{0.770672381f, 0.622740865f},
-std::array<float,2>{0.365489572f, 0.431180835f},
-std::array<float,2>{0.201298594f, 0.813359916f},
-std::array<float,2>{0.581304193f, 0.106983088f},
-std::array<float,2>{0.6425699f, 0.89111799f},
-std::array<float,2>{0.0601477399f, 0.164483517f},
-std::array<float,2>{0.465856671f, 0.689615965f},
-std::array<float,2>{0.893940747f, 0.330765337f},
-std::array<float,2>{0.516480148f, 0.627935588f},
-std::array<float,2>{0.128300622f, 0.309729457f},
-std::array<float,2>{0.259728611f, 0.985291541f},
-std::array<float,2>{0.864172935f, 0.211149201f},
-std::array<float,2>{0.980424941f, 0.778091669f},
-std::array<float,2>{0.383931071f, 0.0197881106f},
-std::array<float,2>{0.0793633759f, 0.557562292f},
-std::array<float,2>{0.717033744f, 0.452179044f},
-std::array<float,2>{0.922916591f, 0.731567144f},
-std::array<float,2>{0.498914808f, 0.368759125f},
-std::array<float,2>{0.00245488342f, 0.926975012f},
-std::array<float,2>{0.670473397f, 0.156227395f},
-std::array<float,2>{0.612178087f, 0.867168844f},
-std::array<float,2>{0.21960707f, 0.0759289861f},
-std::array<float,2>{0.336153746f, 0.564336598f},
-std::array<float,2>{0.804136038f, 0.401915073f},
-std::array<float,2>{0.734619915f, 0.515786111f},
-std::array<float,2>{0.121228769f, 0.485464662f},
-std::array<float,2>{0.423158884f, 0.791827679f},
-std::array<float,2>{0.949746132f, 0.0530167297f},
-std::array<float,2>{0.835909247f, 0.938823938f},
-std::array<float,2>{0.292595476f, 0.243768767f},
-std::array<float,2>{0.16475673f, 0.659566939f},
-std::array<float,2>{0.541514456f, 0.275833011f},
-std::array<float,2>{0.808774889f, 0.698419273f},
-std::array<float,2>{0.332956761f, 0.33659026f},
-std::array<float,2>{0.231809482f, 0.903775394f},
-std::array<float,2>{0.620646894f, 0.163312495f},
-std::array<float,2>{0.658105433f, 0.826761961f},
-std::array<float,2>{0.0140586048f, 0.100647509f},
-std::array<float,2>{0.489983499f, 0.609518349f},
-std::array<float,2>{0.932341814f, 0.423541456f},
-std::array<float,2>{0.534412801f, 0.552308261f},
-std::array<float,2>{0.159188747f, 0.44330743f},
-std::array<float,2>{0.287943989f, 0.766230702f},
-std::array<float,2>{0.840757549f, 0.0237096008f},
-std::array<float,2>{0.941713154f, 0.993749082f},
-std::array<float,2>{0.433903456f, 0.208795428f},
-std::array<float,2>{0.11438702f, 0.639988601f},
-std::array<float,2>{0.746381223f, 0.30279386f},
-std::array<float,2>{0.900420249f, 0.576200366f},
-std::array<float,2>{0.455389082f, 0.393616825f},
-std::array<float,2>{0.0504968837f, 0.873920441f},
-std::array<float,2>{0.649440885f, 0.0637308955f},
-std::array<float,2>{0.58808583f, 0.936428368f},
-std::array<float,2>{0.194598213f, 0.147851244f},
-std::array<float,2>{0.373743951f, 0.719559133f},
-std::array<float,2>{0.774790704f, 0.362246782f},
-std::array<float,2>{0.710108936f, 0.668590963f},
-std::array<float,2>{0.0910522714f, 0.266591847f},
-std::array<float,2>{0.377580494f, 0.950635493f},
-std::array<float,2>{0.973492861f, 0.2420329f},
-std::array<float,2>{0.870485306f, 0.783640206f},
-std::array<float,2>{0.255933732f, 0.0610606f},
-std::array<float,2>{0.134443596f, 0.529686689f},
-std::array<float,2>{0.52785486f, 0.493143678f},
-std::array<float,2>{0.822510779f, 0.503760219f},
-std::array<float,2>{0.307379007f, 0.470919669f},
-std::array<float,2>{0.172618851f, 0.801221132f},
-std::array<float,2>{0.55903548f, 0.0451956727f},
-std::array<float,2>{0.730253041f, 0.953867733f},
-std::array<float,2>{0.0964422747f, 0.224497721f},
-std::array<float,2>{0.418700635f, 0.675353825f},
-std::array<float,2>{0.959967315f, 0.250972003f},
-std::array<float,2>{0.594036222f, 0.74141866f},
-std::array<float,2>{0.240442991f, 0.357786804f},
-std::array<float,2>{0.319008559f, 0.917226672f},
-std::array<float,2>{0.796510756f, 0.13684833f},
-std::array<float,2>{0.917182982f, 0.857139468f},
-std::array<float,2>{0.483018279f, 0.0860033408f},
-std::array<float,2>{0.0207057055f, 0.578368366f},
-std::array<float,2>{0.681856394f, 0.384801626f},
-std::array<float,2>{0.990112007f, 0.653024316f},
-std::array<float,2>{0.405605584f, 0.284208715f},
-std::array<float,2>{0.0662947968f, 0.976947665f},
-std::array<float,2>{0.702204823f, 0.193849787f},
-std::array<float,2>{0.501410961f, 0.757811129f},
-std::array<float,2>{0.141115665f, 0.00321919704f},
-std::array<float,2>{0.273754716f, 0.535405219f},
-std::array<float,2>{0.84652245f, 0.466345549f},
-std::array<float,2>{0.629729331f, 0.597093105f},
-std::array<float,2>{0.0332870074f, 0.419841349f},
-std::array<float,2>{0.437815279f, 0.829846144f},
-std::array<float,2>{0.880057573f, 0.120904416f},
-std::array<float,2>{0.760646105f, 0.886166275f},
-std::array<float,2>{0.349104911f, 0.172778875f},
-std::array<float,2>{0.206094325f, 0.707244575f},
-std::array<float,2>{0.570036471f, 0.315891832f},
-std::array<float,2>{0.838415861f, 0.748329341f},
-std::array<float,2>{0.281612575f, 0.344544709f},
-std::array<float,2>{0.164031863f, 0.909595966f},
-std::array<float,2>{0.538213074f, 0.126357377f},
-std::array<float,2>{0.745271087f, 0.8497172f},
-std::array<float,2>{0.112564124f, 0.0800377503f},
-std::array<float,2>{0.431856513f, 0.589985907f},
-std::array<float,2>{0.938726366f, 0.379510909f},
-std::array<float,2>{0.623655856f, 0.51528281f},
-std::array<float,2>{0.227005839f, 0.483381212f},
-std::array<float,2>{0.328582525f, 0.810445309f},
-std::array<float,2>{0.806981564f, 0.0321263783f},
-std::array<float,2>{0.936325014f, 0.968666732f},
-std::array<float,2>{0.488246262f, 0.230716363f},
-std::array<float,2>{0.0103125498f, 0.687457144f},
-std::array<float,2>{0.660574079f, 0.263187796f},
-std::array<float,2>{0.969014645f, 0.602610052f},
-std::array<float,2>{0.379112333f, 0.407356769f},
-std::array<float,2>{0.0869058296f, 0.842361093f},
-std::array<float,2>{0.703897238f, 0.110353805f},
-std::array<float,2>{0.526075721f, 0.877130449f},
-std::array<float,2>{0.139692158f, 0.181083515f},
-std::array<float,2>{0.250168562f, 0.713276803f},
-std::array<float,2>{0.874835372f, 0.32182315f},
-std::array<float,2>{0.653368413f, 0.643179238f},
-std::array<float,2>{0.0538930036f, 0.289187104f},
-std::array<float,2>{0.457062602f, 0.975371301f},
-std::array<float,2>{0.906148553f, 0.196841359f},
-std::array<float,2>{0.778431773f, 0.758225858f},
-std::array<float,2>{0.37032935f, 0.0101056583f},
-std::array<float,2>{0.188899994f, 0.54393214f},
-std::array<float,2>{0.589949012f, 0.460252941f},
-std::array<float,2>{0.792603612f, 0.561074436f},
-std::array<float,2>{0.315378457f, 0.446288943f},
-std::array<float,2>{0.235331103f, 0.774125993f},
-std::array<float,2>{0.600267351f, 0.0194567181f},
-std::array<float,2>{0.683967054f, 0.990175009f},
-std::array<float,2>{0.0170792639f, 0.215582907f},
-std::array<float,2>{0.477221817f, 0.629164875f},
-std::array<float,2>{0.91974026f, 0.305461556f},
-std::array<float,2>{0.556492507f, 0.692417264f},
-std::array<float,2>{0.176184371f, 0.333149225f},
-std::array<float,2>{0.310897648f, 0.897449851f},
-std::array<float,2>{0.825069129f, 0.170231178f},
-std::array<float,2>{0.953890145f, 0.81836462f},
-std::array<float,2>{0.415871888f, 0.102343448f},
-std::array<float,2>{0.0979628637f, 0.619120121f},
-std::array<float,2>{0.732049823f, 0.434709132f},
-std::array<float,2>{0.878414035f, 0.662501991f},
-std::array<float,2>{0.443248183f, 0.277995735f},
-std::array<float,2>{0.037437737f, 0.942800879f},
-std::array<float,2>{0.626724958f, 0.249399349f},
-std::array<float,2>{0.565156102f, 0.79590404f},
-std::array<float,2>{0.208991185f, 0.046924036f},
-std::array<float,2>{0.345951855f, 0.520873845f},
-std::array<float,2>{0.765589058f, 0.48976621f},
-std::array<float,2>{0.698726952f, 0.567739129f},
-std::array<float,2>{0.0665696487f, 0.405295193f},
-std::array<float,2>{0.401745915f, 0.859607697f},
-std::array<float,2>{0.98805064f, 0.072161518f},
-std::array<float,2>{0.851057827f, 0.92249316f},
-std::array<float,2>{0.280090928f, 0.151529878f},
-std::array<float,2>{0.147601858f, 0.728415072f},
-std::array<float,2>{0.504778981f, 0.371327549f},
-std::array<float,2>{0.757459819f, 0.633674324f},
-std::array<float,2>{0.356266856f, 0.297509938f},
-std::array<float,2>{0.218231812f, 0.999972463f},
-std::array<float,2>{0.572165489f, 0.205954373f},
-std::array<float,2>{0.63611269f, 0.772676647f},
-std::array<float,2>{0.0412681736f, 0.0297173709f},
-std::array<float,2>{0.446171701f, 0.549229681f},
-std::array<float,2>{0.885977089f, 0.438258141f},
-std::array<float,2>{0.513543665f, 0.613723993f},
-std::array<float,2>{0.154442102f, 0.426461101f},
-std::array<float,2>{0.272836804f, 0.823616683f},
-std::array<float,2>{0.853874922f, 0.094676286f},
-std::array<float,2>{0.997956753f, 0.90063554f},
-std::array<float,2>{0.392159849f, 0.156875432f},
-std::array<float,2>{0.0738663748f, 0.700077295f},
-std::array<float,2>{0.693462074f, 0.341273934f},
-std::array<float,2>{0.908878565f, 0.524214327f},
-std::array<float,2>{0.474731237f, 0.499975145f},
-std::array<float,2>{0.0243701972f, 0.78612268f},
-std::array<float,2>{0.673707247f, 0.0578498878f},
-std::array<float,2>{0.607924581f, 0.947207928f},
-std::array<float,2>{0.248663217f, 0.234843254f},
-std::array<float,2>{0.328062922f, 0.666244507f},
-std::array<float,2>{0.785754919f, 0.272361845f},
-std::array<float,2>{0.724592745f, 0.724880934f},
-std::array<float,2>{0.106266275f, 0.36393258f},
-std::array<float,2>{0.411479115f, 0.932883739f},
-std::array<float,2>{0.964460254f, 0.141419157f},
-std::array<float,2>{0.818217099f, 0.870357752f},
-std::array<float,2>{0.301044911f, 0.0668027475f},
-std::array<float,2>{0.180722579f, 0.571896076f},
-std::array<float,2>{0.553599536f, 0.398043215f},
-std::array<float,2>{0.860141516f, 0.585236311f},
-std::array<float,2>{0.262396246f, 0.388842881f},
-std::array<float,2>{0.130180106f, 0.85201329f},
-std::array<float,2>{0.519616067f, 0.0924411342f},
-std::array<float,2>{0.711737752f, 0.9180547f},
-std::array<float,2>{0.0833390877f, 0.133983806f},
-std::array<float,2>{0.389352024f, 0.736574769f},
-std::array<float,2>{0.981379092f, 0.355116099f},
-std::array<float,2>{0.583117962f, 0.679058075f},
-std::array<float,2>{0.196573645f, 0.256963164f},
-std::array<float,2>{0.36254549f, 0.958158433f},
-std::array<float,2>{0.768067896f, 0.219984472f},
-std::array<float,2>{0.895568728f, 0.799897254f},
-std::array<float,2>{0.464695334f, 0.0411781184f},
-std::array<float,2>{0.0585525893f, 0.505605459f},
-std::array<float,2>{0.647001565f, 0.472846836f},
-std::array<float,2>{0.948474526f, 0.704831719f},
-std::array<float,2>{0.427985251f, 0.320157498f},
-std::array<float,2>{0.118452571f, 0.890548944f},
-std::array<float,2>{0.742166281f, 0.176860675f},
-std::array<float,2>{0.54526633f, 0.833777487f},
-std::array<float,2>{0.168218628f, 0.12474487f},
-std::array<float,2>{0.293474615f, 0.600093067f},
-std::array<float,2>{0.829741478f, 0.414404482f},
-std::array<float,2>{0.666364431f, 0.53465569f},
-std::array<float,2>{0.00624816911f, 0.461915642f},
-std::array<float,2>{0.492348611f, 0.752368212f},
-std::array<float,2>{0.927425563f, 0.00631316751f},
-std::array<float,2>{0.799853981f, 0.981427133f},
-std::array<float,2>{0.341990858f, 0.187640205f},
-std::array<float,2>{0.223609358f, 0.649186909f},
-std::array<float,2>{0.615743399f, 0.288298875f},
-std::array<float,2>{0.813257277f, 0.644569814f},
-std::array<float,2>{0.30041486f, 0.294864058f},
-std::array<float,2>{0.186737508f, 0.969289362f},
-std::array<float,2>{0.549156845f, 0.201649964f},
-std::array<float,2>{0.721299231f, 0.76287514f},
-std::array<float,2>{0.104696862f, 0.0138259437f},
-std::array<float,2>{0.406634331f, 0.541691244f},
-std::array<float,2>{0.966746747f, 0.454811186f},
-std::array<float,2>{0.601691663f, 0.606790245f},
-std::array<float,2>{0.243805408f, 0.411659956f},
-std::array<float,2>{0.322186798f, 0.839254081f},
-std::array<float,2>{0.783432364f, 0.116806448f},
-std::array<float,2>{0.912672222f, 0.879630625f},
-std::array<float,2>{0.471743524f, 0.184480041f},
-std::array<float,2>{0.0296819117f, 0.715497017f},
-std::array<float,2>{0.67664367f, 0.327489883f},
-std::array<float,2>{0.994696558f, 0.50810045f},
-std::array<float,2>{0.396384478f, 0.479305327f},
-std::array<float,2>{0.0754314363f, 0.806502998f},
-std::array<float,2>{0.689951241f, 0.0376461707f},
-std::array<float,2>{0.508825362f, 0.96184957f},
-std::array<float,2>{0.150114328f, 0.227980345f},
-std::array<float,2>{0.269369632f, 0.682538211f},
-std::array<float,2>{0.856767058f, 0.259466171f},
-std::array<float,2>{0.640308976f, 0.744891047f},
-std::array<float,2>{0.0464268103f, 0.349109471f},
-std::array<float,2>{0.450775355f, 0.912410676f},
-std::array<float,2>{0.889665306f, 0.129428968f},
-std::array<float,2>{0.750132084f, 0.846919119f},
-std::array<float,2>{0.352935523f, 0.0825035572f},
-std::array<float,2>{0.213347673f, 0.586757541f},
-std::array<float,2>{0.577293396f, 0.376176983f},
-std::array<float,2>{0.802434087f, 0.565633655f},
-std::array<float,2>{0.339200556f, 0.399608999f},
-std::array<float,2>{0.221710011f, 0.864730656f},
-std::array<float,2>{0.609954715f, 0.0766503438f},
-std::array<float,2>{0.669636548f, 0.928856313f},
-std::array<float,2>{0.000386828004f, 0.15331836f},
-std::array<float,2>{0.497866243f, 0.733666956f},
-std::array<float,2>{0.924150467f, 0.369707316f},
-std::array<float,2>{0.539502203f, 0.657484055f},
-std::array<float,2>{0.166594297f, 0.274263591f},
-std::array<float,2>{0.289934009f, 0.939551055f},
-std::array<float,2>{0.832943857f, 0.245572358f},
-std::array<float,2>{0.952257454f, 0.789283872f},
-std::array<float,2>{0.424610108f, 0.0525613874f},
-std::array<float,2>{0.123516142f, 0.51935792f},
-std::array<float,2>{0.738196909f, 0.487548321f},
-std::array<float,2>{0.892460942f, 0.688982606f},
-std::array<float,2>{0.466798365f, 0.329416454f},
-std::array<float,2>{0.061994683f, 0.894296587f},
-std::array<float,2>{0.644378006f, 0.166546211f},
-std::array<float,2>{0.579831541f, 0.815826416f},
-std::array<float,2>{0.200639158f, 0.107921191f},
-std::array<float,2>{0.364070266f, 0.623246253f},
-std::array<float,2>{0.772626162f, 0.431782842f},
-std::array<float,2>{0.715754271f, 0.556042731f},
-std::array<float,2>{0.0808342099f, 0.450363159f},
-std::array<float,2>{0.38640371f, 0.780764222f},
-std::array<float,2>{0.977299213f, 0.0225456133f},
-std::array<float,2>{0.865462124f, 0.987654924f},
-std::array<float,2>{0.261175811f, 0.213329539f},
-std::array<float,2>{0.125828236f, 0.625810862f},
-std::array<float,2>{0.51806438f, 0.311825961f},
-std::array<float,2>{0.775701463f, 0.721363664f},
-std::array<float,2>{0.372718513f, 0.3598997f},
-std::array<float,2>{0.19189699f, 0.934336662f},
-std::array<float,2>{0.586084366f, 0.145701319f},
-std::array<float,2>{0.651269794f, 0.872186244f},
-std::array<float,2>{0.0486557744f, 0.0649981052f},
-std::array<float,2>{0.453372359f, 0.575297177f},
-std::array<float,2>{0.899516225f, 0.390945911f},
-std::array<float,2>{0.530824184f, 0.528455913f},
-std::array<float,2>{0.134912595f, 0.495094746f},
-std::array<float,2>{0.254880339f, 0.782701015f},
-std::array<float,2>{0.869017065f, 0.0604900941f},
-std::array<float,2>{0.97556752f, 0.952764273f},
-std::array<float,2>{0.375540167f, 0.239756927f},
-std::array<float,2>{0.0923784152f, 0.670210481f},
-std::array<float,2>{0.707814753f, 0.268777609f},
-std::array<float,2>{0.931427896f, 0.612251699f},
-std::array<float,2>{0.49206388f, 0.425740242f},
-std::array<float,2>{0.0125408312f, 0.824617505f},
-std::array<float,2>{0.659524798f, 0.0988248214f},
-std::array<float,2>{0.617722392f, 0.904331982f},
-std::array<float,2>{0.232891276f, 0.161318108f},
-std::array<float,2>{0.334560007f, 0.696590245f},
-std::array<float,2>{0.810913444f, 0.337970257f},
-std::array<float,2>{0.748091161f, 0.638440728f},
-std::array<float,2>{0.116989888f, 0.30141905f},
-std::array<float,2>{0.435884058f, 0.994827628f},
-std::array<float,2>{0.944967568f, 0.210122615f},
-std::array<float,2>{0.84209168f, 0.769383073f},
-std::array<float,2>{0.287029237f, 0.0267374385f},
-std::array<float,2>{0.157632008f, 0.554222107f},
-std::array<float,2>{0.532379508f, 0.444186479f},
-std::array<float,2>{0.845418274f, 0.538383007f},
-std::array<float,2>{0.275489837f, 0.468098789f},
-std::array<float,2>{0.144056424f, 0.755128741f},
-std::array<float,2>{0.503574073f, 0.00139587885f},
-std::array<float,2>{0.700216353f, 0.979102373f},
-std::array<float,2>{0.0639760271f, 0.192244038f},
-std::array<float,2>{0.402947217f, 0.65474391f},
-std::array<float,2>{0.990760624f, 0.281772196f},
-std::array<float,2>{0.566817462f, 0.709341645f},
-std::array<float,2>{0.204248965f, 0.313635081f},
-std::array<float,2>{0.350787044f, 0.883332491f},
-std::array<float,2>{0.759339452f, 0.174577221f},
-std::array<float,2>{0.880861878f, 0.831917703f},
-std::array<float,2>{0.440319866f, 0.118150353f},
-std::array<float,2>{0.0320818834f, 0.59427768f},
-std::array<float,2>{0.630997956f, 0.420442462f},
-std::array<float,2>{0.95847249f, 0.673045039f},
-std::array<float,2>{0.42176342f, 0.252675861f},
-std::array<float,2>{0.0949473828f, 0.956763506f},
-std::array<float,2>{0.726887465f, 0.224877596f},
-std::array<float,2>{0.56191504f, 0.803623021f},
-std::array<float,2>{0.174476162f, 0.043817617f},
-std::array<float,2>{0.305556536f, 0.500766695f},
-std::array<float,2>{0.820735157f, 0.469382137f},
-std::array<float,2>{0.67992878f, 0.581602573f},
-std::array<float,2>{0.0232717656f, 0.383790076f},
-std::array<float,2>{0.480769962f, 0.857571542f},
-std::array<float,2>{0.914403498f, 0.087960586f},
-std::array<float,2>{0.793946087f, 0.915807068f},
-std::array<float,2>{0.316596419f, 0.140182316f},
-std::array<float,2>{0.238982216f, 0.738857448f},
-std::array<float,2>{0.597559929f, 0.356426775f},
-std::array<float,2>{0.871274769f, 0.712386608f},
-std::array<float,2>{0.252293974f, 0.322435915f},
-std::array<float,2>{0.137580439f, 0.875778139f},
-std::array<float,2>{0.523559451f, 0.183187008f},
-std::array<float,2>{0.705568969f, 0.841107488f},
-std::array<float,2>{0.0892809778f, 0.11188665f},
-std::array<float,2>{0.381159216f, 0.605080068f},
-std::array<float,2>{0.97202301f, 0.409576833f},
-std::array<float,2>{0.592566907f, 0.546076298f},
-std::array<float,2>{0.189681023f, 0.458448052f},
-std::array<float,2>{0.367433161f, 0.760855675f},
-std::array<float,2>{0.780936062f, 0.00874179229f},
-std::array<float,2>{0.902870536f, 0.972913623f},
-std::array<float,2>{0.459549695f, 0.198829502f},
-std::array<float,2>{0.0508675762f, 0.641837597f},
-std::array<float,2>{0.655441761f, 0.291707009f},
-std::array<float,2>{0.941309154f, 0.592674255f},
-std::array<float,2>{0.430391908f, 0.382021189f},
-std::array<float,2>{0.110873029f, 0.847963274f},
-std::array<float,2>{0.742793381f, 0.081302084f},
-std::array<float,2>{0.536063671f, 0.906560302f},
-std::array<float,2>{0.161481231f, 0.128273785f},
-std::array<float,2>{0.284691066f, 0.747847557f},
-std::array<float,2>{0.836159766f, 0.346523523f},
-std::array<float,2>{0.662222087f, 0.684442878f},
-std::array<float,2>{0.00816268101f, 0.264987379f},
-std::array<float,2>{0.484450191f, 0.965727866f},
-std::array<float,2>{0.934123695f, 0.233432651f},
-std::array<float,2>{0.80640167f, 0.811645806f},
-std::array<float,2>{0.331339896f, 0.0345161632f},
-std::array<float,2>{0.228572339f, 0.512710571f},
-std::array<float,2>{0.621376038f, 0.481348127f},
-std::array<float,2>{0.762528777f, 0.522435784f},
-std::array<float,2>{0.343903303f, 0.491797179f},
-std::array<float,2>{0.208931878f, 0.793745279f},
-std::array<float,2>{0.563446462f, 0.0504814014f},
-std::array<float,2>{0.627051473f, 0.94446671f},
-std::array<float,2>{0.0358855464f, 0.246596113f},
-std::array<float,2>{0.443651438f, 0.661336064f},
-std::array<float,2>{0.876051784f, 0.279511273f},
-std::array<float,2>{0.50719434f, 0.729651332f},
-std::array<float,2>{0.144815892f, 0.374054611f},
-std::array<float,2>{0.278176337f, 0.925404012f},
-std::array<float,2>{0.849080086f, 0.150377139f},
-std::array<float,2>{0.984405816f, 0.862473786f},
-std::array<float,2>{0.398860037f, 0.0727480724f},
-std::array<float,2>{0.0692583025f, 0.569936156f},
-std::array<float,2>{0.695387781f, 0.403669089f},
-std::array<float,2>{0.920688808f, 0.631832778f},
-std::array<float,2>{0.479936004f, 0.306854159f},
-std::array<float,2>{0.0187810194f, 0.991485417f},
-std::array<float,2>{0.686680317f, 0.218410715f},
-std::array<float,2>{0.599545538f, 0.776820958f},
-std::array<float,2>{0.236606359f, 0.0160147529f},
-std::array<float,2>{0.31340909f, 0.560034931f},
-std::array<float,2>{0.790435851f, 0.447430223f},
-std::array<float,2>{0.733172357f, 0.620018423f},
-std::array<float,2>{0.100546546f, 0.437174618f},
-std::array<float,2>{0.416415155f, 0.817219734f},
-std::array<float,2>{0.95619601f, 0.105204187f},
-std::array<float,2>{0.827101707f, 0.895766199f},
-std::array<float,2>{0.309691548f, 0.168619573f},
-std::array<float,2>{0.177909151f, 0.695143878f},
-std::array<float,2>{0.557834148f, 0.335907012f},
-std::array<float,2>{0.787615955f, 0.664160192f},
-std::array<float,2>{0.325364918f, 0.27060616f},
-std::array<float,2>{0.246574178f, 0.948265254f},
-std::array<float,2>{0.605500042f, 0.236765474f},
-std::array<float,2>{0.674053133f, 0.787454009f},
-std::array<float,2>{0.0266676154f, 0.0551254675f},
-std::array<float,2>{0.473626554f, 0.526161015f},
-std::array<float,2>{0.906408906f, 0.4978275f},
-std::array<float,2>{0.551255763f, 0.572371304f},
-std::array<float,2>{0.182272747f, 0.395259202f},
-std::array<float,2>{0.302834302f, 0.8679685f},
-std::array<float,2>{0.819174707f, 0.0700105429f},
-std::array<float,2>{0.962210178f, 0.931127906f},
-std::array<float,2>{0.412266523f, 0.144451752f},
-std::array<float,2>{0.107607692f, 0.722752154f},
-std::array<float,2>{0.725445151f, 0.365828961f},
-std::array<float,2>{0.884187818f, 0.547256827f},
-std::array<float,2>{0.44883576f, 0.439501792f},
-std::array<float,2>{0.040138118f, 0.769882917f},
-std::array<float,2>{0.633451343f, 0.0284416247f},
-std::array<float,2>{0.573578656f, 0.997762501f},
-std::array<float,2>{0.215804324f, 0.203323826f},
-std::array<float,2>{0.359324276f, 0.63646239f},
-std::array<float,2>{0.755606532f, 0.29941833f},
-std::array<float,2>{0.692131698f, 0.702370346f},
-std::array<float,2>{0.0709777251f, 0.342128545f},
-std::array<float,2>{0.393665135f, 0.899111748f},
-std::array<float,2>{0.999416351f, 0.158820003f},
-std::array<float,2>{0.852503359f, 0.821788907f},
-std::array<float,2>{0.26968655f, 0.0961715057f},
-std::array<float,2>{0.152948156f, 0.615940869f},
-std::array<float,2>{0.513744771f, 0.429132372f},
-std::array<float,2>{0.830881417f, 0.599353492f},
-std::array<float,2>{0.295823961f, 0.41676119f},
-std::array<float,2>{0.170081347f, 0.834967732f},
-std::array<float,2>{0.544917881f, 0.122473463f},
-std::array<float,2>{0.739752054f, 0.887970448f},
-std::array<float,2>{0.119705439f, 0.177794367f},
-std::array<float,2>{0.426519871f, 0.706400275f},
-std::array<float,2>{0.945751667f, 0.317561954f},
-std::array<float,2>{0.613525271f, 0.650634408f},
-std::array<float,2>{0.224816412f, 0.286424756f},
-std::array<float,2>{0.341549277f, 0.983643353f},
-std::array<float,2>{0.796942592f, 0.191038594f},
-std::array<float,2>{0.92784816f, 0.750355482f},
-std::array<float,2>{0.495252013f, 0.00517734885f},
-std::array<float,2>{0.00460957363f, 0.532902539f},
-std::array<float,2>{0.665625334f, 0.463536918f},
-std::array<float,2>{0.983534753f, 0.735625505f},
-std::array<float,2>{0.387150407f, 0.353193074f},
-std::array<float,2>{0.0840188712f, 0.921316683f},
-std::array<float,2>{0.713895559f, 0.136272505f},
-std::array<float,2>{0.522908986f, 0.854221225f},
-std::array<float,2>{0.131391034f, 0.0915082693f},
-std::array<float,2>{0.264327317f, 0.583382308f},
-std::array<float,2>{0.862325013f, 0.388646901f},
-std::array<float,2>{0.646385789f, 0.507205486f},
-std::array<float,2>{0.0553192943f, 0.474924862f},
-std::array<float,2>{0.462867409f, 0.798690975f},
-std::array<float,2>{0.898279011f, 0.0399214551f},
-std::array<float,2>{0.767570615f, 0.959688485f},
-std::array<float,2>{0.360580802f, 0.222146839f},
-std::array<float,2>{0.198256791f, 0.676716208f},
-std::array<float,2>{0.585487247f, 0.255269349f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.440784633f, 0.142793506f},
-std::array<float,2>{0.96014756f, 0.902362347f},
-std::array<float,2>{0.0298999585f, 0.712469339f},
-std::array<float,2>{0.668692172f, 0.490500867f},
-std::array<float,2>{0.145445988f, 0.343908608f},
-std::array<float,2>{0.512542248f, 0.506893396f},
-std::array<float,2>{0.260783523f, 0.824147165f},
-std::array<float,2>{0.777928352f, 0.105546735f},
-std::array<float,2>{0.31850493f, 0.401387781f},
-std::array<float,2>{0.845494092f, 0.645090997f},
-std::array<float,2>{0.244408861f, 0.94274056f},
-std::array<float,2>{0.566425979f, 0.199806288f},
-std::array<float,2>{0.11773064f, 0.016880922f},
-std::array<float,2>{0.707161188f, 0.764688075f},
-std::array<float,2>{0.391683072f, 0.598665595f},
-std::array<float,2>{0.916965783f, 0.279197991f},
-std::array<float,2>{0.309289813f, 0.0630677491f},
-std::array<float,2>{0.792155504f, 0.870677292f},
-std::array<float,2>{0.170797035f, 0.561700284f},
-std::array<float,2>{0.555003703f, 0.331427723f},
-std::array<float,2>{0.0393285565f, 0.466808558f},
-std::array<float,2>{0.631762445f, 0.732236564f},
-std::array<float,2>{0.48550567f, 0.909168184f},
-std::array<float,2>{0.969239295f, 0.161761358f},
-std::array<float,2>{0.418309718f, 0.300162554f},
-std::array<float,2>{0.903139889f, 0.568024993f},
-std::array<float,2>{0.0671986043f, 0.811137497f},
-std::array<float,2>{0.741388917f, 0.0437794179f},
-std::array<float,2>{0.190326154f, 0.226612732f},
-std::array<float,2>{0.616275132f, 0.99359268f},
-std::array<float,2>{0.362275064f, 0.683457494f},
-std::array<float,2>{0.824827492f, 0.432460904f},
-std::array<float,2>{0.377206475f, 0.0482079834f},
-std::array<float,2>{0.934936404f, 0.792226851f},
-std::array<float,2>{0.0977991149f, 0.593361557f},
-std::array<float,2>{0.69194752f, 0.282779038f},
-std::array<float,2>{0.223685712f, 0.411097467f},
-std::array<float,2>{0.592216074f, 0.661668003f},
-std::array<float,2>{0.329426438f, 0.9702667f},
-std::array<float,2>{0.874603748f, 0.247326091f},
-std::array<float,2>{0.268722028f, 0.326283187f},
-std::array<float,2>{0.763296962f, 0.538484275f},
-std::array<float,2>{0.125790849f, 0.859074295f},
-std::array<float,2>{0.524525642f, 0.0812167153f},
-std::array<float,2>{0.00123643107f, 0.184189841f},
-std::array<float,2>{0.686261892f, 0.937293172f},
-std::array<float,2>{0.458272994f, 0.734566152f},
-std::array<float,2>{0.937701166f, 0.440961003f},
-std::array<float,2>{0.350257337f, 0.217559159f},
-std::array<float,2>{0.830229044f, 0.967964172f},
-std::array<float,2>{0.208619341f, 0.640130341f},
-std::array<float,2>{0.607496917f, 0.383295685f},
-std::array<float,2>{0.0873716399f, 0.253381193f},
-std::array<float,2>{0.721781731f, 0.621788144f},
-std::array<float,2>{0.424108028f, 0.768395185f},
-std::array<float,2>{0.886072099f, 0.00530903833f},
-std::array<float,2>{0.481266558f, 0.479388297f},
-std::array<float,2>{0.992518961f, 0.689009845f},
-std::array<float,2>{0.0530673899f, 0.880918443f},
-std::array<float,2>{0.643357456f, 0.138473645f},
-std::array<float,2>{0.182835847f, 0.112156272f},
-std::array<float,2>{0.532990217f, 0.841240227f},
-std::array<float,2>{0.296666592f, 0.521219254f},
-std::array<float,2>{0.802163541f, 0.368420482f},
-std::array<float,2>{0.436271638f, 0.238766104f},
-std::array<float,2>{0.879693091f, 0.9843539f},
-std::array<float,2>{0.0810416117f, 0.665439129f},
-std::array<float,2>{0.729962528f, 0.417683452f},
-std::array<float,2>{0.214750439f, 0.291679651f},
-std::array<float,2>{0.595756054f, 0.582407236f},
-std::array<float,2>{0.352246404f, 0.782109201f},
-std::array<float,2>{0.838335633f, 0.0555926822f},
-std::array<float,2>{0.283135921f, 0.446015924f},
-std::array<float,2>{0.811017871f, 0.744996369f},
-std::array<float,2>{0.176497355f, 0.923003256f},
-std::array<float,2>{0.540752411f, 0.172960356f},
-std::array<float,2>{0.0623408705f, 0.0865196437f},
-std::array<float,2>{0.654640496f, 0.846286416f},
-std::array<float,2>{0.471321017f, 0.546318948f},
-std::array<float,2>{0.986025333f, 0.319874257f},
-std::array<float,2>{0.3378115f, 0.0145023232f},
-std::array<float,2>{0.860770166f, 0.776312411f},
-std::array<float,2>{0.23164542f, 0.611963511f},
-std::array<float,2>{0.583561182f, 0.259207994f},
-std::array<float,2>{0.107768059f, 0.378924519f},
-std::array<float,2>{0.699724555f, 0.628522813f},
-std::array<float,2>{0.389043868f, 0.957408667f},
-std::array<float,2>{0.921894848f, 0.203663364f},
-std::array<float,2>{0.463750988f, 0.364230454f},
-std::array<float,2>{0.946726918f, 0.524839044f},
-std::array<float,2>{0.0102184173f, 0.829774678f},
-std::array<float,2>{0.674905777f, 0.120881014f},
-std::array<float,2>{0.13372992f, 0.130058512f},
-std::array<float,2>{0.516884625f, 0.88708204f},
-std::array<float,2>{0.273600042f, 0.69757247f},
-std::array<float,2>{0.753511429f, 0.473448426f},
-std::array<float,2>{0.492954582f, 0.0987233371f},
-std::array<float,2>{0.979052544f, 0.818186581f},
-std::array<float,2>{0.0378982052f, 0.508318424f},
-std::array<float,2>{0.634766042f, 0.357798606f},
-std::array<float,2>{0.16087845f, 0.493382245f},
-std::array<float,2>{0.552413583f, 0.709066749f},
-std::array<float,2>{0.303154051f, 0.89283967f},
-std::array<float,2>{0.785076857f, 0.153623477f},
-std::array<float,2>{0.373709679f, 0.272832781f},
-std::array<float,2>{0.819987118f, 0.609098077f},
-std::array<float,2>{0.199013457f, 0.750181675f},
-std::array<float,2>{0.622214615f, 0.0261447448f},
-std::array<float,2>{0.0774567127f, 0.190316305f},
-std::array<float,2>{0.749656916f, 0.950086951f},
-std::array<float,2>{0.406456202f, 0.650108337f},
-std::array<float,2>{0.897460818f, 0.396991938f},
-std::array<float,2>{0.251362354f, 0.167281881f},
-std::array<float,2>{0.767816722f, 0.92025727f},
-std::array<float,2>{0.155808404f, 0.72556442f},
-std::array<float,2>{0.504757285f, 0.458090216f},
-std::array<float,2>{0.020633176f, 0.339729786f},
-std::array<float,2>{0.657495201f, 0.54769361f},
-std::array<float,2>{0.447440654f, 0.863567412f},
-std::array<float,2>{0.964188457f, 0.0767867789f},
-std::array<float,2>{0.405034781f, 0.423049062f},
-std::array<float,2>{0.911905766f, 0.67808187f},
-std::array<float,2>{0.10979446f, 0.987138987f},
-std::array<float,2>{0.717873394f, 0.222085014f},
-std::array<float,2>{0.239451677f, 0.0319234058f},
-std::array<float,2>{0.573309183f, 0.798624337f},
-std::array<float,2>{0.327719808f, 0.572954476f},
-std::array<float,2>{0.858605325f, 0.311570466f},
-std::array<float,2>{0.473776698f, 0.196504712f},
-std::array<float,2>{0.988472402f, 0.938458622f},
-std::array<float,2>{0.0547230579f, 0.643637657f},
-std::array<float,2>{0.651245832f, 0.40606302f},
-std::array<float,2>{0.172571629f, 0.275359929f},
-std::array<float,2>{0.544277251f, 0.595121443f},
-std::array<float,2>{0.28885299f, 0.761390567f},
-std::array<float,2>{0.808439136f, 0.0201688763f},
-std::array<float,2>{0.357489645f, 0.486027002f},
-std::array<float,2>{0.840217173f, 0.71806109f},
-std::array<float,2>{0.215012565f, 0.900785089f},
-std::array<float,2>{0.598871648f, 0.146970823f},
-std::array<float,2>{0.0829776675f, 0.105404601f},
-std::array<float,2>{0.731068432f, 0.825417519f},
-std::array<float,2>{0.43139112f, 0.502377987f},
-std::array<float,2>{0.878687024f, 0.349538624f},
-std::array<float,2>{0.279065251f, 0.0421494283f},
-std::array<float,2>{0.757101715f, 0.80534631f},
-std::array<float,2>{0.139575645f, 0.56337893f},
-std::array<float,2>{0.522495508f, 0.300974399f},
-std::array<float,2>{0.0118084401f, 0.43446964f},
-std::array<float,2>{0.679540634f, 0.685414493f},
-std::array<float,2>{0.466659099f, 0.998376667f},
-std::array<float,2>{0.951538026f, 0.230596751f},
-std::array<float,2>{0.386560559f, 0.334649473f},
-std::array<float,2>{0.927650154f, 0.555784822f},
-std::array<float,2>{0.105161481f, 0.872136056f},
-std::array<float,2>{0.697692633f, 0.0701339021f},
-std::array<float,2>{0.228873789f, 0.156620905f},
-std::array<float,2>{0.581737936f, 0.913198233f},
-std::array<float,2>{0.342815906f, 0.729669571f},
-std::array<float,2>{0.863976359f, 0.462815166f},
-std::array<float,2>{0.413252711f, 0.0836639106f},
-std::array<float,2>{0.893866956f, 0.85318929f},
-std::array<float,2>{0.0724527687f, 0.534145653f},
-std::array<float,2>{0.743802071f, 0.32310313f},
-std::array<float,2>{0.200119004f, 0.441988945f},
-std::array<float,2>{0.619110584f, 0.740942955f},
-std::array<float,2>{0.367906094f, 0.931308627f},
-std::array<float,2>{0.814175487f, 0.181669757f},
-std::array<float,2>{0.300430834f, 0.288989961f},
-std::array<float,2>{0.785659194f, 0.588450789f},
-std::array<float,2>{0.156767443f, 0.796732605f},
-std::array<float,2>{0.55028075f, 0.051834926f},
-std::array<float,2>{0.033141762f, 0.243990481f},
-std::array<float,2>{0.639560282f, 0.973643005f},
-std::array<float,2>{0.498376876f, 0.657445371f},
-std::array<float,2>{0.98156774f, 0.407011241f},
-std::array<float,2>{0.320913434f, 0.135827243f},
-std::array<float,2>{0.855242908f, 0.87623322f},
-std::array<float,2>{0.235557154f, 0.694836378f},
-std::array<float,2>{0.575977743f, 0.482729405f},
-std::array<float,2>{0.115346253f, 0.372076452f},
-std::array<float,2>{0.711824775f, 0.515982747f},
-std::array<float,2>{0.399116337f, 0.836329818f},
-std::array<float,2>{0.907573938f, 0.116188578f},
-std::array<float,2>{0.449938864f, 0.388017118f},
-std::array<float,2>{0.966374338f, 0.633736074f},
-std::array<float,2>{0.0176688544f, 0.964078605f},
-std::array<float,2>{0.661804676f, 0.211209416f},
-std::array<float,2>{0.151304856f, 4.46573395e-05f},
-std::array<float,2>{0.502365649f, 0.771119356f},
-std::array<float,2>{0.255161166f, 0.617989898f},
-std::array<float,2>{0.771550417f, 0.255221635f},
-std::array<float,2>{0.395034403f, 0.179614976f},
-std::array<float,2>{0.92109853f, 0.926742435f},
-std::array<float,2>{0.124254279f, 0.748810649f},
-std::array<float,2>{0.704142034f, 0.451165378f},
-std::array<float,2>{0.247515112f, 0.313052475f},
-std::array<float,2>{0.565458357f, 0.541681945f},
-std::array<float,2>{0.313100219f, 0.84967947f},
-std::array<float,2>{0.848962307f, 0.0930062309f},
-std::array<float,2>{0.263304204f, 0.41996786f},
-std::array<float,2>{0.775516868f, 0.669739187f},
-std::array<float,2>{0.141413614f, 0.979484439f},
-std::array<float,2>{0.507899344f, 0.236026719f},
-std::array<float,2>{0.0264805574f, 0.062347848f},
-std::array<float,2>{0.665397525f, 0.785626709f},
-std::array<float,2>{0.444890141f, 0.580312371f},
-std::array<float,2>{0.955081284f, 0.293412447f},
-std::array<float,2>{0.363860756f, 0.123863541f},
-std::array<float,2>{0.822060049f, 0.834417343f},
-std::array<float,2>{0.192605838f, 0.530631244f},
-std::array<float,2>{0.609643698f, 0.361219168f},
-std::array<float,2>{0.06448327f, 0.470635265f},
-std::array<float,2>{0.736824155f, 0.702840447f},
-std::array<float,2>{0.415980011f, 0.884720802f},
-std::array<float,2>{0.900746047f, 0.128399327f},
-std::array<float,2>{0.489287853f, 0.262092769f},
-std::array<float,2>{0.973598003f, 0.617036045f},
-std::array<float,2>{0.0444574431f, 0.779606462f},
-std::array<float,2>{0.626351178f, 0.0112023465f},
-std::array<float,2>{0.164200321f, 0.208981171f},
-std::array<float,2>{0.560082674f, 0.956933618f},
-std::array<float,2>{0.304770917f, 0.629107356f},
-std::array<float,2>{0.793658614f, 0.37862432f},
-std::array<float,2>{0.456067443f, 0.0297044385f},
-std::array<float,2>{0.943673253f, 0.756229937f},
-std::array<float,2>{0.00614815997f, 0.605248451f},
-std::array<float,2>{0.679985881f, 0.266389012f},
-std::array<float,2>{0.128953502f, 0.394332826f},
-std::array<float,2>{0.528396666f, 0.652670383f},
-std::array<float,2>{0.269568354f, 0.945328474f},
-std::array<float,2>{0.758704484f, 0.194600344f},
-std::array<float,2>{0.335798264f, 0.355368346f},
-std::array<float,2>{0.870670497f, 0.512606025f},
-std::array<float,2>{0.218984723f, 0.815105379f},
-std::array<float,2>{0.587153733f, 0.0957805067f},
-std::array<float,2>{0.0963456407f, 0.149352521f},
-std::array<float,2>{0.6880759f, 0.894656956f},
-std::array<float,2>{0.380013764f, 0.703896165f},
-std::array<float,2>{0.931778789f, 0.498031884f},
-std::array<float,2>{0.292892545f, 0.226377636f},
-std::array<float,2>{0.798244774f, 0.990010142f},
-std::array<float,2>{0.185081184f, 0.675266087f},
-std::array<float,2>{0.535689771f, 0.42809853f},
-std::array<float,2>{0.0480803326f, 0.306753665f},
-std::array<float,2>{0.64643836f, 0.577342868f},
-std::array<float,2>{0.480039656f, 0.803837419f},
-std::array<float,2>{0.997736216f, 0.0370855629f},
-std::array<float,2>{0.427189022f, 0.456163466f},
-std::array<float,2>{0.886770964f, 0.721020877f},
-std::array<float,2>{0.0925657451f, 0.917018652f},
-std::array<float,2>{0.723004639f, 0.171450257f},
-std::array<float,2>{0.206471801f, 0.0736939237f},
-std::array<float,2>{0.601666868f, 0.863057137f},
-std::array<float,2>{0.345712394f, 0.55451107f},
-std::array<float,2>{0.832243562f, 0.343051523f},
-std::array<float,2>{0.486732572f, 0.1637723f},
-std::array<float,2>{0.97252655f, 0.907083869f},
-std::array<float,2>{0.041044794f, 0.733434021f},
-std::array<float,2>{0.63080442f, 0.465122342f},
-std::array<float,2>{0.169640198f, 0.329018444f},
-std::array<float,2>{0.557838023f, 0.559733987f},
-std::array<float,2>{0.312071741f, 0.867385149f},
-std::array<float,2>{0.790633917f, 0.0657005757f},
-std::array<float,2>{0.360375315f, 0.431496024f},
-std::array<float,2>{0.827943325f, 0.679701924f},
-std::array<float,2>{0.188013718f, 0.99496603f},
-std::array<float,2>{0.615092874f, 0.229017749f},
-std::array<float,2>{0.0686353967f, 0.0459108911f},
-std::array<float,2>{0.740116417f, 0.810432136f},
-std::array<float,2>{0.420270413f, 0.569707274f},
-std::array<float,2>{0.904355168f, 0.298308074f},
-std::array<float,2>{0.259458184f, 0.109327756f},
-std::array<float,2>{0.780204892f, 0.820474684f},
-std::array<float,2>{0.148232281f, 0.504500091f},
-std::array<float,2>{0.514137447f, 0.345775157f},
-std::array<float,2>{0.0286389031f, 0.488871008f},
-std::array<float,2>{0.669998407f, 0.713973701f},
-std::array<float,2>{0.438797325f, 0.905868649f},
-std::array<float,2>{0.957955837f, 0.141262487f},
-std::array<float,2>{0.394100189f, 0.280927926f},
-std::array<float,2>{0.915739834f, 0.601228714f},
-std::array<float,2>{0.11974401f, 0.763352156f},
-std::array<float,2>{0.709085405f, 0.018377563f},
-std::array<float,2>{0.243844837f, 0.202268139f},
-std::array<float,2>{0.569549978f, 0.945110917f},
-std::array<float,2>{0.317662269f, 0.646859169f},
-std::array<float,2>{0.84583956f, 0.399607897f},
-std::array<float,2>{0.423792094f, 0.00711562252f},
-std::array<float,2>{0.884646118f, 0.765918374f},
-std::array<float,2>{0.088136293f, 0.624528229f},
-std::array<float,2>{0.719184041f, 0.251613587f},
-std::array<float,2>{0.209922105f, 0.386195481f},
-std::array<float,2>{0.605886042f, 0.637826085f},
-std::array<float,2>{0.34910658f, 0.964955568f},
-std::array<float,2>{0.82874161f, 0.215141162f},
-std::array<float,2>{0.293885499f, 0.36939469f},
-std::array<float,2>{0.804621577f, 0.522573411f},
-std::array<float,2>{0.181362435f, 0.842250407f},
-std::array<float,2>{0.53433001f, 0.110447764f},
-std::array<float,2>{0.0514259227f, 0.138998598f},
-std::array<float,2>{0.642525077f, 0.879311502f},
-std::array<float,2>{0.483794063f, 0.690256655f},
-std::array<float,2>{0.99478054f, 0.477732688f},
-std::array<float,2>{0.331848502f, 0.249942407f},
-std::array<float,2>{0.872249544f, 0.972011745f},
-std::array<float,2>{0.225305259f, 0.66215843f},
-std::array<float,2>{0.591776311f, 0.412239075f},
-std::array<float,2>{0.0999469981f, 0.284319371f},
-std::array<float,2>{0.695064366f, 0.590070963f},
-std::array<float,2>{0.375070691f, 0.790679395f},
-std::array<float,2>{0.936108291f, 0.0498439781f},
-std::array<float,2>{0.45927614f, 0.438429713f},
-std::array<float,2>{0.941274226f, 0.737557054f},
-std::array<float,2>{0.00241872924f, 0.934628844f},
-std::array<float,2>{0.684281111f, 0.187244758f},
-std::array<float,2>{0.12811932f, 0.0797218829f},
-std::array<float,2>{0.527078092f, 0.856131077f},
-std::array<float,2>{0.265866756f, 0.535917819f},
-std::array<float,2>{0.765500605f, 0.324841827f},
-std::array<float,2>{0.386770904f, 0.206125647f},
-std::array<float,2>{0.924189448f, 0.96032846f},
-std::array<float,2>{0.106828183f, 0.625087738f},
-std::array<float,2>{0.702585995f, 0.382696182f},
-std::array<float,2>{0.234171286f, 0.26101771f},
-std::array<float,2>{0.58440721f, 0.610517919f},
-std::array<float,2>{0.33801195f, 0.774805665f},
-std::array<float,2>{0.86269021f, 0.0119891809f},
-std::array<float,2>{0.277270883f, 0.476477802f},
-std::array<float,2>{0.750030875f, 0.695521951f},
-std::array<float,2>{0.136187643f, 0.889768898f},
-std::array<float,2>{0.518395722f, 0.132621914f},
-std::array<float,2>{0.00904461276f, 0.117592119f},
-std::array<float,2>{0.672612607f, 0.831282198f},
-std::array<float,2>{0.462269336f, 0.52562815f},
-std::array<float,2>{0.947879374f, 0.366946697f},
-std::array<float,2>{0.353690207f, 0.0581127331f},
-std::array<float,2>{0.836349666f, 0.78327471f},
-std::array<float,2>{0.212052882f, 0.584165514f},
-std::array<float,2>{0.593934059f, 0.289831787f},
-std::array<float,2>{0.0786684826f, 0.41599679f},
-std::array<float,2>{0.727117538f, 0.667678177f},
-std::array<float,2>{0.434409022f, 0.980944753f},
-std::array<float,2>{0.882802784f, 0.241205305f},
-std::array<float,2>{0.469802499f, 0.31678763f},
-std::array<float,2>{0.986731052f, 0.543913603f},
-std::array<float,2>{0.0601583868f, 0.844549954f},
-std::array<float,2>{0.652572393f, 0.0898183361f},
-std::array<float,2>{0.178090751f, 0.174591377f},
-std::array<float,2>{0.542113185f, 0.924278617f},
-std::array<float,2>{0.283652157f, 0.743002176f},
-std::array<float,2>{0.809588909f, 0.449177623f},
-std::array<float,2>{0.446363926f, 0.0750267804f},
-std::array<float,2>{0.962026536f, 0.866262913f},
-std::array<float,2>{0.022522524f, 0.55024749f},
-std::array<float,2>{0.659059525f, 0.336986035f},
-std::array<float,2>{0.15406169f, 0.460755646f},
-std::array<float,2>{0.506188512f, 0.724028885f},
-std::array<float,2>{0.252542168f, 0.918719888f},
-std::array<float,2>{0.767003536f, 0.164452642f},
-std::array<float,2>{0.324805647f, 0.31006825f},
-std::array<float,2>{0.857204497f, 0.57064873f},
-std::array<float,2>{0.24100849f, 0.800610423f},
-std::array<float,2>{0.570345044f, 0.0341256037f},
-std::array<float,2>{0.112739064f, 0.220017165f},
-std::array<float,2>{0.715233624f, 0.985617161f},
-std::array<float,2>{0.403155386f, 0.675799549f},
-std::array<float,2>{0.912876785f, 0.424520999f},
-std::array<float,2>{0.302122474f, 0.156130657f},
-std::array<float,2>{0.78247869f, 0.891904473f},
-std::array<float,2>{0.162209928f, 0.708173096f},
-std::array<float,2>{0.553193986f, 0.494896144f},
-std::array<float,2>{0.0365725681f, 0.35608536f},
-std::array<float,2>{0.633809268f, 0.510866165f},
-std::array<float,2>{0.49569881f, 0.818771362f},
-std::array<float,2>{0.978403807f, 0.101511918f},
-std::array<float,2>{0.408612967f, 0.395347476f},
-std::array<float,2>{0.89507246f, 0.652220845f},
-std::array<float,2>{0.0753293633f, 0.951533973f},
-std::array<float,2>{0.747034669f, 0.189370126f},
-std::array<float,2>{0.195876762f, 0.0249889418f},
-std::array<float,2>{0.624543488f, 0.752991021f},
-std::array<float,2>{0.371952087f, 0.607280612f},
-std::array<float,2>{0.817952335f, 0.2700831f},
-std::array<float,2>{0.468263537f, 0.233557314f},
-std::array<float,2>{0.950179636f, 0.997572184f},
-std::array<float,2>{0.0138700865f, 0.686275303f},
-std::array<float,2>{0.677490413f, 0.436571628f},
-std::array<float,2>{0.138239458f, 0.303459018f},
-std::array<float,2>{0.520391643f, 0.566012621f},
-std::array<float,2>{0.279606193f, 0.808455765f},
-std::array<float,2>{0.75511378f, 0.0400054902f},
-std::array<float,2>{0.340397656f, 0.46391654f},
-std::array<float,2>{0.865704656f, 0.727145195f},
-std::array<float,2>{0.228136867f, 0.91109544f},
-std::array<float,2>{0.578865349f, 0.158345327f},
-std::array<float,2>{0.10272263f, 0.0679942369f},
-std::array<float,2>{0.696652055f, 0.874304473f},
-std::array<float,2>{0.384255052f, 0.55721283f},
-std::array<float,2>{0.927772105f, 0.332263619f},
-std::array<float,2>{0.286181211f, 0.0232804827f},
-std::array<float,2>{0.806156099f, 0.759563148f},
-std::array<float,2>{0.17515485f, 0.596459925f},
-std::array<float,2>{0.54507488f, 0.276574284f},
-std::array<float,2>{0.0585897975f, 0.403938532f},
-std::array<float,2>{0.649225891f, 0.641852379f},
-std::array<float,2>{0.476148397f, 0.941060424f},
-std::array<float,2>{0.991195023f, 0.19827266f},
-std::array<float,2>{0.431659132f, 0.35132888f},
-std::array<float,2>{0.876190901f, 0.500665665f},
-std::array<float,2>{0.0855703577f, 0.826576769f},
-std::array<float,2>{0.732466042f, 0.103458107f},
-std::array<float,2>{0.217755526f, 0.145877555f},
-std::array<float,2>{0.600334287f, 0.899498701f},
-std::array<float,2>{0.357406318f, 0.716185689f},
-std::array<float,2>{0.843234122f, 0.486912221f},
-std::array<float,2>{0.401362211f, 0.113467552f},
-std::array<float,2>{0.909604371f, 0.838949561f},
-std::array<float,2>{0.114735506f, 0.518499315f},
-std::array<float,2>{0.714294195f, 0.37381959f},
-std::array<float,2>{0.236358166f, 0.481237531f},
-std::array<float,2>{0.576664865f, 0.691519618f},
-std::array<float,2>{0.322684139f, 0.876991808f},
-std::array<float,2>{0.85187757f, 0.134597391f},
-std::array<float,2>{0.256533772f, 0.257320315f},
-std::array<float,2>{0.771096408f, 0.619877636f},
-std::array<float,2>{0.148750663f, 0.772270739f},
-std::array<float,2>{0.501157224f, 0.00291302381f},
-std::array<float,2>{0.016948482f, 0.212933078f},
-std::array<float,2>{0.664041281f, 0.962720752f},
-std::array<float,2>{0.452546418f, 0.63536191f},
-std::array<float,2>{0.96769613f, 0.390209109f},
-std::array<float,2>{0.370086014f, 0.181590661f},
-std::array<float,2>{0.81545651f, 0.933320343f},
-std::array<float,2>{0.201359928f, 0.738705218f},
-std::array<float,2>{0.620113671f, 0.444128454f},
-std::array<float,2>{0.071151413f, 0.322089434f},
-std::array<float,2>{0.744874954f, 0.532575607f},
-std::array<float,2>{0.410811365f, 0.855368793f},
-std::array<float,2>{0.891964495f, 0.085389547f},
-std::array<float,2>{0.497987658f, 0.408349842f},
-std::array<float,2>{0.982713819f, 0.658324182f},
-std::array<float,2>{0.034815494f, 0.976155162f},
-std::array<float,2>{0.637560666f, 0.245888144f},
-std::array<float,2>{0.158983484f, 0.0543684401f},
-std::array<float,2>{0.547959089f, 0.793938637f},
-std::array<float,2>{0.298693359f, 0.586423576f},
-std::array<float,2>{0.788086772f, 0.285647333f},
-std::array<float,2>{0.416757375f, 0.12682645f},
-std::array<float,2>{0.899414241f, 0.886666954f},
-std::array<float,2>{0.0635081753f, 0.700775385f},
-std::array<float,2>{0.735620797f, 0.470819741f},
-std::array<float,2>{0.195107803f, 0.362729371f},
-std::array<float,2>{0.612097919f, 0.528932452f},
-std::array<float,2>{0.366716266f, 0.833665371f},
-std::array<float,2>{0.824210465f, 0.12139158f},
-std::array<float,2>{0.307508469f, 0.376098543f},
-std::array<float,2>{0.795275331f, 0.632513344f},
-std::array<float,2>{0.167727754f, 0.954789579f},
-std::array<float,2>{0.560689926f, 0.210321397f},
-std::array<float,2>{0.0466230884f, 0.00942313764f},
-std::array<float,2>{0.628562331f, 0.778930247f},
-std::array<float,2>{0.491692066f, 0.613637209f},
-std::array<float,2>{0.975481272f, 0.26394093f},
-std::array<float,2>{0.31525442f, 0.091641821f},
-std::array<float,2>{0.850045383f, 0.847933114f},
-std::array<float,2>{0.249291033f, 0.540511668f},
-std::array<float,2>{0.563896596f, 0.314680248f},
-std::array<float,2>{0.121863544f, 0.452973843f},
-std::array<float,2>{0.706921518f, 0.747968733f},
-std::array<float,2>{0.396707118f, 0.928614616f},
-std::array<float,2>{0.918952107f, 0.176231429f},
-std::array<float,2>{0.44295001f, 0.296433598f},
-std::array<float,2>{0.954208255f, 0.579216957f},
-std::array<float,2>{0.0251532421f, 0.787212789f},
-std::array<float,2>{0.666297317f, 0.0593846329f},
-std::array<float,2>{0.143112719f, 0.237279445f},
-std::array<float,2>{0.511426151f, 0.977947652f},
-std::array<float,2>{0.263737887f, 0.671278119f},
-std::array<float,2>{0.773557305f, 0.419888735f},
-std::array<float,2>{0.477607995f, 0.0385347307f},
-std::array<float,2>{0.998718679f, 0.802625895f},
-std::array<float,2>{0.050562799f, 0.574695647f},
-std::array<float,2>{0.647728145f, 0.304791361f},
-std::array<float,2>{0.186661601f, 0.427267611f},
-std::array<float,2>{0.538025558f, 0.671918631f},
-std::array<float,2>{0.289599329f, 0.990676284f},
-std::array<float,2>{0.800751865f, 0.224112704f},
-std::array<float,2>{0.343946725f, 0.340585768f},
-std::array<float,2>{0.83562237f, 0.551041245f},
-std::array<float,2>{0.203171134f, 0.860936761f},
-std::array<float,2>{0.604761183f, 0.0705502704f},
-std::array<float,2>{0.0899588317f, 0.169049516f},
-std::array<float,2>{0.72564441f, 0.915088296f},
-std::array<float,2>{0.428219855f, 0.720266402f},
-std::array<float,2>{0.890367568f, 0.453948408f},
-std::array<float,2>{0.272052079f, 0.193166465f},
-std::array<float,2>{0.760131598f, 0.948947668f},
-std::array<float,2>{0.132097051f, 0.655387461f},
-std::array<float,2>{0.530623853f, 0.39220351f},
-std::array<float,2>{0.00550032733f, 0.268153965f},
-std::array<float,2>{0.681854248f, 0.603281677f},
-std::array<float,2>{0.454472601f, 0.755032361f},
-std::array<float,2>{0.941533506f, 0.0279896725f},
-std::array<float,2>{0.382063419f, 0.499417156f},
-std::array<float,2>{0.931025445f, 0.706767797f},
-std::array<float,2>{0.0949779525f, 0.896530151f},
-std::array<float,2>{0.691081524f, 0.152341783f},
-std::array<float,2>{0.220811173f, 0.0940374359f},
-std::array<float,2>{0.588977516f, 0.813040078f},
-std::array<float,2>{0.333707243f, 0.513938248f},
-std::array<float,2>{0.867759287f, 0.351661295f},
-std::array<float,2>{0.457586378f, 0.186444148f},
-std::array<float,2>{0.939398348f, 0.934436798f},
-std::array<float,2>{0.00080013118f, 0.73655802f},
-std::array<float,2>{0.686935365f, 0.438981682f},
-std::array<float,2>{0.126829967f, 0.325872123f},
-std::array<float,2>{0.523673594f, 0.536158085f},
-std::array<float,2>{0.267636389f, 0.857098341f},
-std::array<float,2>{0.762177885f, 0.0782199949f},
-std::array<float,2>{0.328165233f, 0.413331151f},
-std::array<float,2>{0.873850524f, 0.663288236f},
-std::array<float,2>{0.223589927f, 0.971395671f},
-std::array<float,2>{0.593191445f, 0.248209581f},
-std::array<float,2>{0.0995144099f, 0.0496905185f},
-std::array<float,2>{0.692386746f, 0.789169908f},
-std::array<float,2>{0.378090233f, 0.591674507f},
-std::array<float,2>{0.934168458f, 0.283276469f},
-std::array<float,2>{0.295566946f, 0.109504685f},
-std::array<float,2>{0.801334441f, 0.843316376f},
-std::array<float,2>{0.182188421f, 0.522413135f},
-std::array<float,2>{0.532043755f, 0.37104094f},
-std::array<float,2>{0.053983815f, 0.476734459f},
-std::array<float,2>{0.644005477f, 0.691216171f},
-std::array<float,2>{0.481826186f, 0.880525649f},
-std::array<float,2>{0.993552864f, 0.140326902f},
-std::array<float,2>{0.424816877f, 0.250882357f},
-std::array<float,2>{0.885522187f, 0.623530209f},
-std::array<float,2>{0.0863733962f, 0.76739943f},
-std::array<float,2>{0.72126317f, 0.00607477827f},
-std::array<float,2>{0.207176641f, 0.216385305f},
-std::array<float,2>{0.609208524f, 0.966354072f},
-std::array<float,2>{0.35094136f, 0.637114286f},
-std::array<float,2>{0.831766546f, 0.385309607f},
-std::array<float,2>{0.391501367f, 0.019492887f},
-std::array<float,2>{0.917640984f, 0.761817336f},
-std::array<float,2>{0.118243277f, 0.599776745f},
-std::array<float,2>{0.708598554f, 0.280033439f},
-std::array<float,2>{0.24605903f, 0.398925155f},
-std::array<float,2>{0.56820488f, 0.64746201f},
-std::array<float,2>{0.31939739f, 0.94376719f},
-std::array<float,2>{0.844292402f, 0.20199123f},
-std::array<float,2>{0.260626197f, 0.3475793f},
-std::array<float,2>{0.77926898f, 0.505586505f},
-std::array<float,2>{0.145655662f, 0.821767449f},
-std::array<float,2>{0.513487101f, 0.107748352f},
-std::array<float,2>{0.0308903772f, 0.142540023f},
-std::array<float,2>{0.66966635f, 0.904608727f},
-std::array<float,2>{0.440320432f, 0.713348448f},
-std::array<float,2>{0.959021389f, 0.489419073f},
-std::array<float,2>{0.362454504f, 0.23037228f},
-std::array<float,2>{0.825509429f, 0.995493889f},
-std::array<float,2>{0.191282749f, 0.680789292f},
-std::array<float,2>{0.615331113f, 0.430037409f},
-std::array<float,2>{0.0681912228f, 0.297081947f},
-std::array<float,2>{0.74108386f, 0.568851829f},
-std::array<float,2>{0.419072479f, 0.809194207f},
-std::array<float,2>{0.904138386f, 0.0458635874f},
-std::array<float,2>{0.485261232f, 0.466202378f},
-std::array<float,2>{0.970020533f, 0.73272413f},
-std::array<float,2>{0.0402606465f, 0.9073596f},
-std::array<float,2>{0.632406771f, 0.162945837f},
-std::array<float,2>{0.171340406f, 0.064670302f},
-std::array<float,2>{0.556380093f, 0.868227661f},
-std::array<float,2>{0.310507655f, 0.559412777f},
-std::array<float,2>{0.791878521f, 0.329165667f},
-std::array<float,2>{0.407883137f, 0.18760246f},
-std::array<float,2>{0.897471249f, 0.952647746f},
-std::array<float,2>{0.07661964f, 0.65082705f},
-std::array<float,2>{0.748613477f, 0.396050811f},
-std::array<float,2>{0.197510019f, 0.271143138f},
-std::array<float,2>{0.62173146f, 0.605707288f},
-std::array<float,2>{0.37443164f, 0.752075791f},
-std::array<float,2>{0.81908077f, 0.0237155426f},
-std::array<float,2>{0.304008245f, 0.495570064f},
-std::array<float,2>{0.783430398f, 0.70728451f},
-std::array<float,2>{0.161167935f, 0.891401589f},
-std::array<float,2>{0.550853252f, 0.154877976f},
-std::array<float,2>{0.0389773771f, 0.100290425f},
-std::array<float,2>{0.635839999f, 0.819792271f},
-std::array<float,2>{0.49323076f, 0.51004833f},
-std::array<float,2>{0.979908824f, 0.35688445f},
-std::array<float,2>{0.326941371f, 0.0348625034f},
-std::array<float,2>{0.858076811f, 0.799660563f},
-std::array<float,2>{0.239063427f, 0.571559668f},
-std::array<float,2>{0.572401762f, 0.309154242f},
-std::array<float,2>{0.110447899f, 0.425355375f},
-std::array<float,2>{0.716889858f, 0.677139401f},
-std::array<float,2>{0.406052828f, 0.984584868f},
-std::array<float,2>{0.91084379f, 0.219387084f},
-std::array<float,2>{0.448254853f, 0.336262196f},
-std::array<float,2>{0.963113904f, 0.549312651f},
-std::array<float,2>{0.0204391275f, 0.865948737f},
-std::array<float,2>{0.656609237f, 0.075402528f},
-std::array<float,2>{0.154661551f, 0.165949717f},
-std::array<float,2>{0.505031824f, 0.919225156f},
-std::array<float,2>{0.250508219f, 0.722803533f},
-std::array<float,2>{0.769077301f, 0.459522039f},
-std::array<float,2>{0.472296685f, 0.0881750584f},
-std::array<float,2>{0.985145569f, 0.845559835f},
-std::array<float,2>{0.0605781414f, 0.544470966f},
-std::array<float,2>{0.655928195f, 0.317917734f},
-std::array<float,2>{0.177000716f, 0.448199481f},
-std::array<float,2>{0.53907907f, 0.743816912f},
-std::array<float,2>{0.281381249f, 0.925668538f},
-std::array<float,2>{0.812314808f, 0.175203189f},
-std::array<float,2>{0.352936327f, 0.290264517f},
-std::array<float,2>{0.839017749f, 0.585173726f},
-std::array<float,2>{0.213177383f, 0.784750938f},
-std::array<float,2>{0.59718287f, 0.0566789173f},
-std::array<float,2>{0.0820022076f, 0.242038354f},
-std::array<float,2>{0.729021788f, 0.982044935f},
-std::array<float,2>{0.43697834f, 0.666523874f},
-std::array<float,2>{0.880140185f, 0.414135367f},
-std::array<float,2>{0.275095552f, 0.131635338f},
-std::array<float,2>{0.752766371f, 0.888869405f},
-std::array<float,2>{0.134449646f, 0.697085679f},
-std::array<float,2>{0.515693426f, 0.475232333f},
-std::array<float,2>{0.0108768046f, 0.366057783f},
-std::array<float,2>{0.673982859f, 0.5267995f},
-std::array<float,2>{0.463992357f, 0.830819905f},
-std::array<float,2>{0.946258605f, 0.11868003f},
-std::array<float,2>{0.39026469f, 0.381114542f},
-std::array<float,2>{0.922949493f, 0.626868129f},
-std::array<float,2>{0.108605362f, 0.958998203f},
-std::array<float,2>{0.700696051f, 0.205290332f},
-std::array<float,2>{0.231351852f, 0.0132312272f},
-std::array<float,2>{0.582395136f, 0.773514271f},
-std::array<float,2>{0.336566895f, 0.610350788f},
-std::array<float,2>{0.859602273f, 0.259780645f},
-std::array<float,2>{0.499720007f, 0.244191915f},
-std::array<float,2>{0.981324792f, 0.975331783f},
-std::array<float,2>{0.0318782218f, 0.659912944f},
-std::array<float,2>{0.640548408f, 0.410117447f},
-std::array<float,2>{0.15760456f, 0.286666393f},
-std::array<float,2>{0.549014568f, 0.587286592f},
-std::array<float,2>{0.299329698f, 0.794796824f},
-std::array<float,2>{0.786652327f, 0.0528311245f},
-std::array<float,2>{0.368818909f, 0.444564432f},
-std::array<float,2>{0.812778473f, 0.740208566f},
-std::array<float,2>{0.201014757f, 0.932595372f},
-std::array<float,2>{0.617720723f, 0.180094242f},
-std::array<float,2>{0.0740046278f, 0.0848500058f},
-std::array<float,2>{0.742584109f, 0.854325891f},
-std::array<float,2>{0.412446856f, 0.531938076f},
-std::array<float,2>{0.893111169f, 0.320686877f},
-std::array<float,2>{0.254029542f, 0.00355291273f},
-std::array<float,2>{0.773411095f, 0.773061275f},
-std::array<float,2>{0.152110368f, 0.62096256f},
-std::array<float,2>{0.503734469f, 0.255936533f},
-std::array<float,2>{0.019378623f, 0.389463574f},
-std::array<float,2>{0.661085069f, 0.636569023f},
-std::array<float,2>{0.450725079f, 0.961158633f},
-std::array<float,2>{0.964981139f, 0.214331925f},
-std::array<float,2>{0.400175184f, 0.374218494f},
-std::array<float,2>{0.906693816f, 0.519003451f},
-std::array<float,2>{0.116316743f, 0.838213861f},
-std::array<float,2>{0.711959004f, 0.115128219f},
-std::array<float,2>{0.235166743f, 0.133566841f},
-std::array<float,2>{0.574350774f, 0.878686786f},
-std::array<float,2>{0.321737885f, 0.693100214f},
-std::array<float,2>{0.854353487f, 0.481960803f},
-std::array<float,2>{0.430233806f, 0.101872191f},
-std::array<float,2>{0.876975f, 0.82809186f},
-std::array<float,2>{0.0839781836f, 0.501154065f},
-std::array<float,2>{0.731933773f, 0.350080401f},
-std::array<float,2>{0.216199756f, 0.487409621f},
-std::array<float,2>{0.597848594f, 0.715656936f},
-std::array<float,2>{0.359015167f, 0.899097502f},
-std::array<float,2>{0.841179252f, 0.144572437f},
-std::array<float,2>{0.287498862f, 0.276182711f},
-std::array<float,2>{0.80701232f, 0.597387373f},
-std::array<float,2>{0.173549592f, 0.758604407f},
-std::array<float,2>{0.5436396f, 0.0221650433f},
-std::array<float,2>{0.0566148311f, 0.198171124f},
-std::array<float,2>{0.652109921f, 0.940316498f},
-std::array<float,2>{0.473115981f, 0.641567469f},
-std::array<float,2>{0.989407837f, 0.403292388f},
-std::array<float,2>{0.342651635f, 0.15982835f},
-std::array<float,2>{0.864364803f, 0.91176486f},
-std::array<float,2>{0.230392531f, 0.728471994f},
-std::array<float,2>{0.58041048f, 0.463385224f},
-std::array<float,2>{0.104455009f, 0.333117336f},
-std::array<float,2>{0.698873878f, 0.558477104f},
-std::array<float,2>{0.384884f, 0.87319088f},
-std::array<float,2>{0.925906658f, 0.0669944286f},
-std::array<float,2>{0.465153962f, 0.43563807f},
-std::array<float,2>{0.952483594f, 0.687083662f},
-std::array<float,2>{0.0133879706f, 0.996946514f},
-std::array<float,2>{0.678234398f, 0.233347848f},
-std::array<float,2>{0.139912874f, 0.0403091125f},
-std::array<float,2>{0.522162616f, 0.807600558f},
-std::array<float,2>{0.277852803f, 0.564491868f},
-std::array<float,2>{0.756511509f, 0.30388695f},
-std::array<float,2>{0.379239023f, 0.150518209f},
-std::array<float,2>{0.933402717f, 0.898145735f},
-std::array<float,2>{0.0969914347f, 0.705343068f},
-std::array<float,2>{0.688765287f, 0.49901545f},
-std::array<float,2>{0.219830588f, 0.353075832f},
-std::array<float,2>{0.586421609f, 0.514898241f},
-std::array<float,2>{0.334308714f, 0.814312875f},
-std::array<float,2>{0.869315505f, 0.0952466056f},
-std::array<float,2>{0.270719022f, 0.391315043f},
-std::array<float,2>{0.758974195f, 0.654883027f},
-std::array<float,2>{0.130609781f, 0.947422564f},
-std::array<float,2>{0.527979314f, 0.191844255f},
-std::array<float,2>{0.00771526154f, 0.0288861468f},
-std::array<float,2>{0.680722296f, 0.753954172f},
-std::array<float,2>{0.455566287f, 0.602339864f},
-std::array<float,2>{0.944666207f, 0.268932879f},
-std::array<float,2>{0.347370386f, 0.0714991763f},
-std::array<float,2>{0.833676994f, 0.859665751f},
-std::array<float,2>{0.205190822f, 0.552278042f},
-std::array<float,2>{0.602644742f, 0.341567576f},
-std::array<float,2>{0.0931305513f, 0.455072165f},
-std::array<float,2>{0.724495649f, 0.719311893f},
-std::array<float,2>{0.425986379f, 0.914119363f},
-std::array<float,2>{0.888605952f, 0.168042764f},
-std::array<float,2>{0.479323775f, 0.305713236f},
-std::array<float,2>{0.996105194f, 0.57574898f},
-std::array<float,2>{0.0468789451f, 0.801372528f},
-std::array<float,2>{0.645000577f, 0.0378402993f},
-std::array<float,2>{0.183647349f, 0.223054841f},
-std::array<float,2>{0.536481917f, 0.991417706f},
-std::array<float,2>{0.291020125f, 0.673102915f},
-std::array<float,2>{0.797412634f, 0.426178962f},
-std::array<float,2>{0.444104254f, 0.0602748357f},
-std::array<float,2>{0.957023561f, 0.78879118f},
-std::array<float,2>{0.0263494086f, 0.578141987f},
-std::array<float,2>{0.664122641f, 0.295461923f},
-std::array<float,2>{0.142563909f, 0.418575883f},
-std::array<float,2>{0.508994162f, 0.670244336f},
-std::array<float,2>{0.262473881f, 0.977323413f},
-std::array<float,2>{0.777134836f, 0.237920746f},
-std::array<float,2>{0.314104319f, 0.315654904f},
-std::array<float,2>{0.847996593f, 0.539868772f},
-std::array<float,2>{0.246422693f, 0.849563003f},
-std::array<float,2>{0.565158963f, 0.0899266228f},
-std::array<float,2>{0.123724349f, 0.177306548f},
-std::array<float,2>{0.703423619f, 0.929093301f},
-std::array<float,2>{0.396224707f, 0.746336639f},
-std::array<float,2>{0.920152724f, 0.451394439f},
-std::array<float,2>{0.306145698f, 0.209136307f},
-std::array<float,2>{0.794622779f, 0.953344524f},
-std::array<float,2>{0.165089726f, 0.631276071f},
-std::array<float,2>{0.559241533f, 0.375471592f},
-std::array<float,2>{0.0436909348f, 0.265365392f},
-std::array<float,2>{0.625850499f, 0.615074992f},
-std::array<float,2>{0.489214689f, 0.778167546f},
-std::array<float,2>{0.974072576f, 0.00836058706f},
-std::array<float,2>{0.414716899f, 0.472578615f},
-std::array<float,2>{0.901473641f, 0.70000267f},
-std::array<float,2>{0.0663358867f, 0.885262609f},
-std::array<float,2>{0.738117099f, 0.125545129f},
-std::array<float,2>{0.191530287f, 0.122153088f},
-std::array<float,2>{0.610841811f, 0.832847953f},
-std::array<float,2>{0.364342004f, 0.527552426f},
-std::array<float,2>{0.820312798f, 0.361346394f},
-std::array<float,2>{0.482423007f, 0.136765152f},
-std::array<float,2>{0.995712876f, 0.882699847f},
-std::array<float,2>{0.052180253f, 0.688030958f},
-std::array<float,2>{0.640838385f, 0.480131716f},
-std::array<float,2>{0.18065846f, 0.368040562f},
-std::array<float,2>{0.533241928f, 0.519637287f},
-std::array<float,2>{0.294020534f, 0.840512395f},
-std::array<float,2>{0.803533733f, 0.112762801f},
-std::array<float,2>{0.348602116f, 0.384380609f},
-std::array<float,2>{0.829363465f, 0.639636874f},
-std::array<float,2>{0.209998205f, 0.967077732f},
-std::array<float,2>{0.606773019f, 0.218567133f},
-std::array<float,2>{0.0890535116f, 0.00394277833f},
-std::array<float,2>{0.720164418f, 0.768585503f},
-std::array<float,2>{0.422531724f, 0.622133374f},
-std::array<float,2>{0.883048296f, 0.252393454f},
-std::array<float,2>{0.267502904f, 0.0801198408f},
-std::array<float,2>{0.764081478f, 0.857883632f},
-std::array<float,2>{0.127618983f, 0.537945628f},
-std::array<float,2>{0.525965095f, 0.327161968f},
-std::array<float,2>{0.00360813458f, 0.440273076f},
-std::array<float,2>{0.685429752f, 0.735640585f},
-std::array<float,2>{0.460888952f, 0.93608433f},
-std::array<float,2>{0.94018364f, 0.18476449f},
-std::array<float,2>{0.376867115f, 0.281792164f},
-std::array<float,2>{0.936544001f, 0.592063785f},
-std::array<float,2>{0.101401344f, 0.791512311f},
-std::array<float,2>{0.693472564f, 0.0470262319f},
-std::array<float,2>{0.226396814f, 0.246902317f},
-std::array<float,2>{0.590409398f, 0.969005942f},
-std::array<float,2>{0.330662251f, 0.660432279f},
-std::array<float,2>{0.872063577f, 0.412075222f},
-std::array<float,2>{0.421287656f, 0.0447205715f},
-std::array<float,2>{0.905348301f, 0.811940372f},
-std::array<float,2>{0.0701105669f, 0.567091048f},
-std::array<float,2>{0.739225209f, 0.299274594f},
-std::array<float,2>{0.189041451f, 0.433138251f},
-std::array<float,2>{0.614099205f, 0.681975663f},
-std::array<float,2>{0.360267371f, 0.992646813f},
-std::array<float,2>{0.826794803f, 0.228151396f},
-std::array<float,2>{0.310765564f, 0.330521703f},
-std::array<float,2>{0.789241254f, 0.560901523f},
-std::array<float,2>{0.168081909f, 0.870088875f},
-std::array<float,2>{0.557114422f, 0.0642809123f},
-std::array<float,2>{0.0424798243f, 0.160691857f},
-std::array<float,2>{0.629235923f, 0.909234166f},
-std::array<float,2>{0.487530679f, 0.730961263f},
-std::array<float,2>{0.971451163f, 0.467812717f},
-std::array<float,2>{0.316542059f, 0.20093593f},
-std::array<float,2>{0.847280443f, 0.941760123f},
-std::array<float,2>{0.242548123f, 0.645634651f},
-std::array<float,2>{0.569004416f, 0.400615871f},
-std::array<float,2>{0.120167658f, 0.277955651f},
-std::array<float,2>{0.710522175f, 0.598198593f},
-std::array<float,2>{0.393230706f, 0.764229178f},
-std::array<float,2>{0.91465193f, 0.0163324978f},
-std::array<float,2>{0.438387483f, 0.491415322f},
-std::array<float,2>{0.958364904f, 0.711153805f},
-std::array<float,2>{0.0275335032f, 0.903736174f},
-std::array<float,2>{0.671409369f, 0.143929139f},
-std::array<float,2>{0.147182897f, 0.107172452f},
-std::array<float,2>{0.514671087f, 0.822540343f},
-std::array<float,2>{0.258393288f, 0.506348729f},
-std::array<float,2>{0.7809816f, 0.345373034f},
-std::array<float,2>{0.404025882f, 0.221365944f},
-std::array<float,2>{0.913448632f, 0.988080382f},
-std::array<float,2>{0.111434475f, 0.679340243f},
-std::array<float,2>{0.716785967f, 0.422263503f},
-std::array<float,2>{0.242146939f, 0.310678601f},
-std::array<float,2>{0.57152009f, 0.573953152f},
-std::array<float,2>{0.325262398f, 0.797126412f},
-std::array<float,2>{0.855588257f, 0.0328174792f},
-std::array<float,2>{0.253653705f, 0.457897633f},
-std::array<float,2>{0.765758216f, 0.725992084f},
-std::array<float,2>{0.152514428f, 0.921303153f},
-std::array<float,2>{0.507069468f, 0.166474789f},
-std::array<float,2>{0.0224240441f, 0.0780827329f},
-std::array<float,2>{0.659710348f, 0.864752173f},
-std::array<float,2>{0.446265727f, 0.548096776f},
-std::array<float,2>{0.961330891f, 0.338727087f},
-std::array<float,2>{0.372793376f, 0.0269920509f},
-std::array<float,2>{0.816684246f, 0.751815796f},
-std::array<float,2>{0.196376771f, 0.607565165f},
-std::array<float,2>{0.623416722f, 0.272359788f},
-std::array<float,2>{0.0742470101f, 0.397746205f},
-std::array<float,2>{0.747590482f, 0.648816586f},
-std::array<float,2>{0.409581006f, 0.950814486f},
-std::array<float,2>{0.895936966f, 0.190545127f},
-std::array<float,2>{0.494644493f, 0.35855028f},
-std::array<float,2>{0.977108061f, 0.509180963f},
-std::array<float,2>{0.0360750183f, 0.817241251f},
-std::array<float,2>{0.633117676f, 0.0983931497f},
-std::array<float,2>{0.164050475f, 0.153058112f},
-std::array<float,2>{0.553723931f, 0.894530773f},
-std::array<float,2>{0.301220626f, 0.710845172f},
-std::array<float,2>{0.781855345f, 0.492683351f},
-std::array<float,2>{0.461128384f, 0.119961314f},
-std::array<float,2>{0.948757589f, 0.828151882f},
-std::array<float,2>{0.00831197482f, 0.523784757f},
-std::array<float,2>{0.6729092f, 0.364678025f},
-std::array<float,2>{0.135548756f, 0.474536151f},
-std::array<float,2>{0.519316494f, 0.698922634f},
-std::array<float,2>{0.275879115f, 0.887796938f},
-std::array<float,2>{0.751702666f, 0.129846781f},
-std::array<float,2>{0.339377671f, 0.258065552f},
-std::array<float,2>{0.861421049f, 0.613040149f},
-std::array<float,2>{0.232967973f, 0.777087331f},
-std::array<float,2>{0.585345209f, 0.0149740633f},
-std::array<float,2>{0.106357947f, 0.204557776f},
-std::array<float,2>{0.701952696f, 0.958445191f},
-std::array<float,2>{0.388530225f, 0.627690434f},
-std::array<float,2>{0.925320148f, 0.379920036f},
-std::array<float,2>{0.28461808f, 0.172685966f},
-std::array<float,2>{0.809414506f, 0.922413528f},
-std::array<float,2>{0.178785622f, 0.745310128f},
-std::array<float,2>{0.541665792f, 0.446432471f},
-std::array<float,2>{0.0587905496f, 0.31932956f},
-std::array<float,2>{0.653558433f, 0.545244217f},
-std::array<float,2>{0.469076395f, 0.84697324f},
-std::array<float,2>{0.987692237f, 0.0874865875f},
-std::array<float,2>{0.435035855f, 0.416300267f},
-std::array<float,2>{0.881723881f, 0.664416313f},
-std::array<float,2>{0.0792627856f, 0.983115733f},
-std::array<float,2>{0.727770805f, 0.239539355f},
-std::array<float,2>{0.211821318f, 0.0559858866f},
-std::array<float,2>{0.595057011f, 0.783053041f},
-std::array<float,2>{0.354614228f, 0.583790839f},
-std::array<float,2>{0.837181509f, 0.292945921f},
-std::array<float,2>{0.451541156f, 0.21237278f},
-std::array<float,2>{0.968202889f, 0.963858426f},
-std::array<float,2>{0.0157941803f, 0.634271383f},
-std::array<float,2>{0.662559211f, 0.387439013f},
-std::array<float,2>{0.150123075f, 0.25418517f},
-std::array<float,2>{0.500750124f, 0.618523657f},
-std::array<float,2>{0.257084757f, 0.77008009f},
-std::array<float,2>{0.770383418f, 0.0012941485f},
-std::array<float,2>{0.323992848f, 0.483935535f},
-std::array<float,2>{0.853055894f, 0.694064379f},
-std::array<float,2>{0.237995163f, 0.875454664f},
-std::array<float,2>{0.577517271f, 0.135567665f},
-std::array<float,2>{0.113787182f, 0.11630211f},
-std::array<float,2>{0.712919533f, 0.836942554f},
-std::array<float,2>{0.401534468f, 0.516940117f},
-std::array<float,2>{0.908724606f, 0.371683568f},
-std::array<float,2>{0.297630489f, 0.0513316691f},
-std::array<float,2>{0.787187159f, 0.795324922f},
-std::array<float,2>{0.159946904f, 0.589448214f},
-std::array<float,2>{0.547661304f, 0.288071722f},
-std::array<float,2>{0.033916384f, 0.407393545f},
-std::array<float,2>{0.63861084f, 0.656518519f},
-std::array<float,2>{0.4968355f, 0.972945809f},
-std::array<float,2>{0.983800113f, 0.242587924f},
-std::array<float,2>{0.411704987f, 0.323474526f},
-std::array<float,2>{0.89092356f, 0.534860671f},
-std::array<float,2>{0.0718314424f, 0.851603389f},
-std::array<float,2>{0.745545208f, 0.0826072767f},
-std::array<float,2>{0.202304631f, 0.182974234f},
-std::array<float,2>{0.620302916f, 0.930060685f},
-std::array<float,2>{0.370523006f, 0.74134481f},
-std::array<float,2>{0.815159798f, 0.443079859f},
-std::array<float,2>{0.382931769f, 0.0684908926f},
-std::array<float,2>{0.929595113f, 0.872008562f},
-std::array<float,2>{0.101894662f, 0.555183887f},
-std::array<float,2>{0.695641875f, 0.335526168f},
-std::array<float,2>{0.227292299f, 0.460978568f},
-std::array<float,2>{0.580012441f, 0.729178667f},
-std::array<float,2>{0.341041833f, 0.912901282f},
-std::array<float,2>{0.866688371f, 0.158021674f},
-std::array<float,2>{0.28038013f, 0.302417427f},
-std::array<float,2>{0.754098833f, 0.563608944f},
-std::array<float,2>{0.137064874f, 0.805905342f},
-std::array<float,2>{0.520947635f, 0.0416906551f},
-std::array<float,2>{0.0147155272f, 0.231495842f},
-std::array<float,2>{0.676189244f, 0.999920368f},
-std::array<float,2>{0.467689157f, 0.683636129f},
-std::array<float,2>{0.950738668f, 0.434590042f},
-std::array<float,2>{0.355926752f, 0.147507742f},
-std::array<float,2>{0.842048883f, 0.90156281f},
-std::array<float,2>{0.218410924f, 0.717065156f},
-std::array<float,2>{0.600843132f, 0.484751612f},
-std::array<float,2>{0.0846668631f, 0.348045886f},
-std::array<float,2>{0.733399808f, 0.503361225f},
-std::array<float,2>{0.432929844f, 0.824655116f},
-std::array<float,2>{0.875940263f, 0.104469791f},
-std::array<float,2>{0.475117207f, 0.404330552f},
-std::array<float,2>{0.991314471f, 0.643221736f},
-std::array<float,2>{0.0575884245f, 0.938963473f},
-std::array<float,2>{0.650185287f, 0.196123287f},
-std::array<float,2>{0.174425334f, 0.021442024f},
-std::array<float,2>{0.546319664f, 0.760577857f},
-std::array<float,2>{0.285502285f, 0.594096124f},
-std::array<float,2>{0.804712832f, 0.274328232f},
-std::array<float,2>{0.429625481f, 0.170854524f},
-std::array<float,2>{0.889184237f, 0.91685015f},
-std::array<float,2>{0.091620028f, 0.722442031f},
-std::array<float,2>{0.724675953f, 0.455722421f},
-std::array<float,2>{0.204793662f, 0.342564255f},
-std::array<float,2>{0.603818834f, 0.553667426f},
-std::array<float,2>{0.345132053f, 0.861831546f},
-std::array<float,2>{0.834933102f, 0.0731602311f},
-std::array<float,2>{0.290162474f, 0.428951412f},
-std::array<float,2>{0.799788594f, 0.674267948f},
-std::array<float,2>{0.185879692f, 0.988772511f},
-std::array<float,2>{0.538912177f, 0.22497268f},
-std::array<float,2>{0.0493779369f, 0.035699293f},
-std::array<float,2>{0.647308052f, 0.802747011f},
-std::array<float,2>{0.476920128f, 0.576701164f},
-std::array<float,2>{0.999183834f, 0.308521062f},
-std::array<float,2>{0.332809448f, 0.096711129f},
-std::array<float,2>{0.868512571f, 0.815476894f},
-std::array<float,2>{0.221910998f, 0.513096273f},
-std::array<float,2>{0.588343859f, 0.353830159f},
-std::array<float,2>{0.0940346718f, 0.496572495f},
-std::array<float,2>{0.690008819f, 0.704478204f},
-std::array<float,2>{0.381632179f, 0.89609462f},
-std::array<float,2>{0.930181563f, 0.150201425f},
-std::array<float,2>{0.453149766f, 0.266691208f},
-std::array<float,2>{0.943032086f, 0.603973866f},
-std::array<float,2>{0.00440290384f, 0.75748682f},
-std::array<float,2>{0.683508277f, 0.0307796579f},
-std::array<float,2>{0.131767094f, 0.194253877f},
-std::array<float,2>{0.530160964f, 0.947164416f},
-std::array<float,2>{0.27279374f, 0.65403825f},
-std::array<float,2>{0.7610147f, 0.393505603f},
-std::array<float,2>{0.490867823f, 0.0102307554f},
-std::array<float,2>{0.976342261f, 0.781238854f},
-std::array<float,2>{0.0458324291f, 0.615400136f},
-std::array<float,2>{0.62755239f, 0.26286155f},
-std::array<float,2>{0.166038454f, 0.37785539f},
-std::array<float,2>{0.561971486f, 0.630621612f},
-std::array<float,2>{0.308404237f, 0.955741644f},
-std::array<float,2>{0.796168327f, 0.207630247f},
-std::array<float,2>{0.365317285f, 0.359601557f},
-std::array<float,2>{0.822331786f, 0.529682875f},
-std::array<float,2>{0.193733618f, 0.835597634f},
-std::array<float,2>{0.612716258f, 0.124345124f},
-std::array<float,2>{0.0630515516f, 0.127757981f},
-std::array<float,2>{0.734670401f, 0.883360744f},
-std::array<float,2>{0.417232662f, 0.701535583f},
-std::array<float,2>{0.898636103f, 0.469164789f},
-std::array<float,2>{0.2651712f, 0.234999433f},
-std::array<float,2>{0.775176287f, 0.979954302f},
-std::array<float,2>{0.143687651f, 0.668415368f},
-std::array<float,2>{0.510309339f, 0.421253502f},
-std::array<float,2>{0.0239766259f, 0.294397712f},
-std::array<float,2>{0.666997373f, 0.581836641f},
-std::array<float,2>{0.442197889f, 0.786699593f},
-std::array<float,2>{0.953791559f, 0.0613172129f},
-std::array<float,2>{0.398010671f, 0.450005919f},
-std::array<float,2>{0.91838032f, 0.749104738f},
-std::array<float,2>{0.122894451f, 0.927451074f},
-std::array<float,2>{0.705574512f, 0.178611994f},
-std::array<float,2>{0.24839659f, 0.0919353366f},
-std::array<float,2>{0.563088715f, 0.851517618f},
-std::array<float,2>{0.31597501f, 0.542750001f},
-std::array<float,2>{0.851413012f, 0.313808858f},
-std::array<float,2>{0.464837343f, 0.129392579f},
-std::array<float,2>{0.945368946f, 0.888281405f},
-std::array<float,2>{0.0112321796f, 0.698321283f},
-std::array<float,2>{0.674324214f, 0.473785549f},
-std::array<float,2>{0.133826256f, 0.365129948f},
-std::array<float,2>{0.51658237f, 0.524167955f},
-std::array<float,2>{0.274554878f, 0.828842223f},
-std::array<float,2>{0.75227356f, 0.119580269f},
-std::array<float,2>{0.336296529f, 0.380375385f},
-std::array<float,2>{0.860086381f, 0.627372682f},
-std::array<float,2>{0.230509356f, 0.958792686f},
-std::array<float,2>{0.5825634f, 0.204941601f},
-std::array<float,2>{0.109283835f, 0.0152694052f},
-std::array<float,2>{0.700465202f, 0.776450574f},
-std::array<float,2>{0.390096456f, 0.612567961f},
-std::array<float,2>{0.923624158f, 0.258427233f},
-std::array<float,2>{0.281821936f, 0.0869925469f},
-std::array<float,2>{0.811946273f, 0.847601116f},
-std::array<float,2>{0.17733334f, 0.54584527f},
-std::array<float,2>{0.539920866f, 0.318622321f},
-std::array<float,2>{0.0613695197f, 0.446986318f},
-std::array<float,2>{0.655504584f, 0.745695353f},
-std::array<float,2>{0.471695632f, 0.922201693f},
-std::array<float,2>{0.984773219f, 0.17199865f},
-std::array<float,2>{0.437122822f, 0.292387664f},
-std::array<float,2>{0.88085115f, 0.583359182f},
-std::array<float,2>{0.0811528191f, 0.782419801f},
-std::array<float,2>{0.728845656f, 0.0563228205f},
-std::array<float,2>{0.213857725f, 0.240181342f},
-std::array<float,2>{0.596723914f, 0.982624412f},
-std::array<float,2>{0.353129774f, 0.664563f},
-std::array<float,2>{0.839430869f, 0.41657421f},
-std::array<float,2>{0.405360758f, 0.0325332098f},
-std::array<float,2>{0.910573006f, 0.797779381f},
-std::array<float,2>{0.110897996f, 0.573313534f},
-std::array<float,2>{0.717398703f, 0.311152041f},
-std::array<float,2>{0.238321573f, 0.422391385f},
-std::array<float,2>{0.572819173f, 0.679148674f},
-std::array<float,2>{0.326375127f, 0.987527013f},
-std::array<float,2>{0.857497573f, 0.220890254f},
-std::array<float,2>{0.250265419f, 0.338284612f},
-std::array<float,2>{0.768983364f, 0.548599422f},
-std::array<float,2>{0.154956043f, 0.864715278f},
-std::array<float,2>{0.505656362f, 0.0775058642f},
-std::array<float,2>{0.0197420716f, 0.166735128f},
-std::array<float,2>{0.656885803f, 0.92175591f},
-std::array<float,2>{0.449001074f, 0.726534665f},
-std::array<float,2>{0.963496149f, 0.457273096f},
-std::array<float,2>{0.374782979f, 0.191380233f},
-std::array<float,2>{0.818509638f, 0.950360715f},
-std::array<float,2>{0.19823575f, 0.649269342f},
-std::array<float,2>{0.62132591f, 0.397980243f},
-std::array<float,2>{0.0770487636f, 0.271862298f},
-std::array<float,2>{0.748502612f, 0.608256638f},
-std::array<float,2>{0.407688767f, 0.751018822f},
-std::array<float,2>{0.898070335f, 0.0264622886f},
-std::array<float,2>{0.494051993f, 0.492368102f},
-std::array<float,2>{0.980149269f, 0.710116982f},
-std::array<float,2>{0.0383794568f, 0.89392519f},
-std::array<float,2>{0.636356533f, 0.152661428f},
-std::array<float,2>{0.161884725f, 0.097706385f},
-std::array<float,2>{0.551398814f, 0.816651344f},
-std::array<float,2>{0.304217786f, 0.509416521f},
-std::array<float,2>{0.783695042f, 0.359248966f},
-std::array<float,2>{0.419729203f, 0.227793619f},
-std::array<float,2>{0.903605878f, 0.992908001f},
-std::array<float,2>{0.0674754456f, 0.682562351f},
-std::array<float,2>{0.74029994f, 0.432763547f},
-std::array<float,2>{0.190520853f, 0.29961127f},
-std::array<float,2>{0.61620456f, 0.566594779f},
-std::array<float,2>{0.362828642f, 0.81222111f},
-std::array<float,2>{0.825843692f, 0.0441562086f},
-std::array<float,2>{0.309618294f, 0.468296349f},
-std::array<float,2>{0.791486859f, 0.730754912f},
-std::array<float,2>{0.17182067f, 0.910143971f},
-std::array<float,2>{0.556037128f, 0.160212308f},
-std::array<float,2>{0.0406021737f, 0.0638017803f},
-std::array<float,2>{0.631986737f, 0.869522989f},
-std::array<float,2>{0.484417886f, 0.561448753f},
-std::array<float,2>{0.970645964f, 0.330791533f},
-std::array<float,2>{0.320249081f, 0.0157857817f},
-std::array<float,2>{0.843910933f, 0.763707101f},
-std::array<float,2>{0.245123312f, 0.597715676f},
-std::array<float,2>{0.567434192f, 0.277373791f},
-std::array<float,2>{0.118723959f, 0.401272357f},
-std::array<float,2>{0.708207011f, 0.646120667f},
-std::array<float,2>{0.390832782f, 0.941941321f},
-std::array<float,2>{0.917333901f, 0.200534582f},
-std::array<float,2>{0.439848155f, 0.344936192f},
-std::array<float,2>{0.959614933f, 0.50587213f},
-std::array<float,2>{0.0304939989f, 0.822819114f},
-std::array<float,2>{0.669305205f, 0.10669037f},
-std::array<float,2>{0.146368325f, 0.144266635f},
-std::array<float,2>{0.513128817f, 0.904258668f},
-std::array<float,2>{0.260123044f, 0.711695611f},
-std::array<float,2>{0.778399169f, 0.492090195f},
-std::array<float,2>{0.482045025f, 0.113230161f},
-std::array<float,2>{0.993950605f, 0.840228975f},
-std::array<float,2>{0.0543709993f, 0.520020902f},
-std::array<float,2>{0.644394636f, 0.367196918f},
-std::array<float,2>{0.182036996f, 0.479694873f},
-std::array<float,2>{0.53160125f, 0.687931955f},
-std::array<float,2>{0.295125276f, 0.882100105f},
-std::array<float,2>{0.801190913f, 0.137650207f},
-std::array<float,2>{0.351206213f, 0.252921522f},
-std::array<float,2>{0.831388116f, 0.622584105f},
-std::array<float,2>{0.207881868f, 0.769228399f},
-std::array<float,2>{0.608427703f, 0.00455718813f},
-std::array<float,2>{0.0864440873f, 0.217993915f},
-std::array<float,2>{0.720980287f, 0.967544496f},
-std::array<float,2>{0.425720751f, 0.638935864f},
-std::array<float,2>{0.884814918f, 0.383866131f},
-std::array<float,2>{0.268263996f, 0.185065761f},
-std::array<float,2>{0.762497783f, 0.935555637f},
-std::array<float,2>{0.126332045f, 0.736273348f},
-std::array<float,2>{0.523953319f, 0.439838737f},
-std::array<float,2>{0.000397854688f, 0.327832907f},
-std::array<float,2>{0.687127292f, 0.537579358f},
-std::array<float,2>{0.457208395f, 0.858247876f},
-std::array<float,2>{0.938756466f, 0.0809400156f},
-std::array<float,2>{0.378440589f, 0.411601752f},
-std::array<float,2>{0.933747828f, 0.660796642f},
-std::array<float,2>{0.0990108401f, 0.969610691f},
-std::array<float,2>{0.692961931f, 0.246169463f},
-std::array<float,2>{0.222892046f, 0.0476552434f},
-std::array<float,2>{0.593448639f, 0.791063547f},
-std::array<float,2>{0.328615487f, 0.592636704f},
-std::array<float,2>{0.873421729f, 0.281658977f},
-std::array<float,2>{0.488466352f, 0.207102388f},
-std::array<float,2>{0.974198282f, 0.955375373f},
-std::array<float,2>{0.0431500375f, 0.630326807f},
-std::array<float,2>{0.625126123f, 0.377108723f},
-std::array<float,2>{0.166000217f, 0.263253152f},
-std::array<float,2>{0.559046268f, 0.615786672f},
-std::array<float,2>{0.306289673f, 0.780276418f},
-std::array<float,2>{0.794331908f, 0.0104658576f},
-std::array<float,2>{0.365211904f, 0.46947065f},
-std::array<float,2>{0.821122408f, 0.702031314f},
-std::array<float,2>{0.192195863f, 0.882850111f},
-std::array<float,2>{0.610669553f, 0.127318755f},
-std::array<float,2>{0.0657505319f, 0.124965146f},
-std::array<float,2>{0.737487555f, 0.835188806f},
-std::array<float,2>{0.414431125f, 0.529883802f},
-std::array<float,2>{0.902021706f, 0.359934121f},
-std::array<float,2>{0.262139887f, 0.0607366972f},
-std::array<float,2>{0.776641369f, 0.78623569f},
-std::array<float,2>{0.141790152f, 0.581377029f},
-std::array<float,2>{0.509334683f, 0.294521183f},
-std::array<float,2>{0.0254300814f, 0.421485007f},
-std::array<float,2>{0.664791882f, 0.668733597f},
-std::array<float,2>{0.443691909f, 0.980214238f},
-std::array<float,2>{0.956062853f, 0.23484236f},
-std::array<float,2>{0.395931572f, 0.314152062f},
-std::array<float,2>{0.920469284f, 0.542354226f},
-std::array<float,2>{0.123156846f, 0.85103035f},
-std::array<float,2>{0.704053104f, 0.092444919f},
-std::array<float,2>{0.246745721f, 0.178022251f},
-std::array<float,2>{0.564453781f, 0.92682749f},
-std::array<float,2>{0.313731015f, 0.749596894f},
-std::array<float,2>{0.8483935f, 0.449417859f},
-std::array<float,2>{0.426687092f, 0.0727120116f},
-std::array<float,2>{0.888110876f, 0.861810982f},
-std::array<float,2>{0.0934968665f, 0.55304867f},
-std::array<float,2>{0.724120438f, 0.341824204f},
-std::array<float,2>{0.205870807f, 0.45543623f},
-std::array<float,2>{0.603228509f, 0.721887648f},
-std::array<float,2>{0.347008824f, 0.916303217f},
-std::array<float,2>{0.833066344f, 0.170253977f},
-std::array<float,2>{0.291919738f, 0.308071285f},
-std::array<float,2>{0.797335088f, 0.576178491f},
-std::array<float,2>{0.184539914f, 0.803361177f},
-std::array<float,2>{0.537092149f, 0.0356234275f},
-std::array<float,2>{0.0474186391f, 0.225124985f},
-std::array<float,2>{0.645440698f, 0.98837769f},
-std::array<float,2>{0.478947878f, 0.674562991f},
-std::array<float,2>{0.996816516f, 0.429498374f},
-std::array<float,2>{0.334543288f, 0.149585798f},
-std::array<float,2>{0.869651675f, 0.895778298f},
-std::array<float,2>{0.220605731f, 0.704765379f},
-std::array<float,2>{0.586522579f, 0.496641129f},
-std::array<float,2>{0.0973456725f, 0.354332894f},
-std::array<float,2>{0.689228952f, 0.513405025f},
-std::array<float,2>{0.379421502f, 0.815945387f},
-std::array<float,2>{0.93300277f, 0.0975956321f},
-std::array<float,2>{0.455627352f, 0.392999709f},
-std::array<float,2>{0.945218384f, 0.653434813f},
-std::array<float,2>{0.00710061984f, 0.94633317f},
-std::array<float,2>{0.681436777f, 0.193503335f},
-std::array<float,2>{0.129917189f, 0.0304501876f},
-std::array<float,2>{0.5277825f, 0.756875932f},
-std::array<float,2>{0.271289498f, 0.604179323f},
-std::array<float,2>{0.759532332f, 0.267359912f},
-std::array<float,2>{0.385386884f, 0.157326922f},
-std::array<float,2>{0.926419616f, 0.912268102f},
-std::array<float,2>{0.103912607f, 0.728874326f},
-std::array<float,2>{0.698729753f, 0.461743265f},
-std::array<float,2>{0.22956641f, 0.335040271f},
-std::array<float,2>{0.580743551f, 0.555057883f},
-std::array<float,2>{0.341868192f, 0.871277153f},
-std::array<float,2>{0.865196228f, 0.0689890534f},
-std::array<float,2>{0.277531654f, 0.435357183f},
-std::array<float,2>{0.755998909f, 0.684118927f},
-std::array<float,2>{0.140290856f, 0.999234796f},
-std::array<float,2>{0.521514118f, 0.232092291f},
-std::array<float,2>{0.0131808436f, 0.0413211137f},
-std::array<float,2>{0.677743375f, 0.806299269f},
-std::array<float,2>{0.465610862f, 0.564280033f},
-std::array<float,2>{0.952838063f, 0.302097797f},
-std::array<float,2>{0.358677596f, 0.103922151f},
-std::array<float,2>{0.841327548f, 0.824834704f},
-std::array<float,2>{0.216511309f, 0.503652513f},
-std::array<float,2>{0.598378301f, 0.348494262f},
-std::array<float,2>{0.0834104195f, 0.485076845f},
-std::array<float,2>{0.731851637f, 0.717415273f},
-std::array<float,2>{0.429848433f, 0.902190328f},
-std::array<float,2>{0.877704084f, 0.148359582f},
-std::array<float,2>{0.473511934f, 0.273905188f},
-std::array<float,2>{0.990035713f, 0.59463495f},
-std::array<float,2>{0.0560901314f, 0.760120571f},
-std::array<float,2>{0.651426911f, 0.0209865533f},
-std::array<float,2>{0.173090711f, 0.195422098f},
-std::array<float,2>{0.543145061f, 0.939446211f},
-std::array<float,2>{0.287982166f, 0.642862856f},
-std::array<float,2>{0.807212412f, 0.405163348f},
-std::array<float,2>{0.450407565f, 0.00152810628f},
-std::array<float,2>{0.96539104f, 0.769616902f},
-std::array<float,2>{0.019022651f, 0.619064569f},
-std::array<float,2>{0.660639584f, 0.254633963f},
-std::array<float,2>{0.15140678f, 0.386808217f},
-std::array<float,2>{0.502988338f, 0.634289384f},
-std::array<float,2>{0.254722059f, 0.962906241f},
-std::array<float,2>{0.772943914f, 0.212571621f},
-std::array<float,2>{0.321917772f, 0.371376276f},
-std::array<float,2>{0.853742838f, 0.517306447f},
-std::array<float,2>{0.234817877f, 0.837517977f},
-std::array<float,2>{0.575101912f, 0.116836421f},
-std::array<float,2>{0.116741218f, 0.135046244f},
-std::array<float,2>{0.712736905f, 0.875625849f},
-std::array<float,2>{0.399634659f, 0.69367373f},
-std::array<float,2>{0.907034099f, 0.483787924f},
-std::array<float,2>{0.298990726f, 0.242949203f},
-std::array<float,2>{0.786606491f, 0.973228812f},
-std::array<float,2>{0.158121958f, 0.65698415f},
-std::array<float,2>{0.549608529f, 0.408168405f},
-std::array<float,2>{0.0313191526f, 0.287456483f},
-std::array<float,2>{0.640061855f, 0.589348197f},
-std::array<float,2>{0.499166042f, 0.795537591f},
-std::array<float,2>{0.980661631f, 0.0509519763f},
-std::array<float,2>{0.412922829f, 0.442398638f},
-std::array<float,2>{0.892681301f, 0.742164731f},
-std::array<float,2>{0.0735175684f, 0.930447578f},
-std::array<float,2>{0.742914736f, 0.183514059f},
-std::array<float,2>{0.20057559f, 0.0821267813f},
-std::array<float,2>{0.617237329f, 0.85253787f},
-std::array<float,2>{0.368250132f, 0.534604132f},
-std::array<float,2>{0.813362896f, 0.323901534f},
-std::array<float,2>{0.469548881f, 0.175689057f},
-std::array<float,2>{0.988109708f, 0.925086141f},
-std::array<float,2>{0.0593494996f, 0.743439615f},
-std::array<float,2>{0.653956056f, 0.44756788f},
-std::array<float,2>{0.179582343f, 0.317579091f},
-std::array<float,2>{0.541068077f, 0.544414461f},
-std::array<float,2>{0.285082906f, 0.845132411f},
-std::array<float,2>{0.808833718f, 0.0884595215f},
-std::array<float,2>{0.355161369f, 0.414753735f},
-std::array<float,2>{0.8376019f, 0.666296005f},
-std::array<float,2>{0.211102366f, 0.981764734f},
-std::array<float,2>{0.595482171f, 0.241442636f},
-std::array<float,2>{0.0796297863f, 0.0574463755f},
-std::array<float,2>{0.728308499f, 0.784280717f},
-std::array<float,2>{0.435165673f, 0.585534751f},
-std::array<float,2>{0.881181955f, 0.290575951f},
-std::array<float,2>{0.275532961f, 0.118507437f},
-std::array<float,2>{0.751157939f, 0.830131531f},
-std::array<float,2>{0.135098487f, 0.527183712f},
-std::array<float,2>{0.518645227f, 0.365672439f},
-std::array<float,2>{0.00828078389f, 0.474788159f},
-std::array<float,2>{0.673372507f, 0.696423948f},
-std::array<float,2>{0.461565346f, 0.889217198f},
-std::array<float,2>{0.948357224f, 0.131185845f},
-std::array<float,2>{0.388179839f, 0.260260105f},
-std::array<float,2>{0.925200284f, 0.60983938f},
-std::array<float,2>{0.105788991f, 0.774303377f},
-std::array<float,2>{0.701551974f, 0.0130030382f},
-std::array<float,2>{0.232554615f, 0.205822915f},
-std::array<float,2>{0.585454166f, 0.959777772f},
-std::array<float,2>{0.339126587f, 0.626453102f},
-std::array<float,2>{0.862122893f, 0.381422043f},
-std::array<float,2>{0.409693748f, 0.0243054796f},
-std::array<float,2>{0.896116495f, 0.752556443f},
-std::array<float,2>{0.0748485178f, 0.606240869f},
-std::array<float,2>{0.747260153f, 0.270583779f},
-std::array<float,2>{0.197047949f, 0.395964414f},
-std::array<float,2>{0.623847544f, 0.651022136f},
-std::array<float,2>{0.372162342f, 0.952480018f},
-std::array<float,2>{0.816977084f, 0.188246325f},
-std::array<float,2>{0.301575005f, 0.357008964f},
-std::array<float,2>{0.781598866f, 0.510389566f},
-std::array<float,2>{0.163154334f, 0.820100009f},
-std::array<float,2>{0.554376125f, 0.0999459699f},
-std::array<float,2>{0.0355702974f, 0.154664174f},
-std::array<float,2>{0.633687019f, 0.891104639f},
-std::array<float,2>{0.494625896f, 0.707688689f},
-std::array<float,2>{0.976798713f, 0.495740175f},
-std::array<float,2>{0.325967968f, 0.218906f},
-std::array<float,2>{0.856002092f, 0.985066235f},
-std::array<float,2>{0.241672724f, 0.677725732f},
-std::array<float,2>{0.572120667f, 0.424844533f},
-std::array<float,2>{0.112176225f, 0.308827102f},
-std::array<float,2>{0.715897739f, 0.572109401f},
-std::array<float,2>{0.403697461f, 0.799022496f},
-std::array<float,2>{0.913630366f, 0.0345329046f},
-std::array<float,2>{0.445350826f, 0.459154367f},
-std::array<float,2>{0.961681902f, 0.723163128f},
-std::array<float,2>{0.021820154f, 0.91966939f},
-std::array<float,2>{0.659377754f, 0.165378943f},
-std::array<float,2>{0.153292611f, 0.0756838024f},
-std::array<float,2>{0.507509768f, 0.865445316f},
-std::array<float,2>{0.25321281f, 0.549342752f},
-std::array<float,2>{0.766564488f, 0.336628944f},
-std::array<float,2>{0.392740279f, 0.20125632f},
-std::array<float,2>{0.914159f, 0.943951845f},
-std::array<float,2>{0.120712072f, 0.648301959f},
-std::array<float,2>{0.70997113f, 0.399286389f},
-std::array<float,2>{0.242867619f, 0.279323965f},
-std::array<float,2>{0.568801403f, 0.600201666f},
-std::array<float,2>{0.31718865f, 0.762292206f},
-std::array<float,2>{0.84687084f, 0.0187051818f},
-std::array<float,2>{0.257890821f, 0.48974663f},
-std::array<float,2>{0.780738652f, 0.713748455f},
-std::array<float,2>{0.146813944f, 0.904856801f},
-std::array<float,2>{0.515482366f, 0.142068133f},
-std::array<float,2>{0.0281784832f, 0.108110867f},
-std::array<float,2>{0.670907259f, 0.821924508f},
-std::array<float,2>{0.437565714f, 0.50531286f},
-std::array<float,2>{0.958709896f, 0.346783668f},
-std::array<float,2>{0.359555513f, 0.0449661203f},
-std::array<float,2>{0.826265872f, 0.808973551f},
-std::array<float,2>{0.188663423f, 0.568427503f},
-std::array<float,2>{0.613730431f, 0.297529548f},
-std::array<float,2>{0.069606334f, 0.43047753f},
-std::array<float,2>{0.738377333f, 0.681239545f},
-std::array<float,2>{0.42155084f, 0.995666623f},
-std::array<float,2>{0.906151474f, 0.229792312f},
-std::array<float,2>{0.487921685f, 0.329798073f},
-std::array<float,2>{0.971087098f, 0.558962941f},
-std::array<float,2>{0.0427724496f, 0.868782043f},
-std::array<float,2>{0.629615068f, 0.0650749505f},
-std::array<float,2>{0.168584749f, 0.162467763f},
-std::array<float,2>{0.557133496f, 0.908025622f},
-std::array<float,2>{0.311364591f, 0.733117223f},
-std::array<float,2>{0.789697766f, 0.466765553f},
-std::array<float,2>{0.460425258f, 0.0787112564f},
-std::array<float,2>{0.939658463f, 0.85655725f},
-std::array<float,2>{0.00339248311f, 0.536968172f},
-std::array<float,2>{0.684981048f, 0.325251907f},
-std::array<float,2>{0.126989439f, 0.438876778f},
-std::array<float,2>{0.52585876f, 0.736818552f},
-std::array<float,2>{0.266834527f, 0.933861256f},
-std::array<float,2>{0.764546156f, 0.185772106f},
-std::array<float,2>{0.330537111f, 0.283849031f},
-std::array<float,2>{0.871097326f, 0.591100872f},
-std::array<float,2>{0.225983426f, 0.789744556f},
-std::array<float,2>{0.590331018f, 0.0490006618f},
-std::array<float,2>{0.100683056f, 0.248723835f},
-std::array<float,2>{0.694105268f, 0.971157312f},
-std::array<float,2>{0.376234561f, 0.663849711f},
-std::array<float,2>{0.937332213f, 0.41396603f},
-std::array<float,2>{0.294785976f, 0.140023321f},
-std::array<float,2>{0.803129196f, 0.880096912f},
-std::array<float,2>{0.180036828f, 0.690787911f},
-std::array<float,2>{0.533737719f, 0.477068752f},
-std::array<float,2>{0.0522967763f, 0.370212227f},
-std::array<float,2>{0.641331553f, 0.521960199f},
-std::array<float,2>{0.483279109f, 0.842841983f},
-std::array<float,2>{0.995230019f, 0.110089652f},
-std::array<float,2>{0.422029823f, 0.385117173f},
-std::array<float,2>{0.883505046f, 0.63755548f},
-std::array<float,2>{0.0895014852f, 0.966045797f},
-std::array<float,2>{0.720411777f, 0.216300413f},
-std::array<float,2>{0.21083267f, 0.00671459036f},
-std::array<float,2>{0.607227027f, 0.76691258f},
-std::array<float,2>{0.347747505f, 0.623705387f},
-std::array<float,2>{0.829998553f, 0.250030935f},
-std::array<float,2>{0.441795498f, 0.237740204f},
-std::array<float,2>{0.953520894f, 0.976840138f},
-std::array<float,2>{0.023717314f, 0.670789421f},
-std::array<float,2>{0.667803824f, 0.417973399f},
-std::array<float,2>{0.144404694f, 0.295119941f},
-std::array<float,2>{0.510101616f, 0.578726411f},
-std::array<float,2>{0.264770716f, 0.788435519f},
-std::array<float,2>{0.774528265f, 0.0598069131f},
-std::array<float,2>{0.315638304f, 0.451676399f},
-std::array<float,2>{0.850810647f, 0.746867537f},
-std::array<float,2>{0.24860698f, 0.929204226f},
-std::array<float,2>{0.562668979f, 0.177081436f},
-std::array<float,2>{0.122529134f, 0.0903321505f},
-std::array<float,2>{0.705244362f, 0.848805368f},
-std::array<float,2>{0.397614002f, 0.539282382f},
-std::array<float,2>{0.91863668f, 0.316125214f},
-std::array<float,2>{0.307636172f, 0.00790223014f},
-std::array<float,2>{0.79654038f, 0.77753067f},
-std::array<float,2>{0.166542709f, 0.614670753f},
-std::array<float,2>{0.562344491f, 0.264735311f},
-std::array<float,2>{0.0450109653f, 0.37587446f},
-std::array<float,2>{0.627076983f, 0.631349921f},
-std::array<float,2>{0.490407467f, 0.953770578f},
-std::array<float,2>{0.975811005f, 0.209903866f},
-std::array<float,2>{0.417717099f, 0.362052441f},
-std::array<float,2>{0.899205267f, 0.528060257f},
-std::array<float,2>{0.0626783296f, 0.832484424f},
-std::array<float,2>{0.735167563f, 0.123027794f},
-std::array<float,2>{0.19419381f, 0.125280023f},
-std::array<float,2>{0.612949073f, 0.885061383f},
-std::array<float,2>{0.365902334f, 0.699464202f},
-std::array<float,2>{0.823127687f, 0.471743107f},
-std::array<float,2>{0.380973607f, 0.0949710384f},
-std::array<float,2>{0.930095375f, 0.813523471f},
-std::array<float,2>{0.0945447385f, 0.515356421f},
-std::array<float,2>{0.689728498f, 0.352735519f},
-std::array<float,2>{0.22244899f, 0.498313636f},
-std::array<float,2>{0.588466406f, 0.705597341f},
-std::array<float,2>{0.3324157f, 0.897705436f},
-std::array<float,2>{0.868676364f, 0.151234582f},
-std::array<float,2>{0.273428619f, 0.269153059f},
-std::array<float,2>{0.761521578f, 0.601920128f},
-std::array<float,2>{0.131239176f, 0.754576027f},
-std::array<float,2>{0.529730737f, 0.0287014917f},
-std::array<float,2>{0.00410687597f, 0.192113876f},
-std::array<float,2>{0.682903767f, 0.947986484f},
-std::array<float,2>{0.453981727f, 0.654740334f},
-std::array<float,2>{0.942734718f, 0.391014755f},
-std::array<float,2>{0.345548302f, 0.168766424f},
-std::array<float,2>{0.834282041f, 0.914972663f},
-std::array<float,2>{0.204466343f, 0.719150603f},
-std::array<float,2>{0.604477167f, 0.454389781f},
-std::array<float,2>{0.0909745768f, 0.341117471f},
-std::array<float,2>{0.725495517f, 0.551932454f},
-std::array<float,2>{0.429198116f, 0.860296071f},
-std::array<float,2>{0.888738573f, 0.0719250813f},
-std::array<float,2>{0.477485508f, 0.426498383f},
-std::array<float,2>{0.999924302f, 0.673448682f},
-std::array<float,2>{0.0491025224f, 0.9920578f},
-std::array<float,2>{0.646917403f, 0.22360222f},
-std::array<float,2>{0.186306685f, 0.0374186039f},
-std::array<float,2>{0.53809768f, 0.801081955f},
-std::array<float,2>{0.291012794f, 0.575514317f},
-std::array<float,2>{0.798848867f, 0.306353927f},
-std::array<float,2>{0.433185428f, 0.145314798f},
-std::array<float,2>{0.875362873f, 0.898709595f},
-std::array<float,2>{0.0844069794f, 0.714978993f},
-std::array<float,2>{0.733901083f, 0.487896085f},
-std::array<float,2>{0.218216091f, 0.350372463f},
-std::array<float,2>{0.601401448f, 0.501884341f},
-std::array<float,2>{0.356356353f, 0.827349186f},
-std::array<float,2>{0.842459202f, 0.102212995f},
-std::array<float,2>{0.285924941f, 0.402376115f},
-std::array<float,2>{0.805330157f, 0.640732169f},
-std::array<float,2>{0.174090356f, 0.939629257f},
-std::array<float,2>{0.546580553f, 0.197646394f},
-std::array<float,2>{0.0568777919f, 0.0218179617f},
-std::array<float,2>{0.649668872f, 0.758219361f},
-std::array<float,2>{0.475097388f, 0.596868515f},
-std::array<float,2>{0.991803527f, 0.275424063f},
-std::array<float,2>{0.34154588f, 0.0668783784f},
-std::array<float,2>{0.866900206f, 0.873712957f},
-std::array<float,2>{0.226968154f, 0.557788372f},
-std::array<float,2>{0.579116523f, 0.333942443f},
-std::array<float,2>{0.102415301f, 0.462959766f},
-std::array<float,2>{0.696081996f, 0.727810323f},
-std::array<float,2>{0.383413434f, 0.911281765f},
-std::array<float,2>{0.928951025f, 0.159335464f},
-std::array<float,2>{0.467062861f, 0.304215401f},
-std::array<float,2>{0.950284064f, 0.565322161f},
-std::array<float,2>{0.0153956544f, 0.806705534f},
-std::array<float,2>{0.676561832f, 0.0407430194f},
-std::array<float,2>{0.137432694f, 0.232793525f},
-std::array<float,2>{0.521102667f, 0.996489525f},
-std::array<float,2>{0.281158f, 0.686984241f},
-std::array<float,2>{0.754464209f, 0.436343968f},
-std::array<float,2>{0.496179432f, 0.0537076667f},
-std::array<float,2>{0.984282851f, 0.794331193f},
-std::array<float,2>{0.0333191715f, 0.587654114f},
-std::array<float,2>{0.638155937f, 0.286485046f},
-std::array<float,2>{0.159201726f, 0.40943408f},
-std::array<float,2>{0.547009408f, 0.659624517f},
-std::array<float,2>{0.297003537f, 0.975069761f},
-std::array<float,2>{0.787848294f, 0.244842499f},
-std::array<float,2>{0.370985955f, 0.320907265f},
-std::array<float,2>{0.814526498f, 0.531319201f},
-std::array<float,2>{0.20309487f, 0.853992939f},
-std::array<float,2>{0.620856643f, 0.0841029659f},
-std::array<float,2>{0.0712985694f, 0.180563137f},
-std::array<float,2>{0.745918393f, 0.931784153f},
-std::array<float,2>{0.411501616f, 0.739257991f},
-std::array<float,2>{0.891475081f, 0.445094347f},
-std::array<float,2>{0.257585883f, 0.214644507f},
-std::array<float,2>{0.769586384f, 0.961720765f},
-std::array<float,2>{0.149672225f, 0.636203647f},
-std::array<float,2>{0.50033778f, 0.389035761f},
-std::array<float,2>{0.0164952539f, 0.256603837f},
-std::array<float,2>{0.662968397f, 0.620118499f},
-std::array<float,2>{0.451840192f, 0.772531211f},
-std::array<float,2>{0.968685389f, 0.00328199915f},
-std::array<float,2>{0.401926935f, 0.481682718f},
-std::array<float,2>{0.908421934f, 0.692669034f},
-std::array<float,2>{0.113573834f, 0.878172815f},
-std::array<float,2>{0.713573635f, 0.133086413f},
-std::array<float,2>{0.237354442f, 0.11469236f},
-std::array<float,2>{0.577910244f, 0.838475049f},
-std::array<float,2>{0.323719025f, 0.519390821f},
-std::array<float,2>{0.852889299f, 0.374647766f},
-std::array<float,2>{0.447871119f, 0.164941192f},
-std::array<float,2>{0.964450717f, 0.918080628f},
-std::array<float,2>{0.02108147f, 0.724394917f},
-std::array<float,2>{0.657933116f, 0.460111022f},
-std::array<float,2>{0.155321702f, 0.337776512f},
-std::array<float,2>{0.504108667f, 0.550687611f},
-std::array<float,2>{0.251728237f, 0.866857111f},
-std::array<float,2>{0.768484294f, 0.0742311031f},
-std::array<float,2>{0.327632248f, 0.423871249f},
-std::array<float,2>{0.859193444f, 0.676591575f},
-std::array<float,2>{0.240225598f, 0.986146629f},
-std::array<float,2>{0.574104548f, 0.220219448f},
-std::array<float,2>{0.110331304f, 0.0334113501f},
-std::array<float,2>{0.718532383f, 0.800228f},
-std::array<float,2>{0.404406667f, 0.571220338f},
-std::array<float,2>{0.911242247f, 0.309813738f},
-std::array<float,2>{0.303388119f, 0.100687139f},
-std::array<float,2>{0.784203827f, 0.819280922f},
-std::array<float,2>{0.160354629f, 0.511640966f},
-std::array<float,2>{0.55177784f, 0.355552018f},
-std::array<float,2>{0.037581373f, 0.494456559f},
-std::array<float,2>{0.635281146f, 0.708529115f},
-std::array<float,2>{0.492517501f, 0.892199934f},
-std::array<float,2>{0.978974223f, 0.155515298f},
-std::array<float,2>{0.406933397f, 0.269964129f},
-std::array<float,2>{0.896549463f, 0.606886744f},
-std::array<float,2>{0.0776938424f, 0.753686666f},
-std::array<float,2>{0.749290884f, 0.0244866945f},
-std::array<float,2>{0.198332414f, 0.188521996f},
-std::array<float,2>{0.622704208f, 0.951723397f},
-std::array<float,2>{0.373180866f, 0.65175271f},
-std::array<float,2>{0.81953007f, 0.394900799f},
-std::array<float,2>{0.389389873f, 0.0124385236f},
-std::array<float,2>{0.922556221f, 0.775287986f},
-std::array<float,2>{0.108060405f, 0.611233056f},
-std::array<float,2>{0.699468195f, 0.261544675f},
-std::array<float,2>{0.232061759f, 0.381955087f},
-std::array<float,2>{0.583089113f, 0.625813067f},
-std::array<float,2>{0.337282211f, 0.960554719f},
-std::array<float,2>{0.861001313f, 0.206963405f},
-std::array<float,2>{0.274189532f, 0.366230547f},
-std::array<float,2>{0.752946734f, 0.525994837f},
-std::array<float,2>{0.132866561f, 0.831806302f},
-std::array<float,2>{0.517556846f, 0.118042178f},
-std::array<float,2>{0.0105317766f, 0.132278651f},
-std::array<float,2>{0.675636292f, 0.890440822f},
-std::array<float,2>{0.463356465f, 0.695842028f},
-std::array<float,2>{0.947112858f, 0.4760741f},
-std::array<float,2>{0.351979941f, 0.240424573f},
-std::array<float,2>{0.83848536f, 0.981374204f},
-std::array<float,2>{0.214091748f, 0.667051733f},
-std::array<float,2>{0.596647084f, 0.41530171f},
-std::array<float,2>{0.0804663897f, 0.289528996f},
-std::array<float,2>{0.730458856f, 0.584699154f},
-std::array<float,2>{0.435580343f, 0.783868968f},
-std::array<float,2>{0.87932831f, 0.0577727295f},
-std::array<float,2>{0.47102347f, 0.448346257f},
-std::array<float,2>{0.985591173f, 0.74247539f},
-std::array<float,2>{0.0616584271f, 0.924594879f},
-std::array<float,2>{0.655140519f, 0.174163982f},
-std::array<float,2>{0.176234454f, 0.0893273205f},
-std::array<float,2>{0.540268064f, 0.843924344f},
-std::array<float,2>{0.282277346f, 0.54300338f},
-std::array<float,2>{0.811134458f, 0.317030191f},
-std::array<float,2>{0.424659044f, 0.215741888f},
-std::array<float,2>{0.886629522f, 0.965566278f},
-std::array<float,2>{0.0878496692f, 0.638580024f},
-std::array<float,2>{0.722401142f, 0.386643618f},
-std::array<float,2>{0.208237842f, 0.251259446f},
-std::array<float,2>{0.60814333f, 0.624088287f},
-std::array<float,2>{0.349650711f, 0.766326964f},
-std::array<float,2>{0.830577552f, 0.0075229886f},
-std::array<float,2>{0.296243787f, 0.478333652f},
-std::array<float,2>{0.802419424f, 0.689856946f},
-std::array<float,2>{0.18345435f, 0.879591167f},
-std::array<float,2>{0.532696426f, 0.139564663f},
-std::array<float,2>{0.0535779744f, 0.111098059f},
-std::array<float,2>{0.642901599f, 0.842335939f},
-std::array<float,2>{0.480513752f, 0.523097515f},
-std::array<float,2>{0.992919147f, 0.369804353f},
-std::array<float,2>{0.329862922f, 0.0506420135f},
-std::array<float,2>{0.874431312f, 0.790203571f},
-std::array<float,2>{0.224280655f, 0.590702236f},
-std::array<float,2>{0.59232074f, 0.284885317f},
-std::array<float,2>{0.098409161f, 0.412902683f},
-std::array<float,2>{0.691574812f, 0.662780166f},
-std::array<float,2>{0.37782672f, 0.972522795f},
-std::array<float,2>{0.935173452f, 0.249299496f},
-std::array<float,2>{0.458579987f, 0.32437107f},
-std::array<float,2>{0.938392162f, 0.535547376f},
-std::array<float,2>{0.00168273668f, 0.855719745f},
-std::array<float,2>{0.685865462f, 0.0791397616f},
-std::array<float,2>{0.125075758f, 0.186523721f},
-std::array<float,2>{0.525174081f, 0.935101628f},
-std::array<float,2>{0.269356489f, 0.738037825f},
-std::array<float,2>{0.762853146f, 0.437500268f},
-std::array<float,2>{0.486260682f, 0.0661286861f},
-std::array<float,2>{0.969010711f, 0.867676318f},
-std::array<float,2>{0.0396541804f, 0.560147762f},
-std::array<float,2>{0.631238222f, 0.328125149f},
-std::array<float,2>{0.170228019f, 0.46580261f},
-std::array<float,2>{0.55550158f, 0.734189928f},
-std::array<float,2>{0.308890134f, 0.906352162f},
-std::array<float,2>{0.792895854f, 0.163273782f},
-std::array<float,2>{0.361608654f, 0.298515528f},
-std::array<float,2>{0.824290454f, 0.569927514f},
-std::array<float,2>{0.189783558f, 0.8098827f},
-std::array<float,2>{0.616903603f, 0.046839308f},
-std::array<float,2>{0.0667121932f, 0.228709921f},
-std::array<float,2>{0.742120564f, 0.994215906f},
-std::array<float,2>{0.418833494f, 0.680537701f},
-std::array<float,2>{0.902386665f, 0.430734545f},
-std::array<float,2>{0.261281073f, 0.140720114f},
-std::array<float,2>{0.777574778f, 0.905682266f},
-std::array<float,2>{0.144686311f, 0.714601159f},
-std::array<float,2>{0.511838019f, 0.488557786f},
-std::array<float,2>{0.0296670608f, 0.346375585f},
-std::array<float,2>{0.668110549f, 0.50427103f},
-std::array<float,2>{0.441163033f, 0.821159244f},
-std::array<float,2>{0.960917413f, 0.108672656f},
-std::array<float,2>{0.392439067f, 0.400037557f},
-std::array<float,2>{0.916256666f, 0.647034049f},
-std::array<float,2>{0.117434375f, 0.944422364f},
-std::array<float,2>{0.707525492f, 0.203072965f},
-std::array<float,2>{0.245046243f, 0.0178409666f},
-std::array<float,2>{0.567201972f, 0.762845397f},
-std::array<float,2>{0.319130749f, 0.600641191f},
-std::array<float,2>{0.845002949f, 0.280383378f},
-std::array<float,2>{0.479549259f, 0.22429058f},
-std::array<float,2>{0.997177303f, 0.99105072f},
-std::array<float,2>{0.048526682f, 0.672392905f},
-std::array<float,2>{0.645670831f, 0.427188247f},
-std::array<float,2>{0.18474181f, 0.305247217f},
-std::array<float,2>{0.535261333f, 0.574722588f},
-std::array<float,2>{0.292016089f, 0.802137733f},
-std::array<float,2>{0.798569977f, 0.0386507697f},
-std::array<float,2>{0.346545845f, 0.453584194f},
-std::array<float,2>{0.833006322f, 0.719938219f},
-std::array<float,2>{0.206596494f, 0.915527999f},
-std::array<float,2>{0.602538526f, 0.1695804f},
-std::array<float,2>{0.0920141339f, 0.0711901188f},
-std::array<float,2>{0.72322017f, 0.860615671f},
-std::array<float,2>{0.427496433f, 0.551588356f},
-std::array<float,2>{0.887467563f, 0.340124577f},
-std::array<float,2>{0.270238131f, 0.0273792297f},
-std::array<float,2>{0.757926643f, 0.755570948f},
-std::array<float,2>{0.129599974f, 0.602817774f},
-std::array<float,2>{0.529050887f, 0.268064916f},
-std::array<float,2>{0.00670249294f, 0.391653538f},
-std::array<float,2>{0.680455744f, 0.655948579f},
-std::array<float,2>{0.457019418f, 0.948302627f},
-std::array<float,2>{0.943893433f, 0.192746669f},
-std::array<float,2>{0.380723506f, 0.352489978f},
-std::array<float,2>{0.93214035f, 0.51434958f},
-std::array<float,2>{0.0960853845f, 0.812951326f},
-std::array<float,2>{0.687679887f, 0.0944622084f},
-std::array<float,2>{0.219411835f, 0.151424259f},
-std::array<float,2>{0.587424457f, 0.897301018f},
-std::array<float,2>{0.335005194f, 0.706532955f},
-std::array<float,2>{0.870480359f, 0.499688625f},
-std::array<float,2>{0.415444881f, 0.122053176f},
-std::array<float,2>{0.901097238f, 0.833200812f},
-std::array<float,2>{0.065317817f, 0.528705418f},
-std::array<float,2>{0.736712575f, 0.362865537f},
-std::array<float,2>{0.193114325f, 0.471273303f},
-std::array<float,2>{0.609932482f, 0.700582623f},
-std::array<float,2>{0.363442212f, 0.885795236f},
-std::array<float,2>{0.821374953f, 0.126134098f},
-std::array<float,2>{0.30558607f, 0.264267147f},
-std::array<float,2>{0.793326676f, 0.614034832f},
-std::array<float,2>{0.164560929f, 0.77847904f},
-std::array<float,2>{0.559694886f, 0.00913638994f},
-std::array<float,2>{0.0443990305f, 0.210854784f},
-std::array<float,2>{0.626911402f, 0.954134703f},
-std::array<float,2>{0.490025342f, 0.631926894f},
-std::array<float,2>{0.973069787f, 0.376949161f},
-std::array<float,2>{0.312828183f, 0.176709503f},
-std::array<float,2>{0.849369824f, 0.928019047f},
-std::array<float,2>{0.247745275f, 0.74716723f},
-std::array<float,2>{0.56602627f, 0.452430099f},
-std::array<float,2>{0.124706686f, 0.315156281f},
-std::array<float,2>{0.704838157f, 0.540724933f},
-std::array<float,2>{0.394976288f, 0.84844321f},
-std::array<float,2>{0.921810091f, 0.0908328518f},
-std::array<float,2>{0.444544762f, 0.41931808f},
-std::array<float,2>{0.955691576f, 0.671535134f},
-std::array<float,2>{0.0268949587f, 0.97821188f},
-std::array<float,2>{0.665758133f, 0.236707106f},
-std::array<float,2>{0.140665203f, 0.0589262657f},
-std::array<float,2>{0.508571982f, 0.788034916f},
-std::array<float,2>{0.263182163f, 0.579632998f},
-std::array<float,2>{0.776005805f, 0.296118021f},
-std::array<float,2>{0.398782372f, 0.133874312f},
-std::array<float,2>{0.908109188f, 0.877825141f},
-std::array<float,2>{0.116030693f, 0.692201555f},
-std::array<float,2>{0.711325347f, 0.480842441f},
-std::array<float,2>{0.235903516f, 0.373155117f},
-std::array<float,2>{0.57544136f, 0.517904639f},
-std::array<float,2>{0.320471585f, 0.839708745f},
-std::array<float,2>{0.854522943f, 0.113981925f},
-std::array<float,2>{0.255689383f, 0.389867961f},
-std::array<float,2>{0.772416055f, 0.63487488f},
-std::array<float,2>{0.150795013f, 0.96216315f},
-std::array<float,2>{0.50252074f, 0.213823572f},
-std::array<float,2>{0.0182072185f, 0.00233274116f},
-std::array<float,2>{0.661354065f, 0.771485984f},
-std::array<float,2>{0.449329764f, 0.619142234f},
-std::array<float,2>{0.96585691f, 0.257547706f},
-std::array<float,2>{0.367400885f, 0.0855839401f},
-std::array<float,2>{0.813480437f, 0.854813159f},
-std::array<float,2>{0.199626997f, 0.532927573f},
-std::array<float,2>{0.618221879f, 0.321690917f},
-std::array<float,2>{0.0729907379f, 0.443359852f},
-std::array<float,2>{0.743373871f, 0.739113867f},
-std::array<float,2>{0.413644493f, 0.9328233f},
-std::array<float,2>{0.894057631f, 0.180920333f},
-std::array<float,2>{0.498993039f, 0.285478383f},
-std::array<float,2>{0.982021928f, 0.586548626f},
-std::array<float,2>{0.0324625596f, 0.793238282f},
-std::array<float,2>{0.639047325f, 0.0539262556f},
-std::array<float,2>{0.156431228f, 0.245230913f},
-std::array<float,2>{0.550555348f, 0.975906789f},
-std::array<float,2>{0.300224513f, 0.658960402f},
-std::array<float,2>{0.78560102f, 0.408948183f},
-std::array<float,2>{0.466102988f, 0.0394463502f},
-std::array<float,2>{0.951802254f, 0.808036387f},
-std::array<float,2>{0.0122644436f, 0.565551758f},
-std::array<float,2>{0.678786457f, 0.302827805f},
-std::array<float,2>{0.138896734f, 0.437116265f},
-std::array<float,2>{0.523216724f, 0.685563803f},
-std::array<float,2>{0.278731644f, 0.997157037f},
-std::array<float,2>{0.757332265f, 0.234148443f},
-std::array<float,2>{0.343643248f, 0.332912862f},
-std::array<float,2>{0.863737702f, 0.556665897f},
-std::array<float,2>{0.229111716f, 0.874741554f},
-std::array<float,2>{0.581432343f, 0.0676732883f},
-std::array<float,2>{0.104888201f, 0.159147575f},
-std::array<float,2>{0.697892725f, 0.910395145f},
-std::array<float,2>{0.385744601f, 0.726860464f},
-std::array<float,2>{0.9269436f, 0.464571357f},
-std::array<float,2>{0.288261443f, 0.198999941f},
-std::array<float,2>{0.807854295f, 0.940799117f},
-std::array<float,2>{0.172009453f, 0.642507553f},
-std::array<float,2>{0.54492116f, 0.403725505f},
-std::array<float,2>{0.0554707795f, 0.277038276f},
-std::array<float,2>{0.650869966f, 0.595771313f},
-std::array<float,2>{0.47418794f, 0.759060562f},
-std::array<float,2>{0.989100993f, 0.0224744584f},
-std::array<float,2>{0.430999935f, 0.486770809f},
-std::array<float,2>{0.878321409f, 0.716754138f},
-std::array<float,2>{0.082321994f, 0.899928749f},
-std::array<float,2>{0.730946779f, 0.146453172f},
-std::array<float,2>{0.215444043f, 0.102698945f},
-std::array<float,2>{0.599199831f, 0.827007473f},
-std::array<float,2>{0.358383149f, 0.500050724f},
-std::array<float,2>{0.840379655f, 0.350865483f},
-std::array<float,2>{0.495468676f, 0.154240355f},
-std::array<float,2>{0.977779508f, 0.893122077f},
-std::array<float,2>{0.0366581418f, 0.709617615f},
-std::array<float,2>{0.634675682f, 0.494114369f},
-std::array<float,2>{0.16280435f, 0.358324558f},
-std::array<float,2>{0.553585947f, 0.507946134f},
-std::array<float,2>{0.302470148f, 0.817427814f},
-std::array<float,2>{0.782984495f, 0.0991940573f},
-std::array<float,2>{0.371305615f, 0.396610916f},
-std::array<float,2>{0.817609489f, 0.649599969f},
-std::array<float,2>{0.19545421f, 0.949604452f},
-std::array<float,2>{0.624072731f, 0.189593375f},
-std::array<float,2>{0.0759077892f, 0.0258164331f},
-std::array<float,2>{0.746569574f, 0.750690877f},
-std::array<float,2>{0.409176707f, 0.608507633f},
-std::array<float,2>{0.894721746f, 0.273429245f},
-std::array<float,2>{0.252215683f, 0.0762572885f},
-std::array<float,2>{0.767483175f, 0.863954663f},
-std::array<float,2>{0.153346032f, 0.546899319f},
-std::array<float,2>{0.506616116f, 0.339129955f},
-std::array<float,2>{0.0231070146f, 0.458755225f},
-std::array<float,2>{0.658452749f, 0.725090444f},
-std::array<float,2>{0.446928263f, 0.920463026f},
-std::array<float,2>{0.962730825f, 0.167610124f},
-std::array<float,2>{0.402352512f, 0.312148571f},
-std::array<float,2>{0.912548125f, 0.5726825f},
-std::array<float,2>{0.113009818f, 0.798248529f},
-std::array<float,2>{0.715771496f, 0.0313081108f},
-std::array<float,2>{0.240495384f, 0.222577721f},
-std::array<float,2>{0.570933521f, 0.986669302f},
-std::array<float,2>{0.324657381f, 0.678313434f},
-std::array<float,2>{0.856457055f, 0.423383564f},
-std::array<float,2>{0.433776289f, 0.0550605357f},
-std::array<float,2>{0.881982267f, 0.781434059f},
-std::array<float,2>{0.0784905702f, 0.582704723f},
-std::array<float,2>{0.726906896f, 0.291488647f},
-std::array<float,2>{0.212498799f, 0.417343676f},
-std::array<float,2>{0.594533026f, 0.665617764f},
-std::array<float,2>{0.354456365f, 0.98369664f},
-std::array<float,2>{0.836759031f, 0.239206195f},
-std::array<float,2>{0.284117609f, 0.319600075f},
-std::array<float,2>{0.810418308f, 0.546740234f},
-std::array<float,2>{0.178309709f, 0.845773518f},
-std::array<float,2>{0.542576432f, 0.0862066448f},
-std::array<float,2>{0.0597523898f, 0.173483953f},
-std::array<float,2>{0.652931333f, 0.923793256f},
-std::array<float,2>{0.470483005f, 0.744388461f},
-std::array<float,2>{0.987209976f, 0.445527971f},
-std::array<float,2>{0.338773578f, 0.203340292f},
-std::array<float,2>{0.862891197f, 0.957970738f},
-std::array<float,2>{0.233724758f, 0.628294528f},
-std::array<float,2>{0.58484298f, 0.379576147f},
-std::array<float,2>{0.106987812f, 0.259678513f},
-std::array<float,2>{0.702748239f, 0.611777306f},
-std::array<float,2>{0.387327135f, 0.775775373f},
-std::array<float,2>{0.924364984f, 0.013889838f},
-std::array<float,2>{0.462476939f, 0.473076135f},
-std::array<float,2>{0.947499692f, 0.698239982f},
-std::array<float,2>{0.00962061062f, 0.887636185f},
-std::array<float,2>{0.67212832f, 0.130725041f},
-std::array<float,2>{0.136635482f, 0.120213158f},
-std::array<float,2>{0.517896116f, 0.829490185f},
-std::array<float,2>{0.276737034f, 0.525253296f},
-std::array<float,2>{0.750584841f, 0.363614202f},
-std::array<float,2>{0.375660092f, 0.24783434f},
-std::array<float,2>{0.935575366f, 0.969879866f},
-std::array<float,2>{0.100447178f, 0.661464155f},
-std::array<float,2>{0.694545984f, 0.410600305f},
-std::array<float,2>{0.224683896f, 0.28223449f},
-std::array<float,2>{0.590941966f, 0.593156338f},
-std::array<float,2>{0.331346452f, 0.792819262f},
-std::array<float,2>{0.872756422f, 0.0485403016f},
-std::array<float,2>{0.266321301f, 0.440495491f},
-std::array<float,2>{0.764735699f, 0.735312998f},
-std::array<float,2>{0.128682479f, 0.937004447f},
-std::array<float,2>{0.526854813f, 0.183796749f},
-std::array<float,2>{0.00273799151f, 0.0817397758f},
-std::array<float,2>{0.683796644f, 0.858626425f},
-std::array<float,2>{0.459710717f, 0.53867209f},
-std::array<float,2>{0.9405756f, 0.326748908f},
-std::array<float,2>{0.349173218f, 0.00550100906f},
-std::array<float,2>{0.82820648f, 0.768025577f},
-std::array<float,2>{0.209285051f, 0.621207535f},
-std::array<float,2>{0.606416941f, 0.253867626f},
-std::array<float,2>{0.0886960253f, 0.383635372f},
-std::array<float,2>{0.719556034f, 0.640261412f},
-std::array<float,2>{0.423327982f, 0.968285501f},
-std::array<float,2>{0.883952141f, 0.217170015f},
-std::array<float,2>{0.484128624f, 0.368976027f},
-std::array<float,2>{0.99437809f, 0.520795107f},
-std::array<float,2>{0.0510526858f, 0.841603041f},
-std::array<float,2>{0.641922832f, 0.111684643f},
-std::array<float,2>{0.180736601f, 0.138119951f},
-std::array<float,2>{0.534821033f, 0.881420732f},
-std::array<float,2>{0.293020248f, 0.688941538f},
-std::array<float,2>{0.803883851f, 0.478520185f},
-std::array<float,2>{0.439362466f, 0.106206834f},
-std::array<float,2>{0.957434773f, 0.823508024f},
-std::array<float,2>{0.0290227886f, 0.507383645f},
-std::array<float,2>{0.670823753f, 0.344300568f},
-std::array<float,2>{0.14760077f, 0.491054654f},
-std::array<float,2>{0.514434814f, 0.712111235f},
-std::array<float,2>{0.258866608f, 0.903055668f},
-std::array<float,2>{0.779485703f, 0.143214986f},
-std::array<float,2>{0.318271637f, 0.278467029f},
-std::array<float,2>{0.846281767f, 0.599293649f},
-std::array<float,2>{0.243458241f, 0.765220761f},
-std::array<float,2>{0.569991052f, 0.017562665f},
-std::array<float,2>{0.119339131f, 0.199332699f},
-std::array<float,2>{0.709722698f, 0.94335711f},
-std::array<float,2>{0.393652171f, 0.644650459f},
-std::array<float,2>{0.915459991f, 0.402195096f},
-std::array<float,2>{0.311910301f, 0.16158925f},
-std::array<float,2>{0.790489614f, 0.908519387f},
-std::array<float,2>{0.169207573f, 0.731613815f},
-std::array<float,2>{0.55838418f, 0.467417181f},
-std::array<float,2>{0.0415804237f, 0.331811756f},
-std::array<float,2>{0.630095601f, 0.562420905f},
-std::array<float,2>{0.487141043f, 0.870120347f},
-std::array<float,2>{0.971686304f, 0.062690869f},
-std::array<float,2>{0.420487255f, 0.43184045f},
-std::array<float,2>{0.905080438f, 0.68304801f},
-std::array<float,2>{0.0689787492f, 0.9936921f},
-std::array<float,2>{0.739531457f, 0.227194071f},
-std::array<float,2>{0.187665075f, 0.0431007817f},
-std::array<float,2>{0.614621758f, 0.810823441f},
-std::array<float,2>{0.361184388f, 0.567508996f},
-std::array<float,2>{0.82730931f, 0.300608844f},
-std::array<float,2>{0.454802036f, 0.194961071f},
-std::array<float,2>{0.942290783f, 0.946255624f},
-std::array<float,2>{0.00517827319f, 0.652999461f},
-std::array<float,2>{0.68245399f, 0.393983513f},
-std::array<float,2>{0.132383287f, 0.26579079f},
-std::array<float,2>{0.530991256f, 0.604956448f},
-std::array<float,2>{0.271770775f, 0.756802917f},
-std::array<float,2>{0.760717094f, 0.0298077855f},
-std::array<float,2>{0.33310622f, 0.497218192f},
-std::array<float,2>{0.867343247f, 0.703191221f},
-std::array<float,2>{0.221287251f, 0.895296037f},
-std::array<float,2>{0.589703977f, 0.148584217f},
-std::array<float,2>{0.0956840664f, 0.0962140858f},
-std::array<float,2>{0.690594196f, 0.814738393f},
-std::array<float,2>{0.382522821f, 0.511774123f},
-std::array<float,2>{0.931497693f, 0.354956448f},
-std::array<float,2>{0.289275348f, 0.0364230238f},
-std::array<float,2>{0.800144017f, 0.804630041f},
-std::array<float,2>{0.187179357f, 0.577639401f},
-std::array<float,2>{0.537275672f, 0.307421416f},
-std::array<float,2>{0.0502710454f, 0.428322494f},
-std::array<float,2>{0.647993028f, 0.675718725f},
-std::array<float,2>{0.47820279f, 0.989653945f},
-std::array<float,2>{0.998061895f, 0.225673482f},
-std::array<float,2>{0.428264111f, 0.343348861f},
-std::array<float,2>{0.889787316f, 0.554143488f},
-std::array<float,2>{0.0905096903f, 0.862729073f},
-std::array<float,2>{0.726076305f, 0.0741281733f},
-std::array<float,2>{0.203922391f, 0.171053484f},
-std::array<float,2>{0.605206668f, 0.917831004f},
-std::array<float,2>{0.344326437f, 0.721368611f},
-std::array<float,2>{0.835244656f, 0.456794173f},
-std::array<float,2>{0.397192985f, 0.0932883918f},
-std::array<float,2>{0.919446588f, 0.850384653f},
-std::array<float,2>{0.121561386f, 0.541333973f},
-std::array<float,2>{0.706447542f, 0.312795013f},
-std::array<float,2>{0.249863505f, 0.450365216f},
-std::array<float,2>{0.56421572f, 0.748159647f},
-std::array<float,2>{0.314461917f, 0.925888121f},
-std::array<float,2>{0.850349069f, 0.178780407f},
-std::array<float,2>{0.26418829f, 0.293829381f},
-std::array<float,2>{0.774093807f, 0.580954015f},
-std::array<float,2>{0.142696112f, 0.786026955f},
-std::array<float,2>{0.511070132f, 0.0615573712f},
-std::array<float,2>{0.0245004054f, 0.23582381f},
-std::array<float,2>{0.666909575f, 0.97859329f},
-std::array<float,2>{0.442476124f, 0.669357836f},
-std::array<float,2>{0.954633176f, 0.420546412f},
-std::array<float,2>{0.366575003f, 0.128686741f},
-std::array<float,2>{0.823286712f, 0.883869946f},
-std::array<float,2>{0.194505468f, 0.702229083f},
-std::array<float,2>{0.611790121f, 0.469912291f},
-std::array<float,2>{0.0642284229f, 0.360414445f},
-std::array<float,2>{0.736305237f, 0.531165659f},
-std::array<float,2>{0.41604808f, 0.834809721f},
-std::array<float,2>{0.900298119f, 0.123228937f},
-std::array<float,2>{0.492062032f, 0.377975702f},
-std::array<float,2>{0.975043893f, 0.62986809f},
-std::array<float,2>{0.0459376946f, 0.956338346f},
-std::array<float,2>{0.628330886f, 0.208433524f},
-std::array<float,2>{0.167325601f, 0.0114528453f},
-std::array<float,2>{0.561263025f, 0.780122101f},
-std::array<float,2>{0.306854099f, 0.616487801f},
-std::array<float,2>{0.795521915f, 0.26264137f},
-std::array<float,2>{0.410397232f, 0.182487071f},
-std::array<float,2>{0.892406046f, 0.93079561f},
-std::array<float,2>{0.0703213289f, 0.740411341f},
-std::array<float,2>{0.744460285f, 0.441577107f},
-std::array<float,2>{0.201703653f, 0.322297782f},
-std::array<float,2>{0.619612217f, 0.533630013f},
-std::array<float,2>{0.369367957f, 0.852614164f},
-std::array<float,2>{0.816374421f, 0.0834268034f},
-std::array<float,2>{0.298062712f, 0.406590641f},
-std::array<float,2>{0.788726807f, 0.65776974f},
-std::array<float,2>{0.158616617f, 0.974247873f},
-std::array<float,2>{0.548541367f, 0.243169218f},
-std::array<float,2>{0.0345729478f, 0.0522887744f},
-std::array<float,2>{0.636789203f, 0.795904756f},
-std::array<float,2>{0.49753812f, 0.588111699f},
-std::array<float,2>{0.982987463f, 0.288233846f},
-std::array<float,2>{0.323183954f, 0.11552795f},
-std::array<float,2>{0.852281928f, 0.836869001f},
-std::array<float,2>{0.237048298f, 0.516411662f},
-std::array<float,2>{0.576268017f, 0.372924954f},
-std::array<float,2>{0.115063883f, 0.483330071f},
-std::array<float,2>{0.714627147f, 0.694547951f},
-std::array<float,2>{0.400611669f, 0.876507759f},
-std::array<float,2>{0.909933209f, 0.136568204f},
-std::array<float,2>{0.452780992f, 0.255409628f},
-std::array<float,2>{0.967247486f, 0.617628396f},
-std::array<float,2>{0.017257791f, 0.770518899f},
-std::array<float,2>{0.663347363f, 0.000879814848f},
-std::array<float,2>{0.14893654f, 0.211659506f},
-std::array<float,2>{0.50148195f, 0.964711666f},
-std::array<float,2>{0.256178528f, 0.63302362f},
-std::array<float,2>{0.770975173f, 0.388525784f},
-std::array<float,2>{0.47576952f, 0.0195989925f},
-std::array<float,2>{0.990490496f, 0.760896146f},
-std::array<float,2>{0.057825461f, 0.595365524f},
-std::array<float,2>{0.648649454f, 0.274750561f},
-std::array<float,2>{0.175743356f, 0.405732661f},
-std::array<float,2>{0.545896351f, 0.644363999f},
-std::array<float,2>{0.28683871f, 0.937604487f},
-std::array<float,2>{0.805854023f, 0.197171032f},
-std::array<float,2>{0.356749177f, 0.348741204f},
-std::array<float,2>{0.843654394f, 0.502560198f},
-std::array<float,2>{0.217261121f, 0.82583487f},
-std::array<float,2>{0.600096345f, 0.104935512f},
-std::array<float,2>{0.0850606486f, 0.147185892f},
-std::array<float,2>{0.7333166f, 0.901174664f},
-std::array<float,2>{0.432358831f, 0.718456209f},
-std::array<float,2>{0.876951873f, 0.485686541f},
-std::array<float,2>{0.279961139f, 0.231118426f},
-std::array<float,2>{0.755442619f, 0.998654306f},
-std::array<float,2>{0.137871265f, 0.684986055f},
-std::array<float,2>{0.519652009f, 0.433903843f},
-std::array<float,2>{0.0145949032f, 0.301621586f},
-std::array<float,2>{0.676874936f, 0.562917233f},
-std::array<float,2>{0.468126655f, 0.804993749f},
-std::array<float,2>{0.949376404f, 0.0426825695f},
-std::array<float,2>{0.384437829f, 0.462264568f},
-std::array<float,2>{0.928297698f, 0.730019808f},
-std::array<float,2>{0.10303545f, 0.913758814f},
-std::array<float,2>{0.696894348f, 0.156979457f},
-std::array<float,2>{0.228009313f, 0.0696663857f},
-std::array<float,2>{0.578285515f, 0.8727988f},
-std::array<float,2>{0.339868814f, 0.556391299f},
-std::array<float,2>{0.865865946f, 0.33428666f},
-std::array<float,2>{0.455122441f, 0.148898751f},
-std::array<float,2>{0.944557846f, 0.895071328f},
-std::array<float,2>{0.00744202221f, 0.703555048f},
-std::array<float,2>{0.680939019f, 0.497400999f},
-std::array<float,2>{0.130628169f, 0.354612201f},
-std::array<float,2>{0.528299749f, 0.512132585f},
-std::array<float,2>{0.270815372f, 0.814571679f},
-std::array<float,2>{0.759146333f, 0.096526891f},
-std::array<float,2>{0.33418259f, 0.393690825f},
-std::array<float,2>{0.869615853f, 0.653096259f},
-std::array<float,2>{0.220130429f, 0.945956528f},
-std::array<float,2>{0.586103678f, 0.195212722f},
-std::array<float,2>{0.0968529731f, 0.0300932024f},
-std::array<float,2>{0.688696623f, 0.756469071f},
-std::array<float,2>{0.379065931f, 0.604495406f},
-std::array<float,2>{0.933145642f, 0.266088992f},
-std::array<float,2>{0.291447908f, 0.0738261193f},
-std::array<float,2>{0.797760248f, 0.862479925f},
-std::array<float,2>{0.184047922f, 0.553729117f},
-std::array<float,2>{0.536295652f, 0.343659461f},
-std::array<float,2>{0.0472052135f, 0.456626594f},
-std::array<float,2>{0.644738793f, 0.721512437f},
-std::array<float,2>{0.479077607f, 0.917689502f},
-std::array<float,2>{0.996497273f, 0.171293244f},
-std::array<float,2>{0.426146179f, 0.307339162f},
-std::array<float,2>{0.888274789f, 0.577946723f},
-std::array<float,2>{0.0928071141f, 0.804319799f},
-std::array<float,2>{0.724359214f, 0.0362873226f},
-std::array<float,2>{0.205422282f, 0.225940198f},
-std::array<float,2>{0.602990627f, 0.989443898f},
-std::array<float,2>{0.347522974f, 0.675470233f},
-std::array<float,2>{0.83389771f, 0.428654283f},
-std::array<float,2>{0.396346599f, 0.0618309788f},
-std::array<float,2>{0.920254648f, 0.785850644f},
-std::array<float,2>{0.123866931f, 0.580799818f},
-std::array<float,2>{0.703363419f, 0.293541461f},
-std::array<float,2>{0.24632962f, 0.4206613f},
-std::array<float,2>{0.565217137f, 0.668946505f},
-std::array<float,2>{0.31438753f, 0.978984952f},
-std::array<float,2>{0.847816825f, 0.235532224f},
-std::array<float,2>{0.262396574f, 0.312595785f},
-std::array<float,2>{0.777009547f, 0.541162729f},
-std::array<float,2>{0.142124429f, 0.850199938f},
-std::array<float,2>{0.509191334f, 0.093519859f},
-std::array<float,2>{0.026116794f, 0.179046109f},
-std::array<float,2>{0.664386868f, 0.926042676f},
-std::array<float,2>{0.44405973f, 0.748473644f},
-std::array<float,2>{0.956673205f, 0.450506628f},
-std::array<float,2>{0.364542931f, 0.208230302f},
-std::array<float,2>{0.820643246f, 0.956233561f},
-std::array<float,2>{0.191761643f, 0.629595816f},
-std::array<float,2>{0.611320019f, 0.378314078f},
-std::array<float,2>{0.0660930425f, 0.262295693f},
-std::array<float,2>{0.737925589f, 0.616318941f},
-std::array<float,2>{0.414997041f, 0.77996397f},
-std::array<float,2>{0.901835501f, 0.0115439082f},
-std::array<float,2>{0.488975346f, 0.470140487f},
-std::array<float,2>{0.973764598f, 0.702473342f},
-std::array<float,2>{0.0437201522f, 0.8841874f},
-std::array<float,2>{0.625723243f, 0.128561229f},
-std::array<float,2>{0.165421233f, 0.123505421f},
-std::array<float,2>{0.559363723f, 0.834483027f},
-std::array<float,2>{0.305866778f, 0.530869901f},
-std::array<float,2>{0.794735789f, 0.360737592f},
-std::array<float,2>{0.412293315f, 0.243627101f},
-std::array<float,2>{0.893399835f, 0.974533975f},
-std::array<float,2>{0.0739441589f, 0.658074081f},
-std::array<float,2>{0.742302656f, 0.406289965f},
-std::array<float,2>{0.200723529f, 0.288499236f},
-std::array<float,2>{0.6181072f, 0.588238955f},
-std::array<float,2>{0.368988931f, 0.796377003f},
-std::array<float,2>{0.812722743f, 0.0527092107f},
-std::array<float,2>{0.299599648f, 0.44176206f},
-std::array<float,2>{0.786903322f, 0.740718424f},
-std::array<float,2>{0.157392114f, 0.930920959f},
-std::array<float,2>{0.5492872f, 0.182131648f},
-std::array<float,2>{0.0320113674f, 0.0830538422f},
-std::array<float,2>{0.640257716f, 0.853014946f},
-std::array<float,2>{0.499779195f, 0.533413053f},
-std::array<float,2>{0.981058955f, 0.322618932f},
-std::array<float,2>{0.321290612f, 0.000563007256f},
-std::array<float,2>{0.854223251f, 0.770879269f},
-std::array<float,2>{0.234928727f, 0.617249012f},
-std::array<float,2>{0.574574888f, 0.255848646f},
-std::array<float,2>{0.116499007f, 0.388276249f},
-std::array<float,2>{0.712339222f, 0.633128881f},
-std::array<float,2>{0.399910361f, 0.964590907f},
-std::array<float,2>{0.906325221f, 0.211890101f},
-std::array<float,2>{0.450977325f, 0.372726202f},
-std::array<float,2>{0.965260625f, 0.516231179f},
-std::array<float,2>{0.0192395747f, 0.836621761f},
-std::array<float,2>{0.660804451f, 0.115334578f},
-std::array<float,2>{0.151934475f, 0.136265844f},
-std::array<float,2>{0.503596127f, 0.876927555f},
-std::array<float,2>{0.254253536f, 0.69478184f},
-std::array<float,2>{0.773017824f, 0.483066618f},
-std::array<float,2>{0.472802877f, 0.104597919f},
-std::array<float,2>{0.9895854f, 0.825928688f},
-std::array<float,2>{0.0561677068f, 0.502852201f},
-std::array<float,2>{0.651918709f, 0.349043638f},
-std::array<float,2>{0.173699364f, 0.485413313f},
-std::array<float,2>{0.543886542f, 0.718592823f},
-std::array<float,2>{0.287165344f, 0.901032329f},
-std::array<float,2>{0.806814015f, 0.147301003f},
-std::array<float,2>{0.359357268f, 0.274471968f},
-std::array<float,2>{0.841007113f, 0.595666409f},
-std::array<float,2>{0.215932831f, 0.761103868f},
-std::array<float,2>{0.598016202f, 0.0199178867f},
-std::array<float,2>{0.0836466029f, 0.196785569f},
-std::array<float,2>{0.732330799f, 0.937985957f},
-std::array<float,2>{0.430644542f, 0.644275665f},
-std::array<float,2>{0.877208889f, 0.405336469f},
-std::array<float,2>{0.278315395f, 0.157121241f},
-std::array<float,2>{0.756696045f, 0.913855374f},
-std::array<float,2>{0.139837548f, 0.730418742f},
-std::array<float,2>{0.522395134f, 0.462052047f},
-std::array<float,2>{0.0134610394f, 0.334064335f},
-std::array<float,2>{0.678561568f, 0.556625664f},
-std::array<float,2>{0.465073556f, 0.872982681f},
-std::array<float,2>{0.952252507f, 0.0695365071f},
-std::array<float,2>{0.385012984f, 0.433714628f},
-std::array<float,2>{0.926082194f, 0.684596658f},
-std::array<float,2>{0.104153596f, 0.99879235f},
-std::array<float,2>{0.699003398f, 0.231379479f},
-std::array<float,2>{0.229993924f, 0.0427945741f},
-std::array<float,2>{0.580268681f, 0.804844797f},
-std::array<float,2>{0.342325121f, 0.562511623f},
-std::array<float,2>{0.864594162f, 0.301342964f},
-std::array<float,2>{0.493454158f, 0.189849809f},
-std::array<float,2>{0.979594707f, 0.949336767f},
-std::array<float,2>{0.0387793891f, 0.64986217f},
-std::array<float,2>{0.636044621f, 0.396774173f},
-std::array<float,2>{0.161402211f, 0.273135066f},
-std::array<float,2>{0.551184356f, 0.608739913f},
-std::array<float,2>{0.303884417f, 0.750920296f},
-std::array<float,2>{0.783678293f, 0.025502542f},
-std::array<float,2>{0.374067008f, 0.493742734f},
-std::array<float,2>{0.819141269f, 0.709955752f},
-std::array<float,2>{0.197393149f, 0.893408179f},
-std::array<float,2>{0.622005343f, 0.153908715f},
-std::array<float,2>{0.0762377307f, 0.099568218f},
-std::array<float,2>{0.748787522f, 0.817736328f},
-std::array<float,2>{0.408165753f, 0.508277774f},
-std::array<float,2>{0.897769928f, 0.357999146f},
-std::array<float,2>{0.250900656f, 0.0316174664f},
-std::array<float,2>{0.769334972f, 0.798060536f},
-std::array<float,2>{0.154334232f, 0.572483778f},
-std::array<float,2>{0.505263031f, 0.312477052f},
-std::array<float,2>{0.0201659929f, 0.423707277f},
-std::array<float,2>{0.656278074f, 0.678477645f},
-std::array<float,2>{0.448658109f, 0.986482322f},
-std::array<float,2>{0.963196337f, 0.22239998f},
-std::array<float,2>{0.405980825f, 0.339009523f},
-std::array<float,2>{0.911058068f, 0.547321737f},
-std::array<float,2>{0.110610418f, 0.864063442f},
-std::array<float,2>{0.717211366f, 0.0764310285f},
-std::array<float,2>{0.238899648f, 0.167941555f},
-std::array<float,2>{0.572634578f, 0.920669556f},
-std::array<float,2>{0.326841801f, 0.724739909f},
-std::array<float,2>{0.858214736f, 0.458707839f},
-std::array<float,2>{0.436719805f, 0.0859902501f},
-std::array<float,2>{0.879934847f, 0.846035004f},
-std::array<float,2>{0.0817086399f, 0.546608329f},
-std::array<float,2>{0.729257941f, 0.319575608f},
-std::array<float,2>{0.212897122f, 0.445668221f},
-std::array<float,2>{0.597465694f, 0.744351089f},
-std::array<float,2>{0.352712721f, 0.923505127f},
-std::array<float,2>{0.839114487f, 0.17380546f},
-std::array<float,2>{0.281703562f, 0.291127026f},
-std::array<float,2>{0.812216163f, 0.582847893f},
-std::array<float,2>{0.177105919f, 0.781628907f},
-std::array<float,2>{0.53936398f, 0.0547307841f},
-std::array<float,2>{0.060941346f, 0.238870353f},
-std::array<float,2>{0.656046212f, 0.983411968f},
-std::array<float,2>{0.472458154f, 0.665866733f},
-std::array<float,2>{0.98493731f, 0.417027354f},
-std::array<float,2>{0.336735934f, 0.130438477f},
-std::array<float,2>{0.8596313f, 0.887406349f},
-std::array<float,2>{0.231003061f, 0.697894633f},
-std::array<float,2>{0.582158685f, 0.472668588f},
-std::array<float,2>{0.108716592f, 0.363366038f},
-std::array<float,2>{0.701031983f, 0.524913251f},
-std::array<float,2>{0.390503675f, 0.829170525f},
-std::array<float,2>{0.923233151f, 0.120534547f},
-std::array<float,2>{0.464160532f, 0.379795223f},
-std::array<float,2>{0.945837617f, 0.628120542f},
-std::array<float,2>{0.0112024536f, 0.957716584f},
-std::array<float,2>{0.674157083f, 0.203494802f},
-std::array<float,2>{0.134693071f, 0.0140203452f},
-std::array<float,2>{0.516103745f, 0.775609314f},
-std::array<float,2>{0.275242865f, 0.611506701f},
-std::array<float,2>{0.752655506f, 0.259364307f},
-std::array<float,2>{0.378210396f, 0.183878422f},
-std::array<float,2>{0.934421599f, 0.93665123f},
-std::array<float,2>{0.0991970226f, 0.734992385f},
-std::array<float,2>{0.692757189f, 0.440679401f},
-std::array<float,2>{0.223364428f, 0.327073425f},
-std::array<float,2>{0.592983544f, 0.539035857f},
-std::array<float,2>{0.3284491f, 0.858854711f},
-std::array<float,2>{0.873544037f, 0.0818480402f},
-std::array<float,2>{0.267982364f, 0.410313547f},
-std::array<float,2>{0.761832118f, 0.661185861f},
-std::array<float,2>{0.126490682f, 0.970015168f},
-std::array<float,2>{0.523777902f, 0.247705609f},
-std::array<float,2>{0.000692085712f, 0.0487448052f},
-std::array<float,2>{0.686685801f, 0.792681515f},
-std::array<float,2>{0.457911015f, 0.592881858f},
-std::array<float,2>{0.938998222f, 0.282705456f},
-std::array<float,2>{0.350681484f, 0.111532249f},
-std::array<float,2>{0.831960738f, 0.841382921f},
-std::array<float,2>{0.207311362f, 0.520672381f},
-std::array<float,2>{0.608988047f, 0.368794322f},
-std::array<float,2>{0.0860873237f, 0.478780299f},
-std::array<float,2>{0.721457183f, 0.688529551f},
-std::array<float,2>{0.425049782f, 0.88180232f},
-std::array<float,2>{0.885280132f, 0.137716815f},
-std::array<float,2>{0.481576353f, 0.253612041f},
-std::array<float,2>{0.993403494f, 0.621343911f},
-std::array<float,2>{0.0537180528f, 0.767788708f},
-std::array<float,2>{0.64360863f, 0.0057170419f},
-std::array<float,2>{0.182474971f, 0.216948196f},
-std::array<float,2>{0.531854391f, 0.968706071f},
-std::array<float,2>{0.295672059f, 0.640412927f},
-std::array<float,2>{0.801513851f, 0.383465677f},
-std::array<float,2>{0.439944506f, 0.0171827953f},
-std::array<float,2>{0.959263682f, 0.765496969f},
-std::array<float,2>{0.0312239118f, 0.599440515f},
-std::array<float,2>{0.669722736f, 0.278612912f},
-std::array<float,2>{0.145789489f, 0.402025312f},
-std::array<float,2>{0.513417304f, 0.64484179f},
-std::array<float,2>{0.260494411f, 0.943026483f},
-std::array<float,2>{0.778864443f, 0.199510515f},
-std::array<float,2>{0.319753677f, 0.344652653f},
-std::array<float,2>{0.844514847f, 0.507804275f},
-std::array<float,2>{0.245755628f, 0.823409855f},
-std::array<float,2>{0.56796819f, 0.105985045f},
-std::array<float,2>{0.118553229f, 0.143317953f},
-std::array<float,2>{0.708974242f, 0.903134942f},
-std::array<float,2>{0.391247898f, 0.712386608f},
-std::array<float,2>{0.917910397f, 0.490818322f},
-std::array<float,2>{0.310301512f, 0.22736831f},
-std::array<float,2>{0.791697383f, 0.994057357f},
-std::array<float,2>{0.17111364f, 0.682728887f},
-std::array<float,2>{0.556613863f, 0.431931287f},
-std::array<float,2>{0.0404218733f, 0.300361723f},
-std::array<float,2>{0.632603765f, 0.567855835f},
-std::array<float,2>{0.484941125f, 0.810602009f},
-std::array<float,2>{0.969859302f, 0.0432212055f},
-std::array<float,2>{0.419295728f, 0.467530787f},
-std::array<float,2>{0.90384984f, 0.73169601f},
-std::array<float,2>{0.068044506f, 0.908334076f},
-std::array<float,2>{0.74078846f, 0.161254823f},
-std::array<float,2>{0.190964058f, 0.0628001168f},
-std::array<float,2>{0.615491748f, 0.870429754f},
-std::array<float,2>{0.362701267f, 0.562146544f},
-std::array<float,2>{0.82539767f, 0.33155331f},
-std::array<float,2>{0.476565838f, 0.169874936f},
-std::array<float,2>{0.999395251f, 0.915775716f},
-std::array<float,2>{0.0498011969f, 0.720151901f},
-std::array<float,2>{0.647053003f, 0.453354985f},
-std::array<float,2>{0.185582533f, 0.339844853f},
-std::array<float,2>{0.538620532f, 0.551401973f},
-std::array<float,2>{0.290318191f, 0.860477984f},
-std::array<float,2>{0.799378037f, 0.070845142f},
-std::array<float,2>{0.344914824f, 0.426917702f},
-std::array<float,2>{0.834522903f, 0.672626257f},
-std::array<float,2>{0.205060422f, 0.990860999f},
-std::array<float,2>{0.603708267f, 0.22455506f},
-std::array<float,2>{0.0913373455f, 0.0389497802f},
-std::array<float,2>{0.724924266f, 0.801818192f},
-std::array<float,2>{0.429342419f, 0.575174987f},
-std::array<float,2>{0.889605165f, 0.305521399f},
-std::array<float,2>{0.272669941f, 0.0946173668f},
-std::array<float,2>{0.760823965f, 0.812623143f},
-std::array<float,2>{0.131537125f, 0.514495552f},
-std::array<float,2>{0.529812157f, 0.352193981f},
-std::array<float,2>{0.00481593376f, 0.49976939f},
-std::array<float,2>{0.683343589f, 0.706096411f},
-std::array<float,2>{0.453400105f, 0.897047579f},
-std::array<float,2>{0.943336248f, 0.151727721f},
-std::array<float,2>{0.381544739f, 0.267755181f},
-std::array<float,2>{0.930639327f, 0.602748394f},
-std::array<float,2>{0.093775183f, 0.755663574f},
-std::array<float,2>{0.690349758f, 0.0277576372f},
-std::array<float,2>{0.222018391f, 0.192471653f},
-std::array<float,2>{0.588024378f, 0.948639572f},
-std::array<float,2>{0.332754076f, 0.656226575f},
-std::array<float,2>{0.868224144f, 0.391874015f},
-std::array<float,2>{0.417473704f, 0.00887247268f},
-std::array<float,2>{0.898726106f, 0.778575897f},
-std::array<float,2>{0.0632567182f, 0.613878965f},
-std::array<float,2>{0.734546006f, 0.264629036f},
-std::array<float,2>{0.193511263f, 0.37665692f},
-std::array<float,2>{0.612394631f, 0.632122278f},
-std::array<float,2>{0.365635097f, 0.954428077f},
-std::array<float,2>{0.822512925f, 0.210552499f},
-std::array<float,2>{0.308164448f, 0.363192201f},
-std::array<float,2>{0.796014547f, 0.52849263f},
-std::array<float,2>{0.166487455f, 0.833378017f},
-std::array<float,2>{0.561543465f, 0.1217907f},
-std::array<float,2>{0.045619376f, 0.126284078f},
-std::array<float,2>{0.627696455f, 0.886007071f},
-std::array<float,2>{0.491199464f, 0.70036459f},
-std::array<float,2>{0.97625047f, 0.471466541f},
-std::array<float,2>{0.316348135f, 0.236488894f},
-std::array<float,2>{0.851189733f, 0.978511155f},
-std::array<float,2>{0.24819845f, 0.67185837f},
-std::array<float,2>{0.563295722f, 0.419011474f},
-std::array<float,2>{0.122748397f, 0.29629001f},
-std::array<float,2>{0.70593828f, 0.580022752f},
-std::array<float,2>{0.39823392f, 0.787616849f},
-std::array<float,2>{0.918113053f, 0.0587566942f},
-std::array<float,2>{0.442115158f, 0.452270299f},
-std::array<float,2>{0.954053223f, 0.747367203f},
-std::array<float,2>{0.0242206194f, 0.927940607f},
-std::array<float,2>{0.66739887f, 0.176289558f},
-std::array<float,2>{0.143947318f, 0.0912023634f},
-std::array<float,2>{0.510712564f, 0.848362029f},
-std::array<float,2>{0.265481025f, 0.540787458f},
-std::array<float,2>{0.775028765f, 0.315240651f},
-std::array<float,2>{0.40162468f, 0.213548675f},
-std::array<float,2>{0.908936024f, 0.962013006f},
-std::array<float,2>{0.114133023f, 0.635104537f},
-std::array<float,2>{0.713311672f, 0.390127182f},
-std::array<float,2>{0.238256574f, 0.257792473f},
-std::array<float,2>{0.577295303f, 0.619487166f},
-std::array<float,2>{0.32395193f, 0.771751165f},
-std::array<float,2>{0.853507936f, 0.00203547766f},
-std::array<float,2>{0.257040828f, 0.4805426f},
-std::array<float,2>{0.770122349f, 0.692106605f},
-std::array<float,2>{0.150246546f, 0.877666533f},
-std::array<float,2>{0.500682592f, 0.134139746f},
-std::array<float,2>{0.0160457417f, 0.114058241f},
-std::array<float,2>{0.662188888f, 0.839416325f},
-std::array<float,2>{0.451292247f, 0.517657816f},
-std::array<float,2>{0.967942953f, 0.373335123f},
-std::array<float,2>{0.370342851f, 0.0541684926f},
-std::array<float,2>{0.815370679f, 0.79302901f},
-std::array<float,2>{0.202429637f, 0.586683869f},
-std::array<float,2>{0.620525718f, 0.285309613f},
-std::array<float,2>{0.0721648112f, 0.408779651f},
-std::array<float,2>{0.74514991f, 0.658762217f},
-std::array<float,2>{0.411882073f, 0.975813866f},
-std::array<float,2>{0.890744865f, 0.245491683f},
-std::array<float,2>{0.496586025f, 0.321306735f},
-std::array<float,2>{0.983633757f, 0.533088923f},
-std::array<float,2>{0.0339669771f, 0.854530394f},
-std::array<float,2>{0.638406992f, 0.0858709142f},
-std::array<float,2>{0.159820557f, 0.180761829f},
-std::array<float,2>{0.547419667f, 0.933023155f},
-std::array<float,2>{0.297388911f, 0.738803029f},
-std::array<float,2>{0.787498295f, 0.443803698f},
-std::array<float,2>{0.467329592f, 0.067419976f},
-std::array<float,2>{0.950944841f, 0.874849081f},
-std::array<float,2>{0.0150056174f, 0.556966901f},
-std::array<float,2>{0.675970435f, 0.332588732f},
-std::array<float,2>{0.136725783f, 0.464764684f},
-std::array<float,2>{0.52069515f, 0.726608634f},
-std::array<float,2>{0.280649751f, 0.910461843f},
-std::array<float,2>{0.754319727f, 0.158872992f},
-std::array<float,2>{0.341155231f, 0.303001165f},
-std::array<float,2>{0.866281033f, 0.565784872f},
-std::array<float,2>{0.227405712f, 0.807801306f},
-std::array<float,2>{0.579720855f, 0.0392704308f},
-std::array<float,2>{0.101615146f, 0.233950272f},
-std::array<float,2>{0.695407212f, 0.997532189f},
-std::array<float,2>{0.383142412f, 0.685958266f},
-std::array<float,2>{0.929228067f, 0.437321901f},
-std::array<float,2>{0.285317302f, 0.146213397f},
-std::array<float,2>{0.804986596f, 0.900253534f},
-std::array<float,2>{0.17471385f, 0.716534615f},
-std::array<float,2>{0.546035767f, 0.48645097f},
-std::array<float,2>{0.0572767556f, 0.350660741f},
-std::array<float,2>{0.649964094f, 0.500274301f},
-std::array<float,2>{0.47540921f, 0.826703489f},
-std::array<float,2>{0.991469324f, 0.10288237f},
-std::array<float,2>{0.43263939f, 0.403406441f},
-std::array<float,2>{0.875682533f, 0.642300785f},
-std::array<float,2>{0.0848442912f, 0.940503061f},
-std::array<float,2>{0.733724475f, 0.198873609f},
-std::array<float,2>{0.21863699f, 0.0227956381f},
-std::array<float,2>{0.600730956f, 0.75898689f},
-std::array<float,2>{0.355481952f, 0.59613055f},
-std::array<float,2>{0.841832578f, 0.277293175f},
-std::array<float,2>{0.44586131f, 0.220693514f},
-std::array<float,2>{0.960975289f, 0.985965252f},
-std::array<float,2>{0.0221842546f, 0.676330745f},
-std::array<float,2>{0.660069168f, 0.424150765f},
-std::array<float,2>{0.152601153f, 0.309852511f},
-std::array<float,2>{0.507165253f, 0.570983589f},
-std::array<float,2>{0.253771842f, 0.7999897f},
-std::array<float,2>{0.765996158f, 0.0334875584f},
-std::array<float,2>{0.325624198f, 0.460358918f},
-std::array<float,2>{0.855734229f, 0.724248707f},
-std::array<float,2>{0.241811812f, 0.918305099f},
-std::array<float,2>{0.571539402f, 0.164757788f},
-std::array<float,2>{0.111678392f, 0.074474223f},
-std::array<float,2>{0.716339469f, 0.86711061f},
-std::array<float,2>{0.40428251f, 0.550391853f},
-std::array<float,2>{0.9131428f, 0.337548703f},
-std::array<float,2>{0.300986052f, 0.0247331373f},
-std::array<float,2>{0.782015979f, 0.753528297f},
-std::array<float,2>{0.163741052f, 0.606620491f},
-std::array<float,2>{0.554007173f, 0.269635707f},
-std::array<float,2>{0.0357042216f, 0.394664407f},
-std::array<float,2>{0.633023024f, 0.651592493f},
-std::array<float,2>{0.494930625f, 0.952075005f},
-std::array<float,2>{0.97747606f, 0.188963622f},
-std::array<float,2>{0.409396976f, 0.355828792f},
-std::array<float,2>{0.895714939f, 0.511369169f},
-std::array<float,2>{0.0745278969f, 0.819024622f},
-std::array<float,2>{0.748001933f, 0.101054586f},
-std::array<float,2>{0.196570545f, 0.155754402f},
-std::array<float,2>{0.623261034f, 0.892367184f},
-std::array<float,2>{0.372882038f, 0.70875591f},
-std::array<float,2>{0.816533148f, 0.494158477f},
-std::array<float,2>{0.388205469f, 0.117768385f},
-std::array<float,2>{0.925648093f, 0.83156687f},
-std::array<float,2>{0.106121615f, 0.526225924f},
-std::array<float,2>{0.70179522f, 0.366675705f},
-std::array<float,2>{0.233372152f, 0.475742221f},
-std::array<float,2>{0.585096598f, 0.696083724f},
-std::array<float,2>{0.339627564f, 0.89033699f},
-std::array<float,2>{0.861765325f, 0.131859347f},
-std::array<float,2>{0.276272714f, 0.261347234f},
-std::array<float,2>{0.751778662f, 0.611045122f},
-std::array<float,2>{0.135294452f, 0.774947941f},
-std::array<float,2>{0.519120395f, 0.0124945976f},
-std::array<float,2>{0.00866064616f, 0.206694931f},
-std::array<float,2>{0.673168957f, 0.96087569f},
-std::array<float,2>{0.461279631f, 0.625710189f},
-std::array<float,2>{0.949131489f, 0.382143736f},
-std::array<float,2>{0.354766399f, 0.173838347f},
-std::array<float,2>{0.837001979f, 0.924347043f},
-std::array<float,2>{0.211635858f, 0.742362976f},
-std::array<float,2>{0.594765067f, 0.448595673f},
-std::array<float,2>{0.0794474483f, 0.317329109f},
-std::array<float,2>{0.727806866f, 0.543256342f},
-std::array<float,2>{0.43459937f, 0.844095945f},
-std::array<float,2>{0.881547093f, 0.0889931992f},
-std::array<float,2>{0.46888411f, 0.415112168f},
-std::array<float,2>{0.987501204f, 0.667464197f},
-std::array<float,2>{0.0589572936f, 0.981073797f},
-std::array<float,2>{0.653636992f, 0.240640283f},
-std::array<float,2>{0.179184929f, 0.0579881482f},
-std::array<float,2>{0.541913569f, 0.784105003f},
-std::array<float,2>{0.28438586f, 0.584790587f},
-std::array<float,2>{0.809324503f, 0.289091229f},
-std::array<float,2>{0.422610313f, 0.139255583f},
-std::array<float,2>{0.883292139f, 0.879683316f},
-std::array<float,2>{0.0892553404f, 0.689613283f},
-std::array<float,2>{0.719799221f, 0.478099495f},
-std::array<float,2>{0.210232288f, 0.370067179f},
-std::array<float,2>{0.606491268f, 0.523375869f},
-std::array<float,2>{0.348163366f, 0.842539012f},
-std::array<float,2>{0.8291924f, 0.111077622f},
-std::array<float,2>{0.294201016f, 0.386269599f},
-std::array<float,2>{0.803229332f, 0.638280749f},
-std::array<float,2>{0.180297792f, 0.965626836f},
-std::array<float,2>{0.533487737f, 0.215347797f},
-std::array<float,2>{0.051942382f, 0.00775308441f},
-std::array<float,2>{0.640882432f, 0.766518772f},
-std::array<float,2>{0.482796788f, 0.624493599f},
-std::array<float,2>{0.996089041f, 0.251105547f},
-std::array<float,2>{0.330841452f, 0.079552874f},
-std::array<float,2>{0.871638775f, 0.855693698f},
-std::array<float,2>{0.226102397f, 0.535285711f},
-std::array<float,2>{0.590712965f, 0.324669719f},
-std::array<float,2>{0.101316206f, 0.437894613f},
-std::array<float,2>{0.693769038f, 0.737869322f},
-std::array<float,2>{0.376509726f, 0.935371697f},
-std::array<float,2>{0.936962724f, 0.186826259f},
-std::array<float,2>{0.460687608f, 0.284944028f},
-std::array<float,2>{0.940326154f, 0.590497673f},
-std::array<float,2>{0.00387369981f, 0.79039824f},
-std::array<float,2>{0.685263336f, 0.0504366234f},
-std::array<float,2>{0.127900019f, 0.249063686f},
-std::array<float,2>{0.526129723f, 0.972382426f},
-std::array<float,2>{0.267147779f, 0.663036227f},
-std::array<float,2>{0.763907671f, 0.412662596f},
-std::array<float,2>{0.48756209f, 0.0465236492f},
-std::array<float,2>{0.971286118f, 0.809681535f},
-std::array<float,2>{0.0420424864f, 0.570233524f},
-std::array<float,2>{0.629092872f, 0.298826039f},
-std::array<float,2>{0.168398574f, 0.430948764f},
-std::array<float,2>{0.556738913f, 0.680312932f},
-std::array<float,2>{0.311008602f, 0.994507015f},
-std::array<float,2>{0.789443851f, 0.228822112f},
-std::array<float,2>{0.360038877f, 0.328508496f},
-std::array<float,2>{0.827019095f, 0.5603562f},
-std::array<float,2>{0.189305216f, 0.86797899f},
-std::array<float,2>{0.613872707f, 0.066335842f},
-std::array<float,2>{0.069837071f, 0.163443342f},
-std::array<float,2>{0.738960028f, 0.906508684f},
-std::array<float,2>{0.420982897f, 0.733977854f},
-std::array<float,2>{0.905526698f, 0.465550244f},
-std::array<float,2>{0.258670479f, 0.202779368f},
-std::array<float,2>{0.781145334f, 0.944589198f},
-std::array<float,2>{0.147361264f, 0.647217095f},
-std::array<float,2>{0.515004992f, 0.400369525f},
-std::array<float,2>{0.0278016701f, 0.280657887f},
-std::array<float,2>{0.671850622f, 0.600933433f},
-std::array<float,2>{0.438065261f, 0.763025343f},
-std::array<float,2>{0.958198428f, 0.0176310651f},
-std::array<float,2>{0.39353931f, 0.488405645f},
-std::array<float,2>{0.915036738f, 0.714412034f},
-std::array<float,2>{0.120526016f, 0.905462861f},
-std::array<float,2>{0.710891604f, 0.141096383f},
-std::array<float,2>{0.242324591f, 0.108633243f},
-std::array<float,2>{0.569125772f, 0.821021497f},
-std::array<float,2>{0.316852272f, 0.503923714f},
-std::array<float,2>{0.847589374f, 0.346483618f},
-std::array<float,2>{0.445245564f, 0.176808834f},
-std::array<float,2>{0.955417573f, 0.929477572f},
-std::array<float,2>{0.0266554654f, 0.746625841f},
-std::array<float,2>{0.665197968f, 0.45211333f},
-std::array<float,2>{0.141284004f, 0.316278845f},
-std::array<float,2>{0.508244455f, 0.539448917f},
-std::array<float,2>{0.263449043f, 0.849108696f},
-std::array<float,2>{0.775716484f, 0.0906836018f},
-std::array<float,2>{0.313392043f, 0.418423027f},
-std::array<float,2>{0.848866224f, 0.670603096f},
-std::array<float,2>{0.247143999f, 0.976622283f},
-std::array<float,2>{0.565861285f, 0.237337932f},
-std::array<float,2>{0.124276623f, 0.0598672554f},
-std::array<float,2>{0.704450905f, 0.788173616f},
-std::array<float,2>{0.395307988f, 0.579098761f},
-std::array<float,2>{0.921154082f, 0.295346022f},
-std::array<float,2>{0.305054486f, 0.12271139f},
-std::array<float,2>{0.793801725f, 0.832199454f},
-std::array<float,2>{0.164501682f, 0.528078198f},
-std::array<float,2>{0.560343742f, 0.362277091f},
-std::array<float,2>{0.0448482931f, 0.471979707f},
-std::array<float,2>{0.626029372f, 0.699359238f},
-std::array<float,2>{0.489580899f, 0.884897411f},
-std::array<float,2>{0.973328114f, 0.125145525f},
-std::array<float,2>{0.415550619f, 0.265019059f},
-std::array<float,2>{0.900512457f, 0.614473045f},
-std::array<float,2>{0.0649074391f, 0.777788162f},
-std::array<float,2>{0.737110913f, 0.00820939429f},
-std::array<float,2>{0.192705736f, 0.209563017f},
-std::array<float,2>{0.609448433f, 0.953892589f},
-std::array<float,2>{0.364042848f, 0.631787539f},
-std::array<float,2>{0.822007656f, 0.375696003f},
-std::array<float,2>{0.380235225f, 0.0285143778f},
-std::array<float,2>{0.931970775f, 0.754746199f},
-std::array<float,2>{0.0966086164f, 0.601686716f},
-std::array<float,2>{0.688314021f, 0.269466788f},
-std::array<float,2>{0.219035998f, 0.390764713f},
-std::array<float,2>{0.587315798f, 0.654400766f},
-std::array<float,2>{0.335641414f, 0.948031604f},
-std::array<float,2>{0.870941162f, 0.19221437f},
-std::array<float,2>{0.269971997f, 0.352850258f},
-std::array<float,2>{0.758460581f, 0.515515983f},
-std::array<float,2>{0.129307091f, 0.813959122f},
-std::array<float,2>{0.528623223f, 0.0947749913f},
-std::array<float,2>{0.00587067101f, 0.151055261f},
-std::array<float,2>{0.679927647f, 0.897672951f},
-std::array<float,2>{0.456468165f, 0.706000984f},
-std::array<float,2>{0.943384528f, 0.49811691f},
-std::array<float,2>{0.346181959f, 0.223254457f},
-std::array<float,2>{0.832347751f, 0.99171716f},
-std::array<float,2>{0.206264406f, 0.673640251f},
-std::array<float,2>{0.602012575f, 0.426563829f},
-std::array<float,2>{0.0924442708f, 0.30646795f},
-std::array<float,2>{0.722677946f, 0.575386167f},
-std::array<float,2>{0.426802188f, 0.800933361f},
-std::array<float,2>{0.88700968f, 0.0372857116f},
-std::array<float,2>{0.480260402f, 0.45412004f},
-std::array<float,2>{0.997864127f, 0.718806148f},
-std::array<float,2>{0.0482049361f, 0.914721072f},
-std::array<float,2>{0.646040261f, 0.168566868f},
-std::array<float,2>{0.185385987f, 0.0721222162f},
-std::array<float,2>{0.53606534f, 0.859924853f},
-std::array<float,2>{0.292595029f, 0.552168608f},
-std::array<float,2>{0.797910094f, 0.340986103f},
-std::array<float,2>{0.431585997f, 0.197386697f},
-std::array<float,2>{0.878609776f, 0.939872563f},
-std::array<float,2>{0.0825550705f, 0.64105463f},
-std::array<float,2>{0.731326342f, 0.402750671f},
-std::array<float,2>{0.215114161f, 0.275736272f},
-std::array<float,2>{0.598925412f, 0.596969664f},
-std::array<float,2>{0.357865751f, 0.757837296f},
-std::array<float,2>{0.839853406f, 0.0216177106f},
-std::array<float,2>{0.288772732f, 0.488139689f},
-std::array<float,2>{0.808197796f, 0.715171099f},
-std::array<float,2>{0.172789797f, 0.898670435f},
-std::array<float,2>{0.543981969f, 0.145240307f},
-std::array<float,2>{0.0551561266f, 0.102403432f},
-std::array<float,2>{0.651114047f, 0.827550113f},
-std::array<float,2>{0.473969907f, 0.501484632f},
-std::array<float,2>{0.988727748f, 0.350207627f},
-std::array<float,2>{0.343251407f, 0.0409271903f},
-std::array<float,2>{0.864224732f, 0.80693692f},
-std::array<float,2>{0.228555128f, 0.565083385f},
-std::array<float,2>{0.581902027f, 0.304651141f},
-std::array<float,2>{0.105261147f, 0.436056107f},
-std::array<float,2>{0.697451055f, 0.686564624f},
-std::array<float,2>{0.386296421f, 0.996168435f},
-std::array<float,2>{0.927472115f, 0.232592046f},
-std::array<float,2>{0.466460973f, 0.333587527f},
-std::array<float,2>{0.951340437f, 0.557972491f},
-std::array<float,2>{0.0120574972f, 0.874019623f},
-std::array<float,2>{0.679213047f, 0.0666333809f},
-std::array<float,2>{0.139342189f, 0.159578934f},
-std::array<float,2>{0.522757471f, 0.91150558f},
-std::array<float,2>{0.278911263f, 0.727655828f},
-std::array<float,2>{0.757054508f, 0.463219196f},
-std::array<float,2>{0.498075008f, 0.0843765214f},
-std::array<float,2>{0.981819153f, 0.853561521f},
-std::array<float,2>{0.032871373f, 0.531628311f},
-std::array<float,2>{0.639249206f, 0.321252465f},
-std::array<float,2>{0.157158107f, 0.445020914f},
-std::array<float,2>{0.549951673f, 0.739726186f},
-std::array<float,2>{0.300710857f, 0.931958139f},
-std::array<float,2>{0.786117733f, 0.180388421f},
-std::array<float,2>{0.368064255f, 0.286311865f},
-std::array<float,2>{0.814266026f, 0.587524474f},
-std::array<float,2>{0.199746117f, 0.794055521f},
-std::array<float,2>{0.618795812f, 0.0533976257f},
-std::array<float,2>{0.0726090968f, 0.245087266f},
-std::array<float,2>{0.744052112f, 0.974645972f},
-std::array<float,2>{0.413366497f, 0.659202635f},
-std::array<float,2>{0.893777847f, 0.409306228f},
-std::array<float,2>{0.254917115f, 0.132980734f},
-std::array<float,2>{0.771808088f, 0.878225505f},
-std::array<float,2>{0.150956199f, 0.692471921f},
-std::array<float,2>{0.502174795f, 0.481868297f},
-std::array<float,2>{0.0179480277f, 0.374827921f},
-std::array<float,2>{0.66196245f, 0.519255996f},
-std::array<float,2>{0.449991256f, 0.838726103f},
-std::array<float,2>{0.96671921f, 0.114379779f},
-std::array<float,2>{0.399394333f, 0.388783038f},
-std::array<float,2>{0.907356977f, 0.635902405f},
-std::array<float,2>{0.11552722f, 0.961428344f},
-std::array<float,2>{0.711586058f, 0.21452859f},
-std::array<float,2>{0.235824272f, 0.00302515039f},
-std::array<float,2>{0.575859845f, 0.772883654f},
-std::array<float,2>{0.321060747f, 0.620409846f},
-std::array<float,2>{0.855091214f, 0.256499141f},
-std::array<float,2>{0.471560001f, 0.241653696f},
-std::array<float,2>{0.986289442f, 0.981649995f},
-std::array<float,2>{0.062148612f, 0.666071236f},
-std::array<float,2>{0.654358208f, 0.415016413f},
-std::array<float,2>{0.176603109f, 0.290991664f},
-std::array<float,2>{0.540951848f, 0.585813761f},
-std::array<float,2>{0.282772452f, 0.784559786f},
-std::array<float,2>{0.810603917f, 0.0573716424f},
-std::array<float,2>{0.352404475f, 0.447503924f},
-std::array<float,2>{0.838047385f, 0.743258595f},
-std::array<float,2>{0.214473233f, 0.924956322f},
-std::array<float,2>{0.596012235f, 0.175333187f},
-std::array<float,2>{0.0805693045f, 0.0888350755f},
-std::array<float,2>{0.729594111f, 0.844788313f},
-std::array<float,2>{0.436416298f, 0.543995678f},
-std::array<float,2>{0.879445851f, 0.317754298f},
-std::array<float,2>{0.27384755f, 0.0127419876f},
-std::array<float,2>{0.753757358f, 0.773942351f},
-std::array<float,2>{0.133306205f, 0.609524786f},
-std::array<float,2>{0.516677201f, 0.260705501f},
-std::array<float,2>{0.00999079738f, 0.381699622f},
-std::array<float,2>{0.675051749f, 0.625989735f},
-std::array<float,2>{0.463527709f, 0.95960778f},
-std::array<float,2>{0.946315169f, 0.205631122f},
-std::array<float,2>{0.388859868f, 0.365241945f},
-std::array<float,2>{0.922331274f, 0.527032554f},
-std::array<float,2>{0.107649311f, 0.830534458f},
-std::array<float,2>{0.700096667f, 0.118347384f},
-std::array<float,2>{0.23183836f, 0.131050587f},
-std::array<float,2>{0.58386761f, 0.889587998f},
-std::array<float,2>{0.337450117f, 0.696674943f},
-std::array<float,2>{0.860570967f, 0.475007206f},
-std::array<float,2>{0.406612337f, 0.0998315364f},
-std::array<float,2>{0.897023261f, 0.819941103f},
-std::array<float,2>{0.0773189366f, 0.510693431f},
-std::array<float,2>{0.749757171f, 0.357229471f},
-std::array<float,2>{0.198930442f, 0.495897532f},
-std::array<float,2>{0.622404993f, 0.7079373f},
-std::array<float,2>{0.373905867f, 0.890837252f},
-std::array<float,2>{0.820069373f, 0.154404446f},
-std::array<float,2>{0.302883834f, 0.270830631f},
-std::array<float,2>{0.784897685f, 0.605988622f},
-std::array<float,2>{0.160895377f, 0.752745569f},
-std::array<float,2>{0.552634895f, 0.024104787f},
-std::array<float,2>{0.0376037471f, 0.188064471f},
-std::array<float,2>{0.635040998f, 0.952324748f},
-std::array<float,2>{0.492813021f, 0.651326239f},
-std::array<float,2>{0.979415357f, 0.39573887f},
-std::array<float,2>{0.328017712f, 0.165063456f},
-std::array<float,2>{0.858654261f, 0.919696152f},
-std::array<float,2>{0.239722922f, 0.723558068f},
-std::array<float,2>{0.573609948f, 0.459249288f},
-std::array<float,2>{0.109377131f, 0.336680055f},
-std::array<float,2>{0.718145132f, 0.549641848f},
-std::array<float,2>{0.404909462f, 0.865709364f},
-std::array<float,2>{0.911753953f, 0.0760445371f},
-std::array<float,2>{0.447724223f, 0.425054461f},
-std::array<float,2>{0.963989556f, 0.677320004f},
-std::array<float,2>{0.0209736936f, 0.985286117f},
-std::array<float,2>{0.657234013f, 0.219131485f},
-std::array<float,2>{0.156057969f, 0.0344201252f},
-std::array<float,2>{0.504490674f, 0.799267173f},
-std::array<float,2>{0.251100868f, 0.571897924f},
-std::array<float,2>{0.768059909f, 0.309013158f},
-std::array<float,2>{0.391885459f, 0.141693518f},
-std::array<float,2>{0.9166798f, 0.905105352f},
-std::array<float,2>{0.118061528f, 0.713586569f},
-std::array<float,2>{0.707345605f, 0.490084797f},
-std::array<float,2>{0.244157985f, 0.347000152f},
-std::array<float,2>{0.566794693f, 0.50505811f},
-std::array<float,2>{0.318781495f, 0.822081387f},
-std::array<float,2>{0.845448613f, 0.108265385f},
-std::array<float,2>{0.26115194f, 0.399124801f},
-std::array<float,2>{0.778300822f, 0.648037612f},
-std::array<float,2>{0.145168349f, 0.944208503f},
-std::array<float,2>{0.512435913f, 0.20149529f},
-std::array<float,2>{0.0302118156f, 0.0189676993f},
-std::array<float,2>{0.668909907f, 0.76252234f},
-std::array<float,2>{0.440633297f, 0.600451231f},
-std::array<float,2>{0.960414648f, 0.279575825f},
-std::array<float,2>{0.361842871f, 0.0653525144f},
-std::array<float,2>{0.824973464f, 0.868935108f},
-std::array<float,2>{0.189953938f, 0.558729768f},
-std::array<float,2>{0.616692543f, 0.329888642f},
-std::array<float,2>{0.0670989305f, 0.466361284f},
-std::array<float,2>{0.741464972f, 0.733205497f},
-std::array<float,2>{0.418075889f, 0.907917321f},
-std::array<float,2>{0.902875185f, 0.16220668f},
-std::array<float,2>{0.485611528f, 0.297628254f},
-std::array<float,2>{0.969661236f, 0.56861639f},
-std::array<float,2>{0.0392845087f, 0.808714986f},
-std::array<float,2>{0.631518364f, 0.0453870557f},
-std::array<float,2>{0.170447826f, 0.229495078f},
-std::array<float,2>{0.554894805f, 0.995932519f},
-std::array<float,2>{0.30936712f, 0.681446612f},
-std::array<float,2>{0.792237341f, 0.430367678f},
-std::array<float,2>{0.458241165f, 0.0492486991f},
-std::array<float,2>{0.937842309f, 0.789800167f},
-std::array<float,2>{0.0011463766f, 0.590848029f},
-std::array<float,2>{0.686520636f, 0.284158677f},
-std::array<float,2>{0.125714794f, 0.413747787f},
-std::array<float,2>{0.524773419f, 0.663721085f},
-std::array<float,2>{0.268890738f, 0.970853567f},
-std::array<float,2>{0.76361388f, 0.248788878f},
-std::array<float,2>{0.329210728f, 0.325675875f},
-std::array<float,2>{0.874821067f, 0.536657333f},
-std::array<float,2>{0.22392264f, 0.856700361f},
-std::array<float,2>{0.591950655f, 0.079049781f},
-std::array<float,2>{0.0981423482f, 0.185994193f},
-std::array<float,2>{0.692161739f, 0.93368727f},
-std::array<float,2>{0.377011776f, 0.737247348f},
-std::array<float,2>{0.934630215f, 0.438634217f},
-std::array<float,2>{0.296411186f, 0.215948865f},
-std::array<float,2>{0.801793635f, 0.966268301f},
-std::array<float,2>{0.183038175f, 0.637360811f},
-std::array<float,2>{0.532785058f, 0.384819567f},
-std::array<float,2>{0.0529307351f, 0.250362933f},
-std::array<float,2>{0.643168569f, 0.623817086f},
-std::array<float,2>{0.4809708f, 0.766678929f},
-std::array<float,2>{0.992247641f, 0.0065379357f},
-std::array<float,2>{0.423859686f, 0.477537453f},
-std::array<float,2>{0.885983229f, 0.690569937f},
-std::array<float,2>{0.087126866f, 0.880256653f},
-std::array<float,2>{0.721994758f, 0.13983278f},
-std::array<float,2>{0.20897077f, 0.110334665f},
-std::array<float,2>{0.607823372f, 0.843157053f},
-std::array<float,2>{0.350536764f, 0.52168417f},
-std::array<float,2>{0.83054024f, 0.37052086f},
-std::array<float,2>{0.491265446f, 0.126982242f},
-std::array<float,2>{0.975226641f, 0.883157492f},
-std::array<float,2>{0.0468567386f, 0.701805353f},
-std::array<float,2>{0.628699243f, 0.469612896f},
-std::array<float,2>{0.167558759f, 0.360218287f},
-std::array<float,2>{0.560833037f, 0.530160606f},
-std::array<float,2>{0.307349563f, 0.835306406f},
-std::array<float,2>{0.794995248f, 0.124749452f},
-std::array<float,2>{0.366992742f, 0.377425611f},
-std::array<float,2>{0.823875844f, 0.629995704f},
-std::array<float,2>{0.19498302f, 0.955146253f},
-std::array<float,2>{0.611939251f, 0.207372114f},
-std::array<float,2>{0.0639601573f, 0.0105742849f},
-std::array<float,2>{0.735358119f, 0.78065443f},
-std::array<float,2>{0.416729838f, 0.615986645f},
-std::array<float,2>{0.899733365f, 0.263661444f},
-std::array<float,2>{0.264140964f, 0.0925773606f},
-std::array<float,2>{0.773892164f, 0.850726843f},
-std::array<float,2>{0.143511176f, 0.542026579f},
-std::array<float,2>{0.511483669f, 0.31426397f},
-std::array<float,2>{0.0251285695f, 0.449685156f},
-std::array<float,2>{0.666164458f, 0.749862611f},
-std::array<float,2>{0.44317019f, 0.927184522f},
-std::array<float,2>{0.954406619f, 0.177815914f},
-std::array<float,2>{0.396772146f, 0.29485777f},
-std::array<float,2>{0.919361234f, 0.581240475f},
-std::array<float,2>{0.121671982f, 0.786535501f},
-std::array<float,2>{0.706636786f, 0.0609335154f},
-std::array<float,2>{0.249083623f, 0.234522343f},
-std::array<float,2>{0.563714743f, 0.980462611f},
-std::array<float,2>{0.315039873f, 0.668621957f},
-std::array<float,2>{0.84962821f, 0.421654403f},
-std::array<float,2>{0.427906156f, 0.0352194272f},
-std::array<float,2>{0.890545189f, 0.803688228f},
-std::array<float,2>{0.0901342928f, 0.576451242f},
-std::array<float,2>{0.725918293f, 0.307776719f},
-std::array<float,2>{0.203390628f, 0.429285288f},
-std::array<float,2>{0.604720175f, 0.674503446f},
-std::array<float,2>{0.344196767f, 0.988613486f},
-std::array<float,2>{0.835732341f, 0.225572407f},
-std::array<float,2>{0.289865404f, 0.342149407f},
-std::array<float,2>{0.800502717f, 0.55278194f},
-std::array<float,2>{0.186844662f, 0.861557782f},
-std::array<float,2>{0.537831783f, 0.0724569261f},
-std::array<float,2>{0.0504521243f, 0.170065597f},
-std::array<float,2>{0.647628844f, 0.916119277f},
-std::array<float,2>{0.477826774f, 0.721973777f},
-std::array<float,2>{0.998785377f, 0.455196828f},
-std::array<float,2>{0.333895922f, 0.193729624f},
-std::array<float,2>{0.868024826f, 0.946603f},
-std::array<float,2>{0.220958501f, 0.653627038f},
-std::array<float,2>{0.589268684f, 0.392709911f},
-std::array<float,2>{0.0947448835f, 0.267302245f},
-std::array<float,2>{0.69130981f, 0.604341626f},
-std::array<float,2>{0.382135689f, 0.757113576f},
-std::array<float,2>{0.930775166f, 0.0305176079f},
-std::array<float,2>{0.454109222f, 0.496882617f},
-std::array<float,2>{0.941785038f, 0.704859614f},
-std::array<float,2>{0.00567521295f, 0.895604014f},
-std::array<float,2>{0.681897044f, 0.14988777f},
-std::array<float,2>{0.131909564f, 0.0973603204f},
-std::array<float,2>{0.530404389f, 0.816320062f},
-std::array<float,2>{0.272330821f, 0.51345396f},
-std::array<float,2>{0.759924054f, 0.354160696f},
-std::array<float,2>{0.383863628f, 0.232418314f},
-std::array<float,2>{0.927987576f, 0.999410808f},
-std::array<float,2>{0.102938071f, 0.684345305f},
-std::array<float,2>{0.696424961f, 0.435224444f},
-std::array<float,2>{0.228278339f, 0.301858753f},
-std::array<float,2>{0.578728855f, 0.563990533f},
-std::array<float,2>{0.340589553f, 0.806556344f},
-std::array<float,2>{0.865350306f, 0.0411020257f},
-std::array<float,2>{0.279373527f, 0.461631209f},
-std::array<float,2>{0.755348861f, 0.728691638f},
-std::array<float,2>{0.138553053f, 0.912588656f},
-std::array<float,2>{0.520034194f, 0.157580256f},
-std::array<float,2>{0.0139425211f, 0.0691812113f},
-std::array<float,2>{0.677400291f, 0.87141031f},
-std::array<float,2>{0.468657434f, 0.5548141f},
-std::array<float,2>{0.949914277f, 0.335312456f},
-std::array<float,2>{0.357112676f, 0.0205306914f},
-std::array<float,2>{0.842890382f, 0.759870172f},
-std::array<float,2>{0.21734944f, 0.594361365f},
-std::array<float,2>{0.600366712f, 0.273458391f},
-std::array<float,2>{0.0858499035f, 0.40480718f},
-std::array<float,2>{0.732895136f, 0.642809391f},
-std::array<float,2>{0.432127744f, 0.939173043f},
-std::array<float,2>{0.876301527f, 0.195733085f},
-std::array<float,2>{0.476347387f, 0.348315895f},
-std::array<float,2>{0.990960717f, 0.503816783f},
-std::array<float,2>{0.0582926832f, 0.825111389f},
-std::array<float,2>{0.648940504f, 0.10367731f},
-std::array<float,2>{0.174848795f, 0.148065493f},
-std::array<float,2>{0.545350671f, 0.901944637f},
-std::array<float,2>{0.286618859f, 0.717643201f},
-std::array<float,2>{0.806555629f, 0.485211909f},
-std::array<float,2>{0.452273786f, 0.117052794f},
-std::array<float,2>{0.967340827f, 0.837695956f},
-std::array<float,2>{0.016805023f, 0.517347217f},
-std::array<float,2>{0.663814545f, 0.37116763f},
-std::array<float,2>{0.148601472f, 0.483616918f},
-std::array<float,2>{0.501451194f, 0.69342649f},
-std::array<float,2>{0.256634891f, 0.875913203f},
-std::array<float,2>{0.771285415f, 0.134781659f},
-std::array<float,2>{0.322399288f, 0.254699141f},
-std::array<float,2>{0.851727188f, 0.618800759f},
-std::array<float,2>{0.236627802f, 0.769958615f},
-std::array<float,2>{0.577134788f, 0.00195235142f},
-std::array<float,2>{0.114308529f, 0.212704271f},
-std::array<float,2>{0.714091837f, 0.963173866f},
-std::array<float,2>{0.401095122f, 0.634626687f},
-std::array<float,2>{0.909181893f, 0.387010127f},
-std::array<float,2>{0.298388004f, 0.183328718f},
-std::array<float,2>{0.788396716f, 0.930351257f},
-std::array<float,2>{0.158712789f, 0.741919518f},
-std::array<float,2>{0.548312306f, 0.442694217f},
-std::array<float,2>{0.0349285342f, 0.32416901f},
-std::array<float,2>{0.637444615f, 0.534386575f},
-std::array<float,2>{0.497797608f, 0.85206759f},
-std::array<float,2>{0.982543349f, 0.0824295506f},
-std::array<float,2>{0.41112572f, 0.407798082f},
-std::array<float,2>{0.891683817f, 0.656981111f},
-std::array<float,2>{0.0709707364f, 0.973553479f},
-std::array<float,2>{0.744718611f, 0.242843866f},
-std::array<float,2>{0.201468796f, 0.051070828f},
-std::array<float,2>{0.619804323f, 0.795874417f},
-std::array<float,2>{0.369749248f, 0.588945031f},
-std::array<float,2>{0.815854847f, 0.287162483f},
-std::array<float,2>{0.461978048f, 0.204766363f},
-std::array<float,2>{0.948170722f, 0.958561778f},
-std::array<float,2>{0.00882938877f, 0.627158701f},
-std::array<float,2>{0.672451079f, 0.380839318f},
-std::array<float,2>{0.135780632f, 0.258702755f},
-std::array<float,2>{0.518142998f, 0.612410843f},
-std::array<float,2>{0.27707386f, 0.776741564f},
-std::array<float,2>{0.750301957f, 0.0155080529f},
-std::array<float,2>{0.338301003f, 0.474004865f},
-std::array<float,2>{0.862371564f, 0.698558271f},
-std::array<float,2>{0.234126911f, 0.888436019f},
-std::array<float,2>{0.584201396f, 0.129106268f},
-std::array<float,2>{0.10654632f, 0.119203858f},
-std::array<float,2>{0.702214479f, 0.828959584f},
-std::array<float,2>{0.387133777f, 0.524397731f},
-std::array<float,2>{0.924063683f, 0.36485225f},
-std::array<float,2>{0.28334254f, 0.0565426461f},
-std::array<float,2>{0.809865892f, 0.782529712f},
-std::array<float,2>{0.177816495f, 0.583250105f},
-std::array<float,2>{0.542336762f, 0.29202342f},
-std::array<float,2>{0.0603215173f, 0.41688484f},
-std::array<float,2>{0.652613938f, 0.665021777f},
-std::array<float,2>{0.4699893f, 0.982742965f},
-std::array<float,2>{0.986400604f, 0.239814982f},
-std::array<float,2>{0.434155911f, 0.318506986f},
-std::array<float,2>{0.882356584f, 0.545619726f},
-std::array<float,2>{0.0789463222f, 0.847368419f},
-std::array<float,2>{0.727414548f, 0.0872749537f},
-std::array<float,2>{0.212238774f, 0.172258139f},
-std::array<float,2>{0.594022274f, 0.921901166f},
-std::array<float,2>{0.35376212f, 0.745929301f},
-std::array<float,2>{0.836095691f, 0.447185457f},
-std::array<float,2>{0.402840316f, 0.0772720054f},
-std::array<float,2>{0.91268903f, 0.864356518f},
-std::array<float,2>{0.112522885f, 0.548476458f},
-std::array<float,2>{0.71498853f, 0.338062495f},
-std::array<float,2>{0.240774527f, 0.457467705f},
-std::array<float,2>{0.57058388f, 0.726148605f},
-std::array<float,2>{0.324954331f, 0.921576321f},
-std::array<float,2>{0.857038081f, 0.166773409f},
-std::array<float,2>{0.252904385f, 0.311354846f},
-std::array<float,2>{0.766754031f, 0.573487818f},
-std::array<float,2>{0.154034585f, 0.79750669f},
-std::array<float,2>{0.506101966f, 0.0323029459f},
-std::array<float,2>{0.0227612592f, 0.221145853f},
-std::array<float,2>{0.65883249f, 0.987633526f},
-std::array<float,2>{0.446639687f, 0.678951025f},
-std::array<float,2>{0.962385237f, 0.422666341f},
-std::array<float,2>{0.371665627f, 0.152536035f},
-std::array<float,2>{0.818237722f, 0.89369303f},
-std::array<float,2>{0.19610931f, 0.710351706f},
-std::array<float,2>{0.624927223f, 0.492629111f},
-std::array<float,2>{0.075505659f, 0.358997852f},
-std::array<float,2>{0.746650159f, 0.509582877f},
-std::array<float,2>{0.408304304f, 0.816615343f},
-std::array<float,2>{0.895431817f, 0.098108612f},
-std::array<float,2>{0.495917022f, 0.398381859f},
-std::array<float,2>{0.978194356f, 0.649079025f},
-std::array<float,2>{0.0361898653f, 0.950452387f},
-std::array<float,2>{0.634058595f, 0.191099852f},
-std::array<float,2>{0.162394837f, 0.0266650207f},
-std::array<float,2>{0.552791595f, 0.751296341f},
-std::array<float,2>{0.301764667f, 0.607914925f},
-std::array<float,2>{0.782467961f, 0.271639228f},
-std::array<float,2>{0.41994074f, 0.160572156f},
-std::array<float,2>{0.904683053f, 0.909725845f},
-std::array<float,2>{0.0685229152f, 0.730585158f},
-std::array<float,2>{0.739768028f, 0.468587339f},
-std::array<float,2>{0.188416183f, 0.330983311f},
-std::array<float,2>{0.614968121f, 0.561154962f},
-std::array<float,2>{0.360668689f, 0.869263649f},
-std::array<float,2>{0.827752292f, 0.0636286065f},
-std::array<float,2>{0.312433094f, 0.433006763f},
-std::array<float,2>{0.790904224f, 0.682350993f},
-std::array<float,2>{0.169758841f, 0.993114412f},
-std::array<float,2>{0.558064401f, 0.22762993f},
-std::array<float,2>{0.041277077f, 0.0443496481f},
-std::array<float,2>{0.630499899f, 0.812381983f},
-std::array<float,2>{0.486402035f, 0.566776216f},
-std::array<float,2>{0.972170532f, 0.299427122f},
-std::array<float,2>{0.317561984f, 0.10647472f},
-std::array<float,2>{0.846183181f, 0.823018014f},
-std::array<float,2>{0.244030073f, 0.506311059f},
-std::array<float,2>{0.569735348f, 0.344999373f},
-std::array<float,2>{0.120087899f, 0.491751611f},
-std::array<float,2>{0.709286869f, 0.711448371f},
-std::array<float,2>{0.39446035f, 0.903835654f},
-std::array<float,2>{0.915999115f, 0.144289583f},
-std::array<float,2>{0.438519508f, 0.27777496f},
-std::array<float,2>{0.957535565f, 0.598075688f},
-std::array<float,2>{0.0284968875f, 0.764150679f},
-std::array<float,2>{0.670169592f, 0.0160889756f},
-std::array<float,2>{0.14797987f, 0.200246915f},
-std::array<float,2>{0.513762295f, 0.942259908f},
-std::array<float,2>{0.259625822f, 0.646417618f},
-std::array<float,2>{0.77993238f, 0.401119053f},
-std::array<float,2>{0.483552039f, 0.00471147895f},
-std::array<float,2>{0.995016992f, 0.769489169f},
-std::array<float,2>{0.0515810922f, 0.623033941f},
-std::array<float,2>{0.642247081f, 0.252644747f},
-std::array<float,2>{0.181596711f, 0.384117156f},
-std::array<float,2>{0.534607828f, 0.638741672f},
-std::array<float,2>{0.293610185f, 0.967480183f},
-std::array<float,2>{0.804230869f, 0.218183547f},
-std::array<float,2>{0.348854959f, 0.367646843f},
-std::array<float,2>{0.829026818f, 0.520287514f},
-std::array<float,2>{0.209699467f, 0.839993238f},
-std::array<float,2>{0.605555296f, 0.112959132f},
-std::array<float,2>{0.0881022513f, 0.13741979f},
-std::array<float,2>{0.718962371f, 0.881847978f},
-std::array<float,2>{0.42340064f, 0.6875875f},
-std::array<float,2>{0.884380996f, 0.479826093f},
-std::array<float,2>{0.266111344f, 0.246427417f},
-std::array<float,2>{0.765270233f, 0.969414949f},
-std::array<float,2>{0.128374323f, 0.661062539f},
-std::array<float,2>{0.527163506f, 0.411334604f},
-std::array<float,2>{0.00208707433f, 0.281358868f},
-std::array<float,2>{0.684369743f, 0.592363417f},
-std::array<float,2>{0.458998114f, 0.791428864f},
-std::array<float,2>{0.941089809f, 0.0474114604f},
-std::array<float,2>{0.375284821f, 0.439522356f},
-std::array<float,2>{0.936517239f, 0.735843122f},
-std::array<float,2>{0.0997948647f, 0.935973465f},
-std::array<float,2>{0.695115507f, 0.185508817f},
-std::array<float,2>{0.225518361f, 0.0807825848f},
-std::array<float,2>{0.591523468f, 0.857951045f},
-std::array<float,2>{0.331607014f, 0.537350118f},
-std::array<float,2>{0.872339368f, 0.327906013f},
-std::array<float,2>{0.449684829f, 0.135381669f},
-std::array<float,2>{0.966216087f, 0.875183702f},
-std::array<float,2>{0.0183539893f, 0.694118619f},
-std::array<float,2>{0.661573529f, 0.484337121f},
-std::array<float,2>{0.150452524f, 0.371879995f},
-std::array<float,2>{0.502904952f, 0.516798198f},
-std::array<float,2>{0.255416214f, 0.837260008f},
-std::array<float,2>{0.77203089f, 0.11655511f},
-std::array<float,2>{0.320688039f, 0.387603223f},
-std::array<float,2>{0.854737401f, 0.633991778f},
-std::array<float,2>{0.236187607f, 0.963530123f},
-std::array<float,2>{0.575349867f, 0.21209392f},
-std::array<float,2>{0.115849867f, 0.00105415611f},
-std::array<float,2>{0.711019635f, 0.770428896f},
-std::array<float,2>{0.398656219f, 0.618250787f},
-std::array<float,2>{0.907789171f, 0.2539635f},
-std::array<float,2>{0.299833685f, 0.0828911439f},
-std::array<float,2>{0.785216093f, 0.851947367f},
-std::array<float,2>{0.156496525f, 0.535056233f},
-std::array<float,2>{0.550515294f, 0.323568046f},
-std::array<float,2>{0.0325187705f, 0.443314224f},
-std::array<float,2>{0.638884187f, 0.74155128f},
-std::array<float,2>{0.49866122f, 0.929802477f},
-std::array<float,2>{0.982223034f, 0.182787552f},
-std::array<float,2>{0.413826764f, 0.287679166f},
-std::array<float,2>{0.894383729f, 0.589790344f},
-std::array<float,2>{0.0731988773f, 0.795165777f},
-std::array<float,2>{0.743575454f, 0.0517056733f},
-std::array<float,2>{0.199319586f, 0.242365614f},
-std::array<float,2>{0.618550897f, 0.972677231f},
-std::array<float,2>{0.367561251f, 0.656489432f},
-std::array<float,2>{0.813959539f, 0.407481194f},
-std::array<float,2>{0.386169463f, 0.0418721102f},
-std::array<float,2>{0.927183926f, 0.80603224f},
-std::array<float,2>{0.104605697f, 0.563952565f},
-std::array<float,2>{0.69810468f, 0.302706987f},
-std::array<float,2>{0.229350999f, 0.434854984f},
-std::array<float,2>{0.581093788f, 0.683955908f},
-std::array<float,2>{0.343289405f, 0.999743998f},
-std::array<float,2>{0.863285124f, 0.23188597f},
-std::array<float,2>{0.27845946f, 0.33590892f},
-std::array<float,2>{0.757676065f, 0.555654466f},
-std::array<float,2>{0.139050558f, 0.871622801f},
-std::array<float,2>{0.523153305f, 0.0688459054f},
-std::array<float,2>{0.0125691956f, 0.15776214f},
-std::array<float,2>{0.679069579f, 0.912741601f},
-std::array<float,2>{0.466009557f, 0.729439855f},
-std::array<float,2>{0.952009141f, 0.461376488f},
-std::array<float,2>{0.358101487f, 0.196040481f},
-std::array<float,2>{0.840769291f, 0.938600004f},
-std::array<float,2>{0.215755776f, 0.643520772f},
-std::array<float,2>{0.599584103f, 0.4046534f},
-std::array<float,2>{0.0821149051f, 0.273994684f},
-std::array<float,2>{0.730521023f, 0.593906105f},
-std::array<float,2>{0.430780023f, 0.760435998f},
-std::array<float,2>{0.877942622f, 0.0211622771f},
-std::array<float,2>{0.474568546f, 0.484607399f},
-std::array<float,2>{0.988803208f, 0.716935575f},
-std::array<float,2>{0.0553947277f, 0.901731253f},
-std::array<float,2>{0.650521874f, 0.14775461f},
-std::array<float,2>{0.172274396f, 0.104127631f},
-std::array<float,2>{0.544535697f, 0.824343324f},
-std::array<float,2>{0.288464785f, 0.50312382f},
-std::array<float,2>{0.807986975f, 0.347664416f},
-std::array<float,2>{0.427330971f, 0.22467874f},
-std::array<float,2>{0.887423933f, 0.989253521f},
-std::array<float,2>{0.0921426713f, 0.673873305f},
-std::array<float,2>{0.723489404f, 0.42897284f},
-std::array<float,2>{0.207015112f, 0.308308125f},
-std::array<float,2>{0.602155149f, 0.57703793f},
-std::array<float,2>{0.346298397f, 0.803150594f},
-std::array<float,2>{0.832683325f, 0.035889402f},
-std::array<float,2>{0.292308122f, 0.455895483f},
-std::array<float,2>{0.798722744f, 0.722218573f},
-std::array<float,2>{0.184920773f, 0.916597068f},
-std::array<float,2>{0.535456777f, 0.170456171f},
-std::array<float,2>{0.0487351157f, 0.0727617592f},
-std::array<float,2>{0.645828784f, 0.862097383f},
-std::array<float,2>{0.479855478f, 0.553314686f},
-std::array<float,2>{0.997368455f, 0.34251377f},
-std::array<float,2>{0.335432649f, 0.0312253404f},
-std::array<float,2>{0.870347857f, 0.757569373f},
-std::array<float,2>{0.219527364f, 0.603520215f},
-std::array<float,2>{0.587703526f, 0.266967267f},
-std::array<float,2>{0.0958817378f, 0.393185437f},
-std::array<float,2>{0.687982619f, 0.654224277f},
-std::array<float,2>{0.380381078f, 0.946983755f},
-std::array<float,2>{0.932396412f, 0.194073334f},
-std::array<float,2>{0.456757456f, 0.353729457f},
-std::array<float,2>{0.944096744f, 0.512759745f},
-std::array<float,2>{0.0064063007f, 0.815825701f},
-std::array<float,2>{0.680352211f, 0.0969445109f},
-std::array<float,2>{0.129824132f, 0.149934858f},
-std::array<float,2>{0.529264033f, 0.896445096f},
-std::array<float,2>{0.270448029f, 0.704182565f},
-std::array<float,2>{0.758177936f, 0.496193856f},
-std::array<float,2>{0.489887416f, 0.124038227f},
-std::array<float,2>{0.972817898f, 0.835921228f},
-std::array<float,2>{0.0439512618f, 0.529326022f},
-std::array<float,2>{0.626705706f, 0.359685987f},
-std::array<float,2>{0.164953917f, 0.468975961f},
-std::array<float,2>{0.560014844f, 0.701361835f},
-std::array<float,2>{0.305274844f, 0.883646607f},
-std::array<float,2>{0.793186069f, 0.12763837f},
-std::array<float,2>{0.363631308f, 0.262995899f},
-std::array<float,2>{0.821599603f, 0.615577221f},
-std::array<float,2>{0.193141416f, 0.780772686f},
-std::array<float,2>{0.610266209f, 0.00984103791f},
-std::array<float,2>{0.0651415884f, 0.207917094f},
-std::array<float,2>{0.736346304f, 0.955816329f},
-std::array<float,2>{0.415202975f, 0.630449414f},
-std::array<float,2>{0.901230097f, 0.377678245f},
-std::array<float,2>{0.262700856f, 0.178431898f},
-std::array<float,2>{0.776361525f, 0.9277156f},
-std::array<float,2>{0.141106501f, 0.749504387f},
-std::array<float,2>{0.508410454f, 0.449842989f},
-std::array<float,2>{0.0273273829f, 0.313648611f},
-std::array<float,2>{0.665982187f, 0.542580664f},
-std::array<float,2>{0.444676131f, 0.851194799f},
-std::array<float,2>{0.956026852f, 0.0920656621f},
-std::array<float,2>{0.394641757f, 0.420994639f},
-std::array<float,2>{0.921610177f, 0.668133378f},
-std::array<float,2>{0.124984197f, 0.979697168f},
-std::array<float,2>{0.704747319f, 0.23522146f},
-std::array<float,2>{0.247815952f, 0.0612107255f},
-std::array<float,2>{0.566310585f, 0.786955535f},
-std::array<float,2>{0.312569112f, 0.581665456f},
-std::array<float,2>{0.849125922f, 0.294151723f},
-std::array<float,2>{0.480844319f, 0.218400925f},
-std::array<float,2>{0.993090272f, 0.966914177f},
-std::array<float,2>{0.0533152521f, 0.639184654f},
-std::array<float,2>{0.642769039f, 0.384570986f},
-std::array<float,2>{0.183150649f, 0.252187192f},
-std::array<float,2>{0.532449901f, 0.622474968f},
-std::array<float,2>{0.295917034f, 0.768943965f},
-std::array<float,2>{0.802581072f, 0.00430605235f},
-std::array<float,2>{0.350053787f, 0.480420262f},
-std::array<float,2>{0.830918849f, 0.688389838f},
-std::array<float,2>{0.20845221f, 0.882429838f},
-std::array<float,2>{0.608317554f, 0.137186944f},
-std::array<float,2>{0.087528713f, 0.11236158f},
-std::array<float,2>{0.72260195f, 0.84080863f},
-std::array<float,2>{0.424552292f, 0.51981616f},
-std::array<float,2>{0.886262953f, 0.367873698f},
-std::array<float,2>{0.269234449f, 0.0473142825f},
-std::array<float,2>{0.763017654f, 0.791832507f},
-std::array<float,2>{0.125299066f, 0.591924548f},
-std::array<float,2>{0.525015712f, 0.282040954f},
-std::array<float,2>{0.00187221088f, 0.411814898f},
-std::array<float,2>{0.685576975f, 0.660209596f},
-std::array<float,2>{0.458876878f, 0.968982875f},
-std::array<float,2>{0.938095093f, 0.246804088f},
-std::array<float,2>{0.377579749f, 0.32748726f},
-std::array<float,2>{0.935461581f, 0.537789643f},
-std::array<float,2>{0.098295182f, 0.857422054f},
-std::array<float,2>{0.691757083f, 0.080510281f},
-std::array<float,2>{0.224372104f, 0.184918091f},
-std::array<float,2>{0.592596292f, 0.936480105f},
-std::array<float,2>{0.329729378f, 0.735589206f},
-std::array<float,2>{0.874196589f, 0.439982414f},
-std::array<float,2>{0.418510616f, 0.0642020032f},
-std::array<float,2>{0.902748644f, 0.869756103f},
-std::array<float,2>{0.0664605871f, 0.560593665f},
-std::array<float,2>{0.741773963f, 0.330304265f},
-std::array<float,2>{0.189683318f, 0.468026727f},
-std::array<float,2>{0.617110252f, 0.731216609f},
-std::array<float,2>{0.361354619f, 0.909644425f},
-std::array<float,2>{0.824667215f, 0.161108345f},
-std::array<float,2>{0.308801234f, 0.299021512f},
-std::array<float,2>{0.792633355f, 0.567326725f},
-std::array<float,2>{0.169929579f, 0.811637342f},
-std::array<float,2>{0.555247962f, 0.044665575f},
-std::array<float,2>{0.0398963578f, 0.22836706f},
-std::array<float,2>{0.631016612f, 0.992247105f},
-std::array<float,2>{0.48604852f, 0.681841433f},
-std::array<float,2>{0.968750954f, 0.433488995f},
-std::array<float,2>{0.318993151f, 0.14379026f},
-std::array<float,2>{0.844763994f, 0.903489888f},
-std::array<float,2>{0.244763225f, 0.711310387f},
-std::array<float,2>{0.566974938f, 0.491601735f},
-std::array<float,2>{0.117225066f, 0.345530927f},
-std::array<float,2>{0.707830548f, 0.506832302f},
-std::array<float,2>{0.392145008f, 0.822484434f},
-std::array<float,2>{0.916374445f, 0.107241139f},
-std::array<float,2>{0.44116196f, 0.400640786f},
-std::array<float,2>{0.960461855f, 0.645937562f},
-std::array<float,2>{0.0293866917f, 0.94141686f},
-std::array<float,2>{0.668355882f, 0.200884461f},
-std::array<float,2>{0.144910648f, 0.0165613964f},
-std::array<float,2>{0.512007713f, 0.764491498f},
-std::array<float,2>{0.261669934f, 0.598500669f},
-std::array<float,2>{0.777631044f, 0.278100073f},
-std::array<float,2>{0.40476808f, 0.166022047f},
-std::array<float,2>{0.911551595f, 0.921125352f},
-std::array<float,2>{0.110038295f, 0.725621641f},
-std::array<float,2>{0.718332052f, 0.457608312f},
-std::array<float,2>{0.239985317f, 0.33855015f},
-std::array<float,2>{0.573842108f, 0.547894537f},
-std::array<float,2>{0.327313393f, 0.865090609f},
-std::array<float,2>{0.859005809f, 0.0776997209f},
-std::array<float,2>{0.25152126f, 0.421922714f},
-std::array<float,2>{0.76821667f, 0.679576993f},
-std::array<float,2>{0.155696645f, 0.987833738f},
-std::array<float,2>{0.504154503f, 0.221516773f},
-std::array<float,2>{0.0214661248f, 0.0331859663f},
-std::array<float,2>{0.658174932f, 0.796955526f},
-std::array<float,2>{0.448064506f, 0.574040174f},
-std::array<float,2>{0.96478045f, 0.310917705f},
-std::array<float,2>{0.373467177f, 0.0983804688f},
-std::array<float,2>{0.819691122f, 0.817082047f},
-std::array<float,2>{0.198490396f, 0.509022832f},
-std::array<float,2>{0.623012483f, 0.358652055f},
-std::array<float,2>{0.0780087635f, 0.493161678f},
-std::array<float,2>{0.749143779f, 0.710686684f},
-std::array<float,2>{0.407168597f, 0.894230127f},
-std::array<float,2>{0.896838844f, 0.153136238f},
-std::array<float,2>{0.492225081f, 0.27209574f},
-std::array<float,2>{0.978620827f, 0.607700467f},
-std::array<float,2>{0.0371870287f, 0.751620173f},
-std::array<float,2>{0.635636449f, 0.0271056518f},
-std::array<float,2>{0.160439029f, 0.190685987f},
-std::array<float,2>{0.552003205f, 0.950947464f},
-std::array<float,2>{0.303683043f, 0.64865905f},
-std::array<float,2>{0.784604192f, 0.397585064f},
-std::array<float,2>{0.462927222f, 0.014871465f},
-std::array<float,2>{0.946777463f, 0.777223408f},
-std::array<float,2>{0.0103258863f, 0.612925589f},
-std::array<float,2>{0.675316334f, 0.258017272f},
-std::array<float,2>{0.133200079f, 0.38026467f},
-std::array<float,2>{0.517214715f, 0.627613723f},
-std::array<float,2>{0.273964673f, 0.958219111f},
-std::array<float,2>{0.753286004f, 0.20418632f},
-std::array<float,2>{0.337079495f, 0.364294976f},
-std::array<float,2>{0.861308813f, 0.523605287f},
-std::array<float,2>{0.232183635f, 0.828547657f},
-std::array<float,2>{0.583373249f, 0.119831987f},
-std::array<float,2>{0.108213454f, 0.129563212f},
-std::array<float,2>{0.699425876f, 0.88803339f},
-std::array<float,2>{0.389428079f, 0.698978424f},
-std::array<float,2>{0.922795057f, 0.474170506f},
-std::array<float,2>{0.282655418f, 0.239373028f},
-std::array<float,2>{0.811509132f, 0.983275354f},
-std::array<float,2>{0.175800681f, 0.664129496f},
-std::array<float,2>{0.540478408f, 0.416097611f},
-std::array<float,2>{0.0618111566f, 0.2925286f},
-std::array<float,2>{0.654802859f, 0.583595932f},
-std::array<float,2>{0.470866412f, 0.782819569f},
-std::array<float,2>{0.985752642f, 0.0558973104f},
-std::array<float,2>{0.435996115f, 0.446629077f},
-std::array<float,2>{0.878908336f, 0.745372236f},
-std::array<float,2>{0.0802017897f, 0.922841549f},
-std::array<float,2>{0.730208755f, 0.172571331f},
-std::array<float,2>{0.214234322f, 0.0876771659f},
-std::array<float,2>{0.596434772f, 0.846901119f},
-std::array<float,2>{0.351614088f, 0.544987023f},
-std::array<float,2>{0.838651836f, 0.318989247f},
-std::array<float,2>{0.497282982f, 0.179791227f},
-std::array<float,2>{0.983371675f, 0.932136059f},
-std::array<float,2>{0.0342434309f, 0.739848554f},
-std::array<float,2>{0.636999488f, 0.444675416f},
-std::array<float,2>{0.15827176f, 0.320315331f},
-std::array<float,2>{0.548751295f, 0.532212198f},
-std::array<float,2>{0.29831019f, 0.854243398f},
-std::array<float,2>{0.788820446f, 0.0846543163f},
-std::array<float,2>{0.369489521f, 0.409698844f},
-std::array<float,2>{0.816132903f, 0.6597718f},
-std::array<float,2>{0.202050775f, 0.975566626f},
-std::array<float,2>{0.619313478f, 0.244625688f},
-std::array<float,2>{0.0706150308f, 0.0531049334f},
-std::array<float,2>{0.744347453f, 0.794552386f},
-std::array<float,2>{0.410464138f, 0.586984932f},
-std::array<float,2>{0.892213166f, 0.286992401f},
-std::array<float,2>{0.255898356f, 0.114793561f},
-std::array<float,2>{0.770659268f, 0.838114858f},
-std::array<float,2>{0.149241328f, 0.518572986f},
-std::array<float,2>{0.501718879f, 0.374379128f},
-std::array<float,2>{0.0175183099f, 0.482247502f},
-std::array<float,2>{0.663164556f, 0.693252325f},
-std::array<float,2>{0.453083605f, 0.878474832f},
-std::array<float,2>{0.967004836f, 0.133427441f},
-std::array<float,2>{0.400832862f, 0.256194144f},
-std::array<float,2>{0.909695804f, 0.620689571f},
-std::array<float,2>{0.114801675f, 0.773427725f},
-std::array<float,2>{0.71452862f, 0.00380793633f},
-std::array<float,2>{0.23710002f, 0.214001209f},
-std::array<float,2>{0.576436877f, 0.961206913f},
-std::array<float,2>{0.322816759f, 0.636426866f},
-std::array<float,2>{0.852441788f, 0.389291823f},
-std::array<float,2>{0.432528555f, 0.0223056693f},
-std::array<float,2>{0.876548707f, 0.758350074f},
-std::array<float,2>{0.0853791162f, 0.597442985f},
-std::array<float,2>{0.733048856f, 0.276096612f},
-std::array<float,2>{0.216814741f, 0.402859658f},
-std::array<float,2>{0.599682927f, 0.641149759f},
-std::array<float,2>{0.356548846f, 0.940174282f},
-std::array<float,2>{0.843311906f, 0.197784767f},
-std::array<float,2>{0.287057191f, 0.34961772f},
-std::array<float,2>{0.805970132f, 0.501423538f},
-std::array<float,2>{0.175470173f, 0.827714026f},
-std::array<float,2>{0.545594454f, 0.101737268f},
-std::array<float,2>{0.0578829199f, 0.144911796f},
-std::array<float,2>{0.648849666f, 0.899412096f},
-std::array<float,2>{0.475855172f, 0.71541512f},
-std::array<float,2>{0.990255833f, 0.487668574f},
-std::array<float,2>{0.340166092f, 0.233136043f},
-std::array<float,2>{0.866013706f, 0.99666214f},
-std::array<float,2>{0.227656722f, 0.687369645f},
-std::array<float,2>{0.578486979f, 0.435913622f},
-std::array<float,2>{0.103325203f, 0.304163665f},
-std::array<float,2>{0.697219849f, 0.564699948f},
-std::array<float,2>{0.384694666f, 0.807180822f},
-std::array<float,2>{0.928616583f, 0.0402715765f},
-std::array<float,2>{0.467952251f, 0.463632166f},
-std::array<float,2>{0.949534833f, 0.728119016f},
-std::array<float,2>{0.0142224971f, 0.912096322f},
-std::array<float,2>{0.677231908f, 0.160017878f},
-std::array<float,2>{0.138110429f, 0.0672238991f},
-std::array<float,2>{0.519967794f, 0.8733114f},
-std::array<float,2>{0.280225754f, 0.558318973f},
-std::array<float,2>{0.75566709f, 0.333333313f},
-std::array<float,2>{0.382721454f, 0.191424862f},
-std::array<float,2>{0.931180358f, 0.947534502f},
-std::array<float,2>{0.0954547524f, 0.655068934f},
-std::array<float,2>{0.690745234f, 0.391478151f},
-std::array<float,2>{0.2215112f, 0.268663377f},
-std::array<float,2>{0.589549839f, 0.602239609f},
-std::array<float,2>{0.333376616f, 0.754350305f},
-std::array<float,2>{0.867643893f, 0.029248653f},
-std::array<float,2>{0.271671027f, 0.498537362f},
-std::array<float,2>{0.760309398f, 0.70530802f},
-std::array<float,2>{0.132661775f, 0.898296654f},
-std::array<float,2>{0.531055927f, 0.150700808f},
-std::array<float,2>{0.00495163398f, 0.0956518203f},
-std::array<float,2>{0.682230413f, 0.814170837f},
-std::array<float,2>{0.454902828f, 0.514698446f},
-std::array<float,2>{0.942077279f, 0.353425294f},
-std::array<float,2>{0.344695747f, 0.0380636454f},
-std::array<float,2>{0.835119486f, 0.801732004f},
-std::array<float,2>{0.203683347f, 0.576126456f},
-std::array<float,2>{0.605381787f, 0.306053787f},
-std::array<float,2>{0.0906062722f, 0.426006585f},
-std::array<float,2>{0.726455212f, 0.672951877f},
-std::array<float,2>{0.428639024f, 0.991491497f},
-std::array<float,2>{0.889909446f, 0.22286734f},
-std::array<float,2>{0.478328675f, 0.341341197f},
-std::array<float,2>{0.99833858f, 0.552643239f},
-std::array<float,2>{0.0500275679f, 0.859413683f},
-std::array<float,2>{0.648288906f, 0.0715573207f},
-std::array<float,2>{0.187348157f, 0.168393493f},
-std::array<float,2>{0.537418425f, 0.914409041f},
-std::array<float,2>{0.289494365f, 0.719484091f},
-std::array<float,2>{0.800033391f, 0.454748213f},
-std::array<float,2>{0.442645997f, 0.0903282166f},
-std::array<float,2>{0.954952061f, 0.849193931f},
-std::array<float,2>{0.0247354973f, 0.539734781f},
-std::array<float,2>{0.666620374f, 0.315804332f},
-std::array<float,2>{0.143065557f, 0.451597929f},
-std::array<float,2>{0.510971308f, 0.746550083f},
-std::array<float,2>{0.264491469f, 0.928832293f},
-std::array<float,2>{0.774359107f, 0.177645192f},
-std::array<float,2>{0.314923614f, 0.295810461f},
-std::array<float,2>{0.850300848f, 0.578600466f},
-std::array<float,2>{0.249735773f, 0.788851142f},
-std::array<float,2>{0.564154685f, 0.0605439655f},
-std::array<float,2>{0.121231638f, 0.238153175f},
-std::array<float,2>{0.706240892f, 0.977114499f},
-std::array<float,2>{0.397407383f, 0.67000401f},
-std::array<float,2>{0.919784606f, 0.418907672f},
-std::array<float,2>{0.306897998f, 0.125936002f},
-std::array<float,2>{0.795817792f, 0.885580897f},
-std::array<float,2>{0.167136952f, 0.699775338f},
-std::array<float,2>{0.561447263f, 0.472241431f},
-std::array<float,2>{0.0462793633f, 0.361722052f},
-std::array<float,2>{0.628067851f, 0.527778983f},
-std::array<float,2>{0.491707206f, 0.832741082f},
-std::array<float,2>{0.974765837f, 0.12247543f},
-std::array<float,2>{0.416451037f, 0.375120878f},
-std::array<float,2>{0.900105715f, 0.631053865f},
-std::array<float,2>{0.0641636103f, 0.953481674f},
-std::array<float,2>{0.735905588f, 0.209392056f},
-std::array<float,2>{0.19463034f, 0.00857005455f},
-std::array<float,2>{0.611507475f, 0.777857184f},
-std::array<float,2>{0.366371065f, 0.614964962f},
-std::array<float,2>{0.8237198f, 0.26557225f},
-std::array<float,2>{0.459772348f, 0.24849999f},
-std::array<float,2>{0.940704763f, 0.971485436f},
-std::array<float,2>{0.0025753926f, 0.663547337f},
-std::array<float,2>{0.683889329f, 0.41326195f},
-std::array<float,2>{0.128543094f, 0.283612072f},
-std::array<float,2>{0.526521742f, 0.591507852f},
-std::array<float,2>{0.266532034f, 0.789353788f},
-std::array<float,2>{0.765121937f, 0.0493759103f},
-std::array<float,2>{0.331108779f, 0.439209342f},
-std::array<float,2>{0.873029172f, 0.736753464f},
-std::array<float,2>{0.224940702f, 0.934179485f},
-std::array<float,2>{0.591089964f, 0.186260849f},
-std::array<float,2>{0.100166842f, 0.0784393921f},
-std::array<float,2>{0.694672942f, 0.857338011f},
-std::array<float,2>{0.375886083f, 0.536426902f},
-std::array<float,2>{0.935805559f, 0.325995326f},
-std::array<float,2>{0.293340951f, 0.00618709577f},
-std::array<float,2>{0.804103792f, 0.767172813f},
-std::array<float,2>{0.181118876f, 0.623155951f},
-std::array<float,2>{0.534984469f, 0.250585049f},
-std::array<float,2>{0.0510031767f, 0.385659784f},
-std::array<float,2>{0.641817629f, 0.636920989f},
-std::array<float,2>{0.48424837f, 0.966578543f},
-std::array<float,2>{0.994603992f, 0.216571122f},
-std::array<float,2>{0.42306447f, 0.37080121f},
-std::array<float,2>{0.884245932f, 0.522025526f},
-std::array<float,2>{0.0884067044f, 0.843718112f},
-std::array<float,2>{0.719377339f, 0.109689765f},
-std::array<float,2>{0.209191963f, 0.140570223f},
-std::array<float,2>{0.606039524f, 0.880783677f},
-std::array<float,2>{0.34938702f, 0.691025913f},
-std::array<float,2>{0.828477085f, 0.476920843f},
-std::array<float,2>{0.393932492f, 0.107481949f},
-std::array<float,2>{0.915282011f, 0.821387887f},
-std::array<float,2>{0.119620427f, 0.50563091f},
-std::array<float,2>{0.709530413f, 0.347299039f},
-std::array<float,2>{0.243301839f, 0.489565432f},
-std::array<float,2>{0.570206404f, 0.712920845f},
-std::array<float,2>{0.317958623f, 0.904339492f},
-std::array<float,2>{0.846520007f, 0.142290294f},
-std::array<float,2>{0.259232461f, 0.27990675f},
-std::array<float,2>{0.779716671f, 0.599864781f},
-std::array<float,2>{0.147800043f, 0.76198101f},
-std::array<float,2>{0.51432091f, 0.0192195661f},
-std::array<float,2>{0.0292150099f, 0.201787427f},
-std::array<float,2>{0.670624137f, 0.943387508f},
-std::array<float,2>{0.438999116f, 0.647947133f},
-std::array<float,2>{0.957095563f, 0.39850381f},
-std::array<float,2>{0.360868692f, 0.162675366f},
-std::array<float,2>{0.827421308f, 0.907658994f},
-std::array<float,2>{0.187976599f, 0.732572615f},
-std::array<float,2>{0.614310384f, 0.465987772f},
-std::array<float,2>{0.0691338927f, 0.329497188f},
-std::array<float,2>{0.739426672f, 0.559086442f},
-std::array<float,2>{0.420720518f, 0.868459463f},
-std::array<float,2>{0.904870033f, 0.0647825822f},
-std::array<float,2>{0.487034142f, 0.429750025f},
-std::array<float,2>{0.971989989f, 0.681101203f},
-std::array<float,2>{0.0417669453f, 0.995261192f},
-std::array<float,2>{0.630240262f, 0.230137065f},
-std::array<float,2>{0.169080645f, 0.0454683602f},
-std::array<float,2>{0.558221996f, 0.809403777f},
-std::array<float,2>{0.31157133f, 0.569267809f},
-std::array<float,2>{0.790140688f, 0.297133803f},
-std::array<float,2>{0.408912897f, 0.155173644f},
-std::array<float,2>{0.894852996f, 0.891267896f},
-std::array<float,2>{0.075989157f, 0.707038045f},
-std::array<float,2>{0.746245623f, 0.495148629f},
-std::array<float,2>{0.195705116f, 0.356471509f},
-std::array<float,2>{0.624321282f, 0.509984314f},
-std::array<float,2>{0.37148872f, 0.819522738f},
-std::array<float,2>{0.817689002f, 0.100349255f},
-std::array<float,2>{0.302521497f, 0.396315485f},
-std::array<float,2>{0.782775521f, 0.650409818f},
-std::array<float,2>{0.162932068f, 0.953034937f},
-std::array<float,2>{0.553289235f, 0.187966779f},
-std::array<float,2>{0.0369099043f, 0.0235556811f},
-std::array<float,2>{0.634492695f, 0.75242579f},
-std::array<float,2>{0.495329469f, 0.605737805f},
-std::array<float,2>{0.977960646f, 0.27139774f},
-std::array<float,2>{0.32432425f, 0.0755190626f},
-std::array<float,2>{0.856910408f, 0.86614275f},
-std::array<float,2>{0.240372404f, 0.548933804f},
-std::array<float,2>{0.571099162f, 0.336081982f},
-std::array<float,2>{0.113115892f, 0.459939688f},
-std::array<float,2>{0.715395331f, 0.723094642f},
-std::array<float,2>{0.402592272f, 0.919045746f},
-std::array<float,2>{0.912114322f, 0.16570805f},
-std::array<float,2>{0.447209835f, 0.309443384f},
-std::array<float,2>{0.962419689f, 0.571311355f},
-std::array<float,2>{0.0233447105f, 0.799330115f},
-std::array<float,2>{0.658351421f, 0.0350143984f},
-std::array<float,2>{0.15358378f, 0.219569296f},
-std::array<float,2>{0.506589353f, 0.984660149f},
-std::array<float,2>{0.252034038f, 0.676908135f},
-std::array<float,2>{0.767094731f, 0.425700396f},
-std::array<float,2>{0.470347434f, 0.0569997691f},
-std::array<float,2>{0.987048328f, 0.785004854f},
-std::array<float,2>{0.0599677376f, 0.585268676f},
-std::array<float,2>{0.653275013f, 0.290348381f},
-std::array<float,2>{0.17855534f, 0.414453089f},
-std::array<float,2>{0.54273957f, 0.666857302f},
-std::array<float,2>{0.283867925f, 0.982211888f},
-std::array<float,2>{0.810215235f, 0.241924122f},
-std::array<float,2>{0.354230225f, 0.318185836f},
-std::array<float,2>{0.836576462f, 0.544720113f},
-std::array<float,2>{0.212803185f, 0.845277309f},
-std::array<float,2>{0.594247699f, 0.0880357102f},
-std::array<float,2>{0.0781540573f, 0.17487739f},
-std::array<float,2>{0.726660132f, 0.925330818f},
-std::array<float,2>{0.434009641f, 0.744096637f},
-std::array<float,2>{0.88217181f, 0.447818696f},
-std::array<float,2>{0.276379853f, 0.205507636f},
-std::array<float,2>{0.750957727f, 0.959261119f},
-std::array<float,2>{0.136402652f, 0.626698315f},
-std::array<float,2>{0.517706871f, 0.380992353f},
-std::array<float,2>{0.00928943977f, 0.260137975f},
-std::array<float,2>{0.671970248f, 0.60995549f},
-std::array<float,2>{0.462819815f, 0.773791611f},
-std::array<float,2>{0.947684884f, 0.0134565122f},
-std::array<float,2>{0.38759312f, 0.475573242f},
-std::array<float,2>{0.924631715f, 0.697003305f},
-std::array<float,2>{0.107361577f, 0.889031649f},
-std::array<float,2>{0.70300889f, 0.131409004f},
-std::array<float,2>{0.233482599f, 0.11895676f},
-std::array<float,2>{0.584522069f, 0.83071959f},
-std::array<float,2>{0.338454604f, 0.526544571f},
-std::array<float,2>{0.863108337f, 0.365884334f},
-std::array<float,2>{0.465380102f, 0.158647224f},
-std::array<float,2>{0.953076661f, 0.910646737f},
-std::array<float,2>{0.0127641317f, 0.727496266f},
-std::array<float,2>{0.678027034f, 0.464130133f},
-std::array<float,2>{0.140399888f, 0.332331568f},
-std::array<float,2>{0.521792293f, 0.557591796f},
-std::array<float,2>{0.277624071f, 0.874136448f},
-std::array<float,2>{0.75631094f, 0.068187125f},
-std::array<float,2>{0.342049569f, 0.436846375f},
-std::array<float,2>{0.86486578f, 0.686394036f},
-std::array<float,2>{0.229807064f, 0.998001873f},
-std::array<float,2>{0.581039548f, 0.23377201f},
-std::array<float,2>{0.10367351f, 0.0395835228f},
-std::array<float,2>{0.698314548f, 0.808291256f},
-std::array<float,2>{0.385564208f, 0.566343486f},
-std::array<float,2>{0.926569283f, 0.303504199f},
-std::array<float,2>{0.287743837f, 0.103035852f},
-std::array<float,2>{0.80738157f, 0.826332152f},
-std::array<float,2>{0.173115283f, 0.500866413f},
-std::array<float,2>{0.543395877f, 0.351082623f},
-std::array<float,2>{0.0557421409f, 0.487197071f},
-std::array<float,2>{0.651795149f, 0.715873241f},
-std::array<float,2>{0.473269969f, 0.899885118f},
-std::array<float,2>{0.989974439f, 0.145521626f},
-std::array<float,2>{0.430139482f, 0.276766449f},
-std::array<float,2>{0.877459824f, 0.596271455f},
-std::array<float,2>{0.0832003728f, 0.759421647f},
-std::array<float,2>{0.731589198f, 0.0230803266f},
-std::array<float,2>{0.216558814f, 0.198509306f},
-std::array<float,2>{0.598513484f, 0.941369951f},
-std::array<float,2>{0.35859856f, 0.64171654f},
-std::array<float,2>{0.841607332f, 0.404168636f},
-std::array<float,2>{0.39982897f, 0.00255135121f},
-std::array<float,2>{0.906833053f, 0.772002637f},
-std::array<float,2>{0.117069252f, 0.619794011f},
-std::array<float,2>{0.71260196f, 0.257030696f},
-std::array<float,2>{0.234412163f, 0.390620708f},
-std::array<float,2>{0.574794948f, 0.635557294f},
-std::array<float,2>{0.322212547f, 0.962563276f},
-std::array<float,2>{0.853793859f, 0.213233024f},
-std::array<float,2>{0.254442096f, 0.373702556f},
-std::array<float,2>{0.772693157f, 0.518100083f},
-std::array<float,2>{0.151723519f, 0.839259744f},
-std::array<float,2>{0.503254354f, 0.113601677f},
-std::array<float,2>{0.0187198762f, 0.134366482f},
-std::array<float,2>{0.660210729f, 0.877295911f},
-std::array<float,2>{0.450641453f, 0.691864014f},
-std::array<float,2>{0.965598404f, 0.481002033f},
-std::array<float,2>{0.368584484f, 0.24568744f},
-std::array<float,2>{0.813128591f, 0.976450324f},
-std::array<float,2>{0.200350478f, 0.658447981f},
-std::array<float,2>{0.617675364f, 0.408568859f},
-std::array<float,2>{0.0732488483f, 0.285895377f},
-std::array<float,2>{0.742947221f, 0.586116791f},
-std::array<float,2>{0.412806123f, 0.793625414f},
-std::array<float,2>{0.892930329f, 0.0544583835f},
-std::array<float,2>{0.49948746f, 0.443884641f},
-std::array<float,2>{0.980786085f, 0.738493145f},
-std::array<float,2>{0.0315188244f, 0.933451355f},
-std::array<float,2>{0.639837384f, 0.181159198f},
-std::array<float,2>{0.157730848f, 0.0850605592f},
-std::array<float,2>{0.549417436f, 0.855191052f},
-std::array<float,2>{0.299260437f, 0.532425523f},
-std::array<float,2>{0.786163986f, 0.321857423f},
-std::array<float,2>{0.41415447f, 0.210106641f},
-std::array<float,2>{0.90210712f, 0.954968035f},
-std::array<float,2>{0.0655032247f, 0.632805586f},
-std::array<float,2>{0.73772186f, 0.376262605f},
-std::array<float,2>{0.192092612f, 0.263703108f},
-std::array<float,2>{0.610544801f, 0.613393366f},
-std::array<float,2>{0.364810139f, 0.779221416f},
-std::array<float,2>{0.821039975f, 0.00967272371f},
-std::array<float,2>{0.306612968f, 0.470997393f},
-std::array<float,2>{0.794031739f, 0.701164424f},
-std::array<float,2>{0.165596321f, 0.886429846f},
-std::array<float,2>{0.558604658f, 0.126614556f},
-std::array<float,2>{0.0434328243f, 0.121316016f},
-std::array<float,2>{0.625274658f, 0.833747327f},
-std::array<float,2>{0.488583088f, 0.52925384f},
-std::array<float,2>{0.974440813f, 0.362361431f},
-std::array<float,2>{0.313664198f, 0.0592812449f},
-std::array<float,2>{0.848217607f, 0.787561417f},
-std::array<float,2>{0.246904701f, 0.579447627f},
-std::array<float,2>{0.564762414f, 0.296747386f},
-std::array<float,2>{0.123452991f, 0.419614494f},
-std::array<float,2>{0.703836441f, 0.670938194f},
-std::array<float,2>{0.395741463f, 0.977659166f},
-std::array<float,2>{0.920890749f, 0.236970052f},
-std::array<float,2>{0.443475217f, 0.31493327f},
-std::array<float,2>{0.956360281f, 0.540225327f},
-std::array<float,2>{0.0258677248f, 0.847720683f},
-std::array<float,2>{0.664932251f, 0.0913126543f},
-std::array<float,2>{0.142018005f, 0.175926611f},
-std::array<float,2>{0.509687603f, 0.928356171f},
-std::array<float,2>{0.261832416f, 0.747760534f},
-std::array<float,2>{0.776514828f, 0.452771217f},
-std::array<float,2>{0.478556842f, 0.070753932f},
-std::array<float,2>{0.997026265f, 0.861253023f},
-std::array<float,2>{0.047756128f, 0.550954878f},
-std::array<float,2>{0.645205677f, 0.340402067f},
-std::array<float,2>{0.184263095f, 0.45364961f},
-std::array<float,2>{0.536751509f, 0.720551491f},
-std::array<float,2>{0.29155612f, 0.915454865f},
-std::array<float,2>{0.797092378f, 0.169278532f},
-std::array<float,2>{0.346697688f, 0.305016279f},
-std::array<float,2>{0.833388805f, 0.574352384f},
-std::array<float,2>{0.20579724f, 0.802463591f},
-std::array<float,2>{0.603503108f, 0.0382981561f},
-std::array<float,2>{0.0935936496f, 0.22381261f},
-std::array<float,2>{0.723846614f, 0.990429521f},
-std::array<float,2>{0.426504344f, 0.672298312f},
-std::array<float,2>{0.887779593f, 0.427555412f},
-std::array<float,2>{0.271106362f, 0.152012378f},
-std::array<float,2>{0.759401321f, 0.896792531f},
-std::array<float,2>{0.130179673f, 0.706919611f},
-std::array<float,2>{0.527424216f, 0.499136209f},
-std::array<float,2>{0.0069102901f, 0.351972401f},
-std::array<float,2>{0.681300104f, 0.513687193f},
-std::array<float,2>{0.456023514f, 0.813291073f},
-std::array<float,2>{0.945059001f, 0.0937707722f},
-std::array<float,2>{0.379763693f, 0.392575204f},
-std::array<float,2>{0.932649553f, 0.655684829f},
-std::array<float,2>{0.097535789f, 0.949154794f},
-std::array<float,2>{0.689136803f, 0.193026066f},
-std::array<float,2>{0.22036019f, 0.0281623416f},
-std::array<float,2>{0.586857617f, 0.755156457f},
-std::array<float,2>{0.334755898f, 0.603148341f},
-std::array<float,2>{0.869943738f, 0.268378377f},
-std::array<float,2>{0.484717101f, 0.22941868f},
-std::array<float,2>{0.970233321f, 0.994692326f},
-std::array<float,2>{0.040903721f, 0.679964781f},
-std::array<float,2>{0.632207513f, 0.431171566f},
-std::array<float,2>{0.171399027f, 0.297910869f},
-std::array<float,2>{0.555786073f, 0.569343805f},
-std::array<float,2>{0.309995919f, 0.810122073f},
-std::array<float,2>{0.791038752f, 0.0461662039f},
-std::array<float,2>{0.36326012f, 0.465076715f},
-std::array<float,2>{0.826090634f, 0.73373872f},
-std::array<float,2>{0.190895721f, 0.906833529f},
-std::array<float,2>{0.615742981f, 0.163833499f},
-std::array<float,2>{0.0676596537f, 0.0655476302f},
-std::array<float,2>{0.740660727f, 0.867455304f},
-std::array<float,2>{0.419625401f, 0.559913099f},
-std::array<float,2>{0.903533518f, 0.328724027f},
-std::array<float,2>{0.259885103f, 0.0180715416f},
-std::array<float,2>{0.778649688f, 0.763526738f},
-std::array<float,2>{0.146006212f, 0.601350069f},
-std::array<float,2>{0.512837231f, 0.281179577f},
-std::array<float,2>{0.0305702817f, 0.399873197f},
-std::array<float,2>{0.669116855f, 0.646570444f},
-std::array<float,2>{0.439618498f, 0.944905043f},
-std::array<float,2>{0.959769964f, 0.202419117f},
-std::array<float,2>{0.390894026f, 0.346172214f},
-std::array<float,2>{0.917195916f, 0.504755259f},
-std::array<float,2>{0.119011417f, 0.820750713f},
-std::array<float,2>{0.708307683f, 0.109044462f},
-std::array<float,2>{0.245513514f, 0.141501024f},
-std::array<float,2>{0.56783402f, 0.906211257f},
-std::array<float,2>{0.31999889f, 0.714282691f},
-std::array<float,2>{0.844093382f, 0.489058018f},
-std::array<float,2>{0.425456107f, 0.110620588f},
-std::array<float,2>{0.885122359f, 0.841962934f},
-std::array<float,2>{0.0866802409f, 0.522777438f},
-std::array<float,2>{0.720891178f, 0.369309604f},
-std::array<float,2>{0.207672775f, 0.477784544f},
-std::array<float,2>{0.608676672f, 0.690085232f},
-std::array<float,2>{0.351501316f, 0.87904048f},
-std::array<float,2>{0.831244648f, 0.138831556f},
-std::array<float,2>{0.295299828f, 0.251898468f},
-std::array<float,2>{0.800970197f, 0.624979079f},
-std::array<float,2>{0.181684837f, 0.765741348f},
-std::array<float,2>{0.53126502f, 0.0070142895f},
-std::array<float,2>{0.0546315536f, 0.215015754f},
-std::array<float,2>{0.644193351f, 0.965239286f},
-std::array<float,2>{0.482305467f, 0.63795954f},
-std::array<float,2>{0.993827283f, 0.385878295f},
-std::array<float,2>{0.328998387f, 0.187474847f},
-std::array<float,2>{0.873090446f, 0.935049295f},
-std::array<float,2>{0.223025799f, 0.737326443f},
-std::array<float,2>{0.593706608f, 0.438047498f},
-std::array<float,2>{0.0988548845f, 0.325186819f},
-std::array<float,2>{0.693122983f, 0.535666585f},
-std::array<float,2>{0.378781587f, 0.856358171f},
-std::array<float,2>{0.93391192f, 0.0799500197f},
-std::array<float,2>{0.457504541f, 0.412430137f},
-std::array<float,2>{0.938504994f, 0.662446797f},
-std::array<float,2>{0.000171303996f, 0.971682727f},
-std::array<float,2>{0.687445223f, 0.249595076f},
-std::array<float,2>{0.126079276f, 0.0501017496f},
-std::array<float,2>{0.524408877f, 0.790816844f},
-std::array<float,2>{0.268471003f, 0.590323627f},
-std::array<float,2>{0.762248099f, 0.28448379f},
-std::array<float,2>{0.38976118f, 0.132434294f},
-std::array<float,2>{0.92340672f, 0.890019178f},
-std::array<float,2>{0.108996727f, 0.695766509f},
-std::array<float,2>{0.700390518f, 0.47627458f},
-std::array<float,2>{0.230895311f, 0.366879076f},
-std::array<float,2>{0.582818806f, 0.525717556f},
-std::array<float,2>{0.336169422f, 0.831504285f},
-std::array<float,2>{0.860204935f, 0.117406011f},
-std::array<float,2>{0.274867475f, 0.382510066f},
-std::array<float,2>{0.75201124f, 0.625377953f},
-std::array<float,2>{0.134164095f, 0.959999084f},
-std::array<float,2>{0.516316414f, 0.206447616f},
-std::array<float,2>{0.0115470877f, 0.0119606126f},
-std::array<float,2>{0.674629033f, 0.774623454f},
-std::array<float,2>{0.464487523f, 0.610603094f},
-std::array<float,2>{0.945660651f, 0.26096645f},
-std::array<float,2>{0.35334453f, 0.0894447565f},
-std::array<float,2>{0.839774728f, 0.844255388f},
-std::array<float,2>{0.213573545f, 0.543505132f},
-std::array<float,2>{0.596995234f, 0.316577882f},
-std::array<float,2>{0.0815406516f, 0.448810369f},
-std::array<float,2>{0.728663862f, 0.742752254f},
-std::array<float,2>{0.437330544f, 0.92388922f},
-std::array<float,2>{0.880423129f, 0.174324051f},
-std::array<float,2>{0.472162515f, 0.289726704f},
-std::array<float,2>{0.984462976f, 0.584316611f},
-std::array<float,2>{0.061278414f, 0.783476412f},
-std::array<float,2>{0.655631304f, 0.0585627519f},
-std::array<float,2>{0.177720338f, 0.240943789f},
-std::array<float,2>{0.539657533f, 0.98067981f},
-std::array<float,2>{0.282213688f, 0.667801678f},
-std::array<float,2>{0.811529279f, 0.415719688f},
-std::array<float,2>{0.448763788f, 0.0338267125f},
-std::array<float,2>{0.963627934f, 0.800373316f},
-std::array<float,2>{0.0199993495f, 0.570318818f},
-std::array<float,2>{0.657057047f, 0.310460567f},
-std::array<float,2>{0.155090228f, 0.424625009f},
-std::array<float,2>{0.505392671f, 0.676227927f},
-std::array<float,2>{0.250226825f, 0.985531688f},
-std::array<float,2>{0.768692613f, 0.219851881f},
-std::array<float,2>{0.32662192f, 0.337388813f},
-std::array<float,2>{0.857833624f, 0.549852073f},
-std::array<float,2>{0.238609031f, 0.866514027f},
-std::array<float,2>{0.573196888f, 0.0747351795f},
-std::array<float,2>{0.111150958f, 0.164108142f},
-std::array<float,2>{0.717597902f, 0.918533742f},
-std::array<float,2>{0.405641735f, 0.723731816f},
-std::array<float,2>{0.910397232f, 0.460480481f},
-std::array<float,2>{0.304487526f, 0.189077303f},
-std::array<float,2>{0.784063756f, 0.951261938f},
-std::array<float,2>{0.161680341f, 0.652032375f},
-std::array<float,2>{0.551666796f, 0.395034105f},
-std::array<float,2>{0.0382497944f, 0.27028513f},
-std::array<float,2>{0.636653066f, 0.60706383f},
-std::array<float,2>{0.493731856f, 0.753282726f},
-std::array<float,2>{0.980424047f, 0.0253489166f},
-std::array<float,2>{0.407269001f, 0.494753212f},
-std::array<float,2>{0.898411036f, 0.708465874f},
-std::array<float,2>{0.0768114626f, 0.891769409f},
-std::array<float,2>{0.74808985f, 0.155816108f},
-std::array<float,2>{0.197944626f, 0.101129159f},
-std::array<float,2>{0.621341467f, 0.818551064f},
-std::array<float,2>{0.374630541f, 0.511060417f},
-std::array<float,2>{0.818693161f, 0.356419265f},
-std::array<float,2>{0.474713504f, 0.14652507f},
-std::array<float,2>{0.991978943f, 0.900486529f},
-std::array<float,2>{0.0570073463f, 0.717990637f},
-std::array<float,2>{0.649577975f, 0.486121088f},
-std::array<float,2>{0.173854679f, 0.349334151f},
-std::array<float,2>{0.546829879f, 0.502037287f},
-std::array<float,2>{0.285853773f, 0.82560581f},
-std::array<float,2>{0.805435836f, 0.104995899f},
-std::array<float,2>{0.35598588f, 0.405873626f},
-std::array<float,2>{0.842768908f, 0.643995285f},
-std::array<float,2>{0.21795702f, 0.937993348f},
-std::array<float,2>{0.601119101f, 0.196563929f},
-std::array<float,2>{0.0841721818f, 0.0203010365f},
-std::array<float,2>{0.73422116f, 0.761650324f},
-std::array<float,2>{0.433480382f, 0.594894946f},
-std::array<float,2>{0.875054479f, 0.275120705f},
-std::array<float,2>{0.28087011f, 0.0698445812f},
-std::array<float,2>{0.754661083f, 0.872338176f},
-std::array<float,2>{0.137680203f, 0.555909038f},
-std::array<float,2>{0.521290779f, 0.334789455f},
-std::array<float,2>{0.0152587611f, 0.462412715f},
-std::array<float,2>{0.676313043f, 0.729875505f},
-std::array<float,2>{0.466936439f, 0.91337353f},
-std::array<float,2>{0.950475812f, 0.156277284f},
-std::array<float,2>{0.383647382f, 0.301074833f},
-std::array<float,2>{0.929021001f, 0.562995851f},
-std::array<float,2>{0.102147341f, 0.805661142f},
-std::array<float,2>{0.695902705f, 0.0423667058f},
-std::array<float,2>{0.22674197f, 0.23091808f},
-std::array<float,2>{0.579533696f, 0.998140991f},
-std::array<float,2>{0.341659009f, 0.685132861f},
-std::array<float,2>{0.866957903f, 0.434086621f},
-std::array<float,2>{0.411333352f, 0.0521834232f},
-std::array<float,2>{0.891330183f, 0.796598732f},
-std::array<float,2>{0.0716157183f, 0.58872366f},
-std::array<float,2>{0.745752275f, 0.288783133f},
-std::array<float,2>{0.202652588f, 0.406774163f},
-std::array<float,2>{0.620827615f, 0.657649934f},
-std::array<float,2>{0.37072289f, 0.974104106f},
-std::array<float,2>{0.814742088f, 0.243828773f},
-std::array<float,2>{0.297217995f, 0.322790176f},
-std::array<float,2>{0.787606657f, 0.53381747f},
-std::array<float,2>{0.159603715f, 0.853365064f},
-std::array<float,2>{0.547271192f, 0.0837470815f},
-std::array<float,2>{0.0334534608f, 0.182027921f},
-std::array<float,2>{0.637810946f, 0.931568742f},
-std::array<float,2>{0.496409565f, 0.741080523f},
-std::array<float,2>{0.983894527f, 0.442192644f},
-std::array<float,2>{0.323454946f, 0.211146653f},
-std::array<float,2>{0.8527354f, 0.964163959f},
-std::array<float,2>{0.237789959f, 0.633366227f},
-std::array<float,2>{0.577667415f, 0.387799174f},
-std::array<float,2>{0.113435589f, 0.255058318f},
-std::array<float,2>{0.713759482f, 0.617684603f},
-std::array<float,2>{0.402125955f, 0.771449983f},
-std::array<float,2>{0.908632636f, 0.000436249713f},
-std::array<float,2>{0.451994747f, 0.482514083f},
-std::array<float,2>{0.968311727f, 0.695091009f},
-std::array<float,2>{0.0163353402f, 0.876135945f},
-std::array<float,2>{0.662678957f, 0.136193961f},
-std::array<float,2>{0.149643302f, 0.115860604f},
-std::array<float,2>{0.500166774f, 0.836155474f},
-std::array<float,2>{0.257432073f, 0.515713453f},
-std::array<float,2>{0.770015955f, 0.372471452f},
-std::array<float,2>{0.397805244f, 0.236176342f},
-std::array<float,2>{0.918755174f, 0.979232967f},
-std::array<float,2>{0.122310087f, 0.669498861f},
-std::array<float,2>{0.705361426f, 0.420226812f},
-std::array<float,2>{0.248864412f, 0.293080837f},
-std::array<float,2>{0.562887251f, 0.580465913f},
-std::array<float,2>{0.315748364f, 0.785242617f},
-std::array<float,2>{0.850950718f, 0.0622320734f},
-std::array<float,2>{0.265031546f, 0.450908691f},
-std::array<float,2>{0.774839103f, 0.748669147f},
-std::array<float,2>{0.144196719f, 0.926481485f},
-std::array<float,2>{0.509856164f, 0.179221258f},
-std::array<float,2>{0.0234991368f, 0.0931023508f},
-std::array<float,2>{0.667716444f, 0.850022972f},
-std::array<float,2>{0.441532403f, 0.541760087f},
-std::array<float,2>{0.953182757f, 0.313362986f},
-std::array<float,2>{0.366013855f, 0.0108977156f},
-std::array<float,2>{0.822808504f, 0.779478192f},
-std::array<float,2>{0.193851858f, 0.616855621f},
-std::array<float,2>{0.613072634f, 0.261930138f},
-std::array<float,2>{0.0627612695f, 0.378815025f},
-std::array<float,2>{0.734884202f, 0.629164457f},
-std::array<float,2>{0.417778403f, 0.956626594f},
-std::array<float,2>{0.899105549f, 0.208551615f},
-std::array<float,2>{0.490706831f, 0.361003816f},
-std::array<float,2>{0.975970566f, 0.530429661f},
-std::array<float,2>{0.0451897308f, 0.834063888f},
-std::array<float,2>{0.627421498f, 0.123718932f},
-std::array<float,2>{0.166881323f, 0.127940804f},
-std::array<float,2>{0.562213838f, 0.88440448f},
-std::array<float,2>{0.308102757f, 0.703063369f},
-std::array<float,2>{0.796738803f, 0.470412374f},
-std::array<float,2>{0.453832179f, 0.0960214511f},
-std::array<float,2>{0.942600071f, 0.8152529f},
-std::array<float,2>{0.00416725408f, 0.512321055f},
-std::array<float,2>{0.682672679f, 0.355198413f},
-std::array<float,2>{0.131089181f, 0.497677743f},
-std::array<float,2>{0.529479325f, 0.703843772f},
-std::array<float,2>{0.273035884f, 0.894845843f},
-std::array<float,2>{0.761327684f, 0.149007022f},
-std::array<float,2>{0.332113087f, 0.266200244f},
-std::array<float,2>{0.868970454f, 0.605209112f},
-std::array<float,2>{0.222195968f, 0.756000459f},
-std::array<float,2>{0.588707626f, 0.029516343f},
-std::array<float,2>{0.094476454f, 0.194425091f},
-std::array<float,2>{0.689661741f, 0.945768297f},
-std::array<float,2>{0.381317586f, 0.652360559f},
-std::array<float,2>{0.929822445f, 0.394098043f},
-std::array<float,2>{0.290686876f, 0.171783313f},
-std::array<float,2>{0.799224854f, 0.91746074f},
-std::array<float,2>{0.186258927f, 0.72070837f},
-std::array<float,2>{0.538404524f, 0.456341356f},
-std::array<float,2>{0.0488833226f, 0.342909873f},
-std::array<float,2>{0.646531641f, 0.554238617f},
-std::array<float,2>{0.477250636f, 0.86297363f},
-std::array<float,2>{0.999579072f, 0.0734396353f},
-std::array<float,2>{0.428950995f, 0.427898467f},
-std::array<float,2>{0.888935208f, 0.674919963f},
-std::array<float,2>{0.0912457779f, 0.989896238f},
-std::array<float,2>{0.725123227f, 0.226091549f},
-std::array<float,2>{0.204250559f, 0.0366683044f},
-std::array<float,2>{0.604147255f, 0.804142058f},
-std::array<float,2>{0.345233411f, 0.577414572f},
-std::array<float,2>{0.834064126f, 0.307018608f},
-std::array<float,2>{0.437783837f, 0.200174168f},
-std::array<float,2>{0.958973587f, 0.94254142f},
-std::array<float,2>{0.0279763676f, 0.645445406f},
-std::array<float,2>{0.671209097f, 0.401732624f},
-std::array<float,2>{0.146627322f, 0.278999984f},
-std::array<float,2>{0.515242398f, 0.599054873f},
-std::array<float,2>{0.258255959f, 0.764951706f},
-std::array<float,2>{0.78047055f, 0.016637072f},
-std::array<float,2>{0.317087412f, 0.490469903f},
-std::array<float,2>{0.846975625f, 0.7126683f},
-std::array<float,2>{0.243100554f, 0.902660728f},
-std::array<float,2>{0.568370104f, 0.142852798f},
-std::array<float,2>{0.12101151f, 0.105953142f},
-std::array<float,2>{0.710332513f, 0.823872268f},
-std::array<float,2>{0.39296338f, 0.507081628f},
-std::array<float,2>{0.91450119f, 0.344177097f},
-std::array<float,2>{0.311223805f, 0.0436377414f},
-std::array<float,2>{0.789896846f, 0.811345518f},
-std::array<float,2>{0.168738127f, 0.568270802f},
-std::array<float,2>{0.557603598f, 0.299832284f},
-std::array<float,2>{0.0426863208f, 0.43216753f},
-std::array<float,2>{0.62973541f, 0.683244526f},
-std::array<float,2>{0.488270611f, 0.993398905f},
-std::array<float,2>{0.970818281f, 0.226976156f},
-std::array<float,2>{0.421838105f, 0.331074923f},
-std::array<float,2>{0.905839801f, 0.561855793f},
-std::array<float,2>{0.0694954395f, 0.870934367f},
-std::array<float,2>{0.738573849f, 0.0632960349f},
-std::array<float,2>{0.188840896f, 0.162051678f},
-std::array<float,2>{0.613517106f, 0.908880353f},
-std::array<float,2>{0.359774381f, 0.731963634f},
-std::array<float,2>{0.826657534f, 0.467245966f},
-std::array<float,2>{0.376098841f, 0.0814490542f},
-std::array<float,2>{0.937174678f, 0.859169066f},
-std::array<float,2>{0.100978725f, 0.53809911f},
-std::array<float,2>{0.693927765f, 0.326431364f},
-std::array<float,2>{0.225617766f, 0.441228956f},
-std::array<float,2>{0.589987814f, 0.734723747f},
-std::array<float,2>{0.330238461f, 0.937190294f},
-std::array<float,2>{0.871525347f, 0.184483886f},
-std::array<float,2>{0.267031312f, 0.283128679f},
-std::array<float,2>{0.764325202f, 0.59368521f},
-std::array<float,2>{0.12729764f, 0.792457461f},
-std::array<float,2>{0.525445163f, 0.0479689166f},
-std::array<float,2>{0.00297980523f, 0.247095495f},
-std::array<float,2>{0.684610605f, 0.970597386f},
-std::array<float,2>{0.460191339f, 0.662061691f},
-std::array<float,2>{0.939854503f, 0.41079402f},
-std::array<float,2>{0.34799698f, 0.138218299f},
-std::array<float,2>{0.829740703f, 0.881107032f},
-std::array<float,2>{0.210466355f, 0.689308763f},
-std::array<float,2>{0.607171893f, 0.47924f},
-std::array<float,2>{0.08982604f, 0.368390769f},
-std::array<float,2>{0.720535159f, 0.52128005f},
-std::array<float,2>{0.422281921f, 0.840971529f},
-std::array<float,2>{0.883553803f, 0.111868963f},
-std::array<float,2>{0.483093232f, 0.382927358f},
-std::array<float,2>{0.995453596f, 0.63980335f},
-std::array<float,2>{0.0526913069f, 0.968177795f},
-std::array<float,2>{0.641513884f, 0.217384666f},
-std::array<float,2>{0.179759845f, 0.00498071266f},
-std::array<float,2>{0.533957124f, 0.768216848f},
-std::array<float,2>{0.29458496f, 0.621855438f},
-std::array<float,2>{0.802958548f, 0.253065944f},
-std::array<float,2>{0.435398102f, 0.173118576f},
-std::array<float,2>{0.881089032f, 0.923260152f},
-std::array<float,2>{0.0799554884f, 0.744658589f},
-std::array<float,2>{0.728236318f, 0.446119815f},
-std::array<float,2>{0.211414427f, 0.320115119f},
-std::array<float,2>{0.595345318f, 0.546126962f},
-std::array<float,2>{0.355323255f, 0.846507192f},
-std::array<float,2>{0.837683916f, 0.0868491232f},
-std::array<float,2>{0.284884572f, 0.417873353f},
-std::array<float,2>{0.808902681f, 0.665117145f},
-std::array<float,2>{0.179271162f, 0.984042585f},
-std::array<float,2>{0.541364491f, 0.238348663f},
-std::array<float,2>{0.0592814609f, 0.0551910177f},
-std::array<float,2>{0.654254794f, 0.781868815f},
-std::array<float,2>{0.469463676f, 0.582249522f},
-std::array<float,2>{0.987850845f, 0.291981131f},
-std::array<float,2>{0.339080423f, 0.120636612f},
-std::array<float,2>{0.862020016f, 0.829977334f},
-std::array<float,2>{0.232846394f, 0.524443865f},
-std::array<float,2>{0.585736692f, 0.363999009f},
-std::array<float,2>{0.105644621f, 0.473353744f},
-std::array<float,2>{0.701230526f, 0.697435558f},
-std::array<float,2>{0.387888193f, 0.886911273f},
-std::array<float,2>{0.924969375f, 0.130148545f},
-std::array<float,2>{0.461725712f, 0.258934557f},
-std::array<float,2>{0.948613703f, 0.612185359f},
-std::array<float,2>{0.00802397076f, 0.776048422f},
-std::array<float,2>{0.673686028f, 0.0142811313f},
-std::array<float,2>{0.134807304f, 0.203905195f},
-std::array<float,2>{0.518814921f, 0.957218587f},
-std::array<float,2>{0.275705129f, 0.62880367f},
-std::array<float,2>{0.751388609f, 0.379256397f},
-std::array<float,2>{0.494293481f, 0.0260226075f},
-std::array<float,2>{0.976941228f, 0.750283778f},
-std::array<float,2>{0.0352391675f, 0.609193563f},
-std::array<float,2>{0.633544683f, 0.272524357f},
-std::array<float,2>{0.163426161f, 0.397291243f},
-std::array<float,2>{0.554638028f, 0.650151789f},
-std::array<float,2>{0.301493853f, 0.949904501f},
-std::array<float,2>{0.781288087f, 0.189963311f},
-std::array<float,2>{0.372496724f, 0.357542247f},
-std::array<float,2>{0.817211568f, 0.508781016f},
-std::array<float,2>{0.196823254f, 0.818046212f},
-std::array<float,2>{0.623732448f, 0.0988987014f},
-std::array<float,2>{0.0750700086f, 0.153557464f},
-std::array<float,2>{0.747464597f, 0.892583668f},
-std::array<float,2>{0.410134375f, 0.709446311f},
-std::array<float,2>{0.896368802f, 0.493430823f},
-std::array<float,2>{0.252929956f, 0.221876293f},
-std::array<float,2>{0.766321361f, 0.987027228f},
-std::array<float,2>{0.152859151f, 0.677857637f},
-std::array<float,2>{0.507655084f, 0.423144221f},
-std::array<float,2>{0.0215668101f, 0.311990291f},
-std::array<float,2>{0.659565628f, 0.573162317f},
-std::array<float,2>{0.445685089f, 0.798342109f},
-std::array<float,2>{0.961428225f, 0.0320490338f},
-std::array<float,2>{0.403540134f, 0.458286405f},
-std::array<float,2>{0.913955152f, 0.725333035f},
-std::array<float,2>{0.111872703f, 0.919976711f},
-std::array<float,2>{0.716089487f, 0.167229801f},
-std::array<float,2>{0.241422012f, 0.0770673379f},
-std::array<float,2>{0.572001755f, 0.863353789f},
-std::array<float,2>{0.325790167f, 0.547522962f},
-std::array<float,2>{0.856433451f, 0.339420348f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.702011704f, 0.998591721f},
-std::array<float,2>{0.398590326f, 0.449853241f},
-std::array<float,2>{0.139047459f, 0.582327366f},
-std::array<float,2>{0.94201231f, 0.107506685f},
-std::array<float,2>{0.795156956f, 0.64641422f},
-std::array<float,2>{0.0057426868f, 0.167584911f},
-std::array<float,2>{0.371232539f, 0.793034017f},
-std::array<float,2>{0.534933388f, 0.296175718f},
-std::array<float,2>{0.577679455f, 0.511713505f},
-std::array<float,2>{0.297853172f, 0.0545654632f},
-std::array<float,2>{0.071255818f, 0.934170187f},
-std::array<float,2>{0.820836961f, 0.40206486f},
-std::array<float,2>{0.907181442f, 0.823646069f},
-std::array<float,2>{0.229355171f, 0.368013024f},
-std::array<float,2>{0.496748924f, 0.718069494f},
-std::array<float,2>{0.656789184f, 0.219954252f},
-std::array<float,2>{0.509067118f, 0.757788777f},
-std::array<float,2>{0.331866026f, 0.265936971f},
-std::array<float,2>{0.0624519847f, 0.678086817f},
-std::array<float,2>{0.766996682f, 0.138874605f},
-std::array<float,2>{0.970896542f, 0.594148636f},
-std::array<float,2>{0.187142506f, 0.0741922557f},
-std::array<float,2>{0.418574244f, 0.938654065f},
-std::array<float,2>{0.739295065f, 0.494125575f},
-std::array<float,2>{0.647986531f, 0.741556644f},
-std::array<float,2>{0.468176305f, 0.202799603f},
-std::array<float,2>{0.203856498f, 0.852977574f},
-std::array<float,2>{0.886829853f, 0.338199168f},
-std::array<float,2>{0.850391984f, 0.899976552f},
-std::array<float,2>{0.11898227f, 0.425875038f},
-std::array<float,2>{0.270795166f, 0.550829053f},
-std::array<float,2>{0.621794343f, 0.0156898424f},
-std::array<float,2>{0.595055223f, 0.915927649f},
-std::array<float,2>{0.253823936f, 0.385701984f},
-std::array<float,2>{0.101177193f, 0.527715623f},
-std::array<float,2>{0.864178598f, 0.0372615866f},
-std::array<float,2>{0.903387785f, 0.693190217f},
-std::array<float,2>{0.189676598f, 0.24424696f},
-std::array<float,2>{0.451534212f, 0.838493824f},
-std::array<float,2>{0.626528919f, 0.353905797f},
-std::array<float,2>{0.731165886f, 0.562572956f},
-std::array<float,2>{0.422236115f, 0.120082907f},
-std::array<float,2>{0.163589299f, 0.970328569f},
-std::array<float,2>{0.996952415f, 0.454935163f},
-std::array<float,2>{0.754763603f, 0.807992995f},
-std::array<float,2>{0.0404013731f, 0.301930845f},
-std::array<float,2>{0.317897737f, 0.639256477f},
-std::array<float,2>{0.518456101f, 0.177210182f},
-std::array<float,2>{0.681836903f, 0.874213398f},
-std::array<float,2>{0.475281507f, 0.315446466f},
-std::array<float,2>{0.238098696f, 0.733369231f},
-std::array<float,2>{0.929156423f, 0.206352979f},
-std::array<float,2>{0.843346059f, 0.532933474f},
-std::array<float,2>{0.092837289f, 0.00193156325f},
-std::array<float,2>{0.286459178f, 0.890553474f},
-std::array<float,2>{0.580002308f, 0.419134587f},
-std::array<float,2>{0.559285641f, 0.658859074f},
-std::array<float,2>{0.347180992f, 0.150376529f},
-std::array<float,2>{0.0203200653f, 0.777050912f},
-std::array<float,2>{0.798308134f, 0.254619241f},
-std::array<float,2>{0.964797914f, 0.968025744f},
-std::array<float,2>{0.145856842f, 0.479478508f},
-std::array<float,2>{0.379963547f, 0.618838608f},
-std::array<float,2>{0.703429818f, 0.0834848359f},
-std::array<float,2>{0.636260808f, 0.877335429f},
-std::array<float,2>{0.43866995f, 0.407411933f},
-std::array<float,2>{0.20126155f, 0.540056586f},
-std::array<float,2>{0.894564927f, 0.011737491f},
-std::array<float,2>{0.868486285f, 0.724153817f},
-std::array<float,2>{0.107495792f, 0.212350667f},
-std::array<float,2>{0.260470599f, 0.863244772f},
-std::array<float,2>{0.605640054f, 0.324002594f},
-std::array<float,2>{0.52782011f, 0.614994645f},
-std::array<float,2>{0.326620907f, 0.0918743536f},
-std::array<float,2>{0.0321051329f, 0.957115889f},
-std::array<float,2>{0.759971201f, 0.476213574f},
-std::array<float,2>{0.989491642f, 0.771607637f},
-std::array<float,2>{0.166952729f, 0.264384419f},
-std::array<float,2>{0.436697453f, 0.664260149f},
-std::array<float,2>{0.722033083f, 0.141797692f},
-std::array<float,2>{0.588069797f, 0.834185183f},
-std::array<float,2>{0.293612123f, 0.3480528f},
-std::array<float,2>{0.0801931545f, 0.701853812f},
-std::array<float,2>{0.828809798f, 0.240000129f},
-std::array<float,2>{0.937031925f, 0.521760583f},
-std::array<float,2>{0.244942516f, 0.041435089f},
-std::array<float,2>{0.482743442f, 0.913561225f},
-std::array<float,2>{0.677622974f, 0.37819019f},
-std::array<float,2>{0.712585568f, 0.628040314f},
-std::array<float,2>{0.386486709f, 0.184818581f},
-std::array<float,2>{0.150906548f, 0.799911559f},
-std::array<float,2>{0.960928619f, 0.308265328f},
-std::array<float,2>{0.812153935f, 0.982606232f},
-std::array<float,2>{0.0249033216f, 0.461401939f},
-std::array<float,2>{0.358228594f, 0.572404444f},
-std::array<float,2>{0.550402701f, 0.116438307f},
-std::array<float,2>{0.541897237f, 0.948953211f},
-std::array<float,2>{0.36140275f, 0.489399403f},
-std::array<float,2>{0.0130455997f, 0.606358528f},
-std::array<float,2>{0.786585033f, 0.066807352f},
-std::array<float,2>{0.948367834f, 0.685692132f},
-std::array<float,2>{0.125212535f, 0.126552999f},
-std::array<float,2>{0.393845379f, 0.763038814f},
-std::array<float,2>{0.695113182f, 0.276100457f},
-std::array<float,2>{0.671681941f, 0.558048308f},
-std::array<float,2>{0.486734569f, 0.0269543268f},
-std::array<float,2>{0.222304344f, 0.893004715f},
-std::array<float,2>{0.921093762f, 0.433191359f},
-std::array<float,2>{0.818202913f, 0.848356485f},
-std::array<float,2>{0.0670658126f, 0.330142945f},
-std::array<float,2>{0.304995924f, 0.744665623f},
-std::array<float,2>{0.56607151f, 0.192766041f},
-std::array<float,2>{0.743958294f, 0.783316493f},
-std::array<float,2>{0.408890486f, 0.282081097f},
-std::array<float,2>{0.179414794f, 0.653924048f},
-std::array<float,2>{0.980414391f, 0.16041036f},
-std::array<float,2>{0.779996932f, 0.587425768f},
-std::array<float,2>{0.0542861f, 0.0949551836f},
-std::array<float,2>{0.336644918f, 0.986871421f},
-std::array<float,2>{0.503197014f, 0.441308677f},
-std::array<float,2>{0.609466016f, 0.705514908f},
-std::array<float,2>{0.274291068f, 0.231978208f},
-std::array<float,2>{0.112806514f, 0.816899896f},
-std::array<float,2>{0.857083917f, 0.361530811f},
-std::array<float,2>{0.876248956f, 0.928237379f},
-std::array<float,2>{0.210978195f, 0.395938188f},
-std::array<float,2>{0.458048046f, 0.500097454f},
-std::array<float,2>{0.655431867f, 0.0548691116f},
-std::array<float,2>{0.660561919f, 0.954828084f},
-std::array<float,2>{0.494412959f, 0.472441614f},
-std::array<float,2>{0.233313099f, 0.61169678f},
-std::array<float,2>{0.910972893f, 0.0860256776f},
-std::array<float,2>{0.826700985f, 0.668597698f},
-std::array<float,2>{0.0771031529f, 0.14557232f},
-std::array<float,2>{0.303137571f, 0.767167509f},
-std::array<float,2>{0.573714614f, 0.260071993f},
-std::array<float,2>{0.535317361f, 0.546313405f},
-std::array<float,2>{0.370485842f, 0.0113899633f},
-std::array<float,2>{0.00106017734f, 0.880738974f},
-std::array<float,2>{0.789953649f, 0.413564175f},
-std::array<float,2>{0.938529491f, 0.864990234f},
-std::array<float,2>{0.135656998f, 0.327413201f},
-std::array<float,2>{0.402590513f, 0.721941352f},
-std::array<float,2>{0.695314288f, 0.215468183f},
-std::array<float,2>{0.620037615f, 0.80450052f},
-std::array<float,2>{0.26860708f, 0.309371501f},
-std::array<float,2>{0.122769579f, 0.631987035f},
-std::array<float,2>{0.844921649f, 0.182551533f},
-std::array<float,2>{0.882913053f, 0.576269627f},
-std::array<float,2>{0.208969057f, 0.109914705f},
-std::array<float,2>{0.46252355f, 0.977402091f},
-std::array<float,2>{0.641432703f, 0.465669215f},
-std::array<float,2>{0.736046672f, 0.698573053f},
-std::array<float,2>{0.416146427f, 0.235247627f},
-std::array<float,2>{0.179800093f, 0.830124199f},
-std::array<float,2>{0.975566089f, 0.34554109f},
-std::array<float,2>{0.772407591f, 0.9065696f},
-std::array<float,2>{0.0559321642f, 0.380763918f},
-std::array<float,2>{0.335154295f, 0.519390285f},
-std::array<float,2>{0.512083113f, 0.0467745066f},
-std::array<float,2>{0.519813478f, 0.89554286f},
-std::array<float,2>{0.315011799f, 0.43527326f},
-std::array<float,2>{0.045568984f, 0.559315443f},
-std::array<float,2>{0.752081096f, 0.0273526441f},
-std::array<float,2>{0.994711339f, 0.747340739f},
-std::array<float,2>{0.158564582f, 0.190617755f},
-std::array<float,2>{0.428129137f, 0.844061732f},
-std::array<float,2>{0.729531586f, 0.332563013f},
-std::array<float,2>{0.631817698f, 0.604964972f},
-std::array<float,2>{0.445956737f, 0.0639596656f},
-std::array<float,2>{0.195092395f, 0.951621354f},
-std::array<float,2>{0.901705146f, 0.486245811f},
-std::array<float,2>{0.862631679f, 0.759266853f},
-std::array<float,2>{0.0964195505f, 0.281086504f},
-std::array<float,2>{0.255165577f, 0.682515204f},
-std::array<float,2>{0.597699285f, 0.129562885f},
-std::array<float,2>{0.707146823f, 0.813727915f},
-std::array<float,2>{0.375583977f, 0.364441246f},
-std::array<float,2>{0.142572537f, 0.709792972f},
-std::array<float,2>{0.968636096f, 0.230029032f},
-std::array<float,2>{0.801445305f, 0.504487932f},
-std::array<float,2>{0.0183762051f, 0.0620260164f},
-std::array<float,2>{0.351191133f, 0.922516465f},
-std::array<float,2>{0.557362854f, 0.393729448f},
-std::array<float,2>{0.583683729f, 0.651917636f},
-std::array<float,2>{0.284170359f, 0.158032253f},
-std::array<float,2>{0.0865094438f, 0.786817372f},
-std::array<float,2>{0.836757839f, 0.287858576f},
-std::array<float,2>{0.923977435f, 0.988960028f},
-std::array<float,2>{0.240998909f, 0.443630457f},
-std::array<float,2>{0.47161907f, 0.590006292f},
-std::array<float,2>{0.686307251f, 0.0985098332f},
-std::array<float,2>{0.724278212f, 0.931372046f},
-std::array<float,2>{0.432090104f, 0.405264854f},
-std::array<float,2>{0.170005664f, 0.513333023f},
-std::array<float,2>{0.988132119f, 0.0490163751f},
-std::array<float,2>{0.764157534f, 0.714493036f},
-std::array<float,2>{0.0374138653f, 0.225406587f},
-std::array<float,2>{0.320983618f, 0.827563703f},
-std::array<float,2>{0.525684595f, 0.373133212f},
-std::array<float,2>{0.604875326f, 0.581142008f},
-std::array<float,2>{0.26460883f, 0.101971522f},
-std::array<float,2>{0.104643129f, 0.992725074f},
-std::array<float,2>{0.874930143f, 0.44619295f},
-std::array<float,2>{0.890891314f, 0.790811241f},
-std::array<float,2>{0.198580131f, 0.291479766f},
-std::array<float,2>{0.443907142f, 0.641324639f},
-std::array<float,2>{0.638752699f, 0.170567468f},
-std::array<float,2>{0.550790012f, 0.855540395f},
-std::array<float,2>{0.353459567f, 0.340152681f},
-std::array<float,2>{0.0293184854f, 0.736150384f},
-std::array<float,2>{0.80583179f, 0.198073164f},
-std::array<float,2>{0.955046713f, 0.549189985f},
-std::array<float,2>{0.153873906f, 0.0222470798f},
-std::array<float,2>{0.388154268f, 0.902943909f},
-std::array<float,2>{0.716046631f, 0.423008293f},
-std::array<float,2>{0.674509227f, 0.675040901f},
-std::array<float,2>{0.477748185f, 0.134772524f},
-std::array<float,2>{0.247050732f, 0.750223756f},
-std::array<float,2>{0.930556178f, 0.272750825f},
-std::array<float,2>{0.833489537f, 0.941495955f},
-std::array<float,2>{0.0848792717f, 0.498786092f},
-std::array<float,2>{0.291224241f, 0.598121226f},
-std::array<float,2>{0.59227252f, 0.077310726f},
-std::array<float,2>{0.567855537f, 0.976240754f},
-std::array<float,2>{0.309331506f, 0.457389235f},
-std::array<float,2>{0.064834699f, 0.569610715f},
-std::array<float,2>{0.813479125f, 0.122241527f},
-std::array<float,2>{0.916997969f, 0.635909557f},
-std::array<float,2>{0.226095751f, 0.175635949f},
-std::array<float,2>{0.492083907f, 0.810111403f},
-std::array<float,2>{0.666122437f, 0.297055304f},
-std::array<float,2>{0.688032746f, 0.527209401f},
-std::array<float,2>{0.396447957f, 0.033822149f},
-std::array<float,2>{0.132762313f, 0.918959439f},
-std::array<float,2>{0.951126635f, 0.387610734f},
-std::array<float,2>{0.783054948f, 0.840715706f},
-std::array<float,2>{0.0092017781f, 0.359355688f},
-std::array<float,2>{0.365867704f, 0.687848508f},
-std::array<float,2>{0.544831693f, 0.247142464f},
-std::array<float,2>{0.651952505f, 0.780702293f},
-std::array<float,2>{0.45452714f, 0.253164321f},
-std::array<float,2>{0.21495679f, 0.663309932f},
-std::array<float,2>{0.881021559f, 0.155528247f},
-std::array<float,2>{0.853172421f, 0.621117175f},
-std::array<float,2>{0.114120655f, 0.0800333545f},
-std::array<float,2>{0.2776241f, 0.964652896f},
-std::array<float,2>{0.615344703f, 0.483379185f},
-std::array<float,2>{0.506156623f, 0.730248034f},
-std::array<float,2>{0.339938283f, 0.20936653f},
-std::array<float,2>{0.0483167619f, 0.867245853f},
-std::array<float,2>{0.774020553f, 0.319170058f},
-std::array<float,2>{0.981463253f, 0.885146022f},
-std::array<float,2>{0.172491223f, 0.417335272f},
-std::array<float,2>{0.410842866f, 0.537311435f},
-std::array<float,2>{0.749285519f, 0.00568580767f},
-std::array<float,2>{0.740886986f, 0.94005847f},
-std::array<float,2>{0.42039144f, 0.494638771f},
-std::array<float,2>{0.184752107f, 0.596170247f},
-std::array<float,2>{0.969244719f, 0.071424447f},
-std::array<float,2>{0.767969489f, 0.677618444f},
-std::array<float,2>{0.0586884171f, 0.137452796f},
-std::array<float,2>{0.328377366f, 0.754185796f},
-std::array<float,2>{0.511200607f, 0.269223362f},
-std::array<float,2>{0.623080671f, 0.553815365f},
-std::array<float,2>{0.271826148f, 0.018263571f},
-std::array<float,2>{0.119725049f, 0.901136458f},
-std::array<float,2>{0.848236918f, 0.42937699f},
-std::array<float,2>{0.889284432f, 0.854742587f},
-std::array<float,2>{0.205662876f, 0.336347729f},
-std::array<float,2>{0.465749145f, 0.738795757f},
-std::array<float,2>{0.64488554f, 0.20052129f},
-std::array<float,2>{0.532648504f, 0.795568645f},
-std::array<float,2>{0.373102307f, 0.294356108f},
-std::array<float,2>{0.00592490099f, 0.647790551f},
-std::array<float,2>{0.794281363f, 0.165751785f},
-std::array<float,2>{0.944079101f, 0.584767997f},
-std::array<float,2>{0.137598842f, 0.106686123f},
-std::array<float,2>{0.400739282f, 0.997938275f},
-std::array<float,2>{0.699862003f, 0.452683449f},
-std::array<float,2>{0.658448577f, 0.716745257f},
-std::array<float,2>{0.499517113f, 0.221943334f},
-std::array<float,2>{0.228511527f, 0.821161807f},
-std::array<float,2>{0.908509552f, 0.369776845f},
-std::array<float,2>{0.822858691f, 0.93626833f},
-std::array<float,2>{0.0730299875f, 0.398854673f},
-std::array<float,2>{0.298920602f, 0.508336365f},
-std::array<float,2>{0.575672507f, 0.0521608852f},
-std::array<float,2>{0.580548942f, 0.888658702f},
-std::array<float,2>{0.287873268f, 0.421267956f},
-std::array<float,2>{0.0916169733f, 0.533392131f},
-std::array<float,2>{0.840230525f, 0.00368590024f},
-std::array<float,2>{0.927621782f, 0.73180443f},
-std::array<float,2>{0.235653058f, 0.204743236f},
-std::array<float,2>{0.474575222f, 0.871935129f},
-std::array<float,2>{0.681000352f, 0.313249946f},
-std::array<float,2>{0.705872655f, 0.619879484f},
-std::array<float,2>{0.381206185f, 0.0842385888f},
-std::array<float,2>{0.146999687f, 0.966444671f},
-std::array<float,2>{0.962636888f, 0.477758408f},
-std::array<float,2>{0.799563646f, 0.775127411f},
-std::array<float,2>{0.0226566717f, 0.257213861f},
-std::array<float,2>{0.344088525f, 0.657343268f},
-std::array<float,2>{0.561884582f, 0.151342347f},
-std::array<float,2>{0.628883064f, 0.836847484f},
-std::array<float,2>{0.450865746f, 0.353233546f},
-std::array<float,2>{0.189049244f, 0.694996536f},
-std::array<float,2>{0.904942334f, 0.24363254f},
-std::array<float,2>{0.867002785f, 0.529945195f},
-std::array<float,2>{0.0978060588f, 0.0367005356f},
-std::array<float,2>{0.251291573f, 0.917893112f},
-std::array<float,2>{0.596879184f, 0.383775651f},
-std::array<float,2>{0.516385019f, 0.637275755f},
-std::array<float,2>{0.320272475f, 0.179381534f},
-std::array<float,2>{0.0423150621f, 0.805297732f},
-std::array<float,2>{0.756201923f, 0.303989351f},
-std::array<float,2>{0.999985039f, 0.971067905f},
-std::array<float,2>{0.160635129f, 0.456977099f},
-std::array<float,2>{0.424091071f, 0.565316081f},
-std::array<float,2>{0.734073877f, 0.119044743f},
-std::array<float,2>{0.67783922f, 0.910271585f},
-std::array<float,2>{0.480700105f, 0.376097411f},
-std::array<float,2>{0.242488936f, 0.519996345f},
-std::array<float,2>{0.934704483f, 0.0401900522f},
-std::array<float,2>{0.831214309f, 0.700925946f},
-std::array<float,2>{0.0793820992f, 0.24059172f},
-std::array<float,2>{0.295530021f, 0.833130658f},
-std::array<float,2>{0.586255491f, 0.349626243f},
-std::array<float,2>{0.548688948f, 0.57183826f},
-std::array<float,2>{0.356984824f, 0.11369551f},
-std::array<float,2>{0.0257733837f, 0.980847836f},
-std::array<float,2>{0.80864054f, 0.46382165f},
-std::array<float,2>{0.9587062f, 0.797079265f},
-std::array<float,2>{0.149830595f, 0.305477738f},
-std::array<float,2>{0.383036733f, 0.625483871f},
-std::array<float,2>{0.713253915f, 0.186297476f},
-std::array<float,2>{0.607976019f, 0.860149741f},
-std::array<float,2>{0.258169681f, 0.32120052f},
-std::array<float,2>{0.107226722f, 0.726347446f},
-std::array<float,2>{0.869498372f, 0.21427381f},
-std::array<float,2>{0.897003233f, 0.542050183f},
-std::array<float,2>{0.20017086f, 0.0149035733f},
-std::array<float,2>{0.440036088f, 0.876647234f},
-std::array<float,2>{0.63423413f, 0.408459723f},
-std::array<float,2>{0.718809485f, 0.66727227f},
-std::array<float,2>{0.435423821f, 0.143810555f},
-std::array<float,2>{0.16560182f, 0.770347357f},
-std::array<float,2>{0.991584361f, 0.26362142f},
-std::array<float,2>{0.759482205f, 0.959060311f},
-std::array<float,2>{0.0336731486f, 0.473359048f},
-std::array<float,2>{0.324399829f, 0.615736902f},
-std::array<float,2>{0.530869722f, 0.0905119926f},
-std::array<float,2>{0.501666784f, 0.984399378f},
-std::array<float,2>{0.337963402f, 0.438580632f},
-std::array<float,2>{0.0525840446f, 0.588846147f},
-std::array<float,2>{0.779012322f, 0.0973272696f},
-std::array<float,2>{0.977380693f, 0.654446244f},
-std::array<float,2>{0.176582187f, 0.163145676f},
-std::array<float,2>{0.406733721f, 0.78218925f},
-std::array<float,2>{0.744517744f, 0.283827692f},
-std::array<float,2>{0.653054535f, 0.503646255f},
-std::array<float,2>{0.460048199f, 0.0575915575f},
-std::array<float,2>{0.214104608f, 0.927675605f},
-std::array<float,2>{0.878558159f, 0.397740871f},
-std::array<float,2>{0.859292209f, 0.818697333f},
-std::array<float,2>{0.111289665f, 0.360875875f},
-std::array<float,2>{0.276639074f, 0.703130126f},
-std::array<float,2>{0.612889946f, 0.233280718f},
-std::array<float,2>{0.691705406f, 0.763732731f},
-std::array<float,2>{0.391634315f, 0.274529755f},
-std::array<float,2>{0.128397554f, 0.684141934f},
-std::array<float,2>{0.947178602f, 0.12712431f},
-std::array<float,2>{0.788763642f, 0.608018935f},
-std::array<float,2>{0.015369948f, 0.0692067221f},
-std::array<float,2>{0.359656155f, 0.946179152f},
-std::array<float,2>{0.540717721f, 0.490663201f},
-std::array<float,2>{0.562649727f, 0.743610501f},
-std::array<float,2>{0.308041722f, 0.195258826f},
-std::array<float,2>{0.0688583776f, 0.850864828f},
-std::array<float,2>{0.818830848f, 0.328226835f},
-std::array<float,2>{0.919239342f, 0.890963376f},
-std::array<float,2>{0.220400542f, 0.430972576f},
-std::array<float,2>{0.484929442f, 0.554900289f},
-std::array<float,2>{0.668434441f, 0.0239889435f},
-std::array<float,2>{0.642905533f, 0.97960037f},
-std::array<float,2>{0.464006186f, 0.467870623f},
-std::array<float,2>{0.209258452f, 0.574917138f},
-std::array<float,2>{0.885791183f, 0.111890793f},
-std::array<float,2>{0.846104562f, 0.629402995f},
-std::array<float,2>{0.124118686f, 0.180692121f},
-std::array<float,2>{0.265735567f, 0.801026165f},
-std::array<float,2>{0.618129015f, 0.311267674f},
-std::array<float,2>{0.514753044f, 0.517538011f},
-std::array<float,2>{0.333426744f, 0.0433711484f},
-std::array<float,2>{0.0582320429f, 0.909470797f},
-std::array<float,2>{0.770981312f, 0.382175505f},
-std::array<float,2>{0.973209739f, 0.82911998f},
-std::array<float,2>{0.18346414f, 0.347405523f},
-std::array<float,2>{0.415213615f, 0.696803868f},
-std::array<float,2>{0.736853063f, 0.237837598f},
-std::array<float,2>{0.570523024f, 0.76854068f},
-std::array<float,2>{0.301244587f, 0.258733988f},
-std::array<float,2>{0.0753343478f, 0.671573222f},
-std::array<float,2>{0.825428963f, 0.146574929f},
-std::array<float,2>{0.913590252f, 0.610363603f},
-std::array<float,2>{0.230857834f, 0.0894286111f},
-std::array<float,2>{0.493272483f, 0.9558689f},
-std::array<float,2>{0.662835956f, 0.469851106f},
-std::array<float,2>{0.697506666f, 0.719263136f},
-std::array<float,2>{0.405237913f, 0.217281282f},
-std::array<float,2>{0.13459821f, 0.866515696f},
-std::array<float,2>{0.940646529f, 0.325882584f},
-std::array<float,2>{0.791732728f, 0.88237977f},
-std::array<float,2>{0.00376699283f, 0.411056101f},
-std::array<float,2>{0.367818207f, 0.544157386f},
-std::array<float,2>{0.537804306f, 0.0085369423f},
-std::array<float,2>{0.556015968f, 0.925415754f},
-std::array<float,2>{0.349484265f, 0.392257065f},
-std::array<float,2>{0.0160215814f, 0.507588744f},
-std::array<float,2>{0.80304718f, 0.0602112822f},
-std::array<float,2>{0.966561198f, 0.708062112f},
-std::array<float,2>{0.142755091f, 0.228141442f},
-std::array<float,2>{0.378205776f, 0.816403925f},
-std::array<float,2>{0.710198045f, 0.365708262f},
-std::array<float,2>{0.684604406f, 0.592274249f},
-std::array<float,2>{0.468855828f, 0.0999999046f},
-std::array<float,2>{0.239919618f, 0.990304649f},
-std::array<float,2>{0.92356509f, 0.442074299f},
-std::array<float,2>{0.839493632f, 0.787521243f},
-std::array<float,2>{0.0882473364f, 0.28697446f},
-std::array<float,2>{0.281635225f, 0.649047256f},
-std::array<float,2>{0.584729552f, 0.159143552f},
-std::array<float,2>{0.728486598f, 0.846195877f},
-std::array<float,2>{0.426999241f, 0.334432036f},
-std::array<float,2>{0.157475576f, 0.749064505f},
-std::array<float,2>{0.993010879f, 0.188204199f},
-std::array<float,2>{0.750098109f, 0.561788499f},
-std::array<float,2>{0.0438478775f, 0.029748952f},
-std::array<float,2>{0.312677264f, 0.896851122f},
-std::array<float,2>{0.523181677f, 0.436405599f},
-std::array<float,2>{0.599724829f, 0.680075288f},
-std::array<float,2>{0.25622806f, 0.131211236f},
-std::array<float,2>{0.0946123302f, 0.760786533f},
-std::array<float,2>{0.860372961f, 0.27875641f},
-std::array<float,2>{0.899562776f, 0.949362218f},
-std::array<float,2>{0.192447111f, 0.48749125f},
-std::array<float,2>{0.449060738f, 0.601744473f},
-std::array<float,2>{0.629761875f, 0.0662483051f},
-std::array<float,2>{0.718049049f, 0.905340791f},
-std::array<float,2>{0.390335202f, 0.424317807f},
-std::array<float,2>{0.156093389f, 0.546988428f},
-std::array<float,2>{0.956954181f, 0.019686399f},
-std::array<float,2>{0.806809962f, 0.736766636f},
-std::array<float,2>{0.0273964778f, 0.196983278f},
-std::array<float,2>{0.354555041f, 0.858057916f},
-std::array<float,2>{0.554642022f, 0.34304738f},
-std::array<float,2>{0.591177285f, 0.600160599f},
-std::array<float,2>{0.290639758f, 0.0743436366f},
-std::array<float,2>{0.0825307742f, 0.944757819f},
-std::array<float,2>{0.834690034f, 0.497145265f},
-std::array<float,2>{0.932836711f, 0.753531873f},
-std::array<float,2>{0.249379724f, 0.271440923f},
-std::array<float,2>{0.479856849f, 0.673786223f},
-std::array<float,2>{0.673452497f, 0.134464532f},
-std::array<float,2>{0.5246346f, 0.826137424f},
-std::array<float,2>{0.322376668f, 0.37268427f},
-std::array<float,2>{0.035425026f, 0.71139431f},
-std::array<float,2>{0.762461424f, 0.223966643f},
-std::array<float,2>{0.984677672f, 0.515610039f},
-std::array<float,2>{0.168389395f, 0.0479608215f},
-std::array<float,2>{0.430407435f, 0.931868434f},
-std::array<float,2>{0.725137651f, 0.402792633f},
-std::array<float,2>{0.636880457f, 0.6438573f},
-std::array<float,2>{0.442060411f, 0.169054747f},
-std::array<float,2>{0.196436286f, 0.791184127f},
-std::array<float,2>{0.8935045f, 0.290179849f},
-std::array<float,2>{0.873046398f, 0.994556785f},
-std::array<float,2>{0.103154399f, 0.448768288f},
-std::array<float,2>{0.262652457f, 0.578494489f},
-std::array<float,2>{0.602386773f, 0.105458684f},
-std::array<float,2>{0.614987552f, 0.961429179f},
-std::array<float,2>{0.28058672f, 0.481657296f},
-std::array<float,2>{0.115268871f, 0.623598754f},
-std::array<float,2>{0.854395092f, 0.081280157f},
-std::array<float,2>{0.880033791f, 0.662052572f},
-std::array<float,2>{0.217921227f, 0.153084636f},
-std::array<float,2>{0.455974489f, 0.779039919f},
-std::array<float,2>{0.650059342f, 0.250748545f},
-std::array<float,2>{0.747815669f, 0.535583675f},
-std::array<float,2>{0.413630903f, 0.00685272459f},
-std::array<float,2>{0.174670696f, 0.884182036f},
-std::array<float,2>{0.983187139f, 0.414261997f},
-std::array<float,2>{0.777340412f, 0.869562805f},
-std::array<float,2>{0.050563924f, 0.317412168f},
-std::array<float,2>{0.343488097f, 0.727587819f},
-std::array<float,2>{0.505530775f, 0.208873361f},
-std::array<float,2>{0.664081931f, 0.812241256f},
-std::array<float,2>{0.488793552f, 0.299258202f},
-std::array<float,2>{0.223110169f, 0.633374631f},
-std::array<float,2>{0.915849447f, 0.173447043f},
-std::array<float,2>{0.816024363f, 0.566407561f},
-std::array<float,2>{0.0634200498f, 0.123363756f},
-std::array<float,2>{0.311085135f, 0.972716868f},
-std::array<float,2>{0.568796158f, 0.460559189f},
-std::array<float,2>{0.545468032f, 0.690928102f},
-std::array<float,2>{0.363913149f, 0.248525158f},
-std::array<float,2>{0.00977494754f, 0.843540728f},
-std::array<float,2>{0.783537924f, 0.356769562f},
-std::array<float,2>{0.952513874f, 0.920647323f},
-std::array<float,2>{0.129167616f, 0.389837325f},
-std::array<float,2>{0.397354454f, 0.524420023f},
-std::array<float,2>{0.691043973f, 0.0326657854f},
-std::array<float,2>{0.732666314f, 0.969438314f},
-std::array<float,2>{0.425777882f, 0.453155309f},
-std::array<float,2>{0.161521062f, 0.564168274f},
-std::array<float,2>{0.998777151f, 0.120808102f},
-std::array<float,2>{0.757101774f, 0.640219331f},
-std::array<float,2>{0.0413007475f, 0.175906345f},
-std::array<float,2>{0.318624705f, 0.80675739f},
-std::array<float,2>{0.5168522f, 0.301249266f},
-std::array<float,2>{0.596574008f, 0.529081941f},
-std::array<float,2>{0.250201821f, 0.0382293686f},
-std::array<float,2>{0.0995597169f, 0.914901674f},
-std::array<float,2>{0.865325511f, 0.385914922f},
-std::array<float,2>{0.905939579f, 0.839421332f},
-std::array<float,2>{0.187607706f, 0.354825377f},
-std::array<float,2>{0.449920774f, 0.692000628f},
-std::array<float,2>{0.627614677f, 0.245760307f},
-std::array<float,2>{0.561413705f, 0.776328385f},
-std::array<float,2>{0.34555009f, 0.25555256f},
-std::array<float,2>{0.0217901133f, 0.659620345f},
-std::array<float,2>{0.800215364f, 0.148444831f},
-std::array<float,2>{0.961322844f, 0.61767149f},
-std::array<float,2>{0.148321509f, 0.0825751945f},
-std::array<float,2>{0.382680893f, 0.967112899f},
-std::array<float,2>{0.706421316f, 0.480326056f},
-std::array<float,2>{0.68051666f, 0.733804643f},
-std::array<float,2>{0.472736597f, 0.205139235f},
-std::array<float,2>{0.234977305f, 0.873703897f},
-std::array<float,2>{0.925935686f, 0.315166801f},
-std::array<float,2>{0.841308475f, 0.889099479f},
-std::array<float,2>{0.0907457694f, 0.418021798f},
-std::array<float,2>{0.288793683f, 0.532126904f},
-std::array<float,2>{0.581324399f, 0.00045814109f},
-std::array<float,2>{0.575115144f, 0.935090482f},
-std::array<float,2>{0.300640583f, 0.400406152f},
-std::array<float,2>{0.0739064515f, 0.509966016f},
-std::array<float,2>{0.823527038f, 0.0531598404f},
-std::array<float,2>{0.909301281f, 0.717737138f},
-std::array<float,2>{0.227403402f, 0.219599932f},
-std::array<float,2>{0.498232603f, 0.822550237f},
-std::array<float,2>{0.659486651f, 0.368562132f},
-std::array<float,2>{0.700990975f, 0.583700657f},
-std::array<float,2>{0.402337223f, 0.109025702f},
-std::array<float,2>{0.138079673f, 0.999442041f},
-std::array<float,2>{0.944436789f, 0.450630695f},
-std::array<float,2>{0.793724358f, 0.794704199f},
-std::array<float,2>{0.00695370091f, 0.295077115f},
-std::array<float,2>{0.374521226f, 0.644853413f},
-std::array<float,2>{0.532128572f, 0.166885331f},
-std::array<float,2>{0.646340072f, 0.851752698f},
-std::array<float,2>{0.466198444f, 0.33896637f},
-std::array<float,2>{0.206631169f, 0.740501225f},
-std::array<float,2>{0.890287817f, 0.202030241f},
-std::array<float,2>{0.848893344f, 0.552696228f},
-std::array<float,2>{0.120708331f, 0.0172741804f},
-std::array<float,2>{0.273068994f, 0.898628712f},
-std::array<float,2>{0.624825358f, 0.427048475f},
-std::array<float,2>{0.510492623f, 0.678962827f},
-std::array<float,2>{0.329647094f, 0.140215725f},
-std::array<float,2>{0.0597861707f, 0.756209671f},
-std::array<float,2>{0.769123435f, 0.267157733f},
-std::array<float,2>{0.970106125f, 0.938278258f},
-std::array<float,2>{0.184107974f, 0.492856503f},
-std::array<float,2>{0.421306938f, 0.595615268f},
-std::array<float,2>{0.741379976f, 0.0726670399f},
-std::array<float,2>{0.669331729f, 0.893613994f},
-std::array<float,2>{0.485355318f, 0.432120621f},
-std::array<float,2>{0.219718769f, 0.556740105f},
-std::array<float,2>{0.918254733f, 0.0259255078f},
-std::array<float,2>{0.819359124f, 0.745671868f},
-std::array<float,2>{0.0702720955f, 0.192193002f},
-std::array<float,2>{0.306797504f, 0.849542737f},
-std::array<float,2>{0.563984036f, 0.33111465f},
-std::array<float,2>{0.539864063f, 0.607133448f},
-std::array<float,2>{0.361125708f, 0.0682157949f},
-std::array<float,2>{0.0138146514f, 0.947785854f},
-std::array<float,2>{0.787200928f, 0.488623261f},
-std::array<float,2>{0.945857584f, 0.762664557f},
-std::array<float,2>{0.127645269f, 0.276758164f},
-std::array<float,2>{0.3915883f, 0.687464654f},
-std::array<float,2>{0.693129897f, 0.125616997f},
-std::array<float,2>{0.612118125f, 0.817888141f},
-std::array<float,2>{0.276249498f, 0.362348586f},
-std::array<float,2>{0.109516896f, 0.706908464f},
-std::array<float,2>{0.857818305f, 0.231222495f},
-std::array<float,2>{0.877760947f, 0.501375139f},
-std::array<float,2>{0.213619947f, 0.0561775304f},
-std::array<float,2>{0.459467441f, 0.929048479f},
-std::array<float,2>{0.654295266f, 0.394928783f},
-std::array<float,2>{0.745737791f, 0.652741313f},
-std::array<float,2>{0.407692283f, 0.162038445f},
-std::array<float,2>{0.177562192f, 0.784322619f},
-std::array<float,2>{0.978285074f, 0.282864213f},
-std::array<float,2>{0.778146207f, 0.987901807f},
-std::array<float,2>{0.0513064601f, 0.439526707f},
-std::array<float,2>{0.339024067f, 0.586874604f},
-std::array<float,2>{0.500269175f, 0.0940444916f},
-std::array<float,2>{0.529776216f, 0.958440959f},
-std::array<float,2>{0.325942606f, 0.47535947f},
-std::array<float,2>{0.0349766351f, 0.613750517f},
-std::array<float,2>{0.758485436f, 0.0927800089f},
-std::array<float,2>{0.991134703f, 0.665253043f},
-std::array<float,2>{0.164865911f, 0.140641376f},
-std::array<float,2>{0.434486359f, 0.772736907f},
-std::array<float,2>{0.720199585f, 0.26521194f},
-std::array<float,2>{0.633093059f, 0.5397048f},
-std::array<float,2>{0.44115901f, 0.0129691213f},
-std::array<float,2>{0.200443909f, 0.878047168f},
-std::array<float,2>{0.898076475f, 0.407081842f},
-std::array<float,2>{0.870163679f, 0.862111807f},
-std::array<float,2>{0.105616108f, 0.322469622f},
-std::array<float,2>{0.259147853f, 0.722823501f},
-std::array<float,2>{0.608466268f, 0.211607605f},
-std::array<float,2>{0.714679956f, 0.799138844f},
-std::array<float,2>{0.384036064f, 0.307585567f},
-std::array<float,2>{0.149229035f, 0.627047718f},
-std::array<float,2>{0.957874894f, 0.184217632f},
-std::array<float,2>{0.809938133f, 0.574137628f},
-std::array<float,2>{0.0272138361f, 0.115728565f},
-std::array<float,2>{0.355908692f, 0.984262705f},
-std::array<float,2>{0.547570407f, 0.462647378f},
-std::array<float,2>{0.587381124f, 0.702465296f},
-std::array<float,2>{0.296708286f, 0.238281831f},
-std::array<float,2>{0.0783073977f, 0.835748076f},
-std::array<float,2>{0.830626249f, 0.349359363f},
-std::array<float,2>{0.934039176f, 0.912672102f},
-std::array<float,2>{0.243975982f, 0.377147764f},
-std::array<float,2>{0.482401818f, 0.523432374f},
-std::array<float,2>{0.679515362f, 0.042017594f},
-std::array<float,2>{0.630827427f, 0.952214181f},
-std::array<float,2>{0.448204994f, 0.485009134f},
-std::array<float,2>{0.192225635f, 0.604054868f},
-std::array<float,2>{0.898505092f, 0.062733978f},
-std::array<float,2>{0.860253155f, 0.682989597f},
-std::array<float,2>{0.0956007838f, 0.130017176f},
-std::array<float,2>{0.257054448f, 0.757889569f},
-std::array<float,2>{0.601328135f, 0.27941826f},
-std::array<float,2>{0.522242427f, 0.559880495f},
-std::array<float,2>{0.313983798f, 0.0290490091f},
-std::array<float,2>{0.0442514494f, 0.894885063f},
-std::array<float,2>{0.751428306f, 0.434314102f},
-std::array<float,2>{0.994045496f, 0.845446289f},
-std::array<float,2>{0.15697585f, 0.333625942f},
-std::array<float,2>{0.426512748f, 0.746873975f},
-std::array<float,2>{0.727248907f, 0.189688921f},
-std::array<float,2>{0.585505247f, 0.785358369f},
-std::array<float,2>{0.283167809f, 0.288573205f},
-std::array<float,2>{0.0893003643f, 0.650810719f},
-std::array<float,2>{0.838647068f, 0.156486556f},
-std::array<float,2>{0.921903372f, 0.590982676f},
-std::array<float,2>{0.238875762f, 0.099360697f},
-std::array<float,2>{0.469892412f, 0.990231335f},
-std::array<float,2>{0.6840958f, 0.444392771f},
-std::array<float,2>{0.709753335f, 0.710699201f},
-std::array<float,2>{0.377573997f, 0.229173094f},
-std::array<float,2>{0.144007713f, 0.813312471f},
-std::array<float,2>{0.965679049f, 0.363580495f},
-std::array<float,2>{0.803762674f, 0.923157215f},
-std::array<float,2>{0.0167710874f, 0.392877996f},
-std::array<float,2>{0.348025918f, 0.505346119f},
-std::array<float,2>{0.555323422f, 0.0606251881f},
-std::array<float,2>{0.538764954f, 0.879146338f},
-std::array<float,2>{0.368848622f, 0.412624449f},
-std::array<float,2>{0.00240342319f, 0.545869946f},
-std::array<float,2>{0.792502224f, 0.00995937921f},
-std::array<float,2>{0.939962268f, 0.721555412f},
-std::array<float,2>{0.133049518f, 0.216300234f},
-std::array<float,2>{0.405522406f, 0.863987505f},
-std::array<float,2>{0.698766053f, 0.326694429f},
-std::array<float,2>{0.663811147f, 0.612705827f},
-std::array<float,2>{0.49292323f, 0.0876148567f},
-std::array<float,2>{0.23220031f, 0.954093933f},
-std::array<float,2>{0.912636459f, 0.471136838f},
-std::array<float,2>{0.824908614f, 0.766484022f},
-std::array<float,2>{0.0749489442f, 0.260771424f},
-std::array<float,2>{0.3021577f, 0.669900417f},
-std::array<float,2>{0.571365297f, 0.144597396f},
-std::array<float,2>{0.737887919f, 0.831891775f},
-std::array<float,2>{0.414457053f, 0.344231427f},
-std::array<float,2>{0.182431042f, 0.697274148f},
-std::array<float,2>{0.974553168f, 0.236152798f},
-std::array<float,2>{0.769635081f, 0.518402576f},
-std::array<float,2>{0.0570710041f, 0.0455788411f},
-std::array<float,2>{0.332944602f, 0.907276332f},
-std::array<float,2>{0.513724625f, 0.37919119f},
-std::array<float,2>{0.61887157f, 0.631324887f},
-std::array<float,2>{0.26680401f, 0.183044806f},
-std::array<float,2>{0.123200946f, 0.80364418f},
-std::array<float,2>{0.847515941f, 0.30998078f},
-std::array<float,2>{0.885481238f, 0.978278697f},
-std::array<float,2>{0.210433602f, 0.465894967f},
-std::array<float,2>{0.463245243f, 0.577799618f},
-std::array<float,2>{0.643792152f, 0.110619135f},
-std::array<float,2>{0.690280259f, 0.918133318f},
-std::array<float,2>{0.397760808f, 0.388373375f},
-std::array<float,2>{0.130090579f, 0.526028216f},
-std::array<float,2>{0.951895714f, 0.0350652002f},
-std::array<float,2>{0.785023332f, 0.688648999f},
-std::array<float,2>{0.0115906037f, 0.24664773f},
-std::array<float,2>{0.364319533f, 0.841603458f},
-std::array<float,2>{0.546542168f, 0.357684344f},
-std::array<float,2>{0.569608212f, 0.569112062f},
-std::array<float,2>{0.312218457f, 0.121557631f},
-std::array<float,2>{0.063523151f, 0.975356817f},
-std::array<float,2>{0.8151595f, 0.4580158f},
-std::array<float,2>{0.914970696f, 0.808643401f},
-std::array<float,2>{0.223944128f, 0.298514754f},
-std::array<float,2>{0.489619851f, 0.634953916f},
-std::array<float,2>{0.665215969f, 0.17433016f},
-std::array<float,2>{0.504087687f, 0.869107664f},
-std::array<float,2>{0.342219889f, 0.31975314f},
-std::array<float,2>{0.0498033836f, 0.729485869f},
-std::array<float,2>{0.775391519f, 0.210099608f},
-std::array<float,2>{0.984335959f, 0.538208544f},
-std::array<float,2>{0.174963966f, 0.00437583588f},
-std::array<float,2>{0.412827402f, 0.886436939f},
-std::array<float,2>{0.746341646f, 0.416672021f},
-std::array<float,2>{0.649322629f, 0.662293077f},
-std::array<float,2>{0.456158787f, 0.154426962f},
-std::array<float,2>{0.217540532f, 0.779405832f},
-std::array<float,2>{0.879508138f, 0.252100736f},
-std::array<float,2>{0.855204582f, 0.963823557f},
-std::array<float,2>{0.116588391f, 0.484128654f},
-std::array<float,2>{0.279710948f, 0.62259537f},
-std::array<float,2>{0.613612294f, 0.0790565982f},
-std::array<float,2>{0.602790713f, 0.993525803f},
-std::array<float,2>{0.263181567f, 0.446718872f},
-std::array<float,2>{0.102143265f, 0.580705345f},
-std::array<float,2>{0.87123096f, 0.103152476f},
-std::array<float,2>{0.894419134f, 0.641729414f},
-std::array<float,2>{0.195507228f, 0.171098158f},
-std::array<float,2>{0.442972273f, 0.789287746f},
-std::array<float,2>{0.637698829f, 0.292755008f},
-std::array<float,2>{0.726118684f, 0.512002885f},
-std::array<float,2>{0.431232899f, 0.0500133075f},
-std::array<float,2>{0.169261709f, 0.930479407f},
-std::array<float,2>{0.985359013f, 0.406070769f},
-std::array<float,2>{0.763292611f, 0.826295316f},
-std::array<float,2>{0.036442481f, 0.374489278f},
-std::array<float,2>{0.323310554f, 0.713694155f},
-std::array<float,2>{0.523440838f, 0.225992605f},
-std::array<float,2>{0.672071099f, 0.751827538f},
-std::array<float,2>{0.479465574f, 0.272377014f},
-std::array<float,2>{0.248971924f, 0.673904598f},
-std::array<float,2>{0.931904256f, 0.135906875f},
-std::array<float,2>{0.835392952f, 0.599082232f},
-std::array<float,2>{0.0835289508f, 0.0763795227f},
-std::array<float,2>{0.289659858f, 0.94314146f},
-std::array<float,2>{0.589995742f, 0.499944568f},
-std::array<float,2>{0.552958727f, 0.734811366f},
-std::array<float,2>{0.354124218f, 0.198378086f},
-std::array<float,2>{0.0291822348f, 0.856665432f},
-std::array<float,2>{0.807946086f, 0.340946615f},
-std::array<float,2>{0.955195189f, 0.903904915f},
-std::array<float,2>{0.154773846f, 0.422478586f},
-std::array<float,2>{0.388724327f, 0.550685346f},
-std::array<float,2>{0.717648566f, 0.023060292f},
-std::array<float,2>{0.704380453f, 0.964999557f},
-std::array<float,2>{0.379019827f, 0.477451831f},
-std::array<float,2>{0.144911572f, 0.620887041f},
-std::array<float,2>{0.963572681f, 0.0851892158f},
-std::array<float,2>{0.797149539f, 0.656296492f},
-std::array<float,2>{0.0211639758f, 0.152306035f},
-std::array<float,2>{0.346569896f, 0.77351445f},
-std::array<float,2>{0.560026109f, 0.255962282f},
-std::array<float,2>{0.5785501f, 0.534203649f},
-std::array<float,2>{0.285786182f, 0.00279492233f},
-std::array<float,2>{0.0925303549f, 0.887032688f},
-std::array<float,2>{0.84218353f, 0.420063138f},
-std::array<float,2>{0.928568423f, 0.872706175f},
-std::array<float,2>{0.236849472f, 0.313588411f},
-std::array<float,2>{0.476372272f, 0.730798125f},
-std::array<float,2>{0.683309317f, 0.203384832f},
-std::array<float,2>{0.519005358f, 0.806031108f},
-std::array<float,2>{0.316632539f, 0.302809775f},
-std::array<float,2>{0.0399812721f, 0.637725592f},
-std::array<float,2>{0.754985988f, 0.178302303f},
-std::array<float,2>{0.99788475f, 0.565953434f},
-std::array<float,2>{0.162257165f, 0.11782743f},
-std::array<float,2>{0.423760593f, 0.972377479f},
-std::array<float,2>{0.732285678f, 0.455160737f},
-std::array<float,2>{0.625478506f, 0.69399488f},
-std::array<float,2>{0.452352583f, 0.24225682f},
-std::array<float,2>{0.190964088f, 0.83720386f},
-std::array<float,2>{0.903264821f, 0.351624131f},
-std::array<float,2>{0.865185201f, 0.91639024f},
-std::array<float,2>{0.100344799f, 0.383875221f},
-std::array<float,2>{0.25236389f, 0.531242669f},
-std::array<float,2>{0.593922794f, 0.0354376398f},
-std::array<float,2>{0.622701049f, 0.901936531f},
-std::array<float,2>{0.269909382f, 0.428198665f},
-std::array<float,2>{0.117341101f, 0.553696811f},
-std::array<float,2>{0.850818336f, 0.0189184826f},
-std::array<float,2>{0.888610303f, 0.739424706f},
-std::array<float,2>{0.204535902f, 0.200087592f},
-std::array<float,2>{0.466823995f, 0.854401946f},
-std::array<float,2>{0.647270918f, 0.337064207f},
-std::array<float,2>{0.738675833f, 0.597376227f},
-std::array<float,2>{0.419242561f, 0.0707000718f},
-std::array<float,2>{0.186311647f, 0.940865993f},
-std::array<float,2>{0.972346306f, 0.495712757f},
-std::array<float,2>{0.765931726f, 0.755394101f},
-std::array<float,2>{0.061312329f, 0.267761976f},
-std::array<float,2>{0.330330551f, 0.676421821f},
-std::array<float,2>{0.508378625f, 0.138028279f},
-std::array<float,2>{0.657880604f, 0.821556807f},
-std::array<float,2>{0.497293532f, 0.371024102f},
-std::array<float,2>{0.229885191f, 0.715369046f},
-std::array<float,2>{0.908178508f, 0.22135742f},
-std::array<float,2>{0.821434677f, 0.509700179f},
-std::array<float,2>{0.0714822933f, 0.0513225757f},
-std::array<float,2>{0.297442466f, 0.937134445f},
-std::array<float,2>{0.576515019f, 0.399737984f},
-std::array<float,2>{0.533682883f, 0.646812499f},
-std::array<float,2>{0.372337908f, 0.164488807f},
-std::array<float,2>{0.00421955949f, 0.79613328f},
-std::array<float,2>{0.796031356f, 0.293254286f},
-std::array<float,2>{0.942400634f, 0.996729493f},
-std::array<float,2>{0.140105844f, 0.451180249f},
-std::array<float,2>{0.399727017f, 0.585174501f},
-std::array<float,2>{0.702738166f, 0.105596028f},
-std::array<float,2>{0.65481925f, 0.926589489f},
-std::array<float,2>{0.45706147f, 0.396904171f},
-std::array<float,2>{0.212472185f, 0.502497852f},
-std::array<float,2>{0.875552237f, 0.0584895909f},
-std::array<float,2>{0.855935335f, 0.704367816f},
-std::array<float,2>{0.111863464f, 0.23398377f},
-std::array<float,2>{0.274949938f, 0.819442213f},
-std::array<float,2>{0.611069679f, 0.360338509f},
-std::array<float,2>{0.502835512f, 0.589194655f},
-std::array<float,2>{0.337769955f, 0.0960860923f},
-std::array<float,2>{0.0536146164f, 0.986307502f},
-std::array<float,2>{0.781116486f, 0.437754661f},
-std::array<float,2>{0.978613615f, 0.782612026f},
-std::array<float,2>{0.17809841f, 0.284411162f},
-std::array<float,2>{0.409487396f, 0.655617893f},
-std::array<float,2>{0.742666245f, 0.162260652f},
-std::array<float,2>{0.565411508f, 0.850406229f},
-std::array<float,2>{0.306548208f, 0.329561323f},
-std::array<float,2>{0.0679045841f, 0.743018627f},
-std::array<float,2>{0.816593587f, 0.193804681f},
-std::array<float,2>{0.919945121f, 0.555983961f},
-std::array<float,2>{0.220810533f, 0.0252033472f},
-std::array<float,2>{0.48740828f, 0.892485499f},
-std::array<float,2>{0.670416415f, 0.430637836f},
-std::array<float,2>{0.694290996f, 0.685298264f},
-std::array<float,2>{0.393460125f, 0.128438354f},
-std::array<float,2>{0.126042664f, 0.76554805f},
-std::array<float,2>{0.947324812f, 0.274326742f},
-std::array<float,2>{0.786030173f, 0.946753204f},
-std::array<float,2>{0.0124301026f, 0.491431952f},
-std::array<float,2>{0.362850517f, 0.608992219f},
-std::array<float,2>{0.542154968f, 0.0701973438f},
-std::array<float,2>{0.549305856f, 0.981875479f},
-std::array<float,2>{0.359062314f, 0.464208663f},
-std::array<float,2>{0.0239228867f, 0.570466578f},
-std::array<float,2>{0.811320901f, 0.114999324f},
-std::array<float,2>{0.959038913f, 0.626637101f},
-std::array<float,2>{0.15226604f, 0.186980978f},
-std::array<float,2>{0.384968221f, 0.798719645f},
-std::array<float,2>{0.711756289f, 0.30634886f},
-std::array<float,2>{0.676348984f, 0.520940363f},
-std::array<float,2>{0.483668506f, 0.0395086519f},
-std::array<float,2>{0.245674506f, 0.911395907f},
-std::array<float,2>{0.936043084f, 0.375666767f},
-std::array<float,2>{0.829211533f, 0.832039297f},
-std::array<float,2>{0.0815516189f, 0.35147506f},
-std::array<float,2>{0.294115394f, 0.699405015f},
-std::array<float,2>{0.589263201f, 0.241498634f},
-std::array<float,2>{0.721089423f, 0.771191299f},
-std::array<float,2>{0.436034203f, 0.262077332f},
-std::array<float,2>{0.167317197f, 0.666291296f},
-std::array<float,2>{0.988897741f, 0.142930835f},
-std::array<float,2>{0.761569798f, 0.616822064f},
-std::array<float,2>{0.0322456062f, 0.0909186676f},
-std::array<float,2>{0.327803254f, 0.960299134f},
-std::array<float,2>{0.528854787f, 0.474539518f},
-std::array<float,2>{0.607315958f, 0.72472626f},
-std::array<float,2>{0.260866374f, 0.213098079f},
-std::array<float,2>{0.109151721f, 0.860585213f},
-std::array<float,2>{0.867292166f, 0.322137952f},
-std::array<float,2>{0.895755708f, 0.875497937f},
-std::array<float,2>{0.202625796f, 0.409907192f},
-std::array<float,2>{0.437897265f, 0.541456044f},
-std::array<float,2>{0.635098219f, 0.0139479786f},
-std::array<float,2>{0.686805487f, 0.991461277f},
-std::array<float,2>{0.47257942f, 0.442639202f},
-std::array<float,2>{0.241910443f, 0.592931509f},
-std::array<float,2>{0.924932241f, 0.101330526f},
-std::array<float,2>{0.837553978f, 0.650129259f},
-std::array<float,2>{0.0876524523f, 0.159250826f},
-std::array<float,2>{0.285008222f, 0.788107574f},
-std::array<float,2>{0.582394063f, 0.285728842f},
-std::array<float,2>{0.558526993f, 0.506541729f},
-std::array<float,2>{0.350457668f, 0.0586182103f},
-std::array<float,2>{0.0192680266f, 0.923938751f},
-std::array<float,2>{0.802331388f, 0.391448289f},
-std::array<float,2>{0.967334807f, 0.814672649f},
-std::array<float,2>{0.141503409f, 0.366440326f},
-std::array<float,2>{0.376910865f, 0.707841218f},
-std::array<float,2>{0.708095372f, 0.227226749f},
-std::array<float,2>{0.598671138f, 0.760459423f},
-std::array<float,2>{0.254080653f, 0.278120756f},
-std::array<float,2>{0.0971626043f, 0.68116802f},
-std::array<float,2>{0.862083852f, 0.131989792f},
-std::array<float,2>{0.901023865f, 0.602964699f},
-std::array<float,2>{0.193776757f, 0.0645272434f},
-std::array<float,2>{0.446825117f, 0.950585723f},
-std::array<float,2>{0.631965101f, 0.486969292f},
-std::array<float,2>{0.728869081f, 0.748089015f},
-std::array<float,2>{0.429423511f, 0.189061195f},
-std::array<float,2>{0.159528151f, 0.847653866f},
-std::array<float,2>{0.995630622f, 0.335215002f},
-std::array<float,2>{0.752931535f, 0.898329437f},
-std::array<float,2>{0.0467363074f, 0.437345684f},
-std::array<float,2>{0.316069871f, 0.560727954f},
-std::array<float,2>{0.520746827f, 0.030470483f},
-std::array<float,2>{0.513113439f, 0.908625066f},
-std::array<float,2>{0.334701896f, 0.381721616f},
-std::array<float,2>{0.0548710041f, 0.515764356f},
-std::array<float,2>{0.772523701f, 0.0445775166f},
-std::array<float,2>{0.975773931f, 0.695789039f},
-std::array<float,2>{0.180913791f, 0.237024739f},
-std::array<float,2>{0.417898029f, 0.828336179f},
-std::array<float,2>{0.735284269f, 0.345934659f},
-std::array<float,2>{0.642103612f, 0.575231612f},
-std::array<float,2>{0.460938781f, 0.112580508f},
-std::array<float,2>{0.207157373f, 0.979027689f},
-std::array<float,2>{0.88451457f, 0.466916442f},
-std::array<float,2>{0.844402194f, 0.802093208f},
-std::array<float,2>{0.121934026f, 0.312342525f},
-std::array<float,2>{0.267649591f, 0.630121708f},
-std::array<float,2>{0.620229483f, 0.180132642f},
-std::array<float,2>{0.697100699f, 0.865542829f},
-std::array<float,2>{0.403330684f, 0.324387401f},
-std::array<float,2>{0.136160582f, 0.719950855f},
-std::array<float,2>{0.93845737f, 0.21815069f},
-std::array<float,2>{0.790052235f, 0.543182194f},
-std::array<float,2>{0.000221126305f, 0.00893900171f},
-std::array<float,2>{0.369714022f, 0.881337941f},
-std::array<float,2>{0.536703646f, 0.411582679f},
-std::array<float,2>{0.572753549f, 0.669999182f},
-std::array<float,2>{0.303854465f, 0.147475734f},
-std::array<float,2>{0.0778251514f, 0.76924783f},
-std::array<float,2>{0.828006208f, 0.259717226f},
-std::array<float,2>{0.911493182f, 0.956668198f},
-std::array<float,2>{0.233975068f, 0.469302088f},
-std::array<float,2>{0.49608475f, 0.609675348f},
-std::array<float,2>{0.661888897f, 0.0881848559f},
-std::array<float,2>{0.748550713f, 0.882853746f},
-std::array<float,2>{0.411215097f, 0.415346712f},
-std::array<float,2>{0.172927842f, 0.537001312f},
-std::array<float,2>{0.980521023f, 0.00676356442f},
-std::array<float,2>{0.7745381f, 0.727025688f},
-std::array<float,2>{0.0477192104f, 0.207597658f},
-std::array<float,2>{0.341104716f, 0.870673656f},
-std::array<float,2>{0.507563651f, 0.317215413f},
-std::array<float,2>{0.616479218f, 0.624038577f},
-std::array<float,2>{0.278869808f, 0.0810168386f},
-std::array<float,2>{0.114929564f, 0.962855279f},
-std::array<float,2>{0.852059543f, 0.481284142f},
-std::array<float,2>{0.882374346f, 0.778176904f},
-std::array<float,2>{0.215954304f, 0.251878858f},
-std::array<float,2>{0.453283995f, 0.660162449f},
-std::array<float,2>{0.650422692f, 0.154020712f},
-std::array<float,2>{0.543214679f, 0.842635095f},
-std::array<float,2>{0.366285592f, 0.355523705f},
-std::array<float,2>{0.0086247297f, 0.690420866f},
-std::array<float,2>{0.782179832f, 0.249632701f},
-std::array<float,2>{0.950139225f, 0.524121583f},
-std::array<float,2>{0.130908355f, 0.0319365598f},
-std::array<float,2>{0.395306647f, 0.921644926f},
-std::array<float,2>{0.68934238f, 0.389492959f},
-std::array<float,2>{0.667577982f, 0.634226441f},
-std::array<float,2>{0.490340263f, 0.171875626f},
-std::array<float,2>{0.225323468f, 0.810756862f},
-std::array<float,2>{0.916207194f, 0.300123543f},
-std::array<float,2>{0.81335783f, 0.973722517f},
-std::array<float,2>{0.0658390373f, 0.459753513f},
-std::array<float,2>{0.310420245f, 0.567398548f},
-std::array<float,2>{0.566566467f, 0.124654517f},
-std::array<float,2>{0.5934605f, 0.943598092f},
-std::array<float,2>{0.292694986f, 0.4967767f},
-std::array<float,2>{0.0856026635f, 0.600715876f},
-std::array<float,2>{0.832077622f, 0.0752682984f},
-std::array<float,2>{0.931365788f, 0.672401905f},
-std::array<float,2>{0.247621834f, 0.133359969f},
-std::array<float,2>{0.476640642f, 0.752406299f},
-std::array<float,2>{0.675110161f, 0.270248622f},
-std::array<float,2>{0.715093553f, 0.548226535f},
-std::array<float,2>{0.387339383f, 0.0209145322f},
-std::array<float,2>{0.152687103f, 0.905234277f},
-std::array<float,2>{0.953457594f, 0.425222278f},
-std::array<float,2>{0.805085361f, 0.859279931f},
-std::array<float,2>{0.0307989195f, 0.342583954f},
-std::array<float,2>{0.352225751f, 0.737979352f},
-std::array<float,2>{0.55205369f, 0.195869863f},
-std::array<float,2>{0.640623629f, 0.792361915f},
-std::array<float,2>{0.444906861f, 0.289735526f},
-std::array<float,2>{0.197653517f, 0.643511295f},
-std::array<float,2>{0.892261267f, 0.168521956f},
-std::array<float,2>{0.873383641f, 0.579137325f},
-std::array<float,2>{0.103839599f, 0.104300886f},
-std::array<float,2>{0.265353173f, 0.995933831f},
-std::array<float,2>{0.604048371f, 0.44727838f},
-std::array<float,2>{0.526854992f, 0.712025464f},
-std::array<float,2>{0.321646392f, 0.222753078f},
-std::array<float,2>{0.0383872576f, 0.824880481f},
-std::array<float,2>{0.765239358f, 0.371711284f},
-std::array<float,2>{0.987140775f, 0.932741284f},
-std::array<float,2>{0.171306416f, 0.40379405f},
-std::array<float,2>{0.433434099f, 0.514320791f},
-std::array<float,2>{0.722956896f, 0.0471167378f},
-std::array<float,2>{0.711337566f, 0.983664811f},
-std::array<float,2>{0.385632366f, 0.46192646f},
-std::array<float,2>{0.151418924f, 0.573354423f},
-std::array<float,2>{0.959598422f, 0.115652286f},
-std::array<float,2>{0.810876131f, 0.627690494f},
-std::array<float,2>{0.0241480581f, 0.183888763f},
-std::array<float,2>{0.358643383f, 0.799752414f},
-std::array<float,2>{0.549412668f, 0.307070255f},
-std::array<float,2>{0.58957535f, 0.522840321f},
-std::array<float,2>{0.294577062f, 0.0428673215f},
-std::array<float,2>{0.0812338069f, 0.912123561f},
-std::array<float,2>{0.830065191f, 0.377791524f},
-std::array<float,2>{0.935819924f, 0.835241973f},
-std::array<float,2>{0.245344445f, 0.348693281f},
-std::array<float,2>{0.48400107f, 0.702950954f},
-std::array<float,2>{0.675982058f, 0.23885873f},
-std::array<float,2>{0.528779387f, 0.773033679f},
-std::array<float,2>{0.327208817f, 0.264930308f},
-std::array<float,2>{0.033137314f, 0.665551424f},
-std::array<float,2>{0.761131406f, 0.14159064f},
-std::array<float,2>{0.988642991f, 0.614161611f},
-std::array<float,2>{0.167798296f, 0.0933483019f},
-std::array<float,2>{0.436436772f, 0.958661973f},
-std::array<float,2>{0.721248746f, 0.474660486f},
-std::array<float,2>{0.635284185f, 0.723413348f},
-std::array<float,2>{0.438073188f, 0.211155802f},
-std::array<float,2>{0.20266512f, 0.861640453f},
-std::array<float,2>{0.896097481f, 0.323175341f},
-std::array<float,2>{0.867966473f, 0.878571391f},
-std::array<float,2>{0.108835384f, 0.406436175f},
-std::array<float,2>{0.261339813f, 0.539450884f},
-std::array<float,2>{0.606662214f, 0.013533337f},
-std::array<float,2>{0.610517979f, 0.929626763f},
-std::array<float,2>{0.274555117f, 0.39535448f},
-std::array<float,2>{0.111556247f, 0.501791775f},
-std::array<float,2>{0.856376827f, 0.05586401f},
-std::array<float,2>{0.875114918f, 0.706182182f},
-std::array<float,2>{0.212257922f, 0.23082903f},
-std::array<float,2>{0.45767042f, 0.817453682f},
-std::array<float,2>{0.65457809f, 0.362805277f},
-std::array<float,2>{0.742808938f, 0.586146533f},
-std::array<float,2>{0.410093307f, 0.0943637043f},
-std::array<float,2>{0.178668767f, 0.987503827f},
-std::array<float,2>{0.979400575f, 0.440411896f},
-std::array<float,2>{0.780284405f, 0.784792006f},
-std::array<float,2>{0.0531282574f, 0.282274097f},
-std::array<float,2>{0.33730787f, 0.65331316f},
-std::array<float,2>{0.502061784f, 0.161497712f},
-std::array<float,2>{0.67020613f, 0.8491171f},
-std::array<float,2>{0.487841934f, 0.331749767f},
-std::array<float,2>{0.22137925f, 0.745126009f},
-std::array<float,2>{0.920792758f, 0.191585332f},
-std::array<float,2>{0.816972017f, 0.557153046f},
-std::array<float,2>{0.0674523041f, 0.0256884098f},
-std::array<float,2>{0.305926293f, 0.894451618f},
-std::array<float,2>{0.564603031f, 0.432256788f},
-std::array<float,2>{0.54281801f, 0.686980546f},
-std::array<float,2>{0.362454861f, 0.125013009f},
-std::array<float,2>{0.0121132443f, 0.761860132f},
-std::array<float,2>{0.785626173f, 0.276880205f},
-std::array<float,2>{0.948220611f, 0.947511256f},
-std::array<float,2>{0.126938075f, 0.488931924f},
-std::array<float,2>{0.392673045f, 0.606775999f},
-std::array<float,2>{0.6934762f, 0.0676538199f},
-std::array<float,2>{0.646747828f, 0.899219215f},
-std::array<float,2>{0.467556536f, 0.427692413f},
-std::array<float,2>{0.204789072f, 0.551818192f},
-std::array<float,2>{0.887757599f, 0.0170479771f},
-std::array<float,2>{0.851240098f, 0.740737975f},
-std::array<float,2>{0.118053578f, 0.201527387f},
-std::array<float,2>{0.27020511f, 0.8525334f},
-std::array<float,2>{0.622426212f, 0.339575022f},
-std::array<float,2>{0.507978022f, 0.594922245f},
-std::array<float,2>{0.330824971f, 0.0728627369f},
-std::array<float,2>{0.0608960129f, 0.937710762f},
-std::array<float,2>{0.76616168f, 0.492651492f},
-std::array<float,2>{0.971919715f, 0.756807029f},
-std::array<float,2>{0.185887083f, 0.267000347f},
-std::array<float,2>{0.419803768f, 0.679348826f},
-std::array<float,2>{0.738832295f, 0.139674023f},
-std::array<float,2>{0.577082753f, 0.822812498f},
-std::array<float,2>{0.297261715f, 0.368879408f},
-std::array<float,2>{0.0722005889f, 0.717198133f},
-std::array<float,2>{0.822016716f, 0.218798265f},
-std::array<float,2>{0.907552361f, 0.510277987f},
-std::array<float,2>{0.230099812f, 0.0533864982f},
-std::array<float,2>{0.497877121f, 0.934702098f},
-std::array<float,2>{0.657535732f, 0.400931031f},
-std::array<float,2>{0.702192426f, 0.645375788f},
-std::array<float,2>{0.400042832f, 0.166226879f},
-std::array<float,2>{0.140525252f, 0.794311702f},
-std::array<float,2>{0.943174124f, 0.295756012f},
-std::array<float,2>{0.796508968f, 0.999721289f},
-std::array<float,2>{0.00478340965f, 0.450714856f},
-std::array<float,2>{0.372892052f, 0.583090305f},
-std::array<float,2>{0.533770323f, 0.108474188f},
-std::array<float,2>{0.560418665f, 0.967406034f},
-std::array<float,2>{0.34608224f, 0.479610384f},
-std::array<float,2>{0.0206487942f, 0.618090689f},
-std::array<float,2>{0.797791302f, 0.0822670162f},
-std::array<float,2>{0.963098586f, 0.659918606f},
-std::array<float,2>{0.145021528f, 0.14896965f},
-std::array<float,2>{0.379736632f, 0.775585413f},
-std::array<float,2>{0.704654992f, 0.255230635f},
-std::array<float,2>{0.683066666f, 0.531314969f},
-std::array<float,2>{0.476030767f, 0.000963128754f},
-std::array<float,2>{0.236410186f, 0.889309824f},
-std::array<float,2>{0.928198636f, 0.41872862f},
-std::array<float,2>{0.842541277f, 0.873065352f},
-std::array<float,2>{0.0921734497f, 0.314746439f},
-std::array<float,2>{0.285347462f, 0.734000146f},
-std::array<float,2>{0.579086483f, 0.206019193f},
-std::array<float,2>{0.731845856f, 0.807567716f},
-std::array<float,2>{0.423038095f, 0.301394105f},
-std::array<float,2>{0.16301176f, 0.639883816f},
-std::array<float,2>{0.997169375f, 0.176676482f},
-std::array<float,2>{0.75552094f, 0.563890159f},
-std::array<float,2>{0.0393645056f, 0.120391965f},
-std::array<float,2>{0.317253113f, 0.969167709f},
-std::array<float,2>{0.519432127f, 0.453945786f},
-std::array<float,2>{0.5946365f, 0.691617548f},
-std::array<float,2>{0.252515048f, 0.24558872f},
-std::array<float,2>{0.0997432545f, 0.838975012f},
-std::array<float,2>{0.864460707f, 0.355312377f},
-std::array<float,2>{0.902822912f, 0.914355874f},
-std::array<float,2>{0.190597504f, 0.386376053f},
-std::array<float,2>{0.452937484f, 0.528718114f},
-std::array<float,2>{0.625963449f, 0.038893804f},
-std::array<float,2>{0.675674617f, 0.942407727f},
-std::array<float,2>{0.477394581f, 0.499130338f},
-std::array<float,2>{0.247368157f, 0.599594474f},
-std::array<float,2>{0.930860221f, 0.0770231336f},
-std::array<float,2>{0.832699716f, 0.674555838f},
-std::array<float,2>{0.0851358399f, 0.136507705f},
-std::array<float,2>{0.292261481f, 0.751375914f},
-std::array<float,2>{0.592791557f, 0.27150929f},
-std::array<float,2>{0.552434385f, 0.550171971f},
-std::array<float,2>{0.351729244f, 0.022778295f},
-std::array<float,2>{0.030560974f, 0.903513253f},
-std::array<float,2>{0.805412292f, 0.422328979f},
-std::array<float,2>{0.954014361f, 0.85713619f},
-std::array<float,2>{0.152873904f, 0.341442257f},
-std::array<float,2>{0.386875212f, 0.735115409f},
-std::array<float,2>{0.715691626f, 0.198794469f},
-std::array<float,2>{0.603518903f, 0.789986372f},
-std::array<float,2>{0.265134245f, 0.29230544f},
-std::array<float,2>{0.104445085f, 0.642373025f},
-std::array<float,2>{0.873845577f, 0.171742469f},
-std::array<float,2>{0.892013311f, 0.580286503f},
-std::array<float,2>{0.197827622f, 0.102655917f},
-std::array<float,2>{0.444410086f, 0.993828595f},
-std::array<float,2>{0.639798999f, 0.446935445f},
-std::array<float,2>{0.723520696f, 0.712965488f},
-std::array<float,2>{0.432773411f, 0.226210967f},
-std::array<float,2>{0.171440408f, 0.827084064f},
-std::array<float,2>{0.98635596f, 0.37494871f},
-std::array<float,2>{0.764828324f, 0.93002373f},
-std::array<float,2>{0.0389090702f, 0.405622512f},
-std::array<float,2>{0.321825385f, 0.512479842f},
-std::array<float,2>{0.527132154f, 0.0506162234f},
-std::array<float,2>{0.506979883f, 0.88585645f},
-std::array<float,2>{0.341447771f, 0.416045576f},
-std::array<float,2>{0.0473092794f, 0.538934767f},
-std::array<float,2>{0.774942756f, 0.00485337479f},
-std::array<float,2>{0.981152713f, 0.7286883f},
-std::array<float,2>{0.173817337f, 0.210727245f},
-std::array<float,2>{0.411831796f, 0.868392527f},
-std::array<float,2>{0.748149037f, 0.319834262f},
-std::array<float,2>{0.651190817f, 0.622225761f},
-std::array<float,2>{0.453855008f, 0.0782965273f},
-std::array<float,2>{0.216658741f, 0.962955952f},
-std::array<float,2>{0.8822456f, 0.483736724f},
-std::array<float,2>{0.851706445f, 0.779830813f},
-std::array<float,2>{0.114284657f, 0.252730578f},
-std::array<float,2>{0.278607637f, 0.662900448f},
-std::array<float,2>{0.616890311f, 0.154865548f},
-std::array<float,2>{0.688854396f, 0.840972662f},
-std::array<float,2>{0.394620895f, 0.357960135f},
-std::array<float,2>{0.131430626f, 0.689434528f},
-std::array<float,2>{0.949676871f, 0.246399537f},
-std::array<float,2>{0.781344175f, 0.525622249f},
-std::array<float,2>{0.00816532504f, 0.0342821926f},
-std::array<float,2>{0.367086411f, 0.918896139f},
-std::array<float,2>{0.543663442f, 0.388080508f},
-std::array<float,2>{0.56698215f, 0.63547492f},
-std::array<float,2>{0.309669495f, 0.174204096f},
-std::array<float,2>{0.0660284013f, 0.809284329f},
-std::array<float,2>{0.812502503f, 0.297956288f},
-std::array<float,2>{0.91659677f, 0.975051343f},
-std::array<float,2>{0.224881724f, 0.458765477f},
-std::array<float,2>{0.491148353f, 0.568397045f},
-std::array<float,2>{0.667259157f, 0.122000366f},
-std::array<float,2>{0.734840155f, 0.907896876f},
-std::array<float,2>{0.41704762f, 0.37968275f},
-std::array<float,2>{0.181451425f, 0.517690837f},
-std::array<float,2>{0.976082146f, 0.0452889875f},
-std::array<float,2>{0.772985518f, 0.697847784f},
-std::array<float,2>{0.0555545166f, 0.235511273f},
-std::array<float,2>{0.334029883f, 0.831054807f},
-std::array<float,2>{0.513541996f, 0.344646335f},
-std::array<float,2>{0.620808721f, 0.577348173f},
-std::array<float,2>{0.268159956f, 0.110871851f},
-std::array<float,2>{0.121312812f, 0.977815807f},
-std::array<float,2>{0.84394598f, 0.466584414f},
-std::array<float,2>{0.883993804f, 0.802937031f},
-std::array<float,2>{0.207803816f, 0.310424596f},
-std::array<float,2>{0.461853445f, 0.631383657f},
-std::array<float,2>{0.641863465f, 0.183479711f},
-std::array<float,2>{0.536472082f, 0.863329887f},
-std::array<float,2>{0.369342208f, 0.326430827f},
-std::array<float,2>{0.000685508479f, 0.720870018f},
-std::array<float,2>{0.790933311f, 0.216464683f},
-std::array<float,2>{0.937810183f, 0.545037091f},
-std::array<float,2>{0.136589408f, 0.0106228059f},
-std::array<float,2>{0.403980285f, 0.879647553f},
-std::array<float,2>{0.696528733f, 0.412246644f},
-std::array<float,2>{0.661235809f, 0.669291914f},
-std::array<float,2>{0.49541983f, 0.145219505f},
-std::array<float,2>{0.23373428f, 0.765991509f},
-std::array<float,2>{0.911968112f, 0.261640966f},
-std::array<float,2>{0.827203572f, 0.953430533f},
-std::array<float,2>{0.0772421509f, 0.471424848f},
-std::array<float,2>{0.304642528f, 0.612957358f},
-std::array<float,2>{0.57311213f, 0.0873898864f},
-std::array<float,2>{0.582747936f, 0.989416659f},
-std::array<float,2>{0.284288645f, 0.445195645f},
-std::array<float,2>{0.0869822204f, 0.591350436f},
-std::array<float,2>{0.837047279f, 0.0986591876f},
-std::array<float,2>{0.925398529f, 0.651289046f},
-std::array<float,2>{0.241533548f, 0.157201111f},
-std::array<float,2>{0.47209087f, 0.785748541f},
-std::array<float,2>{0.687090039f, 0.288973838f},
-std::array<float,2>{0.708763063f, 0.505620718f},
-std::array<float,2>{0.376291066f, 0.0610671788f},
-std::array<float,2>{0.140871465f, 0.923767388f},
-std::array<float,2>{0.967262685f, 0.393091291f},
-std::array<float,2>{0.802236319f, 0.812568426f},
-std::array<float,2>{0.0188498609f, 0.363957793f},
-std::array<float,2>{0.349776894f, 0.710040331f},
-std::array<float,2>{0.557653964f, 0.228589788f},
-std::array<float,2>{0.632435977f, 0.758509934f},
-std::array<float,2>{0.446536392f, 0.28019461f},
-std::array<float,2>{0.194091573f, 0.683273375f},
-std::array<float,2>{0.900427163f, 0.130527914f},
-std::array<float,2>{0.861434937f, 0.603911281f},
-std::array<float,2>{0.0971711427f, 0.0632740334f},
-std::array<float,2>{0.254614145f, 0.952793777f},
-std::array<float,2>{0.599265814f, 0.484638482f},
-std::array<float,2>{0.521120846f, 0.746477425f},
-std::array<float,2>{0.315637022f, 0.190337807f},
-std::array<float,2>{0.0461125188f, 0.844893336f},
-std::array<float,2>{0.753879249f, 0.333357573f},
-std::array<float,2>{0.995227218f, 0.895145416f},
-std::array<float,2>{0.159736529f, 0.433980227f},
-std::array<float,2>{0.428867638f, 0.560466528f},
-std::array<float,2>{0.729389131f, 0.0283926614f},
-std::array<float,2>{0.720268309f, 0.960859776f},
-std::array<float,2>{0.43374908f, 0.473773092f},
-std::array<float,2>{0.164536044f, 0.616453946f},
-std::array<float,2>{0.99059087f, 0.0914636478f},
-std::array<float,2>{0.758276761f, 0.666677952f},
-std::array<float,2>{0.0343175828f, 0.143300936f},
-std::array<float,2>{0.325403094f, 0.770904899f},
-std::array<float,2>{0.530022323f, 0.262532234f},
-std::array<float,2>{0.609008491f, 0.541887224f},
-std::array<float,2>{0.259361178f, 0.014489295f},
-std::array<float,2>{0.105973065f, 0.87525332f},
-std::array<float,2>{0.870875299f, 0.409613699f},
-std::array<float,2>{0.89770335f, 0.86111635f},
-std::array<float,2>{0.200709462f, 0.321512401f},
-std::array<float,2>{0.440914154f, 0.725573599f},
-std::array<float,2>{0.633665562f, 0.21377641f},
-std::array<float,2>{0.546961069f, 0.797853708f},
-std::array<float,2>{0.356385976f, 0.305702388f},
-std::array<float,2>{0.0267048404f, 0.626234591f},
-std::array<float,2>{0.810118139f, 0.187047586f},
-std::array<float,2>{0.957421303f, 0.570946813f},
-std::array<float,2>{0.148781881f, 0.114265464f},
-std::array<float,2>{0.384478599f, 0.981985271f},
-std::array<float,2>{0.713925779f, 0.464456409f},
-std::array<float,2>{0.678984761f, 0.699851334f},
-std::array<float,2>{0.481807262f, 0.241768986f},
-std::array<float,2>{0.243252411f, 0.832687855f},
-std::array<float,2>{0.934368372f, 0.350821495f},
-std::array<float,2>{0.830562234f, 0.912069201f},
-std::array<float,2>{0.0787052661f, 0.375437081f},
-std::array<float,2>{0.29600811f, 0.521250725f},
-std::array<float,2>{0.587524951f, 0.0397849195f},
-std::array<float,2>{0.563593745f, 0.891726911f},
-std::array<float,2>{0.307313144f, 0.430137724f},
-std::array<float,2>{0.0694457367f, 0.556242049f},
-std::array<float,2>{0.820158541f, 0.0246534701f},
-std::array<float,2>{0.918619752f, 0.742270172f},
-std::array<float,2>{0.219091818f, 0.194296733f},
-std::array<float,2>{0.486168683f, 0.850054681f},
-std::array<float,2>{0.669597447f, 0.329913169f},
-std::array<float,2>{0.692540824f, 0.608866155f},
-std::array<float,2>{0.390775084f, 0.0693649352f},
-std::array<float,2>{0.127152547f, 0.946908712f},
-std::array<float,2>{0.945555925f, 0.491838902f},
-std::array<float,2>{0.787821174f, 0.764915407f},
-std::array<float,2>{0.0144952703f, 0.273885518f},
-std::array<float,2>{0.36036244f, 0.684852123f},
-std::array<float,2>{0.539263308f, 0.128204361f},
-std::array<float,2>{0.653342068f, 0.820208788f},
-std::array<float,2>{0.459754705f, 0.359820396f},
-std::array<float,2>{0.213136196f, 0.704627872f},
-std::array<float,2>{0.87740469f, 0.233549237f},
-std::array<float,2>{0.85810411f, 0.502157092f},
-std::array<float,2>{0.110191487f, 0.0578157008f},
-std::array<float,2>{0.275511235f, 0.926244915f},
-std::array<float,2>{0.611499786f, 0.397152245f},
-std::array<float,2>{0.5009197f, 0.656061769f},
-std::array<float,2>{0.339398801f, 0.162729651f},
-std::array<float,2>{0.0509012304f, 0.78284657f},
-std::array<float,2>{0.777446866f, 0.285094321f},
-std::array<float,2>{0.977751493f, 0.985600352f},
-std::array<float,2>{0.17701225f, 0.438021302f},
-std::array<float,2>{0.408042043f, 0.589363337f},
-std::array<float,2>{0.745144129f, 0.0962682068f},
-std::array<float,2>{0.659861445f, 0.9365592f},
-std::array<float,2>{0.498903453f, 0.400305957f},
-std::array<float,2>{0.226790398f, 0.5090729f},
-std::array<float,2>{0.909984887f, 0.0509557463f},
-std::array<float,2>{0.823886216f, 0.715125084f},
-std::array<float,2>{0.0733245537f, 0.221091747f},
-std::array<float,2>{0.30027774f, 0.82200408f},
-std::array<float,2>{0.574271858f, 0.370475501f},
-std::array<float,2>{0.531691253f, 0.585449874f},
-std::array<float,2>{0.374212533f, 0.106001906f},
-std::array<float,2>{0.00740265893f, 0.996250808f},
-std::array<float,2>{0.793089867f, 0.451833516f},
-std::array<float,2>{0.945231318f, 0.796734393f},
-std::array<float,2>{0.138670146f, 0.293628216f},
-std::array<float,2>{0.401694f, 0.647294164f},
-std::array<float,2>{0.700432122f, 0.165027887f},
-std::array<float,2>{0.624487102f, 0.853813887f},
-std::array<float,2>{0.272580087f, 0.337454021f},
-std::array<float,2>{0.120598964f, 0.740025163f},
-std::array<float,2>{0.849129856f, 0.199395552f},
-std::array<float,2>{0.889864624f, 0.552771449f},
-std::array<float,2>{0.206303999f, 0.0194475148f},
-std::array<float,2>{0.466712892f, 0.901762843f},
-std::array<float,2>{0.645751536f, 0.428424269f},
-std::array<float,2>{0.741912484f, 0.675823748f},
-std::array<float,2>{0.421602964f, 0.138304487f},
-std::array<float,2>{0.183641776f, 0.755222678f},
-std::array<float,2>{0.970512271f, 0.268333673f},
-std::array<float,2>{0.768909752f, 0.941153526f},
-std::array<float,2>{0.0604918934f, 0.495304674f},
-std::array<float,2>{0.329439729f, 0.596937478f},
-std::array<float,2>{0.510168254f, 0.0710005835f},
-std::array<float,2>{0.517436683f, 0.971912324f},
-std::array<float,2>{0.319263488f, 0.455710769f},
-std::array<float,2>{0.0415559709f, 0.565545678f},
-std::array<float,2>{0.757730961f, 0.11760363f},
-std::array<float,2>{0.998319983f, 0.638479233f},
-std::array<float,2>{0.161803111f, 0.177858427f},
-std::array<float,2>{0.425177515f, 0.806561828f},
-std::array<float,2>{0.732968271f, 0.303358167f},
-std::array<float,2>{0.62719059f, 0.53033483f},
-std::array<float,2>{0.449590415f, 0.0357451551f},
-std::array<float,2>{0.188421354f, 0.916505694f},
-std::array<float,2>{0.905725598f, 0.384375036f},
-std::array<float,2>{0.866021276f, 0.837657452f},
-std::array<float,2>{0.0990830436f, 0.352282375f},
-std::array<float,2>{0.250735521f, 0.693797171f},
-std::array<float,2>{0.595877111f, 0.243003041f},
-std::array<float,2>{0.706562519f, 0.774060905f},
-std::array<float,2>{0.382081985f, 0.256711662f},
-std::array<float,2>{0.147679567f, 0.656855345f},
-std::array<float,2>{0.961478889f, 0.151685387f},
-std::array<float,2>{0.80077821f, 0.620229125f},
-std::array<float,2>{0.0222230908f, 0.0856568068f},
-std::array<float,2>{0.345104396f, 0.965792298f},
-std::array<float,2>{0.560563445f, 0.476866931f},
-std::array<float,2>{0.581655443f, 0.731334686f},
-std::array<float,2>{0.288240165f, 0.203645825f},
-std::array<float,2>{0.0900147706f, 0.872327447f},
-std::array<float,2>{0.841702342f, 0.314241022f},
-std::array<float,2>{0.926448524f, 0.887495399f},
-std::array<float,2>{0.234647155f, 0.420832187f},
-std::array<float,2>{0.473429024f, 0.534900844f},
-std::array<float,2>{0.680171609f, 0.0024361643f},
-std::array<float,2>{0.638208568f, 0.995220542f},
-std::array<float,2>{0.44275862f, 0.447835952f},
-std::array<float,2>{0.195959181f, 0.579861462f},
-std::array<float,2>{0.893890083f, 0.103717931f},
-std::array<float,2>{0.871877491f, 0.642937899f},
-std::array<float,2>{0.101698369f, 0.168340951f},
-std::array<float,2>{0.263557583f, 0.792647421f},
-std::array<float,2>{0.60335499f, 0.289349884f},
-std::array<float,2>{0.523961246f, 0.513699591f},
-std::array<float,2>{0.324138761f, 0.0474508032f},
-std::array<float,2>{0.0370633826f, 0.933133781f},
-std::array<float,2>{0.763156533f, 0.404113412f},
-std::array<float,2>{0.985977292f, 0.824618638f},
-std::array<float,2>{0.169653013f, 0.371519685f},
-std::array<float,2>{0.430745691f, 0.7127316f},
-std::array<float,2>{0.725796819f, 0.223307952f},
-std::array<float,2>{0.590340078f, 0.752638638f},
-std::array<float,2>{0.289244443f, 0.269538313f},
-std::array<float,2>{0.0832072198f, 0.672253847f},
-std::array<float,2>{0.835487425f, 0.133045048f},
-std::array<float,2>{0.932380795f, 0.601351261f},
-std::array<float,2>{0.248100042f, 0.0761603788f},
-std::array<float,2>{0.47889474f, 0.944024205f},
-std::array<float,2>{0.672522962f, 0.496380359f},
-std::array<float,2>{0.717219412f, 0.737654328f},
-std::array<float,2>{0.389614075f, 0.195757225f},
-std::array<float,2>{0.154968128f, 0.858635664f},
-std::array<float,2>{0.95588398f, 0.342270494f},
-std::array<float,2>{0.808297336f, 0.904539764f},
-std::array<float,2>{0.0284503158f, 0.425717354f},
-std::array<float,2>{0.353857607f, 0.548417211f},
-std::array<float,2>{0.553262353f, 0.0213658139f},
-std::array<float,2>{0.546105087f, 0.920968354f},
-std::array<float,2>{0.365121275f, 0.388710469f},
-std::array<float,2>{0.0110331876f, 0.523915589f},
-std::array<float,2>{0.78453064f, 0.0313430205f},
-std::array<float,2>{0.951515436f, 0.689888299f},
-std::array<float,2>{0.130459577f, 0.249196917f},
-std::array<float,2>{0.398259014f, 0.842143297f},
-std::array<float,2>{0.689798534f, 0.355988711f},
-std::array<float,2>{0.665542006f, 0.56811142f},
-std::array<float,2>{0.490016073f, 0.124413021f},
-std::array<float,2>{0.224600554f, 0.974137604f},
-std::array<float,2>{0.914350212f, 0.459262699f},
-std::array<float,2>{0.814900577f, 0.811450362f},
-std::array<float,2>{0.0641926304f, 0.300758302f},
-std::array<float,2>{0.31176126f, 0.634381354f},
-std::array<float,2>{0.570257902f, 0.172515303f},
-std::array<float,2>{0.746604979f, 0.870138228f},
-std::array<float,2>{0.412411928f, 0.316857964f},
-std::array<float,2>{0.175529763f, 0.727422357f},
-std::array<float,2>{0.983576775f, 0.207305536f},
-std::array<float,2>{0.776020825f, 0.536572635f},
-std::array<float,2>{0.049162522f, 0.00619933149f},
-std::array<float,2>{0.34244594f, 0.883553863f},
-std::array<float,2>{0.504707158f, 0.415865839f},
-std::array<float,2>{0.61410296f, 0.660963595f},
-std::array<float,2>{0.280160815f, 0.153628692f},
-std::array<float,2>{0.116944335f, 0.777409971f},
-std::array<float,2>{0.854754508f, 0.251142651f},
-std::array<float,2>{0.879054427f, 0.962212801f},
-std::array<float,2>{0.217164069f, 0.480611682f},
-std::array<float,2>{0.456884205f, 0.624924362f},
-std::array<float,2>{0.648510456f, 0.0804459974f},
-std::array<float,2>{0.698286116f, 0.881662428f},
-std::array<float,2>{0.405934304f, 0.411836147f},
-std::array<float,2>{0.133693531f, 0.543471038f},
-std::array<float,2>{0.939454198f, 0.0093038762f},
-std::array<float,2>{0.792147398f, 0.720672667f},
-std::array<float,2>{0.00273038074f, 0.218298212f},
-std::array<float,2>{0.368245125f, 0.866111755f},
-std::array<float,2>{0.53829813f, 0.325059861f},
-std::array<float,2>{0.5720402f, 0.609930456f},
-std::array<float,2>{0.302495629f, 0.0888565034f},
-std::array<float,2>{0.0746164769f, 0.956062019f},
-std::array<float,2>{0.824527979f, 0.469062239f},
-std::array<float,2>{0.912463009f, 0.768956721f},
-std::array<float,2>{0.231759593f, 0.259271055f},
-std::array<float,2>{0.492287248f, 0.670804024f},
-std::array<float,2>{0.663397849f, 0.148149982f},
-std::array<float,2>{0.514471471f, 0.828664243f},
-std::array<float,2>{0.332150459f, 0.34649986f},
-std::array<float,2>{0.0573242344f, 0.696136653f},
-std::array<float,2>{0.770029664f, 0.236392319f},
-std::array<float,2>{0.974112391f, 0.516199827f},
-std::array<float,2>{0.182041958f, 0.0444253832f},
-std::array<float,2>{0.414773464f, 0.908735812f},
-std::array<float,2>{0.737622321f, 0.3811104f},
-std::array<float,2>{0.644518375f, 0.630432367f},
-std::array<float,2>{0.463605642f, 0.180404633f},
-std::array<float,2>{0.210544929f, 0.80242306f},
-std::array<float,2>{0.885219991f, 0.311912864f},
-std::array<float,2>{0.846823514f, 0.978647113f},
-std::array<float,2>{0.123576917f, 0.467682093f},
-std::array<float,2>{0.267407268f, 0.575866818f},
-std::array<float,2>{0.618591964f, 0.112974115f},
-std::array<float,2>{0.60106355f, 0.950685799f},
-std::array<float,2>{0.257405698f, 0.486650199f},
-std::array<float,2>{0.0949878097f, 0.603325427f},
-std::array<float,2>{0.859629333f, 0.0651558712f},
-std::array<float,2>{0.899191082f, 0.681135237f},
-std::array<float,2>{0.191639125f, 0.132358328f},
-std::array<float,2>{0.447404355f, 0.759769619f},
-std::array<float,2>{0.630256295f, 0.277761877f},
-std::array<float,2>{0.726697266f, 0.561133146f},
-std::array<float,2>{0.425791949f, 0.0310706403f},
-std::array<float,2>{0.156259209f, 0.897617519f},
-std::array<float,2>{0.993293464f, 0.436941385f},
-std::array<float,2>{0.751478016f, 0.847131729f},
-std::array<float,2>{0.0446495749f, 0.335481614f},
-std::array<float,2>{0.313719898f, 0.74873507f},
-std::array<float,2>{0.521693408f, 0.188483015f},
-std::array<float,2>{0.68395859f, 0.78878957f},
-std::array<float,2>{0.470349342f, 0.285501212f},
-std::array<float,2>{0.238303065f, 0.649659872f},
-std::array<float,2>{0.922452211f, 0.159794107f},
-std::array<float,2>{0.838037968f, 0.593436122f},
-std::array<float,2>{0.089776665f, 0.101073258f},
-std::array<float,2>{0.282659084f, 0.992040753f},
-std::array<float,2>{0.585166156f, 0.443033457f},
-std::array<float,2>{0.554876924f, 0.707150698f},
-std::array<float,2>{0.348239243f, 0.22693634f},
-std::array<float,2>{0.017237531f, 0.815048218f},
-std::array<float,2>{0.804636598f, 0.367103726f},
-std::array<float,2>{0.965067625f, 0.924440384f},
-std::array<float,2>{0.144444957f, 0.390626997f},
-std::array<float,2>{0.377158999f, 0.50590241f},
-std::array<float,2>{0.709230602f, 0.0593657792f},
-std::array<float,2>{0.744692862f, 0.986706376f},
-std::array<float,2>{0.407138258f, 0.440868586f},
-std::array<float,2>{0.175901935f, 0.587359607f},
-std::array<float,2>{0.976990044f, 0.0952844024f},
-std::array<float,2>{0.77847296f, 0.653386354f},
-std::array<float,2>{0.051914975f, 0.160656303f},
-std::array<float,2>{0.338722527f, 0.783811927f},
-std::array<float,2>{0.501352668f, 0.281645834f},
-std::array<float,2>{0.612694144f, 0.500501871f},
-std::array<float,2>{0.276863337f, 0.0552398227f},
-std::array<float,2>{0.110720254f, 0.927804947f},
-std::array<float,2>{0.858772397f, 0.396118581f},
-std::array<float,2>{0.878280938f, 0.816673934f},
-std::array<float,2>{0.214701861f, 0.361834109f},
-std::array<float,2>{0.460817486f, 0.70590663f},
-std::array<float,2>{0.652390003f, 0.231542289f},
-std::array<float,2>{0.540329874f, 0.763509691f},
-std::array<float,2>{0.360161364f, 0.27577728f},
-std::array<float,2>{0.0149735734f, 0.686202347f},
-std::array<float,2>{0.788172126f, 0.126342699f},
-std::array<float,2>{0.946492493f, 0.605686605f},
-std::array<float,2>{0.128439099f, 0.0673059821f},
-std::array<float,2>{0.39233622f, 0.948554158f},
-std::array<float,2>{0.69196856f, 0.489931017f},
-std::array<float,2>{0.668794334f, 0.744243205f},
-std::array<float,2>{0.484559506f, 0.193042606f},
-std::array<float,2>{0.219765589f, 0.848060608f},
-std::array<float,2>{0.919838071f, 0.33068043f},
-std::array<float,2>{0.819138765f, 0.893328309f},
-std::array<float,2>{0.0686201304f, 0.432617426f},
-std::array<float,2>{0.308529317f, 0.558493376f},
-std::array<float,2>{0.563251674f, 0.0265357029f},
-std::array<float,2>{0.586509347f, 0.913775623f},
-std::array<float,2>{0.29494974f, 0.3787615f},
-std::array<float,2>{0.0799148232f, 0.522087097f},
-std::array<float,2>{0.83179909f, 0.041621659f},
-std::array<float,2>{0.935472846f, 0.701650858f},
-std::array<float,2>{0.242827535f, 0.239260808f},
-std::array<float,2>{0.480982363f, 0.834852755f},
-std::array<float,2>{0.678583205f, 0.34845081f},
-std::array<float,2>{0.713637948f, 0.573023736f},
-std::array<float,2>{0.383484125f, 0.116745986f},
-std::array<float,2>{0.150217891f, 0.983036995f},
-std::array<float,2>{0.958353639f, 0.461485714f},
-std::array<float,2>{0.809191346f, 0.800518453f},
-std::array<float,2>{0.0262956321f, 0.308039963f},
-std::array<float,2>{0.356686831f, 0.628676713f},
-std::array<float,2>{0.548036635f, 0.185235336f},
-std::array<float,2>{0.634667814f, 0.862736583f},
-std::array<float,2>{0.439593315f, 0.323638052f},
-std::array<float,2>{0.199633196f, 0.723798573f},
-std::array<float,2>{0.896864891f, 0.2126991f},
-std::array<float,2>{0.870083749f, 0.54056406f},
-std::array<float,2>{0.1065576f, 0.0123296417f},
-std::array<float,2>{0.258658499f, 0.877574265f},
-std::array<float,2>{0.607462108f, 0.408092082f},
-std::array<float,2>{0.530362129f, 0.664945841f},
-std::array<float,2>{0.324713707f, 0.142439008f},
-std::array<float,2>{0.0341655239f, 0.772051871f},
-std::array<float,2>{0.759225726f, 0.264027297f},
-std::array<float,2>{0.992105126f, 0.95765692f},
-std::array<float,2>{0.165260285f, 0.475600809f},
-std::array<float,2>{0.434660763f, 0.614593089f},
-std::array<float,2>{0.719666064f, 0.0924721882f},
-std::array<float,2>{0.681253254f, 0.889689982f},
-std::array<float,2>{0.473700106f, 0.419802815f},
-std::array<float,2>{0.236226156f, 0.53265208f},
-std::array<float,2>{0.92694366f, 0.00103349623f},
-std::array<float,2>{0.840813577f, 0.732690454f},
-std::array<float,2>{0.091160804f, 0.206830218f},
-std::array<float,2>{0.28752178f, 0.874719858f},
-std::array<float,2>{0.581028759f, 0.316243351f},
-std::array<float,2>{0.562141061f, 0.618427277f},
-std::array<float,2>{0.344375521f, 0.0838534236f},
-std::array<float,2>{0.0231973603f, 0.968348742f},
-std::array<float,2>{0.798839629f, 0.478764385f},
-std::array<float,2>{0.962335408f, 0.776645958f},
-std::array<float,2>{0.146810785f, 0.254027873f},
-std::array<float,2>{0.381618857f, 0.658527613f},
-std::array<float,2>{0.705278695f, 0.149877667f},
-std::array<float,2>{0.597367346f, 0.838031352f},
-std::array<float,2>{0.251725763f, 0.354254246f},
-std::array<float,2>{0.0985182971f, 0.692416072f},
-std::array<float,2>{0.866279542f, 0.245030686f},
-std::array<float,2>{0.904757321f, 0.527959943f},
-std::array<float,2>{0.18868801f, 0.0376987122f},
-std::array<float,2>{0.450456232f, 0.915079832f},
-std::array<float,2>{0.628353298f, 0.3851493f},
-std::array<float,2>{0.733591378f, 0.639040589f},
-std::array<float,2>{0.4244093f, 0.177364826f},
-std::array<float,2>{0.160907835f, 0.808538556f},
-std::array<float,2>{0.999075413f, 0.302393377f},
-std::array<float,2>{0.75645858f, 0.96976608f},
-std::array<float,2>{0.0426734276f, 0.454298049f},
-std::array<float,2>{0.319641352f, 0.562992156f},
-std::array<float,2>{0.515865743f, 0.119445056f},
-std::array<float,2>{0.511244714f, 0.939214051f},
-std::array<float,2>{0.328720957f, 0.493256092f},
-std::array<float,2>{0.0594645813f, 0.594238281f},
-std::array<float,2>{0.7684201f, 0.0735261738f},
-std::array<float,2>{0.969131351f, 0.678446174f},
-std::array<float,2>{0.185406193f, 0.139337152f},
-std::array<float,2>{0.420544326f, 0.756927073f},
-std::array<float,2>{0.740460217f, 0.266180873f},
-std::array<float,2>{0.645430326f, 0.551684499f},
-std::array<float,2>{0.465252608f, 0.0163454935f},
-std::array<float,2>{0.205138639f, 0.899793088f},
-std::array<float,2>{0.888719976f, 0.426481098f},
-std::array<float,2>{0.848034859f, 0.853469133f},
-std::array<float,2>{0.119188592f, 0.338448107f},
-std::array<float,2>{0.27207315f, 0.742081761f},
-std::array<float,2>{0.623713791f, 0.202254802f},
-std::array<float,2>{0.699686766f, 0.793870032f},
-std::array<float,2>{0.401358694f, 0.296695292f},
-std::array<float,2>{0.136881813f, 0.645865142f},
-std::array<float,2>{0.943845689f, 0.167148173f},
-std::array<float,2>{0.794873536f, 0.58276403f},
-std::array<float,2>{0.00652371859f, 0.108228207f},
-std::array<float,2>{0.373869151f, 0.99839282f},
-std::array<float,2>{0.532769322f, 0.449639022f},
-std::array<float,2>{0.57588923f, 0.718672812f},
-std::array<float,2>{0.299773663f, 0.220689103f},
-std::array<float,2>{0.0723533332f, 0.823925257f},
-std::array<float,2>{0.82261914f, 0.367674321f},
-std::array<float,2>{0.908871353f, 0.933669984f},
-std::array<float,2>{0.227775335f, 0.401673853f},
-std::array<float,2>{0.499415755f, 0.510823548f},
-std::array<float,2>{0.659131825f, 0.0537225865f},
-std::array<float,2>{0.649690986f, 0.963975728f},
-std::array<float,2>{0.455126762f, 0.482449502f},
-std::array<float,2>{0.218460545f, 0.622024119f},
-std::array<float,2>{0.880729258f, 0.079571709f},
-std::array<float,2>{0.853886008f, 0.66366446f},
-std::array<float,2>{0.116013825f, 0.156086832f},
-std::array<float,2>{0.280956745f, 0.781000316f},
-std::array<float,2>{0.614338517f, 0.253710955f},
-std::array<float,2>{0.505114555f, 0.53777802f},
-std::array<float,2>{0.343194276f, 0.00518550677f},
-std::array<float,2>{0.0500031635f, 0.885305285f},
-std::array<float,2>{0.776453376f, 0.417560428f},
-std::array<float,2>{0.982610941f, 0.867946625f},
-std::array<float,2>{0.173851281f, 0.318433911f},
-std::array<float,2>{0.413154632f, 0.729927659f},
-std::array<float,2>{0.74711448f, 0.209749714f},
-std::array<float,2>{0.569042921f, 0.809969306f},
-std::array<float,2>{0.31094256f, 0.297399908f},
-std::array<float,2>{0.062746115f, 0.636265039f},
-std::array<float,2>{0.815886497f, 0.175157845f},
-std::array<float,2>{0.915177464f, 0.570161045f},
-std::array<float,2>{0.223498911f, 0.12286523f},
-std::array<float,2>{0.488616198f, 0.975595474f},
-std::array<float,2>{0.664670587f, 0.457767099f},
-std::array<float,2>{0.69071126f, 0.688425243f},
-std::array<float,2>{0.396511942f, 0.247994483f},
-std::array<float,2>{0.129532069f, 0.840191662f},
-std::array<float,2>{0.952786267f, 0.358650267f},
-std::array<float,2>{0.783980489f, 0.919687331f},
-std::array<float,2>{0.010551285f, 0.387102276f},
-std::array<float,2>{0.363430351f, 0.526621699f},
-std::array<float,2>{0.544927895f, 0.0335226245f},
-std::array<float,2>{0.553903818f, 0.902760267f},
-std::array<float,2>{0.355034828f, 0.423420101f},
-std::array<float,2>{0.0280139744f, 0.549528301f},
-std::array<float,2>{0.807214797f, 0.0216514748f},
-std::array<float,2>{0.95641607f, 0.735631764f},
-std::array<float,2>{0.155502617f, 0.197424755f},
-std::array<float,2>{0.389989644f, 0.856161773f},
-std::array<float,2>{0.718738437f, 0.340540648f},
-std::array<float,2>{0.67318207f, 0.598437905f},
-std::array<float,2>{0.480212122f, 0.0776510388f},
-std::array<float,2>{0.249729946f, 0.942294896f},
-std::array<float,2>{0.933458149f, 0.498484284f},
-std::array<float,2>{0.834408164f, 0.750960827f},
-std::array<float,2>{0.0821107402f, 0.273433745f},
-std::array<float,2>{0.29043299f, 0.675303936f},
-std::array<float,2>{0.591626465f, 0.135605231f},
-std::array<float,2>{0.72480768f, 0.827753544f},
-std::array<float,2>{0.429872543f, 0.373889416f},
-std::array<float,2>{0.168655992f, 0.714280248f},
-std::array<float,2>{0.984966159f, 0.224731714f},
-std::array<float,2>{0.761965573f, 0.513080001f},
-std::array<float,2>{0.0360714383f, 0.0495456308f},
-std::array<float,2>{0.323152304f, 0.930926442f},
-std::array<float,2>{0.525275946f, 0.404524148f},
-std::array<float,2>{0.601666331f, 0.641046643f},
-std::array<float,2>{0.261899322f, 0.170274034f},
-std::array<float,2>{0.102583788f, 0.790141284f},
-std::array<float,2>{0.872202098f, 0.291686207f},
-std::array<float,2>{0.892860234f, 0.992513418f},
-std::array<float,2>{0.197056711f, 0.445761234f},
-std::array<float,2>{0.44156608f, 0.581717968f},
-std::array<float,2>{0.637589633f, 0.102525167f},
-std::array<float,2>{0.710526228f, 0.922235787f},
-std::array<float,2>{0.378737479f, 0.394427449f},
-std::array<float,2>{0.14345412f, 0.504119873f},
-std::array<float,2>{0.965881288f, 0.0617248416f},
-std::array<float,2>{0.803695619f, 0.709208786f},
-std::array<float,2>{0.0161794946f, 0.229887649f},
-std::array<float,2>{0.349113077f, 0.814124286f},
-std::array<float,2>{0.556163013f, 0.364818096f},
-std::array<float,2>{0.584331155f, 0.590440631f},
-std::array<float,2>{0.282027215f, 0.0981130227f},
-std::array<float,2>{0.0885545835f, 0.988695025f},
-std::array<float,2>{0.839272022f, 0.444141507f},
-std::array<float,2>{0.923046172f, 0.786529183f},
-std::array<float,2>{0.239716798f, 0.287221938f},
-std::array<float,2>{0.469379097f, 0.651603401f},
-std::array<float,2>{0.685425162f, 0.157377928f},
-std::array<float,2>{0.522679925f, 0.844647944f},
-std::array<float,2>{0.313293576f, 0.332265168f},
-std::array<float,2>{0.0434173383f, 0.747886717f},
-std::array<float,2>{0.750689924f, 0.191063151f},
-std::array<float,2>{0.992611945f, 0.558781683f},
-std::array<float,2>{0.158139661f, 0.0281258691f},
-std::array<float,2>{0.427535862f, 0.896265626f},
-std::array<float,2>{0.727901101f, 0.434594601f},
-std::array<float,2>{0.629142523f, 0.681913257f},
-std::array<float,2>{0.448663503f, 0.129299462f},
-std::array<float,2>{0.193312943f, 0.759556115f},
-std::array<float,2>{0.900073469f, 0.280305058f},
-std::array<float,2>{0.860919476f, 0.951772332f},
-std::array<float,2>{0.0940843448f, 0.485454619f},
-std::array<float,2>{0.256471634f, 0.605021715f},
-std::array<float,2>{0.600454271f, 0.0643940791f},
-std::array<float,2>{0.617494345f, 0.976797223f},
-std::array<float,2>{0.266211241f, 0.465061486f},
-std::array<float,2>{0.124532223f, 0.576881945f},
-std::array<float,2>{0.846253216f, 0.109608583f},
-std::array<float,2>{0.886365294f, 0.632602215f},
-std::array<float,2>{0.209556296f, 0.181764737f},
-std::array<float,2>{0.464710295f, 0.804161549f},
-std::array<float,2>{0.643235981f, 0.308811933f},
-std::array<float,2>{0.736799836f, 0.518901467f},
-std::array<float,2>{0.4157269f, 0.0459480882f},
-std::array<float,2>{0.182941332f, 0.907049775f},
-std::array<float,2>{0.972937405f, 0.379900664f},
-std::array<float,2>{0.771455824f, 0.830623567f},
-std::array<float,2>{0.0578980111f, 0.345027864f},
-std::array<float,2>{0.333907187f, 0.698929906f},
-std::array<float,2>{0.51534009f, 0.234559566f},
-std::array<float,2>{0.662560105f, 0.766615689f},
-std::array<float,2>{0.494002968f, 0.260305107f},
-std::array<float,2>{0.231424287f, 0.668336689f},
-std::array<float,2>{0.913554728f, 0.146214947f},
-std::array<float,2>{0.825690746f, 0.61203903f},
-std::array<float,2>{0.0757678077f, 0.0865928009f},
-std::array<float,2>{0.301375121f, 0.954404294f},
-std::array<float,2>{0.570922792f, 0.471885115f},
-std::array<float,2>{0.53755492f, 0.722545266f},
-std::array<float,2>{0.367389649f, 0.215134695f},
-std::array<float,2>{0.0033192609f, 0.864571154f},
-std::array<float,2>{0.791125596f, 0.328102291f},
-std::array<float,2>{0.941087008f, 0.880108297f},
-std::array<float,2>{0.134198144f, 0.413609594f},
-std::array<float,2>{0.404531091f, 0.546692252f},
-std::array<float,2>{0.698067307f, 0.0107513666f},
-std::array<float,2>{0.69453305f, 0.945333719f},
-std::array<float,2>{0.394284725f, 0.490968645f},
-std::array<float,2>{0.125726998f, 0.607725501f},
-std::array<float,2>{0.948780119f, 0.0687353238f},
-std::array<float,2>{0.786821604f, 0.684064627f},
-std::array<float,2>{0.0132462475f, 0.127833635f},
-std::array<float,2>{0.362227708f, 0.76461935f},
-std::array<float,2>{0.5413782f, 0.274932921f},
-std::array<float,2>{0.565716982f, 0.555258393f},
-std::array<float,2>{0.305636913f, 0.0238989666f},
-std::array<float,2>{0.0666530728f, 0.891337514f},
-std::array<float,2>{0.817635059f, 0.431619048f},
-std::array<float,2>{0.921830297f, 0.851269007f},
-std::array<float,2>{0.221733719f, 0.328975409f},
-std::array<float,2>{0.486944288f, 0.743879378f},
-std::array<float,2>{0.671212316f, 0.194681063f},
-std::array<float,2>{0.503574371f, 0.781322956f},
-std::array<float,2>{0.336254954f, 0.283598244f},
-std::array<float,2>{0.0540992692f, 0.655134857f},
-std::array<float,2>{0.779337764f, 0.163594857f},
-std::array<float,2>{0.979510427f, 0.58799535f},
-std::array<float,2>{0.178798407f, 0.0969609767f},
-std::array<float,2>{0.408347934f, 0.98488009f},
-std::array<float,2>{0.743559241f, 0.439004719f},
-std::array<float,2>{0.656039059f, 0.703892708f},
-std::array<float,2>{0.458596796f, 0.232739165f},
-std::array<float,2>{0.211905882f, 0.819086432f},
-std::array<float,2>{0.876799524f, 0.360498369f},
-std::array<float,2>{0.856816947f, 0.926820755f},
-std::array<float,2>{0.112484381f, 0.398229361f},
-std::array<float,2>{0.273765534f, 0.503417253f},
-std::array<float,2>{0.610124707f, 0.0566466711f},
-std::array<float,2>{0.606145799f, 0.876050174f},
-std::array<float,2>{0.26015237f, 0.408879787f},
-std::array<float,2>{0.108120427f, 0.542938292f},
-std::array<float,2>{0.868909478f, 0.0154660372f},
-std::array<float,2>{0.895506144f, 0.725859344f},
-std::array<float,2>{0.201874301f, 0.214838088f},
-std::array<float,2>{0.439399838f, 0.859440029f},
-std::array<float,2>{0.636156738f, 0.320409775f},
-std::array<float,2>{0.722311854f, 0.615275443f},
-std::array<float,2>{0.43734479f, 0.0903230086f},
-std::array<float,2>{0.16623579f, 0.959828615f},
-std::array<float,2>{0.99022603f, 0.47285828f},
-std::array<float,2>{0.760501266f, 0.769650459f},
-std::array<float,2>{0.0316185839f, 0.263140321f},
-std::array<float,2>{0.326705903f, 0.66792351f},
-std::array<float,2>{0.528259218f, 0.144196555f},
-std::array<float,2>{0.677030861f, 0.833803833f},
-std::array<float,2>{0.483064264f, 0.350490719f},
-std::array<float,2>{0.244614318f, 0.700249135f},
-std::array<float,2>{0.93661797f, 0.240901127f},
-std::array<float,2>{0.828476608f, 0.520283103f},
-std::array<float,2>{0.0808719844f, 0.0408978947f},
-std::array<float,2>{0.293106496f, 0.911001921f},
-std::array<float,2>{0.588856339f, 0.376810074f},
-std::array<float,2>{0.550001681f, 0.625569701f},
-std::array<float,2>{0.357879162f, 0.185993224f},
-std::array<float,2>{0.0245224237f, 0.797492921f},
-std::array<float,2>{0.811805904f, 0.304688871f},
-std::array<float,2>{0.960250378f, 0.981161535f},
-std::array<float,2>{0.150549769f, 0.463079005f},
-std::array<float,2>{0.386023194f, 0.571752191f},
-std::array<float,2>{0.712200105f, 0.114253439f},
-std::array<float,2>{0.626102746f, 0.917410076f},
-std::array<float,2>{0.451786011f, 0.383178264f},
-std::array<float,2>{0.190349132f, 0.529298961f},
-std::array<float,2>{0.903978765f, 0.0365775414f},
-std::array<float,2>{0.863433003f, 0.694640994f},
-std::array<float,2>{0.100708194f, 0.243854538f},
-std::array<float,2>{0.253220677f, 0.836190164f},
-std::array<float,2>{0.595302999f, 0.352646559f},
-std::array<float,2>{0.51778537f, 0.564698935f},
-std::array<float,2>{0.317831337f, 0.118316658f},
-std::array<float,2>{0.0406270586f, 0.97132796f},
-std::array<float,2>{0.754022479f, 0.456304491f},
-std::array<float,2>{0.996314585f, 0.804855287f},
-std::array<float,2>{0.163394079f, 0.304269642f},
-std::array<float,2>{0.422364324f, 0.636979938f},
-std::array<float,2>{0.73067826f, 0.179028139f},
-std::array<float,2>{0.579302013f, 0.871363103f},
-std::array<float,2>{0.286683381f, 0.312954843f},
-std::array<float,2>{0.0935520232f, 0.732193828f},
-std::array<float,2>{0.84285903f, 0.204273418f},
-std::array<float,2>{0.929470718f, 0.534030378f},
-std::array<float,2>{0.2375402f, 0.00304842461f},
-std::array<float,2>{0.474871874f, 0.88813597f},
-std::array<float,2>{0.682300627f, 0.421757132f},
-std::array<float,2>{0.704030871f, 0.657911777f},
-std::array<float,2>{0.380523652f, 0.150603041f},
-std::array<float,2>{0.146192774f, 0.774825633f},
-std::array<float,2>{0.964006543f, 0.257747859f},
-std::array<float,2>{0.798634887f, 0.965841949f},
-std::array<float,2>{0.0195708238f, 0.478045881f},
-std::array<float,2>{0.346906126f, 0.619199336f},
-std::array<float,2>{0.559031785f, 0.0846050456f},
-std::array<float,2>{0.534656942f, 0.997077644f},
-std::array<float,2>{0.371885806f, 0.452421844f},
-std::array<float,2>{0.00505318167f, 0.584451437f},
-std::array<float,2>{0.795888305f, 0.107160494f},
-std::array<float,2>{0.94186312f, 0.648154974f},
-std::array<float,2>{0.139598072f, 0.165439129f},
-std::array<float,2>{0.399102539f, 0.794957757f},
-std::array<float,2>{0.701431513f, 0.294597179f},
-std::array<float,2>{0.656260788f, 0.508165956f},
-std::array<float,2>{0.496322632f, 0.0527046695f},
-std::array<float,2>{0.228637144f, 0.93578434f},
-std::array<float,2>{0.90667671f, 0.399369806f},
-std::array<float,2>{0.820705235f, 0.820702612f},
-std::array<float,2>{0.0703783184f, 0.369600207f},
-std::array<float,2>{0.298355967f, 0.716056466f},
-std::array<float,2>{0.577573776f, 0.222268403f},
-std::array<float,2>{0.740139663f, 0.754506588f},
-std::array<float,2>{0.418376446f, 0.268852293f},
-std::array<float,2>{0.186581373f, 0.677013099f},
-std::array<float,2>{0.971554279f, 0.136780351f},
-std::array<float,2>{0.767172337f, 0.596544445f},
-std::array<float,2>{0.0619880855f, 0.0718541145f},
-std::array<float,2>{0.331479847f, 0.939697564f},
-std::array<float,2>{0.509486854f, 0.494318068f},
-std::array<float,2>{0.621508837f, 0.738374293f},
-std::array<float,2>{0.271041423f, 0.200932473f},
-std::array<float,2>{0.118421093f, 0.855392396f},
-std::array<float,2>{0.849749267f, 0.336889148f},
-std::array<float,2>{0.887523592f, 0.900593758f},
-std::array<float,2>{0.203126401f, 0.42890355f},
-std::array<float,2>{0.468719125f, 0.554482996f},
-std::array<float,2>{0.647662163f, 0.0177299678f},
-std::array<float,2>{0.666927814f, 0.973362029f},
-std::array<float,2>{0.491281688f, 0.459963083f},
-std::array<float,2>{0.225976154f, 0.567146719f},
-std::array<float,2>{0.917775452f, 0.123774171f},
-std::array<float,2>{0.814065576f, 0.633043408f},
-std::array<float,2>{0.0650383532f, 0.172924429f},
-std::array<float,2>{0.308693618f, 0.811846018f},
-std::array<float,2>{0.568269193f, 0.299532205f},
-std::array<float,2>{0.544004738f, 0.52498132f},
-std::array<float,2>{0.365412444f, 0.0327911191f},
-std::array<float,2>{0.00968133286f, 0.920293093f},
-std::array<float,2>{0.78226465f, 0.390253603f},
-std::array<float,2>{0.950461745f, 0.84322089f},
-std::array<float,2>{0.132286504f, 0.357091844f},
-std::array<float,2>{0.395846695f, 0.690848231f},
-std::array<float,2>{0.687743664f, 0.24892801f},
-std::array<float,2>{0.615911424f, 0.778599322f},
-std::array<float,2>{0.277991623f, 0.250001252f},
-std::array<float,2>{0.113668233f, 0.661182404f},
-std::array<float,2>{0.853001773f, 0.152570739f},
-std::array<float,2>{0.881518126f, 0.623071671f},
-std::array<float,2>{0.215770662f, 0.0817167535f},
-std::array<float,2>{0.454924375f, 0.961126328f},
-std::array<float,2>{0.651592672f, 0.482128918f},
-std::array<float,2>{0.74984026f, 0.728141904f},
-std::array<float,2>{0.410268337f, 0.208197996f},
-std::array<float,2>{0.172201753f, 0.870043695f},
-std::array<float,2>{0.982175648f, 0.317876726f},
-std::array<float,2>{0.773452759f, 0.884467661f},
-std::array<float,2>{0.0487598255f, 0.414848536f},
-std::array<float,2>{0.34066686f, 0.535766125f},
-std::array<float,2>{0.506772339f, 0.00780387921f},
-std::array<float,2>{0.526309848f, 0.932508767f},
-std::array<float,2>{0.320490181f, 0.40315187f},
-std::array<float,2>{0.0380830839f, 0.514928997f},
-std::array<float,2>{0.764198124f, 0.0485009216f},
-std::array<float,2>{0.98735553f, 0.711858749f},
-std::array<float,2>{0.170818463f, 0.224189505f},
-std::array<float,2>{0.432378799f, 0.825491667f},
-std::array<float,2>{0.723768413f, 0.372458607f},
-std::array<float,2>{0.639351666f, 0.578759074f},
-std::array<float,2>{0.443396389f, 0.104552351f},
-std::array<float,2>{0.198888585f, 0.994900286f},
-std::array<float,2>{0.891217709f, 0.44827646f},
-std::array<float,2>{0.874476612f, 0.791882992f},
-std::array<float,2>{0.105204292f, 0.290576279f},
-std::array<float,2>{0.263765305f, 0.644169927f},
-std::array<float,2>{0.60544467f, 0.16943717f},
-std::array<float,2>{0.716483712f, 0.857518375f},
-std::array<float,2>{0.388199419f, 0.343737185f},
-std::array<float,2>{0.153804898f, 0.737259805f},
-std::array<float,2>{0.954374135f, 0.196379855f},
-std::array<float,2>{0.806263745f, 0.547597051f},
-std::array<float,2>{0.0300473087f, 0.0204871073f},
-std::array<float,2>{0.352729499f, 0.905766129f},
-std::array<float,2>{0.551672339f, 0.424246639f},
-std::array<float,2>{0.592369914f, 0.673318207f},
-std::array<float,2>{0.291693032f, 0.133938134f},
-std::array<float,2>{0.0840224549f, 0.753117323f},
-std::array<float,2>{0.833865523f, 0.270938724f},
-std::array<float,2>{0.929860592f, 0.945186198f},
-std::array<float,2>{0.246560127f, 0.497665733f},
-std::array<float,2>{0.478102297f, 0.600001693f},
-std::array<float,2>{0.674006462f, 0.0748883486f},
-std::array<float,2>{0.730072081f, 0.897169828f},
-std::array<float,2>{0.428232402f, 0.435854465f},
-std::array<float,2>{0.159157738f, 0.562084913f},
-std::array<float,2>{0.99431771f, 0.0302678775f},
-std::array<float,2>{0.752512515f, 0.749750257f},
-std::array<float,2>{0.0451943278f, 0.187609822f},
-std::array<float,2>{0.314788908f, 0.846003592f},
-std::array<float,2>{0.520053804f, 0.334555984f},
-std::array<float,2>{0.598162293f, 0.602522016f},
-std::array<float,2>{0.255702317f, 0.0656431243f},
-std::array<float,2>{0.0959105939f, 0.950080156f},
-std::array<float,2>{0.863141f, 0.488024622f},
-std::array<float,2>{0.902337968f, 0.761416316f},
-std::array<float,2>{0.194601327f, 0.278905839f},
-std::array<float,2>{0.445648044f, 0.680433989f},
-std::array<float,2>{0.63111192f, 0.131369933f},
-std::array<float,2>{0.556886733f, 0.815446198f},
-std::array<float,2>{0.350640267f, 0.365950316f},
-std::array<float,2>{0.0180026218f, 0.70857954f},
-std::array<float,2>{0.801162541f, 0.227958605f},
-std::array<float,2>{0.967869818f, 0.507292688f},
-std::array<float,2>{0.141774774f, 0.0598555729f},
-std::array<float,2>{0.375077456f, 0.925207376f},
-std::array<float,2>{0.707896411f, 0.392078102f},
-std::array<float,2>{0.685869932f, 0.648909569f},
-std::array<float,2>{0.470930606f, 0.158346549f},
-std::array<float,2>{0.240719274f, 0.78791374f},
-std::array<float,2>{0.924729466f, 0.286487728f},
-std::array<float,2>{0.836004853f, 0.990942955f},
-std::array<float,2>{0.0859898552f, 0.441619396f},
-std::array<float,2>{0.283496201f, 0.592672467f},
-std::array<float,2>{0.583351552f, 0.100284874f},
-std::array<float,2>{0.574105859f, 0.955287695f},
-std::array<float,2>{0.303227484f, 0.470331252f},
-std::array<float,2>{0.0762013569f, 0.61110276f},
-std::array<float,2>{0.826188266f, 0.0892719552f},
-std::array<float,2>{0.91062957f, 0.671280146f},
-std::array<float,2>{0.232719451f, 0.147441819f},
-std::array<float,2>{0.494829953f, 0.767731965f},
-std::array<float,2>{0.660796344f, 0.258202434f},
-std::array<float,2>{0.696008563f, 0.544444501f},
-std::array<float,2>{0.40285939f, 0.00813150592f},
-std::array<float,2>{0.134940356f, 0.882268131f},
-std::array<float,2>{0.9394238f, 0.410522342f},
-std::array<float,2>{0.789471447f, 0.866740584f},
-std::array<float,2>{0.00179982244f, 0.325461209f},
-std::array<float,2>{0.370625615f, 0.718808293f},
-std::array<float,2>{0.535965264f, 0.217367232f},
-std::array<float,2>{0.640974343f, 0.801728904f},
-std::array<float,2>{0.462126344f, 0.31085518f},
-std::array<float,2>{0.208257884f, 0.629008651f},
-std::array<float,2>{0.883521676f, 0.181267589f},
-std::array<float,2>{0.845558167f, 0.574311852f},
-std::array<float,2>{0.122217119f, 0.111438103f},
-std::array<float,2>{0.269108415f, 0.980090141f},
-std::array<float,2>{0.619510233f, 0.468426019f},
-std::array<float,2>{0.512593269f, 0.69676441f},
-std::array<float,2>{0.335537702f, 0.23731105f},
-std::array<float,2>{0.0563019551f, 0.829680026f},
-std::array<float,2>{0.771858335f, 0.346912354f},
-std::array<float,2>{0.975029826f, 0.910137713f},
-std::array<float,2>{0.180535629f, 0.382722944f},
-std::array<float,2>{0.416893035f, 0.516768515f},
-std::array<float,2>{0.735465944f, 0.0435254537f},
-std::array<float,2>{0.708333433f, 0.98848474f},
-std::array<float,2>{0.376657039f, 0.443878949f},
-std::array<float,2>{0.141283885f, 0.590755463f},
-std::array<float,2>{0.967747211f, 0.0978969187f},
-std::array<float,2>{0.802704632f, 0.651652575f},
-std::array<float,2>{0.0193825159f, 0.157676563f},
-std::array<float,2>{0.350337863f, 0.786162615f},
-std::array<float,2>{0.558332801f, 0.28738308f},
-std::array<float,2>{0.582042575f, 0.504173458f},
-std::array<float,2>{0.284771025f, 0.0619129613f},
-std::array<float,2>{0.087625511f, 0.92198813f},
-std::array<float,2>{0.837852776f, 0.394059956f},
-std::array<float,2>{0.925109386f, 0.814306974f},
-std::array<float,2>{0.242134675f, 0.36504212f},
-std::array<float,2>{0.472196549f, 0.709312975f},
-std::array<float,2>{0.68673712f, 0.229596287f},
-std::array<float,2>{0.520975232f, 0.759477317f},
-std::array<float,2>{0.316244602f, 0.280605823f},
-std::array<float,2>{0.0465911776f, 0.681656599f},
-std::array<float,2>{0.753252923f, 0.129015625f},
-std::array<float,2>{0.995962381f, 0.605359912f},
-std::array<float,2>{0.159186423f, 0.0641788691f},
-std::array<float,2>{0.42956236f, 0.952010572f},
-std::array<float,2>{0.72862798f, 0.485767096f},
-std::array<float,2>{0.632092655f, 0.747657239f},
-std::array<float,2>{0.447241634f, 0.191291153f},
-std::array<float,2>{0.193533435f, 0.844253421f},
-std::array<float,2>{0.901126683f, 0.332282454f},
-std::array<float,2>{0.862045288f, 0.896080315f},
-std::array<float,2>{0.0969055593f, 0.435025215f},
-std::array<float,2>{0.254215807f, 0.558906674f},
-std::array<float,2>{0.59910816f, 0.0278346743f},
-std::array<float,2>{0.620588243f, 0.90688324f},
-std::array<float,2>{0.267996073f, 0.380254865f},
-std::array<float,2>{0.121584207f, 0.518690109f},
-std::array<float,2>{0.844648421f, 0.0463566743f},
-std::array<float,2>{0.88460958f, 0.699106991f},
-std::array<float,2>{0.207457557f, 0.234851673f},
-std::array<float,2>{0.461285233f, 0.831049144f},
-std::array<float,2>{0.64245832f, 0.344952554f},
-std::array<float,2>{0.735022783f, 0.576990724f},
-std::array<float,2>{0.417586118f, 0.109632634f},
-std::array<float,2>{0.180864185f, 0.977000415f},
-std::array<float,2>{0.975855947f, 0.465314418f},
-std::array<float,2>{0.772911131f, 0.803796649f},
-std::array<float,2>{0.0550200269f, 0.308951646f},
-std::array<float,2>{0.334902287f, 0.632451653f},
-std::array<float,2>{0.512762725f, 0.182067886f},
-std::array<float,2>{0.661831498f, 0.864370227f},
-std::array<float,2>{0.495780706f, 0.327756435f},
-std::array<float,2>{0.234137997f, 0.722354174f},
-std::array<float,2>{0.911141157f, 0.214846149f},
-std::array<float,2>{0.827644408f, 0.546584547f},
-std::array<float,2>{0.0780355483f, 0.0110540828f},
-std::array<float,2>{0.304038793f, 0.880262136f},
-std::array<float,2>{0.572370529f, 0.413883239f},
-std::array<float,2>{0.536938548f, 0.668019056f},
-std::array<float,2>{0.370019346f, 0.146398515f},
-std::array<float,2>{0.000352064177f, 0.766864777f},
-std::array<float,2>{0.790293872f, 0.260564476f},
-std::array<float,2>{0.938024521f, 0.954285264f},
-std::array<float,2>{0.135898903f, 0.472054332f},
-std::array<float,2>{0.403715819f, 0.612092137f},
-std::array<float,2>{0.697004259f, 0.0867201537f},
-std::array<float,2>{0.650733411f, 0.88568449f},
-std::array<float,2>{0.453409314f, 0.417810202f},
-std::array<float,2>{0.216088325f, 0.538037062f},
-std::array<float,2>{0.882787824f, 0.00503432099f},
-std::array<float,2>{0.852330983f, 0.729497373f},
-std::array<float,2>{0.115122214f, 0.209589437f},
-std::array<float,2>{0.279142499f, 0.86767596f},
-std::array<float,2>{0.616348386f, 0.318744868f},
-std::array<float,2>{0.507599711f, 0.62173748f},
-std::array<float,2>{0.340866417f, 0.0791161656f},
-std::array<float,2>{0.0474292971f, 0.964121699f},
-std::array<float,2>{0.774718285f, 0.482753605f},
-std::array<float,2>{0.98088038f, 0.781231701f},
-std::array<float,2>{0.173108831f, 0.253456354f},
-std::array<float,2>{0.411430866f, 0.663886487f},
-std::array<float,2>{0.748988986f, 0.155945405f},
-std::array<float,2>{0.566837072f, 0.839913726f},
-std::array<float,2>{0.310097814f, 0.358519256f},
-std::array<float,2>{0.0655671954f, 0.688126147f},
-std::array<float,2>{0.813065708f, 0.247663751f},
-std::array<float,2>{0.916426778f, 0.526482344f},
-std::array<float,2>{0.22535722f, 0.0333199427f},
-std::array<float,2>{0.490669161f, 0.9196015f},
-std::array<float,2>{0.667811155f, 0.386749893f},
-std::array<float,2>{0.689192355f, 0.636671901f},
-std::array<float,2>{0.395160854f, 0.174892783f},
-std::array<float,2>{0.131205559f, 0.809695065f},
-std::array<float,2>{0.949939609f, 0.297707498f},
-std::array<float,2>{0.781912446f, 0.975924075f},
-std::array<float,2>{0.00832329597f, 0.457759023f},
-std::array<float,2>{0.366606653f, 0.569951534f},
-std::array<float,2>{0.543105483f, 0.122734733f},
-std::array<float,2>{0.55196768f, 0.941964447f},
-std::array<float,2>{0.352427274f, 0.498258889f},
-std::array<float,2>{0.0311022829f, 0.598333061f},
-std::array<float,2>{0.804855108f, 0.0780927762f},
-std::array<float,2>{0.953273475f, 0.675611556f},
-std::array<float,2>{0.152432501f, 0.135303482f},
-std::array<float,2>{0.387544632f, 0.750576794f},
-std::array<float,2>{0.714950979f, 0.273180872f},
-std::array<float,2>{0.674929559f, 0.549633563f},
-std::array<float,2>{0.476807743f, 0.0217820387f},
-std::array<float,2>{0.248029277f, 0.902523458f},
-std::array<float,2>{0.931457043f, 0.423779935f},
-std::array<float,2>{0.832349718f, 0.856415689f},
-std::array<float,2>{0.0857054591f, 0.340801001f},
-std::array<float,2>{0.292866439f, 0.735547006f},
-std::array<float,2>{0.593555868f, 0.197635308f},
-std::array<float,2>{0.722801566f, 0.790391803f},
-std::array<float,2>{0.433127612f, 0.291820765f},
-std::array<float,2>{0.170902103f, 0.640770912f},
-std::array<float,2>{0.986841977f, 0.16993697f},
-std::array<float,2>{0.765391648f, 0.581905305f},
-std::array<float,2>{0.0383095294f, 0.102158107f},
-std::array<float,2>{0.321436226f, 0.9922809f},
-std::array<float,2>{0.526547313f, 0.445529759f},
-std::array<float,2>{0.60431087f, 0.713937163f},
-std::array<float,2>{0.265583158f, 0.224900082f},
-std::array<float,2>{0.103571981f, 0.828011096f},
-std::array<float,2>{0.873166621f, 0.373745084f},
-std::array<float,2>{0.892452538f, 0.930715203f},
-std::array<float,2>{0.19747664f, 0.404755205f},
-std::array<float,2>{0.445215821f, 0.512875438f},
-std::array<float,2>{0.640251458f, 0.0495964065f},
-std::array<float,2>{0.683422089f, 0.968660235f},
-std::array<float,2>{0.476195306f, 0.478575498f},
-std::array<float,2>{0.237133414f, 0.618217289f},
-std::array<float,2>{0.928423822f, 0.083680965f},
-std::array<float,2>{0.841839194f, 0.658350408f},
-std::array<float,2>{0.0925106481f, 0.149586454f},
-std::array<float,2>{0.286128551f, 0.776432753f},
-std::array<float,2>{0.578365743f, 0.254195124f},
-std::array<float,2>{0.559592545f, 0.532327235f},
-std::array<float,2>{0.346224189f, 0.00139356626f},
-std::array<float,2>{0.0213700887f, 0.889911354f},
-std::array<float,2>{0.797116458f, 0.419533998f},
-std::array<float,2>{0.963798285f, 0.874912977f},
-std::array<float,2>{0.144550487f, 0.315934509f},
-std::array<float,2>{0.379388034f, 0.732493818f},
-std::array<float,2>{0.70424372f, 0.206579462f},
-std::array<float,2>{0.594007969f, 0.808160126f},
-std::array<float,2>{0.252063632f, 0.302720636f},
-std::array<float,2>{0.100131527f, 0.638818026f},
-std::array<float,2>{0.864958107f, 0.177673191f},
-std::array<float,2>{0.903045118f, 0.563453496f},
-std::array<float,2>{0.19128193f, 0.119200572f},
-std::array<float,2>{0.452478617f, 0.970205128f},
-std::array<float,2>{0.625124514f, 0.454577476f},
-std::array<float,2>{0.731952548f, 0.69284153f},
-std::array<float,2>{0.423449695f, 0.244840264f},
-std::array<float,2>{0.162442967f, 0.838267505f},
-std::array<float,2>{0.997618496f, 0.354164451f},
-std::array<float,2>{0.755227745f, 0.915432274f},
-std::array<float,2>{0.0397453271f, 0.384895325f},
-std::array<float,2>{0.316716373f, 0.528189778f},
-std::array<float,2>{0.518644571f, 0.0380166471f},
-std::array<float,2>{0.508722425f, 0.899533153f},
-std::array<float,2>{0.330181658f, 0.426646292f},
-std::array<float,2>{0.061190974f, 0.551445186f},
-std::array<float,2>{0.76586622f, 0.0165067539f},
-std::array<float,2>{0.97248888f, 0.74172169f},
-std::array<float,2>{0.186151221f, 0.202483982f},
-std::array<float,2>{0.418950617f, 0.853204727f},
-std::array<float,2>{0.738459408f, 0.338813871f},
-std::array<float,2>{0.647020161f, 0.594571352f},
-std::array<float,2>{0.467266679f, 0.0733496174f},
-std::array<float,2>{0.204268783f, 0.939145505f},
-std::array<float,2>{0.888213694f, 0.493540525f},
-std::array<float,2>{0.850883245f, 0.757275879f},
-std::array<float,2>{0.117646314f, 0.266510695f},
-std::array<float,2>{0.269711971f, 0.678637803f},
-std::array<float,2>{0.622996926f, 0.139463067f},
-std::array<float,2>{0.702934265f, 0.82412076f},
-std::array<float,2>{0.399521083f, 0.367218345f},
-std::array<float,2>{0.139765531f, 0.718406498f},
-std::array<float,2>{0.942767084f, 0.220444128f},
-std::array<float,2>{0.796375513f, 0.51110065f},
-std::array<float,2>{0.00396474497f, 0.0540415458f},
-std::array<float,2>{0.372099936f, 0.934027553f},
-std::array<float,2>{0.53335911f, 0.401515454f},
-std::array<float,2>{0.576260209f, 0.645631611f},
-std::array<float,2>{0.297719479f, 0.167270288f},
-std::array<float,2>{0.0715409294f, 0.793566704f},
-std::array<float,2>{0.821730375f, 0.296578169f},
-std::array<float,2>{0.907775998f, 0.998208284f},
-std::array<float,2>{0.229700997f, 0.449373275f},
-std::array<float,2>{0.497328281f, 0.582702696f},
-std::array<float,2>{0.657999396f, 0.107947499f},
-std::array<float,2>{0.742357552f, 0.928102612f},
-std::array<float,2>{0.409321696f, 0.396437496f},
-std::array<float,2>{0.177830264f, 0.500899553f},
-std::array<float,2>{0.9789536f, 0.0556534044f},
-std::array<float,2>{0.780959547f, 0.705754638f},
-std::array<float,2>{0.0532638244f, 0.231810674f},
-std::array<float,2>{0.337590009f, 0.816540241f},
-std::array<float,2>{0.502684414f, 0.362142533f},
-std::array<float,2>{0.611272037f, 0.587037504f},
-std::array<float,2>{0.275274158f, 0.0956286266f},
-std::array<float,2>{0.112255894f, 0.98640728f},
-std::array<float,2>{0.855568767f, 0.440586805f},
-std::array<float,2>{0.875928819f, 0.783942342f},
-std::array<float,2>{0.212881327f, 0.281404108f},
-std::array<float,2>{0.457484543f, 0.653730512f},
-std::array<float,2>{0.655152321f, 0.160926998f},
-std::array<float,2>{0.542368054f, 0.84788698f},
-std::array<float,2>{0.363115579f, 0.330965132f},
-std::array<float,2>{0.0125124753f, 0.74451679f},
-std::array<float,2>{0.785805404f, 0.193130225f},
-std::array<float,2>{0.947660208f, 0.558142066f},
-std::array<float,2>{0.126413658f, 0.0266593322f},
-std::array<float,2>{0.39314878f, 0.89309454f},
-std::array<float,2>{0.693937182f, 0.432956725f},
-std::array<float,2>{0.670735538f, 0.686487615f},
-std::array<float,2>{0.487710744f, 0.126166537f},
-std::array<float,2>{0.220969334f, 0.763248742f},
-std::array<float,2>{0.920290887f, 0.275477022f},
-std::array<float,2>{0.816854894f, 0.94830066f},
-std::array<float,2>{0.0683424994f, 0.490033567f},
-std::array<float,2>{0.306223065f, 0.605905533f},
-std::array<float,2>{0.565108597f, 0.0669707879f},
-std::array<float,2>{0.588992417f, 0.983159542f},
-std::array<float,2>{0.294409961f, 0.461896867f},
-std::array<float,2>{0.0819428489f, 0.572900355f},
-std::array<float,2>{0.82957083f, 0.117029876f},
-std::array<float,2>{0.936446249f, 0.628492534f},
-std::array<float,2>{0.245890215f, 0.185530216f},
-std::array<float,2>{0.483610392f, 0.800688386f},
-std::array<float,2>{0.676727295f, 0.307747006f},
-std::array<float,2>{0.7114622f, 0.522435308f},
-std::array<float,2>{0.385149181f, 0.0417855605f},
-std::array<float,2>{0.152005464f, 0.914029062f},
-std::array<float,2>{0.959455431f, 0.378623843f},
-std::array<float,2>{0.811250091f, 0.834627688f},
-std::array<float,2>{0.023606075f, 0.348295838f},
-std::array<float,2>{0.359264433f, 0.701224566f},
-std::array<float,2>{0.548840702f, 0.239636809f},
-std::array<float,2>{0.635001242f, 0.772455633f},
-std::array<float,2>{0.437610149f, 0.263791651f},
-std::array<float,2>{0.202195704f, 0.664763749f},
-std::array<float,2>{0.895554125f, 0.142300665f},
-std::array<float,2>{0.867539704f, 0.614457309f},
-std::array<float,2>{0.108984768f, 0.0925570726f},
-std::array<float,2>{0.261003375f, 0.957767665f},
-std::array<float,2>{0.607169807f, 0.476011097f},
-std::array<float,2>{0.529240549f, 0.724047959f},
-std::array<float,2>{0.328124255f, 0.212573558f},
-std::array<float,2>{0.0327052549f, 0.86251539f},
-std::array<float,2>{0.761286497f, 0.323445082f},
-std::array<float,2>{0.989202619f, 0.877914131f},
-std::array<float,2>{0.167073667f, 0.40777424f},
-std::array<float,2>{0.435620397f, 0.540815592f},
-std::array<float,2>{0.720887423f, 0.0126264654f},
-std::array<float,2>{0.727474868f, 0.949769378f},
-std::array<float,2>{0.426704496f, 0.488264382f},
-std::array<float,2>{0.157000706f, 0.602228105f},
-std::array<float,2>{0.993885219f, 0.0658364743f},
-std::array<float,2>{0.751048505f, 0.680186212f},
-std::array<float,2>{0.0439604148f, 0.131803498f},
-std::array<float,2>{0.314339846f, 0.761635423f},
-std::array<float,2>{0.521988511f, 0.279229552f},
-std::array<float,2>{0.601307273f, 0.562398434f},
-std::array<float,2>{0.257312119f, 0.0300202612f},
-std::array<float,2>{0.0952492654f, 0.897341728f},
-std::array<float,2>{0.860105276f, 0.43565765f},
-std::array<float,2>{0.89887315f, 0.845813751f},
-std::array<float,2>{0.192000717f, 0.3349576f},
-std::array<float,2>{0.447904378f, 0.749767244f},
-std::array<float,2>{0.6305511f, 0.187891364f},
-std::array<float,2>{0.555658579f, 0.78783834f},
-std::array<float,2>{0.347673923f, 0.286259949f},
-std::array<float,2>{0.0170223359f, 0.648614526f},
-std::array<float,2>{0.804019034f, 0.158634633f},
-std::array<float,2>{0.965400755f, 0.592386961f},
-std::array<float,2>{0.143674821f, 0.100491315f},
-std::array<float,2>{0.377805173f, 0.991090536f},
-std::array<float,2>{0.70964551f, 0.441877097f},
-std::array<float,2>{0.684534431f, 0.70880115f},
-std::array<float,2>{0.470180869f, 0.227682486f},
-std::array<float,2>{0.239242077f, 0.815871835f},
-std::array<float,2>{0.922322273f, 0.3659738f},
-std::array<float,2>{0.838594496f, 0.924990475f},
-std::array<float,2>{0.0888845101f, 0.391842753f},
-std::array<float,2>{0.282804698f, 0.506865263f},
-std::array<float,2>{0.585925281f, 0.0596273467f},
-std::array<float,2>{0.571692824f, 0.882073522f},
-std::array<float,2>{0.301790684f, 0.410309404f},
-std::array<float,2>{0.0750410855f, 0.544885457f},
-std::array<float,2>{0.825030088f, 0.00781377964f},
-std::array<float,2>{0.912985206f, 0.719019175f},
-std::array<float,2>{0.23201409f, 0.217577532f},
-std::array<float,2>{0.492716253f, 0.867121041f},
-std::array<float,2>{0.663847506f, 0.325302333f},
-std::array<float,2>{0.699139297f, 0.61103636f},
-std::array<float,2>{0.405366033f, 0.0889933109f},
-std::array<float,2>{0.133206338f, 0.955391109f},
-std::array<float,2>{0.940395772f, 0.470567644f},
-std::array<float,2>{0.792885959f, 0.767910242f},
-std::array<float,2>{0.00216001342f, 0.257983387f},
-std::array<float,2>{0.369031608f, 0.670930922f},
-std::array<float,2>{0.538845778f, 0.147098228f},
-std::array<float,2>{0.643831968f, 0.829955161f},
-std::array<float,2>{0.463073075f, 0.34713304f},
-std::array<float,2>{0.210150421f, 0.69636941f},
-std::array<float,2>{0.885684907f, 0.237674803f},
-std::array<float,2>{0.847284853f, 0.517080367f},
-std::array<float,2>{0.123335794f, 0.0439144969f},
-std::array<float,2>{0.266855121f, 0.909798682f},
-std::array<float,2>{0.619129121f, 0.382545173f},
-std::array<float,2>{0.5140782f, 0.629295528f},
-std::array<float,2>{0.332627922f, 0.181573778f},
-std::array<float,2>{0.0566706322f, 0.801406264f},
-std::array<float,2>{0.769904613f, 0.310697347f},
-std::array<float,2>{0.974142671f, 0.98032403f},
-std::array<float,2>{0.18218188f, 0.468560934f},
-std::array<float,2>{0.414065778f, 0.574491441f},
-std::array<float,2>{0.738089383f, 0.111777462f},
-std::array<float,2>{0.665507913f, 0.919971824f},
-std::array<float,2>{0.489482015f, 0.390497357f},
-std::array<float,2>{0.223735407f, 0.52538234f},
-std::array<float,2>{0.914748192f, 0.0331306048f},
-std::array<float,2>{0.815291047f, 0.690560818f},
-std::array<float,2>{0.0638253689f, 0.248541757f},
-std::array<float,2>{0.312407762f, 0.84278816f},
-std::array<float,2>{0.569365859f, 0.357331395f},
-std::array<float,2>{0.546708703f, 0.567083478f},
-std::array<float,2>{0.364557683f, 0.123803616f},
-std::array<float,2>{0.0112438006f, 0.973501503f},
-std::array<float,2>{0.784668922f, 0.460224062f},
-std::array<float,2>{0.95192039f, 0.811565995f},
-std::array<float,2>{0.130288944f, 0.299759805f},
-std::array<float,2>{0.397688895f, 0.633192539f},
-std::array<float,2>{0.689990699f, 0.173159465f},
-std::array<float,2>{0.61337781f, 0.869649529f},
-std::array<float,2>{0.279533148f, 0.318255723f},
-std::array<float,2>{0.116247974f, 0.728431642f},
-std::array<float,2>{0.8552984f, 0.208376095f},
-std::array<float,2>{0.879744172f, 0.535975754f},
-std::array<float,2>{0.217288882f, 0.00754263531f},
-std::array<float,2>{0.456392288f, 0.884533823f},
-std::array<float,2>{0.648943186f, 0.414591223f},
-std::array<float,2>{0.746317506f, 0.661546588f},
-std::array<float,2>{0.413045347f, 0.152743354f},
-std::array<float,2>{0.175127134f, 0.778411448f},
-std::array<float,2>{0.983916581f, 0.250249445f},
-std::array<float,2>{0.775692821f, 0.961365223f},
-std::array<float,2>{0.0495467596f, 0.48220396f},
-std::array<float,2>{0.341800153f, 0.62348479f},
-std::array<float,2>{0.504288316f, 0.0818345472f},
-std::array<float,2>{0.523756742f, 0.994830012f},
-std::array<float,2>{0.32349053f, 0.448503613f},
-std::array<float,2>{0.0362102538f, 0.57891494f},
-std::array<float,2>{0.763437569f, 0.10475044f},
-std::array<float,2>{0.98572731f, 0.644506752f},
-std::array<float,2>{0.169136986f, 0.16987136f},
-std::array<float,2>{0.431620359f, 0.791507542f},
-std::array<float,2>{0.726547897f, 0.290989786f},
-std::array<float,2>{0.638149202f, 0.514849722f},
-std::array<float,2>{0.443311542f, 0.0487753861f},
-std::array<float,2>{0.195662022f, 0.93217808f},
-std::array<float,2>{0.89422965f, 0.402836353f},
-std::array<float,2>{0.87142843f, 0.825380921f},
-std::array<float,2>{0.10253343f, 0.372183889f},
-std::array<float,2>{0.262742877f, 0.711619198f},
-std::array<float,2>{0.602607369f, 0.224370137f},
-std::array<float,2>{0.717372537f, 0.753313899f},
-std::array<float,2>{0.388919204f, 0.270550668f},
-std::array<float,2>{0.154329225f, 0.673090875f},
-std::array<float,2>{0.955452085f, 0.134103179f},
-std::array<float,2>{0.807804286f, 0.599651277f},
-std::array<float,2>{0.0289467834f, 0.0749536604f},
-std::array<float,2>{0.354424477f, 0.944889545f},
-std::array<float,2>{0.553101718f, 0.497874618f},
-std::array<float,2>{0.590272367f, 0.736836374f},
-std::array<float,2>{0.290008754f, 0.196704522f},
-std::array<float,2>{0.083862178f, 0.857804716f},
-std::array<float,2>{0.835163116f, 0.343337029f},
-std::array<float,2>{0.931739092f, 0.906193972f},
-std::array<float,2>{0.248658985f, 0.423942596f},
-std::array<float,2>{0.47922197f, 0.547738791f},
-std::array<float,2>{0.672188878f, 0.0202298965f},
-std::array<float,2>{0.627904117f, 0.971513569f},
-std::array<float,2>{0.450086594f, 0.456224114f},
-std::array<float,2>{0.18778573f, 0.564656734f},
-std::array<float,2>{0.906041443f, 0.118515506f},
-std::array<float,2>{0.865495443f, 0.63672775f},
-std::array<float,2>{0.0992390215f, 0.1787249f},
-std::array<float,2>{0.25040409f, 0.805108666f},
-std::array<float,2>{0.596313357f, 0.3045066f},
-std::array<float,2>{0.5167768f, 0.529641032f},
-std::array<float,2>{0.31852752f, 0.0362127461f},
-std::array<float,2>{0.0410597399f, 0.917008519f},
-std::array<float,2>{0.756847918f, 0.382864803f},
-std::array<float,2>{0.998877168f, 0.835949123f},
-std::array<float,2>{0.16131407f, 0.352832466f},
-std::array<float,2>{0.425363332f, 0.694359303f},
-std::array<float,2>{0.732438326f, 0.244112223f},
-std::array<float,2>{0.581252992f, 0.774439812f},
-std::array<float,2>{0.288897425f, 0.257441819f},
-std::array<float,2>{0.0904560462f, 0.658039451f},
-std::array<float,2>{0.84085387f, 0.150645047f},
-std::array<float,2>{0.926093757f, 0.61948663f},
-std::array<float,2>{0.235129878f, 0.084831588f},
-std::array<float,2>{0.473136485f, 0.966211021f},
-std::array<float,2>{0.680273831f, 0.478512555f},
-std::array<float,2>{0.706196606f, 0.732051015f},
-std::array<float,2>{0.382475793f, 0.20444265f},
-std::array<float,2>{0.148011208f, 0.871201158f},
-std::array<float,2>{0.961126208f, 0.312678635f},
-std::array<float,2>{0.799813807f, 0.887898028f},
-std::array<float,2>{0.0216621719f, 0.421575159f},
-std::array<float,2>{0.345247984f, 0.533773363f},
-std::array<float,2>{0.56120193f, 0.00335619552f},
-std::array<float,2>{0.531754613f, 0.935861647f},
-std::array<float,2>{0.374969929f, 0.399111569f},
-std::array<float,2>{0.00719910162f, 0.5078668f},
-std::array<float,2>{0.793646812f, 0.0524737649f},
-std::array<float,2>{0.944805861f, 0.716234446f},
-std::array<float,2>{0.137710392f, 0.222575322f},
-std::array<float,2>{0.401919842f, 0.820394993f},
-std::array<float,2>{0.700799704f, 0.369345546f},
-std::array<float,2>{0.659208357f, 0.584121048f},
-std::array<float,2>{0.498324573f, 0.107308201f},
-std::array<float,2>{0.227231294f, 0.997361422f},
-std::array<float,2>{0.909449875f, 0.452364355f},
-std::array<float,2>{0.823424816f, 0.79538703f},
-std::array<float,2>{0.0741656572f, 0.294729799f},
-std::array<float,2>{0.300354391f, 0.648316383f},
-std::array<float,2>{0.574815333f, 0.165044054f},
-std::array<float,2>{0.741565108f, 0.855061114f},
-std::array<float,2>{0.421006233f, 0.336645752f},
-std::array<float,2>{0.184478268f, 0.738545418f},
-std::array<float,2>{0.969841421f, 0.200909019f},
-std::array<float,2>{0.769423544f, 0.554437697f},
-std::array<float,2>{0.0599602684f, 0.0178971719f},
-std::array<float,2>{0.329931796f, 0.900743246f},
-std::array<float,2>{0.510529041f, 0.429061949f},
-std::array<float,2>{0.624702275f, 0.67694515f},
-std::array<float,2>{0.273215383f, 0.136988431f},
-std::array<float,2>{0.12095958f, 0.754729688f},
-std::array<float,2>{0.848736167f, 0.26875183f},
-std::array<float,2>{0.890486419f, 0.939570963f},
-std::array<float,2>{0.206882164f, 0.494623214f},
-std::array<float,2>{0.46601668f, 0.596191943f},
-std::array<float,2>{0.645998359f, 0.072054483f},
-std::array<float,2>{0.693089843f, 0.89146024f},
-std::array<float,2>{0.39119938f, 0.431285769f},
-std::array<float,2>{0.127827123f, 0.555491328f},
-std::array<float,2>{0.946288109f, 0.023511637f},
-std::array<float,2>{0.787506282f, 0.743947566f},
-std::array<float,2>{0.0141433021f, 0.194432288f},
-std::array<float,2>{0.360931933f, 0.851500511f},
-std::array<float,2>{0.539762616f, 0.328663915f},
-std::array<float,2>{0.564369619f, 0.607575238f},
-std::array<float,2>{0.306984693f, 0.0685862601f},
-std::array<float,2>{0.0699237883f, 0.945570111f},
-std::array<float,2>{0.819594681f, 0.490931302f},
-std::array<float,2>{0.918002605f, 0.764331043f},
-std::array<float,2>{0.219318703f, 0.275387466f},
-std::array<float,2>{0.485695451f, 0.68377167f},
-std::array<float,2>{0.669149816f, 0.127496928f},
-std::array<float,2>{0.500106812f, 0.8191365f},
-std::array<float,2>{0.339224011f, 0.360641807f},
-std::array<float,2>{0.0515811853f, 0.703724504f},
-std::array<float,2>{0.777867913f, 0.232604921f},
-std::array<float,2>{0.978225768f, 0.503096998f},
-std::array<float,2>{0.17738305f, 0.0570212156f},
-std::array<float,2>{0.407337159f, 0.927152455f},
-std::array<float,2>{0.746070802f, 0.398011446f},
-std::array<float,2>{0.653815091f, 0.654814005f},
-std::array<float,2>{0.459082127f, 0.163889155f},
-std::array<float,2>{0.213640511f, 0.78150177f},
-std::array<float,2>{0.877647936f, 0.283270389f},
-std::array<float,2>{0.857649624f, 0.985166132f},
-std::array<float,2>{0.10966786f, 0.43931672f},
-std::array<float,2>{0.275946856f, 0.588254333f},
-std::array<float,2>{0.611969054f, 0.0968407914f},
-std::array<float,2>{0.608755946f, 0.959668994f},
-std::array<float,2>{0.258789957f, 0.473092884f},
-std::array<float,2>{0.105835587f, 0.615718603f},
-std::array<float,2>{0.87053144f, 0.0898946747f},
-std::array<float,2>{0.898219943f, 0.667586386f},
-std::array<float,2>{0.200359613f, 0.144442409f},
-std::array<float,2>{0.441168994f, 0.769995332f},
-std::array<float,2>{0.632993102f, 0.262722015f},
-std::array<float,2>{0.719814539f, 0.542610526f},
-std::array<float,2>{0.434215933f, 0.0151386578f},
-std::array<float,2>{0.164721951f, 0.876310825f},
-std::array<float,2>{0.990941644f, 0.4090918f},
-std::array<float,2>{0.758727372f, 0.85967797f},
-std::array<float,2>{0.0346890129f, 0.320749193f},
-std::array<float,2>{0.32592231f, 0.725825727f},
-std::array<float,2>{0.529367805f, 0.214410067f},
-std::array<float,2>{0.679229021f, 0.797624111f},
-std::array<float,2>{0.482022375f, 0.305093199f},
-std::array<float,2>{0.243750885f, 0.625741124f},
-std::array<float,2>{0.933793783f, 0.185703814f},
-std::array<float,2>{0.830820262f, 0.571412504f},
-std::array<float,2>{0.0784681365f, 0.113848373f},
-std::array<float,2>{0.296622753f, 0.981239676f},
-std::array<float,2>{0.587102294f, 0.463365465f},
-std::array<float,2>{0.547668159f, 0.700561464f},
-std::array<float,2>{0.35552749f, 0.240989059f},
-std::array<float,2>{0.0268852189f, 0.833638668f},
-std::array<float,2>{0.809711754f, 0.350308061f},
-std::array<float,2>{0.957554877f, 0.9108091f},
-std::array<float,2>{0.149040639f, 0.376498342f},
-std::array<float,2>{0.383867681f, 0.520199001f},
-std::array<float,2>{0.714456797f, 0.0407576226f},
-std::array<float,2>{0.737274528f, 0.977580845f},
-std::array<float,2>{0.415509164f, 0.466479957f},
-std::array<float,2>{0.183251083f, 0.577521205f},
-std::array<float,2>{0.973443329f, 0.111084722f},
-std::array<float,2>{0.770562708f, 0.63174659f},
-std::array<float,2>{0.0585805401f, 0.183185324f},
-std::array<float,2>{0.333019197f, 0.803130984f},
-std::array<float,2>{0.515128493f, 0.310249925f},
-std::array<float,2>{0.617745757f, 0.517963588f},
-std::array<float,2>{0.265933841f, 0.045023296f},
-std::array<float,2>{0.124284208f, 0.908084273f},
-std::array<float,2>{0.845742583f, 0.379430503f},
-std::array<float,2>{0.886138022f, 0.831523657f},
-std::array<float,2>{0.209072858f, 0.344305664f},
-std::array<float,2>{0.464204192f, 0.698167562f},
-std::array<float,2>{0.642769694f, 0.235785112f},
-std::array<float,2>{0.538003147f, 0.765833974f},
-std::array<float,2>{0.368031919f, 0.261249959f},
-std::array<float,2>{0.00363549893f, 0.668988347f},
-std::array<float,2>{0.791921079f, 0.14549236f},
-std::array<float,2>{0.940722704f, 0.613050342f},
-std::array<float,2>{0.134365097f, 0.0869311839f},
-std::array<float,2>{0.404975265f, 0.953324378f},
-std::array<float,2>{0.697610378f, 0.471634507f},
-std::array<float,2>{0.663060427f, 0.720979214f},
-std::array<float,2>{0.493443519f, 0.216605797f},
-std::array<float,2>{0.230649889f, 0.863695979f},
-std::array<float,2>{0.914001405f, 0.326350063f},
-std::array<float,2>{0.825668037f, 0.87963593f},
-std::array<float,2>{0.0756626278f, 0.412392735f},
-std::array<float,2>{0.301009119f, 0.545169652f},
-std::array<float,2>{0.570746243f, 0.0103086736f},
-std::array<float,2>{0.58448416f, 0.923415005f},
-std::array<float,2>{0.281303138f, 0.393436879f},
-std::array<float,2>{0.0881299749f, 0.505380273f},
-std::array<float,2>{0.839806676f, 0.061477717f},
-std::array<float,2>{0.923624516f, 0.710332036f},
-std::array<float,2>{0.239993364f, 0.228890747f},
-std::array<float,2>{0.469114035f, 0.812835336f},
-std::array<float,2>{0.684987903f, 0.364218563f},
-std::array<float,2>{0.710348427f, 0.591723263f},
-std::array<float,2>{0.37796855f, 0.0989271924f},
-std::array<float,2>{0.142949596f, 0.989624083f},
-std::array<float,2>{0.966399729f, 0.444925457f},
-std::array<float,2>{0.802747428f, 0.785905302f},
-std::array<float,2>{0.0158307012f, 0.288641721f},
-std::array<float,2>{0.349244922f, 0.651079655f},
-std::array<float,2>{0.555687785f, 0.156873405f},
-std::array<float,2>{0.629426897f, 0.845105946f},
-std::array<float,2>{0.44887501f, 0.333167255f},
-std::array<float,2>{0.192768142f, 0.746267378f},
-std::array<float,2>{0.899663985f, 0.189986169f},
-std::array<float,2>{0.860665739f, 0.560186863f},
-std::array<float,2>{0.0943828747f, 0.0287251379f},
-std::array<float,2>{0.256099433f, 0.895448327f},
-std::array<float,2>{0.599929571f, 0.43382737f},
-std::array<float,2>{0.523225605f, 0.68340832f},
-std::array<float,2>{0.312879056f, 0.130638987f},
-std::array<float,2>{0.0434969738f, 0.758699059f},
-std::array<float,2>{0.7504614f, 0.279968828f},
-std::array<float,2>{0.992801964f, 0.952931464f},
-std::array<float,2>{0.157370523f, 0.484463632f},
-std::array<float,2>{0.427191347f, 0.603633821f},
-std::array<float,2>{0.728039324f, 0.0630022958f},
-std::array<float,2>{0.673798084f, 0.903591692f},
-std::array<float,2>{0.479728311f, 0.42188102f},
-std::array<float,2>{0.249076426f, 0.549865961f},
-std::array<float,2>{0.932996035f, 0.022470288f},
-std::array<float,2>{0.834773719f, 0.734885097f},
-std::array<float,2>{0.0829092935f, 0.199191436f},
-std::array<float,2>{0.290905297f, 0.857195914f},
-std::array<float,2>{0.591049254f, 0.341585994f},
-std::array<float,2>{0.554268837f, 0.599233627f},
-std::array<float,2>{0.354941666f, 0.076892972f},
-std::array<float,2>{0.0277557429f, 0.942835569f},
-std::array<float,2>{0.807120621f, 0.499412149f},
-std::array<float,2>{0.956559479f, 0.751004457f},
-std::array<float,2>{0.155850485f, 0.271772355f},
-std::array<float,2>{0.390572369f, 0.67479074f},
-std::array<float,2>{0.717869699f, 0.136470303f},
-std::array<float,2>{0.602220893f, 0.826752603f},
-std::array<float,2>{0.262222916f, 0.374569625f},
-std::array<float,2>{0.103425808f, 0.713374555f},
-std::array<float,2>{0.872632086f, 0.226343274f},
-std::array<float,2>{0.893273175f, 0.512445271f},
-std::array<float,2>{0.19676432f, 0.0503345579f},
-std::array<float,2>{0.442358226f, 0.929690361f},
-std::array<float,2>{0.636978209f, 0.405353189f},
-std::array<float,2>{0.72551924f, 0.642235518f},
-std::array<float,2>{0.430429757f, 0.171397597f},
-std::array<float,2>{0.168017358f, 0.789664686f},
-std::array<float,2>{0.984551489f, 0.292098194f},
-std::array<float,2>{0.762390018f, 0.994102657f},
-std::array<float,2>{0.0351684839f, 0.447195411f},
-std::array<float,2>{0.322707385f, 0.580356777f},
-std::array<float,2>{0.524744153f, 0.102869794f},
-std::array<float,2>{0.505751431f, 0.963322759f},
-std::array<float,2>{0.343600422f, 0.483467638f},
-std::array<float,2>{0.0505070798f, 0.622459233f},
-std::array<float,2>{0.776949108f, 0.0783871263f},
-std::array<float,2>{0.982996643f, 0.662716985f},
-std::array<float,2>{0.174500361f, 0.15519686f},
-std::array<float,2>{0.413946778f, 0.780113757f},
-std::array<float,2>{0.747801304f, 0.252649248f},
-std::array<float,2>{0.650326371f, 0.538796306f},
-std::array<float,2>{0.455655932f, 0.00454126252f},
-std::array<float,2>{0.21825771f, 0.886188865f},
-std::array<float,2>{0.880239844f, 0.416456759f},
-std::array<float,2>{0.854124665f, 0.868459284f},
-std::array<float,2>{0.115640976f, 0.320180625f},
-std::array<float,2>{0.280333877f, 0.728873312f},
-std::array<float,2>{0.615182936f, 0.210655212f},
-std::array<float,2>{0.691377044f, 0.809431612f},
-std::array<float,2>{0.397070795f, 0.298268706f},
-std::array<float,2>{0.129144162f, 0.635706663f},
-std::array<float,2>{0.952303469f, 0.173889995f},
-std::array<float,2>{0.783389807f, 0.568609238f},
-std::array<float,2>{0.010115264f, 0.121642128f},
-std::array<float,2>{0.364208609f, 0.974778533f},
-std::array<float,2>{0.545752048f, 0.458556175f},
-std::array<float,2>{0.568519652f, 0.689091146f},
-std::array<float,2>{0.311479181f, 0.246210068f},
-std::array<float,2>{0.0632143542f, 0.841109395f},
-std::array<float,2>{0.816180587f, 0.358165681f},
-std::array<float,2>{0.915548623f, 0.918593228f},
-std::array<float,2>{0.222847059f, 0.38793546f},
-std::array<float,2>{0.48908323f, 0.525641382f},
-std::array<float,2>{0.664485395f, 0.0345380455f},
-std::array<float,2>{0.644558907f, 0.937768161f},
-std::array<float,2>{0.465389878f, 0.492292702f},
-std::array<float,2>{0.205864087f, 0.595083058f},
-std::array<float,2>{0.889614046f, 0.0731891394f},
-std::array<float,2>{0.848568976f, 0.679621875f},
-std::array<float,2>{0.119915716f, 0.140084803f},
-std::array<float,2>{0.271507829f, 0.756435215f},
-std::array<float,2>{0.623488247f, 0.266621172f},
-std::array<float,2>{0.510750651f, 0.55220449f},
-std::array<float,2>{0.328167766f, 0.0166078173f},
-std::array<float,2>{0.0590211041f, 0.89912796f},
-std::array<float,2>{0.767676115f, 0.427325726f},
-std::array<float,2>{0.96968329f, 0.852071881f},
-std::array<float,2>{0.184840322f, 0.33978042f},
-std::array<float,2>{0.420010865f, 0.74103725f},
-std::array<float,2>{0.741060913f, 0.201223657f},
-std::array<float,2>{0.575363398f, 0.793950617f},
-std::array<float,2>{0.299074948f, 0.295469254f},
-std::array<float,2>{0.0727548823f, 0.645217896f},
-std::array<float,2>{0.823133826f, 0.166336656f},
-std::array<float,2>{0.9082762f, 0.583491981f},
-std::array<float,2>{0.228143245f, 0.108770773f},
-std::array<float,2>{0.499811143f, 0.999771595f},
-std::array<float,2>{0.658361852f, 0.451104671f},
-std::array<float,2>{0.700093806f, 0.716920793f},
-std::array<float,2>{0.400530428f, 0.21907939f},
-std::array<float,2>{0.137287185f, 0.82316339f},
-std::array<float,2>{0.944210112f, 0.36890316f},
-std::array<float,2>{0.794143915f, 0.934914172f},
-std::array<float,2>{0.00618100213f, 0.40118143f},
-std::array<float,2>{0.373455346f, 0.510639608f},
-std::array<float,2>{0.532409608f, 0.0534944534f},
-std::array<float,2>{0.561675966f, 0.889456809f},
-std::array<float,2>{0.343933582f, 0.418527037f},
-std::array<float,2>{0.0227369145f, 0.531635463f},
-std::array<float,2>{0.799530804f, 0.000629511836f},
-std::array<float,2>{0.962853253f, 0.734322071f},
-std::array<float,2>{0.147310555f, 0.205650836f},
-std::array<float,2>{0.380913794f, 0.873436987f},
-std::array<float,2>{0.70557791f, 0.314668864f},
-std::array<float,2>{0.680719316f, 0.617847204f},
-std::array<float,2>{0.474341333f, 0.0823080167f},
-std::array<float,2>{0.235394463f, 0.967531204f},
-std::array<float,2>{0.92741251f, 0.479923308f},
-std::array<float,2>{0.839960456f, 0.775647998f},
-std::array<float,2>{0.0914295167f, 0.254887849f},
-std::array<float,2>{0.287781954f, 0.659721315f},
-std::array<float,2>{0.580205023f, 0.149201766f},
-std::array<float,2>{0.734362841f, 0.839252353f},
-std::array<float,2>{0.423984379f, 0.355056375f},
-std::array<float,2>{0.160193697f, 0.691658437f},
-std::array<float,2>{0.999699652f, 0.245361209f},
-std::array<float,2>{0.756031334f, 0.528424144f},
-std::array<float,2>{0.0422327481f, 0.0387415998f},
-std::array<float,2>{0.319854498f, 0.914163351f},
-std::array<float,2>{0.516139627f, 0.386503518f},
-std::array<float,2>{0.597056329f, 0.639984071f},
-std::array<float,2>{0.251167476f, 0.176459432f},
-std::array<float,2>{0.0979896337f, 0.807371616f},
-std::array<float,2>{0.866932094f, 0.301692724f},
-std::array<float,2>{0.905140042f, 0.968978524f},
-std::array<float,2>{0.189264596f, 0.4538019f},
-std::array<float,2>{0.451091379f, 0.563476682f},
-std::array<float,2>{0.628454566f, 0.12015263f},
-std::array<float,2>{0.712945938f, 0.912429571f},
-std::array<float,2>{0.383213013f, 0.377489507f},
-std::array<float,2>{0.149450973f, 0.522629499f},
-std::array<float,2>{0.958844543f, 0.0426655374f},
-std::array<float,2>{0.809062779f, 0.702801228f},
-std::array<float,2>{0.0254178531f, 0.239216864f},
-std::array<float,2>{0.357206643f, 0.834995508f},
-std::array<float,2>{0.548408329f, 0.349042326f},
-std::array<float,2>{0.586153805f, 0.573675454f},
-std::array<float,2>{0.295781046f, 0.115262412f},
-std::array<float,2>{0.0791423097f, 0.983570874f},
-std::array<float,2>{0.83152163f, 0.462280929f},
-std::array<float,2>{0.934950531f, 0.79948473f},
-std::array<float,2>{0.242308348f, 0.306850225f},
-std::array<float,2>{0.480892956f, 0.627599359f},
-std::array<float,2>{0.678001404f, 0.183630347f},
-std::array<float,2>{0.531120539f, 0.861530602f},
-std::array<float,2>{0.324550956f, 0.322861433f},
-std::array<float,2>{0.0334134512f, 0.723157346f},
-std::array<float,2>{0.759625196f, 0.211363018f},
-std::array<float,2>{0.991247833f, 0.53917557f},
-std::array<float,2>{0.165873036f, 0.0131837213f},
-std::array<float,2>{0.43509835f, 0.878781438f},
-std::array<float,2>{0.719116867f, 0.406523615f},
-std::array<float,2>{0.63382113f, 0.665902138f},
-std::array<float,2>{0.440276533f, 0.14115563f},
-std::array<float,2>{0.199822113f, 0.773297846f},
-std::array<float,2>{0.897314191f, 0.264817715f},
-std::array<float,2>{0.869267583f, 0.958927929f},
-std::array<float,2>{0.107082255f, 0.475066841f},
-std::array<float,2>{0.257972538f, 0.613833189f},
-std::array<float,2>{0.608348966f, 0.0935989469f},
-std::array<float,2>{0.613147676f, 0.98777467f},
-std::array<float,2>{0.276531309f, 0.440156162f},
-std::array<float,2>{0.111037932f, 0.586387336f},
-std::array<float,2>{0.858888447f, 0.0946028158f},
-std::array<float,2>{0.878790259f, 0.652853191f},
-std::array<float,2>{0.214138553f, 0.161352456f},
-std::array<float,2>{0.460424483f, 0.785012424f},
-std::array<float,2>{0.653220057f, 0.282552868f},
-std::array<float,2>{0.744163752f, 0.501671433f},
-std::array<float,2>{0.406381309f, 0.0559601486f},
-std::array<float,2>{0.176272944f, 0.929315388f},
-std::array<float,2>{0.977203608f, 0.395253569f},
-std::array<float,2>{0.77923888f, 0.817737997f},
-std::array<float,2>{0.0524720252f, 0.363176703f},
-std::array<float,2>{0.338179767f, 0.706440091f},
-std::array<float,2>{0.501938641f, 0.2306256f},
-std::array<float,2>{0.668205202f, 0.762182772f},
-std::array<float,2>{0.485283256f, 0.277144819f},
-std::array<float,2>{0.220481187f, 0.686628282f},
-std::array<float,2>{0.919005811f, 0.125483274f},
-std::array<float,2>{0.818430603f, 0.606544137f},
-std::array<float,2>{0.0692350119f, 0.0674797893f},
-std::array<float,2>{0.30764845f, 0.94750917f},
-std::array<float,2>{0.562889457f, 0.489158183f},
-std::array<float,2>{0.540988624f, 0.745578706f},
-std::array<float,2>{0.359574944f, 0.191766903f},
-std::array<float,2>{0.0155222509f, 0.848795652f},
-std::array<float,2>{0.788951218f, 0.33197847f},
-std::array<float,2>{0.946836293f, 0.894274056f},
-std::array<float,2>{0.127949297f, 0.432407141f},
-std::array<float,2>{0.392045379f, 0.557475865f},
-std::array<float,2>{0.691600442f, 0.025481334f},
-std::array<float,2>{0.695679545f, 0.956540823f},
-std::array<float,2>{0.402413517f, 0.468755394f},
-std::array<float,2>{0.135490298f, 0.610296428f},
-std::array<float,2>{0.938930929f, 0.0884972587f},
-std::array<float,2>{0.78974396f, 0.670538723f},
-std::array<float,2>{0.00128793262f, 0.148373738f},
-std::array<float,2>{0.370204777f, 0.768633187f},
-std::array<float,2>{0.535508871f, 0.258919656f},
-std::array<float,2>{0.573397577f, 0.543944061f},
-std::array<float,2>{0.302756786f, 0.00959159806f},
-std::array<float,2>{0.0768980756f, 0.881393075f},
-std::array<float,2>{0.82699877f, 0.411930293f},
-std::array<float,2>{0.910656512f, 0.865896404f},
-std::array<float,2>{0.233034953f, 0.324848086f},
-std::array<float,2>{0.494237304f, 0.72036469f},
-std::array<float,2>{0.660222173f, 0.218731835f},
-std::array<float,2>{0.511814773f, 0.802686751f},
-std::array<float,2>{0.335342079f, 0.31169951f},
-std::array<float,2>{0.0556745268f, 0.630774796f},
-std::array<float,2>{0.772130847f, 0.180558294f},
-std::array<float,2>{0.975171268f, 0.576100945f},
-std::array<float,2>{0.180115253f, 0.113180816f},
-std::array<float,2>{0.416477531f, 0.978815854f},
-std::array<float,2>{0.736167073f, 0.467431396f},
-std::array<float,2>{0.641224742f, 0.695981562f},
-std::array<float,2>{0.462835878f, 0.236620739f},
-std::array<float,2>{0.208576754f, 0.829019189f},
-std::array<float,2>{0.883227348f, 0.34642449f},
-std::array<float,2>{0.844999969f, 0.909030259f},
-std::array<float,2>{0.122922227f, 0.381015271f},
-std::array<float,2>{0.269011915f, 0.516433239f},
-std::array<float,2>{0.619632304f, 0.0441473238f},
-std::array<float,2>{0.59791553f, 0.897749126f},
-std::array<float,2>{0.255123138f, 0.43662861f},
-std::array<float,2>{0.0965211391f, 0.56134212f},
-std::array<float,2>{0.862490535f, 0.0307698306f},
-std::array<float,2>{0.901588619f, 0.748990715f},
-std::array<float,2>{0.194956839f, 0.188931301f},
-std::array<float,2>{0.446135581f, 0.846849084f},
-std::array<float,2>{0.631561816f, 0.335741937f},
-std::array<float,2>{0.729979575f, 0.603130698f},
-std::array<float,2>{0.427741796f, 0.0652788505f},
-std::array<float,2>{0.158305883f, 0.951011419f},
-std::array<float,2>{0.995020509f, 0.48644504f},
-std::array<float,2>{0.752262831f, 0.760037184f},
-std::array<float,2>{0.045831006f, 0.277579248f},
-std::array<float,2>{0.315348148f, 0.680844903f},
-std::array<float,2>{0.519567609f, 0.132724762f},
-std::array<float,2>{0.686216474f, 0.815199554f},
-std::array<float,2>{0.471192241f, 0.366939753f},
-std::array<float,2>{0.240933895f, 0.707371771f},
-std::array<float,2>{0.924151838f, 0.226566821f},
-std::array<float,2>{0.836628914f, 0.506211579f},
-std::array<float,2>{0.0868934393f, 0.0592556931f},
-std::array<float,2>{0.28373605f, 0.924780667f},
-std::array<float,2>{0.583811283f, 0.391067088f},
-std::array<float,2>{0.557487905f, 0.649658144f},
-std::array<float,2>{0.35140273f, 0.160014912f},
-std::array<float,2>{0.0181988124f, 0.788853109f},
-std::array<float,2>{0.801585674f, 0.285383672f},
-std::array<float,2>{0.968355179f, 0.991722286f},
-std::array<float,2>{0.142319396f, 0.443350226f},
-std::array<float,2>{0.375947922f, 0.593649626f},
-std::array<float,2>{0.707354426f, 0.100732528f},
-std::array<float,2>{0.639061034f, 0.933434606f},
-std::array<float,2>{0.444173455f, 0.40404892f},
-std::array<float,2>{0.198485315f, 0.514022887f},
-std::array<float,2>{0.890834689f, 0.0476682335f},
-std::array<float,2>{0.874672472f, 0.712635756f},
-std::array<float,2>{0.104871072f, 0.223447099f},
-std::array<float,2>{0.264192611f, 0.82439369f},
-std::array<float,2>{0.604515195f, 0.371299565f},
-std::array<float,2>{0.525606036f, 0.579746842f},
-std::array<float,2>{0.32117641f, 0.103809245f},
-std::array<float,2>{0.0372361802f, 0.995545089f},
-std::array<float,2>{0.763795793f, 0.448142409f},
-std::array<float,2>{0.987929821f, 0.792748153f},
-std::array<float,2>{0.17028673f, 0.289292425f},
-std::array<float,2>{0.431696415f, 0.642620265f},
-std::array<float,2>{0.724599242f, 0.168199435f},
-std::array<float,2>{0.59202522f, 0.858796775f},
-std::array<float,2>{0.291267425f, 0.341988534f},
-std::array<float,2>{0.0845754519f, 0.737387717f},
-std::array<float,2>{0.833228052f, 0.195382059f},
-std::array<float,2>{0.930338025f, 0.548662305f},
-std::array<float,2>{0.246630177f, 0.0210151691f},
-std::array<float,2>{0.477870286f, 0.904674768f},
-std::array<float,2>{0.674578905f, 0.425299287f},
-std::array<float,2>{0.716246367f, 0.671964228f},
-std::array<float,2>{0.387826413f, 0.133297816f},
-std::array<float,2>{0.154180273f, 0.752769709f},
-std::array<float,2>{0.954642057f, 0.269890368f},
-std::array<float,2>{0.805914462f, 0.944254398f},
-std::array<float,2>{0.0296924859f, 0.496173739f},
-std::array<float,2>{0.353063852f, 0.601269722f},
-std::array<float,2>{0.551237643f, 0.0759089589f},
-std::array<float,2>{0.544671714f, 0.97440654f},
-std::array<float,2>{0.365973771f, 0.459207505f},
-std::array<float,2>{0.00892491639f, 0.568328381f},
-std::array<float,2>{0.782867789f, 0.124034651f},
-std::array<float,2>{0.950797319f, 0.634733737f},
-std::array<float,2>{0.132363349f, 0.172783926f},
-std::array<float,2>{0.396030873f, 0.811070383f},
-std::array<float,2>{0.688423991f, 0.300430298f},
-std::array<float,2>{0.666348994f, 0.523450971f},
-std::array<float,2>{0.491891176f, 0.0315843523f},
-std::array<float,2>{0.226491421f, 0.921270549f},
-std::array<float,2>{0.917349637f, 0.3889395f},
-std::array<float,2>{0.813957214f, 0.841837466f},
-std::array<float,2>{0.0645418763f, 0.356372476f},
-std::array<float,2>{0.309298396f, 0.689681232f},
-std::array<float,2>{0.567402601f, 0.24928911f},
-std::array<float,2>{0.749031603f, 0.777632594f},
-std::array<float,2>{0.411007285f, 0.251421243f},
-std::array<float,2>{0.172678798f, 0.660882473f},
-std::array<float,2>{0.981759965f, 0.153358713f},
-std::array<float,2>{0.774234295f, 0.624699473f},
-std::array<float,2>{0.048068855f, 0.0802779868f},
-std::array<float,2>{0.340235621f, 0.961934865f},
-std::array<float,2>{0.505927801f, 0.480909288f},
-std::array<float,2>{0.615496755f, 0.727089942f},
-std::array<float,2>{0.277438432f, 0.207120284f},
-std::array<float,2>{0.113784328f, 0.870520473f},
-std::array<float,2>{0.853313982f, 0.316521555f},
-std::array<float,2>{0.881188869f, 0.883320212f},
-std::array<float,2>{0.215207309f, 0.415713072f},
-std::array<float,2>{0.454196334f, 0.536350965f},
-std::array<float,2>{0.652338564f, 0.00586423324f},
-std::array<float,2>{0.657101572f, 0.996537507f},
-std::array<float,2>{0.497041225f, 0.451931953f},
-std::array<float,2>{0.22922115f, 0.585757852f},
-std::array<float,2>{0.906784236f, 0.106324255f},
-std::array<float,2>{0.821275592f, 0.647044718f},
-std::array<float,2>{0.0710144639f, 0.164654151f},
-std::array<float,2>{0.298138827f, 0.796579301f},
-std::array<float,2>{0.578114331f, 0.293882489f},
-std::array<float,2>{0.534789324f, 0.509002745f},
-std::array<float,2>{0.371574879f, 0.0510672927f},
-std::array<float,2>{0.00545109296f, 0.936895311f},
-std::array<float,2>{0.795409381f, 0.400045335f},
-std::array<float,2>{0.942225635f, 0.822089136f},
-std::array<float,2>{0.138840884f, 0.370185107f},
-std::array<float,2>{0.398743808f, 0.715031564f},
-std::array<float,2>{0.701824963f, 0.22082983f},
-std::array<float,2>{0.621887684f, 0.7551108f},
-std::array<float,2>{0.27051416f, 0.268102914f},
-std::array<float,2>{0.118668206f, 0.676139832f},
-std::array<float,2>{0.850250006f, 0.138513446f},
-std::array<float,2>{0.887084126f, 0.596807241f},
-std::array<float,2>{0.204043344f, 0.0711980164f},
-std::array<float,2>{0.467817515f, 0.941255629f},
-std::array<float,2>{0.648269951f, 0.495515972f},
-std::array<float,2>{0.739554584f, 0.739932775f},
-std::array<float,2>{0.418860584f, 0.199665084f},
-std::array<float,2>{0.187450752f, 0.853621721f},
-std::array<float,2>{0.971178651f, 0.33788383f},
-std::array<float,2>{0.766707063f, 0.90141052f},
-std::array<float,2>{0.0621697605f, 0.428599536f},
-std::array<float,2>{0.331707746f, 0.55318737f},
-std::array<float,2>{0.509011328f, 0.0191719327f},
-std::array<float,2>{0.518135726f, 0.916977048f},
-std::array<float,2>{0.318349689f, 0.38461107f},
-std::array<float,2>{0.0402466543f, 0.53063637f},
-std::array<float,2>{0.75453651f, 0.0359585546f},
-std::array<float,2>{0.996650815f, 0.693472326f},
-std::array<float,2>{0.164017737f, 0.242684528f},
-std::array<float,2>{0.421991557f, 0.837495506f},
-std::array<float,2>{0.731403589f, 0.352295041f},
-std::array<float,2>{0.626842618f, 0.565917373f},
-std::array<float,2>{0.451244831f, 0.1173921f},
-std::array<float,2>{0.189724773f, 0.972010553f},
-std::array<float,2>{0.903793275f, 0.456027001f},
-std::array<float,2>{0.863771975f, 0.806260169f},
-std::array<float,2>{0.101558521f, 0.303623706f},
-std::array<float,2>{0.253594577f, 0.638229668f},
-std::array<float,2>{0.594905019f, 0.177980766f},
-std::array<float,2>{0.703184664f, 0.872136891f},
-std::array<float,2>{0.38027826f, 0.314168304f},
-std::array<float,2>{0.145676702f, 0.731113315f},
-std::array<float,2>{0.964560091f, 0.203940347f},
-std::array<float,2>{0.797913074f, 0.534915328f},
-std::array<float,2>{0.0201399475f, 0.00205015554f},
-std::array<float,2>{0.347516865f, 0.887262404f},
-std::array<float,2>{0.559465349f, 0.420625776f},
-std::array<float,2>{0.579829991f, 0.657186031f},
-std::array<float,2>{0.286341131f, 0.1514384f},
-std::array<float,2>{0.0932331383f, 0.774191439f},
-std::array<float,2>{0.843612313f, 0.256435543f},
-std::array<float,2>{0.928716481f, 0.965505302f},
-std::array<float,2>{0.237970844f, 0.476724267f},
-std::array<float,2>{0.475433171f, 0.620581806f},
-std::array<float,2>{0.682004392f, 0.085775651f},
-std::array<float,2>{0.721861124f, 0.875190616f},
-std::array<float,2>{0.436840028f, 0.409216851f},
-std::array<float,2>{0.166712821f, 0.54161346f},
-std::array<float,2>{0.989670515f, 0.0142539022f},
-std::array<float,2>{0.760098159f, 0.72510922f},
-std::array<float,2>{0.0319055021f, 0.213407859f},
-std::array<float,2>{0.326322973f, 0.861083329f},
-std::array<float,2>{0.527428329f, 0.321628898f},
-std::array<float,2>{0.605802953f, 0.616587043f},
-std::array<float,2>{0.260705054f, 0.0916397572f},
-std::array<float,2>{0.107888907f, 0.960598707f},
-std::array<float,2>{0.868358493f, 0.473896831f},
-std::array<float,2>{0.894899964f, 0.770541072f},
-std::array<float,2>{0.201630682f, 0.262233973f},
-std::array<float,2>{0.438893497f, 0.666942477f},
-std::array<float,2>{0.636621654f, 0.143423781f},
-std::array<float,2>{0.550540984f, 0.83290267f},
-std::array<float,2>{0.358117253f, 0.35085091f},
-std::array<float,2>{0.0252773985f, 0.699956715f},
-std::array<float,2>{0.812310636f, 0.242101252f},
-std::array<float,2>{0.960620761f, 0.521130323f},
-std::array<float,2>{0.151169583f, 0.0398096777f},
-std::array<float,2>{0.386233121f, 0.911771238f},
-std::array<float,2>{0.712875962f, 0.37504974f},
-std::array<float,2>{0.677305281f, 0.625993013f},
-std::array<float,2>{0.48262167f, 0.18748562f},
-std::array<float,2>{0.244788751f, 0.798293531f},
-std::array<float,2>{0.937401295f, 0.306142002f},
-std::array<float,2>{0.828950405f, 0.98236227f},
-std::array<float,2>{0.0804132298f, 0.464652449f},
-std::array<float,2>{0.293915242f, 0.571288288f},
-std::array<float,2>{0.588298857f, 0.114625253f},
-std::array<float,2>{0.56627208f, 0.947095394f},
-std::array<float,2>{0.304689169f, 0.491950631f},
-std::array<float,2>{0.0672329217f, 0.608500004f},
-std::array<float,2>{0.817971408f, 0.0696910173f},
-std::array<float,2>{0.92137605f, 0.684702754f},
-std::array<float,2>{0.222533345f, 0.128037304f},
-std::array<float,2>{0.486399502f, 0.764691949f},
-std::array<float,2>{0.671509504f, 0.273474753f},
-std::array<float,2>{0.694990039f, 0.556623936f},
-std::array<float,2>{0.393689722f, 0.0246818904f},
-std::array<float,2>{0.125343472f, 0.891918302f},
-std::array<float,2>{0.948566973f, 0.429882914f},
-std::array<float,2>{0.786292493f, 0.849851787f},
-std::array<float,2>{0.0127232112f, 0.329652399f},
-std::array<float,2>{0.361653268f, 0.74252665f},
-std::array<float,2>{0.541639864f, 0.193854675f},
-std::array<float,2>{0.655725241f, 0.782966733f},
-std::array<float,2>{0.458362877f, 0.284746051f},
-std::array<float,2>{0.211307988f, 0.655918419f},
-std::array<float,2>{0.876109838f, 0.162891075f},
-std::array<float,2>{0.857358098f, 0.589731336f},
-std::array<float,2>{0.113165334f, 0.096645169f},
-std::array<float,2>{0.274147183f, 0.985403955f},
-std::array<float,2>{0.609823287f, 0.438398808f},
-std::array<float,2>{0.502953947f, 0.704926372f},
-std::array<float,2>{0.336855322f, 0.233806998f},
-std::array<float,2>{0.0546708368f, 0.819890201f},
-std::array<float,2>{0.780246019f, 0.359464824f},
-std::array<float,2>{0.980206072f, 0.925820112f},
-std::array<float,2>{0.179592982f, 0.397342175f},
-std::array<float,2>{0.409155488f, 0.502429903f},
-std::array<float,2>{0.743724823f, 0.0578799061f},
-std::array<float,2>{0.687869668f, 0.975327849f},
-std::array<float,2>{0.395529091f, 0.458469748f},
-std::array<float,2>{0.131889224f, 0.568976998f},
-std::array<float,2>{0.95030278f, 0.121211343f},
-std::array<float,2>{0.782616436f, 0.635129273f},
-std::array<float,2>{0.00942890067f, 0.1746286f},
-std::array<float,2>{0.365513027f, 0.808995187f},
-std::array<float,2>{0.544399202f, 0.298800319f},
-std::array<float,2>{0.567949295f, 0.52621609f},
-std::array<float,2>{0.309048504f, 0.0348624699f},
-std::array<float,2>{0.0652262568f, 0.918243408f},
-std::array<float,2>{0.814421058f, 0.388597429f},
-std::array<float,2>{0.91757226f, 0.841486454f},
-std::array<float,2>{0.225823984f, 0.357498139f},
-std::array<float,2>{0.491524965f, 0.688857675f},
-std::array<float,2>{0.666513622f, 0.247012436f},
-std::array<float,2>{0.506532073f, 0.779649913f},
-std::array<float,2>{0.340558767f, 0.252337188f},
-std::array<float,2>{0.0484139286f, 0.662567019f},
-std::array<float,2>{0.773806453f, 0.154552683f},
-std::array<float,2>{0.98233211f, 0.622916043f},
-std::array<float,2>{0.172070682f, 0.0786162093f},
-std::array<float,2>{0.410618931f, 0.963476539f},
-std::array<float,2>{0.749750555f, 0.484219104f},
-std::array<float,2>{0.651688576f, 0.729064882f},
-std::array<float,2>{0.454807162f, 0.210281983f},
-std::array<float,2>{0.215566814f, 0.868745625f},
-std::array<float,2>{0.88164258f, 0.319432378f},
-std::array<float,2>{0.85274893f, 0.886512935f},
-std::array<float,2>{0.113391697f, 0.416972131f},
-std::array<float,2>{0.278116047f, 0.538378358f},
-std::array<float,2>{0.616067171f, 0.00411243364f},
-std::array<float,2>{0.605203748f, 0.930308223f},
-std::array<float,2>{0.26396668f, 0.405966252f},
-std::array<float,2>{0.105445005f, 0.511775196f},
-std::array<float,2>{0.874256074f, 0.0502087399f},
-std::array<float,2>{0.891592443f, 0.713584125f},
-std::array<float,2>{0.199157909f, 0.225671604f},
-std::array<float,2>{0.443653584f, 0.826589584f},
-std::array<float,2>{0.639600813f, 0.374109298f},
-std::array<float,2>{0.724091053f, 0.581010759f},
-std::array<float,2>{0.432359636f, 0.103339277f},
-std::array<float,2>{0.170562834f, 0.993267238f},
-std::array<float,2>{0.987698674f, 0.446322203f},
-std::array<float,2>{0.764414668f, 0.789545119f},
-std::array<float,2>{0.0378378034f, 0.292575359f},
-std::array<float,2>{0.320612848f, 0.641885817f},
-std::array<float,2>{0.525932789f, 0.171267748f},
-std::array<float,2>{0.674225509f, 0.856717944f},
-std::array<float,2>{0.478372663f, 0.341250181f},
-std::array<float,2>{0.246244937f, 0.734546006f},
-std::array<float,2>{0.930001378f, 0.19850193f},
-std::array<float,2>{0.833606482f, 0.550324917f},
-std::array<float,2>{0.084353365f, 0.0233771168f},
-std::array<float,2>{0.291911393f, 0.904237688f},
-std::array<float,2>{0.592736125f, 0.422626674f},
-std::array<float,2>{0.551321149f, 0.674116373f},
-std::array<float,2>{0.352931142f, 0.13617973f},
-std::array<float,2>{0.0300182626f, 0.751536071f},
-std::array<float,2>{0.806493938f, 0.272046477f},
-std::array<float,2>{0.9543432f, 0.942924142f},
-std::array<float,2>{0.15350017f, 0.499679208f},
-std::array<float,2>{0.388486028f, 0.598801434f},
-std::array<float,2>{0.716780365f, 0.0766576454f},
-std::array<float,2>{0.630870759f, 0.894682467f},
-std::array<float,2>{0.445504457f, 0.434347332f},
-std::array<float,2>{0.194488913f, 0.559726f},
-std::array<float,2>{0.90186131f, 0.0291374326f},
-std::array<float,2>{0.863010526f, 0.746821344f},
-std::array<float,2>{0.0960608944f, 0.189807415f},
-std::array<float,2>{0.25558421f, 0.845491052f},
-std::array<float,2>{0.598572254f, 0.333890021f},
-std::array<float,2>{0.520298719f, 0.604273438f},
-std::array<float,2>{0.31454891f, 0.0629456565f},
-std::array<float,2>{0.0450931229f, 0.952483118f},
-std::array<float,2>{0.752718985f, 0.485143751f},
-std::array<float,2>{0.994490027f, 0.75810653f},
-std::array<float,2>{0.158718139f, 0.279744953f},
-std::array<float,2>{0.428597242f, 0.682802916f},
-std::array<float,2>{0.730369449f, 0.130344614f},
-std::array<float,2>{0.583110154f, 0.813076973f},
-std::array<float,2>{0.283208102f, 0.363386452f},
-std::array<float,2>{0.0863592625f, 0.710458577f},
-std::array<float,2>{0.836330473f, 0.229286954f},
-std::array<float,2>{0.92445761f, 0.504976749f},
-std::array<float,2>{0.240430743f, 0.0609444231f},
-std::array<float,2>{0.471181095f, 0.923013151f},
-std::array<float,2>{0.685709596f, 0.392715514f},
-std::array<float,2>{0.707565486f, 0.65039897f},
-std::array<float,2>{0.375412762f, 0.156713396f},
-std::array<float,2>{0.142069668f, 0.785461009f},
-std::array<float,2>{0.968181133f, 0.288171381f},
-std::array<float,2>{0.800868988f, 0.989945769f},
-std::array<float,2>{0.0177018959f, 0.444820046f},
-std::array<float,2>{0.351018786f, 0.591080546f},
-std::array<float,2>{0.556828439f, 0.099580735f},
-std::array<float,2>{0.535828769f, 0.953841925f},
-std::array<float,2>{0.371069372f, 0.47087419f},
-std::array<float,2>{0.00166423037f, 0.612496018f},
-std::array<float,2>{0.789207458f, 0.0877098814f},
-std::array<float,2>{0.939103842f, 0.669653058f},
-std::array<float,2>{0.135225326f, 0.144915447f},
-std::array<float,2>{0.40327096f, 0.766346514f},
-std::array<float,2>{0.696095288f, 0.261104196f},
-std::array<float,2>{0.661120653f, 0.545469046f},
-std::array<float,2>{0.494978279f, 0.0101036141f},
-std::array<float,2>{0.232590139f, 0.879255831f},
-std::array<float,2>{0.910243928f, 0.413016617f},
-std::array<float,2>{0.826457024f, 0.864236891f},
-std::array<float,2>{0.0764504746f, 0.327068657f},
-std::array<float,2>{0.303628892f, 0.721402764f},
-std::array<float,2>{0.573873878f, 0.215979353f},
-std::array<float,2>{0.735823095f, 0.803439558f},
-std::array<float,2>{0.416680694f, 0.309642911f},
-std::array<float,2>{0.180354625f, 0.630902946f},
-std::array<float,2>{0.974676311f, 0.182737052f},
-std::array<float,2>{0.771630466f, 0.577992201f},
-std::array<float,2>{0.0565322116f, 0.11045596f},
-std::array<float,2>{0.335694909f, 0.978269219f},
-std::array<float,2>{0.512249947f, 0.466295719f},
-std::array<float,2>{0.619212389f, 0.69755429f},
-std::array<float,2>{0.269499809f, 0.23602201f},
-std::array<float,2>{0.122496426f, 0.831547618f},
-std::array<float,2>{0.845382512f, 0.343926132f},
-std::array<float,2>{0.883732021f, 0.907481909f},
-std::array<float,2>{0.208129004f, 0.379033685f},
-std::array<float,2>{0.462327749f, 0.518170655f},
-std::array<float,2>{0.640625596f, 0.045708511f},
-std::array<float,2>{0.670953274f, 0.948068082f},
-std::array<float,2>{0.487180263f, 0.488456219f},
-std::array<float,2>{0.221987858f, 0.607393563f},
-std::array<float,2>{0.921593487f, 0.0678803399f},
-std::array<float,2>{0.817616343f, 0.687189996f},
-std::array<float,2>{0.0666029453f, 0.125808015f},
-std::array<float,2>{0.305232316f, 0.762363911f},
-std::array<float,2>{0.565506876f, 0.276476771f},
-std::array<float,2>{0.541246593f, 0.557032228f},
-std::array<float,2>{0.361830801f, 0.0262960698f},
-std::array<float,2>{0.0135374181f, 0.893806458f},
-std::array<float,2>{0.786901951f, 0.43165338f},
-std::array<float,2>{0.949102879f, 0.849315405f},
-std::array<float,2>{0.125845939f, 0.331463873f},
-std::array<float,2>{0.394367784f, 0.746020138f},
-std::array<float,2>{0.694802403f, 0.191973388f},
-std::array<float,2>{0.610047996f, 0.784501433f},
-std::array<float,2>{0.273572266f, 0.283116817f},
-std::array<float,2>{0.11271058f, 0.652371764f},
-std::array<float,2>{0.856509507f, 0.161729231f},
-std::array<float,2>{0.876475394f, 0.586569071f},
-std::array<float,2>{0.211534798f, 0.0939679965f},
-std::array<float,2>{0.458927155f, 0.988053203f},
-std::array<float,2>{0.655924797f, 0.439834923f},
-std::array<float,2>{0.743322909f, 0.706721902f},
-std::array<float,2>{0.408638924f, 0.231098875f},
-std::array<float,2>{0.179099336f, 0.81825316f},
-std::array<float,2>{0.979817033f, 0.362554431f},
-std::array<float,2>{0.779658616f, 0.928727269f},
-std::array<float,2>{0.0538783073f, 0.394605935f},
-std::array<float,2>{0.336125433f, 0.500977397f},
-std::array<float,2>{0.503753006f, 0.0563994832f},
-std::array<float,2>{0.527975321f, 0.878320158f},
-std::array<float,2>{0.326965153f, 0.406944335f},
-std::array<float,2>{0.0313539393f, 0.539983273f},
-std::array<float,2>{0.760360897f, 0.0127064493f},
-std::array<float,2>{0.989773452f, 0.723028123f},
-std::array<float,2>{0.166448221f, 0.211793542f},
-std::array<float,2>{0.437116802f, 0.861932278f},
-std::array<float,2>{0.722413242f, 0.322696418f},
-std::array<float,2>{0.635813832f, 0.613515913f},
-std::array<float,2>{0.439104617f, 0.0931536034f},
-std::array<float,2>{0.201970756f, 0.95824182f},
-std::array<float,2>{0.895224929f, 0.47516939f},
-std::array<float,2>{0.86875701f, 0.772588968f},
-std::array<float,2>{0.108379401f, 0.26558724f},
-std::array<float,2>{0.259900212f, 0.665453196f},
-std::array<float,2>{0.606419742f, 0.1410065f},
-std::array<float,2>{0.712152779f, 0.835536599f},
-std::array<float,2>{0.385950834f, 0.349527419f},
-std::array<float,2>{0.150791466f, 0.702280462f},
-std::array<float,2>{0.96000582f, 0.238715887f},
-std::array<float,2>{0.811536968f, 0.523064792f},
-std::array<float,2>{0.0248165783f, 0.0423175134f},
-std::array<float,2>{0.357586563f, 0.912961245f},
-std::array<float,2>{0.550268233f, 0.377429515f},
-std::array<float,2>{0.588622987f, 0.627214372f},
-std::array<float,2>{0.293363959f, 0.184345275f},
-std::array<float,2>{0.0806663036f, 0.799033046f},
-std::array<float,2>{0.828202128f, 0.307222933f},
-std::array<float,2>{0.936819255f, 0.984075725f},
-std::array<float,2>{0.244341403f, 0.46242252f},
-std::array<float,2>{0.483340561f, 0.573819935f},
-std::array<float,2>{0.676990867f, 0.116022423f},
-std::array<float,2>{0.730869889f, 0.914605677f},
-std::array<float,2>{0.422689527f, 0.386019468f},
-std::array<float,2>{0.16309455f, 0.528860092f},
-std::array<float,2>{0.996352911f, 0.0383703709f},
-std::array<float,2>{0.754384458f, 0.692300916f},
-std::array<float,2>{0.0409104638f, 0.24597849f},
-std::array<float,2>{0.317518562f, 0.839648247f},
-std::array<float,2>{0.517985523f, 0.354622632f},
-std::array<float,2>{0.595550716f, 0.564357758f},
-std::array<float,2>{0.253099114f, 0.12104363f},
-std::array<float,2>{0.100964442f, 0.969566226f},
-std::array<float,2>{0.863687217f, 0.453424662f},
-std::array<float,2>{0.904209197f, 0.807008862f},
-std::array<float,2>{0.189965963f, 0.300857455f},
-std::array<float,2>{0.452001244f, 0.640605986f},
-std::array<float,2>{0.626304328f, 0.176200092f},
-std::array<float,2>{0.558790624f, 0.873870015f},
-std::array<float,2>{0.347017556f, 0.315207541f},
-std::array<float,2>{0.0200059116f, 0.73345536f},
-std::array<float,2>{0.798458338f, 0.205464408f},
-std::array<float,2>{0.964192688f, 0.531751513f},
-std::array<float,2>{0.146257356f, 5.22216251e-05f},
-std::array<float,2>{0.380737156f, 0.888829648f},
-std::array<float,2>{0.703761518f, 0.418215007f},
-std::array<float,2>{0.682594717f, 0.65920192f},
-std::array<float,2>{0.474612653f, 0.148828939f},
-std::array<float,2>{0.237694964f, 0.7759552f},
-std::array<float,2>{0.929233193f, 0.255650938f},
-std::array<float,2>{0.843072057f, 0.966828525f},
-std::array<float,2>{0.093487151f, 0.479984045f},
-std::array<float,2>{0.286963999f, 0.617331862f},
-std::array<float,2>{0.579438388f, 0.0829374492f},
-std::array<float,2>{0.577210426f, 0.999203622f},
-std::array<float,2>{0.298662066f, 0.450270265f},
-std::array<float,2>{0.0706666484f, 0.583961189f},
-std::array<float,2>{0.820353329f, 0.109353125f},
-std::array<float,2>{0.906444728f, 0.644632101f},
-std::array<float,2>{0.228896707f, 0.166684926f},
-std::array<float,2>{0.49647975f, 0.794437706f},
-std::array<float,2>{0.656689107f, 0.295324981f},
-std::array<float,2>{0.70118916f, 0.510022223f},
-std::array<float,2>{0.399396718f, 0.052911859f},
-std::array<float,2>{0.139288574f, 0.935428858f},
-std::array<float,2>{0.941508293f, 0.400784224f},
-std::array<float,2>{0.795615554f, 0.82231003f},
-std::array<float,2>{0.0053547537f, 0.368378133f},
-std::array<float,2>{0.371739417f, 0.717314363f},
-std::array<float,2>{0.534334362f, 0.219315469f},
-std::array<float,2>{0.647945046f, 0.756040812f},
-std::array<float,2>{0.468483686f, 0.267528355f},
-std::array<float,2>{0.20343478f, 0.67876333f},
-std::array<float,2>{0.8874107f, 0.140586302f},
-std::array<float,2>{0.85007602f, 0.59534198f},
-std::array<float,2>{0.118207961f, 0.0722689033f},
-std::array<float,2>{0.271295995f, 0.938032925f},
-std::array<float,2>{0.621109009f, 0.493107826f},
-std::array<float,2>{0.509764493f, 0.740420341f},
-std::array<float,2>{0.331077516f, 0.201724604f},
-std::array<float,2>{0.0616227575f, 0.851897538f},
-std::array<float,2>{0.767463386f, 0.339199573f},
-std::array<float,2>{0.97122848f, 0.898685515f},
-std::array<float,2>{0.186913937f, 0.426786274f},
-std::array<float,2>{0.41807282f, 0.552309513f},
-std::array<float,2>{0.739989519f, 0.0174172185f},
-std::array<float,2>{0.747350693f, 0.962413132f},
-std::array<float,2>{0.413413852f, 0.481144994f},
-std::array<float,2>{0.174074784f, 0.624382615f},
-std::array<float,2>{0.982786834f, 0.0807204023f},
-std::array<float,2>{0.77671653f, 0.660528839f},
-std::array<float,2>{0.0501056015f, 0.154215947f},
-std::array<float,2>{0.342876226f, 0.778028727f},
-std::array<float,2>{0.505333006f, 0.251663595f},
-std::array<float,2>{0.614595056f, 0.536665678f},
-std::array<float,2>{0.281176001f, 0.0064950441f},
-std::array<float,2>{0.115815178f, 0.883151293f},
-std::array<float,2>{0.853630424f, 0.415235817f},
-std::array<float,2>{0.880531609f, 0.870981693f},
-std::array<float,2>{0.218531996f, 0.316933066f},
-std::array<float,2>{0.455525726f, 0.726741374f},
-std::array<float,2>{0.649553239f, 0.207925886f},
-std::array<float,2>{0.545386732f, 0.810914695f},
-std::array<float,2>{0.363721699f, 0.300042778f},
-std::array<float,2>{0.0103491144f, 0.633906662f},
-std::array<float,2>{0.783755124f, 0.172264129f},
-std::array<float,2>{0.952938616f, 0.567719698f},
-std::array<float,2>{0.129862487f, 0.124912202f},
-std::array<float,2>{0.396868795f, 0.974057436f},
-std::array<float,2>{0.690603971f, 0.459583431f},
-std::array<float,2>{0.664957762f, 0.690141797f},
-std::array<float,2>{0.48834753f, 0.249951214f},
-std::array<float,2>{0.223154724f, 0.842497528f},
-std::array<float,2>{0.915386677f, 0.355747849f},
-std::array<float,2>{0.81556493f, 0.921537757f},
-std::array<float,2>{0.0625826791f, 0.38919726f},
-std::array<float,2>{0.310767323f, 0.524187326f},
-std::array<float,2>{0.569135964f, 0.0322145075f},
-std::array<float,2>{0.591379642f, 0.90487808f},
-std::array<float,2>{0.290062457f, 0.424940884f},
-std::array<float,2>{0.0824282169f, 0.547873497f},
-std::array<float,2>{0.834038913f, 0.0205426104f},
-std::array<float,2>{0.933302104f, 0.738150358f},
-std::array<float,2>{0.24988699f, 0.196164176f},
-std::array<float,2>{0.480237782f, 0.858888865f},
-std::array<float,2>{0.67289865f, 0.342510402f},
-std::array<float,2>{0.718499303f, 0.600952446f},
-std::array<float,2>{0.389793783f, 0.0754714459f},
-std::array<float,2>{0.155583099f, 0.943736672f},
-std::array<float,2>{0.956171572f, 0.496875733f},
-std::array<float,2>{0.807396173f, 0.752029657f},
-std::array<float,2>{0.0281635132f, 0.270361811f},
-std::array<float,2>{0.355370432f, 0.672611356f},
-std::array<float,2>{0.554126084f, 0.133742511f},
-std::array<float,2>{0.637425184f, 0.825032294f},
-std::array<float,2>{0.441786975f, 0.37205258f},
-std::array<float,2>{0.19693628f, 0.71216315f},
-std::array<float,2>{0.892812431f, 0.22301954f},
-std::array<float,2>{0.872432351f, 0.514591336f},
-std::array<float,2>{0.102801085f, 0.0472205803f},
-std::array<float,2>{0.262063265f, 0.933057547f},
-std::array<float,2>{0.601872087f, 0.403451383f},
-std::array<float,2>{0.524968028f, 0.643292844f},
-std::array<float,2>{0.322814345f, 0.168886766f},
-std::array<float,2>{0.0356647782f, 0.792028785f},
-std::array<float,2>{0.761855066f, 0.289856583f},
-std::array<float,2>{0.98535037f, 0.995839655f},
-std::array<float,2>{0.168782443f, 0.447717041f},
-std::array<float,2>{0.429944396f, 0.579482496f},
-std::array<float,2>{0.7249071f, 0.104116939f},
-std::array<float,2>{0.685091496f, 0.924096584f},
-std::array<float,2>{0.469662696f, 0.391124189f},
-std::array<float,2>{0.239328086f, 0.506703913f},
-std::array<float,2>{0.923295796f, 0.0588460118f},
-std::array<float,2>{0.83897537f, 0.707655847f},
-std::array<float,2>{0.0888098329f, 0.227294937f},
-std::array<float,2>{0.281753808f, 0.814827383f},
-std::array<float,2>{0.584094584f, 0.366483361f},
-std::array<float,2>{0.556638777f, 0.593232632f},
-std::array<float,2>{0.348790079f, 0.101296887f},
-std::array<float,2>{0.0164587814f, 0.99121213f},
-std::array<float,2>{0.803414345f, 0.442405999f},
-std::array<float,2>{0.966279626f, 0.788538039f},
-std::array<float,2>{0.143178344f, 0.286072016f},
-std::array<float,2>{0.378435045f, 0.650217772f},
-std::array<float,2>{0.710776329f, 0.159497678f},
-std::array<float,2>{0.600226164f, 0.847380221f},
-std::array<float,2>{0.256698519f, 0.334964871f},
-std::array<float,2>{0.0938769057f, 0.748438418f},
-std::array<float,2>{0.861268878f, 0.189263359f},
-std::array<float,2>{0.900288343f, 0.561021388f},
-std::array<float,2>{0.193101555f, 0.030753037f},
-std::array<float,2>{0.448403209f, 0.898189187f},
-std::array<float,2>{0.629274368f, 0.437170476f},
-std::array<float,2>{0.727639198f, 0.681541204f},
-std::array<float,2>{0.427288562f, 0.132305428f},
-std::array<float,2>{0.157742545f, 0.760517895f},
-std::array<float,2>{0.992311239f, 0.277894527f},
-std::array<float,2>{0.750901759f, 0.95040834f},
-std::array<float,2>{0.0431458168f, 0.487140685f},
-std::array<float,2>{0.313173264f, 0.602739155f},
-std::array<float,2>{0.522903621f, 0.0647240281f},
-std::array<float,2>{0.515447199f, 0.979331672f},
-std::array<float,2>{0.333670467f, 0.467101008f},
-std::array<float,2>{0.0577982478f, 0.575648785f},
-std::array<float,2>{0.771173716f, 0.112487674f},
-std::array<float,2>{0.972890437f, 0.630344868f},
-std::array<float,2>{0.182753995f, 0.179815426f},
-std::array<float,2>{0.415954024f, 0.801813602f},
-std::array<float,2>{0.736540735f, 0.312174797f},
-std::array<float,2>{0.643493474f, 0.51600194f},
-std::array<float,2>{0.46454224f, 0.0447247885f},
-std::array<float,2>{0.209926754f, 0.908424675f},
-std::array<float,2>{0.886617303f, 0.381518483f},
-std::array<float,2>{0.846651554f, 0.828583241f},
-std::array<float,2>{0.124992631f, 0.346053869f},
-std::array<float,2>{0.266570002f, 0.695324004f},
-std::array<float,2>{0.61736989f, 0.237128541f},
-std::array<float,2>{0.697877109f, 0.76947242f},
-std::array<float,2>{0.404571444f, 0.259347618f},
-std::array<float,2>{0.133800015f, 0.67032367f},
-std::array<float,2>{0.941324413f, 0.147773921f},
-std::array<float,2>{0.79147321f, 0.609510899f},
-std::array<float,2>{0.00300778449f, 0.0880672857f},
-std::array<float,2>{0.367433906f, 0.956908464f},
-std::array<float,2>{0.537298679f, 0.469548106f},
-std::array<float,2>{0.571090639f, 0.720184982f},
-std::array<float,2>{0.301574439f, 0.217869699f},
-std::array<float,2>{0.0760709867f, 0.865463793f},
-std::array<float,2>{0.825954258f, 0.324660867f},
-std::array<float,2>{0.913101852f, 0.880907595f},
-std::array<float,2>{0.231193677f, 0.411356509f},
-std::array<float,2>{0.49384433f, 0.543311238f},
-std::array<float,2>{0.662303507f, 0.00925133377f},
-std::array<float,2>{0.652652621f, 0.98593992f},
-std::array<float,2>{0.460457355f, 0.437689424f},
-std::array<float,2>{0.214500785f, 0.588951647f},
-std::array<float,2>{0.878098845f, 0.0957561508f},
-std::array<float,2>{0.858449101f, 0.655465603f},
-std::array<float,2>{0.1104661f, 0.162363335f},
-std::array<float,2>{0.277328014f, 0.782432497f},
-std::array<float,2>{0.612408161f, 0.284592777f},
-std::array<float,2>{0.501045763f, 0.502861917f},
-std::array<float,2>{0.338516742f, 0.0582941361f},
-std::array<float,2>{0.0522031374f, 0.926350653f},
-std::array<float,2>{0.778716385f, 0.396581113f},
-std::array<float,2>{0.976703703f, 0.819596171f},
-std::array<float,2>{0.176265195f, 0.359912932f},
-std::array<float,2>{0.406798422f, 0.704142153f},
-std::array<float,2>{0.744876444f, 0.234160095f},
-std::array<float,2>{0.563190818f, 0.765342832f},
-std::array<float,2>{0.30814603f, 0.274122655f},
-std::array<float,2>{0.0684758425f, 0.685481906f},
-std::array<float,2>{0.819080114f, 0.128696576f},
-std::array<float,2>{0.919436097f, 0.609301209f},
-std::array<float,2>{0.219994068f, 0.0699847266f},
-std::array<float,2>{0.48462072f, 0.946406543f},
-std::array<float,2>{0.668661237f, 0.491565138f},
-std::array<float,2>{0.692377031f, 0.742824793f},
-std::array<float,2>{0.392180026f, 0.193361312f},
-std::array<float,2>{0.128852338f, 0.850114584f},
-std::array<float,2>{0.946732759f, 0.329176188f},
-std::array<float,2>{0.788565874f, 0.89222455f},
-std::array<float,2>{0.0148059539f, 0.430308253f},
-std::array<float,2>{0.360082537f, 0.555801034f},
-std::array<float,2>{0.540221035f, 0.0250958167f},
-std::array<float,2>{0.548254371f, 0.911338925f},
-std::array<float,2>{0.356780052f, 0.375768572f},
-std::array<float,2>{0.0260445103f, 0.520586908f},
-std::array<float,2>{0.809558213f, 0.0392279886f},
-std::array<float,2>{0.958215356f, 0.699587107f},
-std::array<float,2>{0.150080368f, 0.241345689f},
-std::array<float,2>{0.383711636f, 0.832505345f},
-std::array<float,2>{0.713510334f, 0.351100922f},
-std::array<float,2>{0.678310215f, 0.570729971f},
-std::array<float,2>{0.481354803f, 0.114832684f},
-std::array<float,2>{0.242966443f, 0.981601894f},
-std::array<float,2>{0.935279369f, 0.463892728f},
-std::array<float,2>{0.831776679f, 0.798453987f},
-std::array<float,2>{0.0797478929f, 0.306479514f},
-std::array<float,2>{0.295191437f, 0.626834095f},
-std::array<float,2>{0.586795866f, 0.186536118f},
-std::array<float,2>{0.719344378f, 0.860810101f},
-std::array<float,2>{0.435046583f, 0.321953326f},
-std::array<float,2>{0.165330797f, 0.72507149f},
-std::array<float,2>{0.991937101f, 0.213366807f},
-std::array<float,2>{0.758817971f, 0.541254997f},
-std::array<float,2>{0.0338614658f, 0.0138529409f},
-std::array<float,2>{0.324985176f, 0.875895977f},
-std::array<float,2>{0.5307253f, 0.409923941f},
-std::array<float,2>{0.607823014f, 0.666111529f},
-std::array<float,2>{0.258331925f, 0.142634735f},
-std::array<float,2>{0.106728718f, 0.771449208f},
-std::array<float,2>{0.869709074f, 0.261959881f},
-std::array<float,2>{0.89665246f, 0.960167587f},
-std::array<float,2>{0.199340761f, 0.474355817f},
-std::array<float,2>{0.439767182f, 0.616957843f},
-std::array<float,2>{0.634420693f, 0.091253072f},
-std::array<float,2>{0.705529034f, 0.886844277f},
-std::array<float,2>{0.381394714f, 0.420186102f},
-std::array<float,2>{0.146553442f, 0.534571826f},
-std::array<float,2>{0.961961031f, 0.0024956502f},
-std::array<float,2>{0.799177706f, 0.730510831f},
-std::array<float,2>{0.0231073312f, 0.203337684f},
-std::array<float,2>{0.344604373f, 0.872986972f},
-std::array<float,2>{0.562321186f, 0.313924223f},
-std::array<float,2>{0.580715775f, 0.620808184f},
-std::array<float,2>{0.287293553f, 0.0853756666f},
-std::array<float,2>{0.0908965915f, 0.965221107f},
-std::array<float,2>{0.840504885f, 0.477205843f},
-std::array<float,2>{0.927155972f, 0.773853064f},
-std::array<float,2>{0.235982195f, 0.256318539f},
-std::array<float,2>{0.474116713f, 0.656699777f},
-std::array<float,2>{0.6816172f, 0.152017176f},
-std::array<float,2>{0.515913427f, 0.837027669f},
-std::array<float,2>{0.319389969f, 0.351860136f},
-std::array<float,2>{0.0428249873f, 0.694297254f},
-std::array<float,2>{0.756680131f, 0.24246873f},
-std::array<float,2>{0.99937892f, 0.530997694f},
-std::array<float,2>{0.160683334f, 0.0353288986f},
-std::array<float,2>{0.424698174f, 0.916201115f},
-std::array<float,2>{0.733666778f, 0.384061754f},
-std::array<float,2>{0.628121257f, 0.638093174f},
-std::array<float,2>{0.450300604f, 0.178648129f},
-std::array<float,2>{0.188829079f, 0.805746496f},
-std::array<float,2>{0.90436542f, 0.303072572f},
-std::array<float,2>{0.866525054f, 0.97265023f},
-std::array<float,2>{0.0983710214f, 0.455450445f},
-std::array<float,2>{0.251503974f, 0.566246808f},
-std::array<float,2>{0.597428501f, 0.117967278f},
-std::array<float,2>{0.623867989f, 0.940502703f},
-std::array<float,2>{0.272405654f, 0.496065438f},
-std::array<float,2>{0.119595423f, 0.597590268f},
-std::array<float,2>{0.847816467f, 0.0703716204f},
-std::array<float,2>{0.88910991f, 0.676521719f},
-std::array<float,2>{0.205531612f, 0.13782081f},
-std::array<float,2>{0.465045333f, 0.755841851f},
-std::array<float,2>{0.645219028f, 0.267905086f},
-std::array<float,2>{0.740551293f, 0.553376734f},
-std::array<float,2>{0.420848906f, 0.0185743533f},
-std::array<float,2>{0.185136184f, 0.902338922f},
-std::array<float,2>{0.968984783f, 0.427903563f},
-std::array<float,2>{0.768153012f, 0.854210138f},
-std::array<float,2>{0.0592810772f, 0.337304711f},
-std::array<float,2>{0.329021692f, 0.739638984f},
-std::array<float,2>{0.511684239f, 0.199934617f},
-std::array<float,2>{0.658753872f, 0.796214104f},
-std::array<float,2>{0.4991754f, 0.2930713f},
-std::array<float,2>{0.227923319f, 0.646581829f},
-std::array<float,2>{0.908993125f, 0.16410026f},
-std::array<float,2>{0.822459757f, 0.585404575f},
-std::array<float,2>{0.0727255642f, 0.105767563f},
-std::array<float,2>{0.299534649f, 0.996991336f},
-std::array<float,2>{0.575968623f, 0.451544613f},
-std::array<float,2>{0.533082485f, 0.715635538f},
-std::array<float,2>{0.373705983f, 0.221438929f},
-std::array<float,2>{0.00673297001f, 0.821341455f},
-std::array<float,2>{0.794610381f, 0.370667875f},
-std::array<float,2>{0.94338131f, 0.937266827f},
-std::array<float,2>{0.13709861f, 0.399618715f},
-std::array<float,2>{0.400912434f, 0.509438813f},
-std::array<float,2>{0.699331343f, 0.0516024493f},
-std::array<float,2>{0.726014435f, 0.993129373f},
-std::array<float,2>{0.430945396f, 0.445896626f},
-std::array<float,2>{0.169720232f, 0.581365705f},
-std::array<float,2>{0.986105144f, 0.101769179f},
-std::array<float,2>{0.762798369f, 0.641425014f},
-std::array<float,2>{0.0366424508f, 0.170757607f},
-std::array<float,2>{0.323971748f, 0.790690064f},
-std::array<float,2>{0.524315715f, 0.291178167f},
-std::array<float,2>{0.60326308f, 0.513444066f},
-std::array<float,2>{0.263381839f, 0.0493102856f},
-std::array<float,2>{0.101948403f, 0.931443095f},
-std::array<float,2>{0.871722698f, 0.404890507f},
-std::array<float,2>{0.893595636f, 0.827309906f},
-std::array<float,2>{0.196138695f, 0.373372883f},
-std::array<float,2>{0.442493469f, 0.714624465f},
-std::array<float,2>{0.638467431f, 0.225216001f},
-std::array<float,2>{0.553663969f, 0.750463724f},
-std::array<float,2>{0.353657514f, 0.272493035f},
-std::array<float,2>{0.0287368633f, 0.67513299f},
-std::array<float,2>{0.808386564f, 0.135111138f},
-std::array<float,2>{0.955633819f, 0.597792685f},
-std::array<float,2>{0.155093983f, 0.0774275139f},
-std::array<float,2>{0.389244556f, 0.941683412f},
-std::array<float,2>{0.716881871f, 0.498588115f},
-std::array<float,2>{0.672793329f, 0.73589462f},
-std::array<float,2>{0.478524804f, 0.197934628f},
-std::array<float,2>{0.248310953f, 0.85572964f},
-std::array<float,2>{0.932151139f, 0.339862317f},
-std::array<float,2>{0.835898757f, 0.903266072f},
-std::array<float,2>{0.0833467841f, 0.423309624f},
-std::array<float,2>{0.289377093f, 0.548963249f},
-std::array<float,2>{0.590810597f, 0.0220494587f},
-std::array<float,2>{0.570008516f, 0.919345498f},
-std::array<float,2>{0.311945379f, 0.387421221f},
-std::array<float,2>{0.0642188489f, 0.527025878f},
-std::array<float,2>{0.81466943f, 0.034110155f},
-std::array<float,2>{0.914110959f, 0.687671661f},
-std::array<float,2>{0.224188671f, 0.24733448f},
-std::array<float,2>{0.489874989f, 0.840373337f},
-std::array<float,2>{0.665853798f, 0.358899564f},
-std::array<float,2>{0.68955189f, 0.569363356f},
-std::array<float,2>{0.398104221f, 0.122379012f},
-std::array<float,2>{0.13078773f, 0.976339102f},
-std::array<float,2>{0.951390922f, 0.457225949f},
-std::array<float,2>{0.784264505f, 0.810444117f},
-std::array<float,2>{0.010954218f, 0.297232479f},
-std::array<float,2>{0.364846319f, 0.636005878f},
-std::array<float,2>{0.54628247f, 0.175498307f},
-std::array<float,2>{0.648907483f, 0.867671251f},
-std::array<float,2>{0.456579715f, 0.318938226f},
-std::array<float,2>{0.216836616f, 0.730094433f},
-std::array<float,2>{0.879208922f, 0.20910345f},
-std::array<float,2>{0.854651034f, 0.537383437f},
-std::array<float,2>{0.11672014f, 0.00548899081f},
-std::array<float,2>{0.279953152f, 0.884843111f},
-std::array<float,2>{0.613962054f, 0.417088598f},
-std::array<float,2>{0.50443691f, 0.663441777f},
-std::array<float,2>{0.342689335f, 0.1554057f},
-std::array<float,2>{0.0488402843f, 0.780427814f},
-std::array<float,2>{0.776162148f, 0.253260344f},
-std::array<float,2>{0.983689308f, 0.964594603f},
-std::array<float,2>{0.175703406f, 0.483142793f},
-std::array<float,2>{0.412146062f, 0.621418297f},
-std::array<float,2>{0.746902466f, 0.0797475949f},
-std::array<float,2>{0.663238943f, 0.880377889f},
-std::array<float,2>{0.492511183f, 0.413300216f},
-std::array<float,2>{0.23159346f, 0.546007335f},
-std::array<float,2>{0.912351489f, 0.0114957923f},
-std::array<float,2>{0.824226022f, 0.721774399f},
-std::array<float,2>{0.0742253438f, 0.215793088f},
-std::array<float,2>{0.302345335f, 0.864848912f},
-std::array<float,2>{0.571825922f, 0.327323407f},
-std::array<float,2>{0.538478851f, 0.611530244f},
-std::array<float,2>{0.368425965f, 0.0864177942f},
-std::array<float,2>{0.00257920218f, 0.954889596f},
-std::array<float,2>{0.792357922f, 0.472360164f},
-std::array<float,2>{0.939900875f, 0.767394841f},
-std::array<float,2>{0.133519143f, 0.259835839f},
-std::array<float,2>{0.406038254f, 0.668742061f},
-std::array<float,2>{0.698702216f, 0.145924702f},
-std::array<float,2>{0.618276894f, 0.830444634f},
-std::array<float,2>{0.267299175f, 0.345284253f},
-std::array<float,2>{0.123951875f, 0.698417604f},
-std::array<float,2>{0.847082317f, 0.235016271f},
-std::array<float,2>{0.884935498f, 0.519132137f},
-std::array<float,2>{0.210798815f, 0.0465328582f},
-std::array<float,2>{0.463790089f, 0.906357348f},
-std::array<float,2>{0.644201159f, 0.380614251f},
-std::array<float,2>{0.737330675f, 0.632272005f},
-std::array<float,2>{0.41503641f, 0.182304442f},
-std::array<float,2>{0.181660771f, 0.804386675f},
-std::array<float,2>{0.973869979f, 0.309174091f},
-std::array<float,2>{0.770403206f, 0.977088273f},
-std::array<float,2>{0.0575006604f, 0.465408832f},
-std::array<float,2>{0.332397729f, 0.576439559f},
-std::array<float,2>{0.514187038f, 0.110131003f},
-std::array<float,2>{0.521916389f, 0.951204002f},
-std::array<float,2>{0.313785911f, 0.485960037f},
-std::array<float,2>{0.0448586829f, 0.604583859f},
-std::array<float,2>{0.751852453f, 0.0634841844f},
-std::array<float,2>{0.993566573f, 0.682266295f},
-std::array<float,2>{0.156539381f, 0.129665986f},
-std::array<float,2>{0.426131934f, 0.758954525f},
-std::array<float,2>{0.72682476f, 0.280792594f},
-std::array<float,2>{0.6300475f, 0.559417784f},
-std::array<float,2>{0.447596014f, 0.0278231911f},
-std::array<float,2>{0.191886857f, 0.895892739f},
-std::array<float,2>{0.89898932f, 0.435531378f},
-std::array<float,2>{0.859380245f, 0.84377867f},
-std::array<float,2>{0.0948245376f, 0.33290121f},
-std::array<float,2>{0.257741362f, 0.747277379f},
-std::array<float,2>{0.600810409f, 0.190851972f},
-std::array<float,2>{0.709202409f, 0.78700465f},
-std::array<float,2>{0.377249002f, 0.28779915f},
-std::array<float,2>{0.144045383f, 0.652230263f},
-std::array<float,2>{0.965324104f, 0.157831147f},
-std::array<float,2>{0.804300368f, 0.590304792f},
-std::array<float,2>{0.0173947327f, 0.0982444584f},
-std::array<float,2>{0.348474324f, 0.989196777f},
-std::array<float,2>{0.554955602f, 0.443543345f},
-std::array<float,2>{0.585284293f, 0.709664583f},
-std::array<float,2>{0.282426447f, 0.23036024f},
-std::array<float,2>{0.0893686488f, 0.813630521f},
-std::array<float,2>{0.838351369f, 0.364643455f},
-std::array<float,2>{0.922815382f, 0.922644675f},
-std::array<float,2>{0.238584146f, 0.393834442f},
-std::array<float,2>{0.470578074f, 0.50473386f},
-std::array<float,2>{0.683682203f, 0.0622624606f},
-std::array<float,2>{0.633470953f, 0.957324684f},
-std::array<float,2>{0.440669239f, 0.476479948f},
-std::array<float,2>{0.201129913f, 0.614938557f},
-std::array<float,2>{0.89788121f, 0.0921451673f},
-std::array<float,2>{0.87067765f, 0.664331794f},
-std::array<float,2>{0.106424354f, 0.141969457f},
-std::array<float,2>{0.259557009f, 0.771760285f},
-std::array<float,2>{0.609216332f, 0.264601499f},
-std::array<float,2>{0.530081391f, 0.540522039f},
-std::array<float,2>{0.325682759f, 0.0120843314f},
-std::array<float,2>{0.0345853902f, 0.877010584f},
-std::array<float,2>{0.757938504f, 0.407557458f},
-std::array<float,2>{0.990418196f, 0.862993181f},
-std::array<float,2>{0.16426912f, 0.323815256f},
-std::array<float,2>{0.433951735f, 0.724543273f},
-std::array<float,2>{0.720558465f, 0.211994007f},
-std::array<float,2>{0.587883413f, 0.800251544f},
-std::array<float,2>{0.29630062f, 0.308372706f},
-std::array<float,2>{0.0790995583f, 0.628344774f},
-std::array<float,2>{0.830277145f, 0.184704065f},
-std::array<float,2>{0.934119761f, 0.572703779f},
-std::array<float,2>{0.243522167f, 0.116641112f},
-std::array<float,2>{0.481642336f, 0.982828021f},
-std::array<float,2>{0.678765535f, 0.461055547f},
-std::array<float,2>{0.71425885f, 0.701957464f},
-std::array<float,2>{0.384689271f, 0.239752024f},
-std::array<float,2>{0.148526967f, 0.834400654f},
-std::array<float,2>{0.957214415f, 0.347678393f},
-std::array<float,2>{0.810380518f, 0.913107097f},
-std::array<float,2>{0.0264740493f, 0.378164887f},
-std::array<float,2>{0.356155604f, 0.521549821f},
-std::array<float,2>{0.547151268f, 0.0410315581f},
-std::array<float,2>{0.539319754f, 0.892816544f},
-std::array<float,2>{0.360678792f, 0.43357721f},
-std::array<float,2>{0.0142576573f, 0.557731032f},
-std::array<float,2>{0.787896454f, 0.02718856f},
-std::array<float,2>{0.945773542f, 0.744996786f},
-std::array<float,2>{0.127248913f, 0.192396075f},
-std::array<float,2>{0.391007721f, 0.848558605f},
-std::array<float,2>{0.692819536f, 0.330386221f},
-std::array<float,2>{0.669896603f, 0.606189311f},
-std::array<float,2>{0.485843927f, 0.0665465295f},
-std::array<float,2>{0.218849912f, 0.949178457f},
-std::array<float,2>{0.91882807f, 0.489630818f},
-std::array<float,2>{0.819997787f, 0.762749732f},
-std::array<float,2>{0.069787398f, 0.276162565f},
-std::array<float,2>{0.307543874f, 0.685983956f},
-std::array<float,2>{0.563730717f, 0.126758367f},
-std::array<float,2>{0.745387852f, 0.817358255f},
-std::array<float,2>{0.40789482f, 0.361619055f},
-std::array<float,2>{0.176972806f, 0.705268443f},
-std::array<float,2>{0.977788389f, 0.232316524f},
-std::array<float,2>{0.777637661f, 0.500359774f},
-std::array<float,2>{0.0512392633f, 0.0551328324f},
-std::array<float,2>{0.339839071f, 0.928641438f},
-std::array<float,2>{0.500493288f, 0.39563331f},
-std::array<float,2>{0.611721635f, 0.654214442f},
-std::array<float,2>{0.275728911f, 0.160311535f},
-std::array<float,2>{0.109871164f, 0.783593357f},
-std::array<float,2>{0.858248174f, 0.281745493f},
-std::array<float,2>{0.877096832f, 0.987252176f},
-std::array<float,2>{0.213053197f, 0.441097379f},
-std::array<float,2>{0.4595671f, 0.587741733f},
-std::array<float,2>{0.653624117f, 0.0950643644f},
-std::array<float,2>{0.700544834f, 0.93445313f},
-std::array<float,2>{0.401560903f, 0.402187109f},
-std::array<float,2>{0.138327733f, 0.511458993f},
-std::array<float,2>{0.945059776f, 0.0542147271f},
-std::array<float,2>{0.793304801f, 0.717835069f},
-std::array<float,2>{0.00778672472f, 0.220160946f},
-std::array<float,2>{0.374465734f, 0.823469818f},
-std::array<float,2>{0.531361401f, 0.367772669f},
-std::array<float,2>{0.574473917f, 0.582164168f},
-std::array<float,2>{0.300019115f, 0.107896931f},
-std::array<float,2>{0.0735970587f, 0.998978674f},
-std::array<float,2>{0.824054241f, 0.450109959f},
-std::array<float,2>{0.909711421f, 0.793250978f},
-std::array<float,2>{0.226861954f, 0.295941144f},
-std::array<float,2>{0.498715729f, 0.646093547f},
-std::array<float,2>{0.66005671f, 0.167803794f},
-std::array<float,2>{0.509995997f, 0.852569282f},
-std::array<float,2>{0.329190582f, 0.338009566f},
-std::array<float,2>{0.0600589812f, 0.74144274f},
-std::array<float,2>{0.768792927f, 0.202890396f},
-std::array<float,2>{0.970221698f, 0.551146567f},
-std::array<float,2>{0.183912158f, 0.0159536973f},
-std::array<float,2>{0.421783954f, 0.900199056f},
-std::array<float,2>{0.741970241f, 0.426127881f},
-std::array<float,2>{0.645915568f, 0.677947879f},
-std::array<float,2>{0.466494828f, 0.138948157f},
-std::array<float,2>{0.206182599f, 0.75736779f},
-std::array<float,2>{0.890062451f, 0.265790075f},
-std::array<float,2>{0.849475324f, 0.938875794f},
-std::array<float,2>{0.120354593f, 0.493855357f},
-std::array<float,2>{0.27284193f, 0.593778908f},
-std::array<float,2>{0.624257743f, 0.0739162862f},
-std::array<float,2>{0.596134126f, 0.970561922f},
-std::array<float,2>{0.25069502f, 0.454625428f},
-std::array<float,2>{0.098843433f, 0.56284374f},
-std::array<float,2>{0.865876198f, 0.119796582f},
-std::array<float,2>{0.905465722f, 0.63954556f},
-std::array<float,2>{0.188015401f, 0.176946968f},
-std::array<float,2>{0.44933185f, 0.807666421f},
-std::array<float,2>{0.627325058f, 0.302234828f},
-std::array<float,2>{0.733386219f, 0.527435601f},
-std::array<float,2>{0.424996048f, 0.0374110714f},
-std::array<float,2>{0.161965817f, 0.915757596f},
-std::array<float,2>{0.998269856f, 0.385353684f},
-std::array<float,2>{0.757524669f, 0.838656545f},
-std::array<float,2>{0.0418432504f, 0.35354358f},
-std::array<float,2>{0.318934381f, 0.692950428f},
-std::array<float,2>{0.517326951f, 0.244512081f},
-std::array<float,2>{0.679767549f, 0.777122498f},
-std::array<float,2>{0.473166555f, 0.254879653f},
-std::array<float,2>{0.234491006f, 0.659163892f},
-std::array<float,2>{0.926741004f, 0.149902463f},
-std::array<float,2>{0.841332912f, 0.6189152f},
-std::array<float,2>{0.0901102573f, 0.083251901f},
-std::array<float,2>{0.288419038f, 0.967850149f},
-std::array<float,2>{0.581877112f, 0.479049355f},
-std::array<float,2>{0.560878038f, 0.733044624f},
-std::array<float,2>{0.344768941f, 0.206115186f},
-std::array<float,2>{0.0221836418f, 0.874286711f},
-std::array<float,2>{0.800423324f, 0.315907538f},
-std::array<float,2>{0.961909592f, 0.890211999f},
-std::array<float,2>{0.147797525f, 0.419421077f},
-std::array<float,2>{0.381888807f, 0.533099055f},
-std::array<float,2>{0.706911027f, 0.00161313941f},
-std::array<float,2>{0.71549964f, 0.944478631f},
-std::array<float,2>{0.386980385f, 0.497382373f},
-std::array<float,2>{0.153259873f, 0.600530446f},
-std::array<float,2>{0.953682184f, 0.0745363086f},
-std::array<float,2>{0.805539131f, 0.673572898f},
-std::array<float,2>{0.0304021388f, 0.134730577f},
-std::array<float,2>{0.351928771f, 0.753821969f},
-std::array<float,2>{0.552632928f, 0.27109161f},
-std::array<float,2>{0.593109965f, 0.547281504f},
-std::array<float,2>{0.292041898f, 0.0198351741f},
-std::array<float,2>{0.0852426961f, 0.905639589f},
-std::array<float,2>{0.832900405f, 0.42468518f},
-std::array<float,2>{0.931012809f, 0.858227491f},
-std::array<float,2>{0.247143626f, 0.342801452f},
-std::array<float,2>{0.477244347f, 0.736466706f},
-std::array<float,2>{0.675335109f, 0.197069719f},
-std::array<float,2>{0.526922464f, 0.791297495f},
-std::array<float,2>{0.322109163f, 0.290512025f},
-std::array<float,2>{0.038593214f, 0.643706083f},
-std::array<float,2>{0.765099645f, 0.169423699f},
-std::array<float,2>{0.986699104f, 0.578167558f},
-std::array<float,2>{0.171746805f, 0.104998127f},
-std::array<float,2>{0.43291384f, 0.99414283f},
-std::array<float,2>{0.723193228f, 0.449003696f},
-std::array<float,2>{0.640081823f, 0.711063981f},
-std::array<float,2>{0.444719166f, 0.223777294f},
-std::array<float,2>{0.198231444f, 0.82585454f},
-std::array<float,2>{0.891779721f, 0.37290749f},
-std::array<float,2>{0.873637378f, 0.932030797f},
-std::array<float,2>{0.104058757f, 0.402487576f},
-std::array<float,2>{0.264715344f, 0.515258968f},
-std::array<float,2>{0.603963494f, 0.0481990539f},
-std::array<float,2>{0.617122889f, 0.883899629f},
-std::array<float,2>{0.278347284f, 0.414461851f},
-std::array<float,2>{0.114668526f, 0.535240173f},
-std::array<float,2>{0.85182941f, 0.00709689315f},
-std::array<float,2>{0.881908059f, 0.727992773f},
-std::array<float,2>{0.216331214f, 0.208604231f},
-std::array<float,2>{0.45395571f, 0.86914432f},
-std::array<float,2>{0.651003778f, 0.317808539f},
-std::array<float,2>{0.748486221f, 0.623799622f},
-std::array<float,2>{0.411963016f, 0.0813854411f},
-std::array<float,2>{0.173430219f, 0.961874902f},
-std::array<float,2>{0.981209278f, 0.481706113f},
-std::array<float,2>{0.775200546f, 0.779243112f},
-std::array<float,2>{0.0469318777f, 0.250560731f},
-std::array<float,2>{0.341737151f, 0.661753953f},
-std::array<float,2>{0.507157445f, 0.153005049f},
-std::array<float,2>{0.667079329f, 0.843432069f},
-std::array<float,2>{0.490739822f, 0.356578827f},
-std::array<float,2>{0.224613041f, 0.691373527f},
-std::array<float,2>{0.916951358f, 0.248286858f},
-std::array<float,2>{0.812984467f, 0.524769783f},
-std::array<float,2>{0.0662781447f, 0.0323044136f},
-std::array<float,2>{0.309888333f, 0.920762837f},
-std::array<float,2>{0.567184627f, 0.390029341f},
-std::array<float,2>{0.543859899f, 0.633723497f},
-std::array<float,2>{0.36693871f, 0.173809275f},
-std::array<float,2>{0.00798989926f, 0.812388718f},
-std::array<float,2>{0.781621456f, 0.29892388f},
-std::array<float,2>{0.949246585f, 0.972957253f},
-std::array<float,2>{0.131594226f, 0.460731834f},
-std::array<float,2>{0.394914567f, 0.566786289f},
-std::array<float,2>{0.68857491f, 0.123123989f},
-std::array<float,2>{0.641699195f, 0.909230232f},
-std::array<float,2>{0.46161437f, 0.38206023f},
-std::array<float,2>{0.207757249f, 0.517150402f},
-std::array<float,2>{0.884037137f, 0.0431576781f},
-std::array<float,2>{0.844148397f, 0.697130322f},
-std::array<float,2>{0.121443935f, 0.238131389f},
-std::array<float,2>{0.268314391f, 0.829440117f},
-std::array<float,2>{0.620938182f, 0.347522289f},
-std::array<float,2>{0.513420761f, 0.575012028f},
-std::array<float,2>{0.334406614f, 0.112130135f},
-std::array<float,2>{0.0552211069f, 0.979816318f},
-std::array<float,2>{0.773303986f, 0.468203664f},
-std::array<float,2>{0.976452649f, 0.801018298f},
-std::array<float,2>{0.181260809f, 0.311364114f},
-std::array<float,2>{0.417287469f, 0.62980628f},
-std::array<float,2>{0.734546065f, 0.180965826f},
-std::array<float,2>{0.572913527f, 0.866350114f},
-std::array<float,2>{0.304414362f, 0.325991422f},
-std::array<float,2>{0.0775544792f, 0.719662368f},
-std::array<float,2>{0.827479362f, 0.216960639f},
-std::array<float,2>{0.911672413f, 0.544290423f},
-std::array<float,2>{0.233549371f, 0.0086866403f},
-std::array<float,2>{0.49518007f, 0.8825894f},
-std::array<float,2>{0.661463082f, 0.410671741f},
-std::array<float,2>{0.696750462f, 0.671643794f},
-std::array<float,2>{0.404158145f, 0.146830887f},
-std::array<float,2>{0.136430115f, 0.768218935f},
-std::array<float,2>{0.937652886f, 0.258331954f},
-std::array<float,2>{0.7907511f, 0.955566466f},
-std::array<float,2>{0.000738581177f, 0.470150799f},
-std::array<float,2>{0.36944437f, 0.610768437f},
-std::array<float,2>{0.536305189f, 0.0896589905f},
-std::array<float,2>{0.557993054f, 0.990688384f},
-std::array<float,2>{0.349994242f, 0.44214806f},
-std::array<float,2>{0.0187507793f, 0.592013597f},
-std::array<float,2>{0.801781058f, 0.0997064412f},
-std::array<float,2>{0.966846645f, 0.649373055f},
-std::array<float,2>{0.140792757f, 0.158736572f},
-std::array<float,2>{0.376093388f, 0.78734225f},
-std::array<float,2>{0.708715737f, 0.286724985f},
-std::array<float,2>{0.687490106f, 0.507430017f},
-std::array<float,2>{0.471857637f, 0.0603634045f},
-std::array<float,2>{0.241433337f, 0.925684333f},
-std::array<float,2>{0.925634027f, 0.392444223f},
-std::array<float,2>{0.837370217f, 0.816067874f},
-std::array<float,2>{0.0873602405f, 0.365417153f},
-std::array<float,2>{0.284666777f, 0.708490193f},
-std::array<float,2>{0.582983434f, 0.228404805f},
-std::array<float,2>{0.729130685f, 0.761083186f},
-std::array<float,2>{0.429140598f, 0.278414905f},
-std::array<float,2>{0.160105199f, 0.679899991f},
-std::array<float,2>{0.99544102f, 0.131101206f},
-std::array<float,2>{0.7536273f, 0.602046907f},
-std::array<float,2>{0.0461608134f, 0.0661192164f},
-std::array<float,2>{0.315902442f, 0.949595571f},
-std::array<float,2>{0.521372676f, 0.487580538f},
-std::array<float,2>{0.599402845f, 0.749438047f},
-std::array<float,2>{0.254846156f, 0.18832469f},
-std::array<float,2>{0.0975205377f, 0.846502304f},
-std::array<float,2>{0.861606956f, 0.334224284f},
-std::array<float,2>{0.900826573f, 0.89655292f},
-std::array<float,2>{0.194162771f, 0.43623367f},
-std::array<float,2>{0.446317047f, 0.561543286f},
-std::array<float,2>{0.632640064f, 0.0294074118f},
-std::array<float,2>{0.676151454f, 0.980526328f},
-std::array<float,2>{0.484302133f, 0.463415861f},
-std::array<float,2>{0.245502099f, 0.572249174f},
-std::array<float,2>{0.935780227f, 0.113471761f},
-std::array<float,2>{0.829667091f, 0.625147164f},
-std::array<float,2>{0.0813195035f, 0.186094373f},
-std::array<float,2>{0.294747651f, 0.79728353f},
-std::array<float,2>{0.589689553f, 0.305218458f},
-std::array<float,2>{0.549575448f, 0.519555449f},
-std::array<float,2>{0.35859251f, 0.0403074957f},
-std::array<float,2>{0.0242517255f, 0.910586119f},
-std::array<float,2>{0.810785055f, 0.376271337f},
-std::array<float,2>{0.959807158f, 0.833442867f},
-std::array<float,2>{0.151823148f, 0.349948794f},
-std::array<float,2>{0.385485679f, 0.701023459f},
-std::array<float,2>{0.710950613f, 0.240268692f},
-std::array<float,2>{0.606765091f, 0.770059943f},
-std::array<float,2>{0.261644006f, 0.263374925f},
-std::array<float,2>{0.108409278f, 0.667024493f},
-std::array<float,2>{0.867680013f, 0.143705741f},
-std::array<float,2>{0.896314979f, 0.615976036f},
-std::array<float,2>{0.203081369f, 0.0905855745f},
-std::array<float,2>{0.438298345f, 0.959443092f},
-std::array<float,2>{0.635665476f, 0.473437279f},
-std::array<float,2>{0.721556246f, 0.726232171f},
-std::array<float,2>{0.436144054f, 0.213959053f},
-std::array<float,2>{0.167524889f, 0.860086799f},
-std::array<float,2>{0.988309026f, 0.320906669f},
-std::array<float,2>{0.760972738f, 0.876951277f},
-std::array<float,2>{0.0327703096f, 0.408355802f},
-std::array<float,2>{0.327510417f, 0.542462111f},
-std::array<float,2>{0.528461933f, 0.0147683835f},
-std::array<float,2>{0.502383351f, 0.927389503f},
-std::array<float,2>{0.337082654f, 0.397655457f},
-std::array<float,2>{0.0528649539f, 0.503815293f},
-std::array<float,2>{0.780586362f, 0.0571514107f},
-std::array<float,2>{0.979193389f, 0.703570068f},
-std::array<float,2>{0.178374559f, 0.233134642f},
-std::array<float,2>{0.409708381f, 0.818489492f},
-std::array<float,2>{0.74311012f, 0.361290723f},
-std::array<float,2>{0.65433532f, 0.588430285f},
-std::array<float,2>{0.45783484f, 0.0974668637f},
-std::array<float,2>{0.21192944f, 0.984716415f},
-std::array<float,2>{0.875402212f, 0.438726902f},
-std::array<float,2>{0.856015861f, 0.781848371f},
-std::array<float,2>{0.1117737f, 0.284017622f},
-std::array<float,2>{0.274675936f, 0.654678881f},
-std::array<float,2>{0.610805035f, 0.163436443f},
-std::array<float,2>{0.693624377f, 0.850626171f},
-std::array<float,2>{0.39304775f, 0.328607529f},
-std::array<float,2>{0.126531124f, 0.743208468f},
-std::array<float,2>{0.94783932f, 0.194855645f},
-std::array<float,2>{0.785234988f, 0.554965079f},
-std::array<float,2>{0.0118841063f, 0.0243435279f},
-std::array<float,2>{0.362573683f, 0.890866816f},
-std::array<float,2>{0.54249841f, 0.430744946f},
-std::array<float,2>{0.564908683f, 0.684363246f},
-std::array<float,2>{0.305731058f, 0.127240226f},
-std::array<float,2>{0.0676710904f, 0.76400423f},
-std::array<float,2>{0.817301929f, 0.27478826f},
-std::array<float,2>{0.920439184f, 0.945880234f},
-std::array<float,2>{0.22167246f, 0.490446717f},
-std::array<float,2>{0.488049388f, 0.608336866f},
-std::array<float,2>{0.670040905f, 0.0690592453f},
-std::array<float,2>{0.73925221f, 0.901116848f},
-std::array<float,2>{0.419572681f, 0.429508716f},
-std::array<float,2>{0.185581863f, 0.554158449f},
-std::array<float,2>{0.971956372f, 0.0184685197f},
-std::array<float,2>{0.766386688f, 0.739024818f},
-std::array<float,2>{0.0605743788f, 0.200244948f},
-std::array<float,2>{0.330591917f, 0.854565382f},
-std::array<float,2>{0.508194506f, 0.336037755f},
-std::array<float,2>{0.622164309f, 0.595935106f},
-std::array<float,2>{0.270447403f, 0.071756579f},
-std::array<float,2>{0.117705509f, 0.940349698f},
-std::array<float,2>{0.851328075f, 0.49498722f},
-std::array<float,2>{0.887981176f, 0.753995001f},
-std::array<float,2>{0.205036983f, 0.269503474f},
-std::array<float,2>{0.467418224f, 0.677472055f},
-std::array<float,2>{0.646534562f, 0.137402698f},
-std::array<float,2>{0.534105301f, 0.820914149f},
-std::array<float,2>{0.372628719f, 0.370062888f},
-std::array<float,2>{0.00457229698f, 0.716466904f},
-std::array<float,2>{0.79675597f, 0.221739158f},
-std::array<float,2>{0.942965209f, 0.508562684f},
-std::array<float,2>{0.140185446f, 0.0519385487f},
-std::array<float,2>{0.400353551f, 0.936481297f},
-std::array<float,2>{0.702579796f, 0.398673505f},
-std::array<float,2>{0.657287717f, 0.647623062f},
-std::array<float,2>{0.497776538f, 0.165963009f},
-std::array<float,2>{0.230335593f, 0.795895159f},
-std::array<float,2>{0.907325089f, 0.294184387f},
-std::array<float,2>{0.822054565f, 0.997704327f},
-std::array<float,2>{0.0718063787f, 0.453094572f},
-std::array<float,2>{0.296955675f, 0.584572494f},
-std::array<float,2>{0.576777279f, 0.106700711f},
-std::array<float,2>{0.578685522f, 0.966731548f},
-std::array<float,2>{0.285472989f, 0.478023589f},
-std::array<float,2>{0.0918494985f, 0.619764745f},
-std::array<float,2>{0.842388213f, 0.084106341f},
-std::array<float,2>{0.927850187f, 0.657506287f},
-std::array<float,2>{0.236792311f, 0.151074886f},
-std::array<float,2>{0.475722402f, 0.775372148f},
-std::array<float,2>{0.682703197f, 0.257030934f},
-std::array<float,2>{0.704947054f, 0.533576369f},
-std::array<float,2>{0.37953192f, 0.00350140664f},
-std::array<float,2>{0.145270064f, 0.888424277f},
-std::array<float,2>{0.963293791f, 0.421124518f},
-std::array<float,2>{0.79751122f, 0.871680558f},
-std::array<float,2>{0.0209945533f, 0.313000172f},
-std::array<float,2>{0.345724195f, 0.731533527f},
-std::array<float,2>{0.560120463f, 0.205017477f},
-std::array<float,2>{0.625726581f, 0.805568397f},
-std::array<float,2>{0.452662945f, 0.303800225f},
-std::array<float,2>{0.190914378f, 0.637594521f},
-std::array<float,2>{0.902469456f, 0.179639027f},
-std::array<float,2>{0.864659905f, 0.5651173f},
-std::array<float,2>{0.0999935195f, 0.118873395f},
-std::array<float,2>{0.252781034f, 0.97092557f},
-std::array<float,2>{0.594238997f, 0.456616133f},
-std::array<float,2>{0.519230187f, 0.695192218f},
-std::array<float,2>{0.317122668f, 0.243317306f},
-std::array<float,2>{0.0391625017f, 0.836619616f},
-std::array<float,2>{0.755734026f, 0.353385657f},
-std::array<float,2>{0.997429907f, 0.917689383f},
-std::array<float,2>{0.162725627f, 0.383498341f},
-std::array<float,2>{0.423164696f, 0.530258954f},
-std::array<float,2>{0.731624544f, 0.0368979201f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.898986936f, 0.393223971f},
-std::array<float,2>{0.00888076052f, 0.540561318f},
-std::array<float,2>{0.514217079f, 0.955020785f},
-std::array<float,2>{0.338318527f, 0.220375285f},
-std::array<float,2>{0.640570223f, 0.0469920449f},
-std::array<float,2>{0.493208438f, 0.839665651f},
-std::array<float,2>{0.831969261f, 0.727674663f},
-std::array<float,2>{0.180949882f, 0.251736403f},
-std::array<float,2>{0.800906003f, 0.180589318f},
-std::array<float,2>{0.197144076f, 0.878074527f},
-std::array<float,2>{0.695733607f, 0.591648281f},
-std::array<float,2>{0.387798756f, 0.453074217f},
-std::array<float,2>{0.60663867f, 0.31723249f},
-std::array<float,2>{0.261005104f, 0.634696901f},
-std::array<float,2>{0.960410833f, 0.790519595f},
-std::array<float,2>{0.0801269859f, 0.0744235069f},
-std::array<float,2>{0.849892795f, 0.310971826f},
-std::array<float,2>{0.146705464f, 0.712178528f},
-std::array<float,2>{0.658377886f, 0.854327202f},
-std::array<float,2>{0.447112024f, 0.00246843509f},
-std::array<float,2>{0.557000518f, 0.210892096f},
-std::array<float,2>{0.352553934f, 0.992724419f},
-std::array<float,2>{0.934548736f, 0.530812025f},
-std::array<float,2>{0.035573557f, 0.430976301f},
-std::array<float,2>{0.992935181f, 0.100591265f},
-std::array<float,2>{0.120644711f, 0.760149598f},
-std::array<float,2>{0.567443907f, 0.675739944f},
-std::array<float,2>{0.305590868f, 0.351792246f},
-std::array<float,2>{0.748817444f, 0.46909681f},
-std::array<float,2>{0.415787846f, 0.612405598f},
-std::array<float,2>{0.760907412f, 0.92774266f},
-std::array<float,2>{0.238161892f, 0.151600763f},
-std::array<float,2>{0.772199452f, 0.468705714f},
-std::array<float,2>{0.233618379f, 0.57430017f},
-std::array<float,2>{0.733777225f, 0.894770563f},
-std::array<float,2>{0.435710639f, 0.164916411f},
-std::array<float,2>{0.580350578f, 0.0784950107f},
-std::array<float,2>{0.281404883f, 0.800827146f},
-std::array<float,2>{0.974746466f, 0.641024292f},
-std::array<float,2>{0.106663443f, 0.333363712f},
-std::array<float,2>{0.913690031f, 0.245207086f},
-std::array<float,2>{0.0610505566f, 0.945878923f},
-std::array<float,2>{0.536282361f, 0.548984826f},
-std::array<float,2>{0.362346113f, 0.388047278f},
-std::array<float,2>{0.687295675f, 0.275193125f},
-std::array<float,2>{0.467231393f, 0.742702067f},
-std::array<float,2>{0.874735653f, 0.813488901f},
-std::array<float,2>{0.125637099f, 0.0335143618f},
-std::array<float,2>{0.952853262f, 0.373460233f},
-std::array<float,2>{0.0625204295f, 0.662681699f},
-std::array<float,2>{0.6247679f, 0.780075788f},
-std::array<float,2>{0.273715258f, 0.117609404f},
-std::array<float,2>{0.704164922f, 0.137718171f},
-std::array<float,2>{0.402012914f, 0.921422482f},
-std::array<float,2>{0.795496583f, 0.601229012f},
-std::array<float,2>{0.213386312f, 0.497850418f},
-std::array<float,2>{0.823988259f, 0.0214192998f},
-std::array<float,2>{0.158826247f, 0.873197675f},
-std::array<float,2>{0.644720376f, 0.694312274f},
-std::array<float,2>{0.475513458f, 0.286791921f},
-std::array<float,2>{0.530325353f, 0.409476489f},
-std::array<float,2>{0.318415374f, 0.510889947f},
-std::array<float,2>{0.889838159f, 0.972069442f},
-std::array<float,2>{0.0194596294f, 0.193002775f},
-std::array<float,2>{0.977332413f, 0.489044517f},
-std::array<float,2>{0.0940987095f, 0.602474272f},
-std::array<float,2>{0.590944827f, 0.911427796f},
-std::array<float,2>{0.292689502f, 0.126219347f},
-std::array<float,2>{0.722530365f, 0.111760795f},
-std::array<float,2>{0.425046116f, 0.769332051f},
-std::array<float,2>{0.776593387f, 0.667875707f},
-std::array<float,2>{0.219434321f, 0.360792935f},
-std::array<float,2>{0.866447926f, 0.198471025f},
-std::array<float,2>{0.137675613f, 0.978880167f},
-std::array<float,2>{0.679651558f, 0.503813326f},
-std::array<float,2>{0.455569834f, 0.414521903f},
-std::array<float,2>{0.54276669f, 0.29304266f},
-std::array<float,2>{0.367480576f, 0.702614069f},
-std::array<float,2>{0.914977252f, 0.860784769f},
-std::array<float,2>{0.0509483591f, 0.0273132864f},
-std::array<float,2>{0.783038676f, 0.340043575f},
-std::array<float,2>{0.208667383f, 0.652164578f},
-std::array<float,2>{0.716338575f, 0.811197042f},
-std::array<float,2>{0.394509822f, 0.0873836577f},
-std::array<float,2>{0.615107119f, 0.161465019f},
-std::array<float,2>{0.272010863f, 0.903437316f},
-std::array<float,2>{0.939167082f, 0.568193197f},
-std::array<float,2>{0.0759260803f, 0.456295192f},
-std::array<float,2>{0.878376961f, 0.0411809832f},
-std::array<float,2>{0.0282025952f, 0.828023195f},
-std::array<float,2>{0.51703757f, 0.73973465f},
-std::array<float,2>{0.327759326f, 0.26630342f},
-std::array<float,2>{0.650878012f, 0.381855577f},
-std::array<float,2>{0.4788827f, 0.555796683f},
-std::array<float,2>{0.815586746f, 0.938763559f},
-std::array<float,2>{0.166754812f, 0.234402999f},
-std::array<float,2>{0.838887572f, 0.42527014f},
-std::array<float,2>{0.174000174f, 0.515655398f},
-std::array<float,2>{0.625493884f, 0.988579214f},
-std::array<float,2>{0.489782482f, 0.218730345f},
-std::array<float,2>{0.505314827f, 0.00965104811f},
-std::array<float,2>{0.331092745f, 0.847469926f},
-std::array<float,2>{0.897123992f, 0.703606725f},
-std::array<float,2>{0.00336864893f, 0.304582089f},
-std::array<float,2>{0.96110642f, 0.140787154f},
-std::array<float,2>{0.0868724436f, 0.931870997f},
-std::array<float,2>{0.600843132f, 0.619658351f},
-std::array<float,2>{0.250075221f, 0.478125811f},
-std::array<float,2>{0.689848721f, 0.346612871f},
-std::array<float,2>{0.377571195f, 0.683264434f},
-std::array<float,2>{0.808103442f, 0.756747305f},
-std::array<float,2>{0.187600642f, 0.10179352f},
-std::array<float,2>{0.924623966f, 0.262883127f},
-std::array<float,2>{0.043886181f, 0.723972619f},
-std::array<float,2>{0.549819887f, 0.830842435f},
-std::array<float,2>{0.344165534f, 0.0572023839f},
-std::array<float,2>{0.664165616f, 0.228709176f},
-std::array<float,2>{0.441440821f, 0.961370647f},
-std::array<float,2>{0.851633132f, 0.533756554f},
-std::array<float,2>{0.155694082f, 0.398899853f},
-std::array<float,2>{0.751071274f, 0.0637259111f},
-std::array<float,2>{0.244470939f, 0.78586489f},
-std::array<float,2>{0.741264284f, 0.630957365f},
-std::array<float,2>{0.406960726f, 0.324388236f},
-std::array<float,2>{0.576420605f, 0.440863848f},
-std::array<float,2>{0.302539349f, 0.583938122f},
-std::array<float,2>{0.988589942f, 0.884728372f},
-std::array<float,2>{0.115136899f, 0.175967067f},
-std::array<float,2>{0.920088887f, 0.449115723f},
-std::array<float,2>{0.0491700135f, 0.589771748f},
-std::array<float,2>{0.545721769f, 0.880713999f},
-std::array<float,2>{0.372746646f, 0.186505899f},
-std::array<float,2>{0.673712432f, 0.0705526993f},
-std::array<float,2>{0.460637391f, 0.796774149f},
-std::array<float,2>{0.860889733f, 0.63780421f},
-std::array<float,2>{0.135624483f, 0.315739512f},
-std::array<float,2>{0.780006289f, 0.22365436f},
-std::array<float,2>{0.225173414f, 0.960357487f},
-std::array<float,2>{0.725691855f, 0.543344498f},
-std::array<float,2>{0.428445876f, 0.397091806f},
-std::array<float,2>{0.588975787f, 0.256829947f},
-std::array<float,2>{0.296665817f, 0.730631709f},
-std::array<float,2>{0.982960582f, 0.8406654f},
-std::array<float,2>{0.100445531f, 0.0537981577f},
-std::array<float,2>{0.817975044f, 0.357135832f},
-std::array<float,2>{0.167994455f, 0.677316427f},
-std::array<float,2>{0.654914975f, 0.763358116f},
-std::array<float,2>{0.482579648f, 0.0955060199f},
-std::array<float,2>{0.523052156f, 0.152543068f},
-std::array<float,2>{0.322116822f, 0.923463166f},
-std::array<float,2>{0.881692231f, 0.614014387f},
-std::array<float,2>{0.0238201916f, 0.473962247f},
-std::array<float,2>{0.945077837f, 0.00558802905f},
-std::array<float,2>{0.073038578f, 0.855993807f},
-std::array<float,2>{0.610547304f, 0.717798233f},
-std::array<float,2>{0.269320577f, 0.305577338f},
-std::array<float,2>{0.711441755f, 0.436398715f},
-std::array<float,2>{0.395005763f, 0.5269835f},
-std::array<float,2>{0.788559079f, 0.997054636f},
-std::array<float,2>{0.205561772f, 0.203907296f},
-std::array<float,2>{0.809364259f, 0.384515643f},
-std::array<float,2>{0.193592444f, 0.552705467f},
-std::array<float,2>{0.692080438f, 0.949880123f},
-std::array<float,2>{0.380001545f, 0.24913083f},
-std::array<float,2>{0.595893145f, 0.0374930985f},
-std::array<float,2>{0.257633924f, 0.818508446f},
-std::array<float,2>{0.967854738f, 0.748490214f},
-std::array<float,2>{0.0920081139f, 0.280129969f},
-std::array<float,2>{0.894213796f, 0.168356389f},
-std::array<float,2>{0.005201119f, 0.89217931f},
-std::array<float,2>{0.500406981f, 0.572509885f},
-std::array<float,2>{0.333896518f, 0.463108957f},
-std::array<float,2>{0.632244766f, 0.331717491f},
-std::array<float,2>{0.486178935f, 0.645116389f},
-std::array<float,2>{0.841521144f, 0.798801303f},
-std::array<float,2>{0.179404169f, 0.0857534111f},
-std::array<float,2>{0.988158047f, 0.283408701f},
-std::array<float,2>{0.11171627f, 0.691140473f},
-std::array<float,2>{0.573998988f, 0.870692909f},
-std::array<float,2>{0.298811197f, 0.0179246385f},
-std::array<float,2>{0.736341596f, 0.190523267f},
-std::array<float,2>{0.410209209f, 0.973870933f},
-std::array<float,2>{0.757221758f, 0.512480557f},
-std::array<float,2>{0.247591987f, 0.413512915f},
-std::array<float,2>{0.855865419f, 0.123034365f},
-std::array<float,2>{0.15200156f, 0.774184704f},
-std::array<float,2>{0.668037474f, 0.656466544f},
-std::array<float,2>{0.440557957f, 0.36825949f},
-std::array<float,2>{0.552800834f, 0.495774776f},
-std::array<float,2>{0.348228633f, 0.597257257f},
-std::array<float,2>{0.9295277f, 0.91549629f},
-std::array<float,2>{0.0413744226f, 0.134610608f},
-std::array<float,2>{0.954662204f, 0.420856476f},
-std::array<float,2>{0.0852260739f, 0.507377803f},
-std::array<float,2>{0.60417372f, 0.98069489f},
-std::array<float,2>{0.26405111f, 0.200719401f},
-std::array<float,2>{0.702791214f, 0.0288017765f},
-std::array<float,2>{0.384932309f, 0.86589247f},
-std::array<float,2>{0.799197495f, 0.696631134f},
-std::array<float,2>{0.200725317f, 0.289535195f},
-std::array<float,2>{0.834791303f, 0.130426466f},
-std::array<float,2>{0.186069682f, 0.906308353f},
-std::array<float,2>{0.633494675f, 0.607743323f},
-std::array<float,2>{0.498535603f, 0.485131711f},
-std::array<float,2>{0.511622369f, 0.366910994f},
-std::array<float,2>{0.342217207f, 0.669172823f},
-std::array<float,2>{0.90397495f, 0.769927382f},
-std::array<float,2>{0.0131208431f, 0.113606766f},
-std::array<float,2>{0.763399184f, 0.272052348f},
-std::array<float,2>{0.240984336f, 0.7374295f},
-std::array<float,2>{0.742871881f, 0.822446287f},
-std::array<float,2>{0.419917911f, 0.0448683277f},
-std::array<float,2>{0.562881827f, 0.241364986f},
-std::array<float,2>{0.311043024f, 0.944597483f},
-std::array<float,2>{0.996838272f, 0.559253216f},
-std::array<float,2>{0.123526119f, 0.377068311f},
-std::array<float,2>{0.932879329f, 0.091877535f},
-std::array<float,2>{0.0339964181f, 0.805766463f},
-std::array<float,2>{0.561215401f, 0.655958712f},
-std::array<float,2>{0.35615927f, 0.337793678f},
-std::array<float,2>{0.660661995f, 0.458495945f},
-std::array<float,2>{0.452405274f, 0.564738572f},
-std::array<float,2>{0.847510099f, 0.898948431f},
-std::array<float,2>{0.141335145f, 0.158145115f},
-std::array<float,2>{0.870693922f, 0.483917624f},
-std::array<float,2>{0.131248325f, 0.624931157f},
-std::array<float,2>{0.680576444f, 0.935710132f},
-std::array<float,2>{0.463810712f, 0.1477734f},
-std::array<float,2>{0.533028424f, 0.109156214f},
-std::array<float,2>{0.366705269f, 0.750496864f},
-std::array<float,2>{0.908795953f, 0.685227215f},
-std::array<float,2>{0.0555118881f, 0.347749829f},
-std::array<float,2>{0.971856892f, 0.213540152f},
-std::array<float,2>{0.103297472f, 0.987026453f},
-std::array<float,2>{0.583737791f, 0.520987749f},
-std::array<float,2>{0.285582125f, 0.429251015f},
-std::array<float,2>{0.729260087f, 0.299414933f},
-std::array<float,2>{0.432445556f, 0.708203077f},
-std::array<float,2>{0.768342018f, 0.8499704f},
-std::array<float,2>{0.226931348f, 0.0134323407f},
-std::array<float,2>{0.886351466f, 0.322349191f},
-std::array<float,2>{0.0227142647f, 0.627099633f},
-std::array<float,2>{0.524868429f, 0.785079896f},
-std::array<float,2>{0.315505952f, 0.0669821426f},
-std::array<float,2>{0.643966377f, 0.174696445f},
-std::array<float,2>{0.469380826f, 0.888649881f},
-std::array<float,2>{0.824464142f, 0.581360817f},
-std::array<float,2>{0.162028313f, 0.44417271f},
-std::array<float,2>{0.792832613f, 0.0609139018f},
-std::array<float,2>{0.218097433f, 0.834348917f},
-std::array<float,2>{0.71026957f, 0.720760703f},
-std::array<float,2>{0.404186517f, 0.260571629f},
-std::array<float,2>{0.617801905f, 0.404053003f},
-std::array<float,2>{0.279367477f, 0.535991251f},
-std::array<float,2>{0.947129428f, 0.966943264f},
-std::array<float,2>{0.0687508509f, 0.231059238f},
-std::array<float,2>{0.936156571f, 0.433009118f},
-std::array<float,2>{0.0390204489f, 0.527822554f},
-std::array<float,2>{0.556148112f, 0.995451093f},
-std::array<float,2>{0.354219228f, 0.207969263f},
-std::array<float,2>{0.657109201f, 0.000447443861f},
-std::array<float,2>{0.448372751f, 0.85308367f},
-std::array<float,2>{0.848923683f, 0.713523149f},
-std::array<float,2>{0.144718841f, 0.309749573f},
-std::array<float,2>{0.759514391f, 0.148619905f},
-std::array<float,2>{0.235007912f, 0.926616132f},
-std::array<float,2>{0.748033881f, 0.61055851f},
-std::array<float,2>{0.416397363f, 0.470742553f},
-std::array<float,2>{0.568767726f, 0.353856087f},
-std::array<float,2>{0.307503462f, 0.673826575f},
-std::array<float,2>{0.995953977f, 0.759514093f},
-std::array<float,2>{0.118993439f, 0.0983150825f},
-std::array<float,2>{0.829335928f, 0.253601253f},
-std::array<float,2>{0.181837574f, 0.730360448f},
-std::array<float,2>{0.638642669f, 0.837196171f},
-std::array<float,2>{0.494168282f, 0.0488998704f},
-std::array<float,2>{0.513101816f, 0.222094432f},
-std::array<float,2>{0.337632954f, 0.955943406f},
-std::array<float,2>{0.902227283f, 0.54222095f},
-std::array<float,2>{0.0106040826f, 0.391030699f},
-std::array<float,2>{0.957645416f, 0.0777527094f},
-std::array<float,2>{0.0798569247f, 0.791896522f},
-std::array<float,2>{0.607533038f, 0.63609314f},
-std::array<float,2>{0.258630365f, 0.319930226f},
-std::array<float,2>{0.698023498f, 0.449279785f},
-std::array<float,2>{0.389488041f, 0.593619466f},
-std::array<float,2>{0.803585112f, 0.876928449f},
-std::array<float,2>{0.199127868f, 0.182654202f},
-std::array<float,2>{0.794615209f, 0.499657452f},
-std::array<float,2>{0.210978851f, 0.599290609f},
-std::array<float,2>{0.705951989f, 0.919206619f},
-std::array<float,2>{0.398769021f, 0.139515623f},
-std::array<float,2>{0.621183634f, 0.119711258f},
-std::array<float,2>{0.276700139f, 0.778091013f},
-std::array<float,2>{0.949977577f, 0.662087858f},
-std::array<float,2>{0.0660289973f, 0.371245116f},
-std::array<float,2>{0.887251377f, 0.193767399f},
-std::array<float,2>{0.0171010308f, 0.968932033f},
-std::array<float,2>{0.527513564f, 0.508328259f},
-std::array<float,2>{0.317393869f, 0.40635398f},
-std::array<float,2>{0.648053408f, 0.287899047f},
-std::array<float,2>{0.474531323f, 0.69209218f},
-std::array<float,2>{0.822190285f, 0.871804416f},
-std::array<float,2>{0.157730758f, 0.0223102458f},
-std::array<float,2>{0.973399997f, 0.335419387f},
-std::array<float,2>{0.108084455f, 0.643311858f},
-std::array<float,2>{0.579959333f, 0.803580225f},
-std::array<float,2>{0.284772784f, 0.0801634789f},
-std::array<float,2>{0.732298017f, 0.166074008f},
-std::array<float,2>{0.435318798f, 0.896860182f},
-std::array<float,2>{0.770282745f, 0.576540053f},
-std::array<float,2>{0.230735749f, 0.465007424f},
-std::array<float,2>{0.871730924f, 0.0319929533f},
-std::array<float,2>{0.127244934f, 0.815510571f},
-std::array<float,2>{0.684716225f, 0.745753109f},
-std::array<float,2>{0.466136873f, 0.277300477f},
-std::array<float,2>{0.537297368f, 0.39054662f},
-std::array<float,2>{0.359845161f, 0.548028171f},
-std::array<float,2>{0.91070801f, 0.947984815f},
-std::array<float,2>{0.0588704348f, 0.243324697f},
-std::array<float,2>{0.940537155f, 0.454280108f},
-std::array<float,2>{0.07798706f, 0.569336176f},
-std::array<float,2>{0.615863919f, 0.905140758f},
-std::array<float,2>{0.270532042f, 0.162341744f},
-std::array<float,2>{0.718155205f, 0.0894704089f},
-std::array<float,2>{0.390987217f, 0.809340239f},
-std::array<float,2>{0.784405649f, 0.649629653f},
-std::array<float,2>{0.21072273f, 0.342134565f},
-std::array<float,2>{0.814193428f, 0.236465231f},
-std::array<float,2>{0.164091617f, 0.941099524f},
-std::array<float,2>{0.650125444f, 0.557139814f},
-std::array<float,2>{0.476987988f, 0.379918486f},
-std::array<float,2>{0.519030511f, 0.268333793f},
-std::array<float,2>{0.325308293f, 0.741235137f},
-std::array<float,2>{0.876217127f, 0.825362623f},
-std::array<float,2>{0.0311984606f, 0.0393899269f},
-std::array<float,2>{0.77417171f, 0.361752272f},
-std::array<float,2>{0.222191215f, 0.665791571f},
-std::array<float,2>{0.719832242f, 0.765926063f},
-std::array<float,2>{0.423237205f, 0.110048018f},
-std::array<float,2>{0.59249872f, 0.127076373f},
-std::array<float,2>{0.290865421f, 0.913370967f},
-std::array<float,2>{0.980355382f, 0.60357666f},
-std::array<float,2>{0.0970335901f, 0.49071753f},
-std::array<float,2>{0.916021705f, 0.0240474287f},
-std::array<float,2>{0.0542850047f, 0.86138767f},
-std::array<float,2>{0.539975643f, 0.70039326f},
-std::array<float,2>{0.369399518f, 0.296500802f},
-std::array<float,2>{0.677083611f, 0.416689903f},
-std::array<float,2>{0.453581393f, 0.501712322f},
-std::array<float,2>{0.864662528f, 0.976735592f},
-std::array<float,2>{0.13985616f, 0.196777537f},
-std::array<float,2>{0.853567362f, 0.401891112f},
-std::array<float,2>{0.153893784f, 0.532847345f},
-std::array<float,2>{0.667752564f, 0.963499308f},
-std::array<float,2>{0.444756031f, 0.226618662f},
-std::array<float,2>{0.548054099f, 0.0558101796f},
-std::array<float,2>{0.346534759f, 0.830018401f},
-std::array<float,2>{0.922624946f, 0.725857794f},
-std::array<float,2>{0.0453086719f, 0.265191674f},
-std::array<float,2>{0.991980374f, 0.17807731f},
-std::array<float,2>{0.115297981f, 0.886560738f},
-std::array<float,2>{0.575202465f, 0.584355474f},
-std::array<float,2>{0.304582924f, 0.439336717f},
-std::array<float,2>{0.739512384f, 0.326894194f},
-std::array<float,2>{0.409031689f, 0.630821168f},
-std::array<float,2>{0.752487659f, 0.788485467f},
-std::array<float,2>{0.242754206f, 0.0652327016f},
-std::array<float,2>{0.894629419f, 0.30272615f},
-std::array<float,2>{0.000770949235f, 0.705231369f},
-std::array<float,2>{0.507401943f, 0.844155192f},
-std::array<float,2>{0.329958409f, 0.0111686215f},
-std::array<float,2>{0.627342403f, 0.215872109f},
-std::array<float,2>{0.492007703f, 0.991913736f},
-std::array<float,2>{0.837425053f, 0.519127429f},
-std::array<float,2>{0.173677102f, 0.42359826f},
-std::array<float,2>{0.805879951f, 0.103829384f},
-std::array<float,2>{0.191105381f, 0.754769385f},
-std::array<float,2>{0.688655317f, 0.680902481f},
-std::array<float,2>{0.375996679f, 0.34459427f},
-std::array<float,2>{0.599380612f, 0.478984773f},
-std::array<float,2>{0.252194345f, 0.619115472f},
-std::array<float,2>{0.963621438f, 0.930860996f},
-std::array<float,2>{0.0879191533f, 0.144512579f},
-std::array<float,2>{0.879537404f, 0.474868596f},
-std::array<float,2>{0.0260046553f, 0.616468966f},
-std::array<float,2>{0.519625962f, 0.925250709f},
-std::array<float,2>{0.322992742f, 0.154538423f},
-std::array<float,2>{0.653621912f, 0.0975967422f},
-std::array<float,2>{0.482261181f, 0.764162362f},
-std::array<float,2>{0.819011271f, 0.678473651f},
-std::array<float,2>{0.171364665f, 0.358942628f},
-std::array<float,2>{0.785316229f, 0.206013396f},
-std::array<float,2>{0.203877732f, 0.998317778f},
-std::array<float,2>{0.713554502f, 0.524387598f},
-std::array<float,2>{0.397326112f, 0.434390545f},
-std::array<float,2>{0.612406492f, 0.308358848f},
-std::array<float,2>{0.26673454f, 0.715082824f},
-std::array<float,2>{0.943107009f, 0.858951032f},
-std::array<float,2>{0.0718872026f, 0.00761418091f},
-std::array<float,2>{0.863143921f, 0.312624186f},
-std::array<float,2>{0.133847639f, 0.638809383f},
-std::array<float,2>{0.674115539f, 0.794506013f},
-std::array<float,2>{0.458930731f, 0.0740233064f},
-std::array<float,2>{0.544470847f, 0.184614286f},
-std::array<float,2>{0.373260409f, 0.881494343f},
-std::array<float,2>{0.918992698f, 0.586396158f},
-std::array<float,2>{0.0476186089f, 0.446276456f},
-std::array<float,2>{0.981950104f, 0.0515482016f},
-std::array<float,2>{0.0987802446f, 0.841875792f},
-std::array<float,2>{0.587126255f, 0.734243274f},
-std::array<float,2>{0.294511944f, 0.254695088f},
-std::array<float,2>{0.723513842f, 0.395594835f},
-std::array<float,2>{0.426119208f, 0.545563579f},
-std::array<float,2>{0.778248668f, 0.957557559f},
-std::array<float,2>{0.223293275f, 0.225082695f},
-std::array<float,2>{0.754027486f, 0.411362857f},
-std::array<float,2>{0.249093428f, 0.514477253f},
-std::array<float,2>{0.736276448f, 0.975478411f},
-std::array<float,2>{0.41251421f, 0.188208356f},
-std::array<float,2>{0.571494639f, 0.0170939676f},
-std::array<float,2>{0.300452173f, 0.868998766f},
-std::array<float,2>{0.985928297f, 0.688985586f},
-std::array<float,2>{0.111055776f, 0.28198567f},
-std::array<float,2>{0.926602364f, 0.136369258f},
-std::array<float,2>{0.0408414416f, 0.917334497f},
-std::array<float,2>{0.552717149f, 0.595668375f},
-std::array<float,2>{0.350265592f, 0.493163377f},
-std::array<float,2>{0.671005011f, 0.370221555f},
-std::array<float,2>{0.43781352f, 0.658394098f},
-std::array<float,2>{0.858061135f, 0.775871575f},
-std::array<float,2>{0.150359228f, 0.124249667f},
-std::array<float,2>{0.965195537f, 0.279230028f},
-std::array<float,2>{0.0909463838f, 0.74640131f},
-std::array<float,2>{0.59416759f, 0.816479981f},
-std::array<float,2>{0.25507921f, 0.0354318321f},
-std::array<float,2>{0.69379288f, 0.247224137f},
-std::array<float,2>{0.382003784f, 0.95199877f},
-std::array<float,2>{0.810977221f, 0.552809238f},
-std::array<float,2>{0.192688018f, 0.385701627f},
-std::array<float,2>{0.841998398f, 0.083202444f},
-std::array<float,2>{0.177544892f, 0.799468517f},
-std::array<float,2>{0.630518854f, 0.647895575f},
-std::array<float,2>{0.488070875f, 0.329921186f},
-std::array<float,2>{0.503882647f, 0.462621659f},
-std::array<float,2>{0.335177839f, 0.570958495f},
-std::array<float,2>{0.891187489f, 0.89387399f},
-std::array<float,2>{0.00640020752f, 0.170944661f},
-std::array<float,2>{0.998182535f, 0.376715064f},
-std::array<float,2>{0.121838868f, 0.56123817f},
-std::array<float,2>{0.565266669f, 0.942605019f},
-std::array<float,2>{0.309139699f, 0.23831977f},
-std::array<float,2>{0.745586395f, 0.0450025611f},
-std::array<float,2>{0.421150267f, 0.820707321f},
-std::array<float,2>{0.764703155f, 0.734859824f},
-std::array<float,2>{0.239250705f, 0.27121675f},
-std::array<float,2>{0.844953835f, 0.160114795f},
-std::array<float,2>{0.143896163f, 0.902151763f},
-std::array<float,2>{0.663763225f, 0.562913239f},
-std::array<float,2>{0.450059414f, 0.460328966f},
-std::array<float,2>{0.560343027f, 0.33971864f},
-std::array<float,2>{0.358942688f, 0.653610766f},
-std::array<float,2>{0.930383086f, 0.808212817f},
-std::array<float,2>{0.0330327414f, 0.0917622745f},
-std::array<float,2>{0.79829216f, 0.292576402f},
-std::array<float,2>{0.202160016f, 0.699067593f},
-std::array<float,2>{0.699553907f, 0.864525616f},
-std::array<float,2>{0.383494794f, 0.0304809734f},
-std::array<float,2>{0.601732194f, 0.202348709f},
-std::array<float,2>{0.26341033f, 0.984120786f},
-std::array<float,2>{0.955325961f, 0.504807651f},
-std::array<float,2>{0.0822382197f, 0.419559419f},
-std::array<float,2>{0.905027509f, 0.116952993f},
-std::array<float,2>{0.0149308313f, 0.772280335f},
-std::array<float,2>{0.508786917f, 0.671847343f},
-std::array<float,2>{0.341552258f, 0.364157647f},
-std::array<float,2>{0.635729551f, 0.486953467f},
-std::array<float,2>{0.496900916f, 0.607179582f},
-std::array<float,2>{0.833545029f, 0.908715367f},
-std::array<float,2>{0.185418963f, 0.1323535f},
-std::array<float,2>{0.826384068f, 0.441696495f},
-std::array<float,2>{0.163894892f, 0.579389095f},
-std::array<float,2>{0.640936434f, 0.889835715f},
-std::array<float,2>{0.471915424f, 0.173524991f},
-std::array<float,2>{0.525454581f, 0.06844569f},
-std::array<float,2>{0.314410716f, 0.781627834f},
-std::array<float,2>{0.884482801f, 0.626693726f},
-std::array<float,2>{0.0210838933f, 0.321277231f},
-std::array<float,2>{0.947929502f, 0.234264284f},
-std::array<float,2>{0.0677417815f, 0.965404987f},
-std::array<float,2>{0.619740427f, 0.538784325f},
-std::array<float,2>{0.278954953f, 0.405626684f},
-std::array<float,2>{0.708642662f, 0.258445233f},
-std::array<float,2>{0.406167775f, 0.719129443f},
-std::array<float,2>{0.790793598f, 0.832191229f},
-std::array<float,2>{0.216020748f, 0.0597238019f},
-std::array<float,2>{0.907469153f, 0.349663168f},
-std::array<float,2>{0.0578235388f, 0.687296331f},
-std::array<float,2>{0.533690631f, 0.753644466f},
-std::array<float,2>{0.364566892f, 0.107055135f},
-std::array<float,2>{0.68340832f, 0.145022631f},
-std::array<float,2>{0.462210536f, 0.934503853f},
-std::array<float,2>{0.868037641f, 0.62178719f},
-std::array<float,2>{0.129034787f, 0.481787682f},
-std::array<float,2>{0.765927494f, 0.0154025145f},
-std::array<float,2>{0.228948414f, 0.849336088f},
-std::array<float,2>{0.72827673f, 0.709899664f},
-std::array<float,2>{0.431192458f, 0.296898067f},
-std::array<float,2>{0.584365964f, 0.426236808f},
-std::array<float,2>{0.28737238f, 0.52284348f},
-std::array<float,2>{0.970418632f, 0.984793782f},
-std::array<float,2>{0.105307736f, 0.211309746f},
-std::array<float,2>{0.889077544f, 0.408156008f},
-std::array<float,2>{0.0176926143f, 0.509580374f},
-std::array<float,2>{0.529466212f, 0.970301509f},
-std::array<float,2>{0.319479197f, 0.195138484f},
-std::array<float,2>{0.646429539f, 0.023174772f},
-std::array<float,2>{0.475840211f, 0.872082174f},
-std::array<float,2>{0.822680295f, 0.692976356f},
-std::array<float,2>{0.160039499f, 0.288156718f},
-std::array<float,2>{0.796483696f, 0.140463859f},
-std::array<float,2>{0.214689717f, 0.918731153f},
-std::array<float,2>{0.70405066f, 0.597959638f},
-std::array<float,2>{0.401027143f, 0.498681158f},
-std::array<float,2>{0.62306881f, 0.372429967f},
-std::array<float,2>{0.274908572f, 0.660396934f},
-std::array<float,2>{0.951914549f, 0.77925396f},
-std::array<float,2>{0.0636387095f, 0.120273583f},
-std::array<float,2>{0.873079479f, 0.275861323f},
-std::array<float,2>{0.126594633f, 0.744374812f},
-std::array<float,2>{0.686421156f, 0.814961195f},
-std::array<float,2>{0.468620867f, 0.032375671f},
-std::array<float,2>{0.535824776f, 0.242333069f},
-std::array<float,2>{0.361475736f, 0.948553562f},
-std::array<float,2>{0.91241771f, 0.547503829f},
-std::array<float,2>{0.0623997748f, 0.389339864f},
-std::array<float,2>{0.975926399f, 0.0811053142f},
-std::array<float,2>{0.106272601f, 0.804224551f},
-std::array<float,2>{0.581419289f, 0.644186914f},
-std::array<float,2>{0.282930106f, 0.33403644f},
-std::array<float,2>{0.73302412f, 0.46675092f},
-std::array<float,2>{0.437358439f, 0.577460587f},
-std::array<float,2>{0.772843897f, 0.898412824f},
-std::array<float,2>{0.233251229f, 0.167518422f},
-std::array<float,2>{0.759783089f, 0.472021461f},
-std::array<float,2>{0.237285152f, 0.609921396f},
-std::array<float,2>{0.749404013f, 0.927244663f},
-std::array<float,2>{0.414483488f, 0.149754748f},
-std::array<float,2>{0.566439152f, 0.099369362f},
-std::array<float,2>{0.306639433f, 0.757964492f},
-std::array<float,2>{0.993577182f, 0.672070622f},
-std::array<float,2>{0.119926855f, 0.355190575f},
-std::array<float,2>{0.935138881f, 0.208595887f},
-std::array<float,2>{0.0366426818f, 0.994689584f},
-std::array<float,2>{0.55843997f, 0.52894944f},
-std::array<float,2>{0.351983219f, 0.432124257f},
-std::array<float,2>{0.659199655f, 0.308678776f},
-std::array<float,2>{0.445572644f, 0.714758992f},
-std::array<float,2>{0.850742221f, 0.852395833f},
-std::array<float,2>{0.147932798f, 0.00110817328f},
-std::array<float,2>{0.959937751f, 0.318790287f},
-std::array<float,2>{0.081127435f, 0.634880841f},
-std::array<float,2>{0.606182516f, 0.792647302f},
-std::array<float,2>{0.260198325f, 0.0762739331f},
-std::array<float,2>{0.696912169f, 0.182483032f},
-std::array<float,2>{0.386786699f, 0.875801921f},
-std::array<float,2>{0.802731276f, 0.592355371f},
-std::array<float,2>{0.195586279f, 0.450209439f},
-std::array<float,2>{0.830627143f, 0.0505595654f},
-std::array<float,2>{0.18011263f, 0.836502373f},
-std::array<float,2>{0.639264822f, 0.728922844f},
-std::array<float,2>{0.492404759f, 0.252037257f},
-std::array<float,2>{0.51494962f, 0.391951531f},
-std::array<float,2>{0.339093506f, 0.54114455f},
-std::array<float,2>{0.900380373f, 0.956219733f},
-std::array<float,2>{0.00824785419f, 0.220742777f},
-std::array<float,2>{0.98973006f, 0.438070685f},
-std::array<float,2>{0.113668457f, 0.585042238f},
-std::array<float,2>{0.577458322f, 0.885190725f},
-std::array<float,2>{0.301078647f, 0.179469869f},
-std::array<float,2>{0.740680039f, 0.0660970137f},
-std::array<float,2>{0.407904297f, 0.787593544f},
-std::array<float,2>{0.750269532f, 0.629294515f},
-std::array<float,2>{0.245200962f, 0.327826351f},
-std::array<float,2>{0.852556825f, 0.228163466f},
-std::array<float,2>{0.154900715f, 0.964378536f},
-std::array<float,2>{0.665766776f, 0.532120347f},
-std::array<float,2>{0.442919195f, 0.400840819f},
-std::array<float,2>{0.549672663f, 0.263950586f},
-std::array<float,2>{0.345004767f, 0.72480154f},
-std::array<float,2>{0.925515234f, 0.828216612f},
-std::array<float,2>{0.0443134457f, 0.0551423579f},
-std::array<float,2>{0.806888163f, 0.345668852f},
-std::array<float,2>{0.188833028f, 0.680176258f},
-std::array<float,2>{0.69138813f, 0.754957795f},
-std::array<float,2>{0.3789002f, 0.104850911f},
-std::array<float,2>{0.600393414f, 0.143100649f},
-std::array<float,2>{0.251825064f, 0.929875195f},
-std::array<float,2>{0.962230265f, 0.617838502f},
-std::array<float,2>{0.087171331f, 0.479527652f},
-std::array<float,2>{0.898377478f, 0.0102620292f},
-std::array<float,2>{0.00275539164f, 0.845600247f},
-std::array<float,2>{0.504305065f, 0.706586957f},
-std::array<float,2>{0.330326259f, 0.300837755f},
-std::array<float,2>{0.626714468f, 0.422258049f},
-std::array<float,2>{0.488599658f, 0.51769191f},
-std::array<float,2>{0.838115513f, 0.990633845f},
-std::array<float,2>{0.17521134f, 0.215415493f},
-std::array<float,2>{0.814533591f, 0.379463524f},
-std::array<float,2>{0.1671682f, 0.558400929f},
-std::array<float,2>{0.651992261f, 0.94039309f},
-std::array<float,2>{0.480005741f, 0.238169223f},
-std::array<float,2>{0.51647085f, 0.040608868f},
-std::array<float,2>{0.326346546f, 0.824486852f},
-std::array<float,2>{0.877329171f, 0.741024196f},
-std::array<float,2>{0.0284258947f, 0.268568277f},
-std::array<float,2>{0.938132405f, 0.164021075f},
-std::array<float,2>{0.0745441616f, 0.906051815f},
-std::array<float,2>{0.61358434f, 0.568459928f},
-std::array<float,2>{0.272734165f, 0.453760713f},
-std::array<float,2>{0.71569699f, 0.343521446f},
-std::array<float,2>{0.393454999f, 0.648687184f},
-std::array<float,2>{0.782096446f, 0.810297251f},
-std::array<float,2>{0.207054794f, 0.0881921425f},
-std::array<float,2>{0.915714681f, 0.295033127f},
-std::array<float,2>{0.0519361272f, 0.699567497f},
-std::array<float,2>{0.541656911f, 0.863085806f},
-std::array<float,2>{0.368230999f, 0.0248869359f},
-std::array<float,2>{0.677765012f, 0.195380181f},
-std::array<float,2>{0.456512749f, 0.978255689f},
-std::array<float,2>{0.865865827f, 0.500090778f},
-std::array<float,2>{0.137770325f, 0.417386651f},
-std::array<float,2>{0.775706232f, 0.110779025f},
-std::array<float,2>{0.220228598f, 0.7667889f},
-std::array<float,2>{0.721558332f, 0.66479516f},
-std::array<float,2>{0.424242526f, 0.362925142f},
-std::array<float,2>{0.590150237f, 0.491490662f},
-std::array<float,2>{0.291754246f, 0.604795516f},
-std::array<float,2>{0.977646351f, 0.912409425f},
-std::array<float,2>{0.0949303061f, 0.12860471f},
-std::array<float,2>{0.928437054f, 0.494013816f},
-std::array<float,2>{0.0425269343f, 0.593967319f},
-std::array<float,2>{0.554373682f, 0.9165622f},
-std::array<float,2>{0.349131256f, 0.135377333f},
-std::array<float,2>{0.669252932f, 0.123445764f},
-std::array<float,2>{0.439971238f, 0.777153969f},
-std::array<float,2>{0.85737896f, 0.659287274f},
-std::array<float,2>{0.150744796f, 0.369677722f},
-std::array<float,2>{0.756391466f, 0.18933776f},
-std::array<float,2>{0.246723369f, 0.976017773f},
-std::array<float,2>{0.738165259f, 0.515099466f},
-std::array<float,2>{0.411819935f, 0.410848379f},
-std::array<float,2>{0.573048592f, 0.283064693f},
-std::array<float,2>{0.297713757f, 0.687553406f},
-std::array<float,2>{0.987091303f, 0.867905438f},
-std::array<float,2>{0.112789281f, 0.0157622937f},
-std::array<float,2>{0.839906752f, 0.328989387f},
-std::array<float,2>{0.178238079f, 0.647084832f},
-std::array<float,2>{0.631055236f, 0.800216734f},
-std::array<float,2>{0.484377295f, 0.0828375071f},
-std::array<float,2>{0.501163661f, 0.169933677f},
-std::array<float,2>{0.332465887f, 0.892894924f},
-std::array<float,2>{0.893456638f, 0.572125971f},
-std::array<float,2>{0.00429294212f, 0.461470693f},
-std::array<float,2>{0.9671157f, 0.0364186317f},
-std::array<float,2>{0.0930984691f, 0.81770581f},
-std::array<float,2>{0.597162843f, 0.747531474f},
-std::array<float,2>{0.256756604f, 0.277405858f},
-std::array<float,2>{0.692724347f, 0.38657254f},
-std::array<float,2>{0.379367411f, 0.554646969f},
-std::array<float,2>{0.810114801f, 0.952593565f},
-std::array<float,2>{0.194542333f, 0.246231377f},
-std::array<float,2>{0.787526727f, 0.435157657f},
-std::array<float,2>{0.206438839f, 0.525287211f},
-std::array<float,2>{0.712478161f, 0.99987781f},
-std::array<float,2>{0.396071464f, 0.20634675f},
-std::array<float,2>{0.610221446f, 0.0064244098f},
-std::array<float,2>{0.268439054f, 0.858309925f},
-std::array<float,2>{0.944003642f, 0.71621865f},
-std::array<float,2>{0.0741092041f, 0.307539612f},
-std::array<float,2>{0.882610202f, 0.1560487f},
-std::array<float,2>{0.0245238282f, 0.923992395f},
-std::array<float,2>{0.521651268f, 0.615965247f},
-std::array<float,2>{0.320903033f, 0.476258099f},
-std::array<float,2>{0.656013072f, 0.357822746f},
-std::array<float,2>{0.483703792f, 0.679537117f},
-std::array<float,2>{0.817117751f, 0.764772177f},
-std::array<float,2>{0.169351906f, 0.0961876065f},
-std::array<float,2>{0.983849883f, 0.255456567f},
-std::array<float,2>{0.101493455f, 0.732902408f},
-std::array<float,2>{0.588233948f, 0.842836857f},
-std::array<float,2>{0.29510951f, 0.0520437285f},
-std::array<float,2>{0.724706769f, 0.225603878f},
-std::array<float,2>{0.42882356f, 0.958710253f},
-std::array<float,2>{0.780894279f, 0.546870112f},
-std::array<float,2>{0.225824162f, 0.39455092f},
-std::array<float,2>{0.85979569f, 0.072603479f},
-std::array<float,2>{0.136378869f, 0.793262124f},
-std::array<float,2>{0.672079742f, 0.640355051f},
-std::array<float,2>{0.459708065f, 0.313961446f},
-std::array<float,2>{0.545994461f, 0.446455181f},
-std::array<float,2>{0.371775419f, 0.587635458f},
-std::array<float,2>{0.921676755f, 0.881998658f},
-std::array<float,2>{0.0506318361f, 0.184012547f},
-std::array<float,2>{0.945909083f, 0.405128151f},
-std::array<float,2>{0.0699088946f, 0.537859619f},
-std::array<float,2>{0.618638754f, 0.966538906f},
-std::array<float,2>{0.280395448f, 0.23276031f},
-std::array<float,2>{0.709956706f, 0.0593813285f},
-std::array<float,2>{0.40308252f, 0.833875179f},
-std::array<float,2>{0.791787088f, 0.719957113f},
-std::array<float,2>{0.217274025f, 0.259556532f},
-std::array<float,2>{0.825474858f, 0.172104657f},
-std::array<float,2>{0.160497159f, 0.888902128f},
-std::array<float,2>{0.642864048f, 0.579087257f},
-std::array<float,2>{0.469780594f, 0.443061888f},
-std::array<float,2>{0.523518264f, 0.321729481f},
-std::array<float,2>{0.31455344f, 0.625264704f},
-std::array<float,2>{0.885555089f, 0.782407343f},
-std::array<float,2>{0.0214866064f, 0.0701500401f},
-std::array<float,2>{0.768880725f, 0.298048526f},
-std::array<float,2>{0.22795023f, 0.710598886f},
-std::array<float,2>{0.730294168f, 0.847768664f},
-std::array<float,2>{0.433524519f, 0.0145608289f},
-std::array<float,2>{0.582972109f, 0.212874457f},
-std::array<float,2>{0.286211997f, 0.985950351f},
-std::array<float,2>{0.971542895f, 0.521751285f},
-std::array<float,2>{0.101829335f, 0.42711395f},
-std::array<float,2>{0.910119891f, 0.105876997f},
-std::array<float,2>{0.0559985451f, 0.75262624f},
-std::array<float,2>{0.531369209f, 0.68630445f},
-std::array<float,2>{0.366022915f, 0.351102173f},
-std::array<float,2>{0.681518793f, 0.480710298f},
-std::array<float,2>{0.463893235f, 0.622669816f},
-std::array<float,2>{0.869268715f, 0.93517977f},
-std::array<float,2>{0.132004529f, 0.145935506f},
-std::array<float,2>{0.845978439f, 0.459891379f},
-std::array<float,2>{0.142071962f, 0.563816965f},
-std::array<float,2>{0.661791384f, 0.900656164f},
-std::array<float,2>{0.451404393f, 0.158830732f},
-std::array<float,2>{0.562312126f, 0.0906056166f},
-std::array<float,2>{0.356850773f, 0.807598829f},
-std::array<float,2>{0.931689501f, 0.652402639f},
-std::array<float,2>{0.0345114358f, 0.338375688f},
-std::array<float,2>{0.997132361f, 0.239651576f},
-std::array<float,2>{0.124264464f, 0.942213178f},
-std::array<float,2>{0.563615739f, 0.56235379f},
-std::array<float,2>{0.312038392f, 0.375927955f},
-std::array<float,2>{0.74384433f, 0.270164132f},
-std::array<float,2>{0.418502957f, 0.735734046f},
-std::array<float,2>{0.762009859f, 0.822047412f},
-std::array<float,2>{0.241266787f, 0.0466937982f},
-std::array<float,2>{0.903132915f, 0.364654332f},
-std::array<float,2>{0.0117609082f, 0.670810997f},
-std::array<float,2>{0.510521352f, 0.772710919f},
-std::array<float,2>{0.343545407f, 0.116047926f},
-std::array<float,2>{0.634441674f, 0.131052494f},
-std::array<float,2>{0.499051422f, 0.909580767f},
-std::array<float,2>{0.835599005f, 0.60606879f},
-std::array<float,2>{0.187272698f, 0.487978697f},
-std::array<float,2>{0.800684452f, 0.0294716824f},
-std::array<float,2>{0.200060681f, 0.863429844f},
-std::array<float,2>{0.701177239f, 0.697396636f},
-std::array<float,2>{0.385880381f, 0.291033119f},
-std::array<float,2>{0.604990304f, 0.418556571f},
-std::array<float,2>{0.265217602f, 0.505346f},
-std::array<float,2>{0.953928351f, 0.982989192f},
-std::array<float,2>{0.084206149f, 0.201312378f},
-std::array<float,2>{0.911868691f, 0.387522578f},
-std::array<float,2>{0.0597122051f, 0.550248682f},
-std::array<float,2>{0.538726568f, 0.947023511f},
-std::array<float,2>{0.3609294f, 0.244530529f},
-std::array<float,2>{0.68437314f, 0.0347765535f},
-std::array<float,2>{0.464926451f, 0.812682927f},
-std::array<float,2>{0.872573137f, 0.743786573f},
-std::array<float,2>{0.128165305f, 0.274170667f},
-std::array<float,2>{0.77125591f, 0.165607408f},
-std::array<float,2>{0.231535584f, 0.895585895f},
-std::array<float,2>{0.731352329f, 0.576066315f},
-std::array<float,2>{0.433952868f, 0.467567652f},
-std::array<float,2>{0.578830123f, 0.332649559f},
-std::array<float,2>{0.283291548f, 0.642363667f},
-std::array<float,2>{0.973740041f, 0.801973641f},
-std::array<float,2>{0.10926345f, 0.0793677345f},
-std::array<float,2>{0.821177006f, 0.285477072f},
-std::array<float,2>{0.156628087f, 0.69512403f},
-std::array<float,2>{0.64653337f, 0.874358535f},
-std::array<float,2>{0.473115921f, 0.0198177919f},
-std::array<float,2>{0.528643012f, 0.191967577f},
-std::array<float,2>{0.316996813f, 0.971580923f},
-std::array<float,2>{0.888575912f, 0.5101071f},
-std::array<float,2>{0.0161985625f, 0.408766866f},
-std::array<float,2>{0.951073647f, 0.118435368f},
-std::array<float,2>{0.0650993958f, 0.780780792f},
-std::array<float,2>{0.622440577f, 0.663192689f},
-std::array<float,2>{0.276237726f, 0.374883264f},
-std::array<float,2>{0.706701279f, 0.496839821f},
-std::array<float,2>{0.400027394f, 0.600300372f},
-std::array<float,2>{0.793256044f, 0.920570374f},
-std::array<float,2>{0.212603822f, 0.137680531f},
-std::array<float,2>{0.804657519f, 0.451342225f},
-std::array<float,2>{0.197618872f, 0.590418816f},
-std::array<float,2>{0.699070632f, 0.877259612f},
-std::array<float,2>{0.390119255f, 0.181566149f},
-std::array<float,2>{0.609264016f, 0.0757391453f},
-std::array<float,2>{0.259151191f, 0.789175451f},
-std::array<float,2>{0.95871526f, 0.633605182f},
-std::array<float,2>{0.0788404644f, 0.317804545f},
-std::array<float,2>{0.901277184f, 0.218752474f},
-std::array<float,2>{0.0115482304f, 0.953709722f},
-std::array<float,2>{0.512643576f, 0.539733529f},
-std::array<float,2>{0.336787701f, 0.394519657f},
-std::array<float,2>{0.637014627f, 0.250039577f},
-std::array<float,2>{0.495733231f, 0.727064312f},
-std::array<float,2>{0.828814745f, 0.83793664f},
-std::array<float,2>{0.183169171f, 0.0478684269f},
-std::array<float,2>{0.994686007f, 0.352991194f},
-std::array<float,2>{0.117267683f, 0.674484134f},
-std::array<float,2>{0.569965839f, 0.761605442f},
-std::array<float,2>{0.308529735f, 0.100162223f},
-std::array<float,2>{0.74642849f, 0.151235148f},
-std::array<float,2>{0.417821705f, 0.92876935f},
-std::array<float,2>{0.758355021f, 0.611682713f},
-std::array<float,2>{0.236050978f, 0.470213652f},
-std::array<float,2>{0.847777605f, 0.00334828929f},
-std::array<float,2>{0.145521522f, 0.855373085f},
-std::array<float,2>{0.657323182f, 0.711194754f},
-std::array<float,2>{0.44767949f, 0.312209308f},
-std::array<float,2>{0.55492413f, 0.430261314f},
-std::array<float,2>{0.355010659f, 0.530041993f},
-std::array<float,2>{0.937083542f, 0.993599892f},
-std::array<float,2>{0.037681818f, 0.209359571f},
-std::array<float,2>{0.964278877f, 0.47666055f},
-std::array<float,2>{0.0894241482f, 0.620157361f},
-std::array<float,2>{0.597925007f, 0.933306754f},
-std::array<float,2>{0.252950996f, 0.14218612f},
-std::array<float,2>{0.688169479f, 0.103137136f},
-std::array<float,2>{0.375483096f, 0.757426381f},
-std::array<float,2>{0.805213988f, 0.681877911f},
-std::array<float,2>{0.190196604f, 0.346972585f},
-std::array<float,2>{0.836414516f, 0.217157781f},
-std::array<float,2>{0.171875983f, 0.990110338f},
-std::array<float,2>{0.628646374f, 0.517240822f},
-std::array<float,2>{0.490296721f, 0.424194634f},
-std::array<float,2>{0.505991042f, 0.302743822f},
-std::array<float,2>{0.328984529f, 0.705004573f},
-std::array<float,2>{0.896383226f, 0.846238852f},
-std::array<float,2>{0.00134779559f, 0.0087587079f},
-std::array<float,2>{0.753614962f, 0.325749636f},
-std::array<float,2>{0.243777916f, 0.632451594f},
-std::array<float,2>{0.739069998f, 0.78638202f},
-std::array<float,2>{0.410090327f, 0.0628001913f},
-std::array<float,2>{0.575156868f, 0.177391991f},
-std::array<float,2>{0.303563625f, 0.883089304f},
-std::array<float,2>{0.990719914f, 0.582984805f},
-std::array<float,2>{0.116267227f, 0.43984431f},
-std::array<float,2>{0.922999501f, 0.0576245226f},
-std::array<float,2>{0.0463049971f, 0.831630588f},
-std::array<float,2>{0.547689676f, 0.72278595f},
-std::array<float,2>{0.347655803f, 0.262538046f},
-std::array<float,2>{0.666339099f, 0.399696469f},
-std::array<float,2>{0.44354248f, 0.534344137f},
-std::array<float,2>{0.854993761f, 0.961976886f},
-std::array<float,2>{0.153021395f, 0.229654506f},
-std::array<float,2>{0.86365217f, 0.415901035f},
-std::array<float,2>{0.138766006f, 0.502625525f},
-std::array<float,2>{0.676280022f, 0.97997719f},
-std::array<float,2>{0.454580337f, 0.197656333f},
-std::array<float,2>{0.540642321f, 0.025597522f},
-std::array<float,2>{0.370660901f, 0.859727621f},
-std::array<float,2>{0.917043388f, 0.701728404f},
-std::array<float,2>{0.053480763f, 0.294708937f},
-std::array<float,2>{0.9791224f, 0.125543758f},
-std::array<float,2>{0.0964226276f, 0.911045492f},
-std::array<float,2>{0.593553483f, 0.603105009f},
-std::array<float,2>{0.289631873f, 0.489760488f},
-std::array<float,2>{0.719221115f, 0.359908551f},
-std::array<float,2>{0.422761708f, 0.666711509f},
-std::array<float,2>{0.77455014f, 0.76808995f},
-std::array<float,2>{0.22130166f, 0.112769835f},
-std::array<float,2>{0.875707209f, 0.267542034f},
-std::array<float,2>{0.029344786f, 0.738428473f},
-std::array<float,2>{0.517950356f, 0.826840878f},
-std::array<float,2>{0.325049013f, 0.0423145741f},
-std::array<float,2>{0.648928523f, 0.235633343f},
-std::array<float,2>{0.478367716f, 0.938114643f},
-std::array<float,2>{0.812984467f, 0.554844201f},
-std::array<float,2>{0.165989131f, 0.381402433f},
-std::array<float,2>{0.783581793f, 0.0865932256f},
-std::array<float,2>{0.209850594f, 0.812280297f},
-std::array<float,2>{0.717758477f, 0.651283443f},
-std::array<float,2>{0.391694158f, 0.341327816f},
-std::array<float,2>{0.616457164f, 0.455274224f},
-std::array<float,2>{0.269953042f, 0.566505075f},
-std::array<float,2>{0.939858496f, 0.902473271f},
-std::array<float,2>{0.0770765692f, 0.16035077f},
-std::array<float,2>{0.892130315f, 0.464250773f},
-std::array<float,2>{0.00697278045f, 0.57331419f},
-std::array<float,2>{0.502866268f, 0.89148289f},
-std::array<float,2>{0.334365875f, 0.169831872f},
-std::array<float,2>{0.629521072f, 0.0842819363f},
-std::array<float,2>{0.487189114f, 0.797620058f},
-std::array<float,2>{0.843477368f, 0.645716786f},
-std::array<float,2>{0.175840259f, 0.330525696f},
-std::array<float,2>{0.812312543f, 0.24876228f},
-std::array<float,2>{0.19212319f, 0.950483382f},
-std::array<float,2>{0.694793284f, 0.551077247f},
-std::array<float,2>{0.381058633f, 0.383476138f},
-std::array<float,2>{0.595500588f, 0.281039804f},
-std::array<float,2>{0.254284203f, 0.749801159f},
-std::array<float,2>{0.966541171f, 0.82028687f},
-std::array<float,2>{0.0901211947f, 0.0388376713f},
-std::array<float,2>{0.859242857f, 0.367848575f},
-std::array<float,2>{0.148761049f, 0.657939911f},
-std::array<float,2>{0.670779824f, 0.774967194f},
-std::array<float,2>{0.438577682f, 0.121435016f},
-std::array<float,2>{0.551516414f, 0.13347429f},
-std::array<float,2>{0.35129407f, 0.914342523f},
-std::array<float,2>{0.926775277f, 0.596436441f},
-std::array<float,2>{0.0391941816f, 0.494800568f},
-std::array<float,2>{0.984877169f, 0.0189670864f},
-std::array<float,2>{0.110037044f, 0.869175017f},
-std::array<float,2>{0.570385337f, 0.689737916f},
-std::array<float,2>{0.299626619f, 0.284852237f},
-std::array<float,2>{0.734902501f, 0.412314922f},
-std::array<float,2>{0.41333136f, 0.513026834f},
-std::array<float,2>{0.755646288f, 0.97312659f},
-std::array<float,2>{0.248421147f, 0.189701825f},
-std::array<float,2>{0.779026389f, 0.39786309f},
-std::array<float,2>{0.223785788f, 0.544570684f},
-std::array<float,2>{0.723932743f, 0.959853053f},
-std::array<float,2>{0.427087128f, 0.222752333f},
-std::array<float,2>{0.586386383f, 0.0527408272f},
-std::array<float,2>{0.293573976f, 0.841531754f},
-std::array<float,2>{0.981130123f, 0.731707752f},
-std::array<float,2>{0.0982674733f, 0.25780791f},
-std::array<float,2>{0.918317556f, 0.18739368f},
-std::array<float,2>{0.0481785052f, 0.879652977f},
-std::array<float,2>{0.543932259f, 0.588319719f},
-std::array<float,2>{0.374299765f, 0.447950274f},
-std::array<float,2>{0.675434172f, 0.315191805f},
-std::array<float,2>{0.457219779f, 0.637156129f},
-std::array<float,2>{0.861585081f, 0.795861423f},
-std::array<float,2>{0.133636922f, 0.0714552775f},
-std::array<float,2>{0.942341864f, 0.30610311f},
-std::array<float,2>{0.0708047599f, 0.717178226f},
-std::array<float,2>{0.611801982f, 0.856951833f},
-std::array<float,2>{0.265780121f, 0.00453542126f},
-std::array<float,2>{0.714415908f, 0.204884112f},
-std::array<float,2>{0.398305565f, 0.997969091f},
-std::array<float,2>{0.786664069f, 0.526010811f},
-std::array<float,2>{0.20439063f, 0.437437892f},
-std::array<float,2>{0.820111275f, 0.0940406844f},
-std::array<float,2>{0.170064881f, 0.762595117f},
-std::array<float,2>{0.653107762f, 0.675963163f},
-std::array<float,2>{0.481314301f, 0.355859786f},
-std::array<float,2>{0.520766914f, 0.473010719f},
-std::array<float,2>{0.323448539f, 0.614957809f},
-std::array<float,2>{0.880472183f, 0.922733426f},
-std::array<float,2>{0.0268738382f, 0.153954104f},
-std::array<float,2>{0.969235241f, 0.428606004f},
-std::array<float,2>{0.104372144f, 0.520157814f},
-std::array<float,2>{0.585826159f, 0.987409532f},
-std::array<float,2>{0.289057374f, 0.214618087f},
-std::array<float,2>{0.726721764f, 0.011727958f},
-std::array<float,2>{0.430118233f, 0.851484001f},
-std::array<float,2>{0.766890824f, 0.707731128f},
-std::array<float,2>{0.229527012f, 0.300303012f},
-std::array<float,2>{0.868906438f, 0.147016108f},
-std::array<float,2>{0.130259812f, 0.93724221f},
-std::array<float,2>{0.682355046f, 0.623215139f},
-std::array<float,2>{0.46167174f, 0.483223438f},
-std::array<float,2>{0.535150588f, 0.348947644f},
-std::array<float,2>{0.363290071f, 0.68414861f},
-std::array<float,2>{0.906459332f, 0.751013279f},
-std::array<float,2>{0.0572023988f, 0.10747043f},
-std::array<float,2>{0.789107978f, 0.261077166f},
-std::array<float,2>{0.214942172f, 0.7222808f},
-std::array<float,2>{0.707363725f, 0.835042536f},
-std::array<float,2>{0.404433101f, 0.0623789094f},
-std::array<float,2>{0.620724976f, 0.23235856f},
-std::array<float,2>{0.277977258f, 0.968161583f},
-std::array<float,2>{0.949020207f, 0.537084162f},
-std::array<float,2>{0.0669841245f, 0.402607799f},
-std::array<float,2>{0.883496225f, 0.0675798208f},
-std::array<float,2>{0.0204581562f, 0.784106612f},
-std::array<float,2>{0.527120233f, 0.62824595f},
-std::array<float,2>{0.312685639f, 0.324003011f},
-std::array<float,2>{0.641996384f, 0.444422096f},
-std::array<float,2>{0.4713144f, 0.580189347f},
-std::array<float,2>{0.827615976f, 0.887586713f},
-std::array<float,2>{0.162185237f, 0.175730303f},
-std::array<float,2>{0.832984447f, 0.486128032f},
-std::array<float,2>{0.183779642f, 0.608789325f},
-std::array<float,2>{0.636178434f, 0.908124506f},
-std::array<float,2>{0.497183412f, 0.129119799f},
-std::array<float,2>{0.509533167f, 0.11470452f},
-std::array<float,2>{0.340176016f, 0.771181703f},
-std::array<float,2>{0.905624568f, 0.668818891f},
-std::array<float,2>{0.0139767481f, 0.366012484f},
-std::array<float,2>{0.956183672f, 0.199471235f},
-std::array<float,2>{0.0836419016f, 0.981997311f},
-std::array<float,2>{0.602951348f, 0.506367326f},
-std::array<float,2>{0.261998743f, 0.42139709f},
-std::array<float,2>{0.700616598f, 0.290812105f},
-std::array<float,2>{0.383805722f, 0.69571799f},
-std::array<float,2>{0.797712922f, 0.866803408f},
-std::array<float,2>{0.201421484f, 0.0279712696f},
-std::array<float,2>{0.931119323f, 0.336328328f},
-std::array<float,2>{0.0315217301f, 0.654302359f},
-std::array<float,2>{0.559032619f, 0.804984987f},
-std::array<float,2>{0.357487619f, 0.0927881524f},
-std::array<float,2>{0.662815094f, 0.156700313f},
-std::array<float,2>{0.451169699f, 0.899962246f},
-std::array<float,2>{0.844087362f, 0.566263735f},
-std::array<float,2>{0.143496573f, 0.457063317f},
-std::array<float,2>{0.764399409f, 0.0431548506f},
-std::array<float,2>{0.239653438f, 0.823314786f},
-std::array<float,2>{0.744713843f, 0.736804247f},
-std::array<float,2>{0.420873404f, 0.273256928f},
-std::array<float,2>{0.565746188f, 0.377963305f},
-std::array<float,2>{0.309951693f, 0.560221732f},
-std::array<float,2>{0.999320865f, 0.943364441f},
-std::array<float,2>{0.122152999f, 0.240292072f},
-std::array<float,2>{0.877774239f, 0.380914778f},
-std::array<float,2>{0.0290534534f, 0.555427253f},
-std::array<float,2>{0.515845001f, 0.93759048f},
-std::array<float,2>{0.326987565f, 0.236091271f},
-std::array<float,2>{0.651593149f, 0.0427008346f},
-std::array<float,2>{0.479569137f, 0.826475561f},
-std::array<float,2>{0.815318286f, 0.739026904f},
-std::array<float,2>{0.167650595f, 0.266645819f},
-std::array<float,2>{0.781557918f, 0.161039293f},
-std::array<float,2>{0.207547128f, 0.903240561f},
-std::array<float,2>{0.714980841f, 0.567326367f},
-std::array<float,2>{0.392888695f, 0.45568496f},
-std::array<float,2>{0.614198506f, 0.341197908f},
-std::array<float,2>{0.273260325f, 0.650843918f},
-std::array<float,2>{0.937689662f, 0.811616957f},
-std::array<float,2>{0.0747360364f, 0.0860118568f},
-std::array<float,2>{0.865267456f, 0.294308037f},
-std::array<float,2>{0.138358623f, 0.701214969f},
-std::array<float,2>{0.678341389f, 0.859929323f},
-std::array<float,2>{0.456769645f, 0.0263092685f},
-std::array<float,2>{0.54109633f, 0.198234707f},
-std::array<float,2>{0.36869362f, 0.980374932f},
-std::array<float,2>{0.915196538f, 0.502094626f},
-std::array<float,2>{0.0525664464f, 0.415513813f},
-std::array<float,2>{0.978078306f, 0.112956055f},
-std::array<float,2>{0.0952465832f, 0.767737448f},
-std::array<float,2>{0.590657115f, 0.666404724f},
-std::array<float,2>{0.291293085f, 0.359752327f},
-std::array<float,2>{0.721096873f, 0.489347726f},
-std::array<float,2>{0.424768656f, 0.602687299f},
-std::array<float,2>{0.776291907f, 0.910601556f},
-std::array<float,2>{0.219801411f, 0.125278771f},
-std::array<float,2>{0.750940919f, 0.440153956f},
-std::array<float,2>{0.245620951f, 0.58248359f},
-std::array<float,2>{0.740862608f, 0.883664846f},
-std::array<float,2>{0.407346308f, 0.176783025f},
-std::array<float,2>{0.577883422f, 0.0633010268f},
-std::array<float,2>{0.301729977f, 0.787105143f},
-std::array<float,2>{0.990218461f, 0.631891072f},
-std::array<float,2>{0.113986589f, 0.325233459f},
-std::array<float,2>{0.925052643f, 0.230314896f},
-std::array<float,2>{0.0445534922f, 0.962685645f},
-std::array<float,2>{0.549099326f, 0.53474164f},
-std::array<float,2>{0.345398694f, 0.400015473f},
-std::array<float,2>{0.665302992f, 0.261871368f},
-std::array<float,2>{0.442561507f, 0.723606348f},
-std::array<float,2>{0.853261352f, 0.831106186f},
-std::array<float,2>{0.15436925f, 0.0582385436f},
-std::array<float,2>{0.96283567f, 0.347237319f},
-std::array<float,2>{0.0875579491f, 0.682367682f},
-std::array<float,2>{0.599819601f, 0.756920815f},
-std::array<float,2>{0.251257181f, 0.102636382f},
-std::array<float,2>{0.690627515f, 0.141663969f},
-std::array<float,2>{0.378164262f, 0.933038771f},
-std::array<float,2>{0.807243645f, 0.620879114f},
-std::array<float,2>{0.188986495f, 0.477161318f},
-std::array<float,2>{0.838859499f, 0.00812929776f},
-std::array<float,2>{0.175535008f, 0.845848858f},
-std::array<float,2>{0.626044095f, 0.704204559f},
-std::array<float,2>{0.489199609f, 0.303509086f},
-std::array<float,2>{0.504431188f, 0.424632519f},
-std::array<float,2>{0.330709636f, 0.516757667f},
-std::array<float,2>{0.897654593f, 0.989672601f},
-std::array<float,2>{0.00197797874f, 0.217469975f},
-std::array<float,2>{0.994007468f, 0.470584333f},
-std::array<float,2>{0.119383186f, 0.612121105f},
-std::array<float,2>{0.566992819f, 0.929430902f},
-std::array<float,2>{0.305923492f, 0.150555253f},
-std::array<float,2>{0.749602377f, 0.0999872386f},
-std::array<float,2>{0.414659441f, 0.760961771f},
-std::array<float,2>{0.760479808f, 0.674278557f},
-std::array<float,2>{0.236772195f, 0.353291243f},
-std::array<float,2>{0.851282895f, 0.209647343f},
-std::array<float,2>{0.148033276f, 0.993981063f},
-std::array<float,2>{0.65967989f, 0.529409647f},
-std::array<float,2>{0.446229666f, 0.429732412f},
-std::array<float,2>{0.557720721f, 0.312004954f},
-std::array<float,2>{0.352377385f, 0.711558819f},
-std::array<float,2>{0.934845984f, 0.854903996f},
-std::array<float,2>{0.036181666f, 0.00372207514f},
-std::array<float,2>{0.80222261f, 0.318269849f},
-std::array<float,2>{0.196182922f, 0.63304913f},
-std::array<float,2>{0.696372807f, 0.78991127f},
-std::array<float,2>{0.38755101f, 0.0755405128f},
-std::array<float,2>{0.605875671f, 0.180814028f},
-std::array<float,2>{0.260568351f, 0.877841651f},
-std::array<float,2>{0.959096074f, 0.590241194f},
-std::array<float,2>{0.0819377154f, 0.451986521f},
-std::array<float,2>{0.89969641f, 0.04845291f},
-std::array<float,2>{0.00841525663f, 0.838663757f},
-std::array<float,2>{0.515540183f, 0.726939023f},
-std::array<float,2>{0.339525223f, 0.250774384f},
-std::array<float,2>{0.638952494f, 0.394030362f},
-std::array<float,2>{0.493064731f, 0.539236844f},
-std::array<float,2>{0.830304921f, 0.953317046f},
-std::array<float,2>{0.18029435f, 0.219446048f},
-std::array<float,2>{0.823212206f, 0.408466488f},
-std::array<float,2>{0.159254238f, 0.510519803f},
-std::array<float,2>{0.645817041f, 0.971063316f},
-std::array<float,2>{0.476324946f, 0.19170022f},
-std::array<float,2>{0.529959738f, 0.0203315727f},
-std::array<float,2>{0.319937378f, 0.874844372f},
-std::array<float,2>{0.889468253f, 0.694599509f},
-std::array<float,2>{0.018330304f, 0.285750896f},
-std::array<float,2>{0.951357722f, 0.137024418f},
-std::array<float,2>{0.0644230098f, 0.919973791f},
-std::array<float,2>{0.623546004f, 0.599921882f},
-std::array<float,2>{0.274615556f, 0.496403962f},
-std::array<float,2>{0.703410864f, 0.374472946f},
-std::array<float,2>{0.4006612f, 0.663700879f},
-std::array<float,2>{0.79631722f, 0.780533731f},
-std::array<float,2>{0.214305252f, 0.118717648f},
-std::array<float,2>{0.912925065f, 0.273487091f},
-std::array<float,2>{0.06153607f, 0.74358964f},
-std::array<float,2>{0.53557539f, 0.813323081f},
-std::array<float,2>{0.362036318f, 0.0343905874f},
-std::array<float,2>{0.68565619f, 0.244876817f},
-std::array<float,2>{0.468062401f, 0.946766615f},
-std::array<float,2>{0.873891652f, 0.550464571f},
-std::array<float,2>{0.126323804f, 0.38706702f},
-std::array<float,2>{0.772970378f, 0.0797542855f},
-std::array<float,2>{0.232839391f, 0.802248776f},
-std::array<float,2>{0.732575059f, 0.641920388f},
-std::array<float,2>{0.436549395f, 0.332222581f},
-std::array<float,2>{0.581830144f, 0.467257589f},
-std::array<float,2>{0.282678425f, 0.575411856f},
-std::array<float,2>{0.976224065f, 0.896366894f},
-std::array<float,2>{0.105722398f, 0.165474445f},
-std::array<float,2>{0.932310045f, 0.457963854f},
-std::array<float,2>{0.0351057984f, 0.565589428f},
-std::array<float,2>{0.561710298f, 0.899630964f},
-std::array<float,2>{0.356942475f, 0.156923056f},
-std::array<float,2>{0.661492705f, 0.0934709683f},
-std::array<float,2>{0.45199126f, 0.805640042f},
-std::array<float,2>{0.846421719f, 0.655042768f},
-std::array<float,2>{0.142172024f, 0.336703092f},
-std::array<float,2>{0.762646079f, 0.241138384f},
-std::array<float,2>{0.242075041f, 0.943915606f},
-std::array<float,2>{0.743622005f, 0.56000036f},
-std::array<float,2>{0.418365836f, 0.378905177f},
-std::array<float,2>{0.564328849f, 0.272566885f},
-std::array<float,2>{0.311879665f, 0.736938477f},
-std::array<float,2>{0.997955263f, 0.823770523f},
-std::array<float,2>{0.124958426f, 0.0436117537f},
-std::array<float,2>{0.835077226f, 0.365243137f},
-std::array<float,2>{0.186971411f, 0.668008089f},
-std::array<float,2>{0.634162188f, 0.770884931f},
-std::array<float,2>{0.499925464f, 0.114894025f},
-std::array<float,2>{0.510224044f, 0.129487678f},
-std::array<float,2>{0.343223542f, 0.907447815f},
-std::array<float,2>{0.902688622f, 0.609238327f},
-std::array<float,2>{0.0122959837f, 0.485455513f},
-std::array<float,2>{0.953508019f, 0.027695775f},
-std::array<float,2>{0.084489584f, 0.866577804f},
-std::array<float,2>{0.604962826f, 0.69595629f},
-std::array<float,2>{0.264738679f, 0.290207595f},
-std::array<float,2>{0.701733947f, 0.421276122f},
-std::array<float,2>{0.38663426f, 0.506162584f},
-std::array<float,2>{0.799829423f, 0.981828868f},
-std::array<float,2>{0.199253455f, 0.200070128f},
-std::array<float,2>{0.791332424f, 0.40300262f},
-std::array<float,2>{0.217401206f, 0.536355913f},
-std::array<float,2>{0.709430635f, 0.968722522f},
-std::array<float,2>{0.40273729f, 0.231615916f},
-std::array<float,2>{0.618943334f, 0.061642848f},
-std::array<float,2>{0.281198323f, 0.835801303f},
-std::array<float,2>{0.94574815f, 0.722164452f},
-std::array<float,2>{0.0698226839f, 0.261577427f},
-std::array<float,2>{0.885227084f, 0.175232574f},
-std::array<float,2>{0.0221163146f, 0.886724293f},
-std::array<float,2>{0.524148703f, 0.580671728f},
-std::array<float,2>{0.315396279f, 0.44509846f},
-std::array<float,2>{0.643123388f, 0.323257178f},
-std::array<float,2>{0.470226586f, 0.628743947f},
-std::array<float,2>{0.826116383f, 0.783482134f},
-std::array<float,2>{0.161091045f, 0.0680349991f},
-std::array<float,2>{0.971191287f, 0.29992336f},
-std::array<float,2>{0.102463663f, 0.707371831f},
-std::array<float,2>{0.582289875f, 0.850843847f},
-std::array<float,2>{0.28683567f, 0.0123623703f},
-std::array<float,2>{0.729883909f, 0.213871211f},
-std::array<float,2>{0.43290323f, 0.988136649f},
-std::array<float,2>{0.769105852f, 0.51953876f},
-std::array<float,2>{0.228239164f, 0.42782709f},
-std::array<float,2>{0.870069623f, 0.108154677f},
-std::array<float,2>{0.132510751f, 0.751547694f},
-std::array<float,2>{0.680834889f, 0.683773816f},
-std::array<float,2>{0.464596003f, 0.349380672f},
-std::array<float,2>{0.532044172f, 0.482562333f},
-std::array<float,2>{0.36560145f, 0.623634577f},
-std::array<float,2>{0.909611642f, 0.937007785f},
-std::array<float,2>{0.0566298664f, 0.146914393f},
-std::array<float,2>{0.943461239f, 0.436765462f},
-std::array<float,2>{0.0733089596f, 0.525661588f},
-std::array<float,2>{0.609475732f, 0.997362137f},
-std::array<float,2>{0.267659009f, 0.204339266f},
-std::array<float,2>{0.71238786f, 0.00418776693f},
-std::array<float,2>{0.395839095f, 0.856694877f},
-std::array<float,2>{0.787921965f, 0.717371166f},
-std::array<float,2>{0.207019836f, 0.306638628f},
-std::array<float,2>{0.816865802f, 0.15344362f},
-std::array<float,2>{0.16970396f, 0.922085583f},
-std::array<float,2>{0.65546447f, 0.614308417f},
-std::array<float,2>{0.484042794f, 0.47334677f},
-std::array<float,2>{0.522017658f, 0.356297374f},
-std::array<float,2>{0.320602953f, 0.676397085f},
-std::array<float,2>{0.88228786f, 0.76192987f},
-std::array<float,2>{0.0252570678f, 0.0945609435f},
-std::array<float,2>{0.780360579f, 0.257110029f},
-std::array<float,2>{0.226077512f, 0.731981218f},
-std::array<float,2>{0.725144446f, 0.841063857f},
-std::array<float,2>{0.429206342f, 0.0535931289f},
-std::array<float,2>{0.588450134f, 0.223260969f},
-std::array<float,2>{0.29579857f, 0.959179997f},
-std::array<float,2>{0.984020174f, 0.54431802f},
-std::array<float,2>{0.100778118f, 0.39803642f},
-std::array<float,2>{0.921040833f, 0.0721804053f},
-std::array<float,2>{0.0502145179f, 0.795136392f},
-std::array<float,2>{0.546826065f, 0.637516081f},
-std::array<float,2>{0.371153951f, 0.314741313f},
-std::array<float,2>{0.672527492f, 0.44768241f},
-std::array<float,2>{0.459273577f, 0.588429928f},
-std::array<float,2>{0.860069454f, 0.879318655f},
-std::array<float,2>{0.135986552f, 0.18653366f},
-std::array<float,2>{0.856781304f, 0.494337082f},
-std::array<float,2>{0.151261896f, 0.595870733f},
-std::array<float,2>{0.669716537f, 0.914901972f},
-std::array<float,2>{0.439597994f, 0.133294031f},
-std::array<float,2>{0.554093421f, 0.121752955f},
-std::array<float,2>{0.348959953f, 0.774887383f},
-std::array<float,2>{0.928135991f, 0.657392085f},
-std::array<float,2>{0.0423634239f, 0.367626667f},
-std::array<float,2>{0.986743808f, 0.19025901f},
-std::array<float,2>{0.11301142f, 0.973484814f},
-std::array<float,2>{0.572727919f, 0.513204336f},
-std::array<float,2>{0.297193617f, 0.41291815f},
-std::array<float,2>{0.737454414f, 0.284536421f},
-std::array<float,2>{0.411494344f, 0.690375626f},
-std::array<float,2>{0.756334245f, 0.870087266f},
-std::array<float,2>{0.246375471f, 0.0193802714f},
-std::array<float,2>{0.892815351f, 0.330848575f},
-std::array<float,2>{0.00456476118f, 0.646344423f},
-std::array<float,2>{0.501553059f, 0.796940744f},
-std::array<float,2>{0.332743943f, 0.0845026821f},
-std::array<float,2>{0.631680429f, 0.169334948f},
-std::array<float,2>{0.485008985f, 0.891068935f},
-std::array<float,2>{0.840469778f, 0.574020863f},
-std::array<float,2>{0.177892044f, 0.464671731f},
-std::array<float,2>{0.809891284f, 0.0383311361f},
-std::array<float,2>{0.195084006f, 0.81971103f},
-std::array<float,2>{0.693128467f, 0.749278724f},
-std::array<float,2>{0.379440695f, 0.28049022f},
-std::array<float,2>{0.597347736f, 0.383199751f},
-std::array<float,2>{0.255891144f, 0.551273167f},
-std::array<float,2>{0.967529416f, 0.95109427f},
-std::array<float,2>{0.0936777815f, 0.248148516f},
-std::array<float,2>{0.917596698f, 0.417557925f},
-std::array<float,2>{0.0531547442f, 0.500663936f},
-std::array<float,2>{0.540200055f, 0.977760971f},
-std::array<float,2>{0.37043342f, 0.196285859f},
-std::array<float,2>{0.6758793f, 0.0252679549f},
-std::array<float,2>{0.454711497f, 0.862744451f},
-std::array<float,2>{0.863848865f, 0.699916422f},
-std::array<float,2>{0.13924621f, 0.29563719f},
-std::array<float,2>{0.775135577f, 0.128071353f},
-std::array<float,2>{0.221153155f, 0.912736177f},
-std::array<float,2>{0.719398022f, 0.60545373f},
-std::array<float,2>{0.421983838f, 0.492006034f},
-std::array<float,2>{0.593056738f, 0.362781584f},
-std::array<float,2>{0.289346874f, 0.664102077f},
-std::array<float,2>{0.97898376f, 0.767369092f},
-std::array<float,2>{0.0958191603f, 0.111037962f},
-std::array<float,2>{0.813450694f, 0.269096583f},
-std::array<float,2>{0.165418461f, 0.740345657f},
-std::array<float,2>{0.648440778f, 0.824993014f},
-std::array<float,2>{0.477731049f, 0.0404483378f},
-std::array<float,2>{0.518192887f, 0.237545475f},
-std::array<float,2>{0.324595213f, 0.939578354f},
-std::array<float,2>{0.875481725f, 0.557961404f},
-std::array<float,2>{0.0302068368f, 0.379201293f},
-std::array<float,2>{0.940403104f, 0.0886379629f},
-std::array<float,2>{0.076275073f, 0.809972525f},
-std::array<float,2>{0.617120147f, 0.64915055f},
-std::array<float,2>{0.270217508f, 0.34293133f},
-std::array<float,2>{0.717004478f, 0.453138441f},
-std::array<float,2>{0.392282128f, 0.569077134f},
-std::array<float,2>{0.783694327f, 0.905283511f},
-std::array<float,2>{0.209459066f, 0.163300574f},
-std::array<float,2>{0.804783046f, 0.480121106f},
-std::array<float,2>{0.189818293f, 0.617611825f},
-std::array<float,2>{0.687533319f, 0.930563629f},
-std::array<float,2>{0.375789613f, 0.142807752f},
-std::array<float,2>{0.598182619f, 0.105102554f},
-std::array<float,2>{0.253782749f, 0.755631626f},
-std::array<float,2>{0.964440823f, 0.680088758f},
-std::array<float,2>{0.0891565904f, 0.344936788f},
-std::array<float,2>{0.895668864f, 0.21491535f},
-std::array<float,2>{0.00165049918f, 0.991059482f},
-std::array<float,2>{0.506817222f, 0.518205106f},
-std::array<float,2>{0.328228325f, 0.422761172f},
-std::array<float,2>{0.628390729f, 0.301641345f},
-std::array<float,2>{0.491125703f, 0.706172109f},
-std::array<float,2>{0.836703002f, 0.844945014f},
-std::array<float,2>{0.172724873f, 0.0101798605f},
-std::array<float,2>{0.99116385f, 0.327587754f},
-std::array<float,2>{0.11708653f, 0.629435003f},
-std::array<float,2>{0.574651957f, 0.788032234f},
-std::array<float,2>{0.303120643f, 0.0658903643f},
-std::array<float,2>{0.738653839f, 0.178837374f},
-std::array<float,2>{0.409457356f, 0.885381758f},
-std::array<float,2>{0.753198504f, 0.585926056f},
-std::array<float,2>{0.243566483f, 0.437577426f},
-std::array<float,2>{0.854762554f, 0.0555716231f},
-std::array<float,2>{0.152637154f, 0.828667998f},
-std::array<float,2>{0.666815341f, 0.725203991f},
-std::array<float,2>{0.444089174f, 0.264229208f},
-std::array<float,2>{0.54688555f, 0.401341885f},
-std::array<float,2>{0.346779048f, 0.53154707f},
-std::array<float,2>{0.923642874f, 0.9639799f},
-std::array<float,2>{0.0467977338f, 0.227858499f},
-std::array<float,2>{0.958255231f, 0.450697511f},
-std::array<float,2>{0.0781504512f, 0.592059076f},
-std::array<float,2>{0.608884335f, 0.875025451f},
-std::array<float,2>{0.259668767f, 0.181871101f},
-std::array<float,2>{0.698657691f, 0.0767099932f},
-std::array<float,2>{0.390603304f, 0.792404413f},
-std::array<float,2>{0.803793013f, 0.635721743f},
-std::array<float,2>{0.198055848f, 0.319294274f},
-std::array<float,2>{0.828365266f, 0.221353471f},
-std::array<float,2>{0.182688117f, 0.956930339f},
-std::array<float,2>{0.637410879f, 0.54160732f},
-std::array<float,2>{0.495398283f, 0.39222908f},
-std::array<float,2>{0.511920154f, 0.252661079f},
-std::array<float,2>{0.335989624f, 0.729213953f},
-std::array<float,2>{0.900523841f, 0.836310863f},
-std::array<float,2>{0.0109408069f, 0.0502632f},
-std::array<float,2>{0.75797987f, 0.354548842f},
-std::array<float,2>{0.235674843f, 0.672500312f},
-std::array<float,2>{0.746897876f, 0.758758366f},
-std::array<float,2>{0.417129517f, 0.0989305601f},
-std::array<float,2>{0.569383979f, 0.150315627f},
-std::array<float,2>{0.307692677f, 0.927427828f},
-std::array<float,2>{0.994502783f, 0.609530389f},
-std::array<float,2>{0.11815168f, 0.472209841f},
-std::array<float,2>{0.936810315f, 0.00186911761f},
-std::array<float,2>{0.0371667296f, 0.852001786f},
-std::array<float,2>{0.555335402f, 0.71398598f},
-std::array<float,2>{0.354917377f, 0.309531033f},
-std::array<float,2>{0.657718182f, 0.432528079f},
-std::array<float,2>{0.448000461f, 0.52834326f},
-std::array<float,2>{0.848589599f, 0.994306922f},
-std::array<float,2>{0.146381438f, 0.208391577f},
-std::array<float,2>{0.87230736f, 0.389071822f},
-std::array<float,2>{0.128817603f, 0.546903551f},
-std::array<float,2>{0.684041321f, 0.948944211f},
-std::array<float,2>{0.465734124f, 0.242773771f},
-std::array<float,2>{0.538381219f, 0.0328351557f},
-std::array<float,2>{0.360368848f, 0.814783692f},
-std::array<float,2>{0.911515534f, 0.744972885f},
-std::array<float,2>{0.0601162799f, 0.276001573f},
-std::array<float,2>{0.974251449f, 0.167146251f},
-std::array<float,2>{0.108856648f, 0.897755504f},
-std::array<float,2>{0.578607082f, 0.577753425f},
-std::array<float,2>{0.283903331f, 0.466008067f},
-std::array<float,2>{0.730946481f, 0.334504008f},
-std::array<float,2>{0.434441f, 0.643713057f},
-std::array<float,2>{0.770776093f, 0.804059029f},
-std::array<float,2>{0.232088417f, 0.0816269591f},
-std::array<float,2>{0.888120294f, 0.288702697f},
-std::array<float,2>{0.0157110263f, 0.692575455f},
-std::array<float,2>{0.528881252f, 0.872734249f},
-std::array<float,2>{0.316559225f, 0.0227525048f},
-std::array<float,2>{0.647025704f, 0.194345146f},
-std::array<float,2>{0.473385662f, 0.969843745f},
-std::array<float,2>{0.820787311f, 0.509056449f},
-std::array<float,2>{0.157175764f, 0.407627612f},
-std::array<float,2>{0.793676496f, 0.120943874f},
-std::array<float,2>{0.212312937f, 0.778745115f},
-std::array<float,2>{0.706128061f, 0.660756052f},
-std::array<float,2>{0.399834126f, 0.372856647f},
-std::array<float,2>{0.623007894f, 0.498311609f},
-std::array<float,2>{0.27551344f, 0.598536193f},
-std::array<float,2>{0.950470448f, 0.918431222f},
-std::array<float,2>{0.0648795217f, 0.140038967f},
-std::array<float,2>{0.906220198f, 0.487563491f},
-std::array<float,2>{0.0142275468f, 0.605927229f},
-std::array<float,2>{0.509059846f, 0.909839213f},
-std::array<float,2>{0.34037286f, 0.131628379f},
-std::array<float,2>{0.636542916f, 0.115263082f},
-std::array<float,2>{0.497774035f, 0.773307323f},
-std::array<float,2>{0.832112134f, 0.670117497f},
-std::array<float,2>{0.184260666f, 0.364975065f},
-std::array<float,2>{0.797337532f, 0.201906413f},
-std::array<float,2>{0.202087298f, 0.98272264f},
-std::array<float,2>{0.700792551f, 0.505665481f},
-std::array<float,2>{0.384713173f, 0.418161362f},
-std::array<float,2>{0.603261232f, 0.291662902f},
-std::array<float,2>{0.262675613f, 0.698025942f},
-std::array<float,2>{0.956925869f, 0.863939166f},
-std::array<float,2>{0.0831393898f, 0.0299998242f},
-std::array<float,2>{0.844242275f, 0.33858344f},
-std::array<float,2>{0.142669722f, 0.652948618f},
-std::array<float,2>{0.662475586f, 0.806970179f},
-std::array<float,2>{0.450433224f, 0.0903217942f},
-std::array<float,2>{0.559228599f, 0.158691332f},
-std::array<float,2>{0.358077794f, 0.901311696f},
-std::array<float,2>{0.931388259f, 0.564341843f},
-std::array<float,2>{0.0318087786f, 0.459411591f},
-std::array<float,2>{0.999730587f, 0.0461404845f},
-std::array<float,2>{0.122692414f, 0.821382761f},
-std::array<float,2>{0.566039443f, 0.736255527f},
-std::array<float,2>{0.310496509f, 0.269553632f},
-std::array<float,2>{0.744544029f, 0.375236869f},
-std::array<float,2>{0.420220107f, 0.561963618f},
-std::array<float,2>{0.763694227f, 0.941444755f},
-std::array<float,2>{0.239814609f, 0.239873126f},
-std::array<float,2>{0.767516017f, 0.427725494f},
-std::array<float,2>{0.230087817f, 0.522254646f},
-std::array<float,2>{0.727364123f, 0.985369027f},
-std::array<float,2>{0.430591702f, 0.212228373f},
-std::array<float,2>{0.585171163f, 0.0139467269f},
-std::array<float,2>{0.288442254f, 0.848283291f},
-std::array<float,2>{0.969324648f, 0.710036159f},
-std::array<float,2>{0.103557467f, 0.298780203f},
-std::array<float,2>{0.906738997f, 0.146359086f},
-std::array<float,2>{0.0567771196f, 0.934966445f},
-std::array<float,2>{0.53423059f, 0.622236371f},
-std::array<float,2>{0.363863558f, 0.481074601f},
-std::array<float,2>{0.681776762f, 0.350614369f},
-std::array<float,2>{0.461101025f, 0.685682774f},
-std::array<float,2>{0.868333519f, 0.751966357f},
-std::array<float,2>{0.130577385f, 0.106308788f},
-std::array<float,2>{0.948724627f, 0.259135455f},
-std::array<float,2>{0.06679032f, 0.720327735f},
-std::array<float,2>{0.620218813f, 0.83339715f},
-std::array<float,2>{0.277768791f, 0.0589843169f},
-std::array<float,2>{0.707682312f, 0.232910812f},
-std::array<float,2>{0.40512979f, 0.966187298f},
-std::array<float,2>{0.789940655f, 0.537288606f},
-std::array<float,2>{0.215431303f, 0.404629827f},
-std::array<float,2>{0.827963471f, 0.0697066188f},
-std::array<float,2>{0.16294533f, 0.783109069f},
-std::array<float,2>{0.642478883f, 0.625819266f},
-std::array<float,2>{0.470788062f, 0.32205373f},
-std::array<float,2>{0.526534677f, 0.442383289f},
-std::array<float,2>{0.313331157f, 0.57854557f},
-std::array<float,2>{0.883028507f, 0.889573932f},
-std::array<float,2>{0.0199744646f, 0.172642827f},
-std::array<float,2>{0.980701804f, 0.395461679f},
-std::array<float,2>{0.0978919566f, 0.546280324f},
-std::array<float,2>{0.586830556f, 0.958368421f},
-std::array<float,2>{0.292985916f, 0.226358116f},
-std::array<float,2>{0.724284589f, 0.0523225367f},
-std::array<float,2>{0.427677721f, 0.843344569f},
-std::array<float,2>{0.778604269f, 0.733033895f},
-std::array<float,2>{0.224408403f, 0.255018383f},
-std::array<float,2>{0.862193525f, 0.184503466f},
-std::array<float,2>{0.133014202f, 0.882742882f},
-std::array<float,2>{0.675219357f, 0.587340713f},
-std::array<float,2>{0.457718045f, 0.447133243f},
-std::array<float,2>{0.543082774f, 0.314082861f},
-std::array<float,2>{0.374891818f, 0.639770389f},
-std::array<float,2>{0.918828905f, 0.793845236f},
-std::array<float,2>{0.0485931039f, 0.0732263625f},
-std::array<float,2>{0.786565781f, 0.306792319f},
-std::array<float,2>{0.20484747f, 0.716784716f},
-std::array<float,2>{0.714255154f, 0.857486367f},
-std::array<float,2>{0.397491634f, 0.00599006051f},
-std::array<float,2>{0.612053692f, 0.206753209f},
-std::array<float,2>{0.266560495f, 0.999364793f},
-std::array<float,2>{0.941721737f, 0.52460134f},
-std::array<float,2>{0.0703945085f, 0.434972048f},
-std::array<float,2>{0.880033314f, 0.096603483f},
-std::array<float,2>{0.0264351461f, 0.765409529f},
-std::array<float,2>{0.521260202f, 0.67909354f},
-std::array<float,2>{0.324179977f, 0.357941747f},
-std::array<float,2>{0.652641773f, 0.475651503f},
-std::array<float,2>{0.480906695f, 0.615689576f},
-std::array<float,2>{0.819413006f, 0.924588442f},
-std::array<float,2>{0.170551315f, 0.155688807f},
-std::array<float,2>{0.843221545f, 0.461268306f},
-std::array<float,2>{0.176403195f, 0.571727395f},
-std::array<float,2>{0.629209042f, 0.893214107f},
-std::array<float,2>{0.486761838f, 0.170875579f},
-std::array<float,2>{0.502246976f, 0.0821445808f},
-std::array<float,2>{0.334926665f, 0.800457895f},
-std::array<float,2>{0.891633034f, 0.646746695f},
-std::array<float,2>{0.00745468074f, 0.328588158f},
-std::array<float,2>{0.966008723f, 0.246991485f},
-std::array<float,2>{0.090792127f, 0.953082919f},
-std::array<float,2>{0.595000684f, 0.554014504f},
-std::array<float,2>{0.254786938f, 0.385982603f},
-std::array<float,2>{0.695154667f, 0.278102845f},
-std::array<float,2>{0.3816939f, 0.747696638f},
-std::array<float,2>{0.811651826f, 0.818119466f},
-std::array<float,2>{0.191820741f, 0.036692813f},
-std::array<float,2>{0.927549779f, 0.36921671f},
-std::array<float,2>{0.0397302285f, 0.659830987f},
-std::array<float,2>{0.5509848f, 0.776771784f},
-std::array<float,2>{0.350840002f, 0.123881385f},
-std::array<float,2>{0.67037046f, 0.134799004f},
-std::array<float,2>{0.43906194f, 0.916115642f},
-std::array<float,2>{0.858634531f, 0.594415247f},
-std::array<float,2>{0.148967415f, 0.493592232f},
-std::array<float,2>{0.755233407f, 0.0164716505f},
-std::array<float,2>{0.248750225f, 0.867248178f},
-std::array<float,2>{0.734402239f, 0.688170016f},
-std::array<float,2>{0.413861871f, 0.282531083f},
-std::array<float,2>{0.571041286f, 0.410428882f},
-std::array<float,2>{0.298967004f, 0.515621245f},
-std::array<float,2>{0.984523833f, 0.976525962f},
-std::array<float,2>{0.109480686f, 0.188572451f},
-std::array<float,2>{0.896542311f, 0.42285347f},
-std::array<float,2>{0.00381387747f, 0.518694401f},
-std::array<float,2>{0.505483985f, 0.991374433f},
-std::array<float,2>{0.331755459f, 0.216461897f},
-std::array<float,2>{0.625152946f, 0.0114905573f},
-std::array<float,2>{0.489466429f, 0.844656825f},
-std::array<float,2>{0.839842498f, 0.705740809f},
-std::array<float,2>{0.174328342f, 0.301803201f},
-std::array<float,2>{0.808162689f, 0.143573374f},
-std::array<float,2>{0.188205481f, 0.931453407f},
-std::array<float,2>{0.690017283f, 0.618225455f},
-std::array<float,2>{0.377433032f, 0.479036599f},
-std::array<float,2>{0.601278007f, 0.343783915f},
-std::array<float,2>{0.250718594f, 0.681584716f},
-std::array<float,2>{0.961766183f, 0.754148841f},
-std::array<float,2>{0.0862182006f, 0.104479961f},
-std::array<float,2>{0.852156222f, 0.264789999f},
-std::array<float,2>{0.155994251f, 0.726543248f},
-std::array<float,2>{0.664804816f, 0.829229057f},
-std::array<float,2>{0.442095786f, 0.0561842509f},
-std::array<float,2>{0.550472736f, 0.227444932f},
-std::array<float,2>{0.344608486f, 0.963338137f},
-std::array<float,2>{0.923985004f, 0.532351613f},
-std::array<float,2>{0.0429745466f, 0.401603371f},
-std::array<float,2>{0.989043236f, 0.0646157339f},
-std::array<float,2>{0.11443495f, 0.788664639f},
-std::array<float,2>{0.576697946f, 0.630151451f},
-std::array<float,2>{0.301858425f, 0.326202273f},
-std::array<float,2>{0.741923273f, 0.438548952f},
-std::array<float,2>{0.406427741f, 0.584769726f},
-std::array<float,2>{0.751475692f, 0.886201501f},
-std::array<float,2>{0.245042503f, 0.178620934f},
-std::array<float,2>{0.777157784f, 0.491045505f},
-std::array<float,2>{0.219064653f, 0.604123831f},
-std::array<float,2>{0.72185266f, 0.914007306f},
-std::array<float,2>{0.425524712f, 0.12767601f},
-std::array<float,2>{0.591781795f, 0.109716035f},
-std::array<float,2>{0.292027652f, 0.766404808f},
-std::array<float,2>{0.976607621f, 0.66540581f},
-std::array<float,2>{0.0944858491f, 0.362213165f},
-std::array<float,2>{0.914175153f, 0.196767479f},
-std::array<float,2>{0.0515232868f, 0.977519691f},
-std::array<float,2>{0.542195797f, 0.501315176f},
-std::array<float,2>{0.36778295f, 0.416370153f},
-std::array<float,2>{0.678753972f, 0.296238393f},
-std::array<float,2>{0.455142021f, 0.701049268f},
-std::array<float,2>{0.867094219f, 0.861958206f},
-std::array<float,2>{0.137026742f, 0.0238738675f},
-std::array<float,2>{0.938560367f, 0.342646033f},
-std::array<float,2>{0.0754150823f, 0.650151253f},
-std::array<float,2>{0.614314795f, 0.809042037f},
-std::array<float,2>{0.271531433f, 0.0888874158f},
-std::array<float,2>{0.715824962f, 0.162676096f},
-std::array<float,2>{0.394031584f, 0.904402375f},
-std::array<float,2>{0.78255564f, 0.570273519f},
-std::array<float,2>{0.208155781f, 0.454624653f},
-std::array<float,2>{0.816200435f, 0.0395836197f},
-std::array<float,2>{0.166355968f, 0.825927615f},
-std::array<float,2>{0.651055157f, 0.741713822f},
-std::array<float,2>{0.479360819f, 0.267708749f},
-std::array<float,2>{0.517496467f, 0.38056156f},
-std::array<float,2>{0.327614248f, 0.556853056f},
-std::array<float,2>{0.878865004f, 0.940774083f},
-std::array<float,2>{0.027544817f, 0.237035781f},
-std::array<float,2>{0.975568116f, 0.465722471f},
-std::array<float,2>{0.107239358f, 0.576966882f},
-std::array<float,2>{0.580679715f, 0.897295296f},
-std::array<float,2>{0.282213718f, 0.166556731f},
-std::array<float,2>{0.734042823f, 0.0809733868f},
-std::array<float,2>{0.436052591f, 0.803076684f},
-std::array<float,2>{0.771512508f, 0.642953515f},
-std::array<float,2>{0.233985916f, 0.335913509f},
-std::array<float,2>{0.874140024f, 0.244023874f},
-std::array<float,2>{0.125398412f, 0.947745025f},
-std::array<float,2>{0.686676264f, 0.548809707f},
-std::array<float,2>{0.467409313f, 0.389681369f},
-std::array<float,2>{0.536789358f, 0.276370317f},
-std::array<float,2>{0.363034189f, 0.74516058f},
-std::array<float,2>{0.913335264f, 0.816342294f},
-std::array<float,2>{0.0607074946f, 0.0317377225f},
-std::array<float,2>{0.794976592f, 0.371873468f},
-std::array<float,2>{0.213007435f, 0.661242425f},
-std::array<float,2>{0.704779029f, 0.777610004f},
-std::array<float,2>{0.40174216f, 0.119449832f},
-std::array<float,2>{0.624123394f, 0.13867259f},
-std::array<float,2>{0.274174035f, 0.919894814f},
-std::array<float,2>{0.952234328f, 0.598946512f},
-std::array<float,2>{0.0631700531f, 0.499251932f},
-std::array<float,2>{0.890225708f, 0.0216841269f},
-std::array<float,2>{0.0189707596f, 0.87141335f},
-std::array<float,2>{0.530885816f, 0.691566229f},
-std::array<float,2>{0.31909731f, 0.287432879f},
-std::array<float,2>{0.645350695f, 0.407105416f},
-std::array<float,2>{0.474810153f, 0.508116901f},
-std::array<float,2>{0.82369417f, 0.96940136f},
-std::array<float,2>{0.158525258f, 0.194298133f},
-std::array<float,2>{0.831064284f, 0.391253948f},
-std::array<float,2>{0.181193605f, 0.542833686f},
-std::array<float,2>{0.639969468f, 0.95546788f},
-std::array<float,2>{0.493752778f, 0.222257987f},
-std::array<float,2>{0.51411736f, 0.0497507416f},
-std::array<float,2>{0.33848691f, 0.837498665f},
-std::array<float,2>{0.898516297f, 0.729560554f},
-std::array<float,2>{0.00935641583f, 0.253379256f},
-std::array<float,2>{0.96053493f, 0.183509439f},
-std::array<float,2>{0.0806133896f, 0.876428366f},
-std::array<float,2>{0.607367933f, 0.593006909f},
-std::array<float,2>{0.261647552f, 0.44992274f},
-std::array<float,2>{0.695853949f, 0.319378346f},
-std::array<float,2>{0.388569593f, 0.636414587f},
-std::array<float,2>{0.801393151f, 0.791286707f},
-std::array<float,2>{0.196620479f, 0.0775654614f},
-std::array<float,2>{0.93402499f, 0.310284883f},
-std::array<float,2>{0.0357887298f, 0.713054299f},
-std::array<float,2>{0.557556212f, 0.852719367f},
-std::array<float,2>{0.353111535f, 0.000880550884f},
-std::array<float,2>{0.658949912f, 0.207219198f},
-std::array<float,2>{0.446616054f, 0.995795846f},
-std::array<float,2>{0.850112617f, 0.527929723f},
-std::array<float,2>{0.147049412f, 0.433572352f},
-std::array<float,2>{0.76163727f, 0.097855106f},
-std::array<float,2>{0.237652317f, 0.758796811f},
-std::array<float,2>{0.748425901f, 0.673295796f},
-std::array<float,2>{0.415339351f, 0.354295015f},
-std::array<float,2>{0.568119109f, 0.471569121f},
-std::array<float,2>{0.304965973f, 0.610937417f},
-std::array<float,2>{0.992530942f, 0.925861835f},
-std::array<float,2>{0.12022724f, 0.14932473f},
-std::array<float,2>{0.908371329f, 0.482365876f},
-std::array<float,2>{0.054960981f, 0.62116456f},
-std::array<float,2>{0.5323385f, 0.934017718f},
-std::array<float,2>{0.366330922f, 0.144742295f},
-std::array<float,2>{0.679908574f, 0.106874324f},
-std::array<float,2>{0.463053644f, 0.753311396f},
-std::array<float,2>{0.870418906f, 0.686590016f},
-std::array<float,2>{0.131384358f, 0.350221545f},
-std::array<float,2>{0.767786086f, 0.211667627f},
-std::array<float,2>{0.227104515f, 0.985257924f},
-std::array<float,2>{0.728758931f, 0.523118317f},
-std::array<float,2>{0.431805581f, 0.426496238f},
-std::array<float,2>{0.583081067f, 0.297468066f},
-std::array<float,2>{0.285874426f, 0.709240079f},
-std::array<float,2>{0.972219765f, 0.848687112f},
-std::array<float,2>{0.10302721f, 0.0147113688f},
-std::array<float,2>{0.824769676f, 0.320313364f},
-std::array<float,2>{0.161205783f, 0.626205444f},
-std::array<float,2>{0.644282818f, 0.781768262f},
-std::array<float,2>{0.468833536f, 0.0689616948f},
-std::array<float,2>{0.525066733f, 0.173140362f},
-std::array<float,2>{0.316241473f, 0.890212774f},
-std::array<float,2>{0.885962605f, 0.579802811f},
-std::array<float,2>{0.0232376009f, 0.442167163f},
-std::array<float,2>{0.946721077f, 0.0604549162f},
-std::array<float,2>{0.0692419931f, 0.832708061f},
-std::array<float,2>{0.617650449f, 0.719266057f},
-std::array<float,2>{0.280028701f, 0.257909089f},
-std::array<float,2>{0.710669637f, 0.405871004f},
-std::array<float,2>{0.403612971f, 0.538243651f},
-std::array<float,2>{0.792062581f, 0.965202808f},
-std::array<float,2>{0.21842654f, 0.233863488f},
-std::array<float,2>{0.799450696f, 0.419414073f},
-std::array<float,2>{0.200523928f, 0.504213095f},
-std::array<float,2>{0.702576756f, 0.98357749f},
-std::array<float,2>{0.385335296f, 0.202651009f},
-std::array<float,2>{0.603860497f, 0.0309262853f},
-std::array<float,2>{0.264588475f, 0.864786685f},
-std::array<float,2>{0.954189837f, 0.698405683f},
-std::array<float,2>{0.0855963379f, 0.292343289f},
-std::array<float,2>{0.903462827f, 0.132034495f},
-std::array<float,2>{0.0134472344f, 0.908552825f},
-std::array<float,2>{0.5107795f, 0.606701612f},
-std::array<float,2>{0.34264034f, 0.486598581f},
-std::array<float,2>{0.632852018f, 0.363371849f},
-std::array<float,2>{0.498366475f, 0.670959711f},
-std::array<float,2>{0.834019065f, 0.771564782f},
-std::array<float,2>{0.185998037f, 0.116411418f},
-std::array<float,2>{0.996490538f, 0.270837218f},
-std::array<float,2>{0.124016099f, 0.734886289f},
-std::array<float,2>{0.563376784f, 0.821150541f},
-std::array<float,2>{0.310945362f, 0.0454376079f},
-std::array<float,2>{0.742582023f, 0.238797724f},
-std::array<float,2>{0.418986738f, 0.943006694f},
-std::array<float,2>{0.762916625f, 0.560980976f},
-std::array<float,2>{0.240279168f, 0.375978291f},
-std::array<float,2>{0.846826792f, 0.0910861045f},
-std::array<float,2>{0.14076145f, 0.807835579f},
-std::array<float,2>{0.660335958f, 0.653917253f},
-std::array<float,2>{0.452967018f, 0.338915974f},
-std::array<float,2>{0.560795963f, 0.460680008f},
-std::array<float,2>{0.355817258f, 0.56305778f},
-std::array<float,2>{0.933479905f, 0.901853025f},
-std::array<float,2>{0.0336043946f, 0.159239247f},
-std::array<float,2>{0.968342066f, 0.384942472f},
-std::array<float,2>{0.0924661532f, 0.553322196f},
-std::array<float,2>{0.596197665f, 0.951518238f},
-std::array<float,2>{0.25703603f, 0.247829646f},
-std::array<float,2>{0.691737771f, 0.0359553285f},
-std::array<float,2>{0.380764008f, 0.817254186f},
-std::array<float,2>{0.808790565f, 0.746706486f},
-std::array<float,2>{0.194202349f, 0.278490156f},
-std::array<float,2>{0.841105998f, 0.171736032f},
-std::array<float,2>{0.178867459f, 0.894281328f},
-std::array<float,2>{0.6324417f, 0.570474684f},
-std::array<float,2>{0.485750437f, 0.461993605f},
-std::array<float,2>{0.500799f, 0.329131275f},
-std::array<float,2>{0.333191901f, 0.648001611f},
-std::array<float,2>{0.894022346f, 0.799239755f},
-std::array<float,2>{0.00547897909f, 0.0839340538f},
-std::array<float,2>{0.75762099f, 0.281671315f},
-std::array<float,2>{0.247361571f, 0.688673317f},
-std::array<float,2>{0.737200141f, 0.868446767f},
-std::array<float,2>{0.410653681f, 0.0166915935f},
-std::array<float,2>{0.573437095f, 0.187560096f},
-std::array<float,2>{0.29827109f, 0.974736333f},
-std::array<float,2>{0.987423956f, 0.513887346f},
-std::array<float,2>{0.112023808f, 0.411916018f},
-std::array<float,2>{0.928722322f, 0.124568567f},
-std::array<float,2>{0.0419510789f, 0.776039958f},
-std::array<float,2>{0.553411305f, 0.658710063f},
-std::array<float,2>{0.348138273f, 0.370933503f},
-std::array<float,2>{0.668643892f, 0.492484003f},
-std::array<float,2>{0.441227764f, 0.594792902f},
-std::array<float,2>{0.856090248f, 0.917817175f},
-std::array<float,2>{0.151614398f, 0.13604179f},
-std::array<float,2>{0.860433638f, 0.445628375f},
-std::array<float,2>{0.13516143f, 0.586625397f},
-std::array<float,2>{0.673270166f, 0.881116927f},
-std::array<float,2>{0.460237503f, 0.185116589f},
-std::array<float,2>{0.545335174f, 0.0734683573f},
-std::array<float,2>{0.372397423f, 0.794203877f},
-std::array<float,2>{0.920662105f, 0.63947165f},
-std::array<float,2>{0.0495905094f, 0.313276619f},
-std::array<float,2>{0.982714951f, 0.225222409f},
-std::array<float,2>{0.0996676236f, 0.957233012f},
-std::array<float,2>{0.589725375f, 0.545048594f},
-std::array<float,2>{0.296144009f, 0.396006584f},
-std::array<float,2>{0.726079881f, 0.254066408f},
-std::array<float,2>{0.427814871f, 0.733654678f},
-std::array<float,2>{0.779647768f, 0.842398524f},
-std::array<float,2>{0.224801883f, 0.0508611724f},
-std::array<float,2>{0.881025195f, 0.358546525f},
-std::array<float,2>{0.024339743f, 0.677781165f},
-std::array<float,2>{0.522510767f, 0.764001608f},
-std::array<float,2>{0.321764022f, 0.0966888666f},
-std::array<float,2>{0.654652417f, 0.155224457f},
-std::array<float,2>{0.482922643f, 0.925460517f},
-std::array<float,2>{0.817607582f, 0.616713524f},
-std::array<float,2>{0.168880314f, 0.475202799f},
-std::array<float,2>{0.788933933f, 0.00704733375f},
-std::array<float,2>{0.205812663f, 0.858594f},
-std::array<float,2>{0.711419165f, 0.715471447f},
-std::array<float,2>{0.395453572f, 0.307732642f},
-std::array<float,2>{0.610880017f, 0.433930337f},
-std::array<float,2>{0.268876135f, 0.52356565f},
-std::array<float,2>{0.944662392f, 0.998728514f},
-std::array<float,2>{0.0724793747f, 0.205261201f},
-std::array<float,2>{0.92197299f, 0.399104118f},
-std::array<float,2>{0.0458538309f, 0.533603668f},
-std::array<float,2>{0.548571587f, 0.961562037f},
-std::array<float,2>{0.346139252f, 0.229382858f},
-std::array<float,2>{0.667256892f, 0.0569559783f},
-std::array<float,2>{0.445260704f, 0.830299616f},
-std::array<float,2>{0.854043126f, 0.724572957f},
-std::array<float,2>{0.153617814f, 0.263537258f},
-std::array<float,2>{0.752263606f, 0.176460668f},
-std::array<float,2>{0.242322758f, 0.883933067f},
-std::array<float,2>{0.739978552f, 0.583368242f},
-std::array<float,2>{0.408210278f, 0.441077799f},
-std::array<float,2>{0.576006174f, 0.324812204f},
-std::array<float,2>{0.303892136f, 0.631803811f},
-std::array<float,2>{0.991489828f, 0.785228968f},
-std::array<float,2>{0.115935005f, 0.064408727f},
-std::array<float,2>{0.837009013f, 0.30398038f},
-std::array<float,2>{0.173068061f, 0.70370245f},
-std::array<float,2>{0.627537966f, 0.84697336f},
-std::array<float,2>{0.491444528f, 0.00895690173f},
-std::array<float,2>{0.507043481f, 0.218089446f},
-std::array<float,2>{0.329210371f, 0.989033699f},
-std::array<float,2>{0.895052373f, 0.516400576f},
-std::array<float,2>{0.00024869456f, 0.425640523f},
-std::array<float,2>{0.962950885f, 0.102177732f},
-std::array<float,2>{0.0885636955f, 0.756115854f},
-std::array<float,2>{0.599099934f, 0.683091938f},
-std::array<float,2>{0.252613246f, 0.346163362f},
-std::array<float,2>{0.689290941f, 0.477786958f},
-std::array<float,2>{0.376614153f, 0.619379103f},
-std::array<float,2>{0.806355894f, 0.932214677f},
-std::array<float,2>{0.190770268f, 0.141400635f},
-std::array<float,2>{0.785093546f, 0.456572592f},
-std::array<float,2>{0.210398182f, 0.567459047f},
-std::array<float,2>{0.718655348f, 0.904266f},
-std::array<float,2>{0.391251653f, 0.161665782f},
-std::array<float,2>{0.615593493f, 0.087715812f},
-std::array<float,2>{0.271459252f, 0.810737193f},
-std::array<float,2>{0.941269398f, 0.651756465f},
-std::array<float,2>{0.0773922205f, 0.340601355f},
-std::array<float,2>{0.876484454f, 0.235348076f},
-std::array<float,2>{0.0306447372f, 0.939426601f},
-std::array<float,2>{0.519090176f, 0.556417406f},
-std::array<float,2>{0.325748295f, 0.38255164f},
-std::array<float,2>{0.649568498f, 0.266016215f},
-std::array<float,2>{0.477289468f, 0.740090787f},
-std::array<float,2>{0.813962519f, 0.82736975f},
-std::array<float,2>{0.164671615f, 0.041682113f},
-std::array<float,2>{0.979684889f, 0.361275405f},
-std::array<float,2>{0.0973475724f, 0.667103946f},
-std::array<float,2>{0.591873229f, 0.768919528f},
-std::array<float,2>{0.290506303f, 0.111885004f},
-std::array<float,2>{0.720541358f, 0.126531675f},
-std::array<float,2>{0.423367113f, 0.911775351f},
-std::array<float,2>{0.773507297f, 0.601981044f},
-std::array<float,2>{0.221914247f, 0.48874107f},
-std::array<float,2>{0.865146637f, 0.026502125f},
-std::array<float,2>{0.140293866f, 0.860863388f},
-std::array<float,2>{0.67732507f, 0.702724278f},
-std::array<float,2>{0.453661472f, 0.293520957f},
-std::array<float,2>{0.539471626f, 0.414963216f},
-std::array<float,2>{0.369773746f, 0.503021657f},
-std::array<float,2>{0.91699034f, 0.979367614f},
-std::array<float,2>{0.0541644432f, 0.199167803f},
-std::array<float,2>{0.949287832f, 0.497086167f},
-std::array<float,2>{0.0659054145f, 0.600797594f},
-std::array<float,2>{0.621740282f, 0.921002567f},
-std::array<float,2>{0.277169883f, 0.138459355f},
-std::array<float,2>{0.705120802f, 0.118070073f},
-std::array<float,2>{0.399252087f, 0.779494941f},
-std::array<float,2>{0.793979287f, 0.662415564f},
-std::array<float,2>{0.211899593f, 0.373858362f},
-std::array<float,2>{0.821620584f, 0.192837879f},
-std::array<float,2>{0.15744482f, 0.972622871f},
-std::array<float,2>{0.647537172f, 0.511573017f},
-std::array<float,2>{0.473651141f, 0.409711748f},
-std::array<float,2>{0.528219581f, 0.286589116f},
-std::array<float,2>{0.317938179f, 0.693488538f},
-std::array<float,2>{0.887078524f, 0.873750269f},
-std::array<float,2>{0.0166097451f, 0.0209461916f},
-std::array<float,2>{0.769865155f, 0.333782554f},
-std::array<float,2>{0.231312245f, 0.641360343f},
-std::array<float,2>{0.73165077f, 0.801271439f},
-std::array<float,2>{0.434845924f, 0.0786981806f},
-std::array<float,2>{0.579172969f, 0.164326936f},
-std::array<float,2>{0.284643829f, 0.895497441f},
-std::array<float,2>{0.972859859f, 0.57498765f},
-std::array<float,2>{0.107816093f, 0.468182355f},
-std::array<float,2>{0.910458624f, 0.0340382718f},
-std::array<float,2>{0.0591992214f, 0.814131975f},
-std::array<float,2>{0.537956417f, 0.742524803f},
-std::array<float,2>{0.360345036f, 0.274537563f},
-std::array<float,2>{0.68508327f, 0.388660848f},
-std::array<float,2>{0.466619879f, 0.549531341f},
-std::array<float,2>{0.871360064f, 0.945322633f},
-std::array<float,2>{0.127659872f, 0.245886847f},
-std::array<float,2>{0.84921366f, 0.431288779f},
-std::array<float,2>{0.145066977f, 0.53062284f},
-std::array<float,2>{0.656421721f, 0.99245131f},
-std::array<float,2>{0.449066252f, 0.210128367f},
-std::array<float,2>{0.556216836f, 0.0022826707f},
-std::array<float,2>{0.353948146f, 0.85352397f},
-std::array<float,2>{0.935649753f, 0.712733924f},
-std::array<float,2>{0.0382008664f, 0.311149448f},
-std::array<float,2>{0.995356858f, 0.151966989f},
-std::array<float,2>{0.118248478f, 0.928279996f},
-std::array<float,2>{0.568940699f, 0.612877965f},
-std::array<float,2>{0.306864738f, 0.469633788f},
-std::array<float,2>{0.747450769f, 0.352211684f},
-std::array<float,2>{0.416877091f, 0.674860656f},
-std::array<float,2>{0.758965254f, 0.760426402f},
-std::array<float,2>{0.234474421f, 0.101362422f},
-std::array<float,2>{0.901831686f, 0.2511217f},
-std::array<float,2>{0.00989603158f, 0.728239179f},
-std::array<float,2>{0.513337612f, 0.839075744f},
-std::array<float,2>{0.336945862f, 0.0476194136f},
-std::array<float,2>{0.637714446f, 0.220108449f},
-std::array<float,2>{0.494907111f, 0.954239547f},
-std::array<float,2>{0.829918981f, 0.540517092f},
-std::array<float,2>{0.182304412f, 0.39281413f},
-std::array<float,2>{0.803108513f, 0.0750628114f},
-std::array<float,2>{0.198690191f, 0.790802598f},
-std::array<float,2>{0.697623193f, 0.634087563f},
-std::array<float,2>{0.388954759f, 0.31649214f},
-std::array<float,2>{0.608173907f, 0.452528238f},
-std::array<float,2>{0.257820308f, 0.591272891f},
-std::array<float,2>{0.957221866f, 0.878893554f},
-std::array<float,2>{0.0795676038f, 0.180080473f},
-std::array<float,2>{0.883984923f, 0.443372816f},
-std::array<float,2>{0.0209172964f, 0.581614256f},
-std::array<float,2>{0.526153088f, 0.888157487f},
-std::array<float,2>{0.313661695f, 0.174230039f},
-std::array<float,2>{0.641254604f, 0.0668812618f},
-std::array<float,2>{0.472266167f, 0.784303427f},
-std::array<float,2>{0.826931238f, 0.627526522f},
-std::array<float,2>{0.163196072f, 0.323230743f},
-std::array<float,2>{0.790079057f, 0.23066923f},
-std::array<float,2>{0.216569409f, 0.96775794f},
-std::array<float,2>{0.708429039f, 0.535302579f},
-std::array<float,2>{0.40533334f, 0.403331786f},
-std::array<float,2>{0.619143844f, 0.259920388f},
-std::array<float,2>{0.278786749f, 0.721655548f},
-std::array<float,2>{0.947662652f, 0.834832311f},
-std::array<float,2>{0.0681507885f, 0.0612595007f},
-std::array<float,2>{0.867456079f, 0.348330051f},
-std::array<float,2>{0.129543677f, 0.684962273f},
-std::array<float,2>{0.682856619f, 0.750486553f},
-std::array<float,2>{0.462722212f, 0.108771808f},
-std::array<float,2>{0.53371048f, 0.148206607f},
-std::array<float,2>{0.365092814f, 0.936506391f},
-std::array<float,2>{0.907925248f, 0.62411201f},
-std::array<float,2>{0.0583397076f, 0.483409911f},
-std::array<float,2>{0.970032811f, 0.0131756058f},
-std::array<float,2>{0.104872599f, 0.850219548f},
-std::array<float,2>{0.584922731f, 0.708607972f},
-std::array<float,2>{0.287923098f, 0.299093217f},
-std::array<float,2>{0.727667093f, 0.429109693f},
-std::array<float,2>{0.430855721f, 0.521363676f},
-std::array<float,2>{0.766223729f, 0.986353159f},
-std::array<float,2>{0.229251832f, 0.213367626f},
-std::array<float,2>{0.765497863f, 0.37744832f},
-std::array<float,2>{0.23864466f, 0.558959484f},
-std::array<float,2>{0.74577266f, 0.945241153f},
-std::array<float,2>{0.421857417f, 0.241920561f},
-std::array<float,2>{0.564778447f, 0.0441313647f},
-std::array<float,2>{0.309046865f, 0.822979987f},
-std::array<float,2>{0.998641193f, 0.737856269f},
-std::array<float,2>{0.121146023f, 0.271714181f},
-std::array<float,2>{0.930050552f, 0.157402784f},
-std::array<float,2>{0.0322293714f, 0.898884952f},
-std::array<float,2>{0.559764624f, 0.565188289f},
-std::array<float,2>{0.358636111f, 0.458650619f},
-std::array<float,2>{0.663252652f, 0.337293237f},
-std::array<float,2>{0.449551165f, 0.655700326f},
-std::array<float,2>{0.845631957f, 0.806579888f},
-std::array<float,2>{0.144112572f, 0.0927312896f},
-std::array<float,2>{0.955704391f, 0.289689749f},
-std::array<float,2>{0.0827269778f, 0.696816266f},
-std::array<float,2>{0.602267683f, 0.865356803f},
-std::array<float,2>{0.26308164f, 0.0291931815f},
-std::array<float,2>{0.699904025f, 0.200349331f},
-std::array<float,2>{0.38289234f, 0.981256425f},
-std::array<float,2>{0.798537672f, 0.507115543f},
-std::array<float,2>{0.203065827f, 0.420249581f},
-std::array<float,2>{0.833364725f, 0.11415071f},
-std::array<float,2>{0.185045063f, 0.770264506f},
-std::array<float,2>{0.635100603f, 0.669863045f},
-std::array<float,2>{0.496508121f, 0.366546869f},
-std::array<float,2>{0.508299351f, 0.484749854f},
-std::array<float,2>{0.341102272f, 0.608355105f},
-std::array<float,2>{0.904567719f, 0.906781673f},
-std::array<float,2>{0.0154224858f, 0.130303532f},
-std::array<float,2>{0.98551923f, 0.413909018f},
-std::array<float,2>{0.110716417f, 0.511911213f},
-std::array<float,2>{0.571822047f, 0.974511027f},
-std::array<float,2>{0.299919695f, 0.191285133f},
-std::array<float,2>{0.735624671f, 0.018539438f},
-std::array<float,2>{0.412667722f, 0.87046957f},
-std::array<float,2>{0.75449568f, 0.690677345f},
-std::array<float,2>{0.249557182f, 0.284147799f},
-std::array<float,2>{0.857804239f, 0.133943379f},
-std::array<float,2>{0.149485886f, 0.915530384f},
-std::array<float,2>{0.671522021f, 0.596890986f},
-std::array<float,2>{0.438319176f, 0.495243043f},
-std::array<float,2>{0.552122414f, 0.368919402f},
-std::array<float,2>{0.349798024f, 0.656772673f},
-std::array<float,2>{0.926074684f, 0.77373594f},
-std::array<float,2>{0.0403619893f, 0.122315049f},
-std::array<float,2>{0.811458528f, 0.279496849f},
-std::array<float,2>{0.193158001f, 0.748921335f},
-std::array<float,2>{0.694334984f, 0.818914294f},
-std::array<float,2>{0.382344574f, 0.0376046151f},
-std::array<float,2>{0.594251156f, 0.249905914f},
-std::array<float,2>{0.255806684f, 0.949647009f},
-std::array<float,2>{0.965816259f, 0.551937103f},
-std::array<float,2>{0.0915238485f, 0.384061635f},
-std::array<float,2>{0.890903533f, 0.0850177482f},
-std::array<float,2>{0.00633250037f, 0.797908127f},
-std::array<float,2>{0.503265798f, 0.644720495f},
-std::array<float,2>{0.335547626f, 0.331215292f},
-std::array<float,2>{0.630108058f, 0.463742107f},
-std::array<float,2>{0.487384707f, 0.572786331f},
-std::array<float,2>{0.842773318f, 0.892011046f},
-std::array<float,2>{0.17687881f, 0.168554544f},
-std::array<float,2>{0.818683147f, 0.47417444f},
-std::array<float,2>{0.171490118f, 0.613679767f},
-std::array<float,2>{0.653872371f, 0.923284829f},
-std::array<float,2>{0.481594473f, 0.152972519f},
-std::array<float,2>{0.520396709f, 0.0948955789f},
-std::array<float,2>{0.322301298f, 0.762821734f},
-std::array<float,2>{0.87911576f, 0.677175403f},
-std::array<float,2>{0.0254402533f, 0.356650949f},
-std::array<float,2>{0.942861795f, 0.203383997f},
-std::array<float,2>{0.0717304051f, 0.996450126f},
-std::array<float,2>{0.612978458f, 0.526386023f},
-std::array<float,2>{0.267540753f, 0.435904384f},
-std::array<float,2>{0.713295579f, 0.304924339f},
-std::array<float,2>{0.396674424f, 0.718706012f},
-std::array<float,2>{0.78574878f, 0.855937243f},
-std::array<float,2>{0.203131989f, 0.005202014f},
-std::array<float,2>{0.919705987f, 0.316225559f},
-std::array<float,2>{0.0473049134f, 0.638475537f},
-std::array<float,2>{0.543972731f, 0.796144187f},
-std::array<float,2>{0.373828858f, 0.0710035115f},
-std::array<float,2>{0.67478776f, 0.185737282f},
-std::array<float,2>{0.458340138f, 0.880167246f},
-std::array<float,2>{0.862445951f, 0.589047611f},
-std::array<float,2>{0.134548545f, 0.448680252f},
-std::array<float,2>{0.777360141f, 0.0545114316f},
-std::array<float,2>{0.222900882f, 0.840063334f},
-std::array<float,2>{0.722949326f, 0.731160164f},
-std::array<float,2>{0.426591218f, 0.255955279f},
-std::array<float,2>{0.58769089f, 0.396612823f},
-std::array<float,2>{0.294115841f, 0.54371345f},
-std::array<float,2>{0.981557786f, 0.960539579f},
-std::array<float,2>{0.0994794741f, 0.22443454f},
-std::array<float,2>{0.885388613f, 0.403721601f},
-std::array<float,2>{0.0217927806f, 0.535428286f},
-std::array<float,2>{0.523693264f, 0.967510283f},
-std::array<float,2>{0.314784318f, 0.230722457f},
-std::array<float,2>{0.642714798f, 0.061294768f},
-std::array<float,2>{0.470010966f, 0.834693909f},
-std::array<float,2>{0.825436294f, 0.721389353f},
-std::array<float,2>{0.160341009f, 0.260143995f},
-std::array<float,2>{0.791547596f, 0.173851147f},
-std::array<float,2>{0.216960117f, 0.887841105f},
-std::array<float,2>{0.709664762f, 0.581950665f},
-std::array<float,2>{0.402952284f, 0.443727434f},
-std::array<float,2>{0.618341744f, 0.322754771f},
-std::array<float,2>{0.280704409f, 0.627922356f},
-std::array<float,2>{0.946134746f, 0.784623861f},
-std::array<float,2>{0.0701339841f, 0.0665458366f},
-std::array<float,2>{0.869600177f, 0.299043298f},
-std::array<float,2>{0.132119372f, 0.708871305f},
-std::array<float,2>{0.681231916f, 0.850473166f},
-std::array<float,2>{0.464231491f, 0.0128199384f},
-std::array<float,2>{0.531554878f, 0.212925926f},
-std::array<float,2>{0.365825921f, 0.986680686f},
-std::array<float,2>{0.909807682f, 0.521155536f},
-std::array<float,2>{0.0557119772f, 0.428747892f},
-std::array<float,2>{0.971371591f, 0.108608902f},
-std::array<float,2>{0.101647466f, 0.750160277f},
-std::array<float,2>{0.582671463f, 0.684595048f},
-std::array<float,2>{0.286426097f, 0.348545402f},
-std::array<float,2>{0.730058134f, 0.483849227f},
-std::array<float,2>{0.433258653f, 0.624508977f},
-std::array<float,2>{0.768607199f, 0.93619591f},
-std::array<float,2>{0.227687985f, 0.148031309f},
-std::array<float,2>{0.761910975f, 0.458813667f},
-std::array<float,2>{0.24167569f, 0.56499517f},
-std::array<float,2>{0.744116962f, 0.898475468f},
-std::array<float,2>{0.418877602f, 0.157628f},
-std::array<float,2>{0.563774168f, 0.0922911763f},
-std::array<float,2>{0.312494636f, 0.80634129f},
-std::array<float,2>{0.997335732f, 0.655374765f},
-std::array<float,2>{0.124374971f, 0.336995333f},
-std::array<float,2>{0.931914628f, 0.242074564f},
-std::array<float,2>{0.0342561677f, 0.94494468f},
-std::array<float,2>{0.562116563f, 0.558734536f},
-std::array<float,2>{0.356595218f, 0.377896279f},
-std::array<float,2>{0.661881149f, 0.271896183f},
-std::array<float,2>{0.451657742f, 0.738256037f},
-std::array<float,2>{0.845884442f, 0.823181689f},
-std::array<float,2>{0.141813874f, 0.0444328152f},
-std::array<float,2>{0.953759193f, 0.366411239f},
-std::array<float,2>{0.0843004957f, 0.66957742f},
-std::array<float,2>{0.605330348f, 0.770094693f},
-std::array<float,2>{0.265420556f, 0.113905482f},
-std::array<float,2>{0.701507628f, 0.130049199f},
-std::array<float,2>{0.386180073f, 0.907126665f},
-std::array<float,2>{0.800331056f, 0.608007669f},
-std::array<float,2>{0.199730247f, 0.484504074f},
-std::array<float,2>{0.835730851f, 0.0288111158f},
-std::array<float,2>{0.187174216f, 0.865548313f},
-std::array<float,2>{0.634536088f, 0.697219551f},
-std::array<float,2>{0.499448627f, 0.289938956f},
-std::array<float,2>{0.510488331f, 0.420132577f},
-std::array<float,2>{0.343492806f, 0.506954312f},
-std::array<float,2>{0.90302664f, 0.981025517f},
-std::array<float,2>{0.0121857254f, 0.2004776f},
-std::array<float,2>{0.987020075f, 0.495593369f},
-std::array<float,2>{0.112478763f, 0.597057521f},
-std::array<float,2>{0.572769523f, 0.915911019f},
-std::array<float,2>{0.297564417f, 0.134111151f},
-std::array<float,2>{0.737852156f, 0.122132465f},
-std::array<float,2>{0.411991805f, 0.773589432f},
-std::array<float,2>{0.75678885f, 0.656995296f},
-std::array<float,2>{0.246957272f, 0.36876452f},
-std::array<float,2>{0.857116878f, 0.191055983f},
-std::array<float,2>{0.150539994f, 0.974360049f},
-std::array<float,2>{0.669159055f, 0.512026548f},
-std::array<float,2>{0.440358013f, 0.41375348f},
-std::array<float,2>{0.554550648f, 0.283757657f},
-std::array<float,2>{0.349557072f, 0.690476894f},
-std::array<float,2>{0.928706169f, 0.870266378f},
-std::array<float,2>{0.0427484736f, 0.018200282f},
-std::array<float,2>{0.810317338f, 0.331457794f},
-std::array<float,2>{0.194775671f, 0.644780517f},
-std::array<float,2>{0.692553282f, 0.798246384f},
-std::array<float,2>{0.378948182f, 0.0853453353f},
-std::array<float,2>{0.596892715f, 0.168911189f},
-std::array<float,2>{0.256450653f, 0.891725004f},
-std::array<float,2>{0.967024386f, 0.573186994f},
-std::array<float,2>{0.0929064378f, 0.463595748f},
-std::array<float,2>{0.893303394f, 0.0380404256f},
-std::array<float,2>{0.00393030932f, 0.819266498f},
-std::array<float,2>{0.501303077f, 0.748554587f},
-std::array<float,2>{0.332228452f, 0.279727101f},
-std::array<float,2>{0.631161988f, 0.383791655f},
-std::array<float,2>{0.484851241f, 0.552134395f},
-std::array<float,2>{0.840311348f, 0.949244142f},
-std::array<float,2>{0.17850782f, 0.24958697f},
-std::array<float,2>{0.81733346f, 0.435754985f},
-std::array<float,2>{0.169187114f, 0.526704848f},
-std::array<float,2>{0.655778885f, 0.9963094f},
-std::array<float,2>{0.483598441f, 0.20319964f},
-std::array<float,2>{0.521942854f, 0.00512084085f},
-std::array<float,2>{0.321156353f, 0.855558455f},
-std::array<float,2>{0.882447302f, 0.718469203f},
-std::array<float,2>{0.0248657409f, 0.305045277f},
-std::array<float,2>{0.944206238f, 0.15309009f},
-std::array<float,2>{0.0739282817f, 0.922902048f},
-std::array<float,2>{0.610023618f, 0.613352716f},
-std::array<float,2>{0.268115729f, 0.474425495f},
-std::array<float,2>{0.712647974f, 0.356695861f},
-std::array<float,2>{0.396390438f, 0.676909566f},
-std::array<float,2>{0.787261665f, 0.763100982f},
-std::array<float,2>{0.206236377f, 0.0951540396f},
-std::array<float,2>{0.921493173f, 0.256257713f},
-std::array<float,2>{0.0503338799f, 0.73123771f},
-std::array<float,2>{0.546349823f, 0.840275347f},
-std::array<float,2>{0.372046232f, 0.0543200895f},
-std::array<float,2>{0.672211766f, 0.224200517f},
-std::array<float,2>{0.459907949f, 0.960766673f},
-std::array<float,2>{0.859552145f, 0.543697178f},
-std::array<float,2>{0.13656424f, 0.396950454f},
-std::array<float,2>{0.781135321f, 0.0712001026f},
-std::array<float,2>{0.226054609f, 0.795934319f},
-std::array<float,2>{0.724971414f, 0.638277471f},
-std::array<float,2>{0.429065526f, 0.31594336f},
-std::array<float,2>{0.587943077f, 0.4482449f},
-std::array<float,2>{0.295224667f, 0.589174092f},
-std::array<float,2>{0.983569324f, 0.880114317f},
-std::array<float,2>{0.101254359f, 0.185900152f},
-std::array<float,2>{0.925632238f, 0.441376686f},
-std::array<float,2>{0.0441265628f, 0.58318764f},
-std::array<float,2>{0.549371958f, 0.884119987f},
-std::array<float,2>{0.344851583f, 0.176588938f},
-std::array<float,2>{0.665839136f, 0.0642005205f},
-std::array<float,2>{0.443237633f, 0.785548449f},
-std::array<float,2>{0.852997541f, 0.631532311f},
-std::array<float,2>{0.155124411f, 0.324972093f},
-std::array<float,2>{0.750010431f, 0.229162872f},
-std::array<float,2>{0.245385662f, 0.961856186f},
-std::array<float,2>{0.740291417f, 0.533268631f},
-std::array<float,2>{0.408027947f, 0.399335563f},
-std::array<float,2>{0.57716924f, 0.263208658f},
-std::array<float,2>{0.300910503f, 0.724254966f},
-std::array<float,2>{0.989439547f, 0.830326438f},
-std::array<float,2>{0.113327488f, 0.0568813942f},
-std::array<float,2>{0.838316023f, 0.345737278f},
-std::array<float,2>{0.17486845f, 0.682830811f},
-std::array<float,2>{0.626569331f, 0.755996227f},
-std::array<float,2>{0.488501668f, 0.102439716f},
-std::array<float,2>{0.503988087f, 0.141283244f},
-std::array<float,2>{0.330215633f, 0.932541251f},
-std::array<float,2>{0.897993863f, 0.619444907f},
-std::array<float,2>{0.00263817748f, 0.477582097f},
-std::array<float,2>{0.962000906f, 0.00923050661f},
-std::array<float,2>{0.0871092379f, 0.846871972f},
-std::array<float,2>{0.60021925f, 0.704067647f},
-std::array<float,2>{0.251685828f, 0.303905457f},
-std::array<float,2>{0.691056669f, 0.425298631f},
-std::array<float,2>{0.378653795f, 0.516338408f},
-std::array<float,2>{0.806774676f, 0.988803804f},
-std::array<float,2>{0.188539252f, 0.21792835f},
-std::array<float,2>{0.781940579f, 0.382771641f},
-std::array<float,2>{0.207405925f, 0.556277215f},
-std::array<float,2>{0.715481222f, 0.938983738f},
-std::array<float,2>{0.393175662f, 0.234920934f},
-std::array<float,2>{0.613413513f, 0.0419191457f},
-std::array<float,2>{0.272544652f, 0.827505708f},
-std::array<float,2>{0.938401937f, 0.739767134f},
-std::array<float,2>{0.0742674023f, 0.265833259f},
-std::array<float,2>{0.87717998f, 0.162071213f},
-std::array<float,2>{0.0286083408f, 0.903986275f},
-std::array<float,2>{0.516173184f, 0.567812502f},
-std::array<float,2>{0.326592028f, 0.456829339f},
-std::array<float,2>{0.652163088f, 0.340375185f},
-std::array<float,2>{0.480380923f, 0.651466906f},
-std::array<float,2>{0.814882278f, 0.810839951f},
-std::array<float,2>{0.167313293f, 0.0874953717f},
-std::array<float,2>{0.977993011f, 0.293777406f},
-std::array<float,2>{0.0951880664f, 0.703032434f},
-std::array<float,2>{0.589961946f, 0.861285508f},
-std::array<float,2>{0.291694343f, 0.0266764127f},
-std::array<float,2>{0.721229672f, 0.198736817f},
-std::array<float,2>{0.423931777f, 0.979239583f},
-std::array<float,2>{0.775507629f, 0.503247559f},
-std::array<float,2>{0.22052899f, 0.414611787f},
-std::array<float,2>{0.865977466f, 0.112221554f},
-std::array<float,2>{0.138043299f, 0.76859796f},
-std::array<float,2>{0.678112149f, 0.66745168f},
-std::array<float,2>{0.456213534f, 0.361045539f},
-std::array<float,2>{0.541891456f, 0.488366932f},
-std::array<float,2>{0.368505865f, 0.601751208f},
-std::array<float,2>{0.915949762f, 0.912054598f},
-std::array<float,2>{0.0520863868f, 0.126725227f},
-std::array<float,2>{0.951864243f, 0.410153925f},
-std::array<float,2>{0.0638684332f, 0.511395574f},
-std::array<float,2>{0.623381555f, 0.972247243f},
-std::array<float,2>{0.275307715f, 0.192502826f},
-std::array<float,2>{0.703715146f, 0.0206535459f},
-std::array<float,2>{0.401268274f, 0.873973906f},
-std::array<float,2>{0.796869159f, 0.693642318f},
-std::array<float,2>{0.214494437f, 0.286202192f},
-std::array<float,2>{0.822336555f, 0.138350382f},
-std::array<float,2>{0.159773931f, 0.92123425f},
-std::array<float,2>{0.646092474f, 0.601027429f},
-std::array<float,2>{0.475741595f, 0.497536451f},
-std::array<float,2>{0.52955842f, 0.373574615f},
-std::array<float,2>{0.319713891f, 0.662165344f},
-std::array<float,2>{0.888732553f, 0.779624104f},
-std::array<float,2>{0.0178450439f, 0.11781694f},
-std::array<float,2>{0.772678256f, 0.27470237f},
-std::array<float,2>{0.233092114f, 0.74221617f},
-std::array<float,2>{0.733281314f, 0.814403176f},
-std::array<float,2>{0.437051207f, 0.0337433778f},
-std::array<float,2>{0.581251442f, 0.245847315f},
-std::array<float,2>{0.282980531f, 0.945763826f},
-std::array<float,2>{0.97562784f, 0.549775481f},
-std::array<float,2>{0.106049992f, 0.388358116f},
-std::array<float,2>{0.91226393f, 0.0788587108f},
-std::array<float,2>{0.0621167272f, 0.80155009f},
-std::array<float,2>{0.535999656f, 0.641248405f},
-std::array<float,2>{0.361649841f, 0.33355853f},
-std::array<float,2>{0.686105847f, 0.467791259f},
-std::array<float,2>{0.468441635f, 0.574813306f},
-std::array<float,2>{0.873464167f, 0.89518398f},
-std::array<float,2>{0.126721099f, 0.16422309f},
-std::array<float,2>{0.850938141f, 0.469375968f},
-std::array<float,2>{0.147505492f, 0.613052368f},
-std::array<float,2>{0.659540415f, 0.928698003f},
-std::array<float,2>{0.445389509f, 0.152113348f},
-std::array<float,2>{0.558109283f, 0.101100989f},
-std::array<float,2>{0.351649165f, 0.760737896f},
-std::array<float,2>{0.935457468f, 0.675270736f},
-std::array<float,2>{0.0370761715f, 0.352320373f},
-std::array<float,2>{0.993257999f, 0.210425556f},
-std::array<float,2>{0.119833209f, 0.992402077f},
-std::array<float,2>{0.56670785f, 0.530307889f},
-std::array<float,2>{0.306341648f, 0.431426734f},
-std::array<float,2>{0.749178827f, 0.311334133f},
-std::array<float,2>{0.414201945f, 0.712570429f},
-std::array<float,2>{0.760224581f, 0.854002118f},
-std::array<float,2>{0.236974075f, 0.00202916842f},
-std::array<float,2>{0.900029361f, 0.316865444f},
-std::array<float,2>{0.00785529241f, 0.633927047f},
-std::array<float,2>{0.514860749f, 0.790753782f},
-std::array<float,2>{0.339178294f, 0.0747328401f},
-std::array<float,2>{0.639645636f, 0.179698721f},
-std::array<float,2>{0.492567569f, 0.878475308f},
-std::array<float,2>{0.830927908f, 0.591016233f},
-std::array<float,2>{0.179718032f, 0.452383995f},
-std::array<float,2>{0.802330077f, 0.04736742f},
-std::array<float,2>{0.195520774f, 0.839312911f},
-std::array<float,2>{0.697204828f, 0.728408456f},
-std::array<float,2>{0.38696748f, 0.25126794f},
-std::array<float,2>{0.606231451f, 0.392970979f},
-std::array<float,2>{0.259911776f, 0.54027617f},
-std::array<float,2>{0.959546089f, 0.954519629f},
-std::array<float,2>{0.0814298987f, 0.21996735f},
-std::array<float,2>{0.906574011f, 0.426517785f},
-std::array<float,2>{0.0575939454f, 0.5232144f},
-std::array<float,2>{0.5348019f, 0.985073447f},
-std::array<float,2>{0.363585502f, 0.211717069f},
-std::array<float,2>{0.682566106f, 0.0151105598f},
-std::array<float,2>{0.461536288f, 0.849088371f},
-std::array<float,2>{0.868670285f, 0.709129453f},
-std::array<float,2>{0.129961297f, 0.297621161f},
-std::array<float,2>{0.766782105f, 0.1448569f},
-std::array<float,2>{0.229785398f, 0.933676481f},
-std::array<float,2>{0.726979852f, 0.62155056f},
-std::array<float,2>{0.429745555f, 0.481969237f},
-std::array<float,2>{0.585591435f, 0.350522459f},
-std::array<float,2>{0.288797289f, 0.686821818f},
-std::array<float,2>{0.96876055f, 0.753071845f},
-std::array<float,2>{0.104007639f, 0.106678866f},
-std::array<float,2>{0.827259362f, 0.258167088f},
-std::array<float,2>{0.162374362f, 0.719498813f},
-std::array<float,2>{0.6416924f, 0.832873225f},
-std::array<float,2>{0.471436709f, 0.0600748323f},
-std::array<float,2>{0.52690661f, 0.23358728f},
-std::array<float,2>{0.31297788f, 0.964857221f},
-std::array<float,2>{0.883658886f, 0.538375735f},
-std::array<float,2>{0.0200919602f, 0.406229168f},
-std::array<float,2>{0.948768139f, 0.0692342743f},
-std::array<float,2>{0.0672806725f, 0.782102704f},
-std::array<float,2>{0.621002436f, 0.626419723f},
-std::array<float,2>{0.278109998f, 0.320647418f},
-std::array<float,2>{0.707260966f, 0.442130625f},
-std::array<float,2>{0.404622167f, 0.580039859f},
-std::array<float,2>{0.789415956f, 0.890485764f},
-std::array<float,2>{0.215261042f, 0.17309171f},
-std::array<float,2>{0.797449768f, 0.486390501f},
-std::array<float,2>{0.201378897f, 0.606610954f},
-std::array<float,2>{0.700419426f, 0.908204556f},
-std::array<float,2>{0.384089649f, 0.132211849f},
-std::array<float,2>{0.602600992f, 0.116635531f},
-std::array<float,2>{0.261865795f, 0.77187413f},
-std::array<float,2>{0.956421971f, 0.671290576f},
-std::array<float,2>{0.0837745294f, 0.363681644f},
-std::array<float,2>{0.905398071f, 0.202946231f},
-std::array<float,2>{0.013707757f, 0.983813405f},
-std::array<float,2>{0.509290516f, 0.50396812f},
-std::array<float,2>{0.340061098f, 0.419047177f},
-std::array<float,2>{0.6359393f, 0.292076468f},
-std::array<float,2>{0.497460008f, 0.698650301f},
-std::array<float,2>{0.832699776f, 0.865218282f},
-std::array<float,2>{0.183943301f, 0.0311154593f},
-std::array<float,2>{0.999163806f, 0.339190155f},
-std::array<float,2>{0.122481644f, 0.654220998f},
-std::array<float,2>{0.565618515f, 0.807975829f},
-std::array<float,2>{0.309615821f, 0.0909489617f},
-std::array<float,2>{0.744962513f, 0.159522951f},
-std::array<float,2>{0.420584321f, 0.901498735f},
-std::array<float,2>{0.764637947f, 0.563355386f},
-std::array<float,2>{0.239297345f, 0.460850835f},
-std::array<float,2>{0.843763292f, 0.0457429178f},
-std::array<float,2>{0.143120676f, 0.820804417f},
-std::array<float,2>{0.662922621f, 0.735244215f},
-std::array<float,2>{0.450756907f, 0.270658106f},
-std::array<float,2>{0.558743894f, 0.376250625f},
-std::array<float,2>{0.357880235f, 0.560657203f},
-std::array<float,2>{0.930694163f, 0.943125129f},
-std::array<float,2>{0.0313722938f, 0.239170179f},
-std::array<float,2>{0.966562152f, 0.462363809f},
-std::array<float,2>{0.0900039375f, 0.570612848f},
-std::array<float,2>{0.595447421f, 0.894505084f},
-std::array<float,2>{0.254120946f, 0.17161566f},
-std::array<float,2>{0.694458842f, 0.0835440457f},
-std::array<float,2>{0.381173134f, 0.798915386f},
-std::array<float,2>{0.812117994f, 0.648374379f},
-std::array<float,2>{0.192334145f, 0.32940799f},
-std::array<float,2>{0.843559504f, 0.247701645f},
-std::array<float,2>{0.176252246f, 0.951210141f},
-std::array<float,2>{0.629750967f, 0.553621888f},
-std::array<float,2>{0.487046123f, 0.385133564f},
-std::array<float,2>{0.502540946f, 0.278687686f},
-std::array<float,2>{0.334197015f, 0.746894658f},
-std::array<float,2>{0.892366469f, 0.816972136f},
-std::array<float,2>{0.00715502491f, 0.0357959531f},
-std::array<float,2>{0.755529225f, 0.370668143f},
-std::array<float,2>{0.248266354f, 0.659034491f},
-std::array<float,2>{0.735351562f, 0.77626121f},
-std::array<float,2>{0.41316697f, 0.124967217f},
-std::array<float,2>{0.570577145f, 0.135780603f},
-std::array<float,2>{0.299498796f, 0.917527974f},
-std::array<float,2>{0.985249162f, 0.595116615f},
-std::array<float,2>{0.110249184f, 0.492338181f},
-std::array<float,2>{0.927189231f, 0.0168851819f},
-std::array<float,2>{0.0393649414f, 0.868256927f},
-std::array<float,2>{0.551466763f, 0.688857198f},
-std::array<float,2>{0.351536661f, 0.281435192f},
-std::array<float,2>{0.67043674f, 0.411754966f},
-std::array<float,2>{0.438836455f, 0.513990998f},
-std::array<float,2>{0.859039605f, 0.974873781f},
-std::array<float,2>{0.148499519f, 0.187808022f},
-std::array<float,2>{0.861410022f, 0.396469086f},
-std::array<float,2>{0.133434966f, 0.545393169f},
-std::array<float,2>{0.675623119f, 0.957367003f},
-std::array<float,2>{0.457389563f, 0.22557506f},
-std::array<float,2>{0.543596447f, 0.0510539189f},
-std::array<float,2>{0.374242097f, 0.842738569f},
-std::array<float,2>{0.918118f, 0.733491063f},
-std::array<float,2>{0.0479102172f, 0.254211605f},
-std::array<float,2>{0.981299937f, 0.185316131f},
-std::array<float,2>{0.098444283f, 0.880972505f},
-std::array<float,2>{0.586124778f, 0.586890459f},
-std::array<float,2>{0.29385668f, 0.445421308f},
-std::array<float,2>{0.723754764f, 0.313162208f},
-std::array<float,2>{0.426855445f, 0.639280915f},
-std::array<float,2>{0.779061079f, 0.794130623f},
-std::array<float,2>{0.223913282f, 0.0735568181f},
-std::array<float,2>{0.880744815f, 0.307961941f},
-std::array<float,2>{0.0271051414f, 0.715750635f},
-std::array<float,2>{0.520633876f, 0.858657479f},
-std::array<float,2>{0.323723435f, 0.00726725115f},
-std::array<float,2>{0.65307492f, 0.205558509f},
-std::array<float,2>{0.481066614f, 0.998815298f},
-std::array<float,2>{0.819825351f, 0.523693681f},
-std::array<float,2>{0.170264646f, 0.433823138f},
-std::array<float,2>{0.786950648f, 0.0970748886f},
-std::array<float,2>{0.204290897f, 0.76369524f},
-std::array<float,2>{0.714656532f, 0.678160548f},
-std::array<float,2>{0.397997141f, 0.358846009f},
-std::array<float,2>{0.611528218f, 0.47540164f},
-std::array<float,2>{0.266015947f, 0.616950512f},
-std::array<float,2>{0.942011118f, 0.925573468f},
-std::array<float,2>{0.071187824f, 0.154985413f},
-std::array<float,2>{0.895997345f, 0.47928369f},
-std::array<float,2>{0.00107970927f, 0.618616343f},
-std::array<float,2>{0.506119728f, 0.931372344f},
-std::array<float,2>{0.328757167f, 0.143950075f},
-std::array<float,2>{0.628769875f, 0.104189605f},
-std::array<float,2>{0.490513176f, 0.754248559f},
-std::array<float,2>{0.836176753f, 0.681301236f},
-std::array<float,2>{0.172180131f, 0.344104558f},
-std::array<float,2>{0.805602014f, 0.216724083f},
-std::array<float,2>{0.190002441f, 0.991641819f},
-std::array<float,2>{0.688435674f, 0.51895833f},
-std::array<float,2>{0.375043899f, 0.423215449f},
-std::array<float,2>{0.597879469f, 0.302016586f},
-std::array<float,2>{0.253311872f, 0.706015706f},
-std::array<float,2>{0.964106679f, 0.844464064f},
-std::array<float,2>{0.0897955894f, 0.0114197694f},
-std::array<float,2>{0.855297565f, 0.326660126f},
-std::array<float,2>{0.15314737f, 0.630072236f},
-std::array<float,2>{0.666211784f, 0.789039373f},
-std::array<float,2>{0.44360739f, 0.0648086444f},
-std::array<float,2>{0.547393322f, 0.178415075f},
-std::array<float,2>{0.347286105f, 0.885952592f},
-std::array<float,2>{0.92318058f, 0.584489405f},
-std::array<float,2>{0.0460491925f, 0.438898712f},
-std::array<float,2>{0.990401745f, 0.0565011352f},
-std::array<float,2>{0.116655067f, 0.829345942f},
-std::array<float,2>{0.57488662f, 0.726230919f},
-std::array<float,2>{0.303367108f, 0.2649028f},
-std::array<float,2>{0.738950372f, 0.401729375f},
-std::array<float,2>{0.409744352f, 0.532658756f},
-std::array<float,2>{0.753865302f, 0.96302712f},
-std::array<float,2>{0.243934348f, 0.227135733f},
-std::array<float,2>{0.774675012f, 0.416025251f},
-std::array<float,2>{0.22160539f, 0.501190186f},
-std::array<float,2>{0.718864143f, 0.977110445f},
-std::array<float,2>{0.422493547f, 0.196423471f},
-std::array<float,2>{0.59338814f, 0.0235481337f},
-std::array<float,2>{0.289870173f, 0.86213851f},
-std::array<float,2>{0.979334176f, 0.700691938f},
-std::array<float,2>{0.0966755375f, 0.296120971f},
-std::array<float,2>{0.917431176f, 0.127824798f},
-std::array<float,2>{0.0532909334f, 0.913645148f},
-std::array<float,2>{0.540820777f, 0.604347169f},
-std::array<float,2>{0.370914727f, 0.490811437f},
-std::array<float,2>{0.676551163f, 0.361988276f},
-std::array<float,2>{0.454337686f, 0.665144861f},
-std::array<float,2>{0.86331749f, 0.76611495f},
-std::array<float,2>{0.139122158f, 0.109531164f},
-std::array<float,2>{0.939683318f, 0.267906725f},
-std::array<float,2>{0.0768849999f, 0.742097676f},
-std::array<float,2>{0.616348982f, 0.826110363f},
-std::array<float,2>{0.269694149f, 0.0398453437f},
-std::array<float,2>{0.717493117f, 0.237148702f},
-std::array<float,2>{0.392078131f, 0.940553248f},
-std::array<float,2>{0.783204615f, 0.556933582f},
-std::array<float,2>{0.209513918f, 0.380823672f},
-std::array<float,2>{0.812729776f, 0.0891220272f},
-std::array<float,2>{0.165734112f, 0.808761299f},
-std::array<float,2>{0.649174333f, 0.649951398f},
-std::array<float,2>{0.478152156f, 0.342499971f},
-std::array<float,2>{0.517653167f, 0.455031961f},
-std::array<float,2>{0.324831426f, 0.569950223f},
-std::array<float,2>{0.875876427f, 0.904721916f},
-std::array<float,2>{0.0296770409f, 0.162936062f},
-std::array<float,2>{0.974118114f, 0.389998406f},
-std::array<float,2>{0.108997427f, 0.548460186f},
-std::array<float,2>{0.579041898f, 0.947424233f},
-std::array<float,2>{0.283489794f, 0.243852019f},
-std::array<float,2>{0.731155515f, 0.0313560069f},
-std::array<float,2>{0.433768034f, 0.815921962f},
-std::array<float,2>{0.771214783f, 0.745603502f},
-std::array<float,2>{0.231899276f, 0.276794672f},
-std::array<float,2>{0.872864664f, 0.166951612f},
-std::array<float,2>{0.128218263f, 0.897133291f},
-std::array<float,2>{0.684140503f, 0.576872408f},
-std::array<float,2>{0.465283155f, 0.465479583f},
-std::array<float,2>{0.539042115f, 0.33547163f},
-std::array<float,2>{0.361139685f, 0.642784715f},
-std::array<float,2>{0.911628127f, 0.80285871f},
-std::array<float,2>{0.0600453168f, 0.08067476f},
-std::array<float,2>{0.793085635f, 0.287218183f},
-std::array<float,2>{0.212703019f, 0.691849589f},
-std::array<float,2>{0.706974626f, 0.871160507f},
-std::array<float,2>{0.400372565f, 0.0219022054f},
-std::array<float,2>{0.622150183f, 0.19391042f},
-std::array<float,2>{0.276056349f, 0.969564199f},
-std::array<float,2>{0.95076853f, 0.507925093f},
-std::array<float,2>{0.0654253289f, 0.406867951f},
-std::array<float,2>{0.888290048f, 0.119346581f},
-std::array<float,2>{0.0165509135f, 0.777575552f},
-std::array<float,2>{0.52834183f, 0.661408544f},
-std::array<float,2>{0.317297012f, 0.37172693f},
-std::array<float,2>{0.646733999f, 0.499490499f},
-std::array<float,2>{0.472776532f, 0.598658323f},
-std::array<float,2>{0.820874691f, 0.919632435f},
-std::array<float,2>{0.156348735f, 0.139002293f},
-std::array<float,2>{0.828875601f, 0.449955374f},
-std::array<float,2>{0.18345423f, 0.593061924f},
-std::array<float,2>{0.636844218f, 0.876022696f},
-std::array<float,2>{0.495886385f, 0.183292404f},
-std::array<float,2>{0.51236099f, 0.0771812499f},
-std::array<float,2>{0.336600602f, 0.791015625f},
-std::array<float,2>{0.900962651f, 0.636477411f},
-std::array<float,2>{0.0112876082f, 0.319599092f},
-std::array<float,2>{0.958842337f, 0.222468883f},
-std::array<float,2>{0.0790321231f, 0.955121338f},
-std::array<float,2>{0.608958542f, 0.542644739f},
-std::array<float,2>{0.258918941f, 0.391418368f},
-std::array<float,2>{0.698834896f, 0.253038824f},
-std::array<float,2>{0.389693588f, 0.729976356f},
-std::array<float,2>{0.804394543f, 0.837669969f},
-std::array<float,2>{0.19741869f, 0.0493423343f},
-std::array<float,2>{0.937474132f, 0.354231626f},
-std::array<float,2>{0.0378787406f, 0.67291081f},
-std::array<float,2>{0.555036187f, 0.759135962f},
-std::array<float,2>{0.355281591f, 0.0979704708f},
-std::array<float,2>{0.65763855f, 0.149033532f},
-std::array<float,2>{0.447443277f, 0.926139951f},
-std::array<float,2>{0.847991347f, 0.611125529f},
-std::array<float,2>{0.145973936f, 0.471423239f},
-std::array<float,2>{0.758575499f, 0.000591069111f},
-std::array<float,2>{0.236142516f, 0.852951944f},
-std::array<float,2>{0.746190786f, 0.713355303f},
-std::array<float,2>{0.417549133f, 0.310392886f},
-std::array<float,2>{0.570278764f, 0.433138996f},
-std::array<float,2>{0.308281392f, 0.528246641f},
-std::array<float,2>{0.994938135f, 0.995948672f},
-std::array<float,2>{0.117485099f, 0.207453221f},
-std::array<float,2>{0.90423888f, 0.418303251f},
-std::array<float,2>{0.0127180144f, 0.505612075f},
-std::array<float,2>{0.51135993f, 0.982454062f},
-std::array<float,2>{0.341835231f, 0.201751813f},
-std::array<float,2>{0.633628011f, 0.0301940776f},
-std::array<float,2>{0.498940855f, 0.864139974f},
-std::array<float,2>{0.834613204f, 0.697843075f},
-std::array<float,2>{0.186317876f, 0.291845828f},
-std::array<float,2>{0.799033403f, 0.131459802f},
-std::array<float,2>{0.201151833f, 0.910012841f},
-std::array<float,2>{0.70288676f, 0.605551004f},
-std::array<float,2>{0.385246068f, 0.487320721f},
-std::array<float,2>{0.604390442f, 0.3650451f},
-std::array<float,2>{0.263836235f, 0.670330524f},
-std::array<float,2>{0.954846621f, 0.773036599f},
-std::array<float,2>{0.0851277485f, 0.115544572f},
-std::array<float,2>{0.847406328f, 0.269966513f},
-std::array<float,2>{0.141402975f, 0.736002862f},
-std::array<float,2>{0.660913944f, 0.821693182f},
-std::array<float,2>{0.452261716f, 0.046290122f},
-std::array<float,2>{0.561446726f, 0.240157753f},
-std::array<float,2>{0.356294334f, 0.941719711f},
-std::array<float,2>{0.932853818f, 0.561610878f},
-std::array<float,2>{0.0338198282f, 0.375410885f},
-std::array<float,2>{0.996765196f, 0.0898739621f},
-std::array<float,2>{0.123261787f, 0.806672215f},
-std::array<float,2>{0.562588513f, 0.653135002f},
-std::array<float,2>{0.311483294f, 0.338775933f},
-std::array<float,2>{0.743064106f, 0.459186465f},
-std::array<float,2>{0.419439256f, 0.564071119f},
-std::array<float,2>{0.763542235f, 0.900906146f},
-std::array<float,2>{0.240915194f, 0.158248693f},
-std::array<float,2>{0.768250346f, 0.481414557f},
-std::array<float,2>{0.226698309f, 0.622460485f},
-std::array<float,2>{0.729103625f, 0.934693336f},
-std::array<float,2>{0.432339698f, 0.146182641f},
-std::array<float,2>{0.583946645f, 0.106115229f},
-std::array<float,2>{0.285290658f, 0.752279043f},
-std::array<float,2>{0.972125173f, 0.685980082f},
-std::array<float,2>{0.103229143f, 0.351002008f},
-std::array<float,2>{0.908953846f, 0.212153941f},
-std::array<float,2>{0.0552756153f, 0.985675275f},
-std::array<float,2>{0.532931924f, 0.522055805f},
-std::array<float,2>{0.367143333f, 0.427305639f},
-std::array<float,2>{0.680223107f, 0.298437297f},
-std::array<float,2>{0.463410258f, 0.710217178f},
-std::array<float,2>{0.87090975f, 0.848455191f},
-std::array<float,2>{0.131051615f, 0.0136920717f},
-std::array<float,2>{0.946981907f, 0.321915865f},
-std::array<float,2>{0.0683740228f, 0.625651956f},
-std::array<float,2>{0.617929816f, 0.782765031f},
-std::array<float,2>{0.279650569f, 0.0693608075f},
-std::array<float,2>{0.710145354f, 0.172432855f},
-std::array<float,2>{0.403930336f, 0.889383137f},
-std::array<float,2>{0.792672396f, 0.578169823f},
-std::array<float,2>{0.217813462f, 0.442774683f},
-std::array<float,2>{0.824314296f, 0.0587323196f},
-std::array<float,2>{0.161854714f, 0.83313489f},
-std::array<float,2>{0.643712223f, 0.720541596f},
-std::array<float,2>{0.469688058f, 0.258935422f},
-std::array<float,2>{0.524529457f, 0.404385954f},
-std::array<float,2>{0.315860868f, 0.537478805f},
-std::array<float,2>{0.886574268f, 0.965855777f},
-std::array<float,2>{0.0225584581f, 0.233344153f},
-std::array<float,2>{0.983181417f, 0.446840465f},
-std::array<float,2>{0.100111611f, 0.586914957f},
-std::array<float,2>{0.589131355f, 0.882326841f},
-std::array<float,2>{0.296606481f, 0.18415691f},
-std::array<float,2>{0.72592622f, 0.0727916285f},
-std::array<float,2>{0.428643525f, 0.793679714f},
-std::array<float,2>{0.780264437f, 0.639946282f},
-std::array<float,2>{0.225542098f, 0.314400971f},
-std::array<float,2>{0.861318707f, 0.226174101f},
-std::array<float,2>{0.13535668f, 0.958012402f},
-std::array<float,2>{0.673413694f, 0.545928061f},
-std::array<float,2>{0.46083346f, 0.395049185f},
-std::array<float,2>{0.545458138f, 0.255240381f},
-std::array<float,2>{0.373004258f, 0.733290195f},
-std::array<float,2>{0.920215547f, 0.843513608f},
-std::array<float,2>{0.0489522479f, 0.0525205359f},
-std::array<float,2>{0.788152099f, 0.358277947f},
-std::array<float,2>{0.205081105f, 0.67884165f},
-std::array<float,2>{0.711910784f, 0.76533401f},
-std::array<float,2>{0.39462921f, 0.096425496f},
-std::array<float,2>{0.610828102f, 0.155279517f},
-std::array<float,2>{0.26928708f, 0.924559593f},
-std::array<float,2>{0.944951475f, 0.615425348f},
-std::array<float,2>{0.0728711784f, 0.475995511f},
-std::array<float,2>{0.881397784f, 0.00631846767f},
-std::array<float,2>{0.023516899f, 0.857747257f},
-std::array<float,2>{0.523310065f, 0.716479659f},
-std::array<float,2>{0.321954995f, 0.307065845f},
-std::array<float,2>{0.655131996f, 0.43470031f},
-std::array<float,2>{0.482739508f, 0.52486819f},
-std::array<float,2>{0.818333924f, 0.999232471f},
-std::array<float,2>{0.168235183f, 0.206957087f},
-std::array<float,2>{0.841789842f, 0.386132598f},
-std::array<float,2>{0.179463983f, 0.553900063f},
-std::array<float,2>{0.632029235f, 0.952813745f},
-std::array<float,2>{0.485946864f, 0.246817559f},
-std::array<float,2>{0.500022829f, 0.0369557962f},
-std::array<float,2>{0.333619744f, 0.817914248f},
-std::array<float,2>{0.894372225f, 0.74796164f},
-std::array<float,2>{0.00500410097f, 0.27797538f},
-std::array<float,2>{0.968162358f, 0.170464098f},
-std::array<float,2>{0.0920770764f, 0.89353013f},
-std::array<float,2>{0.595974803f, 0.571463406f},
-std::array<float,2>{0.257416785f, 0.461111128f},
-std::array<float,2>{0.692180872f, 0.328328848f},
-std::array<float,2>{0.380242705f, 0.646688879f},
-std::array<float,2>{0.809283853f, 0.800710917f},
-std::array<float,2>{0.193642676f, 0.082478337f},
-std::array<float,2>{0.929227471f, 0.282231927f},
-std::array<float,2>{0.0412075296f, 0.688256979f},
-std::array<float,2>{0.552981138f, 0.867514133f},
-std::array<float,2>{0.348463446f, 0.0162948146f},
-std::array<float,2>{0.668363452f, 0.188736826f},
-std::array<float,2>{0.440888673f, 0.976254463f},
-std::array<float,2>{0.855581284f, 0.515320539f},
-std::array<float,2>{0.15225184f, 0.410340071f},
-std::array<float,2>{0.756882012f, 0.123775087f},
-std::array<float,2>{0.248019576f, 0.776422739f},
-std::array<float,2>{0.736691475f, 0.660045385f},
-std::array<float,2>{0.410446823f, 0.369590372f},
-std::array<float,2>{0.573828638f, 0.493241519f},
-std::array<float,2>{0.298439503f, 0.594596326f},
-std::array<float,2>{0.988033473f, 0.916317999f},
-std::array<float,2>{0.111458547f, 0.135046273f},
-std::array<float,2>{0.914678514f, 0.49188742f},
-std::array<float,2>{0.0511063486f, 0.605217457f},
-std::array<float,2>{0.54259795f, 0.913050234f},
-std::array<float,2>{0.367384523f, 0.128210887f},
-std::array<float,2>{0.679299533f, 0.1113175f},
-std::array<float,2>{0.455958843f, 0.767331481f},
-std::array<float,2>{0.866457343f, 0.664395809f},
-std::array<float,2>{0.137425676f, 0.362435102f},
-std::array<float,2>{0.776852727f, 0.195918426f},
-std::array<float,2>{0.219697922f, 0.977855504f},
-std::array<float,2>{0.722358525f, 0.500829756f},
-std::array<float,2>{0.425133407f, 0.417905629f},
-std::array<float,2>{0.591198325f, 0.295778036f},
-std::array<float,2>{0.292921811f, 0.700167179f},
-std::array<float,2>{0.977187991f, 0.862397671f},
-std::array<float,2>{0.0937683284f, 0.0249910187f},
-std::array<float,2>{0.815805793f, 0.343123108f},
-std::array<float,2>{0.166631669f, 0.649353385f},
-std::array<float,2>{0.650521994f, 0.809726298f},
-std::array<float,2>{0.478571177f, 0.0884407833f},
-std::array<float,2>{0.516836405f, 0.163510025f},
-std::array<float,2>{0.327991575f, 0.905630469f},
-std::array<float,2>{0.878121674f, 0.569292009f},
-std::array<float,2>{0.0279065575f, 0.45347479f},
-std::array<float,2>{0.939276934f, 0.0402667671f},
-std::array<float,2>{0.0760944113f, 0.824785769f},
-std::array<float,2>{0.614825606f, 0.740701497f},
-std::array<float,2>{0.272363693f, 0.269512981f},
-std::array<float,2>{0.71677357f, 0.379119188f},
-std::array<float,2>{0.39427644f, 0.557626784f},
-std::array<float,2>{0.782810271f, 0.939940393f},
-std::array<float,2>{0.208832264f, 0.237789586f},
-std::array<float,2>{0.807699323f, 0.42259568f},
-std::array<float,2>{0.187802002f, 0.518480241f},
-std::array<float,2>{0.68955785f, 0.990840733f},
-std::array<float,2>{0.377867013f, 0.215289444f},
-std::array<float,2>{0.600639522f, 0.00981186423f},
-std::array<float,2>{0.250307024f, 0.845176995f},
-std::array<float,2>{0.961313188f, 0.706412137f},
-std::array<float,2>{0.0866120234f, 0.301404804f},
-std::array<float,2>{0.897369146f, 0.142920554f},
-std::array<float,2>{0.00308269006f, 0.930351555f},
-std::array<float,2>{0.505015194f, 0.617325127f},
-std::array<float,2>{0.331452012f, 0.480278164f},
-std::array<float,2>{0.625957072f, 0.344972759f},
-std::array<float,2>{0.490063488f, 0.679739118f},
-std::array<float,2>{0.839354157f, 0.755512059f},
-std::array<float,2>{0.174254388f, 0.105462298f},
-std::array<float,2>{0.988434732f, 0.264588594f},
-std::array<float,2>{0.114846028f, 0.725568473f},
-std::array<float,2>{0.57631439f, 0.829012573f},
-std::array<float,2>{0.302399635f, 0.0553413816f},
-std::array<float,2>{0.741680324f, 0.227659002f},
-std::array<float,2>{0.407067448f, 0.964228749f},
-std::array<float,2>{0.751439512f, 0.531365871f},
-std::array<float,2>{0.244270772f, 0.40112257f},
-std::array<float,2>{0.851872385f, 0.0655608699f},
-std::array<float,2>{0.155486256f, 0.787653267f},
-std::array<float,2>{0.664395809f, 0.62964499f},
-std::array<float,2>{0.441715539f, 0.327373683f},
-std::array<float,2>{0.55007261f, 0.437866002f},
-std::array<float,2>{0.343870699f, 0.585485041f},
-std::array<float,2>{0.924422503f, 0.885601521f},
-std::array<float,2>{0.043684978f, 0.179099724f},
-std::array<float,2>{0.960012257f, 0.392470062f},
-std::array<float,2>{0.0803912804f, 0.541776061f},
-std::array<float,2>{0.606729746f, 0.95664686f},
-std::array<float,2>{0.26074627f, 0.221543774f},
-std::array<float,2>{0.695528924f, 0.0498792641f},
-std::array<float,2>{0.388069332f, 0.835945308f},
-std::array<float,2>{0.801042795f, 0.72946167f},
-std::array<float,2>{0.196815029f, 0.252738804f},
-std::array<float,2>{0.831663191f, 0.182111219f},
-std::array<float,2>{0.180862486f, 0.875267386f},
-std::array<float,2>{0.640161514f, 0.591884732f},
-std::array<float,2>{0.493594766f, 0.450934172f},
-std::array<float,2>{0.514411092f, 0.318914741f},
-std::array<float,2>{0.337927669f, 0.635470808f},
-std::array<float,2>{0.899324775f, 0.792095125f},
-std::array<float,2>{0.00905896351f, 0.0770634413f},
-std::array<float,2>{0.761209846f, 0.30910632f},
-std::array<float,2>{0.237873212f, 0.714337707f},
-std::array<float,2>{0.748535633f, 0.851785421f},
-std::array<float,2>{0.415591598f, 0.00150466268f},
-std::array<float,2>{0.567667663f, 0.208182782f},
-std::array<float,2>{0.305418611f, 0.994425237f},
-std::array<float,2>{0.992686987f, 0.5287655f},
-std::array<float,2>{0.12098489f, 0.432177991f},
-std::array<float,2>{0.934102535f, 0.0987399444f},
-std::array<float,2>{0.0352111049f, 0.758459687f},
-std::array<float,2>{0.556676567f, 0.67271626f},
-std::array<float,2>{0.352842867f, 0.35481748f},
-std::array<float,2>{0.658526361f, 0.472495496f},
-std::array<float,2>{0.446976572f, 0.609620214f},
-std::array<float,2>{0.849776983f, 0.927540243f},
-std::array<float,2>{0.146948591f, 0.149924889f},
-std::array<float,2>{0.874936223f, 0.46630621f},
-std::array<float,2>{0.125884637f, 0.577927053f},
-std::array<float,2>{0.687036216f, 0.897568643f},
-std::array<float,2>{0.466988564f, 0.167318538f},
-std::array<float,2>{0.536501586f, 0.0819621384f},
-std::array<float,2>{0.362594604f, 0.803732634f},
-std::array<float,2>{0.914018869f, 0.643947959f},
-std::array<float,2>{0.0613941289f, 0.334958375f},
-std::array<float,2>{0.974924147f, 0.243099406f},
-std::array<float,2>{0.106914654f, 0.949049652f},
-std::array<float,2>{0.58031863f, 0.547129929f},
-std::array<float,2>{0.281664282f, 0.388820469f},
-std::array<float,2>{0.733399332f, 0.276191354f},
-std::array<float,2>{0.43592459f, 0.744736552f},
-std::array<float,2>{0.772423089f, 0.814688206f},
-std::array<float,2>{0.233791724f, 0.0330068283f},
-std::array<float,2>{0.889902294f, 0.372629881f},
-std::array<float,2>{0.0191073027f, 0.661118329f},
-std::array<float,2>{0.530588865f, 0.778387487f},
-std::array<float,2>{0.318693787f, 0.120836839f},
-std::array<float,2>{0.644869089f, 0.139871255f},
-std::array<float,2>{0.475341797f, 0.918059945f},
-std::array<float,2>{0.82373327f, 0.598366082f},
-std::array<float,2>{0.158935562f, 0.498092622f},
-std::array<float,2>{0.795804858f, 0.0225984659f},
-std::array<float,2>{0.213663653f, 0.872975111f},
-std::array<float,2>{0.704569221f, 0.692767322f},
-std::array<float,2>{0.402326494f, 0.288902044f},
-std::array<float,2>{0.624618411f, 0.407363594f},
-std::array<float,2>{0.273455709f, 0.508837402f},
-std::array<float,2>{0.952920794f, 0.970109522f},
-std::array<float,2>{0.0629589185f, 0.194661841f},
-std::array<float,2>{0.930512369f, 0.378496855f},
-std::array<float,2>{0.0329298861f, 0.559589446f},
-std::array<float,2>{0.560127676f, 0.944206178f},
-std::array<float,2>{0.359178066f, 0.240939692f},
-std::array<float,2>{0.664002955f, 0.0438938141f},
-std::array<float,2>{0.449834764f, 0.824103117f},
-std::array<float,2>{0.845071733f, 0.737242043f},
-std::array<float,2>{0.143594891f, 0.272725761f},
-std::array<float,2>{0.764941394f, 0.157045186f},
-std::array<float,2>{0.238920122f, 0.899808943f},
-std::array<float,2>{0.745349288f, 0.565879941f},
-std::array<float,2>{0.421033502f, 0.457536906f},
-std::array<float,2>{0.565042675f, 0.336455405f},
-std::array<float,2>{0.309529662f, 0.655013144f},
-std::array<float,2>{0.998344481f, 0.80519551f},
-std::array<float,2>{0.121633865f, 0.0935708955f},
-std::array<float,2>{0.833867431f, 0.290477157f},
-std::array<float,2>{0.185245648f, 0.696285367f},
-std::array<float,2>{0.635287821f, 0.866375327f},
-std::array<float,2>{0.496794432f, 0.0275242366f},
-std::array<float,2>{0.508413076f, 0.199951082f},
-std::array<float,2>{0.341643751f, 0.981662154f},
-std::array<float,2>{0.905215383f, 0.505888879f},
-std::array<float,2>{0.0148299839f, 0.421127349f},
-std::array<float,2>{0.955129206f, 0.115157641f},
-std::array<float,2>{0.0824471861f, 0.770590007f},
-std::array<float,2>{0.601925611f, 0.668383896f},
-std::array<float,2>{0.263561338f, 0.365635306f},
-std::array<float,2>{0.699432909f, 0.485711843f},
-std::array<float,2>{0.383582324f, 0.609056592f},
-std::array<float,2>{0.797905385f, 0.907627642f},
-std::array<float,2>{0.202409461f, 0.129854962f},
-std::array<float,2>{0.790606678f, 0.444873273f},
-std::array<float,2>{0.216087639f, 0.581027031f},
-std::array<float,2>{0.708757341f, 0.887149692f},
-std::array<float,2>{0.405768424f, 0.175047189f},
-std::array<float,2>{0.620044887f, 0.0681490824f},
-std::array<float,2>{0.279147506f, 0.783378124f},
-std::array<float,2>{0.948223948f, 0.628426969f},
-std::array<float,2>{0.0675532371f, 0.323689044f},
-std::array<float,2>{0.884533346f, 0.231734782f},
-std::array<float,2>{0.0213521533f, 0.968421161f},
-std::array<float,2>{0.525666714f, 0.536606073f},
-std::array<float,2>{0.314059317f, 0.403223455f},
-std::array<float,2>{0.640670896f, 0.261312872f},
-std::array<float,2>{0.472159088f, 0.72189635f},
-std::array<float,2>{0.826428592f, 0.835490525f},
-std::array<float,2>{0.163785934f, 0.0619262457f},
-std::array<float,2>{0.970470965f, 0.34932816f},
-std::array<float,2>{0.104995057f, 0.68399483f},
-std::array<float,2>{0.584013939f, 0.751848936f},
-std::array<float,2>{0.287247419f, 0.107927449f},
-std::array<float,2>{0.728076518f, 0.146609783f},
-std::array<float,2>{0.431603104f, 0.936593175f},
-std::array<float,2>{0.765627861f, 0.624017119f},
-std::array<float,2>{0.228536189f, 0.482748002f},
-std::array<float,2>{0.867884576f, 0.0124904513f},
-std::array<float,2>{0.129328892f, 0.850765944f},
-std::array<float,2>{0.683245957f, 0.70709902f},
-std::array<float,2>{0.461916566f, 0.300248772f},
-std::array<float,2>{0.533361971f, 0.428000867f},
-std::array<float,2>{0.364437819f, 0.519817412f},
-std::array<float,2>{0.907648981f, 0.987817287f},
-std::array<float,2>{0.0580538362f, 0.214271069f},
-std::array<float,2>{0.943157315f, 0.473456413f},
-std::array<float,2>{0.0721950457f, 0.614720702f},
-std::array<float,2>{0.61268419f, 0.922350585f},
-std::array<float,2>{0.266916156f, 0.153583542f},
-std::array<float,2>{0.713759184f, 0.0943530351f},
-std::array<float,2>{0.397028983f, 0.762187481f},
-std::array<float,2>{0.785527349f, 0.676528335f},
-std::array<float,2>{0.203791052f, 0.356092721f},
-std::array<float,2>{0.819142461f, 0.204558104f},
-std::array<float,2>{0.170906201f, 0.997170269f},
-std::array<float,2>{0.653463185f, 0.525435567f},
-std::array<float,2>{0.482104719f, 0.436965823f},
-std::array<float,2>{0.519779265f, 0.306215525f},
-std::array<float,2>{0.323003709f, 0.717746675f},
-std::array<float,2>{0.879811287f, 0.856620073f},
-std::array<float,2>{0.0261671692f, 0.00392994098f},
-std::array<float,2>{0.778040826f, 0.314619124f},
-std::array<float,2>{0.223515153f, 0.637357831f},
-std::array<float,2>{0.723246932f, 0.795294404f},
-std::array<float,2>{0.425833493f, 0.0718499571f},
-std::array<float,2>{0.587203681f, 0.186771318f},
-std::array<float,2>{0.294910729f, 0.879061639f},
-std::array<float,2>{0.982344627f, 0.588641584f},
-std::array<float,2>{0.0989949927f, 0.447405428f},
-std::array<float,2>{0.919316351f, 0.053430099f},
-std::array<float,2>{0.0474821255f, 0.841230869f},
-std::array<float,2>{0.544915199f, 0.732265055f},
-std::array<float,2>{0.373428822f, 0.256868333f},
-std::array<float,2>{0.67392534f, 0.398196816f},
-std::array<float,2>{0.458585978f, 0.544154584f},
-std::array<float,2>{0.862839639f, 0.959317446f},
-std::array<float,2>{0.134134158f, 0.223490641f},
-std::array<float,2>{0.858336568f, 0.41260162f},
-std::array<float,2>{0.149986252f, 0.513536811f},
-std::array<float,2>{0.671234369f, 0.973217607f},
-std::array<float,2>{0.437728584f, 0.190108761f},
-std::array<float,2>{0.552390754f, 0.0191066582f},
-std::array<float,2>{0.350579232f, 0.869792938f},
-std::array<float,2>{0.926342547f, 0.689950645f},
-std::array<float,2>{0.0406485423f, 0.284186721f},
-std::array<float,2>{0.986234903f, 0.132820725f},
-std::array<float,2>{0.111269154f, 0.914642394f},
-std::array<float,2>{0.571735144f, 0.596087813f},
-std::array<float,2>{0.300715744f, 0.494532764f},
-std::array<float,2>{0.736046731f, 0.367306978f},
-std::array<float,2>{0.412254423f, 0.657674193f},
-std::array<float,2>{0.754264534f, 0.774543583f},
-std::array<float,2>{0.249404654f, 0.121829025f},
-std::array<float,2>{0.891471207f, 0.28057f},
-std::array<float,2>{0.00662351586f, 0.749051392f},
-std::array<float,2>{0.503635705f, 0.819506168f},
-std::array<float,2>{0.335333407f, 0.0381963626f},
-std::array<float,2>{0.630652964f, 0.248503119f},
-std::array<float,2>{0.487803936f, 0.950705469f},
-std::array<float,2>{0.842268169f, 0.55159831f},
-std::array<float,2>{0.177269056f, 0.382970095f},
-std::array<float,2>{0.81075722f, 0.0847773403f},
-std::array<float,2>{0.192529902f, 0.79728651f},
-std::array<float,2>{0.69345212f, 0.646097541f},
-std::array<float,2>{0.382257402f, 0.330579311f},
-std::array<float,2>{0.593851268f, 0.464406073f},
-std::array<float,2>{0.255167156f, 0.573928535f},
-std::array<float,2>{0.96507746f, 0.890700698f},
-std::array<float,2>{0.0912697911f, 0.169182628f},
-std::array<float,2>{0.876344502f, 0.45586434f},
-std::array<float,2>{0.0307645481f, 0.567003429f},
-std::array<float,2>{0.51858145f, 0.902915478f},
-std::array<float,2>{0.325619012f, 0.160731301f},
-std::array<float,2>{0.65020889f, 0.0862165764f},
-std::array<float,2>{0.476718843f, 0.811970353f},
-std::array<float,2>{0.814351797f, 0.650410175f},
-std::array<float,2>{0.164537713f, 0.340993881f},
-std::array<float,2>{0.784437001f, 0.235847995f},
-std::array<float,2>{0.210585579f, 0.937840044f},
-std::array<float,2>{0.717948854f, 0.555306137f},
-std::array<float,2>{0.390839249f, 0.3811239f},
-std::array<float,2>{0.616203666f, 0.266986191f},
-std::array<float,2>{0.270760357f, 0.738832653f},
-std::array<float,2>{0.940792561f, 0.826233804f},
-std::array<float,2>{0.0778366327f, 0.0427715816f},
-std::array<float,2>{0.864394784f, 0.359377027f},
-std::array<float,2>{0.140034616f, 0.66616112f},
-std::array<float,2>{0.676766694f, 0.767979085f},
-std::array<float,2>{0.453166664f, 0.113251604f},
-std::array<float,2>{0.539718151f, 0.125064909f},
-std::array<float,2>{0.369367719f, 0.910340965f},
-std::array<float,2>{0.916291952f, 0.602845013f},
-std::array<float,2>{0.0545427054f, 0.489536315f},
-std::array<float,2>{0.980215132f, 0.0261014979f},
-std::array<float,2>{0.0968004912f, 0.860194504f},
-std::array<float,2>{0.592747152f, 0.701496542f},
-std::array<float,2>{0.290688604f, 0.294107229f},
-std::array<float,2>{0.72003746f, 0.415093273f},
-std::array<float,2>{0.423093736f, 0.502397001f},
-std::array<float,2>{0.774127543f, 0.980181098f},
-std::array<float,2>{0.222515702f, 0.197858617f},
-std::array<float,2>{0.752835214f, 0.4002617f},
-std::array<float,2>{0.242956266f, 0.535088956f},
-std::array<float,2>{0.73943454f, 0.962545872f},
-std::array<float,2>{0.408759296f, 0.230167478f},
-std::array<float,2>{0.575657129f, 0.0583631657f},
-std::array<float,2>{0.304436147f, 0.831390977f},
-std::array<float,2>{0.991736054f, 0.723240376f},
-std::array<float,2>{0.115527675f, 0.262125492f},
-std::array<float,2>{0.92242378f, 0.177150533f},
-std::array<float,2>{0.0450002998f, 0.883421004f},
-std::array<float,2>{0.54827714f, 0.582086504f},
-std::array<float,2>{0.34624505f, 0.440248609f},
-std::array<float,2>{0.667667508f, 0.325495094f},
-std::array<float,2>{0.444564581f, 0.632136703f},
-std::array<float,2>{0.853994012f, 0.786858439f},
-std::array<float,2>{0.154088646f, 0.0631655529f},
-std::array<float,2>{0.96383673f, 0.3033081f},
-std::array<float,2>{0.08829505f, 0.704450905f},
-std::array<float,2>{0.599297047f, 0.846046329f},
-std::array<float,2>{0.252372891f, 0.00792840309f},
-std::array<float,2>{0.688847542f, 0.217597097f},
-std::array<float,2>{0.376279831f, 0.989318252f},
-std::array<float,2>{0.805963397f, 0.51704818f},
-std::array<float,2>{0.191193983f, 0.424365073f},
-std::array<float,2>{0.837788224f, 0.102994464f},
-std::array<float,2>{0.173549607f, 0.757083297f},
-std::array<float,2>{0.627119482f, 0.682461083f},
-std::array<float,2>{0.491888046f, 0.347577184f},
-std::array<float,2>{0.507791579f, 0.477498353f},
-std::array<float,2>{0.329627484f, 0.620622158f},
-std::array<float,2>{0.894819498f, 0.932769656f},
-std::array<float,2>{0.000681991805f, 0.142078131f},
-std::array<float,2>{0.995646238f, 0.430061609f},
-std::array<float,2>{0.1188519f, 0.529582202f},
-std::array<float,2>{0.56843859f, 0.993727922f},
-std::array<float,2>{0.307342112f, 0.209746793f},
-std::array<float,2>{0.747745156f, 0.00356784556f},
-std::array<float,2>{0.416150331f, 0.854670346f},
-std::array<float,2>{0.759711862f, 0.711796165f},
-std::array<float,2>{0.235134035f, 0.311758429f},
-std::array<float,2>{0.848839343f, 0.150649086f},
-std::array<float,2>{0.14484635f, 0.92949748f},
-std::array<float,2>{0.65682584f, 0.612033665f},
-std::array<float,2>{0.448702067f, 0.470423073f},
-std::array<float,2>{0.555695832f, 0.353193343f},
-std::array<float,2>{0.354451209f, 0.673836946f},
-std::array<float,2>{0.936507106f, 0.761147261f},
-std::array<float,2>{0.038743522f, 0.0998340398f},
-std::array<float,2>{0.803397298f, 0.250542879f},
-std::array<float,2>{0.198944837f, 0.726707816f},
-std::array<float,2>{0.697847486f, 0.838407338f},
-std::array<float,2>{0.389270186f, 0.0487911366f},
-std::array<float,2>{0.607785106f, 0.219599515f},
-std::array<float,2>{0.258306175f, 0.953537643f},
-std::array<float,2>{0.957881868f, 0.539335907f},
-std::array<float,2>{0.0797249824f, 0.393764913f},
-std::array<float,2>{0.90188086f, 0.0753705874f},
-std::array<float,2>{0.01049159f, 0.789613545f},
-std::array<float,2>{0.512823343f, 0.63314718f},
-std::array<float,2>{0.337804556f, 0.317874074f},
-std::array<float,2>{0.638270259f, 0.451733559f},
-std::array<float,2>{0.494556159f, 0.589861393f},
-std::array<float,2>{0.829440475f, 0.877514958f},
-std::array<float,2>{0.181913227f, 0.181111857f},
-std::array<float,2>{0.821791291f, 0.49621892f},
-std::array<float,2>{0.158053175f, 0.599745274f},
-std::array<float,2>{0.648225963f, 0.920194089f},
-std::array<float,2>{0.474205554f, 0.136776432f},
-std::array<float,2>{0.52769208f, 0.118928134f},
-std::array<float,2>{0.317736715f, 0.780379534f},
-std::array<float,2>{0.887560725f, 0.663936853f},
-std::array<float,2>{0.0174068622f, 0.374158114f},
-std::array<float,2>{0.949766278f, 0.191625834f},
-std::array<float,2>{0.0663258284f, 0.970796585f},
-std::array<float,2>{0.621397376f, 0.510477304f},
-std::array<float,2>{0.276466399f, 0.408203393f},
-std::array<float,2>{0.705621123f, 0.286008656f},
-std::array<float,2>{0.398563087f, 0.694433689f},
-std::array<float,2>{0.794916928f, 0.874618471f},
-std::array<float,2>{0.211295754f, 0.0202636532f},
-std::array<float,2>{0.911030412f, 0.332331508f},
-std::array<float,2>{0.0586789139f, 0.641725242f},
-std::array<float,2>{0.537522376f, 0.802670121f},
-std::array<float,2>{0.359423548f, 0.0798647851f},
-std::array<float,2>{0.685032547f, 0.165081531f},
-std::array<float,2>{0.465925485f, 0.896133184f},
-std::array<float,2>{0.871826768f, 0.575669467f},
-std::array<float,2>{0.127068967f, 0.466838986f},
-std::array<float,2>{0.770172358f, 0.0346313827f},
-std::array<float,2>{0.230482966f, 0.813042045f},
-std::array<float,2>{0.731990576f, 0.743257105f},
-std::array<float,2>{0.435162455f, 0.273812652f},
-std::array<float,2>{0.579737782f, 0.386832893f},
-std::array<float,2>{0.285110116f, 0.550557196f},
-std::array<float,2>{0.973182142f, 0.946529031f},
-std::array<float,2>{0.108392946f, 0.244633138f},
-std::array<float,2>{0.893787682f, 0.383632869f},
-std::array<float,2>{0.00570953265f, 0.550858498f},
-std::array<float,2>{0.500629127f, 0.950357854f},
-std::array<float,2>{0.333275676f, 0.248828828f},
-std::array<float,2>{0.632594466f, 0.0385826863f},
-std::array<float,2>{0.485373884f, 0.819929123f},
-std::array<float,2>{0.84092629f, 0.749579191f},
-std::array<float,2>{0.178955436f, 0.280845433f},
-std::array<float,2>{0.809075952f, 0.169435054f},
-std::array<float,2>{0.193953618f, 0.891218901f},
-std::array<float,2>{0.691625714f, 0.573619246f},
-std::array<float,2>{0.380502254f, 0.464080095f},
-std::array<float,2>{0.59658891f, 0.33023417f},
-std::array<float,2>{0.257162452f, 0.645811141f},
-std::array<float,2>{0.968538344f, 0.797544658f},
-std::array<float,2>{0.0926162377f, 0.084083356f},
-std::array<float,2>{0.856350958f, 0.285035849f},
-std::array<float,2>{0.151529342f, 0.689690351f},
-std::array<float,2>{0.668772101f, 0.869496167f},
-std::array<float,2>{0.441088021f, 0.0187338125f},
-std::array<float,2>{0.553545594f, 0.189566508f},
-std::array<float,2>{0.347766906f, 0.972827077f},
-std::array<float,2>{0.929109454f, 0.512908578f},
-std::array<float,2>{0.0415334702f, 0.4124358f},
-std::array<float,2>{0.987743855f, 0.121151105f},
-std::array<float,2>{0.11222896f, 0.775246799f},
-std::array<float,2>{0.573592126f, 0.658094525f},
-std::array<float,2>{0.298045099f, 0.368096501f},
-std::array<float,2>{0.737035573f, 0.495076597f},
-std::array<float,2>{0.410951108f, 0.59640336f},
-std::array<float,2>{0.757427573f, 0.914077163f},
-std::array<float,2>{0.247160435f, 0.133569777f},
-std::array<float,2>{0.779335856f, 0.44822529f},
-std::array<float,2>{0.224859193f, 0.588116825f},
-std::array<float,2>{0.726551235f, 0.879402995f},
-std::array<float,2>{0.428198665f, 0.187204808f},
-std::array<float,2>{0.589469612f, 0.0716172978f},
-std::array<float,2>{0.296037912f, 0.795447826f},
-std::array<float,2>{0.982434392f, 0.636802375f},
-std::array<float,2>{0.0999432206f, 0.315063298f},
-std::array<float,2>{0.920449793f, 0.222977132f},
-std::array<float,2>{0.0494003855f, 0.95957768f},
-std::array<float,2>{0.545038879f, 0.5448668f},
-std::array<float,2>{0.372102529f, 0.397482604f},
-std::array<float,2>{0.673015356f, 0.257470727f},
-std::array<float,2>{0.460178614f, 0.731488764f},
-std::array<float,2>{0.860598385f, 0.841594994f},
-std::array<float,2>{0.134932876f, 0.0531456582f},
-std::array<float,2>{0.944563866f, 0.355518103f},
-std::array<float,2>{0.0726800263f, 0.676153362f},
-std::array<float,2>{0.611175597f, 0.762338519f},
-std::array<float,2>{0.26856178f, 0.0937551036f},
-std::array<float,2>{0.711048543f, 0.154088974f},
-std::array<float,2>{0.395133972f, 0.922531664f},
-std::array<float,2>{0.788574576f, 0.615203321f},
-std::array<float,2>{0.205652252f, 0.472708821f},
-std::array<float,2>{0.81784904f, 0.00484029204f},
-std::array<float,2>{0.168570116f, 0.857280374f},
-std::array<float,2>{0.654490352f, 0.716927767f},
-std::array<float,2>{0.483343363f, 0.30574894f},
-std::array<float,2>{0.522917867f, 0.437207282f},
-std::array<float,2>{0.321291655f, 0.526134372f},
-std::array<float,2>{0.8812868f, 0.997637987f},
-std::array<float,2>{0.0240605138f, 0.204699844f},
-std::array<float,2>{0.972452998f, 0.483068049f},
-std::array<float,2>{0.10262683f, 0.623339355f},
-std::array<float,2>{0.583322823f, 0.93727684f},
-std::array<float,2>{0.28589493f, 0.147440031f},
-std::array<float,2>{0.72876811f, 0.107771926f},
-std::array<float,2>{0.432060242f, 0.751444697f},
-std::array<float,2>{0.767825127f, 0.684358835f},
-std::array<float,2>{0.227500811f, 0.348659366f},
-std::array<float,2>{0.870177269f, 0.214462787f},
-std::array<float,2>{0.131684437f, 0.987787783f},
-std::array<float,2>{0.680037618f, 0.520402849f},
-std::array<float,2>{0.463294834f, 0.428225458f},
-std::array<float,2>{0.532622218f, 0.300735235f},
-std::array<float,2>{0.366666853f, 0.707805693f},
-std::array<float,2>{0.90852946f, 0.851135433f},
-std::array<float,2>{0.0548738092f, 0.0121150194f},
-std::array<float,2>{0.792378485f, 0.3238132f},
-std::array<float,2>{0.218630761f, 0.628110051f},
-std::array<float,2>{0.71081239f, 0.783750892f},
-std::array<float,2>{0.403471947f, 0.0677535385f},
-std::array<float,2>{0.617208779f, 0.175440684f},
-std::array<float,2>{0.280111194f, 0.887248755f},
-std::array<float,2>{0.946375489f, 0.580389082f},
-std::array<float,2>{0.068981424f, 0.444602102f},
-std::array<float,2>{0.886035144f, 0.0621328801f},
-std::array<float,2>{0.0230551325f, 0.83533603f},
-std::array<float,2>{0.525180995f, 0.722501099f},
-std::array<float,2>{0.315969437f, 0.260785937f},
-std::array<float,2>{0.644480765f, 0.402536452f},
-std::array<float,2>{0.469114572f, 0.536748052f},
-std::array<float,2>{0.825160563f, 0.967952669f},
-std::array<float,2>{0.16149503f, 0.232134417f},
-std::array<float,2>{0.834271908f, 0.421678275f},
-std::array<float,2>{0.185593694f, 0.506739616f},
-std::array<float,2>{0.633269608f, 0.982241213f},
-std::array<float,2>{0.498209924f, 0.199329957f},
-std::array<float,2>{0.510991514f, 0.0281425361f},
-std::array<float,2>{0.342402756f, 0.866986156f},
-std::array<float,2>{0.90359509f, 0.695437551f},
-std::array<float,2>{0.0132563217f, 0.290711462f},
-std::array<float,2>{0.954405069f, 0.129176289f},
-std::array<float,2>{0.0857412368f, 0.907844543f},
-std::array<float,2>{0.603622258f, 0.608451724f},
-std::array<float,2>{0.264403403f, 0.48590216f},
-std::array<float,2>{0.702342153f, 0.365835458f},
-std::array<float,2>{0.385561556f, 0.668527961f},
-std::array<float,2>{0.799639285f, 0.771249831f},
-std::array<float,2>{0.200377703f, 0.114394419f},
-std::array<float,2>{0.933344185f, 0.273102701f},
-std::array<float,2>{0.0332049876f, 0.736500442f},
-std::array<float,2>{0.560652912f, 0.823668778f},
-std::array<float,2>{0.355624825f, 0.0433822758f},
-std::array<float,2>{0.660497785f, 0.240602404f},
-std::array<float,2>{0.452867299f, 0.943694293f},
-std::array<float,2>{0.847126186f, 0.560321033f},
-std::array<float,2>{0.141023487f, 0.378227472f},
-std::array<float,2>{0.762983024f, 0.0931164324f},
-std::array<float,2>{0.240663216f, 0.804755211f},
-std::array<float,2>{0.742189169f, 0.654580772f},
-std::array<float,2>{0.419279337f, 0.336039007f},
-std::array<float,2>{0.563031852f, 0.457449108f},
-std::array<float,2>{0.310717076f, 0.566161215f},
-std::array<float,2>{0.996218443f, 0.900246859f},
-std::array<float,2>{0.123571895f, 0.156293437f},
-std::array<float,2>{0.91315484f, 0.467341632f},
-std::array<float,2>{0.060838785f, 0.575858831f},
-std::array<float,2>{0.537091851f, 0.895894408f},
-std::array<float,2>{0.36319226f, 0.166010007f},
-std::array<float,2>{0.686963618f, 0.0791625828f},
-std::array<float,2>{0.467719972f, 0.80206573f},
-std::array<float,2>{0.874465644f, 0.642252088f},
-std::array<float,2>{0.125006646f, 0.332930386f},
-std::array<float,2>{0.77196455f, 0.24429889f},
-std::array<float,2>{0.234186679f, 0.946869254f},
-std::array<float,2>{0.734175205f, 0.549811482f},
-std::array<float,2>{0.436492503f, 0.387254715f},
-std::array<float,2>{0.580866933f, 0.274076462f},
-std::array<float,2>{0.281749308f, 0.744049728f},
-std::array<float,2>{0.975210667f, 0.812853634f},
-std::array<float,2>{0.106985621f, 0.0350771546f},
-std::array<float,2>{0.823457539f, 0.374567419f},
-std::array<float,2>{0.158367336f, 0.663511932f},
-std::array<float,2>{0.645130455f, 0.781069756f},
-std::array<float,2>{0.475056678f, 0.118197769f},
-std::array<float,2>{0.531063557f, 0.137389868f},
-std::array<float,2>{0.319037974f, 0.92067188f},
-std::array<float,2>{0.890514374f, 0.600562871f},
-std::array<float,2>{0.0187756028f, 0.496816397f},
-std::array<float,2>{0.952451468f, 0.0195609126f},
-std::array<float,2>{0.0634206235f, 0.874222636f},
-std::array<float,2>{0.624365687f, 0.694897771f},
-std::array<float,2>{0.273997724f, 0.285162151f},
-std::array<float,2>{0.705077052f, 0.408940375f},
-std::array<float,2>{0.401550978f, 0.50987637f},
-std::array<float,2>{0.79520005f, 0.971287251f},
-std::array<float,2>{0.213143796f, 0.192248419f},
-std::array<float,2>{0.801568806f, 0.394193053f},
-std::array<float,2>{0.196497783f, 0.539868772f},
-std::array<float,2>{0.696104228f, 0.954034269f},
-std::array<float,2>{0.388316333f, 0.219230995f},
-std::array<float,2>{0.606969416f, 0.0481027253f},
-std::array<float,2>{0.261335224f, 0.838204384f},
-std::array<float,2>{0.960879505f, 0.727335751f},
-std::array<float,2>{0.0809918642f, 0.250301331f},
-std::array<float,2>{0.898889124f, 0.181193069f},
-std::array<float,2>{0.00963228289f, 0.877108991f},
-std::array<float,2>{0.51380825f, 0.590610981f},
-std::array<float,2>{0.338784158f, 0.451521486f},
-std::array<float,2>{0.639698565f, 0.317479104f},
-std::array<float,2>{0.494107932f, 0.633531511f},
-std::array<float,2>{0.831323802f, 0.789443433f},
-std::array<float,2>{0.18155992f, 0.0759444907f},
-std::array<float,2>{0.992314219f, 0.312436789f},
-std::array<float,2>{0.120541066f, 0.711114049f},
-std::array<float,2>{0.567903459f, 0.855062127f},
-std::array<float,2>{0.304737151f, 0.00299300789f},
-std::array<float,2>{0.748232067f, 0.209177241f},
-std::array<float,2>{0.415174901f, 0.993266225f},
-std::array<float,2>{0.761303782f, 0.529958129f},
-std::array<float,2>{0.237534791f, 0.430545747f},
-std::array<float,2>{0.850350201f, 0.100512102f},
-std::array<float,2>{0.147285372f, 0.761401892f},
-std::array<float,2>{0.658738077f, 0.674575269f},
-std::array<float,2>{0.446346819f, 0.352718383f},
-std::array<float,2>{0.557361901f, 0.469766378f},
-std::array<float,2>{0.353362978f, 0.61133033f},
-std::array<float,2>{0.933633566f, 0.929089248f},
-std::array<float,2>{0.0360093415f, 0.150981292f},
-std::array<float,2>{0.961461902f, 0.423967659f},
-std::array<float,2>{0.0860489532f, 0.517506838f},
-std::array<float,2>{0.60133636f, 0.989909351f},
-std::array<float,2>{0.250900567f, 0.216977239f},
-std::array<float,2>{0.690405905f, 0.00842111185f},
-std::array<float,2>{0.376953572f, 0.846606553f},
-std::array<float,2>{0.808463216f, 0.704596221f},
-std::array<float,2>{0.188466817f, 0.302996963f},
-std::array<float,2>{0.839499354f, 0.142502099f},
-std::array<float,2>{0.174730107f, 0.933427095f},
-std::array<float,2>{0.625294149f, 0.620377779f},
-std::array<float,2>{0.489638865f, 0.477047384f},
-std::array<float,2>{0.50563699f, 0.346742332f},
-std::array<float,2>{0.331996471f, 0.682089925f},
-std::array<float,2>{0.896844983f, 0.757722795f},
-std::array<float,2>{0.00365608907f, 0.103461586f},
-std::array<float,2>{0.751813412f, 0.262250006f},
-std::array<float,2>{0.24486798f, 0.722981095f},
-std::array<float,2>{0.741989851f, 0.831811666f},
-std::array<float,2>{0.406709254f, 0.0579442754f},
-std::array<float,2>{0.577121019f, 0.229793176f},
-std::array<float,2>{0.302107871f, 0.962383151f},
-std::array<float,2>{0.98877126f, 0.53454262f},
-std::array<float,2>{0.114560105f, 0.399545401f},
-std::array<float,2>{0.924120784f, 0.0626628548f},
-std::array<float,2>{0.0432149842f, 0.786223829f},
-std::array<float,2>{0.550688982f, 0.632716358f},
-std::array<float,2>{0.344299346f, 0.326061189f},
-std::array<float,2>{0.664617479f, 0.439462334f},
-std::array<float,2>{0.442348957f, 0.582593441f},
-std::array<float,2>{0.852408528f, 0.882913172f},
-std::array<float,2>{0.15617764f, 0.177490234f},
-std::array<float,2>{0.866760612f, 0.490024328f},
-std::array<float,2>{0.136751577f, 0.603406131f},
-std::array<float,2>{0.67918098f, 0.910838544f},
-std::array<float,2>{0.455472291f, 0.125933826f},
-std::array<float,2>{0.542272627f, 0.112345368f},
-std::array<float,2>{0.368086934f, 0.768422425f},
-std::array<float,2>{0.914537966f, 0.666871965f},
-std::array<float,2>{0.0514289625f, 0.360131294f},
-std::array<float,2>{0.976935387f, 0.197499096f},
-std::array<float,2>{0.0942492187f, 0.979536474f},
-std::array<float,2>{0.59139061f, 0.502842188f},
-std::array<float,2>{0.292464584f, 0.415596604f},
-std::array<float,2>{0.72209537f, 0.294667691f},
-std::array<float,2>{0.425704539f, 0.702133179f},
-std::array<float,2>{0.776860893f, 0.85956943f},
-std::array<float,2>{0.218923733f, 0.0257240925f},
-std::array<float,2>{0.878540337f, 0.341718495f},
-std::array<float,2>{0.0277052838f, 0.650998294f},
-std::array<float,2>{0.517257392f, 0.812087119f},
-std::array<float,2>{0.327158719f, 0.0867583603f},
-std::array<float,2>{0.65119797f, 0.160549045f},
-std::array<float,2>{0.479124486f, 0.902812779f},
-std::array<float,2>{0.816126764f, 0.566800892f},
-std::array<float,2>{0.166092128f, 0.455472529f},
-std::array<float,2>{0.782445669f, 0.0422135368f},
-std::array<float,2>{0.208455086f, 0.827105403f},
-std::array<float,2>{0.716065228f, 0.738618135f},
-std::array<float,2>{0.393644392f, 0.267183602f},
-std::array<float,2>{0.614567399f, 0.381733507f},
-std::array<float,2>{0.271729976f, 0.555108547f},
-std::array<float,2>{0.938931286f, 0.938274622f},
-std::array<float,2>{0.0756813213f, 0.235590503f},
-std::array<float,2>{0.925880671f, 0.411059558f},
-std::array<float,2>{0.0400601067f, 0.514771223f},
-std::array<float,2>{0.551975906f, 0.975595057f},
-std::array<float,2>{0.349927992f, 0.189066306f},
-std::array<float,2>{0.671830058f, 0.0160507374f},
-std::array<float,2>{0.438082635f, 0.868137598f},
-std::array<float,2>{0.857491732f, 0.687929034f},
-std::array<float,2>{0.149771497f, 0.282753587f},
-std::array<float,2>{0.75470227f, 0.135564581f},
-std::array<float,2>{0.249853164f, 0.916760504f},
-std::array<float,2>{0.73540628f, 0.594082952f},
-std::array<float,2>{0.413012445f, 0.49372077f},
-std::array<float,2>{0.57224071f, 0.370087057f},
-std::array<float,2>{0.30021894f, 0.659525335f},
-std::array<float,2>{0.985654831f, 0.776883006f},
-std::array<float,2>{0.110491499f, 0.123283952f},
-std::array<float,2>{0.842455566f, 0.277589649f},
-std::array<float,2>{0.177213013f, 0.747287393f},
-std::array<float,2>{0.630209923f, 0.817535818f},
-std::array<float,2>{0.487634778f, 0.036295902f},
-std::array<float,2>{0.503006458f, 0.246577039f},
-std::array<float,2>{0.335894823f, 0.952321231f},
-std::array<float,2>{0.890769005f, 0.554427981f},
-std::array<float,2>{0.0060270289f, 0.386269897f},
-std::array<float,2>{0.965408981f, 0.0826692656f},
-std::array<float,2>{0.0916229784f, 0.799871743f},
-std::array<float,2>{0.594685256f, 0.647371531f},
-std::array<float,2>{0.255472898f, 0.328737438f},
-std::array<float,2>{0.6940642f, 0.461899042f},
-std::array<float,2>{0.382769912f, 0.572019339f},
-std::array<float,2>{0.811229706f, 0.892611325f},
-std::array<float,2>{0.193105638f, 0.170369029f},
-std::array<float,2>{0.785897136f, 0.476547569f},
-std::array<float,2>{0.203567818f, 0.616100132f},
-std::array<float,2>{0.71291858f, 0.924110711f},
-std::array<float,2>{0.396894395f, 0.155823722f},
-std::array<float,2>{0.613232672f, 0.095762372f},
-std::array<float,2>{0.267120957f, 0.764956772f},
-std::array<float,2>{0.942437232f, 0.679409802f},
-std::array<float,2>{0.0713486448f, 0.357625216f},
-std::array<float,2>{0.879165411f, 0.206091285f},
-std::array<float,2>{0.0258585513f, 0.999513924f},
-std::array<float,2>{0.520127356f, 0.525122166f},
-std::array<float,2>{0.322543472f, 0.435415924f},
-std::array<float,2>{0.654197335f, 0.307366222f},
-std::array<float,2>{0.481817484f, 0.71599257f},
-std::array<float,2>{0.818516612f, 0.858142078f},
-std::array<float,2>{0.171820581f, 0.00671184203f},
-std::array<float,2>{0.981907904f, 0.313563049f},
-std::array<float,2>{0.0991579518f, 0.640562654f},
-std::array<float,2>{0.587539852f, 0.793178141f},
-std::array<float,2>{0.294190884f, 0.0723753497f},
-std::array<float,2>{0.722719014f, 0.183790237f},
-std::array<float,2>{0.426440954f, 0.882150769f},
-std::array<float,2>{0.777806282f, 0.587755919f},
-std::array<float,2>{0.222750515f, 0.446691066f},
-std::array<float,2>{0.862713754f, 0.051840473f},
-std::array<float,2>{0.134443671f, 0.843156159f},
-std::array<float,2>{0.67443645f, 0.73242408f},
-std::array<float,2>{0.458126605f, 0.255622834f},
-std::array<float,2>{0.544389904f, 0.395008028f},
-std::array<float,2>{0.373636246f, 0.546544552f},
-std::array<float,2>{0.919582546f, 0.958851695f},
-std::array<float,2>{0.0468993261f, 0.225832805f},
-std::array<float,2>{0.947463453f, 0.443330258f},
-std::array<float,2>{0.067961812f, 0.578619123f},
-std::array<float,2>{0.619517803f, 0.88904345f},
-std::array<float,2>{0.278466642f, 0.172318473f},
-std::array<float,2>{0.708120942f, 0.0700392276f},
-std::array<float,2>{0.405729324f, 0.782545567f},
-std::array<float,2>{0.790483832f, 0.625031829f},
-std::array<float,2>{0.216381505f, 0.321311742f},
-std::array<float,2>{0.826768219f, 0.232628196f},
-std::array<float,2>{0.163443893f, 0.966718078f},
-std::array<float,2>{0.641500354f, 0.537771046f},
-std::array<float,2>{0.472438991f, 0.404833704f},
-std::array<float,2>{0.526017249f, 0.259322345f},
-std::array<float,2>{0.313922971f, 0.720055342f},
-std::array<float,2>{0.884116113f, 0.833561003f},
-std::array<float,2>{0.0206801631f, 0.0591585599f},
-std::array<float,2>{0.7663607f, 0.35152927f},
-std::array<float,2>{0.229146764f, 0.686230838f},
-std::array<float,2>{0.727800369f, 0.752821147f},
-std::array<float,2>{0.430924207f, 0.105585672f},
-std::array<float,2>{0.584697008f, 0.145529285f},
-std::array<float,2>{0.287698209f, 0.935424328f},
-std::array<float,2>{0.969777942f, 0.622804523f},
-std::array<float,2>{0.104719654f, 0.480909646f},
-std::array<float,2>{0.907965302f, 0.0143901156f},
-std::array<float,2>{0.0583996288f, 0.847940087f},
-std::array<float,2>{0.534053922f, 0.710743964f},
-std::array<float,2>{0.364855289f, 0.298169434f},
-std::array<float,2>{0.682983577f, 0.426916748f},
-std::array<float,2>{0.462415636f, 0.521503091f},
-std::array<float,2>{0.867273748f, 0.986164689f},
-std::array<float,2>{0.129748732f, 0.212447137f},
-std::array<float,2>{0.845229924f, 0.37558201f},
-std::array<float,2>{0.144433334f, 0.562056482f},
-std::array<float,2>{0.66350913f, 0.941939712f},
-std::array<float,2>{0.449372262f, 0.239267498f},
-std::array<float,2>{0.559945643f, 0.0464974791f},
-std::array<float,2>{0.358834773f, 0.821969211f},
-std::array<float,2>{0.929720938f, 0.735512555f},
-std::array<float,2>{0.0325913876f, 0.270319223f},
-std::array<float,2>{0.998982549f, 0.158956498f},
-std::array<float,2>{0.121520899f, 0.900447249f},
-std::array<float,2>{0.564570665f, 0.563549519f},
-std::array<float,2>{0.308749408f, 0.459708601f},
-std::array<float,2>{0.746085882f, 0.337973386f},
-std::array<float,2>{0.421454877f, 0.652754664f},
-std::array<float,2>{0.765137076f, 0.807199001f},
-std::array<float,2>{0.238391176f, 0.0904770941f},
-std::array<float,2>{0.904495358f, 0.291448593f},
-std::array<float,2>{0.0153679885f, 0.697549582f},
-std::array<float,2>{0.507928967f, 0.863683522f},
-std::array<float,2>{0.34094277f, 0.0296165608f},
-std::array<float,2>{0.634889781f, 0.201441631f},
-std::array<float,2>{0.496246934f, 0.983330309f},
-std::array<float,2>{0.833138645f, 0.505006135f},
-std::array<float,2>{0.184748158f, 0.418792009f},
-std::array<float,2>{0.798595726f, 0.11579024f},
-std::array<float,2>{0.202873155f, 0.772600234f},
-std::array<float,2>{0.700060844f, 0.670634389f},
-std::array<float,2>{0.383170068f, 0.364364028f},
-std::array<float,2>{0.602297127f, 0.488096356f},
-std::array<float,2>{0.26290828f, 0.606298685f},
-std::array<float,2>{0.955856323f, 0.909232199f},
-std::array<float,2>{0.0829812512f, 0.131337062f},
-std::array<float,2>{0.886897027f, 0.498880982f},
-std::array<float,2>{0.0169266202f, 0.597845733f},
-std::array<float,2>{0.527919173f, 0.918521941f},
-std::array<float,2>{0.318193436f, 0.140292555f},
-std::array<float,2>{0.647752702f, 0.120452456f},
-std::array<float,2>{0.474048465f, 0.778918862f},
-std::array<float,2>{0.82138586f, 0.660591006f},
-std::array<float,2>{0.157582626f, 0.372312516f},
-std::array<float,2>{0.79434824f, 0.194919243f},
-std::array<float,2>{0.2114283f, 0.970613182f},
-std::array<float,2>{0.705433905f, 0.509358644f},
-std::array<float,2>{0.399121821f, 0.407785863f},
-std::array<float,2>{0.621896088f, 0.288339019f},
-std::array<float,2>{0.276881814f, 0.693183303f},
-std::array<float,2>{0.949488282f, 0.87242043f},
-std::array<float,2>{0.0655502006f, 0.0233676657f},
-std::array<float,2>{0.87132591f, 0.334469408f},
-std::array<float,2>{0.127693191f, 0.644404173f},
-std::array<float,2>{0.685508311f, 0.80454427f},
-std::array<float,2>{0.46638003f, 0.081388399f},
-std::array<float,2>{0.537813246f, 0.167949855f},
-std::array<float,2>{0.360055447f, 0.898174703f},
-std::array<float,2>{0.910269976f, 0.577320874f},
-std::array<float,2>{0.0593751408f, 0.46641475f},
-std::array<float,2>{0.973047376f, 0.0326695219f},
-std::array<float,2>{0.107431822f, 0.815262973f},
-std::array<float,2>{0.579580665f, 0.744429171f},
-std::array<float,2>{0.284216881f, 0.275430351f},
-std::array<float,2>{0.731856763f, 0.389595896f},
-std::array<float,2>{0.434731215f, 0.547763407f},
-std::array<float,2>{0.769684255f, 0.948407769f},
-std::array<float,2>{0.231150866f, 0.242475286f},
-std::array<float,2>{0.759231746f, 0.431765497f},
-std::array<float,2>{0.234656796f, 0.529255211f},
-std::array<float,2>{0.747070968f, 0.99502641f},
-std::array<float,2>{0.416545898f, 0.208807155f},
-std::array<float,2>{0.569235563f, 0.00146430987f},
-std::array<float,2>{0.307019591f, 0.852163613f},
-std::array<float,2>{0.995594859f, 0.71437043f},
-std::array<float,2>{0.118460357f, 0.308849812f},
-std::array<float,2>{0.935934126f, 0.149563536f},
-std::array<float,2>{0.0384949557f, 0.926899791f},
-std::array<float,2>{0.556433797f, 0.610170007f},
-std::array<float,2>{0.353591174f, 0.471728086f},
-std::array<float,2>{0.656737983f, 0.355315268f},
-std::array<float,2>{0.448734403f, 0.672264159f},
-std::array<float,2>{0.849452078f, 0.758220553f},
-std::array<float,2>{0.145414174f, 0.0992224365f},
-std::array<float,2>{0.957360566f, 0.252433211f},
-std::array<float,2>{0.0792305619f, 0.728606045f},
-std::array<float,2>{0.607936025f, 0.836745322f},
-std::array<float,2>{0.258098006f, 0.050365977f},
-std::array<float,2>{0.697376788f, 0.221182123f},
-std::array<float,2>{0.388756782f, 0.956418395f},
-std::array<float,2>{0.802811384f, 0.541432977f},
-std::array<float,2>{0.198437288f, 0.391701072f},
-std::array<float,2>{0.829613686f, 0.0766525418f},
-std::array<float,2>{0.182420269f, 0.792877138f},
-std::array<float,2>{0.638062179f, 0.635096729f},
-std::array<float,2>{0.494787782f, 0.318367213f},
-std::array<float,2>{0.513651073f, 0.450522095f},
-std::array<float,2>{0.337270707f, 0.592550099f},
-std::array<float,2>{0.901408374f, 0.87568897f},
-std::array<float,2>{0.0101326369f, 0.182254344f},
-std::array<float,2>{0.991432548f, 0.400567681f},
-std::array<float,2>{0.116060972f, 0.531740367f},
-std::array<float,2>{0.575742602f, 0.964660168f},
-std::array<float,2>{0.304083288f, 0.228280425f},
-std::array<float,2>{0.740232468f, 0.0547549017f},
-std::array<float,2>{0.408566982f, 0.828411877f},
-std::array<float,2>{0.75202322f, 0.724923432f},
-std::array<float,2>{0.242597431f, 0.263812423f},
-std::array<float,2>{0.854301512f, 0.179341301f},
-std::array<float,2>{0.153536484f, 0.884770036f},
-std::array<float,2>{0.667083323f, 0.58523649f},
-std::array<float,2>{0.445027411f, 0.438356549f},
-std::array<float,2>{0.54867202f, 0.32790032f},
-std::array<float,2>{0.34585464f, 0.628923476f},
-std::array<float,2>{0.922176838f, 0.78718257f},
-std::array<float,2>{0.0454378873f, 0.0663030818f},
-std::array<float,2>{0.806441605f, 0.301257402f},
-std::array<float,2>{0.190555677f, 0.706790268f},
-std::array<float,2>{0.689000726f, 0.845324695f},
-std::array<float,2>{0.376896113f, 0.0105161099f},
-std::array<float,2>{0.598666608f, 0.215588868f},
-std::array<float,2>{0.252774566f, 0.99033767f},
-std::array<float,2>{0.963184059f, 0.517935157f},
-std::array<float,2>{0.088704668f, 0.42199856f},
-std::array<float,2>{0.895339012f, 0.104510345f},
-std::array<float,2>{0.000123501828f, 0.75534153f},
-std::array<float,2>{0.507095873f, 0.680556834f},
-std::array<float,2>{0.329461515f, 0.345385402f},
-std::array<float,2>{0.62792629f, 0.479843944f},
-std::array<float,2>{0.491476804f, 0.618081093f},
-std::array<float,2>{0.837278903f, 0.930005729f},
-std::array<float,2>{0.173197344f, 0.143429309f},
-std::array<float,2>{0.813575864f, 0.454014838f},
-std::array<float,2>{0.164852157f, 0.568678498f},
-std::array<float,2>{0.649864674f, 0.905955553f},
-std::array<float,2>{0.477341413f, 0.163652763f},
-std::array<float,2>{0.519480109f, 0.0879296437f},
-std::array<float,2>{0.326147854f, 0.810413957f},
-std::array<float,2>{0.876715183f, 0.648579717f},
-std::array<float,2>{0.0303012468f, 0.343397498f},
-std::array<float,2>{0.941124082f, 0.237901226f},
-std::array<float,2>{0.0775910318f, 0.940108597f},
-std::array<float,2>{0.615454197f, 0.558200359f},
-std::array<float,2>{0.271110147f, 0.379716456f},
-std::array<float,2>{0.718459845f, 0.269011497f},
-std::array<float,2>{0.391584814f, 0.740833819f},
-std::array<float,2>{0.784672141f, 0.82426703f},
-std::array<float,2>{0.210142553f, 0.0409914292f},
-std::array<float,2>{0.916703522f, 0.363115549f},
-std::array<float,2>{0.0537216254f, 0.664561391f},
-std::array<float,2>{0.539196908f, 0.767089188f},
-std::array<float,2>{0.369904727f, 0.110498182f},
-std::array<float,2>{0.677701652f, 0.128769159f},
-std::array<float,2>{0.453994572f, 0.912149489f},
-std::array<float,2>{0.864857018f, 0.604636729f},
-std::array<float,2>{0.140409246f, 0.491293043f},
-std::array<float,2>{0.773716748f, 0.0246398356f},
-std::array<float,2>{0.221929893f, 0.862880886f},
-std::array<float,2>{0.720382512f, 0.699277163f},
-std::array<float,2>{0.423642576f, 0.295204818f},
-std::array<float,2>{0.592182457f, 0.417187184f},
-std::array<float,2>{0.290262133f, 0.500434697f},
-std::array<float,2>{0.979962111f, 0.978437066f},
-std::array<float,2>{0.0974616632f, 0.195673838f},
-std::array<float,2>{0.882059038f, 0.434194982f},
-std::array<float,2>{0.0250706915f, 0.523993909f},
-std::array<float,2>{0.522389412f, 0.998098254f},
-std::array<float,2>{0.320344329f, 0.205731884f},
-std::array<float,2>{0.655661285f, 0.00749802077f},
-std::array<float,2>{0.484363288f, 0.859226704f},
-std::array<float,2>{0.816631854f, 0.715223312f},
-std::array<float,2>{0.169467211f, 0.308198065f},
-std::array<float,2>{0.787812054f, 0.154708087f},
-std::array<float,2>{0.206678212f, 0.924910128f},
-std::array<float,2>{0.712135673f, 0.616448104f},
-std::array<float,2>{0.39557901f, 0.47479555f},
-std::array<float,2>{0.609781742f, 0.359291583f},
-std::array<float,2>{0.26782468f, 0.678450584f},
-std::array<float,2>{0.943739474f, 0.76443553f},
-std::array<float,2>{0.0736664906f, 0.0972524062f},
-std::array<float,2>{0.8601771f, 0.25463599f},
-std::array<float,2>{0.135787502f, 0.733942151f},
-std::array<float,2>{0.672623813f, 0.842078865f},
-std::array<float,2>{0.459139347f, 0.0513962843f},
-std::array<float,2>{0.546613991f, 0.224688381f},
-std::array<float,2>{0.371418506f, 0.957893848f},
-std::array<float,2>{0.921293378f, 0.545767367f},
-std::array<float,2>{0.0499981157f, 0.395874292f},
-std::array<float,2>{0.984297454f, 0.0739514604f},
-std::array<float,2>{0.100961134f, 0.794862628f},
-std::array<float,2>{0.588638604f, 0.639060199f},
-std::array<float,2>{0.295548886f, 0.31295985f},
-std::array<float,2>{0.725448668f, 0.446007401f},
-std::array<float,2>{0.42957598f, 0.585981846f},
-std::array<float,2>{0.780761659f, 0.881624639f},
-std::array<float,2>{0.226406619f, 0.184862301f},
-std::array<float,2>{0.755937517f, 0.492739856f},
-std::array<float,2>{0.246163726f, 0.595368743f},
-std::array<float,2>{0.737742066f, 0.917183459f},
-std::array<float,2>{0.411165088f, 0.136666209f},
-std::array<float,2>{0.572397113f, 0.124291472f},
-std::array<float,2>{0.296990752f, 0.775611162f},
-std::array<float,2>{0.986471713f, 0.658685744f},
-std::array<float,2>{0.113196857f, 0.37050271f},
-std::array<float,2>{0.92784071f, 0.18840231f},
-std::array<float,2>{0.0420247689f, 0.975115359f},
-std::array<float,2>{0.553860903f, 0.51434797f},
-std::array<float,2>{0.348735452f, 0.411571562f},
-std::array<float,2>{0.669585049f, 0.281942338f},
-std::array<float,2>{0.439908803f, 0.689287305f},
-std::array<float,2>{0.856661975f, 0.868775725f},
-std::array<float,2>{0.150893137f, 0.0174787398f},
-std::array<float,2>{0.967400789f, 0.32971403f},
-std::array<float,2>{0.0933284685f, 0.6476596f},
-std::array<float,2>{0.597417176f, 0.799646914f},
-std::array<float,2>{0.256234407f, 0.0832850635f},
-std::array<float,2>{0.693043709f, 0.171189442f},
-std::array<float,2>{0.379753262f, 0.893604279f},
-std::array<float,2>{0.809794426f, 0.571088672f},
-std::array<float,2>{0.194880158f, 0.462666363f},
-std::array<float,2>{0.840648055f, 0.0353397578f},
-std::array<float,2>{0.178073108f, 0.816708446f},
-std::array<float,2>{0.631502092f, 0.746174216f},
-std::array<float,2>{0.485184759f, 0.278813034f},
-std::array<float,2>{0.501721919f, 0.385496467f},
-std::array<float,2>{0.332856923f, 0.553101242f},
-std::array<float,2>{0.892857075f, 0.951821864f},
-std::array<float,2>{0.0047534164f, 0.247330025f},
-std::array<float,2>{0.997640014f, 0.460084409f},
-std::array<float,2>{0.12472637f, 0.562534094f},
-std::array<float,2>{0.56416434f, 0.90194577f},
-std::array<float,2>{0.311587632f, 0.159874335f},
-std::array<float,2>{0.743291199f, 0.0914449096f},
-std::array<float,2>{0.418177336f, 0.808395803f},
-std::array<float,2>{0.762337267f, 0.653425455f},
-std::array<float,2>{0.241734475f, 0.339512706f},
-std::array<float,2>{0.846488953f, 0.238697454f},
-std::array<float,2>{0.142431989f, 0.942710996f},
-std::array<float,2>{0.661197126f, 0.561516345f},
-std::array<float,2>{0.451675415f, 0.37665084f},
-std::array<float,2>{0.561997354f, 0.271307826f},
-std::array<float,2>{0.357369959f, 0.73459512f},
-std::array<float,2>{0.932564735f, 0.820472419f},
-std::array<float,2>{0.0346727706f, 0.045222614f},
-std::array<float,2>{0.80013907f, 0.363818198f},
-std::array<float,2>{0.199470058f, 0.671605885f},
-std::array<float,2>{0.701933444f, 0.772186339f},
-std::array<float,2>{0.386358649f, 0.116739437f},
-std::array<float,2>{0.604515016f, 0.132732391f},
-std::array<float,2>{0.264929891f, 0.909089684f},
-std::array<float,2>{0.953359604f, 0.607087135f},
-std::array<float,2>{0.0848937631f, 0.487216175f},
-std::array<float,2>{0.902357459f, 0.030594686f},
-std::array<float,2>{0.0125056608f, 0.864261985f},
-std::array<float,2>{0.509863496f, 0.698916316f},
-std::array<float,2>{0.342929721f, 0.292932868f},
-std::array<float,2>{0.633946419f, 0.419827312f},
-std::array<float,2>{0.499564528f, 0.504576802f},
-std::array<float,2>{0.835388601f, 0.984347522f},
-std::array<float,2>{0.186655283f, 0.202465445f},
-std::array<float,2>{0.825912118f, 0.405372947f},
-std::array<float,2>{0.160825774f, 0.539047837f},
-std::array<float,2>{0.64333117f, 0.965576887f},
-std::array<float,2>{0.470690638f, 0.233925074f},
-std::array<float,2>{0.524353981f, 0.059927322f},
-std::array<float,2>{0.314964652f, 0.832369328f},
-std::array<float,2>{0.884844363f, 0.71878767f},
-std::array<float,2>{0.0224465504f, 0.25864619f},
-std::array<float,2>{0.945393622f, 0.173816353f},
-std::array<float,2>{0.0694633722f, 0.89012289f},
-std::array<float,2>{0.618813753f, 0.579264998f},
-std::array<float,2>{0.280836463f, 0.441560119f},
-std::array<float,2>{0.709011495f, 0.320951164f},
-std::array<float,2>{0.402494341f, 0.626816154f},
-std::array<float,2>{0.791241825f, 0.781465232f},
-std::array<float,2>{0.217549264f, 0.0687332451f},
-std::array<float,2>{0.909352958f, 0.297127753f},
-std::array<float,2>{0.0563504212f, 0.709495723f},
-std::array<float,2>{0.531808317f, 0.849557042f},
-std::array<float,2>{0.365250975f, 0.0152644804f},
-std::array<float,2>{0.68108058f, 0.211044401f},
-std::array<float,2>{0.464757383f, 0.984595001f},
-std::array<float,2>{0.869784355f, 0.522574008f},
-std::array<float,2>{0.132571816f, 0.425934345f},
-std::array<float,2>{0.769487321f, 0.1073367f},
-std::array<float,2>{0.228295952f, 0.753691494f},
-std::array<float,2>{0.729533374f, 0.68710196f},
-std::array<float,2>{0.43284148f, 0.349872738f},
-std::array<float,2>{0.582271993f, 0.481505752f},
-std::array<float,2>{0.287059128f, 0.622033656f},
-std::array<float,2>{0.970827341f, 0.934209824f},
-std::array<float,2>{0.102104209f, 0.145268694f},
-std::array<float,2>{0.934723258f, 0.470967621f},
-std::array<float,2>{0.0365092158f, 0.610615313f},
-std::array<float,2>{0.558029592f, 0.926290751f},
-std::array<float,2>{0.352175027f, 0.148749664f},
-std::array<float,2>{0.659956574f, 0.0985655934f},
-std::array<float,2>{0.445859313f, 0.759525001f},
-std::array<float,2>{0.851406097f, 0.673486888f},
-std::array<float,2>{0.148240089f, 0.353649586f},
-std::array<float,2>{0.760660946f, 0.207698002f},
-std::array<float,2>{0.236481875f, 0.995256186f},
-std::array<float,2>{0.749847174f, 0.527369142f},
-std::array<float,2>{0.414824277f, 0.432723463f},
-std::array<float,2>{0.567196906f, 0.309893727f},
-std::array<float,2>{0.305781424f, 0.713826358f},
-std::array<float,2>{0.993772149f, 0.853507042f},
-std::array<float,2>{0.119505964f, 0.000179959272f},
-std::array<float,2>{0.830399871f, 0.320176125f},
-std::array<float,2>{0.180426896f, 0.635952652f},
-std::array<float,2>{0.638850152f, 0.791632414f},
-std::array<float,2>{0.492752492f, 0.0780201703f},
-std::array<float,2>{0.515295625f, 0.182937995f},
-std::array<float,2>{0.339677304f, 0.876651585f},
-std::array<float,2>{0.899551749f, 0.593456566f},
-std::array<float,2>{0.00862867944f, 0.449502975f},
-std::array<float,2>{0.95933646f, 0.0491460636f},
-std::array<float,2>{0.0815902576f, 0.836991191f},
-std::array<float,2>{0.605544329f, 0.730007589f},
-std::array<float,2>{0.260336131f, 0.253706008f},
-std::array<float,2>{0.696555316f, 0.390699357f},
-std::array<float,2>{0.387387097f, 0.542479753f},
-std::array<float,2>{0.801962197f, 0.955624282f},
-std::array<float,2>{0.195837006f, 0.221908659f},
-std::array<float,2>{0.795915961f, 0.406522095f},
-std::array<float,2>{0.213885367f, 0.508594155f},
-std::array<float,2>{0.703149438f, 0.969217062f},
-std::array<float,2>{0.400414348f, 0.193489388f},
-std::array<float,2>{0.623810112f, 0.0220574848f},
-std::array<float,2>{0.274805427f, 0.871967554f},
-std::array<float,2>{0.951477349f, 0.692296803f},
-std::array<float,2>{0.0640898719f, 0.287663609f},
-std::array<float,2>{0.889255524f, 0.139197201f},
-std::array<float,2>{0.0181923602f, 0.919021249f},
-std::array<float,2>{0.53016746f, 0.599514663f},
-std::array<float,2>{0.32019344f, 0.499779612f},
-std::array<float,2>{0.645573676f, 0.371501356f},
-std::array<float,2>{0.47611931f, 0.661801994f},
-std::array<float,2>{0.822756648f, 0.77800566f},
-std::array<float,2>{0.159644753f, 0.120052181f},
-std::array<float,2>{0.976502776f, 0.276961386f},
-std::array<float,2>{0.105667382f, 0.745926976f},
-std::array<float,2>{0.581699014f, 0.815785468f},
-std::array<float,2>{0.282413185f, 0.031937018f},
-std::array<float,2>{0.732800841f, 0.243448257f},
-std::array<float,2>{0.436879396f, 0.94812274f},
-std::array<float,2>{0.773421347f, 0.548177063f},
-std::array<float,2>{0.232461751f, 0.390310764f},
-std::array<float,2>{0.873558044f, 0.0804203302f},
-std::array<float,2>{0.1261338f, 0.803435266f},
-std::array<float,2>{0.685988247f, 0.643267095f},
-std::array<float,2>{0.467810363f, 0.335011244f},
-std::array<float,2>{0.535393f, 0.465262145f},
-std::array<float,2>{0.362213671f, 0.576274276f},
-std::array<float,2>{0.91264689f, 0.896572351f},
-std::array<float,2>{0.0618868731f, 0.166392341f},
-std::array<float,2>{0.93796885f, 0.380321711f},
-std::array<float,2>{0.0751043111f, 0.557397902f},
-std::array<float,2>{0.613790393f, 0.941169322f},
-std::array<float,2>{0.272964567f, 0.236712262f},
-std::array<float,2>{0.715261817f, 0.0392080732f},
-std::array<float,2>{0.392634302f, 0.825618565f},
-std::array<float,2>{0.781375885f, 0.741605043f},
-std::array<float,2>{0.207996249f, 0.268142492f},
-std::array<float,2>{0.81509918f, 0.162539303f},
-std::array<float,2>{0.167783216f, 0.904942393f},
-std::array<float,2>{0.651717424f, 0.569702089f},
-std::array<float,2>{0.479819596f, 0.454509199f},
-std::array<float,2>{0.515960276f, 0.34191817f},
-std::array<float,2>{0.326769441f, 0.649832904f},
-std::array<float,2>{0.877605021f, 0.809141755f},
-std::array<float,2>{0.0288389381f, 0.0898086354f},
-std::array<float,2>{0.776020646f, 0.296661913f},
-std::array<float,2>{0.220149428f, 0.700591087f},
-std::array<float,2>{0.720796645f, 0.861605525f},
-std::array<float,2>{0.42447722f, 0.0243263561f},
-std::array<float,2>{0.590423882f, 0.197058976f},
-std::array<float,2>{0.291163653f, 0.976972461f},
-std::array<float,2>{0.97840625f, 0.50146991f},
-std::array<float,2>{0.095668897f, 0.416846901f},
-std::array<float,2>{0.915482938f, 0.110114187f},
-std::array<float,2>{0.0522608794f, 0.765730679f},
-std::array<float,2>{0.541323543f, 0.665648162f},
-std::array<float,2>{0.369037896f, 0.361516625f},
-std::array<float,2>{0.678658128f, 0.490322411f},
-std::array<float,2>{0.456863552f, 0.603932977f},
-std::array<float,2>{0.865507662f, 0.913300097f},
-std::array<float,2>{0.13858968f, 0.127227381f},
-std::array<float,2>{0.853435516f, 0.439195961f},
-std::array<float,2>{0.154756218f, 0.584047735f},
-std::array<float,2>{0.665067494f, 0.886304975f},
-std::array<float,2>{0.442829847f, 0.17787914f},
-std::array<float,2>{0.548977733f, 0.065034993f},
-std::array<float,2>{0.345693439f, 0.788289547f},
-std::array<float,2>{0.924897254f, 0.630590618f},
-std::array<float,2>{0.0448597483f, 0.327138782f},
-std::array<float,2>{0.989792645f, 0.226956815f},
-std::array<float,2>{0.114013739f, 0.963784575f},
-std::array<float,2>{0.5777812f, 0.532969832f},
-std::array<float,2>{0.301327199f, 0.402257681f},
-std::array<float,2>{0.740991652f, 0.265611589f},
-std::array<float,2>{0.407540888f, 0.725814819f},
-std::array<float,2>{0.750591338f, 0.829741597f},
-std::array<float,2>{0.246027872f, 0.0559574552f},
-std::array<float,2>{0.897837102f, 0.344366729f},
-std::array<float,2>{0.00228492264f, 0.681043267f},
-std::array<float,2>{0.504824996f, 0.754527628f},
-std::array<float,2>{0.330930322f, 0.103658691f},
-std::array<float,2>{0.626393914f, 0.144194201f},
-std::array<float,2>{0.488788307f, 0.93113327f},
-std::array<float,2>{0.838405669f, 0.618799627f},
-std::array<float,2>{0.175755501f, 0.478580892f},
-std::array<float,2>{0.807617009f, 0.0108132791f},
-std::array<float,2>{0.189246282f, 0.843806684f},
-std::array<float,2>{0.690827966f, 0.705452323f},
-std::array<float,2>{0.378219724f, 0.302276909f},
-std::array<float,2>{0.599943757f, 0.423443139f},
-std::array<float,2>{0.251159966f, 0.519449234f},
-std::array<float,2>{0.962566316f, 0.992166877f},
-std::array<float,2>{0.0876977965f, 0.216073453f},
-std::array<float,2>{0.918689549f, 0.397402495f},
-std::array<float,2>{0.0485502854f, 0.543168068f},
-std::array<float,2>{0.543315887f, 0.960030437f},
-std::array<float,2>{0.374709636f, 0.224008128f},
-std::array<float,2>{0.674849689f, 0.053958606f},
-std::array<float,2>{0.457954496f, 0.840345979f},
-std::array<float,2>{0.862043142f, 0.73072964f},
-std::array<float,2>{0.133101389f, 0.256350577f},
-std::array<float,2>{0.7784338f, 0.186126634f},
-std::array<float,2>{0.224328905f, 0.880488217f},
-std::array<float,2>{0.724431217f, 0.589457393f},
-std::array<float,2>{0.427387744f, 0.448760122f},
-std::array<float,2>{0.586662471f, 0.315548062f},
-std::array<float,2>{0.293259621f, 0.638036907f},
-std::array<float,2>{0.980913758f, 0.796515644f},
-std::array<float,2>{0.0980282947f, 0.0707436427f},
-std::array<float,2>{0.819627225f, 0.305269152f},
-std::array<float,2>{0.170855433f, 0.718222141f},
-std::array<float,2>{0.652385235f, 0.856353045f},
-std::array<float,2>{0.480488062f, 0.00574139459f},
-std::array<float,2>{0.521187782f, 0.203768224f},
-std::array<float,2>{0.323909074f, 0.996657252f},
-std::array<float,2>{0.880132377f, 0.527144313f},
-std::array<float,2>{0.0266966242f, 0.436037779f},
-std::array<float,2>{0.941554129f, 0.0953607485f},
-std::array<float,2>{0.0707744136f, 0.763588846f},
-std::array<float,2>{0.612140357f, 0.677570581f},
-std::array<float,2>{0.266307771f, 0.357281387f},
-std::array<float,2>{0.714021683f, 0.473724186f},
-std::array<float,2>{0.39793238f, 0.613948226f},
-std::array<float,2>{0.786281586f, 0.9236902f},
-std::array<float,2>{0.204604536f, 0.152597815f},
-std::array<float,2>{0.811869085f, 0.463289291f},
-std::array<float,2>{0.19144845f, 0.572353244f},
-std::array<float,2>{0.69490391f, 0.892352581f},
-std::array<float,2>{0.381521612f, 0.168077469f},
-std::array<float,2>{0.594913065f, 0.085556604f},
-std::array<float,2>{0.254590631f, 0.798555732f},
-std::array<float,2>{0.966215074f, 0.645488977f},
-std::array<float,2>{0.0904807746f, 0.331826061f},
-std::array<float,2>{0.892015815f, 0.249433994f},
-std::array<float,2>{0.00768748624f, 0.950146794f},
-std::array<float,2>{0.501954377f, 0.552478135f},
-std::array<float,2>{0.334670156f, 0.384535968f},
-std::array<float,2>{0.628910601f, 0.279786676f},
-std::array<float,2>{0.48634398f, 0.74808383f},
-std::array<float,2>{0.842773676f, 0.818627357f},
-std::array<float,2>{0.176721901f, 0.0371562093f},
-std::array<float,2>{0.984632909f, 0.368649125f},
-std::array<float,2>{0.109642185f, 0.656636f},
-std::array<float,2>{0.571184874f, 0.773998797f},
-std::array<float,2>{0.299151391f, 0.122661367f},
-std::array<float,2>{0.734657228f, 0.13445434f},
-std::array<float,2>{0.413592905f, 0.915277123f},
-std::array<float,2>{0.755079031f, 0.597595453f},
-std::array<float,2>{0.248819426f, 0.496067703f},
-std::array<float,2>{0.858721793f, 0.0176569987f},
-std::array<float,2>{0.149345711f, 0.87095958f},
-std::array<float,2>{0.670064151f, 0.691371262f},
-std::array<float,2>{0.439329237f, 0.283608437f},
-std::array<float,2>{0.55114305f, 0.413316667f},
-std::array<float,2>{0.350732803f, 0.512440979f},
-std::array<float,2>{0.927363098f, 0.974083543f},
-std::array<float,2>{0.039834518f, 0.190795481f},
-std::array<float,2>{0.956645429f, 0.485084355f},
-std::array<float,2>{0.0833878294f, 0.60744077f},
-std::array<float,2>{0.603330612f, 0.906598508f},
-std::array<float,2>{0.262321025f, 0.130739868f},
-std::array<float,2>{0.700951159f, 0.113523684f},
-std::array<float,2>{0.384335399f, 0.769677222f},
-std::array<float,2>{0.79695648f, 0.669317663f},
-std::array<float,2>{0.201687977f, 0.367116421f},
-std::array<float,2>{0.832378447f, 0.201159f},
-std::array<float,2>{0.184533268f, 0.980777144f},
-std::array<float,2>{0.636398315f, 0.507728398f},
-std::array<float,2>{0.497909695f, 0.420553684f},
-std::array<float,2>{0.509011567f, 0.289194465f},
-std::array<float,2>{0.340666652f, 0.696324408f},
-std::array<float,2>{0.905855417f, 0.86616981f},
-std::array<float,2>{0.014625486f, 0.0284575988f},
-std::array<float,2>{0.76407814f, 0.337580413f},
-std::array<float,2>{0.240078345f, 0.656183302f},
-std::array<float,2>{0.744147003f, 0.805939615f},
-std::array<float,2>{0.420134157f, 0.0922590867f},
-std::array<float,2>{0.566297114f, 0.157882258f},
-std::array<float,2>{0.310263395f, 0.899205863f},
-std::array<float,2>{0.999904037f, 0.564630866f},
-std::array<float,2>{0.12302509f, 0.45816353f},
-std::array<float,2>{0.931440353f, 0.0446287245f},
-std::array<float,2>{0.0322195031f, 0.822650313f},
-std::array<float,2>{0.559344769f, 0.737638474f},
-std::array<float,2>{0.358273655f, 0.272260457f},
-std::array<float,2>{0.66221261f, 0.377375782f},
-std::array<float,2>{0.450538695f, 0.559350967f},
-std::array<float,2>{0.844593704f, 0.9445647f},
-std::array<float,2>{0.14294602f, 0.241546556f},
-std::array<float,2>{0.868629813f, 0.429489732f},
-std::array<float,2>{0.130684361f, 0.520601869f},
-std::array<float,2>{0.681895852f, 0.987062573f},
-std::array<float,2>{0.461231142f, 0.213867038f},
-std::array<float,2>{0.53459698f, 0.0133445663f},
-std::array<float,2>{0.364177078f, 0.849805057f},
-std::array<float,2>{0.907206833f, 0.708483338f},
-std::array<float,2>{0.0571111105f, 0.299798429f},
-std::array<float,2>{0.969717085f, 0.147683978f},
-std::array<float,2>{0.103797026f, 0.935860336f},
-std::array<float,2>{0.585272551f, 0.624532104f},
-std::array<float,2>{0.288239509f, 0.484285712f},
-std::array<float,2>{0.727064967f, 0.347975969f},
-std::array<float,2>{0.430304497f, 0.685423434f},
-std::array<float,2>{0.767188668f, 0.750928581f},
-std::array<float,2>{0.230400234f, 0.109125704f},
-std::array<float,2>{0.883261144f, 0.260462403f},
-std::array<float,2>{0.0197675377f, 0.721011519f},
-std::array<float,2>{0.526628494f, 0.833999693f},
-std::array<float,2>{0.313096404f, 0.0606299303f},
-std::array<float,2>{0.642127097f, 0.231410831f},
-std::array<float,2>{0.471136034f, 0.967044771f},
-std::array<float,2>{0.827813506f, 0.535715163f},
-std::array<float,2>{0.162795439f, 0.40401268f},
-std::array<float,2>{0.78957212f, 0.0671444237f},
-std::array<float,2>{0.215580791f, 0.784888864f},
-std::array<float,2>{0.707901895f, 0.627358973f},
-std::array<float,2>{0.404881686f, 0.322750062f},
-std::array<float,2>{0.62049377f, 0.44388321f},
-std::array<float,2>{0.277571291f, 0.581099391f},
-std::array<float,2>{0.948253274f, 0.888220668f},
-std::array<float,2>{0.0665317401f, 0.174323618f},
-std::array<float,2>{0.900731564f, 0.452750325f},
-std::array<float,2>{0.0111369137f, 0.591393888f},
-std::array<float,2>{0.512110829f, 0.878178656f},
-std::array<float,2>{0.336388499f, 0.180380449f},
-std::array<float,2>{0.637529016f, 0.0746517777f},
-std::array<float,2>{0.495254695f, 0.790115774f},
-std::array<float,2>{0.828594625f, 0.634340107f},
-std::array<float,2>{0.183083832f, 0.316992551f},
-std::array<float,2>{0.80407995f, 0.22059463f},
-std::array<float,2>{0.197875887f, 0.954698384f},
-std::array<float,2>{0.69842571f, 0.540943623f},
-std::array<float,2>{0.390271753f, 0.393341869f},
-std::array<float,2>{0.608565688f, 0.251539916f},
-std::array<float,2>{0.259344846f, 0.727960646f},
-std::array<float,2>{0.958227277f, 0.83935678f},
-std::array<float,2>{0.078412205f, 0.0472777076f},
-std::array<float,2>{0.848165989f, 0.351822674f},
-std::array<float,2>{0.146018207f, 0.675314248f},
-std::array<float,2>{0.658027351f, 0.759951293f},
-std::array<float,2>{0.447850198f, 0.101036847f},
-std::array<float,2>{0.55561769f, 0.151855126f},
-std::array<float,2>{0.354647815f, 0.928064525f},
-std::array<float,2>{0.936709762f, 0.612581015f},
-std::array<float,2>{0.0375569724f, 0.468816727f},
-std::array<float,2>{0.994367123f, 0.0028706186f},
-std::array<float,2>{0.117712237f, 0.854119241f},
-std::array<float,2>{0.569741428f, 0.711931229f},
-std::array<float,2>{0.307898432f, 0.310678095f},
-std::array<float,2>{0.746752203f, 0.430791318f},
-std::array<float,2>{0.417341143f, 0.531234264f},
-std::array<float,2>{0.758071184f, 0.993049681f},
-std::array<float,2>{0.235592484f, 0.21065928f},
-std::array<float,2>{0.770739913f, 0.387717098f},
-std::array<float,2>{0.232359454f, 0.549201369f},
-std::array<float,2>{0.730645537f, 0.946208f},
-std::array<float,2>{0.434228778f, 0.245528102f},
-std::array<float,2>{0.578315496f, 0.0332975984f},
-std::array<float,2>{0.284099609f, 0.813918054f},
-std::array<float,2>{0.974384964f, 0.74304831f},
-std::array<float,2>{0.108596958f, 0.274982423f},
-std::array<float,2>{0.911141038f, 0.164586097f},
-std::array<float,2>{0.0603244305f, 0.894841254f},
-std::array<float,2>{0.538279295f, 0.574466586f},
-std::array<float,2>{0.360774785f, 0.468324095f},
-std::array<float,2>{0.683758795f, 0.333076447f},
-std::array<float,2>{0.465392798f, 0.640789807f},
-std::array<float,2>{0.872406423f, 0.801169813f},
-std::array<float,2>{0.128598884f, 0.0783377439f},
-std::array<float,2>{0.950218081f, 0.286897331f},
-std::array<float,2>{0.0645577908f, 0.693865597f},
-std::array<float,2>{0.622742414f, 0.873405993f},
-std::array<float,2>{0.275737584f, 0.0211251136f},
-std::array<float,2>{0.706393301f, 0.193252712f},
-std::array<float,2>{0.399644315f, 0.971855044f},
-std::array<float,2>{0.793850303f, 0.51109761f},
-std::array<float,2>{0.212077349f, 0.4093481f},
-std::array<float,2>{0.820383489f, 0.11728178f},
-std::array<float,2>{0.156773359f, 0.779840529f},
-std::array<float,2>{0.64733237f, 0.662859499f},
-std::array<float,2>{0.473427325f, 0.373143941f},
-std::array<float,2>{0.529219031f, 0.497627288f},
-std::array<float,2>{0.316744238f, 0.601357281f},
-std::array<float,2>{0.887696385f, 0.921771765f},
-std::array<float,2>{0.0160418972f, 0.13815327f},
-std::array<float,2>{0.978543282f, 0.414092094f},
-std::array<float,2>{0.0960371494f, 0.503608108f},
-std::array<float,2>{0.592971802f, 0.978653371f},
-std::array<float,2>{0.289219767f, 0.198553696f},
-std::array<float,2>{0.719703257f, 0.0270119496f},
-std::array<float,2>{0.422256738f, 0.86056757f},
-std::array<float,2>{0.775333643f, 0.702229798f},
-std::array<float,2>{0.220833465f, 0.293439507f},
-std::array<float,2>{0.864110529f, 0.126263663f},
-std::array<float,2>{0.139624193f, 0.911264598f},
-std::array<float,2>{0.676144958f, 0.602096856f},
-std::array<float,2>{0.454954505f, 0.488777846f},
-std::array<float,2>{0.540490389f, 0.36054334f},
-std::array<float,2>{0.370187581f, 0.667723775f},
-std::array<float,2>{0.917756915f, 0.769148111f},
-std::array<float,2>{0.0528664887f, 0.111362539f},
-std::array<float,2>{0.784156144f, 0.266431838f},
-std::array<float,2>{0.209152043f, 0.739460409f},
-std::array<float,2>{0.717175305f, 0.827799976f},
-std::array<float,2>{0.392510355f, 0.0413586646f},
-std::array<float,2>{0.616881132f, 0.23480244f},
-std::array<float,2>{0.270287842f, 0.938539803f},
-std::array<float,2>{0.939961255f, 0.555967331f},
-std::array<float,2>{0.0766570717f, 0.382096589f},
-std::array<float,2>{0.875189602f, 0.0869389623f},
-std::array<float,2>{0.0299997348f, 0.811303556f},
-std::array<float,2>{0.518314481f, 0.651898026f},
-std::array<float,2>{0.324448287f, 0.340327263f},
-std::array<float,2>{0.648817539f, 0.456332415f},
-std::array<float,2>{0.477793843f, 0.568048835f},
-std::array<float,2>{0.813179493f, 0.903623581f},
-std::array<float,2>{0.165229723f, 0.161365375f},
-std::array<float,2>{0.836604536f, 0.478512466f},
-std::array<float,2>{0.172593981f, 0.619912028f},
-std::array<float,2>{0.628040969f, 0.931947708f},
-std::array<float,2>{0.490959257f, 0.140913129f},
-std::array<float,2>{0.506488502f, 0.10189227f},
-std::array<float,2>{0.328588724f, 0.756580889f},
-std::array<float,2>{0.895754099f, 0.683349907f},
-std::array<float,2>{0.00184231915f, 0.346306413f},
-std::array<float,2>{0.964788139f, 0.218456492f},
-std::array<float,2>{0.0890585557f, 0.98842591f},
-std::array<float,2>{0.598561168f, 0.516017377f},
-std::array<float,2>{0.253581256f, 0.424851f},
-std::array<float,2>{0.687819958f, 0.304393917f},
-std::array<float,2>{0.375560522f, 0.703182936f},
-std::array<float,2>{0.805137992f, 0.847226262f},
-std::array<float,2>{0.189496517f, 0.00939560309f},
-std::array<float,2>{0.923571527f, 0.324611723f},
-std::array<float,2>{0.0465909652f, 0.631219625f},
-std::array<float,2>{0.547274828f, 0.786003947f},
-std::array<float,2>{0.347089589f, 0.0636753589f},
-std::array<float,2>{0.666558802f, 0.176028475f},
-std::array<float,2>{0.444317877f, 0.884409964f},
-std::array<float,2>{0.854692757f, 0.583637536f},
-std::array<float,2>{0.152575746f, 0.44067356f},
-std::array<float,2>{0.753038108f, 0.0574776232f},
-std::array<float,2>{0.243177801f, 0.830598295f},
-std::array<float,2>{0.738431931f, 0.723876834f},
-std::array<float,2>{0.409215212f, 0.263007492f},
-std::array<float,2>{0.574254215f, 0.398531646f},
-std::array<float,2>{0.302741438f, 0.533981085f},
-std::array<float,2>{0.990922153f, 0.96103394f},
-std::array<float,2>{0.116770022f, 0.228822559f}}
\ No newline at end of file
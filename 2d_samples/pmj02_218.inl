@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.389661968f, 0.998516738f},
-std::array<float,2>{0.950091839f, 0.213976189f},
-std::array<float,2>{0.23809661f, 0.329512119f},
-std::array<float,2>{0.734167218f, 0.538365781f},
-std::array<float,2>{0.113949686f, 0.707129955f},
-std::array<float,2>{0.599344134f, 0.441924721f},
-std::array<float,2>{0.275821388f, 0.0816821232f},
-std::array<float,2>{0.830390155f, 0.830675304f},
-std::array<float,2>{0.125245869f, 0.756125212f},
-std::array<float,2>{0.684280515f, 0.0524885356f},
-std::array<float,2>{0.450330019f, 0.381024033f},
-std::array<float,2>{0.884187937f, 0.673483074f},
-std::array<float,2>{0.352924049f, 0.615999997f},
-std::array<float,2>{0.773525298f, 0.260477573f},
-std::array<float,2>{0.0520508923f, 0.141231403f},
-std::array<float,2>{0.552882433f, 0.88894707f},
-std::array<float,2>{0.306065947f, 0.870919645f},
-std::array<float,2>{0.845354855f, 0.113888241f},
-std::array<float,2>{0.0713403448f, 0.482058913f},
-std::array<float,2>{0.589190662f, 0.742148876f},
-std::array<float,2>{0.196079686f, 0.500351131f},
-std::array<float,2>{0.69230926f, 0.34512794f},
-std::array<float,2>{0.411872447f, 0.247898743f},
-std::array<float,2>{0.9834252f, 0.951358557f},
-std::array<float,2>{0.0254914518f, 0.936649799f},
-std::array<float,2>{0.525117099f, 0.174807623f},
-std::array<float,2>{0.339127034f, 0.292935342f},
-std::array<float,2>{0.809246957f, 0.587406099f},
-std::array<float,2>{0.476456314f, 0.646901131f},
-std::array<float,2>{0.910317063f, 0.424646497f},
-std::array<float,2>{0.170677722f, 0.025187077f},
-std::array<float,2>{0.640099645f, 0.803787529f},
-std::array<float,2>{0.456537306f, 0.795125723f},
-std::array<float,2>{0.896139324f, 0.00613706373f},
-std::array<float,2>{0.143752873f, 0.41275695f},
-std::array<float,2>{0.66866833f, 0.634508073f},
-std::array<float,2>{0.0451518893f, 0.570587456f},
-std::array<float,2>{0.537480831f, 0.300169259f},
-std::array<float,2>{0.374058515f, 0.165828884f},
-std::array<float,2>{0.76241976f, 0.908922255f},
-std::array<float,2>{0.231128186f, 0.9659217f},
-std::array<float,2>{0.74554652f, 0.220593289f},
-std::array<float,2>{0.405885011f, 0.362355083f},
-std::array<float,2>{0.95696485f, 0.529142678f},
-std::array<float,2>{0.258204103f, 0.731015146f},
-std::array<float,2>{0.815709591f, 0.485323429f},
-std::array<float,2>{0.105145581f, 0.0996485502f},
-std::array<float,2>{0.61242485f, 0.84858346f},
-std::array<float,2>{0.316287786f, 0.900809169f},
-std::array<float,2>{0.781262219f, 0.133380979f},
-std::array<float,2>{0.00288601057f, 0.268050879f},
-std::array<float,2>{0.510318816f, 0.600347877f},
-std::array<float,2>{0.17210032f, 0.663965166f},
-std::array<float,2>{0.65241617f, 0.399402738f},
-std::array<float,2>{0.497002989f, 0.0438164994f},
-std::array<float,2>{0.923840165f, 0.776057541f},
-std::array<float,2>{0.0834569037f, 0.825462818f},
-std::array<float,2>{0.563338518f, 0.0726997703f},
-std::array<float,2>{0.292046309f, 0.459824294f},
-std::array<float,2>{0.868043661f, 0.695302367f},
-std::array<float,2>{0.434102893f, 0.562332213f},
-std::array<float,2>{0.998153329f, 0.322079211f},
-std::array<float,2>{0.210832953f, 0.200002864f},
-std::array<float,2>{0.70958817f, 0.984037578f},
-std::array<float,2>{0.487714976f, 0.915053248f},
-std::array<float,2>{0.935850322f, 0.160987228f},
-std::array<float,2>{0.186893895f, 0.312259585f},
-std::array<float,2>{0.64509207f, 0.567092478f},
-std::array<float,2>{0.00855149981f, 0.627229214f},
-std::array<float,2>{0.506588817f, 0.416288763f},
-std::array<float,2>{0.324957579f, 0.00836964045f},
-std::array<float,2>{0.795382023f, 0.781952262f},
-std::array<float,2>{0.21582675f, 0.858378947f},
-std::array<float,2>{0.717262745f, 0.104026757f},
-std::array<float,2>{0.424617082f, 0.496290952f},
-std::array<float,2>{0.986069977f, 0.722623527f},
-std::array<float,2>{0.283129752f, 0.517095983f},
-std::array<float,2>{0.863047838f, 0.368611187f},
-std::array<float,2>{0.0926949903f, 0.230399445f},
-std::array<float,2>{0.57718575f, 0.96017766f},
-std::array<float,2>{0.359432459f, 0.765926659f},
-std::array<float,2>{0.757171154f, 0.0377484933f},
-std::array<float,2>{0.031858217f, 0.392246097f},
-std::array<float,2>{0.544311345f, 0.668248117f},
-std::array<float,2>{0.149718389f, 0.604846776f},
-std::array<float,2>{0.662871361f, 0.275383145f},
-std::array<float,2>{0.461257726f, 0.126781806f},
-std::array<float,2>{0.906074107f, 0.892793834f},
-std::array<float,2>{0.0993109718f, 0.975893319f},
-std::array<float,2>{0.617234886f, 0.191117883f},
-std::array<float,2>{0.254223019f, 0.31839475f},
-std::array<float,2>{0.82599169f, 0.551577687f},
-std::array<float,2>{0.395135105f, 0.696011722f},
-std::array<float,2>{0.967484832f, 0.466574281f},
-std::array<float,2>{0.219924107f, 0.064720124f},
-std::array<float,2>{0.735424519f, 0.818838f},
-std::array<float,2>{0.416809022f, 0.835986376f},
-std::array<float,2>{0.973324835f, 0.0893301293f},
-std::array<float,2>{0.190618828f, 0.450062484f},
-std::array<float,2>{0.70034039f, 0.718103886f},
-std::array<float,2>{0.0682410896f, 0.542102754f},
-std::array<float,2>{0.580576777f, 0.336549312f},
-std::array<float,2>{0.301911116f, 0.203518674f},
-std::array<float,2>{0.858251095f, 0.986863136f},
-std::array<float,2>{0.162012532f, 0.87582171f},
-std::array<float,2>{0.629297674f, 0.154812977f},
-std::array<float,2>{0.479981929f, 0.256873399f},
-std::array<float,2>{0.918461978f, 0.617922544f},
-std::array<float,2>{0.332403064f, 0.687009931f},
-std::array<float,2>{0.797976017f, 0.383399844f},
-std::array<float,2>{0.0196149256f, 0.0576041862f},
-std::array<float,2>{0.518203318f, 0.764007568f},
-std::array<float,2>{0.266314894f, 0.945077479f},
-std::array<float,2>{0.839413047f, 0.239260882f},
-std::array<float,2>{0.118865483f, 0.358910918f},
-std::array<float,2>{0.60857743f, 0.511792362f},
-std::array<float,2>{0.243103623f, 0.74231869f},
-std::array<float,2>{0.720692635f, 0.471076936f},
-std::array<float,2>{0.376244754f, 0.123520032f},
-std::array<float,2>{0.941569984f, 0.859965622f},
-std::array<float,2>{0.0592082627f, 0.809810162f},
-std::array<float,2>{0.559175432f, 0.0180959888f},
-std::array<float,2>{0.347195685f, 0.435768098f},
-std::array<float,2>{0.769235671f, 0.65281868f},
-std::array<float,2>{0.443642855f, 0.579224229f},
-std::array<float,2>{0.87858516f, 0.288397968f},
-std::array<float,2>{0.133609146f, 0.180769339f},
-std::array<float,2>{0.67288059f, 0.92461288f},
-std::array<float,2>{0.4467583f, 0.956406951f},
-std::array<float,2>{0.88831234f, 0.23367238f},
-std::array<float,2>{0.132259116f, 0.374096125f},
-std::array<float,2>{0.683454275f, 0.52301091f},
-std::array<float,2>{0.0470573194f, 0.724319637f},
-std::array<float,2>{0.54917407f, 0.493013799f},
-std::array<float,2>{0.35781759f, 0.107964523f},
-std::array<float,2>{0.777824342f, 0.851588845f},
-std::array<float,2>{0.23848632f, 0.78736496f},
-std::array<float,2>{0.727299035f, 0.0142870136f},
-std::array<float,2>{0.385167748f, 0.421603262f},
-std::array<float,2>{0.946756601f, 0.630250156f},
-std::array<float,2>{0.277576268f, 0.566225469f},
-std::array<float,2>{0.833488524f, 0.306205451f},
-std::array<float,2>{0.112983443f, 0.158224881f},
-std::array<float,2>{0.595557213f, 0.921461642f},
-std::array<float,2>{0.343608171f, 0.813234627f},
-std::array<float,2>{0.80761838f, 0.0678812489f},
-std::array<float,2>{0.0275970101f, 0.464181572f},
-std::array<float,2>{0.527451038f, 0.702275634f},
-std::array<float,2>{0.165164456f, 0.547812164f},
-std::array<float,2>{0.635424078f, 0.313922435f},
-std::array<float,2>{0.472107589f, 0.192914754f},
-std::array<float,2>{0.906274974f, 0.96966815f},
-std::array<float,2>{0.0751007274f, 0.89532423f},
-std::array<float,2>{0.591497421f, 0.132461205f},
-std::array<float,2>{0.311657339f, 0.279118598f},
-std::array<float,2>{0.850940108f, 0.60575664f},
-std::array<float,2>{0.407001078f, 0.667546809f},
-std::array<float,2>{0.976641357f, 0.396722943f},
-std::array<float,2>{0.199503288f, 0.0337659568f},
-std::array<float,2>{0.691196799f, 0.773224235f},
-std::array<float,2>{0.399553835f, 0.760703504f},
-std::array<float,2>{0.957845151f, 0.0620530546f},
-std::array<float,2>{0.228408232f, 0.388756514f},
-std::array<float,2>{0.748806536f, 0.679884374f},
-std::array<float,2>{0.109020784f, 0.624483585f},
-std::array<float,2>{0.613848209f, 0.251360387f},
-std::array<float,2>{0.263100147f, 0.151300564f},
-std::array<float,2>{0.817403674f, 0.882016838f},
-std::array<float,2>{0.14503099f, 0.991605043f},
-std::array<float,2>{0.664335489f, 0.207927406f},
-std::array<float,2>{0.457337588f, 0.342923522f},
-std::array<float,2>{0.892598331f, 0.545807123f},
-std::array<float,2>{0.370494843f, 0.712244034f},
-std::array<float,2>{0.757897437f, 0.447943747f},
-std::array<float,2>{0.0424516983f, 0.0922923237f},
-std::array<float,2>{0.533462167f, 0.841948926f},
-std::array<float,2>{0.293045014f, 0.926794887f},
-std::array<float,2>{0.873733759f, 0.187054783f},
-std::array<float,2>{0.0789540038f, 0.282756597f},
-std::array<float,2>{0.567746341f, 0.584094465f},
-std::array<float,2>{0.205954656f, 0.648972213f},
-std::array<float,2>{0.706135213f, 0.431100875f},
-std::array<float,2>{0.432013154f, 0.0226157811f},
-std::array<float,2>{0.995346487f, 0.807560265f},
-std::array<float,2>{0.00644394569f, 0.864476085f},
-std::array<float,2>{0.513374686f, 0.119476467f},
-std::array<float,2>{0.320017844f, 0.473514736f},
-std::array<float,2>{0.785901427f, 0.746575594f},
-std::array<float,2>{0.494802088f, 0.507979155f},
-std::array<float,2>{0.926443577f, 0.352856934f},
-std::array<float,2>{0.177996665f, 0.236247927f},
-std::array<float,2>{0.64940238f, 0.941380739f},
-std::array<float,2>{0.42700392f, 0.884705067f},
-std::array<float,2>{0.990878046f, 0.146024376f},
-std::array<float,2>{0.214362651f, 0.26198113f},
-std::array<float,2>{0.710941076f, 0.611075938f},
-std::array<float,2>{0.0861670747f, 0.679646194f},
-std::array<float,2>{0.57119298f, 0.378828943f},
-std::array<float,2>{0.285605907f, 0.0500169732f},
-std::array<float,2>{0.863353908f, 0.753451169f},
-std::array<float,2>{0.18219772f, 0.835164964f},
-std::array<float,2>{0.640647531f, 0.0832797959f},
-std::array<float,2>{0.491066813f, 0.440288752f},
-std::array<float,2>{0.930857837f, 0.70325762f},
-std::array<float,2>{0.322640598f, 0.533394396f},
-std::array<float,2>{0.791561186f, 0.332580119f},
-std::array<float,2>{0.0138614904f, 0.216146544f},
-std::array<float,2>{0.500101328f, 0.993540645f},
-std::array<float,2>{0.252155155f, 0.798630834f},
-std::array<float,2>{0.820944905f, 0.0290275272f},
-std::array<float,2>{0.0939742401f, 0.425994307f},
-std::array<float,2>{0.62479645f, 0.641439497f},
-std::array<float,2>{0.226478279f, 0.590939105f},
-std::array<float,2>{0.740923703f, 0.295786619f},
-std::array<float,2>{0.392506719f, 0.17668663f},
-std::array<float,2>{0.964083433f, 0.932924926f},
-std::array<float,2>{0.0381514207f, 0.947424471f},
-std::array<float,2>{0.541343629f, 0.243652239f},
-std::array<float,2>{0.36329788f, 0.347805321f},
-std::array<float,2>{0.753159583f, 0.50533855f},
-std::array<float,2>{0.468572855f, 0.737707257f},
-std::array<float,2>{0.899799168f, 0.477118045f},
-std::array<float,2>{0.154645294f, 0.110091731f},
-std::array<float,2>{0.656959116f, 0.872150302f},
-std::array<float,2>{0.48203817f, 0.84473902f},
-std::array<float,2>{0.917107284f, 0.0973297134f},
-std::array<float,2>{0.157445237f, 0.488846153f},
-std::array<float,2>{0.628424585f, 0.728702426f},
-std::array<float,2>{0.0172156263f, 0.525990546f},
-std::array<float,2>{0.522455752f, 0.36397022f},
-std::array<float,2>{0.328462869f, 0.22444652f},
-std::array<float,2>{0.804301798f, 0.962777615f},
-std::array<float,2>{0.192492306f, 0.913495779f},
-std::array<float,2>{0.698204041f, 0.168868884f},
-std::array<float,2>{0.420342922f, 0.301955789f},
-std::array<float,2>{0.970757246f, 0.577868819f},
-std::array<float,2>{0.297721595f, 0.638351679f},
-std::array<float,2>{0.855170369f, 0.407037318f},
-std::array<float,2>{0.0638556257f, 0.000652596937f},
-std::array<float,2>{0.584320068f, 0.792481005f},
-std::array<float,2>{0.350797802f, 0.979415178f},
-std::array<float,2>{0.772081494f, 0.196511909f},
-std::array<float,2>{0.0581663698f, 0.324774086f},
-std::array<float,2>{0.55840528f, 0.556788325f},
-std::array<float,2>{0.138689801f, 0.691072226f},
-std::array<float,2>{0.676312685f, 0.454015791f},
-std::array<float,2>{0.437766761f, 0.0770774409f},
-std::array<float,2>{0.880297184f, 0.823601484f},
-std::array<float,2>{0.124023959f, 0.778010666f},
-std::array<float,2>{0.6032058f, 0.0410133377f},
-std::array<float,2>{0.271317989f, 0.403292f},
-std::array<float,2>{0.841331005f, 0.656444609f},
-std::array<float,2>{0.379593909f, 0.595882118f},
-std::array<float,2>{0.939868748f, 0.270737827f},
-std::array<float,2>{0.247767106f, 0.138967857f},
-std::array<float,2>{0.725437284f, 0.904179752f},
-std::array<float,2>{0.412876368f, 0.949767232f},
-std::array<float,2>{0.981704056f, 0.248372167f},
-std::array<float,2>{0.199209347f, 0.347424179f},
-std::array<float,2>{0.69471693f, 0.502693534f},
-std::array<float,2>{0.0726353675f, 0.739328027f},
-std::array<float,2>{0.58650732f, 0.48251608f},
-std::array<float,2>{0.308149606f, 0.116728f},
-std::array<float,2>{0.84681052f, 0.868628502f},
-std::array<float,2>{0.16966033f, 0.8019315f},
-std::array<float,2>{0.637411058f, 0.0260866135f},
-std::array<float,2>{0.474413782f, 0.423520803f},
-std::array<float,2>{0.912794769f, 0.646073997f},
-std::array<float,2>{0.33665064f, 0.588935018f},
-std::array<float,2>{0.811032891f, 0.289480031f},
-std::array<float,2>{0.0238367151f, 0.172209308f},
-std::array<float,2>{0.52591747f, 0.933857083f},
-std::array<float,2>{0.27400288f, 0.829641521f},
-std::array<float,2>{0.828609407f, 0.0796903968f},
-std::array<float,2>{0.116644733f, 0.444273442f},
-std::array<float,2>{0.601522267f, 0.710160434f},
-std::array<float,2>{0.235761702f, 0.536005676f},
-std::array<float,2>{0.731262743f, 0.331733286f},
-std::array<float,2>{0.387902468f, 0.211816996f},
-std::array<float,2>{0.952560544f, 0.997320235f},
-std::array<float,2>{0.0534543805f, 0.888476789f},
-std::array<float,2>{0.552052021f, 0.143027559f},
-std::array<float,2>{0.35360387f, 0.259152412f},
-std::array<float,2>{0.776334763f, 0.613328516f},
-std::array<float,2>{0.452389151f, 0.674824476f},
-std::array<float,2>{0.885330021f, 0.380836457f},
-std::array<float,2>{0.128906026f, 0.0532086119f},
-std::array<float,2>{0.686020076f, 0.755378485f},
-std::array<float,2>{0.499035805f, 0.775247395f},
-std::array<float,2>{0.923112631f, 0.0450777784f},
-std::array<float,2>{0.175447896f, 0.402279228f},
-std::array<float,2>{0.655087352f, 0.660494328f},
-std::array<float,2>{0.00180104061f, 0.599521399f},
-std::array<float,2>{0.508374214f, 0.267373085f},
-std::array<float,2>{0.312782645f, 0.135396779f},
-std::array<float,2>{0.783899128f, 0.898491383f},
-std::array<float,2>{0.207926601f, 0.981409669f},
-std::array<float,2>{0.708411455f, 0.201797232f},
-std::array<float,2>{0.435646236f, 0.323720038f},
-std::array<float,2>{0.996252894f, 0.558775306f},
-std::array<float,2>{0.28984192f, 0.69225353f},
-std::array<float,2>{0.870958388f, 0.457130581f},
-std::array<float,2>{0.084214583f, 0.0703823715f},
-std::array<float,2>{0.564624369f, 0.827364445f},
-std::array<float,2>{0.372335821f, 0.90740937f},
-std::array<float,2>{0.763992429f, 0.167393491f},
-std::array<float,2>{0.0432744287f, 0.298211753f},
-std::array<float,2>{0.535981476f, 0.57281661f},
-std::array<float,2>{0.141304508f, 0.635312676f},
-std::array<float,2>{0.671032906f, 0.410990536f},
-std::array<float,2>{0.454410166f, 0.00451374613f},
-std::array<float,2>{0.897393107f, 0.793289661f},
-std::array<float,2>{0.102661669f, 0.850074589f},
-std::array<float,2>{0.61129272f, 0.0990954861f},
-std::array<float,2>{0.261501461f, 0.487398088f},
-std::array<float,2>{0.81258589f, 0.733341992f},
-std::array<float,2>{0.403364271f, 0.530236006f},
-std::array<float,2>{0.954235435f, 0.360730886f},
-std::array<float,2>{0.232991964f, 0.221758634f},
-std::array<float,2>{0.742279232f, 0.968554974f},
-std::array<float,2>{0.464749426f, 0.891414881f},
-std::array<float,2>{0.902442753f, 0.127397865f},
-std::array<float,2>{0.151897088f, 0.275783271f},
-std::array<float,2>{0.66074127f, 0.602653027f},
-std::array<float,2>{0.0334162787f, 0.671569228f},
-std::array<float,2>{0.545321345f, 0.393037379f},
-std::array<float,2>{0.362325013f, 0.0370572284f},
-std::array<float,2>{0.755057037f, 0.768013477f},
-std::array<float,2>{0.221569672f, 0.817537248f},
-std::array<float,2>{0.738181949f, 0.0628655925f},
-std::array<float,2>{0.397708595f, 0.467325807f},
-std::array<float,2>{0.965153813f, 0.698299706f},
-std::array<float,2>{0.256931186f, 0.554406941f},
-std::array<float,2>{0.827516496f, 0.31738472f},
-std::array<float,2>{0.101351626f, 0.188317776f},
-std::array<float,2>{0.619832873f, 0.974200606f},
-std::array<float,2>{0.326747745f, 0.784383237f},
-std::array<float,2>{0.793956459f, 0.0106276907f},
-std::array<float,2>{0.011713855f, 0.414950103f},
-std::array<float,2>{0.505477548f, 0.626586497f},
-std::array<float,2>{0.18509841f, 0.569856107f},
-std::array<float,2>{0.647772968f, 0.309796959f},
-std::array<float,2>{0.484769851f, 0.162826225f},
-std::array<float,2>{0.933794558f, 0.917224407f},
-std::array<float,2>{0.0902045965f, 0.957547903f},
-std::array<float,2>{0.575164914f, 0.227476984f},
-std::array<float,2>{0.284573823f, 0.370379657f},
-std::array<float,2>{0.861119509f, 0.519147158f},
-std::array<float,2>{0.42291224f, 0.720103443f},
-std::array<float,2>{0.986514866f, 0.499438494f},
-std::array<float,2>{0.217041895f, 0.10308072f},
-std::array<float,2>{0.715664387f, 0.857006967f},
-std::array<float,2>{0.378752291f, 0.862021804f},
-std::array<float,2>{0.944252491f, 0.121847801f},
-std::array<float,2>{0.244734302f, 0.469469219f},
-std::array<float,2>{0.721647918f, 0.745516419f},
-std::array<float,2>{0.119320445f, 0.51373589f},
-std::array<float,2>{0.605911016f, 0.355956137f},
-std::array<float,2>{0.26893872f, 0.240641117f},
-std::array<float,2>{0.837508798f, 0.943046868f},
-std::array<float,2>{0.135311574f, 0.922900438f},
-std::array<float,2>{0.674984574f, 0.181647867f},
-std::array<float,2>{0.441975176f, 0.285503507f},
-std::array<float,2>{0.87544322f, 0.581265688f},
-std::array<float,2>{0.344778538f, 0.655806601f},
-std::array<float,2>{0.767203748f, 0.434292614f},
-std::array<float,2>{0.0624136068f, 0.0160601195f},
-std::array<float,2>{0.561448097f, 0.810767353f},
-std::array<float,2>{0.30348444f, 0.9858042f},
-std::array<float,2>{0.856727242f, 0.205824107f},
-std::array<float,2>{0.0700964853f, 0.338153929f},
-std::array<float,2>{0.578565419f, 0.539443672f},
-std::array<float,2>{0.189441487f, 0.716103256f},
-std::array<float,2>{0.701913238f, 0.452394456f},
-std::array<float,2>{0.415554404f, 0.0861007348f},
-std::array<float,2>{0.975612283f, 0.839243829f},
-std::array<float,2>{0.0219502933f, 0.762960136f},
-std::array<float,2>{0.516910493f, 0.0561729111f},
-std::array<float,2>{0.334284484f, 0.386089921f},
-std::array<float,2>{0.800250471f, 0.68510884f},
-std::array<float,2>{0.478347242f, 0.620681703f},
-std::array<float,2>{0.920948982f, 0.255123585f},
-std::array<float,2>{0.163076431f, 0.153120086f},
-std::array<float,2>{0.632532358f, 0.878689647f},
-std::array<float,2>{0.470185339f, 0.971373081f},
-std::array<float,2>{0.90838939f, 0.194961473f},
-std::array<float,2>{0.167789161f, 0.315959573f},
-std::array<float,2>{0.632867038f, 0.550697923f},
-std::array<float,2>{0.0310617182f, 0.700029969f},
-std::array<float,2>{0.529470563f, 0.462025613f},
-std::array<float,2>{0.341514796f, 0.0689147115f},
-std::array<float,2>{0.806636274f, 0.815170169f},
-std::array<float,2>{0.202319384f, 0.77090162f},
-std::array<float,2>{0.689365327f, 0.0317073166f},
-std::array<float,2>{0.408695489f, 0.39637208f},
-std::array<float,2>{0.979551494f, 0.664151013f},
-std::array<float,2>{0.308769882f, 0.608727753f},
-std::array<float,2>{0.848699868f, 0.279881328f},
-std::array<float,2>{0.0769162178f, 0.130451366f},
-std::array<float,2>{0.59260112f, 0.896521628f},
-std::array<float,2>{0.357290536f, 0.855027854f},
-std::array<float,2>{0.780477703f, 0.106307104f},
-std::array<float,2>{0.0490097515f, 0.495880812f},
-std::array<float,2>{0.548772275f, 0.726066053f},
-std::array<float,2>{0.129186094f, 0.521110475f},
-std::array<float,2>{0.679835618f, 0.372293949f},
-std::array<float,2>{0.448294431f, 0.23223494f},
-std::array<float,2>{0.890110791f, 0.953409612f},
-std::array<float,2>{0.110838428f, 0.91885674f},
-std::array<float,2>{0.59681195f, 0.156501517f},
-std::array<float,2>{0.279585302f, 0.307340294f},
-std::array<float,2>{0.834967732f, 0.563801765f},
-std::array<float,2>{0.382850081f, 0.632617891f},
-std::array<float,2>{0.949012339f, 0.418699801f},
-std::array<float,2>{0.241803542f, 0.0130934073f},
-std::array<float,2>{0.729310513f, 0.786617696f},
-std::array<float,2>{0.431274533f, 0.804908514f},
-std::array<float,2>{0.993700862f, 0.0195760876f},
-std::array<float,2>{0.204669684f, 0.431817323f},
-std::array<float,2>{0.704986691f, 0.651408553f},
-std::array<float,2>{0.0816747993f, 0.583018601f},
-std::array<float,2>{0.569712877f, 0.284679592f},
-std::array<float,2>{0.295567453f, 0.185075283f},
-std::array<float,2>{0.872192025f, 0.927885175f},
-std::array<float,2>{0.176358342f, 0.938436449f},
-std::array<float,2>{0.651660144f, 0.237553671f},
-std::array<float,2>{0.493267179f, 0.354866326f},
-std::array<float,2>{0.927805603f, 0.510473728f},
-std::array<float,2>{0.316859007f, 0.748595297f},
-std::array<float,2>{0.78795433f, 0.476311505f},
-std::array<float,2>{0.00519434502f, 0.11802531f},
-std::array<float,2>{0.514952958f, 0.867112815f},
-std::array<float,2>{0.264023304f, 0.880450308f},
-std::array<float,2>{0.819462001f, 0.149192229f},
-std::array<float,2>{0.106245741f, 0.252100825f},
-std::array<float,2>{0.616021633f, 0.622365832f},
-std::array<float,2>{0.228595868f, 0.68224901f},
-std::array<float,2>{0.747123718f, 0.387837529f},
-std::array<float,2>{0.401000291f, 0.0598823056f},
-std::array<float,2>{0.960579216f, 0.757813513f},
-std::array<float,2>{0.039952755f, 0.840089262f},
-std::array<float,2>{0.531639278f, 0.0904525593f},
-std::array<float,2>{0.368397772f, 0.447104126f},
-std::array<float,2>{0.761398971f, 0.713934362f},
-std::array<float,2>{0.460673124f, 0.544795632f},
-std::array<float,2>{0.890890241f, 0.341506511f},
-std::array<float,2>{0.146959439f, 0.209471375f},
-std::array<float,2>{0.666404665f, 0.988522887f},
-std::array<float,2>{0.394475937f, 0.929947019f},
-std::array<float,2>{0.961011052f, 0.179508597f},
-std::array<float,2>{0.222917229f, 0.293650389f},
-std::array<float,2>{0.739495635f, 0.592540503f},
-std::array<float,2>{0.096730873f, 0.643654525f},
-std::array<float,2>{0.622940719f, 0.427827746f},
-std::array<float,2>{0.251491755f, 0.0304334983f},
-std::array<float,2>{0.823347628f, 0.800351024f},
-std::array<float,2>{0.152562827f, 0.873715997f},
-std::array<float,2>{0.659032822f, 0.112951107f},
-std::array<float,2>{0.465710908f, 0.480421782f},
-std::array<float,2>{0.900856256f, 0.734435797f},
-std::array<float,2>{0.367054909f, 0.506670594f},
-std::array<float,2>{0.751838446f, 0.350028276f},
-std::array<float,2>{0.0358746685f, 0.244886979f},
-std::array<float,2>{0.539224088f, 0.945809305f},
-std::array<float,2>{0.28783989f, 0.750549674f},
-std::array<float,2>{0.867011368f, 0.0473586246f},
-std::array<float,2>{0.0880789459f, 0.375895381f},
-std::array<float,2>{0.574149907f, 0.677306414f},
-std::array<float,2>{0.211132854f, 0.612297058f},
-std::array<float,2>{0.71393317f, 0.264585376f},
-std::array<float,2>{0.428009868f, 0.147451296f},
-std::array<float,2>{0.989600062f, 0.88643235f},
-std::array<float,2>{0.0121098766f, 0.995850444f},
-std::array<float,2>{0.50346905f, 0.217693016f},
-std::array<float,2>{0.322198093f, 0.334356189f},
-std::array<float,2>{0.789420724f, 0.531415224f},
-std::array<float,2>{0.488871127f, 0.706138849f},
-std::array<float,2>{0.932222247f, 0.43932882f},
-std::array<float,2>{0.180489451f, 0.0846271291f},
-std::array<float,2>{0.643346071f, 0.83388412f},
-std::array<float,2>{0.439892232f, 0.821257889f},
-std::array<float,2>{0.881960213f, 0.0759099647f},
-std::array<float,2>{0.138249695f, 0.456257254f},
-std::array<float,2>{0.679173291f, 0.688006401f},
-std::array<float,2>{0.0556582697f, 0.556193411f},
-std::array<float,2>{0.555514395f, 0.327874959f},
-std::array<float,2>{0.348764241f, 0.197346583f},
-std::array<float,2>{0.769788325f, 0.978302538f},
-std::array<float,2>{0.249943733f, 0.905696392f},
-std::array<float,2>{0.722962439f, 0.137006447f},
-std::array<float,2>{0.381336361f, 0.272096366f},
-std::array<float,2>{0.937631726f, 0.59471947f},
-std::array<float,2>{0.272134155f, 0.65916872f},
-std::array<float,2>{0.842504382f, 0.404878765f},
-std::array<float,2>{0.122804679f, 0.0412227847f},
-std::array<float,2>{0.604170978f, 0.77974844f},
-std::array<float,2>{0.330657572f, 0.964462101f},
-std::array<float,2>{0.801769435f, 0.224839762f},
-std::array<float,2>{0.0184832644f, 0.365577459f},
-std::array<float,2>{0.520061493f, 0.524150252f},
-std::array<float,2>{0.159051746f, 0.728470743f},
-std::array<float,2>{0.625896037f, 0.491539031f},
-std::array<float,2>{0.482897878f, 0.0950509235f},
-std::array<float,2>{0.915845633f, 0.846970916f},
-std::array<float,2>{0.0661897734f, 0.789250076f},
-std::array<float,2>{0.583086669f, 0.00378712337f},
-std::array<float,2>{0.299700171f, 0.409125865f},
-std::array<float,2>{0.852736056f, 0.640094578f},
-std::array<float,2>{0.419073969f, 0.575966716f},
-std::array<float,2>{0.969575465f, 0.303272188f},
-std::array<float,2>{0.194064245f, 0.171587154f},
-std::array<float,2>{0.696625888f, 0.911742091f},
-std::array<float,2>{0.437411159f, 0.983044982f},
-std::array<float,2>{0.997310758f, 0.201157853f},
-std::array<float,2>{0.208959907f, 0.321173728f},
-std::array<float,2>{0.708003104f, 0.560778439f},
-std::array<float,2>{0.0852599517f, 0.694304585f},
-std::array<float,2>{0.565881252f, 0.46032539f},
-std::array<float,2>{0.290897995f, 0.0738009587f},
-std::array<float,2>{0.869394481f, 0.824677408f},
-std::array<float,2>{0.174364388f, 0.776523471f},
-std::array<float,2>{0.65606755f, 0.0443930179f},
-std::array<float,2>{0.498594046f, 0.399947584f},
-std::array<float,2>{0.922164917f, 0.662131846f},
-std::array<float,2>{0.31408751f, 0.600624442f},
-std::array<float,2>{0.784378529f, 0.269180149f},
-std::array<float,2>{3.54229851e-05f, 0.134374082f},
-std::array<float,2>{0.508993566f, 0.901971936f},
-std::array<float,2>{0.259898543f, 0.848715305f},
-std::array<float,2>{0.814142704f, 0.101492658f},
-std::array<float,2>{0.101836152f, 0.485596657f},
-std::array<float,2>{0.609872222f, 0.73206389f},
-std::array<float,2>{0.233819917f, 0.527852893f},
-std::array<float,2>{0.743767977f, 0.361837149f},
-std::array<float,2>{0.40326786f, 0.219494388f},
-std::array<float,2>{0.954086959f, 0.965711296f},
-std::array<float,2>{0.0439860523f, 0.909446597f},
-std::array<float,2>{0.536166131f, 0.16489999f},
-std::array<float,2>{0.371326208f, 0.298873156f},
-std::array<float,2>{0.765129685f, 0.571550608f},
-std::array<float,2>{0.453601539f, 0.633001804f},
-std::array<float,2>{0.897946894f, 0.413247526f},
-std::array<float,2>{0.141823128f, 0.00734906783f},
-std::array<float,2>{0.670213997f, 0.796362936f},
-std::array<float,2>{0.472909629f, 0.803123593f},
-std::array<float,2>{0.9132092f, 0.0238234382f},
-std::array<float,2>{0.168045133f, 0.424923033f},
-std::array<float,2>{0.638389945f, 0.648292661f},
-std::array<float,2>{0.0252347477f, 0.58615905f},
-std::array<float,2>{0.526757598f, 0.291213214f},
-std::array<float,2>{0.337539911f, 0.173929378f},
-std::array<float,2>{0.81218642f, 0.935792983f},
-std::array<float,2>{0.197589234f, 0.953040242f},
-std::array<float,2>{0.693787932f, 0.247044653f},
-std::array<float,2>{0.413141698f, 0.344636738f},
-std::array<float,2>{0.980997145f, 0.501004636f},
-std::array<float,2>{0.307172179f, 0.740639567f},
-std::array<float,2>{0.846361458f, 0.481354177f},
-std::array<float,2>{0.0738988668f, 0.11498744f},
-std::array<float,2>{0.587685883f, 0.870025098f},
-std::array<float,2>{0.355105698f, 0.889920235f},
-std::array<float,2>{0.776664197f, 0.142526954f},
-std::array<float,2>{0.0545305349f, 0.260846615f},
-std::array<float,2>{0.550959229f, 0.617158055f},
-std::array<float,2>{0.12770161f, 0.672294438f},
-std::array<float,2>{0.68697536f, 0.382415563f},
-std::array<float,2>{0.451826692f, 0.0510135889f},
-std::array<float,2>{0.886092126f, 0.757747173f},
-std::array<float,2>{0.115774482f, 0.831605494f},
-std::array<float,2>{0.600462854f, 0.0809258521f},
-std::array<float,2>{0.274791688f, 0.443233281f},
-std::array<float,2>{0.829371154f, 0.708698452f},
-std::array<float,2>{0.38741824f, 0.537406683f},
-std::array<float,2>{0.951624393f, 0.328331292f},
-std::array<float,2>{0.235340655f, 0.213754356f},
-std::array<float,2>{0.732326686f, 0.999161184f},
-std::array<float,2>{0.442861825f, 0.925605297f},
-std::array<float,2>{0.876134098f, 0.179884389f},
-std::array<float,2>{0.136696696f, 0.287845045f},
-std::array<float,2>{0.674736023f, 0.579078674f},
-std::array<float,2>{0.0606757626f, 0.653340936f},
-std::array<float,2>{0.562199533f, 0.437376976f},
-std::array<float,2>{0.344705641f, 0.0190686993f},
-std::array<float,2>{0.766537964f, 0.808824599f},
-std::array<float,2>{0.245313525f, 0.860864878f},
-std::array<float,2>{0.721877158f, 0.12489593f},
-std::array<float,2>{0.377887577f, 0.47173664f},
-std::array<float,2>{0.944711149f, 0.743623316f},
-std::array<float,2>{0.268336207f, 0.512936175f},
-std::array<float,2>{0.836489081f, 0.35825482f},
-std::array<float,2>{0.120975144f, 0.238761559f},
-std::array<float,2>{0.607319474f, 0.94379282f},
-std::array<float,2>{0.335603237f, 0.765530705f},
-std::array<float,2>{0.799323797f, 0.058094494f},
-std::array<float,2>{0.0232277624f, 0.384101331f},
-std::array<float,2>{0.516417205f, 0.685566425f},
-std::array<float,2>{0.163446367f, 0.618917048f},
-std::array<float,2>{0.631541848f, 0.256398231f},
-std::array<float,2>{0.476943314f, 0.155948117f},
-std::array<float,2>{0.920488656f, 0.876338184f},
-std::array<float,2>{0.0685109422f, 0.987583041f},
-std::array<float,2>{0.579167426f, 0.205045581f},
-std::array<float,2>{0.303862065f, 0.337638587f},
-std::array<float,2>{0.85594815f, 0.541891694f},
-std::array<float,2>{0.414237142f, 0.716890037f},
-std::array<float,2>{0.975142181f, 0.450808823f},
-std::array<float,2>{0.187534064f, 0.0885110572f},
-std::array<float,2>{0.703123987f, 0.837469935f},
-std::array<float,2>{0.396847278f, 0.819507241f},
-std::array<float,2>{0.966503143f, 0.0659240633f},
-std::array<float,2>{0.222596973f, 0.465231806f},
-std::array<float,2>{0.737010479f, 0.69697088f},
-std::array<float,2>{0.100373432f, 0.552033186f},
-std::array<float,2>{0.620755494f, 0.320179611f},
-std::array<float,2>{0.256209821f, 0.19004494f},
-std::array<float,2>{0.82696718f, 0.974676728f},
-std::array<float,2>{0.150586709f, 0.893557429f},
-std::array<float,2>{0.662055612f, 0.125108823f},
-std::array<float,2>{0.463602513f, 0.274181306f},
-std::array<float,2>{0.903705359f, 0.603643715f},
-std::array<float,2>{0.362135798f, 0.668973088f},
-std::array<float,2>{0.754864633f, 0.391432405f},
-std::array<float,2>{0.0350586548f, 0.0382541604f},
-std::array<float,2>{0.546170175f, 0.767254472f},
-std::array<float,2>{0.283940464f, 0.959837854f},
-std::array<float,2>{0.859405935f, 0.228905514f},
-std::array<float,2>{0.0908335671f, 0.367440492f},
-std::array<float,2>{0.575905621f, 0.515959084f},
-std::array<float,2>{0.217968836f, 0.721361279f},
-std::array<float,2>{0.716198266f, 0.497654289f},
-std::array<float,2>{0.422308743f, 0.104860194f},
-std::array<float,2>{0.988102078f, 0.859328449f},
-std::array<float,2>{0.0100474209f, 0.782386601f},
-std::array<float,2>{0.504550397f, 0.00919208676f},
-std::array<float,2>{0.327790529f, 0.417858124f},
-std::array<float,2>{0.79323262f, 0.628423214f},
-std::array<float,2>{0.485691845f, 0.567683041f},
-std::array<float,2>{0.935464859f, 0.311015069f},
-std::array<float,2>{0.184490725f, 0.161205292f},
-std::array<float,2>{0.646961868f, 0.914785087f},
-std::array<float,2>{0.493089139f, 0.940223575f},
-std::array<float,2>{0.929595113f, 0.235296652f},
-std::array<float,2>{0.177421808f, 0.35210377f},
-std::array<float,2>{0.651133418f, 0.509437382f},
-std::array<float,2>{0.00409362977f, 0.747637093f},
-std::array<float,2>{0.51400727f, 0.474049062f},
-std::array<float,2>{0.317549765f, 0.120710634f},
-std::array<float,2>{0.788946748f, 0.86341989f},
-std::array<float,2>{0.203783467f, 0.808255136f},
-std::array<float,2>{0.703240812f, 0.0219821241f},
-std::array<float,2>{0.430459648f, 0.430194259f},
-std::array<float,2>{0.992961705f, 0.650339901f},
-std::array<float,2>{0.296857446f, 0.585120559f},
-std::array<float,2>{0.871180713f, 0.281607151f},
-std::array<float,2>{0.080700554f, 0.186124071f},
-std::array<float,2>{0.568830967f, 0.926033497f},
-std::array<float,2>{0.367999852f, 0.843189597f},
-std::array<float,2>{0.760496974f, 0.0935270488f},
-std::array<float,2>{0.0407058783f, 0.449053288f},
-std::array<float,2>{0.533159316f, 0.71153754f},
-std::array<float,2>{0.148089111f, 0.546488643f},
-std::array<float,2>{0.667921424f, 0.342189997f},
-std::array<float,2>{0.459139794f, 0.208740771f},
-std::array<float,2>{0.892510414f, 0.990505338f},
-std::array<float,2>{0.106888928f, 0.880892932f},
-std::array<float,2>{0.616698503f, 0.151490062f},
-std::array<float,2>{0.264991969f, 0.25041762f},
-std::array<float,2>{0.819329798f, 0.623307467f},
-std::array<float,2>{0.402062505f, 0.681087971f},
-std::array<float,2>{0.959789872f, 0.39008829f},
-std::array<float,2>{0.230185658f, 0.061510019f},
-std::array<float,2>{0.746103764f, 0.761464119f},
-std::array<float,2>{0.40964663f, 0.771965146f},
-std::array<float,2>{0.978527963f, 0.0347049274f},
-std::array<float,2>{0.201312199f, 0.398381084f},
-std::array<float,2>{0.687523603f, 0.666050494f},
-std::array<float,2>{0.0778842419f, 0.607188284f},
-std::array<float,2>{0.593554974f, 0.27814725f},
-std::array<float,2>{0.310204059f, 0.130930722f},
-std::array<float,2>{0.848608851f, 0.89628005f},
-std::array<float,2>{0.166855201f, 0.969935834f},
-std::array<float,2>{0.634172738f, 0.191787452f},
-std::array<float,2>{0.469312489f, 0.31266278f},
-std::array<float,2>{0.909615338f, 0.548227847f},
-std::array<float,2>{0.34050113f, 0.702003419f},
-std::array<float,2>{0.805074751f, 0.46384275f},
-std::array<float,2>{0.0294182207f, 0.0671000406f},
-std::array<float,2>{0.530775487f, 0.813845336f},
-std::array<float,2>{0.28073141f, 0.92059952f},
-std::array<float,2>{0.834600151f, 0.159690201f},
-std::array<float,2>{0.109709032f, 0.30485481f},
-std::array<float,2>{0.59624517f, 0.565011203f},
-std::array<float,2>{0.240744993f, 0.629151404f},
-std::array<float,2>{0.730302453f, 0.420669585f},
-std::array<float,2>{0.383848667f, 0.0149069447f},
-std::array<float,2>{0.947424054f, 0.788913012f},
-std::array<float,2>{0.0507762171f, 0.852831185f},
-std::array<float,2>{0.547729194f, 0.108682275f},
-std::array<float,2>{0.355485648f, 0.493841857f},
-std::array<float,2>{0.77959764f, 0.723520517f},
-std::array<float,2>{0.44789061f, 0.522186518f},
-std::array<float,2>{0.889347911f, 0.373525769f},
-std::array<float,2>{0.130858526f, 0.23293294f},
-std::array<float,2>{0.681326032f, 0.955316544f},
-std::array<float,2>{0.382654876f, 0.902600825f},
-std::array<float,2>{0.93862623f, 0.139929295f},
-std::array<float,2>{0.248669252f, 0.270400554f},
-std::array<float,2>{0.723787427f, 0.597507f},
-std::array<float,2>{0.121161483f, 0.657996178f},
-std::array<float,2>{0.605312586f, 0.403336018f},
-std::array<float,2>{0.27321732f, 0.0394002423f},
-std::array<float,2>{0.843240798f, 0.77908963f},
-std::array<float,2>{0.137191281f, 0.823043108f},
-std::array<float,2>{0.678646863f, 0.0780759677f},
-std::array<float,2>{0.440696776f, 0.455036551f},
-std::array<float,2>{0.881132483f, 0.690068185f},
-std::array<float,2>{0.348279089f, 0.558338761f},
-std::array<float,2>{0.771390736f, 0.326030999f},
-std::array<float,2>{0.056051828f, 0.19606714f},
-std::array<float,2>{0.556021631f, 0.97985363f},
-std::array<float,2>{0.300372064f, 0.791673005f},
-std::array<float,2>{0.851719737f, 0.00117427495f},
-std::array<float,2>{0.0645771697f, 0.407491624f},
-std::array<float,2>{0.582271099f, 0.636786699f},
-std::array<float,2>{0.195307568f, 0.576485395f},
-std::array<float,2>{0.695722222f, 0.301267952f},
-std::array<float,2>{0.418054998f, 0.169565707f},
-std::array<float,2>{0.970203161f, 0.912468433f},
-std::array<float,2>{0.0188758392f, 0.961286366f},
-std::array<float,2>{0.521473706f, 0.223172843f},
-std::array<float,2>{0.331344396f, 0.365147024f},
-std::array<float,2>{0.801062286f, 0.526894331f},
-std::array<float,2>{0.483765483f, 0.730064809f},
-std::array<float,2>{0.914681315f, 0.489764571f},
-std::array<float,2>{0.159526825f, 0.0963454992f},
-std::array<float,2>{0.6261338f, 0.844489396f},
-std::array<float,2>{0.466772616f, 0.871179581f},
-std::array<float,2>{0.901616812f, 0.110951424f},
-std::array<float,2>{0.15372099f, 0.477716178f},
-std::array<float,2>{0.659531236f, 0.736389577f},
-std::array<float,2>{0.0361709297f, 0.504672647f},
-std::array<float,2>{0.540437818f, 0.348722279f},
-std::array<float,2>{0.365990758f, 0.242343068f},
-std::array<float,2>{0.750455439f, 0.949020505f},
-std::array<float,2>{0.224569544f, 0.932036102f},
-std::array<float,2>{0.739153147f, 0.177614078f},
-std::array<float,2>{0.393341631f, 0.296408027f},
-std::array<float,2>{0.962235153f, 0.590467274f},
-std::array<float,2>{0.250735164f, 0.641884327f},
-std::array<float,2>{0.82314992f, 0.426885873f},
-std::array<float,2>{0.0962681323f, 0.0280197915f},
-std::array<float,2>{0.62159878f, 0.797752559f},
-std::array<float,2>{0.320312828f, 0.993112683f},
-std::array<float,2>{0.790213287f, 0.215133563f},
-std::array<float,2>{0.012982904f, 0.333895713f},
-std::array<float,2>{0.502839029f, 0.534585834f},
-std::array<float,2>{0.181146845f, 0.70428282f},
-std::array<float,2>{0.644462705f, 0.440956384f},
-std::array<float,2>{0.48927024f, 0.0820766538f},
-std::array<float,2>{0.932744443f, 0.834813058f},
-std::array<float,2>{0.0891372114f, 0.752553821f},
-std::array<float,2>{0.572780311f, 0.0488685258f},
-std::array<float,2>{0.288197756f, 0.377081364f},
-std::array<float,2>{0.865960777f, 0.678282619f},
-std::array<float,2>{0.429044425f, 0.609787703f},
-std::array<float,2>{0.988453984f, 0.263554931f},
-std::array<float,2>{0.212655321f, 0.145487919f},
-std::array<float,2>{0.712898374f, 0.883765042f},
-std::array<float,2>{0.404560387f, 0.967081666f},
-std::array<float,2>{0.955291688f, 0.220786169f},
-std::array<float,2>{0.231577739f, 0.360010803f},
-std::array<float,2>{0.745113134f, 0.530599117f},
-std::array<float,2>{0.104280464f, 0.734159172f},
-std::array<float,2>{0.611585438f, 0.486970544f},
-std::array<float,2>{0.258959442f, 0.0979448482f},
-std::array<float,2>{0.814528406f, 0.850606441f},
-std::array<float,2>{0.142867684f, 0.79398334f},
-std::array<float,2>{0.669669867f, 0.00542390021f},
-std::array<float,2>{0.455630094f, 0.411633164f},
-std::array<float,2>{0.895273149f, 0.636716604f},
-std::array<float,2>{0.373955309f, 0.573777974f},
-std::array<float,2>{0.763184249f, 0.296898991f},
-std::array<float,2>{0.0462378897f, 0.166672915f},
-std::array<float,2>{0.538330317f, 0.907209992f},
-std::array<float,2>{0.291695625f, 0.827042401f},
-std::array<float,2>{0.868509054f, 0.0715492815f},
-std::array<float,2>{0.0825422555f, 0.458284616f},
-std::array<float,2>{0.564211786f, 0.693163812f},
-std::array<float,2>{0.209542647f, 0.559805274f},
-std::array<float,2>{0.710051835f, 0.32320106f},
-std::array<float,2>{0.435545057f, 0.202772647f},
-std::array<float,2>{0.999958932f, 0.981672525f},
-std::array<float,2>{0.00354300695f, 0.900216401f},
-std::array<float,2>{0.510925412f, 0.136520982f},
-std::array<float,2>{0.315319777f, 0.266068697f},
-std::array<float,2>{0.782462537f, 0.597842991f},
-std::array<float,2>{0.497964174f, 0.661153138f},
-std::array<float,2>{0.925327182f, 0.401153266f},
-std::array<float,2>{0.173735067f, 0.0465178713f},
-std::array<float,2>{0.653728664f, 0.773990333f},
-std::array<float,2>{0.449702561f, 0.754293621f},
-std::array<float,2>{0.88302964f, 0.0543066561f},
-std::array<float,2>{0.126731023f, 0.379770607f},
-std::array<float,2>{0.685291111f, 0.674040973f},
-std::array<float,2>{0.0509092435f, 0.615188956f},
-std::array<float,2>{0.553949654f, 0.25830549f},
-std::array<float,2>{0.351932615f, 0.143829048f},
-std::array<float,2>{0.774462044f, 0.887308598f},
-std::array<float,2>{0.237250224f, 0.996778786f},
-std::array<float,2>{0.732544363f, 0.212364852f},
-std::array<float,2>{0.389546305f, 0.33098343f},
-std::array<float,2>{0.950806916f, 0.536746323f},
-std::array<float,2>{0.277278155f, 0.709399581f},
-std::array<float,2>{0.831690013f, 0.444877237f},
-std::array<float,2>{0.114927664f, 0.0789501518f},
-std::array<float,2>{0.598369837f, 0.828359425f},
-std::array<float,2>{0.338214993f, 0.935495734f},
-std::array<float,2>{0.809723973f, 0.173165485f},
-std::array<float,2>{0.0271823779f, 0.290188849f},
-std::array<float,2>{0.523973465f, 0.58870399f},
-std::array<float,2>{0.171657458f, 0.644559145f},
-std::array<float,2>{0.639208555f, 0.422513157f},
-std::array<float,2>{0.475229859f, 0.0270340685f},
-std::array<float,2>{0.911669254f, 0.801251292f},
-std::array<float,2>{0.071162954f, 0.86780715f},
-std::array<float,2>{0.587931812f, 0.1159027f},
-std::array<float,2>{0.305190057f, 0.483582795f},
-std::array<float,2>{0.8447119f, 0.738491774f},
-std::array<float,2>{0.410351545f, 0.503642142f},
-std::array<float,2>{0.982598126f, 0.346452445f},
-std::array<float,2>{0.19695425f, 0.249335766f},
-std::array<float,2>{0.692764103f, 0.951100767f},
-std::array<float,2>{0.479251325f, 0.877183616f},
-std::array<float,2>{0.919784248f, 0.153565258f},
-std::array<float,2>{0.160620227f, 0.254550725f},
-std::array<float,2>{0.629886568f, 0.619509637f},
-std::array<float,2>{0.0211764909f, 0.683839142f},
-std::array<float,2>{0.518947303f, 0.385404795f},
-std::array<float,2>{0.333805054f, 0.0552666895f},
-std::array<float,2>{0.797830701f, 0.76218915f},
-std::array<float,2>{0.190054864f, 0.838783622f},
-std::array<float,2>{0.699422956f, 0.0877517387f},
-std::array<float,2>{0.417663634f, 0.451510191f},
-std::array<float,2>{0.973721027f, 0.715132236f},
-std::array<float,2>{0.301739782f, 0.540182829f},
-std::array<float,2>{0.859079301f, 0.339054972f},
-std::array<float,2>{0.0672034547f, 0.20666419f},
-std::array<float,2>{0.581326783f, 0.985124826f},
-std::array<float,2>{0.346133351f, 0.812278688f},
-std::array<float,2>{0.767766654f, 0.0169524141f},
-std::array<float,2>{0.0601644851f, 0.435184449f},
-std::array<float,2>{0.56022054f, 0.654621243f},
-std::array<float,2>{0.134242281f, 0.580547333f},
-std::array<float,2>{0.672358036f, 0.286859035f},
-std::array<float,2>{0.445227683f, 0.182798326f},
-std::array<float,2>{0.877251863f, 0.922127306f},
-std::array<float,2>{0.118051097f, 0.941676855f},
-std::array<float,2>{0.607696831f, 0.242118552f},
-std::array<float,2>{0.266658455f, 0.356948555f},
-std::array<float,2>{0.838848531f, 0.515595734f},
-std::array<float,2>{0.375041664f, 0.744582117f},
-std::array<float,2>{0.943048596f, 0.470337063f},
-std::array<float,2>{0.243475348f, 0.122712061f},
-std::array<float,2>{0.719328701f, 0.86261791f},
-std::array<float,2>{0.425143272f, 0.855924308f},
-std::array<float,2>{0.984758854f, 0.10212703f},
-std::array<float,2>{0.215527028f, 0.498545051f},
-std::array<float,2>{0.717834055f, 0.718787849f},
-std::array<float,2>{0.09338478f, 0.518392503f},
-std::array<float,2>{0.577068925f, 0.370034218f},
-std::array<float,2>{0.281915843f, 0.228320047f},
-std::array<float,2>{0.861944139f, 0.958728373f},
-std::array<float,2>{0.186309502f, 0.916437268f},
-std::array<float,2>{0.646137178f, 0.163601026f},
-std::array<float,2>{0.487007707f, 0.309054196f},
-std::array<float,2>{0.936982334f, 0.568935215f},
-std::array<float,2>{0.326031893f, 0.625588536f},
-std::array<float,2>{0.796318293f, 0.415828198f},
-std::array<float,2>{0.00917534437f, 0.0112313339f},
-std::array<float,2>{0.507280886f, 0.783324063f},
-std::array<float,2>{0.255686641f, 0.972728074f},
-std::array<float,2>{0.824348271f, 0.18909061f},
-std::array<float,2>{0.09814132f, 0.317097664f},
-std::array<float,2>{0.618364275f, 0.552758098f},
-std::array<float,2>{0.219345048f, 0.697949469f},
-std::array<float,2>{0.735112429f, 0.468300492f},
-std::array<float,2>{0.395908207f, 0.0636849478f},
-std::array<float,2>{0.967996418f, 0.816461802f},
-std::array<float,2>{0.0324863233f, 0.76919353f},
-std::array<float,2>{0.543680191f, 0.0352659971f},
-std::array<float,2>{0.360558599f, 0.393630326f},
-std::array<float,2>{0.756581724f, 0.670294166f},
-std::array<float,2>{0.462888658f, 0.601722658f},
-std::array<float,2>{0.905036688f, 0.277039707f},
-std::array<float,2>{0.148893416f, 0.128784269f},
-std::array<float,2>{0.663395226f, 0.892425001f},
-std::array<float,2>{0.458924532f, 0.989869773f},
-std::array<float,2>{0.894407034f, 0.210677996f},
-std::array<float,2>{0.146394342f, 0.340674311f},
-std::array<float,2>{0.66596514f, 0.543668687f},
-std::array<float,2>{0.041816663f, 0.713028491f},
-std::array<float,2>{0.535146356f, 0.445997506f},
-std::array<float,2>{0.370049387f, 0.0912828743f},
-std::array<float,2>{0.75952667f, 0.841437757f},
-std::array<float,2>{0.227033377f, 0.759578526f},
-std::array<float,2>{0.749523342f, 0.0592550598f},
-std::array<float,2>{0.398956776f, 0.387648791f},
-std::array<float,2>{0.95860523f, 0.682812631f},
-std::array<float,2>{0.261719674f, 0.621176064f},
-std::array<float,2>{0.817139387f, 0.252966911f},
-std::array<float,2>{0.10830351f, 0.150040746f},
-std::array<float,2>{0.614783108f, 0.879500568f},
-std::array<float,2>{0.318542182f, 0.865577996f},
-std::array<float,2>{0.786811233f, 0.11907573f},
-std::array<float,2>{0.00745655457f, 0.4755252f},
-std::array<float,2>{0.51196748f, 0.74964571f},
-std::array<float,2>{0.178897858f, 0.511674464f},
-std::array<float,2>{0.649742961f, 0.35436821f},
-std::array<float,2>{0.495693356f, 0.236489937f},
-std::array<float,2>{0.927251279f, 0.938999236f},
-std::array<float,2>{0.079104498f, 0.929234087f},
-std::array<float,2>{0.567296922f, 0.18453832f},
-std::array<float,2>{0.294241399f, 0.284156889f},
-std::array<float,2>{0.874753833f, 0.582807422f},
-std::array<float,2>{0.433371186f, 0.650431097f},
-std::array<float,2>{0.994222701f, 0.432925761f},
-std::array<float,2>{0.206152722f, 0.021367291f},
-std::array<float,2>{0.705464125f, 0.805694461f},
-std::array<float,2>{0.386666179f, 0.786035836f},
-std::array<float,2>{0.945830405f, 0.0124961007f},
-std::array<float,2>{0.239267781f, 0.419089913f},
-std::array<float,2>{0.727749765f, 0.631117165f},
-std::array<float,2>{0.111404315f, 0.563125432f},
-std::array<float,2>{0.594262123f, 0.308198214f},
-std::array<float,2>{0.278560877f, 0.158044785f},
-std::array<float,2>{0.832633555f, 0.919710457f},
-std::array<float,2>{0.13146247f, 0.954770207f},
-std::array<float,2>{0.682390571f, 0.231200948f},
-std::array<float,2>{0.445788711f, 0.371251762f},
-std::array<float,2>{0.887391984f, 0.519990563f},
-std::array<float,2>{0.358725101f, 0.724614978f},
-std::array<float,2>{0.778525054f, 0.494436532f},
-std::array<float,2>{0.0481261276f, 0.107082985f},
-std::array<float,2>{0.549926877f, 0.85428834f},
-std::array<float,2>{0.311104029f, 0.898376524f},
-std::array<float,2>{0.850338578f, 0.129474536f},
-std::array<float,2>{0.0754941702f, 0.281170785f},
-std::array<float,2>{0.590716183f, 0.607446432f},
-std::array<float,2>{0.200931981f, 0.665229082f},
-std::array<float,2>{0.689477742f, 0.394968182f},
-std::array<float,2>{0.407899857f, 0.033095248f},
-std::array<float,2>{0.978318393f, 0.770374954f},
-std::array<float,2>{0.0284875296f, 0.815774381f},
-std::array<float,2>{0.528381467f, 0.0694938228f},
-std::array<float,2>{0.34184289f, 0.461575955f},
-std::array<float,2>{0.806948066f, 0.70048219f},
-std::array<float,2>{0.471616924f, 0.548988998f},
-std::array<float,2>{0.907395542f, 0.314985096f},
-std::array<float,2>{0.164960861f, 0.194243699f},
-std::array<float,2>{0.636339903f, 0.972066641f},
-std::array<float,2>{0.420953155f, 0.911105633f},
-std::array<float,2>{0.97205323f, 0.170406699f},
-std::array<float,2>{0.192097291f, 0.303790808f},
-std::array<float,2>{0.698331416f, 0.574255764f},
-std::array<float,2>{0.0626843646f, 0.639062643f},
-std::array<float,2>{0.585501015f, 0.409974903f},
-std::array<float,2>{0.297966242f, 0.00254844478f},
-std::array<float,2>{0.854188263f, 0.790339351f},
-std::array<float,2>{0.157203913f, 0.845707059f},
-std::array<float,2>{0.627551436f, 0.0941250622f},
-std::array<float,2>{0.481006682f, 0.490921468f},
-std::array<float,2>{0.916360617f, 0.727446795f},
-std::array<float,2>{0.329184353f, 0.525015712f},
-std::array<float,2>{0.803072929f, 0.366690636f},
-std::array<float,2>{0.015815571f, 0.226352081f},
-std::array<float,2>{0.523396254f, 0.963426828f},
-std::array<float,2>{0.270334274f, 0.780326605f},
-std::array<float,2>{0.840134084f, 0.0421481915f},
-std::array<float,2>{0.1238074f, 0.405962199f},
-std::array<float,2>{0.601593673f, 0.659562528f},
-std::array<float,2>{0.247001618f, 0.595629811f},
-std::array<float,2>{0.725910425f, 0.272873998f},
-std::array<float,2>{0.380503207f, 0.138500959f},
-std::array<float,2>{0.940860212f, 0.905001163f},
-std::array<float,2>{0.0569477528f, 0.976842582f},
-std::array<float,2>{0.556808829f, 0.198660254f},
-std::array<float,2>{0.350414485f, 0.326729834f},
-std::array<float,2>{0.773183465f, 0.554890513f},
-std::array<float,2>{0.438644499f, 0.688799322f},
-std::array<float,2>{0.878970444f, 0.455314755f},
-std::array<float,2>{0.139913708f, 0.0745594278f},
-std::array<float,2>{0.677179635f, 0.821457505f},
-std::array<float,2>{0.491305709f, 0.832557559f},
-std::array<float,2>{0.929974079f, 0.0858809128f},
-std::array<float,2>{0.183351919f, 0.437937737f},
-std::array<float,2>{0.641896248f, 0.705522239f},
-std::array<float,2>{0.0156201543f, 0.532666147f},
-std::array<float,2>{0.501340449f, 0.335775316f},
-std::array<float,2>{0.324046314f, 0.218575165f},
-std::array<float,2>{0.792171061f, 0.995081902f},
-std::array<float,2>{0.213026091f, 0.885386765f},
-std::array<float,2>{0.712151825f, 0.147652328f},
-std::array<float,2>{0.426489145f, 0.265452445f},
-std::array<float,2>{0.991690457f, 0.612664461f},
-std::array<float,2>{0.286186248f, 0.676350832f},
-std::array<float,2>{0.864365101f, 0.376689255f},
-std::array<float,2>{0.0875940695f, 0.0485754088f},
-std::array<float,2>{0.571617782f, 0.751462758f},
-std::array<float,2>{0.365074843f, 0.946608901f},
-std::array<float,2>{0.752384722f, 0.246088281f},
-std::array<float,2>{0.0372344367f, 0.351002961f},
-std::array<float,2>{0.542714953f, 0.507183373f},
-std::array<float,2>{0.155637249f, 0.735653639f},
-std::array<float,2>{0.657671094f, 0.479101956f},
-std::array<float,2>{0.466815144f, 0.112251624f},
-std::array<float,2>{0.89865768f, 0.874720335f},
-std::array<float,2>{0.0956265032f, 0.798840225f},
-std::array<float,2>{0.623965085f, 0.0298051443f},
-std::array<float,2>{0.253654301f, 0.429360926f},
-std::array<float,2>{0.821980536f, 0.643106878f},
-std::array<float,2>{0.391123205f, 0.593020916f},
-std::array<float,2>{0.963277102f, 0.29471916f},
-std::array<float,2>{0.225472584f, 0.177748948f},
-std::array<float,2>{0.742103338f, 0.931348979f},
-std::array<float,2>{0.396387398f, 0.975511074f},
-std::array<float,2>{0.96852386f, 0.189870328f},
-std::array<float,2>{0.218822017f, 0.319414377f},
-std::array<float,2>{0.734711826f, 0.552281618f},
-std::array<float,2>{0.0982834771f, 0.696350992f},
-std::array<float,2>{0.618825376f, 0.465742111f},
-std::array<float,2>{0.255188286f, 0.065813981f},
-std::array<float,2>{0.824721158f, 0.820186377f},
-std::array<float,2>{0.149100244f, 0.766909778f},
-std::array<float,2>{0.663759589f, 0.0388168134f},
-std::array<float,2>{0.462249815f, 0.391088963f},
-std::array<float,2>{0.904421985f, 0.669610977f},
-std::array<float,2>{0.360953987f, 0.60439986f},
-std::array<float,2>{0.756086767f, 0.273768574f},
-std::array<float,2>{0.0330133401f, 0.125754192f},
-std::array<float,2>{0.543071568f, 0.894084215f},
-std::array<float,2>{0.281667888f, 0.858695507f},
-std::array<float,2>{0.861519814f, 0.105378926f},
-std::array<float,2>{0.0930096358f, 0.497408837f},
-std::array<float,2>{0.576322556f, 0.721124113f},
-std::array<float,2>{0.214910135f, 0.516122818f},
-std::array<float,2>{0.718489766f, 0.36779204f},
-std::array<float,2>{0.425331503f, 0.229489535f},
-std::array<float,2>{0.984983683f, 0.958994687f},
-std::array<float,2>{0.00968676526f, 0.914127231f},
-std::array<float,2>{0.507784903f, 0.16194731f},
-std::array<float,2>{0.325282544f, 0.311415762f},
-std::array<float,2>{0.796856999f, 0.568191111f},
-std::array<float,2>{0.486369252f, 0.628002226f},
-std::array<float,2>{0.937461853f, 0.417390347f},
-std::array<float,2>{0.185945019f, 0.00946710072f},
-std::array<float,2>{0.645518303f, 0.783139765f},
-std::array<float,2>{0.444626927f, 0.809438825f},
-std::array<float,2>{0.877818167f, 0.0187563244f},
-std::array<float,2>{0.134600267f, 0.43700549f},
-std::array<float,2>{0.672492385f, 0.654275179f},
-std::array<float,2>{0.0599880852f, 0.578285038f},
-std::array<float,2>{0.559946001f, 0.287290812f},
-std::array<float,2>{0.346368074f, 0.180287167f},
-std::array<float,2>{0.768363476f, 0.924855173f},
-std::array<float,2>{0.243984446f, 0.944144368f},
-std::array<float,2>{0.718934059f, 0.239241213f},
-std::array<float,2>{0.375830501f, 0.357796848f},
-std::array<float,2>{0.94259423f, 0.513557673f},
-std::array<float,2>{0.267138213f, 0.743832469f},
-std::array<float,2>{0.838302851f, 0.472260475f},
-std::array<float,2>{0.117427759f, 0.124147639f},
-std::array<float,2>{0.608121276f, 0.860606313f},
-std::array<float,2>{0.333351731f, 0.876916587f},
-std::array<float,2>{0.797182858f, 0.155372262f},
-std::array<float,2>{0.020933168f, 0.255869716f},
-std::array<float,2>{0.519183934f, 0.618486106f},
-std::array<float,2>{0.160729632f, 0.686398089f},
-std::array<float,2>{0.630726635f, 0.384380937f},
-std::array<float,2>{0.478922993f, 0.0583249293f},
-std::array<float,2>{0.919068336f, 0.764682591f},
-std::array<float,2>{0.0667919666f, 0.837145925f},
-std::array<float,2>{0.581980228f, 0.0883103758f},
-std::array<float,2>{0.301263332f, 0.450483024f},
-std::array<float,2>{0.858528197f, 0.717315495f},
-std::array<float,2>{0.417002022f, 0.541114569f},
-std::array<float,2>{0.97412616f, 0.337005138f},
-std::array<float,2>{0.189729363f, 0.204320431f},
-std::array<float,2>{0.699963331f, 0.988003731f},
-std::array<float,2>{0.475027174f, 0.936132848f},
-std::array<float,2>{0.911179364f, 0.174551666f},
-std::array<float,2>{0.171348512f, 0.291974366f},
-std::array<float,2>{0.638875127f, 0.586542547f},
-std::array<float,2>{0.0267015975f, 0.647915006f},
-std::array<float,2>{0.523575902f, 0.425492257f},
-std::array<float,2>{0.33867839f, 0.024403505f},
-std::array<float,2>{0.810059607f, 0.803307056f},
-std::array<float,2>{0.196404532f, 0.869562149f},
-std::array<float,2>{0.693156838f, 0.114432685f},
-std::array<float,2>{0.410786211f, 0.480954528f},
-std::array<float,2>{0.983113885f, 0.740920305f},
-std::array<float,2>{0.305017382f, 0.501700282f},
-std::array<float,2>{0.844019771f, 0.343758672f},
-std::array<float,2>{0.0707554668f, 0.246107653f},
-std::array<float,2>{0.588616192f, 0.952401519f},
-std::array<float,2>{0.352363467f, 0.757068217f},
-std::array<float,2>{0.775197446f, 0.0517219752f},
-std::array<float,2>{0.0516977683f, 0.382105112f},
-std::array<float,2>{0.554371715f, 0.672419012f},
-std::array<float,2>{0.126440421f, 0.616334081f},
-std::array<float,2>{0.684616446f, 0.261579633f},
-std::array<float,2>{0.449864686f, 0.141716301f},
-std::array<float,2>{0.883537591f, 0.890531182f},
-std::array<float,2>{0.114564709f, 0.99993068f},
-std::array<float,2>{0.597965717f, 0.213058904f},
-std::array<float,2>{0.276659787f, 0.328743964f},
-std::array<float,2>{0.831176341f, 0.537605405f},
-std::array<float,2>{0.389157742f, 0.708164513f},
-std::array<float,2>{0.950393796f, 0.442659646f},
-std::array<float,2>{0.236722335f, 0.0802997574f},
-std::array<float,2>{0.733145237f, 0.831453264f},
-std::array<float,2>{0.434867352f, 0.824720979f},
-std::array<float,2>{0.999049306f, 0.0734923109f},
-std::array<float,2>{0.209079698f, 0.46058318f},
-std::array<float,2>{0.710454106f, 0.693725884f},
-std::array<float,2>{0.0822318867f, 0.561193168f},
-std::array<float,2>{0.563568056f, 0.320446551f},
-std::array<float,2>{0.29135552f, 0.200314254f},
-std::array<float,2>{0.868932366f, 0.982588947f},
-std::array<float,2>{0.173313677f, 0.901740551f},
-std::array<float,2>{0.654221773f, 0.134152755f},
-std::array<float,2>{0.497269005f, 0.268805236f},
-std::array<float,2>{0.925003946f, 0.601540565f},
-std::array<float,2>{0.314868659f, 0.662751019f},
-std::array<float,2>{0.783028722f, 0.399595439f},
-std::array<float,2>{0.00303145987f, 0.0449155085f},
-std::array<float,2>{0.511677921f, 0.77690357f},
-std::array<float,2>{0.259520113f, 0.965258002f},
-std::array<float,2>{0.815193057f, 0.219068974f},
-std::array<float,2>{0.103921331f, 0.361639619f},
-std::array<float,2>{0.611946404f, 0.527779043f},
-std::array<float,2>{0.232109234f, 0.731845438f},
-std::array<float,2>{0.744178355f, 0.485884339f},
-std::array<float,2>{0.404873312f, 0.101033561f},
-std::array<float,2>{0.955909014f, 0.849590063f},
-std::array<float,2>{0.0465318859f, 0.796455383f},
-std::array<float,2>{0.538700342f, 0.00718636997f},
-std::array<float,2>{0.373084903f, 0.413821101f},
-std::array<float,2>{0.763174415f, 0.633651018f},
-std::array<float,2>{0.455254763f, 0.5720433f},
-std::array<float,2>{0.894990087f, 0.299725085f},
-std::array<float,2>{0.143544719f, 0.164268628f},
-std::array<float,2>{0.669000328f, 0.909810364f},
-std::array<float,2>{0.467361063f, 0.948634565f},
-std::array<float,2>{0.898938715f, 0.242960796f},
-std::array<float,2>{0.156156853f, 0.349137455f},
-std::array<float,2>{0.657719016f, 0.503988922f},
-std::array<float,2>{0.0380054116f, 0.736943185f},
-std::array<float,2>{0.542395055f, 0.47851035f},
-std::array<float,2>{0.364527166f, 0.110482797f},
-std::array<float,2>{0.752542257f, 0.871733904f},
-std::array<float,2>{0.224711463f, 0.797355235f},
-std::array<float,2>{0.741266489f, 0.0274887066f},
-std::array<float,2>{0.390822321f, 0.427434683f},
-std::array<float,2>{0.963577151f, 0.642262459f},
-std::array<float,2>{0.253249705f, 0.589877784f},
-std::array<float,2>{0.821352303f, 0.296382755f},
-std::array<float,2>{0.0950599089f, 0.176831797f},
-std::array<float,2>{0.623392522f, 0.932280719f},
-std::array<float,2>{0.323260903f, 0.834261596f},
-std::array<float,2>{0.792709589f, 0.0825310796f},
-std::array<float,2>{0.0147897042f, 0.440744102f},
-std::array<float,2>{0.501521528f, 0.704700589f},
-std::array<float,2>{0.18296659f, 0.534747899f},
-std::array<float,2>{0.642542779f, 0.333247602f},
-std::array<float,2>{0.491803944f, 0.215558887f},
-std::array<float,2>{0.930655718f, 0.992444575f},
-std::array<float,2>{0.0869497955f, 0.883199692f},
-std::array<float,2>{0.571875393f, 0.144611582f},
-std::array<float,2>{0.286675215f, 0.262988538f},
-std::array<float,2>{0.864899457f, 0.610155761f},
-std::array<float,2>{0.425973445f, 0.67802459f},
-std::array<float,2>{0.991819263f, 0.377854109f},
-std::array<float,2>{0.213772386f, 0.049552314f},
-std::array<float,2>{0.712605178f, 0.752243876f},
-std::array<float,2>{0.380065203f, 0.778484344f},
-std::array<float,2>{0.941335857f, 0.0396516547f},
-std::array<float,2>{0.246441767f, 0.404060394f},
-std::array<float,2>{0.726197064f, 0.657298386f},
-std::array<float,2>{0.123281017f, 0.597146332f},
-std::array<float,2>{0.602255285f, 0.269744575f},
-std::array<float,2>{0.26995185f, 0.140269518f},
-std::array<float,2>{0.840675354f, 0.903019786f},
-std::array<float,2>{0.140154362f, 0.980155528f},
-std::array<float,2>{0.67740047f, 0.195527777f},
-std::array<float,2>{0.439309955f, 0.32542941f},
-std::array<float,2>{0.879454494f, 0.557909548f},
-std::array<float,2>{0.349722266f, 0.689769328f},
-std::array<float,2>{0.772790849f, 0.454365939f},
-std::array<float,2>{0.0573596098f, 0.0774766132f},
-std::array<float,2>{0.557534277f, 0.822698951f},
-std::array<float,2>{0.298665136f, 0.912658095f},
-std::array<float,2>{0.853531003f, 0.169305176f},
-std::array<float,2>{0.0632329285f, 0.301633596f},
-std::array<float,2>{0.585348308f, 0.577051103f},
-std::array<float,2>{0.191821173f, 0.637227535f},
-std::array<float,2>{0.699198008f, 0.407890141f},
-std::array<float,2>{0.42176345f, 0.00160313398f},
-std::array<float,2>{0.972537279f, 0.791415513f},
-std::array<float,2>{0.0163237136f, 0.844014823f},
-std::array<float,2>{0.522771776f, 0.0957040489f},
-std::array<float,2>{0.329656482f, 0.489661634f},
-std::array<float,2>{0.80347985f, 0.72976613f},
-std::array<float,2>{0.480923831f, 0.526592493f},
-std::array<float,2>{0.916910887f, 0.364552051f},
-std::array<float,2>{0.156656593f, 0.222957805f},
-std::array<float,2>{0.627312481f, 0.961537778f},
-std::array<float,2>{0.407666385f, 0.895581305f},
-std::array<float,2>{0.977743268f, 0.131455868f},
-std::array<float,2>{0.200540915f, 0.277609468f},
-std::array<float,2>{0.690072894f, 0.60677439f},
-std::array<float,2>{0.0761534125f, 0.666640759f},
-std::array<float,2>{0.590185165f, 0.397483766f},
-std::array<float,2>{0.310715467f, 0.0344314724f},
-std::array<float,2>{0.849647164f, 0.771983862f},
-std::array<float,2>{0.164382562f, 0.814265728f},
-std::array<float,2>{0.635984421f, 0.0668053702f},
-std::array<float,2>{0.470783204f, 0.462960124f},
-std::array<float,2>{0.907724619f, 0.701648235f},
-std::array<float,2>{0.342489183f, 0.54864198f},
-std::array<float,2>{0.80756551f, 0.313076526f},
-std::array<float,2>{0.0289986283f, 0.192353293f},
-std::array<float,2>{0.529129863f, 0.970510125f},
-std::array<float,2>{0.279187292f, 0.788289249f},
-std::array<float,2>{0.832280397f, 0.0155817075f},
-std::array<float,2>{0.111931399f, 0.420042187f},
-std::array<float,2>{0.594159842f, 0.629467189f},
-std::array<float,2>{0.240039349f, 0.564766169f},
-std::array<float,2>{0.728295982f, 0.305328786f},
-std::array<float,2>{0.386027157f, 0.159369603f},
-std::array<float,2>{0.945684791f, 0.920286655f},
-std::array<float,2>{0.0487319119f, 0.955616355f},
-std::array<float,2>{0.550589561f, 0.232869476f},
-std::array<float,2>{0.359067529f, 0.373923957f},
-std::array<float,2>{0.779209673f, 0.521720588f},
-std::array<float,2>{0.445886493f, 0.722884178f},
-std::array<float,2>{0.887027085f, 0.493343115f},
-std::array<float,2>{0.131083891f, 0.109047726f},
-std::array<float,2>{0.682002187f, 0.853127062f},
-std::array<float,2>{0.495437235f, 0.864176273f},
-std::array<float,2>{0.926765025f, 0.120191723f},
-std::array<float,2>{0.179584682f, 0.474358529f},
-std::array<float,2>{0.65031296f, 0.747430027f},
-std::array<float,2>{0.0072019943f, 0.509005725f},
-std::array<float,2>{0.512480855f, 0.351693034f},
-std::array<float,2>{0.319096357f, 0.234612465f},
-std::array<float,2>{0.786358297f, 0.939937532f},
-std::array<float,2>{0.206958994f, 0.926368415f},
-std::array<float,2>{0.705766618f, 0.185711414f},
-std::array<float,2>{0.433009148f, 0.281854779f},
-std::array<float,2>{0.99498868f, 0.585891724f},
-std::array<float,2>{0.294587642f, 0.649792433f},
-std::array<float,2>{0.874208808f, 0.430059642f},
-std::array<float,2>{0.0797918066f, 0.0218813512f},
-std::array<float,2>{0.566724062f, 0.807752609f},
-std::array<float,2>{0.369416356f, 0.99099201f},
-std::array<float,2>{0.758831322f, 0.208115429f},
-std::array<float,2>{0.0414831527f, 0.342646301f},
-std::array<float,2>{0.534461379f, 0.546152174f},
-std::array<float,2>{0.145565897f, 0.711028457f},
-std::array<float,2>{0.665515125f, 0.448511302f},
-std::array<float,2>{0.458184987f, 0.0927907899f},
-std::array<float,2>{0.893563092f, 0.843373775f},
-std::array<float,2>{0.107794434f, 0.760859966f},
-std::array<float,2>{0.614584982f, 0.0607250966f},
-std::array<float,2>{0.262306124f, 0.390144795f},
-std::array<float,2>{0.816421092f, 0.681454122f},
-std::array<float,2>{0.398595601f, 0.623992324f},
-std::array<float,2>{0.958193481f, 0.250675768f},
-std::array<float,2>{0.227403119f, 0.152002558f},
-std::array<float,2>{0.749474108f, 0.881609142f},
-std::array<float,2>{0.422755957f, 0.958169937f},
-std::array<float,2>{0.98756814f, 0.22757411f},
-std::array<float,2>{0.218562484f, 0.369286358f},
-std::array<float,2>{0.716639221f, 0.517735779f},
-std::array<float,2>{0.0915924832f, 0.719272614f},
-std::array<float,2>{0.575662732f, 0.498450458f},
-std::array<float,2>{0.283633798f, 0.101739906f},
-std::array<float,2>{0.859895289f, 0.856036186f},
-std::array<float,2>{0.183792323f, 0.783908248f},
-std::array<float,2>{0.64742887f, 0.011122942f},
-std::array<float,2>{0.48613891f, 0.415361434f},
-std::array<float,2>{0.934663892f, 0.625485241f},
-std::array<float,2>{0.327277631f, 0.568789661f},
-std::array<float,2>{0.793663681f, 0.309494883f},
-std::array<float,2>{0.0104654385f, 0.163521513f},
-std::array<float,2>{0.50393945f, 0.916542172f},
-std::array<float,2>{0.256422579f, 0.817123353f},
-std::array<float,2>{0.826282978f, 0.0640641376f},
-std::array<float,2>{0.0996698141f, 0.468221068f},
-std::array<float,2>{0.620238662f, 0.697572351f},
-std::array<float,2>{0.222094268f, 0.553353071f},
-std::array<float,2>{0.736442387f, 0.316888422f},
-std::array<float,2>{0.397114575f, 0.188775331f},
-std::array<float,2>{0.966202736f, 0.973307073f},
-std::array<float,2>{0.0343887694f, 0.89179641f},
-std::array<float,2>{0.546729505f, 0.128367424f},
-std::array<float,2>{0.361616641f, 0.276730955f},
-std::array<float,2>{0.75430584f, 0.60214138f},
-std::array<float,2>{0.462980866f, 0.67051363f},
-std::array<float,2>{0.903918982f, 0.394112736f},
-std::array<float,2>{0.151264697f, 0.03587595f},
-std::array<float,2>{0.661161244f, 0.768803f},
-std::array<float,2>{0.477185309f, 0.762320042f},
-std::array<float,2>{0.919942975f, 0.0548349917f},
-std::array<float,2>{0.163729697f, 0.384945214f},
-std::array<float,2>{0.631133854f, 0.684529066f},
-std::array<float,2>{0.0225389656f, 0.619913399f},
-std::array<float,2>{0.515663505f, 0.254392952f},
-std::array<float,2>{0.335107863f, 0.154285207f},
-std::array<float,2>{0.799188256f, 0.877835751f},
-std::array<float,2>{0.188174948f, 0.984727621f},
-std::array<float,2>{0.70220381f, 0.206366181f},
-std::array<float,2>{0.414838642f, 0.339450508f},
-std::array<float,2>{0.975027204f, 0.540696323f},
-std::array<float,2>{0.304510564f, 0.715648353f},
-std::array<float,2>{0.856071293f, 0.451906443f},
-std::array<float,2>{0.0693021268f, 0.0870202109f},
-std::array<float,2>{0.580035686f, 0.83790642f},
-std::array<float,2>{0.344186962f, 0.922846794f},
-std::array<float,2>{0.766025782f, 0.183482036f},
-std::array<float,2>{0.0613018088f, 0.28638491f},
-std::array<float,2>{0.561996043f, 0.580653965f},
-std::array<float,2>{0.135979176f, 0.6551283f},
-std::array<float,2>{0.674048603f, 0.435007095f},
-std::array<float,2>{0.442898601f, 0.0172423273f},
-std::array<float,2>{0.876647949f, 0.811651886f},
-std::array<float,2>{0.120384008f, 0.863082767f},
-std::array<float,2>{0.606668234f, 0.122078568f},
-std::array<float,2>{0.267932445f, 0.470067263f},
-std::array<float,2>{0.836318552f, 0.744949639f},
-std::array<float,2>{0.377183557f, 0.514831007f},
-std::array<float,2>{0.944880068f, 0.356775463f},
-std::array<float,2>{0.24574028f, 0.241277531f},
-std::array<float,2>{0.722629189f, 0.941985428f},
-std::array<float,2>{0.451627135f, 0.886799991f},
-std::array<float,2>{0.886548281f, 0.144499272f},
-std::array<float,2>{0.127335161f, 0.258245319f},
-std::array<float,2>{0.687487304f, 0.614722073f},
-std::array<float,2>{0.0540847518f, 0.674479246f},
-std::array<float,2>{0.551615298f, 0.379294246f},
-std::array<float,2>{0.354962409f, 0.0541283116f},
-std::array<float,2>{0.777072608f, 0.754409909f},
-std::array<float,2>{0.234576508f, 0.828736842f},
-std::array<float,2>{0.731685877f, 0.0785752684f},
-std::array<float,2>{0.387090206f, 0.44467625f},
-std::array<float,2>{0.952051818f, 0.709733129f},
-std::array<float,2>{0.274948776f, 0.536194444f},
-std::array<float,2>{0.82982105f, 0.330494404f},
-std::array<float,2>{0.115332805f, 0.212477222f},
-std::array<float,2>{0.599946558f, 0.996550798f},
-std::array<float,2>{0.336973071f, 0.801681638f},
-std::array<float,2>{0.811721087f, 0.0265077893f},
-std::array<float,2>{0.0245653354f, 0.422262907f},
-std::array<float,2>{0.527279913f, 0.64536953f},
-std::array<float,2>{0.168939427f, 0.587971091f},
-std::array<float,2>{0.638030112f, 0.290962696f},
-std::array<float,2>{0.473280966f, 0.17337358f},
-std::array<float,2>{0.913735807f, 0.934881389f},
-std::array<float,2>{0.0733256042f, 0.950212479f},
-std::array<float,2>{0.587293863f, 0.249551147f},
-std::array<float,2>{0.306805551f, 0.346110761f},
-std::array<float,2>{0.846056163f, 0.503089547f},
-std::array<float,2>{0.413775682f, 0.739085019f},
-std::array<float,2>{0.980476618f, 0.484117508f},
-std::array<float,2>{0.197811365f, 0.115243904f},
-std::array<float,2>{0.69415766f, 0.867366612f},
-std::array<float,2>{0.402389526f, 0.851147473f},
-std::array<float,2>{0.953223228f, 0.0981796533f},
-std::array<float,2>{0.234250411f, 0.486404598f},
-std::array<float,2>{0.743280828f, 0.733622611f},
-std::array<float,2>{0.102060728f, 0.53119874f},
-std::array<float,2>{0.609413147f, 0.359841228f},
-std::array<float,2>{0.260462552f, 0.22136949f},
-std::array<float,2>{0.813933015f, 0.967596829f},
-std::array<float,2>{0.142571509f, 0.90628773f},
-std::array<float,2>{0.670669138f, 0.166257218f},
-std::array<float,2>{0.453657657f, 0.29753387f},
-std::array<float,2>{0.898097634f, 0.573521495f},
-std::array<float,2>{0.372047544f, 0.635929286f},
-std::array<float,2>{0.765173078f, 0.411564529f},
-std::array<float,2>{0.0444557406f, 0.00514579332f},
-std::array<float,2>{0.536662996f, 0.79448396f},
-std::array<float,2>{0.290498614f, 0.982390821f},
-std::array<float,2>{0.869632304f, 0.202361971f},
-std::array<float,2>{0.0859308764f, 0.322684467f},
-std::array<float,2>{0.566169977f, 0.560544729f},
-std::array<float,2>{0.208338082f, 0.692788303f},
-std::array<float,2>{0.70704484f, 0.458707273f},
-std::array<float,2>{0.436696559f, 0.0719162822f},
-std::array<float,2>{0.997923076f, 0.826481998f},
-std::array<float,2>{0.000527336786f, 0.773603797f},
-std::array<float,2>{0.509468019f, 0.0460971482f},
-std::array<float,2>{0.313786656f, 0.400466681f},
-std::array<float,2>{0.784733653f, 0.662050188f},
-std::array<float,2>{0.498055637f, 0.59842062f},
-std::array<float,2>{0.922800004f, 0.266284496f},
-std::array<float,2>{0.174235806f, 0.135744527f},
-std::array<float,2>{0.655323267f, 0.899554074f},
-std::array<float,2>{0.490139097f, 0.99456048f},
-std::array<float,2>{0.933548391f, 0.217909411f},
-std::array<float,2>{0.18161805f, 0.335313529f},
-std::array<float,2>{0.643982828f, 0.533047438f},
-std::array<float,2>{0.0134987449f, 0.705675125f},
-std::array<float,2>{0.502332151f, 0.43807897f},
-std::array<float,2>{0.32092154f, 0.085239321f},
-std::array<float,2>{0.790665805f, 0.832263291f},
-std::array<float,2>{0.212353706f, 0.751548052f},
-std::array<float,2>{0.713637114f, 0.047945857f},
-std::array<float,2>{0.429659516f, 0.376158953f},
-std::array<float,2>{0.988912582f, 0.676215768f},
-std::array<float,2>{0.288724631f, 0.613126636f},
-std::array<float,2>{0.865679681f, 0.265108675f},
-std::array<float,2>{0.0895076096f, 0.148200855f},
-std::array<float,2>{0.572614551f, 0.884814918f},
-std::array<float,2>{0.365438074f, 0.874056101f},
-std::array<float,2>{0.750971317f, 0.11164698f},
-std::array<float,2>{0.0367133915f, 0.478761345f},
-std::array<float,2>{0.540589035f, 0.735912025f},
-std::array<float,2>{0.15413551f, 0.507492661f},
-std::array<float,2>{0.660034657f, 0.351472169f},
-std::array<float,2>{0.466199428f, 0.24523735f},
-std::array<float,2>{0.902245224f, 0.947043777f},
-std::array<float,2>{0.0957536548f, 0.930700839f},
-std::array<float,2>{0.621206939f, 0.178236365f},
-std::array<float,2>{0.250282884f, 0.294126034f},
-std::array<float,2>{0.822692931f, 0.593267143f},
-std::array<float,2>{0.392804086f, 0.643048942f},
-std::array<float,2>{0.962732315f, 0.428885549f},
-std::array<float,2>{0.223809093f, 0.0294032469f},
-std::array<float,2>{0.738382339f, 0.799484253f},
-std::array<float,2>{0.418594927f, 0.790746987f},
-std::array<float,2>{0.970261276f, 0.00239570765f},
-std::array<float,2>{0.1944267f, 0.409239888f},
-std::array<float,2>{0.696188569f, 0.639578581f},
-std::array<float,2>{0.0650653839f, 0.575166941f},
-std::array<float,2>{0.582887948f, 0.304579198f},
-std::array<float,2>{0.299938351f, 0.170723796f},
-std::array<float,2>{0.852168322f, 0.910233915f},
-std::array<float,2>{0.159964681f, 0.962934732f},
-std::array<float,2>{0.626924872f, 0.22581096f},
-std::array<float,2>{0.484012783f, 0.36670807f},
-std::array<float,2>{0.914329648f, 0.524850309f},
-std::array<float,2>{0.331627965f, 0.726841688f},
-std::array<float,2>{0.801366031f, 0.490513295f},
-std::array<float,2>{0.019050613f, 0.0944378525f},
-std::array<float,2>{0.5206604f, 0.846262634f},
-std::array<float,2>{0.272686273f, 0.904687285f},
-std::array<float,2>{0.843675852f, 0.137764037f},
-std::array<float,2>{0.121768631f, 0.273411185f},
-std::array<float,2>{0.604515016f, 0.595113456f},
-std::array<float,2>{0.248060063f, 0.659867585f},
-std::array<float,2>{0.724323571f, 0.405583411f},
-std::array<float,2>{0.382169098f, 0.0425420776f},
-std::array<float,2>{0.939337671f, 0.780881524f},
-std::array<float,2>{0.0564063303f, 0.822030962f},
-std::array<float,2>{0.556182802f, 0.0747190341f},
-std::array<float,2>{0.348051816f, 0.455572605f},
-std::array<float,2>{0.770639002f, 0.689169705f},
-std::array<float,2>{0.441150606f, 0.555636346f},
-std::array<float,2>{0.881692529f, 0.326226056f},
-std::array<float,2>{0.13753359f, 0.198903799f},
-std::array<float,2>{0.67806077f, 0.977274001f},
-std::array<float,2>{0.38448897f, 0.919128239f},
-std::array<float,2>{0.947855353f, 0.157601729f},
-std::array<float,2>{0.240235671f, 0.307774067f},
-std::array<float,2>{0.729921222f, 0.562957406f},
-std::array<float,2>{0.110135727f, 0.631484151f},
-std::array<float,2>{0.595858216f, 0.419708788f},
-std::array<float,2>{0.28091976f, 0.0120665459f},
-std::array<float,2>{0.834088206f, 0.785543799f},
-std::array<float,2>{0.129948288f, 0.8539325f},
-std::array<float,2>{0.680773079f, 0.106467932f},
-std::array<float,2>{0.447340667f, 0.495054841f},
-std::array<float,2>{0.888679206f, 0.725578308f},
-std::array<float,2>{0.356067926f, 0.520247877f},
-std::array<float,2>{0.780173421f, 0.371956915f},
-std::array<float,2>{0.0502057038f, 0.230914503f},
-std::array<float,2>{0.54701823f, 0.954392731f},
-std::array<float,2>{0.309651345f, 0.769675672f},
-std::array<float,2>{0.847927094f, 0.0322535522f},
-std::array<float,2>{0.0772352219f, 0.395079702f},
-std::array<float,2>{0.592826903f, 0.665673375f},
-std::array<float,2>{0.202036127f, 0.608075321f},
-std::array<float,2>{0.688375294f, 0.280586272f},
-std::array<float,2>{0.410124153f, 0.129237637f},
-std::array<float,2>{0.979090571f, 0.897600293f},
-std::array<float,2>{0.0298915878f, 0.972428322f},
-std::array<float,2>{0.530728042f, 0.193360388f},
-std::array<float,2>{0.340224266f, 0.314589739f},
-std::array<float,2>{0.805348516f, 0.549651384f},
-std::array<float,2>{0.468785077f, 0.701061606f},
-std::array<float,2>{0.90967387f, 0.461017042f},
-std::array<float,2>{0.166362882f, 0.0701109841f},
-std::array<float,2>{0.634619474f, 0.816164136f},
-std::array<float,2>{0.459730119f, 0.841040432f},
-std::array<float,2>{0.892048359f, 0.0914910212f},
-std::array<float,2>{0.147722289f, 0.445791543f},
-std::array<float,2>{0.667029858f, 0.71375823f},
-std::array<float,2>{0.0402565524f, 0.543030143f},
-std::array<float,2>{0.532670975f, 0.340274602f},
-std::array<float,2>{0.367570013f, 0.210115626f},
-std::array<float,2>{0.760210156f, 0.989431441f},
-std::array<float,2>{0.229973972f, 0.878970861f},
-std::array<float,2>{0.746647894f, 0.14957194f},
-std::array<float,2>{0.401712626f, 0.253504932f},
-std::array<float,2>{0.959116757f, 0.62202841f},
-std::array<float,2>{0.265455186f, 0.68342638f},
-std::array<float,2>{0.818666101f, 0.387185991f},
-std::array<float,2>{0.107131504f, 0.058861509f},
-std::array<float,2>{0.616906941f, 0.758961797f},
-std::array<float,2>{0.318138599f, 0.938656151f},
-std::array<float,2>{0.788540125f, 0.237293616f},
-std::array<float,2>{0.00481688092f, 0.353895605f},
-std::array<float,2>{0.514349639f, 0.510921419f},
-std::array<float,2>{0.177093953f, 0.749435604f},
-std::array<float,2>{0.650769413f, 0.474905133f},
-std::array<float,2>{0.492241651f, 0.118296705f},
-std::array<float,2>{0.928739011f, 0.866088748f},
-std::array<float,2>{0.0805167779f, 0.806191921f},
-std::array<float,2>{0.569151342f, 0.0209434293f},
-std::array<float,2>{0.296130538f, 0.433513582f},
-std::array<float,2>{0.87168318f, 0.650917113f},
-std::array<float,2>{0.429922849f, 0.582372844f},
-std::array<float,2>{0.992189944f, 0.283335328f},
-std::array<float,2>{0.203528076f, 0.183613628f},
-std::array<float,2>{0.70393157f, 0.929081917f},
-std::array<float,2>{0.415364534f, 0.986379147f},
-std::array<float,2>{0.9761585f, 0.203964621f},
-std::array<float,2>{0.188662544f, 0.336309195f},
-std::array<float,2>{0.701265275f, 0.542944491f},
-std::array<float,2>{0.0695374236f, 0.718611777f},
-std::array<float,2>{0.578968942f, 0.449462682f},
-std::array<float,2>{0.303203225f, 0.0895733014f},
-std::array<float,2>{0.857088447f, 0.836840212f},
-std::array<float,2>{0.162232563f, 0.76463902f},
-std::array<float,2>{0.632306576f, 0.0568102635f},
-std::array<float,2>{0.477794439f, 0.383298874f},
-std::array<float,2>{0.921821952f, 0.687417567f},
-std::array<float,2>{0.334799975f, 0.6176278f},
-std::array<float,2>{0.800546348f, 0.257519603f},
-std::array<float,2>{0.0222927164f, 0.154489577f},
-std::array<float,2>{0.517281353f, 0.875131786f},
-std::array<float,2>{0.269530237f, 0.859751463f},
-std::array<float,2>{0.837058365f, 0.123581164f},
-std::array<float,2>{0.11988496f, 0.471236646f},
-std::array<float,2>{0.60620451f, 0.743066549f},
-std::array<float,2>{0.24450247f, 0.512611866f},
-std::array<float,2>{0.720922947f, 0.358467072f},
-std::array<float,2>{0.378163457f, 0.240153566f},
-std::array<float,2>{0.94372642f, 0.944681466f},
-std::array<float,2>{0.0617298707f, 0.92397511f},
-std::array<float,2>{0.560637712f, 0.181553394f},
-std::array<float,2>{0.34553656f, 0.288614839f},
-std::array<float,2>{0.766979039f, 0.579905272f},
-std::array<float,2>{0.441641569f, 0.653071523f},
-std::array<float,2>{0.875515401f, 0.43641296f},
-std::array<float,2>{0.134847f, 0.0178861134f},
-std::array<float,2>{0.67563194f, 0.810432732f},
-std::array<float,2>{0.484870493f, 0.78167206f},
-std::array<float,2>{0.934539437f, 0.00824739505f},
-std::array<float,2>{0.185057804f, 0.416809589f},
-std::array<float,2>{0.648257732f, 0.627686679f},
-std::array<float,2>{0.0108561311f, 0.566782773f},
-std::array<float,2>{0.505153716f, 0.311754555f},
-std::array<float,2>{0.326308221f, 0.160304502f},
-std::array<float,2>{0.794669569f, 0.91599381f},
-std::array<float,2>{0.217425138f, 0.960857213f},
-std::array<float,2>{0.714961052f, 0.22987631f},
-std::array<float,2>{0.42353183f, 0.36911121f},
-std::array<float,2>{0.987286508f, 0.516837358f},
-std::array<float,2>{0.28495723f, 0.721966386f},
-std::array<float,2>{0.86058718f, 0.496653348f},
-std::array<float,2>{0.090730302f, 0.10360413f},
-std::array<float,2>{0.574241996f, 0.857838809f},
-std::array<float,2>{0.363016129f, 0.893478572f},
-std::array<float,2>{0.75583452f, 0.126229391f},
-std::array<float,2>{0.0341017544f, 0.274552077f},
-std::array<float,2>{0.545586467f, 0.605151594f},
-std::array<float,2>{0.151745543f, 0.668832541f},
-std::array<float,2>{0.660209298f, 0.391941816f},
-std::array<float,2>{0.464043438f, 0.037320938f},
-std::array<float,2>{0.903256893f, 0.766131878f},
-std::array<float,2>{0.100998394f, 0.819188237f},
-std::array<float,2>{0.61957252f, 0.0651598573f},
-std::array<float,2>{0.257789016f, 0.465973794f},
-std::array<float,2>{0.827963173f, 0.695582211f},
-std::array<float,2>{0.398384064f, 0.550967515f},
-std::array<float,2>{0.965500951f, 0.319110125f},
-std::array<float,2>{0.220779508f, 0.190758541f},
-std::array<float,2>{0.737590909f, 0.976304531f},
-std::array<float,2>{0.455067724f, 0.908585846f},
-std::array<float,2>{0.896643043f, 0.165490896f},
-std::array<float,2>{0.140816689f, 0.300591856f},
-std::array<float,2>{0.671524763f, 0.571177781f},
-std::array<float,2>{0.0439170897f, 0.633932948f},
-std::array<float,2>{0.535614908f, 0.412267447f},
-std::array<float,2>{0.372794092f, 0.00644095475f},
-std::array<float,2>{0.764167547f, 0.79560864f},
-std::array<float,2>{0.23266983f, 0.848019779f},
-std::array<float,2>{0.743004024f, 0.100160643f},
-std::array<float,2>{0.403923213f, 0.484811425f},
-std::array<float,2>{0.954751074f, 0.730760396f},
-std::array<float,2>{0.261105359f, 0.528720677f},
-std::array<float,2>{0.813332796f, 0.362830907f},
-std::array<float,2>{0.103308946f, 0.220074803f},
-std::array<float,2>{0.610665262f, 0.966330826f},
-std::array<float,2>{0.313270837f, 0.775649488f},
-std::array<float,2>{0.783288538f, 0.0430246294f},
-std::array<float,2>{0.0011633574f, 0.398493052f},
-std::array<float,2>{0.50796628f, 0.663137078f},
-std::array<float,2>{0.174828991f, 0.599742055f},
-std::array<float,2>{0.654636443f, 0.268454999f},
-std::array<float,2>{0.499883711f, 0.133218333f},
-std::array<float,2>{0.923616946f, 0.901228189f},
-std::array<float,2>{0.0848128945f, 0.983435333f},
-std::array<float,2>{0.565203488f, 0.199424684f},
-std::array<float,2>{0.289142132f, 0.321757287f},
-std::array<float,2>{0.870355487f, 0.561894655f},
-std::array<float,2>{0.436266243f, 0.694544137f},
-std::array<float,2>{0.996707559f, 0.458993614f},
-std::array<float,2>{0.207355425f, 0.0730004162f},
-std::array<float,2>{0.708650529f, 0.825721264f},
-std::array<float,2>{0.388539553f, 0.830194652f},
-std::array<float,2>{0.953095376f, 0.0813787952f},
-std::array<float,2>{0.236026123f, 0.441829264f},
-std::array<float,2>{0.730787277f, 0.70796746f},
-std::array<float,2>{0.11672204f, 0.53886497f},
-std::array<float,2>{0.600666881f, 0.329850346f},
-std::array<float,2>{0.273667723f, 0.214429885f},
-std::array<float,2>{0.829067528f, 0.999008179f},
-std::array<float,2>{0.128022194f, 0.889621854f},
-std::array<float,2>{0.686230659f, 0.140980512f},
-std::array<float,2>{0.452986419f, 0.259802669f},
-std::array<float,2>{0.884867609f, 0.615716279f},
-std::array<float,2>{0.354238927f, 0.67286104f},
-std::array<float,2>{0.775421977f, 0.38136366f},
-std::array<float,2>{0.0531393252f, 0.0520177521f},
-std::array<float,2>{0.552345395f, 0.756540954f},
-std::array<float,2>{0.308102787f, 0.952051878f},
-std::array<float,2>{0.847648501f, 0.247353151f},
-std::array<float,2>{0.073091507f, 0.345540226f},
-std::array<float,2>{0.586398661f, 0.500528932f},
-std::array<float,2>{0.198720917f, 0.741312921f},
-std::array<float,2>{0.694942176f, 0.481910586f},
-std::array<float,2>{0.412497461f, 0.113334253f},
-std::array<float,2>{0.981986284f, 0.870305538f},
-std::array<float,2>{0.0240015779f, 0.804303646f},
-std::array<float,2>{0.525477946f, 0.0247288439f},
-std::array<float,2>{0.336073995f, 0.423983842f},
-std::array<float,2>{0.811496317f, 0.647307754f},
-std::array<float,2>{0.473727703f, 0.587130845f},
-std::array<float,2>{0.912302494f, 0.292182148f},
-std::array<float,2>{0.16896458f, 0.175715178f},
-std::array<float,2>{0.636757672f, 0.937031448f},
-std::array<float,2>{0.483157456f, 0.962173045f},
-std::array<float,2>{0.915207982f, 0.223999247f},
-std::array<float,2>{0.158611163f, 0.363573879f},
-std::array<float,2>{0.625465989f, 0.525585532f},
-std::array<float,2>{0.0177482683f, 0.729319513f},
-std::array<float,2>{0.519958973f, 0.488474607f},
-std::array<float,2>{0.330325544f, 0.0971448049f},
-std::array<float,2>{0.802719951f, 0.845431566f},
-std::array<float,2>{0.1935599f, 0.792037547f},
-std::array<float,2>{0.69704479f, 0.000297894556f},
-std::array<float,2>{0.419859648f, 0.406617403f},
-std::array<float,2>{0.968810081f, 0.63793999f},
-std::array<float,2>{0.299113214f, 0.57755965f},
-std::array<float,2>{0.853285432f, 0.302654028f},
-std::array<float,2>{0.065833807f, 0.168033943f},
-std::array<float,2>{0.583918631f, 0.91392231f},
-std::array<float,2>{0.349156648f, 0.824127018f},
-std::array<float,2>{0.770470202f, 0.0764486939f},
-std::array<float,2>{0.0550461598f, 0.453220814f},
-std::array<float,2>{0.554851472f, 0.690440416f},
-std::array<float,2>{0.13815771f, 0.557341754f},
-std::array<float,2>{0.679479122f, 0.32422182f},
-std::array<float,2>{0.440217435f, 0.196826935f},
-std::array<float,2>{0.882603288f, 0.97856468f},
-std::array<float,2>{0.12240351f, 0.903533161f},
-std::array<float,2>{0.603882313f, 0.139259562f},
-std::array<float,2>{0.271945447f, 0.271193832f},
-std::array<float,2>{0.842099249f, 0.596272886f},
-std::array<float,2>{0.381433249f, 0.657078326f},
-std::array<float,2>{0.938386381f, 0.402527452f},
-std::array<float,2>{0.249414459f, 0.0402162038f},
-std::array<float,2>{0.723552585f, 0.777469873f},
-std::array<float,2>{0.428574115f, 0.753317714f},
-std::array<float,2>{0.989930987f, 0.0503749624f},
-std::array<float,2>{0.211596459f, 0.378068298f},
-std::array<float,2>{0.714726806f, 0.679121077f},
-std::array<float,2>{0.0888662413f, 0.610516965f},
-std::array<float,2>{0.573472023f, 0.262408435f},
-std::array<float,2>{0.287263483f, 0.145905674f},
-std::array<float,2>{0.866251409f, 0.883925617f},
-std::array<float,2>{0.180103019f, 0.993772864f},
-std::array<float,2>{0.642829359f, 0.216775522f},
-std::array<float,2>{0.488647342f, 0.332202911f},
-std::array<float,2>{0.932028055f, 0.533765614f},
-std::array<float,2>{0.32144168f, 0.70363313f},
-std::array<float,2>{0.789988339f, 0.439569563f},
-std::array<float,2>{0.0123036783f, 0.0836902112f},
-std::array<float,2>{0.503140628f, 0.835678697f},
-std::array<float,2>{0.251305968f, 0.933408499f},
-std::array<float,2>{0.824157894f, 0.176154211f},
-std::array<float,2>{0.0976205021f, 0.295244485f},
-std::array<float,2>{0.622432232f, 0.591471314f},
-std::array<float,2>{0.223268196f, 0.640802503f},
-std::array<float,2>{0.740011752f, 0.426405579f},
-std::array<float,2>{0.39372766f, 0.0287553016f},
-std::array<float,2>{0.96170187f, 0.798333287f},
-std::array<float,2>{0.035209652f, 0.872740984f},
-std::array<float,2>{0.539748728f, 0.109810807f},
-std::array<float,2>{0.366639793f, 0.476572275f},
-std::array<float,2>{0.75102222f, 0.738274455f},
-std::array<float,2>{0.465115786f, 0.505828679f},
-std::array<float,2>{0.9010427f, 0.348513663f},
-std::array<float,2>{0.152864039f, 0.244034454f},
-std::array<float,2>{0.65851444f, 0.948194027f},
-std::array<float,2>{0.400674373f, 0.882727563f},
-std::array<float,2>{0.96016711f, 0.150841847f},
-std::array<float,2>{0.229205593f, 0.251566023f},
-std::array<float,2>{0.747751057f, 0.624757826f},
-std::array<float,2>{0.105703615f, 0.680588305f},
-std::array<float,2>{0.615272224f, 0.389184833f},
-std::array<float,2>{0.264417052f, 0.0616884641f},
-std::array<float,2>{0.820094049f, 0.759973705f},
-std::array<float,2>{0.147186413f, 0.842298329f},
-std::array<float,2>{0.666900039f, 0.0919699296f},
-std::array<float,2>{0.460031986f, 0.447267741f},
-std::array<float,2>{0.891162157f, 0.712546349f},
-std::array<float,2>{0.368994385f, 0.545067072f},
-std::array<float,2>{0.761179805f, 0.343286723f},
-std::array<float,2>{0.0393681377f, 0.207038656f},
-std::array<float,2>{0.532051027f, 0.99186641f},
-std::array<float,2>{0.295070916f, 0.806780875f},
-std::array<float,2>{0.872621238f, 0.02298107f},
-std::array<float,2>{0.0812664181f, 0.431571901f},
-std::array<float,2>{0.570091486f, 0.648619652f},
-std::array<float,2>{0.204513982f, 0.584955573f},
-std::array<float,2>{0.704238892f, 0.282269984f},
-std::array<float,2>{0.43112734f, 0.186789557f},
-std::array<float,2>{0.993553638f, 0.927285254f},
-std::array<float,2>{0.00560009619f, 0.94053334f},
-std::array<float,2>{0.51527369f, 0.235806033f},
-std::array<float,2>{0.317118049f, 0.353244394f},
-std::array<float,2>{0.787421107f, 0.508620083f},
-std::array<float,2>{0.493784755f, 0.746839762f},
-std::array<float,2>{0.928318024f, 0.473106742f},
-std::array<float,2>{0.176123872f, 0.120088838f},
-std::array<float,2>{0.652273715f, 0.864940822f},
-std::array<float,2>{0.448764652f, 0.852104545f},
-std::array<float,2>{0.890606046f, 0.107689716f},
-std::array<float,2>{0.129724488f, 0.49260959f},
-std::array<float,2>{0.68032974f, 0.723780572f},
-std::array<float,2>{0.0496436432f, 0.522835374f},
-std::array<float,2>{0.54828918f, 0.374577194f},
-std::array<float,2>{0.356561005f, 0.234086454f},
-std::array<float,2>{0.780968547f, 0.956563294f},
-std::array<float,2>{0.241503134f, 0.921214044f},
-std::array<float,2>{0.728975117f, 0.158935174f},
-std::array<float,2>{0.383428395f, 0.305950046f},
-std::array<float,2>{0.948458493f, 0.565482318f},
-std::array<float,2>{0.280018181f, 0.630573571f},
-std::array<float,2>{0.835495651f, 0.421216458f},
-std::array<float,2>{0.111283138f, 0.0139168734f},
-std::array<float,2>{0.597244918f, 0.787697971f},
-std::array<float,2>{0.340900838f, 0.969194412f},
-std::array<float,2>{0.805960357f, 0.192565024f},
-std::array<float,2>{0.0303832442f, 0.314016014f},
-std::array<float,2>{0.529925823f, 0.547014713f},
-std::array<float,2>{0.167434558f, 0.702808857f},
-std::array<float,2>{0.633453727f, 0.464712828f},
-std::array<float,2>{0.470610291f, 0.0678231865f},
-std::array<float,2>{0.908720613f, 0.812886178f},
-std::array<float,2>{0.0765159875f, 0.772833407f},
-std::array<float,2>{0.592038989f, 0.0332545899f},
-std::array<float,2>{0.309154361f, 0.397458345f},
-std::array<float,2>{0.849262059f, 0.667440295f},
-std::array<float,2>{0.408356279f, 0.605995476f},
-std::array<float,2>{0.980450094f, 0.278657198f},
-std::array<float,2>{0.203045562f, 0.132103249f},
-std::array<float,2>{0.688923955f, 0.894973814f},
-std::array<float,2>{0.376923144f, 0.942736804f},
-std::array<float,2>{0.942299545f, 0.241018578f},
-std::array<float,2>{0.242590547f, 0.356035799f},
-std::array<float,2>{0.720003664f, 0.514362216f},
-std::array<float,2>{0.118455373f, 0.745784461f},
-std::array<float,2>{0.609104931f, 0.469153374f},
-std::array<float,2>{0.26571098f, 0.121425912f},
-std::array<float,2>{0.83923471f, 0.861461341f},
-std::array<float,2>{0.132863522f, 0.811466813f},
-std::array<float,2>{0.673659503f, 0.0164482966f},
-std::array<float,2>{0.443896502f, 0.433799446f},
-std::array<float,2>{0.878183126f, 0.655540228f},
-std::array<float,2>{0.346813053f, 0.581650198f},
-std::array<float,2>{0.76893872f, 0.285966486f},
-std::array<float,2>{0.0586279109f, 0.182317406f},
-std::array<float,2>{0.558889925f, 0.923561454f},
-std::array<float,2>{0.302603692f, 0.839720428f},
-std::array<float,2>{0.857740223f, 0.0868283585f},
-std::array<float,2>{0.0674883351f, 0.452697098f},
-std::array<float,2>{0.580346465f, 0.716653943f},
-std::array<float,2>{0.191058025f, 0.5395751f},
-std::array<float,2>{0.700902939f, 0.338559151f},
-std::array<float,2>{0.416135758f, 0.205558285f},
-std::array<float,2>{0.972877502f, 0.986243546f},
-std::array<float,2>{0.020108711f, 0.878038228f},
-std::array<float,2>{0.517633736f, 0.152738243f},
-std::array<float,2>{0.33294788f, 0.255495399f},
-std::array<float,2>{0.798641741f, 0.620493293f},
-std::array<float,2>{0.479790866f, 0.684971929f},
-std::array<float,2>{0.918295383f, 0.386645526f},
-std::array<float,2>{0.161428556f, 0.0560789183f},
-std::array<float,2>{0.629790485f, 0.76361084f},
-std::array<float,2>{0.461640239f, 0.768363357f},
-std::array<float,2>{0.905503273f, 0.0363946669f},
-std::array<float,2>{0.15014343f, 0.393469691f},
-std::array<float,2>{0.662241399f, 0.670994461f},
-std::array<float,2>{0.0314979292f, 0.603415608f},
-std::array<float,2>{0.544646323f, 0.275895268f},
-std::array<float,2>{0.360001206f, 0.127699792f},
-std::array<float,2>{0.757575214f, 0.89068836f},
-std::array<float,2>{0.220418215f, 0.97388792f},
-std::array<float,2>{0.736193419f, 0.187573224f},
-std::array<float,2>{0.394853711f, 0.318044811f},
-std::array<float,2>{0.96702987f, 0.554118097f},
-std::array<float,2>{0.254864931f, 0.699216962f},
-std::array<float,2>{0.825336218f, 0.466875374f},
-std::array<float,2>{0.0990613475f, 0.0630308762f},
-std::array<float,2>{0.617966056f, 0.818238735f},
-std::array<float,2>{0.324535072f, 0.917832494f},
-std::array<float,2>{0.795699954f, 0.162469774f},
-std::array<float,2>{0.0080642337f, 0.310499847f},
-std::array<float,2>{0.506283224f, 0.569506586f},
-std::array<float,2>{0.187379599f, 0.626323998f},
-std::array<float,2>{0.645014167f, 0.41435957f},
-std::array<float,2>{0.488247722f, 0.00988846086f},
-std::array<float,2>{0.936452925f, 0.78513509f},
-std::array<float,2>{0.0922430083f, 0.856904745f},
-std::array<float,2>{0.578078508f, 0.102991767f},
-std::array<float,2>{0.282227188f, 0.499674588f},
-std::array<float,2>{0.862779498f, 0.720544219f},
-std::array<float,2>{0.424099803f, 0.518572569f},
-std::array<float,2>{0.985685289f, 0.370667219f},
-std::array<float,2>{0.216405407f, 0.226839215f},
-std::array<float,2>{0.717646897f, 0.957061887f},
-std::array<float,2>{0.496284395f, 0.899085641f},
-std::array<float,2>{0.924699366f, 0.135161757f},
-std::array<float,2>{0.172625154f, 0.266787529f},
-std::array<float,2>{0.653128982f, 0.598877788f},
-std::array<float,2>{0.00243066787f, 0.660935938f},
-std::array<float,2>{0.51005286f, 0.401608288f},
-std::array<float,2>{0.31558004f, 0.0454110615f},
-std::array<float,2>{0.782001793f, 0.774726629f},
-std::array<float,2>{0.210386127f, 0.828057826f},
-std::array<float,2>{0.709098697f, 0.0709588677f},
-std::array<float,2>{0.434076816f, 0.457910299f},
-std::array<float,2>{0.998892725f, 0.691537917f},
-std::array<float,2>{0.29277119f, 0.559533656f},
-std::array<float,2>{0.867445469f, 0.324173898f},
-std::array<float,2>{0.0837729201f, 0.201462612f},
-std::array<float,2>{0.562971294f, 0.980596364f},
-std::array<float,2>{0.37470144f, 0.79360497f},
-std::array<float,2>{0.761832654f, 0.00417244062f},
-std::array<float,2>{0.0455169566f, 0.410318434f},
-std::array<float,2>{0.537646174f, 0.634948611f},
-std::array<float,2>{0.144193158f, 0.572309554f},
-std::array<float,2>{0.668144822f, 0.298553526f},
-std::array<float,2>{0.456852794f, 0.167795897f},
-std::array<float,2>{0.895630717f, 0.908130765f},
-std::array<float,2>{0.104647554f, 0.968104482f},
-std::array<float,2>{0.613063216f, 0.222448632f},
-std::array<float,2>{0.258581251f, 0.36124751f},
-std::array<float,2>{0.816233397f, 0.529348314f},
-std::array<float,2>{0.405501842f, 0.732459307f},
-std::array<float,2>{0.956376553f, 0.487901509f},
-std::array<float,2>{0.230517432f, 0.0992848501f},
-std::array<float,2>{0.745741963f, 0.850203693f},
-std::array<float,2>{0.411603153f, 0.869012237f},
-std::array<float,2>{0.984339833f, 0.116451181f},
-std::array<float,2>{0.195314825f, 0.483129054f},
-std::array<float,2>{0.691719294f, 0.740095615f},
-std::array<float,2>{0.0718123466f, 0.502078235f},
-std::array<float,2>{0.589435458f, 0.346755564f},
-std::array<float,2>{0.306261212f, 0.248978525f},
-std::array<float,2>{0.844868302f, 0.949475229f},
-std::array<float,2>{0.170027941f, 0.934217036f},
-std::array<float,2>{0.640436947f, 0.172503188f},
-std::array<float,2>{0.475648612f, 0.289733499f},
-std::array<float,2>{0.910798252f, 0.589757383f},
-std::array<float,2>{0.339819551f, 0.64577812f},
-std::array<float,2>{0.808736622f, 0.42291531f},
-std::array<float,2>{0.0262497719f, 0.025751343f},
-std::array<float,2>{0.524558842f, 0.802493691f},
-std::array<float,2>{0.27630204f, 0.997653544f},
-std::array<float,2>{0.83094418f, 0.211303815f},
-std::array<float,2>{0.113676861f, 0.331403583f},
-std::array<float,2>{0.598834634f, 0.535410643f},
-std::array<float,2>{0.237411022f, 0.71089536f},
-std::array<float,2>{0.733445823f, 0.443569392f},
-std::array<float,2>{0.39056614f, 0.0794634894f},
-std::array<float,2>{0.949489474f, 0.829332948f},
-std::array<float,2>{0.0526875518f, 0.755124509f},
-std::array<float,2>{0.553673506f, 0.053228613f},
-std::array<float,2>{0.353079826f, 0.380314529f},
-std::array<float,2>{0.77402091f, 0.675551414f},
-std::array<float,2>{0.451008707f, 0.613879204f},
-std::array<float,2>{0.884530306f, 0.259323478f},
-std::array<float,2>{0.125817209f, 0.143203974f},
-std::array<float,2>{0.683764279f, 0.887826741f},
-std::array<float,2>{0.438326061f, 0.977738023f},
-std::array<float,2>{0.880446076f, 0.198148385f},
-std::array<float,2>{0.139185324f, 0.327269524f},
-std::array<float,2>{0.675849855f, 0.555691481f},
-std::array<float,2>{0.0580830835f, 0.687754393f},
-std::array<float,2>{0.557684004f, 0.456836969f},
-std::array<float,2>{0.351368219f, 0.0755759776f},
-std::array<float,2>{0.771754503f, 0.82054472f},
-std::array<float,2>{0.24742718f, 0.780239344f},
-std::array<float,2>{0.725001574f, 0.0419372767f},
-std::array<float,2>{0.379305512f, 0.404510766f},
-std::array<float,2>{0.940311968f, 0.658306062f},
-std::array<float,2>{0.270894706f, 0.59408468f},
-std::array<float,2>{0.840836108f, 0.271670908f},
-std::array<float,2>{0.124996945f, 0.137678072f},
-std::array<float,2>{0.602960169f, 0.905800104f},
-std::array<float,2>{0.328951627f, 0.847394288f},
-std::array<float,2>{0.804101825f, 0.0954532549f},
-std::array<float,2>{0.0168925226f, 0.492017478f},
-std::array<float,2>{0.521736264f, 0.727809191f},
-std::array<float,2>{0.157803938f, 0.523634315f},
-std::array<float,2>{0.628023446f, 0.366132855f},
-std::array<float,2>{0.481716067f, 0.225295857f},
-std::array<float,2>{0.917723715f, 0.963995516f},
-std::array<float,2>{0.0643495992f, 0.911215365f},
-std::array<float,2>{0.584741056f, 0.171127543f},
-std::array<float,2>{0.297197431f, 0.303215951f},
-std::array<float,2>{0.85458535f, 0.575556636f},
-std::array<float,2>{0.420667648f, 0.640341341f},
-std::array<float,2>{0.971233368f, 0.408288062f},
-std::array<float,2>{0.192944944f, 0.0032499074f},
-std::array<float,2>{0.697644949f, 0.789751112f},
-std::array<float,2>{0.391684383f, 0.799899161f},
-std::array<float,2>{0.964572728f, 0.0309318174f},
-std::array<float,2>{0.225609839f, 0.428450346f},
-std::array<float,2>{0.740663528f, 0.644487917f},
-std::array<float,2>{0.0943342373f, 0.592073858f},
-std::array<float,2>{0.624260724f, 0.293384671f},
-std::array<float,2>{0.252685368f, 0.178751782f},
-std::array<float,2>{0.820344985f, 0.93044734f},
-std::array<float,2>{0.154984981f, 0.945541263f},
-std::array<float,2>{0.656457663f, 0.244505391f},
-std::array<float,2>{0.468064189f, 0.350273103f},
-std::array<float,2>{0.900131702f, 0.505992413f},
-std::array<float,2>{0.3640019f, 0.734968543f},
-std::array<float,2>{0.753602862f, 0.479942083f},
-std::array<float,2>{0.0388552397f, 0.112633035f},
-std::array<float,2>{0.54172647f, 0.873205423f},
-std::array<float,2>{0.285915732f, 0.886038959f},
-std::array<float,2>{0.863977909f, 0.146935955f},
-std::array<float,2>{0.0865426362f, 0.263893604f},
-std::array<float,2>{0.57032299f, 0.611813486f},
-std::array<float,2>{0.214008495f, 0.677236736f},
-std::array<float,2>{0.711578429f, 0.375471205f},
-std::array<float,2>{0.427648365f, 0.0474771224f},
-std::array<float,2>{0.990300655f, 0.750409842f},
-std::array<float,2>{0.014509079f, 0.833086789f},
-std::array<float,2>{0.500741482f, 0.0841534212f},
-std::array<float,2>{0.323024303f, 0.438763887f},
-std::array<float,2>{0.791167915f, 0.70657593f},
-std::array<float,2>{0.490532219f, 0.531988561f},
-std::array<float,2>{0.931461692f, 0.334777802f},
-std::array<float,2>{0.181767792f, 0.217225343f},
-std::array<float,2>{0.641404152f, 0.995269418f},
-std::array<float,2>{0.432444811f, 0.928452313f},
-std::array<float,2>{0.995878458f, 0.184618533f},
-std::array<float,2>{0.205273658f, 0.284539551f},
-std::array<float,2>{0.706631303f, 0.583624661f},
-std::array<float,2>{0.0782403946f, 0.651905239f},
-std::array<float,2>{0.56805855f, 0.432610989f},
-std::array<float,2>{0.293520182f, 0.0203987099f},
-std::array<float,2>{0.873176754f, 0.80520159f},
-std::array<float,2>{0.178315461f, 0.866382301f},
-std::array<float,2>{0.648861468f, 0.117423683f},
-std::array<float,2>{0.494369298f, 0.475800812f},
-std::array<float,2>{0.926265001f, 0.748477221f},
-std::array<float,2>{0.319657326f, 0.50993377f},
-std::array<float,2>{0.78556329f, 0.355033398f},
-std::array<float,2>{0.00632510288f, 0.237832338f},
-std::array<float,2>{0.51315397f, 0.937567711f},
-std::array<float,2>{0.263196319f, 0.75865227f},
-std::array<float,2>{0.818133354f, 0.0602998734f},
-std::array<float,2>{0.108691417f, 0.388308436f},
-std::array<float,2>{0.61360389f, 0.681892157f},
-std::array<float,2>{0.227867737f, 0.62268424f},
-std::array<float,2>{0.748057544f, 0.252842695f},
-std::array<float,2>{0.400099099f, 0.148824111f},
-std::array<float,2>{0.957208574f, 0.879987657f},
-std::array<float,2>{0.0429443456f, 0.989014328f},
-std::array<float,2>{0.533709884f, 0.209775656f},
-std::array<float,2>{0.370676279f, 0.341250718f},
-std::array<float,2>{0.758402228f, 0.544204712f},
-std::array<float,2>{0.457828194f, 0.714745402f},
-std::array<float,2>{0.89327085f, 0.446573585f},
-std::array<float,2>{0.144792557f, 0.09018296f},
-std::array<float,2>{0.664766312f, 0.84070158f},
-std::array<float,2>{0.472328454f, 0.814870775f},
-std::array<float,2>{0.90687722f, 0.0686309785f},
-std::array<float,2>{0.165923789f, 0.462722868f},
-std::array<float,2>{0.63496393f, 0.699221075f},
-std::array<float,2>{0.0281101204f, 0.549830198f},
-std::array<float,2>{0.528126478f, 0.315454483f},
-std::array<float,2>{0.342968762f, 0.194570199f},
-std::array<float,2>{0.808289111f, 0.970744967f},
-std::array<float,2>{0.200170204f, 0.897199571f},
-std::array<float,2>{0.690840006f, 0.130300596f},
-std::array<float,2>{0.406326383f, 0.279758662f},
-std::array<float,2>{0.977293849f, 0.60899359f},
-std::array<float,2>{0.312438458f, 0.664699972f},
-std::array<float,2>{0.85132587f, 0.39596349f},
-std::array<float,2>{0.0743947178f, 0.0318035521f},
-std::array<float,2>{0.59128654f, 0.771371841f},
-std::array<float,2>{0.35824883f, 0.953848362f},
-std::array<float,2>{0.778118253f, 0.231663302f},
-std::array<float,2>{0.0475245193f, 0.373044908f},
-std::array<float,2>{0.549347878f, 0.52085644f},
-std::array<float,2>{0.132526055f, 0.726196945f},
-std::array<float,2>{0.683100998f, 0.495458812f},
-std::array<float,2>{0.446812838f, 0.105798207f},
-std::array<float,2>{0.887927175f, 0.854698896f},
-std::array<float,2>{0.112547137f, 0.786724508f},
-std::array<float,2>{0.594856799f, 0.0131989028f},
-std::array<float,2>{0.277868658f, 0.418439269f},
-std::array<float,2>{0.833583713f, 0.631892085f},
-std::array<float,2>{0.385426849f, 0.564121246f},
-std::array<float,2>{0.946794927f, 0.306999326f},
-std::array<float,2>{0.238852948f, 0.157115504f},
-std::array<float,2>{0.727027595f, 0.918337107f},
-std::array<float,2>{0.379093796f, 0.979681075f},
-std::array<float,2>{0.94018209f, 0.195968881f},
-std::array<float,2>{0.24724336f, 0.325912803f},
-std::array<float,2>{0.724767268f, 0.55845958f},
-std::array<float,2>{0.124533691f, 0.690243244f},
-std::array<float,2>{0.602640033f, 0.454672813f},
-std::array<float,2>{0.270731091f, 0.0778018013f},
-std::array<float,2>{0.841201246f, 0.822963893f},
-std::array<float,2>{0.139613092f, 0.778963208f},
-std::array<float,2>{0.676194131f, 0.0390765853f},
-std::array<float,2>{0.438132167f, 0.403585941f},
-std::array<float,2>{0.880805075f, 0.657907546f},
-std::array<float,2>{0.351131767f, 0.597366631f},
-std::array<float,2>{0.771705091f, 0.270200998f},
-std::array<float,2>{0.0578415096f, 0.139847264f},
-std::array<float,2>{0.55793047f, 0.902379632f},
-std::array<float,2>{0.296906233f, 0.844279349f},
-std::array<float,2>{0.854864538f, 0.0965586007f},
-std::array<float,2>{0.0641662925f, 0.490087092f},
-std::array<float,2>{0.584559262f, 0.730443597f},
-std::array<float,2>{0.193205088f, 0.527267694f},
-std::array<float,2>{0.697395146f, 0.364936978f},
-std::array<float,2>{0.420602798f, 0.223621652f},
-std::array<float,2>{0.971546233f, 0.960960925f},
-std::array<float,2>{0.016765127f, 0.912295759f},
-std::array<float,2>{0.52156049f, 0.169833153f},
-std::array<float,2>{0.328652292f, 0.300916582f},
-std::array<float,2>{0.803857446f, 0.576381505f},
-std::array<float,2>{0.481651366f, 0.63702935f},
-std::array<float,2>{0.917753875f, 0.407329917f},
-std::array<float,2>{0.158021271f, 0.00126530952f},
-std::array<float,2>{0.62828964f, 0.791951478f},
-std::array<float,2>{0.467788547f, 0.797416627f},
-std::array<float,2>{0.900161147f, 0.0282259472f},
-std::array<float,2>{0.155131325f, 0.42703709f},
-std::array<float,2>{0.656592727f, 0.641720891f},
-std::array<float,2>{0.0386785045f, 0.590781271f},
-std::array<float,2>{0.54191643f, 0.29668352f},
-std::array<float,2>{0.364097714f, 0.17729564f},
-std::array<float,2>{0.753888369f, 0.931836128f},
-std::array<float,2>{0.225867063f, 0.948967159f},
-std::array<float,2>{0.740431428f, 0.242611244f},
-std::array<float,2>{0.391917408f, 0.34898898f},
-std::array<float,2>{0.964741826f, 0.504441977f},
-std::array<float,2>{0.252905309f, 0.736785293f},
-std::array<float,2>{0.820634902f, 0.477941334f},
-std::array<float,2>{0.0946522355f, 0.111180909f},
-std::array<float,2>{0.624391496f, 0.871434093f},
-std::array<float,2>{0.322781414f, 0.883313656f},
-std::array<float,2>{0.791398346f, 0.145219624f},
-std::array<float,2>{0.0141961537f, 0.263263166f},
-std::array<float,2>{0.500495672f, 0.609420359f},
-std::array<float,2>{0.182127878f, 0.678509653f},
-std::array<float,2>{0.641287148f, 0.377325535f},
-std::array<float,2>{0.490300447f, 0.0491551384f},
-std::array<float,2>{0.931211412f, 0.752874196f},
-std::array<float,2>{0.0866999552f, 0.83449167f},
-std::array<float,2>{0.570596039f, 0.0824268386f},
-std::array<float,2>{0.285777897f, 0.44116345f},
-std::array<float,2>{0.864198089f, 0.704466641f},
-std::array<float,2>{0.427411675f, 0.534410536f},
-std::array<float,2>{0.990701497f, 0.333518624f},
-std::array<float,2>{0.214195415f, 0.214952126f},
-std::array<float,2>{0.711913288f, 0.992714822f},
-std::array<float,2>{0.494459689f, 0.925936162f},
-std::array<float,2>{0.925902009f, 0.186387137f},
-std::array<float,2>{0.17869857f, 0.281307161f},
-std::array<float,2>{0.648554862f, 0.585318625f},
-std::array<float,2>{0.00608826475f, 0.650013924f},
-std::array<float,2>{0.51282382f, 0.430606008f},
-std::array<float,2>{0.319492489f, 0.0222320165f},
-std::array<float,2>{0.785197675f, 0.808538973f},
-std::array<float,2>{0.205333069f, 0.863753021f},
-std::array<float,2>{0.706873f, 0.120912164f},
-std::array<float,2>{0.432306767f, 0.473736674f},
-std::array<float,2>{0.99571383f, 0.748037159f},
-std::array<float,2>{0.293774813f, 0.509709358f},
-std::array<float,2>{0.873454273f, 0.352357566f},
-std::array<float,2>{0.0784394741f, 0.235081732f},
-std::array<float,2>{0.568259418f, 0.939984262f},
-std::array<float,2>{0.371057898f, 0.761697233f},
-std::array<float,2>{0.758593023f, 0.061224971f},
-std::array<float,2>{0.0425721146f, 0.389863044f},
-std::array<float,2>{0.534080625f, 0.680725873f},
-std::array<float,2>{0.144680098f, 0.623288929f},
-std::array<float,2>{0.664948344f, 0.250124931f},
-std::array<float,2>{0.457668662f, 0.151757449f},
-std::array<float,2>{0.893336833f, 0.881170809f},
-std::array<float,2>{0.108499423f, 0.990394771f},
-std::array<float,2>{0.613490999f, 0.208575904f},
-std::array<float,2>{0.263451815f, 0.341977686f},
-std::array<float,2>{0.817919254f, 0.546728134f},
-std::array<float,2>{0.400322646f, 0.711806893f},
-std::array<float,2>{0.957410276f, 0.448930442f},
-std::array<float,2>{0.227667183f, 0.0934670791f},
-std::array<float,2>{0.748450994f, 0.842937231f},
-std::array<float,2>{0.406616241f, 0.813665628f},
-std::array<float,2>{0.977326512f, 0.0671442598f},
-std::array<float,2>{0.199737191f, 0.46356985f},
-std::array<float,2>{0.690547049f, 0.701758385f},
-std::array<float,2>{0.0745451078f, 0.547886133f},
-std::array<float,2>{0.59105289f, 0.312840402f},
-std::array<float,2>{0.312223941f, 0.191514447f},
-std::array<float,2>{0.851231337f, 0.970140636f},
-std::array<float,2>{0.165592253f, 0.896004617f},
-std::array<float,2>{0.635074437f, 0.131275758f},
-std::array<float,2>{0.4724769f, 0.277855843f},
-std::array<float,2>{0.907079458f, 0.606970072f},
-std::array<float,2>{0.343149215f, 0.666503549f},
-std::array<float,2>{0.808566332f, 0.398038983f},
-std::array<float,2>{0.0280403923f, 0.0349402949f},
-std::array<float,2>{0.527997077f, 0.771624088f},
-std::array<float,2>{0.278159559f, 0.95547086f},
-std::array<float,2>{0.833904684f, 0.233343422f},
-std::array<float,2>{0.112719312f, 0.373083353f},
-std::array<float,2>{0.594971597f, 0.522310078f},
-std::array<float,2>{0.239235267f, 0.723329425f},
-std::array<float,2>{0.726780653f, 0.494094491f},
-std::array<float,2>{0.385676563f, 0.108404122f},
-std::array<float,2>{0.947067618f, 0.852607012f},
-std::array<float,2>{0.0476864502f, 0.788698018f},
-std::array<float,2>{0.54973954f, 0.0147247342f},
-std::array<float,2>{0.357950658f, 0.420514822f},
-std::array<float,2>{0.778024375f, 0.628971219f},
-std::array<float,2>{0.447054446f, 0.565326035f},
-std::array<float,2>{0.888053715f, 0.305054247f},
-std::array<float,2>{0.13257049f, 0.160124972f},
-std::array<float,2>{0.682618916f, 0.920862496f},
-std::array<float,2>{0.444274098f, 0.943368137f},
-std::array<float,2>{0.877935469f, 0.238514245f},
-std::array<float,2>{0.133135512f, 0.357963979f},
-std::array<float,2>{0.673406303f, 0.512957275f},
-std::array<float,2>{0.0590259321f, 0.743256271f},
-std::array<float,2>{0.558763206f, 0.472108811f},
-std::array<float,2>{0.347105503f, 0.124638326f},
-std::array<float,2>{0.768644631f, 0.86129415f},
-std::array<float,2>{0.242423043f, 0.808894277f},
-std::array<float,2>{0.719866335f, 0.0194979906f},
-std::array<float,2>{0.376684695f, 0.437136352f},
-std::array<float,2>{0.942075491f, 0.653761446f},
-std::array<float,2>{0.266008466f, 0.578795552f},
-std::array<float,2>{0.838867247f, 0.287738174f},
-std::array<float,2>{0.118258864f, 0.180073246f},
-std::array<float,2>{0.609171271f, 0.925407588f},
-std::array<float,2>{0.332710207f, 0.837832153f},
-std::array<float,2>{0.798374832f, 0.0886892825f},
-std::array<float,2>{0.0203235056f, 0.451148927f},
-std::array<float,2>{0.517993867f, 0.717049122f},
-std::array<float,2>{0.161169559f, 0.541611493f},
-std::array<float,2>{0.629599333f, 0.337841839f},
-std::array<float,2>{0.479510009f, 0.204712078f},
-std::array<float,2>{0.918207765f, 0.98738569f},
-std::array<float,2>{0.0676993653f, 0.875992835f},
-std::array<float,2>{0.580185711f, 0.15614444f},
-std::array<float,2>{0.302312702f, 0.256727278f},
-std::array<float,2>{0.857530177f, 0.618839681f},
-std::array<float,2>{0.416376442f, 0.686004579f},
-std::array<float,2>{0.973118544f, 0.383818269f},
-std::array<float,2>{0.191306233f, 0.05782561f},
-std::array<float,2>{0.701045394f, 0.765366197f},
-std::array<float,2>{0.394651502f, 0.767380595f},
-std::array<float,2>{0.967150688f, 0.0385521799f},
-std::array<float,2>{0.220640749f, 0.391216189f},
-std::array<float,2>{0.735997736f, 0.669195592f},
-std::array<float,2>{0.0987192392f, 0.603854895f},
-std::array<float,2>{0.617782831f, 0.27415821f},
-std::array<float,2>{0.254472107f, 0.125474736f},
-std::array<float,2>{0.825648546f, 0.893911541f},
-std::array<float,2>{0.150270358f, 0.974861681f},
-std::array<float,2>{0.662432015f, 0.190337941f},
-std::array<float,2>{0.461881429f, 0.319977403f},
-std::array<float,2>{0.905727208f, 0.551929235f},
-std::array<float,2>{0.360173196f, 0.697048664f},
-std::array<float,2>{0.757389486f, 0.465006381f},
-std::array<float,2>{0.0313178077f, 0.0663932487f},
-std::array<float,2>{0.544719696f, 0.81967485f},
-std::array<float,2>{0.282473296f, 0.914868593f},
-std::array<float,2>{0.862394512f, 0.161559582f},
-std::array<float,2>{0.0919778273f, 0.310626745f},
-std::array<float,2>{0.577743649f, 0.567533195f},
-std::array<float,2>{0.216683388f, 0.628845811f},
-std::array<float,2>{0.717340827f, 0.417706341f},
-std::array<float,2>{0.423840404f, 0.00901690964f},
-std::array<float,2>{0.985418558f, 0.782664716f},
-std::array<float,2>{0.00791270006f, 0.858974814f},
-std::array<float,2>{0.506085634f, 0.104676872f},
-std::array<float,2>{0.324229598f, 0.497811466f},
-std::array<float,2>{0.795581162f, 0.721494555f},
-std::array<float,2>{0.487952352f, 0.515705168f},
-std::array<float,2>{0.936255336f, 0.36738798f},
-std::array<float,2>{0.187089309f, 0.228541359f},
-std::array<float,2>{0.644621551f, 0.959531128f},
-std::array<float,2>{0.433596343f, 0.902163208f},
-std::array<float,2>{0.998704791f, 0.13476412f},
-std::array<float,2>{0.210094601f, 0.269528985f},
-std::array<float,2>{0.709351957f, 0.600926459f},
-std::array<float,2>{0.0836043581f, 0.662411809f},
-std::array<float,2>{0.562566876f, 0.400168091f},
-std::array<float,2>{0.292536795f, 0.0440589003f},
-std::array<float,2>{0.867357433f, 0.776618719f},
-std::array<float,2>{0.172431022f, 0.824378788f},
-std::array<float,2>{0.652973771f, 0.0742165223f},
-std::array<float,2>{0.496435553f, 0.460069627f},
-std::array<float,2>{0.924409628f, 0.693926096f},
-std::array<float,2>{0.31579569f, 0.560999036f},
-std::array<float,2>{0.781980991f, 0.320835382f},
-std::array<float,2>{0.0020995345f, 0.200723931f},
-std::array<float,2>{0.509869814f, 0.983367145f},
-std::array<float,2>{0.258363813f, 0.795954823f},
-std::array<float,2>{0.815996826f, 0.00778041035f},
-std::array<float,2>{0.104933873f, 0.413383037f},
-std::array<float,2>{0.612939417f, 0.633279264f},
-std::array<float,2>{0.230890542f, 0.57145375f},
-std::array<float,2>{0.745889843f, 0.299244195f},
-std::array<float,2>{0.405560255f, 0.16459313f},
-std::array<float,2>{0.956168234f, 0.909274578f},
-std::array<float,2>{0.0456700735f, 0.965363503f},
-std::array<float,2>{0.537910998f, 0.219345346f},
-std::array<float,2>{0.374879867f, 0.362068981f},
-std::array<float,2>{0.762080669f, 0.52826488f},
-std::array<float,2>{0.456659585f, 0.732269406f},
-std::array<float,2>{0.895828664f, 0.485387146f},
-std::array<float,2>{0.14451696f, 0.101126924f},
-std::array<float,2>{0.668358982f, 0.849073052f},
-std::array<float,2>{0.475889713f, 0.869828284f},
-std::array<float,2>{0.911098838f, 0.115179263f},
-std::array<float,2>{0.170323238f, 0.481189251f},
-std::array<float,2>{0.64035356f, 0.740468442f},
-std::array<float,2>{0.0259503778f, 0.501355708f},
-std::array<float,2>{0.52485311f, 0.34423992f},
-std::array<float,2>{0.339553952f, 0.246584669f},
-std::array<float,2>{0.809066176f, 0.952717841f},
-std::array<float,2>{0.195709914f, 0.935769439f},
-std::array<float,2>{0.69161737f, 0.17431125f},
-std::array<float,2>{0.411288917f, 0.291500002f},
-std::array<float,2>{0.983909905f, 0.586317301f},
-std::array<float,2>{0.306517154f, 0.647960722f},
-std::array<float,2>{0.845160127f, 0.42512241f},
-std::array<float,2>{0.0721408799f, 0.0235683266f},
-std::array<float,2>{0.589750171f, 0.802884877f},
-std::array<float,2>{0.353379637f, 0.999345958f},
-std::array<float,2>{0.774213493f, 0.213494614f},
-std::array<float,2>{0.052386038f, 0.328392982f},
-std::array<float,2>{0.553358555f, 0.537310064f},
-std::array<float,2>{0.125603259f, 0.708918154f},
-std::array<float,2>{0.683849692f, 0.442924798f},
-std::array<float,2>{0.450806707f, 0.0806640685f},
-std::array<float,2>{0.884467542f, 0.831940114f},
-std::array<float,2>{0.113392495f, 0.757545531f},
-std::array<float,2>{0.599107087f, 0.0512494706f},
-std::array<float,2>{0.275915831f, 0.382684916f},
-std::array<float,2>{0.830798626f, 0.672095776f},
-std::array<float,2>{0.390210539f, 0.616856992f},
-std::array<float,2>{0.949366987f, 0.261017472f},
-std::array<float,2>{0.237668961f, 0.142257795f},
-std::array<float,2>{0.733845532f, 0.889686406f},
-std::array<float,2>{0.419452965f, 0.963826716f},
-std::array<float,2>{0.969105721f, 0.226269156f},
-std::array<float,2>{0.193652838f, 0.366225809f},
-std::array<float,2>{0.696779251f, 0.525319815f},
-std::array<float,2>{0.0655020997f, 0.727065802f},
-std::array<float,2>{0.583592057f, 0.491151422f},
-std::array<float,2>{0.298988581f, 0.0937887207f},
-std::array<float,2>{0.853039265f, 0.846064746f},
-std::array<float,2>{0.158326641f, 0.790092945f},
-std::array<float,2>{0.625243247f, 0.00269962451f},
-std::array<float,2>{0.483130068f, 0.409757227f},
-std::array<float,2>{0.915450394f, 0.638888717f},
-std::array<float,2>{0.330262423f, 0.574675381f},
-std::array<float,2>{0.802389741f, 0.303987294f},
-std::array<float,2>{0.0179634243f, 0.170092881f},
-std::array<float,2>{0.519649029f, 0.910859168f},
-std::array<float,2>{0.271676958f, 0.821713686f},
-std::array<float,2>{0.841857374f, 0.0743407831f},
-std::array<float,2>{0.122154295f, 0.455545366f},
-std::array<float,2>{0.603699088f, 0.688555121f},
-std::array<float,2>{0.249161169f, 0.554933906f},
-std::array<float,2>{0.723253012f, 0.327010989f},
-std::array<float,2>{0.381751388f, 0.198298812f},
-std::array<float,2>{0.938025057f, 0.976595819f},
-std::array<float,2>{0.0548384227f, 0.905202031f},
-std::array<float,2>{0.555003047f, 0.138231456f},
-std::array<float,2>{0.349607438f, 0.272692233f},
-std::array<float,2>{0.770132482f, 0.595306396f},
-std::array<float,2>{0.440041512f, 0.659416974f},
-std::array<float,2>{0.882487714f, 0.406063408f},
-std::array<float,2>{0.13781099f, 0.0422992148f},
-std::array<float,2>{0.67933017f, 0.780551195f},
-std::array<float,2>{0.488453358f, 0.751145482f},
-std::array<float,2>{0.931834102f, 0.0486593805f},
-std::array<float,2>{0.17983304f, 0.376802415f},
-std::array<float,2>{0.642725289f, 0.676518738f},
-std::array<float,2>{0.0124692246f, 0.612343669f},
-std::array<float,2>{0.503359377f, 0.265374303f},
-std::array<float,2>{0.3217206f, 0.147741824f},
-std::array<float,2>{0.789674044f, 0.885715723f},
-std::array<float,2>{0.211897179f, 0.994843364f},
-std::array<float,2>{0.714470923f, 0.218498513f},
-std::array<float,2>{0.428419322f, 0.335608959f},
-std::array<float,2>{0.990196109f, 0.53224057f},
-std::array<float,2>{0.287467867f, 0.705316126f},
-std::array<float,2>{0.866560638f, 0.437609553f},
-std::array<float,2>{0.0884217545f, 0.0855035782f},
-std::array<float,2>{0.573681056f, 0.832791626f},
-std::array<float,2>{0.366299063f, 0.931563318f},
-std::array<float,2>{0.75139147f, 0.178028598f},
-std::array<float,2>{0.035450533f, 0.294463873f},
-std::array<float,2>{0.539821804f, 0.592972994f},
-std::array<float,2>{0.153202713f, 0.643393219f},
-std::array<float,2>{0.658434689f, 0.429659545f},
-std::array<float,2>{0.464869678f, 0.0302317236f},
-std::array<float,2>{0.901174128f, 0.799258411f},
-std::array<float,2>{0.0971758664f, 0.874943495f},
-std::array<float,2>{0.622080386f, 0.111962236f},
-std::array<float,2>{0.251031399f, 0.479388982f},
-std::array<float,2>{0.823804915f, 0.735582888f},
-std::array<float,2>{0.393844962f, 0.507030249f},
-std::array<float,2>{0.961451471f, 0.350634784f},
-std::array<float,2>{0.223568499f, 0.24582383f},
-std::array<float,2>{0.739929497f, 0.946461976f},
-std::array<float,2>{0.46024248f, 0.879820228f},
-std::array<float,2>{0.891533732f, 0.150374368f},
-std::array<float,2>{0.147408336f, 0.253299862f},
-std::array<float,2>{0.66673106f, 0.62155956f},
-std::array<float,2>{0.0391420722f, 0.683092237f},
-std::array<float,2>{0.531920075f, 0.387403905f},
-std::array<float,2>{0.368702233f, 0.0594994016f},
-std::array<float,2>{0.760798156f, 0.759486556f},
-std::array<float,2>{0.229476959f, 0.841780961f},
-std::array<float,2>{0.747921467f, 0.0909698382f},
-std::array<float,2>{0.400405794f, 0.446181685f},
-std::array<float,2>{0.960234344f, 0.713234663f},
-std::array<float,2>{0.264210224f, 0.543927193f},
-std::array<float,2>{0.819988847f, 0.340357542f},
-std::array<float,2>{0.105887622f, 0.210732773f},
-std::array<float,2>{0.615607858f, 0.989991546f},
-std::array<float,2>{0.317214549f, 0.806084156f},
-std::array<float,2>{0.787262797f, 0.0212133341f},
-std::array<float,2>{0.00572066521f, 0.432661265f},
-std::array<float,2>{0.515523136f, 0.650698066f},
-std::array<float,2>{0.175848156f, 0.582602501f},
-std::array<float,2>{0.651999474f, 0.283761948f},
-std::array<float,2>{0.494028687f, 0.184221923f},
-std::array<float,2>{0.928619027f, 0.929567099f},
-std::array<float,2>{0.0813442841f, 0.939252853f},
-std::array<float,2>{0.56987232f, 0.236596614f},
-std::array<float,2>{0.295403123f, 0.35404557f},
-std::array<float,2>{0.872916162f, 0.511278093f},
-std::array<float,2>{0.430765688f, 0.749982595f},
-std::array<float,2>{0.99325794f, 0.475112706f},
-std::array<float,2>{0.204182148f, 0.118685894f},
-std::array<float,2>{0.704495132f, 0.865400374f},
-std::array<float,2>{0.3837713f, 0.854049087f},
-std::array<float,2>{0.948584259f, 0.107237458f},
-std::array<float,2>{0.241453052f, 0.494333178f},
-std::array<float,2>{0.728664756f, 0.72490859f},
-std::array<float,2>{0.110908508f, 0.519742489f},
-std::array<float,2>{0.597479284f, 0.37153405f},
-std::array<float,2>{0.280121833f, 0.231298521f},
-std::array<float,2>{0.835888684f, 0.954975367f},
-std::array<float,2>{0.129517138f, 0.919614196f},
-std::array<float,2>{0.680448651f, 0.157926843f},
-std::array<float,2>{0.449021071f, 0.308434844f},
-std::array<float,2>{0.890200138f, 0.563318551f},
-std::array<float,2>{0.356837004f, 0.630901396f},
-std::array<float,2>{0.781144142f, 0.419297934f},
-std::array<float,2>{0.0494421795f, 0.0124162445f},
-std::array<float,2>{0.547857106f, 0.785759628f},
-std::array<float,2>{0.309353113f, 0.971693873f},
-std::array<float,2>{0.849370062f, 0.194082394f},
-std::array<float,2>{0.0762303844f, 0.315200895f},
-std::array<float,2>{0.592220128f, 0.54915458f},
-std::array<float,2>{0.202751726f, 0.700369656f},
-std::array<float,2>{0.688599885f, 0.461886138f},
-std::array<float,2>{0.408672452f, 0.0695879459f},
-std::array<float,2>{0.980207562f, 0.815431774f},
-std::array<float,2>{0.0306675825f, 0.770198286f},
-std::array<float,2>{0.530030847f, 0.0328158177f},
-std::array<float,2>{0.341102809f, 0.394765675f},
-std::array<float,2>{0.805758417f, 0.665408373f},
-std::array<float,2>{0.470441163f, 0.607680619f},
-std::array<float,2>{0.909082055f, 0.280852348f},
-std::array<float,2>{0.167190254f, 0.129838437f},
-std::array<float,2>{0.633611083f, 0.89812386f},
-std::array<float,2>{0.477553278f, 0.984883189f},
-std::array<float,2>{0.921609461f, 0.207015559f},
-std::array<float,2>{0.162449062f, 0.339216471f},
-std::array<float,2>{0.63202256f, 0.540297925f},
-std::array<float,2>{0.0222104397f, 0.714854181f},
-std::array<float,2>{0.51756084f, 0.451323122f},
-std::array<float,2>{0.334518611f, 0.0875427946f},
-std::array<float,2>{0.800404966f, 0.838555336f},
-std::array<float,2>{0.188804999f, 0.761827111f},
-std::array<float,2>{0.701545894f, 0.055511307f},
-std::array<float,2>{0.415174097f, 0.385663003f},
-std::array<float,2>{0.976397812f, 0.683647573f},
-std::array<float,2>{0.302974254f, 0.619160533f},
-std::array<float,2>{0.857400358f, 0.254759103f},
-std::array<float,2>{0.0696354732f, 0.153523192f},
-std::array<float,2>{0.578678191f, 0.877252996f},
-std::array<float,2>{0.345350355f, 0.862524509f},
-std::array<float,2>{0.766627371f, 0.123039573f},
-std::array<float,2>{0.061913237f, 0.470537752f},
-std::array<float,2>{0.561000943f, 0.744288087f},
-std::array<float,2>{0.135205075f, 0.515213609f},
-std::array<float,2>{0.675330997f, 0.35720247f},
-std::array<float,2>{0.441830337f, 0.241805851f},
-std::array<float,2>{0.875763893f, 0.941519439f},
-std::array<float,2>{0.119700477f, 0.922073066f},
-std::array<float,2>{0.60602057f, 0.182951242f},
-std::array<float,2>{0.269179583f, 0.287048787f},
-std::array<float,2>{0.837315142f, 0.580278039f},
-std::array<float,2>{0.378345013f, 0.654373884f},
-std::array<float,2>{0.943491459f, 0.435465068f},
-std::array<float,2>{0.244241163f, 0.0166325122f},
-std::array<float,2>{0.721160769f, 0.812116861f},
-std::array<float,2>{0.423821688f, 0.783458829f},
-std::array<float,2>{0.987041712f, 0.011514226f},
-std::array<float,2>{0.217750669f, 0.415769547f},
-std::array<float,2>{0.715276182f, 0.625784576f},
-std::array<float,2>{0.0904083624f, 0.569184244f},
-std::array<float,2>{0.574700832f, 0.308717966f},
-std::array<float,2>{0.284763873f, 0.163916811f},
-std::array<float,2>{0.860695541f, 0.916215777f},
-std::array<float,2>{0.184584633f, 0.958934784f},
-std::array<float,2>{0.648145318f, 0.228177354f},
-std::array<float,2>{0.485276818f, 0.36976552f},
-std::array<float,2>{0.934095085f, 0.518277705f},
-std::array<float,2>{0.326641619f, 0.719151556f},
-std::array<float,2>{0.79472518f, 0.499012709f},
-std::array<float,2>{0.0111996522f, 0.102438301f},
-std::array<float,2>{0.505092919f, 0.855556965f},
-std::array<float,2>{0.257352144f, 0.892095506f},
-std::array<float,2>{0.827713013f, 0.128581867f},
-std::array<float,2>{0.100817643f, 0.277330548f},
-std::array<float,2>{0.619217396f, 0.601817727f},
-std::array<float,2>{0.22104761f, 0.670024574f},
-std::array<float,2>{0.737542987f, 0.39388147f},
-std::array<float,2>{0.398180306f, 0.0355768614f},
-std::array<float,2>{0.965703309f, 0.769355297f},
-std::array<float,2>{0.0337234885f, 0.816788733f},
-std::array<float,2>{0.545861721f, 0.0638770387f},
-std::array<float,2>{0.363042414f, 0.468590528f},
-std::array<float,2>{0.755495906f, 0.698137462f},
-std::array<float,2>{0.464122921f, 0.553032994f},
-std::array<float,2>{0.902892888f, 0.317160487f},
-std::array<float,2>{0.151420012f, 0.189289317f},
-std::array<float,2>{0.660403371f, 0.973001301f},
-std::array<float,2>{0.404105306f, 0.90686357f},
-std::array<float,2>{0.954933584f, 0.166894644f},
-std::array<float,2>{0.232579604f, 0.29728961f},
-std::array<float,2>{0.742831767f, 0.574082792f},
-std::array<float,2>{0.103068233f, 0.636247158f},
-std::array<float,2>{0.610426009f, 0.411963642f},
-std::array<float,2>{0.26075846f, 0.00563133927f},
-std::array<float,2>{0.813230395f, 0.794336617f},
-std::array<float,2>{0.141045406f, 0.851047397f},
-std::array<float,2>{0.671755493f, 0.0977061093f},
-std::array<float,2>{0.454610229f, 0.487287045f},
-std::array<float,2>{0.896770895f, 0.734113812f},
-std::array<float,2>{0.372823954f, 0.530435383f},
-std::array<float,2>{0.76464051f, 0.36014384f},
-std::array<float,2>{0.0436258316f, 0.221044168f},
-std::array<float,2>{0.5352121f, 0.966889322f},
-std::array<float,2>{0.289516062f, 0.774229646f},
-std::array<float,2>{0.870509923f, 0.0467987172f},
-std::array<float,2>{0.0844747052f, 0.400890708f},
-std::array<float,2>{0.565110803f, 0.66150254f},
-std::array<float,2>{0.207114801f, 0.597960174f},
-std::array<float,2>{0.708952367f, 0.265844584f},
-std::array<float,2>{0.436509699f, 0.136467576f},
-std::array<float,2>{0.996957004f, 0.900063038f},
-std::array<float,2>{0.00133539992f, 0.981747925f},
-std::array<float,2>{0.508260548f, 0.203044489f},
-std::array<float,2>{0.313137949f, 0.322757512f},
-std::array<float,2>{0.783575594f, 0.559980392f},
-std::array<float,2>{0.499515563f, 0.69288367f},
-std::array<float,2>{0.92347759f, 0.458063304f},
-std::array<float,2>{0.175104588f, 0.0713869184f},
-std::array<float,2>{0.654443324f, 0.826721668f},
-std::array<float,2>{0.452686518f, 0.828474283f},
-std::array<float,2>{0.885074079f, 0.0787240788f},
-std::array<float,2>{0.128297448f, 0.4451074f},
-std::array<float,2>{0.686399043f, 0.709027648f},
-std::array<float,2>{0.052883409f, 0.537081242f},
-std::array<float,2>{0.552706897f, 0.330712438f},
-std::array<float,2>{0.354380906f, 0.212128118f},
-std::array<float,2>{0.775636017f, 0.99684459f},
-std::array<float,2>{0.236267135f, 0.887546718f},
-std::array<float,2>{0.730579436f, 0.143590257f},
-std::array<float,2>{0.388294667f, 0.258566052f},
-std::array<float,2>{0.952638149f, 0.614897013f},
-std::array<float,2>{0.273814112f, 0.674220443f},
-std::array<float,2>{0.828668952f, 0.379464597f},
-std::array<float,2>{0.117122106f, 0.0544667393f},
-std::array<float,2>{0.601047695f, 0.753969848f},
-std::array<float,2>{0.336362362f, 0.950901449f},
-std::array<float,2>{0.811184883f, 0.249031737f},
-std::array<float,2>{0.0244136285f, 0.346320421f},
-std::array<float,2>{0.525764108f, 0.503818989f},
-std::array<float,2>{0.169375122f, 0.738731265f},
-std::array<float,2>{0.637182415f, 0.483821452f},
-std::array<float,2>{0.474024385f, 0.116173409f},
-std::array<float,2>{0.912478864f, 0.867964506f},
-std::array<float,2>{0.0728861615f, 0.800792992f},
-std::array<float,2>{0.586044073f, 0.0271544997f},
-std::array<float,2>{0.307778627f, 0.422739804f},
-std::array<float,2>{0.8473804f, 0.64498961f},
-std::array<float,2>{0.412307531f, 0.588611186f},
-std::array<float,2>{0.982318282f, 0.290464193f},
-std::array<float,2>{0.198324919f, 0.172998548f},
-std::array<float,2>{0.695155859f, 0.935248554f},
-std::array<float,2>{0.42939809f, 0.993400455f},
-std::array<float,2>{0.989050329f, 0.215941399f},
-std::array<float,2>{0.212058574f, 0.332890123f},
-std::array<float,2>{0.713473439f, 0.533620358f},
-std::array<float,2>{0.0897805169f, 0.703542531f},
-std::array<float,2>{0.572328568f, 0.439965606f},
-std::array<float,2>{0.289013445f, 0.0831811801f},
-std::array<float,2>{0.865283906f, 0.835206985f},
-std::array<float,2>{0.181370124f, 0.753735483f},
-std::array<float,2>{0.643693388f, 0.0502599888f},
-std::array<float,2>{0.489905447f, 0.37861383f},
-std::array<float,2>{0.933340728f, 0.679291546f},
-std::array<float,2>{0.321152121f, 0.611157238f},
-std::array<float,2>{0.790963948f, 0.261935234f},
-std::array<float,2>{0.0134098204f, 0.146294951f},
-std::array<float,2>{0.502009213f, 0.884494424f},
-std::array<float,2>{0.250097245f, 0.872404754f},
-std::array<float,2>{0.822490752f, 0.110161006f},
-std::array<float,2>{0.0960697532f, 0.477418244f},
-std::array<float,2>{0.621511877f, 0.737499058f},
-std::array<float,2>{0.223904207f, 0.504907131f},
-std::array<float,2>{0.738555551f, 0.347975492f},
-std::array<float,2>{0.392871588f, 0.243188202f},
-std::array<float,2>{0.962465823f, 0.947562516f},
-std::array<float,2>{0.0370747484f, 0.932720184f},
-std::array<float,2>{0.540923774f, 0.176420748f},
-std::array<float,2>{0.36569348f, 0.295444667f},
-std::array<float,2>{0.750564039f, 0.591163099f},
-std::array<float,2>{0.465892613f, 0.641207218f},
-std::array<float,2>{0.902037561f, 0.426083744f},
-std::array<float,2>{0.153886482f, 0.029208675f},
-std::array<float,2>{0.65973103f, 0.798486769f},
-std::array<float,2>{0.484287351f, 0.792734623f},
-std::array<float,2>{0.914089143f, 0.00080577028f},
-std::array<float,2>{0.159706578f, 0.406952888f},
-std::array<float,2>{0.626694858f, 0.638524711f},
-std::array<float,2>{0.0193389412f, 0.578074396f},
-std::array<float,2>{0.520774662f, 0.302162886f},
-std::array<float,2>{0.331878752f, 0.168618605f},
-std::array<float,2>{0.801644921f, 0.913246989f},
-std::array<float,2>{0.194782063f, 0.962507367f},
-std::array<float,2>{0.695986032f, 0.224352524f},
-std::array<float,2>{0.418893009f, 0.36415115f},
-std::array<float,2>{0.970622003f, 0.526208043f},
-std::array<float,2>{0.300096244f, 0.72899276f},
-std::array<float,2>{0.852473378f, 0.48901695f},
-std::array<float,2>{0.0652189925f, 0.0974558815f},
-std::array<float,2>{0.582614124f, 0.844995677f},
-std::array<float,2>{0.347826511f, 0.90381813f},
-std::array<float,2>{0.770767152f, 0.138845459f},
-std::array<float,2>{0.0563730039f, 0.270814598f},
-std::array<float,2>{0.556409538f, 0.596051037f},
-std::array<float,2>{0.13725017f, 0.656645656f},
-std::array<float,2>{0.677929401f, 0.4028835f},
-std::array<float,2>{0.4413746f, 0.0406531505f},
-std::array<float,2>{0.881587148f, 0.778079569f},
-std::array<float,2>{0.121964805f, 0.823445439f},
-std::array<float,2>{0.604968309f, 0.0767545775f},
-std::array<float,2>{0.27285859f, 0.453708678f},
-std::array<float,2>{0.843354106f, 0.691208661f},
-std::array<float,2>{0.382053137f, 0.557091832f},
-std::array<float,2>{0.93901974f, 0.325048029f},
-std::array<float,2>{0.248402327f, 0.196740776f},
-std::array<float,2>{0.724566221f, 0.979225338f},
-std::array<float,2>{0.447535157f, 0.921867192f},
-std::array<float,2>{0.889142096f, 0.158501446f},
-std::array<float,2>{0.130226403f, 0.30662626f},
-std::array<float,2>{0.680952847f, 0.56606704f},
-std::array<float,2>{0.0498788804f, 0.629914224f},
-std::array<float,2>{0.547185004f, 0.421843708f},
-std::array<float,2>{0.356370389f, 0.0145331128f},
-std::array<float,2>{0.779988885f, 0.787209749f},
-std::array<float,2>{0.240573108f, 0.851908743f},
-std::array<float,2>{0.729583979f, 0.108197153f},
-std::array<float,2>{0.384664714f, 0.492883742f},
-std::array<float,2>{0.948180974f, 0.724570572f},
-std::array<float,2>{0.281247526f, 0.523353517f},
-std::array<float,2>{0.834451914f, 0.374330878f},
-std::array<float,2>{0.10993816f, 0.233587831f},
-std::array<float,2>{0.596141458f, 0.956280828f},
-std::array<float,2>{0.340020895f, 0.773148537f},
-std::array<float,2>{0.80542177f, 0.0341566801f},
-std::array<float,2>{0.0301051773f, 0.396877974f},
-std::array<float,2>{0.530373216f, 0.667826295f},
-std::array<float,2>{0.16610989f, 0.605555356f},
-std::array<float,2>{0.634355009f, 0.278935462f},
-std::array<float,2>{0.469235569f, 0.132655829f},
-std::array<float,2>{0.909938037f, 0.895218253f},
-std::array<float,2>{0.0776237398f, 0.969329596f},
-std::array<float,2>{0.593120635f, 0.193167984f},
-std::array<float,2>{0.309818655f, 0.313600481f},
-std::array<float,2>{0.847857475f, 0.547379076f},
-std::array<float,2>{0.409851044f, 0.702427804f},
-std::array<float,2>{0.979287863f, 0.464029878f},
-std::array<float,2>{0.201703683f, 0.068169646f},
-std::array<float,2>{0.688229799f, 0.813214362f},
-std::array<float,2>{0.401387602f, 0.842150152f},
-std::array<float,2>{0.959355593f, 0.0925856084f},
-std::array<float,2>{0.229653135f, 0.448028594f},
-std::array<float,2>{0.746880591f, 0.712052405f},
-std::array<float,2>{0.107265502f, 0.545598507f},
-std::array<float,2>{0.61711812f, 0.343080878f},
-std::array<float,2>{0.265312582f, 0.207630724f},
-std::array<float,2>{0.818395138f, 0.991376579f},
-std::array<float,2>{0.147668034f, 0.882279932f},
-std::array<float,2>{0.667458594f, 0.150933549f},
-std::array<float,2>{0.459493428f, 0.251006216f},
-std::array<float,2>{0.891615748f, 0.624266326f},
-std::array<float,2>{0.367334545f, 0.680075943f},
-std::array<float,2>{0.759913623f, 0.389034182f},
-std::array<float,2>{0.0403004475f, 0.0623113811f},
-std::array<float,2>{0.5322662f, 0.760495961f},
-std::array<float,2>{0.29635638f, 0.941087484f},
-std::array<float,2>{0.87183702f, 0.235912472f},
-std::array<float,2>{0.0801008791f, 0.352710873f},
-std::array<float,2>{0.569055974f, 0.508214474f},
-std::array<float,2>{0.203196019f, 0.746283174f},
-std::array<float,2>{0.703659475f, 0.473190486f},
-std::array<float,2>{0.430158436f, 0.119332522f},
-std::array<float,2>{0.992496252f, 0.864593506f},
-std::array<float,2>{0.00450920174f, 0.80725193f},
-std::array<float,2>{0.514622808f, 0.0227340665f},
-std::array<float,2>{0.317934155f, 0.430666596f},
-std::array<float,2>{0.788255811f, 0.649287224f},
-std::array<float,2>{0.492582351f, 0.584255159f},
-std::array<float,2>{0.929062843f, 0.282961816f},
-std::array<float,2>{0.176862776f, 0.187328145f},
-std::array<float,2>{0.650438309f, 0.927038074f},
-std::array<float,2>{0.486028492f, 0.960281253f},
-std::array<float,2>{0.935045719f, 0.230038539f},
-std::array<float,2>{0.183973014f, 0.368264407f},
-std::array<float,2>{0.647089183f, 0.517380059f},
-std::array<float,2>{0.0106650554f, 0.722347856f},
-std::array<float,2>{0.504233241f, 0.496530235f},
-std::array<float,2>{0.327560633f, 0.104333691f},
-std::array<float,2>{0.793929875f, 0.858058155f},
-std::array<float,2>{0.218281806f, 0.782073975f},
-std::array<float,2>{0.716310263f, 0.00868880562f},
-std::array<float,2>{0.422573984f, 0.416224122f},
-std::array<float,2>{0.98753655f, 0.627069831f},
-std::array<float,2>{0.28327468f, 0.567253351f},
-std::array<float,2>{0.860258698f, 0.312169939f},
-std::array<float,2>{0.0914434567f, 0.160876721f},
-std::array<float,2>{0.575222075f, 0.91530031f},
-std::array<float,2>{0.361568034f, 0.818446457f},
-std::array<float,2>{0.754142284f, 0.0645822883f},
-std::array<float,2>{0.0344993584f, 0.466481358f},
-std::array<float,2>{0.546450973f, 0.696068048f},
-std::array<float,2>{0.151109636f, 0.551362574f},
-std::array<float,2>{0.661514699f, 0.318706125f},
-std::array<float,2>{0.463203251f, 0.191274136f},
-std::array<float,2>{0.904125869f, 0.975714028f},
-std::array<float,2>{0.0999150872f, 0.892929018f},
-std::array<float,2>{0.620404482f, 0.126626238f},
-std::array<float,2>{0.256603628f, 0.274976254f},
-std::array<float,2>{0.826562583f, 0.604599774f},
-std::array<float,2>{0.397436947f, 0.668152928f},
-std::array<float,2>{0.965944111f, 0.392386585f},
-std::array<float,2>{0.221822694f, 0.0380606689f},
-std::array<float,2>{0.736652911f, 0.765811205f},
-std::array<float,2>{0.414716631f, 0.763780832f},
-std::array<float,2>{0.97485292f, 0.0572551973f},
-std::array<float,2>{0.188475564f, 0.38355118f},
-std::array<float,2>{0.702582955f, 0.686674237f},
-std::array<float,2>{0.0689685047f, 0.617814839f},
-std::array<float,2>{0.579775631f, 0.257204711f},
-std::array<float,2>{0.304395497f, 0.155089244f},
-std::array<float,2>{0.856259286f, 0.875498891f},
-std::array<float,2>{0.164054334f, 0.987213373f},
-std::array<float,2>{0.631101489f, 0.203307822f},
-std::array<float,2>{0.477302492f, 0.336765558f},
-std::array<float,2>{0.9201805f, 0.542392254f},
-std::array<float,2>{0.335445613f, 0.717773557f},
-std::array<float,2>{0.798915327f, 0.449891061f},
-std::array<float,2>{0.0227193832f, 0.0889475793f},
-std::array<float,2>{0.515892982f, 0.836186826f},
-std::array<float,2>{0.267774373f, 0.92451793f},
-std::array<float,2>{0.835941494f, 0.180990413f},
-std::array<float,2>{0.120149866f, 0.288292736f},
-std::array<float,2>{0.606693149f, 0.579373658f},
-std::array<float,2>{0.245944411f, 0.652393818f},
-std::array<float,2>{0.72238487f, 0.436018884f},
-std::array<float,2>{0.37730962f, 0.0185295008f},
-std::array<float,2>{0.945140243f, 0.80985713f},
-std::array<float,2>{0.0612220019f, 0.860175431f},
-std::array<float,2>{0.561582088f, 0.123188742f},
-std::array<float,2>{0.343955785f, 0.470804393f},
-std::array<float,2>{0.765639126f, 0.742460132f},
-std::array<float,2>{0.443261117f, 0.512075841f},
-std::array<float,2>{0.876914203f, 0.359264582f},
-std::array<float,2>{0.13609685f, 0.239723101f},
-std::array<float,2>{0.674254298f, 0.945006847f},
-std::array<float,2>{0.38680622f, 0.888710082f},
-std::array<float,2>{0.951740146f, 0.141594246f},
-std::array<float,2>{0.234791249f, 0.260540664f},
-std::array<float,2>{0.731710494f, 0.615789711f},
-std::array<float,2>{0.115643248f, 0.673742533f},
-std::array<float,2>{0.599749744f, 0.381195754f},
-std::array<float,2>{0.275339633f, 0.0527196042f},
-std::array<float,2>{0.830021799f, 0.756027281f},
-std::array<float,2>{0.127048016f, 0.830900371f},
-std::array<float,2>{0.687137306f, 0.0819840804f},
-std::array<float,2>{0.451411068f, 0.442147464f},
-std::array<float,2>{0.886323988f, 0.707292497f},
-std::array<float,2>{0.354531497f, 0.538247287f},
-std::array<float,2>{0.777129173f, 0.329149365f},
-std::array<float,2>{0.0538014024f, 0.214193687f},
-std::array<float,2>{0.551329613f, 0.998236656f},
-std::array<float,2>{0.307030946f, 0.804099977f},
-std::array<float,2>{0.84584409f, 0.0250997022f},
-std::array<float,2>{0.0737175271f, 0.424422264f},
-std::array<float,2>{0.587052524f, 0.646502912f},
-std::array<float,2>{0.198193282f, 0.587838233f},
-std::array<float,2>{0.693884015f, 0.292550206f},
-std::array<float,2>{0.414020538f, 0.175164819f},
-std::array<float,2>{0.980833411f, 0.936834276f},
-std::array<float,2>{0.0247035157f, 0.951552391f},
-std::array<float,2>{0.527094185f, 0.247573063f},
-std::array<float,2>{0.337229908f, 0.344855666f},
-std::array<float,2>{0.811847985f, 0.500139475f},
-std::array<float,2>{0.473552257f, 0.74190104f},
-std::array<float,2>{0.913869202f, 0.482226849f},
-std::array<float,2>{0.168586373f, 0.114082538f},
-std::array<float,2>{0.63771385f, 0.87071228f},
-std::array<float,2>{0.45402351f, 0.848320961f},
-std::array<float,2>{0.898229539f, 0.10007374f},
-std::array<float,2>{0.142215967f, 0.484943807f},
-std::array<float,2>{0.670590758f, 0.731235206f},
-std::array<float,2>{0.0448871627f, 0.528973401f},
-std::array<float,2>{0.537065506f, 0.362700969f},
-std::array<float,2>{0.371632814f, 0.220251694f},
-std::array<float,2>{0.765550613f, 0.966139019f},
-std::array<float,2>{0.234040514f, 0.909029245f},
-std::array<float,2>{0.743460238f, 0.165568203f},
-std::array<float,2>{0.402825922f, 0.299978077f},
-std::array<float,2>{0.953602135f, 0.57052201f},
-std::array<float,2>{0.260735482f, 0.634585679f},
-std::array<float,2>{0.81354481f, 0.413010627f},
-std::array<float,2>{0.102500215f, 0.00595641043f},
-std::array<float,2>{0.609703243f, 0.795309782f},
-std::array<float,2>{0.313630521f, 0.984141946f},
-std::array<float,2>{0.78497982f, 0.199905485f},
-std::array<float,2>{0.000967594737f, 0.321940511f},
-std::array<float,2>{0.509539068f, 0.562219024f},
-std::array<float,2>{0.173864856f, 0.695011675f},
-std::array<float,2>{0.655711591f, 0.459489793f},
-std::array<float,2>{0.498330861f, 0.0724057853f},
-std::array<float,2>{0.922563672f, 0.825218558f},
-std::array<float,2>{0.0854614675f, 0.77613771f},
-std::array<float,2>{0.566093445f, 0.0434585996f},
-std::array<float,2>{0.290188968f, 0.399099857f},
-std::array<float,2>{0.86997956f, 0.663755894f},
-std::array<float,2>{0.437009186f, 0.600225687f},
-std::array<float,2>{0.997712314f, 0.267608255f},
-std::array<float,2>{0.208138257f, 0.133601114f},
-std::array<float,2>{0.707398117f, 0.900422096f},
-std::array<float,2>{0.391053259f, 0.946229517f},
-std::array<float,2>{0.963755608f, 0.244634628f},
-std::array<float,2>{0.224890903f, 0.349693179f},
-std::array<float,2>{0.741529047f, 0.506505489f},
-std::array<float,2>{0.0949042588f, 0.734799564f},
-std::array<float,2>{0.623128772f, 0.480039567f},
-std::array<float,2>{0.253042698f, 0.11311733f},
-std::array<float,2>{0.821754277f, 0.873886287f},
-std::array<float,2>{0.155847788f, 0.80055207f},
-std::array<float,2>{0.658140242f, 0.0305512641f},
-std::array<float,2>{0.467772245f, 0.428101391f},
-std::array<float,2>{0.899214387f, 0.643856108f},
-std::array<float,2>{0.36446932f, 0.592393517f},
-std::array<float,2>{0.75276792f, 0.29376471f},
-std::array<float,2>{0.0376925245f, 0.179440364f},
-std::array<float,2>{0.542158842f, 0.92985332f},
-std::array<float,2>{0.287010163f, 0.833698452f},
-std::array<float,2>{0.86501509f, 0.0847851187f},
-std::array<float,2>{0.0871866792f, 0.439155817f},
-std::array<float,2>{0.572177887f, 0.706336319f},
-std::array<float,2>{0.21345976f, 0.53165555f},
-std::array<float,2>{0.712773323f, 0.334197432f},
-std::array<float,2>{0.426086813f, 0.217423216f},
-std::array<float,2>{0.992090583f, 0.995671272f},
-std::array<float,2>{0.015112971f, 0.886624038f},
-std::array<float,2>{0.50186944f, 0.147028074f},
-std::array<float,2>{0.323709249f, 0.264302492f},
-std::array<float,2>{0.792789102f, 0.611960173f},
-std::array<float,2>{0.492019325f, 0.677732766f},
-std::array<float,2>{0.930216551f, 0.375551045f},
-std::array<float,2>{0.182674214f, 0.0468937196f},
-std::array<float,2>{0.642313004f, 0.750867426f},
-std::array<float,2>{0.438989133f, 0.779384792f},
-std::array<float,2>{0.879863977f, 0.0414176807f},
-std::array<float,2>{0.140418291f, 0.405124784f},
-std::array<float,2>{0.677515864f, 0.658921897f},
-std::array<float,2>{0.0574103855f, 0.5942505f},
-std::array<float,2>{0.557154f, 0.272273511f},
-std::array<float,2>{0.349990249f, 0.136853293f},
-std::array<float,2>{0.772622287f, 0.905451894f},
-std::array<float,2>{0.246166319f, 0.97803098f},
-std::array<float,2>{0.726555884f, 0.197537035f},
-std::array<float,2>{0.380300939f, 0.328038901f},
-std::array<float,2>{0.941130638f, 0.55653888f},
-std::array<float,2>{0.269767106f, 0.688416898f},
-std::array<float,2>{0.840486109f, 0.456355423f},
-std::array<float,2>{0.123442531f, 0.0759703293f},
-std::array<float,2>{0.602440953f, 0.820818841f},
-std::array<float,2>{0.329968452f, 0.911925793f},
-std::array<float,2>{0.803268909f, 0.171711743f},
-std::array<float,2>{0.0163955912f, 0.303672105f},
-std::array<float,2>{0.522640169f, 0.575697839f},
-std::array<float,2>{0.156457841f, 0.639686584f},
-std::array<float,2>{0.62701124f, 0.408828288f},
-std::array<float,2>{0.480572879f, 0.00343365711f},
-std::array<float,2>{0.91671598f, 0.789354086f},
-std::array<float,2>{0.0630955845f, 0.846820712f},
-std::array<float,2>{0.585101783f, 0.0947879851f},
-std::array<float,2>{0.298437536f, 0.491297096f},
-std::array<float,2>{0.853895783f, 0.728266418f},
-std::array<float,2>{0.421469688f, 0.524343252f},
-std::array<float,2>{0.972202063f, 0.365293622f},
-std::array<float,2>{0.191607282f, 0.225033849f},
-std::array<float,2>{0.698790669f, 0.964707792f},
-std::array<float,2>{0.470949471f, 0.896861076f},
-std::array<float,2>{0.908100426f, 0.130631551f},
-std::array<float,2>{0.164133087f, 0.280049622f},
-std::array<float,2>{0.636068821f, 0.608442664f},
-std::array<float,2>{0.0291284602f, 0.66436106f},
-std::array<float,2>{0.528829277f, 0.396165907f},
-std::array<float,2>{0.342684925f, 0.0313514955f},
-std::array<float,2>{0.807144761f, 0.770524681f},
-std::array<float,2>{0.200272411f, 0.815349996f},
-std::array<float,2>{0.690333545f, 0.0691790581f},
-std::array<float,2>{0.407293409f, 0.462220341f},
-std::array<float,2>{0.977945268f, 0.699891508f},
-std::array<float,2>{0.31090188f, 0.550424576f},
-std::array<float,2>{0.849969149f, 0.316197008f},
-std::array<float,2>{0.0758328363f, 0.195287436f},
-std::array<float,2>{0.589892149f, 0.97149384f},
-std::array<float,2>{0.359238446f, 0.786287367f},
-std::array<float,2>{0.778973937f, 0.0128104948f},
-std::array<float,2>{0.0485738702f, 0.418750405f},
-std::array<float,2>{0.550442219f, 0.632511556f},
-std::array<float,2>{0.131111652f, 0.563637137f},
-std::array<float,2>{0.681784332f, 0.307540834f},
-std::array<float,2>{0.446183652f, 0.156369686f},
-std::array<float,2>{0.886733234f, 0.918547273f},
-std::array<float,2>{0.112203792f, 0.953353405f},
-std::array<float,2>{0.593802631f, 0.231938124f},
-std::array<float,2>{0.278956115f, 0.372525662f},
-std::array<float,2>{0.832202077f, 0.521452606f},
-std::array<float,2>{0.385933012f, 0.725752056f},
-std::array<float,2>{0.945426166f, 0.495711654f},
-std::array<float,2>{0.239952117f, 0.10609822f},
-std::array<float,2>{0.728060305f, 0.855238795f},
-std::array<float,2>{0.432840824f, 0.866852939f},
-std::array<float,2>{0.99463135f, 0.117826186f},
-std::array<float,2>{0.206680745f, 0.476435781f},
-std::array<float,2>{0.705939353f, 0.748921812f},
-std::array<float,2>{0.07999295f, 0.510660052f},
-std::array<float,2>{0.566638589f, 0.354495585f},
-std::array<float,2>{0.294790745f, 0.23740752f},
-std::array<float,2>{0.874383569f, 0.938193321f},
-std::array<float,2>{0.179411665f, 0.92801863f},
-std::array<float,2>{0.649962127f, 0.185459599f},
-std::array<float,2>{0.495329112f, 0.285098106f},
-std::array<float,2>{0.92722249f, 0.583346367f},
-std::array<float,2>{0.318869442f, 0.651839852f},
-std::array<float,2>{0.786445677f, 0.43196404f},
-std::array<float,2>{0.00703318138f, 0.0199533999f},
-std::array<float,2>{0.512350082f, 0.805061996f},
-std::array<float,2>{0.262671918f, 0.988636374f},
-std::array<float,2>{0.81686002f, 0.209121078f},
-std::array<float,2>{0.107423693f, 0.341725171f},
-std::array<float,2>{0.614470303f, 0.544544697f},
-std::array<float,2>{0.227219388f, 0.714165747f},
-std::array<float,2>{0.74906081f, 0.446995109f},
-std::array<float,2>{0.398690611f, 0.0906932876f},
-std::array<float,2>{0.958351016f, 0.83989346f},
-std::array<float,2>{0.0412574969f, 0.758092821f},
-std::array<float,2>{0.534322083f, 0.0596627966f},
-std::array<float,2>{0.369212896f, 0.387985259f},
-std::array<float,2>{0.759089887f, 0.682525396f},
-std::array<float,2>{0.458455205f, 0.622087181f},
-std::array<float,2>{0.893836975f, 0.252361327f},
-std::array<float,2>{0.145862371f, 0.14895016f},
-std::array<float,2>{0.665059566f, 0.880844533f},
-std::array<float,2>{0.462126583f, 0.974587619f},
-std::array<float,2>{0.904741049f, 0.188160121f},
-std::array<float,2>{0.149225861f, 0.31774652f},
-std::array<float,2>{0.663974524f, 0.554498255f},
-std::array<float,2>{0.0328099728f, 0.698550463f},
-std::array<float,2>{0.543280602f, 0.467662185f},
-std::array<float,2>{0.361100525f, 0.0626596808f},
-std::array<float,2>{0.756330132f, 0.817680001f},
-std::array<float,2>{0.219238102f, 0.767594278f},
-std::array<float,2>{0.734450817f, 0.0368436165f},
-std::array<float,2>{0.396034837f, 0.392796069f},
-std::array<float,2>{0.968339622f, 0.67173785f},
-std::array<float,2>{0.254989922f, 0.602809072f},
-std::array<float,2>{0.825098157f, 0.275495231f},
-std::array<float,2>{0.0986012444f, 0.12710689f},
-std::array<float,2>{0.618897259f, 0.891159475f},
-std::array<float,2>{0.325447947f, 0.857193947f},
-std::array<float,2>{0.796532869f, 0.103317417f},
-std::array<float,2>{0.00939676445f, 0.499132872f},
-std::array<float,2>{0.507431328f, 0.719834626f},
-std::array<float,2>{0.185605183f, 0.51946938f},
-std::array<float,2>{0.645813107f, 0.370235771f},
-std::array<float,2>{0.486611217f, 0.227196872f},
-std::array<float,2>{0.937109947f, 0.957840085f},
-std::array<float,2>{0.0932285041f, 0.91738075f},
-std::array<float,2>{0.576430798f, 0.162844032f},
-std::array<float,2>{0.281422526f, 0.309881121f},
-std::array<float,2>{0.861632228f, 0.570180833f},
-std::array<float,2>{0.42556873f, 0.626852453f},
-std::array<float,2>{0.985278726f, 0.41465199f},
-std::array<float,2>{0.215292707f, 0.0104341712f},
-std::array<float,2>{0.718722403f, 0.784546614f},
-std::array<float,2>{0.375554591f, 0.810943365f},
-std::array<float,2>{0.942823172f, 0.0158667993f},
-std::array<float,2>{0.243879125f, 0.434340358f},
-std::array<float,2>{0.719221056f, 0.656162262f},
-std::array<float,2>{0.117584787f, 0.581463456f},
-std::array<float,2>{0.60820365f, 0.285161704f},
-std::array<float,2>{0.267500073f, 0.182024717f},
-std::array<float,2>{0.83791858f, 0.923176229f},
-std::array<float,2>{0.134357616f, 0.94334352f},
-std::array<float,2>{0.672663152f, 0.240260318f},
-std::array<float,2>{0.44456017f, 0.355491132f},
-std::array<float,2>{0.877533734f, 0.514050066f},
-std::array<float,2>{0.346618325f, 0.745202124f},
-std::array<float,2>{0.768106103f, 0.469709605f},
-std::array<float,2>{0.0595916659f, 0.121668316f},
-std::array<float,2>{0.559685171f, 0.862115324f},
-std::array<float,2>{0.300815135f, 0.878655791f},
-std::array<float,2>{0.858876109f, 0.153020918f},
-std::array<float,2>{0.0664901435f, 0.255313486f},
-std::array<float,2>{0.58167702f, 0.621093571f},
-std::array<float,2>{0.189475775f, 0.685489535f},
-std::array<float,2>{0.699841022f, 0.385898203f},
-std::array<float,2>{0.417379946f, 0.0565180853f},
-std::array<float,2>{0.974394917f, 0.762794375f},
-std::array<float,2>{0.0206217598f, 0.838935614f},
-std::array<float,2>{0.519494355f, 0.0863347352f},
-std::array<float,2>{0.333124369f, 0.452193439f},
-std::array<float,2>{0.797026277f, 0.715850115f},
-std::array<float,2>{0.478569984f, 0.539295077f},
-std::array<float,2>{0.919212103f, 0.33809492f},
-std::array<float,2>{0.161003172f, 0.205610886f},
-std::array<float,2>{0.630394459f, 0.985556901f},
-std::array<float,2>{0.411006689f, 0.933747113f},
-std::array<float,2>{0.983163059f, 0.171889514f},
-std::array<float,2>{0.196601287f, 0.289063275f},
-std::array<float,2>{0.693030238f, 0.58931464f},
-std::array<float,2>{0.0704548359f, 0.646394789f},
-std::array<float,2>{0.588791907f, 0.423679531f},
-std::array<float,2>{0.304709196f, 0.0261903927f},
-std::array<float,2>{0.843966961f, 0.802112222f},
-std::array<float,2>{0.171054542f, 0.868224323f},
-std::array<float,2>{0.639021337f, 0.117038928f},
-std::array<float,2>{0.474826425f, 0.48288694f},
-std::array<float,2>{0.911430776f, 0.739671767f},
-std::array<float,2>{0.338580579f, 0.502606213f},
-std::array<float,2>{0.810437143f, 0.347176433f},
-std::array<float,2>{0.0266012885f, 0.248127475f},
-std::array<float,2>{0.523842037f, 0.950061321f},
-std::array<float,2>{0.276378155f, 0.75566268f},
-std::array<float,2>{0.831373513f, 0.0529285707f},
-std::array<float,2>{0.114437804f, 0.380407095f},
-std::array<float,2>{0.597821534f, 0.675243258f},
-std::array<float,2>{0.236486197f, 0.613612473f},
-std::array<float,2>{0.733283818f, 0.259000212f},
-std::array<float,2>{0.388680279f, 0.142738193f},
-std::array<float,2>{0.950600684f, 0.888361871f},
-std::array<float,2>{0.0512803681f, 0.997168839f},
-std::array<float,2>{0.554633379f, 0.211444393f},
-std::array<float,2>{0.352172583f, 0.33186999f},
-std::array<float,2>{0.775053859f, 0.5357548f},
-std::array<float,2>{0.450182974f, 0.710223079f},
-std::array<float,2>{0.883762956f, 0.444008142f},
-std::array<float,2>{0.126213536f, 0.0798570886f},
-std::array<float,2>{0.684976518f, 0.829838693f},
-std::array<float,2>{0.497397959f, 0.82746768f},
-std::array<float,2>{0.925105333f, 0.0705687255f},
-std::array<float,2>{0.173075065f, 0.457339317f},
-std::array<float,2>{0.653914332f, 0.691999972f},
-std::array<float,2>{0.00334743457f, 0.559016883f},
-std::array<float,2>{0.511356413f, 0.323280543f},
-std::array<float,2>{0.314674675f, 0.201933444f},
-std::array<float,2>{0.782906771f, 0.981101155f},
-std::array<float,2>{0.209435254f, 0.898812473f},
-std::array<float,2>{0.710904419f, 0.135725498f},
-std::array<float,2>{0.434725285f, 0.267205f},
-std::array<float,2>{0.999304712f, 0.599348366f},
-std::array<float,2>{0.291113675f, 0.660368085f},
-std::array<float,2>{0.868812859f, 0.401910484f},
-std::array<float,2>{0.0822799429f, 0.0451742299f},
-std::array<float,2>{0.56373328f, 0.774905264f},
-std::array<float,2>{0.373418897f, 0.968448937f},
-std::array<float,2>{0.762749016f, 0.222165152f},
-std::array<float,2>{0.0467067622f, 0.360559165f},
-std::array<float,2>{0.539059401f, 0.529868424f},
-std::array<float,2>{0.14311631f, 0.733078301f},
-std::array<float,2>{0.669258952f, 0.487669021f},
-std::array<float,2>{0.455336004f, 0.0987462625f},
-std::array<float,2>{0.894640148f, 0.849850297f},
-std::array<float,2>{0.103547901f, 0.793023527f},
-std::array<float,2>{0.612110913f, 0.00485261204f},
-std::array<float,2>{0.259546876f, 0.410734832f},
-std::array<float,2>{0.815126896f, 0.635692954f},
-std::array<float,2>{0.40524146f, 0.573218107f},
-std::array<float,2>{0.955647707f, 0.297885925f},
-std::array<float,2>{0.232251957f, 0.16702345f},
-std::array<float,2>{0.744583964f, 0.907621384f},
-std::array<float,2>{0.399222523f, 0.992165506f},
-std::array<float,2>{0.958758652f, 0.207319975f},
-std::array<float,2>{0.226590633f, 0.343512118f},
-std::array<float,2>{0.749776065f, 0.54534936f},
-std::array<float,2>{0.107976675f, 0.712784648f},
-std::array<float,2>{0.615099192f, 0.447729349f},
-std::array<float,2>{0.262125075f, 0.0922614485f},
-std::array<float,2>{0.816943645f, 0.842565656f},
-std::array<float,2>{0.146015316f, 0.760240912f},
-std::array<float,2>{0.665738165f, 0.0619905181f},
-std::array<float,2>{0.458618194f, 0.389584661f},
-std::array<float,2>{0.894201517f, 0.680394828f},
-std::array<float,2>{0.369841516f, 0.624650478f},
-std::array<float,2>{0.759471655f, 0.251904577f},
-std::array<float,2>{0.0415387079f, 0.150510147f},
-std::array<float,2>{0.534821987f, 0.882390261f},
-std::array<float,2>{0.294164866f, 0.865088105f},
-std::array<float,2>{0.874988616f, 0.1197225f},
-std::array<float,2>{0.0794274211f, 0.472700864f},
-std::array<float,2>{0.567079425f, 0.746614933f},
-std::array<float,2>{0.20635739f, 0.508399963f},
-std::array<float,2>{0.705319345f, 0.353411883f},
-std::array<float,2>{0.433318853f, 0.235551089f},
-std::array<float,2>{0.994626164f, 0.940834701f},
-std::array<float,2>{0.00776477531f, 0.927523613f},
-std::array<float,2>{0.511828899f, 0.186643317f},
-std::array<float,2>{0.318636864f, 0.282593518f},
-std::array<float,2>{0.786977291f, 0.584656656f},
-std::array<float,2>{0.496019065f, 0.648837984f},
-std::array<float,2>{0.927534938f, 0.431312412f},
-std::array<float,2>{0.179154634f, 0.0232089311f},
-std::array<float,2>{0.649440229f, 0.807068288f},
-std::array<float,2>{0.445460141f, 0.788071811f},
-std::array<float,2>{0.887516618f, 0.0139115192f},
-std::array<float,2>{0.131652638f, 0.421003699f},
-std::array<float,2>{0.682214379f, 0.63064611f},
-std::array<float,2>{0.0480472706f, 0.565882146f},
-std::array<float,2>{0.550110161f, 0.305865049f},
-std::array<float,2>{0.358505249f, 0.158966139f},
-std::array<float,2>{0.778576553f, 0.921121836f},
-std::array<float,2>{0.239736333f, 0.956977606f},
-std::array<float,2>{0.727868199f, 0.234164223f},
-std::array<float,2>{0.386377394f, 0.374926597f},
-std::array<float,2>{0.946133316f, 0.522632062f},
-std::array<float,2>{0.278799206f, 0.723997474f},
-std::array<float,2>{0.832798719f, 0.492339522f},
-std::array<float,2>{0.111672021f, 0.107585222f},
-std::array<float,2>{0.594560146f, 0.852382541f},
-std::array<float,2>{0.342271268f, 0.894669533f},
-std::array<float,2>{0.806691825f, 0.132077664f},
-std::array<float,2>{0.0287087914f, 0.278505296f},
-std::array<float,2>{0.528606474f, 0.60631454f},
-std::array<float,2>{0.164717495f, 0.667063653f},
-std::array<float,2>{0.636569381f, 0.397019267f},
-std::array<float,2>{0.471205652f, 0.033575058f},
-std::array<float,2>{0.907580435f, 0.77246815f},
-std::array<float,2>{0.0752661899f, 0.812701344f},
-std::array<float,2>{0.590522051f, 0.0674485788f},
-std::array<float,2>{0.311318159f, 0.464561075f},
-std::array<float,2>{0.850386322f, 0.702953219f},
-std::array<float,2>{0.407975018f, 0.547182262f},
-std::array<float,2>{0.978031993f, 0.314260989f},
-std::array<float,2>{0.200720713f, 0.192691073f},
-std::array<float,2>{0.689867079f, 0.968962014f},
-std::array<float,2>{0.48133561f, 0.91381222f},
-std::array<float,2>{0.916230619f, 0.168411389f},
-std::array<float,2>{0.156938687f, 0.302428693f},
-std::array<float,2>{0.627751291f, 0.577234209f},
-std::array<float,2>{0.0158811789f, 0.637780547f},
-std::array<float,2>{0.523156106f, 0.406463861f},
-std::array<float,2>{0.32943359f, 0.000189764265f},
-std::array<float,2>{0.802962124f, 0.792374015f},
-std::array<float,2>{0.192271605f, 0.845544696f},
-std::array<float,2>{0.698664427f, 0.0967641175f},
-std::array<float,2>{0.421296507f, 0.488559008f},
-std::array<float,2>{0.971685171f, 0.729191065f},
-std::array<float,2>{0.29823941f, 0.525663555f},
-std::array<float,2>{0.854402959f, 0.363395065f},
-std::array<float,2>{0.0627844632f, 0.223713964f},
-std::array<float,2>{0.585760593f, 0.962002397f},
-std::array<float,2>{0.350215197f, 0.777615547f},
-std::array<float,2>{0.773233294f, 0.040305458f},
-std::array<float,2>{0.0568436757f, 0.402771384f},
-std::array<float,2>{0.557086587f, 0.656831443f},
-std::array<float,2>{0.139869779f, 0.596490562f},
-std::array<float,2>{0.676812112f, 0.271253079f},
-std::array<float,2>{0.438791037f, 0.13954106f},
-std::array<float,2>{0.879392266f, 0.903629363f},
-std::array<float,2>{0.123766139f, 0.978916585f},
-std::array<float,2>{0.601922512f, 0.197162718f},
-std::array<float,2>{0.270205706f, 0.324513316f},
-std::array<float,2>{0.839901984f, 0.557395697f},
-std::array<float,2>{0.380823731f, 0.69073993f},
-std::array<float,2>{0.940473139f, 0.453502417f},
-std::array<float,2>{0.246639773f, 0.07621032f},
-std::array<float,2>{0.725744486f, 0.823943317f},
-std::array<float,2>{0.426617444f, 0.835929334f},
-std::array<float,2>{0.99135536f, 0.0838442743f},
-std::array<float,2>{0.213321447f, 0.439853311f},
-std::array<float,2>{0.712276161f, 0.704068303f},
-std::array<float,2>{0.0876506269f, 0.534029365f},
-std::array<float,2>{0.571413398f, 0.332375526f},
-std::array<float,2>{0.286524534f, 0.216396794f},
-std::array<float,2>{0.864551246f, 0.993899465f},
-std::array<float,2>{0.183226645f, 0.884149015f},
-std::array<float,2>{0.641803503f, 0.145616174f},
-std::array<float,2>{0.491628647f, 0.262579799f},
-std::array<float,2>{0.929858506f, 0.610805869f},
-std::array<float,2>{0.32395348f, 0.678872883f},
-std::array<float,2>{0.792260468f, 0.378393888f},
-std::array<float,2>{0.0153307635f, 0.0505809672f},
-std::array<float,2>{0.501197278f, 0.753024399f},
-std::array<float,2>{0.25371471f, 0.94794023f},
-std::array<float,2>{0.822125733f, 0.243657783f},
-std::array<float,2>{0.09540575f, 0.348334879f},
-std::array<float,2>{0.623647273f, 0.505559564f},
-std::array<float,2>{0.225136086f, 0.737897873f},
-std::array<float,2>{0.741854489f, 0.476885438f},
-std::array<float,2>{0.391406536f, 0.109571464f},
-std::array<float,2>{0.963093877f, 0.872850657f},
-std::array<float,2>{0.0375551619f, 0.798089564f},
-std::array<float,2>{0.542775512f, 0.0285484176f},
-std::array<float,2>{0.364746571f, 0.426559985f},
-std::array<float,2>{0.752022326f, 0.641069412f},
-std::array<float,2>{0.467251033f, 0.591696441f},
-std::array<float,2>{0.898696899f, 0.294990659f},
-std::array<float,2>{0.155489028f, 0.175796404f},
-std::array<float,2>{0.657343507f, 0.93317312f},
-std::array<float,2>{0.455902904f, 0.966557801f},
-std::array<float,2>{0.89509356f, 0.219833583f},
-std::array<float,2>{0.142781302f, 0.363154829f},
-std::array<float,2>{0.669705093f, 0.528401971f},
-std::array<float,2>{0.0461093299f, 0.730579019f},
-std::array<float,2>{0.53817904f, 0.484553128f},
-std::array<float,2>{0.37374109f, 0.10047698f},
-std::array<float,2>{0.763576567f, 0.847665966f},
-std::array<float,2>{0.231864318f, 0.795675099f},
-std::array<float,2>{0.744779408f, 0.00678835623f},
-std::array<float,2>{0.404486835f, 0.412359476f},
-std::array<float,2>{0.955375552f, 0.634234369f},
-std::array<float,2>{0.259198219f, 0.571000457f},
-std::array<float,2>{0.814791858f, 0.300528288f},
-std::array<float,2>{0.104033455f, 0.165226489f},
-std::array<float,2>{0.611497402f, 0.908325851f},
-std::array<float,2>{0.315050483f, 0.826124907f},
-std::array<float,2>{0.782600641f, 0.0729654357f},
-std::array<float,2>{0.00386105641f, 0.459415406f},
-std::array<float,2>{0.51101619f, 0.694767892f},
-std::array<float,2>{0.173443496f, 0.561722755f},
-std::array<float,2>{0.653415203f, 0.321377099f},
-std::array<float,2>{0.497648478f, 0.199644804f},
-std::array<float,2>{0.92572844f, 0.98375237f},
-std::array<float,2>{0.0828289464f, 0.900912046f},
-std::array<float,2>{0.564173043f, 0.13302134f},
-std::array<float,2>{0.291828901f, 0.268078566f},
-std::array<float,2>{0.868381321f, 0.599906743f},
-std::array<float,2>{0.435090035f, 0.663335681f},
-std::array<float,2>{0.999579132f, 0.398779482f},
-std::array<float,2>{0.209870681f, 0.0433656946f},
-std::array<float,2>{0.710416436f, 0.775591552f},
-std::array<float,2>{0.389378369f, 0.75677675f},
-std::array<float,2>{0.951117396f, 0.0518986993f},
-std::array<float,2>{0.236866966f, 0.381605536f},
-std::array<float,2>{0.732872248f, 0.673137665f},
-std::array<float,2>{0.115019292f, 0.615345657f},
-std::array<float,2>{0.59847343f, 0.260186732f},
-std::array<float,2>{0.27697286f, 0.140852258f},
-std::array<float,2>{0.8319664f, 0.889382899f},
-std::array<float,2>{0.126670599f, 0.99866879f},
-std::array<float,2>{0.685325265f, 0.214812145f},
-std::array<float,2>{0.449450821f, 0.32981503f},
-std::array<float,2>{0.883137643f, 0.538790405f},
-std::array<float,2>{0.351617694f, 0.707611918f},
-std::array<float,2>{0.774676681f, 0.441509008f},
-std::array<float,2>{0.0510604605f, 0.0811776817f},
-std::array<float,2>{0.55404985f, 0.830404282f},
-std::array<float,2>{0.305661052f, 0.937451303f},
-std::array<float,2>{0.844478607f, 0.175532594f},
-std::array<float,2>{0.0710260049f, 0.29224661f},
-std::array<float,2>{0.588209927f, 0.587180614f},
-std::array<float,2>{0.197052971f, 0.647001207f},
-std::array<float,2>{0.692615449f, 0.424176186f},
-std::array<float,2>{0.410592616f, 0.0244500414f},
-std::array<float,2>{0.982799172f, 0.804587841f},
-std::array<float,2>{0.0268843621f, 0.870584905f},
-std::array<float,2>{0.524170339f, 0.113711633f},
-std::array<float,2>{0.338053852f, 0.481577665f},
-std::array<float,2>{0.80996877f, 0.741551518f},
-std::array<float,2>{0.475430429f, 0.500959456f},
-std::array<float,2>{0.91198957f, 0.345440298f},
-std::array<float,2>{0.171517774f, 0.24723424f},
-std::array<float,2>{0.639583111f, 0.951834202f},
-std::array<float,2>{0.417927235f, 0.875403881f},
-std::array<float,2>{0.974074423f, 0.154575348f},
-std::array<float,2>{0.190321565f, 0.257752895f},
-std::array<float,2>{0.699647069f, 0.61735183f},
-std::array<float,2>{0.0669898987f, 0.687140524f},
-std::array<float,2>{0.581165671f, 0.382970273f},
-std::array<float,2>{0.301389396f, 0.0570036247f},
-std::array<float,2>{0.859258771f, 0.764365494f},
-std::array<float,2>{0.160231784f, 0.836627364f},
-std::array<float,2>{0.63020891f, 0.0896788463f},
-std::array<float,2>{0.479157567f, 0.449598551f},
-std::array<float,2>{0.919612586f, 0.718486488f},
-std::array<float,2>{0.333599418f, 0.542662561f},
-std::array<float,2>{0.797388971f, 0.335999668f},
-std::array<float,2>{0.0212500747f, 0.203850776f},
-std::array<float,2>{0.518733621f, 0.986622632f},
-std::array<float,2>{0.266883433f, 0.810104072f},
-std::array<float,2>{0.838591456f, 0.0177073535f},
-std::array<float,2>{0.117829643f, 0.436160535f},
-std::array<float,2>{0.607519686f, 0.653270543f},
-std::array<float,2>{0.243186504f, 0.579764545f},
-std::array<float,2>{0.719563067f, 0.28897056f},
-std::array<float,2>{0.375315368f, 0.181319952f},
-std::array<float,2>{0.943232119f, 0.924148917f},
-std::array<float,2>{0.0603831634f, 0.944560349f},
-std::array<float,2>{0.560546398f, 0.239961296f},
-std::array<float,2>{0.345839083f, 0.358759046f},
-std::array<float,2>{0.768037498f, 0.512323141f},
-std::array<float,2>{0.444938391f, 0.742844224f},
-std::array<float,2>{0.876958251f, 0.471604407f},
-std::array<float,2>{0.133862764f, 0.123865515f},
-std::array<float,2>{0.672022581f, 0.859472394f},
-std::array<float,2>{0.487192839f, 0.857511103f},
-std::array<float,2>{0.936644495f, 0.103812158f},
-std::array<float,2>{0.186234832f, 0.497040778f},
-std::array<float,2>{0.646253288f, 0.721821487f},
-std::array<float,2>{0.00900076143f, 0.516857684f},
-std::array<float,2>{0.506987512f, 0.368850231f},
-std::array<float,2>{0.325729758f, 0.229638144f},
-std::array<float,2>{0.796067595f, 0.960517049f},
-std::array<float,2>{0.215606391f, 0.915631533f},
-std::array<float,2>{0.718116164f, 0.160456076f},
-std::array<float,2>{0.424917459f, 0.311948627f},
-std::array<float,2>{0.984605312f, 0.566571176f},
-std::array<float,2>{0.2822209f, 0.62761116f},
-std::array<float,2>{0.862062812f, 0.416568726f},
-std::array<float,2>{0.0935756713f, 0.00786324218f},
-std::array<float,2>{0.576675832f, 0.781472445f},
-std::array<float,2>{0.360799134f, 0.976535499f},
-std::array<float,2>{0.756734014f, 0.19047977f},
-std::array<float,2>{0.0322471671f, 0.319050044f},
-std::array<float,2>{0.543906152f, 0.551054716f},
-std::array<float,2>{0.148645863f, 0.695501447f},
-std::array<float,2>{0.663315177f, 0.466260463f},
-std::array<float,2>{0.462418795f, 0.0652075484f},
-std::array<float,2>{0.904811502f, 0.818981349f},
-std::array<float,2>{0.0978561714f, 0.766453981f},
-std::array<float,2>{0.618576944f, 0.0373604223f},
-std::array<float,2>{0.255561471f, 0.391756803f},
-std::array<float,2>{0.824495494f, 0.668463171f},
-std::array<float,2>{0.395661265f, 0.605337083f},
-std::array<float,2>{0.968257725f, 0.274768472f},
-std::array<float,2>{0.219561666f, 0.126084641f},
-std::array<float,2>{0.734929204f, 0.893208742f},
-std::array<float,2>{0.430216432f, 0.937974751f},
-std::array<float,2>{0.99268353f, 0.238222107f},
-std::array<float,2>{0.204078257f, 0.355442911f},
-std::array<float,2>{0.703479588f, 0.51009196f},
-std::array<float,2>{0.0809656084f, 0.748172581f},
-std::array<float,2>{0.568426907f, 0.475972205f},
-std::array<float,2>{0.296426862f, 0.117514968f},
-std::array<float,2>{0.871456802f, 0.866677165f},
-std::array<float,2>{0.177698418f, 0.805594683f},
-std::array<float,2>{0.650910258f, 0.0200372096f},
-std::array<float,2>{0.492863595f, 0.432171822f},
-std::array<float,2>{0.929325879f, 0.652249575f},
-std::array<float,2>{0.317762464f, 0.583955646f},
-std::array<float,2>{0.788577437f, 0.284236223f},
-std::array<float,2>{0.00434326148f, 0.184882224f},
-std::array<float,2>{0.513720036f, 0.928586602f},
-std::array<float,2>{0.264786184f, 0.840413928f},
-std::array<float,2>{0.81905061f, 0.0898714364f},
-std::array<float,2>{0.106603503f, 0.446345568f},
-std::array<float,2>{0.616306663f, 0.714534461f},
-std::array<float,2>{0.230242804f, 0.544119656f},
-std::array<float,2>{0.746385574f, 0.34103325f},
-std::array<float,2>{0.402323246f, 0.209686443f},
-std::array<float,2>{0.959530592f, 0.988956869f},
-std::array<float,2>{0.0409870893f, 0.880234659f},
-std::array<float,2>{0.532873273f, 0.148585349f},
-std::array<float,2>{0.367714882f, 0.252494335f},
-std::array<float,2>{0.760600984f, 0.622944653f},
-std::array<float,2>{0.459305853f, 0.681843758f},
-std::array<float,2>{0.892310619f, 0.388487577f},
-std::array<float,2>{0.148338035f, 0.0603782013f},
-std::array<float,2>{0.66749531f, 0.758332729f},
-std::array<float,2>{0.469726115f, 0.771071255f},
-std::array<float,2>{0.90928489f, 0.0320861787f},
-std::array<float,2>{0.166553527f, 0.395642579f},
-std::array<float,2>{0.633850813f, 0.66481477f},
-std::array<float,2>{0.0297795441f, 0.609278083f},
-std::array<float,2>{0.531202674f, 0.27936998f},
-std::array<float,2>{0.340641975f, 0.13008289f},
-std::array<float,2>{0.804756939f, 0.897397876f},
-std::array<float,2>{0.201657847f, 0.970981419f},
-std::array<float,2>{0.687982798f, 0.194779918f},
-std::array<float,2>{0.409389317f, 0.315762401f},
-std::array<float,2>{0.978830814f, 0.550269783f},
-std::array<float,2>{0.310382754f, 0.699474871f},
-std::array<float,2>{0.848385572f, 0.462593466f},
-std::array<float,2>{0.0778370127f, 0.0684289783f},
-std::array<float,2>{0.593267679f, 0.814578891f},
-std::array<float,2>{0.355736792f, 0.918043971f},
-std::array<float,2>{0.779446363f, 0.15681076f},
-std::array<float,2>{0.0503923446f, 0.306841612f},
-std::array<float,2>{0.547400773f, 0.56442976f},
-std::array<float,2>{0.130594343f, 0.632163584f},
-std::array<float,2>{0.681605101f, 0.418132484f},
-std::array<float,2>{0.448093444f, 0.0136306779f},
-std::array<float,2>{0.889633775f, 0.787059426f},
-std::array<float,2>{0.10959395f, 0.854909301f},
-std::array<float,2>{0.596465528f, 0.105676875f},
-std::array<float,2>{0.280455589f, 0.495348662f},
-std::array<float,2>{0.834732473f, 0.726555288f},
-std::array<float,2>{0.384235382f, 0.520585179f},
-std::array<float,2>{0.947728097f, 0.372765899f},
-std::array<float,2>{0.241103053f, 0.231792912f},
-std::array<float,2>{0.730110586f, 0.953927636f},
-std::array<float,2>{0.440593004f, 0.90611583f},
-std::array<float,2>{0.881086886f, 0.137324139f},
-std::array<float,2>{0.136802822f, 0.271886021f},
-std::array<float,2>{0.678230643f, 0.593876123f},
-std::array<float,2>{0.0558124743f, 0.658670545f},
-std::array<float,2>{0.555699527f, 0.404733926f},
-std::array<float,2>{0.348548144f, 0.0416096151f},
-std::array<float,2>{0.771225333f, 0.779843748f},
-std::array<float,2>{0.24897337f, 0.820680976f},
-std::array<float,2>{0.724006772f, 0.0752307847f},
-std::array<float,2>{0.382468015f, 0.456661373f},
-std::array<float,2>{0.938796878f, 0.687639594f},
-std::array<float,2>{0.27307263f, 0.555921733f},
-std::array<float,2>{0.842898905f, 0.327622771f},
-std::array<float,2>{0.121377252f, 0.197972149f},
-std::array<float,2>{0.605034292f, 0.977829039f},
-std::array<float,2>{0.331104875f, 0.789837897f},
-std::array<float,2>{0.800863743f, 0.00309887948f},
-std::array<float,2>{0.0185996816f, 0.408619642f},
-std::array<float,2>{0.521117151f, 0.640494108f},
-std::array<float,2>{0.159262285f, 0.575406551f},
-std::array<float,2>{0.626302958f, 0.30284816f},
-std::array<float,2>{0.483491808f, 0.171364278f},
-std::array<float,2>{0.914833128f, 0.911409914f},
-std::array<float,2>{0.06476634f, 0.964192629f},
-std::array<float,2>{0.582429826f, 0.225462168f},
-std::array<float,2>{0.300758511f, 0.365938574f},
-std::array<float,2>{0.851944625f, 0.523782909f},
-std::array<float,2>{0.418328375f, 0.727632821f},
-std::array<float,2>{0.969853699f, 0.491927892f},
-std::array<float,2>{0.194949314f, 0.0955236778f},
-std::array<float,2>{0.695431828f, 0.847457469f},
-std::array<float,2>{0.393234223f, 0.873319864f},
-std::array<float,2>{0.962096632f, 0.112387232f},
-std::array<float,2>{0.224204794f, 0.479696929f},
-std::array<float,2>{0.738973379f, 0.735318482f},
-std::array<float,2>{0.0964979082f, 0.506326675f},
-std::array<float,2>{0.622006357f, 0.350459367f},
-std::array<float,2>{0.250654131f, 0.244149178f},
-std::array<float,2>{0.822938561f, 0.945586622f},
-std::array<float,2>{0.153378308f, 0.930190563f},
-std::array<float,2>{0.659295797f, 0.179027438f},
-std::array<float,2>{0.466466874f, 0.293038219f},
-std::array<float,2>{0.901374698f, 0.591844976f},
-std::array<float,2>{0.365760505f, 0.644262135f},
-std::array<float,2>{0.750070274f, 0.428551883f},
-std::array<float,2>{0.0364949815f, 0.0312200282f},
-std::array<float,2>{0.540209293f, 0.800144076f},
-std::array<float,2>{0.288454771f, 0.995390892f},
-std::array<float,2>{0.866084397f, 0.216983438f},
-std::array<float,2>{0.0890334472f, 0.334483832f},
-std::array<float,2>{0.573190928f, 0.531955361f},
-std::array<float,2>{0.212420315f, 0.706940174f},
-std::array<float,2>{0.713238478f, 0.438532501f},
-std::array<float,2>{0.42872107f, 0.0842496231f},
-std::array<float,2>{0.988639176f, 0.833294988f},
-std::array<float,2>{0.0128019899f, 0.750069618f},
-std::array<float,2>{0.50247401f, 0.0478273407f},
-std::array<float,2>{0.320689112f, 0.375222683f},
-std::array<float,2>{0.790375829f, 0.676958501f},
-std::array<float,2>{0.489605933f, 0.611513376f},
-std::array<float,2>{0.933087707f, 0.264046133f},
-std::array<float,2>{0.18074201f, 0.146560445f},
-std::array<float,2>{0.644063175f, 0.885860503f},
-std::array<float,2>{0.498965234f, 0.980738819f},
-std::array<float,2>{0.922100902f, 0.20137459f},
-std::array<float,2>{0.174770772f, 0.323800385f},
-std::array<float,2>{0.655917466f, 0.559148967f},
-std::array<float,2>{0.000428770087f, 0.691688001f},
-std::array<float,2>{0.509056926f, 0.457734555f},
-std::array<float,2>{0.314290792f, 0.0711194798f},
-std::array<float,2>{0.784526348f, 0.827655733f},
-std::array<float,2>{0.208570182f, 0.774555445f},
-std::array<float,2>{0.707598388f, 0.0456874147f},
-std::array<float,2>{0.437211543f, 0.401638746f},
-std::array<float,2>{0.997552097f, 0.660687804f},
-std::array<float,2>{0.2907314f, 0.5988186f},
-std::array<float,2>{0.869185209f, 0.266996056f},
-std::array<float,2>{0.085140273f, 0.134802446f},
-std::array<float,2>{0.565533757f, 0.899400532f},
-std::array<float,2>{0.371408105f, 0.850512207f},
-std::array<float,2>{0.7647596f, 0.099403359f},
-std::array<float,2>{0.0443755463f, 0.488064289f},
-std::array<float,2>{0.536449313f, 0.732773304f},
-std::array<float,2>{0.141937554f, 0.529558837f},
-std::array<float,2>{0.669986784f, 0.360899389f},
-std::array<float,2>{0.453295559f, 0.222186968f},
-std::array<float,2>{0.897675157f, 0.967970908f},
-std::array<float,2>{0.101705395f, 0.907909632f},
-std::array<float,2>{0.610219777f, 0.167500213f},
-std::array<float,2>{0.260039002f, 0.298663318f},
-std::array<float,2>{0.814293563f, 0.572619557f},
-std::array<float,2>{0.403075397f, 0.635209441f},
-std::array<float,2>{0.953660846f, 0.410427988f},
-std::array<float,2>{0.233540922f, 0.00413439283f},
-std::array<float,2>{0.744055748f, 0.793802023f},
-std::array<float,2>{0.413405776f, 0.802448571f},
-std::array<float,2>{0.981287479f, 0.0255372114f},
-std::array<float,2>{0.197303236f, 0.42326653f},
-std::array<float,2>{0.693561673f, 0.64570719f},
-std::array<float,2>{0.0739817992f, 0.589480877f},
-std::array<float,2>{0.587520361f, 0.289900213f},
-std::array<float,2>{0.307552278f, 0.172782823f},
-std::array<float,2>{0.846526086f, 0.934489965f},
-std::array<float,2>{0.168380737f, 0.949454904f},
-std::array<float,2>{0.63851583f, 0.248640805f},
-std::array<float,2>{0.472696424f, 0.347119421f},
-std::array<float,2>{0.913523138f, 0.502382278f},
-std::array<float,2>{0.337885737f, 0.739788771f},
-std::array<float,2>{0.812474132f, 0.483314455f},
-std::array<float,2>{0.0250643659f, 0.116573557f},
-std::array<float,2>{0.526567698f, 0.868703425f},
-std::array<float,2>{0.274514616f, 0.887955368f},
-std::array<float,2>{0.829150379f, 0.143540695f},
-std::array<float,2>{0.11600779f, 0.259553373f},
-std::array<float,2>{0.60014683f, 0.614047527f},
-std::array<float,2>{0.235025987f, 0.6754601f},
-std::array<float,2>{0.732092559f, 0.380100489f},
-std::array<float,2>{0.387580991f, 0.0535559095f},
-std::array<float,2>{0.951249242f, 0.755292952f},
-std::array<float,2>{0.0543662868f, 0.829521f},
-std::array<float,2>{0.55106312f, 0.0792865828f},
-std::array<float,2>{0.355353564f, 0.443825454f},
-std::array<float,2>{0.776538014f, 0.710531831f},
-std::array<float,2>{0.451963246f, 0.535252094f},
-std::array<float,2>{0.885931313f, 0.33106786f},
-std::array<float,2>{0.127524868f, 0.211080939f},
-std::array<float,2>{0.686759591f, 0.997943163f},
-std::array<float,2>{0.377543688f, 0.92376864f},
-std::array<float,2>{0.94454062f, 0.182519957f},
-std::array<float,2>{0.245425373f, 0.285646379f},
-std::array<float,2>{0.721942842f, 0.581955254f},
-std::array<float,2>{0.120708659f, 0.655496478f},
-std::array<float,2>{0.607050002f, 0.43393299f},
-std::array<float,2>{0.268235505f, 0.0162532646f},
-std::array<float,2>{0.836913705f, 0.811160803f},
-std::array<float,2>{0.13636075f, 0.861732006f},
-std::array<float,2>{0.674525797f, 0.121116698f},
-std::array<float,2>{0.442537934f, 0.468865007f},
-std::array<float,2>{0.876239777f, 0.746083379f},
-std::array<float,2>{0.344448477f, 0.514571965f},
-std::array<float,2>{0.766263723f, 0.356252342f},
-std::array<float,2>{0.0608287975f, 0.240727007f},
-std::array<float,2>{0.56230855f, 0.942429423f},
-std::array<float,2>{0.304142922f, 0.763347387f},
-std::array<float,2>{0.855511189f, 0.0557695292f},
-std::array<float,2>{0.0686870962f, 0.386438966f},
-std::array<float,2>{0.579431534f, 0.6846385f},
-std::array<float,2>{0.18783018f, 0.620352745f},
-std::array<float,2>{0.702667415f, 0.255771399f},
-std::array<float,2>{0.414386094f, 0.152386844f},
-std::array<float,2>{0.975430906f, 0.878266931f},
-std::array<float,2>{0.0231514852f, 0.986049294f},
-std::array<float,2>{0.516264319f, 0.205142632f},
-std::array<float,2>{0.335936964f, 0.338664055f},
-std::array<float,2>{0.799652517f, 0.53988409f},
-std::array<float,2>{0.476621509f, 0.71639812f},
-std::array<float,2>{0.920693755f, 0.452975482f},
-std::array<float,2>{0.163182482f, 0.0864332989f},
-std::array<float,2>{0.631767929f, 0.839497328f},
-std::array<float,2>{0.463711947f, 0.81797874f},
-std::array<float,2>{0.903352022f, 0.0632764027f},
-std::array<float,2>{0.150710285f, 0.467174232f},
-std::array<float,2>{0.661699593f, 0.698747039f},
-std::array<float,2>{0.0347398482f, 0.553787291f},
-std::array<float,2>{0.546119392f, 0.318348706f},
-std::array<float,2>{0.362027496f, 0.187792227f},
-std::array<float,2>{0.754463315f, 0.973835886f},
-std::array<float,2>{0.222340345f, 0.890921891f},
-std::array<float,2>{0.737232685f, 0.127679214f},
-std::array<float,2>{0.396556973f, 0.276185781f},
-std::array<float,2>{0.966636539f, 0.603102267f},
-std::array<float,2>{0.255944312f, 0.671167612f},
-std::array<float,2>{0.826791167f, 0.393277049f},
-std::array<float,2>{0.100223243f, 0.0362963676f},
-std::array<float,2>{0.621052742f, 0.768251181f},
-std::array<float,2>{0.327901989f, 0.957361519f},
-std::array<float,2>{0.793162584f, 0.226787701f},
-std::array<float,2>{0.00977025926f, 0.370861918f},
-std::array<float,2>{0.5046404f, 0.518873632f},
-std::array<float,2>{0.184097588f, 0.720291495f},
-std::array<float,2>{0.646603107f, 0.499849707f},
-std::array<float,2>{0.485506952f, 0.10262958f},
-std::array<float,2>{0.935104609f, 0.856598556f},
-std::array<float,2>{0.0912062824f, 0.784745753f},
-std::array<float,2>{0.576038539f, 0.0100779068f},
-std::array<float,2>{0.283703744f, 0.41427961f},
-std::array<float,2>{0.859791398f, 0.625977755f},
-std::array<float,2>{0.421912551f, 0.569616139f},
-std::array<float,2>{0.987939119f, 0.31007722f},
-std::array<float,2>{0.218173206f, 0.162164107f},
-std::array<float,2>{0.715959191f, 0.91760999f},
-std::array<float,2>{0.409097344f, 0.970429659f},
-std::array<float,2>{0.979905188f, 0.192122787f},
-std::array<float,2>{0.202597857f, 0.313444585f},
-std::array<float,2>{0.689089537f, 0.548576057f},
-std::array<float,2>{0.0768849701f, 0.701403677f},
-std::array<float,2>{0.592490256f, 0.463371515f},
-std::array<float,2>{0.308952063f, 0.066527687f},
-std::array<float,2>{0.84896946f, 0.814081728f},
-std::array<float,2>{0.16750282f, 0.772277057f},
-std::array<float,2>{0.633129179f, 0.034344241f},
-std::array<float,2>{0.469794899f, 0.397853792f},
-std::array<float,2>{0.908608019f, 0.666788757f},
-std::array<float,2>{0.341763586f, 0.606511593f},
-std::array<float,2>{0.806301594f, 0.277369797f},
-std::array<float,2>{0.0309709217f, 0.13179116f},
-std::array<float,2>{0.529763699f, 0.895938277f},
-std::array<float,2>{0.279299229f, 0.853451073f},
-std::array<float,2>{0.835343361f, 0.109217159f},
-std::array<float,2>{0.110419251f, 0.493533313f},
-std::array<float,2>{0.597074509f, 0.722919524f},
-std::array<float,2>{0.24204132f, 0.521762311f},
-std::array<float,2>{0.729156315f, 0.373771906f},
-std::array<float,2>{0.383081347f, 0.232495636f},
-std::array<float,2>{0.948759317f, 0.955887914f},
-std::array<float,2>{0.0492093042f, 0.920011222f},
-std::array<float,2>{0.54839164f, 0.159442127f},
-std::array<float,2>{0.35713321f, 0.305530876f},
-std::array<float,2>{0.780740142f, 0.56456238f},
-std::array<float,2>{0.448638856f, 0.629748046f},
-std::array<float,2>{0.889851928f, 0.42034477f},
-std::array<float,2>{0.129037902f, 0.0152170407f},
-std::array<float,2>{0.680167258f, 0.788488805f},
-std::array<float,2>{0.493469864f, 0.808010519f},
-std::array<float,2>{0.928121567f, 0.0216565263f},
-std::array<float,2>{0.176674455f, 0.429851592f},
-std::array<float,2>{0.65159142f, 0.649488747f},
-std::array<float,2>{0.00488845399f, 0.585689008f},
-std::array<float,2>{0.514751256f, 0.282063991f},
-std::array<float,2>{0.316617936f, 0.185959518f},
-std::array<float,2>{0.787809193f, 0.926741481f},
-std::array<float,2>{0.205011904f, 0.939552188f},
-std::array<float,2>{0.704662621f, 0.2348378f},
-std::array<float,2>{0.431448787f, 0.351992846f},
-std::array<float,2>{0.994051576f, 0.509119391f},
-std::array<float,2>{0.295796484f, 0.747295558f},
-std::array<float,2>{0.872545123f, 0.474533111f},
-std::array<float,2>{0.0820252597f, 0.120409511f},
-std::array<float,2>{0.569522262f, 0.863955975f},
-std::array<float,2>{0.368418366f, 0.881529033f},
-std::array<float,2>{0.761504889f, 0.152128786f},
-std::array<float,2>{0.0395648368f, 0.25080061f},
-std::array<float,2>{0.531399846f, 0.623592377f},
-std::array<float,2>{0.146586508f, 0.681377947f},
-std::array<float,2>{0.666181922f, 0.390546978f},
-std::array<float,2>{0.460836589f, 0.0609688014f},
-std::array<float,2>{0.890763462f, 0.761010885f},
-std::array<float,2>{0.106042579f, 0.84372437f},
-std::array<float,2>{0.615850568f, 0.0930336788f},
-std::array<float,2>{0.26384443f, 0.448265105f},
-std::array<float,2>{0.81961906f, 0.711348712f},
-std::array<float,2>{0.401125938f, 0.546123385f},
-std::array<float,2>{0.960799277f, 0.342424154f},
-std::array<float,2>{0.228787154f, 0.208376288f},
-std::array<float,2>{0.747485399f, 0.9909603f},
-std::array<float,2>{0.465515703f, 0.93257159f},
-std::array<float,2>{0.900615096f, 0.177055329f},
-std::array<float,2>{0.152808696f, 0.296011657f},
-std::array<float,2>{0.65884912f, 0.590276778f},
-std::array<float,2>{0.0360224359f, 0.642354667f},
-std::array<float,2>{0.539423347f, 0.42768839f},
-std::array<float,2>{0.366739482f, 0.0277182199f},
-std::array<float,2>{0.751493454f, 0.797082126f},
-std::array<float,2>{0.222866699f, 0.872029126f},
-std::array<float,2>{0.739555955f, 0.110641651f},
-std::array<float,2>{0.394202292f, 0.478187829f},
-std::array<float,2>{0.961292207f, 0.737131536f},
-std::array<float,2>{0.25195092f, 0.504215181f},
-std::array<float,2>{0.823639989f, 0.349582165f},
-std::array<float,2>{0.0969693884f, 0.242776617f},
-std::array<float,2>{0.622765601f, 0.948255122f},
-std::array<float,2>{0.321931303f, 0.752083778f},
-std::array<float,2>{0.789096653f, 0.0497459881f},
-std::array<float,2>{0.0119083663f, 0.377510399f},
-std::array<float,2>{0.503751755f, 0.677735567f},
-std::array<float,2>{0.180333048f, 0.610099852f},
-std::array<float,2>{0.643135965f, 0.26280117f},
-std::array<float,2>{0.489077419f, 0.144805372f},
-std::array<float,2>{0.932460189f, 0.882824302f},
-std::array<float,2>{0.0882797316f, 0.992372692f},
-std::array<float,2>{0.573838651f, 0.215731397f},
-std::array<float,2>{0.287958473f, 0.333318263f},
-std::array<float,2>{0.866888881f, 0.535112202f},
-std::array<float,2>{0.427831203f, 0.704882503f},
-std::array<float,2>{0.989388108f, 0.440505296f},
-std::array<float,2>{0.211294487f, 0.0829303339f},
-std::array<float,2>{0.714236736f, 0.833990753f},
-std::array<float,2>{0.380972624f, 0.822466254f},
-std::array<float,2>{0.93783927f, 0.0772750229f},
-std::array<float,2>{0.249723807f, 0.454336345f},
-std::array<float,2>{0.722882509f, 0.689637244f},
-std::array<float,2>{0.122735746f, 0.557630002f},
-std::array<float,2>{0.604403675f, 0.325470358f},
-std::array<float,2>{0.272296369f, 0.195636272f},
-std::array<float,2>{0.842588246f, 0.980400264f},
-std::array<float,2>{0.138603881f, 0.903105974f},
-std::array<float,2>{0.678858161f, 0.140459821f},
-std::array<float,2>{0.439584136f, 0.26988095f},
-std::array<float,2>{0.882112026f, 0.596686065f},
-std::array<float,2>{0.348946154f, 0.65749222f},
-std::array<float,2>{0.769652128f, 0.40391767f},
-std::array<float,2>{0.0552399009f, 0.039973367f},
-std::array<float,2>{0.555258811f, 0.778684556f},
-std::array<float,2>{0.299319506f, 0.961824656f},
-std::array<float,2>{0.852921367f, 0.22283037f},
-std::array<float,2>{0.0660501942f, 0.364310026f},
-std::array<float,2>{0.583358824f, 0.52670753f},
-std::array<float,2>{0.194104388f, 0.729724646f},
-std::array<float,2>{0.696432233f, 0.48940286f},
-std::array<float,2>{0.419270575f, 0.0960737094f},
-std::array<float,2>{0.969445765f, 0.843769431f},
-std::array<float,2>{0.0181380026f, 0.791255593f},
-std::array<float,2>{0.520341575f, 0.00175285805f},
-std::array<float,2>{0.330813676f, 0.408107668f},
-std::array<float,2>{0.80202502f, 0.637693286f},
-std::array<float,2>{0.482592881f, 0.576690912f},
-std::array<float,2>{0.915735066f, 0.301283449f},
-std::array<float,2>{0.158727288f, 0.169043675f},
-std::array<float,2>{0.625600457f, 0.912931681f},
-std::array<float,2>{0.474318147f, 0.952186644f},
-std::array<float,2>{0.912947297f, 0.246558845f},
-std::array<float,2>{0.169839099f, 0.343999833f},
-std::array<float,2>{0.637546599f, 0.501842976f},
-std::array<float,2>{0.02354162f, 0.741096437f},
-std::array<float,2>{0.526126504f, 0.480593354f},
-std::array<float,2>{0.336760104f, 0.114626944f},
-std::array<float,2>{0.810552299f, 0.869353592f},
-std::array<float,2>{0.198768124f, 0.803597748f},
-std::array<float,2>{0.694462061f, 0.0241200496f},
-std::array<float,2>{0.412757665f, 0.425726891f},
-std::array<float,2>{0.9815799f, 0.647631109f},
-std::array<float,2>{0.308491886f, 0.586759567f},
-std::array<float,2>{0.847146511f, 0.29153946f},
-std::array<float,2>{0.0723853484f, 0.17466937f},
-std::array<float,2>{0.586850405f, 0.936416805f},
-std::array<float,2>{0.353953779f, 0.831136763f},
-std::array<float,2>{0.775954127f, 0.0804404393f},
-std::array<float,2>{0.0535971336f, 0.442508072f},
-std::array<float,2>{0.551854134f, 0.708493412f},
-std::array<float,2>{0.128425911f, 0.538018465f},
-std::array<float,2>{0.685668468f, 0.329090714f},
-std::array<float,2>{0.45240882f, 0.213270083f},
-std::array<float,2>{0.885720193f, 0.999617338f},
-std::array<float,2>{0.116312496f, 0.890213549f},
-std::array<float,2>{0.601305246f, 0.14192003f},
-std::array<float,2>{0.27427429f, 0.261366636f},
-std::array<float,2>{0.828286469f, 0.61660105f},
-std::array<float,2>{0.388135046f, 0.672713161f},
-std::array<float,2>{0.952375889f, 0.381936073f},
-std::array<float,2>{0.23541455f, 0.0513765588f},
-std::array<float,2>{0.731017709f, 0.757290065f},
-std::array<float,2>{0.435989887f, 0.777281404f},
-std::array<float,2>{0.996437073f, 0.044572264f},
-std::array<float,2>{0.207633823f, 0.399775773f},
-std::array<float,2>{0.708178461f, 0.663012803f},
-std::array<float,2>{0.0842877999f, 0.601167262f},
-std::array<float,2>{0.564709902f, 0.268637329f},
-std::array<float,2>{0.289679766f, 0.134027213f},
-std::array<float,2>{0.87075156f, 0.901601911f},
-std::array<float,2>{0.175575405f, 0.982709765f},
-std::array<float,2>{0.654902101f, 0.200627774f},
-std::array<float,2>{0.499330372f, 0.320692778f},
-std::array<float,2>{0.922875941f, 0.56140846f},
-std::array<float,2>{0.312672585f, 0.693582237f},
-std::array<float,2>{0.784178019f, 0.460708469f},
-std::array<float,2>{0.00170204963f, 0.073422879f},
-std::array<float,2>{0.508786559f, 0.825168073f},
-std::array<float,2>{0.261262834f, 0.910052896f},
-std::array<float,2>{0.812814176f, 0.164371267f},
-std::array<float,2>{0.102943979f, 0.299513906f},
-std::array<float,2>{0.610920608f, 0.571927071f},
-std::array<float,2>{0.233272359f, 0.633334816f},
-std::array<float,2>{0.742596805f, 0.413579315f},
-std::array<float,2>{0.403734118f, 0.00685516978f},
-std::array<float,2>{0.95439446f, 0.796730518f},
-std::array<float,2>{0.0431901105f, 0.849264622f},
-std::array<float,2>{0.535685778f, 0.100610502f},
-std::array<float,2>{0.372143745f, 0.48609677f},
-std::array<float,2>{0.763854682f, 0.731619716f},
-std::array<float,2>{0.454165488f, 0.527423441f},
-std::array<float,2>{0.897057652f, 0.361358494f},
-std::array<float,2>{0.141564503f, 0.218849182f},
-std::array<float,2>{0.671343267f, 0.964967012f},
-std::array<float,2>{0.397558421f, 0.894368649f},
-std::array<float,2>{0.965022206f, 0.125662178f},
-std::array<float,2>{0.221301511f, 0.273448467f},
-std::array<float,2>{0.737851322f, 0.604130089f},
-std::array<float,2>{0.101119511f, 0.669845521f},
-std::array<float,2>{0.620033443f, 0.390693128f},
-std::array<float,2>{0.257163733f, 0.0390316136f},
-std::array<float,2>{0.827294886f, 0.766764104f},
-std::array<float,2>{0.15232712f, 0.820016384f},
-std::array<float,2>{0.661128402f, 0.0654922873f},
-std::array<float,2>{0.46459797f, 0.465564817f},
-std::array<float,2>{0.90272522f, 0.696536064f},
-std::array<float,2>{0.362590075f, 0.552589834f},
-std::array<float,2>{0.755193651f, 0.319794476f},
-std::array<float,2>{0.0335884355f, 0.189684093f},
-std::array<float,2>{0.544952095f, 0.975280166f},
-std::array<float,2>{0.284379214f, 0.782744944f},
-std::array<float,2>{0.860914111f, 0.00963865407f},
-std::array<float,2>{0.0899119675f, 0.417079836f},
-std::array<float,2>{0.574726343f, 0.628281057f},
-std::array<float,2>{0.216871589f, 0.568094015f},
-std::array<float,2>{0.715448022f, 0.311081856f},
-std::array<float,2>{0.423328578f, 0.161780596f},
-std::array<float,2>{0.98672688f, 0.914358437f},
-std::array<float,2>{0.0112560932f, 0.959462464f},
-std::array<float,2>{0.505793869f, 0.229092613f},
-std::array<float,2>{0.326960564f, 0.36812526f},
-std::array<float,2>{0.794356108f, 0.516480565f},
-std::array<float,2>{0.484531909f, 0.720904648f},
-std::array<float,2>{0.933921993f, 0.497150004f},
-std::array<float,2>{0.185483277f, 0.105016537f},
-std::array<float,2>{0.647515714f, 0.858471394f},
-std::array<float,2>{0.442204386f, 0.860411048f},
-std::array<float,2>{0.875182092f, 0.124445684f},
-std::array<float,2>{0.135584548f, 0.47242108f},
-std::array<float,2>{0.675133228f, 0.744001985f},
-std::array<float,2>{0.0620923601f, 0.513410151f},
-std::array<float,2>{0.561164737f, 0.357438684f},
-std::array<float,2>{0.345119745f, 0.238856718f},
-std::array<float,2>{0.767364562f, 0.944034159f},
-std::array<float,2>{0.245043024f, 0.925139666f},
-std::array<float,2>{0.721418798f, 0.18046701f},
-std::array<float,2>{0.378555208f, 0.287362456f},
-std::array<float,2>{0.943897426f, 0.578465044f},
-std::array<float,2>{0.268701524f, 0.654042959f},
-std::array<float,2>{0.837814212f, 0.436577111f},
-std::array<float,2>{0.11939916f, 0.0187990665f},
-std::array<float,2>{0.605624914f, 0.809232056f},
-std::array<float,2>{0.334196955f, 0.988083303f},
-std::array<float,2>{0.800014436f, 0.204379156f},
-std::array<float,2>{0.0215146616f, 0.337255836f},
-std::array<float,2>{0.51663202f, 0.541267872f},
-std::array<float,2>{0.162709802f, 0.717609823f},
-std::array<float,2>{0.632763922f, 0.450290233f},
-std::array<float,2>{0.478194177f, 0.0879507288f},
-std::array<float,2>{0.921266973f, 0.837316453f},
-std::array<float,2>{0.069831349f, 0.764895022f},
-std::array<float,2>{0.578318059f, 0.0585771613f},
-std::array<float,2>{0.303257287f, 0.384722441f},
-std::array<float,2>{0.856594622f, 0.6860677f},
-std::array<float,2>{0.415798455f, 0.618388712f},
-std::array<float,2>{0.976010561f, 0.256332844f},
-std::array<float,2>{0.189127654f, 0.155569941f},
-std::array<float,2>{0.701899469f, 0.876671791f},
-std::array<float,2>{0.384829193f, 0.95423007f},
-std::array<float,2>{0.946385026f, 0.230618089f},
-std::array<float,2>{0.238628015f, 0.371627688f},
-std::array<float,2>{0.727120817f, 0.520333886f},
-std::array<float,2>{0.113225505f, 0.725274563f},
-std::array<float,2>{0.595411181f, 0.494766831f},
-std::array<float,2>{0.277831972f, 0.106723927f},
-std::array<float,2>{0.833223104f, 0.853587568f},
-std::array<float,2>{0.132004291f, 0.785318553f},
-std::array<float,2>{0.683118522f, 0.0117727648f},
-std::array<float,2>{0.446431607f, 0.419468731f},
-std::array<float,2>{0.888499558f, 0.631644428f},
-std::array<float,2>{0.357602984f, 0.562743604f},
-std::array<float,2>{0.777394772f, 0.307938308f},
-std::array<float,2>{0.0471541174f, 0.157292351f},
-std::array<float,2>{0.548860669f, 0.919359326f},
-std::array<float,2>{0.311860293f, 0.81596303f},
-std::array<float,2>{0.850756645f, 0.0699615404f},
-std::array<float,2>{0.0749279782f, 0.461213946f},
-std::array<float,2>{0.591678798f, 0.700877368f},
-std::array<float,2>{0.199337482f, 0.549399555f},
-std::array<float,2>{0.690982819f, 0.314734399f},
-std::array<float,2>{0.406944036f, 0.193687409f},
-std::array<float,2>{0.977015615f, 0.972377002f},
-std::array<float,2>{0.0275223646f, 0.897748351f},
-std::array<float,2>{0.527618587f, 0.129028827f},
-std::array<float,2>{0.343476921f, 0.280459553f},
-std::array<float,2>{0.808002651f, 0.608213067f},
-std::array<float,2>{0.471800208f, 0.665896595f},
-std::array<float,2>{0.906598032f, 0.3953605f},
-std::array<float,2>{0.165455773f, 0.0325539149f},
-std::array<float,2>{0.635536849f, 0.769897759f},
-std::array<float,2>{0.457074225f, 0.759242058f},
-std::array<float,2>{0.892827332f, 0.0588173121f},
-std::array<float,2>{0.145469517f, 0.386734962f},
-std::array<float,2>{0.664113879f, 0.683135211f},
-std::array<float,2>{0.0422130823f, 0.621627212f},
-std::array<float,2>{0.53344065f, 0.253830612f},
-std::array<float,2>{0.370192617f, 0.149763182f},
-std::array<float,2>{0.758228421f, 0.879312634f},
-std::array<float,2>{0.228218511f, 0.989627659f},
-std::array<float,2>{0.74856329f, 0.210349262f},
-std::array<float,2>{0.399830252f, 0.340037316f},
-std::array<float,2>{0.957670629f, 0.543299139f},
-std::array<float,2>{0.262698889f, 0.71342957f},
-std::array<float,2>{0.817774534f, 0.44533062f},
-std::array<float,2>{0.109307714f, 0.091559045f},
-std::array<float,2>{0.614141226f, 0.841293633f},
-std::array<float,2>{0.320307791f, 0.928726852f},
-std::array<float,2>{0.785785735f, 0.183856398f},
-std::array<float,2>{0.00682795746f, 0.283681571f},
-std::array<float,2>{0.513485372f, 0.582274497f},
-std::array<float,2>{0.177856565f, 0.651126802f},
-std::array<float,2>{0.648952961f, 0.433270842f},
-std::array<float,2>{0.49502176f, 0.0206251536f},
-std::array<float,2>{0.926725626f, 0.806535125f},
-std::array<float,2>{0.0788500234f, 0.865889192f},
-std::array<float,2>{0.567625999f, 0.118601277f},
-std::array<float,2>{0.293390751f, 0.474844724f},
-std::array<float,2>{0.873972476f, 0.749119639f},
-std::array<float,2>{0.431721002f, 0.511126757f},
-std::array<float,2>{0.995451331f, 0.353733331f},
-std::array<float,2>{0.205692634f, 0.236910433f},
-std::array<float,2>{0.706461549f, 0.938747168f},
-std::array<float,2>{0.49079448f, 0.885181546f},
-std::array<float,2>{0.930963933f, 0.14812167f},
-std::array<float,2>{0.18250376f, 0.264804959f},
-std::array<float,2>{0.64089334f, 0.612939179f},
-std::array<float,2>{0.0141522065f, 0.676021993f},
-std::array<float,2>{0.500328064f, 0.37631765f},
-std::array<float,2>{0.322341055f, 0.0481937267f},
-std::array<float,2>{0.791907191f, 0.751751781f},
-std::array<float,2>{0.214676932f, 0.832376957f},
-std::array<float,2>{0.71128881f, 0.0851356983f},
-std::array<float,2>{0.426934689f, 0.438348174f},
-std::array<float,2>{0.991155684f, 0.705838799f},
-std::array<float,2>{0.285272568f, 0.53280282f},
-std::array<float,2>{0.863693357f, 0.335078061f},
-std::array<float,2>{0.0861932114f, 0.218032539f},
-std::array<float,2>{0.570997417f, 0.994324923f},
-std::array<float,2>{0.363645792f, 0.79975754f},
-std::array<float,2>{0.753382385f, 0.0297370814f},
-std::array<float,2>{0.0384691842f, 0.429143876f},
-std::array<float,2>{0.541259766f, 0.642643571f},
-std::array<float,2>{0.15433906f, 0.593534291f},
-std::array<float,2>{0.657069564f, 0.294352233f},
-std::array<float,2>{0.46838522f, 0.178523585f},
-std::array<float,2>{0.899420559f, 0.931046665f},
-std::array<float,2>{0.0942286924f, 0.94690752f},
-std::array<float,2>{0.624594152f, 0.245588705f},
-std::array<float,2>{0.25242427f, 0.351278812f},
-std::array<float,2>{0.821246207f, 0.507664323f},
-std::array<float,2>{0.392244279f, 0.736087143f},
-std::array<float,2>{0.964210927f, 0.47859326f},
-std::array<float,2>{0.226220429f, 0.111542188f},
-std::array<float,2>{0.741110742f, 0.87436378f},
-std::array<float,2>{0.420013547f, 0.846653223f},
-std::array<float,2>{0.971164465f, 0.09461274f},
-std::array<float,2>{0.19281216f, 0.490295172f},
-std::array<float,2>{0.69799161f, 0.726591647f},
-std::array<float,2>{0.0635243133f, 0.524493158f},
-std::array<float,2>{0.584214151f, 0.367139876f},
-std::array<float,2>{0.297506183f, 0.225969762f},
-std::array<float,2>{0.855324924f, 0.963375688f},
-std::array<float,2>{0.157692179f, 0.910502553f},
-std::array<float,2>{0.628809035f, 0.170565873f},
-std::array<float,2>{0.482260615f, 0.30421555f},
-std::array<float,2>{0.917237818f, 0.574853718f},
-std::array<float,2>{0.328249127f, 0.639336884f},
-std::array<float,2>{0.804443896f, 0.409582913f},
-std::array<float,2>{0.0174380559f, 0.0020487248f},
-std::array<float,2>{0.522031903f, 0.79095906f},
-std::array<float,2>{0.271221459f, 0.977418244f},
-std::array<float,2>{0.841706097f, 0.199117899f},
-std::array<float,2>{0.124307245f, 0.326417595f},
-std::array<float,2>{0.603453577f, 0.555332422f},
-std::array<float,2>{0.248003677f, 0.689296603f},
-std::array<float,2>{0.725322545f, 0.455889702f},
-std::array<float,2>{0.379806161f, 0.074989289f},
-std::array<float,2>{0.939650238f, 0.821872354f},
-std::array<float,2>{0.0584170222f, 0.781030118f},
-std::array<float,2>{0.558257461f, 0.042782411f},
-std::array<float,2>{0.350974351f, 0.405298114f},
-std::array<float,2>{0.772266865f, 0.659988284f},
-std::array<float,2>{0.437627822f, 0.594794989f},
-std::array<float,2>{0.879998446f, 0.273112208f},
-std::array<float,2>{0.138983056f, 0.138091803f},
-std::array<float,2>{0.676570773f, 0.904532969f},
-std::array<float,2>{0.450501323f, 0.996313214f},
-std::array<float,2>{0.88394177f, 0.212771416f},
-std::array<float,2>{0.125089303f, 0.330141962f},
-std::array<float,2>{0.684426963f, 0.536421478f},
-std::array<float,2>{0.0518345125f, 0.709583104f},
-std::array<float,2>{0.552999198f, 0.444365501f},
-std::array<float,2>{0.352577746f, 0.0783417597f},
-std::array<float,2>{0.773834944f, 0.828879178f},
-std::array<float,2>{0.237819523f, 0.754873037f},
-std::array<float,2>{0.733918369f, 0.0537783429f},
-std::array<float,2>{0.38997215f, 0.378920466f},
-std::array<float,2>{0.949715197f, 0.674685061f},
-std::array<float,2>{0.275515646f, 0.614325643f},
-std::array<float,2>{0.830099523f, 0.257910907f},
-std::array<float,2>{0.114050277f, 0.144115299f},
-std::array<float,2>{0.599545181f, 0.887182772f},
-std::array<float,2>{0.338875562f, 0.867539525f},
-std::array<float,2>{0.809513867f, 0.115642846f},
-std::array<float,2>{0.0258461796f, 0.484290153f},
-std::array<float,2>{0.525324881f, 0.738813698f},
-std::array<float,2>{0.170429125f, 0.503409326f},
-std::array<float,2>{0.639662802f, 0.345881611f},
-std::array<float,2>{0.476076931f, 0.249968648f},
-std::array<float,2>{0.910520673f, 0.950571656f},
-std::array<float,2>{0.0717095062f, 0.934764683f},
-std::array<float,2>{0.589032292f, 0.173598558f},
-std::array<float,2>{0.305893153f, 0.290579081f},
-std::array<float,2>{0.845630527f, 0.588266611f},
-std::array<float,2>{0.411787361f, 0.64522332f},
-std::array<float,2>{0.983734608f, 0.421956807f},
-std::array<float,2>{0.196033016f, 0.0266175661f},
-std::array<float,2>{0.691916823f, 0.801395535f},
-std::array<float,2>{0.406125009f, 0.794690371f},
-std::array<float,2>{0.956671536f, 0.00501396041f},
-std::array<float,2>{0.231262028f, 0.41117695f},
-std::array<float,2>{0.745331407f, 0.636096179f},
-std::array<float,2>{0.105270535f, 0.573279798f},
-std::array<float,2>{0.61271292f, 0.297672361f},
-std::array<float,2>{0.257855326f, 0.166350469f},
-std::array<float,2>{0.815533519f, 0.906633496f},
-std::array<float,2>{0.14392367f, 0.967469633f},
-std::array<float,2>{0.668751001f, 0.221582383f},
-std::array<float,2>{0.456096768f, 0.359585285f},
-std::array<float,2>{0.896472275f, 0.530971825f},
-std::array<float,2>{0.374466598f, 0.733740926f},
-std::array<float,2>{0.762476027f, 0.486747921f},
-std::array<float,2>{0.0452660508f, 0.0985512957f},
-std::array<float,2>{0.537320614f, 0.851371527f},
-std::array<float,2>{0.292312384f, 0.899867535f},
-std::array<float,2>{0.86776036f, 0.136102676f},
-std::array<float,2>{0.083209753f, 0.266385853f},
-std::array<float,2>{0.563181162f, 0.598257899f},
-std::array<float,2>{0.210637063f, 0.661841154f},
-std::array<float,2>{0.709916294f, 0.400864303f},
-std::array<float,2>{0.434551895f, 0.0461732186f},
-std::array<float,2>{0.998357415f, 0.77371043f},
-std::array<float,2>{0.00259110797f, 0.826206267f},
-std::array<float,2>{0.51071012f, 0.0721186772f},
-std::array<float,2>{0.315926969f, 0.4589037f},
-std::array<float,2>{0.781549513f, 0.692420423f},
-std::array<float,2>{0.496710658f, 0.56009835f},
-std::array<float,2>{0.924264729f, 0.322420359f},
-std::array<float,2>{0.172252193f, 0.202527419f},
-std::array<float,2>{0.652785838f, 0.982093453f},
-std::array<float,2>{0.424485564f, 0.916778147f},
-std::array<float,2>{0.986266375f, 0.163244963f},
-std::array<float,2>{0.216073215f, 0.309244007f},
-std::array<float,2>{0.71689254f, 0.568464637f},
-std::array<float,2>{0.0924378037f, 0.625056267f},
-std::array<float,2>{0.577474892f, 0.415182382f},
-std::array<float,2>{0.28294602f, 0.010854071f},
-std::array<float,2>{0.863005638f, 0.784107447f},
-std::array<float,2>{0.18663016f, 0.856253505f},
-std::array<float,2>{0.645298898f, 0.102001972f},
-std::array<float,2>{0.487536252f, 0.498273343f},
-std::array<float,2>{0.935563087f, 0.719601572f},
-std::array<float,2>{0.324853957f, 0.517995f},
-std::array<float,2>{0.795150459f, 0.369387627f},
-std::array<float,2>{0.00837529078f, 0.228008166f},
-std::array<float,2>{0.506724894f, 0.958410978f},
-std::array<float,2>{0.254016519f, 0.768645823f},
-std::array<float,2>{0.825800657f, 0.036011938f},
-std::array<float,2>{0.0995595381f, 0.394477457f},
-std::array<float,2>{0.617624998f, 0.670656562f},
-std::array<float,2>{0.220144525f, 0.602411568f},
-std::array<float,2>{0.735803783f, 0.276400954f},
-std::array<float,2>{0.395276159f, 0.127978891f},
-std::array<float,2>{0.96772933f, 0.891996861f},
-std::array<float,2>{0.0321029611f, 0.973593771f},
-std::array<float,2>{0.544176221f, 0.188613072f},
-std::array<float,2>{0.359839469f, 0.316435903f},
-std::array<float,2>{0.756980121f, 0.553580344f},
-std::array<float,2>{0.461041272f, 0.697367907f},
-std::array<float,2>{0.905834794f, 0.46793434f},
-std::array<float,2>{0.149464965f, 0.0642726272f},
-std::array<float,2>{0.662691474f, 0.817199945f},
-std::array<float,2>{0.480256945f, 0.838357568f},
-std::array<float,2>{0.918726444f, 0.0873761475f},
-std::array<float,2>{0.161635637f, 0.451741338f},
-std::array<float,2>{0.628907561f, 0.715444088f},
-std::array<float,2>{0.0199093707f, 0.54088968f},
-std::array<float,2>{0.518440545f, 0.3396568f},
-std::array<float,2>{0.332264423f, 0.206134662f},
-std::array<float,2>{0.798283517f, 0.984484255f},
-std::array<float,2>{0.190843344f, 0.877571344f},
-std::array<float,2>{0.700532854f, 0.153871506f},
-std::array<float,2>{0.416638583f, 0.253959715f},
-std::array<float,2>{0.973530233f, 0.619843483f},
-std::array<float,2>{0.302219152f, 0.684160948f},
-std::array<float,2>{0.857922435f, 0.385048926f},
-std::array<float,2>{0.0679977238f, 0.0550123863f},
-std::array<float,2>{0.58086884f, 0.762594879f},
-std::array<float,2>{0.347628057f, 0.942315936f},
-std::array<float,2>{0.769359231f, 0.241594225f},
-std::array<float,2>{0.0594654195f, 0.356554359f},
-std::array<float,2>{0.559395432f, 0.515085995f},
-std::array<float,2>{0.133374736f, 0.744832397f},
-std::array<float,2>{0.673207581f, 0.469729573f},
-std::array<float,2>{0.443481863f, 0.122483127f},
-std::array<float,2>{0.878699124f, 0.862934113f},
-std::array<float,2>{0.118992954f, 0.811891973f},
-std::array<float,2>{0.608780921f, 0.0175589155f},
-std::array<float,2>{0.266586185f, 0.434714764f},
-std::array<float,2>{0.83961302f, 0.654825568f},
-std::array<float,2>{0.376091719f, 0.581035197f},
-std::array<float,2>{0.941841781f, 0.286274642f},
-std::array<float,2>{0.242880687f, 0.183218122f},
-std::array<float,2>{0.72030288f, 0.922567666f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.996299386f, 0.642977893f},
-std::array<float,2>{0.0376253985f, 0.1797093f},
-std::array<float,2>{0.282917917f, 0.879718721f},
-std::array<float,2>{0.503427386f, 0.476683497f},
-std::array<float,2>{0.728004098f, 0.756080031f},
-std::array<float,2>{0.440790445f, 0.354415804f},
-std::array<float,2>{0.241532236f, 0.560667276f},
-std::array<float,2>{0.761727333f, 0.106226906f},
-std::array<float,2>{0.817022741f, 0.988159001f},
-std::array<float,2>{0.154744923f, 0.391039461f},
-std::array<float,2>{0.428074926f, 0.718081176f},
-std::array<float,2>{0.669561982f, 0.198289812f},
-std::array<float,2>{0.611684918f, 0.564721823f},
-std::array<float,2>{0.34393838f, 0.0284836236f},
-std::array<float,2>{0.0870961845f, 0.822383285f},
-std::array<float,2>{0.877418339f, 0.312181354f},
-std::array<float,2>{0.792011201f, 0.518765152f},
-std::array<float,2>{0.194667786f, 0.0760496035f},
-std::array<float,2>{0.49904862f, 0.808804154f},
-std::array<float,2>{0.691761434f, 0.341900408f},
-std::array<float,2>{0.554278791f, 0.921145439f},
-std::array<float,2>{0.276954293f, 0.455421567f},
-std::array<float,2>{0.0232631899f, 0.670369267f},
-std::array<float,2>{0.96472615f, 0.149843767f},
-std::array<float,2>{0.933267772f, 0.869178653f},
-std::array<float,2>{0.103899203f, 0.276500642f},
-std::array<float,2>{0.32038492f, 0.618942916f},
-std::array<float,2>{0.590174377f, 0.0567750521f},
-std::array<float,2>{0.649730563f, 0.720466793f},
-std::array<float,2>{0.389700234f, 0.228849486f},
-std::array<float,2>{0.16227378f, 0.957448423f},
-std::array<float,2>{0.845814526f, 0.420374274f},
-std::array<float,2>{0.899305761f, 0.598075271f},
-std::array<float,2>{0.0708527863f, 0.0360991396f},
-std::array<float,2>{0.373931915f, 0.846610904f},
-std::array<float,2>{0.600502014f, 0.25322327f},
-std::array<float,2>{0.6845873f, 0.945098937f},
-std::array<float,2>{0.407283992f, 0.427297652f},
-std::array<float,2>{0.127560303f, 0.745216727f},
-std::array<float,2>{0.836072743f, 0.242187813f},
-std::array<float,2>{0.768908501f, 0.792615831f},
-std::array<float,2>{0.228602126f, 0.319899589f},
-std::array<float,2>{0.457221955f, 0.503115952f},
-std::array<float,2>{0.737836063f, 0.0854091868f},
-std::array<float,2>{0.527822077f, 0.68474412f},
-std::array<float,2>{0.304361999f, 0.135069773f},
-std::array<float,2>{0.0546892323f, 0.926455379f},
-std::array<float,2>{0.97810632f, 0.44340682f},
-std::array<float,2>{0.863954246f, 0.699030101f},
-std::array<float,2>{0.175653636f, 0.209879309f},
-std::array<float,2>{0.401613504f, 0.981332183f},
-std::array<float,2>{0.626565278f, 0.389331222f},
-std::array<float,2>{0.573426068f, 0.836691201f},
-std::array<float,2>{0.330751806f, 0.293964624f},
-std::array<float,2>{0.120426282f, 0.592612445f},
-std::array<float,2>{0.911071122f, 0.00185133307f},
-std::array<float,2>{0.942531228f, 0.891185999f},
-std::array<float,2>{0.0117545146f, 0.487321585f},
-std::array<float,2>{0.264840931f, 0.627040505f},
-std::array<float,2>{0.542490304f, 0.165036976f},
-std::array<float,2>{0.705493808f, 0.542725682f},
-std::array<float,2>{0.474773109f, 0.12369965f},
-std::array<float,2>{0.213077068f, 0.776948929f},
-std::array<float,2>{0.807711661f, 0.36373359f},
-std::array<float,2>{0.919969141f, 0.737539828f},
-std::array<float,2>{0.112347715f, 0.235622883f},
-std::array<float,2>{0.339102805f, 0.952624917f},
-std::array<float,2>{0.569880188f, 0.434725732f},
-std::array<float,2>{0.633168995f, 0.852806032f},
-std::array<float,2>{0.39723435f, 0.261737019f},
-std::array<float,2>{0.184445962f, 0.608798444f},
-std::array<float,2>{0.873883367f, 0.040977262f},
-std::array<float,2>{0.800310791f, 0.936788201f},
-std::array<float,2>{0.205182031f, 0.450951606f},
-std::array<float,2>{0.481142282f, 0.672428012f},
-std::array<float,2>{0.713587284f, 0.132082939f},
-std::array<float,2>{0.535578251f, 0.512786269f},
-std::array<float,2>{0.255089313f, 0.0908076018f},
-std::array<float,2>{0.00149999768f, 0.781572402f},
-std::array<float,2>{0.948825181f, 0.323578328f},
-std::array<float,2>{0.834771514f, 0.580550015f},
-std::array<float,2>{0.133782163f, 0.0112910932f},
-std::array<float,2>{0.419461161f, 0.832654417f},
-std::array<float,2>{0.67276603f, 0.289052337f},
-std::array<float,2>{0.601587117f, 0.973877907f},
-std::array<float,2>{0.365467012f, 0.378768981f},
-std::array<float,2>{0.0686956421f, 0.69487083f},
-std::array<float,2>{0.892734528f, 0.213356823f},
-std::array<float,2>{0.97083962f, 0.768860042f},
-std::array<float,2>{0.0543282367f, 0.36909911f},
-std::array<float,2>{0.309691727f, 0.535157323f},
-std::array<float,2>{0.518734038f, 0.115756363f},
-std::array<float,2>{0.749995351f, 0.635282576f},
-std::array<float,2>{0.461758107f, 0.163054317f},
-std::array<float,2>{0.221563265f, 0.900041461f},
-std::array<float,2>{0.779680967f, 0.498186946f},
-std::array<float,2>{0.956451416f, 0.554002702f},
-std::array<float,2>{0.0244265553f, 0.0967536494f},
-std::array<float,2>{0.265906543f, 0.759113669f},
-std::array<float,2>{0.556409955f, 0.350018471f},
-std::array<float,2>{0.701476753f, 0.889567256f},
-std::array<float,2>{0.491192907f, 0.476058602f},
-std::array<float,2>{0.200964704f, 0.652142107f},
-std::array<float,2>{0.787241578f, 0.172436491f},
-std::array<float,2>{0.858318329f, 0.813558698f},
-std::array<float,2>{0.166950583f, 0.30429697f},
-std::array<float,2>{0.380351245f, 0.573040545f},
-std::array<float,2>{0.645599842f, 0.0187493358f},
-std::array<float,2>{0.580732286f, 0.703639686f},
-std::array<float,2>{0.316254288f, 0.187535435f},
-std::array<float,2>{0.097628288f, 0.994146049f},
-std::array<float,2>{0.92951268f, 0.400504768f},
-std::array<float,2>{0.753837764f, 0.659650803f},
-std::array<float,2>{0.247713611f, 0.144279778f},
-std::array<float,2>{0.446973979f, 0.912616611f},
-std::array<float,2>{0.721260369f, 0.468519151f},
-std::array<float,2>{0.510861933f, 0.797062159f},
-std::array<float,2>{0.291743487f, 0.335604459f},
-std::array<float,2>{0.0454056039f, 0.528704107f},
-std::array<float,2>{0.98664999f, 0.0631591827f},
-std::array<float,2>{0.890178978f, 0.966932535f},
-std::array<float,2>{0.0791098922f, 0.409316689f},
-std::array<float,2>{0.352568239f, 0.731830418f},
-std::array<float,2>{0.624867857f, 0.223296136f},
-std::array<float,2>{0.663299501f, 0.616728127f},
-std::array<float,2>{0.437371552f, 0.0495971739f},
-std::array<float,2>{0.148112774f, 0.866489291f},
-std::array<float,2>{0.827494621f, 0.270244718f},
-std::array<float,2>{0.879843056f, 0.678526163f},
-std::array<float,2>{0.0903801024f, 0.127038524f},
-std::array<float,2>{0.350059628f, 0.932555437f},
-std::array<float,2>{0.615677118f, 0.445818603f},
-std::array<float,2>{0.666909158f, 0.78814584f},
-std::array<float,2>{0.42445603f, 0.324957907f},
-std::array<float,2>{0.148730114f, 0.508007824f},
-std::array<float,2>{0.813961446f, 0.0868548825f},
-std::array<float,2>{0.761045992f, 0.948231459f},
-std::array<float,2>{0.236814663f, 0.433522433f},
-std::array<float,2>{0.442096651f, 0.741711915f},
-std::array<float,2>{0.731430411f, 0.238775164f},
-std::array<float,2>{0.504001558f, 0.602727056f},
-std::array<float,2>{0.286523312f, 0.0431171134f},
-std::array<float,2>{0.0338880047f, 0.858165562f},
-std::array<float,2>{0.994951427f, 0.260943979f},
-std::array<float,2>{0.849436939f, 0.532832682f},
-std::array<float,2>{0.15902707f, 0.110951103f},
-std::array<float,2>{0.385352582f, 0.770000994f},
-std::array<float,2>{0.65478617f, 0.372592986f},
-std::array<float,2>{0.587070525f, 0.905635774f},
-std::array<float,2>{0.326637477f, 0.49228701f},
-std::array<float,2>{0.106990382f, 0.638926208f},
-std::array<float,2>{0.936325788f, 0.157677472f},
-std::array<float,2>{0.966858268f, 0.831923246f},
-std::array<float,2>{0.0180939417f, 0.283431143f},
-std::array<float,2>{0.279242396f, 0.584303439f},
-std::array<float,2>{0.550005257f, 0.0119857881f},
-std::array<float,2>{0.688040495f, 0.687868357f},
-std::array<float,2>{0.493128687f, 0.215149626f},
-std::array<float,2>{0.191075027f, 0.971905887f},
-std::array<float,2>{0.796673059f, 0.379589766f},
-std::array<float,2>{0.981841922f, 0.576486826f},
-std::array<float,2>{0.0599477552f, 0.0216282699f},
-std::array<float,2>{0.298540682f, 0.816861808f},
-std::array<float,2>{0.526341975f, 0.298528045f},
-std::array<float,2>{0.738738418f, 0.999992967f},
-std::array<float,2>{0.45682916f, 0.402401417f},
-std::array<float,2>{0.231352299f, 0.708484411f},
-std::array<float,2>{0.77130717f, 0.193528831f},
-std::array<float,2>{0.84005928f, 0.763827562f},
-std::array<float,2>{0.132245257f, 0.346177995f},
-std::array<float,2>{0.411545068f, 0.547032416f},
-std::array<float,2>{0.68351984f, 0.0987054482f},
-std::array<float,2>{0.596486866f, 0.654385388f},
-std::array<float,2>{0.370916307f, 0.177248135f},
-std::array<float,2>{0.0747228414f, 0.885688961f},
-std::array<float,2>{0.903833568f, 0.471638113f},
-std::array<float,2>{0.812036872f, 0.730273068f},
-std::array<float,2>{0.218274295f, 0.219281405f},
-std::array<float,2>{0.469598681f, 0.962938607f},
-std::array<float,2>{0.708743513f, 0.41207689f},
-std::array<float,2>{0.544416666f, 0.861667633f},
-std::array<float,2>{0.25967297f, 0.268477321f},
-std::array<float,2>{0.00932856556f, 0.610400438f},
-std::array<float,2>{0.940357566f, 0.0530667752f},
-std::array<float,2>{0.90710634f, 0.906332791f},
-std::array<float,2>{0.124097228f, 0.4646191f},
-std::array<float,2>{0.335163444f, 0.660507262f},
-std::array<float,2>{0.575530469f, 0.144805521f},
-std::array<float,2>{0.63014394f, 0.525718749f},
-std::array<float,2>{0.403004706f, 0.069303073f},
-std::array<float,2>{0.176284388f, 0.803290784f},
-std::array<float,2>{0.860475302f, 0.331231534f},
-std::array<float,2>{0.949944496f, 0.713543594f},
-std::array<float,2>{0.00777745992f, 0.201182529f},
-std::array<float,2>{0.252049118f, 0.991163909f},
-std::array<float,2>{0.533291042f, 0.397668481f},
-std::array<float,2>{0.718409896f, 0.827691972f},
-std::array<float,2>{0.477654099f, 0.305561244f},
-std::array<float,2>{0.21082817f, 0.568127096f},
-std::array<float,2>{0.803525805f, 0.0235928521f},
-std::array<float,2>{0.87006253f, 0.87632513f},
-std::array<float,2>{0.181178182f, 0.482512206f},
-std::array<float,2>{0.391924798f, 0.647967696f},
-std::array<float,2>{0.638557196f, 0.184265107f},
-std::array<float,2>{0.563238561f, 0.558484972f},
-std::array<float,2>{0.343320936f, 0.103782043f},
-std::array<float,2>{0.115933232f, 0.750045121f},
-std::array<float,2>{0.915706813f, 0.355757803f},
-std::array<float,2>{0.774517834f, 0.622435331f},
-std::array<float,2>{0.225613296f, 0.0600851849f},
-std::array<float,2>{0.465205997f, 0.873015761f},
-std::array<float,2>{0.744812489f, 0.278289109f},
-std::array<float,2>{0.521954536f, 0.955093503f},
-std::array<float,2>{0.305221081f, 0.415896535f},
-std::array<float,2>{0.0475571454f, 0.725832224f},
-std::array<float,2>{0.976493239f, 0.232022375f},
-std::array<float,2>{0.896544576f, 0.807922482f},
-std::array<float,2>{0.0660193712f, 0.338709652f},
-std::array<float,2>{0.359741807f, 0.520097494f},
-std::array<float,2>{0.606688976f, 0.0704583973f},
-std::array<float,2>{0.676551878f, 0.664629459f},
-std::array<float,2>{0.415732861f, 0.155220717f},
-std::array<float,2>{0.138950959f, 0.917831838f},
-std::array<float,2>{0.830388069f, 0.457682222f},
-std::array<float,2>{0.924216747f, 0.504586101f},
-std::array<float,2>{0.101325713f, 0.0788986161f},
-std::array<float,2>{0.319241524f, 0.795473814f},
-std::array<float,2>{0.585850418f, 0.314172447f},
-std::array<float,2>{0.641305327f, 0.923855662f},
-std::array<float,2>{0.37784341f, 0.440727443f},
-std::array<float,2>{0.171351567f, 0.680378497f},
-std::array<float,2>{0.855321169f, 0.139791206f},
-std::array<float,2>{0.784162819f, 0.849976361f},
-std::array<float,2>{0.196842417f, 0.254790097f},
-std::array<float,2>{0.486130297f, 0.59598279f},
-std::array<float,2>{0.696780622f, 0.0318204314f},
-std::array<float,2>{0.560231507f, 0.747188866f},
-std::array<float,2>{0.272420883f, 0.248579338f},
-std::array<float,2>{0.0299537368f, 0.938385427f},
-std::array<float,2>{0.957912445f, 0.425122589f},
-std::array<float,2>{0.823249459f, 0.630375028f},
-std::array<float,2>{0.140750691f, 0.16894947f},
-std::array<float,2>{0.429788977f, 0.895914555f},
-std::array<float,2>{0.659236252f, 0.491505921f},
-std::array<float,2>{0.620479822f, 0.777792156f},
-std::array<float,2>{0.359368086f, 0.362062961f},
-std::array<float,2>{0.0828155726f, 0.545745432f},
-std::array<float,2>{0.884693563f, 0.117794983f},
-std::array<float,2>{0.989247382f, 0.978256226f},
-std::array<float,2>{0.0407806672f, 0.386344343f},
-std::array<float,2>{0.294156522f, 0.701174974f},
-std::array<float,2>{0.513022125f, 0.205876604f},
-std::array<float,2>{0.724642217f, 0.589095533f},
-std::array<float,2>{0.450723857f, 0.00612702081f},
-std::array<float,2>{0.243306503f, 0.842386067f},
-std::array<float,2>{0.756021798f, 0.290706098f},
-std::array<float,2>{0.962619603f, 0.668176591f},
-std::array<float,2>{0.0204021204f, 0.151373982f},
-std::array<float,2>{0.274643719f, 0.919497311f},
-std::array<float,2>{0.5521878f, 0.45319286f},
-std::array<float,2>{0.694768608f, 0.810629725f},
-std::array<float,2>{0.496160716f, 0.340925068f},
-std::array<float,2>{0.192438468f, 0.516529381f},
-std::array<float,2>{0.790261686f, 0.0776454359f},
-std::array<float,2>{0.844282448f, 0.960667908f},
-std::array<float,2>{0.161982536f, 0.419289023f},
-std::array<float,2>{0.387538493f, 0.721722662f},
-std::array<float,2>{0.65181917f, 0.227023259f},
-std::array<float,2>{0.593570054f, 0.620922983f},
-std::array<float,2>{0.323612541f, 0.0557016097f},
-std::array<float,2>{0.101778753f, 0.867490709f},
-std::array<float,2>{0.930734932f, 0.274266034f},
-std::array<float,2>{0.7638973f, 0.559527397f},
-std::array<float,2>{0.239430353f, 0.108756565f},
-std::array<float,2>{0.438190252f, 0.754716337f},
-std::array<float,2>{0.728535712f, 0.35239014f},
-std::array<float,2>{0.500813067f, 0.881087363f},
-std::array<float,2>{0.284152269f, 0.478990883f},
-std::array<float,2>{0.0358878337f, 0.642177284f},
-std::array<float,2>{0.999144137f, 0.182668105f},
-std::array<float,2>{0.876581967f, 0.82204026f},
-std::array<float,2>{0.0887921229f, 0.310075134f},
-std::array<float,2>{0.346286297f, 0.562637031f},
-std::array<float,2>{0.610164046f, 0.0308925956f},
-std::array<float,2>{0.671265602f, 0.715717137f},
-std::array<float,2>{0.425973624f, 0.195410252f},
-std::array<float,2>{0.153176114f, 0.985312045f},
-std::array<float,2>{0.819947481f, 0.393048167f},
-std::array<float,2>{0.912481308f, 0.590150476f},
-std::array<float,2>{0.117758036f, 0.00197852473f},
-std::array<float,2>{0.328217626f, 0.839203298f},
-std::array<float,2>{0.572047412f, 0.296776474f},
-std::array<float,2>{0.628183663f, 0.983973503f},
-std::array<float,2>{0.40011692f, 0.388599098f},
-std::array<float,2>{0.172475189f, 0.69692409f},
-std::array<float,2>{0.865595818f, 0.208747387f},
-std::array<float,2>{0.806610286f, 0.773568869f},
-std::array<float,2>{0.212328389f, 0.366831601f},
-std::array<float,2>{0.472911119f, 0.539693952f},
-std::array<float,2>{0.703591406f, 0.121137135f},
-std::array<float,2>{0.540132284f, 0.625757396f},
-std::array<float,2>{0.26334843f, 0.167810261f},
-std::array<float,2>{0.0142284734f, 0.894513547f},
-std::array<float,2>{0.944024026f, 0.484521657f},
-std::array<float,2>{0.839828074f, 0.742828369f},
-std::array<float,2>{0.126125216f, 0.244236499f},
-std::array<float,2>{0.410009354f, 0.941856921f},
-std::array<float,2>{0.685781181f, 0.4280065f},
-std::array<float,2>{0.598724306f, 0.844680011f},
-std::array<float,2>{0.372999549f, 0.250612915f},
-std::array<float,2>{0.0724516809f, 0.601016104f},
-std::array<float,2>{0.901840985f, 0.0385829024f},
-std::array<float,2>{0.980130732f, 0.927767277f},
-std::array<float,2>{0.0576886311f, 0.442801565f},
-std::array<float,2>{0.301635116f, 0.686557353f},
-std::array<float,2>{0.530129313f, 0.132851124f},
-std::array<float,2>{0.735103726f, 0.501295328f},
-std::array<float,2>{0.459492266f, 0.0827595219f},
-std::array<float,2>{0.226973116f, 0.790331244f},
-std::array<float,2>{0.765722573f, 0.316855907f},
-std::array<float,2>{0.891331553f, 0.693108022f},
-std::array<float,2>{0.0675437078f, 0.211321995f},
-std::array<float,2>{0.364337087f, 0.974825084f},
-std::array<float,2>{0.604511678f, 0.376755893f},
-std::array<float,2>{0.674217463f, 0.834947109f},
-std::array<float,2>{0.419952691f, 0.28586033f},
-std::array<float,2>{0.136486828f, 0.57820648f},
-std::array<float,2>{0.832912385f, 0.00883600768f},
-std::array<float,2>{0.777855098f, 0.9019714f},
-std::array<float,2>{0.220451131f, 0.496142715f},
-std::array<float,2>{0.463355929f, 0.634639621f},
-std::array<float,2>{0.747407734f, 0.160395145f},
-std::array<float,2>{0.516567051f, 0.538648129f},
-std::array<float,2>{0.311088026f, 0.113826089f},
-std::array<float,2>{0.0510865003f, 0.766144156f},
-std::array<float,2>{0.969160616f, 0.370101899f},
-std::array<float,2>{0.872671366f, 0.605491281f},
-std::array<float,2>{0.187392533f, 0.0422589704f},
-std::array<float,2>{0.396219015f, 0.853857994f},
-std::array<float,2>{0.634818554f, 0.264901072f},
-std::array<float,2>{0.567710221f, 0.949246168f},
-std::array<float,2>{0.336254507f, 0.437294841f},
-std::array<float,2>{0.111317821f, 0.734702945f},
-std::array<float,2>{0.91838038f, 0.237364888f},
-std::array<float,2>{0.946069837f, 0.784965158f},
-std::array<float,2>{0.00212864252f, 0.321908921f},
-std::array<float,2>{0.257035226f, 0.514327526f},
-std::array<float,2>{0.538677871f, 0.0930663496f},
-std::array<float,2>{0.712626517f, 0.674758315f},
-std::array<float,2>{0.483920425f, 0.129024997f},
-std::array<float,2>{0.203466147f, 0.933703601f},
-std::array<float,2>{0.797813952f, 0.452579558f},
-std::array<float,2>{0.98492527f, 0.530287385f},
-std::array<float,2>{0.0448329709f, 0.0653273165f},
-std::array<float,2>{0.289631546f, 0.799112976f},
-std::array<float,2>{0.508752584f, 0.333058953f},
-std::array<float,2>{0.719001114f, 0.912078083f},
-std::array<float,2>{0.44830811f, 0.466636777f},
-std::array<float,2>{0.248281762f, 0.657728791f},
-std::array<float,2>{0.751559317f, 0.142148435f},
-std::array<float,2>{0.825339139f, 0.865131378f},
-std::array<float,2>{0.14547585f, 0.272652626f},
-std::array<float,2>{0.43400079f, 0.613678455f},
-std::array<float,2>{0.662063956f, 0.0479766056f},
-std::array<float,2>{0.622069776f, 0.73372525f},
-std::array<float,2>{0.354646683f, 0.226354301f},
-std::array<float,2>{0.0809201673f, 0.965067506f},
-std::array<float,2>{0.888396561f, 0.406785518f},
-std::array<float,2>{0.785764575f, 0.649138927f},
-std::array<float,2>{0.203042179f, 0.174527332f},
-std::array<float,2>{0.488496721f, 0.887441039f},
-std::array<float,2>{0.700870097f, 0.474357992f},
-std::array<float,2>{0.557680488f, 0.760825038f},
-std::array<float,2>{0.269252509f, 0.34926632f},
-std::array<float,2>{0.0256360602f, 0.552560031f},
-std::array<float,2>{0.953275621f, 0.0948171541f},
-std::array<float,2>{0.925850391f, 0.992738187f},
-std::array<float,2>{0.0939284787f, 0.399838388f},
-std::array<float,2>{0.313428968f, 0.705827594f},
-std::array<float,2>{0.579480827f, 0.19034861f},
-std::array<float,2>{0.648210287f, 0.570879102f},
-std::array<float,2>{0.381837577f, 0.0170922261f},
-std::array<float,2>{0.164603755f, 0.815078259f},
-std::array<float,2>{0.856477916f, 0.302670449f},
-std::array<float,2>{0.933801711f, 0.636777043f},
-std::array<float,2>{0.109054372f, 0.158291593f},
-std::array<float,2>{0.324669033f, 0.902362168f},
-std::array<float,2>{0.588826299f, 0.496013433f},
-std::array<float,2>{0.653981447f, 0.771538615f},
-std::array<float,2>{0.383620292f, 0.373159498f},
-std::array<float,2>{0.157446802f, 0.53476578f},
-std::array<float,2>{0.850708485f, 0.112960309f},
-std::array<float,2>{0.794874132f, 0.970135212f},
-std::array<float,2>{0.187798992f, 0.381585181f},
-std::array<float,2>{0.495116681f, 0.689862728f},
-std::array<float,2>{0.690614402f, 0.218582332f},
-std::array<float,2>{0.546992719f, 0.583660483f},
-std::array<float,2>{0.280633658f, 0.0143364919f},
-std::array<float,2>{0.0173010379f, 0.82910651f},
-std::array<float,2>{0.966658175f, 0.283128023f},
-std::array<float,2>{0.816174805f, 0.511537015f},
-std::array<float,2>{0.150943905f, 0.0885007381f},
-std::array<float,2>{0.422205061f, 0.785245478f},
-std::array<float,2>{0.665846109f, 0.328122526f},
-std::array<float,2>{0.614353895f, 0.929870546f},
-std::array<float,2>{0.349012911f, 0.449195981f},
-std::array<float,2>{0.0934681892f, 0.677535832f},
-std::array<float,2>{0.881348729f, 0.126169801f},
-std::array<float,2>{0.992513418f, 0.856387258f},
-std::array<float,2>{0.0313378051f, 0.25781706f},
-std::array<float,2>{0.288346618f, 0.605394185f},
-std::array<float,2>{0.505959809f, 0.045619946f},
-std::array<float,2>{0.734176278f, 0.739541292f},
-std::array<float,2>{0.444118202f, 0.240528539f},
-std::array<float,2>{0.236309379f, 0.945533633f},
-std::array<float,2>{0.75836724f, 0.429951012f},
-std::array<float,2>{0.938984036f, 0.612110019f},
-std::array<float,2>{0.0111047709f, 0.0514948331f},
-std::array<float,2>{0.259856731f, 0.859386086f},
-std::array<float,2>{0.545457602f, 0.265986383f},
-std::array<float,2>{0.710846901f, 0.962863922f},
-std::array<float,2>{0.472359896f, 0.4131625f},
-std::array<float,2>{0.216655597f, 0.726930201f},
-std::array<float,2>{0.809340477f, 0.222262502f},
-std::array<float,2>{0.861417055f, 0.800863087f},
-std::array<float,2>{0.178961575f, 0.328457266f},
-std::array<float,2>{0.404419512f, 0.523824453f},
-std::array<float,2>{0.632647157f, 0.0670871437f},
-std::array<float,2>{0.576520801f, 0.663557231f},
-std::array<float,2>{0.333247155f, 0.147575811f},
-std::array<float,2>{0.121405631f, 0.9096843f},
-std::array<float,2>{0.908451259f, 0.462429881f},
-std::array<float,2>{0.773025036f, 0.710585713f},
-std::array<float,2>{0.232865945f, 0.193081751f},
-std::array<float,2>{0.454622179f, 0.997459352f},
-std::array<float,2>{0.74182272f, 0.405256361f},
-std::array<float,2>{0.525215447f, 0.818751335f},
-std::array<float,2>{0.299485594f, 0.299075961f},
-std::array<float,2>{0.0620588325f, 0.576135039f},
-std::array<float,2>{0.983353138f, 0.0195572115f},
-std::array<float,2>{0.904659152f, 0.883792818f},
-std::array<float,2>{0.0765808672f, 0.469047576f},
-std::array<float,2>{0.368089616f, 0.653735042f},
-std::array<float,2>{0.594578862f, 0.177957729f},
-std::array<float,2>{0.67980206f, 0.550261319f},
-std::array<float,2>{0.412702382f, 0.101491213f},
-std::array<float,2>{0.129945964f, 0.76331383f},
-std::array<float,2>{0.842406094f, 0.3437832f},
-std::array<float,2>{0.972692251f, 0.723274052f},
-std::array<float,2>{0.0506538823f, 0.233507305f},
-std::array<float,2>{0.307942301f, 0.9540236f},
-std::array<float,2>{0.519856513f, 0.417308182f},
-std::array<float,2>{0.744068503f, 0.874391735f},
-std::array<float,2>{0.467653573f, 0.280058086f},
-std::array<float,2>{0.223916605f, 0.623729408f},
-std::array<float,2>{0.77585578f, 0.0623909011f},
-std::array<float,2>{0.829838097f, 0.914084196f},
-std::array<float,2>{0.138276935f, 0.459583521f},
-std::array<float,2>{0.416065693f, 0.667858779f},
-std::array<float,2>{0.678075314f, 0.153068349f},
-std::array<float,2>{0.608944833f, 0.522720158f},
-std::array<float,2>{0.362875134f, 0.0725888386f},
-std::array<float,2>{0.0635359436f, 0.805033028f},
-std::array<float,2>{0.895651519f, 0.336671025f},
-std::array<float,2>{0.80120641f, 0.569870651f},
-std::array<float,2>{0.207572222f, 0.0269651581f},
-std::array<float,2>{0.478648245f, 0.825760186f},
-std::array<float,2>{0.716023266f, 0.308555871f},
-std::array<float,2>{0.533063114f, 0.990047157f},
-std::array<float,2>{0.251628399f, 0.395781577f},
-std::array<float,2>{0.00390927074f, 0.711004317f},
-std::array<float,2>{0.95268178f, 0.200254902f},
-std::array<float,2>{0.917635858f, 0.753448367f},
-std::array<float,2>{0.113434061f, 0.359229654f},
-std::array<float,2>{0.341592133f, 0.556390882f},
-std::array<float,2>{0.565889895f, 0.102530435f},
-std::array<float,2>{0.639207125f, 0.644968569f},
-std::array<float,2>{0.392687917f, 0.18706055f},
-std::array<float,2>{0.182427004f, 0.877809644f},
-std::array<float,2>{0.867944479f, 0.48117739f},
-std::array<float,2>{0.884820044f, 0.544813633f},
-std::array<float,2>{0.0853350684f, 0.119633906f},
-std::array<float,2>{0.357277215f, 0.780929446f},
-std::array<float,2>{0.618234575f, 0.36055389f},
-std::array<float,2>{0.657916605f, 0.896696031f},
-std::array<float,2>{0.432726711f, 0.489010721f},
-std::array<float,2>{0.143959716f, 0.631611228f},
-std::array<float,2>{0.821427763f, 0.171763673f},
-std::array<float,2>{0.755529404f, 0.839845955f},
-std::array<float,2>{0.244308025f, 0.291542023f},
-std::array<float,2>{0.452402323f, 0.587715328f},
-std::array<float,2>{0.723303974f, 0.00514617143f},
-std::array<float,2>{0.514332831f, 0.699913919f},
-std::array<float,2>{0.295184165f, 0.204266965f},
-std::array<float,2>{0.0421117097f, 0.979931116f},
-std::array<float,2>{0.990693092f, 0.384422183f},
-std::array<float,2>{0.851954103f, 0.683333635f},
-std::array<float,2>{0.169267014f, 0.138233632f},
-std::array<float,2>{0.37530902f, 0.923063934f},
-std::array<float,2>{0.644525707f, 0.439258754f},
-std::array<float,2>{0.583098471f, 0.794882298f},
-std::array<float,2>{0.316486806f, 0.314774573f},
-std::array<float,2>{0.0982805192f, 0.507351518f},
-std::array<float,2>{0.923119247f, 0.0807174593f},
-std::array<float,2>{0.960291624f, 0.940189838f},
-std::array<float,2>{0.0288466699f, 0.422346085f},
-std::array<float,2>{0.270457327f, 0.749509931f},
-std::array<float,2>{0.562440336f, 0.246469706f},
-std::array<float,2>{0.699073911f, 0.594056487f},
-std::array<float,2>{0.486367911f, 0.034262713f},
-std::array<float,2>{0.198500946f, 0.849195302f},
-std::array<float,2>{0.782131553f, 0.256643116f},
-std::array<float,2>{0.976982832f, 0.686318874f},
-std::array<float,2>{0.0560390428f, 0.134438843f},
-std::array<float,2>{0.303217441f, 0.929246128f},
-std::array<float,2>{0.529086232f, 0.441555887f},
-std::array<float,2>{0.737210691f, 0.789773762f},
-std::array<float,2>{0.45884198f, 0.317491561f},
-std::array<float,2>{0.230362043f, 0.500449061f},
-std::array<float,2>{0.768010676f, 0.0836413503f},
-std::array<float,2>{0.836942255f, 0.942724645f},
-std::array<float,2>{0.128710181f, 0.429396749f},
-std::array<float,2>{0.406868875f, 0.743329585f},
-std::array<float,2>{0.684497535f, 0.245475069f},
-std::array<float,2>{0.601274252f, 0.599704444f},
-std::array<float,2>{0.374973208f, 0.0373216197f},
-std::array<float,2>{0.0718094781f, 0.844844162f},
-std::array<float,2>{0.900099099f, 0.251844049f},
-std::array<float,2>{0.807171822f, 0.540964305f},
-std::array<float,2>{0.213895947f, 0.122445054f},
-std::array<float,2>{0.476077676f, 0.77489233f},
-std::array<float,2>{0.706554711f, 0.365742326f},
-std::array<float,2>{0.541853905f, 0.892925441f},
-std::array<float,2>{0.264406651f, 0.485855937f},
-std::array<float,2>{0.0132880202f, 0.62686342f},
-std::array<float,2>{0.941808105f, 0.16673024f},
-std::array<float,2>{0.911292732f, 0.838013232f},
-std::array<float,2>{0.119646728f, 0.29586336f},
-std::array<float,2>{0.331852645f, 0.590982914f},
-std::array<float,2>{0.572373867f, 0.00360533618f},
-std::array<float,2>{0.625207901f, 0.696288526f},
-std::array<float,2>{0.400857478f, 0.207371846f},
-std::array<float,2>{0.17413415f, 0.983199239f},
-std::array<float,2>{0.864333153f, 0.387196273f},
-std::array<float,2>{0.878530085f, 0.564124584f},
-std::array<float,2>{0.0861109793f, 0.0295807272f},
-std::array<float,2>{0.345649004f, 0.821126044f},
-std::array<float,2>{0.612641811f, 0.309484333f},
-std::array<float,2>{0.668751359f, 0.985438108f},
-std::array<float,2>{0.428869218f, 0.394521475f},
-std::array<float,2>{0.155687958f, 0.716459572f},
-std::array<float,2>{0.818073273f, 0.19701831f},
-std::array<float,2>{0.763414264f, 0.755087197f},
-std::array<float,2>{0.240248591f, 0.353165418f},
-std::array<float,2>{0.439568132f, 0.559727669f},
-std::array<float,2>{0.726586282f, 0.107741691f},
-std::array<float,2>{0.502857685f, 0.641431391f},
-std::array<float,2>{0.281792969f, 0.181980595f},
-std::array<float,2>{0.0387714878f, 0.882079184f},
-std::array<float,2>{0.997394204f, 0.47990033f},
-std::array<float,2>{0.847329497f, 0.721542001f},
-std::array<float,2>{0.163658351f, 0.228284448f},
-std::array<float,2>{0.38882342f, 0.959660649f},
-std::array<float,2>{0.649257183f, 0.418194383f},
-std::array<float,2>{0.591714621f, 0.868931413f},
-std::array<float,2>{0.321813494f, 0.275051445f},
-std::array<float,2>{0.104661256f, 0.619910598f},
-std::array<float,2>{0.93189919f, 0.0554785319f},
-std::array<float,2>{0.963262439f, 0.918210566f},
-std::array<float,2>{0.0218052417f, 0.454155385f},
-std::array<float,2>{0.275586396f, 0.669183493f},
-std::array<float,2>{0.553599536f, 0.150781557f},
-std::array<float,2>{0.692516565f, 0.516782105f},
-std::array<float,2>{0.499005735f, 0.0765369982f},
-std::array<float,2>{0.193651244f, 0.812490642f},
-std::array<float,2>{0.791775823f, 0.340533525f},
-std::array<float,2>{0.928135455f, 0.706879914f},
-std::array<float,2>{0.0962471217f, 0.190703571f},
-std::array<float,2>{0.314525187f, 0.994124353f},
-std::array<float,2>{0.58176595f, 0.39855817f},
-std::array<float,2>{0.644616723f, 0.816095829f},
-std::array<float,2>{0.379835784f, 0.301192939f},
-std::array<float,2>{0.167247787f, 0.57160145f},
-std::array<float,2>{0.858578742f, 0.0159896854f},
-std::array<float,2>{0.788532734f, 0.888005376f},
-std::array<float,2>{0.19945468f, 0.473335207f},
-std::array<float,2>{0.492006391f, 0.649811864f},
-std::array<float,2>{0.70231837f, 0.175663263f},
-std::array<float,2>{0.554956675f, 0.551414371f},
-std::array<float,2>{0.267520607f, 0.0944293514f},
-std::array<float,2>{0.0239055455f, 0.760694861f},
-std::array<float,2>{0.955208242f, 0.347966433f},
-std::array<float,2>{0.827026963f, 0.61463362f},
-std::array<float,2>{0.147434905f, 0.0470912419f},
-std::array<float,2>{0.43621397f, 0.863556504f},
-std::array<float,2>{0.662373662f, 0.272048086f},
-std::array<float,2>{0.623520911f, 0.966431201f},
-std::array<float,2>{0.352383375f, 0.407256365f},
-std::array<float,2>{0.0787895098f, 0.732715249f},
-std::array<float,2>{0.888930261f, 0.225163281f},
-std::array<float,2>{0.987606943f, 0.800225198f},
-std::array<float,2>{0.0466646664f, 0.332585543f},
-std::array<float,2>{0.292606086f, 0.530258f},
-std::array<float,2>{0.510487258f, 0.0661947951f},
-std::array<float,2>{0.722374618f, 0.657101572f},
-std::array<float,2>{0.445606291f, 0.141352162f},
-std::array<float,2>{0.246864781f, 0.910984635f},
-std::array<float,2>{0.752123833f, 0.465579301f},
-std::array<float,2>{0.947477281f, 0.515559912f},
-std::array<float,2>{0.000953769428f, 0.0926990062f},
-std::array<float,2>{0.253935307f, 0.783255875f},
-std::array<float,2>{0.536761165f, 0.321132362f},
-std::array<float,2>{0.714611053f, 0.935370028f},
-std::array<float,2>{0.482313156f, 0.451362818f},
-std::array<float,2>{0.20658733f, 0.675453544f},
-std::array<float,2>{0.79908967f, 0.13012816f},
-std::array<float,2>{0.874074578f, 0.855424464f},
-std::array<float,2>{0.185008958f, 0.264642179f},
-std::array<float,2>{0.397920579f, 0.606456816f},
-std::array<float,2>{0.63406235f, 0.0417646356f},
-std::array<float,2>{0.56838733f, 0.735992074f},
-std::array<float,2>{0.338066041f, 0.236468628f},
-std::array<float,2>{0.111501411f, 0.95079881f},
-std::array<float,2>{0.921011627f, 0.435762465f},
-std::array<float,2>{0.781027913f, 0.63281548f},
-std::array<float,2>{0.221924946f, 0.162025094f},
-std::array<float,2>{0.462676078f, 0.90134567f},
-std::array<float,2>{0.748658061f, 0.497767091f},
-std::array<float,2>{0.517744064f, 0.767058849f},
-std::array<float,2>{0.308849812f, 0.370247036f},
-std::array<float,2>{0.0534025654f, 0.537896812f},
-std::array<float,2>{0.972645819f, 0.114509955f},
-std::array<float,2>{0.894491732f, 0.975586891f},
-std::array<float,2>{0.0695820153f, 0.375696003f},
-std::array<float,2>{0.367043048f, 0.691700518f},
-std::array<float,2>{0.603405476f, 0.212701246f},
-std::array<float,2>{0.672992527f, 0.579825819f},
-std::array<float,2>{0.418617219f, 0.0080171749f},
-std::array<float,2>{0.133970365f, 0.835231841f},
-std::array<float,2>{0.83551842f, 0.286764324f},
-std::array<float,2>{0.90299201f, 0.652951121f},
-std::array<float,2>{0.0754149854f, 0.178906605f},
-std::array<float,2>{0.369859934f, 0.883738577f},
-std::array<float,2>{0.597116053f, 0.470088392f},
-std::array<float,2>{0.682358086f, 0.761861801f},
-std::array<float,2>{0.410526663f, 0.345582366f},
-std::array<float,2>{0.131442532f, 0.549757421f},
-std::array<float,2>{0.841664672f, 0.100084044f},
-std::array<float,2>{0.769994557f, 0.997042894f},
-std::array<float,2>{0.231471017f, 0.405470252f},
-std::array<float,2>{0.455867738f, 0.709442556f},
-std::array<float,2>{0.739586771f, 0.191813588f},
-std::array<float,2>{0.527161956f, 0.574654043f},
-std::array<float,2>{0.297582507f, 0.0213095974f},
-std::array<float,2>{0.0588986464f, 0.82027173f},
-std::array<float,2>{0.981009305f, 0.300365001f},
-std::array<float,2>{0.859930933f, 0.524907231f},
-std::array<float,2>{0.176794171f, 0.0674075335f},
-std::array<float,2>{0.40370059f, 0.802584648f},
-std::array<float,2>{0.629289746f, 0.330019116f},
-std::array<float,2>{0.574628532f, 0.909021556f},
-std::array<float,2>{0.334866852f, 0.461264968f},
-std::array<float,2>{0.123933151f, 0.662847579f},
-std::array<float,2>{0.907521367f, 0.146789551f},
-std::array<float,2>{0.940565169f, 0.860647917f},
-std::array<float,2>{0.0085756341f, 0.266952217f},
-std::array<float,2>{0.258498996f, 0.613051772f},
-std::array<float,2>{0.543196499f, 0.051904615f},
-std::array<float,2>{0.707828999f, 0.727769434f},
-std::array<float,2>{0.469905108f, 0.221005812f},
-std::array<float,2>{0.217418149f, 0.961214781f},
-std::array<float,2>{0.811008453f, 0.412133664f},
-std::array<float,2>{0.996084094f, 0.604136586f},
-std::array<float,2>{0.0344660468f, 0.0466584153f},
-std::array<float,2>{0.285322458f, 0.856596887f},
-std::array<float,2>{0.504882872f, 0.259431422f},
-std::array<float,2>{0.731551051f, 0.946495593f},
-std::array<float,2>{0.442940772f, 0.431072026f},
-std::array<float,2>{0.23760657f, 0.738801777f},
-std::array<float,2>{0.759915352f, 0.241518065f},
-std::array<float,2>{0.812616825f, 0.786174655f},
-std::array<float,2>{0.150003552f, 0.326388866f},
-std::array<float,2>{0.425137848f, 0.510624945f},
-std::array<float,2>{0.667811453f, 0.0896809697f},
-std::array<float,2>{0.616813362f, 0.676754594f},
-std::array<float,2>{0.351052403f, 0.125508547f},
-std::array<float,2>{0.0911270082f, 0.93123138f},
-std::array<float,2>{0.88058573f, 0.447310179f},
-std::array<float,2>{0.795435369f, 0.691130459f},
-std::array<float,2>{0.190055102f, 0.217372313f},
-std::array<float,2>{0.494110286f, 0.969362557f},
-std::array<float,2>{0.689098716f, 0.382604063f},
-std::array<float,2>{0.549579859f, 0.828414023f},
-std::array<float,2>{0.27823773f, 0.281458974f},
-std::array<float,2>{0.019369442f, 0.582232654f},
-std::array<float,2>{0.967808068f, 0.0149624981f},
-std::array<float,2>{0.937122881f, 0.90363723f},
-std::array<float,2>{0.106186517f, 0.495033056f},
-std::array<float,2>{0.327827662f, 0.637808621f},
-std::array<float,2>{0.586702466f, 0.159485817f},
-std::array<float,2>{0.655312538f, 0.533632517f},
-std::array<float,2>{0.386289746f, 0.112274066f},
-std::array<float,2>{0.160105869f, 0.772803485f},
-std::array<float,2>{0.847801924f, 0.37404567f},
-std::array<float,2>{0.958338082f, 0.748290062f},
-std::array<float,2>{0.0308229178f, 0.247133687f},
-std::array<float,2>{0.273128778f, 0.940613389f},
-std::array<float,2>{0.558728755f, 0.423685938f},
-std::array<float,2>{0.695407271f, 0.848189831f},
-std::array<float,2>{0.48489058f, 0.257416129f},
-std::array<float,2>{0.195616722f, 0.594789565f},
-std::array<float,2>{0.78513819f, 0.0337668657f},
-std::array<float,2>{0.853619814f, 0.922696888f},
-std::array<float,2>{0.170600697f, 0.437567711f},
-std::array<float,2>{0.378264755f, 0.682429671f},
-std::array<float,2>{0.642098963f, 0.137166739f},
-std::array<float,2>{0.584759951f, 0.506193638f},
-std::array<float,2>{0.319868147f, 0.0815366954f},
-std::array<float,2>{0.0996109247f, 0.793564439f},
-std::array<float,2>{0.925718904f, 0.316285849f},
-std::array<float,2>{0.757494152f, 0.586268663f},
-std::array<float,2>{0.243155181f, 0.00428892812f},
-std::array<float,2>{0.449682146f, 0.841685593f},
-std::array<float,2>{0.726385534f, 0.291999638f},
-std::array<float,2>{0.511997819f, 0.978952408f},
-std::array<float,2>{0.293243974f, 0.383386075f},
-std::array<float,2>{0.0400302075f, 0.70036608f},
-std::array<float,2>{0.989692032f, 0.203165278f},
-std::array<float,2>{0.88309741f, 0.780148923f},
-std::array<float,2>{0.083684884f, 0.359993786f},
-std::array<float,2>{0.3580845f, 0.54351604f},
-std::array<float,2>{0.619239151f, 0.120601572f},
-std::array<float,2>{0.658485472f, 0.63224113f},
-std::array<float,2>{0.431513488f, 0.170372412f},
-std::array<float,2>{0.141710952f, 0.898424089f},
-std::array<float,2>{0.822810113f, 0.489914984f},
-std::array<float,2>{0.91495204f, 0.555064857f},
-std::array<float,2>{0.11643628f, 0.103368253f},
-std::array<float,2>{0.341871709f, 0.752613783f},
-std::array<float,2>{0.56366688f, 0.357887179f},
-std::array<float,2>{0.637120724f, 0.878543735f},
-std::array<float,2>{0.390681982f, 0.482204944f},
-std::array<float,2>{0.180246934f, 0.646125019f},
-std::array<float,2>{0.870871544f, 0.185949549f},
-std::array<float,2>{0.80443573f, 0.824278533f},
-std::array<float,2>{0.209316149f, 0.3069489f},
-std::array<float,2>{0.477210253f, 0.568584561f},
-std::array<float,2>{0.717529178f, 0.0258546229f},
-std::array<float,2>{0.534982324f, 0.712516189f},
-std::array<float,2>{0.253635287f, 0.199597225f},
-std::array<float,2>{0.00680270046f, 0.989070475f},
-std::array<float,2>{0.950698078f, 0.395178288f},
-std::array<float,2>{0.831178844f, 0.666926205f},
-std::array<float,2>{0.139884636f, 0.154046401f},
-std::array<float,2>{0.414471239f, 0.916007102f},
-std::array<float,2>{0.677656233f, 0.460788906f},
-std::array<float,2>{0.606425643f, 0.806044519f},
-std::array<float,2>{0.360602647f, 0.337277114f},
-std::array<float,2>{0.0654079318f, 0.522001147f},
-std::array<float,2>{0.897629678f, 0.0733843446f},
-std::array<float,2>{0.974793673f, 0.954375565f},
-std::array<float,2>{0.0485561341f, 0.416985154f},
-std::array<float,2>{0.306286037f, 0.723687947f},
-std::array<float,2>{0.522969246f, 0.232485637f},
-std::array<float,2>{0.745536208f, 0.624881327f},
-std::array<float,2>{0.466555655f, 0.0610162392f},
-std::array<float,2>{0.224906996f, 0.873791993f},
-std::array<float,2>{0.774153292f, 0.280451119f},
-std::array<float,2>{0.945174932f, 0.628783345f},
-std::array<float,2>{0.0150086479f, 0.165404543f},
-std::array<float,2>{0.262347013f, 0.891853452f},
-std::array<float,2>{0.539591193f, 0.487027556f},
-std::array<float,2>{0.704760373f, 0.775623322f},
-std::array<float,2>{0.473790377f, 0.36463806f},
-std::array<float,2>{0.211904854f, 0.541352153f},
-std::array<float,2>{0.805284321f, 0.124613285f},
-std::array<float,2>{0.866716564f, 0.982108414f},
-std::array<float,2>{0.173605174f, 0.39061299f},
-std::array<float,2>{0.398932278f, 0.698194146f},
-std::array<float,2>{0.627150953f, 0.210596025f},
-std::array<float,2>{0.571079612f, 0.593141317f},
-std::array<float,2>{0.329371214f, 0.000939412683f},
-std::array<float,2>{0.118579917f, 0.837099373f},
-std::array<float,2>{0.913316309f, 0.293335199f},
-std::array<float,2>{0.766618788f, 0.502654493f},
-std::array<float,2>{0.228180349f, 0.0846900716f},
-std::array<float,2>{0.460071981f, 0.791214585f},
-std::array<float,2>{0.73628664f, 0.319262773f},
-std::array<float,2>{0.53044802f, 0.927546799f},
-std::array<float,2>{0.302658588f, 0.445141524f},
-std::array<float,2>{0.0573589392f, 0.68395859f},
-std::array<float,2>{0.978808403f, 0.136579067f},
-std::array<float,2>{0.900696814f, 0.84718442f},
-std::array<float,2>{0.0734682158f, 0.252884924f},
-std::array<float,2>{0.3711932f, 0.599407077f},
-std::array<float,2>{0.59766537f, 0.0365355574f},
-std::array<float,2>{0.687143445f, 0.744381726f},
-std::array<float,2>{0.408575177f, 0.243690982f},
-std::array<float,2>{0.125545949f, 0.943586409f},
-std::array<float,2>{0.838488281f, 0.426297963f},
-std::array<float,2>{0.930167615f, 0.617548048f},
-std::array<float,2>{0.10292574f, 0.0583836772f},
-std::array<float,2>{0.322917432f, 0.870893776f},
-std::array<float,2>{0.592259943f, 0.275622338f},
-std::array<float,2>{0.650771916f, 0.958218277f},
-std::array<float,2>{0.388072014f, 0.420994818f},
-std::array<float,2>{0.16037026f, 0.719176173f},
-std::array<float,2>{0.84569025f, 0.229733601f},
-std::array<float,2>{0.789069533f, 0.810472488f},
-std::array<float,2>{0.192319795f, 0.343129754f},
-std::array<float,2>{0.49766469f, 0.517634988f},
-std::array<float,2>{0.693389893f, 0.0749166459f},
-std::array<float,2>{0.550901234f, 0.671765447f},
-std::array<float,2>{0.273438454f, 0.14928557f},
-std::array<float,2>{0.0209544469f, 0.920669615f},
-std::array<float,2>{0.961297512f, 0.456350416f},
-std::array<float,2>{0.818751454f, 0.717218399f},
-std::array<float,2>{0.153755769f, 0.198007643f},
-std::array<float,2>{0.427160054f, 0.986566067f},
-std::array<float,2>{0.670768797f, 0.392146051f},
-std::array<float,2>{0.610996485f, 0.823590517f},
-std::array<float,2>{0.347382903f, 0.310979813f},
-std::array<float,2>{0.0893367827f, 0.565517664f},
-std::array<float,2>{0.875954926f, 0.0279187579f},
-std::array<float,2>{0.998679876f, 0.880473375f},
-std::array<float,2>{0.0368113965f, 0.477974355f},
-std::array<float,2>{0.285112649f, 0.643793881f},
-std::array<float,2>{0.501661301f, 0.181457698f},
-std::array<float,2>{0.730377674f, 0.56154418f},
-std::array<float,2>{0.43886748f, 0.107071467f},
-std::array<float,2>{0.238742262f, 0.757131338f},
-std::array<float,2>{0.765608847f, 0.354968578f},
-std::array<float,2>{0.887508273f, 0.730731964f},
-std::array<float,2>{0.0815557018f, 0.223792538f},
-std::array<float,2>{0.354356974f, 0.96827358f},
-std::array<float,2>{0.622097492f, 0.409010351f},
-std::array<float,2>{0.660743535f, 0.865699232f},
-std::array<float,2>{0.435366541f, 0.271067053f},
-std::array<float,2>{0.145861477f, 0.615487635f},
-std::array<float,2>{0.824736893f, 0.0503290892f},
-std::array<float,2>{0.75003314f, 0.913425088f},
-std::array<float,2>{0.249964461f, 0.467277378f},
-std::array<float,2>{0.447379321f, 0.65862298f},
-std::array<float,2>{0.72064352f, 0.142846674f},
-std::array<float,2>{0.509108424f, 0.527863145f},
-std::array<float,2>{0.290173858f, 0.064429149f},
-std::array<float,2>{0.0434415117f, 0.797853231f},
-std::array<float,2>{0.985704958f, 0.33453384f},
-std::array<float,2>{0.855810106f, 0.573479891f},
-std::array<float,2>{0.16526258f, 0.0177473966f},
-std::array<float,2>{0.381521404f, 0.813364029f},
-std::array<float,2>{0.647125781f, 0.303593606f},
-std::array<float,2>{0.578584552f, 0.996000051f},
-std::array<float,2>{0.314219534f, 0.401396126f},
-std::array<float,2>{0.0949201882f, 0.704881907f},
-std::array<float,2>{0.927302063f, 0.189196303f},
-std::array<float,2>{0.954795182f, 0.758777022f},
-std::array<float,2>{0.0265419986f, 0.350897014f},
-std::array<float,2>{0.268097639f, 0.553174675f},
-std::array<float,2>{0.556848228f, 0.0962819532f},
-std::array<float,2>{0.699508071f, 0.650457323f},
-std::array<float,2>{0.490071476f, 0.1735304f},
-std::array<float,2>{0.201275617f, 0.890372694f},
-std::array<float,2>{0.787105322f, 0.475093156f},
-std::array<float,2>{0.970679402f, 0.536149144f},
-std::array<float,2>{0.0518591553f, 0.117110729f},
-std::array<float,2>{0.311963886f, 0.768075168f},
-std::array<float,2>{0.517302275f, 0.368013918f},
-std::array<float,2>{0.746748686f, 0.899359286f},
-std::array<float,2>{0.464180827f, 0.49907583f},
-std::array<float,2>{0.219108135f, 0.635822296f},
-std::array<float,2>{0.778555512f, 0.163324565f},
-std::array<float,2>{0.833300769f, 0.833079696f},
-std::array<float,2>{0.135325f, 0.28742668f},
-std::array<float,2>{0.421417445f, 0.581864238f},
-std::array<float,2>{0.675094545f, 0.0102984831f},
-std::array<float,2>{0.604351103f, 0.693653643f},
-std::array<float,2>{0.364052445f, 0.214242041f},
-std::array<float,2>{0.0666219443f, 0.973528445f},
-std::array<float,2>{0.891968489f, 0.377076656f},
-std::array<float,2>{0.798647046f, 0.673273206f},
-std::array<float,2>{0.204955712f, 0.131409973f},
-std::array<float,2>{0.483290732f, 0.936011672f},
-std::array<float,2>{0.711065054f, 0.450167805f},
-std::array<float,2>{0.537721395f, 0.782580853f},
-std::array<float,2>{0.256372005f, 0.322267294f},
-std::array<float,2>{0.00301284087f, 0.512180984f},
-std::array<float,2>{0.947056293f, 0.0916787386f},
-std::array<float,2>{0.919860065f, 0.951657116f},
-std::array<float,2>{0.109825045f, 0.434096932f},
-std::array<float,2>{0.33728084f, 0.736606479f},
-std::array<float,2>{0.566724479f, 0.234494865f},
-std::array<float,2>{0.636104405f, 0.607670903f},
-std::array<float,2>{0.394834429f, 0.0390901007f},
-std::array<float,2>{0.186382532f, 0.852175415f},
-std::array<float,2>{0.87152487f, 0.263646573f},
-std::array<float,2>{0.909250379f, 0.661519647f},
-std::array<float,2>{0.122821741f, 0.145819202f},
-std::array<float,2>{0.332790256f, 0.907258689f},
-std::array<float,2>{0.577563465f, 0.46376881f},
-std::array<float,2>{0.631513834f, 0.804615855f},
-std::array<float,2>{0.406068504f, 0.330745965f},
-std::array<float,2>{0.178413749f, 0.526438057f},
-std::array<float,2>{0.862944484f, 0.0701629147f},
-std::array<float,2>{0.810527444f, 0.964514613f},
-std::array<float,2>{0.21580565f, 0.411099076f},
-std::array<float,2>{0.470794111f, 0.729104578f},
-std::array<float,2>{0.709350526f, 0.220429137f},
-std::array<float,2>{0.546446025f, 0.609814703f},
-std::array<float,2>{0.26111117f, 0.0540343523f},
-std::array<float,2>{0.0103197675f, 0.862736344f},
-std::array<float,2>{0.9380337f, 0.268992603f},
-std::array<float,2>{0.843335867f, 0.548486412f},
-std::array<float,2>{0.128923386f, 0.0978203863f},
-std::array<float,2>{0.413504362f, 0.764966667f},
-std::array<float,2>{0.681448877f, 0.347461283f},
-std::array<float,2>{0.594913423f, 0.885962307f},
-std::array<float,2>{0.368534386f, 0.471838087f},
-std::array<float,2>{0.0775858164f, 0.655611575f},
-std::array<float,2>{0.905657709f, 0.175902575f},
-std::array<float,2>{0.984281123f, 0.818108857f},
-std::array<float,2>{0.0607209653f, 0.297208548f},
-std::array<float,2>{0.300399035f, 0.577750027f},
-std::array<float,2>{0.524173677f, 0.0226332024f},
-std::array<float,2>{0.740244925f, 0.707461059f},
-std::array<float,2>{0.453454077f, 0.194674164f},
-std::array<float,2>{0.23401843f, 0.998134971f},
-std::array<float,2>{0.771831214f, 0.403497756f},
-std::array<float,2>{0.96523875f, 0.585610569f},
-std::array<float,2>{0.0159236174f, 0.012876316f},
-std::array<float,2>{0.279811502f, 0.830465972f},
-std::array<float,2>{0.547953427f, 0.284515738f},
-std::array<float,2>{0.690306664f, 0.971332908f},
-std::array<float,2>{0.495951831f, 0.380094647f},
-std::array<float,2>{0.189190224f, 0.68936348f},
-std::array<float,2>{0.793130815f, 0.216171831f},
-std::array<float,2>{0.85051924f, 0.771116257f},
-std::array<float,2>{0.156524062f, 0.371967733f},
-std::array<float,2>{0.384395868f, 0.532086492f},
-std::array<float,2>{0.652441561f, 0.109560356f},
-std::array<float,2>{0.589515507f, 0.640422463f},
-std::array<float,2>{0.325755775f, 0.156433553f},
-std::array<float,2>{0.107863463f, 0.904722154f},
-std::array<float,2>{0.93527323f, 0.493805677f},
-std::array<float,2>{0.758880436f, 0.740752518f},
-std::array<float,2>{0.234991699f, 0.239773512f},
-std::array<float,2>{0.444344699f, 0.948298872f},
-std::array<float,2>{0.732742131f, 0.431831241f},
-std::array<float,2>{0.507400692f, 0.859237432f},
-std::array<float,2>{0.2880463f, 0.260008126f},
-std::array<float,2>{0.0330264568f, 0.601933658f},
-std::array<float,2>{0.99334681f, 0.044589173f},
-std::array<float,2>{0.882100046f, 0.933303773f},
-std::array<float,2>{0.0922737494f, 0.447042048f},
-std::array<float,2>{0.348557025f, 0.679000556f},
-std::array<float,2>{0.613899827f, 0.128901213f},
-std::array<float,2>{0.665013671f, 0.50925529f},
-std::array<float,2>{0.423099667f, 0.0869925842f},
-std::array<float,2>{0.151690811f, 0.788022876f},
-std::array<float,2>{0.814781308f, 0.326088101f},
-std::array<float,2>{0.992150187f, 0.702398062f},
-std::array<float,2>{0.0419036597f, 0.206054941f},
-std::array<float,2>{0.296856999f, 0.97708112f},
-std::array<float,2>{0.515425503f, 0.385023177f},
-std::array<float,2>{0.723773003f, 0.843668401f},
-std::array<float,2>{0.451383412f, 0.289661735f},
-std::array<float,2>{0.245305941f, 0.588455379f},
-std::array<float,2>{0.754587591f, 0.00774383126f},
-std::array<float,2>{0.821221232f, 0.894641817f},
-std::array<float,2>{0.143317938f, 0.490515679f},
-std::array<float,2>{0.431906879f, 0.629820466f},
-std::array<float,2>{0.65711689f, 0.168845832f},
-std::array<float,2>{0.618113399f, 0.546491623f},
-std::array<float,2>{0.356243342f, 0.118186742f},
-std::array<float,2>{0.0845244154f, 0.77896589f},
-std::array<float,2>{0.886647165f, 0.362377316f},
-std::array<float,2>{0.782331765f, 0.597389221f},
-std::array<float,2>{0.19809325f, 0.033149492f},
-std::array<float,2>{0.488131225f, 0.851560831f},
-std::array<float,2>{0.698006868f, 0.255210727f},
-std::array<float,2>{0.561267674f, 0.939094424f},
-std::array<float,2>{0.271106601f, 0.424246967f},
-std::array<float,2>{0.0277168024f, 0.746281624f},
-std::array<float,2>{0.959303439f, 0.249565527f},
-std::array<float,2>{0.922034264f, 0.796052754f},
-std::array<float,2>{0.0994399339f, 0.312997788f},
-std::array<float,2>{0.31821695f, 0.505219877f},
-std::array<float,2>{0.582671165f, 0.079194136f},
-std::array<float,2>{0.643203914f, 0.680936515f},
-std::array<float,2>{0.376712263f, 0.139561117f},
-std::array<float,2>{0.168791801f, 0.925387561f},
-std::array<float,2>{0.85318923f, 0.440239638f},
-std::array<float,2>{0.89527297f, 0.521220803f},
-std::array<float,2>{0.0633211508f, 0.0717985258f},
-std::array<float,2>{0.361980617f, 0.807047844f},
-std::array<float,2>{0.607562125f, 0.339539647f},
-std::array<float,2>{0.679479301f, 0.916694045f},
-std::array<float,2>{0.417783111f, 0.458938569f},
-std::array<float,2>{0.137050167f, 0.665700674f},
-std::array<float,2>{0.828155398f, 0.155940592f},
-std::array<float,2>{0.777333558f, 0.872023106f},
-std::array<float,2>{0.223100841f, 0.278338313f},
-std::array<float,2>{0.468028307f, 0.621553242f},
-std::array<float,2>{0.742722452f, 0.0591820478f},
-std::array<float,2>{0.521242857f, 0.725177765f},
-std::array<float,2>{0.307568789f, 0.231205747f},
-std::array<float,2>{0.0490286238f, 0.956727803f},
-std::array<float,2>{0.974158585f, 0.414916992f},
-std::array<float,2>{0.868786633f, 0.647096813f},
-std::array<float,2>{0.182800636f, 0.185146019f},
-std::array<float,2>{0.394476503f, 0.87505734f},
-std::array<float,2>{0.640213072f, 0.484363616f},
-std::array<float,2>{0.565003991f, 0.751515806f},
-std::array<float,2>{0.340538085f, 0.356959015f},
-std::array<float,2>{0.114945538f, 0.557356417f},
-std::array<float,2>{0.916146159f, 0.105391346f},
-std::array<float,2>{0.951457977f, 0.991775095f},
-std::array<float,2>{0.00543948403f, 0.397090703f},
-std::array<float,2>{0.25005579f, 0.714690566f},
-std::array<float,2>{0.532175601f, 0.202734485f},
-std::array<float,2>{0.71501869f, 0.56735909f},
-std::array<float,2>{0.480224729f, 0.0250697713f},
-std::array<float,2>{0.208782643f, 0.826549411f},
-std::array<float,2>{0.802117527f, 0.305966467f},
-std::array<float,2>{0.972043455f, 0.636387348f},
-std::array<float,2>{0.0530409887f, 0.163879514f},
-std::array<float,2>{0.309241503f, 0.898818195f},
-std::array<float,2>{0.518152416f, 0.499784291f},
-std::array<float,2>{0.748061419f, 0.767579377f},
-std::array<float,2>{0.4620336f, 0.367619365f},
-std::array<float,2>{0.222346231f, 0.536913395f},
-std::array<float,2>{0.780673563f, 0.116584897f},
-std::array<float,2>{0.835221946f, 0.9728719f},
-std::array<float,2>{0.134331316f, 0.377586037f},
-std::array<float,2>{0.418321311f, 0.694125831f},
-std::array<float,2>{0.673473358f, 0.214650467f},
-std::array<float,2>{0.602672756f, 0.581145346f},
-std::array<float,2>{0.366553545f, 0.0102419769f},
-std::array<float,2>{0.0702199712f, 0.833857417f},
-std::array<float,2>{0.893583059f, 0.287824839f},
-std::array<float,2>{0.799667716f, 0.512375355f},
-std::array<float,2>{0.206350625f, 0.0912076235f},
-std::array<float,2>{0.481578648f, 0.782988369f},
-std::array<float,2>{0.714354813f, 0.322873414f},
-std::array<float,2>{0.536248267f, 0.936172843f},
-std::array<float,2>{0.2546826f, 0.449443787f},
-std::array<float,2>{0.000456830952f, 0.673562646f},
-std::array<float,2>{0.947840631f, 0.131223217f},
-std::array<float,2>{0.921428382f, 0.851877451f},
-std::array<float,2>{0.112082675f, 0.262917429f},
-std::array<float,2>{0.33841151f, 0.608300865f},
-std::array<float,2>{0.568983793f, 0.03989245f},
-std::array<float,2>{0.634311438f, 0.737126231f},
-std::array<float,2>{0.398393661f, 0.23520197f},
-std::array<float,2>{0.185088024f, 0.952100456f},
-std::array<float,2>{0.874751568f, 0.43376863f},
-std::array<float,2>{0.889366269f, 0.616009772f},
-std::array<float,2>{0.0783277154f, 0.0501871146f},
-std::array<float,2>{0.351622015f, 0.865729153f},
-std::array<float,2>{0.623867214f, 0.270669192f},
-std::array<float,2>{0.663059711f, 0.968055606f},
-std::array<float,2>{0.435949534f, 0.408528477f},
-std::array<float,2>{0.146660149f, 0.731309056f},
-std::array<float,2>{0.826577187f, 0.22428143f},
-std::array<float,2>{0.752703607f, 0.798732042f},
-std::array<float,2>{0.246182173f, 0.334088117f},
-std::array<float,2>{0.445973724f, 0.527350962f},
-std::array<float,2>{0.722148061f, 0.0635329112f},
-std::array<float,2>{0.510075212f, 0.658841908f},
-std::array<float,2>{0.292319357f, 0.143311754f},
-std::array<float,2>{0.0462227054f, 0.913618922f},
-std::array<float,2>{0.988061249f, 0.467667878f},
-std::array<float,2>{0.859081745f, 0.704335093f},
-std::array<float,2>{0.167955428f, 0.188566804f},
-std::array<float,2>{0.378931373f, 0.995219409f},
-std::array<float,2>{0.645134568f, 0.402320743f},
-std::array<float,2>{0.581356168f, 0.812737882f},
-std::array<float,2>{0.314949244f, 0.303221613f},
-std::array<float,2>{0.0961233899f, 0.574214876f},
-std::array<float,2>{0.928435683f, 0.0182489511f},
-std::array<float,2>{0.955926895f, 0.889973819f},
-std::array<float,2>{0.0243234187f, 0.475164682f},
-std::array<float,2>{0.266992718f, 0.65134877f},
-std::array<float,2>{0.555289328f, 0.172901914f},
-std::array<float,2>{0.70284164f, 0.553416371f},
-std::array<float,2>{0.491560221f, 0.0957668871f},
-std::array<float,2>{0.199747831f, 0.75829494f},
-std::array<float,2>{0.788577199f, 0.351364613f},
-std::array<float,2>{0.932521343f, 0.719594061f},
-std::array<float,2>{0.105433524f, 0.230054438f},
-std::array<float,2>{0.321712434f, 0.958862484f},
-std::array<float,2>{0.590903401f, 0.421651095f},
-std::array<float,2>{0.648494959f, 0.870405793f},
-std::array<float,2>{0.389395565f, 0.275879622f},
-std::array<float,2>{0.163544193f, 0.617983282f},
-std::array<float,2>{0.846990585f, 0.0579235256f},
-std::array<float,2>{0.791431308f, 0.92032814f},
-std::array<float,2>{0.193995059f, 0.456547767f},
-std::array<float,2>{0.498347014f, 0.670934975f},
-std::array<float,2>{0.693357527f, 0.148811504f},
-std::array<float,2>{0.552814603f, 0.518084466f},
-std::array<float,2>{0.276094705f, 0.0743988678f},
-std::array<float,2>{0.0220605265f, 0.809940279f},
-std::array<float,2>{0.963477254f, 0.343652636f},
-std::array<float,2>{0.817420483f, 0.566303909f},
-std::array<float,2>{0.155882791f, 0.0274209958f},
-std::array<float,2>{0.429222316f, 0.824028373f},
-std::array<float,2>{0.668184638f, 0.311354101f},
-std::array<float,2>{0.612895846f, 0.987055838f},
-std::array<float,2>{0.344830573f, 0.391886443f},
-std::array<float,2>{0.0867913291f, 0.717615783f},
-std::array<float,2>{0.878405571f, 0.197551027f},
-std::array<float,2>{0.997639537f, 0.757408679f},
-std::array<float,2>{0.0381581932f, 0.35538283f},
-std::array<float,2>{0.281319529f, 0.562068582f},
-std::array<float,2>{0.502272606f, 0.106654219f},
-std::array<float,2>{0.727192461f, 0.64448911f},
-std::array<float,2>{0.44024536f, 0.181068897f},
-std::array<float,2>{0.241040647f, 0.880301714f},
-std::array<float,2>{0.762962461f, 0.478293866f},
-std::array<float,2>{0.942198098f, 0.541530669f},
-std::array<float,2>{0.0131418481f, 0.124280579f},
-std::array<float,2>{0.263829917f, 0.775984347f},
-std::array<float,2>{0.541463852f, 0.364911437f},
-std::array<float,2>{0.70620811f, 0.892513156f},
-std::array<float,2>{0.475940049f, 0.486566216f},
-std::array<float,2>{0.214682981f, 0.628367543f},
-std::array<float,2>{0.807077646f, 0.165663779f},
-std::array<float,2>{0.865217388f, 0.837835252f},
-std::array<float,2>{0.174674273f, 0.293526828f},
-std::array<float,2>{0.400905937f, 0.593474269f},
-std::array<float,2>{0.625705242f, 0.000471342762f},
-std::array<float,2>{0.573023975f, 0.69747287f},
-std::array<float,2>{0.331259876f, 0.210292846f},
-std::array<float,2>{0.1191779f, 0.98175472f},
-std::array<float,2>{0.911644757f, 0.389916569f},
-std::array<float,2>{0.76844269f, 0.68419075f},
-std::array<float,2>{0.229731381f, 0.136037424f},
-std::array<float,2>{0.458437532f, 0.926787496f},
-std::array<float,2>{0.736755908f, 0.444820136f},
-std::array<float,2>{0.528587818f, 0.791688204f},
-std::array<float,2>{0.303551286f, 0.318782926f},
-std::array<float,2>{0.0562804714f, 0.502033412f},
-std::array<float,2>{0.977533937f, 0.0842044726f},
-std::array<float,2>{0.899845719f, 0.944176972f},
-std::array<float,2>{0.071653232f, 0.425982028f},
-std::array<float,2>{0.374177933f, 0.744856298f},
-std::array<float,2>{0.600993872f, 0.243379653f},
-std::array<float,2>{0.68376267f, 0.59899646f},
-std::array<float,2>{0.406460196f, 0.0369613506f},
-std::array<float,2>{0.128142029f, 0.84669888f},
-std::array<float,2>{0.837872565f, 0.252423078f},
-std::array<float,2>{0.89795512f, 0.665426493f},
-std::array<float,2>{0.0646369755f, 0.155502304f},
-std::array<float,2>{0.360903919f, 0.916293025f},
-std::array<float,2>{0.605619311f, 0.458117604f},
-std::array<float,2>{0.676810622f, 0.807150662f},
-std::array<float,2>{0.414720923f, 0.338881582f},
-std::array<float,2>{0.14042297f, 0.520946443f},
-std::array<float,2>{0.831651688f, 0.0712945387f},
-std::array<float,2>{0.773880124f, 0.956297278f},
-std::array<float,2>{0.225278795f, 0.414226651f},
-std::array<float,2>{0.465901852f, 0.724827051f},
-std::array<float,2>{0.74608779f, 0.230886489f},
-std::array<float,2>{0.522819221f, 0.622013688f},
-std::array<float,2>{0.30612281f, 0.0590562895f},
-std::array<float,2>{0.0480095893f, 0.8711676f},
-std::array<float,2>{0.975131452f, 0.278849542f},
-std::array<float,2>{0.870416999f, 0.556799471f},
-std::array<float,2>{0.179778084f, 0.104594953f},
-std::array<float,2>{0.391165912f, 0.750984848f},
-std::array<float,2>{0.637371182f, 0.356538922f},
-std::array<float,2>{0.564059913f, 0.875942409f},
-std::array<float,2>{0.342337132f, 0.483769178f},
-std::array<float,2>{0.117183343f, 0.646644175f},
-std::array<float,2>{0.914200962f, 0.184940338f},
-std::array<float,2>{0.950290024f, 0.826947093f},
-std::array<float,2>{0.00616326556f, 0.306411058f},
-std::array<float,2>{0.253102571f, 0.566409826f},
-std::array<float,2>{0.534410834f, 0.0245930981f},
-std::array<float,2>{0.716890574f, 0.714078724f},
-std::array<float,2>{0.476615578f, 0.202628464f},
-std::array<float,2>{0.209739894f, 0.991594493f},
-std::array<float,2>{0.803805172f, 0.396543473f},
-std::array<float,2>{0.990227342f, 0.58809036f},
-std::array<float,2>{0.0391435884f, 0.00707193092f},
-std::array<float,2>{0.293562263f, 0.843219638f},
-std::array<float,2>{0.512219489f, 0.289230585f},
-std::array<float,2>{0.725735843f, 0.976791084f},
-std::array<float,2>{0.449756354f, 0.385729522f},
-std::array<float,2>{0.242429614f, 0.70300132f},
-std::array<float,2>{0.756849825f, 0.206694558f},
-std::array<float,2>{0.822727323f, 0.778673947f},
-std::array<float,2>{0.142218798f, 0.363098085f},
-std::array<float,2>{0.430901796f, 0.546085358f},
-std::array<float,2>{0.658817291f, 0.119114324f},
-std::array<float,2>{0.619639874f, 0.629272163f},
-std::array<float,2>{0.35769695f, 0.168182075f},
-std::array<float,2>{0.0831239298f, 0.895101726f},
-std::array<float,2>{0.883365095f, 0.490983665f},
-std::array<float,2>{0.784506083f, 0.746871889f},
-std::array<float,2>{0.19604364f, 0.24935481f},
-std::array<float,2>{0.484514922f, 0.938653767f},
-std::array<float,2>{0.696193278f, 0.424396574f},
-std::array<float,2>{0.559393048f, 0.850806653f},
-std::array<float,2>{0.272543639f, 0.255615413f},
-std::array<float,2>{0.0304273143f, 0.597109795f},
-std::array<float,2>{0.958910108f, 0.0324022286f},
-std::array<float,2>{0.925118208f, 0.924950182f},
-std::array<float,2>{0.100381143f, 0.439916551f},
-std::array<float,2>{0.319393694f, 0.681342304f},
-std::array<float,2>{0.584030509f, 0.139075309f},
-std::array<float,2>{0.642069638f, 0.505607367f},
-std::array<float,2>{0.378801674f, 0.079646565f},
-std::array<float,2>{0.169949546f, 0.79672581f},
-std::array<float,2>{0.854211152f, 0.312860221f},
-std::array<float,2>{0.968283653f, 0.688851535f},
-std::array<float,2>{0.0189248472f, 0.21665886f},
-std::array<float,2>{0.277679324f, 0.970759153f},
-std::array<float,2>{0.54886061f, 0.380757481f},
-std::array<float,2>{0.688964248f, 0.830696404f},
-std::array<float,2>{0.493642122f, 0.28476733f},
-std::array<float,2>{0.189619198f, 0.585324526f},
-std::array<float,2>{0.795009077f, 0.0132753626f},
-std::array<float,2>{0.848460734f, 0.905239165f},
-std::array<float,2>{0.159491748f, 0.493358731f},
-std::array<float,2>{0.386107445f, 0.640120983f},
-std::array<float,2>{0.656051815f, 0.156823143f},
-std::array<float,2>{0.586320996f, 0.531443179f},
-std::array<float,2>{0.327287793f, 0.110078119f},
-std::array<float,2>{0.105702274f, 0.770646989f},
-std::array<float,2>{0.93672502f, 0.371352702f},
-std::array<float,2>{0.760603845f, 0.602243423f},
-std::array<float,2>{0.237855867f, 0.0440031402f},
-std::array<float,2>{0.442646295f, 0.858605087f},
-std::array<float,2>{0.732197881f, 0.260691583f},
-std::array<float,2>{0.505708337f, 0.949009359f},
-std::array<float,2>{0.285888225f, 0.43230015f},
-std::array<float,2>{0.0346891768f, 0.740444601f},
-std::array<float,2>{0.995264828f, 0.239360228f},
-std::array<float,2>{0.880110323f, 0.787523687f},
-std::array<float,2>{0.0915968195f, 0.325318754f},
-std::array<float,2>{0.351399541f, 0.509314716f},
-std::array<float,2>{0.616667867f, 0.0876768082f},
-std::array<float,2>{0.667394102f, 0.679412901f},
-std::array<float,2>{0.425387979f, 0.128286377f},
-std::array<float,2>{0.149702728f, 0.933021963f},
-std::array<float,2>{0.813420236f, 0.446459264f},
-std::array<float,2>{0.908084571f, 0.527004719f},
-std::array<float,2>{0.123344943f, 0.0696492046f},
-std::array<float,2>{0.334043145f, 0.803963661f},
-std::array<float,2>{0.574786127f, 0.330524415f},
-std::array<float,2>{0.629555345f, 0.908078313f},
-std::array<float,2>{0.403880984f, 0.463155597f},
-std::array<float,2>{0.177349448f, 0.661693633f},
-std::array<float,2>{0.859636247f, 0.146294892f},
-std::array<float,2>{0.811363101f, 0.86307919f},
-std::array<float,2>{0.217030093f, 0.269419611f},
-std::array<float,2>{0.470414102f, 0.61017257f},
-std::array<float,2>{0.707263768f, 0.0544426106f},
-std::array<float,2>{0.543544769f, 0.72851783f},
-std::array<float,2>{0.25820902f, 0.219736353f},
-std::array<float,2>{0.00789481681f, 0.963873744f},
-std::array<float,2>{0.940971255f, 0.410172403f},
-std::array<float,2>{0.84087342f, 0.655965745f},
-std::array<float,2>{0.131025031f, 0.176494524f},
-std::array<float,2>{0.41091612f, 0.886600256f},
-std::array<float,2>{0.681812644f, 0.472196877f},
-std::array<float,2>{0.597486496f, 0.765236318f},
-std::array<float,2>{0.369409263f, 0.346966416f},
-std::array<float,2>{0.0759129822f, 0.548264325f},
-std::array<float,2>{0.902730048f, 0.0984692574f},
-std::array<float,2>{0.980761945f, 0.998981237f},
-std::array<float,2>{0.0594945289f, 0.403941065f},
-std::array<float,2>{0.296884656f, 0.70780623f},
-std::array<float,2>{0.526441634f, 0.195136264f},
-std::array<float,2>{0.739951015f, 0.577497482f},
-std::array<float,2>{0.455447704f, 0.0232155155f},
-std::array<float,2>{0.232105657f, 0.817753375f},
-std::array<float,2>{0.77024442f, 0.297742009f},
-std::array<float,2>{0.946680784f, 0.674977541f},
-std::array<float,2>{0.00367613533f, 0.130526572f},
-std::array<float,2>{0.255938172f, 0.934895098f},
-std::array<float,2>{0.537194073f, 0.451977909f},
-std::array<float,2>{0.711715281f, 0.783749104f},
-std::array<float,2>{0.482599169f, 0.320329577f},
-std::array<float,2>{0.204544544f, 0.51483953f},
-std::array<float,2>{0.798331678f, 0.0921659321f},
-std::array<float,2>{0.871626437f, 0.950374305f},
-std::array<float,2>{0.185750946f, 0.436391234f},
-std::array<float,2>{0.395217985f, 0.735729694f},
-std::array<float,2>{0.636687517f, 0.23706913f},
-std::array<float,2>{0.567009926f, 0.607052684f},
-std::array<float,2>{0.337539077f, 0.041426938f},
-std::array<float,2>{0.110213995f, 0.854656339f},
-std::array<float,2>{0.919137776f, 0.263715357f},
-std::array<float,2>{0.779276967f, 0.537446022f},
-std::array<float,2>{0.219435409f, 0.11511492f},
-std::array<float,2>{0.464499265f, 0.767462015f},
-std::array<float,2>{0.746336162f, 0.370866716f},
-std::array<float,2>{0.516635656f, 0.900856137f},
-std::array<float,2>{0.312459588f, 0.497440577f},
-std::array<float,2>{0.0524422303f, 0.633371592f},
-std::array<float,2>{0.970088005f, 0.161361083f},
-std::array<float,2>{0.892453611f, 0.835526884f},
-std::array<float,2>{0.0669972599f, 0.286221713f},
-std::array<float,2>{0.36358732f, 0.579149127f},
-std::array<float,2>{0.603884339f, 0.00865694322f},
-std::array<float,2>{0.675635874f, 0.691947162f},
-std::array<float,2>{0.421111643f, 0.212007672f},
-std::array<float,2>{0.13510491f, 0.976080418f},
-std::array<float,2>{0.83375299f, 0.375483721f},
-std::array<float,2>{0.927173197f, 0.571884751f},
-std::array<float,2>{0.0955122039f, 0.0166008994f},
-std::array<float,2>{0.313511968f, 0.815503776f},
-std::array<float,2>{0.578637838f, 0.301537216f},
-std::array<float,2>{0.646516085f, 0.993289173f},
-std::array<float,2>{0.381193906f, 0.399350464f},
-std::array<float,2>{0.165694118f, 0.706371427f},
-std::array<float,2>{0.855977476f, 0.190955877f},
-std::array<float,2>{0.786263049f, 0.760150611f},
-std::array<float,2>{0.202128917f, 0.348504484f},
-std::array<float,2>{0.489573866f, 0.5508672f},
-std::array<float,2>{0.700080276f, 0.0938056707f},
-std::array<float,2>{0.557259798f, 0.649988294f},
-std::array<float,2>{0.267654717f, 0.174868211f},
-std::array<float,2>{0.026910644f, 0.888425469f},
-std::array<float,2>{0.954531968f, 0.472695261f},
-std::array<float,2>{0.824575365f, 0.733234644f},
-std::array<float,2>{0.146373004f, 0.224931329f},
-std::array<float,2>{0.43488425f, 0.965959907f},
-std::array<float,2>{0.660382748f, 0.407850564f},
-std::array<float,2>{0.62263757f, 0.864018083f},
-std::array<float,2>{0.353612065f, 0.27189067f},
-std::array<float,2>{0.0814860612f, 0.61508137f},
-std::array<float,2>{0.886916637f, 0.0477741323f},
-std::array<float,2>{0.985970914f, 0.91041702f},
-std::array<float,2>{0.0434782356f, 0.464930832f},
-std::array<float,2>{0.290602654f, 0.656279087f},
-std::array<float,2>{0.509297967f, 0.140774846f},
-std::array<float,2>{0.71974498f, 0.529726863f},
-std::array<float,2>{0.447968513f, 0.0658938736f},
-std::array<float,2>{0.24905248f, 0.800412834f},
-std::array<float,2>{0.750898719f, 0.33206737f},
-std::array<float,2>{0.875418663f, 0.716151118f},
-std::array<float,2>{0.0894293264f, 0.196663201f},
-std::array<float,2>{0.346760482f, 0.985996246f},
-std::array<float,2>{0.61059612f, 0.39383015f},
-std::array<float,2>{0.670141459f, 0.820366979f},
-std::array<float,2>{0.42743662f, 0.308953762f},
-std::array<float,2>{0.153867841f, 0.563796163f},
-std::array<float,2>{0.819045305f, 0.0301891938f},
-std::array<float,2>{0.764941692f, 0.882674038f},
-std::array<float,2>{0.238963798f, 0.480468273f},
-std::array<float,2>{0.43919903f, 0.640914023f},
-std::array<float,2>{0.729784906f, 0.182171509f},
-std::array<float,2>{0.501002252f, 0.560380042f},
-std::array<float,2>{0.284263968f, 0.108163796f},
-std::array<float,2>{0.0365016013f, 0.755423427f},
-std::array<float,2>{0.998345435f, 0.352745533f},
-std::array<float,2>{0.844747603f, 0.619442821f},
-std::array<float,2>{0.1609274f, 0.0551342703f},
-std::array<float,2>{0.388260037f, 0.868347228f},
-std::array<float,2>{0.651306748f, 0.274674207f},
-std::array<float,2>{0.592682481f, 0.959421039f},
-std::array<float,2>{0.322279423f, 0.418754578f},
-std::array<float,2>{0.103332594f, 0.720723867f},
-std::array<float,2>{0.930641413f, 0.227944657f},
-std::array<float,2>{0.96157819f, 0.811656356f},
-std::array<float,2>{0.0210099202f, 0.339875996f},
-std::array<float,2>{0.27424258f, 0.517571807f},
-std::array<float,2>{0.551463425f, 0.0769267455f},
-std::array<float,2>{0.69418478f, 0.669712007f},
-std::array<float,2>{0.497371465f, 0.15133442f},
-std::array<float,2>{0.191534936f, 0.918667436f},
-std::array<float,2>{0.789682388f, 0.454863638f},
-std::array<float,2>{0.979395211f, 0.500497162f},
-std::array<float,2>{0.0568947643f, 0.0830111578f},
-std::array<float,2>{0.302011102f, 0.789145112f},
-std::array<float,2>{0.531046927f, 0.318168461f},
-std::array<float,2>{0.735449731f, 0.929042935f},
-std::array<float,2>{0.46048227f, 0.441972286f},
-std::array<float,2>{0.227745637f, 0.685953021f},
-std::array<float,2>{0.767423213f, 0.134144515f},
-std::array<float,2>{0.83829248f, 0.845454037f},
-std::array<float,2>{0.125479043f, 0.251156688f},
-std::array<float,2>{0.409133673f, 0.600204825f},
-std::array<float,2>{0.686861217f, 0.0380486473f},
-std::array<float,2>{0.598525345f, 0.744013131f},
-std::array<float,2>{0.372058302f, 0.245662212f},
-std::array<float,2>{0.074119404f, 0.9431054f},
-std::array<float,2>{0.901205182f, 0.428980708f},
-std::array<float,2>{0.804945648f, 0.626236618f},
-std::array<float,2>{0.211195514f, 0.166139126f},
-std::array<float,2>{0.474466681f, 0.893531322f},
-std::array<float,2>{0.704169154f, 0.485708386f},
-std::array<float,2>{0.539509356f, 0.775240064f},
-std::array<float,2>{0.262002856f, 0.365672261f},
-std::array<float,2>{0.0152268577f, 0.540292323f},
-std::array<float,2>{0.944415152f, 0.122679025f},
-std::array<float,2>{0.913646817f, 0.982819796f},
-std::array<float,2>{0.119063675f, 0.387684673f},
-std::array<float,2>{0.330039024f, 0.695700943f},
-std::array<float,2>{0.570684195f, 0.207882971f},
-std::array<float,2>{0.627871871f, 0.591708481f},
-std::array<float,2>{0.398645818f, 0.00319139124f},
-std::array<float,2>{0.173271239f, 0.838389277f},
-std::array<float,2>{0.866514683f, 0.294988036f},
-std::array<float,2>{0.916542888f, 0.645652235f},
-std::array<float,2>{0.114630245f, 0.186462849f},
-std::array<float,2>{0.339894712f, 0.878158927f},
-std::array<float,2>{0.564543784f, 0.481514692f},
-std::array<float,2>{0.639767289f, 0.752399921f},
-std::array<float,2>{0.393836886f, 0.358312309f},
-std::array<float,2>{0.183535039f, 0.555661201f},
-std::array<float,2>{0.868574381f, 0.102962837f},
-std::array<float,2>{0.80246222f, 0.988348961f},
-std::array<float,2>{0.208068565f, 0.394568026f},
-std::array<float,2>{0.479825556f, 0.712089598f},
-std::array<float,2>{0.715467632f, 0.199991927f},
-std::array<float,2>{0.531583607f, 0.569089472f},
-std::array<float,2>{0.250565082f, 0.0259579495f},
-std::array<float,2>{0.00502286758f, 0.825138152f},
-std::array<float,2>{0.951831043f, 0.307453364f},
-std::array<float,2>{0.828973949f, 0.521755934f},
-std::array<float,2>{0.137254f, 0.0739254579f},
-std::array<float,2>{0.417056978f, 0.806558192f},
-std::array<float,2>{0.679124355f, 0.337697029f},
-std::array<float,2>{0.60822928f, 0.915235758f},
-std::array<float,2>{0.361705363f, 0.46018967f},
-std::array<float,2>{0.062809296f, 0.666459322f},
-std::array<float,2>{0.894756854f, 0.153657049f},
-std::array<float,2>{0.973797739f, 0.873509467f},
-std::array<float,2>{0.0497267023f, 0.280863494f},
-std::array<float,2>{0.306672156f, 0.624370992f},
-std::array<float,2>{0.520775676f, 0.0613042973f},
-std::array<float,2>{0.742610812f, 0.724452853f},
-std::array<float,2>{0.468373358f, 0.233193159f},
-std::array<float,2>{0.22361511f, 0.955030262f},
-std::array<float,2>{0.776817024f, 0.416142106f},
-std::array<float,2>{0.959674895f, 0.595275819f},
-std::array<float,2>{0.0279965792f, 0.0334472284f},
-std::array<float,2>{0.27099067f, 0.848139167f},
-std::array<float,2>{0.560882747f, 0.257117987f},
-std::array<float,2>{0.697456717f, 0.941358209f},
-std::array<float,2>{0.487391353f, 0.422882408f},
-std::array<float,2>{0.197641626f, 0.748882771f},
-std::array<float,2>{0.783122659f, 0.2480039f},
-std::array<float,2>{0.852702558f, 0.793066263f},
-std::array<float,2>{0.16800271f, 0.315864921f},
-std::array<float,2>{0.376008481f, 0.506447077f},
-std::array<float,2>{0.642664433f, 0.0815942213f},
-std::array<float,2>{0.58233726f, 0.681845784f},
-std::array<float,2>{0.317440182f, 0.137367353f},
-std::array<float,2>{0.0988026634f, 0.922102571f},
-std::array<float,2>{0.922805965f, 0.438254267f},
-std::array<float,2>{0.754164696f, 0.700730503f},
-std::array<float,2>{0.246034041f, 0.203616828f},
-std::array<float,2>{0.451990992f, 0.979482353f},
-std::array<float,2>{0.724247098f, 0.382904828f},
-std::array<float,2>{0.514952421f, 0.841124356f},
-std::array<float,2>{0.296110928f, 0.292873204f},
-std::array<float,2>{0.0413017422f, 0.58658421f},
-std::array<float,2>{0.991567433f, 0.00470595481f},
-std::array<float,2>{0.885758638f, 0.897849023f},
-std::array<float,2>{0.0840670839f, 0.48962152f},
-std::array<float,2>{0.355621219f, 0.63256681f},
-std::array<float,2>{0.617528498f, 0.170811176f},
-std::array<float,2>{0.656513989f, 0.543200433f},
-std::array<float,2>{0.432195336f, 0.120678775f},
-std::array<float,2>{0.142809674f, 0.779624641f},
-std::array<float,2>{0.820547521f, 0.359506339f},
-std::array<float,2>{0.994062662f, 0.738624334f},
-std::array<float,2>{0.0325583518f, 0.241751164f},
-std::array<float,2>{0.287536412f, 0.946906924f},
-std::array<float,2>{0.506893337f, 0.431547582f},
-std::array<float,2>{0.732990563f, 0.857136309f},
-std::array<float,2>{0.445204675f, 0.259258509f},
-std::array<float,2>{0.23456803f, 0.603761435f},
-std::array<float,2>{0.759324074f, 0.0461308509f},
-std::array<float,2>{0.815097332f, 0.930791676f},
-std::array<float,2>{0.152037293f, 0.447791636f},
-std::array<float,2>{0.423449427f, 0.675939083f},
-std::array<float,2>{0.664206982f, 0.125389755f},
-std::array<float,2>{0.613589704f, 0.510058999f},
-std::array<float,2>{0.348007232f, 0.0892085582f},
-std::array<float,2>{0.0926759616f, 0.786945343f},
-std::array<float,2>{0.882653654f, 0.327098221f},
-std::array<float,2>{0.793804228f, 0.582845271f},
-std::array<float,2>{0.188810378f, 0.0155510399f},
-std::array<float,2>{0.495349973f, 0.828823388f},
-std::array<float,2>{0.689895988f, 0.282017618f},
-std::array<float,2>{0.548767567f, 0.96887821f},
-std::array<float,2>{0.279514134f, 0.382181108f},
-std::array<float,2>{0.0163267516f, 0.690873086f},
-std::array<float,2>{0.965741217f, 0.216986626f},
-std::array<float,2>{0.93499434f, 0.773249209f},
-std::array<float,2>{0.108088538f, 0.374515057f},
-std::array<float,2>{0.32526952f, 0.53378582f},
-std::array<float,2>{0.589330554f, 0.111498445f},
-std::array<float,2>{0.652838171f, 0.638480008f},
-std::array<float,2>{0.384049296f, 0.159779415f},
-std::array<float,2>{0.157172933f, 0.903821468f},
-std::array<float,2>{0.849927068f, 0.494588256f},
-std::array<float,2>{0.906124294f, 0.549198925f},
-std::array<float,2>{0.0781175047f, 0.100436866f},
-std::array<float,2>{0.36884442f, 0.762242794f},
-std::array<float,2>{0.595280826f, 0.344961286f},
-std::array<float,2>{0.680693448f, 0.882885218f},
-std::array<float,2>{0.413878143f, 0.470300227f},
-std::array<float,2>{0.129852325f, 0.652345359f},
-std::array<float,2>{0.843058765f, 0.179328308f},
-std::array<float,2>{0.772107959f, 0.819383919f},
-std::array<float,2>{0.233550519f, 0.300243139f},
-std::array<float,2>{0.453758001f, 0.574925363f},
-std::array<float,2>{0.740986645f, 0.0207150467f},
-std::array<float,2>{0.523834586f, 0.709750414f},
-std::array<float,2>{0.300108969f, 0.192125127f},
-std::array<float,2>{0.0610594749f, 0.996295691f},
-std::array<float,2>{0.983749688f, 0.405792952f},
-std::array<float,2>{0.862313569f, 0.662325203f},
-std::array<float,2>{0.177736133f, 0.147105724f},
-std::array<float,2>{0.40542382f, 0.908287942f},
-std::array<float,2>{0.63092798f, 0.461640239f},
-std::array<float,2>{0.578092217f, 0.802139103f},
-std::array<float,2>{0.332260162f, 0.329562783f},
-std::array<float,2>{0.12214867f, 0.524621964f},
-std::array<float,2>{0.910116255f, 0.068147853f},
-std::array<float,2>{0.93770653f, 0.961559653f},
-std::array<float,2>{0.0102086123f, 0.412903517f},
-std::array<float,2>{0.261550933f, 0.728355169f},
-std::array<float,2>{0.546206415f, 0.221366867f},
-std::array<float,2>{0.709564626f, 0.612324953f},
-std::array<float,2>{0.471462727f, 0.0523225069f},
-std::array<float,2>{0.215288043f, 0.861051261f},
-std::array<float,2>{0.80977577f, 0.267474234f},
-std::array<float,2>{0.986974239f, 0.657616258f},
-std::array<float,2>{0.0458817333f, 0.142001435f},
-std::array<float,2>{0.291027576f, 0.911483049f},
-std::array<float,2>{0.511489928f, 0.465977311f},
-std::array<float,2>{0.720725954f, 0.799419761f},
-std::array<float,2>{0.446580112f, 0.333749145f},
-std::array<float,2>{0.247300863f, 0.531123042f},
-std::array<float,2>{0.753305018f, 0.064462617f},
-std::array<float,2>{0.828070402f, 0.96563822f},
-std::array<float,2>{0.147869036f, 0.406272441f},
-std::array<float,2>{0.43671149f, 0.733900607f},
-std::array<float,2>{0.663883567f, 0.225597024f},
-std::array<float,2>{0.624494016f, 0.613900244f},
-std::array<float,2>{0.35321331f, 0.0488228425f},
-std::array<float,2>{0.0796780512f, 0.864454806f},
-std::array<float,2>{0.890054286f, 0.273189515f},
-std::array<float,2>{0.788024664f, 0.551779032f},
-std::array<float,2>{0.200298578f, 0.0956912711f},
-std::array<float,2>{0.49056527f, 0.761419117f},
-std::array<float,2>{0.701717675f, 0.348793507f},
-std::array<float,2>{0.555802286f, 0.886974454f},
-std::array<float,2>{0.266584575f, 0.474028587f},
-std::array<float,2>{0.0251837987f, 0.648572564f},
-std::array<float,2>{0.956583083f, 0.174165532f},
-std::array<float,2>{0.929148912f, 0.814508796f},
-std::array<float,2>{0.0968127847f, 0.301840186f},
-std::array<float,2>{0.315756321f, 0.570546448f},
-std::array<float,2>{0.58028096f, 0.0166456196f},
-std::array<float,2>{0.646083117f, 0.705489635f},
-std::array<float,2>{0.380463272f, 0.189532265f},
-std::array<float,2>{0.166063502f, 0.992467403f},
-std::array<float,2>{0.857673168f, 0.400138229f},
-std::array<float,2>{0.893210888f, 0.578716218f},
-std::array<float,2>{0.0688830912f, 0.00930302683f},
-std::array<float,2>{0.365839005f, 0.834420383f},
-std::array<float,2>{0.602205038f, 0.285368919f},
-std::array<float,2>{0.672155499f, 0.975547493f},
-std::array<float,2>{0.419386208f, 0.376441777f},
-std::array<float,2>{0.133174986f, 0.692466199f},
-std::array<float,2>{0.834374309f, 0.211696699f},
-std::array<float,2>{0.780013561f, 0.765805542f},
-std::array<float,2>{0.220817208f, 0.369455636f},
-std::array<float,2>{0.461415708f, 0.538506925f},
-std::array<float,2>{0.749453783f, 0.113626063f},
-std::array<float,2>{0.519402325f, 0.633993089f},
-std::array<float,2>{0.310305059f, 0.160887301f},
-std::array<float,2>{0.0540855117f, 0.901815891f},
-std::array<float,2>{0.971531689f, 0.496828705f},
-std::array<float,2>{0.873186111f, 0.734870613f},
-std::array<float,2>{0.18377088f, 0.237813875f},
-std::array<float,2>{0.396579117f, 0.9500826f},
-std::array<float,2>{0.633626163f, 0.436571091f},
-std::array<float,2>{0.569725156f, 0.854343057f},
-std::array<float,2>{0.339556515f, 0.265349209f},
-std::array<float,2>{0.113023959f, 0.605994523f},
-std::array<float,2>{0.920830786f, 0.0425045677f},
-std::array<float,2>{0.948571086f, 0.934519291f},
-std::array<float,2>{0.00136486755f, 0.452929437f},
-std::array<float,2>{0.255764157f, 0.674126625f},
-std::array<float,2>{0.535795093f, 0.129654601f},
-std::array<float,2>{0.713259101f, 0.514090717f},
-std::array<float,2>{0.480536133f, 0.0936542824f},
-std::array<float,2>{0.205963477f, 0.784620106f},
-std::array<float,2>{0.799945354f, 0.32146135f},
-std::array<float,2>{0.910331905f, 0.696725845f},
-std::array<float,2>{0.120663345f, 0.208379418f},
-std::array<float,2>{0.330226421f, 0.983700395f},
-std::array<float,2>{0.574154139f, 0.388137072f},
-std::array<float,2>{0.6262936f, 0.839667201f},
-std::array<float,2>{0.402332813f, 0.296372682f},
-std::array<float,2>{0.174987733f, 0.590344191f},
-std::array<float,2>{0.863388062f, 0.00287096854f},
-std::array<float,2>{0.808509767f, 0.893983483f},
-std::array<float,2>{0.213562816f, 0.485095024f},
-std::array<float,2>{0.47555545f, 0.625055552f},
-std::array<float,2>{0.705804825f, 0.167194098f},
-std::array<float,2>{0.542461932f, 0.539113224f},
-std::array<float,2>{0.265538007f, 0.121757247f},
-std::array<float,2>{0.0124941114f, 0.774181962f},
-std::array<float,2>{0.9429245f, 0.366613328f},
-std::array<float,2>{0.836450219f, 0.601477444f},
-std::array<float,2>{0.12735635f, 0.0381910838f},
-std::array<float,2>{0.408116937f, 0.843936384f},
-std::array<float,2>{0.685351431f, 0.25002268f},
-std::array<float,2>{0.599814415f, 0.94206816f},
-std::array<float,2>{0.373487204f, 0.428670734f},
-std::array<float,2>{0.0706224218f, 0.742423058f},
-std::array<float,2>{0.898448825f, 0.245092154f},
-std::array<float,2>{0.97799319f, 0.790760696f},
-std::array<float,2>{0.0554917343f, 0.317269236f},
-std::array<float,2>{0.304132491f, 0.501928866f},
-std::array<float,2>{0.528315187f, 0.0824127197f},
-std::array<float,2>{0.737399757f, 0.687315047f},
-std::array<float,2>{0.457963079f, 0.133307278f},
-std::array<float,2>{0.229413569f, 0.928468764f},
-std::array<float,2>{0.76913923f, 0.443253845f},
-std::array<float,2>{0.96397984f, 0.515718937f},
-std::array<float,2>{0.0228674933f, 0.0773683786f},
-std::array<float,2>{0.276505798f, 0.811477661f},
-std::array<float,2>{0.554133952f, 0.341432303f},
-std::array<float,2>{0.692191899f, 0.919266522f},
-std::array<float,2>{0.499574661f, 0.453771442f},
-std::array<float,2>{0.19506821f, 0.66891408f},
-std::array<float,2>{0.792824149f, 0.152266875f},
-std::array<float,2>{0.846624196f, 0.867680073f},
-std::array<float,2>{0.163031638f, 0.273552924f},
-std::array<float,2>{0.390215486f, 0.620210946f},
-std::array<float,2>{0.650146008f, 0.0565875694f},
-std::array<float,2>{0.590671957f, 0.722182751f},
-std::array<float,2>{0.321005225f, 0.227483243f},
-std::array<float,2>{0.104112506f, 0.960101068f},
-std::array<float,2>{0.933094978f, 0.419514179f},
-std::array<float,2>{0.762560964f, 0.641973078f},
-std::array<float,2>{0.241787717f, 0.183510616f},
-std::array<float,2>{0.441357493f, 0.881387532f},
-std::array<float,2>{0.728273034f, 0.479398936f},
-std::array<float,2>{0.502987206f, 0.754352212f},
-std::array<float,2>{0.28226459f, 0.351705581f},
-std::array<float,2>{0.0375044085f, 0.558872879f},
-std::array<float,2>{0.996798456f, 0.109162413f},
-std::array<float,2>{0.877737939f, 0.984561503f},
-std::array<float,2>{0.0874126703f, 0.393334359f},
-std::array<float,2>{0.344296426f, 0.715077758f},
-std::array<float,2>{0.612065315f, 0.195944324f},
-std::array<float,2>{0.669290185f, 0.563454449f},
-std::array<float,2>{0.428386241f, 0.0304770134f},
-std::array<float,2>{0.155074954f, 0.821574688f},
-std::array<float,2>{0.816777885f, 0.309621483f},
-std::array<float,2>{0.884179652f, 0.631237626f},
-std::array<float,2>{0.0820811465f, 0.171247944f},
-std::array<float,2>{0.358492196f, 0.897225797f},
-std::array<float,2>{0.62082231f, 0.488583207f},
-std::array<float,2>{0.659765184f, 0.78043741f},
-std::array<float,2>{0.430312395f, 0.360913306f},
-std::array<float,2>{0.141370878f, 0.544251621f},
-std::array<float,2>{0.823848724f, 0.11944095f},
-std::array<float,2>{0.756728411f, 0.980089366f},
-std::array<float,2>{0.244039997f, 0.383905172f},
-std::array<float,2>{0.450449854f, 0.699654222f},
-std::array<float,2>{0.725341201f, 0.204810038f},
-std::array<float,2>{0.513205588f, 0.586996913f},
-std::array<float,2>{0.294724971f, 0.00575905945f},
-std::array<float,2>{0.0405212045f, 0.840354383f},
-std::array<float,2>{0.988515139f, 0.291143298f},
-std::array<float,2>{0.854608834f, 0.507115602f},
-std::array<float,2>{0.171866894f, 0.0802946314f},
-std::array<float,2>{0.377235204f, 0.79426378f},
-std::array<float,2>{0.640718162f, 0.315167069f},
-std::array<float,2>{0.585276842f, 0.923586845f},
-std::array<float,2>{0.318449199f, 0.438622296f},
-std::array<float,2>{0.100612067f, 0.682630479f},
-std::array<float,2>{0.924762845f, 0.137979448f},
-std::array<float,2>{0.957359314f, 0.848851025f},
-std::array<float,2>{0.0296938643f, 0.256317317f},
-std::array<float,2>{0.271551549f, 0.594664156f},
-std::array<float,2>{0.559657693f, 0.0349316224f},
-std::array<float,2>{0.69664669f, 0.749534965f},
-std::array<float,2>{0.485666811f, 0.246914893f},
-std::array<float,2>{0.196315005f, 0.939662039f},
-std::array<float,2>{0.783636451f, 0.422371328f},
-std::array<float,2>{0.975699127f, 0.623212874f},
-std::array<float,2>{0.047201883f, 0.0616738386f},
-std::array<float,2>{0.304849565f, 0.874966085f},
-std::array<float,2>{0.522204459f, 0.27949205f},
-std::array<float,2>{0.744167984f, 0.953514338f},
-std::array<float,2>{0.465773016f, 0.417638034f},
-std::array<float,2>{0.226228312f, 0.72280854f},
-std::array<float,2>{0.77500093f, 0.233962134f},
-std::array<float,2>{0.830616117f, 0.805375993f},
-std::array<float,2>{0.139271796f, 0.336290836f},
-std::array<float,2>{0.41514349f, 0.52335614f},
-std::array<float,2>{0.675989151f, 0.0728081688f},
-std::array<float,2>{0.607362807f, 0.667407751f},
-std::array<float,2>{0.359925061f, 0.152592316f},
-std::array<float,2>{0.0657000616f, 0.914959133f},
-std::array<float,2>{0.897066593f, 0.459243536f},
-std::array<float,2>{0.802816153f, 0.711581647f},
-std::array<float,2>{0.210315064f, 0.2008425f},
-std::array<float,2>{0.478073597f, 0.989532471f},
-std::array<float,2>{0.7181741f, 0.3961308f},
-std::array<float,2>{0.533801258f, 0.825264454f},
-std::array<float,2>{0.252765119f, 0.308044642f},
-std::array<float,2>{0.00709286425f, 0.569669902f},
-std::array<float,2>{0.949596405f, 0.0267998092f},
-std::array<float,2>{0.915336251f, 0.877129674f},
-std::array<float,2>{0.115580976f, 0.480938613f},
-std::array<float,2>{0.342804044f, 0.645285547f},
-std::array<float,2>{0.562824607f, 0.186931789f},
-std::array<float,2>{0.637800694f, 0.555897772f},
-std::array<float,2>{0.392369866f, 0.101750217f},
-std::array<float,2>{0.180982038f, 0.753221393f},
-std::array<float,2>{0.869581997f, 0.358685344f},
-std::array<float,2>{0.939792514f, 0.727399647f},
-std::array<float,2>{0.00927148946f, 0.222050771f},
-std::array<float,2>{0.25880602f, 0.962351859f},
-std::array<float,2>{0.544874132f, 0.413963705f},
-std::array<float,2>{0.708275735f, 0.860173225f},
-std::array<float,2>{0.468777239f, 0.266551435f},
-std::array<float,2>{0.217967808f, 0.611409843f},
-std::array<float,2>{0.811940253f, 0.0507875457f},
-std::array<float,2>{0.861303747f, 0.909468591f},
-std::array<float,2>{0.175868347f, 0.461998373f},
-std::array<float,2>{0.402518719f, 0.664017141f},
-std::array<float,2>{0.630410373f, 0.148123264f},
-std::array<float,2>{0.575772762f, 0.524160385f},
-std::array<float,2>{0.335542709f, 0.0665534809f},
-std::array<float,2>{0.124513254f, 0.801332355f},
-std::array<float,2>{0.906413317f, 0.328823388f},
-std::array<float,2>{0.770846903f, 0.575235069f},
-std::array<float,2>{0.230876371f, 0.0201461855f},
-std::array<float,2>{0.45633024f, 0.81924063f},
-std::array<float,2>{0.738840997f, 0.299613833f},
-std::array<float,2>{0.525775611f, 0.997734606f},
-std::array<float,2>{0.298037887f, 0.404782087f},
-std::array<float,2>{0.060336411f, 0.710303605f},
-std::array<float,2>{0.982197642f, 0.192764223f},
-std::array<float,2>{0.9037925f, 0.763129056f},
-std::array<float,2>{0.0744288042f, 0.344248354f},
-std::array<float,2>{0.37022689f, 0.550293684f},
-std::array<float,2>{0.595733762f, 0.100634076f},
-std::array<float,2>{0.682863176f, 0.654098332f},
-std::array<float,2>{0.411701679f, 0.178271219f},
-std::array<float,2>{0.132410288f, 0.884457886f},
-std::array<float,2>{0.840647638f, 0.469372362f},
-std::array<float,2>{0.935581863f, 0.534265399f},
-std::array<float,2>{0.106565528f, 0.112616792f},
-std::array<float,2>{0.327103585f, 0.772327304f},
-std::array<float,2>{0.587653935f, 0.373922676f},
-std::array<float,2>{0.654517889f, 0.903155506f},
-std::array<float,2>{0.385110021f, 0.495330751f},
-std::array<float,2>{0.158683166f, 0.637410283f},
-std::array<float,2>{0.848872721f, 0.159074366f},
-std::array<float,2>{0.796062291f, 0.829764962f},
-std::array<float,2>{0.190449864f, 0.28265664f},
-std::array<float,2>{0.492505372f, 0.583367884f},
-std::array<float,2>{0.687829494f, 0.013874731f},
-std::array<float,2>{0.550774693f, 0.690029562f},
-std::array<float,2>{0.278512806f, 0.218124628f},
-std::array<float,2>{0.0177582446f, 0.97064811f},
-std::array<float,2>{0.96741575f, 0.380923122f},
-std::array<float,2>{0.814413965f, 0.67701447f},
-std::array<float,2>{0.148975626f, 0.126720369f},
-std::array<float,2>{0.424216986f, 0.930615842f},
-std::array<float,2>{0.666151464f, 0.448632747f},
-std::array<float,2>{0.615972221f, 0.785677671f},
-std::array<float,2>{0.35047996f, 0.327149123f},
-std::array<float,2>{0.0899736062f, 0.510992408f},
-std::array<float,2>{0.879134178f, 0.0881663933f},
-std::array<float,2>{0.994163573f, 0.946021914f},
-std::array<float,2>{0.0335413255f, 0.430481434f},
-std::array<float,2>{0.287052125f, 0.740151942f},
-std::array<float,2>{0.504752696f, 0.240954921f},
-std::array<float,2>{0.730842471f, 0.604692817f},
-std::array<float,2>{0.441544861f, 0.0451979414f},
-std::array<float,2>{0.237053916f, 0.855805278f},
-std::array<float,2>{0.761496842f, 0.258320093f},
-std::array<float,2>{0.953754783f, 0.651780725f},
-std::array<float,2>{0.0262361374f, 0.172255501f},
-std::array<float,2>{0.269016832f, 0.889011502f},
-std::array<float,2>{0.558128476f, 0.476304263f},
-std::array<float,2>{0.700333655f, 0.759737611f},
-std::array<float,2>{0.488920927f, 0.350335002f},
-std::array<float,2>{0.202227086f, 0.554243207f},
-std::array<float,2>{0.785425842f, 0.0972967669f},
-std::array<float,2>{0.857370973f, 0.994691789f},
-std::array<float,2>{0.16431126f, 0.401043832f},
-std::array<float,2>{0.382628322f, 0.703127265f},
-std::array<float,2>{0.647484481f, 0.188253269f},
-std::array<float,2>{0.579868913f, 0.572506249f},
-std::array<float,2>{0.312770247f, 0.0191772394f},
-std::array<float,2>{0.094250977f, 0.814412117f},
-std::array<float,2>{0.926343203f, 0.303781629f},
-std::array<float,2>{0.751406431f, 0.529168487f},
-std::array<float,2>{0.248889312f, 0.0629648417f},
-std::array<float,2>{0.448738903f, 0.79740417f},
-std::array<float,2>{0.719365597f, 0.335273921f},
-std::array<float,2>{0.508099258f, 0.912351191f},
-std::array<float,2>{0.289177865f, 0.46825549f},
-std::array<float,2>{0.0442016944f, 0.659767568f},
-std::array<float,2>{0.984802544f, 0.143962234f},
-std::array<float,2>{0.887792528f, 0.86675179f},
-std::array<float,2>{0.080230549f, 0.270006537f},
-std::array<float,2>{0.355462551f, 0.616594076f},
-std::array<float,2>{0.621501505f, 0.0491016284f},
-std::array<float,2>{0.661321878f, 0.732218087f},
-std::array<float,2>{0.434205443f, 0.222685829f},
-std::array<float,2>{0.144826487f, 0.967684686f},
-std::array<float,2>{0.82595104f, 0.409715414f},
-std::array<float,2>{0.918827951f, 0.609076858f},
-std::array<float,2>{0.110667147f, 0.0402748697f},
-std::array<float,2>{0.336878866f, 0.853325069f},
-std::array<float,2>{0.567951679f, 0.262463629f},
-std::array<float,2>{0.635626674f, 0.952768743f},
-std::array<float,2>{0.3955082f, 0.43521899f},
-std::array<float,2>{0.186731339f, 0.738043725f},
-std::array<float,2>{0.872526169f, 0.236280963f},
-std::array<float,2>{0.797361135f, 0.781759799f},
-std::array<float,2>{0.203669026f, 0.323894948f},
-std::array<float,2>{0.483496457f, 0.513669491f},
-std::array<float,2>{0.711935997f, 0.0902285799f},
-std::array<float,2>{0.538254619f, 0.672303081f},
-std::array<float,2>{0.25749895f, 0.132658646f},
-std::array<float,2>{0.00262709172f, 0.937337399f},
-std::array<float,2>{0.945711613f, 0.450197607f},
-std::array<float,2>{0.832195997f, 0.694594562f},
-std::array<float,2>{0.135816678f, 0.213728935f},
-std::array<float,2>{0.420868576f, 0.974122167f},
-std::array<float,2>{0.674435019f, 0.378092438f},
-std::array<float,2>{0.605453491f, 0.8321473f},
-std::array<float,2>{0.36518538f, 0.288214147f},
-std::array<float,2>{0.0680987686f, 0.580797732f},
-std::array<float,2>{0.890974283f, 0.010806324f},
-std::array<float,2>{0.96942991f, 0.899496436f},
-std::array<float,2>{0.0513102077f, 0.498601586f},
-std::array<float,2>{0.31079784f, 0.634882629f},
-std::array<float,2>{0.516093135f, 0.162524953f},
-std::array<float,2>{0.747584462f, 0.535814583f},
-std::array<float,2>{0.463596731f, 0.115612298f},
-std::array<float,2>{0.219823211f, 0.769217908f},
-std::array<float,2>{0.777439713f, 0.368608356f},
-std::array<float,2>{0.90204221f, 0.745660603f},
-std::array<float,2>{0.0729029924f, 0.242753714f},
-std::array<float,2>{0.372214705f, 0.944474757f},
-std::array<float,2>{0.599423289f, 0.426891267f},
-std::array<float,2>{0.68605268f, 0.845992446f},
-std::array<float,2>{0.409231901f, 0.253876299f},
-std::array<float,2>{0.126692697f, 0.598375201f},
-std::array<float,2>{0.8392874f, 0.0352841802f},
-std::array<float,2>{0.766462803f, 0.925878584f},
-std::array<float,2>{0.227333903f, 0.443950593f},
-std::array<float,2>{0.459233105f, 0.685209036f},
-std::array<float,2>{0.73462975f, 0.135688558f},
-std::array<float,2>{0.52943927f, 0.503832459f},
-std::array<float,2>{0.301042408f, 0.0858369097f},
-std::array<float,2>{0.058547385f, 0.792177975f},
-std::array<float,2>{0.979606628f, 0.319646686f},
-std::array<float,2>{0.865828693f, 0.592276394f},
-std::array<float,2>{0.172023371f, 0.00111879013f},
-std::array<float,2>{0.399538964f, 0.835962474f},
-std::array<float,2>{0.628543496f, 0.294774145f},
-std::array<float,2>{0.5714432f, 0.980682552f},
-std::array<float,2>{0.32866627f, 0.388738483f},
-std::array<float,2>{0.117485307f, 0.698252916f},
-std::array<float,2>{0.912799418f, 0.209271088f},
-std::array<float,2>{0.943624556f, 0.776513457f},
-std::array<float,2>{0.0138231283f, 0.364139766f},
-std::array<float,2>{0.262822896f, 0.542148769f},
-std::array<float,2>{0.540935576f, 0.123199895f},
-std::array<float,2>{0.703687906f, 0.627832353f},
-std::array<float,2>{0.473310351f, 0.164303705f},
-std::array<float,2>{0.21288617f, 0.890702367f},
-std::array<float,2>{0.806150556f, 0.487994462f},
-std::array<float,2>{0.999948621f, 0.561199307f},
-std::array<float,2>{0.0355119631f, 0.10561163f},
-std::array<float,2>{0.283557743f, 0.756830335f},
-std::array<float,2>{0.500340819f, 0.35398066f},
-std::array<float,2>{0.729402244f, 0.879272997f},
-std::array<float,2>{0.437988073f, 0.477132648f},
-std::array<float,2>{0.240089074f, 0.643369138f},
-std::array<float,2>{0.764193952f, 0.18044512f},
-std::array<float,2>{0.819550157f, 0.82323581f},
-std::array<float,2>{0.152414948f, 0.311642855f},
-std::array<float,2>{0.426621288f, 0.565004349f},
-std::array<float,2>{0.67179209f, 0.0289006289f},
-std::array<float,2>{0.60964793f, 0.718346655f},
-std::array<float,2>{0.346039116f, 0.198731765f},
-std::array<float,2>{0.088060759f, 0.987428129f},
-std::array<float,2>{0.875987113f, 0.391358912f},
-std::array<float,2>{0.790772021f, 0.670455396f},
-std::array<float,2>{0.193078354f, 0.15037258f},
-std::array<float,2>{0.496944249f, 0.92144978f},
-std::array<float,2>{0.694891095f, 0.455672592f},
-std::array<float,2>{0.552365005f, 0.809295833f},
-std::array<float,2>{0.275378704f, 0.342316568f},
-std::array<float,2>{0.0197084136f, 0.519267559f},
-std::array<float,2>{0.96234405f, 0.0755038485f},
-std::array<float,2>{0.931237221f, 0.957565367f},
-std::array<float,2>{0.102067694f, 0.420727015f},
-std::array<float,2>{0.324143201f, 0.719731987f},
-std::array<float,2>{0.593016088f, 0.229177043f},
-std::array<float,2>{0.652039051f, 0.618549466f},
-std::array<float,2>{0.387139052f, 0.0573603362f},
-std::array<float,2>{0.161383599f, 0.869862735f},
-std::array<float,2>{0.844020844f, 0.276985168f},
-std::array<float,2>{0.923522711f, 0.680086195f},
-std::array<float,2>{0.0981296524f, 0.140250504f},
-std::array<float,2>{0.317232043f, 0.924498856f},
-std::array<float,2>{0.583885372f, 0.44099921f},
-std::array<float,2>{0.643712461f, 0.795348406f},
-std::array<float,2>{0.375547647f, 0.313936591f},
-std::array<float,2>{0.169469044f, 0.504302621f},
-std::array<float,2>{0.852184892f, 0.0783967674f},
-std::array<float,2>{0.781563997f, 0.937965214f},
-std::array<float,2>{0.199081987f, 0.425729841f},
-std::array<float,2>{0.48682186f, 0.747753501f},
-std::array<float,2>{0.698618472f, 0.248291314f},
-std::array<float,2>{0.561824739f, 0.596679389f},
-std::array<float,2>{0.269784987f, 0.0313903764f},
-std::array<float,2>{0.0287388898f, 0.85045141f},
-std::array<float,2>{0.960916042f, 0.253986567f},
-std::array<float,2>{0.82198447f, 0.545293987f},
-std::array<float,2>{0.144499123f, 0.117644504f},
-std::array<float,2>{0.433476955f, 0.777867615f},
-std::array<float,2>{0.657687187f, 0.361354947f},
-std::array<float,2>{0.618689597f, 0.896404922f},
-std::array<float,2>{0.356487453f, 0.491751313f},
-std::array<float,2>{0.0856373832f, 0.630358994f},
-std::array<float,2>{0.885658622f, 0.169493631f},
-std::array<float,2>{0.991093457f, 0.842097521f},
-std::array<float,2>{0.0427190885f, 0.290348023f},
-std::array<float,2>{0.295493543f, 0.589530706f},
-std::array<float,2>{0.514086962f, 0.00659347884f},
-std::array<float,2>{0.723008275f, 0.701935112f},
-std::array<float,2>{0.452818245f, 0.205354944f},
-std::array<float,2>{0.245062172f, 0.977615178f},
-std::array<float,2>{0.755090475f, 0.385854274f},
-std::array<float,2>{0.95227921f, 0.567846239f},
-std::array<float,2>{0.00459250994f, 0.0243093278f},
-std::array<float,2>{0.251158923f, 0.827560067f},
-std::array<float,2>{0.532305896f, 0.304699242f},
-std::array<float,2>{0.716313243f, 0.990402937f},
-std::array<float,2>{0.479030073f, 0.398105562f},
-std::array<float,2>{0.207211778f, 0.713347793f},
-std::array<float,2>{0.801504552f, 0.201989084f},
-std::array<float,2>{0.867597282f, 0.750900149f},
-std::array<float,2>{0.181741476f, 0.356129855f},
-std::array<float,2>{0.393345088f, 0.557686985f},
-std::array<float,2>{0.638866484f, 0.104324766f},
-std::array<float,2>{0.566072524f, 0.647936344f},
-std::array<float,2>{0.3409096f, 0.183871031f},
-std::array<float,2>{0.114158846f, 0.876902044f},
-std::array<float,2>{0.917277575f, 0.483122647f},
-std::array<float,2>{0.776236355f, 0.726182997f},
-std::array<float,2>{0.224519685f, 0.231691301f},
-std::array<float,2>{0.466864377f, 0.955940247f},
-std::array<float,2>{0.743595123f, 0.415370584f},
-std::array<float,2>{0.520173073f, 0.87236625f},
-std::array<float,2>{0.308120012f, 0.277736187f},
-std::array<float,2>{0.0501075089f, 0.622964323f},
-std::array<float,2>{0.97360456f, 0.0597203635f},
-std::array<float,2>{0.896383822f, 0.917115629f},
-std::array<float,2>{0.0644400045f, 0.457292527f},
-std::array<float,2>{0.362736374f, 0.664383948f},
-std::array<float,2>{0.608722568f, 0.154403448f},
-std::array<float,2>{0.678428054f, 0.519845843f},
-std::array<float,2>{0.416793734f, 0.0710135102f},
-std::array<float,2>{0.13790223f, 0.80843848f},
-std::array<float,2>{0.829171717f, 0.33833921f},
-std::array<float,2>{0.98288995f, 0.708692253f},
-std::array<float,2>{0.0617618486f, 0.194100648f},
-std::array<float,2>{0.299070358f, 0.99924016f},
-std::array<float,2>{0.524824083f, 0.402920932f},
-std::array<float,2>{0.741563737f, 0.817377627f},
-std::array<float,2>{0.454539478f, 0.298275441f},
-std::array<float,2>{0.233360201f, 0.576823175f},
-std::array<float,2>{0.772526681f, 0.0221247822f},
-std::array<float,2>{0.842148602f, 0.884859562f},
-std::array<float,2>{0.1306182f, 0.47076878f},
-std::array<float,2>{0.412477165f, 0.655231059f},
-std::array<float,2>{0.68031919f, 0.177040964f},
-std::array<float,2>{0.593789101f, 0.5475595f},
-std::array<float,2>{0.367513955f, 0.0995444953f},
-std::array<float,2>{0.0771121085f, 0.764233887f},
-std::array<float,2>{0.904973447f, 0.346591532f},
-std::array<float,2>{0.808646619f, 0.610889673f},
-std::array<float,2>{0.216271177f, 0.0536179096f},
-std::array<float,2>{0.471886069f, 0.862208247f},
-std::array<float,2>{0.7101264f, 0.267984867f},
-std::array<float,2>{0.545077741f, 0.963775098f},
-std::array<float,2>{0.260288745f, 0.411392629f},
-std::array<float,2>{0.0114811109f, 0.729874551f},
-std::array<float,2>{0.938487232f, 0.219215825f},
-std::array<float,2>{0.908788741f, 0.802933991f},
-std::array<float,2>{0.121863171f, 0.331579268f},
-std::array<float,2>{0.333637863f, 0.526207268f},
-std::array<float,2>{0.576857269f, 0.0686987117f},
-std::array<float,2>{0.631887197f, 0.661010683f},
-std::array<float,2>{0.405176103f, 0.145095721f},
-std::array<float,2>{0.179649889f, 0.906821132f},
-std::array<float,2>{0.862077057f, 0.464341313f},
-std::array<float,2>{0.881276846f, 0.508488536f},
-std::array<float,2>{0.0929943919f, 0.0862391219f},
-std::array<float,2>{0.349333286f, 0.788698375f},
-std::array<float,2>{0.614956737f, 0.324240088f},
-std::array<float,2>{0.665394902f, 0.9320454f},
-std::array<float,2>{0.422738701f, 0.44538188f},
-std::array<float,2>{0.150551826f, 0.678198993f},
-std::array<float,2>{0.815783024f, 0.127553836f},
-std::array<float,2>{0.758227468f, 0.857708752f},
-std::array<float,2>{0.23558265f, 0.261238426f},
-std::array<float,2>{0.443636149f, 0.603355169f},
-std::array<float,2>{0.733679295f, 0.0437132977f},
-std::array<float,2>{0.506644309f, 0.741249323f},
-std::array<float,2>{0.289062291f, 0.238601595f},
-std::array<float,2>{0.0321620777f, 0.947664499f},
-std::array<float,2>{0.992770612f, 0.432808071f},
-std::array<float,2>{0.851084888f, 0.639569819f},
-std::array<float,2>{0.15811339f, 0.157804951f},
-std::array<float,2>{0.382880569f, 0.905839801f},
-std::array<float,2>{0.65353775f, 0.492736012f},
-std::array<float,2>{0.588151217f, 0.770403743f},
-std::array<float,2>{0.324738562f, 0.372286081f},
-std::array<float,2>{0.108413421f, 0.532500207f},
-std::array<float,2>{0.9342888f, 0.110379823f},
-std::array<float,2>{0.96614188f, 0.972442985f},
-std::array<float,2>{0.0170695707f, 0.379095763f},
-std::array<float,2>{0.281134903f, 0.688038409f},
-std::array<float,2>{0.547610521f, 0.21546948f},
-std::array<float,2>{0.691379189f, 0.58487922f},
-std::array<float,2>{0.494444549f, 0.0122139128f},
-std::array<float,2>{0.187995389f, 0.831115067f},
-std::array<float,2>{0.794197619f, 0.283945739f},
-std::array<float,2>{0.98121655f, 0.654832065f},
-std::array<float,2>{0.058739908f, 0.176773667f},
-std::array<float,2>{0.297725499f, 0.885226667f},
-std::array<float,2>{0.526983678f, 0.471128374f},
-std::array<float,2>{0.739496112f, 0.764631271f},
-std::array<float,2>{0.4556292f, 0.346429646f},
-std::array<float,2>{0.23183322f, 0.547738135f},
-std::array<float,2>{0.769718468f, 0.0991584361f},
-std::array<float,2>{0.841481388f, 0.999447227f},
-std::array<float,2>{0.131720588f, 0.403303951f},
-std::array<float,2>{0.410328746f, 0.708754957f},
-std::array<float,2>{0.682373703f, 0.193913877f},
-std::array<float,2>{0.596746624f, 0.577067018f},
-std::array<float,2>{0.370070815f, 0.0223670304f},
-std::array<float,2>{0.0755022317f, 0.817032099f},
-std::array<float,2>{0.903095126f, 0.29807061f},
-std::array<float,2>{0.810679317f, 0.526026428f},
-std::array<float,2>{0.217571542f, 0.068503134f},
-std::array<float,2>{0.470192373f, 0.803166687f},
-std::array<float,2>{0.707677841f, 0.331931204f},
-std::array<float,2>{0.543242514f, 0.907109201f},
-std::array<float,2>{0.25863266f, 0.464030892f},
-std::array<float,2>{0.0083263889f, 0.660753608f},
-std::array<float,2>{0.940904677f, 0.145406485f},
-std::array<float,2>{0.907345951f, 0.861826003f},
-std::array<float,2>{0.12360397f, 0.267723531f},
-std::array<float,2>{0.334568739f, 0.611245871f},
-std::array<float,2>{0.574251115f, 0.0534585528f},
-std::array<float,2>{0.628995955f, 0.729598045f},
-std::array<float,2>{0.40338704f, 0.218905389f},
-std::array<float,2>{0.177046537f, 0.963532984f},
-std::array<float,2>{0.860315323f, 0.411274314f},
-std::array<float,2>{0.880845368f, 0.603114545f},
-std::array<float,2>{0.0910642222f, 0.0435602926f},
-std::array<float,2>{0.350789517f, 0.857574344f},
-std::array<float,2>{0.617073298f, 0.261687666f},
-std::array<float,2>{0.667583704f, 0.947439373f},
-std::array<float,2>{0.425031722f, 0.432996035f},
-std::array<float,2>{0.150378764f, 0.741694152f},
-std::array<float,2>{0.812817454f, 0.238474697f},
-std::array<float,2>{0.760116041f, 0.788926125f},
-std::array<float,2>{0.237525389f, 0.324544191f},
-std::array<float,2>{0.443198919f, 0.50856024f},
-std::array<float,2>{0.731906176f, 0.0861751065f},
-std::array<float,2>{0.505238414f, 0.677854419f},
-std::array<float,2>{0.28543371f, 0.127685845f},
-std::array<float,2>{0.0342305787f, 0.931656182f},
-std::array<float,2>{0.995641708f, 0.445674121f},
-std::array<float,2>{0.848091841f, 0.688239157f},
-std::array<float,2>{0.159707099f, 0.215603024f},
-std::array<float,2>{0.386498481f, 0.97224474f},
-std::array<float,2>{0.655655205f, 0.379339278f},
-std::array<float,2>{0.586479306f, 0.831463516f},
-std::array<float,2>{0.328026384f, 0.283850074f},
-std::array<float,2>{0.106331229f, 0.584601521f},
-std::array<float,2>{0.93747884f, 0.0126300566f},
-std::array<float,2>{0.968158364f, 0.90619576f},
-std::array<float,2>{0.0190487709f, 0.492968798f},
-std::array<float,2>{0.27792123f, 0.639338851f},
-std::array<float,2>{0.54955101f, 0.158028722f},
-std::array<float,2>{0.689281046f, 0.532405615f},
-std::array<float,2>{0.493710667f, 0.110822693f},
-std::array<float,2>{0.190415874f, 0.77020961f},
-std::array<float,2>{0.795692742f, 0.372485787f},
-std::array<float,2>{0.925301969f, 0.747911632f},
-std::array<float,2>{0.100070335f, 0.248193055f},
-std::array<float,2>{0.320194215f, 0.937695086f},
-std::array<float,2>{0.584546626f, 0.425450653f},
-std::array<float,2>{0.642415762f, 0.850233078f},
-std::array<float,2>{0.37807104f, 0.254175037f},
-std::array<float,2>{0.170767263f, 0.596250772f},
-std::array<float,2>{0.853919387f, 0.0317189135f},
-std::array<float,2>{0.784835637f, 0.924572051f},
-std::array<float,2>{0.195478842f, 0.441170752f},
-std::array<float,2>{0.485325545f, 0.679870963f},
-std::array<float,2>{0.69577837f, 0.140455067f},
-std::array<float,2>{0.558893085f, 0.503955185f},
-std::array<float,2>{0.273300767f, 0.0781316385f},
-std::array<float,2>{0.0310750585f, 0.794970155f},
-std::array<float,2>{0.958175063f, 0.313486964f},
-std::array<float,2>{0.823183119f, 0.589727223f},
-std::array<float,2>{0.1420746f, 0.00645049708f},
-std::array<float,2>{0.431392848f, 0.841962993f},
-std::array<float,2>{0.658440948f, 0.290114343f},
-std::array<float,2>{0.619497538f, 0.977876902f},
-std::array<float,2>{0.358166277f, 0.385999531f},
-std::array<float,2>{0.0839172229f, 0.701783895f},
-std::array<float,2>{0.882969797f, 0.205174759f},
-std::array<float,2>{0.989355862f, 0.778108776f},
-std::array<float,2>{0.0397628136f, 0.361744761f},
-std::array<float,2>{0.293039918f, 0.545141339f},
-std::array<float,2>{0.511820495f, 0.117193311f},
-std::array<float,2>{0.72609812f, 0.630045414f},
-std::array<float,2>{0.449265063f, 0.169710949f},
-std::array<float,2>{0.242897838f, 0.896086216f},
-std::array<float,2>{0.757783234f, 0.492173254f},
-std::array<float,2>{0.951004326f, 0.558025122f},
-std::array<float,2>{0.00649617333f, 0.104188949f},
-std::array<float,2>{0.253889441f, 0.75069207f},
-std::array<float,2>{0.534864068f, 0.356299162f},
-std::array<float,2>{0.717731953f, 0.876679659f},
-std::array<float,2>{0.47747767f, 0.483216286f},
-std::array<float,2>{0.209038526f, 0.647647321f},
-std::array<float,2>{0.804555595f, 0.183704957f},
-std::array<float,2>{0.870646179f, 0.827186227f},
-std::array<float,2>{0.180656537f, 0.305157185f},
-std::array<float,2>{0.390976369f, 0.567470431f},
-std::array<float,2>{0.636901259f, 0.0240145717f},
-std::array<float,2>{0.563758314f, 0.712916136f},
-std::array<float,2>{0.342078537f, 0.201862171f},
-std::array<float,2>{0.116657272f, 0.990675032f},
-std::array<float,2>{0.914637327f, 0.398362994f},
-std::array<float,2>{0.77424866f, 0.664156914f},
-std::array<float,2>{0.22472547f, 0.154666573f},
-std::array<float,2>{0.466323704f, 0.917256653f},
-std::array<float,2>{0.745122969f, 0.457192034f},
-std::array<float,2>{0.523376763f, 0.808157146f},
-std::array<float,2>{0.306451201f, 0.338130146f},
-std::array<float,2>{0.0487007499f, 0.519534051f},
-std::array<float,2>{0.974903643f, 0.0712101012f},
-std::array<float,2>{0.897898793f, 0.955792606f},
-std::array<float,2>{0.0651109964f, 0.415083528f},
-std::array<float,2>{0.360438943f, 0.726408005f},
-std::array<float,2>{0.606120408f, 0.231618375f},
-std::array<float,2>{0.677369118f, 0.622731388f},
-std::array<float,2>{0.414143592f, 0.0598995797f},
-std::array<float,2>{0.139903232f, 0.872236371f},
-std::array<float,2>{0.831382632f, 0.277537435f},
-std::array<float,2>{0.900188804f, 0.685528815f},
-std::array<float,2>{0.0721224695f, 0.135429218f},
-std::array<float,2>{0.37458387f, 0.926190972f},
-std::array<float,2>{0.601504862f, 0.444105774f},
-std::array<float,2>{0.684269428f, 0.792298615f},
-std::array<float,2>{0.407117754f, 0.319450796f},
-std::array<float,2>{0.128491774f, 0.503500164f},
-std::array<float,2>{0.83718586f, 0.0854815096f},
-std::array<float,2>{0.767710745f, 0.944703341f},
-std::array<float,2>{0.229990497f, 0.427056104f},
-std::array<float,2>{0.458692819f, 0.745866179f},
-std::array<float,2>{0.736918271f, 0.242953598f},
-std::array<float,2>{0.529042304f, 0.598477423f},
-std::array<float,2>{0.302880436f, 0.0355514213f},
-std::array<float,2>{0.0558995083f, 0.845859468f},
-std::array<float,2>{0.976663947f, 0.253627509f},
-std::array<float,2>{0.864648521f, 0.542282999f},
-std::array<float,2>{0.173999682f, 0.123331405f},
-std::array<float,2>{0.400419533f, 0.776826203f},
-std::array<float,2>{0.625416756f, 0.363809198f},
-std::array<float,2>{0.572690248f, 0.890903175f},
-std::array<float,2>{0.331740201f, 0.488063365f},
-std::array<float,2>{0.120096095f, 0.62744391f},
-std::array<float,2>{0.911410093f, 0.164385259f},
-std::array<float,2>{0.941526473f, 0.836182356f},
-std::array<float,2>{0.0135620767f, 0.294656813f},
-std::array<float,2>{0.264344782f, 0.591943443f},
-std::array<float,2>{0.541576743f, 0.00138903037f},
-std::array<float,2>{0.706937373f, 0.698573172f},
-std::array<float,2>{0.476407498f, 0.208994508f},
-std::array<float,2>{0.214118943f, 0.980857015f},
-std::array<float,2>{0.807450831f, 0.3889229f},
-std::array<float,2>{0.997142017f, 0.565357447f},
-std::array<float,2>{0.0388641804f, 0.0291080326f},
-std::array<float,2>{0.282019287f, 0.822858691f},
-std::array<float,2>{0.502578914f, 0.311846644f},
-std::array<float,2>{0.72694993f, 0.98773402f},
-std::array<float,2>{0.439886421f, 0.391136557f},
-std::array<float,2>{0.240679026f, 0.718593121f},
-std::array<float,2>{0.763655663f, 0.199075431f},
-std::array<float,2>{0.818120778f, 0.756438851f},
-std::array<float,2>{0.155475527f, 0.353558034f},
-std::array<float,2>{0.428970277f, 0.561326504f},
-std::array<float,2>{0.668697655f, 0.10594444f},
-std::array<float,2>{0.612439811f, 0.64317739f},
-std::array<float,2>{0.345217556f, 0.180398822f},
-std::array<float,2>{0.086315833f, 0.878967226f},
-std::array<float,2>{0.878755331f, 0.477406979f},
-std::array<float,2>{0.791653395f, 0.720161438f},
-std::array<float,2>{0.193448022f, 0.22932893f},
-std::array<float,2>{0.498721033f, 0.957966805f},
-std::array<float,2>{0.692835271f, 0.420645207f},
-std::array<float,2>{0.553421855f, 0.869993627f},
-std::array<float,2>{0.275809556f, 0.277222037f},
-std::array<float,2>{0.0217269156f, 0.618338764f},
-std::array<float,2>{0.963091254f, 0.0574590825f},
-std::array<float,2>{0.931693673f, 0.921868265f},
-std::array<float,2>{0.104862623f, 0.456052661f},
-std::array<float,2>{0.322233915f, 0.670706451f},
-std::array<float,2>{0.591464221f, 0.150065213f},
-std::array<float,2>{0.649047613f, 0.519449651f},
-std::array<float,2>{0.389050275f, 0.0751956478f},
-std::array<float,2>{0.163878381f, 0.809374511f},
-std::array<float,2>{0.847456396f, 0.342614561f},
-std::array<float,2>{0.955414951f, 0.703434467f},
-std::array<float,2>{0.0234668292f, 0.188187435f},
-std::array<float,2>{0.267143428f, 0.994900644f},
-std::array<float,2>{0.55491966f, 0.401256472f},
-std::array<float,2>{0.702415764f, 0.813985884f},
-std::array<float,2>{0.491788208f, 0.303973824f},
-std::array<float,2>{0.199696913f, 0.572749853f},
-std::array<float,2>{0.788173854f, 0.0194309447f},
-std::array<float,2>{0.858854234f, 0.88876009f},
-std::array<float,2>{0.167003363f, 0.476546526f},
-std::array<float,2>{0.379407495f, 0.651571035f},
-std::array<float,2>{0.644992232f, 0.171962485f},
-std::array<float,2>{0.581804812f, 0.554458022f},
-std::array<float,2>{0.314710468f, 0.0974988565f},
-std::array<float,2>{0.0966280326f, 0.759310126f},
-std::array<float,2>{0.92792505f, 0.350543082f},
-std::array<float,2>{0.752252281f, 0.616292238f},
-std::array<float,2>{0.246698439f, 0.0490643531f},
-std::array<float,2>{0.445389479f, 0.867003739f},
-std::array<float,2>{0.722620726f, 0.269637644f},
-std::array<float,2>{0.510519445f, 0.96733278f},
-std::array<float,2>{0.292885751f, 0.409984827f},
-std::array<float,2>{0.0464647003f, 0.732111573f},
-std::array<float,2>{0.987524867f, 0.222957239f},
-std::array<float,2>{0.888748407f, 0.797765434f},
-std::array<float,2>{0.0788596198f, 0.33509931f},
-std::array<float,2>{0.352172732f, 0.528989553f},
-std::array<float,2>{0.623159349f, 0.0625454187f},
-std::array<float,2>{0.662189841f, 0.659959793f},
-std::array<float,2>{0.436303109f, 0.143571734f},
-std::array<float,2>{0.147107571f, 0.912464559f},
-std::array<float,2>{0.826831341f, 0.467994303f},
-std::array<float,2>{0.921182334f, 0.513336658f},
-std::array<float,2>{0.111742057f, 0.0899159312f},
-std::array<float,2>{0.338199764f, 0.781983256f},
-std::array<float,2>{0.568692923f, 0.323996812f},
-std::array<float,2>{0.633926511f, 0.937144637f},
-std::array<float,2>{0.397608846f, 0.450610846f},
-std::array<float,2>{0.184595898f, 0.672028959f},
-std::array<float,2>{0.874490142f, 0.132343635f},
-std::array<float,2>{0.798832655f, 0.853135526f},
-std::array<float,2>{0.206873283f, 0.262427896f},
-std::array<float,2>{0.482008785f, 0.609240592f},
-std::array<float,2>{0.714517295f, 0.0404166691f},
-std::array<float,2>{0.536979318f, 0.737919927f},
-std::array<float,2>{0.254271448f, 0.235897958f},
-std::array<float,2>{0.00056734361f, 0.953119814f},
-std::array<float,2>{0.947578967f, 0.435467184f},
-std::array<float,2>{0.835786998f, 0.635043085f},
-std::array<float,2>{0.134052321f, 0.162256345f},
-std::array<float,2>{0.418908566f, 0.899706542f},
-std::array<float,2>{0.673244059f, 0.498826534f},
-std::array<float,2>{0.603247702f, 0.76946646f},
-std::array<float,2>{0.366895288f, 0.368230909f},
-std::array<float,2>{0.0694685355f, 0.536115766f},
-std::array<float,2>{0.894116521f, 0.115358777f},
-std::array<float,2>{0.972403169f, 0.974469781f},
-std::array<float,2>{0.0536602028f, 0.378289431f},
-std::array<float,2>{0.308753252f, 0.694407284f},
-std::array<float,2>{0.517848015f, 0.213580891f},
-std::array<float,2>{0.748894215f, 0.581003308f},
-std::array<float,2>{0.462410778f, 0.0110185361f},
-std::array<float,2>{0.221921161f, 0.832373559f},
-std::array<float,2>{0.780843914f, 0.288470209f},
-std::array<float,2>{0.938241541f, 0.663693607f},
-std::array<float,2>{0.0105216512f, 0.148255289f},
-std::array<float,2>{0.260975957f, 0.909392655f},
-std::array<float,2>{0.546733975f, 0.462379009f},
-std::array<float,2>{0.709079623f, 0.801527023f},
-std::array<float,2>{0.470980406f, 0.328998446f},
-std::array<float,2>{0.215452477f, 0.524297416f},
-std::array<float,2>{0.810296297f, 0.0667800084f},
-std::array<float,2>{0.863156855f, 0.961938798f},
-std::array<float,2>{0.178687349f, 0.413741738f},
-std::array<float,2>{0.405934602f, 0.727060854f},
-std::array<float,2>{0.631709337f, 0.221835971f},
-std::array<float,2>{0.577249646f, 0.611680746f},
-std::array<float,2>{0.332578033f, 0.0512554199f},
-std::array<float,2>{0.12276677f, 0.860080719f},
-std::array<float,2>{0.909594774f, 0.266251475f},
-std::array<float,2>{0.771722734f, 0.550737143f},
-std::array<float,2>{0.234303325f, 0.100910872f},
-std::array<float,2>{0.453155309f, 0.76271069f},
-std::array<float,2>{0.74071604f, 0.344598591f},
-std::array<float,2>{0.524102986f, 0.884726226f},
-std::array<float,2>{0.300571024f, 0.469551295f},
-std::array<float,2>{0.0608802438f, 0.653855801f},
-std::array<float,2>{0.984110773f, 0.178610429f},
-std::array<float,2>{0.905378222f, 0.818958104f},
-std::array<float,2>{0.0772545859f, 0.299370885f},
-std::array<float,2>{0.368227422f, 0.575453222f},
-std::array<float,2>{0.595035434f, 0.0202843565f},
-std::array<float,2>{0.681239426f, 0.710158467f},
-std::array<float,2>{0.413093716f, 0.192573234f},
-std::array<float,2>{0.129368708f, 0.997840464f},
-std::array<float,2>{0.843547821f, 0.404433101f},
-std::array<float,2>{0.935376346f, 0.583085835f},
-std::array<float,2>{0.107469738f, 0.0141330529f},
-std::array<float,2>{0.326152653f, 0.830042005f},
-std::array<float,2>{0.589841425f, 0.282437444f},
-std::array<float,2>{0.65282172f, 0.970219374f},
-std::array<float,2>{0.384618372f, 0.38112238f},
-std::array<float,2>{0.156436339f, 0.69037056f},
-std::array<float,2>{0.850193858f, 0.21801126f},
-std::array<float,2>{0.793215811f, 0.772049725f},
-std::array<float,2>{0.18940112f, 0.373726457f},
-std::array<float,2>{0.495767474f, 0.53457737f},
-std::array<float,2>{0.690140426f, 0.112444215f},
-std::array<float,2>{0.54825592f, 0.637491465f},
-std::array<float,2>{0.28008908f, 0.158694044f},
-std::array<float,2>{0.0157688763f, 0.9028579f},
-std::array<float,2>{0.964844227f, 0.495524973f},
-std::array<float,2>{0.814492643f, 0.739930153f},
-std::array<float,2>{0.151515827f, 0.24097231f},
-std::array<float,2>{0.423016459f, 0.946083546f},
-std::array<float,2>{0.66474098f, 0.430406451f},
-std::array<float,2>{0.614051223f, 0.85566175f},
-std::array<float,2>{0.348195046f, 0.258696258f},
-std::array<float,2>{0.0919653326f, 0.604754806f},
-std::array<float,2>{0.881895244f, 0.045111265f},
-std::array<float,2>{0.993630767f, 0.930284977f},
-std::array<float,2>{0.032918971f, 0.448481202f},
-std::array<float,2>{0.287716538f, 0.676835835f},
-std::array<float,2>{0.507781446f, 0.126654506f},
-std::array<float,2>{0.732482255f, 0.510956168f},
-std::array<float,2>{0.444610149f, 0.0880268738f},
-std::array<float,2>{0.235218167f, 0.785954833f},
-std::array<float,2>{0.759034276f, 0.32760334f},
-std::array<float,2>{0.886304498f, 0.699299335f},
-std::array<float,2>{0.0847169533f, 0.205009878f},
-std::array<float,2>{0.356065899f, 0.980262697f},
-std::array<float,2>{0.617690682f, 0.384164095f},
-std::array<float,2>{0.656978786f, 0.840611875f},
-std::array<float,2>{0.431712747f, 0.291309714f},
-std::array<float,2>{0.14330101f, 0.587192774f},
-std::array<float,2>{0.820868731f, 0.00548492279f},
-std::array<float,2>{0.754760265f, 0.897017598f},
-std::array<float,2>{0.245383635f, 0.488515109f},
-std::array<float,2>{0.451516747f, 0.631096542f},
-std::array<float,2>{0.723904252f, 0.171024173f},
-std::array<float,2>{0.515249252f, 0.544083595f},
-std::array<float,2>{0.296428442f, 0.119212985f},
-std::array<float,2>{0.0416745953f, 0.780698657f},
-std::array<float,2>{0.991854072f, 0.361192971f},
-std::array<float,2>{0.85335654f, 0.594289482f},
-std::array<float,2>{0.168660134f, 0.0346806534f},
-std::array<float,2>{0.376602829f, 0.84894985f},
-std::array<float,2>{0.643335462f, 0.255979151f},
-std::array<float,2>{0.582814574f, 0.939933419f},
-std::array<float,2>{0.31795159f, 0.422773987f},
-std::array<float,2>{0.099304609f, 0.749982476f},
-std::array<float,2>{0.922120512f, 0.246678188f},
-std::array<float,2>{0.959154427f, 0.794046402f},
-std::array<float,2>{0.0274744239f, 0.315280646f},
-std::array<float,2>{0.271403611f, 0.507014513f},
-std::array<float,2>{0.561324537f, 0.08044485f},
-std::array<float,2>{0.697860897f, 0.682910502f},
-std::array<float,2>{0.487812519f, 0.137917817f},
-std::array<float,2>{0.197763413f, 0.923517406f},
-std::array<float,2>{0.782627881f, 0.438734561f},
-std::array<float,2>{0.974404991f, 0.523095787f},
-std::array<float,2>{0.0492567122f, 0.0730020255f},
-std::array<float,2>{0.307158947f, 0.805603802f},
-std::array<float,2>{0.521030605f, 0.335960537f},
-std::array<float,2>{0.743046045f, 0.914768875f},
-std::array<float,2>{0.467850834f, 0.459026217f},
-std::array<float,2>{0.222670689f, 0.667181373f},
-std::array<float,2>{0.776861906f, 0.152441308f},
-std::array<float,2>{0.828598499f, 0.874683201f},
-std::array<float,2>{0.136731625f, 0.279643446f},
-std::array<float,2>{0.417610437f, 0.62348175f},
-std::array<float,2>{0.679270208f, 0.0619254708f},
-std::array<float,2>{0.607686043f, 0.723069072f},
-std::array<float,2>{0.362126738f, 0.234160855f},
-std::array<float,2>{0.0632286295f, 0.953248918f},
-std::array<float,2>{0.895165086f, 0.417836189f},
-std::array<float,2>{0.801763296f, 0.645131171f},
-std::array<float,2>{0.208696902f, 0.186650753f},
-std::array<float,2>{0.480056465f, 0.877250731f},
-std::array<float,2>{0.715156853f, 0.480666012f},
-std::array<float,2>{0.531908989f, 0.753050327f},
-std::array<float,2>{0.250474513f, 0.358421743f},
-std::array<float,2>{0.00581004471f, 0.556065559f},
-std::array<float,2>{0.951385498f, 0.101874776f},
-std::array<float,2>{0.916273952f, 0.989285707f},
-std::array<float,2>{0.11520461f, 0.396416515f},
-std::array<float,2>{0.340774f, 0.711832881f},
-std::array<float,2>{0.565410495f, 0.20097059f},
-std::array<float,2>{0.640443504f, 0.569402039f},
-std::array<float,2>{0.394181669f, 0.0264271758f},
-std::array<float,2>{0.182952747f, 0.825664282f},
-std::array<float,2>{0.868979573f, 0.307668269f},
-std::array<float,2>{0.913563788f, 0.625337362f},
-std::array<float,2>{0.11818219f, 0.167347088f},
-std::array<float,2>{0.329102814f, 0.893658578f},
-std::array<float,2>{0.570933104f, 0.485230267f},
-std::array<float,2>{0.627262115f, 0.774075449f},
-std::array<float,2>{0.399214417f, 0.366455019f},
-std::array<float,2>{0.173412904f, 0.539469063f},
-std::array<float,2>{0.867086649f, 0.121920459f},
-std::array<float,2>{0.805465579f, 0.983571172f},
-std::array<float,2>{0.21155192f, 0.387736201f},
-std::array<float,2>{0.474089056f, 0.696362078f},
-std::array<float,2>{0.705056667f, 0.208242565f},
-std::array<float,2>{0.53983897f, 0.590706706f},
-std::array<float,2>{0.262576133f, 0.00244801585f},
-std::array<float,2>{0.014781178f, 0.839550078f},
-std::array<float,2>{0.945045531f, 0.296043068f},
-std::array<float,2>{0.838704705f, 0.501550674f},
-std::array<float,2>{0.125822321f, 0.0820398703f},
-std::array<float,2>{0.408362061f, 0.790849686f},
-std::array<float,2>{0.687371314f, 0.316971123f},
-std::array<float,2>{0.597931027f, 0.928356767f},
-std::array<float,2>{0.371496826f, 0.442887545f},
-std::array<float,2>{0.0737268403f, 0.687134981f},
-std::array<float,2>{0.90061456f, 0.133592859f},
-std::array<float,2>{0.978607595f, 0.844186723f},
-std::array<float,2>{0.0575749353f, 0.250260323f},
-std::array<float,2>{0.302295536f, 0.601310849f},
-std::array<float,2>{0.530532479f, 0.038378641f},
-std::array<float,2>{0.735896826f, 0.742551029f},
-std::array<float,2>{0.460277647f, 0.244846776f},
-std::array<float,2>{0.22850664f, 0.942332566f},
-std::array<float,2>{0.767061949f, 0.428375363f},
-std::array<float,2>{0.960974216f, 0.620469332f},
-std::array<float,2>{0.0206095893f, 0.0562629625f},
-std::array<float,2>{0.273737699f, 0.868041635f},
-std::array<float,2>{0.551121056f, 0.273772836f},
-std::array<float,2>{0.693735123f, 0.960434794f},
-std::array<float,2>{0.497948974f, 0.41989544f},
-std::array<float,2>{0.19190897f, 0.722554684f},
-std::array<float,2>{0.789352298f, 0.227096587f},
-std::array<float,2>{0.845340192f, 0.811139226f},
-std::array<float,2>{0.160586551f, 0.341646284f},
-std::array<float,2>{0.387767673f, 0.516065776f},
-std::array<float,2>{0.65041405f, 0.0774174407f},
-std::array<float,2>{0.59197855f, 0.668485999f},
-std::array<float,2>{0.323082685f, 0.151946574f},
-std::array<float,2>{0.102736779f, 0.91906786f},
-std::array<float,2>{0.929925799f, 0.453997999f},
-std::array<float,2>{0.765319526f, 0.715177417f},
-std::array<float,2>{0.238366291f, 0.196223646f},
-std::array<float,2>{0.438631386f, 0.984844267f},
-std::array<float,2>{0.730037987f, 0.393258542f},
-std::array<float,2>{0.501841009f, 0.821449935f},
-std::array<float,2>{0.284800708f, 0.309994966f},
-std::array<float,2>{0.0370085314f, 0.563144147f},
-std::array<float,2>{0.998982608f, 0.0306518525f},
-std::array<float,2>{0.875700116f, 0.881654143f},
-std::array<float,2>{0.0890923515f, 0.479132056f},
-std::array<float,2>{0.347634107f, 0.641750336f},
-std::array<float,2>{0.611246705f, 0.183157116f},
-std::array<float,2>{0.670548677f, 0.558601141f},
-std::array<float,2>{0.426775068f, 0.109072454f},
-std::array<float,2>{0.153426707f, 0.754117489f},
-std::array<float,2>{0.818367302f, 0.351972073f},
-std::array<float,2>{0.985369205f, 0.734349608f},
-std::array<float,2>{0.0430001095f, 0.225959837f},
-std::array<float,2>{0.290400922f, 0.965397596f},
-std::array<float,2>{0.509027958f, 0.406494915f},
-std::array<float,2>{0.720389962f, 0.864541709f},
-std::array<float,2>{0.447746813f, 0.273269951f},
-std::array<float,2>{0.249565452f, 0.614144206f},
-std::array<float,2>{0.750446022f, 0.0484289527f},
-std::array<float,2>{0.824954689f, 0.911209881f},
-std::array<float,2>{0.145645335f, 0.466153145f},
-std::array<float,2>{0.435147673f, 0.657273412f},
-std::array<float,2>{0.660978794f, 0.141779259f},
-std::array<float,2>{0.622421503f, 0.530775607f},
-std::array<float,2>{0.354130208f, 0.0649305657f},
-std::array<float,2>{0.0819576606f, 0.79969573f},
-std::array<float,2>{0.887450814f, 0.333696753f},
-std::array<float,2>{0.786729574f, 0.570712447f},
-std::array<float,2>{0.201557487f, 0.0170219932f},
-std::array<float,2>{0.489797473f, 0.81480813f},
-std::array<float,2>{0.699454546f, 0.30209446f},
-std::array<float,2>{0.556966424f, 0.992412031f},
-std::array<float,2>{0.268334538f, 0.400213033f},
-std::array<float,2>{0.0266923886f, 0.705147743f},
-std::array<float,2>{0.955038667f, 0.189890698f},
-std::array<float,2>{0.927521467f, 0.76150161f},
-std::array<float,2>{0.0950994566f, 0.34907344f},
-std::array<float,2>{0.314074725f, 0.552180529f},
-std::array<float,2>{0.57813257f, 0.0952662751f},
-std::array<float,2>{0.647335768f, 0.648866653f},
-std::array<float,2>{0.381625801f, 0.17384842f},
-std::array<float,2>{0.165392235f, 0.886817634f},
-std::array<float,2>{0.855471253f, 0.473807126f},
-std::array<float,2>{0.89160943f, 0.538303375f},
-std::array<float,2>{0.0668477565f, 0.113320991f},
-std::array<float,2>{0.363956481f, 0.765891552f},
-std::array<float,2>{0.604217887f, 0.369294196f},
-std::array<float,2>{0.675017357f, 0.901548862f},
-std::array<float,2>{0.421717793f, 0.496789455f},
-std::array<float,2>{0.135722339f, 0.634094596f},
-std::array<float,2>{0.833110392f, 0.16105181f},
-std::array<float,2>{0.778592825f, 0.834053278f},
-std::array<float,2>{0.218806639f, 0.285463661f},
-std::array<float,2>{0.463968009f, 0.579071343f},
-std::array<float,2>{0.746864676f, 0.00966487266f},
-std::array<float,2>{0.517524958f, 0.692719221f},
-std::array<float,2>{0.311534256f, 0.211519852f},
-std::array<float,2>{0.0521929823f, 0.97519213f},
-std::array<float,2>{0.97044903f, 0.375979483f},
-std::array<float,2>{0.871335566f, 0.674027503f},
-std::array<float,2>{0.18624866f, 0.129611671f},
-std::array<float,2>{0.394606113f, 0.934298635f},
-std::array<float,2>{0.635963619f, 0.452781141f},
-std::array<float,2>{0.566424668f, 0.784359992f},
-std::array<float,2>{0.336962312f, 0.32155931f},
-std::array<float,2>{0.109378166f, 0.513827682f},
-std::array<float,2>{0.91959101f, 0.0934855267f},
-std::array<float,2>{0.946782053f, 0.94980979f},
-std::array<float,2>{0.00337694935f, 0.436865658f},
-std::array<float,2>{0.256733805f, 0.735292614f},
-std::array<float,2>{0.53797406f, 0.238230035f},
-std::array<float,2>{0.711313546f, 0.606329918f},
-std::array<float,2>{0.483009428f, 0.0428797342f},
-std::array<float,2>{0.204658285f, 0.854220271f},
-std::array<float,2>{0.798533916f, 0.265581101f},
-std::array<float,2>{0.994691193f, 0.676218331f},
-std::array<float,2>{0.0340118855f, 0.125025228f},
-std::array<float,2>{0.286147684f, 0.931079924f},
-std::array<float,2>{0.504382849f, 0.448198915f},
-std::array<float,2>{0.731198728f, 0.786785483f},
-std::array<float,2>{0.442141563f, 0.326844633f},
-std::array<float,2>{0.236334667f, 0.509800255f},
-std::array<float,2>{0.760965884f, 0.0889558792f},
-std::array<float,2>{0.813602865f, 0.947165191f},
-std::array<float,2>{0.148477256f, 0.43129006f},
-std::array<float,2>{0.424803048f, 0.738393188f},
-std::array<float,2>{0.666515708f, 0.242046952f},
-std::array<float,2>{0.615240097f, 0.603694379f},
-std::array<float,2>{0.349734664f, 0.0462769121f},
-std::array<float,2>{0.0906638056f, 0.857348204f},
-std::array<float,2>{0.879608691f, 0.258929759f},
-std::array<float,2>{0.796621621f, 0.533989787f},
-std::array<float,2>{0.191326708f, 0.111781225f},
-std::array<float,2>{0.492868632f, 0.773138225f},
-std::array<float,2>{0.688396573f, 0.374992758f},
-std::array<float,2>{0.550260961f, 0.904092371f},
-std::array<float,2>{0.279035062f, 0.49415186f},
-std::array<float,2>{0.0184657406f, 0.63833797f},
-std::array<float,2>{0.967041552f, 0.160025895f},
-std::array<float,2>{0.936168671f, 0.828892529f},
-std::array<float,2>{0.107420474f, 0.281862408f},
-std::array<float,2>{0.326237231f, 0.582564235f},
-std::array<float,2>{0.587217987f, 0.0151840001f},
-std::array<float,2>{0.655263722f, 0.690492749f},
-std::array<float,2>{0.385542095f, 0.217181131f},
-std::array<float,2>{0.158778146f, 0.969029784f},
-std::array<float,2>{0.849122167f, 0.38203457f},
-std::array<float,2>{0.90412122f, 0.575128734f},
-std::array<float,2>{0.0750482902f, 0.0209289938f},
-std::array<float,2>{0.370715857f, 0.819801092f},
-std::array<float,2>{0.596418262f, 0.300017864f},
-std::array<float,2>{0.683270633f, 0.996368945f},
-std::array<float,2>{0.411277354f, 0.406182945f},
-std::array<float,2>{0.131939381f, 0.709555328f},
-std::array<float,2>{0.840179265f, 0.192218646f},
-std::array<float,2>{0.771214724f, 0.762628675f},
-std::array<float,2>{0.231143281f, 0.345140308f},
-std::array<float,2>{0.456651449f, 0.549043953f},
-std::array<float,2>{0.738444805f, 0.100160718f},
-std::array<float,2>{0.525886893f, 0.652594149f},
-std::array<float,2>{0.298707724f, 0.179681048f},
-std::array<float,2>{0.0598046072f, 0.883298218f},
-std::array<float,2>{0.981608093f, 0.470493555f},
-std::array<float,2>{0.860628426f, 0.728143871f},
-std::array<float,2>{0.176754087f, 0.221614361f},
-std::array<float,2>{0.403315544f, 0.961863756f},
-std::array<float,2>{0.630020916f, 0.412752867f},
-std::array<float,2>{0.575243711f, 0.861166f},
-std::array<float,2>{0.335276157f, 0.267221421f},
-std::array<float,2>{0.124276213f, 0.61268425f},
-std::array<float,2>{0.906785309f, 0.0526310168f},
-std::array<float,2>{0.940033674f, 0.908483088f},
-std::array<float,2>{0.00952621829f, 0.461766124f},
-std::array<float,2>{0.259320945f, 0.66242975f},
-std::array<float,2>{0.543987811f, 0.147447318f},
-std::array<float,2>{0.708546937f, 0.524872601f},
-std::array<float,2>{0.46944797f, 0.0679589584f},
-std::array<float,2>{0.218648657f, 0.801788151f},
-std::array<float,2>{0.812265635f, 0.329303592f},
-std::array<float,2>{0.915816963f, 0.712227166f},
-std::array<float,2>{0.116193548f, 0.199786216f},
-std::array<float,2>{0.343725085f, 0.988580883f},
-std::array<float,2>{0.563194871f, 0.394926459f},
-std::array<float,2>{0.638417542f, 0.824839711f},
-std::array<float,2>{0.391672611f, 0.30719772f},
-std::array<float,2>{0.181612179f, 0.569092453f},
-std::array<float,2>{0.869663477f, 0.0261450764f},
-std::array<float,2>{0.80333215f, 0.878279984f},
-std::array<float,2>{0.210557044f, 0.481825143f},
-std::array<float,2>{0.478025764f, 0.645816207f},
-std::array<float,2>{0.71866709f, 0.186211482f},
-std::array<float,2>{0.533576071f, 0.555253744f},
-std::array<float,2>{0.252294242f, 0.102623276f},
-std::array<float,2>{0.00741845509f, 0.752064466f},
-std::array<float,2>{0.950121999f, 0.358000249f},
-std::array<float,2>{0.830320001f, 0.624142826f},
-std::array<float,2>{0.138711244f, 0.0611606687f},
-std::array<float,2>{0.415837497f, 0.873226285f},
-std::array<float,2>{0.676434159f, 0.281083673f},
-std::array<float,2>{0.606759131f, 0.954818249f},
-std::array<float,2>{0.359404355f, 0.416294664f},
-std::array<float,2>{0.0662738383f, 0.724327028f},
-std::array<float,2>{0.89680779f, 0.232961953f},
-std::array<float,2>{0.976097107f, 0.806222975f},
-std::array<float,2>{0.0478037931f, 0.337634116f},
-std::array<float,2>{0.305566609f, 0.521576583f},
-std::array<float,2>{0.521609783f, 0.0741277188f},
-std::array<float,2>{0.745035827f, 0.666168392f},
-std::array<float,2>{0.465073109f, 0.153483286f},
-std::array<float,2>{0.225934699f, 0.915518284f},
-std::array<float,2>{0.7748546f, 0.4602395f},
-std::array<float,2>{0.957607746f, 0.506822348f},
-std::array<float,2>{0.0301100127f, 0.0819972605f},
-std::array<float,2>{0.272087246f, 0.793456137f},
-std::array<float,2>{0.560326695f, 0.315502018f},
-std::array<float,2>{0.697156131f, 0.922166765f},
-std::array<float,2>{0.485921174f, 0.438097894f},
-std::array<float,2>{0.197205365f, 0.681912422f},
-std::array<float,2>{0.783842683f, 0.137478679f},
-std::array<float,2>{0.855137587f, 0.847732425f},
-std::array<float,2>{0.17093271f, 0.256916285f},
-std::array<float,2>{0.377682894f, 0.595684409f},
-std::array<float,2>{0.641549349f, 0.0336557776f},
-std::array<float,2>{0.585606039f, 0.748775542f},
-std::array<float,2>{0.319044739f, 0.247794032f},
-std::array<float,2>{0.101230651f, 0.940918684f},
-std::array<float,2>{0.92404902f, 0.423323542f},
-std::array<float,2>{0.756112516f, 0.632767081f},
-std::array<float,2>{0.243521422f, 0.170440853f},
-std::array<float,2>{0.450998247f, 0.89754796f},
-std::array<float,2>{0.724981129f, 0.489289552f},
-std::array<float,2>{0.512875199f, 0.779307842f},
-std::array<float,2>{0.294363201f, 0.359833807f},
-std::array<float,2>{0.040648371f, 0.54338783f},
-std::array<float,2>{0.988967896f, 0.121058822f},
-std::array<float,2>{0.884416699f, 0.979144096f},
-std::array<float,2>{0.0826138034f, 0.383297801f},
-std::array<float,2>{0.359085321f, 0.701145947f},
-std::array<float,2>{0.620210946f, 0.20393762f},
-std::array<float,2>{0.659664512f, 0.586826861f},
-std::array<float,2>{0.429949194f, 0.00447960431f},
-std::array<float,2>{0.140882611f, 0.841025412f},
-std::array<float,2>{0.823566556f, 0.292632967f},
-std::array<float,2>{0.877122462f, 0.640820861f},
-std::array<float,2>{0.0873572081f, 0.182516515f},
-std::array<float,2>{0.344051749f, 0.882336497f},
-std::array<float,2>{0.611344755f, 0.480072916f},
-std::array<float,2>{0.669758797f, 0.755850971f},
-std::array<float,2>{0.42790392f, 0.35284549f},
-std::array<float,2>{0.154311091f, 0.560276449f},
-std::array<float,2>{0.817177236f, 0.107983276f},
-std::array<float,2>{0.76204586f, 0.986209273f},
-std::array<float,2>{0.2413048f, 0.39367786f},
-std::array<float,2>{0.440593153f, 0.715911806f},
-std::array<float,2>{0.72755456f, 0.196366653f},
-std::array<float,2>{0.503764212f, 0.563504338f},
-std::array<float,2>{0.283131987f, 0.0299465377f},
-std::array<float,2>{0.038070742f, 0.820644438f},
-std::array<float,2>{0.996543884f, 0.308804572f},
-std::array<float,2>{0.846103907f, 0.517133534f},
-std::array<float,2>{0.162479281f, 0.0767942369f},
-std::array<float,2>{0.390068263f, 0.811813712f},
-std::array<float,2>{0.649493515f, 0.3401739f},
-std::array<float,2>{0.590016782f, 0.918833137f},
-std::array<float,2>{0.320771694f, 0.454705864f},
-std::array<float,2>{0.103582032f, 0.669508159f},
-std::array<float,2>{0.933542192f, 0.15096499f},
-std::array<float,2>{0.964447439f, 0.868454754f},
-std::array<float,2>{0.0230654459f, 0.274631023f},
-std::array<float,2>{0.277277231f, 0.619200468f},
-std::array<float,2>{0.554657936f, 0.0548608713f},
-std::array<float,2>{0.691418469f, 0.721059203f},
-std::array<float,2>{0.499328703f, 0.227672294f},
-std::array<float,2>{0.194404766f, 0.95908463f},
-std::array<float,2>{0.792460978f, 0.418586671f},
-std::array<float,2>{0.978496492f, 0.60034883f},
-std::array<float,2>{0.0551071353f, 0.0377803668f},
-std::array<float,2>{0.304653943f, 0.8454808f},
-std::array<float,2>{0.527485847f, 0.251443774f},
-std::array<float,2>{0.738146603f, 0.943176448f},
-std::array<float,2>{0.457483947f, 0.428878218f},
-std::array<float,2>{0.228838176f, 0.743678153f},
-std::array<float,2>{0.768680334f, 0.246016487f},
-std::array<float,2>{0.83634752f, 0.789515615f},
-std::array<float,2>{0.127756774f, 0.318047494f},
-std::array<float,2>{0.407534868f, 0.500768483f},
-std::array<float,2>{0.684883356f, 0.0832960829f},
-std::array<float,2>{0.600306392f, 0.685725689f},
-std::array<float,2>{0.373637468f, 0.133962244f},
-std::array<float,2>{0.0712058246f, 0.928786397f},
-std::array<float,2>{0.899071872f, 0.442178547f},
-std::array<float,2>{0.807972014f, 0.69548136f},
-std::array<float,2>{0.213311478f, 0.207576647f},
-std::array<float,2>{0.475000441f, 0.982465327f},
-std::array<float,2>{0.705262244f, 0.387336373f},
-std::array<float,2>{0.542964339f, 0.838788271f},
-std::array<float,2>{0.264920384f, 0.295409113f},
-std::array<float,2>{0.0122028608f, 0.591349065f},
-std::array<float,2>{0.942654967f, 0.00299595343f},
-std::array<float,2>{0.910716712f, 0.893142939f},
-std::array<float,2>{0.120173439f, 0.485389233f},
-std::array<float,2>{0.330998302f, 0.62608099f},
-std::array<float,2>{0.573513389f, 0.166277796f},
-std::array<float,2>{0.626880467f, 0.540052295f},
-std::array<float,2>{0.401427746f, 0.12287835f},
-std::array<float,2>{0.175430447f, 0.775038421f},
-std::array<float,2>{0.864234924f, 0.365345508f},
-std::array<float,2>{0.949128628f, 0.735444784f},
-std::array<float,2>{0.00190314429f, 0.237047955f},
-std::array<float,2>{0.255362839f, 0.950509727f},
-std::array<float,2>{0.535380065f, 0.436113834f},
-std::array<float,2>{0.713768244f, 0.854776919f},
-std::array<float,2>{0.481336087f, 0.263985962f},
-std::array<float,2>{0.205444187f, 0.607196689f},
-std::array<float,2>{0.800745726f, 0.0411992781f},
-std::array<float,2>{0.87363857f, 0.934703112f},
-std::array<float,2>{0.184107587f, 0.451664954f},
-std::array<float,2>{0.39698565f, 0.675133586f},
-std::array<float,2>{0.633011699f, 0.130670011f},
-std::array<float,2>{0.570236206f, 0.515074253f},
-std::array<float,2>{0.33925131f, 0.0920294672f},
-std::array<float,2>{0.11261823f, 0.78415519f},
-std::array<float,2>{0.920318544f, 0.320744932f},
-std::array<float,2>{0.779483497f, 0.579362154f},
-std::array<float,2>{0.221203357f, 0.0083434768f},
-std::array<float,2>{0.461546689f, 0.835742474f},
-std::array<float,2>{0.74962908f, 0.286503404f},
-std::array<float,2>{0.51888752f, 0.976532102f},
-std::array<float,2>{0.309971124f, 0.375141948f},
-std::array<float,2>{0.0544599406f, 0.692182541f},
-std::array<float,2>{0.970998347f, 0.212239683f},
-std::array<float,2>{0.892981172f, 0.76717627f},
-std::array<float,2>{0.0684247836f, 0.370819837f},
-std::array<float,2>{0.365489662f, 0.537236273f},
-std::array<float,2>{0.602008343f, 0.114819318f},
-std::array<float,2>{0.672459066f, 0.633718193f},
-std::array<float,2>{0.419794053f, 0.161420956f},
-std::array<float,2>{0.1335067f, 0.900627255f},
-std::array<float,2>{0.834561825f, 0.497217447f},
-std::array<float,2>{0.929218411f, 0.55105871f},
-std::array<float,2>{0.0972326621f, 0.0942144841f},
-std::array<float,2>{0.316055417f, 0.759938717f},
-std::array<float,2>{0.581018865f, 0.348300278f},
-std::array<float,2>{0.645939767f, 0.888481259f},
-std::array<float,2>{0.379988074f, 0.473135531f},
-std::array<float,2>{0.166571721f, 0.650303066f},
-std::array<float,2>{0.858149648f, 0.175091088f},
-std::array<float,2>{0.787544072f, 0.815681398f},
-std::array<float,2>{0.200695381f, 0.301312f},
-std::array<float,2>{0.49077636f, 0.57216084f},
-std::array<float,2>{0.701289713f, 0.0163330287f},
-std::array<float,2>{0.556300402f, 0.706167579f},
-std::array<float,2>{0.265832096f, 0.191173315f},
-std::array<float,2>{0.0248057712f, 0.993484735f},
-std::array<float,2>{0.956152499f, 0.399072319f},
-std::array<float,2>{0.827335119f, 0.656549454f},
-std::array<float,2>{0.14827244f, 0.140893787f},
-std::array<float,2>{0.43710801f, 0.910316288f},
-std::array<float,2>{0.66348207f, 0.465279132f},
-std::array<float,2>{0.624714315f, 0.800662518f},
-std::array<float,2>{0.352787822f, 0.332336813f},
-std::array<float,2>{0.079474546f, 0.529400408f},
-std::array<float,2>{0.890383601f, 0.0656638071f},
-std::array<float,2>{0.986482203f, 0.966073036f},
-std::array<float,2>{0.0450171009f, 0.408145249f},
-std::array<float,2>{0.291826218f, 0.733092368f},
-std::array<float,2>{0.511086404f, 0.224700719f},
-std::array<float,2>{0.721526146f, 0.614937425f},
-std::array<float,2>{0.447051436f, 0.047426559f},
-std::array<float,2>{0.247895658f, 0.863978088f},
-std::array<float,2>{0.753516495f, 0.271722585f},
-std::array<float,2>{0.966428161f, 0.63965553f},
-std::array<float,2>{0.0174122676f, 0.157115221f},
-std::array<float,2>{0.280456126f, 0.904805422f},
-std::array<float,2>{0.547291279f, 0.493602753f},
-std::array<float,2>{0.690880656f, 0.770812035f},
-std::array<float,2>{0.494638175f, 0.371190965f},
-std::array<float,2>{0.187511101f, 0.531516552f},
-std::array<float,2>{0.794666827f, 0.110224828f},
-std::array<float,2>{0.850919366f, 0.971006095f},
-std::array<float,2>{0.157490492f, 0.380578399f},
-std::array<float,2>{0.383539677f, 0.688716948f},
-std::array<float,2>{0.654147148f, 0.216378763f},
-std::array<float,2>{0.588384748f, 0.585124195f},
-std::array<float,2>{0.324317962f, 0.0134898825f},
-std::array<float,2>{0.109175682f, 0.831051588f},
-std::array<float,2>{0.933915973f, 0.285039842f},
-std::array<float,2>{0.758613706f, 0.509627819f},
-std::array<float,2>{0.236049414f, 0.0875162929f},
-std::array<float,2>{0.444087625f, 0.787205279f},
-std::array<float,2>{0.734080911f, 0.325572222f},
-std::array<float,2>{0.506259024f, 0.932750881f},
-std::array<float,2>{0.288248569f, 0.44657889f},
-std::array<float,2>{0.0317357145f, 0.679506242f},
-std::array<float,2>{0.992257178f, 0.127932996f},
-std::array<float,2>{0.881663084f, 0.858684063f},
-std::array<float,2>{0.0936247557f, 0.260429382f},
-std::array<float,2>{0.348703831f, 0.602408051f},
-std::array<float,2>{0.614537895f, 0.0442914031f},
-std::array<float,2>{0.665618598f, 0.740634501f},
-std::array<float,2>{0.42205295f, 0.239553228f},
-std::array<float,2>{0.151188061f, 0.948925376f},
-std::array<float,2>{0.816106498f, 0.432376415f},
-std::array<float,2>{0.908423245f, 0.609939694f},
-std::array<float,2>{0.121126227f, 0.0545897484f},
-std::array<float,2>{0.333433896f, 0.862854958f},
-std::array<float,2>{0.576394022f, 0.269063354f},
-std::array<float,2>{0.632524133f, 0.964303613f},
-std::array<float,2>{0.404667497f, 0.410540074f},
-std::array<float,2>{0.178802073f, 0.728963256f},
-std::array<float,2>{0.861586452f, 0.220012426f},
-std::array<float,2>{0.809201181f, 0.803891122f},
-std::array<float,2>{0.216373906f, 0.330117822f},
-std::array<float,2>{0.472535878f, 0.527274489f},
-std::array<float,2>{0.710479856f, 0.0695778877f},
-std::array<float,2>{0.54583782f, 0.661968946f},
-std::array<float,2>{0.260100394f, 0.146214053f},
-std::array<float,2>{0.0108528202f, 0.907798409f},
-std::array<float,2>{0.939353645f, 0.462962031f},
-std::array<float,2>{0.842718601f, 0.707521617f},
-std::array<float,2>{0.130156547f, 0.194824308f},
-std::array<float,2>{0.413033098f, 0.998606622f},
-std::array<float,2>{0.680042207f, 0.404128104f},
-std::array<float,2>{0.594324112f, 0.817596614f},
-std::array<float,2>{0.36776334f, 0.297400862f},
-std::array<float,2>{0.0762225613f, 0.577263713f},
-std::array<float,2>{0.904469609f, 0.0230783857f},
-std::array<float,2>{0.982995689f, 0.886429787f},
-std::array<float,2>{0.0623429418f, 0.472606599f},
-std::array<float,2>{0.29970482f, 0.656137586f},
-std::array<float,2>{0.525061429f, 0.176698491f},
-std::array<float,2>{0.742068887f, 0.547994494f},
-std::array<float,2>{0.455003649f, 0.0982788056f},
-std::array<float,2>{0.23256287f, 0.765458465f},
-std::array<float,2>{0.773400962f, 0.346699089f},
-std::array<float,2>{0.895767927f, 0.725025713f},
-std::array<float,2>{0.0637420714f, 0.230495051f},
-std::array<float,2>{0.363263279f, 0.956369877f},
-std::array<float,2>{0.609148085f, 0.414397299f},
-std::array<float,2>{0.677782357f, 0.871562362f},
-std::array<float,2>{0.416345119f, 0.279166311f},
-std::array<float,2>{0.138583288f, 0.621658862f},
-std::array<float,2>{0.829647839f, 0.0586834103f},
-std::array<float,2>{0.775590181f, 0.916176379f},
-std::array<float,2>{0.223831207f, 0.458340257f},
-std::array<float,2>{0.46735388f, 0.66512078f},
-std::array<float,2>{0.743864357f, 0.155552849f},
-std::array<float,2>{0.519691825f, 0.520559728f},
-std::array<float,2>{0.307848692f, 0.0717741251f},
-std::array<float,2>{0.0503475219f, 0.807531834f},
-std::array<float,2>{0.972911835f, 0.339221984f},
-std::array<float,2>{0.867724419f, 0.566777468f},
-std::array<float,2>{0.182284951f, 0.024832774f},
-std::array<float,2>{0.392946005f, 0.826717734f},
-std::array<float,2>{0.639545262f, 0.30631274f},
-std::array<float,2>{0.565607131f, 0.991425335f},
-std::array<float,2>{0.341471583f, 0.396740109f},
-std::array<float,2>{0.113658026f, 0.714327335f},
-std::array<float,2>{0.917962253f, 0.20217973f},
-std::array<float,2>{0.953103185f, 0.751424909f},
-std::array<float,2>{0.00426391978f, 0.35670203f},
-std::array<float,2>{0.251914412f, 0.557041526f},
-std::array<float,2>{0.532939434f, 0.104966499f},
-std::array<float,2>{0.716069937f, 0.64695704f},
-std::array<float,2>{0.478945434f, 0.184586763f},
-std::array<float,2>{0.207859471f, 0.875563264f},
-std::array<float,2>{0.800969183f, 0.483465314f},
-std::array<float,2>{0.990264714f, 0.546242774f},
-std::array<float,2>{0.0424118377f, 0.118890934f},
-std::array<float,2>{0.294979542f, 0.778413594f},
-std::array<float,2>{0.514443278f, 0.362812221f},
-std::array<float,2>{0.723599195f, 0.895493746f},
-std::array<float,2>{0.452201962f, 0.490764588f},
-std::array<float,2>{0.244498074f, 0.628982842f},
-std::array<float,2>{0.755760193f, 0.168333948f},
-std::array<float,2>{0.821535647f, 0.842956722f},
-std::array<float,2>{0.143753946f, 0.289476603f},
-std::array<float,2>{0.432934493f, 0.588365972f},
-std::array<float,2>{0.658178389f, 0.00714456337f},
-std::array<float,2>{0.618618548f, 0.702801168f},
-std::array<float,2>{0.357158393f, 0.207024261f},
-std::array<float,2>{0.085177429f, 0.97695297f},
-std::array<float,2>{0.885233879f, 0.385456264f},
-std::array<float,2>{0.781932116f, 0.681508839f},
-std::array<float,2>{0.198298216f, 0.138674751f},
-std::array<float,2>{0.486647099f, 0.925082326f},
-std::array<float,2>{0.698887587f, 0.43958813f},
-std::array<float,2>{0.562238276f, 0.79644233f},
-std::array<float,2>{0.270229727f, 0.312743217f},
-std::array<float,2>{0.0291300472f, 0.505644679f},
-std::array<float,2>{0.960110247f, 0.0800490901f},
-std::array<float,2>{0.922934949f, 0.93878901f},
-std::array<float,2>{0.0986000821f, 0.424733281f},
-std::array<float,2>{0.316724539f, 0.746767581f},
-std::array<float,2>{0.583398581f, 0.249120146f},
-std::array<float,2>{0.644161761f, 0.596773207f},
-std::array<float,2>{0.375060618f, 0.0326733477f},
-std::array<float,2>{0.16895476f, 0.851042807f},
-std::array<float,2>{0.851636469f, 0.255421013f},
-std::array<float,2>{0.931039631f, 0.671363592f},
-std::array<float,2>{0.102024674f, 0.148623228f},
-std::array<float,2>{0.323266357f, 0.920006633f},
-std::array<float,2>{0.593287528f, 0.457030624f},
-std::array<float,2>{0.651414514f, 0.809769154f},
-std::array<float,2>{0.387432516f, 0.343367964f},
-std::array<float,2>{0.16184403f, 0.518394828f},
-std::array<float,2>{0.844526291f, 0.0745881274f},
-std::array<float,2>{0.790444732f, 0.958599985f},
-std::array<float,2>{0.192683384f, 0.421421051f},
-std::array<float,2>{0.496347249f, 0.719296634f},
-std::array<float,2>{0.694521189f, 0.230442271f},
-std::array<float,2>{0.551966548f, 0.617684484f},
-std::array<float,2>{0.274660468f, 0.0577066913f},
-std::array<float,2>{0.0200771075f, 0.870345712f},
-std::array<float,2>{0.962816954f, 0.2763533f},
-std::array<float,2>{0.820168078f, 0.562455714f},
-std::array<float,2>{0.152928755f, 0.106744662f},
-std::array<float,2>{0.426223755f, 0.757684648f},
-std::array<float,2>{0.670899212f, 0.355131179f},
-std::array<float,2>{0.610090852f, 0.880037606f},
-std::array<float,2>{0.346650481f, 0.478047609f},
-std::array<float,2>{0.0884184092f, 0.644172251f},
-std::array<float,2>{0.876837194f, 0.180770487f},
-std::array<float,2>{0.999454856f, 0.823806286f},
-std::array<float,2>{0.0359787978f, 0.311042488f},
-std::array<float,2>{0.283868223f, 0.565954268f},
-std::array<float,2>{0.500527859f, 0.0278194919f},
-std::array<float,2>{0.728780806f, 0.71731323f},
-std::array<float,2>{0.438325763f, 0.197315708f},
-std::array<float,2>{0.239675567f, 0.987136722f},
-std::array<float,2>{0.764005959f, 0.391725808f},
-std::array<float,2>{0.944335938f, 0.593738496f},
-std::array<float,2>{0.0144098699f, 1.90099104e-06f},
-std::array<float,2>{0.263598382f, 0.83762908f},
-std::array<float,2>{0.540457189f, 0.29391253f},
-std::array<float,2>{0.703287244f, 0.981600344f},
-std::array<float,2>{0.472762346f, 0.389691561f},
-std::array<float,2>{0.21196796f, 0.697529256f},
-std::array<float,2>{0.806173921f, 0.210204095f},
-std::array<float,2>{0.865313172f, 0.776173234f},
-std::array<float,2>{0.172611922f, 0.364990443f},
-std::array<float,2>{0.400218695f, 0.541772306f},
-std::array<float,2>{0.628095329f, 0.124249719f},
-std::array<float,2>{0.571924984f, 0.628022134f},
-std::array<float,2>{0.328605682f, 0.165965542f},
-std::array<float,2>{0.117965348f, 0.892093837f},
-std::array<float,2>{0.912183285f, 0.486693621f},
-std::array<float,2>{0.765941679f, 0.744927943f},
-std::array<float,2>{0.226679116f, 0.243502244f},
-std::array<float,2>{0.459837168f, 0.944064081f},
-std::array<float,2>{0.735146105f, 0.426158398f},
-std::array<float,2>{0.529886186f, 0.846997738f},
-std::array<float,2>{0.301423013f, 0.252097517f},
-std::array<float,2>{0.0579731129f, 0.598657072f},
-std::array<float,2>{0.980455816f, 0.0368636027f},
-std::array<float,2>{0.901453435f, 0.927178502f},
-std::array<float,2>{0.07272394f, 0.444537908f},
-std::array<float,2>{0.372783214f, 0.68442446f},
-std::array<float,2>{0.599086702f, 0.135881305f},
-std::array<float,2>{0.685953975f, 0.502258301f},
-std::array<float,2>{0.409831166f, 0.0843340307f},
-std::array<float,2>{0.126414627f, 0.791912735f},
-std::array<float,2>{0.839470148f, 0.318593264f},
-std::array<float,2>{0.968886673f, 0.693973243f},
-std::array<float,2>{0.0508811586f, 0.214584842f},
-std::array<float,2>{0.311327934f, 0.973102391f},
-std::array<float,2>{0.516314089f, 0.377730966f},
-std::array<float,2>{0.747142673f, 0.833738148f},
-std::array<float,2>{0.463014901f, 0.288056254f},
-std::array<float,2>{0.22062929f, 0.58148247f},
-std::array<float,2>{0.778153479f, 0.00997385103f},
-std::array<float,2>{0.832521319f, 0.898559809f},
-std::array<float,2>{0.136437654f, 0.499536276f},
-std::array<float,2>{0.420268625f, 0.63663888f},
-std::array<float,2>{0.673991859f, 0.163578227f},
-std::array<float,2>{0.604752302f, 0.536625147f},
-std::array<float,2>{0.364576429f, 0.116357736f},
-std::array<float,2>{0.0678268522f, 0.767987132f},
-std::array<float,2>{0.891565025f, 0.367275119f},
-std::array<float,2>{0.797489047f, 0.608143389f},
-std::array<float,2>{0.203127533f, 0.0397233777f},
-std::array<float,2>{0.484235466f, 0.851733983f},
-std::array<float,2>{0.712869704f, 0.263110667f},
-std::array<float,2>{0.538988531f, 0.951721847f},
-std::array<float,2>{0.257207215f, 0.434079528f},
-std::array<float,2>{0.00235222816f, 0.736991823f},
-std::array<float,2>{0.946003199f, 0.235011548f},
-std::array<float,2>{0.918150902f, 0.782861769f},
-std::array<float,2>{0.11103607f, 0.323200822f},
-std::array<float,2>{0.335967064f, 0.512542665f},
-std::array<float,2>{0.56755662f, 0.0910497382f},
-std::array<float,2>{0.635180354f, 0.67371732f},
-std::array<float,2>{0.396358013f, 0.130976766f},
-std::array<float,2>{0.187252983f, 0.936415195f},
-std::array<float,2>{0.872868836f, 0.449573964f},
-std::array<float,2>{0.888665497f, 0.527804255f},
-std::array<float,2>{0.0807212666f, 0.0638716742f},
-std::array<float,2>{0.354913205f, 0.798501194f},
-std::array<float,2>{0.62164706f, 0.334262222f},
-std::array<float,2>{0.661668837f, 0.913884938f},
-std::array<float,2>{0.433713317f, 0.467336446f},
-std::array<float,2>{0.145241708f, 0.658956468f},
-std::array<float,2>{0.825519323f, 0.143072665f},
-std::array<float,2>{0.751796007f, 0.866050303f},
-std::array<float,2>{0.248363033f, 0.270945936f},
-std::array<float,2>{0.448521018f, 0.615871489f},
-std::array<float,2>{0.718783081f, 0.0498798825f},
-std::array<float,2>{0.508533537f, 0.731047273f},
-std::array<float,2>{0.290028989f, 0.224588186f},
-std::array<float,2>{0.0446575992f, 0.968005002f},
-std::array<float,2>{0.985170603f, 0.408430636f},
-std::array<float,2>{0.856702626f, 0.650954485f},
-std::array<float,2>{0.164981425f, 0.173271f},
-std::array<float,2>{0.382202983f, 0.889802337f},
-std::array<float,2>{0.648014128f, 0.475474745f},
-std::array<float,2>{0.579259932f, 0.75790602f},
-std::array<float,2>{0.31322214f, 0.351134777f},
-std::array<float,2>{0.094102852f, 0.553498328f},
-std::array<float,2>{0.926193237f, 0.0960919559f},
-std::array<float,2>{0.953540325f, 0.995493948f},
-std::array<float,2>{0.0255211256f, 0.402062356f},
-std::array<float,2>{0.269356042f, 0.704527795f},
-std::array<float,2>{0.558045626f, 0.188871995f},
-std::array<float,2>{0.701148391f, 0.573774815f},
-std::array<float,2>{0.488619655f, 0.0184970684f},
-std::array<float,2>{0.202823594f, 0.812807083f},
-std::array<float,2>{0.786025405f, 0.302794069f},
-std::array<float,2>{0.988556027f, 0.629488409f},
-std::array<float,2>{0.0402601957f, 0.16856423f},
-std::array<float,2>{0.294529617f, 0.894865751f},
-std::array<float,2>{0.513646722f, 0.490346432f},
-std::array<float,2>{0.725426555f, 0.779069424f},
-std::array<float,2>{0.450339168f, 0.362655669f},
-std::array<float,2>{0.24381277f, 0.546813548f},
-std::array<float,2>{0.756466269f, 0.118569575f},
-std::array<float,2>{0.824070156f, 0.977350712f},
-std::array<float,2>{0.14119418f, 0.384993315f},
-std::array<float,2>{0.430476725f, 0.702195168f},
-std::array<float,2>{0.659913123f, 0.206438452f},
-std::array<float,2>{0.621008337f, 0.58864522f},
-std::array<float,2>{0.358711481f, 0.00738777732f},
-std::array<float,2>{0.0823175758f, 0.843332827f},
-std::array<float,2>{0.883847058f, 0.289912969f},
-std::array<float,2>{0.783339441f, 0.505085766f},
-std::array<float,2>{0.196627125f, 0.0795473829f},
-std::array<float,2>{0.485512018f, 0.796203673f},
-std::array<float,2>{0.696419358f, 0.313272595f},
-std::array<float,2>{0.560029507f, 0.925671756f},
-std::array<float,2>{0.271759957f, 0.439953715f},
-std::array<float,2>{0.0294789169f, 0.680781126f},
-std::array<float,2>{0.957037687f, 0.139259264f},
-std::array<float,2>{0.924480259f, 0.851155341f},
-std::array<float,2>{0.100848556f, 0.254982799f},
-std::array<float,2>{0.318758041f, 0.597612321f},
-std::array<float,2>{0.585050166f, 0.0327718258f},
-std::array<float,2>{0.640897155f, 0.746354699f},
-std::array<float,2>{0.377036601f, 0.249899566f},
-std::array<float,2>{0.171402648f, 0.939236045f},
-std::array<float,2>{0.85486722f, 0.424017042f},
-std::array<float,2>{0.897333741f, 0.621169984f},
-std::array<float,2>{0.0656229332f, 0.0595293269f},
-std::array<float,2>{0.360124737f, 0.871717513f},
-std::array<float,2>{0.607102513f, 0.278658271f},
-std::array<float,2>{0.676113725f, 0.9568578f},
-std::array<float,2>{0.415398568f, 0.414757401f},
-std::array<float,2>{0.139468029f, 0.725385547f},
-std::array<float,2>{0.830979705f, 0.231188595f},
-std::array<float,2>{0.775235534f, 0.806741357f},
-std::array<float,2>{0.226465836f, 0.339764327f},
-std::array<float,2>{0.465527058f, 0.521404684f},
-std::array<float,2>{0.744501889f, 0.072115913f},
-std::array<float,2>{0.522321463f, 0.665998399f},
-std::array<float,2>{0.305158645f, 0.1560518f},
-std::array<float,2>{0.0470965058f, 0.916816771f},
-std::array<float,2>{0.976040959f, 0.458580673f},
-std::array<float,2>{0.869213998f, 0.714582443f},
-std::array<float,2>{0.180869073f, 0.2029237f},
-std::array<float,2>{0.392127395f, 0.992154777f},
-std::array<float,2>{0.638035595f, 0.397242874f},
-std::array<float,2>{0.562533855f, 0.826294839f},
-std::array<float,2>{0.343081474f, 0.305677116f},
-std::array<float,2>{0.115280546f, 0.566931784f},
-std::array<float,2>{0.915109873f, 0.0253621656f},
-std::array<float,2>{0.949449241f, 0.875433683f},
-std::array<float,2>{0.00688513601f, 0.48396948f},
-std::array<float,2>{0.252484828f, 0.647398114f},
-std::array<float,2>{0.534066856f, 0.185452327f},
-std::array<float,2>{0.717984378f, 0.557407439f},
-std::array<float,2>{0.478302062f, 0.105025612f},
-std::array<float,2>{0.209969044f, 0.751776159f},
-std::array<float,2>{0.803128481f, 0.357181191f},
-std::array<float,2>{0.906718791f, 0.729389131f},
-std::array<float,2>{0.124945112f, 0.220541328f},
-std::array<float,2>{0.335889727f, 0.964749098f},
-std::array<float,2>{0.576068401f, 0.410729408f},
-std::array<float,2>{0.630799353f, 0.862334907f},
-std::array<float,2>{0.402599722f, 0.268650472f},
-std::array<float,2>{0.176192135f, 0.609380603f},
-std::array<float,2>{0.860895395f, 0.0538168363f},
-std::array<float,2>{0.811593533f, 0.907538831f},
-std::array<float,2>{0.218098119f, 0.46348682f},
-std::array<float,2>{0.469060898f, 0.661156237f},
-std::array<float,2>{0.708228588f, 0.145733863f},
-std::array<float,2>{0.544467866f, 0.526686072f},
-std::array<float,2>{0.259125352f, 0.0699570253f},
-std::array<float,2>{0.00903285947f, 0.804255128f},
-std::array<float,2>{0.939476848f, 0.331014186f},
-std::array<float,2>{0.840398014f, 0.577994585f},
-std::array<float,2>{0.132734641f, 0.0228579808f},
-std::array<float,2>{0.411927789f, 0.818328321f},
-std::array<float,2>{0.682829201f, 0.297045708f},
-std::array<float,2>{0.596032202f, 0.998296797f},
-std::array<float,2>{0.37042892f, 0.40363127f},
-std::array<float,2>{0.0746053606f, 0.707090318f},
-std::array<float,2>{0.903326511f, 0.194579169f},
-std::array<float,2>{0.981959641f, 0.764850199f},
-std::array<float,2>{0.0601610765f, 0.347350955f},
-std::array<float,2>{0.298206061f, 0.548602104f},
-std::array<float,2>{0.52550751f, 0.098100014f},
-std::array<float,2>{0.739178061f, 0.655395746f},
-std::array<float,2>{0.45606786f, 0.17618984f},
-std::array<float,2>{0.230682179f, 0.886192501f},
-std::array<float,2>{0.770686388f, 0.471950769f},
-std::array<float,2>{0.967764139f, 0.531764627f},
-std::array<float,2>{0.0180363748f, 0.109835453f},
-std::array<float,2>{0.278608978f, 0.771474302f},
-std::array<float,2>{0.550334096f, 0.371773511f},
-std::array<float,2>{0.687669814f, 0.904339492f},
-std::array<float,2>{0.492261112f, 0.494038463f},
-std::array<float,2>{0.190766007f, 0.640336931f},
-std::array<float,2>{0.7962569f, 0.156636357f},
-std::array<float,2>{0.848888159f, 0.830168605f},
-std::array<float,2>{0.158336639f, 0.28439334f},
-std::array<float,2>{0.384786427f, 0.585858643f},
-std::array<float,2>{0.654577553f, 0.0130142774f},
-std::array<float,2>{0.587603271f, 0.689036369f},
-std::array<float,2>{0.326898158f, 0.215922788f},
-std::array<float,2>{0.106826715f, 0.971596837f},
-std::array<float,2>{0.936008573f, 0.380138874f},
-std::array<float,2>{0.761465967f, 0.678893149f},
-std::array<float,2>{0.23724325f, 0.128539577f},
-std::array<float,2>{0.441751003f, 0.933466256f},
-std::array<float,2>{0.730674863f, 0.446863353f},
-std::array<float,2>{0.504426301f, 0.78766793f},
-std::array<float,2>{0.286827743f, 0.325858235f},
-std::array<float,2>{0.0332694165f, 0.508807838f},
-std::array<float,2>{0.994430065f, 0.0872096792f},
-std::array<float,2>{0.879231632f, 0.948540628f},
-std::array<float,2>{0.0901356637f, 0.432033807f},
-std::array<float,2>{0.350180447f, 0.741099954f},
-std::array<float,2>{0.615916371f, 0.240192592f},
-std::array<float,2>{0.666363657f, 0.601590574f},
-std::array<float,2>{0.423919588f, 0.0448838063f},
-std::array<float,2>{0.149337366f, 0.859080374f},
-std::array<float,2>{0.814166248f, 0.260133028f},
-std::array<float,2>{0.889767051f, 0.658393562f},
-std::array<float,2>{0.0798463747f, 0.142696366f},
-std::array<float,2>{0.35332793f, 0.913167298f},
-std::array<float,2>{0.624089599f, 0.466882288f},
-std::array<float,2>{0.663673043f, 0.798213243f},
-std::array<float,2>{0.436822623f, 0.334739953f},
-std::array<float,2>{0.147535235f, 0.528121829f},
-std::array<float,2>{0.827879906f, 0.0641388893f},
-std::array<float,2>{0.753080726f, 0.968695998f},
-std::array<float,2>{0.247526795f, 0.408721328f},
-std::array<float,2>{0.4464477f, 0.730654836f},
-std::array<float,2>{0.721166193f, 0.223960176f},
-std::array<float,2>{0.511457562f, 0.615365267f},
-std::array<float,2>{0.291385174f, 0.0505535193f},
-std::array<float,2>{0.0454209149f, 0.865324855f},
-std::array<float,2>{0.987078905f, 0.271464258f},
-std::array<float,2>{0.857480168f, 0.552905798f},
-std::array<float,2>{0.166444302f, 0.0966128111f},
-std::array<float,2>{0.380704731f, 0.758427858f},
-std::array<float,2>{0.646377861f, 0.350587338f},
-std::array<float,2>{0.580340564f, 0.890422702f},
-std::array<float,2>{0.31548351f, 0.474690288f},
-std::array<float,2>{0.0970876887f, 0.65072459f},
-std::array<float,2>{0.928942323f, 0.173822358f},
-std::array<float,2>{0.956962168f, 0.813116491f},
-std::array<float,2>{0.0249625258f, 0.303296834f},
-std::array<float,2>{0.266327292f, 0.573662996f},
-std::array<float,2>{0.556079626f, 0.0180425774f},
-std::array<float,2>{0.702142179f, 0.704680502f},
-std::array<float,2>{0.490346581f, 0.189358607f},
-std::array<float,2>{0.200642407f, 0.99570477f},
-std::array<float,2>{0.787654102f, 0.401820391f},
-std::array<float,2>{0.971216023f, 0.581688821f},
-std::array<float,2>{0.0539425537f, 0.0105247786f},
-std::array<float,2>{0.310060978f, 0.833319604f},
-std::array<float,2>{0.519122541f, 0.287312835f},
-std::array<float,2>{0.749049783f, 0.973378181f},
-std::array<float,2>{0.461119801f, 0.377237558f},
-std::array<float,2>{0.221058801f, 0.693465769f},
-std::array<float,2>{0.780165851f, 0.214078054f},
-std::array<float,2>{0.834097505f, 0.768476307f},
-std::array<float,2>{0.132854104f, 0.367894083f},
-std::array<float,2>{0.4191508f, 0.536496341f},
-std::array<float,2>{0.671945691f, 0.116873354f},
-std::array<float,2>{0.602505624f, 0.636140645f},
-std::array<float,2>{0.366198003f, 0.163475335f},
-std::array<float,2>{0.0692234486f, 0.89910239f},
-std::array<float,2>{0.893536568f, 0.499398798f},
-std::array<float,2>{0.800117016f, 0.7363711f},
-std::array<float,2>{0.205625236f, 0.234664723f},
-std::array<float,2>{0.480765194f, 0.951335371f},
-std::array<float,2>{0.71301955f, 0.434495389f},
-std::array<float,2>{0.536110282f, 0.852441907f},
-std::array<float,2>{0.255467117f, 0.263276458f},
-std::array<float,2>{0.00112533628f, 0.607599676f},
-std::array<float,2>{0.948307872f, 0.0394948572f},
-std::array<float,2>{0.920585811f, 0.935570002f},
-std::array<float,2>{0.113246039f, 0.449738503f},
-std::array<float,2>{0.33978346f, 0.673037767f},
-std::array<float,2>{0.569531441f, 0.131716102f},
-std::array<float,2>{0.633459687f, 0.511906385f},
-std::array<float,2>{0.396809489f, 0.0913206786f},
-std::array<float,2>{0.184030712f, 0.78231281f},
-std::array<float,2>{0.873428881f, 0.322510302f},
-std::array<float,2>{0.943236709f, 0.697901309f},
-std::array<float,2>{0.0123164756f, 0.210880131f},
-std::array<float,2>{0.265241742f, 0.982266188f},
-std::array<float,2>{0.542074323f, 0.390299201f},
-std::array<float,2>{0.705991745f, 0.837162971f},
-std::array<float,2>{0.475161284f, 0.293077588f},
-std::array<float,2>{0.213728562f, 0.592913032f},
-std::array<float,2>{0.808303356f, 0.000638986705f},
-std::array<float,2>{0.863710403f, 0.891664267f},
-std::array<float,2>{0.175089523f, 0.487187505f},
-std::array<float,2>{0.402095675f, 0.628564775f},
-std::array<float,2>{0.62611258f, 0.165126309f},
-std::array<float,2>{0.573914886f, 0.54102385f},
-std::array<float,2>{0.330519825f, 0.12487556f},
-std::array<float,2>{0.120902628f, 0.775818706f},
-std::array<float,2>{0.910622239f, 0.364434212f},
-std::array<float,2>{0.769482374f, 0.599353909f},
-std::array<float,2>{0.229029357f, 0.0362589881f},
-std::array<float,2>{0.457541972f, 0.847427309f},
-std::array<float,2>{0.737584531f, 0.252580106f},
-std::array<float,2>{0.527974129f, 0.943831742f},
-std::array<float,2>{0.30388543f, 0.426726073f},
-std::array<float,2>{0.0553862192f, 0.744455993f},
-std::array<float,2>{0.977670491f, 0.244097933f},
-std::array<float,2>{0.898753047f, 0.791475594f},
-std::array<float,2>{0.0704993382f, 0.318943948f},
-std::array<float,2>{0.37317124f, 0.502701879f},
-std::array<float,2>{0.600053191f, 0.0847434774f},
-std::array<float,2>{0.685157657f, 0.683669984f},
-std::array<float,2>{0.407722205f, 0.136341408f},
-std::array<float,2>{0.127044931f, 0.927478194f},
-std::array<float,2>{0.836792588f, 0.444951683f},
-std::array<float,2>{0.932840824f, 0.517906129f},
-std::array<float,2>{0.104437456f, 0.0749816746f},
-std::array<float,2>{0.321240544f, 0.810083687f},
-std::array<float,2>{0.590486944f, 0.342841893f},
-std::array<float,2>{0.650163472f, 0.920429945f},
-std::array<float,2>{0.390624166f, 0.456059724f},
-std::array<float,2>{0.162830591f, 0.671406806f},
-std::array<float,2>{0.846224368f, 0.149011791f},
-std::array<float,2>{0.792487442f, 0.870646536f},
-std::array<float,2>{0.195136324f, 0.275865883f},
-std::array<float,2>{0.499940157f, 0.617368519f},
-std::array<float,2>{0.692064703f, 0.0582612976f},
-std::array<float,2>{0.553943098f, 0.718778908f},
-std::array<float,2>{0.276629448f, 0.229912296f},
-std::array<float,2>{0.0225977749f, 0.958261192f},
-std::array<float,2>{0.964349687f, 0.421307057f},
-std::array<float,2>{0.816623747f, 0.643992245f},
-std::array<float,2>{0.154797539f, 0.181233168f},
-std::array<float,2>{0.42867133f, 0.880764604f},
-std::array<float,2>{0.669100046f, 0.477766752f},
-std::array<float,2>{0.611980975f, 0.75705862f},
-std::array<float,2>{0.344559342f, 0.354502767f},
-std::array<float,2>{0.0877747238f, 0.561820269f},
-std::array<float,2>{0.877529442f, 0.107302926f},
-std::array<float,2>{0.997043848f, 0.986678123f},
-std::array<float,2>{0.0372832194f, 0.392473429f},
-std::array<float,2>{0.282493174f, 0.716963828f},
-std::array<float,2>{0.503361821f, 0.197770268f},
-std::array<float,2>{0.728080332f, 0.565846801f},
-std::array<float,2>{0.440933794f, 0.0281220712f},
-std::array<float,2>{0.242001638f, 0.823287606f},
-std::array<float,2>{0.762276232f, 0.31056422f},
-std::array<float,2>{0.96061331f, 0.682145059f},
-std::array<float,2>{0.0283761658f, 0.136769012f},
-std::array<float,2>{0.269688487f, 0.922499239f},
-std::array<float,2>{0.561711192f, 0.437788129f},
-std::array<float,2>{0.698459804f, 0.793863952f},
-std::array<float,2>{0.487261713f, 0.316066623f},
-std::array<float,2>{0.19885616f, 0.506015718f},
-std::array<float,2>{0.781397581f, 0.081271112f},
-std::array<float,2>{0.85247618f, 0.940868735f},
-std::array<float,2>{0.169736698f, 0.423497319f},
-std::array<float,2>{0.375944912f, 0.748400867f},
-std::array<float,2>{0.643842816f, 0.247540638f},
-std::array<float,2>{0.583683968f, 0.594986141f},
-std::array<float,2>{0.317110986f, 0.0340283141f},
-std::array<float,2>{0.0977155045f, 0.848448515f},
-std::array<float,2>{0.923642337f, 0.257593483f},
-std::array<float,2>{0.755339622f, 0.543740809f},
-std::array<float,2>{0.244862035f, 0.120321445f},
-std::array<float,2>{0.453009427f, 0.779880524f},
-std::array<float,2>{0.722698629f, 0.3601982f},
-std::array<float,2>{0.513806999f, 0.898095489f},
-std::array<float,2>{0.295806378f, 0.490152717f},
-std::array<float,2>{0.0428247191f, 0.632057905f},
-std::array<float,2>{0.990862131f, 0.169977516f},
-std::array<float,2>{0.885491371f, 0.841392457f},
-std::array<float,2>{0.0857576951f, 0.292398602f},
-std::array<float,2>{0.356789231f, 0.585959554f},
-std::array<float,2>{0.618995249f, 0.00391868548f},
-std::array<float,2>{0.657333076f, 0.700486481f},
-std::array<float,2>{0.43333742f, 0.203560084f},
-std::array<float,2>{0.14427197f, 0.97854948f},
-std::array<float,2>{0.822026014f, 0.383765727f},
-std::array<float,2>{0.917123735f, 0.568638265f},
-std::array<float,2>{0.113953516f, 0.0254958607f},
-std::array<float,2>{0.341244429f, 0.824487448f},
-std::array<float,2>{0.566198528f, 0.306755871f},
-std::array<float,2>{0.638950288f, 0.988884985f},
-std::array<float,2>{0.393244147f, 0.395347983f},
-std::array<float,2>{0.181979731f, 0.712869883f},
-std::array<float,2>{0.867269397f, 0.199379489f},
-std::array<float,2>{0.801593065f, 0.752873898f},
-std::array<float,2>{0.20751518f, 0.357484877f},
-std::array<float,2>{0.479339361f, 0.554884493f},
-std::array<float,2>{0.716600299f, 0.103078052f},
-std::array<float,2>{0.532594383f, 0.646368861f},
-std::array<float,2>{0.251316458f, 0.185728788f},
-std::array<float,2>{0.00485478854f, 0.87875402f},
-std::array<float,2>{0.952506363f, 0.481977165f},
-std::array<float,2>{0.829401076f, 0.72392875f},
-std::array<float,2>{0.138151556f, 0.232699201f},
-std::array<float,2>{0.416526675f, 0.954105914f},
-std::array<float,2>{0.678610444f, 0.416610688f},
-std::array<float,2>{0.608418524f, 0.873743653f},
-std::array<float,2>{0.362476379f, 0.280520529f},
-std::array<float,2>{0.0640324429f, 0.624547899f},
-std::array<float,2>{0.896082997f, 0.060729567f},
-std::array<float,2>{0.97322166f, 0.91574657f},
-std::array<float,2>{0.0499388166f, 0.460567713f},
-std::array<float,2>{0.308575898f, 0.666731715f},
-std::array<float,2>{0.520269334f, 0.154112667f},
-std::array<float,2>{0.743188918f, 0.522325158f},
-std::array<float,2>{0.467087775f, 0.0735514536f},
-std::array<float,2>{0.224128664f, 0.805792511f},
-std::array<float,2>{0.775990367f, 0.337112695f},
-std::array<float,2>{0.905237079f, 0.709107399f},
-std::array<float,2>{0.0768841356f, 0.191581845f},
-std::array<float,2>{0.367429316f, 0.996590078f},
-std::array<float,2>{0.594077289f, 0.405667305f},
-std::array<float,2>{0.680447936f, 0.819932163f},
-std::array<float,2>{0.412216187f, 0.30065912f},
-std::array<float,2>{0.130552873f, 0.574437976f},
-std::array<float,2>{0.841904879f, 0.0212186035f},
-std::array<float,2>{0.772916615f, 0.883504987f},
-std::array<float,2>{0.232955769f, 0.469927549f},
-std::array<float,2>{0.454293311f, 0.653263569f},
-std::array<float,2>{0.741247654f, 0.179182127f},
-std::array<float,2>{0.524657249f, 0.549440861f},
-std::array<float,2>{0.299275517f, 0.0996521413f},
-std::array<float,2>{0.0618578494f, 0.762015343f},
-std::array<float,2>{0.982600689f, 0.345363617f},
-std::array<float,2>{0.862042487f, 0.61300391f},
-std::array<float,2>{0.179272801f, 0.0522293672f},
-std::array<float,2>{0.404796302f, 0.86041218f},
-std::array<float,2>{0.632095933f, 0.266807199f},
-std::array<float,2>{0.576953053f, 0.961037099f},
-std::array<float,2>{0.333905548f, 0.412540823f},
-std::array<float,2>{0.121622093f, 0.727972329f},
-std::array<float,2>{0.908974171f, 0.220738381f},
-std::array<float,2>{0.938867748f, 0.802414298f},
-std::array<float,2>{0.0112420032f, 0.329653174f},
-std::array<float,2>{0.260596395f, 0.525223851f},
-std::array<float,2>{0.545345664f, 0.0676323473f},
-std::array<float,2>{0.710399926f, 0.662829518f},
-std::array<float,2>{0.471978813f, 0.146522641f},
-std::array<float,2>{0.215832353f, 0.908894837f},
-std::array<float,2>{0.808848917f, 0.461061358f},
-std::array<float,2>{0.993075013f, 0.510375738f},
-std::array<float,2>{0.0319708921f, 0.0894483253f},
-std::array<float,2>{0.288795888f, 0.786538661f},
-std::array<float,2>{0.506567419f, 0.326430827f},
-std::array<float,2>{0.733581007f, 0.931595087f},
-std::array<float,2>{0.443437129f, 0.4475182f},
-std::array<float,2>{0.235685632f, 0.676508486f},
-std::array<float,2>{0.757939935f, 0.125786573f},
-std::array<float,2>{0.815650225f, 0.85678792f},
-std::array<float,2>{0.150772467f, 0.259597957f},
-std::array<float,2>{0.422591209f, 0.604318142f},
-std::array<float,2>{0.665051281f, 0.0465869941f},
-std::array<float,2>{0.615175724f, 0.739041567f},
-std::array<float,2>{0.349574387f, 0.241271183f},
-std::array<float,2>{0.0931142494f, 0.946606457f},
-std::array<float,2>{0.88100189f, 0.430884361f},
-std::array<float,2>{0.794106543f, 0.638119042f},
-std::array<float,2>{0.188444242f, 0.159363449f},
-std::array<float,2>{0.494252801f, 0.903492153f},
-std::array<float,2>{0.691053092f, 0.494781882f},
-std::array<float,2>{0.547507286f, 0.772595406f},
-std::array<float,2>{0.280771554f, 0.37430957f},
-std::array<float,2>{0.0167513173f, 0.533433437f},
-std::array<float,2>{0.965855539f, 0.111857004f},
-std::array<float,2>{0.934338808f, 0.969495356f},
-std::array<float,2>{0.108832784f, 0.382349283f},
-std::array<float,2>{0.325125396f, 0.691292584f},
-std::array<float,2>{0.587963402f, 0.217565194f},
-std::array<float,2>{0.653772175f, 0.582408667f},
-std::array<float,2>{0.383282602f, 0.0147746578f},
-std::array<float,2>{0.157915846f, 0.828191757f},
-std::array<float,2>{0.851561666f, 0.281603545f},
-std::array<float,2>{0.926679313f, 0.649490416f},
-std::array<float,2>{0.0945921764f, 0.175529227f},
-std::array<float,2>{0.31251052f, 0.887907922f},
-std::array<float,2>{0.57975018f, 0.473393887f},
-std::array<float,2>{0.647862196f, 0.760492086f},
-std::array<float,2>{0.382536501f, 0.347793162f},
-std::array<float,2>{0.164164349f, 0.551689148f},
-std::array<float,2>{0.85695523f, 0.0945148021f},
-std::array<float,2>{0.785284221f, 0.993871093f},
-std::array<float,2>{0.202631891f, 0.398708791f},
-std::array<float,2>{0.489063799f, 0.706705153f},
-std::array<float,2>{0.700654685f, 0.19058305f},
-std::array<float,2>{0.558465123f, 0.571466863f},
-std::array<float,2>{0.268735439f, 0.0158541743f},
-std::array<float,2>{0.0259508304f, 0.816351831f},
-std::array<float,2>{0.953980207f, 0.300839841f},
-std::array<float,2>{0.82571125f, 0.529984653f},
-std::array<float,2>{0.144723028f, 0.0661224052f},
-std::array<float,2>{0.434378564f, 0.800042689f},
-std::array<float,2>{0.661427915f, 0.332805216f},
-std::array<float,2>{0.621245801f, 0.910695434f},
-std::array<float,2>{0.355095088f, 0.465380073f},
-std::array<float,2>{0.0804248974f, 0.656978846f},
-std::array<float,2>{0.888026416f, 0.141436741f},
-std::array<float,2>{0.984456718f, 0.863504231f},
-std::array<float,2>{0.0441695526f, 0.272371173f},
-std::array<float,2>{0.289451897f, 0.614330649f},
-std::array<float,2>{0.507823586f, 0.0471389703f},
-std::array<float,2>{0.71965456f, 0.732654631f},
-std::array<float,2>{0.449044675f, 0.225420177f},
-std::array<float,2>{0.248755395f, 0.966647744f},
-std::array<float,2>{0.751046538f, 0.407566816f},
-std::array<float,2>{0.945397019f, 0.606773674f},
-std::array<float,2>{0.00281134481f, 0.0415605567f},
-std::array<float,2>{0.257754505f, 0.855100691f},
-std::array<float,2>{0.538378775f, 0.264246553f},
-std::array<float,2>{0.712310553f, 0.951140463f},
-std::array<float,2>{0.483864844f, 0.436033815f},
-std::array<float,2>{0.203869745f, 0.736272633f},
-std::array<float,2>{0.797070622f, 0.236686632f},
-std::array<float,2>{0.872272968f, 0.78365922f},
-std::array<float,2>{0.186856821f, 0.321040839f},
-std::array<float,2>{0.39596352f, 0.515310585f},
-std::array<float,2>{0.635472298f, 0.0923448876f},
-std::array<float,2>{0.568204641f, 0.675664425f},
-std::array<float,2>{0.336469799f, 0.130063057f},
-std::array<float,2>{0.11050076f, 0.935190618f},
-std::array<float,2>{0.918596864f, 0.45143795f},
-std::array<float,2>{0.777653396f, 0.691626251f},
-std::array<float,2>{0.219974294f, 0.212434769f},
-std::array<float,2>{0.463692844f, 0.975903869f},
-std::array<float,2>{0.747897506f, 0.375802994f},
-std::array<float,2>{0.515625477f, 0.835074186f},
-std::array<float,2>{0.310567886f, 0.286904037f},
-std::array<float,2>{0.0517341048f, 0.580070853f},
-std::array<float,2>{0.969686091f, 0.00809720531f},
-std::array<float,2>{0.890791059f, 0.901110828f},
-std::array<float,2>{0.0681949183f, 0.49801439f},
-std::array<float,2>{0.364937812f, 0.633083522f},
-std::array<float,2>{0.605145633f, 0.161627427f},
-std::array<float,2>{0.674767733f, 0.537604272f},
-std::array<float,2>{0.420557737f, 0.114483193f},
-std::array<float,2>{0.136198834f, 0.766822755f},
-std::array<float,2>{0.83230567f, 0.370513946f},
-std::array<float,2>{0.979845524f, 0.743530214f},
-std::array<float,2>{0.0582112037f, 0.24522154f},
-std::array<float,2>{0.300821781f, 0.942403972f},
-std::array<float,2>{0.529590964f, 0.429638863f},
-std::array<float,2>{0.734509706f, 0.845202148f},
-std::array<float,2>{0.459215641f, 0.251605839f},
-std::array<float,2>{0.227121428f, 0.600029945f},
-std::array<float,2>{0.766201854f, 0.0375694521f},
-std::array<float,2>{0.838956416f, 0.929543555f},
-std::array<float,2>{0.126886591f, 0.441821367f},
-std::array<float,2>{0.409539521f, 0.686196864f},
-std::array<float,2>{0.686382115f, 0.134688139f},
-std::array<float,2>{0.599252641f, 0.500032485f},
-std::array<float,2>{0.372424692f, 0.083951205f},
-std::array<float,2>{0.0731289983f, 0.789831698f},
-std::array<float,2>{0.902172863f, 0.317642927f},
-std::array<float,2>{0.805785298f, 0.591236949f},
-std::array<float,2>{0.212430477f, 0.00389346969f},
-std::array<float,2>{0.47348541f, 0.838225245f},
-std::array<float,2>{0.703999698f, 0.295439243f},
-std::array<float,2>{0.540585518f, 0.983056188f},
-std::array<float,2>{0.263047129f, 0.386796683f},
-std::array<float,2>{0.0141560221f, 0.695805192f},
-std::array<float,2>{0.943550587f, 0.207256258f},
-std::array<float,2>{0.912884116f, 0.774459839f},
-std::array<float,2>{0.117424168f, 0.366134375f},
-std::array<float,2>{0.328861326f, 0.54058224f},
-std::array<float,2>{0.571648061f, 0.12212418f},
-std::array<float,2>{0.628867388f, 0.626627564f},
-std::array<float,2>{0.399808288f, 0.166834727f},
-std::array<float,2>{0.172219589f, 0.892740667f},
-std::array<float,2>{0.866005778f, 0.486110508f},
-std::array<float,2>{0.876401007f, 0.559987485f},
-std::array<float,2>{0.0882197469f, 0.107429996f},
-std::array<float,2>{0.345921993f, 0.7552163f},
-std::array<float,2>{0.609486997f, 0.35338971f},
-std::array<float,2>{0.671464205f, 0.882287979f},
-std::array<float,2>{0.426494062f, 0.479700416f},
-std::array<float,2>{0.152612776f, 0.641134918f},
-std::array<float,2>{0.819718778f, 0.181760162f},
-std::array<float,2>{0.764502466f, 0.820839226f},
-std::array<float,2>{0.23990877f, 0.309168577f},
-std::array<float,2>{0.4375799f, 0.56444943f},
-std::array<float,2>{0.729156911f, 0.0293223578f},
-std::array<float,2>{0.500015616f, 0.716653228f},
-std::array<float,2>{0.283380151f, 0.197231263f},
-std::array<float,2>{0.035304144f, 0.98576355f},
-std::array<float,2>{0.999615371f, 0.39423722f},
-std::array<float,2>{0.843784153f, 0.669252813f},
-std::array<float,2>{0.161212206f, 0.15057376f},
-std::array<float,2>{0.386925638f, 0.91843152f},
-std::array<float,2>{0.652293086f, 0.454353482f},
-std::array<float,2>{0.593202055f, 0.812013388f},
-std::array<float,2>{0.323844969f, 0.340658993f},
-std::array<float,2>{0.102490276f, 0.517041385f},
-std::array<float,2>{0.931577981f, 0.076329425f},
-std::array<float,2>{0.96208626f, 0.959784746f},
-std::array<float,2>{0.0198484398f, 0.418279767f},
-std::array<float,2>{0.275078356f, 0.721405506f},
-std::array<float,2>{0.552617371f, 0.228045672f},
-std::array<float,2>{0.69516319f, 0.619789481f},
-std::array<float,2>{0.496795446f, 0.0551785938f},
-std::array<float,2>{0.193125546f, 0.868701935f},
-std::array<float,2>{0.79061389f, 0.275319576f},
-std::array<float,2>{0.975368083f, 0.667658687f},
-std::array<float,2>{0.048197791f, 0.153256744f},
-std::array<float,2>{0.305726558f, 0.914439619f},
-std::array<float,2>{0.52247262f, 0.459880948f},
-std::array<float,2>{0.745656908f, 0.80492574f},
-std::array<float,2>{0.466099381f, 0.336439878f},
-std::array<float,2>{0.225479677f, 0.522546709f},
-std::array<float,2>{0.77361238f, 0.072361432f},
-std::array<float,2>{0.831961095f, 0.953690052f},
-std::array<float,2>{0.140337661f, 0.417105377f},
-std::array<float,2>{0.414954543f, 0.723418176f},
-std::array<float,2>{0.677077174f, 0.233879834f},
-std::array<float,2>{0.60591048f, 0.623954833f},
-std::array<float,2>{0.361213118f, 0.0620616265f},
-std::array<float,2>{0.0647896826f, 0.874092758f},
-std::array<float,2>{0.898419619f, 0.279835761f},
-std::array<float,2>{0.804171801f, 0.556500435f},
-std::array<float,2>{0.209534213f, 0.102155611f},
-std::array<float,2>{0.476867706f, 0.753805935f},
-std::array<float,2>{0.717141032f, 0.359128803f},
-std::array<float,2>{0.534493804f, 0.877501011f},
-std::array<float,2>{0.25323078f, 0.481295019f},
-std::array<float,2>{0.00605309056f, 0.644566596f},
-std::array<float,2>{0.95067364f, 0.187299207f},
-std::array<float,2>{0.914428353f, 0.826149523f},
-std::array<float,2>{0.116817072f, 0.308266699f},
-std::array<float,2>{0.342656285f, 0.57007879f},
-std::array<float,2>{0.564237535f, 0.0272441246f},
-std::array<float,2>{0.637578189f, 0.711424768f},
-std::array<float,2>{0.39158529f, 0.200578555f},
-std::array<float,2>{0.180030391f, 0.989821255f},
-std::array<float,2>{0.870257497f, 0.39573428f},
-std::array<float,2>{0.883551478f, 0.587408125f},
-std::array<float,2>{0.0833976492f, 0.00504195597f},
-std::array<float,2>{0.357445121f, 0.840103209f},
-std::array<float,2>{0.619899988f, 0.291982263f},
-std::array<float,2>{0.659009933f, 0.979544163f},
-std::array<float,2>{0.431149751f, 0.38465482f},
-std::array<float,2>{0.142381698f, 0.700155199f},
-std::array<float,2>{0.822289288f, 0.204584211f},
-std::array<float,2>{0.757298231f, 0.781202555f},
-std::array<float,2>{0.242612436f, 0.360737592f},
-std::array<float,2>{0.450025409f, 0.544675767f},
-std::array<float,2>{0.725995481f, 0.119970068f},
-std::array<float,2>{0.512690365f, 0.631376147f},
-std::array<float,2>{0.293828368f, 0.171464637f},
-std::array<float,2>{0.0395406038f, 0.896915913f},
-std::array<float,2>{0.98986876f, 0.489082426f},
-std::array<float,2>{0.854360163f, 0.749243557f},
-std::array<float,2>{0.170375824f, 0.246222168f},
-std::array<float,2>{0.378593743f, 0.940145552f},
-std::array<float,2>{0.641737044f, 0.422112525f},
-std::array<float,2>{0.58436054f, 0.849541962f},
-std::array<float,2>{0.319823295f, 0.256548703f},
-std::array<float,2>{0.100098543f, 0.593956292f},
-std::array<float,2>{0.924912691f, 0.0345978774f},
-std::array<float,2>{0.958541095f, 0.923224568f},
-std::array<float,2>{0.0306005403f, 0.439052373f},
-std::array<float,2>{0.272887558f, 0.683454692f},
-std::array<float,2>{0.559226036f, 0.138479993f},
-std::array<float,2>{0.696005762f, 0.507740319f},
-std::array<float,2>{0.484632105f, 0.0808178931f},
-std::array<float,2>{0.1960942f, 0.794475794f},
-std::array<float,2>{0.784392774f, 0.314636528f},
-std::array<float,2>{0.93680191f, 0.689506531f},
-std::array<float,2>{0.105771445f, 0.218462333f},
-std::array<float,2>{0.327567697f, 0.969821632f},
-std::array<float,2>{0.586176991f, 0.3816998f},
-std::array<float,2>{0.655849576f, 0.829347193f},
-std::array<float,2>{0.385831982f, 0.282913297f},
-std::array<float,2>{0.159310713f, 0.583754003f},
-std::array<float,2>{0.848185062f, 0.0146064367f},
-std::array<float,2>{0.795360446f, 0.902795553f},
-std::array<float,2>{0.189812124f, 0.495752007f},
-std::array<float,2>{0.493354946f, 0.637186885f},
-std::array<float,2>{0.688553929f, 0.158660859f},
-std::array<float,2>{0.549119055f, 0.535038352f},
-std::array<float,2>{0.277388185f, 0.11326851f},
-std::array<float,2>{0.0187850837f, 0.771820426f},
-std::array<float,2>{0.968567729f, 0.373527229f},
-std::array<float,2>{0.813069284f, 0.605128944f},
-std::array<float,2>{0.149522126f, 0.0457450598f},
-std::array<float,2>{0.42570132f, 0.856164396f},
-std::array<float,2>{0.667143166f, 0.258135319f},
-std::array<float,2>{0.616355002f, 0.945670485f},
-std::array<float,2>{0.351117671f, 0.429902554f},
-std::array<float,2>{0.0914645195f, 0.73934412f},
-std::array<float,2>{0.880341113f, 0.240429431f},
-std::array<float,2>{0.995381951f, 0.785624146f},
-std::array<float,2>{0.0350154601f, 0.327771515f},
-std::array<float,2>{0.286099434f, 0.511251092f},
-std::array<float,2>{0.505452514f, 0.0887350962f},
-std::array<float,2>{0.732067883f, 0.677312493f},
-std::array<float,2>{0.442606002f, 0.126337498f},
-std::array<float,2>{0.238117054f, 0.929978251f},
-std::array<float,2>{0.760337055f, 0.448945016f},
-std::array<float,2>{0.941263139f, 0.523597777f},
-std::array<float,2>{0.00826209784f, 0.0673361048f},
-std::array<float,2>{0.257845193f, 0.801056921f},
-std::array<float,2>{0.543924868f, 0.328181922f},
-std::array<float,2>{0.707377613f, 0.910025477f},
-std::array<float,2>{0.470596611f, 0.462678045f},
-std::array<float,2>{0.217082351f, 0.663136542f},
-std::array<float,2>{0.811081588f, 0.147735789f},
-std::array<float,2>{0.859561026f, 0.859624147f},
-std::array<float,2>{0.177618414f, 0.265728414f},
-std::array<float,2>{0.404174238f, 0.61203438f},
-std::array<float,2>{0.629829645f, 0.051546704f},
-std::array<float,2>{0.575046897f, 0.726719677f},
-std::array<float,2>{0.334233016f, 0.222627059f},
-std::array<float,2>{0.123077311f, 0.962553501f},
-std::array<float,2>{0.907815754f, 0.413467348f},
-std::array<float,2>{0.770438194f, 0.65337652f},
-std::array<float,2>{0.232297286f, 0.178065568f},
-std::array<float,2>{0.455197245f, 0.884082556f},
-std::array<float,2>{0.740166903f, 0.468830645f},
-std::array<float,2>{0.526714027f, 0.763666213f},
-std::array<float,2>{0.297311187f, 0.344147772f},
-std::array<float,2>{0.0591153502f, 0.549900591f},
-std::array<float,2>{0.980594516f, 0.101292975f},
-std::array<float,2>{0.902346551f, 0.997204542f},
-std::array<float,2>{0.0760900453f, 0.404837519f},
-std::array<float,2>{0.369313121f, 0.710806012f},
-std::array<float,2>{0.597247303f, 0.193232566f},
-std::array<float,2>{0.68203187f, 0.57574439f},
-std::array<float,2>{0.410802871f, 0.0198057201f},
-std::array<float,2>{0.131123602f, 0.818407655f},
-std::array<float,2>{0.841174424f, 0.29893589f},
-std::array<float,2>{0.893986464f, 0.634479165f},
-std::array<float,2>{0.0698433369f, 0.160506681f},
-std::array<float,2>{0.366388768f, 0.902152658f},
-std::array<float,2>{0.602837384f, 0.496541411f},
-std::array<float,2>{0.673780918f, 0.766557217f},
-std::array<float,2>{0.418187141f, 0.369871467f},
-std::array<float,2>{0.13463296f, 0.538907588f},
-std::array<float,2>{0.834992409f, 0.114107206f},
-std::array<float,2>{0.780456424f, 0.974927723f},
-std::array<float,2>{0.222572565f, 0.376593143f},
-std::array<float,2>{0.46233198f, 0.693358898f},
-std::array<float,2>{0.74840951f, 0.211077109f},
-std::array<float,2>{0.518416941f, 0.578404546f},
-std::array<float,2>{0.309452683f, 0.00921968929f},
-std::array<float,2>{0.0529230423f, 0.834551454f},
-std::array<float,2>{0.971788168f, 0.285948962f},
-std::array<float,2>{0.87484622f, 0.514570832f},
-std::array<float,2>{0.185434476f, 0.0929572433f},
-std::array<float,2>{0.398174226f, 0.784737885f},
-std::array<float,2>{0.634676039f, 0.322235912f},
-std::array<float,2>{0.569149613f, 0.93387413f},
-std::array<float,2>{0.338730633f, 0.452245176f},
-std::array<float,2>{0.111920372f, 0.674320698f},
-std::array<float,2>{0.921769738f, 0.129186422f},
-std::array<float,2>{0.948038101f, 0.853702605f},
-std::array<float,2>{0.000210184837f, 0.264660656f},
-std::array<float,2>{0.25458461f, 0.605769694f},
-std::array<float,2>{0.536556721f, 0.0420200154f},
-std::array<float,2>{0.71389693f, 0.734538496f},
-std::array<float,2>{0.481897771f, 0.237674013f},
-std::array<float,2>{0.206279427f, 0.949513435f},
-std::array<float,2>{0.799514294f, 0.437182009f},
-std::array<float,2>{0.987838387f, 0.613412976f},
-std::array<float,2>{0.0460102744f, 0.0483015515f},
-std::array<float,2>{0.292169511f, 0.864933968f},
-std::array<float,2>{0.509987533f, 0.272865891f},
-std::array<float,2>{0.721743345f, 0.965246797f},
-std::array<float,2>{0.446256816f, 0.40713951f},
-std::array<float,2>{0.246530905f, 0.733542681f},
-std::array<float,2>{0.752484202f, 0.226096287f},
-std::array<float,2>{0.826309681f, 0.799041808f},
-std::array<float,2>{0.14695856f, 0.333436012f},
-std::array<float,2>{0.435697496f, 0.530596495f},
-std::array<float,2>{0.662619531f, 0.0650397018f},
-std::array<float,2>{0.623576105f, 0.658202946f},
-std::array<float,2>{0.351832449f, 0.142396897f},
-std::array<float,2>{0.0785325244f, 0.911814868f},
-std::array<float,2>{0.889636993f, 0.466321588f},
-std::array<float,2>{0.789058566f, 0.705723107f},
-std::array<float,2>{0.200171798f, 0.190035239f},
-std::array<float,2>{0.491319686f, 0.993100643f},
-std::array<float,2>{0.702887356f, 0.399501085f},
-std::array<float,2>{0.555443823f, 0.815254629f},
-std::array<float,2>{0.266835958f, 0.302408516f},
-std::array<float,2>{0.0240204893f, 0.571247935f},
-std::array<float,2>{0.955738306f, 0.0174673013f},
-std::array<float,2>{0.928643703f, 0.887455165f},
-std::array<float,2>{0.0958398134f, 0.474414468f},
-std::array<float,2>{0.315379441f, 0.649369478f},
-std::array<float,2>{0.58120966f, 0.174630225f},
-std::array<float,2>{0.645319402f, 0.552375615f},
-std::array<float,2>{0.379208982f, 0.0950943604f},
-std::array<float,2>{0.167524442f, 0.761069477f},
-std::array<float,2>{0.859211504f, 0.349410146f},
-std::array<float,2>{0.963777602f, 0.72195071f},
-std::array<float,2>{0.022382319f, 0.226607665f},
-std::array<float,2>{0.2762281f, 0.960694373f},
-std::array<float,2>{0.553179979f, 0.419014484f},
-std::array<float,2>{0.692991376f, 0.867427886f},
-std::array<float,2>{0.498246878f, 0.273959696f},
-std::array<float,2>{0.194109812f, 0.620795012f},
-std::array<float,2>{0.791215837f, 0.0560669303f},
-std::array<float,2>{0.846691132f, 0.919864714f},
-std::array<float,2>{0.163190022f, 0.453596383f},
-std::array<float,2>{0.389605492f, 0.668361723f},
-std::array<float,2>{0.648837686f, 0.151627719f},
-std::array<float,2>{0.591246367f, 0.516294837f},
-std::array<float,2>{0.321318418f, 0.0779517591f},
-std::array<float,2>{0.105002172f, 0.810867846f},
-std::array<float,2>{0.932242036f, 0.341297776f},
-std::array<float,2>{0.762756944f, 0.562840104f},
-std::array<float,2>{0.24087964f, 0.0312413238f},
-std::array<float,2>{0.440098733f, 0.821842551f},
-std::array<float,2>{0.727363765f, 0.310412139f},
-std::array<float,2>{0.502161801f, 0.984988213f},
-std::array<float,2>{0.281691581f, 0.392601669f},
-std::array<float,2>{0.0384538211f, 0.715371847f},
-std::array<float,2>{0.99802655f, 0.195754871f},
-std::array<float,2>{0.878118753f, 0.754613101f},
-std::array<float,2>{0.0864539668f, 0.352183461f},
-std::array<float,2>{0.345076472f, 0.559098125f},
-std::array<float,2>{0.61324054f, 0.108569071f},
-std::array<float,2>{0.668299794f, 0.642340004f},
-std::array<float,2>{0.429493159f, 0.182996899f},
-std::array<float,2>{0.15622355f, 0.881317317f},
-std::array<float,2>{0.817727745f, 0.478738844f},
-std::array<float,2>{0.911971688f, 0.540028393f},
-std::array<float,2>{0.119605869f, 0.121362537f},
-std::array<float,2>{0.331369191f, 0.773767412f},
-std::array<float,2>{0.572862983f, 0.366949975f},
-std::array<float,2>{0.625755131f, 0.89427942f},
-std::array<float,2>{0.401363164f, 0.484680891f},
-std::array<float,2>{0.17436026f, 0.62564677f},
-std::array<float,2>{0.864905953f, 0.167647913f},
-std::array<float,2>{0.806731701f, 0.839061022f},
-std::array<float,2>{0.21442388f, 0.296566784f},
-std::array<float,2>{0.47580412f, 0.589869499f},
-std::array<float,2>{0.706457615f, 0.00231033331f},
-std::array<float,2>{0.54124105f, 0.697063923f},
-std::array<float,2>{0.264025748f, 0.208694071f},
-std::array<float,2>{0.0128371231f, 0.984320462f},
-std::array<float,2>{0.942136049f, 0.388292968f},
-std::array<float,2>{0.837612092f, 0.686906397f},
-std::array<float,2>{0.128402248f, 0.133128136f},
-std::array<float,2>{0.406694561f, 0.928111136f},
-std::array<float,2>{0.683920026f, 0.442463458f},
-std::array<float,2>{0.600602269f, 0.790156007f},
-std::array<float,2>{0.374446571f, 0.316602737f},
-std::array<float,2>{0.0715029761f, 0.501077831f},
-std::array<float,2>{0.899656296f, 0.0829773769f},
-std::array<float,2>{0.977181077f, 0.94156003f},
-std::array<float,2>{0.0564144365f, 0.427805543f},
-std::array<float,2>{0.303231299f, 0.742946088f},
-std::array<float,2>{0.528530955f, 0.244568959f},
-std::array<float,2>{0.736394823f, 0.600783408f},
-std::array<float,2>{0.458110899f, 0.038897559f},
-std::array<float,2>{0.229741499f, 0.844449043f},
-std::array<float,2>{0.768196464f, 0.250945508f},
-std::array<float,2>{0.952003598f, 0.648394108f},
-std::array<float,2>{0.00526940962f, 0.184485734f},
-std::array<float,2>{0.250912756f, 0.875995517f},
-std::array<float,2>{0.531362832f, 0.482803106f},
-std::array<float,2>{0.715759695f, 0.75043714f},
-std::array<float,2>{0.479621947f, 0.355563313f},
-std::array<float,2>{0.208470821f, 0.5581218f},
-std::array<float,2>{0.802600801f, 0.103587918f},
-std::array<float,2>{0.868251026f, 0.990869641f},
-std::array<float,2>{0.183329925f, 0.397846013f},
-std::array<float,2>{0.393560588f, 0.713659167f},
-std::array<float,2>{0.640134037f, 0.201652125f},
-std::array<float,2>{0.564843118f, 0.568002582f},
-std::array<float,2>{0.340320498f, 0.0237106439f},
-std::array<float,2>{0.114439547f, 0.82791388f},
-std::array<float,2>{0.916750729f, 0.305177063f},
-std::array<float,2>{0.776425123f, 0.520292819f},
-std::array<float,2>{0.223342955f, 0.070709452f},
-std::array<float,2>{0.468590409f, 0.807686567f},
-std::array<float,2>{0.74227345f, 0.338405967f},
-std::array<float,2>{0.520529807f, 0.917713225f},
-std::array<float,2>{0.307077587f, 0.457849532f},
-std::array<float,2>{0.0494528413f, 0.665021777f},
-std::array<float,2>{0.974112213f, 0.154998466f},
-std::array<float,2>{0.894913495f, 0.872782946f},
-std::array<float,2>{0.0626170635f, 0.277969927f},
-std::array<float,2>{0.361335158f, 0.622154355f},
-std::array<float,2>{0.60796982f, 0.0603645891f},
-std::array<float,2>{0.678793132f, 0.72564441f},
-std::array<float,2>{0.417469025f, 0.232349589f},
-std::array<float,2>{0.137508929f, 0.95548892f},
-std::array<float,2>{0.828614473f, 0.415531844f},
-std::array<float,2>{0.922495186f, 0.595798314f},
-std::array<float,2>{0.0988863185f, 0.0321694128f},
-std::array<float,2>{0.317692786f, 0.84976989f},
-std::array<float,2>{0.582099974f, 0.254579812f},
-std::array<float,2>{0.643048167f, 0.938117981f},
-std::array<float,2>{0.376292914f, 0.424942374f},
-std::array<float,2>{0.168369561f, 0.747528017f},
-std::array<float,2>{0.853019595f, 0.248922527f},
-std::array<float,2>{0.782877803f, 0.795859516f},
-std::array<float,2>{0.197305545f, 0.314351022f},
-std::array<float,2>{0.487687349f, 0.504645586f},
-std::array<float,2>{0.697728872f, 0.0787584633f},
-std::array<float,2>{0.560717344f, 0.680536211f},
-std::array<float,2>{0.270644099f, 0.139894754f},
-std::array<float,2>{0.0281585567f, 0.924072742f},
-std::array<float,2>{0.959781945f, 0.440478265f},
-std::array<float,2>{0.820770323f, 0.701486826f},
-std::array<float,2>{0.142967641f, 0.205706716f},
-std::array<float,2>{0.432523787f, 0.978449225f},
-std::array<float,2>{0.656417131f, 0.386676788f},
-std::array<float,2>{0.617349207f, 0.842715979f},
-std::array<float,2>{0.355808437f, 0.290785402f},
-std::array<float,2>{0.0842294618f, 0.589200139f},
-std::array<float,2>{0.886026263f, 0.00587169267f},
-std::array<float,2>{0.991438031f, 0.895704508f},
-std::array<float,2>{0.0410758071f, 0.491316557f},
-std::array<float,2>{0.296362221f, 0.630703092f},
-std::array<float,2>{0.51475805f, 0.169282094f},
-std::array<float,2>{0.724468887f, 0.545580029f},
-std::array<float,2>{0.451711088f, 0.118085556f},
-std::array<float,2>{0.24567242f, 0.77735424f},
-std::array<float,2>{0.754057884f, 0.361912817f},
-std::array<float,2>{0.88250649f, 0.742181003f},
-std::array<float,2>{0.0923636109f, 0.239035338f},
-std::array<float,2>{0.347813427f, 0.947793961f},
-std::array<float,2>{0.613331437f, 0.433114171f},
-std::array<float,2>{0.664512575f, 0.857957959f},
-std::array<float,2>{0.423759609f, 0.261022419f},
-std::array<float,2>{0.152323321f, 0.602963984f},
-std::array<float,2>{0.815426171f, 0.0433546044f},
-std::array<float,2>{0.759661257f, 0.932264388f},
-std::array<float,2>{0.234649748f, 0.446211815f},
-std::array<float,2>{0.444855273f, 0.67840451f},
-std::array<float,2>{0.733323157f, 0.127352834f},
-std::array<float,2>{0.5072034f, 0.508251011f},
-std::array<float,2>{0.287180066f, 0.0864266083f},
-std::array<float,2>{0.0322489031f, 0.788471699f},
-std::array<float,2>{0.993794739f, 0.324934244f},
-std::array<float,2>{0.849788249f, 0.584190369f},
-std::array<float,2>{0.156770572f, 0.0118636517f},
-std::array<float,2>{0.383809209f, 0.831573486f},
-std::array<float,2>{0.65308851f, 0.283637881f},
-std::array<float,2>{0.588921249f, 0.972046733f},
-std::array<float,2>{0.325669974f, 0.379853994f},
-std::array<float,2>{0.108263172f, 0.687594831f},
-std::array<float,2>{0.934723318f, 0.215087757f},
-std::array<float,2>{0.965360165f, 0.7696805f},
-std::array<float,2>{0.0163751263f, 0.373037696f},
-std::array<float,2>{0.27971974f, 0.533117294f},
-std::array<float,2>{0.548468351f, 0.111168221f},
-std::array<float,2>{0.689644337f, 0.638763964f},
-std::array<float,2>{0.495362908f, 0.157294095f},
-std::array<float,2>{0.188593969f, 0.905398071f},
-std::array<float,2>{0.793568194f, 0.492670655f},
-std::array<float,2>{0.98341006f, 0.547136784f},
-std::array<float,2>{0.0614812449f, 0.0988991037f},
-std::array<float,2>{0.299849987f, 0.763943911f},
-std::array<float,2>{0.523671567f, 0.345854193f},
-std::array<float,2>{0.740864277f, 0.885303915f},
-std::array<float,2>{0.45388937f, 0.471235991f},
-std::array<float,2>{0.233818129f, 0.654646873f},
-std::array<float,2>{0.772438347f, 0.177635223f},
-std::array<float,2>{0.842961371f, 0.816500902f},
-std::array<float,2>{0.129407331f, 0.298767418f},
-std::array<float,2>{0.413588673f, 0.576308727f},
-std::array<float,2>{0.680970252f, 0.0218357388f},
-std::array<float,2>{0.59553045f, 0.708185673f},
-std::array<float,2>{0.368970811f, 0.193795517f},
-std::array<float,2>{0.077805683f, 0.999705374f},
-std::array<float,2>{0.905918419f, 0.402816087f},
-std::array<float,2>{0.810019553f, 0.660174251f},
-std::array<float,2>{0.215011895f, 0.144757614f},
-std::array<float,2>{0.471403241f, 0.906718016f},
-std::array<float,2>{0.709907651f, 0.464491099f},
-std::array<float,2>{0.545989931f, 0.803567827f},
-std::array<float,2>{0.261441082f, 0.331409931f},
-std::array<float,2>{0.00993607007f, 0.525418222f},
-std::array<float,2>{0.93779552f, 0.0689600632f},
-std::array<float,2>{0.909773588f, 0.963157892f},
-std::array<float,2>{0.122436553f, 0.411720276f},
-std::array<float,2>{0.332286775f, 0.73015523f},
-std::array<float,2>{0.5778566f, 0.219550148f},
-std::array<float,2>{0.631158113f, 0.610720396f},
-std::array<float,2>{0.405601144f, 0.0527475588f},
-std::array<float,2>{0.178149238f, 0.861349642f},
-std::array<float,2>{0.862742662f, 0.268263549f},
-std::array<float,2>{0.919271648f, 0.672751606f},
-std::array<float,2>{0.10992375f, 0.132040545f},
-std::array<float,2>{0.337789297f, 0.936712921f},
-std::array<float,2>{0.567214668f, 0.450687349f},
-std::array<float,2>{0.636443019f, 0.781309009f},
-std::array<float,2>{0.395354629f, 0.323340505f},
-std::array<float,2>{0.185956404f, 0.513085783f},
-std::array<float,2>{0.871902227f, 0.0905084014f},
-std::array<float,2>{0.798002481f, 0.952382624f},
-std::array<float,2>{0.204177886f, 0.43483296f},
-std::array<float,2>{0.482792139f, 0.73775667f},
-std::array<float,2>{0.71146661f, 0.23541446f},
-std::array<float,2>{0.537571132f, 0.608441114f},
-std::array<float,2>{0.256232381f, 0.0405755565f},
-std::array<float,2>{0.00347946608f, 0.852549136f},
-std::array<float,2>{0.9464553f, 0.262148142f},
-std::array<float,2>{0.833610058f, 0.535416126f},
-std::array<float,2>{0.134771109f, 0.116105713f},
-std::array<float,2>{0.421182454f, 0.768584371f},
-std::array<float,2>{0.675530434f, 0.36875087f},
-std::array<float,2>{0.603601336f, 0.900212288f},
-std::array<float,2>{0.363468558f, 0.498338491f},
-std::array<float,2>{0.0673136041f, 0.635607362f},
-std::array<float,2>{0.89221561f, 0.162772015f},
-std::array<float,2>{0.969812155f, 0.832817674f},
-std::array<float,2>{0.0525449514f, 0.288740426f},
-std::array<float,2>{0.312180609f, 0.580311477f},
-std::array<float,2>{0.516984761f, 0.0115029113f},
-std::array<float,2>{0.746351302f, 0.695170939f},
-std::array<float,2>{0.464685827f, 0.213016033f},
-std::array<float,2>{0.219703466f, 0.973708749f},
-std::array<float,2>{0.778920412f, 0.378518105f},
-std::array<float,2>{0.954189062f, 0.572868943f},
-std::array<float,2>{0.0272150598f, 0.0189468041f},
-std::array<float,2>{0.268062949f, 0.813822985f},
-std::array<float,2>{0.557456315f, 0.304536194f},
-std::array<float,2>{0.69987154f, 0.994497657f},
-std::array<float,2>{0.489348382f, 0.400841326f},
-std::array<float,2>{0.201853782f, 0.704099f},
-std::array<float,2>{0.786443532f, 0.187854007f},
-std::array<float,2>{0.856363952f, 0.758953989f},
-std::array<float,2>{0.165814042f, 0.349742234f},
-std::array<float,2>{0.381008267f, 0.553758681f},
-std::array<float,2>{0.64695698f, 0.0970350727f},
-std::array<float,2>{0.578969657f, 0.651940465f},
-std::array<float,2>{0.313754171f, 0.172766328f},
-std::array<float,2>{0.095254451f, 0.889386177f},
-std::array<float,2>{0.926965177f, 0.475711852f},
-std::array<float,2>{0.750657499f, 0.731456578f},
-std::array<float,2>{0.249419227f, 0.223494649f},
-std::array<float,2>{0.448242098f, 0.967060566f},
-std::array<float,2>{0.719980419f, 0.409591109f},
-std::array<float,2>{0.50957489f, 0.866360426f},
-std::array<float,2>{0.290775508f, 0.270433694f},
-std::array<float,2>{0.0438677594f, 0.617078066f},
-std::array<float,2>{0.986301839f, 0.0493838713f},
-std::array<float,2>{0.887024343f, 0.912853599f},
-std::array<float,2>{0.0812156498f, 0.468467206f},
-std::array<float,2>{0.353946775f, 0.659406364f},
-std::array<float,2>{0.622871697f, 0.144295275f},
-std::array<float,2>{0.660621822f, 0.528437316f},
-std::array<float,2>{0.434699923f, 0.063311331f},
-std::array<float,2>{0.146206468f, 0.797210097f},
-std::array<float,2>{0.824285865f, 0.335791677f},
-std::array<float,2>{0.998283148f, 0.717940629f},
-std::array<float,2>{0.0363657251f, 0.198590338f},
-std::array<float,2>{0.284451067f, 0.987967908f},
-std::array<float,2>{0.501423776f, 0.390651673f},
-std::array<float,2>{0.729706883f, 0.822728097f},
-std::array<float,2>{0.439339161f, 0.312435329f},
-std::array<float,2>{0.239235029f, 0.564657867f},
-std::array<float,2>{0.764871776f, 0.0285661947f},
-std::array<float,2>{0.819313288f, 0.879523695f},
-std::array<float,2>{0.154172033f, 0.476837426f},
-std::array<float,2>{0.427561373f, 0.642589688f},
-std::array<float,2>{0.67035538f, 0.180142894f},
-std::array<float,2>{0.610449374f, 0.56100297f},
-std::array<float,2>{0.347053736f, 0.106193937f},
-std::array<float,2>{0.0897383988f, 0.756126761f},
-std::array<float,2>{0.87517035f, 0.354215711f},
-std::array<float,2>{0.789883077f, 0.618656993f},
-std::array<float,2>{0.191849634f, 0.0570898876f},
-std::array<float,2>{0.497147501f, 0.869464934f},
-std::array<float,2>{0.694078743f, 0.276842386f},
-std::array<float,2>{0.551623464f, 0.957238019f},
-std::array<float,2>{0.274141878f, 0.420007437f},
-std::array<float,2>{0.0212729927f, 0.720291793f},
-std::array<float,2>{0.961788118f, 0.228529572f},
-std::array<float,2>{0.930417001f, 0.808993876f},
-std::array<float,2>{0.103120811f, 0.342169821f},
-std::array<float,2>{0.322561294f, 0.518878341f},
-std::array<float,2>{0.592372656f, 0.0758936033f},
-std::array<float,2>{0.650952697f, 0.67009443f},
-std::array<float,2>{0.388471484f, 0.14952758f},
-std::array<float,2>{0.160653174f, 0.921064436f},
-std::array<float,2>{0.845193744f, 0.45512104f},
-std::array<float,2>{0.90095973f, 0.503262043f},
-std::array<float,2>{0.0739265978f, 0.0851989836f},
-std::array<float,2>{0.371791869f, 0.79294008f},
-std::array<float,2>{0.598183572f, 0.320180655f},
-std::array<float,2>{0.686622083f, 0.926731884f},
-std::array<float,2>{0.408775121f, 0.443786383f},
-std::array<float,2>{0.125225618f, 0.685056269f},
-std::array<float,2>{0.837958634f, 0.134961173f},
-std::array<float,2>{0.767223656f, 0.846321583f},
-std::array<float,2>{0.227826864f, 0.25306204f},
-std::array<float,2>{0.46072945f, 0.5976758f},
-std::array<float,2>{0.735833883f, 0.0357701071f},
-std::array<float,2>{0.530862451f, 0.745583117f},
-std::array<float,2>{0.301930845f, 0.242654637f},
-std::array<float,2>{0.0567789041f, 0.944956362f},
-std::array<float,2>{0.979116678f, 0.427716374f},
-std::array<float,2>{0.866443932f, 0.627248168f},
-std::array<float,2>{0.17287913f, 0.164615199f},
-std::array<float,2>{0.398722321f, 0.891549051f},
-std::array<float,2>{0.627511322f, 0.487744629f},
-std::array<float,2>{0.57043165f, 0.777309656f},
-std::array<float,2>{0.329608083f, 0.363352984f},
-std::array<float,2>{0.118720129f, 0.542700708f},
-std::array<float,2>{0.913878143f, 0.123931058f},
-std::array<float,2>{0.944618344f, 0.980972052f},
-std::array<float,2>{0.0155725973f, 0.38940984f},
-std::array<float,2>{0.261880308f, 0.698783159f},
-std::array<float,2>{0.539159179f, 0.209538028f},
-std::array<float,2>{0.704476118f, 0.592312634f},
-std::array<float,2>{0.474258333f, 0.00168429501f},
-std::array<float,2>{0.211040288f, 0.836441159f},
-std::array<float,2>{0.804920912f, 0.294350058f}}
\ No newline at end of file
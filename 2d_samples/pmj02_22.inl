@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.241480455f, 0.446896851f},
-std::array<float,2>{0.949034929f, 0.553916574f},
-std::array<float,2>{0.311320394f, 0.933285892f},
-std::array<float,2>{0.660965383f, 0.0982098654f},
-std::array<float,2>{0.490878522f, 0.184284687f},
-std::array<float,2>{0.571383297f, 0.792140961f},
-std::array<float,2>{0.00590040023f, 0.714322209f},
-std::array<float,2>{0.805912256f, 0.36711216f},
-std::array<float,2>{0.33960849f, 0.275351226f},
-std::array<float,2>{0.696983933f, 0.654875755f},
-std::array<float,2>{0.139666423f, 0.874597371f},
-std::array<float,2>{0.887764037f, 0.246980324f},
-std::array<float,2>{0.114516005f, 0.051918231f},
-std::array<float,2>{0.852692544f, 0.964550912f},
-std::array<float,2>{0.406279474f, 0.571876585f},
-std::array<float,2>{0.55465591f, 0.400138497f},
-std::array<float,2>{0.0400903076f, 0.332352519f},
-std::array<float,2>{0.777729988f, 0.725657225f},
-std::array<float,2>{0.442222774f, 0.766993642f},
-std::array<float,2>{0.614921391f, 0.154163554f},
-std::array<float,2>{0.255487084f, 0.087592259f},
-std::array<float,2>{0.639293849f, 0.877576053f},
-std::array<float,2>{0.199472949f, 0.507945776f},
-std::array<float,2>{0.998485088f, 0.48761192f},
-std::array<float,2>{0.391969681f, 0.414158583f},
-std::array<float,2>{0.511924863f, 0.610430539f},
-std::array<float,2>{0.063089177f, 0.9768098f},
-std::array<float,2>{0.824035406f, 0.00107699807f},
-std::array<float,2>{0.174439132f, 0.213995576f},
-std::array<float,2>{0.930334687f, 0.815740526f},
-std::array<float,2>{0.354571223f, 0.671048164f},
-std::array<float,2>{0.719598532f, 0.292458922f},
-std::array<float,2>{0.143410414f, 0.30418855f},
-std::array<float,2>{0.900401294f, 0.676903844f},
-std::array<float,2>{0.323984683f, 0.833393574f},
-std::array<float,2>{0.703727424f, 0.202335939f},
-std::array<float,2>{0.425495774f, 0.0226733219f},
-std::array<float,2>{0.54407078f, 0.996812463f},
-std::array<float,2>{0.109160669f, 0.60740447f},
-std::array<float,2>{0.865758717f, 0.436463118f},
-std::array<float,2>{0.293701649f, 0.484329104f},
-std::array<float,2>{0.682422578f, 0.523115933f},
-std::array<float,2>{0.232079625f, 0.890785813f},
-std::array<float,2>{0.968469799f, 0.0754179358f},
-std::array<float,2>{0.0255833939f, 0.135736376f},
-std::array<float,2>{0.795116365f, 0.757541239f},
-std::array<float,2>{0.483171731f, 0.742430508f},
-std::array<float,2>{0.584818959f, 0.321265578f},
-std::array<float,2>{0.0899086371f, 0.385554045f},
-std::array<float,2>{0.830875278f, 0.5912413f},
-std::array<float,2>{0.375694156f, 0.952719748f},
-std::array<float,2>{0.516302586f, 0.0359397456f},
-std::array<float,2>{0.363647521f, 0.226569906f},
-std::array<float,2>{0.737269878f, 0.853773296f},
-std::array<float,2>{0.160273224f, 0.626286864f},
-std::array<float,2>{0.921352208f, 0.253336191f},
-std::array<float,2>{0.456020176f, 0.353194773f},
-std::array<float,2>{0.608366609f, 0.689576983f},
-std::array<float,2>{0.05664156f, 0.799191594f},
-std::array<float,2>{0.761554956f, 0.171592981f},
-std::array<float,2>{0.213696301f, 0.117605947f},
-std::array<float,2>{0.970697463f, 0.91976732f},
-std::array<float,2>{0.26950866f, 0.535506666f},
-std::array<float,2>{0.643785477f, 0.46405232f},
-std::array<float,2>{0.16730535f, 0.428979248f},
-std::array<float,2>{0.909603298f, 0.599630535f},
-std::array<float,2>{0.36840114f, 0.989903748f},
-std::array<float,2>{0.744807303f, 0.0247618407f},
-std::array<float,2>{0.390489221f, 0.19146955f},
-std::array<float,2>{0.526858509f, 0.838245034f},
-std::array<float,2>{0.081239894f, 0.686961949f},
-std::array<float,2>{0.837009013f, 0.310504615f},
-std::array<float,2>{0.276133329f, 0.313295871f},
-std::array<float,2>{0.654982805f, 0.736493528f},
-std::array<float,2>{0.20579806f, 0.765303731f},
-std::array<float,2>{0.984168649f, 0.127529755f},
-std::array<float,2>{0.0471876524f, 0.0683948994f},
-std::array<float,2>{0.754378796f, 0.903477013f},
-std::array<float,2>{0.461996824f, 0.52699405f},
-std::array<float,2>{0.594463825f, 0.474715263f},
-std::array<float,2>{0.0962142646f, 0.257951409f},
-std::array<float,2>{0.871668816f, 0.636650681f},
-std::array<float,2>{0.435831964f, 0.846725643f},
-std::array<float,2>{0.533346295f, 0.219672397f},
-std::array<float,2>{0.314949811f, 0.0439136103f},
-std::array<float,2>{0.71189177f, 0.943629622f},
-std::array<float,2>{0.155210018f, 0.580808401f},
-std::array<float,2>{0.896798968f, 0.380389214f},
-std::array<float,2>{0.474426448f, 0.457509875f},
-std::array<float,2>{0.593032241f, 0.539346576f},
-std::array<float,2>{0.0205848068f, 0.912122965f},
-std::array<float,2>{0.783031523f, 0.109604791f},
-std::array<float,2>{0.225346714f, 0.161831349f},
-std::array<float,2>{0.959160805f, 0.809590995f},
-std::array<float,2>{0.282491565f, 0.696561813f},
-std::array<float,2>{0.678575158f, 0.345903128f},
-std::array<float,2>{0.194010273f, 0.369646102f},
-std::array<float,2>{0.990240097f, 0.703583837f},
-std::array<float,2>{0.258753389f, 0.784211516f},
-std::array<float,2>{0.626409113f, 0.173984155f},
-std::array<float,2>{0.451937169f, 0.108307913f},
-std::array<float,2>{0.621004403f, 0.922445476f},
-std::array<float,2>{0.0343934782f, 0.556706011f},
-std::array<float,2>{0.767177701f, 0.441797942f},
-std::array<float,2>{0.351207703f, 0.392891169f},
-std::array<float,2>{0.730630577f, 0.568411589f},
-std::array<float,2>{0.18304649f, 0.956836343f},
-std::array<float,2>{0.928890705f, 0.0602608621f},
-std::array<float,2>{0.0730426386f, 0.236732513f},
-std::array<float,2>{0.81262207f, 0.860929549f},
-std::array<float,2>{0.403369904f, 0.64491421f},
-std::array<float,2>{0.501459539f, 0.266304612f},
-std::array<float,2>{0.0154115194f, 0.498217046f},
-std::array<float,2>{0.798682094f, 0.50304997f},
-std::array<float,2>{0.499484241f, 0.889553726f},
-std::array<float,2>{0.565409124f, 0.0846023187f},
-std::array<float,2>{0.299731374f, 0.141688064f},
-std::array<float,2>{0.668880165f, 0.78065753f},
-std::array<float,2>{0.244367212f, 0.72960335f},
-std::array<float,2>{0.943306804f, 0.34299472f},
-std::array<float,2>{0.417147696f, 0.281720072f},
-std::array<float,2>{0.555044115f, 0.660161257f},
-std::array<float,2>{0.124806985f, 0.825882554f},
-std::array<float,2>{0.849333167f, 0.210436076f},
-std::array<float,2>{0.12983422f, 0.0151668694f},
-std::array<float,2>{0.881928742f, 0.973950803f},
-std::array<float,2>{0.332923204f, 0.619261563f},
-std::array<float,2>{0.692603946f, 0.409456491f},
-std::array<float,2>{0.133667678f, 0.468900681f},
-std::array<float,2>{0.884537458f, 0.530712545f},
-std::array<float,2>{0.343372822f, 0.900406778f},
-std::array<float,2>{0.701004148f, 0.0652362332f},
-std::array<float,2>{0.411322266f, 0.131587341f},
-std::array<float,2>{0.549221039f, 0.758795619f},
-std::array<float,2>{0.110280983f, 0.741659701f},
-std::array<float,2>{0.855703533f, 0.318545878f},
-std::array<float,2>{0.305857927f, 0.306762457f},
-std::array<float,2>{0.659886897f, 0.68135637f},
-std::array<float,2>{0.237972289f, 0.841347039f},
-std::array<float,2>{0.949744463f, 0.190663859f},
-std::array<float,2>{0.000528649834f, 0.0280226208f},
-std::array<float,2>{0.811659575f, 0.985327721f},
-std::array<float,2>{0.487152755f, 0.596128464f},
-std::array<float,2>{0.578014791f, 0.424203575f},
-std::array<float,2>{0.0699689612f, 0.349808961f},
-std::array<float,2>{0.82683742f, 0.700602591f},
-std::array<float,2>{0.397172213f, 0.805862904f},
-std::array<float,2>{0.511301696f, 0.157045737f},
-std::array<float,2>{0.358508348f, 0.114342511f},
-std::array<float,2>{0.725794256f, 0.909858167f},
-std::array<float,2>{0.1762909f, 0.544250548f},
-std::array<float,2>{0.933748424f, 0.454500556f},
-std::array<float,2>{0.439162433f, 0.376690894f},
-std::array<float,2>{0.610726118f, 0.582424998f},
-std::array<float,2>{0.0457469486f, 0.940180957f},
-std::array<float,2>{0.777282417f, 0.0429257378f},
-std::array<float,2>{0.197819024f, 0.224434242f},
-std::array<float,2>{0.994192719f, 0.847941577f},
-std::array<float,2>{0.251183867f, 0.638835251f},
-std::array<float,2>{0.633259356f, 0.261760265f},
-std::array<float,2>{0.229623258f, 0.27236861f},
-std::array<float,2>{0.96108067f, 0.64289856f},
-std::array<float,2>{0.290455312f, 0.865360081f},
-std::array<float,2>{0.686646879f, 0.239907593f},
-std::array<float,2>{0.478526026f, 0.0581760406f},
-std::array<float,2>{0.580849111f, 0.960494995f},
-std::array<float,2>{0.0294428598f, 0.56525147f},
-std::array<float,2>{0.790542662f, 0.3966043f},
-std::array<float,2>{0.327424914f, 0.440072715f},
-std::array<float,2>{0.709566951f, 0.56003195f},
-std::array<float,2>{0.147649854f, 0.925932348f},
-std::array<float,2>{0.904527366f, 0.105384313f},
-std::array<float,2>{0.101665258f, 0.176503018f},
-std::array<float,2>{0.860024989f, 0.789058387f},
-std::array<float,2>{0.427660048f, 0.710139751f},
-std::array<float,2>{0.542890787f, 0.373172015f},
-std::array<float,2>{0.0615871139f, 0.41071862f},
-std::array<float,2>{0.764865398f, 0.621698678f},
-std::array<float,2>{0.460575402f, 0.971177042f},
-std::array<float,2>{0.603647888f, 0.0081514027f},
-std::array<float,2>{0.271978259f, 0.203820154f},
-std::array<float,2>{0.646484613f, 0.823304296f},
-std::array<float,2>{0.215943515f, 0.65857935f},
-std::array<float,2>{0.973022223f, 0.287161887f},
-std::array<float,2>{0.38146323f, 0.339342505f},
-std::array<float,2>{0.52244401f, 0.730933607f},
-std::array<float,2>{0.0871512517f, 0.77592361f},
-std::array<float,2>{0.832233191f, 0.148393154f},
-std::array<float,2>{0.15759559f, 0.0797755793f},
-std::array<float,2>{0.917792678f, 0.882824004f},
-std::array<float,2>{0.360287219f, 0.507018447f},
-std::array<float,2>{0.74069494f, 0.495005995f},
-std::array<float,2>{0.207712278f, 0.404642731f},
-std::array<float,2>{0.977350235f, 0.577696562f},
-std::array<float,2>{0.280035228f, 0.966072857f},
-std::array<float,2>{0.650761545f, 0.0499257818f},
-std::array<float,2>{0.468232423f, 0.243037164f},
-std::array<float,2>{0.599290013f, 0.867329717f},
-std::array<float,2>{0.0537947118f, 0.652059019f},
-std::array<float,2>{0.751133502f, 0.278531492f},
-std::array<float,2>{0.373274595f, 0.36242795f},
-std::array<float,2>{0.746474266f, 0.715606809f},
-std::array<float,2>{0.171446934f, 0.796152174f},
-std::array<float,2>{0.912702441f, 0.183459282f},
-std::array<float,2>{0.0821217746f, 0.0962702632f},
-std::array<float,2>{0.843165576f, 0.935887218f},
-std::array<float,2>{0.382995576f, 0.547975659f},
-std::array<float,2>{0.53019923f, 0.451589823f},
-std::array<float,2>{0.0180529468f, 0.294302732f},
-std::array<float,2>{0.785618305f, 0.665613711f},
-std::array<float,2>{0.471137702f, 0.819962382f},
-std::array<float,2>{0.587264597f, 0.215684637f},
-std::array<float,2>{0.288666666f, 0.0078106327f},
-std::array<float,2>{0.675693393f, 0.983503938f},
-std::array<float,2>{0.22024706f, 0.614540458f},
-std::array<float,2>{0.956158638f, 0.421527982f},
-std::array<float,2>{0.431477934f, 0.488582402f},
-std::array<float,2>{0.537799537f, 0.51490432f},
-std::array<float,2>{0.098138012f, 0.879544795f},
-std::array<float,2>{0.867616713f, 0.0905188173f},
-std::array<float,2>{0.15014416f, 0.150866345f},
-std::array<float,2>{0.892377377f, 0.773298144f},
-std::array<float,2>{0.319515884f, 0.721217752f},
-std::array<float,2>{0.716246247f, 0.328662485f},
-std::array<float,2>{0.187287703f, 0.324767292f},
-std::array<float,2>{0.921955168f, 0.749730051f},
-std::array<float,2>{0.34677422f, 0.750328362f},
-std::array<float,2>{0.729337454f, 0.139295846f},
-std::array<float,2>{0.400357902f, 0.0740183741f},
-std::array<float,2>{0.50713259f, 0.894823849f},
-std::array<float,2>{0.0759885311f, 0.517397821f},
-std::array<float,2>{0.81657654f, 0.479527712f},
-std::array<float,2>{0.264367521f, 0.430295676f},
-std::array<float,2>{0.630831659f, 0.602105618f},
-std::array<float,2>{0.189506307f, 0.994015574f},
-std::array<float,2>{0.986631155f, 0.0160575844f},
-std::array<float,2>{0.0353781916f, 0.195655152f},
-std::array<float,2>{0.771137178f, 0.830698907f},
-std::array<float,2>{0.448684633f, 0.674165726f},
-std::array<float,2>{0.62347728f, 0.296920419f},
-std::array<float,2>{0.119755834f, 0.467945606f},
-std::array<float,2>{0.845024109f, 0.532066941f},
-std::array<float,2>{0.419631392f, 0.917194903f},
-std::array<float,2>{0.559461594f, 0.122459419f},
-std::array<float,2>{0.330694646f, 0.164442644f},
-std::array<float,2>{0.689242423f, 0.803492427f},
-std::array<float,2>{0.127800331f, 0.693108737f},
-std::array<float,2>{0.877446651f, 0.356721461f},
-std::array<float,2>{0.49463138f, 0.255520374f},
-std::array<float,2>{0.568022132f, 0.628925085f},
-std::array<float,2>{0.0103147868f, 0.858511269f},
-std::array<float,2>{0.803489029f, 0.230655298f},
-std::array<float,2>{0.249092817f, 0.0345765725f},
-std::array<float,2>{0.939382732f, 0.945478618f},
-std::array<float,2>{0.301705837f, 0.588295758f},
-std::array<float,2>{0.666921437f, 0.38866356f},
-std::array<float,2>{0.201813415f, 0.48589927f},
-std::array<float,2>{0.996533692f, 0.510652244f},
-std::array<float,2>{0.256971091f, 0.876567364f},
-std::array<float,2>{0.638615847f, 0.0890023261f},
-std::array<float,2>{0.443861276f, 0.156091124f},
-std::array<float,2>{0.616190434f, 0.76813674f},
-std::array<float,2>{0.0415748321f, 0.724217117f},
-std::array<float,2>{0.779471755f, 0.335217595f},
-std::array<float,2>{0.352042675f, 0.29082042f},
-std::array<float,2>{0.720935464f, 0.669236839f},
-std::array<float,2>{0.173670843f, 0.813465893f},
-std::array<float,2>{0.933420539f, 0.211586252f},
-std::array<float,2>{0.066067718f, 0.00366744143f},
-std::array<float,2>{0.820447624f, 0.979844868f},
-std::array<float,2>{0.393927813f, 0.612418175f},
-std::array<float,2>{0.514070392f, 0.417937785f},
-std::array<float,2>{0.00400248636f, 0.364675224f},
-std::array<float,2>{0.808486342f, 0.712750494f},
-std::array<float,2>{0.48933357f, 0.790355682f},
-std::array<float,2>{0.572582364f, 0.186611071f},
-std::array<float,2>{0.310460478f, 0.100954823f},
-std::array<float,2>{0.6639992f, 0.930954754f},
-std::array<float,2>{0.239283264f, 0.551244438f},
-std::array<float,2>{0.94623059f, 0.44816494f},
-std::array<float,2>{0.409426838f, 0.40076822f},
-std::array<float,2>{0.552623451f, 0.572391689f},
-std::array<float,2>{0.115370438f, 0.96104008f},
-std::array<float,2>{0.855429947f, 0.0539540686f},
-std::array<float,2>{0.137383461f, 0.248360977f},
-std::array<float,2>{0.889586806f, 0.871416628f},
-std::array<float,2>{0.336734593f, 0.65316081f},
-std::array<float,2>{0.698957443f, 0.275978953f},
-std::array<float,2>{0.162359312f, 0.251190096f},
-std::array<float,2>{0.919096112f, 0.628866136f},
-std::array<float,2>{0.366886646f, 0.853201866f},
-std::array<float,2>{0.735027611f, 0.230146214f},
-std::array<float,2>{0.378124893f, 0.0373652391f},
-std::array<float,2>{0.517891228f, 0.950207412f},
-std::array<float,2>{0.0926448926f, 0.592879176f},
-std::array<float,2>{0.828875244f, 0.383913487f},
-std::array<float,2>{0.267479956f, 0.461592019f},
-std::array<float,2>{0.64068526f, 0.537514389f},
-std::array<float,2>{0.212873131f, 0.921583652f},
-std::array<float,2>{0.971533597f, 0.119645208f},
-std::array<float,2>{0.0550532974f, 0.168770105f},
-std::array<float,2>{0.757927775f, 0.798683107f},
-std::array<float,2>{0.454577327f, 0.689266145f},
-std::array<float,2>{0.607111931f, 0.354740918f},
-std::array<float,2>{0.105480306f, 0.434682995f},
-std::array<float,2>{0.864831984f, 0.609269857f},
-std::array<float,2>{0.422247082f, 0.999651372f},
-std::array<float,2>{0.545042217f, 0.0208355542f},
-std::array<float,2>{0.322142124f, 0.200634494f},
-std::array<float,2>{0.705622494f, 0.834269285f},
-std::array<float,2>{0.140895307f, 0.678823411f},
-std::array<float,2>{0.898722708f, 0.301169991f},
-std::array<float,2>{0.480779678f, 0.322428256f},
-std::array<float,2>{0.582058609f, 0.745098412f},
-std::array<float,2>{0.0246465784f, 0.755559266f},
-std::array<float,2>{0.794593096f, 0.132956162f},
-std::array<float,2>{0.233443469f, 0.0770547166f},
-std::array<float,2>{0.965812564f, 0.894001186f},
-std::array<float,2>{0.296475559f, 0.519752383f},
-std::array<float,2>{0.68141371f, 0.481464952f},
-std::array<float,2>{0.153419882f, 0.381028801f},
-std::array<float,2>{0.895447552f, 0.579426229f},
-std::array<float,2>{0.313684553f, 0.942208588f},
-std::array<float,2>{0.714354217f, 0.0453361869f},
-std::array<float,2>{0.434031755f, 0.222090885f},
-std::array<float,2>{0.531697512f, 0.845325351f},
-std::array<float,2>{0.0953890681f, 0.63440609f},
-std::array<float,2>{0.874159455f, 0.260121554f},
-std::array<float,2>{0.285099387f, 0.34512502f},
-std::array<float,2>{0.67578429f, 0.697901189f},
-std::array<float,2>{0.223340631f, 0.810986221f},
-std::array<float,2>{0.958540261f, 0.162721872f},
-std::array<float,2>{0.0225191768f, 0.112316355f},
-std::array<float,2>{0.784873843f, 0.910773635f},
-std::array<float,2>{0.476344317f, 0.542036891f},
-std::array<float,2>{0.59059763f, 0.460091949f},
-std::array<float,2>{0.0786684677f, 0.311311156f},
-std::array<float,2>{0.838532984f, 0.683791101f},
-std::array<float,2>{0.387306094f, 0.836337864f},
-std::array<float,2>{0.525271118f, 0.194348425f},
-std::array<float,2>{0.370933145f, 0.0258936118f},
-std::array<float,2>{0.743502557f, 0.991342008f},
-std::array<float,2>{0.165879458f, 0.598197997f},
-std::array<float,2>{0.908176541f, 0.425875932f},
-std::array<float,2>{0.464633852f, 0.474067509f},
-std::array<float,2>{0.596355915f, 0.524754405f},
-std::array<float,2>{0.0499271639f, 0.905577004f},
-std::array<float,2>{0.756639719f, 0.068274051f},
-std::array<float,2>{0.203294843f, 0.125384331f},
-std::array<float,2>{0.981240392f, 0.762079358f},
-std::array<float,2>{0.274943203f, 0.736050069f},
-std::array<float,2>{0.653988123f, 0.314938456f},
-std::array<float,2>{0.244056046f, 0.34148556f},
-std::array<float,2>{0.945030153f, 0.727156579f},
-std::array<float,2>{0.298249036f, 0.779007435f},
-std::array<float,2>{0.67070961f, 0.144378781f},
-std::array<float,2>{0.49617219f, 0.0821815282f},
-std::array<float,2>{0.56267637f, 0.887432456f},
-std::array<float,2>{0.0125906095f, 0.501854599f},
-std::array<float,2>{0.800540924f, 0.497300357f},
-std::array<float,2>{0.335568547f, 0.407003105f},
-std::array<float,2>{0.69376415f, 0.617432058f},
-std::array<float,2>{0.131489187f, 0.974759221f},
-std::array<float,2>{0.880487263f, 0.0135809109f},
-std::array<float,2>{0.122133709f, 0.208491594f},
-std::array<float,2>{0.849811554f, 0.827424288f},
-std::array<float,2>{0.414707899f, 0.662557542f},
-std::array<float,2>{0.558398366f, 0.284025639f},
-std::array<float,2>{0.0312686414f, 0.443945408f},
-std::array<float,2>{0.769528568f, 0.555240571f},
-std::array<float,2>{0.450423181f, 0.923942566f},
-std::array<float,2>{0.617286563f, 0.106364593f},
-std::array<float,2>{0.259793401f, 0.173455387f},
-std::array<float,2>{0.627239108f, 0.782521427f},
-std::array<float,2>{0.192119658f, 0.706880331f},
-std::array<float,2>{0.989336014f, 0.367576033f},
-std::array<float,2>{0.404314667f, 0.26838553f},
-std::array<float,2>{0.502685785f, 0.647779286f},
-std::array<float,2>{0.0705714002f, 0.86155498f},
-std::array<float,2>{0.815400839f, 0.236067906f},
-std::array<float,2>{0.180414438f, 0.0609714612f},
-std::array<float,2>{0.9268049f, 0.953529775f},
-std::array<float,2>{0.349444032f, 0.56668812f},
-std::array<float,2>{0.734012306f, 0.391516566f},
-std::array<float,2>{0.178719476f, 0.455422401f},
-std::array<float,2>{0.935753047f, 0.546650708f},
-std::array<float,2>{0.355540723f, 0.906689465f},
-std::array<float,2>{0.723190904f, 0.115790635f},
-std::array<float,2>{0.39525947f, 0.158762366f},
-std::array<float,2>{0.509005904f, 0.807281435f},
-std::array<float,2>{0.0680747777f, 0.701838553f},
-std::array<float,2>{0.825381994f, 0.349516481f},
-std::array<float,2>{0.253713161f, 0.265503019f},
-std::array<float,2>{0.636125207f, 0.638003588f},
-std::array<float,2>{0.196753919f, 0.850180209f},
-std::array<float,2>{0.992987335f, 0.224921465f},
-std::array<float,2>{0.0436547995f, 0.0401765667f},
-std::array<float,2>{0.774124503f, 0.939076126f},
-std::array<float,2>{0.439884692f, 0.585589707f},
-std::array<float,2>{0.612219512f, 0.377590775f},
-std::array<float,2>{0.111781463f, 0.31784901f},
-std::array<float,2>{0.85804069f, 0.740151882f},
-std::array<float,2>{0.412118584f, 0.760178506f},
-std::array<float,2>{0.547515512f, 0.129726157f},
-std::array<float,2>{0.340965241f, 0.0636689439f},
-std::array<float,2>{0.702011168f, 0.899835825f},
-std::array<float,2>{0.135681644f, 0.528755665f},
-std::array<float,2>{0.885737419f, 0.471152067f},
-std::array<float,2>{0.485176086f, 0.422087759f},
-std::array<float,2>{0.574560225f, 0.595212042f},
-std::array<float,2>{0.00281741633f, 0.987015724f},
-std::array<float,2>{0.809285283f, 0.0298925173f},
-std::array<float,2>{0.235928714f, 0.188715324f},
-std::array<float,2>{0.952029109f, 0.842094958f},
-std::array<float,2>{0.307944149f, 0.681940734f},
-std::array<float,2>{0.656841576f, 0.304970294f},
-std::array<float,2>{0.217410862f, 0.286216497f},
-std::array<float,2>{0.975136518f, 0.657918215f},
-std::array<float,2>{0.270989537f, 0.821273208f},
-std::array<float,2>{0.644622386f, 0.205382332f},
-std::array<float,2>{0.458674878f, 0.0103239762f},
-std::array<float,2>{0.603215516f, 0.970224142f},
-std::array<float,2>{0.0599110797f, 0.624472558f},
-std::array<float,2>{0.763049662f, 0.412846535f},
-std::array<float,2>{0.362294227f, 0.493455291f},
-std::array<float,2>{0.739474535f, 0.504069328f},
-std::array<float,2>{0.158233553f, 0.885969758f},
-std::array<float,2>{0.914296389f, 0.081664525f},
-std::array<float,2>{0.0885191113f, 0.145853832f},
-std::array<float,2>{0.835709155f, 0.775057733f},
-std::array<float,2>{0.379107565f, 0.732555926f},
-std::array<float,2>{0.519576788f, 0.336348593f},
-std::array<float,2>{0.0275794044f, 0.395780087f},
-std::array<float,2>{0.791962206f, 0.56311053f},
-std::array<float,2>{0.478350013f, 0.957113743f},
-std::array<float,2>{0.579096615f, 0.0557608642f},
-std::array<float,2>{0.291882873f, 0.24175702f},
-std::array<float,2>{0.683600187f, 0.863290012f},
-std::array<float,2>{0.227556467f, 0.640977144f},
-std::array<float,2>{0.964457333f, 0.269624919f},
-std::array<float,2>{0.427910566f, 0.372810006f},
-std::array<float,2>{0.53958714f, 0.707799435f},
-std::array<float,2>{0.103840448f, 0.785851777f},
-std::array<float,2>{0.862972081f, 0.179469571f},
-std::array<float,2>{0.145560563f, 0.102240019f},
-std::array<float,2>{0.903938949f, 0.929406226f},
-std::array<float,2>{0.325928658f, 0.5617643f},
-std::array<float,2>{0.707876444f, 0.437596232f},
-std::array<float,2>{0.222596899f, 0.419606537f},
-std::array<float,2>{0.954956472f, 0.615796328f},
-std::array<float,2>{0.287054747f, 0.9811427f},
-std::array<float,2>{0.672397673f, 0.0042866976f},
-std::array<float,2>{0.469080865f, 0.217902541f},
-std::array<float,2>{0.588341415f, 0.817006469f},
-std::array<float,2>{0.0161415748f, 0.667158484f},
-std::array<float,2>{0.788177669f, 0.295396507f},
-std::array<float,2>{0.318343073f, 0.331424028f},
-std::array<float,2>{0.717460871f, 0.720341504f},
-std::array<float,2>{0.150812685f, 0.770421743f},
-std::array<float,2>{0.892858326f, 0.149778694f},
-std::array<float,2>{0.100445718f, 0.0918031037f},
-std::array<float,2>{0.870603681f, 0.882330596f},
-std::array<float,2>{0.431649625f, 0.513076127f},
-std::array<float,2>{0.536233246f, 0.490344912f},
-std::array<float,2>{0.0511320196f, 0.279485703f},
-std::array<float,2>{0.75375545f, 0.649738729f},
-std::array<float,2>{0.465566486f, 0.870171905f},
-std::array<float,2>{0.600762784f, 0.244861707f},
-std::array<float,2>{0.278260767f, 0.0487827659f},
-std::array<float,2>{0.649040759f, 0.968151808f},
-std::array<float,2>{0.210448593f, 0.575075328f},
-std::array<float,2>{0.978949606f, 0.4036704f},
-std::array<float,2>{0.385692567f, 0.449655861f},
-std::array<float,2>{0.529104412f, 0.54884243f},
-std::array<float,2>{0.0858059153f, 0.934173405f},
-std::array<float,2>{0.841782987f, 0.0948872045f},
-std::array<float,2>{0.168073773f, 0.181554049f},
-std::array<float,2>{0.911084473f, 0.794836044f},
-std::array<float,2>{0.371195406f, 0.718141794f},
-std::array<float,2>{0.748975098f, 0.359414876f},
-std::array<float,2>{0.126406193f, 0.357486457f},
-std::array<float,2>{0.876947999f, 0.694645166f},
-std::array<float,2>{0.328901023f, 0.801345527f},
-std::array<float,2>{0.689990103f, 0.167503014f},
-std::array<float,2>{0.421461582f, 0.12330769f},
-std::array<float,2>{0.562449217f, 0.91419071f},
-std::array<float,2>{0.118217491f, 0.533558249f},
-std::array<float,2>{0.845706224f, 0.466709703f},
-std::array<float,2>{0.304166883f, 0.38998884f},
-std::array<float,2>{0.664806902f, 0.586450279f},
-std::array<float,2>{0.247808307f, 0.94827956f},
-std::array<float,2>{0.939920604f, 0.0318279527f},
-std::array<float,2>{0.00793982577f, 0.232855618f},
-std::array<float,2>{0.802115262f, 0.856508374f},
-std::array<float,2>{0.493518531f, 0.631663799f},
-std::array<float,2>{0.570295334f, 0.257267565f},
-std::array<float,2>{0.0764316842f, 0.476855159f},
-std::array<float,2>{0.819064498f, 0.518509269f},
-std::array<float,2>{0.402160525f, 0.896622479f},
-std::array<float,2>{0.505435407f, 0.0716093481f},
-std::array<float,2>{0.344581932f, 0.137235984f},
-std::array<float,2>{0.726768911f, 0.752388f},
-std::array<float,2>{0.184541225f, 0.747885287f},
-std::array<float,2>{0.924798369f, 0.326561034f},
-std::array<float,2>{0.445317775f, 0.298828542f},
-std::array<float,2>{0.621132493f, 0.672076702f},
-std::array<float,2>{0.0378391035f, 0.828510702f},
-std::array<float,2>{0.771935761f, 0.199043974f},
-std::array<float,2>{0.187910646f, 0.0194305982f},
-std::array<float,2>{0.985895038f, 0.99503684f},
-std::array<float,2>{0.263433605f, 0.604490995f},
-std::array<float,2>{0.632202983f, 0.433540791f},
-std::array<float,2>{0.230936766f, 0.480959028f},
-std::array<float,2>{0.967734993f, 0.521414697f},
-std::array<float,2>{0.294684619f, 0.89311111f},
-std::array<float,2>{0.683409333f, 0.0776507482f},
-std::array<float,2>{0.484157056f, 0.134144738f},
-std::array<float,2>{0.585765004f, 0.754416406f},
-std::array<float,2>{0.0264071785f, 0.74513483f},
-std::array<float,2>{0.796789885f, 0.323812693f},
-std::array<float,2>{0.32246381f, 0.302208811f},
-std::array<float,2>{0.704752862f, 0.678283691f},
-std::array<float,2>{0.144492403f, 0.835699737f},
-std::array<float,2>{0.901815593f, 0.200025424f},
-std::array<float,2>{0.108233295f, 0.0204395801f},
-std::array<float,2>{0.866841853f, 0.998759329f},
-std::array<float,2>{0.424663454f, 0.608018816f},
-std::array<float,2>{0.542974472f, 0.433975786f},
-std::array<float,2>{0.0578741804f, 0.354470432f},
-std::array<float,2>{0.76030004f, 0.688361108f},
-std::array<float,2>{0.456801653f, 0.79730314f},
-std::array<float,2>{0.60867238f, 0.169098884f},
-std::array<float,2>{0.268005133f, 0.120210089f},
-std::array<float,2>{0.642647505f, 0.920757234f},
-std::array<float,2>{0.214649007f, 0.538652778f},
-std::array<float,2>{0.969547987f, 0.461963028f},
-std::array<float,2>{0.37661314f, 0.382904112f},
-std::array<float,2>{0.516827166f, 0.591859102f},
-std::array<float,2>{0.091792345f, 0.94943887f},
-std::array<float,2>{0.831595302f, 0.0383825451f},
-std::array<float,2>{0.16166079f, 0.229385123f},
-std::array<float,2>{0.920298219f, 0.852222621f},
-std::array<float,2>{0.364562392f, 0.627368391f},
-std::array<float,2>{0.73818022f, 0.250561595f},
-std::array<float,2>{0.139371902f, 0.276664644f},
-std::array<float,2>{0.887521029f, 0.653531611f},
-std::array<float,2>{0.337937117f, 0.872449934f},
-std::array<float,2>{0.696172893f, 0.249868006f},
-std::array<float,2>{0.407265753f, 0.0530345365f},
-std::array<float,2>{0.553515196f, 0.962348402f},
-std::array<float,2>{0.113855816f, 0.573895097f},
-std::array<float,2>{0.852361798f, 0.401893914f},
-std::array<float,2>{0.311847895f, 0.44896841f},
-std::array<float,2>{0.661167681f, 0.552528024f},
-std::array<float,2>{0.240236625f, 0.929959238f},
-std::array<float,2>{0.947894394f, 0.100018509f},
-std::array<float,2>{0.00737695536f, 0.186370641f},
-std::array<float,2>{0.804868221f, 0.78926003f},
-std::array<float,2>{0.492019087f, 0.711479545f},
-std::array<float,2>{0.571078002f, 0.363558203f},
-std::array<float,2>{0.0643560961f, 0.416310906f},
-std::array<float,2>{0.822605193f, 0.612165749f},
-std::array<float,2>{0.391035199f, 0.978801489f},
-std::array<float,2>{0.513574541f, 0.00277819647f},
-std::array<float,2>{0.353607237f, 0.212255314f},
-std::array<float,2>{0.71977216f, 0.814064026f},
-std::array<float,2>{0.175366551f, 0.667991042f},
-std::array<float,2>{0.931323051f, 0.289982915f},
-std::array<float,2>{0.442958951f, 0.334244609f},
-std::array<float,2>{0.613902092f, 0.722965062f},
-std::array<float,2>{0.0396321006f, 0.769419074f},
-std::array<float,2>{0.779110849f, 0.155223802f},
-std::array<float,2>{0.200682253f, 0.0884871334f},
-std::array<float,2>{0.999701202f, 0.875074387f},
-std::array<float,2>{0.254635066f, 0.51085031f},
-std::array<float,2>{0.639973342f, 0.484971017f},
-std::array<float,2>{0.182300359f, 0.391678661f},
-std::array<float,2>{0.928254306f, 0.567690969f},
-std::array<float,2>{0.350552231f, 0.954122066f},
-std::array<float,2>{0.731573224f, 0.0616106801f},
-std::array<float,2>{0.402644247f, 0.234439149f},
-std::array<float,2>{0.500520229f, 0.862525105f},
-std::array<float,2>{0.0732873455f, 0.647295594f},
-std::array<float,2>{0.813494503f, 0.26924035f},
-std::array<float,2>{0.258895904f, 0.369002253f},
-std::array<float,2>{0.625752926f, 0.705429733f},
-std::array<float,2>{0.194611579f, 0.781299353f},
-std::array<float,2>{0.991708279f, 0.172110453f},
-std::array<float,2>{0.0335830376f, 0.107284933f},
-std::array<float,2>{0.766296566f, 0.925103605f},
-std::array<float,2>{0.452552527f, 0.556205928f},
-std::array<float,2>{0.619395494f, 0.444938272f},
-std::array<float,2>{0.123861998f, 0.285099894f},
-std::array<float,2>{0.848369181f, 0.663105905f},
-std::array<float,2>{0.416844934f, 0.826846778f},
-std::array<float,2>{0.556396067f, 0.207297206f},
-std::array<float,2>{0.333020568f, 0.0126616424f},
-std::array<float,2>{0.692341566f, 0.975996494f},
-std::array<float,2>{0.130646065f, 0.619015217f},
-std::array<float,2>{0.88098073f, 0.407806605f},
-std::array<float,2>{0.498362958f, 0.496618271f},
-std::array<float,2>{0.565530241f, 0.500040948f},
-std::array<float,2>{0.0144240083f, 0.888664722f},
-std::array<float,2>{0.797838628f, 0.0835223496f},
-std::array<float,2>{0.245206475f, 0.143048063f},
-std::array<float,2>{0.941681802f, 0.778221905f},
-std::array<float,2>{0.299992174f, 0.72827214f},
-std::array<float,2>{0.669462025f, 0.339892775f},
-std::array<float,2>{0.206186339f, 0.315702975f},
-std::array<float,2>{0.982711732f, 0.734620094f},
-std::array<float,2>{0.277273178f, 0.76322782f},
-std::array<float,2>{0.656171381f, 0.126186013f},
-std::array<float,2>{0.461022168f, 0.0667287931f},
-std::array<float,2>{0.594987214f, 0.904579759f},
-std::array<float,2>{0.048667714f, 0.524096727f},
-std::array<float,2>{0.755425692f, 0.472994566f},
-std::array<float,2>{0.367609173f, 0.426902294f},
-std::array<float,2>{0.745736182f, 0.598875046f},
-std::array<float,2>{0.166889399f, 0.990297496f},
-std::array<float,2>{0.909091532f, 0.0270729195f},
-std::array<float,2>{0.0809352472f, 0.194264606f},
-std::array<float,2>{0.836275399f, 0.837643027f},
-std::array<float,2>{0.388900012f, 0.685140252f},
-std::array<float,2>{0.526281774f, 0.312434465f},
-std::array<float,2>{0.0197697449f, 0.459275723f},
-std::array<float,2>{0.782049477f, 0.541919053f},
-std::array<float,2>{0.473336726f, 0.911315203f},
-std::array<float,2>{0.592391372f, 0.111725628f},
-std::array<float,2>{0.282203883f, 0.163352877f},
-std::array<float,2>{0.679095924f, 0.812167823f},
-std::array<float,2>{0.225813687f, 0.698354781f},
-std::array<float,2>{0.95996809f, 0.343997955f},
-std::array<float,2>{0.436651945f, 0.261580527f},
-std::array<float,2>{0.535006106f, 0.633073866f},
-std::array<float,2>{0.097633332f, 0.844201326f},
-std::array<float,2>{0.872304797f, 0.221667022f},
-std::array<float,2>{0.155743405f, 0.0460869819f},
-std::array<float,2>{0.898063958f, 0.942753196f},
-std::array<float,2>{0.315872341f, 0.578956127f},
-std::array<float,2>{0.71195519f, 0.382503629f},
-std::array<float,2>{0.147261679f, 0.438496441f},
-std::array<float,2>{0.905908287f, 0.560639024f},
-std::array<float,2>{0.326453954f, 0.92861867f},
-std::array<float,2>{0.710353494f, 0.103301123f},
-std::array<float,2>{0.426504135f, 0.177964792f},
-std::array<float,2>{0.541230202f, 0.786248922f},
-std::array<float,2>{0.103067912f, 0.708959401f},
-std::array<float,2>{0.861267209f, 0.371344984f},
-std::array<float,2>{0.289658666f, 0.27058056f},
-std::array<float,2>{0.686100841f, 0.64191258f},
-std::array<float,2>{0.228944033f, 0.864839256f},
-std::array<float,2>{0.962531149f, 0.240830854f},
-std::array<float,2>{0.0309140887f, 0.0549966805f},
-std::array<float,2>{0.789404333f, 0.958202004f},
-std::array<float,2>{0.479891807f, 0.563672841f},
-std::array<float,2>{0.581731617f, 0.395462692f},
-std::array<float,2>{0.0863624737f, 0.337039977f},
-std::array<float,2>{0.833707213f, 0.734098554f},
-std::array<float,2>{0.381836712f, 0.774133146f},
-std::array<float,2>{0.523217976f, 0.145308539f},
-std::array<float,2>{0.360791504f, 0.0804597959f},
-std::array<float,2>{0.741749167f, 0.885389924f},
-std::array<float,2>{0.156339303f, 0.505571365f},
-std::array<float,2>{0.916075826f, 0.492947012f},
-std::array<float,2>{0.459375024f, 0.41362384f},
-std::array<float,2>{0.605241179f, 0.623745382f},
-std::array<float,2>{0.061422307f, 0.969083369f},
-std::array<float,2>{0.764536977f, 0.0109498892f},
-std::array<float,2>{0.215205699f, 0.206128016f},
-std::array<float,2>{0.973670006f, 0.82138449f},
-std::array<float,2>{0.273238748f, 0.65667665f},
-std::array<float,2>{0.647700012f, 0.285694659f},
-std::array<float,2>{0.236461028f, 0.306219369f},
-std::array<float,2>{0.95051676f, 0.682839453f},
-std::array<float,2>{0.305028617f, 0.842929959f},
-std::array<float,2>{0.658216596f, 0.187562779f},
-std::array<float,2>{0.487778306f, 0.0307198036f},
-std::array<float,2>{0.576200962f, 0.988269031f},
-std::array<float,2>{0.00109743897f, 0.594459236f},
-std::array<float,2>{0.810934246f, 0.423185766f},
-std::array<float,2>{0.342161983f, 0.472066343f},
-std::array<float,2>{0.699684799f, 0.527703643f},
-std::array<float,2>{0.134021148f, 0.898897111f},
-std::array<float,2>{0.883400559f, 0.0628713295f},
-std::array<float,2>{0.110595606f, 0.130147234f},
-std::array<float,2>{0.856657684f, 0.760994971f},
-std::array<float,2>{0.41099003f, 0.739039242f},
-std::array<float,2>{0.550452888f, 0.317314446f},
-std::array<float,2>{0.046513129f, 0.377934277f},
-std::array<float,2>{0.775552213f, 0.58482933f},
-std::array<float,2>{0.437821031f, 0.93801856f},
-std::array<float,2>{0.609977782f, 0.0396960229f},
-std::array<float,2>{0.250302076f, 0.225599915f},
-std::array<float,2>{0.634199142f, 0.851383805f},
-std::array<float,2>{0.198710382f, 0.637412727f},
-std::array<float,2>{0.995330453f, 0.26454258f},
-std::array<float,2>{0.397489816f, 0.347972989f},
-std::array<float,2>{0.510155261f, 0.70222795f},
-std::array<float,2>{0.0689964592f, 0.808571398f},
-std::array<float,2>{0.827485979f, 0.159893706f},
-std::array<float,2>{0.176931307f, 0.116430834f},
-std::array<float,2>{0.934684813f, 0.908200204f},
-std::array<float,2>{0.357706606f, 0.545621574f},
-std::array<float,2>{0.725059152f, 0.456378579f},
-std::array<float,2>{0.190970972f, 0.432457f},
-std::array<float,2>{0.988022745f, 0.604802966f},
-std::array<float,2>{0.265258312f, 0.99607873f},
-std::array<float,2>{0.629648626f, 0.0183074847f},
-std::array<float,2>{0.447954059f, 0.19752714f},
-std::array<float,2>{0.624784768f, 0.829313815f},
-std::array<float,2>{0.0367574617f, 0.673385024f},
-std::array<float,2>{0.76971823f, 0.300514609f},
-std::array<float,2>{0.346416891f, 0.327652812f},
-std::array<float,2>{0.72988832f, 0.746221125f},
-std::array<float,2>{0.186350495f, 0.75344038f},
-std::array<float,2>{0.923028469f, 0.138133228f},
-std::array<float,2>{0.0749086738f, 0.0705821514f},
-std::array<float,2>{0.817899823f, 0.89766407f},
-std::array<float,2>{0.398995906f, 0.518663764f},
-std::array<float,2>{0.506405413f, 0.478220522f},
-std::array<float,2>{0.0107841808f, 0.256283641f},
-std::array<float,2>{0.803711057f, 0.632327378f},
-std::array<float,2>{0.495496243f, 0.856352866f},
-std::array<float,2>{0.566600502f, 0.234164253f},
-std::array<float,2>{0.302073538f, 0.0328517146f},
-std::array<float,2>{0.667117715f, 0.947378397f},
-std::array<float,2>{0.248523712f, 0.587469518f},
-std::array<float,2>{0.937964559f, 0.389015377f},
-std::array<float,2>{0.418865144f, 0.465721309f},
-std::array<float,2>{0.560330451f, 0.534405231f},
-std::array<float,2>{0.120327003f, 0.915933788f},
-std::array<float,2>{0.844278455f, 0.124259084f},
-std::array<float,2>{0.12812607f, 0.166329637f},
-std::array<float,2>{0.87816304f, 0.802003622f},
-std::array<float,2>{0.331542134f, 0.693852007f},
-std::array<float,2>{0.688279808f, 0.359348178f},
-std::array<float,2>{0.170210466f, 0.360775739f},
-std::array<float,2>{0.91398561f, 0.717246413f},
-std::array<float,2>{0.374093175f, 0.793806136f},
-std::array<float,2>{0.747832894f, 0.180208728f},
-std::array<float,2>{0.384486407f, 0.09381558f},
-std::array<float,2>{0.530591071f, 0.935013115f},
-std::array<float,2>{0.0834226459f, 0.550506413f},
-std::array<float,2>{0.841853738f, 0.450524837f},
-std::array<float,2>{0.281221151f, 0.403009504f},
-std::array<float,2>{0.652126253f, 0.575921416f},
-std::array<float,2>{0.208776817f, 0.967486978f},
-std::array<float,2>{0.97822392f, 0.0475205146f},
-std::array<float,2>{0.0529531725f, 0.245963499f},
-std::array<float,2>{0.750415802f, 0.869378746f},
-std::array<float,2>{0.467504263f, 0.648667872f},
-std::array<float,2>{0.598044515f, 0.280641973f},
-std::array<float,2>{0.0993304625f, 0.492053509f},
-std::array<float,2>{0.868479311f, 0.511735797f},
-std::array<float,2>{0.429808676f, 0.881465435f},
-std::array<float,2>{0.538528085f, 0.0929546803f},
-std::array<float,2>{0.31867975f, 0.149300382f},
-std::array<float,2>{0.7151618f, 0.770801485f},
-std::array<float,2>{0.149097681f, 0.71890986f},
-std::array<float,2>{0.891361058f, 0.330452502f},
-std::array<float,2>{0.47205624f, 0.296134919f},
-std::array<float,2>{0.586820841f, 0.666479826f},
-std::array<float,2>{0.0189314838f, 0.817765713f},
-std::array<float,2>{0.7869941f, 0.217236012f},
-std::array<float,2>{0.218974143f, 0.00566788996f},
-std::array<float,2>{0.955247104f, 0.98203218f},
-std::array<float,2>{0.287608892f, 0.616827786f},
-std::array<float,2>{0.674529195f, 0.41811797f},
-std::array<float,2>{0.211750761f, 0.462942332f},
-std::array<float,2>{0.972057998f, 0.536540508f},
-std::array<float,2>{0.266159475f, 0.918106139f},
-std::array<float,2>{0.641611874f, 0.118914239f},
-std::array<float,2>{0.453647584f, 0.170253932f},
-std::array<float,2>{0.606005132f, 0.799993992f},
-std::array<float,2>{0.0562716872f, 0.691138387f},
-std::array<float,2>{0.758933604f, 0.352368265f},
-std::array<float,2>{0.365240872f, 0.252052605f},
-std::array<float,2>{0.735658824f, 0.625268877f},
-std::array<float,2>{0.163138717f, 0.854561865f},
-std::array<float,2>{0.918287635f, 0.227562115f},
-std::array<float,2>{0.0930926576f, 0.0367116071f},
-std::array<float,2>{0.829958916f, 0.951456726f},
-std::array<float,2>{0.377855897f, 0.590542972f},
-std::array<float,2>{0.518847704f, 0.385793984f},
-std::array<float,2>{0.0235996526f, 0.321502388f},
-std::array<float,2>{0.793756902f, 0.74372679f},
-std::array<float,2>{0.481743515f, 0.756565094f},
-std::array<float,2>{0.5834167f, 0.135914072f},
-std::array<float,2>{0.295555949f, 0.0748943537f},
-std::array<float,2>{0.679901421f, 0.892083108f},
-std::array<float,2>{0.233188882f, 0.52221328f},
-std::array<float,2>{0.966653347f, 0.483346522f},
-std::array<float,2>{0.423425555f, 0.437079817f},
-std::array<float,2>{0.546230435f, 0.605872154f},
-std::array<float,2>{0.10733477f, 0.997119188f},
-std::array<float,2>{0.86359024f, 0.0220145918f},
-std::array<float,2>{0.142373368f, 0.201876968f},
-std::array<float,2>{0.899823964f, 0.832899451f},
-std::array<float,2>{0.321016341f, 0.676389396f},
-std::array<float,2>{0.706210017f, 0.303034484f},
-std::array<float,2>{0.172172174f, 0.291985124f},
-std::array<float,2>{0.931675255f, 0.670287311f},
-std::array<float,2>{0.353102565f, 0.814593494f},
-std::array<float,2>{0.722437024f, 0.213246316f},
-std::array<float,2>{0.393194228f, 6.57893106e-05f},
-std::array<float,2>{0.515051484f, 0.978436112f},
-std::array<float,2>{0.0649120212f, 0.609465957f},
-std::array<float,2>{0.821596801f, 0.415689498f},
-std::array<float,2>{0.256711215f, 0.486787081f},
-std::array<float,2>{0.636732519f, 0.509607255f},
-std::array<float,2>{0.202565342f, 0.87811476f},
-std::array<float,2>{0.99750948f, 0.0861529112f},
-std::array<float,2>{0.0428034998f, 0.153014362f},
-std::array<float,2>{0.780834496f, 0.765678883f},
-std::array<float,2>{0.444413722f, 0.725134194f},
-std::array<float,2>{0.617083967f, 0.333166778f},
-std::array<float,2>{0.11641863f, 0.398630321f},
-std::array<float,2>{0.85368365f, 0.571249962f},
-std::array<float,2>{0.409006864f, 0.963602364f},
-std::array<float,2>{0.550833523f, 0.0508924648f},
-std::array<float,2>{0.33733511f, 0.247892827f},
-std::array<float,2>{0.698208153f, 0.873118758f},
-std::array<float,2>{0.138517976f, 0.656177878f},
-std::array<float,2>{0.890402317f, 0.273626924f},
-std::array<float,2>{0.488596141f, 0.365363985f},
-std::array<float,2>{0.574111164f, 0.713056624f},
-std::array<float,2>{0.00560223637f, 0.791711986f},
-std::array<float,2>{0.806746781f, 0.185224086f},
-std::array<float,2>{0.238343582f, 0.0995591953f},
-std::array<float,2>{0.946793199f, 0.932507634f},
-std::array<float,2>{0.309466183f, 0.553662896f},
-std::array<float,2>{0.662819147f, 0.44550705f},
-std::array<float,2>{0.131941468f, 0.408766508f},
-std::array<float,2>{0.879232645f, 0.620227456f},
-std::array<float,2>{0.334815174f, 0.972860694f},
-std::array<float,2>{0.694350958f, 0.0145901283f},
-std::array<float,2>{0.416004866f, 0.209143475f},
-std::array<float,2>{0.557573736f, 0.824712634f},
-std::array<float,2>{0.121744573f, 0.662022829f},
-std::array<float,2>{0.851223707f, 0.282774776f},
-std::array<float,2>{0.297624677f, 0.34194231f},
-std::array<float,2>{0.671278775f, 0.729333818f},
-std::array<float,2>{0.24301663f, 0.779540479f},
-std::array<float,2>{0.943897903f, 0.140716925f},
-std::array<float,2>{0.0136459675f, 0.0856767967f},
-std::array<float,2>{0.799669385f, 0.89013809f},
-std::array<float,2>{0.497894138f, 0.502803028f},
-std::array<float,2>{0.56355685f, 0.499026954f},
-std::array<float,2>{0.0719310567f, 0.266792715f},
-std::array<float,2>{0.816338599f, 0.646338403f},
-std::array<float,2>{0.405835748f, 0.859862804f},
-std::array<float,2>{0.503411889f, 0.237909481f},
-std::array<float,2>{0.347941577f, 0.059006393f},
-std::array<float,2>{0.732866585f, 0.955651879f},
-std::array<float,2>{0.180815473f, 0.570131421f},
-std::array<float,2>{0.926665723f, 0.39358604f},
-std::array<float,2>{0.449980557f, 0.44321698f},
-std::array<float,2>{0.618889093f, 0.557932436f},
-std::array<float,2>{0.0323831402f, 0.923044741f},
-std::array<float,2>{0.767813444f, 0.108672552f},
-std::array<float,2>{0.192977205f, 0.17503342f},
-std::array<float,2>{0.988673389f, 0.783810973f},
-std::array<float,2>{0.261162639f, 0.705011129f},
-std::array<float,2>{0.628839433f, 0.370761484f},
-std::array<float,2>{0.224091902f, 0.347615987f},
-std::array<float,2>{0.957928061f, 0.695680559f},
-std::array<float,2>{0.283886522f, 0.808623135f},
-std::array<float,2>{0.677458882f, 0.160663858f},
-std::array<float,2>{0.47487855f, 0.111168928f},
-std::array<float,2>{0.591684043f, 0.913909793f},
-std::array<float,2>{0.0218562875f, 0.540892482f},
-std::array<float,2>{0.783499956f, 0.458218932f},
-std::array<float,2>{0.313397855f, 0.379760891f},
-std::array<float,2>{0.713147163f, 0.581333637f},
-std::array<float,2>{0.152587995f, 0.944482625f},
-std::array<float,2>{0.895635128f, 0.0447092094f},
-std::array<float,2>{0.0940117836f, 0.219737709f},
-std::array<float,2>{0.873109043f, 0.84605068f},
-std::array<float,2>{0.434932858f, 0.635140896f},
-std::array<float,2>{0.533151448f, 0.259245485f},
-std::array<float,2>{0.0493503027f, 0.47581467f},
-std::array<float,2>{0.757580161f, 0.525766969f},
-std::array<float,2>{0.463064402f, 0.902617812f},
-std::array<float,2>{0.596933186f, 0.0694176927f},
-std::array<float,2>{0.273501039f, 0.128674537f},
-std::array<float,2>{0.652809143f, 0.764137268f},
-std::array<float,2>{0.204830378f, 0.737617552f},
-std::array<float,2>{0.98150599f, 0.313702971f},
-std::array<float,2>{0.38777709f, 0.308740497f},
-std::array<float,2>{0.523851633f, 0.686448872f},
-std::array<float,2>{0.0792937204f, 0.839330435f},
-std::array<float,2>{0.839465678f, 0.192995861f},
-std::array<float,2>{0.165014759f, 0.0244106036f},
-std::array<float,2>{0.906890571f, 0.98872f},
-std::array<float,2>{0.369774371f, 0.601543844f},
-std::array<float,2>{0.743091941f, 0.427832663f},
-std::array<float,2>{0.159250706f, 0.495351493f},
-std::array<float,2>{0.915951431f, 0.506684303f},
-std::array<float,2>{0.362320572f, 0.8846035f},
-std::array<float,2>{0.739044547f, 0.0788848102f},
-std::array<float,2>{0.380462766f, 0.146638259f},
-std::array<float,2>{0.521365941f, 0.777215779f},
-std::array<float,2>{0.0896523818f, 0.732325733f},
-std::array<float,2>{0.834015965f, 0.338617504f},
-std::array<float,2>{0.270363182f, 0.288498312f},
-std::array<float,2>{0.646007955f, 0.659707844f},
-std::array<float,2>{0.218639582f, 0.822972536f},
-std::array<float,2>{0.97589159f, 0.204674289f},
-std::array<float,2>{0.0595088154f, 0.00889474712f},
-std::array<float,2>{0.762267947f, 0.972544312f},
-std::array<float,2>{0.457575291f, 0.622143209f},
-std::array<float,2>{0.6019575f, 0.411513597f},
-std::array<float,2>{0.105227672f, 0.374469936f},
-std::array<float,2>{0.861833155f, 0.709935784f},
-std::array<float,2>{0.429302692f, 0.787718892f},
-std::array<float,2>{0.540736079f, 0.177384973f},
-std::array<float,2>{0.324986786f, 0.103912443f},
-std::array<float,2>{0.708959043f, 0.926887333f},
-std::array<float,2>{0.14505516f, 0.559109986f},
-std::array<float,2>{0.902724624f, 0.440713614f},
-std::array<float,2>{0.476836771f, 0.397497565f},
-std::array<float,2>{0.579943419f, 0.566280484f},
-std::array<float,2>{0.0286250561f, 0.959503591f},
-std::array<float,2>{0.792750061f, 0.0572998635f},
-std::array<float,2>{0.227064982f, 0.238424107f},
-std::array<float,2>{0.963168263f, 0.86632055f},
-std::array<float,2>{0.292572498f, 0.644268215f},
-std::array<float,2>{0.685182214f, 0.27266708f},
-std::array<float,2>{0.196074218f, 0.262812078f},
-std::array<float,2>{0.993466377f, 0.640047669f},
-std::array<float,2>{0.25242871f, 0.849342883f},
-std::array<float,2>{0.635731101f, 0.22310324f},
-std::array<float,2>{0.441119522f, 0.0410670191f},
-std::array<float,2>{0.612645626f, 0.940960646f},
-std::array<float,2>{0.044858519f, 0.583075404f},
-std::array<float,2>{0.774797738f, 0.375611365f},
-std::array<float,2>{0.357007354f, 0.453915536f},
-std::array<float,2>{0.724110663f, 0.542976618f},
-std::array<float,2>{0.177889377f, 0.908709645f},
-std::array<float,2>{0.937262356f, 0.113614418f},
-std::array<float,2>{0.0664069504f, 0.157734111f},
-std::array<float,2>{0.825127125f, 0.80518651f},
-std::array<float,2>{0.395986974f, 0.699594498f},
-std::array<float,2>{0.508182108f, 0.351324916f},
-std::array<float,2>{0.00381319341f, 0.425714523f},
-std::array<float,2>{0.810116589f, 0.597569764f},
-std::array<float,2>{0.485902816f, 0.985558867f},
-std::array<float,2>{0.576092422f, 0.0290617663f},
-std::array<float,2>{0.306877732f, 0.18990995f},
-std::array<float,2>{0.657902062f, 0.84023118f},
-std::array<float,2>{0.234710813f, 0.680416107f},
-std::array<float,2>{0.953064024f, 0.307791054f},
-std::array<float,2>{0.413255721f, 0.319633394f},
-std::array<float,2>{0.548740625f, 0.741045475f},
-std::array<float,2>{0.112796858f, 0.75826031f},
-std::array<float,2>{0.858442843f, 0.132726982f},
-std::array<float,2>{0.135954022f, 0.0663718954f},
-std::array<float,2>{0.886430442f, 0.901843131f},
-std::array<float,2>{0.34029597f, 0.529522896f},
-std::array<float,2>{0.70277065f, 0.469838023f},
-std::array<float,2>{0.246381164f, 0.386902243f},
-std::array<float,2>{0.94097954f, 0.589686036f},
-std::array<float,2>{0.302734703f, 0.947085083f},
-std::array<float,2>{0.665979803f, 0.033681605f},
-std::array<float,2>{0.493159443f, 0.231574342f},
-std::array<float,2>{0.568450749f, 0.857446671f},
-std::array<float,2>{0.00912027713f, 0.629980385f},
-std::array<float,2>{0.801154017f, 0.254133195f},
-std::array<float,2>{0.329508603f, 0.355592847f},
-std::array<float,2>{0.691308558f, 0.691453755f},
-std::array<float,2>{0.125351548f, 0.803779662f},
-std::array<float,2>{0.875572503f, 0.165517181f},
-std::array<float,2>{0.117446169f, 0.121588543f},
-std::array<float,2>{0.847029984f, 0.916473806f},
-std::array<float,2>{0.420296997f, 0.532548189f},
-std::array<float,2>{0.561153114f, 0.467474043f},
-std::array<float,2>{0.0384968556f, 0.298763096f},
-std::array<float,2>{0.773379385f, 0.675524771f},
-std::array<float,2>{0.446940213f, 0.831196189f},
-std::array<float,2>{0.622883201f, 0.196957961f},
-std::array<float,2>{0.2617791f, 0.0169237666f},
-std::array<float,2>{0.631422877f, 0.992823601f},
-std::array<float,2>{0.189336166f, 0.603260279f},
-std::array<float,2>{0.9851529f, 0.43135795f},
-std::array<float,2>{0.40079838f, 0.478708625f},
-std::array<float,2>{0.504785359f, 0.516526043f},
-std::array<float,2>{0.0771658272f, 0.895628452f},
-std::array<float,2>{0.820265412f, 0.0732407421f},
-std::array<float,2>{0.184697524f, 0.140502661f},
-std::array<float,2>{0.925411582f, 0.751376629f},
-std::array<float,2>{0.345264465f, 0.748415828f},
-std::array<float,2>{0.72754091f, 0.325370818f},
-std::array<float,2>{0.15153785f, 0.329473019f},
-std::array<float,2>{0.894194186f, 0.722217798f},
-std::array<float,2>{0.316408426f, 0.77198267f},
-std::array<float,2>{0.718201101f, 0.151439503f},
-std::array<float,2>{0.432686061f, 0.0917200446f},
-std::array<float,2>{0.535192072f, 0.880473018f},
-std::array<float,2>{0.100859687f, 0.513887942f},
-std::array<float,2>{0.870060086f, 0.48944357f},
-std::array<float,2>{0.28530094f, 0.420522243f},
-std::array<float,2>{0.673199534f, 0.613292336f},
-std::array<float,2>{0.220906913f, 0.982724667f},
-std::array<float,2>{0.95401752f, 0.00661754468f},
-std::array<float,2>{0.017532438f, 0.216082856f},
-std::array<float,2>{0.787689984f, 0.818927884f},
-std::array<float,2>{0.470586479f, 0.664481759f},
-std::array<float,2>{0.589340329f, 0.293356448f},
-std::array<float,2>{0.0840169713f, 0.452192634f},
-std::array<float,2>{0.840332448f, 0.547173202f},
-std::array<float,2>{0.386319101f, 0.93734014f},
-std::array<float,2>{0.527768731f, 0.0966907591f},
-std::array<float,2>{0.372733504f, 0.182067946f},
-std::array<float,2>{0.749414742f, 0.795216441f},
-std::array<float,2>{0.169097394f, 0.716750085f},
-std::array<float,2>{0.911690593f, 0.362144917f},
-std::array<float,2>{0.465945721f, 0.277451485f},
-std::array<float,2>{0.600073755f, 0.651332855f},
-std::array<float,2>{0.0517767556f, 0.868231773f},
-std::array<float,2>{0.752215445f, 0.2438014f},
-std::array<float,2>{0.209361002f, 0.0496041737f},
-std::array<float,2>{0.979563355f, 0.965069592f},
-std::array<float,2>{0.279201031f, 0.576820493f},
-std::array<float,2>{0.64946264f, 0.406134039f},
-std::array<float,2>{0.226378411f, 0.458607584f},
-std::array<float,2>{0.960849226f, 0.540090322f},
-std::array<float,2>{0.281564355f, 0.913095176f},
-std::array<float,2>{0.679581523f, 0.110684164f},
-std::array<float,2>{0.472913325f, 0.160451576f},
-std::array<float,2>{0.592082262f, 0.809262216f},
-std::array<float,2>{0.0200566575f, 0.695972621f},
-std::array<float,2>{0.781341076f, 0.34678939f},
-std::array<float,2>{0.31620273f, 0.25952518f},
-std::array<float,2>{0.712809801f, 0.635284603f},
-std::array<float,2>{0.155924067f, 0.846550822f},
-std::array<float,2>{0.897845984f, 0.220259234f},
-std::array<float,2>{0.0970973894f, 0.0442109816f},
-std::array<float,2>{0.872666776f, 0.945015848f},
-std::array<float,2>{0.437257051f, 0.581774771f},
-std::array<float,2>{0.534474671f, 0.378986925f},
-std::array<float,2>{0.0478844941f, 0.314324141f},
-std::array<float,2>{0.755044222f, 0.737950921f},
-std::array<float,2>{0.461782575f, 0.764512658f},
-std::array<float,2>{0.595408201f, 0.128044665f},
-std::array<float,2>{0.276855201f, 0.0701541826f},
-std::array<float,2>{0.655334115f, 0.903141499f},
-std::array<float,2>{0.206648484f, 0.526085794f},
-std::array<float,2>{0.983213961f, 0.476107031f},
-std::array<float,2>{0.389631152f, 0.428702652f},
-std::array<float,2>{0.525788486f, 0.600738645f},
-std::array<float,2>{0.0801620856f, 0.989152431f},
-std::array<float,2>{0.83676511f, 0.0237731189f},
-std::array<float,2>{0.166180819f, 0.192633897f},
-std::array<float,2>{0.908391476f, 0.839776754f},
-std::array<float,2>{0.367694706f, 0.685978174f},
-std::array<float,2>{0.745491028f, 0.309433967f},
-std::array<float,2>{0.130204737f, 0.28234145f},
-std::array<float,2>{0.881489277f, 0.661241293f},
-std::array<float,2>{0.333771676f, 0.824221611f},
-std::array<float,2>{0.691671729f, 0.209926188f},
-std::array<float,2>{0.416119963f, 0.0140925953f},
-std::array<float,2>{0.55576992f, 0.973347723f},
-std::array<float,2>{0.123505861f, 0.620747209f},
-std::array<float,2>{0.847844064f, 0.408414662f},
-std::array<float,2>{0.300637901f, 0.499592453f},
-std::array<float,2>{0.669185996f, 0.502037764f},
-std::array<float,2>{0.2460168f, 0.88992238f},
-std::array<float,2>{0.941993475f, 0.0851829872f},
-std::array<float,2>{0.0139387352f, 0.141346663f},
-std::array<float,2>{0.797183931f, 0.780014396f},
-std::array<float,2>{0.498580396f, 0.728685021f},
-std::array<float,2>{0.566007316f, 0.342495412f},
-std::array<float,2>{0.073755078f, 0.394239217f},
-std::array<float,2>{0.814314783f, 0.569804847f},
-std::array<float,2>{0.402975291f, 0.955513239f},
-std::array<float,2>{0.50020504f, 0.0595321357f},
-std::array<float,2>{0.349949509f, 0.237435699f},
-std::array<float,2>{0.732171357f, 0.859898567f},
-std::array<float,2>{0.181897268f, 0.645974934f},
-std::array<float,2>{0.928076923f, 0.267275363f},
-std::array<float,2>{0.452676773f, 0.370296776f},
-std::array<float,2>{0.619947791f, 0.70451194f},
-std::array<float,2>{0.0340684466f, 0.783428013f},
-std::array<float,2>{0.766098857f, 0.175338566f},
-std::array<float,2>{0.195117503f, 0.109224305f},
-std::array<float,2>{0.991398573f, 0.923537254f},
-std::array<float,2>{0.259441555f, 0.558290601f},
-std::array<float,2>{0.625471473f, 0.442702621f},
-std::array<float,2>{0.174900129f, 0.415499419f},
-std::array<float,2>{0.930904329f, 0.60994792f},
-std::array<float,2>{0.35413897f, 0.977963209f},
-std::array<float,2>{0.720336497f, 0.000558283471f},
-std::array<float,2>{0.39145726f, 0.213527337f},
-std::array<float,2>{0.513036609f, 0.814945817f},
-std::array<float,2>{0.0634809881f, 0.670413077f},
-std::array<float,2>{0.823162377f, 0.291046351f},
-std::array<float,2>{0.253972143f, 0.333583325f},
-std::array<float,2>{0.640162051f, 0.724617541f},
-std::array<float,2>{0.2008899f, 0.76650548f},
-std::array<float,2>{0.999240577f, 0.152803555f},
-std::array<float,2>{0.0393783636f, 0.0866469368f},
-std::array<float,2>{0.778767705f, 0.878850281f},
-std::array<float,2>{0.442685306f, 0.509016514f},
-std::array<float,2>{0.613546371f, 0.487174511f},
-std::array<float,2>{0.113571264f, 0.274370223f},
-std::array<float,2>{0.851684451f, 0.655449092f},
-std::array<float,2>{0.407891244f, 0.873994052f},
-std::array<float,2>{0.552911282f, 0.247270212f},
-std::array<float,2>{0.338831216f, 0.0516676381f},
-std::array<float,2>{0.695444822f, 0.96318996f},
-std::array<float,2>{0.138898402f, 0.570417583f},
-std::array<float,2>{0.886917531f, 0.399373889f},
-std::array<float,2>{0.491403461f, 0.445825338f},
-std::array<float,2>{0.57069838f, 0.552951038f},
-std::array<float,2>{0.00712712575f, 0.931809068f},
-std::array<float,2>{0.805444121f, 0.0990513861f},
-std::array<float,2>{0.241118118f, 0.184988022f},
-std::array<float,2>{0.947588146f, 0.791319609f},
-std::array<float,2>{0.312397569f, 0.713662148f},
-std::array<float,2>{0.662014246f, 0.366075635f},
-std::array<float,2>{0.213881209f, 0.351820439f},
-std::array<float,2>{0.969072163f, 0.690632701f},
-std::array<float,2>{0.268388718f, 0.800698638f},
-std::array<float,2>{0.643314898f, 0.170716614f},
-std::array<float,2>{0.456465334f, 0.118209705f},
-std::array<float,2>{0.609265447f, 0.918628037f},
-std::array<float,2>{0.0584474318f, 0.536994398f},
-std::array<float,2>{0.759949386f, 0.463649094f},
-std::array<float,2>{0.365216434f, 0.386360854f},
-std::array<float,2>{0.737436116f, 0.5901407f},
-std::array<float,2>{0.161439344f, 0.951984406f},
-std::array<float,2>{0.920505822f, 0.0365742035f},
-std::array<float,2>{0.0912925079f, 0.228198826f},
-std::array<float,2>{0.831482887f, 0.855113089f},
-std::array<float,2>{0.376389533f, 0.625855386f},
-std::array<float,2>{0.517271161f, 0.252877474f},
-std::array<float,2>{0.0268748403f, 0.482671261f},
-std::array<float,2>{0.796179831f, 0.521939576f},
-std::array<float,2>{0.483449459f, 0.892430663f},
-std::array<float,2>{0.585193098f, 0.0744431764f},
-std::array<float,2>{0.294239968f, 0.136698037f},
-std::array<float,2>{0.682825148f, 0.756161928f},
-std::array<float,2>{0.231396884f, 0.743579447f},
-std::array<float,2>{0.966909826f, 0.321907163f},
-std::array<float,2>{0.423992604f, 0.30361557f},
-std::array<float,2>{0.543880105f, 0.675980628f},
-std::array<float,2>{0.107761458f, 0.832226396f},
-std::array<float,2>{0.866212189f, 0.201500103f},
-std::array<float,2>{0.143656462f, 0.0215644874f},
-std::array<float,2>{0.902225971f, 0.99782747f},
-std::array<float,2>{0.323063403f, 0.606078267f},
-std::array<float,2>{0.704108298f, 0.436588407f},
-std::array<float,2>{0.148916006f, 0.48975718f},
-std::array<float,2>{0.890846312f, 0.514409363f},
-std::array<float,2>{0.318871945f, 0.88034451f},
-std::array<float,2>{0.715536475f, 0.0913016871f},
-std::array<float,2>{0.430180073f, 0.152243212f},
-std::array<float,2>{0.538881361f, 0.771872878f},
-std::array<float,2>{0.0990734696f, 0.721945286f},
-std::array<float,2>{0.869133711f, 0.329685181f},
-std::array<float,2>{0.287220269f, 0.293541491f},
-std::array<float,2>{0.673969805f, 0.665005326f},
-std::array<float,2>{0.219477415f, 0.81860584f},
-std::array<float,2>{0.955745399f, 0.21674706f},
-std::array<float,2>{0.0192994419f, 0.00589596713f},
-std::array<float,2>{0.786263108f, 0.983301461f},
-std::array<float,2>{0.472585559f, 0.61382705f},
-std::array<float,2>{0.585967243f, 0.42004621f},
-std::array<float,2>{0.0837135091f, 0.361798018f},
-std::array<float,2>{0.842738092f, 0.7161569f},
-std::array<float,2>{0.384153515f, 0.795576632f},
-std::array<float,2>{0.530937135f, 0.182303518f},
-std::array<float,2>{0.374638766f, 0.0974140838f},
-std::array<float,2>{0.747254133f, 0.936873555f},
-std::array<float,2>{0.170777425f, 0.54759562f},
-std::array<float,2>{0.913124502f, 0.452678323f},
-std::array<float,2>{0.467211932f, 0.405301809f},
-std::array<float,2>{0.598544955f, 0.576460242f},
-std::array<float,2>{0.0535016693f, 0.965481818f},
-std::array<float,2>{0.750937581f, 0.0492019318f},
-std::array<float,2>{0.208296031f, 0.243338615f},
-std::array<float,2>{0.977819741f, 0.868804157f},
-std::array<float,2>{0.280448616f, 0.650775313f},
-std::array<float,2>{0.651439905f, 0.278089702f},
-std::array<float,2>{0.248715729f, 0.254635155f},
-std::array<float,2>{0.93837142f, 0.630483866f},
-std::array<float,2>{0.302332491f, 0.858059406f},
-std::array<float,2>{0.667963386f, 0.232263207f},
-std::array<float,2>{0.495679557f, 0.0337545164f},
-std::array<float,2>{0.567332745f, 0.946718454f},
-std::array<float,2>{0.0116185341f, 0.589234412f},
-std::array<float,2>{0.804525375f, 0.387579143f},
-std::array<float,2>{0.331692398f, 0.466939956f},
-std::array<float,2>{0.687684f, 0.533017337f},
-std::array<float,2>{0.12858966f, 0.916578054f},
-std::array<float,2>{0.8787449f, 0.121450424f},
-std::array<float,2>{0.120648712f, 0.165831953f},
-std::array<float,2>{0.843945801f, 0.804382145f},
-std::array<float,2>{0.41808176f, 0.691964388f},
-std::array<float,2>{0.559986115f, 0.356424063f},
-std::array<float,2>{0.0364666581f, 0.431072295f},
-std::array<float,2>{0.770252287f, 0.602803469f},
-std::array<float,2>{0.447423041f, 0.992230535f},
-std::array<float,2>{0.624362469f, 0.0174051933f},
-std::array<float,2>{0.264778793f, 0.19638139f},
-std::array<float,2>{0.629347503f, 0.831714332f},
-std::array<float,2>{0.190712824f, 0.675287843f},
-std::array<float,2>{0.987500727f, 0.297866821f},
-std::array<float,2>{0.398878783f, 0.326013178f},
-std::array<float,2>{0.506266117f, 0.748692572f},
-std::array<float,2>{0.0746887922f, 0.751788735f},
-std::array<float,2>{0.817585349f, 0.140105367f},
-std::array<float,2>{0.185836494f, 0.0725628212f},
-std::array<float,2>{0.923603356f, 0.896319926f},
-std::array<float,2>{0.346013874f, 0.515877843f},
-std::array<float,2>{0.730103076f, 0.479180992f},
-std::array<float,2>{0.199148253f, 0.375280529f},
-std::array<float,2>{0.99587518f, 0.583586454f},
-std::array<float,2>{0.250730246f, 0.940469205f},
-std::array<float,2>{0.634435296f, 0.0418655686f},
-std::array<float,2>{0.438362211f, 0.223544553f},
-std::array<float,2>{0.609514892f, 0.848769128f},
-std::array<float,2>{0.0463235043f, 0.640513897f},
-std::array<float,2>{0.776270747f, 0.263655573f},
-std::array<float,2>{0.358347267f, 0.350796551f},
-std::array<float,2>{0.725571454f, 0.699739933f},
-std::array<float,2>{0.17735374f, 0.805079877f},
-std::array<float,2>{0.935306609f, 0.157661334f},
-std::array<float,2>{0.0685738921f, 0.114083514f},
-std::array<float,2>{0.827722013f, 0.90833348f},
-std::array<float,2>{0.398168474f, 0.543565571f},
-std::array<float,2>{0.510622799f, 0.453529477f},
-std::array<float,2>{0.00185608666f, 0.308514953f},
-std::array<float,2>{0.811335146f, 0.679937482f},
-std::array<float,2>{0.488262057f, 0.840670526f},
-std::array<float,2>{0.576714039f, 0.190196022f},
-std::array<float,2>{0.305319756f, 0.0284968559f},
-std::array<float,2>{0.659054458f, 0.986246765f},
-std::array<float,2>{0.237300918f, 0.597160816f},
-std::array<float,2>{0.951009274f, 0.425167173f},
-std::array<float,2>{0.410415739f, 0.470232874f},
-std::array<float,2>{0.549877048f, 0.530032814f},
-std::array<float,2>{0.11103382f, 0.902194321f},
-std::array<float,2>{0.856985688f, 0.0657552481f},
-std::array<float,2>{0.134445027f, 0.131986648f},
-std::array<float,2>{0.883114517f, 0.758344412f},
-std::array<float,2>{0.342738152f, 0.740281343f},
-std::array<float,2>{0.699975133f, 0.319878787f},
-std::array<float,2>{0.156879395f, 0.337963223f},
-std::array<float,2>{0.916524231f, 0.731608212f},
-std::array<float,2>{0.360912263f, 0.776470244f},
-std::array<float,2>{0.741626859f, 0.147254184f},
-std::array<float,2>{0.382364303f, 0.0783275366f},
-std::array<float,2>{0.522846043f, 0.884142458f},
-std::array<float,2>{0.0866444558f, 0.506276011f},
-std::array<float,2>{0.833289504f, 0.495675683f},
-std::array<float,2>{0.27279222f, 0.411830664f},
-std::array<float,2>{0.648276687f, 0.622698367f},
-std::array<float,2>{0.21538879f, 0.97206682f},
-std::array<float,2>{0.974379122f, 0.00973958429f},
-std::array<float,2>{0.0609859787f, 0.204215363f},
-std::array<float,2>{0.764153183f, 0.822736263f},
-std::array<float,2>{0.459821761f, 0.65921104f},
-std::array<float,2>{0.604932785f, 0.289015919f},
-std::array<float,2>{0.102933183f, 0.441023469f},
-std::array<float,2>{0.86081171f, 0.558872879f},
-std::array<float,2>{0.425940573f, 0.927393734f},
-std::array<float,2>{0.541684747f, 0.104414664f},
-std::array<float,2>{0.326694369f, 0.177004412f},
-std::array<float,2>{0.710525274f, 0.787521124f},
-std::array<float,2>{0.146675244f, 0.709075034f},
-std::array<float,2>{0.905462503f, 0.374661058f},
-std::array<float,2>{0.480446607f, 0.273221701f},
-std::array<float,2>{0.581432104f, 0.643682361f},
-std::array<float,2>{0.0304301269f, 0.867106497f},
-std::array<float,2>{0.789890409f, 0.238880783f},
-std::array<float,2>{0.229071155f, 0.0569974892f},
-std::array<float,2>{0.962243974f, 0.95940876f},
-std::array<float,2>{0.289501935f, 0.56573683f},
-std::array<float,2>{0.685799599f, 0.398306072f},
-std::array<float,2>{0.204363167f, 0.473440886f},
-std::array<float,2>{0.981942356f, 0.523808062f},
-std::array<float,2>{0.27415365f, 0.904843867f},
-std::array<float,2>{0.652961612f, 0.0670928061f},
-std::array<float,2>{0.463473767f, 0.126587972f},
-std::array<float,2>{0.597183228f, 0.763180196f},
-std::array<float,2>{0.0490751006f, 0.735334992f},
-std::array<float,2>{0.756937146f, 0.31630075f},
-std::array<float,2>{0.36943078f, 0.311772078f},
-std::array<float,2>{0.74236542f, 0.684947491f},
-std::array<float,2>{0.16417931f, 0.8371225f},
-std::array<float,2>{0.906379819f, 0.19365783f},
-std::array<float,2>{0.0800054222f, 0.0267716236f},
-std::array<float,2>{0.839296997f, 0.990731776f},
-std::array<float,2>{0.388211697f, 0.5993402f},
-std::array<float,2>{0.524165154f, 0.427632749f},
-std::array<float,2>{0.0222713482f, 0.34472239f},
-std::array<float,2>{0.78375107f, 0.699038565f},
-std::array<float,2>{0.475111634f, 0.811801434f},
-std::array<float,2>{0.591066599f, 0.164058819f},
-std::array<float,2>{0.283451885f, 0.112143517f},
-std::array<float,2>{0.677132487f, 0.911775529f},
-std::array<float,2>{0.224314302f, 0.541166246f},
-std::array<float,2>{0.957220018f, 0.459600717f},
-std::array<float,2>{0.435362369f, 0.382012784f},
-std::array<float,2>{0.532658041f, 0.578317642f},
-std::array<float,2>{0.0942811221f, 0.943228006f},
-std::array<float,2>{0.873815298f, 0.0465866551f},
-std::array<float,2>{0.15315707f, 0.221173659f},
-std::array<float,2>{0.896207869f, 0.844691098f},
-std::array<float,2>{0.312918484f, 0.633516371f},
-std::array<float,2>{0.71357733f, 0.260829121f},
-std::array<float,2>{0.18118681f, 0.268883318f},
-std::array<float,2>{0.925831556f, 0.646798849f},
-std::array<float,2>{0.348248184f, 0.863067448f},
-std::array<float,2>{0.73305434f, 0.235346362f},
-std::array<float,2>{0.405698448f, 0.0624574684f},
-std::array<float,2>{0.503433645f, 0.954858363f},
-std::array<float,2>{0.0715346336f, 0.568108439f},
-std::array<float,2>{0.815623939f, 0.392185062f},
-std::array<float,2>{0.261263102f, 0.444577128f},
-std::array<float,2>{0.628234684f, 0.555733562f},
-std::array<float,2>{0.192792907f, 0.925461471f},
-std::array<float,2>{0.988913596f, 0.106610037f},
-std::array<float,2>{0.0329318531f, 0.172694162f},
-std::array<float,2>{0.768423796f, 0.78176266f},
-std::array<float,2>{0.44932127f, 0.705805242f},
-std::array<float,2>{0.618542016f, 0.368507653f},
-std::array<float,2>{0.12124303f, 0.407314807f},
-std::array<float,2>{0.850632906f, 0.61833328f},
-std::array<float,2>{0.415276527f, 0.976462007f},
-std::array<float,2>{0.556911886f, 0.0121073043f},
-std::array<float,2>{0.33415857f, 0.207658187f},
-std::array<float,2>{0.695130944f, 0.826469123f},
-std::array<float,2>{0.132639393f, 0.663756073f},
-std::array<float,2>{0.879740775f, 0.284657776f},
-std::array<float,2>{0.497420013f, 0.340529054f},
-std::array<float,2>{0.563978791f, 0.727727056f},
-std::array<float,2>{0.0126953674f, 0.777516544f},
-std::array<float,2>{0.798891485f, 0.143547431f},
-std::array<float,2>{0.242374688f, 0.0832798108f},
-std::array<float,2>{0.943460643f, 0.888164282f},
-std::array<float,2>{0.297073096f, 0.500793874f},
-std::array<float,2>{0.671661139f, 0.496248007f},
-std::array<float,2>{0.137786239f, 0.40163219f},
-std::array<float,2>{0.889946699f, 0.573349357f},
-std::array<float,2>{0.337615103f, 0.962658882f},
-std::array<float,2>{0.697388828f, 0.0532571934f},
-std::array<float,2>{0.408449858f, 0.249358043f},
-std::array<float,2>{0.551350117f, 0.872687519f},
-std::array<float,2>{0.117037289f, 0.653839409f},
-std::array<float,2>{0.854456425f, 0.276927173f},
-std::array<float,2>{0.308697969f, 0.364088148f},
-std::array<float,2>{0.662553728f, 0.71127218f},
-std::array<float,2>{0.239066869f, 0.789796412f},
-std::array<float,2>{0.9467659f, 0.185552165f},
-std::array<float,2>{0.00491517549f, 0.100166097f},
-std::array<float,2>{0.807604551f, 0.9304353f},
-std::array<float,2>{0.489048362f, 0.551815689f},
-std::array<float,2>{0.573269367f, 0.44828707f},
-std::array<float,2>{0.0649745539f, 0.28934902f},
-std::array<float,2>{0.822122991f, 0.668636739f},
-std::array<float,2>{0.392782658f, 0.813779473f},
-std::array<float,2>{0.515211642f, 0.21278277f},
-std::array<float,2>{0.3526721f, 0.00207303325f},
-std::array<float,2>{0.722042084f, 0.979045391f},
-std::array<float,2>{0.172673076f, 0.61176008f},
-std::array<float,2>{0.932246089f, 0.416863203f},
-std::array<float,2>{0.445279598f, 0.484430939f},
-std::array<float,2>{0.616697729f, 0.51131922f},
-std::array<float,2>{0.0422423705f, 0.875508249f},
-std::array<float,2>{0.780279815f, 0.0879677385f},
-std::array<float,2>{0.203099474f, 0.154677376f},
-std::array<float,2>{0.997627854f, 0.769020557f},
-std::array<float,2>{0.256028116f, 0.723239183f},
-std::array<float,2>{0.637574077f, 0.334474355f},
-std::array<float,2>{0.232769787f, 0.323601067f},
-std::array<float,2>{0.966134787f, 0.745793223f},
-std::array<float,2>{0.294950128f, 0.754227221f},
-std::array<float,2>{0.680349767f, 0.134374708f},
-std::array<float,2>{0.482297897f, 0.0773155838f},
-std::array<float,2>{0.583876014f, 0.892761886f},
-std::array<float,2>{0.0239829738f, 0.520766914f},
-std::array<float,2>{0.793293893f, 0.480579287f},
-std::array<float,2>{0.32058987f, 0.434307963f},
-std::array<float,2>{0.706977069f, 0.607679009f},
-std::array<float,2>{0.141852424f, 0.998393238f},
-std::array<float,2>{0.899923861f, 0.019774342f},
-std::array<float,2>{0.106800452f, 0.199547872f},
-std::array<float,2>{0.864047348f, 0.835179627f},
-std::array<float,2>{0.423178166f, 0.677799165f},
-std::array<float,2>{0.546679497f, 0.302317172f},
-std::array<float,2>{0.05609769f, 0.462692559f},
-std::array<float,2>{0.759742618f, 0.538381815f},
-std::array<float,2>{0.453401148f, 0.920019925f},
-std::array<float,2>{0.605944574f, 0.120868884f},
-std::array<float,2>{0.265898585f, 0.169826046f},
-std::array<float,2>{0.642182052f, 0.797428608f},
-std::array<float,2>{0.211033434f, 0.687752008f},
-std::array<float,2>{0.972421467f, 0.353524387f},
-std::array<float,2>{0.377182961f, 0.250469774f},
-std::array<float,2>{0.519275963f, 0.6278795f},
-std::array<float,2>{0.0937051922f, 0.851848423f},
-std::array<float,2>{0.829488337f, 0.228636399f},
-std::array<float,2>{0.163754687f, 0.0390162058f},
-std::array<float,2>{0.918706656f, 0.949756384f},
-std::array<float,2>{0.36574474f, 0.592679918f},
-std::array<float,2>{0.736263514f, 0.383416146f},
-std::array<float,2>{0.169851229f, 0.451139897f},
-std::array<float,2>{0.911230981f, 0.550173044f},
-std::array<float,2>{0.372527748f, 0.93518728f},
-std::array<float,2>{0.749983132f, 0.0944243148f},
-std::array<float,2>{0.38609308f, 0.179974809f},
-std::array<float,2>{0.527845621f, 0.793345511f},
-std::array<float,2>{0.0846757665f, 0.717638135f},
-std::array<float,2>{0.8403216f, 0.361193776f},
-std::array<float,2>{0.278384894f, 0.281144559f},
-std::array<float,2>{0.650098503f, 0.649231195f},
-std::array<float,2>{0.209836856f, 0.87008214f},
-std::array<float,2>{0.980208874f, 0.245400786f},
-std::array<float,2>{0.0526694469f, 0.0473301485f},
-std::array<float,2>{0.752726614f, 0.966986597f},
-std::array<float,2>{0.466709346f, 0.575572968f},
-std::array<float,2>{0.600397229f, 0.402540416f},
-std::array<float,2>{0.101146504f, 0.33058387f},
-std::array<float,2>{0.86959511f, 0.719388783f},
-std::array<float,2>{0.433157623f, 0.77103591f},
-std::array<float,2>{0.535946667f, 0.148861498f},
-std::array<float,2>{0.317015588f, 0.0933089703f},
-std::array<float,2>{0.71852541f, 0.880964339f},
-std::array<float,2>{0.152265683f, 0.512400091f},
-std::array<float,2>{0.893594325f, 0.49135223f},
-std::array<float,2>{0.470096171f, 0.418638974f},
-std::array<float,2>{0.589444757f, 0.616389751f},
-std::array<float,2>{0.0167493299f, 0.981827796f},
-std::array<float,2>{0.787581682f, 0.0051594167f},
-std::array<float,2>{0.221220866f, 0.21762988f},
-std::array<float,2>{0.953418076f, 0.818166673f},
-std::array<float,2>{0.286097974f, 0.666538894f},
-std::array<float,2>{0.673826158f, 0.296784908f},
-std::array<float,2>{0.188591331f, 0.300184846f},
-std::array<float,2>{0.984611809f, 0.673173547f},
-std::array<float,2>{0.262659103f, 0.82988286f},
-std::array<float,2>{0.631168544f, 0.197758794f},
-std::array<float,2>{0.446326673f, 0.0176773798f},
-std::array<float,2>{0.622120559f, 0.99520731f},
-std::array<float,2>{0.038822338f, 0.605377913f},
-std::array<float,2>{0.772672236f, 0.431812286f},
-std::array<float,2>{0.344941646f, 0.477817386f},
-std::array<float,2>{0.728131115f, 0.519056797f},
-std::array<float,2>{0.185525492f, 0.898228824f},
-std::array<float,2>{0.925105214f, 0.0712691844f},
-std::array<float,2>{0.0779819116f, 0.138450712f},
-std::array<float,2>{0.819377124f, 0.753253877f},
-std::array<float,2>{0.401079684f, 0.746715784f},
-std::array<float,2>{0.503911614f, 0.327286005f},
-std::array<float,2>{0.00954937283f, 0.389598548f},
-std::array<float,2>{0.801524758f, 0.58697027f},
-std::array<float,2>{0.492339879f, 0.947771549f},
-std::array<float,2>{0.568981886f, 0.0323054641f},
-std::array<float,2>{0.303426862f, 0.233430505f},
-std::array<float,2>{0.665522873f, 0.855647922f},
-std::array<float,2>{0.246675745f, 0.632152379f},
-std::array<float,2>{0.940608561f, 0.256566197f},
-std::array<float,2>{0.420783907f, 0.35877651f},
-std::array<float,2>{0.560663879f, 0.693687856f},
-std::array<float,2>{0.117949165f, 0.802297473f},
-std::array<float,2>{0.847224712f, 0.166681185f},
-std::array<float,2>{0.125757203f, 0.124716066f},
-std::array<float,2>{0.875189543f, 0.915472031f},
-std::array<float,2>{0.329785734f, 0.53500706f},
-std::array<float,2>{0.690505922f, 0.465194702f},
-std::array<float,2>{0.235266283f, 0.423523903f},
-std::array<float,2>{0.952624559f, 0.593887746f},
-std::array<float,2>{0.307531238f, 0.98755461f},
-std::array<float,2>{0.657529533f, 0.0309204962f},
-std::array<float,2>{0.485477626f, 0.188160196f},
-std::array<float,2>{0.575434685f, 0.843494475f},
-std::array<float,2>{0.00334664178f, 0.683263659f},
-std::array<float,2>{0.809714735f, 0.305851609f},
-std::array<float,2>{0.340542763f, 0.316734225f},
-std::array<float,2>{0.702495098f, 0.738312066f},
-std::array<float,2>{0.136241049f, 0.761476219f},
-std::array<float,2>{0.886030018f, 0.130704612f},
-std::array<float,2>{0.11268919f, 0.0634731352f},
-std::array<float,2>{0.859036088f, 0.899080694f},
-std::array<float,2>{0.414033353f, 0.528224349f},
-std::array<float,2>{0.548230469f, 0.472425431f},
-std::array<float,2>{0.043952506f, 0.264126897f},
-std::array<float,2>{0.775181472f, 0.636816561f},
-std::array<float,2>{0.440533906f, 0.850656867f},
-std::array<float,2>{0.613050818f, 0.226176262f},
-std::array<float,2>{0.252553761f, 0.0394653045f},
-std::array<float,2>{0.635066867f, 0.937598109f},
-std::array<float,2>{0.195358068f, 0.584424913f},
-std::array<float,2>{0.993806243f, 0.378526419f},
-std::array<float,2>{0.396316141f, 0.456697106f},
-std::array<float,2>{0.508604109f, 0.5450055f},
-std::array<float,2>{0.0669753179f, 0.907495975f},
-std::array<float,2>{0.824569106f, 0.116836458f},
-std::array<float,2>{0.178355992f, 0.159357578f},
-std::array<float,2>{0.936967373f, 0.807634354f},
-std::array<float,2>{0.356513053f, 0.703014314f},
-std::array<float,2>{0.724269331f, 0.348451138f},
-std::array<float,2>{0.144816145f, 0.371660352f},
-std::array<float,2>{0.902879953f, 0.708269f},
-std::array<float,2>{0.324237198f, 0.786942065f},
-std::array<float,2>{0.708285272f, 0.178464532f},
-std::array<float,2>{0.429180413f, 0.1026472f},
-std::array<float,2>{0.540092051f, 0.927828074f},
-std::array<float,2>{0.104637615f, 0.561494112f},
-std::array<float,2>{0.86159879f, 0.439196795f},
-std::array<float,2>{0.292388737f, 0.394965768f},
-std::array<float,2>{0.68484956f, 0.564116776f},
-std::array<float,2>{0.226996765f, 0.958978713f},
-std::array<float,2>{0.963632762f, 0.0555007532f},
-std::array<float,2>{0.0292627253f, 0.240375474f},
-std::array<float,2>{0.791995823f, 0.86448741f},
-std::array<float,2>{0.477260828f, 0.64232868f},
-std::array<float,2>{0.579321623f, 0.271076053f},
-std::array<float,2>{0.0893140882f, 0.492454946f},
-std::array<float,2>{0.834533691f, 0.504907072f},
-std::array<float,2>{0.379966795f, 0.88524729f},
-std::array<float,2>{0.52068454f, 0.0807446539f},
-std::array<float,2>{0.363054842f, 0.144792691f},
-std::array<float,2>{0.738372803f, 0.773663759f},
-std::array<float,2>{0.159864277f, 0.733885646f},
-std::array<float,2>{0.915165842f, 0.337555826f},
-std::array<float,2>{0.457407326f, 0.285211265f},
-std::array<float,2>{0.602132142f, 0.656910002f},
-std::array<float,2>{0.0590593964f, 0.82206881f},
-std::array<float,2>{0.76216042f, 0.207024053f},
-std::array<float,2>{0.218168616f, 0.0115964506f},
-std::array<float,2>{0.97612828f, 0.969339788f},
-std::array<float,2>{0.269805342f, 0.623088479f},
-std::array<float,2>{0.645636559f, 0.413345754f},
-std::array<float,2>{0.245024681f, 0.497594059f},
-std::array<float,2>{0.942658365f, 0.501268268f},
-std::array<float,2>{0.299034625f, 0.887166977f},
-std::array<float,2>{0.668040037f, 0.0828151256f},
-std::array<float,2>{0.499957263f, 0.143652603f},
-std::array<float,2>{0.564546824f, 0.778422534f},
-std::array<float,2>{0.0148028042f, 0.726647019f},
-std::array<float,2>{0.797879994f, 0.341212898f},
-std::array<float,2>{0.332494378f, 0.283644825f},
-std::array<float,2>{0.693116903f, 0.662606895f},
-std::array<float,2>{0.129219234f, 0.827883244f},
-std::array<float,2>{0.882651925f, 0.208861217f},
-std::array<float,2>{0.124330677f, 0.0130233588f},
-std::array<float,2>{0.848941565f, 0.975145876f},
-std::array<float,2>{0.417810917f, 0.617904305f},
-std::array<float,2>{0.555437565f, 0.406464309f},
-std::array<float,2>{0.0349939317f, 0.367682755f},
-std::array<float,2>{0.767089546f, 0.706244469f},
-std::array<float,2>{0.451403707f, 0.783173442f},
-std::array<float,2>{0.620553374f, 0.173008844f},
-std::array<float,2>{0.257903248f, 0.105748788f},
-std::array<float,2>{0.626752138f, 0.924550474f},
-std::array<float,2>{0.19372417f, 0.554746568f},
-std::array<float,2>{0.990982175f, 0.44344905f},
-std::array<float,2>{0.403816938f, 0.390820533f},
-std::array<float,2>{0.501568854f, 0.56731683f},
-std::array<float,2>{0.0724298581f, 0.954101562f},
-std::array<float,2>{0.813370347f, 0.0612280667f},
-std::array<float,2>{0.183170199f, 0.235627636f},
-std::array<float,2>{0.929378331f, 0.862050354f},
-std::array<float,2>{0.350620866f, 0.648042083f},
-std::array<float,2>{0.731211364f, 0.267683566f},
-std::array<float,2>{0.154723749f, 0.260649562f},
-std::array<float,2>{0.897334874f, 0.634188771f},
-std::array<float,2>{0.314887434f, 0.84520942f},
-std::array<float,2>{0.711215317f, 0.222379535f},
-std::array<float,2>{0.436517864f, 0.0455554873f},
-std::array<float,2>{0.534095645f, 0.941565216f},
-std::array<float,2>{0.0957982466f, 0.580030024f},
-std::array<float,2>{0.871312141f, 0.381639063f},
-std::array<float,2>{0.282739222f, 0.460831612f},
-std::array<float,2>{0.677767336f, 0.542968571f},
-std::array<float,2>{0.22488378f, 0.910460413f},
-std::array<float,2>{0.959713459f, 0.11313346f},
-std::array<float,2>{0.02129687f, 0.162198514f},
-std::array<float,2>{0.782686055f, 0.8113392f},
-std::array<float,2>{0.473821461f, 0.697314262f},
-std::array<float,2>{0.59332031f, 0.345298976f},
-std::array<float,2>{0.0818259493f, 0.426495433f},
-std::array<float,2>{0.837682068f, 0.598003685f},
-std::array<float,2>{0.389815032f, 0.991788149f},
-std::array<float,2>{0.526733518f, 0.0254055392f},
-std::array<float,2>{0.36907059f, 0.195110977f},
-std::array<float,2>{0.744469762f, 0.836648762f},
-std::array<float,2>{0.167631835f, 0.684202135f},
-std::array<float,2>{0.909992576f, 0.310949922f},
-std::array<float,2>{0.462564081f, 0.315255672f},
-std::array<float,2>{0.593784571f, 0.735610068f},
-std::array<float,2>{0.0475542322f, 0.762625277f},
-std::array<float,2>{0.754666984f, 0.125972182f},
-std::array<float,2>{0.205148101f, 0.0677310973f},
-std::array<float,2>{0.983571649f, 0.905988932f},
-std::array<float,2>{0.275838852f, 0.525272787f},
-std::array<float,2>{0.65476501f, 0.474361688f},
-std::array<float,2>{0.160691693f, 0.384290874f},
-std::array<float,2>{0.92180407f, 0.593454838f},
-std::array<float,2>{0.363772422f, 0.950723588f},
-std::array<float,2>{0.736731946f, 0.0376439616f},
-std::array<float,2>{0.375124156f, 0.229716077f},
-std::array<float,2>{0.515882492f, 0.852684438f},
-std::array<float,2>{0.0907762125f, 0.628107309f},
-std::array<float,2>{0.830213606f, 0.25156799f},
-std::array<float,2>{0.268949419f, 0.354995996f},
-std::array<float,2>{0.644249976f, 0.688707232f},
-std::array<float,2>{0.212923184f, 0.797869623f},
-std::array<float,2>{0.969772398f, 0.168172687f},
-std::array<float,2>{0.0575911403f, 0.119473808f},
-std::array<float,2>{0.761171579f, 0.921206951f},
-std::array<float,2>{0.455206692f, 0.537701905f},
-std::array<float,2>{0.607908487f, 0.460975647f},
-std::array<float,2>{0.108542629f, 0.30142194f},
-std::array<float,2>{0.865485728f, 0.679241478f},
-std::array<float,2>{0.42493546f, 0.834686041f},
-std::array<float,2>{0.544856369f, 0.200991794f},
-std::array<float,2>{0.323309481f, 0.0213896539f},
-std::array<float,2>{0.70317626f, 0.999145925f},
-std::array<float,2>{0.142774701f, 0.60887605f},
-std::array<float,2>{0.900949895f, 0.435302317f},
-std::array<float,2>{0.48280108f, 0.482179195f},
-std::array<float,2>{0.584312856f, 0.520087004f},
-std::array<float,2>{0.0262254011f, 0.894502163f},
-std::array<float,2>{0.795540273f, 0.0762892365f},
-std::array<float,2>{0.23179242f, 0.13361156f},
-std::array<float,2>{0.967848778f, 0.755175352f},
-std::array<float,2>{0.293398172f, 0.744546652f},
-std::array<float,2>{0.681797087f, 0.322818071f},
-std::array<float,2>{0.200054839f, 0.335506886f},
-std::array<float,2>{0.998830438f, 0.723736346f},
-std::array<float,2>{0.255014777f, 0.76799202f},
-std::array<float,2>{0.638987184f, 0.155446425f},
-std::array<float,2>{0.441479653f, 0.0897449851f},
-std::array<float,2>{0.614294946f, 0.876078725f},
-std::array<float,2>{0.0407248177f, 0.509818435f},
-std::array<float,2>{0.778054535f, 0.485433549f},
-std::array<float,2>{0.35507977f, 0.417177737f},
-std::array<float,2>{0.718750238f, 0.612946272f},
-std::array<float,2>{0.1741983f, 0.980334103f},
-std::array<float,2>{0.930053473f, 0.0030279432f},
-std::array<float,2>{0.0625219643f, 0.211062059f},
-std::array<float,2>{0.823510051f, 0.812648952f},
-std::array<float,2>{0.392550528f, 0.669618607f},
-std::array<float,2>{0.512391686f, 0.290078402f},
-std::array<float,2>{0.00657923846f, 0.447344244f},
-std::array<float,2>{0.806238592f, 0.551329374f},
-std::array<float,2>{0.490454137f, 0.931473672f},
-std::array<float,2>{0.571964383f, 0.101288937f},
-std::array<float,2>{0.310832083f, 0.187192336f},
-std::array<float,2>{0.660182476f, 0.79060632f},
-std::array<float,2>{0.241774186f, 0.712280989f},
-std::array<float,2>{0.948660254f, 0.365084201f},
-std::array<float,2>{0.406893581f, 0.27570051f},
-std::array<float,2>{0.553763449f, 0.652614474f},
-std::array<float,2>{0.114930913f, 0.871722937f},
-std::array<float,2>{0.853468597f, 0.249011174f},
-std::array<float,2>{0.140413269f, 0.0546293855f},
-std::array<float,2>{0.88822639f, 0.961607158f},
-std::array<float,2>{0.339159518f, 0.573213756f},
-std::array<float,2>{0.696528912f, 0.401005954f},
-std::array<float,2>{0.127389044f, 0.465928793f},
-std::array<float,2>{0.877304673f, 0.534015536f},
-std::array<float,2>{0.330558777f, 0.914938688f},
-std::array<float,2>{0.688942492f, 0.123774007f},
-std::array<float,2>{0.419059008f, 0.16729942f},
-std::array<float,2>{0.558998704f, 0.801108062f},
-std::array<float,2>{0.119609095f, 0.694882631f},
-std::array<float,2>{0.845289528f, 0.357954949f},
-std::array<float,2>{0.300985962f, 0.257566392f},
-std::array<float,2>{0.666018844f, 0.630937576f},
-std::array<float,2>{0.249974146f, 0.857001603f},
-std::array<float,2>{0.938517928f, 0.23303619f},
-std::array<float,2>{0.00989815965f, 0.0317185484f},
-std::array<float,2>{0.803108037f, 0.949068546f},
-std::array<float,2>{0.49449724f, 0.586258829f},
-std::array<float,2>{0.567701459f, 0.390236169f},
-std::array<float,2>{0.0756512806f, 0.32700789f},
-std::array<float,2>{0.816975355f, 0.74710083f},
-std::array<float,2>{0.399891943f, 0.752868831f},
-std::array<float,2>{0.507767081f, 0.136984229f},
-std::array<float,2>{0.347523272f, 0.0721307918f},
-std::array<float,2>{0.72886312f, 0.897407472f},
-std::array<float,2>{0.186879173f, 0.517849147f},
-std::array<float,2>{0.922703564f, 0.477184832f},
-std::array<float,2>{0.448869616f, 0.432694793f},
-std::array<float,2>{0.62392658f, 0.603739083f},
-std::array<float,2>{0.0356870592f, 0.994213462f},
-std::array<float,2>{0.770604432f, 0.0187929124f},
-std::array<float,2>{0.190160662f, 0.198407426f},
-std::array<float,2>{0.987144768f, 0.82882756f},
-std::array<float,2>{0.26375699f, 0.672711492f},
-std::array<float,2>{0.630036175f, 0.299407989f},
-std::array<float,2>{0.219994396f, 0.295591056f},
-std::array<float,2>{0.956919312f, 0.667585433f},
-std::array<float,2>{0.288296789f, 0.816541016f},
-std::array<float,2>{0.675202668f, 0.218709961f},
-std::array<float,2>{0.471574455f, 0.00452960934f},
-std::array<float,2>{0.587470353f, 0.980954289f},
-std::array<float,2>{0.0182937663f, 0.615332961f},
-std::array<float,2>{0.785917997f, 0.419351697f},
-std::array<float,2>{0.320001602f, 0.490984052f},
-std::array<float,2>{0.716548681f, 0.513523042f},
-std::array<float,2>{0.149531722f, 0.882067204f},
-std::array<float,2>{0.891627371f, 0.0926432759f},
-std::array<float,2>{0.0985999703f, 0.150090903f},
-std::array<float,2>{0.868005276f, 0.769730091f},
-std::array<float,2>{0.430865467f, 0.720151305f},
-std::array<float,2>{0.537134111f, 0.331685334f},
-std::array<float,2>{0.0546715707f, 0.404227823f},
-std::array<float,2>{0.751574457f, 0.574426949f},
-std::array<float,2>{0.468632191f, 0.96844703f},
-std::array<float,2>{0.598754585f, 0.0480029806f},
-std::array<float,2>{0.279401332f, 0.244571343f},
-std::array<float,2>{0.650955737f, 0.870644391f},
-std::array<float,2>{0.207436934f, 0.650094628f},
-std::array<float,2>{0.976764977f, 0.279830366f},
-std::array<float,2>{0.383708328f, 0.359904408f},
-std::array<float,2>{0.529312193f, 0.718382835f},
-std::array<float,2>{0.0827883407f, 0.794396102f},
-std::array<float,2>{0.843300998f, 0.180824772f},
-std::array<float,2>{0.170932874f, 0.0955251083f},
-std::array<float,2>{0.912337661f, 0.934032559f},
-std::array<float,2>{0.373851717f, 0.54934001f},
-std::array<float,2>{0.746650875f, 0.449982077f},
-std::array<float,2>{0.216367796f, 0.412427366f},
-std::array<float,2>{0.973420501f, 0.624701977f},
-std::array<float,2>{0.271914929f, 0.970128298f},
-std::array<float,2>{0.647081435f, 0.00997153763f},
-std::array<float,2>{0.460362226f, 0.205590695f},
-std::array<float,2>{0.604159772f, 0.82067132f},
-std::array<float,2>{0.0620215461f, 0.657255709f},
-std::array<float,2>{0.765334129f, 0.28686896f},
-std::array<float,2>{0.359491795f, 0.336679012f},
-std::array<float,2>{0.740829051f, 0.733158648f},
-std::array<float,2>{0.157932669f, 0.774626553f},
-std::array<float,2>{0.917237461f, 0.146225512f},
-std::array<float,2>{0.0877794027f, 0.0812849253f},
-std::array<float,2>{0.832904816f, 0.886404872f},
-std::array<float,2>{0.381124824f, 0.504442811f},
-std::array<float,2>{0.521788776f, 0.493682712f},
-std::array<float,2>{0.0299911089f, 0.270407051f},
-std::array<float,2>{0.790249825f, 0.641480029f},
-std::array<float,2>{0.47942403f, 0.864027739f},
-std::array<float,2>{0.580388844f, 0.241513014f},
-std::array<float,2>{0.290965319f, 0.0563392192f},
-std::array<float,2>{0.687397182f, 0.957792461f},
-std::array<float,2>{0.230447084f, 0.56292218f},
-std::array<float,2>{0.961738884f, 0.396250814f},
-std::array<float,2>{0.427048743f, 0.438319564f},
-std::array<float,2>{0.542367458f, 0.562444031f},
-std::array<float,2>{0.102355011f, 0.928931653f},
-std::array<float,2>{0.85953182f, 0.101574227f},
-std::array<float,2>{0.148147926f, 0.178807482f},
-std::array<float,2>{0.904846668f, 0.785569608f},
-std::array<float,2>{0.328047782f, 0.707077444f},
-std::array<float,2>{0.709115028f, 0.372495055f},
-std::array<float,2>{0.175987303f, 0.348890156f},
-std::array<float,2>{0.934213459f, 0.701329529f},
-std::array<float,2>{0.358975857f, 0.806884468f},
-std::array<float,2>{0.726079702f, 0.158459321f},
-std::array<float,2>{0.396621257f, 0.115512162f},
-std::array<float,2>{0.511189818f, 0.907044172f},
-std::array<float,2>{0.0698095188f, 0.546103835f},
-std::array<float,2>{0.826296747f, 0.455599904f},
-std::array<float,2>{0.251499712f, 0.37731117f},
-std::array<float,2>{0.633668125f, 0.585064352f},
-std::array<float,2>{0.197300941f, 0.938541949f},
-std::array<float,2>{0.994978189f, 0.0409741402f},
-std::array<float,2>{0.0450216495f, 0.225239307f},
-std::array<float,2>{0.776569009f, 0.849739194f},
-std::array<float,2>{0.438546062f, 0.638417244f},
-std::array<float,2>{0.611092091f, 0.264948666f},
-std::array<float,2>{0.109566316f, 0.471298695f},
-std::array<float,2>{0.856225908f, 0.529167235f},
-std::array<float,2>{0.412032455f, 0.900176167f},
-std::array<float,2>{0.549800336f, 0.0639973059f},
-std::array<float,2>{0.343096346f, 0.12905477f},
-std::array<float,2>{0.700565875f, 0.760279715f},
-std::array<float,2>{0.133255258f, 0.739725232f},
-std::array<float,2>{0.883966148f, 0.318298191f},
-std::array<float,2>{0.486778259f, 0.305544823f},
-std::array<float,2>{0.577467382f, 0.682552695f},
-std::array<float,2>{0.000247120799f, 0.842562139f},
-std::array<float,2>{0.812270761f, 0.189117864f},
-std::array<float,2>{0.237448275f, 0.0293695293f},
-std::array<float,2>{0.949361205f, 0.986474395f},
-std::array<float,2>{0.306231648f, 0.595247269f},
-std::array<float,2>{0.6592381f, 0.422632098f},
-std::array<float,2>{0.191515476f, 0.442302495f},
-std::array<float,2>{0.990166247f, 0.557206154f},
-std::array<float,2>{0.260424554f, 0.922270477f},
-std::array<float,2>{0.627928436f, 0.107730851f},
-std::array<float,2>{0.450930953f, 0.174626306f},
-std::array<float,2>{0.617881894f, 0.784719884f},
-std::array<float,2>{0.0321894214f, 0.704082549f},
-std::array<float,2>{0.768845618f, 0.369624227f},
-std::array<float,2>{0.348723114f, 0.265963465f},
-std::array<float,2>{0.733570039f, 0.645222247f},
-std::array<float,2>{0.179935634f, 0.860764444f},
-std::array<float,2>{0.927292228f, 0.237040117f},
-std::array<float,2>{0.0711039081f, 0.0596857481f},
-std::array<float,2>{0.814902902f, 0.956334233f},
-std::array<float,2>{0.405003816f, 0.569046974f},
-std::array<float,2>{0.5022102f, 0.393301815f},
-std::array<float,2>{0.0118810674f, 0.343352169f},
-std::array<float,2>{0.80012536f, 0.730413139f},
-std::array<float,2>{0.496865511f, 0.780894518f},
-std::array<float,2>{0.563450992f, 0.142188638f},
-std::array<float,2>{0.298808664f, 0.0842093751f},
-std::array<float,2>{0.670370162f, 0.888816118f},
-std::array<float,2>{0.24340333f, 0.503470898f},
-std::array<float,2>{0.944514394f, 0.49890551f},
-std::array<float,2>{0.414192885f, 0.409737945f},
-std::array<float,2>{0.557962775f, 0.619683623f},
-std::array<float,2>{0.122874305f, 0.974264026f},
-std::array<float,2>{0.850154459f, 0.0150269549f},
-std::array<float,2>{0.131158516f, 0.210639149f},
-std::array<float,2>{0.880282581f, 0.82531637f},
-std::array<float,2>{0.335181296f, 0.660755277f},
-std::array<float,2>{0.693889558f, 0.28186354f},
-std::array<float,2>{0.165352896f, 0.309616953f},
-std::array<float,2>{0.907615364f, 0.687375963f},
-std::array<float,2>{0.370421529f, 0.838536084f},
-std::array<float,2>{0.744029939f, 0.192007825f},
-std::array<float,2>{0.386725575f, 0.0251832865f},
-std::array<float,2>{0.524813175f, 0.989736795f},
-std::array<float,2>{0.0782684013f, 0.60018146f},
-std::array<float,2>{0.838264465f, 0.429397821f},
-std::array<float,2>{0.274596483f, 0.475152403f},
-std::array<float,2>{0.653463066f, 0.526529074f},
-std::array<float,2>{0.203874588f, 0.904197574f},
-std::array<float,2>{0.980901182f, 0.0689409822f},
-std::array<float,2>{0.0504702963f, 0.127070203f},
-std::array<float,2>{0.75606966f, 0.764800012f},
-std::array<float,2>{0.464063108f, 0.736869872f},
-std::array<float,2>{0.595834196f, 0.312877059f},
-std::array<float,2>{0.0951829851f, 0.379958838f},
-std::array<float,2>{0.874643505f, 0.580172002f},
-std::array<float,2>{0.434527904f, 0.944075584f},
-std::array<float,2>{0.53218323f, 0.0430311821f},
-std::array<float,2>{0.31402269f, 0.218836129f},
-std::array<float,2>{0.714479029f, 0.847248852f},
-std::array<float,2>{0.154031783f, 0.635964274f},
-std::array<float,2>{0.894837201f, 0.258466721f},
-std::array<float,2>{0.476008266f, 0.346483201f},
-std::array<float,2>{0.589923859f, 0.697016358f},
-std::array<float,2>{0.0230586808f, 0.810297549f},
-std::array<float,2>{0.784335554f, 0.161182016f},
-std::array<float,2>{0.222720742f, 0.110121891f},
-std::array<float,2>{0.9583565f, 0.913024187f},
-std::array<float,2>{0.284220397f, 0.539689004f},
-std::array<float,2>{0.676620126f, 0.457619518f},
-std::array<float,2>{0.141540617f, 0.435743749f},
-std::array<float,2>{0.899282277f, 0.606920898f},
-std::array<float,2>{0.321403414f, 0.996291578f},
-std::array<float,2>{0.705321252f, 0.0229843128f},
-std::array<float,2>{0.422712177f, 0.202891305f},
-std::array<float,2>{0.545885623f, 0.833964705f},
-std::array<float,2>{0.106069028f, 0.677612066f},
-std::array<float,2>{0.864428222f, 0.304581344f},
-std::array<float,2>{0.296063244f, 0.320570201f},
-std::array<float,2>{0.68112731f, 0.742711306f},
-std::array<float,2>{0.234127939f, 0.757003546f},
-std::array<float,2>{0.965213537f, 0.134897158f},
-std::array<float,2>{0.0250650831f, 0.0760402605f},
-std::array<float,2>{0.794133544f, 0.891414642f},
-std::array<float,2>{0.481348813f, 0.522705913f},
-std::array<float,2>{0.582595825f, 0.483860284f},
-std::array<float,2>{0.0920612812f, 0.253724754f},
-std::array<float,2>{0.828545988f, 0.626834512f},
-std::array<float,2>{0.378678381f, 0.854433537f},
-std::array<float,2>{0.518545628f, 0.227087602f},
-std::array<float,2>{0.366476297f, 0.0352046229f},
-std::array<float,2>{0.7347911f, 0.952202797f},
-std::array<float,2>{0.162617162f, 0.591793299f},
-std::array<float,2>{0.919456124f, 0.384943426f},
-std::array<float,2>{0.454807431f, 0.46477139f},
-std::array<float,2>{0.606687307f, 0.535769284f},
-std::array<float,2>{0.0552344508f, 0.919229686f},
-std::array<float,2>{0.758594036f, 0.11781992f},
-std::array<float,2>{0.211952388f, 0.171212196f},
-std::array<float,2>{0.970812082f, 0.799735963f},
-std::array<float,2>{0.266721874f, 0.690131724f},
-std::array<float,2>{0.64143616f, 0.353026569f},
-std::array<float,2>{0.240081206f, 0.366290569f},
-std::array<float,2>{0.945713818f, 0.714519858f},
-std::array<float,2>{0.309967935f, 0.792611241f},
-std::array<float,2>{0.663291097f, 0.183927655f},
-std::array<float,2>{0.489870876f, 0.0980127826f},
-std::array<float,2>{0.573023319f, 0.932741284f},
-std::array<float,2>{0.00472043082f, 0.554544032f},
-std::array<float,2>{0.807655811f, 0.446513474f},
-std::array<float,2>{0.336425275f, 0.399572134f},
-std::array<float,2>{0.698360205f, 0.571687758f},
-std::array<float,2>{0.136998266f, 0.964313209f},
-std::array<float,2>{0.888991416f, 0.052475512f},
-std::array<float,2>{0.115739614f, 0.246315837f},
-std::array<float,2>{0.854823232f, 0.874392867f},
-std::array<float,2>{0.410130441f, 0.654316127f},
-std::array<float,2>{0.552219868f, 0.274841607f},
-std::array<float,2>{0.041024901f, 0.488041431f},
-std::array<float,2>{0.780243933f, 0.508490741f},
-std::array<float,2>{0.443398863f, 0.877430677f},
-std::array<float,2>{0.615454376f, 0.0871107727f},
-std::array<float,2>{0.257438511f, 0.153754145f},
-std::array<float,2>{0.638034582f, 0.767558634f},
-std::array<float,2>{0.201203465f, 0.726363897f},
-std::array<float,2>{0.996674597f, 0.332597524f},
-std::array<float,2>{0.394486666f, 0.29274714f},
-std::array<float,2>{0.514595807f, 0.671715498f},
-std::array<float,2>{0.0655922666f, 0.816073895f},
-std::array<float,2>{0.820984662f, 0.21441187f},
-std::array<float,2>{0.173057064f, 0.00171672413f},
-std::array<float,2>{0.933074594f, 0.97716558f},
-std::array<float,2>{0.352137774f, 0.611288905f},
-std::array<float,2>{0.721394658f, 0.415004671f},
-std::array<float,2>{0.183710828f, 0.480393112f},
-std::array<float,2>{0.923906922f, 0.516917646f},
-std::array<float,2>{0.343800485f, 0.895474315f},
-std::array<float,2>{0.727338672f, 0.073562257f},
-std::array<float,2>{0.401486099f, 0.138684973f},
-std::array<float,2>{0.504987478f, 0.750886559f},
-std::array<float,2>{0.0767117143f, 0.749488413f},
-std::array<float,2>{0.81839478f, 0.324375182f},
-std::array<float,2>{0.263143271f, 0.297385961f},
-std::array<float,2>{0.632420659f, 0.674511611f},
-std::array<float,2>{0.18814142f, 0.830539644f},
-std::array<float,2>{0.985760808f, 0.19609496f},
-std::array<float,2>{0.0372051932f, 0.0163124632f},
-std::array<float,2>{0.772000313f, 0.993537128f},
-std::array<float,2>{0.446131706f, 0.601636589f},
-std::array<float,2>{0.621747792f, 0.429697067f},
-std::array<float,2>{0.119081579f, 0.356963962f},
-std::array<float,2>{0.846401334f, 0.692423105f},
-std::array<float,2>{0.420960993f, 0.80299747f},
-std::array<float,2>{0.561761022f, 0.164655402f},
-std::array<float,2>{0.328534961f, 0.122670881f},
-std::array<float,2>{0.689936757f, 0.917836905f},
-std::array<float,2>{0.12654078f, 0.531410396f},
-std::array<float,2>{0.876294136f, 0.468499869f},
-std::array<float,2>{0.493916214f, 0.388056904f},
-std::array<float,2>{0.569373846f, 0.588428855f},
-std::array<float,2>{0.0086643286f, 0.945862234f},
-std::array<float,2>{0.802586079f, 0.0348596685f},
-std::array<float,2>{0.247289434f, 0.230982184f},
-std::array<float,2>{0.94004935f, 0.859040678f},
-std::array<float,2>{0.304571509f, 0.629658401f},
-std::array<float,2>{0.664297283f, 0.25532794f},
-std::array<float,2>{0.210867688f, 0.279090196f},
-std::array<float,2>{0.97944814f, 0.651536763f},
-std::array<float,2>{0.277811229f, 0.868106186f},
-std::array<float,2>{0.648814559f, 0.242485479f},
-std::array<float,2>{0.46485889f, 0.0504393689f},
-std::array<float,2>{0.601434052f, 0.966589808f},
-std::array<float,2>{0.0514829494f, 0.577556133f},
-std::array<float,2>{0.753065407f, 0.404942542f},
-std::array<float,2>{0.371892065f, 0.451754302f},
-std::array<float,2>{0.748329997f, 0.548645556f},
-std::array<float,2>{0.168887526f, 0.936413348f},
-std::array<float,2>{0.910473585f, 0.0958015546f},
-std::array<float,2>{0.0851935595f, 0.182819664f},
-std::array<float,2>{0.841255069f, 0.796404421f},
-std::array<float,2>{0.384953707f, 0.715013623f},
-std::array<float,2>{0.528435588f, 0.363016576f},
-std::array<float,2>{0.0156825129f, 0.421136856f},
-std::array<float,2>{0.78868717f, 0.615085006f},
-std::array<float,2>{0.469677448f, 0.983963788f},
-std::array<float,2>{0.588515341f, 0.00708418433f},
-std::array<float,2>{0.28635779f, 0.214920551f},
-std::array<float,2>{0.672189355f, 0.819474697f},
-std::array<float,2>{0.222119451f, 0.665087581f},
-std::array<float,2>{0.954130471f, 0.294895798f},
-std::array<float,2>{0.432542682f, 0.328579813f},
-std::array<float,2>{0.536857367f, 0.720969677f},
-std::array<float,2>{0.100045651f, 0.77265358f},
-std::array<float,2>{0.870618939f, 0.151053265f},
-std::array<float,2>{0.150966927f, 0.0902554989f},
-std::array<float,2>{0.893498778f, 0.879064977f},
-std::array<float,2>{0.317775309f, 0.515608788f},
-std::array<float,2>{0.716822684f, 0.489101022f},
-std::array<float,2>{0.228241906f, 0.396998495f},
-std::array<float,2>{0.964315355f, 0.564577281f},
-std::array<float,2>{0.291414291f, 0.960189641f},
-std::array<float,2>{0.684315681f, 0.0577922501f},
-std::array<float,2>{0.477573514f, 0.239391968f},
-std::array<float,2>{0.578532934f, 0.865843296f},
-std::array<float,2>{0.0278393347f, 0.643184066f},
-std::array<float,2>{0.791228354f, 0.271730095f},
-std::array<float,2>{0.325626761f, 0.373681962f},
-std::array<float,2>{0.707146108f, 0.71052444f},
-std::array<float,2>{0.146147013f, 0.788350344f},
-std::array<float,2>{0.903772414f, 0.175821349f},
-std::array<float,2>{0.104036838f, 0.104718253f},
-std::array<float,2>{0.862730622f, 0.926326275f},
-std::array<float,2>{0.428637445f, 0.560373664f},
-std::array<float,2>{0.539494336f, 0.439706326f},
-std::array<float,2>{0.06030114f, 0.287705004f},
-std::array<float,2>{0.763596594f, 0.659103036f},
-std::array<float,2>{0.45813337f, 0.823907316f},
-std::array<float,2>{0.602950752f, 0.203165889f},
-std::array<float,2>{0.27130723f, 0.00846272707f},
-std::array<float,2>{0.645339489f, 0.971374571f},
-std::array<float,2>{0.217157617f, 0.621343255f},
-std::array<float,2>{0.974758863f, 0.410291076f},
-std::array<float,2>{0.379510194f, 0.494363725f},
-std::array<float,2>{0.52029705f, 0.507804811f},
-std::array<float,2>{0.0880541429f, 0.883771002f},
-std::array<float,2>{0.835136771f, 0.079308942f},
-std::array<float,2>{0.158830345f, 0.147563934f},
-std::array<float,2>{0.914800942f, 0.7756598f},
-std::array<float,2>{0.361633956f, 0.731263459f},
-std::array<float,2>{0.73983568f, 0.339735717f},
-std::array<float,2>{0.135062724f, 0.318927258f},
-std::array<float,2>{0.885138392f, 0.742004693f},
-std::array<float,2>{0.341333836f, 0.759589851f},
-std::array<float,2>{0.701532543f, 0.131128371f},
-std::array<float,2>{0.413051546f, 0.06470678f},
-std::array<float,2>{0.547093213f, 0.900944769f},
-std::array<float,2>{0.112244323f, 0.531120062f},
-std::array<float,2>{0.857899308f, 0.469506711f},
-std::array<float,2>{0.308442414f, 0.424318463f},
-std::array<float,2>{0.656663895f, 0.596464515f},
-std::array<float,2>{0.235488296f, 0.984443545f},
-std::array<float,2>{0.951424003f, 0.0273477249f},
-std::array<float,2>{0.00229022861f, 0.191124111f},
-std::array<float,2>{0.808730423f, 0.840930045f},
-std::array<float,2>{0.4844096f, 0.681029081f},
-std::array<float,2>{0.574807763f, 0.30721882f},
-std::array<float,2>{0.0678245798f, 0.454758167f},
-std::array<float,2>{0.825914085f, 0.544458091f},
-std::array<float,2>{0.394863814f, 0.909265637f},
-std::array<float,2>{0.509502947f, 0.114868402f},
-std::array<float,2>{0.356140286f, 0.156504005f},
-std::array<float,2>{0.722935081f, 0.806454182f},
-std::array<float,2>{0.179459706f, 0.700935364f},
-std::array<float,2>{0.936333597f, 0.35035944f},
-std::array<float,2>{0.440086335f, 0.262249321f},
-std::array<float,2>{0.611458123f, 0.639595807f},
-std::array<float,2>{0.0432350561f, 0.848243296f},
-std::array<float,2>{0.773746192f, 0.22387135f},
-std::array<float,2>{0.197061107f, 0.0420895033f},
-std::array<float,2>{0.992358387f, 0.939871311f},
-std::array<float,2>{0.253025085f, 0.58265233f},
-std::array<float,2>{0.636447668f, 0.376060426f},
-std::array<float,2>{0.228740439f, 0.439681083f},
-std::array<float,2>{0.962845564f, 0.560059428f},
-std::array<float,2>{0.289925396f, 0.926604569f},
-std::array<float,2>{0.686383247f, 0.104887292f},
-std::array<float,2>{0.479563385f, 0.176222071f},
-std::array<float,2>{0.581839025f, 0.788197577f},
-std::array<float,2>{0.0312316082f, 0.710703492f},
-std::array<float,2>{0.789078593f, 0.373872519f},
-std::array<float,2>{0.326288819f, 0.271714211f},
-std::array<float,2>{0.710131347f, 0.643340349f},
-std::array<float,2>{0.147144839f, 0.866025448f},
-std::array<float,2>{0.906121552f, 0.239603624f},
-std::array<float,2>{0.103308119f, 0.0578910895f},
-std::array<float,2>{0.860896409f, 0.96038121f},
-std::array<float,2>{0.426589876f, 0.564915895f},
-std::array<float,2>{0.541358948f, 0.397376865f},
-std::array<float,2>{0.0610940866f, 0.339396596f},
-std::array<float,2>{0.764278352f, 0.731119573f},
-std::array<float,2>{0.459041059f, 0.775633812f},
-std::array<float,2>{0.605214298f, 0.147914454f},
-std::array<float,2>{0.273043424f, 0.0794660524f},
-std::array<float,2>{0.647711396f, 0.883312464f},
-std::array<float,2>{0.21503517f, 0.507421434f},
-std::array<float,2>{0.973960221f, 0.49457562f},
-std::array<float,2>{0.382130891f, 0.410631269f},
-std::array<float,2>{0.523016989f, 0.621256351f},
-std::array<float,2>{0.0861253589f, 0.971572876f},
-std::array<float,2>{0.83375597f, 0.0087463418f},
-std::array<float,2>{0.15662545f, 0.203611031f},
-std::array<float,2>{0.916355014f, 0.824027538f},
-std::array<float,2>{0.360529602f, 0.658803344f},
-std::array<float,2>{0.742186069f, 0.287991822f},
-std::array<float,2>{0.134208679f, 0.307402313f},
-std::array<float,2>{0.883725703f, 0.680823565f},
-std::array<float,2>{0.341833264f, 0.841243565f},
-std::array<float,2>{0.699300468f, 0.19127883f},
-std::array<float,2>{0.410723716f, 0.02775166f},
-std::array<float,2>{0.550759494f, 0.984620214f},
-std::array<float,2>{0.110776789f, 0.596357465f},
-std::array<float,2>{0.856933594f, 0.424750745f},
-std::array<float,2>{0.304738581f, 0.469326824f},
-std::array<float,2>{0.658535898f, 0.530765057f},
-std::array<float,2>{0.236748055f, 0.901190102f},
-std::array<float,2>{0.950394571f, 0.0646431148f},
-std::array<float,2>{0.00144079037f, 0.130928129f},
-std::array<float,2>{0.810698509f, 0.759287f},
-std::array<float,2>{0.487388283f, 0.741737723f},
-std::array<float,2>{0.576608419f, 0.319218248f},
-std::array<float,2>{0.0693192258f, 0.376407295f},
-std::array<float,2>{0.827256978f, 0.582950294f},
-std::array<float,2>{0.397925079f, 0.939465344f},
-std::array<float,2>{0.509777009f, 0.0422859266f},
-std::array<float,2>{0.357459337f, 0.223990291f},
-std::array<float,2>{0.724744797f, 0.848423779f},
-std::array<float,2>{0.177037388f, 0.639284492f},
-std::array<float,2>{0.934957325f, 0.262679666f},
-std::array<float,2>{0.437541097f, 0.350218445f},
-std::array<float,2>{0.610255897f, 0.7007882f},
-std::array<float,2>{0.0468372665f, 0.806168199f},
-std::array<float,2>{0.775644243f, 0.15643087f},
-std::array<float,2>{0.198419929f, 0.115180209f},
-std::array<float,2>{0.995409369f, 0.909617484f},
-std::array<float,2>{0.25001055f, 0.544799149f},
-std::array<float,2>{0.633922994f, 0.45484975f},
-std::array<float,2>{0.186127067f, 0.429948866f},
-std::array<float,2>{0.923149526f, 0.60193342f},
-std::array<float,2>{0.346457511f, 0.99321717f},
-std::array<float,2>{0.729598343f, 0.016440399f},
-std::array<float,2>{0.39930892f, 0.196008563f},
-std::array<float,2>{0.506688178f, 0.830102623f},
-std::array<float,2>{0.0749650151f, 0.674699724f},
-std::array<float,2>{0.818328023f, 0.297845393f},
-std::array<float,2>{0.265434682f, 0.324673355f},
-std::array<float,2>{0.629484832f, 0.749163806f},
-std::array<float,2>{0.191278026f, 0.750526309f},
-std::array<float,2>{0.988101125f, 0.138943091f},
-std::array<float,2>{0.0368734933f, 0.0733269826f},
-std::array<float,2>{0.769976139f, 0.895083427f},
-std::array<float,2>{0.448113948f, 0.516634226f},
-std::array<float,2>{0.624599695f, 0.48011601f},
-std::array<float,2>{0.120601542f, 0.254905373f},
-std::array<float,2>{0.844593763f, 0.629638135f},
-std::array<float,2>{0.418598145f, 0.859145939f},
-std::array<float,2>{0.560170472f, 0.231425494f},
-std::array<float,2>{0.331215471f, 0.0349613652f},
-std::array<float,2>{0.688088179f, 0.946072102f},
-std::array<float,2>{0.128220662f, 0.588667393f},
-std::array<float,2>{0.878179371f, 0.387825221f},
-std::array<float,2>{0.495230258f, 0.468611807f},
-std::array<float,2>{0.566764474f, 0.531532109f},
-std::array<float,2>{0.011045902f, 0.91748637f},
-std::array<float,2>{0.804009378f, 0.122953251f},
-std::array<float,2>{0.24816139f, 0.164897859f},
-std::array<float,2>{0.937721848f, 0.802741826f},
-std::array<float,2>{0.301811993f, 0.69270128f},
-std::array<float,2>{0.667470574f, 0.357305288f},
-std::array<float,2>{0.208735019f, 0.363053352f},
-std::array<float,2>{0.978322446f, 0.715174496f},
-std::array<float,2>{0.280817509f, 0.796720922f},
-std::array<float,2>{0.65197587f, 0.182883993f},
-std::array<float,2>{0.46762085f, 0.0960654542f},
-std::array<float,2>{0.597672939f, 0.936178625f},
-std::array<float,2>{0.0531699881f, 0.548499942f},
-std::array<float,2>{0.750029087f, 0.451948822f},
-std::array<float,2>{0.374457777f, 0.405195177f},
-std::array<float,2>{0.747758806f, 0.5772385f},
-std::array<float,2>{0.170079023f, 0.966356695f},
-std::array<float,2>{0.91370976f, 0.0507334508f},
-std::array<float,2>{0.08305417f, 0.242245167f},
-std::array<float,2>{0.842188418f, 0.867783725f},
-std::array<float,2>{0.384621322f, 0.651797354f},
-std::array<float,2>{0.530385077f, 0.278874069f},
-std::array<float,2>{0.0187283903f, 0.488838881f},
-std::array<float,2>{0.786694467f, 0.51537782f},
-std::array<float,2>{0.471781999f, 0.879282773f},
-std::array<float,2>{0.58659035f, 0.0898926333f},
-std::array<float,2>{0.288033247f, 0.151255473f},
-std::array<float,2>{0.674593151f, 0.772848248f},
-std::array<float,2>{0.218997732f, 0.720928371f},
-std::array<float,2>{0.955515027f, 0.32824403f},
-std::array<float,2>{0.430056542f, 0.294613719f},
-std::array<float,2>{0.538130581f, 0.66547668f},
-std::array<float,2>{0.0996083543f, 0.819780529f},
-std::array<float,2>{0.868191183f, 0.215268329f},
-std::array<float,2>{0.149409994f, 0.00685448386f},
-std::array<float,2>{0.891179383f, 0.984311521f},
-std::array<float,2>{0.318424106f, 0.614935279f},
-std::array<float,2>{0.714987695f, 0.421285093f},
-std::array<float,2>{0.144064978f, 0.483598471f},
-std::array<float,2>{0.9015975f, 0.522550404f},
-std::array<float,2>{0.322541714f, 0.891314566f},
-std::array<float,2>{0.704945982f, 0.0757476464f},
-std::array<float,2>{0.424523354f, 0.135193869f},
-std::array<float,2>{0.543443799f, 0.757282794f},
-std::array<float,2>{0.108134419f, 0.743046761f},
-std::array<float,2>{0.867047131f, 0.320509225f},
-std::array<float,2>{0.294574261f, 0.304254532f},
-std::array<float,2>{0.68332082f, 0.677251399f},
-std::array<float,2>{0.230682328f, 0.833739102f},
-std::array<float,2>{0.96750164f, 0.202855051f},
-std::array<float,2>{0.0266479142f, 0.0232648961f},
-std::array<float,2>{0.796475708f, 0.996503234f},
-std::array<float,2>{0.484017491f, 0.606646597f},
-std::array<float,2>{0.585469544f, 0.435926348f},
-std::array<float,2>{0.09132763f, 0.352543741f},
-std::array<float,2>{0.83188659f, 0.690399468f},
-std::array<float,2>{0.376723886f, 0.799319208f},
-std::array<float,2>{0.516919971f, 0.171111569f},
-std::array<float,2>{0.364461303f, 0.118014552f},
-std::array<float,2>{0.737827957f, 0.918953121f},
-std::array<float,2>{0.161901906f, 0.535923302f},
-std::array<float,2>{0.920013249f, 0.464557648f},
-std::array<float,2>{0.456624538f, 0.385055065f},
-std::array<float,2>{0.608455479f, 0.591359615f},
-std::array<float,2>{0.0578197129f, 0.952450812f},
-std::array<float,2>{0.760591388f, 0.0355273113f},
-std::array<float,2>{0.214560226f, 0.227392912f},
-std::array<float,2>{0.9692927f, 0.85416615f},
-std::array<float,2>{0.26763916f, 0.626517236f},
-std::array<float,2>{0.643027842f, 0.253548861f},
-std::array<float,2>{0.24066855f, 0.274438679f},
-std::array<float,2>{0.948183358f, 0.654677331f},
-std::array<float,2>{0.31158933f, 0.874128222f},
-std::array<float,2>{0.661603212f, 0.246494532f},
-std::array<float,2>{0.491795003f, 0.0525312871f},
-std::array<float,2>{0.571033895f, 0.964106381f},
-std::array<float,2>{0.00779332826f, 0.57142055f},
-std::array<float,2>{0.80513835f, 0.399832517f},
-std::array<float,2>{0.338263392f, 0.446551263f},
-std::array<float,2>{0.695983946f, 0.554249048f},
-std::array<float,2>{0.139436617f, 0.93309921f},
-std::array<float,2>{0.88741529f, 0.0976938605f},
-std::array<float,2>{0.114075668f, 0.18360211f},
-std::array<float,2>{0.852055669f, 0.792839766f},
-std::array<float,2>{0.407492965f, 0.714769959f},
-std::array<float,2>{0.553362131f, 0.366556108f},
-std::array<float,2>{0.0399933234f, 0.414738417f},
-std::array<float,2>{0.778859258f, 0.611060381f},
-std::array<float,2>{0.443193436f, 0.977314293f},
-std::array<float,2>{0.614196539f, 0.00153089152f},
-std::array<float,2>{0.254663736f, 0.214669079f},
-std::array<float,2>{0.639797568f, 0.816215217f},
-std::array<float,2>{0.200229347f, 0.67152375f},
-std::array<float,2>{0.999998212f, 0.292611837f},
-std::array<float,2>{0.390801132f, 0.332956076f},
-std::array<float,2>{0.513195217f, 0.726212442f},
-std::array<float,2>{0.0640973747f, 0.767154336f},
-std::array<float,2>{0.822321892f, 0.153415501f},
-std::array<float,2>{0.175775334f, 0.087371096f},
-std::array<float,2>{0.931483328f, 0.877060592f},
-std::array<float,2>{0.35395202f, 0.508672893f},
-std::array<float,2>{0.72002238f, 0.487865597f},
-std::array<float,2>{0.194386542f, 0.393371403f},
-std::array<float,2>{0.991991401f, 0.569149673f},
-std::array<float,2>{0.259162247f, 0.956154585f},
-std::array<float,2>{0.625624359f, 0.0598181002f},
-std::array<float,2>{0.452211976f, 0.237134174f},
-std::array<float,2>{0.619227827f, 0.860426426f},
-std::array<float,2>{0.0333790369f, 0.645275414f},
-std::array<float,2>{0.766379118f, 0.265868098f},
-std::array<float,2>{0.35027793f, 0.369254321f},
-std::array<float,2>{0.731811821f, 0.703778923f},
-std::array<float,2>{0.182443097f, 0.785070121f},
-std::array<float,2>{0.928522289f, 0.174371049f},
-std::array<float,2>{0.0735286102f, 0.107614629f},
-std::array<float,2>{0.813794196f, 0.921997964f},
-std::array<float,2>{0.402438968f, 0.557534456f},
-std::array<float,2>{0.500899017f, 0.44197455f},
-std::array<float,2>{0.0141963139f, 0.282102287f},
-std::array<float,2>{0.79758209f, 0.660992563f},
-std::array<float,2>{0.498152107f, 0.825650454f},
-std::array<float,2>{0.565762758f, 0.210799798f},
-std::array<float,2>{0.300079703f, 0.0148105277f},
-std::array<float,2>{0.669769347f, 0.974527419f},
-std::array<float,2>{0.245412305f, 0.619964719f},
-std::array<float,2>{0.941583037f, 0.410144418f},
-std::array<float,2>{0.416570783f, 0.498642355f},
-std::array<float,2>{0.556443989f, 0.503696918f},
-std::array<float,2>{0.123556882f, 0.889074743f},
-std::array<float,2>{0.848421574f, 0.0843878016f},
-std::array<float,2>{0.130376294f, 0.142395973f},
-std::array<float,2>{0.881281435f, 0.781036139f},
-std::array<float,2>{0.333389848f, 0.730164945f},
-std::array<float,2>{0.69191426f, 0.343560994f},
-std::array<float,2>{0.166703075f, 0.312653095f},
-std::array<float,2>{0.908798337f, 0.73707521f},
-std::array<float,2>{0.367256045f, 0.765127659f},
-std::array<float,2>{0.746081233f, 0.127312437f},
-std::array<float,2>{0.388937533f, 0.0692059323f},
-std::array<float,2>{0.525990725f, 0.903862417f},
-std::array<float,2>{0.0807881057f, 0.526750863f},
-std::array<float,2>{0.836079895f, 0.475393921f},
-std::array<float,2>{0.276977956f, 0.429636598f},
-std::array<float,2>{0.655903757f, 0.600459099f},
-std::array<float,2>{0.206540972f, 0.989374101f},
-std::array<float,2>{0.982510209f, 0.0250339918f},
-std::array<float,2>{0.0483930856f, 0.19214797f},
-std::array<float,2>{0.75571388f, 0.838741004f},
-std::array<float,2>{0.461267769f, 0.687114954f},
-std::array<float,2>{0.594869912f, 0.310011417f},
-std::array<float,2>{0.0972002f, 0.457811952f},
-std::array<float,2>{0.87251699f, 0.540032923f},
-std::array<float,2>{0.436951816f, 0.912609816f},
-std::array<float,2>{0.534861505f, 0.109885491f},
-std::array<float,2>{0.31544745f, 0.161524251f},
-std::array<float,2>{0.712173343f, 0.810463965f},
-std::array<float,2>{0.155380547f, 0.697220743f},
-std::array<float,2>{0.898423374f, 0.346244305f},
-std::array<float,2>{0.473412722f, 0.258735776f},
-std::array<float,2>{0.592741668f, 0.636051476f},
-std::array<float,2>{0.0198295843f, 0.847615719f},
-std::array<float,2>{0.781792223f, 0.219090044f},
-std::array<float,2>{0.22603415f, 0.0432137735f},
-std::array<float,2>{0.960432529f, 0.944163203f},
-std::array<float,2>{0.281850278f, 0.580429316f},
-std::array<float,2>{0.678846955f, 0.380240053f},
-std::array<float,2>{0.218458503f, 0.493920624f},
-std::array<float,2>{0.975593448f, 0.50469929f},
-std::array<float,2>{0.270133227f, 0.886510789f},
-std::array<float,2>{0.646243811f, 0.0814458877f},
-std::array<float,2>{0.457825333f, 0.146427289f},
-std::array<float,2>{0.60172981f, 0.77475059f},
-std::array<float,2>{0.059280578f, 0.732959449f},
-std::array<float,2>{0.762605906f, 0.336446643f},
-std::array<float,2>{0.362743795f, 0.286625683f},
-std::array<float,2>{0.738795102f, 0.657614827f},
-std::array<float,2>{0.159446657f, 0.820366979f},
-std::array<float,2>{0.915762424f, 0.205945566f},
-std::array<float,2>{0.0895136446f, 0.0100799482f},
-std::array<float,2>{0.834252417f, 0.969740033f},
-std::array<float,2>{0.38082853f, 0.624823511f},
-std::array<float,2>{0.520998359f, 0.412176549f},
-std::array<float,2>{0.0283841938f, 0.372284293f},
-std::array<float,2>{0.792610288f, 0.70735842f},
-std::array<float,2>{0.476753771f, 0.785212696f},
-std::array<float,2>{0.579600155f, 0.179190174f},
-std::array<float,2>{0.292728662f, 0.101888537f},
-std::array<float,2>{0.685366571f, 0.92906034f},
-std::array<float,2>{0.227517679f, 0.562025487f},
-std::array<float,2>{0.9631055f, 0.438094735f},
-std::array<float,2>{0.429615229f, 0.396171212f},
-std::array<float,2>{0.540846348f, 0.562656224f},
-std::array<float,2>{0.105121426f, 0.957597136f},
-std::array<float,2>{0.862293899f, 0.0564772412f},
-std::array<float,2>{0.145303056f, 0.241396606f},
-std::array<float,2>{0.902439535f, 0.863889694f},
-std::array<float,2>{0.324738532f, 0.641311049f},
-std::array<float,2>{0.708652794f, 0.270151794f},
-std::array<float,2>{0.178059131f, 0.264731556f},
-std::array<float,2>{0.937086463f, 0.638635099f},
-std::array<float,2>{0.35725233f, 0.849922419f},
-std::array<float,2>{0.723702192f, 0.225393459f},
-std::array<float,2>{0.3955715f, 0.040631406f},
-std::array<float,2>{0.507881284f, 0.938938439f},
-std::array<float,2>{0.0667914972f, 0.58537674f},
-std::array<float,2>{0.824884355f, 0.376967907f},
-std::array<float,2>{0.251953512f, 0.455955088f},
-std::array<float,2>{0.635389984f, 0.546346188f},
-std::array<float,2>{0.196002245f, 0.906963289f},
-std::array<float,2>{0.993335247f, 0.115439802f},
-std::array<float,2>{0.0445933305f, 0.158392116f},
-std::array<float,2>{0.774586141f, 0.806937337f},
-std::array<float,2>{0.441223711f, 0.701476753f},
-std::array<float,2>{0.612406909f, 0.34864223f},
-std::array<float,2>{0.113151893f, 0.422410011f},
-std::array<float,2>{0.858713448f, 0.595667958f},
-std::array<float,2>{0.413477242f, 0.986815572f},
-std::array<float,2>{0.548380435f, 0.0297054928f},
-std::array<float,2>{0.340074331f, 0.189307109f},
-std::array<float,2>{0.703119755f, 0.84230262f},
-std::array<float,2>{0.136170417f, 0.682338536f},
-std::array<float,2>{0.88666296f, 0.305251837f},
-std::array<float,2>{0.486178935f, 0.317927957f},
-std::array<float,2>{0.575712204f, 0.739418983f},
-std::array<float,2>{0.00355846458f, 0.760500431f},
-std::array<float,2>{0.810436189f, 0.129341617f},
-std::array<float,2>{0.234400928f, 0.0642443746f},
-std::array<float,2>{0.952784717f, 0.899953604f},
-std::array<float,2>{0.307045847f, 0.528917074f},
-std::array<float,2>{0.658021927f, 0.471444637f},
-std::array<float,2>{0.125008807f, 0.390535057f},
-std::array<float,2>{0.875740767f, 0.585952401f},
-std::array<float,2>{0.32924968f, 0.948752165f},
-std::array<float,2>{0.691046f, 0.031487152f},
-std::array<float,2>{0.419921935f, 0.233249709f},
-std::array<float,2>{0.561314344f, 0.857299089f},
-std::array<float,2>{0.117327318f, 0.631281972f},
-std::array<float,2>{0.846862078f, 0.257736355f},
-std::array<float,2>{0.303056121f, 0.358165801f},
-std::array<float,2>{0.665650368f, 0.695269883f},
-std::array<float,2>{0.246221468f, 0.801001966f},
-std::array<float,2>{0.941375315f, 0.16711545f},
-std::array<float,2>{0.00885837432f, 0.123842999f},
-std::array<float,2>{0.800863206f, 0.914769828f},
-std::array<float,2>{0.492865443f, 0.533697844f},
-std::array<float,2>{0.568617702f, 0.466110975f},
-std::array<float,2>{0.077596873f, 0.299774081f},
-std::array<float,2>{0.81984967f, 0.672380149f},
-std::array<float,2>{0.400489658f, 0.829047322f},
-std::array<float,2>{0.504579067f, 0.198725611f},
-std::array<float,2>{0.345474213f, 0.0189773608f},
-std::array<float,2>{0.727814972f, 0.994467437f},
-std::array<float,2>{0.184886009f, 0.603964269f},
-std::array<float,2>{0.925676227f, 0.432878345f},
-std::array<float,2>{0.447199941f, 0.477517307f},
-std::array<float,2>{0.62268573f, 0.517621934f},
-std::array<float,2>{0.0382744819f, 0.897110701f},
-std::array<float,2>{0.773052096f, 0.0718264505f},
-std::array<float,2>{0.189044401f, 0.136728972f},
-std::array<float,2>{0.985048115f, 0.752585351f},
-std::array<float,2>{0.262076199f, 0.747389615f},
-std::array<float,2>{0.631765783f, 0.32670337f},
-std::array<float,2>{0.221055001f, 0.331976801f},
-std::array<float,2>{0.953776538f, 0.719884634f},
-std::array<float,2>{0.285528362f, 0.769949138f},
-std::array<float,2>{0.673090398f, 0.150336981f},
-std::array<float,2>{0.470434159f, 0.0923909321f},
-std::array<float,2>{0.589110553f, 0.882083774f},
-std::array<float,2>{0.0172154605f, 0.513393044f},
-std::array<float,2>{0.787878335f, 0.490952641f},
-std::array<float,2>{0.316689819f, 0.418967634f},
-std::array<float,2>{0.71792376f, 0.615595102f},
-std::array<float,2>{0.151744857f, 0.980492115f},
-std::array<float,2>{0.894450366f, 0.00479871687f},
-std::array<float,2>{0.1006722f, 0.21849677f},
-std::array<float,2>{0.869864106f, 0.816710651f},
-std::array<float,2>{0.433020383f, 0.667933702f},
-std::array<float,2>{0.535630643f, 0.29587096f},
-std::array<float,2>{0.0520348586f, 0.449775517f},
-std::array<float,2>{0.751960099f, 0.549646199f},
-std::array<float,2>{0.466197163f, 0.933800757f},
-std::array<float,2>{0.599813759f, 0.0953588709f},
-std::array<float,2>{0.278951615f, 0.181065887f},
-std::array<float,2>{0.64969331f, 0.79404062f},
-std::array<float,2>{0.20901072f, 0.718535066f},
-std::array<float,2>{0.979747415f, 0.360204399f},
-std::array<float,2>{0.386552304f, 0.280128002f},
-std::array<float,2>{0.52757442f, 0.650165498f},
-std::array<float,2>{0.0844703764f, 0.870981038f},
-std::array<float,2>{0.840757668f, 0.24433437f},
-std::array<float,2>{0.169354632f, 0.0481674448f},
-std::array<float,2>{0.912088811f, 0.968723714f},
-std::array<float,2>{0.373014063f, 0.574593425f},
-std::array<float,2>{0.749040902f, 0.403992712f},
-std::array<float,2>{0.163561568f, 0.461345971f},
-std::array<float,2>{0.918173015f, 0.53805244f},
-std::array<float,2>{0.365634054f, 0.921127379f},
-std::array<float,2>{0.735385597f, 0.119272567f},
-std::array<float,2>{0.377529502f, 0.168268114f},
-std::array<float,2>{0.518588245f, 0.798124194f},
-std::array<float,2>{0.0929960087f, 0.688751876f},
-std::array<float,2>{0.829692125f, 0.355241507f},
-std::array<float,2>{0.266517609f, 0.251931161f},
-std::array<float,2>{0.642061234f, 0.628268003f},
-std::array<float,2>{0.211492538f, 0.852991819f},
-std::array<float,2>{0.971831858f, 0.229752004f},
-std::array<float,2>{0.0565900877f, 0.037971396f},
-std::array<float,2>{0.759052753f, 0.950944543f},
-std::array<float,2>{0.454086363f, 0.593607247f},
-std::array<float,2>{0.606214821f, 0.384575814f},
-std::array<float,2>{0.107169271f, 0.323007643f},
-std::array<float,2>{0.863418519f, 0.744322121f},
-std::array<float,2>{0.423821718f, 0.754949272f},
-std::array<float,2>{0.545926034f, 0.133454353f},
-std::array<float,2>{0.321174145f, 0.076564528f},
-std::array<float,2>{0.706434071f, 0.894232571f},
-std::array<float,2>{0.14218986f, 0.520362675f},
-std::array<float,2>{0.899632752f, 0.482028693f},
-std::array<float,2>{0.481472969f, 0.435418308f},
-std::array<float,2>{0.583067596f, 0.608477473f},
-std::array<float,2>{0.0237380266f, 0.999505997f},
-std::array<float,2>{0.79365766f, 0.0211519618f},
-std::array<float,2>{0.232918262f, 0.20072253f},
-std::array<float,2>{0.966525137f, 0.834842801f},
-std::array<float,2>{0.29578957f, 0.679674029f},
-std::array<float,2>{0.67998296f, 0.301657557f},
-std::array<float,2>{0.202281162f, 0.290389568f},
-std::array<float,2>{0.997294068f, 0.669885159f},
-std::array<float,2>{0.256542236f, 0.81288594f},
-std::array<float,2>{0.637127042f, 0.21132268f},
-std::array<float,2>{0.444707364f, 0.00317902444f},
-std::array<float,2>{0.616921425f, 0.980140686f},
-std::array<float,2>{0.042578876f, 0.613252044f},
-std::array<float,2>{0.78101784f, 0.417458922f},
-std::array<float,2>{0.353400618f, 0.485760003f},
-std::array<float,2>{0.722365022f, 0.510164142f},
-std::array<float,2>{0.172078982f, 0.876340985f},
-std::array<float,2>{0.931911647f, 0.0894512683f},
-std::array<float,2>{0.0645515695f, 0.155757353f},
-std::array<float,2>{0.821392298f, 0.767624021f},
-std::array<float,2>{0.393388659f, 0.723920822f},
-std::array<float,2>{0.514809072f, 0.335861772f},
-std::array<float,2>{0.00575735187f, 0.401366115f},
-std::array<float,2>{0.807088435f, 0.572895944f},
-std::array<float,2>{0.488414556f, 0.961762547f},
-std::array<float,2>{0.573957503f, 0.0544142537f},
-std::array<float,2>{0.309261918f, 0.248751119f},
-std::array<float,2>{0.662871957f, 0.871871471f},
-std::array<float,2>{0.238729388f, 0.652414739f},
-std::array<float,2>{0.947188914f, 0.275504589f},
-std::array<float,2>{0.408811271f, 0.364860415f},
-std::array<float,2>{0.551213443f, 0.711925447f},
-std::array<float,2>{0.116656162f, 0.790873826f},
-std::array<float,2>{0.853836596f, 0.187299833f},
-std::array<float,2>{0.13831003f, 0.101455547f},
-std::array<float,2>{0.890221596f, 0.931305051f},
-std::array<float,2>{0.336949587f, 0.55166167f},
-std::array<float,2>{0.697800159f, 0.447569817f},
-std::array<float,2>{0.242793471f, 0.406564951f},
-std::array<float,2>{0.944146216f, 0.618004501f},
-std::array<float,2>{0.29757005f, 0.975546062f},
-std::array<float,2>{0.67100805f, 0.0128281759f},
-std::array<float,2>{0.497592568f, 0.208702624f},
-std::array<float,2>{0.563743472f, 0.827769339f},
-std::array<float,2>{0.0132527258f, 0.662935853f},
-std::array<float,2>{0.799499571f, 0.283325732f},
-std::array<float,2>{0.334553599f, 0.340890944f},
-std::array<float,2>{0.694777727f, 0.726883769f},
-std::array<float,2>{0.132090598f, 0.778795183f},
-std::array<float,2>{0.87897867f, 0.143845394f},
-std::array<float,2>{0.122039676f, 0.0825835392f},
-std::array<float,2>{0.851324916f, 0.88675797f},
-std::array<float,2>{0.415589899f, 0.501056254f},
-std::array<float,2>{0.557369769f, 0.497957706f},
-std::array<float,2>{0.0325959437f, 0.267919391f},
-std::array<float,2>{0.767934322f, 0.648415864f},
-std::array<float,2>{0.44976899f, 0.862154365f},
-std::array<float,2>{0.61896342f, 0.235396191f},
-std::array<float,2>{0.260981023f, 0.0614096597f},
-std::array<float,2>{0.62861079f, 0.953733623f},
-std::array<float,2>{0.193241328f, 0.567082167f},
-std::array<float,2>{0.988385856f, 0.390979171f},
-std::array<float,2>{0.406113476f, 0.443707108f},
-std::array<float,2>{0.503155947f, 0.555009127f},
-std::array<float,2>{0.0721672922f, 0.924767494f},
-std::array<float,2>{0.816109598f, 0.105538696f},
-std::array<float,2>{0.181061387f, 0.173298314f},
-std::array<float,2>{0.92649287f, 0.782864451f},
-std::array<float,2>{0.34767431f, 0.706340075f},
-std::array<float,2>{0.732528389f, 0.368053913f},
-std::array<float,2>{0.152509823f, 0.345566243f},
-std::array<float,2>{0.895820618f, 0.697577178f},
-std::array<float,2>{0.313032687f, 0.811038017f},
-std::array<float,2>{0.713068843f, 0.162364811f},
-std::array<float,2>{0.434795111f, 0.11285536f},
-std::array<float,2>{0.5329054f, 0.910359204f},
-std::array<float,2>{0.093930617f, 0.542519391f},
-std::array<float,2>{0.873442709f, 0.460515678f},
-std::array<float,2>{0.284006804f, 0.381494939f},
-std::array<float,2>{0.677696705f, 0.57978189f},
-std::array<float,2>{0.223739356f, 0.941821575f},
-std::array<float,2>{0.957623482f, 0.0456700772f},
-std::array<float,2>{0.021724103f, 0.222653911f},
-std::array<float,2>{0.783272624f, 0.844916999f},
-std::array<float,2>{0.474697798f, 0.633935571f},
-std::array<float,2>{0.591382504f, 0.260386318f},
-std::array<float,2>{0.0795724615f, 0.474476755f},
-std::array<float,2>{0.839843452f, 0.525009334f},
-std::array<float,2>{0.388049841f, 0.906149745f},
-std::array<float,2>{0.52361691f, 0.0675322041f},
-std::array<float,2>{0.369898796f, 0.12555854f},
-std::array<float,2>{0.742914259f, 0.762401283f},
-std::array<float,2>{0.164735451f, 0.735583484f},
-std::array<float,2>{0.907136738f, 0.315140933f},
-std::array<float,2>{0.463256329f, 0.31063512f},
-std::array<float,2>{0.596826017f, 0.68434602f},
-std::array<float,2>{0.0496517606f, 0.836826205f},
-std::array<float,2>{0.757560253f, 0.194901988f},
-std::array<float,2>{0.205064759f, 0.0258596819f},
-std::array<float,2>{0.98173815f, 0.992065907f},
-std::array<float,2>{0.273787141f, 0.597783983f},
-std::array<float,2>{0.652532995f, 0.42670849f},
-std::array<float,2>{0.238119498f, 0.472229689f},
-std::array<float,2>{0.950011373f, 0.52799207f},
-std::array<float,2>{0.306137323f, 0.899398565f},
-std::array<float,2>{0.659963906f, 0.0631199926f},
-std::array<float,2>{0.486931711f, 0.130390376f},
-std::array<float,2>{0.577741563f, 0.761401474f},
-std::array<float,2>{0.000769817154f, 0.73875773f},
-std::array<float,2>{0.811934471f, 0.316592127f},
-std::array<float,2>{0.34364441f, 0.306120962f},
-std::array<float,2>{0.700818002f, 0.683561504f},
-std::array<float,2>{0.133327767f, 0.843710065f},
-std::array<float,2>{0.884360194f, 0.188285872f},
-std::array<float,2>{0.109937869f, 0.0311319176f},
-std::array<float,2>{0.855830193f, 0.98754096f},
-std::array<float,2>{0.411578715f, 0.594032049f},
-std::array<float,2>{0.548946857f, 0.423638463f},
-std::array<float,2>{0.0454422534f, 0.348373443f},
-std::array<float,2>{0.776924431f, 0.702673793f},
-std::array<float,2>{0.439438492f, 0.808077753f},
-std::array<float,2>{0.610573947f, 0.159540147f},
-std::array<float,2>{0.251290798f, 0.117075242f},
-std::array<float,2>{0.632905006f, 0.907352507f},
-std::array<float,2>{0.198056027f, 0.545351207f},
-std::array<float,2>{0.994589269f, 0.456867486f},
-std::array<float,2>{0.397314847f, 0.378777236f},
-std::array<float,2>{0.511717498f, 0.584012628f},
-std::array<float,2>{0.070294559f, 0.937792957f},
-std::array<float,2>{0.826939881f, 0.039298173f},
-std::array<float,2>{0.176704541f, 0.22641322f},
-std::array<float,2>{0.934035361f, 0.850922942f},
-std::array<float,2>{0.358844817f, 0.637161851f},
-std::array<float,2>{0.725858331f, 0.263885409f},
-std::array<float,2>{0.147722468f, 0.271365136f},
-std::array<float,2>{0.904757321f, 0.64234817f},
-std::array<float,2>{0.32717815f, 0.864675939f},
-std::array<float,2>{0.70979923f, 0.24062115f},
-std::array<float,2>{0.427254468f, 0.0553338751f},
-std::array<float,2>{0.542668104f, 0.958707511f},
-std::array<float,2>{0.101944536f, 0.56425935f},
-std::array<float,2>{0.860158741f, 0.3947559f},
-std::array<float,2>{0.290139079f, 0.439254701f},
-std::array<float,2>{0.686929286f, 0.561220229f},
-std::array<float,2>{0.229827434f, 0.928043365f},
-std::array<float,2>{0.961354256f, 0.102884509f},
-std::array<float,2>{0.0297597162f, 0.178614691f},
-std::array<float,2>{0.79086113f, 0.786846459f},
-std::array<float,2>{0.478875637f, 0.708164394f},
-std::array<float,2>{0.580718637f, 0.372026503f},
-std::array<float,2>{0.0872862041f, 0.413099796f},
-std::array<float,2>{0.832465827f, 0.623338163f},
-std::array<float,2>{0.381775081f, 0.969546854f},
-std::array<float,2>{0.522188008f, 0.0113366637f},
-std::array<float,2>{0.360043645f, 0.206597596f},
-std::array<float,2>{0.740277469f, 0.821883738f},
-std::array<float,2>{0.157327384f, 0.657201588f},
-std::array<float,2>{0.917635739f, 0.285517752f},
-std::array<float,2>{0.460783273f, 0.337700635f},
-std::array<float,2>{0.603857219f, 0.733439624f},
-std::array<float,2>{0.0618961863f, 0.773761809f},
-std::array<float,2>{0.765025139f, 0.144609734f},
-std::array<float,2>{0.216112688f, 0.0809597149f},
-std::array<float,2>{0.972813368f, 0.884830892f},
-std::array<float,2>{0.272379845f, 0.505305469f},
-std::array<float,2>{0.646915972f, 0.492392987f},
-std::array<float,2>{0.1718629f, 0.402754724f},
-std::array<float,2>{0.912962079f, 0.575391829f},
-std::array<float,2>{0.373404324f, 0.96725148f},
-std::array<float,2>{0.746195138f, 0.0469180793f},
-std::array<float,2>{0.383087337f, 0.245262548f},
-std::array<float,2>{0.529841661f, 0.869671464f},
-std::array<float,2>{0.08240702f, 0.64894253f},
-std::array<float,2>{0.842820883f, 0.280829817f},
-std::array<float,2>{0.27994591f, 0.360893458f},
-std::array<float,2>{0.650476456f, 0.71738708f},
-std::array<float,2>{0.207892507f, 0.793113589f},
-std::array<float,2>{0.97725451f, 0.179692224f},
-std::array<float,2>{0.0540317446f, 0.0945434868f},
-std::array<float,2>{0.751288235f, 0.935354769f},
-std::array<float,2>{0.467851251f, 0.549943984f},
-std::array<float,2>{0.599425733f, 0.450871259f},
-std::array<float,2>{0.0977544859f, 0.296485811f},
-std::array<float,2>{0.867420316f, 0.666920125f},
-std::array<float,2>{0.431227744f, 0.817929924f},
-std::array<float,2>{0.537903607f, 0.217464969f},
-std::array<float,2>{0.319685489f, 0.00504032057f},
-std::array<float,2>{0.716041744f, 0.981514752f},
-std::array<float,2>{0.150163144f, 0.616627276f},
-std::array<float,2>{0.892140865f, 0.418886989f},
-std::array<float,2>{0.470802128f, 0.491498262f},
-std::array<float,2>{0.587059677f, 0.512622058f},
-std::array<float,2>{0.0177752934f, 0.881340384f},
-std::array<float,2>{0.785235405f, 0.0936612412f},
-std::array<float,2>{0.220521465f, 0.148447633f},
-std::array<float,2>{0.95650512f, 0.771311641f},
-std::array<float,2>{0.288900197f, 0.719483078f},
-std::array<float,2>{0.675459027f, 0.330989122f},
-std::array<float,2>{0.189741448f, 0.32762897f},
-std::array<float,2>{0.986371219f, 0.746910632f},
-std::array<float,2>{0.264443964f, 0.753011823f},
-std::array<float,2>{0.630471945f, 0.138202876f},
-std::array<float,2>{0.448421091f, 0.0709688216f},
-std::array<float,2>{0.623068869f, 0.897992015f},
-std::array<float,2>{0.0354863033f, 0.519474804f},
-std::array<float,2>{0.771325171f, 0.477740616f},
-std::array<float,2>{0.347032547f, 0.431952149f},
-std::array<float,2>{0.729050517f, 0.605174124f},
-std::array<float,2>{0.187241375f, 0.995519817f},
-std::array<float,2>{0.922325552f, 0.0179349855f},
-std::array<float,2>{0.0757752433f, 0.198202625f},
-std::array<float,2>{0.816840887f, 0.829627573f},
-std::array<float,2>{0.400016487f, 0.672954679f},
-std::array<float,2>{0.50692904f, 0.299857974f},
-std::array<float,2>{0.0107315863f, 0.465087056f},
-std::array<float,2>{0.803259075f, 0.534833133f},
-std::array<float,2>{0.495007068f, 0.915051997f},
-std::array<float,2>{0.56824404f, 0.124815136f},
-std::array<float,2>{0.301446557f, 0.166841373f},
-std::array<float,2>{0.666705906f, 0.80260998f},
-std::array<float,2>{0.24929361f, 0.693567216f},
-std::array<float,2>{0.939173877f, 0.358462751f},
-std::array<float,2>{0.419710428f, 0.256603539f},
-std::array<float,2>{0.559160173f, 0.631863832f},
-std::array<float,2>{0.12011683f, 0.855916142f},
-std::array<float,2>{0.844830453f, 0.233770147f},
-std::array<float,2>{0.127526641f, 0.0325426571f},
-std::array<float,2>{0.877808332f, 0.948162436f},
-std::array<float,2>{0.330925882f, 0.587346375f},
-std::array<float,2>{0.689117253f, 0.389194012f},
-std::array<float,2>{0.140077427f, 0.448552102f},
-std::array<float,2>{0.888085246f, 0.55221504f},
-std::array<float,2>{0.339564472f, 0.930418372f},
-std::array<float,2>{0.697125614f, 0.100537717f},
-std::array<float,2>{0.406518877f, 0.185995564f},
-std::array<float,2>{0.554402769f, 0.789760113f},
-std::array<float,2>{0.114501134f, 0.711101472f},
-std::array<float,2>{0.852817595f, 0.363904238f},
-std::array<float,2>{0.311200291f, 0.277231157f},
-std::array<float,2>{0.660669506f, 0.654232085f},
-std::array<float,2>{0.241218209f, 0.872845173f},
-std::array<float,2>{0.948935747f, 0.249074936f},
-std::array<float,2>{0.00611576298f, 0.0534725003f},
-std::array<float,2>{0.805790007f, 0.962432981f},
-std::array<float,2>{0.491050452f, 0.573717713f},
-std::array<float,2>{0.571671367f, 0.401539296f},
-std::array<float,2>{0.0633385107f, 0.334745467f},
-std::array<float,2>{0.82380718f, 0.723447859f},
-std::array<float,2>{0.391635627f, 0.768647909f},
-std::array<float,2>{0.512063742f, 0.154491916f},
-std::array<float,2>{0.35476768f, 0.0882371366f},
-std::array<float,2>{0.71924144f, 0.875857472f},
-std::array<float,2>{0.174737439f, 0.511503339f},
-std::array<float,2>{0.930550933f, 0.484756857f},
-std::array<float,2>{0.441986501f, 0.416586727f},
-std::array<float,2>{0.615173697f, 0.611477613f},
-std::array<float,2>{0.0402939916f, 0.979470491f},
-std::array<float,2>{0.777391434f, 0.00234803441f},
-std::array<float,2>{0.199284345f, 0.212577611f},
-std::array<float,2>{0.998111784f, 0.813542604f},
-std::array<float,2>{0.255714178f, 0.66887033f},
-std::array<float,2>{0.639467061f, 0.289295107f},
-std::array<float,2>{0.232225925f, 0.302707225f},
-std::array<float,2>{0.968618631f, 0.678089082f},
-std::array<float,2>{0.293644696f, 0.835434437f},
-std::array<float,2>{0.682205737f, 0.199312687f},
-std::array<float,2>{0.483020186f, 0.0199177172f},
-std::array<float,2>{0.584553242f, 0.998167872f},
-std::array<float,2>{0.0256981924f, 0.607587218f},
-std::array<float,2>{0.795330405f, 0.434474736f},
-std::array<float,2>{0.323833704f, 0.480951846f},
-std::array<float,2>{0.703914523f, 0.520524323f},
-std::array<float,2>{0.143189147f, 0.893039823f},
-std::array<float,2>{0.900645554f, 0.0775329098f},
-std::array<float,2>{0.108959638f, 0.134730965f},
-std::array<float,2>{0.866066575f, 0.75411427f},
-std::array<float,2>{0.425658077f, 0.745978236f},
-std::array<float,2>{0.544407785f, 0.323479325f},
-std::array<float,2>{0.0569029078f, 0.383734941f},
-std::array<float,2>{0.761446416f, 0.592433333f},
-std::array<float,2>{0.455718517f, 0.950044572f},
-std::array<float,2>{0.608005285f, 0.0387853198f},
-std::array<float,2>{0.269101292f, 0.228779867f},
-std::array<float,2>{0.643843234f, 0.851707876f},
-std::array<float,2>{0.213610113f, 0.62768352f},
-std::array<float,2>{0.970307171f, 0.250031263f},
-std::array<float,2>{0.37574479f, 0.353849471f},
-std::array<float,2>{0.516369402f, 0.687732339f},
-std::array<float,2>{0.0902853832f, 0.797701538f},
-std::array<float,2>{0.830569506f, 0.169492543f},
-std::array<float,2>{0.160456002f, 0.120766535f},
-std::array<float,2>{0.920909762f, 0.920220971f},
-std::array<float,2>{0.363462299f, 0.53813374f},
-std::array<float,2>{0.737041175f, 0.462517828f},
-std::array<float,2>{0.205829874f, 0.427317142f},
-std::array<float,2>{0.983914673f, 0.599405468f},
-std::array<float,2>{0.275970727f, 0.991124988f},
-std::array<float,2>{0.655078888f, 0.0265238062f},
-std::array<float,2>{0.462343365f, 0.193501666f},
-std::array<float,2>{0.594687879f, 0.837168872f},
-std::array<float,2>{0.0470687114f, 0.684625864f},
-std::array<float,2>{0.75402391f, 0.311762959f},
-std::array<float,2>{0.368632436f, 0.316059023f},
-std::array<float,2>{0.744924784f, 0.735066295f},
-std::array<float,2>{0.167121485f, 0.76291281f},
-std::array<float,2>{0.9092803f, 0.126764879f},
-std::array<float,2>{0.0813908428f, 0.0673493966f},
-std::array<float,2>{0.837245405f, 0.905091584f},
-std::array<float,2>{0.390352935f, 0.523524582f},
-std::array<float,2>{0.527143419f, 0.473332345f},
-std::array<float,2>{0.0207985975f, 0.261223823f},
-std::array<float,2>{0.78284204f, 0.633583963f},
-std::array<float,2>{0.474322498f, 0.844472051f},
-std::array<float,2>{0.593002498f, 0.220748723f},
-std::array<float,2>{0.282265544f, 0.0466316976f},
-std::array<float,2>{0.67834878f, 0.943036735f},
-std::array<float,2>{0.225269169f, 0.578456759f},
-std::array<float,2>{0.95943898f, 0.382195413f},
-std::array<float,2>{0.43574053f, 0.459733009f},
-std::array<float,2>{0.533485651f, 0.541399539f},
-std::array<float,2>{0.0965569392f, 0.912095249f},
-std::array<float,2>{0.871867537f, 0.112005197f},
-std::array<float,2>{0.154905111f, 0.163699582f},
-std::array<float,2>{0.89651829f, 0.811745048f},
-std::array<float,2>{0.315249205f, 0.698784828f},
-std::array<float,2>{0.711469173f, 0.344452471f},
-std::array<float,2>{0.182790592f, 0.368271381f},
-std::array<float,2>{0.928980052f, 0.706008732f},
-std::array<float,2>{0.351338208f, 0.782105386f},
-std::array<float,2>{0.730757236f, 0.172381043f},
-std::array<float,2>{0.403655469f, 0.106793828f},
-std::array<float,2>{0.501074433f, 0.925583184f},
-std::array<float,2>{0.0728569776f, 0.555956066f},
-std::array<float,2>{0.812894225f, 0.444821268f},
-std::array<float,2>{0.258492082f, 0.392393082f},
-std::array<float,2>{0.62598455f, 0.56834352f},
-std::array<float,2>{0.194167122f, 0.954665303f},
-std::array<float,2>{0.990500629f, 0.0620615333f},
-std::array<float,2>{0.034482792f, 0.234991089f},
-std::array<float,2>{0.767500162f, 0.862993836f},
-std::array<float,2>{0.451741219f, 0.646542251f},
-std::array<float,2>{0.62073499f, 0.268673331f},
-std::array<float,2>{0.124667898f, 0.496576935f},
-std::array<float,2>{0.849426448f, 0.500659645f},
-std::array<float,2>{0.417314798f, 0.887845218f},
-std::array<float,2>{0.554812133f, 0.0832080618f},
-std::array<float,2>{0.332573831f, 0.143127441f},
-std::array<float,2>{0.692642033f, 0.777731478f},
-std::array<float,2>{0.129515573f, 0.727873087f},
-std::array<float,2>{0.882309139f, 0.340631783f},
-std::array<float,2>{0.499250352f, 0.284376681f},
-std::array<float,2>{0.565180004f, 0.663997233f},
-std::array<float,2>{0.0152996676f, 0.826186121f},
-std::array<float,2>{0.798367858f, 0.207954422f},
-std::array<float,2>{0.244503289f, 0.0117482804f},
-std::array<float,2>{0.94287169f, 0.976255536f},
-std::array<float,2>{0.299371123f, 0.61844629f},
-std::array<float,2>{0.668548942f, 0.407562256f},
-std::array<float,2>{0.196456045f, 0.453213841f},
-std::array<float,2>{0.992713869f, 0.543708384f},
-std::array<float,2>{0.253557384f, 0.908492088f},
-std::array<float,2>{0.63580817f, 0.113988414f},
-std::array<float,2>{0.439593732f, 0.157416925f},
-std::array<float,2>{0.611988902f, 0.804768801f},
-std::array<float,2>{0.0437576622f, 0.700111806f},
-std::array<float,2>{0.774206698f, 0.350931913f},
-std::array<float,2>{0.355756611f, 0.263287216f},
-std::array<float,2>{0.723538458f, 0.640379429f},
-std::array<float,2>{0.178989619f, 0.849028528f},
-std::array<float,2>{0.935926795f, 0.223354056f},
-std::array<float,2>{0.068320252f, 0.0415498354f},
-std::array<float,2>{0.825491071f, 0.940885544f},
-std::array<float,2>{0.395418495f, 0.583825827f},
-std::array<float,2>{0.509246349f, 0.375222981f},
-std::array<float,2>{0.00252501946f, 0.320201218f},
-std::array<float,2>{0.809473276f, 0.740597248f},
-std::array<float,2>{0.484992743f, 0.758583128f},
-std::array<float,2>{0.574327111f, 0.132163793f},
-std::array<float,2>{0.307676971f, 0.0654489323f},
-std::array<float,2>{0.657206118f, 0.902059376f},
-std::array<float,2>{0.236156434f, 0.530001104f},
-std::array<float,2>{0.951829076f, 0.470589429f},
-std::array<float,2>{0.412393153f, 0.424818069f},
-std::array<float,2>{0.547638834f, 0.59685576f},
-std::array<float,2>{0.111499019f, 0.985907078f},
-std::array<float,2>{0.858274281f, 0.0286661331f},
-std::array<float,2>{0.135282427f, 0.189985231f},
-std::array<float,2>{0.885314167f, 0.840487599f},
-std::array<float,2>{0.341215253f, 0.679695964f},
-std::array<float,2>{0.701777518f, 0.308193088f},
-std::array<float,2>{0.158559352f, 0.288574249f},
-std::array<float,2>{0.91440165f, 0.659606755f},
-std::array<float,2>{0.361974359f, 0.822397947f},
-std::array<float,2>{0.739558697f, 0.204384863f},
-std::array<float,2>{0.379191965f, 0.00945524219f},
-std::array<float,2>{0.519936383f, 0.97177273f},
-std::array<float,2>{0.0886864588f, 0.623027921f},
-std::array<float,2>{0.835586071f, 0.411917806f},
-std::array<float,2>{0.270572245f, 0.495865256f},
-std::array<float,2>{0.644865572f, 0.505990207f},
-std::array<float,2>{0.217602476f, 0.883979619f},
-std::array<float,2>{0.975585461f, 0.0783731267f},
-std::array<float,2>{0.0598043203f, 0.147030935f},
-std::array<float,2>{0.762800574f, 0.776711226f},
-std::array<float,2>{0.458813995f, 0.731755197f},
-std::array<float,2>{0.603402138f, 0.338174701f},
-std::array<float,2>{0.103661492f, 0.398100197f},
-std::array<float,2>{0.863078475f, 0.565432906f},
-std::array<float,2>{0.428015292f, 0.959053814f},
-std::array<float,2>{0.540009677f, 0.056825351f},
-std::array<float,2>{0.325782031f, 0.239021197f},
-std::array<float,2>{0.707641065f, 0.866867006f},
-std::array<float,2>{0.145819455f, 0.643992007f},
-std::array<float,2>{0.904263198f, 0.273158193f},
-std::array<float,2>{0.478166431f, 0.374999374f},
-std::array<float,2>{0.578775585f, 0.709390879f},
-std::array<float,2>{0.027830651f, 0.787120759f},
-std::array<float,2>{0.791575551f, 0.176846221f},
-std::array<float,2>{0.227818862f, 0.104214638f},
-std::array<float,2>{0.964717627f, 0.927685499f},
-std::array<float,2>{0.291640967f, 0.558642447f},
-std::array<float,2>{0.683901131f, 0.441179961f},
-std::array<float,2>{0.150470942f, 0.420365453f},
-std::array<float,2>{0.892742038f, 0.61401397f},
-std::array<float,2>{0.317939699f, 0.983060479f},
-std::array<float,2>{0.717768252f, 0.00619964767f},
-std::array<float,2>{0.43196696f, 0.216362014f},
-std::array<float,2>{0.536465049f, 0.818376958f},
-std::array<float,2>{0.100143783f, 0.664701819f},
-std::array<float,2>{0.8701545f, 0.293916404f},
-std::array<float,2>{0.286708683f, 0.329963863f},
-std::array<float,2>{0.672839284f, 0.721814334f},
-std::array<float,2>{0.22225149f, 0.771700144f},
-std::array<float,2>{0.954634547f, 0.152066603f},
-std::array<float,2>{0.0163834263f, 0.0908808336f},
-std::array<float,2>{0.788332999f, 0.879992723f},
-std::array<float,2>{0.468751997f, 0.514287293f},
-std::array<float,2>{0.588068426f, 0.490166575f},
-std::array<float,2>{0.0854617804f, 0.278021693f},
-std::array<float,2>{0.841471136f, 0.650442243f},
-std::array<float,2>{0.385266185f, 0.868957102f},
-std::array<float,2>{0.529039025f, 0.243621022f},
-std::array<float,2>{0.371551245f, 0.0489691757f},
-std::array<float,2>{0.748769462f, 0.965689957f},
-std::array<float,2>{0.168221563f, 0.576264441f},
-std::array<float,2>{0.910804629f, 0.405595422f},
-std::array<float,2>{0.46576944f, 0.452903837f},
-std::array<float,2>{0.60090363f, 0.54770416f},
-std::array<float,2>{0.0507973135f, 0.936654568f},
-std::array<float,2>{0.753588259f, 0.0973347425f},
-std::array<float,2>{0.210186228f, 0.182605401f},
-std::array<float,2>{0.978758812f, 0.79580152f},
-std::array<float,2>{0.278064758f, 0.715979517f},
-std::array<float,2>{0.649174452f, 0.361518651f},
-std::array<float,2>{0.247693941f, 0.355985224f},
-std::array<float,2>{0.93964684f, 0.692141771f},
-std::array<float,2>{0.303810835f, 0.804481506f},
-std::array<float,2>{0.664631426f, 0.165609524f},
-std::array<float,2>{0.493350029f, 0.12132474f},
-std::array<float,2>{0.57004869f, 0.916888654f},
-std::array<float,2>{0.00823550392f, 0.532875121f},
-std::array<float,2>{0.801783741f, 0.467267632f},
-std::array<float,2>{0.328699201f, 0.387427419f},
-std::array<float,2>{0.690233946f, 0.588999093f},
-std::array<float,2>{0.126055941f, 0.946343839f},
-std::array<float,2>{0.876569808f, 0.0339476988f},
-std::array<float,2>{0.118490636f, 0.232035801f},
-std::array<float,2>{0.846064925f, 0.858217895f},
-std::array<float,2>{0.421747774f, 0.630756795f},
-std::array<float,2>{0.562028587f, 0.254750162f},
-std::array<float,2>{0.0379879922f, 0.479401082f},
-std::array<float,2>{0.771654904f, 0.515719056f},
-std::array<float,2>{0.445778072f, 0.896206379f},
-std::array<float,2>{0.62142998f, 0.0724428445f},
-std::array<float,2>{0.263332695f, 0.139806479f},
-std::array<float,2>{0.632009506f, 0.751695693f},
-std::array<float,2>{0.187501162f, 0.748800039f},
-std::array<float,2>{0.986224413f, 0.325864762f},
-std::array<float,2>{0.402040273f, 0.298309982f},
-std::array<float,2>{0.505686045f, 0.674842477f},
-std::array<float,2>{0.0762450993f, 0.831997395f},
-std::array<float,2>{0.81916064f, 0.19676958f},
-std::array<float,2>{0.184271127f, 0.0171228591f},
-std::array<float,2>{0.924543202f, 0.99254787f},
-std::array<float,2>{0.344261914f, 0.602634847f},
-std::array<float,2>{0.726943552f, 0.430854023f},
-std::array<float,2>{0.173520476f, 0.486963511f},
-std::array<float,2>{0.9332003f, 0.509253263f},
-std::array<float,2>{0.351723403f, 0.878539085f},
-std::array<float,2>{0.720967412f, 0.0868752599f},
-std::array<float,2>{0.393695116f, 0.152551964f},
-std::array<float,2>{0.51386553f, 0.766119778f},
-std::array<float,2>{0.0662417635f, 0.725010216f},
-std::array<float,2>{0.820652425f, 0.333851814f},
-std::array<float,2>{0.257323682f, 0.291399747f},
-std::array<float,2>{0.638296962f, 0.670887172f},
-std::array<float,2>{0.201993033f, 0.815241814f},
-std::array<float,2>{0.996328652f, 0.213726059f},
-std::array<float,2>{0.0418416336f, 0.000885697664f},
-std::array<float,2>{0.77962786f, 0.977743626f},
-std::array<float,2>{0.444108367f, 0.61035037f},
-std::array<float,2>{0.615834534f, 0.415091246f},
-std::array<float,2>{0.115608752f, 0.365800291f},
-std::array<float,2>{0.854980648f, 0.713382423f},
-std::array<float,2>{0.409255773f, 0.7910676f},
-std::array<float,2>{0.552390575f, 0.184696153f},
-std::array<float,2>{0.336497158f, 0.0987066478f},
-std::array<float,2>{0.699198961f, 0.931958139f},
-std::array<float,2>{0.13745293f, 0.553088009f},
-std::array<float,2>{0.889248252f, 0.446243197f},
-std::array<float,2>{0.489681542f, 0.39911446f},
-std::array<float,2>{0.572322547f, 0.570747674f},
-std::array<float,2>{0.0042888266f, 0.963059843f},
-std::array<float,2>{0.808346629f, 0.051448416f},
-std::array<float,2>{0.239581883f, 0.247445926f},
-std::array<float,2>{0.945946634f, 0.87353611f},
-std::array<float,2>{0.310090929f, 0.655744016f},
-std::array<float,2>{0.66366452f, 0.273928344f},
-std::array<float,2>{0.212432042f, 0.252619326f},
-std::array<float,2>{0.97137779f, 0.625535548f},
-std::array<float,2>{0.267243147f, 0.855371416f},
-std::array<float,2>{0.640915632f, 0.228296325f},
-std::array<float,2>{0.454339385f, 0.036224205f},
-std::array<float,2>{0.607218325f, 0.951728344f},
-std::array<float,2>{0.0548858047f, 0.590012729f},
-std::array<float,2>{0.758128941f, 0.386475563f},
-std::array<float,2>{0.367132097f, 0.463600963f},
-std::array<float,2>{0.735291183f, 0.536770642f},
-std::array<float,2>{0.162139267f, 0.918889225f},
-std::array<float,2>{0.919221282f, 0.118630536f},
-std::array<float,2>{0.0924497992f, 0.170626655f},
-std::array<float,2>{0.828811705f, 0.800533831f},
-std::array<float,2>{0.378355742f, 0.690740108f},
-std::array<float,2>{0.517632306f, 0.351760685f},
-std::array<float,2>{0.0247028489f, 0.436793894f},
-std::array<float,2>{0.794917643f, 0.606304526f},
-std::array<float,2>{0.480529517f, 0.997619271f},
-std::array<float,2>{0.582387447f, 0.0217856728f},
-std::array<float,2>{0.296736121f, 0.201255769f},
-std::array<float,2>{0.681223094f, 0.832469106f},
-std::array<float,2>{0.233850509f, 0.676079214f},
-std::array<float,2>{0.965493202f, 0.30327028f},
-std::array<float,2>{0.422020882f, 0.32213816f},
-std::array<float,2>{0.545212567f, 0.743320525f},
-std::array<float,2>{0.105891734f, 0.755963087f},
-std::array<float,2>{0.865007281f, 0.136322856f},
-std::array<float,2>{0.140815765f, 0.0746835545f},
-std::array<float,2>{0.898617566f, 0.892247975f},
-std::array<float,2>{0.321999252f, 0.52157414f},
-std::array<float,2>{0.705828011f, 0.482585013f},
-std::array<float,2>{0.223462969f, 0.379331738f},
-std::array<float,2>{0.958935738f, 0.581990898f},
-std::array<float,2>{0.28469336f, 0.945079267f},
-std::array<float,2>{0.676110148f, 0.0441830344f},
-std::array<float,2>{0.476263732f, 0.220632747f},
-std::array<float,2>{0.590370715f, 0.846283913f},
-std::array<float,2>{0.0227572545f, 0.635691166f},
-std::array<float,2>{0.785141766f, 0.259307981f},
-std::array<float,2>{0.313869715f, 0.347136199f},
-std::array<float,2>{0.713911235f, 0.696048439f},
-std::array<float,2>{0.153690726f, 0.809480071f},
-std::array<float,2>{0.895027995f, 0.160310656f},
-std::array<float,2>{0.0954645798f, 0.110442795f},
-std::array<float,2>{0.87436235f, 0.913447142f},
-std::array<float,2>{0.433711916f, 0.540398061f},
-std::array<float,2>{0.531323552f, 0.458870858f},
-std::array<float,2>{0.0501627363f, 0.309144646f},
-std::array<float,2>{0.756581783f, 0.685679913f},
-std::array<float,2>{0.464433551f, 0.839425802f},
-std::array<float,2>{0.596527219f, 0.192591712f},
-std::array<float,2>{0.275282025f, 0.0235272646f},
-std::array<float,2>{0.654199123f, 0.988812268f},
-std::array<float,2>{0.203515977f, 0.601045668f},
-std::array<float,2>{0.980962694f, 0.428397447f},
-std::array<float,2>{0.387549877f, 0.476494879f},
-std::array<float,2>{0.52502799f, 0.52621752f},
-std::array<float,2>{0.0788803697f, 0.902874231f},
-std::array<float,2>{0.838632226f, 0.0700194016f},
-std::array<float,2>{0.165566429f, 0.128323719f},
-std::array<float,2>{0.907809734f, 0.764222741f},
-std::array<float,2>{0.370688677f, 0.738110244f},
-std::array<float,2>{0.743291497f, 0.314089447f},
-std::array<float,2>{0.13181302f, 0.342634529f},
-std::array<float,2>{0.880829394f, 0.728773773f},
-std::array<float,2>{0.335913688f, 0.780237973f},
-std::array<float,2>{0.693545461f, 0.141474605f},
-std::array<float,2>{0.41485098f, 0.0852191076f},
-std::array<float,2>{0.558118522f, 0.889793456f},
-std::array<float,2>{0.122430697f, 0.502227962f},
-std::array<float,2>{0.850095809f, 0.499881983f},
-std::array<float,2>{0.297910839f, 0.408449471f},
-std::array<float,2>{0.670597672f, 0.621010482f},
-std::array<float,2>{0.243877918f, 0.973592103f},
-std::array<float,2>{0.945240617f, 0.0136955976f},
-std::array<float,2>{0.0123814447f, 0.209557474f},
-std::array<float,2>{0.800363123f, 0.824668407f},
-std::array<float,2>{0.496549726f, 0.661577702f},
-std::array<float,2>{0.562841833f, 0.282486588f},
-std::array<float,2>{0.0704469085f, 0.442402214f},
-std::array<float,2>{0.81513828f, 0.558522522f},
-std::array<float,2>{0.404779494f, 0.923827827f},
-std::array<float,2>{0.502523422f, 0.109042428f},
-std::array<float,2>{0.349273413f, 0.175548032f},
-std::array<float,2>{0.73415035f, 0.783534884f},
-std::array<float,2>{0.180602297f, 0.704171836f},
-std::array<float,2>{0.927224696f, 0.370502263f},
-std::array<float,2>{0.450542331f, 0.26740548f},
-std::array<float,2>{0.617480159f, 0.645614505f},
-std::array<float,2>{0.0316189714f, 0.860246003f},
-std::array<float,2>{0.769057274f, 0.237579241f},
-std::array<float,2>{0.192247659f, 0.0592502579f},
-std::array<float,2>{0.98967737f, 0.955180824f},
-std::array<float,2>{0.260139376f, 0.569436073f},
-std::array<float,2>{0.62714237f, 0.394448459f},
-std::array<float,2>{0.249532059f, 0.467761427f},
-std::array<float,2>{0.938834846f, 0.532411158f},
-std::array<float,2>{0.301205665f, 0.916142225f},
-std::array<float,2>{0.666344285f, 0.121868268f},
-std::array<float,2>{0.49418512f, 0.165148303f},
-std::array<float,2>{0.567478299f, 0.804005861f},
-std::array<float,2>{0.0102009149f, 0.691823781f},
-std::array<float,2>{0.802776694f, 0.355854273f},
-std::array<float,2>{0.330119669f, 0.254243582f},
-std::array<float,2>{0.688498437f, 0.63016963f},
-std::array<float,2>{0.127144083f, 0.857757688f},
-std::array<float,2>{0.877051711f, 0.231725454f},
-std::array<float,2>{0.11928539f, 0.033236254f},
-std::array<float,2>{0.845570147f, 0.94700098f},
-std::array<float,2>{0.419307142f, 0.589563012f},
-std::array<float,2>{0.558619618f, 0.387182713f},
-std::array<float,2>{0.0359919854f, 0.325484067f},
-std::array<float,2>{0.770945489f, 0.74807328f},
-std::array<float,2>{0.449031889f, 0.751196146f},
-std::array<float,2>{0.62376833f, 0.140221402f},
-std::array<float,2>{0.263928831f, 0.0727639943f},
-std::array<float,2>{0.630232692f, 0.895866275f},
-std::array<float,2>{0.190425813f, 0.51633662f},
-std::array<float,2>{0.987011433f, 0.478811949f},
-std::array<float,2>{0.39954415f, 0.431612939f},
-std::array<float,2>{0.507392645f, 0.603462934f},
-std::array<float,2>{0.0752809271f, 0.993014157f},
-std::array<float,2>{0.817192554f, 0.0167006329f},
-std::array<float,2>{0.186564103f, 0.197106719f},
-std::array<float,2>{0.922478437f, 0.831359923f},
-std::array<float,2>{0.347189873f, 0.67555058f},
-std::array<float,2>{0.728668153f, 0.298478961f},
-std::array<float,2>{0.14974241f, 0.293118685f},
-std::array<float,2>{0.891971111f, 0.664100289f},
-std::array<float,2>{0.320161372f, 0.819170177f},
-std::array<float,2>{0.716637552f, 0.216034397f},
-std::array<float,2>{0.431091338f, 0.00640967302f},
-std::array<float,2>{0.537522614f, 0.982653677f},
-std::array<float,2>{0.0983690321f, 0.61359942f},
-std::array<float,2>{0.867683709f, 0.420761764f},
-std::array<float,2>{0.288541138f, 0.489744604f},
-std::array<float,2>{0.674925566f, 0.513999641f},
-std::array<float,2>{0.219851747f, 0.880675018f},
-std::array<float,2>{0.956670821f, 0.0913510472f},
-std::array<float,2>{0.0184438955f, 0.151716009f},
-std::array<float,2>{0.785653472f, 0.772335708f},
-std::array<float,2>{0.471196026f, 0.722529173f},
-std::array<float,2>{0.587745845f, 0.329104185f},
-std::array<float,2>{0.0825655311f, 0.405950129f},
-std::array<float,2>{0.843621612f, 0.577124536f},
-std::array<float,2>{0.383539885f, 0.965287447f},
-std::array<float,2>{0.529621303f, 0.0495200492f},
-std::array<float,2>{0.373605311f, 0.24403812f},
-std::array<float,2>{0.746853828f, 0.86850518f},
-std::array<float,2>{0.171160981f, 0.651007354f},
-std::array<float,2>{0.912591994f, 0.277600288f},
-std::array<float,2>{0.468327075f, 0.361873984f},
-std::array<float,2>{0.598884761f, 0.716449022f},
-std::array<float,2>{0.0542479716f, 0.794994771f},
-std::array<float,2>{0.751902282f, 0.181827426f},
-std::array<float,2>{0.207046449f, 0.0969467312f},
-std::array<float,2>{0.977050006f, 0.937039137f},
-std::array<float,2>{0.279560179f, 0.547015131f},
-std::array<float,2>{0.651311576f, 0.452536345f},
-std::array<float,2>{0.158082142f, 0.411226034f},
-std::array<float,2>{0.916996419f, 0.622405589f},
-std::array<float,2>{0.359635264f, 0.972366333f},
-std::array<float,2>{0.741077423f, 0.009151184f},
-std::array<float,2>{0.38102591f, 0.20490098f},
-std::array<float,2>{0.521572232f, 0.823115408f},
-std::array<float,2>{0.0874116793f, 0.660076141f},
-std::array<float,2>{0.832703054f, 0.288185894f},
-std::array<float,2>{0.271531373f, 0.338774949f},
-std::array<float,2>{0.647419155f, 0.732013166f},
-std::array<float,2>{0.216697827f, 0.776887119f},
-std::array<float,2>{0.973343611f, 0.146963552f},
-std::array<float,2>{0.0623458028f, 0.0787105039f},
-std::array<float,2>{0.765547276f, 0.884333313f},
-std::array<float,2>{0.460057735f, 0.50658983f},
-std::array<float,2>{0.604422271f, 0.495493382f},
-std::array<float,2>{0.102073051f, 0.272883981f},
-std::array<float,2>{0.859689534f, 0.644305646f},
-std::array<float,2>{0.426769763f, 0.866539598f},
-std::array<float,2>{0.542162895f, 0.238546506f},
-std::array<float,2>{0.327718347f, 0.0574832894f},
-std::array<float,2>{0.709439337f, 0.959903777f},
-std::array<float,2>{0.148408771f, 0.565938652f},
-std::array<float,2>{0.905147672f, 0.397802353f},
-std::array<float,2>{0.479243845f, 0.440591604f},
-std::array<float,2>{0.580190063f, 0.559439898f},
-std::array<float,2>{0.0302032884f, 0.927205086f},
-std::array<float,2>{0.790484607f, 0.103732817f},
-std::array<float,2>{0.230014563f, 0.177643508f},
-std::array<float,2>{0.961547732f, 0.787989676f},
-std::array<float,2>{0.290649116f, 0.709508538f},
-std::array<float,2>{0.687211871f, 0.37413618f},
-std::array<float,2>{0.197673604f, 0.351216465f},
-std::array<float,2>{0.994629502f, 0.699308813f},
-std::array<float,2>{0.251754284f, 0.805569887f},
-std::array<float,2>{0.633405209f, 0.158129349f},
-std::array<float,2>{0.438849151f, 0.11337962f},
-std::array<float,2>{0.611080945f, 0.909170806f},
-std::array<float,2>{0.0452705659f, 0.543248296f},
-std::array<float,2>{0.776712894f, 0.453777701f},
-std::array<float,2>{0.359199733f, 0.375974625f},
-std::array<float,2>{0.726513922f, 0.583455145f},
-std::array<float,2>{0.176167727f, 0.941347897f},
-std::array<float,2>{0.93455112f, 0.041280739f},
-std::array<float,2>{0.0693632886f, 0.222862959f},
-std::array<float,2>{0.826448858f, 0.849600255f},
-std::array<float,2>{0.396803647f, 0.639750779f},
-std::array<float,2>{0.510745764f, 0.262960494f},
-std::array<float,2>{7.68859445e-06f, 0.470021427f},
-std::array<float,2>{0.812225103f, 0.5295856f},
-std::array<float,2>{0.486415982f, 0.901562154f},
-std::array<float,2>{0.577199221f, 0.0660120696f},
-std::array<float,2>{0.306489557f, 0.132396251f},
-std::array<float,2>{0.659477293f, 0.758049667f},
-std::array<float,2>{0.237658709f, 0.740737855f},
-std::array<float,2>{0.949692667f, 0.319398791f},
-std::array<float,2>{0.411844343f, 0.307905555f},
-std::array<float,2>{0.549559951f, 0.680508316f},
-std::array<float,2>{0.109834701f, 0.839974403f},
-std::array<float,2>{0.856115937f, 0.189658985f},
-std::array<float,2>{0.132936761f, 0.0289529711f},
-std::array<float,2>{0.884151459f, 0.985789537f},
-std::array<float,2>{0.342897147f, 0.597352862f},
-std::array<float,2>{0.700207293f, 0.425310165f},
-std::array<float,2>{0.12901409f, 0.499485552f},
-std::array<float,2>{0.882484674f, 0.502494097f},
-std::array<float,2>{0.332272649f, 0.890397429f},
-std::array<float,2>{0.692926109f, 0.0857241824f},
-std::array<float,2>{0.417667776f, 0.141101331f},
-std::array<float,2>{0.555390298f, 0.779619992f},
-std::array<float,2>{0.12407133f, 0.729201734f},
-std::array<float,2>{0.848661005f, 0.342174262f},
-std::array<float,2>{0.299316108f, 0.283088535f},
-std::array<float,2>{0.668367684f, 0.661661446f},
-std::array<float,2>{0.244767144f, 0.82498318f},
-std::array<float,2>{0.942482948f, 0.209378824f},
-std::array<float,2>{0.0150736067f, 0.0141619444f},
-std::array<float,2>{0.798149288f, 0.972947121f},
-std::array<float,2>{0.499699712f, 0.620559692f},
-std::array<float,2>{0.564899683f, 0.408954591f},
-std::array<float,2>{0.0726119801f, 0.37088874f},
-std::array<float,2>{0.813082695f, 0.704698741f},
-std::array<float,2>{0.404144794f, 0.784022033f},
-std::array<float,2>{0.501762986f, 0.175216794f},
-std::array<float,2>{0.350964129f, 0.108464561f},
-std::array<float,2>{0.730977297f, 0.923134148f},
-std::array<float,2>{0.183362588f, 0.557666838f},
-std::array<float,2>{0.929508328f, 0.442912996f},
-std::array<float,2>{0.451456726f, 0.393865913f},
-std::array<float,2>{0.620168626f, 0.569968343f},
-std::array<float,2>{0.0347678624f, 0.95582968f},
-std::array<float,2>{0.766761899f, 0.058810465f},
-std::array<float,2>{0.193445563f, 0.238203302f},
-std::array<float,2>{0.990897954f, 0.859576643f},
-std::array<float,2>{0.258112758f, 0.646094084f},
-std::array<float,2>{0.626666069f, 0.267044425f},
-std::array<float,2>{0.224647895f, 0.258914441f},
-std::array<float,2>{0.959908664f, 0.634913027f},
-std::array<float,2>{0.283144385f, 0.845809281f},
-std::array<float,2>{0.678037763f, 0.220122516f},
-std::array<float,2>{0.474022597f, 0.0445520543f},
-std::array<float,2>{0.593533814f, 0.944712102f},
-std::array<float,2>{0.0212353077f, 0.581242323f},
-std::array<float,2>{0.782289863f, 0.379570663f},
-std::array<float,2>{0.314663738f, 0.458252668f},
-std::array<float,2>{0.711043835f, 0.540727139f},
-std::array<float,2>{0.154323339f, 0.913618803f},
-std::array<float,2>{0.8970415f, 0.11100518f},
-std::array<float,2>{0.0960438624f, 0.161107823f},
-std::array<float,2>{0.871481955f, 0.8090626f},
-std::array<float,2>{0.436160266f, 0.695477843f},
-std::array<float,2>{0.5337075f, 0.347264469f},
-std::array<float,2>{0.0477225333f, 0.42800644f},
-std::array<float,2>{0.75446862f, 0.601212919f},
-std::array<float,2>{0.462700874f, 0.988325894f},
-std::array<float,2>{0.594233036f, 0.0239842832f},
-std::array<float,2>{0.275416315f, 0.193206728f},
-std::array<float,2>{0.654449522f, 0.838908732f},
-std::array<float,2>{0.20549503f, 0.686277986f},
-std::array<float,2>{0.983881712f, 0.308909386f},
-std::array<float,2>{0.390082061f, 0.313930571f},
-std::array<float,2>{0.526412666f, 0.737519026f},
-std::array<float,2>{0.0817548037f, 0.763783157f},
-std::array<float,2>{0.837541461f, 0.128494248f},
-std::array<float,2>{0.167870879f, 0.069740206f},
-std::array<float,2>{0.909744918f, 0.902531028f},
-std::array<float,2>{0.368769228f, 0.525553584f},
-std::array<float,2>{0.744297743f, 0.476025641f},
-std::array<float,2>{0.213155851f, 0.38611725f},
-std::array<float,2>{0.970106602f, 0.590695202f},
-std::array<float,2>{0.268693179f, 0.951408207f},
-std::array<float,2>{0.64445138f, 0.0369846374f},
-std::array<float,2>{0.455358863f, 0.228007808f},
-std::array<float,2>{0.607519984f, 0.854867518f},
-std::array<float,2>{0.0572739616f, 0.625157654f},
-std::array<float,2>{0.760812283f, 0.252403885f},
-std::array<float,2>{0.364178777f, 0.352227896f},
-std::array<float,2>{0.736447394f, 0.6913414f},
-std::array<float,2>{0.160953686f, 0.800269544f},
-std::array<float,2>{0.921584368f, 0.169985786f},
-std::array<float,2>{0.0903683901f, 0.118854024f},
-std::array<float,2>{0.830349326f, 0.918407083f},
-std::array<float,2>{0.375329614f, 0.536243677f},
-std::array<float,2>{0.515807867f, 0.46329695f},
-std::array<float,2>{0.0259857364f, 0.302785397f},
-std::array<float,2>{0.795852304f, 0.676659822f},
-std::array<float,2>{0.482530653f, 0.832690299f},
-std::array<float,2>{0.583992302f, 0.20192644f},
-std::array<float,2>{0.293140382f, 0.0223291367f},
-std::array<float,2>{0.682044625f, 0.997550428f},
-std::array<float,2>{0.231477663f, 0.605705023f},
-std::array<float,2>{0.968067706f, 0.437384754f},
-std::array<float,2>{0.425271064f, 0.483067393f},
-std::array<float,2>{0.544484675f, 0.522218585f},
-std::array<float,2>{0.108700521f, 0.891828358f},
-std::array<float,2>{0.865238845f, 0.0750615969f},
-std::array<float,2>{0.142950892f, 0.136028513f},
-std::array<float,2>{0.901159167f, 0.756661296f},
-std::array<float,2>{0.323715806f, 0.744088113f},
-std::array<float,2>{0.70348841f, 0.321576089f},
-std::array<float,2>{0.173916638f, 0.333416671f},
-std::array<float,2>{0.929812491f, 0.725395381f},
-std::array<float,2>{0.355324835f, 0.765956581f},
-std::array<float,2>{0.719175875f, 0.153205812f},
-std::array<float,2>{0.392149895f, 0.0863581821f},
-std::array<float,2>{0.512552142f, 0.878344238f},
-std::array<float,2>{0.0629815981f, 0.509410858f},
-std::array<float,2>{0.823304951f, 0.486554474f},
-std::array<float,2>{0.255210429f, 0.415851504f},
-std::array<float,2>{0.638784528f, 0.609857202f},
-std::array<float,2>{0.199930146f, 0.978138328f},
-std::array<float,2>{0.998607516f, 0.000458634138f},
-std::array<float,2>{0.0409036428f, 0.213058218f},
-std::array<float,2>{0.778220534f, 0.81486094f},
-std::array<float,2>{0.441853285f, 0.670113325f},
-std::array<float,2>{0.614736021f, 0.291623443f},
-std::array<float,2>{0.115025073f, 0.445799321f},
-std::array<float,2>{0.853135407f, 0.55339247f},
-std::array<float,2>{0.407176167f, 0.932173431f},
-std::array<float,2>{0.554157317f, 0.0992365405f},
-std::array<float,2>{0.338993937f, 0.185447335f},
-std::array<float,2>{0.696658611f, 0.791904151f},
-std::array<float,2>{0.140159816f, 0.713362932f},
-std::array<float,2>{0.888647735f, 0.365694225f},
-std::array<float,2>{0.490498006f, 0.273775429f},
-std::array<float,2>{0.572190046f, 0.655903757f},
-std::array<float,2>{0.00660252618f, 0.873412788f},
-std::array<float,2>{0.806469798f, 0.247802019f},
-std::array<float,2>{0.24197188f, 0.0511146672f},
-std::array<float,2>{0.948243022f, 0.963853657f},
-std::array<float,2>{0.310687393f, 0.570980728f},
-std::array<float,2>{0.660489857f, 0.398784488f},
-std::array<float,2>{0.188321099f, 0.478455335f},
-std::array<float,2>{0.985413432f, 0.518955052f},
-std::array<float,2>{0.262789041f, 0.897927582f},
-std::array<float,2>{0.632705808f, 0.0705377236f},
-std::array<float,2>{0.445809364f, 0.137873203f},
-std::array<float,2>{0.621934056f, 0.753707707f},
-std::array<float,2>{0.0375586301f, 0.746567547f},
-std::array<float,2>{0.772451699f, 0.328064799f},
-std::array<float,2>{0.344100356f, 0.300723195f},
-std::array<float,2>{0.727211058f, 0.673619092f},
-std::array<float,2>{0.183848783f, 0.829580724f},
-std::array<float,2>{0.924106777f, 0.197496787f},
-std::array<float,2>{0.0771010742f, 0.0183188189f},
-std::array<float,2>{0.818760812f, 0.995784998f},
-std::array<float,2>{0.401759952f, 0.604587197f},
-std::array<float,2>{0.505231023f, 0.43225646f},
-std::array<float,2>{0.00834875181f, 0.359051764f},
-std::array<float,2>{0.802332401f, 0.694201648f},
-std::array<float,2>{0.493882686f, 0.801779628f},
-std::array<float,2>{0.569746852f, 0.166204974f},
-std::array<float,2>{0.304406643f, 0.124300666f},
-std::array<float,2>{0.664314926f, 0.915652454f},
-std::array<float,2>{0.247382164f, 0.534632921f},
-std::array<float,2>{0.94032532f, 0.465344787f},
-std::array<float,2>{0.421147346f, 0.388723224f},
-std::array<float,2>{0.561950743f, 0.587664962f},
-std::array<float,2>{0.118847996f, 0.947694778f},
-std::array<float,2>{0.846480966f, 0.0330497883f},
-std::array<float,2>{0.126815811f, 0.234078079f},
-std::array<float,2>{0.876178682f, 0.856050968f},
-std::array<float,2>{0.328134656f, 0.632787347f},
-std::array<float,2>{0.689523518f, 0.256007612f},
-std::array<float,2>{0.168621257f, 0.28045699f},
-std::array<float,2>{0.910248041f, 0.648682535f},
-std::array<float,2>{0.371792525f, 0.869474888f},
-std::array<float,2>{0.748162031f, 0.24578011f},
-std::array<float,2>{0.385054082f, 0.0476462953f},
-std::array<float,2>{0.528706193f, 0.967646182f},
-std::array<float,2>{0.0852430314f, 0.576122344f},
-std::array<float,2>{0.840824544f, 0.403318971f},
-std::array<float,2>{0.277427077f, 0.450298399f},
-std::array<float,2>{0.648440719f, 0.550691128f},
-std::array<float,2>{0.210525885f, 0.934594989f},
-std::array<float,2>{0.979220331f, 0.0940308869f},
-std::array<float,2>{0.0516073741f, 0.180529386f},
-std::array<float,2>{0.753195763f, 0.793682337f},
-std::array<float,2>{0.465126663f, 0.716931641f},
-std::array<float,2>{0.601283193f, 0.360508293f},
-std::array<float,2>{0.0996295288f, 0.418216527f},
-std::array<float,2>{0.870849907f, 0.617107451f},
-std::array<float,2>{0.432237029f, 0.982265055f},
-std::array<float,2>{0.536894798f, 0.00538483309f},
-std::array<float,2>{0.317415148f, 0.216861993f},
-std::array<float,2>{0.717107654f, 0.817519009f},
-std::array<float,2>{0.151362091f, 0.66613698f},
-std::array<float,2>{0.893187642f, 0.296318591f},
-std::array<float,2>{0.469457209f, 0.330187291f},
-std::array<float,2>{0.588764668f, 0.71919328f},
-std::array<float,2>{0.0159440022f, 0.770650089f},
-std::array<float,2>{0.78890729f, 0.149013296f},
-std::array<float,2>{0.221795738f, 0.0930747464f},
-std::array<float,2>{0.954533637f, 0.881831408f},
-std::array<float,2>{0.286511362f, 0.512141287f},
-std::array<float,2>{0.672061563f, 0.491723716f},
-std::array<float,2>{0.146347299f, 0.395143867f},
-std::array<float,2>{0.903337717f, 0.563943505f},
-std::array<float,2>{0.325418204f, 0.9584378f},
-std::array<float,2>{0.707416654f, 0.0548303947f},
-std::array<float,2>{0.428290218f, 0.241149813f},
-std::array<float,2>{0.539119422f, 0.865094066f},
-std::array<float,2>{0.104374766f, 0.641761005f},
-std::array<float,2>{0.862484932f, 0.270926923f},
-std::array<float,2>{0.291059881f, 0.371097118f},
-std::array<float,2>{0.684407651f, 0.708661199f},
-std::array<float,2>{0.228502482f, 0.786511838f},
-std::array<float,2>{0.964097261f, 0.178058684f},
-std::array<float,2>{0.0282331146f, 0.103110276f},
-std::array<float,2>{0.791497588f, 0.928323925f},
-std::array<float,2>{0.477885753f, 0.560815632f},
-std::array<float,2>{0.57836771f, 0.438833296f},
-std::array<float,2>{0.0883670151f, 0.285983771f},
-std::array<float,2>{0.835300624f, 0.656469047f},
-std::array<float,2>{0.379758596f, 0.821578741f},
-std::array<float,2>{0.520219028f, 0.206313357f},
-std::array<float,2>{0.361548126f, 0.0109914355f},
-std::array<float,2>{0.740027606f, 0.968932509f},
-std::array<float,2>{0.159138203f, 0.623803794f},
-std::array<float,2>{0.914711356f, 0.413871229f},
-std::array<float,2>{0.458252877f, 0.492773384f},
-std::array<float,2>{0.602663875f, 0.505651355f},
-std::array<float,2>{0.0603930615f, 0.885512888f},
-std::array<float,2>{0.763336241f, 0.0801319256f},
-std::array<float,2>{0.216990367f, 0.145091906f},
-std::array<float,2>{0.975078583f, 0.774286628f},
-std::array<float,2>{0.271141797f, 0.734257102f},
-std::array<float,2>{0.645215631f, 0.337226987f},
-std::array<float,2>{0.235622242f, 0.317120314f},
-std::array<float,2>{0.95129621f, 0.738931477f},
-std::array<float,2>{0.308192521f, 0.760790586f},
-std::array<float,2>{0.656390131f, 0.130079359f},
-std::array<float,2>{0.484779984f, 0.0626711398f},
-std::array<float,2>{0.5751248f, 0.898468196f},
-std::array<float,2>{0.00204974995f, 0.527392149f},
-std::array<float,2>{0.808840692f, 0.471721023f},
-std::array<float,2>{0.341617465f, 0.42290926f},
-std::array<float,2>{0.701208413f, 0.594685078f},
-std::array<float,2>{0.134826079f, 0.987827122f},
-std::array<float,2>{0.884996355f, 0.0304926969f},
-std::array<float,2>{0.111918919f, 0.187779203f},
-std::array<float,2>{0.857604384f, 0.843060553f},
-std::array<float,2>{0.41268903f, 0.682904661f},
-std::array<float,2>{0.547176659f, 0.306471288f},
-std::array<float,2>{0.0429822132f, 0.456067502f},
-std::array<float,2>{0.773515582f, 0.545864284f},
-std::array<float,2>{0.440291554f, 0.907929361f},
-std::array<float,2>{0.611641884f, 0.116460271f},
-std::array<float,2>{0.253395766f, 0.159948021f},
-std::array<float,2>{0.636692822f, 0.808336914f},
-std::array<float,2>{0.196998626f, 0.702593386f},
-std::array<float,2>{0.992462695f, 0.347790241f},
-std::array<float,2>{0.394652367f, 0.264231086f},
-std::array<float,2>{0.509672403f, 0.637492359f},
-std::array<float,2>{0.0674888343f, 0.851108015f},
-std::array<float,2>{0.82611233f, 0.225931123f},
-std::array<float,2>{0.179261461f, 0.0398766883f},
-std::array<float,2>{0.936203659f, 0.93838644f},
-std::array<float,2>{0.356212914f, 0.584698677f},
-std::array<float,2>{0.72286582f, 0.37822029f},
-std::array<float,2>{0.179696664f, 0.445192605f},
-std::array<float,2>{0.92760998f, 0.556508064f},
-std::array<float,2>{0.349087507f, 0.924907446f},
-std::array<float,2>{0.733674586f, 0.107142285f},
-std::array<float,2>{0.405269355f, 0.172128707f},
-std::array<float,2>{0.501969695f, 0.781703889f},
-std::array<float,2>{0.0710434318f, 0.705080509f},
-std::array<float,2>{0.81462872f, 0.368785292f},
-std::array<float,2>{0.26062867f, 0.269387782f},
-std::array<float,2>{0.627594709f, 0.64709115f},
-std::array<float,2>{0.191830128f, 0.862787187f},
-std::array<float,2>{0.989836276f, 0.234846741f},
-std::array<float,2>{0.0317924432f, 0.0618694387f},
-std::array<float,2>{0.768656135f, 0.954423606f},
-std::array<float,2>{0.45080322f, 0.567454517f},
-std::array<float,2>{0.618080735f, 0.392022341f},
-std::array<float,2>{0.122613542f, 0.340289801f},
-std::array<float,2>{0.850414574f, 0.728123069f},
-std::array<float,2>{0.414418012f, 0.777973175f},
-std::array<float,2>{0.557660282f, 0.142596111f},
-std::array<float,2>{0.335221201f, 0.083972089f},
-std::array<float,2>{0.694308579f, 0.888381302f},
-std::array<float,2>{0.131090298f, 0.500247538f},
-std::array<float,2>{0.879921436f, 0.496892691f},
-std::array<float,2>{0.496681899f, 0.408072323f},
-std::array<float,2>{0.5631181f, 0.618669152f},
-std::array<float,2>{0.0120705897f, 0.975821137f},
-std::array<float,2>{0.800033212f, 0.0123483036f},
-std::array<float,2>{0.24357678f, 0.20706585f},
-std::array<float,2>{0.944670796f, 0.826964796f},
-std::array<float,2>{0.298411459f, 0.663339078f},
-std::array<float,2>{0.670021236f, 0.284737051f},
-std::array<float,2>{0.203717217f, 0.312134534f},
-std::array<float,2>{0.980700135f, 0.68540132f},
-std::array<float,2>{0.274677902f, 0.837784171f},
-std::array<float,2>{0.6537655f, 0.194049105f},
-std::array<float,2>{0.464168608f, 0.0272576548f},
-std::array<float,2>{0.596185148f, 0.990549266f},
-std::array<float,2>{0.0507403351f, 0.598915696f},
-std::array<float,2>{0.756218791f, 0.427226216f},
-std::array<float,2>{0.370249391f, 0.472872466f},
-std::array<float,2>{0.743768692f, 0.524391651f},
-std::array<float,2>{0.165200025f, 0.904476345f},
-std::array<float,2>{0.907324731f, 0.0666389838f},
-std::array<float,2>{0.0784989223f, 0.126438066f},
-std::array<float,2>{0.837942839f, 0.763654411f},
-std::array<float,2>{0.387137473f, 0.734408975f},
-std::array<float,2>{0.524443388f, 0.315648913f},
-std::array<float,2>{0.0232970137f, 0.382663906f},
-std::array<float,2>{0.78459388f, 0.578838706f},
-std::array<float,2>{0.47567904f, 0.942580283f},
-std::array<float,2>{0.590137899f, 0.0463048443f},
-std::array<float,2>{0.284468859f, 0.221357197f},
-std::array<float,2>{0.67629236f, 0.843892872f},
-std::array<float,2>{0.222929746f, 0.632872581f},
-std::array<float,2>{0.958159387f, 0.261304587f},
-std::array<float,2>{0.434308052f, 0.343824238f},
-std::array<float,2>{0.531906962f, 0.698690474f},
-std::array<float,2>{0.0947450548f, 0.812390804f},
-std::array<float,2>{0.874842286f, 0.16329053f},
-std::array<float,2>{0.154128507f, 0.111479305f},
-std::array<float,2>{0.894595444f, 0.911603987f},
-std::array<float,2>{0.314398557f, 0.541735351f},
-std::array<float,2>{0.714780331f, 0.459096879f},
-std::array<float,2>{0.234323397f, 0.433644921f},
-std::array<float,2>{0.964848936f, 0.608358622f},
-std::array<float,2>{0.296300262f, 0.99880141f},
-std::array<float,2>{0.680853009f, 0.0201231539f},
-std::array<float,2>{0.481179982f, 0.199745446f},
-std::array<float,2>{0.582796812f, 0.83555752f},
-std::array<float,2>{0.0252131019f, 0.678595722f},
-std::array<float,2>{0.794393063f, 0.301779151f},
-std::array<float,2>{0.321547478f, 0.32409963f},
-std::array<float,2>{0.705463409f, 0.745398998f},
-std::array<float,2>{0.141242698f, 0.754792035f},
-std::array<float,2>{0.898986518f, 0.133974254f},
-std::array<float,2>{0.106301486f, 0.0780668929f},
-std::array<float,2>{0.864573836f, 0.89353472f},
-std::array<float,2>{0.422395974f, 0.52107513f},
-std::array<float,2>{0.545559824f, 0.481271237f},
-std::array<float,2>{0.0554739907f, 0.250807911f},
-std::array<float,2>{0.758440912f, 0.627088726f},
-std::array<float,2>{0.454869777f, 0.852337301f},
-std::array<float,2>{0.606770396f, 0.229230478f},
-std::array<float,2>{0.266930848f, 0.0382395945f},
-std::array<float,2>{0.641316772f, 0.949476123f},
-std::array<float,2>{0.212250233f, 0.592194736f},
-std::array<float,2>{0.970995188f, 0.383166403f},
-std::array<float,2>{0.378516674f, 0.462253779f},
-std::array<float,2>{0.518194497f, 0.538841426f},
-std::array<float,2>{0.0920168459f, 0.920525074f},
-std::array<float,2>{0.828209877f, 0.120427214f},
-std::array<float,2>{0.162856117f, 0.169301346f},
-std::array<float,2>{0.919701874f, 0.796968102f},
-std::array<float,2>{0.366375089f, 0.688078582f},
-std::array<float,2>{0.734552622f, 0.354045928f},
-std::array<float,2>{0.136724651f, 0.363286972f},
-std::array<float,2>{0.888827801f, 0.71176523f},
-std::array<float,2>{0.336139977f, 0.789421141f},
-std::array<float,2>{0.698526859f, 0.186153993f},
-std::array<float,2>{0.409833014f, 0.0998149142f},
-std::array<float,2>{0.551805139f, 0.929914117f},
-std::array<float,2>{0.116038233f, 0.552277267f},
-std::array<float,2>{0.854714751f, 0.449180186f},
-std::array<float,2>{0.309734821f, 0.40232563f},
-std::array<float,2>{0.663384557f, 0.57405448f},
-std::array<float,2>{0.239931241f, 0.962157905f},
-std::array<float,2>{0.945391655f, 0.0527914464f},
-std::array<float,2>{0.00449085562f, 0.249533132f},
-std::array<float,2>{0.807985783f, 0.872117341f},
-std::array<float,2>{0.490195215f, 0.65367645f},
-std::array<float,2>{0.572996497f, 0.276576579f},
-std::array<float,2>{0.065864265f, 0.485335708f},
-std::array<float,2>{0.821193159f, 0.511034966f},
-std::array<float,2>{0.394090921f, 0.875271797f},
-std::array<float,2>{0.514160514f, 0.088740401f},
-std::array<float,2>{0.352498382f, 0.155028f},
-std::array<float,2>{0.721474946f, 0.769185364f},
-std::array<float,2>{0.173268765f, 0.722855687f},
-std::array<float,2>{0.93263191f, 0.334178478f},
-std::array<float,2>{0.443780959f, 0.289703488f},
-std::array<float,2>{0.615650415f, 0.66837883f},
-std::array<float,2>{0.041386161f, 0.814332128f},
-std::array<float,2>{0.779901683f, 0.212024823f},
-std::array<float,2>{0.201597795f, 0.00266808621f},
-std::array<float,2>{0.997048259f, 0.978621423f},
-std::array<float,2>{0.257730126f, 0.612003863f},
-std::array<float,2>{0.637749612f, 0.416059226f},
-std::array<float,2>{0.219625711f, 0.490718603f},
-std::array<float,2>{0.955891132f, 0.512785375f},
-std::array<float,2>{0.287433267f, 0.88280642f},
-std::array<float,2>{0.674162924f, 0.0920526162f},
-std::array<float,2>{0.47233519f, 0.149424717f},
-std::array<float,2>{0.586318374f, 0.770210147f},
-std::array<float,2>{0.0192375239f, 0.72060585f},
-std::array<float,2>{0.786425292f, 0.331238419f},
-std::array<float,2>{0.319168955f, 0.295062035f},
-std::array<float,2>{0.715692639f, 0.667251647f},
-std::array<float,2>{0.148570225f, 0.81718868f},
-std::array<float,2>{0.890960574f, 0.218019038f},
-std::array<float,2>{0.0987858847f, 0.00413433369f},
-std::array<float,2>{0.868843377f, 0.981325626f},
-std::array<float,2>{0.430634975f, 0.616112411f},
-std::array<float,2>{0.538741708f, 0.419774175f},
-std::array<float,2>{0.053362146f, 0.359817117f},
-std::array<float,2>{0.750721693f, 0.717960715f},
-std::array<float,2>{0.46697405f, 0.794639766f},
-std::array<float,2>{0.598272979f, 0.181335986f},
-std::array<float,2>{0.280704468f, 0.0950685889f},
-std::array<float,2>{0.651619732f, 0.934516847f},
-std::array<float,2>{0.208089024f, 0.549174607f},
-std::array<float,2>{0.977580726f, 0.449266553f},
-std::array<float,2>{0.383857936f, 0.403508484f},
-std::array<float,2>{0.531083643f, 0.574868381f},
-std::array<float,2>{0.0838769004f, 0.967808425f},
-std::array<float,2>{0.842351437f, 0.0485679135f},
-std::array<float,2>{0.17044729f, 0.245116606f},
-std::array<float,2>{0.913408816f, 0.870513678f},
-std::array<float,2>{0.374922603f, 0.649543643f},
-std::array<float,2>{0.74731493f, 0.279591978f},
-std::array<float,2>{0.128840104f, 0.256844431f},
-std::array<float,2>{0.87852186f, 0.631516099f},
-std::array<float,2>{0.331962317f, 0.856811523f},
-std::array<float,2>{0.687878788f, 0.232430235f},
-std::array<float,2>{0.418275356f, 0.0320819281f},
-std::array<float,2>{0.559756577f, 0.948704183f},
-std::array<float,2>{0.121026501f, 0.586866796f},
-std::array<float,2>{0.844221592f, 0.389708132f},
-std::array<float,2>{0.302685112f, 0.466399193f},
-std::array<float,2>{0.667669415f, 0.5333125f},
-std::array<float,2>{0.248929992f, 0.914508879f},
-std::array<float,2>{0.938055873f, 0.123160467f},
-std::array<float,2>{0.011326272f, 0.167928025f},
-std::array<float,2>{0.804437518f, 0.801657379f},
-std::array<float,2>{0.496075571f, 0.694442451f},
-std::array<float,2>{0.567055404f, 0.357733369f},
-std::array<float,2>{0.0744492114f, 0.433328897f},
-std::array<float,2>{0.8176319f, 0.604120314f},
-std::array<float,2>{0.398471504f, 0.994725347f},
-std::array<float,2>{0.50607425f, 0.0192562658f},
-std::array<float,2>{0.345818251f, 0.198901936f},
-std::array<float,2>{0.730458975f, 0.828346848f},
-std::array<float,2>{0.18576546f, 0.672206163f},
-std::array<float,2>{0.923412979f, 0.299209625f},
-std::array<float,2>{0.447522074f, 0.326333135f},
-std::array<float,2>{0.624218524f, 0.747784793f},
-std::array<float,2>{0.0363272168f, 0.752016306f},
-std::array<float,2>{0.7704283f, 0.137657002f},
-std::array<float,2>{0.190464437f, 0.0714469105f},
-std::array<float,2>{0.987642348f, 0.896818817f},
-std::array<float,2>{0.265038908f, 0.518240571f},
-std::array<float,2>{0.628997803f, 0.476609826f},
-std::array<float,2>{0.177650124f, 0.377929658f},
-std::array<float,2>{0.935185075f, 0.585833192f},
-std::array<float,2>{0.357990563f, 0.939305544f},
-std::array<float,2>{0.725246191f, 0.0403423496f},
-std::array<float,2>{0.398375481f, 0.224636868f},
-std::array<float,2>{0.51044178f, 0.850349844f},
-std::array<float,2>{0.0686500221f, 0.637885928f},
-std::array<float,2>{0.827970386f, 0.265292376f},
-std::array<float,2>{0.250943571f, 0.349232376f},
-std::array<float,2>{0.634669721f, 0.702010691f},
-std::array<float,2>{0.198776349f, 0.807410836f},
-std::array<float,2>{0.995696425f, 0.158936054f},
-std::array<float,2>{0.0459938236f, 0.116049923f},
-std::array<float,2>{0.775895417f, 0.906470597f},
-std::array<float,2>{0.438068688f, 0.546412826f},
-std::array<float,2>{0.609802485f, 0.455120623f},
-std::array<float,2>{0.111212507f, 0.304811597f},
-std::array<float,2>{0.857205391f, 0.68184334f},
-std::array<float,2>{0.41027835f, 0.841837168f},
-std::array<float,2>{0.550215304f, 0.188900441f},
-std::array<float,2>{0.342423648f, 0.0302651078f},
-std::array<float,2>{0.699926853f, 0.987087071f},
-std::array<float,2>{0.134726807f, 0.59491545f},
-std::array<float,2>{0.883021474f, 0.422186404f},
-std::array<float,2>{0.487930924f, 0.470780015f},
-std::array<float,2>{0.576989055f, 0.528331816f},
-std::array<float,2>{0.00167382357f, 0.899561465f},
-std::array<float,2>{0.811139941f, 0.0639320314f},
-std::array<float,2>{0.237006649f, 0.129512474f},
-std::array<float,2>{0.950865149f, 0.759794652f},
-std::array<float,2>{0.305490345f, 0.739830732f},
-std::array<float,2>{0.658935368f, 0.317431957f},
-std::array<float,2>{0.215682447f, 0.33604902f},
-std::array<float,2>{0.974167049f, 0.732874691f},
-std::array<float,2>{0.272476315f, 0.775179267f},
-std::array<float,2>{0.64799583f, 0.145634919f},
-std::array<float,2>{0.459623814f, 0.0818010047f},
-std::array<float,2>{0.604604661f, 0.886175215f},
-std::array<float,2>{0.0606552921f, 0.504284263f},
-std::array<float,2>{0.763711214f, 0.493208528f},
-std::array<float,2>{0.361106128f, 0.412678242f},
-std::array<float,2>{0.741326749f, 0.624115109f},
-std::array<float,2>{0.157094866f, 0.97057575f},
-std::array<float,2>{0.916916907f, 0.0106168771f},
-std::array<float,2>{0.0867106691f, 0.205266818f},
-std::array<float,2>{0.833124161f, 0.821023226f},
-std::array<float,2>{0.382715762f, 0.658125281f},
-std::array<float,2>{0.522532165f, 0.286438525f},
-std::array<float,2>{0.0305682141f, 0.437801749f},
-std::array<float,2>{0.789646029f, 0.561883569f},
-std::array<float,2>{0.480209827f, 0.929647863f},
-std::array<float,2>{0.581094801f, 0.102303088f},
-std::array<float,2>{0.289131135f, 0.179336444f},
-std::array<float,2>{0.68555373f, 0.786081851f},
-std::array<float,2>{0.229275778f, 0.707709253f},
-std::array<float,2>{0.962000012f, 0.372737944f},
-std::array<float,2>{0.426140875f, 0.269779146f},
-std::array<float,2>{0.541933417f, 0.640631557f},
-std::array<float,2>{0.10258399f, 0.863601148f},
-std::array<float,2>{0.860563576f, 0.242045656f},
-std::array<float,2>{0.146884069f, 0.0560868979f},
-std::array<float,2>{0.905692637f, 0.957379997f},
-std::array<float,2>{0.326934397f, 0.563454866f},
-std::array<float,2>{0.71080333f, 0.395633072f},
-std::array<float,2>{0.156033084f, 0.46027565f},
-std::array<float,2>{0.897491336f, 0.542368054f},
-std::array<float,2>{0.315990686f, 0.91096288f},
-std::array<float,2>{0.712465644f, 0.112604693f},
-std::array<float,2>{0.437238216f, 0.163012013f},
-std::array<float,2>{0.534195602f, 0.810755372f},
-std::array<float,2>{0.0968821794f, 0.698037088f},
-std::array<float,2>{0.872990727f, 0.344767988f},
-std::array<float,2>{0.281399578f, 0.25978756f},
-std::array<float,2>{0.679322362f, 0.634701252f},
-std::array<float,2>{0.226231605f, 0.845464468f},
-std::array<float,2>{0.960672677f, 0.221786782f},
-std::array<float,2>{0.0203705076f, 0.0450729281f},
-std::array<float,2>{0.781733692f, 0.941951811f},
-std::array<float,2>{0.472852468f, 0.579236031f},
-std::array<float,2>{0.591967106f, 0.381135345f},
-std::array<float,2>{0.080351375f, 0.314481646f},
-std::array<float,2>{0.836589277f, 0.736149609f},
-std::array<float,2>{0.389203161f, 0.761876166f},
-std::array<float,2>{0.525490701f, 0.125158176f},
-std::array<float,2>{0.367930084f, 0.0679009929f},
-std::array<float,2>{0.745315969f, 0.905312419f},
-std::array<float,2>{0.166398957f, 0.524561524f},
-std::array<float,2>{0.908636808f, 0.473714858f},
-std::array<float,2>{0.461478531f, 0.426074177f},
-std::array<float,2>{0.595588386f, 0.598421872f},
-std::array<float,2>{0.0482077897f, 0.991548836f},
-std::array<float,2>{0.755291164f, 0.0262354296f},
-std::array<float,2>{0.206934616f, 0.194722131f},
-std::array<float,2>{0.983097374f, 0.836101711f},
-std::array<float,2>{0.276583791f, 0.684061229f},
-std::array<float,2>{0.655623734f, 0.311098337f},
-std::array<float,2>{0.245763302f, 0.283929825f},
-std::array<float,2>{0.942140996f, 0.66219759f},
-std::array<float,2>{0.300410002f, 0.827375412f},
-std::array<float,2>{0.669424653f, 0.208225131f},
-std::array<float,2>{0.498999774f, 0.0134056471f},
-std::array<float,2>{0.566222787f, 0.974856317f},
-std::array<float,2>{0.0137115605f, 0.617361605f},
-std::array<float,2>{0.797112644f, 0.406896383f},
-std::array<float,2>{0.333504021f, 0.497534931f},
-std::array<float,2>{0.69158113f, 0.501615584f},
-std::array<float,2>{0.129938632f, 0.887638032f},
-std::array<float,2>{0.881597638f, 0.0822900385f},
-std::array<float,2>{0.123131759f, 0.144146159f},
-std::array<float,2>{0.848127902f, 0.779167056f},
-std::array<float,2>{0.416261107f, 0.727458417f},
-std::array<float,2>{0.555995882f, 0.341792077f},
-std::array<float,2>{0.0337706953f, 0.391185969f},
-std::array<float,2>{0.765807271f, 0.566516101f},
-std::array<float,2>{0.452912748f, 0.953318417f},
-std::array<float,2>{0.619660735f, 0.0607557781f},
-std::array<float,2>{0.259576321f, 0.236109778f},
-std::array<float,2>{0.625198305f, 0.861742854f},
-std::array<float,2>{0.194977313f, 0.647667944f},
-std::array<float,2>{0.991544783f, 0.268226832f},
-std::array<float,2>{0.403301954f, 0.367247224f},
-std::array<float,2>{0.500364125f, 0.706736743f},
-std::array<float,2>{0.074033536f, 0.78241086f},
-std::array<float,2>{0.814198911f, 0.173704997f},
-std::array<float,2>{0.181779772f, 0.105964318f},
-std::array<float,2>{0.927752018f, 0.924212456f},
-std::array<float,2>{0.349721223f, 0.555499017f},
-std::array<float,2>{0.732288718f, 0.44412306f},
-std::array<float,2>{0.201029912f, 0.417491555f},
-std::array<float,2>{0.999404967f, 0.612761259f},
-std::array<float,2>{0.254219383f, 0.979620695f},
-std::array<float,2>{0.640600562f, 0.00360914879f},
-std::array<float,2>{0.442443967f, 0.211697027f},
-std::array<float,2>{0.613515019f, 0.813192248f},
-std::array<float,2>{0.039177306f, 0.669002533f},
-std::array<float,2>{0.778395593f, 0.290645629f},
-std::array<float,2>{0.354463607f, 0.335031211f},
-std::array<float,2>{0.720498741f, 0.724530876f},
-std::array<float,2>{0.175052404f, 0.76852107f},
-std::array<float,2>{0.930939674f, 0.155891448f},
-std::array<float,2>{0.0637557805f, 0.0891696066f},
-std::array<float,2>{0.822952271f, 0.876929998f},
-std::array<float,2>{0.391128868f, 0.510380924f},
-std::array<float,2>{0.512818396f, 0.48629564f},
-std::array<float,2>{0.00700356439f, 0.276284963f},
-std::array<float,2>{0.805292189f, 0.653033912f},
-std::array<float,2>{0.49164477f, 0.871176898f},
-std::array<float,2>{0.57041049f, 0.248150915f},
-std::array<float,2>{0.312131375f, 0.054083284f},
-std::array<float,2>{0.661788642f, 0.961199045f},
-std::array<float,2>{0.240958631f, 0.572628975f},
-std::array<float,2>{0.947384357f, 0.400483042f},
-std::array<float,2>{0.408161759f, 0.447927475f},
-std::array<float,2>{0.553149819f, 0.550903976f},
-std::array<float,2>{0.113523215f, 0.930885434f},
-std::array<float,2>{0.851992428f, 0.100659423f},
-std::array<float,2>{0.139093369f, 0.186884299f},
-std::array<float,2>{0.88712889f, 0.79028219f},
-std::array<float,2>{0.338418186f, 0.712437153f},
-std::array<float,2>{0.695701778f, 0.364400804f},
-std::array<float,2>{0.161322519f, 0.354542971f},
-std::array<float,2>{0.920769632f, 0.689190328f},
-std::array<float,2>{0.364802986f, 0.798369288f},
-std::array<float,2>{0.737670839f, 0.16848582f},
-std::array<float,2>{0.376073182f, 0.120003648f},
-std::array<float,2>{0.517511606f, 0.921844721f},
-std::array<float,2>{0.0908640102f, 0.537300944f},
-std::array<float,2>{0.8312006f, 0.461797118f},
-std::array<float,2>{0.268158376f, 0.384093791f},
-std::array<float,2>{0.643288493f, 0.593124628f},
-std::array<float,2>{0.21433647f, 0.950647771f},
-std::array<float,2>{0.968851686f, 0.0373076573f},
-std::array<float,2>{0.0581346639f, 0.230306074f},
-std::array<float,2>{0.760075331f, 0.853457987f},
-std::array<float,2>{0.456230998f, 0.62861526f},
-std::array<float,2>{0.608899057f, 0.251461357f},
-std::array<float,2>{0.107591853f, 0.481814444f},
-std::array<float,2>{0.866585791f, 0.519973993f},
-std::array<float,2>{0.42415607f, 0.893776238f},
-std::array<float,2>{0.543525994f, 0.0767033845f},
-std::array<float,2>{0.322981447f, 0.133106738f},
-std::array<float,2>{0.704388618f, 0.755799949f},
-std::array<float,2>{0.143843293f, 0.744746923f},
-std::array<float,2>{0.901947618f, 0.322593331f},
-std::array<float,2>{0.483666658f, 0.300962985f},
-std::array<float,2>{0.585294783f, 0.679026604f},
-std::array<float,2>{0.0271962415f, 0.834211051f},
-std::array<float,2>{0.795941591f, 0.200292096f},
-std::array<float,2>{0.230974674f, 0.0207451507f},
-std::array<float,2>{0.967270792f, 0.99999541f},
-std::array<float,2>{0.294130236f, 0.609101653f},
-std::array<float,2>{0.682945788f, 0.434966892f},
-std::array<float,2>{0.209597334f, 0.451248378f},
-std::array<float,2>{0.980237544f, 0.548323572f},
-std::array<float,2>{0.278797507f, 0.935598373f},
-std::array<float,2>{0.650277853f, 0.0965013951f},
-std::array<float,2>{0.46648249f, 0.183125496f},
-std::array<float,2>{0.600206614f, 0.796016514f},
-std::array<float,2>{0.052468814f, 0.715376854f},
-std::array<float,2>{0.752587318f, 0.362763166f},
-std::array<float,2>{0.372290134f, 0.278771251f},
-std::array<float,2>{0.749750137f, 0.652217269f},
-std::array<float,2>{0.169504419f, 0.867620587f},
-std::array<float,2>{0.911544979f, 0.242824525f},
-std::array<float,2>{0.0847525597f, 0.0500731431f},
-std::array<float,2>{0.839980304f, 0.96599865f},
-std::array<float,2>{0.385816664f, 0.577974617f},
-std::array<float,2>{0.528166533f, 0.404453278f},
-std::array<float,2>{0.0169034638f, 0.328932226f},
-std::array<float,2>{0.787219107f, 0.721660733f},
-std::array<float,2>{0.469877362f, 0.773112476f},
-std::array<float,2>{0.58983165f, 0.150533438f},
-std::array<float,2>{0.285829067f, 0.0907666758f},
-std::array<float,2>{0.6734218f, 0.879739463f},
-std::array<float,2>{0.221469253f, 0.514693856f},
-std::array<float,2>{0.953342974f, 0.488517821f},
-std::array<float,2>{0.433545023f, 0.421810031f},
-std::array<float,2>{0.53574425f, 0.614341497f},
-std::array<float,2>{0.10136719f, 0.983749986f},
-std::array<float,2>{0.869278491f, 0.00753191207f},
-std::array<float,2>{0.151999623f, 0.215572923f},
-std::array<float,2>{0.893930495f, 0.82021457f},
-std::array<float,2>{0.317222208f, 0.665843844f},
-std::array<float,2>{0.718444228f, 0.293945372f},
-std::array<float,2>{0.185264021f, 0.297277629f},
-std::array<float,2>{0.924829423f, 0.673851967f},
-std::array<float,2>{0.344988048f, 0.830981433f},
-std::array<float,2>{0.72848773f, 0.195480838f},
-std::array<float,2>{0.401137859f, 0.0157914143f},
-std::array<float,2>{0.504392803f, 0.993655264f},
-std::array<float,2>{0.077762723f, 0.602354705f},
-std::array<float,2>{0.819734573f, 0.430582851f},
-std::array<float,2>{0.262238979f, 0.479799896f},
-std::array<float,2>{0.630879879f, 0.517226398f},
-std::array<float,2>{0.188835621f, 0.894752026f},
-std::array<float,2>{0.984814644f, 0.0738758296f},
-std::array<float,2>{0.038678661f, 0.139519095f},
-std::array<float,2>{0.772730768f, 0.750167489f},
-std::array<float,2>{0.446638942f, 0.749920905f},
-std::array<float,2>{0.622398019f, 0.325146258f},
-std::array<float,2>{0.117812105f, 0.388419777f},
-std::array<float,2>{0.847496867f, 0.5880391f},
-std::array<float,2>{0.420432627f, 0.945711315f},
-std::array<float,2>{0.560977578f, 0.0342450812f},
-std::array<float,2>{0.329862118f, 0.230750024f},
-std::array<float,2>{0.690740168f, 0.858682871f},
-std::array<float,2>{0.1256354f, 0.629221916f},
-std::array<float,2>{0.875259757f, 0.255743146f},
-std::array<float,2>{0.492627621f, 0.356460035f},
-std::array<float,2>{0.569267988f, 0.693150699f},
-std::array<float,2>{0.00944167282f, 0.803362489f},
-std::array<float,2>{0.801500738f, 0.164204687f},
-std::array<float,2>{0.246931925f, 0.12224061f},
-std::array<float,2>{0.940808594f, 0.917464554f},
-std::array<float,2>{0.303595871f, 0.531867027f},
-std::array<float,2>{0.665058553f, 0.468212485f},
-std::array<float,2>{0.136580035f, 0.424005628f},
-std::array<float,2>{0.885809362f, 0.595719993f},
-std::array<float,2>{0.340657651f, 0.984939158f},
-std::array<float,2>{0.702346861f, 0.0282451976f},
-std::array<float,2>{0.413683504f, 0.190696627f},
-std::array<float,2>{0.547930598f, 0.841731846f},
-std::array<float,2>{0.112401307f, 0.681440651f},
-std::array<float,2>{0.859338164f, 0.307125866f},
-std::array<float,2>{0.307294577f, 0.318722248f},
-std::array<float,2>{0.657292902f, 0.741444707f},
-std::array<float,2>{0.23510161f, 0.759164274f},
-std::array<float,2>{0.952241659f, 0.131726056f},
-std::array<float,2>{0.00308351079f, 0.0650372952f},
-std::array<float,2>{0.80988431f, 0.900829911f},
-std::array<float,2>{0.485806733f, 0.530370533f},
-std::array<float,2>{0.575665236f, 0.468995154f},
-std::array<float,2>{0.067199856f, 0.262049586f},
-std::array<float,2>{0.824305534f, 0.638973892f},
-std::array<float,2>{0.39617905f, 0.847885311f},
-std::array<float,2>{0.508333862f, 0.224137649f},
-std::array<float,2>{0.356724679f, 0.0424932316f},
-std::array<float,2>{0.724472761f, 0.940306246f},
-std::array<float,2>{0.178512722f, 0.582070768f},
-std::array<float,2>{0.936605036f, 0.376784623f},
-std::array<float,2>{0.440832555f, 0.454160839f},
-std::array<float,2>{0.613000691f, 0.544145286f},
-std::array<float,2>{0.0443003289f, 0.910127521f},
-std::array<float,2>{0.775133789f, 0.114557609f},
-std::array<float,2>{0.195752785f, 0.156948701f},
-std::array<float,2>{0.993902326f, 0.806083679f},
-std::array<float,2>{0.252897054f, 0.700277507f},
-std::array<float,2>{0.634820402f, 0.350009412f},
-std::array<float,2>{0.22670792f, 0.373401701f},
-std::array<float,2>{0.963395298f, 0.710426986f},
-std::array<float,2>{0.292016327f, 0.788585126f},
-std::array<float,2>{0.684757531f, 0.17661339f},
-std::array<float,2>{0.477304339f, 0.105217002f},
-std::array<float,2>{0.579585314f, 0.926116586f},
-std::array<float,2>{0.0288296007f, 0.559800982f},
-std::array<float,2>{0.792434931f, 0.440269053f},
-std::array<float,2>{0.324644744f, 0.396847188f},
-std::array<float,2>{0.708014965f, 0.565145791f},
-std::array<float,2>{0.144585088f, 0.960884273f},
-std::array<float,2>{0.903080225f, 0.0583656207f},
-std::array<float,2>{0.104876004f, 0.240141064f},
-std::array<float,2>{0.861526668f, 0.865706086f},
-std::array<float,2>{0.428951204f, 0.642810583f},
-std::array<float,2>{0.540340722f, 0.272095263f},
-std::array<float,2>{0.0587140135f, 0.494728535f},
-std::array<float,2>{0.761857271f, 0.507164299f},
-std::array<float,2>{0.457186162f, 0.883199871f},
-std::array<float,2>{0.602491021f, 0.0798405707f},
-std::array<float,2>{0.269716948f, 0.147949845f},
-std::array<float,2>{0.645962119f, 0.776298881f},
-std::array<float,2>{0.217898533f, 0.7305758f},
-std::array<float,2>{0.976437271f, 0.339016885f},
-std::array<float,2>{0.380229861f, 0.287400931f},
-std::array<float,2>{0.520946503f, 0.65835613f},
-std::array<float,2>{0.0889286548f, 0.823709249f},
-std::array<float,2>{0.834884942f, 0.203969225f},
-std::array<float,2>{0.160072997f, 0.00792087056f},
-std::array<float,2>{0.915313363f, 0.970851719f},
-std::array<float,2>{0.362846285f, 0.622029483f},
-std::array<float,2>{0.738557637f, 0.411056906f},
-std::array<float,2>{0.164374828f, 0.475050002f},
-std::array<float,2>{0.906497836f, 0.527216017f},
-std::array<float,2>{0.36926204f, 0.903777719f},
-std::array<float,2>{0.742609322f, 0.0687476993f},
-std::array<float,2>{0.388494074f, 0.127906889f},
-std::array<float,2>{0.524177611f, 0.765585065f},
-std::array<float,2>{0.0797028244f, 0.736803532f},
-std::array<float,2>{0.83894527f, 0.313035041f},
-std::array<float,2>{0.274303555f, 0.310295165f},
-std::array<float,2>{0.653076231f, 0.686735153f},
-std::array<float,2>{0.204323411f, 0.838111639f},
-std::array<float,2>{0.982269943f, 0.191871941f},
-std::array<float,2>{0.0489462949f, 0.0244541243f},
-std::array<float,2>{0.757296145f, 0.990052998f},
-std::array<float,2>{0.463658512f, 0.600092947f},
-std::array<float,2>{0.597645164f, 0.428805351f},
-std::array<float,2>{0.094533205f, 0.346020222f},
-std::array<float,2>{0.873544037f, 0.696470439f},
-std::array<float,2>{0.435125619f, 0.810036838f},
-std::array<float,2>{0.532229125f, 0.161911383f},
-std::array<float,2>{0.312634379f, 0.109860435f},
-std::array<float,2>{0.713648796f, 0.912568092f},
-std::array<float,2>{0.153028145f, 0.539104819f},
-std::array<float,2>{0.896452963f, 0.457252115f},
-std::array<float,2>{0.475350887f, 0.380798042f},
-std::array<float,2>{0.590841591f, 0.580960631f},
-std::array<float,2>{0.0219992623f, 0.943490982f},
-std::array<float,2>{0.784047544f, 0.043684084f},
-std::array<float,2>{0.224404484f, 0.21937722f},
-std::array<float,2>{0.957347691f, 0.847153246f},
-std::array<float,2>{0.283216894f, 0.636390328f},
-std::array<float,2>{0.676856399f, 0.258191496f},
-std::array<float,2>{0.192423061f, 0.266510725f},
-std::array<float,2>{0.989255786f, 0.644667625f},
-std::array<float,2>{0.261532396f, 0.861137211f},
-std::array<float,2>{0.627988279f, 0.236456886f},
-std::array<float,2>{0.449653625f, 0.0603452995f},
-std::array<float,2>{0.618214607f, 0.956685901f},
-std::array<float,2>{0.033143919f, 0.568640947f},
-std::array<float,2>{0.768286467f, 0.392765313f},
-std::array<float,2>{0.348474652f, 0.441448033f},
-std::array<float,2>{0.733364463f, 0.557074189f},
-std::array<float,2>{0.181493849f, 0.922805965f},
-std::array<float,2>{0.926082134f, 0.108030632f},
-std::array<float,2>{0.0714252219f, 0.174230888f},
-std::array<float,2>{0.815801859f, 0.784482598f},
-std::array<float,2>{0.40546f, 0.703154266f},
-std::array<float,2>{0.503759682f, 0.370073259f},
-std::array<float,2>{0.0129936347f, 0.409237146f},
-std::array<float,2>{0.799222112f, 0.61954248f},
-std::array<float,2>{0.497094929f, 0.973761559f},
-std::array<float,2>{0.564289451f, 0.0154163847f},
-std::array<float,2>{0.297340631f, 0.210052267f},
-std::array<float,2>{0.671568871f, 0.826123238f},
-std::array<float,2>{0.242459878f, 0.660603404f},
-std::array<float,2>{0.943663716f, 0.281461746f},
-std::array<float,2>{0.415486544f, 0.343082368f},
-std::array<float,2>{0.55675143f, 0.729812503f},
-std::array<float,2>{0.121428184f, 0.780289471f},
-std::array<float,2>{0.850839376f, 0.14205043f},
-std::array<float,2>{0.132395253f, 0.0848862752f},
-std::array<float,2>{0.879631698f, 0.889364243f},
-std::array<float,2>{0.334261268f, 0.50337261f},
-std::array<float,2>{0.69494915f, 0.498308092f},
-std::array<float,2>{0.238967881f, 0.400329798f},
-std::array<float,2>{0.946455777f, 0.572025239f},
-std::array<float,2>{0.309004992f, 0.964711547f},
-std::array<float,2>{0.662324786f, 0.0521747619f},
-std::array<float,2>{0.488886684f, 0.246771783f},
-std::array<float,2>{0.573494732f, 0.874796927f},
-std::array<float,2>{0.00521133607f, 0.655200601f},
-std::array<float,2>{0.807276726f, 0.274943084f},
-std::array<float,2>{0.337814599f, 0.366743922f},
-std::array<float,2>{0.697517395f, 0.714090347f},
-std::array<float,2>{0.138003796f, 0.792461812f},
-std::array<float,2>{0.88981998f, 0.184434727f},
-std::array<float,2>{0.116892718f, 0.0985333249f},
-std::array<float,2>{0.854141712f, 0.93347913f},
-std::array<float,2>{0.408345103f, 0.554089367f},
-std::array<float,2>{0.551673472f, 0.447263747f},
-std::array<float,2>{0.0420461036f, 0.2920672f},
-std::array<float,2>{0.780584931f, 0.671154439f},
-std::array<float,2>{0.444851995f, 0.815524161f},
-std::array<float,2>{0.616330922f, 0.214219034f},
-std::array<float,2>{0.256130099f, 0.00134926056f},
-std::array<float,2>{0.637444675f, 0.976658821f},
-std::array<float,2>{0.202694476f, 0.61075604f},
-std::array<float,2>{0.997889698f, 0.414397746f},
-std::array<float,2>{0.392834008f, 0.487449259f},
-std::array<float,2>{0.515507579f, 0.508163214f},
-std::array<float,2>{0.0652036816f, 0.877788484f},
-std::array<float,2>{0.821890175f, 0.0877758637f},
-std::array<float,2>{0.172412127f, 0.153942972f},
-std::array<float,2>{0.932517648f, 0.766768396f},
-std::array<float,2>{0.352903038f, 0.725878835f},
-std::array<float,2>{0.721831918f, 0.332259685f},
-std::array<float,2>{0.141796112f, 0.320929915f},
-std::array<float,2>{0.900215328f, 0.742451549f},
-std::array<float,2>{0.320319504f, 0.757687628f},
-std::array<float,2>{0.706618488f, 0.135380059f},
-std::array<float,2>{0.423034608f, 0.0756510869f},
-std::array<float,2>{0.546410501f, 0.890889943f},
-std::array<float,2>{0.106490456f, 0.523223341f},
-std::array<float,2>{0.863908947f, 0.484119207f},
-std::array<float,2>{0.29525879f, 0.436047256f},
-std::array<float,2>{0.680425823f, 0.60707289f},
-std::array<float,2>{0.232510373f, 0.99692899f},
-std::array<float,2>{0.965947568f, 0.0227929447f},
-std::array<float,2>{0.0242198836f, 0.202612698f},
-std::array<float,2>{0.79300952f, 0.833127439f},
-std::array<float,2>{0.481976062f, 0.67707324f},
-std::array<float,2>{0.583662391f, 0.303712636f},
-std::array<float,2>{0.0934101641f, 0.464285165f},
-std::array<float,2>{0.829342127f, 0.535164833f},
-std::array<float,2>{0.377361596f, 0.919622242f},
-std::array<float,2>{0.519442022f, 0.117206611f},
-std::array<float,2>{0.365996271f, 0.171833187f},
-std::array<float,2>{0.735890746f, 0.798943043f},
-std::array<float,2>{0.163881689f, 0.689865589f},
-std::array<float,2>{0.918668509f, 0.353444874f},
-std::array<float,2>{0.453332007f, 0.253133386f},
-std::array<float,2>{0.60552156f, 0.626219094f},
-std::array<float,2>{0.0557182282f, 0.853673875f},
-std::array<float,2>{0.759369195f, 0.226892695f},
-std::array<float,2>{0.211363941f, 0.0358539075f},
-std::array<float,2>{0.972173333f, 0.952883482f},
-std::array<float,2>{0.265784889f, 0.590884507f},
-std::array<float,2>{0.642360866f, 0.385276377f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.95174408f, 0.649296165f},
-std::array<float,2>{0.292799354f, 0.0508923233f},
-std::array<float,2>{0.220001116f, 0.945777595f},
-std::array<float,2>{0.634422481f, 0.266493231f},
-std::array<float,2>{0.531856358f, 0.820404768f},
-std::array<float,2>{0.0447788499f, 0.460834891f},
-std::array<float,2>{0.446487546f, 0.518892527f},
-std::array<float,2>{0.795969188f, 0.201150671f},
-std::array<float,2>{0.708567083f, 0.60481298f},
-std::array<float,2>{0.162372559f, 0.173551396f},
-std::array<float,2>{0.316318423f, 0.804444134f},
-std::array<float,2>{0.892320216f, 0.404746532f},
-std::array<float,2>{0.830123663f, 0.88556999f},
-std::array<float,2>{0.394829005f, 0.338411242f},
-std::array<float,2>{0.0904955789f, 0.694822013f},
-std::array<float,2>{0.577796161f, 0.0737219527f},
-std::array<float,2>{0.77980715f, 0.544085622f},
-std::array<float,2>{0.48027274f, 0.228017911f},
-std::array<float,2>{0.000847181072f, 0.844862819f},
-std::array<float,2>{0.50297308f, 0.473348439f},
-std::array<float,2>{0.680057764f, 0.988553822f},
-std::array<float,2>{0.211900905f, 0.304873109f},
-std::array<float,2>{0.278458178f, 0.680994868f},
-std::array<float,2>{0.985564709f, 0.0089037586f},
-std::array<float,2>{0.624612451f, 0.731307864f},
-std::array<float,2>{0.104291201f, 0.100547381f},
-std::array<float,2>{0.435717791f, 0.932024419f},
-std::array<float,2>{0.86620611f, 0.366223246f},
-std::array<float,2>{0.918482423f, 0.77084595f},
-std::array<float,2>{0.347001255f, 0.413987488f},
-std::array<float,2>{0.140466392f, 0.579385698f},
-std::array<float,2>{0.731263816f, 0.151263177f},
-std::array<float,2>{0.884460092f, 0.568515778f},
-std::array<float,2>{0.338400573f, 0.137290791f},
-std::array<float,2>{0.181366146f, 0.760653496f},
-std::array<float,2>{0.701771557f, 0.435689956f},
-std::array<float,2>{0.583001912f, 0.915189981f},
-std::array<float,2>{0.066828765f, 0.357244432f},
-std::array<float,2>{0.37699163f, 0.739534318f},
-std::array<float,2>{0.813855708f, 0.11327529f},
-std::array<float,2>{0.649043262f, 0.656692505f},
-std::array<float,2>{0.239002198f, 0.0179412495f},
-std::array<float,2>{0.302743942f, 0.977713943f},
-std::array<float,2>{0.954544067f, 0.294860184f},
-std::array<float,2>{0.808992207f, 0.874774158f},
-std::array<float,2>{0.463567823f, 0.49058947f},
-std::array<float,2>{0.0478753895f, 0.547695637f},
-std::array<float,2>{0.554545105f, 0.245653465f},
-std::array<float,2>{0.849026203f, 0.704705834f},
-std::array<float,2>{0.418712318f, 0.0789210871f},
-std::array<float,2>{0.115948319f, 0.901705742f},
-std::array<float,2>{0.59908098f, 0.312905103f},
-std::array<float,2>{0.745494187f, 0.790603399f},
-std::array<float,2>{0.150825083f, 0.381641656f},
-std::array<float,2>{0.373458803f, 0.61766088f},
-std::array<float,2>{0.93013072f, 0.157947257f},
-std::array<float,2>{0.521670222f, 0.515264332f},
-std::array<float,2>{0.0265195165f, 0.21777235f},
-std::array<float,2>{0.498298615f, 0.837829769f},
-std::array<float,2>{0.752640128f, 0.446659207f},
-std::array<float,2>{0.98130995f, 0.966843903f},
-std::array<float,2>{0.258972645f, 0.262240261f},
-std::array<float,2>{0.188468784f, 0.634764016f},
-std::array<float,2>{0.667936027f, 0.0319570899f},
-std::array<float,2>{0.927573681f, 0.745928288f},
-std::array<float,2>{0.362062365f, 0.120156817f},
-std::array<float,2>{0.141984284f, 0.912029386f},
-std::array<float,2>{0.739900053f, 0.35139358f},
-std::array<float,2>{0.603470802f, 0.754598379f},
-std::array<float,2>{0.124612868f, 0.428311139f},
-std::array<float,2>{0.40676707f, 0.576599956f},
-std::array<float,2>{0.857576072f, 0.125383988f},
-std::array<float,2>{0.656424701f, 0.558860302f},
-std::array<float,2>{0.198901206f, 0.237429291f},
-std::array<float,2>{0.250135452f, 0.859431207f},
-std::array<float,2>{0.975516319f, 0.497170269f},
-std::array<float,2>{0.761512995f, 0.96992892f},
-std::array<float,2>{0.488577187f, 0.288821936f},
-std::array<float,2>{0.0221636742f, 0.668360293f},
-std::array<float,2>{0.52933073f, 0.0299184434f},
-std::array<float,2>{0.823013425f, 0.615951061f},
-std::array<float,2>{0.388064891f, 0.166189685f},
-std::array<float,2>{0.0721705705f, 0.785049558f},
-std::array<float,2>{0.592696488f, 0.38681066f},
-std::array<float,2>{0.693633676f, 0.894321144f},
-std::array<float,2>{0.172232136f, 0.327849388f},
-std::array<float,2>{0.335455716f, 0.717214406f},
-std::array<float,2>{0.881610751f, 0.0902919918f},
-std::array<float,2>{0.560759902f, 0.625143707f},
-std::array<float,2>{0.0621934533f, 0.0395912789f},
-std::array<float,2>{0.460382074f, 0.95459193f},
-std::array<float,2>{0.80463165f, 0.255469233f},
-std::array<float,2>{0.967463791f, 0.83131969f},
-std::array<float,2>{0.310472071f, 0.439565092f},
-std::array<float,2>{0.242623374f, 0.503832459f},
-std::array<float,2>{0.645864427f, 0.203559473f},
-std::array<float,2>{0.992233515f, 0.523987293f},
-std::array<float,2>{0.271297216f, 0.19061695f},
-std::array<float,2>{0.206947684f, 0.819812357f},
-std::array<float,2>{0.678556204f, 0.467804521f},
-std::array<float,2>{0.507929564f, 0.939517558f},
-std::array<float,2>{0.00918044988f, 0.279421002f},
-std::array<float,2>{0.47602731f, 0.642886698f},
-std::array<float,2>{0.772699893f, 0.0559547916f},
-std::array<float,2>{0.719627619f, 0.699441016f},
-std::array<float,2>{0.131235957f, 0.0697459504f},
-std::array<float,2>{0.35828945f, 0.875014663f},
-std::array<float,2>{0.913472593f, 0.329760164f},
-std::array<float,2>{0.86865139f, 0.805290997f},
-std::array<float,2>{0.424438775f, 0.39432773f},
-std::array<float,2>{0.100578003f, 0.601373494f},
-std::array<float,2>{0.61266458f, 0.186306596f},
-std::array<float,2>{0.78484422f, 0.673430264f},
-std::array<float,2>{0.444096208f, 0.0031950241f},
-std::array<float,2>{0.0381312445f, 0.997250855f},
-std::array<float,2>{0.541031539f, 0.300336719f},
-std::array<float,2>{0.626341164f, 0.856953442f},
-std::array<float,2>{0.231383204f, 0.47671333f},
-std::array<float,2>{0.285319507f, 0.532531381f},
-std::array<float,2>{0.939355433f, 0.224362329f},
-std::array<float,2>{0.564100027f, 0.593735754f},
-std::array<float,2>{0.0833531171f, 0.143691659f},
-std::array<float,2>{0.399612576f, 0.779783547f},
-std::array<float,2>{0.839540899f, 0.418266356f},
-std::array<float,2>{0.900820374f, 0.923579156f},
-std::array<float,2>{0.322260857f, 0.371229231f},
-std::array<float,2>{0.164708838f, 0.722913206f},
-std::array<float,2>{0.717918873f, 0.109177403f},
-std::array<float,2>{0.970905781f, 0.690605283f},
-std::array<float,2>{0.256364197f, 0.0762305856f},
-std::array<float,2>{0.202086583f, 0.88732022f},
-std::array<float,2>{0.660897195f, 0.343562514f},
-std::array<float,2>{0.525538266f, 0.799281776f},
-std::array<float,2>{0.017753426f, 0.401569575f},
-std::array<float,2>{0.487406522f, 0.608178556f},
-std::array<float,2>{0.764160037f, 0.176909253f},
-std::array<float,2>{0.737300515f, 0.522782862f},
-std::array<float,2>{0.14766337f, 0.197877079f},
-std::array<float,2>{0.366976142f, 0.826713204f},
-std::array<float,2>{0.924886167f, 0.453174084f},
-std::array<float,2>{0.85396564f, 0.949421227f},
-std::array<float,2>{0.413436234f, 0.270807236f},
-std::array<float,2>{0.118733503f, 0.65506798f},
-std::array<float,2>{0.606139481f, 0.0471398272f},
-std::array<float,2>{0.797398567f, 0.585520446f},
-std::array<float,2>{0.454280823f, 0.152734622f},
-std::array<float,2>{0.0583042838f, 0.766216516f},
-std::array<float,2>{0.555732846f, 0.407733798f},
-std::array<float,2>{0.643188834f, 0.935606956f},
-std::array<float,2>{0.247718781f, 0.361287981f},
-std::array<float,2>{0.305405021f, 0.728395522f},
-std::array<float,2>{0.96273005f, 0.0955860093f},
-std::array<float,2>{0.586741686f, 0.686087489f},
-std::array<float,2>{0.0769741312f, 0.0139997313f},
-std::array<float,2>{0.3856754f, 0.985316694f},
-std::array<float,2>{0.825143576f, 0.311152965f},
-std::array<float,2>{0.878866017f, 0.84807986f},
-std::array<float,2>{0.331158727f, 0.471750617f},
-std::array<float,2>{0.179609358f, 0.54223156f},
-std::array<float,2>{0.687568843f, 0.23412925f},
-std::array<float,2>{0.906735003f, 0.553756535f},
-std::array<float,2>{0.353680789f, 0.246748343f},
-std::array<float,2>{0.128563955f, 0.868576586f},
-std::array<float,2>{0.723604321f, 0.488172531f},
-std::array<float,2>{0.615797043f, 0.981564403f},
-std::array<float,2>{0.0956772789f, 0.291784585f},
-std::array<float,2>{0.429152131f, 0.66286099f},
-std::array<float,2>{0.871641457f, 0.0212932378f},
-std::array<float,2>{0.675756514f, 0.73782295f},
-std::array<float,2>{0.209151313f, 0.114526652f},
-std::array<float,2>{0.267815799f, 0.918815792f},
-std::array<float,2>{0.996925175f, 0.35467279f},
-std::array<float,2>{0.768102229f, 0.764190912f},
-std::array<float,2>{0.469365716f, 0.430189759f},
-std::array<float,2>{0.0140900929f, 0.564622521f},
-std::array<float,2>{0.514614761f, 0.133647725f},
-std::array<float,2>{0.842456758f, 0.64027077f},
-std::array<float,2>{0.404275596f, 0.0357039906f},
-std::array<float,2>{0.0794272944f, 0.962501764f},
-std::array<float,2>{0.567750275f, 0.25848031f},
-std::array<float,2>{0.711643696f, 0.8430987f},
-std::array<float,2>{0.168203741f, 0.44967559f},
-std::array<float,2>{0.325267792f, 0.510345578f},
-std::array<float,2>{0.904990733f, 0.213445157f},
-std::array<float,2>{0.543913126f, 0.623618484f},
-std::array<float,2>{0.0321434215f, 0.161266237f},
-std::array<float,2>{0.437535763f, 0.795077741f},
-std::array<float,2>{0.787359834f, 0.375300944f},
-std::array<float,2>{0.943213582f, 0.905637205f},
-std::array<float,2>{0.281651795f, 0.318324983f},
-std::array<float,2>{0.228556961f, 0.70849508f},
-std::array<float,2>{0.6290797f, 0.0828264952f},
-std::array<float,2>{0.896522224f, 0.667070746f},
-std::array<float,2>{0.319913715f, 0.0239285175f},
-std::array<float,2>{0.157958895f, 0.97318387f},
-std::array<float,2>{0.70315665f, 0.284855247f},
-std::array<float,2>{0.573025942f, 0.864000618f},
-std::array<float,2>{0.0881156102f, 0.493289024f},
-std::array<float,2>{0.393211454f, 0.556733847f},
-std::array<float,2>{0.833028853f, 0.238775626f},
-std::array<float,2>{0.637846947f, 0.57129395f},
-std::array<float,2>{0.224433586f, 0.129927367f},
-std::array<float,2>{0.293023735f, 0.753313065f},
-std::array<float,2>{0.946337938f, 0.422878116f},
-std::array<float,2>{0.792554259f, 0.906511486f},
-std::array<float,2>{0.450275779f, 0.345985621f},
-std::array<float,2>{0.0396711119f, 0.747029006f},
-std::array<float,2>{0.537636101f, 0.121505924f},
-std::array<float,2>{0.860908747f, 0.504773557f},
-std::array<float,2>{0.431199014f, 0.208536699f},
-std::array<float,2>{0.108302973f, 0.834485888f},
-std::array<float,2>{0.617749572f, 0.441420257f},
-std::array<float,2>{0.727246106f, 0.960814774f},
-std::array<float,2>{0.133085191f, 0.253001541f},
-std::array<float,2>{0.347685367f, 0.632382214f},
-std::array<float,2>{0.916710377f, 0.0437552482f},
-std::array<float,2>{0.506303251f, 0.713745832f},
-std::array<float,2>{0.00533157634f, 0.0871722624f},
-std::array<float,2>{0.481661081f, 0.897382855f},
-std::array<float,2>{0.77447331f, 0.320767105f},
-std::array<float,2>{0.99151963f, 0.78773737f},
-std::array<float,2>{0.275144309f, 0.385904223f},
-std::array<float,2>{0.214875668f, 0.612264514f},
-std::array<float,2>{0.684531391f, 0.168189466f},
-std::array<float,2>{0.957662225f, 0.594749033f},
-std::array<float,2>{0.300401062f, 0.180609748f},
-std::array<float,2>{0.236390173f, 0.811349332f},
-std::array<float,2>{0.655983627f, 0.397937536f},
-std::array<float,2>{0.549419284f, 0.880214036f},
-std::array<float,2>{0.0512788072f, 0.332701802f},
-std::array<float,2>{0.464955389f, 0.695586383f},
-std::array<float,2>{0.807012141f, 0.0636912212f},
-std::array<float,2>{0.698555529f, 0.645344257f},
-std::array<float,2>{0.184525549f, 0.0617020465f},
-std::array<float,2>{0.343523234f, 0.944766521f},
-std::array<float,2>{0.888360679f, 0.277315646f},
-std::array<float,2>{0.81804198f, 0.813549638f},
-std::array<float,2>{0.381035179f, 0.464700729f},
-std::array<float,2>{0.0625326484f, 0.529843092f},
-std::array<float,2>{0.579933763f, 0.193894923f},
-std::array<float,2>{0.754036188f, 0.718851984f},
-std::array<float,2>{0.493209183f, 0.101588666f},
-std::array<float,2>{0.0294281654f, 0.927402675f},
-std::array<float,2>{0.516076505f, 0.370891899f},
-std::array<float,2>{0.67122525f, 0.776311696f},
-std::array<float,2>{0.194195405f, 0.417338729f},
-std::array<float,2>{0.264783561f, 0.589550674f},
-std::array<float,2>{0.979980946f, 0.146410018f},
-std::array<float,2>{0.596065402f, 0.538249969f},
-std::array<float,2>{0.112206437f, 0.219773009f},
-std::array<float,2>{0.414179593f, 0.852083206f},
-std::array<float,2>{0.847110212f, 0.483446419f},
-std::array<float,2>{0.936052382f, 0.993927121f},
-std::array<float,2>{0.36906755f, 0.303225219f},
-std::array<float,2>{0.154642314f, 0.678764939f},
-std::array<float,2>{0.74875325f, 0.00749497442f},
-std::array<float,2>{0.987466276f, 0.682002723f},
-std::array<float,2>{0.280062795f, 0.0100809056f},
-std::array<float,2>{0.214840084f, 0.990516961f},
-std::array<float,2>{0.6817168f, 0.306894392f},
-std::array<float,2>{0.501175523f, 0.845819831f},
-std::array<float,2>{0.00344739459f, 0.475425273f},
-std::array<float,2>{0.477116227f, 0.544997156f},
-std::array<float,2>{0.779239297f, 0.229340345f},
-std::array<float,2>{0.732969642f, 0.58075285f},
-std::array<float,2>{0.136936307f, 0.149887592f},
-std::array<float,2>{0.344593078f, 0.773133039f},
-std::array<float,2>{0.920985937f, 0.410682678f},
-std::array<float,2>{0.864789546f, 0.930035055f},
-std::array<float,2>{0.434064329f, 0.364893645f},
-std::array<float,2>{0.102905117f, 0.733226597f},
-std::array<float,2>{0.622575819f, 0.0983489379f},
-std::array<float,2>{0.7948578f, 0.517495811f},
-std::array<float,2>{0.448153764f, 0.20192495f},
-std::array<float,2>{0.046681758f, 0.822371483f},
-std::array<float,2>{0.53431493f, 0.458653212f},
-std::array<float,2>{0.636057258f, 0.94773066f},
-std::array<float,2>{0.221420527f, 0.267988354f},
-std::array<float,2>{0.289923817f, 0.650621295f},
-std::array<float,2>{0.950577736f, 0.0538375638f},
-std::array<float,2>{0.575389087f, 0.692154109f},
-std::array<float,2>{0.0930491686f, 0.0711760223f},
-std::array<float,2>{0.396992952f, 0.883931637f},
-std::array<float,2>{0.829148352f, 0.335981309f},
-std::array<float,2>{0.893982351f, 0.800949216f},
-std::array<float,2>{0.313193411f, 0.402493715f},
-std::array<float,2>{0.161106572f, 0.602232635f},
-std::array<float,2>{0.709688365f, 0.174919143f},
-std::array<float,2>{0.932938814f, 0.620612025f},
-std::array<float,2>{0.371302187f, 0.159192562f},
-std::array<float,2>{0.148769096f, 0.791162848f},
-std::array<float,2>{0.743345857f, 0.380345821f},
-std::array<float,2>{0.600664675f, 0.898984969f},
-std::array<float,2>{0.114413887f, 0.315258801f},
-std::array<float,2>{0.420231223f, 0.706214607f},
-std::array<float,2>{0.849729955f, 0.0805396587f},
-std::array<float,2>{0.665133834f, 0.636009455f},
-std::array<float,2>{0.191044196f, 0.0341025554f},
-std::array<float,2>{0.261196733f, 0.964978337f},
-std::array<float,2>{0.982673466f, 0.26382032f},
-std::array<float,2>{0.750933468f, 0.838364482f},
-std::array<float,2>{0.497079283f, 0.44871065f},
-std::array<float,2>{0.0238596797f, 0.512868166f},
-std::array<float,2>{0.520920634f, 0.215062469f},
-std::array<float,2>{0.81494993f, 0.740723014f},
-std::array<float,2>{0.375029266f, 0.109922156f},
-std::array<float,2>{0.0697047114f, 0.917206764f},
-std::array<float,2>{0.585160136f, 0.359174103f},
-std::array<float,2>{0.700801075f, 0.758988559f},
-std::array<float,2>{0.181875229f, 0.433988959f},
-std::array<float,2>{0.337431252f, 0.567261934f},
-std::array<float,2>{0.88523525f, 0.139827147f},
-std::array<float,2>{0.551186979f, 0.549656212f},
-std::array<float,2>{0.0498499759f, 0.243957773f},
-std::array<float,2>{0.461089313f, 0.872836173f},
-std::array<float,2>{0.811823726f, 0.4893938f},
-std::array<float,2>{0.956299722f, 0.979643226f},
-std::array<float,2>{0.300969601f, 0.295016021f},
-std::array<float,2>{0.240624294f, 0.659492493f},
-std::array<float,2>{0.651606619f, 0.0170527622f},
-std::array<float,2>{0.879944563f, 0.715781033f},
-std::array<float,2>{0.332245082f, 0.0918093324f},
-std::array<float,2>{0.175166041f, 0.89091593f},
-std::array<float,2>{0.69323498f, 0.32611835f},
-std::array<float,2>{0.59055692f, 0.782721281f},
-std::array<float,2>{0.0738623068f, 0.390463442f},
-std::array<float,2>{0.38876012f, 0.614765584f},
-std::array<float,2>{0.820810914f, 0.164718971f},
-std::array<float,2>{0.648386121f, 0.501351237f},
-std::array<float,2>{0.245094493f, 0.206551269f},
-std::array<float,2>{0.311249316f, 0.828544378f},
-std::array<float,2>{0.965452254f, 0.437628716f},
-std::array<float,2>{0.801624775f, 0.956729531f},
-std::array<float,2>{0.457143366f, 0.256377608f},
-std::array<float,2>{0.0596172139f, 0.627478242f},
-std::array<float,2>{0.559806108f, 0.0412313975f},
-std::array<float,2>{0.856107831f, 0.575475097f},
-std::array<float,2>{0.408666164f, 0.128115416f},
-std::array<float,2>{0.121574886f, 0.757433355f},
-std::array<float,2>{0.605096459f, 0.427460641f},
-std::array<float,2>{0.740452707f, 0.912679732f},
-std::array<float,2>{0.142981425f, 0.349359483f},
-std::array<float,2>{0.359512776f, 0.742419302f},
-std::array<float,2>{0.927819431f, 0.117766917f},
-std::array<float,2>{0.528415799f, 0.670761764f},
-std::array<float,2>{0.0205982048f, 0.0286742188f},
-std::array<float,2>{0.491499424f, 0.970941603f},
-std::array<float,2>{0.758224189f, 0.286042124f},
-std::array<float,2>{0.974052608f, 0.861711621f},
-std::array<float,2>{0.253137141f, 0.49844107f},
-std::array<float,2>{0.195712373f, 0.560941219f},
-std::array<float,2>{0.66012603f, 0.236151576f},
-std::array<float,2>{0.939863384f, 0.533566713f},
-std::array<float,2>{0.288466871f, 0.225695297f},
-std::array<float,2>{0.233653501f, 0.858095527f},
-std::array<float,2>{0.628453016f, 0.479725361f},
-std::array<float,2>{0.540630102f, 0.999744236f},
-std::array<float,2>{0.0353645347f, 0.297647983f},
-std::array<float,2>{0.441760808f, 0.673955679f},
-std::array<float,2>{0.783197522f, 0.00106489274f},
-std::array<float,2>{0.715234339f, 0.725149155f},
-std::array<float,2>{0.166335687f, 0.106159508f},
-std::array<float,2>{0.322578281f, 0.924134731f},
-std::array<float,2>{0.899958909f, 0.373103559f},
-std::array<float,2>{0.837122858f, 0.777359486f},
-std::array<float,2>{0.400544524f, 0.420254797f},
-std::array<float,2>{0.0854377002f, 0.59073472f},
-std::array<float,2>{0.564688146f, 0.140945002f},
-std::array<float,2>{0.771324158f, 0.641275287f},
-std::array<float,2>{0.473149985f, 0.0573846847f},
-std::array<float,2>{0.0115305502f, 0.938007951f},
-std::array<float,2>{0.510674119f, 0.278208703f},
-std::array<float,2>{0.676793516f, 0.817933679f},
-std::array<float,2>{0.204109907f, 0.466765225f},
-std::array<float,2>{0.273085982f, 0.525653183f},
-std::array<float,2>{0.994359612f, 0.188220605f},
-std::array<float,2>{0.611110985f, 0.59901166f},
-std::array<float,2>{0.0987070575f, 0.184789881f},
-std::array<float,2>{0.423244685f, 0.807935357f},
-std::array<float,2>{0.869271159f, 0.391471475f},
-std::array<float,2>{0.911014974f, 0.878408432f},
-std::array<float,2>{0.356033951f, 0.33178395f},
-std::array<float,2>{0.129192278f, 0.702824533f},
-std::array<float,2>{0.721719563f, 0.0680590644f},
-std::array<float,2>{0.964776754f, 0.729626715f},
-std::array<float,2>{0.308157027f, 0.0964074358f},
-std::array<float,2>{0.248211101f, 0.935503006f},
-std::array<float,2>{0.641304314f, 0.362543672f},
-std::array<float,2>{0.557110012f, 0.768521011f},
-std::array<float,2>{0.0558675863f, 0.410094351f},
-std::array<float,2>{0.45615238f, 0.58257246f},
-std::array<float,2>{0.798994899f, 0.156198144f},
-std::array<float,2>{0.689762712f, 0.540614426f},
-std::array<float,2>{0.176385075f, 0.230548695f},
-std::array<float,2>{0.329197317f, 0.850518525f},
-std::array<float,2>{0.876376033f, 0.469828606f},
-std::array<float,2>{0.827683389f, 0.986718059f},
-std::array<float,2>{0.384216458f, 0.310470998f},
-std::array<float,2>{0.0743384436f, 0.685514808f},
-std::array<float,2>{0.589366794f, 0.0123438407f},
-std::array<float,2>{0.761832356f, 0.606359005f},
-std::array<float,2>{0.484442115f, 0.178841889f},
-std::array<float,2>{0.0173133239f, 0.797200859f},
-std::array<float,2>{0.523875535f, 0.398963749f},
-std::array<float,2>{0.66348803f, 0.889428377f},
-std::array<float,2>{0.19950442f, 0.340338171f},
-std::array<float,2>{0.254622042f, 0.687774897f},
-std::array<float,2>{0.969121873f, 0.0756795034f},
-std::array<float,2>{0.608030975f, 0.653299451f},
-std::array<float,2>{0.120500661f, 0.0489493124f},
-std::array<float,2>{0.410856187f, 0.952807724f},
-std::array<float,2>{0.852618992f, 0.272730917f},
-std::array<float,2>{0.9235273f, 0.825891018f},
-std::array<float,2>{0.364147127f, 0.456092745f},
-std::array<float,2>{0.145851523f, 0.5195871f},
-std::array<float,2>{0.735319495f, 0.19702813f},
-std::array<float,2>{0.902855873f, 0.508086205f},
-std::array<float,2>{0.327828109f, 0.211747289f},
-std::array<float,2>{0.171116695f, 0.84166652f},
-std::array<float,2>{0.713046968f, 0.45269388f},
-std::array<float,2>{0.569805205f, 0.964458466f},
-std::array<float,2>{0.0807786509f, 0.261217594f},
-std::array<float,2>{0.404928595f, 0.637271345f},
-std::array<float,2>{0.840156198f, 0.0380155295f},
-std::array<float,2>{0.632368624f, 0.70946312f},
-std::array<float,2>{0.227776021f, 0.0841970816f},
-std::array<float,2>{0.28401491f, 0.90318948f},
-std::array<float,2>{0.943928421f, 0.320298791f},
-std::array<float,2>{0.786559045f, 0.793716192f},
-std::array<float,2>{0.440357804f, 0.37823832f},
-std::array<float,2>{0.0334964097f, 0.623017073f},
-std::array<float,2>{0.545283437f, 0.162317604f},
-std::array<float,2>{0.873882413f, 0.661725223f},
-std::array<float,2>{0.425917536f, 0.0228279103f},
-std::array<float,2>{0.0971864089f, 0.983934224f},
-std::array<float,2>{0.614530027f, 0.289320558f},
-std::array<float,2>{0.726424694f, 0.871007919f},
-std::array<float,2>{0.126199722f, 0.484915525f},
-std::array<float,2>{0.352226764f, 0.551819801f},
-std::array<float,2>{0.908507824f, 0.24947536f},
-std::array<float,2>{0.51225549f, 0.564323187f},
-std::array<float,2>{0.0124092074f, 0.136628121f},
-std::array<float,2>{0.471660763f, 0.763170242f},
-std::array<float,2>{0.766578853f, 0.432553589f},
-std::array<float,2>{0.998109877f, 0.921212137f},
-std::array<float,2>{0.267203987f, 0.351882994f},
-std::array<float,2>{0.207883596f, 0.734556556f},
-std::array<float,2>{0.672479928f, 0.117144063f},
-std::array<float,2>{0.914660513f, 0.629488051f},
-std::array<float,2>{0.351480007f, 0.0451217517f},
-std::array<float,2>{0.135625601f, 0.957686543f},
-std::array<float,2>{0.730154216f, 0.250401765f},
-std::array<float,2>{0.621037781f, 0.83343792f},
-std::array<float,2>{0.105505563f, 0.444539636f},
-std::array<float,2>{0.433137238f, 0.507401168f},
-std::array<float,2>{0.862862527f, 0.209333554f},
-std::array<float,2>{0.686588645f, 0.610235155f},
-std::array<float,2>{0.216971532f, 0.171552092f},
-std::array<float,2>{0.277303129f, 0.7868433f},
-std::array<float,2>{0.988945723f, 0.383380264f},
-std::array<float,2>{0.776996911f, 0.894757032f},
-std::array<float,2>{0.483090043f, 0.324132025f},
-std::array<float,2>{0.00645679096f, 0.712098122f},
-std::array<float,2>{0.505215287f, 0.088724792f},
-std::array<float,2>{0.835889339f, 0.555044472f},
-std::array<float,2>{0.392034024f, 0.242120385f},
-std::array<float,2>{0.0862219706f, 0.866604984f},
-std::array<float,2>{0.570793271f, 0.494829506f},
-std::array<float,2>{0.706806302f, 0.976328731f},
-std::array<float,2>{0.159594506f, 0.28308484f},
-std::array<float,2>{0.317635208f, 0.664374292f},
-std::array<float,2>{0.895753086f, 0.0268166456f},
-std::array<float,2>{0.535587907f, 0.748349249f},
-std::array<float,2>{0.0429476164f, 0.123451516f},
-std::array<float,2>{0.451544523f, 0.909644961f},
-std::array<float,2>{0.789324105f, 0.344765842f},
-std::array<float,2>{0.948956788f, 0.751680076f},
-std::array<float,2>{0.295060366f, 0.425064415f},
-std::array<float,2>{0.226011381f, 0.573370934f},
-std::array<float,2>{0.639851987f, 0.132737219f},
-std::array<float,2>{0.97824657f, 0.586103916f},
-std::array<float,2>{0.262719005f, 0.148265913f},
-std::array<float,2>{0.192968667f, 0.774181902f},
-std::array<float,2>{0.669399261f, 0.415202767f},
-std::array<float,2>{0.519204617f, 0.927780151f},
-std::array<float,2>{0.0281100776f, 0.36804685f},
-std::array<float,2>{0.495273352f, 0.721807599f},
-std::array<float,2>{0.756919563f, 0.103713654f},
-std::array<float,2>{0.7477929f, 0.676398337f},
-std::array<float,2>{0.152356848f, 0.00449170871f},
-std::array<float,2>{0.370475113f, 0.995679796f},
-std::array<float,2>{0.934919119f, 0.300952226f},
-std::array<float,2>{0.845031261f, 0.854604006f},
-std::array<float,2>{0.41679135f, 0.481744379f},
-std::array<float,2>{0.109507769f, 0.53558588f},
-std::array<float,2>{0.594870329f, 0.222475126f},
-std::array<float,2>{0.80618608f, 0.697557032f},
-std::array<float,2>{0.467754066f, 0.0656018853f},
-std::array<float,2>{0.0529422499f, 0.881511271f},
-std::array<float,2>{0.548035383f, 0.335036606f},
-std::array<float,2>{0.654172063f, 0.810439706f},
-std::array<float,2>{0.236278623f, 0.394877583f},
-std::array<float,2>{0.297386885f, 0.5971995f},
-std::array<float,2>{0.959506869f, 0.183369443f},
-std::array<float,2>{0.580184102f, 0.527724266f},
-std::array<float,2>{0.0647250339f, 0.19212991f},
-std::array<float,2>{0.379686892f, 0.816253781f},
-std::array<float,2>{0.819023192f, 0.46249941f},
-std::array<float,2>{0.889407575f, 0.943333387f},
-std::array<float,2>{0.339984298f, 0.275186479f},
-std::array<float,2>{0.186741322f, 0.648003757f},
-std::array<float,2>{0.696907997f, 0.0602668971f},
-std::array<float,2>{0.983783722f, 0.633430123f},
-std::array<float,2>{0.259901464f, 0.0329127535f},
-std::array<float,2>{0.189846635f, 0.967776716f},
-std::array<float,2>{0.664107025f, 0.262958437f},
-std::array<float,2>{0.520130217f, 0.835973084f},
-std::array<float,2>{0.0251928978f, 0.445842952f},
-std::array<float,2>{0.496862441f, 0.51394403f},
-std::array<float,2>{0.751804292f, 0.21826449f},
-std::array<float,2>{0.743096113f, 0.618577302f},
-std::array<float,2>{0.150167122f, 0.156356558f},
-std::array<float,2>{0.372322977f, 0.789242685f},
-std::array<float,2>{0.932087779f, 0.38197571f},
-std::array<float,2>{0.851322591f, 0.901316762f},
-std::array<float,2>{0.421105295f, 0.313489586f},
-std::array<float,2>{0.113359638f, 0.703469753f},
-std::array<float,2>{0.600206614f, 0.0798829272f},
-std::array<float,2>{0.810633421f, 0.548527062f},
-std::array<float,2>{0.462353915f, 0.244281843f},
-std::array<float,2>{0.0489074327f, 0.873765588f},
-std::array<float,2>{0.552233279f, 0.491442829f},
-std::array<float,2>{0.651163101f, 0.976852059f},
-std::array<float,2>{0.241234422f, 0.293597132f},
-std::array<float,2>{0.301900774f, 0.657289147f},
-std::array<float,2>{0.956050694f, 0.0190300643f},
-std::array<float,2>{0.584049284f, 0.738900423f},
-std::array<float,2>{0.0690033957f, 0.111438014f},
-std::array<float,2>{0.376564473f, 0.914245784f},
-std::array<float,2>{0.815747499f, 0.35605213f},
-std::array<float,2>{0.88644886f, 0.761289418f},
-std::array<float,2>{0.336317807f, 0.437120944f},
-std::array<float,2>{0.183315933f, 0.56962359f},
-std::array<float,2>{0.699636579f, 0.137696803f},
-std::array<float,2>{0.92031157f, 0.578494132f},
-std::array<float,2>{0.344804227f, 0.15211837f},
-std::array<float,2>{0.13791512f, 0.769856393f},
-std::array<float,2>{0.734336972f, 0.412932456f},
-std::array<float,2>{0.621355832f, 0.933152974f},
-std::array<float,2>{0.101645291f, 0.365323007f},
-std::array<float,2>{0.434918821f, 0.731481671f},
-std::array<float,2>{0.86392194f, 0.101002209f},
-std::array<float,2>{0.683036923f, 0.680594027f},
-std::array<float,2>{0.213538378f, 0.007842144f},
-std::array<float,2>{0.28123787f, 0.989458978f},
-std::array<float,2>{0.987056196f, 0.306347936f},
-std::array<float,2>{0.778098285f, 0.844592154f},
-std::array<float,2>{0.478450328f, 0.474355429f},
-std::array<float,2>{0.002743755f, 0.543841064f},
-std::array<float,2>{0.500619531f, 0.226950914f},
-std::array<float,2>{0.82863307f, 0.693546832f},
-std::array<float,2>{0.398059636f, 0.0730386823f},
-std::array<float,2>{0.0920357034f, 0.885973394f},
-std::array<float,2>{0.574863434f, 0.339304179f},
-std::array<float,2>{0.710577488f, 0.802765787f},
-std::array<float,2>{0.16203247f, 0.405640632f},
-std::array<float,2>{0.313718677f, 0.60397929f},
-std::array<float,2>{0.893511534f, 0.17228955f},
-std::array<float,2>{0.533401251f, 0.518268049f},
-std::array<float,2>{0.0456435196f, 0.200148106f},
-std::array<float,2>{0.448437005f, 0.821292102f},
-std::array<float,2>{0.793604732f, 0.45995307f},
-std::array<float,2>{0.94989115f, 0.946325421f},
-std::array<float,2>{0.290938228f, 0.267450541f},
-std::array<float,2>{0.221991181f, 0.649884284f},
-std::array<float,2>{0.635417998f, 0.0519893058f},
-std::array<float,2>{0.898510039f, 0.724443436f},
-std::array<float,2>{0.323708028f, 0.10781616f},
-std::array<float,2>{0.167459562f, 0.922546923f},
-std::array<float,2>{0.716140389f, 0.372916996f},
-std::array<float,2>{0.565679371f, 0.78067416f},
-std::array<float,2>{0.0844169408f, 0.419736564f},
-std::array<float,2>{0.401806891f, 0.592446566f},
-std::array<float,2>{0.836639881f, 0.143205091f},
-std::array<float,2>{0.627196014f, 0.53190887f},
-std::array<float,2>{0.232449368f, 0.223342285f},
-std::array<float,2>{0.28775984f, 0.855708361f},
-std::array<float,2>{0.940796018f, 0.478164256f},
-std::array<float,2>{0.781814933f, 0.99692291f},
-std::array<float,2>{0.442727953f, 0.298829734f},
-std::array<float,2>{0.036503572f, 0.672714591f},
-std::array<float,2>{0.539931536f, 0.00261876336f},
-std::array<float,2>{0.870933175f, 0.60014081f},
-std::array<float,2>{0.422019213f, 0.186787188f},
-std::array<float,2>{0.0980165526f, 0.805707872f},
-std::array<float,2>{0.609933138f, 0.392764688f},
-std::array<float,2>{0.721137047f, 0.876332045f},
-std::array<float,2>{0.129987478f, 0.329084814f},
-std::array<float,2>{0.357315898f, 0.701132655f},
-std::array<float,2>{0.911233664f, 0.0688727126f},
-std::array<float,2>{0.511253297f, 0.644001067f},
-std::array<float,2>{0.0100650741f, 0.0547187515f},
-std::array<float,2>{0.474500895f, 0.941037953f},
-std::array<float,2>{0.769722462f, 0.281145722f},
-std::array<float,2>{0.995683789f, 0.818563044f},
-std::array<float,2>{0.271778882f, 0.467737228f},
-std::array<float,2>{0.20320949f, 0.525258422f},
-std::array<float,2>{0.676558375f, 0.190252513f},
-std::array<float,2>{0.96591574f, 0.50280267f},
-std::array<float,2>{0.311538905f, 0.204372048f},
-std::array<float,2>{0.245290548f, 0.830537736f},
-std::array<float,2>{0.64709115f, 0.440785825f},
-std::array<float,2>{0.558720946f, 0.953758061f},
-std::array<float,2>{0.0592506379f, 0.254137725f},
-std::array<float,2>{0.458813846f, 0.626412511f},
-std::array<float,2>{0.802230358f, 0.040549133f},
-std::array<float,2>{0.691849053f, 0.718619108f},
-std::array<float,2>{0.174177006f, 0.0915155858f},
-std::array<float,2>{0.333676606f, 0.89339745f},
-std::array<float,2>{0.87957871f, 0.326870829f},
-std::array<float,2>{0.821512759f, 0.783468366f},
-std::array<float,2>{0.389752507f, 0.388156116f},
-std::array<float,2>{0.0728839189f, 0.616638422f},
-std::array<float,2>{0.591642082f, 0.167968318f},
-std::array<float,2>{0.759420872f, 0.669405341f},
-std::array<float,2>{0.490303338f, 0.0307282358f},
-std::array<float,2>{0.0200526118f, 0.968861878f},
-std::array<float,2>{0.5278247f, 0.287387282f},
-std::array<float,2>{0.658604801f, 0.860807896f},
-std::array<float,2>{0.196833104f, 0.496277809f},
-std::array<float,2>{0.252368748f, 0.560484767f},
-std::array<float,2>{0.973243892f, 0.237283111f},
-std::array<float,2>{0.603610694f, 0.577648401f},
-std::array<float,2>{0.122071818f, 0.126773119f},
-std::array<float,2>{0.409637541f, 0.755717874f},
-std::array<float,2>{0.856594443f, 0.429313183f},
-std::array<float,2>{0.929668903f, 0.910812974f},
-std::array<float,2>{0.361266285f, 0.34980464f},
-std::array<float,2>{0.144009009f, 0.745104432f},
-std::array<float,2>{0.741828144f, 0.119331717f},
-std::array<float,2>{0.944806874f, 0.707331121f},
-std::array<float,2>{0.284986496f, 0.0838670731f},
-std::array<float,2>{0.226651937f, 0.904785514f},
-std::array<float,2>{0.631643593f, 0.317160696f},
-std::array<float,2>{0.546718121f, 0.79658258f},
-std::array<float,2>{0.0349039733f, 0.376860678f},
-std::array<float,2>{0.441294849f, 0.624520838f},
-std::array<float,2>{0.78581059f, 0.160599738f},
-std::array<float,2>{0.714111388f, 0.511375308f},
-std::array<float,2>{0.170187503f, 0.214388251f},
-std::array<float,2>{0.326712787f, 0.842132211f},
-std::array<float,2>{0.904161036f, 0.450387776f},
-std::array<float,2>{0.841095567f, 0.961360693f},
-std::array<float,2>{0.406226516f, 0.259003848f},
-std::array<float,2>{0.0814772919f, 0.638949215f},
-std::array<float,2>{0.569283605f, 0.0367234983f},
-std::array<float,2>{0.767525256f, 0.566154003f},
-std::array<float,2>{0.472045332f, 0.134705439f},
-std::array<float,2>{0.0128723057f, 0.765618861f},
-std::array<float,2>{0.513329327f, 0.431232393f},
-std::array<float,2>{0.67315948f, 0.919141948f},
-std::array<float,2>{0.208332285f, 0.353835016f},
-std::array<float,2>{0.266487062f, 0.73677218f},
-std::array<float,2>{0.999218583f, 0.113921501f},
-std::array<float,2>{0.61398536f, 0.663693726f},
-std::array<float,2>{0.096616067f, 0.0203841422f},
-std::array<float,2>{0.427569747f, 0.981153429f},
-std::array<float,2>{0.874432743f, 0.29204461f},
-std::array<float,2>{0.909620345f, 0.867945969f},
-std::array<float,2>{0.353219509f, 0.486334711f},
-std::array<float,2>{0.125255793f, 0.55330956f},
-std::array<float,2>{0.724826276f, 0.247422889f},
-std::array<float,2>{0.875164211f, 0.541889846f},
-std::array<float,2>{0.328882217f, 0.233137682f},
-std::array<float,2>{0.177076057f, 0.849140823f},
-std::array<float,2>{0.690906286f, 0.471056998f},
-std::array<float,2>{0.588677049f, 0.985477984f},
-std::array<float,2>{0.0755120739f, 0.312030196f},
-std::array<float,2>{0.382949084f, 0.686776817f},
-std::array<float,2>{0.826566577f, 0.014895332f},
-std::array<float,2>{0.642273486f, 0.727074564f},
-std::array<float,2>{0.249824256f, 0.094400622f},
-std::array<float,2>{0.307359964f, 0.937028944f},
-std::array<float,2>{0.963369787f, 0.359629899f},
-std::array<float,2>{0.800654292f, 0.766744435f},
-std::array<float,2>{0.456048429f, 0.406374186f},
-std::array<float,2>{0.0556576326f, 0.584308505f},
-std::array<float,2>{0.55825901f, 0.15401338f},
-std::array<float,2>{0.85188508f, 0.655500472f},
-std::array<float,2>{0.411678046f, 0.0479130559f},
-std::array<float,2>{0.119977586f, 0.950416446f},
-std::array<float,2>{0.608444631f, 0.269718468f},
-std::array<float,2>{0.735555172f, 0.827610314f},
-std::array<float,2>{0.145005524f, 0.454446107f},
-std::array<float,2>{0.364369333f, 0.522413492f},
-std::array<float,2>{0.922731102f, 0.19824554f},
-std::array<float,2>{0.524799466f, 0.609281659f},
-std::array<float,2>{0.015803609f, 0.176248088f},
-std::array<float,2>{0.485459924f, 0.800276995f},
-std::array<float,2>{0.763224661f, 0.400479317f},
-std::array<float,2>{0.970588386f, 0.887962401f},
-std::array<float,2>{0.255193979f, 0.34234935f},
-std::array<float,2>{0.200523794f, 0.690123618f},
-std::array<float,2>{0.662685573f, 0.0774754509f},
-std::array<float,2>{0.934448302f, 0.67792809f},
-std::array<float,2>{0.369570315f, 0.00656175613f},
-std::array<float,2>{0.153886423f, 0.992341578f},
-std::array<float,2>{0.747004986f, 0.304269344f},
-std::array<float,2>{0.59398663f, 0.852904022f},
-std::array<float,2>{0.111083984f, 0.482869148f},
-std::array<float,2>{0.417314082f, 0.537813604f},
-std::array<float,2>{0.843853116f, 0.219544426f},
-std::array<float,2>{0.66840142f, 0.588429451f},
-std::array<float,2>{0.191443294f, 0.145493686f},
-std::array<float,2>{0.261900336f, 0.776806891f},
-std::array<float,2>{0.976903439f, 0.416376561f},
-std::array<float,2>{0.756227493f, 0.92602551f},
-std::array<float,2>{0.494523376f, 0.369935185f},
-std::array<float,2>{0.0285141729f, 0.719980836f},
-std::array<float,2>{0.517895401f, 0.103193924f},
-std::array<float,2>{0.820080519f, 0.530385911f},
-std::array<float,2>{0.379925936f, 0.194629386f},
-std::array<float,2>{0.0656299591f, 0.813225329f},
-std::array<float,2>{0.581979215f, 0.463480622f},
-std::array<float,2>{0.695857823f, 0.94428134f},
-std::array<float,2>{0.18569316f, 0.276202828f},
-std::array<float,2>{0.341511071f, 0.645991981f},
-std::array<float,2>{0.89005667f, 0.0612527952f},
-std::array<float,2>{0.547641873f, 0.697164893f},
-std::array<float,2>{0.0545385927f, 0.0630406961f},
-std::array<float,2>{0.468459874f, 0.87942344f},
-std::array<float,2>{0.805320144f, 0.333087921f},
-std::array<float,2>{0.960659266f, 0.81213212f},
-std::array<float,2>{0.298019886f, 0.397040665f},
-std::array<float,2>{0.234966844f, 0.594700336f},
-std::array<float,2>{0.652738094f, 0.181030095f},
-std::array<float,2>{0.98996377f, 0.612378836f},
-std::array<float,2>{0.27596733f, 0.169274986f},
-std::array<float,2>{0.218166515f, 0.788571894f},
-std::array<float,2>{0.68556267f, 0.385112077f},
-std::array<float,2>{0.504724979f, 0.898314297f},
-std::array<float,2>{0.00726794591f, 0.321789265f},
-std::array<float,2>{0.483973742f, 0.714349866f},
-std::array<float,2>{0.77562052f, 0.0864401311f},
-std::array<float,2>{0.729344904f, 0.631600618f},
-std::array<float,2>{0.136169523f, 0.0440225936f},
-std::array<float,2>{0.350330681f, 0.95931375f},
-std::array<float,2>{0.915437996f, 0.252565831f},
-std::array<float,2>{0.861544669f, 0.835881174f},
-std::array<float,2>{0.431919694f, 0.443182468f},
-std::array<float,2>{0.106704682f, 0.505164444f},
-std::array<float,2>{0.619479656f, 0.20714201f},
-std::array<float,2>{0.790917635f, 0.747363985f},
-std::array<float,2>{0.452876061f, 0.122781768f},
-std::array<float,2>{0.041535262f, 0.908122897f},
-std::array<float,2>{0.537012041f, 0.347443372f},
-std::array<float,2>{0.639187813f, 0.752077401f},
-std::array<float,2>{0.224927142f, 0.422276527f},
-std::array<float,2>{0.296692312f, 0.570401728f},
-std::array<float,2>{0.947762489f, 0.129328072f},
-std::array<float,2>{0.571528018f, 0.558555722f},
-std::array<float,2>{0.0873633325f, 0.239727035f},
-std::array<float,2>{0.391520202f, 0.86473906f},
-std::array<float,2>{0.834311664f, 0.492991835f},
-std::array<float,2>{0.895227611f, 0.973767459f},
-std::array<float,2>{0.316836208f, 0.283728987f},
-std::array<float,2>{0.15841791f, 0.666442037f},
-std::array<float,2>{0.70542866f, 0.0253469404f},
-std::array<float,2>{0.953841388f, 0.658922315f},
-std::array<float,2>{0.304149091f, 0.0165379904f},
-std::array<float,2>{0.239687502f, 0.979078948f},
-std::array<float,2>{0.650352359f, 0.296293795f},
-std::array<float,2>{0.553278625f, 0.871139765f},
-std::array<float,2>{0.0473327897f, 0.489129245f},
-std::array<float,2>{0.464378387f, 0.550320268f},
-std::array<float,2>{0.810303152f, 0.242481843f},
-std::array<float,2>{0.702261209f, 0.568130493f},
-std::array<float,2>{0.179937229f, 0.139435455f},
-std::array<float,2>{0.339193583f, 0.75799948f},
-std::array<float,2>{0.883780777f, 0.435283244f},
-std::array<float,2>{0.813355446f, 0.916082323f},
-std::array<float,2>{0.378144532f, 0.357754022f},
-std::array<float,2>{0.0676089823f, 0.742024481f},
-std::array<float,2>{0.58384335f, 0.111017622f},
-std::array<float,2>{0.753050625f, 0.512379348f},
-std::array<float,2>{0.499913424f, 0.215957388f},
-std::array<float,2>{0.0260704476f, 0.838898182f},
-std::array<float,2>{0.52342993f, 0.44819513f},
-std::array<float,2>{0.666694641f, 0.966654837f},
-std::array<float,2>{0.188590869f, 0.265227526f},
-std::array<float,2>{0.258188516f, 0.635612369f},
-std::array<float,2>{0.981725574f, 0.0346491262f},
-std::array<float,2>{0.598078549f, 0.705188453f},
-std::array<float,2>{0.116268814f, 0.0815169364f},
-std::array<float,2>{0.4193165f, 0.900364816f},
-std::array<float,2>{0.848426461f, 0.315626651f},
-std::array<float,2>{0.931199789f, 0.792039096f},
-std::array<float,2>{0.374947548f, 0.379760027f},
-std::array<float,2>{0.152288243f, 0.61927259f},
-std::array<float,2>{0.744525373f, 0.158562243f},
-std::array<float,2>{0.891057849f, 0.602933347f},
-std::array<float,2>{0.315000683f, 0.174627617f},
-std::array<float,2>{0.163806736f, 0.80234164f},
-std::array<float,2>{0.707261086f, 0.403875083f},
-std::array<float,2>{0.576853931f, 0.883632541f},
-std::array<float,2>{0.0908366218f, 0.337216347f},
-std::array<float,2>{0.395680517f, 0.693296075f},
-std::array<float,2>{0.831641197f, 0.0715978295f},
-std::array<float,2>{0.63295573f, 0.652041852f},
-std::array<float,2>{0.219062403f, 0.0532586984f},
-std::array<float,2>{0.291855812f, 0.949112654f},
-std::array<float,2>{0.952885151f, 0.269032359f},
-std::array<float,2>{0.795473993f, 0.823610902f},
-std::array<float,2>{0.446165502f, 0.457495183f},
-std::array<float,2>{0.0436858609f, 0.51586926f},
-std::array<float,2>{0.53239435f, 0.202287987f},
-std::array<float,2>{0.866976142f, 0.733406007f},
-std::array<float,2>{0.436797798f, 0.0989981741f},
-std::array<float,2>{0.104648285f, 0.930931509f},
-std::array<float,2>{0.623859882f, 0.363502085f},
-std::array<float,2>{0.731459856f, 0.772259891f},
-std::array<float,2>{0.139291897f, 0.411713481f},
-std::array<float,2>{0.346033782f, 0.581473827f},
-std::array<float,2>{0.91987747f, 0.149364844f},
-std::array<float,2>{0.502447844f, 0.546623468f},
-std::array<float,2>{0.00114689092f, 0.229988262f},
-std::array<float,2>{0.479021221f, 0.847582221f},
-std::array<float,2>{0.781084895f, 0.475881636f},
-std::array<float,2>{0.985055387f, 0.991799176f},
-std::array<float,2>{0.278250158f, 0.307845294f},
-std::array<float,2>{0.212720841f, 0.682928324f},
-std::array<float,2>{0.681215405f, 0.0114199165f},
-std::array<float,2>{0.912157059f, 0.70166415f},
-std::array<float,2>{0.358728409f, 0.0667315722f},
-std::array<float,2>{0.132095948f, 0.877546489f},
-std::array<float,2>{0.719777465f, 0.330928057f},
-std::array<float,2>{0.611861169f, 0.806969523f},
-std::array<float,2>{0.10099446f, 0.391744733f},
-std::array<float,2>{0.425012648f, 0.59812212f},
-std::array<float,2>{0.868066609f, 0.1845126f},
-std::array<float,2>{0.679274797f, 0.526441813f},
-std::array<float,2>{0.206033722f, 0.188788891f},
-std::array<float,2>{0.26980707f, 0.816842258f},
-std::array<float,2>{0.993874073f, 0.465134889f},
-std::array<float,2>{0.772297382f, 0.938880086f},
-std::array<float,2>{0.474713653f, 0.278350294f},
-std::array<float,2>{0.00871613622f, 0.641859889f},
-std::array<float,2>{0.50899601f, 0.0583522879f},
-std::array<float,2>{0.837999344f, 0.591221333f},
-std::array<float,2>{0.39854157f, 0.142069951f},
-std::array<float,2>{0.0822764859f, 0.778502285f},
-std::array<float,2>{0.563119948f, 0.421245962f},
-std::array<float,2>{0.717568755f, 0.924926996f},
-std::array<float,2>{0.165636465f, 0.374315888f},
-std::array<float,2>{0.320323646f, 0.725777686f},
-std::array<float,2>{0.901468694f, 0.107276633f},
-std::array<float,2>{0.542852104f, 0.675249338f},
-std::array<float,2>{0.0375408195f, 0.000357033947f},
-std::array<float,2>{0.444698274f, 0.998826087f},
-std::array<float,2>{0.783388615f, 0.298024505f},
-std::array<float,2>{0.938392043f, 0.858992517f},
-std::array<float,2>{0.286611974f, 0.478739381f},
-std::array<float,2>{0.231855005f, 0.534736872f},
-std::array<float,2>{0.625455797f, 0.224656433f},
-std::array<float,2>{0.976189852f, 0.561753571f},
-std::array<float,2>{0.251414001f, 0.234473035f},
-std::array<float,2>{0.197548673f, 0.862945855f},
-std::array<float,2>{0.658008337f, 0.499990851f},
-std::array<float,2>{0.530889213f, 0.971870601f},
-std::array<float,2>{0.0227175541f, 0.286345422f},
-std::array<float,2>{0.489501357f, 0.671182275f},
-std::array<float,2>{0.75987047f, 0.0279411096f},
-std::array<float,2>{0.739172816f, 0.743766665f},
-std::array<float,2>{0.141423196f, 0.118304975f},
-std::array<float,2>{0.363154888f, 0.913189769f},
-std::array<float,2>{0.926754773f, 0.348287582f},
-std::array<float,2>{0.85884577f, 0.756291091f},
-std::array<float,2>{0.408154368f, 0.426051885f},
-std::array<float,2>{0.12367335f, 0.575176895f},
-std::array<float,2>{0.602479815f, 0.127182603f},
-std::array<float,2>{0.803606987f, 0.628348708f},
-std::array<float,2>{0.459371537f, 0.042007748f},
-std::array<float,2>{0.0605808906f, 0.955916405f},
-std::array<float,2>{0.562424958f, 0.257484645f},
-std::array<float,2>{0.645262003f, 0.829556286f},
-std::array<float,2>{0.243599266f, 0.439374954f},
-std::array<float,2>{0.30863151f, 0.500965238f},
-std::array<float,2>{0.968208313f, 0.20593524f},
-std::array<float,2>{0.59277606f, 0.614047706f},
-std::array<float,2>{0.0705833212f, 0.165059f},
-std::array<float,2>{0.386989594f, 0.781501412f},
-std::array<float,2>{0.823388755f, 0.388757527f},
-std::array<float,2>{0.882502615f, 0.892475963f},
-std::array<float,2>{0.33418417f, 0.324830621f},
-std::array<float,2>{0.173154742f, 0.71671015f},
-std::array<float,2>{0.695015371f, 0.0931716487f},
-std::array<float,2>{0.997608304f, 0.735357285f},
-std::array<float,2>{0.269222021f, 0.115520023f},
-std::array<float,2>{0.210362419f, 0.920043111f},
-std::array<float,2>{0.673844099f, 0.353170425f},
-std::array<float,2>{0.515605927f, 0.762168765f},
-std::array<float,2>{0.0151278079f, 0.433366686f},
-std::array<float,2>{0.470342517f, 0.562768638f},
-std::array<float,2>{0.769229591f, 0.13528198f},
-std::array<float,2>{0.723635077f, 0.550870001f},
-std::array<float,2>{0.127513438f, 0.248494551f},
-std::array<float,2>{0.354630679f, 0.869244277f},
-std::array<float,2>{0.907276094f, 0.485710591f},
-std::array<float,2>{0.872587442f, 0.983382046f},
-std::array<float,2>{0.427737653f, 0.290924489f},
-std::array<float,2>{0.0945046544f, 0.661033988f},
-std::array<float,2>{0.616795659f, 0.0217270572f},
-std::array<float,2>{0.788688719f, 0.621586442f},
-std::array<float,2>{0.439179569f, 0.163360909f},
-std::array<float,2>{0.0325808749f, 0.79466784f},
-std::array<float,2>{0.544758797f, 0.376998842f},
-std::array<float,2>{0.630274475f, 0.904036283f},
-std::array<float,2>{0.230054647f, 0.318530619f},
-std::array<float,2>{0.283029646f, 0.710920274f},
-std::array<float,2>{0.941735923f, 0.0858755633f},
-std::array<float,2>{0.567124069f, 0.638432384f},
-std::array<float,2>{0.0785021037f, 0.0389338322f},
-std::array<float,2>{0.402752191f, 0.963680327f},
-std::array<float,2>{0.84318012f, 0.260528773f},
-std::array<float,2>{0.905562043f, 0.840296805f},
-std::array<float,2>{0.324700624f, 0.451678425f},
-std::array<float,2>{0.169433728f, 0.509444714f},
-std::array<float,2>{0.711954296f, 0.21224229f},
-std::array<float,2>{0.924717903f, 0.520971954f},
-std::array<float,2>{0.365407109f, 0.196137458f},
-std::array<float,2>{0.146843269f, 0.824652612f},
-std::array<float,2>{0.737420201f, 0.455851078f},
-std::array<float,2>{0.606590867f, 0.952029824f},
-std::array<float,2>{0.117995858f, 0.271502882f},
-std::array<float,2>{0.412447512f, 0.653922498f},
-std::array<float,2>{0.854555726f, 0.0499596819f},
-std::array<float,2>{0.661427498f, 0.688678443f},
-std::array<float,2>{0.202797949f, 0.0745304376f},
-std::array<float,2>{0.25685662f, 0.890468538f},
-std::array<float,2>{0.971920907f, 0.341314316f},
-std::array<float,2>{0.765291989f, 0.798490703f},
-std::array<float,2>{0.486985564f, 0.40031296f},
-std::array<float,2>{0.0191459097f, 0.606676221f},
-std::array<float,2>{0.526860893f, 0.178575009f},
-std::array<float,2>{0.825989187f, 0.683749676f},
-std::array<float,2>{0.386627406f, 0.0128956866f},
-std::array<float,2>{0.0776133686f, 0.987418473f},
-std::array<float,2>{0.587450683f, 0.309184819f},
-std::array<float,2>{0.688567936f, 0.851393104f},
-std::array<float,2>{0.17832461f, 0.468925655f},
-std::array<float,2>{0.330778778f, 0.540018141f},
-std::array<float,2>{0.877039433f, 0.232360348f},
-std::array<float,2>{0.555348217f, 0.583659232f},
-std::array<float,2>{0.0574039817f, 0.155256659f},
-std::array<float,2>{0.453652501f, 0.769527137f},
-std::array<float,2>{0.798667252f, 0.409163982f},
-std::array<float,2>{0.961122096f, 0.933761299f},
-std::array<float,2>{0.30568099f, 0.362096459f},
-std::array<float,2>{0.246490553f, 0.728850484f},
-std::array<float,2>{0.644028842f, 0.0973652452f},
-std::array<float,2>{0.887667179f, 0.647354841f},
-std::array<float,2>{0.34211275f, 0.0588557832f},
-std::array<float,2>{0.184901223f, 0.941684008f},
-std::array<float,2>{0.697316945f, 0.273625493f},
-std::array<float,2>{0.578724205f, 0.814788759f},
-std::array<float,2>{0.0638159588f, 0.461265177f},
-std::array<float,2>{0.382589132f, 0.529114008f},
-std::array<float,2>{0.817154408f, 0.193073139f},
-std::array<float,2>{0.654992163f, 0.595856786f},
-std::array<float,2>{0.237513632f, 0.182514787f},
-std::array<float,2>{0.299395472f, 0.809209764f},
-std::array<float,2>{0.958866298f, 0.395789951f},
-std::array<float,2>{0.80821085f, 0.882021427f},
-std::array<float,2>{0.465981424f, 0.334699899f},
-std::array<float,2>{0.0526202917f, 0.698371232f},
-std::array<float,2>{0.550709724f, 0.0648619086f},
-std::array<float,2>{0.846508801f, 0.536543965f},
-std::array<float,2>{0.415583104f, 0.220706433f},
-std::array<float,2>{0.112657718f, 0.854400635f},
-std::array<float,2>{0.5976125f, 0.481012464f},
-std::array<float,2>{0.74940002f, 0.994621336f},
-std::array<float,2>{0.155818149f, 0.301957637f},
-std::array<float,2>{0.368110895f, 0.677156806f},
-std::array<float,2>{0.937288582f, 0.0049409708f},
-std::array<float,2>{0.517454565f, 0.720869958f},
-std::array<float,2>{0.0302884951f, 0.105057918f},
-std::array<float,2>{0.492940187f, 0.928934038f},
-std::array<float,2>{0.754913807f, 0.368283361f},
-std::array<float,2>{0.979390681f, 0.775204539f},
-std::array<float,2>{0.264494002f, 0.414162874f},
-std::array<float,2>{0.194624558f, 0.58736676f},
-std::array<float,2>{0.67061013f, 0.146532819f},
-std::array<float,2>{0.945462465f, 0.572518408f},
-std::array<float,2>{0.294311374f, 0.131624952f},
-std::array<float,2>{0.222845122f, 0.750685096f},
-std::array<float,2>{0.636765063f, 0.424601227f},
-std::array<float,2>{0.538315594f, 0.90821296f},
-std::array<float,2>{0.0404923633f, 0.344709605f},
-std::array<float,2>{0.449740082f, 0.749904871f},
-std::array<float,2>{0.791802049f, 0.12476296f},
-std::array<float,2>{0.704463899f, 0.665467322f},
-std::array<float,2>{0.156503007f, 0.0253951419f},
-std::array<float,2>{0.318769991f, 0.975019395f},
-std::array<float,2>{0.897687197f, 0.281365246f},
-std::array<float,2>{0.832699239f, 0.865318239f},
-std::array<float,2>{0.393858373f, 0.495321661f},
-std::array<float,2>{0.089376606f, 0.556138217f},
-std::array<float,2>{0.573420167f, 0.241167739f},
-std::array<float,2>{0.773509085f, 0.711445689f},
-std::array<float,2>{0.481095493f, 0.0890414864f},
-std::array<float,2>{0.00440502213f, 0.896447659f},
-std::array<float,2>{0.506870925f, 0.323006511f},
-std::array<float,2>{0.684620321f, 0.785877466f},
-std::array<float,2>{0.21594362f, 0.384543359f},
-std::array<float,2>{0.274246335f, 0.611134827f},
-std::array<float,2>{0.990251899f, 0.170222402f},
-std::array<float,2>{0.618751407f, 0.50644207f},
-std::array<float,2>{0.108987942f, 0.210643977f},
-std::array<float,2>{0.42999807f, 0.832552493f},
-std::array<float,2>{0.860118151f, 0.444111347f},
-std::array<float,2>{0.917741954f, 0.958845675f},
-std::array<float,2>{0.348763913f, 0.251253754f},
-std::array<float,2>{0.134497747f, 0.630762935f},
-std::array<float,2>{0.72806716f, 0.0461473018f},
-std::array<float,2>{0.96857506f, 0.626711488f},
-std::array<float,2>{0.309354812f, 0.0403783433f},
-std::array<float,2>{0.243998632f, 0.953183353f},
-std::array<float,2>{0.644849181f, 0.254573464f},
-std::array<float,2>{0.561747253f, 0.830953717f},
-std::array<float,2>{0.0614218451f, 0.441301525f},
-std::array<float,2>{0.459536403f, 0.502036333f},
-std::array<float,2>{0.803005457f, 0.204720274f},
-std::array<float,2>{0.694539249f, 0.617067516f},
-std::array<float,2>{0.173702374f, 0.167122751f},
-std::array<float,2>{0.334527045f, 0.783790231f},
-std::array<float,2>{0.882162631f, 0.388298482f},
-std::array<float,2>{0.823935032f, 0.892684281f},
-std::array<float,2>{0.387330472f, 0.326187044f},
-std::array<float,2>{0.0708468184f, 0.718067229f},
-std::array<float,2>{0.593372405f, 0.0912533775f},
-std::array<float,2>{0.76063776f, 0.559582531f},
-std::array<float,2>{0.489761174f, 0.236646637f},
-std::array<float,2>{0.0229780599f, 0.860868752f},
-std::array<float,2>{0.530369878f, 0.496870637f},
-std::array<float,2>{0.657327175f, 0.969557822f},
-std::array<float,2>{0.198132172f, 0.287954658f},
-std::array<float,2>{0.251484841f, 0.669894874f},
-std::array<float,2>{0.975945354f, 0.0311313886f},
-std::array<float,2>{0.602037072f, 0.744235337f},
-std::array<float,2>{0.12343993f, 0.119992539f},
-std::array<float,2>{0.407331944f, 0.910457313f},
-std::array<float,2>{0.859065056f, 0.350545019f},
-std::array<float,2>{0.925842583f, 0.754998565f},
-std::array<float,2>{0.362514079f, 0.428774208f},
-std::array<float,2>{0.140711516f, 0.577199221f},
-std::array<float,2>{0.738439083f, 0.126282319f},
-std::array<float,2>{0.902134836f, 0.592197955f},
-std::array<float,2>{0.320880771f, 0.142843008f},
-std::array<float,2>{0.165476695f, 0.781007588f},
-std::array<float,2>{0.717030823f, 0.419046789f},
-std::array<float,2>{0.562586963f, 0.921925724f},
-std::array<float,2>{0.0827729851f, 0.372089446f},
-std::array<float,2>{0.399055541f, 0.723944187f},
-std::array<float,2>{0.838775814f, 0.108097501f},
-std::array<float,2>{0.625928521f, 0.671973348f},
-std::array<float,2>{0.231943995f, 0.00240931567f},
-std::array<float,2>{0.286814094f, 0.996255815f},
-std::array<float,2>{0.937851489f, 0.299747258f},
-std::array<float,2>{0.783748388f, 0.856328905f},
-std::array<float,2>{0.444961965f, 0.47757414f},
-std::array<float,2>{0.0379591025f, 0.531624615f},
-std::array<float,2>{0.542257965f, 0.222797304f},
-std::array<float,2>{0.867624581f, 0.700360239f},
-std::array<float,2>{0.425699085f, 0.0684503913f},
-std::array<float,2>{0.10152033f, 0.8767398f},
-std::array<float,2>{0.611396968f, 0.328404158f},
-std::array<float,2>{0.720453382f, 0.806174934f},
-std::array<float,2>{0.132519811f, 0.393133402f},
-std::array<float,2>{0.359349519f, 0.5999493f},
-std::array<float,2>{0.912813902f, 0.187429458f},
-std::array<float,2>{0.509713292f, 0.524671972f},
-std::array<float,2>{0.00788985845f, 0.1895037f},
-std::array<float,2>{0.475525975f, 0.818880022f},
-std::array<float,2>{0.771953821f, 0.467179567f},
-std::array<float,2>{0.993644536f, 0.940849125f},
-std::array<float,2>{0.270344466f, 0.28044793f},
-std::array<float,2>{0.205102488f, 0.644362807f},
-std::array<float,2>{0.678838253f, 0.0552852936f},
-std::array<float,2>{0.918983102f, 0.732330739f},
-std::array<float,2>{0.346413523f, 0.101099044f},
-std::array<float,2>{0.138874888f, 0.93292284f},
-std::array<float,2>{0.731957376f, 0.365932941f},
-std::array<float,2>{0.623164117f, 0.770023763f},
-std::array<float,2>{0.105408154f, 0.412582338f},
-std::array<float,2>{0.437118053f, 0.578948677f},
-std::array<float,2>{0.866592944f, 0.151712701f},
-std::array<float,2>{0.680833042f, 0.543046176f},
-std::array<float,2>{0.212196067f, 0.227113649f},
-std::array<float,2>{0.277799428f, 0.844151735f},
-std::array<float,2>{0.984466434f, 0.473936945f},
-std::array<float,2>{0.78059274f, 0.990229785f},
-std::array<float,2>{0.478613645f, 0.305979311f},
-std::array<float,2>{0.00165095425f, 0.680149794f},
-std::array<float,2>{0.502164304f, 0.00832374115f},
-std::array<float,2>{0.831288338f, 0.60413152f},
-std::array<float,2>{0.396402538f, 0.172628418f},
-std::array<float,2>{0.091694884f, 0.803506017f},
-std::array<float,2>{0.576456547f, 0.406098276f},
-std::array<float,2>{0.707793355f, 0.886268079f},
-std::array<float,2>{0.163398251f, 0.339674681f},
-std::array<float,2>{0.31472671f, 0.693863332f},
-std::array<float,2>{0.891157448f, 0.0726267844f},
-std::array<float,2>{0.53280127f, 0.650347292f},
-std::array<float,2>{0.0434107445f, 0.0527294166f},
-std::array<float,2>{0.445606858f, 0.946982622f},
-std::array<float,2>{0.795377314f, 0.266684294f},
-std::array<float,2>{0.952566624f, 0.822241545f},
-std::array<float,2>{0.291391909f, 0.459427983f},
-std::array<float,2>{0.219400361f, 0.518014908f},
-std::array<float,2>{0.6335693f, 0.199326828f},
-std::array<float,2>{0.982009172f, 0.514308274f},
-std::array<float,2>{0.258658081f, 0.217968434f},
-std::array<float,2>{0.189399838f, 0.836909831f},
-std::array<float,2>{0.666220665f, 0.445585221f},
-std::array<float,2>{0.522913039f, 0.968652666f},
-std::array<float,2>{0.0254118126f, 0.263380736f},
-std::array<float,2>{0.499292701f, 0.63295871f},
-std::array<float,2>{0.753615558f, 0.0323191397f},
-std::array<float,2>{0.744968832f, 0.703890502f},
-std::array<float,2>{0.151495576f, 0.0793024451f},
-std::array<float,2>{0.374033451f, 0.90058732f},
-std::array<float,2>{0.931071937f, 0.313998491f},
-std::array<float,2>{0.847722828f, 0.789597273f},
-std::array<float,2>{0.419575036f, 0.382661015f},
-std::array<float,2>{0.1167145f, 0.618920028f},
-std::array<float,2>{0.598212183f, 0.156993255f},
-std::array<float,2>{0.80962491f, 0.658152997f},
-std::array<float,2>{0.464327037f, 0.0191780273f},
-std::array<float,2>{0.0475311056f, 0.977297902f},
-std::array<float,2>{0.552840114f, 0.293244779f},
-std::array<float,2>{0.649572909f, 0.873462915f},
-std::array<float,2>{0.239980996f, 0.491984636f},
-std::array<float,2>{0.304493219f, 0.547886312f},
-std::array<float,2>{0.953367412f, 0.244980454f},
-std::array<float,2>{0.583243072f, 0.569887459f},
-std::array<float,2>{0.0682195798f, 0.138259605f},
-std::array<float,2>{0.37843135f, 0.760761619f},
-std::array<float,2>{0.812670946f, 0.436908394f},
-std::array<float,2>{0.882832229f, 0.914673269f},
-std::array<float,2>{0.339599192f, 0.355724484f},
-std::array<float,2>{0.18035312f, 0.738405943f},
-std::array<float,2>{0.703091323f, 0.112224475f},
-std::array<float,2>{0.990796804f, 0.71448344f},
-std::array<float,2>{0.273654073f, 0.0859515145f},
-std::array<float,2>{0.216671243f, 0.897493362f},
-std::array<float,2>{0.685153782f, 0.321679682f},
-std::array<float,2>{0.507388413f, 0.788729846f},
-std::array<float,2>{0.00420308579f, 0.385302633f},
-std::array<float,2>{0.480485022f, 0.61297977f},
-std::array<float,2>{0.774169326f, 0.169650435f},
-std::array<float,2>{0.727698505f, 0.505615115f},
-std::array<float,2>{0.133943498f, 0.207745686f},
-std::array<float,2>{0.349422574f, 0.83507669f},
-std::array<float,2>{0.916993022f, 0.442476183f},
-std::array<float,2>{0.859799862f, 0.959872007f},
-std::array<float,2>{0.430475652f, 0.252117902f},
-std::array<float,2>{0.108499885f, 0.63098681f},
-std::array<float,2>{0.618292868f, 0.0446762368f},
-std::array<float,2>{0.791269958f, 0.571262121f},
-std::array<float,2>{0.449224621f, 0.129730597f},
-std::array<float,2>{0.0405941904f, 0.752876878f},
-std::array<float,2>{0.538603246f, 0.422756404f},
-std::array<float,2>{0.637338519f, 0.907464564f},
-std::array<float,2>{0.223272815f, 0.346846789f},
-std::array<float,2>{0.294664055f, 0.747780442f},
-std::array<float,2>{0.945902407f, 0.122377947f},
-std::array<float,2>{0.5739218f, 0.666859448f},
-std::array<float,2>{0.0888885334f, 0.024745075f},
-std::array<float,2>{0.394345373f, 0.974334776f},
-std::array<float,2>{0.832518518f, 0.283270687f},
-std::array<float,2>{0.898380876f, 0.865085602f},
-std::array<float,2>{0.319017053f, 0.492307156f},
-std::array<float,2>{0.156832561f, 0.558040559f},
-std::array<float,2>{0.705058575f, 0.239982739f},
-std::array<float,2>{0.936801374f, 0.537268817f},
-std::array<float,2>{0.367359519f, 0.219171777f},
-std::array<float,2>{0.155503243f, 0.853287041f},
-std::array<float,2>{0.749936163f, 0.483296424f},
-std::array<float,2>{0.59688735f, 0.992748022f},
-std::array<float,2>{0.113213107f, 0.30387792f},
-std::array<float,2>{0.415446997f, 0.678300202f},
-std::array<float,2>{0.845715702f, 0.00614207843f},
-std::array<float,2>{0.669961751f, 0.720670819f},
-std::array<float,2>{0.195188597f, 0.102858998f},
-std::array<float,2>{0.263945758f, 0.926502526f},
-std::array<float,2>{0.978798091f, 0.36952877f},
-std::array<float,2>{0.755427659f, 0.777027309f},
-std::array<float,2>{0.492279947f, 0.416697085f},
-std::array<float,2>{0.0309813078f, 0.588032663f},
-std::array<float,2>{0.517017126f, 0.144674718f},
-std::array<float,2>{0.816570997f, 0.646380305f},
-std::array<float,2>{0.381898433f, 0.0610085465f},
-std::array<float,2>{0.0642068684f, 0.943366706f},
-std::array<float,2>{0.578410268f, 0.27570197f},
-std::array<float,2>{0.698165715f, 0.812532902f},
-std::array<float,2>{0.185532048f, 0.463252783f},
-std::array<float,2>{0.34236449f, 0.530781686f},
-std::array<float,2>{0.887058556f, 0.194878265f},
-std::array<float,2>{0.550093234f, 0.593972921f},
-std::array<float,2>{0.0519949086f, 0.1813692f},
-std::array<float,2>{0.466719329f, 0.811837733f},
-std::array<float,2>{0.807916105f, 0.396577924f},
-std::array<float,2>{0.958433747f, 0.879267693f},
-std::array<float,2>{0.298930943f, 0.333706677f},
-std::array<float,2>{0.238269418f, 0.696416616f},
-std::array<float,2>{0.654483855f, 0.0625546798f},
-std::array<float,2>{0.877876818f, 0.687255442f},
-std::array<float,2>{0.330326706f, 0.0155346356f},
-std::array<float,2>{0.177798718f, 0.986168265f},
-std::array<float,2>{0.689142406f, 0.311560631f},
-std::array<float,2>{0.58725822f, 0.848926127f},
-std::array<float,2>{0.0780171007f, 0.471399754f},
-std::array<float,2>{0.385803312f, 0.541386008f},
-std::array<float,2>{0.825309575f, 0.232470885f},
-std::array<float,2>{0.644375622f, 0.584825635f},
-std::array<float,2>{0.246791095f, 0.153406247f},
-std::array<float,2>{0.306211561f, 0.767252028f},
-std::array<float,2>{0.961532593f, 0.406993955f},
-std::array<float,2>{0.798333824f, 0.93669647f},
-std::array<float,2>{0.453511775f, 0.360046297f},
-std::array<float,2>{0.0568706878f, 0.726723313f},
-std::array<float,2>{0.554997623f, 0.0937667713f},
-std::array<float,2>{0.855196774f, 0.521889508f},
-std::array<float,2>{0.412983686f, 0.198967651f},
-std::array<float,2>{0.117392756f, 0.82777077f},
-std::array<float,2>{0.607001483f, 0.454822838f},
-std::array<float,2>{0.737987041f, 0.950839281f},
-std::array<float,2>{0.147373661f, 0.270417184f},
-std::array<float,2>{0.366155684f, 0.655845225f},
-std::array<float,2>{0.92419976f, 0.0486982465f},
-std::array<float,2>{0.526458442f, 0.689500093f},
-std::array<float,2>{0.0190092381f, 0.0780870095f},
-std::array<float,2>{0.486686587f, 0.8882851f},
-std::array<float,2>{0.764943004f, 0.341816157f},
-std::array<float,2>{0.972426295f, 0.800532341f},
-std::array<float,2>{0.257475168f, 0.401344061f},
-std::array<float,2>{0.20248194f, 0.60869205f},
-std::array<float,2>{0.662047207f, 0.176331416f},
-std::array<float,2>{0.942356586f, 0.624405563f},
-std::array<float,2>{0.282435089f, 0.160687521f},
-std::array<float,2>{0.229794249f, 0.796241939f},
-std::array<float,2>{0.63038826f, 0.37615642f},
-std::array<float,2>{0.5439623f, 0.904658437f},
-std::array<float,2>{0.0327471867f, 0.316675812f},
-std::array<float,2>{0.438672423f, 0.707670271f},
-std::array<float,2>{0.788517773f, 0.083242774f},
-std::array<float,2>{0.712773681f, 0.639499903f},
-std::array<float,2>{0.169220179f, 0.0365076661f},
-std::array<float,2>{0.324871242f, 0.961822629f},
-std::array<float,2>{0.905885875f, 0.259483486f},
-std::array<float,2>{0.843422472f, 0.842719376f},
-std::array<float,2>{0.402839571f, 0.450728655f},
-std::array<float,2>{0.0790749416f, 0.510953784f},
-std::array<float,2>{0.566707194f, 0.214230493f},
-std::array<float,2>{0.768964291f, 0.737050712f},
-std::array<float,2>{0.470110863f, 0.113764755f},
-std::array<float,2>{0.0153039536f, 0.919515371f},
-std::array<float,2>{0.514914334f, 0.354113877f},
-std::array<float,2>{0.674464464f, 0.764841497f},
-std::array<float,2>{0.210603863f, 0.43068698f},
-std::array<float,2>{0.268846631f, 0.565703213f},
-std::array<float,2>{0.997378111f, 0.133906499f},
-std::array<float,2>{0.616367877f, 0.552782416f},
-std::array<float,2>{0.0941216499f, 0.248021841f},
-std::array<float,2>{0.42822662f, 0.867589951f},
-std::array<float,2>{0.872380912f, 0.487258196f},
-std::array<float,2>{0.907862663f, 0.980808794f},
-std::array<float,2>{0.355082124f, 0.292695224f},
-std::array<float,2>{0.127038389f, 0.66339618f},
-std::array<float,2>{0.724455893f, 0.0199244656f},
-std::array<float,2>{0.972757757f, 0.671751499f},
-std::array<float,2>{0.252626717f, 0.0275166016f},
-std::array<float,2>{0.196724609f, 0.972176015f},
-std::array<float,2>{0.658766806f, 0.287001342f},
-std::array<float,2>{0.527994156f, 0.862758458f},
-std::array<float,2>{0.0198401418f, 0.499304712f},
-std::array<float,2>{0.491194934f, 0.562473655f},
-std::array<float,2>{0.758858502f, 0.235010475f},
-std::array<float,2>{0.741333425f, 0.574393451f},
-std::array<float,2>{0.144054338f, 0.127927303f},
-std::array<float,2>{0.360635132f, 0.756710351f},
-std::array<float,2>{0.928928018f, 0.426371485f},
-std::array<float,2>{0.857146263f, 0.913930535f},
-std::array<float,2>{0.409723639f, 0.347735465f},
-std::array<float,2>{0.122977331f, 0.743432939f},
-std::array<float,2>{0.604226589f, 0.118820079f},
-std::array<float,2>{0.802623153f, 0.500377476f},
-std::array<float,2>{0.458190382f, 0.205481991f},
-std::array<float,2>{0.0587303862f, 0.829618871f},
-std::array<float,2>{0.559133112f, 0.438790649f},
-std::array<float,2>{0.646585405f, 0.955309808f},
-std::array<float,2>{0.245836973f, 0.257146984f},
-std::array<float,2>{0.312223732f, 0.628840268f},
-std::array<float,2>{0.96636337f, 0.0428826921f},
-std::array<float,2>{0.591220081f, 0.716240644f},
-std::array<float,2>{0.0726454929f, 0.0935700163f},
-std::array<float,2>{0.390574694f, 0.891881883f},
-std::array<float,2>{0.822110295f, 0.324349672f},
-std::array<float,2>{0.879341841f, 0.782223284f},
-std::array<float,2>{0.333245069f, 0.389188677f},
-std::array<float,2>{0.1744508f, 0.613609135f},
-std::array<float,2>{0.691925168f, 0.16598022f},
-std::array<float,2>{0.911664367f, 0.598231018f},
-std::array<float,2>{0.356766552f, 0.183876172f},
-std::array<float,2>{0.13053821f, 0.807144284f},
-std::array<float,2>{0.721251726f, 0.392355919f},
-std::array<float,2>{0.609757841f, 0.876957953f},
-std::array<float,2>{0.0984399989f, 0.330441386f},
-std::array<float,2>{0.422731817f, 0.701378584f},
-std::array<float,2>{0.870452046f, 0.0672928616f},
-std::array<float,2>{0.676121056f, 0.642360449f},
-std::array<float,2>{0.203792512f, 0.0577576496f},
-std::array<float,2>{0.272305578f, 0.939294159f},
-std::array<float,2>{0.995288253f, 0.279103726f},
-std::array<float,2>{0.770406604f, 0.816927373f},
-std::array<float,2>{0.473668337f, 0.465651721f},
-std::array<float,2>{0.0105777206f, 0.527246892f},
-std::array<float,2>{0.51117748f, 0.189391002f},
-std::array<float,2>{0.836236715f, 0.726150632f},
-std::array<float,2>{0.401979268f, 0.106772602f},
-std::array<float,2>{0.084479697f, 0.925695896f},
-std::array<float,2>{0.566197574f, 0.374583066f},
-std::array<float,2>{0.716627061f, 0.779267609f},
-std::array<float,2>{0.167590722f, 0.421426892f},
-std::array<float,2>{0.323827684f, 0.591764033f},
-std::array<float,2>{0.898930073f, 0.142205715f},
-std::array<float,2>{0.539255977f, 0.534387112f},
-std::array<float,2>{0.0367527977f, 0.225310907f},
-std::array<float,2>{0.442979783f, 0.858520389f},
-std::array<float,2>{0.781428635f, 0.479162425f},
-std::array<float,2>{0.941238999f, 0.998482823f},
-std::array<float,2>{0.287516654f, 0.298416138f},
-std::array<float,2>{0.23314181f, 0.675573766f},
-std::array<float,2>{0.627519906f, 0.000511841674f},
-std::array<float,2>{0.892787337f, 0.692486763f},
-std::array<float,2>{0.314106375f, 0.0722126067f},
-std::array<float,2>{0.161144599f, 0.882928908f},
-std::array<float,2>{0.710144758f, 0.337402672f},
-std::array<float,2>{0.574486613f, 0.802204788f},
-std::array<float,2>{0.0926312283f, 0.403343916f},
-std::array<float,2>{0.397871405f, 0.603406072f},
-std::array<float,2>{0.828143179f, 0.174253955f},
-std::array<float,2>{0.635129452f, 0.51655966f},
-std::array<float,2>{0.222444221f, 0.202796534f},
-std::array<float,2>{0.290073961f, 0.823984087f},
-std::array<float,2>{0.94959408f, 0.457871318f},
-std::array<float,2>{0.793345809f, 0.948521733f},
-std::array<float,2>{0.449039757f, 0.269450217f},
-std::array<float,2>{0.0449617803f, 0.651404202f},
-std::array<float,2>{0.534127772f, 0.0530307442f},
-std::array<float,2>{0.863297284f, 0.581687212f},
-std::array<float,2>{0.435345858f, 0.148548841f},
-std::array<float,2>{0.102485478f, 0.771779776f},
-std::array<float,2>{0.621952474f, 0.411179036f},
-std::array<float,2>{0.733481467f, 0.931491852f},
-std::array<float,2>{0.138592362f, 0.363844782f},
-std::array<float,2>{0.345668733f, 0.734367728f},
-std::array<float,2>{0.920468867f, 0.0995637104f},
-std::array<float,2>{0.500477195f, 0.683257699f},
-std::array<float,2>{0.00237068906f, 0.0109775392f},
-std::array<float,2>{0.477689385f, 0.991697311f},
-std::array<float,2>{0.7774266f, 0.308511198f},
-std::array<float,2>{0.986427605f, 0.847011745f},
-std::array<float,2>{0.280692548f, 0.476234198f},
-std::array<float,2>{0.213127553f, 0.546272814f},
-std::array<float,2>{0.683122694f, 0.229676768f},
-std::array<float,2>{0.955404043f, 0.550177753f},
-std::array<float,2>{0.302354723f, 0.243152246f},
-std::array<float,2>{0.242040798f, 0.871931314f},
-std::array<float,2>{0.650594711f, 0.488689631f},
-std::array<float,2>{0.552431047f, 0.978540838f},
-std::array<float,2>{0.0496974885f, 0.296786815f},
-std::array<float,2>{0.462664753f, 0.658662915f},
-std::array<float,2>{0.811138809f, 0.0158878583f},
-std::array<float,2>{0.699730933f, 0.741428256f},
-std::array<float,2>{0.182825819f, 0.110725828f},
-std::array<float,2>{0.336848408f, 0.916576982f},
-std::array<float,2>{0.885941565f, 0.358309835f},
-std::array<float,2>{0.816395044f, 0.758374333f},
-std::array<float,2>{0.375992447f, 0.434812158f},
-std::array<float,2>{0.0684892312f, 0.567749262f},
-std::array<float,2>{0.584649563f, 0.13880448f},
-std::array<float,2>{0.751276672f, 0.634975255f},
-std::array<float,2>{0.496239126f, 0.0348784178f},
-std::array<float,2>{0.0246265251f, 0.96615386f},
-std::array<float,2>{0.519782901f, 0.265022278f},
-std::array<float,2>{0.665015757f, 0.839476764f},
-std::array<float,2>{0.190122172f, 0.447656691f},
-std::array<float,2>{0.260559738f, 0.511983931f},
-std::array<float,2>{0.984133482f, 0.216482297f},
-std::array<float,2>{0.600037634f, 0.619723499f},
-std::array<float,2>{0.114045337f, 0.158998922f},
-std::array<float,2>{0.42162469f, 0.792569518f},
-std::array<float,2>{0.850731611f, 0.379334658f},
-std::array<float,2>{0.9323349f, 0.899429321f},
-std::array<float,2>{0.37282148f, 0.316400796f},
-std::array<float,2>{0.149453849f, 0.705611706f},
-std::array<float,2>{0.742468297f, 0.0819685012f},
-std::array<float,2>{0.947622895f, 0.749248505f},
-std::array<float,2>{0.296114236f, 0.124412037f},
-std::array<float,2>{0.225102589f, 0.908822179f},
-std::array<float,2>{0.638707757f, 0.344213039f},
-std::array<float,2>{0.536191642f, 0.750271678f},
-std::array<float,2>{0.0413603f, 0.424287051f},
-std::array<float,2>{0.452263266f, 0.573056996f},
-std::array<float,2>{0.790209234f, 0.131211147f},
-std::array<float,2>{0.705598891f, 0.556590676f},
-std::array<float,2>{0.15915224f, 0.240259632f},
-std::array<float,2>{0.317208588f, 0.865932226f},
-std::array<float,2>{0.894804597f, 0.495642632f},
-std::array<float,2>{0.834572792f, 0.975273788f},
-std::array<float,2>{0.391016185f, 0.282209933f},
-std::array<float,2>{0.0876398161f, 0.66558373f},
-std::array<float,2>{0.571816385f, 0.0260256063f},
-std::array<float,2>{0.776057363f, 0.610661507f},
-std::array<float,2>{0.483433247f, 0.170696095f},
-std::array<float,2>{0.00737012969f, 0.785208166f},
-std::array<float,2>{0.5043872f, 0.384228826f},
-std::array<float,2>{0.686042607f, 0.895709693f},
-std::array<float,2>{0.218439147f, 0.322712541f},
-std::array<float,2>{0.275460184f, 0.711383104f},
-std::array<float,2>{0.989477098f, 0.0897349641f},
-std::array<float,2>{0.619859219f, 0.630128086f},
-std::array<float,2>{0.107271381f, 0.0466251373f},
-std::array<float,2>{0.432611167f, 0.958108544f},
-std::array<float,2>{0.862002134f, 0.25190112f},
-std::array<float,2>{0.915961802f, 0.832451642f},
-std::array<float,2>{0.349745303f, 0.44368574f},
-std::array<float,2>{0.136349723f, 0.505981505f},
-std::array<float,2>{0.728917658f, 0.210288838f},
-std::array<float,2>{0.89038384f, 0.528737307f},
-std::array<float,2>{0.340935796f, 0.192622781f},
-std::array<float,2>{0.186354652f, 0.815086365f},
-std::array<float,2>{0.695416331f, 0.461583227f},
-std::array<float,2>{0.581531525f, 0.942225099f},
-std::array<float,2>{0.0662901029f, 0.274159968f},
-std::array<float,2>{0.380792648f, 0.646788001f},
-std::array<float,2>{0.819605649f, 0.0595113412f},
-std::array<float,2>{0.653199792f, 0.699116409f},
-std::array<float,2>{0.234844849f, 0.0649451315f},
-std::array<float,2>{0.298401713f, 0.88244313f},
-std::array<float,2>{0.960337341f, 0.334293276f},
-std::array<float,2>{0.804945588f, 0.809074163f},
-std::array<float,2>{0.468169898f, 0.396035403f},
-std::array<float,2>{0.0540834367f, 0.596441746f},
-std::array<float,2>{0.546984375f, 0.181650937f},
-std::array<float,2>{0.844333112f, 0.677526712f},
-std::array<float,2>{0.417592913f, 0.00548255863f},
-std::array<float,2>{0.110546701f, 0.994877636f},
-std::array<float,2>{0.594638467f, 0.302714586f},
-std::array<float,2>{0.746251583f, 0.85356468f},
-std::array<float,2>{0.15344958f, 0.480879962f},
-std::array<float,2>{0.370092899f, 0.537056506f},
-std::array<float,2>{0.934045732f, 0.221403375f},
-std::array<float,2>{0.518140137f, 0.587853312f},
-std::array<float,2>{0.0291987266f, 0.147074565f},
-std::array<float,2>{0.494805902f, 0.774493694f},
-std::array<float,2>{0.756755769f, 0.414700896f},
-std::array<float,2>{0.977495193f, 0.929452479f},
-std::array<float,2>{0.262522846f, 0.368798435f},
-std::array<float,2>{0.192216262f, 0.72120887f},
-std::array<float,2>{0.668727398f, 0.104876705f},
-std::array<float,2>{0.922162354f, 0.653796494f},
-std::array<float,2>{0.365177304f, 0.0506970957f},
-std::array<float,2>{0.145383269f, 0.951300204f},
-std::array<float,2>{0.73616004f, 0.272008866f},
-std::array<float,2>{0.608911097f, 0.824855626f},
-std::array<float,2>{0.119524203f, 0.455096334f},
-std::array<float,2>{0.411515087f, 0.521192551f},
-std::array<float,2>{0.852454126f, 0.195313141f},
-std::array<float,2>{0.662452996f, 0.607012272f},
-std::array<float,2>{0.200926006f, 0.177812397f},
-std::array<float,2>{0.255381733f, 0.7980932f},
-std::array<float,2>{0.970056653f, 0.399692833f},
-std::array<float,2>{0.763130486f, 0.889814615f},
-std::array<float,2>{0.486192763f, 0.340991646f},
-std::array<float,2>{0.0165378004f, 0.689428687f},
-std::array<float,2>{0.525256872f, 0.0747458562f},
-std::array<float,2>{0.826704025f, 0.539342165f},
-std::array<float,2>{0.383520782f, 0.231717855f},
-std::array<float,2>{0.0756981447f, 0.850933075f},
-std::array<float,2>{0.588076711f, 0.469252229f},
-std::array<float,2>{0.690990269f, 0.987837732f},
-std::array<float,2>{0.177344069f, 0.308974385f},
-std::array<float,2>{0.328167111f, 0.684424758f},
-std::array<float,2>{0.875595093f, 0.0136013022f},
-std::array<float,2>{0.557814896f, 0.72907865f},
-std::array<float,2>{0.0547887981f, 0.0968106985f},
-std::array<float,2>{0.455392003f, 0.934246659f},
-std::array<float,2>{0.800189018f, 0.361608416f},
-std::array<float,2>{0.963611543f, 0.768984735f},
-std::array<float,2>{0.306986928f, 0.408508301f},
-std::array<float,2>{0.249419749f, 0.583326221f},
-std::array<float,2>{0.642073333f, 0.154650286f},
-std::array<float,2>{0.999834478f, 0.563324034f},
-std::array<float,2>{0.265765697f, 0.135066703f},
-std::array<float,2>{0.208976224f, 0.762517095f},
-std::array<float,2>{0.673687696f, 0.43272832f},
-std::array<float,2>{0.513046741f, 0.920427084f},
-std::array<float,2>{0.0133675914f, 0.352956265f},
-std::array<float,2>{0.472631723f, 0.735983551f},
-std::array<float,2>{0.767002225f, 0.116180718f},
-std::array<float,2>{0.725373805f, 0.660618544f},
-std::array<float,2>{0.125609413f, 0.0223880187f},
-std::array<float,2>{0.352679014f, 0.982519984f},
-std::array<float,2>{0.910136402f, 0.290074408f},
-std::array<float,2>{0.874973893f, 0.869709313f},
-std::array<float,2>{0.427151769f, 0.485918969f},
-std::array<float,2>{0.0961136296f, 0.551643312f},
-std::array<float,2>{0.613401294f, 0.248583987f},
-std::array<float,2>{0.785635948f, 0.71024555f},
-std::array<float,2>{0.440628916f, 0.0849783942f},
-std::array<float,2>{0.0346151553f, 0.903627038f},
-std::array<float,2>{0.546132684f, 0.319188029f},
-std::array<float,2>{0.631002486f, 0.794407725f},
-std::array<float,2>{0.227081805f, 0.377693504f},
-std::array<float,2>{0.284518868f, 0.621173859f},
-std::array<float,2>{0.94519043f, 0.163764536f},
-std::array<float,2>{0.568607926f, 0.50880307f},
-std::array<float,2>{0.081706807f, 0.212840244f},
-std::array<float,2>{0.405344784f, 0.840606689f},
-std::array<float,2>{0.841500401f, 0.451189399f},
-std::array<float,2>{0.903430521f, 0.96317935f},
-std::array<float,2>{0.326342046f, 0.259920388f},
-std::array<float,2>{0.170566186f, 0.637972713f},
-std::array<float,2>{0.714728177f, 0.0382008925f},
-std::array<float,2>{0.995072663f, 0.643499076f},
-std::array<float,2>{0.272505403f, 0.0563817807f},
-std::array<float,2>{0.205071613f, 0.940159917f},
-std::array<float,2>{0.67764318f, 0.280079305f},
-std::array<float,2>{0.510253906f, 0.820181966f},
-std::array<float,2>{0.0110237105f, 0.468520522f},
-std::array<float,2>{0.472990781f, 0.523791313f},
-std::array<float,2>{0.770711303f, 0.191399753f},
-std::array<float,2>{0.722486496f, 0.600602031f},
-std::array<float,2>{0.129703492f, 0.185968474f},
-std::array<float,2>{0.355903357f, 0.8051126f},
-std::array<float,2>{0.910379887f, 0.393642843f},
-std::array<float,2>{0.87004292f, 0.875833035f},
-std::array<float,2>{0.423421353f, 0.329329044f},
-std::array<float,2>{0.0993415937f, 0.699868798f},
-std::array<float,2>{0.610443771f, 0.0699446946f},
-std::array<float,2>{0.782558382f, 0.533177257f},
-std::array<float,2>{0.44237259f, 0.223991603f},
-std::array<float,2>{0.0358701311f, 0.856800973f},
-std::array<float,2>{0.540271521f, 0.477399886f},
-std::array<float,2>{0.628388882f, 0.997728825f},
-std::array<float,2>{0.234276444f, 0.29991287f},
-std::array<float,2>{0.288737595f, 0.673153162f},
-std::array<float,2>{0.940245986f, 0.00375852641f},
-std::array<float,2>{0.565087199f, 0.723517656f},
-std::array<float,2>{0.0856368169f, 0.108675316f},
-std::array<float,2>{0.40130949f, 0.922896862f},
-std::array<float,2>{0.837678015f, 0.372058004f},
-std::array<float,2>{0.899640799f, 0.77991277f},
-std::array<float,2>{0.323029816f, 0.418940991f},
-std::array<float,2>{0.166554198f, 0.59322083f},
-std::array<float,2>{0.71539247f, 0.144194007f},
-std::array<float,2>{0.928315699f, 0.576909721f},
-std::array<float,2>{0.359892994f, 0.125937879f},
-std::array<float,2>{0.143554628f, 0.753941178f},
-std::array<float,2>{0.740808129f, 0.427970469f},
-std::array<float,2>{0.604565024f, 0.911319256f},
-std::array<float,2>{0.121930487f, 0.35088706f},
-std::array<float,2>{0.408922136f, 0.74557966f},
-std::array<float,2>{0.85590297f, 0.12092413f},
-std::array<float,2>{0.659277618f, 0.668869257f},
-std::array<float,2>{0.1961734f, 0.0294181202f},
-std::array<float,2>{0.253696203f, 0.970620573f},
-std::array<float,2>{0.974294245f, 0.288239807f},
-std::array<float,2>{0.758558035f, 0.859909892f},
-std::array<float,2>{0.492122561f, 0.497624189f},
-std::array<float,2>{0.0212863535f, 0.559373558f},
-std::array<float,2>{0.528819978f, 0.238214627f},
-std::array<float,2>{0.820474148f, 0.717571259f},
-std::array<float,2>{0.38926658f, 0.090773508f},
-std::array<float,2>{0.0734455064f, 0.893685341f},
-std::array<float,2>{0.589981973f, 0.327159256f},
-std::array<float,2>{0.692628801f, 0.784411907f},
-std::array<float,2>{0.175327495f, 0.387496799f},
-std::array<float,2>{0.332819194f, 0.615362644f},
-std::array<float,2>{0.880731523f, 0.166643202f},
-std::array<float,2>{0.560092866f, 0.50341773f},
-std::array<float,2>{0.0603619143f, 0.203881264f},
-std::array<float,2>{0.457603127f, 0.831990302f},
-std::array<float,2>{0.801069736f, 0.440149367f},
-std::array<float,2>{0.964936495f, 0.95446521f},
-std::array<float,2>{0.310888946f, 0.254987746f},
-std::array<float,2>{0.244581267f, 0.625636697f},
-std::array<float,2>{0.647721589f, 0.0391727686f},
-std::array<float,2>{0.885589719f, 0.739779174f},
-std::array<float,2>{0.337278932f, 0.112756632f},
-std::array<float,2>{0.182506338f, 0.915681899f},
-std::array<float,2>{0.700472713f, 0.356654793f},
-std::array<float,2>{0.585761666f, 0.760097325f},
-std::array<float,2>{0.0701437816f, 0.43634966f},
-std::array<float,2>{0.375676841f, 0.569022536f},
-std::array<float,2>{0.814536512f, 0.137152791f},
-std::array<float,2>{0.652338207f, 0.547086537f},
-std::array<float,2>{0.240863174f, 0.245577484f},
-std::array<float,2>{0.301428318f, 0.874142945f},
-std::array<float,2>{0.956854761f, 0.491008371f},
-std::array<float,2>{0.812085509f, 0.978389859f},
-std::array<float,2>{0.461850762f, 0.294367999f},
-std::array<float,2>{0.0504057407f, 0.657224357f},
-std::array<float,2>{0.551270962f, 0.0184691008f},
-std::array<float,2>{0.850309849f, 0.618076622f},
-std::array<float,2>{0.420729429f, 0.157610416f},
-std::array<float,2>{0.114988618f, 0.790368021f},
-std::array<float,2>{0.601082504f, 0.380993992f},
-std::array<float,2>{0.744107783f, 0.902143002f},
-std::array<float,2>{0.149208918f, 0.313096583f},
-std::array<float,2>{0.371948689f, 0.704341352f},
-std::array<float,2>{0.933107138f, 0.0781537741f},
-std::array<float,2>{0.521356523f, 0.63397032f},
-std::array<float,2>{0.0239690039f, 0.0316525288f},
-std::array<float,2>{0.497588903f, 0.967763364f},
-std::array<float,2>{0.750437319f, 0.261930853f},
-std::array<float,2>{0.9832865f, 0.8372612f},
-std::array<float,2>{0.261277467f, 0.446852118f},
-std::array<float,2>{0.190753505f, 0.515045702f},
-std::array<float,2>{0.665984094f, 0.216894239f},
-std::array<float,2>{0.950999498f, 0.519320846f},
-std::array<float,2>{0.289149016f, 0.200640783f},
-std::array<float,2>{0.221040279f, 0.82103157f},
-std::array<float,2>{0.63643676f, 0.460272938f},
-std::array<float,2>{0.534994602f, 0.946139038f},
-std::array<float,2>{0.0461814329f, 0.265934765f},
-std::array<float,2>{0.44747296f, 0.648789823f},
-std::array<float,2>{0.794234872f, 0.0514138937f},
-std::array<float,2>{0.709278524f, 0.695019901f},
-std::array<float,2>{0.160279438f, 0.07410945f},
-std::array<float,2>{0.31260553f, 0.885237336f},
-std::array<float,2>{0.894126296f, 0.338317156f},
-std::array<float,2>{0.829772234f, 0.803919137f},
-std::array<float,2>{0.396557957f, 0.405234516f},
-std::array<float,2>{0.0936761796f, 0.604989588f},
-std::array<float,2>{0.576029897f, 0.172970414f},
-std::array<float,2>{0.778366089f, 0.68135041f},
-std::array<float,2>{0.476957887f, 0.00935066864f},
-std::array<float,2>{0.00309418887f, 0.988907218f},
-std::array<float,2>{0.501844466f, 0.305415452f},
-std::array<float,2>{0.682157159f, 0.845648885f},
-std::array<float,2>{0.213931859f, 0.472876221f},
-std::array<float,2>{0.279592097f, 0.544797361f},
-std::array<float,2>{0.987834394f, 0.228498966f},
-std::array<float,2>{0.622307837f, 0.579955518f},
-std::array<float,2>{0.103104115f, 0.150501937f},
-std::array<float,2>{0.434374541f, 0.771160841f},
-std::array<float,2>{0.86439538f, 0.41348204f},
-std::array<float,2>{0.92144233f, 0.932414114f},
-std::array<float,2>{0.344070941f, 0.367143661f},
-std::array<float,2>{0.137424514f, 0.730527401f},
-std::array<float,2>{0.732500792f, 0.0998286754f},
-std::array<float,2>{0.959110916f, 0.696234405f},
-std::array<float,2>{0.297172427f, 0.0640083328f},
-std::array<float,2>{0.235554755f, 0.880749941f},
-std::array<float,2>{0.65332669f, 0.332262486f},
-std::array<float,2>{0.548731863f, 0.81066364f},
-std::array<float,2>{0.0533009581f, 0.398226798f},
-std::array<float,2>{0.467177331f, 0.595305681f},
-std::array<float,2>{0.805855095f, 0.179806024f},
-std::array<float,2>{0.69656539f, 0.529757619f},
-std::array<float,2>{0.18748498f, 0.193654433f},
-std::array<float,2>{0.34066543f, 0.814281166f},
-std::array<float,2>{0.888849676f, 0.464223206f},
-std::array<float,2>{0.818839073f, 0.945203006f},
-std::array<float,2>{0.378980428f, 0.276687622f},
-std::array<float,2>{0.0651559904f, 0.64453578f},
-std::array<float,2>{0.580870032f, 0.0624066629f},
-std::array<float,2>{0.757743955f, 0.589340508f},
-std::array<float,2>{0.495628476f, 0.145940125f},
-std::array<float,2>{0.0276613683f, 0.775429249f},
-std::array<float,2>{0.518959641f, 0.417830795f},
-std::array<float,2>{0.669564188f, 0.926965773f},
-std::array<float,2>{0.192695841f, 0.370226264f},
-std::array<float,2>{0.26352337f, 0.719530761f},
-std::array<float,2>{0.977605045f, 0.102186248f},
-std::array<float,2>{0.595443189f, 0.679457903f},
-std::array<float,2>{0.110033996f, 0.00720997853f},
-std::array<float,2>{0.416186064f, 0.99338603f},
-std::array<float,2>{0.845564485f, 0.303090423f},
-std::array<float,2>{0.935450375f, 0.851632953f},
-std::array<float,2>{0.370974362f, 0.484027058f},
-std::array<float,2>{0.153205574f, 0.538643718f},
-std::array<float,2>{0.747199118f, 0.220261738f},
-std::array<float,2>{0.896357715f, 0.557482004f},
-std::array<float,2>{0.318013996f, 0.238362774f},
-std::array<float,2>{0.159707665f, 0.863686919f},
-std::array<float,2>{0.706253052f, 0.4941338f},
-std::array<float,2>{0.57117784f, 0.973070443f},
-std::array<float,2>{0.0864887983f, 0.284273893f},
-std::array<float,2>{0.392266035f, 0.66767025f},
-std::array<float,2>{0.835275114f, 0.0235108621f},
-std::array<float,2>{0.640612543f, 0.74650389f},
-std::array<float,2>{0.22627151f, 0.12162409f},
-std::array<float,2>{0.295794368f, 0.906929135f},
-std::array<float,2>{0.948351324f, 0.346273392f},
-std::array<float,2>{0.790030658f, 0.753568351f},
-std::array<float,2>{0.4517214f, 0.423622936f},
-std::array<float,2>{0.0423874818f, 0.571907163f},
-std::array<float,2>{0.53610158f, 0.130606174f},
-std::array<float,2>{0.862686872f, 0.631840527f},
-std::array<float,2>{0.432642043f, 0.0431974679f},
-std::array<float,2>{0.106333278f, 0.960213065f},
-std::array<float,2>{0.62037015f, 0.253555715f},
-std::array<float,2>{0.729608119f, 0.83408457f},
-std::array<float,2>{0.134881258f, 0.442240745f},
-std::array<float,2>{0.350875407f, 0.50412637f},
-std::array<float,2>{0.914327681f, 0.20815292f},
-std::array<float,2>{0.505536616f, 0.611777842f},
-std::array<float,2>{0.00602936512f, 0.168545812f},
-std::array<float,2>{0.482628465f, 0.787200332f},
-std::array<float,2>{0.776688695f, 0.386430115f},
-std::array<float,2>{0.988532901f, 0.896560431f},
-std::array<float,2>{0.276437253f, 0.320813924f},
-std::array<float,2>{0.217359036f, 0.713008165f},
-std::array<float,2>{0.687297583f, 0.0878193974f},
-std::array<float,2>{0.908798575f, 0.66249305f},
-std::array<float,2>{0.351622343f, 0.0209003314f},
-std::array<float,2>{0.126942798f, 0.981933892f},
-std::array<float,2>{0.725862563f, 0.29110685f},
-std::array<float,2>{0.614876151f, 0.868846774f},
-std::array<float,2>{0.0969105586f, 0.487637222f},
-std::array<float,2>{0.426566601f, 0.554638207f},
-std::array<float,2>{0.873231232f, 0.246174127f},
-std::array<float,2>{0.672053993f, 0.56503278f},
-std::array<float,2>{0.207487091f, 0.132974952f},
-std::array<float,2>{0.267052889f, 0.76406467f},
-std::array<float,2>{0.998811901f, 0.430016875f},
-std::array<float,2>{0.766096175f, 0.918168545f},
-std::array<float,2>{0.471112877f, 0.355332643f},
-std::array<float,2>{0.011926719f, 0.737778962f},
-std::array<float,2>{0.511745751f, 0.114933327f},
-std::array<float,2>{0.84060365f, 0.510144889f},
-std::array<float,2>{0.404361874f, 0.213059306f},
-std::array<float,2>{0.0802335888f, 0.843596935f},
-std::array<float,2>{0.570142925f, 0.449754924f},
-std::array<float,2>{0.713616788f, 0.962090909f},
-std::array<float,2>{0.171559453f, 0.257828593f},
-std::array<float,2>{0.3271797f, 0.639655173f},
-std::array<float,2>{0.902507305f, 0.0353552736f},
-std::array<float,2>{0.545806289f, 0.708921969f},
-std::array<float,2>{0.0337203294f, 0.0823717266f},
-std::array<float,2>{0.439675152f, 0.905936658f},
-std::array<float,2>{0.787044883f, 0.317730397f},
-std::array<float,2>{0.943694353f, 0.795437753f},
-std::array<float,2>{0.283366263f, 0.375875086f},
-std::array<float,2>{0.228102908f, 0.62346375f},
-std::array<float,2>{0.632270277f, 0.161918789f},
-std::array<float,2>{0.969480455f, 0.607441306f},
-std::array<float,2>{0.253987759f, 0.17767711f},
-std::array<float,2>{0.199709803f, 0.799466968f},
-std::array<float,2>{0.663892448f, 0.402196318f},
-std::array<float,2>{0.523960412f, 0.886776865f},
-std::array<float,2>{0.0167029537f, 0.342984259f},
-std::array<float,2>{0.485198826f, 0.691099644f},
-std::array<float,2>{0.762662053f, 0.0767351314f},
-std::array<float,2>{0.734528482f, 0.654451489f},
-std::array<float,2>{0.146004558f, 0.0477689393f},
-std::array<float,2>{0.36355117f, 0.94975549f},
-std::array<float,2>{0.923289418f, 0.27110222f},
-std::array<float,2>{0.853201091f, 0.826345026f},
-std::array<float,2>{0.410177171f, 0.454011321f},
-std::array<float,2>{0.120828658f, 0.523294926f},
-std::array<float,2>{0.607865036f, 0.19737938f},
-std::array<float,2>{0.799592257f, 0.727671087f},
-std::array<float,2>{0.456593245f, 0.0950257331f},
-std::array<float,2>{0.056425523f, 0.936356246f},
-std::array<float,2>{0.557589829f, 0.360674053f},
-std::array<float,2>{0.640837014f, 0.765759289f},
-std::array<float,2>{0.248819441f, 0.407440603f},
-std::array<float,2>{0.307824701f, 0.585408092f},
-std::array<float,2>{0.964297175f, 0.152966678f},
-std::array<float,2>{0.589014828f, 0.54258126f},
-std::array<float,2>{0.0747312382f, 0.233503684f},
-std::array<float,2>{0.384327859f, 0.848234355f},
-std::array<float,2>{0.82761848f, 0.472173363f},
-std::array<float,2>{0.876722038f, 0.984856963f},
-std::array<float,2>{0.330034852f, 0.310939103f},
-std::array<float,2>{0.175790727f, 0.685618997f},
-std::array<float,2>{0.690128326f, 0.0143675376f},
-std::array<float,2>{0.938960493f, 0.674558818f},
-std::array<float,2>{0.285657525f, 0.00178627344f},
-std::array<float,2>{0.230935663f, 0.999503434f},
-std::array<float,2>{0.626801372f, 0.297071934f},
-std::array<float,2>{0.541518509f, 0.85755229f},
-std::array<float,2>{0.038699571f, 0.48007524f},
-std::array<float,2>{0.443637758f, 0.533837318f},
-std::array<float,2>{0.784295619f, 0.226550281f},
-std::array<float,2>{0.718670011f, 0.590309024f},
-std::array<float,2>{0.16420719f, 0.141448587f},
-std::array<float,2>{0.321665943f, 0.778280199f},
-std::array<float,2>{0.901340425f, 0.420458585f},
-std::array<float,2>{0.839236259f, 0.924564064f},
-std::array<float,2>{0.400272608f, 0.373602033f},
-std::array<float,2>{0.0835872367f, 0.725004554f},
-std::array<float,2>{0.563869953f, 0.105795234f},
-std::array<float,2>{0.773239255f, 0.525917411f},
-std::array<float,2>{0.476535678f, 0.187573105f},
-std::array<float,2>{0.00934808329f, 0.817635357f},
-std::array<float,2>{0.508496523f, 0.466000915f},
-std::array<float,2>{0.677821934f, 0.937849879f},
-std::array<float,2>{0.206098989f, 0.277662516f},
-std::array<float,2>{0.270649731f, 0.640750647f},
-std::array<float,2>{0.992697895f, 0.0570954606f},
-std::array<float,2>{0.613107681f, 0.702513099f},
-std::array<float,2>{0.0996828973f, 0.0675959438f},
-std::array<float,2>{0.424242824f, 0.878885984f},
-std::array<float,2>{0.868820786f, 0.331274688f},
-std::array<float,2>{0.913904727f, 0.808499575f},
-std::array<float,2>{0.357485831f, 0.390892923f},
-std::array<float,2>{0.131529734f, 0.599556267f},
-std::array<float,2>{0.719153404f, 0.185068876f},
-std::array<float,2>{0.88105315f, 0.614550829f},
-std::array<float,2>{0.335314721f, 0.164190546f},
-std::array<float,2>{0.172541156f, 0.782438338f},
-std::array<float,2>{0.694128096f, 0.389656484f},
-std::array<float,2>{0.592064857f, 0.891329527f},
-std::array<float,2>{0.0714204684f, 0.325423747f},
-std::array<float,2>{0.388192892f, 0.715122581f},
-std::array<float,2>{0.822284043f, 0.0925485417f},
-std::array<float,2>{0.646167099f, 0.627102435f},
-std::array<float,2>{0.242765352f, 0.0419467986f},
-std::array<float,2>{0.309876323f, 0.95621419f},
-std::array<float,2>{0.966861904f, 0.256156743f},
-std::array<float,2>{0.804181516f, 0.828956544f},
-std::array<float,2>{0.460510135f, 0.438231051f},
-std::array<float,2>{0.0618370064f, 0.501595378f},
-std::array<float,2>{0.561387539f, 0.206480414f},
-std::array<float,2>{0.857999921f, 0.742690384f},
-std::array<float,2>{0.406311929f, 0.117504507f},
-std::array<float,2>{0.124204122f, 0.912410438f},
-std::array<float,2>{0.602658808f, 0.348975807f},
-std::array<float,2>{0.739574134f, 0.757233799f},
-std::array<float,2>{0.142481863f, 0.427081496f},
-std::array<float,2>{0.361698806f, 0.575725317f},
-std::array<float,2>{0.92714566f, 0.128424034f},
-std::array<float,2>{0.529945076f, 0.561332881f},
-std::array<float,2>{0.0217671134f, 0.235611096f},
-std::array<float,2>{0.48902148f, 0.861956894f},
-std::array<float,2>{0.760975897f, 0.498877943f},
-std::array<float,2>{0.9747895f, 0.9716416f},
-std::array<float,2>{0.250598907f, 0.285547674f},
-std::array<float,2>{0.198494494f, 0.670391023f},
-std::array<float,2>{0.657196701f, 0.0290769134f},
-std::array<float,2>{0.930660784f, 0.706598043f},
-std::array<float,2>{0.3739824f, 0.0808373243f},
-std::array<float,2>{0.150984153f, 0.898646295f},
-std::array<float,2>{0.74569279f, 0.314516842f},
-std::array<float,2>{0.59924072f, 0.791867077f},
-std::array<float,2>{0.115646921f, 0.380431801f},
-std::array<float,2>{0.418205976f, 0.620560765f},
-std::array<float,2>{0.849221528f, 0.159796402f},
-std::array<float,2>{0.667039752f, 0.513528049f},
-std::array<float,2>{0.187872708f, 0.215742275f},
-std::array<float,2>{0.259606689f, 0.838823855f},
-std::array<float,2>{0.98087877f, 0.448994666f},
-std::array<float,2>{0.752261221f, 0.965401709f},
-std::array<float,2>{0.498821557f, 0.264391661f},
-std::array<float,2>{0.0271667913f, 0.636396408f},
-std::array<float,2>{0.522132456f, 0.0333947428f},
-std::array<float,2>{0.814174414f, 0.566819727f},
-std::array<float,2>{0.377701223f, 0.140490994f},
-std::array<float,2>{0.0672766715f, 0.759282291f},
-std::array<float,2>{0.582275689f, 0.434567153f},
-std::array<float,2>{0.701560676f, 0.917622209f},
-std::array<float,2>{0.180929154f, 0.358821005f},
-std::array<float,2>{0.338296294f, 0.740719259f},
-std::array<float,2>{0.883997679f, 0.1094089f},
-std::array<float,2>{0.554157138f, 0.660068035f},
-std::array<float,2>{0.0485235527f, 0.0172774699f},
-std::array<float,2>{0.463034093f, 0.980216086f},
-std::array<float,2>{0.809480369f, 0.295804322f},
-std::array<float,2>{0.954620302f, 0.87247932f},
-std::array<float,2>{0.30345723f, 0.489988565f},
-std::array<float,2>{0.23831524f, 0.549187481f},
-std::array<float,2>{0.648921967f, 0.243369937f},
-std::array<float,2>{0.985862076f, 0.545612872f},
-std::array<float,2>{0.279125273f, 0.228721797f},
-std::array<float,2>{0.211259812f, 0.846258163f},
-std::array<float,2>{0.680304825f, 0.475024164f},
-std::array<float,2>{0.503653884f, 0.990726531f},
-std::array<float,2>{0.000205762f, 0.30736196f},
-std::array<float,2>{0.479949445f, 0.68249011f},
-std::array<float,2>{0.779616416f, 0.0104290443f},
-std::array<float,2>{0.730495691f, 0.732807338f},
-std::array<float,2>{0.139980122f, 0.0978105441f},
-std::array<float,2>{0.34733358f, 0.930650949f},
-std::array<float,2>{0.918295145f, 0.36444205f},
-std::array<float,2>{0.865675807f, 0.772669673f},
-std::array<float,2>{0.436281323f, 0.410556793f},
-std::array<float,2>{0.103627726f, 0.580264926f},
-std::array<float,2>{0.624466062f, 0.150334135f},
-std::array<float,2>{0.79664731f, 0.650959551f},
-std::array<float,2>{0.446962506f, 0.0546811186f},
-std::array<float,2>{0.0444244407f, 0.947874308f},
-std::array<float,2>{0.531274736f, 0.268529981f},
-std::array<float,2>{0.634023905f, 0.822970033f},
-std::array<float,2>{0.220658302f, 0.458260059f},
-std::array<float,2>{0.292124271f, 0.51705718f},
-std::array<float,2>{0.951509237f, 0.201638699f},
-std::array<float,2>{0.57729882f, 0.601626813f},
-std::array<float,2>{0.0902351514f, 0.175369322f},
-std::array<float,2>{0.395353079f, 0.801557362f},
-std::array<float,2>{0.830878735f, 0.403042495f},
-std::array<float,2>{0.892006874f, 0.884657562f},
-std::array<float,2>{0.315514058f, 0.33668679f},
-std::array<float,2>{0.162743941f, 0.691440523f},
-std::array<float,2>{0.708404183f, 0.0705586001f},
-std::array<float,2>{0.979960978f, 0.722412467f},
-std::array<float,2>{0.265569001f, 0.10447035f},
-std::array<float,2>{0.193553731f, 0.928671241f},
-std::array<float,2>{0.671803415f, 0.367547929f},
-std::array<float,2>{0.516307235f, 0.773845315f},
-std::array<float,2>{0.0301303864f, 0.415660441f},
-std::array<float,2>{0.493718803f, 0.586673975f},
-std::array<float,2>{0.754415572f, 0.147541955f},
-std::array<float,2>{0.748235643f, 0.535675645f},
-std::array<float,2>{0.155192643f, 0.222071439f},
-std::array<float,2>{0.368623376f, 0.855407476f},
-std::array<float,2>{0.935910583f, 0.481938064f},
-std::array<float,2>{0.847563744f, 0.995202303f},
-std::array<float,2>{0.415008664f, 0.301751852f},
-std::array<float,2>{0.111582369f, 0.67595762f},
-std::array<float,2>{0.596549213f, 0.00391373178f},
-std::array<float,2>{0.807557821f, 0.596851647f},
-std::array<float,2>{0.465448439f, 0.182706788f},
-std::array<float,2>{0.0510731898f, 0.80994457f},
-std::array<float,2>{0.549030602f, 0.395103961f},
-std::array<float,2>{0.655720174f, 0.880967259f},
-std::array<float,2>{0.236900806f, 0.335739732f},
-std::array<float,2>{0.29998973f, 0.697859466f},
-std::array<float,2>{0.957161248f, 0.0663674474f},
-std::array<float,2>{0.579494059f, 0.64775753f},
-std::array<float,2>{0.0632845238f, 0.0597009063f},
-std::array<float,2>{0.381637126f, 0.94249481f},
-std::array<float,2>{0.817457616f, 0.274631619f},
-std::array<float,2>{0.887759149f, 0.815516174f},
-std::array<float,2>{0.34326002f, 0.462335587f},
-std::array<float,2>{0.184055284f, 0.528089762f},
-std::array<float,2>{0.698965669f, 0.19151561f},
-std::array<float,2>{0.916466296f, 0.506861389f},
-std::array<float,2>{0.348539799f, 0.20983614f},
-std::array<float,2>{0.133570477f, 0.833873332f},
-std::array<float,2>{0.726922572f, 0.445293546f},
-std::array<float,2>{0.61736393f, 0.957441747f},
-std::array<float,2>{0.107591651f, 0.250765562f},
-std::array<float,2>{0.43072322f, 0.628983557f},
-std::array<float,2>{0.860624552f, 0.0454855375f},
-std::array<float,2>{0.684024036f, 0.712819099f},
-std::array<float,2>{0.215390846f, 0.0880895928f},
-std::array<float,2>{0.274856389f, 0.89545387f},
-std::array<float,2>{0.991720021f, 0.323690712f},
-std::array<float,2>{0.775385618f, 0.786407053f},
-std::array<float,2>{0.48197037f, 0.38318187f},
-std::array<float,2>{0.00541565241f, 0.609620512f},
-std::array<float,2>{0.506602585f, 0.171204761f},
-std::array<float,2>{0.833582163f, 0.664803386f},
-std::array<float,2>{0.392582536f, 0.0273379721f},
-std::array<float,2>{0.0886692107f, 0.97589618f},
-std::array<float,2>{0.57264781f, 0.282299727f},
-std::array<float,2>{0.703780413f, 0.867135525f},
-std::array<float,2>{0.157463863f, 0.494225979f},
-std::array<float,2>{0.319449395f, 0.555589676f},
-std::array<float,2>{0.897297502f, 0.241441935f},
-std::array<float,2>{0.537273586f, 0.574121952f},
-std::array<float,2>{0.039535448f, 0.132296875f},
-std::array<float,2>{0.450764716f, 0.751076937f},
-std::array<float,2>{0.792132258f, 0.425769478f},
-std::array<float,2>{0.947260857f, 0.909721673f},
-std::array<float,2>{0.293551296f, 0.345508009f},
-std::array<float,2>{0.223710015f, 0.748656273f},
-std::array<float,2>{0.638490736f, 0.123726174f},
-std::array<float,2>{0.904484212f, 0.636986792f},
-std::array<float,2>{0.326152325f, 0.0373072773f},
-std::array<float,2>{0.168470249f, 0.964016318f},
-std::array<float,2>{0.711230218f, 0.26138708f},
-std::array<float,2>{0.567983925f, 0.840825438f},
-std::array<float,2>{0.0796289891f, 0.45242843f},
-std::array<float,2>{0.403522849f, 0.508606374f},
-std::array<float,2>{0.841836631f, 0.211039767f},
-std::array<float,2>{0.62985003f, 0.622463405f},
-std::array<float,2>{0.22915104f, 0.162974462f},
-std::array<float,2>{0.282174826f, 0.793041229f},
-std::array<float,2>{0.942455828f, 0.37842235f},
-std::array<float,2>{0.787642181f, 0.902368069f},
-std::array<float,2>{0.438217878f, 0.319394797f},
-std::array<float,2>{0.0316419303f, 0.709559083f},
-std::array<float,2>{0.543158174f, 0.084669061f},
-std::array<float,2>{0.871136844f, 0.552655458f},
-std::array<float,2>{0.429477215f, 0.249744773f},
-std::array<float,2>{0.0950683653f, 0.87059319f},
-std::array<float,2>{0.615627944f, 0.484387308f},
-std::array<float,2>{0.723092496f, 0.983517468f},
-std::array<float,2>{0.128192931f, 0.289990991f},
-std::array<float,2>{0.354441613f, 0.661190152f},
-std::array<float,2>{0.90700531f, 0.0233398061f},
-std::array<float,2>{0.513734102f, 0.734924257f},
-std::array<float,2>{0.0141662424f, 0.116279781f},
-std::array<float,2>{0.469083488f, 0.921521366f},
-std::array<float,2>{0.767609f, 0.352240503f},
-std::array<float,2>{0.996408761f, 0.763480544f},
-std::array<float,2>{0.268319428f, 0.431931466f},
-std::array<float,2>{0.209764481f, 0.563595831f},
-std::array<float,2>{0.67499578f, 0.136132017f},
-std::array<float,2>{0.962097406f, 0.582363546f},
-std::array<float,2>{0.304980367f, 0.155653104f},
-std::array<float,2>{0.247147709f, 0.767964602f},
-std::array<float,2>{0.643042028f, 0.409489572f},
-std::array<float,2>{0.556164384f, 0.934615731f},
-std::array<float,2>{0.0577585883f, 0.363101691f},
-std::array<float,2>{0.454827666f, 0.730100691f},
-std::array<float,2>{0.79687953f, 0.0961368158f},
-std::array<float,2>{0.687991738f, 0.684800208f},
-std::array<float,2>{0.178920716f, 0.0119995559f},
-std::array<float,2>{0.33168745f, 0.987120628f},
-std::array<float,2>{0.878382444f, 0.309678525f},
-std::array<float,2>{0.824446917f, 0.849858701f},
-std::array<float,2>{0.385139883f, 0.470295489f},
-std::array<float,2>{0.0766116604f, 0.54044795f},
-std::array<float,2>{0.586402655f, 0.231342137f},
-std::array<float,2>{0.764496624f, 0.688469768f},
-std::array<float,2>{0.488145441f, 0.0756974444f},
-std::array<float,2>{0.0183625221f, 0.888888717f},
-std::array<float,2>{0.52600491f, 0.340144008f},
-std::array<float,2>{0.660581291f, 0.797715843f},
-std::array<float,2>{0.201287583f, 0.398746699f},
-std::array<float,2>{0.256229699f, 0.605822682f},
-std::array<float,2>{0.971381664f, 0.179566756f},
-std::array<float,2>{0.605582237f, 0.520415485f},
-std::array<float,2>{0.118503951f, 0.196358472f},
-std::array<float,2>{0.413828969f, 0.825296104f},
-std::array<float,2>{0.854480028f, 0.456766516f},
-std::array<float,2>{0.925505936f, 0.952357709f},
-std::array<float,2>{0.366351992f, 0.273059726f},
-std::array<float,2>{0.1482099f, 0.652825475f},
-std::array<float,2>{0.736662984f, 0.0495650284f},
-std::array<float,2>{0.958656669f, 0.644859552f},
-std::array<float,2>{0.299692869f, 0.0621136688f},
-std::array<float,2>{0.237641558f, 0.944988728f},
-std::array<float,2>{0.655221164f, 0.276395053f},
-std::array<float,2>{0.550395787f, 0.814191699f},
-std::array<float,2>{0.052395504f, 0.46410647f},
-std::array<float,2>{0.466083825f, 0.529524744f},
-std::array<float,2>{0.808499217f, 0.193571821f},
-std::array<float,2>{0.697668195f, 0.595462441f},
-std::array<float,2>{0.184643105f, 0.180148542f},
-std::array<float,2>{0.341851175f, 0.811001658f},
-std::array<float,2>{0.887295365f, 0.398008823f},
-std::array<float,2>{0.816907167f, 0.880434394f},
-std::array<float,2>{0.382495135f, 0.332434118f},
-std::array<float,2>{0.0636727363f, 0.695811987f},
-std::array<float,2>{0.578928292f, 0.0642628223f},
-std::array<float,2>{0.755152702f, 0.538921237f},
-std::array<float,2>{0.492787421f, 0.2205154f},
-std::array<float,2>{0.0306094699f, 0.851905107f},
-std::array<float,2>{0.517255366f, 0.48431173f},
-std::array<float,2>{0.670890272f, 0.993498147f},
-std::array<float,2>{0.194505513f, 0.302799195f},
-std::array<float,2>{0.264245063f, 0.679258406f},
-std::array<float,2>{0.97913605f, 0.00689471047f},
-std::array<float,2>{0.597232103f, 0.719312966f},
-std::array<float,2>{0.112332754f, 0.102360614f},
-std::array<float,2>{0.415831506f, 0.927239656f},
-std::array<float,2>{0.846307755f, 0.370455712f},
-std::array<float,2>{0.937091947f, 0.775797427f},
-std::array<float,2>{0.367830962f, 0.417522281f},
-std::array<float,2>{0.156214952f, 0.589061081f},
-std::array<float,2>{0.749104202f, 0.145711288f},
-std::array<float,2>{0.897819281f, 0.572242081f},
-std::array<float,2>{0.318434745f, 0.13083972f},
-std::array<float,2>{0.156436458f, 0.753769338f},
-std::array<float,2>{0.70424372f, 0.423439533f},
-std::array<float,2>{0.573537469f, 0.907067418f},
-std::array<float,2>{0.0896481946f, 0.34648174f},
-std::array<float,2>{0.393722773f, 0.746146679f},
-std::array<float,2>{0.832801938f, 0.121845171f},
-std::array<float,2>{0.637184441f, 0.667915404f},
-std::array<float,2>{0.223092511f, 0.0238545965f},
-std::array<float,2>{0.293990701f, 0.972710609f},
-std::array<float,2>{0.94560039f, 0.28463468f},
-std::array<float,2>{0.791506886f, 0.863319695f},
-std::array<float,2>{0.450176656f, 0.493705362f},
-std::array<float,2>{0.0401770994f, 0.557157636f},
-std::array<float,2>{0.53851229f, 0.238647223f},
-std::array<float,2>{0.859884381f, 0.713182271f},
-std::array<float,2>{0.429823041f, 0.0875708163f},
-std::array<float,2>{0.109162383f, 0.8967309f},
-std::array<float,2>{0.61894995f, 0.321121514f},
-std::array<float,2>{0.728404522f, 0.787578821f},
-std::array<float,2>{0.134550631f, 0.386655152f},
-std::array<float,2>{0.348991871f, 0.61152488f},
-std::array<float,2>{0.917668223f, 0.168716952f},
-std::array<float,2>{0.507184625f, 0.504226267f},
-std::array<float,2>{0.0048653651f, 0.208337933f},
-std::array<float,2>{0.481341302f, 0.834275723f},
-std::array<float,2>{0.773752153f, 0.442041427f},
-std::array<float,2>{0.990570128f, 0.96009016f},
-std::array<float,2>{0.274028033f, 0.253666133f},
-std::array<float,2>{0.216089308f, 0.632155061f},
-std::array<float,2>{0.684988618f, 0.0433076695f},
-std::array<float,2>{0.907473326f, 0.737529635f},
-std::array<float,2>{0.354780346f, 0.115000963f},
-std::array<float,2>{0.127871767f, 0.9184407f},
-std::array<float,2>{0.723998666f, 0.355063289f},
-std::array<float,2>{0.617149472f, 0.763706625f},
-std::array<float,2>{0.094359681f, 0.429862201f},
-std::array<float,2>{0.428150684f, 0.565273821f},
-std::array<float,2>{0.872903407f, 0.133287847f},
-std::array<float,2>{0.674100399f, 0.554334164f},
-std::array<float,2>{0.210104778f, 0.246558055f},
-std::array<float,2>{0.269422293f, 0.868989706f},
-std::array<float,2>{0.997891665f, 0.487493038f},
-std::array<float,2>{0.76935178f, 0.982318103f},
-std::array<float,2>{0.470547915f, 0.291455388f},
-std::array<float,2>{0.0148398802f, 0.662351966f},
-std::array<float,2>{0.515262246f, 0.0205930229f},
-std::array<float,2>{0.842780769f, 0.623111367f},
-std::array<float,2>{0.402385592f, 0.161841705f},
-std::array<float,2>{0.0783037171f, 0.795841634f},
-std::array<float,2>{0.567198992f, 0.375624269f},
-std::array<float,2>{0.712181985f, 0.906083465f},
-std::array<float,2>{0.16969423f, 0.317437887f},
-std::array<float,2>{0.324385375f, 0.708653927f},
-std::array<float,2>{0.905355394f, 0.082179822f},
-std::array<float,2>{0.544478476f, 0.640133381f},
-std::array<float,2>{0.0322271399f, 0.0354068056f},
-std::array<float,2>{0.439225793f, 0.962309599f},
-std::array<float,2>{0.788852453f, 0.258226782f},
-std::array<float,2>{0.941574931f, 0.84333998f},
-std::array<float,2>{0.282825649f, 0.450002104f},
-std::array<float,2>{0.2302524f, 0.509863257f},
-std::array<float,2>{0.630109549f, 0.21333237f},
-std::array<float,2>{0.971955895f, 0.523111939f},
-std::array<float,2>{0.25718686f, 0.197678387f},
-std::array<float,2>{0.202897474f, 0.82665652f},
-std::array<float,2>{0.661333382f, 0.453732669f},
-std::array<float,2>{0.527194023f, 0.950079978f},
-std::array<float,2>{0.0194560569f, 0.271396846f},
-std::array<float,2>{0.487298906f, 0.654648662f},
-std::array<float,2>{0.76552701f, 0.0475345775f},
-std::array<float,2>{0.737715304f, 0.691176057f},
-std::array<float,2>{0.146650672f, 0.0770848915f},
-std::array<float,2>{0.365655869f, 0.887018979f},
-std::array<float,2>{0.924384594f, 0.343218058f},
-std::array<float,2>{0.854949415f, 0.799611151f},
-std::array<float,2>{0.412221342f, 0.402081609f},
-std::array<float,2>{0.117829464f, 0.607811809f},
-std::array<float,2>{0.606736064f, 0.177347317f},
-std::array<float,2>{0.798464715f, 0.685949922f},
-std::array<float,2>{0.454094201f, 0.0144977756f},
-std::array<float,2>{0.057170637f, 0.984535038f},
-std::array<float,2>{0.555594146f, 0.310554653f},
-std::array<float,2>{0.643582344f, 0.848430455f},
-std::array<float,2>{0.24624835f, 0.472472608f},
-std::array<float,2>{0.305910081f, 0.542725444f},
-std::array<float,2>{0.961309373f, 0.23372522f},
-std::array<float,2>{0.587676466f, 0.585035861f},
-std::array<float,2>{0.0772326589f, 0.153264761f},
-std::array<float,2>{0.386390477f, 0.765979528f},
-std::array<float,2>{0.825759411f, 0.407612473f},
-std::array<float,2>{0.877402127f, 0.936216772f},
-std::array<float,2>{0.330890507f, 0.360473305f},
-std::array<float,2>{0.178623945f, 0.727822602f},
-std::array<float,2>{0.688769221f, 0.0948149562f},
-std::array<float,2>{0.993933797f, 0.70000726f},
-std::array<float,2>{0.269651532f, 0.0702433437f},
-std::array<float,2>{0.205658659f, 0.875552952f},
-std::array<float,2>{0.679467976f, 0.329547346f},
-std::array<float,2>{0.509202123f, 0.804888725f},
-std::array<float,2>{0.00845106971f, 0.39388451f},
-std::array<float,2>{0.474949419f, 0.601047158f},
-std::array<float,2>{0.772094131f, 0.185557246f},
-std::array<float,2>{0.720088184f, 0.523529947f},
-std::array<float,2>{0.131934658f, 0.190992981f},
-std::array<float,2>{0.358614922f, 0.819882154f},
-std::array<float,2>{0.912450969f, 0.468303859f},
-std::array<float,2>{0.867845953f, 0.940239966f},
-std::array<float,2>{0.425101846f, 0.279953361f},
-std::array<float,2>{0.100786604f, 0.643112361f},
-std::array<float,2>{0.612107217f, 0.0564937033f},
-std::array<float,2>{0.783680081f, 0.59278363f},
-std::array<float,2>{0.444342047f, 0.144518465f},
-std::array<float,2>{0.0371501632f, 0.780098855f},
-std::array<float,2>{0.542695284f, 0.418539107f},
-std::array<float,2>{0.625008821f, 0.923191607f},
-std::array<float,2>{0.231453374f, 0.371641994f},
-std::array<float,2>{0.286306471f, 0.723259449f},
-std::array<float,2>{0.938006461f, 0.108596943f},
-std::array<float,2>{0.563315868f, 0.673060596f},
-std::array<float,2>{0.0822364762f, 0.00352239166f},
-std::array<float,2>{0.398923665f, 0.997898459f},
-std::array<float,2>{0.838375628f, 0.300089628f},
-std::array<float,2>{0.901637435f, 0.856671333f},
-std::array<float,2>{0.320699543f, 0.477244794f},
-std::array<float,2>{0.165799439f, 0.532834888f},
-std::array<float,2>{0.717424214f, 0.223680988f},
-std::array<float,2>{0.926318884f, 0.559259951f},
-std::array<float,2>{0.362844527f, 0.237925842f},
-std::array<float,2>{0.141137466f, 0.860173821f},
-std::array<float,2>{0.738889635f, 0.498013139f},
-std::array<float,2>{0.602235019f, 0.970405579f},
-std::array<float,2>{0.124014452f, 0.288488269f},
-std::array<float,2>{0.407834142f, 0.668559372f},
-std::array<float,2>{0.858625948f, 0.0295511559f},
-std::array<float,2>{0.657767355f, 0.745322168f},
-std::array<float,2>{0.197271317f, 0.120712951f},
-std::array<float,2>{0.251114547f, 0.911580384f},
-std::array<float,2>{0.976374745f, 0.350587219f},
-std::array<float,2>{0.760114372f, 0.754161835f},
-std::array<float,2>{0.489596993f, 0.428100824f},
-std::array<float,2>{0.0225470532f, 0.576755345f},
-std::array<float,2>{0.531110048f, 0.125587702f},
-std::array<float,2>{0.823698103f, 0.625915229f},
-std::array<float,2>{0.386786073f, 0.0395488366f},
-std::array<float,2>{0.0705334321f, 0.95410502f},
-std::array<float,2>{0.593187213f, 0.255316079f},
-std::array<float,2>{0.695310473f, 0.831631184f},
-std::array<float,2>{0.173025876f, 0.440283477f},
-std::array<float,2>{0.334454238f, 0.503081083f},
-std::array<float,2>{0.882667661f, 0.203695878f},
-std::array<float,2>{0.562250137f, 0.615703166f},
-std::array<float,2>{0.0610105284f, 0.166952997f},
-std::array<float,2>{0.459107786f, 0.784443259f},
-std::array<float,2>{0.803325474f, 0.387339652f},
-std::array<float,2>{0.967842638f, 0.893896878f},
-std::array<float,2>{0.309019864f, 0.327543795f},
-std::array<float,2>{0.243207023f, 0.717494547f},
-std::array<float,2>{0.645463765f, 0.0903429389f},
-std::array<float,2>{0.883400202f, 0.656894326f},
-std::array<float,2>{0.338875383f, 0.0180990901f},
-std::array<float,2>{0.179725468f, 0.978155375f},
-std::array<float,2>{0.702505469f, 0.294125468f},
-std::array<float,2>{0.583543241f, 0.874420881f},
-std::array<float,2>{0.0677414984f, 0.490829021f},
-std::array<float,2>{0.378332615f, 0.547326624f},
-std::array<float,2>{0.813200593f, 0.245151833f},
-std::array<float,2>{0.649999857f, 0.569258928f},
-std::array<float,2>{0.23929742f, 0.136838332f},
-std::array<float,2>{0.303895831f, 0.759766698f},
-std::array<float,2>{0.954064906f, 0.436186433f},
-std::array<float,2>{0.810126126f, 0.915822864f},
-std::array<float,2>{0.464751124f, 0.356743246f},
-std::array<float,2>{0.0469732545f, 0.740175188f},
-std::array<float,2>{0.553551257f, 0.112430945f},
-std::array<float,2>{0.848276973f, 0.514835358f},
-std::array<float,2>{0.419106543f, 0.217157066f},
-std::array<float,2>{0.11654973f, 0.836952686f},
-std::array<float,2>{0.597725749f, 0.447065055f},
-std::array<float,2>{0.744258881f, 0.967294276f},
-std::array<float,2>{0.151954666f, 0.262139529f},
-std::array<float,2>{0.374627888f, 0.634174347f},
-std::array<float,2>{0.931631744f, 0.0312515199f},
-std::array<float,2>{0.523062527f, 0.704576075f},
-std::array<float,2>{0.0261301994f, 0.0785398632f},
-std::array<float,2>{0.499561518f, 0.902075768f},
-std::array<float,2>{0.753397107f, 0.313377351f},
-std::array<float,2>{0.981553435f, 0.790143847f},
-std::array<float,2>{0.257946193f, 0.381258905f},
-std::array<float,2>{0.188760892f, 0.617897272f},
-std::array<float,2>{0.666960001f, 0.157366067f},
-std::array<float,2>{0.952748239f, 0.605312228f},
-std::array<float,2>{0.291606367f, 0.173291236f},
-std::array<float,2>{0.21899204f, 0.804046273f},
-std::array<float,2>{0.633257747f, 0.404851198f},
-std::array<float,2>{0.532484591f, 0.88476634f},
-std::array<float,2>{0.0438543521f, 0.338131011f},
-std::array<float,2>{0.445809543f, 0.695205569f},
-std::array<float,2>{0.795680344f, 0.0738845766f},
-std::array<float,2>{0.707492769f, 0.648636997f},
-std::array<float,2>{0.16389513f, 0.0516028367f},
-std::array<float,2>{0.315376997f, 0.946018696f},
-std::array<float,2>{0.890712202f, 0.265825063f},
-std::array<float,2>{0.831834614f, 0.821164191f},
-std::array<float,2>{0.395995289f, 0.46000281f},
-std::array<float,2>{0.0911413282f, 0.519073427f},
-std::array<float,2>{0.57708776f, 0.200201899f},
-std::array<float,2>{0.780776203f, 0.730754972f},
-std::array<float,2>{0.479275584f, 0.0998605639f},
-std::array<float,2>{0.00139817549f, 0.932259142f},
-std::array<float,2>{0.502810061f, 0.366922766f},
-std::array<float,2>{0.681477129f, 0.77135098f},
-std::array<float,2>{0.212639168f, 0.413132489f},
-std::array<float,2>{0.278062373f, 0.579810262f},
-std::array<float,2>{0.985141098f, 0.150878713f},
-std::array<float,2>{0.623668253f, 0.544438601f},
-std::array<float,2>{0.104853965f, 0.228246585f},
-std::array<float,2>{0.436683476f, 0.84529537f},
-std::array<float,2>{0.866840482f, 0.472926855f},
-std::array<float,2>{0.91947031f, 0.989112973f},
-std::array<float,2>{0.345890015f, 0.305543154f},
-std::array<float,2>{0.139482751f, 0.681587398f},
-std::array<float,2>{0.731782496f, 0.00959588587f},
-std::array<float,2>{0.976777792f, 0.676168799f},
-std::array<float,2>{0.262114316f, 0.00431947224f},
-std::array<float,2>{0.191891357f, 0.995461881f},
-std::array<float,2>{0.66810739f, 0.301464409f},
-std::array<float,2>{0.517722309f, 0.855179608f},
-std::array<float,2>{0.0286368448f, 0.482367337f},
-std::array<float,2>{0.494354814f, 0.535987556f},
-std::array<float,2>{0.756046772f, 0.22178331f},
-std::array<float,2>{0.746665716f, 0.586504698f},
-std::array<float,2>{0.154254392f, 0.147811905f},
-std::array<float,2>{0.369202703f, 0.773569882f},
-std::array<float,2>{0.934317052f, 0.415798664f},
-std::array<float,2>{0.844024301f, 0.928281069f},
-std::array<float,2>{0.417184263f, 0.367377698f},
-std::array<float,2>{0.110986881f, 0.722405255f},
-std::array<float,2>{0.594180644f, 0.10411454f},
-std::array<float,2>{0.80548507f, 0.527832329f},
-std::array<float,2>{0.46872431f, 0.191769794f},
-std::array<float,2>{0.0542847551f, 0.815724075f},
-std::array<float,2>{0.547546327f, 0.461918563f},
-std::array<float,2>{0.652466595f, 0.942667484f},
-std::array<float,2>{0.235206977f, 0.274893105f},
-std::array<float,2>{0.298263699f, 0.647501647f},
-std::array<float,2>{0.960766673f, 0.0600437969f},
-std::array<float,2>{0.581760228f, 0.698176682f},
-std::array<float,2>{0.0657511726f, 0.0659220219f},
-std::array<float,2>{0.380218118f, 0.881296515f},
-std::array<float,2>{0.819853485f, 0.335648537f},
-std::array<float,2>{0.889754653f, 0.809619725f},
-std::array<float,2>{0.341754526f, 0.395284921f},
-std::array<float,2>{0.186029986f, 0.597038388f},
-std::array<float,2>{0.696130872f, 0.183076978f},
-std::array<float,2>{0.915076673f, 0.609618485f},
-std::array<float,2>{0.350557059f, 0.171003163f},
-std::array<float,2>{0.135978341f, 0.786349058f},
-std::array<float,2>{0.729041934f, 0.382900655f},
-std::array<float,2>{0.619215012f, 0.895234048f},
-std::array<float,2>{0.106626421f, 0.32333231f},
-std::array<float,2>{0.431670427f, 0.712639749f},
-std::array<float,2>{0.861709654f, 0.0881999135f},
-std::array<float,2>{0.685798109f, 0.629299581f},
-std::array<float,2>{0.217824653f, 0.0458347909f},
-std::array<float,2>{0.276299298f, 0.957044244f},
-std::array<float,2>{0.990000844f, 0.250694275f},
-std::array<float,2>{0.77578938f, 0.833655417f},
-std::array<float,2>{0.484369129f, 0.44498685f},
-std::array<float,2>{0.00691964896f, 0.507157207f},
-std::array<float,2>{0.504591703f, 0.209665269f},
-std::array<float,2>{0.83416152f, 0.748781025f},
-std::array<float,2>{0.391151071f, 0.123949677f},
-std::array<float,2>{0.0870745033f, 0.909959316f},
-std::array<float,2>{0.571549058f, 0.34530735f},
-std::array<float,2>{0.705094099f, 0.751306713f},
-std::array<float,2>{0.158476964f, 0.425348938f},
-std::array<float,2>{0.316459924f, 0.573778987f},
-std::array<float,2>{0.895391822f, 0.131885871f},
-std::array<float,2>{0.536762774f, 0.555249035f},
-std::array<float,2>{0.0419595689f, 0.241679788f},
-std::array<float,2>{0.453048974f, 0.866931438f},
-std::array<float,2>{0.79064554f, 0.494565576f},
-std::array<float,2>{0.948116362f, 0.975634038f},
-std::array<float,2>{0.29656601f, 0.282506555f},
-std::array<float,2>{0.224825576f, 0.664766848f},
-std::array<float,2>{0.639565468f, 0.0270439405f},
-std::array<float,2>{0.903899908f, 0.709862947f},
-std::array<float,2>{0.327027798f, 0.0849283934f},
-std::array<float,2>{0.170115128f, 0.902660966f},
-std::array<float,2>{0.713898599f, 0.31958583f},
-std::array<float,2>{0.568892539f, 0.793441951f},
-std::array<float,2>{0.0810661837f, 0.378744751f},
-std::array<float,2>{0.405787975f, 0.62230432f},
-std::array<float,2>{0.840897262f, 0.162775949f},
-std::array<float,2>{0.631369948f, 0.508308709f},
-std::array<float,2>{0.22691299f, 0.211267516f},
-std::array<float,2>{0.284883678f, 0.841181219f},
-std::array<float,2>{0.944535673f, 0.452160805f},
-std::array<float,2>{0.786049485f, 0.964354277f},
-std::array<float,2>{0.440936148f, 0.261688232f},
-std::array<float,2>{0.035120558f, 0.636895478f},
-std::array<float,2>{0.546586812f, 0.0373972766f},
-std::array<float,2>{0.87418437f, 0.56392926f},
-std::array<float,2>{0.427442789f, 0.135863602f},
-std::array<float,2>{0.0962898359f, 0.763214111f},
-std::array<float,2>{0.614104569f, 0.431737661f},
-std::array<float,2>{0.725012481f, 0.921674371f},
-std::array<float,2>{0.125215054f, 0.352342576f},
-std::array<float,2>{0.353441983f, 0.735233009f},
-std::array<float,2>{0.909281909f, 0.116689354f},
-std::array<float,2>{0.513613522f, 0.66160512f},
-std::array<float,2>{0.0130775124f, 0.0230079032f},
-std::array<float,2>{0.471755743f, 0.983794272f},
-std::array<float,2>{0.76721102f, 0.289678425f},
-std::array<float,2>{0.999348044f, 0.870233774f},
-std::array<float,2>{0.266199082f, 0.484816164f},
-std::array<float,2>{0.208034664f, 0.552291036f},
-std::array<float,2>{0.673053861f, 0.249813706f},
-std::array<float,2>{0.962988496f, 0.540226281f},
-std::array<float,2>{0.307395905f, 0.231147498f},
-std::array<float,2>{0.249584362f, 0.849690259f},
-std::array<float,2>{0.642484844f, 0.47062245f},
-std::array<float,2>{0.558519542f, 0.986911058f},
-std::array<float,2>{0.0551853701f, 0.30990997f},
-std::array<float,2>{0.45575881f, 0.684969366f},
-std::array<float,2>{0.800517321f, 0.0118488139f},
-std::array<float,2>{0.690444589f, 0.730350733f},
-std::array<float,2>{0.176976591f, 0.0958062708f},
-std::array<float,2>{0.328729779f, 0.935017228f},
-std::array<float,2>{0.875476599f, 0.362972647f},
-std::array<float,2>{0.826395035f, 0.767764747f},
-std::array<float,2>{0.383148611f, 0.409190029f},
-std::array<float,2>{0.0753109679f, 0.582155585f},
-std::array<float,2>{0.588552356f, 0.155345023f},
-std::array<float,2>{0.763539732f, 0.652346134f},
-std::array<float,2>{0.485795498f, 0.0495153889f},
-std::array<float,2>{0.0159571394f, 0.952393174f},
-std::array<float,2>{0.524512053f, 0.273379356f},
-std::array<float,2>{0.66308558f, 0.825614154f},
-std::array<float,2>{0.200423613f, 0.45695883f},
-std::array<float,2>{0.255062222f, 0.5201267f},
-std::array<float,2>{0.970264852f, 0.196664661f},
-std::array<float,2>{0.608673811f, 0.605505526f},
-std::array<float,2>{0.119826123f, 0.179297641f},
-std::array<float,2>{0.41195038f, 0.797461867f},
-std::array<float,2>{0.851730287f, 0.398443639f},
-std::array<float,2>{0.922413111f, 0.88914597f},
-std::array<float,2>{0.364539891f, 0.339968711f},
-std::array<float,2>{0.144727871f, 0.688108921f},
-std::array<float,2>{0.735820293f, 0.0759641975f},
-std::array<float,2>{0.940658987f, 0.724793494f},
-std::array<float,2>{0.287939072f, 0.105648145f},
-std::array<float,2>{0.232824773f, 0.924495995f},
-std::array<float,2>{0.627281666f, 0.373912275f},
-std::array<float,2>{0.539685786f, 0.777846754f},
-std::array<float,2>{0.0362008736f, 0.42070058f},
-std::array<float,2>{0.442492157f, 0.590044022f},
-std::array<float,2>{0.782001257f, 0.141343504f},
-std::array<float,2>{0.716030598f, 0.534119904f},
-std::array<float,2>{0.167220518f, 0.226163551f},
-std::array<float,2>{0.323300481f, 0.857814431f},
-std::array<float,2>{0.898813844f, 0.480304867f},
-std::array<float,2>{0.836852074f, 0.999229729f},
-std::array<float,2>{0.401391387f, 0.297139049f},
-std::array<float,2>{0.0840180516f, 0.674598157f},
-std::array<float,2>{0.56564945f, 0.00159177568f},
-std::array<float,2>{0.770012558f, 0.599250495f},
-std::array<float,2>{0.474361956f, 0.185339645f},
-std::array<float,2>{0.00977494102f, 0.808267653f},
-std::array<float,2>{0.511711597f, 0.39066276f},
-std::array<float,2>{0.676484168f, 0.878427088f},
-std::array<float,2>{0.203458995f, 0.331411898f},
-std::array<float,2>{0.271692216f, 0.702384591f},
-std::array<float,2>{0.996053815f, 0.067759499f},
-std::array<float,2>{0.610327661f, 0.641019702f},
-std::array<float,2>{0.0978859514f, 0.0568298139f},
-std::array<float,2>{0.422281265f, 0.937680423f},
-std::array<float,2>{0.870657682f, 0.277461767f},
-std::array<float,2>{0.911539257f, 0.81749934f},
-std::array<float,2>{0.35712257f, 0.466224104f},
-std::array<float,2>{0.130227208f, 0.526365042f},
-std::array<float,2>{0.720742404f, 0.187842399f},
-std::array<float,2>{0.879834116f, 0.50172472f},
-std::array<float,2>{0.333805084f, 0.206272557f},
-std::array<float,2>{0.173856616f, 0.828615904f},
-std::array<float,2>{0.691618264f, 0.438386083f},
-std::array<float,2>{0.591451049f, 0.956323266f},
-std::array<float,2>{0.0730177313f, 0.255915731f},
-std::array<float,2>{0.390061289f, 0.627403438f},
-std::array<float,2>{0.821535945f, 0.0417057313f},
-std::array<float,2>{0.647417426f, 0.714962602f},
-std::array<float,2>{0.245580211f, 0.0924614146f},
-std::array<float,2>{0.312005192f, 0.891363204f},
-std::array<float,2>{0.966143429f, 0.325676531f},
-std::array<float,2>{0.801873803f, 0.782690108f},
-std::array<float,2>{0.4586007f, 0.390136272f},
-std::array<float,2>{0.0595244206f, 0.614427269f},
-std::array<float,2>{0.558916867f, 0.164385915f},
-std::array<float,2>{0.856866121f, 0.669945002f},
-std::array<float,2>{0.409338444f, 0.0288742557f},
-std::array<float,2>{0.122327849f, 0.971257091f},
-std::array<float,2>{0.603889048f, 0.285397023f},
-std::array<float,2>{0.742070556f, 0.862110376f},
-std::array<float,2>{0.143718705f, 0.498679847f},
-std::array<float,2>{0.360921115f, 0.561055839f},
-std::array<float,2>{0.929357052f, 0.235554367f},
-std::array<float,2>{0.527380466f, 0.576028585f},
-std::array<float,2>{0.0203656573f, 0.128844276f},
-std::array<float,2>{0.490676343f, 0.756855309f},
-std::array<float,2>{0.759567857f, 0.426772892f},
-std::array<float,2>{0.973436296f, 0.91218555f},
-std::array<float,2>{0.252185941f, 0.348860711f},
-std::array<float,2>{0.197052494f, 0.743097901f},
-std::array<float,2>{0.658263624f, 0.117332868f},
-std::array<float,2>{0.931833982f, 0.636643112f},
-std::array<float,2>{0.372216552f, 0.0335146897f},
-std::array<float,2>{0.150078505f, 0.965765715f},
-std::array<float,2>{0.742732704f, 0.264418989f},
-std::array<float,2>{0.600467145f, 0.838422239f},
-std::array<float,2>{0.11363513f, 0.448744059f},
-std::array<float,2>{0.421251506f, 0.513244629f},
-std::array<float,2>{0.851250052f, 0.215335548f},
-std::array<float,2>{0.664481401f, 0.62025857f},
-std::array<float,2>{0.189690009f, 0.159943745f},
-std::array<float,2>{0.260011107f, 0.791507721f},
-std::array<float,2>{0.983590484f, 0.380702138f},
-std::array<float,2>{0.751465738f, 0.898757935f},
-std::array<float,2>{0.496821433f, 0.3147493f},
-std::array<float,2>{0.0251149014f, 0.706934333f},
-std::array<float,2>{0.52045536f, 0.0805821717f},
-std::array<float,2>{0.815613627f, 0.548860192f},
-std::array<float,2>{0.376761436f, 0.243419066f},
-std::array<float,2>{0.0691445321f, 0.872283757f},
-std::array<float,2>{0.584366739f, 0.490047872f},
-std::array<float,2>{0.699276149f, 0.980403364f},
-std::array<float,2>{0.18339321f, 0.295580268f},
-std::array<float,2>{0.336064339f, 0.659754515f},
-std::array<float,2>{0.886597872f, 0.0173603967f},
-std::array<float,2>{0.551811635f, 0.740302444f},
-std::array<float,2>{0.04926439f, 0.109631673f},
-std::array<float,2>{0.462096661f, 0.917762458f},
-std::array<float,2>{0.810988605f, 0.35844928f},
-std::array<float,2>{0.955712438f, 0.759572625f},
-std::array<float,2>{0.302116305f, 0.434324205f},
-std::array<float,2>{0.24145937f, 0.56654048f},
-std::array<float,2>{0.650952339f, 0.14031592f},
-std::array<float,2>{0.987276077f, 0.580530167f},
-std::array<float,2>{0.280786276f, 0.150122583f},
-std::array<float,2>{0.213855863f, 0.772718787f},
-std::array<float,2>{0.682859242f, 0.410177439f},
-std::array<float,2>{0.500971913f, 0.930292368f},
-std::array<float,2>{0.0024902937f, 0.364615768f},
-std::array<float,2>{0.478058159f, 0.73255235f},
-std::array<float,2>{0.777914524f, 0.098014608f},
-std::array<float,2>{0.734024107f, 0.68212986f},
-std::array<float,2>{0.137988031f, 0.0106963487f},
-std::array<float,2>{0.345053583f, 0.991010487f},
-std::array<float,2>{0.920046508f, 0.307483017f},
-std::array<float,2>{0.864163756f, 0.846627712f},
-std::array<float,2>{0.434617311f, 0.474838406f},
-std::array<float,2>{0.10189949f, 0.545882583f},
-std::array<float,2>{0.621129036f, 0.228828803f},
-std::array<float,2>{0.793851852f, 0.691814899f},
-std::array<float,2>{0.448545784f, 0.0703663677f},
-std::array<float,2>{0.0456614345f, 0.884359717f},
-std::array<float,2>{0.533647895f, 0.336636007f},
-std::array<float,2>{0.635574698f, 0.801451445f},
-std::array<float,2>{0.221682325f, 0.403206438f},
-std::array<float,2>{0.290758491f, 0.601848423f},
-std::array<float,2>{0.950101018f, 0.175647154f},
-std::array<float,2>{0.57518208f, 0.516749024f},
-std::array<float,2>{0.0922616869f, 0.201361224f},
-std::array<float,2>{0.398227543f, 0.823102236f},
-std::array<float,2>{0.828866482f, 0.458126515f},
-std::array<float,2>{0.893286228f, 0.94807744f},
-std::array<float,2>{0.313840717f, 0.268127769f},
-std::array<float,2>{0.161767796f, 0.651248634f},
-std::array<float,2>{0.710797846f, 0.0542583093f},
-std::array<float,2>{0.989062428f, 0.631161273f},
-std::array<float,2>{0.277024865f, 0.0447999239f},
-std::array<float,2>{0.217159703f, 0.959675193f},
-std::array<float,2>{0.686896503f, 0.252259672f},
-std::array<float,2>{0.504996717f, 0.835323989f},
-std::array<float,2>{0.0065946253f, 0.442664832f},
-std::array<float,2>{0.483268172f, 0.505633771f},
-std::array<float,2>{0.777156413f, 0.207851529f},
-std::array<float,2>{0.730415761f, 0.613154233f},
-std::array<float,2>{0.135356396f, 0.169727653f},
-std::array<float,2>{0.351158857f, 0.78885442f},
-std::array<float,2>{0.915006399f, 0.385658979f},
-std::array<float,2>{0.863246918f, 0.897881925f},
-std::array<float,2>{0.433425069f, 0.321518391f},
-std::array<float,2>{0.105931044f, 0.714721739f},
-std::array<float,2>{0.620609522f, 0.0863233432f},
-std::array<float,2>{0.789134324f, 0.557860732f},
-std::array<float,2>{0.451378703f, 0.240059033f},
-std::array<float,2>{0.0425606295f, 0.864811778f},
-std::array<float,2>{0.535283923f, 0.492590517f},
-std::array<float,2>{0.639903665f, 0.974395335f},
-std::array<float,2>{0.225619256f, 0.283582985f},
-std::array<float,2>{0.295251876f, 0.666598201f},
-std::array<float,2>{0.948981822f, 0.0245937333f},
-std::array<float,2>{0.570336699f, 0.74785924f},
-std::array<float,2>{0.0861149728f, 0.122199923f},
-std::array<float,2>{0.391765386f, 0.907524645f},
-std::array<float,2>{0.83558023f, 0.346975058f},
-std::array<float,2>{0.895654082f, 0.752497435f},
-std::array<float,2>{0.317619592f, 0.422576994f},
-std::array<float,2>{0.159298077f, 0.570915759f},
-std::array<float,2>{0.706697881f, 0.129469275f},
-std::array<float,2>{0.93471235f, 0.588161945f},
-std::array<float,2>{0.370359451f, 0.14488028f},
-std::array<float,2>{0.152805939f, 0.777339935f},
-std::array<float,2>{0.747911751f, 0.416773587f},
-std::array<float,2>{0.595201731f, 0.92668426f},
-std::array<float,2>{0.109851517f, 0.369313657f},
-std::array<float,2>{0.416546673f, 0.72025311f},
-std::array<float,2>{0.844965339f, 0.102746949f},
-std::array<float,2>{0.669071794f, 0.678494155f},
-std::array<float,2>{0.193252653f, 0.00588155538f},
-std::array<float,2>{0.26298207f, 0.993122101f},
-std::array<float,2>{0.978503168f, 0.30405134f},
-std::array<float,2>{0.75721705f, 0.853175581f},
-std::array<float,2>{0.495547235f, 0.483107537f},
-std::array<float,2>{0.0278533883f, 0.537463367f},
-std::array<float,2>{0.519425571f, 0.218962029f},
-std::array<float,2>{0.819167376f, 0.696718395f},
-std::array<float,2>{0.379460394f, 0.0628996342f},
-std::array<float,2>{0.0646903738f, 0.879049659f},
-std::array<float,2>{0.580361605f, 0.333754778f},
-std::array<float,2>{0.697168171f, 0.811735034f},
-std::array<float,2>{0.186803311f, 0.396947235f},
-std::array<float,2>{0.340147376f, 0.59407413f},
-std::array<float,2>{0.889294922f, 0.181627631f},
-std::array<float,2>{0.548308671f, 0.53124398f},
-std::array<float,2>{0.053010352f, 0.195270583f},
-std::array<float,2>{0.467346966f, 0.812891901f},
-std::array<float,2>{0.806405485f, 0.463019669f},
-std::array<float,2>{0.959860027f, 0.943808556f},
-std::array<float,2>{0.297787219f, 0.275605053f},
-std::array<float,2>{0.235926777f, 0.64613694f},
-std::array<float,2>{0.653873742f, 0.0605615079f},
-std::array<float,2>{0.876052678f, 0.72682929f},
-std::array<float,2>{0.329412997f, 0.0942288488f},
-std::array<float,2>{0.176666722f, 0.936977923f},
-std::array<float,2>{0.689692497f, 0.360213548f},
-std::array<float,2>{0.589669645f, 0.76741147f},
-std::array<float,2>{0.0745984912f, 0.406780094f},
-std::array<float,2>{0.383817911f, 0.584607601f},
-std::array<float,2>{0.827913523f, 0.153652385f},
-std::array<float,2>{0.641422093f, 0.541038215f},
-std::array<float,2>{0.24837929f, 0.232815459f},
-std::array<float,2>{0.308380067f, 0.848777592f},
-std::array<float,2>{0.964528203f, 0.471604109f},
-std::array<float,2>{0.799135804f, 0.986019611f},
-std::array<float,2>{0.456465274f, 0.31198284f},
-std::array<float,2>{0.0559497885f, 0.687340021f},
-std::array<float,2>{0.556812048f, 0.0152685363f},
-std::array<float,2>{0.852923393f, 0.608624578f},
-std::array<float,2>{0.410937756f, 0.176535487f},
-std::array<float,2>{0.120325759f, 0.800707698f},
-std::array<float,2>{0.608287811f, 0.401109159f},
-std::array<float,2>{0.73507905f, 0.888485372f},
-std::array<float,2>{0.145705506f, 0.342212945f},
-std::array<float,2>{0.363974839f, 0.68989861f},
-std::array<float,2>{0.923793375f, 0.0777140707f},
-std::array<float,2>{0.52362138f, 0.656140208f},
-std::array<float,2>{0.0175005104f, 0.0485220775f},
-std::array<float,2>{0.484847724f, 0.951099753f},
-std::array<float,2>{0.762162566f, 0.270200759f},
-std::array<float,2>{0.96876353f, 0.828087926f},
-std::array<float,2>{0.254723638f, 0.455054224f},
-std::array<float,2>{0.199424013f, 0.521496773f},
-std::array<float,2>{0.663254678f, 0.199039236f},
-std::array<float,2>{0.944132626f, 0.51122123f},
-std::array<float,2>{0.283714533f, 0.214066908f},
-std::array<float,2>{0.227991208f, 0.842351854f},
-std::array<float,2>{0.632655203f, 0.450934619f},
-std::array<float,2>{0.545021653f, 0.961614132f},
-std::array<float,2>{0.0332108885f, 0.259593189f},
-std::array<float,2>{0.440068036f, 0.639376104f},
-std::array<float,2>{0.786323786f, 0.0363656729f},
-std::array<float,2>{0.71320051f, 0.707903624f},
-std::array<float,2>{0.171321943f, 0.0833897144f},
-std::array<float,2>{0.327919602f, 0.904520571f},
-std::array<float,2>{0.903113127f, 0.316505849f},
-std::array<float,2>{0.840073347f, 0.795957565f},
-std::array<float,2>{0.405100971f, 0.376440883f},
-std::array<float,2>{0.0809656531f, 0.624082506f},
-std::array<float,2>{0.56948638f, 0.160906821f},
-std::array<float,2>{0.766337931f, 0.663206041f},
-std::array<float,2>{0.471347213f, 0.0196117684f},
-std::array<float,2>{0.0126920175f, 0.980699539f},
-std::array<float,2>{0.512583077f, 0.292942733f},
-std::array<float,2>{0.672766387f, 0.867429435f},
-std::array<float,2>{0.207674488f, 0.487010986f},
-std::array<float,2>{0.267452449f, 0.553068101f},
-std::array<float,2>{0.9985255f, 0.247647688f},
-std::array<float,2>{0.614389777f, 0.565601885f},
-std::array<float,2>{0.0974969342f, 0.134157404f},
-std::array<float,2>{0.426080883f, 0.764982104f},
-std::array<float,2>{0.873583496f, 0.431068867f},
-std::array<float,2>{0.908377469f, 0.919763386f},
-std::array<float,2>{0.352336526f, 0.354444176f},
-std::array<float,2>{0.126435876f, 0.737085938f},
-std::array<float,2>{0.726154566f, 0.113511123f},
-std::array<float,2>{0.965588093f, 0.717825234f},
-std::array<float,2>{0.311522871f, 0.0908630565f},
-std::array<float,2>{0.244703814f, 0.89292562f},
-std::array<float,2>{0.648048639f, 0.326628864f},
-std::array<float,2>{0.559913456f, 0.784085155f},
-std::array<float,2>{0.0598287359f, 0.38854754f},
-std::array<float,2>{0.457497746f, 0.616916955f},
-std::array<float,2>{0.801479995f, 0.167283416f},
-std::array<float,2>{0.693008602f, 0.502359271f},
-std::array<float,2>{0.174810454f, 0.205037758f},
-std::array<float,2>{0.332357705f, 0.830624342f},
-std::array<float,2>{0.880339086f, 0.44092831f},
-std::array<float,2>{0.821049035f, 0.953580201f},
-std::array<float,2>{0.388936192f, 0.254849613f},
-std::array<float,2>{0.0740396306f, 0.626616418f},
-std::array<float,2>{0.590604186f, 0.0401230529f},
-std::array<float,2>{0.757852316f, 0.577410698f},
-std::array<float,2>{0.491379619f, 0.126176134f},
-std::array<float,2>{0.020912284f, 0.755148172f},
-std::array<float,2>{0.528575182f, 0.428994864f},
-std::array<float,2>{0.659895658f, 0.910193145f},
-std::array<float,2>{0.195511818f, 0.350333542f},
-std::array<float,2>{0.253307968f, 0.744400918f},
-std::array<float,2>{0.973735273f, 0.119791374f},
-std::array<float,2>{0.605242491f, 0.669615269f},
-std::array<float,2>{0.121167533f, 0.0310030747f},
-std::array<float,2>{0.408361465f, 0.969351172f},
-std::array<float,2>{0.856371641f, 0.287802815f},
-std::array<float,2>{0.928005159f, 0.861230731f},
-std::array<float,2>{0.359748602f, 0.496663034f},
-std::array<float,2>{0.142620832f, 0.559929371f},
-std::array<float,2>{0.740662038f, 0.236497462f},
-std::array<float,2>{0.900201976f, 0.531270623f},
-std::array<float,2>{0.322337031f, 0.223132953f},
-std::array<float,2>{0.166015625f, 0.8561185f},
-std::array<float,2>{0.714897692f, 0.478025794f},
-std::array<float,2>{0.56484127f, 0.99634409f},
-std::array<float,2>{0.0850539058f, 0.299393892f},
-std::array<float,2>{0.400829583f, 0.672234535f},
-std::array<float,2>{0.837286472f, 0.00209393026f},
-std::array<float,2>{0.628876686f, 0.723743737f},
-std::array<float,2>{0.233526602f, 0.108275905f},
-std::array<float,2>{0.288243234f, 0.922352672f},
-std::array<float,2>{0.939640999f, 0.372389108f},
-std::array<float,2>{0.782793701f, 0.780762672f},
-std::array<float,2>{0.441569716f, 0.419368684f},
-std::array<float,2>{0.0355140492f, 0.591902852f},
-std::array<float,2>{0.54091388f, 0.142681226f},
-std::array<float,2>{0.869431496f, 0.644256771f},
-std::array<float,2>{0.422905743f, 0.0555072874f},
-std::array<float,2>{0.0988914892f, 0.940628469f},
-std::array<float,2>{0.611022294f, 0.280637711f},
-std::array<float,2>{0.72198838f, 0.81926322f},
-std::array<float,2>{0.129063755f, 0.466948509f},
-std::array<float,2>{0.356390238f, 0.524427176f},
-std::array<float,2>{0.910752475f, 0.189814568f},
-std::array<float,2>{0.510496318f, 0.599627256f},
-std::array<float,2>{0.0114554549f, 0.187068433f},
-std::array<float,2>{0.473607779f, 0.806555271f},
-std::array<float,2>{0.771100044f, 0.393328726f},
-std::array<float,2>{0.994442284f, 0.876587987f},
-std::array<float,2>{0.273410738f, 0.328343213f},
-std::array<float,2>{0.20446074f, 0.700461149f},
-std::array<float,2>{0.677243471f, 0.0686580166f},
-std::array<float,2>{0.921251118f, 0.679843605f},
-std::array<float,2>{0.344330728f, 0.00876654405f},
-std::array<float,2>{0.137133226f, 0.989985585f},
-std::array<float,2>{0.733212054f, 0.305846781f},
-std::array<float,2>{0.622885525f, 0.843904912f},
-std::array<float,2>{0.102549709f, 0.47376284f},
-std::array<float,2>{0.433695465f, 0.543440044f},
-std::array<float,2>{0.865104973f, 0.227394745f},
-std::array<float,2>{0.681907058f, 0.578765452f},
-std::array<float,2>{0.214367703f, 0.151478395f},
-std::array<float,2>{0.279887736f, 0.770311415f},
-std::array<float,2>{0.98756969f, 0.412333518f},
-std::array<float,2>{0.778877318f, 0.932741046f},
-std::array<float,2>{0.477315962f, 0.366103947f},
-std::array<float,2>{0.00389386388f, 0.732071221f},
-std::array<float,2>{0.501415849f, 0.101321653f},
-std::array<float,2>{0.829534233f, 0.517617285f},
-std::array<float,2>{0.397455364f, 0.199492648f},
-std::array<float,2>{0.0928849876f, 0.821887374f},
-std::array<float,2>{0.575515211f, 0.459165663f},
-std::array<float,2>{0.709758759f, 0.947129011f},
-std::array<float,2>{0.160747796f, 0.267073065f},
-std::array<float,2>{0.31346941f, 0.650097549f},
-std::array<float,2>{0.893706322f, 0.0524717569f},
-std::array<float,2>{0.534632266f, 0.694258332f},
-std::array<float,2>{0.0464491919f, 0.0723995045f},
-std::array<float,2>{0.447944731f, 0.886677384f},
-std::array<float,2>{0.794524431f, 0.339437753f},
-std::array<float,2>{0.950265944f, 0.80336225f},
-std::array<float,2>{0.28958565f, 0.405807227f},
-std::array<float,2>{0.221605852f, 0.604484439f},
-std::array<float,2>{0.635744929f, 0.172550902f},
-std::array<float,2>{0.982471168f, 0.618815541f},
-std::array<float,2>{0.260852903f, 0.156897724f},
-std::array<float,2>{0.191350326f, 0.790037036f},
-std::array<float,2>{0.665484607f, 0.382531464f},
-std::array<float,2>{0.520722926f, 0.900716305f},
-std::array<float,2>{0.0236671492f, 0.314292669f},
-std::array<float,2>{0.497389019f, 0.703735411f},
-std::array<float,2>{0.750693023f, 0.0794323236f},
-std::array<float,2>{0.743457615f, 0.633086026f},
-std::array<float,2>{0.148484513f, 0.0325386152f},
-std::array<float,2>{0.371356666f, 0.968365252f},
-std::array<float,2>{0.932794333f, 0.263661474f},
-std::array<float,2>{0.849988937f, 0.836429298f},
-std::array<float,2>{0.420066655f, 0.445546746f},
-std::array<float,2>{0.114570014f, 0.514646649f},
-std::array<float,2>{0.600928128f, 0.218092114f},
-std::array<float,2>{0.811646521f, 0.738699436f},
-std::array<float,2>{0.46130684f, 0.112043805f},
-std::array<float,2>{0.0501457527f, 0.914962113f},
-std::array<float,2>{0.550988376f, 0.355593085f},
-std::array<float,2>{0.651643276f, 0.761184156f},
-std::array<float,2>{0.240426615f, 0.436677068f},
-std::array<float,2>{0.301246315f, 0.57013464f},
-std::array<float,2>{0.956182837f, 0.138438404f},
-std::array<float,2>{0.585316122f, 0.548152864f},
-std::array<float,2>{0.0695172474f, 0.244712055f},
-std::array<float,2>{0.375433922f, 0.873145938f},
-std::array<float,2>{0.815354407f, 0.491888553f},
-std::array<float,2>{0.884954453f, 0.977204621f},
-std::array<float,2>{0.337770104f, 0.293046951f},
-std::array<float,2>{0.1820416f, 0.657747686f},
-std::array<float,2>{0.701112688f, 0.0193614196f},
-std::array<float,2>{0.946664035f, 0.665997326f},
-std::array<float,2>{0.29337272f, 0.0262907296f},
-std::array<float,2>{0.224198341f, 0.97541064f},
-std::array<float,2>{0.638130188f, 0.281790495f},
-std::array<float,2>{0.538009107f, 0.866185904f},
-std::array<float,2>{0.0398767963f, 0.495890707f},
-std::array<float,2>{0.450590968f, 0.556355059f},
-std::array<float,2>{0.792932153f, 0.240698621f},
-std::array<float,2>{0.703401804f, 0.572978437f},
-std::array<float,2>{0.158120811f, 0.130866215f},
-std::array<float,2>{0.320082933f, 0.750001669f},
-std::array<float,2>{0.896834493f, 0.4240444f},
-std::array<float,2>{0.833459377f, 0.90903002f},
-std::array<float,2>{0.39343226f, 0.343893409f},
-std::array<float,2>{0.0881881639f, 0.749378502f},
-std::array<float,2>{0.572808444f, 0.124093786f},
-std::array<float,2>{0.774860263f, 0.506327689f},
-std::array<float,2>{0.481718451f, 0.210180819f},
-std::array<float,2>{0.00501087401f, 0.832038105f},
-std::array<float,2>{0.50588572f, 0.443383545f},
-std::array<float,2>{0.684210956f, 0.958383441f},
-std::array<float,2>{0.215248838f, 0.251495481f},
-std::array<float,2>{0.275240779f, 0.630109966f},
-std::array<float,2>{0.991238117f, 0.0467740521f},
-std::array<float,2>{0.618059933f, 0.711044133f},
-std::array<float,2>{0.108111754f, 0.0895867944f},
-std::array<float,2>{0.431542456f, 0.89590466f},
-std::array<float,2>{0.861319363f, 0.322293341f},
-std::array<float,2>{0.91696769f, 0.785544753f},
-std::array<float,2>{0.347982228f, 0.383910418f},
-std::array<float,2>{0.132940516f, 0.610366404f},
-std::array<float,2>{0.727494717f, 0.170640886f},
-std::array<float,2>{0.8885023f, 0.596371174f},
-std::array<float,2>{0.343375087f, 0.18209137f},
-std::array<float,2>{0.184268907f, 0.808835566f},
-std::array<float,2>{0.698313236f, 0.396468818f},
-std::array<float,2>{0.579768896f, 0.882711589f},
-std::array<float,2>{0.0629657134f, 0.334154516f},
-std::array<float,2>{0.381130189f, 0.698772252f},
-std::array<float,2>{0.818151295f, 0.0652628988f},
-std::array<float,2>{0.656065583f, 0.646610141f},
-std::array<float,2>{0.236628056f, 0.0590945184f},
-std::array<float,2>{0.300576389f, 0.942079782f},
-std::array<float,2>{0.957987964f, 0.27427572f},
-std::array<float,2>{0.806881964f, 0.815350831f},
-std::array<float,2>{0.465269029f, 0.461899936f},
-std::array<float,2>{0.0517452396f, 0.528547764f},
-std::array<float,2>{0.549728036f, 0.192639232f},
-std::array<float,2>{0.846696734f, 0.721499622f},
-std::array<float,2>{0.414317667f, 0.104541905f},
-std::array<float,2>{0.111948848f, 0.929364443f},
-std::array<float,2>{0.595720589f, 0.369070649f},
-std::array<float,2>{0.748967052f, 0.7748456f},
-std::array<float,2>{0.154495031f, 0.414866269f},
-std::array<float,2>{0.368831873f, 0.587542176f},
-std::array<float,2>{0.936503887f, 0.147288918f},
-std::array<float,2>{0.515769362f, 0.536841035f},
-std::array<float,2>{0.0296041612f, 0.221478194f},
-std::array<float,2>{0.493457973f, 0.853941262f},
-std::array<float,2>{0.754261553f, 0.480656952f},
-std::array<float,2>{0.980429411f, 0.994843066f},
-std::array<float,2>{0.265042275f, 0.302324444f},
-std::array<float,2>{0.193949729f, 0.677344322f},
-std::array<float,2>{0.671105385f, 0.00571731385f},
-std::array<float,2>{0.92506206f, 0.689069569f},
-std::array<float,2>{0.36673066f, 0.0750026554f},
-std::array<float,2>{0.147816673f, 0.890129626f},
-std::array<float,2>{0.736867368f, 0.341302663f},
-std::array<float,2>{0.606227338f, 0.798327863f},
-std::array<float,2>{0.119027846f, 0.399491966f},
-std::array<float,2>{0.413216949f, 0.607233346f},
-std::array<float,2>{0.853624225f, 0.178097293f},
-std::array<float,2>{0.660654008f, 0.521379173f},
-std::array<float,2>{0.201724678f, 0.195673808f},
-std::array<float,2>{0.256671041f, 0.825030982f},
-std::array<float,2>{0.971106648f, 0.455554515f},
-std::array<float,2>{0.763682008f, 0.951482892f},
-std::array<float,2>{0.487736821f, 0.272384495f},
-std::array<float,2>{0.0178969391f, 0.653367341f},
-std::array<float,2>{0.525670111f, 0.0503633693f},
-std::array<float,2>{0.824869573f, 0.583035648f},
-std::array<float,2>{0.385370463f, 0.15437752f},
-std::array<float,2>{0.0767803341f, 0.768771291f},
-std::array<float,2>{0.586488903f, 0.408296138f},
-std::array<float,2>{0.687870264f, 0.934532821f},
-std::array<float,2>{0.179366037f, 0.361501426f},
-std::array<float,2>{0.331485063f, 0.729436576f},
-std::array<float,2>{0.878577828f, 0.0971308425f},
-std::array<float,2>{0.55598402f, 0.684104323f},
-std::array<float,2>{0.0584665313f, 0.0134184929f},
-std::array<float,2>{0.454545528f, 0.988262773f},
-std::array<float,2>{0.797702014f, 0.308623135f},
-std::array<float,2>{0.962607026f, 0.850781798f},
-std::array<float,2>{0.305420518f, 0.469510466f},
-std::array<float,2>{0.247944996f, 0.539211154f},
-std::array<float,2>{0.643400788f, 0.231519118f},
-std::array<float,2>{0.996794522f, 0.551322579f},
-std::array<float,2>{0.268042177f, 0.248966604f},
-std::array<float,2>{0.209394887f, 0.870110035f},
-std::array<float,2>{0.675472796f, 0.486098468f},
-std::array<float,2>{0.514173806f, 0.982878625f},
-std::array<float,2>{0.0138623528f, 0.290290177f},
-std::array<float,2>{0.469611853f, 0.660391212f},
-std::array<float,2>{0.768351078f, 0.0220547486f},
-std::array<float,2>{0.7233302f, 0.73626411f},
-std::array<float,2>{0.128886595f, 0.115868434f},
-std::array<float,2>{0.353762776f, 0.920677006f},
-std::array<float,2>{0.906271577f, 0.35272941f},
-std::array<float,2>{0.872031152f, 0.762407422f},
-std::array<float,2>{0.428827465f, 0.432964027f},
-std::array<float,2>{0.0952208415f, 0.56323117f},
-std::array<float,2>{0.616115749f, 0.134969294f},
-std::array<float,2>{0.787187755f, 0.637815714f},
-std::array<float,2>{0.437749237f, 0.038340643f},
-std::array<float,2>{0.0319571234f, 0.96300441f},
-std::array<float,2>{0.543506086f, 0.260179728f},
-std::array<float,2>{0.629220307f, 0.840568185f},
-std::array<float,2>{0.2289588f, 0.451426268f},
-std::array<float,2>{0.281373262f, 0.509072542f},
-std::array<float,2>{0.943024635f, 0.212411195f},
-std::array<float,2>{0.567424178f, 0.621544302f},
-std::array<float,2>{0.0792074725f, 0.163836867f},
-std::array<float,2>{0.403918356f, 0.794148743f},
-std::array<float,2>{0.842569768f, 0.377575725f},
-std::array<float,2>{0.905100048f, 0.903335035f},
-std::array<float,2>{0.325582802f, 0.318847686f},
-std::array<float,2>{0.168297693f, 0.710112154f},
-std::array<float,2>{0.711738527f, 0.0852203146f},
-std::array<float,2>{0.975258887f, 0.743221164f},
-std::array<float,2>{0.250442266f, 0.119089425f},
-std::array<float,2>{0.198990762f, 0.913743436f},
-std::array<float,2>{0.656564355f, 0.347953796f},
-std::array<float,2>{0.529716611f, 0.75636071f},
-std::array<float,2>{0.0224150904f, 0.426564842f},
-std::array<float,2>{0.488429248f, 0.574674666f},
-std::array<float,2>{0.761330843f, 0.127516553f},
-std::array<float,2>{0.740197837f, 0.56204623f},
-std::array<float,2>{0.14164032f, 0.235200971f},
-std::array<float,2>{0.362055629f, 0.862534642f},
-std::array<float,2>{0.927275598f, 0.499153763f},
-std::array<float,2>{0.857690513f, 0.972580612f},
-std::array<float,2>{0.407203257f, 0.286787093f},
-std::array<float,2>{0.124788485f, 0.671575546f},
-std::array<float,2>{0.603084564f, 0.0277275909f},
-std::array<float,2>{0.804381669f, 0.613332212f},
-std::array<float,2>{0.460130066f, 0.165669501f},
-std::array<float,2>{0.0623001903f, 0.7817415f},
-std::array<float,2>{0.56095314f, 0.389478534f},
-std::array<float,2>{0.64553988f, 0.891825497f},
-std::array<float,2>{0.242328018f, 0.324472249f},
-std::array<float,2>{0.310182124f, 0.716052949f},
-std::array<float,2>{0.96771425f, 0.0933520496f},
-std::array<float,2>{0.592525423f, 0.628479362f},
-std::array<float,2>{0.0718158931f, 0.0426202267f},
-std::array<float,2>{0.387809515f, 0.955351889f},
-std::array<float,2>{0.822886229f, 0.257005304f},
-std::array<float,2>{0.881414056f, 0.829848766f},
-std::array<float,2>{0.33583501f, 0.438561618f},
-std::array<float,2>{0.172031507f, 0.500135601f},
-std::array<float,2>{0.693531156f, 0.205150276f},
-std::array<float,2>{0.913326681f, 0.527015269f},
-std::array<float,2>{0.358081669f, 0.189177737f},
-std::array<float,2>{0.130989894f, 0.817228913f},
-std::array<float,2>{0.719312787f, 0.465389311f},
-std::array<float,2>{0.612451434f, 0.938988447f},
-std::array<float,2>{0.100149587f, 0.278894424f},
-std::array<float,2>{0.424762219f, 0.642294288f},
-std::array<float,2>{0.868262708f, 0.0579415262f},
-std::array<float,2>{0.678339422f, 0.701649189f},
-std::array<float,2>{0.206614256f, 0.0670643896f},
-std::array<float,2>{0.271133065f, 0.877205491f},
-std::array<float,2>{0.992612541f, 0.330080003f},
-std::array<float,2>{0.7728284f, 0.807515025f},
-std::array<float,2>{0.475746423f, 0.39224717f},
-std::array<float,2>{0.00890337303f, 0.598434806f},
-std::array<float,2>{0.508140981f, 0.183777735f},
-std::array<float,2>{0.839787781f, 0.675397754f},
-std::array<float,2>{0.39986822f, 0.000932591211f},
-std::array<float,2>{0.0831943005f, 0.998232305f},
-std::array<float,2>{0.564295113f, 0.298749924f},
-std::array<float,2>{0.718137801f, 0.858856797f},
-std::array<float,2>{0.164903656f, 0.479329318f},
-std::array<float,2>{0.321991116f, 0.534566045f},
-std::array<float,2>{0.900582671f, 0.225568697f},
-std::array<float,2>{0.541436672f, 0.591550767f},
-std::array<float,2>{0.0384635031f, 0.142447323f},
-std::array<float,2>{0.444063157f, 0.778855264f},
-std::array<float,2>{0.785044193f, 0.421831518f},
-std::array<float,2>{0.939031899f, 0.925531805f},
-std::array<float,2>{0.285524696f, 0.374943674f},
-std::array<float,2>{0.231191963f, 0.726362884f},
-std::array<float,2>{0.626143932f, 0.106642023f},
-std::array<float,2>{0.892504156f, 0.651634514f},
-std::array<float,2>{0.31609121f, 0.0527707897f},
-std::array<float,2>{0.162270635f, 0.948469877f},
-std::array<float,2>{0.708932281f, 0.26922369f},
-std::array<float,2>{0.577895105f, 0.823961437f},
-std::array<float,2>{0.0907856673f, 0.457660347f},
-std::array<float,2>{0.394547522f, 0.516314328f},
-std::array<float,2>{0.830331981f, 0.203061506f},
-std::array<float,2>{0.634751379f, 0.603214383f},
-std::array<float,2>{0.219916582f, 0.173870936f},
-std::array<float,2>{0.292583227f, 0.801968038f},
-std::array<float,2>{0.952053428f, 0.403621793f},
-std::array<float,2>{0.79623121f, 0.883227348f},
-std::array<float,2>{0.446775794f, 0.337848723f},
-std::array<float,2>{0.0445854589f, 0.692737103f},
-std::array<float,2>{0.532011688f, 0.071873866f},
-std::array<float,2>{0.86582303f, 0.545956492f},
-std::array<float,2>{0.435823858f, 0.229767576f},
-std::array<float,2>{0.104196616f, 0.846865892f},
-std::array<float,2>{0.624845624f, 0.476423562f},
-std::array<float,2>{0.731193304f, 0.991360605f},
-std::array<float,2>{0.140347183f, 0.308148086f},
-std::array<float,2>{0.346741945f, 0.683546722f},
-std::array<float,2>{0.918915987f, 0.0111747943f},
-std::array<float,2>{0.5031901f, 0.733901978f},
-std::array<float,2>{0.000675898162f, 0.099137798f},
-std::array<float,2>{0.480168223f, 0.931214929f},
-std::array<float,2>{0.780242145f, 0.364036947f},
-std::array<float,2>{0.98583889f, 0.771714628f},
-std::array<float,2>{0.278744668f, 0.411555558f},
-std::array<float,2>{0.211660802f, 0.581905484f},
-std::array<float,2>{0.679701209f, 0.148838922f},
-std::array<float,2>{0.95433253f, 0.567465246f},
-std::array<float,2>{0.303025216f, 0.139135957f},
-std::array<float,2>{0.239245445f, 0.758703232f},
-std::array<float,2>{0.649209142f, 0.434974194f},
-std::array<float,2>{0.554383337f, 0.916866958f},
-std::array<float,2>{0.0482268408f, 0.357979804f},
-std::array<float,2>{0.463753998f, 0.741494834f},
-std::array<float,2>{0.80866915f, 0.110424519f},
-std::array<float,2>{0.702069879f, 0.65843302f},
-std::array<float,2>{0.181403622f, 0.0157475434f},
-std::array<float,2>{0.338796973f, 0.978869379f},
-std::array<float,2>{0.884765506f, 0.296391577f},
-std::array<float,2>{0.813560486f, 0.871737242f},
-std::array<float,2>{0.377440989f, 0.488509685f},
-std::array<float,2>{0.0665616319f, 0.549834311f},
-std::array<float,2>{0.582614839f, 0.242842272f},
-std::array<float,2>{0.752893686f, 0.706008792f},
-std::array<float,2>{0.498057544f, 0.0817677155f},
-std::array<float,2>{0.0266281273f, 0.899900615f},
-std::array<float,2>{0.521900773f, 0.316115409f},
-std::array<float,2>{0.667509079f, 0.792865694f},
-std::array<float,2>{0.188178658f, 0.37910977f},
-std::array<float,2>{0.259122431f, 0.620098352f},
-std::array<float,2>{0.981141746f, 0.158712924f},
-std::array<float,2>{0.598811746f, 0.511855006f},
-std::array<float,2>{0.116091587f, 0.216557503f},
-std::array<float,2>{0.418593377f, 0.839798093f},
-std::array<float,2>{0.848819256f, 0.44748953f},
-std::array<float,2>{0.92974025f, 0.965915203f},
-std::array<float,2>{0.373134434f, 0.264844298f},
-std::array<float,2>{0.150628462f, 0.635116398f},
-std::array<float,2>{0.74524951f, 0.035007149f},
-std::array<float,2>{0.94275552f, 0.638828397f},
-std::array<float,2>{0.281963825f, 0.0368671194f},
-std::array<float,2>{0.229397461f, 0.961161971f},
-std::array<float,2>{0.629418254f, 0.259209543f},
-std::array<float,2>{0.543241799f, 0.841854215f},
-std::array<float,2>{0.0312748104f, 0.45044753f},
-std::array<float,2>{0.438358963f, 0.511651039f},
-std::array<float,2>{0.787950099f, 0.214840069f},
-std::array<float,2>{0.711169064f, 0.62476629f},
-std::array<float,2>{0.168851897f, 0.160324976f},
-std::array<float,2>{0.32591188f, 0.796714962f},
-std::array<float,2>{0.904696524f, 0.376472384f},
-std::array<float,2>{0.842221677f, 0.905097067f},
-std::array<float,2>{0.403764009f, 0.31693989f},
-std::array<float,2>{0.079880774f, 0.707271755f},
-std::array<float,2>{0.568258941f, 0.0835358649f},
-std::array<float,2>{0.768003523f, 0.553501725f},
-std::array<float,2>{0.468798101f, 0.247186601f},
-std::array<float,2>{0.0145801939f, 0.867702246f},
-std::array<float,2>{0.514122605f, 0.486572564f},
-std::array<float,2>{0.675139964f, 0.981367767f},
-std::array<float,2>{0.209693387f, 0.292247087f},
-std::array<float,2>{0.268159121f, 0.663999856f},
-std::array<float,2>{0.996233463f, 0.02009614f},
-std::array<float,2>{0.615355313f, 0.73654896f},
-std::array<float,2>{0.0947860032f, 0.114225209f},
-std::array<float,2>{0.429431707f, 0.919431627f},
-std::array<float,2>{0.871512949f, 0.353654802f},
-std::array<float,2>{0.906767845f, 0.765213966f},
-std::array<float,2>{0.354039311f, 0.431582332f},
-std::array<float,2>{0.128060162f, 0.566343606f},
-std::array<float,2>{0.722728193f, 0.134516701f},
-std::array<float,2>{0.8779369f, 0.584054649f},
-std::array<float,2>{0.331988841f, 0.154242784f},
-std::array<float,2>{0.179041266f, 0.766919732f},
-std::array<float,2>{0.68843323f, 0.406574219f},
-std::array<float,2>{0.586083472f, 0.937309325f},
-std::array<float,2>{0.0762232244f, 0.359402001f},
-std::array<float,2>{0.384772569f, 0.727492392f},
-std::array<float,2>{0.824554205f, 0.0946100578f},
-std::array<float,2>{0.642704368f, 0.686762512f},
-std::array<float,2>{0.24748911f, 0.0147161465f},
-std::array<float,2>{0.304794192f, 0.985752523f},
-std::array<float,2>{0.962272525f, 0.312287748f},
-std::array<float,2>{0.797247946f, 0.849454165f},
-std::array<float,2>{0.45493573f, 0.470808446f},
-std::array<float,2>{0.0578747056f, 0.541643083f},
-std::array<float,2>{0.556538224f, 0.23338072f},
-std::array<float,2>{0.854138732f, 0.690378666f},
-std::array<float,2>{0.413778931f, 0.0771523342f},
-std::array<float,2>{0.118238203f, 0.887734354f},
-std::array<float,2>{0.60571748f, 0.342758775f},
-std::array<float,2>{0.736479044f, 0.79992938f},
-std::array<float,2>{0.14795877f, 0.400849521f},
-std::array<float,2>{0.366508186f, 0.609124422f},
-std::array<float,2>{0.925662756f, 0.175963998f},
-std::array<float,2>{0.526188552f, 0.522136092f},
-std::array<float,2>{0.018191319f, 0.198548451f},
-std::array<float,2>{0.487839013f, 0.827170551f},
-std::array<float,2>{0.76433152f, 0.454244465f},
-std::array<float,2>{0.971556783f, 0.950451493f},
-std::array<float,2>{0.255968779f, 0.27000612f},
-std::array<float,2>{0.201590523f, 0.655628085f},
-std::array<float,2>{0.66022706f, 0.0483180322f},
-std::array<float,2>{0.935648739f, 0.719897151f},
-std::array<float,2>{0.368251055f, 0.10349106f},
-std::array<float,2>{0.154895797f, 0.925842166f},
-std::array<float,2>{0.748441875f, 0.369755417f},
-std::array<float,2>{0.596226931f, 0.77642405f},
-std::array<float,2>{0.111429676f, 0.416131675f},
-std::array<float,2>{0.414702743f, 0.588794589f},
-std::array<float,2>{0.847352862f, 0.145251468f},
-std::array<float,2>{0.671408236f, 0.537970901f},
-std::array<float,2>{0.193824112f, 0.219427198f},
-std::array<float,2>{0.265234947f, 0.852594137f},
-std::array<float,2>{0.979596138f, 0.482660294f},
-std::array<float,2>{0.754730523f, 0.992535412f},
-std::array<float,2>{0.493936718f, 0.30467543f},
-std::array<float,2>{0.0299532656f, 0.678097248f},
-std::array<float,2>{0.516371548f, 0.00666693226f},
-std::array<float,2>{0.817713201f, 0.59437418f},
-std::array<float,2>{0.381416142f, 0.180734277f},
-std::array<float,2>{0.0631633475f, 0.812259614f},
-std::array<float,2>{0.579233766f, 0.39727965f},
-std::array<float,2>{0.699157953f, 0.879760802f},
-std::array<float,2>{0.183774754f, 0.333368272f},
-std::array<float,2>{0.342958629f, 0.696841717f},
-std::array<float,2>{0.887976468f, 0.0633903369f},
-std::array<float,2>{0.549290717f, 0.645676315f},
-std::array<float,2>{0.0508142933f, 0.0613651238f},
-std::array<float,2>{0.465786427f, 0.943872929f},
-std::array<float,2>{0.807259798f, 0.276065677f},
-std::array<float,2>{0.957491994f, 0.813378334f},
-std::array<float,2>{0.300241679f, 0.463801116f},
-std::array<float,2>{0.23709096f, 0.530691743f},
-std::array<float,2>{0.655411482f, 0.194392607f},
-std::array<float,2>{0.992073834f, 0.504941046f},
-std::array<float,2>{0.274512529f, 0.207323089f},
-std::array<float,2>{0.21559149f, 0.835520267f},
-std::array<float,2>{0.683687389f, 0.442892045f},
-std::array<float,2>{0.506417036f, 0.95903796f},
-std::array<float,2>{0.00563831441f, 0.252756983f},
-std::array<float,2>{0.482278407f, 0.631412566f},
-std::array<float,2>{0.77498275f, 0.044291731f},
-std::array<float,2>{0.726594746f, 0.714084148f},
-std::array<float,2>{0.13339901f, 0.0867416933f},
-std::array<float,2>{0.348215491f, 0.898184597f},
-std::array<float,2>{0.916217744f, 0.322230607f},
-std::array<float,2>{0.860533118f, 0.788216293f},
-std::array<float,2>{0.431087732f, 0.384943575f},
-std::array<float,2>{0.107735425f, 0.612722516f},
-std::array<float,2>{0.617522836f, 0.168955848f},
-std::array<float,2>{0.792466402f, 0.666220665f},
-std::array<float,2>{0.451052755f, 0.0249878466f},
-std::array<float,2>{0.0390645228f, 0.974045217f},
-std::array<float,2>{0.537495732f, 0.284006119f},
-std::array<float,2>{0.638404071f, 0.864438236f},
-std::array<float,2>{0.223947182f, 0.49285537f},
-std::array<float,2>{0.293902934f, 0.558318675f},
-std::array<float,2>{0.946816981f, 0.239303038f},
-std::array<float,2>{0.572402954f, 0.570780575f},
-std::array<float,2>{0.088476494f, 0.128928587f},
-std::array<float,2>{0.3930085f, 0.752431631f},
-std::array<float,2>{0.833819389f, 0.421880543f},
-std::array<float,2>{0.89704448f, 0.907858014f},
-std::array<float,2>{0.319747269f, 0.347263187f},
-std::array<float,2>{0.157570958f, 0.747298062f},
-std::array<float,2>{0.703917563f, 0.123038031f},
-std::array<float,2>{0.980512619f, 0.703210175f},
-std::array<float,2>{0.259381771f, 0.0796299502f},
-std::array<float,2>{0.187688649f, 0.900972486f},
-std::array<float,2>{0.667316794f, 0.313848346f},
-std::array<float,2>{0.522437513f, 0.789437592f},
-std::array<float,2>{0.0270484462f, 0.382228523f},
-std::array<float,2>{0.498720735f, 0.618238688f},
-std::array<float,2>{0.752196372f, 0.156573027f},
-std::array<float,2>{0.746035993f, 0.513877809f},
-std::array<float,2>{0.151263654f, 0.21855247f},
-std::array<float,2>{0.373697788f, 0.836190999f},
-std::array<float,2>{0.930198431f, 0.446083486f},
-std::array<float,2>{0.849566877f, 0.968162537f},
-std::array<float,2>{0.418432802f, 0.262825429f},
-std::array<float,2>{0.115316145f, 0.633735895f},
-std::array<float,2>{0.59953618f, 0.0331290476f},
-std::array<float,2>{0.80908221f, 0.569558978f},
-std::array<float,2>{0.463340282f, 0.138093397f},
-std::array<float,2>{0.0486959927f, 0.761704326f},
-std::array<float,2>{0.553762972f, 0.437349349f},
-std::array<float,2>{0.648607373f, 0.914432883f},
-std::array<float,2>{0.238567472f, 0.3564125f},
-std::array<float,2>{0.303543597f, 0.739159405f},
-std::array<float,2>{0.955065489f, 0.111781105f},
-std::array<float,2>{0.582176566f, 0.657682955f},
-std::array<float,2>{0.0671296641f, 0.0187749695f},
-std::array<float,2>{0.377503604f, 0.976754844f},
-std::array<float,2>{0.814390063f, 0.293762714f},
-std::array<float,2>{0.884211004f, 0.873828769f},
-std::array<float,2>{0.337943226f, 0.49148652f},
-std::array<float,2>{0.180850402f, 0.548817039f},
-std::array<float,2>{0.701178253f, 0.24460803f},
-std::array<float,2>{0.918125927f, 0.543587804f},
-std::array<float,2>{0.34757334f, 0.226728633f},
-std::array<float,2>{0.139861271f, 0.844300389f},
-std::array<float,2>{0.730810046f, 0.474489957f},
-std::array<float,2>{0.624247611f, 0.989528835f},
-std::array<float,2>{0.103975698f, 0.306634873f},
-std::array<float,2>{0.436231285f, 0.680258691f},
-std::array<float,2>{0.865243256f, 0.00813555717f},
-std::array<float,2>{0.680632949f, 0.731698513f},
-std::array<float,2>{0.211163327f, 0.100624114f},
-std::array<float,2>{0.278934509f, 0.933581233f},
-std::array<float,2>{0.986294329f, 0.365583599f},
-std::array<float,2>{0.779319346f, 0.769543231f},
-std::array<float,2>{0.479589045f, 0.412605673f},
-std::array<float,2>{0.000477376307f, 0.578139544f},
-std::array<float,2>{0.503811181f, 0.151863769f},
-std::array<float,2>{0.830567598f, 0.649456501f},
-std::array<float,2>{0.395119935f, 0.0522146747f},
-std::array<float,2>{0.0900406837f, 0.946699917f},
-std::array<float,2>{0.577614844f, 0.26728338f},
-std::array<float,2>{0.708099425f, 0.821688473f},
-std::array<float,2>{0.163012549f, 0.459658086f},
-std::array<float,2>{0.315810531f, 0.518549204f},
-std::array<float,2>{0.891758978f, 0.199868053f},
-std::array<float,2>{0.53153491f, 0.603757381f},
-std::array<float,2>{0.0441399813f, 0.172005042f},
-std::array<float,2>{0.447155774f, 0.80314517f},
-std::array<float,2>{0.796398878f, 0.40546003f},
-std::array<float,2>{0.951356947f, 0.886111975f},
-std::array<float,2>{0.292431593f, 0.339073926f},
-std::array<float,2>{0.220252529f, 0.693666697f},
-std::array<float,2>{0.634045601f, 0.0728375837f},
-std::array<float,2>{0.900973678f, 0.672601402f},
-std::array<float,2>{0.321336091f, 0.00284246076f},
-std::array<float,2>{0.164509505f, 0.99681288f},
-std::array<float,2>{0.718481362f, 0.299261063f},
-std::array<float,2>{0.563688576f, 0.855813622f},
-std::array<float,2>{0.0838128924f, 0.478404135f},
-std::array<float,2>{0.400030613f, 0.532209396f},
-std::array<float,2>{0.838920593f, 0.223472044f},
-std::array<float,2>{0.626695156f, 0.592756152f},
-std::array<float,2>{0.230497375f, 0.143335253f},
-std::array<float,2>{0.286131024f, 0.780344725f},
-std::array<float,2>{0.938586533f, 0.419489115f},
-std::array<float,2>{0.784604609f, 0.922645152f},
-std::array<float,2>{0.443457872f, 0.372630745f},
-std::array<float,2>{0.0388428867f, 0.724339545f},
-std::array<float,2>{0.541971982f, 0.107659936f},
-std::array<float,2>{0.868980289f, 0.524999857f},
-std::array<float,2>{0.424048901f, 0.190081224f},
-std::array<float,2>{0.100042313f, 0.818795085f},
-std::array<float,2>{0.612795532f, 0.467437267f},
-std::array<float,2>{0.718990326f, 0.941329777f},
-std::array<float,2>{0.131804585f, 0.280880898f},
-std::array<float,2>{0.357889503f, 0.643744767f},
-std::array<float,2>{0.913741469f, 0.0550111495f},
-std::array<float,2>{0.508657634f, 0.700875282f},
-std::array<float,2>{0.00964858383f, 0.0693174303f},
-std::array<float,2>{0.476107746f, 0.876122057f},
-std::array<float,2>{0.773145914f, 0.328670859f},
-std::array<float,2>{0.99293226f, 0.805964053f},
-std::array<float,2>{0.270849973f, 0.39300555f},
-std::array<float,2>{0.206496552f, 0.600383878f},
-std::array<float,2>{0.67815727f, 0.186718926f},
-std::array<float,2>{0.967114925f, 0.616320372f},
-std::array<float,2>{0.309616953f, 0.167568758f},
-std::array<float,2>{0.242949367f, 0.783310533f},
-std::array<float,2>{0.646243572f, 0.387860715f},
-std::array<float,2>{0.561154723f, 0.893207669f},
-std::array<float,2>{0.0615852214f, 0.327073127f},
-std::array<float,2>{0.460757375f, 0.718292594f},
-std::array<float,2>{0.803898335f, 0.0916838199f},
-std::array<float,2>{0.693929791f, 0.626103699f},
-std::array<float,2>{0.172671512f, 0.0408437029f},
-std::array<float,2>{0.335012943f, 0.954039276f},
-std::array<float,2>{0.881237507f, 0.254300863f},
-std::array<float,2>{0.822693288f, 0.830266237f},
-std::array<float,2>{0.388600171f, 0.440661252f},
-std::array<float,2>{0.071610637f, 0.502559364f},
-std::array<float,2>{0.591925859f, 0.204155877f},
-std::array<float,2>{0.760994494f, 0.744782448f},
-std::array<float,2>{0.488803893f, 0.119398355f},
-std::array<float,2>{0.0215527602f, 0.911018908f},
-std::array<float,2>{0.530072451f, 0.349868029f},
-std::array<float,2>{0.656796157f, 0.755419195f},
-std::array<float,2>{0.198475823f, 0.429475814f},
-std::array<float,2>{0.250911593f, 0.578028858f},
-std::array<float,2>{0.974978805f, 0.126542225f},
-std::array<float,2>{0.602871299f, 0.560149074f},
-std::array<float,2>{0.124378495f, 0.236904904f},
-std::array<float,2>{0.406714082f, 0.860370398f},
-std::array<float,2>{0.858327389f, 0.49645865f},
-std::array<float,2>{0.926853061f, 0.969144523f},
-std::array<float,2>{0.361367375f, 0.287344277f},
-std::array<float,2>{0.142301798f, 0.669043124f},
-std::array<float,2>{0.739316463f, 0.0303709898f},
-std::array<float,2>{0.998661339f, 0.66071099f},
-std::array<float,2>{0.266607553f, 0.0219483916f},
-std::array<float,2>{0.207218319f, 0.983057141f},
-std::array<float,2>{0.672278702f, 0.290619254f},
-std::array<float,2>{0.511966169f, 0.869409025f},
-std::array<float,2>{0.012126036f, 0.485488802f},
-std::array<float,2>{0.470727444f, 0.551199794f},
-std::array<float,2>{0.765765846f, 0.248064697f},
-std::array<float,2>{0.725761533f, 0.562724829f},
-std::array<float,2>{0.126486927f, 0.135622174f},
-std::array<float,2>{0.351941079f, 0.761769176f},
-std::array<float,2>{0.909136772f, 0.433143854f},
-std::array<float,2>{0.873506606f, 0.920363665f},
-std::array<float,2>{0.42631048f, 0.353457838f},
-std::array<float,2>{0.0969733372f, 0.735757828f},
-std::array<float,2>{0.615208209f, 0.115451343f},
-std::array<float,2>{0.786743164f, 0.509732485f},
-std::array<float,2>{0.439888835f, 0.211931363f},
-std::array<float,2>{0.0341224261f, 0.840037346f},
-std::array<float,2>{0.545423567f, 0.451979756f},
-std::array<float,2>{0.631873369f, 0.96340704f},
-std::array<float,2>{0.228375062f, 0.260484725f},
-std::array<float,2>{0.283506811f, 0.638425231f},
-std::array<float,2>{0.94354409f, 0.0385797545f},
-std::array<float,2>{0.569983959f, 0.710601866f},
-std::array<float,2>{0.0804625303f, 0.085587278f},
-std::array<float,2>{0.404623061f, 0.904213667f},
-std::array<float,2>{0.840368867f, 0.318810672f},
-std::array<float,2>{0.902708232f, 0.794830322f},
-std::array<float,2>{0.327485859f, 0.377431124f},
-std::array<float,2>{0.171757251f, 0.622013569f},
-std::array<float,2>{0.713635683f, 0.163190037f},
-std::array<float,2>{0.922919869f, 0.606783807f},
-std::array<float,2>{0.363404632f, 0.178465381f},
-std::array<float,2>{0.146339655f, 0.79865849f},
-std::array<float,2>{0.734747648f, 0.400000304f},
-std::array<float,2>{0.607493937f, 0.890311241f},
-std::array<float,2>{0.120990813f, 0.341635942f},
-std::array<float,2>{0.410636216f, 0.688796282f},
-std::array<float,2>{0.853442073f, 0.0742280334f},
-std::array<float,2>{0.663620114f, 0.654295504f},
-std::array<float,2>{0.200150266f, 0.0502129644f},
-std::array<float,2>{0.254182398f, 0.951720774f},
-std::array<float,2>{0.969535232f, 0.271864295f},
-std::array<float,2>{0.762434244f, 0.824454427f},
-std::array<float,2>{0.484976888f, 0.455752164f},
-std::array<float,2>{0.0169567242f, 0.520710766f},
-std::array<float,2>{0.524260342f, 0.195987061f},
-std::array<float,2>{0.827205479f, 0.728656769f},
-std::array<float,2>{0.384689599f, 0.0976138711f},
-std::array<float,2>{0.0750966743f, 0.934059024f},
-std::array<float,2>{0.589247942f, 0.362038583f},
-std::array<float,2>{0.690405011f, 0.769216776f},
-std::array<float,2>{0.176104501f, 0.408784509f},
-std::array<float,2>{0.32960692f, 0.583948731f},
-std::array<float,2>{0.876545429f, 0.154895306f},
-std::array<float,2>{0.557197392f, 0.539589047f},
-std::array<float,2>{0.0562094636f, 0.23197405f},
-std::array<float,2>{0.456809044f, 0.851164341f},
-std::array<float,2>{0.799412847f, 0.469104975f},
-std::array<float,2>{0.964108586f, 0.98776114f},
-std::array<float,2>{0.307870418f, 0.309488863f},
-std::array<float,2>{0.248556837f, 0.683899462f},
-std::array<float,2>{0.641081929f, 0.0131451003f},
-std::array<float,2>{0.889039934f, 0.698574901f},
-std::array<float,2>{0.340367049f, 0.064514555f},
-std::array<float,2>{0.187050849f, 0.882302642f},
-std::array<float,2>{0.696371257f, 0.334839642f},
-std::array<float,2>{0.580780268f, 0.809492171f},
-std::array<float,2>{0.0652230382f, 0.395679444f},
-std::array<float,2>{0.379163712f, 0.59605056f},
-std::array<float,2>{0.818445921f, 0.18232435f},
-std::array<float,2>{0.653580129f, 0.5288679f},
-std::array<float,2>{0.235634372f, 0.193177208f},
-std::array<float,2>{0.297088921f, 0.814523518f},
-std::array<float,2>{0.959282696f, 0.461096436f},
-std::array<float,2>{0.805979013f, 0.941606522f},
-std::array<float,2>{0.46702373f, 0.273898065f},
-std::array<float,2>{0.0536343604f, 0.64720732f},
-std::array<float,2>{0.548567057f, 0.058641769f},
-std::array<float,2>{0.84538132f, 0.587030709f},
-std::array<float,2>{0.416327685f, 0.146749035f},
-std::array<float,2>{0.110324569f, 0.774917185f},
-std::array<float,2>{0.595520318f, 0.414476782f},
-std::array<float,2>{0.747457862f, 0.929108143f},
-std::array<float,2>{0.152973354f, 0.368493587f},
-std::array<float,2>{0.370668948f, 0.721056163f},
-std::array<float,2>{0.935170174f, 0.105414398f},
-std::array<float,2>{0.518626153f, 0.676950574f},
-std::array<float,2>{0.0275827385f, 0.0052288021f},
-std::array<float,2>{0.495914549f, 0.994170785f},
-std::array<float,2>{0.757525146f, 0.302243531f},
-std::array<float,2>{0.977826357f, 0.854057133f},
-std::array<float,2>{0.263393283f, 0.481357455f},
-std::array<float,2>{0.19247748f, 0.536340356f},
-std::array<float,2>{0.669853926f, 0.221065179f},
-std::array<float,2>{0.948652565f, 0.555859149f},
-std::array<float,2>{0.295460254f, 0.240880579f},
-std::array<float,2>{0.226526067f, 0.865650177f},
-std::array<float,2>{0.640213072f, 0.495558977f},
-std::array<float,2>{0.535800934f, 0.974752128f},
-std::array<float,2>{0.0421785526f, 0.281539828f},
-std::array<float,2>{0.452010095f, 0.665157914f},
-std::array<float,2>{0.789648235f, 0.0258006472f},
-std::array<float,2>{0.706327736f, 0.749639213f},
-std::array<float,2>{0.160131946f, 0.124606542f},
-std::array<float,2>{0.318341136f, 0.90852809f},
-std::array<float,2>{0.896045566f, 0.34443599f},
-std::array<float,2>{0.834997177f, 0.75073421f},
-std::array<float,2>{0.392540306f, 0.424409866f},
-std::array<float,2>{0.0868818164f, 0.572508752f},
-std::array<float,2>{0.570977807f, 0.131408244f},
-std::array<float,2>{0.776428103f, 0.630435228f},
-std::array<float,2>{0.482737929f, 0.0459059179f},
-std::array<float,2>{0.00634123338f, 0.958555996f},
-std::array<float,2>{0.505815506f, 0.251155078f},
-std::array<float,2>{0.687221467f, 0.832980514f},
-std::array<float,2>{0.217743397f, 0.444004804f},
-std::array<float,2>{0.276815027f, 0.506817758f},
-std::array<float,2>{0.98830682f, 0.210772783f},
-std::array<float,2>{0.620125234f, 0.610847533f},
-std::array<float,2>{0.106052868f, 0.170143455f},
-std::array<float,2>{0.433025777f, 0.786101222f},
-std::array<float,2>{0.862502992f, 0.384395212f},
-std::array<float,2>{0.914152563f, 0.896159351f},
-std::array<float,2>{0.350753367f, 0.322874904f},
-std::array<float,2>{0.135204598f, 0.711854339f},
-std::array<float,2>{0.72976321f, 0.0892994776f},
-std::array<float,2>{0.956638575f, 0.741859674f},
-std::array<float,2>{0.301538527f, 0.111286707f},
-std::array<float,2>{0.241155297f, 0.916427016f},
-std::array<float,2>{0.651897728f, 0.357604623f},
-std::array<float,2>{0.551655054f, 0.758261502f},
-std::array<float,2>{0.0506273471f, 0.435523063f},
-std::array<float,2>{0.461540431f, 0.567924857f},
-std::array<float,2>{0.812303543f, 0.139338002f},
-std::array<float,2>{0.700413942f, 0.550723851f},
-std::array<float,2>{0.182308987f, 0.242246404f},
-std::array<float,2>{0.337051004f, 0.871489942f},
-std::array<float,2>{0.885255337f, 0.488921374f},
-std::array<float,2>{0.814894974f, 0.97935462f},
-std::array<float,2>{0.375943005f, 0.296004802f},
-std::array<float,2>{0.0699836314f, 0.659130573f},
-std::array<float,2>{0.585542083f, 0.0162446108f},
-std::array<float,2>{0.750107884f, 0.619539976f},
-std::array<float,2>{0.497987539f, 0.158360884f},
-std::array<float,2>{0.0242954083f, 0.792456925f},
-std::array<float,2>{0.521103859f, 0.379506499f},
-std::array<float,2>{0.665765405f, 0.899994791f},
-std::array<float,2>{0.190528631f, 0.315897703f},
-std::array<float,2>{0.261581481f, 0.705438077f},
-std::array<float,2>{0.98292625f, 0.0811810642f},
-std::array<float,2>{0.601359427f, 0.635374367f},
-std::array<float,2>{0.115024351f, 0.0343573727f},
-std::array<float,2>{0.420599401f, 0.966427982f},
-std::array<float,2>{0.850571513f, 0.265393049f},
-std::array<float,2>{0.933469176f, 0.839316368f},
-std::array<float,2>{0.371822476f, 0.447777718f},
-std::array<float,2>{0.149117082f, 0.512471497f},
-std::array<float,2>{0.743847191f, 0.216176867f},
-std::array<float,2>{0.894368231f, 0.515768886f},
-std::array<float,2>{0.312929809f, 0.202523217f},
-std::array<float,2>{0.16046837f, 0.82346797f},
-std::array<float,2>{0.709019661f, 0.457238317f},
-std::array<float,2>{0.575869083f, 0.948806882f},
-std::array<float,2>{0.0932651013f, 0.268603593f},
-std::array<float,2>{0.396949589f, 0.652161062f},
-std::array<float,2>{0.830042899f, 0.0535423495f},
-std::array<float,2>{0.636614084f, 0.692964315f},
-std::array<float,2>{0.220815241f, 0.0713202879f},
-std::array<float,2>{0.289463073f, 0.883448601f},
-std::array<float,2>{0.950742602f, 0.336940646f},
-std::array<float,2>{0.794062793f, 0.802687407f},
-std::array<float,2>{0.447626472f, 0.404087305f},
-std::array<float,2>{0.0460790284f, 0.602698088f},
-std::array<float,2>{0.534719765f, 0.174390629f},
-std::array<float,2>{0.864680827f, 0.682824492f},
-std::array<float,2>{0.434180886f, 0.0116236256f},
-std::array<float,2>{0.103407614f, 0.992172897f},
-std::array<float,2>{0.622458458f, 0.308027953f},
-std::array<float,2>{0.73288101f, 0.847223401f},
-std::array<float,2>{0.13751848f, 0.475764573f},
-std::array<float,2>{0.343805313f, 0.54686588f},
-std::array<float,2>{0.921854436f, 0.230287343f},
-std::array<float,2>{0.501478434f, 0.581276059f},
-std::array<float,2>{0.00318974024f, 0.149050966f},
-std::array<float,2>{0.47667864f, 0.772091568f},
-std::array<float,2>{0.778742671f, 0.411960751f},
-std::array<float,2>{0.988161802f, 0.930760324f},
-std::array<float,2>{0.279310137f, 0.363629073f},
-std::array<float,2>{0.214230269f, 0.733768344f},
-std::array<float,2>{0.682587624f, 0.0988518f},
-std::array<float,2>{0.910600781f, 0.641681194f},
-std::array<float,2>{0.355495036f, 0.0581403449f},
-std::array<float,2>{0.129453719f, 0.938546896f},
-std::array<float,2>{0.722170293f, 0.278681278f},
-std::array<float,2>{0.61060226f, 0.816644371f},
-std::array<float,2>{0.0994970873f, 0.464951724f},
-std::array<float,2>{0.423703611f, 0.526657641f},
-std::array<float,2>{0.869803548f, 0.188538387f},
-std::array<float,2>{0.67729038f, 0.597658753f},
-std::array<float,2>{0.20471257f, 0.184224397f},
-std::array<float,2>{0.272906393f, 0.806740761f},
-std::array<float,2>{0.994750917f, 0.392013818f},
-std::array<float,2>{0.770782053f, 0.877772987f},
-std::array<float,2>{0.472797126f, 0.330665499f},
-std::array<float,2>{0.010799543f, 0.701938629f},
-std::array<float,2>{0.509842813f, 0.0665241033f},
-std::array<float,2>{0.837555408f, 0.535051882f},
-std::array<float,2>{0.400948733f, 0.225066587f},
-std::array<float,2>{0.0858367011f, 0.859360754f},
-std::array<float,2>{0.565238476f, 0.478803039f},
-std::array<float,2>{0.715729892f, 0.998600066f},
-std::array<float,2>{0.166980118f, 0.298290223f},
-std::array<float,2>{0.322954625f, 0.675004244f},
-std::array<float,2>{0.899884343f, 0.000183426426f},
-std::array<float,2>{0.54043591f, 0.725900352f},
-std::array<float,2>{0.0360705815f, 0.106972583f},
-std::array<float,2>{0.441961139f, 0.925236106f},
-std::array<float,2>{0.782387614f, 0.374109119f},
-std::array<float,2>{0.940147996f, 0.778755724f},
-std::array<float,2>{0.289054692f, 0.420947254f},
-std::array<float,2>{0.233898148f, 0.591029465f},
-std::array<float,2>{0.628123045f, 0.141769588f},
-std::array<float,2>{0.974584222f, 0.574720204f},
-std::array<float,2>{0.253578156f, 0.127321213f},
-std::array<float,2>{0.196040675f, 0.755980253f},
-std::array<float,2>{0.659503639f, 0.425975829f},
-std::array<float,2>{0.529210925f, 0.913533866f},
-std::array<float,2>{0.0212031994f, 0.34859243f},
-std::array<float,2>{0.491899639f, 0.744041562f},
-std::array<float,2>{0.758380115f, 0.118515678f},
-std::array<float,2>{0.741204619f, 0.671028614f},
-std::array<float,2>{0.143081412f, 0.0283087417f},
-std::array<float,2>{0.36016503f, 0.971969426f},
-std::array<float,2>{0.928575337f, 0.286556482f},
-std::array<float,2>{0.855641663f, 0.863124728f},
-std::array<float,2>{0.409033239f, 0.499581397f},
-std::array<float,2>{0.121734053f, 0.56190145f},
-std::array<float,2>{0.604762793f, 0.234759122f},
-std::array<float,2>{0.80086565f, 0.716528356f},
-std::array<float,2>{0.457944602f, 0.0929864794f},
-std::array<float,2>{0.060249377f, 0.892255664f},
-std::array<float,2>{0.560373068f, 0.325075924f},
-std::array<float,2>{0.647508025f, 0.781462073f},
-std::array<float,2>{0.244190112f, 0.388932049f},
-std::array<float,2>{0.310699522f, 0.613999784f},
-std::array<float,2>{0.965165436f, 0.165432885f},
-std::array<float,2>{0.590176761f, 0.500698626f},
-std::array<float,2>{0.0735453516f, 0.2057807f},
-std::array<float,2>{0.389436662f, 0.829333067f},
-std::array<float,2>{0.820687294f, 0.439207464f},
-std::array<float,2>{0.880414724f, 0.955612183f},
-std::array<float,2>{0.33268407f, 0.25776881f},
-std::array<float,2>{0.175698876f, 0.627987921f},
-std::array<float,2>{0.692501247f, 0.0424192399f},
-std::array<float,2>{0.969949305f, 0.654789746f},
-std::array<float,2>{0.25570932f, 0.0468836129f},
-std::array<float,2>{0.200949326f, 0.949569345f},
-std::array<float,2>{0.662223339f, 0.270577669f},
-std::array<float,2>{0.524997711f, 0.826939583f},
-std::array<float,2>{0.0162337366f, 0.45359692f},
-std::array<float,2>{0.485982716f, 0.52251786f},
-std::array<float,2>{0.762932181f, 0.198007524f},
-std::array<float,2>{0.735870242f, 0.607914805f},
-std::array<float,2>{0.145107463f, 0.177069485f},
-std::array<float,2>{0.364863545f, 0.798870683f},
-std::array<float,2>{0.922068536f, 0.401771277f},
-std::array<float,2>{0.852133214f, 0.887558579f},
-std::array<float,2>{0.411181062f, 0.343395412f},
-std::array<float,2>{0.119209103f, 0.690765142f},
-std::array<float,2>{0.609319091f, 0.0766090602f},
-std::array<float,2>{0.79982096f, 0.542346597f},
-std::array<float,2>{0.455084234f, 0.234295681f},
-std::array<float,2>{0.0549767613f, 0.84777683f},
-std::array<float,2>{0.557873011f, 0.472137004f},
-std::array<float,2>{0.641671538f, 0.984873235f},
-std::array<float,2>{0.249131307f, 0.311382473f},
-std::array<float,2>{0.306695104f, 0.686445296f},
-std::array<float,2>{0.963681519f, 0.0137002254f},
-std::array<float,2>{0.588228583f, 0.728261948f},
-std::array<float,2>{0.0760366172f, 0.0954473019f},
-std::array<float,2>{0.383563489f, 0.935941994f},
-std::array<float,2>{0.827062786f, 0.361000955f},
-std::array<float,2>{0.87596941f, 0.766410649f},
-std::array<float,2>{0.328520864f, 0.408066452f},
-std::array<float,2>{0.177689284f, 0.585867524f},
-std::array<float,2>{0.691343248f, 0.152410865f},
-std::array<float,2>{0.909816682f, 0.564752281f},
-std::array<float,2>{0.352859437f, 0.133325443f},
-std::array<float,2>{0.125779986f, 0.764488757f},
-std::array<float,2>{0.725280344f, 0.430569351f},
-std::array<float,2>{0.613611758f, 0.918612242f},
-std::array<float,2>{0.0957419053f, 0.354780406f},
-std::array<float,2>{0.426860034f, 0.738169849f},
-std::array<float,2>{0.874629021f, 0.11426878f},
-std::array<float,2>{0.673419774f, 0.662634969f},
-std::array<float,2>{0.208647683f, 0.0210626237f},
-std::array<float,2>{0.26609835f, 0.981922984f},
-std::array<float,2>{0.99972105f, 0.291708887f},
-std::array<float,2>{0.766665101f, 0.868380427f},
-std::array<float,2>{0.472172797f, 0.487804592f},
-std::array<float,2>{0.0136112375f, 0.5541628f},
-std::array<float,2>{0.51285398f, 0.24694097f},
-std::array<float,2>{0.841787636f, 0.708115518f},
-std::array<float,2>{0.405707151f, 0.0825410411f},
-std::array<float,2>{0.0818690285f, 0.905453265f},
-std::array<float,2>{0.56859678f, 0.3179515f},
-std::array<float,2>{0.714445174f, 0.795332909f},
-std::array<float,2>{0.170858949f, 0.375189304f},
-std::array<float,2>{0.326508611f, 0.623930097f},
-std::array<float,2>{0.903610587f, 0.161377281f},
-std::array<float,2>{0.54633379f, 0.510531783f},
-std::array<float,2>{0.0342551209f, 0.213699192f},
-std::array<float,2>{0.440687001f, 0.842859805f},
-std::array<float,2>{0.785311818f, 0.449243575f},
-std::array<float,2>{0.94486165f, 0.962879539f},
-std::array<float,2>{0.284187019f, 0.258574694f},
-std::array<float,2>{0.22741802f, 0.640411615f},
-std::array<float,2>{0.631157935f, 0.036104463f},
-std::array<float,2>{0.894642949f, 0.746780396f},
-std::array<float,2>{0.317087501f, 0.121213444f},
-std::array<float,2>{0.158720538f, 0.906298041f},
-std::array<float,2>{0.705976486f, 0.345763534f},
-std::array<float,2>{0.572039604f, 0.752957463f},
-std::array<float,2>{0.0878767222f, 0.423155278f},
-std::array<float,2>{0.390718907f, 0.571719646f},
-std::array<float,2>{0.834816694f, 0.130262047f},
-std::array<float,2>{0.639034867f, 0.556949854f},
-std::array<float,2>{0.225478768f, 0.239030421f},
-std::array<float,2>{0.296174794f, 0.864208996f},
-std::array<float,2>{0.947380304f, 0.493436396f},
-std::array<float,2>{0.790521026f, 0.973496437f},
-std::array<float,2>{0.452435285f, 0.28509286f},
-std::array<float,2>{0.0411395021f, 0.667471647f},
-std::array<float,2>{0.536518455f, 0.0243456345f},
-std::array<float,2>{0.86217612f, 0.611857176f},
-std::array<float,2>{0.432253242f, 0.168312967f},
-std::array<float,2>{0.107128456f, 0.787926137f},
-std::array<float,2>{0.619977832f, 0.386111051f},
-std::array<float,2>{0.728717089f, 0.89699173f},
-std::array<float,2>{0.136701539f, 0.320406646f},
-std::array<float,2>{0.350064695f, 0.713422298f},
-std::array<float,2>{0.915676832f, 0.0869309753f},
-std::array<float,2>{0.503994405f, 0.632784784f},
-std::array<float,2>{0.00773867266f, 0.0434772111f},
-std::array<float,2>{0.483711869f, 0.960514903f},
-std::array<float,2>{0.776163399f, 0.253182143f},
-std::array<float,2>{0.989613116f, 0.834852636f},
-std::array<float,2>{0.275653124f, 0.441714197f},
-std::array<float,2>{0.218643501f, 0.504418492f},
-std::array<float,2>{0.686377525f, 0.208912805f},
-std::array<float,2>{0.959996462f, 0.530271113f},
-std::array<float,2>{0.298654437f, 0.194106579f},
-std::array<float,2>{0.234554291f, 0.813777387f},
-std::array<float,2>{0.653067648f, 0.46455285f},
-std::array<float,2>{0.547188401f, 0.944374084f},
-std::array<float,2>{0.0538527928f, 0.277084649f},
-std::array<float,2>{0.467915833f, 0.645071924f},
-std::array<float,2>{0.804700494f, 0.0619444028f},
-std::array<float,2>{0.695787251f, 0.695441723f},
-std::array<float,2>{0.186243013f, 0.0638297349f},
-std::array<float,2>{0.341127872f, 0.880027533f},
-std::array<float,2>{0.890272141f, 0.332939386f},
-std::array<float,2>{0.819513321f, 0.811074078f},
-std::array<float,2>{0.380572051f, 0.397549659f},
-std::array<float,2>{0.0659888312f, 0.59510082f},
-std::array<float,2>{0.58110261f, 0.180200785f},
-std::array<float,2>{0.756552517f, 0.679150462f},
-std::array<float,2>{0.494920045f, 0.00767940236f},
-std::array<float,2>{0.0289898645f, 0.993822098f},
-std::array<float,2>{0.518343806f, 0.303539395f},
-std::array<float,2>{0.668682873f, 0.852323711f},
-std::array<float,2>{0.191927612f, 0.483684629f},
-std::array<float,2>{0.262304902f, 0.538435698f},
-std::array<float,2>{0.97705406f, 0.220140666f},
-std::array<float,2>{0.594342768f, 0.589630604f},
-std::array<float,2>{0.110760607f, 0.146187007f},
-std::array<float,2>{0.417874962f, 0.775949657f},
-std::array<float,2>{0.84449774f, 0.41712904f},
-std::array<float,2>{0.93367064f, 0.927711904f},
-std::array<float,2>{0.369810522f, 0.370654613f},
-std::array<float,2>{0.153646365f, 0.719145417f},
-std::array<float,2>{0.746353388f, 0.101884857f},
-std::array<float,2>{0.949381471f, 0.694558203f},
-std::array<float,2>{0.290299505f, 0.073345013f},
-std::array<float,2>{0.222227916f, 0.885494709f},
-std::array<float,2>{0.634957135f, 0.338824987f},
-std::array<float,2>{0.533782184f, 0.804437995f},
-std::array<float,2>{0.0452781916f, 0.404305518f},
-std::array<float,2>{0.448877096f, 0.604527771f},
-std::array<float,2>{0.793150723f, 0.173815712f},
-std::array<float,2>{0.710209668f, 0.518761516f},
-std::array<float,2>{0.161581308f, 0.200859547f},
-std::array<float,2>{0.314364314f, 0.820703804f},
-std::array<float,2>{0.893027604f, 0.460462064f},
-std::array<float,2>{0.828480422f, 0.945336998f},
-std::array<float,2>{0.39763841f, 0.266348004f},
-std::array<float,2>{0.0923242643f, 0.648954093f},
-std::array<float,2>{0.574262977f, 0.0512533635f},
-std::array<float,2>{0.777708828f, 0.57922858f},
-std::array<float,2>{0.477955043f, 0.151022002f},
-std::array<float,2>{0.00213260227f, 0.770556629f},
-std::array<float,2>{0.500186205f, 0.413671851f},
-std::array<float,2>{0.683358371f, 0.931664169f},
-std::array<float,2>{0.213282585f, 0.366593719f},
-std::array<float,2>{0.280307263f, 0.731153667f},
-std::array<float,2>{0.986578882f, 0.100231439f},
-std::array<float,2>{0.621682107f, 0.680896819f},
-std::array<float,2>{0.102141052f, 0.00923787709f},
-std::array<float,2>{0.435115725f, 0.988496721f},
-std::array<float,2>{0.863704622f, 0.304993361f},
-std::array<float,2>{0.920889139f, 0.845197082f},
-std::array<float,2>{0.345398068f, 0.473591119f},
-std::array<float,2>{0.138274327f, 0.544299006f},
-std::array<float,2>{0.733709097f, 0.227551892f},
-std::array<float,2>{0.886093438f, 0.547590375f},
-std::array<float,2>{0.336438388f, 0.245935917f},
-std::array<float,2>{0.182937041f, 0.874592841f},
-std::array<float,2>{0.699954629f, 0.490476727f},
-std::array<float,2>{0.584819555f, 0.977932513f},
-std::array<float,2>{0.0687276423f, 0.294603288f},
-std::array<float,2>{0.376279593f, 0.656269908f},
-std::array<float,2>{0.81595397f, 0.0177179258f},
-std::array<float,2>{0.650681555f, 0.739409983f},
-std::array<float,2>{0.241940111f, 0.112859994f},
-std::array<float,2>{0.302576333f, 0.915388942f},
-std::array<float,2>{0.95518136f, 0.357146978f},
-std::array<float,2>{0.811419964f, 0.760264695f},
-std::array<float,2>{0.462468117f, 0.436001092f},
-std::array<float,2>{0.0493983962f, 0.568660676f},
-std::array<float,2>{0.552575171f, 0.137612075f},
-std::array<float,2>{0.850969613f, 0.634439111f},
-std::array<float,2>{0.421688527f, 0.0321895145f},
-std::array<float,2>{0.114011765f, 0.967159331f},
-std::array<float,2>{0.599673629f, 0.262571126f},
-std::array<float,2>{0.742241204f, 0.837557733f},
-std::array<float,2>{0.14978236f, 0.44633618f},
-std::array<float,2>{0.372623116f, 0.515539587f},
-std::array<float,2>{0.932386816f, 0.217448249f},
-std::array<float,2>{0.519696653f, 0.617316544f},
-std::array<float,2>{0.0248960201f, 0.158075139f},
-std::array<float,2>{0.496551305f, 0.791015267f},
-std::array<float,2>{0.750997484f, 0.381559223f},
-std::array<float,2>{0.984015226f, 0.901389182f},
-std::array<float,2>{0.260352522f, 0.312522262f},
-std::array<float,2>{0.190419346f, 0.704833984f},
-std::array<float,2>{0.664638996f, 0.0787861496f},
-std::array<float,2>{0.929122865f, 0.668169618f},
-std::array<float,2>{0.360468745f, 0.0300384667f},
-std::array<float,2>{0.144529998f, 0.970164597f},
-std::array<float,2>{0.741629601f, 0.288756847f},
-std::array<float,2>{0.604354143f, 0.859720051f},
-std::array<float,2>{0.122617923f, 0.497460723f},
-std::array<float,2>{0.40995276f, 0.558785975f},
-std::array<float,2>{0.857395411f, 0.23777993f},
-std::array<float,2>{0.659136951f, 0.576399982f},
-std::array<float,2>{0.196427941f, 0.125171378f},
-std::array<float,2>{0.252789557f, 0.754711807f},
-std::array<float,2>{0.97304213f, 0.428471327f},
-std::array<float,2>{0.759064674f, 0.911633551f},
-std::array<float,2>{0.490747869f, 0.351213515f},
-std::array<float,2>{0.0197583996f, 0.74569571f},
-std::array<float,2>{0.5282377f, 0.120539501f},
-std::array<float,2>{0.822013557f, 0.503505349f},
-std::array<float,2>{0.390348047f, 0.203184098f},
-std::array<float,2>{0.0723914355f, 0.831206322f},
-std::array<float,2>{0.590922773f, 0.439913303f},
-std::array<float,2>{0.692149341f, 0.955037534f},
-std::array<float,2>{0.174738392f, 0.255628914f},
-std::array<float,2>{0.333473295f, 0.625404179f},
-std::array<float,2>{0.879071295f, 0.040038377f},
-std::array<float,2>{0.559533298f, 0.716923952f},
-std::array<float,2>{0.0589201972f, 0.0900634676f},
-std::array<float,2>{0.458353639f, 0.894194484f},
-std::array<float,2>{0.80232954f, 0.327906787f},
-std::array<float,2>{0.96672821f, 0.784791291f},
-std::array<float,2>{0.31229949f, 0.387021691f},
-std::array<float,2>{0.245969847f, 0.616070211f},
-std::array<float,2>{0.64685899f, 0.166308329f},
-std::array<float,2>{0.995584011f, 0.601306617f},
-std::array<float,2>{0.272022426f, 0.186058223f},
-std::array<float,2>{0.204017997f, 0.805534899f},
-std::array<float,2>{0.675797224f, 0.394082129f},
-std::array<float,2>{0.510958374f, 0.875276387f},
-std::array<float,2>{0.0102653569f, 0.329935253f},
-std::array<float,2>{0.4739317f, 0.699491322f},
-std::array<float,2>{0.77009052f, 0.0694310963f},
-std::array<float,2>{0.721589565f, 0.642798662f},
-std::array<float,2>{0.130834207f, 0.05568422f},
-std::array<float,2>{0.35654816f, 0.939894319f},
-std::array<float,2>{0.912039399f, 0.27957955f},
-std::array<float,2>{0.870144546f, 0.819479287f},
-std::array<float,2>{0.422427505f, 0.468181163f},
-std::array<float,2>{0.0981998369f, 0.524182796f},
-std::array<float,2>{0.609510183f, 0.190831065f},
-std::array<float,2>{0.781729639f, 0.722874105f},
-std::array<float,2>{0.443334609f, 0.108941153f},
-std::array<float,2>{0.0370832533f, 0.92371279f},
-std::array<float,2>{0.539346337f, 0.371548176f},
-std::array<float,2>{0.627878606f, 0.779391408f},
-std::array<float,2>{0.233256727f, 0.417995006f},
-std::array<float,2>{0.287241191f, 0.593420744f},
-std::array<float,2>{0.941039145f, 0.143805593f},
-std::array<float,2>{0.566075027f, 0.532298863f},
-std::array<float,2>{0.084756732f, 0.224487722f},
-std::array<float,2>{0.402220726f, 0.857200563f},
-std::array<float,2>{0.836080313f, 0.476949543f},
-std::array<float,2>{0.899204612f, 0.997336388f},
-std::array<float,2>{0.324075729f, 0.30057165f},
-std::array<float,2>{0.167831361f, 0.673823893f},
-std::array<float,2>{0.716366172f, 0.003063743f},
-std::array<float,2>{0.961850286f, 0.685069203f},
-std::array<float,2>{0.306439847f, 0.0126376189f},
-std::array<float,2>{0.247023478f, 0.986562908f},
-std::array<float,2>{0.644122005f, 0.310202926f},
-std::array<float,2>{0.554706156f, 0.850231767f},
-std::array<float,2>{0.0570043586f, 0.469990313f},
-std::array<float,2>{0.45332101f, 0.540922105f},
-std::array<float,2>{0.797883511f, 0.230917886f},
-std::array<float,2>{0.689404309f, 0.582801104f},
-std::array<float,2>{0.178051382f, 0.155990109f},
-std::array<float,2>{0.33032164f, 0.768201768f},
-std::array<float,2>{0.877514601f, 0.40980047f},
-std::array<float,2>{0.82543987f, 0.935188174f},
-std::array<float,2>{0.38615036f, 0.362719923f},
-std::array<float,2>{0.0776512176f, 0.729853749f},
-std::array<float,2>{0.587136269f, 0.0964398161f},
-std::array<float,2>{0.76487118f, 0.519919813f},
-std::array<float,2>{0.48642382f, 0.196816772f},
-std::array<float,2>{0.0186681487f, 0.826043308f},
-std::array<float,2>{0.526749492f, 0.456382483f},
-std::array<float,2>{0.661823094f, 0.953093469f},
-std::array<float,2>{0.202356994f, 0.272699088f},
-std::array<float,2>{0.257705837f, 0.653044641f},
-std::array<float,2>{0.972198546f, 0.0491367243f},
-std::array<float,2>{0.607212782f, 0.687542737f},
-std::array<float,2>{0.117675625f, 0.0753072351f},
-std::array<float,2>{0.412763625f, 0.889240384f},
-std::array<float,2>{0.855237901f, 0.340628654f},
-std::array<float,2>{0.923899114f, 0.79704082f},
-std::array<float,2>{0.36578387f, 0.399304062f},
-std::array<float,2>{0.147079974f, 0.606020391f},
-std::array<float,2>{0.738038719f, 0.179145649f},
-std::array<float,2>{0.906202018f, 0.622730017f},
-std::array<float,2>{0.325030833f, 0.162573725f},
-std::array<float,2>{0.169162586f, 0.793603063f},
-std::array<float,2>{0.712548554f, 0.377975464f},
-std::array<float,2>{0.566537619f, 0.902926505f},
-std::array<float,2>{0.0787907392f, 0.319907755f},
-std::array<float,2>{0.403135508f, 0.70906055f},
-std::array<float,2>{0.843747258f, 0.0844537243f},
-std::array<float,2>{0.630843282f, 0.637458146f},
-std::array<float,2>{0.229706138f, 0.0376444273f},
-std::array<float,2>{0.282598108f, 0.964615047f},
-std::array<float,2>{0.941917956f, 0.260848314f},
-std::array<float,2>{0.788283706f, 0.841500223f},
-std::array<float,2>{0.438741505f, 0.452904403f},
-std::array<float,2>{0.0329925418f, 0.507960379f},
-std::array<float,2>{0.544425607f, 0.21150285f},
-std::array<float,2>{0.872200787f, 0.734749138f},
-std::array<float,2>{0.428583056f, 0.116712332f},
-std::array<float,2>{0.0939440578f, 0.920901835f},
-std::array<float,2>{0.616525948f, 0.351573437f},
-std::array<float,2>{0.724245906f, 0.762924075f},
-std::array<float,2>{0.127419069f, 0.432246625f},
-std::array<float,2>{0.355314821f, 0.564028382f},
-std::array<float,2>{0.908067167f, 0.136314496f},
-std::array<float,2>{0.514718711f, 0.552135229f},
-std::array<float,2>{0.0154512087f, 0.249089107f},
-std::array<float,2>{0.469873726f, 0.870807171f},
-std::array<float,2>{0.768744707f, 0.485290319f},
-std::array<float,2>{0.997221112f, 0.98436451f},
-std::array<float,2>{0.268609822f, 0.289086848f},
-std::array<float,2>{0.210726812f, 0.662024438f},
-std::array<float,2>{0.674721897f, 0.0225143004f},
-std::array<float,2>{0.917464256f, 0.71223104f},
-std::array<float,2>{0.349252522f, 0.0884972662f},
-std::array<float,2>{0.134272262f, 0.894930243f},
-std::array<float,2>{0.727828741f, 0.323943704f},
-std::array<float,2>{0.618529141f, 0.786935806f},
-std::array<float,2>{0.108885325f, 0.38370344f},
-std::array<float,2>{0.430264026f, 0.610081673f},
-std::array<float,2>{0.859443665f, 0.171755254f},
-std::array<float,2>{0.685451984f, 0.507708728f},
-std::array<float,2>{0.216510549f, 0.209056482f},
-std::array<float,2>{0.27372995f, 0.833135664f},
-std::array<float,2>{0.991082788f, 0.444624335f},
-std::array<float,2>{0.774410665f, 0.957899868f},
-std::array<float,2>{0.480804741f, 0.250099421f},
-std::array<float,2>{0.00399391726f, 0.629701972f},
-std::array<float,2>{0.507775664f, 0.0452791937f},
-std::array<float,2>{0.832233012f, 0.573546827f},
-std::array<float,2>{0.394137233f, 0.132378951f},
-std::array<float,2>{0.089202337f, 0.751935601f},
-std::array<float,2>{0.574144065f, 0.424972534f},
-std::array<float,2>{0.70478493f, 0.909318984f},
-std::array<float,2>{0.157150254f, 0.34520939f},
-std::array<float,2>{0.319207489f, 0.748159051f},
-std::array<float,2>{0.897962332f, 0.123112515f},
-std::array<float,2>{0.538848996f, 0.664097369f},
-std::array<float,2>{0.0407732986f, 0.0265944283f},
-std::array<float,2>{0.449549586f, 0.976241469f},
-std::array<float,2>{0.791078925f, 0.282934368f},
-std::array<float,2>{0.946052611f, 0.866255462f},
-std::array<float,2>{0.294696212f, 0.495080173f},
-std::array<float,2>{0.22346729f, 0.554691732f},
-std::array<float,2>{0.637607872f, 0.241710469f},
-std::array<float,2>{0.978634059f, 0.535256445f},
-std::array<float,2>{0.263796836f, 0.222323358f},
-std::array<float,2>{0.195027411f, 0.854811251f},
-std::array<float,2>{0.670262337f, 0.481451124f},
-std::array<float,2>{0.516682446f, 0.995869577f},
-std::array<float,2>{0.0310890842f, 0.30119127f},
-std::array<float,2>{0.492516816f, 0.676554084f},
-std::array<float,2>{0.755838692f, 0.00467396574f},
-std::array<float,2>{0.749663115f, 0.722066998f},
-std::array<float,2>{0.155660138f, 0.103909679f},
-std::array<float,2>{0.36755681f, 0.928133249f},
-std::array<float,2>{0.936560988f, 0.367903322f},
-std::array<float,2>{0.84605521f, 0.774028063f},
-std::array<float,2>{0.415185481f, 0.415350109f},
-std::array<float,2>{0.112796083f, 0.586372256f},
-std::array<float,2>{0.597120404f, 0.148137569f},
-std::array<float,2>{0.807693005f, 0.648423672f},
-std::array<float,2>{0.466338992f, 0.0604754463f},
-std::array<float,2>{0.0520506799f, 0.942908287f},
-std::array<float,2>{0.54988265f, 0.275122046f},
-std::array<float,2>{0.654726982f, 0.816124082f},
-std::array<float,2>{0.237850949f, 0.462856978f},
-std::array<float,2>{0.299264997f, 0.527406812f},
-std::array<float,2>{0.958093107f, 0.192376941f},
-std::array<float,2>{0.578188121f, 0.597464561f},
-std::array<float,2>{0.0644325241f, 0.183246389f},
-std::array<float,2>{0.382086992f, 0.810175478f},
-std::array<float,2>{0.816823959f, 0.394730181f},
-std::array<float,2>{0.886733234f, 0.881712317f},
-std::array<float,2>{0.342597812f, 0.335222512f},
-std::array<float,2>{0.18516846f, 0.697420418f},
-std::array<float,2>{0.697761416f, 0.06585899f},
-std::array<float,2>{0.984704971f, 0.732935727f},
-std::array<float,2>{0.277421445f, 0.0985667631f},
-std::array<float,2>{0.21193254f, 0.929739594f},
-std::array<float,2>{0.680953741f, 0.365054339f},
-std::array<float,2>{0.502267838f, 0.773293674f},
-std::array<float,2>{0.00186569279f, 0.410999626f},
-std::array<float,2>{0.478950679f, 0.581020236f},
-std::array<float,2>{0.780366361f, 0.149487987f},
-std::array<float,2>{0.732290208f, 0.545235038f},
-std::array<float,2>{0.1389319f, 0.229189947f},
-std::array<float,2>{0.346639991f, 0.846117318f},
-std::array<float,2>{0.919420242f, 0.475315332f},
-std::array<float,2>{0.866319001f, 0.990402758f},
-std::array<float,2>{0.437272161f, 0.306646794f},
-std::array<float,2>{0.105025016f, 0.681879044f},
-std::array<float,2>{0.623524666f, 0.00996453129f},
-std::array<float,2>{0.795117676f, 0.602336943f},
-std::array<float,2>{0.445505917f, 0.175157487f},
-std::array<float,2>{0.0431995578f, 0.801078975f},
-std::array<float,2>{0.533041298f, 0.402798057f},
-std::array<float,2>{0.633538663f, 0.884068608f},
-std::array<float,2>{0.219614625f, 0.336405843f},
-std::array<float,2>{0.291214138f, 0.692076564f},
-std::array<float,2>{0.952325404f, 0.0709458441f},
-std::array<float,2>{0.576240242f, 0.650804758f},
-std::array<float,2>{0.091382727f, 0.0540974773f},
-std::array<float,2>{0.39617905f, 0.947411954f},
-std::array<float,2>{0.831482589f, 0.267634779f},
-std::array<float,2>{0.891361713f, 0.822610497f},
-std::array<float,2>{0.314636588f, 0.458966285f},
-std::array<float,2>{0.163142711f, 0.517148912f},
-std::array<float,2>{0.70751977f, 0.201694503f},
-std::array<float,2>{0.930776715f, 0.513142765f},
-std::array<float,2>{0.37428683f, 0.215258375f},
-std::array<float,2>{0.151828647f, 0.837957203f},
-std::array<float,2>{0.744847596f, 0.448357433f},
-std::array<float,2>{0.598564327f, 0.965184271f},
-std::array<float,2>{0.11710228f, 0.264045238f},
-std::array<float,2>{0.419918418f, 0.635760367f},
-std::array<float,2>{0.847966671f, 0.0339240991f},
-std::array<float,2>{0.666291654f, 0.706542373f},
-std::array<float,2>{0.189127833f, 0.0801877975f},
-std::array<float,2>{0.258507937f, 0.899240851f},
-std::array<float,2>{0.982373178f, 0.315007806f},
-std::array<float,2>{0.753796041f, 0.791288495f},
-std::array<float,2>{0.499217361f, 0.38010639f},
-std::array<float,2>{0.0256653577f, 0.621024013f},
-std::array<float,2>{0.522537172f, 0.159592792f},
-std::array<float,2>{0.812963307f, 0.659189463f},
-std::array<float,2>{0.37882027f, 0.016689308f},
-std::array<float,2>{0.067916356f, 0.979905128f},
-std::array<float,2>{0.583394706f, 0.295234084f},
-std::array<float,2>{0.702871799f, 0.872636676f},
-std::array<float,2>{0.180570081f, 0.489685655f},
-std::array<float,2>{0.339725554f, 0.549494028f},
-std::array<float,2>{0.883072972f, 0.2436748f},
-std::array<float,2>{0.553091943f, 0.567064464f},
-std::array<float,2>{0.0476334319f, 0.139975891f},
-std::array<float,2>{0.464103967f, 0.759136021f},
-std::array<float,2>{0.809847891f, 0.433803111f},
-std::array<float,2>{0.953426003f, 0.917241096f},
-std::array<float,2>{0.304374218f, 0.359032482f},
-std::array<float,2>{0.240056664f, 0.740990758f},
-std::array<float,2>{0.649775386f, 0.11013715f},
-std::array<float,2>{0.881926f, 0.627809882f},
-std::array<float,2>{0.334898949f, 0.041423291f},
-std::array<float,2>{0.173452407f, 0.956826031f},
-std::array<float,2>{0.694614112f, 0.256708115f},
-std::array<float,2>{0.593542755f, 0.828308463f},
-std::array<float,2>{0.0711031109f, 0.437745064f},
-std::array<float,2>{0.387693226f, 0.501072466f},
-std::array<float,2>{0.824187756f, 0.206863865f},
-std::array<float,2>{0.644613981f, 0.615178049f},
-std::array<float,2>{0.243738353f, 0.164816588f},
-std::array<float,2>{0.30919382f, 0.783185244f},
-std::array<float,2>{0.968442976f, 0.390260637f},
-std::array<float,2>{0.80281806f, 0.890760064f},
-std::array<float,2>{0.459724784f, 0.325769544f},
-std::array<float,2>{0.0610575676f, 0.715386033f},
-std::array<float,2>{0.561978757f, 0.0922651142f},
-std::array<float,2>{0.859255731f, 0.560780287f},
-std::array<float,2>{0.407537878f, 0.23588717f},
-std::array<float,2>{0.12306986f, 0.861506999f},
-std::array<float,2>{0.601579726f, 0.498273462f},
-std::array<float,2>{0.738763511f, 0.970949054f},
-std::array<float,2>{0.140879706f, 0.285761148f},
-std::array<float,2>{0.362772852f, 0.670496345f},
-std::array<float,2>{0.926257193f, 0.0284754075f},
-std::array<float,2>{0.530622303f, 0.742594182f},
-std::array<float,2>{0.0233285837f, 0.11809098f},
-std::array<float,2>{0.490097106f, 0.912913382f},
-std::array<float,2>{0.760463715f, 0.349445641f},
-std::array<float,2>{0.975805283f, 0.757724881f},
-std::array<float,2>{0.251745105f, 0.427514166f},
-std::array<float,2>{0.197771668f, 0.575407207f},
-std::array<float,2>{0.657559693f, 0.128383994f},
-std::array<float,2>{0.937590241f, 0.590409935f},
-std::array<float,2>{0.286929101f, 0.140741378f},
-std::array<float,2>{0.232316151f, 0.777635157f},
-std::array<float,2>{0.625707448f, 0.419954836f},
-std::array<float,2>{0.542106986f, 0.923870385f},
-std::array<float,2>{0.0376480408f, 0.373403817f},
-std::array<float,2>{0.445164412f, 0.725513339f},
-std::array<float,2>{0.783993125f, 0.106322758f},
-std::array<float,2>{0.717247725f, 0.674312234f},
-std::array<float,2>{0.165170267f, 0.00132500683f},
-std::array<float,2>{0.321170002f, 0.999827147f},
-std::array<float,2>{0.901885986f, 0.297513276f},
-std::array<float,2>{0.8384673f, 0.858375788f},
-std::array<float,2>{0.39925307f, 0.479749411f},
-std::array<float,2>{0.0826720521f, 0.533220887f},
-std::array<float,2>{0.56289494f, 0.225902036f},
-std::array<float,2>{0.771582305f, 0.702983201f},
-std::array<float,2>{0.475243866f, 0.0682068989f},
-std::array<float,2>{0.008220274f, 0.877941072f},
-std::array<float,2>{0.509394169f, 0.331852943f},
-std::array<float,2>{0.679004967f, 0.807752252f},
-std::array<float,2>{0.205510706f, 0.39117071f},
-std::array<float,2>{0.270177543f, 0.598841608f},
-std::array<float,2>{0.993222713f, 0.184928402f},
-std::array<float,2>{0.61169219f, 0.525491118f},
-std::array<float,2>{0.101136178f, 0.188262224f},
-std::array<float,2>{0.425431639f, 0.818341017f},
-std::array<float,2>{0.867323041f, 0.466495931f},
-std::array<float,2>{0.913010776f, 0.938411832f},
-std::array<float,2>{0.358924478f, 0.277839422f},
-std::array<float,2>{0.132788837f, 0.641363978f},
-std::array<float,2>{0.720472753f, 0.0572158247f}}
\ No newline at end of file
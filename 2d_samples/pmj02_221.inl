@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.562401175f, 0.84399718f},
-std::array<float,2>{0.179831237f, 0.439700395f},
-std::array<float,2>{0.770220339f, 0.243307859f},
-std::array<float,2>{0.408041567f, 0.631584406f},
-std::array<float,2>{0.991251111f, 0.594338179f},
-std::array<float,2>{0.272313416f, 0.116781011f},
-std::array<float,2>{0.682312965f, 0.326678723f},
-std::array<float,2>{0.103625298f, 0.993720949f},
-std::array<float,2>{0.816351056f, 0.907671869f},
-std::array<float,2>{0.480096877f, 0.278969944f},
-std::array<float,2>{0.572842062f, 0.0133572035f},
-std::array<float,2>{0.224701256f, 0.537583649f},
-std::array<float,2>{0.693123698f, 0.744197786f},
-std::array<float,2>{0.0571423322f, 0.171166524f},
-std::array<float,2>{0.883351386f, 0.415960848f},
-std::array<float,2>{0.36169973f, 0.777983487f},
-std::array<float,2>{0.645556629f, 0.957243025f},
-std::array<float,2>{0.0728848651f, 0.35801965f},
-std::array<float,2>{0.957845688f, 0.0627482608f},
-std::array<float,2>{0.298022777f, 0.583753288f},
-std::array<float,2>{0.792491913f, 0.672529578f},
-std::array<float,2>{0.396378756f, 0.216698602f},
-std::array<float,2>{0.523904979f, 0.48968178f},
-std::array<float,2>{0.126361877f, 0.827404797f},
-std::array<float,2>{0.906712711f, 0.79114002f},
-std::array<float,2>{0.3240996f, 0.402923286f},
-std::array<float,2>{0.73279047f, 0.139690906f},
-std::array<float,2>{0.011637534f, 0.688592374f},
-std::array<float,2>{0.611919284f, 0.510384202f},
-std::array<float,2>{0.19831191f, 0.0487234369f},
-std::array<float,2>{0.863453686f, 0.307420462f},
-std::array<float,2>{0.460015327f, 0.889741123f},
-std::array<float,2>{0.748784959f, 0.757456124f},
-std::array<float,2>{0.0197213311f, 0.427487582f},
-std::array<float,2>{0.935271502f, 0.178769782f},
-std::array<float,2>{0.338268459f, 0.733725488f},
-std::array<float,2>{0.856528521f, 0.557150185f},
-std::array<float,2>{0.452752322f, 0.0278438181f},
-std::array<float,2>{0.608692169f, 0.251625568f},
-std::array<float,2>{0.2058395f, 0.932489812f},
-std::array<float,2>{0.945582807f, 0.970003963f},
-std::array<float,2>{0.294612855f, 0.3304075f},
-std::array<float,2>{0.633431256f, 0.0998853445f},
-std::array<float,2>{0.0922213569f, 0.619785368f},
-std::array<float,2>{0.508522213f, 0.641774416f},
-std::array<float,2>{0.154274553f, 0.232506201f},
-std::array<float,2>{0.812473476f, 0.455659568f},
-std::array<float,2>{0.387310266f, 0.866879761f},
-std::array<float,2>{0.580813408f, 0.897650421f},
-std::array<float,2>{0.249560505f, 0.296557188f},
-std::array<float,2>{0.842330039f, 0.0328237712f},
-std::array<float,2>{0.48990038f, 0.522426426f},
-std::array<float,2>{0.891302347f, 0.70948714f},
-std::array<float,2>{0.345658273f, 0.142094523f},
-std::array<float,2>{0.715847611f, 0.386498898f},
-std::array<float,2>{0.0466385521f, 0.811004281f},
-std::array<float,2>{0.761494219f, 0.839914203f},
-std::array<float,2>{0.430475026f, 0.469245702f},
-std::array<float,2>{0.531532407f, 0.191060171f},
-std::array<float,2>{0.164469242f, 0.670820534f},
-std::array<float,2>{0.669362605f, 0.575722754f},
-std::array<float,2>{0.109810159f, 0.0859699845f},
-std::array<float,2>{0.983408988f, 0.364030361f},
-std::array<float,2>{0.261948586f, 0.949599326f},
-std::array<float,2>{0.594610631f, 0.80247426f},
-std::array<float,2>{0.211869285f, 0.381249845f},
-std::array<float,2>{0.849626899f, 0.150408819f},
-std::array<float,2>{0.442080885f, 0.712921262f},
-std::array<float,2>{0.926634312f, 0.525627553f},
-std::array<float,2>{0.328229874f, 0.0467096716f},
-std::array<float,2>{0.734987497f, 0.288220286f},
-std::array<float,2>{0.0292808712f, 0.901815832f},
-std::array<float,2>{0.798543751f, 0.943009019f},
-std::array<float,2>{0.378522038f, 0.370868593f},
-std::array<float,2>{0.506282389f, 0.0801227763f},
-std::array<float,2>{0.148191184f, 0.568321705f},
-std::array<float,2>{0.625063121f, 0.660004497f},
-std::array<float,2>{0.0811771303f, 0.202322736f},
-std::array<float,2>{0.93898648f, 0.479750007f},
-std::array<float,2>{0.286881804f, 0.830090582f},
-std::array<float,2>{0.704775095f, 0.925332785f},
-std::array<float,2>{0.0369189791f, 0.26469931f},
-std::array<float,2>{0.901516616f, 0.0188957117f},
-std::array<float,2>{0.352873296f, 0.549775958f},
-std::array<float,2>{0.835915923f, 0.722627342f},
-std::array<float,2>{0.495642602f, 0.183163539f},
-std::array<float,2>{0.591015875f, 0.433189005f},
-std::array<float,2>{0.241083413f, 0.761489809f},
-std::array<float,2>{0.969194889f, 0.868155301f},
-std::array<float,2>{0.256998897f, 0.46294713f},
-std::array<float,2>{0.660100996f, 0.221046731f},
-std::array<float,2>{0.123697966f, 0.655266583f},
-std::array<float,2>{0.540739775f, 0.613792419f},
-std::array<float,2>{0.159205377f, 0.10329131f},
-std::array<float,2>{0.753989637f, 0.340983063f},
-std::array<float,2>{0.42383188f, 0.982360303f},
-std::array<float,2>{0.678223431f, 0.818977892f},
-std::array<float,2>{0.100841604f, 0.496403098f},
-std::array<float,2>{0.993940234f, 0.204579219f},
-std::array<float,2>{0.276587844f, 0.683276296f},
-std::array<float,2>{0.781069577f, 0.593144536f},
-std::array<float,2>{0.41955784f, 0.0730867311f},
-std::array<float,2>{0.551574171f, 0.349114656f},
-std::array<float,2>{0.177894846f, 0.962052584f},
-std::array<float,2>{0.879334867f, 0.878118813f},
-std::array<float,2>{0.370083988f, 0.299817711f},
-std::array<float,2>{0.700284541f, 0.0576941259f},
-std::array<float,2>{0.0508355498f, 0.505018234f},
-std::array<float,2>{0.570286989f, 0.697899878f},
-std::array<float,2>{0.229862094f, 0.132260442f},
-std::array<float,2>{0.828010559f, 0.393323183f},
-std::array<float,2>{0.475668788f, 0.788565934f},
-std::array<float,2>{0.522797227f, 0.987363696f},
-std::array<float,2>{0.139235228f, 0.317081243f},
-std::array<float,2>{0.783286095f, 0.118937626f},
-std::array<float,2>{0.400312483f, 0.604952157f},
-std::array<float,2>{0.963137031f, 0.634499907f},
-std::array<float,2>{0.308353245f, 0.235838011f},
-std::array<float,2>{0.652109146f, 0.448500484f},
-std::array<float,2>{0.062999852f, 0.852590144f},
-std::array<float,2>{0.873982847f, 0.768588781f},
-std::array<float,2>{0.463584065f, 0.412728339f},
-std::array<float,2>{0.618590653f, 0.159335315f},
-std::array<float,2>{0.188315198f, 0.737771153f},
-std::array<float,2>{0.725784242f, 0.54375875f},
-std::array<float,2>{0.00292855129f, 0.00340754003f},
-std::array<float,2>{0.918485463f, 0.26883769f},
-std::array<float,2>{0.315434515f, 0.92157805f},
-std::array<float,2>{0.503234267f, 0.776906312f},
-std::array<float,2>{0.14167662f, 0.421527863f},
-std::array<float,2>{0.801220417f, 0.164336324f},
-std::array<float,2>{0.381549656f, 0.747952402f},
-std::array<float,2>{0.944382608f, 0.534165561f},
-std::array<float,2>{0.28370896f, 0.0112476638f},
-std::array<float,2>{0.632604539f, 0.275678307f},
-std::array<float,2>{0.0837820843f, 0.913164735f},
-std::array<float,2>{0.845048487f, 0.996929526f},
-std::array<float,2>{0.440852284f, 0.323913783f},
-std::array<float,2>{0.600876093f, 0.113050558f},
-std::array<float,2>{0.215667024f, 0.597873986f},
-std::array<float,2>{0.740408838f, 0.627311766f},
-std::array<float,2>{0.0257847141f, 0.247062966f},
-std::array<float,2>{0.922584355f, 0.444571316f},
-std::array<float,2>{0.335323095f, 0.850028574f},
-std::array<float,2>{0.66319865f, 0.886063278f},
-std::array<float,2>{0.119721085f, 0.309366465f},
-std::array<float,2>{0.973341644f, 0.0543238074f},
-std::array<float,2>{0.252717346f, 0.512394786f},
-std::array<float,2>{0.75236249f, 0.694209337f},
-std::array<float,2>{0.427275002f, 0.13323693f},
-std::array<float,2>{0.543047428f, 0.402054936f},
-std::array<float,2>{0.160168931f, 0.794768274f},
-std::array<float,2>{0.902942181f, 0.823272407f},
-std::array<float,2>{0.357279271f, 0.487762153f},
-std::array<float,2>{0.709917903f, 0.212070942f},
-std::array<float,2>{0.0316654518f, 0.677431703f},
-std::array<float,2>{0.588784873f, 0.578194439f},
-std::array<float,2>{0.236779645f, 0.0673468336f},
-std::array<float,2>{0.831893504f, 0.352173179f},
-std::array<float,2>{0.499460518f, 0.955666184f},
-std::array<float,2>{0.698175013f, 0.860478818f},
-std::array<float,2>{0.0469703525f, 0.460400909f},
-std::array<float,2>{0.875423133f, 0.229834288f},
-std::array<float,2>{0.372212589f, 0.645625591f},
-std::array<float,2>{0.82154721f, 0.623313069f},
-std::array<float,2>{0.470219254f, 0.0972525701f},
-std::array<float,2>{0.563225925f, 0.333475173f},
-std::array<float,2>{0.233925909f, 0.973635137f},
-std::array<float,2>{0.997296929f, 0.933983505f},
-std::array<float,2>{0.280608475f, 0.255240858f},
-std::array<float,2>{0.675010264f, 0.0268572457f},
-std::array<float,2>{0.0967145041f, 0.561082363f},
-std::array<float,2>{0.549494207f, 0.727979779f},
-std::array<float,2>{0.175023377f, 0.173055455f},
-std::array<float,2>{0.775442421f, 0.421879172f},
-std::array<float,2>{0.416004956f, 0.752322495f},
-std::array<float,2>{0.622265935f, 0.947164178f},
-std::array<float,2>{0.193198591f, 0.362602621f},
-std::array<float,2>{0.870344937f, 0.0932914391f},
-std::array<float,2>{0.466332942f, 0.572929621f},
-std::array<float,2>{0.916360736f, 0.667294741f},
-std::array<float,2>{0.318695009f, 0.194529578f},
-std::array<float,2>{0.719095588f, 0.473387271f},
-std::array<float,2>{0.00732933078f, 0.839840233f},
-std::array<float,2>{0.785529435f, 0.80846864f},
-std::array<float,2>{0.403214335f, 0.388070256f},
-std::array<float,2>{0.516057074f, 0.14500688f},
-std::array<float,2>{0.135499537f, 0.704430878f},
-std::array<float,2>{0.653215885f, 0.516320288f},
-std::array<float,2>{0.0669328719f, 0.0362176262f},
-std::array<float,2>{0.967287958f, 0.289082855f},
-std::array<float,2>{0.311030835f, 0.891939342f},
-std::array<float,2>{0.575084209f, 0.832265496f},
-std::array<float,2>{0.219149187f, 0.482342094f},
-std::array<float,2>{0.819101393f, 0.198088333f},
-std::array<float,2>{0.4808456f, 0.663889408f},
-std::array<float,2>{0.889352858f, 0.564662814f},
-std::array<float,2>{0.366353273f, 0.0825893879f},
-std::array<float,2>{0.6887151f, 0.373318136f},
-std::array<float,2>{0.0610866286f, 0.937659264f},
-std::array<float,2>{0.766524255f, 0.904459596f},
-std::array<float,2>{0.413019329f, 0.284820676f},
-std::array<float,2>{0.554787576f, 0.041246336f},
-std::array<float,2>{0.185799107f, 0.530986667f},
-std::array<float,2>{0.684840262f, 0.718604743f},
-std::array<float,2>{0.107587785f, 0.153509438f},
-std::array<float,2>{0.986729085f, 0.375026017f},
-std::array<float,2>{0.269124061f, 0.799234271f},
-std::array<float,2>{0.728903711f, 0.977068782f},
-std::array<float,2>{0.0150369573f, 0.339551508f},
-std::array<float,2>{0.911531389f, 0.106142484f},
-std::array<float,2>{0.324521869f, 0.611305296f},
-std::array<float,2>{0.862862647f, 0.648699641f},
-std::array<float,2>{0.453845739f, 0.223203242f},
-std::array<float,2>{0.613320708f, 0.466102123f},
-std::array<float,2>{0.199315771f, 0.872241974f},
-std::array<float,2>{0.954174459f, 0.764249802f},
-std::array<float,2>{0.302808344f, 0.437083989f},
-std::array<float,2>{0.64310658f, 0.186479211f},
-std::array<float,2>{0.07566154f, 0.724215686f},
-std::array<float,2>{0.528762221f, 0.550795794f},
-std::array<float,2>{0.132395938f, 0.0211305469f},
-std::array<float,2>{0.79375428f, 0.258864731f},
-std::array<float,2>{0.393492609f, 0.926962137f},
-std::array<float,2>{0.637037098f, 0.783512294f},
-std::array<float,2>{0.0883606747f, 0.396649003f},
-std::array<float,2>{0.950772524f, 0.125693858f},
-std::array<float,2>{0.291270286f, 0.701214135f},
-std::array<float,2>{0.806583643f, 0.500653148f},
-std::array<float,2>{0.385861188f, 0.0606832355f},
-std::array<float,2>{0.515608668f, 0.30306688f},
-std::array<float,2>{0.152314067f, 0.87901485f},
-std::array<float,2>{0.933085442f, 0.9654423f},
-std::array<float,2>{0.340663284f, 0.345662117f},
-std::array<float,2>{0.742973685f, 0.0750377253f},
-std::array<float,2>{0.0176879503f, 0.587391257f},
-std::array<float,2>{0.603819788f, 0.686815619f},
-std::array<float,2>{0.20912838f, 0.207727253f},
-std::array<float,2>{0.852731228f, 0.495983332f},
-std::array<float,2>{0.447683781f, 0.814427853f},
-std::array<float,2>{0.536034882f, 0.916594505f},
-std::array<float,2>{0.17027612f, 0.270357519f},
-std::array<float,2>{0.764586389f, 0.00656579807f},
-std::array<float,2>{0.43402335f, 0.542265773f},
-std::array<float,2>{0.978627861f, 0.741623998f},
-std::array<float,2>{0.259366423f, 0.16262494f},
-std::array<float,2>{0.667199314f, 0.407257169f},
-std::array<float,2>{0.115803719f, 0.771450222f},
-std::array<float,2>{0.837274551f, 0.856922448f},
-std::array<float,2>{0.48458609f, 0.450942814f},
-std::array<float,2>{0.582240641f, 0.240002692f},
-std::array<float,2>{0.245935842f, 0.639086962f},
-std::array<float,2>{0.714191258f, 0.60920155f},
-std::array<float,2>{0.0398535803f, 0.121919259f},
-std::array<float,2>{0.896386921f, 0.315638959f},
-std::array<float,2>{0.351003945f, 0.989826441f},
-std::array<float,2>{0.52730608f, 0.824450254f},
-std::array<float,2>{0.127212018f, 0.49150455f},
-std::array<float,2>{0.790381372f, 0.217734531f},
-std::array<float,2>{0.397997618f, 0.674317837f},
-std::array<float,2>{0.959114134f, 0.585640073f},
-std::array<float,2>{0.299636394f, 0.065759629f},
-std::array<float,2>{0.647638083f, 0.356419057f},
-std::array<float,2>{0.0713452101f, 0.959800601f},
-std::array<float,2>{0.866172791f, 0.886915028f},
-std::array<float,2>{0.457758099f, 0.305505514f},
-std::array<float,2>{0.610822022f, 0.0497540608f},
-std::array<float,2>{0.196082771f, 0.508453429f},
-std::array<float,2>{0.73110795f, 0.69106698f},
-std::array<float,2>{0.00877656788f, 0.137014911f},
-std::array<float,2>{0.909631789f, 0.406060904f},
-std::array<float,2>{0.322198659f, 0.790878654f},
-std::array<float,2>{0.680012822f, 0.994147062f},
-std::array<float,2>{0.102259375f, 0.326029867f},
-std::array<float,2>{0.989664316f, 0.114920549f},
-std::array<float,2>{0.270107776f, 0.597644448f},
-std::array<float,2>{0.772287011f, 0.630750299f},
-std::array<float,2>{0.408589751f, 0.246091634f},
-std::array<float,2>{0.560274184f, 0.438212693f},
-std::array<float,2>{0.183158398f, 0.846194983f},
-std::array<float,2>{0.886413515f, 0.779351413f},
-std::array<float,2>{0.359906226f, 0.416930079f},
-std::array<float,2>{0.694313943f, 0.168413699f},
-std::array<float,2>{0.0564425066f, 0.744117081f},
-std::array<float,2>{0.570957184f, 0.536090553f},
-std::array<float,2>{0.224344075f, 0.0152952624f},
-std::array<float,2>{0.813131392f, 0.280765802f},
-std::array<float,2>{0.478383422f, 0.908594906f},
-std::array<float,2>{0.718589485f, 0.808956623f},
-std::array<float,2>{0.0435541235f, 0.38403663f},
-std::array<float,2>{0.892923653f, 0.144341975f},
-std::array<float,2>{0.346495301f, 0.70813781f},
-std::array<float,2>{0.841708422f, 0.520926356f},
-std::array<float,2>{0.491329372f, 0.0341455303f},
-std::array<float,2>{0.57877928f, 0.294533759f},
-std::array<float,2>{0.247755274f, 0.895321906f},
-std::array<float,2>{0.981825829f, 0.951767147f},
-std::array<float,2>{0.264838427f, 0.366221547f},
-std::array<float,2>{0.670900285f, 0.0880016834f},
-std::array<float,2>{0.112045698f, 0.577649355f},
-std::array<float,2>{0.533257425f, 0.669290125f},
-std::array<float,2>{0.16730386f, 0.188438728f},
-std::array<float,2>{0.758823097f, 0.47148782f},
-std::array<float,2>{0.432313919f, 0.842662692f},
-std::array<float,2>{0.606228709f, 0.930916965f},
-std::array<float,2>{0.20429644f, 0.253130376f},
-std::array<float,2>{0.858231783f, 0.0304484628f},
-std::array<float,2>{0.449988425f, 0.555517256f},
-std::array<float,2>{0.936029375f, 0.730979025f},
-std::array<float,2>{0.336868852f, 0.176560387f},
-std::array<float,2>{0.746470153f, 0.429123819f},
-std::array<float,2>{0.0216997247f, 0.754674792f},
-std::array<float,2>{0.810519278f, 0.863825321f},
-std::array<float,2>{0.389035821f, 0.454238623f},
-std::array<float,2>{0.510654151f, 0.230845019f},
-std::array<float,2>{0.154759824f, 0.643960595f},
-std::array<float,2>{0.635251701f, 0.617588341f},
-std::array<float,2>{0.0899900869f, 0.097764872f},
-std::array<float,2>{0.947935522f, 0.328908145f},
-std::array<float,2>{0.296551526f, 0.970900416f},
-std::array<float,2>{0.592835665f, 0.758989036f},
-std::array<float,2>{0.23842065f, 0.430048853f},
-std::array<float,2>{0.832171381f, 0.181397706f},
-std::array<float,2>{0.493955046f, 0.719769061f},
-std::array<float,2>{0.899637699f, 0.547869802f},
-std::array<float,2>{0.354545712f, 0.0161266159f},
-std::array<float,2>{0.705316961f, 0.261745542f},
-std::array<float,2>{0.0378722884f, 0.922008634f},
-std::array<float,2>{0.757497549f, 0.983376086f},
-std::array<float,2>{0.423811316f, 0.343513668f},
-std::array<float,2>{0.542300701f, 0.104856171f},
-std::array<float,2>{0.156822398f, 0.616972625f},
-std::array<float,2>{0.656877995f, 0.653321445f},
-std::array<float,2>{0.122824699f, 0.219116136f},
-std::array<float,2>{0.971840262f, 0.462332338f},
-std::array<float,2>{0.254327685f, 0.870665669f},
-std::array<float,2>{0.736388385f, 0.89902097f},
-std::array<float,2>{0.0311557055f, 0.285338193f},
-std::array<float,2>{0.928940296f, 0.0441726744f},
-std::array<float,2>{0.331136167f, 0.524998188f},
-std::array<float,2>{0.849437296f, 0.711931825f},
-std::array<float,2>{0.445167571f, 0.150025681f},
-std::array<float,2>{0.596915245f, 0.379635483f},
-std::array<float,2>{0.214057311f, 0.802777648f},
-std::array<float,2>{0.940193176f, 0.829964638f},
-std::array<float,2>{0.287902325f, 0.477479666f},
-std::array<float,2>{0.627159059f, 0.200128436f},
-std::array<float,2>{0.0786765218f, 0.657402515f},
-std::array<float,2>{0.505650282f, 0.56907928f},
-std::array<float,2>{0.145363167f, 0.0782797337f},
-std::array<float,2>{0.800276697f, 0.367605239f},
-std::array<float,2>{0.376153022f, 0.943930447f},
-std::array<float,2>{0.649115503f, 0.854638338f},
-std::array<float,2>{0.0655660108f, 0.446120143f},
-std::array<float,2>{0.961218238f, 0.236350492f},
-std::array<float,2>{0.3063218f, 0.635012984f},
-std::array<float,2>{0.782912791f, 0.602687776f},
-std::array<float,2>{0.400720596f, 0.120098829f},
-std::array<float,2>{0.521171868f, 0.32026726f},
-std::array<float,2>{0.138046399f, 0.984629512f},
-std::array<float,2>{0.920185268f, 0.918969989f},
-std::array<float,2>{0.312945783f, 0.266141117f},
-std::array<float,2>{0.724347293f, 0.0012923202f},
-std::array<float,2>{0.000303816603f, 0.546211064f},
-std::array<float,2>{0.619350374f, 0.736317873f},
-std::array<float,2>{0.191315427f, 0.157653838f},
-std::array<float,2>{0.87159574f, 0.410332859f},
-std::array<float,2>{0.462335587f, 0.765997052f},
-std::array<float,2>{0.554576695f, 0.963506162f},
-std::array<float,2>{0.176040977f, 0.350833833f},
-std::array<float,2>{0.77740097f, 0.0718891323f},
-std::array<float,2>{0.421841472f, 0.58994627f},
-std::array<float,2>{0.995632052f, 0.681607425f},
-std::array<float,2>{0.275303125f, 0.20603855f},
-std::array<float,2>{0.676330268f, 0.499129057f},
-std::array<float,2>{0.0982246175f, 0.818309009f},
-std::array<float,2>{0.824707091f, 0.785392165f},
-std::array<float,2>{0.473892689f, 0.39159593f},
-std::array<float,2>{0.566851735f, 0.130825326f},
-std::array<float,2>{0.226751581f, 0.696372688f},
-std::array<float,2>{0.702102244f, 0.507582545f},
-std::array<float,2>{0.0527622253f, 0.0565109104f},
-std::array<float,2>{0.882165313f, 0.298703015f},
-std::array<float,2>{0.36812973f, 0.876090765f},
-std::array<float,2>{0.546712399f, 0.796769559f},
-std::array<float,2>{0.162736446f, 0.399920374f},
-std::array<float,2>{0.751029134f, 0.134825394f},
-std::array<float,2>{0.427813232f, 0.691487134f},
-std::array<float,2>{0.9755193f, 0.513772368f},
-std::array<float,2>{0.250950456f, 0.0521929525f},
-std::array<float,2>{0.660952091f, 0.312395662f},
-std::array<float,2>{0.117492512f, 0.883577883f},
-std::array<float,2>{0.829015195f, 0.953886211f},
-std::array<float,2>{0.496436119f, 0.355048805f},
-std::array<float,2>{0.586029589f, 0.069902882f},
-std::array<float,2>{0.235235438f, 0.58093667f},
-std::array<float,2>{0.707269967f, 0.678443372f},
-std::array<float,2>{0.0337130576f, 0.214503005f},
-std::array<float,2>{0.904804349f, 0.486324847f},
-std::array<float,2>{0.357824683f, 0.821206748f},
-std::array<float,2>{0.628962398f, 0.910313785f},
-std::array<float,2>{0.0847839266f, 0.275355339f},
-std::array<float,2>{0.941580951f, 0.0081747137f},
-std::array<float,2>{0.281647325f, 0.53289032f},
-std::array<float,2>{0.803603649f, 0.749036312f},
-std::array<float,2>{0.380534679f, 0.166827604f},
-std::array<float,2>{0.501620352f, 0.419642866f},
-std::array<float,2>{0.143558264f, 0.774712563f},
-std::array<float,2>{0.925499141f, 0.848950386f},
-std::array<float,2>{0.333682388f, 0.44276911f},
-std::array<float,2>{0.738902271f, 0.248264685f},
-std::array<float,2>{0.0236185975f, 0.626303077f},
-std::array<float,2>{0.59805572f, 0.601392508f},
-std::array<float,2>{0.217818201f, 0.109621689f},
-std::array<float,2>{0.846837044f, 0.321979254f},
-std::array<float,2>{0.438877106f, 0.99964869f},
-std::array<float,2>{0.721496224f, 0.837862611f},
-std::array<float,2>{0.00497418176f, 0.476088017f},
-std::array<float,2>{0.915188074f, 0.192794397f},
-std::array<float,2>{0.318266422f, 0.66430825f},
-std::array<float,2>{0.867530942f, 0.57173723f},
-std::array<float,2>{0.468481988f, 0.0914786384f},
-std::array<float,2>{0.623929679f, 0.359757662f},
-std::array<float,2>{0.19364129f, 0.948947847f},
-std::array<float,2>{0.96595794f, 0.894149065f},
-std::array<float,2>{0.308701009f, 0.292218059f},
-std::array<float,2>{0.654360533f, 0.0388245583f},
-std::array<float,2>{0.0693626404f, 0.518854737f},
-std::array<float,2>{0.517584741f, 0.706955731f},
-std::array<float,2>{0.132928371f, 0.147102147f},
-std::array<float,2>{0.788764834f, 0.390080601f},
-std::array<float,2>{0.406011254f, 0.806153536f},
-std::array<float,2>{0.565369248f, 0.976453602f},
-std::array<float,2>{0.230799958f, 0.335265934f},
-std::array<float,2>{0.822673023f, 0.0944951102f},
-std::array<float,2>{0.471522272f, 0.622771919f},
-std::array<float,2>{0.878566444f, 0.647535503f},
-std::array<float,2>{0.373471379f, 0.227011904f},
-std::array<float,2>{0.695974886f, 0.458597392f},
-std::array<float,2>{0.049666658f, 0.862106979f},
-std::array<float,2>{0.773824036f, 0.750618219f},
-std::array<float,2>{0.417957485f, 0.424301088f},
-std::array<float,2>{0.548103809f, 0.174433872f},
-std::array<float,2>{0.171985194f, 0.728658795f},
-std::array<float,2>{0.673533261f, 0.558829725f},
-std::array<float,2>{0.0952639878f, 0.0252722595f},
-std::array<float,2>{0.999930441f, 0.257045358f},
-std::array<float,2>{0.277918935f, 0.936096609f},
-std::array<float,2>{0.61648494f, 0.874537885f},
-std::array<float,2>{0.202915445f, 0.467803568f},
-std::array<float,2>{0.859975457f, 0.224644825f},
-std::array<float,2>{0.455361456f, 0.651372313f},
-std::array<float,2>{0.913208127f, 0.612362325f},
-std::array<float,2>{0.327590168f, 0.108669229f},
-std::array<float,2>{0.727230906f, 0.337287486f},
-std::array<float,2>{0.0133266365f, 0.97895813f},
-std::array<float,2>{0.795871735f, 0.929043531f},
-std::array<float,2>{0.391792387f, 0.26077649f},
-std::array<float,2>{0.530569851f, 0.0220546015f},
-std::array<float,2>{0.130034104f, 0.553544283f},
-std::array<float,2>{0.640719533f, 0.725088835f},
-std::array<float,2>{0.0778908134f, 0.184962839f},
-std::array<float,2>{0.956975758f, 0.434981257f},
-std::array<float,2>{0.300934345f, 0.761775076f},
-std::array<float,2>{0.689748406f, 0.940503418f},
-std::array<float,2>{0.0602442138f, 0.372118711f},
-std::array<float,2>{0.887565792f, 0.0844757408f},
-std::array<float,2>{0.364434183f, 0.564297497f},
-std::array<float,2>{0.817321599f, 0.660679042f},
-std::array<float,2>{0.482573748f, 0.197155774f},
-std::array<float,2>{0.5770576f, 0.482749641f},
-std::array<float,2>{0.222036138f, 0.83520776f},
-std::array<float,2>{0.985613585f, 0.798541665f},
-std::array<float,2>{0.267226547f, 0.378144115f},
-std::array<float,2>{0.686819196f, 0.155915111f},
-std::array<float,2>{0.107244886f, 0.7164101f},
-std::array<float,2>{0.557278335f, 0.52901721f},
-std::array<float,2>{0.185346186f, 0.0396263599f},
-std::array<float,2>{0.768841505f, 0.283158064f},
-std::array<float,2>{0.411442041f, 0.902846456f},
-std::array<float,2>{0.664578259f, 0.77194649f},
-std::array<float,2>{0.114928313f, 0.409501731f},
-std::array<float,2>{0.977772355f, 0.160737321f},
-std::array<float,2>{0.261189193f, 0.739711642f},
-std::array<float,2>{0.76361692f, 0.540271997f},
-std::array<float,2>{0.435890228f, 0.00543872779f},
-std::array<float,2>{0.537711024f, 0.271490306f},
-std::array<float,2>{0.168568999f, 0.915188193f},
-std::array<float,2>{0.897000432f, 0.992172539f},
-std::array<float,2>{0.34954226f, 0.312506169f},
-std::array<float,2>{0.711977422f, 0.1234366f},
-std::array<float,2>{0.0423237756f, 0.607005119f},
-std::array<float,2>{0.585743725f, 0.638610482f},
-std::array<float,2>{0.243520617f, 0.240468279f},
-std::array<float,2>{0.839606166f, 0.451612234f},
-std::array<float,2>{0.488205135f, 0.857771575f},
-std::array<float,2>{0.513485909f, 0.880877972f},
-std::array<float,2>{0.148892343f, 0.301485121f},
-std::array<float,2>{0.808541417f, 0.0595266894f},
-std::array<float,2>{0.383047044f, 0.502947688f},
-std::array<float,2>{0.952627897f, 0.700630486f},
-std::array<float,2>{0.290964574f, 0.1279511f},
-std::array<float,2>{0.639722586f, 0.394795239f},
-std::array<float,2>{0.0866208524f, 0.781473815f},
-std::array<float,2>{0.854960144f, 0.814637125f},
-std::array<float,2>{0.445503056f, 0.492692411f},
-std::array<float,2>{0.602041125f, 0.209749907f},
-std::array<float,2>{0.207837835f, 0.684828162f},
-std::array<float,2>{0.74553901f, 0.58940661f},
-std::array<float,2>{0.0166302975f, 0.0766067207f},
-std::array<float,2>{0.930076599f, 0.347373784f},
-std::array<float,2>{0.343554825f, 0.968126774f},
-std::array<float,2>{0.533072948f, 0.843476474f},
-std::array<float,2>{0.165905416f, 0.472546667f},
-std::array<float,2>{0.760317147f, 0.188750163f},
-std::array<float,2>{0.431167006f, 0.667986035f},
-std::array<float,2>{0.982949138f, 0.576262474f},
-std::array<float,2>{0.263058841f, 0.0889311135f},
-std::array<float,2>{0.668811679f, 0.365555376f},
-std::array<float,2>{0.111151397f, 0.952812076f},
-std::array<float,2>{0.8435601f, 0.896366119f},
-std::array<float,2>{0.489040256f, 0.293901354f},
-std::array<float,2>{0.581866086f, 0.0349987857f},
-std::array<float,2>{0.248823702f, 0.519876599f},
-std::array<float,2>{0.715726912f, 0.707241893f},
-std::array<float,2>{0.045854006f, 0.143241718f},
-std::array<float,2>{0.891672194f, 0.383661628f},
-std::array<float,2>{0.344450086f, 0.809983015f},
-std::array<float,2>{0.634739816f, 0.972494841f},
-std::array<float,2>{0.0930331796f, 0.329351187f},
-std::array<float,2>{0.946622908f, 0.0992646813f},
-std::array<float,2>{0.293891072f, 0.618609607f},
-std::array<float,2>{0.810844183f, 0.642882586f},
-std::array<float,2>{0.387995452f, 0.231789753f},
-std::array<float,2>{0.509546578f, 0.453994602f},
-std::array<float,2>{0.152516395f, 0.864325404f},
-std::array<float,2>{0.93404299f, 0.755110264f},
-std::array<float,2>{0.339702696f, 0.428688228f},
-std::array<float,2>{0.749835372f, 0.177441075f},
-std::array<float,2>{0.0207998883f, 0.73182106f},
-std::array<float,2>{0.607640803f, 0.555898845f},
-std::array<float,2>{0.206813529f, 0.0301156528f},
-std::array<float,2>{0.856416404f, 0.252648294f},
-std::array<float,2>{0.451620966f, 0.930200875f},
-std::array<float,2>{0.734071434f, 0.78913027f},
-std::array<float,2>{0.0105514703f, 0.404403508f},
-std::array<float,2>{0.908190072f, 0.138587177f},
-std::array<float,2>{0.322831094f, 0.69013077f},
-std::array<float,2>{0.86515224f, 0.508969009f},
-std::array<float,2>{0.459718943f, 0.0500932783f},
-std::array<float,2>{0.613071322f, 0.306549817f},
-std::array<float,2>{0.197630942f, 0.888097584f},
-std::array<float,2>{0.958601892f, 0.960310102f},
-std::array<float,2>{0.297513098f, 0.357205003f},
-std::array<float,2>{0.644910514f, 0.0653516725f},
-std::array<float,2>{0.0740367994f, 0.584896207f},
-std::array<float,2>{0.524637341f, 0.674879074f},
-std::array<float,2>{0.125063285f, 0.218137473f},
-std::array<float,2>{0.791517675f, 0.490963995f},
-std::array<float,2>{0.395100951f, 0.825273037f},
-std::array<float,2>{0.573942959f, 0.90970099f},
-std::array<float,2>{0.226518378f, 0.279339015f},
-std::array<float,2>{0.81449008f, 0.0145999053f},
-std::array<float,2>{0.478521436f, 0.536428869f},
-std::array<float,2>{0.88412571f, 0.742538571f},
-std::array<float,2>{0.362431616f, 0.169192985f},
-std::array<float,2>{0.6915887f, 0.417126179f},
-std::array<float,2>{0.0578413308f, 0.781036973f},
-std::array<float,2>{0.771018207f, 0.846818268f},
-std::array<float,2>{0.406586468f, 0.439096957f},
-std::array<float,2>{0.560774446f, 0.244419545f},
-std::array<float,2>{0.18158327f, 0.62978071f},
-std::array<float,2>{0.683124244f, 0.595906734f},
-std::array<float,2>{0.104605488f, 0.113605842f},
-std::array<float,2>{0.990668178f, 0.324304998f},
-std::array<float,2>{0.272782683f, 0.995165288f},
-std::array<float,2>{0.617209136f, 0.766717017f},
-std::array<float,2>{0.188926294f, 0.41131863f},
-std::array<float,2>{0.874683619f, 0.156625852f},
-std::array<float,2>{0.464652747f, 0.734798491f},
-std::array<float,2>{0.918985486f, 0.545665026f},
-std::array<float,2>{0.314525872f, 0.000836265215f},
-std::array<float,2>{0.725425661f, 0.267481655f},
-std::array<float,2>{0.00309565687f, 0.918293834f},
-std::array<float,2>{0.784911931f, 0.986095369f},
-std::array<float,2>{0.399383217f, 0.318613678f},
-std::array<float,2>{0.521530867f, 0.120493792f},
-std::array<float,2>{0.139745221f, 0.602089226f},
-std::array<float,2>{0.651344836f, 0.635911703f},
-std::array<float,2>{0.0636495948f, 0.23794958f},
-std::array<float,2>{0.964681029f, 0.44638592f},
-std::array<float,2>{0.307048827f, 0.854456663f},
-std::array<float,2>{0.699493945f, 0.875018477f},
-std::array<float,2>{0.052050963f, 0.297617406f},
-std::array<float,2>{0.879949212f, 0.0547829084f},
-std::array<float,2>{0.370771289f, 0.506569088f},
-std::array<float,2>{0.826884389f, 0.695552647f},
-std::array<float,2>{0.474939555f, 0.12937434f},
-std::array<float,2>{0.568887174f, 0.392482221f},
-std::array<float,2>{0.228947014f, 0.786319256f},
-std::array<float,2>{0.992873073f, 0.816766858f},
-std::array<float,2>{0.275412768f, 0.498781562f},
-std::array<float,2>{0.679130137f, 0.206802681f},
-std::array<float,2>{0.100566462f, 0.680568218f},
-std::array<float,2>{0.551800728f, 0.591692686f},
-std::array<float,2>{0.179340169f, 0.0712704211f},
-std::array<float,2>{0.779665649f, 0.350264281f},
-std::array<float,2>{0.418087959f, 0.964802384f},
-std::array<float,2>{0.658750772f, 0.869313538f},
-std::array<float,2>{0.12415126f, 0.461576909f},
-std::array<float,2>{0.970058262f, 0.220656976f},
-std::array<float,2>{0.256219268f, 0.652518868f},
-std::array<float,2>{0.75522995f, 0.615644932f},
-std::array<float,2>{0.425400078f, 0.103832237f},
-std::array<float,2>{0.539391816f, 0.342607528f},
-std::array<float,2>{0.158564866f, 0.983406305f},
-std::array<float,2>{0.900633574f, 0.923435628f},
-std::array<float,2>{0.351755053f, 0.263635725f},
-std::array<float,2>{0.703163564f, 0.0174754336f},
-std::array<float,2>{0.0353502333f, 0.547420859f},
-std::array<float,2>{0.590743244f, 0.719628274f},
-std::array<float,2>{0.24211669f, 0.179943249f},
-std::array<float,2>{0.834538639f, 0.431583762f},
-std::array<float,2>{0.494543254f, 0.758382678f},
-std::array<float,2>{0.507322967f, 0.944576919f},
-std::array<float,2>{0.146551117f, 0.368858188f},
-std::array<float,2>{0.797035873f, 0.0800740644f},
-std::array<float,2>{0.377081186f, 0.569676995f},
-std::array<float,2>{0.93798542f, 0.657001317f},
-std::array<float,2>{0.286114931f, 0.20112142f},
-std::array<float,2>{0.626185358f, 0.477899313f},
-std::array<float,2>{0.0801123679f, 0.828739166f},
-std::array<float,2>{0.85139823f, 0.804662704f},
-std::array<float,2>{0.442599893f, 0.380181998f},
-std::array<float,2>{0.595360041f, 0.149120212f},
-std::array<float,2>{0.212359756f, 0.711149752f},
-std::array<float,2>{0.73605144f, 0.523453176f},
-std::array<float,2>{0.0278075133f, 0.0437227376f},
-std::array<float,2>{0.926793337f, 0.286632955f},
-std::array<float,2>{0.329816818f, 0.899479747f},
-std::array<float,2>{0.517422438f, 0.805217326f},
-std::array<float,2>{0.136387274f, 0.389570802f},
-std::array<float,2>{0.786587f, 0.147904426f},
-std::array<float,2>{0.403885931f, 0.705968916f},
-std::array<float,2>{0.967812181f, 0.518393755f},
-std::array<float,2>{0.312445641f, 0.037699379f},
-std::array<float,2>{0.653597593f, 0.291783392f},
-std::array<float,2>{0.0681912303f, 0.893221498f},
-std::array<float,2>{0.869520068f, 0.948084235f},
-std::array<float,2>{0.464926779f, 0.361286759f},
-std::array<float,2>{0.62131393f, 0.0902115777f},
-std::array<float,2>{0.19219172f, 0.570959568f},
-std::array<float,2>{0.720083952f, 0.665179074f},
-std::array<float,2>{0.00666547893f, 0.191991329f},
-std::array<float,2>{0.917938948f, 0.47529912f},
-std::array<float,2>{0.319994003f, 0.836494684f},
-std::array<float,2>{0.674654365f, 0.936665654f},
-std::array<float,2>{0.0958728045f, 0.256755561f},
-std::array<float,2>{0.996243298f, 0.0236636009f},
-std::array<float,2>{0.279917926f, 0.559742451f},
-std::array<float,2>{0.777143359f, 0.7299909f},
-std::array<float,2>{0.414152116f, 0.175189719f},
-std::array<float,2>{0.54989022f, 0.425593466f},
-std::array<float,2>{0.174003839f, 0.751758695f},
-std::array<float,2>{0.876625538f, 0.862775207f},
-std::array<float,2>{0.371099561f, 0.457384706f},
-std::array<float,2>{0.698956072f, 0.228012815f},
-std::array<float,2>{0.0481914431f, 0.647206068f},
-std::array<float,2>{0.563527822f, 0.621665061f},
-std::array<float,2>{0.233209312f, 0.0951537862f},
-std::array<float,2>{0.821043968f, 0.334164351f},
-std::array<float,2>{0.468901128f, 0.975240409f},
-std::array<float,2>{0.710815489f, 0.821427643f},
-std::array<float,2>{0.0326506384f, 0.484783739f},
-std::array<float,2>{0.903840244f, 0.213272557f},
-std::array<float,2>{0.356134027f, 0.679261863f},
-std::array<float,2>{0.830964386f, 0.581442654f},
-std::array<float,2>{0.498147219f, 0.0685936436f},
-std::array<float,2>{0.589122653f, 0.35392338f},
-std::array<float,2>{0.237734601f, 0.954710364f},
-std::array<float,2>{0.97408843f, 0.884370983f},
-std::array<float,2>{0.253861725f, 0.310949355f},
-std::array<float,2>{0.663078427f, 0.0516897514f},
-std::array<float,2>{0.120514333f, 0.514859438f},
-std::array<float,2>{0.54424417f, 0.692777395f},
-std::array<float,2>{0.16174306f, 0.135783747f},
-std::array<float,2>{0.753873289f, 0.399293333f},
-std::array<float,2>{0.426660031f, 0.795302868f},
-std::array<float,2>{0.600362182f, 0.998994112f},
-std::array<float,2>{0.216395244f, 0.321254283f},
-std::array<float,2>{0.844390154f, 0.110691011f},
-std::array<float,2>{0.440362155f, 0.600002408f},
-std::array<float,2>{0.923578024f, 0.625388741f},
-std::array<float,2>{0.334744185f, 0.249321342f},
-std::array<float,2>{0.742109239f, 0.442270875f},
-std::array<float,2>{0.0272902884f, 0.848484874f},
-std::array<float,2>{0.802589297f, 0.774130523f},
-std::array<float,2>{0.382594883f, 0.418299824f},
-std::array<float,2>{0.502077579f, 0.16746223f},
-std::array<float,2>{0.140657842f, 0.748608351f},
-std::array<float,2>{0.631294429f, 0.531522691f},
-std::array<float,2>{0.0824140087f, 0.00897877663f},
-std::array<float,2>{0.944124639f, 0.274183512f},
-std::array<float,2>{0.284379959f, 0.911243081f},
-std::array<float,2>{0.583691776f, 0.859150231f},
-std::array<float,2>{0.244576544f, 0.452523351f},
-std::array<float,2>{0.836310625f, 0.241450965f},
-std::array<float,2>{0.485553831f, 0.637694895f},
-std::array<float,2>{0.894670606f, 0.606173813f},
-std::array<float,2>{0.350136876f, 0.124170251f},
-std::array<float,2>{0.713600934f, 0.314451486f},
-std::array<float,2>{0.0409281664f, 0.99059695f},
-std::array<float,2>{0.765227616f, 0.914838552f},
-std::array<float,2>{0.435229242f, 0.273041517f},
-std::array<float,2>{0.536573708f, 0.00436189957f},
-std::array<float,2>{0.170959279f, 0.539741576f},
-std::array<float,2>{0.666822553f, 0.738916457f},
-std::array<float,2>{0.117032595f, 0.161165863f},
-std::array<float,2>{0.979696333f, 0.408426255f},
-std::array<float,2>{0.258260846f, 0.773355544f},
-std::array<float,2>{0.743785441f, 0.967197597f},
-std::array<float,2>{0.019295603f, 0.346068293f},
-std::array<float,2>{0.931914568f, 0.0772890523f},
-std::array<float,2>{0.341022789f, 0.588406622f},
-std::array<float,2>{0.8518067f, 0.684042037f},
-std::array<float,2>{0.449156463f, 0.210045978f},
-std::array<float,2>{0.605067551f, 0.493499428f},
-std::array<float,2>{0.210892662f, 0.816270113f},
-std::array<float,2>{0.949967623f, 0.782985091f},
-std::array<float,2>{0.292674243f, 0.395856261f},
-std::array<float,2>{0.63834548f, 0.127067447f},
-std::array<float,2>{0.0889997631f, 0.700168133f},
-std::array<float,2>{0.514003634f, 0.502747715f},
-std::array<float,2>{0.15069063f, 0.0598530658f},
-std::array<float,2>{0.804793298f, 0.302012444f},
-std::array<float,2>{0.384881079f, 0.882425785f},
-std::array<float,2>{0.644397318f, 0.763588428f},
-std::array<float,2>{0.0745948181f, 0.433789432f},
-std::array<float,2>{0.953456998f, 0.183665022f},
-std::array<float,2>{0.303829849f, 0.725821555f},
-std::array<float,2>{0.794844091f, 0.554682195f},
-std::array<float,2>{0.394096136f, 0.0229962971f},
-std::array<float,2>{0.52791816f, 0.260702729f},
-std::array<float,2>{0.131675631f, 0.928529143f},
-std::array<float,2>{0.910690308f, 0.979568541f},
-std::array<float,2>{0.325620621f, 0.336357355f},
-std::array<float,2>{0.730302751f, 0.107686952f},
-std::array<float,2>{0.0141859511f, 0.611357391f},
-std::array<float,2>{0.61499685f, 0.651320457f},
-std::array<float,2>{0.200746149f, 0.226314366f},
-std::array<float,2>{0.861583471f, 0.466816038f},
-std::array<float,2>{0.454351991f, 0.873243868f},
-std::array<float,2>{0.556139588f, 0.903708279f},
-std::array<float,2>{0.187168583f, 0.282052398f},
-std::array<float,2>{0.76694268f, 0.0409649946f},
-std::array<float,2>{0.413439274f, 0.527959168f},
-std::array<float,2>{0.987594843f, 0.715435266f},
-std::array<float,2>{0.268302113f, 0.154776722f},
-std::array<float,2>{0.68406111f, 0.37771365f},
-std::array<float,2>{0.108847357f, 0.796947718f},
-std::array<float,2>{0.82018733f, 0.83465308f},
-std::array<float,2>{0.482014805f, 0.484079927f},
-std::array<float,2>{0.576037705f, 0.19608058f},
-std::array<float,2>{0.220320925f, 0.661149681f},
-std::array<float,2>{0.688348949f, 0.562959015f},
-std::array<float,2>{0.0623348355f, 0.0852954909f},
-std::array<float,2>{0.890468776f, 0.371777207f},
-std::array<float,2>{0.365856558f, 0.939896405f},
-std::array<float,2>{0.511365294f, 0.865291357f},
-std::array<float,2>{0.155876145f, 0.456096858f},
-std::array<float,2>{0.809068024f, 0.233417347f},
-std::array<float,2>{0.390413851f, 0.641015232f},
-std::array<float,2>{0.948967159f, 0.620365083f},
-std::array<float,2>{0.295545667f, 0.101448826f},
-std::array<float,2>{0.636291325f, 0.33137846f},
-std::array<float,2>{0.0912162364f, 0.969008565f},
-std::array<float,2>{0.858552635f, 0.933564782f},
-std::array<float,2>{0.450435489f, 0.250277936f},
-std::array<float,2>{0.607144415f, 0.0284728799f},
-std::array<float,2>{0.203221798f, 0.55857718f},
-std::array<float,2>{0.747220993f, 0.733054578f},
-std::array<float,2>{0.0224940218f, 0.178436875f},
-std::array<float,2>{0.937315404f, 0.42620647f},
-std::array<float,2>{0.337117136f, 0.756412148f},
-std::array<float,2>{0.670267403f, 0.950269461f},
-std::array<float,2>{0.113086127f, 0.364323944f},
-std::array<float,2>{0.980493188f, 0.0870803818f},
-std::array<float,2>{0.264565349f, 0.57430166f},
-std::array<float,2>{0.75803107f, 0.671513617f},
-std::array<float,2>{0.433514118f, 0.189529061f},
-std::array<float,2>{0.534478903f, 0.469742179f},
-std::array<float,2>{0.166084513f, 0.841490746f},
-std::array<float,2>{0.893630326f, 0.811899126f},
-std::array<float,2>{0.347361714f, 0.38560161f},
-std::array<float,2>{0.717328072f, 0.141055465f},
-std::array<float,2>{0.0443500765f, 0.710058928f},
-std::array<float,2>{0.579680681f, 0.522745669f},
-std::array<float,2>{0.246171728f, 0.0320053399f},
-std::array<float,2>{0.840570748f, 0.29492411f},
-std::array<float,2>{0.490628421f, 0.897363186f},
-std::array<float,2>{0.695190251f, 0.778578758f},
-std::array<float,2>{0.054944355f, 0.414841294f},
-std::array<float,2>{0.885468602f, 0.169953316f},
-std::array<float,2>{0.361148238f, 0.745122075f},
-std::array<float,2>{0.813763976f, 0.538803995f},
-std::array<float,2>{0.477156699f, 0.0118398694f},
-std::array<float,2>{0.572088659f, 0.278166324f},
-std::array<float,2>{0.222830832f, 0.907225072f},
-std::array<float,2>{0.988607407f, 0.992817461f},
-std::array<float,2>{0.2707479f, 0.32753399f},
-std::array<float,2>{0.681488514f, 0.11598406f},
-std::array<float,2>{0.103240684f, 0.595466435f},
-std::array<float,2>{0.558598638f, 0.631941319f},
-std::array<float,2>{0.181961194f, 0.242531031f},
-std::array<float,2>{0.772642851f, 0.441209704f},
-std::array<float,2>{0.409583867f, 0.84475106f},
-std::array<float,2>{0.609550834f, 0.889452457f},
-std::array<float,2>{0.19719103f, 0.307932228f},
-std::array<float,2>{0.866532505f, 0.0470073372f},
-std::array<float,2>{0.458008558f, 0.510971308f},
-std::array<float,2>{0.909085572f, 0.688023448f},
-std::array<float,2>{0.320695907f, 0.139573157f},
-std::array<float,2>{0.731606483f, 0.403509557f},
-std::array<float,2>{0.00950577669f, 0.792282999f},
-std::array<float,2>{0.789327741f, 0.826190293f},
-std::array<float,2>{0.396925747f, 0.48894763f},
-std::array<float,2>{0.526259661f, 0.215244785f},
-std::array<float,2>{0.128144681f, 0.673734069f},
-std::array<float,2>{0.646758199f, 0.58270961f},
-std::array<float,2>{0.0707249343f, 0.0644192621f},
-std::array<float,2>{0.960759401f, 0.358597547f},
-std::array<float,2>{0.300753802f, 0.958551466f},
-std::array<float,2>{0.568155408f, 0.787571013f},
-std::array<float,2>{0.228285864f, 0.394254267f},
-std::array<float,2>{0.825592995f, 0.131510034f},
-std::array<float,2>{0.473030835f, 0.698494494f},
-std::array<float,2>{0.88162905f, 0.504824996f},
-std::array<float,2>{0.368582189f, 0.0566564836f},
-std::array<float,2>{0.703018188f, 0.299540669f},
-std::array<float,2>{0.0541627258f, 0.877013028f},
-std::array<float,2>{0.779152036f, 0.961290836f},
-std::array<float,2>{0.420511991f, 0.347868562f},
-std::array<float,2>{0.552820385f, 0.0740332305f},
-std::array<float,2>{0.177534267f, 0.592722058f},
-std::array<float,2>{0.677420557f, 0.682126343f},
-std::array<float,2>{0.0986568183f, 0.203759775f},
-std::array<float,2>{0.994491637f, 0.497555494f},
-std::array<float,2>{0.274023294f, 0.819457829f},
-std::array<float,2>{0.723100722f, 0.920532286f},
-std::array<float,2>{0.001627399f, 0.268545389f},
-std::array<float,2>{0.921446145f, 0.00222177198f},
-std::array<float,2>{0.313570917f, 0.54468447f},
-std::array<float,2>{0.872605324f, 0.736404538f},
-std::array<float,2>{0.461898506f, 0.158653736f},
-std::array<float,2>{0.6201666f, 0.413630486f},
-std::array<float,2>{0.190066129f, 0.767585516f},
-std::array<float,2>{0.962198436f, 0.852030516f},
-std::array<float,2>{0.305281967f, 0.447271436f},
-std::array<float,2>{0.649915338f, 0.235189244f},
-std::array<float,2>{0.0648674518f, 0.63357532f},
-std::array<float,2>{0.520328283f, 0.604381502f},
-std::array<float,2>{0.13753815f, 0.117363602f},
-std::array<float,2>{0.781324744f, 0.317711473f},
-std::array<float,2>{0.402064472f, 0.986430883f},
-std::array<float,2>{0.628093481f, 0.832003713f},
-std::array<float,2>{0.0798131675f, 0.479002833f},
-std::array<float,2>{0.940515697f, 0.202038616f},
-std::array<float,2>{0.288521618f, 0.658571482f},
-std::array<float,2>{0.799105525f, 0.566582441f},
-std::array<float,2>{0.375666916f, 0.0813426375f},
-std::array<float,2>{0.504218042f, 0.36948052f},
-std::array<float,2>{0.145932809f, 0.941459596f},
-std::array<float,2>{0.928299367f, 0.901225686f},
-std::array<float,2>{0.330900818f, 0.287968099f},
-std::array<float,2>{0.73741889f, 0.0452560857f},
-std::array<float,2>{0.030118363f, 0.526622176f},
-std::array<float,2>{0.595745564f, 0.714625835f},
-std::array<float,2>{0.212919727f, 0.151917979f},
-std::array<float,2>{0.848040164f, 0.381901234f},
-std::array<float,2>{0.443615377f, 0.801387489f},
-std::array<float,2>{0.541401863f, 0.9813115f},
-std::array<float,2>{0.158147842f, 0.340250313f},
-std::array<float,2>{0.756366849f, 0.102516748f},
-std::array<float,2>{0.422724187f, 0.615145445f},
-std::array<float,2>{0.970996261f, 0.655949712f},
-std::array<float,2>{0.255202293f, 0.222315505f},
-std::array<float,2>{0.657876492f, 0.463953942f},
-std::array<float,2>{0.121352009f, 0.868659437f},
-std::array<float,2>{0.833357573f, 0.76030767f},
-std::array<float,2>{0.492411464f, 0.432410806f},
-std::array<float,2>{0.592414916f, 0.181999281f},
-std::array<float,2>{0.240003064f, 0.721088231f},
-std::array<float,2>{0.706577182f, 0.550699294f},
-std::array<float,2>{0.038286671f, 0.0181809571f},
-std::array<float,2>{0.898680449f, 0.264588118f},
-std::array<float,2>{0.354065806f, 0.924660742f},
-std::array<float,2>{0.54775089f, 0.75359565f},
-std::array<float,2>{0.173073307f, 0.423699528f},
-std::array<float,2>{0.77469182f, 0.172082826f},
-std::array<float,2>{0.416134208f, 0.727117181f},
-std::array<float,2>{0.998226106f, 0.562459946f},
-std::array<float,2>{0.279171616f, 0.0262335949f},
-std::array<float,2>{0.672394633f, 0.253907919f},
-std::array<float,2>{0.0939960778f, 0.935036838f},
-std::array<float,2>{0.823980629f, 0.973111928f},
-std::array<float,2>{0.472469538f, 0.332082123f},
-std::array<float,2>{0.565592229f, 0.0962548032f},
-std::array<float,2>{0.231490836f, 0.624230027f},
-std::array<float,2>{0.696797669f, 0.645370364f},
-std::array<float,2>{0.0501857065f, 0.229386151f},
-std::array<float,2>{0.877159357f, 0.459358096f},
-std::array<float,2>{0.374809951f, 0.859736085f},
-std::array<float,2>{0.655507207f, 0.891575515f},
-std::array<float,2>{0.0687963068f, 0.29081744f},
-std::array<float,2>{0.965529799f, 0.0352261066f},
-std::array<float,2>{0.310152203f, 0.516618133f},
-std::array<float,2>{0.787571132f, 0.703240693f},
-std::array<float,2>{0.40492633f, 0.146134421f},
-std::array<float,2>{0.519186497f, 0.387419224f},
-std::array<float,2>{0.13408871f, 0.8074404f},
-std::array<float,2>{0.914728224f, 0.838293314f},
-std::array<float,2>{0.317271829f, 0.473840654f},
-std::array<float,2>{0.722619236f, 0.194086477f},
-std::array<float,2>{0.004746377f, 0.666707397f},
-std::array<float,2>{0.624402106f, 0.573306799f},
-std::array<float,2>{0.195155263f, 0.0921071544f},
-std::array<float,2>{0.86856842f, 0.362039059f},
-std::array<float,2>{0.466813952f, 0.945374668f},
-std::array<float,2>{0.739911735f, 0.851208925f},
-std::array<float,2>{0.0245683882f, 0.443500757f},
-std::array<float,2>{0.924269915f, 0.247181654f},
-std::array<float,2>{0.332820565f, 0.628136814f},
-std::array<float,2>{0.845792949f, 0.599276841f},
-std::array<float,2>{0.437748551f, 0.111349672f},
-std::array<float,2>{0.598860145f, 0.322879404f},
-std::array<float,2>{0.217257604f, 0.997635007f},
-std::array<float,2>{0.942436934f, 0.912261784f},
-std::array<float,2>{0.282385111f, 0.277045071f},
-std::array<float,2>{0.630397737f, 0.0103003131f},
-std::array<float,2>{0.0857166201f, 0.534900665f},
-std::array<float,2>{0.500778675f, 0.746827841f},
-std::array<float,2>{0.1433395f, 0.165470779f},
-std::array<float,2>{0.804267168f, 0.420619547f},
-std::array<float,2>{0.379005879f, 0.776120186f},
-std::array<float,2>{0.587265432f, 0.956812799f},
-std::array<float,2>{0.235796615f, 0.353045762f},
-std::array<float,2>{0.829958022f, 0.0674061179f},
-std::array<float,2>{0.497948527f, 0.579802155f},
-std::array<float,2>{0.905521631f, 0.676405191f},
-std::array<float,2>{0.359303653f, 0.211647674f},
-std::array<float,2>{0.708478093f, 0.486391723f},
-std::array<float,2>{0.0349550918f, 0.823074996f},
-std::array<float,2>{0.750907302f, 0.793046713f},
-std::array<float,2>{0.429225683f, 0.400867432f},
-std::array<float,2>{0.545876026f, 0.134650171f},
-std::array<float,2>{0.163473189f, 0.694371641f},
-std::array<float,2>{0.662020564f, 0.512758791f},
-std::array<float,2>{0.118711889f, 0.0529851466f},
-std::array<float,2>{0.976067662f, 0.309955627f},
-std::array<float,2>{0.251496941f, 0.885063887f},
-std::array<float,2>{0.60333389f, 0.813420951f},
-std::array<float,2>{0.208324179f, 0.494850963f},
-std::array<float,2>{0.854255259f, 0.208635315f},
-std::array<float,2>{0.446316153f, 0.686521888f},
-std::array<float,2>{0.931059003f, 0.586499572f},
-std::array<float,2>{0.342031568f, 0.0754530057f},
-std::array<float,2>{0.745052814f, 0.344475567f},
-std::array<float,2>{0.0156887267f, 0.966286123f},
-std::array<float,2>{0.807157457f, 0.879914701f},
-std::array<float,2>{0.384717256f, 0.304652929f},
-std::array<float,2>{0.512304962f, 0.0624824241f},
-std::array<float,2>{0.150166899f, 0.50118649f},
-std::array<float,2>{0.639536917f, 0.702694297f},
-std::array<float,2>{0.0876506567f, 0.125989109f},
-std::array<float,2>{0.951432943f, 0.397640407f},
-std::array<float,2>{0.289344251f, 0.784740984f},
-std::array<float,2>{0.711412847f, 0.988508403f},
-std::array<float,2>{0.0414789766f, 0.315275222f},
-std::array<float,2>{0.897557914f, 0.122949079f},
-std::array<float,2>{0.348501146f, 0.607946336f},
-std::array<float,2>{0.838709772f, 0.640267193f},
-std::array<float,2>{0.486736864f, 0.239109963f},
-std::array<float,2>{0.584101737f, 0.449399114f},
-std::array<float,2>{0.242603675f, 0.856407464f},
-std::array<float,2>{0.977169156f, 0.770356476f},
-std::array<float,2>{0.260220498f, 0.407053292f},
-std::array<float,2>{0.665454865f, 0.163557395f},
-std::array<float,2>{0.113405444f, 0.740801036f},
-std::array<float,2>{0.538717449f, 0.541882396f},
-std::array<float,2>{0.169821233f, 0.00687893946f},
-std::array<float,2>{0.762081444f, 0.271123081f},
-std::array<float,2>{0.437476844f, 0.91703862f},
-std::array<float,2>{0.68646735f, 0.800063968f},
-std::array<float,2>{0.105742536f, 0.376161695f},
-std::array<float,2>{0.984377205f, 0.152464941f},
-std::array<float,2>{0.266135663f, 0.717116237f},
-std::array<float,2>{0.768313348f, 0.530241847f},
-std::array<float,2>{0.410420716f, 0.042873662f},
-std::array<float,2>{0.55771178f, 0.283977211f},
-std::array<float,2>{0.183819145f, 0.90554297f},
-std::array<float,2>{0.888658404f, 0.939038157f},
-std::array<float,2>{0.363867998f, 0.374332607f},
-std::array<float,2>{0.691158831f, 0.0836685151f},
-std::array<float,2>{0.0588650778f, 0.565841377f},
-std::array<float,2>{0.577597678f, 0.662870586f},
-std::array<float,2>{0.221298561f, 0.198855698f},
-std::array<float,2>{0.818358302f, 0.480736613f},
-std::array<float,2>{0.484188497f, 0.833228648f},
-std::array<float,2>{0.529992104f, 0.926111579f},
-std::array<float,2>{0.129355371f, 0.258697361f},
-std::array<float,2>{0.796050012f, 0.0200239196f},
-std::array<float,2>{0.391225219f, 0.552003443f},
-std::array<float,2>{0.955419004f, 0.723617673f},
-std::array<float,2>{0.302028805f, 0.187088087f},
-std::array<float,2>{0.642488122f, 0.435825258f},
-std::array<float,2>{0.0770667344f, 0.765458703f},
-std::array<float,2>{0.861312926f, 0.871276915f},
-std::array<float,2>{0.456719369f, 0.464952826f},
-std::array<float,2>{0.615565717f, 0.224464431f},
-std::array<float,2>{0.201686993f, 0.650058985f},
-std::array<float,2>{0.728401124f, 0.609531641f},
-std::array<float,2>{0.012251378f, 0.106571883f},
-std::array<float,2>{0.912933409f, 0.338115722f},
-std::array<float,2>{0.327110648f, 0.977700293f},
-std::array<float,2>{0.539790034f, 0.86857003f},
-std::array<float,2>{0.158810258f, 0.464694172f},
-std::array<float,2>{0.755486429f, 0.222166315f},
-std::array<float,2>{0.42519775f, 0.655570865f},
-std::array<float,2>{0.970461369f, 0.614642799f},
-std::array<float,2>{0.25636974f, 0.101746999f},
-std::array<float,2>{0.658357799f, 0.340575844f},
-std::array<float,2>{0.124562033f, 0.980765104f},
-std::array<float,2>{0.833993196f, 0.923840702f},
-std::array<float,2>{0.494932264f, 0.264148086f},
-std::array<float,2>{0.590201437f, 0.0179742854f},
-std::array<float,2>{0.2415113f, 0.550148189f},
-std::array<float,2>{0.703647912f, 0.721654654f},
-std::array<float,2>{0.0360597819f, 0.182610005f},
-std::array<float,2>{0.900911927f, 0.431736916f},
-std::array<float,2>{0.352143884f, 0.760047317f},
-std::array<float,2>{0.626756787f, 0.942247689f},
-std::array<float,2>{0.0808395445f, 0.369653612f},
-std::array<float,2>{0.9380638f, 0.0816202313f},
-std::array<float,2>{0.285397321f, 0.567284584f},
-std::array<float,2>{0.797612607f, 0.658732653f},
-std::array<float,2>{0.377742916f, 0.201561883f},
-std::array<float,2>{0.507455647f, 0.479219735f},
-std::array<float,2>{0.147381529f, 0.831123114f},
-std::array<float,2>{0.927619994f, 0.800790012f},
-std::array<float,2>{0.329258025f, 0.38253653f},
-std::array<float,2>{0.735770464f, 0.151650459f},
-std::array<float,2>{0.0282053817f, 0.713938117f},
-std::array<float,2>{0.594933391f, 0.526989222f},
-std::array<float,2>{0.212536186f, 0.0458868034f},
-std::array<float,2>{0.850738466f, 0.287561953f},
-std::array<float,2>{0.443037897f, 0.900400698f},
-std::array<float,2>{0.725037217f, 0.768110156f},
-std::array<float,2>{0.00345570175f, 0.41344884f},
-std::array<float,2>{0.919613421f, 0.15917322f},
-std::array<float,2>{0.315136671f, 0.737003565f},
-std::array<float,2>{0.874372721f, 0.544087946f},
-std::array<float,2>{0.464158922f, 0.00274563488f},
-std::array<float,2>{0.618037641f, 0.267777473f},
-std::array<float,2>{0.189314932f, 0.919954538f},
-std::array<float,2>{0.964117467f, 0.98714751f},
-std::array<float,2>{0.307355285f, 0.317896485f},
-std::array<float,2>{0.650686026f, 0.118041582f},
-std::array<float,2>{0.0643759668f, 0.603962243f},
-std::array<float,2>{0.522381604f, 0.633212745f},
-std::array<float,2>{0.140319645f, 0.234444335f},
-std::array<float,2>{0.784317017f, 0.447890073f},
-std::array<float,2>{0.398469239f, 0.852051616f},
-std::array<float,2>{0.56845957f, 0.877834499f},
-std::array<float,2>{0.229284078f, 0.299223989f},
-std::array<float,2>{0.826247871f, 0.0572030246f},
-std::array<float,2>{0.475419432f, 0.504019678f},
-std::array<float,2>{0.880640328f, 0.698935747f},
-std::array<float,2>{0.370506018f, 0.130986363f},
-std::array<float,2>{0.700036764f, 0.393771291f},
-std::array<float,2>{0.0523921624f, 0.788028717f},
-std::array<float,2>{0.780140281f, 0.820290446f},
-std::array<float,2>{0.418548375f, 0.497749746f},
-std::array<float,2>{0.55271107f, 0.203431144f},
-std::array<float,2>{0.178729326f, 0.682599843f},
-std::array<float,2>{0.679249942f, 0.592138231f},
-std::array<float,2>{0.0998949185f, 0.0734294951f},
-std::array<float,2>{0.99229902f, 0.348585069f},
-std::array<float,2>{0.275887221f, 0.961568296f},
-std::array<float,2>{0.612318456f, 0.792772889f},
-std::array<float,2>{0.197973549f, 0.403949291f},
-std::array<float,2>{0.864386439f, 0.139011607f},
-std::array<float,2>{0.459192723f, 0.687891424f},
-std::array<float,2>{0.907538414f, 0.511416614f},
-std::array<float,2>{0.322523057f, 0.0478037558f},
-std::array<float,2>{0.733869731f, 0.30836761f},
-std::array<float,2>{0.0101693999f, 0.888884425f},
-std::array<float,2>{0.791284144f, 0.958086789f},
-std::array<float,2>{0.394863188f, 0.359243155f},
-std::array<float,2>{0.525351048f, 0.0636219159f},
-std::array<float,2>{0.125938013f, 0.582220078f},
-std::array<float,2>{0.64508605f, 0.672926545f},
-std::array<float,2>{0.073348254f, 0.215361267f},
-std::array<float,2>{0.95846349f, 0.488498539f},
-std::array<float,2>{0.297354996f, 0.82705158f},
-std::array<float,2>{0.69198066f, 0.906666636f},
-std::array<float,2>{0.0583089404f, 0.277539015f},
-std::array<float,2>{0.88433814f, 0.0125517203f},
-std::array<float,2>{0.363175988f, 0.538563132f},
-std::array<float,2>{0.81504941f, 0.745924592f},
-std::array<float,2>{0.479464054f, 0.170572519f},
-std::array<float,2>{0.573398292f, 0.414125323f},
-std::array<float,2>{0.225783512f, 0.779133797f},
-std::array<float,2>{0.991121948f, 0.845428705f},
-std::array<float,2>{0.273121923f, 0.440838963f},
-std::array<float,2>{0.682949185f, 0.242682055f},
-std::array<float,2>{0.105385579f, 0.632500708f},
-std::array<float,2>{0.561379671f, 0.595035791f},
-std::array<float,2>{0.181097671f, 0.115660131f},
-std::array<float,2>{0.77082634f, 0.327934086f},
-std::array<float,2>{0.406879604f, 0.992271781f},
-std::array<float,2>{0.66807127f, 0.840891957f},
-std::array<float,2>{0.11041864f, 0.470632583f},
-std::array<float,2>{0.982675135f, 0.190252617f},
-std::array<float,2>{0.263553202f, 0.67103225f},
-std::array<float,2>{0.760030746f, 0.574842095f},
-std::array<float,2>{0.430729687f, 0.0874585509f},
-std::array<float,2>{0.532708347f, 0.365088791f},
-std::array<float,2>{0.165414512f, 0.950793982f},
-std::array<float,2>{0.892375529f, 0.896776378f},
-std::array<float,2>{0.344084263f, 0.295826137f},
-std::array<float,2>{0.714990675f, 0.0316162966f},
-std::array<float,2>{0.0452470221f, 0.523288369f},
-std::array<float,2>{0.581233621f, 0.710563064f},
-std::array<float,2>{0.2484501f, 0.141465247f},
-std::array<float,2>{0.842963457f, 0.384785116f},
-std::array<float,2>{0.488388658f, 0.812328875f},
-std::array<float,2>{0.50902915f, 0.96937418f},
-std::array<float,2>{0.153001755f, 0.331882447f},
-std::array<float,2>{0.811053395f, 0.100613795f},
-std::array<float,2>{0.388359249f, 0.620740533f},
-std::array<float,2>{0.946981668f, 0.641387165f},
-std::array<float,2>{0.293114513f, 0.234338135f},
-std::array<float,2>{0.63404423f, 0.456888229f},
-std::array<float,2>{0.0932884961f, 0.86585331f},
-std::array<float,2>{0.855928898f, 0.755909622f},
-std::array<float,2>{0.451696128f, 0.426460713f},
-std::array<float,2>{0.608038366f, 0.178205967f},
-std::array<float,2>{0.206138477f, 0.732567668f},
-std::array<float,2>{0.749476135f, 0.558080018f},
-std::array<float,2>{0.0213162079f, 0.0292683821f},
-std::array<float,2>{0.934293628f, 0.250961274f},
-std::array<float,2>{0.338931948f, 0.932796836f},
-std::array<float,2>{0.527459383f, 0.765131295f},
-std::array<float,2>{0.130996466f, 0.436444134f},
-std::array<float,2>{0.794241428f, 0.186765864f},
-std::array<float,2>{0.394039124f, 0.722900033f},
-std::array<float,2>{0.953906f, 0.552690387f},
-std::array<float,2>{0.304342657f, 0.0196895041f},
-std::array<float,2>{0.643565416f, 0.258132726f},
-std::array<float,2>{0.0748450235f, 0.926540136f},
-std::array<float,2>{0.862257183f, 0.978273809f},
-std::array<float,2>{0.454911262f, 0.338477135f},
-std::array<float,2>{0.614654958f, 0.10735105f},
-std::array<float,2>{0.200530216f, 0.609932065f},
-std::array<float,2>{0.729568958f, 0.649555206f},
-std::array<float,2>{0.0138117867f, 0.224072039f},
-std::array<float,2>{0.910222948f, 0.465489715f},
-std::array<float,2>{0.325830877f, 0.871674955f},
-std::array<float,2>{0.684430957f, 0.905948758f},
-std::array<float,2>{0.109156065f, 0.283618093f},
-std::array<float,2>{0.988175333f, 0.0420012586f},
-std::array<float,2>{0.26781103f, 0.529592156f},
-std::array<float,2>{0.767519593f, 0.717645109f},
-std::array<float,2>{0.413674295f, 0.152935579f},
-std::array<float,2>{0.556555212f, 0.376698136f},
-std::array<float,2>{0.186764047f, 0.800294638f},
-std::array<float,2>{0.889842331f, 0.833682418f},
-std::array<float,2>{0.365455002f, 0.481365383f},
-std::array<float,2>{0.68788147f, 0.198575169f},
-std::array<float,2>{0.0615315102f, 0.662330806f},
-std::array<float,2>{0.575220704f, 0.565960109f},
-std::array<float,2>{0.219729781f, 0.0833507404f},
-std::array<float,2>{0.819412231f, 0.374582201f},
-std::array<float,2>{0.481904835f, 0.938709199f},
-std::array<float,2>{0.713098466f, 0.855776191f},
-std::array<float,2>{0.0402413644f, 0.450086683f},
-std::array<float,2>{0.895437419f, 0.23872675f},
-std::array<float,2>{0.349773347f, 0.640111923f},
-std::array<float,2>{0.836825788f, 0.607605755f},
-std::array<float,2>{0.486035526f, 0.122435078f},
-std::array<float,2>{0.583263516f, 0.314521015f},
-std::array<float,2>{0.24491781f, 0.988951564f},
-std::array<float,2>{0.980266154f, 0.917948782f},
-std::array<float,2>{0.258388817f, 0.270872027f},
-std::array<float,2>{0.666342556f, 0.00769290747f},
-std::array<float,2>{0.1163726f, 0.541160166f},
-std::array<float,2>{0.536925733f, 0.740363061f},
-std::array<float,2>{0.171486288f, 0.163997591f},
-std::array<float,2>{0.764731884f, 0.406339258f},
-std::array<float,2>{0.435034871f, 0.769738853f},
-std::array<float,2>{0.604872406f, 0.966651917f},
-std::array<float,2>{0.210414484f, 0.344007134f},
-std::array<float,2>{0.852150261f, 0.0760876834f},
-std::array<float,2>{0.448541611f, 0.586172998f},
-std::array<float,2>{0.932538807f, 0.685897291f},
-std::array<float,2>{0.341683477f, 0.208182544f},
-std::array<float,2>{0.743490875f, 0.494596779f},
-std::array<float,2>{0.0186677407f, 0.812767029f},
-std::array<float,2>{0.805380046f, 0.784237742f},
-std::array<float,2>{0.385552406f, 0.398143798f},
-std::array<float,2>{0.514234781f, 0.126796603f},
-std::array<float,2>{0.150971666f, 0.702359617f},
-std::array<float,2>{0.637877107f, 0.50153327f},
-std::array<float,2>{0.0895045251f, 0.061906442f},
-std::array<float,2>{0.949399829f, 0.304015458f},
-std::array<float,2>{0.292431593f, 0.880483329f},
-std::array<float,2>{0.589763224f, 0.822273552f},
-std::array<float,2>{0.238023415f, 0.487121999f},
-std::array<float,2>{0.830507338f, 0.211293817f},
-std::array<float,2>{0.498762518f, 0.676239252f},
-std::array<float,2>{0.903336704f, 0.579114676f},
-std::array<float,2>{0.355825037f, 0.0682860985f},
-std::array<float,2>{0.710142612f, 0.352736652f},
-std::array<float,2>{0.0330435745f, 0.956382036f},
-std::array<float,2>{0.753011823f, 0.885503232f},
-std::array<float,2>{0.426257938f, 0.310510486f},
-std::array<float,2>{0.544816077f, 0.053349074f},
-std::array<float,2>{0.161576062f, 0.513273358f},
-std::array<float,2>{0.662223935f, 0.695299506f},
-std::array<float,2>{0.120738775f, 0.13397257f},
-std::array<float,2>{0.974347532f, 0.400941491f},
-std::array<float,2>{0.253002703f, 0.793616772f},
-std::array<float,2>{0.741305947f, 0.99721992f},
-std::array<float,2>{0.0267806668f, 0.322507352f},
-std::array<float,2>{0.92311722f, 0.112205036f},
-std::array<float,2>{0.33445707f, 0.598928332f},
-std::array<float,2>{0.844078064f, 0.628831089f},
-std::array<float,2>{0.439862758f, 0.247648075f},
-std::array<float,2>{0.599709988f, 0.444297969f},
-std::array<float,2>{0.215934381f, 0.850660026f},
-std::array<float,2>{0.94357425f, 0.775871038f},
-std::array<float,2>{0.285092324f, 0.420130312f},
-std::array<float,2>{0.631632328f, 0.165963575f},
-std::array<float,2>{0.0827905759f, 0.746133983f},
-std::array<float,2>{0.502684534f, 0.534443915f},
-std::array<float,2>{0.141319036f, 0.0100451838f},
-std::array<float,2>{0.801881015f, 0.276619285f},
-std::array<float,2>{0.381909549f, 0.913003802f},
-std::array<float,2>{0.654116452f, 0.806846559f},
-std::array<float,2>{0.0674041808f, 0.386919677f},
-std::array<float,2>{0.968299687f, 0.145751819f},
-std::array<float,2>{0.311899245f, 0.704003453f},
-std::array<float,2>{0.786655009f, 0.51742357f},
-std::array<float,2>{0.403751552f, 0.0360141806f},
-std::array<float,2>{0.516708016f, 0.290410817f},
-std::array<float,2>{0.135808855f, 0.890848935f},
-std::array<float,2>{0.917103648f, 0.9458673f},
-std::array<float,2>{0.319517493f, 0.361786634f},
-std::array<float,2>{0.720687687f, 0.0926021934f},
-std::array<float,2>{0.00633471925f, 0.573992014f},
-std::array<float,2>{0.621855199f, 0.666163564f},
-std::array<float,2>{0.191749915f, 0.193823963f},
-std::array<float,2>{0.869911075f, 0.474203676f},
-std::array<float,2>{0.465591639f, 0.838785231f},
-std::array<float,2>{0.550514519f, 0.935376644f},
-std::array<float,2>{0.174324676f, 0.254834533f},
-std::array<float,2>{0.776790679f, 0.0256059654f},
-std::array<float,2>{0.414621174f, 0.561783195f},
-std::array<float,2>{0.996960819f, 0.726958632f},
-std::array<float,2>{0.279643327f, 0.172764301f},
-std::array<float,2>{0.673874974f, 0.423083454f},
-std::array<float,2>{0.0966354683f, 0.753146827f},
-std::array<float,2>{0.820480704f, 0.860052824f},
-std::array<float,2>{0.46933955f, 0.459824294f},
-std::array<float,2>{0.564219654f, 0.228776991f},
-std::array<float,2>{0.232741654f, 0.644585907f},
-std::array<float,2>{0.698321939f, 0.624886096f},
-std::array<float,2>{0.0485274456f, 0.0960406438f},
-std::array<float,2>{0.876031816f, 0.332813025f},
-std::array<float,2>{0.371710211f, 0.973507941f},
-std::array<float,2>{0.504724443f, 0.828276336f},
-std::array<float,2>{0.146450013f, 0.478069007f},
-std::array<float,2>{0.799675345f, 0.200483933f},
-std::array<float,2>{0.375474691f, 0.656464756f},
-std::array<float,2>{0.941263139f, 0.570213675f},
-std::array<float,2>{0.288891345f, 0.0794239342f},
-std::array<float,2>{0.628827989f, 0.3685776f},
-std::array<float,2>{0.0795354396f, 0.945152462f},
-std::array<float,2>{0.848291695f, 0.900313616f},
-std::array<float,2>{0.444229692f, 0.286432177f},
-std::array<float,2>{0.596578598f, 0.0433816463f},
-std::array<float,2>{0.21342653f, 0.524068296f},
-std::array<float,2>{0.738062084f, 0.71172291f},
-std::array<float,2>{0.0292983241f, 0.148831666f},
-std::array<float,2>{0.927794218f, 0.380416304f},
-std::array<float,2>{0.330219656f, 0.803938448f},
-std::array<float,2>{0.657242179f, 0.984288335f},
-std::array<float,2>{0.121651039f, 0.342217058f},
-std::array<float,2>{0.971451104f, 0.104260541f},
-std::array<float,2>{0.255681992f, 0.616023481f},
-std::array<float,2>{0.756215096f, 0.653252006f},
-std::array<float,2>{0.422196627f, 0.219997436f},
-std::array<float,2>{0.541603267f, 0.461019099f},
-std::array<float,2>{0.157345086f, 0.870005488f},
-std::array<float,2>{0.899044216f, 0.757925451f},
-std::array<float,2>{0.353816509f, 0.430835843f},
-std::array<float,2>{0.706198037f, 0.180480942f},
-std::array<float,2>{0.0386183523f, 0.718875945f},
-std::array<float,2>{0.591819763f, 0.546956241f},
-std::array<float,2>{0.239653364f, 0.0166623536f},
-std::array<float,2>{0.833509922f, 0.262797624f},
-std::array<float,2>{0.492785394f, 0.922873616f},
-std::array<float,2>{0.702269614f, 0.787007749f},
-std::array<float,2>{0.0544561334f, 0.391634017f},
-std::array<float,2>{0.88087374f, 0.129515663f},
-std::array<float,2>{0.368727386f, 0.696161628f},
-std::array<float,2>{0.825987756f, 0.505927444f},
-std::array<float,2>{0.473618239f, 0.0551974289f},
-std::array<float,2>{0.567535758f, 0.296890765f},
-std::array<float,2>{0.227615193f, 0.875728428f},
-std::array<float,2>{0.99498558f, 0.964112103f},
-std::array<float,2>{0.273550242f, 0.349883288f},
-std::array<float,2>{0.6768502f, 0.0707389712f},
-std::array<float,2>{0.0992153883f, 0.590943336f},
-std::array<float,2>{0.553490341f, 0.680003405f},
-std::array<float,2>{0.176831856f, 0.206085891f},
-std::array<float,2>{0.778741658f, 0.498165011f},
-std::array<float,2>{0.420185387f, 0.817291498f},
-std::array<float,2>{0.620960772f, 0.918555856f},
-std::array<float,2>{0.189499393f, 0.266854167f},
-std::array<float,2>{0.872519493f, 0.000195555011f},
-std::array<float,2>{0.461130172f, 0.545283854f},
-std::array<float,2>{0.92129761f, 0.735318184f},
-std::array<float,2>{0.314338297f, 0.156942219f},
-std::array<float,2>{0.723306358f, 0.411707729f},
-std::array<float,2>{0.00117710012f, 0.7674402f},
-std::array<float,2>{0.781754196f, 0.85397321f},
-std::array<float,2>{0.401567966f, 0.446918368f},
-std::array<float,2>{0.519591391f, 0.237420857f},
-std::array<float,2>{0.137058839f, 0.636629224f},
-std::array<float,2>{0.649753869f, 0.601845086f},
-std::array<float,2>{0.0651013479f, 0.120793559f},
-std::array<float,2>{0.962555945f, 0.318864554f},
-std::array<float,2>{0.304897338f, 0.985613406f},
-std::array<float,2>{0.571389854f, 0.780647397f},
-std::array<float,2>{0.223463833f, 0.417726398f},
-std::array<float,2>{0.813971698f, 0.16986689f},
-std::array<float,2>{0.476973385f, 0.742845476f},
-std::array<float,2>{0.884858727f, 0.536935329f},
-std::array<float,2>{0.360720932f, 0.014042546f},
-std::array<float,2>{0.694576919f, 0.279965699f},
-std::array<float,2>{0.0555414334f, 0.909439147f},
-std::array<float,2>{0.773278952f, 0.995633006f},
-std::array<float,2>{0.410074502f, 0.324806184f},
-std::array<float,2>{0.55910486f, 0.114234596f},
-std::array<float,2>{0.182403177f, 0.596542656f},
-std::array<float,2>{0.681089342f, 0.628976882f},
-std::array<float,2>{0.103022635f, 0.244808868f},
-std::array<float,2>{0.989071906f, 0.438956589f},
-std::array<float,2>{0.271171361f, 0.847533286f},
-std::array<float,2>{0.731964469f, 0.888448477f},
-std::array<float,2>{0.00894367136f, 0.305679858f},
-std::array<float,2>{0.908459663f, 0.0504316539f},
-std::array<float,2>{0.320814043f, 0.509731114f},
-std::array<float,2>{0.866910219f, 0.689910352f},
-std::array<float,2>{0.458831966f, 0.138152689f},
-std::array<float,2>{0.610085011f, 0.404890925f},
-std::array<float,2>{0.196674764f, 0.789622426f},
-std::array<float,2>{0.959995627f, 0.826166511f},
-std::array<float,2>{0.299849361f, 0.49060595f},
-std::array<float,2>{0.647295833f, 0.218676016f},
-std::array<float,2>{0.0708511472f, 0.675321579f},
-std::array<float,2>{0.525525451f, 0.584342599f},
-std::array<float,2>{0.128437251f, 0.0648549721f},
-std::array<float,2>{0.789848089f, 0.35674566f},
-std::array<float,2>{0.397039652f, 0.960666001f},
-std::array<float,2>{0.63597399f, 0.864780724f},
-std::array<float,2>{0.0917893052f, 0.453412086f},
-std::array<float,2>{0.948260665f, 0.232205495f},
-std::array<float,2>{0.295062602f, 0.643078744f},
-std::array<float,2>{0.809490025f, 0.619086087f},
-std::array<float,2>{0.389728636f, 0.0987304971f},
-std::array<float,2>{0.510938346f, 0.329910666f},
-std::array<float,2>{0.155625194f, 0.971722424f},
-std::array<float,2>{0.936985075f, 0.929709971f},
-std::array<float,2>{0.337636769f, 0.252277166f},
-std::array<float,2>{0.747989178f, 0.0294750854f},
-std::array<float,2>{0.0229838211f, 0.556322932f},
-std::array<float,2>{0.606566072f, 0.731987536f},
-std::array<float,2>{0.203883231f, 0.177235603f},
-std::array<float,2>{0.859268844f, 0.42778632f},
-std::array<float,2>{0.451084763f, 0.75541991f},
-std::array<float,2>{0.535108089f, 0.952560246f},
-std::array<float,2>{0.166599885f, 0.366078049f},
-std::array<float,2>{0.758526266f, 0.0895367786f},
-std::array<float,2>{0.433030248f, 0.576705754f},
-std::array<float,2>{0.981147945f, 0.668517113f},
-std::array<float,2>{0.263963521f, 0.189268231f},
-std::array<float,2>{0.670556128f, 0.471972108f},
-std::array<float,2>{0.112631932f, 0.842935026f},
-std::array<float,2>{0.839918017f, 0.810433924f},
-std::array<float,2>{0.490988106f, 0.383280665f},
-std::array<float,2>{0.579586387f, 0.142916545f},
-std::array<float,2>{0.246770233f, 0.707761943f},
-std::array<float,2>{0.716833889f, 0.520125389f},
-std::array<float,2>{0.044584062f, 0.0343140252f},
-std::array<float,2>{0.894334912f, 0.293375611f},
-std::array<float,2>{0.347026318f, 0.895910084f},
-std::array<float,2>{0.55827415f, 0.797816813f},
-std::array<float,2>{0.184251651f, 0.377146155f},
-std::array<float,2>{0.767795086f, 0.155252546f},
-std::array<float,2>{0.410883725f, 0.715203881f},
-std::array<float,2>{0.985002398f, 0.527822137f},
-std::array<float,2>{0.265714049f, 0.0400439315f},
-std::array<float,2>{0.685789227f, 0.281589627f},
-std::array<float,2>{0.106032886f, 0.904030085f},
-std::array<float,2>{0.817779064f, 0.940267086f},
-std::array<float,2>{0.483772039f, 0.371455818f},
-std::array<float,2>{0.578032076f, 0.0858125985f},
-std::array<float,2>{0.220846131f, 0.563108146f},
-std::array<float,2>{0.690630913f, 0.66186136f},
-std::array<float,2>{0.059441112f, 0.195718959f},
-std::array<float,2>{0.888116241f, 0.483706921f},
-std::array<float,2>{0.363578767f, 0.834086239f},
-std::array<float,2>{0.6417377f, 0.928203642f},
-std::array<float,2>{0.0766084641f, 0.259941578f},
-std::array<float,2>{0.955686808f, 0.0227168147f},
-std::array<float,2>{0.302436143f, 0.554032445f},
-std::array<float,2>{0.79685992f, 0.726375699f},
-std::array<float,2>{0.390896201f, 0.184560984f},
-std::array<float,2>{0.529547334f, 0.434447348f},
-std::array<float,2>{0.129588068f, 0.763105571f},
-std::array<float,2>{0.912300527f, 0.873817325f},
-std::array<float,2>{0.326589018f, 0.467494905f},
-std::array<float,2>{0.727635324f, 0.225970939f},
-std::array<float,2>{0.0119965868f, 0.650841355f},
-std::array<float,2>{0.616033018f, 0.611878216f},
-std::array<float,2>{0.201320335f, 0.10836044f},
-std::array<float,2>{0.860782325f, 0.336911976f},
-std::array<float,2>{0.45609197f, 0.980372846f},
-std::array<float,2>{0.744441926f, 0.815686762f},
-std::array<float,2>{0.016134588f, 0.494133264f},
-std::array<float,2>{0.931428134f, 0.210756406f},
-std::array<float,2>{0.34271425f, 0.6845119f},
-std::array<float,2>{0.853615582f, 0.588241577f},
-std::array<float,2>{0.447174668f, 0.0780684873f},
-std::array<float,2>{0.602745056f, 0.346424311f},
-std::array<float,2>{0.208736539f, 0.967509091f},
-std::array<float,2>{0.951851726f, 0.881936312f},
-std::array<float,2>{0.289598018f, 0.302618235f},
-std::array<float,2>{0.638676763f, 0.0602294616f},
-std::array<float,2>{0.0870284736f, 0.502407849f},
-std::array<float,2>{0.511808872f, 0.699422956f},
-std::array<float,2>{0.149760887f, 0.127474755f},
-std::array<float,2>{0.806969643f, 0.396443158f},
-std::array<float,2>{0.383939534f, 0.78265202f},
-std::array<float,2>{0.58485359f, 0.990947247f},
-std::array<float,2>{0.242965162f, 0.313508958f},
-std::array<float,2>{0.837915897f, 0.124531969f},
-std::array<float,2>{0.48694104f, 0.605706871f},
-std::array<float,2>{0.898149431f, 0.636841178f},
-std::array<float,2>{0.347860605f, 0.242121011f},
-std::array<float,2>{0.711664081f, 0.453039259f},
-std::array<float,2>{0.0415684879f, 0.858676195f},
-std::array<float,2>{0.762670994f, 0.772616863f},
-std::array<float,2>{0.436557025f, 0.409108579f},
-std::array<float,2>{0.538355529f, 0.161843956f},
-std::array<float,2>{0.169085383f, 0.738345087f},
-std::array<float,2>{0.665786207f, 0.539184093f},
-std::array<float,2>{0.113922164f, 0.00487310113f},
-std::array<float,2>{0.976604342f, 0.272820234f},
-std::array<float,2>{0.260279596f, 0.914222836f},
-std::array<float,2>{0.599352837f, 0.847951174f},
-std::array<float,2>{0.217352703f, 0.441654056f},
-std::array<float,2>{0.84640193f, 0.249597937f},
-std::array<float,2>{0.438221067f, 0.625680208f},
-std::array<float,2>{0.924505115f, 0.600178599f},
-std::array<float,2>{0.332485497f, 0.110939875f},
-std::array<float,2>{0.739322245f, 0.32041952f},
-std::array<float,2>{0.025250474f, 0.998164475f},
-std::array<float,2>{0.80393225f, 0.9118976f},
-std::array<float,2>{0.379565597f, 0.273874491f},
-std::array<float,2>{0.500051439f, 0.00970517751f},
-std::array<float,2>{0.142880902f, 0.53182447f},
-std::array<float,2>{0.630218029f, 0.748273969f},
-std::array<float,2>{0.085069567f, 0.167924866f},
-std::array<float,2>{0.943284035f, 0.418520868f},
-std::array<float,2>{0.28276813f, 0.773542285f},
-std::array<float,2>{0.70886749f, 0.954367399f},
-std::array<float,2>{0.0346440263f, 0.354324669f},
-std::array<float,2>{0.905907452f, 0.0690218285f},
-std::array<float,2>{0.358430594f, 0.581884682f},
-std::array<float,2>{0.829280615f, 0.678750157f},
-std::array<float,2>{0.497430354f, 0.21361275f},
-std::array<float,2>{0.587811887f, 0.485252619f},
-std::array<float,2>{0.235932335f, 0.82208252f},
-std::array<float,2>{0.976469934f, 0.795658946f},
-std::array<float,2>{0.251161903f, 0.398859322f},
-std::array<float,2>{0.66127187f, 0.136667892f},
-std::array<float,2>{0.118494138f, 0.69300139f},
-std::array<float,2>{0.545240402f, 0.515534818f},
-std::array<float,2>{0.163975969f, 0.0512178242f},
-std::array<float,2>{0.750299633f, 0.311071366f},
-std::array<float,2>{0.429165781f, 0.884156406f},
-std::array<float,2>{0.672199726f, 0.751204073f},
-std::array<float,2>{0.0942533389f, 0.424842536f},
-std::array<float,2>{0.99854058f, 0.175736979f},
-std::array<float,2>{0.278419465f, 0.729521513f},
-std::array<float,2>{0.775231838f, 0.560105026f},
-std::array<float,2>{0.416564405f, 0.0241577551f},
-std::array<float,2>{0.547358215f, 0.256044745f},
-std::array<float,2>{0.173382953f, 0.937284172f},
-std::array<float,2>{0.877626419f, 0.975061297f},
-std::array<float,2>{0.374185681f, 0.334831804f},
-std::array<float,2>{0.696344554f, 0.0953769311f},
-std::array<float,2>{0.0505414009f, 0.621520698f},
-std::array<float,2>{0.566078305f, 0.646735847f},
-std::array<float,2>{0.232102022f, 0.228237048f},
-std::array<float,2>{0.823365152f, 0.45772019f},
-std::array<float,2>{0.471706659f, 0.863065124f},
-std::array<float,2>{0.518834233f, 0.892875075f},
-std::array<float,2>{0.134533793f, 0.291062772f},
-std::array<float,2>{0.788043201f, 0.0374940522f},
-std::array<float,2>{0.404611886f, 0.517881095f},
-std::array<float,2>{0.964847386f, 0.705498338f},
-std::array<float,2>{0.310045809f, 0.147949472f},
-std::array<float,2>{0.655793667f, 0.388676733f},
-std::array<float,2>{0.0688782111f, 0.804857254f},
-std::array<float,2>{0.868939161f, 0.836405098f},
-std::array<float,2>{0.467403442f, 0.475056171f},
-std::array<float,2>{0.624975324f, 0.191659153f},
-std::array<float,2>{0.194546819f, 0.66599226f},
-std::array<float,2>{0.721769214f, 0.570781767f},
-std::array<float,2>{0.00408502994f, 0.0905265138f},
-std::array<float,2>{0.914405644f, 0.360577762f},
-std::array<float,2>{0.316718251f, 0.947555006f},
-std::array<float,2>{0.551053882f, 0.817809701f},
-std::array<float,2>{0.178303242f, 0.499597251f},
-std::array<float,2>{0.780287445f, 0.205335885f},
-std::array<float,2>{0.419394225f, 0.681138337f},
-std::array<float,2>{0.993382335f, 0.590711474f},
-std::array<float,2>{0.277274817f, 0.0714426786f},
-std::array<float,2>{0.677833855f, 0.351180345f},
-std::array<float,2>{0.101081714f, 0.96333307f},
-std::array<float,2>{0.827432036f, 0.876797557f},
-std::array<float,2>{0.476463109f, 0.298080713f},
-std::array<float,2>{0.569768131f, 0.0557808988f},
-std::array<float,2>{0.230307594f, 0.507269979f},
-std::array<float,2>{0.701093256f, 0.696900129f},
-std::array<float,2>{0.05170203f, 0.130014718f},
-std::array<float,2>{0.879421532f, 0.391033113f},
-std::array<float,2>{0.369346917f, 0.786084354f},
-std::array<float,2>{0.651831865f, 0.985004067f},
-std::array<float,2>{0.0627631098f, 0.319819272f},
-std::array<float,2>{0.963628232f, 0.119628474f},
-std::array<float,2>{0.308008999f, 0.603468418f},
-std::array<float,2>{0.784086704f, 0.635496914f},
-std::array<float,2>{0.399667203f, 0.237181768f},
-std::array<float,2>{0.523151398f, 0.445758462f},
-std::array<float,2>{0.138685897f, 0.855202138f},
-std::array<float,2>{0.917987049f, 0.766500473f},
-std::array<float,2>{0.316335648f, 0.410953522f},
-std::array<float,2>{0.726248205f, 0.158140406f},
-std::array<float,2>{0.00204195315f, 0.735727727f},
-std::array<float,2>{0.618942499f, 0.546457171f},
-std::array<float,2>{0.187825799f, 0.00176769565f},
-std::array<float,2>{0.873435497f, 0.265977025f},
-std::array<float,2>{0.463232845f, 0.919623911f},
-std::array<float,2>{0.734553277f, 0.803565681f},
-std::array<float,2>{0.0287530217f, 0.37892285f},
-std::array<float,2>{0.925830305f, 0.149610475f},
-std::array<float,2>{0.328718513f, 0.712565303f},
-std::array<float,2>{0.850457072f, 0.524678409f},
-std::array<float,2>{0.441522479f, 0.0446561016f},
-std::array<float,2>{0.593899369f, 0.285915941f},
-std::array<float,2>{0.211360902f, 0.898794591f},
-std::array<float,2>{0.938953102f, 0.943566263f},
-std::array<float,2>{0.286345392f, 0.368041188f},
-std::array<float,2>{0.625834286f, 0.0787011534f},
-std::array<float,2>{0.0816773996f, 0.568638802f},
-std::array<float,2>{0.506784141f, 0.65816617f},
-std::array<float,2>{0.147637069f, 0.199239612f},
-std::array<float,2>{0.798027754f, 0.476976842f},
-std::array<float,2>{0.378269464f, 0.829541862f},
-std::array<float,2>{0.591415346f, 0.922382951f},
-std::array<float,2>{0.240375042f, 0.262340277f},
-std::array<float,2>{0.835291028f, 0.0160086565f},
-std::array<float,2>{0.495357513f, 0.548503697f},
-std::array<float,2>{0.902317166f, 0.72041434f},
-std::array<float,2>{0.35343352f, 0.180705175f},
-std::array<float,2>{0.70410496f, 0.430434406f},
-std::array<float,2>{0.0361482576f, 0.759676993f},
-std::array<float,2>{0.754810154f, 0.870178759f},
-std::array<float,2>{0.424512148f, 0.462759316f},
-std::array<float,2>{0.540482819f, 0.219316661f},
-std::array<float,2>{0.160115287f, 0.654212713f},
-std::array<float,2>{0.659586251f, 0.616411984f},
-std::array<float,2>{0.12310937f, 0.105269529f},
-std::array<float,2>{0.96940428f, 0.342785358f},
-std::array<float,2>{0.257749349f, 0.98257041f},
-std::array<float,2>{0.608966231f, 0.754381299f},
-std::array<float,2>{0.205091015f, 0.429502904f},
-std::array<float,2>{0.857264757f, 0.175927967f},
-std::array<float,2>{0.452425629f, 0.730652273f},
-std::array<float,2>{0.934639752f, 0.554960907f},
-std::array<float,2>{0.338633984f, 0.0311001427f},
-std::array<float,2>{0.748343825f, 0.253883928f},
-std::array<float,2>{0.0201005265f, 0.931628704f},
-std::array<float,2>{0.811783791f, 0.971471131f},
-std::array<float,2>{0.387063086f, 0.328319758f},
-std::array<float,2>{0.507932365f, 0.0983427987f},
-std::array<float,2>{0.153495252f, 0.617875636f},
-std::array<float,2>{0.633206308f, 0.64432466f},
-std::array<float,2>{0.0923262313f, 0.231049761f},
-std::array<float,2>{0.945843816f, 0.454905689f},
-std::array<float,2>{0.29433164f, 0.863458991f},
-std::array<float,2>{0.716531575f, 0.894849896f},
-std::array<float,2>{0.0463860035f, 0.294341087f},
-std::array<float,2>{0.890895903f, 0.0333645493f},
-std::array<float,2>{0.345068216f, 0.521178424f},
-std::array<float,2>{0.8419981f, 0.70871675f},
-std::array<float,2>{0.48938325f, 0.14387843f},
-std::array<float,2>{0.580103695f, 0.384292126f},
-std::array<float,2>{0.249194294f, 0.80916816f},
-std::array<float,2>{0.984315038f, 0.841829717f},
-std::array<float,2>{0.262534857f, 0.470999807f},
-std::array<float,2>{0.669785976f, 0.187611789f},
-std::array<float,2>{0.110275529f, 0.669552684f},
-std::array<float,2>{0.532075286f, 0.577188194f},
-std::array<float,2>{0.164706185f, 0.0888499096f},
-std::array<float,2>{0.76093787f, 0.367179245f},
-std::array<float,2>{0.429968923f, 0.951308131f},
-std::array<float,2>{0.681711614f, 0.846117198f},
-std::array<float,2>{0.104309127f, 0.43756184f},
-std::array<float,2>{0.992179573f, 0.245180205f},
-std::array<float,2>{0.271799505f, 0.629912913f},
-std::array<float,2>{0.769958496f, 0.596963882f},
-std::array<float,2>{0.407254875f, 0.114628494f},
-std::array<float,2>{0.56187135f, 0.325648904f},
-std::array<float,2>{0.180229932f, 0.995000124f},
-std::array<float,2>{0.883117259f, 0.908979416f},
-std::array<float,2>{0.362150282f, 0.280639172f},
-std::array<float,2>{0.692711651f, 0.0147068519f},
-std::array<float,2>{0.0570093691f, 0.535401642f},
-std::array<float,2>{0.572508693f, 0.743286967f},
-std::array<float,2>{0.225168228f, 0.1687361f},
-std::array<float,2>{0.815439999f, 0.416183949f},
-std::array<float,2>{0.479598254f, 0.780172646f},
-std::array<float,2>{0.52415359f, 0.959121227f},
-std::array<float,2>{0.126534909f, 0.355589569f},
-std::array<float,2>{0.792312145f, 0.0663236752f},
-std::array<float,2>{0.395632356f, 0.585360348f},
-std::array<float,2>{0.957064569f, 0.674051642f},
-std::array<float,2>{0.298358262f, 0.216981769f},
-std::array<float,2>{0.646318614f, 0.491743356f},
-std::array<float,2>{0.0726949722f, 0.824838817f},
-std::array<float,2>{0.864223361f, 0.790135264f},
-std::array<float,2>{0.460707784f, 0.405560791f},
-std::array<float,2>{0.611757517f, 0.137527198f},
-std::array<float,2>{0.199216008f, 0.690683007f},
-std::array<float,2>{0.732952237f, 0.508100331f},
-std::array<float,2>{0.0112090483f, 0.0488353595f},
-std::array<float,2>{0.907060146f, 0.305150121f},
-std::array<float,2>{0.323419094f, 0.887609839f},
-std::array<float,2>{0.515074015f, 0.782047391f},
-std::array<float,2>{0.151566654f, 0.395175487f},
-std::array<float,2>{0.806009352f, 0.128550544f},
-std::array<float,2>{0.386531085f, 0.701142311f},
-std::array<float,2>{0.950234711f, 0.503638089f},
-std::array<float,2>{0.291895777f, 0.0586601868f},
-std::array<float,2>{0.63750869f, 0.301129401f},
-std::array<float,2>{0.0888351202f, 0.881699622f},
-std::array<float,2>{0.853193581f, 0.968325436f},
-std::array<float,2>{0.448079497f, 0.346833348f},
-std::array<float,2>{0.604216874f, 0.0770290792f},
-std::array<float,2>{0.20956409f, 0.588998854f},
-std::array<float,2>{0.742510557f, 0.685236156f},
-std::array<float,2>{0.0181830563f, 0.209046468f},
-std::array<float,2>{0.933378041f, 0.492202044f},
-std::array<float,2>{0.340134144f, 0.815146208f},
-std::array<float,2>{0.667698026f, 0.915755808f},
-std::array<float,2>{0.115634747f, 0.272023052f},
-std::array<float,2>{0.979165792f, 0.00490784924f},
-std::array<float,2>{0.259213895f, 0.540680587f},
-std::array<float,2>{0.764059544f, 0.739967585f},
-std::array<float,2>{0.434281945f, 0.160542816f},
-std::array<float,2>{0.535605729f, 0.409725249f},
-std::array<float,2>{0.170888111f, 0.77213186f},
-std::array<float,2>{0.895532131f, 0.857937098f},
-std::array<float,2>{0.351218671f, 0.451918453f},
-std::array<float,2>{0.714456379f, 0.241107047f},
-std::array<float,2>{0.0392197706f, 0.637957811f},
-std::array<float,2>{0.582553089f, 0.606664836f},
-std::array<float,2>{0.245144099f, 0.123895191f},
-std::array<float,2>{0.837470293f, 0.313121766f},
-std::array<float,2>{0.484896988f, 0.991635919f},
-std::array<float,2>{0.689199507f, 0.835575759f},
-std::array<float,2>{0.0608625151f, 0.483204007f},
-std::array<float,2>{0.889020979f, 0.196425095f},
-std::array<float,2>{0.367056757f, 0.660633445f},
-std::array<float,2>{0.8184129f, 0.563940346f},
-std::array<float,2>{0.481075853f, 0.0844715238f},
-std::array<float,2>{0.574252665f, 0.372687161f},
-std::array<float,2>{0.219677374f, 0.941079021f},
-std::array<float,2>{0.986959934f, 0.902830184f},
-std::array<float,2>{0.268931121f, 0.28223747f},
-std::array<float,2>{0.685102284f, 0.0391525254f},
-std::array<float,2>{0.108213469f, 0.528529823f},
-std::array<float,2>{0.555358827f, 0.715911984f},
-std::array<float,2>{0.186505288f, 0.155297935f},
-std::array<float,2>{0.765640259f, 0.378510922f},
-std::array<float,2>{0.412359715f, 0.79817301f},
-std::array<float,2>{0.61400187f, 0.979488611f},
-std::array<float,2>{0.199804217f, 0.337402433f},
-std::array<float,2>{0.86272651f, 0.109023347f},
-std::array<float,2>{0.453170747f, 0.613217354f},
-std::array<float,2>{0.911998093f, 0.652098417f},
-std::array<float,2>{0.324972361f, 0.225221559f},
-std::array<float,2>{0.729068279f, 0.468726426f},
-std::array<float,2>{0.0153552415f, 0.874402463f},
-std::array<float,2>{0.793368995f, 0.762474954f},
-std::array<float,2>{0.392979622f, 0.435132027f},
-std::array<float,2>{0.529159904f, 0.18551302f},
-std::array<float,2>{0.131980553f, 0.725529015f},
-std::array<float,2>{0.642927825f, 0.552746713f},
-std::array<float,2>{0.0757719427f, 0.0215109121f},
-std::array<float,2>{0.95472151f, 0.261691421f},
-std::array<float,2>{0.303707093f, 0.929468811f},
-std::array<float,2>{0.562710404f, 0.861614585f},
-std::array<float,2>{0.233503357f, 0.458437234f},
-std::array<float,2>{0.822224259f, 0.227266178f},
-std::array<float,2>{0.469917595f, 0.648337424f},
-std::array<float,2>{0.875567019f, 0.622240305f},
-std::array<float,2>{0.372790933f, 0.0939850882f},
-std::array<float,2>{0.697652459f, 0.335736752f},
-std::array<float,2>{0.0478049517f, 0.975768626f},
-std::array<float,2>{0.776085198f, 0.935960352f},
-std::array<float,2>{0.415172666f, 0.257408589f},
-std::array<float,2>{0.549015462f, 0.0247440264f},
-std::array<float,2>{0.175712034f, 0.559521496f},
-std::array<float,2>{0.675375879f, 0.729371309f},
-std::array<float,2>{0.0974569395f, 0.173933357f},
-std::array<float,2>{0.997717619f, 0.424355239f},
-std::array<float,2>{0.28077665f, 0.750237286f},
-std::array<float,2>{0.719341099f, 0.948504448f},
-std::array<float,2>{0.00704016443f, 0.360293806f},
-std::array<float,2>{0.916866541f, 0.0909656584f},
-std::array<float,2>{0.318882942f, 0.572126746f},
-std::array<float,2>{0.870801866f, 0.664719939f},
-std::array<float,2>{0.466281861f, 0.193095759f},
-std::array<float,2>{0.62256974f, 0.475757837f},
-std::array<float,2>{0.192631274f, 0.837374449f},
-std::array<float,2>{0.966912746f, 0.806053638f},
-std::array<float,2>{0.311268568f, 0.390320361f},
-std::array<float,2>{0.652398825f, 0.146771625f},
-std::array<float,2>{0.0666521564f, 0.706100106f},
-std::array<float,2>{0.51614511f, 0.519314766f},
-std::array<float,2>{0.135041505f, 0.0380941406f},
-std::array<float,2>{0.785731792f, 0.292583078f},
-std::array<float,2>{0.402639955f, 0.893902421f},
-std::array<float,2>{0.632154047f, 0.77507323f},
-std::array<float,2>{0.0832046568f, 0.419129521f},
-std::array<float,2>{0.945123553f, 0.166439191f},
-std::array<float,2>{0.283637613f, 0.749801517f},
-std::array<float,2>{0.801626801f, 0.532422125f},
-std::array<float,2>{0.381058186f, 0.00870647561f},
-std::array<float,2>{0.503872216f, 0.27462393f},
-std::array<float,2>{0.142468646f, 0.910685182f},
-std::array<float,2>{0.922158897f, 0.99945724f},
-std::array<float,2>{0.335671365f, 0.321478993f},
-std::array<float,2>{0.741121113f, 0.109937005f},
-std::array<float,2>{0.026059581f, 0.600865543f},
-std::array<float,2>{0.601266563f, 0.626685619f},
-std::array<float,2>{0.214896411f, 0.248539835f},
-std::array<float,2>{0.845369995f, 0.443136275f},
-std::array<float,2>{0.441243142f, 0.849313915f},
-std::array<float,2>{0.543602824f, 0.88298136f},
-std::array<float,2>{0.160900936f, 0.311660826f},
-std::array<float,2>{0.752715766f, 0.0524207167f},
-std::array<float,2>{0.427078635f, 0.514632821f},
-std::array<float,2>{0.973134816f, 0.69204396f},
-std::array<float,2>{0.252103031f, 0.135353953f},
-std::array<float,2>{0.663624763f, 0.399454147f},
-std::array<float,2>{0.119346626f, 0.796156049f},
-std::array<float,2>{0.831164658f, 0.820744693f},
-std::array<float,2>{0.499869555f, 0.485630274f},
-std::array<float,2>{0.588022053f, 0.214306325f},
-std::array<float,2>{0.237198383f, 0.677948892f},
-std::array<float,2>{0.709277511f, 0.580415428f},
-std::array<float,2>{0.031841401f, 0.069368735f},
-std::array<float,2>{0.902523935f, 0.354540825f},
-std::array<float,2>{0.356595457f, 0.953259945f},
-std::array<float,2>{0.520745635f, 0.853039205f},
-std::array<float,2>{0.138599798f, 0.449142367f},
-std::array<float,2>{0.782387912f, 0.235960409f},
-std::array<float,2>{0.400952458f, 0.633883476f},
-std::array<float,2>{0.961894095f, 0.605019569f},
-std::array<float,2>{0.305879146f, 0.118331984f},
-std::array<float,2>{0.648775101f, 0.316527098f},
-std::array<float,2>{0.0659894794f, 0.988230586f},
-std::array<float,2>{0.871505439f, 0.921107233f},
-std::array<float,2>{0.462801158f, 0.269417912f},
-std::array<float,2>{0.619730473f, 0.00352344685f},
-std::array<float,2>{0.190529853f, 0.543269634f},
-std::array<float,2>{0.723637283f, 0.73793298f},
-std::array<float,2>{0.000542615657f, 0.159900233f},
-std::array<float,2>{0.920612156f, 0.412404358f},
-std::array<float,2>{0.313268602f, 0.769166529f},
-std::array<float,2>{0.676236153f, 0.962477505f},
-std::array<float,2>{0.0976977572f, 0.349293649f},
-std::array<float,2>{0.995236516f, 0.0723101124f},
-std::array<float,2>{0.274878085f, 0.59333986f},
-std::array<float,2>{0.778151274f, 0.682790697f},
-std::array<float,2>{0.420942903f, 0.205027565f},
-std::array<float,2>{0.553885937f, 0.496624976f},
-std::array<float,2>{0.176299974f, 0.818469226f},
-std::array<float,2>{0.882463992f, 0.789051592f},
-std::array<float,2>{0.367335379f, 0.393048525f},
-std::array<float,2>{0.701562107f, 0.132339478f},
-std::array<float,2>{0.0532981865f, 0.697288454f},
-std::array<float,2>{0.567179978f, 0.505527258f},
-std::array<float,2>{0.227156669f, 0.0585930869f},
-std::array<float,2>{0.824232817f, 0.300345659f},
-std::array<float,2>{0.474468291f, 0.878457904f},
-std::array<float,2>{0.70585382f, 0.76086092f},
-std::array<float,2>{0.0371840596f, 0.43304643f},
-std::array<float,2>{0.899932683f, 0.182964191f},
-std::array<float,2>{0.355204165f, 0.721890867f},
-std::array<float,2>{0.832528412f, 0.548836887f},
-std::array<float,2>{0.493243247f, 0.0190446954f},
-std::array<float,2>{0.593265235f, 0.265546799f},
-std::array<float,2>{0.238796383f, 0.925103962f},
-std::array<float,2>{0.972193778f, 0.981854975f},
-std::array<float,2>{0.254771262f, 0.34139514f},
-std::array<float,2>{0.65640527f, 0.102992132f},
-std::array<float,2>{0.122325778f, 0.61337918f},
-std::array<float,2>{0.542573333f, 0.654507101f},
-std::array<float,2>{0.156700253f, 0.221630961f},
-std::array<float,2>{0.757234395f, 0.463788003f},
-std::array<float,2>{0.422981381f, 0.867237687f},
-std::array<float,2>{0.597411811f, 0.901911676f},
-std::array<float,2>{0.214719281f, 0.288788021f},
-std::array<float,2>{0.848940074f, 0.0459456258f},
-std::array<float,2>{0.44463411f, 0.526289165f},
-std::array<float,2>{0.929543853f, 0.71375823f},
-std::array<float,2>{0.331905305f, 0.15120174f},
-std::array<float,2>{0.736979961f, 0.381642222f},
-std::array<float,2>{0.0305410158f, 0.801984072f},
-std::array<float,2>{0.800600588f, 0.830925882f},
-std::array<float,2>{0.376605868f, 0.480007231f},
-std::array<float,2>{0.505220234f, 0.202723905f},
-std::array<float,2>{0.144659668f, 0.659537673f},
-std::array<float,2>{0.627610862f, 0.567477465f},
-std::array<float,2>{0.0782055035f, 0.0806040615f},
-std::array<float,2>{0.939705312f, 0.370519012f},
-std::array<float,2>{0.287576705f, 0.942811131f},
-std::array<float,2>{0.578149557f, 0.811403632f},
-std::array<float,2>{0.247330233f, 0.385940671f},
-std::array<float,2>{0.841078699f, 0.141772285f},
-std::array<float,2>{0.491755247f, 0.709210217f},
-std::array<float,2>{0.893519461f, 0.52183789f},
-std::array<float,2>{0.345925272f, 0.0325619541f},
-std::array<float,2>{0.717997909f, 0.296221346f},
-std::array<float,2>{0.0433317721f, 0.898158371f},
-std::array<float,2>{0.759340525f, 0.950056851f},
-std::array<float,2>{0.431987941f, 0.363395333f},
-std::array<float,2>{0.533989966f, 0.0868996754f},
-std::array<float,2>{0.167513058f, 0.575502157f},
-std::array<float,2>{0.671640396f, 0.669926584f},
-std::array<float,2>{0.11163722f, 0.190622434f},
-std::array<float,2>{0.98210752f, 0.468826473f},
-std::array<float,2>{0.265208304f, 0.840773165f},
-std::array<float,2>{0.746867418f, 0.931641817f},
-std::array<float,2>{0.0222626068f, 0.251340449f},
-std::array<float,2>{0.936223149f, 0.0277232938f},
-std::array<float,2>{0.335940361f, 0.556856215f},
-std::array<float,2>{0.857667208f, 0.73410213f},
-std::array<float,2>{0.449420065f, 0.17946513f},
-std::array<float,2>{0.605552077f, 0.426936984f},
-std::array<float,2>{0.205059201f, 0.756996691f},
-std::array<float,2>{0.947410345f, 0.866483629f},
-std::array<float,2>{0.295907199f, 0.455460101f},
-std::array<float,2>{0.635614932f, 0.233181536f},
-std::array<float,2>{0.0906894654f, 0.642281413f},
-std::array<float,2>{0.509813428f, 0.61935252f},
-std::array<float,2>{0.155001953f, 0.100344531f},
-std::array<float,2>{0.809827387f, 0.330883831f},
-std::array<float,2>{0.389181942f, 0.970595062f},
-std::array<float,2>{0.648408949f, 0.828077257f},
-std::array<float,2>{0.0721776411f, 0.489970803f},
-std::array<float,2>{0.959812701f, 0.216246754f},
-std::array<float,2>{0.299252421f, 0.67234987f},
-std::array<float,2>{0.79080981f, 0.583403647f},
-std::array<float,2>{0.397538185f, 0.0634105355f},
-std::array<float,2>{0.52663517f, 0.357719451f},
-std::array<float,2>{0.127640516f, 0.958005428f},
-std::array<float,2>{0.910073698f, 0.890146255f},
-std::array<float,2>{0.321356654f, 0.306786925f},
-std::array<float,2>{0.730683029f, 0.0482766367f},
-std::array<float,2>{0.00829419494f, 0.510140538f},
-std::array<float,2>{0.611208439f, 0.689360619f},
-std::array<float,2>{0.195432246f, 0.140479043f},
-std::array<float,2>{0.865666389f, 0.402584881f},
-std::array<float,2>{0.457302094f, 0.79171896f},
-std::array<float,2>{0.559582949f, 0.99350512f},
-std::array<float,2>{0.182964131f, 0.326449752f},
-std::array<float,2>{0.771567643f, 0.116392635f},
-std::array<float,2>{0.408753842f, 0.593852103f},
-std::array<float,2>{0.990225673f, 0.63098377f},
-std::array<float,2>{0.270013839f, 0.243970692f},
-std::array<float,2>{0.680378497f, 0.440141082f},
-std::array<float,2>{0.101960205f, 0.844656527f},
-std::array<float,2>{0.812931538f, 0.777726173f},
-std::array<float,2>{0.477844715f, 0.415065885f},
-std::array<float,2>{0.570482373f, 0.17167446f},
-std::array<float,2>{0.223727807f, 0.744904757f},
-std::array<float,2>{0.693713963f, 0.537787676f},
-std::array<float,2>{0.055809319f, 0.012824161f},
-std::array<float,2>{0.885916591f, 0.278500348f},
-std::array<float,2>{0.359469175f, 0.907816112f},
-std::array<float,2>{0.537143648f, 0.770831287f},
-std::array<float,2>{0.1681633f, 0.408177614f},
-std::array<float,2>{0.76293993f, 0.162345618f},
-std::array<float,2>{0.43621555f, 0.742175221f},
-std::array<float,2>{0.978148818f, 0.542671084f},
-std::array<float,2>{0.26137349f, 0.00603595283f},
-std::array<float,2>{0.664169431f, 0.269646525f},
-std::array<float,2>{0.114681251f, 0.916379094f},
-std::array<float,2>{0.83899349f, 0.989565551f},
-std::array<float,2>{0.487565964f, 0.316118568f},
-std::array<float,2>{0.585247755f, 0.121193826f},
-std::array<float,2>{0.243673399f, 0.608463109f},
-std::array<float,2>{0.712764263f, 0.639182508f},
-std::array<float,2>{0.0428182967f, 0.23945412f},
-std::array<float,2>{0.896656513f, 0.450498343f},
-std::array<float,2>{0.349092722f, 0.857234657f},
-std::array<float,2>{0.640180171f, 0.879836679f},
-std::array<float,2>{0.0862423554f, 0.303546011f},
-std::array<float,2>{0.9529019f, 0.0610738508f},
-std::array<float,2>{0.290376753f, 0.500279427f},
-std::array<float,2>{0.808055878f, 0.701928914f},
-std::array<float,2>{0.383764714f, 0.125155911f},
-std::array<float,2>{0.513133228f, 0.397044003f},
-std::array<float,2>{0.149024978f, 0.784126103f},
-std::array<float,2>{0.930516064f, 0.813484251f},
-std::array<float,2>{0.342913359f, 0.495213091f},
-std::array<float,2>{0.746082962f, 0.207367972f},
-std::array<float,2>{0.0171496589f, 0.68740344f},
-std::array<float,2>{0.60252589f, 0.58785522f},
-std::array<float,2>{0.207047209f, 0.0744418576f},
-std::array<float,2>{0.855167925f, 0.344996125f},
-std::array<float,2>{0.44605571f, 0.965275228f},
-std::array<float,2>{0.726709425f, 0.872840643f},
-std::array<float,2>{0.0131248981f, 0.466503173f},
-std::array<float,2>{0.913790345f, 0.223135173f},
-std::array<float,2>{0.327858657f, 0.649152756f},
-std::array<float,2>{0.859546065f, 0.610776246f},
-std::array<float,2>{0.455963761f, 0.105681747f},
-std::array<float,2>{0.616864562f, 0.339003354f},
-std::array<float,2>{0.202584818f, 0.976994991f},
-std::array<float,2>{0.956122279f, 0.927378654f},
-std::array<float,2>{0.301553458f, 0.259330362f},
-std::array<float,2>{0.641441643f, 0.020907037f},
-std::array<float,2>{0.0772518143f, 0.551345706f},
-std::array<float,2>{0.530786872f, 0.724042356f},
-std::array<float,2>{0.130771965f, 0.185903892f},
-std::array<float,2>{0.794946492f, 0.436858386f},
-std::array<float,2>{0.392297536f, 0.763941705f},
-std::array<float,2>{0.576408803f, 0.938219786f},
-std::array<float,2>{0.222485647f, 0.373568058f},
-std::array<float,2>{0.816794276f, 0.08226493f},
-std::array<float,2>{0.483279079f, 0.565143764f},
-std::array<float,2>{0.886842728f, 0.663347185f},
-std::array<float,2>{0.365157306f, 0.197278693f},
-std::array<float,2>{0.690330088f, 0.481910288f},
-std::array<float,2>{0.0597754791f, 0.83266598f},
-std::array<float,2>{0.769509017f, 0.799547076f},
-std::array<float,2>{0.411703259f, 0.375549585f},
-std::array<float,2>{0.55670321f, 0.153979585f},
-std::array<float,2>{0.184659287f, 0.718256295f},
-std::array<float,2>{0.687259376f, 0.530346692f},
-std::array<float,2>{0.106884398f, 0.0417016298f},
-std::array<float,2>{0.985949755f, 0.284570187f},
-std::array<float,2>{0.266920358f, 0.90515703f},
-std::array<float,2>{0.62351191f, 0.839087665f},
-std::array<float,2>{0.193999588f, 0.472876877f},
-std::array<float,2>{0.868038237f, 0.195308417f},
-std::array<float,2>{0.467906177f, 0.667688966f},
-std::array<float,2>{0.915865242f, 0.572651386f},
-std::array<float,2>{0.317621797f, 0.0929902866f},
-std::array<float,2>{0.721105397f, 0.362979174f},
-std::array<float,2>{0.00566859124f, 0.946368396f},
-std::array<float,2>{0.78828311f, 0.892204046f},
-std::array<float,2>{0.405352652f, 0.289624065f},
-std::array<float,2>{0.518229544f, 0.0369850993f},
-std::array<float,2>{0.133428633f, 0.5159778f},
-std::array<float,2>{0.655029058f, 0.704943538f},
-std::array<float,2>{0.0698430911f, 0.145238608f},
-std::array<float,2>{0.966775417f, 0.388427198f},
-std::array<float,2>{0.309506744f, 0.807866335f},
-std::array<float,2>{0.695760965f, 0.974476635f},
-std::array<float,2>{0.0492666699f, 0.333496451f},
-std::array<float,2>{0.878170192f, 0.0971480906f},
-std::array<float,2>{0.37393254f, 0.623536646f},
-std::array<float,2>{0.823161364f, 0.64611882f},
-std::array<float,2>{0.471022725f, 0.230228528f},
-std::array<float,2>{0.564720333f, 0.460575998f},
-std::array<float,2>{0.231421649f, 0.861187994f},
-std::array<float,2>{0.999185443f, 0.7525419f},
-std::array<float,2>{0.277449459f, 0.422605932f},
-std::array<float,2>{0.672923744f, 0.173736185f},
-std::array<float,2>{0.0950840414f, 0.728200257f},
-std::array<float,2>{0.548397839f, 0.560693622f},
-std::array<float,2>{0.172677547f, 0.0265314933f},
-std::array<float,2>{0.774373174f, 0.255699545f},
-std::array<float,2>{0.417326778f, 0.934374809f},
-std::array<float,2>{0.660416603f, 0.794319808f},
-std::array<float,2>{0.118101791f, 0.401686192f},
-std::array<float,2>{0.974997759f, 0.133652896f},
-std::array<float,2>{0.250384748f, 0.693517029f},
-std::array<float,2>{0.751781344f, 0.511983395f},
-std::array<float,2>{0.428544044f, 0.0538475476f},
-std::array<float,2>{0.546172798f, 0.309050053f},
-std::array<float,2>{0.162458539f, 0.88661021f},
-std::array<float,2>{0.904390693f, 0.955564976f},
-std::array<float,2>{0.358395964f, 0.351671934f},
-std::array<float,2>{0.707659841f, 0.0668474957f},
-std::array<float,2>{0.0336100049f, 0.578655839f},
-std::array<float,2>{0.586730897f, 0.677171826f},
-std::array<float,2>{0.234588504f, 0.212793678f},
-std::array<float,2>{0.82861042f, 0.487923622f},
-std::array<float,2>{0.496883065f, 0.823737144f},
-std::array<float,2>{0.501062632f, 0.913792074f},
-std::array<float,2>{0.144407153f, 0.276255667f},
-std::array<float,2>{0.802887797f, 0.011137641f},
-std::array<float,2>{0.379904807f, 0.533356309f},
-std::array<float,2>{0.942368209f, 0.747326076f},
-std::array<float,2>{0.281745166f, 0.164571181f},
-std::array<float,2>{0.62951827f, 0.421003997f},
-std::array<float,2>{0.0841850564f, 0.776555479f},
-std::array<float,2>{0.847576261f, 0.850467384f},
-std::array<float,2>{0.439048618f, 0.445011646f},
-std::array<float,2>{0.59854573f, 0.246206865f},
-std::array<float,2>{0.218578711f, 0.627723873f},
-std::array<float,2>{0.738302648f, 0.598458171f},
-std::array<float,2>{0.0240458231f, 0.112468071f},
-std::array<float,2>{0.92491591f, 0.323294282f},
-std::array<float,2>{0.333023489f, 0.996471465f},
-std::array<float,2>{0.549271166f, 0.859523952f},
-std::array<float,2>{0.175376922f, 0.459132701f},
-std::array<float,2>{0.776238084f, 0.229192644f},
-std::array<float,2>{0.415294468f, 0.645033836f},
-std::array<float,2>{0.99798739f, 0.624281883f},
-std::array<float,2>{0.281163305f, 0.0965270847f},
-std::array<float,2>{0.675545752f, 0.332399189f},
-std::array<float,2>{0.0972969756f, 0.972818732f},
-std::array<float,2>{0.82198143f, 0.934656084f},
-std::array<float,2>{0.470058709f, 0.254181117f},
-std::array<float,2>{0.562872648f, 0.0259462297f},
-std::array<float,2>{0.233807489f, 0.562202156f},
-std::array<float,2>{0.697274745f, 0.727478325f},
-std::array<float,2>{0.0474152006f, 0.172241032f},
-std::array<float,2>{0.875888228f, 0.423393279f},
-std::array<float,2>{0.372978717f, 0.753900349f},
-std::array<float,2>{0.652709842f, 0.945576251f},
-std::array<float,2>{0.0665078238f, 0.362179548f},
-std::array<float,2>{0.967229605f, 0.0918374732f},
-std::array<float,2>{0.311421096f, 0.573603809f},
-std::array<float,2>{0.786030412f, 0.666944087f},
-std::array<float,2>{0.402481169f, 0.19416301f},
-std::array<float,2>{0.51647979f, 0.473902345f},
-std::array<float,2>{0.134872437f, 0.83812362f},
-std::array<float,2>{0.916708291f, 0.807296216f},
-std::array<float,2>{0.319216102f, 0.387474477f},
-std::array<float,2>{0.719510615f, 0.146315604f},
-std::array<float,2>{0.00713455491f, 0.703524292f},
-std::array<float,2>{0.622817814f, 0.516879559f},
-std::array<float,2>{0.192466021f, 0.0355287492f},
-std::array<float,2>{0.870909631f, 0.29064393f},
-std::array<float,2>{0.466008812f, 0.891343713f},
-std::array<float,2>{0.74078393f, 0.776147306f},
-std::array<float,2>{0.0263517424f, 0.420727432f},
-std::array<float,2>{0.922027826f, 0.165168762f},
-std::array<float,2>{0.335804671f, 0.746738911f},
-std::array<float,2>{0.845534921f, 0.53509444f},
-std::array<float,2>{0.440946043f, 0.0106934393f},
-std::array<float,2>{0.601511419f, 0.27731362f},
-std::array<float,2>{0.215164214f, 0.912518263f},
-std::array<float,2>{0.945026577f, 0.998034537f},
-std::array<float,2>{0.283267289f, 0.323146999f},
-std::array<float,2>{0.63186866f, 0.111803442f},
-std::array<float,2>{0.0833390355f, 0.599504173f},
-std::array<float,2>{0.503513217f, 0.628309488f},
-std::array<float,2>{0.142231345f, 0.24741073f},
-std::array<float,2>{0.801277936f, 0.443748504f},
-std::array<float,2>{0.381142884f, 0.851512253f},
-std::array<float,2>{0.588219345f, 0.884969115f},
-std::array<float,2>{0.236845002f, 0.309610665f},
-std::array<float,2>{0.83139658f, 0.0528168716f},
-std::array<float,2>{0.499575317f, 0.513005197f},
-std::array<float,2>{0.902652323f, 0.694606245f},
-std::array<float,2>{0.356844246f, 0.134462923f},
-std::array<float,2>{0.709136784f, 0.400478393f},
-std::array<float,2>{0.032132294f, 0.793329597f},
-std::array<float,2>{0.752635241f, 0.82282877f},
-std::array<float,2>{0.426796168f, 0.486768037f},
-std::array<float,2>{0.543913722f, 0.211720318f},
-std::array<float,2>{0.160714239f, 0.676626265f},
-std::array<float,2>{0.663862586f, 0.579962492f},
-std::array<float,2>{0.119537786f, 0.0676773787f},
-std::array<float,2>{0.972821236f, 0.353472829f},
-std::array<float,2>{0.252357572f, 0.956778824f},
-std::array<float,2>{0.604396403f, 0.785134673f},
-std::array<float,2>{0.20985806f, 0.39787516f},
-std::array<float,2>{0.853328645f, 0.126282558f},
-std::array<float,2>{0.447915137f, 0.703093231f},
-std::array<float,2>{0.933135748f, 0.501363039f},
-std::array<float,2>{0.33993575f, 0.0622496419f},
-std::array<float,2>{0.742382646f, 0.304326117f},
-std::array<float,2>{0.0185447168f, 0.880167544f},
-std::array<float,2>{0.805732131f, 0.96582073f},
-std::array<float,2>{0.386445135f, 0.344585985f},
-std::array<float,2>{0.514846802f, 0.0751976073f},
-std::array<float,2>{0.15171434f, 0.586779952f},
-std::array<float,2>{0.637251616f, 0.68622005f},
-std::array<float,2>{0.0884328708f, 0.208751589f},
-std::array<float,2>{0.950492918f, 0.494971067f},
-std::array<float,2>{0.291733146f, 0.813012719f},
-std::array<float,2>{0.714686036f, 0.917332768f},
-std::array<float,2>{0.0393726975f, 0.27136305f},
-std::array<float,2>{0.895954072f, 0.00730212638f},
-std::array<float,2>{0.351363122f, 0.541663826f},
-std::array<float,2>{0.837773025f, 0.74117595f},
-std::array<float,2>{0.485167384f, 0.163250744f},
-std::array<float,2>{0.582933366f, 0.406892687f},
-std::array<float,2>{0.245566458f, 0.770192504f},
-std::array<float,2>{0.979309499f, 0.856009781f},
-std::array<float,2>{0.259009898f, 0.449516773f},
-std::array<float,2>{0.667927384f, 0.238932714f},
-std::array<float,2>{0.115242228f, 0.640567183f},
-std::array<float,2>{0.535348117f, 0.608213186f},
-std::array<float,2>{0.170527965f, 0.122750849f},
-std::array<float,2>{0.763795495f, 0.315000534f},
-std::array<float,2>{0.434553027f, 0.988526702f},
-std::array<float,2>{0.685501158f, 0.833357275f},
-std::array<float,2>{0.107922509f, 0.480682015f},
-std::array<float,2>{0.987111747f, 0.198997736f},
-std::array<float,2>{0.268688589f, 0.662818015f},
-std::array<float,2>{0.765972137f, 0.565457106f},
-std::array<float,2>{0.412179917f, 0.0838059857f},
-std::array<float,2>{0.555523515f, 0.37407276f},
-std::array<float,2>{0.186108023f, 0.939391911f},
-std::array<float,2>{0.888822138f, 0.905308008f},
-std::array<float,2>{0.366881609f, 0.283750683f},
-std::array<float,2>{0.689283967f, 0.0425033607f},
-std::array<float,2>{0.0605848394f, 0.529947817f},
-std::array<float,2>{0.574589133f, 0.716915071f},
-std::array<float,2>{0.219276547f, 0.152712122f},
-std::array<float,2>{0.818827331f, 0.376315445f},
-std::array<float,2>{0.481240749f, 0.799941659f},
-std::array<float,2>{0.52883935f, 0.977898479f},
-std::array<float,2>{0.132135332f, 0.338256896f},
-std::array<float,2>{0.793046653f, 0.106794715f},
-std::array<float,2>{0.392625868f, 0.609645844f},
-std::array<float,2>{0.954942822f, 0.650161386f},
-std::array<float,2>{0.303334594f, 0.224260181f},
-std::array<float,2>{0.642762005f, 0.465145797f},
-std::array<float,2>{0.0761300996f, 0.871456921f},
-std::array<float,2>{0.862361193f, 0.765274048f},
-std::array<float,2>{0.453386873f, 0.435771495f},
-std::array<float,2>{0.614158034f, 0.187491462f},
-std::array<float,2>{0.200109631f, 0.723281145f},
-std::array<float,2>{0.729316652f, 0.551943362f},
-std::array<float,2>{0.0154389245f, 0.0203923751f},
-std::array<float,2>{0.911784708f, 0.2584005f},
-std::array<float,2>{0.324731022f, 0.925953269f},
-std::array<float,2>{0.508061588f, 0.756677687f},
-std::array<float,2>{0.153698921f, 0.425947607f},
-std::array<float,2>{0.811760604f, 0.178516611f},
-std::array<float,2>{0.386849046f, 0.733374894f},
-std::array<float,2>{0.946163118f, 0.558158517f},
-std::array<float,2>{0.294118196f, 0.0286803991f},
-std::array<float,2>{0.632852137f, 0.250207126f},
-std::array<float,2>{0.092621997f, 0.933320761f},
-std::array<float,2>{0.857167721f, 0.968830645f},
-std::array<float,2>{0.452170223f, 0.331166506f},
-std::array<float,2>{0.609156668f, 0.101161286f},
-std::array<float,2>{0.205334425f, 0.620169342f},
-std::array<float,2>{0.74805367f, 0.640829742f},
-std::array<float,2>{0.0204781853f, 0.233756572f},
-std::array<float,2>{0.93496412f, 0.45632118f},
-std::array<float,2>{0.338598281f, 0.865577877f},
-std::array<float,2>{0.669494927f, 0.897085726f},
-std::array<float,2>{0.109991118f, 0.295350671f},
-std::array<float,2>{0.983900845f, 0.0317786969f},
-std::array<float,2>{0.262427181f, 0.522679925f},
-std::array<float,2>{0.761012793f, 0.710308075f},
-std::array<float,2>{0.429818183f, 0.140706167f},
-std::array<float,2>{0.531762481f, 0.38535744f},
-std::array<float,2>{0.164972141f, 0.811545849f},
-std::array<float,2>{0.890835047f, 0.841709197f},
-std::array<float,2>{0.344733983f, 0.470145524f},
-std::array<float,2>{0.716569543f, 0.189799756f},
-std::array<float,2>{0.0459991731f, 0.671758056f},
-std::array<float,2>{0.580436289f, 0.574604928f},
-std::array<float,2>{0.249392942f, 0.0872488245f},
-std::array<float,2>{0.842148662f, 0.364721894f},
-std::array<float,2>{0.48966223f, 0.950593829f},
-std::array<float,2>{0.692517042f, 0.845177412f},
-std::array<float,2>{0.0567656867f, 0.440936208f},
-std::array<float,2>{0.883016288f, 0.242302462f},
-std::array<float,2>{0.361846477f, 0.632123053f},
-std::array<float,2>{0.815818906f, 0.595443547f},
-std::array<float,2>{0.47997424f, 0.115822062f},
-std::array<float,2>{0.572719872f, 0.327206045f},
-std::array<float,2>{0.225401178f, 0.993162036f},
-std::array<float,2>{0.99191618f, 0.906939268f},
-std::array<float,2>{0.271561086f, 0.278012395f},
-std::array<float,2>{0.681945503f, 0.0120389573f},
-std::array<float,2>{0.104226038f, 0.539056301f},
-std::array<float,2>{0.561710417f, 0.745523453f},
-std::array<float,2>{0.180603281f, 0.170350432f},
-std::array<float,2>{0.769750059f, 0.414624035f},
-std::array<float,2>{0.407683849f, 0.778508663f},
-std::array<float,2>{0.611555398f, 0.958850145f},
-std::array<float,2>{0.19889158f, 0.358713776f},
-std::array<float,2>{0.86398834f, 0.0640680268f},
-std::array<float,2>{0.460626066f, 0.582811952f},
-std::array<float,2>{0.906831861f, 0.673376679f},
-std::array<float,2>{0.323501348f, 0.214969799f},
-std::array<float,2>{0.733325958f, 0.489099681f},
-std::array<float,2>{0.0108410139f, 0.826629043f},
-std::array<float,2>{0.792141438f, 0.792104065f},
-std::array<float,2>{0.395866543f, 0.403652787f},
-std::array<float,2>{0.524323285f, 0.139212117f},
-std::array<float,2>{0.126714572f, 0.68843472f},
-std::array<float,2>{0.646202743f, 0.511185706f},
-std::array<float,2>{0.0723531544f, 0.0471937992f},
-std::array<float,2>{0.957277656f, 0.307786912f},
-std::array<float,2>{0.298767686f, 0.88921541f},
-std::array<float,2>{0.569500387f, 0.819693923f},
-std::array<float,2>{0.230138272f, 0.497096241f},
-std::array<float,2>{0.827360809f, 0.203942537f},
-std::array<float,2>{0.47630322f, 0.681827247f},
-std::array<float,2>{0.879794002f, 0.592523038f},
-std::array<float,2>{0.369471133f, 0.0739281997f},
-std::array<float,2>{0.700717747f, 0.348124713f},
-std::array<float,2>{0.0515034944f, 0.96096617f},
-std::array<float,2>{0.780533433f, 0.877309203f},
-std::array<float,2>{0.419179648f, 0.299586505f},
-std::array<float,2>{0.550954163f, 0.0569284074f},
-std::array<float,2>{0.178624913f, 0.504445553f},
-std::array<float,2>{0.677993715f, 0.69846195f},
-std::array<float,2>{0.101419836f, 0.131626159f},
-std::array<float,2>{0.993608177f, 0.394490987f},
-std::array<float,2>{0.276954979f, 0.787284434f},
-std::array<float,2>{0.726376057f, 0.986700356f},
-std::array<float,2>{0.00234019291f, 0.317561805f},
-std::array<float,2>{0.91838485f, 0.117439389f},
-std::array<float,2>{0.316144496f, 0.604179859f},
-std::array<float,2>{0.873136938f, 0.633460283f},
-std::array<float,2>{0.463060707f, 0.234980449f},
-std::array<float,2>{0.618884027f, 0.447605968f},
-std::array<float,2>{0.187672481f, 0.851700842f},
-std::array<float,2>{0.963587701f, 0.76805383f},
-std::array<float,2>{0.30771488f, 0.41401729f},
-std::array<float,2>{0.651511014f, 0.158425927f},
-std::array<float,2>{0.0625230744f, 0.73676765f},
-std::array<float,2>{0.523234665f, 0.544554234f},
-std::array<float,2>{0.139000282f, 0.00197409582f},
-std::array<float,2>{0.783745825f, 0.268137842f},
-std::array<float,2>{0.399576813f, 0.920755267f},
-std::array<float,2>{0.625542283f, 0.801703215f},
-std::array<float,2>{0.0820282474f, 0.382226706f},
-std::array<float,2>{0.938532948f, 0.152322844f},
-std::array<float,2>{0.28654179f, 0.714468598f},
-std::array<float,2>{0.798249602f, 0.526482642f},
-std::array<float,2>{0.377963364f, 0.04511052f},
-std::array<float,2>{0.506367445f, 0.28774634f},
-std::array<float,2>{0.147803411f, 0.900959849f},
-std::array<float,2>{0.926179647f, 0.941888392f},
-std::array<float,2>{0.329078883f, 0.36933288f},
-std::array<float,2>{0.734747648f, 0.0812771693f},
-std::array<float,2>{0.0284227356f, 0.566854656f},
-std::array<float,2>{0.594112277f, 0.658336222f},
-std::array<float,2>{0.211099625f, 0.201807201f},
-std::array<float,2>{0.850215912f, 0.478639692f},
-std::array<float,2>{0.441836327f, 0.831692874f},
-std::array<float,2>{0.540189505f, 0.924435377f},
-std::array<float,2>{0.159745395f, 0.264283657f},
-std::array<float,2>{0.754567325f, 0.018455822f},
-std::array<float,2>{0.424746126f, 0.55031532f},
-std::array<float,2>{0.969712377f, 0.720895529f},
-std::array<float,2>{0.257452786f, 0.181723848f},
-std::array<float,2>{0.659407914f, 0.432315826f},
-std::array<float,2>{0.12351568f, 0.76062566f},
-std::array<float,2>{0.835145831f, 0.869068742f},
-std::array<float,2>{0.495515853f, 0.46433121f},
-std::array<float,2>{0.591714323f, 0.222503319f},
-std::array<float,2>{0.240548491f, 0.656127155f},
-std::array<float,2>{0.704356074f, 0.614890277f},
-std::array<float,2>{0.036595773f, 0.102062434f},
-std::array<float,2>{0.902067959f, 0.339985579f},
-std::array<float,2>{0.353174061f, 0.980968893f},
-std::array<float,2>{0.518413067f, 0.836739302f},
-std::array<float,2>{0.133713737f, 0.475425035f},
-std::array<float,2>{0.788484633f, 0.192364052f},
-std::array<float,2>{0.405590802f, 0.6654405f},
-std::array<float,2>{0.966332436f, 0.571279705f},
-std::array<float,2>{0.309161305f, 0.0899713412f},
-std::array<float,2>{0.65521276f, 0.36093536f},
-std::array<float,2>{0.0701733083f, 0.947899759f},
-std::array<float,2>{0.867688656f, 0.893336117f},
-std::array<float,2>{0.468158394f, 0.291601598f},
-std::array<float,2>{0.623238564f, 0.0378557667f},
-std::array<float,2>{0.194194794f, 0.518199325f},
-std::array<float,2>{0.720872939f, 0.705724359f},
-std::array<float,2>{0.00542962644f, 0.147613764f},
-std::array<float,2>{0.915652633f, 0.389330596f},
-std::array<float,2>{0.317748249f, 0.805435479f},
-std::array<float,2>{0.673284292f, 0.975391507f},
-std::array<float,2>{0.094944872f, 0.334249526f},
-std::array<float,2>{0.999346912f, 0.0947551355f},
-std::array<float,2>{0.277655363f, 0.62206459f},
-std::array<float,2>{0.774077594f, 0.647253335f},
-std::array<float,2>{0.417005509f, 0.22775729f},
-std::array<float,2>{0.548701346f, 0.457215875f},
-std::array<float,2>{0.17258133f, 0.862521887f},
-std::array<float,2>{0.878328443f, 0.751585186f},
-std::array<float,2>{0.373719275f, 0.425357819f},
-std::array<float,2>{0.695414007f, 0.174851388f},
-std::array<float,2>{0.0490585975f, 0.730396152f},
-std::array<float,2>{0.564594626f, 0.559954464f},
-std::array<float,2>{0.231104702f, 0.0237136465f},
-std::array<float,2>{0.822979808f, 0.25654918f},
-std::array<float,2>{0.470729649f, 0.937007129f},
-std::array<float,2>{0.707981825f, 0.795065403f},
-std::array<float,2>{0.0332668386f, 0.398977339f},
-std::array<float,2>{0.904724419f, 0.136006609f},
-std::array<float,2>{0.357924849f, 0.692382932f},
-std::array<float,2>{0.828316152f, 0.514966249f},
-std::array<float,2>{0.496689558f, 0.0513378792f},
-std::array<float,2>{0.586543381f, 0.310735524f},
-std::array<float,2>{0.234679505f, 0.884712756f},
-std::array<float,2>{0.97483474f, 0.955003083f},
-std::array<float,2>{0.250066102f, 0.353518814f},
-std::array<float,2>{0.660373747f, 0.0686219037f},
-std::array<float,2>{0.117840454f, 0.58113265f},
-std::array<float,2>{0.545945704f, 0.679530978f},
-std::array<float,2>{0.162165612f, 0.213114992f},
-std::array<float,2>{0.751700044f, 0.484527946f},
-std::array<float,2>{0.428351253f, 0.821664095f},
-std::array<float,2>{0.598165452f, 0.911611259f},
-std::array<float,2>{0.218479961f, 0.273937672f},
-std::array<float,2>{0.847360969f, 0.00903511792f},
-std::array<float,2>{0.439370871f, 0.531399071f},
-std::array<float,2>{0.925237894f, 0.748978436f},
-std::array<float,2>{0.333263814f, 0.167039931f},
-std::array<float,2>{0.738721788f, 0.418087602f},
-std::array<float,2>{0.0243045725f, 0.774396002f},
-std::array<float,2>{0.80317241f, 0.848370433f},
-std::array<float,2>{0.380213976f, 0.441945553f},
-std::array<float,2>{0.501248717f, 0.24907802f},
-std::array<float,2>{0.144156158f, 0.625103414f},
-std::array<float,2>{0.62983191f, 0.599764764f},
-std::array<float,2>{0.0842906237f, 0.110519908f},
-std::array<float,2>{0.942112744f, 0.320944697f},
-std::array<float,2>{0.282219738f, 0.998697221f},
-std::array<float,2>{0.584987104f, 0.772989869f},
-std::array<float,2>{0.243971467f, 0.408484012f},
-std::array<float,2>{0.83932817f, 0.161522001f},
-std::array<float,2>{0.487500757f, 0.739028215f},
-std::array<float,2>{0.896920919f, 0.539948881f},
-std::array<float,2>{0.348727435f, 0.00404317258f},
-std::array<float,2>{0.712635756f, 0.273435444f},
-std::array<float,2>{0.0425662138f, 0.914653003f},
-std::array<float,2>{0.762705863f, 0.990395784f},
-std::array<float,2>{0.436513245f, 0.314151257f},
-std::array<float,2>{0.537508786f, 0.124325633f},
-std::array<float,2>{0.168274745f, 0.60644418f},
-std::array<float,2>{0.664518297f, 0.637263119f},
-std::array<float,2>{0.11448656f, 0.24148491f},
-std::array<float,2>{0.97846067f, 0.452334702f},
-std::array<float,2>{0.261519432f, 0.85912317f},
-std::array<float,2>{0.745801806f, 0.882570326f},
-std::array<float,2>{0.0175060369f, 0.301768273f},
-std::array<float,2>{0.930285215f, 0.0596973449f},
-std::array<float,2>{0.34310922f, 0.5025962f},
-std::array<float,2>{0.855427265f, 0.699815452f},
-std::array<float,2>{0.44587177f, 0.127209485f},
-std::array<float,2>{0.602246702f, 0.395574212f},
-std::array<float,2>{0.207323328f, 0.782840073f},
-std::array<float,2>{0.952744544f, 0.815991342f},
-std::array<float,2>{0.290244937f, 0.493177444f},
-std::array<float,2>{0.6405496f, 0.210234836f},
-std::array<float,2>{0.0861197412f, 0.683791161f},
-std::array<float,2>{0.512717605f, 0.588793814f},
-std::array<float,2>{0.149268925f, 0.0775547773f},
-std::array<float,2>{0.807785869f, 0.345946252f},
-std::array<float,2>{0.383487314f, 0.966865718f},
-std::array<float,2>{0.641310513f, 0.873333871f},
-std::array<float,2>{0.0774900913f, 0.467167139f},
-std::array<float,2>{0.956420481f, 0.226543218f},
-std::array<float,2>{0.30141747f, 0.650963604f},
-std::array<float,2>{0.79531908f, 0.611736f},
-std::array<float,2>{0.39248246f, 0.10752859f},
-std::array<float,2>{0.531025589f, 0.336015016f},
-std::array<float,2>{0.130555347f, 0.979881167f},
-std::array<float,2>{0.914001942f, 0.92834121f},
-std::array<float,2>{0.328099668f, 0.260464549f},
-std::array<float,2>{0.727036834f, 0.023233857f},
-std::array<float,2>{0.0128054004f, 0.554203153f},
-std::array<float,2>{0.617013812f, 0.725998998f},
-std::array<float,2>{0.20218052f, 0.18389f},
-std::array<float,2>{0.859621942f, 0.433880627f},
-std::array<float,2>{0.455806315f, 0.763258278f},
-std::array<float,2>{0.556951463f, 0.939679027f},
-std::array<float,2>{0.184881195f, 0.371914953f},
-std::array<float,2>{0.769246697f, 0.0850318f},
-std::array<float,2>{0.411916882f, 0.562613606f},
-std::array<float,2>{0.986263216f, 0.661454439f},
-std::array<float,2>{0.266640216f, 0.195908725f},
-std::array<float,2>{0.68723321f, 0.48420009f},
-std::array<float,2>{0.106582351f, 0.834949613f},
-std::array<float,2>{0.816460133f, 0.797190189f},
-std::array<float,2>{0.482932627f, 0.377550811f},
-std::array<float,2>{0.57663101f, 0.154367819f},
-std::array<float,2>{0.222269267f, 0.715587974f},
-std::array<float,2>{0.690156817f, 0.528124511f},
-std::array<float,2>{0.0599464439f, 0.040599376f},
-std::array<float,2>{0.887148142f, 0.281911969f},
-std::array<float,2>{0.364805698f, 0.903338671f},
-std::array<float,2>{0.533882797f, 0.809589326f},
-std::array<float,2>{0.167818755f, 0.383513331f},
-std::array<float,2>{0.759593546f, 0.143473834f},
-std::array<float,2>{0.431746781f, 0.707484365f},
-std::array<float,2>{0.982328653f, 0.51973033f},
-std::array<float,2>{0.265420884f, 0.0348306112f},
-std::array<float,2>{0.671546876f, 0.29350844f},
-std::array<float,2>{0.111394808f, 0.896062255f},
-std::array<float,2>{0.840973079f, 0.952900469f},
-std::array<float,2>{0.492048711f, 0.365345776f},
-std::array<float,2>{0.578585923f, 0.0892558172f},
-std::array<float,2>{0.247165859f, 0.576628625f},
-std::array<float,2>{0.718070507f, 0.668354094f},
-std::array<float,2>{0.0430904217f, 0.188495591f},
-std::array<float,2>{0.893074453f, 0.472252935f},
-std::array<float,2>{0.34605515f, 0.843522072f},
-std::array<float,2>{0.635347366f, 0.930458069f},
-std::array<float,2>{0.0904919431f, 0.25268954f},
-std::array<float,2>{0.947733879f, 0.0298282709f},
-std::array<float,2>{0.296287298f, 0.556048095f},
-std::array<float,2>{0.80970633f, 0.731529355f},
-std::array<float,2>{0.389555126f, 0.17768234f},
-std::array<float,2>{0.510205865f, 0.428458929f},
-std::array<float,2>{0.155188248f, 0.755149722f},
-std::array<float,2>{0.936318994f, 0.864552319f},
-std::array<float,2>{0.336361676f, 0.453826666f},
-std::array<float,2>{0.746746182f, 0.231448919f},
-std::array<float,2>{0.0220882967f, 0.642770648f},
-std::array<float,2>{0.605947673f, 0.618185163f},
-std::array<float,2>{0.204779655f, 0.0995157734f},
-std::array<float,2>{0.857532561f, 0.329189777f},
-std::array<float,2>{0.449643314f, 0.97223419f},
-std::array<float,2>{0.730717182f, 0.825575233f},
-std::array<float,2>{0.00784729235f, 0.491023004f},
-std::array<float,2>{0.909703851f, 0.217969686f},
-std::array<float,2>{0.321656287f, 0.675199687f},
-std::array<float,2>{0.865402937f, 0.584501445f},
-std::array<float,2>{0.457123041f, 0.0651646256f},
-std::array<float,2>{0.610849559f, 0.356954485f},
-std::array<float,2>{0.195766091f, 0.960115254f},
-std::array<float,2>{0.959608316f, 0.887792706f},
-std::array<float,2>{0.299043804f, 0.306291938f},
-std::array<float,2>{0.64796859f, 0.0500106774f},
-std::array<float,2>{0.0719713196f, 0.509110332f},
-std::array<float,2>{0.526486099f, 0.690374672f},
-std::array<float,2>{0.127784804f, 0.138372332f},
-std::array<float,2>{0.790577173f, 0.404677838f},
-std::array<float,2>{0.397799969f, 0.789393306f},
-std::array<float,2>{0.570757389f, 0.995482981f},
-std::array<float,2>{0.223954007f, 0.324672163f},
-std::array<float,2>{0.812638521f, 0.113373898f},
-std::array<float,2>{0.477643132f, 0.595987439f},
-std::array<float,2>{0.88603431f, 0.62959069f},
-std::array<float,2>{0.359620512f, 0.244190976f},
-std::array<float,2>{0.693426132f, 0.439412862f},
-std::array<float,2>{0.0560537353f, 0.846968293f},
-std::array<float,2>{0.771748662f, 0.780947387f},
-std::array<float,2>{0.409023017f, 0.417261004f},
-std::array<float,2>{0.559852362f, 0.169016361f},
-std::array<float,2>{0.182841197f, 0.742412508f},
-std::array<float,2>{0.680498779f, 0.536226094f},
-std::array<float,2>{0.10165108f, 0.0143806441f},
-std::array<float,2>{0.989812791f, 0.279630482f},
-std::array<float,2>{0.26956442f, 0.910054743f},
-std::array<float,2>{0.619892597f, 0.85402298f},
-std::array<float,2>{0.190819412f, 0.446641713f},
-std::array<float,2>{0.871226192f, 0.238140315f},
-std::array<float,2>{0.462582231f, 0.636127889f},
-std::array<float,2>{0.920808971f, 0.602439523f},
-std::array<float,2>{0.313113809f, 0.120130017f},
-std::array<float,2>{0.723943472f, 0.318572462f},
-std::array<float,2>{0.000871168042f, 0.985940993f},
-std::array<float,2>{0.782480359f, 0.917997658f},
-std::array<float,2>{0.401149899f, 0.267231435f},
-std::array<float,2>{0.520812631f, 0.000633433927f},
-std::array<float,2>{0.138234228f, 0.545432866f},
-std::array<float,2>{0.648644984f, 0.734464765f},
-std::array<float,2>{0.0662042499f, 0.156336799f},
-std::array<float,2>{0.961640239f, 0.411424249f},
-std::array<float,2>{0.30594039f, 0.767084777f},
-std::array<float,2>{0.701299012f, 0.964522541f},
-std::array<float,2>{0.0536944531f, 0.350584388f},
-std::array<float,2>{0.88273859f, 0.0709339306f},
-std::array<float,2>{0.36759153f, 0.591546714f},
-std::array<float,2>{0.824465573f, 0.680388749f},
-std::array<float,2>{0.474351168f, 0.206559256f},
-std::array<float,2>{0.5670771f, 0.498674333f},
-std::array<float,2>{0.227466047f, 0.816563249f},
-std::array<float,2>{0.995491147f, 0.786621034f},
-std::array<float,2>{0.274632066f, 0.392309695f},
-std::array<float,2>{0.675781786f, 0.128955871f},
-std::array<float,2>{0.0979516655f, 0.695659697f},
-std::array<float,2>{0.554176271f, 0.506735146f},
-std::array<float,2>{0.176650152f, 0.0549661741f},
-std::array<float,2>{0.777863085f, 0.297534943f},
-std::array<float,2>{0.421227664f, 0.875396729f},
-std::array<float,2>{0.6566903f, 0.75873071f},
-std::array<float,2>{0.122247592f, 0.431358576f},
-std::array<float,2>{0.972432196f, 0.179767683f},
-std::array<float,2>{0.254574031f, 0.71944195f},
-std::array<float,2>{0.75698632f, 0.547783792f},
-std::array<float,2>{0.423234105f, 0.0172403492f},
-std::array<float,2>{0.542728424f, 0.263369858f},
-std::array<float,2>{0.156264424f, 0.92380172f},
-std::array<float,2>{0.90035218f, 0.98369211f},
-std::array<float,2>{0.355256826f, 0.342416584f},
-std::array<float,2>{0.705630362f, 0.103587188f},
-std::array<float,2>{0.0374520235f, 0.615446985f},
-std::array<float,2>{0.5935992f, 0.652698278f},
-std::array<float,2>{0.23916018f, 0.220278889f},
-std::array<float,2>{0.83283478f, 0.461787194f},
-std::array<float,2>{0.493477523f, 0.869536698f},
-std::array<float,2>{0.504905224f, 0.899680138f},
-std::array<float,2>{0.144984737f, 0.287018389f},
-std::array<float,2>{0.800507128f, 0.0434802957f},
-std::array<float,2>{0.376743466f, 0.52381438f},
-std::array<float,2>{0.939538479f, 0.711326957f},
-std::array<float,2>{0.287155688f, 0.149346143f},
-std::array<float,2>{0.627874911f, 0.3801018f},
-std::array<float,2>{0.078399457f, 0.804398596f},
-std::array<float,2>{0.848833025f, 0.828916132f},
-std::array<float,2>{0.444473624f, 0.477557898f},
-std::array<float,2>{0.597600281f, 0.200752124f},
-std::array<float,2>{0.214417726f, 0.656831682f},
-std::array<float,2>{0.737162292f, 0.569401741f},
-std::array<float,2>{0.0303689297f, 0.0796846971f},
-std::array<float,2>{0.929215908f, 0.369029254f},
-std::array<float,2>{0.331555665f, 0.94469583f},
-std::array<float,2>{0.544592142f, 0.820966065f},
-std::array<float,2>{0.161345094f, 0.485874772f},
-std::array<float,2>{0.753278971f, 0.214813814f},
-std::array<float,2>{0.425862551f, 0.678694487f},
-std::array<float,2>{0.97457248f, 0.58064872f},
-std::array<float,2>{0.253309965f, 0.0702049881f},
-std::array<float,2>{0.662555814f, 0.355405569f},
-std::array<float,2>{0.120898306f, 0.953704715f},
-std::array<float,2>{0.830081463f, 0.883378148f},
-std::array<float,2>{0.498999476f, 0.312065929f},
-std::array<float,2>{0.589429021f, 0.0518552698f},
-std::array<float,2>{0.238241896f, 0.514077246f},
-std::array<float,2>{0.710432529f, 0.691767395f},
-std::array<float,2>{0.0327814333f, 0.135212362f},
-std::array<float,2>{0.903737664f, 0.400255948f},
-std::array<float,2>{0.355595827f, 0.796453953f},
-std::array<float,2>{0.631582201f, 0.999947846f},
-std::array<float,2>{0.0826372057f, 0.322072595f},
-std::array<float,2>{0.94363606f, 0.109404802f},
-std::array<float,2>{0.284712672f, 0.601095915f},
-std::array<float,2>{0.802022457f, 0.626146853f},
-std::array<float,2>{0.382112086f, 0.248334795f},
-std::array<float,2>{0.502892852f, 0.442481339f},
-std::array<float,2>{0.141400069f, 0.848753333f},
-std::array<float,2>{0.923058391f, 0.774429321f},
-std::array<float,2>{0.33405146f, 0.419909f},
-std::array<float,2>{0.741651356f, 0.166530922f},
-std::array<float,2>{0.0263734274f, 0.749426484f},
-std::array<float,2>{0.599975348f, 0.533028245f},
-std::array<float,2>{0.216183558f, 0.00792992674f},
-std::array<float,2>{0.843788981f, 0.275123477f},
-std::array<float,2>{0.439486682f, 0.910582244f},
-std::array<float,2>{0.72033155f, 0.80660969f},
-std::array<float,2>{0.0059999004f, 0.389863193f},
-std::array<float,2>{0.917346776f, 0.147311658f},
-std::array<float,2>{0.319814235f, 0.706678212f},
-std::array<float,2>{0.86975497f, 0.51870209f},
-std::array<float,2>{0.465449274f, 0.0387574174f},
-std::array<float,2>{0.62160629f, 0.292331487f},
-std::array<float,2>{0.191416264f, 0.894390166f},
-std::array<float,2>{0.968662798f, 0.949001491f},
-std::array<float,2>{0.311738849f, 0.359579891f},
-std::array<float,2>{0.653857589f, 0.0917670801f},
-std::array<float,2>{0.0678547844f, 0.571433842f},
-std::array<float,2>{0.51698935f, 0.664127767f},
-std::array<float,2>{0.136226818f, 0.192583114f},
-std::array<float,2>{0.786890209f, 0.47640866f},
-std::array<float,2>{0.403424233f, 0.837457836f},
-std::array<float,2>{0.564185977f, 0.936387241f},
-std::array<float,2>{0.232433468f, 0.257149041f},
-std::array<float,2>{0.820628047f, 0.025034558f},
-std::array<float,2>{0.46964395f, 0.558918893f},
-std::array<float,2>{0.87634331f, 0.728820145f},
-std::array<float,2>{0.37206766f, 0.174701735f},
-std::array<float,2>{0.698630989f, 0.4240444f},
-std::array<float,2>{0.0487431102f, 0.750909746f},
-std::array<float,2>{0.776608884f, 0.861992896f},
-std::array<float,2>{0.414948583f, 0.458980888f},
-std::array<float,2>{0.550663412f, 0.226675928f},
-std::array<float,2>{0.174733207f, 0.647849977f},
-std::array<float,2>{0.674160361f, 0.623027384f},
-std::array<float,2>{0.0963127092f, 0.0943301842f},
-std::array<float,2>{0.996742189f, 0.334981263f},
-std::array<float,2>{0.279315084f, 0.976296782f},
-std::array<float,2>{0.614390016f, 0.762052178f},
-std::array<float,2>{0.200375304f, 0.434645861f},
-std::array<float,2>{0.861822188f, 0.18461813f},
-std::array<float,2>{0.454690069f, 0.724633276f},
-std::array<float,2>{0.910496175f, 0.55330795f},
-std::array<float,2>{0.326108068f, 0.0222775843f},
-std::array<float,2>{0.729895651f, 0.261140078f},
-std::array<float,2>{0.0140700992f, 0.928827941f},
-std::array<float,2>{0.79413116f, 0.978534877f},
-std::array<float,2>{0.393709928f, 0.337131441f},
-std::array<float,2>{0.527650476f, 0.108467542f},
-std::array<float,2>{0.131144285f, 0.612668812f},
-std::array<float,2>{0.643871725f, 0.651751935f},
-std::array<float,2>{0.0749642327f, 0.224963501f},
-std::array<float,2>{0.95374167f, 0.468059778f},
-std::array<float,2>{0.304623097f, 0.874967873f},
-std::array<float,2>{0.687552691f, 0.903292835f},
-std::array<float,2>{0.0620038174f, 0.282867521f},
-std::array<float,2>{0.890066385f, 0.0399490222f},
-std::array<float,2>{0.365568548f, 0.529213309f},
-std::array<float,2>{0.819631457f, 0.716738939f},
-std::array<float,2>{0.48165521f, 0.156107619f},
-std::array<float,2>{0.575631499f, 0.378343582f},
-std::array<float,2>{0.219973817f, 0.79882735f},
-std::array<float,2>{0.987946153f, 0.834985375f},
-std::array<float,2>{0.267864376f, 0.482461482f},
-std::array<float,2>{0.684091091f, 0.196967974f},
-std::array<float,2>{0.108982481f, 0.660944998f},
-std::array<float,2>{0.556284726f, 0.56408155f},
-std::array<float,2>{0.186894774f, 0.0848782957f},
-std::array<float,2>{0.76717484f, 0.372347236f},
-std::array<float,2>{0.413953036f, 0.940789461f},
-std::array<float,2>{0.666239023f, 0.857634187f},
-std::array<float,2>{0.116517812f, 0.451192588f},
-std::array<float,2>{0.980197191f, 0.240568563f},
-std::array<float,2>{0.258761019f, 0.63823092f},
-std::array<float,2>{0.765024424f, 0.607196927f},
-std::array<float,2>{0.434740514f, 0.123190604f},
-std::array<float,2>{0.536660552f, 0.312760204f},
-std::array<float,2>{0.171857446f, 0.991917789f},
-std::array<float,2>{0.895127833f, 0.915366292f},
-std::array<float,2>{0.350016981f, 0.271884948f},
-std::array<float,2>{0.713354468f, 0.00583605468f},
-std::array<float,2>{0.0403530002f, 0.540423989f},
-std::array<float,2>{0.583223343f, 0.739269435f},
-std::array<float,2>{0.244659215f, 0.161020637f},
-std::array<float,2>{0.836545825f, 0.409208328f},
-std::array<float,2>{0.486146688f, 0.77168864f},
-std::array<float,2>{0.514422059f, 0.96791774f},
-std::array<float,2>{0.151170418f, 0.34760043f},
-std::array<float,2>{0.805470049f, 0.0763705224f},
-std::array<float,2>{0.385337561f, 0.58977896f},
-std::array<float,2>{0.949547052f, 0.684763551f},
-std::array<float,2>{0.292103887f, 0.209504083f},
-std::array<float,2>{0.637978911f, 0.493147522f},
-std::array<float,2>{0.0897012949f, 0.81472075f},
-std::array<float,2>{0.852398217f, 0.781629264f},
-std::array<float,2>{0.448327184f, 0.394695908f},
-std::array<float,2>{0.604675353f, 0.128401637f},
-std::array<float,2>{0.210170999f, 0.700406373f},
-std::array<float,2>{0.743405879f, 0.5033319f},
-std::array<float,2>{0.018853303f, 0.0592132099f},
-std::array<float,2>{0.932366371f, 0.301571906f},
-std::array<float,2>{0.341457635f, 0.881166101f},
-std::array<float,2>{0.524980605f, 0.790763438f},
-std::array<float,2>{0.125657797f, 0.405762404f},
-std::array<float,2>{0.791246355f, 0.136950597f},
-std::array<float,2>{0.394749373f, 0.691374958f},
-std::array<float,2>{0.958137929f, 0.508589208f},
-std::array<float,2>{0.297054917f, 0.0494620129f},
-std::array<float,2>{0.645397663f, 0.305282056f},
-std::array<float,2>{0.0735183656f, 0.88717407f},
-std::array<float,2>{0.864679396f, 0.959636807f},
-std::array<float,2>{0.459323823f, 0.356175572f},
-std::array<float,2>{0.612646341f, 0.0656029209f},
-std::array<float,2>{0.198144317f, 0.585910499f},
-std::array<float,2>{0.733430803f, 0.674570799f},
-std::array<float,2>{0.0099988794f, 0.217422798f},
-std::array<float,2>{0.907319903f, 0.491429001f},
-std::array<float,2>{0.32242915f, 0.82453233f},
-std::array<float,2>{0.682797432f, 0.908205986f},
-std::array<float,2>{0.105045952f, 0.281104505f},
-std::array<float,2>{0.990845621f, 0.0155802947f},
-std::array<float,2>{0.273243099f, 0.535802662f},
-std::array<float,2>{0.770624518f, 0.743665159f},
-std::array<float,2>{0.407219261f, 0.168207794f},
-std::array<float,2>{0.561136603f, 0.41650629f},
-std::array<float,2>{0.180761054f, 0.779770911f},
-std::array<float,2>{0.884611905f, 0.846525669f},
-std::array<float,2>{0.363013506f, 0.438298076f},
-std::array<float,2>{0.692293406f, 0.245691583f},
-std::array<float,2>{0.0584199168f, 0.630385756f},
-std::array<float,2>{0.573725402f, 0.597244442f},
-std::array<float,2>{0.226000443f, 0.115068205f},
-std::array<float,2>{0.815324962f, 0.325855017f},
-std::array<float,2>{0.479028523f, 0.994465113f},
-std::array<float,2>{0.715130925f, 0.84250319f},
-std::array<float,2>{0.0450166315f, 0.471384078f},
-std::array<float,2>{0.892208099f, 0.188076183f},
-std::array<float,2>{0.34375158f, 0.669092298f},
-std::array<float,2>{0.843024909f, 0.578112841f},
-std::array<float,2>{0.488536268f, 0.0882708132f},
-std::array<float,2>{0.581494749f, 0.366518915f},
-std::array<float,2>{0.248242483f, 0.952126801f},
-std::array<float,2>{0.982656837f, 0.895093799f},
-std::array<float,2>{0.263333887f, 0.294891953f},
-std::array<float,2>{0.668397963f, 0.0338960141f},
-std::array<float,2>{0.110741884f, 0.520517468f},
-std::array<float,2>{0.53235954f, 0.708303154f},
-std::array<float,2>{0.16517061f, 0.144220635f},
-std::array<float,2>{0.75978893f, 0.383915514f},
-std::array<float,2>{0.43110317f, 0.808594465f},
-std::array<float,2>{0.608368456f, 0.971054137f},
-std::array<float,2>{0.206324235f, 0.328677177f},
-std::array<float,2>{0.855568409f, 0.0979449004f},
-std::array<float,2>{0.452076137f, 0.617231548f},
-std::array<float,2>{0.934332609f, 0.643612087f},
-std::array<float,2>{0.339232951f, 0.230659738f},
-std::array<float,2>{0.749062777f, 0.454426855f},
-std::array<float,2>{0.0211630985f, 0.864085376f},
-std::array<float,2>{0.811506152f, 0.754518211f},
-std::array<float,2>{0.388500959f, 0.428899378f},
-std::array<float,2>{0.509249628f, 0.176350862f},
-std::array<float,2>{0.153113112f, 0.731361568f},
-std::array<float,2>{0.633848846f, 0.555230737f},
-std::array<float,2>{0.0936392993f, 0.0306899268f},
-std::array<float,2>{0.947089553f, 0.253269464f},
-std::array<float,2>{0.29333654f, 0.930677056f},
-std::array<float,2>{0.589944661f, 0.870945275f},
-std::array<float,2>{0.241356224f, 0.461957425f},
-std::array<float,2>{0.834249377f, 0.218782201f},
-std::array<float,2>{0.494651735f, 0.653607488f},
-std::array<float,2>{0.901301444f, 0.616850674f},
-std::array<float,2>{0.35246712f, 0.104535438f},
-std::array<float,2>{0.703969479f, 0.343390256f},
-std::array<float,2>{0.0357995294f, 0.983091772f},
-std::array<float,2>{0.75585562f, 0.922161937f},
-std::array<float,2>{0.424916059f, 0.262148589f},
-std::array<float,2>{0.539995193f, 0.0165036172f},
-std::array<float,2>{0.158936903f, 0.548106551f},
-std::array<float,2>{0.658618629f, 0.719992101f},
-std::array<float,2>{0.124805994f, 0.181300983f},
-std::array<float,2>{0.970365405f, 0.429841161f},
-std::array<float,2>{0.256804377f, 0.759180069f},
-std::array<float,2>{0.735517263f, 0.944143772f},
-std::array<float,2>{0.0279542506f, 0.3673926f},
-std::array<float,2>{0.927384257f, 0.0783874542f},
-std::array<float,2>{0.329449624f, 0.569257081f},
-std::array<float,2>{0.850932062f, 0.657625139f},
-std::array<float,2>{0.44329071f, 0.19979164f},
-std::array<float,2>{0.595126033f, 0.47709623f},
-std::array<float,2>{0.21279192f, 0.829687238f},
-std::array<float,2>{0.938437104f, 0.803125918f},
-std::array<float,2>{0.285523862f, 0.379719645f},
-std::array<float,2>{0.626479208f, 0.150379702f},
-std::array<float,2>{0.0806133226f, 0.712226331f},
-std::array<float,2>{0.507581651f, 0.525203586f},
-std::array<float,2>{0.147141725f, 0.0443076566f},
-std::array<float,2>{0.797565401f, 0.285449058f},
-std::array<float,2>{0.377460092f, 0.899299622f},
-std::array<float,2>{0.650403798f, 0.765823007f},
-std::array<float,2>{0.0642069206f, 0.410523176f},
-std::array<float,2>{0.964002073f, 0.15726167f},
-std::array<float,2>{0.307582438f, 0.735942364f},
-std::array<float,2>{0.784663618f, 0.546040475f},
-std::array<float,2>{0.398887455f, 0.00104635616f},
-std::array<float,2>{0.522108078f, 0.26643911f},
-std::array<float,2>{0.140466213f, 0.919318378f},
-std::array<float,2>{0.919896007f, 0.984427154f},
-std::array<float,2>{0.315213203f, 0.319971353f},
-std::array<float,2>{0.724709392f, 0.119640522f},
-std::array<float,2>{0.00386993587f, 0.602865219f},
-std::array<float,2>{0.617771149f, 0.63492465f},
-std::array<float,2>{0.188971907f, 0.236774415f},
-std::array<float,2>{0.87425822f, 0.445981175f},
-std::array<float,2>{0.463894248f, 0.854859293f},
-std::array<float,2>{0.552362561f, 0.876345277f},
-std::array<float,2>{0.178957462f, 0.298524499f},
-std::array<float,2>{0.779854059f, 0.0563156717f},
-std::array<float,2>{0.418833107f, 0.50751555f},
-std::array<float,2>{0.992442131f, 0.696555436f},
-std::array<float,2>{0.276305169f, 0.130407989f},
-std::array<float,2>{0.679609001f, 0.391324639f},
-std::array<float,2>{0.0998484343f, 0.785561144f},
-std::array<float,2>{0.826470137f, 0.818087637f},
-std::array<float,2>{0.475167274f, 0.499474645f},
-std::array<float,2>{0.568805456f, 0.205713332f},
-std::array<float,2>{0.229046315f, 0.6812343f},
-std::array<float,2>{0.699909985f, 0.590236068f},
-std::array<float,2>{0.0526801534f, 0.0720233694f},
-std::array<float,2>{0.880576193f, 0.350707054f},
-std::array<float,2>{0.370188147f, 0.963762939f},
-std::array<float,2>{0.500287592f, 0.849695027f},
-std::array<float,2>{0.14260447f, 0.444819957f},
-std::array<float,2>{0.804072022f, 0.246808648f},
-std::array<float,2>{0.379866958f, 0.627140999f},
-std::array<float,2>{0.942896605f, 0.597929716f},
-std::array<float,2>{0.282983184f, 0.112886123f},
-std::array<float,2>{0.63007617f, 0.324053735f},
-std::array<float,2>{0.0853249803f, 0.996712804f},
-std::array<float,2>{0.846646428f, 0.913392186f},
-std::array<float,2>{0.438262492f, 0.275620282f},
-std::array<float,2>{0.599534154f, 0.0114957001f},
-std::array<float,2>{0.217559397f, 0.53372848f},
-std::array<float,2>{0.739553571f, 0.74772054f},
-std::array<float,2>{0.0250801146f, 0.164290905f},
-std::array<float,2>{0.924652755f, 0.421644509f},
-std::array<float,2>{0.332042366f, 0.777146459f},
-std::array<float,2>{0.661436498f, 0.955882728f},
-std::array<float,2>{0.118185788f, 0.352374345f},
-std::array<float,2>{0.976259232f, 0.0670845956f},
-std::array<float,2>{0.251223832f, 0.57857132f},
-std::array<float,2>{0.750025392f, 0.677494764f},
-std::array<float,2>{0.428891093f, 0.212195083f},
-std::array<float,2>{0.545065582f, 0.487533033f},
-std::array<float,2>{0.163667694f, 0.823579609f},
-std::array<float,2>{0.906019807f, 0.794611514f},
-std::array<float,2>{0.358803093f, 0.402234614f},
-std::array<float,2>{0.708688855f, 0.132939786f},
-std::array<float,2>{0.0343611911f, 0.694073319f},
-std::array<float,2>{0.587477803f, 0.512654424f},
-std::array<float,2>{0.236306891f, 0.0546299517f},
-std::array<float,2>{0.829411149f, 0.309226304f},
-std::array<float,2>{0.497198433f, 0.885744572f},
-std::array<float,2>{0.696669281f, 0.752045035f},
-std::array<float,2>{0.050486315f, 0.422126919f},
-std::array<float,2>{0.877808452f, 0.173129573f},
-std::array<float,2>{0.374316275f, 0.727771878f},
-std::array<float,2>{0.823581696f, 0.561306119f},
-std::array<float,2>{0.471967041f, 0.027106503f},
-std::array<float,2>{0.566239297f, 0.254985511f},
-std::array<float,2>{0.232344493f, 0.933736265f},
-std::array<float,2>{0.999008596f, 0.973882437f},
-std::array<float,2>{0.278671712f, 0.333180845f},
-std::array<float,2>{0.672091722f, 0.0975359306f},
-std::array<float,2>{0.0946800411f, 0.623196125f},
-std::array<float,2>{0.546889424f, 0.645816207f},
-std::array<float,2>{0.173600644f, 0.229715064f},
-std::array<float,2>{0.775109589f, 0.460042596f},
-std::array<float,2>{0.416763186f, 0.860692322f},
-std::array<float,2>{0.624521375f, 0.891739845f},
-std::array<float,2>{0.194761798f, 0.289549828f},
-std::array<float,2>{0.868834615f, 0.0363875479f},
-std::array<float,2>{0.467588037f, 0.516372025f},
-std::array<float,2>{0.914173841f, 0.704284191f},
-std::array<float,2>{0.316637486f, 0.144617096f},
-std::array<float,2>{0.722095191f, 0.387813658f},
-std::array<float,2>{0.00422365032f, 0.80827564f},
-std::array<float,2>{0.787672877f, 0.839391649f},
-std::array<float,2>{0.404491276f, 0.473483324f},
-std::array<float,2>{0.518758357f, 0.194603115f},
-std::array<float,2>{0.134371474f, 0.667117298f},
-std::array<float,2>{0.656106889f, 0.57302773f},
-std::array<float,2>{0.0691484585f, 0.0935699567f},
-std::array<float,2>{0.965263546f, 0.362433702f},
-std::array<float,2>{0.309593886f, 0.946962178f},
-std::array<float,2>{0.577745795f, 0.798929155f},
-std::array<float,2>{0.221086875f, 0.375448346f},
-std::array<float,2>{0.8173877f, 0.153756559f},
-std::array<float,2>{0.483400255f, 0.718324304f},
-std::array<float,2>{0.887883902f, 0.531245649f},
-std::array<float,2>{0.363459229f, 0.0414019749f},
-std::array<float,2>{0.690855563f, 0.284962267f},
-std::array<float,2>{0.0592111871f, 0.904615402f},
-std::array<float,2>{0.768048704f, 0.937841117f},
-std::array<float,2>{0.410977066f, 0.373263597f},
-std::array<float,2>{0.558524966f, 0.0829244256f},
-std::array<float,2>{0.184407562f, 0.56491977f},
-std::array<float,2>{0.685994744f, 0.663745165f},
-std::array<float,2>{0.106231958f, 0.197821096f},
-std::array<float,2>{0.985292256f, 0.481949747f},
-std::array<float,2>{0.265919775f, 0.832382798f},
-std::array<float,2>{0.727939308f, 0.927104771f},
-std::array<float,2>{0.0118260132f, 0.259219736f},
-std::array<float,2>{0.912445605f, 0.0214766469f},
-std::array<float,2>{0.326256424f, 0.55114913f},
-std::array<float,2>{0.860464096f, 0.724606514f},
-std::array<float,2>{0.456510037f, 0.186133966f},
-std::array<float,2>{0.615867317f, 0.4373689f},
-std::array<float,2>{0.201591507f, 0.764584422f},
-std::array<float,2>{0.955818117f, 0.872497916f},
-std::array<float,2>{0.302634239f, 0.466042757f},
-std::array<float,2>{0.64202708f, 0.223391145f},
-std::array<float,2>{0.0764042363f, 0.648463249f},
-std::array<float,2>{0.529509008f, 0.610986769f},
-std::array<float,2>{0.129640922f, 0.106333397f},
-std::array<float,2>{0.79662478f, 0.339727223f},
-std::array<float,2>{0.390651584f, 0.977354884f},
-std::array<float,2>{0.638961911f, 0.814052224f},
-std::array<float,2>{0.0873411894f, 0.495728403f},
-std::array<float,2>{0.951983988f, 0.207942307f},
-std::array<float,2>{0.289806664f, 0.686618805f},
-std::array<float,2>{0.806721926f, 0.587072194f},
-std::array<float,2>{0.384107053f, 0.0748310462f},
-std::array<float,2>{0.512197435f, 0.345350444f},
-std::array<float,2>{0.149441242f, 0.965622127f},
-std::array<float,2>{0.931303442f, 0.879389226f},
-std::array<float,2>{0.342436314f, 0.302853674f},
-std::array<float,2>{0.744361937f, 0.0610288419f},
-std::array<float,2>{0.016495103f, 0.500974953f},
-std::array<float,2>{0.602812409f, 0.701529205f},
-std::array<float,2>{0.208742842f, 0.125836402f},
-std::array<float,2>{0.853768468f, 0.396970868f},
-std::array<float,2>{0.447009772f, 0.783228219f},
-std::array<float,2>{0.538117051f, 0.990167916f},
-std::array<float,2>{0.169401616f, 0.315708607f},
-std::array<float,2>{0.762247205f, 0.121663742f},
-std::array<float,2>{0.43697691f, 0.60906148f},
-std::array<float,2>{0.976960063f, 0.638788521f},
-std::array<float,2>{0.260641247f, 0.239770338f},
-std::array<float,2>{0.665741205f, 0.450694025f},
-std::array<float,2>{0.114101559f, 0.856485307f},
-std::array<float,2>{0.838155746f, 0.771105468f},
-std::array<float,2>{0.487061173f, 0.407691598f},
-std::array<float,2>{0.58463043f, 0.16289413f},
-std::array<float,2>{0.242729858f, 0.741446435f},
-std::array<float,2>{0.711695075f, 0.542110622f},
-std::array<float,2>{0.0419782661f, 0.00680667115f},
-std::array<float,2>{0.898232341f, 0.270057529f},
-std::array<float,2>{0.348094434f, 0.916797757f},
-std::array<float,2>{0.559445739f, 0.778255284f},
-std::array<float,2>{0.182180494f, 0.415560186f},
-std::array<float,2>{0.773138463f, 0.170986354f},
-std::array<float,2>{0.409888774f, 0.744530439f},
-std::array<float,2>{0.988957226f, 0.537138164f},
-std::array<float,2>{0.271304667f, 0.0135679627f},
-std::array<float,2>{0.680794299f, 0.279135168f},
-std::array<float,2>{0.102720119f, 0.907371163f},
-std::array<float,2>{0.814448237f, 0.994045556f},
-std::array<float,2>{0.476730078f, 0.326915532f},
-std::array<float,2>{0.571652949f, 0.11701522f},
-std::array<float,2>{0.223209992f, 0.594676971f},
-std::array<float,2>{0.694752276f, 0.631619275f},
-std::array<float,2>{0.0552817844f, 0.243611842f},
-std::array<float,2>{0.885042429f, 0.439646572f},
-std::array<float,2>{0.360381067f, 0.843783736f},
-std::array<float,2>{0.647209704f, 0.889947176f},
-std::array<float,2>{0.0712461025f, 0.307167083f},
-std::array<float,2>{0.960273087f, 0.048397705f},
-std::array<float,2>{0.300177246f, 0.510607541f},
-std::array<float,2>{0.789631069f, 0.688760281f},
-std::array<float,2>{0.39732793f, 0.140132204f},
-std::array<float,2>{0.525638163f, 0.403148025f},
-std::array<float,2>{0.128807396f, 0.791338444f},
-std::array<float,2>{0.908349693f, 0.827380061f},
-std::array<float,2>{0.321287513f, 0.489271164f},
-std::array<float,2>{0.732330024f, 0.216372967f},
-std::array<float,2>{0.00906349439f, 0.672752202f},
-std::array<float,2>{0.610337794f, 0.583600342f},
-std::array<float,2>{0.196385667f, 0.0626210794f},
-std::array<float,2>{0.867001116f, 0.358273923f},
-std::array<float,2>{0.45863083f, 0.957318008f},
-std::array<float,2>{0.747659147f, 0.867156982f},
-std::array<float,2>{0.0232084244f, 0.455896616f},
-std::array<float,2>{0.936682284f, 0.232882559f},
-std::array<float,2>{0.3378461f, 0.641865849f},
-std::array<float,2>{0.858893812f, 0.619973361f},
-std::array<float,2>{0.450849801f, 0.0996422097f},
-std::array<float,2>{0.606789351f, 0.330137551f},
-std::array<float,2>{0.203785688f, 0.96978128f},
-std::array<float,2>{0.948643804f, 0.932339609f},
-std::array<float,2>{0.295388311f, 0.251907498f},
-std::array<float,2>{0.636212766f, 0.0282475986f},
-std::array<float,2>{0.0914349481f, 0.55741024f},
-std::array<float,2>{0.511197269f, 0.73343879f},
-std::array<float,2>{0.15529868f, 0.179157481f},
-std::array<float,2>{0.809104562f, 0.427667022f},
-std::array<float,2>{0.390063107f, 0.75776124f},
-std::array<float,2>{0.579226971f, 0.949355721f},
-std::array<float,2>{0.246843964f, 0.36388728f},
-std::array<float,2>{0.840114951f, 0.0861952156f},
-std::array<float,2>{0.490826279f, 0.576120675f},
-std::array<float,2>{0.894071817f, 0.670520902f},
-std::array<float,2>{0.346689403f, 0.191193908f},
-std::array<float,2>{0.717266977f, 0.469663858f},
-std::array<float,2>{0.0447651222f, 0.840300679f},
-std::array<float,2>{0.758735478f, 0.810637057f},
-std::array<float,2>{0.432793319f, 0.386241019f},
-std::array<float,2>{0.534873247f, 0.142438158f},
-std::array<float,2>{0.166878194f, 0.709851265f},
-std::array<float,2>{0.670855761f, 0.522001743f},
-std::array<float,2>{0.11232271f, 0.0329794027f},
-std::array<float,2>{0.981379569f, 0.296785682f},
-std::array<float,2>{0.26385951f, 0.89780128f},
-std::array<float,2>{0.596191764f, 0.830545366f},
-std::array<float,2>{0.21379678f, 0.479499757f},
-std::array<float,2>{0.84841615f, 0.202465817f},
-std::array<float,2>{0.443903148f, 0.659864902f},
-std::array<float,2>{0.928051114f, 0.568007231f},
-std::array<float,2>{0.330496013f, 0.0805459172f},
-std::array<float,2>{0.737993598f, 0.370702028f},
-std::array<float,2>{0.0296889432f, 0.943302274f},
-std::array<float,2>{0.799499691f, 0.901572704f},
-std::array<float,2>{0.375079066f, 0.288378567f},
-std::array<float,2>{0.504496276f, 0.0464456044f},
-std::array<float,2>{0.146208063f, 0.525867999f},
-std::array<float,2>{0.628645003f, 0.713214099f},
-std::array<float,2>{0.0791386962f, 0.150755793f},
-std::array<float,2>{0.940947413f, 0.381065607f},
-std::array<float,2>{0.288809627f, 0.802684009f},
-std::array<float,2>{0.706514478f, 0.982047677f},
-std::array<float,2>{0.0390461497f, 0.341144979f},
-std::array<float,2>{0.899282932f, 0.10304603f},
-std::array<float,2>{0.353649974f, 0.614132464f},
-std::array<float,2>{0.833917797f, 0.654974639f},
-std::array<float,2>{0.493064016f, 0.220938236f},
-std::array<float,2>{0.592081249f, 0.463319272f},
-std::array<float,2>{0.239389211f, 0.867684424f},
-std::array<float,2>{0.971193671f, 0.76133585f},
-std::array<float,2>{0.255401433f, 0.433562189f},
-std::array<float,2>{0.65769887f, 0.183372155f},
-std::array<float,2>{0.121882841f, 0.722265005f},
-std::array<float,2>{0.541968107f, 0.549424589f},
-std::array<float,2>{0.15767993f, 0.0187571459f},
-std::array<float,2>{0.756088674f, 0.264962494f},
-std::array<float,2>{0.422007501f, 0.925710261f},
-std::array<float,2>{0.677072644f, 0.788175762f},
-std::array<float,2>{0.0994769409f, 0.393161625f},
-std::array<float,2>{0.994721174f, 0.131860167f},
-std::array<float,2>{0.273824275f, 0.69810003f},
-std::array<float,2>{0.778551757f, 0.505317211f},
-std::array<float,2>{0.420017958f, 0.0580899641f},
-std::array<float,2>{0.553447723f, 0.300174803f},
-std::array<float,2>{0.177221015f, 0.878185511f},
-std::array<float,2>{0.881225169f, 0.962158382f},
-std::array<float,2>{0.368983299f, 0.348639429f},
-std::array<float,2>{0.702591062f, 0.0728866309f},
-std::array<float,2>{0.0544402748f, 0.592951655f},
-std::array<float,2>{0.567718983f, 0.683427751f},
-std::array<float,2>{0.227901042f, 0.204249799f},
-std::array<float,2>{0.825846314f, 0.496178448f},
-std::array<float,2>{0.473240346f, 0.819202662f},
-std::array<float,2>{0.519795895f, 0.921656609f},
-std::array<float,2>{0.136787564f, 0.268780529f},
-std::array<float,2>{0.78215307f, 0.0029980531f},
-std::array<float,2>{0.401778877f, 0.543576241f},
-std::array<float,2>{0.96284461f, 0.737363815f},
-std::array<float,2>{0.305021584f, 0.159593776f},
-std::array<float,2>{0.649508595f, 0.412983745f},
-std::array<float,2>{0.065399833f, 0.768909037f},
-std::array<float,2>{0.872249961f, 0.852842569f},
-std::array<float,2>{0.461249083f, 0.448372662f},
-std::array<float,2>{0.620743334f, 0.235435605f},
-std::array<float,2>{0.189801008f, 0.634612083f},
-std::array<float,2>{0.723491848f, 0.604635775f},
-std::array<float,2>{0.00131706195f, 0.11869248f},
-std::array<float,2>{0.920977414f, 0.317204893f},
-std::array<float,2>{0.314143836f, 0.987740219f},
-std::array<float,2>{0.536237657f, 0.857114851f},
-std::array<float,2>{0.171151891f, 0.450427592f},
-std::array<float,2>{0.765623569f, 0.239711419f},
-std::array<float,2>{0.435525835f, 0.639520943f},
-std::array<float,2>{0.979914963f, 0.608870745f},
-std::array<float,2>{0.258016258f, 0.121542461f},
-std::array<float,2>{0.666637778f, 0.31626302f},
-std::array<float,2>{0.116861567f, 0.989324749f},
-std::array<float,2>{0.836133599f, 0.916088045f},
-std::array<float,2>{0.485833496f, 0.269872904f},
-std::array<float,2>{0.583962619f, 0.00615986856f},
-std::array<float,2>{0.244298428f, 0.542860687f},
-std::array<float,2>{0.713633716f, 0.741746962f},
-std::array<float,2>{0.0406360216f, 0.162457511f},
-std::array<float,2>{0.894942105f, 0.407772273f},
-std::array<float,2>{0.35052523f, 0.770646751f},
-std::array<float,2>{0.63845557f, 0.964847565f},
-std::array<float,2>{0.0891226605f, 0.344914496f},
-std::array<float,2>{0.949779332f, 0.0746905506f},
-std::array<float,2>{0.292747885f, 0.587459147f},
-std::array<float,2>{0.805136144f, 0.687185943f},
-std::array<float,2>{0.38516742f, 0.207119137f},
-std::array<float,2>{0.513830006f, 0.495394111f},
-std::array<float,2>{0.150565729f, 0.813813329f},
-std::array<float,2>{0.931841791f, 0.783930123f},
-std::array<float,2>{0.341069609f, 0.397365689f},
-std::array<float,2>{0.743967593f, 0.125440031f},
-std::array<float,2>{0.0190456752f, 0.70170182f},
-std::array<float,2>{0.60531944f, 0.500210762f},
-std::array<float,2>{0.210557148f, 0.0612995923f},
-std::array<float,2>{0.851653695f, 0.30338335f},
-std::array<float,2>{0.448816925f, 0.879559934f},
-std::array<float,2>{0.730207443f, 0.763821483f},
-std::array<float,2>{0.0145257926f, 0.436599404f},
-std::array<float,2>{0.91101402f, 0.185548812f},
-std::array<float,2>{0.32520622f, 0.723712802f},
-std::array<float,2>{0.861479044f, 0.551603079f},
-std::array<float,2>{0.45428881f, 0.0207067523f},
-std::array<float,2>{0.614893317f, 0.259668648f},
-std::array<float,2>{0.201115891f, 0.9276281f},
-std::array<float,2>{0.95329994f, 0.976710856f},
-std::array<float,2>{0.303998441f, 0.339218229f},
-std::array<float,2>{0.644158781f, 0.105903894f},
-std::array<float,2>{0.0744238347f, 0.610459983f},
-std::array<float,2>{0.528171241f, 0.649280548f},
-std::array<float,2>{0.131464079f, 0.222678363f},
-std::array<float,2>{0.794677615f, 0.466659665f},
-std::array<float,2>{0.394368857f, 0.87257421f},
-std::array<float,2>{0.575790465f, 0.90492332f},
-std::array<float,2>{0.220602065f, 0.284251511f},
-std::array<float,2>{0.819920778f, 0.0417484306f},
-std::array<float,2>{0.482246578f, 0.530617237f},
-std::array<float,2>{0.890375972f, 0.717815399f},
-std::array<float,2>{0.366141528f, 0.15409179f},
-std::array<float,2>{0.688065767f, 0.375736445f},
-std::array<float,2>{0.0620773211f, 0.799636364f},
-std::array<float,2>{0.766701758f, 0.832980573f},
-std::array<float,2>{0.413246632f, 0.48147285f},
-std::array<float,2>{0.555709243f, 0.197575763f},
-std::array<float,2>{0.187442079f, 0.663263917f},
-std::array<float,2>{0.683823347f, 0.565202653f},
-std::array<float,2>{0.10852021f, 0.0823391527f},
-std::array<float,2>{0.987332582f, 0.373837501f},
-std::array<float,2>{0.268435717f, 0.938447475f},
-std::array<float,2>{0.621519327f, 0.807803035f},
-std::array<float,2>{0.191979647f, 0.388616443f},
-std::array<float,2>{0.869381368f, 0.145338714f},
-std::array<float,2>{0.465331078f, 0.704602182f},
-std::array<float,2>{0.917617321f, 0.515730917f},
-std::array<float,2>{0.320207059f, 0.0368016325f},
-std::array<float,2>{0.719737887f, 0.289962083f},
-std::array<float,2>{0.00644458784f, 0.89234215f},
-std::array<float,2>{0.786366343f, 0.946701288f},
-std::array<float,2>{0.404108614f, 0.363219559f},
-std::array<float,2>{0.517107666f, 0.0931243747f},
-std::array<float,2>{0.136688501f, 0.572445631f},
-std::array<float,2>{0.653347611f, 0.66790092f},
-std::array<float,2>{0.0680892244f, 0.194941625f},
-std::array<float,2>{0.96811384f, 0.472945601f},
-std::array<float,2>{0.312012404f, 0.839315534f},
-std::array<float,2>{0.698990226f, 0.934249818f},
-std::array<float,2>{0.0478645973f, 0.255401641f},
-std::array<float,2>{0.876875281f, 0.0266946945f},
-std::array<float,2>{0.371480107f, 0.560917079f},
-std::array<float,2>{0.82111752f, 0.728444159f},
-std::array<float,2>{0.4691374f, 0.173485622f},
-std::array<float,2>{0.563875735f, 0.422721922f},
-std::array<float,2>{0.233105034f, 0.752901077f},
-std::array<float,2>{0.996569216f, 0.860852659f},
-std::array<float,2>{0.280040264f, 0.460745603f},
-std::array<float,2>{0.674530149f, 0.230114937f},
-std::array<float,2>{0.0961303338f, 0.646250606f},
-std::array<float,2>{0.550157666f, 0.623989105f},
-std::array<float,2>{0.174165666f, 0.0968377367f},
-std::array<float,2>{0.776909828f, 0.333810031f},
-std::array<float,2>{0.41446054f, 0.974167466f},
-std::array<float,2>{0.662794113f, 0.824139535f},
-std::array<float,2>{0.120227322f, 0.488199353f},
-std::array<float,2>{0.973805547f, 0.212499067f},
-std::array<float,2>{0.253542274f, 0.676797092f},
-std::array<float,2>{0.753549218f, 0.579045951f},
-std::array<float,2>{0.426309675f, 0.0664448887f},
-std::array<float,2>{0.543994129f, 0.352020264f},
-std::array<float,2>{0.16202645f, 0.955163181f},
-std::array<float,2>{0.904287279f, 0.886378706f},
-std::array<float,2>{0.356399894f, 0.308801591f},
-std::array<float,2>{0.71062398f, 0.0540151782f},
-std::array<float,2>{0.032436613f, 0.511759758f},
-std::array<float,2>{0.589010119f, 0.693793297f},
-std::array<float,2>{0.237347886f, 0.133461431f},
-std::array<float,2>{0.830715537f, 0.401435435f},
-std::array<float,2>{0.498517722f, 0.794068038f},
-std::array<float,2>{0.502373815f, 0.996300638f},
-std::array<float,2>{0.140874028f, 0.323511362f},
-std::array<float,2>{0.802376032f, 0.112577379f},
-std::array<float,2>{0.38234067f, 0.598317623f},
-std::array<float,2>{0.943909526f, 0.627574086f},
-std::array<float,2>{0.284520924f, 0.246342629f},
-std::array<float,2>{0.630939186f, 0.445108443f},
-std::array<float,2>{0.0821017623f, 0.850144029f},
-std::array<float,2>{0.844545007f, 0.776657641f},
-std::array<float,2>{0.440004289f, 0.421275705f},
-std::array<float,2>{0.600171685f, 0.164940923f},
-std::array<float,2>{0.216690704f, 0.747166097f},
-std::array<float,2>{0.741928935f, 0.53350836f},
-std::array<float,2>{0.0269772783f, 0.0108863469f},
-std::array<float,2>{0.923779011f, 0.275968015f},
-std::array<float,2>{0.334623247f, 0.913992345f},
-std::array<float,2>{0.521820486f, 0.76940608f},
-std::array<float,2>{0.139963582f, 0.412233084f},
-std::array<float,2>{0.784983635f, 0.160017297f},
-std::array<float,2>{0.399135739f, 0.738160253f},
-std::array<float,2>{0.964430988f, 0.542982697f},
-std::array<float,2>{0.306714237f, 0.00386487902f},
-std::array<float,2>{0.65094316f, 0.269192696f},
-std::array<float,2>{0.0638756603f, 0.921257138f},
-std::array<float,2>{0.874808609f, 0.987866461f},
-std::array<float,2>{0.4645136f, 0.316856176f},
-std::array<float,2>{0.617673397f, 0.118442014f},
-std::array<float,2>{0.188501835f, 0.605434477f},
-std::array<float,2>{0.725337565f, 0.634045601f},
-std::array<float,2>{0.0033512474f, 0.236217335f},
-std::array<float,2>{0.91919452f, 0.448835015f},
-std::array<float,2>{0.314727336f, 0.853433907f},
-std::array<float,2>{0.67887187f, 0.878713965f},
-std::array<float,2>{0.100247152f, 0.30060336f},
-std::array<float,2>{0.99297291f, 0.0583333485f},
-std::array<float,2>{0.275873423f, 0.505784988f},
-std::array<float,2>{0.779398501f, 0.697553933f},
-std::array<float,2>{0.418254763f, 0.132601172f},
-std::array<float,2>{0.55208081f, 0.392705411f},
-std::array<float,2>{0.179502919f, 0.788726985f},
-std::array<float,2>{0.88019228f, 0.818670034f},
-std::array<float,2>{0.370988548f, 0.497045696f},
-std::array<float,2>{0.699451506f, 0.204768479f},
-std::array<float,2>{0.0517678857f, 0.683064759f},
-std::array<float,2>{0.569214284f, 0.593549728f},
-std::array<float,2>{0.228709236f, 0.072556518f},
-std::array<float,2>{0.827043295f, 0.349600255f},
-std::array<float,2>{0.474831939f, 0.962680221f},
-std::array<float,2>{0.70349586f, 0.867471814f},
-std::array<float,2>{0.0354648978f, 0.463426858f},
-std::array<float,2>{0.900686264f, 0.221245006f},
-std::array<float,2>{0.351948351f, 0.654609859f},
-std::array<float,2>{0.834753036f, 0.613544047f},
-std::array<float,2>{0.49421075f, 0.102614403f},
-std::array<float,2>{0.590335131f, 0.341614395f},
-std::array<float,2>{0.241854653f, 0.981673777f},
-std::array<float,2>{0.969905198f, 0.924817562f},
-std::array<float,2>{0.256049782f, 0.265268683f},
-std::array<float,2>{0.658998668f, 0.0194336269f},
-std::array<float,2>{0.124460526f, 0.549292266f},
-std::array<float,2>{0.539278507f, 0.721966565f},
-std::array<float,2>{0.158298045f, 0.182763398f},
-std::array<float,2>{0.755033314f, 0.432634383f},
-std::array<float,2>{0.425751507f, 0.761205077f},
-std::array<float,2>{0.595538259f, 0.942401648f},
-std::array<float,2>{0.21214211f, 0.370248169f},
-std::array<float,2>{0.851224482f, 0.0810237601f},
-std::array<float,2>{0.442654163f, 0.567783535f},
-std::array<float,2>{0.927046418f, 0.659422517f},
-std::array<float,2>{0.330052316f, 0.203032255f},
-std::array<float,2>{0.73615706f, 0.480374187f},
-std::array<float,2>{0.027427176f, 0.83080864f},
-std::array<float,2>{0.79725498f, 0.802179754f},
-std::array<float,2>{0.377365321f, 0.38145119f},
-std::array<float,2>{0.506917417f, 0.150919467f},
-std::array<float,2>{0.146922797f, 0.713517547f},
-std::array<float,2>{0.626336634f, 0.526064754f},
-std::array<float,2>{0.0805496946f, 0.0463730954f},
-std::array<float,2>{0.93768245f, 0.288888484f},
-std::array<float,2>{0.285882413f, 0.902208865f},
-std::array<float,2>{0.581784844f, 0.840423286f},
-std::array<float,2>{0.248586342f, 0.469129294f},
-std::array<float,2>{0.843498528f, 0.190755084f},
-std::array<float,2>{0.488957316f, 0.67030555f},
-std::array<float,2>{0.891851008f, 0.575245082f},
-std::array<float,2>{0.344642133f, 0.0865921155f},
-std::array<float,2>{0.715461731f, 0.363549411f},
-std::array<float,2>{0.0454894453f, 0.949808896f},
-std::array<float,2>{0.760640204f, 0.898193538f},
-std::array<float,2>{0.431411892f, 0.295944601f},
-std::array<float,2>{0.532722831f, 0.0324079394f},
-std::array<float,2>{0.165637478f, 0.521688461f},
-std::array<float,2>{0.668646157f, 0.709391236f},
-std::array<float,2>{0.111051351f, 0.14201802f},
-std::array<float,2>{0.983265996f, 0.386043787f},
-std::array<float,2>{0.262822568f, 0.811078608f},
-std::array<float,2>{0.74968636f, 0.970311403f},
-std::array<float,2>{0.0206010453f, 0.330678493f},
-std::array<float,2>{0.933712184f, 0.10015963f},
-std::array<float,2>{0.339450419f, 0.619468629f},
-std::array<float,2>{0.856132209f, 0.642567992f},
-std::array<float,2>{0.451365232f, 0.233045489f},
-std::array<float,2>{0.607769787f, 0.455313265f},
-std::array<float,2>{0.206697598f, 0.866407633f},
-std::array<float,2>{0.946452379f, 0.757204354f},
-std::array<float,2>{0.293700337f, 0.427087545f},
-std::array<float,2>{0.634383798f, 0.179441944f},
-std::array<float,2>{0.0929495916f, 0.734343469f},
-std::array<float,2>{0.509359598f, 0.557056963f},
-std::array<float,2>{0.152636588f, 0.0275456477f},
-std::array<float,2>{0.810631573f, 0.251136571f},
-std::array<float,2>{0.387924939f, 0.931992471f},
-std::array<float,2>{0.644533992f, 0.791787386f},
-std::array<float,2>{0.0738687962f, 0.402702749f},
-std::array<float,2>{0.958790004f, 0.140153319f},
-std::array<float,2>{0.297789156f, 0.689194381f},
-std::array<float,2>{0.791791379f, 0.50984776f},
-std::array<float,2>{0.395492673f, 0.0480677858f},
-std::array<float,2>{0.524712503f, 0.307073325f},
-std::array<float,2>{0.125362605f, 0.890584588f},
-std::array<float,2>{0.907790303f, 0.957668543f},
-std::array<float,2>{0.323108286f, 0.357452571f},
-std::array<float,2>{0.734179199f, 0.0630507693f},
-std::array<float,2>{0.0104515897f, 0.583186209f},
-std::array<float,2>{0.612981439f, 0.672095239f},
-std::array<float,2>{0.197307572f, 0.215876356f},
-std::array<float,2>{0.864918351f, 0.490146637f},
-std::array<float,2>{0.459640294f, 0.827801108f},
-std::array<float,2>{0.560886681f, 0.908028007f},
-std::array<float,2>{0.181336716f, 0.278779119f},
-std::array<float,2>{0.771272659f, 0.0130843716f},
-std::array<float,2>{0.406453341f, 0.537981272f},
-std::array<float,2>{0.990464032f, 0.744818389f},
-std::array<float,2>{0.272557646f, 0.171556696f},
-std::array<float,2>{0.68336463f, 0.4153741f},
-std::array<float,2>{0.10476625f, 0.77754432f},
-std::array<float,2>{0.814740419f, 0.844270766f},
-std::array<float,2>{0.478817701f, 0.440356612f},
-std::array<float,2>{0.574144006f, 0.243878737f},
-std::array<float,2>{0.226076096f, 0.631107509f},
-std::array<float,2>{0.691785753f, 0.594103634f},
-std::array<float,2>{0.0579442456f, 0.116628572f},
-std::array<float,2>{0.883872628f, 0.326269686f},
-std::array<float,2>{0.362650901f, 0.993187904f},
-std::array<float,2>{0.512481451f, 0.815252602f},
-std::array<float,2>{0.149969757f, 0.492436737f},
-std::array<float,2>{0.807577789f, 0.209244147f},
-std::array<float,2>{0.384450495f, 0.68537277f},
-std::array<float,2>{0.951211035f, 0.589335024f},
-std::array<float,2>{0.289173633f, 0.07675457f},
-std::array<float,2>{0.639377415f, 0.347044617f},
-std::array<float,2>{0.087605387f, 0.96850884f},
-std::array<float,2>{0.854132533f, 0.881485999f},
-std::array<float,2>{0.446727484f, 0.300845206f},
-std::array<float,2>{0.603134155f, 0.0590734221f},
-std::array<float,2>{0.20817852f, 0.503784478f},
-std::array<float,2>{0.744679809f, 0.700773478f},
-std::array<float,2>{0.0160724018f, 0.128892705f},
-std::array<float,2>{0.93067044f, 0.395465851f},
-std::array<float,2>{0.342081666f, 0.781971514f},
-std::array<float,2>{0.6652596f, 0.991372406f},
-std::array<float,2>{0.113556214f, 0.313371032f},
-std::array<float,2>{0.977467239f, 0.123663619f},
-std::array<float,2>{0.259829223f, 0.606880546f},
-std::array<float,2>{0.761936605f, 0.637833655f},
-std::array<float,2>{0.437181711f, 0.240966737f},
-std::array<float,2>{0.538897991f, 0.451723248f},
-std::array<float,2>{0.169636548f, 0.858339369f},
-std::array<float,2>{0.897737801f, 0.772323012f},
-std::array<float,2>{0.348220468f, 0.409976423f},
-std::array<float,2>{0.711016417f, 0.160225749f},
-std::array<float,2>{0.0411506146f, 0.740106761f},
-std::array<float,2>{0.584301651f, 0.540892422f},
-std::array<float,2>{0.242294341f, 0.00524518779f},
-std::array<float,2>{0.838548362f, 0.272442907f},
-std::array<float,2>{0.486371845f, 0.915773869f},
-std::array<float,2>{0.691269517f, 0.798057079f},
-std::array<float,2>{0.0588011146f, 0.378878951f},
-std::array<float,2>{0.888373673f, 0.155548438f},
-std::array<float,2>{0.36422196f, 0.716106057f},
-std::array<float,2>{0.818009138f, 0.528576136f},
-std::array<float,2>{0.484111428f, 0.0394578353f},
-std::array<float,2>{0.577264607f, 0.282620013f},
-std::array<float,2>{0.221591741f, 0.902466357f},
-std::array<float,2>{0.984695792f, 0.941311955f},
-std::array<float,2>{0.266510963f, 0.37288782f},
-std::array<float,2>{0.686256707f, 0.0842060372f},
-std::array<float,2>{0.105539225f, 0.563519359f},
-std::array<float,2>{0.558059931f, 0.660338938f},
-std::array<float,2>{0.184009075f, 0.196698099f},
-std::array<float,2>{0.768299997f, 0.483021408f},
-std::array<float,2>{0.410347402f, 0.835758448f},
-std::array<float,2>{0.615275383f, 0.929397702f},
-std::array<float,2>{0.202066019f, 0.261447489f},
-std::array<float,2>{0.861011207f, 0.0219613407f},
-std::array<float,2>{0.456844687f, 0.553180099f},
-std::array<float,2>{0.912760377f, 0.725190639f},
-std::array<float,2>{0.326673865f, 0.185244575f},
-std::array<float,2>{0.728168428f, 0.435362369f},
-std::array<float,2>{0.0126169315f, 0.762363076f},
-std::array<float,2>{0.796231985f, 0.874138594f},
-std::array<float,2>{0.391540974f, 0.468475908f},
-std::array<float,2>{0.530078769f, 0.225539386f},
-std::array<float,2>{0.128933713f, 0.652141392f},
-std::array<float,2>{0.642106295f, 0.612928569f},
-std::array<float,2>{0.0766733885f, 0.109299786f},
-std::array<float,2>{0.955244362f, 0.337686658f},
-std::array<float,2>{0.301803976f, 0.979210556f},
-std::array<float,2>{0.565737665f, 0.750349462f},
-std::array<float,2>{0.231764883f, 0.42458117f},
-std::array<float,2>{0.823826969f, 0.174159527f},
-std::array<float,2>{0.472210497f, 0.72919929f},
-std::array<float,2>{0.877308726f, 0.559182286f},
-std::array<float,2>{0.374674916f, 0.0244582836f},
-std::array<float,2>{0.697057903f, 0.257701814f},
-std::array<float,2>{0.0499467999f, 0.935557365f},
-std::array<float,2>{0.774557292f, 0.975885212f},
-std::array<float,2>{0.416313291f, 0.335600197f},
-std::array<float,2>{0.547512889f, 0.0940840766f},
-std::array<float,2>{0.173166186f, 0.622398317f},
-std::array<float,2>{0.672657371f, 0.648151934f},
-std::array<float,2>{0.0939415619f, 0.22734499f},
-std::array<float,2>{0.998492002f, 0.458048463f},
-std::array<float,2>{0.278898448f, 0.861471534f},
-std::array<float,2>{0.722297847f, 0.893589675f},
-std::array<float,2>{0.00447467808f, 0.29284668f},
-std::array<float,2>{0.914940894f, 0.0383984558f},
-std::array<float,2>{0.31713751f, 0.51916343f},
-std::array<float,2>{0.868295133f, 0.70633918f},
-std::array<float,2>{0.467070907f, 0.146704629f},
-std::array<float,2>{0.624095857f, 0.390612721f},
-std::array<float,2>{0.195047617f, 0.805824041f},
-std::array<float,2>{0.965772986f, 0.837041438f},
-std::array<float,2>{0.310335875f, 0.476060748f},
-std::array<float,2>{0.655706465f, 0.193282649f},
-std::array<float,2>{0.0685166344f, 0.664988279f},
-std::array<float,2>{0.519353151f, 0.571844041f},
-std::array<float,2>{0.133978397f, 0.0911027193f},
-std::array<float,2>{0.78717494f, 0.359974027f},
-std::array<float,2>{0.405078381f, 0.948320568f},
-std::array<float,2>{0.630840182f, 0.849542618f},
-std::array<float,2>{0.0856505558f, 0.44292286f},
-std::array<float,2>{0.942713857f, 0.248907208f},
-std::array<float,2>{0.282501578f, 0.626751542f},
-std::array<float,2>{0.80465132f, 0.600712657f},
-std::array<float,2>{0.379381865f, 0.110348225f},
-std::array<float,2>{0.500637293f, 0.321712196f},
-std::array<float,2>{0.143263668f, 0.99911797f},
-std::array<float,2>{0.923972905f, 0.910908401f},
-std::array<float,2>{0.332534969f, 0.274718583f},
-std::array<float,2>{0.740023732f, 0.00837944821f},
-std::array<float,2>{0.0247901659f, 0.532536566f},
-std::array<float,2>{0.59899205f, 0.749511957f},
-std::array<float,2>{0.216898084f, 0.166020885f},
-std::array<float,2>{0.846124351f, 0.419224501f},
-std::array<float,2>{0.437739372f, 0.775350749f},
-std::array<float,2>{0.545442879f, 0.953542709f},
-std::array<float,2>{0.163327962f, 0.354828179f},
-std::array<float,2>{0.750619888f, 0.069648847f},
-std::array<float,2>{0.429598421f, 0.580087781f},
-std::array<float,2>{0.97568959f, 0.677995563f},
-std::array<float,2>{0.251915634f, 0.213973269f},
-std::array<float,2>{0.661814988f, 0.485468209f},
-std::array<float,2>{0.119104154f, 0.820544243f},
-std::array<float,2>{0.829640925f, 0.796014607f},
-std::array<float,2>{0.497691005f, 0.399803221f},
-std::array<float,2>{0.58708775f, 0.135627523f},
-std::array<float,2>{0.235394448f, 0.692202985f},
-std::array<float,2>{0.708041012f, 0.514326751f},
-std::array<float,2>{0.0347039215f, 0.0526616238f},
-std::array<float,2>{0.905382931f, 0.311958313f},
-std::array<float,2>{0.359064609f, 0.883165121f},
-std::array<float,2>{0.553211868f, 0.785798728f},
-std::array<float,2>{0.177275389f, 0.390718222f},
-std::array<float,2>{0.778957188f, 0.13017711f},
-std::array<float,2>{0.420897812f, 0.697119236f},
-std::array<float,2>{0.994172513f, 0.506940007f},
-std::array<float,2>{0.274186313f, 0.0559804887f},
-std::array<float,2>{0.677671254f, 0.298135251f},
-std::array<float,2>{0.098937571f, 0.876665235f},
-std::array<float,2>{0.825436532f, 0.962988496f},
-std::array<float,2>{0.472896755f, 0.351443648f},
-std::array<float,2>{0.568010449f, 0.0717518404f},
-std::array<float,2>{0.228089422f, 0.590553939f},
-std::array<float,2>{0.702763677f, 0.680756092f},
-std::array<float,2>{0.0537126698f, 0.205208823f},
-std::array<float,2>{0.881572604f, 0.499873519f},
-std::array<float,2>{0.368168235f, 0.817590594f},
-std::array<float,2>{0.65021497f, 0.919852853f},
-std::array<float,2>{0.0646539256f, 0.265858531f},
-std::array<float,2>{0.962089837f, 0.00162476872f},
-std::array<float,2>{0.30557698f, 0.546701849f},
-std::array<float,2>{0.78152889f, 0.735493541f},
-std::array<float,2>{0.402320325f, 0.157845989f},
-std::array<float,2>{0.520245969f, 0.410664171f},
-std::array<float,2>{0.137326255f, 0.766181827f},
-std::array<float,2>{0.92165935f, 0.855400205f},
-std::array<float,2>{0.313855171f, 0.445432246f},
-std::array<float,2>{0.722760558f, 0.236938044f},
-std::array<float,2>{0.00194798142f, 0.63558042f},
-std::array<float,2>{0.620384157f, 0.603155375f},
-std::array<float,2>{0.190209538f, 0.119227342f},
-std::array<float,2>{0.872946799f, 0.319350719f},
-std::array<float,2>{0.461448878f, 0.985112667f},
-std::array<float,2>{0.737785339f, 0.829182982f},
-std::array<float,2>{0.0299831685f, 0.476662517f},
-std::array<float,2>{0.928656101f, 0.199688539f},
-std::array<float,2>{0.330784202f, 0.657802582f},
-std::array<float,2>{0.847693563f, 0.568468571f},
-std::array<float,2>{0.443475336f, 0.0789257884f},
-std::array<float,2>{0.596117318f, 0.367844522f},
-std::array<float,2>{0.213252261f, 0.943607569f},
-std::array<float,2>{0.940893292f, 0.898551822f},
-std::array<float,2>{0.28827244f, 0.285704315f},
-std::array<float,2>{0.628334343f, 0.0446895882f},
-std::array<float,2>{0.0800082088f, 0.524646997f},
-std::array<float,2>{0.503998637f, 0.712833524f},
-std::array<float,2>{0.145705596f, 0.149766177f},
-std::array<float,2>{0.799019396f, 0.379263371f},
-std::array<float,2>{0.375785977f, 0.803431928f},
-std::array<float,2>{0.592660069f, 0.982804418f},
-std::array<float,2>{0.239755049f, 0.343114287f},
-std::array<float,2>{0.833225369f, 0.104980849f},
-std::array<float,2>{0.492490917f, 0.616596699f},
-std::array<float,2>{0.898872614f, 0.653937757f},
-std::array<float,2>{0.354428858f, 0.219576523f},
-std::array<float,2>{0.706834197f, 0.462525964f},
-std::array<float,2>{0.0385013372f, 0.87059474f},
-std::array<float,2>{0.756824791f, 0.759471357f},
-std::array<float,2>{0.422438979f, 0.430208534f},
-std::array<float,2>{0.541030169f, 0.180956334f},
-std::array<float,2>{0.157838359f, 0.720463634f},
-std::array<float,2>{0.65798682f, 0.548613191f},
-std::array<float,2>{0.121239595f, 0.015847927f},
-std::array<float,2>{0.970902145f, 0.262498677f},
-std::array<float,2>{0.254987925f, 0.922833264f},
-std::array<float,2>{0.607207239f, 0.863654137f},
-std::array<float,2>{0.203517199f, 0.454672843f},
-std::array<float,2>{0.858835518f, 0.231372967f},
-std::array<float,2>{0.45059669f, 0.644270658f},
-std::array<float,2>{0.937173724f, 0.617973685f},
-std::array<float,2>{0.337191135f, 0.098395139f},
-std::array<float,2>{0.747449577f, 0.328554362f},
-std::array<float,2>{0.0227423981f, 0.971314371f},
-std::array<float,2>{0.808713198f, 0.931378245f},
-std::array<float,2>{0.390219986f, 0.25346899f},
-std::array<float,2>{0.511588275f, 0.0309965406f},
-std::array<float,2>{0.156096682f, 0.554688752f},
-std::array<float,2>{0.636546552f, 0.730909824f},
-std::array<float,2>{0.0909601673f, 0.176267266f},
-std::array<float,2>{0.94908917f, 0.429242522f},
-std::array<float,2>{0.295787781f, 0.754026711f},
-std::array<float,2>{0.717573702f, 0.95163697f},
-std::array<float,2>{0.04410889f, 0.366924256f},
-std::array<float,2>{0.893954694f, 0.0885189623f},
-std::array<float,2>{0.347587734f, 0.577529669f},
-std::array<float,2>{0.840744257f, 0.669773459f},
-std::array<float,2>{0.490328491f, 0.187963381f},
-std::array<float,2>{0.579917371f, 0.470933229f},
-std::array<float,2>{0.246484116f, 0.842239082f},
-std::array<float,2>{0.980945289f, 0.809524596f},
-std::array<float,2>{0.264183849f, 0.384607196f},
-std::array<float,2>{0.669956923f, 0.143734306f},
-std::array<float,2>{0.112933204f, 0.708845735f},
-std::array<float,2>{0.534261644f, 0.521330476f},
-std::array<float,2>{0.166267559f, 0.0336554796f},
-std::array<float,2>{0.758286834f, 0.294118941f},
-std::array<float,2>{0.433228463f, 0.894577265f},
-std::array<float,2>{0.681229413f, 0.779943287f},
-std::array<float,2>{0.103319079f, 0.416285604f},
-std::array<float,2>{0.988524675f, 0.168556407f},
-std::array<float,2>{0.270871907f, 0.743646681f},
-std::array<float,2>{0.772944868f, 0.535201848f},
-std::array<float,2>{0.409276605f, 0.0151109481f},
-std::array<float,2>{0.559071422f, 0.280457705f},
-std::array<float,2>{0.181737348f, 0.908722639f},
-std::array<float,2>{0.885645628f, 0.994752884f},
-std::array<float,2>{0.360889316f, 0.325206995f},
-std::array<float,2>{0.69492954f, 0.114389695f},
-std::array<float,2>{0.0547116324f, 0.59690994f},
-std::array<float,2>{0.571941137f, 0.63036561f},
-std::array<float,2>{0.222994551f, 0.245397225f},
-std::array<float,2>{0.813547194f, 0.43785724f},
-std::array<float,2>{0.477433175f, 0.845792234f},
-std::array<float,2>{0.526043177f, 0.887409329f},
-std::array<float,2>{0.128310561f, 0.304747909f},
-std::array<float,2>{0.789235592f, 0.0491340645f},
-std::array<float,2>{0.396573365f, 0.50795418f},
-std::array<float,2>{0.960485458f, 0.690500319f},
-std::array<float,2>{0.300338537f, 0.137443185f},
-std::array<float,2>{0.646695137f, 0.405299067f},
-std::array<float,2>{0.0704620481f, 0.790320396f},
-std::array<float,2>{0.866359115f, 0.825066805f},
-std::array<float,2>{0.458397895f, 0.492133915f},
-std::array<float,2>{0.609844327f, 0.217176914f},
-std::array<float,2>{0.196878076f, 0.67427367f},
-std::array<float,2>{0.731804729f, 0.585096836f},
-std::array<float,2>{0.00975506566f, 0.0660786405f},
-std::array<float,2>{0.908891559f, 0.355767488f},
-std::array<float,2>{0.320465297f, 0.959308922f},
-std::array<float,2>{0.555092096f, 0.834429264f},
-std::array<float,2>{0.185789451f, 0.483601213f},
-std::array<float,2>{0.766179502f, 0.195320725f},
-std::array<float,2>{0.412818998f, 0.66196239f},
-std::array<float,2>{0.986486197f, 0.563298643f},
-std::array<float,2>{0.269477785f, 0.0856091306f},
-std::array<float,2>{0.684678078f, 0.371116996f},
-std::array<float,2>{0.107690044f, 0.940130353f},
-std::array<float,2>{0.818889797f, 0.904084444f},
-std::array<float,2>{0.480687171f, 0.281441718f},
-std::array<float,2>{0.574898839f, 0.040394742f},
-std::array<float,2>{0.218880191f, 0.527418911f},
-std::array<float,2>{0.688905001f, 0.714861751f},
-std::array<float,2>{0.0615030453f, 0.154961705f},
-std::array<float,2>{0.889572024f, 0.377360672f},
-std::array<float,2>{0.366499722f, 0.797480345f},
-std::array<float,2>{0.643537939f, 0.979988098f},
-std::array<float,2>{0.0753790736f, 0.336428136f},
-std::array<float,2>{0.954566538f, 0.108106889f},
-std::array<float,2>{0.303106576f, 0.612214506f},
-std::array<float,2>{0.793626845f, 0.650509179f},
-std::array<float,2>{0.393106014f, 0.225763485f},
-std::array<float,2>{0.528391361f, 0.467746764f},
-std::array<float,2>{0.13258341f, 0.873727739f},
-std::array<float,2>{0.911171138f, 0.762932837f},
-std::array<float,2>{0.324365795f, 0.434208751f},
-std::array<float,2>{0.728722811f, 0.184219077f},
-std::array<float,2>{0.0147436f, 0.726086318f},
-std::array<float,2>{0.613733888f, 0.553791583f},
-std::array<float,2>{0.199640572f, 0.0226788409f},
-std::array<float,2>{0.86314404f, 0.260020554f},
-std::array<float,2>{0.454080254f, 0.927848101f},
-std::array<float,2>{0.742678463f, 0.782294393f},
-std::array<float,2>{0.0178757496f, 0.396002084f},
-std::array<float,2>{0.932849467f, 0.127691731f},
-std::array<float,2>{0.340535134f, 0.699704289f},
-std::array<float,2>{0.8528229f, 0.502095401f},
-std::array<float,2>{0.447485507f, 0.0604318641f},
-std::array<float,2>{0.603702068f, 0.302305818f},
-std::array<float,2>{0.209317774f, 0.882202268f},
-std::array<float,2>{0.951149404f, 0.967763841f},
-std::array<float,2>{0.291182846f, 0.346624225f},
-std::array<float,2>{0.636792362f, 0.0777558833f},
-std::array<float,2>{0.0881124362f, 0.587973595f},
-std::array<float,2>{0.515243649f, 0.684193015f},
-std::array<float,2>{0.152043432f, 0.210454285f},
-std::array<float,2>{0.806301296f, 0.493860602f},
-std::array<float,2>{0.386048704f, 0.815478027f},
-std::array<float,2>{0.582442522f, 0.914392948f},
-std::array<float,2>{0.245795876f, 0.272615165f},
-std::array<float,2>{0.837060034f, 0.00450840872f},
-std::array<float,2>{0.484824151f, 0.539430022f},
-std::array<float,2>{0.896036267f, 0.73872906f},
-std::array<float,2>{0.350661188f, 0.161988571f},
-std::array<float,2>{0.713921726f, 0.408920258f},
-std::array<float,2>{0.0397056043f, 0.772807658f},
-std::array<float,2>{0.764336228f, 0.858631551f},
-std::array<float,2>{0.43372184f, 0.452666819f},
-std::array<float,2>{0.535771668f, 0.241897121f},
-std::array<float,2>{0.170162305f, 0.637156427f},
-std::array<float,2>{0.667365968f, 0.6059286f},
-std::array<float,2>{0.116135791f, 0.124797948f},
-std::array<float,2>{0.978824615f, 0.313854039f},
-std::array<float,2>{0.259658486f, 0.991055846f},
-std::array<float,2>{0.600656807f, 0.773920178f},
-std::array<float,2>{0.215454459f, 0.41890797f},
-std::array<float,2>{0.844871819f, 0.167601794f},
-std::array<float,2>{0.440434068f, 0.748359561f},
-std::array<float,2>{0.922675312f, 0.532036304f},
-std::array<float,2>{0.335016191f, 0.009450485f},
-std::array<float,2>{0.740632236f, 0.273438841f},
-std::array<float,2>{0.0254602619f, 0.911786318f},
-std::array<float,2>{0.800860345f, 0.998408437f},
-std::array<float,2>{0.381835192f, 0.320763737f},
-std::array<float,2>{0.503099918f, 0.111261733f},
-std::array<float,2>{0.141902432f, 0.600352407f},
-std::array<float,2>{0.632494509f, 0.625843763f},
-std::array<float,2>{0.0836111978f, 0.24990581f},
-std::array<float,2>{0.944815993f, 0.441560417f},
-std::array<float,2>{0.284032226f, 0.847871065f},
-std::array<float,2>{0.709512711f, 0.883941531f},
-std::array<float,2>{0.0314738154f, 0.311286062f},
-std::array<float,2>{0.903146505f, 0.0510011129f},
-std::array<float,2>{0.35696584f, 0.515333831f},
-std::array<float,2>{0.831585884f, 0.693261027f},
-std::array<float,2>{0.499242812f, 0.136289358f},
-std::array<float,2>{0.588462532f, 0.398587376f},
-std::array<float,2>{0.236559629f, 0.79546392f},
-std::array<float,2>{0.973544896f, 0.821846187f},
-std::array<float,2>{0.252652138f, 0.484990478f},
-std::array<float,2>{0.663444757f, 0.213680938f},
-std::array<float,2>{0.120022744f, 0.679134846f},
-std::array<float,2>{0.543412328f, 0.581693709f},
-std::array<float,2>{0.160456806f, 0.0691298321f},
-std::array<float,2>{0.752079189f, 0.35418579f},
-std::array<float,2>{0.427662611f, 0.954214275f},
-std::array<float,2>{0.675167739f, 0.862838626f},
-std::array<float,2>{0.0969908014f, 0.457976937f},
-std::array<float,2>{0.997488797f, 0.228359208f},
-std::array<float,2>{0.280479938f, 0.646639645f},
-std::array<float,2>{0.775846899f, 0.621275127f},
-std::array<float,2>{0.415600926f, 0.0956322849f},
-std::array<float,2>{0.54971087f, 0.334675521f},
-std::array<float,2>{0.175201982f, 0.974713683f},
-std::array<float,2>{0.875073254f, 0.937045991f},
-std::array<float,2>{0.372430742f, 0.256206155f},
-std::array<float,2>{0.697955072f, 0.0241965838f},
-std::array<float,2>{0.0472508147f, 0.560430706f},
-std::array<float,2>{0.563265085f, 0.729831755f},
-std::array<float,2>{0.234290168f, 0.175348148f},
-std::array<float,2>{0.821441352f, 0.42525664f},
-std::array<float,2>{0.470671058f, 0.751383424f},
-std::array<float,2>{0.515807509f, 0.947276413f},
-std::array<float,2>{0.135434747f, 0.360605061f},
-std::array<float,2>{0.785176158f, 0.0906245634f},
-std::array<float,2>{0.402907312f, 0.570412934f},
-std::array<float,2>{0.967597365f, 0.665753543f},
-std::array<float,2>{0.310607374f, 0.191587403f},
-std::array<float,2>{0.653063238f, 0.474826068f},
-std::array<float,2>{0.0672501996f, 0.836137593f},
-std::array<float,2>{0.870502532f, 0.805065155f},
-std::array<float,2>{0.466615409f, 0.388984144f},
-std::array<float,2>{0.622513831f, 0.148305193f},
-std::array<float,2>{0.19307445f, 0.705183566f},
-std::array<float,2>{0.718773186f, 0.517613947f},
-std::array<float,2>{0.00763045251f, 0.0373456627f},
-std::array<float,2>{0.916171372f, 0.291441679f},
-std::array<float,2>{0.318508118f, 0.892758012f},
-std::array<float,2>{0.505899608f, 0.804037213f},
-std::array<float,2>{0.148239598f, 0.380776048f},
-std::array<float,2>{0.798689961f, 0.148498863f},
-std::array<float,2>{0.378819346f, 0.711506724f},
-std::array<float,2>{0.939241707f, 0.524331272f},
-std::array<float,2>{0.286772519f, 0.0431568101f},
-std::array<float,2>{0.625379503f, 0.28630951f},
-std::array<float,2>{0.0813445747f, 0.900133014f},
-std::array<float,2>{0.849907994f, 0.944954515f},
-std::array<float,2>{0.4423379f, 0.368203431f},
-std::array<float,2>{0.594460547f, 0.0791342333f},
-std::array<float,2>{0.211661831f, 0.569967866f},
-std::array<float,2>{0.735265672f, 0.656628847f},
-std::array<float,2>{0.0288752094f, 0.200407967f},
-std::array<float,2>{0.926415682f, 0.478321791f},
-std::array<float,2>{0.328550935f, 0.828538299f},
-std::array<float,2>{0.65985477f, 0.923270643f},
-std::array<float,2>{0.123832755f, 0.262956202f},
-std::array<float,2>{0.968918025f, 0.017039543f},
-std::array<float,2>{0.257320672f, 0.547344804f},
-std::array<float,2>{0.75423497f, 0.719173074f},
-std::array<float,2>{0.424285263f, 0.180368274f},
-std::array<float,2>{0.540802479f, 0.430952668f},
-std::array<float,2>{0.159503371f, 0.758292258f},
-std::array<float,2>{0.90178895f, 0.869724929f},
-std::array<float,2>{0.352596015f, 0.461417198f},
-std::array<float,2>{0.704997301f, 0.219782844f},
-std::array<float,2>{0.0366988592f, 0.653019071f},
-std::array<float,2>{0.591152012f, 0.615812659f},
-std::array<float,2>{0.240889892f, 0.104195252f},
-std::array<float,2>{0.835623741f, 0.341889471f},
-std::array<float,2>{0.496030062f, 0.983904958f},
-std::array<float,2>{0.700555265f, 0.816916943f},
-std::array<float,2>{0.0511638559f, 0.498316348f},
-std::array<float,2>{0.878931046f, 0.206480101f},
-std::array<float,2>{0.369843692f, 0.679914474f},
-std::array<float,2>{0.827714264f, 0.591182411f},
-std::array<float,2>{0.475833565f, 0.0704689175f},
-std::array<float,2>{0.570009708f, 0.349654377f},
-std::array<float,2>{0.229596451f, 0.963940501f},
-std::array<float,2>{0.993816316f, 0.875923038f},
-std::array<float,2>{0.276827008f, 0.297130972f},
-std::array<float,2>{0.678660095f, 0.0555693507f},
-std::array<float,2>{0.10066428f, 0.506158769f},
-std::array<float,2>{0.551320732f, 0.695976317f},
-std::array<float,2>{0.178084433f, 0.129670307f},
-std::array<float,2>{0.780931592f, 0.392047733f},
-std::array<float,2>{0.419910461f, 0.786807954f},
-std::array<float,2>{0.618276894f, 0.985446453f},
-std::array<float,2>{0.188161597f, 0.319289804f},
-std::array<float,2>{0.87354517f, 0.120958552f},
-std::array<float,2>{0.463713229f, 0.601757884f},
-std::array<float,2>{0.918902993f, 0.636338711f},
-std::array<float,2>{0.31588459f, 0.237619162f},
-std::array<float,2>{0.725980997f, 0.447143078f},
-std::array<float,2>{0.00266170921f, 0.853607416f},
-std::array<float,2>{0.783480585f, 0.76711452f},
-std::array<float,2>{0.400086075f, 0.412037253f},
-std::array<float,2>{0.522511363f, 0.1571455f},
-std::array<float,2>{0.139422998f, 0.735107183f},
-std::array<float,2>{0.652069986f, 0.54503727f},
-std::array<float,2>{0.0634648055f, 0.000375253556f},
-std::array<float,2>{0.962930918f, 0.266663998f},
-std::array<float,2>{0.308191299f, 0.918802917f},
-std::array<float,2>{0.573082685f, 0.847369492f},
-std::array<float,2>{0.224957198f, 0.438605785f},
-std::array<float,2>{0.816140532f, 0.244936541f},
-std::array<float,2>{0.480246007f, 0.629217088f},
-std::array<float,2>{0.883594036f, 0.596366823f},
-std::array<float,2>{0.361551613f, 0.113778301f},
-std::array<float,2>{0.693065763f, 0.324992508f},
-std::array<float,2>{0.0574987456f, 0.995895207f},
-std::array<float,2>{0.770371616f, 0.909339786f},
-std::array<float,2>{0.407933533f, 0.280251265f},
-std::array<float,2>{0.5622015f, 0.0137727726f},
-std::array<float,2>{0.180126593f, 0.53662461f},
-std::array<float,2>{0.68253541f, 0.742967606f},
-std::array<float,2>{0.103974193f, 0.169658676f},
-std::array<float,2>{0.991677761f, 0.417667538f},
-std::array<float,2>{0.271975547f, 0.780467272f},
-std::array<float,2>{0.732449234f, 0.960794032f},
-std::array<float,2>{0.0113539482f, 0.356604248f},
-std::array<float,2>{0.906419992f, 0.0645991042f},
-std::array<float,2>{0.32385388f, 0.584134161f},
-std::array<float,2>{0.863684237f, 0.675776184f},
-std::array<float,2>{0.460446924f, 0.218373105f},
-std::array<float,2>{0.612068236f, 0.490379065f},
-std::array<float,2>{0.198660433f, 0.825819314f},
-std::array<float,2>{0.957551777f, 0.789973438f},
-std::array<float,2>{0.298177779f, 0.405154526f},
-std::array<float,2>{0.6459167f, 0.137729377f},
-std::array<float,2>{0.0731039122f, 0.689598441f},
-std::array<float,2>{0.523474753f, 0.509450674f},
-std::array<float,2>{0.126057252f, 0.0505856089f},
-std::array<float,2>{0.79277432f, 0.306143641f},
-std::array<float,2>{0.396216273f, 0.888209462f},
-std::array<float,2>{0.633565545f, 0.755778193f},
-std::array<float,2>{0.0919065773f, 0.428019702f},
-std::array<float,2>{0.945394039f, 0.176798776f},
-std::array<float,2>{0.294824064f, 0.732260823f},
-std::array<float,2>{0.812169373f, 0.556571901f},
-std::array<float,2>{0.38756758f, 0.0297674648f},
-std::array<float,2>{0.50862658f, 0.252141148f},
-std::array<float,2>{0.154045954f, 0.930024564f},
-std::array<float,2>{0.935383141f, 0.971927881f},
-std::array<float,2>{0.337897629f, 0.329815924f},
-std::array<float,2>{0.748707652f, 0.0989591405f},
-std::array<float,2>{0.019885242f, 0.618793249f},
-std::array<float,2>{0.608632386f, 0.643345535f},
-std::array<float,2>{0.205766499f, 0.231992379f},
-std::array<float,2>{0.856748343f, 0.453130513f},
-std::array<float,2>{0.45307529f, 0.865122139f},
-std::array<float,2>{0.531451702f, 0.895584822f},
-std::array<float,2>{0.164094388f, 0.293094367f},
-std::array<float,2>{0.761263609f, 0.0345084257f},
-std::array<float,2>{0.430329472f, 0.520367146f},
-std::array<float,2>{0.983807921f, 0.707946301f},
-std::array<float,2>{0.262066364f, 0.142807573f},
-std::array<float,2>{0.66904664f, 0.382909328f},
-std::array<float,2>{0.109451108f, 0.81024766f},
-std::array<float,2>{0.842659473f, 0.843208551f},
-std::array<float,2>{0.490156531f, 0.471837044f},
-std::array<float,2>{0.580605388f, 0.189023986f},
-std::array<float,2>{0.249900684f, 0.668738484f},
-std::array<float,2>{0.716230452f, 0.57710582f},
-std::array<float,2>{0.0465990342f, 0.0896648988f},
-std::array<float,2>{0.891487956f, 0.365932226f},
-std::array<float,2>{0.345228702f, 0.952322841f},
-std::array<float,2>{0.530277431f, 0.871951222f},
-std::array<float,2>{0.130337104f, 0.465636075f},
-std::array<float,2>{0.795427263f, 0.223848984f},
-std::array<float,2>{0.39208135f, 0.649855733f},
-std::array<float,2>{0.956593156f, 0.610204279f},
-std::array<float,2>{0.301187843f, 0.107167892f},
-std::array<float,2>{0.640956938f, 0.338670999f},
-std::array<float,2>{0.0778214186f, 0.978205144f},
-std::array<float,2>{0.860241771f, 0.926374912f},
-std::array<float,2>{0.455298692f, 0.258053243f},
-std::array<float,2>{0.616425216f, 0.0198574867f},
-std::array<float,2>{0.202665895f, 0.55233264f},
-std::array<float,2>{0.727313578f, 0.723025739f},
-std::array<float,2>{0.0134538524f, 0.186984748f},
-std::array<float,2>{0.913454711f, 0.436080128f},
-std::array<float,2>{0.327329695f, 0.764737308f},
-std::array<float,2>{0.686657071f, 0.938878894f},
-std::array<float,2>{0.107029416f, 0.374815583f},
-std::array<float,2>{0.985574722f, 0.0830122456f},
-std::array<float,2>{0.267555863f, 0.566163003f},
-std::array<float,2>{0.768700004f, 0.662588775f},
-std::array<float,2>{0.411329806f, 0.19827503f},
-std::array<float,2>{0.557598174f, 0.481177926f},
-std::array<float,2>{0.185241491f, 0.833788097f},
-std::array<float,2>{0.887440562f, 0.800563097f},
-std::array<float,2>{0.36457932f, 0.376735985f},
-std::array<float,2>{0.68956852f, 0.153283387f},
-std::array<float,2>{0.0603325553f, 0.717293859f},
-std::array<float,2>{0.576674342f, 0.52934283f},
-std::array<float,2>{0.221860021f, 0.042360872f},
-std::array<float,2>{0.81694752f, 0.283433259f},
-std::array<float,2>{0.482897669f, 0.906195581f},
-std::array<float,2>{0.712207079f, 0.769819319f},
-std::array<float,2>{0.0421990752f, 0.406704694f},
-std::array<float,2>{0.897265673f, 0.163699016f},
-std::array<float,2>{0.349151254f, 0.740590632f},
-std::array<float,2>{0.839461744f, 0.541402757f},
-std::array<float,2>{0.487900525f, 0.00742819719f},
-std::array<float,2>{0.585478783f, 0.270721138f},
-std::array<float,2>{0.243290946f, 0.917506218f},
-std::array<float,2>{0.977962375f, 0.989208162f},
-std::array<float,2>{0.260849744f, 0.314761221f},
-std::array<float,2>{0.665019095f, 0.122092389f},
-std::array<float,2>{0.115177862f, 0.607816935f},
-std::array<float,2>{0.537850738f, 0.639764607f},
-std::array<float,2>{0.168819919f, 0.238408193f},
-std::array<float,2>{0.763307154f, 0.449945241f},
-std::array<float,2>{0.435687602f, 0.855603278f},
-std::array<float,2>{0.601800084f, 0.88076663f},
-std::array<float,2>{0.207593411f, 0.303839296f},
-std::array<float,2>{0.854640722f, 0.061582353f},
-std::array<float,2>{0.445622385f, 0.501941681f},
-std::array<float,2>{0.929881632f, 0.702580452f},
-std::array<float,2>{0.343414158f, 0.126660079f},
-std::array<float,2>{0.745305419f, 0.398312986f},
-std::array<float,2>{0.0169548653f, 0.784578025f},
-std::array<float,2>{0.808193684f, 0.812545657f},
-std::array<float,2>{0.383178234f, 0.494346023f},
-std::array<float,2>{0.513326883f, 0.208285645f},
-std::array<float,2>{0.14854452f, 0.685641289f},
-std::array<float,2>{0.639911771f, 0.586244106f},
-std::array<float,2>{0.086869888f, 0.0758702382f},
-std::array<float,2>{0.952294588f, 0.343906462f},
-std::array<float,2>{0.290558308f, 0.966401517f},
-std::array<float,2>{0.58639425f, 0.79388988f},
-std::array<float,2>{0.234957233f, 0.40122211f},
-std::array<float,2>{0.82871753f, 0.134088695f},
-std::array<float,2>{0.496231765f, 0.694851458f},
-std::array<float,2>{0.905247986f, 0.513588428f},
-std::array<float,2>{0.357476801f, 0.0535866879f},
-std::array<float,2>{0.707377732f, 0.310067534f},
-std::array<float,2>{0.0339975804f, 0.885348499f},
-std::array<float,2>{0.751452863f, 0.956089556f},
-std::array<float,2>{0.428134412f, 0.352948278f},
-std::array<float,2>{0.546477377f, 0.0680030063f},
-std::array<float,2>{0.163049191f, 0.579387188f},
-std::array<float,2>{0.660872877f, 0.675798655f},
-std::array<float,2>{0.117240846f, 0.211067364f},
-std::array<float,2>{0.975306749f, 0.486886114f},
-std::array<float,2>{0.250564843f, 0.822619379f},
-std::array<float,2>{0.739137769f, 0.912610888f},
-std::array<float,2>{0.0238095205f, 0.276426673f},
-std::array<float,2>{0.92567116f, 0.00989200082f},
-std::array<float,2>{0.333944052f, 0.534327924f},
-std::array<float,2>{0.847115815f, 0.746514261f},
-std::array<float,2>{0.43864888f, 0.165714413f},
-std::array<float,2>{0.597795725f, 0.42029345f},
-std::array<float,2>{0.218210459f, 0.775482357f},
-std::array<float,2>{0.941811681f, 0.850899696f},
-std::array<float,2>{0.281420827f, 0.443849415f},
-std::array<float,2>{0.629381776f, 0.247863576f},
-std::array<float,2>{0.0845003352f, 0.628635406f},
-std::array<float,2>{0.501713872f, 0.598822474f},
-std::array<float,2>{0.143823579f, 0.111817062f},
-std::array<float,2>{0.803374827f, 0.322700411f},
-std::array<float,2>{0.380681157f, 0.997392893f},
-std::array<float,2>{0.654649258f, 0.838594556f},
-std::array<float,2>{0.0696063712f, 0.47450006f},
-std::array<float,2>{0.966212451f, 0.193581104f},
-std::array<float,2>{0.308983088f, 0.666462004f},
-std::array<float,2>{0.788823366f, 0.573881626f},
-std::array<float,2>{0.405776024f, 0.0922950879f},
-std::array<float,2>{0.517983139f, 0.361362964f},
-std::array<float,2>{0.133220434f, 0.946078777f},
-std::array<float,2>{0.915486693f, 0.890955448f},
-std::array<float,2>{0.317927927f, 0.290098339f},
-std::array<float,2>{0.721415639f, 0.0358036384f},
-std::array<float,2>{0.00514983991f, 0.517092228f},
-std::array<float,2>{0.62356478f, 0.703621864f},
-std::array<float,2>{0.193582669f, 0.145916015f},
-std::array<float,2>{0.867284834f, 0.387038618f},
-std::array<float,2>{0.468695879f, 0.806888878f},
-std::array<float,2>{0.548046649f, 0.973246574f},
-std::array<float,2>{0.172163099f, 0.332645893f},
-std::array<float,2>{0.773529112f, 0.0959038958f},
-std::array<float,2>{0.417682081f, 0.624596238f},
-std::array<float,2>{0.999701619f, 0.644818127f},
-std::array<float,2>{0.27825281f, 0.228528976f},
-std::array<float,2>{0.673827946f, 0.459596068f},
-std::array<float,2>{0.0955085382f, 0.860116661f},
-std::array<float,2>{0.822367251f, 0.753220618f},
-std::array<float,2>{0.471214622f, 0.423316985f},
-std::array<float,2>{0.565048039f, 0.17244488f},
-std::array<float,2>{0.230708942f, 0.726575196f},
-std::array<float,2>{0.696257651f, 0.561692238f},
-std::array<float,2>{0.0495554507f, 0.02571816f},
-std::array<float,2>{0.878815949f, 0.254603177f},
-std::array<float,2>{0.373113692f, 0.935165405f},
-std::array<float,2>{0.542221069f, 0.76000315f},
-std::array<float,2>{0.157146528f, 0.432046294f},
-std::array<float,2>{0.757658839f, 0.182228863f},
-std::array<float,2>{0.423355818f, 0.721323729f},
-std::array<float,2>{0.972018421f, 0.54989624f},
-std::array<float,2>{0.25394845f, 0.0177996308f},
-std::array<float,2>{0.657147586f, 0.263870329f},
-std::array<float,2>{0.122596733f, 0.92411375f},
-std::array<float,2>{0.832508624f, 0.980667531f},
-std::array<float,2>{0.493772954f, 0.340696365f},
-std::array<float,2>{0.593225658f, 0.102008283f},
-std::array<float,2>{0.238622338f, 0.614292622f},
-std::array<float,2>{0.705479443f, 0.655302584f},
-std::array<float,2>{0.0377001427f, 0.221801564f},
-std::array<float,2>{0.899812341f, 0.464416921f},
-std::array<float,2>{0.35491094f, 0.868198812f},
-std::array<float,2>{0.627241194f, 0.900651515f},
-std::array<float,2>{0.079010196f, 0.287160635f},
-std::array<float,2>{0.940058053f, 0.0456188545f},
-std::array<float,2>{0.287686318f, 0.527173162f},
-std::array<float,2>{0.799850821f, 0.714335084f},
-std::array<float,2>{0.376267791f, 0.151504502f},
-std::array<float,2>{0.505374908f, 0.382744789f},
-std::array<float,2>{0.145169765f, 0.801252425f},
-std::array<float,2>{0.929001987f, 0.83147347f},
-std::array<float,2>{0.331449747f, 0.479381442f},
-std::array<float,2>{0.736679614f, 0.201322526f},
-std::array<float,2>{0.0309902821f, 0.659056425f},
-std::array<float,2>{0.597145438f, 0.566911101f},
-std::array<float,2>{0.214282468f, 0.0818992779f},
-std::array<float,2>{0.849153876f, 0.369931966f},
-std::array<float,2>{0.4448798f, 0.942134798f},
-std::array<float,2>{0.724607229f, 0.852317452f},
-std::array<float,2>{0.000168245155f, 0.448110163f},
-std::array<float,2>{0.920117557f, 0.234658286f},
-std::array<float,2>{0.312650263f, 0.632862449f},
-std::array<float,2>{0.871925056f, 0.603707194f},
-std::array<float,2>{0.462119997f, 0.117714338f},
-std::array<float,2>{0.619437575f, 0.318220407f},
-std::array<float,2>{0.190958276f, 0.986861587f},
-std::array<float,2>{0.960971057f, 0.920402288f},
-std::array<float,2>{0.306426942f, 0.267824411f},
-std::array<float,2>{0.64929378f, 0.00257530832f},
-std::array<float,2>{0.0657480359f, 0.544263363f},
-std::array<float,2>{0.521389723f, 0.737200499f},
-std::array<float,2>{0.137782454f, 0.158770114f},
-std::array<float,2>{0.783106327f, 0.413305312f},
-std::array<float,2>{0.400558382f, 0.768496394f},
-std::array<float,2>{0.566613555f, 0.961904049f},
-std::array<float,2>{0.226849958f, 0.348224878f},
-std::array<float,2>{0.824954033f, 0.0736501813f},
-std::array<float,2>{0.473831862f, 0.591808438f},
-std::array<float,2>{0.882009685f, 0.682277024f},
-std::array<float,2>{0.36780864f, 0.203223571f},
-std::array<float,2>{0.701828063f, 0.497964859f},
-std::array<float,2>{0.0531817488f, 0.819974899f},
-std::array<float,2>{0.777757704f, 0.787787557f},
-std::array<float,2>{0.421625465f, 0.393900365f},
-std::array<float,2>{0.554347217f, 0.131256148f},
-std::array<float,2>{0.175831139f, 0.699097812f},
-std::array<float,2>{0.676618218f, 0.504389226f},
-std::array<float,2>{0.0984069258f, 0.05760739f},
-std::array<float,2>{0.995950699f, 0.2990008f},
-std::array<float,2>{0.274926543f, 0.877578616f},
-std::array<float,2>{0.610437095f, 0.826789677f},
-std::array<float,2>{0.195832759f, 0.488677204f},
-std::array<float,2>{0.865957916f, 0.215682507f},
-std::array<float,2>{0.45795089f, 0.673269689f},
-std::array<float,2>{0.909227014f, 0.582367182f},
-std::array<float,2>{0.321995944f, 0.0637925193f},
-std::array<float,2>{0.7312783f, 0.359104931f},
-std::array<float,2>{0.00834169425f, 0.958301425f},
-std::array<float,2>{0.790128767f, 0.889011681f},
-std::array<float,2>{0.398321539f, 0.308166921f},
-std::array<float,2>{0.526945412f, 0.0475886874f},
-std::array<float,2>{0.126973987f, 0.511572361f},
-std::array<float,2>{0.647862613f, 0.687688947f},
-std::array<float,2>{0.0715762898f, 0.138701111f},
-std::array<float,2>{0.95939368f, 0.404211134f},
-std::array<float,2>{0.299427688f, 0.792622089f},
-std::array<float,2>{0.694084525f, 0.992637753f},
-std::array<float,2>{0.0562890284f, 0.327872336f},
-std::array<float,2>{0.886696458f, 0.115457311f},
-std::array<float,2>{0.360120386f, 0.594942033f},
-std::array<float,2>{0.813290954f, 0.632621288f},
-std::array<float,2>{0.47810477f, 0.24293375f},
-std::array<float,2>{0.571242332f, 0.440536171f},
-std::array<float,2>{0.224520147f, 0.845466316f},
-std::array<float,2>{0.98948741f, 0.779036999f},
-std::array<float,2>{0.270358354f, 0.414401948f},
-std::array<float,2>{0.67975843f, 0.170680553f},
-std::array<float,2>{0.102436401f, 0.745691538f},
-std::array<float,2>{0.560399354f, 0.53813225f},
-std::array<float,2>{0.183568135f, 0.0124475695f},
-std::array<float,2>{0.772123873f, 0.277754843f},
-std::array<float,2>{0.40837431f, 0.906422377f},
-std::array<float,2>{0.67120409f, 0.812077463f},
-std::array<float,2>{0.112116769f, 0.385164022f},
-std::array<float,2>{0.981595159f, 0.14112629f},
-std::array<float,2>{0.264946371f, 0.710706055f},
-std::array<float,2>{0.759166777f, 0.522974133f},
-std::array<float,2>{0.43252033f, 0.0313372314f},
-std::array<float,2>{0.533477962f, 0.295618266f},
-std::array<float,2>{0.167219087f, 0.896592617f},
-std::array<float,2>{0.892737091f, 0.951040089f},
-std::array<float,2>{0.346347839f, 0.364766508f},
-std::array<float,2>{0.718282938f, 0.0877630636f},
-std::array<float,2>{0.0438270271f, 0.575057566f},
-std::array<float,2>{0.578888416f, 0.671339273f},
-std::array<float,2>{0.247992948f, 0.18999356f},
-std::array<float,2>{0.841406763f, 0.470318168f},
-std::array<float,2>{0.491669357f, 0.841240585f},
-std::array<float,2>{0.510325551f, 0.933084428f},
-std::array<float,2>{0.154359385f, 0.250674725f},
-std::array<float,2>{0.810160816f, 0.0289702415f},
-std::array<float,2>{0.388762802f, 0.557671368f},
-std::array<float,2>{0.948014021f, 0.732668459f},
-std::array<float,2>{0.296745062f, 0.177910224f},
-std::array<float,2>{0.634936512f, 0.426667511f},
-std::array<float,2>{0.0901965126f, 0.756331921f},
-std::array<float,2>{0.857968211f, 0.866174161f},
-std::array<float,2>{0.449806213f, 0.456581742f},
-std::array<float,2>{0.606011689f, 0.234085828f},
-std::array<float,2>{0.204559878f, 0.641287565f},
-std::array<float,2>{0.746115446f, 0.621086001f},
-std::array<float,2>{0.0217327923f, 0.100900978f},
-std::array<float,2>{0.935601115f, 0.331699193f},
-std::array<float,2>{0.336572289f, 0.969663382f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.11726892f, 0.245245546f},
-std::array<float,2>{0.910005569f, 0.652164876f},
-std::array<float,2>{0.579558969f, 0.468022704f},
-std::array<float,2>{0.254071623f, 0.805276692f},
-std::array<float,2>{0.461082697f, 0.36544466f},
-std::array<float,2>{0.654917479f, 0.876244128f},
-std::array<float,2>{0.839539587f, 0.0311638732f},
-std::array<float,2>{0.19168292f, 0.535535157f},
-std::array<float,2>{0.32119298f, 0.0769388825f},
-std::array<float,2>{0.544229925f, 0.598024309f},
-std::array<float,2>{0.964221895f, 0.280329049f},
-std::array<float,2>{0.0171333514f, 0.998944342f},
-std::array<float,2>{0.177606717f, 0.389229327f},
-std::array<float,2>{0.783758998f, 0.86004144f},
-std::array<float,2>{0.744715691f, 0.161677822f},
-std::array<float,2>{0.431971252f, 0.739225268f},
-std::array<float,2>{0.230110273f, 0.0428172387f},
-std::array<float,2>{0.865978956f, 0.500065684f},
-std::array<float,2>{0.664316773f, 0.332456261f},
-std::array<float,2>{0.492089391f, 0.937093496f},
-std::array<float,2>{0.294383079f, 0.477641732f},
-std::array<float,2>{0.616622865f, 0.774762988f},
-std::array<float,2>{0.892371714f, 0.208056837f},
-std::array<float,2>{0.0659953952f, 0.663773f},
-std::array<float,2>{0.393785447f, 0.125039965f},
-std::array<float,2>{0.692679942f, 0.694320321f},
-std::array<float,2>{0.76996392f, 0.428489923f},
-std::array<float,2>{0.147345826f, 0.841774881f},
-std::array<float,2>{0.0405909196f, 0.283081412f},
-std::array<float,2>{0.978245795f, 0.965394497f},
-std::array<float,2>{0.509675443f, 0.0953635946f},
-std::array<float,2>{0.37357384f, 0.591443598f},
-std::array<float,2>{0.126198187f, 0.183955371f},
-std::array<float,2>{0.75352478f, 0.727334082f},
-std::array<float,2>{0.703478932f, 0.40571171f},
-std::array<float,2>{0.3804802f, 0.852469563f},
-std::array<float,2>{0.358447582f, 0.254269361f},
-std::array<float,2>{0.52029568f, 0.977618635f},
-std::array<float,2>{0.988778055f, 0.0852243528f},
-std::array<float,2>{0.0619481951f, 0.623121858f},
-std::array<float,2>{0.484305531f, 0.00420611445f},
-std::array<float,2>{0.676073909f, 0.559760571f},
-std::array<float,2>{0.84808594f, 0.349537104f},
-std::array<float,2>{0.243033707f, 0.890874147f},
-std::array<float,2>{0.0828427002f, 0.452865601f},
-std::array<float,2>{0.877630115f, 0.793100536f},
-std::array<float,2>{0.598881006f, 0.222159445f},
-std::array<float,2>{0.307909966f, 0.628892124f},
-std::array<float,2>{0.00761206588f, 0.119302183f},
-std::array<float,2>{0.943720102f, 0.570673764f},
-std::array<float,2>{0.550555885f, 0.307294279f},
-std::array<float,2>{0.342369556f, 0.940100551f},
-std::array<float,2>{0.420118988f, 0.41306451f},
-std::array<float,2>{0.726248384f, 0.827153325f},
-std::array<float,2>{0.805088341f, 0.15510501f},
-std::array<float,2>{0.156961694f, 0.708536804f},
-std::array<float,2>{0.272431254f, 0.194239333f},
-std::array<float,2>{0.575419784f, 0.674101353f},
-std::array<float,2>{0.925488651f, 0.490974545f},
-std::array<float,2>{0.0994818732f, 0.763937175f},
-std::array<float,2>{0.210515589f, 0.325302213f},
-std::array<float,2>{0.82399708f, 0.912320316f},
-std::array<float,2>{0.635094166f, 0.0507651828f},
-std::array<float,2>{0.446921319f, 0.526079059f},
-std::array<float,2>{0.0511359125f, 0.145454794f},
-std::array<float,2>{0.997837126f, 0.71190083f},
-std::array<float,2>{0.523782253f, 0.418999225f},
-std::array<float,2>{0.347233742f, 0.814424098f},
-std::array<float,2>{0.385385841f, 0.300791055f},
-std::array<float,2>{0.717702508f, 0.947055459f},
-std::array<float,2>{0.761529684f, 0.113677427f},
-std::array<float,2>{0.135573611f, 0.567055464f},
-std::array<float,2>{0.297808349f, 0.0619600751f},
-std::array<float,2>{0.608668387f, 0.516544938f},
-std::array<float,2>{0.886402667f, 0.313765287f},
-std::array<float,2>{0.0863592625f, 0.918655753f},
-std::array<float,2>{0.236244604f, 0.493094534f},
-std::array<float,2>{0.855661571f, 0.753279269f},
-std::array<float,2>{0.685165167f, 0.196259663f},
-std::array<float,2>{0.469738513f, 0.680025458f},
-std::array<float,2>{0.167429909f, 0.089038454f},
-std::array<float,2>{0.799199522f, 0.615354121f},
-std::array<float,2>{0.732855201f, 0.263845891f},
-std::array<float,2>{0.40951249f, 0.974290729f},
-std::array<float,2>{0.332281649f, 0.394839525f},
-std::array<float,2>{0.561223686f, 0.847249448f},
-std::array<float,2>{0.951307833f, 0.17684561f},
-std::array<float,2>{0.0102793761f, 0.720851839f},
-std::array<float,2>{0.439181209f, 0.23262009f},
-std::array<float,2>{0.632151246f, 0.636841655f},
-std::array<float,2>{0.818527579f, 0.440694839f},
-std::array<float,2>{0.215666786f, 0.786629558f},
-std::array<float,2>{0.103776179f, 0.354644179f},
-std::array<float,2>{0.931784987f, 0.899004757f},
-std::array<float,2>{0.566897154f, 0.0103156166f},
-std::array<float,2>{0.277584165f, 0.550246835f},
-std::array<float,2>{0.197908327f, 0.211382836f},
-std::array<float,2>{0.832111299f, 0.667371809f},
-std::array<float,2>{0.647265851f, 0.470108807f},
-std::array<float,2>{0.456747741f, 0.773209989f},
-std::array<float,2>{0.265246063f, 0.339091212f},
-std::array<float,2>{0.589526057f, 0.926457822f},
-std::array<float,2>{0.917270422f, 0.0317778289f},
-std::array<float,2>{0.112751678f, 0.512560844f},
-std::array<float,2>{0.424937278f, 0.103631936f},
-std::array<float,2>{0.739487469f, 0.583452642f},
-std::array<float,2>{0.792361498f, 0.295787781f},
-std::array<float,2>{0.185171083f, 0.954437673f},
-std::array<float,2>{0.0261513814f, 0.434276313f},
-std::array<float,2>{0.959889233f, 0.832655489f},
-std::array<float,2>{0.538953245f, 0.135409757f},
-std::array<float,2>{0.315984935f, 0.698294699f},
-std::array<float,2>{0.0720058158f, 0.0207250509f},
-std::array<float,2>{0.903751552f, 0.540898263f},
-std::array<float,2>{0.624006093f, 0.372625113f},
-std::array<float,2>{0.284235954f, 0.883705378f},
-std::array<float,2>{0.495264113f, 0.457648486f},
-std::array<float,2>{0.659601271f, 0.800183535f},
-std::array<float,2>{0.874993205f, 0.240246028f},
-std::array<float,2>{0.225513563f, 0.641828656f},
-std::array<float,2>{0.366103947f, 0.164304003f},
-std::array<float,2>{0.501300573f, 0.747630298f},
-std::array<float,2>{0.971515179f, 0.378756464f},
-std::array<float,2>{0.0344000049f, 0.874404669f},
-std::array<float,2>{0.155952796f, 0.266768694f},
-std::array<float,2>{0.780819714f, 0.98824662f},
-std::array<float,2>{0.695617497f, 0.0642296076f},
-std::array<float,2>{0.40317753f, 0.606228828f},
-std::array<float,2>{0.0206670891f, 0.199336186f},
-std::array<float,2>{0.964927197f, 0.684094906f},
-std::array<float,2>{0.540228724f, 0.497828245f},
-std::array<float,2>{0.327340007f, 0.757113457f},
-std::array<float,2>{0.437196285f, 0.317869276f},
-std::array<float,2>{0.746792078f, 0.914628804f},
-std::array<float,2>{0.78524214f, 0.057141047f},
-std::array<float,2>{0.175326526f, 0.522117078f},
-std::array<float,2>{0.25082624f, 0.109685794f},
-std::array<float,2>{0.585438192f, 0.562763631f},
-std::array<float,2>{0.91152817f, 0.298206866f},
-std::array<float,2>{0.123812094f, 0.949539721f},
-std::array<float,2>{0.190708101f, 0.416178942f},
-std::array<float,2>{0.842224538f, 0.819820225f},
-std::array<float,2>{0.648663819f, 0.142816454f},
-std::array<float,2>{0.466943592f, 0.716408253f},
-std::array<float,2>{0.143412367f, 0.0126673132f},
-std::array<float,2>{0.768060505f, 0.553360164f},
-std::array<float,2>{0.690296173f, 0.357931167f},
-std::array<float,2>{0.397021323f, 0.90563345f},
-std::array<float,2>{0.367258012f, 0.443436176f},
-std::array<float,2>{0.51358664f, 0.782729864f},
-std::array<float,2>{0.982106268f, 0.228059024f},
-std::array<float,2>{0.0437919907f, 0.635455132f},
-std::array<float,2>{0.485116005f, 0.174311146f},
-std::array<float,2>{0.668707132f, 0.72384572f},
-std::array<float,2>{0.861197054f, 0.390628904f},
-std::array<float,2>{0.232007921f, 0.851078868f},
-std::array<float,2>{0.0692030489f, 0.260211855f},
-std::array<float,2>{0.897871792f, 0.971759915f},
-std::array<float,2>{0.609917104f, 0.0910765082f},
-std::array<float,2>{0.289586067f, 0.609410107f},
-std::array<float,2>{0.248369753f, 0.137236252f},
-std::array<float,2>{0.845027566f, 0.702869773f},
-std::array<float,2>{0.674298108f, 0.431326091f},
-std::array<float,2>{0.477612972f, 0.831217408f},
-std::array<float,2>{0.311203361f, 0.289800137f},
-std::array<float,2>{0.594488442f, 0.958761632f},
-std::array<float,2>{0.880966723f, 0.105599262f},
-std::array<float,2>{0.0797242895f, 0.579880953f},
-std::array<float,2>{0.377606809f, 0.0365847014f},
-std::array<float,2>{0.708695352f, 0.509854257f},
-std::array<float,2>{0.754587173f, 0.341852576f},
-std::array<float,2>{0.131960839f, 0.923647642f},
-std::array<float,2>{0.0583612211f, 0.476378798f},
-std::array<float,2>{0.984545648f, 0.767715573f},
-std::array<float,2>{0.517002165f, 0.217031628f},
-std::array<float,2>{0.352437556f, 0.669663131f},
-std::array<float,2>{0.0967134461f, 0.069179967f},
-std::array<float,2>{0.929551601f, 0.604021549f},
-std::array<float,2>{0.572222292f, 0.270143658f},
-std::array<float,2>{0.269072592f, 0.988822758f},
-std::array<float,2>{0.451096445f, 0.379170597f},
-std::array<float,2>{0.637788773f, 0.870104969f},
-std::array<float,2>{0.825302362f, 0.170673102f},
-std::array<float,2>{0.204654187f, 0.74387008f},
-std::array<float,2>{0.33921805f, 0.237184718f},
-std::array<float,2>{0.550999939f, 0.648012936f},
-std::array<float,2>{0.939400852f, 0.454126149f},
-std::array<float,2>{0.00105870527f, 0.804033697f},
-std::array<float,2>{0.160372227f, 0.370293885f},
-std::array<float,2>{0.809699118f, 0.889356613f},
-std::array<float,2>{0.720558286f, 0.0168963913f},
-std::array<float,2>{0.417660177f, 0.546587586f},
-std::array<float,2>{0.090755187f, 0.156606138f},
-std::array<float,2>{0.888744831f, 0.73766911f},
-std::array<float,2>{0.601937413f, 0.383859992f},
-std::array<float,2>{0.303884923f, 0.863498092f},
-std::array<float,2>{0.475763947f, 0.276530385f},
-std::array<float,2>{0.681040764f, 0.992476344f},
-std::array<float,2>{0.85258317f, 0.07247895f},
-std::array<float,2>{0.238356873f, 0.594289303f},
-std::array<float,2>{0.349364877f, 0.0247982871f},
-std::array<float,2>{0.529443026f, 0.532319963f},
-std::array<float,2>{0.995405555f, 0.359626323f},
-std::array<float,2>{0.0492832847f, 0.880809069f},
-std::array<float,2>{0.139577806f, 0.464822203f},
-std::array<float,2>{0.764859617f, 0.809163213f},
-std::array<float,2>{0.711809218f, 0.247439533f},
-std::array<float,2>{0.390350103f, 0.653837919f},
-std::array<float,2>{0.213826776f, 0.0989116952f},
-std::array<float,2>{0.814628005f, 0.589322805f},
-std::array<float,2>{0.628214538f, 0.287185699f},
-std::array<float,2>{0.442328066f, 0.963903666f},
-std::array<float,2>{0.276920944f, 0.423153639f},
-std::array<float,2>{0.562693357f, 0.836898983f},
-std::array<float,2>{0.936372638f, 0.129102618f},
-std::array<float,2>{0.108232141f, 0.688184023f},
-std::array<float,2>{0.413581163f, 0.204744875f},
-std::array<float,2>{0.727638245f, 0.656668961f},
-std::array<float,2>{0.801576793f, 0.481832743f},
-std::array<float,2>{0.17093201f, 0.777445078f},
-std::array<float,2>{0.0128234904f, 0.330814809f},
-std::array<float,2>{0.947587132f, 0.930234611f},
-std::array<float,2>{0.557841897f, 0.0441278741f},
-std::array<float,2>{0.330197632f, 0.504921913f},
-std::array<float,2>{0.180875078f, 0.225482941f},
-std::array<float,2>{0.795954049f, 0.632173955f},
-std::array<float,2>{0.735975504f, 0.446860075f},
-std::array<float,2>{0.427206904f, 0.792084098f},
-std::array<float,2>{0.317555964f, 0.345017344f},
-std::array<float,2>{0.534301877f, 0.895719171f},
-std::array<float,2>{0.953132093f, 0.00346555118f},
-std::array<float,2>{0.0287096165f, 0.557046771f},
-std::array<float,2>{0.460223734f, 0.0797480866f},
-std::array<float,2>{0.641887009f, 0.618127406f},
-std::array<float,2>{0.829469562f, 0.253880054f},
-std::array<float,2>{0.19955942f, 0.981690884f},
-std::array<float,2>{0.115242608f, 0.402092397f},
-std::array<float,2>{0.920361161f, 0.857228577f},
-std::array<float,2>{0.591407895f, 0.181759432f},
-std::array<float,2>{0.260737032f, 0.731274307f},
-std::array<float,2>{0.0361123458f, 0.0539041758f},
-std::array<float,2>{0.975079477f, 0.530708015f},
-std::array<float,2>{0.506262958f, 0.323043615f},
-std::array<float,2>{0.361370474f, 0.909166217f},
-std::array<float,2>{0.400787592f, 0.484928757f},
-std::array<float,2>{0.701439798f, 0.758465111f},
-std::array<float,2>{0.776075721f, 0.189543471f},
-std::array<float,2>{0.150486141f, 0.676256955f},
-std::array<float,2>{0.288010567f, 0.151778504f},
-std::array<float,2>{0.62026602f, 0.703439295f},
-std::array<float,2>{0.899439275f, 0.406637043f},
-std::array<float,2>{0.0765865892f, 0.821755171f},
-std::array<float,2>{0.222193122f, 0.311893612f},
-std::array<float,2>{0.867910385f, 0.942038953f},
-std::array<float,2>{0.663670361f, 0.123897947f},
-std::array<float,2>{0.496798277f, 0.576150656f},
-std::array<float,2>{0.0628057793f, 0.210264683f},
-std::array<float,2>{0.893078625f, 0.660819232f},
-std::array<float,2>{0.615149736f, 0.480055839f},
-std::array<float,2>{0.29553777f, 0.775901377f},
-std::array<float,2>{0.489127696f, 0.335447341f},
-std::array<float,2>{0.666436493f, 0.935163617f},
-std::array<float,2>{0.864809632f, 0.0395531245f},
-std::array<float,2>{0.227150694f, 0.503561914f},
-std::array<float,2>{0.372947395f, 0.0967664048f},
-std::array<float,2>{0.509921908f, 0.593131423f},
-std::array<float,2>{0.979532599f, 0.28362906f},
-std::array<float,2>{0.0427685007f, 0.967581213f},
-std::array<float,2>{0.145000935f, 0.426093817f},
-std::array<float,2>{0.771587491f, 0.841797411f},
-std::array<float,2>{0.694965839f, 0.127592549f},
-std::array<float,2>{0.391181201f, 0.692009747f},
-std::array<float,2>{0.194689736f, 0.0287606288f},
-std::array<float,2>{0.837078035f, 0.538384497f},
-std::array<float,2>{0.653641403f, 0.363708079f},
-std::array<float,2>{0.463336527f, 0.877572596f},
-std::array<float,2>{0.256730974f, 0.465092659f},
-std::array<float,2>{0.581810534f, 0.806680322f},
-std::array<float,2>{0.906998396f, 0.242247343f},
-std::array<float,2>{0.12077646f, 0.649211466f},
-std::array<float,2>{0.429998726f, 0.163518772f},
-std::array<float,2>{0.743164837f, 0.740610242f},
-std::array<float,2>{0.782406926f, 0.387043715f},
-std::array<float,2>{0.178948417f, 0.862616062f},
-std::array<float,2>{0.0179337114f, 0.279245466f},
-std::array<float,2>{0.96181953f, 0.997416615f},
-std::array<float,2>{0.546479046f, 0.0752589181f},
-std::array<float,2>{0.323313534f, 0.601299524f},
-std::array<float,2>{0.158350453f, 0.153358147f},
-std::array<float,2>{0.80759275f, 0.709601164f},
-std::array<float,2>{0.72323966f, 0.410482347f},
-std::array<float,2>{0.419024795f, 0.824271321f},
-std::array<float,2>{0.340016156f, 0.306450427f},
-std::array<float,2>{0.548749566f, 0.93918407f},
-std::array<float,2>{0.942924201f, 0.119123951f},
-std::array<float,2>{0.00505580567f, 0.573791862f},
-std::array<float,2>{0.448681235f, 0.0483890809f},
-std::array<float,2>{0.632859588f, 0.523994744f},
-std::array<float,2>{0.821286201f, 0.326302379f},
-std::array<float,2>{0.207519382f, 0.910279691f},
-std::array<float,2>{0.0996965989f, 0.490038961f},
-std::array<float,2>{0.922690153f, 0.76334691f},
-std::array<float,2>{0.577558637f, 0.192426145f},
-std::array<float,2>{0.270630002f, 0.673608959f},
-std::array<float,2>{0.0599614121f, 0.0830191672f},
-std::array<float,2>{0.990937233f, 0.621403217f},
-std::array<float,2>{0.521523535f, 0.256536752f},
-std::array<float,2>{0.355538577f, 0.980019271f},
-std::array<float,2>{0.381723553f, 0.403257787f},
-std::array<float,2>{0.705830812f, 0.854514241f},
-std::array<float,2>{0.751683056f, 0.186138749f},
-std::array<float,2>{0.127296627f, 0.728809237f},
-std::array<float,2>{0.305851638f, 0.220528677f},
-std::array<float,2>{0.600426018f, 0.625688076f},
-std::array<float,2>{0.875844657f, 0.450228423f},
-std::array<float,2>{0.0847426206f, 0.79561758f},
-std::array<float,2>{0.244919971f, 0.350629449f},
-std::array<float,2>{0.851277232f, 0.89285475f},
-std::array<float,2>{0.679515958f, 0.00616723299f},
-std::array<float,2>{0.480867207f, 0.560884833f},
-std::array<float,2>{0.00790992565f, 0.177906841f},
-std::array<float,2>{0.950798929f, 0.719818354f},
-std::array<float,2>{0.560543239f, 0.397863448f},
-std::array<float,2>{0.334625274f, 0.845032811f},
-std::array<float,2>{0.407123774f, 0.262333035f},
-std::array<float,2>{0.731749237f, 0.975756168f},
-std::array<float,2>{0.797372937f, 0.0861357376f},
-std::array<float,2>{0.16481258f, 0.614972174f},
-std::array<float,2>{0.280220807f, 0.00941530522f},
-std::array<float,2>{0.570099771f, 0.547169209f},
-std::array<float,2>{0.93110466f, 0.353442669f},
-std::array<float,2>{0.102602117f, 0.901416242f},
-std::array<float,2>{0.217181265f, 0.437625766f},
-std::array<float,2>{0.818200111f, 0.788185179f},
-std::array<float,2>{0.629754722f, 0.230805859f},
-std::array<float,2>{0.439869285f, 0.640245557f},
-std::array<float,2>{0.133282691f, 0.116784468f},
-std::array<float,2>{0.75928098f, 0.568729639f},
-std::array<float,2>{0.716586411f, 0.304389119f},
-std::array<float,2>{0.384441137f, 0.949046314f},
-std::array<float,2>{0.344560653f, 0.420374185f},
-std::array<float,2>{0.526385188f, 0.816249132f},
-std::array<float,2>{0.999958932f, 0.148341745f},
-std::array<float,2>{0.0534613058f, 0.714378297f},
-std::array<float,2>{0.470718414f, 0.199023902f},
-std::array<float,2>{0.68584621f, 0.683520973f},
-std::array<float,2>{0.85744822f, 0.495185018f},
-std::array<float,2>{0.23713313f, 0.750136971f},
-std::array<float,2>{0.0889865831f, 0.315582603f},
-std::array<float,2>{0.883725464f, 0.92080617f},
-std::array<float,2>{0.605524898f, 0.0603657067f},
-std::array<float,2>{0.29883942f, 0.517933428f},
-std::array<float,2>{0.223130807f, 0.239134505f},
-std::array<float,2>{0.872952402f, 0.643614411f},
-std::array<float,2>{0.656734228f, 0.459180951f},
-std::array<float,2>{0.49219802f, 0.798077524f},
-std::array<float,2>{0.282002926f, 0.373970538f},
-std::array<float,2>{0.622275591f, 0.885176003f},
-std::array<float,2>{0.906114399f, 0.0221872926f},
-std::array<float,2>{0.0724435672f, 0.541862726f},
-std::array<float,2>{0.40549311f, 0.0656277984f},
-std::array<float,2>{0.697496295f, 0.609220386f},
-std::array<float,2>{0.778015494f, 0.267958283f},
-std::array<float,2>{0.15324609f, 0.985517621f},
-std::array<float,2>{0.0325440168f, 0.375736862f},
-std::array<float,2>{0.969102859f, 0.871267736f},
-std::array<float,2>{0.502639651f, 0.167045459f},
-std::array<float,2>{0.364097536f, 0.748179197f},
-std::array<float,2>{0.109986924f, 0.0335816629f},
-std::array<float,2>{0.914089203f, 0.514733255f},
-std::array<float,2>{0.586256623f, 0.336811393f},
-std::array<float,2>{0.262351602f, 0.927987039f},
-std::array<float,2>{0.453635126f, 0.471689969f},
-std::array<float,2>{0.645427704f, 0.769794166f},
-std::array<float,2>{0.835760593f, 0.214300692f},
-std::array<float,2>{0.195380881f, 0.664432049f},
-std::array<float,2>{0.312699854f, 0.133504629f},
-std::array<float,2>{0.53610301f, 0.69577378f},
-std::array<float,2>{0.957402766f, 0.436405718f},
-std::array<float,2>{0.0247268118f, 0.834604919f},
-std::array<float,2>{0.187180564f, 0.294395208f},
-std::array<float,2>{0.789705217f, 0.956885278f},
-std::array<float,2>{0.740882754f, 0.103175886f},
-std::array<float,2>{0.423798561f, 0.584677815f},
-std::array<float,2>{0.0463274568f, 0.229470953f},
-std::array<float,2>{0.98252064f, 0.633695424f},
-std::array<float,2>{0.51548779f, 0.442501813f},
-std::array<float,2>{0.370305628f, 0.783576429f},
-std::array<float,2>{0.396118134f, 0.356928885f},
-std::array<float,2>{0.689328611f, 0.903873205f},
-std::array<float,2>{0.76655072f, 0.0146524357f},
-std::array<float,2>{0.141151592f, 0.551974952f},
-std::array<float,2>{0.291181207f, 0.0933142304f},
-std::array<float,2>{0.611459136f, 0.611688733f},
-std::array<float,2>{0.894934595f, 0.259163648f},
-std::array<float,2>{0.0677078962f, 0.968894541f},
-std::array<float,2>{0.233059376f, 0.393921882f},
-std::array<float,2>{0.861394823f, 0.848671734f},
-std::array<float,2>{0.671809077f, 0.173197836f},
-std::array<float,2>{0.487820327f, 0.726224482f},
-std::array<float,2>{0.172746554f, 0.0564208515f},
-std::array<float,2>{0.788655877f, 0.520310163f},
-std::array<float,2>{0.749653697f, 0.318826497f},
-std::array<float,2>{0.434533238f, 0.916352332f},
-std::array<float,2>{0.325489014f, 0.499935806f},
-std::array<float,2>{0.541615605f, 0.754533708f},
-std::array<float,2>{0.968232095f, 0.201707318f},
-std::array<float,2>{0.0223555639f, 0.68572855f},
-std::array<float,2>{0.465941221f, 0.142130762f},
-std::array<float,2>{0.65140003f, 0.717708886f},
-std::array<float,2>{0.841441333f, 0.414069593f},
-std::array<float,2>{0.189132646f, 0.816727519f},
-std::array<float,2>{0.122453593f, 0.299376965f},
-std::array<float,2>{0.91240555f, 0.952853024f},
-std::array<float,2>{0.583101392f, 0.112465315f},
-std::array<float,2>{0.253343344f, 0.564502835f},
-std::array<float,2>{0.205144435f, 0.16826795f},
-std::array<float,2>{0.8274858f, 0.745222628f},
-std::array<float,2>{0.639357626f, 0.382631719f},
-std::array<float,2>{0.452999175f, 0.868135631f},
-std::array<float,2>{0.266254097f, 0.272288591f},
-std::array<float,2>{0.573434353f, 0.990632772f},
-std::array<float,2>{0.925898194f, 0.0666631982f},
-std::array<float,2>{0.0945950598f, 0.602486312f},
-std::array<float,2>{0.415447623f, 0.0189452209f},
-std::array<float,2>{0.722463369f, 0.543645918f},
-std::array<float,2>{0.810982108f, 0.368719399f},
-std::array<float,2>{0.163756296f, 0.888419807f},
-std::array<float,2>{0.00336052058f, 0.455101788f},
-std::array<float,2>{0.939593196f, 0.801752925f},
-std::array<float,2>{0.552777588f, 0.234566227f},
-std::array<float,2>{0.335999221f, 0.646332026f},
-std::array<float,2>{0.0808205679f, 0.107687585f},
-std::array<float,2>{0.880488157f, 0.581004441f},
-std::array<float,2>{0.597587883f, 0.291787624f},
-std::array<float,2>{0.309447378f, 0.960134506f},
-std::array<float,2>{0.478562802f, 0.432465762f},
-std::array<float,2>{0.671993971f, 0.829699874f},
-std::array<float,2>{0.846056879f, 0.140339851f},
-std::array<float,2>{0.246388495f, 0.699634254f},
-std::array<float,2>{0.354746401f, 0.215596944f},
-std::array<float,2>{0.518669128f, 0.67173326f},
-std::array<float,2>{0.987802446f, 0.47407943f},
-std::array<float,2>{0.055239141f, 0.766189814f},
-std::array<float,2>{0.130335227f, 0.340939313f},
-std::array<float,2>{0.756159067f, 0.924862802f},
-std::array<float,2>{0.709515452f, 0.0373309702f},
-std::array<float,2>{0.376870275f, 0.509262025f},
-std::array<float,2>{0.106685564f, 0.130890265f},
-std::array<float,2>{0.933816612f, 0.689792395f},
-std::array<float,2>{0.566299736f, 0.424443483f},
-std::array<float,2>{0.275273412f, 0.839227915f},
-std::array<float,2>{0.444214523f, 0.286407024f},
-std::array<float,2>{0.62607044f, 0.962117374f},
-std::array<float,2>{0.81337142f, 0.10056261f},
-std::array<float,2>{0.212656587f, 0.587401032f},
-std::array<float,2>{0.328998923f, 0.0468662307f},
-std::array<float,2>{0.555592895f, 0.507583559f},
-std::array<float,2>{0.945866346f, 0.328341097f},
-std::array<float,2>{0.0147235617f, 0.931816459f},
-std::array<float,2>{0.168332189f, 0.484117836f},
-std::array<float,2>{0.804346025f, 0.780165017f},
-std::array<float,2>{0.728820324f, 0.205681279f},
-std::array<float,2>{0.410351276f, 0.660031676f},
-std::array<float,2>{0.240300581f, 0.0705560371f},
-std::array<float,2>{0.853721976f, 0.59731555f},
-std::array<float,2>{0.682678103f, 0.273776501f},
-std::array<float,2>{0.474128276f, 0.995923936f},
-std::array<float,2>{0.301546127f, 0.385324955f},
-std::array<float,2>{0.604349315f, 0.865839779f},
-std::array<float,2>{0.887681842f, 0.158765078f},
-std::array<float,2>{0.0926333815f, 0.73437506f},
-std::array<float,2>{0.38702476f, 0.249380216f},
-std::array<float,2>{0.714290679f, 0.654718935f},
-std::array<float,2>{0.762741745f, 0.461388826f},
-std::array<float,2>{0.138375327f, 0.812235177f},
-std::array<float,2>{0.0479951054f, 0.362650573f},
-std::array<float,2>{0.992653251f, 0.881043613f},
-std::array<float,2>{0.528970301f, 0.0267761536f},
-std::array<float,2>{0.351100117f, 0.534738362f},
-std::array<float,2>{0.14956589f, 0.188683614f},
-std::array<float,2>{0.774605095f, 0.678339005f},
-std::array<float,2>{0.700205505f, 0.487938076f},
-std::array<float,2>{0.398758829f, 0.760374963f},
-std::array<float,2>{0.360999584f, 0.321521729f},
-std::array<float,2>{0.504162788f, 0.907088101f},
-std::array<float,2>{0.972863793f, 0.0527160279f},
-std::array<float,2>{0.0388917476f, 0.52861774f},
-std::array<float,2>{0.499106497f, 0.121556565f},
-std::array<float,2>{0.661229134f, 0.577919066f},
-std::array<float,2>{0.869595587f, 0.309455097f},
-std::array<float,2>{0.220610663f, 0.944991589f},
-std::array<float,2>{0.0752786025f, 0.408778578f},
-std::array<float,2>{0.901967525f, 0.824008584f},
-std::array<float,2>{0.617812514f, 0.149809495f},
-std::array<float,2>{0.285996616f, 0.706689596f},
-std::array<float,2>{0.0302155428f, 0.00168707035f},
-std::array<float,2>{0.955206573f, 0.556584001f},
-std::array<float,2>{0.532548606f, 0.345806509f},
-std::array<float,2>{0.318675637f, 0.897164524f},
-std::array<float,2>{0.429458559f, 0.448040992f},
-std::array<float,2>{0.737651885f, 0.790069222f},
-std::array<float,2>{0.793287694f, 0.224579036f},
-std::array<float,2>{0.183267787f, 0.630045295f},
-std::array<float,2>{0.259684771f, 0.180156231f},
-std::array<float,2>{0.593492925f, 0.73387897f},
-std::array<float,2>{0.919866979f, 0.399436802f},
-std::array<float,2>{0.113979563f, 0.859007239f},
-std::array<float,2>{0.201473668f, 0.251156896f},
-std::array<float,2>{0.830178261f, 0.982775271f},
-std::array<float,2>{0.643539131f, 0.081837967f},
-std::array<float,2>{0.457623661f, 0.619687021f},
-std::array<float,2>{0.0849784762f, 0.220857278f},
-std::array<float,2>{0.876814604f, 0.627009928f},
-std::array<float,2>{0.601474583f, 0.45168063f},
-std::array<float,2>{0.304851294f, 0.794514537f},
-std::array<float,2>{0.481528193f, 0.348558217f},
-std::array<float,2>{0.677947223f, 0.892238855f},
-std::array<float,2>{0.850207448f, 0.00526500121f},
-std::array<float,2>{0.245887741f, 0.558788419f},
-std::array<float,2>{0.357100725f, 0.0842794552f},
-std::array<float,2>{0.522690117f, 0.624742448f},
-std::array<float,2>{0.991559088f, 0.255015731f},
-std::array<float,2>{0.0595145486f, 0.977411151f},
-std::array<float,2>{0.128525004f, 0.404931068f},
-std::array<float,2>{0.75045675f, 0.852617145f},
-std::array<float,2>{0.706907153f, 0.185223565f},
-std::array<float,2>{0.382353842f, 0.728093684f},
-std::array<float,2>{0.208380729f, 0.0495823696f},
-std::array<float,2>{0.821511865f, 0.526998341f},
-std::array<float,2>{0.63462162f, 0.324729562f},
-std::array<float,2>{0.447421551f, 0.913187325f},
-std::array<float,2>{0.270111293f, 0.492150724f},
-std::array<float,2>{0.576926053f, 0.765484214f},
-std::array<float,2>{0.923051894f, 0.195267498f},
-std::array<float,2>{0.10111846f, 0.675472319f},
-std::array<float,2>{0.417972654f, 0.155621648f},
-std::array<float,2>{0.723968387f, 0.707869828f},
-std::array<float,2>{0.807622671f, 0.413342685f},
-std::array<float,2>{0.159478351f, 0.827035487f},
-std::array<float,2>{0.00478381524f, 0.307983488f},
-std::array<float,2>{0.942003548f, 0.940935969f},
-std::array<float,2>{0.547768354f, 0.120201178f},
-std::array<float,2>{0.341164172f, 0.572029054f},
-std::array<float,2>{0.177782685f, 0.160450846f},
-std::array<float,2>{0.781928182f, 0.739721119f},
-std::array<float,2>{0.742890298f, 0.39040333f},
-std::array<float,2>{0.430708438f, 0.860691845f},
-std::array<float,2>{0.322425514f, 0.27980125f},
-std::array<float,2>{0.545365512f, 0.999779224f},
-std::array<float,2>{0.962397516f, 0.0772365555f},
-std::array<float,2>{0.0195256397f, 0.59954077f},
-std::array<float,2>{0.464010388f, 0.0293688644f},
-std::array<float,2>{0.652867675f, 0.536207318f},
-std::array<float,2>{0.836036086f, 0.366452634f},
-std::array<float,2>{0.194261372f, 0.875325561f},
-std::array<float,2>{0.119564585f, 0.467483819f},
-std::array<float,2>{0.908189356f, 0.805678368f},
-std::array<float,2>{0.580829978f, 0.244756952f},
-std::array<float,2>{0.256897002f, 0.650849342f},
-std::array<float,2>{0.0414262749f, 0.0938421339f},
-std::array<float,2>{0.978850782f, 0.590700328f},
-std::array<float,2>{0.511271656f, 0.28152591f},
-std::array<float,2>{0.371459484f, 0.965900958f},
-std::array<float,2>{0.392109126f, 0.429214418f},
-std::array<float,2>{0.693863988f, 0.840296924f},
-std::array<float,2>{0.772797048f, 0.126089573f},
-std::array<float,2>{0.14641121f, 0.695236444f},
-std::array<float,2>{0.296855509f, 0.207413509f},
-std::array<float,2>{0.614007235f, 0.66257453f},
-std::array<float,2>{0.894244134f, 0.477324456f},
-std::array<float,2>{0.0642728657f, 0.774071336f},
-std::array<float,2>{0.228037491f, 0.333658963f},
-std::array<float,2>{0.863867044f, 0.93612653f},
-std::array<float,2>{0.667102516f, 0.0419027731f},
-std::array<float,2>{0.49012363f, 0.501502395f},
-std::array<float,2>{0.0240839161f, 0.136232495f},
-std::array<float,2>{0.958606958f, 0.698226392f},
-std::array<float,2>{0.536384344f, 0.435086817f},
-std::array<float,2>{0.314432174f, 0.833645582f},
-std::array<float,2>{0.422249734f, 0.295960337f},
-std::array<float,2>{0.741747916f, 0.953891814f},
-std::array<float,2>{0.790732265f, 0.104661696f},
-std::array<float,2>{0.185899973f, 0.582522452f},
-std::array<float,2>{0.262787074f, 0.0328431576f},
-std::array<float,2>{0.587413967f, 0.513544559f},
-std::array<float,2>{0.91580677f, 0.338222027f},
-std::array<float,2>{0.110484354f, 0.927463472f},
-std::array<float,2>{0.196396902f, 0.469367594f},
-std::array<float,2>{0.834867656f, 0.772214532f},
-std::array<float,2>{0.645978868f, 0.212674737f},
-std::array<float,2>{0.454499215f, 0.666717708f},
-std::array<float,2>{0.153336376f, 0.0629670024f},
-std::array<float,2>{0.778422892f, 0.60693723f},
-std::array<float,2>{0.698685884f, 0.266539395f},
-std::array<float,2>{0.404818296f, 0.987216234f},
-std::array<float,2>{0.365075111f, 0.377310246f},
-std::array<float,2>{0.503556848f, 0.87366426f},
-std::array<float,2>{0.970505357f, 0.165672004f},
-std::array<float,2>{0.0317230783f, 0.747052908f},
-std::array<float,2>{0.493766814f, 0.241348714f},
-std::array<float,2>{0.658127546f, 0.640688777f},
-std::array<float,2>{0.871742249f, 0.458637863f},
-std::array<float,2>{0.224200785f, 0.799452603f},
-std::array<float,2>{0.0741040036f, 0.371615589f},
-std::array<float,2>{0.904922247f, 0.883912683f},
-std::array<float,2>{0.621453464f, 0.0199970324f},
-std::array<float,2>{0.283085734f, 0.540016174f},
-std::array<float,2>{0.237519145f, 0.197086245f},
-std::array<float,2>{0.858626187f, 0.681507349f},
-std::array<float,2>{0.687001467f, 0.493829876f},
-std::array<float,2>{0.472343475f, 0.752351701f},
-std::array<float,2>{0.300430357f, 0.313018918f},
-std::array<float,2>{0.607153296f, 0.919665337f},
-std::array<float,2>{0.88454324f, 0.0611962043f},
-std::array<float,2>{0.0885061249f, 0.517353594f},
-std::array<float,2>{0.383089125f, 0.115085423f},
-std::array<float,2>{0.715431631f, 0.567644954f},
-std::array<float,2>{0.758626282f, 0.301880717f},
-std::array<float,2>{0.13455157f, 0.94547087f},
-std::array<float,2>{0.0546519719f, 0.417998463f},
-std::array<float,2>{0.998762131f, 0.813106656f},
-std::array<float,2>{0.525959432f, 0.145863861f},
-std::array<float,2>{0.345360845f, 0.712656438f},
-std::array<float,2>{0.102315865f, 0.0110485265f},
-std::array<float,2>{0.930305541f, 0.549260557f},
-std::array<float,2>{0.569132447f, 0.354482621f},
-std::array<float,2>{0.280868143f, 0.899436295f},
-std::array<float,2>{0.441313475f, 0.440409034f},
-std::array<float,2>{0.630648196f, 0.785420775f},
-std::array<float,2>{0.81669575f, 0.234080493f},
-std::array<float,2>{0.218118489f, 0.638325453f},
-std::array<float,2>{0.335844278f, 0.175920725f},
-std::array<float,2>{0.558777571f, 0.722249269f},
-std::array<float,2>{0.949242175f, 0.396319658f},
-std::array<float,2>{0.00962878671f, 0.846224666f},
-std::array<float,2>{0.165684506f, 0.26513359f},
-std::array<float,2>{0.798393011f, 0.973296821f},
-std::array<float,2>{0.731106699f, 0.0882949308f},
-std::array<float,2>{0.407936573f, 0.616773248f},
-std::array<float,2>{0.0563343018f, 0.218337789f},
-std::array<float,2>{0.987063885f, 0.668437421f},
-std::array<float,2>{0.518306434f, 0.474748939f},
-std::array<float,2>{0.354348302f, 0.769113898f},
-std::array<float,2>{0.375057936f, 0.343660742f},
-std::array<float,2>{0.710619748f, 0.922669709f},
-std::array<float,2>{0.757281542f, 0.0360137336f},
-std::array<float,2>{0.129838347f, 0.5115363f},
-std::array<float,2>{0.310122907f, 0.106676079f},
-std::array<float,2>{0.596306503f, 0.578180909f},
-std::array<float,2>{0.87893182f, 0.290341556f},
-std::array<float,2>{0.0814991891f, 0.95760864f},
-std::array<float,2>{0.24743475f, 0.430515617f},
-std::array<float,2>{0.846699297f, 0.830756724f},
-std::array<float,2>{0.673004508f, 0.137717918f},
-std::array<float,2>{0.480068058f, 0.701171994f},
-std::array<float,2>{0.162243709f, 0.0165059194f},
-std::array<float,2>{0.812158167f, 0.545833826f},
-std::array<float,2>{0.721434474f, 0.369371653f},
-std::array<float,2>{0.41491729f, 0.890345037f},
-std::array<float,2>{0.337529182f, 0.45320788f},
-std::array<float,2>{0.55392617f, 0.803623617f},
-std::array<float,2>{0.940717578f, 0.237931803f},
-std::array<float,2>{0.00289117591f, 0.646615028f},
-std::array<float,2>{0.45177269f, 0.171534151f},
-std::array<float,2>{0.640270054f, 0.742368877f},
-std::array<float,2>{0.826306403f, 0.380287915f},
-std::array<float,2>{0.206942052f, 0.870256186f},
-std::array<float,2>{0.0947389603f, 0.270955294f},
-std::array<float,2>{0.926863194f, 0.990193427f},
-std::array<float,2>{0.573042989f, 0.070107609f},
-std::array<float,2>{0.267331213f, 0.604522169f},
-std::array<float,2>{0.188398138f, 0.144226342f},
-std::array<float,2>{0.839972258f, 0.71509254f},
-std::array<float,2>{0.650504649f, 0.417906374f},
-std::array<float,2>{0.465075433f, 0.819145083f},
-std::array<float,2>{0.252880543f, 0.297426313f},
-std::array<float,2>{0.582671463f, 0.950750411f},
-std::array<float,2>{0.914052963f, 0.111130238f},
-std::array<float,2>{0.122067071f, 0.564129055f},
-std::array<float,2>{0.435234725f, 0.0582261905f},
-std::array<float,2>{0.748543024f, 0.523393571f},
-std::array<float,2>{0.787223279f, 0.316479713f},
-std::array<float,2>{0.173065543f, 0.915337861f},
-std::array<float,2>{0.0231082439f, 0.496124834f},
-std::array<float,2>{0.967632234f, 0.755865991f},
-std::array<float,2>{0.542678773f, 0.201026306f},
-std::array<float,2>{0.324494839f, 0.684901297f},
-std::array<float,2>{0.0670491084f, 0.0898437873f},
-std::array<float,2>{0.89568615f, 0.611202121f},
-std::array<float,2>{0.612790227f, 0.261263013f},
-std::array<float,2>{0.292684793f, 0.971641719f},
-std::array<float,2>{0.487178624f, 0.391633004f},
-std::array<float,2>{0.670559466f, 0.850346386f},
-std::array<float,2>{0.862778127f, 0.175773904f},
-std::array<float,2>{0.233613625f, 0.722964406f},
-std::array<float,2>{0.370107323f, 0.227472976f},
-std::array<float,2>{0.513690591f, 0.636640787f},
-std::array<float,2>{0.984062016f, 0.444577515f},
-std::array<float,2>{0.0450714752f, 0.781852067f},
-std::array<float,2>{0.142366931f, 0.359250844f},
-std::array<float,2>{0.767004251f, 0.904685557f},
-std::array<float,2>{0.687880993f, 0.012757902f},
-std::array<float,2>{0.395027846f, 0.553894877f},
-std::array<float,2>{0.114873879f, 0.183020845f},
-std::array<float,2>{0.918341935f, 0.731720507f},
-std::array<float,2>{0.592536926f, 0.400555789f},
-std::array<float,2>{0.258136809f, 0.856325269f},
-std::array<float,2>{0.458773732f, 0.252046734f},
-std::array<float,2>{0.644086838f, 0.981398225f},
-std::array<float,2>{0.831101775f, 0.0784066767f},
-std::array<float,2>{0.202779815f, 0.618503094f},
-std::array<float,2>{0.319995642f, 0.00261688279f},
-std::array<float,2>{0.5321576f, 0.558583379f},
-std::array<float,2>{0.956480145f, 0.344465137f},
-std::array<float,2>{0.0305505022f, 0.894865274f},
-std::array<float,2>{0.181707263f, 0.446040422f},
-std::array<float,2>{0.793945491f, 0.791975915f},
-std::array<float,2>{0.736828685f, 0.226149544f},
-std::array<float,2>{0.428476691f, 0.631757438f},
-std::array<float,2>{0.218764991f, 0.124028191f},
-std::array<float,2>{0.870982528f, 0.574650645f},
-std::array<float,2>{0.660926819f, 0.310943514f},
-std::array<float,2>{0.498264015f, 0.942800462f},
-std::array<float,2>{0.286422372f, 0.407557398f},
-std::array<float,2>{0.618843317f, 0.821138203f},
-std::array<float,2>{0.900559306f, 0.150532708f},
-std::array<float,2>{0.0747556388f, 0.704451144f},
-std::array<float,2>{0.399562865f, 0.190576538f},
-std::array<float,2>{0.699763179f, 0.677229404f},
-std::array<float,2>{0.773835003f, 0.48545289f},
-std::array<float,2>{0.148571521f, 0.759316862f},
-std::array<float,2>{0.0378652364f, 0.324122369f},
-std::array<float,2>{0.973839283f, 0.909383297f},
-std::array<float,2>{0.505813003f, 0.0536429062f},
-std::array<float,2>{0.359434068f, 0.529799163f},
-std::array<float,2>{0.137143433f, 0.246632725f},
-std::array<float,2>{0.762395024f, 0.652567387f},
-std::array<float,2>{0.713139355f, 0.462960601f},
-std::array<float,2>{0.388250768f, 0.809735954f},
-std::array<float,2>{0.349673182f, 0.360777169f},
-std::array<float,2>{0.527556181f, 0.879142106f},
-std::array<float,2>{0.994024396f, 0.0242668428f},
-std::array<float,2>{0.0477074757f, 0.532065272f},
-std::array<float,2>{0.472994506f, 0.0733310729f},
-std::array<float,2>{0.681950808f, 0.59531194f},
-std::array<float,2>{0.855289698f, 0.276142061f},
-std::array<float,2>{0.241939723f, 0.993348598f},
-std::array<float,2>{0.0935796723f, 0.382818729f},
-std::array<float,2>{0.887830138f, 0.864284158f},
-std::array<float,2>{0.604894102f, 0.157239184f},
-std::array<float,2>{0.301842183f, 0.736975491f},
-std::array<float,2>{0.0138624106f, 0.04352488f},
-std::array<float,2>{0.946964085f, 0.504768133f},
-std::array<float,2>{0.556421041f, 0.331765741f},
-std::array<float,2>{0.330056846f, 0.931349337f},
-std::array<float,2>{0.411291778f, 0.480747193f},
-std::array<float,2>{0.729734957f, 0.778866947f},
-std::array<float,2>{0.803209126f, 0.203809917f},
-std::array<float,2>{0.169103265f, 0.658150434f},
-std::array<float,2>{0.274362087f, 0.130397841f},
-std::array<float,2>{0.564634323f, 0.688688397f},
-std::array<float,2>{0.93546325f, 0.42228505f},
-std::array<float,2>{0.10619913f, 0.83785814f},
-std::array<float,2>{0.211512342f, 0.289021611f},
-std::array<float,2>{0.813948572f, 0.963136792f},
-std::array<float,2>{0.625920892f, 0.098205626f},
-std::array<float,2>{0.444756955f, 0.588526368f},
-std::array<float,2>{0.0977100804f, 0.192204982f},
-std::array<float,2>{0.924296558f, 0.672567129f},
-std::array<float,2>{0.575119615f, 0.489075541f},
-std::array<float,2>{0.272913158f, 0.76255393f},
-std::array<float,2>{0.446171045f, 0.3279607f},
-std::array<float,2>{0.636050284f, 0.911748528f},
-std::array<float,2>{0.823118925f, 0.0470187888f},
-std::array<float,2>{0.209318817f, 0.52467984f},
-std::array<float,2>{0.342802972f, 0.117715307f},
-std::array<float,2>{0.549011409f, 0.573105276f},
-std::array<float,2>{0.944760859f, 0.304953635f},
-std::array<float,2>{0.00615715841f, 0.938189983f},
-std::array<float,2>{0.157356307f, 0.411269128f},
-std::array<float,2>{0.806267083f, 0.826019108f},
-std::array<float,2>{0.725179374f, 0.152377546f},
-std::array<float,2>{0.421266943f, 0.710902452f},
-std::array<float,2>{0.243697435f, 0.00773429545f},
-std::array<float,2>{0.849129081f, 0.562102616f},
-std::array<float,2>{0.676911831f, 0.350428671f},
-std::array<float,2>{0.483252436f, 0.893830359f},
-std::array<float,2>{0.307326406f, 0.449851692f},
-std::array<float,2>{0.59814775f, 0.796395183f},
-std::array<float,2>{0.878438354f, 0.218859807f},
-std::array<float,2>{0.0832202509f, 0.626354814f},
-std::array<float,2>{0.379556f, 0.186547026f},
-std::array<float,2>{0.704614639f, 0.729719937f},
-std::array<float,2>{0.752154291f, 0.404211372f},
-std::array<float,2>{0.125711575f, 0.85404408f},
-std::array<float,2>{0.0614758804f, 0.257432967f},
-std::array<float,2>{0.990115762f, 0.979044199f},
-std::array<float,2>{0.521378338f, 0.0823221505f},
-std::array<float,2>{0.357427061f, 0.622531712f},
-std::array<float,2>{0.147679687f, 0.128895774f},
-std::array<float,2>{0.771186948f, 0.693334281f},
-std::array<float,2>{0.691962838f, 0.427529782f},
-std::array<float,2>{0.39258638f, 0.842943311f},
-std::array<float,2>{0.374540895f, 0.284621626f},
-std::array<float,2>{0.508704722f, 0.968667567f},
-std::array<float,2>{0.977045119f, 0.0961120203f},
-std::array<float,2>{0.0396967977f, 0.591929674f},
-std::array<float,2>{0.490824282f, 0.0405389965f},
-std::array<float,2>{0.665789664f, 0.502147377f},
-std::array<float,2>{0.8664397f, 0.334669948f},
-std::array<float,2>{0.229165435f, 0.933894932f},
-std::array<float,2>{0.0652412921f, 0.478688389f},
-std::array<float,2>{0.891022682f, 0.77723664f},
-std::array<float,2>{0.61525166f, 0.209157467f},
-std::array<float,2>{0.293850064f, 0.661719739f},
-std::array<float,2>{0.0159700867f, 0.0745277777f},
-std::array<float,2>{0.963506222f, 0.600338936f},
-std::array<float,2>{0.543229222f, 0.278301924f},
-std::array<float,2>{0.321675092f, 0.996127307f},
-std::array<float,2>{0.432958454f, 0.388283372f},
-std::array<float,2>{0.745836139f, 0.861995578f},
-std::array<float,2>{0.784870327f, 0.162755996f},
-std::array<float,2>{0.176664278f, 0.741709352f},
-std::array<float,2>{0.254935324f, 0.243416131f},
-std::array<float,2>{0.578709126f, 0.649942935f},
-std::array<float,2>{0.908375919f, 0.466262698f},
-std::array<float,2>{0.118696719f, 0.807981372f},
-std::array<float,2>{0.193263471f, 0.364343464f},
-std::array<float,2>{0.838635504f, 0.878900468f},
-std::array<float,2>{0.655596972f, 0.0281846207f},
-std::array<float,2>{0.462688237f, 0.537884831f},
-std::array<float,2>{0.0341774747f, 0.166686118f},
-std::array<float,2>{0.972445667f, 0.749881387f},
-std::array<float,2>{0.500296354f, 0.376678407f},
-std::array<float,2>{0.366831988f, 0.873026848f},
-std::array<float,2>{0.403496414f, 0.26866889f},
-std::array<float,2>{0.697154641f, 0.984631896f},
-std::array<float,2>{0.779510736f, 0.0651900768f},
-std::array<float,2>{0.154444948f, 0.607870996f},
-std::array<float,2>{0.283982694f, 0.023279829f},
-std::array<float,2>{0.624706686f, 0.542748272f},
-std::array<float,2>{0.903310299f, 0.37449941f},
-std::array<float,2>{0.0712109804f, 0.886082053f},
-std::array<float,2>{0.226080716f, 0.460528404f},
-std::array<float,2>{0.873885751f, 0.797197044f},
-std::array<float,2>{0.658581018f, 0.239358515f},
-std::array<float,2>{0.494907022f, 0.643388331f},
-std::array<float,2>{0.184157476f, 0.101696059f},
-std::array<float,2>{0.791226447f, 0.585421026f},
-std::array<float,2>{0.73868984f, 0.293086708f},
-std::array<float,2>{0.42443949f, 0.955735862f},
-std::array<float,2>{0.314956784f, 0.437252849f},
-std::array<float,2>{0.537446201f, 0.83514154f},
-std::array<float,2>{0.960317194f, 0.134435028f},
-std::array<float,2>{0.0268026646f, 0.696346045f},
-std::array<float,2>{0.456032187f, 0.212996736f},
-std::array<float,2>{0.648077905f, 0.665401042f},
-std::array<float,2>{0.833894908f, 0.471636027f},
-std::array<float,2>{0.198482603f, 0.770820379f},
-std::array<float,2>{0.112014279f, 0.337114036f},
-std::array<float,2>{0.916571915f, 0.929255784f},
-std::array<float,2>{0.588219225f, 0.0348514393f},
-std::array<float,2>{0.264567584f, 0.514458239f},
-std::array<float,2>{0.216116756f, 0.23191236f},
-std::array<float,2>{0.820272684f, 0.639346004f},
-std::array<float,2>{0.63132298f, 0.4391177f},
-std::array<float,2>{0.437952191f, 0.787392437f},
-std::array<float,2>{0.278902173f, 0.352390647f},
-std::array<float,2>{0.567965508f, 0.900799096f},
-std::array<float,2>{0.933284163f, 0.00796936546f},
-std::array<float,2>{0.105220728f, 0.548569798f},
-std::array<float,2>{0.408953577f, 0.0870519951f},
-std::array<float,2>{0.734076381f, 0.613407731f},
-std::array<float,2>{0.800769687f, 0.263201475f},
-std::array<float,2>{0.166441903f, 0.974995494f},
-std::array<float,2>{0.0113025857f, 0.397259265f},
-std::array<float,2>{0.952219546f, 0.844099998f},
-std::array<float,2>{0.562115669f, 0.178881466f},
-std::array<float,2>{0.33395043f, 0.719560206f},
-std::array<float,2>{0.0871937796f, 0.0591006987f},
-std::array<float,2>{0.885558009f, 0.518781543f},
-std::array<float,2>{0.607851744f, 0.314727187f},
-std::array<float,2>{0.298502594f, 0.92127353f},
-std::array<float,2>{0.469155937f, 0.494193166f},
-std::array<float,2>{0.684370637f, 0.751640975f},
-std::array<float,2>{0.856794834f, 0.197467282f},
-std::array<float,2>{0.234798416f, 0.682398856f},
-std::array<float,2>{0.345838815f, 0.146645889f},
-std::array<float,2>{0.524529099f, 0.713013768f},
-std::array<float,2>{0.996669233f, 0.421132863f},
-std::array<float,2>{0.0520314425f, 0.815211654f},
-std::array<float,2>{0.136677057f, 0.303669065f},
-std::array<float,2>{0.76034528f, 0.947660804f},
-std::array<float,2>{0.718655765f, 0.115881763f},
-std::array<float,2>{0.386559486f, 0.569467485f},
-std::array<float,2>{0.00035995178f, 0.235884801f},
-std::array<float,2>{0.937737644f, 0.644810021f},
-std::array<float,2>{0.551969647f, 0.456550449f},
-std::array<float,2>{0.338262916f, 0.802308738f},
-std::array<float,2>{0.416768849f, 0.367492586f},
-std::array<float,2>{0.719551742f, 0.88692522f},
-std::array<float,2>{0.809293687f, 0.0179154277f},
-std::array<float,2>{0.161714301f, 0.544677079f},
-std::array<float,2>{0.268515825f, 0.0676627308f},
-std::array<float,2>{0.570879042f, 0.602743447f},
-std::array<float,2>{0.928683102f, 0.272676706f},
-std::array<float,2>{0.0962838158f, 0.991761208f},
-std::array<float,2>{0.203541696f, 0.381597728f},
-std::array<float,2>{0.824233592f, 0.868757844f},
-std::array<float,2>{0.637607455f, 0.169469535f},
-std::array<float,2>{0.449682087f, 0.744261622f},
-std::array<float,2>{0.131453395f, 0.0386498272f},
-std::array<float,2>{0.754945457f, 0.508110404f},
-std::array<float,2>{0.70734179f, 0.340195626f},
-std::array<float,2>{0.37847659f, 0.923980772f},
-std::array<float,2>{0.353493631f, 0.473579764f},
-std::array<float,2>{0.516097426f, 0.767075062f},
-std::array<float,2>{0.986008406f, 0.21597755f},
-std::array<float,2>{0.0573238097f, 0.669978678f},
-std::array<float,2>{0.476775289f, 0.138718873f},
-std::array<float,2>{0.675700665f, 0.700595677f},
-std::array<float,2>{0.84470427f, 0.432684928f},
-std::array<float,2>{0.249595866f, 0.829053938f},
-std::array<float,2>{0.078207776f, 0.292154253f},
-std::array<float,2>{0.882358253f, 0.959299028f},
-std::array<float,2>{0.594995797f, 0.108903073f},
-std::array<float,2>{0.311695397f, 0.581347406f},
-std::array<float,2>{0.231346697f, 0.171886533f},
-std::array<float,2>{0.859969199f, 0.724763572f},
-std::array<float,2>{0.669037521f, 0.393006057f},
-std::array<float,2>{0.485637993f, 0.848134756f},
-std::array<float,2>{0.290301979f, 0.258334935f},
-std::array<float,2>{0.610375047f, 0.969910502f},
-std::array<float,2>{0.897435784f, 0.0918270946f},
-std::array<float,2>{0.069495596f, 0.612328053f},
-std::array<float,2>{0.398423374f, 0.0145616028f},
-std::array<float,2>{0.691365302f, 0.551049829f},
-std::array<float,2>{0.769215524f, 0.355537921f},
-std::array<float,2>{0.144475833f, 0.903098226f},
-std::array<float,2>{0.0442923605f, 0.442271173f},
-std::array<float,2>{0.98077035f, 0.784278631f},
-std::array<float,2>{0.512469113f, 0.229672283f},
-std::array<float,2>{0.368868083f, 0.633861661f},
-std::array<float,2>{0.124418035f, 0.111409873f},
-std::array<float,2>{0.91058743f, 0.566073298f},
-std::array<float,2>{0.584868431f, 0.300416619f},
-std::array<float,2>{0.25134626f, 0.951714396f},
-std::array<float,2>{0.468011081f, 0.415497661f},
-std::array<float,2>{0.650062025f, 0.817415833f},
-std::array<float,2>{0.842876077f, 0.141102627f},
-std::array<float,2>{0.190041542f, 0.718045712f},
-std::array<float,2>{0.326275885f, 0.202721372f},
-std::array<float,2>{0.539861083f, 0.686723828f},
-std::array<float,2>{0.966478109f, 0.498946875f},
-std::array<float,2>{0.0201414432f, 0.755034208f},
-std::array<float,2>{0.174292177f, 0.319641352f},
-std::array<float,2>{0.786806643f, 0.917854846f},
-std::array<float,2>{0.747300148f, 0.0555373617f},
-std::array<float,2>{0.435669065f, 0.520777285f},
-std::array<float,2>{0.0777441189f, 0.148960143f},
-std::array<float,2>{0.899295866f, 0.705633581f},
-std::array<float,2>{0.619674623f, 0.409948915f},
-std::array<float,2>{0.28849411f, 0.822389722f},
-std::array<float,2>{0.497220576f, 0.310019314f},
-std::array<float,2>{0.662502587f, 0.944052756f},
-std::array<float,2>{0.868214846f, 0.122823358f},
-std::array<float,2>{0.221634448f, 0.57668817f},
-std::array<float,2>{0.362752438f, 0.0509642363f},
-std::array<float,2>{0.507269919f, 0.527573526f},
-std::array<float,2>{0.975590885f, 0.321136683f},
-std::array<float,2>{0.036429666f, 0.908060431f},
-std::array<float,2>{0.151977852f, 0.486881822f},
-std::array<float,2>{0.777141988f, 0.761602342f},
-std::array<float,2>{0.702970743f, 0.187962919f},
-std::array<float,2>{0.401786357f, 0.679433048f},
-std::array<float,2>{0.20048824f, 0.0801127329f},
-std::array<float,2>{0.829022944f, 0.62028873f},
-std::array<float,2>{0.640927255f, 0.250625044f},
-std::array<float,2>{0.459568024f, 0.983698249f},
-std::array<float,2>{0.26076445f, 0.399015397f},
-std::array<float,2>{0.590484798f, 0.857732892f},
-std::array<float,2>{0.921272695f, 0.181437477f},
-std::array<float,2>{0.116782136f, 0.732894659f},
-std::array<float,2>{0.426153332f, 0.223481491f},
-std::array<float,2>{0.734539807f, 0.629528582f},
-std::array<float,2>{0.79582876f, 0.448942602f},
-std::array<float,2>{0.179965451f, 0.789221406f},
-std::array<float,2>{0.0280337706f, 0.347219318f},
-std::array<float,2>{0.954307377f, 0.898388386f},
-std::array<float,2>{0.533599555f, 0.000802773051f},
-std::array<float,2>{0.317099154f, 0.555198908f},
-std::array<float,2>{0.170540035f, 0.206909031f},
-std::array<float,2>{0.802455068f, 0.658684313f},
-std::array<float,2>{0.727022707f, 0.482563734f},
-std::array<float,2>{0.412977844f, 0.780539691f},
-std::array<float,2>{0.331441373f, 0.32944423f},
-std::array<float,2>{0.556958616f, 0.933135569f},
-std::array<float,2>{0.949052632f, 0.0453499071f},
-std::array<float,2>{0.0120239723f, 0.506636918f},
-std::array<float,2>{0.442649901f, 0.101090938f},
-std::array<float,2>{0.62768805f, 0.586268067f},
-std::array<float,2>{0.816137373f, 0.28605336f},
-std::array<float,2>{0.214362174f, 0.961072206f},
-std::array<float,2>{0.109220073f, 0.425171316f},
-std::array<float,2>{0.937034488f, 0.837967575f},
-std::array<float,2>{0.563666582f, 0.132493421f},
-std::array<float,2>{0.276361853f, 0.69118458f},
-std::array<float,2>{0.0499706604f, 0.0258905906f},
-std::array<float,2>{0.995021522f, 0.53417474f},
-std::array<float,2>{0.530604541f, 0.361755639f},
-std::array<float,2>{0.348242819f, 0.88277477f},
-std::array<float,2>{0.38951841f, 0.462208837f},
-std::array<float,2>{0.712819636f, 0.811350942f},
-std::array<float,2>{0.764185488f, 0.249007374f},
-std::array<float,2>{0.140469581f, 0.656140268f},
-std::array<float,2>{0.302945346f, 0.15989992f},
-std::array<float,2>{0.602805734f, 0.736325383f},
-std::array<float,2>{0.890473664f, 0.386596739f},
-std::array<float,2>{0.0913074091f, 0.866790473f},
-std::array<float,2>{0.239643961f, 0.274575233f},
-std::array<float,2>{0.85191071f, 0.994175196f},
-std::array<float,2>{0.679822862f, 0.0722245201f},
-std::array<float,2>{0.474903345f, 0.596038759f},
-std::array<float,2>{0.104856066f, 0.233634859f},
-std::array<float,2>{0.933098078f, 0.638113022f},
-std::array<float,2>{0.567645013f, 0.439732194f},
-std::array<float,2>{0.278505057f, 0.785748422f},
-std::array<float,2>{0.438105673f, 0.353606343f},
-std::array<float,2>{0.631530881f, 0.900281072f},
-std::array<float,2>{0.819356918f, 0.0112702232f},
-std::array<float,2>{0.216615751f, 0.549439609f},
-std::array<float,2>{0.333285749f, 0.0884475559f},
-std::array<float,2>{0.561743438f, 0.616502345f},
-std::array<float,2>{0.952841282f, 0.265473396f},
-std::array<float,2>{0.0110697523f, 0.972833931f},
-std::array<float,2>{0.166747645f, 0.395679146f},
-std::array<float,2>{0.799907804f, 0.845902979f},
-std::array<float,2>{0.733495772f, 0.176724643f},
-std::array<float,2>{0.408360183f, 0.721835136f},
-std::array<float,2>{0.234939024f, 0.0608890504f},
-std::array<float,2>{0.857372105f, 0.516749442f},
-std::array<float,2>{0.684036016f, 0.312782407f},
-std::array<float,2>{0.469449639f, 0.919425726f},
-std::array<float,2>{0.297981411f, 0.49349907f},
-std::array<float,2>{0.607958794f, 0.752587736f},
-std::array<float,2>{0.884865701f, 0.19651562f},
-std::array<float,2>{0.0878042057f, 0.680759609f},
-std::array<float,2>{0.385959834f, 0.146441072f},
-std::array<float,2>{0.717821658f, 0.711976409f},
-std::array<float,2>{0.759909034f, 0.418847024f},
-std::array<float,2>{0.135811672f, 0.812533379f},
-std::array<float,2>{0.0527269244f, 0.302323461f},
-std::array<float,2>{0.996424675f, 0.946074724f},
-std::array<float,2>{0.524981081f, 0.114576288f},
-std::array<float,2>{0.346609116f, 0.568042457f},
-std::array<float,2>{0.155097961f, 0.165174931f},
-std::array<float,2>{0.780016959f, 0.746251106f},
-std::array<float,2>{0.696669698f, 0.377569407f},
-std::array<float,2>{0.404151767f, 0.873067439f},
-std::array<float,2>{0.36662522f, 0.265767783f},
-std::array<float,2>{0.500795782f, 0.986338675f},
-std::array<float,2>{0.971966922f, 0.0631709397f},
-std::array<float,2>{0.0332464613f, 0.606618345f},
-std::array<float,2>{0.494322747f, 0.020265229f},
-std::array<float,2>{0.658937812f, 0.539279103f},
-std::array<float,2>{0.873329163f, 0.3711676f},
-std::array<float,2>{0.226011604f, 0.88475889f},
-std::array<float,2>{0.0705084652f, 0.458414108f},
-std::array<float,2>{0.902520597f, 0.799244881f},
-std::array<float,2>{0.624366522f, 0.241945237f},
-std::array<float,2>{0.283544451f, 0.64132309f},
-std::array<float,2>{0.0271060281f, 0.105051115f},
-std::array<float,2>{0.960689068f, 0.582498431f},
-std::array<float,2>{0.537863553f, 0.29666692f},
-std::array<float,2>{0.314699113f, 0.953561723f},
-std::array<float,2>{0.423940301f, 0.434989184f},
-std::array<float,2>{0.738858342f, 0.83310622f},
-std::array<float,2>{0.791544735f, 0.136180043f},
-std::array<float,2>{0.183859155f, 0.697719991f},
-std::array<float,2>{0.263785213f, 0.212392762f},
-std::array<float,2>{0.58854413f, 0.66614449f},
-std::array<float,2>{0.916291535f, 0.468769729f},
-std::array<float,2>{0.111462563f, 0.771585941f},
-std::array<float,2>{0.198863447f, 0.338519722f},
-std::array<float,2>{0.833120644f, 0.927134573f},
-std::array<float,2>{0.647897184f, 0.0323401242f},
-std::array<float,2>{0.45517391f, 0.512791395f},
-std::array<float,2>{0.039438881f, 0.126824856f},
-std::array<float,2>{0.977309346f, 0.694598675f},
-std::array<float,2>{0.507836878f, 0.428798825f},
-std::array<float,2>{0.374212384f, 0.840544879f},
-std::array<float,2>{0.393496692f, 0.282213867f},
-std::array<float,2>{0.691417515f, 0.966372132f},
-std::array<float,2>{0.770778775f, 0.094712019f},
-std::array<float,2>{0.148100689f, 0.590075076f},
-std::array<float,2>{0.293000191f, 0.0410898738f},
-std::array<float,2>{0.616064787f, 0.501006961f},
-std::array<float,2>{0.891446114f, 0.333024293f},
-std::array<float,2>{0.0645364225f, 0.935558915f},
-std::array<float,2>{0.228687078f, 0.476674676f},
-std::array<float,2>{0.867072582f, 0.773652971f},
-std::array<float,2>{0.665505886f, 0.207744122f},
-std::array<float,2>{0.490243018f, 0.662620485f},
-std::array<float,2>{0.176201433f, 0.0781056359f},
-std::array<float,2>{0.784566283f, 0.599085987f},
-std::array<float,2>{0.745259225f, 0.279309183f},
-std::array<float,2>{0.433518767f, 0.99940896f},
-std::array<float,2>{0.322123468f, 0.389677733f},
-std::array<float,2>{0.543632984f, 0.861162722f},
-std::array<float,2>{0.963324666f, 0.160796911f},
-std::array<float,2>{0.0165481288f, 0.740015805f},
-std::array<float,2>{0.462036043f, 0.244357511f},
-std::array<float,2>{0.656133711f, 0.65107584f},
-std::array<float,2>{0.838207364f, 0.467166692f},
-std::array<float,2>{0.192495137f, 0.806304455f},
-std::array<float,2>{0.118354067f, 0.366942823f},
-std::array<float,2>{0.909178853f, 0.875697196f},
-std::array<float,2>{0.578524351f, 0.0298101865f},
-std::array<float,2>{0.255501419f, 0.536821902f},
-std::array<float,2>{0.209704518f, 0.194809631f},
-std::array<float,2>{0.822362244f, 0.674913764f},
-std::array<float,2>{0.636306405f, 0.491376877f},
-std::array<float,2>{0.445591092f, 0.764781952f},
-std::array<float,2>{0.273011416f, 0.324394196f},
-std::array<float,2>{0.574652076f, 0.91381824f},
-std::array<float,2>{0.9244892f, 0.0490502454f},
-std::array<float,2>{0.0984525755f, 0.526657641f},
-std::array<float,2>{0.421510875f, 0.120674483f},
-std::array<float,2>{0.725025356f, 0.571430802f},
-std::array<float,2>{0.805996358f, 0.308511019f},
-std::array<float,2>{0.158116162f, 0.940765023f},
-std::array<float,2>{0.00681787822f, 0.413929462f},
-std::array<float,2>{0.944927394f, 0.826398849f},
-std::array<float,2>{0.549399078f, 0.155969143f},
-std::array<float,2>{0.343287557f, 0.70739013f},
-std::array<float,2>{0.0836509615f, 0.00541170826f},
-std::array<float,2>{0.877961814f, 0.559269249f},
-std::array<float,2>{0.597763836f, 0.348137856f},
-std::array<float,2>{0.306673735f, 0.891802728f},
-std::array<float,2>{0.482763469f, 0.451239288f},
-std::array<float,2>{0.67758739f, 0.794419229f},
-std::array<float,2>{0.848870873f, 0.221679285f},
-std::array<float,2>{0.24352248f, 0.627816916f},
-std::array<float,2>{0.358143479f, 0.184622079f},
-std::array<float,2>{0.520869076f, 0.727866888f},
-std::array<float,2>{0.989482701f, 0.404564351f},
-std::array<float,2>{0.060812436f, 0.853153169f},
-std::array<float,2>{0.125391126f, 0.255466729f},
-std::array<float,2>{0.752504408f, 0.976992428f},
-std::array<float,2>{0.704461455f, 0.0849228725f},
-std::array<float,2>{0.379141539f, 0.624441981f},
-std::array<float,2>{0.0125233857f, 0.203245535f},
-std::array<float,2>{0.948344469f, 0.657246411f},
-std::array<float,2>{0.557409465f, 0.481205732f},
-std::array<float,2>{0.33154732f, 0.778789639f},
-std::array<float,2>{0.412211359f, 0.331314415f},
-std::array<float,2>{0.727345824f, 0.930904508f},
-std::array<float,2>{0.801808059f, 0.0431054644f},
-std::array<float,2>{0.170238286f, 0.503980875f},
-std::array<float,2>{0.27545321f, 0.0978587121f},
-std::array<float,2>{0.564302564f, 0.588106632f},
-std::array<float,2>{0.936843038f, 0.288313776f},
-std::array<float,2>{0.108524084f, 0.963742435f},
-std::array<float,2>{0.214238405f, 0.422622174f},
-std::array<float,2>{0.815587401f, 0.837181449f},
-std::array<float,2>{0.627270877f, 0.130010813f},
-std::array<float,2>{0.443065941f, 0.689068615f},
-std::array<float,2>{0.140011385f, 0.0236257538f},
-std::array<float,2>{0.764143467f, 0.531312585f},
-std::array<float,2>{0.71207881f, 0.361231595f},
-std::array<float,2>{0.388819426f, 0.879687905f},
-std::array<float,2>{0.348132104f, 0.463439405f},
-std::array<float,2>{0.531047046f, 0.810306609f},
-std::array<float,2>{0.99430865f, 0.246170625f},
-std::array<float,2>{0.0507528856f, 0.652863503f},
-std::array<float,2>{0.475297898f, 0.157901898f},
-std::array<float,2>{0.680240095f, 0.736449599f},
-std::array<float,2>{0.85224998f, 0.383403957f},
-std::array<float,2>{0.240093172f, 0.864970982f},
-std::array<float,2>{0.0916290358f, 0.275526524f},
-std::array<float,2>{0.890089989f, 0.994012117f},
-std::array<float,2>{0.603067398f, 0.0741304383f},
-std::array<float,2>{0.303641409f, 0.594807327f},
-std::array<float,2>{0.22118485f, 0.151070416f},
-std::array<float,2>{0.868666172f, 0.704955757f},
-std::array<float,2>{0.663036466f, 0.407745928f},
-std::array<float,2>{0.497563988f, 0.820710003f},
-std::array<float,2>{0.288809329f, 0.311047465f},
-std::array<float,2>{0.619322658f, 0.943303704f},
-std::array<float,2>{0.898477495f, 0.124596998f},
-std::array<float,2>{0.077420108f, 0.575000703f},
-std::array<float,2>{0.402196079f, 0.0530319959f},
-std::array<float,2>{0.702332079f, 0.529709578f},
-std::array<float,2>{0.776613832f, 0.323652297f},
-std::array<float,2>{0.151805773f, 0.909912884f},
-std::array<float,2>{0.03678995f, 0.48626858f},
-std::array<float,2>{0.976523042f, 0.759077668f},
-std::array<float,2>{0.507792413f, 0.191005945f},
-std::array<float,2>{0.363026053f, 0.677332163f},
-std::array<float,2>{0.116620265f, 0.0786180347f},
-std::array<float,2>{0.921717525f, 0.619033873f},
-std::array<float,2>{0.589888573f, 0.252443969f},
-std::array<float,2>{0.261632055f, 0.980886936f},
-std::array<float,2>{0.459065884f, 0.401275516f},
-std::array<float,2>{0.641482532f, 0.855842948f},
-std::array<float,2>{0.82840693f, 0.183449164f},
-std::array<float,2>{0.200753897f, 0.732153535f},
-std::array<float,2>{0.316523492f, 0.226027995f},
-std::array<float,2>{0.534071624f, 0.630898356f},
-std::array<float,2>{0.954675972f, 0.445333272f},
-std::array<float,2>{0.0274443477f, 0.791134596f},
-std::array<float,2>{0.180339396f, 0.344109952f},
-std::array<float,2>{0.795366287f, 0.895299494f},
-std::array<float,2>{0.734914482f, 0.00221642759f},
-std::array<float,2>{0.426544636f, 0.557622671f},
-std::array<float,2>{0.0698926151f, 0.175049379f},
-std::array<float,2>{0.896875322f, 0.723310173f},
-std::array<float,2>{0.61100924f, 0.39248991f},
-std::array<float,2>{0.290636063f, 0.84996444f},
-std::array<float,2>{0.48613432f, 0.26087749f},
-std::array<float,2>{0.66957593f, 0.970911026f},
-std::array<float,2>{0.85944289f, 0.090488635f},
-std::array<float,2>{0.230555624f, 0.610828459f},
-std::array<float,2>{0.368378669f, 0.013549054f},
-std::array<float,2>{0.511841714f, 0.554308295f},
-std::array<float,2>{0.981295943f, 0.358798891f},
-std::array<float,2>{0.0447954722f, 0.904787362f},
-std::array<float,2>{0.143664777f, 0.445099384f},
-std::array<float,2>{0.768880367f, 0.781720817f},
-std::array<float,2>{0.69059813f, 0.226831451f},
-std::array<float,2>{0.397861421f, 0.636065543f},
-std::array<float,2>{0.189824432f, 0.11059235f},
-std::array<float,2>{0.843621552f, 0.563699126f},
-std::array<float,2>{0.649823546f, 0.297275603f},
-std::array<float,2>{0.468422413f, 0.950336516f},
-std::array<float,2>{0.251728207f, 0.417425513f},
-std::array<float,2>{0.584068894f, 0.81866014f},
-std::array<float,2>{0.910992146f, 0.143641725f},
-std::array<float,2>{0.124619298f, 0.715381622f},
-std::array<float,2>{0.43631348f, 0.20053941f},
-std::array<float,2>{0.747659266f, 0.685230732f},
-std::array<float,2>{0.786191165f, 0.496632397f},
-std::array<float,2>{0.174346313f, 0.756399572f},
-std::array<float,2>{0.0199997686f, 0.317128539f},
-std::array<float,2>{0.965988278f, 0.915802181f},
-std::array<float,2>{0.539367259f, 0.0577542f},
-std::array<float,2>{0.326865017f, 0.522741437f},
-std::array<float,2>{0.161488995f, 0.237432897f},
-std::array<float,2>{0.808646262f, 0.647205532f},
-std::array<float,2>{0.7189309f, 0.453862727f},
-std::array<float,2>{0.416171551f, 0.803211987f},
-std::array<float,2>{0.338731259f, 0.369850934f},
-std::array<float,2>{0.552695394f, 0.889690638f},
-std::array<float,2>{0.938065469f, 0.0158272646f},
-std::array<float,2>{0.000654295727f, 0.545179069f},
-std::array<float,2>{0.449843705f, 0.0696984753f},
-std::array<float,2>{0.63687253f, 0.6049999f},
-std::array<float,2>{0.82484597f, 0.271061957f},
-std::array<float,2>{0.204092443f, 0.989643753f},
-std::array<float,2>{0.0958241969f, 0.380605906f},
-std::array<float,2>{0.927951574f, 0.87075299f},
-std::array<float,2>{0.570771575f, 0.170990705f},
-std::array<float,2>{0.267915159f, 0.742935121f},
-std::array<float,2>{0.0568395108f, 0.0352713615f},
-std::array<float,2>{0.985611975f, 0.510881782f},
-std::array<float,2>{0.516461313f, 0.342802376f},
-std::array<float,2>{0.352837592f, 0.922021031f},
-std::array<float,2>{0.378061593f, 0.475576371f},
-std::array<float,2>{0.707765758f, 0.768882096f},
-std::array<float,2>{0.755714059f, 0.218187228f},
-std::array<float,2>{0.130978182f, 0.668841302f},
-std::array<float,2>{0.312136441f, 0.138634488f},
-std::array<float,2>{0.595384896f, 0.701897502f},
-std::array<float,2>{0.881851733f, 0.430115402f},
-std::array<float,2>{0.0788630843f, 0.830285311f},
-std::array<float,2>{0.249134868f, 0.290533096f},
-std::array<float,2>{0.844065905f, 0.957259655f},
-std::array<float,2>{0.675192893f, 0.107020155f},
-std::array<float,2>{0.477536857f, 0.57874918f},
-std::array<float,2>{0.0879410952f, 0.197896227f},
-std::array<float,2>{0.884064853f, 0.68211937f},
-std::array<float,2>{0.606762588f, 0.494783521f},
-std::array<float,2>{0.299948961f, 0.751215637f},
-std::array<float,2>{0.471751124f, 0.315377653f},
-std::array<float,2>{0.68722868f, 0.921539485f},
-std::array<float,2>{0.859030604f, 0.058745414f},
-std::array<float,2>{0.238176376f, 0.519197166f},
-std::array<float,2>{0.344774902f, 0.115301706f},
-std::array<float,2>{0.525432646f, 0.56999135f},
-std::array<float,2>{0.998189211f, 0.302991569f},
-std::array<float,2>{0.0540383644f, 0.948117614f},
-std::array<float,2>{0.133993462f, 0.421462297f},
-std::array<float,2>{0.758205831f, 0.814504802f},
-std::array<float,2>{0.714871407f, 0.147257954f},
-std::array<float,2>{0.383550674f, 0.713498056f},
-std::array<float,2>{0.218634143f, 0.00830616429f},
-std::array<float,2>{0.817146182f, 0.548007309f},
-std::array<float,2>{0.630008578f, 0.351795256f},
-std::array<float,2>{0.440729737f, 0.90090239f},
-std::array<float,2>{0.280719995f, 0.438657552f},
-std::array<float,2>{0.568694413f, 0.787806213f},
-std::array<float,2>{0.929870427f, 0.231936082f},
-std::array<float,2>{0.10156735f, 0.638826191f},
-std::array<float,2>{0.407496572f, 0.179236874f},
-std::array<float,2>{0.730597854f, 0.718843102f},
-std::array<float,2>{0.798002124f, 0.396733612f},
-std::array<float,2>{0.165442765f, 0.844452798f},
-std::array<float,2>{0.00904595852f, 0.262786239f},
-std::array<float,2>{0.949918747f, 0.975358963f},
-std::array<float,2>{0.559546053f, 0.0877068043f},
-std::array<float,2>{0.335246831f, 0.613879204f},
-std::array<float,2>{0.186323389f, 0.134081081f},
-std::array<float,2>{0.790381551f, 0.696852326f},
-std::array<float,2>{0.741480231f, 0.436767191f},
-std::array<float,2>{0.422520012f, 0.835821748f},
-std::array<float,2>{0.313702852f, 0.293640167f},
-std::array<float,2>{0.536746979f, 0.955194831f},
-std::array<float,2>{0.958112061f, 0.102087773f},
-std::array<float,2>{0.0235394798f, 0.585558414f},
-std::array<float,2>{0.454773366f, 0.0342410766f},
-std::array<float,2>{0.646228015f, 0.514049351f},
-std::array<float,2>{0.834028423f, 0.337769747f},
-std::array<float,2>{0.196859375f, 0.928989112f},
-std::array<float,2>{0.110937104f, 0.47102493f},
-std::array<float,2>{0.91542393f, 0.771216869f},
-std::array<float,2>{0.587007761f, 0.21375756f},
-std::array<float,2>{0.263588339f, 0.66599077f},
-std::array<float,2>{0.0318946652f, 0.0648755431f},
-std::array<float,2>{0.969999015f, 0.607968926f},
-std::array<float,2>{0.503109992f, 0.269234955f},
-std::array<float,2>{0.364447981f, 0.985041559f},
-std::array<float,2>{0.404545754f, 0.376250952f},
-std::array<float,2>{0.699099362f, 0.872259498f},
-std::array<float,2>{0.77904129f, 0.166443467f},
-std::array<float,2>{0.154065266f, 0.749483228f},
-std::array<float,2>{0.282531589f, 0.239998505f},
-std::array<float,2>{0.621970296f, 0.642884016f},
-std::array<float,2>{0.90453589f, 0.459992498f},
-std::array<float,2>{0.0732991099f, 0.797695518f},
-std::array<float,2>{0.223810434f, 0.374908447f},
-std::array<float,2>{0.871338069f, 0.886687338f},
-std::array<float,2>{0.657697797f, 0.0229204353f},
-std::array<float,2>{0.493382066f, 0.54209429f},
-std::array<float,2>{0.0186986327f, 0.162359953f},
-std::array<float,2>{0.96271801f, 0.741562903f},
-std::array<float,2>{0.545629501f, 0.387845546f},
-std::array<float,2>{0.322764039f, 0.861407757f},
-std::array<float,2>{0.431367844f, 0.277391404f},
-std::array<float,2>{0.742649436f, 0.996979177f},
-std::array<float,2>{0.781525135f, 0.0747679621f},
-std::array<float,2>{0.178709939f, 0.59994334f},
-std::array<float,2>{0.257762492f, 0.0273656957f},
-std::array<float,2>{0.5801121f, 0.537197053f},
-std::array<float,2>{0.907476962f, 0.364954442f},
-std::array<float,2>{0.120071717f, 0.878194809f},
-std::array<float,2>{0.193624005f, 0.466475129f},
-std::array<float,2>{0.836502314f, 0.808346212f},
-std::array<float,2>{0.652503848f, 0.243785366f},
-std::array<float,2>{0.464379162f, 0.649598956f},
-std::array<float,2>{0.145696715f, 0.0962048694f},
-std::array<float,2>{0.773249567f, 0.592286885f},
-std::array<float,2>{0.693780065f, 0.285026342f},
-std::array<float,2>{0.392059565f, 0.967963755f},
-std::array<float,2>{0.371845812f, 0.426928043f},
-std::array<float,2>{0.510845184f, 0.843676805f},
-std::array<float,2>{0.97907871f, 0.128341615f},
-std::array<float,2>{0.0418769121f, 0.692512989f},
-std::array<float,2>{0.489633799f, 0.209594429f},
-std::array<float,2>{0.667833805f, 0.661490679f},
-std::array<float,2>{0.863678932f, 0.479409456f},
-std::array<float,2>{0.227640837f, 0.776557326f},
-std::array<float,2>{0.0639055371f, 0.334390134f},
-std::array<float,2>{0.893823922f, 0.934330881f},
-std::array<float,2>{0.613660872f, 0.040195588f},
-std::array<float,2>{0.296072841f, 0.502886534f},
-std::array<float,2>{0.245365351f, 0.219339266f},
-std::array<float,2>{0.850072086f, 0.626750886f},
-std::array<float,2>{0.678545773f, 0.449520767f},
-std::array<float,2>{0.481951565f, 0.796192825f},
-std::array<float,2>{0.305514485f, 0.349718601f},
-std::array<float,2>{0.60067755f, 0.89425844f},
-std::array<float,2>{0.875977993f, 0.00714620994f},
-std::array<float,2>{0.085925594f, 0.56180495f},
-std::array<float,2>{0.381917417f, 0.0828331634f},
-std::array<float,2>{0.70619148f, 0.622611701f},
-std::array<float,2>{0.750546575f, 0.257234067f},
-std::array<float,2>{0.128109038f, 0.978642225f},
-std::array<float,2>{0.0589469969f, 0.403455228f},
-std::array<float,2>{0.991741002f, 0.853762865f},
-std::array<float,2>{0.523409545f, 0.187168255f},
-std::array<float,2>{0.356511623f, 0.730092287f},
-std::array<float,2>{0.100980729f, 0.0474355072f},
-std::array<float,2>{0.923392415f, 0.525106728f},
-std::array<float,2>{0.576502085f, 0.32754153f},
-std::array<float,2>{0.269619584f, 0.911224484f},
-std::array<float,2>{0.4479931f, 0.488320708f},
-std::array<float,2>{0.634228587f, 0.761918604f},
-std::array<float,2>{0.821934998f, 0.191507384f},
-std::array<float,2>{0.208806932f, 0.671996057f},
-std::array<float,2>{0.341378659f, 0.152951851f},
-std::array<float,2>{0.547052264f, 0.710252106f},
-std::array<float,2>{0.941624641f, 0.411684185f},
-std::array<float,2>{0.00391527452f, 0.825295746f},
-std::array<float,2>{0.159960449f, 0.305315167f},
-std::array<float,2>{0.808405221f, 0.937673628f},
-std::array<float,2>{0.724207163f, 0.117397554f},
-std::array<float,2>{0.418535948f, 0.572398007f},
-std::array<float,2>{0.0470438525f, 0.248307988f},
-std::array<float,2>{0.993312478f, 0.655352354f},
-std::array<float,2>{0.528231561f, 0.46288234f},
-std::array<float,2>{0.350262254f, 0.810851514f},
-std::array<float,2>{0.388110429f, 0.36192283f},
-std::array<float,2>{0.713440418f, 0.882251978f},
-std::array<float,2>{0.761918783f, 0.0256921556f},
-std::array<float,2>{0.137506694f, 0.533395946f},
-std::array<float,2>{0.302666426f, 0.0716661289f},
-std::array<float,2>{0.605251133f, 0.596632242f},
-std::array<float,2>{0.888250291f, 0.27495417f},
-std::array<float,2>{0.0931857154f, 0.995024979f},
-std::array<float,2>{0.241456851f, 0.386025012f},
-std::array<float,2>{0.854860127f, 0.86664027f},
-std::array<float,2>{0.682252049f, 0.159384668f},
-std::array<float,2>{0.473200917f, 0.735421717f},
-std::array<float,2>{0.169860423f, 0.0454969071f},
-std::array<float,2>{0.803590417f, 0.506024778f},
-std::array<float,2>{0.730102837f, 0.33003056f},
-std::array<float,2>{0.411846995f, 0.932795167f},
-std::array<float,2>{0.329431444f, 0.483188063f},
-std::array<float,2>{0.555975497f, 0.780768692f},
-std::array<float,2>{0.946320593f, 0.20612438f},
-std::array<float,2>{0.0144411577f, 0.659035385f},
-std::array<float,2>{0.445150614f, 0.132139117f},
-std::array<float,2>{0.625084758f, 0.690758288f},
-std::array<float,2>{0.814058006f, 0.425694883f},
-std::array<float,2>{0.211398751f, 0.838783562f},
-std::array<float,2>{0.105782092f, 0.285339057f},
-std::array<float,2>{0.934626758f, 0.96162647f},
-std::array<float,2>{0.565179288f, 0.101026602f},
-std::array<float,2>{0.273849249f, 0.586557209f},
-std::array<float,2>{0.202357739f, 0.181091219f},
-std::array<float,2>{0.831657171f, 0.73323667f},
-std::array<float,2>{0.643600643f, 0.398580223f},
-std::array<float,2>{0.458333284f, 0.858122408f},
-std::array<float,2>{0.258586138f, 0.250161558f},
-std::array<float,2>{0.59226352f, 0.984369278f},
-std::array<float,2>{0.91882056f, 0.0809372514f},
-std::array<float,2>{0.114450455f, 0.621001184f},
-std::array<float,2>{0.427798778f, 0.000216961897f},
-std::array<float,2>{0.736446321f, 0.554991782f},
-std::array<float,2>{0.794890225f, 0.346847683f},
-std::array<float,2>{0.182153732f, 0.897826195f},
-std::array<float,2>{0.0309812166f, 0.448584586f},
-std::array<float,2>{0.956910372f, 0.789620996f},
-std::array<float,2>{0.531551778f, 0.223084554f},
-std::array<float,2>{0.319553941f, 0.62925446f},
-std::array<float,2>{0.0745265409f, 0.12238089f},
-std::array<float,2>{0.901268721f, 0.576574862f},
-std::array<float,2>{0.618309677f, 0.310246557f},
-std::array<float,2>{0.286871612f, 0.943646669f},
-std::array<float,2>{0.498891503f, 0.409368694f},
-std::array<float,2>{0.660554528f, 0.822838366f},
-std::array<float,2>{0.870363414f, 0.148447827f},
-std::array<float,2>{0.219638988f, 0.705413342f},
-std::array<float,2>{0.360136211f, 0.188420042f},
-std::array<float,2>{0.505223572f, 0.678804457f},
-std::array<float,2>{0.974537373f, 0.48658067f},
-std::array<float,2>{0.0375875235f, 0.761010468f},
-std::array<float,2>{0.149268627f, 0.320524782f},
-std::array<float,2>{0.774409771f, 0.907626271f},
-std::array<float,2>{0.699279606f, 0.0513952486f},
-std::array<float,2>{0.400341511f, 0.528016925f},
-std::array<float,2>{0.121579528f, 0.14135097f},
-std::array<float,2>{0.913093567f, 0.718405724f},
-std::array<float,2>{0.582210064f, 0.415709317f},
-std::array<float,2>{0.25195393f, 0.817902267f},
-std::array<float,2>{0.465606123f, 0.300093889f},
-std::array<float,2>{0.651019871f, 0.951494455f},
-std::array<float,2>{0.84043479f, 0.112029798f},
-std::array<float,2>{0.187860087f, 0.565735281f},
-std::array<float,2>{0.324798882f, 0.0550401062f},
-std::array<float,2>{0.542089641f, 0.521150887f},
-std::array<float,2>{0.967187643f, 0.320068389f},
-std::array<float,2>{0.0225535184f, 0.917255461f},
-std::array<float,2>{0.173520342f, 0.498364896f},
-std::array<float,2>{0.787643254f, 0.755730271f},
-std::array<float,2>{0.748348117f, 0.202226833f},
-std::array<float,2>{0.434965074f, 0.687361896f},
-std::array<float,2>{0.234244496f, 0.0923434198f},
-std::array<float,2>{0.863146961f, 0.613226295f},
-std::array<float,2>{0.670079052f, 0.25791952f},
-std::array<float,2>{0.486375362f, 0.970434487f},
-std::array<float,2>{0.292043298f, 0.393161297f},
-std::array<float,2>{0.612878799f, 0.848229051f},
-std::array<float,2>{0.896107972f, 0.172695532f},
-std::array<float,2>{0.0665969774f, 0.725510895f},
-std::array<float,2>{0.394752264f, 0.230229005f},
-std::array<float,2>{0.687989891f, 0.634469032f},
-std::array<float,2>{0.767334223f, 0.441427797f},
-std::array<float,2>{0.141889855f, 0.78499645f},
-std::array<float,2>{0.0455555841f, 0.356333464f},
-std::array<float,2>{0.983411193f, 0.902793348f},
-std::array<float,2>{0.514160395f, 0.0138599025f},
-std::array<float,2>{0.36942625f, 0.551369309f},
-std::array<float,2>{0.129158705f, 0.216318607f},
-std::array<float,2>{0.757472932f, 0.670423806f},
-std::array<float,2>{0.710425496f, 0.472841263f},
-std::array<float,2>{0.375542402f, 0.767469406f},
-std::array<float,2>{0.353710145f, 0.340361327f},
-std::array<float,2>{0.51801312f, 0.924732327f},
-std::array<float,2>{0.986371756f, 0.0381680243f},
-std::array<float,2>{0.0557313077f, 0.508646131f},
-std::array<float,2>{0.479553461f, 0.108629942f},
-std::array<float,2>{0.673822463f, 0.5815534f},
-std::array<float,2>{0.8475191f, 0.292504638f},
-std::array<float,2>{0.247889057f, 0.959727824f},
-std::array<float,2>{0.0815875158f, 0.43340525f},
-std::array<float,2>{0.879654467f, 0.828501403f},
-std::array<float,2>{0.596133888f, 0.139271513f},
-std::array<float,2>{0.309877157f, 0.700903237f},
-std::array<float,2>{0.00233050762f, 0.0184310284f},
-std::array<float,2>{0.941186607f, 0.544210911f},
-std::array<float,2>{0.554606855f, 0.367898405f},
-std::array<float,2>{0.3371647f, 0.887464523f},
-std::array<float,2>{0.414320022f, 0.456285f},
-std::array<float,2>{0.720849812f, 0.801801682f},
-std::array<float,2>{0.811559916f, 0.235529676f},
-std::array<float,2>{0.162887558f, 0.645389855f},
-std::array<float,2>{0.266994178f, 0.169293553f},
-std::array<float,2>{0.572709382f, 0.744838476f},
-std::array<float,2>{0.927586615f, 0.380979478f},
-std::array<float,2>{0.0953531414f, 0.868279874f},
-std::array<float,2>{0.206172824f, 0.273423642f},
-std::array<float,2>{0.826896131f, 0.991261423f},
-std::array<float,2>{0.639853716f, 0.0681013986f},
-std::array<float,2>{0.451505572f, 0.603305757f},
-std::array<float,2>{0.0730425566f, 0.240800142f},
-std::array<float,2>{0.90572983f, 0.642157912f},
-std::array<float,2>{0.623035133f, 0.457385421f},
-std::array<float,2>{0.281464309f, 0.800492227f},
-std::array<float,2>{0.49293533f, 0.372098625f},
-std::array<float,2>{0.656850517f, 0.882994413f},
-std::array<float,2>{0.872299016f, 0.0212971009f},
-std::array<float,2>{0.223628566f, 0.540218353f},
-std::array<float,2>{0.363739133f, 0.0637105405f},
-std::array<float,2>{0.502007425f, 0.605730295f},
-std::array<float,2>{0.969698131f, 0.267419279f},
-std::array<float,2>{0.0331530608f, 0.987405837f},
-std::array<float,2>{0.152566403f, 0.378056169f},
-std::array<float,2>{0.7777403f, 0.874890268f},
-std::array<float,2>{0.697779477f, 0.16471149f},
-std::array<float,2>{0.405853689f, 0.747202873f},
-std::array<float,2>{0.196110666f, 0.0315712243f},
-std::array<float,2>{0.834999979f, 0.511748374f},
-std::array<float,2>{0.644538701f, 0.339391053f},
-std::array<float,2>{0.453549415f, 0.926150024f},
-std::array<float,2>{0.26190713f, 0.470453113f},
-std::array<float,2>{0.586705387f, 0.77293855f},
-std::array<float,2>{0.914727926f, 0.211555585f},
-std::array<float,2>{0.109609202f, 0.667884469f},
-std::array<float,2>{0.422933251f, 0.135062948f},
-std::array<float,2>{0.740589917f, 0.698819458f},
-std::array<float,2>{0.789149582f, 0.433796823f},
-std::array<float,2>{0.186819077f, 0.832096398f},
-std::array<float,2>{0.0253729355f, 0.295301169f},
-std::array<float,2>{0.957692683f, 0.954990983f},
-std::array<float,2>{0.535343647f, 0.104193263f},
-std::array<float,2>{0.313055754f, 0.583588898f},
-std::array<float,2>{0.164243996f, 0.177337304f},
-std::array<float,2>{0.797031283f, 0.721218884f},
-std::array<float,2>{0.732032776f, 0.395245254f},
-std::array<float,2>{0.406677157f, 0.846731961f},
-std::array<float,2>{0.334026724f, 0.26423341f},
-std::array<float,2>{0.559991598f, 0.973752439f},
-std::array<float,2>{0.950253189f, 0.0893878937f},
-std::array<float,2>{0.00832088385f, 0.615935743f},
-std::array<float,2>{0.440357327f, 0.00983595941f},
-std::array<float,2>{0.629272521f, 0.550758243f},
-std::array<float,2>{0.817446411f, 0.355223894f},
-std::array<float,2>{0.217766911f, 0.898889244f},
-std::array<float,2>{0.103073336f, 0.441388816f},
-std::array<float,2>{0.931456208f, 0.786482871f},
-std::array<float,2>{0.569775105f, 0.2332232f},
-std::array<float,2>{0.279301614f, 0.637240231f},
-std::array<float,2>{0.0528730564f, 0.113777585f},
-std::array<float,2>{0.999333084f, 0.56673497f},
-std::array<float,2>{0.527095079f, 0.301434755f},
-std::array<float,2>{0.343907714f, 0.946291447f},
-std::array<float,2>{0.384125054f, 0.41986388f},
-std::array<float,2>{0.715844035f, 0.813847184f},
-std::array<float,2>{0.759244323f, 0.144946814f},
-std::array<float,2>{0.133769035f, 0.711346805f},
-std::array<float,2>{0.299568176f, 0.195354998f},
-std::array<float,2>{0.606151342f, 0.68024224f},
-std::array<float,2>{0.88292551f, 0.492473781f},
-std::array<float,2>{0.0895048529f, 0.753678203f},
-std::array<float,2>{0.236696079f, 0.314418972f},
-std::array<float,2>{0.858305156f, 0.918168247f},
-std::array<float,2>{0.686354995f, 0.0620600469f},
-std::array<float,2>{0.471544206f, 0.515895903f},
-std::array<float,2>{0.00566554535f, 0.154673323f},
-std::array<float,2>{0.942470253f, 0.708157837f},
-std::array<float,2>{0.548111737f, 0.412188768f},
-std::array<float,2>{0.340715289f, 0.827805161f},
-std::array<float,2>{0.419657618f, 0.306658447f},
-std::array<float,2>{0.722774863f, 0.939870775f},
-std::array<float,2>{0.806713879f, 0.119930468f},
-std::array<float,2>{0.158750251f, 0.570830464f},
-std::array<float,2>{0.271042287f, 0.0500781164f},
-std::array<float,2>{0.578074992f, 0.525672615f},
-std::array<float,2>{0.922242165f, 0.325829118f},
-std::array<float,2>{0.100098729f, 0.912763655f},
-std::array<float,2>{0.207681462f, 0.490643799f},
-std::array<float,2>{0.820625305f, 0.764619887f},
-std::array<float,2>{0.633746564f, 0.193738863f},
-std::array<float,2>{0.449115425f, 0.674409807f},
-std::array<float,2>{0.127851501f, 0.0857530907f},
-std::array<float,2>{0.751358867f, 0.624000072f},
-std::array<float,2>{0.705216408f, 0.254626751f},
-std::array<float,2>{0.380905032f, 0.978144825f},
-std::array<float,2>{0.356250554f, 0.405835539f},
-std::array<float,2>{0.522111118f, 0.85188055f},
-std::array<float,2>{0.990594566f, 0.184224904f},
-std::array<float,2>{0.0600862205f, 0.726812959f},
-std::array<float,2>{0.481134176f, 0.22247234f},
-std::array<float,2>{0.678796649f, 0.628414035f},
-std::array<float,2>{0.850983858f, 0.452541471f},
-std::array<float,2>{0.244251028f, 0.793548226f},
-std::array<float,2>{0.0842760205f, 0.348842293f},
-std::array<float,2>{0.875447631f, 0.891503334f},
-std::array<float,2>{0.599843025f, 0.00476426119f},
-std::array<float,2>{0.306511074f, 0.560400188f},
-std::array<float,2>{0.226830021f, 0.208735183f},
-std::array<float,2>{0.864426255f, 0.663481474f},
-std::array<float,2>{0.666783452f, 0.478460133f},
-std::array<float,2>{0.488657922f, 0.775175631f},
-std::array<float,2>{0.29522571f, 0.332673132f},
-std::array<float,2>{0.614356339f, 0.936980844f},
-std::array<float,2>{0.892636478f, 0.0424056165f},
-std::array<float,2>{0.0634326264f, 0.500633478f},
-std::array<float,2>{0.39103201f, 0.095040381f},
-std::array<float,2>{0.694442749f, 0.591048419f},
-std::array<float,2>{0.77232939f, 0.282693893f},
-std::array<float,2>{0.145440355f, 0.965014458f},
-std::array<float,2>{0.0421571136f, 0.42818597f},
-std::array<float,2>{0.980124593f, 0.840890288f},
-std::array<float,2>{0.510625899f, 0.12557821f},
-std::array<float,2>{0.372474819f, 0.693408132f},
-std::array<float,2>{0.120251246f, 0.0307020601f},
-std::array<float,2>{0.906729519f, 0.536099613f},
-std::array<float,2>{0.581252635f, 0.365934789f},
-std::array<float,2>{0.256149322f, 0.876495183f},
-std::array<float,2>{0.46361056f, 0.468506843f},
-std::array<float,2>{0.654269874f, 0.80488205f},
-std::array<float,2>{0.837838352f, 0.246056527f},
-std::array<float,2>{0.195158273f, 0.651728928f},
-std::array<float,2>{0.323848158f, 0.161584392f},
-std::array<float,2>{0.54626298f, 0.738493383f},
-std::array<float,2>{0.96139586f, 0.388960034f},
-std::array<float,2>{0.018176375f, 0.859696329f},
-std::array<float,2>{0.179306492f, 0.280952871f},
-std::array<float,2>{0.782779098f, 0.998205185f},
-std::array<float,2>{0.744110465f, 0.0762837008f},
-std::array<float,2>{0.43025592f, 0.59861207f},
-std::array<float,2>{0.0383743979f, 0.190009117f},
-std::array<float,2>{0.973578334f, 0.676365316f},
-std::array<float,2>{0.504652202f, 0.48441869f},
-std::array<float,2>{0.360537142f, 0.75814718f},
-std::array<float,2>{0.399083823f, 0.322476596f},
-std::array<float,2>{0.700875103f, 0.908457637f},
-std::array<float,2>{0.774915159f, 0.054252699f},
-std::array<float,2>{0.150255859f, 0.531096637f},
-std::array<float,2>{0.285496771f, 0.123176426f},
-std::array<float,2>{0.617356241f, 0.575299025f},
-std::array<float,2>{0.901760221f, 0.312460601f},
-std::array<float,2>{0.0757884234f, 0.941776752f},
-std::array<float,2>{0.220001414f, 0.406818837f},
-std::array<float,2>{0.86975342f, 0.822003543f},
-std::array<float,2>{0.661691844f, 0.152114719f},
-std::array<float,2>{0.499966174f, 0.704060256f},
-std::array<float,2>{0.182738557f, 0.00308426027f},
-std::array<float,2>{0.793648899f, 0.557495594f},
-std::array<float,2>{0.738040924f, 0.345673651f},
-std::array<float,2>{0.428757757f, 0.89639163f},
-std::array<float,2>{0.318982601f, 0.446556419f},
-std::array<float,2>{0.533066332f, 0.792547762f},
-std::array<float,2>{0.95598495f, 0.225089043f},
-std::array<float,2>{0.0297820363f, 0.63236928f},
-std::array<float,2>{0.457187742f, 0.182600096f},
-std::array<float,2>{0.642628193f, 0.730784655f},
-std::array<float,2>{0.830625355f, 0.401681364f},
-std::array<float,2>{0.202122018f, 0.856925726f},
-std::array<float,2>{0.113285452f, 0.253064424f},
-std::array<float,2>{0.919085562f, 0.982336521f},
-std::array<float,2>{0.593231857f, 0.0791807845f},
-std::array<float,2>{0.259183943f, 0.617191255f},
-std::array<float,2>{0.212317184f, 0.129434153f},
-std::array<float,2>{0.812735915f, 0.687767386f},
-std::array<float,2>{0.626466393f, 0.423425734f},
-std::array<float,2>{0.443791151f, 0.836371183f},
-std::array<float,2>{0.274566144f, 0.287834078f},
-std::array<float,2>{0.56587714f, 0.964471042f},
-std::array<float,2>{0.934556723f, 0.0994131044f},
-std::array<float,2>{0.107050955f, 0.589673042f},
-std::array<float,2>{0.410994768f, 0.0446032695f},
-std::array<float,2>{0.729132533f, 0.505632639f},
-std::array<float,2>{0.803834498f, 0.330355674f},
-std::array<float,2>{0.168756425f, 0.929701626f},
-std::array<float,2>{0.0152049549f, 0.481975675f},
-std::array<float,2>{0.945798874f, 0.778241038f},
-std::array<float,2>{0.555027485f, 0.204525605f},
-std::array<float,2>{0.328403324f, 0.656769753f},
-std::array<float,2>{0.0918359533f, 0.0728299767f},
-std::array<float,2>{0.887149274f, 0.593838692f},
-std::array<float,2>{0.603794754f, 0.276875377f},
-std::array<float,2>{0.301013857f, 0.992922723f},
-std::array<float,2>{0.473753572f, 0.384496689f},
-std::array<float,2>{0.683525801f, 0.863789558f},
-std::array<float,2>{0.85425812f, 0.157207489f},
-std::array<float,2>{0.240828678f, 0.738124549f},
-std::array<float,2>{0.350856841f, 0.247977152f},
-std::array<float,2>{0.528618693f, 0.653339565f},
-std::array<float,2>{0.992956042f, 0.464040041f},
-std::array<float,2>{0.0487487167f, 0.808880329f},
-std::array<float,2>{0.137713656f, 0.360288292f},
-std::array<float,2>{0.763446093f, 0.880091012f},
-std::array<float,2>{0.714532375f, 0.0253360011f},
-std::array<float,2>{0.387263536f, 0.532938421f},
-std::array<float,2>{0.093864806f, 0.170390531f},
-std::array<float,2>{0.926676154f, 0.74320215f},
-std::array<float,2>{0.574139357f, 0.379760057f},
-std::array<float,2>{0.265724361f, 0.86931622f},
-std::array<float,2>{0.45220831f, 0.269659996f},
-std::array<float,2>{0.638848424f, 0.988452792f},
-std::array<float,2>{0.827897668f, 0.0684934929f},
-std::array<float,2>{0.205595493f, 0.603816509f},
-std::array<float,2>{0.336595744f, 0.017334599f},
-std::array<float,2>{0.553678095f, 0.546101511f},
-std::array<float,2>{0.940090001f, 0.370943457f},
-std::array<float,2>{0.00381037756f, 0.888857484f},
-std::array<float,2>{0.163378686f, 0.454706728f},
-std::array<float,2>{0.811175108f, 0.804632962f},
-std::array<float,2>{0.721815586f, 0.236513242f},
-std::array<float,2>{0.41592893f, 0.64754653f},
-std::array<float,2>{0.246675581f, 0.106163837f},
-std::array<float,2>{0.846447229f, 0.579149604f},
-std::array<float,2>{0.672769189f, 0.289383352f},
-std::array<float,2>{0.479319692f, 0.958157301f},
-std::array<float,2>{0.308960885f, 0.430957168f},
-std::array<float,2>{0.596796572f, 0.83179754f},
-std::array<float,2>{0.879955888f, 0.136918575f},
-std::array<float,2>{0.0804433897f, 0.702449322f},
-std::array<float,2>{0.376189262f, 0.217730269f},
-std::array<float,2>{0.708988547f, 0.66896528f},
-std::array<float,2>{0.756716311f, 0.475710034f},
-std::array<float,2>{0.130540803f, 0.768262744f},
-std::array<float,2>{0.0548597388f, 0.34266004f},
-std::array<float,2>{0.987421334f, 0.923236012f},
-std::array<float,2>{0.519293785f, 0.0368138961f},
-std::array<float,2>{0.355402201f, 0.510629177f},
-std::array<float,2>{0.140915006f, 0.227662206f},
-std::array<float,2>{0.765773654f, 0.635085225f},
-std::array<float,2>{0.688627839f, 0.444214255f},
-std::array<float,2>{0.395688772f, 0.782268107f},
-std::array<float,2>{0.371081471f, 0.357826889f},
-std::array<float,2>{0.514967203f, 0.906205177f},
-std::array<float,2>{0.98325938f, 0.0118201748f},
-std::array<float,2>{0.0465515703f, 0.552980483f},
-std::array<float,2>{0.487501502f, 0.0914515853f},
-std::array<float,2>{0.671253741f, 0.610177279f},
-std::array<float,2>{0.862283707f, 0.260683864f},
-std::array<float,2>{0.232877791f, 0.972461879f},
-std::array<float,2>{0.0679879412f, 0.391480267f},
-std::array<float,2>{0.895372212f, 0.851012468f},
-std::array<float,2>{0.612008572f, 0.174778551f},
-std::array<float,2>{0.291892946f, 0.724319279f},
-std::array<float,2>{0.0217997767f, 0.0570875928f},
-std::array<float,2>{0.96859467f, 0.521591425f},
-std::array<float,2>{0.541491926f, 0.318059087f},
-std::array<float,2>{0.326125026f, 0.914437532f},
-std::array<float,2>{0.433784425f, 0.497276127f},
-std::array<float,2>{0.749422669f, 0.757469893f},
-std::array<float,2>{0.788563967f, 0.199781522f},
-std::array<float,2>{0.171977684f, 0.68379128f},
-std::array<float,2>{0.253725439f, 0.143475473f},
-std::array<float,2>{0.583857834f, 0.715850651f},
-std::array<float,2>{0.913054764f, 0.41659528f},
-std::array<float,2>{0.1228581f, 0.819887698f},
-std::array<float,2>{0.188727215f, 0.298586428f},
-std::array<float,2>{0.841091454f, 0.950077116f},
-std::array<float,2>{0.651858926f, 0.110330611f},
-std::array<float,2>{0.466510266f, 0.563185513f},
-std::array<float,2>{0.113210119f, 0.214714915f},
-std::array<float,2>{0.917853355f, 0.664794266f},
-std::array<float,2>{0.589043498f, 0.472574443f},
-std::array<float,2>{0.264888048f, 0.770464301f},
-std::array<float,2>{0.456445694f, 0.335974097f},
-std::array<float,2>{0.64684397f, 0.928241491f},
-std::array<float,2>{0.832700849f, 0.0341402069f},
-std::array<float,2>{0.197713658f, 0.515181124f},
-std::array<float,2>{0.315615207f, 0.103023641f},
-std::array<float,2>{0.53833127f, 0.584124923f},
-std::array<float,2>{0.959002197f, 0.294614106f},
-std::array<float,2>{0.0258592032f, 0.956073463f},
-std::array<float,2>{0.18468526f, 0.435841769f},
-std::array<float,2>{0.792756796f, 0.834370792f},
-std::array<float,2>{0.740212619f, 0.132864863f},
-std::array<float,2>{0.425322056f, 0.696148992f},
-std::array<float,2>{0.225050345f, 0.021491779f},
-std::array<float,2>{0.874378085f, 0.541369736f},
-std::array<float,2>{0.659850955f, 0.373084128f},
-std::array<float,2>{0.495685279f, 0.885523379f},
-std::array<float,2>{0.284807354f, 0.459474415f},
-std::array<float,2>{0.623517096f, 0.798826694f},
-std::array<float,2>{0.904198825f, 0.238650516f},
-std::array<float,2>{0.071593985f, 0.644207895f},
-std::array<float,2>{0.402528346f, 0.167714521f},
-std::array<float,2>{0.695928514f, 0.748722553f},
-std::array<float,2>{0.780474305f, 0.375248551f},
-std::array<float,2>{0.155317232f, 0.871804476f},
-std::array<float,2>{0.035108678f, 0.268372357f},
-std::array<float,2>{0.971074164f, 0.985886455f},
-std::array<float,2>{0.501723707f, 0.0659672096f},
-std::array<float,2>{0.365674257f, 0.608641982f},
-std::array<float,2>{0.135011852f, 0.147591516f},
-std::array<float,2>{0.761081934f, 0.714337111f},
-std::array<float,2>{0.716931581f, 0.420422107f},
-std::array<float,2>{0.384849161f, 0.815768242f},
-std::array<float,2>{0.346932024f, 0.304080069f},
-std::array<float,2>{0.524206161f, 0.948441088f},
-std::array<float,2>{0.997384429f, 0.116281174f},
-std::array<float,2>{0.0514266379f, 0.569195747f},
-std::array<float,2>{0.470323145f, 0.0599243753f},
-std::array<float,2>{0.68491894f, 0.518548071f},
-std::array<float,2>{0.856020331f, 0.315962881f},
-std::array<float,2>{0.23582606f, 0.920337856f},
-std::array<float,2>{0.0864865258f, 0.495829463f},
-std::array<float,2>{0.886220217f, 0.750558913f},
-std::array<float,2>{0.609025478f, 0.19834882f},
-std::array<float,2>{0.297209084f, 0.682905316f},
-std::array<float,2>{0.0101031037f, 0.0866763666f},
-std::array<float,2>{0.95168376f, 0.614340067f},
-std::array<float,2>{0.560828745f, 0.261852801f},
-std::array<float,2>{0.332884699f, 0.976362288f},
-std::array<float,2>{0.410094798f, 0.398060471f},
-std::array<float,2>{0.733037591f, 0.845488191f},
-std::array<float,2>{0.799673676f, 0.178637311f},
-std::array<float,2>{0.167720079f, 0.720647633f},
-std::array<float,2>{0.278203547f, 0.231244639f},
-std::array<float,2>{0.566684425f, 0.640129864f},
-std::array<float,2>{0.932129025f, 0.438332736f},
-std::array<float,2>{0.104366362f, 0.788833141f},
-std::array<float,2>{0.214892313f, 0.352542311f},
-std::array<float,2>{0.818955421f, 0.901881516f},
-std::array<float,2>{0.632659018f, 0.00883254874f},
-std::array<float,2>{0.438790619f, 0.547416627f},
-std::array<float,2>{0.0622941293f, 0.185624763f},
-std::array<float,2>{0.988750994f, 0.72915405f},
-std::array<float,2>{0.519768119f, 0.402354419f},
-std::array<float,2>{0.359276116f, 0.855407596f},
-std::array<float,2>{0.38000837f, 0.256209522f},
-std::array<float,2>{0.703877807f, 0.979815662f},
-std::array<float,2>{0.75298655f, 0.0839661285f},
-std::array<float,2>{0.126690894f, 0.621827304f},
-std::array<float,2>{0.308321148f, 0.00640810328f},
-std::array<float,2>{0.599240005f, 0.561208367f},
-std::array<float,2>{0.877363443f, 0.351186246f},
-std::array<float,2>{0.0822251812f, 0.893451214f},
-std::array<float,2>{0.242582664f, 0.451010138f},
-std::array<float,2>{0.848324776f, 0.794985056f},
-std::array<float,2>{0.676292717f, 0.219879642f},
-std::array<float,2>{0.483795285f, 0.625273705f},
-std::array<float,2>{0.156722859f, 0.118220642f},
-std::array<float,2>{0.805220842f, 0.573292494f},
-std::array<float,2>{0.7257002f, 0.306060046f},
-std::array<float,2>{0.420835853f, 0.93887794f},
-std::array<float,2>{0.341850728f, 0.410812587f},
-std::array<float,2>{0.550264299f, 0.824902296f},
-std::array<float,2>{0.944192052f, 0.154122233f},
-std::array<float,2>{0.00718860002f, 0.709205568f},
-std::array<float,2>{0.446409374f, 0.192947105f},
-std::array<float,2>{0.635312974f, 0.673254788f},
-std::array<float,2>{0.823448658f, 0.489405096f},
-std::array<float,2>{0.210174665f, 0.763073921f},
-std::array<float,2>{0.0990105569f, 0.32711333f},
-std::array<float,2>{0.924899817f, 0.910650194f},
-std::array<float,2>{0.575874329f, 0.0481291711f},
-std::array<float,2>{0.271503568f, 0.523833036f},
-std::array<float,2>{0.19205156f, 0.243063167f},
-std::array<float,2>{0.839302838f, 0.648864329f},
-std::array<float,2>{0.654588759f, 0.465699881f},
-std::array<float,2>{0.461795539f, 0.807163954f},
-std::array<float,2>{0.254594713f, 0.363845736f},
-std::array<float,2>{0.57964009f, 0.877414405f},
-std::array<float,2>{0.909288764f, 0.0292664189f},
-std::array<float,2>{0.117723174f, 0.539016187f},
-std::array<float,2>{0.432367802f, 0.0758726746f},
-std::array<float,2>{0.744277298f, 0.601043344f},
-std::array<float,2>{0.78355068f, 0.27837643f},
-std::array<float,2>{0.177167535f, 0.9979375f},
-std::array<float,2>{0.0168718882f, 0.387505859f},
-std::array<float,2>{0.964470744f, 0.863023162f},
-std::array<float,2>{0.544547617f, 0.163798407f},
-std::array<float,2>{0.320487887f, 0.740861416f},
-std::array<float,2>{0.0657844469f, 0.0392231457f},
-std::array<float,2>{0.891682863f, 0.502995789f},
-std::array<float,2>{0.61704284f, 0.33587724f},
-std::array<float,2>{0.294495493f, 0.934820056f},
-std::array<float,2>{0.491284579f, 0.479760975f},
-std::array<float,2>{0.66459322f, 0.775583088f},
-std::array<float,2>{0.865682304f, 0.210505813f},
-std::array<float,2>{0.229684144f, 0.660498738f},
-std::array<float,2>{0.37351191f, 0.127166539f},
-std::array<float,2>{0.508987546f, 0.69148165f},
-std::array<float,2>{0.977556705f, 0.426466197f},
-std::array<float,2>{0.0401554294f, 0.842644036f},
-std::array<float,2>{0.146574005f, 0.283801705f},
-std::array<float,2>{0.77010119f, 0.966827512f},
-std::array<float,2>{0.693333864f, 0.0974802449f},
-std::array<float,2>{0.394525081f, 0.593262374f},
-std::array<float,2>{0.0289835762f, 0.223882124f},
-std::array<float,2>{0.95369035f, 0.630778253f},
-std::array<float,2>{0.534703076f, 0.447321385f},
-std::array<float,2>{0.318064392f, 0.790819883f},
-std::array<float,2>{0.427731842f, 0.346417546f},
-std::array<float,2>{0.735709965f, 0.896805406f},
-std::array<float,2>{0.79642117f, 0.00100040832f},
-std::array<float,2>{0.18155542f, 0.556140542f},
-std::array<float,2>{0.259817809f, 0.0812283978f},
-std::array<float,2>{0.591032684f, 0.619152367f},
-std::array<float,2>{0.920539498f, 0.251818091f},
-std::array<float,2>{0.116006985f, 0.98305583f},
-std::array<float,2>{0.199774593f, 0.400372654f},
-std::array<float,2>{0.829854548f, 0.858452618f},
-std::array<float,2>{0.642151594f, 0.180616245f},
-std::array<float,2>{0.46092996f, 0.733919442f},
-std::array<float,2>{0.151237458f, 0.0522361174f},
-std::array<float,2>{0.775733411f, 0.52896452f},
-std::array<float,2>{0.701778233f, 0.3218548f},
-std::array<float,2>{0.40097025f, 0.906556726f},
-std::array<float,2>{0.361978233f, 0.487546027f},
-std::array<float,2>{0.506393969f, 0.759799659f},
-std::array<float,2>{0.975517094f, 0.189073026f},
-std::array<float,2>{0.0354488008f, 0.678101003f},
-std::array<float,2>{0.496145874f, 0.149952486f},
-std::array<float,2>{0.663472891f, 0.706136644f},
-std::array<float,2>{0.867402673f, 0.408608168f},
-std::array<float,2>{0.221903726f, 0.8232916f},
-std::array<float,2>{0.0767265186f, 0.308791637f},
-std::array<float,2>{0.900161922f, 0.944665134f},
-std::array<float,2>{0.621065557f, 0.122037128f},
-std::array<float,2>{0.287138283f, 0.577506244f},
-std::array<float,2>{0.239122391f, 0.158305645f},
-std::array<float,2>{0.853291988f, 0.735199392f},
-std::array<float,2>{0.681266189f, 0.385055542f},
-std::array<float,2>{0.476348579f, 0.865577757f},
-std::array<float,2>{0.304677039f, 0.274026662f},
-std::array<float,2>{0.602475524f, 0.995215833f},
-std::array<float,2>{0.889634788f, 0.0712578744f},
-std::array<float,2>{0.090263851f, 0.596690655f},
-std::array<float,2>{0.390052587f, 0.0270268396f},
-std::array<float,2>{0.711308241f, 0.534514546f},
-std::array<float,2>{0.765150607f, 0.362894714f},
-std::array<float,2>{0.139032856f, 0.881625712f},
-std::array<float,2>{0.0493839271f, 0.461549908f},
-std::array<float,2>{0.996070147f, 0.81192708f},
-std::array<float,2>{0.529869378f, 0.249867082f},
-std::array<float,2>{0.348916233f, 0.654871821f},
-std::array<float,2>{0.107485205f, 0.100085735f},
-std::array<float,2>{0.935851038f, 0.587461114f},
-std::array<float,2>{0.563175678f, 0.286858141f},
-std::array<float,2>{0.276757538f, 0.962743342f},
-std::array<float,2>{0.441497266f, 0.423926353f},
-std::array<float,2>{0.628661931f, 0.83957088f},
-std::array<float,2>{0.81516099f, 0.131673798f},
-std::array<float,2>{0.21326147f, 0.690364182f},
-std::array<float,2>{0.330575585f, 0.205353618f},
-std::array<float,2>{0.558207214f, 0.659292758f},
-std::array<float,2>{0.947969735f, 0.483830512f},
-std::array<float,2>{0.0136632565f, 0.779358566f},
-std::array<float,2>{0.171838999f, 0.328651786f},
-std::array<float,2>{0.800809145f, 0.932604551f},
-std::array<float,2>{0.728459179f, 0.0463119633f},
-std::array<float,2>{0.413513988f, 0.507273078f},
-std::array<float,2>{0.0792601407f, 0.140125707f},
-std::array<float,2>{0.881794274f, 0.699815631f},
-std::array<float,2>{0.593961537f, 0.431993484f},
-std::array<float,2>{0.310967386f, 0.829551518f},
-std::array<float,2>{0.478142798f, 0.291266471f},
-std::array<float,2>{0.674744785f, 0.960557401f},
-std::array<float,2>{0.84555459f, 0.108227648f},
-std::array<float,2>{0.248660088f, 0.580267191f},
-std::array<float,2>{0.351917028f, 0.0376295075f},
-std::array<float,2>{0.517216802f, 0.509301066f},
-std::array<float,2>{0.98492831f, 0.341676921f},
-std::array<float,2>{0.0577586517f, 0.925296962f},
-std::array<float,2>{0.132409558f, 0.474302024f},
-std::array<float,2>{0.754269838f, 0.765902281f},
-std::array<float,2>{0.708203673f, 0.215070903f},
-std::array<float,2>{0.377072632f, 0.670980394f},
-std::array<float,2>{0.204145864f, 0.0673800632f},
-std::array<float,2>{0.825933814f, 0.601947129f},
-std::array<float,2>{0.638655186f, 0.271882266f},
-std::array<float,2>{0.450539291f, 0.990857601f},
-std::array<float,2>{0.268593639f, 0.382023394f},
-std::array<float,2>{0.571696997f, 0.867507696f},
-std::array<float,2>{0.928927898f, 0.168737829f},
-std::array<float,2>{0.097338289f, 0.745954335f},
-std::array<float,2>{0.417167038f, 0.234891877f},
-std::array<float,2>{0.719780624f, 0.645884395f},
-std::array<float,2>{0.810358346f, 0.455952376f},
-std::array<float,2>{0.160932198f, 0.801072121f},
-std::array<float,2>{0.00194064563f, 0.368455887f},
-std::array<float,2>{0.938731968f, 0.887825727f},
-std::array<float,2>{0.551730096f, 0.0191445686f},
-std::array<float,2>{0.339380145f, 0.543204725f},
-std::array<float,2>{0.175265431f, 0.201436982f},
-std::array<float,2>{0.785829425f, 0.686366022f},
-std::array<float,2>{0.746176422f, 0.499419868f},
-std::array<float,2>{0.436656594f, 0.754361868f},
-std::array<float,2>{0.327763706f, 0.319206208f},
-std::array<float,2>{0.540921807f, 0.916968346f},
-std::array<float,2>{0.965701103f, 0.0559130609f},
-std::array<float,2>{0.0214168373f, 0.519951046f},
-std::array<float,2>{0.467355609f, 0.113033727f},
-std::array<float,2>{0.648957431f, 0.565223634f},
-std::array<float,2>{0.842428327f, 0.298998833f},
-std::array<float,2>{0.191195309f, 0.952208042f},
-std::array<float,2>{0.12307176f, 0.415014684f},
-std::array<float,2>{0.911650002f, 0.816968918f},
-std::array<float,2>{0.585931599f, 0.141830429f},
-std::array<float,2>{0.250064045f, 0.716959119f},
-std::array<float,2>{0.0433044545f, 0.0152373062f},
-std::array<float,2>{0.981895566f, 0.55257231f},
-std::array<float,2>{0.513080239f, 0.357242525f},
-std::array<float,2>{0.367818683f, 0.903737843f},
-std::array<float,2>{0.396860808f, 0.442949235f},
-std::array<float,2>{0.689681232f, 0.783760548f},
-std::array<float,2>{0.768141687f, 0.22854428f},
-std::array<float,2>{0.142785504f, 0.633204579f},
-std::array<float,2>{0.289118677f, 0.173527539f},
-std::array<float,2>{0.60964793f, 0.726024091f},
-std::array<float,2>{0.89838928f, 0.394047707f},
-std::array<float,2>{0.0685636476f, 0.849359035f},
-std::array<float,2>{0.231721848f, 0.259420216f},
-std::array<float,2>{0.860697448f, 0.969303191f},
-std::array<float,2>{0.668036759f, 0.0931656137f},
-std::array<float,2>{0.4846313f, 0.61204499f},
-std::array<float,2>{0.096519731f, 0.236791492f},
-std::array<float,2>{0.928408086f, 0.647769094f},
-std::array<float,2>{0.571241379f, 0.454949141f},
-std::array<float,2>{0.268267244f, 0.80425024f},
-std::array<float,2>{0.449379206f, 0.37064454f},
-std::array<float,2>{0.637233138f, 0.888991296f},
-std::array<float,2>{0.824615538f, 0.0171272736f},
-std::array<float,2>{0.203278586f, 0.546334982f},
-std::array<float,2>{0.338039726f, 0.0687659383f},
-std::array<float,2>{0.552115321f, 0.603731096f},
-std::array<float,2>{0.937807322f, 0.269996345f},
-std::array<float,2>{1.37619227e-05f, 0.988749444f},
-std::array<float,2>{0.162100822f, 0.379567355f},
-std::array<float,2>{0.809503376f, 0.869590104f},
-std::array<float,2>{0.719315648f, 0.170146659f},
-std::array<float,2>{0.416621119f, 0.743426681f},
-std::array<float,2>{0.249982983f, 0.0369917639f},
-std::array<float,2>{0.844366968f, 0.510367632f},
-std::array<float,2>{0.675299466f, 0.342393577f},
-std::array<float,2>{0.477046221f, 0.923055768f},
-std::array<float,2>{0.312008381f, 0.475974888f},
-std::array<float,2>{0.594892681f, 0.768340766f},
-std::array<float,2>{0.882634819f, 0.217417061f},
-std::array<float,2>{0.0785971507f, 0.669429541f},
-std::array<float,2>{0.3789002f, 0.137067989f},
-std::array<float,2>{0.707274973f, 0.702294767f},
-std::array<float,2>{0.755367815f, 0.430869967f},
-std::array<float,2>{0.131657243f, 0.831583858f},
-std::array<float,2>{0.057608787f, 0.28910467f},
-std::array<float,2>{0.986103177f, 0.958290458f},
-std::array<float,2>{0.515659034f, 0.106437132f},
-std::array<float,2>{0.353132963f, 0.579562485f},
-std::array<float,2>{0.144076765f, 0.174447164f},
-std::array<float,2>{0.769472659f, 0.724552751f},
-std::array<float,2>{0.690956116f, 0.391241908f},
-std::array<float,2>{0.398051113f, 0.850725472f},
-std::array<float,2>{0.36900714f, 0.260481477f},
-std::array<float,2>{0.512434959f, 0.972243309f},
-std::array<float,2>{0.980490088f, 0.0916411579f},
-std::array<float,2>{0.0441132672f, 0.609874189f},
-std::array<float,2>{0.485531062f, 0.0121275531f},
-std::array<float,2>{0.669363201f, 0.552976012f},
-std::array<float,2>{0.860127568f, 0.357470185f},
-std::array<float,2>{0.230970383f, 0.905799925f},
-std::array<float,2>{0.0696236715f, 0.443983197f},
-std::array<float,2>{0.897073269f, 0.782707155f},
-std::array<float,2>{0.610659838f, 0.228017852f},
-std::array<float,2>{0.290224224f, 0.634959638f},
-std::array<float,2>{0.0204432178f, 0.109982081f},
-std::array<float,2>{0.96663624f, 0.563461006f},
-std::array<float,2>{0.539578915f, 0.298418015f},
-std::array<float,2>{0.326598287f, 0.949796081f},
-std::array<float,2>{0.435955077f, 0.416835666f},
-std::array<float,2>{0.747547925f, 0.820107758f},
-std::array<float,2>{0.787067413f, 0.143273383f},
-std::array<float,2>{0.174044862f, 0.716229677f},
-std::array<float,2>{0.251040787f, 0.200012133f},
-std::array<float,2>{0.58464694f, 0.683976889f},
-std::array<float,2>{0.910229921f, 0.497558355f},
-std::array<float,2>{0.124224268f, 0.757704973f},
-std::array<float,2>{0.190260842f, 0.318306804f},
-std::array<float,2>{0.84306699f, 0.914094031f},
-std::array<float,2>{0.650287628f, 0.0568757132f},
-std::array<float,2>{0.468081921f, 0.521950722f},
-std::array<float,2>{0.0362794101f, 0.151926488f},
-std::array<float,2>{0.975986063f, 0.703673661f},
-std::array<float,2>{0.506837845f, 0.407118678f},
-std::array<float,2>{0.362352431f, 0.822168708f},
-std::array<float,2>{0.401373327f, 0.312135011f},
-std::array<float,2>{0.702807665f, 0.941533208f},
-std::array<float,2>{0.776966333f, 0.123464517f},
-std::array<float,2>{0.152222037f, 0.575583637f},
-std::array<float,2>{0.288248062f, 0.0545461141f},
-std::array<float,2>{0.61996448f, 0.530851841f},
-std::array<float,2>{0.899111032f, 0.32262677f},
-std::array<float,2>{0.0780412108f, 0.908285141f},
-std::array<float,2>{0.221380755f, 0.484785199f},
-std::array<float,2>{0.868620455f, 0.75796479f},
-std::array<float,2>{0.662271857f, 0.1902522f},
-std::array<float,2>{0.497404099f, 0.676664293f},
-std::array<float,2>{0.179781273f, 0.0794305727f},
-std::array<float,2>{0.79562515f, 0.617559791f},
-std::array<float,2>{0.734724402f, 0.253329426f},
-std::array<float,2>{0.425828844f, 0.982097924f},
-std::array<float,2>{0.31730634f, 0.401421189f},
-std::array<float,2>{0.533376753f, 0.856612325f},
-std::array<float,2>{0.954409122f, 0.182311416f},
-std::array<float,2>{0.0282648746f, 0.730616212f},
-std::array<float,2>{0.459892511f, 0.224707708f},
-std::array<float,2>{0.640765071f, 0.632753313f},
-std::array<float,2>{0.828824699f, 0.446436852f},
-std::array<float,2>{0.200223386f, 0.792761683f},
-std::array<float,2>{0.117163308f, 0.345242709f},
-std::array<float,2>{0.921131849f, 0.896159887f},
-std::array<float,2>{0.590659916f, 0.00339262467f},
-std::array<float,2>{0.261062771f, 0.557274222f},
-std::array<float,2>{0.214801013f, 0.20412612f},
-std::array<float,2>{0.816362739f, 0.657183886f},
-std::array<float,2>{0.627668738f, 0.482313097f},
-std::array<float,2>{0.442558199f, 0.777856648f},
-std::array<float,2>{0.276015222f, 0.330247939f},
-std::array<float,2>{0.563808858f, 0.93016243f},
-std::array<float,2>{0.937265575f, 0.0449006557f},
-std::array<float,2>{0.10908702f, 0.505429506f},
-std::array<float,2>{0.412780493f, 0.0993378609f},
-std::array<float,2>{0.726716459f, 0.589579821f},
-std::array<float,2>{0.802498877f, 0.288027108f},
-std::array<float,2>{0.170740828f, 0.964764476f},
-std::array<float,2>{0.0118261408f, 0.423753172f},
-std::array<float,2>{0.948845744f, 0.836122274f},
-std::array<float,2>{0.556671083f, 0.129683971f},
-std::array<float,2>{0.331226051f, 0.687713861f},
-std::array<float,2>{0.0908306763f, 0.0250299163f},
-std::array<float,2>{0.89032197f, 0.533098936f},
-std::array<float,2>{0.602624714f, 0.359868556f},
-std::array<float,2>{0.303140998f, 0.880182326f},
-std::array<float,2>{0.474680185f, 0.464255154f},
-std::array<float,2>{0.680002272f, 0.808682799f},
-std::array<float,2>{0.851716578f, 0.247774318f},
-std::array<float,2>{0.239487365f, 0.653658926f},
-std::array<float,2>{0.348490179f, 0.156833947f},
-std::array<float,2>{0.53027606f, 0.737931073f},
-std::array<float,2>{0.994640946f, 0.384668201f},
-std::array<float,2>{0.0502907187f, 0.864148796f},
-std::array<float,2>{0.14023602f, 0.277301073f},
-std::array<float,2>{0.764635563f, 0.992840588f},
-std::array<float,2>{0.712502003f, 0.0730853379f},
-std::array<float,2>{0.389373869f, 0.594183147f},
-std::array<float,2>{0.00598094752f, 0.193530247f},
-std::array<float,2>{0.944341183f, 0.674741149f},
-std::array<float,2>{0.549268782f, 0.490307838f},
-std::array<float,2>{0.343115151f, 0.7642138f},
-std::array<float,2>{0.421127796f, 0.32593134f},
-std::array<float,2>{0.725358546f, 0.912921727f},
-std::array<float,2>{0.806524754f, 0.0499427803f},
-std::array<float,2>{0.157669291f, 0.525563717f},
-std::array<float,2>{0.27266705f, 0.119809419f},
-std::array<float,2>{0.574834406f, 0.571092367f},
-std::array<float,2>{0.923861861f, 0.307112485f},
-std::array<float,2>{0.098047711f, 0.939638555f},
-std::array<float,2>{0.209219903f, 0.412545651f},
-std::array<float,2>{0.822866559f, 0.828115404f},
-std::array<float,2>{0.63588953f, 0.154516354f},
-std::array<float,2>{0.445992321f, 0.708387136f},
-std::array<float,2>{0.12574245f, 0.00447421474f},
-std::array<float,2>{0.752200663f, 0.560162008f},
-std::array<float,2>{0.705043137f, 0.349116474f},
-std::array<float,2>{0.379682839f, 0.891135097f},
-std::array<float,2>{0.357875735f, 0.452195585f},
-std::array<float,2>{0.521133006f, 0.793720365f},
-std::array<float,2>{0.989896178f, 0.222228706f},
-std::array<float,2>{0.0611296259f, 0.628049791f},
-std::array<float,2>{0.483144909f, 0.184372693f},
-std::array<float,2>{0.677057445f, 0.726585805f},
-std::array<float,2>{0.849501967f, 0.406249613f},
-std::array<float,2>{0.243907124f, 0.851609588f},
-std::array<float,2>{0.0834181309f, 0.25478974f},
-std::array<float,2>{0.878804803f, 0.97844553f},
-std::array<float,2>{0.598488748f, 0.0856811032f},
-std::array<float,2>{0.307534665f, 0.623667717f},
-std::array<float,2>{0.229402989f, 0.125948235f},
-std::array<float,2>{0.866601825f, 0.693808973f},
-std::array<float,2>{0.665728748f, 0.427917302f},
-std::array<float,2>{0.491123408f, 0.841134489f},
-std::array<float,2>{0.293524414f, 0.28229177f},
-std::array<float,2>{0.615588129f, 0.965191901f},
-std::array<float,2>{0.890763879f, 0.0949520543f},
-std::array<float,2>{0.0650589764f, 0.591265202f},
-std::array<float,2>{0.392971963f, 0.0419997722f},
-std::array<float,2>{0.692343056f, 0.500901699f},
-std::array<float,2>{0.771463931f, 0.33281225f},
-std::array<float,2>{0.147936687f, 0.936557889f},
-std::array<float,2>{0.0398674197f, 0.478146762f},
-std::array<float,2>{0.976587176f, 0.774926126f},
-std::array<float,2>{0.508453488f, 0.208954051f},
-std::array<float,2>{0.374963522f, 0.66315484f},
-std::array<float,2>{0.118907735f, 0.076431796f},
-std::array<float,2>{0.90849638f, 0.598301053f},
-std::array<float,2>{0.579028487f, 0.281089485f},
-std::array<float,2>{0.255299032f, 0.998411238f},
-std::array<float,2>{0.462484032f, 0.388819635f},
-std::array<float,2>{0.655383706f, 0.859399498f},
-std::array<float,2>{0.838468015f, 0.161307156f},
-std::array<float,2>{0.193020657f, 0.738729298f},
-std::array<float,2>{0.321401417f, 0.245732993f},
-std::array<float,2>{0.543138802f, 0.651398242f},
-std::array<float,2>{0.963682413f, 0.468488425f},
-std::array<float,2>{0.0156295337f, 0.804933369f},
-std::array<float,2>{0.176318213f, 0.366073549f},
-std::array<float,2>{0.784924388f, 0.876826882f},
-std::array<float,2>{0.745921671f, 0.0304034576f},
-std::array<float,2>{0.432687312f, 0.535750508f},
-std::array<float,2>{0.0709358901f, 0.164962068f},
-std::array<float,2>{0.902914286f, 0.747533321f},
-std::array<float,2>{0.624867558f, 0.378229648f},
-std::array<float,2>{0.283901244f, 0.874718964f},
-std::array<float,2>{0.494800806f, 0.267259985f},
-std::array<float,2>{0.658212066f, 0.987585068f},
-std::array<float,2>{0.87362045f, 0.063831538f},
-std::array<float,2>{0.226451352f, 0.605697036f},
-std::array<float,2>{0.367091864f, 0.0210250821f},
-std::array<float,2>{0.500037491f, 0.540404916f},
-std::array<float,2>{0.972211659f, 0.372467965f},
-std::array<float,2>{0.0337731168f, 0.883209646f},
-std::array<float,2>{0.154599264f, 0.457108676f},
-std::array<float,2>{0.779735565f, 0.800662339f},
-std::array<float,2>{0.696810961f, 0.241006106f},
-std::array<float,2>{0.403645486f, 0.642578125f},
-std::array<float,2>{0.198612422f, 0.104351923f},
-std::array<float,2>{0.8336097f, 0.583953917f},
-std::array<float,2>{0.648230076f, 0.294983149f},
-std::array<float,2>{0.455779403f, 0.954807103f},
-std::array<float,2>{0.264268339f, 0.43392235f},
-std::array<float,2>{0.588003218f, 0.832449198f},
-std::array<float,2>{0.916754305f, 0.1349262f},
-std::array<float,2>{0.112079352f, 0.699095428f},
-std::array<float,2>{0.424685836f, 0.21182698f},
-std::array<float,2>{0.738398254f, 0.66755116f},
-std::array<float,2>{0.791463077f, 0.470478058f},
-std::array<float,2>{0.184453145f, 0.772480607f},
-std::array<float,2>{0.0265529342f, 0.339759141f},
-std::array<float,2>{0.960014641f, 0.925972641f},
-std::array<float,2>{0.5371328f, 0.0313121676f},
-std::array<float,2>{0.315286815f, 0.512192965f},
-std::array<float,2>{0.166063741f, 0.23311165f},
-std::array<float,2>{0.800511539f, 0.637598157f},
-std::array<float,2>{0.734235585f, 0.440926701f},
-std::array<float,2>{0.408809572f, 0.786179125f},
-std::array<float,2>{0.333696276f, 0.355275035f},
-std::array<float,2>{0.562421799f, 0.898474336f},
-std::array<float,2>{0.952417254f, 0.0100472001f},
-std::array<float,2>{0.0117157642f, 0.550455809f},
-std::array<float,2>{0.437657475f, 0.0897891521f},
-std::array<float,2>{0.631089926f, 0.616182864f},
-std::array<float,2>{0.820029378f, 0.264621079f},
-std::array<float,2>{0.215821162f, 0.974011064f},
-std::array<float,2>{0.105356395f, 0.395317197f},
-std::array<float,2>{0.933525205f, 0.847042203f},
-std::array<float,2>{0.568328798f, 0.177566767f},
-std::array<float,2>{0.279172838f, 0.721575379f},
-std::array<float,2>{0.0519789532f, 0.0622699559f},
-std::array<float,2>{0.99690938f, 0.515819073f},
-std::array<float,2>{0.524796128f, 0.314002454f},
-std::array<float,2>{0.346039921f, 0.918453753f},
-std::array<float,2>{0.386331439f, 0.492256314f},
-std::array<float,2>{0.71840167f, 0.753561735f},
-std::array<float,2>{0.760729671f, 0.195688367f},
-std::array<float,2>{0.136248961f, 0.680516481f},
-std::array<float,2>{0.29863283f, 0.14458245f},
-std::array<float,2>{0.607484519f, 0.711038709f},
-std::array<float,2>{0.88528049f, 0.419457138f},
-std::array<float,2>{0.0869302526f, 0.813489437f},
-std::array<float,2>{0.234480098f, 0.301676065f},
-std::array<float,2>{0.856638372f, 0.946650207f},
-std::array<float,2>{0.684133053f, 0.114107601f},
-std::array<float,2>{0.468825251f, 0.566429019f},
-std::array<float,2>{0.08107052f, 0.21531193f},
-std::array<float,2>{0.879379094f, 0.671225905f},
-std::array<float,2>{0.596591473f, 0.474595755f},
-std::array<float,2>{0.310408711f, 0.76581794f},
-std::array<float,2>{0.480460256f, 0.341522008f},
-std::array<float,2>{0.673129439f, 0.925690114f},
-std::array<float,2>{0.847066224f, 0.0379941203f},
-std::array<float,2>{0.247183919f, 0.509611607f},
-std::array<float,2>{0.354165852f, 0.107968271f},
-std::array<float,2>{0.518520772f, 0.580402672f},
-std::array<float,2>{0.987026095f, 0.291037351f},
-std::array<float,2>{0.0564191006f, 0.960762143f},
-std::array<float,2>{0.129564211f, 0.431737274f},
-std::array<float,2>{0.756970048f, 0.829206884f},
-std::array<float,2>{0.710829437f, 0.139682829f},
-std::array<float,2>{0.375418305f, 0.700167596f},
-std::array<float,2>{0.206694216f, 0.019503694f},
-std::array<float,2>{0.826583564f, 0.543372095f},
-std::array<float,2>{0.640392959f, 0.368220896f},
-std::array<float,2>{0.451972365f, 0.888011992f},
-std::array<float,2>{0.26753667f, 0.45579651f},
-std::array<float,2>{0.57285428f, 0.800881624f},
-std::array<float,2>{0.92722249f, 0.235286817f},
-std::array<float,2>{0.0950973332f, 0.645632982f},
-std::array<float,2>{0.414617717f, 0.168655217f},
-std::array<float,2>{0.721613824f, 0.745767117f},
-std::array<float,2>{0.812378287f, 0.382251173f},
-std::array<float,2>{0.16252768f, 0.867316782f},
-std::array<float,2>{0.00247877953f, 0.271610081f},
-std::array<float,2>{0.940571725f, 0.991041243f},
-std::array<float,2>{0.554191947f, 0.0670062378f},
-std::array<float,2>{0.337678045f, 0.601592243f},
-std::array<float,2>{0.173097059f, 0.142025888f},
-std::array<float,2>{0.787412465f, 0.717166662f},
-std::array<float,2>{0.748828769f, 0.414750516f},
-std::array<float,2>{0.435383379f, 0.817352772f},
-std::array<float,2>{0.324305952f, 0.299150199f},
-std::array<float,2>{0.54274255f, 0.952528179f},
-std::array<float,2>{0.967334092f, 0.113268934f},
-std::array<float,2>{0.0232842546f, 0.564994812f},
-std::array<float,2>{0.465138733f, 0.0556703061f},
-std::array<float,2>{0.650713563f, 0.519711435f},
-std::array<float,2>{0.840214849f, 0.318898678f},
-std::array<float,2>{0.188136518f, 0.91653049f},
-std::array<float,2>{0.121640824f, 0.499072492f},
-std::array<float,2>{0.913676322f, 0.753955722f},
-std::array<float,2>{0.582899749f, 0.201375961f},
-std::array<float,2>{0.252581805f, 0.686104178f},
-std::array<float,2>{0.0452164859f, 0.0928724185f},
-std::array<float,2>{0.984291255f, 0.612287819f},
-std::array<float,2>{0.513962686f, 0.259556204f},
-std::array<float,2>{0.369810879f, 0.969693244f},
-std::array<float,2>{0.395304739f, 0.394287378f},
-std::array<float,2>{0.687571585f, 0.849368274f},
-std::array<float,2>{0.76678896f, 0.173719347f},
-std::array<float,2>{0.142145038f, 0.725638568f},
-std::array<float,2>{0.292915314f, 0.228983954f},
-std::array<float,2>{0.612483978f, 0.632905066f},
-std::array<float,2>{0.89593184f, 0.443302423f},
-std::array<float,2>{0.0671726689f, 0.784068882f},
-std::array<float,2>{0.23376812f, 0.356969297f},
-std::array<float,2>{0.862324417f, 0.903358042f},
-std::array<float,2>{0.670691252f, 0.0155682061f},
-std::array<float,2>{0.486937791f, 0.552345216f},
-std::array<float,2>{0.0302916709f, 0.180359229f},
-std::array<float,2>{0.956290781f, 0.734222472f},
-std::array<float,2>{0.531920075f, 0.399949193f},
-std::array<float,2>{0.32017377f, 0.858801723f},
-std::array<float,2>{0.428372204f, 0.251470476f},
-std::array<float,2>{0.737077117f, 0.983363092f},
-std::array<float,2>{0.794329166f, 0.0813033432f},
-std::array<float,2>{0.181924358f, 0.619608998f},
-std::array<float,2>{0.257819623f, 0.00132768136f},
-std::array<float,2>{0.592303574f, 0.55577147f},
-std::array<float,2>{0.918070436f, 0.346493751f},
-std::array<float,2>{0.115043454f, 0.89666599f},
-std::array<float,2>{0.20300898f, 0.447658449f},
-std::array<float,2>{0.831505835f, 0.790575802f},
-std::array<float,2>{0.644289374f, 0.223743111f},
-std::array<float,2>{0.458497852f, 0.630474091f},
-std::array<float,2>{0.148723051f, 0.121688493f},
-std::array<float,2>{0.773610711f, 0.57721287f},
-std::array<float,2>{0.699982107f, 0.308932871f},
-std::array<float,2>{0.399784088f, 0.944367051f},
-std::array<float,2>{0.359781533f, 0.408392251f},
-std::array<float,2>{0.505465746f, 0.823632896f},
-std::array<float,2>{0.973933518f, 0.150175124f},
-std::array<float,2>{0.0378107615f, 0.70644474f},
-std::array<float,2>{0.498330355f, 0.189261332f},
-std::array<float,2>{0.660720766f, 0.677936614f},
-std::array<float,2>{0.870830476f, 0.487738818f},
-std::array<float,2>{0.219115496f, 0.760078847f},
-std::array<float,2>{0.0750582889f, 0.322164387f},
-std::array<float,2>{0.900786221f, 0.906275809f},
-std::array<float,2>{0.618996799f, 0.0517725125f},
-std::array<float,2>{0.286275923f, 0.529187799f},
-std::array<float,2>{0.242164433f, 0.249599472f},
-std::array<float,2>{0.855151474f, 0.655036867f},
-std::array<float,2>{0.681879938f, 0.461723328f},
-std::array<float,2>{0.472898573f, 0.811590195f},
-std::array<float,2>{0.302156895f, 0.363209307f},
-std::array<float,2>{0.604602993f, 0.881367385f},
-std::array<float,2>{0.888142407f, 0.0271156337f},
-std::array<float,2>{0.0934147313f, 0.534417093f},
-std::array<float,2>{0.388640434f, 0.0709531158f},
-std::array<float,2>{0.712946594f, 0.597086072f},
-std::array<float,2>{0.762533009f, 0.274268061f},
-std::array<float,2>{0.13691704f, 0.995389104f},
-std::array<float,2>{0.0473727249f, 0.384799063f},
-std::array<float,2>{0.993847668f, 0.865476012f},
-std::array<float,2>{0.527796209f, 0.158482239f},
-std::array<float,2>{0.350069702f, 0.734914482f},
-std::array<float,2>{0.106264032f, 0.0459909216f},
-std::array<float,2>{0.935269713f, 0.50706774f},
-std::array<float,2>{0.564877152f, 0.328937083f},
-std::array<float,2>{0.274155885f, 0.932337463f},
-std::array<float,2>{0.444415212f, 0.483450562f},
-std::array<float,2>{0.625633001f, 0.779655278f},
-std::array<float,2>{0.8136186f, 0.205272317f},
-std::array<float,2>{0.211843267f, 0.659537077f},
-std::array<float,2>{0.329749078f, 0.131391242f},
-std::array<float,2>{0.556282043f, 0.690096259f},
-std::array<float,2>{0.94708401f, 0.424090683f},
-std::array<float,2>{0.014002637f, 0.839678764f},
-std::array<float,2>{0.169335872f, 0.287042856f},
-std::array<float,2>{0.80291903f, 0.962602973f},
-std::array<float,2>{0.729874253f, 0.099790819f},
-std::array<float,2>{0.411450565f, 0.587879837f},
-std::array<float,2>{0.0591813959f, 0.22000283f},
-std::array<float,2>{0.991241813f, 0.6251086f},
-std::array<float,2>{0.522755742f, 0.450865865f},
-std::array<float,2>{0.357372224f, 0.795173109f},
-std::array<float,2>{0.382731199f, 0.351356685f},
-std::array<float,2>{0.70661515f, 0.893087685f},
-std::array<float,2>{0.750213861f, 0.00676841335f},
-std::array<float,2>{0.128720209f, 0.561464906f},
-std::array<float,2>{0.304962486f, 0.0836788267f},
-std::array<float,2>{0.601296902f, 0.621791303f},
-std::array<float,2>{0.876537681f, 0.255871296f},
-std::array<float,2>{0.0852890834f, 0.979547739f},
-std::array<float,2>{0.245726347f, 0.40269953f},
-std::array<float,2>{0.850574434f, 0.855185211f},
-std::array<float,2>{0.678147137f, 0.185839444f},
-std::array<float,2>{0.481723577f, 0.729285777f},
-std::array<float,2>{0.15921025f, 0.0480598919f},
-std::array<float,2>{0.807937443f, 0.523618162f},
-std::array<float,2>{0.723641872f, 0.326805651f},
-std::array<float,2>{0.418421f, 0.911045313f},
-std::array<float,2>{0.340839416f, 0.489509165f},
-std::array<float,2>{0.54750669f, 0.762755275f},
-std::array<float,2>{0.94235754f, 0.193128362f},
-std::array<float,2>{0.00444038585f, 0.673006892f},
-std::array<float,2>{0.44767642f, 0.153815508f},
-std::array<float,2>{0.63428843f, 0.709325254f},
-std::array<float,2>{0.821639717f, 0.411101609f},
-std::array<float,2>{0.208217338f, 0.824985743f},
-std::array<float,2>{0.101372555f, 0.305795074f},
-std::array<float,2>{0.923305511f, 0.938553393f},
-std::array<float,2>{0.576729596f, 0.118472412f},
-std::array<float,2>{0.270417273f, 0.57367897f},
-std::array<float,2>{0.1940099f, 0.164039448f},
-std::array<float,2>{0.836401343f, 0.741060793f},
-std::array<float,2>{0.653226852f, 0.387212306f},
-std::array<float,2>{0.46415624f, 0.863146842f},
-std::array<float,2>{0.257248968f, 0.278571606f},
-std::array<float,2>{0.580804586f, 0.997772932f},
-std::array<float,2>{0.907860696f, 0.07615982f},
-std::array<float,2>{0.119163498f, 0.600730479f},
-std::array<float,2>{0.430912018f, 0.0288391709f},
-std::array<float,2>{0.742941558f, 0.53861618f},
-std::array<float,2>{0.782018542f, 0.36405465f},
-std::array<float,2>{0.17813766f, 0.877018154f},
-std::array<float,2>{0.0191009156f, 0.465354651f},
-std::array<float,2>{0.962012112f, 0.807471395f},
-std::array<float,2>{0.545051515f, 0.242898881f},
-std::array<float,2>{0.322730362f, 0.648440123f},
-std::array<float,2>{0.0640857667f, 0.0973605439f},
-std::array<float,2>{0.894394755f, 0.593679011f},
-std::array<float,2>{0.614136755f, 0.284060121f},
-std::array<float,2>{0.296531916f, 0.967086256f},
-std::array<float,2>{0.489935935f, 0.426729083f},
-std::array<float,2>{0.667453349f, 0.842331707f},
-std::array<float,2>{0.864169776f, 0.127433836f},
-std::array<float,2>{0.228512526f, 0.691702783f},
-std::array<float,2>{0.37121585f, 0.210702047f},
-std::array<float,2>{0.511621296f, 0.660188019f},
-std::array<float,2>{0.978743374f, 0.479526997f},
-std::array<float,2>{0.0411028825f, 0.775640309f},
-std::array<float,2>{0.146065831f, 0.335588813f},
-std::array<float,2>{0.772603393f, 0.934632242f},
-std::array<float,2>{0.694319427f, 0.0395073481f},
-std::array<float,2>{0.392566204f, 0.503365874f},
-std::array<float,2>{0.110717542f, 0.133280471f},
-std::array<float,2>{0.915640533f, 0.696017265f},
-std::array<float,2>{0.587829411f, 0.435643822f},
-std::array<float,2>{0.263129175f, 0.834040761f},
-std::array<float,2>{0.454339355f, 0.294784307f},
-std::array<float,2>{0.645698071f, 0.95648998f},
-std::array<float,2>{0.834653795f, 0.10268344f},
-std::array<float,2>{0.196599305f, 0.584364831f},
-std::array<float,2>{0.314046711f, 0.0338874571f},
-std::array<float,2>{0.536337793f, 0.515552402f},
-std::array<float,2>{0.958786368f, 0.336199462f},
-std::array<float,2>{0.0241706613f, 0.928662717f},
-std::array<float,2>{0.185750231f, 0.472234428f},
-std::array<float,2>{0.790848076f, 0.770071328f},
-std::array<float,2>{0.742014647f, 0.214524686f},
-std::array<float,2>{0.422115862f, 0.664884567f},
-std::array<float,2>{0.224392399f, 0.0662118867f},
-std::array<float,2>{0.871831656f, 0.608781397f},
-std::array<float,2>{0.657814801f, 0.268276364f},
-std::array<float,2>{0.494088203f, 0.986109614f},
-std::array<float,2>{0.282819927f, 0.375184983f},
-std::array<float,2>{0.621247232f, 0.871982038f},
-std::array<float,2>{0.905112922f, 0.167913005f},
-std::array<float,2>{0.0738362148f, 0.748825908f},
-std::array<float,2>{0.405112863f, 0.238287136f},
-std::array<float,2>{0.698420525f, 0.644287527f},
-std::array<float,2>{0.778771996f, 0.45973444f},
-std::array<float,2>{0.153712422f, 0.798512042f},
-std::array<float,2>{0.0314698853f, 0.373451918f},
-std::array<float,2>{0.970371664f, 0.885381281f},
-std::array<float,2>{0.503704965f, 0.0217465144f},
-std::array<float,2>{0.364841223f, 0.541138947f},
-std::array<float,2>{0.13452144f, 0.198601648f},
-std::array<float,2>{0.758431792f, 0.682743013f},
-std::array<float,2>{0.715767026f, 0.496090263f},
-std::array<float,2>{0.382884771f, 0.750844359f},
-std::array<float,2>{0.34554109f, 0.316346437f},
-std::array<float,2>{0.526317894f, 0.920130193f},
-std::array<float,2>{0.99886018f, 0.059740942f},
-std::array<float,2>{0.0544274226f, 0.518282473f},
-std::array<float,2>{0.47249341f, 0.116492763f},
-std::array<float,2>{0.686560333f, 0.568930984f},
-std::array<float,2>{0.858722627f, 0.303936392f},
-std::array<float,2>{0.237651438f, 0.948605418f},
-std::array<float,2>{0.0887593254f, 0.42088908f},
-std::array<float,2>{0.884347022f, 0.815487444f},
-std::array<float,2>{0.60731864f, 0.147788689f},
-std::array<float,2>{0.300609022f, 0.713907838f},
-std::array<float,2>{0.00951121561f, 0.00910730381f},
-std::array<float,2>{0.949495435f, 0.547618926f},
-std::array<float,2>{0.559040189f, 0.352900505f},
-std::array<float,2>{0.335686088f, 0.902132213f},
-std::array<float,2>{0.408153474f, 0.438086033f},
-std::array<float,2>{0.731423438f, 0.788675189f},
-std::array<float,2>{0.798691094f, 0.231194302f},
-std::array<float,2>{0.165937722f, 0.639811993f},
-std::array<float,2>{0.281019062f, 0.178403363f},
-std::array<float,2>{0.568897665f, 0.720358551f},
-std::array<float,2>{0.930423439f, 0.398436427f},
-std::array<float,2>{0.102086417f, 0.845360339f},
-std::array<float,2>{0.217847228f, 0.262010753f},
-std::array<float,2>{0.816611111f, 0.976164043f},
-std::array<float,2>{0.630508006f, 0.0866385847f},
-std::array<float,2>{0.440934479f, 0.614710152f},
-std::array<float,2>{0.0675725415f, 0.226741523f},
-std::array<float,2>{0.894618332f, 0.635773003f},
-std::array<float,2>{0.61173737f, 0.444927663f},
-std::array<float,2>{0.291436255f, 0.781336427f},
-std::array<float,2>{0.488123089f, 0.358408153f},
-std::array<float,2>{0.671500504f, 0.905190289f},
-std::array<float,2>{0.861591399f, 0.0132735986f},
-std::array<float,2>{0.233374164f, 0.55460608f},
-std::array<float,2>{0.370533407f, 0.0906898305f},
-std::array<float,2>{0.515230894f, 0.610381782f},
-std::array<float,2>{0.982783079f, 0.261111498f},
-std::array<float,2>{0.0461103097f, 0.971145332f},
-std::array<float,2>{0.141485497f, 0.392202258f},
-std::array<float,2>{0.766195893f, 0.849618912f},
-std::array<float,2>{0.689097345f, 0.174939558f},
-std::array<float,2>{0.396374464f, 0.723465383f},
-std::array<float,2>{0.18929325f, 0.0579090156f},
-std::array<float,2>{0.841723382f, 0.522507966f},
-std::array<float,2>{0.651661158f, 0.317279786f},
-std::array<float,2>{0.466173261f, 0.915562212f},
-std::array<float,2>{0.253062636f, 0.49701646f},
-std::array<float,2>{0.583356619f, 0.756668448f},
-std::array<float,2>{0.912241161f, 0.200348288f},
-std::array<float,2>{0.122160137f, 0.685535014f},
-std::array<float,2>{0.434109747f, 0.143850937f},
-std::array<float,2>{0.74981159f, 0.71560055f},
-std::array<float,2>{0.788944721f, 0.417223394f},
-std::array<float,2>{0.172551796f, 0.818483949f},
-std::array<float,2>{0.0221731793f, 0.29711616f},
-std::array<float,2>{0.967982054f, 0.950468838f},
-std::array<float,2>{0.541940451f, 0.110727526f},
-std::array<float,2>{0.325250149f, 0.563962281f},
-std::array<float,2>{0.164047703f, 0.171236217f},
-std::array<float,2>{0.81077528f, 0.74279505f},
-std::array<float,2>{0.722399831f, 0.380755752f},
-std::array<float,2>{0.415219396f, 0.871059656f},
-std::array<float,2>{0.336205363f, 0.27139765f},
-std::array<float,2>{0.553008795f, 0.989324749f},
-std::array<float,2>{0.93981725f, 0.0694046021f},
-std::array<float,2>{0.00316018891f, 0.605345547f},
-std::array<float,2>{0.45282644f, 0.0159618594f},
-std::array<float,2>{0.63943398f, 0.545104265f},
-std::array<float,2>{0.827253103f, 0.369970173f},
-std::array<float,2>{0.205505535f, 0.890131295f},
-std::array<float,2>{0.0943963304f, 0.453627467f},
-std::array<float,2>{0.926094353f, 0.802925289f},
-std::array<float,2>{0.573491037f, 0.237667277f},
-std::array<float,2>{0.266369849f, 0.647452176f},
-std::array<float,2>{0.0554207042f, 0.107244223f},
-std::array<float,2>{0.988280892f, 0.578876674f},
-std::array<float,2>{0.519020617f, 0.290858716f},
-std::array<float,2>{0.354549468f, 0.957505822f},
-std::array<float,2>{0.37665534f, 0.429859847f},
-std::array<float,2>{0.709855735f, 0.830323875f},
-std::array<float,2>{0.755903542f, 0.138380527f},
-std::array<float,2>{0.130068153f, 0.702089906f},
-std::array<float,2>{0.309251577f, 0.217832193f},
-std::array<float,2>{0.597297907f, 0.668510497f},
-std::array<float,2>{0.880690634f, 0.475331277f},
-std::array<float,2>{0.0806229934f, 0.768577039f},
-std::array<float,2>{0.246323869f, 0.343081862f},
-std::array<float,2>{0.845891595f, 0.92235148f},
-std::array<float,2>{0.672159195f, 0.0354868546f},
-std::array<float,2>{0.478906542f, 0.511075675f},
-std::array<float,2>{0.0150558883f, 0.130256072f},
-std::array<float,2>{0.946197093f, 0.689290166f},
-std::array<float,2>{0.555276155f, 0.422506243f},
-std::array<float,2>{0.32880348f, 0.836933374f},
-std::array<float,2>{0.410447776f, 0.288480818f},
-std::array<float,2>{0.728538513f, 0.963576555f},
-std::array<float,2>{0.804458916f, 0.0979638174f},
-std::array<float,2>{0.168204859f, 0.588145912f},
-std::array<float,2>{0.275036424f, 0.0433206744f},
-std::array<float,2>{0.565947056f, 0.504172921f},
-std::array<float,2>{0.933952987f, 0.331272393f},
-std::array<float,2>{0.10684441f, 0.930974305f},
-std::array<float,2>{0.212577999f, 0.481083483f},
-std::array<float,2>{0.81301856f, 0.778366506f},
-std::array<float,2>{0.626419127f, 0.203397259f},
-std::array<float,2>{0.4439179f, 0.657684624f},
-std::array<float,2>{0.1386168f, 0.0739179105f},
-std::array<float,2>{0.763152599f, 0.595159888f},
-std::array<float,2>{0.713955283f, 0.275854528f},
-std::array<float,2>{0.386748314f, 0.993800163f},
-std::array<float,2>{0.35153091f, 0.38371262f},
-std::array<float,2>{0.529207647f, 0.865100741f},
-std::array<float,2>{0.992409348f, 0.157963142f},
-std::array<float,2>{0.0481443368f, 0.736703932f},
-std::array<float,2>{0.474448204f, 0.246550247f},
-std::array<float,2>{0.683035612f, 0.653167963f},
-std::array<float,2>{0.8539024f, 0.46368891f},
-std::array<float,2>{0.240551382f, 0.810063064f},
-std::array<float,2>{0.0925057381f, 0.360950768f},
-std::array<float,2>{0.887439966f, 0.87962693f},
-std::array<float,2>{0.604051411f, 0.0237386357f},
-std::array<float,2>{0.301296592f, 0.531736135f},
-std::array<float,2>{0.220339268f, 0.191397533f},
-std::array<float,2>{0.869350195f, 0.677603602f},
-std::array<float,2>{0.661493897f, 0.486027837f},
-std::array<float,2>{0.499292552f, 0.758955419f},
-std::array<float,2>{0.285818726f, 0.323456764f},
-std::array<float,2>{0.617930055f, 0.909839928f},
-std::array<float,2>{0.902129531f, 0.0529704466f},
-std::array<float,2>{0.0755502731f, 0.52942574f},
-std::array<float,2>{0.398549944f, 0.124792911f},
-std::array<float,2>{0.700565457f, 0.574790359f},
-std::array<float,2>{0.774859846f, 0.311367393f},
-std::array<float,2>{0.149797022f, 0.943057179f},
-std::array<float,2>{0.0386791304f, 0.408178896f},
-std::array<float,2>{0.97296381f, 0.820440173f},
-std::array<float,2>{0.503943145f, 0.151336297f},
-std::array<float,2>{0.361318678f, 0.70465678f},
-std::array<float,2>{0.114221469f, 0.00204893947f},
-std::array<float,2>{0.91947329f, 0.557959437f},
-std::array<float,2>{0.593657076f, 0.343853712f},
-std::array<float,2>{0.259359568f, 0.895066798f},
-std::array<float,2>{0.457915157f, 0.445764154f},
-std::array<float,2>{0.6432634f, 0.791405559f},
-std::array<float,2>{0.8303563f, 0.225667745f},
-std::array<float,2>{0.201261103f, 0.631254911f},
-std::array<float,2>{0.318389267f, 0.183347911f},
-std::array<float,2>{0.532398999f, 0.73217833f},
-std::array<float,2>{0.955485702f, 0.401028931f},
-std::array<float,2>{0.0298108272f, 0.855604589f},
-std::array<float,2>{0.183538795f, 0.252927035f},
-std::array<float,2>{0.793028951f, 0.980648696f},
-std::array<float,2>{0.737359047f, 0.0790395215f},
-std::array<float,2>{0.429262668f, 0.618657827f},
-std::array<float,2>{0.0426050536f, 0.207791626f},
-std::array<float,2>{0.979767501f, 0.663082719f},
-std::array<float,2>{0.510041177f, 0.476849407f},
-std::array<float,2>{0.372579813f, 0.773883283f},
-std::array<float,2>{0.391480476f, 0.333413273f},
-std::array<float,2>{0.695181012f, 0.935883582f},
-std::array<float,2>{0.771783531f, 0.0414528698f},
-std::array<float,2>{0.1447483f, 0.501303375f},
-std::array<float,2>{0.295801222f, 0.0944293365f},
-std::array<float,2>{0.614935279f, 0.590208828f},
-std::array<float,2>{0.893401384f, 0.281930387f},
-std::array<float,2>{0.0625268072f, 0.966573596f},
-std::array<float,2>{0.227455944f, 0.429005235f},
-std::array<float,2>{0.865041912f, 0.840614021f},
-std::array<float,2>{0.666033328f, 0.126555577f},
-std::array<float,2>{0.488958538f, 0.694339335f},
-std::array<float,2>{0.179195613f, 0.0301657096f},
-std::array<float,2>{0.782617152f, 0.537091553f},
-std::array<float,2>{0.743573546f, 0.366945863f},
-std::array<float,2>{0.429804087f, 0.87584424f},
-std::array<float,2>{0.323558241f, 0.466815382f},
-std::array<float,2>{0.546645343f, 0.806582093f},
-std::array<float,2>{0.961494267f, 0.244599372f},
-std::array<float,2>{0.0176516492f, 0.6512447f},
-std::array<float,2>{0.463037699f, 0.16095975f},
-std::array<float,2>{0.653453887f, 0.73997587f},
-std::array<float,2>{0.837247849f, 0.390024215f},
-std::array<float,2>{0.194352418f, 0.860900044f},
-std::array<float,2>{0.120959699f, 0.279680997f},
-std::array<float,2>{0.906839848f, 0.999186695f},
-std::array<float,2>{0.581762671f, 0.0778447017f},
-std::array<float,2>{0.25635007f, 0.598804891f},
-std::array<float,2>{0.207164258f, 0.156200767f},
-std::array<float,2>{0.820870221f, 0.707129359f},
-std::array<float,2>{0.63307035f, 0.413664877f},
-std::array<float,2>{0.448361278f, 0.826447785f},
-std::array<float,2>{0.270827651f, 0.308306694f},
-std::array<float,2>{0.577255309f, 0.940657079f},
-std::array<float,2>{0.922523916f, 0.120898046f},
-std::array<float,2>{0.0999696776f, 0.571703196f},
-std::array<float,2>{0.419330627f, 0.0491269007f},
-std::array<float,2>{0.723573565f, 0.526410937f},
-std::array<float,2>{0.807368517f, 0.324620962f},
-std::array<float,2>{0.158573896f, 0.913819373f},
-std::array<float,2>{0.0052724909f, 0.491510898f},
-std::array<float,2>{0.943194211f, 0.764901817f},
-std::array<float,2>{0.548559129f, 0.194570944f},
-std::array<float,2>{0.340216428f, 0.675233722f},
-std::array<float,2>{0.0845445395f, 0.0844764113f},
-std::array<float,2>{0.875544667f, 0.624224961f},
-std::array<float,2>{0.600101471f, 0.255775779f},
-std::array<float,2>{0.305926502f, 0.976596951f},
-std::array<float,2>{0.480494529f, 0.404429257f},
-std::array<float,2>{0.679372191f, 0.85347724f},
-std::array<float,2>{0.851342857f, 0.18484132f},
-std::array<float,2>{0.244790971f, 0.727731287f},
-std::array<float,2>{0.355930537f, 0.221236169f},
-std::array<float,2>{0.521904171f, 0.627451301f},
-std::array<float,2>{0.99120599f, 0.451523989f},
-std::array<float,2>{0.0597380213f, 0.794072151f},
-std::array<float,2>{0.127086207f, 0.347703189f},
-std::array<float,2>{0.751790404f, 0.892067373f},
-std::array<float,2>{0.705787897f, 0.00572348293f},
-std::array<float,2>{0.381452858f, 0.559442997f},
-std::array<float,2>{0.102916524f, 0.176414952f},
-std::array<float,2>{0.930739105f, 0.721927285f},
-std::array<float,2>{0.569868624f, 0.39585194f},
-std::array<float,2>{0.279807091f, 0.846168399f},
-std::array<float,2>{0.439624339f, 0.265347689f},
-std::array<float,2>{0.629491746f, 0.972944796f},
-std::array<float,2>{0.8179456f, 0.0888180658f},
-std::array<float,2>{0.216822162f, 0.616262853f},
-std::array<float,2>{0.334779561f, 0.0115362592f},
-std::array<float,2>{0.560126662f, 0.549705386f},
-std::array<float,2>{0.951107621f, 0.353793293f},
-std::array<float,2>{0.0082682129f, 0.900102675f},
-std::array<float,2>{0.164643228f, 0.439635307f},
-std::array<float,2>{0.797748029f, 0.786080837f},
-std::array<float,2>{0.731526613f, 0.233746603f},
-std::array<float,2>{0.406890124f, 0.637882173f},
-std::array<float,2>{0.236822873f, 0.114259966f},
-std::array<float,2>{0.857875586f, 0.568315089f},
-std::array<float,2>{0.685784757f, 0.302592635f},
-std::array<float,2>{0.471093833f, 0.946002483f},
-std::array<float,2>{0.299100518f, 0.418671787f},
-std::array<float,2>{0.605936587f, 0.812777519f},
-std::array<float,2>{0.8834095f, 0.146146983f},
-std::array<float,2>{0.0893347636f, 0.712277532f},
-std::array<float,2>{0.384561926f, 0.196673006f},
-std::array<float,2>{0.716539204f, 0.680934131f},
-std::array<float,2>{0.759628356f, 0.493268251f},
-std::array<float,2>{0.132838488f, 0.752710044f},
-std::array<float,2>{0.0536511056f, 0.31274119f},
-std::array<float,2>{0.999653637f, 0.918973684f},
-std::array<float,2>{0.526732624f, 0.0606924295f},
-std::array<float,2>{0.344438463f, 0.516877174f},
-std::array<float,2>{0.15289709f, 0.241699398f},
-std::array<float,2>{0.778174877f, 0.641475618f},
-std::array<float,2>{0.697739363f, 0.458061576f},
-std::array<float,2>{0.405563772f, 0.798867166f},
-std::array<float,2>{0.363898724f, 0.371374667f},
-std::array<float,2>{0.502843857f, 0.884350598f},
-std::array<float,2>{0.968964696f, 0.0202036239f},
-std::array<float,2>{0.0324093811f, 0.539328635f},
-std::array<float,2>{0.492588103f, 0.0632635504f},
-std::array<float,2>{0.656308115f, 0.606896758f},
-std::array<float,2>{0.872576177f, 0.266078711f},
-std::array<float,2>{0.222780704f, 0.986709297f},
-std::array<float,2>{0.072743617f, 0.377860457f},
-std::array<float,2>{0.905835211f, 0.873321831f},
-std::array<float,2>{0.622457743f, 0.165401161f},
-std::array<float,2>{0.28194952f, 0.746342599f},
-std::array<float,2>{0.0246173237f, 0.0326222591f},
-std::array<float,2>{0.957092047f, 0.513162017f},
-std::array<float,2>{0.535804331f, 0.33885181f},
-std::array<float,2>{0.312781811f, 0.926944673f},
-std::array<float,2>{0.423407644f, 0.46921739f},
-std::array<float,2>{0.741191208f, 0.771856964f},
-std::array<float,2>{0.789834678f, 0.212052077f},
-std::array<float,2>{0.187269539f, 0.666479647f},
-std::array<float,2>{0.262527585f, 0.135806695f},
-std::array<float,2>{0.5860973f, 0.697449982f},
-std::array<float,2>{0.914473295f, 0.434767038f},
-std::array<float,2>{0.110331766f, 0.833489299f},
-std::array<float,2>{0.195614055f, 0.296467781f},
-std::array<float,2>{0.835461557f, 0.953170538f},
-std::array<float,2>{0.645234883f, 0.105332851f},
-std::array<float,2>{0.45387584f, 0.582065642f},
-std::array<float,2>{0.123609543f, 0.202615544f},
-std::array<float,2>{0.911246955f, 0.68710351f},
-std::array<float,2>{0.58519423f, 0.498120457f},
-std::array<float,2>{0.250680357f, 0.755465686f},
-std::array<float,2>{0.467085272f, 0.319956988f},
-std::array<float,2>{0.648732364f, 0.917133331f},
-std::array<float,2>{0.84188211f, 0.0548076592f},
-std::array<float,2>{0.190431565f, 0.521254361f},
-std::array<float,2>{0.327555776f, 0.112188913f},
-std::array<float,2>{0.540461421f, 0.565547705f},
-std::array<float,2>{0.965094507f, 0.299877644f},
-std::array<float,2>{0.0207669605f, 0.951336741f},
-std::array<float,2>{0.175643384f, 0.415898263f},
-std::array<float,2>{0.785475731f, 0.81814909f},
-std::array<float,2>{0.746934175f, 0.141596898f},
-std::array<float,2>{0.437305361f, 0.718623638f},
-std::array<float,2>{0.232366711f, 0.0140497284f},
-std::array<float,2>{0.861002982f, 0.551609337f},
-std::array<float,2>{0.668591976f, 0.35596022f},
-std::array<float,2>{0.484907746f, 0.902403116f},
-std::array<float,2>{0.289888531f, 0.441744447f},
-std::array<float,2>{0.610339463f, 0.784809053f},
-std::array<float,2>{0.89747107f, 0.230185494f},
-std::array<float,2>{0.0689714625f, 0.634747386f},
-std::array<float,2>{0.397339433f, 0.17236875f},
-std::array<float,2>{0.689964473f, 0.725220561f},
-std::array<float,2>{0.7677086f, 0.393321097f},
-std::array<float,2>{0.143074334f, 0.848426282f},
-std::array<float,2>{0.0435302481f, 0.258277208f},
-std::array<float,2>{0.982179821f, 0.97047776f},
-std::array<float,2>{0.513357043f, 0.0927515998f},
-std::array<float,2>{0.367665052f, 0.61283356f},
-std::array<float,2>{0.132210821f, 0.139425382f},
-std::array<float,2>{0.754776359f, 0.701103747f},
-std::array<float,2>{0.708971739f, 0.433179587f},
-std::array<float,2>{0.37770915f, 0.828215718f},
-std::array<float,2>{0.352283984f, 0.292804956f},
-std::array<float,2>{0.51677686f, 0.95954442f},
-std::array<float,2>{0.98468399f, 0.10878069f},
-std::array<float,2>{0.0583438314f, 0.582021117f},
-std::array<float,2>{0.477876008f, 0.0384264551f},
-std::array<float,2>{0.673995435f, 0.508456767f},
-std::array<float,2>{0.844791591f, 0.34058091f},
-std::array<float,2>{0.248069331f, 0.924489081f},
-std::array<float,2>{0.0800454989f, 0.472944111f},
-std::array<float,2>{0.881149769f, 0.767143905f},
-std::array<float,2>{0.594331145f, 0.216787651f},
-std::array<float,2>{0.311510831f, 0.670822799f},
-std::array<float,2>{0.00126681989f, 0.068160437f},
-std::array<float,2>{0.939133823f, 0.603126526f},
-std::array<float,2>{0.551239252f, 0.272953957f},
-std::array<float,2>{0.339071363f, 0.99158144f},
-std::array<float,2>{0.417829514f, 0.381168604f},
-std::array<float,2>{0.720332384f, 0.868645906f},
-std::array<float,2>{0.809816658f, 0.168979108f},
-std::array<float,2>{0.160606563f, 0.744889736f},
-std::array<float,2>{0.269343913f, 0.2356475f},
-std::array<float,2>{0.571842253f, 0.645167112f},
-std::array<float,2>{0.929437041f, 0.456364065f},
-std::array<float,2>{0.0969787836f, 0.8020913f},
-std::array<float,2>{0.204923898f, 0.36809665f},
-std::array<float,2>{0.825505495f, 0.887292206f},
-std::array<float,2>{0.638066888f, 0.0181098431f},
-std::array<float,2>{0.450867265f, 0.543953061f},
-std::array<float,2>{0.0488299616f, 0.159641251f},
-std::array<float,2>{0.995251656f, 0.735725462f},
-std::array<float,2>{0.529753745f, 0.385819733f},
-std::array<float,2>{0.34957546f, 0.866311371f},
-std::array<float,2>{0.390416861f, 0.275264919f},
-std::array<float,2>{0.711627007f, 0.994676411f},
-std::array<float,2>{0.764894366f, 0.0713001043f},
-std::array<float,2>{0.139362812f, 0.596310079f},
-std::array<float,2>{0.30409804f, 0.0253998116f},
-std::array<float,2>{0.60165298f, 0.53367883f},
-std::array<float,2>{0.889097512f, 0.362166107f},
-std::array<float,2>{0.0904224589f, 0.881995797f},
-std::array<float,2>{0.238604069f, 0.462534755f},
-std::array<float,2>{0.852977335f, 0.81076467f},
-std::array<float,2>{0.680722058f, 0.248061731f},
-std::array<float,2>{0.475981742f, 0.655545294f},
-std::array<float,2>{0.171380311f, 0.10058859f},
-std::array<float,2>{0.80148524f, 0.586799502f},
-std::array<float,2>{0.727802873f, 0.28542611f},
-std::array<float,2>{0.413823843f, 0.961913884f},
-std::array<float,2>{0.330479383f, 0.425491899f},
-std::array<float,2>{0.558053732f, 0.838571787f},
-std::array<float,2>{0.947503626f, 0.131995589f},
-std::array<float,2>{0.0130515965f, 0.690473914f},
-std::array<float,2>{0.441927135f, 0.206353515f},
-std::array<float,2>{0.628060341f, 0.658713162f},
-std::array<float,2>{0.814940631f, 0.482976466f},
-std::array<float,2>{0.213438213f, 0.781188428f},
-std::array<float,2>{0.10809008f, 0.329594046f},
-std::array<float,2>{0.936054528f, 0.932940125f},
-std::array<float,2>{0.562754214f, 0.0456994958f},
-std::array<float,2>{0.277200609f, 0.506303132f},
-std::array<float,2>{0.199234381f, 0.222847f},
-std::array<float,2>{0.829286218f, 0.628909409f},
-std::array<float,2>{0.641699255f, 0.448297292f},
-std::array<float,2>{0.460028201f, 0.789889634f},
-std::array<float,2>{0.260489017f, 0.347051501f},
-std::array<float,2>{0.591719687f, 0.897660255f},
-std::array<float,2>{0.91999495f, 0.000299623061f},
-std::array<float,2>{0.115512997f, 0.554854572f},
-std::array<float,2>{0.426787496f, 0.0805791095f},
-std::array<float,2>{0.736108303f, 0.620825529f},
-std::array<float,2>{0.796203613f, 0.250273407f},
-std::array<float,2>{0.181133568f, 0.984051108f},
-std::array<float,2>{0.0284400526f, 0.398831189f},
-std::array<float,2>{0.953593254f, 0.858314514f},
-std::array<float,2>{0.534627914f, 0.180775359f},
-std::array<float,2>{0.317860514f, 0.732957363f},
-std::array<float,2>{0.0762561783f, 0.0517007299f},
-std::array<float,2>{0.899746299f, 0.528156817f},
-std::array<float,2>{0.620406985f, 0.320733368f},
-std::array<float,2>{0.28777945f, 0.907242f},
-std::array<float,2>{0.497017384f, 0.486550361f},
-std::array<float,2>{0.663884461f, 0.760973752f},
-std::array<float,2>{0.868117332f, 0.188026443f},
-std::array<float,2>{0.222463623f, 0.679118931f},
-std::array<float,2>{0.361582309f, 0.148724645f},
-std::array<float,2>{0.506011426f, 0.705263793f},
-std::array<float,2>{0.974796116f, 0.40957585f},
-std::array<float,2>{0.0358102545f, 0.82315886f},
-std::array<float,2>{0.150641531f, 0.310464174f},
-std::array<float,2>{0.776339352f, 0.943501592f},
-std::array<float,2>{0.701173246f, 0.122084491f},
-std::array<float,2>{0.400524676f, 0.576245368f},
-std::array<float,2>{0.0175090991f, 0.244119883f},
-std::array<float,2>{0.964067698f, 0.649708807f},
-std::array<float,2>{0.54403156f, 0.466645658f},
-std::array<float,2>{0.321008027f, 0.808453083f},
-std::array<float,2>{0.431883544f, 0.365095586f},
-std::array<float,2>{0.745016575f, 0.878094614f},
-std::array<float,2>{0.784164369f, 0.0276076589f},
-std::array<float,2>{0.177462533f, 0.537543118f},
-std::array<float,2>{0.25423488f, 0.075116694f},
-std::array<float,2>{0.579230428f, 0.599700391f},
-std::array<float,2>{0.909797132f, 0.277804226f},
-std::array<float,2>{0.117492333f, 0.9966501f},
-std::array<float,2>{0.191478267f, 0.388038695f},
-std::array<float,2>{0.839811742f, 0.861586154f},
-std::array<float,2>{0.655139267f, 0.162162602f},
-std::array<float,2>{0.461210132f, 0.741292179f},
-std::array<float,2>{0.146991268f, 0.0403342955f},
-std::array<float,2>{0.769549429f, 0.502537727f},
-std::array<float,2>{0.692486644f, 0.334068358f},
-std::array<float,2>{0.393935114f, 0.934325278f},
-std::array<float,2>{0.373973399f, 0.479062468f},
-std::array<float,2>{0.509370148f, 0.776755393f},
-std::array<float,2>{0.978429377f, 0.209857941f},
-std::array<float,2>{0.0408849902f, 0.66135025f},
-std::array<float,2>{0.49182871f, 0.127942041f},
-std::array<float,2>{0.664177954f, 0.692761719f},
-std::array<float,2>{0.865783811f, 0.427020699f},
-std::array<float,2>{0.230279163f, 0.84335202f},
-std::array<float,2>{0.0663410202f, 0.284721136f},
-std::array<float,2>{0.892240286f, 0.968035579f},
-std::array<float,2>{0.616302013f, 0.0964711756f},
-std::array<float,2>{0.29417944f, 0.592702925f},
-std::array<float,2>{0.242773741f, 0.187399626f},
-std::array<float,2>{0.847711146f, 0.730373025f},
-std::array<float,2>{0.675870895f, 0.403804302f},
-std::array<float,2>{0.484024942f, 0.853544474f},
-std::array<float,2>{0.30766657f, 0.256880432f},
-std::array<float,2>{0.598640263f, 0.978791475f},
-std::array<float,2>{0.8778404f, 0.0825575441f},
-std::array<float,2>{0.0825938433f, 0.622841418f},
-std::array<float,2>{0.380835086f, 0.00703467475f},
-std::array<float,2>{0.703165114f, 0.561579227f},
-std::array<float,2>{0.753704965f, 0.349927038f},
-std::array<float,2>{0.126232535f, 0.894409537f},
-std::array<float,2>{0.0616364405f, 0.449407637f},
-std::array<float,2>{0.989070654f, 0.795912921f},
-std::array<float,2>{0.520054579f, 0.219708636f},
-std::array<float,2>{0.358801544f, 0.626474082f},
-std::array<float,2>{0.0993596315f, 0.117577143f},
-std::array<float,2>{0.925700426f, 0.572617114f},
-std::array<float,2>{0.575659752f, 0.305559248f},
-std::array<float,2>{0.272080362f, 0.937918365f},
-std::array<float,2>{0.447198212f, 0.41187945f},
-std::array<float,2>{0.634770691f, 0.825592041f},
-std::array<float,2>{0.823849201f, 0.153311104f},
-std::array<float,2>{0.210933015f, 0.70998168f},
-std::array<float,2>{0.342675626f, 0.191876858f},
-std::array<float,2>{0.55035162f, 0.672206998f},
-std::array<float,2>{0.943557084f, 0.488747835f},
-std::array<float,2>{0.00752649317f, 0.762130499f},
-std::array<float,2>{0.157087982f, 0.327374399f},
-std::array<float,2>{0.804826736f, 0.91145581f},
-std::array<float,2>{0.726533532f, 0.047685232f},
-std::array<float,2>{0.420210212f, 0.525182545f},
-std::array<float,2>{0.0860500932f, 0.147086143f},
-std::array<float,2>{0.886615634f, 0.713637412f},
-std::array<float,2>{0.608596742f, 0.421737522f},
-std::array<float,2>{0.297535509f, 0.814777732f},
-std::array<float,2>{0.470175564f, 0.302846491f},
-std::array<float,2>{0.685488105f, 0.947849989f},
-std::array<float,2>{0.855754018f, 0.115533322f},
-std::array<float,2>{0.236021116f, 0.570146501f},
-std::array<float,2>{0.347586304f, 0.059068419f},
-std::array<float,2>{0.523505509f, 0.519416034f},
-std::array<float,2>{0.997664511f, 0.315122634f},
-std::array<float,2>{0.051024314f, 0.921776772f},
-std::array<float,2>{0.13545312f, 0.495017856f},
-std::array<float,2>{0.761464894f, 0.751260638f},
-std::array<float,2>{0.717481315f, 0.19816862f},
-std::array<float,2>{0.385663152f, 0.681816161f},
-std::array<float,2>{0.215563089f, 0.0874900967f},
-std::array<float,2>{0.818608046f, 0.61415261f},
-std::array<float,2>{0.631910086f, 0.262983859f},
-std::array<float,2>{0.439330488f, 0.975238383f},
-std::array<float,2>{0.277619481f, 0.396485418f},
-std::array<float,2>{0.567187011f, 0.84455061f},
-std::array<float,2>{0.93204248f, 0.179548308f},
-std::array<float,2>{0.1036928f, 0.719209492f},
-std::array<float,2>{0.40932554f, 0.232262701f},
-std::array<float,2>{0.732458234f, 0.639125347f},
-std::array<float,2>{0.798926413f, 0.438872755f},
-std::array<float,2>{0.167058229f, 0.787994444f},
-std::array<float,2>{0.010562662f, 0.352020413f},
-std::array<float,2>{0.951416254f, 0.90119195f},
-std::array<float,2>{0.561323404f, 0.0086686844f},
-std::array<float,2>{0.332261175f, 0.548144042f},
-std::array<float,2>{0.185520068f, 0.213606626f},
-std::array<float,2>{0.792006433f, 0.66568327f},
-std::array<float,2>{0.739548326f, 0.470822155f},
-std::array<float,2>{0.425146222f, 0.771268666f},
-std::array<float,2>{0.31618017f, 0.337462753f},
-std::array<float,2>{0.538578451f, 0.92884165f},
-std::array<float,2>{0.959596097f, 0.0345257223f},
-std::array<float,2>{0.0260557942f, 0.513711333f},
-std::array<float,2>{0.456813008f, 0.102353431f},
-std::array<float,2>{0.647052407f, 0.585843682f},
-std::array<float,2>{0.832359254f, 0.29393068f},
-std::array<float,2>{0.198054612f, 0.955340326f},
-std::array<float,2>{0.112305805f, 0.436900347f},
-std::array<float,2>{0.917021453f, 0.835686088f},
-std::array<float,2>{0.589752555f, 0.133906439f},
-std::array<float,2>{0.265462071f, 0.69709909f},
-std::array<float,2>{0.0346465521f, 0.0224961806f},
-std::array<float,2>{0.971387327f, 0.542427659f},
-std::array<float,2>{0.501116514f, 0.374557942f},
-std::array<float,2>{0.365873724f, 0.88637358f},
-std::array<float,2>{0.402907014f, 0.460277826f},
-std::array<float,2>{0.695550144f, 0.797448277f},
-std::array<float,2>{0.781220973f, 0.239965305f},
-std::array<float,2>{0.156110778f, 0.642734826f},
-std::array<float,2>{0.2845155f, 0.166053772f},
-std::array<float,2>{0.623540223f, 0.749246061f},
-std::array<float,2>{0.903328598f, 0.376037419f},
-std::array<float,2>{0.0722576082f, 0.872537076f},
-std::array<float,2>{0.225146741f, 0.269295484f},
-std::array<float,2>{0.874587893f, 0.985253334f},
-std::array<float,2>{0.659358263f, 0.0646439269f},
-std::array<float,2>{0.495475441f, 0.608393371f},
-std::array<float,2>{0.115838155f, 0.226405978f},
-std::array<float,2>{0.920885623f, 0.631544888f},
-std::array<float,2>{0.591145992f, 0.446265191f},
-std::array<float,2>{0.260026127f, 0.791616678f},
-std::array<float,2>{0.460566014f, 0.344556421f},
-std::array<float,2>{0.642449856f, 0.894724309f},
-std::array<float,2>{0.829789102f, 0.00272693904f},
-std::array<float,2>{0.200141624f, 0.558309674f},
-std::array<float,2>{0.318328828f, 0.0783178061f},
-std::array<float,2>{0.534964144f, 0.618303597f},
-std::array<float,2>{0.954033852f, 0.252388388f},
-std::array<float,2>{0.0290673524f, 0.981036186f},
-std::array<float,2>{0.181277111f, 0.400737852f},
-std::array<float,2>{0.796736419f, 0.856155396f},
-std::array<float,2>{0.73551923f, 0.182650089f},
-std::array<float,2>{0.427356988f, 0.731649578f},
-std::array<float,2>{0.222164378f, 0.0533821806f},
-std::array<float,2>{0.867586315f, 0.530095577f},
-std::array<float,2>{0.663171768f, 0.323820412f},
-std::array<float,2>{0.496489197f, 0.909504294f},
-std::array<float,2>{0.287560999f, 0.485712945f},
-std::array<float,2>{0.620644927f, 0.759750426f},
-std::array<float,2>{0.899943769f, 0.190709129f},
-std::array<float,2>{0.0769268721f, 0.676974952f},
-std::array<float,2>{0.401281118f, 0.150691748f},
-std::array<float,2>{0.702094734f, 0.704161525f},
-std::array<float,2>{0.77557683f, 0.407469124f},
-std::array<float,2>{0.151061848f, 0.820875883f},
-std::array<float,2>{0.0353892483f, 0.310561925f},
-std::array<float,2>{0.975260496f, 0.942453563f},
-std::array<float,2>{0.506808996f, 0.124359176f},
-std::array<float,2>{0.362125039f, 0.57430011f},
-std::array<float,2>{0.138798118f, 0.157565877f},
-std::array<float,2>{0.765442252f, 0.737138808f},
-std::array<float,2>{0.711141288f, 0.383235127f},
-std::array<float,2>{0.389680624f, 0.864703774f},
-std::array<float,2>{0.348656476f, 0.275962442f},
-std::array<float,2>{0.530229449f, 0.993626177f},
-std::array<float,2>{0.995726407f, 0.0736205131f},
-std::array<float,2>{0.0497430563f, 0.595574737f},
-std::array<float,2>{0.476203442f, 0.0239739567f},
-std::array<float,2>{0.681521177f, 0.531970978f},
-std::array<float,2>{0.853164613f, 0.360441715f},
-std::array<float,2>{0.238817081f, 0.879220188f},
-std::array<float,2>{0.090075992f, 0.463354051f},
-std::array<float,2>{0.889336228f, 0.809896052f},
-std::array<float,2>{0.60223341f, 0.24702996f},
-std::array<float,2>{0.304322869f, 0.652813137f},
-std::array<float,2>{0.0134086767f, 0.0984090343f},
-std::array<float,2>{0.948056519f, 0.588769972f},
-std::array<float,2>{0.558413446f, 0.28876844f},
-std::array<float,2>{0.331050634f, 0.962978542f},
-std::array<float,2>{0.413282096f, 0.422093421f},
-std::array<float,2>{0.728187501f, 0.837633789f},
-std::array<float,2>{0.801146507f, 0.130851865f},
-std::array<float,2>{0.171451628f, 0.6888116f},
-std::array<float,2>{0.276556283f, 0.203943819f},
-std::array<float,2>{0.56345284f, 0.65784961f},
-std::array<float,2>{0.935559094f, 0.480628341f},
-std::array<float,2>{0.107848868f, 0.779296875f},
-std::array<float,2>{0.213064522f, 0.331994504f},
-std::array<float,2>{0.81533277f, 0.931411326f},
-std::array<float,2>{0.628744423f, 0.0437249132f},
-std::array<float,2>{0.441876411f, 0.504546046f},
-std::array<float,2>{0.0580280907f, 0.138127089f},
-std::array<float,2>{0.98530823f, 0.701450765f},
-std::array<float,2>{0.517555654f, 0.430231005f},
-std::array<float,2>{0.351742476f, 0.830933988f},
-std::array<float,2>{0.377433538f, 0.290147901f},
-std::array<float,2>{0.708353162f, 0.957877576f},
-std::array<float,2>{0.753995597f, 0.106889062f},
-std::array<float,2>{0.132585153f, 0.57849139f},
-std::array<float,2>{0.310778081f, 0.0358393565f},
-std::array<float,2>{0.594184399f, 0.511379361f},
-std::array<float,2>{0.881436765f, 0.343393534f},
-std::array<float,2>{0.0795115978f, 0.922420919f},
-std::array<float,2>{0.248867393f, 0.47491309f},
-std::array<float,2>{0.845425844f, 0.769361615f},
-std::array<float,2>{0.674538672f, 0.218633205f},
-std::array<float,2>{0.478423536f, 0.668089509f},
-std::array<float,2>{0.160801351f, 0.0700028911f},
-std::array<float,2>{0.810246348f, 0.604937315f},
-std::array<float,2>{0.720026016f, 0.270712286f},
-std::array<float,2>{0.417264462f, 0.989811838f},
-std::array<float,2>{0.339738369f, 0.380126923f},
-std::array<float,2>{0.551511109f, 0.870519996f},
-std::array<float,2>{0.938484728f, 0.171644226f},
-std::array<float,2>{0.00147576875f, 0.742611945f},
-std::array<float,2>{0.450289071f, 0.238093287f},
-std::array<float,2>{0.638224959f, 0.646784604f},
-std::array<float,2>{0.825783551f, 0.453419626f},
-std::array<float,2>{0.204464465f, 0.803361297f},
-std::array<float,2>{0.0974936858f, 0.369418025f},
-std::array<float,2>{0.929092646f, 0.890435755f},
-std::array<float,2>{0.571473062f, 0.0162873715f},
-std::array<float,2>{0.269004136f, 0.54550916f},
-std::array<float,2>{0.190975517f, 0.200822145f},
-std::array<float,2>{0.842631102f, 0.684614062f},
-std::array<float,2>{0.649311841f, 0.49641639f},
-std::array<float,2>{0.467595667f, 0.756218076f},
-std::array<float,2>{0.25033021f, 0.31673035f},
-std::array<float,2>{0.585660577f, 0.915227532f},
-std::array<float,2>{0.912067831f, 0.058590956f},
-std::array<float,2>{0.123483293f, 0.523113847f},
-std::array<float,2>{0.436846018f, 0.110906184f},
-std::array<float,2>{0.746436059f, 0.564243793f},
-std::array<float,2>{0.785905778f, 0.297735125f},
-std::array<float,2>{0.174862012f, 0.951114416f},
-std::array<float,2>{0.0210505985f, 0.417721152f},
-std::array<float,2>{0.965522289f, 0.81890142f},
-std::array<float,2>{0.540695608f, 0.14449653f},
-std::array<float,2>{0.327998966f, 0.714848042f},
-std::array<float,2>{0.0687127784f, 0.0130857602f},
-std::array<float,2>{0.897950172f, 0.554161429f},
-std::array<float,2>{0.609604716f, 0.358929873f},
-std::array<float,2>{0.289428294f, 0.904345989f},
-std::array<float,2>{0.484465033f, 0.444703877f},
-std::array<float,2>{0.668232143f, 0.782142341f},
-std::array<float,2>{0.860486984f, 0.227051914f},
-std::array<float,2>{0.23160021f, 0.636462808f},
-std::array<float,2>{0.368052781f, 0.175436705f},
-std::array<float,2>{0.512742221f, 0.722695291f},
-std::array<float,2>{0.981553674f, 0.392062604f},
-std::array<float,2>{0.0431199893f, 0.850221157f},
-std::array<float,2>{0.142839298f, 0.261701047f},
-std::array<float,2>{0.768441677f, 0.971403956f},
-std::array<float,2>{0.689825535f, 0.0902419761f},
-std::array<float,2>{0.396690249f, 0.611018419f},
-std::array<float,2>{0.0256235637f, 0.21259059f},
-std::array<float,2>{0.959341764f, 0.6668607f},
-std::array<float,2>{0.538303256f, 0.469666123f},
-std::array<float,2>{0.315742135f, 0.772387564f},
-std::array<float,2>{0.42555359f, 0.338006943f},
-std::array<float,2>{0.739915252f, 0.927632093f},
-std::array<float,2>{0.792506397f, 0.0330871977f},
-std::array<float,2>{0.185012668f, 0.513268113f},
-std::array<float,2>{0.265077561f, 0.104978137f},
-std::array<float,2>{0.589225173f, 0.582960308f},
-std::array<float,2>{0.917648315f, 0.296356767f},
-std::array<float,2>{0.112831824f, 0.953804195f},
-std::array<float,2>{0.197453231f, 0.435503364f},
-std::array<float,2>{0.832870007f, 0.833767295f},
-std::array<float,2>{0.646614254f, 0.136579603f},
-std::array<float,2>{0.456241637f, 0.697978616f},
-std::array<float,2>{0.155601159f, 0.0195664987f},
-std::array<float,2>{0.780589342f, 0.539776146f},
-std::array<float,2>{0.696276009f, 0.372052729f},
-std::array<float,2>{0.40275687f, 0.884112f},
-std::array<float,2>{0.365465701f, 0.458764702f},
-std::array<float,2>{0.50155735f, 0.799688935f},
-std::array<float,2>{0.970872521f, 0.24156709f},
-std::array<float,2>{0.0347899422f, 0.640937388f},
-std::array<float,2>{0.495876908f, 0.165886372f},
-std::array<float,2>{0.660113633f, 0.746694922f},
-std::array<float,2>{0.874128342f, 0.377193838f},
-std::array<float,2>{0.224742666f, 0.873867691f},
-std::array<float,2>{0.0713581294f, 0.266342282f},
-std::array<float,2>{0.903931618f, 0.98700428f},
-std::array<float,2>{0.623230338f, 0.0625026077f},
-std::array<float,2>{0.285037696f, 0.607298434f},
-std::array<float,2>{0.235461161f, 0.145697027f},
-std::array<float,2>{0.85637933f, 0.712576747f},
-std::array<float,2>{0.68466717f, 0.418346792f},
-std::array<float,2>{0.470505178f, 0.813401401f},
-std::array<float,2>{0.296990037f, 0.302203268f},
-std::array<float,2>{0.609356642f, 0.945595622f},
-std::array<float,2>{0.885901868f, 0.114925906f},
-std::array<float,2>{0.0867212564f, 0.567581654f},
-std::array<float,2>{0.385165244f, 0.0615154877f},
-std::array<float,2>{0.717182338f, 0.517257035f},
-std::array<float,2>{0.760811388f, 0.313236833f},
-std::array<float,2>{0.134967715f, 0.919789612f},
-std::array<float,2>{0.0515201911f, 0.494011015f},
-std::array<float,2>{0.997251987f, 0.752006888f},
-std::array<float,2>{0.524155259f, 0.19692646f},
-std::array<float,2>{0.346849799f, 0.681349218f},
-std::array<float,2>{0.104224823f, 0.0880596787f},
-std::array<float,2>{0.932436049f, 0.616972029f},
-std::array<float,2>{0.566509008f, 0.264743775f},
-std::array<float,2>{0.277839541f, 0.973631918f},
-std::array<float,2>{0.438621849f, 0.396229893f},
-std::array<float,2>{0.632332981f, 0.846602082f},
-std::array<float,2>{0.819236994f, 0.176243544f},
-std::array<float,2>{0.2153088f, 0.722613394f},
-std::array<float,2>{0.332725346f, 0.234215364f},
-std::array<float,2>{0.560729563f, 0.638446391f},
-std::array<float,2>{0.952025712f, 0.44012472f},
-std::array<float,2>{0.00995484926f, 0.78531307f},
-std::array<float,2>{0.16776745f, 0.354246736f},
-std::array<float,2>{0.799330831f, 0.899871171f},
-std::array<float,2>{0.733186543f, 0.0107673528f},
-std::array<float,2>{0.409709692f, 0.54892838f},
-std::array<float,2>{0.0823189989f, 0.185341269f},
-std::array<float,2>{0.876978993f, 0.728391647f},
-std::array<float,2>{0.599532664f, 0.405094862f},
-std::array<float,2>{0.308583766f, 0.852927685f},
-std::array<float,2>{0.483494639f, 0.255179554f},
-std::array<float,2>{0.676669121f, 0.977223694f},
-std::array<float,2>{0.848422587f, 0.0841376036f},
-std::array<float,2>{0.24240151f, 0.624923527f},
-std::array<float,2>{0.359028995f, 0.00491680857f},
-std::array<float,2>{0.519943595f, 0.55887264f},
-std::array<float,2>{0.988431454f, 0.348266751f},
-std::array<float,2>{0.0621866435f, 0.892447829f},
-std::array<float,2>{0.126884297f, 0.451947391f},
-std::array<float,2>{0.753327668f, 0.794876754f},
-std::array<float,2>{0.703791499f, 0.221054658f},
-std::array<float,2>{0.380247355f, 0.627337337f},
-std::array<float,2>{0.210252896f, 0.12040101f},
-std::array<float,2>{0.823582232f, 0.57198441f},
-std::array<float,2>{0.635591924f, 0.307790101f},
-std::array<float,2>{0.446537107f, 0.941224515f},
-std::array<float,2>{0.271856368f, 0.413092107f},
-std::array<float,2>{0.576154172f, 0.826702714f},
-std::array<float,2>{0.92522347f, 0.155457079f},
-std::array<float,2>{0.0988248363f, 0.707761109f},
-std::array<float,2>{0.420527786f, 0.195067704f},
-std::array<float,2>{0.725874364f, 0.675703347f},
-std::array<float,2>{0.805489659f, 0.491835117f},
-std::array<float,2>{0.156404749f, 0.765360832f},
-std::array<float,2>{0.00698721269f, 0.324967861f},
-std::array<float,2>{0.94405067f, 0.913545966f},
-std::array<float,2>{0.550025582f, 0.0494494885f},
-std::array<float,2>{0.342101514f, 0.527132928f},
-std::array<float,2>{0.176936448f, 0.244955376f},
-std::array<float,2>{0.78336978f, 0.650628567f},
-std::array<float,2>{0.744606793f, 0.467594802f},
-std::array<float,2>{0.432590306f, 0.80605942f},
-std::array<float,2>{0.320798039f, 0.366574824f},
-std::array<float,2>{0.544863582f, 0.875049055f},
-std::array<float,2>{0.964725971f, 0.0297698993f},
-std::array<float,2>{0.0166464951f, 0.536539912f},
-std::array<float,2>{0.461435527f, 0.0774273723f},
-std::array<float,2>{0.654321849f, 0.599354327f},
-std::array<float,2>{0.83897382f, 0.280231714f},
-std::array<float,2>{0.192273021f, 0.999607801f},
-std::array<float,2>{0.118067004f, 0.390275776f},
-std::array<float,2>{0.909543335f, 0.860486746f},
-std::array<float,2>{0.579982579f, 0.160303876f},
-std::array<float,2>{0.254880905f, 0.739326656f},
-std::array<float,2>{0.0404781587f, 0.0415387154f},
-std::array<float,2>{0.977989852f, 0.501920223f},
-std::array<float,2>{0.509220719f, 0.333772928f},
-std::array<float,2>{0.373081446f, 0.936288595f},
-std::array<float,2>{0.394189388f, 0.47706759f},
-std::array<float,2>{0.692950726f, 0.774291515f},
-std::array<float,2>{0.770418823f, 0.207178414f},
-std::array<float,2>{0.14679575f, 0.662197351f},
-std::array<float,2>{0.294800341f, 0.126413301f},
-std::array<float,2>{0.616915226f, 0.695016503f},
-std::array<float,2>{0.891901016f, 0.429603428f},
-std::array<float,2>{0.065453507f, 0.83998847f},
-std::array<float,2>{0.229772657f, 0.281287223f},
-std::array<float,2>{0.865426838f, 0.966153026f},
-std::array<float,2>{0.664812088f, 0.0940567032f},
-std::array<float,2>{0.491672844f, 0.590408206f},
-std::array<float,2>{0.075942561f, 0.187528357f},
-std::array<float,2>{0.901502848f, 0.679627061f},
-std::array<float,2>{0.617570281f, 0.487211585f},
-std::array<float,2>{0.285185754f, 0.761244416f},
-std::array<float,2>{0.499573112f, 0.320875674f},
-std::array<float,2>{0.662080467f, 0.907807827f},
-std::array<float,2>{0.870075881f, 0.0511234961f},
-std::array<float,2>{0.219805479f, 0.527766645f},
-std::array<float,2>{0.3606821f, 0.122617982f},
-std::array<float,2>{0.504413128f, 0.577136993f},
-std::array<float,2>{0.973207653f, 0.309730828f},
-std::array<float,2>{0.0381836034f, 0.944308758f},
-std::array<float,2>{0.150117278f, 0.409715086f},
-std::array<float,2>{0.775207639f, 0.822622299f},
-std::array<float,2>{0.701076269f, 0.149317101f},
-std::array<float,2>{0.399251461f, 0.705925047f},
-std::array<float,2>{0.201836258f, 0.000567716546f},
-std::array<float,2>{0.830960393f, 0.555480123f},
-std::array<float,2>{0.642871737f, 0.347581834f},
-std::array<float,2>{0.457502097f, 0.897985041f},
-std::array<float,2>{0.258828223f, 0.449043781f},
-std::array<float,2>{0.592988372f, 0.78945905f},
-std::array<float,2>{0.919423997f, 0.223347679f},
-std::array<float,2>{0.113686621f, 0.629858792f},
-std::array<float,2>{0.429111421f, 0.181330577f},
-std::array<float,2>{0.737906098f, 0.732544184f},
-std::array<float,2>{0.793748856f, 0.3993406f},
-std::array<float,2>{0.182966024f, 0.857655704f},
-std::array<float,2>{0.0293957163f, 0.25085023f},
-std::array<float,2>{0.955714226f, 0.983448505f},
-std::array<float,2>{0.532717645f, 0.0805012211f},
-std::array<float,2>{0.319221109f, 0.620413959f},
-std::array<float,2>{0.1684701f, 0.132600337f},
-std::array<float,2>{0.804089189f, 0.691095889f},
-std::array<float,2>{0.729460478f, 0.424880058f},
-std::array<float,2>{0.410751492f, 0.838184714f},
-std::array<float,2>{0.328281671f, 0.285767555f},
-std::array<float,2>{0.554838717f, 0.961410224f},
-std::array<float,2>{0.945473671f, 0.101437256f},
-std::array<float,2>{0.0155258328f, 0.585991085f},
-std::array<float,2>{0.443469793f, 0.0450909659f},
-std::array<float,2>{0.626757205f, 0.506394863f},
-std::array<float,2>{0.81292069f, 0.329344988f},
-std::array<float,2>{0.212029278f, 0.933588564f},
-std::array<float,2>{0.107205421f, 0.482755303f},
-std::array<float,2>{0.934274435f, 0.780350089f},
-std::array<float,2>{0.565478921f, 0.206735075f},
-std::array<float,2>{0.274841368f, 0.658280492f},
-std::array<float,2>{0.0485664569f, 0.0718891397f},
-std::array<float,2>{0.992824793f, 0.595866621f},
-std::array<float,2>{0.52835685f, 0.274899364f},
-std::array<float,2>{0.350787342f, 0.994489849f},
-std::array<float,2>{0.387564093f, 0.386355966f},
-std::array<float,2>{0.714742601f, 0.867055058f},
-std::array<float,2>{0.763332546f, 0.159961358f},
-std::array<float,2>{0.137940064f, 0.735913038f},
-std::array<float,2>{0.301111251f, 0.248567611f},
-std::array<float,2>{0.60355103f, 0.655764997f},
-std::array<float,2>{0.886885405f, 0.462132215f},
-std::array<float,2>{0.0922163799f, 0.811162591f},
-std::array<float,2>{0.241108924f, 0.361489296f},
-std::array<float,2>{0.85401684f, 0.882544994f},
-std::array<float,2>{0.683161438f, 0.0262743384f},
-std::array<float,2>{0.474073499f, 0.533860266f},
-std::array<float,2>{0.0036462436f, 0.169744179f},
-std::array<float,2>{0.940344334f, 0.744427085f},
-std::array<float,2>{0.553405166f, 0.381552041f},
-std::array<float,2>{0.336823821f, 0.868961036f},
-std::array<float,2>{0.415692866f, 0.272829384f},
-std::array<float,2>{0.722032607f, 0.991957426f},
-std::array<float,2>{0.811395943f, 0.0676029399f},
-std::array<float,2>{0.163181826f, 0.602794766f},
-std::array<float,2>{0.265887529f, 0.0176246241f},
-std::array<float,2>{0.573786736f, 0.544819534f},
-std::array<float,2>{0.926296413f, 0.367331564f},
-std::array<float,2>{0.094153516f, 0.88706702f},
-std::array<float,2>{0.206049114f, 0.457007825f},
-std::array<float,2>{0.827654779f, 0.802521944f},
-std::array<float,2>{0.638922036f, 0.236218542f},
-std::array<float,2>{0.452535927f, 0.644658625f},
-std::array<float,2>{0.130709752f, 0.109353453f},
-std::array<float,2>{0.756501079f, 0.581293523f},
-std::array<float,2>{0.70927006f, 0.292390525f},
-std::array<float,2>{0.376403093f, 0.959139049f},
-std::array<float,2>{0.355174273f, 0.432918906f},
-std::array<float,2>{0.519052625f, 0.82871151f},
-std::array<float,2>{0.987772405f, 0.138942212f},
-std::array<float,2>{0.0550294518f, 0.70042938f},
-std::array<float,2>{0.479183227f, 0.216153383f},
-std::array<float,2>{0.672580481f, 0.670342863f},
-std::array<float,2>{0.846400678f, 0.47317645f},
-std::array<float,2>{0.246946603f, 0.766669512f},
-std::array<float,2>{0.0802176893f, 0.339941353f},
-std::array<float,2>{0.880312324f, 0.924207449f},
-std::array<float,2>{0.597007394f, 0.0389301106f},
-std::array<float,2>{0.308781236f, 0.507976651f},
-std::array<float,2>{0.232446536f, 0.229921907f},
-std::array<float,2>{0.861876905f, 0.634088695f},
-std::array<float,2>{0.671036243f, 0.441969991f},
-std::array<float,2>{0.487786978f, 0.784593523f},
-std::array<float,2>{0.291605413f, 0.35575375f},
-std::array<float,2>{0.612304032f, 0.902900338f},
-std::array<float,2>{0.895056844f, 0.0141710341f},
-std::array<float,2>{0.0681972876f, 0.550870776f},
-std::array<float,2>{0.395975679f, 0.0922778547f},
-std::array<float,2>{0.688742876f, 0.612786412f},
-std::array<float,2>{0.76605618f, 0.258550435f},
-std::array<float,2>{0.140736565f, 0.970153987f},
-std::array<float,2>{0.0468728691f, 0.392711669f},
-std::array<float,2>{0.983083844f, 0.847887158f},
-std::array<float,2>{0.514857531f, 0.172132105f},
-std::array<float,2>{0.370632201f, 0.725085139f},
-std::array<float,2>{0.122681215f, 0.0553735606f},
-std::array<float,2>{0.912824988f, 0.520644486f},
-std::array<float,2>{0.583604753f, 0.319433749f},
-std::array<float,2>{0.253655404f, 0.917628288f},
-std::array<float,2>{0.466646284f, 0.498719245f},
-std::array<float,2>{0.652306616f, 0.755179942f},
-std::array<float,2>{0.840862572f, 0.20291011f},
-std::array<float,2>{0.188584909f, 0.686882734f},
-std::array<float,2>{0.325843662f, 0.140757084f},
-std::array<float,2>{0.54110086f, 0.717992246f},
-std::array<float,2>{0.968492389f, 0.415133148f},
-std::array<float,2>{0.0216184594f, 0.817784846f},
-std::array<float,2>{0.172329888f, 0.300684005f},
-std::array<float,2>{0.78823328f, 0.952089071f},
-std::array<float,2>{0.749257445f, 0.11181622f},
-std::array<float,2>{0.433951139f, 0.566176295f},
-std::array<float,2>{0.0328713171f, 0.239530116f},
-std::array<float,2>{0.969244778f, 0.643171251f},
-std::array<float,2>{0.502400875f, 0.460885495f},
-std::array<float,2>{0.36352402f, 0.796996295f},
-std::array<float,2>{0.406127334f, 0.374260813f},
-std::array<float,2>{0.698217034f, 0.88589406f},
-std::array<float,2>{0.777456343f, 0.0230757408f},
-std::array<float,2>{0.152600676f, 0.542540252f},
-std::array<float,2>{0.281734914f, 0.0650060773f},
-std::array<float,2>{0.622791111f, 0.607495666f},
-std::array<float,2>{0.905430555f, 0.268903732f},
-std::array<float,2>{0.0728423968f, 0.984435558f},
-std::array<float,2>{0.223198041f, 0.376728922f},
-std::array<float,2>{0.87231499f, 0.872647524f},
-std::array<float,2>{0.657101035f, 0.166972741f},
-std::array<float,2>{0.492798001f, 0.749707162f},
-std::array<float,2>{0.186601877f, 0.03498853f},
-std::array<float,2>{0.789380968f, 0.51436317f},
-std::array<float,2>{0.740374804f, 0.337188005f},
-std::array<float,2>{0.423106909f, 0.9295035f},
-std::array<float,2>{0.313398629f, 0.471233815f},
-std::array<float,2>{0.535466313f, 0.770729721f},
-std::array<float,2>{0.957908511f, 0.213215172f},
-std::array<float,2>{0.0249081813f, 0.665244639f},
-std::array<float,2>{0.453162551f, 0.134636492f},
-std::array<float,2>{0.644953132f, 0.696745157f},
-std::array<float,2>{0.835388541f, 0.437271118f},
-std::array<float,2>{0.196036652f, 0.835436225f},
-std::array<float,2>{0.109706067f, 0.293419868f},
-std::array<float,2>{0.914881229f, 0.955967844f},
-std::array<float,2>{0.586633563f, 0.101999089f},
-std::array<float,2>{0.262071759f, 0.584996223f},
-std::array<float,2>{0.217512056f, 0.179043517f},
-std::array<float,2>{0.817752182f, 0.719324648f},
-std::array<float,2>{0.629055619f, 0.397068024f},
-std::array<float,2>{0.439981878f, 0.843853295f},
-std::array<float,2>{0.279668778f, 0.263600618f},
-std::array<float,2>{0.569473624f, 0.97471875f},
-std::array<float,2>{0.931249261f, 0.0873756558f},
-std::array<float,2>{0.103444159f, 0.613612711f},
-std::array<float,2>{0.406465143f, 0.008088734f},
-std::array<float,2>{0.732410252f, 0.548656285f},
-std::array<float,2>{0.797283769f, 0.352149934f},
-std::array<float,2>{0.164336935f, 0.900465846f},
-std::array<float,2>{0.00873333775f, 0.439329177f},
-std::array<float,2>{0.950489223f, 0.787327647f},
-std::array<float,2>{0.559743762f, 0.231582552f},
-std::array<float,2>{0.334316224f, 0.639525533f},
-std::array<float,2>{0.0896824077f, 0.116196394f},
-std::array<float,2>{0.8830688f, 0.569815755f},
-std::array<float,2>{0.606261849f, 0.303232402f},
-std::array<float,2>{0.299495459f, 0.947335303f},
-std::array<float,2>{0.471326143f, 0.421182096f},
-std::array<float,2>{0.686202288f, 0.81505692f},
-std::array<float,2>{0.858043253f, 0.146971747f},
-std::array<float,2>{0.236529633f, 0.713258922f},
-std::array<float,2>{0.34417063f, 0.197513968f},
-std::array<float,2>{0.527263463f, 0.682232976f},
-std::array<float,2>{0.999122202f, 0.494455189f},
-std::array<float,2>{0.0531347655f, 0.751798213f},
-std::array<float,2>{0.133332849f, 0.314484179f},
-std::array<float,2>{0.758831322f, 0.92102474f},
-std::array<float,2>{0.716258466f, 0.059357699f},
-std::array<float,2>{0.383937299f, 0.518997073f},
-std::array<float,2>{0.10051138f, 0.152671009f},
-std::array<float,2>{0.921989381f, 0.710522652f},
-std::array<float,2>{0.577685177f, 0.411531955f},
-std::array<float,2>{0.271416068f, 0.825813472f},
-std::array<float,2>{0.448786259f, 0.304841042f},
-std::array<float,2>{0.633463025f, 0.938321352f},
-std::array<float,2>{0.820484459f, 0.117933229f},
-std::array<float,2>{0.207999751f, 0.572908819f},
-std::array<float,2>{0.34053722f, 0.0473503135f},
-std::array<float,2>{0.547960818f, 0.524606287f},
-std::array<float,2>{0.942727923f, 0.327750087f},
-std::array<float,2>{0.0054046805f, 0.912042379f},
-std::array<float,2>{0.159022048f, 0.488999486f},
-std::array<float,2>{0.807030797f, 0.762302637f},
-std::array<float,2>{0.7230708f, 0.19212465f},
-std::array<float,2>{0.419681579f, 0.672762334f},
-std::array<float,2>{0.244540945f, 0.0820520297f},
-std::array<float,2>{0.850784242f, 0.62216574f},
-std::array<float,2>{0.679138541f, 0.257592708f},
-std::array<float,2>{0.48126623f, 0.979399443f},
-std::array<float,2>{0.306352377f, 0.404047966f},
-std::array<float,2>{0.599868238f, 0.854437947f},
-std::array<float,2>{0.875061333f, 0.18689093f},
-std::array<float,2>{0.0840153694f, 0.729752779f},
-std::array<float,2>{0.381218642f, 0.21918872f},
-std::array<float,2>{0.705473423f, 0.626064122f},
-std::array<float,2>{0.751016736f, 0.450027376f},
-std::array<float,2>{0.127502561f, 0.79682833f},
-std::array<float,2>{0.0603559613f, 0.350182265f},
-std::array<float,2>{0.990375876f, 0.893605947f},
-std::array<float,2>{0.52238816f, 0.0074862265f},
-std::array<float,2>{0.35598892f, 0.562420785f},
-std::array<float,2>{0.145154387f, 0.209274709f},
-std::array<float,2>{0.772014737f, 0.662077606f},
-std::array<float,2>{0.694764137f, 0.479001969f},
-std::array<float,2>{0.390664935f, 0.776893675f},
-std::array<float,2>{0.372228026f, 0.334877014f},
-std::array<float,2>{0.510400176f, 0.933690369f},
-std::array<float,2>{0.98028338f, 0.0408766791f},
-std::array<float,2>{0.042263072f, 0.502411664f},
-std::array<float,2>{0.488291323f, 0.0959179327f},
-std::array<float,2>{0.666741133f, 0.592136621f},
-std::array<float,2>{0.86465925f, 0.284256727f},
-std::array<float,2>{0.226762488f, 0.968430042f},
-std::array<float,2>{0.063148044f, 0.427467287f},
-std::array<float,2>{0.893057585f, 0.843129873f},
-std::array<float,2>{0.614502251f, 0.128650993f},
-std::array<float,2>{0.295159757f, 0.692884386f},
-std::array<float,2>{0.0183406845f, 0.0279313251f},
-std::array<float,2>{0.960975289f, 0.537621737f},
-std::array<float,2>{0.546132147f, 0.364567727f},
-std::array<float,2>{0.324043781f, 0.878526032f},
-std::array<float,2>{0.43057248f, 0.465918839f},
-std::array<float,2>{0.743697405f, 0.807815135f},
-std::array<float,2>{0.78316009f, 0.24335295f},
-std::array<float,2>{0.179575518f, 0.650164068f},
-std::array<float,2>{0.255957037f, 0.162945062f},
-std::array<float,2>{0.581330001f, 0.741951406f},
-std::array<float,2>{0.906400263f, 0.388474286f},
-std::array<float,2>{0.120468587f, 0.862155437f},
-std::array<float,2>{0.195057288f, 0.277982235f},
-std::array<float,2>{0.83757323f, 0.996561766f},
-std::array<float,2>{0.653993964f, 0.0743550435f},
-std::array<float,2>{0.463735312f, 0.600480914f},
-std::array<float,2>{0.0928699151f, 0.2471582f},
-std::array<float,2>{0.888489008f, 0.6542418f},
-std::array<float,2>{0.605019271f, 0.464518607f},
-std::array<float,2>{0.302404851f, 0.809409261f},
-std::array<float,2>{0.473541677f, 0.3595725f},
-std::array<float,2>{0.682533026f, 0.880558252f},
-std::array<float,2>{0.854596853f, 0.0245562568f},
-std::array<float,2>{0.24125278f, 0.532592416f},
-std::array<float,2>{0.35035181f, 0.0725602061f},
-std::array<float,2>{0.527988434f, 0.594632447f},
-std::array<float,2>{0.993595541f, 0.276700824f},
-std::array<float,2>{0.0471752174f, 0.992285013f},
-std::array<float,2>{0.137241051f, 0.384094864f},
-std::array<float,2>{0.762164354f, 0.863591373f},
-std::array<float,2>{0.71369046f, 0.156307384f},
-std::array<float,2>{0.387932718f, 0.737545788f},
-std::array<float,2>{0.211054698f, 0.0443071052f},
-std::array<float,2>{0.814231753f, 0.505279124f},
-std::array<float,2>{0.625479162f, 0.330753058f},
-std::array<float,2>{0.445049971f, 0.930440426f},
-std::array<float,2>{0.273670793f, 0.481653869f},
-std::array<float,2>{0.565226257f, 0.77771771f},
-std::array<float,2>{0.93495667f, 0.205075607f},
-std::array<float,2>{0.105529636f, 0.65635407f},
-std::array<float,2>{0.412091881f, 0.129225165f},
-std::array<float,2>{0.730340362f, 0.688261211f},
-std::array<float,2>{0.803449512f, 0.422988087f},
-std::array<float,2>{0.169643164f, 0.836451232f},
-std::array<float,2>{0.0142841665f, 0.287396103f},
-std::array<float,2>{0.946569324f, 0.964168787f},
-std::array<float,2>{0.555753529f, 0.098840341f},
-std::array<float,2>{0.329267502f, 0.588957012f},
-std::array<float,2>{0.18258144f, 0.181894198f},
-std::array<float,2>{0.794450641f, 0.731001198f},
-std::array<float,2>{0.736655951f, 0.402121693f},
-std::array<float,2>{0.428003252f, 0.857016623f},
-std::array<float,2>{0.319781333f, 0.253443807f},
-std::array<float,2>{0.53126514f, 0.981645763f},
-std::array<float,2>{0.95676899f, 0.0800403506f},
-std::array<float,2>{0.0310522821f, 0.617680073f},
-std::array<float,2>{0.458055288f, 0.00376004679f},
-std::array<float,2>{0.643879235f, 0.556792378f},
-std::array<float,2>{0.831865013f, 0.344794422f},
-std::array<float,2>{0.202473387f, 0.895860314f},
-std::array<float,2>{0.11453525f, 0.447149336f},
-std::array<float,2>{0.918580115f, 0.792455316f},
-std::array<float,2>{0.591868699f, 0.225261748f},
-std::array<float,2>{0.258542448f, 0.631934762f},
-std::array<float,2>{0.0372526832f, 0.123730324f},
-std::array<float,2>{0.974331498f, 0.575821936f},
-std::array<float,2>{0.505059719f, 0.311552167f},
-std::array<float,2>{0.360058874f, 0.942283273f},
-std::array<float,2>{0.400034338f, 0.406440228f},
-std::array<float,2>{0.699619055f, 0.821425915f},
-std::array<float,2>{0.774113715f, 0.151404887f},
-std::array<float,2>{0.148966148f, 0.70314008f},
-std::array<float,2>{0.286685586f, 0.189803809f},
-std::array<float,2>{0.618414044f, 0.675846279f},
-std::array<float,2>{0.901013374f, 0.48524043f},
-std::array<float,2>{0.0743681565f, 0.758669019f},
-std::array<float,2>{0.219455689f, 0.322884619f},
-std::array<float,2>{0.870243967f, 0.908785045f},
-std::array<float,2>{0.660288811f, 0.0541386865f},
-std::array<float,2>{0.4985964f, 0.530433476f},
-std::array<float,2>{0.0228194743f, 0.142834127f},
-std::array<float,2>{0.966882348f, 0.716700673f},
-std::array<float,2>{0.542312741f, 0.416408151f},
-std::array<float,2>{0.325091213f, 0.819553852f},
-std::array<float,2>{0.434698075f, 0.297863901f},
-std::array<float,2>{0.748103321f, 0.949407756f},
-std::array<float,2>{0.788059413f, 0.1095469f},
-std::array<float,2>{0.173598111f, 0.562701523f},
-std::array<float,2>{0.252374291f, 0.0574370287f},
-std::array<float,2>{0.582281828f, 0.522287488f},
-std::array<float,2>{0.913354874f, 0.317622542f},
-std::array<float,2>{0.121132635f, 0.914904237f},
-std::array<float,2>{0.187642366f, 0.497649461f},
-std::array<float,2>{0.840615988f, 0.757059276f},
-std::array<float,2>{0.651256979f, 0.199659511f},
-std::array<float,2>{0.465396374f, 0.684486032f},
-std::array<float,2>{0.141716778f, 0.0909078345f},
-std::array<float,2>{0.767223656f, 0.609760642f},
-std::array<float,2>{0.688468218f, 0.259896576f},
-std::array<float,2>{0.394958138f, 0.972130537f},
-std::array<float,2>{0.369351566f, 0.390887082f},
-std::array<float,2>{0.51456058f, 0.851421297f},
-std::array<float,2>{0.983788013f, 0.173907712f},
-std::array<float,2>{0.0457287282f, 0.72394681f},
-std::array<float,2>{0.486701071f, 0.22835362f},
-std::array<float,2>{0.670300424f, 0.635577321f},
-std::array<float,2>{0.862828016f, 0.443815589f},
-std::array<float,2>{0.23396121f, 0.783040822f},
-std::array<float,2>{0.0667041615f, 0.358244151f},
-std::array<float,2>{0.896457851f, 0.905495524f},
-std::array<float,2>{0.613269508f, 0.0123942485f},
-std::array<float,2>{0.292316407f, 0.553652525f},
-std::array<float,2>{0.247607648f, 0.217198282f},
-std::array<float,2>{0.847224355f, 0.669845104f},
-std::array<float,2>{0.673386574f, 0.476148486f},
-std::array<float,2>{0.479934424f, 0.767906547f},
-std::array<float,2>{0.309673101f, 0.342139632f},
-std::array<float,2>{0.595716298f, 0.923497856f},
-std::array<float,2>{0.879616201f, 0.0362973139f},
-std::array<float,2>{0.0819249824f, 0.510014713f},
-std::array<float,2>{0.375976533f, 0.105793431f},
-std::array<float,2>{0.710086048f, 0.579685032f},
-std::array<float,2>{0.757640064f, 0.289743304f},
-std::array<float,2>{0.128984317f, 0.958723724f},
-std::array<float,2>{0.0561087765f, 0.431516945f},
-std::array<float,2>{0.986631989f, 0.831354201f},
-std::array<float,2>{0.517651498f, 0.137645647f},
-std::array<float,2>{0.353817463f, 0.703076065f},
-std::array<float,2>{0.0955184028f, 0.0168103501f},
-std::array<float,2>{0.927387238f, 0.546856284f},
-std::array<float,2>{0.572312236f, 0.370570421f},
-std::array<float,2>{0.266803771f, 0.889407158f},
-std::array<float,2>{0.451266199f, 0.454553694f},
-std::array<float,2>{0.640033841f, 0.803835571f},
-std::array<float,2>{0.827044606f, 0.237031505f},
-std::array<float,2>{0.206460625f, 0.648424923f},
-std::array<float,2>{0.337044597f, 0.170567989f},
-std::array<float,2>{0.554300308f, 0.743986368f},
-std::array<float,2>{0.941003621f, 0.37892136f},
-std::array<float,2>{0.00197969517f, 0.869702876f},
-std::array<float,2>{0.162657991f, 0.270266891f},
-std::array<float,2>{0.811899185f, 0.989186764f},
-std::array<float,2>{0.721111476f, 0.0688985437f},
-std::array<float,2>{0.414240688f, 0.60438174f},
-std::array<float,2>{0.0537181124f, 0.196038097f},
-std::array<float,2>{0.998476386f, 0.679698408f},
-std::array<float,2>{0.525819302f, 0.49278599f},
-std::array<float,2>{0.345031977f, 0.752996027f},
-std::array<float,2>{0.383542925f, 0.313534886f},
-std::array<float,2>{0.71529758f, 0.91873312f},
-std::array<float,2>{0.757986724f, 0.0615574047f},
-std::array<float,2>{0.134163827f, 0.516141593f},
-std::array<float,2>{0.300115138f, 0.113461226f},
-std::array<float,2>{0.606639028f, 0.567215741f},
-std::array<float,2>{0.883824527f, 0.301186234f},
-std::array<float,2>{0.0883042291f, 0.946818113f},
-std::array<float,2>{0.237899944f, 0.419369668f},
-std::array<float,2>{0.859296203f, 0.813988805f},
-std::array<float,2>{0.687467694f, 0.14524065f},
-std::array<float,2>{0.471942693f, 0.711642504f},
-std::array<float,2>{0.165069595f, 0.010696427f},
-std::array<float,2>{0.798256993f, 0.549833775f},
-std::array<float,2>{0.730945647f, 0.354926378f},
-std::array<float,2>{0.40727514f, 0.89938432f},
-std::array<float,2>{0.335143745f, 0.440568447f},
-std::array<float,2>{0.559180319f, 0.786957622f},
-std::array<float,2>{0.950021088f, 0.232895717f},
-std::array<float,2>{0.00895876717f, 0.637108266f},
-std::array<float,2>{0.440456271f, 0.177162349f},
-std::array<float,2>{0.630211353f, 0.721102178f},
-std::array<float,2>{0.817021966f, 0.39475891f},
-std::array<float,2>{0.218409345f, 0.847442925f},
-std::array<float,2>{0.101917595f, 0.263967067f},
-std::array<float,2>{0.929995418f, 0.974550784f},
-std::array<float,2>{0.568366051f, 0.0893041268f},
-std::array<float,2>{0.280283242f, 0.61562252f},
-std::array<float,2>{0.197139964f, 0.135572061f},
-std::array<float,2>{0.834353864f, 0.698607504f},
-std::array<float,2>{0.646344185f, 0.434482992f},
-std::array<float,2>{0.454853594f, 0.832818151f},
-std::array<float,2>{0.263417453f, 0.295588017f},
-std::array<float,2>{0.587191939f, 0.954232693f},
-std::array<float,2>{0.915066659f, 0.103812404f},
-std::array<float,2>{0.11119467f, 0.583033681f},
-std::array<float,2>{0.422774822f, 0.0322260261f},
-std::array<float,2>{0.741213083f, 0.512386918f},
-std::array<float,2>{0.790199697f, 0.33931765f},
-std::array<float,2>{0.186226219f, 0.926588118f},
-std::array<float,2>{0.0239110216f, 0.469789863f},
-std::array<float,2>{0.958390653f, 0.773010433f},
-std::array<float,2>{0.536974728f, 0.211054891f},
-std::array<float,2>{0.313772231f, 0.666999936f},
-std::array<float,2>{0.0736400038f, 0.0640669763f},
-std::array<float,2>{0.904606462f, 0.605985403f},
-std::array<float,2>{0.621692479f, 0.267025411f},
-std::array<float,2>{0.282298684f, 0.987809479f},
-std::array<float,2>{0.493595958f, 0.37855646f},
-std::array<float,2>{0.657299876f, 0.874080598f},
-std::array<float,2>{0.871300936f, 0.164514527f},
-std::array<float,2>{0.224020392f, 0.747929573f},
-std::array<float,2>{0.364693135f, 0.240575179f},
-std::array<float,2>{0.503395915f, 0.641996503f},
-std::array<float,2>{0.969908237f, 0.457882583f},
-std::array<float,2>{0.0319979116f, 0.799829602f},
-std::array<float,2>{0.153994963f, 0.373017132f},
-std::array<float,2>{0.779065013f, 0.883325458f},
-std::array<float,2>{0.69888103f, 0.020778494f},
-std::array<float,2>{0.40440315f, 0.540742636f},
-std::array<float,2>{0.119866461f, 0.162014619f},
-std::array<float,2>{0.907437682f, 0.739000082f},
-std::array<float,2>{0.580338836f, 0.389438212f},
-std::array<float,2>{0.257369161f, 0.860279322f},
-std::array<float,2>{0.464808404f, 0.280565798f},
-std::array<float,2>{0.652755678f, 0.998568535f},
-std::array<float,2>{0.836696565f, 0.076828979f},
-std::array<float,2>{0.193602815f, 0.597840309f},
-std::array<float,2>{0.323159158f, 0.030893527f},
-std::array<float,2>{0.545849442f, 0.535377204f},
-std::array<float,2>{0.962423146f, 0.365621805f},
-std::array<float,2>{0.0188032296f, 0.876210034f},
-std::array<float,2>{0.178329766f, 0.467921168f},
-std::array<float,2>{0.781341493f, 0.805542231f},
-std::array<float,2>{0.742200553f, 0.245532915f},
-std::array<float,2>{0.431628793f, 0.651924431f},
-std::array<float,2>{0.227930859f, 0.0954666063f},
-std::array<float,2>{0.863443196f, 0.591738105f},
-std::array<float,2>{0.667636871f, 0.282793701f},
-std::array<float,2>{0.489378452f, 0.96567595f},
-std::array<float,2>{0.296252042f, 0.428314477f},
-std::array<float,2>{0.613423765f, 0.841455221f},
-std::array<float,2>{0.893654764f, 0.125389233f},
-std::array<float,2>{0.0635515228f, 0.693975449f},
-std::array<float,2>{0.391753316f, 0.208447024f},
-std::array<float,2>{0.693465114f, 0.66405654f},
-std::array<float,2>{0.773121536f, 0.477802306f},
-std::array<float,2>{0.145855352f, 0.77445811f},
-std::array<float,2>{0.0415864438f, 0.332099974f},
-std::array<float,2>{0.979263127f, 0.937383473f},
-std::array<float,2>{0.511126935f, 0.0425322875f},
-std::array<float,2>{0.371598989f, 0.500282824f},
-std::array<float,2>{0.128244713f, 0.221732616f},
-std::array<float,2>{0.750949085f, 0.628512681f},
-std::array<float,2>{0.706382573f, 0.453019589f},
-std::array<float,2>{0.382324189f, 0.793270111f},
-std::array<float,2>{0.356892288f, 0.349136621f},
-std::array<float,2>{0.523190796f, 0.890787125f},
-std::array<float,2>{0.992013097f, 0.00405573612f},
-std::array<float,2>{0.0586444177f, 0.559873104f},
-std::array<float,2>{0.482194215f, 0.0849975273f},
-std::array<float,2>{0.678238094f, 0.623328269f},
-std::array<float,2>{0.849811077f, 0.253910691f},
-std::array<float,2>{0.24522002f, 0.977854073f},
-std::array<float,2>{0.0855552629f, 0.405427158f},
-std::array<float,2>{0.876321554f, 0.852061868f},
-std::array<float,2>{0.601005137f, 0.183717117f},
-std::array<float,2>{0.305418521f, 0.727103591f},
-std::array<float,2>{0.00422525965f, 0.0504235215f},
-std::array<float,2>{0.941854477f, 0.52620101f},
-std::array<float,2>{0.547242343f, 0.325482816f},
-std::array<float,2>{0.341769308f, 0.912481487f},
-std::array<float,2>{0.418725044f, 0.490884572f},
-std::array<float,2>{0.72449702f, 0.763869762f},
-std::array<float,2>{0.808153749f, 0.194022626f},
-std::array<float,2>{0.159872994f, 0.673899412f},
-std::array<float,2>{0.270015419f, 0.154938743f},
-std::array<float,2>{0.576252162f, 0.708886981f},
-std::array<float,2>{0.923603117f, 0.412745953f},
-std::array<float,2>{0.100764252f, 0.82755357f},
-std::array<float,2>{0.208726704f, 0.307514846f},
-std::array<float,2>{0.822145939f, 0.940384388f},
-std::array<float,2>{0.633953869f, 0.119469196f},
-std::array<float,2>{0.448123485f, 0.570509076f},
-std::array<float,2>{0.108643509f, 0.205974013f},
-std::array<float,2>{0.936564922f, 0.659785926f},
-std::array<float,2>{0.56415087f, 0.484354287f},
-std::array<float,2>{0.27575922f, 0.779860616f},
-std::array<float,2>{0.443203211f, 0.328588486f},
-std::array<float,2>{0.62697345f, 0.931981683f},
-std::array<float,2>{0.815807998f, 0.0465078987f},
-std::array<float,2>{0.214098766f, 0.507389903f},
-std::array<float,2>{0.33196184f, 0.100232616f},
-std::array<float,2>{0.557179272f, 0.586977422f},
-std::array<float,2>{0.948535562f, 0.286303252f},
-std::array<float,2>{0.012246565f, 0.96226579f},
-std::array<float,2>{0.169922575f, 0.424592495f},
-std::array<float,2>{0.802100003f, 0.83897239f},
-std::array<float,2>{0.727095008f, 0.131316975f},
-std::array<float,2>{0.412357479f, 0.689506173f},
-std::array<float,2>{0.239853263f, 0.0265235864f},
-std::array<float,2>{0.852302551f, 0.535144031f},
-std::array<float,2>{0.680615306f, 0.362399966f},
-std::array<float,2>{0.475396603f, 0.881174624f},
-std::array<float,2>{0.303345233f, 0.46110639f},
-std::array<float,2>{0.603295982f, 0.812366426f},
-std::array<float,2>{0.889752924f, 0.24902837f},
-std::array<float,2>{0.091524519f, 0.654370308f},
-std::array<float,2>{0.389072895f, 0.15916878f},
-std::array<float,2>{0.712374985f, 0.7347489f},
-std::array<float,2>{0.763781428f, 0.385581017f},
-std::array<float,2>{0.139711604f, 0.866101205f},
-std::array<float,2>{0.0503503233f, 0.273534805f},
-std::array<float,2>{0.994432449f, 0.995732307f},
-std::array<float,2>{0.530798018f, 0.0706675053f},
-std::array<float,2>{0.347689211f, 0.597575068f},
-std::array<float,2>{0.151417121f, 0.149448156f},
-std::array<float,2>{0.776488841f, 0.706798732f},
-std::array<float,2>{0.702529609f, 0.408987075f},
-std::array<float,2>{0.401977628f, 0.82378608f},
-std::array<float,2>{0.363122344f, 0.309206188f},
-std::array<float,2>{0.507420421f, 0.945274591f},
-std::array<float,2>{0.976307988f, 0.12120565f},
-std::array<float,2>{0.0369648226f, 0.577731073f},
-std::array<float,2>{0.49789983f, 0.0523176678f},
-std::array<float,2>{0.662715197f, 0.52841264f},
-std::array<float,2>{0.869124353f, 0.321628869f},
-std::array<float,2>{0.220868185f, 0.906883359f},
-std::array<float,2>{0.0773680359f, 0.488219649f},
-std::array<float,2>{0.89868784f, 0.760717094f},
-std::array<float,2>{0.619600832f, 0.188765481f},
-std::array<float,2>{0.28891921f, 0.678551972f},
-std::array<float,2>{0.0276221968f, 0.0817413628f},
-std::array<float,2>{0.954905391f, 0.620076776f},
-std::array<float,2>{0.533842504f, 0.251247108f},
-std::array<float,2>{0.316819102f, 0.982632875f},
-std::array<float,2>{0.426330656f, 0.399898112f},
-std::array<float,2>{0.735134423f, 0.859251559f},
-std::array<float,2>{0.795106471f, 0.179871514f},
-std::array<float,2>{0.180596262f, 0.733615458f},
-std::array<float,2>{0.261464804f, 0.224131584f},
-std::array<float,2>{0.590114057f, 0.630128443f},
-std::array<float,2>{0.921592295f, 0.447816133f},
-std::array<float,2>{0.116394095f, 0.790359437f},
-std::array<float,2>{0.201168507f, 0.346166462f},
-std::array<float,2>{0.828147173f, 0.897297025f},
-std::array<float,2>{0.641127884f, 0.00173000607f},
-std::array<float,2>{0.459242105f, 0.556224465f},
-std::array<float,2>{0.0444668941f, 0.17300351f},
-std::array<float,2>{0.980964303f, 0.726413727f},
-std::array<float,2>{0.512150705f, 0.393685043f},
-std::array<float,2>{0.368636042f, 0.849108219f},
-std::array<float,2>{0.397592187f, 0.258837789f},
-std::array<float,2>{0.690776885f, 0.969008803f},
-std::array<float,2>{0.768795788f, 0.0935736448f},
-std::array<float,2>{0.14390856f, 0.611386716f},
-std::array<float,2>{0.29083243f, 0.0149228815f},
-std::array<float,2>{0.611187279f, 0.552063763f},
-std::array<float,2>{0.896663427f, 0.356525123f},
-std::array<float,2>{0.0701815337f, 0.904281914f},
-std::array<float,2>{0.230886698f, 0.442742467f},
-std::array<float,2>{0.859837055f, 0.783210814f},
-std::array<float,2>{0.669703424f, 0.229192302f},
-std::array<float,2>{0.48601675f, 0.633514047f},
-std::array<float,2>{0.174693465f, 0.112651549f},
-std::array<float,2>{0.78659749f, 0.564787924f},
-std::array<float,2>{0.747898221f, 0.299730718f},
-std::array<float,2>{0.436243087f, 0.953083396f},
-std::array<float,2>{0.327043414f, 0.414361238f},
-std::array<float,2>{0.539305866f, 0.816424966f},
-std::array<float,2>{0.966240764f, 0.142366156f},
-std::array<float,2>{0.0197107289f, 0.717427373f},
-std::array<float,2>{0.468601882f, 0.202064559f},
-std::array<float,2>{0.649654865f, 0.686004937f},
-std::array<float,2>{0.843434989f, 0.499602109f},
-std::array<float,2>{0.189559013f, 0.754644394f},
-std::array<float,2>{0.124999315f, 0.318515092f},
-std::array<float,2>{0.910725951f, 0.916217625f},
-std::array<float,2>{0.58443892f, 0.0562778637f},
-std::array<float,2>{0.251574367f, 0.520079494f},
-std::array<float,2>{0.203726366f, 0.234702885f},
-std::array<float,2>{0.825122297f, 0.646152496f},
-std::array<float,2>{0.63701272f, 0.455521137f},
-std::array<float,2>{0.44995141f, 0.801378906f},
-std::array<float,2>{0.267676443f, 0.368968427f},
-std::array<float,2>{0.570436478f, 0.888573349f},
-std::array<float,2>{0.928094864f, 0.0187136494f},
-std::array<float,2>{0.0961142108f, 0.543824852f},
-std::array<float,2>{0.416466147f, 0.0666358396f},
-std::array<float,2>{0.719040573f, 0.602193832f},
-std::array<float,2>{0.808920681f, 0.271996766f},
-std::array<float,2>{0.161290333f, 0.990395486f},
-std::array<float,2>{0.000835916551f, 0.382404983f},
-std::array<float,2>{0.938340783f, 0.867776334f},
-std::array<float,2>{0.552367687f, 0.168123901f},
-std::array<float,2>{0.338617921f, 0.745483577f},
-std::array<float,2>{0.078827545f, 0.0374171361f},
-std::array<float,2>{0.882209718f, 0.508871734f},
-std::array<float,2>{0.59552592f, 0.34111163f},
-std::array<float,2>{0.312342703f, 0.925192595f},
-std::array<float,2>{0.477256566f, 0.473730624f},
-std::array<float,2>{0.67498517f, 0.766382337f},
-std::array<float,2>{0.843794346f, 0.215441898f},
-std::array<float,2>{0.249480456f, 0.671605825f},
-std::array<float,2>{0.352665484f, 0.140490666f},
-std::array<float,2>{0.516251385f, 0.699418068f},
-std::array<float,2>{0.98549664f, 0.432353914f},
-std::array<float,2>{0.0569102541f, 0.82994628f},
-std::array<float,2>{0.131123483f, 0.291546553f},
-std::array<float,2>{0.755472422f, 0.960295737f},
-std::array<float,2>{0.707533181f, 0.1074984f},
-std::array<float,2>{0.378368556f, 0.580597043f},
-std::array<float,2>{0.0107817519f, 0.230566517f},
-std::array<float,2>{0.952933609f, 0.640508771f},
-std::array<float,2>{0.561874926f, 0.437973171f},
-std::array<float,2>{0.333011627f, 0.788561344f},
-std::array<float,2>{0.408512652f, 0.353061169f},
-std::array<float,2>{0.733803153f, 0.901639163f},
-std::array<float,2>{0.800134838f, 0.00959635247f},
-std::array<float,2>{0.166758642f, 0.546980858f},
-std::array<float,2>{0.278585017f, 0.0863123015f},
-std::array<float,2>{0.567511916f, 0.615230024f},
-std::array<float,2>{0.932669103f, 0.262460262f},
-std::array<float,2>{0.104595035f, 0.975987732f},
-std::array<float,2>{0.216390669f, 0.397494584f},
-std::array<float,2>{0.819793344f, 0.8447662f},
-std::array<float,2>{0.631818891f, 0.178163812f},
-std::array<float,2>{0.438360721f, 0.719973028f},
-std::array<float,2>{0.136195973f, 0.0600685515f},
-std::array<float,2>{0.760151744f, 0.517798662f},
-std::array<float,2>{0.718129218f, 0.315762818f},
-std::array<float,2>{0.386085808f, 0.92045188f},
-std::array<float,2>{0.34631449f, 0.495362937f},
-std::array<float,2>{0.52527535f, 0.750409544f},
-std::array<float,2>{0.996209323f, 0.198888674f},
-std::array<float,2>{0.0522955172f, 0.683270335f},
-std::array<float,2>{0.469593585f, 0.1480847f},
-std::array<float,2>{0.683769882f, 0.714609921f},
-std::array<float,2>{0.857148409f, 0.42001757f},
-std::array<float,2>{0.235255316f, 0.816158593f},
-std::array<float,2>{0.087409392f, 0.304561347f},
-std::array<float,2>{0.885060787f, 0.948753357f},
-std::array<float,2>{0.608231664f, 0.117109753f},
-std::array<float,2>{0.298196316f, 0.568590283f},
-std::array<float,2>{0.225720242f, 0.167432353f},
-std::array<float,2>{0.873108387f, 0.748439491f},
-std::array<float,2>{0.65879482f, 0.375540227f},
-std::array<float,2>{0.494620442f, 0.871347189f},
-std::array<float,2>{0.283279926f, 0.267739624f},
-std::array<float,2>{0.624042749f, 0.985762894f},
-std::array<float,2>{0.902804077f, 0.0659032688f},
-std::array<float,2>{0.0706532672f, 0.609123886f},
-std::array<float,2>{0.403985202f, 0.0222645123f},
-std::array<float,2>{0.696530044f, 0.541523397f},
-std::array<float,2>{0.780139148f, 0.373592556f},
-std::array<float,2>{0.154906854f, 0.884881854f},
-std::array<float,2>{0.0336324722f, 0.459413409f},
-std::array<float,2>{0.971687078f, 0.798175395f},
-std::array<float,2>{0.500600457f, 0.238817051f},
-std::array<float,2>{0.366325676f, 0.643997431f},
-std::array<float,2>{0.111777037f, 0.103434443f},
-std::array<float,2>{0.916185081f, 0.584825337f},
-std::array<float,2>{0.588680327f, 0.294110388f},
-std::array<float,2>{0.26400423f, 0.956750751f},
-std::array<float,2>{0.455419779f, 0.436191052f},
-std::array<float,2>{0.647606373f, 0.834737778f},
-std::array<float,2>{0.833464563f, 0.133727804f},
-std::array<float,2>{0.19900091f, 0.695406079f},
-std::array<float,2>{0.314520627f, 0.214065135f},
-std::array<float,2>{0.537692189f, 0.664139688f},
-std::array<float,2>{0.960913301f, 0.472016007f},
-std::array<float,2>{0.0268924832f, 0.769563913f},
-std::array<float,2>{0.183673784f, 0.336436599f},
-std::array<float,2>{0.791923702f, 0.927792609f},
-std::array<float,2>{0.739190042f, 0.0334384292f},
-std::array<float,2>{0.424077958f, 0.515106142f},
-std::array<float,2>{0.0648930147f, 0.127857372f},
-std::array<float,2>{0.891115963f, 0.692220569f},
-std::array<float,2>{0.615903676f, 0.425793558f},
-std::array<float,2>{0.293262333f, 0.842218459f},
-std::array<float,2>{0.490526795f, 0.283429325f},
-std::array<float,2>{0.665238321f, 0.967381597f},
-std::array<float,2>{0.86673075f, 0.0969364494f},
-std::array<float,2>{0.228785142f, 0.592850029f},
-std::array<float,2>{0.374476433f, 0.0397996567f},
-std::array<float,2>{0.508170366f, 0.503746569f},
-std::array<float,2>{0.977209926f, 0.335173994f},
-std::array<float,2>{0.0391828753f, 0.935318887f},
-std::array<float,2>{0.148348927f, 0.480347961f},
-std::array<float,2>{0.770578146f, 0.776149929f},
-std::array<float,2>{0.691869318f, 0.210088402f},
-std::array<float,2>{0.393172979f, 0.661095202f},
-std::array<float,2>{0.192822233f, 0.0755705684f},
-std::array<float,2>{0.838118553f, 0.601473689f},
-std::array<float,2>{0.655972481f, 0.278894246f},
-std::array<float,2>{0.462211549f, 0.99729681f},
-std::array<float,2>{0.255806357f, 0.386884809f},
-std::array<float,2>{0.578282356f, 0.86232245f},
-std::array<float,2>{0.90881294f, 0.163191617f},
-std::array<float,2>{0.118483238f, 0.740319908f},
-std::array<float,2>{0.433179349f, 0.242613688f},
-std::array<float,2>{0.745407939f, 0.649042189f},
-std::array<float,2>{0.78431344f, 0.465077996f},
-std::array<float,2>{0.175813347f, 0.806910872f},
-std::array<float,2>{0.0162638985f, 0.363457471f},
-std::array<float,2>{0.963018715f, 0.877903461f},
-std::array<float,2>{0.543840051f, 0.0285593718f},
-std::array<float,2>{0.321913362f, 0.53822422f},
-std::array<float,2>{0.157822341f, 0.192749694f},
-std::array<float,2>{0.80573833f, 0.673452199f},
-std::array<float,2>{0.724679351f, 0.48994112f},
-std::array<float,2>{0.421834618f, 0.763603389f},
-std::array<float,2>{0.343521893f, 0.326498598f},
-std::array<float,2>{0.549680471f, 0.910628319f},
-std::array<float,2>{0.945286393f, 0.0487095565f},
-std::array<float,2>{0.00639160164f, 0.52433151f},
-std::array<float,2>{0.445410311f, 0.118751399f},
-std::array<float,2>{0.636646152f, 0.574063957f},
-std::array<float,2>{0.822665572f, 0.306214511f},
-std::array<float,2>{0.20989491f, 0.939247489f},
-std::array<float,2>{0.0981640518f, 0.410198748f},
-std::array<float,2>{0.924774706f, 0.824703395f},
-std::array<float,2>{0.574320793f, 0.153638855f},
-std::array<float,2>{0.273399085f, 0.709837258f},
-std::array<float,2>{0.0606791079f, 0.00592829194f},
-std::array<float,2>{0.989689827f, 0.56069237f},
-std::array<float,2>{0.520684361f, 0.350991219f},
-std::array<float,2>{0.358314157f, 0.892733395f},
-std::array<float,2>{0.379211128f, 0.450602889f},
-std::array<float,2>{0.704109728f, 0.795783937f},
-std::array<float,2>{0.752765954f, 0.220242962f},
-std::array<float,2>{0.125242844f, 0.625948608f},
-std::array<float,2>{0.306920499f, 0.186291128f},
-std::array<float,2>{0.59804827f, 0.728717744f},
-std::array<float,2>{0.878309846f, 0.402940422f},
-std::array<float,2>{0.0839324743f, 0.854866505f},
-std::array<float,2>{0.243275419f, 0.256775409f},
-std::array<float,2>{0.849060595f, 0.980331898f},
-std::array<float,2>{0.677366495f, 0.0834596679f},
-std::array<float,2>{0.482487708f, 0.621143222f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.709387064f, 0.549234092f},
-std::array<float,2>{0.191235259f, 0.149432763f},
-std::array<float,2>{0.46296531f, 0.924532771f},
-std::array<float,2>{0.899506927f, 0.477994263f},
-std::array<float,2>{0.863549173f, 0.807112098f},
-std::array<float,2>{0.357734293f, 0.352087021f},
-std::array<float,2>{0.016383592f, 0.670677245f},
-std::array<float,2>{0.57789886f, 0.0321805589f},
-std::array<float,2>{0.517798185f, 0.981928289f},
-std::array<float,2>{0.123050995f, 0.411542803f},
-std::array<float,2>{0.311547369f, 0.606743753f},
-std::array<float,2>{0.768592238f, 0.22848925f},
-std::array<float,2>{0.961107075f, 0.743556201f},
-std::array<float,2>{0.375849843f, 0.118975885f},
-std::array<float,2>{0.145231202f, 0.838258743f},
-std::array<float,2>{0.647514284f, 0.260419577f},
-std::array<float,2>{0.623088062f, 0.651424229f},
-std::array<float,2>{0.045745831f, 0.0142788822f},
-std::array<float,2>{0.329745591f, 0.750679135f},
-std::array<float,2>{0.827401638f, 0.313224107f},
-std::array<float,2>{0.907730401f, 0.889388204f},
-std::array<float,2>{0.489908189f, 0.463707149f},
-std::array<float,2>{0.238714024f, 0.511856556f},
-std::array<float,2>{0.728868067f, 0.160740063f},
-std::array<float,2>{0.662929416f, 0.873172641f},
-std::array<float,2>{0.175166979f, 0.281837076f},
-std::array<float,2>{0.427973747f, 0.687679708f},
-std::array<float,2>{0.995101929f, 0.0718648955f},
-std::array<float,2>{0.78487581f, 0.566547692f},
-std::array<float,2>{0.266020626f, 0.203910336f},
-std::array<float,2>{0.0854930058f, 0.937554479f},
-std::array<float,2>{0.556004167f, 0.393770397f},
-std::array<float,2>{0.541706145f, 0.621610045f},
-std::array<float,2>{0.0740345269f, 0.244043902f},
-std::array<float,2>{0.261835873f, 0.998426437f},
-std::array<float,2>{0.808349609f, 0.431440026f},
-std::array<float,2>{0.970523953f, 0.823723555f},
-std::array<float,2>{0.412800789f, 0.265722007f},
-std::array<float,2>{0.164074734f, 0.727521777f},
-std::array<float,2>{0.673634052f, 0.106855176f},
-std::array<float,2>{0.749622822f, 0.920057297f},
-std::array<float,2>{0.234147713f, 0.487378538f},
-std::array<float,2>{0.48250404f, 0.545728683f},
-std::array<float,2>{0.932191312f, 0.134573549f},
-std::array<float,2>{0.836771071f, 0.68502003f},
-std::array<float,2>{0.316236198f, 0.0557919852f},
-std::array<float,2>{0.0530701876f, 0.790444851f},
-std::array<float,2>{0.603000581f, 0.364325732f},
-std::array<float,2>{0.632898986f, 0.711157203f},
-std::array<float,2>{0.130666733f, 0.0923057273f},
-std::array<float,2>{0.393631548f, 0.844089925f},
-std::array<float,2>{0.939982951f, 0.301240653f},
-std::array<float,2>{0.755671084f, 0.956674874f},
-std::array<float,2>{0.281908661f, 0.387878329f},
-std::array<float,2>{0.105374813f, 0.592418134f},
-std::array<float,2>{0.505638838f, 0.198186725f},
-std::array<float,2>{0.579488754f, 0.77950722f},
-std::array<float,2>{0.001926656f, 0.332722515f},
-std::array<float,2>{0.372625619f, 0.640043199f},
-std::array<float,2>{0.852033377f, 0.0242013354f},
-std::array<float,2>{0.877438784f, 0.521955013f},
-std::array<float,2>{0.444562107f, 0.178225994f},
-std::array<float,2>{0.211556241f, 0.890803695f},
-std::array<float,2>{0.688043058f, 0.448916644f},
-std::array<float,2>{0.68627584f, 0.582157671f},
-std::array<float,2>{0.160176456f, 0.191132203f},
-std::array<float,2>{0.420209825f, 0.963966131f},
-std::array<float,2>{0.984176338f, 0.379906684f},
-std::array<float,2>{0.802341044f, 0.858577907f},
-std::array<float,2>{0.250105947f, 0.307319015f},
-std::array<float,2>{0.0639434904f, 0.709278047f},
-std::array<float,2>{0.535768211f, 0.0848298371f},
-std::array<float,2>{0.599347472f, 0.903428793f},
-std::array<float,2>{0.05704372f, 0.439736634f},
-std::array<float,2>{0.324201673f, 0.525244534f},
-std::array<float,2>{0.832030535f, 0.181137234f},
-std::array<float,2>{0.924905956f, 0.625611246f},
-std::array<float,2>{0.473553538f, 0.0216604806f},
-std::array<float,2>{0.222857073f, 0.772814453f},
-std::array<float,2>{0.738928258f, 0.33874917f},
-std::array<float,2>{0.513451755f, 0.724911749f},
-std::array<float,2>{0.0985368565f, 0.0964407921f},
-std::array<float,2>{0.29173097f, 0.812771797f},
-std::array<float,2>{0.758473635f, 0.275294483f},
-std::array<float,2>{0.947280109f, 0.990572989f},
-std::array<float,2>{0.398701042f, 0.429374188f},
-std::array<float,2>{0.138067842f, 0.612220705f},
-std::array<float,2>{0.629245877f, 0.2404221f},
-std::array<float,2>{0.698231697f, 0.786840379f},
-std::array<float,2>{0.206152469f, 0.369965225f},
-std::array<float,2>{0.451957852f, 0.675930858f},
-std::array<float,2>{0.883553743f, 0.0494734831f},
-std::array<float,2>{0.847928107f, 0.537959218f},
-std::array<float,2>{0.363645852f, 0.131513357f},
-std::array<float,2>{0.0135394717f, 0.909643829f},
-std::array<float,2>{0.587167025f, 0.495753706f},
-std::array<float,2>{0.564557254f, 0.504292488f},
-std::array<float,2>{0.0238039065f, 0.166064069f},
-std::array<float,2>{0.34494561f, 0.875042915f},
-std::array<float,2>{0.867703974f, 0.456914395f},
-std::array<float,2>{0.891861558f, 0.761030674f},
-std::array<float,2>{0.453431755f, 0.327937305f},
-std::array<float,2>{0.197940439f, 0.646716177f},
-std::array<float,2>{0.712943912f, 0.00413220469f},
-std::array<float,2>{0.653005362f, 0.950538814f},
-std::array<float,2>{0.154524565f, 0.400923342f},
-std::array<float,2>{0.385138243f, 0.575986326f},
-std::array<float,2>{0.953279138f, 0.216920152f},
-std::array<float,2>{0.778223753f, 0.698847651f},
-std::array<float,2>{0.302427202f, 0.0640414655f},
-std::array<float,2>{0.114656404f, 0.859744012f},
-std::array<float,2>{0.527838349f, 0.293303579f},
-std::array<float,2>{0.718903124f, 0.660860837f},
-std::array<float,2>{0.242532462f, 0.0464471392f},
-std::array<float,2>{0.492426336f, 0.802716017f},
-std::array<float,2>{0.917330742f, 0.346558005f},
-std::array<float,2>{0.82022506f, 0.933219552f},
-std::array<float,2>{0.34011972f, 0.473327875f},
-std::array<float,2>{0.0389030017f, 0.557946622f},
-std::array<float,2>{0.614769638f, 0.145200968f},
-std::array<float,2>{0.547927916f, 0.828162372f},
-std::array<float,2>{0.0893781111f, 0.255250961f},
-std::array<float,2>{0.276949197f, 0.739539921f},
-std::array<float,2>{0.795228541f, 0.111042552f},
-std::array<float,2>{0.985641003f, 0.600864887f},
-std::array<float,2>{0.435099721f, 0.221707389f},
-std::array<float,2>{0.181085855f, 0.973037422f},
-std::array<float,2>{0.671108961f, 0.419757366f},
-std::array<float,2>{0.640963614f, 0.528499305f},
-std::array<float,2>{0.140829459f, 0.186689377f},
-std::array<float,2>{0.38243705f, 0.89897418f},
-std::array<float,2>{0.96524775f, 0.442493409f},
-std::array<float,2>{0.771683633f, 0.76725471f},
-std::array<float,2>{0.308043778f, 0.339849502f},
-std::array<float,2>{0.1183713f, 0.631661415f},
-std::array<float,2>{0.521732807f, 0.0177043434f},
-std::array<float,2>{0.571669579f, 0.968417585f},
-std::array<float,2>{0.0227079187f, 0.376527429f},
-std::array<float,2>{0.352235377f, 0.580930471f},
-std::array<float,2>{0.862576365f, 0.194746196f},
-std::array<float,2>{0.904737294f, 0.704832494f},
-std::array<float,2>{0.46778366f, 0.0802553818f},
-std::array<float,2>{0.192295194f, 0.851638615f},
-std::array<float,2>{0.704824924f, 0.310084522f},
-std::array<float,2>{0.559235215f, 0.675178647f},
-std::array<float,2>{0.0807528868f, 0.0525689051f},
-std::array<float,2>{0.272522181f, 0.784269035f},
-std::array<float,2>{0.787759602f, 0.373016864f},
-std::array<float,2>{0.999141634f, 0.912504435f},
-std::array<float,2>{0.422819108f, 0.498369306f},
-std::array<float,2>{0.178403065f, 0.533841789f},
-std::array<float,2>{0.660000205f, 0.126761064f},
-std::array<float,2>{0.733319998f, 0.818230569f},
-std::array<float,2>{0.237307355f, 0.278822094f},
-std::array<float,2>{0.48442778f, 0.721504927f},
-std::array<float,2>{0.910392046f, 0.0988019034f},
-std::array<float,2>{0.822655797f, 0.615700543f},
-std::array<float,2>{0.333492666f, 0.237217858f},
-std::array<float,2>{0.041768115f, 0.987313628f},
-std::array<float,2>{0.6210289f, 0.424432963f},
-std::array<float,2>{0.608205378f, 0.570987105f},
-std::array<float,2>{0.0500741675f, 0.214246944f},
-std::array<float,2>{0.318823993f, 0.945846796f},
-std::array<float,2>{0.841696322f, 0.404672295f},
-std::array<float,2>{0.933987379f, 0.866397381f},
-std::array<float,2>{0.477205157f, 0.292093098f},
-std::array<float,2>{0.22785905f, 0.700096309f},
-std::array<float,2>{0.744119942f, 0.0688213184f},
-std::array<float,2>{0.677771211f, 0.879899263f},
-std::array<float,2>{0.17107594f, 0.459960848f},
-std::array<float,2>{0.406261533f, 0.500687361f},
-std::array<float,2>{0.976040006f, 0.169749171f},
-std::array<float,2>{0.809343576f, 0.641921818f},
-std::array<float,2>{0.260342211f, 0.00291156676f},
-std::array<float,2>{0.0742641091f, 0.765477657f},
-std::array<float,2>{0.546274126f, 0.320855916f},
-std::array<float,2>{0.694924057f, 0.735101938f},
-std::array<float,2>{0.215682f, 0.114233665f},
-std::array<float,2>{0.437564582f, 0.833348155f},
-std::array<float,2>{0.880190015f, 0.251797676f},
-std::array<float,2>{0.858830988f, 0.970025718f},
-std::array<float,2>{0.370255142f, 0.414346635f},
-std::array<float,2>{0.00568608381f, 0.596644402f},
-std::array<float,2>{0.585622072f, 0.224948823f},
-std::array<float,2>{0.500739813f, 0.79715395f},
-std::array<float,2>{0.106374316f, 0.347855896f},
-std::array<float,2>{0.285712302f, 0.659528196f},
-std::array<float,2>{0.7532655f, 0.0398974754f},
-std::array<float,2>{0.944249094f, 0.559485435f},
-std::array<float,2>{0.395905226f, 0.142997041f},
-std::array<float,2>{0.126070127f, 0.936603546f},
-std::array<float,2>{0.640554249f, 0.469722658f},
-std::array<float,2>{0.73525697f, 0.603577495f},
-std::array<float,2>{0.219622657f, 0.233092874f},
-std::array<float,2>{0.472572774f, 0.979468048f},
-std::array<float,2>{0.925903916f, 0.40779537f},
-std::array<float,2>{0.832862854f, 0.842805326f},
-std::array<float,2>{0.326639801f, 0.263305664f},
-std::array<float,2>{0.0605654344f, 0.749148607f},
-std::array<float,2>{0.597606659f, 0.124524333f},
-std::array<float,2>{0.531336248f, 0.927600682f},
-std::array<float,2>{0.0696386918f, 0.481179386f},
-std::array<float,2>{0.256390274f, 0.553196907f},
-std::array<float,2>{0.799358785f, 0.153564796f},
-std::array<float,2>{0.979261458f, 0.667327583f},
-std::array<float,2>{0.415131032f, 0.0361974053f},
-std::array<float,2>{0.156379268f, 0.809299231f},
-std::array<float,2>{0.681146204f, 0.358860373f},
-std::array<float,2>{0.590016425f, 0.693266809f},
-std::array<float,2>{0.00794308353f, 0.0768083259f},
-std::array<float,2>{0.361896604f, 0.869478226f},
-std::array<float,2>{0.846508205f, 0.286279649f},
-std::array<float,2>{0.890588284f, 0.942225635f},
-std::array<float,2>{0.446801126f, 0.397128135f},
-std::array<float,2>{0.20946829f, 0.56346935f},
-std::array<float,2>{0.700246334f, 0.210453093f},
-std::array<float,2>{0.62677896f, 0.754610538f},
-std::array<float,2>{0.135015756f, 0.318204761f},
-std::array<float,2>{0.40360406f, 0.655827999f},
-std::array<float,2>{0.951548219f, 0.00828109775f},
-std::array<float,2>{0.761849642f, 0.509399593f},
-std::array<float,2>{0.295347512f, 0.157262087f},
-std::array<float,2>{0.0975257382f, 0.884065926f},
-std::array<float,2>{0.508463025f, 0.465170473f},
-std::array<float,2>{0.525816143f, 0.54207921f},
-std::array<float,2>{0.110150732f, 0.139657721f},
-std::array<float,2>{0.299662292f, 0.915632367f},
-std::array<float,2>{0.776720226f, 0.4905788f},
-std::array<float,2>{0.958070159f, 0.793989837f},
-std::array<float,2>{0.390479475f, 0.361981273f},
-std::array<float,2>{0.151566997f, 0.682944477f},
-std::array<float,2>{0.649600804f, 0.0588175468f},
-std::array<float,2>{0.714984179f, 0.995896876f},
-std::array<float,2>{0.202457413f, 0.437478185f},
-std::array<float,2>{0.45756951f, 0.619173348f},
-std::array<float,2>{0.894904733f, 0.246281043f},
-std::array<float,2>{0.872863233f, 0.730693519f},
-std::array<float,2>{0.349574476f, 0.103577755f},
-std::array<float,2>{0.0305749625f, 0.825330317f},
-std::array<float,2>{0.5698843f, 0.272536784f},
-std::array<float,2>{0.665756345f, 0.635019183f},
-std::array<float,2>{0.185618654f, 0.031064244f},
-std::array<float,2>{0.431883812f, 0.774198055f},
-std::array<float,2>{0.988736033f, 0.331075639f},
-std::array<float,2>{0.789920449f, 0.898269653f},
-std::array<float,2>{0.278516829f, 0.452446669f},
-std::array<float,2>{0.0909005478f, 0.517857015f},
-std::array<float,2>{0.550990939f, 0.175681591f},
-std::array<float,2>{0.609632015f, 0.848610699f},
-std::array<float,2>{0.0313195698f, 0.300259173f},
-std::array<float,2>{0.336636454f, 0.718578756f},
-std::array<float,2>{0.814959526f, 0.0886645094f},
-std::array<float,2>{0.921411812f, 0.588342011f},
-std::array<float,2>{0.499297589f, 0.200054064f},
-std::array<float,2>{0.24968411f, 0.958218575f},
-std::array<float,2>{0.724604905f, 0.385704994f},
-std::array<float,2>{0.728378475f, 0.515096724f},
-std::array<float,2>{0.242180988f, 0.163037032f},
-std::array<float,2>{0.491650254f, 0.887919605f},
-std::array<float,2>{0.90835011f, 0.461718976f},
-std::array<float,2>{0.824415624f, 0.75302124f},
-std::array<float,2>{0.330989838f, 0.316199154f},
-std::array<float,2>{0.0446463227f, 0.648646116f},
-std::array<float,2>{0.622599602f, 0.012589016f},
-std::array<float,2>{0.557734847f, 0.940294683f},
-std::array<float,2>{0.0834707692f, 0.391831845f},
-std::array<float,2>{0.268482983f, 0.568486452f},
-std::array<float,2>{0.781699955f, 0.206474692f},
-std::array<float,2>{0.993280888f, 0.690466881f},
-std::array<float,2>{0.425984442f, 0.072524257f},
-std::array<float,2>{0.172437206f, 0.872565866f},
-std::array<float,2>{0.661650479f, 0.283859283f},
-std::array<float,2>{0.575662971f, 0.669563234f},
-std::array<float,2>{0.0193438213f, 0.0339976065f},
-std::array<float,2>{0.356157154f, 0.805965185f},
-std::array<float,2>{0.865521133f, 0.35384506f},
-std::array<float,2>{0.900911689f, 0.922765195f},
-std::array<float,2>{0.460938036f, 0.478921592f},
-std::array<float,2>{0.188863233f, 0.547990978f},
-std::array<float,2>{0.707042217f, 0.150472999f},
-std::array<float,2>{0.645039022f, 0.836536407f},
-std::array<float,2>{0.147695497f, 0.258495957f},
-std::array<float,2>{0.37886712f, 0.74491924f},
-std::array<float,2>{0.964507282f, 0.120500393f},
-std::array<float,2>{0.767176569f, 0.608911932f},
-std::array<float,2>{0.309852064f, 0.228799775f},
-std::array<float,2>{0.121556938f, 0.984169543f},
-std::array<float,2>{0.516420126f, 0.413864821f},
-std::array<float,2>{0.507067084f, 0.590305865f},
-std::array<float,2>{0.10254167f, 0.196201086f},
-std::array<float,2>{0.283265859f, 0.953311384f},
-std::array<float,2>{0.757607639f, 0.389569789f},
-std::array<float,2>{0.939409256f, 0.846437216f},
-std::array<float,2>{0.391234279f, 0.303367078f},
-std::array<float,2>{0.132105604f, 0.713913381f},
-std::array<float,2>{0.63522917f, 0.0904641151f},
-std::array<float,2>{0.689601779f, 0.894032717f},
-std::array<float,2>{0.213098913f, 0.446936548f},
-std::array<float,2>{0.443196833f, 0.519977927f},
-std::array<float,2>{0.87668246f, 0.177066296f},
-std::array<float,2>{0.854215264f, 0.638122201f},
-std::array<float,2>{0.373701394f, 0.0269132461f},
-std::array<float,2>{0.00232822285f, 0.778294802f},
-std::array<float,2>{0.581296682f, 0.335196733f},
-std::array<float,2>{0.675086081f, 0.729195535f},
-std::array<float,2>{0.166507527f, 0.108769692f},
-std::array<float,2>{0.410729468f, 0.821130931f},
-std::array<float,2>{0.97189486f, 0.26764375f},
-std::array<float,2>{0.80498749f, 0.996272326f},
-std::array<float,2>{0.264785975f, 0.433062613f},
-std::array<float,2>{0.070948042f, 0.62382412f},
-std::array<float,2>{0.539160192f, 0.245583981f},
-std::array<float,2>{0.605288863f, 0.791624725f},
-std::array<float,2>{0.0524800792f, 0.367043406f},
-std::array<float,2>{0.31269899f, 0.686880291f},
-std::array<float,2>{0.838234544f, 0.0572404116f},
-std::array<float,2>{0.931419373f, 0.543324947f},
-std::array<float,2>{0.481308401f, 0.13559173f},
-std::array<float,2>{0.232208699f, 0.918860078f},
-std::array<float,2>{0.747771859f, 0.486177266f},
-std::array<float,2>{0.631520152f, 0.610590518f},
-std::array<float,2>{0.139656067f, 0.239871755f},
-std::array<float,2>{0.401250929f, 0.989253521f},
-std::array<float,2>{0.946210027f, 0.427189261f},
-std::array<float,2>{0.760587156f, 0.815043449f},
-std::array<float,2>{0.289658517f, 0.276544601f},
-std::array<float,2>{0.0996453911f, 0.724025726f},
-std::array<float,2>{0.514176965f, 0.0950976908f},
-std::array<float,2>{0.588056505f, 0.907729387f},
-std::array<float,2>{0.0152128832f, 0.492366582f},
-std::array<float,2>{0.365832806f, 0.536575079f},
-std::array<float,2>{0.850248158f, 0.129603311f},
-std::array<float,2>{0.885389268f, 0.67773509f},
-std::array<float,2>{0.450272232f, 0.0468882844f},
-std::array<float,2>{0.203692943f, 0.788557887f},
-std::array<float,2>{0.6957708f, 0.367390513f},
-std::array<float,2>{0.537140071f, 0.708556592f},
-std::array<float,2>{0.065824613f, 0.083911404f},
-std::array<float,2>{0.253623426f, 0.855586886f},
-std::array<float,2>{0.80333972f, 0.304759681f},
-std::array<float,2>{0.982046604f, 0.962203622f},
-std::array<float,2>{0.418920666f, 0.381069154f},
-std::array<float,2>{0.162912756f, 0.584705234f},
-std::array<float,2>{0.684026122f, 0.189076155f},
-std::array<float,2>{0.74210453f, 0.770148039f},
-std::array<float,2>{0.226158485f, 0.336646557f},
-std::array<float,2>{0.475534976f, 0.628149152f},
-std::array<float,2>{0.922738612f, 0.0205426086f},
-std::array<float,2>{0.828878164f, 0.525520325f},
-std::array<float,2>{0.320702702f, 0.182106972f},
-std::array<float,2>{0.0564502738f, 0.905502319f},
-std::array<float,2>{0.600210905f, 0.439418077f},
-std::array<float,2>{0.616312325f, 0.555821896f},
-std::array<float,2>{0.0360641181f, 0.14670606f},
-std::array<float,2>{0.342297018f, 0.931032956f},
-std::array<float,2>{0.816885591f, 0.476268917f},
-std::array<float,2>{0.914316058f, 0.803955495f},
-std::array<float,2>{0.495815367f, 0.345507413f},
-std::array<float,2>{0.245302826f, 0.663785458f},
-std::array<float,2>{0.722283721f, 0.0440753736f},
-std::array<float,2>{0.668381095f, 0.976561069f},
-std::array<float,2>{0.181748271f, 0.420511007f},
-std::array<float,2>{0.436120719f, 0.598131895f},
-std::array<float,2>{0.988210022f, 0.220303014f},
-std::array<float,2>{0.793006539f, 0.740507603f},
-std::array<float,2>{0.275025725f, 0.112696797f},
-std::array<float,2>{0.0865843296f, 0.831052601f},
-std::array<float,2>{0.550584674f, 0.256334543f},
-std::array<float,2>{0.71190536f, 0.644622982f},
-std::array<float,2>{0.196446791f, 0.00767660933f},
-std::array<float,2>{0.455920219f, 0.757913053f},
-std::array<float,2>{0.894261181f, 0.326036841f},
-std::array<float,2>{0.869575202f, 0.877089739f},
-std::array<float,2>{0.347100139f, 0.454405963f},
-std::array<float,2>{0.026239058f, 0.506873667f},
-std::array<float,2>{0.564406395f, 0.164278492f},
-std::array<float,2>{0.529789507f, 0.862843454f},
-std::array<float,2>{0.117135592f, 0.295339882f},
-std::array<float,2>{0.304462761f, 0.696027637f},
-std::array<float,2>{0.779735088f, 0.0663419887f},
-std::array<float,2>{0.955632269f, 0.577277839f},
-std::array<float,2>{0.384176284f, 0.216669619f},
-std::array<float,2>{0.153637797f, 0.952733755f},
-std::array<float,2>{0.65567106f, 0.398891181f},
-std::array<float,2>{0.657853603f, 0.531899214f},
-std::array<float,2>{0.177180856f, 0.128633693f},
-std::array<float,2>{0.42468068f, 0.910542071f},
-std::array<float,2>{0.996219575f, 0.497922391f},
-std::array<float,2>{0.786132455f, 0.781464159f},
-std::array<float,2>{0.271411121f, 0.374157548f},
-std::array<float,2>{0.0787743032f, 0.673204958f},
-std::array<float,2>{0.560726464f, 0.0543521047f},
-std::array<float,2>{0.617416322f, 0.986142755f},
-std::array<float,2>{0.0394923612f, 0.423563719f},
-std::array<float,2>{0.334183753f, 0.61398679f},
-std::array<float,2>{0.820493519f, 0.234675646f},
-std::array<float,2>{0.913156629f, 0.720205307f},
-std::array<float,2>{0.487232417f, 0.101175629f},
-std::array<float,2>{0.236076251f, 0.820262194f},
-std::array<float,2>{0.731774211f, 0.279326737f},
-std::array<float,2>{0.521195769f, 0.630831361f},
-std::array<float,2>{0.120365821f, 0.01730345f},
-std::array<float,2>{0.306067765f, 0.768590212f},
-std::array<float,2>{0.77010113f, 0.343446016f},
-std::array<float,2>{0.966872156f, 0.900503755f},
-std::array<float,2>{0.37972787f, 0.444231421f},
-std::array<float,2>{0.14288868f, 0.529983759f},
-std::array<float,2>{0.643045902f, 0.184020028f},
-std::array<float,2>{0.706627369f, 0.854105532f},
-std::array<float,2>{0.194585934f, 0.310857624f},
-std::array<float,2>{0.465258956f, 0.706415653f},
-std::array<float,2>{0.904059649f, 0.0791875124f},
-std::array<float,2>{0.860156298f, 0.578893065f},
-std::array<float,2>{0.353662819f, 0.193024963f},
-std::array<float,2>{0.0208706409f, 0.966638982f},
-std::array<float,2>{0.573599517f, 0.378079087f},
-std::array<float,2>{0.582357943f, 0.595643699f},
-std::array<float,2>{0.00772480713f, 0.223557279f},
-std::array<float,2>{0.368553311f, 0.971778572f},
-std::array<float,2>{0.855680108f, 0.416353315f},
-std::array<float,2>{0.882642984f, 0.835538924f},
-std::array<float,2>{0.440840065f, 0.253614008f},
-std::array<float,2>{0.218585715f, 0.737919152f},
-std::array<float,2>{0.69321084f, 0.115652293f},
-std::array<float,2>{0.638164282f, 0.934118092f},
-std::array<float,2>{0.127711803f, 0.472611815f},
-std::array<float,2>{0.397871107f, 0.560763836f},
-std::array<float,2>{0.943280697f, 0.141660556f},
-std::array<float,2>{0.751597047f, 0.656874061f},
-std::array<float,2>{0.288810641f, 0.0425061323f},
-std::array<float,2>{0.108410478f, 0.800140858f},
-std::array<float,2>{0.503749192f, 0.35074088f},
-std::array<float,2>{0.745921016f, 0.702921152f},
-std::array<float,2>{0.229253411f, 0.0664977655f},
-std::array<float,2>{0.479899555f, 0.864096701f},
-std::array<float,2>{0.937273264f, 0.289515197f},
-std::array<float,2>{0.842762291f, 0.948981285f},
-std::array<float,2>{0.317450285f, 0.403895229f},
-std::array<float,2>{0.0481339805f, 0.572369993f},
-std::array<float,2>{0.60558778f, 0.21203734f},
-std::array<float,2>{0.543631315f, 0.761719227f},
-std::array<float,2>{0.076913923f, 0.323173642f},
-std::array<float,2>{0.259103209f, 0.642705321f},
-std::array<float,2>{0.811825275f, 0.000337118166f},
-std::array<float,2>{0.973816872f, 0.503660023f},
-std::array<float,2>{0.408761352f, 0.17067799f},
-std::array<float,2>{0.169173911f, 0.882620513f},
-std::array<float,2>{0.676115453f, 0.458656132f},
-std::array<float,2>{0.701835871f, 0.565447092f},
-std::array<float,2>{0.208361238f, 0.208919808f},
-std::array<float,2>{0.449186951f, 0.944721222f},
-std::array<float,2>{0.887477696f, 0.394981086f},
-std::array<float,2>{0.845384836f, 0.868609905f},
-std::array<float,2>{0.360215425f, 0.288650542f},
-std::array<float,2>{0.0106161293f, 0.694958925f},
-std::array<float,2>{0.593600154f, 0.0752236173f},
-std::array<float,2>{0.510137618f, 0.885649383f},
-std::array<float,2>{0.0938968956f, 0.467876077f},
-std::array<float,2>{0.294431537f, 0.510451913f},
-std::array<float,2>{0.764675617f, 0.159694776f},
-std::array<float,2>{0.950002253f, 0.652542531f},
-std::array<float,2>{0.405627251f, 0.0107454406f},
-std::array<float,2>{0.134470031f, 0.755995154f},
-std::array<float,2>{0.627222359f, 0.320182353f},
-std::array<float,2>{0.59428221f, 0.746574581f},
-std::array<float,2>{0.0587622523f, 0.121794693f},
-std::array<float,2>{0.325320601f, 0.841022134f},
-std::array<float,2>{0.83585906f, 0.265497267f},
-std::array<float,2>{0.928366005f, 0.977310896f},
-std::array<float,2>{0.46995309f, 0.408929199f},
-std::array<float,2>{0.222069576f, 0.603492796f},
-std::array<float,2>{0.738065898f, 0.232150048f},
-std::array<float,2>{0.682098031f, 0.81127578f},
-std::array<float,2>{0.15930222f, 0.356904656f},
-std::array<float,2>{0.417072833f, 0.664213836f},
-std::array<float,2>{0.976766407f, 0.0382050388f},
-std::array<float,2>{0.79877013f, 0.552630365f},
-std::array<float,2>{0.255145997f, 0.155982628f},
-std::array<float,2>{0.0675942972f, 0.928617716f},
-std::array<float,2>{0.534785569f, 0.484219253f},
-std::array<float,2>{0.553876936f, 0.516449332f},
-std::array<float,2>{0.0923155993f, 0.171940953f},
-std::array<float,2>{0.279621989f, 0.895086527f},
-std::array<float,2>{0.79190439f, 0.449251235f},
-std::array<float,2>{0.991196573f, 0.776935995f},
-std::array<float,2>{0.430135429f, 0.329731852f},
-std::array<float,2>{0.184017777f, 0.633371949f},
-std::array<float,2>{0.667427957f, 0.0289858915f},
-std::array<float,2>{0.725860238f, 0.959664524f},
-std::array<float,2>{0.246310756f, 0.384662241f},
-std::array<float,2>{0.497294843f, 0.586309254f},
-std::array<float,2>{0.918014586f, 0.201701567f},
-std::array<float,2>{0.81296891f, 0.715529501f},
-std::array<float,2>{0.338220149f, 0.0867192373f},
-std::array<float,2>{0.0338024236f, 0.849800527f},
-std::array<float,2>{0.613167346f, 0.297949344f},
-std::array<float,2>{0.651957452f, 0.680802405f},
-std::array<float,2>{0.149080977f, 0.0609929264f},
-std::array<float,2>{0.387455076f, 0.795972168f},
-std::array<float,2>{0.960717559f, 0.359773248f},
-std::array<float,2>{0.775059342f, 0.916935325f},
-std::array<float,2>{0.298273921f, 0.489964545f},
-std::array<float,2>{0.113239333f, 0.539090157f},
-std::array<float,2>{0.524303794f, 0.136927262f},
-std::array<float,2>{0.566599429f, 0.827827096f},
-std::array<float,2>{0.0276581403f, 0.270233005f},
-std::array<float,2>{0.35044992f, 0.733571887f},
-std::array<float,2>{0.874697447f, 0.102066599f},
-std::array<float,2>{0.896867037f, 0.61750859f},
-std::array<float,2>{0.460606366f, 0.248129517f},
-std::array<float,2>{0.199777335f, 0.993236244f},
-std::array<float,2>{0.717535913f, 0.435298055f},
-std::array<float,2>{0.688635349f, 0.520901978f},
-std::array<float,2>{0.212842837f, 0.176251903f},
-std::array<float,2>{0.443797946f, 0.893460512f},
-std::array<float,2>{0.878333926f, 0.445737213f},
-std::array<float,2>{0.852816582f, 0.779164076f},
-std::array<float,2>{0.371798784f, 0.3346937f},
-std::array<float,2>{0.000950209098f, 0.636808753f},
-std::array<float,2>{0.578277946f, 0.0260832049f},
-std::array<float,2>{0.504719555f, 0.955012858f},
-std::array<float,2>{0.103972539f, 0.390518904f},
-std::array<float,2>{0.282614321f, 0.591426849f},
-std::array<float,2>{0.754435718f, 0.197251275f},
-std::array<float,2>{0.941371799f, 0.713847399f},
-std::array<float,2>{0.393393338f, 0.0912267044f},
-std::array<float,2>{0.129099637f, 0.847384274f},
-std::array<float,2>{0.634247541f, 0.304380029f},
-std::array<float,2>{0.602440059f, 0.685776353f},
-std::array<float,2>{0.0544712469f, 0.0585576259f},
-std::array<float,2>{0.315256119f, 0.792922497f},
-std::array<float,2>{0.837299824f, 0.365930796f},
-std::array<float,2>{0.93296206f, 0.919318557f},
-std::array<float,2>{0.484051555f, 0.484458625f},
-std::array<float,2>{0.232922167f, 0.544225454f},
-std::array<float,2>{0.748384655f, 0.136289522f},
-std::array<float,2>{0.672228992f, 0.822065115f},
-std::array<float,2>{0.165593863f, 0.268906862f},
-std::array<float,2>{0.413141817f, 0.729752362f},
-std::array<float,2>{0.969524503f, 0.108145654f},
-std::array<float,2>{0.807324409f, 0.624577105f},
-std::array<float,2>{0.26272434f, 0.244310543f},
-std::array<float,2>{0.0727038011f, 0.997822046f},
-std::array<float,2>{0.542205811f, 0.432160348f},
-std::array<float,2>{0.554999828f, 0.569976807f},
-std::array<float,2>{0.0847412422f, 0.206000939f},
-std::array<float,2>{0.267116785f, 0.940932631f},
-std::array<float,2>{0.783686936f, 0.391503096f},
-std::array<float,2>{0.995196223f, 0.871793032f},
-std::array<float,2>{0.429412603f, 0.284315914f},
-std::array<float,2>{0.17429778f, 0.689790547f},
-std::array<float,2>{0.663207054f, 0.0733084381f},
-std::array<float,2>{0.729653656f, 0.88707149f},
-std::array<float,2>{0.239982247f, 0.462218225f},
-std::array<float,2>{0.488849998f, 0.513950944f},
-std::array<float,2>{0.906815231f, 0.163613483f},
-std::array<float,2>{0.827072799f, 0.649879932f},
-std::array<float,2>{0.328278333f, 0.0136656994f},
-std::array<float,2>{0.0463424884f, 0.752392232f},
-std::array<float,2>{0.624617517f, 0.314669251f},
-std::array<float,2>{0.646870911f, 0.745595336f},
-std::array<float,2>{0.145588309f, 0.119948007f},
-std::array<float,2>{0.376644135f, 0.837389529f},
-std::array<float,2>{0.962273359f, 0.259393692f},
-std::array<float,2>{0.767870426f, 0.982911289f},
-std::array<float,2>{0.311137259f, 0.41232568f},
-std::array<float,2>{0.124620654f, 0.607625782f},
-std::array<float,2>{0.519228041f, 0.230320603f},
-std::array<float,2>{0.57619071f, 0.805525839f},
-std::array<float,2>{0.0174625125f, 0.35543105f},
-std::array<float,2>{0.359204412f, 0.668511689f},
-std::array<float,2>{0.864992976f, 0.0347859971f},
-std::array<float,2>{0.899208426f, 0.547155023f},
-std::array<float,2>{0.464826465f, 0.151636347f},
-std::array<float,2>{0.190076351f, 0.923238516f},
-std::array<float,2>{0.71007669f, 0.479719341f},
-std::array<float,2>{0.670135915f, 0.599400699f},
-std::array<float,2>{0.180632919f, 0.219349474f},
-std::array<float,2>{0.434174418f, 0.974654257f},
-std::array<float,2>{0.984626472f, 0.421129882f},
-std::array<float,2>{0.796216428f, 0.831486642f},
-std::array<float,2>{0.275514513f, 0.256914467f},
-std::array<float,2>{0.0878913105f, 0.741796196f},
-std::array<float,2>{0.547620416f, 0.111629732f},
-std::array<float,2>{0.613928378f, 0.930462897f},
-std::array<float,2>{0.0378744751f, 0.47556302f},
-std::array<float,2>{0.341446489f, 0.555079043f},
-std::array<float,2>{0.818446815f, 0.147584349f},
-std::array<float,2>{0.916409135f, 0.66224575f},
-std::array<float,2>{0.493442953f, 0.0429796167f},
-std::array<float,2>{0.243645534f, 0.802774489f},
-std::array<float,2>{0.720627785f, 0.343892694f},
-std::array<float,2>{0.528777242f, 0.69672972f},
-std::array<float,2>{0.114156753f, 0.0645296574f},
-std::array<float,2>{0.301644832f, 0.861905575f},
-std::array<float,2>{0.779145241f, 0.295910239f},
-std::array<float,2>{0.954590619f, 0.951198518f},
-std::array<float,2>{0.386625886f, 0.400076956f},
-std::array<float,2>{0.155417025f, 0.576915622f},
-std::array<float,2>{0.653748393f, 0.215535045f},
-std::array<float,2>{0.7140643f, 0.758903861f},
-std::array<float,2>{0.198405594f, 0.324498594f},
-std::array<float,2>{0.454661429f, 0.645744324f},
-std::array<float,2>{0.891568303f, 0.00623782072f},
-std::array<float,2>{0.86843276f, 0.50639838f},
-std::array<float,2>{0.344371527f, 0.165506423f},
-std::array<float,2>{0.0251176506f, 0.878219306f},
-std::array<float,2>{0.566105783f, 0.453473389f},
-std::array<float,2>{0.586018264f, 0.535388052f},
-std::array<float,2>{0.0119514195f, 0.130711153f},
-std::array<float,2>{0.364822775f, 0.907152116f},
-std::array<float,2>{0.8491171f, 0.493492216f},
-std::array<float,2>{0.884682655f, 0.787291408f},
-std::array<float,2>{0.452232867f, 0.368551344f},
-std::array<float,2>{0.205867052f, 0.679485559f},
-std::array<float,2>{0.698618829f, 0.0478718989f},
-std::array<float,2>{0.630415678f, 0.990222156f},
-std::array<float,2>{0.137283325f, 0.42674005f},
-std::array<float,2>{0.400200993f, 0.609544754f},
-std::array<float,2>{0.948664784f, 0.238388523f},
-std::array<float,2>{0.759107888f, 0.723578155f},
-std::array<float,2>{0.292809725f, 0.0940679535f},
-std::array<float,2>{0.0993267298f, 0.816358685f},
-std::array<float,2>{0.512143791f, 0.275467575f},
-std::array<float,2>{0.739521682f, 0.627282917f},
-std::array<float,2>{0.224245653f, 0.0198920015f},
-std::array<float,2>{0.473665982f, 0.77120322f},
-std::array<float,2>{0.924752831f, 0.337840289f},
-std::array<float,2>{0.830666006f, 0.904793382f},
-std::array<float,2>{0.322393626f, 0.438411772f},
-std::array<float,2>{0.058005359f, 0.527138591f},
-std::array<float,2>{0.598556101f, 0.183363825f},
-std::array<float,2>{0.536509275f, 0.856485784f},
-std::array<float,2>{0.0632450059f, 0.306483507f},
-std::array<float,2>{0.251491517f, 0.707597315f},
-std::array<float,2>{0.800979078f, 0.0820682943f},
-std::array<float,2>{0.982857406f, 0.58583796f},
-std::array<float,2>{0.421304375f, 0.18754828f},
-std::array<float,2>{0.162031397f, 0.961361885f},
-std::array<float,2>{0.686838984f, 0.382776082f},
-std::array<float,2>{0.638836622f, 0.5620839f},
-std::array<float,2>{0.125306785f, 0.141335279f},
-std::array<float,2>{0.39502421f, 0.935511351f},
-std::array<float,2>{0.944456875f, 0.471451014f},
-std::array<float,2>{0.75222671f, 0.798854351f},
-std::array<float,2>{0.286195427f, 0.349691033f},
-std::array<float,2>{0.106835142f, 0.657668531f},
-std::array<float,2>{0.500999928f, 0.0415356308f},
-std::array<float,2>{0.584814012f, 0.971416712f},
-std::array<float,2>{0.00444774516f, 0.417324245f},
-std::array<float,2>{0.369683504f, 0.593835771f},
-std::array<float,2>{0.857535243f, 0.224138185f},
-std::array<float,2>{0.87926513f, 0.737083912f},
-std::array<float,2>{0.438503504f, 0.116443187f},
-std::array<float,2>{0.216229931f, 0.83404839f},
-std::array<float,2>{0.693693101f, 0.252649486f},
-std::array<float,2>{0.545112193f, 0.643621922f},
-std::array<float,2>{0.0753208175f, 0.00181133125f},
-std::array<float,2>{0.261128634f, 0.763616025f},
-std::array<float,2>{0.810307801f, 0.324046761f},
-std::array<float,2>{0.975104213f, 0.881364644f},
-std::array<float,2>{0.408007443f, 0.457311779f},
-std::array<float,2>{0.170857936f, 0.502562404f},
-std::array<float,2>{0.679409683f, 0.171602383f},
-std::array<float,2>{0.742593884f, 0.86479044f},
-std::array<float,2>{0.226966739f, 0.290293574f},
-std::array<float,2>{0.478420019f, 0.701643229f},
-std::array<float,2>{0.935079992f, 0.0676991791f},
-std::array<float,2>{0.84074229f, 0.573538184f},
-std::array<float,2>{0.320229113f, 0.210965812f},
-std::array<float,2>{0.0496817343f, 0.948129296f},
-std::array<float,2>{0.609093487f, 0.403028876f},
-std::array<float,2>{0.619287908f, 0.614355087f},
-std::array<float,2>{0.0423549265f, 0.235758841f},
-std::array<float,2>{0.332063556f, 0.985331416f},
-std::array<float,2>{0.823343515f, 0.422814071f},
-std::array<float,2>{0.911412537f, 0.818385065f},
-std::array<float,2>{0.485845774f, 0.281017095f},
-std::array<float,2>{0.236441866f, 0.719489813f},
-std::array<float,2>{0.73430717f, 0.099981755f},
-std::array<float,2>{0.658393323f, 0.911555231f},
-std::array<float,2>{0.179485872f, 0.496135563f},
-std::array<float,2>{0.423126698f, 0.532303691f},
-std::array<float,2>{0.998731017f, 0.127361104f},
-std::array<float,2>{0.788792849f, 0.671875656f},
-std::array<float,2>{0.272349894f, 0.0530379452f},
-std::array<float,2>{0.0816549957f, 0.78311348f},
-std::array<float,2>{0.559646249f, 0.373995662f},
-std::array<float,2>{0.703940332f, 0.705579519f},
-std::array<float,2>{0.193307996f, 0.0790652558f},
-std::array<float,2>{0.467202544f, 0.85463196f},
-std::array<float,2>{0.905373216f, 0.312343031f},
-std::array<float,2>{0.862231314f, 0.965421081f},
-std::array<float,2>{0.352821916f, 0.377140403f},
-std::array<float,2>{0.0215872452f, 0.579994678f},
-std::array<float,2>{0.57049793f, 0.191609263f},
-std::array<float,2>{0.523361802f, 0.767693162f},
-std::array<float,2>{0.118062325f, 0.342013568f},
-std::array<float,2>{0.306873113f, 0.62927115f},
-std::array<float,2>{0.772890806f, 0.0157021098f},
-std::array<float,2>{0.966478705f, 0.530839443f},
-std::array<float,2>{0.381710023f, 0.18519412f},
-std::array<float,2>{0.142209843f, 0.901669681f},
-std::array<float,2>{0.641964376f, 0.445103526f},
-std::array<float,2>{0.723256111f, 0.587619185f},
-std::array<float,2>{0.248221889f, 0.202795461f},
-std::array<float,2>{0.498875588f, 0.960339785f},
-std::array<float,2>{0.920854568f, 0.383677572f},
-std::array<float,2>{0.816022396f, 0.85082835f},
-std::array<float,2>{0.337109894f, 0.297402918f},
-std::array<float,2>{0.0327732749f, 0.716478407f},
-std::array<float,2>{0.611087978f, 0.0870487243f},
-std::array<float,2>{0.552391231f, 0.895601451f},
-std::array<float,2>{0.0908161178f, 0.450684339f},
-std::array<float,2>{0.278149486f, 0.516824841f},
-std::array<float,2>{0.790377796f, 0.173741817f},
-std::array<float,2>{0.989764452f, 0.634666741f},
-std::array<float,2>{0.43274194f, 0.0279323105f},
-std::array<float,2>{0.187142119f, 0.775464535f},
-std::array<float,2>{0.664301276f, 0.328722775f},
-std::array<float,2>{0.568452954f, 0.733136773f},
-std::array<float,2>{0.0298424494f, 0.103323624f},
-std::array<float,2>{0.348271072f, 0.82652092f},
-std::array<float,2>{0.871458709f, 0.271131188f},
-std::array<float,2>{0.895594954f, 0.992718995f},
-std::array<float,2>{0.458761841f, 0.433892637f},
-std::array<float,2>{0.202039853f, 0.618968844f},
-std::array<float,2>{0.715921879f, 0.249840572f},
-std::array<float,2>{0.648646235f, 0.795349121f},
-std::array<float,2>{0.151019841f, 0.361123472f},
-std::array<float,2>{0.389598042f, 0.679984212f},
-std::array<float,2>{0.957212389f, 0.0623512901f},
-std::array<float,2>{0.775401831f, 0.540451646f},
-std::array<float,2>{0.30033794f, 0.137821749f},
-std::array<float,2>{0.111181274f, 0.91748327f},
-std::array<float,2>{0.52654928f, 0.488538027f},
-std::array<float,2>{0.509062767f, 0.510806918f},
-std::array<float,2>{0.0957467183f, 0.158889905f},
-std::array<float,2>{0.295946956f, 0.886641979f},
-std::array<float,2>{0.762931943f, 0.467521727f},
-std::array<float,2>{0.952712178f, 0.757753015f},
-std::array<float,2>{0.40255633f, 0.318479955f},
-std::array<float,2>{0.136471719f, 0.653968036f},
-std::array<float,2>{0.625735998f, 0.00988294743f},
-std::array<float,2>{0.69936955f, 0.944140792f},
-std::array<float,2>{0.210326031f, 0.395592093f},
-std::array<float,2>{0.446001887f, 0.564857185f},
-std::array<float,2>{0.889496088f, 0.207681835f},
-std::array<float,2>{0.847575426f, 0.69428426f},
-std::array<float,2>{0.362822294f, 0.0751295462f},
-std::array<float,2>{0.00905448105f, 0.86732173f},
-std::array<float,2>{0.591320455f, 0.287816405f},
-std::array<float,2>{0.679900706f, 0.665091455f},
-std::array<float,2>{0.157409012f, 0.0375672318f},
-std::array<float,2>{0.414440244f, 0.811687052f},
-std::array<float,2>{0.980389953f, 0.355959743f},
-std::array<float,2>{0.800416231f, 0.929675221f},
-std::array<float,2>{0.256951869f, 0.48294726f},
-std::array<float,2>{0.0691261441f, 0.551544607f},
-std::array<float,2>{0.532516181f, 0.154639199f},
-std::array<float,2>{0.596064031f, 0.840715587f},
-std::array<float,2>{0.0624483116f, 0.263733327f},
-std::array<float,2>{0.327422231f, 0.747331262f},
-std::array<float,2>{0.833886802f, 0.122104831f},
-std::array<float,2>{0.927603543f, 0.6019153f},
-std::array<float,2>{0.470990807f, 0.231168762f},
-std::array<float,2>{0.220484748f, 0.978234887f},
-std::array<float,2>{0.73553288f, 0.410029799f},
-std::array<float,2>{0.746478558f, 0.546745181f},
-std::array<float,2>{0.230490386f, 0.133292884f},
-std::array<float,2>{0.481949508f, 0.921282232f},
-std::array<float,2>{0.930036783f, 0.4864133f},
-std::array<float,2>{0.839553773f, 0.789639652f},
-std::array<float,2>{0.314071417f, 0.364023477f},
-std::array<float,2>{0.0510314479f, 0.684546828f},
-std::array<float,2>{0.604282022f, 0.0553494133f},
-std::array<float,2>{0.540245473f, 0.999769866f},
-std::array<float,2>{0.0722566023f, 0.43038711f},
-std::array<float,2>{0.263973832f, 0.622936189f},
-std::array<float,2>{0.806176841f, 0.242488861f},
-std::array<float,2>{0.971546531f, 0.727985799f},
-std::array<float,2>{0.411285281f, 0.105493873f},
-std::array<float,2>{0.167900041f, 0.822602749f},
-std::array<float,2>{0.67473048f, 0.267000973f},
-std::array<float,2>{0.58078897f, 0.638768435f},
-std::array<float,2>{0.0035257847f, 0.0250862744f},
-std::array<float,2>{0.374888271f, 0.78050369f},
-std::array<float,2>{0.855355918f, 0.333738357f},
-std::array<float,2>{0.875467598f, 0.892397046f},
-std::array<float,2>{0.44191131f, 0.447428524f},
-std::array<float,2>{0.214139745f, 0.522657037f},
-std::array<float,2>{0.690746725f, 0.178791121f},
-std::array<float,2>{0.636102796f, 0.844896317f},
-std::array<float,2>{0.131755024f, 0.302591264f},
-std::array<float,2>{0.392289162f, 0.712015986f},
-std::array<float,2>{0.93775624f, 0.0934528336f},
-std::array<float,2>{0.755907834f, 0.593352199f},
-std::array<float,2>{0.28425166f, 0.198825911f},
-std::array<float,2>{0.102296658f, 0.955461025f},
-std::array<float,2>{0.506732285f, 0.387413174f},
-std::array<float,2>{0.517030537f, 0.605713487f},
-std::array<float,2>{0.1224612f, 0.227028519f},
-std::array<float,2>{0.309024334f, 0.980690837f},
-std::array<float,2>{0.766192615f, 0.410709828f},
-std::array<float,2>{0.963575244f, 0.838929415f},
-std::array<float,2>{0.377736866f, 0.261205256f},
-std::array<float,2>{0.147250235f, 0.742859304f},
-std::array<float,2>{0.646287978f, 0.117864177f},
-std::array<float,2>{0.708610713f, 0.924825191f},
-std::array<float,2>{0.187571838f, 0.47727108f},
-std::array<float,2>{0.462127715f, 0.550273895f},
-std::array<float,2>{0.90149653f, 0.148664162f},
-std::array<float,2>{0.866242051f, 0.671203196f},
-std::array<float,2>{0.357218772f, 0.0327472948f},
-std::array<float,2>{0.0183269344f, 0.808498621f},
-std::array<float,2>{0.574994385f, 0.353230387f},
-std::array<float,2>{0.660406113f, 0.688789427f},
-std::array<float,2>{0.173487321f, 0.070456259f},
-std::array<float,2>{0.427062362f, 0.874282956f},
-std::array<float,2>{0.992739022f, 0.282527477f},
-std::array<float,2>{0.78276217f, 0.938688874f},
-std::array<float,2>{0.269194275f, 0.39302054f},
-std::array<float,2>{0.0822651684f, 0.567851722f},
-std::array<float,2>{0.557596922f, 0.204930022f},
-std::array<float,2>{0.621406555f, 0.75175482f},
-std::array<float,2>{0.0432287492f, 0.313949406f},
-std::array<float,2>{0.331960082f, 0.650738716f},
-std::array<float,2>{0.826043844f, 0.014914345f},
-std::array<float,2>{0.90948832f, 0.512791693f},
-std::array<float,2>{0.490952343f, 0.161539808f},
-std::array<float,2>{0.240690336f, 0.88990289f},
-std::array<float,2>{0.727524042f, 0.46411261f},
-std::array<float,2>{0.654577076f, 0.574846387f},
-std::array<float,2>{0.152553856f, 0.218127891f},
-std::array<float,2>{0.383439392f, 0.949372053f},
-std::array<float,2>{0.956499815f, 0.402220637f},
-std::array<float,2>{0.780938983f, 0.861073852f},
-std::array<float,2>{0.302898258f, 0.294401377f},
-std::array<float,2>{0.115850307f, 0.698045075f},
-std::array<float,2>{0.530872166f, 0.062705569f},
-std::array<float,2>{0.563152313f, 0.876493394f},
-std::array<float,2>{0.0267502498f, 0.455885112f},
-std::array<float,2>{0.346547812f, 0.505460799f},
-std::array<float,2>{0.870234728f, 0.167529494f},
-std::array<float,2>{0.893387556f, 0.647803247f},
-std::array<float,2>{0.45617038f, 0.00536212604f},
-std::array<float,2>{0.196225896f, 0.760074973f},
-std::array<float,2>{0.712861121f, 0.326432467f},
-std::array<float,2>{0.548951328f, 0.738898516f},
-std::array<float,2>{0.0875713378f, 0.10947872f},
-std::array<float,2>{0.273540705f, 0.83005327f},
-std::array<float,2>{0.794144034f, 0.254698187f},
-std::array<float,2>{0.986600399f, 0.9741835f},
-std::array<float,2>{0.436955571f, 0.418871313f},
-std::array<float,2>{0.183179796f, 0.600284696f},
-std::array<float,2>{0.669216037f, 0.220791832f},
-std::array<float,2>{0.721294701f, 0.801076233f},
-std::array<float,2>{0.244204238f, 0.347373843f},
-std::array<float,2>{0.494762927f, 0.661326528f},
-std::array<float,2>{0.915188491f, 0.0455700643f},
-std::array<float,2>{0.817617774f, 0.556762874f},
-std::array<float,2>{0.343282342f, 0.146351114f},
-std::array<float,2>{0.0370209925f, 0.932188213f},
-std::array<float,2>{0.615872741f, 0.474062234f},
-std::array<float,2>{0.60098815f, 0.523521245f},
-std::array<float,2>{0.0550953113f, 0.180351585f},
-std::array<float,2>{0.322080463f, 0.90311718f},
-std::array<float,2>{0.829943597f, 0.441064686f},
-std::array<float,2>{0.923301041f, 0.772289038f},
-std::array<float,2>{0.47599417f, 0.339074373f},
-std::array<float,2>{0.225073993f, 0.626248002f},
-std::array<float,2>{0.740312696f, 0.0224760324f},
-std::array<float,2>{0.685418189f, 0.963478267f},
-std::array<float,2>{0.164057061f, 0.378971875f},
-std::array<float,2>{0.419844717f, 0.583092988f},
-std::array<float,2>{0.980513871f, 0.189555109f},
-std::array<float,2>{0.804047883f, 0.710570633f},
-std::array<float,2>{0.252053618f, 0.0855725706f},
-std::array<float,2>{0.0652155578f, 0.858280957f},
-std::array<float,2>{0.538249791f, 0.307915628f},
-std::array<float,2>{0.696842015f, 0.677569151f},
-std::array<float,2>{0.20475781f, 0.0503755063f},
-std::array<float,2>{0.449452549f, 0.785942852f},
-std::array<float,2>{0.886227906f, 0.371019661f},
-std::array<float,2>{0.851082981f, 0.908243835f},
-std::array<float,2>{0.366939127f, 0.49475655f},
-std::array<float,2>{0.013886801f, 0.53829366f},
-std::array<float,2>{0.589175224f, 0.13274841f},
-std::array<float,2>{0.514702022f, 0.814023316f},
-std::array<float,2>{0.10115885f, 0.274383873f},
-std::array<float,2>{0.290755153f, 0.72619468f},
-std::array<float,2>{0.760819733f, 0.0968888029f},
-std::array<float,2>{0.947246075f, 0.612893343f},
-std::array<float,2>{0.402092427f, 0.241516858f},
-std::array<float,2>{0.138787791f, 0.992146432f},
-std::array<float,2>{0.632044613f, 0.428128988f},
-std::array<float,2>{0.677380323f, 0.501767039f},
-std::array<float,2>{0.168634325f, 0.168635219f},
-std::array<float,2>{0.409582734f, 0.879413962f},
-std::array<float,2>{0.973184884f, 0.460586131f},
-std::array<float,2>{0.810975313f, 0.764632344f},
-std::array<float,2>{0.258451313f, 0.322219431f},
-std::array<float,2>{0.0772964135f, 0.64083159f},
-std::array<float,2>{0.544501066f, 0.00340458681f},
-std::array<float,2>{0.606510937f, 0.94662261f},
-std::array<float,2>{0.0470506996f, 0.405562103f},
-std::array<float,2>{0.316636264f, 0.571717381f},
-std::array<float,2>{0.843634963f, 0.213034734f},
-std::array<float,2>{0.935780883f, 0.701161861f},
-std::array<float,2>{0.479283154f, 0.0697704554f},
-std::array<float,2>{0.23003076f, 0.865926564f},
-std::array<float,2>{0.744650006f, 0.291336268f},
-std::array<float,2>{0.502484083f, 0.658756316f},
-std::array<float,2>{0.107786298f, 0.0409674533f},
-std::array<float,2>{0.288079441f, 0.797893226f},
-std::array<float,2>{0.750733197f, 0.349486142f},
-std::array<float,2>{0.941457272f, 0.936151862f},
-std::array<float,2>{0.396564305f, 0.46973145f},
-std::array<float,2>{0.128322303f, 0.559764326f},
-std::array<float,2>{0.637076199f, 0.144391909f},
-std::array<float,2>{0.692164302f, 0.832761347f},
-std::array<float,2>{0.217613652f, 0.25007391f},
-std::array<float,2>{0.439821571f, 0.736263454f},
-std::array<float,2>{0.881082773f, 0.115180232f},
-std::array<float,2>{0.856923223f, 0.596906006f},
-std::array<float,2>{0.367879927f, 0.226037428f},
-std::array<float,2>{0.00649733003f, 0.969608188f},
-std::array<float,2>{0.583359361f, 0.415941715f},
-std::array<float,2>{0.572583973f, 0.581931949f},
-std::array<float,2>{0.0200613458f, 0.193842247f},
-std::array<float,2>{0.355212092f, 0.967073202f},
-std::array<float,2>{0.860411704f, 0.375737041f},
-std::array<float,2>{0.903023243f, 0.853370607f},
-std::array<float,2>{0.465980917f, 0.308805168f},
-std::array<float,2>{0.193411097f, 0.703474283f},
-std::array<float,2>{0.70592463f, 0.0815660208f},
-std::array<float,2>{0.644312143f, 0.899946034f},
-std::array<float,2>{0.143903404f, 0.441652834f},
-std::array<float,2>{0.380810142f, 0.528053761f},
-std::array<float,2>{0.968189001f, 0.186273769f},
-std::array<float,2>{0.77101922f, 0.632701159f},
-std::array<float,2>{0.305279166f, 0.019517459f},
-std::array<float,2>{0.119879112f, 0.766597986f},
-std::array<float,2>{0.519668996f, 0.341763884f},
-std::array<float,2>{0.731406689f, 0.722112477f},
-std::array<float,2>{0.23469618f, 0.0981380492f},
-std::array<float,2>{0.487670302f, 0.816631198f},
-std::array<float,2>{0.912373126f, 0.277397573f},
-std::array<float,2>{0.821997762f, 0.986823797f},
-std::array<float,2>{0.335037589f, 0.425588906f},
-std::array<float,2>{0.0404956192f, 0.616344094f},
-std::array<float,2>{0.618367791f, 0.237971887f},
-std::array<float,2>{0.562117159f, 0.783357978f},
-std::array<float,2>{0.0793738812f, 0.371253669f},
-std::array<float,2>{0.270281702f, 0.674508691f},
-std::array<float,2>{0.786989987f, 0.0516359583f},
-std::array<float,2>{0.997393131f, 0.53420949f},
-std::array<float,2>{0.42562443f, 0.125504807f},
-std::array<float,2>{0.176530182f, 0.913150489f},
-std::array<float,2>{0.656991422f, 0.499369502f},
-std::array<float,2>{0.718619704f, 0.620319843f},
-std::array<float,2>{0.200388014f, 0.247364536f},
-std::array<float,2>{0.459822685f, 0.994735897f},
-std::array<float,2>{0.898053348f, 0.43615073f},
-std::array<float,2>{0.873582125f, 0.824767768f},
-std::array<float,2>{0.351512522f, 0.27179116f},
-std::array<float,2>{0.0285700019f, 0.73167634f},
-std::array<float,2>{0.567674756f, 0.105044678f},
-std::array<float,2>{0.524795592f, 0.91490519f},
-std::array<float,2>{0.112126268f, 0.49123019f},
-std::array<float,2>{0.297279596f, 0.541399062f},
-std::array<float,2>{0.773866653f, 0.139119416f},
-std::array<float,2>{0.959084332f, 0.682400405f},
-std::array<float,2>{0.388572752f, 0.0596810803f},
-std::array<float,2>{0.149975941f, 0.793475151f},
-std::array<float,2>{0.651367128f, 0.362322539f},
-std::array<float,2>{0.61219275f, 0.717711985f},
-std::array<float,2>{0.0347706601f, 0.0891615823f},
-std::array<float,2>{0.338928878f, 0.848936021f},
-std::array<float,2>{0.814094067f, 0.299177676f},
-std::array<float,2>{0.919489086f, 0.957134008f},
-std::array<float,2>{0.49630332f, 0.386285901f},
-std::array<float,2>{0.247910917f, 0.589251995f},
-std::array<float,2>{0.724809051f, 0.200453758f},
-std::array<float,2>{0.666341305f, 0.774650931f},
-std::array<float,2>{0.184773028f, 0.330304593f},
-std::array<float,2>{0.430978f, 0.63586998f},
-std::array<float,2>{0.991572976f, 0.0294518061f},
-std::array<float,2>{0.792807341f, 0.519408584f},
-std::array<float,2>{0.280404806f, 0.174349114f},
-std::array<float,2>{0.0936900824f, 0.896672964f},
-std::array<float,2>{0.553317487f, 0.452049345f},
-std::array<float,2>{0.533256829f, 0.553794324f},
-std::array<float,2>{0.0668276772f, 0.152684703f},
-std::array<float,2>{0.254757762f, 0.926665246f},
-std::array<float,2>{0.797420621f, 0.481560081f},
-std::array<float,2>{0.978415668f, 0.810482383f},
-std::array<float,2>{0.416938543f, 0.357851803f},
-std::array<float,2>{0.158314139f, 0.666903913f},
-std::array<float,2>{0.682861626f, 0.0358977169f},
-std::array<float,2>{0.736350417f, 0.979638577f},
-std::array<float,2>{0.221615672f, 0.406821281f},
-std::array<float,2>{0.469584286f, 0.605127335f},
-std::array<float,2>{0.929662585f, 0.23399286f},
-std::array<float,2>{0.834210575f, 0.748695731f},
-std::array<float,2>{0.324848592f, 0.123684652f},
-std::array<float,2>{0.0605338253f, 0.842250109f},
-std::array<float,2>{0.595085025f, 0.262189686f},
-std::array<float,2>{0.628410995f, 0.654613316f},
-std::array<float,2>{0.133638918f, 0.00903869979f},
-std::array<float,2>{0.405117244f, 0.755679369f},
-std::array<float,2>{0.95057708f, 0.317090511f},
-std::array<float,2>{0.763925135f, 0.882927537f},
-std::array<float,2>{0.293417364f, 0.466348916f},
-std::array<float,2>{0.0956719369f, 0.508012295f},
-std::array<float,2>{0.511711895f, 0.156392783f},
-std::array<float,2>{0.592542529f, 0.870969951f},
-std::array<float,2>{0.0114463968f, 0.285742819f},
-std::array<float,2>{0.360453397f, 0.691647649f},
-std::array<float,2>{0.844151855f, 0.0775887296f},
-std::array<float,2>{0.888550758f, 0.564239562f},
-std::array<float,2>{0.448201686f, 0.209333271f},
-std::array<float,2>{0.207312718f, 0.942752719f},
-std::array<float,2>{0.70300889f, 0.397473127f},
-std::array<float,2>{0.699041307f, 0.538853049f},
-std::array<float,2>{0.205458581f, 0.131872267f},
-std::array<float,2>{0.452637494f, 0.909048915f},
-std::array<float,2>{0.88382709f, 0.494305044f},
-std::array<float,2>{0.849424005f, 0.785281301f},
-std::array<float,2>{0.364625871f, 0.370458364f},
-std::array<float,2>{0.0124728922f, 0.677027702f},
-std::array<float,2>{0.586616933f, 0.0500737168f},
-std::array<float,2>{0.512427449f, 0.991535783f},
-std::array<float,2>{0.0987723842f, 0.428274333f},
-std::array<float,2>{0.29227972f, 0.612359881f},
-std::array<float,2>{0.759471834f, 0.241782904f},
-std::array<float,2>{0.948809087f, 0.725785255f},
-std::array<float,2>{0.399811506f, 0.0973688811f},
-std::array<float,2>{0.137034699f, 0.813879192f},
-std::array<float,2>{0.630161166f, 0.273863703f},
-std::array<float,2>{0.598117828f, 0.626748204f},
-std::array<float,2>{0.058277756f, 0.0232466087f},
-std::array<float,2>{0.32316494f, 0.771822393f},
-std::array<float,2>{0.830425084f, 0.339604467f},
-std::array<float,2>{0.92406261f, 0.902606606f},
-std::array<float,2>{0.474223465f, 0.440759838f},
-std::array<float,2>{0.224093989f, 0.524197817f},
-std::array<float,2>{0.740109146f, 0.179890648f},
-std::array<float,2>{0.687369645f, 0.857742667f},
-std::array<float,2>{0.161544636f, 0.308307946f},
-std::array<float,2>{0.421630651f, 0.710077941f},
-std::array<float,2>{0.983223796f, 0.0852066055f},
-std::array<float,2>{0.801682055f, 0.583592951f},
-std::array<float,2>{0.251192689f, 0.190361336f},
-std::array<float,2>{0.0625908673f, 0.962984502f},
-std::array<float,2>{0.537057281f, 0.379461795f},
-std::array<float,2>{0.546917617f, 0.599703789f},
-std::array<float,2>{0.0883859396f, 0.221450523f},
-std::array<float,2>{0.276284099f, 0.973647296f},
-std::array<float,2>{0.796587884f, 0.418221802f},
-std::array<float,2>{0.985199332f, 0.82919234f},
-std::array<float,2>{0.433620304f, 0.254139185f},
-std::array<float,2>{0.179834306f, 0.738665938f},
-std::array<float,2>{0.670479536f, 0.110242799f},
-std::array<float,2>{0.719809115f, 0.931786537f},
-std::array<float,2>{0.243717164f, 0.474578023f},
-std::array<float,2>{0.49405992f, 0.557239413f},
-std::array<float,2>{0.916802049f, 0.145664543f},
-std::array<float,2>{0.819038093f, 0.662031412f},
-std::array<float,2>{0.341098726f, 0.0451821089f},
-std::array<float,2>{0.0372826234f, 0.801381052f},
-std::array<float,2>{0.613555193f, 0.346705616f},
-std::array<float,2>{0.654039621f, 0.697452903f},
-std::array<float,2>{0.155929893f, 0.0633015782f},
-std::array<float,2>{0.385976404f, 0.860482752f},
-std::array<float,2>{0.954406559f, 0.294656694f},
-std::array<float,2>{0.778740942f, 0.949852288f},
-std::array<float,2>{0.300957263f, 0.401549995f},
-std::array<float,2>{0.113342568f, 0.574661791f},
-std::array<float,2>{0.529085875f, 0.218607366f},
-std::array<float,2>{0.565449357f, 0.760388553f},
-std::array<float,2>{0.0248171352f, 0.326743752f},
-std::array<float,2>{0.344142526f, 0.648079515f},
-std::array<float,2>{0.868881583f, 0.00559341768f},
-std::array<float,2>{0.89102298f, 0.504940629f},
-std::array<float,2>{0.454327732f, 0.167201132f},
-std::array<float,2>{0.198842585f, 0.87615943f},
-std::array<float,2>{0.714545786f, 0.455468833f},
-std::array<float,2>{0.663648725f, 0.568082929f},
-std::array<float,2>{0.174446449f, 0.204152137f},
-std::array<float,2>{0.428740442f, 0.939044893f},
-std::array<float,2>{0.995650291f, 0.393244505f},
-std::array<float,2>{0.7840572f, 0.874657929f},
-std::array<float,2>{0.266703099f, 0.282791436f},
-std::array<float,2>{0.0841215998f, 0.689078331f},
-std::array<float,2>{0.555485427f, 0.0710859001f},
-std::array<float,2>{0.62411958f, 0.89024663f},
-std::array<float,2>{0.046554558f, 0.464715868f},
-std::array<float,2>{0.32889387f, 0.513364136f},
-std::array<float,2>{0.826182723f, 0.162103131f},
-std::array<float,2>{0.906307936f, 0.651157677f},
-std::array<float,2>{0.488704205f, 0.0155238202f},
-std::array<float,2>{0.23927106f, 0.751028836f},
-std::array<float,2>{0.730288923f, 0.314254761f},
-std::array<float,2>{0.518571854f, 0.742303073f},
-std::array<float,2>{0.124355026f, 0.117405549f},
-std::array<float,2>{0.310571462f, 0.839418352f},
-std::array<float,2>{0.768463433f, 0.26162824f},
-std::array<float,2>{0.962436676f, 0.981186867f},
-std::array<float,2>{0.376053602f, 0.410271138f},
-std::array<float,2>{0.146085352f, 0.606344044f},
-std::array<float,2>{0.647007167f, 0.227340952f},
-std::array<float,2>{0.71069324f, 0.80787313f},
-std::array<float,2>{0.189588279f, 0.352570951f},
-std::array<float,2>{0.464146972f, 0.671702206f},
-std::array<float,2>{0.898527324f, 0.0325353853f},
-std::array<float,2>{0.864583135f, 0.550298393f},
-std::array<float,2>{0.358823508f, 0.14914383f},
-std::array<float,2>{0.0170218777f, 0.925404549f},
-std::array<float,2>{0.57677871f, 0.476941168f},
-std::array<float,2>{0.578847349f, 0.523164213f},
-std::array<float,2>{0.000378498778f, 0.179597989f},
-std::array<float,2>{0.371456563f, 0.892041683f},
-std::array<float,2>{0.853311718f, 0.447795749f},
-std::array<float,2>{0.878440261f, 0.780862272f},
-std::array<float,2>{0.443924636f, 0.333409816f},
-std::array<float,2>{0.211955905f, 0.639516056f},
-std::array<float,2>{0.689349473f, 0.0244412217f},
-std::array<float,2>{0.634492218f, 0.955714822f},
-std::array<float,2>{0.129876569f, 0.387186766f},
-std::array<float,2>{0.3927356f, 0.592937231f},
-std::array<float,2>{0.940650105f, 0.198463768f},
-std::array<float,2>{0.753940642f, 0.712531984f},
-std::array<float,2>{0.282785982f, 0.0931905359f},
-std::array<float,2>{0.104066424f, 0.845560193f},
-std::array<float,2>{0.504096031f, 0.302206993f},
-std::array<float,2>{0.748599291f, 0.683831751f},
-std::array<float,2>{0.232599899f, 0.0551004931f},
-std::array<float,2>{0.483511418f, 0.7893067f},
-std::array<float,2>{0.933378994f, 0.363376498f},
-std::array<float,2>{0.837588191f, 0.921692908f},
-std::array<float,2>{0.314668506f, 0.4868792f},
-std::array<float,2>{0.053983584f, 0.546028554f},
-std::array<float,2>{0.602046847f, 0.133651868f},
-std::array<float,2>{0.542784333f, 0.823108077f},
-std::array<float,2>{0.0731659904f, 0.267146975f},
-std::array<float,2>{0.263333231f, 0.728053868f},
-std::array<float,2>{0.806710243f, 0.105969496f},
-std::array<float,2>{0.968938529f, 0.622310102f},
-std::array<float,2>{0.413999438f, 0.242829144f},
-std::array<float,2>{0.165120125f, 0.999102354f},
-std::array<float,2>{0.672429562f, 0.429982573f},
-std::array<float,2>{0.625211775f, 0.508636415f},
-std::array<float,2>{0.136137798f, 0.157150716f},
-std::array<float,2>{0.403310239f, 0.883664727f},
-std::array<float,2>{0.952504992f, 0.466156393f},
-std::array<float,2>{0.763512909f, 0.755267143f},
-std::array<float,2>{0.296576262f, 0.316552699f},
-std::array<float,2>{0.0964113921f, 0.655004025f},
-std::array<float,2>{0.509652913f, 0.00931216963f},
-std::array<float,2>{0.591283679f, 0.943015337f},
-std::array<float,2>{0.00976141449f, 0.398348719f},
-std::array<float,2>{0.362600058f, 0.563687325f},
-std::array<float,2>{0.847100616f, 0.209625676f},
-std::array<float,2>{0.888776839f, 0.691980183f},
-std::array<float,2>{0.445548326f, 0.0779884458f},
-std::array<float,2>{0.210931316f, 0.870138228f},
-std::array<float,2>{0.700058103f, 0.285190165f},
-std::array<float,2>{0.532854438f, 0.666483343f},
-std::array<float,2>{0.0686719045f, 0.0352132171f},
-std::array<float,2>{0.257609874f, 0.809636414f},
-std::array<float,2>{0.800077915f, 0.358327985f},
-std::array<float,2>{0.979885876f, 0.925847769f},
-std::array<float,2>{0.414811611f, 0.482418805f},
-std::array<float,2>{0.158046111f, 0.554287434f},
-std::array<float,2>{0.680462301f, 0.153268382f},
-std::array<float,2>{0.736121833f, 0.842529356f},
-std::array<float,2>{0.219741836f, 0.262265474f},
-std::array<float,2>{0.47130698f, 0.748226404f},
-std::array<float,2>{0.926829219f, 0.123326272f},
-std::array<float,2>{0.83349359f, 0.604776084f},
-std::array<float,2>{0.327966154f, 0.23376216f},
-std::array<float,2>{0.061833743f, 0.980140746f},
-std::array<float,2>{0.596656561f, 0.406401455f},
-std::array<float,2>{0.610707462f, 0.589491367f},
-std::array<float,2>{0.0322603583f, 0.201144606f},
-std::array<float,2>{0.337459058f, 0.957930565f},
-std::array<float,2>{0.81552428f, 0.385965943f},
-std::array<float,2>{0.920213938f, 0.849250376f},
-std::array<float,2>{0.498529732f, 0.299715281f},
-std::array<float,2>{0.249001428f, 0.717177093f},
-std::array<float,2>{0.723133802f, 0.0896004885f},
-std::array<float,2>{0.664726913f, 0.89712286f},
-std::array<float,2>{0.186608672f, 0.451444685f},
-std::array<float,2>{0.433363527f, 0.518650353f},
-std::array<float,2>{0.98940897f, 0.174000457f},
-std::array<float,2>{0.790540993f, 0.636663377f},
-std::array<float,2>{0.277796507f, 0.0299053062f},
-std::array<float,2>{0.090222545f, 0.775270522f},
-std::array<float,2>{0.552025974f, 0.330811322f},
-std::array<float,2>{0.716745198f, 0.732248247f},
-std::array<float,2>{0.201431841f, 0.104588449f},
-std::array<float,2>{0.458028525f, 0.824453235f},
-std::array<float,2>{0.89648062f, 0.272411436f},
-std::array<float,2>{0.871672571f, 0.994421482f},
-std::array<float,2>{0.347700506f, 0.435833782f},
-std::array<float,2>{0.0293596014f, 0.620706379f},
-std::array<float,2>{0.568907559f, 0.24801819f},
-std::array<float,2>{0.527048945f, 0.793294013f},
-std::array<float,2>{0.110399075f, 0.36323303f},
-std::array<float,2>{0.299962878f, 0.682125807f},
-std::array<float,2>{0.776095867f, 0.0603223294f},
-std::array<float,2>{0.957690299f, 0.54173708f},
-std::array<float,2>{0.388931483f, 0.139625087f},
-std::array<float,2>{0.150745124f, 0.914451182f},
-std::array<float,2>{0.649264693f, 0.492134094f},
-std::array<float,2>{0.733783185f, 0.616875112f},
-std::array<float,2>{0.236935362f, 0.237656981f},
-std::array<float,2>{0.485836238f, 0.986387968f},
-std::array<float,2>{0.911703289f, 0.425005645f},
-std::array<float,2>{0.824092507f, 0.817065954f},
-std::array<float,2>{0.332761586f, 0.278162569f},
-std::array<float,2>{0.0427684039f, 0.722349107f},
-std::array<float,2>{0.619788945f, 0.0984675139f},
-std::array<float,2>{0.560196579f, 0.91404599f},
-std::array<float,2>{0.0815426558f, 0.499845058f},
-std::array<float,2>{0.271605462f, 0.534998178f},
-std::array<float,2>{0.788383305f, 0.125208825f},
-std::array<float,2>{0.998142004f, 0.674265862f},
-std::array<float,2>{0.423696309f, 0.0509690903f},
-std::array<float,2>{0.178788096f, 0.783825338f},
-std::array<float,2>{0.658975482f, 0.37194562f},
-std::array<float,2>{0.571082056f, 0.703805745f},
-std::array<float,2>{0.0222906806f, 0.0815354064f},
-std::array<float,2>{0.35346207f, 0.852598429f},
-std::array<float,2>{0.861755133f, 0.309208602f},
-std::array<float,2>{0.905818999f, 0.967491329f},
-std::array<float,2>{0.467541844f, 0.375069022f},
-std::array<float,2>{0.19241032f, 0.581215501f},
-std::array<float,2>{0.703572273f, 0.193881258f},
-std::array<float,2>{0.642573297f, 0.76591301f},
-std::array<float,2>{0.141728401f, 0.340898365f},
-std::array<float,2>{0.380890399f, 0.632140458f},
-std::array<float,2>{0.966195524f, 0.019024916f},
-std::array<float,2>{0.773065627f, 0.527784586f},
-std::array<float,2>{0.307314873f, 0.185774446f},
-std::array<float,2>{0.117574051f, 0.899661779f},
-std::array<float,2>{0.522922516f, 0.442274213f},
-std::array<float,2>{0.501741469f, 0.560164571f},
-std::array<float,2>{0.107235618f, 0.143838406f},
-std::array<float,2>{0.286938906f, 0.935623169f},
-std::array<float,2>{0.752833307f, 0.47036916f},
-std::array<float,2>{0.944899499f, 0.798723578f},
-std::array<float,2>{0.394757926f, 0.34877345f},
-std::array<float,2>{0.125566989f, 0.658620119f},
-std::array<float,2>{0.639427841f, 0.0400557257f},
-std::array<float,2>{0.693930089f, 0.968787014f},
-std::array<float,2>{0.216674641f, 0.415066808f},
-std::array<float,2>{0.43929702f, 0.597593009f},
-std::array<float,2>{0.879452705f, 0.226103619f},
-std::array<float,2>{0.858350277f, 0.735528231f},
-std::array<float,2>{0.36930874f, 0.114662237f},
-std::array<float,2>{0.00415279204f, 0.832124412f},
-std::array<float,2>{0.584194422f, 0.250502676f},
-std::array<float,2>{0.679155052f, 0.641563416f},
-std::array<float,2>{0.170201495f, 0.00348565308f},
-std::array<float,2>{0.407232642f, 0.76411885f},
-std::array<float,2>{0.97488004f, 0.321676493f},
-std::array<float,2>{0.809724927f, 0.879291832f},
-std::array<float,2>{0.261527807f, 0.460212111f},
-std::array<float,2>{0.0757320523f, 0.501456439f},
-std::array<float,2>{0.545756578f, 0.168259412f},
-std::array<float,2>{0.60858655f, 0.865448833f},
-std::array<float,2>{0.0489865616f, 0.291559219f},
-std::array<float,2>{0.319813222f, 0.700633585f},
-std::array<float,2>{0.840280116f, 0.0701190829f},
-std::array<float,2>{0.934860468f, 0.572021842f},
-std::array<float,2>{0.477797836f, 0.213458538f},
-std::array<float,2>{0.227140456f, 0.946974158f},
-std::array<float,2>{0.743022621f, 0.405898094f},
-std::array<float,2>{0.741094291f, 0.526604235f},
-std::array<float,2>{0.225513712f, 0.182857722f},
-std::array<float,2>{0.476173073f, 0.904508948f},
-std::array<float,2>{0.923642337f, 0.437808365f},
-std::array<float,2>{0.829451263f, 0.770806015f},
-std::array<float,2>{0.321451783f, 0.337346852f},
-std::array<float,2>{0.0554472543f, 0.627534926f},
-std::array<float,2>{0.601135552f, 0.020292474f},
-std::array<float,2>{0.539048374f, 0.961444438f},
-std::array<float,2>{0.0648651943f, 0.381899357f},
-std::array<float,2>{0.252593428f, 0.585163891f},
-std::array<float,2>{0.804250062f, 0.187989816f},
-std::array<float,2>{0.981008828f, 0.707211435f},
-std::array<float,2>{0.419146389f, 0.0829840079f},
-std::array<float,2>{0.163295776f, 0.857230067f},
-std::array<float,2>{0.684818804f, 0.306057155f},
-std::array<float,2>{0.589472055f, 0.678882003f},
-std::array<float,2>{0.014402057f, 0.0483673327f},
-std::array<float,2>{0.3663342f, 0.788032711f},
-std::array<float,2>{0.850682855f, 0.368863761f},
-std::array<float,2>{0.886542916f, 0.906261146f},
-std::array<float,2>{0.449713945f, 0.493773192f},
-std::array<float,2>{0.204195201f, 0.535865664f},
-std::array<float,2>{0.69662863f, 0.130077794f},
-std::array<float,2>{0.63246721f, 0.815774322f},
-std::array<float,2>{0.139503211f, 0.276064664f},
-std::array<float,2>{0.401425838f, 0.72296524f},
-std::array<float,2>{0.946727097f, 0.0947193876f},
-std::array<float,2>{0.761672854f, 0.609864116f},
-std::array<float,2>{0.290487081f, 0.239225224f},
-std::array<float,2>{0.100610025f, 0.989347339f},
-std::array<float,2>{0.515489578f, 0.425792575f},
-std::array<float,2>{0.530641735f, 0.576249957f},
-std::array<float,2>{0.115548275f, 0.215318069f},
-std::array<float,2>{0.303642869f, 0.951967537f},
-std::array<float,2>{0.780512571f, 0.399573177f},
-std::array<float,2>{0.956897259f, 0.86141324f},
-std::array<float,2>{0.382839948f, 0.296723038f},
-std::array<float,2>{0.153069049f, 0.696913183f},
-std::array<float,2>{0.654960394f, 0.065213494f},
-std::array<float,2>{0.7120772f, 0.878514171f},
-std::array<float,2>{0.195376888f, 0.453964204f},
-std::array<float,2>{0.456805795f, 0.50631088f},
-std::array<float,2>{0.892799437f, 0.165736496f},
-std::array<float,2>{0.87089318f, 0.646406829f},
-std::array<float,2>{0.34586823f, 0.0065950267f},
-std::array<float,2>{0.0269075204f, 0.759291887f},
-std::array<float,2>{0.5625512f, 0.325043231f},
-std::array<float,2>{0.669697165f, 0.741385102f},
-std::array<float,2>{0.182795614f, 0.111913867f},
-std::array<float,2>{0.437023252f, 0.831653774f},
-std::array<float,2>{0.986896515f, 0.257705629f},
-std::array<float,2>{0.794659436f, 0.975214779f},
-std::array<float,2>{0.274385452f, 0.421391666f},
-std::array<float,2>{0.0873740837f, 0.598701775f},
-std::array<float,2>{0.549585044f, 0.218911931f},
-std::array<float,2>{0.615379453f, 0.803524256f},
-std::array<float,2>{0.0361419134f, 0.344473779f},
-std::array<float,2>{0.342908293f, 0.662743032f},
-std::array<float,2>{0.818357468f, 0.0435654558f},
-std::array<float,2>{0.915816665f, 0.555474102f},
-std::array<float,2>{0.494176179f, 0.148001403f},
-std::array<float,2>{0.245096073f, 0.92991215f},
-std::array<float,2>{0.720895469f, 0.474845827f},
-std::array<float,2>{0.645526767f, 0.608211339f},
-std::array<float,2>{0.146503463f, 0.229562104f},
-std::array<float,2>{0.37734428f, 0.982494414f},
-std::array<float,2>{0.963319778f, 0.412863255f},
-std::array<float,2>{0.765691638f, 0.837469041f},
-std::array<float,2>{0.309227526f, 0.259040922f},
-std::array<float,2>{0.122717604f, 0.745735288f},
-std::array<float,2>{0.517342985f, 0.119158089f},
-std::array<float,2>{0.57448858f, 0.923806489f},
-std::array<float,2>{0.0179109685f, 0.480151743f},
-std::array<float,2>{0.356563658f, 0.547462285f},
-std::array<float,2>{0.867120922f, 0.151903316f},
-std::array<float,2>{0.901928902f, 0.668007851f},
-std::array<float,2>{0.462425739f, 0.0343611762f},
-std::array<float,2>{0.188169718f, 0.804838181f},
-std::array<float,2>{0.708344877f, 0.354837924f},
-std::array<float,2>{0.556902289f, 0.690425754f},
-std::array<float,2>{0.0828672573f, 0.0737589076f},
-std::array<float,2>{0.268964022f, 0.871570408f},
-std::array<float,2>{0.782394946f, 0.285066515f},
-std::array<float,2>{0.992307842f, 0.9406268f},
-std::array<float,2>{0.427313805f, 0.391010642f},
-std::array<float,2>{0.172934622f, 0.569609642f},
-std::array<float,2>{0.660827041f, 0.205346972f},
-std::array<float,2>{0.726695418f, 0.752660096f},
-std::array<float,2>{0.241210371f, 0.315375596f},
-std::array<float,2>{0.49066478f, 0.650030494f},
-std::array<float,2>{0.90994966f, 0.012878865f},
-std::array<float,2>{0.825570107f, 0.514448464f},
-std::array<float,2>{0.331083179f, 0.163122118f},
-std::array<float,2>{0.0438805893f, 0.887469947f},
-std::array<float,2>{0.621878624f, 0.462631434f},
-std::array<float,2>{0.603847384f, 0.544871449f},
-std::array<float,2>{0.0514091216f, 0.136224791f},
-std::array<float,2>{0.313797742f, 0.91990757f},
-std::array<float,2>{0.839154005f, 0.485292643f},
-std::array<float,2>{0.930229723f, 0.792283356f},
-std::array<float,2>{0.48189351f, 0.365589589f},
-std::array<float,2>{0.231188148f, 0.68636775f},
-std::array<float,2>{0.747045398f, 0.0577918217f},
-std::array<float,2>{0.673833072f, 0.997353613f},
-std::array<float,2>{0.167158335f, 0.431673348f},
-std::array<float,2>{0.411769152f, 0.624285042f},
-std::array<float,2>{0.971116245f, 0.244995892f},
-std::array<float,2>{0.805772483f, 0.730093896f},
-std::array<float,2>{0.264626712f, 0.107423879f},
-std::array<float,2>{0.0714127794f, 0.821582556f},
-std::array<float,2>{0.540664494f, 0.269158691f},
-std::array<float,2>{0.691071987f, 0.637675643f},
-std::array<float,2>{0.214507401f, 0.0258333217f},
-std::array<float,2>{0.441413909f, 0.77865684f},
-std::array<float,2>{0.875740469f, 0.334235787f},
-std::array<float,2>{0.854884505f, 0.892716646f},
-std::array<float,2>{0.374419481f, 0.445816785f},
-std::array<float,2>{0.00306053436f, 0.52148211f},
-std::array<float,2>{0.580503464f, 0.176470101f},
-std::array<float,2>{0.506123543f, 0.846941829f},
-std::array<float,2>{0.10162992f, 0.303777844f},
-std::array<float,2>{0.284750938f, 0.713059068f},
-std::array<float,2>{0.756565332f, 0.0917687193f},
-std::array<float,2>{0.938404679f, 0.591160536f},
-std::array<float,2>{0.391629517f, 0.196656525f},
-std::array<float,2>{0.131156802f, 0.954334438f},
-std::array<float,2>{0.636257291f, 0.389658779f},
-std::array<float,2>{0.68323946f, 0.551088154f},
-std::array<float,2>{0.158963963f, 0.155270979f},
-std::array<float,2>{0.416205496f, 0.928841233f},
-std::array<float,2>{0.977593243f, 0.482754618f},
-std::array<float,2>{0.796923757f, 0.812486649f},
-std::array<float,2>{0.254193842f, 0.355898947f},
-std::array<float,2>{0.0673724487f, 0.665727913f},
-std::array<float,2>{0.533715606f, 0.0379555039f},
-std::array<float,2>{0.595289826f, 0.977848947f},
-std::array<float,2>{0.0598545f, 0.409607768f},
-std::array<float,2>{0.324577332f, 0.602470756f},
-std::array<float,2>{0.83480531f, 0.230531633f},
-std::array<float,2>{0.929042637f, 0.747565448f},
-std::array<float,2>{0.469085991f, 0.12259499f},
-std::array<float,2>{0.220771849f, 0.84003067f},
-std::array<float,2>{0.737237155f, 0.264548212f},
-std::array<float,2>{0.511013269f, 0.653707981f},
-std::array<float,2>{0.0948006138f, 0.0107336976f},
-std::array<float,2>{0.293507546f, 0.757206738f},
-std::array<float,2>{0.764339745f, 0.31902647f},
-std::array<float,2>{0.951040924f, 0.885946393f},
-std::array<float,2>{0.404379457f, 0.46685189f},
-std::array<float,2>{0.133194104f, 0.511230946f},
-std::array<float,2>{0.628900945f, 0.158299059f},
-std::array<float,2>{0.702601314f, 0.867812097f},
-std::array<float,2>{0.207897514f, 0.287313849f},
-std::array<float,2>{0.447597802f, 0.693773866f},
-std::array<float,2>{0.88801688f, 0.0745671093f},
-std::array<float,2>{0.84460032f, 0.565237641f},
-std::array<float,2>{0.361325294f, 0.207465187f},
-std::array<float,2>{0.0112014329f, 0.943620086f},
-std::array<float,2>{0.592071772f, 0.396003962f},
-std::array<float,2>{0.568192363f, 0.618400812f},
-std::array<float,2>{0.029151246f, 0.249379218f},
-std::array<float,2>{0.350799471f, 0.992633939f},
-std::array<float,2>{0.873135746f, 0.434175968f},
-std::array<float,2>{0.897561193f, 0.82667017f},
-std::array<float,2>{0.459115237f, 0.270932108f},
-std::array<float,2>{0.200741455f, 0.732779801f},
-std::array<float,2>{0.718126833f, 0.102937497f},
-std::array<float,2>{0.650878191f, 0.917273343f},
-std::array<float,2>{0.149414495f, 0.489005595f},
-std::array<float,2>{0.387807697f, 0.540859699f},
-std::array<float,2>{0.959578693f, 0.138536647f},
-std::array<float,2>{0.774321973f, 0.680410147f},
-std::array<float,2>{0.297491938f, 0.0617759749f},
-std::array<float,2>{0.111455895f, 0.795651555f},
-std::array<float,2>{0.525009155f, 0.360648841f},
-std::array<float,2>{0.725345552f, 0.716183424f},
-std::array<float,2>{0.247256115f, 0.0876998007f},
-std::array<float,2>{0.497016847f, 0.851258636f},
-std::array<float,2>{0.919121385f, 0.297013015f},
-std::array<float,2>{0.813531339f, 0.960475385f},
-std::array<float,2>{0.33962813f, 0.383086354f},
-std::array<float,2>{0.0343727544f, 0.586930692f},
-std::array<float,2>{0.611479402f, 0.202598706f},
-std::array<float,2>{0.552832007f, 0.77591598f},
-std::array<float,2>{0.0929801464f, 0.328301072f},
-std::array<float,2>{0.281231433f, 0.633873641f},
-std::array<float,2>{0.792269528f, 0.0278284941f},
-std::array<float,2>{0.991910577f, 0.517494619f},
-std::array<float,2>{0.431246579f, 0.173223376f},
-std::array<float,2>{0.18515633f, 0.896091938f},
-std::array<float,2>{0.666878343f, 0.450407594f},
-std::array<float,2>{0.705209553f, 0.57918334f},
-std::array<float,2>{0.193999991f, 0.192335784f},
-std::array<float,2>{0.466765702f, 0.965171456f},
-std::array<float,2>{0.902784884f, 0.377481073f},
-std::array<float,2>{0.861134529f, 0.855029583f},
-std::array<float,2>{0.354918718f, 0.311722368f},
-std::array<float,2>{0.0199475884f, 0.705302238f},
-std::array<float,2>{0.572860897f, 0.0782580003f},
-std::array<float,2>{0.520021498f, 0.901951551f},
-std::array<float,2>{0.119501196f, 0.444512516f},
-std::array<float,2>{0.305099726f, 0.530467868f},
-std::array<float,2>{0.770985663f, 0.184700429f},
-std::array<float,2>{0.968419492f, 0.629638374f},
-std::array<float,2>{0.380325556f, 0.016164666f},
-std::array<float,2>{0.144087523f, 0.768133879f},
-std::array<float,2>{0.643678069f, 0.342708409f},
-std::array<float,2>{0.618969023f, 0.718782365f},
-std::array<float,2>{0.0406200215f, 0.100533374f},
-std::array<float,2>{0.335908026f, 0.818967223f},
-std::array<float,2>{0.821391523f, 0.280545056f},
-std::array<float,2>{0.912840128f, 0.984795213f},
-std::array<float,2>{0.488261104f, 0.421914071f},
-std::array<float,2>{0.235230654f, 0.615051329f},
-std::array<float,2>{0.73076278f, 0.236288682f},
-std::array<float,2>{0.656505287f, 0.782611668f},
-std::array<float,2>{0.175824285f, 0.373469681f},
-std::array<float,2>{0.425195575f, 0.672554076f},
-std::array<float,2>{0.997799873f, 0.0535535663f},
-std::array<float,2>{0.786492348f, 0.533051252f},
-std::array<float,2>{0.269917339f, 0.127592713f},
-std::array<float,2>{0.0797350183f, 0.911979496f},
-std::array<float,2>{0.561651528f, 0.496996254f},
-std::array<float,2>{0.544245243f, 0.5020895f},
-std::array<float,2>{0.077702567f, 0.171353146f},
-std::array<float,2>{0.257943451f, 0.881084085f},
-std::array<float,2>{0.811212778f, 0.457666278f},
-std::array<float,2>{0.973108172f, 0.763031304f},
-std::array<float,2>{0.410096198f, 0.323597014f},
-std::array<float,2>{0.168154001f, 0.644408226f},
-std::array<float,2>{0.676917911f, 0.00125831808f},
-std::array<float,2>{0.744289637f, 0.947415829f},
-std::array<float,2>{0.229953542f, 0.402421623f},
-std::array<float,2>{0.478718609f, 0.574068308f},
-std::array<float,2>{0.936396301f, 0.211674333f},
-std::array<float,2>{0.842787623f, 0.701856315f},
-std::array<float,2>{0.31698072f, 0.0680014789f},
-std::array<float,2>{0.0477760769f, 0.864512086f},
-std::array<float,2>{0.60718739f, 0.290993482f},
-std::array<float,2>{0.637518346f, 0.65809679f},
-std::array<float,2>{0.128900439f, 0.0410289131f},
-std::array<float,2>{0.397351295f, 0.799333274f},
-std::array<float,2>{0.942216694f, 0.350478142f},
-std::array<float,2>{0.750016868f, 0.934632719f},
-std::array<float,2>{0.287436068f, 0.471172392f},
-std::array<float,2>{0.108342245f, 0.561834157f},
-std::array<float,2>{0.50235647f, 0.141080618f},
-std::array<float,2>{0.583957493f, 0.834624231f},
-std::array<float,2>{0.00626666984f, 0.252366602f},
-std::array<float,2>{0.367193222f, 0.736788869f},
-std::array<float,2>{0.85723269f, 0.116796263f},
-std::array<float,2>{0.881793797f, 0.594395518f},
-std::array<float,2>{0.440281898f, 0.223676518f},
-std::array<float,2>{0.216950506f, 0.970754862f},
-std::array<float,2>{0.691430628f, 0.417529672f},
-std::array<float,2>{0.713606298f, 0.507766128f},
-std::array<float,2>{0.197547853f, 0.164609939f},
-std::array<float,2>{0.453903317f, 0.877778769f},
-std::array<float,2>{0.892538428f, 0.45462814f},
-std::array<float,2>{0.867283881f, 0.75868088f},
-std::array<float,2>{0.345433444f, 0.325408876f},
-std::array<float,2>{0.0243371818f, 0.645493746f},
-std::array<float,2>{0.565186083f, 0.0069564688f},
-std::array<float,2>{0.52758646f, 0.952163219f},
-std::array<float,2>{0.114946015f, 0.399241298f},
-std::array<float,2>{0.301774919f, 0.577772439f},
-std::array<float,2>{0.777780116f, 0.215968087f},
-std::array<float,2>{0.953691185f, 0.69553858f},
-std::array<float,2>{0.38538307f, 0.065837957f},
-std::array<float,2>{0.155055329f, 0.862523496f},
-std::array<float,2>{0.652495146f, 0.295782179f},
-std::array<float,2>{0.614372015f, 0.663344622f},
-std::array<float,2>{0.038228821f, 0.0448317602f},
-std::array<float,2>{0.340545923f, 0.804593563f},
-std::array<float,2>{0.819815874f, 0.34485662f},
-std::array<float,2>{0.917845488f, 0.931328118f},
-std::array<float,2>{0.493138969f, 0.47564289f},
-std::array<float,2>{0.242981941f, 0.556290269f},
-std::array<float,2>{0.719333112f, 0.147236228f},
-std::array<float,2>{0.67160511f, 0.830563903f},
-std::array<float,2>{0.181447104f, 0.256584078f},
-std::array<float,2>{0.434720188f, 0.741061211f},
-std::array<float,2>{0.985863686f, 0.113059655f},
-std::array<float,2>{0.795441628f, 0.5983603f},
-std::array<float,2>{0.276465923f, 0.219913542f},
-std::array<float,2>{0.0889058486f, 0.975859642f},
-std::array<float,2>{0.548820555f, 0.419936925f},
-std::array<float,2>{0.535362065f, 0.584028065f},
-std::array<float,2>{0.0641705617f, 0.188563481f},
-std::array<float,2>{0.25078544f, 0.962603092f},
-std::array<float,2>{0.802184343f, 0.381791711f},
-std::array<float,2>{0.983698249f, 0.856334329f},
-std::array<float,2>{0.420885265f, 0.305253565f},
-std::array<float,2>{0.161089003f, 0.708120048f},
-std::array<float,2>{0.685979664f, 0.0830889121f},
-std::array<float,2>{0.738476336f, 0.90586555f},
-std::array<float,2>{0.223239258f, 0.438823491f},
-std::array<float,2>{0.473066211f, 0.526126087f},
-std::array<float,2>{0.92559284f, 0.182304338f},
-std::array<float,2>{0.831217706f, 0.628554225f},
-std::array<float,2>{0.323363364f, 0.0212503597f},
-std::array<float,2>{0.0572400279f, 0.769632876f},
-std::array<float,2>{0.59907788f, 0.336091429f},
-std::array<float,2>{0.629807413f, 0.7243613f},
-std::array<float,2>{0.138356403f, 0.0956531763f},
-std::array<float,2>{0.399384588f, 0.814626098f},
-std::array<float,2>{0.948241532f, 0.27710402f},
-std::array<float,2>{0.757974327f, 0.988683462f},
-std::array<float,2>{0.291058421f, 0.427555591f},
-std::array<float,2>{0.0977125838f, 0.611301184f},
-std::array<float,2>{0.512763143f, 0.239439398f},
-std::array<float,2>{0.587595522f, 0.788584709f},
-std::array<float,2>{0.0130166765f, 0.367707551f},
-std::array<float,2>{0.363993496f, 0.678531051f},
-std::array<float,2>{0.848349452f, 0.0474933721f},
-std::array<float,2>{0.883169234f, 0.536970973f},
-std::array<float,2>{0.451408386f, 0.129050776f},
-std::array<float,2>{0.207009435f, 0.907235503f},
-std::array<float,2>{0.697512507f, 0.492753208f},
-std::array<float,2>{0.673068166f, 0.623407483f},
-std::array<float,2>{0.165038541f, 0.24603489f},
-std::array<float,2>{0.412209481f, 0.996986985f},
-std::array<float,2>{0.969937682f, 0.433349967f},
-std::array<float,2>{0.807837486f, 0.820428312f},
-std::array<float,2>{0.262648314f, 0.268445909f},
-std::array<float,2>{0.0735647753f, 0.728932202f},
-std::array<float,2>{0.541128576f, 0.109271318f},
-std::array<float,2>{0.603039324f, 0.918076932f},
-std::array<float,2>{0.0535214506f, 0.48559767f},
-std::array<float,2>{0.315701663f, 0.543592393f},
-std::array<float,2>{0.835983098f, 0.134863794f},
-std::array<float,2>{0.931670487f, 0.687498689f},
-std::array<float,2>{0.48320213f, 0.056656491f},
-std::array<float,2>{0.233755633f, 0.791401923f},
-std::array<float,2>{0.749500453f, 0.366311044f},
-std::array<float,2>{0.504935086f, 0.71466738f},
-std::array<float,2>{0.10494937f, 0.0903251469f},
-std::array<float,2>{0.281486809f, 0.845924616f},
-std::array<float,2>{0.755076826f, 0.302905798f},
-std::array<float,2>{0.939749241f, 0.953894675f},
-std::array<float,2>{0.394443899f, 0.388949066f},
-std::array<float,2>{0.130038857f, 0.590564132f},
-std::array<float,2>{0.633771777f, 0.195751399f},
-std::array<float,2>{0.687538922f, 0.777597904f},
-std::array<float,2>{0.211284116f, 0.335793406f},
-std::array<float,2>{0.445189416f, 0.638434947f},
-std::array<float,2>{0.877712548f, 0.0266593732f},
-std::array<float,2>{0.852389097f, 0.520135105f},
-std::array<float,2>{0.3723979f, 0.177444056f},
-std::array<float,2>{0.0013146915f, 0.894441724f},
-std::array<float,2>{0.579656005f, 0.4467161f},
-std::array<float,2>{0.577234268f, 0.548394561f},
-std::array<float,2>{0.0159797855f, 0.151249006f},
-std::array<float,2>{0.35799107f, 0.921915114f},
-std::array<float,2>{0.864190102f, 0.479281843f},
-std::array<float,2>{0.900346816f, 0.806299329f},
-std::array<float,2>{0.463703573f, 0.354307443f},
-std::array<float,2>{0.190446064f, 0.669273973f},
-std::array<float,2>{0.70968622f, 0.0333223902f},
-std::array<float,2>{0.648028374f, 0.983731687f},
-std::array<float,2>{0.144732609f, 0.413158566f},
-std::array<float,2>{0.375166655f, 0.608841479f},
-std::array<float,2>{0.961714089f, 0.229241535f},
-std::array<float,2>{0.769337475f, 0.744289756f},
-std::array<float,2>{0.312097609f, 0.121006861f},
-std::array<float,2>{0.123731233f, 0.836308956f},
-std::array<float,2>{0.518194556f, 0.257826626f},
-std::array<float,2>{0.729314208f, 0.649399698f},
-std::array<float,2>{0.239034623f, 0.0119383633f},
-std::array<float,2>{0.489318043f, 0.753640056f},
-std::array<float,2>{0.90732348f, 0.315613687f},
-std::array<float,2>{0.827774227f, 0.888652861f},
-std::array<float,2>{0.329429567f, 0.461229146f},
-std::array<float,2>{0.0449354239f, 0.51527226f},
-std::array<float,2>{0.623894095f, 0.162479058f},
-std::array<float,2>{0.556197762f, 0.872345269f},
-std::array<float,2>{0.0853812173f, 0.283481956f},
-std::array<float,2>{0.266213536f, 0.69121474f},
-std::array<float,2>{0.784592211f, 0.0732244849f},
-std::array<float,2>{0.994153023f, 0.569154263f},
-std::array<float,2>{0.428326666f, 0.206976742f},
-std::array<float,2>{0.175429046f, 0.939861417f},
-std::array<float,2>{0.662365973f, 0.392331004f},
-std::array<float,2>{0.649964392f, 0.539900362f},
-std::array<float,2>{0.152242914f, 0.137483552f},
-std::array<float,2>{0.389666319f, 0.916271985f},
-std::array<float,2>{0.958688617f, 0.489640415f},
-std::array<float,2>{0.777095079f, 0.796638072f},
-std::array<float,2>{0.299183965f, 0.360284835f},
-std::array<float,2>{0.109414071f, 0.681488574f},
-std::array<float,2>{0.526137173f, 0.0611361563f},
-std::array<float,2>{0.569437742f, 0.994031549f},
-std::array<float,2>{0.0311970506f, 0.434625745f},
-std::array<float,2>{0.349114299f, 0.617910504f},
-std::array<float,2>{0.872160137f, 0.248893052f},
-std::array<float,2>{0.895053625f, 0.733967185f},
-std::array<float,2>{0.457134783f, 0.102044478f},
-std::array<float,2>{0.202821702f, 0.827195466f},
-std::array<float,2>{0.715479553f, 0.269635469f},
-std::array<float,2>{0.551405668f, 0.633061171f},
-std::array<float,2>{0.0915977955f, 0.0284389928f},
-std::array<float,2>{0.279218823f, 0.776476979f},
-std::array<float,2>{0.789304078f, 0.329544932f},
-std::array<float,2>{0.989172816f, 0.894987881f},
-std::array<float,2>{0.432403803f, 0.449965417f},
-std::array<float,2>{0.186142743f, 0.51587683f},
-std::array<float,2>{0.665513873f, 0.17281951f},
-std::array<float,2>{0.72391504f, 0.85046941f},
-std::array<float,2>{0.24913843f, 0.298401713f},
-std::array<float,2>{0.499760777f, 0.715153813f},
-std::array<float,2>{0.920992553f, 0.0862019584f},
-std::array<float,2>{0.814883351f, 0.586531937f},
-std::array<float,2>{0.33606717f, 0.201533839f},
-std::array<float,2>{0.0318813734f, 0.95922035f},
-std::array<float,2>{0.610099614f, 0.384044111f},
-std::array<float,2>{0.597068965f, 0.602676988f},
-std::array<float,2>{0.061062105f, 0.231857583f},
-std::array<float,2>{0.327082366f, 0.976596236f},
-std::array<float,2>{0.832117081f, 0.408603966f},
-std::array<float,2>{0.926708162f, 0.841724932f},
-std::array<float,2>{0.471695781f, 0.264813989f},
-std::array<float,2>{0.219136834f, 0.746698916f},
-std::array<float,2>{0.73472923f, 0.121237174f},
-std::array<float,2>{0.681228459f, 0.927920938f},
-std::array<float,2>{0.157172158f, 0.48342365f},
-std::array<float,2>{0.415959716f, 0.552121699f},
-std::array<float,2>{0.978762567f, 0.155673459f},
-std::array<float,2>{0.799016953f, 0.664997697f},
-std::array<float,2>{0.256304711f, 0.0389146134f},
-std::array<float,2>{0.0698979124f, 0.810878158f},
-std::array<float,2>{0.532168269f, 0.357049853f},
-std::array<float,2>{0.700742602f, 0.694699228f},
-std::array<float,2>{0.209680066f, 0.0760725215f},
-std::array<float,2>{0.446500033f, 0.86897707f},
-std::array<float,2>{0.889825583f, 0.28824693f},
-std::array<float,2>{0.845742643f, 0.945242941f},
-std::array<float,2>{0.361428022f, 0.395092487f},
-std::array<float,2>{0.00858417805f, 0.566278756f},
-std::array<float,2>{0.590581715f, 0.208409324f},
-std::array<float,2>{0.507950902f, 0.75646919f},
-std::array<float,2>{0.0969592407f, 0.319574267f},
-std::array<float,2>{0.295533657f, 0.653296828f},
-std::array<float,2>{0.762321889f, 0.0116202729f},
-std::array<float,2>{0.95201391f, 0.510108054f},
-std::array<float,2>{0.404251993f, 0.159507394f},
-std::array<float,2>{0.135623485f, 0.885102153f},
-std::array<float,2>{0.626272798f, 0.468466669f},
-std::array<float,2>{0.743367672f, 0.572984159f},
-std::array<float,2>{0.228027925f, 0.212756515f},
-std::array<float,2>{0.477049351f, 0.948697388f},
-std::array<float,2>{0.934486866f, 0.403601855f},
-std::array<float,2>{0.841148019f, 0.863535762f},
-std::array<float,2>{0.319257259f, 0.289741367f},
-std::array<float,2>{0.0504304431f, 0.702387035f},
-std::array<float,2>{0.607655287f, 0.0672494173f},
-std::array<float,2>{0.546658814f, 0.881981075f},
-std::array<float,2>{0.0747514293f, 0.458122015f},
-std::array<float,2>{0.260098964f, 0.503032625f},
-std::array<float,2>{0.80877763f, 0.170345992f},
-std::array<float,2>{0.976112485f, 0.643148541f},
-std::array<float,2>{0.407113224f, 0.000601714652f},
-std::array<float,2>{0.171716481f, 0.762690723f},
-std::array<float,2>{0.678700566f, 0.322567582f},
-std::array<float,2>{0.585321188f, 0.737466216f},
-std::array<float,2>{0.00534357456f, 0.115826294f},
-std::array<float,2>{0.370625734f, 0.835440516f},
-std::array<float,2>{0.859253645f, 0.25331229f},
-std::array<float,2>{0.880602002f, 0.9722386f},
-std::array<float,2>{0.438318729f, 0.416691154f},
-std::array<float,2>{0.215026051f, 0.594851077f},
-std::array<float,2>{0.694477439f, 0.222988293f},
-std::array<float,2>{0.639798105f, 0.800337136f},
-std::array<float,2>{0.126885086f, 0.351214916f},
-std::array<float,2>{0.39637655f, 0.656398892f},
-std::array<float,2>{0.943704426f, 0.0420322791f},
-std::array<float,2>{0.753792882f, 0.56113863f},
-std::array<float,2>{0.285560399f, 0.142349929f},
-std::array<float,2>{0.105759837f, 0.933814526f},
-std::array<float,2>{0.500131845f, 0.471753925f},
-std::array<float,2>{0.522010803f, 0.52970469f},
-std::array<float,2>{0.119050764f, 0.184216857f},
-std::array<float,2>{0.308562845f, 0.900883913f},
-std::array<float,2>{0.772179842f, 0.443451762f},
-std::array<float,2>{0.965481758f, 0.769198954f},
-std::array<float,2>{0.382292449f, 0.342942059f},
-std::array<float,2>{0.141129777f, 0.630330145f},
-std::array<float,2>{0.641350985f, 0.016984975f},
-std::array<float,2>{0.704505742f, 0.965936244f},
-std::array<float,2>{0.191526011f, 0.378866941f},
-std::array<float,2>{0.46856907f, 0.578435063f},
-std::array<float,2>{0.90488106f, 0.192597285f},
-std::array<float,2>{0.862956703f, 0.706865191f},
-std::array<float,2>{0.351717353f, 0.0796590447f},
-std::array<float,2>{0.0233635064f, 0.853847444f},
-std::array<float,2>{0.572129786f, 0.311429083f},
-std::array<float,2>{0.65960139f, 0.673815429f},
-std::array<float,2>{0.177989691f, 0.0539068207f},
-std::array<float,2>{0.421907514f, 0.781868756f},
-std::array<float,2>{0.999624074f, 0.374582827f},
-std::array<float,2>{0.787148058f, 0.91064769f},
-std::array<float,2>{0.273321539f, 0.497101068f},
-std::array<float,2>{0.0805329233f, 0.531636834f},
-std::array<float,2>{0.558895946f, 0.128080368f},
-std::array<float,2>{0.620588183f, 0.819649875f},
-std::array<float,2>{0.0411271341f, 0.280122161f},
-std::array<float,2>{0.333902389f, 0.72025007f},
-std::array<float,2>{0.822783411f, 0.10059756f},
-std::array<float,2>{0.910962343f, 0.613403559f},
-std::array<float,2>{0.485101581f, 0.235184178f},
-std::array<float,2>{0.238011166f, 0.985635459f},
-std::array<float,2>{0.732496262f, 0.42300576f},
-std::array<float,2>{0.721995533f, 0.558293521f},
-std::array<float,2>{0.246058896f, 0.14499867f},
-std::array<float,2>{0.495545655f, 0.932849944f},
-std::array<float,2>{0.914645731f, 0.473091006f},
-std::array<float,2>{0.81692785f, 0.801771164f},
-std::array<float,2>{0.342131466f, 0.345751256f},
-std::array<float,2>{0.0354064964f, 0.660524964f},
-std::array<float,2>{0.616974294f, 0.0460968986f},
-std::array<float,2>{0.549843371f, 0.97361809f},
-std::array<float,2>{0.0860258266f, 0.419217765f},
-std::array<float,2>{0.274806172f, 0.60145539f},
-std::array<float,2>{0.793859005f, 0.222655818f},
-std::array<float,2>{0.987472117f, 0.740191817f},
-std::array<float,2>{0.435785294f, 0.110767186f},
-std::array<float,2>{0.182353854f, 0.828830898f},
-std::array<float,2>{0.668538094f, 0.255508006f},
-std::array<float,2>{0.563486099f, 0.647130132f},
-std::array<float,2>{0.025521446f, 0.00481288042f},
-std::array<float,2>{0.347260147f, 0.761231601f},
-std::array<float,2>{0.869815826f, 0.327250868f},
-std::array<float,2>{0.893609405f, 0.875808537f},
-std::array<float,2>{0.455403149f, 0.456501871f},
-std::array<float,2>{0.197185054f, 0.504737198f},
-std::array<float,2>{0.711026132f, 0.166518599f},
-std::array<float,2>{0.656008005f, 0.860031962f},
-std::array<float,2>{0.15424715f, 0.293685317f},
-std::array<float,2>{0.384283453f, 0.698325098f},
-std::array<float,2>{0.955150843f, 0.0636424571f},
-std::array<float,2>{0.780015111f, 0.575438201f},
-std::array<float,2>{0.304099798f, 0.217485264f},
-std::array<float,2>{0.116615437f, 0.951157153f},
-std::array<float,2>{0.529419184f, 0.400703669f},
-std::array<float,2>{0.513710141f, 0.611434937f},
-std::array<float,2>{0.100395918f, 0.240979105f},
-std::array<float,2>{0.289187998f, 0.990878165f},
-std::array<float,2>{0.759987414f, 0.428922206f},
-std::array<float,2>{0.945396543f, 0.813425422f},
-std::array<float,2>{0.400713623f, 0.274619818f},
-std::array<float,2>{0.140164092f, 0.725475311f},
-std::array<float,2>{0.631341338f, 0.0958875641f},
-std::array<float,2>{0.696091831f, 0.909693837f},
-std::array<float,2>{0.203586191f, 0.495500654f},
-std::array<float,2>{0.451168567f, 0.537191331f},
-std::array<float,2>{0.885187268f, 0.130873248f},
-std::array<float,2>{0.84967941f, 0.676397324f},
-std::array<float,2>{0.365623921f, 0.0490272194f},
-std::array<float,2>{0.0150732147f, 0.786338151f},
-std::array<float,2>{0.588726878f, 0.369310498f},
-std::array<float,2>{0.684106529f, 0.709559321f},
-std::array<float,2>{0.16230619f, 0.0843101963f},
-std::array<float,2>{0.418304265f, 0.859205961f},
-std::array<float,2>{0.981739938f, 0.306861162f},
-std::array<float,2>{0.802900374f, 0.96447742f},
-std::array<float,2>{0.253198236f, 0.380429089f},
-std::array<float,2>{0.0659743994f, 0.582707226f},
-std::array<float,2>{0.537879825f, 0.190479085f},
-std::array<float,2>{0.599808276f, 0.773090303f},
-std::array<float,2>{0.0557691641f, 0.338024169f},
-std::array<float,2>{0.320843816f, 0.625308037f},
-std::array<float,2>{0.828348577f, 0.0220090207f},
-std::array<float,2>{0.922206104f, 0.524693608f},
-std::array<float,2>{0.475036651f, 0.181351498f},
-std::array<float,2>{0.225892365f, 0.90398103f},
-std::array<float,2>{0.74139601f, 0.440023333f},
-std::array<float,2>{0.635274291f, 0.592154324f},
-std::array<float,2>{0.132471517f, 0.197271496f},
-std::array<float,2>{0.390798777f, 0.956099331f},
-std::array<float,2>{0.938918233f, 0.388466179f},
-std::array<float,2>{0.75704819f, 0.844363391f},
-std::array<float,2>{0.284077108f, 0.30162853f},
-std::array<float,2>{0.103412904f, 0.711439848f},
-std::array<float,2>{0.507374823f, 0.0918577313f},
-std::array<float,2>{0.581938386f, 0.891395569f},
-std::array<float,2>{0.00270194467f, 0.448283821f},
-std::array<float,2>{0.373233587f, 0.522431493f},
-std::array<float,2>{0.853693485f, 0.178202525f},
-std::array<float,2>{0.876232445f, 0.640578449f},
-std::array<float,2>{0.442801952f, 0.0235010069f},
-std::array<float,2>{0.213500574f, 0.779853344f},
-std::array<float,2>{0.690163672f, 0.332474023f},
-std::array<float,2>{0.539640665f, 0.726568699f},
-std::array<float,2>{0.0704868659f, 0.107321434f},
-std::array<float,2>{0.26528722f, 0.823936164f},
-std::array<float,2>{0.805579841f, 0.266575426f},
-std::array<float,2>{0.972521842f, 0.998811483f},
-std::array<float,2>{0.410622865f, 0.431015551f},
-std::array<float,2>{0.166391343f, 0.621267974f},
-std::array<float,2>{0.675642908f, 0.243401513f},
-std::array<float,2>{0.747406781f, 0.790752292f},
-std::array<float,2>{0.23193188f, 0.365040272f},
-std::array<float,2>{0.480581701f, 0.685315311f},
-std::array<float,2>{0.93096596f, 0.0566125028f},
-std::array<float,2>{0.83859235f, 0.545381427f},
-std::array<float,2>{0.313426375f, 0.133849442f},
-std::array<float,2>{0.0521097295f, 0.920624197f},
-std::array<float,2>{0.60492605f, 0.48789984f},
-std::array<float,2>{0.622256517f, 0.512440383f},
-std::array<float,2>{0.0442032702f, 0.160238221f},
-std::array<float,2>{0.330182582f, 0.888879716f},
-std::array<float,2>{0.824761689f, 0.463310122f},
-std::array<float,2>{0.908939958f, 0.750364244f},
-std::array<float,2>{0.491844475f, 0.31264925f},
-std::array<float,2>{0.241400138f, 0.652015746f},
-std::array<float,2>{0.727830648f, 0.0138886459f},
-std::array<float,2>{0.661488891f, 0.938297689f},
-std::array<float,2>{0.172168687f, 0.394071609f},
-std::array<float,2>{0.426274449f, 0.567151964f},
-std::array<float,2>{0.993885636f, 0.203137964f},
-std::array<float,2>{0.782217562f, 0.688304067f},
-std::array<float,2>{0.267908812f, 0.0717400312f},
-std::array<float,2>{0.0837071985f, 0.873548388f},
-std::array<float,2>{0.558284521f, 0.281558931f},
-std::array<float,2>{0.707772255f, 0.670177341f},
-std::array<float,2>{0.18944107f, 0.0314561017f},
-std::array<float,2>{0.461862952f, 0.807242393f},
-std::array<float,2>{0.900544465f, 0.351824105f},
-std::array<float,2>{0.865766704f, 0.923946381f},
-std::array<float,2>{0.355698794f, 0.478506893f},
-std::array<float,2>{0.0190319717f, 0.549376667f},
-std::array<float,2>{0.575828016f, 0.150056794f},
-std::array<float,2>{0.515787959f, 0.838807166f},
-std::array<float,2>{0.121936888f, 0.259820044f},
-std::array<float,2>{0.310239285f, 0.7441324f},
-std::array<float,2>{0.766797662f, 0.118322738f},
-std::array<float,2>{0.964292467f, 0.60707134f},
-std::array<float,2>{0.378158778f, 0.22802256f},
-std::array<float,2>{0.14822486f, 0.982049644f},
-std::array<float,2>{0.644745767f, 0.411686569f},
-std::array<float,2>{0.667888522f, 0.518373013f},
-std::array<float,2>{0.18425931f, 0.174920171f},
-std::array<float,2>{0.430563301f, 0.897489667f},
-std::array<float,2>{0.990595043f, 0.4526622f},
-std::array<float,2>{0.791354835f, 0.773781836f},
-std::array<float,2>{0.279990762f, 0.331679314f},
-std::array<float,2>{0.0922738016f, 0.635470331f},
-std::array<float,2>{0.554639101f, 0.0306618139f},
-std::array<float,2>{0.612499237f, 0.958629847f},
-std::array<float,2>{0.0335915051f, 0.385175973f},
-std::array<float,2>{0.338646859f, 0.58842802f},
-std::array<float,2>{0.813082039f, 0.199293897f},
-std::array<float,2>{0.918587506f, 0.717860222f},
-std::array<float,2>{0.497796059f, 0.0882610381f},
-std::array<float,2>{0.246952549f, 0.848089755f},
-std::array<float,2>{0.72624743f, 0.300501704f},
-std::array<float,2>{0.523586273f, 0.683191001f},
-std::array<float,2>{0.112776533f, 0.0595580712f},
-std::array<float,2>{0.298801422f, 0.794793963f},
-std::array<float,2>{0.77477777f, 0.361510843f},
-std::array<float,2>{0.959978521f, 0.915281773f},
-std::array<float,2>{0.386726439f, 0.490971774f},
-std::array<float,2>{0.148729488f, 0.542886555f},
-std::array<float,2>{0.651801527f, 0.140271604f},
-std::array<float,2>{0.716862738f, 0.825688481f},
-std::array<float,2>{0.199377656f, 0.273370624f},
-std::array<float,2>{0.460077316f, 0.731392741f},
-std::array<float,2>{0.897036433f, 0.104462147f},
-std::array<float,2>{0.874371469f, 0.619915724f},
-std::array<float,2>{0.349983573f, 0.246737137f},
-std::array<float,2>{0.0282591041f, 0.9954229f},
-std::array<float,2>{0.567176819f, 0.436835259f},
-std::array<float,2>{0.592842937f, 0.562851429f},
-std::array<float,2>{0.00984312594f, 0.210231394f},
-std::array<float,2>{0.359457999f, 0.941480756f},
-std::array<float,2>{0.845101833f, 0.396795005f},
-std::array<float,2>{0.887104452f, 0.869830608f},
-std::array<float,2>{0.44860369f, 0.286787093f},
-std::array<float,2>{0.208978146f, 0.692456722f},
-std::array<float,2>{0.701554894f, 0.0763580129f},
-std::array<float,2>{0.627641022f, 0.884426892f},
-std::array<float,2>{0.133945107f, 0.465617746f},
-std::array<float,2>{0.406155527f, 0.508959353f},
-std::array<float,2>{0.949426293f, 0.15787898f},
-std::array<float,2>{0.765328765f, 0.655644119f},
-std::array<float,2>{0.294704258f, 0.00871651433f},
-std::array<float,2>{0.094331786f, 0.754173994f},
-std::array<float,2>{0.51059258f, 0.317686617f},
-std::array<float,2>{0.737623692f, 0.749711573f},
-std::array<float,2>{0.222222283f, 0.124455832f},
-std::array<float,2>{0.470428914f, 0.843398631f},
-std::array<float,2>{0.928143799f, 0.263166189f},
-std::array<float,2>{0.835099459f, 0.978920281f},
-std::array<float,2>{0.325917631f, 0.407698214f},
-std::array<float,2>{0.0593136027f, 0.604175448f},
-std::array<float,2>{0.593796253f, 0.232900307f},
-std::array<float,2>{0.534416497f, 0.809070706f},
-std::array<float,2>{0.0679496303f, 0.35895595f},
-std::array<float,2>{0.255809307f, 0.667818964f},
-std::array<float,2>{0.798007965f, 0.0366305746f},
-std::array<float,2>{0.977197409f, 0.553509951f},
-std::array<float,2>{0.417633444f, 0.15381971f},
-std::array<float,2>{0.159852669f, 0.926950336f},
-std::array<float,2>{0.682213783f, 0.480469435f},
-std::array<float,2>{0.69281441f, 0.59591651f},
-std::array<float,2>{0.217975721f, 0.225500688f},
-std::array<float,2>{0.441146314f, 0.970248759f},
-std::array<float,2>{0.881978691f, 0.414815426f},
-std::array<float,2>{0.856312394f, 0.833867431f},
-std::array<float,2>{0.368795782f, 0.251113862f},
-std::array<float,2>{0.00710460823f, 0.73468262f},
-std::array<float,2>{0.582888961f, 0.113394268f},
-std::array<float,2>{0.503265262f, 0.937129021f},
-std::array<float,2>{0.108993821f, 0.468999863f},
-std::array<float,2>{0.288241953f, 0.558876753f},
-std::array<float,2>{0.751095176f, 0.143337533f},
-std::array<float,2>{0.942642033f, 0.659987748f},
-std::array<float,2>{0.398285478f, 0.039140135f},
-std::array<float,2>{0.127415955f, 0.797791064f},
-std::array<float,2>{0.638349771f, 0.348147362f},
-std::array<float,2>{0.606373847f, 0.69934231f},
-std::array<float,2>{0.0487792119f, 0.0689714849f},
-std::array<float,2>{0.318186104f, 0.867101669f},
-std::array<float,2>{0.841993272f, 0.292854518f},
-std::array<float,2>{0.936800539f, 0.945345104f},
-std::array<float,2>{0.480269015f, 0.404936373f},
-std::array<float,2>{0.228588715f, 0.57047683f},
-std::array<float,2>{0.745510399f, 0.214451432f},
-std::array<float,2>{0.676705599f, 0.764843702f},
-std::array<float,2>{0.169708699f, 0.320676178f},
-std::array<float,2>{0.408564121f, 0.642533064f},
-std::array<float,2>{0.974375427f, 0.00206669839f},
-std::array<float,2>{0.812425196f, 0.50042963f},
-std::array<float,2>{0.259434283f, 0.169105172f},
-std::array<float,2>{0.0764806718f, 0.880827129f},
-std::array<float,2>{0.543219328f, 0.45924595f},
-std::array<float,2>{0.561304152f, 0.533422947f},
-std::array<float,2>{0.0783388466f, 0.126320794f},
-std::array<float,2>{0.27097702f, 0.91260165f},
-std::array<float,2>{0.785315752f, 0.498577654f},
-std::array<float,2>{0.996682525f, 0.784966171f},
-std::array<float,2>{0.424229354f, 0.372524768f},
-std::array<float,2>{0.177439153f, 0.675513148f},
-std::array<float,2>{0.657693565f, 0.0518647917f},
-std::array<float,2>{0.732166946f, 0.98798877f},
-std::array<float,2>{0.235406712f, 0.42400676f},
-std::array<float,2>{0.486656547f, 0.615752339f},
-std::array<float,2>{0.913783491f, 0.236713871f},
-std::array<float,2>{0.821250498f, 0.720728755f},
-std::array<float,2>{0.334592551f, 0.0992795005f},
-std::array<float,2>{0.0396107398f, 0.81763202f},
-std::array<float,2>{0.617961645f, 0.27857241f},
-std::array<float,2>{0.643225729f, 0.630879343f},
-std::array<float,2>{0.143188938f, 0.0183639005f},
-std::array<float,2>{0.379327387f, 0.767072558f},
-std::array<float,2>{0.967737913f, 0.340694875f},
-std::array<float,2>{0.769671321f, 0.898471653f},
-std::array<float,2>{0.306460649f, 0.442947239f},
-std::array<float,2>{0.120998174f, 0.52923876f},
-std::array<float,2>{0.520783305f, 0.187344611f},
-std::array<float,2>{0.574078619f, 0.852358043f},
-std::array<float,2>{0.0212391932f, 0.310023129f},
-std::array<float,2>{0.354320854f, 0.704283357f},
-std::array<float,2>{0.859798551f, 0.0806976408f},
-std::array<float,2>{0.903721213f, 0.58043015f},
-std::array<float,2>{0.465634793f, 0.195308238f},
-std::array<float,2>{0.194869906f, 0.967958391f},
-std::array<float,2>{0.706175804f, 0.37627396f},
-std::array<float,2>{0.693411767f, 0.558743298f},
-std::array<float,2>{0.215848923f, 0.143078193f},
-std::array<float,2>{0.438771904f, 0.937412143f},
-std::array<float,2>{0.879068077f, 0.46875754f},
-std::array<float,2>{0.857876778f, 0.797511816f},
-std::array<float,2>{0.369964659f, 0.34862116f},
-std::array<float,2>{0.00469017215f, 0.659829199f},
-std::array<float,2>{0.584500074f, 0.03931785f},
-std::array<float,2>{0.501327753f, 0.970554292f},
-std::array<float,2>{0.106499687f, 0.414620996f},
-std::array<float,2>{0.286604315f, 0.59613508f},
-std::array<float,2>{0.752004325f, 0.225125834f},
-std::array<float,2>{0.944637001f, 0.734583557f},
-std::array<float,2>{0.395333111f, 0.113537572f},
-std::array<float,2>{0.125107229f, 0.833554506f},
-std::array<float,2>{0.638937473f, 0.251281857f},
-std::array<float,2>{0.609136343f, 0.642118514f},
-std::array<float,2>{0.049456872f, 0.00236822758f},
-std::array<float,2>{0.31995216f, 0.765071273f},
-std::array<float,2>{0.840534568f, 0.320332497f},
-std::array<float,2>{0.93531239f, 0.880463839f},
-std::array<float,2>{0.47825554f, 0.459031135f},
-std::array<float,2>{0.226630434f, 0.500119269f},
-std::array<float,2>{0.742382884f, 0.169310808f},
-std::array<float,2>{0.679469824f, 0.866937995f},
-std::array<float,2>{0.170650274f, 0.292715728f},
-std::array<float,2>{0.407919258f, 0.699697912f},
-std::array<float,2>{0.975477815f, 0.0691235885f},
-std::array<float,2>{0.810225248f, 0.570634782f},
-std::array<float,2>{0.260897577f, 0.21478641f},
-std::array<float,2>{0.0755823702f, 0.945618033f},
-std::array<float,2>{0.54519546f, 0.405246496f},
-std::array<float,2>{0.559957743f, 0.616167963f},
-std::array<float,2>{0.0819276199f, 0.236372739f},
-std::array<float,2>{0.272123933f, 0.988068044f},
-std::array<float,2>{0.789061844f, 0.424174726f},
-std::array<float,2>{0.998879075f, 0.817509532f},
-std::array<float,2>{0.423087716f, 0.278384149f},
-std::array<float,2>{0.179218963f, 0.721161902f},
-std::array<float,2>{0.658509612f, 0.0994893759f},
-std::array<float,2>{0.734004557f, 0.913064957f},
-std::array<float,2>{0.236733541f, 0.49888885f},
-std::array<float,2>{0.486108452f, 0.533598244f},
-std::array<float,2>{0.911300004f, 0.125980332f},
-std::array<float,2>{0.823635161f, 0.675735652f},
-std::array<float,2>{0.332513332f, 0.0521762706f},
-std::array<float,2>{0.0420147888f, 0.784818709f},
-std::array<float,2>{0.619594634f, 0.372111768f},
-std::array<float,2>{0.64162606f, 0.704573035f},
-std::array<float,2>{0.142369628f, 0.0810208917f},
-std::array<float,2>{0.381578296f, 0.852280557f},
-std::array<float,2>{0.966613233f, 0.309752405f},
-std::array<float,2>{0.772672355f, 0.968184948f},
-std::array<float,2>{0.306945324f, 0.376203239f},
-std::array<float,2>{0.117754184f, 0.580255687f},
-std::array<float,2>{0.523144245f, 0.194945157f},
-std::array<float,2>{0.57057339f, 0.76668483f},
-std::array<float,2>{0.0217763931f, 0.340443254f},
-std::array<float,2>{0.352741957f, 0.631235778f},
-std::array<float,2>{0.86192894f, 0.0182885192f},
-std::array<float,2>{0.90559119f, 0.529044151f},
-std::array<float,2>{0.466844082f, 0.187151805f},
-std::array<float,2>{0.192939535f, 0.898851633f},
-std::array<float,2>{0.703683317f, 0.443312526f},
-std::array<float,2>{0.664479911f, 0.588778734f},
-std::array<float,2>{0.187323213f, 0.199629664f},
-std::array<float,2>{0.432958663f, 0.958943009f},
-std::array<float,2>{0.990085483f, 0.384780288f},
-std::array<float,2>{0.790282965f, 0.847776473f},
-std::array<float,2>{0.277930647f, 0.3007375f},
-std::array<float,2>{0.0904727057f, 0.718204856f},
-std::array<float,2>{0.552534819f, 0.0881076306f},
-std::array<float,2>{0.610878289f, 0.897769749f},
-std::array<float,2>{0.0330700427f, 0.453086883f},
-std::array<float,2>{0.337350994f, 0.518243968f},
-std::array<float,2>{0.816308141f, 0.175059348f},
-std::array<float,2>{0.920558512f, 0.635573685f},
-std::array<float,2>{0.498619109f, 0.0304653402f},
-std::array<float,2>{0.24837862f, 0.773467004f},
-std::array<float,2>{0.723393798f, 0.33183831f},
-std::array<float,2>{0.526826441f, 0.73113215f},
-std::array<float,2>{0.111031108f, 0.104182318f},
-std::array<float,2>{0.300553203f, 0.825953066f},
-std::array<float,2>{0.77578634f, 0.272995591f},
-std::array<float,2>{0.957365096f, 0.995176435f},
-std::array<float,2>{0.389309227f, 0.436706036f},
-std::array<float,2>{0.151184291f, 0.619831145f},
-std::array<float,2>{0.648718119f, 0.247058287f},
-std::array<float,2>{0.71616447f, 0.794528723f},
-std::array<float,2>{0.201884627f, 0.36168161f},
-std::array<float,2>{0.458572626f, 0.683522224f},
-std::array<float,2>{0.895827115f, 0.0592535362f},
-std::array<float,2>{0.871218622f, 0.542586148f},
-std::array<float,2>{0.34841463f, 0.14038834f},
-std::array<float,2>{0.030197937f, 0.915513456f},
-std::array<float,2>{0.568693519f, 0.490833938f},
-std::array<float,2>{0.59172523f, 0.509170592f},
-std::array<float,2>{0.00896487944f, 0.157994896f},
-std::array<float,2>{0.363178343f, 0.884674013f},
-std::array<float,2>{0.847405851f, 0.465337664f},
-std::array<float,2>{0.889381588f, 0.753964484f},
-std::array<float,2>{0.446122169f, 0.317572236f},
-std::array<float,2>{0.210204884f, 0.655443072f},
-std::array<float,2>{0.699658871f, 0.00845379941f},
-std::array<float,2>{0.625696182f, 0.941789031f},
-std::array<float,2>{0.136627436f, 0.396617085f},
-std::array<float,2>{0.402806878f, 0.56271553f},
-std::array<float,2>{0.953016043f, 0.209996149f},
-std::array<float,2>{0.763128161f, 0.692815602f},
-std::array<float,2>{0.296239585f, 0.0765737668f},
-std::array<float,2>{0.0961746126f, 0.869933128f},
-std::array<float,2>{0.509008706f, 0.287041485f},
-std::array<float,2>{0.735641599f, 0.667668104f},
-std::array<float,2>{0.220215842f, 0.0370746702f},
-std::array<float,2>{0.470905066f, 0.808680534f},
-std::array<float,2>{0.9272663f, 0.359360874f},
-std::array<float,2>{0.833685875f, 0.927111626f},
-std::array<float,2>{0.327318549f, 0.480821371f},
-std::array<float,2>{0.0620876811f, 0.55328685f},
-std::array<float,2>{0.595891714f, 0.15407595f},
-std::array<float,2>{0.532254636f, 0.843524992f},
-std::array<float,2>{0.0689072385f, 0.262729794f},
-std::array<float,2>{0.257134736f, 0.749986649f},
-std::array<float,2>{0.800777555f, 0.124040172f},
-std::array<float,2>{0.980219305f, 0.604301214f},
-std::array<float,2>{0.414267063f, 0.232452765f},
-std::array<float,2>{0.157714665f, 0.978723228f},
-std::array<float,2>{0.680034757f, 0.407229394f},
-std::array<float,2>{0.633968949f, 0.52202791f},
-std::array<float,2>{0.129244462f, 0.177803203f},
-std::array<float,2>{0.39330703f, 0.891319633f},
-std::array<float,2>{0.940989673f, 0.448717088f},
-std::array<float,2>{0.7546736f, 0.780054688f},
-std::array<float,2>{0.282451153f, 0.332086027f},
-std::array<float,2>{0.103747427f, 0.640151441f},
-std::array<float,2>{0.504424095f, 0.0237067752f},
-std::array<float,2>{0.578501165f, 0.956454337f},
-std::array<float,2>{0.000492312887f, 0.388202697f},
-std::array<float,2>{0.372056186f, 0.591988742f},
-std::array<float,2>{0.852699637f, 0.19773224f},
-std::array<float,2>{0.878017306f, 0.711890042f},
-std::array<float,2>{0.443442881f, 0.0922320336f},
-std::array<float,2>{0.212540865f, 0.844623923f},
-std::array<float,2>{0.688953817f, 0.30148527f},
-std::array<float,2>{0.542435586f, 0.685192823f},
-std::array<float,2>{0.0722848549f, 0.056195911f},
-std::array<float,2>{0.263056934f, 0.790838182f},
-std::array<float,2>{0.807613254f, 0.364946336f},
-std::array<float,2>{0.96939379f, 0.920793593f},
-std::array<float,2>{0.413451582f, 0.488138139f},
-std::array<float,2>{0.165909722f, 0.54510355f},
-std::array<float,2>{0.6719172f, 0.134245798f},
-std::array<float,2>{0.748137772f, 0.824039936f},
-std::array<float,2>{0.233269721f, 0.266303658f},
-std::array<float,2>{0.484144181f, 0.726807714f},
-std::array<float,2>{0.932694972f, 0.107015148f},
-std::array<float,2>{0.836918533f, 0.621447206f},
-std::array<float,2>{0.314971358f, 0.243620813f},
-std::array<float,2>{0.0543909557f, 0.998574495f},
-std::array<float,2>{0.602270186f, 0.430831522f},
-std::array<float,2>{0.624807715f, 0.566955864f},
-std::array<float,2>{0.0460960977f, 0.203521475f},
-std::array<float,2>{0.328382671f, 0.938063562f},
-std::array<float,2>{0.826878428f, 0.394437611f},
-std::array<float,2>{0.907119215f, 0.874012113f},
-std::array<float,2>{0.489097148f, 0.281411171f},
-std::array<float,2>{0.240026325f, 0.688055277f},
-std::array<float,2>{0.729948819f, 0.0713578686f},
-std::array<float,2>{0.66354847f, 0.88893944f},
-std::array<float,2>{0.174019039f, 0.463034362f},
-std::array<float,2>{0.429522663f, 0.512464285f},
-std::array<float,2>{0.995571375f, 0.160508677f},
-std::array<float,2>{0.783312082f, 0.652329803f},
-std::array<float,2>{0.267416716f, 0.0141534032f},
-std::array<float,2>{0.084476389f, 0.750218332f},
-std::array<float,2>{0.554793835f, 0.312912703f},
-std::array<float,2>{0.710290551f, 0.743757784f},
-std::array<float,2>{0.190412804f, 0.118463494f},
-std::array<float,2>{0.464446694f, 0.838498592f},
-std::array<float,2>{0.899040639f, 0.260073602f},
-std::array<float,2>{0.864987612f, 0.982200682f},
-std::array<float,2>{0.359114379f, 0.412025243f},
-std::array<float,2>{0.0171635021f, 0.607332885f},
-std::array<float,2>{0.5765329f, 0.227719873f},
-std::array<float,2>{0.519495964f, 0.807549179f},
-std::array<float,2>{0.124797337f, 0.35180214f},
-std::array<float,2>{0.311383843f, 0.670164347f},
-std::array<float,2>{0.767742097f, 0.0316594355f},
-std::array<float,2>{0.961962819f, 0.549802482f},
-std::array<float,2>{0.376896113f, 0.150226533f},
-std::array<float,2>{0.1458534f, 0.924090087f},
-std::array<float,2>{0.646690547f, 0.478232026f},
-std::array<float,2>{0.720445931f, 0.601296246f},
-std::array<float,2>{0.243382424f, 0.222224876f},
-std::array<float,2>{0.493354559f, 0.973188162f},
-std::array<float,2>{0.916034102f, 0.419137508f},
-std::array<float,2>{0.818647623f, 0.828899443f},
-std::array<float,2>{0.341759712f, 0.255722553f},
-std::array<float,2>{0.0377965085f, 0.739965141f},
-std::array<float,2>{0.614088178f, 0.110493995f},
-std::array<float,2>{0.54753536f, 0.932994723f},
-std::array<float,2>{0.088344425f, 0.47276485f},
-std::array<float,2>{0.275726944f, 0.558349729f},
-std::array<float,2>{0.79606849f, 0.144577503f},
-std::array<float,2>{0.984609902f, 0.660295248f},
-std::array<float,2>{0.434506238f, 0.0461487211f},
-std::array<float,2>{0.180357143f, 0.802007735f},
-std::array<float,2>{0.670311511f, 0.346007556f},
-std::array<float,2>{0.566316247f, 0.698488355f},
-std::array<float,2>{0.0252316017f, 0.0639555156f},
-std::array<float,2>{0.344612569f, 0.860176921f},
-std::array<float,2>{0.868314028f, 0.293856949f},
-std::array<float,2>{0.891308844f, 0.95073688f},
-std::array<float,2>{0.454923213f, 0.400542557f},
-std::array<float,2>{0.198533803f, 0.575560212f},
-std::array<float,2>{0.714119077f, 0.217716366f},
-std::array<float,2>{0.653347909f, 0.76159972f},
-std::array<float,2>{0.155571237f, 0.327563316f},
-std::array<float,2>{0.386259228f, 0.647418141f},
-std::array<float,2>{0.955071747f, 0.00446583144f},
-std::array<float,2>{0.779012859f, 0.504527867f},
-std::array<float,2>{0.301382959f, 0.166987509f},
-std::array<float,2>{0.113991208f, 0.875515342f},
-std::array<float,2>{0.528371215f, 0.456168026f},
-std::array<float,2>{0.511769056f, 0.537550032f},
-std::array<float,2>{0.0995402113f, 0.131246075f},
-std::array<float,2>{0.292619765f, 0.910083473f},
-std::array<float,2>{0.758860767f, 0.49524948f},
-std::array<float,2>{0.9482463f, 0.786441624f},
-std::array<float,2>{0.399948478f, 0.369408756f},
-std::array<float,2>{0.137457415f, 0.676660001f},
-std::array<float,2>{0.63081181f, 0.0492730737f},
-std::array<float,2>{0.698295891f, 0.991101205f},
-std::array<float,2>{0.205613017f, 0.428987443f},
-std::array<float,2>{0.452514708f, 0.611734807f},
-std::array<float,2>{0.884447813f, 0.24076201f},
-std::array<float,2>{0.848679841f, 0.725288689f},
-std::array<float,2>{0.3650738f, 0.0960073844f},
-std::array<float,2>{0.0121742552f, 0.813176394f},
-std::array<float,2>{0.586339951f, 0.274746954f},
-std::array<float,2>{0.686559081f, 0.625145972f},
-std::array<float,2>{0.161713555f, 0.0222931914f},
-std::array<float,2>{0.420974046f, 0.773202896f},
-std::array<float,2>{0.982422531f, 0.338149905f},
-std::array<float,2>{0.801182032f, 0.904285073f},
-std::array<float,2>{0.251928836f, 0.440392584f},
-std::array<float,2>{0.0632172823f, 0.524512291f},
-std::array<float,2>{0.536355138f, 0.181494758f},
-std::array<float,2>{0.598327279f, 0.859104633f},
-std::array<float,2>{0.0578105412f, 0.306992322f},
-std::array<float,2>{0.322668672f, 0.709936082f},
-std::array<float,2>{0.830938101f, 0.0841396898f},
-std::array<float,2>{0.924553752f, 0.582782149f},
-std::array<float,2>{0.473912776f, 0.190702572f},
-std::array<float,2>{0.224593341f, 0.964826524f},
-std::array<float,2>{0.739354312f, 0.38062045f},
-std::array<float,2>{0.744919419f, 0.503221035f},
-std::array<float,2>{0.230263337f, 0.169962138f},
-std::array<float,2>{0.479037613f, 0.882291377f},
-std::array<float,2>{0.935917735f, 0.458436012f},
-std::array<float,2>{0.843382418f, 0.762354255f},
-std::array<float,2>{0.316737413f, 0.322500199f},
-std::array<float,2>{0.0471288897f, 0.643318594f},
-std::array<float,2>{0.606873512f, 0.000846785319f},
-std::array<float,2>{0.544816077f, 0.948416948f},
-std::array<float,2>{0.0775472596f, 0.403454155f},
-std::array<float,2>{0.258761615f, 0.573034763f},
-std::array<float,2>{0.810634792f, 0.212622046f},
-std::array<float,2>{0.973556519f, 0.702622354f},
-std::array<float,2>{0.409357846f, 0.0669760853f},
-std::array<float,2>{0.168725237f, 0.863303781f},
-std::array<float,2>{0.677557707f, 0.289861381f},
-std::array<float,2>{0.58324331f, 0.656548679f},
-std::array<float,2>{0.00678495504f, 0.0424128845f},
-std::array<float,2>{0.368138164f, 0.800747573f},
-std::array<float,2>{0.856449246f, 0.351390749f},
-std::array<float,2>{0.881115019f, 0.933894813f},
-std::array<float,2>{0.439537019f, 0.472153485f},
-std::array<float,2>{0.217300028f, 0.561522126f},
-std::array<float,2>{0.691961408f, 0.142258555f},
-std::array<float,2>{0.636864781f, 0.834989965f},
-std::array<float,2>{0.128136635f, 0.253001481f},
-std::array<float,2>{0.396802515f, 0.7375651f},
-std::array<float,2>{0.941877961f, 0.116186269f},
-std::array<float,2>{0.75066942f, 0.595198274f},
-std::array<float,2>{0.287703753f, 0.222685307f},
-std::array<float,2>{0.107511811f, 0.972495198f},
-std::array<float,2>{0.50288254f, 0.416862935f},
-std::array<float,2>{0.519851506f, 0.578340888f},
-std::array<float,2>{0.119667858f, 0.192654863f},
-std::array<float,2>{0.305588245f, 0.966172516f},
-std::array<float,2>{0.771297634f, 0.378475279f},
-std::array<float,2>{0.967904031f, 0.853636503f},
-std::array<float,2>{0.380466998f, 0.311073065f},
-std::array<float,2>{0.143737465f, 0.706564784f},
-std::array<float,2>{0.644283116f, 0.0800574124f},
-std::array<float,2>{0.705643952f, 0.901188493f},
-std::array<float,2>{0.193648353f, 0.44380489f},
-std::array<float,2>{0.466194391f, 0.529492378f},
-std::array<float,2>{0.90315479f, 0.184389204f},
-std::array<float,2>{0.860655367f, 0.629957318f},
-std::array<float,2>{0.355402112f, 0.0167811625f},
-std::array<float,2>{0.0203725118f, 0.769344866f},
-std::array<float,2>{0.572470069f, 0.343218297f},
-std::array<float,2>{0.656898975f, 0.720466793f},
-std::array<float,2>{0.17638962f, 0.100882918f},
-std::array<float,2>{0.42538631f, 0.819413126f},
-std::array<float,2>{0.997193754f, 0.279867589f},
-std::array<float,2>{0.78680104f, 0.985400915f},
-std::array<float,2>{0.270022303f, 0.423181862f},
-std::array<float,2>{0.0791837201f, 0.613555849f},
-std::array<float,2>{0.56238848f, 0.235034823f},
-std::array<float,2>{0.618428588f, 0.782193542f},
-std::array<float,2>{0.0400777794f, 0.374765724f},
-std::array<float,2>{0.335344642f, 0.673409522f},
-std::array<float,2>{0.822197378f, 0.0541023351f},
-std::array<float,2>{0.912313342f, 0.531313956f},
-std::array<float,2>{0.487461627f, 0.128252432f},
-std::array<float,2>{0.234526843f, 0.910918117f},
-std::array<float,2>{0.731158793f, 0.497341156f},
-std::array<float,2>{0.651118577f, 0.618081272f},
-std::array<float,2>{0.150232598f, 0.248604998f},
-std::array<float,2>{0.388385504f, 0.993738651f},
-std::array<float,2>{0.959355891f, 0.434830159f},
-std::array<float,2>{0.773598671f, 0.827493429f},
-std::array<float,2>{0.297060698f, 0.2700077f},
-std::array<float,2>{0.111984216f, 0.734367847f},
-std::array<float,2>{0.524652183f, 0.101717956f},
-std::array<float,2>{0.567520082f, 0.916210711f},
-std::array<float,2>{0.0283441283f, 0.489267796f},
-std::array<float,2>{0.35109219f, 0.539662957f},
-std::array<float,2>{0.873782337f, 0.137357041f},
-std::array<float,2>{0.898194551f, 0.68121928f},
-std::array<float,2>{0.45963493f, 0.0614240281f},
-std::array<float,2>{0.200604811f, 0.796530724f},
-std::array<float,2>{0.718402743f, 0.359871656f},
-std::array<float,2>{0.553478956f, 0.715066016f},
-std::array<float,2>{0.0935018584f, 0.0861568376f},
-std::array<float,2>{0.280606121f, 0.85027957f},
-std::array<float,2>{0.79248786f, 0.298682779f},
-std::array<float,2>{0.991404772f, 0.959399343f},
-std::array<float,2>{0.430800229f, 0.383896559f},
-std::array<float,2>{0.184911773f, 0.586779475f},
-std::array<float,2>{0.666033387f, 0.201346099f},
-std::array<float,2>{0.7249946f, 0.77663517f},
-std::array<float,2>{0.247740284f, 0.32914418f},
-std::array<float,2>{0.496579766f, 0.633020818f},
-std::array<float,2>{0.919800103f, 0.0286770202f},
-std::array<float,2>{0.81433183f, 0.515757024f},
-std::array<float,2>{0.339236528f, 0.172556162f},
-std::array<float,2>{0.0350732431f, 0.894644558f},
-std::array<float,2>{0.61195296f, 0.44993183f},
-std::array<float,2>{0.594757318f, 0.551832616f},
-std::array<float,2>{0.0601671934f, 0.155316964f},
-std::array<float,2>{0.325126439f, 0.928193986f},
-std::array<float,2>{0.834429026f, 0.483666807f},
-std::array<float,2>{0.9293136f, 0.810569704f},
-std::array<float,2>{0.46928969f, 0.357401282f},
-std::array<float,2>{0.221414492f, 0.664633036f},
-std::array<float,2>{0.736784995f, 0.0387908965f},
-std::array<float,2>{0.682754338f, 0.976960063f},
-std::array<float,2>{0.15857175f, 0.408203691f},
-std::array<float,2>{0.416519225f, 0.602986217f},
-std::array<float,2>{0.978173971f, 0.231649175f},
-std::array<float,2>{0.797749221f, 0.747058809f},
-std::array<float,2>{0.25455004f, 0.121414863f},
-std::array<float,2>{0.0665556267f, 0.841365576f},
-std::array<float,2>{0.533633053f, 0.265035093f},
-std::array<float,2>{0.702705026f, 0.652907252f},
-std::array<float,2>{0.207224667f, 0.0114417067f},
-std::array<float,2>{0.447866768f, 0.756697297f},
-std::array<float,2>{0.888193607f, 0.319665462f},
-std::array<float,2>{0.843957603f, 0.884795606f},
-std::array<float,2>{0.360793561f, 0.468740523f},
-std::array<float,2>{0.0116226878f, 0.509816408f},
-std::array<float,2>{0.592359006f, 0.159279764f},
-std::array<float,2>{0.51129806f, 0.868659198f},
-std::array<float,2>{0.0953352973f, 0.28847447f},
-std::array<float,2>{0.293187588f, 0.694455147f},
-std::array<float,2>{0.763874412f, 0.0758982301f},
-std::array<float,2>{0.950335741f, 0.565925539f},
-std::array<float,2>{0.404922158f, 0.208110422f},
-std::array<float,2>{0.13343206f, 0.944929063f},
-std::array<float,2>{0.62809515f, 0.395479739f},
-std::array<float,2>{0.674475551f, 0.543793678f},
-std::array<float,2>{0.16763477f, 0.135237589f},
-std::array<float,2>{0.411498666f, 0.918234766f},
-std::array<float,2>{0.971425354f, 0.485471666f},
-std::array<float,2>{0.806420684f, 0.791074812f},
-std::array<float,2>{0.263914794f, 0.366567969f},
-std::array<float,2>{0.0718769282f, 0.687210917f},
-std::array<float,2>{0.540346801f, 0.0570025258f},
-std::array<float,2>{0.60409534f, 0.996647537f},
-std::array<float,2>{0.0509464368f, 0.433281958f},
-std::array<float,2>{0.314260244f, 0.623131156f},
-std::array<float,2>{0.839817941f, 0.245834321f},
-std::array<float,2>{0.929871678f, 0.728732228f},
-std::array<float,2>{0.482199311f, 0.109033339f},
-std::array<float,2>{0.230811954f, 0.820776045f},
-std::array<float,2>{0.74614495f, 0.268256366f},
-std::array<float,2>{0.506553352f, 0.638250589f},
-std::array<float,2>{0.102225885f, 0.0265857689f},
-std::array<float,2>{0.284512222f, 0.777421474f},
-std::array<float,2>{0.756245613f, 0.335558623f},
-std::array<float,2>{0.93759352f, 0.894052207f},
-std::array<float,2>{0.392559052f, 0.446439475f},
-std::array<float,2>{0.13140814f, 0.520435631f},
-std::array<float,2>{0.635822594f, 0.177658424f},
-std::array<float,2>{0.690507591f, 0.846043527f},
-std::array<float,2>{0.213971898f, 0.303214014f},
-std::array<float,2>{0.442306489f, 0.71442914f},
-std::array<float,2>{0.875016212f, 0.0899887234f},
-std::array<float,2>{0.855021358f, 0.590606928f},
-std::array<float,2>{0.374711454f, 0.195395827f},
-std::array<float,2>{0.00385629619f, 0.953702748f},
-std::array<float,2>{0.581010938f, 0.388912767f},
-std::array<float,2>{0.574842036f, 0.608551562f},
-std::array<float,2>{0.0181221105f, 0.229384601f},
-std::array<float,2>{0.357044578f, 0.98351413f},
-std::array<float,2>{0.866627157f, 0.413376659f},
-std::array<float,2>{0.901757836f, 0.836081266f},
-std::array<float,2>{0.462387234f, 0.258195728f},
-std::array<float,2>{0.18781662f, 0.744422495f},
-std::array<float,2>{0.708794713f, 0.120689027f},
-std::array<float,2>{0.646137714f, 0.922344089f},
-std::array<float,2>{0.147209316f, 0.47923249f},
-std::array<float,2>{0.377491802f, 0.548698545f},
-std::array<float,2>{0.963687003f, 0.151075378f},
-std::array<float,2>{0.766598403f, 0.669058383f},
-std::array<float,2>{0.30861029f, 0.0335492343f},
-std::array<float,2>{0.122167841f, 0.806557834f},
-std::array<float,2>{0.516698301f, 0.354242444f},
-std::array<float,2>{0.727174938f, 0.691010535f},
-std::array<float,2>{0.240342662f, 0.0729679391f},
-std::array<float,2>{0.491101772f, 0.872102499f},
-std::array<float,2>{0.909367859f, 0.283314288f},
-std::array<float,2>{0.825768173f, 0.939659357f},
-std::array<float,2>{0.331647813f, 0.392429709f},
-std::array<float,2>{0.0431686342f, 0.568957031f},
-std::array<float,2>{0.621158779f, 0.206576124f},
-std::array<float,2>{0.557236552f, 0.753769279f},
-std::array<float,2>{0.0824235901f, 0.315711021f},
-std::array<float,2>{0.269377202f, 0.6490888f},
-std::array<float,2>{0.78307569f, 0.012202003f},
-std::array<float,2>{0.992952406f, 0.515585721f},
-std::array<float,2>{0.426862866f, 0.162116796f},
-std::array<float,2>{0.173823491f, 0.888356626f},
-std::array<float,2>{0.660262346f, 0.461115658f},
-std::array<float,2>{0.712494135f, 0.578094721f},
-std::array<float,2>{0.196011171f, 0.216213271f},
-std::array<float,2>{0.456484377f, 0.952491939f},
-std::array<float,2>{0.893265188f, 0.39914766f},
-std::array<float,2>{0.870429218f, 0.8627882f},
-std::array<float,2>{0.34621805f, 0.295643121f},
-std::array<float,2>{0.0266013313f, 0.695726335f},
-std::array<float,2>{0.56339103f, 0.0656726733f},
-std::array<float,2>{0.531018734f, 0.877605915f},
-std::array<float,2>{0.115975216f, 0.454835892f},
-std::array<float,2>{0.303132355f, 0.50744158f},
-std::array<float,2>{0.781242967f, 0.164978817f},
-std::array<float,2>{0.956181169f, 0.645244002f},
-std::array<float,2>{0.38376224f, 0.00717770401f},
-std::array<float,2>{0.152650625f, 0.75841105f},
-std::array<float,2>{0.654450774f, 0.325506389f},
-std::array<float,2>{0.616064131f, 0.740780652f},
-std::array<float,2>{0.0366873667f, 0.112902299f},
-std::array<float,2>{0.343524456f, 0.83028537f},
-std::array<float,2>{0.817858636f, 0.256747395f},
-std::array<float,2>{0.915417075f, 0.975688577f},
-std::array<float,2>{0.495025903f, 0.420335978f},
-std::array<float,2>{0.244474962f, 0.598421693f},
-std::array<float,2>{0.721555948f, 0.220133662f},
-std::array<float,2>{0.669007599f, 0.804359138f},
-std::array<float,2>{0.183390066f, 0.345067441f},
-std::array<float,2>{0.436635673f, 0.663267851f},
-std::array<float,2>{0.986378253f, 0.0446754061f},
-std::array<float,2>{0.794335604f, 0.556400955f},
-std::array<float,2>{0.273803174f, 0.147107333f},
-std::array<float,2>{0.0877995566f, 0.931620896f},
-std::array<float,2>{0.549305797f, 0.476039499f},
-std::array<float,2>{0.538521409f, 0.525891185f},
-std::array<float,2>{0.064975597f, 0.18246302f},
-std::array<float,2>{0.252231508f, 0.906150877f},
-std::array<float,2>{0.803883255f, 0.438647121f},
-std::array<float,2>{0.980873644f, 0.769865036f},
-std::array<float,2>{0.419540226f, 0.336223543f},
-std::array<float,2>{0.163722083f, 0.62876749f},
-std::array<float,2>{0.685174823f, 0.0210035071f},
-std::array<float,2>{0.740552247f, 0.962852895f},
-std::array<float,2>{0.224692702f, 0.38138023f},
-std::array<float,2>{0.475586295f, 0.584326446f},
-std::array<float,2>{0.922893465f, 0.188725427f},
-std::array<float,2>{0.829747319f, 0.708417177f},
-std::array<float,2>{0.321931094f, 0.0832677558f},
-std::array<float,2>{0.0548796169f, 0.855963647f},
-std::array<float,2>{0.600794375f, 0.305538565f},
-std::array<float,2>{0.632316411f, 0.678437948f},
-std::array<float,2>{0.138935477f, 0.0476878285f},
-std::array<float,2>{0.402152985f, 0.788974345f},
-std::array<float,2>{0.94689256f, 0.367972374f},
-std::array<float,2>{0.761030078f, 0.907577395f},
-std::array<float,2>{0.290923566f, 0.49315688f},
-std::array<float,2>{0.101378977f, 0.536744595f},
-std::array<float,2>{0.514959574f, 0.129157394f},
-std::array<float,2>{0.589072287f, 0.814888f},
-std::array<float,2>{0.0139784645f, 0.27699998f},
-std::array<float,2>{0.367153674f, 0.724431753f},
-std::array<float,2>{0.851391256f, 0.0953991711f},
-std::array<float,2>{0.885949433f, 0.6109218f},
-std::array<float,2>{0.449686944f, 0.239510864f},
-std::array<float,2>{0.204859063f, 0.988443017f},
-std::array<float,2>{0.697210908f, 0.427298874f},
-std::array<float,2>{0.704910278f, 0.530682921f},
-std::array<float,2>{0.191902548f, 0.184924558f},
-std::array<float,2>{0.468246937f, 0.902308404f},
-std::array<float,2>{0.904335856f, 0.444819242f},
-std::array<float,2>{0.862523377f, 0.768369079f},
-std::array<float,2>{0.352503479f, 0.342482924f},
-std::array<float,2>{0.0225840732f, 0.629747748f},
-std::array<float,2>{0.571364999f, 0.016523581f},
-std::array<float,2>{0.521585643f, 0.964998603f},
-std::array<float,2>{0.118525252f, 0.377705693f},
-std::array<float,2>{0.307733297f, 0.579546571f},
-std::array<float,2>{0.771820962f, 0.191904396f},
-std::array<float,2>{0.964847326f, 0.705369949f},
-std::array<float,2>{0.382781535f, 0.0785645396f},
-std::array<float,2>{0.141110241f, 0.855325222f},
-std::array<float,2>{0.640747845f, 0.311983436f},
-std::array<float,2>{0.620632529f, 0.672743797f},
-std::array<float,2>{0.0415204093f, 0.0533779263f},
-std::array<float,2>{0.33324188f, 0.782294095f},
-std::array<float,2>{0.822440147f, 0.373087108f},
-std::array<float,2>{0.91063416f, 0.911627591f},
-std::array<float,2>{0.484693706f, 0.49675706f},
-std::array<float,2>{0.237617791f, 0.532938659f},
-std::array<float,2>{0.733017325f, 0.127851367f},
-std::array<float,2>{0.659843743f, 0.819103956f},
-std::array<float,2>{0.178492814f, 0.280357182f},
-std::array<float,2>{0.422478855f, 0.719039679f},
-std::array<float,2>{0.99941361f, 0.100130312f},
-std::array<float,2>{0.787992299f, 0.614921749f},
-std::array<float,2>{0.272811979f, 0.236063614f},
-std::array<float,2>{0.0808567777f, 0.984565437f},
-std::array<float,2>{0.55933857f, 0.422247857f},
-std::array<float,2>{0.546016276f, 0.573883355f},
-std::array<float,2>{0.0745396987f, 0.211608306f},
-std::array<float,2>{0.260501474f, 0.947605431f},
-std::array<float,2>{0.80916512f, 0.40279153f},
-std::array<float,2>{0.975608945f, 0.864395261f},
-std::array<float,2>{0.406607181f, 0.290530711f},
-std::array<float,2>{0.17116484f, 0.701974392f},
-std::array<float,2>{0.678097785f, 0.068302691f},
-std::array<float,2>{0.743813634f, 0.881277084f},
-std::array<float,2>{0.227725253f, 0.457877666f},
-std::array<float,2>{0.477324128f, 0.50227797f},
-std::array<float,2>{0.933762014f, 0.171050966f},
-std::array<float,2>{0.841483235f, 0.644167602f},
-std::array<float,2>{0.318366557f, 0.0011502729f},
-std::array<float,2>{0.0498255268f, 0.762843847f},
-std::array<float,2>{0.607939959f, 0.323447496f},
-std::array<float,2>{0.640213132f, 0.736354947f},
-std::array<float,2>{0.126416609f, 0.117018178f},
-std::array<float,2>{0.395554364f, 0.834784448f},
-std::array<float,2>{0.944065213f, 0.252176106f},
-std::array<float,2>{0.753098071f, 0.971134961f},
-std::array<float,2>{0.2859492f, 0.417944938f},
-std::array<float,2>{0.10615658f, 0.59452045f},
-std::array<float,2>{0.500660956f, 0.224065945f},
-std::array<float,2>{0.585839331f, 0.799738526f},
-std::array<float,2>{0.00543019595f, 0.350320458f},
-std::array<float,2>{0.370390385f, 0.657748878f},
-std::array<float,2>{0.858587384f, 0.0414995961f},
-std::array<float,2>{0.880083203f, 0.561586618f},
-std::array<float,2>{0.437903732f, 0.140806511f},
-std::array<float,2>{0.215382174f, 0.934978604f},
-std::array<float,2>{0.69530654f, 0.47089678f},
-std::array<float,2>{0.680741131f, 0.602221251f},
-std::array<float,2>{0.15665178f, 0.23094669f},
-std::array<float,2>{0.415465653f, 0.977598548f},
-std::array<float,2>{0.979192078f, 0.409258246f},
-std::array<float,2>{0.799767733f, 0.840270638f},
-std::array<float,2>{0.256610453f, 0.264383197f},
-std::array<float,2>{0.0693437383f, 0.747882783f},
-std::array<float,2>{0.531591415f, 0.12285047f},
-std::array<float,2>{0.597242832f, 0.928997517f},
-std::array<float,2>{0.0609224215f, 0.482665151f},
-std::array<float,2>{0.326183349f, 0.550806046f},
-std::array<float,2>{0.832720935f, 0.154819459f},
-std::array<float,2>{0.9261536f, 0.665855169f},
-std::array<float,2>{0.472257942f, 0.0378389247f},
-std::array<float,2>{0.219380409f, 0.812202096f},
-std::array<float,2>{0.735044777f, 0.355589747f},
-std::array<float,2>{0.508561552f, 0.693573415f},
-std::array<float,2>{0.0972643495f, 0.0742710307f},
-std::array<float,2>{0.294955969f, 0.86815387f},
-std::array<float,2>{0.76216501f, 0.287377715f},
-std::array<float,2>{0.951193273f, 0.943563938f},
-std::array<float,2>{0.40340507f, 0.396324247f},
-std::array<float,2>{0.134817541f, 0.564992547f},
-std::array<float,2>{0.626612246f, 0.207058713f},
-std::array<float,2>{0.700572133f, 0.757012963f},
-std::array<float,2>{0.209027112f, 0.319221824f},
-std::array<float,2>{0.447074085f, 0.653451324f},
-std::array<float,2>{0.890154541f, 0.0103703868f},
-std::array<float,2>{0.846421897f, 0.511517525f},
-std::array<float,2>{0.362240881f, 0.158470199f},
-std::array<float,2>{0.00809274521f, 0.886128902f},
-std::array<float,2>{0.590176761f, 0.467108667f},
-std::array<float,2>{0.570274234f, 0.540595472f},
-std::array<float,2>{0.0304131247f, 0.138311103f},
-std::array<float,2>{0.349267215f, 0.9171924f},
-std::array<float,2>{0.872778296f, 0.489039063f},
-std::array<float,2>{0.894699931f, 0.79581064f},
-std::array<float,2>{0.45794639f, 0.360367119f},
-std::array<float,2>{0.202233285f, 0.680496991f},
-std::array<float,2>{0.715188742f, 0.0616670549f},
-std::array<float,2>{0.649757564f, 0.992285013f},
-std::array<float,2>{0.15167892f, 0.434458554f},
-std::array<float,2>{0.390322536f, 0.618611038f},
-std::array<float,2>{0.958437383f, 0.249061689f},
-std::array<float,2>{0.776404023f, 0.732500076f},
-std::array<float,2>{0.299514025f, 0.102645487f},
-std::array<float,2>{0.109898195f, 0.827025294f},
-std::array<float,2>{0.525618017f, 0.270642221f},
-std::array<float,2>{0.72435087f, 0.634135485f},
-std::array<float,2>{0.249780804f, 0.0275747851f},
-std::array<float,2>{0.499135941f, 0.776155293f},
-std::array<float,2>{0.921782494f, 0.328488141f},
-std::array<float,2>{0.815412164f, 0.896374285f},
-std::array<float,2>{0.336707234f, 0.450587898f},
-std::array<float,2>{0.0317257158f, 0.517209947f},
-std::array<float,2>{0.609611869f, 0.172911927f},
-std::array<float,2>{0.551100254f, 0.851425111f},
-std::array<float,2>{0.0912737697f, 0.297154069f},
-std::array<float,2>{0.278624862f, 0.715931892f},
-std::array<float,2>{0.789747298f, 0.0875633582f},
-std::array<float,2>{0.988424242f, 0.587246299f},
-std::array<float,2>{0.432015538f, 0.202324063f},
-std::array<float,2>{0.185889468f, 0.960818291f},
-std::array<float,2>{0.665781558f, 0.382911652f},
-std::array<float,2>{0.647743225f, 0.547712505f},
-std::array<float,2>{0.145402208f, 0.152199402f},
-std::array<float,2>{0.375493199f, 0.923461676f},
-std::array<float,2>{0.961304545f, 0.480358839f},
-std::array<float,2>{0.76880002f, 0.805053115f},
-std::array<float,2>{0.311847955f, 0.354524493f},
-std::array<float,2>{0.123356231f, 0.668440878f},
-std::array<float,2>{0.518060088f, 0.0346096344f},
-std::array<float,2>{0.577828705f, 0.982758224f},
-std::array<float,2>{0.0162330326f, 0.412725121f},
-std::array<float,2>{0.357593387f, 0.60799098f},
-std::array<float,2>{0.863338351f, 0.229893863f},
-std::array<float,2>{0.899851263f, 0.745942056f},
-std::array<float,2>{0.463255048f, 0.119428292f},
-std::array<float,2>{0.191081375f, 0.837830544f},
-std::array<float,2>{0.709141195f, 0.258999646f},
-std::array<float,2>{0.555681467f, 0.650332689f},
-std::array<float,2>{0.0858154446f, 0.0131401476f},
-std::array<float,2>{0.265773594f, 0.75275743f},
-std::array<float,2>{0.784920812f, 0.315144062f},
-std::array<float,2>{0.994761527f, 0.887208045f},
-std::array<float,2>{0.427984565f, 0.462841034f},
-std::array<float,2>{0.174848735f, 0.514221489f},
-std::array<float,2>{0.662835777f, 0.163330182f},
-std::array<float,2>{0.728743315f, 0.871183276f},
-std::array<float,2>{0.23847796f, 0.28479749f},
-std::array<float,2>{0.490083843f, 0.690028667f},
-std::array<float,2>{0.908052742f, 0.0741192922f},
-std::array<float,2>{0.82718426f, 0.569520473f},
-std::array<float,2>{0.329865545f, 0.205314696f},
-std::array<float,2>{0.045472648f, 0.940774322f},
-std::array<float,2>{0.623425364f, 0.390730828f},
-std::array<float,2>{0.602560937f, 0.624043882f},
-std::array<float,2>{0.0529532135f, 0.244850188f},
-std::array<float,2>{0.316064537f, 0.997210562f},
-std::array<float,2>{0.83655566f, 0.432064503f},
-std::array<float,2>{0.932593882f, 0.821347356f},
-std::array<float,2>{0.482719392f, 0.269482136f},
-std::array<float,2>{0.233985171f, 0.730366647f},
-std::array<float,2>{0.749905288f, 0.107750364f},
-std::array<float,2>{0.673370421f, 0.919671535f},
-std::array<float,2>{0.164338648f, 0.484912664f},
-std::array<float,2>{0.413069338f, 0.544611037f},
-std::array<float,2>{0.970369697f, 0.135800466f},
-std::array<float,2>{0.808255911f, 0.686112463f},
-std::array<float,2>{0.262050867f, 0.0580955446f},
-std::array<float,2>{0.0739315599f, 0.792138457f},
-std::array<float,2>{0.541914821f, 0.365301311f},
-std::array<float,2>{0.688269258f, 0.713234067f},
-std::array<float,2>{0.211746275f, 0.0915232152f},
-std::array<float,2>{0.44469288f, 0.846893966f},
-std::array<float,2>{0.877121627f, 0.304038078f},
-std::array<float,2>{0.851580679f, 0.954360545f},
-std::array<float,2>{0.372957021f, 0.389967591f},
-std::array<float,2>{0.00162494509f, 0.591019094f},
-std::array<float,2>{0.579170883f, 0.196388096f},
-std::array<float,2>{0.505509913f, 0.778354347f},
-std::array<float,2>{0.105001666f, 0.334076166f},
-std::array<float,2>{0.281996608f, 0.637217224f},
-std::array<float,2>{0.755456507f, 0.0255768318f},
-std::array<float,2>{0.940405846f, 0.521052063f},
-std::array<float,2>{0.393851399f, 0.176624447f},
-std::array<float,2>{0.130456895f, 0.89290309f},
-std::array<float,2>{0.633111954f, 0.446154922f},
-std::array<float,2>{0.739228129f, 0.585305214f},
-std::array<float,2>{0.223118305f, 0.188311413f},
-std::array<float,2>{0.47326827f, 0.961886168f},
-std::array<float,2>{0.925072849f, 0.38222605f},
-std::array<float,2>{0.831594706f, 0.856984794f},
-std::array<float,2>{0.323936671f, 0.305742592f},
-std::array<float,2>{0.0566542894f, 0.707514286f},
-std::array<float,2>{0.59943068f, 0.0826177001f},
-std::array<float,2>{0.536123037f, 0.904659569f},
-std::array<float,2>{0.0636017919f, 0.437671006f},
-std::array<float,2>{0.250377595f, 0.526709855f},
-std::array<float,2>{0.802618682f, 0.18309848f},
-std::array<float,2>{0.983968437f, 0.627892494f},
-std::array<float,2>{0.420117229f, 0.0200243145f},
-std::array<float,2>{0.160430223f, 0.770565569f},
-std::array<float,2>{0.686410904f, 0.337066859f},
-std::array<float,2>{0.58695066f, 0.722789943f},
-std::array<float,2>{0.0132026561f, 0.0943095461f},
-std::array<float,2>{0.363466829f, 0.81563288f},
-std::array<float,2>{0.84786284f, 0.276131123f},
-std::array<float,2>{0.883425534f, 0.989552081f},
-std::array<float,2>{0.45169276f, 0.426104575f},
-std::array<float,2>{0.206506446f, 0.610266685f},
-std::array<float,2>{0.697992027f, 0.238960519f},
-std::array<float,2>{0.628954291f, 0.787702024f},
-std::array<float,2>{0.137937739f, 0.369108707f},
-std::array<float,2>{0.398522049f, 0.679028869f},
-std::array<float,2>{0.947709739f, 0.0487656072f},
-std::array<float,2>{0.758618653f, 0.535986543f},
-std::array<float,2>{0.291905195f, 0.130148977f},
-std::array<float,2>{0.0981890559f, 0.906647205f},
-std::array<float,2>{0.513332546f, 0.494080931f},
-std::array<float,2>{0.528232038f, 0.50609982f},
-std::array<float,2>{0.11439243f, 0.165979981f},
-std::array<float,2>{0.302705675f, 0.878867447f},
-std::array<float,2>{0.778015852f, 0.453748494f},
-std::array<float,2>{0.953423142f, 0.759592652f},
-std::array<float,2>{0.384827167f, 0.324915469f},
-std::array<float,2>{0.154679462f, 0.646090984f},
-std::array<float,2>{0.653092384f, 0.00656143297f},
-std::array<float,2>{0.713347197f, 0.9518525f},
-std::array<float,2>{0.198057696f, 0.399806648f},
-std::array<float,2>{0.453272343f, 0.576586187f},
-std::array<float,2>{0.891617358f, 0.214901388f},
-std::array<float,2>{0.868057728f, 0.697031021f},
-std::array<float,2>{0.345018983f, 0.0650125295f},
-std::array<float,2>{0.0236703157f, 0.861575484f},
-std::array<float,2>{0.564828455f, 0.296535075f},
-std::array<float,2>{0.671357691f, 0.662901223f},
-std::array<float,2>{0.18090567f, 0.0437122993f},
-std::array<float,2>{0.43551448f, 0.803254247f},
-std::array<float,2>{0.985488474f, 0.344601691f},
-std::array<float,2>{0.794940293f, 0.930121005f},
-std::array<float,2>{0.277214587f, 0.474889129f},
-std::array<float,2>{0.0897284448f, 0.555244446f},
-std::array<float,2>{0.548293531f, 0.148352697f},
-std::array<float,2>{0.615092039f, 0.831977069f},
-std::array<float,2>{0.0386439599f, 0.257534385f},
-std::array<float,2>{0.339892298f, 0.741531491f},
-std::array<float,2>{0.820017397f, 0.112199426f},
-std::array<float,2>{0.917056203f, 0.598912656f},
-std::array<float,2>{0.49243328f, 0.219163314f},
-std::array<float,2>{0.242340177f, 0.975470781f},
-std::array<float,2>{0.719023943f, 0.421710819f},
-std::array<float,2>{0.731680155f, 0.534816921f},
-std::array<float,2>{0.236129194f, 0.125412151f},
-std::array<float,2>{0.486910075f, 0.913788557f},
-std::array<float,2>{0.913359344f, 0.499561816f},
-std::array<float,2>{0.820618987f, 0.783960223f},
-std::array<float,2>{0.334275126f, 0.371776253f},
-std::array<float,2>{0.0391603224f, 0.674038708f},
-std::array<float,2>{0.61756593f, 0.0512384847f},
-std::array<float,2>{0.560859561f, 0.986708999f},
-std::array<float,2>{0.0790487602f, 0.425218642f},
-std::array<float,2>{0.271178216f, 0.617036998f},
-std::array<float,2>{0.785657823f, 0.237322822f},
-std::array<float,2>{0.996419489f, 0.722526491f},
-std::array<float,2>{0.424415082f, 0.0983119681f},
-std::array<float,2>{0.176912278f, 0.817142963f},
-std::array<float,2>{0.657964885f, 0.278050303f},
-std::array<float,2>{0.573374033f, 0.631893992f},
-std::array<float,2>{0.0206954852f, 0.0186906811f},
-std::array<float,2>{0.353910685f, 0.765760958f},
-std::array<float,2>{0.860092938f, 0.341151267f},
-std::array<float,2>{0.903858602f, 0.899563074f},
-std::array<float,2>{0.46501568f, 0.441962212f},
-std::array<float,2>{0.194486663f, 0.527493596f},
-std::array<float,2>{0.70691669f, 0.185887724f},
-std::array<float,2>{0.642765939f, 0.852953911f},
-std::array<float,2>{0.142813712f, 0.309506118f},
-std::array<float,2>{0.379492998f, 0.703929007f},
-std::array<float,2>{0.967189908f, 0.0811043531f},
-std::array<float,2>{0.770386994f, 0.581370592f},
-std::array<float,2>{0.305768162f, 0.194160685f},
-std::array<float,2>{0.120117262f, 0.967631459f},
-std::array<float,2>{0.52144587f, 0.375368804f},
-std::array<float,2>{0.503486395f, 0.597356796f},
-std::array<float,2>{0.108747765f, 0.226430118f},
-std::array<float,2>{0.289029658f, 0.969085276f},
-std::array<float,2>{0.751927912f, 0.415507913f},
-std::array<float,2>{0.943058074f, 0.832296014f},
-std::array<float,2>{0.397486567f, 0.250845194f},
-std::array<float,2>{0.127460986f, 0.735732496f},
-std::array<float,2>{0.637800694f, 0.11438977f},
-std::array<float,2>{0.693114758f, 0.93583113f},
-std::array<float,2>{0.218494117f, 0.470560551f},
-std::array<float,2>{0.440580845f, 0.560308516f},
-std::array<float,2>{0.882434011f, 0.14357014f},
-std::array<float,2>{0.855889976f, 0.658223391f},
-std::array<float,2>{0.368323803f, 0.0403342769f},
-std::array<float,2>{0.00755413249f, 0.798570096f},
-std::array<float,2>{0.582095742f, 0.348917305f},
-std::array<float,2>{0.67584765f, 0.700197935f},
-std::array<float,2>{0.16923508f, 0.0699659809f},
-std::array<float,2>{0.408956319f, 0.865478873f},
-std::array<float,2>{0.973938704f, 0.291763812f},
-std::array<float,2>{0.811558902f, 0.947235823f},
-std::array<float,2>{0.258831799f, 0.406011522f},
-std::array<float,2>{0.0768654868f, 0.572008491f},
-std::array<float,2>{0.54392153f, 0.213800684f},
-std::array<float,2>{0.60581851f, 0.763854921f},
-std::array<float,2>{0.0479522832f, 0.321429461f},
-std::array<float,2>{0.317833334f, 0.641253889f},
-std::array<float,2>{0.84244442f, 0.0036786783f},
-std::array<float,2>{0.937059462f, 0.501065433f},
-std::array<float,2>{0.479541898f, 0.168205783f},
-std::array<float,2>{0.229092896f, 0.87892884f},
-std::array<float,2>{0.745800376f, 0.460036635f},
-std::array<float,2>{0.62711513f, 0.563956738f},
-std::array<float,2>{0.134576097f, 0.209852383f},
-std::array<float,2>{0.40548867f, 0.943358064f},
-std::array<float,2>{0.949918687f, 0.398130953f},
-std::array<float,2>{0.764936268f, 0.870448291f},
-std::array<float,2>{0.294020474f, 0.28556028f},
-std::array<float,2>{0.0940018892f, 0.692205966f},
-std::array<float,2>{0.509887934f, 0.0778611377f},
-std::array<float,2>{0.593350649f, 0.883470178f},
-std::array<float,2>{0.010473622f, 0.465930015f},
-std::array<float,2>{0.360058844f, 0.508420587f},
-std::array<float,2>{0.845642805f, 0.156930149f},
-std::array<float,2>{0.887240946f, 0.655183136f},
-std::array<float,2>{0.448970705f, 0.00955540221f},
-std::array<float,2>{0.20825009f, 0.755045593f},
-std::array<float,2>{0.702070892f, 0.316820502f},
-std::array<float,2>{0.535154581f, 0.748382807f},
-std::array<float,2>{0.0677349269f, 0.123169668f},
-std::array<float,2>{0.255033523f, 0.842413723f},
-std::array<float,2>{0.798524976f, 0.262561589f},
-std::array<float,2>{0.977028608f, 0.980318248f},
-std::array<float,2>{0.417426705f, 0.406674355f},
-std::array<float,2>{0.159468129f, 0.6045627f},
-std::array<float,2>{0.68173331f, 0.233522967f},
-std::array<float,2>{0.737841725f, 0.809836805f},
-std::array<float,2>{0.221842632f, 0.357980549f},
-std::array<float,2>{0.470212668f, 0.666039169f},
-std::array<float,2>{0.928613126f, 0.0356231518f},
-std::array<float,2>{0.835692286f, 0.55456984f},
-std::array<float,2>{0.325592279f, 0.152941242f},
-std::array<float,2>{0.0590354539f, 0.926132977f},
-std::array<float,2>{0.594534159f, 0.482103854f},
-std::array<float,2>{0.612971663f, 0.518998027f},
-std::array<float,2>{0.0341335349f, 0.17420575f},
-std::array<float,2>{0.337927788f, 0.897250593f},
-std::array<float,2>{0.81262207f, 0.451254666f},
-std::array<float,2>{0.918310165f, 0.775011301f},
-std::array<float,2>{0.497544676f, 0.330590725f},
-std::array<float,2>{0.246483594f, 0.636370599f},
-std::array<float,2>{0.725768507f, 0.0301474072f},
-std::array<float,2>{0.667229772f, 0.957699597f},
-std::array<float,2>{0.183661699f, 0.386193633f},
-std::array<float,2>{0.429881334f, 0.589626908f},
-std::array<float,2>{0.990934074f, 0.200685173f},
-std::array<float,2>{0.791717172f, 0.716820717f},
-std::array<float,2>{0.279478043f, 0.089527078f},
-std::array<float,2>{0.0925958827f, 0.849424541f},
-std::array<float,2>{0.553988636f, 0.299518079f},
-std::array<float,2>{0.717527032f, 0.681854069f},
-std::array<float,2>{0.199953556f, 0.0602966622f},
-std::array<float,2>{0.460831255f, 0.792985439f},
-std::array<float,2>{0.896567166f, 0.363037109f},
-std::array<float,2>{0.874853849f, 0.914271295f},
-std::array<float,2>{0.350304157f, 0.491927296f},
-std::array<float,2>{0.0273753591f, 0.541751504f},
-std::array<float,2>{0.566814542f, 0.139260709f},
-std::array<float,2>{0.524030149f, 0.824592829f},
-std::array<float,2>{0.112965047f, 0.272063613f},
-std::array<float,2>{0.297946423f, 0.732014239f},
-std::array<float,2>{0.77515775f, 0.104774065f},
-std::array<float,2>{0.960600436f, 0.620893776f},
-std::array<float,2>{0.387407362f, 0.247672498f},
-std::array<float,2>{0.149217799f, 0.994261742f},
-std::array<float,2>{0.652150512f, 0.435558259f},
-std::array<float,2>{0.662074804f, 0.513644099f},
-std::array<float,2>{0.172736868f, 0.161676347f},
-std::array<float,2>{0.426263332f, 0.890555799f},
-std::array<float,2>{0.993648529f, 0.464587867f},
-std::array<float,2>{0.781477571f, 0.751386642f},
-std::array<float,2>{0.26818499f, 0.314068347f},
-std::array<float,2>{0.0831688121f, 0.651060224f},
-std::array<float,2>{0.558043778f, 0.0152240088f},
-std::array<float,2>{0.622808874f, 0.939339042f},
-std::array<float,2>{0.044790227f, 0.393402219f},
-std::array<float,2>{0.33063218f, 0.568202376f},
-std::array<float,2>{0.824578166f, 0.204540581f},
-std::array<float,2>{0.908640921f, 0.689288259f},
-std::array<float,2>{0.491394103f, 0.0708752573f},
-std::array<float,2>{0.241937682f, 0.874866009f},
-std::array<float,2>{0.72812283f, 0.282990962f},
-std::array<float,2>{0.516241312f, 0.671528101f},
-std::array<float,2>{0.121247806f, 0.0324642546f},
-std::array<float,2>{0.309630841f, 0.807659864f},
-std::array<float,2>{0.767480731f, 0.3529028f},
-std::array<float,2>{0.964827895f, 0.925596833f},
-std::array<float,2>{0.378535271f, 0.47661525f},
-std::array<float,2>{0.147794902f, 0.550701797f},
-std::array<float,2>{0.645440161f, 0.149265409f},
-std::array<float,2>{0.707417369f, 0.839763045f},
-std::array<float,2>{0.188718855f, 0.261438191f},
-std::array<float,2>{0.461236805f, 0.742470205f},
-std::array<float,2>{0.90128845f, 0.117451675f},
-std::array<float,2>{0.865373492f, 0.606102288f},
-std::array<float,2>{0.356407315f, 0.227062613f},
-std::array<float,2>{0.0191101599f, 0.981383085f},
-std::array<float,2>{0.575408697f, 0.41041553f},
-std::array<float,2>{0.581480324f, 0.593110383f},
-std::array<float,2>{0.00209987862f, 0.198651657f},
-std::array<float,2>{0.373960137f, 0.95585376f},
-std::array<float,2>{0.854425967f, 0.386844099f},
-std::array<float,2>{0.87685889f, 0.845351815f},
-std::array<float,2>{0.442943156f, 0.301933527f},
-std::array<float,2>{0.21323052f, 0.712793469f},
-std::array<float,2>{0.689727724f, 0.092904292f},
-std::array<float,2>{0.634818554f, 0.891789854f},
-std::array<float,2>{0.131917655f, 0.448002517f},
-std::array<float,2>{0.391453981f, 0.523340583f},
-std::array<float,2>{0.939180195f, 0.17920202f},
-std::array<float,2>{0.75742954f, 0.639250278f},
-std::array<float,2>{0.283514142f, 0.0247898214f},
-std::array<float,2>{0.103004411f, 0.78121984f},
-std::array<float,2>{0.50716573f, 0.33312884f},
-std::array<float,2>{0.747807324f, 0.728380442f},
-std::array<float,2>{0.232061476f, 0.106375322f},
-std::array<float,2>{0.480990499f, 0.822841227f},
-std::array<float,2>{0.931219518f, 0.267443866f},
-std::array<float,2>{0.838054776f, 0.99931401f},
-std::array<float,2>{0.312789828f, 0.429777771f},
-std::array<float,2>{0.0525005609f, 0.622463942f},
-std::array<float,2>{0.605000913f, 0.242925242f},
-std::array<float,2>{0.539372325f, 0.789097905f},
-std::array<float,2>{0.0711256191f, 0.363550335f},
-std::array<float,2>{0.264921993f, 0.683871448f},
-std::array<float,2>{0.804859698f, 0.0548258312f},
-std::array<float,2>{0.971934021f, 0.546143353f},
-std::array<float,2>{0.41096738f, 0.133306921f},
-std::array<float,2>{0.166829973f, 0.921469569f},
-std::array<float,2>{0.674817801f, 0.487226278f},
-std::array<float,2>{0.695428908f, 0.612689197f},
-std::array<float,2>{0.203915223f, 0.242126286f},
-std::array<float,2>{0.450475156f, 0.991306961f},
-std::array<float,2>{0.885679066f, 0.42863372f},
-std::array<float,2>{0.850559533f, 0.813706696f},
-std::array<float,2>{0.365979463f, 0.2736772f},
-std::array<float,2>{0.0155187054f, 0.726024568f},
-std::array<float,2>{0.588198245f, 0.0974441841f},
-std::array<float,2>{0.514609575f, 0.908739626f},
-std::array<float,2>{0.099936448f, 0.494488537f},
-std::array<float,2>{0.289917082f, 0.538625002f},
-std::array<float,2>{0.760429263f, 0.132274687f},
-std::array<float,2>{0.946036875f, 0.676857769f},
-std::array<float,2>{0.400919408f, 0.049952358f},
-std::array<float,2>{0.140105426f, 0.785612702f},
-std::array<float,2>{0.631689548f, 0.370177358f},
-std::array<float,2>{0.600530148f, 0.710414171f},
-std::array<float,2>{0.0562590361f, 0.0851886347f},
-std::array<float,2>{0.320499837f, 0.857451737f},
-std::array<float,2>{0.828637838f, 0.308506101f},
-std::array<float,2>{0.922404647f, 0.963353515f},
-std::array<float,2>{0.475313634f, 0.37986511f},
-std::array<float,2>{0.226367176f, 0.58390373f},
-std::array<float,2>{0.741807938f, 0.190159976f},
-std::array<float,2>{0.683631897f, 0.771636248f},
-std::array<float,2>{0.162662745f, 0.339360178f},
-std::array<float,2>{0.418560237f, 0.626511812f},
-std::array<float,2>{0.982246876f, 0.0229809806f},
-std::array<float,2>{0.80355531f, 0.524145484f},
-std::array<float,2>{0.253697991f, 0.180112019f},
-std::array<float,2>{0.0655961111f, 0.902405858f},
-std::array<float,2>{0.537356913f, 0.440531284f},
-std::array<float,2>{0.55043298f, 0.557475269f},
-std::array<float,2>{0.086864017f, 0.145764366f},
-std::array<float,2>{0.275365978f, 0.931929708f},
-std::array<float,2>{0.793356478f, 0.474228084f},
-std::array<float,2>{0.987852871f, 0.801559865f},
-std::array<float,2>{0.436521828f, 0.347009242f},
-std::array<float,2>{0.181984976f, 0.661779046f},
-std::array<float,2>{0.668111384f, 0.0449347049f},
-std::array<float,2>{0.722421706f, 0.973935246f},
-std::array<float,2>{0.245377198f, 0.417982608f},
-std::array<float,2>{0.495967537f, 0.600067854f},
-std::array<float,2>{0.914117515f, 0.221321374f},
-std::array<float,2>{0.816573203f, 0.738393605f},
-std::array<float,2>{0.34259522f, 0.109944932f},
-std::array<float,2>{0.0357604399f, 0.829588175f},
-std::array<float,2>{0.616534293f, 0.254383832f},
-std::array<float,2>{0.655420721f, 0.648324311f},
-std::array<float,2>{0.153407574f, 0.00573098473f},
-std::array<float,2>{0.383992672f, 0.76057452f},
-std::array<float,2>{0.955931544f, 0.326981872f},
-std::array<float,2>{0.779338419f, 0.876393557f},
-std::array<float,2>{0.304379016f, 0.455142617f},
-std::array<float,2>{0.116893344f, 0.505348563f},
-std::array<float,2>{0.53016001f, 0.167333946f},
-std::array<float,2>{0.564041913f, 0.860700607f},
-std::array<float,2>{0.0260125846f, 0.294862568f},
-std::array<float,2>{0.346813291f, 0.69769913f},
-std::array<float,2>{0.869145095f, 0.063015081f},
-std::array<float,2>{0.894340932f, 0.574444354f},
-std::array<float,2>{0.455587089f, 0.21841526f},
-std::array<float,2>{0.196657717f, 0.950132728f},
-std::array<float,2>{0.711555541f, 0.401631713f},
-std::array<float,2>{0.715819597f, 0.541099429f},
-std::array<float,2>{0.202906668f, 0.138687581f},
-std::array<float,2>{0.457344234f, 0.914712846f},
-std::array<float,2>{0.895300925f, 0.491552591f},
-std::array<float,2>{0.872433603f, 0.793784857f},
-std::array<float,2>{0.348789424f, 0.362703234f},
-std::array<float,2>{0.0307903923f, 0.682216763f},
-std::array<float,2>{0.569784582f, 0.0600255057f},
-std::array<float,2>{0.526059091f, 0.995030522f},
-std::array<float,2>{0.109777354f, 0.436407506f},
-std::array<float,2>{0.298858821f, 0.620554268f},
-std::array<float,2>{0.777161598f, 0.247122109f},
-std::array<float,2>{0.958964944f, 0.731907606f},
-std::array<float,2>{0.389920741f, 0.105332986f},
-std::array<float,2>{0.151895151f, 0.825111151f},
-std::array<float,2>{0.650334001f, 0.271555096f},
-std::array<float,2>{0.610162139f, 0.636207938f},
-std::array<float,2>{0.0320442431f, 0.0295800082f},
-std::array<float,2>{0.336386889f, 0.774670362f},
-std::array<float,2>{0.814676583f, 0.330534577f},
-std::array<float,2>{0.921354949f, 0.896763802f},
-std::array<float,2>{0.4997302f, 0.451867312f},
-std::array<float,2>{0.249499828f, 0.519205272f},
-std::array<float,2>{0.723684669f, 0.174654022f},
-std::array<float,2>{0.665067613f, 0.848850906f},
-std::array<float,2>{0.186508253f, 0.298919141f},
-std::array<float,2>{0.432242632f, 0.717497945f},
-std::array<float,2>{0.988841355f, 0.0888834f},
-std::array<float,2>{0.789447129f, 0.588992119f},
-std::array<float,2>{0.27893436f, 0.200414643f},
-std::array<float,2>{0.0913236365f, 0.957464755f},
-std::array<float,2>{0.55154103f, 0.386485755f},
-std::array<float,2>{0.531838655f, 0.6054371f},
-std::array<float,2>{0.0702101812f, 0.23431015f},
-std::array<float,2>{0.255890131f, 0.979913116f},
-std::array<float,2>{0.799176455f, 0.407081157f},
-std::array<float,2>{0.978595734f, 0.841839671f},
-std::array<float,2>{0.415649056f, 0.261808008f},
-std::array<float,2>{0.156843692f, 0.748947501f},
-std::array<float,2>{0.681593478f, 0.123915866f},
-std::array<float,2>{0.734556079f, 0.926481783f},
-std::array<float,2>{0.21892339f, 0.481718779f},
-std::array<float,2>{0.47206521f, 0.554141879f},
-std::array<float,2>{0.926382124f, 0.152581915f},
-std::array<float,2>{0.832427442f, 0.666662514f},
-std::array<float,2>{0.326761633f, 0.0357751958f},
-std::array<float,2>{0.0614384674f, 0.810134113f},
-std::array<float,2>{0.596866906f, 0.357478231f},
-std::array<float,2>{0.626119018f, 0.691768885f},
-std::array<float,2>{0.135326937f, 0.0773855448f},
-std::array<float,2>{0.403868496f, 0.870769799f},
-std::array<float,2>{0.951872289f, 0.28609392f},
-std::array<float,2>{0.76266259f, 0.942424059f},
-std::array<float,2>{0.295694172f, 0.397736251f},
-std::array<float,2>{0.096868746f, 0.564046383f},
-std::array<float,2>{0.508150816f, 0.209118843f},
-std::array<float,2>{0.590484083f, 0.755605757f},
-std::array<float,2>{0.00847912766f, 0.317339152f},
-std::array<float,2>{0.361752033f, 0.654311836f},
-std::array<float,2>{0.846040785f, 0.00886545423f},
-std::array<float,2>{0.890075028f, 0.508259594f},
-std::array<float,2>{0.446612656f, 0.156556353f},
-std::array<float,2>{0.209761724f, 0.883214653f},
-std::array<float,2>{0.701065123f, 0.466760159f},
-std::array<float,2>{0.678386927f, 0.57137394f},
-std::array<float,2>{0.171490729f, 0.21328871f},
-std::array<float,2>{0.406834394f, 0.946320891f},
-std::array<float,2>{0.976463854f, 0.405442685f},
-std::array<float,2>{0.809000254f, 0.866143525f},
-std::array<float,2>{0.259869456f, 0.291101873f},
-std::array<float,2>{0.0751675814f, 0.700787604f},
-std::array<float,2>{0.546522915f, 0.0694708228f},
-std::array<float,2>{0.607725203f, 0.879662991f},
-std::array<float,2>{0.0507157482f, 0.460693777f},
-std::array<float,2>{0.319079548f, 0.501543403f},
-std::array<float,2>{0.840997577f, 0.168912932f},
-std::array<float,2>{0.934272766f, 0.641032577f},
-std::array<float,2>{0.476627767f, 0.00311905984f},
-std::array<float,2>{0.228431925f, 0.764354885f},
-std::array<float,2>{0.743516207f, 0.321981192f},
-std::array<float,2>{0.500293612f, 0.735886216f},
-std::array<float,2>{0.10565526f, 0.114778228f},
-std::array<float,2>{0.285205245f, 0.832887888f},
-std::array<float,2>{0.75348562f, 0.250262946f},
-std::array<float,2>{0.943389714f, 0.969429016f},
-std::array<float,2>{0.396027684f, 0.415641993f},
-std::array<float,2>{0.126550585f, 0.597006679f},
-std::array<float,2>{0.639896572f, 0.225800544f},
-std::array<float,2>{0.694716573f, 0.798304558f},
-std::array<float,2>{0.2153081f, 0.349222153f},
-std::array<float,2>{0.43808949f, 0.659078181f},
-std::array<float,2>{0.880659878f, 0.0406162217f},
-std::array<float,2>{0.858932257f, 0.560055256f},
-std::array<float,2>{0.371084094f, 0.144113213f},
-std::array<float,2>{0.00496452488f, 0.93633157f},
-std::array<float,2>{0.584981441f, 0.470012069f},
-std::array<float,2>{0.571855366f, 0.528244972f},
-std::array<float,2>{0.0230100807f, 0.186481133f},
-std::array<float,2>{0.351810694f, 0.900172889f},
-std::array<float,2>{0.863064945f, 0.441636801f},
-std::array<float,2>{0.905115008f, 0.766246676f},
-std::array<float,2>{0.468494803f, 0.341539234f},
-std::array<float,2>{0.191800237f, 0.632563114f},
-std::array<float,2>{0.704144239f, 0.019202305f},
-std::array<float,2>{0.641594708f, 0.966932714f},
-std::array<float,2>{0.141529098f, 0.375675797f},
-std::array<float,2>{0.381859124f, 0.581726074f},
-std::array<float,2>{0.965602338f, 0.193390042f},
-std::array<float,2>{0.772304893f, 0.703130782f},
-std::array<float,2>{0.308333337f, 0.0818033516f},
-std::array<float,2>{0.118713394f, 0.853259921f},
-std::array<float,2>{0.522420049f, 0.308914363f},
-std::array<float,2>{0.732807696f, 0.67478919f},
-std::array<float,2>{0.238108754f, 0.0513101779f},
-std::array<float,2>{0.485333085f, 0.783599913f},
-std::array<float,2>{0.910784423f, 0.371419042f},
-std::array<float,2>{0.823234618f, 0.913465083f},
-std::array<float,2>{0.333643913f, 0.499038517f},
-std::array<float,2>{0.0413575768f, 0.534565806f},
-std::array<float,2>{0.62031883f, 0.125925854f},
-std::array<float,2>{0.558644593f, 0.816881597f},
-std::array<float,2>{0.0802677646f, 0.277794123f},
-std::array<float,2>{0.273082763f, 0.721779406f},
-std::array<float,2>{0.787395895f, 0.0978786945f},
-std::array<float,2>{0.999921024f, 0.61658746f},
-std::array<float,2>{0.422181308f, 0.23809211f},
-std::array<float,2>{0.177745596f, 0.987272084f},
-std::array<float,2>{0.659404397f, 0.425531149f},
-std::array<float,2>{0.652713418f, 0.505787671f},
-std::array<float,2>{0.154818177f, 0.167854205f},
-std::array<float,2>{0.385591656f, 0.876859367f},
-std::array<float,2>{0.953898132f, 0.455673218f},
-std::array<float,2>{0.777498305f, 0.759889185f},
-std::array<float,2>{0.302120596f, 0.326233953f},
-std::array<float,2>{0.115140647f, 0.647699654f},
-std::array<float,2>{0.5275985f, 0.00505245198f},
-std::array<float,2>{0.565004051f, 0.949562252f},
-std::array<float,2>{0.0239294954f, 0.402048051f},
-std::array<float,2>{0.345570207f, 0.575114489f},
-std::array<float,2>{0.867447555f, 0.217923582f},
-std::array<float,2>{0.892148852f, 0.697796881f},
-std::array<float,2>{0.453830779f, 0.0629667714f},
-std::array<float,2>{0.19746913f, 0.861143112f},
-std::array<float,2>{0.713743031f, 0.29412663f},
-std::array<float,2>{0.548467219f, 0.661447346f},
-std::array<float,2>{0.0891994014f, 0.0458469018f},
-std::array<float,2>{0.276642561f, 0.800811231f},
-std::array<float,2>{0.795873404f, 0.347412437f},
-std::array<float,2>{0.98626852f, 0.932418823f},
-std::array<float,2>{0.434846103f, 0.473837614f},
-std::array<float,2>{0.181267232f, 0.55693996f},
-std::array<float,2>{0.671860814f, 0.146206275f},
-std::array<float,2>{0.719588399f, 0.829752743f},
-std::array<float,2>{0.242828324f, 0.254418939f},
-std::array<float,2>{0.492762625f, 0.73904562f},
-std::array<float,2>{0.91758132f, 0.109737083f},
-std::array<float,2>{0.819342434f, 0.600458503f},
-std::array<float,2>{0.340638816f, 0.221080706f},
-std::array<float,2>{0.0384295806f, 0.97437036f},
-std::array<float,2>{0.614587784f, 0.418546408f},
-std::array<float,2>{0.598698676f, 0.583491862f},
-std::array<float,2>{0.0574673489f, 0.18970497f},
-std::array<float,2>{0.323622853f, 0.963841021f},
-std::array<float,2>{0.831501007f, 0.379169583f},
-std::array<float,2>{0.9253335f, 0.858002484f},
-std::array<float,2>{0.472891212f, 0.307744086f},
-std::array<float,2>{0.223627806f, 0.710775495f},
-std::array<float,2>{0.738768876f, 0.0858232081f},
-std::array<float,2>{0.685731053f, 0.902976513f},
-std::array<float,2>{0.160645917f, 0.441391528f},
-std::array<float,2>{0.420578063f, 0.523828626f},
-std::array<float,2>{0.983565986f, 0.180500001f},
-std::array<float,2>{0.801998496f, 0.626014352f},
-std::array<float,2>{0.250608623f, 0.022783218f},
-std::array<float,2>{0.064432092f, 0.772129059f},
-std::array<float,2>{0.53541857f, 0.3392241f},
-std::array<float,2>{0.697357774f, 0.726396859f},
-std::array<float,2>{0.206595689f, 0.0969779268f},
-std::array<float,2>{0.451561004f, 0.814313054f},
-std::array<float,2>{0.88296932f, 0.274106622f},
-std::array<float,2>{0.84859091f, 0.991855025f},
-std::array<float,2>{0.364048213f, 0.427802742f},
-std::array<float,2>{0.0128943333f, 0.613090038f},
-std::array<float,2>{0.587730825f, 0.24131158f},
-std::array<float,2>{0.513049781f, 0.785879791f},
-std::array<float,2>{0.098139517f, 0.370643407f},
-std::array<float,2>{0.291359246f, 0.677271605f},
-std::array<float,2>{0.75817436f, 0.0506801307f},
-std::array<float,2>{0.94777596f, 0.538512468f},
-std::array<float,2>{0.399037957f, 0.132495657f},
-std::array<float,2>{0.13864857f, 0.908667326f},
-std::array<float,2>{0.629403055f, 0.494905919f},
-std::array<float,2>{0.74910748f, 0.62258476f},
-std::array<float,2>{0.233610958f, 0.242329061f},
-std::array<float,2>{0.48301807f, 0.999619782f},
-std::array<float,2>{0.932026803f, 0.430612862f},
-std::array<float,2>{0.836252928f, 0.822384596f},
-std::array<float,2>{0.315450072f, 0.26665616f},
-std::array<float,2>{0.0533885248f, 0.727628827f},
-std::array<float,2>{0.603411913f, 0.105788f},
-std::array<float,2>{0.54131794f, 0.921003997f},
-std::array<float,2>{0.0734667629f, 0.486644506f},
-std::array<float,2>{0.262229949f, 0.546402752f},
-std::array<float,2>{0.807998776f, 0.132864922f},
-std::array<float,2>{0.97003001f, 0.684291601f},
-std::array<float,2>{0.412497193f, 0.0555205792f},
-std::array<float,2>{0.164594442f, 0.789825618f},
-std::array<float,2>{0.673291326f, 0.363955528f},
-std::array<float,2>{0.580064952f, 0.712254167f},
-std::array<float,2>{0.00101581833f, 0.0936298519f},
-std::array<float,2>{0.372311354f, 0.844971061f},
-std::array<float,2>{0.852065086f, 0.302341133f},
-std::array<float,2>{0.877475917f, 0.955130994f},
-std::array<float,2>{0.444866717f, 0.387567908f},
-std::array<float,2>{0.211013258f, 0.593697965f},
-std::array<float,2>{0.687888622f, 0.199078813f},
-std::array<float,2>{0.633502722f, 0.780572295f},
-std::array<float,2>{0.130252913f, 0.333768874f},
-std::array<float,2>{0.394069314f, 0.639023006f},
-std::array<float,2>{0.93964237f, 0.0252691247f},
-std::array<float,2>{0.755179346f, 0.522711456f},
-std::array<float,2>{0.281567156f, 0.179122955f},
-std::array<float,2>{0.104703918f, 0.892221093f},
-std::array<float,2>{0.505281389f, 0.447688371f},
-std::array<float,2>{0.51833117f, 0.54981035f},
-std::array<float,2>{0.124012426f, 0.148805231f},
-std::array<float,2>{0.312380642f, 0.92528075f},
-std::array<float,2>{0.76925838f, 0.477412045f},
-std::array<float,2>{0.961652994f, 0.808326185f},
-std::array<float,2>{0.375460833f, 0.353315294f},
-std::array<float,2>{0.144811466f, 0.670951784f},
-std::array<float,2>{0.64824748f, 0.0330045037f},
-std::array<float,2>{0.709730923f, 0.980768859f},
-std::array<float,2>{0.190736488f, 0.410969526f},
-std::array<float,2>{0.463403672f, 0.605633438f},
-std::array<float,2>{0.90008986f, 0.226668015f},
-std::array<float,2>{0.863932371f, 0.742974401f},
-std::array<float,2>{0.358356446f, 0.117986903f},
-std::array<float,2>{0.0156958532f, 0.83930546f},
-std::array<float,2>{0.577446103f, 0.260776967f},
-std::array<float,2>{0.662112176f, 0.650441766f},
-std::array<float,2>{0.175763831f, 0.0146595407f},
-std::array<float,2>{0.428610653f, 0.751508594f},
-std::array<float,2>{0.994410038f, 0.313681245f},
-std::array<float,2>{0.784255564f, 0.889690697f},
-std::array<float,2>{0.266580403f, 0.463916898f},
-std::array<float,2>{0.0850432292f, 0.512949407f},
-std::array<float,2>{0.556463957f, 0.161323726f},
-std::array<float,2>{0.623760104f, 0.874085009f},
-std::array<float,2>{0.0452863984f, 0.282292157f},
-std::array<float,2>{0.329101652f, 0.688557684f},
-std::array<float,2>{0.827885151f, 0.0707202256f},
-std::array<float,2>{0.907486975f, 0.56758827f},
-std::array<float,2>{0.489510596f, 0.204722524f},
-std::array<float,2>{0.238961905f, 0.938728034f},
-std::array<float,2>{0.729039192f, 0.392617911f},
-std::array<float,2>{0.726493001f, 0.517015219f},
-std::array<float,2>{0.24670887f, 0.17353265f},
-std::array<float,2>{0.497940838f, 0.895849228f},
-std::array<float,2>{0.918806434f, 0.451119453f},
-std::array<float,2>{0.81330961f, 0.775699079f},
-std::array<float,2>{0.338511288f, 0.329073936f},
-std::array<float,2>{0.0332437754f, 0.634521246f},
-std::array<float,2>{0.612620056f, 0.0281803347f},
-std::array<float,2>{0.554418504f, 0.960190594f},
-std::array<float,2>{0.0919032246f, 0.383504033f},
-std::array<float,2>{0.280068994f, 0.587687731f},
-std::array<float,2>{0.791145921f, 0.202941865f},
-std::array<float,2>{0.990350604f, 0.716699123f},
-std::array<float,2>{0.430370927f, 0.0871907473f},
-std::array<float,2>{0.184502557f, 0.850870252f},
-std::array<float,2>{0.667684257f, 0.297829986f},
-std::array<float,2>{0.567123234f, 0.679840982f},
-std::array<float,2>{0.0280227643f, 0.0621865168f},
-std::array<float,2>{0.349740952f, 0.795051515f},
-std::array<float,2>{0.874244213f, 0.361066669f},
-std::array<float,2>{0.897418261f, 0.917894661f},
-std::array<float,2>{0.460322291f, 0.488500148f},
-std::array<float,2>{0.19954212f, 0.540255785f},
-std::array<float,2>{0.717263341f, 0.138002202f},
-std::array<float,2>{0.651429415f, 0.826320469f},
-std::array<float,2>{0.148643792f, 0.271446496f},
-std::array<float,2>{0.387131989f, 0.73318547f},
-std::array<float,2>{0.960273027f, 0.103172585f},
-std::array<float,2>{0.774579942f, 0.618826032f},
-std::array<float,2>{0.298391819f, 0.249696359f},
-std::array<float,2>{0.112349175f, 0.992971718f},
-std::array<float,2>{0.523828924f, 0.433826506f},
-std::array<float,2>{0.510406494f, 0.564516902f},
-std::array<float,2>{0.0946194977f, 0.207843855f},
-std::array<float,2>{0.294676721f, 0.9439466f},
-std::array<float,2>{0.765389085f, 0.395976931f},
-std::array<float,2>{0.94958365f, 0.867648482f},
-std::array<float,2>{0.405870497f, 0.287975818f},
-std::array<float,2>{0.134187579f, 0.693902731f},
-std::array<float,2>{0.62787652f, 0.0748936012f},
-std::array<float,2>{0.701386809f, 0.886384189f},
-std::array<float,2>{0.208559424f, 0.467703074f},
-std::array<float,2>{0.448412448f, 0.5110057f},
-std::array<float,2>{0.886765838f, 0.159114867f},
-std::array<float,2>{0.84486413f, 0.654268026f},
-std::array<float,2>{0.359716505f, 0.0101519162f},
-std::array<float,2>{0.0101104258f, 0.757520616f},
-std::array<float,2>{0.593078494f, 0.31868124f},
-std::array<float,2>{0.682489216f, 0.747076631f},
-std::array<float,2>{0.160131067f, 0.12250296f},
-std::array<float,2>{0.417869151f, 0.840547562f},
-std::array<float,2>{0.977400422f, 0.263917774f},
-std::array<float,2>{0.798177302f, 0.978367269f},
-std::array<float,2>{0.255550981f, 0.409715742f},
-std::array<float,2>{0.0682253763f, 0.601695716f},
-std::array<float,2>{0.534660459f, 0.231356844f},
-std::array<float,2>{0.594181776f, 0.811799645f},
-std::array<float,2>{0.059441328f, 0.356440276f},
-std::array<float,2>{0.326118857f, 0.665463388f},
-std::array<float,2>{0.835352302f, 0.0373411402f},
-std::array<float,2>{0.927873194f, 0.551288307f},
-std::array<float,2>{0.470675588f, 0.1544687f},
-std::array<float,2>{0.22244744f, 0.929321945f},
-std::array<float,2>{0.737316012f, 0.483281016f},
-std::array<float,2>{0.638668478f, 0.594208181f},
-std::array<float,2>{0.127028435f, 0.224535808f},
-std::array<float,2>{0.398025334f, 0.971610725f},
-std::array<float,2>{0.942579269f, 0.417134672f},
-std::array<float,2>{0.751427531f, 0.834451377f},
-std::array<float,2>{0.288394153f, 0.252872437f},
-std::array<float,2>{0.10932643f, 0.736959219f},
-std::array<float,2>{0.503171146f, 0.116567202f},
-std::array<float,2>{0.582675219f, 0.935116768f},
-std::array<float,2>{0.00688172132f, 0.471326172f},
-std::array<float,2>{0.369088918f, 0.562395871f},
-std::array<float,2>{0.85615772f, 0.14156948f},
-std::array<float,2>{0.882236779f, 0.657345831f},
-std::array<float,2>{0.44135046f, 0.0417848341f},
-std::array<float,2>{0.218128145f, 0.799175262f},
-std::array<float,2>{0.692570508f, 0.350033045f},
-std::array<float,2>{0.543031931f, 0.701275229f},
-std::array<float,2>{0.0762153193f, 0.0674207434f},
-std::array<float,2>{0.259630382f, 0.865030468f},
-std::array<float,2>{0.812084198f, 0.29020372f},
-std::array<float,2>{0.974217355f, 0.947769105f},
-std::array<float,2>{0.40834555f, 0.403212756f},
-std::array<float,2>{0.16954124f, 0.573379517f},
-std::array<float,2>{0.676478446f, 0.211267054f},
-std::array<float,2>{0.745181024f, 0.763412952f},
-std::array<float,2>{0.228797376f, 0.323950976f},
-std::array<float,2>{0.480169415f, 0.64381212f},
-std::array<float,2>{0.936725855f, 0.00156063354f},
-std::array<float,2>{0.842168987f, 0.502713978f},
-std::array<float,2>{0.317903191f, 0.17165108f},
-std::array<float,2>{0.0484248288f, 0.881630421f},
-std::array<float,2>{0.606024921f, 0.457071245f},
-std::array<float,2>{0.61788559f, 0.532586396f},
-std::array<float,2>{0.0400194302f, 0.127073973f},
-std::array<float,2>{0.334856629f, 0.911199689f},
-std::array<float,2>{0.820849359f, 0.496411771f},
-std::array<float,2>{0.913987219f, 0.782802522f},
-std::array<float,2>{0.486412942f, 0.373760611f},
-std::array<float,2>{0.235825852f, 0.67224282f},
-std::array<float,2>{0.732201874f, 0.0528447405f},
-std::array<float,2>{0.657293618f, 0.984992802f},
-std::array<float,2>{0.177570522f, 0.422518611f},
-std::array<float,2>{0.423926592f, 0.614704192f},
-std::array<float,2>{0.996859193f, 0.235533699f},
-std::array<float,2>{0.785459042f, 0.719310224f},
-std::array<float,2>{0.270741254f, 0.0996542573f},
-std::array<float,2>{0.0785525888f, 0.818762481f},
-std::array<float,2>{0.561121702f, 0.280856222f},
-std::array<float,2>{0.706456184f, 0.628985345f},
-std::array<float,2>{0.19521293f, 0.0159528069f},
-std::array<float,2>{0.465404183f, 0.767917395f},
-std::array<float,2>{0.903441548f, 0.342041343f},
-std::array<float,2>{0.85944587f, 0.901384532f},
-std::array<float,2>{0.354174167f, 0.445057303f},
-std::array<float,2>{0.0214512497f, 0.531111777f},
-std::array<float,2>{0.573894918f, 0.185484588f},
-std::array<float,2>{0.520593464f, 0.854843557f},
-std::array<float,2>{0.120654956f, 0.31210947f},
-std::array<float,2>{0.306213796f, 0.705957413f},
-std::array<float,2>{0.769892573f, 0.0786887184f},
-std::array<float,2>{0.967373967f, 0.579787791f},
-std::array<float,2>{0.378924876f, 0.191786781f},
-std::array<float,2>{0.1433198f, 0.965663373f},
-std::array<float,2>{0.643397152f, 0.377390385f},
-std::array<float,2>{0.668783069f, 0.55470109f},
-std::array<float,2>{0.182477668f, 0.147748053f},
-std::array<float,2>{0.435988635f, 0.930188179f},
-std::array<float,2>{0.98762399f, 0.475305647f},
-std::array<float,2>{0.793606281f, 0.803091288f},
-std::array<float,2>{0.274547637f, 0.344222784f},
-std::array<float,2>{0.0863006264f, 0.662526011f},
-std::array<float,2>{0.550134003f, 0.0433527008f},
-std::array<float,2>{0.616921842f, 0.97503835f},
-std::array<float,2>{0.035158433f, 0.421255529f},
-std::array<float,2>{0.341854095f, 0.599125087f},
-std::array<float,2>{0.817209542f, 0.219539285f},
-std::array<float,2>{0.914882183f, 0.742014766f},
-std::array<float,2>{0.495268077f, 0.111337185f},
-std::array<float,2>{0.245777264f, 0.831070364f},
-std::array<float,2>{0.721836388f, 0.257208139f},
-std::array<float,2>{0.529592693f, 0.645890653f},
-std::array<float,2>{0.116383731f, 0.00599385705f},
-std::array<float,2>{0.303819776f, 0.759120166f},
-std::array<float,2>{0.780184031f, 0.324353129f},
-std::array<float,2>{0.955392122f, 0.878029227f},
-std::array<float,2>{0.384680301f, 0.453313202f},
-std::array<float,2>{0.1539478f, 0.506804883f},
-std::array<float,2>{0.655989349f, 0.165197492f},
-std::array<float,2>{0.711199164f, 0.862164974f},
-std::array<float,2>{0.196981251f, 0.29617697f},
-std::array<float,2>{0.455319852f, 0.696333349f},
-std::array<float,2>{0.893931687f, 0.0648246184f},
-std::array<float,2>{0.869899452f, 0.576669931f},
-std::array<float,2>{0.34757489f, 0.215763673f},
-std::array<float,2>{0.0258248579f, 0.951453447f},
-std::array<float,2>{0.563790679f, 0.400247216f},
-std::array<float,2>{0.588423848f, 0.60961926f},
-std::array<float,2>{0.0148710962f, 0.23872669f},
-std::array<float,2>{0.365384161f, 0.989790022f},
-std::array<float,2>{0.84995985f, 0.426349849f},
-std::array<float,2>{0.884872854f, 0.815964758f},
-std::array<float,2>{0.450740755f, 0.275655389f},
-std::array<float,2>{0.203297183f, 0.723307371f},
-std::array<float,2>{0.69587934f, 0.0938655213f},
-std::array<float,2>{0.630968809f, 0.906825781f},
-std::array<float,2>{0.140449196f, 0.493244916f},
-std::array<float,2>{0.400622547f, 0.535635173f},
-std::array<float,2>{0.945632517f, 0.130606025f},
-std::array<float,2>{0.760035038f, 0.679344058f},
-std::array<float,2>{0.289364755f, 0.0481056869f},
-std::array<float,2>{0.100280508f, 0.787428498f},
-std::array<float,2>{0.513999224f, 0.368227243f},
-std::array<float,2>{0.741634429f, 0.707802773f},
-std::array<float,2>{0.225590646f, 0.0823457614f},
-std::array<float,2>{0.474830955f, 0.856814981f},
-std::array<float,2>{0.921989739f, 0.306216121f},
-std::array<float,2>{0.828455448f, 0.96096909f},
-std::array<float,2>{0.321149617f, 0.382453561f},
-std::array<float,2>{0.0560127944f, 0.585549831f},
-std::array<float,2>{0.599971414f, 0.187910452f},
-std::array<float,2>{0.537673652f, 0.771244466f},
-std::array<float,2>{0.0662749037f, 0.337576091f},
-std::array<float,2>{0.253052622f, 0.62711072f},
-std::array<float,2>{0.803066611f, 0.01973629f},
-std::array<float,2>{0.981458783f, 0.526923001f},
-std::array<float,2>{0.418064028f, 0.183231264f},
-std::array<float,2>{0.162368521f, 0.905162334f},
-std::array<float,2>{0.684494257f, 0.438082218f},
-std::array<float,2>{0.690336466f, 0.591665149f},
-std::array<float,2>{0.213623658f, 0.196924433f},
-std::array<float,2>{0.442482591f, 0.954625785f},
-std::array<float,2>{0.876149952f, 0.390217364f},
-std::array<float,2>{0.853938401f, 0.847451925f},
-std::array<float,2>{0.37344721f, 0.30453968f},
-std::array<float,2>{0.00250535761f, 0.713401079f},
-std::array<float,2>{0.581547499f, 0.091007784f},
-std::array<float,2>{0.507757485f, 0.893300653f},
-std::array<float,2>{0.103196114f, 0.445423305f},
-std::array<float,2>{0.283894956f, 0.520725965f},
-std::array<float,2>{0.757196367f, 0.17596899f},
-std::array<float,2>{0.938704133f, 0.637033284f},
-std::array<float,2>{0.391024739f, 0.0262356978f},
-std::array<float,2>{0.13267076f, 0.778857172f},
-std::array<float,2>{0.635650337f, 0.334885657f},
-std::array<float,2>{0.604543626f, 0.72962147f},
-std::array<float,2>{0.051832851f, 0.108377255f},
-std::array<float,2>{0.313085705f, 0.821994305f},
-std::array<float,2>{0.838858902f, 0.268669188f},
-std::array<float,2>{0.930774868f, 0.997585416f},
-std::array<float,2>{0.480856508f, 0.432594299f},
-std::array<float,2>{0.231556058f, 0.624987185f},
-std::array<float,2>{0.747116208f, 0.24441503f},
-std::array<float,2>{0.67541182f, 0.792551398f},
-std::array<float,2>{0.166139588f, 0.366086811f},
-std::array<float,2>{0.410292655f, 0.685871303f},
-std::array<float,2>{0.972348273f, 0.0583202615f},
-std::array<float,2>{0.805415809f, 0.544017732f},
-std::array<float,2>{0.265427917f, 0.136657327f},
-std::array<float,2>{0.0707116425f, 0.919074535f},
-std::array<float,2>{0.539888561f, 0.484663099f},
-std::array<float,2>{0.558406591f, 0.513843477f},
-std::array<float,2>{0.0839496851f, 0.163931772f},
-std::array<float,2>{0.267755032f, 0.886863828f},
-std::array<float,2>{0.78192389f, 0.462119639f},
-std::array<float,2>{0.994092941f, 0.751963079f},
-std::array<float,2>{0.426573604f, 0.314846009f},
-std::array<float,2>{0.17195873f, 0.649528742f},
-std::array<float,2>{0.661355138f, 0.0133000249f},
-std::array<float,2>{0.727751136f, 0.941212833f},
-std::array<float,2>{0.241583034f, 0.391158402f},
-std::array<float,2>{0.492017657f, 0.570192397f},
-std::array<float,2>{0.908923805f, 0.205683932f},
-std::array<float,2>{0.825137496f, 0.689609826f},
-std::array<float,2>{0.330383956f, 0.0737063885f},
-std::array<float,2>{0.044117339f, 0.871990323f},
-std::array<float,2>{0.622496843f, 0.284450382f},
-std::array<float,2>{0.644793153f, 0.668798029f},
-std::array<float,2>{0.148034215f, 0.035135325f},
-std::array<float,2>{0.378308177f, 0.805187643f},
-std::array<float,2>{0.964001417f, 0.355211407f},
-std::array<float,2>{0.766954958f, 0.922980428f},
-std::array<float,2>{0.310328603f, 0.479842633f},
-std::array<float,2>{0.121714704f, 0.546961129f},
-std::array<float,2>{0.515970528f, 0.151473761f},
-std::array<float,2>{0.576064944f, 0.837104619f},
-std::array<float,2>{0.0186567549f, 0.259582072f},
-std::array<float,2>{0.355856955f, 0.745290816f},
-std::array<float,2>{0.866151512f, 0.119669043f},
-std::array<float,2>{0.900789618f, 0.607784152f},
-std::array<float,2>{0.461631507f, 0.230157435f},
-std::array<float,2>{0.189148948f, 0.98322016f},
-std::array<float,2>{0.707553923f, 0.412354708f},
-std::array<float,2>{0.699831069f, 0.5105744f},
-std::array<float,2>{0.21069175f, 0.159948736f},
-std::array<float,2>{0.445567578f, 0.885352969f},
-std::array<float,2>{0.888921678f, 0.468031645f},
-std::array<float,2>{0.846816361f, 0.756297946f},
-std::array<float,2>{0.362349182f, 0.320009619f},
-std::array<float,2>{0.00948947947f, 0.652825117f},
-std::array<float,2>{0.591046333f, 0.0110384589f},
-std::array<float,2>{0.509370863f, 0.944382608f},
-std::array<float,2>{0.0965963602f, 0.394743264f},
-std::array<float,2>{0.296848059f, 0.56572032f},
-std::array<float,2>{0.763421774f, 0.208701342f},
-std::array<float,2>{0.952376962f, 0.695117176f},
-std::array<float,2>{0.402880758f, 0.0755131021f},
-std::array<float,2>{0.135836959f, 0.868302047f},
-std::array<float,2>{0.625439942f, 0.288920045f},
-std::array<float,2>{0.596376598f, 0.664448977f},
-std::array<float,2>{0.0615450926f, 0.0384303741f},
-std::array<float,2>{0.327691525f, 0.811436117f},
-std::array<float,2>{0.833161414f, 0.356624216f},
-std::array<float,2>{0.927061737f, 0.928439379f},
-std::array<float,2>{0.471470445f, 0.483934224f},
-std::array<float,2>{0.220075801f, 0.552259743f},
-std::array<float,2>{0.735943019f, 0.156147689f},
-std::array<float,2>{0.680221379f, 0.84112817f},
-std::array<float,2>{0.157719627f, 0.265156567f},
-std::array<float,2>{0.414631516f, 0.746194243f},
-std::array<float,2>{0.979623914f, 0.121913925f},
-std::array<float,2>{0.799869478f, 0.603262842f},
-std::array<float,2>{0.257455677f, 0.232409015f},
-std::array<float,2>{0.0684311092f, 0.977266908f},
-std::array<float,2>{0.533070445f, 0.408970296f},
-std::array<float,2>{0.551811993f, 0.586169183f},
-std::array<float,2>{0.0898695886f, 0.201913819f},
-std::array<float,2>{0.277502835f, 0.959792078f},
-std::array<float,2>{0.790774345f, 0.384360433f},
-std::array<float,2>{0.989691854f, 0.849969089f},
-std::array<float,2>{0.433181226f, 0.298143476f},
-std::array<float,2>{0.186924338f, 0.715637505f},
-std::array<float,2>{0.664841294f, 0.0864564106f},
-std::array<float,2>{0.722851813f, 0.895497441f},
-std::array<float,2>{0.248568416f, 0.449555993f},
-std::array<float,2>{0.498285502f, 0.516254425f},
-std::array<float,2>{0.91993171f, 0.172352955f},
-std::array<float,2>{0.815734982f, 0.633565664f},
-std::array<float,2>{0.337661594f, 0.0292257629f},
-std::array<float,2>{0.0325293839f, 0.777120471f},
-std::array<float,2>{0.610572696f, 0.329846352f},
-std::array<float,2>{0.648960412f, 0.733665347f},
-std::array<float,2>{0.150412604f, 0.102368534f},
-std::array<float,2>{0.388732791f, 0.828007936f},
-std::array<float,2>{0.957901716f, 0.270415723f},
-std::array<float,2>{0.776277721f, 0.993543625f},
-std::array<float,2>{0.300195605f, 0.435387641f},
-std::array<float,2>{0.110660069f, 0.617367566f},
-std::array<float,2>{0.527226388f, 0.248410329f},
-std::array<float,2>{0.56929785f, 0.796212137f},
-std::array<float,2>{0.0297209658f, 0.359609067f},
-std::array<float,2>{0.348029912f, 0.68104893f},
-std::array<float,2>{0.872069418f, 0.060677398f},
-std::array<float,2>{0.896116853f, 0.539504051f},
-std::array<float,2>{0.458268046f, 0.1369991f},
-std::array<float,2>{0.201344281f, 0.916710854f},
-std::array<float,2>{0.716454089f, 0.490186542f},
-std::array<float,2>{0.658816516f, 0.614108741f},
-std::array<float,2>{0.17897284f, 0.234451294f},
-std::array<float,2>{0.423562557f, 0.985927165f},
-std::array<float,2>{0.998391449f, 0.423711687f},
-std::array<float,2>{0.788143635f, 0.820010245f},
-std::array<float,2>{0.271965176f, 0.279558837f},
-std::array<float,2>{0.0810884908f, 0.719880521f},
-std::array<float,2>{0.560356796f, 0.101441488f},
-std::array<float,2>{0.620055258f, 0.910190403f},
-std::array<float,2>{0.0425549969f, 0.497697443f},
-std::array<float,2>{0.332968652f, 0.531999946f},
-std::array<float,2>{0.823842049f, 0.128876269f},
-std::array<float,2>{0.911886632f, 0.673008144f},
-std::array<float,2>{0.485406905f, 0.0546384379f},
-std::array<float,2>{0.237103492f, 0.781700253f},
-std::array<float,2>{0.733585417f, 0.374491096f},
-std::array<float,2>{0.52255547f, 0.70621407f},
-std::array<float,2>{0.117307931f, 0.0794435069f},
-std::array<float,2>{0.30758056f, 0.854363978f},
-std::array<float,2>{0.773242712f, 0.310756683f},
-std::array<float,2>{0.965987623f, 0.966355443f},
-std::array<float,2>{0.381279707f, 0.378374666f},
-std::array<float,2>{0.141986132f, 0.578613758f},
-std::array<float,2>{0.64220345f, 0.193277344f},
-std::array<float,2>{0.703332841f, 0.768870294f},
-std::array<float,2>{0.19273518f, 0.343529016f},
-std::array<float,2>{0.467321038f, 0.630604267f},
-std::array<float,2>{0.906066477f, 0.0175188053f},
-std::array<float,2>{0.861460209f, 0.530159295f},
-std::array<float,2>{0.353239864f, 0.183703631f},
-std::array<float,2>{0.0220468082f, 0.900783718f},
-std::array<float,2>{0.571041226f, 0.443913728f},
-std::array<float,2>{0.58434087f, 0.560853481f},
-std::array<float,2>{0.00400534319f, 0.141943395f},
-std::array<float,2>{0.369434685f, 0.934517682f},
-std::array<float,2>{0.858110726f, 0.472349793f},
-std::array<float,2>{0.879873097f, 0.799929857f},
-std::array<float,2>{0.439070225f, 0.350973994f},
-std::array<float,2>{0.216431856f, 0.657174051f},
-std::array<float,2>{0.69415921f, 0.0427554809f},
-std::array<float,2>{0.639234126f, 0.972158372f},
-std::array<float,2>{0.125963673f, 0.416114539f},
-std::array<float,2>{0.394794911f, 0.595366597f},
-std::array<float,2>{0.945118904f, 0.223341629f},
-std::array<float,2>{0.75256902f, 0.738193989f},
-std::array<float,2>{0.286728472f, 0.115371816f},
-std::array<float,2>{0.107104264f, 0.835871875f},
-std::array<float,2>{0.501565099f, 0.253825039f},
-std::array<float,2>{0.742803931f, 0.642997086f},
-std::array<float,2>{0.22752203f, 8.35521569e-05f},
-std::array<float,2>{0.477562279f, 0.762137711f},
-std::array<float,2>{0.934719563f, 0.322948456f},
-std::array<float,2>{0.840030253f, 0.882472456f},
-std::array<float,2>{0.319431633f, 0.458941042f},
-std::array<float,2>{0.0491083525f, 0.503713071f},
-std::array<float,2>{0.608886421f, 0.170446917f},
-std::array<float,2>{0.545449078f, 0.863863647f},
-std::array<float,2>{0.0759665743f, 0.289120525f},
-std::array<float,2>{0.261307478f, 0.702784836f},
-std::array<float,2>{0.810035348f, 0.0667877123f},
-std::array<float,2>{0.974693418f, 0.572692156f},
-std::array<float,2>{0.407655895f, 0.212314397f},
-std::array<float,2>{0.170053542f, 0.948917031f},
-std::array<float,2>{0.678935647f, 0.404220968f},
-std::array<float,2>{0.629972577f, 0.536148071f},
-std::array<float,2>{0.136916548f, 0.129768729f},
-std::array<float,2>{0.399475157f, 0.908174992f},
-std::array<float,2>{0.949146569f, 0.49265781f},
-std::array<float,2>{0.75966388f, 0.788275957f},
-std::array<float,2>{0.292210579f, 0.367651016f},
-std::array<float,2>{0.0990274996f, 0.677979827f},
-std::array<float,2>{0.512617588f, 0.0472470187f},
-std::array<float,2>{0.586898506f, 0.988778412f},
-std::array<float,2>{0.0122569101f, 0.426773161f},
-std::array<float,2>{0.364444226f, 0.6107108f},
-std::array<float,2>{0.849245191f, 0.240115881f},
-std::array<float,2>{0.884055734f, 0.72387141f},
-std::array<float,2>{0.452898413f, 0.0947272703f},
-std::array<float,2>{0.205085143f, 0.815211833f},
-std::array<float,2>{0.698806167f, 0.276718408f},
-std::array<float,2>{0.536847711f, 0.628275037f},
-std::array<float,2>{0.0629112497f, 0.0208749026f},
-std::array<float,2>{0.25133121f, 0.770503879f},
-std::array<float,2>{0.801412761f, 0.336740732f},
-std::array<float,2>{0.983147144f, 0.905537307f},
-std::array<float,2>{0.421660364f, 0.439097285f},
-std::array<float,2>{0.161374971f, 0.525763214f},
-std::array<float,2>{0.687236965f, 0.181738302f},
-std::array<float,2>{0.73998481f, 0.855774105f},
-std::array<float,2>{0.223741814f, 0.305062652f},
-std::array<float,2>{0.474603951f, 0.708812535f},
-std::array<float,2>{0.924235523f, 0.0836588517f},
-std::array<float,2>{0.830306292f, 0.584920108f},
-std::array<float,2>{0.322922617f, 0.189380899f},
-std::array<float,2>{0.0584823713f, 0.962149382f},
-std::array<float,2>{0.597730815f, 0.381205648f},
-std::array<float,2>{0.61349076f, 0.597752988f},
-std::array<float,2>{0.0375055932f, 0.22048308f},
-std::array<float,2>{0.341012329f, 0.976202071f},
-std::array<float,2>{0.819126725f, 0.420789659f},
-std::array<float,2>{0.916566432f, 0.830770135f},
-std::array<float,2>{0.49366492f, 0.255932778f},
-std::array<float,2>{0.244062737f, 0.740467846f},
-std::array<float,2>{0.720082045f, 0.112355992f},
-std::array<float,2>{0.670865417f, 0.930832267f},
-std::array<float,2>{0.180117995f, 0.476506054f},
-std::array<float,2>{0.433909237f, 0.556061089f},
-std::array<float,2>{0.984982669f, 0.146829993f},
-std::array<float,2>{0.796708465f, 0.663994908f},
-std::array<float,2>{0.27600354f, 0.044410482f},
-std::array<float,2>{0.0888624564f, 0.803907335f},
-std::array<float,2>{0.547180712f, 0.345434517f},
-std::array<float,2>{0.71479249f, 0.696108878f},
-std::array<float,2>{0.199206099f, 0.0659331232f},
-std::array<float,2>{0.454515755f, 0.863144875f},
-std::array<float,2>{0.890756249f, 0.294983834f},
-std::array<float,2>{0.869102836f, 0.952938318f},
-std::array<float,2>{0.343872339f, 0.398572475f},
-std::array<float,2>{0.024597222f, 0.577623188f},
-std::array<float,2>{0.565912843f, 0.216334701f},
-std::array<float,2>{0.52885294f, 0.758119822f},
-std::array<float,2>{0.113745145f, 0.325878888f},
-std::array<float,2>{0.301036954f, 0.644928873f},
-std::array<float,2>{0.778425157f, 0.00756782899f},
-std::array<float,2>{0.954138935f, 0.50709635f},
-std::array<float,2>{0.386013418f, 0.164375216f},
-std::array<float,2>{0.156173185f, 0.877270699f},
-std::array<float,2>{0.654218137f, 0.454104245f},
-std::array<float,2>{0.73007375f, 0.568612695f},
-std::array<float,2>{0.239659667f, 0.206072167f},
-std::array<float,2>{0.488304466f, 0.940074623f},
-std::array<float,2>{0.906636834f, 0.392077565f},
-std::array<float,2>{0.82662791f, 0.872880816f},
-std::array<float,2>{0.328749985f, 0.284003198f},
-std::array<float,2>{0.0467327684f, 0.690683782f},
-std::array<float,2>{0.624413192f, 0.0724413022f},
-std::array<float,2>{0.555352807f, 0.888152242f},
-std::array<float,2>{0.0843473598f, 0.461549729f},
-std::array<float,2>{0.267074883f, 0.514887571f},
-std::array<float,2>{0.783873558f, 0.162669152f},
-std::array<float,2>{0.996044755f, 0.648698449f},
-std::array<float,2>{0.429002881f, 0.0122193238f},
-std::array<float,2>{0.174793527f, 0.753312945f},
-std::array<float,2>{0.664022923f, 0.315940589f},
-std::array<float,2>{0.577111006f, 0.744641662f},
-std::array<float,2>{0.0168042127f, 0.120279282f},
-std::array<float,2>{0.358425617f, 0.836807847f},
-std::array<float,2>{0.86449945f, 0.258616209f},
-std::array<float,2>{0.898716688f, 0.98389858f},
-std::array<float,2>{0.464096218f, 0.413685888f},
-std::array<float,2>{0.189701438f, 0.609290242f},
-std::array<float,2>{0.710875154f, 0.228542849f},
-std::array<float,2>{0.647459507f, 0.805732787f},
-std::array<float,2>{0.146435261f, 0.353588611f},
-std::array<float,2>{0.376413286f, 0.669710338f},
-std::array<float,2>{0.9627437f, 0.0338481553f},
-std::array<float,2>{0.76810199f, 0.548128307f},
-std::array<float,2>{0.310791284f, 0.150820836f},
-std::array<float,2>{0.12415611f, 0.922447264f},
-std::array<float,2>{0.518824458f, 0.47861591f},
-std::array<float,2>{0.50426203f, 0.519566119f},
-std::array<float,2>{0.104272611f, 0.176892415f},
-std::array<float,2>{0.283102691f, 0.893734276f},
-std::array<float,2>{0.754379451f, 0.447177321f},
-std::array<float,2>{0.940833807f, 0.777857661f},
-std::array<float,2>{0.392858922f, 0.335321397f},
-std::array<float,2>{0.129620567f, 0.637869477f},
-std::array<float,2>{0.63454777f, 0.0271231253f},
-std::array<float,2>{0.689194262f, 0.953410387f},
-std::array<float,2>{0.212246567f, 0.389163405f},
-std::array<float,2>{0.44418183f, 0.589861155f},
-std::array<float,2>{0.878804088f, 0.195989043f},
-std::array<float,2>{0.853173614f, 0.714332402f},
-std::array<float,2>{0.371115029f, 0.0907488987f},
-std::array<float,2>{0.000214097876f, 0.846288443f},
-std::array<float,2>{0.578999162f, 0.303473026f},
-std::array<float,2>{0.672736943f, 0.686752617f},
-std::array<float,2>{0.165438071f, 0.0574363507f},
-std::array<float,2>{0.413735807f, 0.791832507f},
-std::array<float,2>{0.969153762f, 0.36671254f},
-std::array<float,2>{0.807103157f, 0.918700099f},
-std::array<float,2>{0.263484716f, 0.485927999f},
-std::array<float,2>{0.0728962421f, 0.543075383f},
-std::array<float,2>{0.542552173f, 0.135463476f},
-std::array<float,2>{0.601598084f, 0.820999086f},
-std::array<float,2>{0.0538164526f, 0.267840952f},
-std::array<float,2>{0.314736307f, 0.729349315f},
-std::array<float,2>{0.837674737f, 0.108445413f},
-std::array<float,2>{0.93330723f, 0.623721898f},
-std::array<float,2>{0.483857632f, 0.245329604f},
-std::array<float,2>{0.232765868f, 0.996456981f},
-std::array<float,2>{0.748986363f, 0.432840317f},
-std::array<float,2>{0.737035155f, 0.552832305f},
-std::array<float,2>{0.221156672f, 0.153492928f},
-std::array<float,2>{0.468926817f, 0.927391589f},
-std::array<float,2>{0.928950369f, 0.481264949f},
-std::array<float,2>{0.834543288f, 0.809487641f},
-std::array<float,2>{0.324269503f, 0.358452678f},
-std::array<float,2>{0.0597160943f, 0.667128623f},
-std::array<float,2>{0.595650911f, 0.0366181992f},
-std::array<float,2>{0.534122586f, 0.979230821f},
-std::array<float,2>{0.0670605674f, 0.408127487f},
-std::array<float,2>{0.253916115f, 0.603787601f},
-std::array<float,2>{0.797136068f, 0.233317822f},
-std::array<float,2>{0.977899551f, 0.749269903f},
-std::array<float,2>{0.416423589f, 0.124830358f},
-std::array<float,2>{0.158726558f, 0.843161404f},
-std::array<float,2>{0.683445692f, 0.263490617f},
-std::array<float,2>{0.591945589f, 0.656134486f},
-std::array<float,2>{0.0108461827f, 0.00796561688f},
-std::array<float,2>{0.360903054f, 0.75468415f},
-std::array<float,2>{0.844239712f, 0.317892939f},
-std::array<float,2>{0.887839437f, 0.883985102f},
-std::array<float,2>{0.447300136f, 0.465076834f},
-std::array<float,2>{0.207759649f, 0.509598792f},
-std::array<float,2>{0.702263832f, 0.157529712f},
-std::array<float,2>{0.628549814f, 0.869222403f},
-std::array<float,2>{0.132890418f, 0.286488235f},
-std::array<float,2>{0.404606074f, 0.693105221f},
-std::array<float,2>{0.950686753f, 0.0770134702f},
-std::array<float,2>{0.764429986f, 0.563189983f},
-std::array<float,2>{0.293850005f, 0.21087943f},
-std::array<float,2>{0.0950780213f, 0.941894829f},
-std::array<float,2>{0.510847449f, 0.397361964f},
-std::array<float,2>{0.525329649f, 0.619453549f},
-std::array<float,2>{0.111598939f, 0.246432662f},
-std::array<float,2>{0.297616422f, 0.995804965f},
-std::array<float,2>{0.774126768f, 0.437113702f},
-std::array<float,2>{0.959840477f, 0.82563293f},
-std::array<float,2>{0.387988687f, 0.272875339f},
-std::array<float,2>{0.149854571f, 0.730798244f},
-std::array<float,2>{0.650414765f, 0.10380061f},
-std::array<float,2>{0.717873752f, 0.91577965f},
-std::array<float,2>{0.200998351f, 0.490460426f},
-std::array<float,2>{0.459419787f, 0.54243052f},
-std::array<float,2>{0.89777571f, 0.139954343f},
-std::array<float,2>{0.87346828f, 0.68264991f},
-std::array<float,2>{0.350854129f, 0.0588732995f},
-std::array<float,2>{0.0289456137f, 0.794273973f},
-std::array<float,2>{0.567903221f, 0.362258315f},
-std::array<float,2>{0.666724443f, 0.718449235f},
-std::array<float,2>{0.185393363f, 0.0884599462f},
-std::array<float,2>{0.431547433f, 0.848377824f},
-std::array<float,2>{0.992167473f, 0.299980193f},
-std::array<float,2>{0.792213857f, 0.958426535f},
-std::array<float,2>{0.280811191f, 0.385420203f},
-std::array<float,2>{0.0931008309f, 0.588010013f},
-std::array<float,2>{0.55308485f, 0.199932456f},
-std::array<float,2>{0.611578524f, 0.774104774f},
-std::array<float,2>{0.034629073f, 0.331342012f},
-std::array<float,2>{0.339533657f, 0.634825826f},
-std::array<float,2>{0.8137272f, 0.0307752565f},
-std::array<float,2>{0.919399738f, 0.517777443f},
-std::array<float,2>{0.496729851f, 0.175358206f},
-std::array<float,2>{0.247402519f, 0.897972226f},
-std::array<float,2>{0.725339055f, 0.452328742f},
-std::array<float,2>{0.643897474f, 0.580660284f},
-std::array<float,2>{0.14432776f, 0.19451426f},
-std::array<float,2>{0.380045116f, 0.968547344f},
-std::array<float,2>{0.96859622f, 0.376853704f},
-std::array<float,2>{0.770729184f, 0.851983428f},
-std::array<float,2>{0.304707766f, 0.310512245f},
-std::array<float,2>{0.119287618f, 0.70485276f},
-std::array<float,2>{0.520498812f, 0.0804635063f},
-std::array<float,2>{0.573099554f, 0.899177134f},
-std::array<float,2>{0.0195610169f, 0.442780763f},
-std::array<float,2>{0.354661226f, 0.528776526f},
-std::array<float,2>{0.861031592f, 0.186986789f},
-std::array<float,2>{0.902586401f, 0.631375432f},
-std::array<float,2>{0.46654138f, 0.0180433989f},
-std::array<float,2>{0.194166198f, 0.767341733f},
-std::array<float,2>{0.70540154f, 0.340172231f},
-std::array<float,2>{0.561898053f, 0.721202314f},
-std::array<float,2>{0.0800508037f, 0.0990710407f},
-std::array<float,2>{0.269619882f, 0.818115175f},
-std::array<float,2>{0.786142588f, 0.279125243f},
-std::array<float,2>{0.997870207f, 0.987681746f},
-std::array<float,2>{0.424987376f, 0.424696654f},
-std::array<float,2>{0.176030025f, 0.615281641f},
-std::array<float,2>{0.656439602f, 0.236901596f},
-std::array<float,2>{0.73050338f, 0.784438133f},
-std::array<float,2>{0.235022187f, 0.372676909f},
-std::array<float,2>{0.487829953f, 0.674957931f},
-std::array<float,2>{0.9128986f, 0.0523893349f},
-std::array<float,2>{0.821739793f, 0.533961296f},
-std::array<float,2>{0.335466355f, 0.126593888f},
-std::array<float,2>{0.0408793874f, 0.9121328f},
-std::array<float,2>{0.618855417f, 0.49814862f},
-std::array<float,2>{0.607070684f, 0.50090003f},
-std::array<float,2>{0.0475753248f, 0.169616818f},
-std::array<float,2>{0.317238092f, 0.880170286f},
-std::array<float,2>{0.843047082f, 0.459538341f},
-std::array<float,2>{0.936150193f, 0.76531589f},
-std::array<float,2>{0.478761852f, 0.321061969f},
-std::array<float,2>{0.229583785f, 0.641718686f},
-std::array<float,2>{0.744550288f, 0.00268273847f},
-std::array<float,2>{0.677023709f, 0.946250141f},
-std::array<float,2>{0.168362483f, 0.40452382f},
-std::array<float,2>{0.409859508f, 0.571236849f},
-std::array<float,2>{0.972792566f, 0.214053974f},
-std::array<float,2>{0.811281919f, 0.699836373f},
-std::array<float,2>{0.25820744f, 0.0684813932f},
-std::array<float,2>{0.0780936554f, 0.866625607f},
-std::array<float,2>{0.544125497f, 0.292349368f},
-std::array<float,2>{0.691853821f, 0.659404457f},
-std::array<float,2>{0.217152238f, 0.0397564992f},
-std::array<float,2>{0.44016555f, 0.796895206f},
-std::array<float,2>{0.881563008f, 0.347927749f},
-std::array<float,2>{0.857086778f, 0.936971605f},
-std::array<float,2>{0.367607564f, 0.46930483f},
-std::array<float,2>{0.00599623192f, 0.559153855f},
-std::array<float,2>{0.583502471f, 0.142812684f},
-std::array<float,2>{0.502044201f, 0.833109736f},
-std::array<float,2>{0.108057946f, 0.251632631f},
-std::array<float,2>{0.287160039f, 0.735112488f},
-std::array<float,2>{0.75042063f, 0.113782063f},
-std::array<float,2>{0.942120373f, 0.596373558f},
-std::array<float,2>{0.397129118f, 0.224816263f},
-std::array<float,2>{0.12862213f, 0.969913661f},
-std::array<float,2>{0.637219429f, 0.414070219f},
-std::array<float,2>{0.684688389f, 0.525004983f},
-std::array<float,2>{0.163401097f, 0.180693522f},
-std::array<float,2>{0.419243068f, 0.903757989f},
-std::array<float,2>{0.98124212f, 0.439509153f},
-std::array<float,2>{0.804498136f, 0.772568166f},
-std::array<float,2>{0.252777249f, 0.338386029f},
-std::array<float,2>{0.0646561161f, 0.625888765f},
-std::array<float,2>{0.538689435f, 0.0219570231f},
-std::array<float,2>{0.601515949f, 0.964189112f},
-std::array<float,2>{0.0552146174f, 0.380301148f},
-std::array<float,2>{0.32173875f, 0.582517684f},
-std::array<float,2>{0.829315484f, 0.191180527f},
-std::array<float,2>{0.923502505f, 0.709084213f},
-std::array<float,2>{0.476351917f, 0.0844971538f},
-std::array<float,2>{0.225130141f, 0.858862281f},
-std::array<float,2>{0.740795493f, 0.307530612f},
-std::array<float,2>{0.515327632f, 0.6761567f},
-std::array<float,2>{0.101060681f, 0.0496553928f},
-std::array<float,2>{0.290238023f, 0.787100077f},
-std::array<float,2>{0.761275887f, 0.36986655f},
-std::array<float,2>{0.946335971f, 0.909313619f},
-std::array<float,2>{0.401660621f, 0.495864153f},
-std::array<float,2>{0.139204785f, 0.53773123f},
-std::array<float,2>{0.632798016f, 0.131649271f},
-std::array<float,2>{0.696380079f, 0.812727392f},
-std::array<float,2>{0.204587877f, 0.274935991f},
-std::array<float,2>{0.45017311f, 0.724707723f},
-std::array<float,2>{0.8862499f, 0.0962175578f},
-std::array<float,2>{0.851064384f, 0.611862004f},
-std::array<float,2>{0.366566896f, 0.240653351f},
-std::array<float,2>{0.0144202719f, 0.990397573f},
-std::array<float,2>{0.58983928f, 0.429482847f},
-std::array<float,2>{0.562894404f, 0.575758517f},
-std::array<float,2>{0.0272208937f, 0.217152804f},
-std::array<float,2>{0.346089572f, 0.950356126f},
-std::array<float,2>{0.87071538f, 0.401127279f},
-std::array<float,2>{0.892853737f, 0.859612405f},
-std::array<float,2>{0.456652135f, 0.293166697f},
-std::array<float,2>{0.195731491f, 0.699122667f},
-std::array<float,2>{0.712383986f, 0.0644177124f},
-std::array<float,2>{0.655210257f, 0.875298858f},
-std::array<float,2>{0.153161675f, 0.456741929f},
-std::array<float,2>{0.383060545f, 0.504030526f},
-std::array<float,2>{0.956588864f, 0.166263402f},
-std::array<float,2>{0.780727923f, 0.646871865f},
-std::array<float,2>{0.303251445f, 0.0042497376f},
-std::array<float,2>{0.11536897f, 0.760888696f},
-std::array<float,2>{0.530337274f, 0.327735215f},
-std::array<float,2>{0.721087694f, 0.739259303f},
-std::array<float,2>{0.244701326f, 0.111234032f},
-std::array<float,2>{0.494434744f, 0.828374386f},
-std::array<float,2>{0.915631354f, 0.255054504f},
-std::array<float,2>{0.818010271f, 0.972680688f},
-std::array<float,2>{0.343162894f, 0.419525087f},
-std::array<float,2>{0.0366178937f, 0.60072583f},
-std::array<float,2>{0.615543485f, 0.222004339f},
-std::array<float,2>{0.549323857f, 0.802423537f},
-std::array<float,2>{0.0869145989f, 0.346231729f},
-std::array<float,2>{0.27410695f, 0.661083579f},
-std::array<float,2>{0.794679523f, 0.0466819368f},
-std::array<float,2>{0.98723644f, 0.557670057f},
-std::array<float,2>{0.437265456f, 0.145440921f},
-std::array<float,2>{0.182901278f, 0.933369637f},
-std::array<float,2>{0.66965127f, 0.473396868f},
-std::array<float,2>{0.708116055f, 0.606620193f},
-std::array<float,2>{0.188355982f, 0.228159189f},
-std::array<float,2>{0.462652862f, 0.981451988f},
-std::array<float,2>{0.902279973f, 0.41119504f},
-std::array<float,2>{0.866880119f, 0.83807373f},
-std::array<float,2>{0.356787413f, 0.260546058f},
-std::array<float,2>{0.0177021567f, 0.743391216f},
-std::array<float,2>{0.574222386f, 0.118834831f},
-std::array<float,2>{0.517320454f, 0.924719155f},
-std::array<float,2>{0.122803919f, 0.477631867f},
-std::array<float,2>{0.309350222f, 0.549040198f},
-std::array<float,2>{0.765976548f, 0.149664149f},
-std::array<float,2>{0.962896943f, 0.670486629f},
-std::array<float,2>{0.377149612f, 0.0319534726f},
-std::array<float,2>{0.146951586f, 0.806724191f},
-std::array<float,2>{0.64579457f, 0.352388293f},
-std::array<float,2>{0.621763706f, 0.687918365f},
-std::array<float,2>{0.0434718132f, 0.0720945522f},
-std::array<float,2>{0.33145076f, 0.873332143f},
-std::array<float,2>{0.825338006f, 0.282225966f},
-std::array<float,2>{0.909770131f, 0.937871277f},
-std::array<float,2>{0.49025929f, 0.393879354f},
-std::array<float,2>{0.24079667f, 0.566805243f},
-std::array<float,2>{0.726974726f, 0.203619987f},
-std::array<float,2>{0.660997689f, 0.750912309f},
-std::array<float,2>{0.173226923f, 0.313324958f},
-std::array<float,2>{0.427658409f, 0.651793599f},
-std::array<float,2>{0.992500782f, 0.0146112582f},
-std::array<float,2>{0.782612264f, 0.511988938f},
-std::array<float,2>{0.268618613f, 0.160920352f},
-std::array<float,2>{0.0827094316f, 0.889410615f},
-std::array<float,2>{0.55671978f, 0.463571787f},
-std::array<float,2>{0.540828943f, 0.545421362f},
-std::array<float,2>{0.071721822f, 0.134347141f},
-std::array<float,2>{0.264192075f, 0.920315862f},
-std::array<float,2>{0.805948317f, 0.487766355f},
-std::array<float,2>{0.970728099f, 0.790134072f},
-std::array<float,2>{0.412090808f, 0.364514917f},
-std::array<float,2>{0.167306706f, 0.684651494f},
-std::array<float,2>{0.674314678f, 0.0559945777f},
-std::array<float,2>{0.746734262f, 0.998090684f},
-std::array<float,2>{0.231411159f, 0.431334108f},
-std::array<float,2>{0.481482834f, 0.621940374f},
-std::array<float,2>{0.930584073f, 0.243756577f},
-std::array<float,2>{0.838867724f, 0.727072179f},
-std::array<float,2>{0.313700944f, 0.106606513f},
-std::array<float,2>{0.0515266098f, 0.823476553f},
-std::array<float,2>{0.6036309f, 0.265980661f},
-std::array<float,2>{0.636678696f, 0.639849186f},
-std::array<float,2>{0.131101966f, 0.0241361372f},
-std::array<float,2>{0.39204222f, 0.779753387f},
-std::array<float,2>{0.938034117f, 0.332867861f},
-std::array<float,2>{0.756715834f, 0.890948713f},
-std::array<float,2>{0.285040796f, 0.44911316f},
-std::array<float,2>{0.101888232f, 0.521548629f},
-std::array<float,2>{0.505986154f, 0.17866993f},
-std::array<float,2>{0.580212891f, 0.84397459f},
-std::array<float,2>{0.00326803979f, 0.300803989f},
-std::array<float,2>{0.37408036f, 0.711330414f},
-std::array<float,2>{0.854552567f, 0.0927412659f},
-std::array<float,2>{0.87557596f, 0.592555344f},
-std::array<float,2>{0.441807002f, 0.197784394f},
-std::array<float,2>{0.214781299f, 0.95684278f},
-std::array<float,2>{0.691175818f, 0.388168335f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.887109876f, 0.849468827f},
-std::array<float,2>{0.0437511541f, 0.284296691f},
-std::array<float,2>{0.309689671f, 0.643604517f},
-std::array<float,2>{0.653551698f, 0.184041873f},
-std::array<float,2>{0.501641989f, 0.614514828f},
-std::array<float,2>{0.45225358f, 0.00444601942f},
-std::array<float,2>{0.178666443f, 0.904210448f},
-std::array<float,2>{0.81150043f, 0.438858449f},
-std::array<float,2>{0.695538521f, 0.945351303f},
-std::array<float,2>{0.369098604f, 0.395755887f},
-std::array<float,2>{0.0954086706f, 0.521511674f},
-std::array<float,2>{0.946779013f, 0.0757692754f},
-std::array<float,2>{0.834429204f, 0.734699726f},
-std::array<float,2>{0.241224736f, 0.203802556f},
-std::array<float,2>{0.431112111f, 0.800617933f},
-std::array<float,2>{0.599155724f, 0.337790191f},
-std::array<float,2>{0.763798296f, 0.911011994f},
-std::array<float,2>{0.156098962f, 0.494909048f},
-std::array<float,2>{0.487403005f, 0.582729697f},
-std::array<float,2>{0.559736669f, 0.0431081913f},
-std::array<float,2>{0.685104012f, 0.682003677f},
-std::array<float,2>{0.25417766f, 0.128609568f},
-std::array<float,2>{0.0255574528f, 0.841348946f},
-std::array<float,2>{0.906994641f, 0.278111428f},
-std::array<float,2>{0.577418327f, 0.75482595f},
-std::array<float,2>{0.396297067f, 0.359802872f},
-std::array<float,2>{0.218311846f, 0.702732921f},
-std::array<float,2>{0.855426252f, 0.229584783f},
-std::array<float,2>{0.969451368f, 0.550510049f},
-std::array<float,2>{0.08767616f, 0.121855378f},
-std::array<float,2>{0.325145543f, 0.990003109f},
-std::array<float,2>{0.741594911f, 0.408750683f},
-std::array<float,2>{0.955910385f, 0.980592489f},
-std::array<float,2>{0.119414531f, 0.435649425f},
-std::array<float,2>{0.351345807f, 0.539046943f},
-std::array<float,2>{0.708721399f, 0.103957608f},
-std::array<float,2>{0.613317609f, 0.704959869f},
-std::array<float,2>{0.418804407f, 0.237329394f},
-std::array<float,2>{0.2291774f, 0.778466642f},
-std::array<float,2>{0.818005323f, 0.35429427f},
-std::array<float,2>{0.631653905f, 0.825970232f},
-std::array<float,2>{0.28630802f, 0.260270834f},
-std::array<float,2>{0.0575603396f, 0.664217055f},
-std::array<float,2>{0.895200253f, 0.155266985f},
-std::array<float,2>{0.782462656f, 0.577943921f},
-std::array<float,2>{0.161221787f, 0.0501072295f},
-std::array<float,2>{0.464613974f, 0.924989939f},
-std::array<float,2>{0.526029646f, 0.476456374f},
-std::array<float,2>{0.867769837f, 0.793630421f},
-std::array<float,2>{0.188014582f, 0.314387858f},
-std::array<float,2>{0.376157641f, 0.731981277f},
-std::array<float,2>{0.583421886f, 0.1987679f},
-std::array<float,2>{0.720681906f, 0.502669871f},
-std::array<float,2>{0.335994661f, 0.0857413933f},
-std::array<float,2>{0.0743334219f, 0.963849962f},
-std::array<float,2>{0.999620795f, 0.37965548f},
-std::array<float,2>{0.534552872f, 0.876538217f},
-std::array<float,2>{0.48059088f, 0.466592282f},
-std::array<float,2>{0.127939761f, 0.597324431f},
-std::array<float,2>{0.770299315f, 0.0212715305f},
-std::array<float,2>{0.927455246f, 0.625987351f},
-std::array<float,2>{0.00181376061f, 0.165440351f},
-std::array<float,2>{0.273959398f, 0.86247009f},
-std::array<float,2>{0.658061683f, 0.307746619f},
-std::array<float,2>{0.986879289f, 0.771931469f},
-std::array<float,2>{0.0692886561f, 0.349788189f},
-std::array<float,2>{0.330477893f, 0.712186933f},
-std::array<float,2>{0.734062612f, 0.249217346f},
-std::array<float,2>{0.590885103f, 0.541838825f},
-std::array<float,2>{0.385377049f, 0.0959672183f},
-std::array<float,2>{0.20116584f, 0.970334828f},
-std::array<float,2>{0.866234243f, 0.428503245f},
-std::array<float,2>{0.666772246f, 0.932357192f},
-std::array<float,2>{0.27115643f, 0.482931316f},
-std::array<float,2>{0.0119068576f, 0.563460171f},
-std::array<float,2>{0.9304052f, 0.0606380776f},
-std::array<float,2>{0.781165957f, 0.658962786f},
-std::array<float,2>{0.140571773f, 0.146996796f},
-std::array<float,2>{0.472806752f, 0.815495312f},
-std::array<float,2>{0.545402706f, 0.253981113f},
-std::array<float,2>{0.827084005f, 0.960463464f},
-std::array<float,2>{0.21946016f, 0.387826979f},
-std::array<float,2>{0.412144303f, 0.511358738f},
-std::array<float,2>{0.620201468f, 0.086845167f},
-std::array<float,2>{0.715330839f, 0.722878814f},
-std::array<float,2>{0.357432395f, 0.194539174f},
-std::array<float,2>{0.115213715f, 0.787638545f},
-std::array<float,2>{0.964783192f, 0.326127946f},
-std::array<float,2>{0.518278897f, 0.872261107f},
-std::array<float,2>{0.460098088f, 0.297796488f},
-std::array<float,2>{0.167749152f, 0.63749826f},
-std::array<float,2>{0.793337047f, 0.163020343f},
-std::array<float,2>{0.904084802f, 0.607678831f},
-std::array<float,2>{0.0480687208f, 0.0275763478f},
-std::array<float,2>{0.28921327f, 0.885621667f},
-std::array<float,2>{0.640583992f, 0.455414385f},
-std::array<float,2>{0.921479285f, 0.895911098f},
-std::array<float,2>{0.0216182657f, 0.446917087f},
-std::array<float,2>{0.26467666f, 0.619080126f},
-std::array<float,2>{0.675490737f, 0.009301126f},
-std::array<float,2>{0.550824225f, 0.65204531f},
-std::array<float,2>{0.492314279f, 0.178509533f},
-std::array<float,2>{0.141792819f, 0.854825974f},
-std::array<float,2>{0.752343476f, 0.295040727f},
-std::array<float,2>{0.743809998f, 0.807368815f},
-std::array<float,2>{0.315680027f, 0.335416615f},
-std::array<float,2>{0.0793647617f, 0.747796535f},
-std::array<float,2>{0.976653039f, 0.218537331f},
-std::array<float,2>{0.84684062f, 0.530486405f},
-std::array<float,2>{0.20548889f, 0.0676557869f},
-std::array<float,2>{0.398650527f, 0.942908287f},
-std::array<float,2>{0.562604308f, 0.40147683f},
-std::array<float,2>{0.797612846f, 0.82987386f},
-std::array<float,2>{0.182930216f, 0.268692136f},
-std::array<float,2>{0.444010168f, 0.675331116f},
-std::array<float,2>{0.513335526f, 0.136900172f},
-std::array<float,2>{0.641802132f, 0.587284327f},
-std::array<float,2>{0.298948944f, 0.0384870991f},
-std::array<float,2>{0.0371005721f, 0.914599717f},
-std::array<float,2>{0.877098858f, 0.487274468f},
-std::array<float,2>{0.605008125f, 0.993155241f},
-std::array<float,2>{0.424109399f, 0.414898187f},
-std::array<float,2>{0.248036534f, 0.558518589f},
-std::array<float,2>{0.840805471f, 0.115565702f},
-std::array<float,2>{0.938191473f, 0.691849887f},
-std::array<float,2>{0.108787432f, 0.225105748f},
-std::array<float,2>{0.364241302f, 0.761964738f},
-std::array<float,2>{0.693864346f, 0.368240714f},
-std::array<float,2>{0.934837699f, 0.803465247f},
-std::array<float,2>{0.00969320629f, 0.340362966f},
-std::array<float,2>{0.26587221f, 0.740022838f},
-std::array<float,2>{0.670187354f, 0.209117755f},
-std::array<float,2>{0.541033506f, 0.517484069f},
-std::array<float,2>{0.471202314f, 0.0739890635f},
-std::array<float,2>{0.136601567f, 0.95243305f},
-std::array<float,2>{0.77674973f, 0.392662823f},
-std::array<float,2>{0.729943991f, 0.901950836f},
-std::array<float,2>{0.335239887f, 0.443540096f},
-std::array<float,2>{0.0651183501f, 0.611895263f},
-std::array<float,2>{0.989906192f, 0.00240567885f},
-std::array<float,2>{0.861964703f, 0.648112833f},
-std::array<float,2>{0.196418554f, 0.181302145f},
-std::array<float,2>{0.387440681f, 0.845097899f},
-std::array<float,2>{0.586355448f, 0.287024617f},
-std::array<float,2>{0.789630651f, 0.984789312f},
-std::array<float,2>{0.17097117f, 0.410904318f},
-std::array<float,2>{0.455739915f, 0.552541494f},
-std::array<float,2>{0.521025717f, 0.120330654f},
-std::array<float,2>{0.633664489f, 0.69540292f},
-std::array<float,2>{0.294177681f, 0.23075597f},
-std::array<float,2>{0.0532795936f, 0.752315164f},
-std::array<float,2>{0.900073707f, 0.364011705f},
-std::array<float,2>{0.622251809f, 0.836457372f},
-std::array<float,2>{0.408227891f, 0.27499181f},
-std::array<float,2>{0.225385413f, 0.687252939f},
-std::array<float,2>{0.82216996f, 0.131484017f},
-std::array<float,2>{0.966393948f, 0.580431521f},
-std::array<float,2>{0.112901233f, 0.0424589105f},
-std::array<float,2>{0.352055341f, 0.907885075f},
-std::array<float,2>{0.714629889f, 0.497259378f},
-std::array<float,2>{0.981922984f, 0.926179409f},
-std::array<float,2>{0.0831148177f, 0.471642971f},
-std::array<float,2>{0.31931138f, 0.570438385f},
-std::array<float,2>{0.746130884f, 0.0522103868f},
-std::array<float,2>{0.568807244f, 0.670266926f},
-std::array<float,2>{0.402409643f, 0.15104124f},
-std::array<float,2>{0.207257375f, 0.823311627f},
-std::array<float,2>{0.848983288f, 0.264597386f},
-std::array<float,2>{0.679550886f, 0.773595452f},
-std::array<float,2>{0.26007852f, 0.355933785f},
-std::array<float,2>{0.0162898526f, 0.708867967f},
-std::array<float,2>{0.917710662f, 0.241261557f},
-std::array<float,2>{0.756780267f, 0.534642339f},
-std::array<float,2>{0.146455154f, 0.105763726f},
-std::array<float,2>{0.496195257f, 0.97702986f},
-std::array<float,2>{0.547182202f, 0.432952672f},
-std::array<float,2>{0.836929083f, 0.865340114f},
-std::array<float,2>{0.245161176f, 0.311692238f},
-std::array<float,2>{0.426697493f, 0.629545152f},
-std::array<float,2>{0.607505381f, 0.171220317f},
-std::array<float,2>{0.688368261f, 0.598962486f},
-std::array<float,2>{0.362642348f, 0.01586104f},
-std::array<float,2>{0.103492551f, 0.879121363f},
-std::array<float,2>{0.942066669f, 0.463679224f},
-std::array<float,2>{0.510369837f, 0.9650774f},
-std::array<float,2>{0.438108563f, 0.377437353f},
-std::array<float,2>{0.184377536f, 0.504877806f},
-std::array<float,2>{0.801452219f, 0.0795975104f},
-std::array<float,2>{0.880290985f, 0.729134381f},
-std::array<float,2>{0.0322330892f, 0.201193988f},
-std::array<float,2>{0.302951068f, 0.789962769f},
-std::array<float,2>{0.647553861f, 0.317105293f},
-std::array<float,2>{0.952706695f, 0.819450021f},
-std::array<float,2>{0.0998317078f, 0.252929211f},
-std::array<float,2>{0.37119934f, 0.662618101f},
-std::array<float,2>{0.699419498f, 0.144405976f},
-std::array<float,2>{0.596204102f, 0.567270696f},
-std::array<float,2>{0.437494099f, 0.0572977997f},
-std::array<float,2>{0.236499175f, 0.934127092f},
-std::array<float,2>{0.830048978f, 0.477959096f},
-std::array<float,2>{0.650165856f, 0.974520981f},
-std::array<float,2>{0.306494802f, 0.424727052f},
-std::array<float,2>{0.0407609344f, 0.544611752f},
-std::array<float,2>{0.8844558f, 0.101212107f},
-std::array<float,2>{0.806470811f, 0.717855155f},
-std::array<float,2>{0.174010426f, 0.244418502f},
-std::array<float,2>{0.447636962f, 0.765841246f},
-std::array<float,2>{0.505338907f, 0.346058905f},
-std::array<float,2>{0.858147681f, 0.886798739f},
-std::array<float,2>{0.211621806f, 0.457726508f},
-std::array<float,2>{0.391029269f, 0.602056265f},
-std::array<float,2>{0.572567642f, 0.0253356267f},
-std::array<float,2>{0.73619324f, 0.63569504f},
-std::array<float,2>{0.321835577f, 0.159923315f},
-std::array<float,2>{0.0899621844f, 0.86785233f},
-std::array<float,2>{0.975522161f, 0.303966522f},
-std::array<float,2>{0.556888998f, 0.783008158f},
-std::array<float,2>{0.492072016f, 0.323939264f},
-std::array<float,2>{0.151244849f, 0.720500112f},
-std::array<float,2>{0.758968353f, 0.19094032f},
-std::array<float,2>{0.91302985f, 0.512556791f},
-std::array<float,2>{0.027547678f, 0.0916053578f},
-std::array<float,2>{0.250219524f, 0.955530107f},
-std::array<float,2>{0.683182657f, 0.385679185f},
-std::array<float,2>{0.892258823f, 0.940881193f},
-std::array<float,2>{0.06069199f, 0.403988808f},
-std::array<float,2>{0.285004109f, 0.526120067f},
-std::array<float,2>{0.627291501f, 0.0643150434f},
-std::array<float,2>{0.530702889f, 0.743133903f},
-std::array<float,2>{0.467853874f, 0.214422941f},
-std::array<float,2>{0.15657106f, 0.811417162f},
-std::array<float,2>{0.78811419f, 0.330771595f},
-std::array<float,2>{0.70334816f, 0.858701408f},
-std::array<float,2>{0.344706178f, 0.292533368f},
-std::array<float,2>{0.122548297f, 0.65619874f},
-std::array<float,2>{0.960834742f, 0.175408959f},
-std::array<float,2>{0.8157866f, 0.624258399f},
-std::array<float,2>{0.232250467f, 0.012103647f},
-std::array<float,2>{0.416040242f, 0.892742991f},
-std::array<float,2>{0.612014472f, 0.451154172f},
-std::array<float,2>{0.766479552f, 0.759065866f},
-std::array<float,2>{0.129848152f, 0.372777045f},
-std::array<float,2>{0.479798257f, 0.68779242f},
-std::array<float,2>{0.538428307f, 0.220617861f},
-std::array<float,2>{0.662526548f, 0.562087834f},
-std::array<float,2>{0.278515309f, 0.111290269f},
-std::array<float,2>{0.0058121956f, 0.9975757f},
-std::array<float,2>{0.923536241f, 0.419679403f},
-std::array<float,2>{0.580502868f, 0.918532014f},
-std::array<float,2>{0.38269785f, 0.488424957f},
-std::array<float,2>{0.194230676f, 0.592537045f},
-std::array<float,2>{0.873819172f, 0.0341888666f},
-std::array<float,2>{0.994751453f, 0.67789048f},
-std::array<float,2>{0.0713020116f, 0.135896042f},
-std::array<float,2>{0.340993226f, 0.834709466f},
-std::array<float,2>{0.723549604f, 0.270208776f},
-std::array<float,2>{0.908666074f, 0.842838407f},
-std::array<float,2>{0.025387967f, 0.281184316f},
-std::array<float,2>{0.257801414f, 0.680758357f},
-std::array<float,2>{0.686195493f, 0.126519397f},
-std::array<float,2>{0.560767889f, 0.585517764f},
-std::array<float,2>{0.485828906f, 0.0456321798f},
-std::array<float,2>{0.15283601f, 0.912914753f},
-std::array<float,2>{0.763223529f, 0.49363175f},
-std::array<float,2>{0.739024401f, 0.991280019f},
-std::array<float,2>{0.327160776f, 0.407991707f},
-std::array<float,2>{0.0892506987f, 0.548212469f},
-std::array<float,2>{0.970919192f, 0.123953655f},
-std::array<float,2>{0.852161944f, 0.700460672f},
-std::array<float,2>{0.215984419f, 0.227798074f},
-std::array<float,2>{0.397400767f, 0.756836593f},
-std::array<float,2>{0.574978709f, 0.361793369f},
-std::array<float,2>{0.809235454f, 0.905705154f},
-std::array<float,2>{0.1770235f, 0.440009117f},
-std::array<float,2>{0.449342102f, 0.616981387f},
-std::array<float,2>{0.503836393f, 0.00711396988f},
-std::array<float,2>{0.655532181f, 0.641472459f},
-std::array<float,2>{0.31118384f, 0.185608014f},
-std::array<float,2>{0.0453026406f, 0.851134241f},
-std::array<float,2>{0.88959837f, 0.282648563f},
-std::array<float,2>{0.599916756f, 0.798485637f},
-std::array<float,2>{0.432626039f, 0.339350939f},
-std::array<float,2>{0.239540234f, 0.73648876f},
-std::array<float,2>{0.83345598f, 0.206666738f},
-std::array<float,2>{0.94883424f, 0.521377742f},
-std::array<float,2>{0.0959619954f, 0.0776890591f},
-std::array<float,2>{0.369365543f, 0.947470844f},
-std::array<float,2>{0.697840989f, 0.396821856f},
-std::array<float,2>{0.996682823f, 0.96137023f},
-std::array<float,2>{0.0776889995f, 0.381620377f},
-std::array<float,2>{0.338803291f, 0.501357734f},
-std::array<float,2>{0.721008062f, 0.0826602206f},
-std::array<float,2>{0.585730195f, 0.733696103f},
-std::array<float,2>{0.377022088f, 0.196442127f},
-std::array<float,2>{0.190929592f, 0.796685755f},
-std::array<float,2>{0.870254815f, 0.316280663f},
-std::array<float,2>{0.659813404f, 0.860599101f},
-std::array<float,2>{0.276871353f, 0.306103945f},
-std::array<float,2>{0.0020247628f, 0.627159894f},
-std::array<float,2>{0.928210914f, 0.167702809f},
-std::array<float,2>{0.77249974f, 0.594388843f},
-std::array<float,2>{0.125225946f, 0.0218543299f},
-std::array<float,2>{0.483876556f, 0.877574444f},
-std::array<float,2>{0.532815218f, 0.467029005f},
-std::array<float,2>{0.82009536f, 0.779428422f},
-std::array<float,2>{0.226577476f, 0.352602184f},
-std::array<float,2>{0.420102537f, 0.706619143f},
-std::array<float,2>{0.616993129f, 0.235447064f},
-std::array<float,2>{0.709832132f, 0.536398709f},
-std::array<float,2>{0.348298609f, 0.102623545f},
-std::array<float,2>{0.119108103f, 0.982648015f},
-std::array<float,2>{0.953443885f, 0.434817731f},
-std::array<float,2>{0.524969578f, 0.923437834f},
-std::array<float,2>{0.462468743f, 0.473777443f},
-std::array<float,2>{0.1639027f, 0.57540077f},
-std::array<float,2>{0.783249855f, 0.048182372f},
-std::array<float,2>{0.897546411f, 0.667212307f},
-std::array<float,2>{0.0558693819f, 0.152394295f},
-std::array<float,2>{0.288484752f, 0.827278554f},
-std::array<float,2>{0.630565703f, 0.25865972f},
-std::array<float,2>{0.961694121f, 0.787088275f},
-std::array<float,2>{0.115540378f, 0.327140272f},
-std::array<float,2>{0.357317626f, 0.7250669f},
-std::array<float,2>{0.717499554f, 0.192768425f},
-std::array<float,2>{0.617483795f, 0.509051859f},
-std::array<float,2>{0.410673112f, 0.0880485699f},
-std::array<float,2>{0.222286597f, 0.957739711f},
-std::array<float,2>{0.825923085f, 0.390272468f},
-std::array<float,2>{0.637278378f, 0.882831156f},
-std::array<float,2>{0.29276368f, 0.454404324f},
-std::array<float,2>{0.0501193292f, 0.606386364f},
-std::array<float,2>{0.905023873f, 0.0302935373f},
-std::array<float,2>{0.796714187f, 0.640077829f},
-std::array<float,2>{0.165267706f, 0.161655039f},
-std::array<float,2>{0.458112627f, 0.874851823f},
-std::array<float,2>{0.517561972f, 0.298985422f},
-std::array<float,2>{0.864286244f, 0.97196734f},
-std::array<float,2>{0.202593327f, 0.42586574f},
-std::array<float,2>{0.383675694f, 0.540505409f},
-std::array<float,2>{0.592871308f, 0.0953649059f},
-std::array<float,2>{0.73213917f, 0.713868082f},
-std::array<float,2>{0.329776764f, 0.247407973f},
-std::array<float,2>{0.0670278221f, 0.769960344f},
-std::array<float,2>{0.985580027f, 0.349146128f},
-std::array<float,2>{0.543174267f, 0.813138604f},
-std::array<float,2>{0.476460069f, 0.256722391f},
-std::array<float,2>{0.137092412f, 0.658113778f},
-std::array<float,2>{0.777441263f, 0.146144137f},
-std::array<float,2>{0.932856977f, 0.564733028f},
-std::array<float,2>{0.0138164591f, 0.0595349409f},
-std::array<float,2>{0.272918761f, 0.931423247f},
-std::array<float,2>{0.665029705f, 0.481130242f},
-std::array<float,2>{0.87546277f, 0.91620928f},
-std::array<float,2>{0.0385808572f, 0.485842317f},
-std::array<float,2>{0.298080057f, 0.588802576f},
-std::array<float,2>{0.643137932f, 0.0367906988f},
-std::array<float,2>{0.513987839f, 0.673825741f},
-std::array<float,2>{0.441437513f, 0.139616385f},
-std::array<float,2>{0.179717481f, 0.831613243f},
-std::array<float,2>{0.799645722f, 0.266412556f},
-std::array<float,2>{0.69211036f, 0.764535725f},
-std::array<float,2>{0.365756899f, 0.371088117f},
-std::array<float,2>{0.10592299f, 0.693700254f},
-std::array<float,2>{0.941355348f, 0.223417863f},
-std::array<float,2>{0.8426072f, 0.556293428f},
-std::array<float,2>{0.249973834f, 0.114301756f},
-std::array<float,2>{0.42251116f, 0.994562805f},
-std::array<float,2>{0.603115797f, 0.417098463f},
-std::array<float,2>{0.751887023f, 0.852690995f},
-std::array<float,2>{0.143722147f, 0.294406295f},
-std::array<float,2>{0.494523525f, 0.64912492f},
-std::array<float,2>{0.55460602f, 0.176006258f},
-std::array<float,2>{0.672566354f, 0.619207442f},
-std::array<float,2>{0.261846483f, 0.010742343f},
-std::array<float,2>{0.0198928379f, 0.897865891f},
-std::array<float,2>{0.918788135f, 0.447469831f},
-std::array<float,2>{0.565288246f, 0.944778562f},
-std::array<float,2>{0.401776493f, 0.398450077f},
-std::array<float,2>{0.203343153f, 0.528281987f},
-std::array<float,2>{0.844575226f, 0.0693495721f},
-std::array<float,2>{0.978593767f, 0.748376429f},
-std::array<float,2>{0.0811928362f, 0.215690553f},
-std::array<float,2>{0.313820243f, 0.80541575f},
-std::array<float,2>{0.744162798f, 0.332652271f},
-std::array<float,2>{0.900774539f, 0.751061618f},
-std::array<float,2>{0.0522820242f, 0.365944713f},
-std::array<float,2>{0.295672566f, 0.698861659f},
-std::array<float,2>{0.636086643f, 0.232523993f},
-std::array<float,2>{0.522980571f, 0.553295672f},
-std::array<float,2>{0.454969615f, 0.118341766f},
-std::array<float,2>{0.169047222f, 0.987885892f},
-std::array<float,2>{0.792241096f, 0.413813114f},
-std::array<float,2>{0.711502254f, 0.909855604f},
-std::array<float,2>{0.35431245f, 0.498289496f},
-std::array<float,2>{0.110966973f, 0.579529107f},
-std::array<float,2>{0.967332184f, 0.0406619646f},
-std::array<float,2>{0.823065281f, 0.68458885f},
-std::array<float,2>{0.223588824f, 0.128927693f},
-std::array<float,2>{0.406913221f, 0.837901473f},
-std::array<float,2>{0.624202371f, 0.276194215f},
-std::array<float,2>{0.774247468f, 0.950006723f},
-std::array<float,2>{0.133662134f, 0.392443836f},
-std::array<float,2>{0.469204873f, 0.518989384f},
-std::array<float,2>{0.540995657f, 0.0719264001f},
-std::array<float,2>{0.668250918f, 0.740806103f},
-std::array<float,2>{0.268083572f, 0.208787873f},
-std::array<float,2>{0.0102123804f, 0.802699029f},
-std::array<float,2>{0.936718941f, 0.343066901f},
-std::array<float,2>{0.588666201f, 0.847539306f},
-std::array<float,2>{0.39016673f, 0.287213773f},
-std::array<float,2>{0.197923064f, 0.645125389f},
-std::array<float,2>{0.861241817f, 0.182098761f},
-std::array<float,2>{0.990558803f, 0.610621452f},
-std::array<float,2>{0.0641906187f, 0.00179543381f},
-std::array<float,2>{0.332785815f, 0.899778247f},
-std::array<float,2>{0.727612555f, 0.442642391f},
-std::array<float,2>{0.943723857f, 0.88161391f},
-std::array<float,2>{0.10534896f, 0.461428821f},
-std::array<float,2>{0.359755337f, 0.600693464f},
-std::array<float,2>{0.691262722f, 0.0178871639f},
-std::array<float,2>{0.606700897f, 0.631337523f},
-std::array<float,2>{0.429162234f, 0.169505984f},
-std::array<float,2>{0.243468091f, 0.863489866f},
-std::array<float,2>{0.839014769f, 0.309591115f},
-std::array<float,2>{0.646353424f, 0.791968048f},
-std::array<float,2>{0.302717656f, 0.319251448f},
-std::array<float,2>{0.0336738825f, 0.727890909f},
-std::array<float,2>{0.882056236f, 0.199616268f},
-std::array<float,2>{0.803890169f, 0.50730443f},
-std::array<float,2>{0.187004447f, 0.0801839978f},
-std::array<float,2>{0.440977514f, 0.968177438f},
-std::array<float,2>{0.509519815f, 0.375671208f},
-std::array<float,2>{0.850584805f, 0.821421087f},
-std::array<float,2>{0.210936174f, 0.262253195f},
-std::array<float,2>{0.405912548f, 0.669310212f},
-std::array<float,2>{0.566978514f, 0.150327459f},
-std::array<float,2>{0.748930991f, 0.572414339f},
-std::array<float,2>{0.318345308f, 0.0533751138f},
-std::array<float,2>{0.0854231566f, 0.928454816f},
-std::array<float,2>{0.983917832f, 0.470448375f},
-std::array<float,2>{0.550311327f, 0.979087412f},
-std::array<float,2>{0.498422533f, 0.430869371f},
-std::array<float,2>{0.146650285f, 0.532125235f},
-std::array<float,2>{0.754689753f, 0.107877843f},
-std::array<float,2>{0.914349437f, 0.710277379f},
-std::array<float,2>{0.0177847017f, 0.239170596f},
-std::array<float,2>{0.257868975f, 0.775594831f},
-std::array<float,2>{0.677243531f, 0.358851194f},
-std::array<float,2>{0.97273612f, 0.869666278f},
-std::array<float,2>{0.0936176628f, 0.302189022f},
-std::array<float,2>{0.32383275f, 0.634210885f},
-std::array<float,2>{0.737436473f, 0.157868862f},
-std::array<float,2>{0.571791589f, 0.604384124f},
-std::array<float,2>{0.393925369f, 0.0272728689f},
-std::array<float,2>{0.21384196f, 0.890291989f},
-std::array<float,2>{0.857270062f, 0.459229469f},
-std::array<float,2>{0.681180298f, 0.95370245f},
-std::array<float,2>{0.252983928f, 0.384495169f},
-std::array<float,2>{0.0311272554f, 0.515302837f},
-std::array<float,2>{0.911443889f, 0.0930184647f},
-std::array<float,2>{0.759818912f, 0.722104967f},
-std::array<float,2>{0.149231106f, 0.18818526f},
-std::array<float,2>{0.488320202f, 0.783853054f},
-std::array<float,2>{0.556208134f, 0.321701914f},
-std::array<float,2>{0.83093971f, 0.937491357f},
-std::array<float,2>{0.235233665f, 0.479788184f},
-std::array<float,2>{0.43501541f, 0.568502367f},
-std::array<float,2>{0.594337821f, 0.0563366674f},
-std::array<float,2>{0.703019619f, 0.661451399f},
-std::array<float,2>{0.374114811f, 0.141320631f},
-std::array<float,2>{0.0982643068f, 0.817828178f},
-std::array<float,2>{0.95036459f, 0.250467926f},
-std::array<float,2>{0.507081926f, 0.768293023f},
-std::array<float,2>{0.445624709f, 0.345360488f},
-std::array<float,2>{0.172424361f, 0.715260088f},
-std::array<float,2>{0.806717217f, 0.243571922f},
-std::array<float,2>{0.885834634f, 0.54612726f},
-std::array<float,2>{0.0417300873f, 0.0980245695f},
-std::array<float,2>{0.306801945f, 0.97643882f},
-std::array<float,2>{0.650557518f, 0.422571868f},
-std::array<float,2>{0.924690902f, 0.999313176f},
-std::array<float,2>{0.0059268903f, 0.420887649f},
-std::array<float,2>{0.280358255f, 0.558611155f},
-std::array<float,2>{0.661167681f, 0.112451084f},
-std::array<float,2>{0.536326945f, 0.690367818f},
-std::array<float,2>{0.478212327f, 0.222529247f},
-std::array<float,2>{0.132407665f, 0.760211468f},
-std::array<float,2>{0.768689036f, 0.374777019f},
-std::array<float,2>{0.726054907f, 0.833867311f},
-std::array<float,2>{0.342304498f, 0.272262722f},
-std::array<float,2>{0.072488308f, 0.676240742f},
-std::array<float,2>{0.992546499f, 0.132943034f},
-std::array<float,2>{0.871548355f, 0.591006279f},
-std::array<float,2>{0.192736417f, 0.0324232616f},
-std::array<float,2>{0.380505979f, 0.921124697f},
-std::array<float,2>{0.578635752f, 0.490381628f},
-std::array<float,2>{0.786528111f, 0.808810174f},
-std::array<float,2>{0.158725262f, 0.328960061f},
-std::array<float,2>{0.465985596f, 0.745251656f},
-std::array<float,2>{0.528181016f, 0.212229803f},
-std::array<float,2>{0.625911653f, 0.523512125f},
-std::array<float,2>{0.281359762f, 0.0652313083f},
-std::array<float,2>{0.0605404526f, 0.937561572f},
-std::array<float,2>{0.892598927f, 0.405518532f},
-std::array<float,2>{0.611302197f, 0.892135799f},
-std::array<float,2>{0.415778339f, 0.451218933f},
-std::array<float,2>{0.234116927f, 0.622257471f},
-std::array<float,2>{0.813752413f, 0.0137364753f},
-std::array<float,2>{0.957604706f, 0.654036105f},
-std::array<float,2>{0.123334266f, 0.17315875f},
-std::array<float,2>{0.34660098f, 0.855806231f},
-std::array<float,2>{0.706576347f, 0.290235281f},
-std::array<float,2>{0.929168403f, 0.861576498f},
-std::array<float,2>{0.00360653689f, 0.30696249f},
-std::array<float,2>{0.275406688f, 0.625225127f},
-std::array<float,2>{0.659149408f, 0.164271906f},
-std::array<float,2>{0.53179872f, 0.595729768f},
-std::array<float,2>{0.483228981f, 0.0196943376f},
-std::array<float,2>{0.126287758f, 0.875157714f},
-std::array<float,2>{0.771758318f, 0.465016037f},
-std::array<float,2>{0.722004175f, 0.964821577f},
-std::array<float,2>{0.3392874f, 0.380023658f},
-std::array<float,2>{0.0770901516f, 0.50333339f},
-std::array<float,2>{0.997241557f, 0.0846159309f},
-std::array<float,2>{0.86979419f, 0.73142159f},
-std::array<float,2>{0.190113053f, 0.197484002f},
-std::array<float,2>{0.378449529f, 0.794706225f},
-std::array<float,2>{0.584184885f, 0.312820226f},
-std::array<float,2>{0.7849437f, 0.924494505f},
-std::array<float,2>{0.162653178f, 0.474634886f},
-std::array<float,2>{0.461297512f, 0.576840639f},
-std::array<float,2>{0.524062097f, 0.0492087342f},
-std::array<float,2>{0.629231453f, 0.665490389f},
-std::array<float,2>{0.287871152f, 0.155867293f},
-std::array<float,2>{0.0553624965f, 0.824813664f},
-std::array<float,2>{0.897111773f, 0.261374593f},
-std::array<float,2>{0.615667641f, 0.777362108f},
-std::array<float,2>{0.420919955f, 0.354822427f},
-std::array<float,2>{0.227899432f, 0.703525245f},
-std::array<float,2>{0.818879902f, 0.236690834f},
-std::array<float,2>{0.954151988f, 0.537607372f},
-std::array<float,2>{0.117734686f, 0.104641177f},
-std::array<float,2>{0.348733604f, 0.981766343f},
-std::array<float,2>{0.710026681f, 0.437455535f},
-std::array<float,2>{0.972144485f, 0.988498151f},
-std::array<float,2>{0.0882222131f, 0.409654289f},
-std::array<float,2>{0.327060521f, 0.549731374f},
-std::array<float,2>{0.739682496f, 0.122679658f},
-std::array<float,2>{0.576168001f, 0.702020168f},
-std::array<float,2>{0.398433954f, 0.228666574f},
-std::array<float,2>{0.2152289f, 0.755784631f},
-std::array<float,2>{0.852601528f, 0.360993445f},
-std::array<float,2>{0.687307239f, 0.840296924f},
-std::array<float,2>{0.256003052f, 0.27839601f},
-std::array<float,2>{0.0243739877f, 0.683436513f},
-std::array<float,2>{0.909223378f, 0.126953706f},
-std::array<float,2>{0.762653947f, 0.583596051f},
-std::array<float,2>{0.153855413f, 0.0443862155f},
-std::array<float,2>{0.485020399f, 0.911311328f},
-std::array<float,2>{0.56215167f, 0.49553448f},
-std::array<float,2>{0.832090676f, 0.799732268f},
-std::array<float,2>{0.239149466f, 0.336906135f},
-std::array<float,2>{0.432046831f, 0.735897005f},
-std::array<float,2>{0.600805402f, 0.204835877f},
-std::array<float,2>{0.699163258f, 0.523337901f},
-std::array<float,2>{0.370750934f, 0.0751469806f},
-std::array<float,2>{0.097244218f, 0.94692117f},
-std::array<float,2>{0.947604179f, 0.395125479f},
-std::array<float,2>{0.502416193f, 0.902414858f},
-std::array<float,2>{0.451092303f, 0.438298166f},
-std::array<float,2>{0.176549658f, 0.614005268f},
-std::array<float,2>{0.809921324f, 0.00542340847f},
-std::array<float,2>{0.890356123f, 0.643060505f},
-std::array<float,2>{0.0464576781f, 0.185245827f},
-std::array<float,2>{0.312005669f, 0.848224103f},
-std::array<float,2>{0.654882312f, 0.283643216f},
-std::array<float,2>{0.940360248f, 0.763063729f},
-std::array<float,2>{0.107140735f, 0.367424875f},
-std::array<float,2>{0.366244406f, 0.692528188f},
-std::array<float,2>{0.692491114f, 0.225715235f},
-std::array<float,2>{0.601562798f, 0.557216227f},
-std::array<float,2>{0.422952324f, 0.116958149f},
-std::array<float,2>{0.248891249f, 0.99396193f},
-std::array<float,2>{0.843437254f, 0.415551633f},
-std::array<float,2>{0.643871784f, 0.915366054f},
-std::array<float,2>{0.297428071f, 0.487394273f},
-std::array<float,2>{0.0374994278f, 0.586331725f},
-std::array<float,2>{0.876051784f, 0.0374335162f},
-std::array<float,2>{0.800052524f, 0.67405647f},
-std::array<float,2>{0.181564853f, 0.13802956f},
-std::array<float,2>{0.442569256f, 0.828317225f},
-std::array<float,2>{0.514679193f, 0.267964065f},
-std::array<float,2>{0.845433414f, 0.941806972f},
-std::array<float,2>{0.204384431f, 0.400987417f},
-std::array<float,2>{0.401109576f, 0.530142426f},
-std::array<float,2>{0.565776527f, 0.067301482f},
-std::array<float,2>{0.745405972f, 0.746532202f},
-std::array<float,2>{0.31308791f, 0.216973752f},
-std::array<float,2>{0.0806020126f, 0.808340847f},
-std::array<float,2>{0.980213106f, 0.334837973f},
-std::array<float,2>{0.552734613f, 0.853933215f},
-std::array<float,2>{0.495623559f, 0.295982689f},
-std::array<float,2>{0.142766505f, 0.650451481f},
-std::array<float,2>{0.750202298f, 0.179533452f},
-std::array<float,2>{0.919059157f, 0.617682397f},
-std::array<float,2>{0.0206580441f, 0.00878592115f},
-std::array<float,2>{0.263555735f, 0.895201027f},
-std::array<float,2>{0.672892809f, 0.445542723f},
-std::array<float,2>{0.90561682f, 0.886469603f},
-std::array<float,2>{0.0494340509f, 0.45641011f},
-std::array<float,2>{0.291127324f, 0.608930647f},
-std::array<float,2>{0.637695491f, 0.0284065157f},
-std::array<float,2>{0.516303241f, 0.637735963f},
-std::array<float,2>{0.457203239f, 0.163987145f},
-std::array<float,2>{0.164552525f, 0.8720209f},
-std::array<float,2>{0.795731187f, 0.29801929f},
-std::array<float,2>{0.718540668f, 0.788285851f},
-std::array<float,2>{0.356072724f, 0.325021535f},
-std::array<float,2>{0.116303258f, 0.724256337f},
-std::array<float,2>{0.962867737f, 0.193609804f},
-std::array<float,2>{0.82471174f, 0.510568678f},
-std::array<float,2>{0.221627295f, 0.086991407f},
-std::array<float,2>{0.411158323f, 0.959558964f},
-std::array<float,2>{0.618991256f, 0.387569785f},
-std::array<float,2>{0.778719246f, 0.814551771f},
-std::array<float,2>{0.138114676f, 0.25521946f},
-std::array<float,2>{0.474798918f, 0.659391403f},
-std::array<float,2>{0.544199824f, 0.148386642f},
-std::array<float,2>{0.665103257f, 0.563937843f},
-std::array<float,2>{0.272360414f, 0.0619658343f},
-std::array<float,2>{0.0149962939f, 0.933368087f},
-std::array<float,2>{0.932102203f, 0.483950108f},
-std::array<float,2>{0.592256546f, 0.96940434f},
-std::array<float,2>{0.384598494f, 0.429005504f},
-std::array<float,2>{0.20194985f, 0.542490184f},
-std::array<float,2>{0.863516688f, 0.0970253423f},
-std::array<float,2>{0.985236764f, 0.711910486f},
-std::array<float,2>{0.0679617375f, 0.248702615f},
-std::array<float,2>{0.328700155f, 0.77331537f},
-std::array<float,2>{0.73107177f, 0.351509959f},
-std::array<float,2>{0.881816208f, 0.790333569f},
-std::array<float,2>{0.0346778892f, 0.317945361f},
-std::array<float,2>{0.30099234f, 0.729886472f},
-std::array<float,2>{0.645430326f, 0.202453077f},
-std::array<float,2>{0.508399189f, 0.505475163f},
-std::array<float,2>{0.43990609f, 0.0782372802f},
-std::array<float,2>{0.185559094f, 0.966763675f},
-std::array<float,2>{0.803595543f, 0.378757149f},
-std::array<float,2>{0.689985096f, 0.880353868f},
-std::array<float,2>{0.360916793f, 0.46448344f},
-std::array<float,2>{0.104085229f, 0.598379612f},
-std::array<float,2>{0.944434583f, 0.0167460833f},
-std::array<float,2>{0.8382532f, 0.630110979f},
-std::array<float,2>{0.242648497f, 0.170731425f},
-std::array<float,2>{0.427954257f, 0.866946518f},
-std::array<float,2>{0.606146514f, 0.310604572f},
-std::array<float,2>{0.754885435f, 0.977654934f},
-std::array<float,2>{0.148274228f, 0.432400048f},
-std::array<float,2>{0.499288142f, 0.533618867f},
-std::array<float,2>{0.548877299f, 0.107152261f},
-std::array<float,2>{0.676748335f, 0.707140088f},
-std::array<float,2>{0.259125173f, 0.240852654f},
-std::array<float,2>{0.0193219557f, 0.774529219f},
-std::array<float,2>{0.915843904f, 0.357033402f},
-std::array<float,2>{0.567730784f, 0.822646916f},
-std::array<float,2>{0.404348075f, 0.265399039f},
-std::array<float,2>{0.209398612f, 0.671805441f},
-std::array<float,2>{0.851461768f, 0.151392132f},
-std::array<float,2>{0.983175516f, 0.571397841f},
-std::array<float,2>{0.0846875086f, 0.0508350469f},
-std::array<float,2>{0.316643089f, 0.927485108f},
-std::array<float,2>{0.74946475f, 0.472278059f},
-std::array<float,2>{0.968317568f, 0.90684396f},
-std::array<float,2>{0.109757446f, 0.497030824f},
-std::array<float,2>{0.355339617f, 0.581121027f},
-std::array<float,2>{0.712810576f, 0.0411481075f},
-std::array<float,2>{0.623102307f, 0.685858965f},
-std::array<float,2>{0.40776673f, 0.132285118f},
-std::array<float,2>{0.224150106f, 0.837539494f},
-std::array<float,2>{0.823609173f, 0.273719609f},
-std::array<float,2>{0.635035455f, 0.753095806f},
-std::array<float,2>{0.29614839f, 0.365000993f},
-std::array<float,2>{0.0513600782f, 0.6971668f},
-std::array<float,2>{0.902206719f, 0.231601179f},
-std::array<float,2>{0.791700304f, 0.551367462f},
-std::array<float,2>{0.168178454f, 0.119161487f},
-std::array<float,2>{0.454084903f, 0.985467494f},
-std::array<float,2>{0.522105277f, 0.411970079f},
-std::array<float,2>{0.859975994f, 0.844582021f},
-std::array<float,2>{0.198933691f, 0.285665303f},
-std::array<float,2>{0.389633417f, 0.647398353f},
-std::array<float,2>{0.589680552f, 0.18049413f},
-std::array<float,2>{0.727399468f, 0.612868428f},
-std::array<float,2>{0.333668709f, 0.00345737976f},
-std::array<float,2>{0.0629157647f, 0.900743604f},
-std::array<float,2>{0.991894186f, 0.444993615f},
-std::array<float,2>{0.539931595f, 0.951351941f},
-std::array<float,2>{0.469772458f, 0.393817127f},
-std::array<float,2>{0.134395078f, 0.516596079f},
-std::array<float,2>{0.774964869f, 0.0725671053f},
-std::array<float,2>{0.93563813f, 0.738412678f},
-std::array<float,2>{0.0115895215f, 0.210697249f},
-std::array<float,2>{0.269047499f, 0.804296315f},
-std::array<float,2>{0.669327855f, 0.341189206f},
-std::array<float,2>{0.993375063f, 0.83567363f},
-std::array<float,2>{0.0732711256f, 0.270647556f},
-std::array<float,2>{0.343219578f, 0.67961055f},
-std::array<float,2>{0.725143135f, 0.135317028f},
-std::array<float,2>{0.579337895f, 0.592821896f},
-std::array<float,2>{0.379102439f, 0.0340307206f},
-std::array<float,2>{0.191904962f, 0.91919142f},
-std::array<float,2>{0.872233272f, 0.49015066f},
-std::array<float,2>{0.660640121f, 0.996783912f},
-std::array<float,2>{0.279768676f, 0.418748349f},
-std::array<float,2>{0.00702114683f, 0.561082184f},
-std::array<float,2>{0.925249636f, 0.109584719f},
-std::array<float,2>{0.767835617f, 0.689066708f},
-std::array<float,2>{0.131439626f, 0.219587997f},
-std::array<float,2>{0.477350742f, 0.757947147f},
-std::array<float,2>{0.535883427f, 0.371759504f},
-std::array<float,2>{0.8132177f, 0.89361757f},
-std::array<float,2>{0.232803494f, 0.449694663f},
-std::array<float,2>{0.414624333f, 0.623749495f},
-std::array<float,2>{0.610072434f, 0.0128126377f},
-std::array<float,2>{0.705136716f, 0.654375851f},
-std::array<float,2>{0.346756756f, 0.174371347f},
-std::array<float,2>{0.124921031f, 0.85805124f},
-std::array<float,2>{0.958904505f, 0.29113996f},
-std::array<float,2>{0.528611064f, 0.811883926f},
-std::array<float,2>{0.465409756f, 0.331332743f},
-std::array<float,2>{0.159698904f, 0.74408716f},
-std::array<float,2>{0.785516202f, 0.213089317f},
-std::array<float,2>{0.894379437f, 0.527067184f},
-std::array<float,2>{0.0589243956f, 0.0634550974f},
-std::array<float,2>{0.282864213f, 0.940126657f},
-std::array<float,2>{0.626300752f, 0.402372688f},
-std::array<float,2>{0.910957098f, 0.956763983f},
-std::array<float,2>{0.0295685306f, 0.386138082f},
-std::array<float,2>{0.252722919f, 0.513144612f},
-std::array<float,2>{0.680336893f, 0.0902833715f},
-std::array<float,2>{0.554904103f, 0.718973577f},
-std::array<float,2>{0.489663184f, 0.190236181f},
-std::array<float,2>{0.150251716f, 0.781505167f},
-std::array<float,2>{0.761464357f, 0.322898656f},
-std::array<float,2>{0.737268209f, 0.869021952f},
-std::array<float,2>{0.323004127f, 0.303101093f},
-std::array<float,2>{0.0918251872f, 0.636445343f},
-std::array<float,2>{0.973781407f, 0.158311114f},
-std::array<float,2>{0.856010318f, 0.603363395f},
-std::array<float,2>{0.214798123f, 0.0234887954f},
-std::array<float,2>{0.392945081f, 0.887915611f},
-std::array<float,2>{0.57080406f, 0.45829016f},
-std::array<float,2>{0.80771625f, 0.766836584f},
-std::array<float,2>{0.173526049f, 0.346870989f},
-std::array<float,2>{0.446471304f, 0.717640638f},
-std::array<float,2>{0.50648272f, 0.24590157f},
-std::array<float,2>{0.652249694f, 0.543414831f},
-std::array<float,2>{0.308322966f, 0.1000866f},
-std::array<float,2>{0.0427195057f, 0.973241687f},
-std::array<float,2>{0.884947717f, 0.425054133f},
-std::array<float,2>{0.595352113f, 0.934610963f},
-std::array<float,2>{0.433958083f, 0.476967216f},
-std::array<float,2>{0.235514894f, 0.568142891f},
-std::array<float,2>{0.83187741f, 0.0576360486f},
-std::array<float,2>{0.949492514f, 0.663571239f},
-std::array<float,2>{0.0992748216f, 0.142853513f},
-std::array<float,2>{0.373935282f, 0.819192111f},
-std::array<float,2>{0.701867402f, 0.253817201f},
-std::array<float,2>{0.89597106f, 0.826957822f},
-std::array<float,2>{0.058040455f, 0.259310454f},
-std::array<float,2>{0.285962671f, 0.666347086f},
-std::array<float,2>{0.632044137f, 0.154083043f},
-std::array<float,2>{0.527023852f, 0.574352801f},
-std::array<float,2>{0.463818848f, 0.0471879989f},
-std::array<float,2>{0.160164848f, 0.922250509f},
-std::array<float,2>{0.782214642f, 0.472867131f},
-std::array<float,2>{0.70788306f, 0.983957648f},
-std::array<float,2>{0.349704593f, 0.433644623f},
-std::array<float,2>{0.120373346f, 0.535158873f},
-std::array<float,2>{0.956264913f, 0.102067418f},
-std::array<float,2>{0.816833079f, 0.70533669f},
-std::array<float,2>{0.230154812f, 0.235126629f},
-std::array<float,2>{0.419613987f, 0.780566871f},
-std::array<float,2>{0.614620864f, 0.352304667f},
-std::array<float,2>{0.771395206f, 0.878648341f},
-std::array<float,2>{0.127361149f, 0.468000025f},
-std::array<float,2>{0.481742859f, 0.595273912f},
-std::array<float,2>{0.533611476f, 0.0228316709f},
-std::array<float,2>{0.656506836f, 0.628586888f},
-std::array<float,2>{0.274624258f, 0.166302562f},
-std::array<float,2>{0.000121968253f, 0.859822214f},
-std::array<float,2>{0.926681995f, 0.30550012f},
-std::array<float,2>{0.582496524f, 0.794983089f},
-std::array<float,2>{0.375374556f, 0.315205842f},
-std::array<float,2>{0.18869786f, 0.732842445f},
-std::array<float,2>{0.868409753f, 0.195730701f},
-std::array<float,2>{0.998942852f, 0.500714958f},
-std::array<float,2>{0.0756341144f, 0.0836692825f},
-std::array<float,2>{0.33714959f, 0.962583721f},
-std::array<float,2>{0.719060242f, 0.382057905f},
-std::array<float,2>{0.945437253f, 0.948942542f},
-std::array<float,2>{0.0937787592f, 0.397826254f},
-std::array<float,2>{0.367900431f, 0.519650042f},
-std::array<float,2>{0.696686864f, 0.0770154521f},
-std::array<float,2>{0.597896039f, 0.738160849f},
-std::array<float,2>{0.430328429f, 0.205149546f},
-std::array<float,2>{0.241195604f, 0.797646284f},
-std::array<float,2>{0.835106313f, 0.338421941f},
-std::array<float,2>{0.652548611f, 0.850270331f},
-std::array<float,2>{0.308905959f, 0.281440258f},
-std::array<float,2>{0.0440173671f, 0.642058969f},
-std::array<float,2>{0.888406634f, 0.187400892f},
-std::array<float,2>{0.812417328f, 0.615866899f},
-std::array<float,2>{0.179149255f, 0.00679449737f},
-std::array<float,2>{0.451902032f, 0.904539287f},
-std::array<float,2>{0.500047028f, 0.441388875f},
-std::array<float,2>{0.854424357f, 0.756785095f},
-std::array<float,2>{0.217126787f, 0.363072783f},
-std::array<float,2>{0.394558012f, 0.699409306f},
-std::array<float,2>{0.576404572f, 0.227471426f},
-std::array<float,2>{0.740763307f, 0.547063529f},
-std::array<float,2>{0.326055467f, 0.124858685f},
-std::array<float,2>{0.0867738351f, 0.990298629f},
-std::array<float,2>{0.970453084f, 0.40639168f},
-std::array<float,2>{0.559092402f, 0.913309693f},
-std::array<float,2>{0.486517698f, 0.492634207f},
-std::array<float,2>{0.154567435f, 0.584886849f},
-std::array<float,2>{0.764665306f, 0.0461145304f},
-std::array<float,2>{0.90797466f, 0.679698467f},
-std::array<float,2>{0.0271365326f, 0.12517193f},
-std::array<float,2>{0.255462855f, 0.841917276f},
-std::array<float,2>{0.684100807f, 0.279587716f},
-std::array<float,2>{0.977999747f, 0.805944741f},
-std::array<float,2>{0.0786437839f, 0.333944172f},
-std::array<float,2>{0.315165818f, 0.749998629f},
-std::array<float,2>{0.742802918f, 0.216276854f},
-std::array<float,2>{0.563727558f, 0.528624237f},
-std::array<float,2>{0.400140673f, 0.0685757995f},
-std::array<float,2>{0.206831574f, 0.943605065f},
-std::array<float,2>{0.846445203f, 0.400295705f},
-std::array<float,2>{0.674742579f, 0.897375524f},
-std::array<float,2>{0.264476568f, 0.448975861f},
-std::array<float,2>{0.022669103f, 0.620880604f},
-std::array<float,2>{0.920424044f, 0.00986673776f},
-std::array<float,2>{0.753718317f, 0.649985909f},
-std::array<float,2>{0.140849248f, 0.177184641f},
-std::array<float,2>{0.493309468f, 0.851568997f},
-std::array<float,2>{0.551856518f, 0.293088853f},
-std::array<float,2>{0.841169596f, 0.995741129f},
-std::array<float,2>{0.24641481f, 0.416617423f},
-std::array<float,2>{0.425382018f, 0.555000961f},
-std::array<float,2>{0.604332924f, 0.113616735f},
-std::array<float,2>{0.694650531f, 0.695090353f},
-std::array<float,2>{0.364603668f, 0.22415942f},
-std::array<float,2>{0.108309321f, 0.76479125f},
-std::array<float,2>{0.939171672f, 0.369539976f},
-std::array<float,2>{0.511826217f, 0.830278814f},
-std::array<float,2>{0.444528013f, 0.266859263f},
-std::array<float,2>{0.182369128f, 0.672507882f},
-std::array<float,2>{0.797993541f, 0.14051418f},
-std::array<float,2>{0.878300667f, 0.58964622f},
-std::array<float,2>{0.035986118f, 0.0356731601f},
-std::array<float,2>{0.300698519f, 0.91703099f},
-std::array<float,2>{0.64085114f, 0.484576404f},
-std::array<float,2>{0.931308329f, 0.930596411f},
-std::array<float,2>{0.0133698508f, 0.481966674f},
-std::array<float,2>{0.269910485f, 0.566340029f},
-std::array<float,2>{0.667339265f, 0.0605007336f},
-std::array<float,2>{0.546084225f, 0.656284273f},
-std::array<float,2>{0.474110693f, 0.144988835f},
-std::array<float,2>{0.139609814f, 0.814371645f},
-std::array<float,2>{0.779338896f, 0.257746845f},
-std::array<float,2>{0.733210266f, 0.771411896f},
-std::array<float,2>{0.331541359f, 0.348150343f},
-std::array<float,2>{0.0696804672f, 0.713817477f},
-std::array<float,2>{0.987860382f, 0.24673751f},
-std::array<float,2>{0.866209865f, 0.539506495f},
-std::array<float,2>{0.19963792f, 0.0940178111f},
-std::array<float,2>{0.386190981f, 0.970730543f},
-std::array<float,2>{0.590670526f, 0.42727077f},
-std::array<float,2>{0.794316888f, 0.873880863f},
-std::array<float,2>{0.166112497f, 0.300177634f},
-std::array<float,2>{0.459078491f, 0.639568329f},
-std::array<float,2>{0.519418538f, 0.160787836f},
-std::array<float,2>{0.638964593f, 0.606593311f},
-std::array<float,2>{0.290597349f, 0.030148685f},
-std::array<float,2>{0.0476809554f, 0.883799851f},
-std::array<float,2>{0.902485549f, 0.453502834f},
-std::array<float,2>{0.619242489f, 0.958666623f},
-std::array<float,2>{0.413739562f, 0.38901636f},
-std::array<float,2>{0.220374644f, 0.507992208f},
-std::array<float,2>{0.827878594f, 0.0891102701f},
-std::array<float,2>{0.963454366f, 0.726460695f},
-std::array<float,2>{0.113759957f, 0.191810742f},
-std::array<float,2>{0.359037369f, 0.785792708f},
-std::array<float,2>{0.716193736f, 0.327973634f},
-std::array<float,2>{0.916140616f, 0.776785195f},
-std::array<float,2>{0.017376449f, 0.358115554f},
-std::array<float,2>{0.260854334f, 0.709715009f},
-std::array<float,2>{0.678271294f, 0.239325702f},
-std::array<float,2>{0.548208654f, 0.532349646f},
-std::array<float,2>{0.497338533f, 0.109199077f},
-std::array<float,2>{0.144834206f, 0.979731798f},
-std::array<float,2>{0.756904483f, 0.429908603f},
-std::array<float,2>{0.747954249f, 0.929485619f},
-std::array<float,2>{0.320309907f, 0.468973309f},
-std::array<float,2>{0.0825745389f, 0.573609173f},
-std::array<float,2>{0.980722964f, 0.0544959791f},
-std::array<float,2>{0.848421931f, 0.668253362f},
-std::array<float,2>{0.208299622f, 0.148636535f},
-std::array<float,2>{0.403663993f, 0.820656717f},
-std::array<float,2>{0.569552183f, 0.262929857f},
-std::array<float,2>{0.802634776f, 0.966874659f},
-std::array<float,2>{0.185102776f, 0.376706004f},
-std::array<float,2>{0.439007044f, 0.506530762f},
-std::array<float,2>{0.510782659f, 0.0812589601f},
-std::array<float,2>{0.646514535f, 0.726965666f},
-std::array<float,2>{0.303861052f, 0.200732291f},
-std::array<float,2>{0.0318789259f, 0.792032063f},
-std::array<float,2>{0.879867494f, 0.319685698f},
-std::array<float,2>{0.608977377f, 0.864723861f},
-std::array<float,2>{0.427586585f, 0.308856517f},
-std::array<float,2>{0.244197547f, 0.632066607f},
-std::array<float,2>{0.836417735f, 0.168845117f},
-std::array<float,2>{0.943179071f, 0.600421429f},
-std::array<float,2>{0.101988167f, 0.0194149017f},
-std::array<float,2>{0.361754149f, 0.881985903f},
-std::array<float,2>{0.689019561f, 0.462237328f},
-std::array<float,2>{0.988546014f, 0.898739994f},
-std::array<float,2>{0.0655558631f, 0.441781282f},
-std::array<float,2>{0.334145814f, 0.609758914f},
-std::array<float,2>{0.729404569f, 0.00030516251f},
-std::array<float,2>{0.587421f, 0.646324217f},
-std::array<float,2>{0.387754679f, 0.183441818f},
-std::array<float,2>{0.19553338f, 0.846248686f},
-std::array<float,2>{0.862803698f, 0.288895875f},
-std::array<float,2>{0.671153665f, 0.801216841f},
-std::array<float,2>{0.266775757f, 0.342078716f},
-std::array<float,2>{0.00805550534f, 0.741961837f},
-std::array<float,2>{0.933787286f, 0.207817033f},
-std::array<float,2>{0.775981605f, 0.517974436f},
-std::array<float,2>{0.135310128f, 0.0712600797f},
-std::array<float,2>{0.471790969f, 0.950755417f},
-std::array<float,2>{0.542390168f, 0.390887111f},
-std::array<float,2>{0.820370913f, 0.83912468f},
-std::array<float,2>{0.22582683f, 0.276988924f},
-std::array<float,2>{0.409519523f, 0.684226871f},
-std::array<float,2>{0.621334374f, 0.130236074f},
-std::array<float,2>{0.713641226f, 0.578264892f},
-std::array<float,2>{0.353046656f, 0.0390970856f},
-std::array<float,2>{0.111590922f, 0.909174144f},
-std::array<float,2>{0.965098381f, 0.49984026f},
-std::array<float,2>{0.520432949f, 0.986649394f},
-std::array<float,2>{0.456874937f, 0.412364125f},
-std::array<float,2>{0.170072973f, 0.55387944f},
-std::array<float,2>{0.790888667f, 0.118091591f},
-std::array<float,2>{0.899006009f, 0.698102415f},
-std::array<float,2>{0.0538464189f, 0.233634621f},
-std::array<float,2>{0.293073028f, 0.750850558f},
-std::array<float,2>{0.63466531f, 0.367039382f},
-std::array<float,2>{0.959484279f, 0.856569111f},
-std::array<float,2>{0.121656843f, 0.289969057f},
-std::array<float,2>{0.344787955f, 0.653308511f},
-std::array<float,2>{0.704936743f, 0.172139049f},
-std::array<float,2>{0.613100648f, 0.621285319f},
-std::array<float,2>{0.417267203f, 0.0155769093f},
-std::array<float,2>{0.230506584f, 0.89132452f},
-std::array<float,2>{0.815077901f, 0.452409714f},
-std::array<float,2>{0.628805339f, 0.93884939f},
-std::array<float,2>{0.283843577f, 0.404340386f},
-std::array<float,2>{0.0618093349f, 0.525006175f},
-std::array<float,2>{0.891334891f, 0.065894343f},
-std::array<float,2>{0.788013756f, 0.745052338f},
-std::array<float,2>{0.157875821f, 0.211144522f},
-std::array<float,2>{0.467364669f, 0.810021996f},
-std::array<float,2>{0.529774547f, 0.329945594f},
-std::array<float,2>{0.874613643f, 0.920752704f},
-std::array<float,2>{0.194424331f, 0.492152661f},
-std::array<float,2>{0.38148433f, 0.590688467f},
-std::array<float,2>{0.581636369f, 0.0319665298f},
-std::array<float,2>{0.724357665f, 0.676974416f},
-std::array<float,2>{0.339954078f, 0.134422764f},
-std::array<float,2>{0.0712435469f, 0.832425833f},
-std::array<float,2>{0.995579064f, 0.272980213f},
-std::array<float,2>{0.537954926f, 0.760843456f},
-std::array<float,2>{0.47911036f, 0.373667985f},
-std::array<float,2>{0.129902735f, 0.691262186f},
-std::array<float,2>{0.767521083f, 0.220704034f},
-std::array<float,2>{0.921876848f, 0.559983552f},
-std::array<float,2>{0.00406915322f, 0.111978851f},
-std::array<float,2>{0.278219342f, 0.998957515f},
-std::array<float,2>{0.66388917f, 0.421344608f},
-std::array<float,2>{0.883522332f, 0.975578427f},
-std::array<float,2>{0.0397913828f, 0.423541278f},
-std::array<float,2>{0.304734021f, 0.545083284f},
-std::array<float,2>{0.648541391f, 0.0990808979f},
-std::array<float,2>{0.504110456f, 0.715821207f},
-std::array<float,2>{0.44833985f, 0.242227539f},
-std::array<float,2>{0.174989939f, 0.769263983f},
-std::array<float,2>{0.805624723f, 0.344205081f},
-std::array<float,2>{0.700199604f, 0.81642127f},
-std::array<float,2>{0.372319579f, 0.25193876f},
-std::array<float,2>{0.101089992f, 0.660206497f},
-std::array<float,2>{0.951777399f, 0.142023429f},
-std::array<float,2>{0.828843355f, 0.569344819f},
-std::array<float,2>{0.238065839f, 0.0555522405f},
-std::array<float,2>{0.436129063f, 0.936397195f},
-std::array<float,2>{0.59745574f, 0.478622019f},
-std::array<float,2>{0.758029699f, 0.784999073f},
-std::array<float,2>{0.151445508f, 0.320904881f},
-std::array<float,2>{0.490972757f, 0.721616745f},
-std::array<float,2>{0.558128834f, 0.189025506f},
-std::array<float,2>{0.681981504f, 0.514462113f},
-std::array<float,2>{0.251402676f, 0.0923671573f},
-std::array<float,2>{0.0284764282f, 0.954792738f},
-std::array<float,2>{0.91338098f, 0.383694857f},
-std::array<float,2>{0.573561192f, 0.889301062f},
-std::array<float,2>{0.391621739f, 0.460483313f},
-std::array<float,2>{0.212200031f, 0.605244517f},
-std::array<float,2>{0.858876526f, 0.0261653662f},
-std::array<float,2>{0.976281643f, 0.633369923f},
-std::array<float,2>{0.090966709f, 0.157055199f},
-std::array<float,2>{0.321179122f, 0.870414078f},
-std::array<float,2>{0.734856963f, 0.300957173f},
-std::array<float,2>{0.903244436f, 0.871263981f},
-std::array<float,2>{0.0472883098f, 0.298617601f},
-std::array<float,2>{0.290461719f, 0.638510048f},
-std::array<float,2>{0.639227569f, 0.163316578f},
-std::array<float,2>{0.518973887f, 0.608741522f},
-std::array<float,2>{0.459935367f, 0.029213015f},
-std::array<float,2>{0.166835621f, 0.885767877f},
-std::array<float,2>{0.794617653f, 0.456628114f},
-std::array<float,2>{0.716526866f, 0.959148228f},
-std::array<float,2>{0.35845241f, 0.387055635f},
-std::array<float,2>{0.114087552f, 0.509880841f},
-std::array<float,2>{0.963216662f, 0.0875240117f},
-std::array<float,2>{0.827203751f, 0.723953009f},
-std::array<float,2>{0.220055029f, 0.194260463f},
-std::array<float,2>{0.413154304f, 0.789057672f},
-std::array<float,2>{0.620001853f, 0.324319959f},
-std::array<float,2>{0.780101299f, 0.932816744f},
-std::array<float,2>{0.139035404f, 0.483416826f},
-std::array<float,2>{0.474137157f, 0.564313829f},
-std::array<float,2>{0.546715438f, 0.0622374415f},
-std::array<float,2>{0.667966187f, 0.659867525f},
-std::array<float,2>{0.27031973f, 0.147623539f},
-std::array<float,2>{0.0127077335f, 0.815056086f},
-std::array<float,2>{0.930740595f, 0.255640745f},
-std::array<float,2>{0.58991307f, 0.77284658f},
-std::array<float,2>{0.386319458f, 0.350644022f},
-std::array<float,2>{0.200194448f, 0.711230993f},
-std::array<float,2>{0.86524564f, 0.248239473f},
-std::array<float,2>{0.987553298f, 0.542073965f},
-std::array<float,2>{0.0702438951f, 0.0973701999f},
-std::array<float,2>{0.331996918f, 0.96902746f},
-std::array<float,2>{0.732470453f, 0.429492563f},
-std::array<float,2>{0.938958764f, 0.993480325f},
-std::array<float,2>{0.107538268f, 0.415282667f},
-std::array<float,2>{0.365229547f, 0.557002604f},
-std::array<float,2>{0.695148945f, 0.116384245f},
-std::array<float,2>{0.603805244f, 0.693066239f},
-std::array<float,2>{0.425108075f, 0.226332992f},
-std::array<float,2>{0.246766642f, 0.763399184f},
-std::array<float,2>{0.841586411f, 0.367876887f},
-std::array<float,2>{0.641545355f, 0.828759193f},
-std::array<float,2>{0.300120503f, 0.268498093f},
-std::array<float,2>{0.0351714715f, 0.674679399f},
-std::array<float,2>{0.878462255f, 0.138366044f},
-std::array<float,2>{0.798724592f, 0.586605191f},
-std::array<float,2>{0.182052597f, 0.0376299322f},
-std::array<float,2>{0.444886684f, 0.915919781f},
-std::array<float,2>{0.512581527f, 0.487916529f},
-std::array<float,2>{0.84580034f, 0.807976961f},
-std::array<float,2>{0.206204548f, 0.33440119f},
-std::array<float,2>{0.399894834f, 0.746826112f},
-std::array<float,2>{0.564053297f, 0.217666239f},
-std::array<float,2>{0.74266541f, 0.529297292f},
-std::array<float,2>{0.314718932f, 0.0664184839f},
-std::array<float,2>{0.0784642771f, 0.942090869f},
-std::array<float,2>{0.978256762f, 0.400656551f},
-std::array<float,2>{0.552719295f, 0.894852877f},
-std::array<float,2>{0.494082302f, 0.446088463f},
-std::array<float,2>{0.141385093f, 0.617240429f},
-std::array<float,2>{0.753132224f, 0.00790342968f},
-std::array<float,2>{0.920076728f, 0.65106529f},
-std::array<float,2>{0.0229668599f, 0.179014146f},
-std::array<float,2>{0.26371938f, 0.854234397f},
-std::array<float,2>{0.674081266f, 0.296401888f},
-std::array<float,2>{0.969977498f, 0.755051911f},
-std::array<float,2>{0.0863745734f, 0.360494137f},
-std::array<float,2>{0.325253874f, 0.70157361f},
-std::array<float,2>{0.740690172f, 0.229085863f},
-std::array<float,2>{0.576702237f, 0.549302042f},
-std::array<float,2>{0.39524737f, 0.122364499f},
-std::array<float,2>{0.217471838f, 0.988862872f},
-std::array<float,2>{0.853782654f, 0.409892082f},
-std::array<float,2>{0.684021115f, 0.91209656f},
-std::array<float,2>{0.255183816f, 0.49588567f},
-std::array<float,2>{0.0264412463f, 0.583163977f},
-std::array<float,2>{0.907293499f, 0.0449176766f},
-std::array<float,2>{0.765603542f, 0.682718277f},
-std::array<float,2>{0.15508914f, 0.127713755f},
-std::array<float,2>{0.487044603f, 0.840566993f},
-std::array<float,2>{0.558992028f, 0.27904433f},
-std::array<float,2>{0.835749447f, 0.946668565f},
-std::array<float,2>{0.240608871f, 0.394880831f},
-std::array<float,2>{0.429895282f, 0.522585452f},
-std::array<float,2>{0.598362088f, 0.0745502785f},
-std::array<float,2>{0.697112799f, 0.735810697f},
-std::array<float,2>{0.367379427f, 0.204466581f},
-std::array<float,2>{0.0945733413f, 0.79928422f},
-std::array<float,2>{0.946043313f, 0.335970998f},
-std::array<float,2>{0.500669003f, 0.847881615f},
-std::array<float,2>{0.451182902f, 0.283804357f},
-std::array<float,2>{0.179673344f, 0.643135369f},
-std::array<float,2>{0.811903238f, 0.184890151f},
-std::array<float,2>{0.887988806f, 0.613400877f},
-std::array<float,2>{0.0448354073f, 0.00502427435f},
-std::array<float,2>{0.309087723f, 0.902977705f},
-std::array<float,2>{0.653138638f, 0.437773257f},
-std::array<float,2>{0.925850749f, 0.875779152f},
-std::array<float,2>{0.000558388885f, 0.465355992f},
-std::array<float,2>{0.275147706f, 0.596418083f},
-std::array<float,2>{0.656947851f, 0.0201643649f},
-std::array<float,2>{0.533725858f, 0.625812709f},
-std::array<float,2>{0.482279837f, 0.164795101f},
-std::array<float,2>{0.127500787f, 0.862006009f},
-std::array<float,2>{0.770972669f, 0.307307482f},
-std::array<float,2>{0.719447553f, 0.794175088f},
-std::array<float,2>{0.337603211f, 0.313390046f},
-std::array<float,2>{0.0759764388f, 0.730488837f},
-std::array<float,2>{0.998454392f, 0.19789359f},
-std::array<float,2>{0.868715525f, 0.503566325f},
-std::array<float,2>{0.18905814f, 0.0841764733f},
-std::array<float,2>{0.375760764f, 0.963908315f},
-std::array<float,2>{0.582646251f, 0.380651921f},
-std::array<float,2>{0.78166908f, 0.82427907f},
-std::array<float,2>{0.161006749f, 0.261216909f},
-std::array<float,2>{0.463069648f, 0.665862143f},
-std::array<float,2>{0.526574135f, 0.155748576f},
-std::array<float,2>{0.632463455f, 0.576544166f},
-std::array<float,2>{0.285196334f, 0.0493198633f},
-std::array<float,2>{0.0584598593f, 0.924161494f},
-std::array<float,2>{0.896126747f, 0.475558192f},
-std::array<float,2>{0.61492455f, 0.98227042f},
-std::array<float,2>{0.419305086f, 0.436760008f},
-std::array<float,2>{0.229703024f, 0.537310421f},
-std::array<float,2>{0.817241669f, 0.105168842f},
-std::array<float,2>{0.95690161f, 0.703887939f},
-std::array<float,2>{0.12087141f, 0.237011045f},
-std::array<float,2>{0.350466579f, 0.777883708f},
-std::array<float,2>{0.707514644f, 0.355086833f},
-std::array<float,2>{0.913637638f, 0.782107413f},
-std::array<float,2>{0.0291448031f, 0.322702795f},
-std::array<float,2>{0.251560807f, 0.719591081f},
-std::array<float,2>{0.68216747f, 0.189691424f},
-std::array<float,2>{0.557680547f, 0.513337791f},
-std::array<float,2>{0.490502268f, 0.0905977711f},
-std::array<float,2>{0.151990369f, 0.956261039f},
-std::array<float,2>{0.758601367f, 0.386376679f},
-std::array<float,2>{0.735303521f, 0.888483465f},
-std::array<float,2>{0.320452183f, 0.458959192f},
-std::array<float,2>{0.0913641453f, 0.602595627f},
-std::array<float,2>{0.976030946f, 0.0243622158f},
-std::array<float,2>{0.858932674f, 0.635804951f},
-std::array<float,2>{0.212420166f, 0.158692762f},
-std::array<float,2>{0.392501265f, 0.86828053f},
-std::array<float,2>{0.573885143f, 0.303299785f},
-std::array<float,2>{0.805001676f, 0.973045349f},
-std::array<float,2>{0.175385147f, 0.425355792f},
-std::array<float,2>{0.449194521f, 0.543578029f},
-std::array<float,2>{0.504540682f, 0.100404873f},
-std::array<float,2>{0.649027646f, 0.717192709f},
-std::array<float,2>{0.305195272f, 0.245206088f},
-std::array<float,2>{0.0391242541f, 0.767570555f},
-std::array<float,2>{0.882849336f, 0.347533852f},
-std::array<float,2>{0.597063839f, 0.818627954f},
-std::array<float,2>{0.436011344f, 0.253281087f},
-std::array<float,2>{0.237666637f, 0.663899779f},
-std::array<float,2>{0.828592896f, 0.143461868f},
-std::array<float,2>{0.951212645f, 0.567593098f},
-std::array<float,2>{0.100733094f, 0.0583676584f},
-std::array<float,2>{0.372838765f, 0.935474336f},
-std::array<float,2>{0.700750351f, 0.477288187f},
-std::array<float,2>{0.995982945f, 0.919860244f},
-std::array<float,2>{0.0707275122f, 0.489534974f},
-std::array<float,2>{0.340493739f, 0.593650043f},
-std::array<float,2>{0.723749101f, 0.0334204063f},
-std::array<float,2>{0.581060529f, 0.679013073f},
-std::array<float,2>{0.381250024f, 0.134941384f},
-std::array<float,2>{0.195204556f, 0.834969342f},
-std::array<float,2>{0.874083221f, 0.271101415f},
-std::array<float,2>{0.663124859f, 0.758744121f},
-std::array<float,2>{0.27764073f, 0.371340722f},
-std::array<float,2>{0.00478328019f, 0.688777328f},
-std::array<float,2>{0.922685802f, 0.218770117f},
-std::array<float,2>{0.766740263f, 0.560575664f},
-std::array<float,2>{0.130489394f, 0.110086255f},
-std::array<float,2>{0.478653103f, 0.996320069f},
-std::array<float,2>{0.537391901f, 0.418324202f},
-std::array<float,2>{0.814505458f, 0.85785687f},
-std::array<float,2>{0.231198326f, 0.291564345f},
-std::array<float,2>{0.41756171f, 0.655065954f},
-std::array<float,2>{0.612378299f, 0.173845887f},
-std::array<float,2>{0.704385221f, 0.62353003f},
-std::array<float,2>{0.345435709f, 0.0133644082f},
-std::array<float,2>{0.121189915f, 0.894245505f},
-std::array<float,2>{0.959195971f, 0.449924916f},
-std::array<float,2>{0.530139983f, 0.93977946f},
-std::array<float,2>{0.467211783f, 0.403239995f},
-std::array<float,2>{0.157603562f, 0.52674973f},
-std::array<float,2>{0.787362158f, 0.0626620948f},
-std::array<float,2>{0.891052783f, 0.74355334f},
-std::array<float,2>{0.0622317716f, 0.213585779f},
-std::array<float,2>{0.283268988f, 0.812423646f},
-std::array<float,2>{0.628216743f, 0.332020909f},
-std::array<float,2>{0.96537447f, 0.8370471f},
-std::array<float,2>{0.112059794f, 0.274196148f},
-std::array<float,2>{0.352653116f, 0.686401069f},
-std::array<float,2>{0.713298261f, 0.132616878f},
-std::array<float,2>{0.62196964f, 0.581581712f},
-std::array<float,2>{0.409915686f, 0.0415075682f},
-std::array<float,2>{0.226189747f, 0.906368434f},
-std::array<float,2>{0.821221292f, 0.496495903f},
-std::array<float,2>{0.634209633f, 0.985991001f},
-std::array<float,2>{0.293508202f, 0.411415875f},
-std::array<float,2>{0.0542692281f, 0.551124275f},
-std::array<float,2>{0.898727417f, 0.119782209f},
-std::array<float,2>{0.79034704f, 0.696343243f},
-std::array<float,2>{0.170543134f, 0.232240096f},
-std::array<float,2>{0.456500918f, 0.753704131f},
-std::array<float,2>{0.51966238f, 0.364294887f},
-std::array<float,2>{0.862462401f, 0.901059508f},
-std::array<float,2>{0.196150169f, 0.444644928f},
-std::array<float,2>{0.388288915f, 0.612476826f},
-std::array<float,2>{0.587112546f, 0.00298037217f},
-std::array<float,2>{0.728726089f, 0.646674514f},
-std::array<float,2>{0.334748685f, 0.179892987f},
-std::array<float,2>{0.0660737008f, 0.844047666f},
-std::array<float,2>{0.988885224f, 0.285514146f},
-std::array<float,2>{0.542797923f, 0.80401659f},
-std::array<float,2>{0.47260955f, 0.341724694f},
-std::array<float,2>{0.134850979f, 0.738774359f},
-std::array<float,2>{0.775781155f, 0.210382566f},
-std::array<float,2>{0.934311688f, 0.516044497f},
-std::array<float,2>{0.00861081667f, 0.0732033476f},
-std::array<float,2>{0.267112762f, 0.951905727f},
-std::array<float,2>{0.671798587f, 0.394286662f},
-std::array<float,2>{0.879094183f, 0.96604687f},
-std::array<float,2>{0.0315308161f, 0.378035188f},
-std::array<float,2>{0.304513127f, 0.505369604f},
-std::array<float,2>{0.647270739f, 0.0790719017f},
-std::array<float,2>{0.511422932f, 0.730345964f},
-std::array<float,2>{0.43861109f, 0.202770755f},
-std::array<float,2>{0.184996024f, 0.790857315f},
-std::array<float,2>{0.802159846f, 0.317384899f},
-std::array<float,2>{0.68894726f, 0.866680384f},
-std::array<float,2>{0.362210184f, 0.31137985f},
-std::array<float,2>{0.102137677f, 0.630795836f},
-std::array<float,2>{0.942759633f, 0.169953674f},
-std::array<float,2>{0.836816788f, 0.597672164f},
-std::array<float,2>{0.245033741f, 0.0170993991f},
-std::array<float,2>{0.426883489f, 0.880488336f},
-std::array<float,2>{0.608412206f, 0.464052409f},
-std::array<float,2>{0.757644475f, 0.775157154f},
-std::array<float,2>{0.145181358f, 0.356495082f},
-std::array<float,2>{0.497928113f, 0.707527459f},
-std::array<float,2>{0.548517525f, 0.240348086f},
-std::array<float,2>{0.67817533f, 0.533961236f},
-std::array<float,2>{0.261706948f, 0.106749788f},
-std::array<float,2>{0.0167408697f, 0.978449583f},
-std::array<float,2>{0.916612744f, 0.431873202f},
-std::array<float,2>{0.570305288f, 0.927084684f},
-std::array<float,2>{0.403830975f, 0.471710831f},
-std::array<float,2>{0.208970204f, 0.571815073f},
-std::array<float,2>{0.848032653f, 0.0514485314f},
-std::array<float,2>{0.981327176f, 0.671371281f},
-std::array<float,2>{0.0822773576f, 0.151887253f},
-std::array<float,2>{0.319633693f, 0.822856069f},
-std::array<float,2>{0.747215807f, 0.264659315f},
-std::array<float,2>{0.932437539f, 0.813586891f},
-std::array<float,2>{0.0154216541f, 0.256972164f},
-std::array<float,2>{0.271882087f, 0.656816423f},
-std::array<float,2>{0.665853679f, 0.145101517f},
-std::array<float,2>{0.544606924f, 0.565835238f},
-std::array<float,2>{0.475381196f, 0.0598580018f},
-std::array<float,2>{0.138640761f, 0.92975992f},
-std::array<float,2>{0.778896511f, 0.481863439f},
-std::array<float,2>{0.730733395f, 0.971511066f},
-std::array<float,2>{0.328575283f, 0.427199543f},
-std::array<float,2>{0.0676732585f, 0.53956753f},
-std::array<float,2>{0.98439151f, 0.0945454016f},
-std::array<float,2>{0.864126861f, 0.713300467f},
-std::array<float,2>{0.201371595f, 0.246133149f},
-std::array<float,2>{0.38403517f, 0.770527959f},
-std::array<float,2>{0.592309892f, 0.347955167f},
-std::array<float,2>{0.79519403f, 0.884315014f},
-std::array<float,2>{0.164336473f, 0.453924954f},
-std::array<float,2>{0.45785293f, 0.60716337f},
-std::array<float,2>{0.515651703f, 0.0293274634f},
-std::array<float,2>{0.638489127f, 0.638720512f},
-std::array<float,2>{0.291583955f, 0.160506815f},
-std::array<float,2>{0.0490334816f, 0.873396277f},
-std::array<float,2>{0.905994952f, 0.300362557f},
-std::array<float,2>{0.618239105f, 0.78525275f},
-std::array<float,2>{0.411958963f, 0.327557117f},
-std::array<float,2>{0.220939353f, 0.725633383f},
-std::array<float,2>{0.824637592f, 0.192127913f},
-std::array<float,2>{0.962225258f, 0.508541584f},
-std::array<float,2>{0.116766833f, 0.0896153301f},
-std::array<float,2>{0.355843037f, 0.958034396f},
-std::array<float,2>{0.717875004f, 0.389267206f},
-std::array<float,2>{0.979941964f, 0.944028497f},
-std::array<float,2>{0.080328308f, 0.399889171f},
-std::array<float,2>{0.312847972f, 0.52889508f},
-std::array<float,2>{0.746048987f, 0.069331713f},
-std::array<float,2>{0.56635201f, 0.749474466f},
-std::array<float,2>{0.400397301f, 0.216391653f},
-std::array<float,2>{0.205003932f, 0.806488872f},
-std::array<float,2>{0.845144272f, 0.333242536f},
-std::array<float,2>{0.673346043f, 0.852373481f},
-std::array<float,2>{0.262953252f, 0.293462723f},
-std::array<float,2>{0.0212343968f, 0.649436772f},
-std::array<float,2>{0.919534028f, 0.177488133f},
-std::array<float,2>{0.750801146f, 0.620120585f},
-std::array<float,2>{0.143223614f, 0.0104048997f},
-std::array<float,2>{0.495336264f, 0.89674449f},
-std::array<float,2>{0.55369699f, 0.448636413f},
-std::array<float,2>{0.84296f, 0.765354514f},
-std::array<float,2>{0.248077095f, 0.36991626f},
-std::array<float,2>{0.423356444f, 0.694585979f},
-std::array<float,2>{0.602435708f, 0.223881215f},
-std::array<float,2>{0.692989409f, 0.555301309f},
-std::array<float,2>{0.366821766f, 0.113913186f},
-std::array<float,2>{0.106503025f, 0.995172977f},
-std::array<float,2>{0.939489782f, 0.416377485f},
-std::array<float,2>{0.515605688f, 0.917661667f},
-std::array<float,2>{0.443036169f, 0.485305876f},
-std::array<float,2>{0.181118235f, 0.589329183f},
-std::array<float,2>{0.800463319f, 0.0353948362f},
-std::array<float,2>{0.876725197f, 0.672083497f},
-std::array<float,2>{0.0380041525f, 0.139957786f},
-std::array<float,2>{0.296977371f, 0.83104378f},
-std::array<float,2>{0.644499302f, 0.267285019f},
-std::array<float,2>{0.948043048f, 0.796899021f},
-std::array<float,2>{0.096883297f, 0.338016897f},
-std::array<float,2>{0.370564818f, 0.737513185f},
-std::array<float,2>{0.698494375f, 0.20572862f},
-std::array<float,2>{0.601199567f, 0.520358205f},
-std::array<float,2>{0.432535052f, 0.076523006f},
-std::array<float,2>{0.238647625f, 0.948653877f},
-std::array<float,2>{0.8327896f, 0.398419172f},
-std::array<float,2>{0.654540241f, 0.905084431f},
-std::array<float,2>{0.312286586f, 0.440676659f},
-std::array<float,2>{0.0460557565f, 0.615710318f},
-std::array<float,2>{0.890093207f, 0.00603052042f},
-std::array<float,2>{0.810481191f, 0.64218992f},
-std::array<float,2>{0.175884023f, 0.186685771f},
-std::array<float,2>{0.450591445f, 0.850021899f},
-std::array<float,2>{0.502606809f, 0.281937361f},
-std::array<float,2>{0.85345161f, 0.990909696f},
-std::array<float,2>{0.215549365f, 0.406959593f},
-std::array<float,2>{0.397597462f, 0.547774017f},
-std::array<float,2>{0.575254738f, 0.124187887f},
-std::array<float,2>{0.740216374f, 0.699901581f},
-std::array<float,2>{0.326313317f, 0.226967856f},
-std::array<float,2>{0.0886440352f, 0.756204247f},
-std::array<float,2>{0.972332239f, 0.362356246f},
-std::array<float,2>{0.561734438f, 0.84268409f},
-std::array<float,2>{0.484713763f, 0.280026704f},
-std::array<float,2>{0.153392032f, 0.680419087f},
-std::array<float,2>{0.76199621f, 0.12565589f},
-std::array<float,2>{0.909717798f, 0.584417045f},
-std::array<float,2>{0.0236367267f, 0.0467454493f},
-std::array<float,2>{0.25655368f, 0.913816988f},
-std::array<float,2>{0.686700106f, 0.492769867f},
-std::array<float,2>{0.896803319f, 0.922511876f},
-std::array<float,2>{0.0548356548f, 0.473354429f},
-std::array<float,2>{0.287467927f, 0.575007856f},
-std::array<float,2>{0.629530847f, 0.0478504226f},
-std::array<float,2>{0.523900509f, 0.666731596f},
-std::array<float,2>{0.46148777f, 0.153733477f},
-std::array<float,2>{0.162207335f, 0.82617861f},
-std::array<float,2>{0.784414589f, 0.25923574f},
-std::array<float,2>{0.710638881f, 0.78104347f},
-std::array<float,2>{0.349353731f, 0.351733148f},
-std::array<float,2>{0.117297992f, 0.70584172f},
-std::array<float,2>{0.954630554f, 0.234847426f},
-std::array<float,2>{0.818726957f, 0.536073446f},
-std::array<float,2>{0.228327841f, 0.101965956f},
-std::array<float,2>{0.421871811f, 0.983547211f},
-std::array<float,2>{0.616178095f, 0.434419274f},
-std::array<float,2>{0.772115529f, 0.860065222f},
-std::array<float,2>{0.126660809f, 0.304765284f},
-std::array<float,2>{0.482798755f, 0.628128111f},
-std::array<float,2>{0.531607449f, 0.166832104f},
-std::array<float,2>{0.658214688f, 0.594775498f},
-std::array<float,2>{0.276082039f, 0.0233001076f},
-std::array<float,2>{0.0033156951f, 0.878137827f},
-std::array<float,2>{0.929589868f, 0.468623757f},
-std::array<float,2>{0.584586143f, 0.962029099f},
-std::array<float,2>{0.377985805f, 0.382494777f},
-std::array<float,2>{0.18970491f, 0.500178337f},
-std::array<float,2>{0.869332671f, 0.0831974447f},
-std::array<float,2>{0.997925639f, 0.733358383f},
-std::array<float,2>{0.076291509f, 0.195849508f},
-std::array<float,2>{0.339668453f, 0.795582414f},
-std::array<float,2>{0.722357869f, 0.314693958f},
-std::array<float,2>{0.885444343f, 0.768776059f},
-std::array<float,2>{0.0422602072f, 0.344624788f},
-std::array<float,2>{0.307625055f, 0.716586769f},
-std::array<float,2>{0.651702225f, 0.242846966f},
-std::array<float,2>{0.50605607f, 0.545859933f},
-std::array<float,2>{0.446989685f, 0.0994789675f},
-std::array<float,2>{0.172881857f, 0.975060344f},
-std::array<float,2>{0.808127165f, 0.422926128f},
-std::array<float,2>{0.701600611f, 0.935550809f},
-std::array<float,2>{0.373520344f, 0.479192078f},
-std::array<float,2>{0.0987771526f, 0.570199549f},
-std::array<float,2>{0.950125039f, 0.0549729876f},
-std::array<float,2>{0.831468463f, 0.661094666f},
-std::array<float,2>{0.236040384f, 0.142117426f},
-std::array<float,2>{0.43445918f, 0.81695354f},
-std::array<float,2>{0.594978988f, 0.251094818f},
-std::array<float,2>{0.761229753f, 0.954388499f},
-std::array<float,2>{0.149833918f, 0.382895708f},
-std::array<float,2>{0.490055889f, 0.513840675f},
-std::array<float,2>{0.555441499f, 0.0919427276f},
-std::array<float,2>{0.679943025f, 0.721067488f},
-std::array<float,2>{0.252364606f, 0.188819721f},
-std::array<float,2>{0.0298895705f, 0.784510314f},
-std::array<float,2>{0.910261333f, 0.320786595f},
-std::array<float,2>{0.570471823f, 0.870665371f},
-std::array<float,2>{0.393439412f, 0.301497877f},
-std::array<float,2>{0.214125216f, 0.633128166f},
-std::array<float,2>{0.855751872f, 0.156441256f},
-std::array<float,2>{0.974399567f, 0.604823947f},
-std::array<float,2>{0.0925127268f, 0.0253985897f},
-std::array<float,2>{0.32247591f, 0.888742685f},
-std::array<float,2>{0.736480415f, 0.460062176f},
-std::array<float,2>{0.958372533f, 0.891073585f},
-std::array<float,2>{0.124118403f, 0.452743918f},
-std::array<float,2>{0.347582757f, 0.621681273f},
-std::array<float,2>{0.705593944f, 0.0149648702f},
-std::array<float,2>{0.609462202f, 0.652812302f},
-std::array<float,2>{0.414387941f, 0.172820106f},
-std::array<float,2>{0.232970968f, 0.857085526f},
-std::array<float,2>{0.812534332f, 0.289411128f},
-std::array<float,2>{0.626806855f, 0.810475349f},
-std::array<float,2>{0.28253448f, 0.329583287f},
-std::array<float,2>{0.0592803992f, 0.744592905f},
-std::array<float,2>{0.893602908f, 0.211825192f},
-std::array<float,2>{0.785992205f, 0.524462342f},
-std::array<float,2>{0.159435481f, 0.0663665906f},
-std::array<float,2>{0.465280503f, 0.939298928f},
-std::array<float,2>{0.528994858f, 0.405058622f},
-std::array<float,2>{0.87268883f, 0.832576871f},
-std::array<float,2>{0.191617519f, 0.272748917f},
-std::array<float,2>{0.379478991f, 0.677622318f},
-std::array<float,2>{0.579716861f, 0.134168059f},
-std::array<float,2>{0.724728405f, 0.589926243f},
-std::array<float,2>{0.34373337f, 0.0314856209f},
-std::array<float,2>{0.0742125735f, 0.920165539f},
-std::array<float,2>{0.993855536f, 0.491350919f},
-std::array<float,2>{0.535266578f, 0.998067975f},
-std::array<float,2>{0.476710558f, 0.421415895f},
-std::array<float,2>{0.131329402f, 0.560067415f},
-std::array<float,2>{0.768199086f, 0.111526184f},
-std::array<float,2>{0.925511301f, 0.690703571f},
-std::array<float,2>{0.00764971133f, 0.221536443f},
-std::array<float,2>{0.279825091f, 0.761476278f},
-std::array<float,2>{0.661088645f, 0.373290986f},
-std::array<float,2>{0.991435468f, 0.846113563f},
-std::array<float,2>{0.0630040839f, 0.288220972f},
-std::array<float,2>{0.333494395f, 0.645645738f},
-std::array<float,2>{0.726974905f, 0.182732746f},
-std::array<float,2>{0.588995576f, 0.60996902f},
-std::array<float,2>{0.38912037f, 0.000965129933f},
-std::array<float,2>{0.198691487f, 0.899195075f},
-std::array<float,2>{0.859825969f, 0.442211121f},
-std::array<float,2>{0.669445395f, 0.950386763f},
-std::array<float,2>{0.269001693f, 0.391376585f},
-std::array<float,2>{0.010991822f, 0.518095136f},
-std::array<float,2>{0.93617779f, 0.070776917f},
-std::array<float,2>{0.774744391f, 0.741227865f},
-std::array<float,2>{0.134058118f, 0.20727253f},
-std::array<float,2>{0.470478863f, 0.801294863f},
-std::array<float,2>{0.539249957f, 0.342320323f},
-std::array<float,2>{0.824068964f, 0.90849787f},
-std::array<float,2>{0.223781317f, 0.499128819f},
-std::array<float,2>{0.407398105f, 0.578625321f},
-std::array<float,2>{0.623580039f, 0.0399714783f},
-std::array<float,2>{0.712135732f, 0.683886528f},
-std::array<float,2>{0.354744792f, 0.130522445f},
-std::array<float,2>{0.110117204f, 0.839391053f},
-std::array<float,2>{0.968148589f, 0.276372224f},
-std::array<float,2>{0.521494865f, 0.750012219f},
-std::array<float,2>{0.453496754f, 0.366687119f},
-std::array<float,2>{0.168694347f, 0.697456121f},
-std::array<float,2>{0.791209817f, 0.234301597f},
-std::array<float,2>{0.901513815f, 0.554284394f},
-std::array<float,2>{0.0510862842f, 0.117426269f},
-std::array<float,2>{0.296857566f, 0.987115741f},
-std::array<float,2>{0.635464191f, 0.412861645f},
-std::array<float,2>{0.915454388f, 0.980359375f},
-std::array<float,2>{0.0187459681f, 0.430643857f},
-std::array<float,2>{0.259758919f, 0.532920718f},
-std::array<float,2>{0.67603749f, 0.108526848f},
-std::array<float,2>{0.549585998f, 0.709455788f},
-std::array<float,2>{0.499731332f, 0.239908293f},
-std::array<float,2>{0.147858977f, 0.777258158f},
-std::array<float,2>{0.755835116f, 0.35790503f},
-std::array<float,2>{0.749622047f, 0.82122314f},
-std::array<float,2>{0.317155659f, 0.263564646f},
-std::array<float,2>{0.08401265f, 0.66853863f},
-std::array<float,2>{0.982774675f, 0.149087012f},
-std::array<float,2>{0.850592017f, 0.57392782f},
-std::array<float,2>{0.209873646f, 0.0539610386f},
-std::array<float,2>{0.404826969f, 0.929121196f},
-std::array<float,2>{0.568243504f, 0.469289988f},
-std::array<float,2>{0.802877665f, 0.792889297f},
-std::array<float,2>{0.186326653f, 0.320181817f},
-std::array<float,2>{0.44001025f, 0.727479398f},
-std::array<float,2>{0.508196235f, 0.200320199f},
-std::array<float,2>{0.64484942f, 0.505914509f},
-std::array<float,2>{0.301453382f, 0.0816753134f},
-std::array<float,2>{0.0345952027f, 0.967600465f},
-std::array<float,2>{0.880882263f, 0.37609309f},
-std::array<float,2>{0.60563612f, 0.882665575f},
-std::array<float,2>{0.428262442f, 0.462673336f},
-std::array<float,2>{0.243129224f, 0.599638402f},
-std::array<float,2>{0.838678062f, 0.0188904032f},
-std::array<float,2>{0.945140719f, 0.632393062f},
-std::array<float,2>{0.10370104f, 0.168203071f},
-std::array<float,2>{0.360459924f, 0.865138352f},
-std::array<float,2>{0.689889908f, 0.309187233f},
-std::array<float,2>{0.91845119f, 0.855129242f},
-std::array<float,2>{0.0201223418f, 0.295414776f},
-std::array<float,2>{0.262314349f, 0.65151906f},
-std::array<float,2>{0.672061443f, 0.178118587f},
-std::array<float,2>{0.553965032f, 0.61853987f},
-std::array<float,2>{0.494748473f, 0.00912880339f},
-std::array<float,2>{0.144233912f, 0.896471024f},
-std::array<float,2>{0.75107944f, 0.446569026f},
-std::array<float,2>{0.744800985f, 0.942454994f},
-std::array<float,2>{0.314046025f, 0.401949584f},
-std::array<float,2>{0.0819238797f, 0.530855834f},
-std::array<float,2>{0.979320943f, 0.06823349f},
-std::array<float,2>{0.843866229f, 0.747179508f},
-std::array<float,2>{0.203695342f, 0.218009874f},
-std::array<float,2>{0.402174145f, 0.806895137f},
-std::array<float,2>{0.564914286f, 0.335835695f},
-std::array<float,2>{0.799070001f, 0.914539516f},
-std::array<float,2>{0.180606321f, 0.486666143f},
-std::array<float,2>{0.441944033f, 0.587594032f},
-std::array<float,2>{0.514514744f, 0.0390473567f},
-std::array<float,2>{0.642914116f, 0.675161719f},
-std::array<float,2>{0.298749179f, 0.137210011f},
-std::array<float,2>{0.0380949788f, 0.829295099f},
-std::array<float,2>{0.875644147f, 0.269252419f},
-std::array<float,2>{0.603012502f, 0.762368977f},
-std::array<float,2>{0.422310024f, 0.369083583f},
-std::array<float,2>{0.249362245f, 0.691918015f},
-std::array<float,2>{0.841970503f, 0.224940121f},
-std::array<float,2>{0.940696061f, 0.558043361f},
-std::array<float,2>{0.106131747f, 0.115837589f},
-std::array<float,2>{0.365443319f, 0.992192805f},
-std::array<float,2>{0.691494763f, 0.414106786f},
-std::array<float,2>{0.986221373f, 0.96981287f},
-std::array<float,2>{0.0666847229f, 0.428100318f},
-std::array<float,2>{0.32919693f, 0.541429102f},
-std::array<float,2>{0.731823444f, 0.0961965397f},
-std::array<float,2>{0.593356848f, 0.712850094f},
-std::array<float,2>{0.383008391f, 0.249765262f},
-std::array<float,2>{0.202659369f, 0.772444844f},
-std::array<float,2>{0.864971399f, 0.350349516f},
-std::array<float,2>{0.664423168f, 0.816290379f},
-std::array<float,2>{0.273321122f, 0.25445348f},
-std::array<float,2>{0.0145936059f, 0.658320308f},
-std::array<float,2>{0.933214366f, 0.146794483f},
-std::array<float,2>{0.777941525f, 0.562870681f},
-std::array<float,2>{0.137288794f, 0.0613725074f},
-std::array<float,2>{0.475732058f, 0.93165952f},
-std::array<float,2>{0.543551445f, 0.482871652f},
-std::array<float,2>{0.825231791f, 0.787217915f},
-std::array<float,2>{0.222134098f, 0.325542152f},
-std::array<float,2>{0.410520911f, 0.72347343f},
-std::array<float,2>{0.618092418f, 0.194985241f},
-std::array<float,2>{0.716830671f, 0.510753393f},
-std::array<float,2>{0.356659085f, 0.0860706493f},
-std::array<float,2>{0.115836069f, 0.960200191f},
-std::array<float,2>{0.96127516f, 0.388409823f},
-std::array<float,2>{0.51687032f, 0.885215282f},
-std::array<float,2>{0.458648384f, 0.45595336f},
-std::array<float,2>{0.165781379f, 0.608041704f},
-std::array<float,2>{0.796089768f, 0.0281418096f},
-std::array<float,2>{0.904549539f, 0.637192845f},
-std::array<float,2>{0.0505988188f, 0.162408829f},
-std::array<float,2>{0.292203665f, 0.872872591f},
-std::array<float,2>{0.637121558f, 0.296900183f},
-std::array<float,2>{0.953767061f, 0.778908551f},
-std::array<float,2>{0.118460432f, 0.353927732f},
-std::array<float,2>{0.347673118f, 0.704181612f},
-std::array<float,2>{0.709014118f, 0.237965733f},
-std::array<float,2>{0.616214037f, 0.538284481f},
-std::array<float,2>{0.420647919f, 0.104157686f},
-std::array<float,2>{0.227167711f, 0.981220722f},
-std::array<float,2>{0.819615841f, 0.436274499f},
-std::array<float,2>{0.629982114f, 0.925389946f},
-std::array<float,2>{0.2889705f, 0.47591418f},
-std::array<float,2>{0.0565989204f, 0.577617407f},
-std::array<float,2>{0.898321569f, 0.0504957661f},
-std::array<float,2>{0.783946514f, 0.664999366f},
-std::array<float,2>{0.163422108f, 0.154498041f},
-std::array<float,2>{0.46229443f, 0.825300634f},
-std::array<float,2>{0.524684191f, 0.25997442f},
-std::array<float,2>{0.870626807f, 0.962946355f},
-std::array<float,2>{0.190803051f, 0.379124075f},
-std::array<float,2>{0.377613097f, 0.502156913f},
-std::array<float,2>{0.585343361f, 0.0851656571f},
-std::array<float,2>{0.721274078f, 0.731504738f},
-std::array<float,2>{0.338344604f, 0.198384792f},
-std::array<float,2>{0.0776174441f, 0.793326378f},
-std::array<float,2>{0.996316195f, 0.313506901f},
-std::array<float,2>{0.532292485f, 0.86316812f},
-std::array<float,2>{0.484058917f, 0.308333606f},
-std::array<float,2>{0.125734761f, 0.626701951f},
-std::array<float,2>{0.773175538f, 0.165545329f},
-std::array<float,2>{0.92865026f, 0.596751153f},
-std::array<float,2>{0.00244711526f, 0.020549804f},
-std::array<float,2>{0.276525378f, 0.876109123f},
-std::array<float,2>{0.659230709f, 0.466172129f},
-std::array<float,2>{0.889047444f, 0.903529346f},
-std::array<float,2>{0.0454215184f, 0.43907547f},
-std::array<float,2>{0.310675979f, 0.615075231f},
-std::array<float,2>{0.656000078f, 0.00426648417f},
-std::array<float,2>{0.50314647f, 0.644280314f},
-std::array<float,2>{0.449707597f, 0.184174761f},
-std::array<float,2>{0.177594498f, 0.848827422f},
-std::array<float,2>{0.808815777f, 0.284879535f},
-std::array<float,2>{0.69750309f, 0.800030589f},
-std::array<float,2>{0.36976102f, 0.337400883f},
-std::array<float,2>{0.096334286f, 0.735289037f},
-std::array<float,2>{0.948261023f, 0.203484237f},
-std::array<float,2>{0.833944261f, 0.522148669f},
-std::array<float,2>{0.240135133f, 0.0753647983f},
-std::array<float,2>{0.433591396f, 0.946172714f},
-std::array<float,2>{0.600244045f, 0.396139622f},
-std::array<float,2>{0.762803555f, 0.84130317f},
-std::array<float,2>{0.152637482f, 0.277768195f},
-std::array<float,2>{0.485934645f, 0.682585418f},
-std::array<float,2>{0.561040998f, 0.12820752f},
-std::array<float,2>{0.685829461f, 0.582177937f},
-std::array<float,2>{0.257115185f, 0.0434714034f},
-std::array<float,2>{0.0245418008f, 0.910204947f},
-std::array<float,2>{0.908926964f, 0.49423039f},
-std::array<float,2>{0.574421585f, 0.989720523f},
-std::array<float,2>{0.396516502f, 0.408265054f},
-std::array<float,2>{0.21647346f, 0.550261199f},
-std::array<float,2>{0.851834834f, 0.121513277f},
-std::array<float,2>{0.971287429f, 0.702458799f},
-std::array<float,2>{0.089457944f, 0.230222136f},
-std::array<float,2>{0.32763806f, 0.754044294f},
-std::array<float,2>{0.738442898f, 0.359896034f},
-std::array<float,2>{0.893502653f, 0.810851038f},
-std::array<float,2>{0.0598863661f, 0.330267698f},
-std::array<float,2>{0.282016903f, 0.742534041f},
-std::array<float,2>{0.625184894f, 0.214113697f},
-std::array<float,2>{0.527358592f, 0.525828779f},
-std::array<float,2>{0.466709912f, 0.063579537f},
-std::array<float,2>{0.158416271f, 0.941084981f},
-std::array<float,2>{0.786738276f, 0.40378508f},
-std::array<float,2>{0.706468403f, 0.893438995f},
-std::array<float,2>{0.346032202f, 0.450329274f},
-std::array<float,2>{0.123888373f, 0.62497431f},
-std::array<float,2>{0.957367063f, 0.0124155339f},
-std::array<float,2>{0.814358294f, 0.655523002f},
-std::array<float,2>{0.233854219f, 0.175076261f},
-std::array<float,2>{0.415104955f, 0.858916521f},
-std::array<float,2>{0.610457718f, 0.292443186f},
-std::array<float,2>{0.769472003f, 0.997182012f},
-std::array<float,2>{0.132044211f, 0.419242233f},
-std::array<float,2>{0.47798422f, 0.56179893f},
-std::array<float,2>{0.536855817f, 0.110820226f},
-std::array<float,2>{0.661632717f, 0.688307047f},
-std::array<float,2>{0.28113097f, 0.21981582f},
-std::array<float,2>{0.00666773459f, 0.759406567f},
-std::array<float,2>{0.924100459f, 0.372210979f},
-std::array<float,2>{0.578549564f, 0.834332347f},
-std::array<float,2>{0.379929572f, 0.269601524f},
-std::array<float,2>{0.193169519f, 0.678557694f},
-std::array<float,2>{0.871844649f, 0.13638553f},
-std::array<float,2>{0.993109047f, 0.592098117f},
-std::array<float,2>{0.0728498921f, 0.0346713103f},
-std::array<float,2>{0.34183532f, 0.918387175f},
-std::array<float,2>{0.7264359f, 0.489143103f},
-std::array<float,2>{0.951144874f, 0.933783352f},
-std::array<float,2>{0.0978133753f, 0.478459269f},
-std::array<float,2>{0.374708951f, 0.566569507f},
-std::array<float,2>{0.702485085f, 0.0571227707f},
-std::array<float,2>{0.594185114f, 0.662350297f},
-std::array<float,2>{0.435231239f, 0.143782318f},
-std::array<float,2>{0.234727561f, 0.819979131f},
-std::array<float,2>{0.830470502f, 0.252050459f},
-std::array<float,2>{0.651232243f, 0.766361237f},
-std::array<float,2>{0.307603627f, 0.346440285f},
-std::array<float,2>{0.0413749106f, 0.718627572f},
-std::array<float,2>{0.886235178f, 0.244698763f},
-std::array<float,2>{0.807431877f, 0.544039309f},
-std::array<float,2>{0.172181875f, 0.100627437f},
-std::array<float,2>{0.446072429f, 0.973938465f},
-std::array<float,2>{0.507471263f, 0.424003482f},
-std::array<float,2>{0.856459916f, 0.867622912f},
-std::array<float,2>{0.21308507f, 0.304682791f},
-std::array<float,2>{0.394093841f, 0.635139823f},
-std::array<float,2>{0.571446121f, 0.159242749f},
-std::array<float,2>{0.737911224f, 0.601647198f},
-std::array<float,2>{0.323472619f, 0.0244453773f},
-std::array<float,2>{0.0928742141f, 0.887258947f},
-std::array<float,2>{0.973333001f, 0.457491815f},
-std::array<float,2>{0.555995762f, 0.955725491f},
-std::array<float,2>{0.488930076f, 0.384933919f},
-std::array<float,2>{0.148829862f, 0.511774778f},
-std::array<float,2>{0.760443807f, 0.0911208764f},
-std::array<float,2>{0.911740959f, 0.720024049f},
-std::array<float,2>{0.030494675f, 0.190593779f},
-std::array<float,2>{0.253492147f, 0.782441139f},
-std::array<float,2>{0.680747926f, 0.323674291f},
-std::array<float,2>{0.983489335f, 0.824052751f},
-std::array<float,2>{0.0857696235f, 0.264139503f},
-std::array<float,2>{0.317841679f, 0.670714676f},
-std::array<float,2>{0.748212993f, 0.150490597f},
-std::array<float,2>{0.566768646f, 0.571020007f},
-std::array<float,2>{0.405660897f, 0.0526959747f},
-std::array<float,2>{0.210104823f, 0.926581025f},
-std::array<float,2>{0.850053072f, 0.470978796f},
-std::array<float,2>{0.677288175f, 0.977506697f},
-std::array<float,2>{0.258683383f, 0.433386564f},
-std::array<float,2>{0.0183642358f, 0.535140753f},
-std::array<float,2>{0.914638937f, 0.106157221f},
-std::array<float,2>{0.754262567f, 0.708168566f},
-std::array<float,2>{0.14717181f, 0.242006212f},
-std::array<float,2>{0.498847514f, 0.774018347f},
-std::array<float,2>{0.550173879f, 0.356307834f},
-std::array<float,2>{0.839368641f, 0.879640102f},
-std::array<float,2>{0.24394621f, 0.463084877f},
-std::array<float,2>{0.429372251f, 0.599273384f},
-std::array<float,2>{0.607268929f, 0.0164901931f},
-std::array<float,2>{0.690651834f, 0.628992796f},
-std::array<float,2>{0.359939128f, 0.171568498f},
-std::array<float,2>{0.104777806f, 0.866196334f},
-std::array<float,2>{0.944029808f, 0.312020749f},
-std::array<float,2>{0.508947492f, 0.789307415f},
-std::array<float,2>{0.440672576f, 0.316861242f},
-std::array<float,2>{0.187166274f, 0.728537679f},
-std::array<float,2>{0.804352641f, 0.201973587f},
-std::array<float,2>{0.882792115f, 0.504309475f},
-std::array<float,2>{0.0338281877f, 0.0791529492f},
-std::array<float,2>{0.302042753f, 0.965443492f},
-std::array<float,2>{0.645564914f, 0.377845138f},
-std::array<float,2>{0.937099755f, 0.953115284f},
-std::array<float,2>{0.0103477295f, 0.393252462f},
-std::array<float,2>{0.26766032f, 0.51663518f},
-std::array<float,2>{0.668458641f, 0.0737212226f},
-std::array<float,2>{0.540070653f, 0.739708126f},
-std::array<float,2>{0.46957022f, 0.209745586f},
-std::array<float,2>{0.133232743f, 0.802846372f},
-std::array<float,2>{0.773629308f, 0.339931339f},
-std::array<float,2>{0.728265941f, 0.845506191f},
-std::array<float,2>{0.332471758f, 0.286505878f},
-std::array<float,2>{0.0635990575f, 0.647889197f},
-std::array<float,2>{0.990903199f, 0.18086414f},
-std::array<float,2>{0.860576093f, 0.611397028f},
-std::array<float,2>{0.197478563f, 0.00291939615f},
-std::array<float,2>{0.389806151f, 0.901734889f},
-std::array<float,2>{0.588341534f, 0.444251776f},
-std::array<float,2>{0.792899966f, 0.752908885f},
-std::array<float,2>{0.169845417f, 0.363286376f},
-std::array<float,2>{0.454180509f, 0.69587636f},
-std::array<float,2>{0.522848785f, 0.231258228f},
-std::array<float,2>{0.636478066f, 0.551929712f},
-std::array<float,2>{0.294940084f, 0.120618388f},
-std::array<float,2>{0.0518043153f, 0.985322773f},
-std::array<float,2>{0.901210129f, 0.410383642f},
-std::array<float,2>{0.62493372f, 0.907265365f},
-std::array<float,2>{0.406672478f, 0.497635305f},
-std::array<float,2>{0.223077253f, 0.580777347f},
-std::array<float,2>{0.822574258f, 0.0427563153f},
-std::array<float,2>{0.967182815f, 0.686854005f},
-std::array<float,2>{0.11042013f, 0.131049648f},
-std::array<float,2>{0.353531867f, 0.836414158f},
-std::array<float,2>{0.711127043f, 0.274459541f},
-std::array<float,2>{0.877674043f, 0.83125174f},
-std::array<float,2>{0.0362151973f, 0.265970469f},
-std::array<float,2>{0.299512923f, 0.673203886f},
-std::array<float,2>{0.642233074f, 0.139123887f},
-std::array<float,2>{0.513170779f, 0.587998211f},
-std::array<float,2>{0.443447828f, 0.0361479521f},
-std::array<float,2>{0.183164567f, 0.916541934f},
-std::array<float,2>{0.797087014f, 0.485760123f},
-std::array<float,2>{0.693537593f, 0.99508214f},
-std::array<float,2>{0.363645464f, 0.417906761f},
-std::array<float,2>{0.109149329f, 0.555983305f},
-std::array<float,2>{0.937678397f, 0.114837289f},
-std::array<float,2>{0.840317369f, 0.694314063f},
-std::array<float,2>{0.24725379f, 0.222842395f},
-std::array<float,2>{0.424542129f, 0.763903916f},
-std::array<float,2>{0.60475558f, 0.370177805f},
-std::array<float,2>{0.752749801f, 0.898374856f},
-std::array<float,2>{0.142237872f, 0.448230416f},
-std::array<float,2>{0.492806226f, 0.620071232f},
-std::array<float,2>{0.551438451f, 0.0116864964f},
-std::array<float,2>{0.675187409f, 0.648774385f},
-std::array<float,2>{0.265539974f, 0.176331982f},
-std::array<float,2>{0.0223997328f, 0.853097081f},
-std::array<float,2>{0.921243668f, 0.294792265f},
-std::array<float,2>{0.563169241f, 0.804994106f},
-std::array<float,2>{0.399342716f, 0.33207643f},
-std::array<float,2>{0.205574855f, 0.748938203f},
-std::array<float,2>{0.847412288f, 0.215241835f},
-std::array<float,2>{0.977492273f, 0.52750355f},
-std::array<float,2>{0.0797962397f, 0.07021828f},
-std::array<float,2>{0.316263616f, 0.944844604f},
-std::array<float,2>{0.743569016f, 0.399295747f},
-std::array<float,2>{0.963917434f, 0.957491875f},
-std::array<float,2>{0.114467598f, 0.389716119f},
-std::array<float,2>{0.357979327f, 0.509478807f},
-std::array<float,2>{0.71569556f, 0.0886743665f},
-std::array<float,2>{0.620749891f, 0.725527465f},
-std::array<float,2>{0.413038254f, 0.193146735f},
-std::array<float,2>{0.218911543f, 0.786357403f},
-std::array<float,2>{0.826583862f, 0.326573253f},
-std::array<float,2>{0.640134156f, 0.874177694f},
-std::array<float,2>{0.289719224f, 0.299342126f},
-std::array<float,2>{0.0485958159f, 0.640502572f},
-std::array<float,2>{0.903589785f, 0.161466658f},
-std::array<float,2>{0.793630183f, 0.605636418f},
-std::array<float,2>{0.167414203f, 0.0307633206f},
-std::array<float,2>{0.46078229f, 0.883565545f},
-std::array<float,2>{0.517887592f, 0.454717547f},
-std::array<float,2>{0.867093444f, 0.770489991f},
-std::array<float,2>{0.200335979f, 0.348834425f},
-std::array<float,2>{0.385175526f, 0.714814663f},
-std::array<float,2>{0.591459215f, 0.247732624f},
-std::array<float,2>{0.733794808f, 0.540763855f},
-std::array<float,2>{0.330817521f, 0.0949360356f},
-std::array<float,2>{0.0684024543f, 0.972298622f},
-std::array<float,2>{0.986427188f, 0.426626742f},
-std::array<float,2>{0.545547545f, 0.930958271f},
-std::array<float,2>{0.473471999f, 0.48051551f},
-std::array<float,2>{0.139678493f, 0.565097988f},
-std::array<float,2>{0.780760288f, 0.058710549f},
-std::array<float,2>{0.929951787f, 0.657277226f},
-std::array<float,2>{0.0125921117f, 0.145584404f},
-std::array<float,2>{0.270774782f, 0.812748134f},
-std::array<float,2>{0.666359246f, 0.256273955f},
-std::array<float,2>{0.99905616f, 0.796103776f},
-std::array<float,2>{0.0747130737f, 0.315600753f},
-std::array<float,2>{0.336661369f, 0.733983397f},
-std::array<float,2>{0.719962418f, 0.197144151f},
-std::array<float,2>{0.583638608f, 0.501925945f},
-std::array<float,2>{0.376801103f, 0.0824393332f},
-std::array<float,2>{0.187630877f, 0.961792946f},
-std::array<float,2>{0.867197394f, 0.381032705f},
-std::array<float,2>{0.657686055f, 0.877173543f},
-std::array<float,2>{0.273875147f, 0.467729568f},
-std::array<float,2>{0.00108599488f, 0.594172955f},
-std::array<float,2>{0.926978528f, 0.0220386107f},
-std::array<float,2>{0.769896388f, 0.627478421f},
-std::array<float,2>{0.128483772f, 0.167069748f},
-std::array<float,2>{0.480972916f, 0.861185491f},
-std::array<float,2>{0.53511852f, 0.306473196f},
-std::array<float,2>{0.81783551f, 0.983211219f},
-std::array<float,2>{0.228731111f, 0.435149759f},
-std::array<float,2>{0.418118119f, 0.536864161f},
-std::array<float,2>{0.61381954f, 0.103437081f},
-std::array<float,2>{0.708072484f, 0.706190646f},
-std::array<float,2>{0.35067597f, 0.236327589f},
-std::array<float,2>{0.120101996f, 0.779963255f},
-std::array<float,2>{0.955358386f, 0.353115588f},
-std::array<float,2>{0.525570214f, 0.827741981f},
-std::array<float,2>{0.464175463f, 0.258141756f},
-std::array<float,2>{0.161750361f, 0.667497098f},
-std::array<float,2>{0.783156633f, 0.152978539f},
-std::array<float,2>{0.894629717f, 0.576051176f},
-std::array<float,2>{0.0570422858f, 0.0487631969f},
-std::array<float,2>{0.287091583f, 0.92331183f},
-std::array<float,2>{0.631147087f, 0.474440902f},
-std::array<float,2>{0.906512439f, 0.912550807f},
-std::array<float,2>{0.0261070095f, 0.494049013f},
-std::array<float,2>{0.254852057f, 0.584976673f},
-std::array<float,2>{0.684684575f, 0.0450736396f},
-std::array<float,2>{0.560173273f, 0.681525469f},
-std::array<float,2>{0.487923414f, 0.12618342f},
-std::array<float,2>{0.155385241f, 0.843334436f},
-std::array<float,2>{0.764370739f, 0.280509323f},
-std::array<float,2>{0.742178619f, 0.757396042f},
-std::array<float,2>{0.324591786f, 0.362077624f},
-std::array<float,2>{0.0872864425f, 0.70078063f},
-std::array<float,2>{0.969154179f, 0.228098512f},
-std::array<float,2>{0.854620159f, 0.548661113f},
-std::array<float,2>{0.218082994f, 0.123386011f},
-std::array<float,2>{0.395653754f, 0.992160797f},
-std::array<float,2>{0.578095496f, 0.407555073f},
-std::array<float,2>{0.810882866f, 0.850609601f},
-std::array<float,2>{0.178221881f, 0.283093065f},
-std::array<float,2>{0.453073263f, 0.640768826f},
-std::array<float,2>{0.501107931f, 0.186160043f},
-std::array<float,2>{0.654230893f, 0.616615891f},
-std::array<float,2>{0.310438126f, 0.00743867364f},
-std::array<float,2>{0.0432435237f, 0.90608567f},
-std::array<float,2>{0.887357652f, 0.439688265f},
-std::array<float,2>{0.598779023f, 0.947958648f},
-std::array<float,2>{0.431496084f, 0.397234946f},
-std::array<float,2>{0.241825894f, 0.520968318f},
-std::array<float,2>{0.834882379f, 0.0771597028f},
-std::array<float,2>{0.94659549f, 0.736915112f},
-std::array<float,2>{0.0951118469f, 0.206147656f},
-std::array<float,2>{0.368219733f, 0.798239708f},
-std::array<float,2>{0.695992351f, 0.339720428f},
-std::array<float,2>{0.922927558f, 0.760417461f},
-std::array<float,2>{0.00507598976f, 0.3744798f},
-std::array<float,2>{0.279071122f, 0.689929366f},
-std::array<float,2>{0.662816763f, 0.221845672f},
-std::array<float,2>{0.538730741f, 0.55927366f},
-std::array<float,2>{0.480147779f, 0.112794071f},
-std::array<float,2>{0.129141659f, 0.999979198f},
-std::array<float,2>{0.765981555f, 0.419937313f},
-std::array<float,2>{0.722713709f, 0.921634972f},
-std::array<float,2>{0.341396362f, 0.491177171f},
-std::array<float,2>{0.0717777982f, 0.591740966f},
-std::array<float,2>{0.994391441f, 0.0331105888f},
-std::array<float,2>{0.873127878f, 0.676725686f},
-std::array<float,2>{0.193706229f, 0.133433715f},
-std::array<float,2>{0.38219437f, 0.833248198f},
-std::array<float,2>{0.580920994f, 0.271585107f},
-std::array<float,2>{0.788897574f, 0.938028991f},
-std::array<float,2>{0.156745553f, 0.405773997f},
-std::array<float,2>{0.468315989f, 0.524349153f},
-std::array<float,2>{0.531225085f, 0.064759858f},
-std::array<float,2>{0.62784344f, 0.746061742f},
-std::array<float,2>{0.284612656f, 0.212883323f},
-std::array<float,2>{0.0611879341f, 0.809504032f},
-std::array<float,2>{0.891787648f, 0.328264236f},
-std::array<float,2>{0.611792684f, 0.856325567f},
-std::array<float,2>{0.416590214f, 0.290839791f},
-std::array<float,2>{0.231590629f, 0.653770745f},
-std::array<float,2>{0.816380024f, 0.173568919f},
-std::array<float,2>{0.960053921f, 0.622916341f},
-std::array<float,2>{0.12289042f, 0.0145612964f},
-std::array<float,2>{0.344153464f, 0.891608596f},
-std::array<float,2>{0.703682244f, 0.451862812f},
-std::array<float,2>{0.974713027f, 0.889825821f},
-std::array<float,2>{0.0906980783f, 0.459686726f},
-std::array<float,2>{0.321429759f, 0.603637934f},
-std::array<float,2>{0.735368311f, 0.026694987f},
-std::array<float,2>{0.573204339f, 0.634321451f},
-std::array<float,2>{0.391207516f, 0.157460406f},
-std::array<float,2>{0.210975841f, 0.869378567f},
-std::array<float,2>{0.857432723f, 0.302570432f},
-std::array<float,2>{0.682835817f, 0.783519864f},
-std::array<float,2>{0.250671476f, 0.322011471f},
-std::array<float,2>{0.0280209854f, 0.722271383f},
-std::array<float,2>{0.912436485f, 0.187975734f},
-std::array<float,2>{0.759495735f, 0.514761329f},
-std::array<float,2>{0.150799409f, 0.0935226753f},
-std::array<float,2>{0.491229832f, 0.953160286f},
-std::array<float,2>{0.557593346f, 0.384147972f},
-std::array<float,2>{0.829176426f, 0.818164825f},
-std::array<float,2>{0.236985281f, 0.250943601f},
-std::array<float,2>{0.436862558f, 0.661864758f},
-std::array<float,2>{0.595852554f, 0.141045779f},
-std::array<float,2>{0.700178862f, 0.569028199f},
-std::array<float,2>{0.371736318f, 0.0558937937f},
-std::array<float,2>{0.100225046f, 0.936574936f},
-std::array<float,2>{0.952359378f, 0.480107605f},
-std::array<float,2>{0.505479813f, 0.976054013f},
-std::array<float,2>{0.448199302f, 0.422028244f},
-std::array<float,2>{0.174770474f, 0.54665637f},
-std::array<float,2>{0.806130946f, 0.0983651131f},
-std::array<float,2>{0.884119809f, 0.715471685f},
-std::array<float,2>{0.0405144729f, 0.243995383f},
-std::array<float,2>{0.305794418f, 0.76779896f},
-std::array<float,2>{0.649449766f, 0.345190972f},
-std::array<float,2>{0.941407621f, 0.864147842f},
-std::array<float,2>{0.102927014f, 0.310337722f},
-std::array<float,2>{0.362968802f, 0.631777823f},
-std::array<float,2>{0.687579393f, 0.169110566f},
-std::array<float,2>{0.608217955f, 0.601338029f},
-std::array<float,2>{0.425855398f, 0.0183554795f},
-std::array<float,2>{0.246018767f, 0.881073236f},
-std::array<float,2>{0.837640882f, 0.461404294f},
-std::array<float,2>{0.648181498f, 0.968604922f},
-std::array<float,2>{0.303257644f, 0.375336081f},
-std::array<float,2>{0.0328018889f, 0.507369161f},
-std::array<float,2>{0.880472124f, 0.0809769481f},
-std::array<float,2>{0.80093205f, 0.728029728f},
-std::array<float,2>{0.183852986f, 0.199802637f},
-std::array<float,2>{0.437793791f, 0.791043639f},
-std::array<float,2>{0.510144651f, 0.318431735f},
-std::array<float,2>{0.849243581f, 0.928099334f},
-std::array<float,2>{0.207660496f, 0.470119029f},
-std::array<float,2>{0.403235108f, 0.572909117f},
-std::array<float,2>{0.569283664f, 0.0531704091f},
-std::array<float,2>{0.746956825f, 0.669702709f},
-std::array<float,2>{0.318677187f, 0.149807543f},
-std::array<float,2>{0.0836066082f, 0.822004199f},
-std::array<float,2>{0.982152045f, 0.262084931f},
-std::array<float,2>{0.547756195f, 0.776107311f},
-std::array<float,2>{0.496986747f, 0.359198213f},
-std::array<float,2>{0.145740852f, 0.710579157f},
-std::array<float,2>{0.755893886f, 0.238348901f},
-std::array<float,2>{0.917373478f, 0.53126508f},
-std::array<float,2>{0.015848875f, 0.107933313f},
-std::array<float,2>{0.260337323f, 0.978620172f},
-std::array<float,2>{0.679173648f, 0.431572556f},
-std::array<float,2>{0.899479806f, 0.987353981f},
-std::array<float,2>{0.0528715216f, 0.413450718f},
-std::array<float,2>{0.294609517f, 0.55307281f},
-std::array<float,2>{0.633145869f, 0.118856713f},
-std::array<float,2>{0.520713925f, 0.69858408f},
-std::array<float,2>{0.455342114f, 0.232970253f},
-std::array<float,2>{0.171717688f, 0.751839161f},
-std::array<float,2>{0.789394975f, 0.36557579f},
-std::array<float,2>{0.713893175f, 0.838597238f},
-std::array<float,2>{0.351867229f, 0.275394291f},
-std::array<float,2>{0.112410329f, 0.685208738f},
-std::array<float,2>{0.966059506f, 0.129504293f},
-std::array<float,2>{0.821751773f, 0.579665244f},
-std::array<float,2>{0.224985912f, 0.0401479192f},
-std::array<float,2>{0.408935577f, 0.909406185f},
-std::array<float,2>{0.622943819f, 0.498822659f},
-std::array<float,2>{0.777314782f, 0.802168131f},
-std::array<float,2>{0.136197001f, 0.343337446f},
-std::array<float,2>{0.470966339f, 0.740461588f},
-std::array<float,2>{0.541969597f, 0.208151937f},
-std::array<float,2>{0.670531929f, 0.519217372f},
-std::array<float,2>{0.266518384f, 0.0717339963f},
-std::array<float,2>{0.00895222463f, 0.949672878f},
-std::array<float,2>{0.93551439f, 0.391823322f},
-std::array<float,2>{0.586466253f, 0.899935544f},
-std::array<float,2>{0.386725724f, 0.442885965f},
-std::array<float,2>{0.197230741f, 0.611300647f},
-std::array<float,2>{0.861525834f, 0.00105361384f},
-std::array<float,2>{0.989300609f, 0.645013034f},
-std::array<float,2>{0.064479813f, 0.182165354f},
-std::array<float,2>{0.335737437f, 0.846698165f},
-std::array<float,2>{0.730304778f, 0.287811577f},
-std::array<float,2>{0.88078022f, 0.866717994f},
-std::array<float,2>{0.0331855193f, 0.311014175f},
-std::array<float,2>{0.30360195f, 0.630272686f},
-std::array<float,2>{0.648301005f, 0.170482755f},
-std::array<float,2>{0.509971559f, 0.598433316f},
-std::array<float,2>{0.437701315f, 0.0170051083f},
-std::array<float,2>{0.183641598f, 0.880059898f},
-std::array<float,2>{0.801164269f, 0.464692295f},
-std::array<float,2>{0.687913477f, 0.966404498f},
-std::array<float,2>{0.363089234f, 0.378585905f},
-std::array<float,2>{0.102720223f, 0.505782843f},
-std::array<float,2>{0.94176352f, 0.078500241f},
-std::array<float,2>{0.837722063f, 0.729524493f},
-std::array<float,2>{0.245631188f, 0.2021745f},
-std::array<float,2>{0.426067114f, 0.790128112f},
-std::array<float,2>{0.608020961f, 0.318325877f},
-std::array<float,2>{0.756309748f, 0.927713752f},
-std::array<float,2>{0.145904377f, 0.472440451f},
-std::array<float,2>{0.496634901f, 0.571733296f},
-std::array<float,2>{0.547470629f, 0.0510870516f},
-std::array<float,2>{0.67874372f, 0.671590507f},
-std::array<float,2>{0.260569692f, 0.151844904f},
-std::array<float,2>{0.0160242394f, 0.822380245f},
-std::array<float,2>{0.917023838f, 0.265163839f},
-std::array<float,2>{0.568918347f, 0.774817705f},
-std::array<float,2>{0.402837455f, 0.35730198f},
-std::array<float,2>{0.207843319f, 0.707480967f},
-std::array<float,2>{0.849392235f, 0.241071999f},
-std::array<float,2>{0.982273579f, 0.533441067f},
-std::array<float,2>{0.0837724954f, 0.107393809f},
-std::array<float,2>{0.318602204f, 0.977784574f},
-std::array<float,2>{0.746679962f, 0.432286739f},
-std::array<float,2>{0.966273546f, 0.985773623f},
-std::array<float,2>{0.112664275f, 0.411747903f},
-std::array<float,2>{0.351735085f, 0.551620603f},
-std::array<float,2>{0.714344859f, 0.119572088f},
-std::array<float,2>{0.62262094f, 0.696941435f},
-std::array<float,2>{0.408750117f, 0.231874779f},
-std::array<float,2>{0.224626437f, 0.753318429f},
-std::array<float,2>{0.821300507f, 0.364982873f},
-std::array<float,2>{0.632965803f, 0.83782655f},
-std::array<float,2>{0.294893533f, 0.27349624f},
-std::array<float,2>{0.0530028678f, 0.68564707f},
-std::array<float,2>{0.899782836f, 0.131870598f},
-std::array<float,2>{0.789272845f, 0.581321716f},
-std::array<float,2>{0.171554849f, 0.0413562283f},
-std::array<float,2>{0.455268621f, 0.907051563f},
-std::array<float,2>{0.520852447f, 0.496717781f},
-std::array<float,2>{0.86164248f, 0.804459572f},
-std::array<float,2>{0.19686994f, 0.340987921f},
-std::array<float,2>{0.387186825f, 0.738581836f},
-std::array<float,2>{0.586906791f, 0.210636571f},
-std::array<float,2>{0.730187416f, 0.516219914f},
-std::array<float,2>{0.335478634f, 0.07233309f},
-std::array<float,2>{0.0649199188f, 0.951517582f},
-std::array<float,2>{0.989595354f, 0.393628597f},
-std::array<float,2>{0.541534781f, 0.900417507f},
-std::array<float,2>{0.470906228f, 0.445141375f},
-std::array<float,2>{0.135943383f, 0.613166094f},
-std::array<float,2>{0.776925027f, 0.00389580242f},
-std::array<float,2>{0.935225964f, 0.647209346f},
-std::array<float,2>{0.00911303703f, 0.180304393f},
-std::array<float,2>{0.26622349f, 0.84429723f},
-std::array<float,2>{0.670727432f, 0.286074936f},
-std::array<float,2>{0.994357347f, 0.758228242f},
-std::array<float,2>{0.0720859692f, 0.371979445f},
-std::array<float,2>{0.34156242f, 0.689397812f},
-std::array<float,2>{0.722902656f, 0.219437838f},
-std::array<float,2>{0.580753505f, 0.561346054f},
-std::array<float,2>{0.382068485f, 0.10970021f},
-std::array<float,2>{0.193384126f, 0.997043967f},
-std::array<float,2>{0.873314917f, 0.418519467f},
-std::array<float,2>{0.662949741f, 0.919082522f},
-std::array<float,2>{0.279018134f, 0.489915192f},
-std::array<float,2>{0.00534245092f, 0.593212306f},
-std::array<float,2>{0.923208535f, 0.0338053219f},
-std::array<float,2>{0.765706718f, 0.679284573f},
-std::array<float,2>{0.129302457f, 0.135568678f},
-std::array<float,2>{0.480295539f, 0.835855424f},
-std::array<float,2>{0.538932681f, 0.270861685f},
-std::array<float,2>{0.815942049f, 0.94032675f},
-std::array<float,2>{0.231918573f, 0.402766615f},
-std::array<float,2>{0.416769981f, 0.527163982f},
-std::array<float,2>{0.611502647f, 0.0631235316f},
-std::array<float,2>{0.704033315f, 0.743816018f},
-std::array<float,2>{0.343809992f, 0.213196263f},
-std::array<float,2>{0.122727461f, 0.81164211f},
-std::array<float,2>{0.960360765f, 0.331264496f},
-std::array<float,2>{0.530985534f, 0.858262897f},
-std::array<float,2>{0.468576014f, 0.291458994f},
-std::array<float,2>{0.157211155f, 0.65468806f},
-std::array<float,2>{0.788651764f, 0.174740896f},
-std::array<float,2>{0.891879439f, 0.624013186f},
-std::array<float,2>{0.061451517f, 0.0131701073f},
-std::array<float,2>{0.284294695f, 0.8938061f},
-std::array<float,2>{0.627602398f, 0.449360609f},
-std::array<float,2>{0.912173808f, 0.887988389f},
-std::array<float,2>{0.0283197071f, 0.458249301f},
-std::array<float,2>{0.250868857f, 0.603132904f},
-std::array<float,2>{0.6830042f, 0.0237898901f},
-std::array<float,2>{0.557257831f, 0.636672199f},
-std::array<float,2>{0.491556525f, 0.158474237f},
-std::array<float,2>{0.150439933f, 0.868832648f},
-std::array<float,2>{0.759612381f, 0.302914649f},
-std::array<float,2>{0.735812962f, 0.781375051f},
-std::array<float,2>{0.321607083f, 0.323124379f},
-std::array<float,2>{0.0905661508f, 0.719060421f},
-std::array<float,2>{0.975059509f, 0.19010666f},
-std::array<float,2>{0.857870162f, 0.512720644f},
-std::array<float,2>{0.211303383f, 0.0900483653f},
-std::array<float,2>{0.3913607f, 0.95685333f},
-std::array<float,2>{0.572914243f, 0.385787874f},
-std::array<float,2>{0.805871069f, 0.818900585f},
-std::array<float,2>{0.174318701f, 0.253630489f},
-std::array<float,2>{0.447997749f, 0.663230777f},
-std::array<float,2>{0.50574559f, 0.14275296f},
-std::array<float,2>{0.649771273f, 0.567884028f},
-std::array<float,2>{0.306107432f, 0.0579158515f},
-std::array<float,2>{0.0401788019f, 0.934948206f},
-std::array<float,2>{0.883965671f, 0.476784706f},
-std::array<float,2>{0.596167684f, 0.973631024f},
-std::array<float,2>{0.4366934f, 0.424807966f},
-std::array<float,2>{0.237239346f, 0.542998135f},
-std::array<float,2>{0.829512954f, 0.0996461585f},
-std::array<float,2>{0.952603161f, 0.717445612f},
-std::array<float,2>{0.100430913f, 0.245798543f},
-std::array<float,2>{0.371925861f, 0.766963303f},
-std::array<float,2>{0.699764252f, 0.347093612f},
-std::array<float,2>{0.927212715f, 0.79456073f},
-std::array<float,2>{0.00135269377f, 0.312575519f},
-std::array<float,2>{0.273440301f, 0.730994821f},
-std::array<float,2>{0.657251f, 0.197666109f},
-std::array<float,2>{0.534846544f, 0.503087163f},
-std::array<float,2>{0.481215835f, 0.0847520828f},
-std::array<float,2>{0.128757238f, 0.964525282f},
-std::array<float,2>{0.769587517f, 0.380220294f},
-std::array<float,2>{0.720182836f, 0.875398695f},
-std::array<float,2>{0.336783201f, 0.465301543f},
-std::array<float,2>{0.0750526115f, 0.596172512f},
-std::array<float,2>{0.999497592f, 0.0199379064f},
-std::array<float,2>{0.867664337f, 0.62542963f},
-std::array<float,2>{0.187895685f, 0.164489716f},
-std::array<float,2>{0.376630247f, 0.861436784f},
-std::array<float,2>{0.583783567f, 0.306811303f},
-std::array<float,2>{0.782845736f, 0.981665492f},
-std::array<float,2>{0.161960885f, 0.437066585f},
-std::array<float,2>{0.463883132f, 0.538027406f},
-std::array<float,2>{0.525800347f, 0.104793295f},
-std::array<float,2>{0.631073117f, 0.703323066f},
-std::array<float,2>{0.286743939f, 0.236539841f},
-std::array<float,2>{0.0567904264f, 0.777627528f},
-std::array<float,2>{0.894924819f, 0.35451442f},
-std::array<float,2>{0.614056051f, 0.824970782f},
-std::array<float,2>{0.418456525f, 0.261518717f},
-std::array<float,2>{0.228896037f, 0.665051281f},
-std::array<float,2>{0.817553103f, 0.156205505f},
-std::array<float,2>{0.955192804f, 0.577068627f},
-std::array<float,2>{0.119785003f, 0.0489932671f},
-std::array<float,2>{0.350854605f, 0.924706161f},
-std::array<float,2>{0.708387375f, 0.474925876f},
-std::array<float,2>{0.968905032f, 0.911480129f},
-std::array<float,2>{0.0869769678f, 0.495235443f},
-std::array<float,2>{0.324314296f, 0.583880246f},
-std::array<float,2>{0.741888642f, 0.0439725965f},
-std::array<float,2>{0.57773751f, 0.683262944f},
-std::array<float,2>{0.395859092f, 0.127334669f},
-std::array<float,2>{0.217989758f, 0.840007722f},
-std::array<float,2>{0.854742706f, 0.278794259f},
-std::array<float,2>{0.684945166f, 0.755564034f},
-std::array<float,2>{0.254558146f, 0.361223608f},
-std::array<float,2>{0.0261426698f, 0.701663077f},
-std::array<float,2>{0.906338871f, 0.228824258f},
-std::array<float,2>{0.76460886f, 0.549324214f},
-std::array<float,2>{0.155741528f, 0.1229202f},
-std::array<float,2>{0.488187134f, 0.988597333f},
-std::array<float,2>{0.560443938f, 0.40920791f},
-std::array<float,2>{0.834655643f, 0.848627925f},
-std::array<float,2>{0.242068902f, 0.283217549f},
-std::array<float,2>{0.431248009f, 0.642658353f},
-std::array<float,2>{0.598944664f, 0.185543969f},
-std::array<float,2>{0.696127415f, 0.614095211f},
-std::array<float,2>{0.368479759f, 0.00566738192f},
-std::array<float,2>{0.0948581919f, 0.902803421f},
-std::array<float,2>{0.946377754f, 0.438001871f},
-std::array<float,2>{0.501353443f, 0.947099268f},
-std::array<float,2>{0.452810645f, 0.39534536f},
-std::array<float,2>{0.177789301f, 0.522973061f},
-std::array<float,2>{0.810547173f, 0.0749218762f},
-std::array<float,2>{0.887637079f, 0.736214221f},
-std::array<float,2>{0.0431843437f, 0.204766884f},
-std::array<float,2>{0.310287833f, 0.799318373f},
-std::array<float,2>{0.653873384f, 0.336641192f},
-std::array<float,2>{0.93778789f, 0.828493059f},
-std::array<float,2>{0.109039433f, 0.267585695f},
-std::array<float,2>{0.363424063f, 0.674108565f},
-std::array<float,2>{0.693681121f, 0.137840062f},
-std::array<float,2>{0.604556143f, 0.586022675f},
-std::array<float,2>{0.424782902f, 0.0372890756f},
-std::array<float,2>{0.247455373f, 0.915044546f},
-std::array<float,2>{0.839977264f, 0.487744153f},
-std::array<float,2>{0.642375886f, 0.993754923f},
-std::array<float,2>{0.299729973f, 0.415931642f},
-std::array<float,2>{0.0366125517f, 0.557585418f},
-std::array<float,2>{0.877799034f, 0.116865598f},
-std::array<float,2>{0.797341645f, 0.692664266f},
-std::array<float,2>{0.183480904f, 0.22583726f},
-std::array<float,2>{0.443652838f, 0.762723267f},
-std::array<float,2>{0.51283145f, 0.367567152f},
-std::array<float,2>{0.847302854f, 0.895443857f},
-std::array<float,2>{0.205858767f, 0.445645899f},
-std::array<float,2>{0.3990587f, 0.618014276f},
-std::array<float,2>{0.56329304f, 0.00840051007f},
-std::array<float,2>{0.743284762f, 0.650710285f},
-std::array<float,2>{0.315963596f, 0.179212183f},
-std::array<float,2>{0.0798439607f, 0.853660226f},
-std::array<float,2>{0.977249682f, 0.296150208f},
-std::array<float,2>{0.551557243f, 0.8083992f},
-std::array<float,2>{0.4929398f, 0.334507018f},
-std::array<float,2>{0.142554909f, 0.746204555f},
-std::array<float,2>{0.752465367f, 0.217169195f},
-std::array<float,2>{0.921010137f, 0.529879808f},
-std::array<float,2>{0.0222161692f, 0.0669614971f},
-std::array<float,2>{0.265237659f, 0.941576898f},
-std::array<float,2>{0.674886286f, 0.401205808f},
-std::array<float,2>{0.903357327f, 0.95977962f},
-std::array<float,2>{0.0484235063f, 0.387375921f},
-std::array<float,2>{0.289832801f, 0.510337055f},
-std::array<float,2>{0.639775813f, 0.0872398987f},
-std::array<float,2>{0.517782986f, 0.72447753f},
-std::array<float,2>{0.460664839f, 0.193587512f},
-std::array<float,2>{0.167142525f, 0.788334548f},
-std::array<float,2>{0.793910205f, 0.324747235f},
-std::array<float,2>{0.715522528f, 0.871646166f},
-std::array<float,2>{0.358201653f, 0.298295587f},
-std::array<float,2>{0.114659436f, 0.638038337f},
-std::array<float,2>{0.964286745f, 0.16361694f},
-std::array<float,2>{0.826201975f, 0.609153271f},
-std::array<float,2>{0.219043776f, 0.0286735445f},
-std::array<float,2>{0.412818283f, 0.886602461f},
-std::array<float,2>{0.620936871f, 0.456284404f},
-std::array<float,2>{0.780451179f, 0.773079216f},
-std::array<float,2>{0.140025064f, 0.35131672f},
-std::array<float,2>{0.473323673f, 0.711653352f},
-std::array<float,2>{0.545772791f, 0.248909444f},
-std::array<float,2>{0.666191518f, 0.542797029f},
-std::array<float,2>{0.270741373f, 0.0967736468f},
-std::array<float,2>{0.0122672543f, 0.969647765f},
-std::array<float,2>{0.929718375f, 0.428905368f},
-std::array<float,2>{0.591627002f, 0.933146238f},
-std::array<float,2>{0.384879351f, 0.484321326f},
-std::array<float,2>{0.200661764f, 0.563697457f},
-std::array<float,2>{0.866905451f, 0.0616192408f},
-std::array<float,2>{0.986805022f, 0.659581363f},
-std::array<float,2>{0.0687843189f, 0.148089901f},
-std::array<float,2>{0.3306247f, 0.814852059f},
-std::array<float,2>{0.733553648f, 0.255105555f},
-std::array<float,2>{0.914936543f, 0.820553303f},
-std::array<float,2>{0.0181564949f, 0.263032377f},
-std::array<float,2>{0.258384854f, 0.668068767f},
-std::array<float,2>{0.677699506f, 0.148788095f},
-std::array<float,2>{0.549991131f, 0.573457479f},
-std::array<float,2>{0.498617113f, 0.0542878248f},
-std::array<float,2>{0.147307307f, 0.929299176f},
-std::array<float,2>{0.754058838f, 0.469012707f},
-std::array<float,2>{0.748394191f, 0.979864538f},
-std::array<float,2>{0.317617327f, 0.429980218f},
-std::array<float,2>{0.0854561478f, 0.532693446f},
-std::array<float,2>{0.983825386f, 0.108977318f},
-std::array<float,2>{0.849610209f, 0.70977658f},
-std::array<float,2>{0.210250601f, 0.239560783f},
-std::array<float,2>{0.405491769f, 0.776522279f},
-std::array<float,2>{0.566416383f, 0.358190149f},
-std::array<float,2>{0.804553926f, 0.882080674f},
-std::array<float,2>{0.187274531f, 0.462116212f},
-std::array<float,2>{0.440839618f, 0.600140214f},
-std::array<float,2>{0.509224117f, 0.019051183f},
-std::array<float,2>{0.645981193f, 0.632319152f},
-std::array<float,2>{0.30192709f, 0.168623388f},
-std::array<float,2>{0.0341753364f, 0.864326179f},
-std::array<float,2>{0.882545233f, 0.30864194f},
-std::array<float,2>{0.607004762f, 0.792457044f},
-std::array<float,2>{0.429544926f, 0.319533825f},
-std::array<float,2>{0.243793949f, 0.726734281f},
-std::array<float,2>{0.839738369f, 0.200972468f},
-std::array<float,2>{0.94428736f, 0.506622434f},
-std::array<float,2>{0.104591891f, 0.0813951939f},
-std::array<float,2>{0.360349268f, 0.967238247f},
-std::array<float,2>{0.690754712f, 0.376729757f},
-std::array<float,2>{0.990998983f, 0.95097822f},
-std::array<float,2>{0.063779518f, 0.390780449f},
-std::array<float,2>{0.332229018f, 0.517782032f},
-std::array<float,2>{0.728373289f, 0.071015574f},
-std::array<float,2>{0.588090241f, 0.741733968f},
-std::array<float,2>{0.390056491f, 0.207538426f},
-std::array<float,2>{0.197680011f, 0.800999761f},
-std::array<float,2>{0.860832691f, 0.341960609f},
-std::array<float,2>{0.668890178f, 0.846612751f},
-std::array<float,2>{0.268043905f, 0.288724393f},
-std::array<float,2>{0.0105297007f, 0.64623636f},
-std::array<float,2>{0.937489033f, 0.183208555f},
-std::array<float,2>{0.773771167f, 0.60938859f},
-std::array<float,2>{0.133021444f, 0.000215830441f},
-std::array<float,2>{0.469249666f, 0.898453593f},
-std::array<float,2>{0.540316761f, 0.44148621f},
-std::array<float,2>{0.822357833f, 0.75056684f},
-std::array<float,2>{0.222856462f, 0.366927922f},
-std::array<float,2>{0.406250924f, 0.697791696f},
-std::array<float,2>{0.624750078f, 0.233709455f},
-std::array<float,2>{0.711270154f, 0.5540483f},
-std::array<float,2>{0.353925258f, 0.117734626f},
-std::array<float,2>{0.110777318f, 0.986544192f},
-std::array<float,2>{0.966990411f, 0.41219604f},
-std::array<float,2>{0.522487938f, 0.908915639f},
-std::array<float,2>{0.454491496f, 0.499545157f},
-std::array<float,2>{0.16951412f, 0.578408003f},
-std::array<float,2>{0.792671263f, 0.039360784f},
-std::array<float,2>{0.900929332f, 0.684471846f},
-std::array<float,2>{0.0522123389f, 0.130079851f},
-std::array<float,2>{0.295344651f, 0.838868678f},
-std::array<float,2>{0.636286736f, 0.277329117f},
-std::array<float,2>{0.957244456f, 0.809761643f},
-std::array<float,2>{0.123595893f, 0.329807758f},
-std::array<float,2>{0.345795989f, 0.744762003f},
-std::array<float,2>{0.706114411f, 0.211222321f},
-std::array<float,2>{0.610827267f, 0.525186419f},
-std::array<float,2>{0.415457487f, 0.0654920489f},
-std::array<float,2>{0.233408973f, 0.938601136f},
-std::array<float,2>{0.814153731f, 0.404579788f},
-std::array<float,2>{0.625444472f, 0.891595006f},
-std::array<float,2>{0.281871736f, 0.452331871f},
-std::array<float,2>{0.0598034598f, 0.621534407f},
-std::array<float,2>{0.893164635f, 0.0153038986f},
-std::array<float,2>{0.787089467f, 0.652914166f},
-std::array<float,2>{0.158533588f, 0.172092021f},
-std::array<float,2>{0.466484606f, 0.856903553f},
-std::array<float,2>{0.527666569f, 0.2897017f},
-std::array<float,2>{0.871773481f, 0.998697579f},
-std::array<float,2>{0.192872807f, 0.42093417f},
-std::array<float,2>{0.380267799f, 0.559605002f},
-std::array<float,2>{0.578239799f, 0.112102024f},
-std::array<float,2>{0.726093888f, 0.691093743f},
-std::array<float,2>{0.342195421f, 0.221053824f},
-std::array<float,2>{0.0731039122f, 0.761104405f},
-std::array<float,2>{0.992823362f, 0.373854578f},
-std::array<float,2>{0.536979377f, 0.832097292f},
-std::array<float,2>{0.477669805f, 0.273364276f},
-std::array<float,2>{0.1321363f, 0.677193403f},
-std::array<float,2>{0.769175768f, 0.134627059f},
-std::array<float,2>{0.924037516f, 0.590442002f},
-std::array<float,2>{0.00658749649f, 0.0321994908f},
-std::array<float,2>{0.28086403f, 0.920639932f},
-std::array<float,2>{0.661889851f, 0.491755694f},
-std::array<float,2>{0.886543274f, 0.936238945f},
-std::array<float,2>{0.0410441235f, 0.478907466f},
-std::array<float,2>{0.307233453f, 0.569683135f},
-std::array<float,2>{0.651107073f, 0.0553628504f},
-std::array<float,2>{0.507770479f, 0.660415053f},
-std::array<float,2>{0.445843279f, 0.14170368f},
-std::array<float,2>{0.172088549f, 0.816659212f},
-std::array<float,2>{0.807149291f, 0.251549423f},
-std::array<float,2>{0.702295184f, 0.769519567f},
-std::array<float,2>{0.374821991f, 0.343966305f},
-std::array<float,2>{0.0981287211f, 0.71615088f},
-std::array<float,2>{0.950822592f, 0.242474556f},
-std::array<float,2>{0.830300927f, 0.5452438f},
-std::array<float,2>{0.234378323f, 0.0986885577f},
-std::array<float,2>{0.435500681f, 0.975134909f},
-std::array<float,2>{0.593898892f, 0.423719466f},
-std::array<float,2>{0.760709643f, 0.87027055f},
-std::array<float,2>{0.148670107f, 0.301156402f},
-std::array<float,2>{0.489110351f, 0.633730948f},
-std::array<float,2>{0.555883229f, 0.156838477f},
-std::array<float,2>{0.680909455f, 0.605067015f},
-std::array<float,2>{0.25385496f, 0.0260732956f},
-std::array<float,2>{0.0307341032f, 0.88954556f},
-std::array<float,2>{0.911917984f, 0.460746139f},
-std::array<float,2>{0.571581662f, 0.954955399f},
-std::array<float,2>{0.394369751f, 0.383507162f},
-std::array<float,2>{0.213194221f, 0.514198124f},
-std::array<float,2>{0.856904447f, 0.0925546736f},
-std::array<float,2>{0.973601937f, 0.721219659f},
-std::array<float,2>{0.0930997133f, 0.189419746f},
-std::array<float,2>{0.323598325f, 0.78483355f},
-std::array<float,2>{0.738045692f, 0.321151882f},
-std::array<float,2>{0.898114145f, 0.78051281f},
-std::array<float,2>{0.0561638027f, 0.352145404f},
-std::array<float,2>{0.288749993f, 0.70528084f},
-std::array<float,2>{0.630306482f, 0.234984338f},
-std::array<float,2>{0.524433613f, 0.535486758f},
-std::array<float,2>{0.461947203f, 0.102346867f},
-std::array<float,2>{0.163283616f, 0.984176517f},
-std::array<float,2>{0.783814609f, 0.433854938f},
-std::array<float,2>{0.709276438f, 0.921894193f},
-std::array<float,2>{0.348124623f, 0.472959042f},
-std::array<float,2>{0.118244059f, 0.574533343f},
-std::array<float,2>{0.953976333f, 0.0468832403f},
-std::array<float,2>{0.819474638f, 0.666039884f},
-std::array<float,2>{0.227485195f, 0.153843597f},
-std::array<float,2>{0.420705765f, 0.826874852f},
-std::array<float,2>{0.616492271f, 0.259655923f},
-std::array<float,2>{0.773238122f, 0.962813854f},
-std::array<float,2>{0.125725567f, 0.382217109f},
-std::array<float,2>{0.48414737f, 0.500820696f},
-std::array<float,2>{0.532582998f, 0.0839328244f},
-std::array<float,2>{0.65945816f, 0.732481539f},
-std::array<float,2>{0.276811004f, 0.195415825f},
-std::array<float,2>{0.00275212154f, 0.795226038f},
-std::array<float,2>{0.928452432f, 0.315045804f},
-std::array<float,2>{0.585188448f, 0.859604657f},
-std::array<float,2>{0.377776146f, 0.305236459f},
-std::array<float,2>{0.190473273f, 0.628790736f},
-std::array<float,2>{0.870986044f, 0.166244149f},
-std::array<float,2>{0.996435702f, 0.59566766f},
-std::array<float,2>{0.0773802176f, 0.0226526111f},
-std::array<float,2>{0.337944448f, 0.878717959f},
-std::array<float,2>{0.72152859f, 0.468075663f},
-std::array<float,2>{0.94863385f, 0.904658973f},
-std::array<float,2>{0.096585907f, 0.44093588f},
-std::array<float,2>{0.370072573f, 0.61607796f},
-std::array<float,2>{0.69767642f, 0.00643105805f},
-std::array<float,2>{0.600362182f, 0.641673505f},
-std::array<float,2>{0.43329373f, 0.187197685f},
-std::array<float,2>{0.23979491f, 0.850495696f},
-std::array<float,2>{0.833654821f, 0.281689703f},
-std::array<float,2>{0.656208277f, 0.79759872f},
-std::array<float,2>{0.311012894f, 0.338653177f},
-std::array<float,2>{0.0457616672f, 0.737967908f},
-std::array<float,2>{0.888810635f, 0.205534428f},
-std::array<float,2>{0.808861613f, 0.51994586f},
-std::array<float,2>{0.177250355f, 0.0768188834f},
-std::array<float,2>{0.450134814f, 0.948981106f},
-std::array<float,2>{0.503336012f, 0.397628725f},
-std::array<float,2>{0.851653039f, 0.84212929f},
-std::array<float,2>{0.216629088f, 0.27930674f},
-std::array<float,2>{0.396846265f, 0.680065811f},
-std::array<float,2>{0.574694753f, 0.125354245f},
-std::array<float,2>{0.738579333f, 0.584519148f},
-std::array<float,2>{0.327911437f, 0.0463663191f},
-std::array<float,2>{0.0897816122f, 0.913530231f},
-std::array<float,2>{0.971591532f, 0.492405117f},
-std::array<float,2>{0.561419129f, 0.990577877f},
-std::array<float,2>{0.486260623f, 0.406537056f},
-std::array<float,2>{0.152529642f, 0.547300041f},
-std::array<float,2>{0.762972474f, 0.124627061f},
-std::array<float,2>{0.909157574f, 0.699619889f},
-std::array<float,2>{0.0247828942f, 0.227190435f},
-std::array<float,2>{0.256837785f, 0.756466389f},
-std::array<float,2>{0.685739756f, 0.362921715f},
-std::array<float,2>{0.979122221f, 0.851970255f},
-std::array<float,2>{0.0816201121f, 0.293383956f},
-std::array<float,2>{0.314275861f, 0.650155187f},
-std::array<float,2>{0.744883418f, 0.176865384f},
-std::array<float,2>{0.564647496f, 0.620644808f},
-std::array<float,2>{0.401903749f, 0.0100314338f},
-std::array<float,2>{0.203921944f, 0.897049844f},
-std::array<float,2>{0.844125032f, 0.448731452f},
-std::array<float,2>{0.672250092f, 0.943490624f},
-std::array<float,2>{0.262471527f, 0.40003109f},
-std::array<float,2>{0.0204898547f, 0.528406143f},
-std::array<float,2>{0.918061316f, 0.0687139034f},
-std::array<float,2>{0.751455665f, 0.74965781f},
-std::array<float,2>{0.144304678f, 0.216023535f},
-std::array<float,2>{0.495049894f, 0.805737555f},
-std::array<float,2>{0.553947568f, 0.333625466f},
-std::array<float,2>{0.842090189f, 0.91732651f},
-std::array<float,2>{0.249147415f, 0.484805614f},
-std::array<float,2>{0.421910256f, 0.58937794f},
-std::array<float,2>{0.602552593f, 0.0359915458f},
-std::array<float,2>{0.691714466f, 0.672745585f},
-std::array<float,2>{0.365633249f, 0.140332162f},
-std::array<float,2>{0.10620898f, 0.830433786f},
-std::array<float,2>{0.940435827f, 0.266762972f},
-std::array<float,2>{0.514348149f, 0.764969707f},
-std::array<float,2>{0.442152917f, 0.369191021f},
-std::array<float,2>{0.180309951f, 0.694960833f},
-std::array<float,2>{0.7991032f, 0.224492803f},
-std::array<float,2>{0.875972331f, 0.554869533f},
-std::array<float,2>{0.0384059809f, 0.113521248f},
-std::array<float,2>{0.29837966f, 0.995929003f},
-std::array<float,2>{0.642626762f, 0.416856557f},
-std::array<float,2>{0.933436155f, 0.971081555f},
-std::array<float,2>{0.0142023554f, 0.427582204f},
-std::array<float,2>{0.273061097f, 0.539218068f},
-std::array<float,2>{0.664263606f, 0.0938749164f},
-std::array<float,2>{0.543742716f, 0.713595212f},
-std::array<float,2>{0.475849032f, 0.246835336f},
-std::array<float,2>{0.137567744f, 0.771134555f},
-std::array<float,2>{0.778223336f, 0.348632097f},
-std::array<float,2>{0.731616139f, 0.814014256f},
-std::array<float,2>{0.329504222f, 0.257513553f},
-std::array<float,2>{0.0664778277f, 0.656550109f},
-std::array<float,2>{0.985978603f, 0.144644633f},
-std::array<float,2>{0.865098059f, 0.565939486f},
-std::array<float,2>{0.203001723f, 0.0601736903f},
-std::array<float,2>{0.383293897f, 0.930354416f},
-std::array<float,2>{0.593527853f, 0.482322663f},
-std::array<float,2>{0.796193957f, 0.785929918f},
-std::array<float,2>{0.165765241f, 0.327758104f},
-std::array<float,2>{0.45876193f, 0.72622931f},
-std::array<float,2>{0.516819954f, 0.191503286f},
-std::array<float,2>{0.636846006f, 0.508110404f},
-std::array<float,2>{0.292476505f, 0.0892314166f},
-std::array<float,2>{0.0505192094f, 0.958812416f},
-std::array<float,2>{0.904368937f, 0.38876754f},
-std::array<float,2>{0.617919803f, 0.884241402f},
-std::array<float,2>{0.410301924f, 0.453321904f},
-std::array<float,2>{0.221702337f, 0.606769621f},
-std::array<float,2>{0.825665951f, 0.0298374519f},
-std::array<float,2>{0.96098274f, 0.639307916f},
-std::array<float,2>{0.116079211f, 0.160966083f},
-std::array<float,2>{0.356868356f, 0.873723328f},
-std::array<float,2>{0.717119575f, 0.29985401f},
-std::array<float,2>{0.936365426f, 0.844866216f},
-std::array<float,2>{0.0109647233f, 0.286693901f},
-std::array<float,2>{0.268678516f, 0.648406327f},
-std::array<float,2>{0.669913709f, 0.181576565f},
-std::array<float,2>{0.539486766f, 0.612236738f},
-std::array<float,2>{0.47041133f, 0.00201387634f},
-std::array<float,2>{0.133869797f, 0.902129114f},
-std::array<float,2>{0.774497449f, 0.443611354f},
-std::array<float,2>{0.726588011f, 0.952224791f},
-std::array<float,2>{0.33320713f, 0.392884135f},
-std::array<float,2>{0.0632530004f, 0.517157972f},
-std::array<float,2>{0.991541982f, 0.0739495233f},
-std::array<float,2>{0.859425902f, 0.73981154f},
-std::array<float,2>{0.198378175f, 0.209243461f},
-std::array<float,2>{0.38881442f, 0.803692639f},
-std::array<float,2>{0.589232564f, 0.340717107f},
-std::array<float,2>{0.791403711f, 0.907994747f},
-std::array<float,2>{0.168785408f, 0.497522831f},
-std::array<float,2>{0.453147769f, 0.580244124f},
-std::array<float,2>{0.521815419f, 0.0422097556f},
-std::array<float,2>{0.635658681f, 0.687361896f},
-std::array<float,2>{0.296485662f, 0.1316012f},
-std::array<float,2>{0.0509301163f, 0.836805463f},
-std::array<float,2>{0.901730359f, 0.275175393f},
-std::array<float,2>{0.623877525f, 0.752008498f},
-std::array<float,2>{0.407521158f, 0.364219785f},
-std::array<float,2>{0.223889306f, 0.695736349f},
-std::array<float,2>{0.823950887f, 0.230513006f},
-std::array<float,2>{0.968005896f, 0.552298367f},
-std::array<float,2>{0.110090651f, 0.120566748f},
-std::array<float,2>{0.354677767f, 0.984432757f},
-std::array<float,2>{0.712332189f, 0.410714954f},
-std::array<float,2>{0.982664406f, 0.97678417f},
-std::array<float,2>{0.0844686553f, 0.432719618f},
-std::array<float,2>{0.317120731f, 0.534331322f},
-std::array<float,2>{0.749836087f, 0.105641283f},
-std::array<float,2>{0.568003356f, 0.708674908f},
-std::array<float,2>{0.405171335f, 0.241613939f},
-std::array<float,2>{0.209554687f, 0.773923695f},
-std::array<float,2>{0.851001084f, 0.355598807f},
-std::array<float,2>{0.676013827f, 0.823501766f},
-std::array<float,2>{0.259374976f, 0.264342755f},
-std::array<float,2>{0.0190123618f, 0.669967353f},
-std::array<float,2>{0.915254891f, 0.151150286f},
-std::array<float,2>{0.755433917f, 0.570758522f},
-std::array<float,2>{0.147634238f, 0.0519976318f},
-std::array<float,2>{0.499934971f, 0.925981939f},
-std::array<float,2>{0.549394906f, 0.47142154f},
-std::array<float,2>{0.838514507f, 0.789619386f},
-std::array<float,2>{0.242879003f, 0.317282617f},
-std::array<float,2>{0.428664982f, 0.729278505f},
-std::array<float,2>{0.605869234f, 0.201568797f},
-std::array<float,2>{0.689532697f, 0.504440725f},
-std::array<float,2>{0.360764772f, 0.080028601f},
-std::array<float,2>{0.103946425f, 0.965228498f},
-std::array<float,2>{0.945011556f, 0.377004266f},
-std::array<float,2>{0.508013904f, 0.879287183f},
-std::array<float,2>{0.440404266f, 0.463587075f},
-std::array<float,2>{0.186048239f, 0.5988006f},
-std::array<float,2>{0.803061843f, 0.0160587281f},
-std::array<float,2>{0.88117826f, 0.629877865f},
-std::array<float,2>{0.0342893377f, 0.171013951f},
-std::array<float,2>{0.301745921f, 0.865548909f},
-std::array<float,2>{0.644749761f, 0.311905831f},
-std::array<float,2>{0.949732184f, 0.7659145f},
-std::array<float,2>{0.0989894494f, 0.345798314f},
-std::array<float,2>{0.373158216f, 0.718073487f},
-std::array<float,2>{0.70135951f, 0.244364202f},
-std::array<float,2>{0.594902277f, 0.544875205f},
-std::array<float,2>{0.434122145f, 0.101415247f},
-std::array<float,2>{0.236324579f, 0.974260926f},
-std::array<float,2>{0.831108034f, 0.42454803f},
-std::array<float,2>{0.651563168f, 0.934498012f},
-std::array<float,2>{0.308009744f, 0.477634668f},
-std::array<float,2>{0.0420155264f, 0.567064285f},
-std::array<float,2>{0.885576189f, 0.0576033816f},
-std::array<float,2>{0.808547974f, 0.662927568f},
-std::array<float,2>{0.173151821f, 0.144107416f},
-std::array<float,2>{0.447117597f, 0.819633067f},
-std::array<float,2>{0.506187975f, 0.252592266f},
-std::array<float,2>{0.855644941f, 0.955189705f},
-std::array<float,2>{0.213883638f, 0.385314226f},
-std::array<float,2>{0.393204451f, 0.512213528f},
-std::array<float,2>{0.570639908f, 0.0913235918f},
-std::array<float,2>{0.736688793f, 0.720249712f},
-std::array<float,2>{0.322571844f, 0.191393539f},
-std::array<float,2>{0.0927610695f, 0.782939732f},
-std::array<float,2>{0.974249601f, 0.324106872f},
-std::array<float,2>{0.555376112f, 0.868088365f},
-std::array<float,2>{0.489929318f, 0.303752214f},
-std::array<float,2>{0.14955005f, 0.635358393f},
-std::array<float,2>{0.760974586f, 0.159896478f},
-std::array<float,2>{0.910548031f, 0.602348208f},
-std::array<float,2>{0.0300609563f, 0.0251197219f},
-std::array<float,2>{0.25203523f, 0.88705945f},
-std::array<float,2>{0.679823935f, 0.457850963f},
-std::array<float,2>{0.89404124f, 0.892957866f},
-std::array<float,2>{0.0594495945f, 0.450740159f},
-std::array<float,2>{0.282341361f, 0.624300182f},
-std::array<float,2>{0.626650214f, 0.0118441749f},
-std::array<float,2>{0.529105484f, 0.655766845f},
-std::array<float,2>{0.465037107f, 0.175653622f},
-std::array<float,2>{0.159186974f, 0.858451366f},
-std::array<float,2>{0.785789728f, 0.292922705f},
-std::array<float,2>{0.705851197f, 0.81124872f},
-std::array<float,2>{0.347320378f, 0.330854982f},
-std::array<float,2>{0.124435365f, 0.742716074f},
-std::array<float,2>{0.958190024f, 0.214775532f},
-std::array<float,2>{0.812946439f, 0.526313245f},
-std::array<float,2>{0.23330006f, 0.0641700029f},
-std::array<float,2>{0.414225817f, 0.940629184f},
-std::array<float,2>{0.609727859f, 0.404162616f},
-std::array<float,2>{0.768443942f, 0.834820807f},
-std::array<float,2>{0.131075546f, 0.270416349f},
-std::array<float,2>{0.476958275f, 0.678100705f},
-std::array<float,2>{0.53549701f, 0.136110753f},
-std::array<float,2>{0.660690725f, 0.59251821f},
-std::array<float,2>{0.280068308f, 0.0345546678f},
-std::array<float,2>{0.007549203f, 0.918905616f},
-std::array<float,2>{0.9257195f, 0.488684297f},
-std::array<float,2>{0.579929709f, 0.99786824f},
-std::array<float,2>{0.37974748f, 0.41945681f},
-std::array<float,2>{0.191652238f, 0.562352479f},
-std::array<float,2>{0.8730129f, 0.110963427f},
-std::array<float,2>{0.994122267f, 0.687556624f},
-std::array<float,2>{0.0739201829f, 0.220293775f},
-std::array<float,2>{0.343263119f, 0.758930683f},
-std::array<float,2>{0.724887729f, 0.372965991f},
-std::array<float,2>{0.88969624f, 0.800364554f},
-std::array<float,2>{0.0463013984f, 0.337550431f},
-std::array<float,2>{0.31208089f, 0.734402895f},
-std::array<float,2>{0.654776216f, 0.203866988f},
-std::array<float,2>{0.502882957f, 0.521780074f},
-std::array<float,2>{0.450326473f, 0.0761154294f},
-std::array<float,2>{0.176227093f, 0.945619285f},
-std::array<float,2>{0.810099423f, 0.395583004f},
-std::array<float,2>{0.698353589f, 0.903960526f},
-std::array<float,2>{0.370354325f, 0.438681751f},
-std::array<float,2>{0.0970626548f, 0.614430785f},
-std::array<float,2>{0.947970808f, 0.00473638484f},
-std::array<float,2>{0.832666278f, 0.64394474f},
-std::array<float,2>{0.238300547f, 0.183642998f},
-std::array<float,2>{0.432180762f, 0.849269271f},
-std::array<float,2>{0.601448953f, 0.284621269f},
-std::array<float,2>{0.761724055f, 0.989978492f},
-std::array<float,2>{0.153691188f, 0.409048498f},
-std::array<float,2>{0.484469861f, 0.550717354f},
-std::array<float,2>{0.561957717f, 0.121727616f},
-std::array<float,2>{0.686786115f, 0.70293057f},
-std::array<float,2>{0.256621778f, 0.229953438f},
-std::array<float,2>{0.0237186737f, 0.754398286f},
-std::array<float,2>{0.910007715f, 0.359514654f},
-std::array<float,2>{0.575512648f, 0.841764271f},
-std::array<float,2>{0.397849977f, 0.278057128f},
-std::array<float,2>{0.215786308f, 0.681862295f},
-std::array<float,2>{0.853258789f, 0.128677517f},
-std::array<float,2>{0.972415507f, 0.582992792f},
-std::array<float,2>{0.0885621682f, 0.043229755f},
-std::array<float,2>{0.326553673f, 0.910645783f},
-std::array<float,2>{0.739939749f, 0.494781524f},
-std::array<float,2>{0.954856396f, 0.925117135f},
-std::array<float,2>{0.117554232f, 0.476136357f},
-std::array<float,2>{0.349589646f, 0.577792108f},
-std::array<float,2>{0.710878491f, 0.0499001741f},
-std::array<float,2>{0.615941286f, 0.66453898f},
-std::array<float,2>{0.421546191f, 0.154829785f},
-std::array<float,2>{0.228227198f, 0.825755954f},
-std::array<float,2>{0.81836307f, 0.260550946f},
-std::array<float,2>{0.629673004f, 0.778583229f},
-std::array<float,2>{0.287127733f, 0.354054958f},
-std::array<float,2>{0.055056747f, 0.70472312f},
-std::array<float,2>{0.896540642f, 0.237747282f},
-std::array<float,2>{0.784469306f, 0.538774371f},
-std::array<float,2>{0.162538946f, 0.103523649f},
-std::array<float,2>{0.461846143f, 0.980736852f},
-std::array<float,2>{0.52354306f, 0.435870081f},
-std::array<float,2>{0.869596839f, 0.862597167f},
-std::array<float,2>{0.189644977f, 0.308083504f},
-std::array<float,2>{0.378186554f, 0.626227796f},
-std::array<float,2>{0.584801912f, 0.165207565f},
-std::array<float,2>{0.722418725f, 0.597599506f},
-std::array<float,2>{0.339370877f, 0.0210877005f},
-std::array<float,2>{0.0765022784f, 0.876757741f},
-std::array<float,2>{0.997702479f, 0.466453999f},
-std::array<float,2>{0.531359017f, 0.963455319f},
-std::array<float,2>{0.482563913f, 0.379520059f},
-std::array<float,2>{0.126878634f, 0.502833605f},
-std::array<float,2>{0.772255957f, 0.0856199563f},
-std::array<float,2>{0.929286838f, 0.732198477f},
-std::array<float,2>{0.00295647839f, 0.19918178f},
-std::array<float,2>{0.276356012f, 0.793815494f},
-std::array<float,2>{0.658662736f, 0.313966364f},
-std::array<float,2>{0.98465389f, 0.815786839f},
-std::array<float,2>{0.0674932897f, 0.254352033f},
-std::array<float,2>{0.328162611f, 0.658709288f},
-std::array<float,2>{0.730677187f, 0.147348955f},
-std::array<float,2>{0.592530251f, 0.56321919f},
-std::array<float,2>{0.383879542f, 0.0608382262f},
-std::array<float,2>{0.201514065f, 0.932398498f},
-std::array<float,2>{0.863989294f, 0.483270884f},
-std::array<float,2>{0.665668786f, 0.97064209f},
-std::array<float,2>{0.271539629f, 0.428248823f},
-std::array<float,2>{0.0152964965f, 0.541662693f},
-std::array<float,2>{0.932176948f, 0.0958228931f},
-std::array<float,2>{0.779061139f, 0.71203804f},
-std::array<float,2>{0.1382121f, 0.249293566f},
-std::array<float,2>{0.47518152f, 0.77149415f},
-std::array<float,2>{0.54477042f, 0.349986404f},
-std::array<float,2>{0.824409008f, 0.885350525f},
-std::array<float,2>{0.22106497f, 0.455280125f},
-std::array<float,2>{0.411645085f, 0.607479513f},
-std::array<float,2>{0.61841929f, 0.0276577864f},
-std::array<float,2>{0.718159497f, 0.637326837f},
-std::array<float,2>{0.355525345f, 0.162632972f},
-std::array<float,2>{0.117073223f, 0.872541785f},
-std::array<float,2>{0.961995244f, 0.2975218f},
-std::array<float,2>{0.516043007f, 0.787914157f},
-std::array<float,2>{0.457648218f, 0.325870931f},
-std::array<float,2>{0.16416122f, 0.722927868f},
-std::array<float,2>{0.795047879f, 0.194593117f},
-std::array<float,2>{0.906217813f, 0.511565268f},
-std::array<float,2>{0.0492826886f, 0.0864704326f},
-std::array<float,2>{0.291881621f, 0.960826039f},
-std::array<float,2>{0.638338208f, 0.388103247f},
-std::array<float,2>{0.919818163f, 0.94318825f},
-std::array<float,2>{0.0214613955f, 0.401671112f},
-std::array<float,2>{0.262754798f, 0.530679286f},
-std::array<float,2>{0.673772812f, 0.0674396008f},
-std::array<float,2>{0.553447783f, 0.748046517f},
-std::array<float,2>{0.495587736f, 0.218446538f},
-std::array<float,2>{0.143505752f, 0.807606101f},
-std::array<float,2>{0.750724554f, 0.335139364f},
-std::array<float,2>{0.745694757f, 0.85468328f},
-std::array<float,2>{0.312593251f, 0.295271218f},
-std::array<float,2>{0.0802550614f, 0.652203858f},
-std::array<float,2>{0.979500771f, 0.178265259f},
-std::array<float,2>{0.84484148f, 0.618757248f},
-std::array<float,2>{0.204721615f, 0.00972618256f},
-std::array<float,2>{0.400824517f, 0.895662427f},
-std::array<float,2>{0.565921783f, 0.447157562f},
-std::array<float,2>{0.800626874f, 0.761752129f},
-std::array<float,2>{0.180736274f, 0.368540168f},
-std::array<float,2>{0.44325161f, 0.691575706f},
-std::array<float,2>{0.515204251f, 0.225404114f},
-std::array<float,2>{0.644130468f, 0.558256269f},
-std::array<float,2>{0.297161698f, 0.115333565f},
-std::array<float,2>{0.0377436168f, 0.992903054f},
-std::array<float,2>{0.876703858f, 0.414768308f},
-std::array<float,2>{0.602131069f, 0.91490531f},
-std::array<float,2>{0.423664749f, 0.486892343f},
-std::array<float,2>{0.248321101f, 0.586953163f},
-std::array<float,2>{0.843099654f, 0.0381607004f},
-std::array<float,2>{0.939765096f, 0.675580025f},
-std::array<float,2>{0.106761366f, 0.137077644f},
-std::array<float,2>{0.367040694f, 0.829656184f},
-std::array<float,2>{0.693155348f, 0.26896736f},
-std::array<float,2>{0.898652732f, 0.83819586f},
-std::array<float,2>{0.0544982143f, 0.276028246f},
-std::array<float,2>{0.293843091f, 0.684884369f},
-std::array<float,2>{0.633844852f, 0.129379198f},
-std::array<float,2>{0.519981623f, 0.579273939f},
-std::array<float,2>{0.456103265f, 0.0408209525f},
-std::array<float,2>{0.170778468f, 0.910106361f},
-std::array<float,2>{0.790214896f, 0.498509347f},
-std::array<float,2>{0.713029981f, 0.988271892f},
-std::array<float,2>{0.35284847f, 0.413849562f},
-std::array<float,2>{0.112091981f, 0.553703547f},
-std::array<float,2>{0.96575892f, 0.11854855f},
-std::array<float,2>{0.820844173f, 0.699104428f},
-std::array<float,2>{0.226465911f, 0.232743829f},
-std::array<float,2>{0.409802139f, 0.751448631f},
-std::array<float,2>{0.621587932f, 0.366170436f},
-std::array<float,2>{0.775461316f, 0.899444997f},
-std::array<float,2>{0.135227114f, 0.442437559f},
-std::array<float,2>{0.472409308f, 0.610583842f},
-std::array<float,2>{0.54264158f, 0.00158824434f},
-std::array<float,2>{0.671460629f, 0.645467043f},
-std::array<float,2>{0.267471462f, 0.181767702f},
-std::array<float,2>{0.00846498273f, 0.847191453f},
-std::array<float,2>{0.934485435f, 0.287438124f},
-std::array<float,2>{0.587381244f, 0.802371621f},
-std::array<float,2>{0.388552397f, 0.342838764f},
-std::array<float,2>{0.19603245f, 0.740998149f},
-std::array<float,2>{0.862583756f, 0.208575293f},
-std::array<float,2>{0.989083767f, 0.518603384f},
-std::array<float,2>{0.0661920458f, 0.0721766055f},
-std::array<float,2>{0.334567755f, 0.949791908f},
-std::array<float,2>{0.728899479f, 0.392267615f},
-std::array<float,2>{0.942577302f, 0.967888117f},
-std::array<float,2>{0.102344498f, 0.375891179f},
-std::array<float,2>{0.361825615f, 0.506895721f},
-std::array<float,2>{0.688609779f, 0.0804071203f},
-std::array<float,2>{0.608846545f, 0.727754295f},
-std::array<float,2>{0.427197814f, 0.199461013f},
-std::array<float,2>{0.244728237f, 0.791644514f},
-std::array<float,2>{0.836492419f, 0.318948448f},
-std::array<float,2>{0.647191286f, 0.863539636f},
-std::array<float,2>{0.304208726f, 0.309885591f},
-std::array<float,2>{0.031415876f, 0.631093383f},
-std::array<float,2>{0.879391372f, 0.16973269f},
-std::array<float,2>{0.801933289f, 0.60090667f},
-std::array<float,2>{0.184713379f, 0.0177375693f},
-std::array<float,2>{0.438860446f, 0.881570399f},
-std::array<float,2>{0.511618078f, 0.461742699f},
-std::array<float,2>{0.847733915f, 0.775822997f},
-std::array<float,2>{0.208572462f, 0.358420104f},
-std::array<float,2>{0.404076904f, 0.710004687f},
-std::array<float,2>{0.56989342f, 0.238900766f},
-std::array<float,2>{0.747477472f, 0.531942308f},
-std::array<float,2>{0.31942901f, 0.107561015f},
-std::array<float,2>{0.0821538866f, 0.979296625f},
-std::array<float,2>{0.981181383f, 0.43104285f},
-std::array<float,2>{0.548587203f, 0.928654313f},
-std::array<float,2>{0.497799337f, 0.470659494f},
-std::array<float,2>{0.1453529f, 0.572714925f},
-std::array<float,2>{0.757453382f, 0.0536598526f},
-std::array<float,2>{0.916792989f, 0.669091523f},
-std::array<float,2>{0.0170121081f, 0.149949208f},
-std::array<float,2>{0.261273235f, 0.821733713f},
-std::array<float,2>{0.677756608f, 0.262460232f},
-std::array<float,2>{0.97568655f, 0.783992589f},
-std::array<float,2>{0.0917649195f, 0.321501404f},
-std::array<float,2>{0.32065174f, 0.721763968f},
-std::array<float,2>{0.734918654f, 0.188475698f},
-std::array<float,2>{0.574091375f, 0.515607536f},
-std::array<float,2>{0.392236054f, 0.092992641f},
-std::array<float,2>{0.212684467f, 0.953890324f},
-std::array<float,2>{0.859228432f, 0.384549677f},
-std::array<float,2>{0.682374179f, 0.890597939f},
-std::array<float,2>{0.251860857f, 0.459048271f},
-std::array<float,2>{0.0289214998f, 0.604173362f},
-std::array<float,2>{0.913896501f, 0.0268802829f},
-std::array<float,2>{0.758313239f, 0.633959413f},
-std::array<float,2>{0.152203709f, 0.158017874f},
-std::array<float,2>{0.490458459f, 0.870010316f},
-std::array<float,2>{0.557881892f, 0.301918387f},
-std::array<float,2>{0.828225315f, 0.976290703f},
-std::array<float,2>{0.23739554f, 0.422609359f},
-std::array<float,2>{0.435750544f, 0.546207488f},
-std::array<float,2>{0.596690297f, 0.0978224203f},
-std::array<float,2>{0.70097816f, 0.714880347f},
-std::array<float,2>{0.372611165f, 0.243178725f},
-std::array<float,2>{0.100856788f, 0.768459976f},
-std::array<float,2>{0.951546609f, 0.345460624f},
-std::array<float,2>{0.504671514f, 0.817566574f},
-std::array<float,2>{0.448758632f, 0.250076383f},
-std::array<float,2>{0.175741762f, 0.661275029f},
-std::array<float,2>{0.804781377f, 0.141549379f},
-std::array<float,2>{0.883166909f, 0.568707287f},
-std::array<float,2>{0.0393124297f, 0.0564641058f},
-std::array<float,2>{0.305546373f, 0.937189043f},
-std::array<float,2>{0.649344265f, 0.479680777f},
-std::array<float,2>{0.922521591f, 0.921364307f},
-std::array<float,2>{0.0045762402f, 0.49066022f},
-std::array<float,2>{0.277475983f, 0.591192365f},
-std::array<float,2>{0.663351119f, 0.0325703733f},
-std::array<float,2>{0.537147164f, 0.675829828f},
-std::array<float,2>{0.478882253f, 0.133244038f},
-std::array<float,2>{0.130755171f, 0.833548784f},
-std::array<float,2>{0.766957343f, 0.27205655f},
-std::array<float,2>{0.724073827f, 0.759847879f},
-std::array<float,2>{0.340729356f, 0.374659479f},
-std::array<float,2>{0.0704110116f, 0.690096259f},
-std::array<float,2>{0.995666504f, 0.222184151f},
-std::array<float,2>{0.874336064f, 0.558961987f},
-std::array<float,2>{0.194926634f, 0.112564035f},
-std::array<float,2>{0.381058425f, 0.999075592f},
-std::array<float,2>{0.581412792f, 0.420419306f},
-std::array<float,2>{0.787139118f, 0.855496168f},
-std::array<float,2>{0.157305822f, 0.290501148f},
-std::array<float,2>{0.466916889f, 0.654233336f},
-std::array<float,2>{0.52986902f, 0.17304498f},
-std::array<float,2>{0.627933204f, 0.622392595f},
-std::array<float,2>{0.283587754f, 0.0139707215f},
-std::array<float,2>{0.0624746382f, 0.892535269f},
-std::array<float,2>{0.890677333f, 0.451503336f},
-std::array<float,2>{0.61258471f, 0.937983036f},
-std::array<float,2>{0.417732388f, 0.405472755f},
-std::array<float,2>{0.231253892f, 0.523741841f},
-std::array<float,2>{0.814766049f, 0.0649504215f},
-std::array<float,2>{0.95927912f, 0.745598972f},
-std::array<float,2>{0.121472508f, 0.21199505f},
-std::array<float,2>{0.3455742f, 0.808966339f},
-std::array<float,2>{0.704155445f, 0.328733653f},
-std::array<float,2>{0.907645106f, 0.757310748f},
-std::array<float,2>{0.0267831832f, 0.361507177f},
-std::array<float,2>{0.255046546f, 0.700294793f},
-std::array<float,2>{0.683609188f, 0.227702186f},
-std::array<float,2>{0.558615923f, 0.547882974f},
-std::array<float,2>{0.487302035f, 0.123620868f},
-std::array<float,2>{0.154874414f, 0.991457701f},
-std::array<float,2>{0.765272558f, 0.407842696f},
-std::array<float,2>{0.740423143f, 0.912829518f},
-std::array<float,2>{0.325629324f, 0.493257999f},
-std::array<float,2>{0.0861050338f, 0.585776508f},
-std::array<float,2>{0.969768286f, 0.0458210967f},
-std::array<float,2>{0.8536883f, 0.68104285f},
-std::array<float,2>{0.217698246f, 0.126934499f},
-std::array<float,2>{0.395316571f, 0.843105733f},
-std::array<float,2>{0.576948643f, 0.280807108f},
-std::array<float,2>{0.811654925f, 0.947556257f},
-std::array<float,2>{0.179301307f, 0.396533102f},
-std::array<float,2>{0.451540768f, 0.521113873f},
-std::array<float,2>{0.500817418f, 0.0780539438f},
-std::array<float,2>{0.653002024f, 0.736736536f},
-std::array<float,2>{0.309369236f, 0.206816003f},
-std::array<float,2>{0.0446339399f, 0.798613846f},
-std::array<float,2>{0.88786608f, 0.338969767f},
-std::array<float,2>{0.59855336f, 0.851556838f},
-std::array<float,2>{0.429983735f, 0.282465816f},
-std::array<float,2>{0.240341485f, 0.641188204f},
-std::array<float,2>{0.835622191f, 0.186028183f},
-std::array<float,2>{0.946258962f, 0.61676389f},
-std::array<float,2>{0.0944025666f, 0.00705888402f},
-std::array<float,2>{0.367543548f, 0.905371904f},
-std::array<float,2>{0.697002649f, 0.440221548f},
-std::array<float,2>{0.998088181f, 0.8779127f},
-std::array<float,2>{0.075692609f, 0.467211217f},
-std::array<float,2>{0.337727249f, 0.594614327f},
-std::array<float,2>{0.71956712f, 0.0216987189f},
-std::array<float,2>{0.582928419f, 0.627300799f},
-std::array<float,2>{0.375581264f, 0.167775869f},
-std::array<float,2>{0.189252496f, 0.860585093f},
-std::array<float,2>{0.869134784f, 0.305702746f},
-std::array<float,2>{0.657102048f, 0.796612322f},
-std::array<float,2>{0.274955601f, 0.316032201f},
-std::array<float,2>{0.000943920051f, 0.733586967f},
-std::array<float,2>{0.926149964f, 0.196565956f},
-std::array<float,2>{0.770670414f, 0.50106895f},
-std::array<float,2>{0.127866372f, 0.0829434991f},
-std::array<float,2>{0.482075244f, 0.96114409f},
-std::array<float,2>{0.534071803f, 0.381588608f},
-std::array<float,2>{0.817095518f, 0.827459037f},
-std::array<float,2>{0.229956791f, 0.258429646f},
-std::array<float,2>{0.419117868f, 0.6672858f},
-std::array<float,2>{0.615187287f, 0.152722061f},
-std::array<float,2>{0.707268834f, 0.57543999f},
-std::array<float,2>{0.350206077f, 0.0479576625f},
-std::array<float,2>{0.120661244f, 0.923639178f},
-std::array<float,2>{0.956690669f, 0.474081844f},
-std::array<float,2>{0.526723206f, 0.982672334f},
-std::array<float,2>{0.46334675f, 0.434783369f},
-std::array<float,2>{0.160759047f, 0.536221504f},
-std::array<float,2>{0.78145504f, 0.102888212f},
-std::array<float,2>{0.896405876f, 0.706814349f},
-std::array<float,2>{0.0582364239f, 0.235723451f},
-std::array<float,2>{0.285539776f, 0.779704869f},
-std::array<float,2>{0.632580996f, 0.352845192f},
-std::array<float,2>{0.963022888f, 0.874567688f},
-std::array<float,2>{0.113774829f, 0.299081326f},
-std::array<float,2>{0.358834982f, 0.6398049f},
-std::array<float,2>{0.716744959f, 0.16205506f},
-std::array<float,2>{0.619770646f, 0.606175601f},
-std::array<float,2>{0.413470954f, 0.0307345111f},
-std::array<float,2>{0.219832942f, 0.883276582f},
-std::array<float,2>{0.827609003f, 0.454299837f},
-std::array<float,2>{0.639413297f, 0.957873285f},
-std::array<float,2>{0.290219843f, 0.39040786f},
-std::array<float,2>{0.0469442084f, 0.508859277f},
-std::array<float,2>{0.903062642f, 0.0883314908f},
-std::array<float,2>{0.794875443f, 0.724673331f},
-std::array<float,2>{0.166710347f, 0.192593038f},
-std::array<float,2>{0.459554642f, 0.78671819f},
-std::array<float,2>{0.518794477f, 0.326860458f},
-std::array<float,2>{0.865665317f, 0.931298494f},
-std::array<float,2>{0.19985579f, 0.481280178f},
-std::array<float,2>{0.386663109f, 0.564465761f},
-std::array<float,2>{0.590227485f, 0.0591399707f},
-std::array<float,2>{0.732762396f, 0.657898009f},
-std::array<float,2>{0.331767857f, 0.146250397f},
-std::array<float,2>{0.0699124485f, 0.813324034f},
-std::array<float,2>{0.98738122f, 0.256523162f},
-std::array<float,2>{0.546530604f, 0.769634485f},
-std::array<float,2>{0.474551052f, 0.349559486f},
-std::array<float,2>{0.13876389f, 0.714312315f},
-std::array<float,2>{0.77980715f, 0.247186005f},
-std::array<float,2>{0.931142867f, 0.540265918f},
-std::array<float,2>{0.0131332604f, 0.0954964831f},
-std::array<float,2>{0.270257652f, 0.971794128f},
-std::array<float,2>{0.667509437f, 0.426260501f},
-std::array<float,2>{0.878766775f, 0.994215965f},
-std::array<float,2>{0.035511896f, 0.417447418f},
-std::array<float,2>{0.299967796f, 0.556589663f},
-std::array<float,2>{0.641154528f, 0.114568032f},
-std::array<float,2>{0.512449443f, 0.69353354f},
-std::array<float,2>{0.445126265f, 0.223311514f},
-std::array<float,2>{0.181862891f, 0.764215529f},
-std::array<float,2>{0.798464358f, 0.370629638f},
-std::array<float,2>{0.694858968f, 0.83198607f},
-std::array<float,2>{0.364755452f, 0.266258329f},
-std::array<float,2>{0.10770347f, 0.67349112f},
-std::array<float,2>{0.938687921f, 0.139210299f},
-std::array<float,2>{0.841353774f, 0.588430822f},
-std::array<float,2>{0.246868744f, 0.036897447f},
-std::array<float,2>{0.424836367f, 0.916484654f},
-std::array<float,2>{0.603542984f, 0.486142695f},
-std::array<float,2>{0.753222764f, 0.805479467f},
-std::array<float,2>{0.14116177f, 0.332874268f},
-std::array<float,2>{0.49375841f, 0.748287022f},
-std::array<float,2>{0.552462459f, 0.215469047f},
-std::array<float,2>{0.673853755f, 0.527864099f},
-std::array<float,2>{0.263944715f, 0.0697654784f},
-std::array<float,2>{0.0232956503f, 0.944559216f},
-std::array<float,2>{0.920261085f, 0.398681909f},
-std::array<float,2>{0.56439364f, 0.897652209f},
-std::array<float,2>{0.399537712f, 0.447563797f},
-std::array<float,2>{0.206534937f, 0.619407773f},
-std::array<float,2>{0.846070588f, 0.0111993169f},
-std::array<float,2>{0.978272855f, 0.649268508f},
-std::array<float,2>{0.0781493708f, 0.176141232f},
-std::array<float,2>{0.314677358f, 0.852801144f},
-std::array<float,2>{0.742276609f, 0.29399389f},
-std::array<float,2>{0.891473651f, 0.859373808f},
-std::array<float,2>{0.0617166981f, 0.292016387f},
-std::array<float,2>{0.284085244f, 0.655331016f},
-std::array<float,2>{0.62862432f, 0.174895838f},
-std::array<float,2>{0.529536247f, 0.624735773f},
-std::array<float,2>{0.467680782f, 0.0126584526f},
-std::array<float,2>{0.158169806f, 0.89309305f},
-std::array<float,2>{0.787753463f, 0.450649112f},
-std::array<float,2>{0.704729974f, 0.941364288f},
-std::array<float,2>{0.345077515f, 0.403390586f},
-std::array<float,2>{0.121828385f, 0.525475085f},
-std::array<float,2>{0.959782422f, 0.0638485849f},
-std::array<float,2>{0.815320313f, 0.742288411f},
-std::array<float,2>{0.230737612f, 0.21396707f},
-std::array<float,2>{0.417003483f, 0.810619831f},
-std::array<float,2>{0.612969816f, 0.330359578f},
-std::array<float,2>{0.767146289f, 0.918012381f},
-std::array<float,2>{0.130211964f, 0.488978863f},
-std::array<float,2>{0.479486346f, 0.591799736f},
-std::array<float,2>{0.537753463f, 0.0350809842f},
-std::array<float,2>{0.663607299f, 0.678301334f},
-std::array<float,2>{0.27792418f, 0.13662976f},
-std::array<float,2>{0.00426525669f, 0.834223866f},
-std::array<float,2>{0.922165751f, 0.270015478f},
-std::array<float,2>{0.581883848f, 0.759742975f},
-std::array<float,2>{0.381788433f, 0.372414917f},
-std::array<float,2>{0.194741666f, 0.688079596f},
-std::array<float,2>{0.874922633f, 0.220098823f},
-std::array<float,2>{0.995253325f, 0.561648428f},
-std::array<float,2>{0.0708902776f, 0.110383473f},
-std::array<float,2>{0.340092868f, 0.997400343f},
-std::array<float,2>{0.724534214f, 0.419167876f},
-std::array<float,2>{0.952054024f, 0.973754942f},
-std::array<float,2>{0.101345763f, 0.424224436f},
-std::array<float,2>{0.372272283f, 0.54434979f},
-std::array<float,2>{0.700534701f, 0.100940578f},
-std::array<float,2>{0.597184718f, 0.718454182f},
-std::array<float,2>{0.436348438f, 0.245001391f},
-std::array<float,2>{0.237951651f, 0.766204119f},
-std::array<float,2>{0.82907933f, 0.346318394f},
-std::array<float,2>{0.648826122f, 0.820082963f},
-std::array<float,2>{0.305098623f, 0.252334297f},
-std::array<float,2>{0.0398035347f, 0.662428856f},
-std::array<float,2>{0.883586943f, 0.143882111f},
-std::array<float,2>{0.805314243f, 0.566861928f},
-std::array<float,2>{0.175105825f, 0.0567693822f},
-std::array<float,2>{0.448606551f, 0.933845043f},
-std::array<float,2>{0.504344225f, 0.478038192f},
-std::array<float,2>{0.858488262f, 0.782546878f},
-std::array<float,2>{0.211951897f, 0.323478281f},
-std::array<float,2>{0.391949743f, 0.719829977f},
-std::array<float,2>{0.573281169f, 0.190838069f},
-std::array<float,2>{0.734613478f, 0.51215744f},
-std::array<float,2>{0.320856571f, 0.0909409896f},
-std::array<float,2>{0.0911769941f, 0.955852926f},
-std::array<float,2>{0.976334453f, 0.385021955f},
-std::array<float,2>{0.558529198f, 0.88751781f},
-std::array<float,2>{0.490725309f, 0.457076371f},
-std::array<float,2>{0.151698872f, 0.60201323f},
-std::array<float,2>{0.758060217f, 0.0246718824f},
-std::array<float,2>{0.913125992f, 0.634957492f},
-std::array<float,2>{0.0286480207f, 0.159441501f},
-std::array<float,2>{0.251137674f, 0.867354512f},
-std::array<float,2>{0.681758106f, 0.304432988f},
-std::array<float,2>{0.98070246f, 0.774301231f},
-std::array<float,2>{0.0829987153f, 0.356067717f},
-std::array<float,2>{0.320004433f, 0.708484888f},
-std::array<float,2>{0.747671783f, 0.241895378f},
-std::array<float,2>{0.569741786f, 0.534811199f},
-std::array<float,2>{0.403551012f, 0.106425308f},
-std::array<float,2>{0.208232149f, 0.977224767f},
-std::array<float,2>{0.848158002f, 0.433280319f},
-std::array<float,2>{0.678497016f, 0.926480711f},
-std::array<float,2>{0.261047602f, 0.470815152f},
-std::array<float,2>{0.0173049513f, 0.571115494f},
-std::array<float,2>{0.916282475f, 0.0524815954f},
-std::array<float,2>{0.757320702f, 0.670642674f},
-std::array<float,2>{0.144664958f, 0.15085727f},
-std::array<float,2>{0.49728623f, 0.823943138f},
-std::array<float,2>{0.548059046f, 0.263688177f},
-std::array<float,2>{0.835939169f, 0.965803862f},
-std::array<float,2>{0.244497225f, 0.377621323f},
-std::array<float,2>{0.427408189f, 0.50404942f},
-std::array<float,2>{0.609235525f, 0.0793891996f},
-std::array<float,2>{0.689313412f, 0.728797674f},
-std::array<float,2>{0.361422718f, 0.201802805f},
-std::array<float,2>{0.101766631f, 0.789086938f},
-std::array<float,2>{0.942942679f, 0.316613853f},
-std::array<float,2>{0.51110518f, 0.86589998f},
-std::array<float,2>{0.439214528f, 0.312480986f},
-std::array<float,2>{0.185532346f, 0.629276514f},
-std::array<float,2>{0.802317023f, 0.171867147f},
-std::array<float,2>{0.879597247f, 0.599553764f},
-std::array<float,2>{0.0321095996f, 0.0161569715f},
-std::array<float,2>{0.304078102f, 0.879598677f},
-std::array<float,2>{0.646793664f, 0.463231087f},
-std::array<float,2>{0.933942258f, 0.901398242f},
-std::array<float,2>{0.00811268948f, 0.444074601f},
-std::array<float,2>{0.26687476f, 0.611671269f},
-std::array<float,2>{0.670977592f, 0.00250607356f},
-std::array<float,2>{0.542149961f, 0.647546172f},
-std::array<float,2>{0.471972823f, 0.181077346f},
-std::array<float,2>{0.135695145f, 0.845390856f},
-std::array<float,2>{0.776326656f, 0.286192f},
-std::array<float,2>{0.729244709f, 0.803067088f},
-std::array<float,2>{0.334247321f, 0.340132147f},
-std::array<float,2>{0.0658983365f, 0.73948729f},
-std::array<float,2>{0.988418281f, 0.209495574f},
-std::array<float,2>{0.863143861f, 0.517075896f},
-std::array<float,2>{0.195658877f, 0.0733206645f},
-std::array<float,2>{0.388013065f, 0.952848375f},
-std::array<float,2>{0.587778509f, 0.393410683f},
-std::array<float,2>{0.790542722f, 0.836043239f},
-std::array<float,2>{0.170371026f, 0.274746299f},
-std::array<float,2>{0.456689775f, 0.68676579f},
-std::array<float,2>{0.520086586f, 0.131168932f},
-std::array<float,2>{0.634353995f, 0.580823958f},
-std::array<float,2>{0.293245822f, 0.0425065532f},
-std::array<float,2>{0.0541668385f, 0.907579482f},
-std::array<float,2>{0.899353266f, 0.497807682f},
-std::array<float,2>{0.621385396f, 0.985051572f},
-std::array<float,2>{0.409265637f, 0.410505503f},
-std::array<float,2>{0.225956112f, 0.552017868f},
-std::array<float,2>{0.820666432f, 0.120873719f},
-std::array<float,2>{0.96504426f, 0.696100235f},
-std::array<float,2>{0.111567236f, 0.231108293f},
-std::array<float,2>{0.353490949f, 0.752530575f},
-std::array<float,2>{0.713439524f, 0.363531202f},
-std::array<float,2>{0.920840085f, 0.806658447f},
-std::array<float,2>{0.0227549076f, 0.335507661f},
-std::array<float,2>{0.264277726f, 0.747435749f},
-std::array<float,2>{0.674439549f, 0.218031555f},
-std::array<float,2>{0.552053928f, 0.531241477f},
-std::array<float,2>{0.493499428f, 0.068046391f},
-std::array<float,2>{0.141021177f, 0.942680895f},
-std::array<float,2>{0.753644466f, 0.402123511f},
-std::array<float,2>{0.743016601f, 0.896095693f},
-std::array<float,2>{0.315369844f, 0.446409613f},
-std::array<float,2>{0.0789406374f, 0.618314445f},
-std::array<float,2>{0.97767967f, 0.00885850098f},
-std::array<float,2>{0.846377134f, 0.651763737f},
-std::array<float,2>{0.206718311f, 0.177950084f},
-std::array<float,2>{0.40036884f, 0.855302334f},
-std::array<float,2>{0.563586414f, 0.295858562f},
-std::array<float,2>{0.798301458f, 0.992521346f},
-std::array<float,2>{0.182417437f, 0.414499223f},
-std::array<float,2>{0.44475311f, 0.557621121f},
-std::array<float,2>{0.512105405f, 0.116011776f},
-std::array<float,2>{0.641049206f, 0.692209959f},
-std::array<float,2>{0.300463617f, 0.224712372f},
-std::array<float,2>{0.035756547f, 0.762612224f},
-std::array<float,2>{0.877974868f, 0.368797451f},
-std::array<float,2>{0.604229271f, 0.829554796f},
-std::array<float,2>{0.425779641f, 0.269473851f},
-std::array<float,2>{0.24620302f, 0.674814761f},
-std::array<float,2>{0.840969622f, 0.13769111f},
-std::array<float,2>{0.939398587f, 0.587771475f},
-std::array<float,2>{0.107927598f, 0.0387583897f},
-std::array<float,2>{0.364301115f, 0.914210916f},
-std::array<float,2>{0.694372058f, 0.486358702f},
-std::array<float,2>{0.988162994f, 0.931933105f},
-std::array<float,2>{0.0694592968f, 0.482474267f},
-std::array<float,2>{0.331273854f, 0.562519073f},
-std::array<float,2>{0.732964277f, 0.0610645153f},
-std::array<float,2>{0.590545237f, 0.658493161f},
-std::array<float,2>{0.385984451f, 0.146541923f},
-std::array<float,2>{0.199227065f, 0.815958858f},
-std::array<float,2>{0.865734637f, 0.254804909f},
-std::array<float,2>{0.667095363f, 0.772138655f},
-std::array<float,2>{0.26964277f, 0.350324363f},
-std::array<float,2>{0.0134667289f, 0.712607563f},
-std::array<float,2>{0.931557238f, 0.249734417f},
-std::array<float,2>{0.77973783f, 0.541074276f},
-std::array<float,2>{0.139328331f, 0.0966715068f},
-std::array<float,2>{0.473856002f, 0.969996989f},
-std::array<float,2>{0.546384752f, 0.427849561f},
-std::array<float,2>{0.828030825f, 0.87273109f},
-std::array<float,2>{0.220666692f, 0.297325552f},
-std::array<float,2>{0.413927495f, 0.636914432f},
-std::array<float,2>{0.619475067f, 0.16229111f},
-std::array<float,2>{0.715830743f, 0.608249545f},
-std::array<float,2>{0.359279811f, 0.0278865565f},
-std::array<float,2>{0.113355622f, 0.884950101f},
-std::array<float,2>{0.963656485f, 0.455704778f},
-std::array<float,2>{0.519085884f, 0.960214078f},
-std::array<float,2>{0.459351659f, 0.388471156f},
-std::array<float,2>{0.166470826f, 0.511102736f},
-std::array<float,2>{0.794148684f, 0.0863290206f},
-std::array<float,2>{0.902654529f, 0.723151028f},
-std::array<float,2>{0.0475531742f, 0.195098892f},
-std::array<float,2>{0.290933847f, 0.787475944f},
-std::array<float,2>{0.638748109f, 0.325377554f},
-std::array<float,2>{0.95645988f, 0.825471401f},
-std::array<float,2>{0.120122261f, 0.260204136f},
-std::array<float,2>{0.349952072f, 0.66471827f},
-std::array<float,2>{0.707656562f, 0.154555604f},
-std::array<float,2>{0.614485502f, 0.57724905f},
-std::array<float,2>{0.419920117f, 0.050675638f},
-std::array<float,2>{0.230343685f, 0.925712049f},
-std::array<float,2>{0.816503108f, 0.475816011f},
-std::array<float,2>{0.632176757f, 0.981034636f},
-std::array<float,2>{0.285720348f, 0.4363015f},
-std::array<float,2>{0.0577780977f, 0.538361669f},
-std::array<float,2>{0.895525277f, 0.104291551f},
-std::array<float,2>{0.781847119f, 0.704474032f},
-std::array<float,2>{0.160507679f, 0.23805277f},
-std::array<float,2>{0.463511437f, 0.77918309f},
-std::array<float,2>{0.527229548f, 0.353607714f},
-std::array<float,2>{0.868259013f, 0.876321375f},
-std::array<float,2>{0.188733801f, 0.466002792f},
-std::array<float,2>{0.375036001f, 0.597092867f},
-std::array<float,2>{0.582218707f, 0.0209029987f},
-std::array<float,2>{0.718782306f, 0.62688607f},
-std::array<float,2>{0.337379217f, 0.165926114f},
-std::array<float,2>{0.0752652809f, 0.862910271f},
-std::array<float,2>{0.998608172f, 0.308460921f},
-std::array<float,2>{0.533356488f, 0.793164432f},
-std::array<float,2>{0.481446743f, 0.313939571f},
-std::array<float,2>{0.126958624f, 0.731840909f},
-std::array<float,2>{0.771092415f, 0.198726475f},
-std::array<float,2>{0.926309943f, 0.502432883f},
-std::array<float,2>{0.000446451217f, 0.0854191035f},
-std::array<float,2>{0.274900854f, 0.963213027f},
-std::array<float,2>{0.656328022f, 0.379245996f},
-std::array<float,2>{0.888607562f, 0.946017265f},
-std::array<float,2>{0.0442058779f, 0.396335095f},
-std::array<float,2>{0.308789104f, 0.522446275f},
-std::array<float,2>{0.652724028f, 0.0754873604f},
-std::array<float,2>{0.500484169f, 0.734985471f},
-std::array<float,2>{0.451993942f, 0.203349859f},
-std::array<float,2>{0.178893089f, 0.800212502f},
-std::array<float,2>{0.812085688f, 0.336944759f},
-std::array<float,2>{0.696532369f, 0.849057972f},
-std::array<float,2>{0.368010759f, 0.285108387f},
-std::array<float,2>{0.0940916613f, 0.644481063f},
-std::array<float,2>{0.945610404f, 0.184556454f},
-std::array<float,2>{0.835237563f, 0.614966094f},
-std::array<float,2>{0.240821615f, 0.00399973942f},
-std::array<float,2>{0.430597693f, 0.903782368f},
-std::array<float,2>{0.598109782f, 0.439210296f},
-std::array<float,2>{0.764986813f, 0.754274964f},
-std::array<float,2>{0.154299855f, 0.360300779f},
-std::array<float,2>{0.486711353f, 0.702328682f},
-std::array<float,2>{0.559544623f, 0.230442911f},
-std::array<float,2>{0.68446219f, 0.550022304f},
-std::array<float,2>{0.255713731f, 0.121254757f},
-std::array<float,2>{0.027002668f, 0.989370704f},
-std::array<float,2>{0.907953262f, 0.408678263f},
-std::array<float,2>{0.576473415f, 0.910505891f},
-std::array<float,2>{0.394946337f, 0.494403958f},
-std::array<float,2>{0.216805696f, 0.582442701f},
-std::array<float,2>{0.854168117f, 0.0438224226f},
-std::array<float,2>{0.970514059f, 0.682323039f},
-std::array<float,2>{0.0866438001f, 0.128117397f},
-std::array<float,2>{0.325852215f, 0.840870261f},
-std::array<float,2>{0.741180599f, 0.277469188f},
-std::array<float,2>{0.924951196f, 0.833419681f},
-std::array<float,2>{0.00711584697f, 0.271832019f},
-std::array<float,2>{0.279489934f, 0.676461756f},
-std::array<float,2>{0.66039747f, 0.133565336f},
-std::array<float,2>{0.535923421f, 0.591409326f},
-std::array<float,2>{0.477084458f, 0.0328865871f},
-std::array<float,2>{0.131642342f, 0.921523929f},
-std::array<float,2>{0.767795503f, 0.490960956f},
-std::array<float,2>{0.725400448f, 0.999637842f},
-std::array<float,2>{0.342996866f, 0.420326501f},
-std::array<float,2>{0.0736125633f, 0.55955714f},
-std::array<float,2>{0.993415594f, 0.113171652f},
-std::array<float,2>{0.872386873f, 0.68949151f},
-std::array<float,2>{0.192351609f, 0.222142667f},
-std::array<float,2>{0.379371434f, 0.760607123f},
-std::array<float,2>{0.579463303f, 0.374094486f},
-std::array<float,2>{0.78539449f, 0.892043054f},
-std::array<float,2>{0.159957558f, 0.452033997f},
-std::array<float,2>{0.465604931f, 0.62257874f},
-std::array<float,2>{0.528525233f, 0.0142850624f},
-std::array<float,2>{0.626070321f, 0.653364956f},
-std::array<float,2>{0.282969475f, 0.173724815f},
-std::array<float,2>{0.0585996732f, 0.856110513f},
-std::array<float,2>{0.89425689f, 0.290552378f},
-std::array<float,2>{0.610150158f, 0.809157729f},
-std::array<float,2>{0.414999515f, 0.328589261f},
-std::array<float,2>{0.23258841f, 0.745786607f},
-std::array<float,2>{0.813359141f, 0.212517366f},
-std::array<float,2>{0.958538592f, 0.524032533f},
-std::array<float,2>{0.124513566f, 0.0645014122f},
-std::array<float,2>{0.347009599f, 0.938390851f},
-std::array<float,2>{0.705408156f, 0.406245887f},
-std::array<float,2>{0.973909438f, 0.953544259f},
-std::array<float,2>{0.0921320617f, 0.383894384f},
-std::array<float,2>{0.322984785f, 0.515131295f},
-std::array<float,2>{0.736938834f, 0.0934975371f},
-std::array<float,2>{0.571150005f, 0.722458601f},
-std::array<float,2>{0.392753601f, 0.187522322f},
-std::array<float,2>{0.214511797f, 0.783237159f},
-std::array<float,2>{0.856335282f, 0.322088867f},
-std::array<float,2>{0.680576742f, 0.869473696f},
-std::array<float,2>{0.252505779f, 0.302357018f},
-std::array<float,2>{0.0294669382f, 0.634560049f},
-std::array<float,2>{0.910691082f, 0.157588378f},
-std::array<float,2>{0.761476874f, 0.603872001f},
-std::array<float,2>{0.150145292f, 0.026477024f},
-std::array<float,2>{0.489312202f, 0.889962733f},
-std::array<float,2>{0.554942846f, 0.459778041f},
-std::array<float,2>{0.831688523f, 0.76806283f},
-std::array<float,2>{0.235726178f, 0.344927698f},
-std::array<float,2>{0.433692843f, 0.715693593f},
-std::array<float,2>{0.595598519f, 0.24388878f},
-std::array<float,2>{0.702131391f, 0.546414554f},
-std::array<float,2>{0.37358883f, 0.098598361f},
-std::array<float,2>{0.0995815396f, 0.975788057f},
-std::array<float,2>{0.949378669f, 0.422213227f},
-std::array<float,2>{0.506709337f, 0.936858535f},
-std::array<float,2>{0.446592301f, 0.480269819f},
-std::array<float,2>{0.173611909f, 0.569302201f},
-std::array<float,2>{0.808077872f, 0.0560611971f},
-std::array<float,2>{0.885150671f, 0.661904871f},
-std::array<float,2>{0.0429602973f, 0.14084354f},
-std::array<float,2>{0.3085033f, 0.817988276f},
-std::array<float,2>{0.652078092f, 0.250519127f},
-std::array<float,2>{0.944714546f, 0.791353166f},
-std::array<float,2>{0.104249336f, 0.318773419f},
-std::array<float,2>{0.361110538f, 0.728335381f},
-std::array<float,2>{0.690372944f, 0.200010553f},
-std::array<float,2>{0.606340945f, 0.507781088f},
-std::array<float,2>{0.427995384f, 0.0807107687f},
-std::array<float,2>{0.242368296f, 0.968499899f},
-std::array<float,2>{0.837946653f, 0.375191927f},
-std::array<float,2>{0.645227432f, 0.881295145f},
-std::array<float,2>{0.301178038f, 0.461159766f},
-std::array<float,2>{0.0350870974f, 0.601256788f},
-std::array<float,2>{0.881380558f, 0.0182037596f},
-std::array<float,2>{0.803338826f, 0.631393194f},
-std::array<float,2>{0.185946003f, 0.169192418f},
-std::array<float,2>{0.439460367f, 0.863984048f},
-std::array<float,2>{0.508580506f, 0.310150415f},
-std::array<float,2>{0.851078689f, 0.978835583f},
-std::array<float,2>{0.209030837f, 0.431360334f},
-std::array<float,2>{0.404686093f, 0.531707823f},
-std::array<float,2>{0.567529202f, 0.108164147f},
-std::array<float,2>{0.749040842f, 0.710922062f},
-std::array<float,2>{0.316752851f, 0.238672897f},
-std::array<float,2>{0.084895961f, 0.776203096f},
-std::array<float,2>{0.983055949f, 0.358997345f},
-std::array<float,2>{0.549163759f, 0.82220006f},
-std::array<float,2>{0.499220431f, 0.261737645f},
-std::array<float,2>{0.148138419f, 0.669559717f},
-std::array<float,2>{0.755329192f, 0.149547577f},
-std::array<float,2>{0.915670395f, 0.573098242f},
-std::array<float,2>{0.0192225017f, 0.0528640561f},
-std::array<float,2>{0.258836329f, 0.927745104f},
-std::array<float,2>{0.676486135f, 0.46990034f},
-std::array<float,2>{0.902043879f, 0.909534454f},
-std::array<float,2>{0.051676929f, 0.498587132f},
-std::array<float,2>{0.295996547f, 0.579940677f},
-std::array<float,2>{0.634983242f, 0.0403458029f},
-std::array<float,2>{0.522368789f, 0.685486317f},
-std::array<float,2>{0.453741342f, 0.129850879f},
-std::array<float,2>{0.168243229f, 0.838827014f},
-std::array<float,2>{0.791929066f, 0.275638133f},
-std::array<float,2>{0.712633491f, 0.75151515f},
-std::array<float,2>{0.3551386f, 0.365452915f},
-std::array<float,2>{0.109602384f, 0.698443413f},
-std::array<float,2>{0.968514204f, 0.233347431f},
-std::array<float,2>{0.823398173f, 0.552867293f},
-std::array<float,2>{0.224510193f, 0.118920587f},
-std::array<float,2>{0.408125371f, 0.987576246f},
-std::array<float,2>{0.623454094f, 0.413087785f},
-std::array<float,2>{0.775267899f, 0.847072244f},
-std::array<float,2>{0.134745613f, 0.288025528f},
-std::array<float,2>{0.470131665f, 0.644743621f},
-std::array<float,2>{0.539583623f, 0.182421893f},
-std::array<float,2>{0.669066906f, 0.611029029f},
-std::array<float,2>{0.26934123f, 0.00126621418f},
-std::array<float,2>{0.0114736483f, 0.900241077f},
-std::array<float,2>{0.935827374f, 0.443292856f},
-std::array<float,2>{0.58955431f, 0.949276507f},
-std::array<float,2>{0.389205694f, 0.392054379f},
-std::array<float,2>{0.199141651f, 0.51938045f},
-std::array<float,2>{0.860315621f, 0.0714070052f},
-std::array<float,2>{0.992135644f, 0.740712166f},
-std::array<float,2>{0.0625651553f, 0.208384529f},
-std::array<float,2>{0.333824664f, 0.801880598f},
-std::array<float,2>{0.727189302f, 0.343574643f},
-std::array<float,2>{0.876281559f, 0.764045775f},
-std::array<float,2>{0.0371911488f, 0.370383412f},
-std::array<float,2>{0.297621191f, 0.693963945f},
-std::array<float,2>{0.643626988f, 0.223015547f},
-std::array<float,2>{0.515065312f, 0.555798829f},
-std::array<float,2>{0.44269067f, 0.115123451f},
-std::array<float,2>{0.181341335f, 0.994851589f},
-std::array<float,2>{0.799928188f, 0.417488098f},
-std::array<float,2>{0.692800999f, 0.916837215f},
-std::array<float,2>{0.366582394f, 0.485490322f},
-std::array<float,2>{0.107306726f, 0.58824116f},
-std::array<float,2>{0.940185308f, 0.0365517959f},
-std::array<float,2>{0.843696952f, 0.673081517f},
-std::array<float,2>{0.248734653f, 0.138867661f},
-std::array<float,2>{0.423148423f, 0.831500471f},
-std::array<float,2>{0.601828694f, 0.26585716f},
-std::array<float,2>{0.750451684f, 0.945282757f},
-std::array<float,2>{0.142833546f, 0.398956031f},
-std::array<float,2>{0.496051311f, 0.527780592f},
-std::array<float,2>{0.553162217f, 0.0699441954f},
-std::array<float,2>{0.673336267f, 0.748719394f},
-std::array<float,2>{0.263207912f, 0.214846238f},
-std::array<float,2>{0.0209291596f, 0.804727137f},
-std::array<float,2>{0.919245303f, 0.332336754f},
-std::array<float,2>{0.565472424f, 0.853273988f},
-std::array<float,2>{0.401262522f, 0.294597596f},
-std::array<float,2>{0.204122052f, 0.648497701f},
-std::array<float,2>{0.845595837f, 0.1765811f},
-std::array<float,2>{0.980313778f, 0.61971277f},
-std::array<float,2>{0.0810385793f, 0.0113455141f},
-std::array<float,2>{0.313335598f, 0.898033381f},
-std::array<float,2>{0.745234787f, 0.447846949f},
-std::array<float,2>{0.96262759f, 0.883427441f},
-std::array<float,2>{0.116684705f, 0.454949141f},
-std::array<float,2>{0.356230795f, 0.605794668f},
-std::array<float,2>{0.718355477f, 0.0310274009f},
-std::array<float,2>{0.618665338f, 0.640293419f},
-std::array<float,2>{0.411459476f, 0.161309108f},
-std::array<float,2>{0.221375018f, 0.874310911f},
-std::array<float,2>{0.825010002f, 0.299767464f},
-std::array<float,2>{0.638018608f, 0.786390126f},
-std::array<float,2>{0.291492075f, 0.326197803f},
-std::array<float,2>{0.0496048369f, 0.725250542f},
-std::array<float,2>{0.905479729f, 0.193081841f},
-std::array<float,2>{0.795448124f, 0.509529114f},
-std::array<float,2>{0.164804205f, 0.0884273946f},
-std::array<float,2>{0.457470506f, 0.957227767f},
-std::array<float,2>{0.516395867f, 0.390099972f},
-std::array<float,2>{0.863702595f, 0.812507212f},
-std::array<float,2>{0.201826811f, 0.25588432f},
-std::array<float,2>{0.384332776f, 0.657640576f},
-std::array<float,2>{0.591807723f, 0.145906687f},
-std::array<float,2>{0.731264293f, 0.565239429f},
-std::array<float,2>{0.328937829f, 0.0590322092f},
-std::array<float,2>{0.0682821199f, 0.9306916f},
-std::array<float,2>{0.984888852f, 0.480897844f},
-std::array<float,2>{0.543990374f, 0.97252655f},
-std::array<float,2>{0.474991769f, 0.426340967f},
-std::array<float,2>{0.137826294f, 0.540875196f},
-std::array<float,2>{0.778513253f, 0.0950285643f},
-std::array<float,2>{0.931868911f, 0.714441657f},
-std::array<float,2>{0.0147086261f, 0.247874081f},
-std::array<float,2>{0.272013605f, 0.770134032f},
-std::array<float,2>{0.665470839f, 0.349089593f},
-std::array<float,2>{0.997436047f, 0.860942841f},
-std::array<float,2>{0.076692529f, 0.306276888f},
-std::array<float,2>{0.339054525f, 0.627722502f},
-std::array<float,2>{0.721751332f, 0.16731745f},
-std::array<float,2>{0.584427714f, 0.593948662f},
-std::array<float,2>{0.378763527f, 0.0224226974f},
-std::array<float,2>{0.19034332f, 0.877255917f},
-std::array<float,2>{0.869932771f, 0.467408299f},
-std::array<float,2>{0.658691525f, 0.961593091f},
-std::array<float,2>{0.275794327f, 0.381307334f},
-std::array<float,2>{0.00384345255f, 0.501491666f},
-std::array<float,2>{0.928939462f, 0.0821109489f},
-std::array<float,2>{0.771532834f, 0.734271288f},
-std::array<float,2>{0.126037553f, 0.196917415f},
-std::array<float,2>{0.483047098f, 0.796248674f},
-std::array<float,2>{0.53215158f, 0.315686524f},
-std::array<float,2>{0.819306672f, 0.922999382f},
-std::array<float,2>{0.227548555f, 0.474163324f},
-std::array<float,2>{0.421285242f, 0.575856805f},
-std::array<float,2>{0.615356326f, 0.0484541468f},
-std::array<float,2>{0.710206687f, 0.667897522f},
-std::array<float,2>{0.349096745f, 0.153311133f},
-std::array<float,2>{0.117998049f, 0.828124464f},
-std::array<float,2>{0.954523623f, 0.257959872f},
-std::array<float,2>{0.524298191f, 0.780072808f},
-std::array<float,2>{0.460985601f, 0.353389353f},
-std::array<float,2>{0.162936091f, 0.706339538f},
-std::array<float,2>{0.784743547f, 0.235972553f},
-std::array<float,2>{0.897327304f, 0.537021041f},
-std::array<float,2>{0.0555953458f, 0.103136875f},
-std::array<float,2>{0.287677467f, 0.982962906f},
-std::array<float,2>{0.629070938f, 0.43532005f},
-std::array<float,2>{0.90957123f, 0.991898179f},
-std::array<float,2>{0.0241358057f, 0.407322317f},
-std::array<float,2>{0.256224871f, 0.548499942f},
-std::array<float,2>{0.687191427f, 0.123276256f},
-std::array<float,2>{0.562361002f, 0.700947106f},
-std::array<float,2>{0.485135376f, 0.22829394f},
-std::array<float,2>{0.154158533f, 0.75762409f},
-std::array<float,2>{0.762368321f, 0.361848086f},
-std::array<float,2>{0.739334345f, 0.843575835f},
-std::array<float,2>{0.326861769f, 0.280687779f},
-std::array<float,2>{0.0881266519f, 0.68116647f},
-std::array<float,2>{0.971917927f, 0.126243442f},
-std::array<float,2>{0.852783442f, 0.585233867f},
-std::array<float,2>{0.214924455f, 0.0452564657f},
-std::array<float,2>{0.397992939f, 0.91227001f},
-std::array<float,2>{0.575773716f, 0.493756592f},
-std::array<float,2>{0.809694946f, 0.798074603f},
-std::array<float,2>{0.176271543f, 0.339480579f},
-std::array<float,2>{0.450889051f, 0.737148106f},
-std::array<float,2>{0.50205332f, 0.206433222f},
-std::array<float,2>{0.655117154f, 0.520750821f},
-std::array<float,2>{0.311572552f, 0.0774910077f},
-std::array<float,2>{0.046739202f, 0.948162258f},
-std::array<float,2>{0.890384018f, 0.397044659f},
-std::array<float,2>{0.600963116f, 0.905939043f},
-std::array<float,2>{0.431697309f, 0.439906925f},
-std::array<float,2>{0.238817722f, 0.616344512f},
-std::array<float,2>{0.83240813f, 0.00775713706f},
-std::array<float,2>{0.947342932f, 0.640995443f},
-std::array<float,2>{0.0976285562f, 0.186312586f},
-std::array<float,2>{0.370919406f, 0.850842893f},
-std::array<float,2>{0.698937893f, 0.282934278f},
-std::array<float,2>{0.911147535f, 0.8686288f},
-std::array<float,2>{0.0307680275f, 0.303585798f},
-std::array<float,2>{0.253243148f, 0.636034608f},
-std::array<float,2>{0.681414545f, 0.15906392f},
-std::array<float,2>{0.556524396f, 0.602855742f},
-std::array<float,2>{0.488751829f, 0.024057677f},
-std::array<float,2>{0.149032012f, 0.888374269f},
-std::array<float,2>{0.760074437f, 0.458707094f},
-std::array<float,2>{0.737580538f, 0.956370294f},
-std::array<float,2>{0.324002385f, 0.386565894f},
-std::array<float,2>{0.0934268087f, 0.513509452f},
-std::array<float,2>{0.973125637f, 0.0903818011f},
-std::array<float,2>{0.85714072f, 0.719354331f},
-std::array<float,2>{0.213408008f, 0.189784348f},
-std::array<float,2>{0.393589735f, 0.781863809f},
-std::array<float,2>{0.572166443f, 0.32243225f},
-std::array<float,2>{0.807053685f, 0.935093284f},
-std::array<float,2>{0.172758088f, 0.477343738f},
-std::array<float,2>{0.445418f, 0.567868352f},
-std::array<float,2>{0.506934643f, 0.0581724606f},
-std::array<float,2>{0.65081954f, 0.663651288f},
-std::array<float,2>{0.307090312f, 0.143309012f},
-std::array<float,2>{0.0417858064f, 0.818514526f},
-std::array<float,2>{0.886051774f, 0.252994716f},
-std::array<float,2>{0.594574332f, 0.767134964f},
-std::array<float,2>{0.434611112f, 0.347204536f},
-std::array<float,2>{0.235054106f, 0.716928542f},
-std::array<float,2>{0.830630302f, 0.24557057f},
-std::array<float,2>{0.950577736f, 0.543774426f},
-std::array<float,2>{0.0984328091f, 0.100113414f},
-std::array<float,2>{0.374415815f, 0.972761989f},
-std::array<float,2>{0.702835858f, 0.425729662f},
-std::array<float,2>{0.992213309f, 0.996574938f},
-std::array<float,2>{0.072569631f, 0.418015242f},
-std::array<float,2>{0.342574f, 0.560896933f},
-std::array<float,2>{0.725819349f, 0.110207759f},
-std::array<float,2>{0.57910037f, 0.688550174f},
-std::array<float,2>{0.380734742f, 0.219128758f},
-std::array<float,2>{0.192465365f, 0.758458555f},
-std::array<float,2>{0.871109009f, 0.371222079f},
-std::array<float,2>{0.661496043f, 0.835297704f},
-std::array<float,2>{0.280582637f, 0.271401644f},
-std::array<float,2>{0.00623553572f, 0.678896308f},
-std::array<float,2>{0.924410999f, 0.135125279f},
-std::array<float,2>{0.768847644f, 0.593497455f},
-std::array<float,2>{0.132641375f, 0.0335641056f},
-std::array<float,2>{0.478465468f, 0.919492841f},
-std::array<float,2>{0.536487162f, 0.489301205f},
-std::array<float,2>{0.813676059f, 0.812207341f},
-std::array<float,2>{0.234355599f, 0.33165586f},
-std::array<float,2>{0.415768415f, 0.743323863f},
-std::array<float,2>{0.610940039f, 0.21376124f},
-std::array<float,2>{0.706913173f, 0.526392639f},
-std::array<float,2>{0.346253365f, 0.0628474951f},
-std::array<float,2>{0.123154067f, 0.939623773f},
-std::array<float,2>{0.957845151f, 0.402856559f},
-std::array<float,2>{0.528027475f, 0.89447093f},
-std::array<float,2>{0.466192454f, 0.450157106f},
-std::array<float,2>{0.159114987f, 0.623221993f},
-std::array<float,2>{0.786273122f, 0.0135950381f},
-std::array<float,2>{0.892835259f, 0.655001163f},
-std::array<float,2>{0.0602876283f, 0.174217612f},
-std::array<float,2>{0.28164646f, 0.857554913f},
-std::array<float,2>{0.625632107f, 0.291748941f},
-std::array<float,2>{0.967754543f, 0.753456354f},
-std::array<float,2>{0.111161329f, 0.364576966f},
-std::array<float,2>{0.354212254f, 0.696702242f},
-std::array<float,2>{0.711882532f, 0.232177004f},
-std::array<float,2>{0.624279797f, 0.550949335f},
-std::array<float,2>{0.407212347f, 0.119927026f},
-std::array<float,2>{0.223331511f, 0.986194968f},
-std::array<float,2>{0.822831213f, 0.411289066f},
-std::array<float,2>{0.635829866f, 0.90672332f},
-std::array<float,2>{0.29562524f, 0.496217489f},
-std::array<float,2>{0.0525698029f, 0.581995368f},
-std::array<float,2>{0.900586069f, 0.041872602f},
-std::array<float,2>{0.792060912f, 0.686084986f},
-std::array<float,2>{0.169320151f, 0.132501736f},
-std::array<float,2>{0.454755127f, 0.837392092f},
-std::array<float,2>{0.523301601f, 0.274064094f},
-std::array<float,2>{0.861048758f, 0.951710701f},
-std::array<float,2>{0.19820331f, 0.394479036f},
-std::array<float,2>{0.390417665f, 0.515816569f},
-std::array<float,2>{0.588458836f, 0.0728626549f},
-std::array<float,2>{0.727823317f, 0.739101529f},
-std::array<float,2>{0.332734257f, 0.210113958f},
-std::array<float,2>{0.0644305572f, 0.803946435f},
-std::array<float,2>{0.990290284f, 0.341501564f},
-std::array<float,2>{0.540770113f, 0.843782008f},
-std::array<float,2>{0.468797863f, 0.285216659f},
-std::array<float,2>{0.133498982f, 0.646875322f},
-std::array<float,2>{0.773931205f, 0.180125684f},
-std::array<float,2>{0.93679899f, 0.612600565f},
-std::array<float,2>{0.00988914352f, 0.00334723596f},
-std::array<float,2>{0.268507272f, 0.901246846f},
-std::array<float,2>{0.66801846f, 0.444367051f},
-std::array<float,2>{0.882183969f, 0.880747974f},
-std::array<float,2>{0.0333997272f, 0.46412468f},
-std::array<float,2>{0.302485168f, 0.598144114f},
-std::array<float,2>{0.646129966f, 0.0173575394f},
-std::array<float,2>{0.509669483f, 0.630377829f},
-std::array<float,2>{0.441301674f, 0.170314848f},
-std::array<float,2>{0.186668649f, 0.866287172f},
-std::array<float,2>{0.804086804f, 0.311193287f},
-std::array<float,2>{0.690973759f, 0.790603638f},
-std::array<float,2>{0.359452039f, 0.317647457f},
-std::array<float,2>{0.105219424f, 0.730017424f},
-std::array<float,2>{0.943414688f, 0.202994362f},
-std::array<float,2>{0.839161575f, 0.505035818f},
-std::array<float,2>{0.243197605f, 0.0787777528f},
-std::array<float,2>{0.428893507f, 0.966172457f},
-std::array<float,2>{0.606463611f, 0.378363758f},
-std::array<float,2>{0.754449487f, 0.823020995f},
-std::array<float,2>{0.146903589f, 0.264959782f},
-std::array<float,2>{0.498068184f, 0.671001792f},
-std::array<float,2>{0.550655663f, 0.152215138f},
-std::array<float,2>{0.676960766f, 0.572057784f},
-std::array<float,2>{0.258106083f, 0.0515803471f},
-std::array<float,2>{0.0180180054f, 0.926793396f},
-std::array<float,2>{0.91418767f, 0.472005874f},
-std::array<float,2>{0.567331076f, 0.978092551f},
-std::array<float,2>{0.406056345f, 0.431945324f},
-std::array<float,2>{0.210454851f, 0.533729672f},
-std::array<float,2>{0.850252986f, 0.106562451f},
-std::array<float,2>{0.984154105f, 0.707768559f},
-std::array<float,2>{0.0851727799f, 0.240690529f},
-std::array<float,2>{0.317893088f, 0.774939597f},
-std::array<float,2>{0.748694479f, 0.356821805f},
-std::array<float,2>{0.905059159f, 0.78877455f},
-std::array<float,2>{0.0498388819f, 0.324598014f},
-std::array<float,2>{0.292611003f, 0.72368741f},
-std::array<float,2>{0.637469709f, 0.193849415f},
-std::array<float,2>{0.517158091f, 0.510111809f},
-std::array<float,2>{0.45846352f, 0.0876972675f},
-std::array<float,2>{0.165328249f, 0.959284008f},
-std::array<float,2>{0.796584308f, 0.386722296f},
-std::array<float,2>{0.71756351f, 0.88599503f},
-std::array<float,2>{0.35711208f, 0.456884027f},
-std::array<float,2>{0.115469374f, 0.60861975f},
-std::array<float,2>{0.961527109f, 0.0289747696f},
-std::array<float,2>{0.826108098f, 0.638349056f},
-std::array<float,2>{0.222614318f, 0.163549796f},
-std::array<float,2>{0.410957754f, 0.871495485f},
-std::array<float,2>{0.617219925f, 0.298407257f},
-std::array<float,2>{0.777796149f, 0.968986809f},
-std::array<float,2>{0.136796415f, 0.429231435f},
-std::array<float,2>{0.476197392f, 0.542303383f},
-std::array<float,2>{0.543400288f, 0.0974454507f},
-std::array<float,2>{0.664740384f, 0.71115458f},
-std::array<float,2>{0.272523761f, 0.248360798f},
-std::array<float,2>{0.0139901387f, 0.772462547f},
-std::array<float,2>{0.932891369f, 0.351052463f},
-std::array<float,2>{0.593239307f, 0.815341711f},
-std::array<float,2>{0.383498371f, 0.255411178f},
-std::array<float,2>{0.202167347f, 0.66002059f},
-std::array<float,2>{0.864586234f, 0.147738695f},
-std::array<float,2>{0.98576802f, 0.563991368f},
-std::array<float,2>{0.0673765168f, 0.0624560714f},
-std::array<float,2>{0.329863369f, 0.933044255f},
-std::array<float,2>{0.732207775f, 0.483839065f},
-std::array<float,2>{0.941117644f, 0.915745735f},
-std::array<float,2>{0.105481327f, 0.488232076f},
-std::array<float,2>{0.366099864f, 0.586852551f},
-std::array<float,2>{0.692211151f, 0.0380665921f},
-std::array<float,2>{0.603458822f, 0.674323857f},
-std::array<float,2>{0.422663003f, 0.138487786f},
-std::array<float,2>{0.249613062f, 0.829081535f},
-std::array<float,2>{0.842355967f, 0.268093437f},
-std::array<float,2>{0.643424332f, 0.763466239f},
-std::array<float,2>{0.298136741f, 0.367981374f},
-std::array<float,2>{0.0388902016f, 0.693325043f},
-std::array<float,2>{0.875003874f, 0.22609131f},
-std::array<float,2>{0.799393952f, 0.55664593f},
-std::array<float,2>{0.180105984f, 0.116652153f},
-std::array<float,2>{0.441801995f, 0.99326086f},
-std::array<float,2>{0.513748884f, 0.415386826f},
-std::array<float,2>{0.84439671f, 0.854430914f},
-std::array<float,2>{0.203560576f, 0.296703994f},
-std::array<float,2>{0.40146637f, 0.651168466f},
-std::array<float,2>{0.564982593f, 0.178849474f},
-std::array<float,2>{0.744481802f, 0.617543459f},
-std::array<float,2>{0.313684523f, 0.00811185595f},
-std::array<float,2>{0.0814030245f, 0.894546032f},
-std::array<float,2>{0.978818655f, 0.445815176f},
-std::array<float,2>{0.554384947f, 0.942236006f},
-std::array<float,2>{0.494204998f, 0.40049243f},
-std::array<float,2>{0.143941864f, 0.529721558f},
-std::array<float,2>{0.75158757f, 0.0666514114f},
-std::array<float,2>{0.918676078f, 0.74689579f},
-std::array<float,2>{0.0195357725f, 0.217302248f},
-std::array<float,2>{0.26210767f, 0.807849407f},
-std::array<float,2>{0.672710598f, 0.334010541f},
-std::array<float,2>{0.971061468f, 0.840661347f},
-std::array<float,2>{0.0889183804f, 0.27927053f},
-std::array<float,2>{0.327530295f, 0.683032095f},
-std::array<float,2>{0.738903642f, 0.127636373f},
-std::array<float,2>{0.574717879f, 0.583305717f},
-std::array<float,2>{0.397190422f, 0.0446356051f},
-std::array<float,2>{0.216243923f, 0.911673427f},
-std::array<float,2>{0.852388024f, 0.495701432f},
-std::array<float,2>{0.686450183f, 0.989090025f},
-std::array<float,2>{0.25732711f, 0.410112977f},
-std::array<float,2>{0.0249176063f, 0.548886061f},
-std::array<float,2>{0.908339798f, 0.1221008f},
-std::array<float,2>{0.763511181f, 0.701343238f},
-std::array<float,2>{0.153287455f, 0.229292288f},
-std::array<float,2>{0.48559013f, 0.755302608f},
-std::array<float,2>{0.560949504f, 0.360810488f},
-std::array<float,2>{0.833051503f, 0.903212607f},
-std::array<float,2>{0.239378631f, 0.437510788f},
-std::array<float,2>{0.433095783f, 0.613629282f},
-std::array<float,2>{0.599694014f, 0.00524381688f},
-std::array<float,2>{0.698008001f, 0.643489778f},
-std::array<float,2>{0.369494766f, 0.184713781f},
-std::array<float,2>{0.0957166776f, 0.847941041f},
-std::array<float,2>{0.948988199f, 0.284148872f},
-std::array<float,2>{0.503571093f, 0.798865676f},
-std::array<float,2>{0.44964999f, 0.336283386f},
-std::array<float,2>{0.176826507f, 0.735573411f},
-std::array<float,2>{0.809378624f, 0.204293638f},
-std::array<float,2>{0.889172435f, 0.522863209f},
-std::array<float,2>{0.0449973382f, 0.0744429678f},
-std::array<float,2>{0.311400145f, 0.946497262f},
-std::array<float,2>{0.6553213f, 0.394534975f},
-std::array<float,2>{0.927922606f, 0.964224756f},
-std::array<float,2>{0.00238476158f, 0.380460382f},
-std::array<float,2>{0.277195722f, 0.503834367f},
-std::array<float,2>{0.660035968f, 0.0842493549f},
-std::array<float,2>{0.533055365f, 0.730823338f},
-std::array<float,2>{0.483622134f, 0.198108882f},
-std::array<float,2>{0.125380144f, 0.794277787f},
-std::array<float,2>{0.772865534f, 0.312995166f},
-std::array<float,2>{0.720727384f, 0.862099707f},
-std::array<float,2>{0.338564277f, 0.307545453f},
-std::array<float,2>{0.0781140327f, 0.625529528f},
-std::array<float,2>{0.997061193f, 0.164639801f},
-std::array<float,2>{0.870516002f, 0.596451998f},
-std::array<float,2>{0.191356972f, 0.0204380881f},
-std::array<float,2>{0.377299726f, 0.875575066f},
-std::array<float,2>{0.585562766f, 0.465648323f},
-std::array<float,2>{0.783551872f, 0.778176963f},
-std::array<float,2>{0.163642839f, 0.355282724f},
-std::array<float,2>{0.462690473f, 0.703816116f},
-std::array<float,2>{0.525308788f, 0.237260163f},
-std::array<float,2>{0.630625904f, 0.537474215f},
-std::array<float,2>{0.288086206f, 0.105239406f},
-std::array<float,2>{0.0559464805f, 0.981990635f},
-std::array<float,2>{0.897705793f, 0.436909825f},
-std::array<float,2>{0.61687535f, 0.924067557f},
-std::array<float,2>{0.42033866f, 0.475177169f},
-std::array<float,2>{0.22685045f, 0.576283932f},
-std::array<float,2>{0.81995672f, 0.0497945696f},
-std::array<float,2>{0.953226984f, 0.665750265f},
-std::array<float,2>{0.118874416f, 0.155464858f},
-std::array<float,2>{0.348558903f, 0.824582279f},
-std::array<float,2>{0.709607422f, 0.26092273f},
-std::array<float,2>{0.884522319f, 0.817217886f},
-std::array<float,2>{0.0408677123f, 0.251448572f},
-std::array<float,2>{0.30626744f, 0.660753667f},
-std::array<float,2>{0.650058091f, 0.142576158f},
-std::array<float,2>{0.505023718f, 0.569870591f},
-std::array<float,2>{0.447492301f, 0.0549161993f},
-std::array<float,2>{0.174194589f, 0.936025977f},
-std::array<float,2>{0.80627048f, 0.47945416f},
-std::array<float,2>{0.699664116f, 0.974841833f},
-std::array<float,2>{0.371427804f, 0.423153102f},
-std::array<float,2>{0.0999382436f, 0.545449436f},
-std::array<float,2>{0.953065813f, 0.0991689786f},
-std::array<float,2>{0.829715431f, 0.716314137f},
-std::array<float,2>{0.236699194f, 0.243112788f},
-std::array<float,2>{0.437171608f, 0.768984437f},
-std::array<float,2>{0.596479714f, 0.344468325f},
-std::array<float,2>{0.759132862f, 0.889098287f},
-std::array<float,2>{0.151100293f, 0.460247874f},
-std::array<float,2>{0.491712451f, 0.604618847f},
-std::array<float,2>{0.556653559f, 0.0258550141f},
-std::array<float,2>{0.683449268f, 0.632892787f},
-std::array<float,2>{0.250407547f, 0.156524166f},
-std::array<float,2>{0.0276144911f, 0.870879769f},
-std::array<float,2>{0.912783265f, 0.30165863f},
-std::array<float,2>{0.572451413f, 0.784231961f},
-std::array<float,2>{0.390853584f, 0.320553631f},
-std::array<float,2>{0.211766034f, 0.720847547f},
-std::array<float,2>{0.858391345f, 0.188549772f},
-std::array<float,2>{0.975144684f, 0.513988435f},
-std::array<float,2>{0.0902906135f, 0.0920943841f},
-std::array<float,2>{0.322073042f, 0.954190373f},
-std::array<float,2>{0.735980451f, 0.383095413f},
-std::array<float,2>{0.960621238f, 0.93919754f},
-std::array<float,2>{0.122232504f, 0.40485543f},
-std::array<float,2>{0.344404161f, 0.524766862f},
-std::array<float,2>{0.703471661f, 0.0660941675f},
-std::array<float,2>{0.612077892f, 0.74429059f},
-std::array<float,2>{0.416481227f, 0.211558774f},
-std::array<float,2>{0.231971681f, 0.810268223f},
-std::array<float,2>{0.815564573f, 0.329295725f},
-std::array<float,2>{0.627021074f, 0.857250214f},
-std::array<float,2>{0.284719765f, 0.289190531f},
-std::array<float,2>{0.0608724691f, 0.652435124f},
-std::array<float,2>{0.892342508f, 0.172450036f},
-std::array<float,2>{0.78850168f, 0.622006297f},
-std::array<float,2>{0.156358987f, 0.0147470124f},
-std::array<float,2>{0.468256384f, 0.890808046f},
-std::array<float,2>{0.530389369f, 0.45295921f},
-std::array<float,2>{0.873581231f, 0.761361122f},
-std::array<float,2>{0.193968982f, 0.373400718f},
-std::array<float,2>{0.382560819f, 0.690592766f},
-std::array<float,2>{0.580217361f, 0.221431166f},
-std::array<float,2>{0.723252833f, 0.560459495f},
-std::array<float,2>{0.341177195f, 0.111760139f},
-std::array<float,2>{0.0715501383f, 0.99833864f},
-std::array<float,2>{0.995094419f, 0.421857715f},
-std::array<float,2>{0.538128674f, 0.920291364f},
-std::array<float,2>{0.479708046f, 0.491679221f},
-std::array<float,2>{0.129443556f, 0.590132356f},
-std::array<float,2>{0.766192973f, 0.0315623917f},
-std::array<float,2>{0.923684359f, 0.677295327f},
-std::array<float,2>{0.00557271997f, 0.134025231f},
-std::array<float,2>{0.278798968f, 0.832877219f},
-std::array<float,2>{0.662223756f, 0.272541136f},
-std::array<float,2>{0.990071535f, 0.801635504f},
-std::array<float,2>{0.0652459562f, 0.342655569f},
-std::array<float,2>{0.334991783f, 0.741653919f},
-std::array<float,2>{0.729590058f, 0.207430407f},
-std::array<float,2>{0.586114347f, 0.518473923f},
-std::array<float,2>{0.387526214f, 0.070474416f},
-std::array<float,2>{0.196718574f, 0.950677872f},
-std::array<float,2>{0.862153471f, 0.391283542f},
-std::array<float,2>{0.670122743f, 0.89909637f},
-std::array<float,2>{0.265733749f, 0.441948056f},
-std::array<float,2>{0.0093322508f, 0.610156476f},
-std::array<float,2>{0.934787869f, 0.000724444399f},
-std::array<float,2>{0.776513994f, 0.64585799f},
-std::array<float,2>{0.136440396f, 0.182955652f},
-std::array<float,2>{0.471520156f, 0.845900357f},
-std::array<float,2>{0.541300058f, 0.288465589f},
-std::array<float,2>{0.821809828f, 0.986851215f},
-std::array<float,2>{0.225188807f, 0.4126724f},
-std::array<float,2>{0.408467948f, 0.554640055f},
-std::array<float,2>{0.622555315f, 0.11758931f},
-std::array<float,2>{0.714565456f, 0.697712898f},
-std::array<float,2>{0.352303863f, 0.233919755f},
-std::array<float,2>{0.113038398f, 0.750315249f},
-std::array<float,2>{0.966560185f, 0.366389751f},
-std::array<float,2>{0.52141273f, 0.839673638f},
-std::array<float,2>{0.4559533f, 0.276785195f},
-std::array<float,2>{0.17114906f, 0.683808982f},
-std::array<float,2>{0.790012062f, 0.130683631f},
-std::array<float,2>{0.900364995f, 0.578864992f},
-std::array<float,2>{0.0534786843f, 0.0396941118f},
-std::array<float,2>{0.294286579f, 0.908327401f},
-std::array<float,2>{0.633337379f, 0.49937278f},
-std::array<float,2>{0.917862773f, 0.928758979f},
-std::array<float,2>{0.016422797f, 0.469493151f},
-std::array<float,2>{0.259963155f, 0.574074566f},
-std::array<float,2>{0.67927438f, 0.0538808964f},
-std::array<float,2>{0.546996534f, 0.668756962f},
-std::array<float,2>{0.496458292f, 0.149294928f},
-std::array<float,2>{0.146166325f, 0.82082814f},
-std::array<float,2>{0.756442428f, 0.263266951f},
-std::array<float,2>{0.746578932f, 0.776964068f},
-std::array<float,2>{0.319018096f, 0.357569665f},
-std::array<float,2>{0.0834573358f, 0.708998561f},
-std::array<float,2>{0.981470466f, 0.23999308f},
-std::array<float,2>{0.848781049f, 0.533002675f},
-std::array<float,2>{0.207492843f, 0.108799562f},
-std::array<float,2>{0.402643532f, 0.9800722f},
-std::array<float,2>{0.568395674f, 0.430240184f},
-std::array<float,2>{0.801627874f, 0.864751279f},
-std::array<float,2>{0.184169754f, 0.309330076f},
-std::array<float,2>{0.438314974f, 0.632591546f},
-std::array<float,2>{0.510613382f, 0.168322995f},
-std::array<float,2>{0.647849143f, 0.599995673f},
-std::array<float,2>{0.303035975f, 0.0187866259f},
-std::array<float,2>{0.0325358547f, 0.882421196f},
-std::array<float,2>{0.880035996f, 0.462621927f},
-std::array<float,2>{0.60777688f, 0.967365921f},
-std::array<float,2>{0.426369786f, 0.376414359f},
-std::array<float,2>{0.24540633f, 0.50618428f},
-std::array<float,2>{0.837159991f, 0.0819188058f},
-std::array<float,2>{0.942170978f, 0.727252901f},
-std::array<float,2>{0.103177272f, 0.200672135f},
-std::array<float,2>{0.362479687f, 0.792698026f},
-std::array<float,2>{0.688201487f, 0.319855243f},
-std::array<float,2>{0.930626631f, 0.770913363f},
-std::array<float,2>{0.0121552786f, 0.347831339f},
-std::array<float,2>{0.271397501f, 0.713018179f},
-std::array<float,2>{0.666635096f, 0.2463433f},
-std::array<float,2>{0.544977188f, 0.539820254f},
-std::array<float,2>{0.473054349f, 0.0943223611f},
-std::array<float,2>{0.140194014f, 0.971429765f},
-std::array<float,2>{0.780954838f, 0.426894277f},
-std::array<float,2>{0.734144568f, 0.930147827f},
-std::array<float,2>{0.330114216f, 0.48164326f},
-std::array<float,2>{0.0688487589f, 0.565669835f},
-std::array<float,2>{0.987293661f, 0.0597758293f},
-std::array<float,2>{0.866567373f, 0.65713042f},
-std::array<float,2>{0.200707033f, 0.145498484f},
-std::array<float,2>{0.385720491f, 0.813858211f},
-std::array<float,2>{0.591126502f, 0.25713861f},
-std::array<float,2>{0.793176949f, 0.958363593f},
-std::array<float,2>{0.167548746f, 0.389564544f},
-std::array<float,2>{0.460381627f, 0.508783698f},
-std::array<float,2>{0.518344998f, 0.089415513f},
-std::array<float,2>{0.640364885f, 0.725862861f},
-std::array<float,2>{0.289412677f, 0.192154586f},
-std::array<float,2>{0.0482555404f, 0.785460353f},
-std::array<float,2>{0.903834462f, 0.327371955f},
-std::array<float,2>{0.620455503f, 0.873156726f},
-std::array<float,2>{0.41244784f, 0.300547659f},
-std::array<float,2>{0.219570562f, 0.639002204f},
-std::array<float,2>{0.826726079f, 0.160167783f},
-std::array<float,2>{0.964405358f, 0.607375085f},
-std::array<float,2>{0.11488089f, 0.0295811407f},
-std::array<float,2>{0.357753038f, 0.884755969f},
-std::array<float,2>{0.715045989f, 0.453770667f},
-std::array<float,2>{0.977018714f, 0.896556318f},
-std::array<float,2>{0.0792707279f, 0.448315263f},
-std::array<float,2>{0.315539002f, 0.620400012f},
-std::array<float,2>{0.743912876f, 0.010643186f},
-std::array<float,2>{0.562800705f, 0.649720192f},
-std::array<float,2>{0.39883402f, 0.17769748f},
-std::array<float,2>{0.205308229f, 0.852053285f},
-std::array<float,2>{0.84697485f, 0.293819278f},
-std::array<float,2>{0.675750434f, 0.806189597f},
-std::array<float,2>{0.265080422f, 0.333361983f},
-std::array<float,2>{0.0218330026f, 0.749226809f},
-std::array<float,2>{0.921707034f, 0.216560706f},
-std::array<float,2>{0.75199163f, 0.529239297f},
-std::array<float,2>{0.141907841f, 0.0689821094f},
-std::array<float,2>{0.492656499f, 0.944162607f},
-std::array<float,2>{0.551046848f, 0.399544448f},
-std::array<float,2>{0.84037596f, 0.830721259f},
-std::array<float,2>{0.247713864f, 0.267534405f},
-std::array<float,2>{0.4239344f, 0.672333002f},
-std::array<float,2>{0.605452478f, 0.139746577f},
-std::array<float,2>{0.694316745f, 0.589025736f},
-std::array<float,2>{0.363916337f, 0.0354428664f},
-std::array<float,2>{0.108561069f, 0.917748034f},
-std::array<float,2>{0.938284636f, 0.485023201f},
-std::array<float,2>{0.513604283f, 0.995459735f},
-std::array<float,2>{0.444222152f, 0.41612491f},
-std::array<float,2>{0.182763264f, 0.555546045f},
-std::array<float,2>{0.797455907f, 0.114224054f},
-std::array<float,2>{0.877302885f, 0.694394886f},
-std::array<float,2>{0.0366552211f, 0.223721817f},
-std::array<float,2>{0.299206764f, 0.765533209f},
-std::array<float,2>{0.641907156f, 0.369714379f},
-std::array<float,2>{0.947093964f, 0.84983474f},
-std::array<float,2>{0.0955369547f, 0.282147974f},
-std::array<float,2>{0.368665576f, 0.642448068f},
-std::array<float,2>{0.695643246f, 0.186969191f},
-std::array<float,2>{0.599608183f, 0.6153543f},
-std::array<float,2>{0.430835515f, 0.00611752365f},
-std::array<float,2>{0.241458118f, 0.904806793f},
-std::array<float,2>{0.834033191f, 0.440576762f},
-std::array<float,2>{0.653692305f, 0.948338807f},
-std::array<float,2>{0.3098647f, 0.398111999f},
-std::array<float,2>{0.043574024f, 0.520075202f},
-std::array<float,2>{0.886733651f, 0.0763318017f},
-std::array<float,2>{0.811219275f, 0.737642288f},
-std::array<float,2>{0.178404078f, 0.205933645f},
-std::array<float,2>{0.452401906f, 0.797199667f},
-std::array<float,2>{0.501845777f, 0.338256747f},
-std::array<float,2>{0.855162919f, 0.913921535f},
-std::array<float,2>{0.21856454f, 0.492974371f},
-std::array<float,2>{0.396157742f, 0.584138632f},
-std::array<float,2>{0.577278316f, 0.0466233492f},
-std::array<float,2>{0.741226852f, 0.680465579f},
-std::array<float,2>{0.324821323f, 0.125775814f},
-std::array<float,2>{0.0875287727f, 0.84235543f},
-std::array<float,2>{0.969726205f, 0.280196339f},
-std::array<float,2>{0.559899569f, 0.755921781f},
-std::array<float,2>{0.487704247f, 0.362700492f},
-std::array<float,2>{0.155774817f, 0.70010525f},
-std::array<float,2>{0.764091611f, 0.226702243f},
-std::array<float,2>{0.906858683f, 0.547595978f},
-std::array<float,2>{0.0257961359f, 0.124511018f},
-std::array<float,2>{0.253917485f, 0.991150916f},
-std::array<float,2>{0.685401022f, 0.407029927f},
-std::array<float,2>{0.895294607f, 0.98375535f},
-std::array<float,2>{0.0573580191f, 0.434251219f},
-std::array<float,2>{0.286550015f, 0.535826147f},
-std::array<float,2>{0.631427944f, 0.101783767f},
-std::array<float,2>{0.52632755f, 0.70573765f},
-std::array<float,2>{0.464500189f, 0.234577969f},
-std::array<float,2>{0.161568448f, 0.780855536f},
-std::array<float,2>{0.782597959f, 0.351863027f},
-std::array<float,2>{0.708766162f, 0.826564074f},
-std::array<float,2>{0.351156771f, 0.258829206f},
-std::array<float,2>{0.119181193f, 0.666828811f},
-std::array<float,2>{0.955773771f, 0.153487295f},
-std::array<float,2>{0.818254054f, 0.574707806f},
-std::array<float,2>{0.229408622f, 0.047428038f},
-std::array<float,2>{0.418480575f, 0.92271626f},
-std::array<float,2>{0.613743663f, 0.473595768f},
-std::array<float,2>{0.770160854f, 0.795671642f},
-std::array<float,2>{0.128367394f, 0.314820975f},
-std::array<float,2>{0.48079583f, 0.733075142f},
-std::array<float,2>{0.53425926f, 0.196167707f},
-std::array<float,2>{0.657924473f, 0.500479996f},
-std::array<float,2>{0.274413735f, 0.0832771286f},
-std::array<float,2>{0.00169850898f, 0.962204039f},
-std::array<float,2>{0.927734017f, 0.382750869f},
-std::array<float,2>{0.583223581f, 0.8783831f},
-std::array<float,2>{0.376436144f, 0.468292922f},
-std::array<float,2>{0.188316584f, 0.595003903f},
-std::array<float,2>{0.868136764f, 0.0231038202f},
-std::array<float,2>{0.999789f, 0.62830919f},
-std::array<float,2>{0.0744727701f, 0.166728407f},
-std::array<float,2>{0.336243689f, 0.860178411f},
-std::array<float,2>{0.720343888f, 0.305057228f}}
\ No newline at end of file
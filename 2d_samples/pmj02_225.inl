@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.698039114f, 0.474945575f},
-std::array<float,2>{0.461236268f, 0.607600749f},
-std::array<float,2>{0.94179976f, 0.986411035f},
-std::array<float,2>{0.171388f, 0.17373164f},
-std::array<float,2>{0.781892955f, 0.0859482214f},
-std::array<float,2>{0.108477257f, 0.865745246f},
-std::array<float,2>{0.5126701f, 0.708626211f},
-std::array<float,2>{0.250234365f, 0.306543827f},
-std::array<float,2>{0.606595993f, 0.201179624f},
-std::array<float,2>{0.322747886f, 0.899223983f},
-std::array<float,2>{0.822132409f, 0.503994286f},
-std::array<float,2>{0.0622884259f, 0.378459334f},
-std::array<float,2>{0.932074487f, 0.359580547f},
-std::array<float,2>{0.233247712f, 0.674222469f},
-std::array<float,2>{0.679075837f, 0.762146175f},
-std::array<float,2>{0.404701799f, 0.00988519657f},
-std::array<float,2>{0.543522358f, 0.265512645f},
-std::array<float,2>{0.293798298f, 0.749936938f},
-std::array<float,2>{0.760835111f, 0.820234299f},
-std::array<float,2>{0.0641667992f, 0.123502679f},
-std::array<float,2>{0.998080432f, 0.143671408f},
-std::array<float,2>{0.13797234f, 0.941536784f},
-std::array<float,2>{0.731376886f, 0.575914681f},
-std::array<float,2>{0.477042198f, 0.443914354f},
-std::array<float,2>{0.652113557f, 0.0617586933f},
-std::array<float,2>{0.423211873f, 0.794782281f},
-std::array<float,2>{0.882183373f, 0.652747571f},
-std::array<float,2>{0.201861948f, 0.328027666f},
-std::array<float,2>{0.861445367f, 0.426576823f},
-std::array<float,2>{0.0221366901f, 0.531426132f},
-std::array<float,2>{0.577722609f, 0.907712758f},
-std::array<float,2>{0.349839211f, 0.241324201f},
-std::array<float,2>{0.592784703f, 0.391767144f},
-std::array<float,2>{0.361475468f, 0.526992679f},
-std::array<float,2>{0.847125411f, 0.879905999f},
-std::array<float,2>{0.0060648229f, 0.205876604f},
-std::array<float,2>{0.902933776f, 0.0261897668f},
-std::array<float,2>{0.217739403f, 0.777958632f},
-std::array<float,2>{0.637467206f, 0.663199484f},
-std::array<float,2>{0.406569839f, 0.352304637f},
-std::array<float,2>{0.740601063f, 0.170475841f},
-std::array<float,2>{0.4870314f, 0.973944008f},
-std::array<float,2>{0.971858799f, 0.61831367f},
-std::array<float,2>{0.148914471f, 0.497837305f},
-std::array<float,2>{0.781128705f, 0.281742483f},
-std::array<float,2>{0.0919593424f, 0.687505901f},
-std::array<float,2>{0.551062346f, 0.848687589f},
-std::array<float,2>{0.312132359f, 0.0760677457f},
-std::array<float,2>{0.659863651f, 0.334121883f},
-std::array<float,2>{0.383873105f, 0.639463961f},
-std::array<float,2>{0.920711517f, 0.811001599f},
-std::array<float,2>{0.237248287f, 0.0440041497f},
-std::array<float,2>{0.841997266f, 0.223935008f},
-std::array<float,2>{0.0427342467f, 0.936762273f},
-std::array<float,2>{0.617931604f, 0.555930078f},
-std::array<float,2>{0.341270655f, 0.407519192f},
-std::array<float,2>{0.517913043f, 0.101754844f},
-std::array<float,2>{0.277536094f, 0.842229962f},
-std::array<float,2>{0.811184108f, 0.727567077f},
-std::array<float,2>{0.113668665f, 0.268970698f},
-std::array<float,2>{0.963005543f, 0.454621881f},
-std::array<float,2>{0.175328657f, 0.578319311f},
-std::array<float,2>{0.714762807f, 0.958574951f},
-std::array<float,2>{0.440940797f, 0.134625584f},
-std::array<float,2>{0.629309654f, 0.419062674f},
-std::array<float,2>{0.414273798f, 0.551941097f},
-std::array<float,2>{0.896981061f, 0.92271173f},
-std::array<float,2>{0.208681315f, 0.229522571f},
-std::array<float,2>{0.857437432f, 0.0371114314f},
-std::array<float,2>{0.0140117891f, 0.802271545f},
-std::array<float,2>{0.584073901f, 0.632783473f},
-std::array<float,2>{0.371622354f, 0.337934434f},
-std::array<float,2>{0.558349907f, 0.131032392f},
-std::array<float,2>{0.298318952f, 0.967772484f},
-std::array<float,2>{0.767336011f, 0.591090143f},
-std::array<float,2>{0.081695579f, 0.461401165f},
-std::array<float,2>{0.980037272f, 0.274368376f},
-std::array<float,2>{0.142179534f, 0.725558221f},
-std::array<float,2>{0.746552706f, 0.828663349f},
-std::array<float,2>{0.498099178f, 0.100495048f},
-std::array<float,2>{0.612725079f, 0.34672752f},
-std::array<float,2>{0.335067838f, 0.669222236f},
-std::array<float,2>{0.828143239f, 0.77011919f},
-std::array<float,2>{0.0320823155f, 0.0168877784f},
-std::array<float,2>{0.910294592f, 0.212571084f},
-std::array<float,2>{0.246235386f, 0.886534452f},
-std::array<float,2>{0.665953755f, 0.522180855f},
-std::array<float,2>{0.382499605f, 0.405148298f},
-std::array<float,2>{0.710696101f, 0.0687746108f},
-std::array<float,2>{0.452840716f, 0.853788197f},
-std::array<float,2>{0.953821838f, 0.702250421f},
-std::array<float,2>{0.186156496f, 0.289521098f},
-std::array<float,2>{0.798640788f, 0.487949938f},
-std::array<float,2>{0.12497358f, 0.609891236f},
-std::array<float,2>{0.529325008f, 0.97885251f},
-std::array<float,2>{0.269946665f, 0.157247052f},
-std::array<float,2>{0.50658834f, 0.447978079f},
-std::array<float,2>{0.261089444f, 0.566107452f},
-std::array<float,2>{0.794360876f, 0.952756405f},
-std::array<float,2>{0.0938695297f, 0.155146912f},
-std::array<float,2>{0.952024043f, 0.113400973f},
-std::array<float,2>{0.162737727f, 0.824221194f},
-std::array<float,2>{0.689168334f, 0.735523105f},
-std::array<float,2>{0.45326966f, 0.250335962f},
-std::array<float,2>{0.682893395f, 0.249373481f},
-std::array<float,2>{0.398388922f, 0.91679287f},
-std::array<float,2>{0.92260772f, 0.546039701f},
-std::array<float,2>{0.2210657f, 0.436617881f},
-std::array<float,2>{0.813474715f, 0.313163936f},
-std::array<float,2>{0.0504462719f, 0.644523799f},
-std::array<float,2>{0.599757731f, 0.784115672f},
-std::array<float,2>{0.318938673f, 0.0489771515f},
-std::array<float,2>{0.725113988f, 0.299279124f},
-std::array<float,2>{0.470818281f, 0.714308977f},
-std::array<float,2>{0.98698926f, 0.870782137f},
-std::array<float,2>{0.13276498f, 0.0832249746f},
-std::array<float,2>{0.751528382f, 0.187075481f},
-std::array<float,2>{0.0739696994f, 0.995068729f},
-std::array<float,2>{0.533281982f, 0.598162055f},
-std::array<float,2>{0.284877986f, 0.477962464f},
-std::array<float,2>{0.565175056f, 0.00129956752f},
-std::array<float,2>{0.358837217f, 0.753521264f},
-std::array<float,2>{0.873691857f, 0.685492098f},
-std::array<float,2>{0.0247683823f, 0.372177124f},
-std::array<float,2>{0.883737683f, 0.390070796f},
-std::array<float,2>{0.189929798f, 0.513422072f},
-std::array<float,2>{0.640809298f, 0.895553887f},
-std::array<float,2>{0.435844868f, 0.188829288f},
-std::array<float,2>{0.744135141f, 0.380916327f},
-std::array<float,2>{0.493334264f, 0.502270639f},
-std::array<float,2>{0.980887294f, 0.905723333f},
-std::array<float,2>{0.146044418f, 0.197133124f},
-std::array<float,2>{0.770636797f, 0.0149949603f},
-std::array<float,2>{0.0836499855f, 0.75841701f},
-std::array<float,2>{0.560771465f, 0.678002477f},
-std::array<float,2>{0.302769512f, 0.363462597f},
-std::array<float,2>{0.580328405f, 0.177762687f},
-std::array<float,2>{0.369235069f, 0.989634812f},
-std::array<float,2>{0.85481143f, 0.605313301f},
-std::array<float,2>{0.0103947492f, 0.470858395f},
-std::array<float,2>{0.894324958f, 0.30929324f},
-std::array<float,2>{0.204447821f, 0.703546286f},
-std::array<float,2>{0.628573775f, 0.860179305f},
-std::array<float,2>{0.418532431f, 0.0927992761f},
-std::array<float,2>{0.524318516f, 0.323568612f},
-std::array<float,2>{0.266089648f, 0.649936676f},
-std::array<float,2>{0.801674664f, 0.791894138f},
-std::array<float,2>{0.1186295f, 0.0570137054f},
-std::array<float,2>{0.959005177f, 0.237596899f},
-std::array<float,2>{0.182844922f, 0.912918687f},
-std::array<float,2>{0.706163764f, 0.53888768f},
-std::array<float,2>{0.448238432f, 0.422905713f},
-std::array<float,2>{0.670244753f, 0.117466614f},
-std::array<float,2>{0.378651142f, 0.815932095f},
-std::array<float,2>{0.908736706f, 0.744600952f},
-std::array<float,2>{0.246018335f, 0.259878665f},
-std::array<float,2>{0.83295691f, 0.439735919f},
-std::array<float,2>{0.0379116088f, 0.572149158f},
-std::array<float,2>{0.617025733f, 0.938187897f},
-std::array<float,2>{0.32861656f, 0.146428555f},
-std::array<float,2>{0.594893873f, 0.49482432f},
-std::array<float,2>{0.316120386f, 0.6231848f},
-std::array<float,2>{0.818274856f, 0.9716658f},
-std::array<float,2>{0.0534814186f, 0.164405286f},
-std::array<float,2>{0.929598451f, 0.0712882951f},
-std::array<float,2>{0.224615157f, 0.845724583f},
-std::array<float,2>{0.686342061f, 0.69361645f},
-std::array<float,2>{0.393832535f, 0.28626895f},
-std::array<float,2>{0.691903114f, 0.209853783f},
-std::array<float,2>{0.458137542f, 0.875730872f},
-std::array<float,2>{0.948042691f, 0.529911697f},
-std::array<float,2>{0.156834915f, 0.398356616f},
-std::array<float,2>{0.790557742f, 0.356492579f},
-std::array<float,2>{0.0985871628f, 0.660083413f},
-std::array<float,2>{0.500883281f, 0.775761187f},
-std::array<float,2>{0.262061775f, 0.0307100862f},
-std::array<float,2>{0.644580781f, 0.273296297f},
-std::array<float,2>{0.431389719f, 0.731784582f},
-std::array<float,2>{0.8887012f, 0.837420404f},
-std::array<float,2>{0.192218706f, 0.10841912f},
-std::array<float,2>{0.870552719f, 0.137619808f},
-std::array<float,2>{0.0277886782f, 0.955600977f},
-std::array<float,2>{0.568444252f, 0.584460139f},
-std::array<float,2>{0.354193598f, 0.460133225f},
-std::array<float,2>{0.538421869f, 0.0421235226f},
-std::array<float,2>{0.287690043f, 0.805383921f},
-std::array<float,2>{0.754674315f, 0.633005917f},
-std::array<float,2>{0.0746823251f, 0.331100047f},
-std::array<float,2>{0.991793573f, 0.414019555f},
-std::array<float,2>{0.127657369f, 0.562039077f},
-std::array<float,2>{0.719729602f, 0.930602014f},
-std::array<float,2>{0.474115491f, 0.219353378f},
-std::array<float,2>{0.671984017f, 0.467352569f},
-std::array<float,2>{0.399609774f, 0.589490294f},
-std::array<float,2>{0.934316993f, 0.964014292f},
-std::array<float,2>{0.229857802f, 0.127569497f},
-std::array<float,2>{0.825261712f, 0.0945541486f},
-std::array<float,2>{0.057491526f, 0.834099233f},
-std::array<float,2>{0.604627848f, 0.719441354f},
-std::array<float,2>{0.32744202f, 0.277578056f},
-std::array<float,2>{0.508224785f, 0.232049301f},
-std::array<float,2>{0.256540328f, 0.927407563f},
-std::array<float,2>{0.787390828f, 0.549020767f},
-std::array<float,2>{0.103631958f, 0.417011142f},
-std::array<float,2>{0.939241827f, 0.342199624f},
-std::array<float,2>{0.164779082f, 0.627732396f},
-std::array<float,2>{0.70178324f, 0.797476888f},
-std::array<float,2>{0.467784762f, 0.0332135744f},
-std::array<float,2>{0.572700441f, 0.296115339f},
-std::array<float,2>{0.344539016f, 0.695492089f},
-std::array<float,2>{0.863922477f, 0.857465982f},
-std::array<float,2>{0.01864505f, 0.0641661063f},
-std::array<float,2>{0.878289998f, 0.163616627f},
-std::array<float,2>{0.195493177f, 0.983036458f},
-std::array<float,2>{0.65266341f, 0.613736212f},
-std::array<float,2>{0.427668154f, 0.48978886f},
-std::array<float,2>{0.726596534f, 0.0215206165f},
-std::array<float,2>{0.484198838f, 0.767787158f},
-std::array<float,2>{0.994679928f, 0.665970922f},
-std::array<float,2>{0.136565268f, 0.348129928f},
-std::array<float,2>{0.764862239f, 0.398504078f},
-std::array<float,2>{0.0696375743f, 0.517018437f},
-std::array<float,2>{0.541214168f, 0.889675856f},
-std::array<float,2>{0.289664954f, 0.218599916f},
-std::array<float,2>{0.548946977f, 0.431592584f},
-std::array<float,2>{0.307690173f, 0.542382777f},
-std::array<float,2>{0.774635971f, 0.920217514f},
-std::array<float,2>{0.0879437402f, 0.244877592f},
-std::array<float,2>{0.97595185f, 0.0524271913f},
-std::array<float,2>{0.155538231f, 0.785304189f},
-std::array<float,2>{0.736909866f, 0.645050108f},
-std::array<float,2>{0.489353091f, 0.320025265f},
-std::array<float,2>{0.636217296f, 0.151976332f},
-std::array<float,2>{0.410307229f, 0.946230292f},
-std::array<float,2>{0.902098656f, 0.569978178f},
-std::array<float,2>{0.213739127f, 0.452232003f},
-std::array<float,2>{0.850886703f, 0.257653683f},
-std::array<float,2>{0.00162356975f, 0.739130259f},
-std::array<float,2>{0.588046372f, 0.823078752f},
-std::array<float,2>{0.366378695f, 0.109785505f},
-std::array<float,2>{0.715272367f, 0.370816022f},
-std::array<float,2>{0.44367516f, 0.680498958f},
-std::array<float,2>{0.967883945f, 0.755163133f},
-std::array<float,2>{0.178718731f, 0.00584463915f},
-std::array<float,2>{0.805740833f, 0.192141563f},
-std::array<float,2>{0.111499846f, 0.891522288f},
-std::array<float,2>{0.523201287f, 0.510564208f},
-std::array<float,2>{0.274855316f, 0.38315028f},
-std::array<float,2>{0.622889519f, 0.0805561244f},
-std::array<float,2>{0.338317752f, 0.872617602f},
-std::array<float,2>{0.837817311f, 0.716484249f},
-std::array<float,2>{0.0457497276f, 0.302222371f},
-std::array<float,2>{0.916032016f, 0.482456058f},
-std::array<float,2>{0.239893988f, 0.596385539f},
-std::array<float,2>{0.661885798f, 0.998993516f},
-std::array<float,2>{0.389384478f, 0.181969941f},
-std::array<float,2>{0.733918726f, 0.442410797f},
-std::array<float,2>{0.478988916f, 0.57722342f},
-std::array<float,2>{0.996183336f, 0.944176853f},
-std::array<float,2>{0.138921052f, 0.14193055f},
-std::array<float,2>{0.759064972f, 0.122922376f},
-std::array<float,2>{0.0659820214f, 0.817671418f},
-std::array<float,2>{0.544990182f, 0.747779071f},
-std::array<float,2>{0.296232849f, 0.262466311f},
-std::array<float,2>{0.57579869f, 0.239690796f},
-std::array<float,2>{0.348958343f, 0.90868938f},
-std::array<float,2>{0.860941648f, 0.533238411f},
-std::array<float,2>{0.0208350141f, 0.428729415f},
-std::array<float,2>{0.879659355f, 0.325318694f},
-std::array<float,2>{0.201079801f, 0.655397773f},
-std::array<float,2>{0.649112105f, 0.795174003f},
-std::array<float,2>{0.424928129f, 0.0587141998f},
-std::array<float,2>{0.515168905f, 0.308407903f},
-std::array<float,2>{0.253239483f, 0.710004628f},
-std::array<float,2>{0.784543812f, 0.863822401f},
-std::array<float,2>{0.105920054f, 0.0890525132f},
-std::array<float,2>{0.943442225f, 0.174679413f},
-std::array<float,2>{0.168871716f, 0.984464288f},
-std::array<float,2>{0.696367145f, 0.606093585f},
-std::array<float,2>{0.463363856f, 0.473813981f},
-std::array<float,2>{0.677694559f, 0.00823742244f},
-std::array<float,2>{0.404002905f, 0.764982998f},
-std::array<float,2>{0.930565476f, 0.671964824f},
-std::array<float,2>{0.230474547f, 0.36226812f},
-std::array<float,2>{0.822928309f, 0.375479668f},
-std::array<float,2>{0.0586175136f, 0.506115973f},
-std::array<float,2>{0.60910213f, 0.90060854f},
-std::array<float,2>{0.321168959f, 0.199699953f},
-std::array<float,2>{0.620093644f, 0.409365743f},
-std::array<float,2>{0.343321204f, 0.557719111f},
-std::array<float,2>{0.840333283f, 0.933763206f},
-std::array<float,2>{0.0398318693f, 0.225882158f},
-std::array<float,2>{0.918058395f, 0.0465996414f},
-std::array<float,2>{0.236256421f, 0.809146583f},
-std::array<float,2>{0.657031f, 0.638108253f},
-std::array<float,2>{0.385449737f, 0.333804458f},
-std::array<float,2>{0.712339938f, 0.136321083f},
-std::array<float,2>{0.438965291f, 0.960279167f},
-std::array<float,2>{0.961348474f, 0.581784844f},
-std::array<float,2>{0.172257319f, 0.456141472f},
-std::array<float,2>{0.80873245f, 0.266379356f},
-std::array<float,2>{0.116295204f, 0.728900552f},
-std::array<float,2>{0.516274154f, 0.841173828f},
-std::array<float,2>{0.279717088f, 0.104738578f},
-std::array<float,2>{0.639920652f, 0.353611231f},
-std::array<float,2>{0.409237802f, 0.660338044f},
-std::array<float,2>{0.905243456f, 0.779619098f},
-std::array<float,2>{0.21558705f, 0.0246492065f},
-std::array<float,2>{0.844971895f, 0.204147756f},
-std::array<float,2>{0.00452668406f, 0.881160021f},
-std::array<float,2>{0.590479493f, 0.524969935f},
-std::array<float,2>{0.359772593f, 0.393571526f},
-std::array<float,2>{0.552850187f, 0.077986598f},
-std::array<float,2>{0.308692753f, 0.850473046f},
-std::array<float,2>{0.778268576f, 0.691134274f},
-std::array<float,2>{0.0916689709f, 0.283673704f},
-std::array<float,2>{0.968949556f, 0.499508828f},
-std::array<float,2>{0.150597036f, 0.619993091f},
-std::array<float,2>{0.740177572f, 0.976008117f},
-std::array<float,2>{0.486073226f, 0.168387324f},
-std::array<float,2>{0.667155683f, 0.402788013f},
-std::array<float,2>{0.379633129f, 0.521085083f},
-std::array<float,2>{0.912663043f, 0.883781493f},
-std::array<float,2>{0.248569906f, 0.213777825f},
-std::array<float,2>{0.831931114f, 0.0184074398f},
-std::array<float,2>{0.0335749499f, 0.773171306f},
-std::array<float,2>{0.610724807f, 0.671565533f},
-std::array<float,2>{0.333813429f, 0.345154405f},
-std::array<float,2>{0.527361989f, 0.159590602f},
-std::array<float,2>{0.272725761f, 0.976767838f},
-std::array<float,2>{0.800260484f, 0.612712801f},
-std::array<float,2>{0.122033216f, 0.484918147f},
-std::array<float,2>{0.955904722f, 0.291380823f},
-std::array<float,2>{0.18435663f, 0.69998914f},
-std::array<float,2>{0.708641708f, 0.85258168f},
-std::array<float,2>{0.449854016f, 0.0665035397f},
-std::array<float,2>{0.582873046f, 0.337710083f},
-std::array<float,2>{0.373320341f, 0.629238069f},
-std::array<float,2>{0.856157541f, 0.802801251f},
-std::array<float,2>{0.0132085476f, 0.035505075f},
-std::array<float,2>{0.8951478f, 0.227823004f},
-std::array<float,2>{0.210299894f, 0.925657153f},
-std::array<float,2>{0.632573724f, 0.553624451f},
-std::array<float,2>{0.417115301f, 0.420828491f},
-std::array<float,2>{0.748393774f, 0.09847527f},
-std::array<float,2>{0.497682393f, 0.83067894f},
-std::array<float,2>{0.976893127f, 0.724436581f},
-std::array<float,2>{0.143880114f, 0.275667548f},
-std::array<float,2>{0.769233286f, 0.463452101f},
-std::array<float,2>{0.0786119252f, 0.592375696f},
-std::array<float,2>{0.554861963f, 0.966228962f},
-std::array<float,2>{0.299219787f, 0.129203498f},
-std::array<float,2>{0.532678306f, 0.479133427f},
-std::array<float,2>{0.282198817f, 0.601058006f},
-std::array<float,2>{0.753434479f, 0.992992997f},
-std::array<float,2>{0.0711720139f, 0.184183419f},
-std::array<float,2>{0.985336721f, 0.0850344971f},
-std::array<float,2>{0.129801825f, 0.868770182f},
-std::array<float,2>{0.724219501f, 0.712287962f},
-std::array<float,2>{0.469702482f, 0.297864377f},
-std::array<float,2>{0.642796576f, 0.190460995f},
-std::array<float,2>{0.434384197f, 0.898320973f},
-std::array<float,2>{0.885479033f, 0.515305161f},
-std::array<float,2>{0.188974023f, 0.387072384f},
-std::array<float,2>{0.871288836f, 0.374029011f},
-std::array<float,2>{0.0268035531f, 0.68570596f},
-std::array<float,2>{0.562682927f, 0.751848698f},
-std::array<float,2>{0.355993867f, 0.00344853033f},
-std::array<float,2>{0.689894676f, 0.252850115f},
-std::array<float,2>{0.455478519f, 0.736963689f},
-std::array<float,2>{0.949889958f, 0.827850223f},
-std::array<float,2>{0.160228491f, 0.116179802f},
-std::array<float,2>{0.796754122f, 0.153914675f},
-std::array<float,2>{0.0970979631f, 0.949973643f},
-std::array<float,2>{0.504289687f, 0.563762069f},
-std::array<float,2>{0.258192956f, 0.445747942f},
-std::array<float,2>{0.59869355f, 0.0481165536f},
-std::array<float,2>{0.316589296f, 0.781804502f},
-std::array<float,2>{0.81503588f, 0.641148746f},
-std::array<float,2>{0.0475828499f, 0.315344274f},
-std::array<float,2>{0.924534321f, 0.435195178f},
-std::array<float,2>{0.220631063f, 0.544185877f},
-std::array<float,2>{0.681578577f, 0.915823519f},
-std::array<float,2>{0.395645678f, 0.24700737f},
-std::array<float,2>{0.703288615f, 0.425719947f},
-std::array<float,2>{0.446244329f, 0.535724342f},
-std::array<float,2>{0.958425581f, 0.911265969f},
-std::array<float,2>{0.181583852f, 0.235712811f},
-std::array<float,2>{0.803975403f, 0.0556629486f},
-std::array<float,2>{0.119763792f, 0.790656269f},
-std::array<float,2>{0.526189864f, 0.6511271f},
-std::array<float,2>{0.268794924f, 0.321085572f},
-std::array<float,2>{0.614800692f, 0.147114322f},
-std::array<float,2>{0.330926865f, 0.941015542f},
-std::array<float,2>{0.834698141f, 0.572275341f},
-std::array<float,2>{0.0369481295f, 0.437638909f},
-std::array<float,2>{0.907806516f, 0.2586326f},
-std::array<float,2>{0.243194386f, 0.742476404f},
-std::array<float,2>{0.669916153f, 0.812710702f},
-std::array<float,2>{0.376412868f, 0.119273543f},
-std::array<float,2>{0.560409486f, 0.367091805f},
-std::array<float,2>{0.300796002f, 0.677376688f},
-std::array<float,2>{0.772231877f, 0.759861171f},
-std::array<float,2>{0.0844480842f, 0.0132828951f},
-std::array<float,2>{0.983850658f, 0.198302925f},
-std::array<float,2>{0.147541419f, 0.904112577f},
-std::array<float,2>{0.745339215f, 0.501227379f},
-std::array<float,2>{0.494432449f, 0.380841374f},
-std::array<float,2>{0.626373351f, 0.0916393995f},
-std::array<float,2>{0.420115471f, 0.861917734f},
-std::array<float,2>{0.892531991f, 0.705220461f},
-std::array<float,2>{0.206533894f, 0.310966998f},
-std::array<float,2>{0.852467775f, 0.470465541f},
-std::array<float,2>{0.00891911332f, 0.603038967f},
-std::array<float,2>{0.579840541f, 0.990561604f},
-std::array<float,2>{0.367657214f, 0.17691797f},
-std::array<float,2>{0.567857087f, 0.457771838f},
-std::array<float,2>{0.35207808f, 0.582431614f},
-std::array<float,2>{0.868427873f, 0.954991162f},
-std::array<float,2>{0.0306347832f, 0.139965713f},
-std::array<float,2>{0.887185633f, 0.10634353f},
-std::array<float,2>{0.195017427f, 0.83791554f},
-std::array<float,2>{0.647672355f, 0.732573092f},
-std::array<float,2>{0.433077902f, 0.27064544f},
-std::array<float,2>{0.721328735f, 0.221474156f},
-std::array<float,2>{0.474644393f, 0.932514846f},
-std::array<float,2>{0.989903927f, 0.55922395f},
-std::array<float,2>{0.126913249f, 0.410484016f},
-std::array<float,2>{0.756260335f, 0.329477787f},
-std::array<float,2>{0.0775464997f, 0.635345638f},
-std::array<float,2>{0.536981761f, 0.807619035f},
-std::array<float,2>{0.285691231f, 0.0408311598f},
-std::array<float,2>{0.683844566f, 0.287246794f},
-std::array<float,2>{0.390886098f, 0.692207992f},
-std::array<float,2>{0.927160621f, 0.845423043f},
-std::array<float,2>{0.223807693f, 0.0723587349f},
-std::array<float,2>{0.820054233f, 0.16676645f},
-std::array<float,2>{0.0522493944f, 0.969095409f},
-std::array<float,2>{0.596540749f, 0.622241735f},
-std::array<float,2>{0.314038843f, 0.494007558f},
-std::array<float,2>{0.502371132f, 0.0276445113f},
-std::array<float,2>{0.264374197f, 0.774894893f},
-std::array<float,2>{0.79279995f, 0.656631708f},
-std::array<float,2>{0.100059465f, 0.35904333f},
-std::array<float,2>{0.946965456f, 0.395886868f},
-std::array<float,2>{0.158737168f, 0.527986884f},
-std::array<float,2>{0.693555593f, 0.878563702f},
-std::array<float,2>{0.459910274f, 0.207907826f},
-std::array<float,2>{0.654378295f, 0.492004901f},
-std::array<float,2>{0.429001033f, 0.615820646f},
-std::array<float,2>{0.876373947f, 0.981086612f},
-std::array<float,2>{0.199116975f, 0.161484465f},
-std::array<float,2>{0.865853131f, 0.06517075f},
-std::array<float,2>{0.0162414219f, 0.855843365f},
-std::array<float,2>{0.571551681f, 0.69824934f},
-std::array<float,2>{0.346783966f, 0.294356376f},
-std::array<float,2>{0.539860249f, 0.215743944f},
-std::array<float,2>{0.291969299f, 0.888257027f},
-std::array<float,2>{0.762863874f, 0.51766181f},
-std::array<float,2>{0.0671241134f, 0.401462376f},
-std::array<float,2>{0.993255436f, 0.351328313f},
-std::array<float,2>{0.13295117f, 0.667278528f},
-std::array<float,2>{0.729799747f, 0.765818596f},
-std::array<float,2>{0.482287288f, 0.0198074672f},
-std::array<float,2>{0.602275968f, 0.280266285f},
-std::array<float,2>{0.325150132f, 0.722425461f},
-std::array<float,2>{0.827354431f, 0.83348763f},
-std::array<float,2>{0.0551935434f, 0.0975785404f},
-std::array<float,2>{0.936589003f, 0.125427783f},
-std::array<float,2>{0.227748781f, 0.962009668f},
-std::array<float,2>{0.675096273f, 0.586542189f},
-std::array<float,2>{0.402254641f, 0.466379702f},
-std::array<float,2>{0.700474799f, 0.0324566737f},
-std::array<float,2>{0.4652493f, 0.800453544f},
-std::array<float,2>{0.940512002f, 0.625995338f},
-std::array<float,2>{0.167594165f, 0.341549933f},
-std::array<float,2>{0.785397112f, 0.41484037f},
-std::array<float,2>{0.101697415f, 0.547641635f},
-std::array<float,2>{0.509802401f, 0.929662108f},
-std::array<float,2>{0.255558968f, 0.233815938f},
-std::array<float,2>{0.520565927f, 0.385051131f},
-std::array<float,2>{0.27562958f, 0.509487092f},
-std::array<float,2>{0.80678606f, 0.893900394f},
-std::array<float,2>{0.10974621f, 0.194736302f},
-std::array<float,2>{0.965476394f, 0.006744185f},
-std::array<float,2>{0.176621243f, 0.757768035f},
-std::array<float,2>{0.717010081f, 0.682774484f},
-std::array<float,2>{0.442559719f, 0.368046343f},
-std::array<float,2>{0.663419187f, 0.180652604f},
-std::array<float,2>{0.387206495f, 0.996736586f},
-std::array<float,2>{0.915352345f, 0.595445275f},
-std::array<float,2>{0.240447819f, 0.481070429f},
-std::array<float,2>{0.837917924f, 0.304506034f},
-std::array<float,2>{0.0442271084f, 0.718295395f},
-std::array<float,2>{0.624934971f, 0.874306619f},
-std::array<float,2>{0.336207122f, 0.079546161f},
-std::array<float,2>{0.73490864f, 0.318240523f},
-std::array<float,2>{0.490392029f, 0.648180783f},
-std::array<float,2>{0.973337173f, 0.788108706f},
-std::array<float,2>{0.153141603f, 0.0528574921f},
-std::array<float,2>{0.776166856f, 0.243303671f},
-std::array<float,2>{0.0861620456f, 0.919495225f},
-std::array<float,2>{0.54811728f, 0.539919734f},
-std::array<float,2>{0.305012703f, 0.432499588f},
-std::array<float,2>{0.586599827f, 0.11216706f},
-std::array<float,2>{0.36433965f, 0.822050095f},
-std::array<float,2>{0.84936887f, 0.741228938f},
-std::array<float,2>{0.00201466936f, 0.254867584f},
-std::array<float,2>{0.899283469f, 0.449386537f},
-std::array<float,2>{0.210949317f, 0.567183495f},
-std::array<float,2>{0.633577824f, 0.948283434f},
-std::array<float,2>{0.413630158f, 0.150110468f},
-std::array<float,2>{0.7130934f, 0.455852628f},
-std::array<float,2>{0.440298915f, 0.580550611f},
-std::array<float,2>{0.964405477f, 0.959488094f},
-std::array<float,2>{0.174161121f, 0.134849355f},
-std::array<float,2>{0.812294781f, 0.103628621f},
-std::array<float,2>{0.114735335f, 0.839968979f},
-std::array<float,2>{0.519215763f, 0.72985673f},
-std::array<float,2>{0.279086888f, 0.267143458f},
-std::array<float,2>{0.618434191f, 0.224851966f},
-std::array<float,2>{0.339857519f, 0.935504556f},
-std::array<float,2>{0.843365014f, 0.557044744f},
-std::array<float,2>{0.0411670767f, 0.408300877f},
-std::array<float,2>{0.921004832f, 0.332214683f},
-std::array<float,2>{0.237894669f, 0.637085855f},
-std::array<float,2>{0.658285201f, 0.809826136f},
-std::array<float,2>{0.383728236f, 0.0449253693f},
-std::array<float,2>{0.552337587f, 0.284523547f},
-std::array<float,2>{0.311327577f, 0.689940691f},
-std::array<float,2>{0.780124903f, 0.851027071f},
-std::array<float,2>{0.0928894207f, 0.0766820163f},
-std::array<float,2>{0.970753372f, 0.169523522f},
-std::array<float,2>{0.150178283f, 0.974698842f},
-std::array<float,2>{0.741779029f, 0.620830834f},
-std::array<float,2>{0.487397015f, 0.498899758f},
-std::array<float,2>{0.638394117f, 0.0241633374f},
-std::array<float,2>{0.407816738f, 0.780529857f},
-std::array<float,2>{0.904040813f, 0.661596179f},
-std::array<float,2>{0.218198985f, 0.354641199f},
-std::array<float,2>{0.846588492f, 0.393253744f},
-std::array<float,2>{0.00738414982f, 0.523782134f},
-std::array<float,2>{0.592231631f, 0.882805824f},
-std::array<float,2>{0.363051504f, 0.203603998f},
-std::array<float,2>{0.576955616f, 0.428483933f},
-std::array<float,2>{0.35116002f, 0.534224272f},
-std::array<float,2>{0.863271534f, 0.909650624f},
-std::array<float,2>{0.0225563031f, 0.239033639f},
-std::array<float,2>{0.881066501f, 0.0596490316f},
-std::array<float,2>{0.202473134f, 0.796228111f},
-std::array<float,2>{0.651346743f, 0.654986739f},
-std::array<float,2>{0.421923101f, 0.324376583f},
-std::array<float,2>{0.732010603f, 0.141072839f},
-std::array<float,2>{0.477874637f, 0.94438225f},
-std::array<float,2>{0.999932945f, 0.577015877f},
-std::array<float,2>{0.137481585f, 0.442107469f},
-std::array<float,2>{0.759828627f, 0.263114989f},
-std::array<float,2>{0.0629643425f, 0.746801019f},
-std::array<float,2>{0.544421494f, 0.817240357f},
-std::array<float,2>{0.294886202f, 0.121356115f},
-std::array<float,2>{0.677745104f, 0.362830877f},
-std::array<float,2>{0.405948251f, 0.672868729f},
-std::array<float,2>{0.933060765f, 0.764110684f},
-std::array<float,2>{0.234348312f, 0.00903968513f},
-std::array<float,2>{0.821183681f, 0.20055081f},
-std::array<float,2>{0.0607510917f, 0.901956439f},
-std::array<float,2>{0.606140375f, 0.507253468f},
-std::array<float,2>{0.324046582f, 0.376870185f},
-std::array<float,2>{0.513272882f, 0.0881164595f},
-std::array<float,2>{0.251640439f, 0.865111053f},
-std::array<float,2>{0.782520413f, 0.709347248f},
-std::array<float,2>{0.107954033f, 0.306771308f},
-std::array<float,2>{0.943010807f, 0.472701013f},
-std::array<float,2>{0.170437023f, 0.606868446f},
-std::array<float,2>{0.698895812f, 0.98545146f},
-std::array<float,2>{0.462328404f, 0.174972549f},
-std::array<float,2>{0.642478049f, 0.388336062f},
-std::array<float,2>{0.437119842f, 0.513910174f},
-std::array<float,2>{0.884055316f, 0.897401631f},
-std::array<float,2>{0.191083655f, 0.189671472f},
-std::array<float,2>{0.874034286f, 0.00267699081f},
-std::array<float,2>{0.0238433275f, 0.750788689f},
-std::array<float,2>{0.565730453f, 0.686748445f},
-std::array<float,2>{0.357741326f, 0.373681754f},
-std::array<float,2>{0.534334123f, 0.185011044f},
-std::array<float,2>{0.283772469f, 0.994114757f},
-std::array<float,2>{0.750762403f, 0.599784017f},
-std::array<float,2>{0.0729815438f, 0.479519516f},
-std::array<float,2>{0.987854004f, 0.297099888f},
-std::array<float,2>{0.131308675f, 0.711085796f},
-std::array<float,2>{0.726239324f, 0.868013322f},
-std::array<float,2>{0.472332895f, 0.0846169665f},
-std::array<float,2>{0.600939095f, 0.315518647f},
-std::array<float,2>{0.319483966f, 0.642202258f},
-std::array<float,2>{0.81430167f, 0.783078074f},
-std::array<float,2>{0.0493902341f, 0.046911899f},
-std::array<float,2>{0.923526049f, 0.24778825f},
-std::array<float,2>{0.221831739f, 0.914581239f},
-std::array<float,2>{0.681680202f, 0.543895543f},
-std::array<float,2>{0.39669776f, 0.434365481f},
-std::array<float,2>{0.688270211f, 0.117011234f},
-std::array<float,2>{0.454439193f, 0.826350749f},
-std::array<float,2>{0.953038812f, 0.737645864f},
-std::array<float,2>{0.163656846f, 0.253377408f},
-std::array<float,2>{0.793876886f, 0.447153419f},
-std::array<float,2>{0.0955998376f, 0.563188493f},
-std::array<float,2>{0.507566869f, 0.951130986f},
-std::array<float,2>{0.26073575f, 0.152622491f},
-std::array<float,2>{0.530680001f, 0.485773951f},
-std::array<float,2>{0.271279782f, 0.611690402f},
-std::array<float,2>{0.797057629f, 0.978121758f},
-std::array<float,2>{0.123515755f, 0.158332825f},
-std::array<float,2>{0.95423764f, 0.0681136176f},
-std::array<float,2>{0.187066048f, 0.852264166f},
-std::array<float,2>{0.709652305f, 0.700759947f},
-std::array<float,2>{0.451312959f, 0.292962164f},
-std::array<float,2>{0.664304852f, 0.214100271f},
-std::array<float,2>{0.381729037f, 0.884022236f},
-std::array<float,2>{0.911192834f, 0.519641995f},
-std::array<float,2>{0.248004228f, 0.404179871f},
-std::array<float,2>{0.829546928f, 0.344377548f},
-std::array<float,2>{0.0326337852f, 0.67078495f},
-std::array<float,2>{0.612211168f, 0.772381842f},
-std::array<float,2>{0.334335506f, 0.0194419976f},
-std::array<float,2>{0.747359276f, 0.276899785f},
-std::array<float,2>{0.499099374f, 0.72298336f},
-std::array<float,2>{0.978767216f, 0.831870258f},
-std::array<float,2>{0.140860349f, 0.0992725417f},
-std::array<float,2>{0.766089439f, 0.130786315f},
-std::array<float,2>{0.0803056359f, 0.965156019f},
-std::array<float,2>{0.557166576f, 0.593502045f},
-std::array<float,2>{0.297617346f, 0.46468392f},
-std::array<float,2>{0.58518368f, 0.0364413224f},
-std::array<float,2>{0.372139007f, 0.804440141f},
-std::array<float,2>{0.859015346f, 0.630193472f},
-std::array<float,2>{0.0152184647f, 0.33610642f},
-std::array<float,2>{0.89754051f, 0.421531856f},
-std::array<float,2>{0.207600236f, 0.553886235f},
-std::array<float,2>{0.630149543f, 0.924378037f},
-std::array<float,2>{0.415547609f, 0.226716101f},
-std::array<float,2>{0.719024181f, 0.411995322f},
-std::array<float,2>{0.472971052f, 0.560146034f},
-std::array<float,2>{0.990648687f, 0.933338225f},
-std::array<float,2>{0.12830916f, 0.221832097f},
-std::array<float,2>{0.755854011f, 0.0394263268f},
-std::array<float,2>{0.0753350779f, 0.80729115f},
-std::array<float,2>{0.537770271f, 0.636434317f},
-std::array<float,2>{0.289004058f, 0.328360468f},
-std::array<float,2>{0.56963402f, 0.139010787f},
-std::array<float,2>{0.354556799f, 0.953245699f},
-std::array<float,2>{0.86915493f, 0.583391905f},
-std::array<float,2>{0.0285864025f, 0.458780378f},
-std::array<float,2>{0.889960289f, 0.270213187f},
-std::array<float,2>{0.193207175f, 0.734192431f},
-std::array<float,2>{0.645587504f, 0.839093924f},
-std::array<float,2>{0.430576384f, 0.107301861f},
-std::array<float,2>{0.501626015f, 0.357872635f},
-std::array<float,2>{0.263044953f, 0.657244146f},
-std::array<float,2>{0.789094269f, 0.773927569f},
-std::array<float,2>{0.0991597176f, 0.0286794826f},
-std::array<float,2>{0.949213028f, 0.208323047f},
-std::array<float,2>{0.157712966f, 0.877847612f},
-std::array<float,2>{0.692914546f, 0.529133499f},
-std::array<float,2>{0.457367003f, 0.395474494f},
-std::array<float,2>{0.687186182f, 0.0735395849f},
-std::array<float,2>{0.393385887f, 0.844367445f},
-std::array<float,2>{0.928287089f, 0.692465186f},
-std::array<float,2>{0.225819275f, 0.288821667f},
-std::array<float,2>{0.816914082f, 0.4925524f},
-std::array<float,2>{0.0540423691f, 0.621880591f},
-std::array<float,2>{0.594288766f, 0.969877362f},
-std::array<float,2>{0.314874917f, 0.167371765f},
-std::array<float,2>{0.616080463f, 0.438698947f},
-std::array<float,2>{0.329957783f, 0.574115932f},
-std::array<float,2>{0.833643258f, 0.940419912f},
-std::array<float,2>{0.0390181281f, 0.14812471f},
-std::array<float,2>{0.909246266f, 0.120253965f},
-std::array<float,2>{0.244399324f, 0.814041793f},
-std::array<float,2>{0.671132207f, 0.743349314f},
-std::array<float,2>{0.377526551f, 0.259424776f},
-std::array<float,2>{0.705311537f, 0.234944165f},
-std::array<float,2>{0.449171156f, 0.910682559f},
-std::array<float,2>{0.960776031f, 0.536579192f},
-std::array<float,2>{0.182555348f, 0.423985571f},
-std::array<float,2>{0.802275002f, 0.321685195f},
-std::array<float,2>{0.117761798f, 0.652237952f},
-std::array<float,2>{0.524755895f, 0.789362848f},
-std::array<float,2>{0.266781479f, 0.0561319962f},
-std::array<float,2>{0.627267599f, 0.311607182f},
-std::array<float,2>{0.419681042f, 0.70655781f},
-std::array<float,2>{0.893236756f, 0.862493515f},
-std::array<float,2>{0.204076275f, 0.090160273f},
-std::array<float,2>{0.853930414f, 0.176277637f},
-std::array<float,2>{0.0115962224f, 0.991773009f},
-std::array<float,2>{0.581436872f, 0.602469921f},
-std::array<float,2>{0.37095964f, 0.469003469f},
-std::array<float,2>{0.562014997f, 0.0122163864f},
-std::array<float,2>{0.303953558f, 0.76121372f},
-std::array<float,2>{0.769903719f, 0.67660743f},
-std::array<float,2>{0.0828602761f, 0.365971237f},
-std::array<float,2>{0.981782854f, 0.379828274f},
-std::array<float,2>{0.145488352f, 0.500926614f},
-std::array<float,2>{0.742194951f, 0.902410507f},
-std::array<float,2>{0.49313578f, 0.198054135f},
-std::array<float,2>{0.660541296f, 0.482037157f},
-std::array<float,2>{0.390582323f, 0.594377816f},
-std::array<float,2>{0.917492688f, 0.997820854f},
-std::array<float,2>{0.239206687f, 0.180795774f},
-std::array<float,2>{0.836741209f, 0.0789488256f},
-std::array<float,2>{0.0465140156f, 0.873361826f},
-std::array<float,2>{0.621186197f, 0.71704638f},
-std::array<float,2>{0.339002997f, 0.302955806f},
-std::array<float,2>{0.522279918f, 0.194117188f},
-std::array<float,2>{0.27438134f, 0.892727315f},
-std::array<float,2>{0.804691851f, 0.508727252f},
-std::array<float,2>{0.113122024f, 0.386235446f},
-std::array<float,2>{0.967002511f, 0.368459105f},
-std::array<float,2>{0.178217083f, 0.682378113f},
-std::array<float,2>{0.715833247f, 0.755966663f},
-std::array<float,2>{0.445004165f, 0.00747452583f},
-std::array<float,2>{0.588894963f, 0.255274385f},
-std::array<float,2>{0.365834981f, 0.740559042f},
-std::array<float,2>{0.850395858f, 0.820830464f},
-std::array<float,2>{0.000132602552f, 0.112406649f},
-std::array<float,2>{0.900644243f, 0.148549169f},
-std::array<float,2>{0.2145852f, 0.947613835f},
-std::array<float,2>{0.63478744f, 0.567683399f},
-std::array<float,2>{0.41176489f, 0.451009184f},
-std::array<float,2>{0.738074601f, 0.0541645922f},
-std::array<float,2>{0.489187896f, 0.787507474f},
-std::array<float,2>{0.975230515f, 0.646601617f},
-std::array<float,2>{0.154435381f, 0.317215323f},
-std::array<float,2>{0.773995578f, 0.432712436f},
-std::array<float,2>{0.0891484842f, 0.540953517f},
-std::array<float,2>{0.550170004f, 0.918607056f},
-std::array<float,2>{0.307148188f, 0.242966056f},
-std::array<float,2>{0.542941928f, 0.401019931f},
-std::array<float,2>{0.290070981f, 0.518585205f},
-std::array<float,2>{0.76450175f, 0.886863768f},
-std::array<float,2>{0.0690216348f, 0.216486499f},
-std::array<float,2>{0.99560672f, 0.0212305598f},
-std::array<float,2>{0.135386512f, 0.766749203f},
-std::array<float,2>{0.727982938f, 0.666172206f},
-std::array<float,2>{0.483382314f, 0.349682003f},
-std::array<float,2>{0.653334558f, 0.160490081f},
-std::array<float,2>{0.426010638f, 0.982337356f},
-std::array<float,2>{0.877298474f, 0.616831601f},
-std::array<float,2>{0.196968272f, 0.491025239f},
-std::array<float,2>{0.865192592f, 0.29301545f},
-std::array<float,2>{0.0180284027f, 0.697835982f},
-std::array<float,2>{0.573589504f, 0.856931031f},
-std::array<float,2>{0.344813436f, 0.0655020401f},
-std::array<float,2>{0.70220238f, 0.340257883f},
-std::array<float,2>{0.466955841f, 0.625211477f},
-std::array<float,2>{0.938322246f, 0.799398959f},
-std::array<float,2>{0.16545482f, 0.031453535f},
-std::array<float,2>{0.788867056f, 0.233315378f},
-std::array<float,2>{0.105203234f, 0.928193092f},
-std::array<float,2>{0.508870244f, 0.54873848f},
-std::array<float,2>{0.257618845f, 0.41587919f},
-std::array<float,2>{0.603800714f, 0.0963219553f},
-std::array<float,2>{0.326696992f, 0.832672417f},
-std::array<float,2>{0.825058997f, 0.721157193f},
-std::array<float,2>{0.0576813929f, 0.280338436f},
-std::array<float,2>{0.93512392f, 0.464953393f},
-std::array<float,2>{0.22944206f, 0.587302327f},
-std::array<float,2>{0.673362374f, 0.961007118f},
-std::array<float,2>{0.399038911f, 0.126678661f},
-std::array<float,2>{0.738324404f, 0.497032046f},
-std::array<float,2>{0.48442024f, 0.617687464f},
-std::array<float,2>{0.970236897f, 0.972799838f},
-std::array<float,2>{0.15202111f, 0.171295121f},
-std::array<float,2>{0.778606951f, 0.0745149031f},
-std::array<float,2>{0.0900692418f, 0.848321617f},
-std::array<float,2>{0.554626405f, 0.688900828f},
-std::array<float,2>{0.310468227f, 0.283061743f},
-std::array<float,2>{0.591045618f, 0.206963927f},
-std::array<float,2>{0.360510379f, 0.879771709f},
-std::array<float,2>{0.844599843f, 0.525930941f},
-std::array<float,2>{0.00500248978f, 0.391374826f},
-std::array<float,2>{0.905463755f, 0.352701843f},
-std::array<float,2>{0.216419652f, 0.663013101f},
-std::array<float,2>{0.639071703f, 0.778854668f},
-std::array<float,2>{0.408799469f, 0.0268053394f},
-std::array<float,2>{0.517412961f, 0.267642349f},
-std::array<float,2>{0.280514449f, 0.727237523f},
-std::array<float,2>{0.810482621f, 0.842956185f},
-std::array<float,2>{0.115734063f, 0.102980375f},
-std::array<float,2>{0.962819219f, 0.132837206f},
-std::array<float,2>{0.173197791f, 0.957529604f},
-std::array<float,2>{0.711405218f, 0.580026329f},
-std::array<float,2>{0.438030422f, 0.453715324f},
-std::array<float,2>{0.657711327f, 0.0433462188f},
-std::array<float,2>{0.386530817f, 0.811680853f},
-std::array<float,2>{0.919806182f, 0.639915705f},
-std::array<float,2>{0.234464571f, 0.335731417f},
-std::array<float,2>{0.841056824f, 0.406774133f},
-std::array<float,2>{0.0406890102f, 0.555127919f},
-std::array<float,2>{0.620301306f, 0.936070383f},
-std::array<float,2>{0.342351139f, 0.223110154f},
-std::array<float,2>{0.607855797f, 0.37708208f},
-std::array<float,2>{0.321685195f, 0.505515218f},
-std::array<float,2>{0.823427677f, 0.900152147f},
-std::array<float,2>{0.060107328f, 0.203082725f},
-std::array<float,2>{0.931203783f, 0.0117007056f},
-std::array<float,2>{0.232211277f, 0.762967765f},
-std::array<float,2>{0.676439166f, 0.67489773f},
-std::array<float,2>{0.403189331f, 0.360678256f},
-std::array<float,2>{0.695795894f, 0.17275019f},
-std::array<float,2>{0.464734733f, 0.987921238f},
-std::array<float,2>{0.944346964f, 0.608690262f},
-std::array<float,2>{0.169071913f, 0.476516724f},
-std::array<float,2>{0.783261895f, 0.305184245f},
-std::array<float,2>{0.107084669f, 0.70788008f},
-std::array<float,2>{0.513744652f, 0.866604567f},
-std::array<float,2>{0.252357423f, 0.0870263726f},
-std::array<float,2>{0.649937987f, 0.326657712f},
-std::array<float,2>{0.424741864f, 0.654143512f},
-std::array<float,2>{0.880404055f, 0.793653369f},
-std::array<float,2>{0.199504852f, 0.0606431477f},
-std::array<float,2>{0.859694839f, 0.240704224f},
-std::array<float,2>{0.0201001074f, 0.906878829f},
-std::array<float,2>{0.574242592f, 0.532457948f},
-std::array<float,2>{0.347954661f, 0.426882684f},
-std::array<float,2>{0.546720266f, 0.12486811f},
-std::array<float,2>{0.295247376f, 0.818763733f},
-std::array<float,2>{0.757998824f, 0.748533785f},
-std::array<float,2>{0.0654291138f, 0.263746023f},
-std::array<float,2>{0.997071207f, 0.44438225f},
-std::array<float,2>{0.1405963f, 0.574293256f},
-std::array<float,2>{0.732588053f, 0.943005621f},
-std::array<float,2>{0.480346739f, 0.143001854f},
-std::array<float,2>{0.679785371f, 0.436094493f},
-std::array<float,2>{0.394599855f, 0.545464277f},
-std::array<float,2>{0.925036132f, 0.917286575f},
-std::array<float,2>{0.219311118f, 0.248623654f},
-std::array<float,2>{0.816150069f, 0.0507476591f},
-std::array<float,2>{0.048509296f, 0.784871638f},
-std::array<float,2>{0.598231137f, 0.643438756f},
-std::array<float,2>{0.317507923f, 0.313546449f},
-std::array<float,2>{0.505013466f, 0.155507311f},
-std::array<float,2>{0.259254396f, 0.952115059f},
-std::array<float,2>{0.795318067f, 0.564782917f},
-std::array<float,2>{0.0965764672f, 0.448593765f},
-std::array<float,2>{0.951146126f, 0.251152039f},
-std::array<float,2>{0.161220253f, 0.735297322f},
-std::array<float,2>{0.690500438f, 0.825596035f},
-std::array<float,2>{0.456609935f, 0.114614226f},
-std::array<float,2>{0.563854933f, 0.37164712f},
-std::array<float,2>{0.356595337f, 0.683795691f},
-std::array<float,2>{0.873023391f, 0.752901912f},
-std::array<float,2>{0.0259424001f, 0.000873882615f},
-std::array<float,2>{0.88617003f, 0.187884048f},
-std::array<float,2>{0.187813178f, 0.895140409f},
-std::array<float,2>{0.643903434f, 0.512127519f},
-std::array<float,2>{0.435490847f, 0.389098972f},
-std::array<float,2>{0.723546803f, 0.0824869275f},
-std::array<float,2>{0.470480084f, 0.86944592f},
-std::array<float,2>{0.986102521f, 0.713225663f},
-std::array<float,2>{0.130688041f, 0.300006121f},
-std::array<float,2>{0.752059698f, 0.47706306f},
-std::array<float,2>{0.0722476393f, 0.598765254f},
-std::array<float,2>{0.53201735f, 0.995850861f},
-std::array<float,2>{0.283033788f, 0.186285645f},
-std::array<float,2>{0.555860519f, 0.462214828f},
-std::array<float,2>{0.300751388f, 0.589848578f},
-std::array<float,2>{0.767716646f, 0.968262255f},
-std::array<float,2>{0.0797366574f, 0.132009402f},
-std::array<float,2>{0.977661431f, 0.100967355f},
-std::array<float,2>{0.143298611f, 0.830040812f},
-std::array<float,2>{0.749454975f, 0.7264238f},
-std::array<float,2>{0.496582061f, 0.275364876f},
-std::array<float,2>{0.63132906f, 0.229202911f},
-std::array<float,2>{0.416782588f, 0.923713148f},
-std::array<float,2>{0.896372676f, 0.550810218f},
-std::array<float,2>{0.209017828f, 0.418207407f},
-std::array<float,2>{0.856763363f, 0.339105964f},
-std::array<float,2>{0.0118012307f, 0.631286681f},
-std::array<float,2>{0.583640456f, 0.80139339f},
-std::array<float,2>{0.374617994f, 0.0382435285f},
-std::array<float,2>{0.707909822f, 0.290580362f},
-std::array<float,2>{0.450728685f, 0.701497257f},
-std::array<float,2>{0.956994891f, 0.855194747f},
-std::array<float,2>{0.185432792f, 0.0701797307f},
-std::array<float,2>{0.7990008f, 0.156466171f},
-std::array<float,2>{0.122076876f, 0.979995668f},
-std::array<float,2>{0.528572917f, 0.610971868f},
-std::array<float,2>{0.272268474f, 0.487260848f},
-std::array<float,2>{0.61004436f, 0.0161389355f},
-std::array<float,2>{0.332074314f, 0.771262586f},
-std::array<float,2>{0.830114543f, 0.668603599f},
-std::array<float,2>{0.0344658606f, 0.346058041f},
-std::array<float,2>{0.913103521f, 0.405657589f},
-std::array<float,2>{0.249895424f, 0.523236513f},
-std::array<float,2>{0.666802466f, 0.885079205f},
-std::array<float,2>{0.380530179f, 0.211853355f},
-std::array<float,2>{0.695121944f, 0.397323072f},
-std::array<float,2>{0.460476041f, 0.530326188f},
-std::array<float,2>{0.946230292f, 0.87621057f},
-std::array<float,2>{0.159772709f, 0.210767403f},
-std::array<float,2>{0.791983545f, 0.0295132659f},
-std::array<float,2>{0.101342097f, 0.777143121f},
-std::array<float,2>{0.503796756f, 0.659011185f},
-std::array<float,2>{0.265520275f, 0.35638231f},
-std::array<float,2>{0.597304046f, 0.165616468f},
-std::array<float,2>{0.312713861f, 0.971917868f},
-std::array<float,2>{0.81918174f, 0.62484467f},
-std::array<float,2>{0.0508114658f, 0.495410472f},
-std::array<float,2>{0.926625967f, 0.285982788f},
-std::array<float,2>{0.222984686f, 0.694797397f},
-std::array<float,2>{0.684693336f, 0.847472668f},
-std::array<float,2>{0.391973168f, 0.0714022219f},
-std::array<float,2>{0.535740197f, 0.331036061f},
-std::array<float,2>{0.286216915f, 0.634135365f},
-std::array<float,2>{0.757658839f, 0.806282699f},
-std::array<float,2>{0.0763227344f, 0.0411179587f},
-std::array<float,2>{0.988651991f, 0.220512062f},
-std::array<float,2>{0.125072494f, 0.931006372f},
-std::array<float,2>{0.721706152f, 0.561137855f},
-std::array<float,2>{0.476143301f, 0.412264466f},
-std::array<float,2>{0.646743f, 0.108137034f},
-std::array<float,2>{0.432495147f, 0.836696744f},
-std::array<float,2>{0.888493001f, 0.730968833f},
-std::array<float,2>{0.194194138f, 0.272425681f},
-std::array<float,2>{0.868113279f, 0.459563702f},
-std::array<float,2>{0.0293814279f, 0.585250914f},
-std::array<float,2>{0.567146242f, 0.95605576f},
-std::array<float,2>{0.353023678f, 0.138281286f},
-std::array<float,2>{0.57840234f, 0.472531557f},
-std::array<float,2>{0.368878871f, 0.604382515f},
-std::array<float,2>{0.8526721f, 0.988732874f},
-std::array<float,2>{0.0085665714f, 0.178861126f},
-std::array<float,2>{0.890688062f, 0.092365168f},
-std::array<float,2>{0.205328062f, 0.860895455f},
-std::array<float,2>{0.625339329f, 0.704768002f},
-std::array<float,2>{0.421691179f, 0.309645593f},
-std::array<float,2>{0.744357884f, 0.195615664f},
-std::array<float,2>{0.495926112f, 0.904962242f},
-std::array<float,2>{0.983059466f, 0.503892481f},
-std::array<float,2>{0.147341311f, 0.381979555f},
-std::array<float,2>{0.773285806f, 0.365213156f},
-std::array<float,2>{0.0857743695f, 0.679677963f},
-std::array<float,2>{0.559530258f, 0.759468853f},
-std::array<float,2>{0.30177322f, 0.0140649937f},
-std::array<float,2>{0.668059051f, 0.261632323f},
-std::array<float,2>{0.375032693f, 0.745765924f},
-std::array<float,2>{0.907014847f, 0.81523627f},
-std::array<float,2>{0.242538482f, 0.119055226f},
-std::array<float,2>{0.83585459f, 0.144747987f},
-std::array<float,2>{0.0359888189f, 0.939283669f},
-std::array<float,2>{0.613381505f, 0.570683181f},
-std::array<float,2>{0.331736028f, 0.440487534f},
-std::array<float,2>{0.526683927f, 0.0583710112f},
-std::array<float,2>{0.2682513f, 0.792880952f},
-std::array<float,2>{0.803437591f, 0.648642063f},
-std::array<float,2>{0.120360598f, 0.322500795f},
-std::array<float,2>{0.957577944f, 0.42254132f},
-std::array<float,2>{0.180111498f, 0.537681341f},
-std::array<float,2>{0.70486474f, 0.913713098f},
-std::array<float,2>{0.447232515f, 0.236876532f},
-std::array<float,2>{0.634620428f, 0.451956362f},
-std::array<float,2>{0.412848592f, 0.568792164f},
-std::array<float,2>{0.89977181f, 0.946618199f},
-std::array<float,2>{0.212712154f, 0.150712863f},
-std::array<float,2>{0.848508954f, 0.110500015f},
-std::array<float,2>{0.00367916538f, 0.823291302f},
-std::array<float,2>{0.587327182f, 0.740227103f},
-std::array<float,2>{0.363980293f, 0.256322384f},
-std::array<float,2>{0.547003686f, 0.245308459f},
-std::array<float,2>{0.306244284f, 0.920977712f},
-std::array<float,2>{0.776578128f, 0.541986287f},
-std::array<float,2>{0.0876638144f, 0.430016488f},
-std::array<float,2>{0.974585593f, 0.31912154f},
-std::array<float,2>{0.15384756f, 0.645773232f},
-std::array<float,2>{0.736323833f, 0.786369681f},
-std::array<float,2>{0.492095619f, 0.0513927154f},
-std::array<float,2>{0.623628616f, 0.301131696f},
-std::array<float,2>{0.337033093f, 0.714995027f},
-std::array<float,2>{0.839636207f, 0.871793449f},
-std::array<float,2>{0.0431529582f, 0.0817626715f},
-std::array<float,2>{0.914342344f, 0.182764083f},
-std::array<float,2>{0.241612807f, 0.999302387f},
-std::array<float,2>{0.662339866f, 0.597213805f},
-std::array<float,2>{0.387920767f, 0.48407349f},
-std::array<float,2>{0.717805326f, 0.00396216521f},
-std::array<float,2>{0.441553265f, 0.754538953f},
-std::array<float,2>{0.96584028f, 0.68115592f},
-std::array<float,2>{0.176861942f, 0.369330496f},
-std::array<float,2>{0.808266699f, 0.384450376f},
-std::array<float,2>{0.110841468f, 0.511468768f},
-std::array<float,2>{0.520301998f, 0.89186579f},
-std::array<float,2>{0.276454151f, 0.192935631f},
-std::array<float,2>{0.510870218f, 0.41611588f},
-std::array<float,2>{0.25482744f, 0.550674617f},
-std::array<float,2>{0.7862885f, 0.92613095f},
-std::array<float,2>{0.102907494f, 0.231437534f},
-std::array<float,2>{0.939760923f, 0.0342690572f},
-std::array<float,2>{0.166464075f, 0.798352897f},
-std::array<float,2>{0.699352384f, 0.628227949f},
-std::array<float,2>{0.466055602f, 0.343319088f},
-std::array<float,2>{0.674056232f, 0.128243536f},
-std::array<float,2>{0.401336432f, 0.963276863f},
-std::array<float,2>{0.936438024f, 0.58839649f},
-std::array<float,2>{0.226670012f, 0.468719572f},
-std::array<float,2>{0.826983392f, 0.278529048f},
-std::array<float,2>{0.0563115813f, 0.72049582f},
-std::array<float,2>{0.603184462f, 0.835510612f},
-std::array<float,2>{0.326041669f, 0.0948343426f},
-std::array<float,2>{0.729086995f, 0.34918043f},
-std::array<float,2>{0.480568618f, 0.664652228f},
-std::array<float,2>{0.992429137f, 0.768641412f},
-std::array<float,2>{0.133853629f, 0.0232117828f},
-std::array<float,2>{0.761777997f, 0.217762202f},
-std::array<float,2>{0.067830354f, 0.888728261f},
-std::array<float,2>{0.540913999f, 0.516141832f},
-std::array<float,2>{0.292438775f, 0.400079072f},
-std::array<float,2>{0.570319712f, 0.0631464794f},
-std::array<float,2>{0.346112788f, 0.858500957f},
-std::array<float,2>{0.867076099f, 0.696871459f},
-std::array<float,2>{0.0169262309f, 0.295440912f},
-std::array<float,2>{0.875848472f, 0.488282531f},
-std::array<float,2>{0.197416157f, 0.615093112f},
-std::array<float,2>{0.655384541f, 0.984250665f},
-std::array<float,2>{0.428456187f, 0.16253975f},
-std::array<float,2>{0.709277034f, 0.486568958f},
-std::array<float,2>{0.451737314f, 0.610669434f},
-std::array<float,2>{0.955054939f, 0.979520679f},
-std::array<float,2>{0.186572522f, 0.157204136f},
-std::array<float,2>{0.79769671f, 0.0695643649f},
-std::array<float,2>{0.123702884f, 0.854873538f},
-std::array<float,2>{0.531005621f, 0.702103078f},
-std::array<float,2>{0.270557046f, 0.290174723f},
-std::array<float,2>{0.611469209f, 0.21115607f},
-std::array<float,2>{0.334908754f, 0.88542974f},
-std::array<float,2>{0.829681039f, 0.522940874f},
-std::array<float,2>{0.0328452066f, 0.406045437f},
-std::array<float,2>{0.911668062f, 0.346478194f},
-std::array<float,2>{0.247436315f, 0.668091714f},
-std::array<float,2>{0.664670348f, 0.770945311f},
-std::array<float,2>{0.380912662f, 0.0160871763f},
-std::array<float,2>{0.556936264f, 0.274889976f},
-std::array<float,2>{0.296884894f, 0.725624502f},
-std::array<float,2>{0.766502678f, 0.829574168f},
-std::array<float,2>{0.0806733742f, 0.10127797f},
-std::array<float,2>{0.979063749f, 0.132735878f},
-std::array<float,2>{0.141286731f, 0.968215346f},
-std::array<float,2>{0.7479527f, 0.590784729f},
-std::array<float,2>{0.49958542f, 0.462438852f},
-std::array<float,2>{0.630696476f, 0.0386453159f},
-std::array<float,2>{0.415398061f, 0.801133573f},
-std::array<float,2>{0.898261726f, 0.631382644f},
-std::array<float,2>{0.207303047f, 0.339769036f},
-std::array<float,2>{0.858428597f, 0.418654412f},
-std::array<float,2>{0.0149672311f, 0.551597357f},
-std::array<float,2>{0.585903704f, 0.923324168f},
-std::array<float,2>{0.37264064f, 0.228870258f},
-std::array<float,2>{0.566135406f, 0.389526308f},
-std::array<float,2>{0.358117729f, 0.512668133f},
-std::array<float,2>{0.874562621f, 0.894762397f},
-std::array<float,2>{0.0239832234f, 0.188413769f},
-std::array<float,2>{0.884431481f, 0.000100257603f},
-std::array<float,2>{0.190589502f, 0.752224326f},
-std::array<float,2>{0.641671181f, 0.684345305f},
-std::array<float,2>{0.436537176f, 0.371468604f},
-std::array<float,2>{0.726028919f, 0.185936809f},
-std::array<float,2>{0.471747249f, 0.995243847f},
-std::array<float,2>{0.98772186f, 0.599396527f},
-std::array<float,2>{0.131536931f, 0.476585776f},
-std::array<float,2>{0.750452459f, 0.300657392f},
-std::array<float,2>{0.0726857409f, 0.713836312f},
-std::array<float,2>{0.534869671f, 0.869802535f},
-std::array<float,2>{0.283220232f, 0.0829688758f},
-std::array<float,2>{0.682311475f, 0.314245999f},
-std::array<float,2>{0.397125423f, 0.642908692f},
-std::array<float,2>{0.922895849f, 0.784468591f},
-std::array<float,2>{0.22219567f, 0.0498497635f},
-std::array<float,2>{0.81368959f, 0.248267174f},
-std::array<float,2>{0.0491579697f, 0.917675972f},
-std::array<float,2>{0.601299763f, 0.545015991f},
-std::array<float,2>{0.319866508f, 0.435568511f},
-std::array<float,2>{0.507215202f, 0.11478842f},
-std::array<float,2>{0.259787321f, 0.82574755f},
-std::array<float,2>{0.793351114f, 0.734547794f},
-std::array<float,2>{0.0949149504f, 0.251804262f},
-std::array<float,2>{0.952570498f, 0.448998094f},
-std::array<float,2>{0.163397327f, 0.56539166f},
-std::array<float,2>{0.687728941f, 0.951586843f},
-std::array<float,2>{0.454606622f, 0.156133547f},
-std::array<float,2>{0.650599957f, 0.427409649f},
-std::array<float,2>{0.422843039f, 0.532992899f},
-std::array<float,2>{0.881772399f, 0.906265318f},
-std::array<float,2>{0.203085288f, 0.240888864f},
-std::array<float,2>{0.86265099f, 0.0611859746f},
-std::array<float,2>{0.0233000014f, 0.792995811f},
-std::array<float,2>{0.576566041f, 0.653568983f},
-std::array<float,2>{0.35062325f, 0.326918334f},
-std::array<float,2>{0.544551313f, 0.14354451f},
-std::array<float,2>{0.294316322f, 0.942686498f},
-std::array<float,2>{0.760348976f, 0.574846387f},
-std::array<float,2>{0.0631470233f, 0.444848448f},
-std::array<float,2>{0.999121785f, 0.264202625f},
-std::array<float,2>{0.136784792f, 0.748947203f},
-std::array<float,2>{0.731547892f, 0.818909347f},
-std::array<float,2>{0.478328288f, 0.124098226f},
-std::array<float,2>{0.605518103f, 0.361122191f},
-std::array<float,2>{0.323597819f, 0.675355911f},
-std::array<float,2>{0.820686221f, 0.763218522f},
-std::array<float,2>{0.0612984672f, 0.0111861024f},
-std::array<float,2>{0.933107257f, 0.202266663f},
-std::array<float,2>{0.233462811f, 0.899623275f},
-std::array<float,2>{0.678595424f, 0.505065382f},
-std::array<float,2>{0.405304074f, 0.377501994f},
-std::array<float,2>{0.698542356f, 0.0878811106f},
-std::array<float,2>{0.462646633f, 0.867031097f},
-std::array<float,2>{0.942698658f, 0.707468927f},
-std::array<float,2>{0.170092046f, 0.304834008f},
-std::array<float,2>{0.782772362f, 0.475861192f},
-std::array<float,2>{0.10784778f, 0.609113336f},
-std::array<float,2>{0.512835562f, 0.987637043f},
-std::array<float,2>{0.251357883f, 0.172213525f},
-std::array<float,2>{0.518988013f, 0.453341335f},
-std::array<float,2>{0.278378397f, 0.579208672f},
-std::array<float,2>{0.811656296f, 0.957307458f},
-std::array<float,2>{0.11480657f, 0.133727163f},
-std::array<float,2>{0.963941038f, 0.103339635f},
-std::array<float,2>{0.174558774f, 0.843633056f},
-std::array<float,2>{0.713705897f, 0.72674787f},
-std::array<float,2>{0.439617157f, 0.26829946f},
-std::array<float,2>{0.659014404f, 0.223311707f},
-std::array<float,2>{0.383158118f, 0.935836911f},
-std::array<float,2>{0.921725214f, 0.555624902f},
-std::array<float,2>{0.237414777f, 0.406300932f},
-std::array<float,2>{0.842852235f, 0.335289538f},
-std::array<float,2>{0.041546192f, 0.640578866f},
-std::array<float,2>{0.61877799f, 0.812101781f},
-std::array<float,2>{0.340530366f, 0.0434729345f},
-std::array<float,2>{0.741247356f, 0.282266349f},
-std::array<float,2>{0.487833679f, 0.689255178f},
-std::array<float,2>{0.971560061f, 0.847971439f},
-std::array<float,2>{0.149815127f, 0.0749365911f},
-std::array<float,2>{0.779388487f, 0.17183055f},
-std::array<float,2>{0.0933452547f, 0.97354877f},
-std::array<float,2>{0.552217066f, 0.617519259f},
-std::array<float,2>{0.310886383f, 0.496258259f},
-std::array<float,2>{0.592519939f, 0.02727516f},
-std::array<float,2>{0.362536788f, 0.778527915f},
-std::array<float,2>{0.845710158f, 0.662385643f},
-std::array<float,2>{0.0068793227f, 0.353359133f},
-std::array<float,2>{0.90344584f, 0.390701801f},
-std::array<float,2>{0.218731835f, 0.52578944f},
-std::array<float,2>{0.637812674f, 0.879230559f},
-std::array<float,2>{0.407368809f, 0.206146553f},
-std::array<float,2>{0.728034258f, 0.399731755f},
-std::array<float,2>{0.482830703f, 0.515752196f},
-std::array<float,2>{0.995230436f, 0.889162242f},
-std::array<float,2>{0.134988561f, 0.21704562f},
-std::array<float,2>{0.763988018f, 0.0224961266f},
-std::array<float,2>{0.0687841624f, 0.769257784f},
-std::array<float,2>{0.542355657f, 0.664475143f},
-std::array<float,2>{0.29096964f, 0.349050343f},
-std::array<float,2>{0.57379061f, 0.163050547f},
-std::array<float,2>{0.345668495f, 0.98375684f},
-std::array<float,2>{0.86451292f, 0.614273369f},
-std::array<float,2>{0.0184749309f, 0.489076346f},
-std::array<float,2>{0.877622068f, 0.294989139f},
-std::array<float,2>{0.196600169f, 0.696713924f},
-std::array<float,2>{0.65410012f, 0.859155595f},
-std::array<float,2>{0.42673862f, 0.0627835542f},
-std::array<float,2>{0.509540796f, 0.3428922f},
-std::array<float,2>{0.257029772f, 0.628547192f},
-std::array<float,2>{0.788570404f, 0.798093319f},
-std::array<float,2>{0.104919098f, 0.0347150043f},
-std::array<float,2>{0.937856317f, 0.230817363f},
-std::array<float,2>{0.165824264f, 0.926308274f},
-std::array<float,2>{0.70304817f, 0.549941182f},
-std::array<float,2>{0.467678159f, 0.416636944f},
-std::array<float,2>{0.672952712f, 0.0954032317f},
-std::array<float,2>{0.398693711f, 0.835294604f},
-std::array<float,2>{0.9346084f, 0.719912231f},
-std::array<float,2>{0.228995442f, 0.27888602f},
-std::array<float,2>{0.824689329f, 0.468119562f},
-std::array<float,2>{0.0582329072f, 0.588259935f},
-std::array<float,2>{0.604420185f, 0.963515639f},
-std::array<float,2>{0.32627967f, 0.128571793f},
-std::array<float,2>{0.622003317f, 0.483610064f},
-std::array<float,2>{0.339602798f, 0.596879661f},
-std::array<float,2>{0.836113095f, 0.999537408f},
-std::array<float,2>{0.0463715158f, 0.183298811f},
-std::array<float,2>{0.917051196f, 0.0815177485f},
-std::array<float,2>{0.238735303f, 0.871301651f},
-std::array<float,2>{0.660888016f, 0.715468824f},
-std::array<float,2>{0.390005529f, 0.30140394f},
-std::array<float,2>{0.716666818f, 0.192619547f},
-std::array<float,2>{0.444689512f, 0.892308116f},
-std::array<float,2>{0.967519522f, 0.510960162f},
-std::array<float,2>{0.178427622f, 0.38403967f},
-std::array<float,2>{0.805411577f, 0.369654268f},
-std::array<float,2>{0.112749457f, 0.681093097f},
-std::array<float,2>{0.52180618f, 0.754033387f},
-std::array<float,2>{0.273774803f, 0.00476419972f},
-std::array<float,2>{0.635595977f, 0.256708473f},
-std::array<float,2>{0.411187261f, 0.739692509f},
-std::array<float,2>{0.901073515f, 0.823863685f},
-std::array<float,2>{0.214100376f, 0.111063361f},
-std::array<float,2>{0.849923134f, 0.150987208f},
-std::array<float,2>{0.000590449839f, 0.947136998f},
-std::array<float,2>{0.589450419f, 0.569215894f},
-std::array<float,2>{0.365462482f, 0.451273561f},
-std::array<float,2>{0.550475895f, 0.0512384586f},
-std::array<float,2>{0.306868464f, 0.786975443f},
-std::array<float,2>{0.773923874f, 0.646091521f},
-std::array<float,2>{0.0895127729f, 0.318716943f},
-std::array<float,2>{0.974709988f, 0.430649012f},
-std::array<float,2>{0.155186892f, 0.541226685f},
-std::array<float,2>{0.737481236f, 0.921585917f},
-std::array<float,2>{0.488620341f, 0.245965332f},
-std::array<float,2>{0.671401143f, 0.441338032f},
-std::array<float,2>{0.377043486f, 0.571181655f},
-std::array<float,2>{0.909829676f, 0.938554943f},
-std::array<float,2>{0.244907036f, 0.145461291f},
-std::array<float,2>{0.833437145f, 0.118290938f},
-std::array<float,2>{0.038303826f, 0.814874232f},
-std::array<float,2>{0.615683079f, 0.745189726f},
-std::array<float,2>{0.329408139f, 0.260868669f},
-std::array<float,2>{0.524981201f, 0.236724839f},
-std::array<float,2>{0.267263561f, 0.913251877f},
-std::array<float,2>{0.802065969f, 0.537469566f},
-std::array<float,2>{0.117334597f, 0.421958834f},
-std::array<float,2>{0.960369468f, 0.322819024f},
-std::array<float,2>{0.181867108f, 0.648979068f},
-std::array<float,2>{0.705888748f, 0.792335629f},
-std::array<float,2>{0.448555201f, 0.0579851307f},
-std::array<float,2>{0.581627786f, 0.310219765f},
-std::array<float,2>{0.370241523f, 0.704532206f},
-std::array<float,2>{0.854298174f, 0.860422432f},
-std::array<float,2>{0.0108050397f, 0.0919651538f},
-std::array<float,2>{0.893048704f, 0.179330632f},
-std::array<float,2>{0.203315794f, 0.989156067f},
-std::array<float,2>{0.627522707f, 0.60399276f},
-std::array<float,2>{0.419163972f, 0.472159833f},
-std::array<float,2>{0.742921829f, 0.0143776936f},
-std::array<float,2>{0.492491156f, 0.758965492f},
-std::array<float,2>{0.982015967f, 0.678744972f},
-std::array<float,2>{0.144781038f, 0.364448279f},
-std::array<float,2>{0.770084321f, 0.382608891f},
-std::array<float,2>{0.0824147165f, 0.503042042f},
-std::array<float,2>{0.561971724f, 0.904635012f},
-std::array<float,2>{0.304598868f, 0.196165338f},
-std::array<float,2>{0.537360251f, 0.412815988f},
-std::array<float,2>{0.288119823f, 0.560782433f},
-std::array<float,2>{0.755218983f, 0.931456864f},
-std::array<float,2>{0.0760981217f, 0.219773635f},
-std::array<float,2>{0.991163373f, 0.04177076f},
-std::array<float,2>{0.128418609f, 0.805768251f},
-std::array<float,2>{0.719489753f, 0.63471204f},
-std::array<float,2>{0.473266244f, 0.330224365f},
-std::array<float,2>{0.646077335f, 0.137959391f},
-std::array<float,2>{0.429753274f, 0.957029343f},
-std::array<float,2>{0.890260398f, 0.58566612f},
-std::array<float,2>{0.19280614f, 0.459066123f},
-std::array<float,2>{0.870010495f, 0.271848202f},
-std::array<float,2>{0.0290737823f, 0.730829477f},
-std::array<float,2>{0.569903374f, 0.836093247f},
-std::array<float,2>{0.355121732f, 0.107884936f},
-std::array<float,2>{0.692414105f, 0.355875224f},
-std::array<float,2>{0.457728565f, 0.658369422f},
-std::array<float,2>{0.94851464f, 0.776678324f},
-std::array<float,2>{0.158186138f, 0.0301286615f},
-std::array<float,2>{0.789959908f, 0.210229263f},
-std::array<float,2>{0.0989718586f, 0.876737833f},
-std::array<float,2>{0.501207352f, 0.53123498f},
-std::array<float,2>{0.263264418f, 0.396534592f},
-std::array<float,2>{0.594070196f, 0.0720222816f},
-std::array<float,2>{0.315098047f, 0.846746922f},
-std::array<float,2>{0.816823363f, 0.695127606f},
-std::array<float,2>{0.0544817522f, 0.285569042f},
-std::array<float,2>{0.928142369f, 0.496019006f},
-std::array<float,2>{0.226195723f, 0.62430644f},
-std::array<float,2>{0.686824024f, 0.972596049f},
-std::array<float,2>{0.393018901f, 0.165065736f},
-std::array<float,2>{0.749886453f, 0.464125723f},
-std::array<float,2>{0.496119708f, 0.593241334f},
-std::array<float,2>{0.978455365f, 0.965457618f},
-std::array<float,2>{0.142701656f, 0.130242035f},
-std::array<float,2>{0.768347681f, 0.0991093516f},
-std::array<float,2>{0.0792883039f, 0.831401885f},
-std::array<float,2>{0.556305051f, 0.723538339f},
-std::array<float,2>{0.300178766f, 0.276825875f},
-std::array<float,2>{0.583440125f, 0.22713843f},
-std::array<float,2>{0.374273777f, 0.92425251f},
-std::array<float,2>{0.857012749f, 0.554648161f},
-std::array<float,2>{0.0122473305f, 0.42128551f},
-std::array<float,2>{0.895907104f, 0.336854875f},
-std::array<float,2>{0.209722191f, 0.630716562f},
-std::array<float,2>{0.631623507f, 0.804162264f},
-std::array<float,2>{0.416295886f, 0.0369703509f},
-std::array<float,2>{0.528924048f, 0.29220292f},
-std::array<float,2>{0.271552384f, 0.700272322f},
-std::array<float,2>{0.799399555f, 0.8518309f},
-std::array<float,2>{0.122782663f, 0.0674430057f},
-std::array<float,2>{0.95642364f, 0.158880025f},
-std::array<float,2>{0.185054362f, 0.977734625f},
-std::array<float,2>{0.707234263f, 0.612013638f},
-std::array<float,2>{0.45021984f, 0.485975146f},
-std::array<float,2>{0.666473746f, 0.0186065063f},
-std::array<float,2>{0.380330175f, 0.771730006f},
-std::array<float,2>{0.91387862f, 0.670174122f},
-std::array<float,2>{0.249031514f, 0.344183862f},
-std::array<float,2>{0.830845177f, 0.403510213f},
-std::array<float,2>{0.0349651575f, 0.520091593f},
-std::array<float,2>{0.609815598f, 0.884721041f},
-std::array<float,2>{0.332794666f, 0.21454756f},
-std::array<float,2>{0.598099113f, 0.433845401f},
-std::array<float,2>{0.317878723f, 0.543418705f},
-std::array<float,2>{0.815669596f, 0.91410166f},
-std::array<float,2>{0.0480947345f, 0.247199818f},
-std::array<float,2>{0.925549328f, 0.0475860648f},
-std::array<float,2>{0.218752995f, 0.782440484f},
-std::array<float,2>{0.680271745f, 0.641875207f},
-std::array<float,2>{0.395439446f, 0.316162944f},
-std::array<float,2>{0.690934658f, 0.153137714f},
-std::array<float,2>{0.456540465f, 0.950478792f},
-std::array<float,2>{0.950397491f, 0.562787533f},
-std::array<float,2>{0.161958873f, 0.44636026f},
-std::array<float,2>{0.795536399f, 0.253436655f},
-std::array<float,2>{0.0960832089f, 0.738025546f},
-std::array<float,2>{0.505494297f, 0.827126563f},
-std::array<float,2>{0.259693831f, 0.116679832f},
-std::array<float,2>{0.644134641f, 0.373249948f},
-std::array<float,2>{0.434775829f, 0.687160373f},
-std::array<float,2>{0.886703193f, 0.750427842f},
-std::array<float,2>{0.1882191f, 0.00195902144f},
-std::array<float,2>{0.872084677f, 0.190219611f},
-std::array<float,2>{0.0253970642f, 0.896638453f},
-std::array<float,2>{0.564322412f, 0.514585614f},
-std::array<float,2>{0.357353896f, 0.387848437f},
-std::array<float,2>{0.531304121f, 0.0841361061f},
-std::array<float,2>{0.282332897f, 0.867505312f},
-std::array<float,2>{0.752494395f, 0.711787164f},
-std::array<float,2>{0.0715988874f, 0.297783017f},
-std::array<float,2>{0.985363126f, 0.480446696f},
-std::array<float,2>{0.130240768f, 0.600129664f},
-std::array<float,2>{0.723028123f, 0.993280888f},
-std::array<float,2>{0.469976127f, 0.185380653f},
-std::array<float,2>{0.675949812f, 0.376078337f},
-std::array<float,2>{0.402562886f, 0.507623851f},
-std::array<float,2>{0.930919886f, 0.901619494f},
-std::array<float,2>{0.231842771f, 0.200989455f},
-std::array<float,2>{0.823819399f, 0.00939874072f},
-std::array<float,2>{0.0596841685f, 0.764395952f},
-std::array<float,2>{0.608343184f, 0.673648298f},
-std::array<float,2>{0.321959645f, 0.362732947f},
-std::array<float,2>{0.514500976f, 0.175309002f},
-std::array<float,2>{0.252511144f, 0.986020207f},
-std::array<float,2>{0.7841205f, 0.607356369f},
-std::array<float,2>{0.106647581f, 0.473152936f},
-std::array<float,2>{0.945215225f, 0.307178557f},
-std::array<float,2>{0.16964139f, 0.70952493f},
-std::array<float,2>{0.695959389f, 0.864733577f},
-std::array<float,2>{0.464123458f, 0.0885439888f},
-std::array<float,2>{0.574805498f, 0.324746102f},
-std::array<float,2>{0.348356843f, 0.654592872f},
-std::array<float,2>{0.859887242f, 0.796849191f},
-std::array<float,2>{0.0197828263f, 0.0604666881f},
-std::array<float,2>{0.8801682f, 0.238351449f},
-std::array<float,2>{0.20007503f, 0.910100222f},
-std::array<float,2>{0.649517953f, 0.534730017f},
-std::array<float,2>{0.423934668f, 0.428129792f},
-std::array<float,2>{0.733063042f, 0.121830173f},
-std::array<float,2>{0.479633927f, 0.816619277f},
-std::array<float,2>{0.997983634f, 0.746349275f},
-std::array<float,2>{0.139822692f, 0.263551533f},
-std::array<float,2>{0.75830102f, 0.441567957f},
-std::array<float,2>{0.0648186132f, 0.576268435f},
-std::array<float,2>{0.54638046f, 0.945012271f},
-std::array<float,2>{0.295572668f, 0.141119465f},
-std::array<float,2>{0.553992331f, 0.498464525f},
-std::array<float,2>{0.309654355f, 0.620330393f},
-std::array<float,2>{0.77890861f, 0.975536048f},
-std::array<float,2>{0.090750128f, 0.169012114f},
-std::array<float,2>{0.96984601f, 0.0765407085f},
-std::array<float,2>{0.151370317f, 0.851076543f},
-std::array<float,2>{0.738905609f, 0.690353572f},
-std::array<float,2>{0.485045254f, 0.284754574f},
-std::array<float,2>{0.639273345f, 0.203776717f},
-std::array<float,2>{0.408601344f, 0.88207078f},
-std::array<float,2>{0.906222403f, 0.523941875f},
-std::array<float,2>{0.216019899f, 0.392928392f},
-std::array<float,2>{0.843841016f, 0.355022013f},
-std::array<float,2>{0.0054490827f, 0.662066162f},
-std::array<float,2>{0.591571331f, 0.780777454f},
-std::array<float,2>{0.361256003f, 0.0235965736f},
-std::array<float,2>{0.711895883f, 0.266733885f},
-std::array<float,2>{0.437918395f, 0.729997635f},
-std::array<float,2>{0.962064862f, 0.840702415f},
-std::array<float,2>{0.173584685f, 0.104374155f},
-std::array<float,2>{0.810040057f, 0.135468632f},
-std::array<float,2>{0.115584888f, 0.9591676f},
-std::array<float,2>{0.516856909f, 0.580928028f},
-std::array<float,2>{0.280798644f, 0.455542713f},
-std::array<float,2>{0.621033609f, 0.0454261079f},
-std::array<float,2>{0.341982991f, 0.810334802f},
-std::array<float,2>{0.841315687f, 0.637587488f},
-std::array<float,2>{0.0403175168f, 0.332954854f},
-std::array<float,2>{0.919407248f, 0.409053773f},
-std::array<float,2>{0.234994888f, 0.557338953f},
-std::array<float,2>{0.65771991f, 0.934857666f},
-std::array<float,2>{0.385814697f, 0.225494921f},
-std::array<float,2>{0.70009613f, 0.415135145f},
-std::array<float,2>{0.466498196f, 0.548330486f},
-std::array<float,2>{0.940366626f, 0.928670824f},
-std::array<float,2>{0.166558415f, 0.232664376f},
-std::array<float,2>{0.787063241f, 0.0319057778f},
-std::array<float,2>{0.103318423f, 0.799227953f},
-std::array<float,2>{0.511367738f, 0.625886202f},
-std::array<float,2>{0.254007578f, 0.340411395f},
-std::array<float,2>{0.602621913f, 0.126093075f},
-std::array<float,2>{0.32554695f, 0.961483538f},
-std::array<float,2>{0.826310754f, 0.587533712f},
-std::array<float,2>{0.056111142f, 0.465566605f},
-std::array<float,2>{0.935715616f, 0.281031162f},
-std::array<float,2>{0.227172762f, 0.721413195f},
-std::array<float,2>{0.674648941f, 0.832318604f},
-std::array<float,2>{0.40042913f, 0.0957714766f},
-std::array<float,2>{0.540378749f, 0.350158244f},
-std::array<float,2>{0.292681009f, 0.666577041f},
-std::array<float,2>{0.76238066f, 0.767186046f},
-std::array<float,2>{0.0679885969f, 0.0205940064f},
-std::array<float,2>{0.992828071f, 0.215947136f},
-std::array<float,2>{0.134344488f, 0.88733995f},
-std::array<float,2>{0.728964329f, 0.519208252f},
-std::array<float,2>{0.481440663f, 0.400542706f},
-std::array<float,2>{0.656061172f, 0.0663208067f},
-std::array<float,2>{0.427773386f, 0.857126594f},
-std::array<float,2>{0.875132501f, 0.697542071f},
-std::array<float,2>{0.197792113f, 0.293892801f},
-std::array<float,2>{0.866664231f, 0.490457475f},
-std::array<float,2>{0.0174308065f, 0.616477251f},
-std::array<float,2>{0.570824802f, 0.981857955f},
-std::array<float,2>{0.346342236f, 0.160977066f},
-std::array<float,2>{0.587626278f, 0.450572789f},
-std::array<float,2>{0.363387942f, 0.568031788f},
-std::array<float,2>{0.847718537f, 0.948197603f},
-std::array<float,2>{0.00330863311f, 0.149041891f},
-std::array<float,2>{0.900331795f, 0.112815857f},
-std::array<float,2>{0.212243825f, 0.820502102f},
-std::array<float,2>{0.633848846f, 0.74095428f},
-std::array<float,2>{0.412347585f, 0.255790144f},
-std::array<float,2>{0.735688269f, 0.24260436f},
-std::array<float,2>{0.491680473f, 0.918103516f},
-std::array<float,2>{0.973941863f, 0.540473104f},
-std::array<float,2>{0.153542668f, 0.433313698f},
-std::array<float,2>{0.77706331f, 0.316855043f},
-std::array<float,2>{0.086945951f, 0.647357106f},
-std::array<float,2>{0.547753394f, 0.787804186f},
-std::array<float,2>{0.305760056f, 0.0546705239f},
-std::array<float,2>{0.662885904f, 0.30365482f},
-std::array<float,2>{0.388645142f, 0.717573166f},
-std::array<float,2>{0.914584339f, 0.873957396f},
-std::array<float,2>{0.241841152f, 0.0784124359f},
-std::array<float,2>{0.839243531f, 0.181248054f},
-std::array<float,2>{0.0437858962f, 0.997074664f},
-std::array<float,2>{0.62351191f, 0.593758762f},
-std::array<float,2>{0.337512225f, 0.481870562f},
-std::array<float,2>{0.519855857f, 0.0072663324f},
-std::array<float,2>{0.277026266f, 0.756356597f},
-std::array<float,2>{0.807698846f, 0.682075739f},
-std::array<float,2>{0.110404991f, 0.368870497f},
-std::array<float,2>{0.966655195f, 0.385806978f},
-std::array<float,2>{0.177625388f, 0.507978141f},
-std::array<float,2>{0.718390286f, 0.893225014f},
-std::array<float,2>{0.441964597f, 0.193767905f},
-std::array<float,2>{0.625731289f, 0.469439268f},
-std::array<float,2>{0.421247303f, 0.602038741f},
-std::array<float,2>{0.891274393f, 0.991226554f},
-std::array<float,2>{0.205827579f, 0.176134616f},
-std::array<float,2>{0.853360415f, 0.0906186774f},
-std::array<float,2>{0.00801530574f, 0.862826407f},
-std::array<float,2>{0.578890383f, 0.706085801f},
-std::array<float,2>{0.368436545f, 0.312389314f},
-std::array<float,2>{0.559031725f, 0.19726935f},
-std::array<float,2>{0.302522153f, 0.903155625f},
-std::array<float,2>{0.772906959f, 0.500130475f},
-std::array<float,2>{0.085354805f, 0.379373461f},
-std::array<float,2>{0.982742131f, 0.365676105f},
-std::array<float,2>{0.146706805f, 0.675938249f},
-std::array<float,2>{0.744717956f, 0.761473894f},
-std::array<float,2>{0.495231867f, 0.0118378485f},
-std::array<float,2>{0.613910973f, 0.259124935f},
-std::array<float,2>{0.331275851f, 0.743656993f},
-std::array<float,2>{0.835101843f, 0.81370157f},
-std::array<float,2>{0.03536864f, 0.120707087f},
-std::array<float,2>{0.906698525f, 0.147485867f},
-std::array<float,2>{0.242923662f, 0.939925194f},
-std::array<float,2>{0.668734908f, 0.573599815f},
-std::array<float,2>{0.375698805f, 0.439017534f},
-std::array<float,2>{0.704587519f, 0.0564670824f},
-std::array<float,2>{0.446746707f, 0.789984286f},
-std::array<float,2>{0.957165539f, 0.65145725f},
-std::array<float,2>{0.180474222f, 0.321902066f},
-std::array<float,2>{0.803072155f, 0.424352795f},
-std::array<float,2>{0.120734319f, 0.536903918f},
-std::array<float,2>{0.52691108f, 0.910612643f},
-std::array<float,2>{0.267645031f, 0.234722868f},
-std::array<float,2>{0.50336194f, 0.39474532f},
-std::array<float,2>{0.265033513f, 0.52870661f},
-std::array<float,2>{0.79122591f, 0.877103925f},
-std::array<float,2>{0.101045854f, 0.208808243f},
-std::array<float,2>{0.945551157f, 0.0288139451f},
-std::array<float,2>{0.159586623f, 0.773461878f},
-std::array<float,2>{0.694800079f, 0.657795787f},
-std::array<float,2>{0.460088909f, 0.358071178f},
-std::array<float,2>{0.685234427f, 0.167556718f},
-std::array<float,2>{0.392387301f, 0.970668733f},
-std::array<float,2>{0.926196754f, 0.621506155f},
-std::array<float,2>{0.223184213f, 0.492812485f},
-std::array<float,2>{0.818370819f, 0.288364381f},
-std::array<float,2>{0.051419761f, 0.693057179f},
-std::array<float,2>{0.596795738f, 0.843873739f},
-std::array<float,2>{0.313278317f, 0.0741266832f},
-std::array<float,2>{0.722461462f, 0.32864657f},
-std::array<float,2>{0.475763679f, 0.636198342f},
-std::array<float,2>{0.988822877f, 0.806952357f},
-std::array<float,2>{0.1257779f, 0.0398493446f},
-std::array<float,2>{0.757042348f, 0.222486898f},
-std::array<float,2>{0.0767146498f, 0.932752252f},
-std::array<float,2>{0.535597742f, 0.56001848f},
-std::array<float,2>{0.286733836f, 0.411569864f},
-std::array<float,2>{0.566636503f, 0.106571265f},
-std::array<float,2>{0.353235185f, 0.839467347f},
-std::array<float,2>{0.867591798f, 0.73359251f},
-std::array<float,2>{0.0300758705f, 0.269763768f},
-std::array<float,2>{0.887768149f, 0.45823282f},
-std::array<float,2>{0.193443343f, 0.583819628f},
-std::array<float,2>{0.646976352f, 0.95379281f},
-std::array<float,2>{0.431915492f, 0.1392961f},
-std::array<float,2>{0.688791871f, 0.446011603f},
-std::array<float,2>{0.453623831f, 0.564433753f},
-std::array<float,2>{0.951251924f, 0.949617743f},
-std::array<float,2>{0.162435979f, 0.15337263f},
-std::array<float,2>{0.794794738f, 0.115707695f},
-std::array<float,2>{0.0946007967f, 0.8272506f},
-std::array<float,2>{0.505908132f, 0.736732781f},
-std::array<float,2>{0.261273384f, 0.252313823f},
-std::array<float,2>{0.600236654f, 0.246271312f},
-std::array<float,2>{0.318831682f, 0.915164649f},
-std::array<float,2>{0.812568128f, 0.544463933f},
-std::array<float,2>{0.0501273796f, 0.434969336f},
-std::array<float,2>{0.921971142f, 0.314760059f},
-std::array<float,2>{0.221472353f, 0.641029596f},
-std::array<float,2>{0.683301508f, 0.781519055f},
-std::array<float,2>{0.397583455f, 0.0487464443f},
-std::array<float,2>{0.534002542f, 0.298520774f},
-std::array<float,2>{0.284549952f, 0.712426543f},
-std::array<float,2>{0.751458228f, 0.868395388f},
-std::array<float,2>{0.0732568577f, 0.0854971483f},
-std::array<float,2>{0.986651897f, 0.184059724f},
-std::array<float,2>{0.132271498f, 0.992387712f},
-std::array<float,2>{0.724850357f, 0.601285517f},
-std::array<float,2>{0.471671879f, 0.478590906f},
-std::array<float,2>{0.641441882f, 0.00310509489f},
-std::array<float,2>{0.436370045f, 0.751026988f},
-std::array<float,2>{0.882923126f, 0.686053574f},
-std::array<float,2>{0.190357134f, 0.374841601f},
-std::array<float,2>{0.873087287f, 0.387477249f},
-std::array<float,2>{0.0253546201f, 0.514683783f},
-std::array<float,2>{0.56475836f, 0.897688329f},
-std::array<float,2>{0.359315366f, 0.191149607f},
-std::array<float,2>{0.584801674f, 0.42016232f},
-std::array<float,2>{0.371257603f, 0.552833498f},
-std::array<float,2>{0.858049333f, 0.925234854f},
-std::array<float,2>{0.0142916013f, 0.228364393f},
-std::array<float,2>{0.89664799f, 0.0357665531f},
-std::array<float,2>{0.208014697f, 0.803581297f},
-std::array<float,2>{0.629761994f, 0.629501939f},
-std::array<float,2>{0.415013134f, 0.33707884f},
-std::array<float,2>{0.746807575f, 0.129437074f},
-std::array<float,2>{0.498550624f, 0.966430545f},
-std::array<float,2>{0.979542553f, 0.592033625f},
-std::array<float,2>{0.141631722f, 0.46293515f},
-std::array<float,2>{0.76708895f, 0.276303411f},
-std::array<float,2>{0.0814600587f, 0.724032402f},
-std::array<float,2>{0.557758749f, 0.830453694f},
-std::array<float,2>{0.298557907f, 0.0981092751f},
-std::array<float,2>{0.665337145f, 0.345283717f},
-std::array<float,2>{0.382115036f, 0.670992553f},
-std::array<float,2>{0.910864294f, 0.772674322f},
-std::array<float,2>{0.246895045f, 0.0179261509f},
-std::array<float,2>{0.828991175f, 0.213284165f},
-std::array<float,2>{0.031276349f, 0.882970214f},
-std::array<float,2>{0.613198638f, 0.520887971f},
-std::array<float,2>{0.335842013f, 0.403221756f},
-std::array<float,2>{0.530182064f, 0.0672993883f},
-std::array<float,2>{0.270349056f, 0.853398919f},
-std::array<float,2>{0.797926843f, 0.699288726f},
-std::array<float,2>{0.124050073f, 0.291602194f},
-std::array<float,2>{0.953473091f, 0.484860778f},
-std::array<float,2>{0.185908824f, 0.61311233f},
-std::array<float,2>{0.71014899f, 0.977328956f},
-std::array<float,2>{0.452387512f, 0.159937441f},
-std::array<float,2>{0.636748672f, 0.394252807f},
-std::array<float,2>{0.407003284f, 0.524684668f},
-std::array<float,2>{0.902537644f, 0.88158989f},
-std::array<float,2>{0.217043146f, 0.204884738f},
-std::array<float,2>{0.847296f, 0.0249622073f},
-std::array<float,2>{0.00654897094f, 0.779786468f},
-std::array<float,2>{0.593277454f, 0.660842597f},
-std::array<float,2>{0.361836731f, 0.354029357f},
-std::array<float,2>{0.55161202f, 0.168570608f},
-std::array<float,2>{0.312007934f, 0.976561785f},
-std::array<float,2>{0.780483305f, 0.619186878f},
-std::array<float,2>{0.0923497602f, 0.49958837f},
-std::array<float,2>{0.972423375f, 0.283956081f},
-std::array<float,2>{0.149294645f, 0.690669775f},
-std::array<float,2>{0.741136372f, 0.850025594f},
-std::array<float,2>{0.486714751f, 0.077612251f},
-std::array<float,2>{0.6176278f, 0.333400488f},
-std::array<float,2>{0.341541588f, 0.638270676f},
-std::array<float,2>{0.842729449f, 0.808899224f},
-std::array<float,2>{0.042143371f, 0.0461336076f},
-std::array<float,2>{0.920054376f, 0.226199061f},
-std::array<float,2>{0.236404538f, 0.934398472f},
-std::array<float,2>{0.659586072f, 0.558316648f},
-std::array<float,2>{0.384581178f, 0.409920603f},
-std::array<float,2>{0.713887095f, 0.105068401f},
-std::array<float,2>{0.440868258f, 0.841318607f},
-std::array<float,2>{0.96378994f, 0.729483306f},
-std::array<float,2>{0.174972653f, 0.266100168f},
-std::array<float,2>{0.811033785f, 0.457011819f},
-std::array<float,2>{0.113801546f, 0.58146894f},
-std::array<float,2>{0.518327951f, 0.960830688f},
-std::array<float,2>{0.2781111f, 0.136212274f},
-std::array<float,2>{0.511876166f, 0.474133462f},
-std::array<float,2>{0.250802815f, 0.605792344f},
-std::array<float,2>{0.781689107f, 0.985172749f},
-std::array<float,2>{0.109202646f, 0.173885316f},
-std::array<float,2>{0.942072332f, 0.0894948617f},
-std::array<float,2>{0.171085179f, 0.863467932f},
-std::array<float,2>{0.697635055f, 0.710857451f},
-std::array<float,2>{0.461549997f, 0.308012009f},
-std::array<float,2>{0.679376841f, 0.199995339f},
-std::array<float,2>{0.404832333f, 0.90107888f},
-std::array<float,2>{0.932397902f, 0.506526351f},
-std::array<float,2>{0.232560605f, 0.37584132f},
-std::array<float,2>{0.821490347f, 0.361333728f},
-std::array<float,2>{0.0619659461f, 0.67270273f},
-std::array<float,2>{0.607242882f, 0.765470505f},
-std::array<float,2>{0.323017955f, 0.00872369669f},
-std::array<float,2>{0.730480671f, 0.262050003f},
-std::array<float,2>{0.477511585f, 0.747502983f},
-std::array<float,2>{0.998609722f, 0.818302691f},
-std::array<float,2>{0.138368085f, 0.122262634f},
-std::array<float,2>{0.761716962f, 0.14211382f},
-std::array<float,2>{0.063853167f, 0.943481505f},
-std::array<float,2>{0.543338895f, 0.577712059f},
-std::array<float,2>{0.293115139f, 0.442966312f},
-std::array<float,2>{0.577574313f, 0.0595375486f},
-std::array<float,2>{0.350550503f, 0.795614004f},
-std::array<float,2>{0.862097085f, 0.655836225f},
-std::array<float,2>{0.0219647214f, 0.326086968f},
-std::array<float,2>{0.882546842f, 0.429278195f},
-std::array<float,2>{0.201301426f, 0.534043133f},
-std::array<float,2>{0.65144664f, 0.909036815f},
-std::array<float,2>{0.423626035f, 0.239832774f},
-std::array<float,2>{0.736636937f, 0.431980193f},
-std::array<float,2>{0.490038991f, 0.539269984f},
-std::array<float,2>{0.976233006f, 0.919335306f},
-std::array<float,2>{0.155902341f, 0.243695006f},
-std::array<float,2>{0.775061071f, 0.0535685383f},
-std::array<float,2>{0.0888078287f, 0.78900975f},
-std::array<float,2>{0.549708247f, 0.647624731f},
-std::array<float,2>{0.308163822f, 0.317786187f},
-std::array<float,2>{0.58841157f, 0.14963603f},
-std::array<float,2>{0.366990328f, 0.948917866f},
-std::array<float,2>{0.851440012f, 0.566689909f},
-std::array<float,2>{0.00113500445f, 0.449968725f},
-std::array<float,2>{0.901570737f, 0.254356891f},
-std::array<float,2>{0.213074818f, 0.742125392f},
-std::array<float,2>{0.636653841f, 0.821468055f},
-std::array<float,2>{0.410748482f, 0.11167001f},
-std::array<float,2>{0.522671998f, 0.367477953f},
-std::array<float,2>{0.274962246f, 0.683532953f},
-std::array<float,2>{0.806410611f, 0.756965041f},
-std::array<float,2>{0.112213939f, 0.00587629573f},
-std::array<float,2>{0.968474269f, 0.194964677f},
-std::array<float,2>{0.179254726f, 0.894383669f},
-std::array<float,2>{0.715574801f, 0.509111702f},
-std::array<float,2>{0.444054067f, 0.385582805f},
-std::array<float,2>{0.66143328f, 0.0797451735f},
-std::array<float,2>{0.388959378f, 0.874976456f},
-std::array<float,2>{0.916757226f, 0.718185425f},
-std::array<float,2>{0.23967278f, 0.303969622f},
-std::array<float,2>{0.837393522f, 0.480641663f},
-std::array<float,2>{0.0452716425f, 0.594874799f},
-std::array<float,2>{0.622307062f, 0.99640131f},
-std::array<float,2>{0.338689089f, 0.179800123f},
-std::array<float,2>{0.60503f, 0.466143191f},
-std::array<float,2>{0.327854335f, 0.586203873f},
-std::array<float,2>{0.825698733f, 0.962867618f},
-std::array<float,2>{0.0569655262f, 0.125951067f},
-std::array<float,2>{0.933877051f, 0.0971180871f},
-std::array<float,2>{0.230413198f, 0.833865047f},
-std::array<float,2>{0.672614694f, 0.721746922f},
-std::array<float,2>{0.400367707f, 0.27958101f},
-std::array<float,2>{0.701659143f, 0.234027117f},
-std::array<float,2>{0.468309671f, 0.92886734f},
-std::array<float,2>{0.938711405f, 0.54734242f},
-std::array<float,2>{0.164075643f, 0.414527684f},
-std::array<float,2>{0.787734926f, 0.341152936f},
-std::array<float,2>{0.104115881f, 0.626481771f},
-std::array<float,2>{0.508604646f, 0.799921393f},
-std::array<float,2>{0.255943984f, 0.032881286f},
-std::array<float,2>{0.652854264f, 0.294794917f},
-std::array<float,2>{0.426860631f, 0.699187458f},
-std::array<float,2>{0.878563702f, 0.856108427f},
-std::array<float,2>{0.196037918f, 0.0647565275f},
-std::array<float,2>{0.863415122f, 0.16210632f},
-std::array<float,2>{0.0191330034f, 0.980505407f},
-std::array<float,2>{0.572965801f, 0.615505099f},
-std::array<float,2>{0.343941718f, 0.491640598f},
-std::array<float,2>{0.54154563f, 0.0203169622f},
-std::array<float,2>{0.289081663f, 0.766340911f},
-std::array<float,2>{0.765259862f, 0.667589605f},
-std::array<float,2>{0.0701077804f, 0.351072133f},
-std::array<float,2>{0.994352818f, 0.402014256f},
-std::array<float,2>{0.136091948f, 0.518328249f},
-std::array<float,2>{0.727484107f, 0.887981951f},
-std::array<float,2>{0.483518302f, 0.215071842f},
-std::array<float,2>{0.685820878f, 0.493266821f},
-std::array<float,2>{0.39405027f, 0.62291193f},
-std::array<float,2>{0.929090619f, 0.969479382f},
-std::array<float,2>{0.225144371f, 0.16646786f},
-std::array<float,2>{0.817492008f, 0.0731202364f},
-std::array<float,2>{0.0527865104f, 0.844833434f},
-std::array<float,2>{0.595363438f, 0.691604376f},
-std::array<float,2>{0.315772116f, 0.287613004f},
-std::array<float,2>{0.500466764f, 0.207400516f},
-std::array<float,2>{0.262419671f, 0.878296435f},
-std::array<float,2>{0.790145338f, 0.527422428f},
-std::array<float,2>{0.0976751149f, 0.396480471f},
-std::array<float,2>{0.947568178f, 0.358643383f},
-std::array<float,2>{0.156312913f, 0.657224655f},
-std::array<float,2>{0.691716731f, 0.775020897f},
-std::array<float,2>{0.458741963f, 0.028316915f},
-std::array<float,2>{0.569110692f, 0.271221876f},
-std::array<float,2>{0.353971243f, 0.733358741f},
-std::array<float,2>{0.871040583f, 0.838419318f},
-std::array<float,2>{0.0278653726f, 0.105778262f},
-std::array<float,2>{0.889411092f, 0.140343487f},
-std::array<float,2>{0.191776112f, 0.954224944f},
-std::array<float,2>{0.645204484f, 0.582565069f},
-std::array<float,2>{0.431115955f, 0.457158476f},
-std::array<float,2>{0.720375121f, 0.0400625393f},
-std::array<float,2>{0.474205345f, 0.808339477f},
-std::array<float,2>{0.991393268f, 0.635247529f},
-std::array<float,2>{0.126986682f, 0.329853028f},
-std::array<float,2>{0.754304707f, 0.410676271f},
-std::array<float,2>{0.0748723447f, 0.558992386f},
-std::array<float,2>{0.538902342f, 0.932050884f},
-std::array<float,2>{0.287293404f, 0.221162066f},
-std::array<float,2>{0.561238945f, 0.380336642f},
-std::array<float,2>{0.303624809f, 0.501938403f},
-std::array<float,2>{0.771110594f, 0.903374493f},
-std::array<float,2>{0.0831124559f, 0.199021831f},
-std::array<float,2>{0.981193244f, 0.0130623244f},
-std::array<float,2>{0.145859987f, 0.760683119f},
-std::array<float,2>{0.74334836f, 0.676926136f},
-std::array<float,2>{0.493686467f, 0.366439164f},
-std::array<float,2>{0.628405213f, 0.17748791f},
-std::array<float,2>{0.418004304f, 0.991065979f},
-std::array<float,2>{0.893775284f, 0.602607191f},
-std::array<float,2>{0.204870164f, 0.46998316f},
-std::array<float,2>{0.855297625f, 0.311482817f},
-std::array<float,2>{0.0101333531f, 0.705750167f},
-std::array<float,2>{0.580618083f, 0.861569822f},
-std::array<float,2>{0.370027214f, 0.0911815912f},
-std::array<float,2>{0.706626952f, 0.320655227f},
-std::array<float,2>{0.447719932f, 0.650817811f},
-std::array<float,2>{0.95974493f, 0.790521204f},
-std::array<float,2>{0.18325758f, 0.0551018566f},
-std::array<float,2>{0.801194608f, 0.235935509f},
-std::array<float,2>{0.119114853f, 0.912023425f},
-std::array<float,2>{0.523866177f, 0.535551071f},
-std::array<float,2>{0.266281396f, 0.425092131f},
-std::array<float,2>{0.616673589f, 0.120032951f},
-std::array<float,2>{0.328137994f, 0.813210666f},
-std::array<float,2>{0.832325101f, 0.74292028f},
-std::array<float,2>{0.0373812765f, 0.258102804f},
-std::array<float,2>{0.908492386f, 0.438420475f},
-std::array<float,2>{0.245505869f, 0.572781742f},
-std::array<float,2>{0.670637429f, 0.940502644f},
-std::array<float,2>{0.378356427f, 0.146526799f},
-std::array<float,2>{0.723669171f, 0.478341222f},
-std::array<float,2>{0.468841344f, 0.597947299f},
-std::array<float,2>{0.984510362f, 0.994184136f},
-std::array<float,2>{0.129321948f, 0.186682478f},
-std::array<float,2>{0.753131926f, 0.0836130306f},
-std::array<float,2>{0.0706231892f, 0.870482922f},
-std::array<float,2>{0.532816172f, 0.71473676f},
-std::array<float,2>{0.281722188f, 0.299429268f},
-std::array<float,2>{0.56343621f, 0.189052597f},
-std::array<float,2>{0.355696291f, 0.896270037f},
-std::array<float,2>{0.871755421f, 0.51277405f},
-std::array<float,2>{0.0272199195f, 0.390362352f},
-std::array<float,2>{0.885106623f, 0.372887701f},
-std::array<float,2>{0.188795879f, 0.684656858f},
-std::array<float,2>{0.643389821f, 0.753078222f},
-std::array<float,2>{0.433935404f, 0.00172142568f},
-std::array<float,2>{0.504862666f, 0.250846982f},
-std::array<float,2>{0.258623064f, 0.735996783f},
-std::array<float,2>{0.79591012f, 0.824846566f},
-std::array<float,2>{0.0975274593f, 0.113924779f},
-std::array<float,2>{0.949559152f, 0.154589728f},
-std::array<float,2>{0.161099434f, 0.952353179f},
-std::array<float,2>{0.689963043f, 0.565859616f},
-std::array<float,2>{0.455762923f, 0.447320104f},
-std::array<float,2>{0.681100607f, 0.0497101024f},
-std::array<float,2>{0.39615199f, 0.783289313f},
-std::array<float,2>{0.923865736f, 0.643558443f},
-std::array<float,2>{0.22011824f, 0.312716812f},
-std::array<float,2>{0.814822733f, 0.437362194f},
-std::array<float,2>{0.0472718291f, 0.546421289f},
-std::array<float,2>{0.599514663f, 0.91603899f},
-std::array<float,2>{0.317022711f, 0.249937132f},
-std::array<float,2>{0.610859811f, 0.404306203f},
-std::array<float,2>{0.333150625f, 0.521879256f},
-std::array<float,2>{0.831160605f, 0.886203289f},
-std::array<float,2>{0.034148708f, 0.212118059f},
-std::array<float,2>{0.912409425f, 0.0174597707f},
-std::array<float,2>{0.248272002f, 0.769637287f},
-std::array<float,2>{0.667573392f, 0.669762135f},
-std::array<float,2>{0.378924221f, 0.347299457f},
-std::array<float,2>{0.708064675f, 0.157807827f},
-std::array<float,2>{0.449372888f, 0.979170144f},
-std::array<float,2>{0.955255747f, 0.609624147f},
-std::array<float,2>{0.183988899f, 0.487534821f},
-std::array<float,2>{0.800394475f, 0.289685279f},
-std::array<float,2>{0.121511795f, 0.702943027f},
-std::array<float,2>{0.528136194f, 0.85439378f},
-std::array<float,2>{0.273147076f, 0.0692580417f},
-std::array<float,2>{0.63213855f, 0.338704288f},
-std::array<float,2>{0.417832166f, 0.632006109f},
-std::array<float,2>{0.895018697f, 0.802228332f},
-std::array<float,2>{0.210548267f, 0.0376497693f},
-std::array<float,2>{0.855608046f, 0.230354473f},
-std::array<float,2>{0.0128077855f, 0.922250092f},
-std::array<float,2>{0.582172871f, 0.552505493f},
-std::array<float,2>{0.373834431f, 0.41946426f},
-std::array<float,2>{0.555249274f, 0.0999844968f},
-std::array<float,2>{0.299440116f, 0.828528166f},
-std::array<float,2>{0.768788755f, 0.724688768f},
-std::array<float,2>{0.0790243819f, 0.273566216f},
-std::array<float,2>{0.97732538f, 0.461796761f},
-std::array<float,2>{0.144272581f, 0.591760516f},
-std::array<float,2>{0.748849332f, 0.967052817f},
-std::array<float,2>{0.49731949f, 0.131439686f},
-std::array<float,2>{0.65653652f, 0.407835007f},
-std::array<float,2>{0.384854287f, 0.556424856f},
-std::array<float,2>{0.918643475f, 0.937209189f},
-std::array<float,2>{0.235379741f, 0.224361256f},
-std::array<float,2>{0.839937329f, 0.0447452404f},
-std::array<float,2>{0.0391320959f, 0.811347783f},
-std::array<float,2>{0.619375169f, 0.639064193f},
-std::array<float,2>{0.343073219f, 0.334611475f},
-std::array<float,2>{0.515728891f, 0.133952618f},
-std::array<float,2>{0.280223489f, 0.958038628f},
-std::array<float,2>{0.809329093f, 0.578776658f},
-std::array<float,2>{0.116707698f, 0.454396546f},
-std::array<float,2>{0.961791694f, 0.269475728f},
-std::array<float,2>{0.172492683f, 0.728235304f},
-std::array<float,2>{0.712475836f, 0.842315435f},
-std::array<float,2>{0.43864426f, 0.102219187f},
-std::array<float,2>{0.590304911f, 0.35200724f},
-std::array<float,2>{0.360102266f, 0.663778782f},
-std::array<float,2>{0.845307112f, 0.77754426f},
-std::array<float,2>{0.0040640221f, 0.025486365f},
-std::array<float,2>{0.904636323f, 0.205113262f},
-std::array<float,2>{0.215025201f, 0.880741f},
-std::array<float,2>{0.640174925f, 0.52654171f},
-std::array<float,2>{0.410038978f, 0.392217904f},
-std::array<float,2>{0.739717841f, 0.075614363f},
-std::array<float,2>{0.485696137f, 0.849475026f},
-std::array<float,2>{0.969612122f, 0.688419044f},
-std::array<float,2>{0.151148379f, 0.281491369f},
-std::array<float,2>{0.777774453f, 0.497207969f},
-std::array<float,2>{0.0910171196f, 0.618952453f},
-std::array<float,2>{0.553317904f, 0.974501193f},
-std::array<float,2>{0.30919677f, 0.169981122f},
-std::array<float,2>{0.545716941f, 0.443555683f},
-std::array<float,2>{0.296615839f, 0.575208604f},
-std::array<float,2>{0.759641469f, 0.942305923f},
-std::array<float,2>{0.065836139f, 0.144515038f},
-std::array<float,2>{0.997054219f, 0.123622112f},
-std::array<float,2>{0.139189169f, 0.819704294f},
-std::array<float,2>{0.733539879f, 0.749306381f},
-std::array<float,2>{0.479094028f, 0.264953971f},
-std::array<float,2>{0.648640692f, 0.241803125f},
-std::array<float,2>{0.425727576f, 0.907998979f},
-std::array<float,2>{0.879283428f, 0.532139003f},
-std::array<float,2>{0.200672492f, 0.426107377f},
-std::array<float,2>{0.860400736f, 0.327333152f},
-std::array<float,2>{0.0209984444f, 0.653207183f},
-std::array<float,2>{0.575604856f, 0.794255793f},
-std::array<float,2>{0.349289626f, 0.0622024424f},
-std::array<float,2>{0.696949124f, 0.306058854f},
-std::array<float,2>{0.463650912f, 0.708249152f},
-std::array<float,2>{0.944196224f, 0.865695238f},
-std::array<float,2>{0.167980358f, 0.0867266059f},
-std::array<float,2>{0.784791827f, 0.172939703f},
-std::array<float,2>{0.106136635f, 0.98724705f},
-std::array<float,2>{0.51503402f, 0.608209431f},
-std::array<float,2>{0.253529698f, 0.475338519f},
-std::array<float,2>{0.608582675f, 0.0103645884f},
-std::array<float,2>{0.320463687f, 0.762404501f},
-std::array<float,2>{0.822701991f, 0.674343765f},
-std::array<float,2>{0.0593476631f, 0.360225886f},
-std::array<float,2>{0.929850817f, 0.378243268f},
-std::array<float,2>{0.231166959f, 0.50470376f},
-std::array<float,2>{0.676762044f, 0.898753405f},
-std::array<float,2>{0.403749287f, 0.201771379f},
-std::array<float,2>{0.717398405f, 0.383312136f},
-std::array<float,2>{0.443128735f, 0.510170519f},
-std::array<float,2>{0.965238094f, 0.891001463f},
-std::array<float,2>{0.175944224f, 0.191422328f},
-std::array<float,2>{0.807141125f, 0.00493110344f},
-std::array<float,2>{0.11003942f, 0.755415857f},
-std::array<float,2>{0.521252096f, 0.680145681f},
-std::array<float,2>{0.275886416f, 0.370382458f},
-std::array<float,2>{0.624505281f, 0.182321578f},
-std::array<float,2>{0.336464316f, 0.998467147f},
-std::array<float,2>{0.838398039f, 0.596171081f},
-std::array<float,2>{0.0449119546f, 0.483335167f},
-std::array<float,2>{0.915780306f, 0.302553833f},
-std::array<float,2>{0.241002887f, 0.716101646f},
-std::array<float,2>{0.663926363f, 0.872196674f},
-std::array<float,2>{0.387672335f, 0.0810074061f},
-std::array<float,2>{0.548435509f, 0.31978631f},
-std::array<float,2>{0.305583596f, 0.644837618f},
-std::array<float,2>{0.775756419f, 0.785912037f},
-std::array<float,2>{0.0865078941f, 0.0521805957f},
-std::array<float,2>{0.972951353f, 0.244295791f},
-std::array<float,2>{0.152616009f, 0.920671403f},
-std::array<float,2>{0.734714985f, 0.542937219f},
-std::array<float,2>{0.490828961f, 0.430882871f},
-std::array<float,2>{0.632980585f, 0.109995149f},
-std::array<float,2>{0.413205326f, 0.82249558f},
-std::array<float,2>{0.898625672f, 0.738408089f},
-std::array<float,2>{0.211682022f, 0.257149011f},
-std::array<float,2>{0.849073231f, 0.452931494f},
-std::array<float,2>{0.0025648647f, 0.569431543f},
-std::array<float,2>{0.586158156f, 0.945509791f},
-std::array<float,2>{0.364810765f, 0.151581004f},
-std::array<float,2>{0.572074533f, 0.489543796f},
-std::array<float,2>{0.347632945f, 0.613928616f},
-std::array<float,2>{0.865253389f, 0.982801437f},
-std::array<float,2>{0.0159463007f, 0.163239643f},
-std::array<float,2>{0.876547098f, 0.0638888925f},
-std::array<float,2>{0.198250413f, 0.858071029f},
-std::array<float,2>{0.654842138f, 0.69621861f},
-std::array<float,2>{0.429475784f, 0.296762615f},
-std::array<float,2>{0.730162382f, 0.218131855f},
-std::array<float,2>{0.481818348f, 0.890596271f},
-std::array<float,2>{0.994028986f, 0.517159224f},
-std::array<float,2>{0.133467093f, 0.399397999f},
-std::array<float,2>{0.763464332f, 0.348157555f},
-std::array<float,2>{0.0666721314f, 0.665500104f},
-std::array<float,2>{0.539483011f, 0.768500745f},
-std::array<float,2>{0.291422993f, 0.0224426966f},
-std::array<float,2>{0.675529242f, 0.278076857f},
-std::array<float,2>{0.401531726f, 0.719137251f},
-std::array<float,2>{0.937073708f, 0.834802508f},
-std::array<float,2>{0.228054047f, 0.0937979668f},
-std::array<float,2>{0.827888191f, 0.127112985f},
-std::array<float,2>{0.0551664606f, 0.964574337f},
-std::array<float,2>{0.601583123f, 0.589346886f},
-std::array<float,2>{0.324530721f, 0.467153639f},
-std::array<float,2>{0.510523856f, 0.0339806229f},
-std::array<float,2>{0.255222499f, 0.797192931f},
-std::array<float,2>{0.78572017f, 0.627236426f},
-std::array<float,2>{0.102317207f, 0.34229815f},
-std::array<float,2>{0.941293716f, 0.41760087f},
-std::array<float,2>{0.167195529f, 0.549397767f},
-std::array<float,2>{0.701035559f, 0.926816404f},
-std::array<float,2>{0.465603471f, 0.231458679f},
-std::array<float,2>{0.648287773f, 0.460859776f},
-std::array<float,2>{0.433548987f, 0.584613562f},
-std::array<float,2>{0.887337923f, 0.955345988f},
-std::array<float,2>{0.194820032f, 0.137206763f},
-std::array<float,2>{0.868728161f, 0.108904518f},
-std::array<float,2>{0.0311668627f, 0.837059677f},
-std::array<float,2>{0.568059862f, 0.73195076f},
-std::array<float,2>{0.351890951f, 0.272678941f},
-std::array<float,2>{0.536246657f, 0.219147071f},
-std::array<float,2>{0.28553009f, 0.929910779f},
-std::array<float,2>{0.756429791f, 0.561709166f},
-std::array<float,2>{0.0779983625f, 0.413232654f},
-std::array<float,2>{0.989743412f, 0.331724524f},
-std::array<float,2>{0.126093492f, 0.633719742f},
-std::array<float,2>{0.721050739f, 0.80509764f},
-std::array<float,2>{0.475308836f, 0.0428469963f},
-std::array<float,2>{0.595977843f, 0.287099063f},
-std::array<float,2>{0.313893855f, 0.694205284f},
-std::array<float,2>{0.819716454f, 0.846198857f},
-std::array<float,2>{0.0521012507f, 0.0704782978f},
-std::array<float,2>{0.927729964f, 0.164694801f},
-std::array<float,2>{0.224501327f, 0.970716655f},
-std::array<float,2>{0.684119463f, 0.623762548f},
-std::array<float,2>{0.391553104f, 0.494624436f},
-std::array<float,2>{0.694023192f, 0.0309215654f},
-std::array<float,2>{0.459131151f, 0.776195347f},
-std::array<float,2>{0.94664216f, 0.659568548f},
-std::array<float,2>{0.158211902f, 0.357019275f},
-std::array<float,2>{0.79230994f, 0.397860348f},
-std::array<float,2>{0.100326359f, 0.529473782f},
-std::array<float,2>{0.502633095f, 0.875044644f},
-std::array<float,2>{0.263833731f, 0.209437281f},
-std::array<float,2>{0.525483251f, 0.423825771f},
-std::array<float,2>{0.26930362f, 0.538126409f},
-std::array<float,2>{0.804323018f, 0.91215682f},
-std::array<float,2>{0.11951644f, 0.238067448f},
-std::array<float,2>{0.958523393f, 0.0573773272f},
-std::array<float,2>{0.180860415f, 0.791365623f},
-std::array<float,2>{0.703799605f, 0.64988178f},
-std::array<float,2>{0.445541084f, 0.323772341f},
-std::array<float,2>{0.669354737f, 0.145936072f},
-std::array<float,2>{0.376695096f, 0.937600076f},
-std::array<float,2>{0.907267153f, 0.571309984f},
-std::array<float,2>{0.243654892f, 0.439966261f},
-std::array<float,2>{0.834438741f, 0.260565579f},
-std::array<float,2>{0.0365083627f, 0.744637728f},
-std::array<float,2>{0.614594698f, 0.815540552f},
-std::array<float,2>{0.330153614f, 0.117679611f},
-std::array<float,2>{0.746077061f, 0.364023775f},
-std::array<float,2>{0.495079249f, 0.678387344f},
-std::array<float,2>{0.984147966f, 0.758271873f},
-std::array<float,2>{0.148219764f, 0.0153449932f},
-std::array<float,2>{0.77161181f, 0.196750879f},
-std::array<float,2>{0.084523797f, 0.906058908f},
-std::array<float,2>{0.559667706f, 0.502821624f},
-std::array<float,2>{0.301632673f, 0.381759256f},
-std::array<float,2>{0.57938534f, 0.093554467f},
-std::array<float,2>{0.368083477f, 0.859723926f},
-std::array<float,2>{0.851958871f, 0.703855932f},
-std::array<float,2>{0.00930702221f, 0.309043258f},
-std::array<float,2>{0.89181f, 0.471543044f},
-std::array<float,2>{0.206623882f, 0.60453546f},
-std::array<float,2>{0.62650919f, 0.990181327f},
-std::array<float,2>{0.420830369f, 0.178631499f},
-std::array<float,2>{0.716189981f, 0.483000815f},
-std::array<float,2>{0.445259243f, 0.595762968f},
-std::array<float,2>{0.967280865f, 0.998074055f},
-std::array<float,2>{0.17792666f, 0.182464361f},
-std::array<float,2>{0.805093408f, 0.0807199702f},
-std::array<float,2>{0.112898938f, 0.872469008f},
-std::array<float,2>{0.522128761f, 0.715951562f},
-std::array<float,2>{0.27410531f, 0.302455038f},
-std::array<float,2>{0.621542752f, 0.191815302f},
-std::array<float,2>{0.3392362f, 0.890727878f},
-std::array<float,2>{0.836430371f, 0.509802699f},
-std::array<float,2>{0.0468506031f, 0.383707374f},
-std::array<float,2>{0.917960703f, 0.370174795f},
-std::array<float,2>{0.23884593f, 0.679720938f},
-std::array<float,2>{0.660212755f, 0.755843163f},
-std::array<float,2>{0.390298814f, 0.00520571228f},
-std::array<float,2>{0.550020635f, 0.25703761f},
-std::array<float,2>{0.307462901f, 0.738618433f},
-std::array<float,2>{0.774234176f, 0.822619617f},
-std::array<float,2>{0.0888887793f, 0.110110462f},
-std::array<float,2>{0.975510716f, 0.151692256f},
-std::array<float,2>{0.15468131f, 0.94577837f},
-std::array<float,2>{0.737849832f, 0.569776833f},
-std::array<float,2>{0.488928169f, 0.452877909f},
-std::array<float,2>{0.635250509f, 0.0517579615f},
-std::array<float,2>{0.411956131f, 0.785672307f},
-std::array<float,2>{0.90058738f, 0.644733429f},
-std::array<float,2>{0.214703202f, 0.319533616f},
-std::array<float,2>{0.850202024f, 0.431130439f},
-std::array<float,2>{0.000327263551f, 0.542585254f},
-std::array<float,2>{0.589243293f, 0.920532942f},
-std::array<float,2>{0.365978062f, 0.244512588f},
-std::array<float,2>{0.573390007f, 0.399026006f},
-std::array<float,2>{0.345047623f, 0.517523587f},
-std::array<float,2>{0.864916205f, 0.890193045f},
-std::array<float,2>{0.0176184177f, 0.217810348f},
-std::array<float,2>{0.877110779f, 0.0220626332f},
-std::array<float,2>{0.197260678f, 0.76817286f},
-std::array<float,2>{0.653735399f, 0.665270865f},
-std::array<float,2>{0.426240355f, 0.348428577f},
-std::array<float,2>{0.727754235f, 0.163445964f},
-std::array<float,2>{0.483137012f, 0.98259002f},
-std::array<float,2>{0.996078849f, 0.614214957f},
-std::array<float,2>{0.13560766f, 0.48948589f},
-std::array<float,2>{0.764264405f, 0.296551228f},
-std::array<float,2>{0.0691263005f, 0.695971847f},
-std::array<float,2>{0.542547524f, 0.858196914f},
-std::array<float,2>{0.290435851f, 0.0636541918f},
-std::array<float,2>{0.673660934f, 0.342557937f},
-std::array<float,2>{0.399230748f, 0.627048075f},
-std::array<float,2>{0.935368836f, 0.796972454f},
-std::array<float,2>{0.229086608f, 0.033839833f},
-std::array<float,2>{0.824895501f, 0.231932789f},
-std::array<float,2>{0.057976041f, 0.927148938f},
-std::array<float,2>{0.603648424f, 0.549667656f},
-std::array<float,2>{0.327079356f, 0.417845041f},
-std::array<float,2>{0.509197474f, 0.0942212492f},
-std::array<float,2>{0.257526249f, 0.834594965f},
-std::array<float,2>{0.78857851f, 0.718891025f},
-std::array<float,2>{0.10531798f, 0.278066009f},
-std::array<float,2>{0.938020289f, 0.466936141f},
-std::array<float,2>{0.165279314f, 0.589002907f},
-std::array<float,2>{0.702429235f, 0.964715183f},
-std::array<float,2>{0.46725142f, 0.127395794f},
-std::array<float,2>{0.645862877f, 0.413435996f},
-std::array<float,2>{0.430279404f, 0.561912239f},
-std::array<float,2>{0.889819682f, 0.930155337f},
-std::array<float,2>{0.192939907f, 0.218934387f},
-std::array<float,2>{0.869526386f, 0.042717386f},
-std::array<float,2>{0.0283709019f, 0.804910541f},
-std::array<float,2>{0.569389999f, 0.633503973f},
-std::array<float,2>{0.354750872f, 0.331909388f},
-std::array<float,2>{0.537914932f, 0.136866629f},
-std::array<float,2>{0.288738281f, 0.955134928f},
-std::array<float,2>{0.755396128f, 0.58491683f},
-std::array<float,2>{0.0755856037f, 0.460571766f},
-std::array<float,2>{0.990409553f, 0.27278924f},
-std::array<float,2>{0.128045335f, 0.732333243f},
-std::array<float,2>{0.718989134f, 0.837356091f},
-std::array<float,2>{0.472848266f, 0.1092778f},
-std::array<float,2>{0.594679654f, 0.357338578f},
-std::array<float,2>{0.314469606f, 0.659264803f},
-std::array<float,2>{0.817265749f, 0.775906503f},
-std::array<float,2>{0.0537220351f, 0.0311647188f},
-std::array<float,2>{0.928675473f, 0.209223837f},
-std::array<float,2>{0.225881711f, 0.875351429f},
-std::array<float,2>{0.687276721f, 0.529705107f},
-std::array<float,2>{0.393229038f, 0.397618264f},
-std::array<float,2>{0.693209946f, 0.070789583f},
-std::array<float,2>{0.457120597f, 0.846610785f},
-std::array<float,2>{0.948828518f, 0.693862796f},
-std::array<float,2>{0.157316104f, 0.286735207f},
-std::array<float,2>{0.789349914f, 0.494240731f},
-std::array<float,2>{0.0994297042f, 0.623870492f},
-std::array<float,2>{0.501840234f, 0.97108078f},
-std::array<float,2>{0.262858897f, 0.165034994f},
-std::array<float,2>{0.524628222f, 0.440237105f},
-std::array<float,2>{0.267017931f, 0.571663976f},
-std::array<float,2>{0.802537978f, 0.937988281f},
-std::array<float,2>{0.118026644f, 0.145571545f},
-std::array<float,2>{0.960652947f, 0.118101813f},
-std::array<float,2>{0.182197809f, 0.815912247f},
-std::array<float,2>{0.705547452f, 0.745011926f},
-std::array<float,2>{0.448893696f, 0.260357827f},
-std::array<float,2>{0.671163261f, 0.237843394f},
-std::array<float,2>{0.377689987f, 0.912588894f},
-std::array<float,2>{0.909536719f, 0.538479507f},
-std::array<float,2>{0.244378358f, 0.423484683f},
-std::array<float,2>{0.83390224f, 0.323980689f},
-std::array<float,2>{0.0387112945f, 0.649609149f},
-std::array<float,2>{0.615901947f, 0.791146219f},
-std::array<float,2>{0.329632878f, 0.0573692396f},
-std::array<float,2>{0.742620051f, 0.30882585f},
-std::array<float,2>{0.492728353f, 0.703974485f},
-std::array<float,2>{0.981584072f, 0.859583795f},
-std::array<float,2>{0.145105258f, 0.0932981968f},
-std::array<float,2>{0.769755304f, 0.178459212f},
-std::array<float,2>{0.0826606378f, 0.989799678f},
-std::array<float,2>{0.562451661f, 0.60489732f},
-std::array<float,2>{0.304130703f, 0.471349567f},
-std::array<float,2>{0.581225157f, 0.0155938286f},
-std::array<float,2>{0.370661408f, 0.757953465f},
-std::array<float,2>{0.853597045f, 0.67859453f},
-std::array<float,2>{0.0113868937f, 0.363900334f},
-std::array<float,2>{0.893548548f, 0.381561905f},
-std::array<float,2>{0.203665107f, 0.502517343f},
-std::array<float,2>{0.626974225f, 0.905907691f},
-std::array<float,2>{0.419554651f, 0.196290001f},
-std::array<float,2>{0.72644943f, 0.390460134f},
-std::array<float,2>{0.472481012f, 0.513051987f},
-std::array<float,2>{0.988065422f, 0.896111012f},
-std::array<float,2>{0.130979434f, 0.189283088f},
-std::array<float,2>{0.750578761f, 0.00155706319f},
-std::array<float,2>{0.0731696486f, 0.753337622f},
-std::array<float,2>{0.534553289f, 0.684878528f},
-std::array<float,2>{0.283959448f, 0.372644454f},
-std::array<float,2>{0.565549254f, 0.186874583f},
-std::array<float,2>{0.357658833f, 0.994499087f},
-std::array<float,2>{0.87435931f, 0.597852945f},
-std::array<float,2>{0.0235170294f, 0.478241622f},
-std::array<float,2>{0.884021044f, 0.299799025f},
-std::array<float,2>{0.191405326f, 0.714393437f},
-std::array<float,2>{0.642320693f, 0.870354116f},
-std::array<float,2>{0.437434971f, 0.083897084f},
-std::array<float,2>{0.507665575f, 0.312936276f},
-std::array<float,2>{0.260318458f, 0.643989265f},
-std::array<float,2>{0.793607891f, 0.783521891f},
-std::array<float,2>{0.0953384489f, 0.0495295264f},
-std::array<float,2>{0.95270443f, 0.249565184f},
-std::array<float,2>{0.164013803f, 0.916452467f},
-std::array<float,2>{0.688215137f, 0.546671808f},
-std::array<float,2>{0.45413509f, 0.437175035f},
-std::array<float,2>{0.681943893f, 0.114164673f},
-std::array<float,2>{0.396745205f, 0.825059295f},
-std::array<float,2>{0.923733711f, 0.736146331f},
-std::array<float,2>{0.222147718f, 0.250594795f},
-std::array<float,2>{0.813980937f, 0.447574794f},
-std::array<float,2>{0.0497774519f, 0.565443933f},
-std::array<float,2>{0.600788176f, 0.952606797f},
-std::array<float,2>{0.319756001f, 0.154521346f},
-std::array<float,2>{0.611840069f, 0.487725407f},
-std::array<float,2>{0.3340801f, 0.609453678f},
-std::array<float,2>{0.829181254f, 0.979344964f},
-std::array<float,2>{0.0322800204f, 0.15809229f},
-std::array<float,2>{0.911404908f, 0.0688758641f},
-std::array<float,2>{0.247729853f, 0.854015768f},
-std::array<float,2>{0.664546371f, 0.702687681f},
-std::array<float,2>{0.381401092f, 0.289837897f},
-std::array<float,2>{0.709906995f, 0.212220177f},
-std::array<float,2>{0.451466531f, 0.885855138f},
-std::array<float,2>{0.95457983f, 0.521573901f},
-std::array<float,2>{0.187433556f, 0.404622138f},
-std::array<float,2>{0.797354698f, 0.347528845f},
-std::array<float,2>{0.123191908f, 0.669604421f},
-std::array<float,2>{0.530485332f, 0.769781947f},
-std::array<float,2>{0.271208793f, 0.0171529278f},
-std::array<float,2>{0.630088985f, 0.273854405f},
-std::array<float,2>{0.416005254f, 0.725075305f},
-std::array<float,2>{0.897854388f, 0.828152061f},
-std::array<float,2>{0.20787482f, 0.0998507366f},
-std::array<float,2>{0.859178543f, 0.131701469f},
-std::array<float,2>{0.0155380163f, 0.966817856f},
-std::array<float,2>{0.585382223f, 0.591448009f},
-std::array<float,2>{0.372476041f, 0.461530566f},
-std::array<float,2>{0.557579815f, 0.0378422402f},
-std::array<float,2>{0.297489256f, 0.801862121f},
-std::array<float,2>{0.765834332f, 0.632108688f},
-std::array<float,2>{0.0803931803f, 0.33847028f},
-std::array<float,2>{0.978554845f, 0.419914663f},
-std::array<float,2>{0.140908256f, 0.552279472f},
-std::array<float,2>{0.747312903f, 0.921947896f},
-std::array<float,2>{0.499273777f, 0.230104744f},
-std::array<float,2>{0.658486784f, 0.454120398f},
-std::array<float,2>{0.383359551f, 0.578859329f},
-std::array<float,2>{0.921278119f, 0.958377361f},
-std::array<float,2>{0.238266468f, 0.134070992f},
-std::array<float,2>{0.843715191f, 0.102438368f},
-std::array<float,2>{0.0414883979f, 0.842574239f},
-std::array<float,2>{0.618283331f, 0.728310466f},
-std::array<float,2>{0.340121806f, 0.269132286f},
-std::array<float,2>{0.519355774f, 0.224374592f},
-std::array<float,2>{0.278888196f, 0.937496364f},
-std::array<float,2>{0.812182248f, 0.556317747f},
-std::array<float,2>{0.114404194f, 0.408142596f},
-std::array<float,2>{0.964641213f, 0.334794044f},
-std::array<float,2>{0.173936442f, 0.638704777f},
-std::array<float,2>{0.713281214f, 0.811071098f},
-std::array<float,2>{0.43998763f, 0.0444480665f},
-std::array<float,2>{0.591809392f, 0.281520873f},
-std::array<float,2>{0.362942308f, 0.68799752f},
-std::array<float,2>{0.846272469f, 0.849254012f},
-std::array<float,2>{0.00760936877f, 0.075219065f},
-std::array<float,2>{0.904199302f, 0.170267582f},
-std::array<float,2>{0.21782355f, 0.974316239f},
-std::array<float,2>{0.638511956f, 0.618708909f},
-std::array<float,2>{0.407990813f, 0.497379243f},
-std::array<float,2>{0.742153704f, 0.0258681513f},
-std::array<float,2>{0.487644166f, 0.777789652f},
-std::array<float,2>{0.971138f, 0.663902819f},
-std::array<float,2>{0.15006189f, 0.351616889f},
-std::array<float,2>{0.780004144f, 0.392479062f},
-std::array<float,2>{0.0931520686f, 0.52663976f},
-std::array<float,2>{0.55260247f, 0.880378067f},
-std::array<float,2>{0.311139792f, 0.205341458f},
-std::array<float,2>{0.543998778f, 0.42592442f},
-std::array<float,2>{0.294538587f, 0.53192842f},
-std::array<float,2>{0.76025176f, 0.907817721f},
-std::array<float,2>{0.0627255663f, 0.241951242f},
-std::array<float,2>{0.999613941f, 0.0624368079f},
-std::array<float,2>{0.137329206f, 0.79410857f},
-std::array<float,2>{0.732391834f, 0.652964592f},
-std::array<float,2>{0.477595776f, 0.327469438f},
-std::array<float,2>{0.650917709f, 0.144236416f},
-std::array<float,2>{0.422277302f, 0.941967428f},
-std::array<float,2>{0.88131541f, 0.575539231f},
-std::array<float,2>{0.20239009f, 0.443667561f},
-std::array<float,2>{0.863029301f, 0.264659792f},
-std::array<float,2>{0.0228237528f, 0.749033689f},
-std::array<float,2>{0.576892316f, 0.819485426f},
-std::array<float,2>{0.351458639f, 0.123940952f},
-std::array<float,2>{0.699209332f, 0.359951049f},
-std::array<float,2>{0.462072611f, 0.674685717f},
-std::array<float,2>{0.943257451f, 0.762545049f},
-std::array<float,2>{0.170767009f, 0.0105633829f},
-std::array<float,2>{0.782243609f, 0.202079147f},
-std::array<float,2>{0.108288795f, 0.898673117f},
-std::array<float,2>{0.513523877f, 0.504549503f},
-std::array<float,2>{0.251819253f, 0.378058523f},
-std::array<float,2>{0.606334865f, 0.086659424f},
-std::array<float,2>{0.323808163f, 0.865329444f},
-std::array<float,2>{0.820969701f, 0.708441675f},
-std::array<float,2>{0.0610114336f, 0.305758476f},
-std::array<float,2>{0.932679653f, 0.47540471f},
-std::array<float,2>{0.233910784f, 0.608119249f},
-std::array<float,2>{0.678191304f, 0.98687911f},
-std::array<float,2>{0.406203359f, 0.17332229f},
-std::array<float,2>{0.735864997f, 0.449715674f},
-std::array<float,2>{0.491759181f, 0.566446364f},
-std::array<float,2>{0.974161446f, 0.949043095f},
-std::array<float,2>{0.154196888f, 0.149718061f},
-std::array<float,2>{0.776809275f, 0.111556187f},
-std::array<float,2>{0.0876286626f, 0.821595609f},
-std::array<float,2>{0.547200382f, 0.741756082f},
-std::array<float,2>{0.306623548f, 0.253909498f},
-std::array<float,2>{0.587004662f, 0.244083703f},
-std::array<float,2>{0.364063144f, 0.919175684f},
-std::array<float,2>{0.848238885f, 0.539440453f},
-std::array<float,2>{0.00351833017f, 0.431864023f},
-std::array<float,2>{0.899488449f, 0.317487538f},
-std::array<float,2>{0.212458581f, 0.647720814f},
-std::array<float,2>{0.63431251f, 0.788811505f},
-std::array<float,2>{0.412715584f, 0.053288497f},
-std::array<float,2>{0.520233274f, 0.303929538f},
-std::array<float,2>{0.276745945f, 0.717919409f},
-std::array<float,2>{0.808365822f, 0.87453711f},
-std::array<float,2>{0.111261629f, 0.0798580125f},
-std::array<float,2>{0.966197133f, 0.180050835f},
-std::array<float,2>{0.177174687f, 0.996112049f},
-std::array<float,2>{0.71821177f, 0.595068693f},
-std::array<float,2>{0.44183439f, 0.480900019f},
-std::array<float,2>{0.662384391f, 0.00615785178f},
-std::array<float,2>{0.388019472f, 0.757276356f},
-std::array<float,2>{0.91414386f, 0.683310628f},
-std::array<float,2>{0.24139227f, 0.367262244f},
-std::array<float,2>{0.839477897f, 0.385486424f},
-std::array<float,2>{0.0432972237f, 0.508959413f},
-std::array<float,2>{0.623852074f, 0.894231319f},
-std::array<float,2>{0.337359518f, 0.195157066f},
-std::array<float,2>{0.603408813f, 0.414126515f},
-std::array<float,2>{0.32569623f, 0.547108829f},
-std::array<float,2>{0.82686466f, 0.929008961f},
-std::array<float,2>{0.0565484352f, 0.234244108f},
-std::array<float,2>{0.936258316f, 0.0329931378f},
-std::array<float,2>{0.227020055f, 0.800090015f},
-std::array<float,2>{0.674196482f, 0.626924872f},
-std::array<float,2>{0.401051193f, 0.340994269f},
-std::array<float,2>{0.699503481f, 0.12567158f},
-std::array<float,2>{0.46629259f, 0.962591708f},
-std::array<float,2>{0.93967402f, 0.586033523f},
-std::array<float,2>{0.166028783f, 0.465935618f},
-std::array<float,2>{0.786585808f, 0.279333174f},
-std::array<float,2>{0.102578923f, 0.722132683f},
-std::array<float,2>{0.510999024f, 0.833729446f},
-std::array<float,2>{0.254534304f, 0.0968311727f},
-std::array<float,2>{0.655703902f, 0.350650609f},
-std::array<float,2>{0.42856583f, 0.667794287f},
-std::array<float,2>{0.875595152f, 0.766463697f},
-std::array<float,2>{0.197678089f, 0.0201692302f},
-std::array<float,2>{0.866925657f, 0.215271771f},
-std::array<float,2>{0.0166638624f, 0.887707829f},
-std::array<float,2>{0.570698619f, 0.518072367f},
-std::array<float,2>{0.345901906f, 0.402155161f},
-std::array<float,2>{0.540582895f, 0.0646808594f},
-std::array<float,2>{0.29218623f, 0.856308043f},
-std::array<float,2>{0.762122929f, 0.69873333f},
-std::array<float,2>{0.0673998222f, 0.294578493f},
-std::array<float,2>{0.992667973f, 0.491283238f},
-std::array<float,2>{0.134169281f, 0.615287602f},
-std::array<float,2>{0.729412198f, 0.980931699f},
-std::array<float,2>{0.480748385f, 0.161834762f},
-std::array<float,2>{0.684987962f, 0.396050543f},
-std::array<float,2>{0.39171204f, 0.52761364f},
-std::array<float,2>{0.926446021f, 0.878025353f},
-std::array<float,2>{0.222862974f, 0.207138821f},
-std::array<float,2>{0.818867564f, 0.0280616954f},
-std::array<float,2>{0.0512495786f, 0.775322855f},
-std::array<float,2>{0.597433448f, 0.656943321f},
-std::array<float,2>{0.312785f, 0.3586092f},
-std::array<float,2>{0.503652751f, 0.166174605f},
-std::array<float,2>{0.265356839f, 0.969718277f},
-std::array<float,2>{0.791716874f, 0.622705638f},
-std::array<float,2>{0.101271085f, 0.493585318f},
-std::array<float,2>{0.945846558f, 0.287891924f},
-std::array<float,2>{0.159925759f, 0.691832662f},
-std::array<float,2>{0.69495064f, 0.84500891f},
-std::array<float,2>{0.46079877f, 0.0729637071f},
-std::array<float,2>{0.567060411f, 0.329649627f},
-std::array<float,2>{0.352713615f, 0.634931445f},
-std::array<float,2>{0.867909491f, 0.808445871f},
-std::array<float,2>{0.0296010301f, 0.0403234772f},
-std::array<float,2>{0.888243496f, 0.220803738f},
-std::array<float,2>{0.193859741f, 0.931784034f},
-std::array<float,2>{0.646705747f, 0.558796883f},
-std::array<float,2>{0.432219893f, 0.411043018f},
-std::array<float,2>{0.72208482f, 0.105516106f},
-std::array<float,2>{0.476558328f, 0.838634312f},
-std::array<float,2>{0.988437533f, 0.733104944f},
-std::array<float,2>{0.125438005f, 0.271258324f},
-std::array<float,2>{0.757384896f, 0.457444727f},
-std::array<float,2>{0.0765207857f, 0.58294332f},
-std::array<float,2>{0.536097825f, 0.954533279f},
-std::array<float,2>{0.286495149f, 0.140531495f},
-std::array<float,2>{0.559097826f, 0.469769776f},
-std::array<float,2>{0.302047431f, 0.6028741f},
-std::array<float,2>{0.773164988f, 0.990843177f},
-std::array<float,2>{0.0855850354f, 0.177699074f},
-std::array<float,2>{0.983231962f, 0.0908596963f},
-std::array<float,2>{0.147182748f, 0.861652672f},
-std::array<float,2>{0.744425237f, 0.706022799f},
-std::array<float,2>{0.495645732f, 0.311275035f},
-std::array<float,2>{0.62519753f, 0.198815525f},
-std::array<float,2>{0.421522051f, 0.903701842f},
-std::array<float,2>{0.890889406f, 0.501530588f},
-std::array<float,2>{0.20514755f, 0.38008371f},
-std::array<float,2>{0.852875888f, 0.366566688f},
-std::array<float,2>{0.00834870804f, 0.677174509f},
-std::array<float,2>{0.578222036f, 0.760294616f},
-std::array<float,2>{0.369020462f, 0.0127431778f},
-std::array<float,2>{0.704650164f, 0.257963628f},
-std::array<float,2>{0.446875572f, 0.742769539f},
-std::array<float,2>{0.957970023f, 0.813289404f},
-std::array<float,2>{0.179870799f, 0.119703583f},
-std::array<float,2>{0.803601384f, 0.146805942f},
-std::array<float,2>{0.12053521f, 0.940747738f},
-std::array<float,2>{0.526590526f, 0.573237419f},
-std::array<float,2>{0.268488646f, 0.43822512f},
-std::array<float,2>{0.613632023f, 0.0548979826f},
-std::array<float,2>{0.331898361f, 0.790247262f},
-std::array<float,2>{0.835504234f, 0.650629818f},
-std::array<float,2>{0.0358133726f, 0.32034719f},
-std::array<float,2>{0.906873763f, 0.424920022f},
-std::array<float,2>{0.242341563f, 0.535234749f},
-std::array<float,2>{0.668421268f, 0.911667228f},
-std::array<float,2>{0.375340521f, 0.236178473f},
-std::array<float,2>{0.690718114f, 0.434799254f},
-std::array<float,2>{0.456864834f, 0.544687569f},
-std::array<float,2>{0.950833678f, 0.915308714f},
-std::array<float,2>{0.161614642f, 0.246385962f},
-std::array<float,2>{0.795094073f, 0.0484676398f},
-std::array<float,2>{0.0964123234f, 0.781296849f},
-std::array<float,2>{0.505289376f, 0.640746415f},
-std::array<float,2>{0.258795768f, 0.314550459f},
-std::array<float,2>{0.598403394f, 0.153654933f},
-std::array<float,2>{0.317826927f, 0.949445307f},
-std::array<float,2>{0.816311479f, 0.564041018f},
-std::array<float,2>{0.04879665f, 0.446197838f},
-std::array<float,2>{0.925154626f, 0.251993686f},
-std::array<float,2>{0.219485298f, 0.736486137f},
-std::array<float,2>{0.680136204f, 0.827428341f},
-std::array<float,2>{0.394916415f, 0.11543154f},
-std::array<float,2>{0.531802714f, 0.374571323f},
-std::array<float,2>{0.282904834f, 0.68632704f},
-std::array<float,2>{0.752236843f, 0.751293063f},
-std::array<float,2>{0.0719020739f, 0.00322727184f},
-std::array<float,2>{0.986083448f, 0.191210583f},
-std::array<float,2>{0.130394354f, 0.897945225f},
-std::array<float,2>{0.72336936f, 0.515028477f},
-std::array<float,2>{0.470234096f, 0.387241155f},
-std::array<float,2>{0.64360404f, 0.085732691f},
-std::array<float,2>{0.435286939f, 0.868517399f},
-std::array<float,2>{0.885885954f, 0.712887764f},
-std::array<float,2>{0.187536418f, 0.298647255f},
-std::array<float,2>{0.87275511f, 0.478995025f},
-std::array<float,2>{0.026137162f, 0.601452708f},
-std::array<float,2>{0.56352514f, 0.992500603f},
-std::array<float,2>{0.356755793f, 0.183665261f},
-std::array<float,2>{0.583955169f, 0.463137746f},
-std::array<float,2>{0.374809742f, 0.592151761f},
-std::array<float,2>{0.856461108f, 0.966750562f},
-std::array<float,2>{0.0120777274f, 0.129691288f},
-std::array<float,2>{0.896148801f, 0.0978702083f},
-std::array<float,2>{0.209253475f, 0.830135822f},
-std::array<float,2>{0.630898654f, 0.723854899f},
-std::array<float,2>{0.416655988f, 0.275880516f},
-std::array<float,2>{0.749172211f, 0.228130013f},
-std::array<float,2>{0.496994257f, 0.924933791f},
-std::array<float,2>{0.97790271f, 0.553165972f},
-std::array<float,2>{0.143469185f, 0.420216858f},
-std::array<float,2>{0.76805371f, 0.337305456f},
-std::array<float,2>{0.0799397305f, 0.629642665f},
-std::array<float,2>{0.556121051f, 0.803235412f},
-std::array<float,2>{0.300333858f, 0.0360277034f},
-std::array<float,2>{0.666560829f, 0.291771263f},
-std::array<float,2>{0.380752146f, 0.69957006f},
-std::array<float,2>{0.913430035f, 0.85315454f},
-std::array<float,2>{0.249718502f, 0.0670079067f},
-std::array<float,2>{0.830498159f, 0.159866184f},
-std::array<float,2>{0.0343960337f, 0.977154195f},
-std::array<float,2>{0.610281706f, 0.612880111f},
-std::array<float,2>{0.332424372f, 0.484591037f},
-std::array<float,2>{0.528344393f, 0.0176026989f},
-std::array<float,2>{0.272152394f, 0.77294606f},
-std::array<float,2>{0.79922241f, 0.67134881f},
-std::array<float,2>{0.122352406f, 0.345563918f},
-std::array<float,2>{0.956688523f, 0.402950794f},
-std::array<float,2>{0.185234979f, 0.520734549f},
-std::array<float,2>{0.707743824f, 0.883150995f},
-std::array<float,2>{0.45114243f, 0.213023022f},
-std::array<float,2>{0.638750374f, 0.499994069f},
-std::array<float,2>{0.409086734f, 0.619538903f},
-std::array<float,2>{0.905720234f, 0.976152539f},
-std::array<float,2>{0.216634065f, 0.168854788f},
-std::array<float,2>{0.844318628f, 0.0773599297f},
-std::array<float,2>{0.00529438118f, 0.849679589f},
-std::array<float,2>{0.591247082f, 0.690756142f},
-std::array<float,2>{0.360831052f, 0.283785552f},
-std::array<float,2>{0.554249883f, 0.204714134f},
-std::array<float,2>{0.310184062f, 0.881678164f},
-std::array<float,2>{0.778477788f, 0.524458766f},
-std::array<float,2>{0.0900958776f, 0.394305199f},
-std::array<float,2>{0.970488012f, 0.354489267f},
-std::array<float,2>{0.152135745f, 0.660929859f},
-std::array<float,2>{0.738553584f, 0.780149996f},
-std::array<float,2>{0.484846324f, 0.025189193f},
-std::array<float,2>{0.620595992f, 0.265828222f},
-std::array<float,2>{0.342628479f, 0.72918278f},
-std::array<float,2>{0.841158509f, 0.84175247f},
-std::array<float,2>{0.0409276858f, 0.105322622f},
-std::array<float,2>{0.919641852f, 0.135799199f},
-std::array<float,2>{0.234698474f, 0.960476458f},
-std::array<float,2>{0.65725112f, 0.581273139f},
-std::array<float,2>{0.386256635f, 0.456571221f},
-std::array<float,2>{0.711135685f, 0.0461713523f},
-std::array<float,2>{0.438418716f, 0.80863744f},
-std::array<float,2>{0.962641001f, 0.638543189f},
-std::array<float,2>{0.17303203f, 0.333111525f},
-std::array<float,2>{0.810245156f, 0.409858853f},
-std::array<float,2>{0.11621093f, 0.558393776f},
-std::array<float,2>{0.517234862f, 0.934120357f},
-std::array<float,2>{0.280694366f, 0.226525858f},
-std::array<float,2>{0.514074624f, 0.375692815f},
-std::array<float,2>{0.252174586f, 0.50671494f},
-std::array<float,2>{0.783663273f, 0.901242852f},
-std::array<float,2>{0.107408263f, 0.199935898f},
-std::array<float,2>{0.944731116f, 0.00831724145f},
-std::array<float,2>{0.169290543f, 0.76519829f},
-std::array<float,2>{0.695527017f, 0.672486365f},
-std::array<float,2>{0.464449316f, 0.361745298f},
-std::array<float,2>{0.676521957f, 0.174233317f},
-std::array<float,2>{0.402876407f, 0.985034287f},
-std::array<float,2>{0.931511819f, 0.605709672f},
-std::array<float,2>{0.23212862f, 0.47441408f},
-std::array<float,2>{0.823596895f, 0.307835609f},
-std::array<float,2>{0.0604732148f, 0.710555434f},
-std::array<float,2>{0.607616484f, 0.86365968f},
-std::array<float,2>{0.321404815f, 0.0897702873f},
-std::array<float,2>{0.73267436f, 0.325790316f},
-std::array<float,2>{0.480166256f, 0.656138122f},
-std::array<float,2>{0.997506499f, 0.795865178f},
-std::array<float,2>{0.14028801f, 0.0591299534f},
-std::array<float,2>{0.758068323f, 0.240148306f},
-std::array<float,2>{0.0650993735f, 0.908919573f},
-std::array<float,2>{0.54650557f, 0.533714831f},
-std::array<float,2>{0.295087755f, 0.429487586f},
-std::array<float,2>{0.574543417f, 0.122473769f},
-std::array<float,2>{0.347888261f, 0.81809932f},
-std::array<float,2>{0.85943985f, 0.747147799f},
-std::array<float,2>{0.0203998052f, 0.261804521f},
-std::array<float,2>{0.88085264f, 0.443190217f},
-std::array<float,2>{0.199287266f, 0.578000069f},
-std::array<float,2>{0.650185168f, 0.943792224f},
-std::array<float,2>{0.424418062f, 0.142501771f},
-std::array<float,2>{0.701984406f, 0.465709984f},
-std::array<float,2>{0.46816662f, 0.587693989f},
-std::array<float,2>{0.939189196f, 0.961877823f},
-std::array<float,2>{0.164953575f, 0.126288399f},
-std::array<float,2>{0.787315488f, 0.0961454734f},
-std::array<float,2>{0.103885978f, 0.832121134f},
-std::array<float,2>{0.507877529f, 0.721593499f},
-std::array<float,2>{0.256786853f, 0.280991197f},
-std::array<float,2>{0.604916871f, 0.232821226f},
-std::array<float,2>{0.327333987f, 0.928418815f},
-std::array<float,2>{0.825467646f, 0.547865093f},
-std::array<float,2>{0.0571889654f, 0.415427983f},
-std::array<float,2>{0.934528828f, 0.340802491f},
-std::array<float,2>{0.229500458f, 0.625655174f},
-std::array<float,2>{0.672283888f, 0.799005389f},
-std::array<float,2>{0.399817675f, 0.0321007296f},
-std::array<float,2>{0.541467011f, 0.29362908f},
-std::array<float,2>{0.289817661f, 0.697392821f},
-std::array<float,2>{0.764983535f, 0.857330918f},
-std::array<float,2>{0.0695486665f, 0.0661400706f},
-std::array<float,2>{0.995042145f, 0.160673589f},
-std::array<float,2>{0.136443183f, 0.981572211f},
-std::array<float,2>{0.726881802f, 0.616297901f},
-std::array<float,2>{0.484097391f, 0.490620434f},
-std::array<float,2>{0.652348578f, 0.0208596494f},
-std::array<float,2>{0.427257448f, 0.767385125f},
-std::array<float,2>{0.878081143f, 0.666792035f},
-std::array<float,2>{0.195732534f, 0.350495666f},
-std::array<float,2>{0.8640365f, 0.400867283f},
-std::array<float,2>{0.0188363623f, 0.519513726f},
-std::array<float,2>{0.572400749f, 0.887503266f},
-std::array<float,2>{0.344439089f, 0.216155201f},
-std::array<float,2>{0.588138998f, 0.433434606f},
-std::array<float,2>{0.366548508f, 0.5402385f},
-std::array<float,2>{0.850594163f, 0.918251455f},
-std::array<float,2>{0.00194270955f, 0.242400736f},
-std::array<float,2>{0.902218938f, 0.0542457141f},
-std::array<float,2>{0.213479802f, 0.788006544f},
-std::array<float,2>{0.635800004f, 0.647118688f},
-std::array<float,2>{0.410537302f, 0.316413879f},
-std::array<float,2>{0.737294674f, 0.149329558f},
-std::array<float,2>{0.489741355f, 0.947990835f},
-std::array<float,2>{0.975661874f, 0.568159461f},
-std::array<float,2>{0.155477583f, 0.450300723f},
-std::array<float,2>{0.774711192f, 0.255510688f},
-std::array<float,2>{0.0881640688f, 0.741206229f},
-std::array<float,2>{0.549241126f, 0.820646644f},
-std::array<float,2>{0.308052152f, 0.113156796f},
-std::array<float,2>{0.661741853f, 0.369125456f},
-std::array<float,2>{0.389533758f, 0.681883156f},
-std::array<float,2>{0.91634351f, 0.756793082f},
-std::array<float,2>{0.240005553f, 0.00694649573f},
-std::array<float,2>{0.837547302f, 0.193571821f},
-std::array<float,2>{0.0455445871f, 0.893450141f},
-std::array<float,2>{0.622650385f, 0.508142054f},
-std::array<float,2>{0.337947458f, 0.38607803f},
-std::array<float,2>{0.523051739f, 0.0782763734f},
-std::array<float,2>{0.274576873f, 0.873717248f},
-std::array<float,2>{0.805933118f, 0.71748817f},
-std::array<float,2>{0.111708447f, 0.30323571f},
-std::array<float,2>{0.968185067f, 0.481452763f},
-std::array<float,2>{0.179096535f, 0.593996525f},
-std::array<float,2>{0.715056956f, 0.997543335f},
-std::array<float,2>{0.443554997f, 0.181457087f},
-std::array<float,2>{0.628739595f, 0.379134148f},
-std::array<float,2>{0.418725252f, 0.500309646f},
-std::array<float,2>{0.894112706f, 0.902857065f},
-std::array<float,2>{0.20430696f, 0.197536454f},
-std::array<float,2>{0.85468781f, 0.01198438f},
-std::array<float,2>{0.0105029661f, 0.761478662f},
-std::array<float,2>{0.580287516f, 0.676198423f},
-std::array<float,2>{0.36946395f, 0.36533466f},
-std::array<float,2>{0.560964108f, 0.175843537f},
-std::array<float,2>{0.303150654f, 0.991660058f},
-std::array<float,2>{0.770773888f, 0.601644754f},
-std::array<float,2>{0.0838018954f, 0.469594359f},
-std::array<float,2>{0.980562091f, 0.312035114f},
-std::array<float,2>{0.146247149f, 0.706419945f},
-std::array<float,2>{0.743731141f, 0.863199294f},
-std::array<float,2>{0.493515581f, 0.0904372931f},
-std::array<float,2>{0.616856217f, 0.32215786f},
-std::array<float,2>{0.328957826f, 0.651821613f},
-std::array<float,2>{0.83272332f, 0.789760232f},
-std::array<float,2>{0.037646886f, 0.0561874844f},
-std::array<float,2>{0.909154117f, 0.234446257f},
-std::array<float,2>{0.24563916f, 0.910218537f},
-std::array<float,2>{0.669934809f, 0.536699235f},
-std::array<float,2>{0.378748775f, 0.424673319f},
-std::array<float,2>{0.706403136f, 0.120907769f},
-std::array<float,2>{0.447943479f, 0.813892186f},
-std::array<float,2>{0.959317267f, 0.74404794f},
-std::array<float,2>{0.183086947f, 0.258853912f},
-std::array<float,2>{0.80147779f, 0.43940556f},
-std::array<float,2>{0.118270554f, 0.573459148f},
-std::array<float,2>{0.524027348f, 0.939636469f},
-std::array<float,2>{0.26566574f, 0.147942364f},
-std::array<float,2>{0.500699043f, 0.493087202f},
-std::array<float,2>{0.261747599f, 0.621327817f},
-std::array<float,2>{0.790943921f, 0.970353305f},
-std::array<float,2>{0.0982091725f, 0.167946234f},
-std::array<float,2>{0.947801828f, 0.0739544779f},
-std::array<float,2>{0.15699853f, 0.844127655f},
-std::array<float,2>{0.692374289f, 0.693334937f},
-std::array<float,2>{0.458299845f, 0.288177252f},
-std::array<float,2>{0.68619138f, 0.208725095f},
-std::array<float,2>{0.393779635f, 0.877286196f},
-std::array<float,2>{0.929400802f, 0.528420389f},
-std::array<float,2>{0.225038514f, 0.394977808f},
-std::array<float,2>{0.818021953f, 0.358359754f},
-std::array<float,2>{0.0534123518f, 0.658040166f},
-std::array<float,2>{0.595117807f, 0.773868978f},
-std::array<float,2>{0.316288769f, 0.0291174613f},
-std::array<float,2>{0.720136821f, 0.26987201f},
-std::array<float,2>{0.473666996f, 0.733856916f},
-std::array<float,2>{0.992148697f, 0.839612722f},
-std::array<float,2>{0.127721593f, 0.106809504f},
-std::array<float,2>{0.754478753f, 0.139448062f},
-std::array<float,2>{0.0742358714f, 0.953982234f},
-std::array<float,2>{0.538296103f, 0.583672941f},
-std::array<float,2>{0.28788054f, 0.45843488f},
-std::array<float,2>{0.568654895f, 0.0396959111f},
-std::array<float,2>{0.354445249f, 0.806673884f},
-std::array<float,2>{0.870179653f, 0.635837555f},
-std::array<float,2>{0.0274237934f, 0.32891199f},
-std::array<float,2>{0.888933122f, 0.411359519f},
-std::array<float,2>{0.192064777f, 0.559602916f},
-std::array<float,2>{0.644883692f, 0.932938397f},
-std::array<float,2>{0.431405008f, 0.222296715f},
-std::array<float,2>{0.746300161f, 0.421026468f},
-std::array<float,2>{0.498319685f, 0.554292858f},
-std::array<float,2>{0.980467677f, 0.92402792f},
-std::array<float,2>{0.14253372f, 0.227480814f},
-std::array<float,2>{0.767150998f, 0.0368011035f},
-std::array<float,2>{0.0818889216f, 0.803923786f},
-std::array<float,2>{0.558140218f, 0.630411863f},
-std::array<float,2>{0.29807508f, 0.336431831f},
-std::array<float,2>{0.584293246f, 0.129906118f},
-std::array<float,2>{0.371901214f, 0.965628743f},
-std::array<float,2>{0.857689023f, 0.592793584f},
-std::array<float,2>{0.0137146898f, 0.464106053f},
-std::array<float,2>{0.897406816f, 0.276449412f},
-std::array<float,2>{0.208969474f, 0.723199606f},
-std::array<float,2>{0.629101038f, 0.831272483f},
-std::array<float,2>{0.414309233f, 0.0987994745f},
-std::array<float,2>{0.529603779f, 0.343984306f},
-std::array<float,2>{0.269609749f, 0.670121372f},
-std::array<float,2>{0.798473597f, 0.771611452f},
-std::array<float,2>{0.124659501f, 0.0189004336f},
-std::array<float,2>{0.954067528f, 0.214633226f},
-std::array<float,2>{0.186394423f, 0.884462833f},
-std::array<float,2>{0.710595906f, 0.520327151f},
-std::array<float,2>{0.452952027f, 0.403737336f},
-std::array<float,2>{0.665633976f, 0.0677410588f},
-std::array<float,2>{0.382744998f, 0.851600885f},
-std::array<float,2>{0.910543203f, 0.700446129f},
-std::array<float,2>{0.246364981f, 0.292310745f},
-std::array<float,2>{0.828535378f, 0.486238837f},
-std::array<float,2>{0.0319655873f, 0.612295508f},
-std::array<float,2>{0.61253202f, 0.977951288f},
-std::array<float,2>{0.335331053f, 0.158978462f},
-std::array<float,2>{0.599892437f, 0.446625441f},
-std::array<float,2>{0.319234788f, 0.562663555f},
-std::array<float,2>{0.813207269f, 0.95039773f},
-std::array<float,2>{0.050612174f, 0.152868614f},
-std::array<float,2>{0.922603846f, 0.116347052f},
-std::array<float,2>{0.220758021f, 0.826737761f},
-std::array<float,2>{0.682814538f, 0.738143325f},
-std::array<float,2>{0.397999555f, 0.25388065f},
-std::array<float,2>{0.689233303f, 0.247321948f},
-std::array<float,2>{0.453573704f, 0.914464951f},
-std::array<float,2>{0.951849461f, 0.543178141f},
-std::array<float,2>{0.162971392f, 0.433627248f},
-std::array<float,2>{0.793985009f, 0.315989256f},
-std::array<float,2>{0.0940623581f, 0.64169842f},
-std::array<float,2>{0.506682336f, 0.782658219f},
-std::array<float,2>{0.260784179f, 0.047679361f},
-std::array<float,2>{0.640978873f, 0.297457814f},
-std::array<float,2>{0.435599566f, 0.71162349f},
-std::array<float,2>{0.883405983f, 0.867380738f},
-std::array<float,2>{0.18964836f, 0.0844127312f},
-std::array<float,2>{0.873961866f, 0.185140386f},
-std::array<float,2>{0.0245584846f, 0.993650198f},
-std::array<float,2>{0.565302491f, 0.600342035f},
-std::array<float,2>{0.358555764f, 0.480108619f},
-std::array<float,2>{0.533662975f, 0.00232553296f},
-std::array<float,2>{0.285139531f, 0.750188529f},
-std::array<float,2>{0.751895249f, 0.687351465f},
-std::array<float,2>{0.0741401464f, 0.373483658f},
-std::array<float,2>{0.987131894f, 0.387993485f},
-std::array<float,2>{0.132472903f, 0.514278769f},
-std::array<float,2>{0.725495398f, 0.896774769f},
-std::array<float,2>{0.47115472f, 0.190098271f},
-std::array<float,2>{0.678832948f, 0.473630995f},
-std::array<float,2>{0.404378772f, 0.606966436f},
-std::array<float,2>{0.931694746f, 0.986190557f},
-std::array<float,2>{0.232962266f, 0.175602093f},
-std::array<float,2>{0.821994364f, 0.0888186991f},
-std::array<float,2>{0.062134292f, 0.864362955f},
-std::array<float,2>{0.606846154f, 0.709784448f},
-std::array<float,2>{0.322485268f, 0.307578385f},
-std::array<float,2>{0.512210548f, 0.200740173f},
-std::array<float,2>{0.25034529f, 0.901575625f},
-std::array<float,2>{0.782029569f, 0.507492423f},
-std::array<float,2>{0.108761474f, 0.376366496f},
-std::array<float,2>{0.941462159f, 0.362365514f},
-std::array<float,2>{0.171866864f, 0.673530102f},
-std::array<float,2>{0.697862029f, 0.764546573f},
-std::array<float,2>{0.461016625f, 0.00966033898f},
-std::array<float,2>{0.577964544f, 0.263183802f},
-std::array<float,2>{0.350048453f, 0.74609983f},
-std::array<float,2>{0.8615762f, 0.816772819f},
-std::array<float,2>{0.0223818589f, 0.121680498f},
-std::array<float,2>{0.882045329f, 0.141442746f},
-std::array<float,2>{0.202036932f, 0.945259988f},
-std::array<float,2>{0.652098f, 0.576571465f},
-std::array<float,2>{0.422859609f, 0.441823035f},
-std::array<float,2>{0.731191039f, 0.0602208003f},
-std::array<float,2>{0.476790637f, 0.796468437f},
-std::array<float,2>{0.998398185f, 0.65434587f},
-std::array<float,2>{0.137774274f, 0.325099081f},
-std::array<float,2>{0.761216044f, 0.427796036f},
-std::array<float,2>{0.0643322691f, 0.535039306f},
-std::array<float,2>{0.543838978f, 0.909834266f},
-std::array<float,2>{0.293466657f, 0.238654196f},
-std::array<float,2>{0.550837636f, 0.392687529f},
-std::array<float,2>{0.312389672f, 0.524276674f},
-std::array<float,2>{0.780774355f, 0.882147789f},
-std::array<float,2>{0.0921634734f, 0.204006836f},
-std::array<float,2>{0.971970439f, 0.0237364862f},
-std::array<float,2>{0.14862974f, 0.781160951f},
-std::array<float,2>{0.740330517f, 0.661657512f},
-std::array<float,2>{0.487124562f, 0.355353087f},
-std::array<float,2>{0.637306154f, 0.169388115f},
-std::array<float,2>{0.406482041f, 0.975237608f},
-std::array<float,2>{0.903237164f, 0.620532155f},
-std::array<float,2>{0.217459947f, 0.498241574f},
-std::array<float,2>{0.846792996f, 0.284926713f},
-std::array<float,2>{0.00621522637f, 0.690141439f},
-std::array<float,2>{0.593134403f, 0.851457f},
-std::array<float,2>{0.361666471f, 0.076250419f},
-std::array<float,2>{0.714429259f, 0.332594812f},
-std::array<float,2>{0.441267461f, 0.637432158f},
-std::array<float,2>{0.96321702f, 0.810278594f},
-std::array<float,2>{0.175673321f, 0.0458202809f},
-std::array<float,2>{0.811463356f, 0.225222528f},
-std::array<float,2>{0.113308914f, 0.934696019f},
-std::array<float,2>{0.517711997f, 0.557533205f},
-std::array<float,2>{0.277684689f, 0.408790082f},
-std::array<float,2>{0.617700517f, 0.104124874f},
-std::array<float,2>{0.34084475f, 0.840350151f},
-std::array<float,2>{0.842101932f, 0.730309367f},
-std::array<float,2>{0.042603828f, 0.266932011f},
-std::array<float,2>{0.920603395f, 0.455291718f},
-std::array<float,2>{0.236881152f, 0.58071804f},
-std::array<float,2>{0.660100877f, 0.959249437f},
-std::array<float,2>{0.384199828f, 0.135511369f},
-std::array<float,2>{0.729605794f, 0.48900488f},
-std::array<float,2>{0.482140809f, 0.614744544f},
-std::array<float,2>{0.99341774f, 0.983442247f},
-std::array<float,2>{0.133289814f, 0.162661567f},
-std::array<float,2>{0.762961805f, 0.0625733733f},
-std::array<float,2>{0.06718418f, 0.85896498f},
-std::array<float,2>{0.539572358f, 0.696413696f},
-std::array<float,2>{0.291661263f, 0.29534027f},
-std::array<float,2>{0.571479142f, 0.216955245f},
-std::array<float,2>{0.347094625f, 0.889486253f},
-std::array<float,2>{0.866190791f, 0.515881598f},
-std::array<float,2>{0.0165140089f, 0.399507254f},
-std::array<float,2>{0.876028478f, 0.348798007f},
-std::array<float,2>{0.198770314f, 0.664063215f},
-std::array<float,2>{0.654642284f, 0.769450545f},
-std::array<float,2>{0.428734213f, 0.022724662f},
-std::array<float,2>{0.510082901f, 0.279242069f},
-std::array<float,2>{0.255820274f, 0.72008121f},
-std::array<float,2>{0.785500109f, 0.835160255f},
-std::array<float,2>{0.101921171f, 0.0956539065f},
-std::array<float,2>{0.940890491f, 0.128854692f},
-std::array<float,2>{0.167873114f, 0.96372968f},
-std::array<float,2>{0.700209677f, 0.587935567f},
-std::array<float,2>{0.465001136f, 0.467791617f},
-std::array<float,2>{0.674920142f, 0.0349189192f},
-std::array<float,2>{0.401888162f, 0.798293531f},
-std::array<float,2>{0.936809957f, 0.628710091f},
-std::array<float,2>{0.227842093f, 0.343178958f},
-std::array<float,2>{0.82744211f, 0.416984409f},
-std::array<float,2>{0.0555596203f, 0.550263524f},
-std::array<float,2>{0.602383971f, 0.926555455f},
-std::array<float,2>{0.324768722f, 0.230628654f},
-std::array<float,2>{0.624562502f, 0.383794069f},
-std::array<float,2>{0.336154103f, 0.51103878f},
-std::array<float,2>{0.838262916f, 0.892374337f},
-std::array<float,2>{0.0441285297f, 0.192870721f},
-std::array<float,2>{0.915131807f, 0.00443084072f},
-std::array<float,2>{0.240621388f, 0.754154027f},
-std::array<float,2>{0.663311005f, 0.680675507f},
-std::array<float,2>{0.386722267f, 0.370009512f},
-std::array<float,2>{0.717143238f, 0.183357954f},
-std::array<float,2>{0.442653835f, 0.99980092f},
-std::array<float,2>{0.965724885f, 0.596984148f},
-std::array<float,2>{0.176475495f, 0.483762592f},
-std::array<float,2>{0.806955934f, 0.301523983f},
-std::array<float,2>{0.109535567f, 0.715794861f},
-std::array<float,2>{0.520884156f, 0.871482968f},
-std::array<float,2>{0.275840342f, 0.0812957212f},
-std::array<float,2>{0.633484781f, 0.31847921f},
-std::array<float,2>{0.413979977f, 0.646295786f},
-std::array<float,2>{0.899035454f, 0.786822438f},
-std::array<float,2>{0.211391345f, 0.0508641787f},
-std::array<float,2>{0.849238813f, 0.245782703f},
-std::array<float,2>{0.00220114156f, 0.921782792f},
-std::array<float,2>{0.586759508f, 0.541432917f},
-std::array<float,2>{0.364540994f, 0.430366039f},
-std::array<float,2>{0.547903597f, 0.111143723f},
-std::array<float,2>{0.304688752f, 0.824133217f},
-std::array<float,2>{0.775905788f, 0.739465535f},
-std::array<float,2>{0.0863818973f, 0.256549239f},
-std::array<float,2>{0.973409772f, 0.451468974f},
-std::array<float,2>{0.15302211f, 0.568969846f},
-std::array<float,2>{0.735181987f, 0.946875215f},
-std::array<float,2>{0.490664601f, 0.151286975f},
-std::array<float,2>{0.669504225f, 0.422329009f},
-std::array<float,2>{0.376023859f, 0.537202537f},
-std::array<float,2>{0.908181787f, 0.913448453f},
-std::array<float,2>{0.243519545f, 0.236476168f},
-std::array<float,2>{0.834739029f, 0.0576323979f},
-std::array<float,2>{0.0367047191f, 0.792137742f},
-std::array<float,2>{0.615165949f, 0.649318814f},
-std::array<float,2>{0.330630302f, 0.32311964f},
-std::array<float,2>{0.525982499f, 0.14516519f},
-std::array<float,2>{0.268807232f, 0.938791156f},
-std::array<float,2>{0.803714454f, 0.571014225f},
-std::array<float,2>{0.120067827f, 0.440936923f},
-std::array<float,2>{0.958027244f, 0.261031568f},
-std::array<float,2>{0.181220889f, 0.745574832f},
-std::array<float,2>{0.703508675f, 0.814477026f},
-std::array<float,2>{0.445887357f, 0.118469432f},
-std::array<float,2>{0.579799533f, 0.364685297f},
-std::array<float,2>{0.367271692f, 0.679076254f},
-std::array<float,2>{0.852274656f, 0.75911653f},
-std::array<float,2>{0.0092152711f, 0.0145899309f},
-std::array<float,2>{0.892319381f, 0.195981771f},
-std::array<float,2>{0.206181362f, 0.904443383f},
-std::array<float,2>{0.626141965f, 0.503227353f},
-std::array<float,2>{0.420228392f, 0.382356554f},
-std::array<float,2>{0.745434046f, 0.0922810361f},
-std::array<float,2>{0.494309366f, 0.860665619f},
-std::array<float,2>{0.983512998f, 0.704203546f},
-std::array<float,2>{0.147919923f, 0.310364217f},
-std::array<float,2>{0.772188187f, 0.471752107f},
-std::array<float,2>{0.0840277225f, 0.603591919f},
-std::array<float,2>{0.560194075f, 0.988946855f},
-std::array<float,2>{0.301094383f, 0.179501265f},
-std::array<float,2>{0.536801338f, 0.459230185f},
-std::array<float,2>{0.285969406f, 0.585805476f},
-std::array<float,2>{0.755890965f, 0.956636488f},
-std::array<float,2>{0.0771757588f, 0.13770473f},
-std::array<float,2>{0.990031242f, 0.107635163f},
-std::array<float,2>{0.126568481f, 0.836271226f},
-std::array<float,2>{0.721609831f, 0.730630875f},
-std::array<float,2>{0.474896729f, 0.271594822f},
-std::array<float,2>{0.64773494f, 0.220116302f},
-std::array<float,2>{0.432649255f, 0.931333005f},
-std::array<float,2>{0.886722445f, 0.560830295f},
-std::array<float,2>{0.195302621f, 0.412861735f},
-std::array<float,2>{0.868201196f, 0.330488831f},
-std::array<float,2>{0.0304542594f, 0.634373605f},
-std::array<float,2>{0.567543328f, 0.8060776f},
-std::array<float,2>{0.352472872f, 0.0415212698f},
-std::array<float,2>{0.693812728f, 0.285342425f},
-std::array<float,2>{0.459564269f, 0.695038557f},
-std::array<float,2>{0.947142601f, 0.847099006f},
-std::array<float,2>{0.159055814f, 0.0720151812f},
-std::array<float,2>{0.792721629f, 0.165478781f},
-std::array<float,2>{0.0996292904f, 0.972356915f},
-std::array<float,2>{0.50198108f, 0.624123454f},
-std::array<float,2>{0.264439523f, 0.495650947f},
-std::array<float,2>{0.596429229f, 0.0298893675f},
-std::array<float,2>{0.314286768f, 0.77648139f},
-std::array<float,2>{0.820296586f, 0.658626437f},
-std::array<float,2>{0.0526275001f, 0.355533868f},
-std::array<float,2>{0.926768899f, 0.396850705f},
-std::array<float,2>{0.224012733f, 0.530917346f},
-std::array<float,2>{0.683821917f, 0.876697958f},
-std::array<float,2>{0.390840203f, 0.209979132f},
-std::array<float,2>{0.708817601f, 0.405835718f},
-std::array<float,2>{0.450036258f, 0.522610307f},
-std::array<float,2>{0.955759108f, 0.885574162f},
-std::array<float,2>{0.184141189f, 0.211295441f},
-std::array<float,2>{0.80000633f, 0.0158439241f},
-std::array<float,2>{0.121672817f, 0.770537555f},
-std::array<float,2>{0.527793348f, 0.668239594f},
-std::array<float,2>{0.272515744f, 0.34640941f},
-std::array<float,2>{0.610413134f, 0.156943709f},
-std::array<float,2>{0.333576441f, 0.979790151f},
-std::array<float,2>{0.83168292f, 0.61044383f},
-std::array<float,2>{0.0332220495f, 0.48680982f},
-std::array<float,2>{0.912979066f, 0.290492058f},
-std::array<float,2>{0.248937935f, 0.701890707f},
-std::array<float,2>{0.667449951f, 0.854539752f},
-std::array<float,2>{0.379649758f, 0.0696685463f},
-std::array<float,2>{0.555168748f, 0.339360714f},
-std::array<float,2>{0.299064577f, 0.631834805f},
-std::array<float,2>{0.769456089f, 0.800949216f},
-std::array<float,2>{0.0782855526f, 0.0388632603f},
-std::array<float,2>{0.976587713f, 0.228616491f},
-std::array<float,2>{0.143619463f, 0.922908127f},
-std::array<float,2>{0.748219252f, 0.551448703f},
-std::array<float,2>{0.497812986f, 0.418816388f},
-std::array<float,2>{0.632540047f, 0.101353757f},
-std::array<float,2>{0.417476088f, 0.829158485f},
-std::array<float,2>{0.895358026f, 0.725848377f},
-std::array<float,2>{0.210110694f, 0.274501383f},
-std::array<float,2>{0.856417477f, 0.462694645f},
-std::array<float,2>{0.013666071f, 0.590499699f},
-std::array<float,2>{0.582538247f, 0.967788994f},
-std::array<float,2>{0.373093337f, 0.132376075f},
-std::array<float,2>{0.56284672f, 0.476931423f},
-std::array<float,2>{0.356313497f, 0.599205673f},
-std::array<float,2>{0.87136364f, 0.995508015f},
-std::array<float,2>{0.0265526585f, 0.185765758f},
-std::array<float,2>{0.885551214f, 0.0825718343f},
-std::array<float,2>{0.189228997f, 0.87010318f},
-std::array<float,2>{0.642851353f, 0.71345073f},
-std::array<float,2>{0.434121102f, 0.30049938f},
-std::array<float,2>{0.724538803f, 0.188043103f},
-std::array<float,2>{0.46930179f, 0.894923687f},
-std::array<float,2>{0.984947741f, 0.512254059f},
-std::array<float,2>{0.129425332f, 0.389176995f},
-std::array<float,2>{0.753746927f, 0.371100664f},
-std::array<float,2>{0.0708054379f, 0.684257746f},
-std::array<float,2>{0.532328844f, 0.752050817f},
-std::array<float,2>{0.281849653f, 0.000266220013f},
-std::array<float,2>{0.681169152f, 0.251671493f},
-std::array<float,2>{0.395954251f, 0.734730601f},
-std::array<float,2>{0.924657583f, 0.82610333f},
-std::array<float,2>{0.220234811f, 0.115041576f},
-std::array<float,2>{0.815324426f, 0.155914828f},
-std::array<float,2>{0.0476164073f, 0.951289952f},
-std::array<float,2>{0.598951995f, 0.565024555f},
-std::array<float,2>{0.316662341f, 0.448787063f},
-std::array<float,2>{0.504049122f, 0.0501374006f},
-std::array<float,2>{0.257919669f, 0.784294605f},
-std::array<float,2>{0.796495378f, 0.642682135f},
-std::array<float,2>{0.0967043713f, 0.314096481f},
-std::array<float,2>{0.949986517f, 0.435894281f},
-std::array<float,2>{0.160479337f, 0.545309484f},
-std::array<float,2>{0.689466596f, 0.917829573f},
-std::array<float,2>{0.455128551f, 0.248329088f},
-std::array<float,2>{0.649227858f, 0.445244968f},
-std::array<float,2>{0.425201774f, 0.575150967f},
-std::array<float,2>{0.879637837f, 0.942413986f},
-std::array<float,2>{0.200798944f, 0.143085063f},
-std::array<float,2>{0.861093819f, 0.124404117f},
-std::array<float,2>{0.020714514f, 0.819325864f},
-std::array<float,2>{0.575942695f, 0.748550355f},
-std::array<float,2>{0.348648518f, 0.26460439f},
-std::array<float,2>{0.545365214f, 0.241041541f},
-std::array<float,2>{0.295928001f, 0.906546414f},
-std::array<float,2>{0.75896126f, 0.532944858f},
-std::array<float,2>{0.0663196221f, 0.427555293f},
-std::array<float,2>{0.996373713f, 0.326786786f},
-std::array<float,2>{0.138891518f, 0.653513372f},
-std::array<float,2>{0.734312594f, 0.793283761f},
-std::array<float,2>{0.478721201f, 0.0615041293f},
-std::array<float,2>{0.609320283f, 0.305020779f},
-std::array<float,2>{0.321021914f, 0.707229495f},
-std::array<float,2>{0.823173165f, 0.866814673f},
-std::array<float,2>{0.0590729266f, 0.0876120031f},
-std::array<float,2>{0.93025583f, 0.172082603f},
-std::array<float,2>{0.23087357f, 0.987334251f},
-std::array<float,2>{0.677480936f, 0.609318197f},
-std::array<float,2>{0.404092431f, 0.475828379f},
-std::array<float,2>{0.696763515f, 0.0108909104f},
-std::array<float,2>{0.463058084f, 0.763581812f},
-std::array<float,2>{0.943667591f, 0.67577827f},
-std::array<float,2>{0.168551192f, 0.360845029f},
-std::array<float,2>{0.784321547f, 0.377914578f},
-std::array<float,2>{0.105630465f, 0.505308986f},
-std::array<float,2>{0.515467644f, 0.899860919f},
-std::array<float,2>{0.25309965f, 0.202598214f},
-std::array<float,2>{0.516530573f, 0.406529576f},
-std::array<float,2>{0.27929914f, 0.555205286f},
-std::array<float,2>{0.808892727f, 0.935739279f},
-std::array<float,2>{0.116555139f, 0.223404303f},
-std::array<float,2>{0.960976362f, 0.0438246652f},
-std::array<float,2>{0.172004983f, 0.81226033f},
-std::array<float,2>{0.712144375f, 0.640318394f},
-std::array<float,2>{0.43924123f, 0.335101008f},
-std::array<float,2>{0.656783879f, 0.133422807f},
-std::array<float,2>{0.385685116f, 0.957236826f},
-std::array<float,2>{0.918280661f, 0.579358935f},
-std::array<float,2>{0.236060008f, 0.453557312f},
-std::array<float,2>{0.840771735f, 0.268477142f},
-std::array<float,2>{0.0395654179f, 0.727039874f},
-std::array<float,2>{0.619802237f, 0.843464971f},
-std::array<float,2>{0.3436445f, 0.103088371f},
-std::array<float,2>{0.739937127f, 0.353043586f},
-std::array<float,2>{0.486196697f, 0.662137032f},
-std::array<float,2>{0.969108582f, 0.778681278f},
-std::array<float,2>{0.150695473f, 0.0270096567f},
-std::array<float,2>{0.778072119f, 0.206378251f},
-std::array<float,2>{0.0913404822f, 0.879035056f},
-std::array<float,2>{0.553003252f, 0.525606751f},
-std::array<float,2>{0.308907866f, 0.390961945f},
-std::array<float,2>{0.590735734f, 0.0750227645f},
-std::array<float,2>{0.35960108f, 0.847754717f},
-std::array<float,2>{0.844761431f, 0.689010143f},
-std::array<float,2>{0.00482920185f, 0.282554448f},
-std::array<float,2>{0.90480274f, 0.49649778f},
-std::array<float,2>{0.21543546f, 0.617426574f},
-std::array<float,2>{0.639699638f, 0.973292232f},
-std::array<float,2>{0.409654707f, 0.171476737f},
-std::array<float,2>{0.691559374f, 0.495124668f},
-std::array<float,2>{0.458711803f, 0.624699473f},
-std::array<float,2>{0.947313666f, 0.971994162f},
-std::array<float,2>{0.1567377f, 0.165905923f},
-std::array<float,2>{0.790444076f, 0.071677275f},
-std::array<float,2>{0.0979855284f, 0.847194016f},
-std::array<float,2>{0.500021458f, 0.694498897f},
-std::array<float,2>{0.262632817f, 0.285690337f},
-std::array<float,2>{0.595518053f, 0.210647076f},
-std::array<float,2>{0.315553486f, 0.876398087f},
-std::array<float,2>{0.817832589f, 0.53073138f},
-std::array<float,2>{0.0531784482f, 0.39698112f},
-std::array<float,2>{0.928832889f, 0.356162697f},
-std::array<float,2>{0.225368947f, 0.658857107f},
-std::array<float,2>{0.685703218f, 0.777019858f},
-std::array<float,2>{0.394296616f, 0.0295436028f},
-std::array<float,2>{0.53858918f, 0.271976322f},
-std::array<float,2>{0.287525326f, 0.731379569f},
-std::array<float,2>{0.753974795f, 0.83654654f},
-std::array<float,2>{0.0750415474f, 0.108288176f},
-std::array<float,2>{0.991684675f, 0.138460636f},
-std::array<float,2>{0.127423033f, 0.956444502f},
-std::array<float,2>{0.720526278f, 0.584965527f},
-std::array<float,2>{0.474571496f, 0.459788471f},
-std::array<float,2>{0.645468235f, 0.0412658602f},
-std::array<float,2>{0.430716902f, 0.806483865f},
-std::array<float,2>{0.889345765f, 0.633801758f},
-std::array<float,2>{0.191458315f, 0.330603212f},
-std::array<float,2>{0.870715916f, 0.412400931f},
-std::array<float,2>{0.0282866005f, 0.561425865f},
-std::array<float,2>{0.569086492f, 0.930805683f},
-std::array<float,2>{0.35371232f, 0.220352724f},
-std::array<float,2>{0.580858588f, 0.382131696f},
-std::array<float,2>{0.369788915f, 0.50349158f},
-std::array<float,2>{0.855012357f, 0.905138791f},
-std::array<float,2>{0.00986344926f, 0.195550025f},
-std::array<float,2>{0.89383769f, 0.0137978066f},
-std::array<float,2>{0.204612941f, 0.759730399f},
-std::array<float,2>{0.628026009f, 0.679397702f},
-std::array<float,2>{0.418313324f, 0.364893764f},
-std::array<float,2>{0.743408382f, 0.179130107f},
-std::array<float,2>{0.494023025f, 0.988284528f},
-std::array<float,2>{0.981365383f, 0.604168952f},
-std::array<float,2>{0.145632312f, 0.472174883f},
-std::array<float,2>{0.771390378f, 0.309918851f},
-std::array<float,2>{0.0834535509f, 0.705057383f},
-std::array<float,2>{0.561295807f, 0.861280262f},
-std::array<float,2>{0.303386569f, 0.0927138329f},
-std::array<float,2>{0.670823455f, 0.32256946f},
-std::array<float,2>{0.378042191f, 0.648892164f},
-std::array<float,2>{0.908406913f, 0.792660892f},
-std::array<float,2>{0.24532932f, 0.0582626238f},
-std::array<float,2>{0.832265735f, 0.2373043f},
-std::array<float,2>{0.0372409113f, 0.913850188f},
-std::array<float,2>{0.616391659f, 0.537984014f},
-std::array<float,2>{0.328469276f, 0.42284134f},
-std::array<float,2>{0.523495317f, 0.118804991f},
-std::array<float,2>{0.266446501f, 0.815048516f},
-std::array<float,2>{0.80091083f, 0.745889962f},
-std::array<float,2>{0.118757144f, 0.261268556f},
-std::array<float,2>{0.959511161f, 0.44088459f},
-std::array<float,2>{0.183557317f, 0.570334017f},
-std::array<float,2>{0.706868351f, 0.938987613f},
-std::array<float,2>{0.447409809f, 0.144878134f},
-std::array<float,2>{0.636414528f, 0.429769516f},
-std::array<float,2>{0.410891682f, 0.541530192f},
-std::array<float,2>{0.901802182f, 0.921275914f},
-std::array<float,2>{0.213352621f, 0.245562091f},
-std::array<float,2>{0.851117492f, 0.0516760051f},
-std::array<float,2>{0.00128190545f, 0.786458135f},
-std::array<float,2>{0.588638127f, 0.645573437f},
-std::array<float,2>{0.366779685f, 0.319011033f},
-std::array<float,2>{0.549388885f, 0.150393873f},
-std::array<float,2>{0.308485597f, 0.946329415f},
-std::array<float,2>{0.775202096f, 0.568426311f},
-std::array<float,2>{0.088506788f, 0.451849759f},
-std::array<float,2>{0.976437271f, 0.255937397f},
-std::array<float,2>{0.156223372f, 0.739797175f},
-std::array<float,2>{0.736417711f, 0.823493302f},
-std::array<float,2>{0.489841789f, 0.110607766f},
-std::array<float,2>{0.622415543f, 0.369606137f},
-std::array<float,2>{0.338476241f, 0.681487918f},
-std::array<float,2>{0.836943328f, 0.754758656f},
-std::array<float,2>{0.0449339636f, 0.00415338343f},
-std::array<float,2>{0.916670501f, 0.193209782f},
-std::array<float,2>{0.239342183f, 0.891627192f},
-std::array<float,2>{0.661197305f, 0.511695802f},
-std::array<float,2>{0.388795435f, 0.384758174f},
-std::array<float,2>{0.715625405f, 0.081852816f},
-std::array<float,2>{0.444318622f, 0.872056603f},
-std::array<float,2>{0.96860075f, 0.715153396f},
-std::array<float,2>{0.179624349f, 0.300802857f},
-std::array<float,2>{0.80635792f, 0.484173119f},
-std::array<float,2>{0.112000041f, 0.597609162f},
-std::array<float,2>{0.52294445f, 0.999215662f},
-std::array<float,2>{0.275312513f, 0.183039591f},
-std::array<float,2>{0.50853169f, 0.468489259f},
-std::array<float,2>{0.256315827f, 0.588837028f},
-std::array<float,2>{0.7880072f, 0.963025212f},
-std::array<float,2>{0.104301646f, 0.128032118f},
-std::array<float,2>{0.938759863f, 0.0951925665f},
-std::array<float,2>{0.16452831f, 0.835859835f},
-std::array<float,2>{0.701179981f, 0.720234275f},
-std::array<float,2>{0.468566269f, 0.278735936f},
-std::array<float,2>{0.672511995f, 0.230965391f},
-std::array<float,2>{0.399935097f, 0.926018894f},
-std::array<float,2>{0.933815777f, 0.550514698f},
-std::array<float,2>{0.230112433f, 0.416329473f},
-std::array<float,2>{0.826140285f, 0.343716234f},
-std::array<float,2>{0.0568244494f, 0.628063738f},
-std::array<float,2>{0.605436981f, 0.798737645f},
-std::array<float,2>{0.327921897f, 0.0346670412f},
-std::array<float,2>{0.727182686f, 0.295854837f},
-std::array<float,2>{0.483723134f, 0.697217941f},
-std::array<float,2>{0.99449873f, 0.858795226f},
-std::array<float,2>{0.135902032f, 0.0634202287f},
-std::array<float,2>{0.765571713f, 0.162319079f},
-std::array<float,2>{0.0698825344f, 0.983932316f},
-std::array<float,2>{0.541778743f, 0.614971459f},
-std::array<float,2>{0.28936097f, 0.488621771f},
-std::array<float,2>{0.573172271f, 0.0231703669f},
-std::array<float,2>{0.344137132f, 0.768969417f},
-std::array<float,2>{0.863690317f, 0.66502583f},
-std::array<float,2>{0.0192901772f, 0.349379271f},
-std::array<float,2>{0.878672123f, 0.400279909f},
-std::array<float,2>{0.196128219f, 0.516560733f},
-std::array<float,2>{0.653271556f, 0.889132082f},
-std::array<float,2>{0.427222043f, 0.217379183f},
-std::array<float,2>{0.740763545f, 0.391258806f},
-std::array<float,2>{0.486371517f, 0.526364625f},
-std::array<float,2>{0.972375274f, 0.879540205f},
-std::array<float,2>{0.149080187f, 0.206740722f},
-std::array<float,2>{0.780603707f, 0.0263845734f},
-std::array<float,2>{0.0927220955f, 0.779204547f},
-std::array<float,2>{0.551461399f, 0.662597775f},
-std::array<float,2>{0.311577082f, 0.352835804f},
-std::array<float,2>{0.593630493f, 0.17094861f},
-std::array<float,2>{0.362168193f, 0.973142207f},
-std::array<float,2>{0.847562492f, 0.618021667f},
-std::array<float,2>{0.00667809369f, 0.496675342f},
-std::array<float,2>{0.90282774f, 0.28293699f},
-std::array<float,2>{0.216844797f, 0.688528478f},
-std::array<float,2>{0.63715291f, 0.848399103f},
-std::array<float,2>{0.406916469f, 0.0743745118f},
-std::array<float,2>{0.518130481f, 0.335655272f},
-std::array<float,2>{0.278024316f, 0.639878869f},
-std::array<float,2>{0.810773134f, 0.8117944f},
-std::array<float,2>{0.11408291f, 0.0430039614f},
-std::array<float,2>{0.963476539f, 0.22268343f},
-std::array<float,2>{0.175136521f, 0.93636471f},
-std::array<float,2>{0.714181006f, 0.55478698f},
-std::array<float,2>{0.440577209f, 0.406993896f},
-std::array<float,2>{0.659282804f, 0.10254889f},
-std::array<float,2>{0.384357929f, 0.843217194f},
-std::array<float,2>{0.920353293f, 0.727387309f},
-std::array<float,2>{0.236616403f, 0.267949343f},
-std::array<float,2>{0.842447579f, 0.454035103f},
-std::array<float,2>{0.0422818847f, 0.579597533f},
-std::array<float,2>{0.617355824f, 0.95784682f},
-std::array<float,2>{0.341677099f, 0.133083895f},
-std::array<float,2>{0.607080936f, 0.476231843f},
-std::array<float,2>{0.322904736f, 0.608461022f},
-std::array<float,2>{0.821541548f, 0.988149405f},
-std::array<float,2>{0.0615508705f, 0.172515273f},
-std::array<float,2>{0.93233943f, 0.0873761252f},
-std::array<float,2>{0.232668683f, 0.866221607f},
-std::array<float,2>{0.679574728f, 0.70764339f},
-std::array<float,2>{0.405209869f, 0.305647284f},
-std::array<float,2>{0.697298169f, 0.202723429f},
-std::array<float,2>{0.461806476f, 0.899940133f},
-std::array<float,2>{0.942302465f, 0.505638242f},
-std::array<float,2>{0.171350971f, 0.377428472f},
-std::array<float,2>{0.781274498f, 0.36053139f},
-std::array<float,2>{0.108965203f, 0.675145209f},
-std::array<float,2>{0.512078702f, 0.76270628f},
-std::array<float,2>{0.250715256f, 0.0114254337f},
-std::array<float,2>{0.651622713f, 0.264150292f},
-std::array<float,2>{0.423349172f, 0.748139739f},
-std::array<float,2>{0.882761419f, 0.818510354f},
-std::array<float,2>{0.201419741f, 0.124593303f},
-std::array<float,2>{0.862039506f, 0.142630354f},
-std::array<float,2>{0.0215343293f, 0.94317466f},
-std::array<float,2>{0.577272415f, 0.574484587f},
-std::array<float,2>{0.35013786f, 0.444696128f},
-std::array<float,2>{0.543046057f, 0.0608202517f},
-std::array<float,2>{0.29327172f, 0.793910801f},
-std::array<float,2>{0.761268675f, 0.653841496f},
-std::array<float,2>{0.0636886656f, 0.326357067f},
-std::array<float,2>{0.998948038f, 0.427119851f},
-std::array<float,2>{0.13853313f, 0.532704473f},
-std::array<float,2>{0.73077035f, 0.90707016f},
-std::array<float,2>{0.477213234f, 0.240289256f},
-std::array<float,2>{0.683440387f, 0.448330879f},
-std::array<float,2>{0.397752285f, 0.564456761f},
-std::array<float,2>{0.922243297f, 0.951808929f},
-std::array<float,2>{0.22121793f, 0.155678928f},
-std::array<float,2>{0.812747419f, 0.114339784f},
-std::array<float,2>{0.0499097146f, 0.825386465f},
-std::array<float,2>{0.600455523f, 0.735085368f},
-std::array<float,2>{0.318601459f, 0.251345426f},
-std::array<float,2>{0.50622046f, 0.248831943f},
-std::array<float,2>{0.261595815f, 0.917170703f},
-std::array<float,2>{0.794505835f, 0.545844257f},
-std::array<float,2>{0.0943631455f, 0.436439425f},
-std::array<float,2>{0.951481521f, 0.313819647f},
-std::array<float,2>{0.162347689f, 0.643126667f},
-std::array<float,2>{0.688653767f, 0.78492862f},
-std::array<float,2>{0.45393306f, 0.0503878221f},
-std::array<float,2>{0.564669669f, 0.300176293f},
-std::array<float,2>{0.359065026f, 0.713078558f},
-std::array<float,2>{0.873449743f, 0.869207323f},
-std::array<float,2>{0.0250465199f, 0.0822333619f},
-std::array<float,2>{0.883134365f, 0.186265007f},
-std::array<float,2>{0.190024436f, 0.995806038f},
-std::array<float,2>{0.641281307f, 0.599006355f},
-std::array<float,2>{0.436127812f, 0.477473229f},
-std::array<float,2>{0.724897206f, 0.000574954029f},
-std::array<float,2>{0.471303999f, 0.752494156f},
-std::array<float,2>{0.986522853f, 0.683964074f},
-std::array<float,2>{0.132017061f, 0.371973991f},
-std::array<float,2>{0.751181722f, 0.388863236f},
-std::array<float,2>{0.0737160295f, 0.511721373f},
-std::array<float,2>{0.533795357f, 0.895288646f},
-std::array<float,2>{0.284264743f, 0.18752256f},
-std::array<float,2>{0.557992995f, 0.418443978f},
-std::array<float,2>{0.298737824f, 0.551217139f},
-std::array<float,2>{0.766813159f, 0.923487544f},
-std::array<float,2>{0.0812122226f, 0.22946623f},
-std::array<float,2>{0.979924381f, 0.0384916402f},
-std::array<float,2>{0.141906366f, 0.801559627f},
-std::array<float,2>{0.746829391f, 0.631011784f},
-std::array<float,2>{0.498782694f, 0.339290828f},
-std::array<float,2>{0.629638493f, 0.132244393f},
-std::array<float,2>{0.41460526f, 0.968557477f},
-std::array<float,2>{0.896880209f, 0.59021306f},
-std::array<float,2>{0.208422944f, 0.461919099f},
-std::array<float,2>{0.858307779f, 0.27490887f},
-std::array<float,2>{0.0145267211f, 0.726252079f},
-std::array<float,2>{0.584576428f, 0.829705715f},
-std::array<float,2>{0.371372461f, 0.100766301f},
-std::array<float,2>{0.710271537f, 0.345855951f},
-std::array<float,2>{0.452450812f, 0.66872859f},
-std::array<float,2>{0.953236878f, 0.771053135f},
-std::array<float,2>{0.185632259f, 0.0164928902f},
-std::array<float,2>{0.798279047f, 0.211489454f},
-std::array<float,2>{0.124502882f, 0.884858429f},
-std::array<float,2>{0.529998183f, 0.5231359f},
-std::array<float,2>{0.270077586f, 0.405486226f},
-std::array<float,2>{0.61292845f, 0.0698720589f},
-std::array<float,2>{0.33545202f, 0.855327606f},
-std::array<float,2>{0.828644276f, 0.701191962f},
-std::array<float,2>{0.0316238254f, 0.291015416f},
-std::array<float,2>{0.910930932f, 0.486834675f},
-std::array<float,2>{0.246725425f, 0.611301661f},
-std::array<float,2>{0.665162802f, 0.980384707f},
-std::array<float,2>{0.382027775f, 0.156627551f},
-std::array<float,2>{0.720845997f, 0.458596706f},
-std::array<float,2>{0.475432962f, 0.58312571f},
-std::array<float,2>{0.989425004f, 0.953464687f},
-std::array<float,2>{0.126350269f, 0.138818786f},
-std::array<float,2>{0.75670737f, 0.107055672f},
-std::array<float,2>{0.0776609704f, 0.83923763f},
-std::array<float,2>{0.536552548f, 0.733896852f},
-std::array<float,2>{0.285286844f, 0.270317048f},
-std::array<float,2>{0.568312645f, 0.222008944f},
-std::array<float,2>{0.351776063f, 0.93338871f},
-std::array<float,2>{0.868928134f, 0.560355246f},
-std::array<float,2>{0.030925069f, 0.411858916f},
-std::array<float,2>{0.887667418f, 0.328434646f},
-std::array<float,2>{0.194417879f, 0.636490941f},
-std::array<float,2>{0.648176432f, 0.807505727f},
-std::array<float,2>{0.433275461f, 0.0392771736f},
-std::array<float,2>{0.502727687f, 0.288653523f},
-std::array<float,2>{0.264158338f, 0.692744672f},
-std::array<float,2>{0.792052984f, 0.844514251f},
-std::array<float,2>{0.100344695f, 0.0732689574f},
-std::array<float,2>{0.946372449f, 0.167179361f},
-std::array<float,2>{0.158674181f, 0.970133781f},
-std::array<float,2>{0.694170177f, 0.621634603f},
-std::array<float,2>{0.459358573f, 0.492326945f},
-std::array<float,2>{0.684527814f, 0.0283402484f},
-std::array<float,2>{0.391186357f, 0.774300992f},
-std::array<float,2>{0.927488148f, 0.657505274f},
-std::array<float,2>{0.224207982f, 0.357540369f},
-std::array<float,2>{0.819534183f, 0.395256072f},
-std::array<float,2>{0.0519899502f, 0.529045105f},
-std::array<float,2>{0.595920503f, 0.877616346f},
-std::array<float,2>{0.313696772f, 0.208010137f},
-std::array<float,2>{0.614407659f, 0.424075812f},
-std::array<float,2>{0.330460608f, 0.536143899f},
-std::array<float,2>{0.834007204f, 0.910968423f},
-std::array<float,2>{0.0362216942f, 0.235144019f},
-std::array<float,2>{0.907565773f, 0.0559031852f},
-std::array<float,2>{0.244103104f, 0.789250255f},
-std::array<float,2>{0.669080198f, 0.651923537f},
-std::array<float,2>{0.37674129f, 0.321420908f},
-std::array<float,2>{0.703918695f, 0.148337647f},
-std::array<float,2>{0.445775807f, 0.940097451f},
-std::array<float,2>{0.958932638f, 0.573913395f},
-std::array<float,2>{0.181135759f, 0.43883732f},
-std::array<float,2>{0.804501355f, 0.259750009f},
-std::array<float,2>{0.119274445f, 0.743564188f},
-std::array<float,2>{0.525736988f, 0.814447343f},
-std::array<float,2>{0.269153178f, 0.12046618f},
-std::array<float,2>{0.626844466f, 0.365776509f},
-std::array<float,2>{0.420449585f, 0.676458538f},
-std::array<float,2>{0.891976357f, 0.76076597f},
-std::array<float,2>{0.206837252f, 0.012668428f},
-std::array<float,2>{0.851565003f, 0.197780892f},
-std::array<float,2>{0.00957511831f, 0.902667761f},
-std::array<float,2>{0.579291105f, 0.500496209f},
-std::array<float,2>{0.367849976f, 0.37948972f},
-std::array<float,2>{0.55990994f, 0.0900607854f},
-std::array<float,2>{0.301298648f, 0.862591863f},
-std::array<float,2>{0.771932721f, 0.706885874f},
-std::array<float,2>{0.0849211067f, 0.311976314f},
-std::array<float,2>{0.984002292f, 0.468837351f},
-std::array<float,2>{0.148188129f, 0.602134407f},
-std::array<float,2>{0.745840847f, 0.991974294f},
-std::array<float,2>{0.494757414f, 0.176566035f},
-std::array<float,2>{0.663606644f, 0.386545867f},
-std::array<float,2>{0.387349367f, 0.50837791f},
-std::array<float,2>{0.915545285f, 0.892971337f},
-std::array<float,2>{0.240923375f, 0.193954825f},
-std::array<float,2>{0.838799298f, 0.00758611737f},
-std::array<float,2>{0.0446572714f, 0.756241262f},
-std::array<float,2>{0.624126196f, 0.682359695f},
-std::array<float,2>{0.336697429f, 0.368252635f},
-std::array<float,2>{0.521011174f, 0.18107231f},
-std::array<float,2>{0.276203126f, 0.997581899f},
-std::array<float,2>{0.807461023f, 0.594503939f},
-std::array<float,2>{0.110149652f, 0.482203424f},
-std::array<float,2>{0.965015054f, 0.303172588f},
-std::array<float,2>{0.176214874f, 0.716825485f},
-std::array<float,2>{0.717619419f, 0.873233736f},
-std::array<float,2>{0.443080485f, 0.0788082853f},
-std::array<float,2>{0.586194038f, 0.316989332f},
-std::array<float,2>{0.365229726f, 0.646794558f},
-std::array<float,2>{0.848657846f, 0.78728956f},
-std::array<float,2>{0.00276130508f, 0.0539461151f},
-std::array<float,2>{0.898734808f, 0.242680192f},
-std::array<float,2>{0.211597055f, 0.918934643f},
-std::array<float,2>{0.633203685f, 0.540751815f},
-std::array<float,2>{0.413502991f, 0.43293801f},
-std::array<float,2>{0.734475434f, 0.112714112f},
-std::array<float,2>{0.491128206f, 0.821216941f},
-std::array<float,2>{0.972714603f, 0.740334511f},
-std::array<float,2>{0.152510896f, 0.2549344f},
-std::array<float,2>{0.775565505f, 0.450850487f},
-std::array<float,2>{0.0868665203f, 0.567443371f},
-std::array<float,2>{0.548613191f, 0.947423518f},
-std::array<float,2>{0.305324972f, 0.14877905f},
-std::array<float,2>{0.539115906f, 0.490776926f},
-std::array<float,2>{0.291085988f, 0.617041707f},
-std::array<float,2>{0.76334703f, 0.982066512f},
-std::array<float,2>{0.0665743649f, 0.160346359f},
-std::array<float,2>{0.993830264f, 0.0658990517f},
-std::array<float,2>{0.133610383f, 0.856497765f},
-std::array<float,2>{0.730316043f, 0.698067904f},
-std::array<float,2>{0.481627703f, 0.293292969f},
-std::array<float,2>{0.655250669f, 0.216765493f},
-std::array<float,2>{0.429267079f, 0.88710767f},
-std::array<float,2>{0.876764655f, 0.51899761f},
-std::array<float,2>{0.198643506f, 0.401274204f},
-std::array<float,2>{0.865548134f, 0.350036353f},
-std::array<float,2>{0.0158351697f, 0.666451395f},
-std::array<float,2>{0.571899891f, 0.766854882f},
-std::array<float,2>{0.347201079f, 0.0213348195f},
-std::array<float,2>{0.700750887f, 0.280650318f},
-std::array<float,2>{0.465557218f, 0.720848322f},
-std::array<float,2>{0.941116929f, 0.832950056f},
-std::array<float,2>{0.167359471f, 0.0965699553f},
-std::array<float,2>{0.78589803f, 0.126744971f},
-std::array<float,2>{0.102155276f, 0.961271942f},
-std::array<float,2>{0.510352254f, 0.586958587f},
-std::array<float,2>{0.254995555f, 0.465245366f},
-std::array<float,2>{0.601917624f, 0.0316382386f},
-std::array<float,2>{0.324456692f, 0.799663007f},
-std::array<float,2>{0.827758789f, 0.62547195f},
-std::array<float,2>{0.0547095016f, 0.339936912f},
-std::array<float,2>{0.93735683f, 0.415688694f},
-std::array<float,2>{0.228365764f, 0.548478842f},
-std::array<float,2>{0.675720632f, 0.927837372f},
-std::array<float,2>{0.401613265f, 0.23309499f},
-std::array<float,2>{0.712762892f, 0.408477992f},
-std::array<float,2>{0.438828975f, 0.556818187f},
-std::array<float,2>{0.96162349f, 0.935168564f},
-std::array<float,2>{0.172682822f, 0.225064263f},
-std::array<float,2>{0.809261799f, 0.0453766026f},
-std::array<float,2>{0.117103711f, 0.809743464f},
-std::array<float,2>{0.515922546f, 0.636926651f},
-std::array<float,2>{0.279786497f, 0.332354397f},
-std::array<float,2>{0.619438887f, 0.135165602f},
-std::array<float,2>{0.342807591f, 0.959838748f},
-std::array<float,2>{0.840301275f, 0.58026582f},
-std::array<float,2>{0.0394662395f, 0.455741763f},
-std::array<float,2>{0.918790996f, 0.26745981f},
-std::array<float,2>{0.235750318f, 0.729734004f},
-std::array<float,2>{0.656251371f, 0.840094268f},
-std::array<float,2>{0.385183334f, 0.103979334f},
-std::array<float,2>{0.55358988f, 0.3547979f},
-std::array<float,2>{0.309386849f, 0.661360919f},
-std::array<float,2>{0.777352512f, 0.780450284f},
-std::array<float,2>{0.0911988541f, 0.0243987385f},
-std::array<float,2>{0.969275475f, 0.203335494f},
-std::array<float,2>{0.151061669f, 0.882396698f},
-std::array<float,2>{0.739392757f, 0.52354604f},
-std::array<float,2>{0.485360682f, 0.393443763f},
-std::array<float,2>{0.64039737f, 0.0769889802f},
-std::array<float,2>{0.409874409f, 0.850714147f},
-std::array<float,2>{0.904523551f, 0.689665973f},
-std::array<float,2>{0.21512343f, 0.28437826f},
-std::array<float,2>{0.84546572f, 0.498637378f},
-std::array<float,2>{0.0042751669f, 0.621072948f},
-std::array<float,2>{0.590086222f, 0.974880219f},
-std::array<float,2>{0.360191733f, 0.169863343f},
-std::array<float,2>{0.575392067f, 0.442353845f},
-std::array<float,2>{0.349582553f, 0.576853991f},
-std::array<float,2>{0.860784292f, 0.944677889f},
-std::array<float,2>{0.0213171411f, 0.140745968f},
-std::array<float,2>{0.878980219f, 0.121276729f},
-std::array<float,2>{0.200394541f, 0.816998482f},
-std::array<float,2>{0.648815393f, 0.746960163f},
-std::array<float,2>{0.425480157f, 0.262911677f},
-std::array<float,2>{0.733856142f, 0.238802612f},
-std::array<float,2>{0.479293644f, 0.909341812f},
-std::array<float,2>{0.996694982f, 0.53459537f},
-std::array<float,2>{0.139602289f, 0.428266674f},
-std::array<float,2>{0.759302199f, 0.324622273f},
-std::array<float,2>{0.0654458329f, 0.655271113f},
-std::array<float,2>{0.545483649f, 0.795935333f},
-std::array<float,2>{0.296660364f, 0.0600141212f},
-std::array<float,2>{0.677050948f, 0.307089329f},
-std::array<float,2>{0.403377563f, 0.709152997f},
-std::array<float,2>{0.930004001f, 0.864926934f},
-std::array<float,2>{0.231230348f, 0.0882407427f},
-std::array<float,2>{0.822357595f, 0.175177187f},
-std::array<float,2>{0.0592038892f, 0.985736072f},
-std::array<float,2>{0.608741403f, 0.606655896f},
-std::array<float,2>{0.320641786f, 0.473081619f},
-std::array<float,2>{0.514656901f, 0.0090113068f},
-std::array<float,2>{0.25372234f, 0.763871491f},
-std::array<float,2>{0.784984052f, 0.673199177f},
-std::array<float,2>{0.106322624f, 0.363203496f},
-std::array<float,2>{0.944060147f, 0.376493484f},
-std::array<float,2>{0.168446273f, 0.50692606f},
-std::array<float,2>{0.697181702f, 0.902104139f},
-std::array<float,2>{0.463437408f, 0.200283185f},
-std::array<float,2>{0.643190622f, 0.479768693f},
-std::array<float,2>{0.433772504f, 0.600067973f},
-std::array<float,2>{0.884946883f, 0.993737102f},
-std::array<float,2>{0.188511476f, 0.184681922f},
-std::array<float,2>{0.871934891f, 0.0848723128f},
-std::array<float,2>{0.027024202f, 0.867749631f},
-std::array<float,2>{0.563099265f, 0.711318731f},
-std::array<float,2>{0.355837107f, 0.297205985f},
-std::array<float,2>{0.532981515f, 0.189898491f},
-std::array<float,2>{0.28147921f, 0.897114277f},
-std::array<float,2>{0.7531991f, 0.513985991f},
-std::array<float,2>{0.0704915449f, 0.388469875f},
-std::array<float,2>{0.984634936f, 0.373779655f},
-std::array<float,2>{0.129094869f, 0.686990321f},
-std::array<float,2>{0.724077046f, 0.750631094f},
-std::array<float,2>{0.469030201f, 0.00270658359f},
-std::array<float,2>{0.599264622f, 0.25297606f},
-std::array<float,2>{0.317302734f, 0.737435281f},
-std::array<float,2>{0.814689875f, 0.826592147f},
-std::array<float,2>{0.0469132811f, 0.116840236f},
-std::array<float,2>{0.924226522f, 0.152511388f},
-std::array<float,2>{0.219743162f, 0.950685799f},
-std::array<float,2>{0.680824757f, 0.563243568f},
-std::array<float,2>{0.396379948f, 0.446800321f},
-std::array<float,2>{0.690346122f, 0.0472970605f},
-std::array<float,2>{0.455889463f, 0.782915294f},
-std::array<float,2>{0.949283302f, 0.642397463f},
-std::array<float,2>{0.160845041f, 0.315791011f},
-std::array<float,2>{0.796364307f, 0.434237599f},
-std::array<float,2>{0.0974113792f, 0.543510258f},
-std::array<float,2>{0.504526138f, 0.914947927f},
-std::array<float,2>{0.258362204f, 0.248028994f},
-std::array<float,2>{0.528064907f, 0.403830469f},
-std::array<float,2>{0.273405999f, 0.519907355f},
-std::array<float,2>{0.800603926f, 0.884060323f},
-std::array<float,2>{0.121320605f, 0.214336067f},
-std::array<float,2>{0.955452859f, 0.019264739f},
-std::array<float,2>{0.183607087f, 0.771992922f},
-std::array<float,2>{0.708416879f, 0.670619667f},
-std::array<float,2>{0.449684918f, 0.344642818f},
-std::array<float,2>{0.667779684f, 0.158632115f},
-std::array<float,2>{0.379322916f, 0.978475094f},
-std::array<float,2>{0.91227752f, 0.611399353f},
-std::array<float,2>{0.248453602f, 0.485530674f},
-std::array<float,2>{0.831454396f, 0.292696893f},
-std::array<float,2>{0.033928331f, 0.701026857f},
-std::array<float,2>{0.611320555f, 0.852375925f},
-std::array<float,2>{0.333303452f, 0.0682604834f},
-std::array<float,2>{0.74854666f, 0.336408794f},
-std::array<float,2>{0.497186571f, 0.629927039f},
-std::array<float,2>{0.977116942f, 0.804524601f},
-std::array<float,2>{0.144487187f, 0.0362256952f},
-std::array<float,2>{0.768823326f, 0.226949096f},
-std::array<float,2>{0.078666769f, 0.924670398f},
-std::array<float,2>{0.555482507f, 0.554075658f},
-std::array<float,2>{0.299649537f, 0.421857357f},
-std::array<float,2>{0.582295835f, 0.0994042456f},
-std::array<float,2>{0.373725295f, 0.831567883f},
-std::array<float,2>{0.855765343f, 0.722708285f},
-std::array<float,2>{0.0131231518f, 0.277316242f},
-std::array<float,2>{0.894600034f, 0.464460075f},
-std::array<float,2>{0.210861936f, 0.59353739f},
-std::array<float,2>{0.632057726f, 0.965057135f},
-std::array<float,2>{0.417710125f, 0.130400524f},
-std::array<float,2>{0.705681145f, 0.437952369f},
-std::array<float,2>{0.448256046f, 0.572676003f},
-std::array<float,2>{0.960097671f, 0.941372931f},
-std::array<float,2>{0.18208009f, 0.14732337f},
-std::array<float,2>{0.801956177f, 0.119614981f},
-std::array<float,2>{0.117628232f, 0.812842369f},
-std::array<float,2>{0.525355816f, 0.742309451f},
-std::array<float,2>{0.267434031f, 0.258330375f},
-std::array<float,2>{0.615285456f, 0.235585719f},
-std::array<float,2>{0.329221904f, 0.911593378f},
-std::array<float,2>{0.833012044f, 0.535965443f},
-std::array<float,2>{0.0385185964f, 0.425294578f},
-std::array<float,2>{0.909924328f, 0.3210136f},
-std::array<float,2>{0.24465692f, 0.651040018f},
-std::array<float,2>{0.67169559f, 0.790775299f},
-std::array<float,2>{0.377306432f, 0.0553669669f},
-std::array<float,2>{0.561761141f, 0.310591668f},
-std::array<float,2>{0.304255158f, 0.705410361f},
-std::array<float,2>{0.770273328f, 0.862184525f},
-std::array<float,2>{0.0820755586f, 0.091442138f},
-std::array<float,2>{0.982186139f, 0.177022576f},
-std::array<float,2>{0.144723341f, 0.990284264f},
-std::array<float,2>{0.742718756f, 0.603291988f},
-std::array<float,2>{0.492335349f, 0.470395356f},
-std::array<float,2>{0.627703667f, 0.0136276884f},
-std::array<float,2>{0.419423342f, 0.760073543f},
-std::array<float,2>{0.892712891f, 0.67770946f},
-std::array<float,2>{0.203609973f, 0.36690554f},
-std::array<float,2>{0.854066372f, 0.380568385f},
-std::array<float,2>{0.0110790832f, 0.501159787f},
-std::array<float,2>{0.581956089f, 0.903933764f},
-std::array<float,2>{0.370392978f, 0.198517621f},
-std::array<float,2>{0.570152819f, 0.410326689f},
-std::array<float,2>{0.355424702f, 0.559360445f},
-std::array<float,2>{0.869783938f, 0.932295561f},
-std::array<float,2>{0.0289059319f, 0.221231297f},
-std::array<float,2>{0.890553415f, 0.0407561921f},
-std::array<float,2>{0.192609176f, 0.807961643f},
-std::array<float,2>{0.646325469f, 0.635662615f},
-std::array<float,2>{0.430125028f, 0.329118699f},
-std::array<float,2>{0.719317555f, 0.13971357f},
-std::array<float,2>{0.473466396f, 0.954801023f},
-std::array<float,2>{0.990953505f, 0.582231045f},
-std::array<float,2>{0.128802374f, 0.45756489f},
-std::array<float,2>{0.755049109f, 0.27092585f},
-std::array<float,2>{0.0758033991f, 0.7328372f},
-std::array<float,2>{0.537192345f, 0.838186264f},
-std::array<float,2>{0.288560599f, 0.106018327f},
-std::array<float,2>{0.686548352f, 0.359351635f},
-std::array<float,2>{0.392600298f, 0.656368494f},
-std::array<float,2>{0.927971423f, 0.774649024f},
-std::array<float,2>{0.226519451f, 0.0275861528f},
-std::array<float,2>{0.816440761f, 0.207762837f},
-std::array<float,2>{0.0544123612f, 0.878889561f},
-std::array<float,2>{0.593976736f, 0.528136134f},
-std::array<float,2>{0.315401495f, 0.395564914f},
-std::array<float,2>{0.501455009f, 0.0726265684f},
-std::array<float,2>{0.263615996f, 0.845517516f},
-std::array<float,2>{0.789569438f, 0.691983104f},
-std::array<float,2>{0.0986535847f, 0.287539691f},
-std::array<float,2>{0.948426127f, 0.493816167f},
-std::array<float,2>{0.157868475f, 0.62247318f},
-std::array<float,2>{0.692861378f, 0.968838811f},
-std::array<float,2>{0.457917869f, 0.166635513f},
-std::array<float,2>{0.653884828f, 0.401631534f},
-std::array<float,2>{0.426493496f, 0.518058538f},
-std::array<float,2>{0.877761662f, 0.888627768f},
-std::array<float,2>{0.196312174f, 0.215541065f},
-std::array<float,2>{0.86449194f, 0.0197313838f},
-std::array<float,2>{0.0182674527f, 0.765929818f},
-std::array<float,2>{0.57405436f, 0.667058051f},
-std::array<float,2>{0.345271766f, 0.351130933f},
-std::array<float,2>{0.542235196f, 0.161319703f},
-std::array<float,2>{0.290691674f, 0.98126477f},
-std::array<float,2>{0.76382941f, 0.616029322f},
-std::array<float,2>{0.0683816522f, 0.49184674f},
-std::array<float,2>{0.995523989f, 0.293965548f},
-std::array<float,2>{0.135244757f, 0.698656738f},
-std::array<float,2>{0.728446603f, 0.855502367f},
-std::array<float,2>{0.48246941f, 0.0652130768f},
-std::array<float,2>{0.604075253f, 0.341619164f},
-std::array<float,2>{0.326547831f, 0.62633872f},
-std::array<float,2>{0.824433744f, 0.800655186f},
-std::array<float,2>{0.0585022978f, 0.0327142328f},
-std::array<float,2>{0.935048044f, 0.233591735f},
-std::array<float,2>{0.228737339f, 0.929252386f},
-std::array<float,2>{0.673196912f, 0.547434449f},
-std::array<float,2>{0.398561329f, 0.414618343f},
-std::array<float,2>{0.70285511f, 0.0973717496f},
-std::array<float,2>{0.467365265f, 0.833014667f},
-std::array<float,2>{0.937729895f, 0.722358882f},
-std::array<float,2>{0.165768653f, 0.279948026f},
-std::array<float,2>{0.78825134f, 0.466747403f},
-std::array<float,2>{0.104595862f, 0.586769819f},
-std::array<float,2>{0.509498954f, 0.962371349f},
-std::array<float,2>{0.257086515f, 0.125138551f},
-std::array<float,2>{0.521704793f, 0.481297016f},
-std::array<float,2>{0.273491323f, 0.5956285f},
-std::array<float,2>{0.805579424f, 0.996915638f},
-std::array<float,2>{0.11231561f, 0.180232495f},
-std::array<float,2>{0.967535317f, 0.079255417f},
-std::array<float,2>{0.17866838f, 0.874199331f},
-std::array<float,2>{0.716341078f, 0.718620777f},
-std::array<float,2>{0.444570303f, 0.304418266f},
-std::array<float,2>{0.660906196f, 0.194487348f},
-std::array<float,2>{0.389887571f, 0.893716156f},
-std::array<float,2>{0.917302966f, 0.509702444f},
-std::array<float,2>{0.238366842f, 0.384861499f},
-std::array<float,2>{0.836328089f, 0.367742777f},
-std::array<float,2>{0.0461167954f, 0.68297255f},
-std::array<float,2>{0.621743143f, 0.757353842f},
-std::array<float,2>{0.339487076f, 0.00658597425f},
-std::array<float,2>{0.737574399f, 0.254400164f},
-std::array<float,2>{0.48843798f, 0.741595268f},
-std::array<float,2>{0.974937737f, 0.822002649f},
-std::array<float,2>{0.154844999f, 0.11195609f},
-std::array<float,2>{0.773439109f, 0.150373906f},
-std::array<float,2>{0.0896504745f, 0.948496044f},
-std::array<float,2>{0.550689518f, 0.566916883f},
-std::array<float,2>{0.306934267f, 0.449510843f},
-std::array<float,2>{0.589803457f, 0.0531158857f},
-std::array<float,2>{0.365668029f, 0.788506806f},
-std::array<float,2>{0.849745929f, 0.648206353f},
-std::array<float,2>{0.000787811237f, 0.317997366f},
-std::array<float,2>{0.901135445f, 0.432165295f},
-std::array<float,2>{0.214231998f, 0.539783001f},
-std::array<float,2>{0.635409117f, 0.919703424f},
-std::array<float,2>{0.411514133f, 0.243624613f},
-std::array<float,2>{0.731890976f, 0.429144382f},
-std::array<float,2>{0.478051096f, 0.533622921f},
-std::array<float,2>{0.999494016f, 0.908372343f},
-std::array<float,2>{0.137003794f, 0.2393668f},
-std::array<float,2>{0.760552526f, 0.0590625405f},
-std::array<float,2>{0.0633549988f, 0.79512471f},
-std::array<float,2>{0.544713974f, 0.655618012f},
-std::array<float,2>{0.294041574f, 0.325683236f},
-std::array<float,2>{0.576262057f, 0.141716197f},
-std::array<float,2>{0.350926876f, 0.943980038f},
-std::array<float,2>{0.86253351f, 0.577471316f},
-std::array<float,2>{0.0230117328f, 0.442682832f},
-std::array<float,2>{0.881361425f, 0.262324989f},
-std::array<float,2>{0.202731714f, 0.747811556f},
-std::array<float,2>{0.650730729f, 0.81745261f},
-std::array<float,2>{0.422564f, 0.122797765f},
-std::array<float,2>{0.513095498f, 0.361987442f},
-std::array<float,2>{0.251024544f, 0.67228514f},
-std::array<float,2>{0.782975018f, 0.7647295f},
-std::array<float,2>{0.107477181f, 0.00793899875f},
-std::array<float,2>{0.942404866f, 0.199414223f},
-std::array<float,2>{0.170304924f, 0.900654674f},
-std::array<float,2>{0.698289931f, 0.506037116f},
-std::array<float,2>{0.462555438f, 0.375008732f},
-std::array<float,2>{0.678365052f, 0.0892174393f},
-std::array<float,2>{0.405679315f, 0.864186585f},
-std::array<float,2>{0.933466434f, 0.71043992f},
-std::array<float,2>{0.23375608f, 0.308235943f},
-std::array<float,2>{0.820428193f, 0.474004745f},
-std::array<float,2>{0.0612446144f, 0.606291771f},
-std::array<float,2>{0.605935574f, 0.984761536f},
-std::array<float,2>{0.323419183f, 0.174473912f},
-std::array<float,2>{0.619046092f, 0.456325293f},
-std::array<float,2>{0.340723157f, 0.58199054f},
-std::array<float,2>{0.843144894f, 0.960113466f},
-std::array<float,2>{0.0418408737f, 0.136587054f},
-std::array<float,2>{0.921586156f, 0.104508996f},
-std::array<float,2>{0.237723038f, 0.840899885f},
-std::array<float,2>{0.658903539f, 0.728603899f},
-std::array<float,2>{0.383037776f, 0.266177893f},
-std::array<float,2>{0.713381827f, 0.225703701f},
-std::array<float,2>{0.439815611f, 0.934072077f},
-std::array<float,2>{0.964310825f, 0.557901382f},
-std::array<float,2>{0.174667895f, 0.409662098f},
-std::array<float,2>{0.811844766f, 0.3336128f},
-std::array<float,2>{0.115225308f, 0.637904704f},
-std::array<float,2>{0.518775523f, 0.809379041f},
-std::array<float,2>{0.278724611f, 0.0466765314f},
-std::array<float,2>{0.638104081f, 0.283438832f},
-std::array<float,2>{0.407687306f, 0.691174388f},
-std::array<float,2>{0.903650582f, 0.850314558f},
-std::array<float,2>{0.218302727f, 0.0776998401f},
-std::array<float,2>{0.846049309f, 0.16818893f},
-std::array<float,2>{0.00717984559f, 0.975603998f},
-std::array<float,2>{0.592746675f, 0.619836688f},
-std::array<float,2>{0.362665921f, 0.499074429f},
-std::array<float,2>{0.551993191f, 0.0247456282f},
-std::array<float,2>{0.31072396f, 0.779390812f},
-std::array<float,2>{0.779670417f, 0.660511672f},
-std::array<float,2>{0.0935295746f, 0.353947729f},
-std::array<float,2>{0.971413791f, 0.393907398f},
-std::array<float,2>{0.149415135f, 0.525376797f},
-std::array<float,2>{0.741637945f, 0.880898297f},
-std::array<float,2>{0.488212466f, 0.204377994f},
-std::array<float,2>{0.664842069f, 0.4851484f},
-std::array<float,2>{0.381248266f, 0.61233443f},
-std::array<float,2>{0.911915779f, 0.976821184f},
-std::array<float,2>{0.247145936f, 0.159354299f},
-std::array<float,2>{0.829939604f, 0.0668815747f},
-std::array<float,2>{0.0330398157f, 0.852948487f},
-std::array<float,2>{0.61175561f, 0.699891269f},
-std::array<float,2>{0.334641844f, 0.291106135f},
-std::array<float,2>{0.531223595f, 0.213448554f},
-std::array<float,2>{0.270880252f, 0.883379817f},
-std::array<float,2>{0.797566295f, 0.521267414f},
-std::array<float,2>{0.123848073f, 0.402586699f},
-std::array<float,2>{0.954732001f, 0.344820887f},
-std::array<float,2>{0.186830908f, 0.671818316f},
-std::array<float,2>{0.70898819f, 0.773333848f},
-std::array<float,2>{0.451978952f, 0.018240612f},
-std::array<float,2>{0.585493088f, 0.27541703f},
-std::array<float,2>{0.372958034f, 0.724251986f},
-std::array<float,2>{0.858752131f, 0.830924511f},
-std::array<float,2>{0.0146642802f, 0.0982937664f},
-std::array<float,2>{0.898011684f, 0.128914893f},
-std::array<float,2>{0.207068697f, 0.965876102f},
-std::array<float,2>{0.630503356f, 0.592696249f},
-std::array<float,2>{0.415070236f, 0.463779688f},
-std::array<float,2>{0.747761011f, 0.0351733267f},
-std::array<float,2>{0.499830842f, 0.803088069f},
-std::array<float,2>{0.979276836f, 0.629000783f},
-std::array<float,2>{0.141471416f, 0.337522328f},
-std::array<float,2>{0.766256988f, 0.420638859f},
-std::array<float,2>{0.0809484124f, 0.55344063f},
-std::array<float,2>{0.55673629f, 0.925505042f},
-std::array<float,2>{0.297330081f, 0.22757794f},
-std::array<float,2>{0.535073876f, 0.38695702f},
-std::array<float,2>{0.283566505f, 0.515527427f},
-std::array<float,2>{0.750186384f, 0.898058951f},
-std::array<float,2>{0.0723599494f, 0.190729022f},
-std::array<float,2>{0.987441361f, 0.00385675952f},
-std::array<float,2>{0.131616056f, 0.751558781f},
-std::array<float,2>{0.725783229f, 0.685811877f},
-std::array<float,2>{0.472095728f, 0.374487996f},
-std::array<float,2>{0.641998768f, 0.184384555f},
-std::array<float,2>{0.436885715f, 0.992795765f},
-std::array<float,2>{0.884542823f, 0.600588024f},
-std::array<float,2>{0.190911412f, 0.47934702f},
-std::array<float,2>{0.874921858f, 0.298157841f},
-std::array<float,2>{0.0242937841f, 0.711975396f},
-std::array<float,2>{0.56630075f, 0.86897701f},
-std::array<float,2>{0.358314365f, 0.0853100866f},
-std::array<float,2>{0.687954903f, 0.314988703f},
-std::array<float,2>{0.454936922f, 0.641515434f},
-std::array<float,2>{0.952321291f, 0.782175064f},
-std::array<float,2>{0.163251191f, 0.0478566289f},
-std::array<float,2>{0.793211758f, 0.246819228f},
-std::array<float,2>{0.095117867f, 0.915564597f},
-std::array<float,2>{0.506917119f, 0.544316053f},
-std::array<float,2>{0.260208905f, 0.435452968f},
-std::array<float,2>{0.601332784f, 0.115849346f},
-std::array<float,2>{0.320160568f, 0.828065336f},
-std::array<float,2>{0.813749433f, 0.73728174f},
-std::array<float,2>{0.0490641035f, 0.252548546f},
-std::array<float,2>{0.923284173f, 0.445336729f},
-std::array<float,2>{0.222429976f, 0.563640296f},
-std::array<float,2>{0.682587445f, 0.949900925f},
-std::array<float,2>{0.397457659f, 0.154243127f},
-std::array<float,2>{0.745041192f, 0.471013367f},
-std::array<float,2>{0.495370656f, 0.605017364f},
-std::array<float,2>{0.982545257f, 0.989272177f},
-std::array<float,2>{0.146867365f, 0.178128093f},
-std::array<float,2>{0.772588849f, 0.0931986496f},
-std::array<float,2>{0.0851414502f, 0.859907091f},
-std::array<float,2>{0.558825076f, 0.703213215f},
-std::array<float,2>{0.302457005f, 0.309436113f},
-std::array<float,2>{0.578729868f, 0.196793005f},
-std::array<float,2>{0.368321985f, 0.905297518f},
-std::array<float,2>{0.853164494f, 0.502094865f},
-std::array<float,2>{0.00807372015f, 0.381238669f},
-std::array<float,2>{0.891468525f, 0.363721907f},
-std::array<float,2>{0.20563522f, 0.677872598f},
-std::array<float,2>{0.625959814f, 0.758659959f},
-std::array<float,2>{0.421129167f, 0.0146764694f},
-std::array<float,2>{0.527199745f, 0.260085046f},
-std::array<float,2>{0.26800254f, 0.744312346f},
-std::array<float,2>{0.802901089f, 0.816330433f},
-std::array<float,2>{0.121068537f, 0.117430717f},
-std::array<float,2>{0.957387567f, 0.146109849f},
-std::array<float,2>{0.180251464f, 0.938421309f},
-std::array<float,2>{0.70431453f, 0.571923375f},
-std::array<float,2>{0.446416318f, 0.439573228f},
-std::array<float,2>{0.668675542f, 0.0567338057f},
-std::array<float,2>{0.375876516f, 0.791560292f},
-std::array<float,2>{0.906480789f, 0.650251746f},
-std::array<float,2>{0.242691353f, 0.323293656f},
-std::array<float,2>{0.835282981f, 0.423143297f},
-std::array<float,2>{0.035542801f, 0.538680434f},
-std::array<float,2>{0.614222884f, 0.912704051f},
-std::array<float,2>{0.331452817f, 0.237331659f},
-std::array<float,2>{0.5970698f, 0.398133427f},
-std::array<float,2>{0.313051879f, 0.53026855f},
-std::array<float,2>{0.81875962f, 0.875938952f},
-std::array<float,2>{0.051744666f, 0.209637657f},
-std::array<float,2>{0.925791204f, 0.0302963033f},
-std::array<float,2>{0.223404422f, 0.775629401f},
-std::array<float,2>{0.68549782f, 0.659841895f},
-std::array<float,2>{0.392254889f, 0.356726676f},
-std::array<float,2>{0.694550216f, 0.164280504f},
-std::array<float,2>{0.460322291f, 0.971225142f},
-std::array<float,2>{0.945648611f, 0.623455048f},
-std::array<float,2>{0.159223184f, 0.49495998f},
-std::array<float,2>{0.79131192f, 0.28657034f},
-std::array<float,2>{0.100694239f, 0.693395495f},
-std::array<float,2>{0.50296545f, 0.846068442f},
-std::array<float,2>{0.264833927f, 0.0708247572f},
-std::array<float,2>{0.64735204f, 0.331405073f},
-std::array<float,2>{0.431719869f, 0.633176267f},
-std::array<float,2>{0.888054609f, 0.805638433f},
-std::array<float,2>{0.193758205f, 0.0423269421f},
-std::array<float,2>{0.867236197f, 0.219692364f},
-std::array<float,2>{0.0298208781f, 0.930414438f},
-std::array<float,2>{0.566839397f, 0.562434733f},
-std::array<float,2>{0.353428781f, 0.413749367f},
-std::array<float,2>{0.535285592f, 0.108756781f},
-std::array<float,2>{0.287010193f, 0.837822795f},
-std::array<float,2>{0.757276475f, 0.731631279f},
-std::array<float,2>{0.0770553797f, 0.272985876f},
-std::array<float,2>{0.989070475f, 0.460286468f},
-std::array<float,2>{0.12562412f, 0.583986938f},
-std::array<float,2>{0.722300112f, 0.955937028f},
-std::array<float,2>{0.475886405f, 0.137223274f},
-std::array<float,2>{0.67442745f, 0.417364419f},
-std::array<float,2>{0.400660068f, 0.549114764f},
-std::array<float,2>{0.935902894f, 0.927560091f},
-std::array<float,2>{0.227473453f, 0.232343286f},
-std::array<float,2>{0.826461136f, 0.0335852243f},
-std::array<float,2>{0.055690527f, 0.797828019f},
-std::array<float,2>{0.602907896f, 0.627448678f},
-std::array<float,2>{0.325336456f, 0.341979593f},
-std::array<float,2>{0.511584759f, 0.127779305f},
-std::array<float,2>{0.254327208f, 0.964268982f},
-std::array<float,2>{0.786704838f, 0.589762032f},
-std::array<float,2>{0.103135929f, 0.467744559f},
-std::array<float,2>{0.940034986f, 0.277688086f},
-std::array<float,2>{0.166932821f, 0.719573021f},
-std::array<float,2>{0.699947119f, 0.834303916f},
-std::array<float,2>{0.466684967f, 0.0943736881f},
-std::array<float,2>{0.571229458f, 0.347684652f},
-std::array<float,2>{0.346437335f, 0.665763378f},
-std::array<float,2>{0.866244793f, 0.76797682f},
-std::array<float,2>{0.0172165018f, 0.0217522364f},
-std::array<float,2>{0.87539655f, 0.218355924f},
-std::array<float,2>{0.198036447f, 0.890070677f},
-std::array<float,2>{0.655864716f, 0.516756713f},
-std::array<float,2>{0.428201079f, 0.398856342f},
-std::array<float,2>{0.728702843f, 0.0642300919f},
-std::array<float,2>{0.481075019f, 0.857697427f},
-std::array<float,2>{0.992928147f, 0.695597231f},
-std::array<float,2>{0.134543791f, 0.29629007f},
-std::array<float,2>{0.762588084f, 0.490193278f},
-std::array<float,2>{0.0683268011f, 0.613438189f},
-std::array<float,2>{0.540139735f, 0.983338177f},
-std::array<float,2>{0.292966813f, 0.163963273f},
-std::array<float,2>{0.547539294f, 0.452417403f},
-std::array<float,2>{0.306007355f, 0.570083559f},
-std::array<float,2>{0.777325273f, 0.94582504f},
-std::array<float,2>{0.0873918459f, 0.152106896f},
-std::array<float,2>{0.973855019f, 0.109606303f},
-std::array<float,2>{0.153677896f, 0.822863758f},
-std::array<float,2>{0.735582352f, 0.738955379f},
-std::array<float,2>{0.491262376f, 0.257545978f},
-std::array<float,2>{0.634042144f, 0.244853169f},
-std::array<float,2>{0.412593812f, 0.920080185f},
-std::array<float,2>{0.899983525f, 0.542220414f},
-std::array<float,2>{0.212008461f, 0.431248993f},
-std::array<float,2>{0.847906053f, 0.320168257f},
-std::array<float,2>{0.00316642062f, 0.64530158f},
-std::array<float,2>{0.587852061f, 0.785491407f},
-std::array<float,2>{0.363593966f, 0.052625604f},
-std::array<float,2>{0.718520939f, 0.301760495f},
-std::array<float,2>{0.442255139f, 0.716645777f},
-std::array<float,2>{0.966316044f, 0.872938931f},
-std::array<float,2>{0.177486628f, 0.0801075548f},
-std::array<float,2>{0.808064461f, 0.181661308f},
-std::array<float,2>{0.110789061f, 0.998573005f},
-std::array<float,2>{0.519682527f, 0.596545577f},
-std::array<float,2>{0.277111173f, 0.482832193f},
-std::array<float,2>{0.623100698f, 0.0054324693f},
-std::array<float,2>{0.337796122f, 0.754971802f},
-std::array<float,2>{0.839090884f, 0.680212021f},
-std::array<float,2>{0.0434979349f, 0.371018052f},
-std::array<float,2>{0.914995849f, 0.382999271f},
-std::array<float,2>{0.242166117f, 0.510429919f},
-std::array<float,2>{0.662786305f, 0.891330242f},
-std::array<float,2>{0.388211787f, 0.192117676f},
-std::array<float,2>{0.696046591f, 0.378677875f},
-std::array<float,2>{0.463981509f, 0.504366398f},
-std::array<float,2>{0.94495362f, 0.898933947f},
-std::array<float,2>{0.169702783f, 0.20161064f},
-std::array<float,2>{0.783709943f, 0.0101210969f},
-std::array<float,2>{0.106742695f, 0.761816323f},
-std::array<float,2>{0.514232576f, 0.673899114f},
-std::array<float,2>{0.252912551f, 0.359719872f},
-std::array<float,2>{0.608151078f, 0.173373699f},
-std::array<float,2>{0.322099656f, 0.986657798f},
-std::array<float,2>{0.824212968f, 0.607714713f},
-std::array<float,2>{0.0599586144f, 0.474661291f},
-std::array<float,2>{0.930687428f, 0.306267828f},
-std::array<float,2>{0.231446385f, 0.708776951f},
-std::array<float,2>{0.676154673f, 0.866020441f},
-std::array<float,2>{0.402610242f, 0.0864251181f},
-std::array<float,2>{0.545998752f, 0.327670366f},
-std::array<float,2>{0.295700312f, 0.652361453f},
-std::array<float,2>{0.758711994f, 0.79458499f},
-std::array<float,2>{0.0644723177f, 0.061960265f},
-std::array<float,2>{0.997577846f, 0.241655543f},
-std::array<float,2>{0.140083283f, 0.907319129f},
-std::array<float,2>{0.733370185f, 0.531684637f},
-std::array<float,2>{0.479835182f, 0.42649436f},
-std::array<float,2>{0.649755836f, 0.123241223f},
-std::array<float,2>{0.42410937f, 0.819827735f},
-std::array<float,2>{0.880045116f, 0.749749303f},
-std::array<float,2>{0.199834585f, 0.265267253f},
-std::array<float,2>{0.860336423f, 0.444210559f},
-std::array<float,2>{0.0196781363f, 0.576147377f},
-std::array<float,2>{0.575080395f, 0.941761971f},
-std::array<float,2>{0.348500252f, 0.143803492f},
-std::array<float,2>{0.591316462f, 0.49768579f},
-std::array<float,2>{0.361071557f, 0.618583381f},
-std::array<float,2>{0.844072342f, 0.973662019f},
-std::array<float,2>{0.00576549349f, 0.170691326f},
-std::array<float,2>{0.905832946f, 0.075813815f},
-std::array<float,2>{0.21614556f, 0.848895013f},
-std::array<float,2>{0.639509261f, 0.687952459f},
-std::array<float,2>{0.408239961f, 0.282084137f},
-std::array<float,2>{0.73906064f, 0.205660209f},
-std::array<float,2>{0.485194325f, 0.880286276f},
-std::array<float,2>{0.970183611f, 0.527307332f},
-std::array<float,2>{0.151648864f, 0.391937166f},
-std::array<float,2>{0.779175699f, 0.352248788f},
-std::array<float,2>{0.0905549675f, 0.66338551f},
-std::array<float,2>{0.553795159f, 0.778213501f},
-std::array<float,2>{0.310030729f, 0.0259435643f},
-std::array<float,2>{0.658123255f, 0.26875934f},
-std::array<float,2>{0.386083871f, 0.727828801f},
-std::array<float,2>{0.919036448f, 0.841884017f},
-std::array<float,2>{0.235351175f, 0.10184139f},
-std::array<float,2>{0.841675997f, 0.134500682f},
-std::array<float,2>{0.0402575471f, 0.95898205f},
-std::array<float,2>{0.620628476f, 0.578369439f},
-std::array<float,2>{0.342172623f, 0.454905719f},
-std::array<float,2>{0.516632974f, 0.0441977121f},
-std::array<float,2>{0.28106758f, 0.81071043f},
-std::array<float,2>{0.80963248f, 0.639231265f},
-std::array<float,2>{0.115273468f, 0.334411532f},
-std::array<float,2>{0.962387979f, 0.407273769f},
-std::array<float,2>{0.173409715f, 0.555790186f},
-std::array<float,2>{0.711428642f, 0.936848581f},
-std::array<float,2>{0.437619478f, 0.223774657f},
-std::array<float,2>{0.631424665f, 0.460956305f},
-std::array<float,2>{0.416163027f, 0.590823293f},
-std::array<float,2>{0.895739913f, 0.967334569f},
-std::array<float,2>{0.209656164f, 0.131201327f},
-std::array<float,2>{0.857267261f, 0.10018491f},
-std::array<float,2>{0.0125416601f, 0.828870416f},
-std::array<float,2>{0.583196104f, 0.725277185f},
-std::array<float,2>{0.374234289f, 0.273969829f},
-std::array<float,2>{0.556451082f, 0.229789004f},
-std::array<float,2>{0.299969256f, 0.922571659f},
-std::array<float,2>{0.768216789f, 0.552213132f},
-std::array<float,2>{0.0793480873f, 0.419416904f},
-std::array<float,2>{0.978171527f, 0.338349015f},
-std::array<float,2>{0.142946422f, 0.632479787f},
-std::array<float,2>{0.749547541f, 0.802606404f},
-std::array<float,2>{0.496404678f, 0.0375008099f},
-std::array<float,2>{0.609447181f, 0.289182156f},
-std::array<float,2>{0.332529634f, 0.702486634f},
-std::array<float,2>{0.830633163f, 0.853737235f},
-std::array<float,2>{0.0348617919f, 0.0684917569f},
-std::array<float,2>{0.913639367f, 0.157546684f},
-std::array<float,2>{0.249305442f, 0.978708923f},
-std::array<float,2>{0.666033745f, 0.610304058f},
-std::array<float,2>{0.379932463f, 0.488126874f},
-std::array<float,2>{0.707484186f, 0.0167152174f},
-std::array<float,2>{0.450458944f, 0.770288169f},
-std::array<float,2>{0.956116974f, 0.668998957f},
-std::array<float,2>{0.184776634f, 0.347093046f},
-std::array<float,2>{0.799616754f, 0.404957503f},
-std::array<float,2>{0.122994661f, 0.522246718f},
-std::array<float,2>{0.529184043f, 0.886474371f},
-std::array<float,2>{0.271960706f, 0.212792009f},
-std::array<float,2>{0.505808592f, 0.436939627f},
-std::array<float,2>{0.259372294f, 0.546164989f},
-std::array<float,2>{0.79566437f, 0.916624844f},
-std::array<float,2>{0.0959388241f, 0.24921453f},
-std::array<float,2>{0.950659275f, 0.0491481051f},
-std::array<float,2>{0.161777183f, 0.78386426f},
-std::array<float,2>{0.691279352f, 0.644074261f},
-std::array<float,2>{0.456090063f, 0.313338399f},
-std::array<float,2>{0.680529952f, 0.154827803f},
-std::array<float,2>{0.395225495f, 0.953074276f},
-std::array<float,2>{0.925443351f, 0.566249073f},
-std::array<float,2>{0.219104037f, 0.448162585f},
-std::array<float,2>{0.815754116f, 0.250220537f},
-std::array<float,2>{0.0482608899f, 0.73580718f},
-std::array<float,2>{0.597895324f, 0.824557543f},
-std::array<float,2>{0.318352669f, 0.113691889f},
-std::array<float,2>{0.722880602f, 0.372555524f},
-std::array<float,2>{0.469873875f, 0.685267925f},
-std::array<float,2>{0.985705554f, 0.7538715f},
-std::array<float,2>{0.129998788f, 0.0011145249f},
-std::array<float,2>{0.752797604f, 0.188604444f},
-std::array<float,2>{0.071315594f, 0.895776868f},
-std::array<float,2>{0.53161335f, 0.513606071f},
-std::array<float,2>{0.282712311f, 0.389889359f},
-std::array<float,2>{0.564124227f, 0.0834258124f},
-std::array<float,2>{0.357102454f, 0.870988607f},
-std::array<float,2>{0.872509658f, 0.71397531f},
-std::array<float,2>{0.0256683882f, 0.298960686f},
-std::array<float,2>{0.886385739f, 0.477668285f},
-std::array<float,2>{0.188467592f, 0.59852916f},
-std::array<float,2>{0.644495726f, 0.994707704f},
-std::array<float,2>{0.434871733f, 0.187374204f}}
\ No newline at end of file
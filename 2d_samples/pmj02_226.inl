@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.778305948f, 0.870693505f},
-std::array<float,2>{0.090935111f, 0.239397019f},
-std::array<float,2>{0.297912717f, 0.627210855f},
-std::array<float,2>{0.713684559f, 0.279631555f},
-std::array<float,2>{0.542224467f, 0.537507057f},
-std::array<float,2>{0.466923177f, 0.380377233f},
-std::array<float,2>{0.229301855f, 0.982843101f},
-std::array<float,2>{0.941872358f, 0.0467180982f},
-std::array<float,2>{0.937326193f, 0.712756038f},
-std::array<float,2>{0.145695508f, 0.369563967f},
-std::array<float,2>{0.422205806f, 0.804384232f},
-std::array<float,2>{0.569575548f, 0.155444399f},
-std::array<float,2>{0.682226181f, 0.888355851f},
-std::array<float,2>{0.328039706f, 0.113071978f},
-std::array<float,2>{0.0274006352f, 0.613052309f},
-std::array<float,2>{0.863302529f, 0.495630145f},
-std::array<float,2>{0.99818778f, 0.942408383f},
-std::array<float,2>{0.194717377f, 0.0275447704f},
-std::array<float,2>{0.485386223f, 0.519077659f},
-std::array<float,2>{0.524752378f, 0.409770399f},
-std::array<float,2>{0.737153769f, 0.676054835f},
-std::array<float,2>{0.262851447f, 0.308054328f},
-std::array<float,2>{0.0944154486f, 0.822230935f},
-std::array<float,2>{0.797073543f, 0.190318748f},
-std::array<float,2>{0.826794207f, 0.57800138f},
-std::array<float,2>{0.0561980866f, 0.454936445f},
-std::array<float,2>{0.355391294f, 0.925231278f},
-std::array<float,2>{0.628923535f, 0.0893531442f},
-std::array<float,2>{0.613981247f, 0.757111251f},
-std::array<float,2>{0.382445723f, 0.179001182f},
-std::array<float,2>{0.179584712f, 0.726403654f},
-std::array<float,2>{0.899487257f, 0.318641186f},
-std::array<float,2>{0.858991981f, 0.921470761f},
-std::array<float,2>{0.00168088172f, 0.0691597536f},
-std::array<float,2>{0.332512468f, 0.589632392f},
-std::array<float,2>{0.671874404f, 0.44217366f},
-std::array<float,2>{0.58379221f, 0.74275142f},
-std::array<float,2>{0.420938998f, 0.336924583f},
-std::array<float,2>{0.127918169f, 0.766516268f},
-std::array<float,2>{0.910712004f, 0.162100583f},
-std::array<float,2>{0.956005335f, 0.501879513f},
-std::array<float,2>{0.247380599f, 0.423784167f},
-std::array<float,2>{0.439849377f, 0.966039956f},
-std::array<float,2>{0.553622425f, 0.00635475013f},
-std::array<float,2>{0.696420252f, 0.83210218f},
-std::array<float,2>{0.285999149f, 0.207694679f},
-std::array<float,2>{0.0758052096f, 0.660611212f},
-std::array<float,2>{0.754710734f, 0.285329431f},
-std::array<float,2>{0.882143795f, 0.781284928f},
-std::array<float,2>{0.162626013f, 0.13254787f},
-std::array<float,2>{0.393948585f, 0.69138056f},
-std::array<float,2>{0.605553389f, 0.354645133f},
-std::array<float,2>{0.650278389f, 0.595474303f},
-std::array<float,2>{0.362175256f, 0.472518593f},
-std::array<float,2>{0.0391045623f, 0.895045042f},
-std::array<float,2>{0.835052133f, 0.105108559f},
-std::array<float,2>{0.79650867f, 0.653133094f},
-std::array<float,2>{0.118554167f, 0.263628095f},
-std::array<float,2>{0.273809671f, 0.844826579f},
-std::array<float,2>{0.730575621f, 0.22329928f},
-std::array<float,2>{0.502271771f, 0.984976768f},
-std::array<float,2>{0.484258175f, 0.0570573546f},
-std::array<float,2>{0.215822294f, 0.55680126f},
-std::array<float,2>{0.982934833f, 0.39653489f},
-std::array<float,2>{0.842798769f, 0.777577221f},
-std::array<float,2>{0.0356661789f, 0.166939139f},
-std::array<float,2>{0.374370068f, 0.734797716f},
-std::array<float,2>{0.645964503f, 0.330284476f},
-std::array<float,2>{0.595599055f, 0.582901299f},
-std::array<float,2>{0.400825709f, 0.452744246f},
-std::array<float,2>{0.167502344f, 0.911107421f},
-std::array<float,2>{0.883489549f, 0.0743282884f},
-std::array<float,2>{0.974286556f, 0.666744292f},
-std::array<float,2>{0.204551563f, 0.289892882f},
-std::array<float,2>{0.475381643f, 0.836340368f},
-std::array<float,2>{0.510580719f, 0.214092925f},
-std::array<float,2>{0.718786001f, 0.954840243f},
-std::array<float,2>{0.272326857f, 0.0112137692f},
-std::array<float,2>{0.111221112f, 0.51180625f},
-std::array<float,2>{0.785540342f, 0.430864692f},
-std::array<float,2>{0.914924979f, 0.899485469f},
-std::array<float,2>{0.135878235f, 0.100243971f},
-std::array<float,2>{0.408150911f, 0.608502865f},
-std::array<float,2>{0.587131798f, 0.483574301f},
-std::array<float,2>{0.659350812f, 0.697777212f},
-std::array<float,2>{0.342634052f, 0.350949109f},
-std::array<float,2>{0.0122343907f, 0.796429932f},
-std::array<float,2>{0.847533703f, 0.14051497f},
-std::array<float,2>{0.764098883f, 0.552316308f},
-std::array<float,2>{0.065076068f, 0.402015686f},
-std::array<float,2>{0.289290279f, 0.995459855f},
-std::array<float,2>{0.691628039f, 0.052372694f},
-std::array<float,2>{0.556305945f, 0.858795106f},
-std::array<float,2>{0.453064382f, 0.232704073f},
-std::array<float,2>{0.23697333f, 0.646268129f},
-std::array<float,2>{0.965644836f, 0.257515371f},
-std::array<float,2>{0.808470011f, 0.969346762f},
-std::array<float,2>{0.102336936f, 0.0353474617f},
-std::array<float,2>{0.256035417f, 0.54607451f},
-std::array<float,2>{0.743928254f, 0.389591724f},
-std::array<float,2>{0.518452823f, 0.639080942f},
-std::array<float,2>{0.499378264f, 0.268936753f},
-std::array<float,2>{0.200052679f, 0.867126822f},
-std::array<float,2>{0.986377299f, 0.246130615f},
-std::array<float,2>{0.891982675f, 0.61799854f},
-std::array<float,2>{0.183627859f, 0.485673904f},
-std::array<float,2>{0.386574358f, 0.876610637f},
-std::array<float,2>{0.620920956f, 0.121503584f},
-std::array<float,2>{0.638341427f, 0.811060727f},
-std::array<float,2>{0.351386428f, 0.144466773f},
-std::array<float,2>{0.0537204109f, 0.705592811f},
-std::array<float,2>{0.816282451f, 0.36662662f},
-std::array<float,2>{0.949100018f, 0.819194138f},
-std::array<float,2>{0.219804093f, 0.199944258f},
-std::array<float,2>{0.455192953f, 0.68743372f},
-std::array<float,2>{0.531399071f, 0.301227152f},
-std::array<float,2>{0.710671782f, 0.523487151f},
-std::array<float,2>{0.309938699f, 0.419096947f},
-std::array<float,2>{0.0788927078f, 0.948134005f},
-std::array<float,2>{0.767481744f, 0.0221039467f},
-std::array<float,2>{0.868801117f, 0.733011127f},
-std::array<float,2>{0.0174954664f, 0.326790929f},
-std::array<float,2>{0.318448156f, 0.75793004f},
-std::array<float,2>{0.67483145f, 0.181849927f},
-std::array<float,2>{0.577476442f, 0.936522603f},
-std::array<float,2>{0.433551788f, 0.0794122815f},
-std::array<float,2>{0.151974484f, 0.564647019f},
-std::array<float,2>{0.922225356f, 0.468093842f},
-std::array<float,2>{0.782534301f, 0.799903929f},
-std::array<float,2>{0.115388796f, 0.150357023f},
-std::array<float,2>{0.26863724f, 0.717542052f},
-std::array<float,2>{0.722754359f, 0.371110439f},
-std::array<float,2>{0.514581144f, 0.613302827f},
-std::array<float,2>{0.471310645f, 0.497329354f},
-std::array<float,2>{0.208358735f, 0.88413924f},
-std::array<float,2>{0.970704377f, 0.115909785f},
-std::array<float,2>{0.889174461f, 0.629316986f},
-std::array<float,2>{0.168170303f, 0.274809569f},
-std::array<float,2>{0.405664474f, 0.871558607f},
-std::array<float,2>{0.598865032f, 0.236646861f},
-std::array<float,2>{0.642638147f, 0.980036974f},
-std::array<float,2>{0.369159698f, 0.0396640189f},
-std::array<float,2>{0.0350110382f, 0.53172034f},
-std::array<float,2>{0.837790489f, 0.377799451f},
-std::array<float,2>{0.964118063f, 0.926372111f},
-std::array<float,2>{0.241139263f, 0.0908795819f},
-std::array<float,2>{0.446362883f, 0.572142124f},
-std::array<float,2>{0.562212527f, 0.457901686f},
-std::array<float,2>{0.690473676f, 0.719486296f},
-std::array<float,2>{0.29425019f, 0.315601051f},
-std::array<float,2>{0.0696262345f, 0.752064884f},
-std::array<float,2>{0.758841991f, 0.174089462f},
-std::array<float,2>{0.849611878f, 0.519923627f},
-std::array<float,2>{0.0111408802f, 0.412833214f},
-std::array<float,2>{0.337395847f, 0.940248013f},
-std::array<float,2>{0.660772264f, 0.0258507114f},
-std::array<float,2>{0.592968106f, 0.825125098f},
-std::array<float,2>{0.410338551f, 0.191911221f},
-std::array<float,2>{0.138020903f, 0.672373772f},
-std::array<float,2>{0.918245435f, 0.310950488f},
-std::array<float,2>{0.820037305f, 0.962906659f},
-std::array<float,2>{0.0474415459f, 0.00025934531f},
-std::array<float,2>{0.346601546f, 0.506147444f},
-std::array<float,2>{0.635429144f, 0.426400214f},
-std::array<float,2>{0.622451067f, 0.656853795f},
-std::array<float,2>{0.389870912f, 0.283166885f},
-std::array<float,2>{0.180034176f, 0.829290509f},
-std::array<float,2>{0.896896005f, 0.204450712f},
-std::array<float,2>{0.990616679f, 0.590925932f},
-std::array<float,2>{0.197177067f, 0.438712448f},
-std::array<float,2>{0.495876998f, 0.91565603f},
-std::array<float,2>{0.520016193f, 0.0641347915f},
-std::array<float,2>{0.747994661f, 0.770595014f},
-std::array<float,2>{0.253152102f, 0.157455042f},
-std::array<float,2>{0.108945943f, 0.748873293f},
-std::array<float,2>{0.808624148f, 0.342141688f},
-std::array<float,2>{0.927868426f, 0.851440012f},
-std::array<float,2>{0.153237879f, 0.221622437f},
-std::array<float,2>{0.436030805f, 0.651321352f},
-std::array<float,2>{0.57316196f, 0.260359794f},
-std::array<float,2>{0.679630578f, 0.560389042f},
-std::array<float,2>{0.316129535f, 0.392586172f},
-std::array<float,2>{0.021757571f, 0.990178406f},
-std::array<float,2>{0.874786794f, 0.0594893619f},
-std::array<float,2>{0.770308971f, 0.694607019f},
-std::array<float,2>{0.0837574378f, 0.358715534f},
-std::array<float,2>{0.307494134f, 0.787442863f},
-std::array<float,2>{0.70590812f, 0.128026724f},
-std::array<float,2>{0.538593054f, 0.893757403f},
-std::array<float,2>{0.459303766f, 0.108404204f},
-std::array<float,2>{0.224478409f, 0.600673258f},
-std::array<float,2>{0.950315475f, 0.476101935f},
-std::array<float,2>{0.862696171f, 0.840020537f},
-std::array<float,2>{0.0257630143f, 0.216336131f},
-std::array<float,2>{0.323518425f, 0.669795275f},
-std::array<float,2>{0.686945975f, 0.293675333f},
-std::array<float,2>{0.564476013f, 0.508286417f},
-std::array<float,2>{0.426894605f, 0.434301317f},
-std::array<float,2>{0.144026235f, 0.957446694f},
-std::array<float,2>{0.931018472f, 0.0119648231f},
-std::array<float,2>{0.938109338f, 0.740525186f},
-std::array<float,2>{0.230976209f, 0.334012419f},
-std::array<float,2>{0.461440414f, 0.773774862f},
-std::array<float,2>{0.5453462f, 0.171156332f},
-std::array<float,2>{0.718046606f, 0.907407284f},
-std::array<float,2>{0.302951366f, 0.0735062212f},
-std::array<float,2>{0.0895265564f, 0.578721046f},
-std::array<float,2>{0.775125384f, 0.447559595f},
-std::array<float,2>{0.904555738f, 0.996295035f},
-std::array<float,2>{0.174989402f, 0.0490260087f},
-std::array<float,2>{0.375202835f, 0.548918128f},
-std::array<float,2>{0.6110183f, 0.403616071f},
-std::array<float,2>{0.626396894f, 0.641771376f},
-std::array<float,2>{0.355479151f, 0.252978414f},
-std::array<float,2>{0.0607663244f, 0.853584409f},
-std::array<float,2>{0.820990682f, 0.227811769f},
-std::array<float,2>{0.801195025f, 0.604985356f},
-std::array<float,2>{0.098311834f, 0.478267521f},
-std::array<float,2>{0.259845674f, 0.904782176f},
-std::array<float,2>{0.741389453f, 0.0960655287f},
-std::array<float,2>{0.530542314f, 0.792794406f},
-std::array<float,2>{0.49140048f, 0.132986069f},
-std::array<float,2>{0.1886345f, 0.702151358f},
-std::array<float,2>{0.995380938f, 0.346048206f},
-std::array<float,2>{0.752839148f, 0.879175842f},
-std::array<float,2>{0.0728602037f, 0.118043095f},
-std::array<float,2>{0.281495929f, 0.622268856f},
-std::array<float,2>{0.701469958f, 0.490349263f},
-std::array<float,2>{0.547533929f, 0.710377753f},
-std::array<float,2>{0.443143457f, 0.361868322f},
-std::array<float,2>{0.242493883f, 0.804967642f},
-std::array<float,2>{0.957881689f, 0.145277187f},
-std::array<float,2>{0.907260597f, 0.539746046f},
-std::array<float,2>{0.130650342f, 0.384748131f},
-std::array<float,2>{0.416956991f, 0.973743498f},
-std::array<float,2>{0.58198446f, 0.0325639211f},
-std::array<float,2>{0.665938139f, 0.862011373f},
-std::array<float,2>{0.330346435f, 0.244087011f},
-std::array<float,2>{0.00740007078f, 0.63617903f},
-std::array<float,2>{0.853298306f, 0.271884352f},
-std::array<float,2>{0.977021754f, 0.761830688f},
-std::array<float,2>{0.21123977f, 0.185126886f},
-std::array<float,2>{0.478709698f, 0.727613151f},
-std::array<float,2>{0.504299581f, 0.323841602f},
-std::array<float,2>{0.727229178f, 0.568984389f},
-std::array<float,2>{0.278042018f, 0.462516367f},
-std::array<float,2>{0.121863894f, 0.932700992f},
-std::array<float,2>{0.790754855f, 0.0839447677f},
-std::array<float,2>{0.829313695f, 0.68282336f},
-std::array<float,2>{0.0457169078f, 0.299999088f},
-std::array<float,2>{0.36653322f, 0.814067423f},
-std::array<float,2>{0.652589083f, 0.198062837f},
-std::array<float,2>{0.605043292f, 0.952546895f},
-std::array<float,2>{0.395657331f, 0.0176199153f},
-std::array<float,2>{0.157950118f, 0.530325174f},
-std::array<float,2>{0.876002669f, 0.417917073f},
-std::array<float,2>{0.799285769f, 0.823112726f},
-std::array<float,2>{0.0962520838f, 0.189069822f},
-std::array<float,2>{0.264775246f, 0.678391397f},
-std::array<float,2>{0.734428883f, 0.305158466f},
-std::array<float,2>{0.526963115f, 0.516055584f},
-std::array<float,2>{0.486565173f, 0.407249719f},
-std::array<float,2>{0.193138778f, 0.944802761f},
-std::array<float,2>{0.997337997f, 0.0308919679f},
-std::array<float,2>{0.901669741f, 0.723172665f},
-std::array<float,2>{0.177486971f, 0.317212939f},
-std::array<float,2>{0.379959106f, 0.754227877f},
-std::array<float,2>{0.617074609f, 0.175847605f},
-std::array<float,2>{0.632332623f, 0.922613084f},
-std::array<float,2>{0.353411764f, 0.0874793753f},
-std::array<float,2>{0.0572376288f, 0.574593782f},
-std::array<float,2>{0.824310482f, 0.456269979f},
-std::array<float,2>{0.944883883f, 0.981802881f},
-std::array<float,2>{0.227298513f, 0.0441180207f},
-std::array<float,2>{0.466536313f, 0.535597861f},
-std::array<float,2>{0.539482951f, 0.381101429f},
-std::array<float,2>{0.711929858f, 0.625890493f},
-std::array<float,2>{0.299835801f, 0.278732479f},
-std::array<float,2>{0.0925494581f, 0.868748248f},
-std::array<float,2>{0.779891253f, 0.240338892f},
-std::array<float,2>{0.866267562f, 0.609559953f},
-std::array<float,2>{0.0311972052f, 0.493301392f},
-std::array<float,2>{0.324403077f, 0.889448702f},
-std::array<float,2>{0.681020021f, 0.110224523f},
-std::array<float,2>{0.567216992f, 0.801540196f},
-std::array<float,2>{0.425622135f, 0.153074116f},
-std::array<float,2>{0.147202492f, 0.71339488f},
-std::array<float,2>{0.93387121f, 0.368431717f},
-std::array<float,2>{0.832816362f, 0.897098899f},
-std::array<float,2>{0.0421873555f, 0.102050625f},
-std::array<float,2>{0.361130208f, 0.596220136f},
-std::array<float,2>{0.650731802f, 0.469889969f},
-std::array<float,2>{0.608300805f, 0.688196301f},
-std::array<float,2>{0.391271919f, 0.353037894f},
-std::array<float,2>{0.161382303f, 0.783463001f},
-std::array<float,2>{0.879068196f, 0.129144996f},
-std::array<float,2>{0.98144263f, 0.555003345f},
-std::array<float,2>{0.218469858f, 0.396013796f},
-std::array<float,2>{0.481891513f, 0.987603366f},
-std::array<float,2>{0.501206994f, 0.0550697781f},
-std::array<float,2>{0.732652962f, 0.847081959f},
-std::array<float,2>{0.27709195f, 0.225582376f},
-std::array<float,2>{0.120312475f, 0.655551076f},
-std::array<float,2>{0.793500006f, 0.264475346f},
-std::array<float,2>{0.913129628f, 0.769042552f},
-std::array<float,2>{0.125304207f, 0.162583113f},
-std::array<float,2>{0.419574261f, 0.745710075f},
-std::array<float,2>{0.585093796f, 0.337946028f},
-std::array<float,2>{0.668382764f, 0.586309314f},
-std::array<float,2>{0.335485876f, 0.444392979f},
-std::array<float,2>{0.00296634785f, 0.919503927f},
-std::array<float,2>{0.855988324f, 0.0674761608f},
-std::array<float,2>{0.756477416f, 0.662329137f},
-std::array<float,2>{0.0768119693f, 0.288233399f},
-std::array<float,2>{0.28716886f, 0.835139275f},
-std::array<float,2>{0.697464406f, 0.209144995f},
-std::array<float,2>{0.55204463f, 0.967978597f},
-std::array<float,2>{0.438679308f, 0.0049073142f},
-std::array<float,2>{0.249943525f, 0.502650023f},
-std::array<float,2>{0.954744041f, 0.423947573f},
-std::array<float,2>{0.844810128f, 0.793242157f},
-std::array<float,2>{0.0138167031f, 0.137997687f},
-std::array<float,2>{0.341145635f, 0.697045982f},
-std::array<float,2>{0.657105148f, 0.348400056f},
-std::array<float,2>{0.589306653f, 0.606125236f},
-std::array<float,2>{0.409176558f, 0.481406659f},
-std::array<float,2>{0.133663133f, 0.901457608f},
-std::array<float,2>{0.916915834f, 0.098784633f},
-std::array<float,2>{0.968471229f, 0.647523344f},
-std::array<float,2>{0.235994935f, 0.254278392f},
-std::array<float,2>{0.450327009f, 0.856036723f},
-std::array<float,2>{0.556899607f, 0.232243642f},
-std::array<float,2>{0.694236457f, 0.992427588f},
-std::array<float,2>{0.291859865f, 0.0540303811f},
-std::array<float,2>{0.0627942383f, 0.553177178f},
-std::array<float,2>{0.763148844f, 0.39943552f},
-std::array<float,2>{0.885255158f, 0.913662851f},
-std::array<float,2>{0.16520977f, 0.0762155429f},
-std::array<float,2>{0.399983197f, 0.584079027f},
-std::array<float,2>{0.596939743f, 0.450082392f},
-std::array<float,2>{0.646628559f, 0.737486899f},
-std::array<float,2>{0.372384161f, 0.328180879f},
-std::array<float,2>{0.0381287187f, 0.780175149f},
-std::array<float,2>{0.840950131f, 0.165989116f},
-std::array<float,2>{0.788497686f, 0.513759375f},
-std::array<float,2>{0.11309506f, 0.432509482f},
-std::array<float,2>{0.271472663f, 0.956111789f},
-std::array<float,2>{0.721030653f, 0.00852886029f},
-std::array<float,2>{0.509280145f, 0.838057458f},
-std::array<float,2>{0.473543465f, 0.212192446f},
-std::array<float,2>{0.206890836f, 0.664580882f},
-std::array<float,2>{0.975243986f, 0.29281047f},
-std::array<float,2>{0.768017471f, 0.945569873f},
-std::array<float,2>{0.0809376091f, 0.0211709552f},
-std::array<float,2>{0.311772734f, 0.527031362f},
-std::array<float,2>{0.708351254f, 0.421469659f},
-std::array<float,2>{0.534809887f, 0.684167504f},
-std::array<float,2>{0.454778463f, 0.302915215f},
-std::array<float,2>{0.222148314f, 0.816540599f},
-std::array<float,2>{0.946475208f, 0.201565877f},
-std::array<float,2>{0.924736202f, 0.563374162f},
-std::array<float,2>{0.148973584f, 0.466662198f},
-std::array<float,2>{0.429701805f, 0.934473395f},
-std::array<float,2>{0.575752795f, 0.0802243277f},
-std::array<float,2>{0.672570527f, 0.760586143f},
-std::array<float,2>{0.3175565f, 0.181343779f},
-std::array<float,2>{0.018177947f, 0.73144871f},
-std::array<float,2>{0.87086612f, 0.325181067f},
-std::array<float,2>{0.98599273f, 0.864451647f},
-std::array<float,2>{0.202072099f, 0.24929513f},
-std::array<float,2>{0.496900201f, 0.638577402f},
-std::array<float,2>{0.516728222f, 0.267201513f},
-std::array<float,2>{0.745533586f, 0.54439646f},
-std::array<float,2>{0.255213082f, 0.386752427f},
-std::array<float,2>{0.104265608f, 0.970786452f},
-std::array<float,2>{0.804915905f, 0.0387029015f},
-std::array<float,2>{0.813327074f, 0.70421499f},
-std::array<float,2>{0.05147833f, 0.364408672f},
-std::array<float,2>{0.348078251f, 0.810251594f},
-std::array<float,2>{0.639647365f, 0.140906483f},
-std::array<float,2>{0.618323088f, 0.878255725f},
-std::array<float,2>{0.384746313f, 0.124539383f},
-std::array<float,2>{0.185974658f, 0.620355546f},
-std::array<float,2>{0.893994093f, 0.486845315f},
-std::array<float,2>{0.760964572f, 0.751733661f},
-std::array<float,2>{0.0664302409f, 0.173763946f},
-std::array<float,2>{0.296188802f, 0.72072655f},
-std::array<float,2>{0.688577294f, 0.313447654f},
-std::array<float,2>{0.560121477f, 0.572296023f},
-std::array<float,2>{0.448369533f, 0.459838808f},
-std::array<float,2>{0.239615619f, 0.928192675f},
-std::array<float,2>{0.962801933f, 0.0931043923f},
-std::array<float,2>{0.920556843f, 0.674594939f},
-std::array<float,2>{0.139913499f, 0.309777707f},
-std::array<float,2>{0.412300467f, 0.826439977f},
-std::array<float,2>{0.590796888f, 0.194643185f},
-std::array<float,2>{0.66273272f, 0.937828839f},
-std::array<float,2>{0.338837713f, 0.0239542089f},
-std::array<float,2>{0.00847464241f, 0.52317214f},
-std::array<float,2>{0.847825468f, 0.410542309f},
-std::array<float,2>{0.970330298f, 0.886193037f},
-std::array<float,2>{0.209474221f, 0.114044085f},
-std::array<float,2>{0.469908357f, 0.616204381f},
-std::array<float,2>{0.512518823f, 0.49943009f},
-std::array<float,2>{0.7264359f, 0.716518044f},
-std::array<float,2>{0.266117513f, 0.374417007f},
-std::array<float,2>{0.113846317f, 0.798338652f},
-std::array<float,2>{0.785102427f, 0.151493162f},
-std::array<float,2>{0.839423716f, 0.53471303f},
-std::array<float,2>{0.031334158f, 0.376300067f},
-std::array<float,2>{0.368230551f, 0.978296936f},
-std::array<float,2>{0.641902804f, 0.0427034386f},
-std::array<float,2>{0.600821137f, 0.874144316f},
-std::array<float,2>{0.403527737f, 0.236046135f},
-std::array<float,2>{0.170208797f, 0.631344378f},
-std::array<float,2>{0.887370408f, 0.276960373f},
-std::array<float,2>{0.872322261f, 0.99177146f},
-std::array<float,2>{0.0214447826f, 0.061219085f},
-std::array<float,2>{0.31360805f, 0.560823321f},
-std::array<float,2>{0.675991237f, 0.391900152f},
-std::array<float,2>{0.571087837f, 0.648441672f},
-std::array<float,2>{0.435408384f, 0.259549528f},
-std::array<float,2>{0.155219555f, 0.847687483f},
-std::array<float,2>{0.926651657f, 0.219090447f},
-std::array<float,2>{0.951247096f, 0.599428236f},
-std::array<float,2>{0.225999862f, 0.473160237f},
-std::array<float,2>{0.457798362f, 0.891993761f},
-std::array<float,2>{0.535731852f, 0.106130853f},
-std::array<float,2>{0.704673409f, 0.786152303f},
-std::array<float,2>{0.30641371f, 0.126409635f},
-std::array<float,2>{0.0849222019f, 0.692623019f},
-std::array<float,2>{0.773183882f, 0.356547952f},
-std::array<float,2>{0.895018756f, 0.830933154f},
-std::array<float,2>{0.183471248f, 0.206187561f},
-std::array<float,2>{0.386948198f, 0.65982455f},
-std::array<float,2>{0.624154806f, 0.284750283f},
-std::array<float,2>{0.632913351f, 0.504629612f},
-std::array<float,2>{0.345024645f, 0.429065049f},
-std::array<float,2>{0.0504954904f, 0.962884128f},
-std::array<float,2>{0.817103207f, 0.00368991191f},
-std::array<float,2>{0.811291039f, 0.747187436f},
-std::array<float,2>{0.106142379f, 0.341501266f},
-std::array<float,2>{0.251732051f, 0.771663427f},
-std::array<float,2>{0.749360383f, 0.15841803f},
-std::array<float,2>{0.522812307f, 0.917157114f},
-std::array<float,2>{0.493965238f, 0.0657430589f},
-std::array<float,2>{0.197878346f, 0.592225373f},
-std::array<float,2>{0.99011004f, 0.440103352f},
-std::array<float,2>{0.823834717f, 0.852662623f},
-std::array<float,2>{0.0605310947f, 0.229764611f},
-std::array<float,2>{0.359143794f, 0.643061221f},
-std::array<float,2>{0.627904117f, 0.251135737f},
-std::array<float,2>{0.611718237f, 0.548178971f},
-std::array<float,2>{0.378687888f, 0.405755579f},
-std::array<float,2>{0.17283456f, 0.998886287f},
-std::array<float,2>{0.902470112f, 0.0472101495f},
-std::array<float,2>{0.993120611f, 0.70020467f},
-std::array<float,2>{0.190603569f, 0.345187455f},
-std::array<float,2>{0.489849567f, 0.790113091f},
-std::array<float,2>{0.528262436f, 0.135728762f},
-std::array<float,2>{0.740043104f, 0.904219151f},
-std::array<float,2>{0.258374035f, 0.0946227685f},
-std::array<float,2>{0.0999779999f, 0.602836668f},
-std::array<float,2>{0.804163694f, 0.479379773f},
-std::array<float,2>{0.932125747f, 0.959807158f},
-std::array<float,2>{0.14111872f, 0.0138182687f},
-std::array<float,2>{0.427937657f, 0.511216819f},
-std::array<float,2>{0.562776327f, 0.43557319f},
-std::array<float,2>{0.6847471f, 0.670040905f},
-std::array<float,2>{0.322004944f, 0.296319485f},
-std::array<float,2>{0.023976054f, 0.843328834f},
-std::array<float,2>{0.859376252f, 0.217603192f},
-std::array<float,2>{0.777098238f, 0.580304563f},
-std::array<float,2>{0.0872270092f, 0.446380258f},
-std::array<float,2>{0.300881982f, 0.908460975f},
-std::array<float,2>{0.715883017f, 0.0718145445f},
-std::array<float,2>{0.543801904f, 0.776565433f},
-std::array<float,2>{0.464076877f, 0.168884456f},
-std::array<float,2>{0.23269856f, 0.739528358f},
-std::array<float,2>{0.939705074f, 0.333536953f},
-std::array<float,2>{0.792205095f, 0.930015564f},
-std::array<float,2>{0.123231016f, 0.0852909237f},
-std::array<float,2>{0.279955685f, 0.567881882f},
-std::array<float,2>{0.73011446f, 0.464007139f},
-std::array<float,2>{0.506150365f, 0.729990244f},
-std::array<float,2>{0.476687133f, 0.321450025f},
-std::array<float,2>{0.213086352f, 0.7650581f},
-std::array<float,2>{0.980240881f, 0.186596259f},
-std::array<float,2>{0.878341019f, 0.527704895f},
-std::array<float,2>{0.160038963f, 0.414649993f},
-std::array<float,2>{0.397362202f, 0.950069129f},
-std::array<float,2>{0.602464974f, 0.0161606409f},
-std::array<float,2>{0.655881345f, 0.815076888f},
-std::array<float,2>{0.364823163f, 0.1961319f},
-std::array<float,2>{0.043544367f, 0.681396127f},
-std::array<float,2>{0.830330849f, 0.297931254f},
-std::array<float,2>{0.960485756f, 0.808042169f},
-std::array<float,2>{0.244569242f, 0.146839708f},
-std::array<float,2>{0.445081741f, 0.708911717f},
-std::array<float,2>{0.549488127f, 0.360452741f},
-std::array<float,2>{0.700204194f, 0.624437094f},
-std::array<float,2>{0.283533663f, 0.489397764f},
-std::array<float,2>{0.0715275407f, 0.881849349f},
-std::array<float,2>{0.750227451f, 0.120384112f},
-std::array<float,2>{0.854292393f, 0.632969975f},
-std::array<float,2>{0.0050270441f, 0.270040184f},
-std::array<float,2>{0.328474283f, 0.861038446f},
-std::array<float,2>{0.666468501f, 0.244311616f},
-std::array<float,2>{0.579427183f, 0.974838972f},
-std::array<float,2>{0.414066166f, 0.0342361927f},
-std::array<float,2>{0.131317928f, 0.541781902f},
-std::array<float,2>{0.909865558f, 0.386163443f},
-std::array<float,2>{0.754929721f, 0.83403033f},
-std::array<float,2>{0.0750053301f, 0.210024893f},
-std::array<float,2>{0.286718637f, 0.663760662f},
-std::array<float,2>{0.695879221f, 0.28767094f},
-std::array<float,2>{0.553947568f, 0.503386438f},
-std::array<float,2>{0.441379368f, 0.425111562f},
-std::array<float,2>{0.246927917f, 0.966879129f},
-std::array<float,2>{0.956092238f, 0.00393339712f},
-std::array<float,2>{0.911853194f, 0.744900942f},
-std::array<float,2>{0.128480479f, 0.339770913f},
-std::array<float,2>{0.420773476f, 0.767697871f},
-std::array<float,2>{0.582275391f, 0.163968891f},
-std::array<float,2>{0.670700252f, 0.91845113f},
-std::array<float,2>{0.333164066f, 0.0673169047f},
-std::array<float,2>{0.000364571577f, 0.587208867f},
-std::array<float,2>{0.858280241f, 0.444297403f},
-std::array<float,2>{0.98362112f, 0.986830592f},
-std::array<float,2>{0.215513706f, 0.0562483296f},
-std::array<float,2>{0.482642293f, 0.555929601f},
-std::array<float,2>{0.503258467f, 0.39529267f},
-std::array<float,2>{0.732032299f, 0.655108571f},
-std::array<float,2>{0.275367111f, 0.265493006f},
-std::array<float,2>{0.117405273f, 0.845894217f},
-std::array<float,2>{0.795474172f, 0.225764349f},
-std::array<float,2>{0.83434242f, 0.597228467f},
-std::array<float,2>{0.0404297486f, 0.468870729f},
-std::array<float,2>{0.362324625f, 0.897776306f},
-std::array<float,2>{0.648447692f, 0.103251889f},
-std::array<float,2>{0.607293248f, 0.784544528f},
-std::array<float,2>{0.392922878f, 0.130625024f},
-std::array<float,2>{0.163723052f, 0.688758016f},
-std::array<float,2>{0.881654441f, 0.351987958f},
-std::array<float,2>{0.86451149f, 0.890434146f},
-std::array<float,2>{0.0288227741f, 0.111068398f},
-std::array<float,2>{0.326987118f, 0.610660017f},
-std::array<float,2>{0.683083594f, 0.492954701f},
-std::array<float,2>{0.568729162f, 0.714357436f},
-std::array<float,2>{0.423576206f, 0.367709845f},
-std::array<float,2>{0.144760057f, 0.802519143f},
-std::array<float,2>{0.936114132f, 0.154068649f},
-std::array<float,2>{0.942945778f, 0.53642565f},
-std::array<float,2>{0.230423555f, 0.382308006f},
-std::array<float,2>{0.468460172f, 0.98073405f},
-std::array<float,2>{0.5417068f, 0.0439208746f},
-std::array<float,2>{0.714328349f, 0.867446244f},
-std::array<float,2>{0.297426313f, 0.241827875f},
-std::array<float,2>{0.0907893106f, 0.626855731f},
-std::array<float,2>{0.778803468f, 0.277435601f},
-std::array<float,2>{0.898963094f, 0.755807936f},
-std::array<float,2>{0.178554133f, 0.17745766f},
-std::array<float,2>{0.381664097f, 0.724593759f},
-std::array<float,2>{0.614721596f, 0.317767888f},
-std::array<float,2>{0.630054653f, 0.575300217f},
-std::array<float,2>{0.354446083f, 0.455139041f},
-std::array<float,2>{0.0549183413f, 0.92336607f},
-std::array<float,2>{0.828018665f, 0.0867039859f},
-std::array<float,2>{0.798326492f, 0.679653704f},
-std::array<float,2>{0.0949689895f, 0.305831552f},
-std::array<float,2>{0.26202032f, 0.823658526f},
-std::array<float,2>{0.737653255f, 0.187936172f},
-std::array<float,2>{0.524037659f, 0.94401747f},
-std::array<float,2>{0.485256553f, 0.0298884418f},
-std::array<float,2>{0.193802983f, 0.51723969f},
-std::array<float,2>{0.999236286f, 0.406711936f},
-std::array<float,2>{0.815371156f, 0.809029818f},
-std::array<float,2>{0.0534060001f, 0.142473862f},
-std::array<float,2>{0.349681765f, 0.703874528f},
-std::array<float,2>{0.636868894f, 0.36332801f},
-std::array<float,2>{0.61948216f, 0.620060086f},
-std::array<float,2>{0.385205597f, 0.488034606f},
-std::array<float,2>{0.184742227f, 0.877834558f},
-std::array<float,2>{0.891182184f, 0.123411693f},
-std::array<float,2>{0.987754107f, 0.637176991f},
-std::array<float,2>{0.20048058f, 0.265721738f},
-std::array<float,2>{0.49835214f, 0.864236712f},
-std::array<float,2>{0.518619955f, 0.248761088f},
-std::array<float,2>{0.74241972f, 0.972086966f},
-std::array<float,2>{0.257407784f, 0.0373110175f},
-std::array<float,2>{0.102995202f, 0.543341339f},
-std::array<float,2>{0.80682379f, 0.388514072f},
-std::array<float,2>{0.923708439f, 0.935537815f},
-std::array<float,2>{0.150571004f, 0.0812210068f},
-std::array<float,2>{0.432115555f, 0.563549161f},
-std::array<float,2>{0.576280892f, 0.46488291f},
-std::array<float,2>{0.674121737f, 0.73104322f},
-std::array<float,2>{0.319569588f, 0.325215846f},
-std::array<float,2>{0.0159923118f, 0.761461198f},
-std::array<float,2>{0.867586374f, 0.179987282f},
-std::array<float,2>{0.765764594f, 0.525618494f},
-std::array<float,2>{0.0799323916f, 0.420310676f},
-std::array<float,2>{0.308704138f, 0.946533084f},
-std::array<float,2>{0.709778607f, 0.0200808495f},
-std::array<float,2>{0.532921195f, 0.818042397f},
-std::array<float,2>{0.456810445f, 0.202314258f},
-std::array<float,2>{0.219297424f, 0.685175776f},
-std::array<float,2>{0.947599828f, 0.304290414f},
-std::array<float,2>{0.786553264f, 0.955542803f},
-std::array<float,2>{0.109655835f, 0.00970672723f},
-std::array<float,2>{0.272500515f, 0.515357375f},
-std::array<float,2>{0.720517278f, 0.433529466f},
-std::array<float,2>{0.511489868f, 0.665199578f},
-std::array<float,2>{0.475688517f, 0.291471779f},
-std::array<float,2>{0.20386973f, 0.839418888f},
-std::array<float,2>{0.972816706f, 0.211850986f},
-std::array<float,2>{0.884509921f, 0.585331142f},
-std::array<float,2>{0.166365758f, 0.450612336f},
-std::array<float,2>{0.402056128f, 0.912460387f},
-std::array<float,2>{0.59387213f, 0.0773568377f},
-std::array<float,2>{0.644673705f, 0.78108871f},
-std::array<float,2>{0.373829752f, 0.16463837f},
-std::array<float,2>{0.0364795513f, 0.736909986f},
-std::array<float,2>{0.84255451f, 0.329620242f},
-std::array<float,2>{0.966090858f, 0.856699765f},
-std::array<float,2>{0.237663612f, 0.230837911f},
-std::array<float,2>{0.452023447f, 0.647371411f},
-std::array<float,2>{0.555446267f, 0.255057931f},
-std::array<float,2>{0.692845285f, 0.553783119f},
-std::array<float,2>{0.290083528f, 0.398718655f},
-std::array<float,2>{0.0662480295f, 0.993920684f},
-std::array<float,2>{0.765581429f, 0.0528024025f},
-std::array<float,2>{0.845734298f, 0.695826828f},
-std::array<float,2>{0.0131911356f, 0.348642677f},
-std::array<float,2>{0.343140662f, 0.794755936f},
-std::array<float,2>{0.65825969f, 0.137511536f},
-std::array<float,2>{0.586580217f, 0.90058744f},
-std::array<float,2>{0.406958222f, 0.0977753252f},
-std::array<float,2>{0.135307267f, 0.607126296f},
-std::array<float,2>{0.91516912f, 0.481513351f},
-std::array<float,2>{0.809948087f, 0.772926748f},
-std::array<float,2>{0.107962847f, 0.16000244f},
-std::array<float,2>{0.252464235f, 0.746487379f},
-std::array<float,2>{0.746311903f, 0.340374887f},
-std::array<float,2>{0.521114588f, 0.593394756f},
-std::array<float,2>{0.494473368f, 0.441185147f},
-std::array<float,2>{0.195956364f, 0.91672492f},
-std::array<float,2>{0.991317809f, 0.064916119f},
-std::array<float,2>{0.898294032f, 0.658536553f},
-std::array<float,2>{0.18154417f, 0.283276916f},
-std::array<float,2>{0.389544487f, 0.831492126f},
-std::array<float,2>{0.621111453f, 0.205730468f},
-std::array<float,2>{0.636133909f, 0.961298585f},
-std::array<float,2>{0.347560793f, 0.00258077634f},
-std::array<float,2>{0.0481826998f, 0.504975617f},
-std::array<float,2>{0.81900382f, 0.428130001f},
-std::array<float,2>{0.949589491f, 0.891319275f},
-std::array<float,2>{0.223062605f, 0.106934659f},
-std::array<float,2>{0.460854173f, 0.598521233f},
-std::array<float,2>{0.538050711f, 0.47411859f},
-std::array<float,2>{0.70672363f, 0.692113638f},
-std::array<float,2>{0.308273196f, 0.356374085f},
-std::array<float,2>{0.0823182911f, 0.785226464f},
-std::array<float,2>{0.771469176f, 0.125251845f},
-std::array<float,2>{0.873821676f, 0.561561167f},
-std::array<float,2>{0.023356583f, 0.39107132f},
-std::array<float,2>{0.315306723f, 0.991114914f},
-std::array<float,2>{0.678678274f, 0.0617219135f},
-std::array<float,2>{0.57378155f, 0.849339306f},
-std::array<float,2>{0.437058091f, 0.219846517f},
-std::array<float,2>{0.154088438f, 0.650168896f},
-std::array<float,2>{0.929006219f, 0.258265048f},
-std::array<float,2>{0.836043537f, 0.97711134f},
-std::array<float,2>{0.0338342264f, 0.0417315364f},
-std::array<float,2>{0.370439291f, 0.533439755f},
-std::array<float,2>{0.644376755f, 0.375276774f},
-std::array<float,2>{0.598421335f, 0.632308066f},
-std::array<float,2>{0.404921532f, 0.276153177f},
-std::array<float,2>{0.16917403f, 0.873109877f},
-std::array<float,2>{0.889940202f, 0.234783143f},
-std::array<float,2>{0.972489297f, 0.616998792f},
-std::array<float,2>{0.208004802f, 0.49853912f},
-std::array<float,2>{0.472408861f, 0.885126293f},
-std::array<float,2>{0.515389979f, 0.115115918f},
-std::array<float,2>{0.724189162f, 0.797502518f},
-std::array<float,2>{0.267803431f, 0.150502264f},
-std::array<float,2>{0.116874054f, 0.715679407f},
-std::array<float,2>{0.781615257f, 0.373225778f},
-std::array<float,2>{0.919110239f, 0.827630401f},
-std::array<float,2>{0.137222633f, 0.193520799f},
-std::array<float,2>{0.412063956f, 0.674946725f},
-std::array<float,2>{0.591980815f, 0.308852583f},
-std::array<float,2>{0.661132812f, 0.522424936f},
-std::array<float,2>{0.335954368f, 0.411964744f},
-std::array<float,2>{0.00997186825f, 0.938632607f},
-std::array<float,2>{0.851304531f, 0.0247217026f},
-std::array<float,2>{0.758563399f, 0.722210109f},
-std::array<float,2>{0.0687386245f, 0.313494653f},
-std::array<float,2>{0.293536335f, 0.750426173f},
-std::array<float,2>{0.689515948f, 0.172651932f},
-std::array<float,2>{0.560891867f, 0.929451585f},
-std::array<float,2>{0.445944786f, 0.0927604064f},
-std::array<float,2>{0.241862163f, 0.574055433f},
-std::array<float,2>{0.963774741f, 0.460208327f},
-std::array<float,2>{0.85168457f, 0.85999912f},
-std::array<float,2>{0.00672127027f, 0.245531917f},
-std::array<float,2>{0.331740052f, 0.634401739f},
-std::array<float,2>{0.664800763f, 0.27142936f},
-std::array<float,2>{0.580238223f, 0.542425931f},
-std::array<float,2>{0.417238623f, 0.385434002f},
-std::array<float,2>{0.129744977f, 0.97626543f},
-std::array<float,2>{0.906702399f, 0.0337833166f},
-std::array<float,2>{0.958543837f, 0.707963526f},
-std::array<float,2>{0.243308395f, 0.359927833f},
-std::array<float,2>{0.441968352f, 0.806881487f},
-std::array<float,2>{0.54857105f, 0.147735819f},
-std::array<float,2>{0.70222801f, 0.881502748f},
-std::array<float,2>{0.282256484f, 0.119551599f},
-std::array<float,2>{0.0732726008f, 0.623853147f},
-std::array<float,2>{0.753674567f, 0.489127189f},
-std::array<float,2>{0.875736058f, 0.950215399f},
-std::array<float,2>{0.156855136f, 0.0168428216f},
-std::array<float,2>{0.395349652f, 0.528613865f},
-std::array<float,2>{0.604443371f, 0.4160119f},
-std::array<float,2>{0.654246151f, 0.680057287f},
-std::array<float,2>{0.365794867f, 0.297746211f},
-std::array<float,2>{0.0467753895f, 0.816380322f},
-std::array<float,2>{0.828220606f, 0.196927607f},
-std::array<float,2>{0.789850056f, 0.566414177f},
-std::array<float,2>{0.122385368f, 0.463604957f},
-std::array<float,2>{0.279076934f, 0.931408286f},
-std::array<float,2>{0.728134692f, 0.0848379657f},
-std::array<float,2>{0.505732119f, 0.764612675f},
-std::array<float,2>{0.480314672f, 0.186461076f},
-std::array<float,2>{0.212803662f, 0.728736579f},
-std::array<float,2>{0.978068113f, 0.320680499f},
-std::array<float,2>{0.774118721f, 0.909852684f},
-std::array<float,2>{0.0881852731f, 0.0712528974f},
-std::array<float,2>{0.30419156f, 0.581174731f},
-std::array<float,2>{0.717384279f, 0.445854127f},
-std::array<float,2>{0.546449602f, 0.738806546f},
-std::array<float,2>{0.461996734f, 0.332968414f},
-std::array<float,2>{0.232255444f, 0.776262164f},
-std::array<float,2>{0.938987255f, 0.168967888f},
-std::array<float,2>{0.93046093f, 0.51004678f},
-std::array<float,2>{0.143075272f, 0.436651051f},
-std::array<float,2>{0.426757753f, 0.960023403f},
-std::array<float,2>{0.566077232f, 0.0154999252f},
-std::array<float,2>{0.685688555f, 0.841937721f},
-std::array<float,2>{0.322401434f, 0.21874471f},
-std::array<float,2>{0.0272603743f, 0.671859264f},
-std::array<float,2>{0.861973345f, 0.29585579f},
-std::array<float,2>{0.994710922f, 0.789553285f},
-std::array<float,2>{0.187891543f, 0.136687919f},
-std::array<float,2>{0.491019517f, 0.699228466f},
-std::array<float,2>{0.529542983f, 0.34396264f},
-std::array<float,2>{0.741110921f, 0.601804733f},
-std::array<float,2>{0.261500746f, 0.479766071f},
-std::array<float,2>{0.0988008678f, 0.903032601f},
-std::array<float,2>{0.802535772f, 0.0947864726f},
-std::array<float,2>{0.821808279f, 0.643854737f},
-std::array<float,2>{0.062269371f, 0.250171959f},
-std::array<float,2>{0.357154369f, 0.852291584f},
-std::array<float,2>{0.625759065f, 0.228930622f},
-std::array<float,2>{0.610326529f, 0.999495745f},
-std::array<float,2>{0.376776189f, 0.0483425818f},
-std::array<float,2>{0.174652293f, 0.547197223f},
-std::array<float,2>{0.905379772f, 0.405056596f},
-std::array<float,2>{0.793977499f, 0.843844593f},
-std::array<float,2>{0.11920464f, 0.224201173f},
-std::array<float,2>{0.276176274f, 0.653894961f},
-std::array<float,2>{0.733953178f, 0.262664646f},
-std::array<float,2>{0.500891685f, 0.557670534f},
-std::array<float,2>{0.481207877f, 0.398278862f},
-std::array<float,2>{0.21764943f, 0.986270905f},
-std::array<float,2>{0.982328832f, 0.0583984889f},
-std::array<float,2>{0.879927039f, 0.690162539f},
-std::array<float,2>{0.160326064f, 0.353972316f},
-std::array<float,2>{0.391612679f, 0.782567322f},
-std::array<float,2>{0.609068513f, 0.130941913f},
-std::array<float,2>{0.651726544f, 0.896364808f},
-std::array<float,2>{0.360315442f, 0.103786677f},
-std::array<float,2>{0.0410359316f, 0.594406068f},
-std::array<float,2>{0.833391309f, 0.471592486f},
-std::array<float,2>{0.95346278f, 0.965053976f},
-std::array<float,2>{0.248366579f, 0.00753671443f},
-std::array<float,2>{0.438429981f, 0.500413537f},
-std::array<float,2>{0.551327467f, 0.422794044f},
-std::array<float,2>{0.698754132f, 0.661227107f},
-std::array<float,2>{0.28811866f, 0.286286116f},
-std::array<float,2>{0.0778329149f, 0.833444178f},
-std::array<float,2>{0.757809579f, 0.208839655f},
-std::array<float,2>{0.856888056f, 0.587937534f},
-std::array<float,2>{0.00289569469f, 0.442774177f},
-std::array<float,2>{0.33481133f, 0.920025885f},
-std::array<float,2>{0.66961813f, 0.0700094998f},
-std::array<float,2>{0.584418476f, 0.767365932f},
-std::array<float,2>{0.418461382f, 0.160559043f},
-std::array<float,2>{0.126036704f, 0.744117141f},
-std::array<float,2>{0.912425458f, 0.336897075f},
-std::array<float,2>{0.82547009f, 0.924779415f},
-std::array<float,2>{0.0576323047f, 0.0887443423f},
-std::array<float,2>{0.352391303f, 0.576578856f},
-std::array<float,2>{0.631223321f, 0.454028487f},
-std::array<float,2>{0.616094887f, 0.725584269f},
-std::array<float,2>{0.379233986f, 0.31943658f},
-std::array<float,2>{0.176552355f, 0.75600636f},
-std::array<float,2>{0.90042758f, 0.178638488f},
-std::array<float,2>{0.996409118f, 0.517739415f},
-std::array<float,2>{0.191559434f, 0.408809155f},
-std::array<float,2>{0.488227785f, 0.94220835f},
-std::array<float,2>{0.525604844f, 0.0283305142f},
-std::array<float,2>{0.735892951f, 0.820697129f},
-std::array<float,2>{0.263934344f, 0.190830901f},
-std::array<float,2>{0.0971001014f, 0.677681148f},
-std::array<float,2>{0.800552249f, 0.307532549f},
-std::array<float,2>{0.934804201f, 0.803326607f},
-std::array<float,2>{0.147844344f, 0.155004621f},
-std::array<float,2>{0.424399287f, 0.711223423f},
-std::array<float,2>{0.56760174f, 0.370222479f},
-std::array<float,2>{0.679754257f, 0.61139518f},
-std::array<float,2>{0.325386524f, 0.49436745f},
-std::array<float,2>{0.0301557537f, 0.887623549f},
-std::array<float,2>{0.865666449f, 0.111392863f},
-std::array<float,2>{0.781005561f, 0.628423929f},
-std::array<float,2>{0.0930771753f, 0.280538887f},
-std::array<float,2>{0.299442202f, 0.869958937f},
-std::array<float,2>{0.711211503f, 0.238887787f},
-std::array<float,2>{0.540115833f, 0.984307528f},
-std::array<float,2>{0.464918137f, 0.0452545285f},
-std::array<float,2>{0.228302971f, 0.538636565f},
-std::array<float,2>{0.943401456f, 0.379479796f},
-std::array<float,2>{0.869916379f, 0.758799314f},
-std::array<float,2>{0.0189980809f, 0.183168828f},
-std::array<float,2>{0.317244053f, 0.734140813f},
-std::array<float,2>{0.673769057f, 0.327397496f},
-std::array<float,2>{0.575028598f, 0.566035271f},
-std::array<float,2>{0.431553006f, 0.467408001f},
-std::array<float,2>{0.149928302f, 0.936774015f},
-std::array<float,2>{0.925476909f, 0.0785779804f},
-std::array<float,2>{0.945855975f, 0.686183691f},
-std::array<float,2>{0.220740914f, 0.30222711f},
-std::array<float,2>{0.453689873f, 0.820100486f},
-std::array<float,2>{0.533931315f, 0.200347051f},
-std::array<float,2>{0.707893968f, 0.949159563f},
-std::array<float,2>{0.310889721f, 0.0231080391f},
-std::array<float,2>{0.081902042f, 0.525220454f},
-std::array<float,2>{0.769076943f, 0.417977571f},
-std::array<float,2>{0.892715335f, 0.875667155f},
-std::array<float,2>{0.187383831f, 0.122684665f},
-std::array<float,2>{0.38306722f, 0.618552148f},
-std::array<float,2>{0.617420673f, 0.485104561f},
-std::array<float,2>{0.640340745f, 0.706401885f},
-std::array<float,2>{0.349396884f, 0.365354896f},
-std::array<float,2>{0.0519135967f, 0.812337697f},
-std::array<float,2>{0.814058185f, 0.143496111f},
-std::array<float,2>{0.805795312f, 0.545618236f},
-std::array<float,2>{0.105346695f, 0.389922142f},
-std::array<float,2>{0.254071355f, 0.970293999f},
-std::array<float,2>{0.744410276f, 0.0370320231f},
-std::array<float,2>{0.516071856f, 0.866142035f},
-std::array<float,2>{0.497237355f, 0.247391343f},
-std::array<float,2>{0.202329651f, 0.639798462f},
-std::array<float,2>{0.985291779f, 0.267922491f},
-std::array<float,2>{0.76224333f, 0.994736373f},
-std::array<float,2>{0.0635598376f, 0.0515087359f},
-std::array<float,2>{0.292642742f, 0.551065207f},
-std::array<float,2>{0.695208013f, 0.400548995f},
-std::array<float,2>{0.557714581f, 0.644686699f},
-std::array<float,2>{0.449745446f, 0.2558887f},
-std::array<float,2>{0.234761402f, 0.85761559f},
-std::array<float,2>{0.967582345f, 0.233757719f},
-std::array<float,2>{0.917054355f, 0.607903063f},
-std::array<float,2>{0.134326279f, 0.482448518f},
-std::array<float,2>{0.409808695f, 0.898943543f},
-std::array<float,2>{0.588063776f, 0.100600973f},
-std::array<float,2>{0.65775919f, 0.795405328f},
-std::array<float,2>{0.340694845f, 0.139491677f},
-std::array<float,2>{0.0150001384f, 0.698579013f},
-std::array<float,2>{0.844242454f, 0.349661022f},
-std::array<float,2>{0.976190507f, 0.837312639f},
-std::array<float,2>{0.205308333f, 0.21380803f},
-std::array<float,2>{0.4745965f, 0.667151332f},
-std::array<float,2>{0.508035064f, 0.290855825f},
-std::array<float,2>{0.722452998f, 0.513447881f},
-std::array<float,2>{0.269901872f, 0.429972261f},
-std::array<float,2>{0.112154908f, 0.953619003f},
-std::array<float,2>{0.787269354f, 0.0104659293f},
-std::array<float,2>{0.840442896f, 0.736285865f},
-std::array<float,2>{0.03787091f, 0.332022816f},
-std::array<float,2>{0.371756315f, 0.778501332f},
-std::array<float,2>{0.647568464f, 0.167250052f},
-std::array<float,2>{0.595713258f, 0.912035048f},
-std::array<float,2>{0.399070293f, 0.0759785846f},
-std::array<float,2>{0.164274111f, 0.58348757f},
-std::array<float,2>{0.88660574f, 0.451196492f},
-std::array<float,2>{0.772019148f, 0.788431466f},
-std::array<float,2>{0.0855233818f, 0.127913907f},
-std::array<float,2>{0.305569708f, 0.693871737f},
-std::array<float,2>{0.703267455f, 0.357794583f},
-std::array<float,2>{0.536731541f, 0.600066245f},
-std::array<float,2>{0.458481461f, 0.47545585f},
-std::array<float,2>{0.225170299f, 0.89308393f},
-std::array<float,2>{0.953014672f, 0.108378932f},
-std::array<float,2>{0.927004516f, 0.651374161f},
-std::array<float,2>{0.155447081f, 0.261495084f},
-std::array<float,2>{0.434388608f, 0.850160658f},
-std::array<float,2>{0.571547687f, 0.221687943f},
-std::array<float,2>{0.676896274f, 0.988338709f},
-std::array<float,2>{0.312515914f, 0.0597156398f},
-std::array<float,2>{0.0197910871f, 0.558804154f},
-std::array<float,2>{0.871511161f, 0.394167006f},
-std::array<float,2>{0.988589048f, 0.914953232f},
-std::array<float,2>{0.199053735f, 0.0633434802f},
-std::array<float,2>{0.492887706f, 0.590345979f},
-std::array<float,2>{0.522388637f, 0.438103706f},
-std::array<float,2>{0.748588145f, 0.749927759f},
-std::array<float,2>{0.250222623f, 0.343501627f},
-std::array<float,2>{0.106874749f, 0.770342052f},
-std::array<float,2>{0.811797798f, 0.156340063f},
-std::array<float,2>{0.817480743f, 0.507093847f},
-std::array<float,2>{0.0492455475f, 0.42738831f},
-std::array<float,2>{0.343769908f, 0.96453321f},
-std::array<float,2>{0.633968055f, 0.00186652725f},
-std::array<float,2>{0.623751879f, 0.828534782f},
-std::array<float,2>{0.388629973f, 0.203822508f},
-std::array<float,2>{0.182197943f, 0.657824516f},
-std::array<float,2>{0.895989299f, 0.28177169f},
-std::array<float,2>{0.84890753f, 0.940541148f},
-std::array<float,2>{0.00908409245f, 0.0271746237f},
-std::array<float,2>{0.339049906f, 0.521075666f},
-std::array<float,2>{0.663621724f, 0.413310051f},
-std::array<float,2>{0.591744244f, 0.672994971f},
-std::array<float,2>{0.413774192f, 0.311823696f},
-std::array<float,2>{0.138720989f, 0.826017737f},
-std::array<float,2>{0.921213627f, 0.193119437f},
-std::array<float,2>{0.960983574f, 0.570644736f},
-std::array<float,2>{0.239106268f, 0.458275408f},
-std::array<float,2>{0.447493404f, 0.92693007f},
-std::array<float,2>{0.558936894f, 0.0901223645f},
-std::array<float,2>{0.6884588f, 0.753223896f},
-std::array<float,2>{0.295037359f, 0.175089091f},
-std::array<float,2>{0.0677023232f, 0.719903231f},
-std::array<float,2>{0.760111988f, 0.314795792f},
-std::array<float,2>{0.88773185f, 0.872753203f},
-std::array<float,2>{0.171705902f, 0.237908483f},
-std::array<float,2>{0.402627677f, 0.630462408f},
-std::array<float,2>{0.59972465f, 0.273563206f},
-std::array<float,2>{0.640923321f, 0.532248676f},
-std::array<float,2>{0.367426753f, 0.378847808f},
-std::array<float,2>{0.0325025618f, 0.978844941f},
-std::array<float,2>{0.838833272f, 0.0409958288f},
-std::array<float,2>{0.784127116f, 0.71869123f},
-std::array<float,2>{0.114764757f, 0.372924328f},
-std::array<float,2>{0.267152995f, 0.799125552f},
-std::array<float,2>{0.725490689f, 0.149183452f},
-std::array<float,2>{0.512854815f, 0.882869244f},
-std::array<float,2>{0.469134122f, 0.116705887f},
-std::array<float,2>{0.210374832f, 0.614499927f},
-std::array<float,2>{0.968939483f, 0.496186972f},
-std::array<float,2>{0.831197083f, 0.812591672f},
-std::array<float,2>{0.0445375219f, 0.198796809f},
-std::array<float,2>{0.364210486f, 0.682485402f},
-std::array<float,2>{0.65469873f, 0.299095809f},
-std::array<float,2>{0.602929175f, 0.53015542f},
-std::array<float,2>{0.398076028f, 0.416610032f},
-std::array<float,2>{0.158445925f, 0.951744854f},
-std::array<float,2>{0.877911687f, 0.0193217751f},
-std::array<float,2>{0.979382873f, 0.727053165f},
-std::array<float,2>{0.214087099f, 0.32243222f},
-std::array<float,2>{0.478422821f, 0.763049603f},
-std::array<float,2>{0.50751245f, 0.183679193f},
-std::array<float,2>{0.729344189f, 0.931968629f},
-std::array<float,2>{0.280953705f, 0.0825509205f},
-std::array<float,2>{0.124251664f, 0.569932282f},
-std::array<float,2>{0.791642249f, 0.461491287f},
-std::array<float,2>{0.908620358f, 0.97268033f},
-std::array<float,2>{0.132786945f, 0.0313684531f},
-std::array<float,2>{0.415274829f, 0.540979207f},
-std::array<float,2>{0.578813076f, 0.383013636f},
-std::array<float,2>{0.667007565f, 0.635124326f},
-std::array<float,2>{0.329183966f, 0.272922516f},
-std::array<float,2>{0.004275396f, 0.86251992f},
-std::array<float,2>{0.854615331f, 0.243086383f},
-std::array<float,2>{0.751365185f, 0.62137574f},
-std::array<float,2>{0.0705866888f, 0.491244078f},
-std::array<float,2>{0.28419283f, 0.880108774f},
-std::array<float,2>{0.699965119f, 0.118457511f},
-std::array<float,2>{0.550125539f, 0.805851042f},
-std::array<float,2>{0.444155276f, 0.146367297f},
-std::array<float,2>{0.245283946f, 0.709772885f},
-std::array<float,2>{0.959427238f, 0.362708122f},
-std::array<float,2>{0.802783489f, 0.905532002f},
-std::array<float,2>{0.101239882f, 0.0971287191f},
-std::array<float,2>{0.259488076f, 0.604233742f},
-std::array<float,2>{0.739081442f, 0.476861954f},
-std::array<float,2>{0.528744221f, 0.701682508f},
-std::array<float,2>{0.489223242f, 0.346995503f},
-std::array<float,2>{0.189806506f, 0.791125596f},
-std::array<float,2>{0.993366539f, 0.13425298f},
-std::array<float,2>{0.903892398f, 0.54982233f},
-std::array<float,2>{0.173815489f, 0.402933836f},
-std::array<float,2>{0.377683073f, 0.997472584f},
-std::array<float,2>{0.613013804f, 0.0503447689f},
-std::array<float,2>{0.628039598f, 0.854819834f},
-std::array<float,2>{0.358133733f, 0.226766169f},
-std::array<float,2>{0.0590120181f, 0.641312599f},
-std::array<float,2>{0.822397888f, 0.251959234f},
-std::array<float,2>{0.941284001f, 0.775328815f},
-std::array<float,2>{0.234128058f, 0.170166165f},
-std::array<float,2>{0.463544428f, 0.741366088f},
-std::array<float,2>{0.544318497f, 0.335286796f},
-std::array<float,2>{0.715336561f, 0.579226077f},
-std::array<float,2>{0.301865608f, 0.448886693f},
-std::array<float,2>{0.0862379074f, 0.906610668f},
-std::array<float,2>{0.776001394f, 0.0723124295f},
-std::array<float,2>{0.861257255f, 0.668454766f},
-std::array<float,2>{0.0245677084f, 0.294528186f},
-std::array<float,2>{0.320505738f, 0.841432273f},
-std::array<float,2>{0.684358835f, 0.215430558f},
-std::array<float,2>{0.564141452f, 0.958778977f},
-std::array<float,2>{0.428990513f, 0.0130069135f},
-std::array<float,2>{0.142238677f, 0.509674668f},
-std::array<float,2>{0.932995319f, 0.435513526f},
-std::array<float,2>{0.764903545f, 0.857957602f},
-std::array<float,2>{0.0656034052f, 0.233899832f},
-std::array<float,2>{0.290659904f, 0.64523524f},
-std::array<float,2>{0.692906141f, 0.256705195f},
-std::array<float,2>{0.555106521f, 0.551523328f},
-std::array<float,2>{0.451216459f, 0.400948912f},
-std::array<float,2>{0.238021508f, 0.994461417f},
-std::array<float,2>{0.966387212f, 0.0508715697f},
-std::array<float,2>{0.915742397f, 0.699047148f},
-std::array<float,2>{0.134998277f, 0.350267023f},
-std::array<float,2>{0.406415552f, 0.795822501f},
-std::array<float,2>{0.586013734f, 0.138850063f},
-std::array<float,2>{0.658869922f, 0.898768663f},
-std::array<float,2>{0.343535811f, 0.101514213f},
-std::array<float,2>{0.0131696286f, 0.607991993f},
-std::array<float,2>{0.846195996f, 0.483215421f},
-std::array<float,2>{0.973299921f, 0.953565478f},
-std::array<float,2>{0.203223199f, 0.00991741382f},
-std::array<float,2>{0.476397932f, 0.513056636f},
-std::array<float,2>{0.511153281f, 0.430470884f},
-std::array<float,2>{0.720072567f, 0.667858362f},
-std::array<float,2>{0.272986799f, 0.290221661f},
-std::array<float,2>{0.110159069f, 0.837621152f},
-std::array<float,2>{0.786842346f, 0.213239804f},
-std::array<float,2>{0.841809928f, 0.583623886f},
-std::array<float,2>{0.036661353f, 0.451841265f},
-std::array<float,2>{0.373244703f, 0.911357105f},
-std::array<float,2>{0.645270765f, 0.075415656f},
-std::array<float,2>{0.594291747f, 0.779188216f},
-std::array<float,2>{0.401375175f, 0.167651415f},
-std::array<float,2>{0.166741893f, 0.735399127f},
-std::array<float,2>{0.883814335f, 0.331405371f},
-std::array<float,2>{0.868079245f, 0.937292159f},
-std::array<float,2>{0.0162498318f, 0.079001449f},
-std::array<float,2>{0.319884509f, 0.565825999f},
-std::array<float,2>{0.67466265f, 0.466818511f},
-std::array<float,2>{0.576693118f, 0.733800352f},
-std::array<float,2>{0.432145029f, 0.328108728f},
-std::array<float,2>{0.151161626f, 0.759641647f},
-std::array<float,2>{0.923254907f, 0.182864398f},
-std::array<float,2>{0.947891712f, 0.524850309f},
-std::array<float,2>{0.218830988f, 0.418631822f},
-std::array<float,2>{0.456328154f, 0.948242247f},
-std::array<float,2>{0.532684982f, 0.0227117985f},
-std::array<float,2>{0.709121108f, 0.819493473f},
-std::array<float,2>{0.309521437f, 0.200798154f},
-std::array<float,2>{0.0795497745f, 0.685996532f},
-std::array<float,2>{0.766572237f, 0.302343547f},
-std::array<float,2>{0.890763402f, 0.811867058f},
-std::array<float,2>{0.185448021f, 0.142656773f},
-std::array<float,2>{0.385431677f, 0.706875443f},
-std::array<float,2>{0.619790316f, 0.365748495f},
-std::array<float,2>{0.637678623f, 0.618843913f},
-std::array<float,2>{0.350577652f, 0.48470521f},
-std::array<float,2>{0.0527373105f, 0.875286281f},
-std::array<float,2>{0.814780116f, 0.122557551f},
-std::array<float,2>{0.807546794f, 0.640385866f},
-std::array<float,2>{0.103229366f, 0.268448472f},
-std::array<float,2>{0.257321596f, 0.865423083f},
-std::array<float,2>{0.743010998f, 0.247572631f},
-std::array<float,2>{0.519394636f, 0.969996929f},
-std::array<float,2>{0.498785645f, 0.0363955162f},
-std::array<float,2>{0.200695097f, 0.545268178f},
-std::array<float,2>{0.988149643f, 0.390250951f},
-std::array<float,2>{0.827445805f, 0.756657302f},
-std::array<float,2>{0.0553076677f, 0.178030059f},
-std::array<float,2>{0.35387826f, 0.724791706f},
-std::array<float,2>{0.630730033f, 0.320126414f},
-std::array<float,2>{0.615185559f, 0.576849699f},
-std::array<float,2>{0.381213814f, 0.453175128f},
-std::array<float,2>{0.177837849f, 0.924165189f},
-std::array<float,2>{0.898805261f, 0.0883043557f},
-std::array<float,2>{0.999911368f, 0.677060187f},
-std::array<float,2>{0.194154441f, 0.306653529f},
-std::array<float,2>{0.484851509f, 0.82110858f},
-std::array<float,2>{0.523516893f, 0.19107008f},
-std::array<float,2>{0.738071978f, 0.941500247f},
-std::array<float,2>{0.262665272f, 0.0288289748f},
-std::array<float,2>{0.0952373594f, 0.518485367f},
-std::array<float,2>{0.798700392f, 0.408254862f},
-std::array<float,2>{0.935547829f, 0.887094676f},
-std::array<float,2>{0.14547354f, 0.112290628f},
-std::array<float,2>{0.423294961f, 0.612263024f},
-std::array<float,2>{0.568869174f, 0.494863927f},
-std::array<float,2>{0.683456838f, 0.711675406f},
-std::array<float,2>{0.326238722f, 0.370977372f},
-std::array<float,2>{0.0287677385f, 0.802978516f},
-std::array<float,2>{0.864890337f, 0.154528394f},
-std::array<float,2>{0.779244483f, 0.538500786f},
-std::array<float,2>{0.0900543928f, 0.379156053f},
-std::array<float,2>{0.296876431f, 0.983475804f},
-std::array<float,2>{0.714610875f, 0.0455877595f},
-std::array<float,2>{0.54122436f, 0.869471788f},
-std::array<float,2>{0.468216538f, 0.238696992f},
-std::array<float,2>{0.229714274f, 0.62821424f},
-std::array<float,2>{0.94243902f, 0.281029254f},
-std::array<float,2>{0.794941068f, 0.985733807f},
-std::array<float,2>{0.11809843f, 0.0578768887f},
-std::array<float,2>{0.274643719f, 0.558270991f},
-std::array<float,2>{0.731476128f, 0.397677243f},
-std::array<float,2>{0.503455341f, 0.65336895f},
-std::array<float,2>{0.482991934f, 0.261789471f},
-std::array<float,2>{0.215286523f, 0.844339728f},
-std::array<float,2>{0.984073162f, 0.223707974f},
-std::array<float,2>{0.881000757f, 0.593956828f},
-std::array<float,2>{0.163092583f, 0.470783949f},
-std::array<float,2>{0.393261522f, 0.895552754f},
-std::array<float,2>{0.606841445f, 0.104415074f},
-std::array<float,2>{0.649262428f, 0.783187449f},
-std::array<float,2>{0.363208205f, 0.131735459f},
-std::array<float,2>{0.0408539325f, 0.689673364f},
-std::array<float,2>{0.834828913f, 0.354077518f},
-std::array<float,2>{0.956796825f, 0.833689034f},
-std::array<float,2>{0.246568099f, 0.208483905f},
-std::array<float,2>{0.440609068f, 0.661822379f},
-std::array<float,2>{0.554251909f, 0.287009686f},
-std::array<float,2>{0.695748925f, 0.500774443f},
-std::array<float,2>{0.286328614f, 0.422355235f},
-std::array<float,2>{0.0742209181f, 0.965603769f},
-std::array<float,2>{0.75573945f, 0.00691725407f},
-std::array<float,2>{0.857731879f, 0.743603408f},
-std::array<float,2>{0.000779080845f, 0.336042762f},
-std::array<float,2>{0.333859503f, 0.76692766f},
-std::array<float,2>{0.670335591f, 0.160839617f},
-std::array<float,2>{0.582986355f, 0.92062819f},
-std::array<float,2>{0.420194626f, 0.0696020946f},
-std::array<float,2>{0.128285185f, 0.58852613f},
-std::array<float,2>{0.911156654f, 0.442956209f},
-std::array<float,2>{0.802098215f, 0.7918185f},
-std::array<float,2>{0.0994198173f, 0.134621277f},
-std::array<float,2>{0.260820538f, 0.701547623f},
-std::array<float,2>{0.740284026f, 0.347525626f},
-std::array<float,2>{0.529994011f, 0.603983819f},
-std::array<float,2>{0.490286976f, 0.477234721f},
-std::array<float,2>{0.188006908f, 0.90590167f},
-std::array<float,2>{0.994437456f, 0.0973839536f},
-std::array<float,2>{0.905774832f, 0.640907586f},
-std::array<float,2>{0.173957393f, 0.252588451f},
-std::array<float,2>{0.376392692f, 0.855153143f},
-std::array<float,2>{0.609603226f, 0.227253169f},
-std::array<float,2>{0.625314415f, 0.997810304f},
-std::array<float,2>{0.356640488f, 0.0499398187f},
-std::array<float,2>{0.0616045594f, 0.550679445f},
-std::array<float,2>{0.821544647f, 0.402670354f},
-std::array<float,2>{0.938568115f, 0.907003701f},
-std::array<float,2>{0.231521696f, 0.0728273243f},
-std::array<float,2>{0.462804049f, 0.579922378f},
-std::array<float,2>{0.54623419f, 0.448567808f},
-std::array<float,2>{0.717200041f, 0.741930485f},
-std::array<float,2>{0.304400355f, 0.335692912f},
-std::array<float,2>{0.0888349488f, 0.774730563f},
-std::array<float,2>{0.773751736f, 0.170615628f},
-std::array<float,2>{0.861560225f, 0.508802354f},
-std::array<float,2>{0.0265363138f, 0.434701622f},
-std::array<float,2>{0.322830141f, 0.958095431f},
-std::array<float,2>{0.686393082f, 0.0136288386f},
-std::array<float,2>{0.565454423f, 0.841304898f},
-std::array<float,2>{0.425878644f, 0.215307578f},
-std::array<float,2>{0.142662093f, 0.668550134f},
-std::array<float,2>{0.929867804f, 0.294092745f},
-std::array<float,2>{0.828943133f, 0.951466918f},
-std::array<float,2>{0.0459253863f, 0.0188257489f},
-std::array<float,2>{0.365373254f, 0.529347181f},
-std::array<float,2>{0.653403044f, 0.41613847f},
-std::array<float,2>{0.603807092f, 0.681728899f},
-std::array<float,2>{0.394963503f, 0.299380839f},
-std::array<float,2>{0.156281099f, 0.813081026f},
-std::array<float,2>{0.875128865f, 0.198280334f},
-std::array<float,2>{0.977913797f, 0.569794297f},
-std::array<float,2>{0.212035909f, 0.461174518f},
-std::array<float,2>{0.479618222f, 0.932591975f},
-std::array<float,2>{0.505202591f, 0.0823031217f},
-std::array<float,2>{0.727690637f, 0.763416827f},
-std::array<float,2>{0.278807223f, 0.184400797f},
-std::array<float,2>{0.122636467f, 0.726796627f},
-std::array<float,2>{0.789530814f, 0.32278344f},
-std::array<float,2>{0.90722394f, 0.862925887f},
-std::array<float,2>{0.129342899f, 0.242460832f},
-std::array<float,2>{0.417944968f, 0.63560015f},
-std::array<float,2>{0.580698848f, 0.273091793f},
-std::array<float,2>{0.664106548f, 0.54005295f},
-std::array<float,2>{0.331329346f, 0.383429736f},
-std::array<float,2>{0.00589164812f, 0.973313987f},
-std::array<float,2>{0.852298498f, 0.0318479687f},
-std::array<float,2>{0.753180325f, 0.709262133f},
-std::array<float,2>{0.0737919584f, 0.362944335f},
-std::array<float,2>{0.282879472f, 0.806263447f},
-std::array<float,2>{0.702760696f, 0.145783842f},
-std::array<float,2>{0.547991633f, 0.880629599f},
-std::array<float,2>{0.441791534f, 0.118799463f},
-std::array<float,2>{0.244097993f, 0.62185061f},
-std::array<float,2>{0.958111823f, 0.491838068f},
-std::array<float,2>{0.851025999f, 0.825380862f},
-std::array<float,2>{0.010443408f, 0.192703322f},
-std::array<float,2>{0.336662471f, 0.673737109f},
-std::array<float,2>{0.662017882f, 0.312136799f},
-std::array<float,2>{0.592423975f, 0.520826459f},
-std::array<float,2>{0.411548078f, 0.413721919f},
-std::array<float,2>{0.136829972f, 0.941389501f},
-std::array<float,2>{0.919465899f, 0.0265991818f},
-std::array<float,2>{0.963158071f, 0.720483422f},
-std::array<float,2>{0.24143289f, 0.315209121f},
-std::array<float,2>{0.445332497f, 0.753666759f},
-std::array<float,2>{0.561212182f, 0.175495207f},
-std::array<float,2>{0.690167725f, 0.927680016f},
-std::array<float,2>{0.293150127f, 0.0905005857f},
-std::array<float,2>{0.0691481009f, 0.571163952f},
-std::array<float,2>{0.758139133f, 0.458531439f},
-std::array<float,2>{0.890343547f, 0.979467928f},
-std::array<float,2>{0.169514939f, 0.0402637944f},
-std::array<float,2>{0.404334307f, 0.532725155f},
-std::array<float,2>{0.597989857f, 0.377975285f},
-std::array<float,2>{0.643574953f, 0.629888117f},
-std::array<float,2>{0.370720208f, 0.274118215f},
-std::array<float,2>{0.0333529226f, 0.872237444f},
-std::array<float,2>{0.836832464f, 0.237318829f},
-std::array<float,2>{0.782159925f, 0.615192235f},
-std::array<float,2>{0.11653281f, 0.496764123f},
-std::array<float,2>{0.268529892f, 0.883724749f},
-std::array<float,2>{0.724118292f, 0.116260089f},
-std::array<float,2>{0.514757097f, 0.799652636f},
-std::array<float,2>{0.471919417f, 0.148619294f},
-std::array<float,2>{0.2073991f, 0.718089938f},
-std::array<float,2>{0.971884131f, 0.372516453f},
-std::array<float,2>{0.770914555f, 0.892855227f},
-std::array<float,2>{0.0827904418f, 0.107794918f},
-std::array<float,2>{0.307805032f, 0.600249588f},
-std::array<float,2>{0.706459582f, 0.47496748f},
-std::array<float,2>{0.537456274f, 0.69369936f},
-std::array<float,2>{0.460433453f, 0.358008981f},
-std::array<float,2>{0.223563656f, 0.788589478f},
-std::array<float,2>{0.950167894f, 0.127138063f},
-std::array<float,2>{0.92942512f, 0.55955565f},
-std::array<float,2>{0.153733805f, 0.393957168f},
-std::array<float,2>{0.436880141f, 0.988937676f},
-std::array<float,2>{0.573462725f, 0.0604624972f},
-std::array<float,2>{0.677998304f, 0.849644125f},
-std::array<float,2>{0.314565539f, 0.222189367f},
-std::array<float,2>{0.0225711465f, 0.652085066f},
-std::array<float,2>{0.873126745f, 0.260821372f},
-std::array<float,2>{0.992113531f, 0.769713104f},
-std::array<float,2>{0.195343032f, 0.157187209f},
-std::array<float,2>{0.494641066f, 0.7493186f},
-std::array<float,2>{0.520912766f, 0.343171358f},
-std::array<float,2>{0.746671975f, 0.590215027f},
-std::array<float,2>{0.252339214f, 0.437666088f},
-std::array<float,2>{0.107661664f, 0.914075077f},
-std::array<float,2>{0.810090661f, 0.0625011325f},
-std::array<float,2>{0.81859827f, 0.657607436f},
-std::array<float,2>{0.0484223217f, 0.281337798f},
-std::array<float,2>{0.346994579f, 0.828858614f},
-std::array<float,2>{0.636518836f, 0.203285351f},
-std::array<float,2>{0.622020602f, 0.964174867f},
-std::array<float,2>{0.3888928f, 0.00128520629f},
-std::array<float,2>{0.180982396f, 0.507619321f},
-std::array<float,2>{0.897673309f, 0.426968455f},
-std::array<float,2>{0.787923217f, 0.839213133f},
-std::array<float,2>{0.111368857f, 0.211351097f},
-std::array<float,2>{0.27050364f, 0.665715814f},
-std::array<float,2>{0.721976638f, 0.291524231f},
-std::array<float,2>{0.508449376f, 0.514877617f},
-std::array<float,2>{0.473731041f, 0.432880729f},
-std::array<float,2>{0.20573695f, 0.95560813f},
-std::array<float,2>{0.975936055f, 0.00906652957f},
-std::array<float,2>{0.885755301f, 0.73664695f},
-std::array<float,2>{0.164671913f, 0.329102218f},
-std::array<float,2>{0.398480386f, 0.78061974f},
-std::array<float,2>{0.596455336f, 0.164354026f},
-std::array<float,2>{0.648041785f, 0.913025916f},
-std::array<float,2>{0.371235043f, 0.077707395f},
-std::array<float,2>{0.037216913f, 0.585623264f},
-std::array<float,2>{0.839848936f, 0.451145858f},
-std::array<float,2>{0.967123747f, 0.993246734f},
-std::array<float,2>{0.234991163f, 0.0535625778f},
-std::array<float,2>{0.449526519f, 0.554437876f},
-std::array<float,2>{0.558511853f, 0.398993969f},
-std::array<float,2>{0.694477797f, 0.646897733f},
-std::array<float,2>{0.29221037f, 0.255449563f},
-std::array<float,2>{0.0641824603f, 0.857417345f},
-std::array<float,2>{0.762175798f, 0.231276855f},
-std::array<float,2>{0.844198108f, 0.606470644f},
-std::array<float,2>{0.0152741447f, 0.482389271f},
-std::array<float,2>{0.340039074f, 0.900992393f},
-std::array<float,2>{0.657378316f, 0.0985547677f},
-std::array<float,2>{0.58886373f, 0.794187963f},
-std::array<float,2>{0.409517705f, 0.136942118f},
-std::array<float,2>{0.133916765f, 0.695333481f},
-std::array<float,2>{0.917945325f, 0.349392772f},
-std::array<float,2>{0.813716948f, 0.877023876f},
-std::array<float,2>{0.0526229329f, 0.123958901f},
-std::array<float,2>{0.348745227f, 0.619178057f},
-std::array<float,2>{0.639684319f, 0.487703621f},
-std::array<float,2>{0.617739618f, 0.703521669f},
-std::array<float,2>{0.383543909f, 0.363851488f},
-std::array<float,2>{0.186575219f, 0.809479654f},
-std::array<float,2>{0.893449128f, 0.142025232f},
-std::array<float,2>{0.984815538f, 0.543939173f},
-std::array<float,2>{0.202978387f, 0.387841254f},
-std::array<float,2>{0.497862488f, 0.972527385f},
-std::array<float,2>{0.516234577f, 0.0379913189f},
-std::array<float,2>{0.744779348f, 0.863501787f},
-std::array<float,2>{0.254837215f, 0.248416305f},
-std::array<float,2>{0.104561329f, 0.637622118f},
-std::array<float,2>{0.806410789f, 0.266235828f},
-std::array<float,2>{0.925137758f, 0.760827303f},
-std::array<float,2>{0.149883315f, 0.180566147f},
-std::array<float,2>{0.430700123f, 0.730773926f},
-std::array<float,2>{0.57459563f, 0.326075673f},
-std::array<float,2>{0.673093796f, 0.564113081f},
-std::array<float,2>{0.316777259f, 0.465402931f},
-std::array<float,2>{0.0194786508f, 0.934816778f},
-std::array<float,2>{0.869168162f, 0.0818940848f},
-std::array<float,2>{0.768886507f, 0.684792817f},
-std::array<float,2>{0.0814724416f, 0.304089218f},
-std::array<float,2>{0.311266184f, 0.817551374f},
-std::array<float,2>{0.707493424f, 0.202792227f},
-std::array<float,2>{0.533492506f, 0.946866274f},
-std::array<float,2>{0.453389227f, 0.0196582861f},
-std::array<float,2>{0.221539363f, 0.525931239f},
-std::array<float,2>{0.945490241f, 0.420801073f},
-std::array<float,2>{0.865808189f, 0.802151263f},
-std::array<float,2>{0.0296519957f, 0.153382242f},
-std::array<float,2>{0.325760692f, 0.714096606f},
-std::array<float,2>{0.680309713f, 0.367207289f},
-std::array<float,2>{0.568098307f, 0.61128813f},
-std::array<float,2>{0.423927426f, 0.492229998f},
-std::array<float,2>{0.148101494f, 0.889792621f},
-std::array<float,2>{0.935149014f, 0.110542536f},
-std::array<float,2>{0.943901658f, 0.626167059f},
-std::array<float,2>{0.227993861f, 0.27807349f},
-std::array<float,2>{0.465584457f, 0.868059516f},
-std::array<float,2>{0.540624976f, 0.241625294f},
-std::array<float,2>{0.711560428f, 0.981383681f},
-std::array<float,2>{0.299023718f, 0.0432925224f},
-std::array<float,2>{0.0935755819f, 0.53686595f},
-std::array<float,2>{0.780440748f, 0.382368207f},
-std::array<float,2>{0.900908828f, 0.923229635f},
-std::array<float,2>{0.176071689f, 0.086149767f},
-std::array<float,2>{0.379645586f, 0.576109409f},
-std::array<float,2>{0.615333438f, 0.455643058f},
-std::array<float,2>{0.63136071f, 0.723895013f},
-std::array<float,2>{0.351644576f, 0.318303049f},
-std::array<float,2>{0.0582006089f, 0.75517875f},
-std::array<float,2>{0.825939119f, 0.177105829f},
-std::array<float,2>{0.799999952f, 0.517026961f},
-std::array<float,2>{0.0972301587f, 0.406793535f},
-std::array<float,2>{0.264271647f, 0.943470359f},
-std::array<float,2>{0.735677421f, 0.0294901598f},
-std::array<float,2>{0.525893331f, 0.82412219f},
-std::array<float,2>{0.487419575f, 0.188109428f},
-std::array<float,2>{0.192313373f, 0.678841591f},
-std::array<float,2>{0.996934652f, 0.30639106f},
-std::array<float,2>{0.75692153f, 0.967316151f},
-std::array<float,2>{0.077380009f, 0.00447446806f},
-std::array<float,2>{0.288734555f, 0.503842771f},
-std::array<float,2>{0.698506415f, 0.42563507f},
-std::array<float,2>{0.551102757f, 0.663373172f},
-std::array<float,2>{0.437677652f, 0.287372202f},
-std::array<float,2>{0.248557478f, 0.83483547f},
-std::array<float,2>{0.953648627f, 0.210710675f},
-std::array<float,2>{0.912885129f, 0.587499857f},
-std::array<float,2>{0.126788929f, 0.44352299f},
-std::array<float,2>{0.41824773f, 0.918836117f},
-std::array<float,2>{0.584942281f, 0.0664076433f},
-std::array<float,2>{0.669080257f, 0.768179595f},
-std::array<float,2>{0.334316254f, 0.163104594f},
-std::array<float,2>{0.00205504126f, 0.744443536f},
-std::array<float,2>{0.857404053f, 0.339078993f},
-std::array<float,2>{0.981795371f, 0.846359611f},
-std::array<float,2>{0.217274606f, 0.226138234f},
-std::array<float,2>{0.480825603f, 0.654713809f},
-std::array<float,2>{0.500470519f, 0.265040725f},
-std::array<float,2>{0.733688414f, 0.556316614f},
-std::array<float,2>{0.275805682f, 0.394624978f},
-std::array<float,2>{0.120115586f, 0.986413658f},
-std::array<float,2>{0.794786632f, 0.05580993f},
-std::array<float,2>{0.833659291f, 0.689164162f},
-std::array<float,2>{0.0416477174f, 0.352513462f},
-std::array<float,2>{0.359455198f, 0.784860611f},
-std::array<float,2>{0.652066886f, 0.129902124f},
-std::array<float,2>{0.608739674f, 0.898273349f},
-std::array<float,2>{0.392382324f, 0.102611616f},
-std::array<float,2>{0.16070424f, 0.597001851f},
-std::array<float,2>{0.880459845f, 0.469521791f},
-std::array<float,2>{0.775690734f, 0.775538385f},
-std::array<float,2>{0.0867950991f, 0.169572353f},
-std::array<float,2>{0.302378595f, 0.73854965f},
-std::array<float,2>{0.715190172f, 0.332349747f},
-std::array<float,2>{0.544465542f, 0.581842303f},
-std::array<float,2>{0.462902904f, 0.445549875f},
-std::array<float,2>{0.233817577f, 0.90924567f},
-std::array<float,2>{0.940725267f, 0.0704464391f},
-std::array<float,2>{0.933552802f, 0.671024442f},
-std::array<float,2>{0.141967371f, 0.29533264f},
-std::array<float,2>{0.429422081f, 0.842765927f},
-std::array<float,2>{0.563692331f, 0.218003914f},
-std::array<float,2>{0.683853626f, 0.960735738f},
-std::array<float,2>{0.321232706f, 0.0148847345f},
-std::array<float,2>{0.0249048453f, 0.510570765f},
-std::array<float,2>{0.860430837f, 0.437376738f},
-std::array<float,2>{0.99373728f, 0.902559519f},
-std::array<float,2>{0.19008629f, 0.0952794924f},
-std::array<float,2>{0.488590926f, 0.602460623f},
-std::array<float,2>{0.529212713f, 0.480207592f},
-std::array<float,2>{0.738528967f, 0.700126767f},
-std::array<float,2>{0.258845627f, 0.344500929f},
-std::array<float,2>{0.100927234f, 0.789170623f},
-std::array<float,2>{0.803549767f, 0.136055678f},
-std::array<float,2>{0.823170602f, 0.547486246f},
-std::array<float,2>{0.0594217926f, 0.404580593f},
-std::array<float,2>{0.357782632f, 0.99984777f},
-std::array<float,2>{0.628512025f, 0.0478630103f},
-std::array<float,2>{0.61233151f, 0.851743996f},
-std::array<float,2>{0.377123475f, 0.229032278f},
-std::array<float,2>{0.173283994f, 0.644355834f},
-std::array<float,2>{0.903717399f, 0.250775546f},
-std::array<float,2>{0.855465889f, 0.975962281f},
-std::array<float,2>{0.00461825123f, 0.0333575197f},
-std::array<float,2>{0.329893053f, 0.542608261f},
-std::array<float,2>{0.667621076f, 0.38509348f},
-std::array<float,2>{0.578521192f, 0.633864462f},
-std::array<float,2>{0.415955484f, 0.270848721f},
-std::array<float,2>{0.132079661f, 0.859414637f},
-std::array<float,2>{0.908944011f, 0.246084422f},
-std::array<float,2>{0.959938884f, 0.623486519f},
-std::array<float,2>{0.245814264f, 0.488545895f},
-std::array<float,2>{0.443470418f, 0.881118f},
-std::array<float,2>{0.550441206f, 0.120015465f},
-std::array<float,2>{0.699239075f, 0.807560623f},
-std::array<float,2>{0.284907728f, 0.147979021f},
-std::array<float,2>{0.0708431751f, 0.707213163f},
-std::array<float,2>{0.751672685f, 0.359572917f},
-std::array<float,2>{0.877359688f, 0.815728843f},
-std::array<float,2>{0.158851027f, 0.196511149f},
-std::array<float,2>{0.397539556f, 0.680436134f},
-std::array<float,2>{0.603436887f, 0.2972956f},
-std::array<float,2>{0.654818654f, 0.529052913f},
-std::array<float,2>{0.363762707f, 0.415397912f},
-std::array<float,2>{0.0441360287f, 0.950960755f},
-std::array<float,2>{0.831955373f, 0.0171998665f},
-std::array<float,2>{0.791473448f, 0.729032397f},
-std::array<float,2>{0.124618717f, 0.321135372f},
-std::array<float,2>{0.280716658f, 0.763737082f},
-std::array<float,2>{0.728528321f, 0.186029255f},
-std::array<float,2>{0.506892145f, 0.931144118f},
-std::array<float,2>{0.477572948f, 0.0842748657f},
-std::array<float,2>{0.214535788f, 0.567269683f},
-std::array<float,2>{0.978998065f, 0.46296674f},
-std::array<float,2>{0.838357925f, 0.873809457f},
-std::array<float,2>{0.0330963358f, 0.235145301f},
-std::array<float,2>{0.368068457f, 0.632504106f},
-std::array<float,2>{0.641191661f, 0.275585651f},
-std::array<float,2>{0.600121498f, 0.533853173f},
-std::array<float,2>{0.4029378f, 0.375959545f},
-std::array<float,2>{0.17101647f, 0.977038145f},
-std::array<float,2>{0.888297558f, 0.0411728062f},
-std::array<float,2>{0.96931535f, 0.715147436f},
-std::array<float,2>{0.210559696f, 0.373874903f},
-std::array<float,2>{0.469717234f, 0.796996593f},
-std::array<float,2>{0.513367951f, 0.15105617f},
-std::array<float,2>{0.725090981f, 0.885628998f},
-std::array<float,2>{0.26707986f, 0.114321433f},
-std::array<float,2>{0.114458703f, 0.616238415f},
-std::array<float,2>{0.783576727f, 0.498272359f},
-std::array<float,2>{0.921611845f, 0.93904233f},
-std::array<float,2>{0.139542118f, 0.0250347462f},
-std::array<float,2>{0.413545191f, 0.521900117f},
-std::array<float,2>{0.591070235f, 0.411256671f},
-std::array<float,2>{0.663515687f, 0.675681472f},
-std::array<float,2>{0.339510709f, 0.309134573f},
-std::array<float,2>{0.00930185989f, 0.827727377f},
-std::array<float,2>{0.849217653f, 0.194139004f},
-std::array<float,2>{0.760354698f, 0.573276341f},
-std::array<float,2>{0.0682983845f, 0.460684597f},
-std::array<float,2>{0.295648307f, 0.92883569f},
-std::array<float,2>{0.687545121f, 0.0919821486f},
-std::array<float,2>{0.559475243f, 0.750823319f},
-std::array<float,2>{0.447980821f, 0.172153279f},
-std::array<float,2>{0.238748834f, 0.721920371f},
-std::array<float,2>{0.961850226f, 0.314143151f},
-std::array<float,2>{0.812044561f, 0.916104555f},
-std::array<float,2>{0.107332721f, 0.065210253f},
-std::array<float,2>{0.250664026f, 0.592813134f},
-std::array<float,2>{0.748390734f, 0.440912575f},
-std::array<float,2>{0.521743655f, 0.746810555f},
-std::array<float,2>{0.49230057f, 0.339900196f},
-std::array<float,2>{0.198620409f, 0.773049176f},
-std::array<float,2>{0.989166141f, 0.15947789f},
-std::array<float,2>{0.896060288f, 0.505443811f},
-std::array<float,2>{0.181879312f, 0.428608507f},
-std::array<float,2>{0.387965947f, 0.961820245f},
-std::array<float,2>{0.623490512f, 0.00196984806f},
-std::array<float,2>{0.634285986f, 0.831691682f},
-std::array<float,2>{0.344349802f, 0.205316156f},
-std::array<float,2>{0.049517449f, 0.658700466f},
-std::array<float,2>{0.818050981f, 0.28406617f},
-std::array<float,2>{0.952242374f, 0.786028087f},
-std::array<float,2>{0.224983871f, 0.125653341f},
-std::array<float,2>{0.458621353f, 0.691663563f},
-std::array<float,2>{0.536533415f, 0.355819881f},
-std::array<float,2>{0.704058886f, 0.597842932f},
-std::array<float,2>{0.304929823f, 0.474158078f},
-std::array<float,2>{0.0851910189f, 0.890847921f},
-std::array<float,2>{0.771557927f, 0.106531098f},
-std::array<float,2>{0.871717095f, 0.649505198f},
-std::array<float,2>{0.020079745f, 0.258527875f},
-std::array<float,2>{0.313364059f, 0.848835945f},
-std::array<float,2>{0.677520454f, 0.220394254f},
-std::array<float,2>{0.57188642f, 0.990495443f},
-std::array<float,2>{0.434025049f, 0.0621185005f},
-std::array<float,2>{0.155918136f, 0.562441945f},
-std::array<float,2>{0.927537143f, 0.391554624f},
-std::array<float,2>{0.766736746f, 0.817267179f},
-std::array<float,2>{0.0784244835f, 0.201867327f},
-std::array<float,2>{0.310454488f, 0.683927298f},
-std::array<float,2>{0.710182428f, 0.303630888f},
-std::array<float,2>{0.532126069f, 0.526798785f},
-std::array<float,2>{0.455833346f, 0.421308488f},
-std::array<float,2>{0.220422208f, 0.946044147f},
-std::array<float,2>{0.948706448f, 0.0208863579f},
-std::array<float,2>{0.922761679f, 0.732245743f},
-std::array<float,2>{0.151561946f, 0.324294209f},
-std::array<float,2>{0.432628125f, 0.760206461f},
-std::array<float,2>{0.577690721f, 0.180876136f},
-std::array<float,2>{0.67534399f, 0.934081793f},
-std::array<float,2>{0.318937242f, 0.0809216127f},
-std::array<float,2>{0.0170223936f, 0.562530279f},
-std::array<float,2>{0.86826992f, 0.466029823f},
-std::array<float,2>{0.986849844f, 0.971355081f},
-std::array<float,2>{0.199493021f, 0.0383878052f},
-std::array<float,2>{0.499511778f, 0.544882417f},
-std::array<float,2>{0.517674327f, 0.387678415f},
-std::array<float,2>{0.74319905f, 0.638031304f},
-std::array<float,2>{0.256604612f, 0.266717762f},
-std::array<float,2>{0.101736754f, 0.865145028f},
-std::array<float,2>{0.807726026f, 0.249941379f},
-std::array<float,2>{0.81576997f, 0.621047676f},
-std::array<float,2>{0.0543817654f, 0.486671239f},
-std::array<float,2>{0.350925684f, 0.878873408f},
-std::array<float,2>{0.638124883f, 0.124220602f},
-std::array<float,2>{0.620382488f, 0.809711635f},
-std::array<float,2>{0.386025667f, 0.141461775f},
-std::array<float,2>{0.184228346f, 0.704910398f},
-std::array<float,2>{0.892201722f, 0.364798456f},
-std::array<float,2>{0.846843481f, 0.902264714f},
-std::array<float,2>{0.0120659592f, 0.0993781909f},
-std::array<float,2>{0.341966808f, 0.605531335f},
-std::array<float,2>{0.65970695f, 0.480594158f},
-std::array<float,2>{0.587846994f, 0.696490467f},
-std::array<float,2>{0.407249242f, 0.347998887f},
-std::array<float,2>{0.136269167f, 0.793490946f},
-std::array<float,2>{0.914082944f, 0.138662592f},
-std::array<float,2>{0.965141892f, 0.55352056f},
-std::array<float,2>{0.236696362f, 0.400294363f},
-std::array<float,2>{0.452415109f, 0.992686093f},
-std::array<float,2>{0.556047022f, 0.0542925335f},
-std::array<float,2>{0.691925526f, 0.855915368f},
-std::array<float,2>{0.289844126f, 0.231737211f},
-std::array<float,2>{0.064855054f, 0.648188412f},
-std::array<float,2>{0.76425004f, 0.254609823f},
-std::array<float,2>{0.883132458f, 0.779355109f},
-std::array<float,2>{0.167264238f, 0.165078789f},
-std::array<float,2>{0.401222974f, 0.738162041f},
-std::array<float,2>{0.595039189f, 0.329069674f},
-std::array<float,2>{0.646327078f, 0.584575713f},
-std::array<float,2>{0.374548048f, 0.449235499f},
-std::array<float,2>{0.0352402963f, 0.913170755f},
-std::array<float,2>{0.843268394f, 0.0766706914f},
-std::array<float,2>{0.785915613f, 0.664267063f},
-std::array<float,2>{0.110406533f, 0.292346686f},
-std::array<float,2>{0.271821916f, 0.83882302f},
-std::array<float,2>{0.719301641f, 0.212630749f},
-std::array<float,2>{0.510134816f, 0.956555486f},
-std::array<float,2>{0.474671245f, 0.0082304813f},
-std::array<float,2>{0.20478785f, 0.514461577f},
-std::array<float,2>{0.97375983f, 0.431936711f},
-std::array<float,2>{0.835555255f, 0.783778906f},
-std::array<float,2>{0.0396981612f, 0.12977615f},
-std::array<float,2>{0.361667663f, 0.687950373f},
-std::array<float,2>{0.649701834f, 0.352676809f},
-std::array<float,2>{0.606334686f, 0.595811129f},
-std::array<float,2>{0.394106358f, 0.470520556f},
-std::array<float,2>{0.162113234f, 0.896576822f},
-std::array<float,2>{0.882469535f, 0.102088928f},
-std::array<float,2>{0.982519686f, 0.655840516f},
-std::array<float,2>{0.216552511f, 0.263831109f},
-std::array<float,2>{0.483652413f, 0.847578526f},
-std::array<float,2>{0.502719223f, 0.225089192f},
-std::array<float,2>{0.73114872f, 0.987927139f},
-std::array<float,2>{0.274271041f, 0.0554455668f},
-std::array<float,2>{0.119016118f, 0.55536747f},
-std::array<float,2>{0.796028137f, 0.395867348f},
-std::array<float,2>{0.91016221f, 0.918949008f},
-std::array<float,2>{0.1270044f, 0.0678806826f},
-std::array<float,2>{0.421772301f, 0.586470008f},
-std::array<float,2>{0.583026648f, 0.445269227f},
-std::array<float,2>{0.671058357f, 0.745161593f},
-std::array<float,2>{0.332719177f, 0.338580072f},
-std::array<float,2>{0.00130350748f, 0.76947552f},
-std::array<float,2>{0.85856998f, 0.162920266f},
-std::array<float,2>{0.754056334f, 0.502304375f},
-std::array<float,2>{0.0755880699f, 0.424365222f},
-std::array<float,2>{0.285513908f, 0.968498647f},
-std::array<float,2>{0.697176993f, 0.00539027574f},
-std::array<float,2>{0.553134263f, 0.835629582f},
-std::array<float,2>{0.440140665f, 0.209509537f},
-std::array<float,2>{0.247980312f, 0.663038671f},
-std::array<float,2>{0.955338418f, 0.288776726f},
-std::array<float,2>{0.797743738f, 0.944931269f},
-std::array<float,2>{0.0940688923f, 0.0303535573f},
-std::array<float,2>{0.263415277f, 0.516408145f},
-std::array<float,2>{0.736373901f, 0.407874316f},
-std::array<float,2>{0.524929821f, 0.678026438f},
-std::array<float,2>{0.48629427f, 0.30524978f},
-std::array<float,2>{0.194923908f, 0.822520316f},
-std::array<float,2>{0.999016821f, 0.188693851f},
-std::array<float,2>{0.90002507f, 0.575186253f},
-std::array<float,2>{0.17917867f, 0.456565738f},
-std::array<float,2>{0.382244319f, 0.922080576f},
-std::array<float,2>{0.613465428f, 0.0873621255f},
-std::array<float,2>{0.629878938f, 0.75473839f},
-std::array<float,2>{0.354969531f, 0.176693991f},
-std::array<float,2>{0.055965811f, 0.722918868f},
-std::array<float,2>{0.826604903f, 0.316746384f},
-std::array<float,2>{0.942274153f, 0.868621349f},
-std::array<float,2>{0.228994727f, 0.241152674f},
-std::array<float,2>{0.467644572f, 0.62514317f},
-std::array<float,2>{0.542536557f, 0.278926015f},
-std::array<float,2>{0.713116527f, 0.535762608f},
-std::array<float,2>{0.298645616f, 0.381626755f},
-std::array<float,2>{0.0914426893f, 0.982121408f},
-std::array<float,2>{0.777373016f, 0.044775553f},
-std::array<float,2>{0.863810599f, 0.712922335f},
-std::array<float,2>{0.0282135401f, 0.368956149f},
-std::array<float,2>{0.327529013f, 0.800859213f},
-std::array<float,2>{0.681712806f, 0.152831241f},
-std::array<float,2>{0.570140481f, 0.888816237f},
-std::array<float,2>{0.422547132f, 0.10985063f},
-std::array<float,2>{0.146314815f, 0.610317945f},
-std::array<float,2>{0.936644077f, 0.4938052f},
-std::array<float,2>{0.790477514f, 0.76531893f},
-std::array<float,2>{0.121285461f, 0.187262759f},
-std::array<float,2>{0.27769658f, 0.729945421f},
-std::array<float,2>{0.726826012f, 0.322219342f},
-std::array<float,2>{0.504780531f, 0.567729294f},
-std::array<float,2>{0.479421884f, 0.464715123f},
-std::array<float,2>{0.211742744f, 0.930246532f},
-std::array<float,2>{0.977273166f, 0.0858173147f},
-std::array<float,2>{0.876511514f, 0.681040406f},
-std::array<float,2>{0.157620415f, 0.298609227f},
-std::array<float,2>{0.396131665f, 0.81464678f},
-std::array<float,2>{0.604563653f, 0.195399284f},
-std::array<float,2>{0.65320152f, 0.949577451f},
-std::array<float,2>{0.366798401f, 0.0158977639f},
-std::array<float,2>{0.0449637175f, 0.528001547f},
-std::array<float,2>{0.830054045f, 0.414424151f},
-std::array<float,2>{0.957135439f, 0.882534325f},
-std::array<float,2>{0.242718533f, 0.121078879f},
-std::array<float,2>{0.442435563f, 0.624516845f},
-std::array<float,2>{0.547041476f, 0.489895195f},
-std::array<float,2>{0.701852679f, 0.708314061f},
-std::array<float,2>{0.28205362f, 0.360872656f},
-std::array<float,2>{0.0726329088f, 0.808203042f},
-std::array<float,2>{0.752263784f, 0.14715144f},
-std::array<float,2>{0.852953911f, 0.541021168f},
-std::array<float,2>{0.00687728496f, 0.386513144f},
-std::array<float,2>{0.330649227f, 0.975398302f},
-std::array<float,2>{0.6651631f, 0.0350564942f},
-std::array<float,2>{0.581328452f, 0.860665977f},
-std::array<float,2>{0.416408539f, 0.244697824f},
-std::array<float,2>{0.130324304f, 0.633644223f},
-std::array<float,2>{0.907874048f, 0.269555211f},
-std::array<float,2>{0.820693552f, 0.998407781f},
-std::array<float,2>{0.0614410676f, 0.0477606282f},
-std::array<float,2>{0.356339216f, 0.548598826f},
-std::array<float,2>{0.626536965f, 0.405825198f},
-std::array<float,2>{0.610765934f, 0.64333111f},
-std::array<float,2>{0.375867367f, 0.25188303f},
-std::array<float,2>{0.17548418f, 0.853274763f},
-std::array<float,2>{0.904891074f, 0.230080187f},
-std::array<float,2>{0.995705545f, 0.603332102f},
-std::array<float,2>{0.189406335f, 0.478568912f},
-std::array<float,2>{0.492019653f, 0.90351063f},
-std::array<float,2>{0.53085345f, 0.0938038975f},
-std::array<float,2>{0.74208051f, 0.790677428f},
-std::array<float,2>{0.260565221f, 0.135000736f},
-std::array<float,2>{0.0981115028f, 0.700913489f},
-std::array<float,2>{0.801561952f, 0.345478624f},
-std::array<float,2>{0.931394041f, 0.842804372f},
-std::array<float,2>{0.144338101f, 0.216844171f},
-std::array<float,2>{0.427498192f, 0.670689642f},
-std::array<float,2>{0.565216303f, 0.29678598f},
-std::array<float,2>{0.687296987f, 0.511533618f},
-std::array<float,2>{0.324080378f, 0.436443448f},
-std::array<float,2>{0.0261071026f, 0.959353209f},
-std::array<float,2>{0.863200366f, 0.0145629104f},
-std::array<float,2>{0.774749994f, 0.739863396f},
-std::array<float,2>{0.0890676677f, 0.33315894f},
-std::array<float,2>{0.303646445f, 0.777094007f},
-std::array<float,2>{0.718698084f, 0.168019503f},
-std::array<float,2>{0.545447707f, 0.908885241f},
-std::array<float,2>{0.461157411f, 0.0715850294f},
-std::array<float,2>{0.230620548f, 0.580753386f},
-std::array<float,2>{0.937949538f, 0.447104692f},
-std::array<float,2>{0.874454796f, 0.84853369f},
-std::array<float,2>{0.0221322961f, 0.219500557f},
-std::array<float,2>{0.315615028f, 0.649232686f},
-std::array<float,2>{0.678983688f, 0.259024948f},
-std::array<float,2>{0.572571158f, 0.561241031f},
-std::array<float,2>{0.436195046f, 0.392091125f},
-std::array<float,2>{0.152456135f, 0.991452694f},
-std::array<float,2>{0.928486526f, 0.0608698912f},
-std::array<float,2>{0.950985968f, 0.692898631f},
-std::array<float,2>{0.223735094f, 0.357278049f},
-std::array<float,2>{0.459483713f, 0.78699553f},
-std::array<float,2>{0.538087666f, 0.126691401f},
-std::array<float,2>{0.705548108f, 0.89238441f},
-std::array<float,2>{0.30672282f, 0.10573934f},
-std::array<float,2>{0.0830891952f, 0.598691225f},
-std::array<float,2>{0.769845843f, 0.472999424f},
-std::array<float,2>{0.896989405f, 0.9620471f},
-std::array<float,2>{0.180396482f, 0.00324695348f},
-std::array<float,2>{0.390482277f, 0.504265189f},
-std::array<float,2>{0.622596383f, 0.429454178f},
-std::array<float,2>{0.635247886f, 0.659288526f},
-std::array<float,2>{0.346051723f, 0.284199446f},
-std::array<float,2>{0.0473145507f, 0.830335617f},
-std::array<float,2>{0.819795847f, 0.206562415f},
-std::array<float,2>{0.809118688f, 0.59247607f},
-std::array<float,2>{0.108444244f, 0.439690471f},
-std::array<float,2>{0.253484964f, 0.91779989f},
-std::array<float,2>{0.747514367f, 0.0659392923f},
-std::array<float,2>{0.520387352f, 0.772234142f},
-std::array<float,2>{0.495395511f, 0.159077257f},
-std::array<float,2>{0.196678162f, 0.747942209f},
-std::array<float,2>{0.991037428f, 0.34095642f},
-std::array<float,2>{0.759296834f, 0.92846632f},
-std::array<float,2>{0.0699747801f, 0.0932758898f},
-std::array<float,2>{0.294838458f, 0.573037148f},
-std::array<float,2>{0.691150129f, 0.459407121f},
-std::array<float,2>{0.561867774f, 0.721243441f},
-std::array<float,2>{0.446995616f, 0.312684685f},
-std::array<float,2>{0.240613252f, 0.751318336f},
-std::array<float,2>{0.964552999f, 0.172879592f},
-std::array<float,2>{0.918560565f, 0.522518396f},
-std::array<float,2>{0.138503179f, 0.410784662f},
-std::array<float,2>{0.410801053f, 0.938365042f},
-std::array<float,2>{0.593503416f, 0.0238203742f},
-std::array<float,2>{0.660565317f, 0.826691747f},
-std::array<float,2>{0.33781448f, 0.194985643f},
-std::array<float,2>{0.011436671f, 0.674108267f},
-std::array<float,2>{0.850222409f, 0.310324937f},
-std::array<float,2>{0.971569359f, 0.798528075f},
-std::array<float,2>{0.208640054f, 0.151974589f},
-std::array<float,2>{0.470964134f, 0.716233313f},
-std::array<float,2>{0.513692975f, 0.374515861f},
-std::array<float,2>{0.723367929f, 0.615616918f},
-std::array<float,2>{0.269242406f, 0.499721617f},
-std::array<float,2>{0.11591351f, 0.886566281f},
-std::array<float,2>{0.783114314f, 0.113291092f},
-std::array<float,2>{0.837394953f, 0.631619871f},
-std::array<float,2>{0.0345556773f, 0.276495785f},
-std::array<float,2>{0.369864613f, 0.874615848f},
-std::array<float,2>{0.643161714f, 0.235690013f},
-std::array<float,2>{0.599311173f, 0.97790426f},
-std::array<float,2>{0.405987054f, 0.0420837514f},
-std::array<float,2>{0.168524846f, 0.53429693f},
-std::array<float,2>{0.888912857f, 0.376525789f},
-std::array<float,2>{0.805609465f, 0.866539598f},
-std::array<float,2>{0.103559323f, 0.246775985f},
-std::array<float,2>{0.255846769f, 0.639396966f},
-std::array<float,2>{0.745835662f, 0.269077927f},
-std::array<float,2>{0.517166793f, 0.546643794f},
-std::array<float,2>{0.496228069f, 0.389082193f},
-std::array<float,2>{0.201501012f, 0.969098568f},
-std::array<float,2>{0.985445797f, 0.0357200764f},
-std::array<float,2>{0.894241512f, 0.705549121f},
-std::array<float,2>{0.186217934f, 0.366755247f},
-std::array<float,2>{0.384015322f, 0.810629129f},
-std::array<float,2>{0.61905551f, 0.143643543f},
-std::array<float,2>{0.638780236f, 0.876354158f},
-std::array<float,2>{0.348361969f, 0.1216297f},
-std::array<float,2>{0.051196184f, 0.617211103f},
-std::array<float,2>{0.812851489f, 0.486067772f},
-std::array<float,2>{0.947022378f, 0.947530866f},
-std::array<float,2>{0.222591937f, 0.0216079168f},
-std::array<float,2>{0.454299927f, 0.524288177f},
-std::array<float,2>{0.534336865f, 0.419771731f},
-std::array<float,2>{0.708625197f, 0.68666327f},
-std::array<float,2>{0.312394261f, 0.301719308f},
-std::array<float,2>{0.0803822801f, 0.818790793f},
-std::array<float,2>{0.768176198f, 0.199390173f},
-std::array<float,2>{0.87022686f, 0.565194368f},
-std::array<float,2>{0.0175963677f, 0.468277782f},
-std::array<float,2>{0.318266273f, 0.935558677f},
-std::array<float,2>{0.672009289f, 0.0797690079f},
-std::array<float,2>{0.575664043f, 0.758434772f},
-std::array<float,2>{0.43054691f, 0.182353154f},
-std::array<float,2>{0.148524597f, 0.732672691f},
-std::array<float,2>{0.924193025f, 0.326500595f},
-std::array<float,2>{0.841783643f, 0.910308719f},
-std::array<float,2>{0.0387179069f, 0.0751287416f},
-std::array<float,2>{0.37255922f, 0.58212024f},
-std::array<float,2>{0.647262573f, 0.452259839f},
-std::array<float,2>{0.597305655f, 0.735198677f},
-std::array<float,2>{0.399466693f, 0.330717623f},
-std::array<float,2>{0.165664241f, 0.777849853f},
-std::array<float,2>{0.884815693f, 0.166194126f},
-std::array<float,2>{0.974785686f, 0.512506008f},
-std::array<float,2>{0.206439942f, 0.431448758f},
-std::array<float,2>{0.472876936f, 0.954476833f},
-std::array<float,2>{0.509191751f, 0.0112878997f},
-std::array<float,2>{0.72152102f, 0.836815417f},
-std::array<float,2>{0.270985812f, 0.214495137f},
-std::array<float,2>{0.112383761f, 0.666398287f},
-std::array<float,2>{0.789024293f, 0.289263248f},
-std::array<float,2>{0.916020751f, 0.795942068f},
-std::array<float,2>{0.133278057f, 0.139993995f},
-std::array<float,2>{0.408578485f, 0.697473645f},
-std::array<float,2>{0.589597881f, 0.351401597f},
-std::array<float,2>{0.656549454f, 0.609222889f},
-std::array<float,2>{0.341324985f, 0.484198153f},
-std::array<float,2>{0.0144623229f, 0.899931788f},
-std::array<float,2>{0.845352471f, 0.100045644f},
-std::array<float,2>{0.76335448f, 0.64561826f},
-std::array<float,2>{0.0633805692f, 0.257138997f},
-std::array<float,2>{0.291019201f, 0.859318972f},
-std::array<float,2>{0.693692863f, 0.232910827f},
-std::array<float,2>{0.557527006f, 0.995659947f},
-std::array<float,2>{0.45081079f, 0.052188836f},
-std::array<float,2>{0.235837907f, 0.552119911f},
-std::array<float,2>{0.968158901f, 0.401531518f},
-std::array<float,2>{0.855667114f, 0.765879571f},
-std::array<float,2>{0.00385812903f, 0.161240354f},
-std::array<float,2>{0.335244507f, 0.742606819f},
-std::array<float,2>{0.66892606f, 0.337488323f},
-std::array<float,2>{0.585521519f, 0.589245796f},
-std::array<float,2>{0.419113904f, 0.441632003f},
-std::array<float,2>{0.125896469f, 0.921143115f},
-std::array<float,2>{0.913693845f, 0.0687961951f},
-std::array<float,2>{0.954522371f, 0.661010861f},
-std::array<float,2>{0.249220818f, 0.285864592f},
-std::array<float,2>{0.43899253f, 0.832537651f},
-std::array<float,2>{0.552463174f, 0.207364455f},
-std::array<float,2>{0.697786152f, 0.966333628f},
-std::array<float,2>{0.28787154f, 0.00601633498f},
-std::array<float,2>{0.076201193f, 0.501012981f},
-std::array<float,2>{0.756173253f, 0.423007041f},
-std::array<float,2>{0.87961942f, 0.894740283f},
-std::array<float,2>{0.162100241f, 0.104530975f},
-std::array<float,2>{0.390932471f, 0.595209956f},
-std::array<float,2>{0.607835472f, 0.47210893f},
-std::array<float,2>{0.651061714f, 0.690915823f},
-std::array<float,2>{0.360533535f, 0.355311126f},
-std::array<float,2>{0.0426032878f, 0.782102585f},
-std::array<float,2>{0.832503796f, 0.132075951f},
-std::array<float,2>{0.793122768f, 0.557226241f},
-std::array<float,2>{0.120814495f, 0.397365332f},
-std::array<float,2>{0.276589066f, 0.984576821f},
-std::array<float,2>{0.733208954f, 0.0572400726f},
-std::array<float,2>{0.501548469f, 0.84566766f},
-std::array<float,2>{0.482335806f, 0.222785279f},
-std::array<float,2>{0.217809722f, 0.652423024f},
-std::array<float,2>{0.980671287f, 0.263085753f},
-std::array<float,2>{0.779452085f, 0.98328799f},
-std::array<float,2>{0.0921911374f, 0.0461333878f},
-std::array<float,2>{0.300537825f, 0.53770858f},
-std::array<float,2>{0.712505162f, 0.380186111f},
-std::array<float,2>{0.539733231f, 0.627640069f},
-std::array<float,2>{0.466155857f, 0.279932588f},
-std::array<float,2>{0.226867899f, 0.870235503f},
-std::array<float,2>{0.944584608f, 0.239849821f},
-std::array<float,2>{0.934248924f, 0.612785935f},
-std::array<float,2>{0.146663412f, 0.495173156f},
-std::array<float,2>{0.425163954f, 0.888170242f},
-std::array<float,2>{0.566767633f, 0.11242865f},
-std::array<float,2>{0.68152827f, 0.804191411f},
-std::array<float,2>{0.324729502f, 0.156198591f},
-std::array<float,2>{0.030543616f, 0.712048471f},
-std::array<float,2>{0.867135584f, 0.370062411f},
-std::array<float,2>{0.997723758f, 0.82137996f},
-std::array<float,2>{0.192663237f, 0.189904079f},
-std::array<float,2>{0.487023413f, 0.676384985f},
-std::array<float,2>{0.526449382f, 0.308134049f},
-std::array<float,2>{0.735089302f, 0.518759727f},
-std::array<float,2>{0.265376806f, 0.409563452f},
-std::array<float,2>{0.0957712755f, 0.942879319f},
-std::array<float,2>{0.799758613f, 0.0282721911f},
-std::array<float,2>{0.824931741f, 0.725765765f},
-std::array<float,2>{0.0566614084f, 0.318969548f},
-std::array<float,2>{0.352862358f, 0.757484853f},
-std::array<float,2>{0.632125914f, 0.179280296f},
-std::array<float,2>{0.616376221f, 0.925578058f},
-std::array<float,2>{0.380593002f, 0.0896107778f},
-std::array<float,2>{0.176951483f, 0.577368617f},
-std::array<float,2>{0.902126014f, 0.454124361f},
-std::array<float,2>{0.750594974f, 0.805260241f},
-std::array<float,2>{0.0721477121f, 0.144959673f},
-std::array<float,2>{0.284105808f, 0.71054107f},
-std::array<float,2>{0.700780094f, 0.361371696f},
-std::array<float,2>{0.549271286f, 0.62296176f},
-std::array<float,2>{0.444721162f, 0.49085772f},
-std::array<float,2>{0.245063454f, 0.879748523f},
-std::array<float,2>{0.960341394f, 0.117312945f},
-std::array<float,2>{0.90931195f, 0.636407614f},
-std::array<float,2>{0.131646574f, 0.271986842f},
-std::array<float,2>{0.414669544f, 0.861771882f},
-std::array<float,2>{0.579895318f, 0.243444934f},
-std::array<float,2>{0.666836441f, 0.974128783f},
-std::array<float,2>{0.329037905f, 0.0331188925f},
-std::array<float,2>{0.00549960602f, 0.539184809f},
-std::array<float,2>{0.853862464f, 0.384073704f},
-std::array<float,2>{0.979870558f, 0.933498561f},
-std::array<float,2>{0.213814721f, 0.083266966f},
-std::array<float,2>{0.477203995f, 0.568698585f},
-std::array<float,2>{0.506702602f, 0.462348223f},
-std::array<float,2>{0.729837358f, 0.728481352f},
-std::array<float,2>{0.279620111f, 0.323379278f},
-std::array<float,2>{0.123575553f, 0.76259166f},
-std::array<float,2>{0.792529702f, 0.184840053f},
-std::array<float,2>{0.830718994f, 0.53088975f},
-std::array<float,2>{0.0431363881f, 0.417146832f},
-std::array<float,2>{0.364437819f, 0.953045785f},
-std::array<float,2>{0.655308723f, 0.0185224134f},
-std::array<float,2>{0.60169661f, 0.813916326f},
-std::array<float,2>{0.396608621f, 0.197514728f},
-std::array<float,2>{0.159492314f, 0.683512866f},
-std::array<float,2>{0.878885448f, 0.300427318f},
-std::array<float,2>{0.860343575f, 0.957935154f},
-std::array<float,2>{0.0234450903f, 0.0124382386f},
-std::array<float,2>{0.321518302f, 0.508710027f},
-std::array<float,2>{0.685211778f, 0.433707297f},
-std::array<float,2>{0.563131869f, 0.66909802f},
-std::array<float,2>{0.428365171f, 0.292974025f},
-std::array<float,2>{0.140705153f, 0.840651274f},
-std::array<float,2>{0.932593524f, 0.216168776f},
-std::array<float,2>{0.940064967f, 0.578398705f},
-std::array<float,2>{0.233206809f, 0.447975785f},
-std::array<float,2>{0.46467787f, 0.907786191f},
-std::array<float,2>{0.543288469f, 0.0737337992f},
-std::array<float,2>{0.716331482f, 0.774408102f},
-std::array<float,2>{0.301677078f, 0.1714219f},
-std::array<float,2>{0.0875896811f, 0.740767598f},
-std::array<float,2>{0.776757658f, 0.334885597f},
-std::array<float,2>{0.902874529f, 0.854102194f},
-std::array<float,2>{0.172187939f, 0.228318125f},
-std::array<float,2>{0.37830025f, 0.642412126f},
-std::array<float,2>{0.61209172f, 0.253628552f},
-std::array<float,2>{0.627192616f, 0.549507976f},
-std::array<float,2>{0.358734101f, 0.403953254f},
-std::array<float,2>{0.0596481003f, 0.996713638f},
-std::array<float,2>{0.823373318f, 0.0494999252f},
-std::array<float,2>{0.804295719f, 0.702714145f},
-std::array<float,2>{0.100333177f, 0.346502483f},
-std::array<float,2>{0.258290082f, 0.792030394f},
-std::array<float,2>{0.739574075f, 0.13339591f},
-std::array<float,2>{0.52757144f, 0.905237317f},
-std::array<float,2>{0.489528775f, 0.0964388698f},
-std::array<float,2>{0.191384628f, 0.604826808f},
-std::array<float,2>{0.992200434f, 0.47787559f},
-std::array<float,2>{0.816479623f, 0.829654396f},
-std::array<float,2>{0.0501583479f, 0.204659984f},
-std::array<float,2>{0.345432073f, 0.656609654f},
-std::array<float,2>{0.633395672f, 0.2825225f},
-std::array<float,2>{0.624949515f, 0.506811559f},
-std::array<float,2>{0.387561142f, 0.425821841f},
-std::array<float,2>{0.182874277f, 0.963767648f},
-std::array<float,2>{0.895153463f, 0.000923777174f},
-std::array<float,2>{0.989724755f, 0.748361468f},
-std::array<float,2>{0.197475553f, 0.342407793f},
-std::array<float,2>{0.493221939f, 0.77140373f},
-std::array<float,2>{0.523018241f, 0.157959774f},
-std::array<float,2>{0.74989146f, 0.915299773f},
-std::array<float,2>{0.251401246f, 0.0637145862f},
-std::array<float,2>{0.105760626f, 0.591369748f},
-std::array<float,2>{0.810805559f, 0.43908298f},
-std::array<float,2>{0.925836325f, 0.98950547f},
-std::array<float,2>{0.154406354f, 0.0589630343f},
-std::array<float,2>{0.434762925f, 0.559847355f},
-std::array<float,2>{0.570344388f, 0.393184811f},
-std::array<float,2>{0.67668134f, 0.650411606f},
-std::array<float,2>{0.314141363f, 0.259949654f},
-std::array<float,2>{0.0206852239f, 0.850628495f},
-std::array<float,2>{0.872951508f, 0.221029162f},
-std::array<float,2>{0.77291292f, 0.601189375f},
-std::array<float,2>{0.0843404382f, 0.476032048f},
-std::array<float,2>{0.305988252f, 0.894209027f},
-std::array<float,2>{0.704335213f, 0.108949721f},
-std::array<float,2>{0.535313547f, 0.787710011f},
-std::array<float,2>{0.45733434f, 0.128463477f},
-std::array<float,2>{0.226498917f, 0.695290685f},
-std::array<float,2>{0.952040732f, 0.358952612f},
-std::array<float,2>{0.784408689f, 0.884565353f},
-std::array<float,2>{0.113726459f, 0.115429975f},
-std::array<float,2>{0.266077131f, 0.613860786f},
-std::array<float,2>{0.725763679f, 0.497758359f},
-std::array<float,2>{0.512048244f, 0.717279911f},
-std::array<float,2>{0.47052598f, 0.37185517f},
-std::array<float,2>{0.209447473f, 0.800624549f},
-std::array<float,2>{0.970032096f, 0.149779022f},
-std::array<float,2>{0.886759818f, 0.531787634f},
-std::array<float,2>{0.170533478f, 0.377150089f},
-std::array<float,2>{0.404020905f, 0.979796052f},
-std::array<float,2>{0.601123214f, 0.0393857732f},
-std::array<float,2>{0.642433465f, 0.871771097f},
-std::array<float,2>{0.369050264f, 0.237184748f},
-std::array<float,2>{0.032116849f, 0.629558086f},
-std::array<float,2>{0.839280784f, 0.275191605f},
-std::array<float,2>{0.962225258f, 0.752662957f},
-std::array<float,2>{0.240044877f, 0.174411863f},
-std::array<float,2>{0.44875744f, 0.719082236f},
-std::array<float,2>{0.559800982f, 0.31636554f},
-std::array<float,2>{0.689132154f, 0.571651578f},
-std::array<float,2>{0.2968117f, 0.457138836f},
-std::array<float,2>{0.0671073645f, 0.92607969f},
-std::array<float,2>{0.761233747f, 0.0916763619f},
-std::array<float,2>{0.848376751f, 0.672236025f},
-std::array<float,2>{0.00794201065f, 0.311270297f},
-std::array<float,2>{0.338343382f, 0.824441493f},
-std::array<float,2>{0.662373424f, 0.191565514f},
-std::array<float,2>{0.589864075f, 0.939617515f},
-std::array<float,2>{0.41276148f, 0.0263227709f},
-std::array<float,2>{0.140149981f, 0.520206511f},
-std::array<float,2>{0.920364797f, 0.412216693f},
-std::array<float,2>{0.769683719f, 0.850347936f},
-std::array<float,2>{0.0834071487f, 0.222126469f},
-std::array<float,2>{0.307061285f, 0.651819885f},
-std::array<float,2>{0.705266953f, 0.261469722f},
-std::array<float,2>{0.538567364f, 0.55897516f},
-std::array<float,2>{0.459761441f, 0.394423336f},
-std::array<float,2>{0.223952636f, 0.988728344f},
-std::array<float,2>{0.950811028f, 0.0598514043f},
-std::array<float,2>{0.928404868f, 0.694136024f},
-std::array<float,2>{0.152662262f, 0.357468933f},
-std::array<float,2>{0.436353743f, 0.788196266f},
-std::array<float,2>{0.572403431f, 0.127559692f},
-std::array<float,2>{0.678829789f, 0.893548727f},
-std::array<float,2>{0.315706402f, 0.108134925f},
-std::array<float,2>{0.0224527139f, 0.599810064f},
-std::array<float,2>{0.874171138f, 0.475223064f},
-std::array<float,2>{0.990873575f, 0.964797258f},
-std::array<float,2>{0.196499005f, 0.00156937889f},
-std::array<float,2>{0.495251179f, 0.506952047f},
-std::array<float,2>{0.520243764f, 0.427577585f},
-std::array<float,2>{0.747163534f, 0.658014834f},
-std::array<float,2>{0.253862292f, 0.282097101f},
-std::array<float,2>{0.108869247f, 0.828159094f},
-std::array<float,2>{0.809340358f, 0.2040115f},
-std::array<float,2>{0.819500089f, 0.59069562f},
-std::array<float,2>{0.0470856801f, 0.438438565f},
-std::array<float,2>{0.345940709f, 0.91456002f},
-std::array<float,2>{0.634872794f, 0.0632113367f},
-std::array<float,2>{0.622837245f, 0.770022333f},
-std::array<float,2>{0.390266508f, 0.156613946f},
-std::array<float,2>{0.180620641f, 0.749544203f},
-std::array<float,2>{0.897421598f, 0.34361276f},
-std::array<float,2>{0.850489855f, 0.927148044f},
-std::array<float,2>{0.0115887206f, 0.0899163261f},
-std::array<float,2>{0.337410778f, 0.570465803f},
-std::array<float,2>{0.660330892f, 0.458037347f},
-std::array<float,2>{0.593577266f, 0.719988585f},
-std::array<float,2>{0.411004692f, 0.314660579f},
-std::array<float,2>{0.138229012f, 0.75302875f},
-std::array<float,2>{0.918860316f, 0.174908116f},
-std::array<float,2>{0.964728475f, 0.52132225f},
-std::array<float,2>{0.240466774f, 0.413573295f},
-std::array<float,2>{0.447086304f, 0.940716445f},
-std::array<float,2>{0.561644912f, 0.0269505531f},
-std::array<float,2>{0.691334665f, 0.825752616f},
-std::array<float,2>{0.294553399f, 0.193031833f},
-std::array<float,2>{0.0702147335f, 0.67320013f},
-std::array<float,2>{0.759717345f, 0.311680794f},
-std::array<float,2>{0.888980508f, 0.798839509f},
-std::array<float,2>{0.168761566f, 0.149157256f},
-std::array<float,2>{0.406104565f, 0.718305349f},
-std::array<float,2>{0.599460959f, 0.372746944f},
-std::array<float,2>{0.643380582f, 0.614626944f},
-std::array<float,2>{0.370058358f, 0.496373951f},
-std::array<float,2>{0.0342135951f, 0.883241832f},
-std::array<float,2>{0.837070644f, 0.116998345f},
-std::array<float,2>{0.782942176f, 0.630735517f},
-std::array<float,2>{0.116131291f, 0.273763031f},
-std::array<float,2>{0.269407421f, 0.872872055f},
-std::array<float,2>{0.723497748f, 0.238180876f},
-std::array<float,2>{0.514128685f, 0.97872144f},
-std::array<float,2>{0.470741987f, 0.0406012796f},
-std::array<float,2>{0.208944991f, 0.532650113f},
-std::array<float,2>{0.971254468f, 0.378591388f},
-std::array<float,2>{0.829715073f, 0.762757361f},
-std::array<float,2>{0.0453365073f, 0.183890015f},
-std::array<float,2>{0.367132038f, 0.727390349f},
-std::array<float,2>{0.653037608f, 0.322514683f},
-std::array<float,2>{0.604883194f, 0.570272863f},
-std::array<float,2>{0.396393806f, 0.461884201f},
-std::array<float,2>{0.157250628f, 0.931792021f},
-std::array<float,2>{0.876929283f, 0.082820937f},
-std::array<float,2>{0.977353811f, 0.682370365f},
-std::array<float,2>{0.211447448f, 0.299022168f},
-std::array<float,2>{0.479219347f, 0.812804639f},
-std::array<float,2>{0.504636586f, 0.199017376f},
-std::array<float,2>{0.726799488f, 0.951910436f},
-std::array<float,2>{0.277404189f, 0.0190671571f},
-std::array<float,2>{0.121466696f, 0.529987156f},
-std::array<float,2>{0.790232658f, 0.416869134f},
-std::array<float,2>{0.908196032f, 0.880362689f},
-std::array<float,2>{0.130095229f, 0.118248641f},
-std::array<float,2>{0.416105539f, 0.621232986f},
-std::array<float,2>{0.581148326f, 0.491617292f},
-std::array<float,2>{0.66538316f, 0.709486902f},
-std::array<float,2>{0.330872774f, 0.362366647f},
-std::array<float,2>{0.00708145415f, 0.806133211f},
-std::array<float,2>{0.852603734f, 0.146060586f},
-std::array<float,2>{0.751991212f, 0.540623903f},
-std::array<float,2>{0.072366707f, 0.383059144f},
-std::array<float,2>{0.281804442f, 0.973123789f},
-std::array<float,2>{0.702034593f, 0.0315682404f},
-std::array<float,2>{0.547124386f, 0.862751365f},
-std::array<float,2>{0.442849129f, 0.24289611f},
-std::array<float,2>{0.243049011f, 0.634883165f},
-std::array<float,2>{0.957339466f, 0.27250573f},
-std::array<float,2>{0.801356375f, 0.997137845f},
-std::array<float,2>{0.0978797302f, 0.0505574495f},
-std::array<float,2>{0.260280579f, 0.550133705f},
-std::array<float,2>{0.741753697f, 0.403216779f},
-std::array<float,2>{0.531228721f, 0.641463637f},
-std::array<float,2>{0.491894454f, 0.252311468f},
-std::array<float,2>{0.189074948f, 0.854555428f},
-std::array<float,2>{0.996043861f, 0.226894394f},
-std::array<float,2>{0.905150175f, 0.604405165f},
-std::array<float,2>{0.175731748f, 0.476770133f},
-std::array<float,2>{0.375565976f, 0.905485153f},
-std::array<float,2>{0.610431075f, 0.0968646556f},
-std::array<float,2>{0.62672168f, 0.791465104f},
-std::array<float,2>{0.355964571f, 0.13391237f},
-std::array<float,2>{0.0612676032f, 0.70191139f},
-std::array<float,2>{0.820371449f, 0.3468799f},
-std::array<float,2>{0.937701523f, 0.841590405f},
-std::array<float,2>{0.230939463f, 0.215636373f},
-std::array<float,2>{0.461219937f, 0.668130875f},
-std::array<float,2>{0.545679808f, 0.294836849f},
-std::array<float,2>{0.718427658f, 0.509306848f},
-std::array<float,2>{0.30332166f, 0.435165942f},
-std::array<float,2>{0.0893078819f, 0.958526075f},
-std::array<float,2>{0.774544656f, 0.0128849633f},
-std::array<float,2>{0.862905562f, 0.741579533f},
-std::array<float,2>{0.0263063945f, 0.335063756f},
-std::array<float,2>{0.323903918f, 0.775137901f},
-std::array<float,2>{0.687233269f, 0.170046851f},
-std::array<float,2>{0.565108299f, 0.906293452f},
-std::array<float,2>{0.427338153f, 0.0726744607f},
-std::array<float,2>{0.14412801f, 0.57944864f},
-std::array<float,2>{0.931425214f, 0.448986918f},
-std::array<float,2>{0.796204031f, 0.782332778f},
-std::array<float,2>{0.11881531f, 0.1312626f},
-std::array<float,2>{0.274126858f, 0.69028461f},
-std::array<float,2>{0.731237948f, 0.353560686f},
-std::array<float,2>{0.502504051f, 0.594632089f},
-std::array<float,2>{0.483521581f, 0.471243948f},
-std::array<float,2>{0.216596156f, 0.896016002f},
-std::array<float,2>{0.982806921f, 0.103739686f},
-std::array<float,2>{0.882809162f, 0.654226482f},
-std::array<float,2>{0.162572876f, 0.262248695f},
-std::array<float,2>{0.394355983f, 0.844101846f},
-std::array<float,2>{0.606190383f, 0.224564791f},
-std::array<float,2>{0.649424672f, 0.986065626f},
-std::array<float,2>{0.361459613f, 0.0583448149f},
-std::array<float,2>{0.0400231443f, 0.557938576f},
-std::array<float,2>{0.835916877f, 0.397976667f},
-std::array<float,2>{0.955208898f, 0.920309842f},
-std::array<float,2>{0.2476383f, 0.0702303424f},
-std::array<float,2>{0.440263778f, 0.588355422f},
-std::array<float,2>{0.55275172f, 0.44254598f},
-std::array<float,2>{0.696915984f, 0.743896365f},
-std::array<float,2>{0.285297424f, 0.336461812f},
-std::array<float,2>{0.0753086135f, 0.767260253f},
-std::array<float,2>{0.754275322f, 0.160281852f},
-std::array<float,2>{0.858738005f, 0.500177145f},
-std::array<float,2>{0.00108199206f, 0.422482759f},
-std::array<float,2>{0.332927406f, 0.965121806f},
-std::array<float,2>{0.671187818f, 0.0076173027f},
-std::array<float,2>{0.583343089f, 0.833150804f},
-std::array<float,2>{0.421592444f, 0.208616495f},
-std::array<float,2>{0.127212286f, 0.661410272f},
-std::array<float,2>{0.910465896f, 0.286410719f},
-std::array<float,2>{0.826227307f, 0.942053258f},
-std::array<float,2>{0.0556797981f, 0.028661713f},
-std::array<float,2>{0.354579002f, 0.517970026f},
-std::array<float,2>{0.629618227f, 0.408996344f},
-std::array<float,2>{0.613534629f, 0.677288175f},
-std::array<float,2>{0.382004708f, 0.307255447f},
-std::array<float,2>{0.178871065f, 0.820410073f},
-std::array<float,2>{0.900371373f, 0.19064559f},
-std::array<float,2>{0.998582661f, 0.576370955f},
-std::array<float,2>{0.195307285f, 0.453694522f},
-std::array<float,2>{0.48594448f, 0.924325705f},
-std::array<float,2>{0.525227129f, 0.0885185227f},
-std::array<float,2>{0.736604214f, 0.756106198f},
-std::array<float,2>{0.26366964f, 0.178248852f},
-std::array<float,2>{0.0939626768f, 0.725265563f},
-std::array<float,2>{0.797483206f, 0.319798201f},
-std::array<float,2>{0.936967731f, 0.869804084f},
-std::array<float,2>{0.146113947f, 0.239192605f},
-std::array<float,2>{0.422691375f, 0.628758311f},
-std::array<float,2>{0.569968045f, 0.280469626f},
-std::array<float,2>{0.681979954f, 0.538991332f},
-std::array<float,2>{0.32720831f, 0.379813731f},
-std::array<float,2>{0.0278432984f, 0.983905077f},
-std::array<float,2>{0.864253998f, 0.0451548472f},
-std::array<float,2>{0.777724445f, 0.711178303f},
-std::array<float,2>{0.091648981f, 0.370481908f},
-std::array<float,2>{0.29837808f, 0.803536892f},
-std::array<float,2>{0.713265359f, 0.155272305f},
-std::array<float,2>{0.54293406f, 0.887330294f},
-std::array<float,2>{0.467344433f, 0.111680612f},
-std::array<float,2>{0.228541508f, 0.611584723f},
-std::array<float,2>{0.941979468f, 0.494476229f},
-std::array<float,2>{0.868552089f, 0.820029318f},
-std::array<float,2>{0.0166141186f, 0.200558528f},
-std::array<float,2>{0.319238514f, 0.686397612f},
-std::array<float,2>{0.675634146f, 0.301834464f},
-std::array<float,2>{0.577917039f, 0.52512145f},
-std::array<float,2>{0.433026493f, 0.418256164f},
-std::array<float,2>{0.15174745f, 0.948748291f},
-std::array<float,2>{0.922510386f, 0.023232514f},
-std::array<float,2>{0.948328912f, 0.734070837f},
-std::array<float,2>{0.220465839f, 0.327290207f},
-std::array<float,2>{0.455600888f, 0.759166539f},
-std::array<float,2>{0.531842351f, 0.183488652f},
-std::array<float,2>{0.710422873f, 0.936762512f},
-std::array<float,2>{0.310243547f, 0.0781386942f},
-std::array<float,2>{0.078271918f, 0.566181362f},
-std::array<float,2>{0.767063797f, 0.467764705f},
-std::array<float,2>{0.892433167f, 0.970564902f},
-std::array<float,2>{0.184502676f, 0.0366603397f},
-std::array<float,2>{0.385908991f, 0.545708239f},
-std::array<float,2>{0.620304823f, 0.389780402f},
-std::array<float,2>{0.637928188f, 0.640118361f},
-std::array<float,2>{0.350711256f, 0.26775834f},
-std::array<float,2>{0.054533191f, 0.865859389f},
-std::array<float,2>{0.815455735f, 0.247158155f},
-std::array<float,2>{0.808011174f, 0.618221402f},
-std::array<float,2>{0.101824895f, 0.485196531f},
-std::array<float,2>{0.256400168f, 0.875765264f},
-std::array<float,2>{0.74363941f, 0.122916728f},
-std::array<float,2>{0.518062353f, 0.812050521f},
-std::array<float,2>{0.499909878f, 0.143291757f},
-std::array<float,2>{0.19942835f, 0.706122816f},
-std::array<float,2>{0.987125337f, 0.365525752f},
-std::array<float,2>{0.764569879f, 0.899338365f},
-std::array<float,2>{0.0645544007f, 0.101045057f},
-std::array<float,2>{0.289793342f, 0.60749048f},
-std::array<float,2>{0.692324638f, 0.482862622f},
-std::array<float,2>{0.555891454f, 0.69827044f},
-std::array<float,2>{0.452341855f, 0.349950135f},
-std::array<float,2>{0.236513674f, 0.795165122f},
-std::array<float,2>{0.96506536f, 0.139331162f},
-std::array<float,2>{0.914532959f, 0.550862551f},
-std::array<float,2>{0.136715904f, 0.400702626f},
-std::array<float,2>{0.407636911f, 0.99502039f},
-std::array<float,2>{0.587409079f, 0.051685594f},
-std::array<float,2>{0.660063922f, 0.8578493f},
-std::array<float,2>{0.342041582f, 0.233583316f},
-std::array<float,2>{0.0118136415f, 0.644986868f},
-std::array<float,2>{0.846948564f, 0.256224722f},
-std::array<float,2>{0.974025249f, 0.778738201f},
-std::array<float,2>{0.205061242f, 0.167207241f},
-std::array<float,2>{0.474873722f, 0.736018002f},
-std::array<float,2>{0.509835899f, 0.331698149f},
-std::array<float,2>{0.719564319f, 0.583192885f},
-std::array<float,2>{0.271502972f, 0.451496124f},
-std::array<float,2>{0.110729605f, 0.911651611f},
-std::array<float,2>{0.785645008f, 0.0759114996f},
-std::array<float,2>{0.843685508f, 0.667441607f},
-std::array<float,2>{0.0355104581f, 0.290629148f},
-std::array<float,2>{0.374757588f, 0.836931586f},
-std::array<float,2>{0.646177471f, 0.213410899f},
-std::array<float,2>{0.594916999f, 0.954052269f},
-std::array<float,2>{0.400892138f, 0.0106316879f},
-std::array<float,2>{0.167184457f, 0.513360262f},
-std::array<float,2>{0.882917941f, 0.429863691f},
-std::array<float,2>{0.810654998f, 0.831181109f},
-std::array<float,2>{0.105669841f, 0.205894947f},
-std::array<float,2>{0.251095176f, 0.658324957f},
-std::array<float,2>{0.749618351f, 0.283513248f},
-std::array<float,2>{0.523290932f, 0.505293667f},
-std::array<float,2>{0.493546635f, 0.42777735f},
-std::array<float,2>{0.197721601f, 0.961177111f},
-std::array<float,2>{0.989427805f, 0.00277867494f},
-std::array<float,2>{0.895418644f, 0.746192098f},
-std::array<float,2>{0.182720542f, 0.340775192f},
-std::array<float,2>{0.387334347f, 0.772503674f},
-std::array<float,2>{0.624720395f, 0.159778595f},
-std::array<float,2>{0.633586764f, 0.916933596f},
-std::array<float,2>{0.345483184f, 0.0645709261f},
-std::array<float,2>{0.0499105491f, 0.593655944f},
-std::array<float,2>{0.816887915f, 0.441083074f},
-std::array<float,2>{0.951790214f, 0.990793169f},
-std::array<float,2>{0.226218268f, 0.0619572252f},
-std::array<float,2>{0.457241565f, 0.562001944f},
-std::array<float,2>{0.535432816f, 0.390698433f},
-std::array<float,2>{0.704364836f, 0.650141954f},
-std::array<float,2>{0.305861354f, 0.258055568f},
-std::array<float,2>{0.0841640979f, 0.849561036f},
-std::array<float,2>{0.772628784f, 0.220075592f},
-std::array<float,2>{0.872559905f, 0.598241568f},
-std::array<float,2>{0.020865418f, 0.473851085f},
-std::array<float,2>{0.314248651f, 0.891553044f},
-std::array<float,2>{0.67634201f, 0.107333601f},
-std::array<float,2>{0.570693851f, 0.785450161f},
-std::array<float,2>{0.434935808f, 0.125229299f},
-std::array<float,2>{0.154679641f, 0.692254007f},
-std::array<float,2>{0.926248312f, 0.356010735f},
-std::array<float,2>{0.838895202f, 0.88488704f},
-std::array<float,2>{0.0317408442f, 0.114765316f},
-std::array<float,2>{0.368717611f, 0.616779685f},
-std::array<float,2>{0.642302275f, 0.498916835f},
-std::array<float,2>{0.601343632f, 0.715526044f},
-std::array<float,2>{0.404231638f, 0.373328358f},
-std::array<float,2>{0.170743704f, 0.797650337f},
-std::array<float,2>{0.88696599f, 0.150824115f},
-std::array<float,2>{0.969958663f, 0.533461571f},
-std::array<float,2>{0.209040239f, 0.375239819f},
-std::array<float,2>{0.470408797f, 0.97738713f},
-std::array<float,2>{0.51185286f, 0.0417697057f},
-std::array<float,2>{0.726049423f, 0.873357832f},
-std::array<float,2>{0.265655071f, 0.234560698f},
-std::array<float,2>{0.113461249f, 0.632009149f},
-std::array<float,2>{0.784472644f, 0.276057333f},
-std::array<float,2>{0.919966161f, 0.750089765f},
-std::array<float,2>{0.140585452f, 0.172499031f},
-std::array<float,2>{0.413021147f, 0.72253716f},
-std::array<float,2>{0.590171158f, 0.313943863f},
-std::array<float,2>{0.662215889f, 0.573897421f},
-std::array<float,2>{0.338100076f, 0.460113406f},
-std::array<float,2>{0.00820061099f, 0.929322362f},
-std::array<float,2>{0.848618209f, 0.0923435837f},
-std::array<float,2>{0.761479974f, 0.675125599f},
-std::array<float,2>{0.0671600029f, 0.308782309f},
-std::array<float,2>{0.296444684f, 0.82716006f},
-std::array<float,2>{0.689422727f, 0.193706512f},
-std::array<float,2>{0.559840262f, 0.93894434f},
-std::array<float,2>{0.449035496f, 0.0245830603f},
-std::array<float,2>{0.239775807f, 0.522031486f},
-std::array<float,2>{0.961992383f, 0.411839485f},
-std::array<float,2>{0.853586376f, 0.807062268f},
-std::array<float,2>{0.00567689817f, 0.147636458f},
-std::array<float,2>{0.328799099f, 0.707525849f},
-std::array<float,2>{0.666697025f, 0.36020422f},
-std::array<float,2>{0.579677999f, 0.623653054f},
-std::array<float,2>{0.414795667f, 0.48889336f},
-std::array<float,2>{0.131515816f, 0.881751776f},
-std::array<float,2>{0.909468055f, 0.119232215f},
-std::array<float,2>{0.96014303f, 0.634631932f},
-std::array<float,2>{0.244709194f, 0.271001279f},
-std::array<float,2>{0.444477975f, 0.860108137f},
-std::array<float,2>{0.54894042f, 0.245337754f},
-std::array<float,2>{0.701062024f, 0.976406217f},
-std::array<float,2>{0.283759177f, 0.0339789055f},
-std::array<float,2>{0.0719860569f, 0.542132914f},
-std::array<float,2>{0.750763953f, 0.385542184f},
-std::array<float,2>{0.878557682f, 0.931369185f},
-std::array<float,2>{0.159410194f, 0.0846777633f},
-std::array<float,2>{0.396891236f, 0.566806614f},
-std::array<float,2>{0.601907194f, 0.463856936f},
-std::array<float,2>{0.655535579f, 0.728854895f},
-std::array<float,2>{0.364524901f, 0.320413798f},
-std::array<float,2>{0.0433543213f, 0.764359653f},
-std::array<float,2>{0.830920696f, 0.186174721f},
-std::array<float,2>{0.792817414f, 0.528321147f},
-std::array<float,2>{0.123865277f, 0.415750831f},
-std::array<float,2>{0.27938965f, 0.950466514f},
-std::array<float,2>{0.72960794f, 0.0170261413f},
-std::array<float,2>{0.506348133f, 0.816157877f},
-std::array<float,2>{0.477383345f, 0.197122931f},
-std::array<float,2>{0.213510379f, 0.679807365f},
-std::array<float,2>{0.979621708f, 0.297421753f},
-std::array<float,2>{0.776544154f, 0.960210741f},
-std::array<float,2>{0.087890029f, 0.0153696453f},
-std::array<float,2>{0.301407307f, 0.509963572f},
-std::array<float,2>{0.71677345f, 0.436827242f},
-std::array<float,2>{0.543003321f, 0.671417654f},
-std::array<float,2>{0.464588672f, 0.295450807f},
-std::array<float,2>{0.232954413f, 0.842231989f},
-std::array<float,2>{0.940306544f, 0.218404159f},
-std::array<float,2>{0.932368159f, 0.581432164f},
-std::array<float,2>{0.140954316f, 0.446118385f},
-std::array<float,2>{0.428635746f, 0.910044909f},
-std::array<float,2>{0.563354492f, 0.0709405094f},
-std::array<float,2>{0.685403764f, 0.775985062f},
-std::array<float,2>{0.321557313f, 0.169272125f},
-std::array<float,2>{0.0237789862f, 0.73923713f},
-std::array<float,2>{0.859890759f, 0.332709551f},
-std::array<float,2>{0.992532194f, 0.8525334f},
-std::array<float,2>{0.191133916f, 0.22861591f},
-std::array<float,2>{0.489390194f, 0.643681049f},
-std::array<float,2>{0.527804971f, 0.250270277f},
-std::array<float,2>{0.739425004f, 0.546920657f},
-std::array<float,2>{0.258048803f, 0.404995143f},
-std::array<float,2>{0.100525141f, 0.999053955f},
-std::array<float,2>{0.804486811f, 0.0487741344f},
-std::array<float,2>{0.823526323f, 0.699570656f},
-std::array<float,2>{0.0598475374f, 0.344029397f},
-std::array<float,2>{0.358624727f, 0.7899822f},
-std::array<float,2>{0.627425194f, 0.136349112f},
-std::array<float,2>{0.611901462f, 0.903077185f},
-std::array<float,2>{0.378152162f, 0.0950590447f},
-std::array<float,2>{0.172047615f, 0.601897836f},
-std::array<float,2>{0.903234899f, 0.479586393f},
-std::array<float,2>{0.756068707f, 0.767884612f},
-std::array<float,2>{0.0765985847f, 0.163715139f},
-std::array<float,2>{0.287709832f, 0.744843423f},
-std::array<float,2>{0.698008239f, 0.339356035f},
-std::array<float,2>{0.552688181f, 0.587074757f},
-std::array<float,2>{0.439258337f, 0.444082469f},
-std::array<float,2>{0.249448776f, 0.918129265f},
-std::array<float,2>{0.954175234f, 0.0669456795f},
-std::array<float,2>{0.913833857f, 0.663952172f},
-std::array<float,2>{0.125695795f, 0.287898839f},
-std::array<float,2>{0.419288516f, 0.834413707f},
-std::array<float,2>{0.585933685f, 0.210395887f},
-std::array<float,2>{0.668681324f, 0.967199683f},
-std::array<float,2>{0.335098654f, 0.00424352707f},
-std::array<float,2>{0.00344190141f, 0.503026366f},
-std::array<float,2>{0.855839372f, 0.42501694f},
-std::array<float,2>{0.980770648f, 0.897542357f},
-std::array<float,2>{0.218259022f, 0.103345126f},
-std::array<float,2>{0.481939822f, 0.597592831f},
-std::array<float,2>{0.501833677f, 0.469194889f},
-std::array<float,2>{0.733124256f, 0.688530087f},
-std::array<float,2>{0.276704162f, 0.351715088f},
-std::array<float,2>{0.120912641f, 0.784421146f},
-std::array<float,2>{0.793360651f, 0.13047196f},
-std::array<float,2>{0.832206368f, 0.555871367f},
-std::array<float,2>{0.0427940376f, 0.395118356f},
-std::array<float,2>{0.360789508f, 0.987158597f},
-std::array<float,2>{0.651335299f, 0.0565793552f},
-std::array<float,2>{0.607580662f, 0.845950842f},
-std::array<float,2>{0.390818119f, 0.225880831f},
-std::array<float,2>{0.161814496f, 0.654841185f},
-std::array<float,2>{0.879762352f, 0.26537776f},
-std::array<float,2>{0.86687237f, 0.980562031f},
-std::array<float,2>{0.0304016508f, 0.0436042845f},
-std::array<float,2>{0.325141191f, 0.536201715f},
-std::array<float,2>{0.681334317f, 0.381839275f},
-std::array<float,2>{0.566420197f, 0.626551926f},
-std::array<float,2>{0.424880952f, 0.277811825f},
-std::array<float,2>{0.146916673f, 0.867392302f},
-std::array<float,2>{0.934528232f, 0.242009163f},
-std::array<float,2>{0.944351971f, 0.610540688f},
-std::array<float,2>{0.226664126f, 0.492726833f},
-std::array<float,2>{0.466006935f, 0.890348732f},
-std::array<float,2>{0.539910376f, 0.111091711f},
-std::array<float,2>{0.712865949f, 0.802327216f},
-std::array<float,2>{0.300472528f, 0.154026255f},
-std::array<float,2>{0.091958724f, 0.714652777f},
-std::array<float,2>{0.779653847f, 0.368107319f},
-std::array<float,2>{0.902071178f, 0.823482215f},
-std::array<float,2>{0.177143931f, 0.187603176f},
-std::array<float,2>{0.380849153f, 0.679428875f},
-std::array<float,2>{0.616506159f, 0.305919588f},
-std::array<float,2>{0.631855667f, 0.517345667f},
-std::array<float,2>{0.352656037f, 0.406364471f},
-std::array<float,2>{0.0571047217f, 0.944166958f},
-std::array<float,2>{0.825002789f, 0.0301900115f},
-std::array<float,2>{0.799322248f, 0.724280953f},
-std::array<float,2>{0.0961344838f, 0.317560643f},
-std::array<float,2>{0.265519142f, 0.755490303f},
-std::array<float,2>{0.735346317f, 0.177586794f},
-std::array<float,2>{0.526656032f, 0.923737645f},
-std::array<float,2>{0.487093151f, 0.0865121186f},
-std::array<float,2>{0.192437515f, 0.575501442f},
-std::array<float,2>{0.997997999f, 0.455469668f},
-std::array<float,2>{0.812644064f, 0.863858521f},
-std::array<float,2>{0.0509581789f, 0.248832092f},
-std::array<float,2>{0.348465234f, 0.63675648f},
-std::array<float,2>{0.639095426f, 0.265981376f},
-std::array<float,2>{0.61879307f, 0.543103456f},
-std::array<float,2>{0.384277344f, 0.388238758f},
-std::array<float,2>{0.186472088f, 0.971811116f},
-std::array<float,2>{0.89439106f, 0.0375879481f},
-std::array<float,2>{0.985692024f, 0.703643799f},
-std::array<float,2>{0.201243818f, 0.363678485f},
-std::array<float,2>{0.496569633f, 0.808827221f},
-std::array<float,2>{0.517381549f, 0.142161518f},
-std::array<float,2>{0.745905757f, 0.877647817f},
-std::array<float,2>{0.255605936f, 0.123160549f},
-std::array<float,2>{0.103933103f, 0.619763494f},
-std::array<float,2>{0.805180609f, 0.488185346f},
-std::array<float,2>{0.923952818f, 0.946744025f},
-std::array<float,2>{0.148871779f, 0.0202691592f},
-std::array<float,2>{0.43022266f, 0.525673926f},
-std::array<float,2>{0.575391889f, 0.420122832f},
-std::array<float,2>{0.672188044f, 0.68536371f},
-std::array<float,2>{0.318000585f, 0.304522127f},
-std::array<float,2>{0.0179021489f, 0.818132937f},
-std::array<float,2>{0.870406091f, 0.202612817f},
-std::array<float,2>{0.768341124f, 0.563777447f},
-std::array<float,2>{0.0802193433f, 0.46511665f},
-std::array<float,2>{0.312032729f, 0.935183048f},
-std::array<float,2>{0.708741069f, 0.0813629851f},
-std::array<float,2>{0.534600496f, 0.761517227f},
-std::array<float,2>{0.454374462f, 0.179778874f},
-std::array<float,2>{0.22232683f, 0.731350958f},
-std::array<float,2>{0.946781158f, 0.325558364f},
-std::array<float,2>{0.788796723f, 0.912275136f},
-std::array<float,2>{0.112722963f, 0.0776040554f},
-std::array<float,2>{0.270580113f, 0.585173368f},
-std::array<float,2>{0.721310139f, 0.45030722f},
-std::array<float,2>{0.50887692f, 0.737221181f},
-std::array<float,2>{0.472999334f, 0.329944015f},
-std::array<float,2>{0.20624125f, 0.78096813f},
-std::array<float,2>{0.975032508f, 0.1648812f},
-std::array<float,2>{0.88519305f, 0.51552552f},
-std::array<float,2>{0.165922463f, 0.433245242f},
-std::array<float,2>{0.399781078f, 0.95522666f},
-std::array<float,2>{0.597596765f, 0.00938231777f},
-std::array<float,2>{0.64707768f, 0.839750767f},
-std::array<float,2>{0.372994989f, 0.211536422f},
-std::array<float,2>{0.0388467535f, 0.665297806f},
-std::array<float,2>{0.841509759f, 0.291051328f},
-std::array<float,2>{0.967850327f, 0.794646204f},
-std::array<float,2>{0.23552762f, 0.137326032f},
-std::array<float,2>{0.451005161f, 0.696071327f},
-std::array<float,2>{0.557190299f, 0.349044532f},
-std::array<float,2>{0.693533361f, 0.607364595f},
-std::array<float,2>{0.291330993f, 0.48192364f},
-std::array<float,2>{0.0631836802f, 0.900856018f},
-std::array<float,2>{0.763602078f, 0.0980486497f},
-std::array<float,2>{0.845685899f, 0.647014439f},
-std::array<float,2>{0.0142031023f, 0.255236655f},
-std::array<float,2>{0.341615826f, 0.856584013f},
-std::array<float,2>{0.656341493f, 0.230598837f},
-std::array<float,2>{0.589725852f, 0.993703604f},
-std::array<float,2>{0.408388525f, 0.053111054f},
-std::array<float,2>{0.133053318f, 0.554120839f},
-std::array<float,2>{0.916404545f, 0.398607731f},
-std::array<float,2>{0.757963181f, 0.826395452f},
-std::array<float,2>{0.0689339414f, 0.194364548f},
-std::array<float,2>{0.293445468f, 0.674364328f},
-std::array<float,2>{0.690266907f, 0.310018897f},
-std::array<float,2>{0.561478376f, 0.523198485f},
-std::array<float,2>{0.445640802f, 0.410321951f},
-std::array<float,2>{0.241555274f, 0.937633872f},
-std::array<float,2>{0.963017881f, 0.0242084991f},
-std::array<float,2>{0.919833779f, 0.721129358f},
-std::array<float,2>{0.137112528f, 0.31315434f},
-std::array<float,2>{0.411363006f, 0.751570046f},
-std::array<float,2>{0.592734814f, 0.173536867f},
-std::array<float,2>{0.66176331f, 0.927789211f},
-std::array<float,2>{0.336673558f, 0.0929349735f},
-std::array<float,2>{0.0105671696f, 0.572551966f},
-std::array<float,2>{0.850718498f, 0.45953697f},
-std::array<float,2>{0.97206068f, 0.97805953f},
-std::array<float,2>{0.207145423f, 0.0427668802f},
-std::array<float,2>{0.472100765f, 0.535034835f},
-std::array<float,2>{0.515104949f, 0.376168489f},
-std::array<float,2>{0.723710358f, 0.630868554f},
-std::array<float,2>{0.268288642f, 0.277245134f},
-std::array<float,2>{0.116262175f, 0.874273539f},
-std::array<float,2>{0.781883478f, 0.236267671f},
-std::array<float,2>{0.836648405f, 0.615940332f},
-std::array<float,2>{0.0335755907f, 0.499167889f},
-std::array<float,2>{0.371060461f, 0.885957778f},
-std::array<float,2>{0.64396733f, 0.113874331f},
-std::array<float,2>{0.597845137f, 0.797985017f},
-std::array<float,2>{0.404717684f, 0.151671529f},
-std::array<float,2>{0.16991502f, 0.716637254f},
-std::array<float,2>{0.89052695f, 0.374147683f},
-std::array<float,2>{0.873378098f, 0.891754448f},
-std::array<float,2>{0.0227588322f, 0.106268555f},
-std::array<float,2>{0.314711362f, 0.599203467f},
-std::array<float,2>{0.677856982f, 0.47358647f},
-std::array<float,2>{0.573602855f, 0.692694545f},
-std::array<float,2>{0.436646938f, 0.356764108f},
-std::array<float,2>{0.15343985f, 0.786547422f},
-std::array<float,2>{0.929500461f, 0.126018971f},
-std::array<float,2>{0.949908912f, 0.560592353f},
-std::array<float,2>{0.223207697f, 0.391628504f},
-std::array<float,2>{0.460133731f, 0.991969526f},
-std::array<float,2>{0.537178278f, 0.0614500009f},
-std::array<float,2>{0.706238151f, 0.848080158f},
-std::array<float,2>{0.30800274f, 0.218815982f},
-std::array<float,2>{0.0826078504f, 0.648888767f},
-std::array<float,2>{0.770535111f, 0.259288967f},
-std::array<float,2>{0.897801459f, 0.77191931f},
-std::array<float,2>{0.180796698f, 0.158561587f},
-std::array<float,2>{0.388917357f, 0.747420371f},
-std::array<float,2>{0.621762276f, 0.341787457f},
-std::array<float,2>{0.636264324f, 0.592021823f},
-std::array<float,2>{0.346725196f, 0.440198511f},
-std::array<float,2>{0.048788324f, 0.917419136f},
-std::array<float,2>{0.818769217f, 0.0654307753f},
-std::array<float,2>{0.810494423f, 0.660095334f},
-std::array<float,2>{0.107811391f, 0.285014957f},
-std::array<float,2>{0.252169132f, 0.830616474f},
-std::array<float,2>{0.746946931f, 0.206344232f},
-std::array<float,2>{0.520690918f, 0.962465346f},
-std::array<float,2>{0.494983673f, 0.00362698734f},
-std::array<float,2>{0.195638686f, 0.504660845f},
-std::array<float,2>{0.991810501f, 0.428882927f},
-std::array<float,2>{0.821451247f, 0.790487707f},
-std::array<float,2>{0.0617739223f, 0.135294691f},
-std::array<float,2>{0.356903136f, 0.700628698f},
-std::array<float,2>{0.625148594f, 0.344795197f},
-std::array<float,2>{0.609796464f, 0.602752626f},
-std::array<float,2>{0.376022488f, 0.479227424f},
-std::array<float,2>{0.174284384f, 0.903813899f},
-std::array<float,2>{0.90605247f, 0.094404906f},
-std::array<float,2>{0.994281828f, 0.642732024f},
-std::array<float,2>{0.188363656f, 0.251447976f},
-std::array<float,2>{0.490504861f, 0.852992237f},
-std::array<float,2>{0.530214131f, 0.229670048f},
-std::array<float,2>{0.74067992f, 0.998613f},
-std::array<float,2>{0.261224657f, 0.0471079387f},
-std::array<float,2>{0.0993238539f, 0.547884047f},
-std::array<float,2>{0.801813662f, 0.40536505f},
-std::array<float,2>{0.930154443f, 0.908338785f},
-std::array<float,2>{0.143016085f, 0.072201848f},
-std::array<float,2>{0.426154405f, 0.580343366f},
-std::array<float,2>{0.565877318f, 0.44664377f},
-std::array<float,2>{0.686154902f, 0.739434123f},
-std::array<float,2>{0.323169589f, 0.33395499f},
-std::array<float,2>{0.0266647786f, 0.776751757f},
-std::array<float,2>{0.861658096f, 0.168481931f},
-std::array<float,2>{0.773444712f, 0.510859668f},
-std::array<float,2>{0.0885729566f, 0.435966462f},
-std::array<float,2>{0.304459661f, 0.959482253f},
-std::array<float,2>{0.717003167f, 0.0140155526f},
-std::array<float,2>{0.545915663f, 0.843740165f},
-std::array<float,2>{0.462634355f, 0.217297927f},
-std::array<float,2>{0.231741771f, 0.670167565f},
-std::array<float,2>{0.938914716f, 0.296077162f},
-std::array<float,2>{0.789069295f, 0.949942112f},
-std::array<float,2>{0.122889817f, 0.0164689235f},
-std::array<float,2>{0.278332174f, 0.527395606f},
-std::array<float,2>{0.728025675f, 0.414931625f},
-std::array<float,2>{0.504922271f, 0.681522489f},
-std::array<float,2>{0.479836226f, 0.298237115f},
-std::array<float,2>{0.212389171f, 0.815345943f},
-std::array<float,2>{0.977606952f, 0.195852384f},
-std::array<float,2>{0.875257909f, 0.568156838f},
-std::array<float,2>{0.15655309f, 0.464114785f},
-std::array<float,2>{0.394712448f, 0.929707944f},
-std::array<float,2>{0.603755236f, 0.0850659385f},
-std::array<float,2>{0.653621316f, 0.764764607f},
-std::array<float,2>{0.365601152f, 0.186866403f},
-std::array<float,2>{0.0462830067f, 0.730276704f},
-std::array<float,2>{0.828785956f, 0.321594954f},
-std::array<float,2>{0.958386183f, 0.861322701f},
-std::array<float,2>{0.243894234f, 0.24446024f},
-std::array<float,2>{0.441440672f, 0.633166909f},
-std::array<float,2>{0.548213065f, 0.270490646f},
-std::array<float,2>{0.703097522f, 0.541647375f},
-std::array<float,2>{0.283182472f, 0.385919243f},
-std::array<float,2>{0.0739915073f, 0.975075483f},
-std::array<float,2>{0.753087342f, 0.0345852301f},
-std::array<float,2>{0.852220476f, 0.708552718f},
-std::array<float,2>{0.00634517753f, 0.360641122f},
-std::array<float,2>{0.331181794f, 0.807715714f},
-std::array<float,2>{0.664329529f, 0.146589741f},
-std::array<float,2>{0.580868721f, 0.882095337f},
-std::array<float,2>{0.417565107f, 0.120154962f},
-std::array<float,2>{0.129074857f, 0.624137223f},
-std::array<float,2>{0.906965137f, 0.489544541f},
-std::array<float,2>{0.798400402f, 0.754096687f},
-std::array<float,2>{0.0955454111f, 0.176133066f},
-std::array<float,2>{0.262361914f, 0.723564625f},
-std::array<float,2>{0.737953663f, 0.316974729f},
-std::array<float,2>{0.523760796f, 0.574311793f},
-std::array<float,2>{0.484466344f, 0.456443012f},
-std::array<float,2>{0.193967715f, 0.922601521f},
-std::array<float,2>{0.999554753f, 0.087667264f},
-std::array<float,2>{0.898627698f, 0.678694785f},
-std::array<float,2>{0.178045258f, 0.304854721f},
-std::array<float,2>{0.380897492f, 0.822902501f},
-std::array<float,2>{0.614786148f, 0.189448208f},
-std::array<float,2>{0.630511701f, 0.944527328f},
-std::array<float,2>{0.353628606f, 0.0311304312f},
-std::array<float,2>{0.0554677658f, 0.515771925f},
-std::array<float,2>{0.827353537f, 0.407479554f},
-std::array<float,2>{0.942700207f, 0.889322102f},
-std::array<float,2>{0.229746446f, 0.110047422f},
-std::array<float,2>{0.46789813f, 0.609676242f},
-std::array<float,2>{0.541301608f, 0.493435264f},
-std::array<float,2>{0.714513958f, 0.71373117f},
-std::array<float,2>{0.297147661f, 0.36836201f},
-std::array<float,2>{0.0903064758f, 0.801444113f},
-std::array<float,2>{0.778942108f, 0.153237253f},
-std::array<float,2>{0.865005136f, 0.535377264f},
-std::array<float,2>{0.0283585191f, 0.381323546f},
-std::array<float,2>{0.326443642f, 0.981524825f},
-std::array<float,2>{0.683184147f, 0.0442358926f},
-std::array<float,2>{0.56933099f, 0.868970513f},
-std::array<float,2>{0.422908574f, 0.240524575f},
-std::array<float,2>{0.145133436f, 0.625620484f},
-std::array<float,2>{0.93594873f, 0.278495759f},
-std::array<float,2>{0.834683895f, 0.987432837f},
-std::array<float,2>{0.0406267568f, 0.0548049398f},
-std::array<float,2>{0.362963408f, 0.55489558f},
-std::array<float,2>{0.649169624f, 0.396427244f},
-std::array<float,2>{0.606602013f, 0.655338585f},
-std::array<float,2>{0.393435895f, 0.264267951f},
-std::array<float,2>{0.163418964f, 0.84681958f},
-std::array<float,2>{0.881215632f, 0.225239947f},
-std::array<float,2>{0.984204531f, 0.596467078f},
-std::array<float,2>{0.214885861f, 0.470161259f},
-std::array<float,2>{0.483347267f, 0.897333503f},
-std::array<float,2>{0.503883779f, 0.101752251f},
-std::array<float,2>{0.731797278f, 0.7832461f},
-std::array<float,2>{0.274794638f, 0.129162431f},
-std::array<float,2>{0.117793642f, 0.688354433f},
-std::array<float,2>{0.795405447f, 0.353334874f},
-std::array<float,2>{0.911446154f, 0.835348725f},
-std::array<float,2>{0.128094241f, 0.209348693f},
-std::array<float,2>{0.420096338f, 0.662527502f},
-std::array<float,2>{0.582723498f, 0.288376659f},
-std::array<float,2>{0.670033872f, 0.502834022f},
-std::array<float,2>{0.333540589f, 0.424297869f},
-std::array<float,2>{0.000516712258f, 0.968239188f},
-std::array<float,2>{0.857565999f, 0.00532275578f},
-std::array<float,2>{0.755591452f, 0.745867848f},
-std::array<float,2>{0.0746870115f, 0.338151067f},
-std::array<float,2>{0.286503315f, 0.768666685f},
-std::array<float,2>{0.695421934f, 0.162212431f},
-std::array<float,2>{0.554521918f, 0.919879675f},
-std::array<float,2>{0.440906286f, 0.0677129552f},
-std::array<float,2>{0.246185333f, 0.585992992f},
-std::array<float,2>{0.956563592f, 0.444799811f},
-std::array<float,2>{0.846514523f, 0.856434405f},
-std::array<float,2>{0.0127708986f, 0.232077107f},
-std::array<float,2>{0.343395203f, 0.647861421f},
-std::array<float,2>{0.659068406f, 0.254092127f},
-std::array<float,2>{0.586416304f, 0.552928507f},
-std::array<float,2>{0.406649113f, 0.399686426f},
-std::array<float,2>{0.135070801f, 0.992569685f},
-std::array<float,2>{0.915944636f, 0.0537510552f},
-std::array<float,2>{0.96677351f, 0.696778059f},
-std::array<float,2>{0.238179654f, 0.348163337f},
-std::array<float,2>{0.451550186f, 0.793187737f},
-std::array<float,2>{0.554813802f, 0.137720317f},
-std::array<float,2>{0.693249464f, 0.90183115f},
-std::array<float,2>{0.290866226f, 0.0990976617f},
-std::array<float,2>{0.0658371821f, 0.606232285f},
-std::array<float,2>{0.764853179f, 0.481084973f},
-std::array<float,2>{0.88403517f, 0.956453621f},
-std::array<float,2>{0.166857705f, 0.00864362903f},
-std::array<float,2>{0.401845366f, 0.513923407f},
-std::array<float,2>{0.594615281f, 0.432250261f},
-std::array<float,2>{0.645184577f, 0.664822459f},
-std::array<float,2>{0.373454243f, 0.292535186f},
-std::array<float,2>{0.0369168557f, 0.838249624f},
-std::array<float,2>{0.842173755f, 0.212121397f},
-std::array<float,2>{0.787076473f, 0.58442986f},
-std::array<float,2>{0.110032022f, 0.449797809f},
-std::array<float,2>{0.273200512f, 0.913909376f},
-std::array<float,2>{0.719896972f, 0.0764544383f},
-std::array<float,2>{0.510949731f, 0.77985692f},
-std::array<float,2>{0.476227015f, 0.165588155f},
-std::array<float,2>{0.203463733f, 0.737653971f},
-std::array<float,2>{0.973407447f, 0.328571469f},
-std::array<float,2>{0.766320288f, 0.934272945f},
-std::array<float,2>{0.0791741386f, 0.0804368556f},
-std::array<float,2>{0.309292674f, 0.563162327f},
-std::array<float,2>{0.709405065f, 0.466551572f},
-std::array<float,2>{0.532353282f, 0.73182261f},
-std::array<float,2>{0.456264228f, 0.324927211f},
-std::array<float,2>{0.219218761f, 0.760497928f},
-std::array<float,2>{0.948191106f, 0.181602299f},
-std::array<float,2>{0.922996163f, 0.527315378f},
-std::array<float,2>{0.150951505f, 0.421817422f},
-std::array<float,2>{0.43246612f, 0.945402086f},
-std::array<float,2>{0.57691133f, 0.0213984922f},
-std::array<float,2>{0.674491286f, 0.816758454f},
-std::array<float,2>{0.320068389f, 0.20136784f},
-std::array<float,2>{0.0165580083f, 0.684444606f},
-std::array<float,2>{0.867694259f, 0.303048968f},
-std::array<float,2>{0.987809896f, 0.810312867f},
-std::array<float,2>{0.200936869f, 0.140818194f},
-std::array<float,2>{0.498654425f, 0.704463482f},
-std::array<float,2>{0.519138575f, 0.36474219f},
-std::array<float,2>{0.742768288f, 0.620482862f},
-std::array<float,2>{0.257020742f, 0.487135828f},
-std::array<float,2>{0.103430562f, 0.878085136f},
-std::array<float,2>{0.807196558f, 0.124886259f},
-std::array<float,2>{0.814665556f, 0.638363779f},
-std::array<float,2>{0.0531412289f, 0.267355084f},
-std::array<float,2>{0.350124687f, 0.86461401f},
-std::array<float,2>{0.637275755f, 0.24926421f},
-std::array<float,2>{0.620004892f, 0.971004009f},
-std::array<float,2>{0.385516942f, 0.0389039144f},
-std::array<float,2>{0.185072377f, 0.544146597f},
-std::array<float,2>{0.891095757f, 0.387020141f},
-std::array<float,2>{0.78338778f, 0.871307433f},
-std::array<float,2>{0.114693522f, 0.236569583f},
-std::array<float,2>{0.266805112f, 0.629088104f},
-std::array<float,2>{0.724683166f, 0.274587333f},
-std::array<float,2>{0.51343447f, 0.53131038f},
-std::array<float,2>{0.469324082f, 0.37752068f},
-std::array<float,2>{0.210893825f, 0.980393231f},
-std::array<float,2>{0.969513416f, 0.0399081931f},
-std::array<float,2>{0.888663828f, 0.71744895f},
-std::array<float,2>{0.171323076f, 0.371367127f},
-std::array<float,2>{0.403080702f, 0.80017215f},
-std::array<float,2>{0.600369096f, 0.149964303f},
-std::array<float,2>{0.641363442f, 0.883923888f},
-std::array<float,2>{0.367728025f, 0.115994461f},
-std::array<float,2>{0.0329179876f, 0.61372292f},
-std::array<float,2>{0.837901711f, 0.497213185f},
-std::array<float,2>{0.961462557f, 0.94017154f},
-std::array<float,2>{0.238447279f, 0.0254853386f},
-std::array<float,2>{0.448011279f, 0.519566298f},
-std::array<float,2>{0.559189677f, 0.41291362f},
-std::array<float,2>{0.687985003f, 0.672627985f},
-std::array<float,2>{0.295745343f, 0.310726106f},
-std::array<float,2>{0.0679394901f, 0.82493937f},
-std::array<float,2>{0.760622978f, 0.192359403f},
-std::array<float,2>{0.849456608f, 0.57201165f},
-std::array<float,2>{0.00954258349f, 0.457650334f},
-std::array<float,2>{0.339654803f, 0.926521242f},
-std::array<float,2>{0.663235307f, 0.0911851227f},
-std::array<float,2>{0.59087491f, 0.752316654f},
-std::array<float,2>{0.413149476f, 0.173908979f},
-std::array<float,2>{0.139256939f, 0.719379723f},
-std::array<float,2>{0.921721041f, 0.315707594f},
-std::array<float,2>{0.818320036f, 0.915834129f},
-std::array<float,2>{0.0497571267f, 0.0644000843f},
-std::array<float,2>{0.34455812f, 0.591093123f},
-std::array<float,2>{0.634581387f, 0.438725263f},
-std::array<float,2>{0.623120368f, 0.74873817f},
-std::array<float,2>{0.387863815f, 0.341819048f},
-std::array<float,2>{0.18198134f, 0.770796716f},
-std::array<float,2>{0.896477997f, 0.157495275f},
-std::array<float,2>{0.988969982f, 0.505868912f},
-std::array<float,2>{0.198243633f, 0.426686585f},
-std::array<float,2>{0.49261564f, 0.963219106f},
-std::array<float,2>{0.521520138f, 0.000162952827f},
-std::array<float,2>{0.748199224f, 0.829418063f},
-std::array<float,2>{0.25077191f, 0.204121158f},
-std::array<float,2>{0.107026175f, 0.657176614f},
-std::array<float,2>{0.812476516f, 0.28293401f},
-std::array<float,2>{0.92736429f, 0.787127256f},
-std::array<float,2>{0.156015545f, 0.1282323f},
-std::array<float,2>{0.433658361f, 0.694370687f},
-std::array<float,2>{0.572193742f, 0.358540952f},
-std::array<float,2>{0.677285314f, 0.600991488f},
-std::array<float,2>{0.313138157f, 0.476412922f},
-std::array<float,2>{0.0203758217f, 0.89402169f},
-std::array<float,2>{0.871944547f, 0.108811341f},
-std::array<float,2>{0.771760046f, 0.651076317f},
-std::array<float,2>{0.0853830799f, 0.260662645f},
-std::array<float,2>{0.305005997f, 0.851207972f},
-std::array<float,2>{0.703853965f, 0.221309558f},
-std::array<float,2>{0.536283612f, 0.98975265f},
-std::array<float,2>{0.458810955f, 0.0591452457f},
-std::array<float,2>{0.224769622f, 0.56011939f},
-std::array<float,2>{0.952438295f, 0.392969847f},
-std::array<float,2>{0.860657454f, 0.773664236f},
-std::array<float,2>{0.0252804365f, 0.171056062f},
-std::array<float,2>{0.320934623f, 0.740305483f},
-std::array<float,2>{0.683610678f, 0.334358215f},
-std::array<float,2>{0.563944757f, 0.578926921f},
-std::array<float,2>{0.42962113f, 0.447310895f},
-std::array<float,2>{0.141770437f, 0.90771091f},
-std::array<float,2>{0.933118284f, 0.073482275f},
-std::array<float,2>{0.940665007f, 0.669669926f},
-std::array<float,2>{0.233570591f, 0.293833733f},
-std::array<float,2>{0.463308454f, 0.840198994f},
-std::array<float,2>{0.544726551f, 0.216620848f},
-std::array<float,2>{0.715058386f, 0.957120299f},
-std::array<float,2>{0.302670479f, 0.0117659634f},
-std::array<float,2>{0.0865664631f, 0.507840395f},
-std::array<float,2>{0.775492489f, 0.434541166f},
-std::array<float,2>{0.903507352f, 0.904301047f},
-std::array<float,2>{0.173023492f, 0.0958467051f},
-std::array<float,2>{0.377200961f, 0.605291605f},
-std::array<float,2>{0.612713933f, 0.478279859f},
-std::array<float,2>{0.628810346f, 0.702414989f},
-std::array<float,2>{0.357637882f, 0.345711648f},
-std::array<float,2>{0.0592296012f, 0.792713344f},
-std::array<float,2>{0.822839499f, 0.133144379f},
-std::array<float,2>{0.80327183f, 0.54925245f},
-std::array<float,2>{0.100705422f, 0.403419554f},
-std::array<float,2>{0.259266406f, 0.996575117f},
-std::array<float,2>{0.738350093f, 0.049204655f},
-std::array<float,2>{0.528964043f, 0.853980064f},
-std::array<float,2>{0.488371193f, 0.227687895f},
-std::array<float,2>{0.190241069f, 0.64200902f},
-std::array<float,2>{0.994033992f, 0.253207594f},
-std::array<float,2>{0.751927018f, 0.973885775f},
-std::array<float,2>{0.0712523609f, 0.0323843807f},
-std::array<float,2>{0.284918576f, 0.539880157f},
-std::array<float,2>{0.699535012f, 0.384460986f},
-std::array<float,2>{0.550724745f, 0.635778248f},
-std::array<float,2>{0.443649411f, 0.271601498f},
-std::array<float,2>{0.245874628f, 0.862181306f},
-std::array<float,2>{0.959698737f, 0.243709996f},
-std::array<float,2>{0.908726752f, 0.622349977f},
-std::array<float,2>{0.132247373f, 0.49061051f},
-std::array<float,2>{0.415709406f, 0.879149973f},
-std::array<float,2>{0.578367651f, 0.117758594f},
-std::array<float,2>{0.667837203f, 0.804906666f},
-std::array<float,2>{0.329736739f, 0.145249143f},
-std::array<float,2>{0.00477302214f, 0.710048139f},
-std::array<float,2>{0.855175912f, 0.36214155f},
-std::array<float,2>{0.978730142f, 0.814359665f},
-std::array<float,2>{0.214650095f, 0.197983652f},
-std::array<float,2>{0.477794558f, 0.683008194f},
-std::array<float,2>{0.507166684f, 0.300147504f},
-std::array<float,2>{0.728881598f, 0.530750513f},
-std::array<float,2>{0.280449182f, 0.41754514f},
-std::array<float,2>{0.124885522f, 0.952152073f},
-std::array<float,2>{0.791064918f, 0.0180103928f},
-std::array<float,2>{0.831780434f, 0.727993309f},
-std::array<float,2>{0.0442368649f, 0.324013948f},
-std::array<float,2>{0.363345832f, 0.762107491f},
-std::array<float,2>{0.655217886f, 0.185471952f},
-std::array<float,2>{0.603203595f, 0.933097601f},
-std::array<float,2>{0.397887528f, 0.0835036784f},
-std::array<float,2>{0.159005359f, 0.569121957f},
-std::array<float,2>{0.87710762f, 0.462883204f},
-std::array<float,2>{0.780722558f, 0.80450958f},
-std::array<float,2>{0.0933270007f, 0.15559414f},
-std::array<float,2>{0.299088329f, 0.712482929f},
-std::array<float,2>{0.711829305f, 0.369285792f},
-std::array<float,2>{0.54086566f, 0.612950861f},
-std::array<float,2>{0.465549409f, 0.4960168f},
-std::array<float,2>{0.227693334f, 0.888539612f},
-std::array<float,2>{0.944231331f, 0.112982363f},
-std::array<float,2>{0.935495615f, 0.627031982f},
-std::array<float,2>{0.148288295f, 0.279331714f},
-std::array<float,2>{0.424270928f, 0.870996535f},
-std::array<float,2>{0.568320811f, 0.23968643f},
-std::array<float,2>{0.680507004f, 0.982604861f},
-std::array<float,2>{0.326014131f, 0.0464195646f},
-std::array<float,2>{0.0293778982f, 0.537146747f},
-std::array<float,2>{0.866049051f, 0.380809486f},
-std::array<float,2>{0.9966048f, 0.925023794f},
-std::array<float,2>{0.192095354f, 0.0889476836f},
-std::array<float,2>{0.487775832f, 0.577676296f},
-std::array<float,2>{0.526126921f, 0.454805702f},
-std::array<float,2>{0.735372543f, 0.726084292f},
-std::array<float,2>{0.264558613f, 0.318393767f},
-std::array<float,2>{0.0976019055f, 0.756978869f},
-std::array<float,2>{0.80009371f, 0.178846002f},
-std::array<float,2>{0.825835407f, 0.519453704f},
-std::array<float,2>{0.0583606251f, 0.410021931f},
-std::array<float,2>{0.351836473f, 0.942763865f},
-std::array<float,2>{0.631646514f, 0.0276074149f},
-std::array<float,2>{0.615497708f, 0.821845293f},
-std::array<float,2>{0.379411399f, 0.190020382f},
-std::array<float,2>{0.175788626f, 0.675893188f},
-std::array<float,2>{0.901354313f, 0.307736427f},
-std::array<float,2>{0.857137918f, 0.96623981f},
-std::array<float,2>{0.00219943351f, 0.0066641476f},
-std::array<float,2>{0.334212095f, 0.501704752f},
-std::array<float,2>{0.669423461f, 0.423475534f},
-std::array<float,2>{0.584701955f, 0.660235286f},
-std::array<float,2>{0.418048739f, 0.285435468f},
-std::array<float,2>{0.126562282f, 0.832486689f},
-std::array<float,2>{0.91275847f, 0.207965329f},
-std::array<float,2>{0.954059541f, 0.589357853f},
-std::array<float,2>{0.249008551f, 0.442061573f},
-std::array<float,2>{0.437856823f, 0.921683908f},
-std::array<float,2>{0.550881803f, 0.0688630268f},
-std::array<float,2>{0.698388457f, 0.766207218f},
-std::array<float,2>{0.288944006f, 0.161739975f},
-std::array<float,2>{0.0776322111f, 0.743003964f},
-std::array<float,2>{0.757104576f, 0.337171674f},
-std::array<float,2>{0.880705178f, 0.845011711f},
-std::array<float,2>{0.161087304f, 0.223479748f},
-std::array<float,2>{0.392135382f, 0.653048873f},
-std::array<float,2>{0.608444512f, 0.263197184f},
-std::array<float,2>{0.652111113f, 0.557043672f},
-std::array<float,2>{0.359634101f, 0.396762401f},
-std::array<float,2>{0.0418719053f, 0.98531431f},
-std::array<float,2>{0.833755612f, 0.0566428974f},
-std::array<float,2>{0.79463762f, 0.691033065f},
-std::array<float,2>{0.119744606f, 0.354856849f},
-std::array<float,2>{0.275423735f, 0.781709075f},
-std::array<float,2>{0.733401537f, 0.132601485f},
-std::array<float,2>{0.500149846f, 0.895316601f},
-std::array<float,2>{0.48047632f, 0.105355665f},
-std::array<float,2>{0.216854304f, 0.595339775f},
-std::array<float,2>{0.981583118f, 0.47222662f},
-std::array<float,2>{0.840236485f, 0.836042047f},
-std::array<float,2>{0.0374397263f, 0.214296669f},
-std::array<float,2>{0.371494919f, 0.666803896f},
-std::array<float,2>{0.648377299f, 0.289675742f},
-std::array<float,2>{0.596300602f, 0.512189806f},
-std::array<float,2>{0.398820609f, 0.431114912f},
-std::array<float,2>{0.164807588f, 0.954774022f},
-std::array<float,2>{0.886012793f, 0.0109830163f},
-std::array<float,2>{0.975794196f, 0.734537661f},
-std::array<float,2>{0.205992505f, 0.33036226f},
-std::array<float,2>{0.473906785f, 0.777624488f},
-std::array<float,2>{0.508577287f, 0.166560546f},
-std::array<float,2>{0.721703589f, 0.910860181f},
-std::array<float,2>{0.270105422f, 0.0747023299f},
-std::array<float,2>{0.111764595f, 0.582760155f},
-std::array<float,2>{0.787611008f, 0.453098148f},
-std::array<float,2>{0.917563856f, 0.995172203f},
-std::array<float,2>{0.134184435f, 0.0526991636f},
-std::array<float,2>{0.409249097f, 0.552724242f},
-std::array<float,2>{0.588595688f, 0.402123779f},
-std::array<float,2>{0.657583058f, 0.646095872f},
-std::array<float,2>{0.340235561f, 0.257664621f},
-std::array<float,2>{0.0155491913f, 0.858411372f},
-std::array<float,2>{0.843852341f, 0.232444793f},
-std::array<float,2>{0.761739254f, 0.608668864f},
-std::array<float,2>{0.0643137544f, 0.483663499f},
-std::array<float,2>{0.292262316f, 0.899876058f},
-std::array<float,2>{0.694747925f, 0.100347407f},
-std::array<float,2>{0.558107674f, 0.796787679f},
-std::array<float,2>{0.449293882f, 0.140284225f},
-std::array<float,2>{0.235120147f, 0.698087811f},
-std::array<float,2>{0.96690011f, 0.350635409f},
-std::array<float,2>{0.806227624f, 0.876819372f},
-std::array<float,2>{0.104878411f, 0.121191718f},
-std::array<float,2>{0.254438847f, 0.617818177f},
-std::array<float,2>{0.745040655f, 0.485540986f},
-std::array<float,2>{0.516508818f, 0.705949903f},
-std::array<float,2>{0.497800529f, 0.366398662f},
-std::array<float,2>{0.20286794f, 0.811427593f},
-std::array<float,2>{0.984541118f, 0.14424862f},
-std::array<float,2>{0.89310354f, 0.546220124f},
-std::array<float,2>{0.186777204f, 0.389285296f},
-std::array<float,2>{0.383730978f, 0.969517589f},
-std::array<float,2>{0.618024826f, 0.0354503319f},
-std::array<float,2>{0.640061557f, 0.866707087f},
-std::array<float,2>{0.348944902f, 0.246540293f},
-std::array<float,2>{0.0523793697f, 0.638855934f},
-std::array<float,2>{0.813903332f, 0.268716156f},
-std::array<float,2>{0.94573766f, 0.758095622f},
-std::array<float,2>{0.221423656f, 0.181912541f},
-std::array<float,2>{0.453321069f, 0.733207643f},
-std::array<float,2>{0.533300102f, 0.327148408f},
-std::array<float,2>{0.707219005f, 0.564864039f},
-std::array<float,2>{0.311395824f, 0.467843205f},
-std::array<float,2>{0.0812260658f, 0.936214745f},
-std::array<float,2>{0.768774688f, 0.0792308599f},
-std::array<float,2>{0.869510293f, 0.687145591f},
-std::array<float,2>{0.019162003f, 0.300801307f},
-std::array<float,2>{0.316558212f, 0.818877518f},
-std::array<float,2>{0.67326802f, 0.200055316f},
-std::array<float,2>{0.574445307f, 0.947883368f},
-std::array<float,2>{0.431083858f, 0.022351956f},
-std::array<float,2>{0.149481833f, 0.5237903f},
-std::array<float,2>{0.924998462f, 0.419259131f},
-std::array<float,2>{0.753612697f, 0.861350417f},
-std::array<float,2>{0.0736477897f, 0.243310332f},
-std::array<float,2>{0.282529831f, 0.636624455f},
-std::array<float,2>{0.702480495f, 0.272322476f},
-std::array<float,2>{0.548718393f, 0.539327204f},
-std::array<float,2>{0.442310512f, 0.383810431f},
-std::array<float,2>{0.243437901f, 0.974551141f},
-std::array<float,2>{0.95895505f, 0.0327875949f},
-std::array<float,2>{0.906301498f, 0.710824072f},
-std::array<float,2>{0.129507333f, 0.361692011f},
-std::array<float,2>{0.417095274f, 0.805448532f},
-std::array<float,2>{0.580565929f, 0.144543678f},
-std::array<float,2>{0.664764106f, 0.879516661f},
-std::array<float,2>{0.331796825f, 0.117527589f},
-std::array<float,2>{0.00637717173f, 0.622643769f},
-std::array<float,2>{0.851833761f, 0.491072595f},
-std::array<float,2>{0.978429377f, 0.952647448f},
-std::array<float,2>{0.212576985f, 0.0182478204f},
-std::array<float,2>{0.480003089f, 0.531217575f},
-std::array<float,2>{0.505405962f, 0.417387635f},
-std::array<float,2>{0.728369176f, 0.683215976f},
-std::array<float,2>{0.27901721f, 0.300570965f},
-std::array<float,2>{0.122231521f, 0.813609779f},
-std::array<float,2>{0.789684772f, 0.197292402f},
-std::array<float,2>{0.828612268f, 0.568394184f},
-std::array<float,2>{0.0465935767f, 0.462040484f},
-std::array<float,2>{0.366106093f, 0.933267593f},
-std::array<float,2>{0.654016554f, 0.083198458f},
-std::array<float,2>{0.604169965f, 0.762268007f},
-std::array<float,2>{0.395108283f, 0.18463774f},
-std::array<float,2>{0.157074884f, 0.728095591f},
-std::array<float,2>{0.875608504f, 0.323562741f},
-std::array<float,2>{0.862185299f, 0.907982349f},
-std::array<float,2>{0.0269686468f, 0.0741168484f},
-std::array<float,2>{0.322718263f, 0.578223348f},
-std::array<float,2>{0.686006308f, 0.448203892f},
-std::array<float,2>{0.566316903f, 0.741001785f},
-std::array<float,2>{0.426438361f, 0.334523886f},
-std::array<float,2>{0.143385947f, 0.774133384f},
-std::array<float,2>{0.930399477f, 0.171665266f},
-std::array<float,2>{0.939288378f, 0.508417726f},
-std::array<float,2>{0.231956854f, 0.433994114f},
-std::array<float,2>{0.462262869f, 0.957536042f},
-std::array<float,2>{0.546686709f, 0.0125732683f},
-std::array<float,2>{0.717732251f, 0.840544045f},
-std::array<float,2>{0.303814977f, 0.215892538f},
-std::array<float,2>{0.087982282f, 0.669413209f},
-std::array<float,2>{0.774242043f, 0.293351978f},
-std::array<float,2>{0.90569663f, 0.792468965f},
-std::array<float,2>{0.174512625f, 0.133550003f},
-std::array<float,2>{0.376616299f, 0.702891171f},
-std::array<float,2>{0.610024452f, 0.346274644f},
-std::array<float,2>{0.625489056f, 0.604499221f},
-std::array<float,2>{0.357179314f, 0.477732629f},
-std::array<float,2>{0.0621745028f, 0.905023396f},
-std::array<float,2>{0.822122633f, 0.096434854f},
-std::array<float,2>{0.802366018f, 0.642282128f},
-std::array<float,2>{0.0990950093f, 0.25371623f},
-std::array<float,2>{0.261271954f, 0.854308069f},
-std::array<float,2>{0.740950465f, 0.228154942f},
-std::array<float,2>{0.529401124f, 0.996931136f},
-std::array<float,2>{0.490864366f, 0.0497540757f},
-std::array<float,2>{0.187616095f, 0.549619615f},
-std::array<float,2>{0.994990408f, 0.404281139f},
-std::array<float,2>{0.819299817f, 0.771002054f},
-std::array<float,2>{0.0479663126f, 0.157772243f},
-std::array<float,2>{0.347227126f, 0.748262882f},
-std::array<float,2>{0.635952592f, 0.342617959f},
-std::array<float,2>{0.621439874f, 0.59177655f},
-std::array<float,2>{0.389374316f, 0.439329177f},
-std::array<float,2>{0.181229323f, 0.91504401f},
-std::array<float,2>{0.898089647f, 0.0639176071f},
-std::array<float,2>{0.991554439f, 0.656442821f},
-std::array<float,2>{0.196214035f, 0.282382935f},
-std::array<float,2>{0.494313598f, 0.829986811f},
-std::array<float,2>{0.521386445f, 0.204940349f},
-std::array<float,2>{0.746526182f, 0.963493347f},
-std::array<float,2>{0.252883643f, 0.000639336358f},
-std::array<float,2>{0.108346432f, 0.506384015f},
-std::array<float,2>{0.809656262f, 0.426131964f},
-std::array<float,2>{0.928872406f, 0.894415617f},
-std::array<float,2>{0.153927967f, 0.10924045f},
-std::array<float,2>{0.437400579f, 0.601458967f},
-std::array<float,2>{0.574145496f, 0.475768298f},
-std::array<float,2>{0.678249955f, 0.694843292f},
-std::array<float,2>{0.315025926f, 0.35917446f},
-std::array<float,2>{0.0230206624f, 0.788012981f},
-std::array<float,2>{0.873601377f, 0.12877053f},
-std::array<float,2>{0.771193564f, 0.559575021f},
-std::array<float,2>{0.0821080506f, 0.393429846f},
-std::array<float,2>{0.308502823f, 0.989432991f},
-std::array<float,2>{0.706820607f, 0.0586959831f},
-std::array<float,2>{0.537760735f, 0.850925744f},
-std::array<float,2>{0.460534513f, 0.220716625f},
-std::array<float,2>{0.222836748f, 0.650703132f},
-std::array<float,2>{0.949280739f, 0.260151386f},
-std::array<float,2>{0.781309843f, 0.979543388f},
-std::array<float,2>{0.117114022f, 0.0392593257f},
-std::array<float,2>{0.268008977f, 0.53207767f},
-std::array<float,2>{0.724596083f, 0.377250165f},
-std::array<float,2>{0.515136838f, 0.629754364f},
-std::array<float,2>{0.472473919f, 0.274988979f},
-std::array<float,2>{0.207683027f, 0.871851444f},
-std::array<float,2>{0.972184837f, 0.236864239f},
-std::array<float,2>{0.889761269f, 0.614185929f},
-std::array<float,2>{0.169261858f, 0.49788633f},
-std::array<float,2>{0.405081481f, 0.884493649f},
-std::array<float,2>{0.598387897f, 0.115597941f},
-std::array<float,2>{0.644064486f, 0.800490797f},
-std::array<float,2>{0.370328575f, 0.149656057f},
-std::array<float,2>{0.0340857916f, 0.716903985f},
-std::array<float,2>{0.836324215f, 0.371824771f},
-std::array<float,2>{0.963618875f, 0.824657798f},
-std::array<float,2>{0.242044866f, 0.191874549f},
-std::array<float,2>{0.44617644f, 0.671908021f},
-std::array<float,2>{0.560785413f, 0.311465591f},
-std::array<float,2>{0.689723551f, 0.52049458f},
-std::array<float,2>{0.293936133f, 0.412407964f},
-std::array<float,2>{0.0685985759f, 0.939716458f},
-std::array<float,2>{0.758496523f, 0.026025068f},
-std::array<float,2>{0.851361454f, 0.718782008f},
-std::array<float,2>{0.0102007212f, 0.316152334f},
-std::array<float,2>{0.336271018f, 0.752687931f},
-std::array<float,2>{0.661533356f, 0.174696192f},
-std::array<float,2>{0.592264175f, 0.925787747f},
-std::array<float,2>{0.411814332f, 0.0914643109f},
-std::array<float,2>{0.137642622f, 0.571373582f},
-std::array<float,2>{0.9192819f, 0.457447648f},
-std::array<float,2>{0.806907356f, 0.81082648f},
-std::array<float,2>{0.10257481f, 0.143879622f},
-std::array<float,2>{0.257769614f, 0.705193341f},
-std::array<float,2>{0.742495596f, 0.367186427f},
-std::array<float,2>{0.519019842f, 0.617475033f},
-std::array<float,2>{0.498128504f, 0.486162782f},
-std::array<float,2>{0.200370431f, 0.876057565f},
-std::array<float,2>{0.987454414f, 0.121939421f},
-std::array<float,2>{0.891534388f, 0.639610767f},
-std::array<float,2>{0.18502225f, 0.269480914f},
-std::array<float,2>{0.384943247f, 0.866299629f},
-std::array<float,2>{0.619197607f, 0.246951848f},
-std::array<float,2>{0.637042165f, 0.968789458f},
-std::array<float,2>{0.34992981f, 0.0360933021f},
-std::array<float,2>{0.0535474569f, 0.546441734f},
-std::array<float,2>{0.815042019f, 0.388672203f},
-std::array<float,2>{0.947426975f, 0.935947299f},
-std::array<float,2>{0.219709873f, 0.0798968077f},
-std::array<float,2>{0.456762731f, 0.565104365f},
-std::array<float,2>{0.533128798f, 0.468556345f},
-std::array<float,2>{0.70962733f, 0.732625008f},
-std::array<float,2>{0.309023261f, 0.326232642f},
-std::array<float,2>{0.0796074197f, 0.758718669f},
-std::array<float,2>{0.765926659f, 0.182445198f},
-std::array<float,2>{0.867194772f, 0.524138927f},
-std::array<float,2>{0.0158370752f, 0.419622153f},
-std::array<float,2>{0.319789946f, 0.947281539f},
-std::array<float,2>{0.673920095f, 0.021810662f},
-std::array<float,2>{0.576502144f, 0.818453014f},
-std::array<float,2>{0.431693196f, 0.199589223f},
-std::array<float,2>{0.150643721f, 0.686856627f},
-std::array<float,2>{0.923570096f, 0.301413774f},
-std::array<float,2>{0.842290103f, 0.954233706f},
-std::array<float,2>{0.0362418294f, 0.0116083575f},
-std::array<float,2>{0.3736974f, 0.512308955f},
-std::array<float,2>{0.644895613f, 0.431196064f},
-std::array<float,2>{0.594026268f, 0.666094899f},
-std::array<float,2>{0.402162045f, 0.289490789f},
-std::array<float,2>{0.166220352f, 0.836486816f},
-std::array<float,2>{0.88452965f, 0.214742988f},
-std::array<float,2>{0.972914457f, 0.582386792f},
-std::array<float,2>{0.203759044f, 0.452400118f},
-std::array<float,2>{0.475952983f, 0.91053623f},
-std::array<float,2>{0.511351109f, 0.0747638196f},
-std::array<float,2>{0.720287681f, 0.778125286f},
-std::array<float,2>{0.27289027f, 0.166377455f},
-std::array<float,2>{0.109395884f, 0.734901667f},
-std::array<float,2>{0.786283791f, 0.330879033f},
-std::array<float,2>{0.915472567f, 0.859039128f},
-std::array<float,2>{0.135525092f, 0.2333159f},
-std::array<float,2>{0.40712589f, 0.645860314f},
-std::array<float,2>{0.586801469f, 0.257002532f},
-std::array<float,2>{0.658568978f, 0.551878214f},
-std::array<float,2>{0.34288004f, 0.401626945f},
-std::array<float,2>{0.0135897901f, 0.996038854f},
-std::array<float,2>{0.845973432f, 0.0518584698f},
-std::array<float,2>{0.765251994f, 0.697649956f},
-std::array<float,2>{0.0660170764f, 0.351290822f},
-std::array<float,2>{0.290374428f, 0.796385765f},
-std::array<float,2>{0.692611039f, 0.139710769f},
-std::array<float,2>{0.555223942f, 0.900164127f},
-std::array<float,2>{0.45189786f, 0.0998064578f},
-std::array<float,2>{0.237335756f, 0.609048367f},
-std::array<float,2>{0.965908885f, 0.484086424f},
-std::array<float,2>{0.85798645f, 0.832916439f},
-std::array<float,2>{0.000217111243f, 0.207137764f},
-std::array<float,2>{0.333296984f, 0.66080904f},
-std::array<float,2>{0.6705181f, 0.286119223f},
-std::array<float,2>{0.582223654f, 0.501265824f},
-std::array<float,2>{0.420448273f, 0.4231278f},
-std::array<float,2>{0.128710985f, 0.966615617f},
-std::array<float,2>{0.912093461f, 0.00611046935f},
-std::array<float,2>{0.956376612f, 0.742236376f},
-std::array<float,2>{0.246645495f, 0.337687314f},
-std::array<float,2>{0.441006929f, 0.765803874f},
-std::array<float,2>{0.554096818f, 0.161399007f},
-std::array<float,2>{0.696094573f, 0.921082973f},
-std::array<float,2>{0.286995471f, 0.0684548095f},
-std::array<float,2>{0.0749212503f, 0.58907783f},
-std::array<float,2>{0.755198836f, 0.441718042f},
-std::array<float,2>{0.881351531f, 0.984797001f},
-std::array<float,2>{0.163829967f, 0.0574869961f},
-std::array<float,2>{0.392739296f, 0.557510972f},
-std::array<float,2>{0.607066572f, 0.397125959f},
-std::array<float,2>{0.648756325f, 0.652729332f},
-std::array<float,2>{0.362620533f, 0.262803406f},
-std::array<float,2>{0.0402031206f, 0.845416009f},
-std::array<float,2>{0.834145546f, 0.223035589f},
-std::array<float,2>{0.795753062f, 0.594753265f},
-std::array<float,2>{0.117489368f, 0.47168836f},
-std::array<float,2>{0.275116622f, 0.894944131f},
-std::array<float,2>{0.732358038f, 0.104869321f},
-std::array<float,2>{0.502934992f, 0.781848669f},
-std::array<float,2>{0.482818127f, 0.132259488f},
-std::array<float,2>{0.21568647f, 0.690657973f},
-std::array<float,2>{0.98388195f, 0.355055124f},
-std::array<float,2>{0.778374016f, 0.887761652f},
-std::array<float,2>{0.0905323252f, 0.112608083f},
-std::array<float,2>{0.297766089f, 0.612373471f},
-std::array<float,2>{0.714053631f, 0.495447487f},
-std::array<float,2>{0.541805029f, 0.712189138f},
-std::array<float,2>{0.468704402f, 0.369737208f},
-std::array<float,2>{0.229986668f, 0.803874731f},
-std::array<float,2>{0.943266332f, 0.155845433f},
-std::array<float,2>{0.93633914f, 0.538015485f},
-std::array<float,2>{0.144951165f, 0.380047709f},
-std::array<float,2>{0.42365858f, 0.982964635f},
-std::array<float,2>{0.568408608f, 0.0463712625f},
-std::array<float,2>{0.682742f, 0.870459497f},
-std::array<float,2>{0.326671898f, 0.24016726f},
-std::array<float,2>{0.0292396322f, 0.627798915f},
-std::array<float,2>{0.864259243f, 0.280058295f},
-std::array<float,2>{0.99928987f, 0.75779587f},
-std::array<float,2>{0.193588853f, 0.179629862f},
-std::array<float,2>{0.48496595f, 0.725861192f},
-std::array<float,2>{0.524234831f, 0.319335222f},
-std::array<float,2>{0.737523913f, 0.577567816f},
-std::array<float,2>{0.261796236f, 0.454557478f},
-std::array<float,2>{0.0951819792f, 0.925370276f},
-std::array<float,2>{0.797899008f, 0.0894982293f},
-std::array<float,2>{0.827757239f, 0.676688373f},
-std::array<float,2>{0.0549856015f, 0.308371067f},
-std::array<float,2>{0.354181916f, 0.821691751f},
-std::array<float,2>{0.630276561f, 0.189503849f},
-std::array<float,2>{0.614494383f, 0.943214715f},
-std::array<float,2>{0.381386817f, 0.0280000363f},
-std::array<float,2>{0.178291112f, 0.518898487f},
-std::array<float,2>{0.899206042f, 0.409401476f},
-std::array<float,2>{0.791949451f, 0.814734995f},
-std::array<float,2>{0.124397188f, 0.195630983f},
-std::array<float,2>{0.281124711f, 0.680713415f},
-std::array<float,2>{0.72916168f, 0.298399091f},
-std::array<float,2>{0.507781267f, 0.528274119f},
-std::array<float,2>{0.478249252f, 0.414246887f},
-std::array<float,2>{0.214148119f, 0.949311376f},
-std::array<float,2>{0.979133427f, 0.0158075429f},
-std::array<float,2>{0.877629042f, 0.729565144f},
-std::array<float,2>{0.158686668f, 0.321934432f},
-std::array<float,2>{0.398214459f, 0.765446305f},
-std::array<float,2>{0.602645695f, 0.187014416f},
-std::array<float,2>{0.654416263f, 0.930558503f},
-std::array<float,2>{0.363813818f, 0.0856416225f},
-std::array<float,2>{0.0448396131f, 0.567433178f},
-std::array<float,2>{0.831443071f, 0.464573324f},
-std::array<float,2>{0.959014475f, 0.975289702f},
-std::array<float,2>{0.245374009f, 0.034890566f},
-std::array<float,2>{0.443898886f, 0.541469872f},
-std::array<float,2>{0.549883187f, 0.386393636f},
-std::array<float,2>{0.69974345f, 0.633328378f},
-std::array<float,2>{0.28444168f, 0.269907922f},
-std::array<float,2>{0.0705493987f, 0.860438108f},
-std::array<float,2>{0.750998497f, 0.244957358f},
-std::array<float,2>{0.854887664f, 0.624964237f},
-std::array<float,2>{0.00395941921f, 0.490196139f},
-std::array<float,2>{0.32936874f, 0.882658601f},
-std::array<float,2>{0.667368829f, 0.12062946f},
-std::array<float,2>{0.578982115f, 0.808571696f},
-std::array<float,2>{0.415400952f, 0.147443175f},
-std::array<float,2>{0.132389724f, 0.708219767f},
-std::array<float,2>{0.90829879f, 0.361116737f},
-std::array<float,2>{0.822740853f, 0.903682709f},
-std::array<float,2>{0.0586774834f, 0.0940283984f},
-std::array<float,2>{0.358335406f, 0.603143334f},
-std::array<float,2>{0.628371894f, 0.478777975f},
-std::array<float,2>{0.61319828f, 0.701123953f},
-std::array<float,2>{0.377708256f, 0.345442355f},
-std::array<float,2>{0.173498213f, 0.790827513f},
-std::array<float,2>{0.904245317f, 0.135251194f},
-std::array<float,2>{0.993589461f, 0.548457205f},
-std::array<float,2>{0.189525694f, 0.406011373f},
-std::array<float,2>{0.488963276f, 0.998058259f},
-std::array<float,2>{0.528457522f, 0.047568351f},
-std::array<float,2>{0.738919914f, 0.853209913f},
-std::array<float,2>{0.25968048f, 0.230286866f},
-std::array<float,2>{0.101341732f, 0.643290281f},
-std::array<float,2>{0.803040147f, 0.251628041f},
-std::array<float,2>{0.932696044f, 0.777153313f},
-std::array<float,2>{0.142487407f, 0.168378368f},
-std::array<float,2>{0.428912133f, 0.740000427f},
-std::array<float,2>{0.564227641f, 0.333477288f},
-std::array<float,2>{0.684147358f, 0.580917418f},
-std::array<float,2>{0.32064116f, 0.446932226f},
-std::array<float,2>{0.0248707812f, 0.909143031f},
-std::array<float,2>{0.860874295f, 0.0713450685f},
-std::array<float,2>{0.776341915f, 0.670502722f},
-std::array<float,2>{0.086178802f, 0.2964288f},
-std::array<float,2>{0.302039742f, 0.843228817f},
-std::array<float,2>{0.715742648f, 0.21728082f},
-std::array<float,2>{0.54404676f, 0.959132671f},
-std::array<float,2>{0.463786364f, 0.0143454997f},
-std::array<float,2>{0.234319583f, 0.511444747f},
-std::array<float,2>{0.94104439f, 0.436072886f},
-std::array<float,2>{0.871321499f, 0.786794186f},
-std::array<float,2>{0.0196199622f, 0.126922846f},
-std::array<float,2>{0.312824637f, 0.693181574f},
-std::array<float,2>{0.677171767f, 0.356941104f},
-std::array<float,2>{0.571315706f, 0.599063098f},
-std::array<float,2>{0.434211135f, 0.472833961f},
-std::array<float,2>{0.155653387f, 0.892248333f},
-std::array<float,2>{0.926796675f, 0.105550379f},
-std::array<float,2>{0.952847123f, 0.649122179f},
-std::array<float,2>{0.2254792f, 0.259179145f},
-std::array<float,2>{0.458107024f, 0.848357499f},
-std::array<float,2>{0.537074506f, 0.219345406f},
-std::array<float,2>{0.703386128f, 0.991648138f},
-std::array<float,2>{0.305261105f, 0.0607624389f},
-std::array<float,2>{0.0857497901f, 0.561481714f},
-std::array<float,2>{0.772331119f, 0.392337054f},
-std::array<float,2>{0.8955158f, 0.917505085f},
-std::array<float,2>{0.182589591f, 0.0662986115f},
-std::array<float,2>{0.388413638f, 0.592737496f},
-std::array<float,2>{0.623962462f, 0.439789027f},
-std::array<float,2>{0.634212196f, 0.747747362f},
-std::array<float,2>{0.344217569f, 0.341082156f},
-std::array<float,2>{0.0489474162f, 0.772132576f},
-std::array<float,2>{0.817673624f, 0.158715159f},
-std::array<float,2>{0.811591029f, 0.504149139f},
-std::array<float,2>{0.106542692f, 0.429385543f},
-std::array<float,2>{0.25029093f, 0.962277055f},
-std::array<float,2>{0.748851776f, 0.00316878781f},
-std::array<float,2>{0.52221334f, 0.830121458f},
-std::array<float,2>{0.493053913f, 0.206789315f},
-std::array<float,2>{0.198834226f, 0.659642577f},
-std::array<float,2>{0.988355041f, 0.284501553f},
-std::array<float,2>{0.759878099f, 0.938226044f},
-std::array<float,2>{0.0673848391f, 0.0234976225f},
-std::array<float,2>{0.295245737f, 0.522746444f},
-std::array<float,2>{0.688095093f, 0.4110443f},
-std::array<float,2>{0.558794558f, 0.674007297f},
-std::array<float,2>{0.447743922f, 0.310284078f},
-std::array<float,2>{0.238774016f, 0.827103376f},
-std::array<float,2>{0.96124351f, 0.195152655f},
-std::array<float,2>{0.921120644f, 0.572860897f},
-std::array<float,2>{0.139070332f, 0.459191412f},
-std::array<float,2>{0.413912058f, 0.928484619f},
-std::array<float,2>{0.591426313f, 0.0937329456f},
-std::array<float,2>{0.66403383f, 0.751028955f},
-std::array<float,2>{0.339247495f, 0.173228905f},
-std::array<float,2>{0.00896316674f, 0.721630573f},
-std::array<float,2>{0.848762989f, 0.312808037f},
-std::array<float,2>{0.969216406f, 0.874957144f},
-std::array<float,2>{0.210178658f, 0.235542715f},
-std::array<float,2>{0.468941897f, 0.631417513f},
-std::array<float,2>{0.513172865f, 0.276649624f},
-std::array<float,2>{0.725125551f, 0.534533918f},
-std::array<float,2>{0.26740554f, 0.376823992f},
-std::array<float,2>{0.115118057f, 0.977615595f},
-std::array<float,2>{0.783874273f, 0.0423354842f},
-std::array<float,2>{0.838417351f, 0.715949476f},
-std::array<float,2>{0.0323801115f, 0.374972731f},
-std::array<float,2>{0.367462903f, 0.798713148f},
-std::array<float,2>{0.640821695f, 0.152140141f},
-std::array<float,2>{0.599987745f, 0.886339724f},
-std::array<float,2>{0.402508765f, 0.113545962f},
-std::array<float,2>{0.171518922f, 0.615252852f},
-std::array<float,2>{0.888101339f, 0.499883562f},
-std::array<float,2>{0.769362807f, 0.759848058f},
-std::array<float,2>{0.0817388296f, 0.180968896f},
-std::array<float,2>{0.310607791f, 0.731948614f},
-std::array<float,2>{0.707654655f, 0.324534774f},
-std::array<float,2>{0.534143209f, 0.56289351f},
-std::array<float,2>{0.454053998f, 0.466083676f},
-std::array<float,2>{0.220947489f, 0.933641255f},
-std::array<float,2>{0.946133733f, 0.0806666389f},
-std::array<float,2>{0.925578237f, 0.683784485f},
-std::array<float,2>{0.15036203f, 0.303313255f},
-std::array<float,2>{0.431282073f, 0.816937923f},
-std::array<float,2>{0.574888587f, 0.202060655f},
-std::array<float,2>{0.673538327f, 0.946142554f},
-std::array<float,2>{0.317136943f, 0.0206255112f},
-std::array<float,2>{0.0186619442f, 0.526405454f},
-std::array<float,2>{0.869671285f, 0.421116114f},
-std::array<float,2>{0.984976649f, 0.878422976f},
-std::array<float,2>{0.202615783f, 0.124440305f},
-std::array<float,2>{0.497492075f, 0.620662153f},
-std::array<float,2>{0.515667379f, 0.486442894f},
-std::array<float,2>{0.744166255f, 0.704613864f},
-std::array<float,2>{0.254254937f, 0.365064383f},
-std::array<float,2>{0.105182268f, 0.809957445f},
-std::array<float,2>{0.805922687f, 0.141143039f},
-std::array<float,2>{0.814320147f, 0.54449743f},
-std::array<float,2>{0.0521163233f, 0.387211144f},
-std::array<float,2>{0.349339575f, 0.971536934f},
-std::array<float,2>{0.640537322f, 0.038237676f},
-std::array<float,2>{0.617480576f, 0.864869118f},
-std::array<float,2>{0.383021146f, 0.249630198f},
-std::array<float,2>{0.187111869f, 0.637919664f},
-std::array<float,2>{0.892890453f, 0.267067999f},
-std::array<float,2>{0.84453392f, 0.993070245f},
-std::array<float,2>{0.0146775944f, 0.0546162277f},
-std::array<float,2>{0.340338141f, 0.553394198f},
-std::array<float,2>{0.658110142f, 0.400019377f},
-std::array<float,2>{0.588279188f, 0.648309529f},
-std::array<float,2>{0.409932166f, 0.254849166f},
-std::array<float,2>{0.134585902f, 0.855592191f},
-std::array<float,2>{0.917394102f, 0.231526107f},
-std::array<float,2>{0.967404008f, 0.605854094f},
-std::array<float,2>{0.234584436f, 0.480938047f},
-std::array<float,2>{0.449974805f, 0.901953042f},
-std::array<float,2>{0.558060825f, 0.0992935076f},
-std::array<float,2>{0.694867492f, 0.793738127f},
-std::array<float,2>{0.292921662f, 0.138308793f},
-std::array<float,2>{0.0638743788f, 0.696722806f},
-std::array<float,2>{0.762505949f, 0.347762883f},
-std::array<float,2>{0.886241138f, 0.838406861f},
-std::array<float,2>{0.164425641f, 0.212730467f},
-std::array<float,2>{0.399203718f, 0.664399981f},
-std::array<float,2>{0.596051872f, 0.292209089f},
-std::array<float,2>{0.647858083f, 0.514334321f},
-std::array<float,2>{0.372063845f, 0.431748092f},
-std::array<float,2>{0.037628036f, 0.956898928f},
-std::array<float,2>{0.84060967f, 0.00785604585f},
-std::array<float,2>{0.787457764f, 0.738025725f},
-std::array<float,2>{0.111929543f, 0.328744501f},
-std::array<float,2>{0.269660652f, 0.779717386f},
-std::array<float,2>{0.722368062f, 0.165434092f},
-std::array<float,2>{0.508134067f, 0.913497984f},
-std::array<float,2>{0.47428745f, 0.0771426782f},
-std::array<float,2>{0.205443904f, 0.584820271f},
-std::array<float,2>{0.976528585f, 0.449580342f},
-std::array<float,2>{0.83302927f, 0.847374618f},
-std::array<float,2>{0.0414602794f, 0.224767476f},
-std::array<float,2>{0.359917939f, 0.656055331f},
-std::array<float,2>{0.651554346f, 0.263992399f},
-std::array<float,2>{0.60920608f, 0.555598617f},
-std::array<float,2>{0.392053306f, 0.395709693f},
-std::array<float,2>{0.160588771f, 0.988217354f},
-std::array<float,2>{0.880209565f, 0.055380825f},
-std::array<float,2>{0.98206079f, 0.687642872f},
-std::array<float,2>{0.217509359f, 0.352792472f},
-std::array<float,2>{0.481099963f, 0.784167945f},
-std::array<float,2>{0.500538826f, 0.129434571f},
-std::array<float,2>{0.734181881f, 0.89693892f},
-std::array<float,2>{0.275960296f, 0.102483302f},
-std::array<float,2>{0.119414166f, 0.5959993f},
-std::array<float,2>{0.794214785f, 0.470322728f},
-std::array<float,2>{0.912201047f, 0.96865356f},
-std::array<float,2>{0.12627314f, 0.00579089066f},
-std::array<float,2>{0.418896228f, 0.502059221f},
-std::array<float,2>{0.584064484f, 0.424594522f},
-std::array<float,2>{0.669692993f, 0.662763119f},
-std::array<float,2>{0.334626198f, 0.288916945f},
-std::array<float,2>{0.00265231146f, 0.835835814f},
-std::array<float,2>{0.856456459f, 0.20980148f},
-std::array<float,2>{0.757496297f, 0.586897433f},
-std::array<float,2>{0.0779706687f, 0.444842815f},
-std::array<float,2>{0.288490653f, 0.91934371f},
-std::array<float,2>{0.699085832f, 0.0681773722f},
-std::array<float,2>{0.551555991f, 0.769080043f},
-std::array<float,2>{0.438194931f, 0.162819475f},
-std::array<float,2>{0.248228103f, 0.745440602f},
-std::array<float,2>{0.953362286f, 0.338720918f},
-std::array<float,2>{0.800501525f, 0.922228575f},
-std::array<float,2>{0.0968989879f, 0.0871164501f},
-std::array<float,2>{0.263786435f, 0.574738026f},
-std::array<float,2>{0.736305237f, 0.456881553f},
-std::array<float,2>{0.525794983f, 0.72275722f},
-std::array<float,2>{0.48798725f, 0.31655708f},
-std::array<float,2>{0.191735402f, 0.754559278f},
-std::array<float,2>{0.996335149f, 0.176502869f},
-std::array<float,2>{0.900804222f, 0.516242206f},
-std::array<float,2>{0.176368535f, 0.408071697f},
-std::array<float,2>{0.379006654f, 0.945138335f},
-std::array<float,2>{0.615727663f, 0.0305806212f},
-std::array<float,2>{0.63102144f, 0.822456717f},
-std::array<float,2>{0.352109581f, 0.188790441f},
-std::array<float,2>{0.0579375997f, 0.677887976f},
-std::array<float,2>{0.825273216f, 0.305636317f},
-std::array<float,2>{0.94376111f, 0.801266491f},
-std::array<float,2>{0.228128999f, 0.152394682f},
-std::array<float,2>{0.46525836f, 0.713242114f},
-std::array<float,2>{0.540449619f, 0.368895948f},
-std::array<float,2>{0.711019993f, 0.609931767f},
-std::array<float,2>{0.299700081f, 0.49402979f},
-std::array<float,2>{0.0929266363f, 0.889087856f},
-std::array<float,2>{0.781062722f, 0.109613955f},
-std::array<float,2>{0.865281582f, 0.62533921f},
-std::array<float,2>{0.0299941208f, 0.279133767f},
-std::array<float,2>{0.325472295f, 0.868378758f},
-std::array<float,2>{0.680146873f, 0.240919858f},
-std::array<float,2>{0.567780674f, 0.982311606f},
-std::array<float,2>{0.42475456f, 0.0445669554f},
-std::array<float,2>{0.14749068f, 0.536124647f},
-std::array<float,2>{0.935022712f, 0.381535769f},
-std::array<float,2>{0.775174797f, 0.842319369f},
-std::array<float,2>{0.0896944106f, 0.218056202f},
-std::array<float,2>{0.303078473f, 0.671269357f},
-std::array<float,2>{0.717963815f, 0.29502815f},
-std::array<float,2>{0.545110404f, 0.510386169f},
-std::array<float,2>{0.461909384f, 0.437203795f},
-std::array<float,2>{0.231436089f, 0.960530579f},
-std::array<float,2>{0.938475966f, 0.0151215456f},
-std::array<float,2>{0.930782855f, 0.738366008f},
-std::array<float,2>{0.143667042f, 0.332096368f},
-std::array<float,2>{0.427156717f, 0.775821745f},
-std::array<float,2>{0.564871073f, 0.169850662f},
-std::array<float,2>{0.686766922f, 0.909440517f},
-std::array<float,2>{0.323245287f, 0.0707673728f},
-std::array<float,2>{0.0256286468f, 0.5817765f},
-std::array<float,2>{0.862354398f, 0.44559148f},
-std::array<float,2>{0.995215178f, 0.999692917f},
-std::array<float,2>{0.188886717f, 0.0481374897f},
-std::array<float,2>{0.491482466f, 0.547608256f},
-std::array<float,2>{0.530415893f, 0.404327512f},
-std::array<float,2>{0.741624594f, 0.644241035f},
-std::array<float,2>{0.260203183f, 0.250718236f},
-std::array<float,2>{0.0984484702f, 0.851842523f},
-std::array<float,2>{0.800911665f, 0.229331404f},
-std::array<float,2>{0.821047485f, 0.602286339f},
-std::array<float,2>{0.0608856119f, 0.480227858f},
-std::array<float,2>{0.355874836f, 0.902670622f},
-std::array<float,2>{0.626001418f, 0.0956974551f},
-std::array<float,2>{0.611250103f, 0.789404511f},
-std::array<float,2>{0.375315726f, 0.135971829f},
-std::array<float,2>{0.175183713f, 0.699830353f},
-std::array<float,2>{0.904503763f, 0.344277978f},
-std::array<float,2>{0.853154182f, 0.880945444f},
-std::array<float,2>{0.00769993337f, 0.119810432f},
-std::array<float,2>{0.330245167f, 0.623201549f},
-std::array<float,2>{0.665750086f, 0.48832652f},
-std::array<float,2>{0.58169347f, 0.707490802f},
-std::array<float,2>{0.416678548f, 0.359804273f},
-std::array<float,2>{0.130582467f, 0.807343602f},
-std::array<float,2>{0.907705426f, 0.148413077f},
-std::array<float,2>{0.957747042f, 0.542955935f},
-std::array<float,2>{0.242369562f, 0.384888172f},
-std::array<float,2>{0.443056911f, 0.975763142f},
-std::array<float,2>{0.547790289f, 0.0335729197f},
-std::array<float,2>{0.701267183f, 0.859819293f},
-std::array<float,2>{0.281408429f, 0.245839581f},
-std::array<float,2>{0.0731600001f, 0.634147346f},
-std::array<float,2>{0.752585888f, 0.270709813f},
-std::array<float,2>{0.876378715f, 0.763953686f},
-std::array<float,2>{0.158015877f, 0.185723498f},
-std::array<float,2>{0.395793796f, 0.72936517f},
-std::array<float,2>{0.605285048f, 0.321007401f},
-std::array<float,2>{0.652569652f, 0.567025602f},
-std::array<float,2>{0.366259336f, 0.463201463f},
-std::array<float,2>{0.0455066673f, 0.930839241f},
-std::array<float,2>{0.829489827f, 0.0841007903f},
-std::array<float,2>{0.790898681f, 0.680325687f},
-std::array<float,2>{0.121637158f, 0.296926469f},
-std::array<float,2>{0.27822718f, 0.81561023f},
-std::array<float,2>{0.727304459f, 0.196545258f},
-std::array<float,2>{0.504095852f, 0.950894356f},
-std::array<float,2>{0.478824526f, 0.0173607897f},
-std::array<float,2>{0.211134464f, 0.528842807f},
-std::array<float,2>{0.976730466f, 0.415282935f},
-std::array<float,2>{0.837403893f, 0.797277808f},
-std::array<float,2>{0.0349117294f, 0.15126206f},
-std::array<float,2>{0.369454771f, 0.714941502f},
-std::array<float,2>{0.64297688f, 0.373725444f},
-std::array<float,2>{0.598906577f, 0.616584003f},
-std::array<float,2>{0.405497193f, 0.498334438f},
-std::array<float,2>{0.168444172f, 0.885360241f},
-std::array<float,2>{0.88944006f, 0.114596203f},
-std::array<float,2>{0.970956087f, 0.632806063f},
-std::array<float,2>{0.208094195f, 0.275700629f},
-std::array<float,2>{0.471536249f, 0.873633564f},
-std::array<float,2>{0.514327407f, 0.234922543f},
-std::array<float,2>{0.723035872f, 0.976806521f},
-std::array<float,2>{0.268841088f, 0.0413699783f},
-std::array<float,2>{0.115644664f, 0.533995569f},
-std::array<float,2>{0.782369673f, 0.375633359f},
-std::array<float,2>{0.918193996f, 0.929084539f},
-std::array<float,2>{0.137839869f, 0.0921630338f},
-std::array<float,2>{0.410422951f, 0.573649883f},
-std::array<float,2>{0.593157113f, 0.460911214f},
-std::array<float,2>{0.660951674f, 0.721953869f},
-std::array<float,2>{0.336962849f, 0.314310551f},
-std::array<float,2>{0.0108810728f, 0.750642478f},
-std::array<float,2>{0.850010633f, 0.172112271f},
-std::array<float,2>{0.759210527f, 0.521557748f},
-std::array<float,2>{0.0695047602f, 0.411582291f},
-std::array<float,2>{0.293946654f, 0.939441621f},
-std::array<float,2>{0.690912843f, 0.0251769591f},
-std::array<float,2>{0.562480927f, 0.827945411f},
-std::array<float,2>{0.446746349f, 0.193954736f},
-std::array<float,2>{0.240850061f, 0.675354719f},
-std::array<float,2>{0.964091003f, 0.309448123f},
-std::array<float,2>{0.808997273f, 0.961605489f},
-std::array<float,2>{0.109137312f, 0.00236915052f},
-std::array<float,2>{0.253321737f, 0.505766392f},
-std::array<float,2>{0.747770607f, 0.428254724f},
-std::array<float,2>{0.519661605f, 0.659126639f},
-std::array<float,2>{0.495829225f, 0.283864528f},
-std::array<float,2>{0.197003901f, 0.831833243f},
-std::array<float,2>{0.990430236f, 0.205472901f},
-std::array<float,2>{0.8966676f, 0.593181789f},
-std::array<float,2>{0.17972894f, 0.44058913f},
-std::array<float,2>{0.389969945f, 0.916278183f},
-std::array<float,2>{0.622267723f, 0.0651431754f},
-std::array<float,2>{0.63553822f, 0.773370147f},
-std::array<float,2>{0.346333236f, 0.159310758f},
-std::array<float,2>{0.0476719812f, 0.747068226f},
-std::array<float,2>{0.820129871f, 0.340169847f},
-std::array<float,2>{0.950448275f, 0.848888993f},
-std::array<float,2>{0.22412619f, 0.220679313f},
-std::array<float,2>{0.459072828f, 0.649728715f},
-std::array<float,2>{0.538867116f, 0.258674413f},
-std::array<float,2>{0.705669641f, 0.562241793f},
-std::array<float,2>{0.307255954f, 0.391215831f},
-std::array<float,2>{0.0835583284f, 0.990474761f},
-std::array<float,2>{0.770069957f, 0.0622800998f},
-std::array<float,2>{0.874549866f, 0.691592693f},
-std::array<float,2>{0.0216057673f, 0.355518341f},
-std::array<float,2>{0.316207826f, 0.785762548f},
-std::array<float,2>{0.67921263f, 0.125938147f},
-std::array<float,2>{0.572948396f, 0.890934706f},
-std::array<float,2>{0.435752183f, 0.106792927f},
-std::array<float,2>{0.152945548f, 0.598125279f},
-std::array<float,2>{0.92815429f, 0.474514872f},
-std::array<float,2>{0.785357475f, 0.780483902f},
-std::array<float,2>{0.110935397f, 0.164290145f},
-std::array<float,2>{0.272113949f, 0.736331463f},
-std::array<float,2>{0.71899575f, 0.329393506f},
-std::array<float,2>{0.51046139f, 0.585738361f},
-std::array<float,2>{0.475311518f, 0.450740546f},
-std::array<float,2>{0.204141542f, 0.912701488f},
-std::array<float,2>{0.974469662f, 0.0781153142f},
-std::array<float,2>{0.883726358f, 0.665840983f},
-std::array<float,2>{0.167875692f, 0.291859865f},
-std::array<float,2>{0.400398761f, 0.838942468f},
-std::array<float,2>{0.595280468f, 0.21100156f},
-std::array<float,2>{0.64559406f, 0.956004143f},
-std::array<float,2>{0.374111265f, 0.00883209333f},
-std::array<float,2>{0.0360171087f, 0.515116394f},
-std::array<float,2>{0.843227208f, 0.432659954f},
-std::array<float,2>{0.965521514f, 0.901340783f},
-std::array<float,2>{0.237125725f, 0.0981522426f},
-std::array<float,2>{0.452726185f, 0.606842279f},
-std::array<float,2>{0.556467772f, 0.481944501f},
-std::array<float,2>{0.691841722f, 0.695719302f},
-std::array<float,2>{0.289493173f, 0.349203497f},
-std::array<float,2>{0.0652754232f, 0.794355571f},
-std::array<float,2>{0.763885021f, 0.137049124f},
-std::array<float,2>{0.847280145f, 0.554685175f},
-std::array<float,2>{0.0124575589f, 0.399204165f},
-std::array<float,2>{0.342330724f, 0.993552864f},
-std::array<float,2>{0.659508884f, 0.0532933213f},
-std::array<float,2>{0.587251723f, 0.857000768f},
-std::array<float,2>{0.407750726f, 0.231000766f},
-std::array<float,2>{0.136136234f, 0.646708608f},
-std::array<float,2>{0.914560378f, 0.255837142f},
-std::array<float,2>{0.815960288f, 0.972206295f},
-std::array<float,2>{0.0541110709f, 0.0377879888f},
-std::array<float,2>{0.351249069f, 0.543623567f},
-std::array<float,2>{0.63843143f, 0.388010889f},
-std::array<float,2>{0.620830834f, 0.637435138f},
-std::array<float,2>{0.386312634f, 0.266507447f},
-std::array<float,2>{0.183870271f, 0.863627732f},
-std::array<float,2>{0.891822219f, 0.248218149f},
-std::array<float,2>{0.986643851f, 0.619468212f},
-std::array<float,2>{0.199779779f, 0.487431496f},
-std::array<float,2>{0.499122947f, 0.877336442f},
-std::array<float,2>{0.518268943f, 0.123626292f},
-std::array<float,2>{0.743801951f, 0.809166193f},
-std::array<float,2>{0.256207466f, 0.141820252f},
-std::array<float,2>{0.102293864f, 0.703228474f},
-std::array<float,2>{0.808125436f, 0.364095807f},
-std::array<float,2>{0.921913624f, 0.817856729f},
-std::array<float,2>{0.152124584f, 0.202975944f},
-std::array<float,2>{0.433249384f, 0.6849913f},
-std::array<float,2>{0.577175915f, 0.303857714f},
-std::array<float,2>{0.675134182f, 0.52628845f},
-std::array<float,2>{0.318837583f, 0.420446634f},
-std::array<float,2>{0.0172611419f, 0.947102308f},
-std::array<float,2>{0.868944466f, 0.0198055003f},
-std::array<float,2>{0.767205f, 0.730684519f},
-std::array<float,2>{0.0786530524f, 0.325745434f},
-std::array<float,2>{0.309669524f, 0.761090994f},
-std::array<float,2>{0.710893869f, 0.180223316f},
-std::array<float,2>{0.531702816f, 0.934577167f},
-std::array<float,2>{0.455554307f, 0.0816080272f},
-std::array<float,2>{0.220162183f, 0.564371645f},
-std::array<float,2>{0.948749602f, 0.465804011f},
-std::array<float,2>{0.8636325f, 0.867854774f},
-std::array<float,2>{0.0277913846f, 0.241242751f},
-std::array<float,2>{0.32773146f, 0.626351595f},
-std::array<float,2>{0.682391524f, 0.278089345f},
-std::array<float,2>{0.569736063f, 0.536835432f},
-std::array<float,2>{0.422066271f, 0.382643074f},
-std::array<float,2>{0.145963699f, 0.981110692f},
-std::array<float,2>{0.937038422f, 0.0432021581f},
-std::array<float,2>{0.941541851f, 0.714273989f},
-std::array<float,2>{0.229155064f, 0.367482603f},
-std::array<float,2>{0.467284769f, 0.801966429f},
-std::array<float,2>{0.542240798f, 0.153776646f},
-std::array<float,2>{0.713588953f, 0.890022278f},
-std::array<float,2>{0.298201948f, 0.11077822f},
-std::array<float,2>{0.0911770463f, 0.611073077f},
-std::array<float,2>{0.777981579f, 0.492571086f},
-std::array<float,2>{0.899708569f, 0.943653286f},
-std::array<float,2>{0.179231152f, 0.0296800155f},
-std::array<float,2>{0.382685542f, 0.516815543f},
-std::array<float,2>{0.614144087f, 0.407142699f},
-std::array<float,2>{0.629270136f, 0.679147243f},
-std::array<float,2>{0.354998976f, 0.306536943f},
-std::array<float,2>{0.0564212985f, 0.823752284f},
-std::array<float,2>{0.827067733f, 0.188472435f},
-std::array<float,2>{0.797261834f, 0.57590127f},
-std::array<float,2>{0.094607681f, 0.455911934f},
-std::array<float,2>{0.263177276f, 0.92302531f},
-std::array<float,2>{0.736906052f, 0.0863291994f},
-std::array<float,2>{0.524561584f, 0.754929602f},
-std::array<float,2>{0.485785812f, 0.176993668f},
-std::array<float,2>{0.194544807f, 0.723724306f},
-std::array<float,2>{0.998374283f, 0.317896843f},
-std::array<float,2>{0.754603803f, 0.918594599f},
-std::array<float,2>{0.0760324597f, 0.0667894557f},
-std::array<float,2>{0.285875648f, 0.587717295f},
-std::array<float,2>{0.696604073f, 0.44369325f},
-std::array<float,2>{0.55336386f, 0.744147897f},
-std::array<float,2>{0.439619839f, 0.339143187f},
-std::array<float,2>{0.247299775f, 0.76837641f},
-std::array<float,2>{0.955725431f, 0.163469508f},
-std::array<float,2>{0.910892844f, 0.503614604f},
-std::array<float,2>{0.127456635f, 0.425370276f},
-std::array<float,2>{0.421220154f, 0.96759367f},
-std::array<float,2>{0.583601534f, 0.00470279204f},
-std::array<float,2>{0.671560764f, 0.834659219f},
-std::array<float,2>{0.332185268f, 0.21067664f},
-std::array<float,2>{0.00185126031f, 0.663091302f},
-std::array<float,2>{0.85915029f, 0.287171572f},
-std::array<float,2>{0.98338151f, 0.784996331f},
-std::array<float,2>{0.216270208f, 0.130309626f},
-std::array<float,2>{0.484050274f, 0.689296246f},
-std::array<float,2>{0.502106607f, 0.352216154f},
-std::array<float,2>{0.730767906f, 0.596853793f},
-std::array<float,2>{0.273485929f, 0.469294131f},
-std::array<float,2>{0.118276395f, 0.898069322f},
-std::array<float,2>{0.796834171f, 0.102917239f},
-std::array<float,2>{0.835319877f, 0.654443026f},
-std::array<float,2>{0.0394992046f, 0.264865786f},
-std::array<float,2>{0.361906946f, 0.846499741f},
-std::array<float,2>{0.64991498f, 0.226458669f},
-std::array<float,2>{0.605754673f, 0.986603439f},
-std::array<float,2>{0.393773079f, 0.0561173521f},
-std::array<float,2>{0.163084984f, 0.55640471f},
-std::array<float,2>{0.881966531f, 0.394987106f},
-std::array<float,2>{0.803827643f, 0.855316937f},
-std::array<float,2>{0.0997922048f, 0.227353349f},
-std::array<float,2>{0.258547217f, 0.64084816f},
-std::array<float,2>{0.739818037f, 0.252694994f},
-std::array<float,2>{0.527951896f, 0.55034548f},
-std::array<float,2>{0.490208656f, 0.402472168f},
-std::array<float,2>{0.190731451f, 0.997660875f},
-std::array<float,2>{0.992816985f, 0.0500677526f},
-std::array<float,2>{0.902702808f, 0.701348901f},
-std::array<float,2>{0.172533542f, 0.347234517f},
-std::array<float,2>{0.378633767f, 0.791678488f},
-std::array<float,2>{0.611531377f, 0.13452071f},
-std::array<float,2>{0.627569914f, 0.906045496f},
-std::array<float,2>{0.358993888f, 0.0976497307f},
-std::array<float,2>{0.0600789562f, 0.603710771f},
-std::array<float,2>{0.824112475f, 0.477506995f},
-std::array<float,2>{0.939521849f, 0.958299875f},
-std::array<float,2>{0.232664123f, 0.0133671239f},
-std::array<float,2>{0.464177817f, 0.509127617f},
-std::array<float,2>{0.54360193f, 0.435034603f},
-std::array<float,2>{0.716215014f, 0.668769419f},
-std::array<float,2>{0.301094234f, 0.294326603f},
-std::array<float,2>{0.0870644525f, 0.840977848f},
-std::array<float,2>{0.777255535f, 0.214864388f},
-std::array<float,2>{0.859667242f, 0.579600811f},
-std::array<float,2>{0.0241811648f, 0.448417038f},
-std::array<float,2>{0.322104484f, 0.906968594f},
-std::array<float,2>{0.684897542f, 0.0731827617f},
-std::array<float,2>{0.56257385f, 0.774606645f},
-std::array<float,2>{0.428200483f, 0.170678288f},
-std::array<float,2>{0.14138633f, 0.742082536f},
-std::array<float,2>{0.93187654f, 0.335895598f},
-std::array<float,2>{0.830278575f, 0.932133496f},
-std::array<float,2>{0.043846231f, 0.0820558891f},
-std::array<float,2>{0.365036786f, 0.56936568f},
-std::array<float,2>{0.656223834f, 0.461402476f},
-std::array<float,2>{0.602281988f, 0.727017581f},
-std::array<float,2>{0.397110164f, 0.323216259f},
-std::array<float,2>{0.159829617f, 0.763640225f},
-std::array<float,2>{0.878062129f, 0.184085712f},
-std::array<float,2>{0.980041802f, 0.529692292f},
-std::array<float,2>{0.21335806f, 0.416484624f},
-std::array<float,2>{0.476829886f, 0.951351106f},
-std::array<float,2>{0.506070018f, 0.0186308958f},
-std::array<float,2>{0.730380476f, 0.813241482f},
-std::array<float,2>{0.280185044f, 0.198608249f},
-std::array<float,2>{0.123512372f, 0.682107508f},
-std::array<float,2>{0.792412579f, 0.299661189f},
-std::array<float,2>{0.909938991f, 0.806613326f},
-std::array<float,2>{0.13102971f, 0.145649374f},
-std::array<float,2>{0.414309353f, 0.709128022f},
-std::array<float,2>{0.579169393f, 0.363225013f},
-std::array<float,2>{0.66607362f, 0.621704578f},
-std::array<float,2>{0.328308672f, 0.491965711f},
-std::array<float,2>{0.00533087971f, 0.88039124f},
-std::array<float,2>{0.854221344f, 0.118921623f},
-std::array<float,2>{0.750315726f, 0.635268211f},
-std::array<float,2>{0.0716977045f, 0.273350954f},
-std::array<float,2>{0.283290654f, 0.863222539f},
-std::array<float,2>{0.700676024f, 0.242368042f},
-std::array<float,2>{0.549693048f, 0.97345686f},
-std::array<float,2>{0.44495523f, 0.0320282541f},
-std::array<float,2>{0.2442808f, 0.540497065f},
-std::array<float,2>{0.960790455f, 0.38366127f},
-std::array<float,2>{0.848097861f, 0.753656864f},
-std::array<float,2>{0.00863165781f, 0.175642177f},
-std::array<float,2>{0.338474542f, 0.72021693f},
-std::array<float,2>{0.662982821f, 0.315127075f},
-std::array<float,2>{0.590574145f, 0.570982873f},
-std::array<float,2>{0.412501454f, 0.458841354f},
-std::array<float,2>{0.139886558f, 0.927445948f},
-std::array<float,2>{0.920788407f, 0.0908196941f},
-std::array<float,2>{0.962600112f, 0.673490763f},
-std::array<float,2>{0.239322126f, 0.31234163f},
-std::array<float,2>{0.448504627f, 0.825634718f},
-std::array<float,2>{0.560426056f, 0.192477509f},
-std::array<float,2>{0.688947976f, 0.941092074f},
-std::array<float,2>{0.295926541f, 0.0266870651f},
-std::array<float,2>{0.0668135062f, 0.520634055f},
-std::array<float,2>{0.76110363f, 0.413947254f},
-std::array<float,2>{0.88760829f, 0.883334458f},
-std::array<float,2>{0.170044631f, 0.116484769f},
-std::array<float,2>{0.403675318f, 0.614848316f},
-std::array<float,2>{0.600858748f, 0.496831805f},
-std::array<float,2>{0.641776443f, 0.717965126f},
-std::array<float,2>{0.368581951f, 0.372173846f},
-std::array<float,2>{0.0317376293f, 0.799515069f},
-std::array<float,2>{0.839772522f, 0.148767188f},
-std::array<float,2>{0.784744859f, 0.533072531f},
-std::array<float,2>{0.114105821f, 0.378254294f},
-std::array<float,2>{0.266585767f, 0.97912401f},
-std::array<float,2>{0.726081848f, 0.0405258723f},
-std::array<float,2>{0.512294114f, 0.872347236f},
-std::array<float,2>{0.470188797f, 0.237643197f},
-std::array<float,2>{0.209738165f, 0.630241215f},
-std::array<float,2>{0.970597446f, 0.274240017f},
-std::array<float,2>{0.773266912f, 0.989240646f},
-std::array<float,2>{0.0846275017f, 0.0602824613f},
-std::array<float,2>{0.306329459f, 0.559173942f},
-std::array<float,2>{0.705041587f, 0.3937729f},
-std::array<float,2>{0.536049187f, 0.652169704f},
-std::array<float,2>{0.45756948f, 0.260993987f},
-std::array<float,2>{0.225771174f, 0.85002929f},
-std::array<float,2>{0.951420069f, 0.222617894f},
-std::array<float,2>{0.926448166f, 0.60046339f},
-std::array<float,2>{0.154944897f, 0.474796027f},
-std::array<float,2>{0.435254782f, 0.892684102f},
-std::array<float,2>{0.570918024f, 0.107554004f},
-std::array<float,2>{0.676146984f, 0.788827777f},
-std::array<float,2>{0.313850611f, 0.12743859f},
-std::array<float,2>{0.0211423822f, 0.693601489f},
-std::array<float,2>{0.87216711f, 0.358229727f},
-std::array<float,2>{0.98992604f, 0.828782797f},
-std::array<float,2>{0.19811286f, 0.203428283f},
-std::array<float,2>{0.493812948f, 0.657342672f},
-std::array<float,2>{0.52247566f, 0.281582117f},
-std::array<float,2>{0.74919039f, 0.507504702f},
-std::array<float,2>{0.251501769f, 0.42720902f},
-std::array<float,2>{0.106331415f, 0.963892758f},
-std::array<float,2>{0.811222255f, 0.00101797574f},
-std::array<float,2>{0.817151725f, 0.749033868f},
-std::array<float,2>{0.0506426692f, 0.342933059f},
-std::array<float,2>{0.344933778f, 0.769943416f},
-std::array<float,2>{0.633299053f, 0.156747624f},
-std::array<float,2>{0.624298215f, 0.914323092f},
-std::array<float,2>{0.387163222f, 0.0628524944f},
-std::array<float,2>{0.183326766f, 0.589906514f},
-std::array<float,2>{0.894589961f, 0.437895864f},
-std::array<float,2>{0.762879431f, 0.795526564f},
-std::array<float,2>{0.0626517832f, 0.139146462f},
-std::array<float,2>{0.291715056f, 0.698867321f},
-std::array<float,2>{0.693924129f, 0.350459933f},
-std::array<float,2>{0.556776106f, 0.608287156f},
-std::array<float,2>{0.450463176f, 0.483052194f},
-std::array<float,2>{0.236186966f, 0.898544192f},
-std::array<float,2>{0.968572676f, 0.101245634f},
-std::array<float,2>{0.916650712f, 0.64529705f},
-std::array<float,2>{0.133478343f, 0.256441802f},
-std::array<float,2>{0.40890497f, 0.858335793f},
-std::array<float,2>{0.588916302f, 0.234214693f},
-std::array<float,2>{0.656933844f, 0.99417001f},
-std::array<float,2>{0.340894312f, 0.0511403643f},
-std::array<float,2>{0.0140916314f, 0.551428616f},
-std::array<float,2>{0.845064402f, 0.401124477f},
-std::array<float,2>{0.975404561f, 0.911518514f},
-std::array<float,2>{0.206656143f, 0.0756343231f},
-std::array<float,2>{0.473178327f, 0.583855808f},
-std::array<float,2>{0.509664774f, 0.452110469f},
-std::array<float,2>{0.720824718f, 0.735696793f},
-std::array<float,2>{0.271091551f, 0.331073701f},
-std::array<float,2>{0.112978138f, 0.778952122f},
-std::array<float,2>{0.788226664f, 0.16792047f},
-std::array<float,2>{0.841091692f, 0.512896717f},
-std::array<float,2>{0.0385674573f, 0.430195302f},
-std::array<float,2>{0.372090906f, 0.953147233f},
-std::array<float,2>{0.646916568f, 0.0102149229f},
-std::array<float,2>{0.596731186f, 0.837722003f},
-std::array<float,2>{0.400238484f, 0.213027403f},
-std::array<float,2>{0.165388688f, 0.667574048f},
-std::array<float,2>{0.885605454f, 0.290511459f},
-std::array<float,2>{0.87064755f, 0.94864887f},
-std::array<float,2>{0.0185035113f, 0.0225743614f},
-std::array<float,2>{0.317629993f, 0.524545729f},
-std::array<float,2>{0.672801793f, 0.418825954f},
-std::array<float,2>{0.576010227f, 0.685603559f},
-std::array<float,2>{0.430156171f, 0.302691191f},
-std::array<float,2>{0.149277687f, 0.819687426f},
-std::array<float,2>{0.924505949f, 0.201085389f},
-std::array<float,2>{0.946674228f, 0.565470397f},
-std::array<float,2>{0.221842289f, 0.467129022f},
-std::array<float,2>{0.455064267f, 0.937134802f},
-std::array<float,2>{0.535069525f, 0.0787380561f},
-std::array<float,2>{0.708201885f, 0.759330392f},
-std::array<float,2>{0.311575621f, 0.182653576f},
-std::array<float,2>{0.0806154832f, 0.733470917f},
-std::array<float,2>{0.76774174f, 0.32780996f},
-std::array<float,2>{0.89355576f, 0.865618169f},
-std::array<float,2>{0.185705826f, 0.248013288f},
-std::array<float,2>{0.384440631f, 0.640231311f},
-std::array<float,2>{0.618579328f, 0.268209547f},
-std::array<float,2>{0.639355123f, 0.544967294f},
-std::array<float,2>{0.347879291f, 0.390444696f},
-std::array<float,2>{0.051539734f, 0.96983254f},
-std::array<float,2>{0.813222289f, 0.0363520943f},
-std::array<float,2>{0.805037737f, 0.706772864f},
-std::array<float,2>{0.104119353f, 0.366062254f},
-std::array<float,2>{0.254921824f, 0.811576724f},
-std::array<float,2>{0.745180368f, 0.143042967f},
-std::array<float,2>{0.516984165f, 0.875173986f},
-std::array<float,2>{0.496680439f, 0.122150004f},
-std::array<float,2>{0.201762035f, 0.619129896f},
-std::array<float,2>{0.986274719f, 0.484569281f},
-std::array<float,2>{0.824659169f, 0.820910633f},
-std::array<float,2>{0.0574814267f, 0.191268846f},
-std::array<float,2>{0.353200704f, 0.67692554f},
-std::array<float,2>{0.632745743f, 0.307057083f},
-std::array<float,2>{0.616791666f, 0.518202662f},
-std::array<float,2>{0.380335331f, 0.408475399f},
-std::array<float,2>{0.177695081f, 0.941669583f},
-std::array<float,2>{0.901577532f, 0.029257128f},
-std::array<float,2>{0.997312248f, 0.725093603f},
-std::array<float,2>{0.193090871f, 0.319940925f},
-std::array<float,2>{0.486695588f, 0.75652343f},
-std::array<float,2>{0.527285814f, 0.177971676f},
-std::array<float,2>{0.734659433f, 0.923895836f},
-std::array<float,2>{0.265033901f, 0.0879148245f},
-std::array<float,2>{0.096616976f, 0.577020109f},
-std::array<float,2>{0.798867702f, 0.453506649f},
-std::array<float,2>{0.933699071f, 0.983798385f},
-std::array<float,2>{0.147293717f, 0.0457447283f},
-std::array<float,2>{0.425384611f, 0.538143218f},
-std::array<float,2>{0.566981137f, 0.37903589f},
-std::array<float,2>{0.680768669f, 0.628128052f},
-std::array<float,2>{0.324527115f, 0.280772835f},
-std::array<float,2>{0.0309567545f, 0.869373083f},
-std::array<float,2>{0.866693735f, 0.238477543f},
-std::array<float,2>{0.780091107f, 0.611889899f},
-std::array<float,2>{0.0925068557f, 0.495085448f},
-std::array<float,2>{0.300275385f, 0.88680315f},
-std::array<float,2>{0.712349534f, 0.111982338f},
-std::array<float,2>{0.539117098f, 0.803155482f},
-std::array<float,2>{0.46660006f, 0.154639348f},
-std::array<float,2>{0.227265611f, 0.71160996f},
-std::array<float,2>{0.945271969f, 0.370781869f},
-std::array<float,2>{0.793930292f, 0.89585954f},
-std::array<float,2>{0.120506838f, 0.104171641f},
-std::array<float,2>{0.277284592f, 0.594126523f},
-std::array<float,2>{0.732737958f, 0.470951378f},
-std::array<float,2>{0.501397908f, 0.689764321f},
-std::array<float,2>{0.48152861f, 0.354409128f},
-std::array<float,2>{0.218615696f, 0.782857001f},
-std::array<float,2>{0.981095076f, 0.131467044f},
-std::array<float,2>{0.879265189f, 0.558541775f},
-std::array<float,2>{0.161236316f, 0.397851706f},
-std::array<float,2>{0.391386777f, 0.985423326f},
-std::array<float,2>{0.607987344f, 0.0577584095f},
-std::array<float,2>{0.650602639f, 0.844588161f},
-std::array<float,2>{0.360992521f, 0.22391288f},
-std::array<float,2>{0.0423361957f, 0.653699636f},
-std::array<float,2>{0.832564116f, 0.262092322f},
-std::array<float,2>{0.954931498f, 0.766734362f},
-std::array<float,2>{0.249569327f, 0.161101431f},
-std::array<float,2>{0.438946456f, 0.74324888f},
-std::array<float,2>{0.551950812f, 0.336212307f},
-std::array<float,2>{0.697610855f, 0.588766038f},
-std::array<float,2>{0.287434638f, 0.443323672f},
-std::array<float,2>{0.0769142807f, 0.920801342f},
-std::array<float,2>{0.756616056f, 0.0695578456f},
-std::array<float,2>{0.856246293f, 0.662024081f},
-std::array<float,2>{0.00328755123f, 0.286785215f},
-std::array<float,2>{0.335759878f, 0.833764434f},
-std::array<float,2>{0.668199241f, 0.208065316f},
-std::array<float,2>{0.585389495f, 0.965491951f},
-std::array<float,2>{0.419816792f, 0.00726241665f},
-std::array<float,2>{0.125028521f, 0.500568748f},
-std::array<float,2>{0.913403034f, 0.421996832f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.1557118f, 0.405871511f},
-std::array<float,2>{0.880000651f, 0.907825828f},
-std::array<float,2>{0.606427014f, 0.0420654938f},
-std::array<float,2>{0.486698985f, 0.712743819f},
-std::array<float,2>{0.314163625f, 0.18321915f},
-std::array<float,2>{0.704061687f, 0.531331897f},
-std::array<float,2>{0.751543045f, 0.281016022f},
-std::array<float,2>{0.0934163481f, 0.873383641f},
-std::array<float,2>{0.031288214f, 0.11659006f},
-std::array<float,2>{0.843235075f, 0.67640394f},
-std::array<float,2>{0.633186281f, 0.469347358f},
-std::array<float,2>{0.268226743f, 0.968303919f},
-std::array<float,2>{0.40354526f, 0.374424636f},
-std::array<float,2>{0.525738537f, 0.766686797f},
-std::array<float,2>{0.947320879f, 0.228372112f},
-std::array<float,2>{0.241251677f, 0.585513413f},
-std::array<float,2>{0.105141789f, 0.306922764f},
-std::array<float,2>{0.790404141f, 0.829248846f},
-std::array<float,2>{0.719919741f, 0.136055201f},
-std::array<float,2>{0.361880034f, 0.504779398f},
-std::array<float,2>{0.4621782f, 0.0150808822f},
-std::array<float,2>{0.585825384f, 0.730838478f},
-std::array<float,2>{0.932837188f, 0.437136084f},
-std::array<float,2>{0.179936349f, 0.90544647f},
-std::array<float,2>{0.213289037f, 0.217623487f},
-std::array<float,2>{0.982814193f, 0.624042988f},
-std::array<float,2>{0.543547153f, 0.316620767f},
-std::array<float,2>{0.41484493f, 0.781581461f},
-std::array<float,2>{0.288559407f, 0.448331624f},
-std::array<float,2>{0.683397472f, 0.973932087f},
-std::array<float,2>{0.867163539f, 0.0641080961f},
-std::array<float,2>{0.00734090433f, 0.63668263f},
-std::array<float,2>{0.0242502261f, 0.497410744f},
-std::array<float,2>{0.844534755f, 0.946882129f},
-std::array<float,2>{0.661711693f, 0.101137251f},
-std::array<float,2>{0.306567639f, 0.669844747f},
-std::array<float,2>{0.436150849f, 0.245702446f},
-std::array<float,2>{0.556493104f, 0.568502009f},
-std::array<float,2>{0.998735607f, 0.356851846f},
-std::array<float,2>{0.196407914f, 0.752230227f},
-std::array<float,2>{0.163967431f, 0.0476433747f},
-std::array<float,2>{0.91411829f, 0.69532454f},
-std::array<float,2>{0.56911236f, 0.376621574f},
-std::array<float,2>{0.447130889f, 0.931826711f},
-std::array<float,2>{0.348277986f, 0.250118792f},
-std::array<float,2>{0.737101555f, 0.851768374f},
-std::array<float,2>{0.804888904f, 0.171586141f},
-std::array<float,2>{0.12282832f, 0.554632306f},
-std::array<float,2>{0.224080905f, 0.328194261f},
-std::array<float,2>{0.955327034f, 0.802896738f},
-std::array<float,2>{0.503931284f, 0.198553726f},
-std::array<float,2>{0.378878593f, 0.608026028f},
-std::array<float,2>{0.254718035f, 0.0933837965f},
-std::array<float,2>{0.643247128f, 0.64865315f},
-std::array<float,2>{0.819651723f, 0.458720833f},
-std::array<float,2>{0.0538015626f, 0.994504392f},
-std::array<float,2>{0.064129822f, 0.141208991f},
-std::array<float,2>{0.770980597f, 0.516062617f},
-std::array<float,2>{0.701799273f, 0.288827866f},
-std::array<float,2>{0.341956913f, 0.825181782f},
-std::array<float,2>{0.469204694f, 0.418377846f},
-std::array<float,2>{0.617350757f, 0.877693295f},
-std::array<float,2>{0.904640377f, 0.0233488753f},
-std::array<float,2>{0.126832709f, 0.737934053f},
-std::array<float,2>{0.190125048f, 0.467717111f},
-std::array<float,2>{0.989869118f, 0.987748742f},
-std::array<float,2>{0.554244161f, 0.0785158873f},
-std::array<float,2>{0.426605195f, 0.642350972f},
-std::array<float,2>{0.298741072f, 0.194418639f},
-std::array<float,2>{0.668117464f, 0.595132947f},
-std::array<float,2>{0.856313527f, 0.339856833f},
-std::array<float,2>{0.0194793232f, 0.811217546f},
-std::array<float,2>{0.116733395f, 0.0244438592f},
-std::array<float,2>{0.803231418f, 0.747652173f},
-std::array<float,2>{0.746014953f, 0.40974018f},
-std::array<float,2>{0.353102207f, 0.88686645f},
-std::array<float,2>{0.439552426f, 0.291567057f},
-std::array<float,2>{0.570916414f, 0.817803144f},
-std::array<float,2>{0.910998702f, 0.150956467f},
-std::array<float,2>{0.164553136f, 0.530246854f},
-std::array<float,2>{0.0604665093f, 0.345336735f},
-std::array<float,2>{0.826857686f, 0.760384738f},
-std::array<float,2>{0.654021204f, 0.237577885f},
-std::array<float,2>{0.265512615f, 0.577952743f},
-std::array<float,2>{0.38355419f, 0.10183455f},
-std::array<float,2>{0.513535857f, 0.659823358f},
-std::array<float,2>{0.967175961f, 0.489505976f},
-std::array<float,2>{0.231861338f, 0.939484239f},
-std::array<float,2>{0.139151901f, 0.162966132f},
-std::array<float,2>{0.892568111f, 0.555182576f},
-std::array<float,2>{0.614417255f, 0.261946797f},
-std::array<float,2>{0.478757381f, 0.844172359f},
-std::array<float,2>{0.335403144f, 0.389654845f},
-std::array<float,2>{0.694155097f, 0.928293943f},
-std::array<float,2>{0.7798087f, 0.0605134331f},
-std::array<float,2>{0.0734398812f, 0.690587401f},
-std::array<float,2>{0.0801751986f, 0.42732659f},
-std::array<float,2>{0.758522689f, 0.895439804f},
-std::array<float,2>{0.716342568f, 0.000714323716f},
-std::array<float,2>{0.321749657f, 0.725740373f},
-std::array<float,2>{0.493031591f, 0.12688224f},
-std::array<float,2>{0.594762564f, 0.513852954f},
-std::array<float,2>{0.883361518f, 0.297176212f},
-std::array<float,2>{0.147491753f, 0.838051558f},
-std::array<float,2>{0.242459953f, 0.0735928416f},
-std::array<float,2>{0.938780904f, 0.626300871f},
-std::array<float,2>{0.519221544f, 0.440324694f},
-std::array<float,2>{0.393124759f, 0.983204961f},
-std::array<float,2>{0.280700415f, 0.321513355f},
-std::array<float,2>{0.628825843f, 0.794627011f},
-std::array<float,2>{0.829551041f, 0.21022591f},
-std::array<float,2>{0.0467403308f, 0.61487329f},
-std::array<float,2>{0.172142193f, 0.268966824f},
-std::array<float,2>{0.927455604f, 0.865632057f},
-std::array<float,2>{0.593131363f, 0.17200233f},
-std::array<float,2>{0.456142962f, 0.545559108f},
-std::array<float,2>{0.367874742f, 0.0343779102f},
-std::array<float,2>{0.727898777f, 0.703347862f},
-std::array<float,2>{0.784229875f, 0.394931704f},
-std::array<float,2>{0.100601345f, 0.919556618f},
-std::array<float,2>{0.0140154138f, 0.220779762f},
-std::array<float,2>{0.871592641f, 0.592124701f},
-std::array<float,2>{0.675758839f, 0.366707146f},
-std::array<float,2>{0.29473421f, 0.777390838f},
-std::array<float,2>{0.406687111f, 0.484022349f},
-std::array<float,2>{0.538234234f, 0.956599534f},
-std::array<float,2>{0.975385904f, 0.119437948f},
-std::array<float,2>{0.203426123f, 0.685774744f},
-std::array<float,2>{0.238189533f, 0.412260443f},
-std::array<float,2>{0.949926555f, 0.885128856f},
-std::array<float,2>{0.528707206f, 0.0293205455f},
-std::array<float,2>{0.398816645f, 0.742725134f},
-std::array<float,2>{0.272549808f, 0.153421342f},
-std::array<float,2>{0.639921546f, 0.526848435f},
-std::array<float,2>{0.838265657f, 0.29328385f},
-std::array<float,2>{0.0379085653f, 0.815449119f},
-std::array<float,2>{0.0863877386f, 0.0849631354f},
-std::array<float,2>{0.756133497f, 0.64683038f},
-std::array<float,2>{0.708953738f, 0.464117944f},
-std::array<float,2>{0.31834355f, 0.988783062f},
-std::array<float,2>{0.489167422f, 0.338236392f},
-std::array<float,2>{0.602720439f, 0.807886481f},
-std::array<float,2>{0.876360953f, 0.190186635f},
-std::array<float,2>{0.149877191f, 0.598036468f},
-std::array<float,2>{0.00294587226f, 0.261608034f},
-std::array<float,2>{0.861643434f, 0.850048363f},
-std::array<float,2>{0.684064806f, 0.160130575f},
-std::array<float,2>{0.28235808f, 0.561768293f},
-std::array<float,2>{0.421412557f, 0.0572199002f},
-std::array<float,2>{0.541139245f, 0.694653571f},
-std::array<float,2>{0.976886868f, 0.385269165f},
-std::array<float,2>{0.218093693f, 0.924828649f},
-std::array<float,2>{0.186992884f, 0.240203306f},
-std::array<float,2>{0.935670674f, 0.571308315f},
-std::array<float,2>{0.580495834f, 0.349111736f},
-std::array<float,2>{0.466634154f, 0.764833808f},
-std::array<float,2>{0.365285337f, 0.487772167f},
-std::array<float,2>{0.723604083f, 0.945065379f},
-std::array<float,2>{0.793886244f, 0.106244221f},
-std::array<float,2>{0.106162138f, 0.661813378f},
-std::array<float,2>{0.120067857f, 0.443107128f},
-std::array<float,2>{0.810817719f, 0.976954997f},
-std::array<float,2>{0.740186632f, 0.076375708f},
-std::array<float,2>{0.346313477f, 0.631978869f},
-std::array<float,2>{0.449926555f, 0.205768481f},
-std::array<float,2>{0.565735996f, 0.61177671f},
-std::array<float,2>{0.921845436f, 0.326281875f},
-std::array<float,2>{0.158453211f, 0.790772498f},
-std::array<float,2>{0.199278906f, 0.00432167388f},
-std::array<float,2>{0.99297756f, 0.721117496f},
-std::array<float,2>{0.562204421f, 0.422472537f},
-std::array<float,2>{0.431720734f, 0.893328726f},
-std::array<float,2>{0.309141695f, 0.304175049f},
-std::array<float,2>{0.658358395f, 0.840852618f},
-std::array<float,2>{0.84895885f, 0.131518945f},
-std::array<float,2>{0.027437292f, 0.508076191f},
-std::array<float,2>{0.132763326f, 0.36112234f},
-std::array<float,2>{0.900794566f, 0.776394844f},
-std::array<float,2>{0.624562323f, 0.225831345f},
-std::array<float,2>{0.475620776f, 0.588684559f},
-std::array<float,2>{0.338366032f, 0.123983815f},
-std::array<float,2>{0.696511269f, 0.680825591f},
-std::array<float,2>{0.769405782f, 0.478916615f},
-std::array<float,2>{0.0670773536f, 0.957292914f},
-std::array<float,2>{0.0504085571f, 0.176175728f},
-std::array<float,2>{0.815440118f, 0.540043712f},
-std::array<float,2>{0.646512628f, 0.273133755f},
-std::array<float,2>{0.253899366f, 0.861493111f},
-std::array<float,2>{0.379568964f, 0.39083764f},
-std::array<float,2>{0.500277162f, 0.915647805f},
-std::array<float,2>{0.959001362f, 0.0371400118f},
-std::array<float,2>{0.220637023f, 0.707045853f},
-std::array<float,2>{0.171546802f, 0.474651814f},
-std::array<float,2>{0.906881034f, 0.964808941f},
-std::array<float,2>{0.576494455f, 0.111284919f},
-std::array<float,2>{0.442026079f, 0.672319293f},
-std::array<float,2>{0.357842267f, 0.233468965f},
-std::array<float,2>{0.746105194f, 0.580619156f},
-std::array<float,2>{0.798371196f, 0.367216557f},
-std::array<float,2>{0.112596586f, 0.770990849f},
-std::array<float,2>{0.0223100036f, 0.0440153368f},
-std::array<float,2>{0.85346359f, 0.717446864f},
-std::array<float,2>{0.665804386f, 0.402113676f},
-std::array<float,2>{0.303868741f, 0.910703957f},
-std::array<float,2>{0.423773378f, 0.277250707f},
-std::array<float,2>{0.547820747f, 0.86758399f},
-std::array<float,2>{0.98697716f, 0.184050262f},
-std::array<float,2>{0.192937806f, 0.537381828f},
-std::array<float,2>{0.0744580254f, 0.312668443f},
-std::array<float,2>{0.775199234f, 0.787602901f},
-std::array<float,2>{0.688880742f, 0.212822154f},
-std::array<float,2>{0.330509067f, 0.619241774f},
-std::array<float,2>{0.482313097f, 0.0684455335f},
-std::array<float,2>{0.611861885f, 0.640272141f},
-std::array<float,2>{0.897625089f, 0.451682776f},
-std::array<float,2>{0.136205137f, 0.972174466f},
-std::array<float,2>{0.228803903f, 0.138954267f},
-std::array<float,2>{0.963467121f, 0.501615524f},
-std::array<float,2>{0.509944201f, 0.309583247f},
-std::array<float,2>{0.389078319f, 0.835247338f},
-std::array<float,2>{0.259565115f, 0.430826843f},
-std::array<float,2>{0.649224877f, 0.900215864f},
-std::array<float,2>{0.823970377f, 0.00961737242f},
-std::array<float,2>{0.056781929f, 0.727210641f},
-std::array<float,2>{0.0400178768f, 0.382422566f},
-std::array<float,2>{0.835822821f, 0.935505509f},
-std::array<float,2>{0.632705986f, 0.0543361492f},
-std::array<float,2>{0.276368886f, 0.700918734f},
-std::array<float,2>{0.395861357f, 0.165527016f},
-std::array<float,2>{0.521643639f, 0.547393501f},
-std::array<float,2>{0.944392622f, 0.254192144f},
-std::array<float,2>{0.249125883f, 0.856319547f},
-std::array<float,2>{0.143884689f, 0.0967221931f},
-std::array<float,2>{0.887917638f, 0.667745948f},
-std::array<float,2>{0.600998819f, 0.494898409f},
-std::array<float,2>{0.498522699f, 0.950335979f},
-std::array<float,2>{0.327674806f, 0.354092896f},
-std::array<float,2>{0.71133846f, 0.754612923f},
-std::array<float,2>{0.764912426f, 0.246795058f},
-std::array<float,2>{0.0842436701f, 0.563977301f},
-std::array<float,2>{0.207219586f, 0.282637298f},
-std::array<float,2>{0.970604718f, 0.823373735f},
-std::array<float,2>{0.534711003f, 0.14496614f},
-std::array<float,2>{0.41255632f, 0.520825148f},
-std::array<float,2>{0.291528165f, 0.0178297888f},
-std::array<float,2>{0.677930117f, 0.738716781f},
-std::array<float,2>{0.869271517f, 0.415906519f},
-std::array<float,2>{0.0100080986f, 0.881141245f},
-std::array<float,2>{0.0940530822f, 0.202885866f},
-std::array<float,2>{0.787961662f, 0.603606999f},
-std::array<float,2>{0.733090162f, 0.335802048f},
-std::array<float,2>{0.374529868f, 0.797292709f},
-std::array<float,2>{0.460443497f, 0.456036299f},
-std::array<float,2>{0.587560236f, 0.998455107f},
-std::array<float,2>{0.92330879f, 0.0882012323f},
-std::array<float,2>{0.176606014f, 0.653131068f},
-std::array<float,2>{0.182405561f, 0.434335947f},
-std::array<float,2>{0.931187749f, 0.903080583f},
-std::array<float,2>{0.583703339f, 0.0124306809f},
-std::array<float,2>{0.463665098f, 0.734040976f},
-std::array<float,2>{0.359866321f, 0.134658471f},
-std::array<float,2>{0.721637011f, 0.507713377f},
-std::array<float,2>{0.791103959f, 0.306024164f},
-std::array<float,2>{0.10237547f, 0.832021654f},
-std::array<float,2>{0.00522446772f, 0.0649219304f},
-std::array<float,2>{0.8640306f, 0.633499205f},
-std::array<float,2>{0.680172265f, 0.445740551f},
-std::array<float,2>{0.286386043f, 0.976184964f},
-std::array<float,2>{0.417762339f, 0.31869778f},
-std::array<float,2>{0.545620561f, 0.783905268f},
-std::array<float,2>{0.982125521f, 0.216578603f},
-std::array<float,2>{0.212814689f, 0.621975839f},
-std::array<float,2>{0.0904753357f, 0.278392255f},
-std::array<float,2>{0.753081679f, 0.872713804f},
-std::array<float,2>{0.705470681f, 0.181431755f},
-std::array<float,2>{0.315782338f, 0.534429789f},
-std::array<float,2>{0.485426217f, 0.0395472944f},
-std::array<float,2>{0.608920753f, 0.714570284f},
-std::array<float,2>{0.88150996f, 0.403177887f},
-std::array<float,2>{0.152992055f, 0.909353971f},
-std::array<float,2>{0.239773721f, 0.229255483f},
-std::array<float,2>{0.945385039f, 0.583408654f},
-std::array<float,2>{0.524638057f, 0.372745693f},
-std::array<float,2>{0.405581743f, 0.768684447f},
-std::array<float,2>{0.266482562f, 0.470799476f},
-std::array<float,2>{0.634839296f, 0.965556622f},
-std::array<float,2>{0.840185344f, 0.114922151f},
-std::array<float,2>{0.034163218f, 0.678095281f},
-std::array<float,2>{0.0525572076f, 0.460337847f},
-std::array<float,2>{0.81780082f, 0.99257648f},
-std::array<float,2>{0.640810668f, 0.0904724449f},
-std::array<float,2>{0.256605625f, 0.650687397f},
-std::array<float,2>{0.375236958f, 0.19679372f},
-std::array<float,2>{0.50608319f, 0.606929004f},
-std::array<float,2>{0.953491449f, 0.330787688f},
-std::array<float,2>{0.225227386f, 0.801279485f},
-std::array<float,2>{0.127511561f, 0.0197846554f},
-std::array<float,2>{0.904216528f, 0.735040963f},
-std::array<float,2>{0.619251847f, 0.420947582f},
-std::array<float,2>{0.47246331f, 0.876336753f},
-std::array<float,2>{0.33998391f, 0.285613239f},
-std::array<float,2>{0.699283898f, 0.827247202f},
-std::array<float,2>{0.772568166f, 0.143464908f},
-std::array<float,2>{0.0650573f, 0.518844187f},
-std::array<float,2>{0.198701888f, 0.359143376f},
-std::array<float,2>{0.997760713f, 0.750025988f},
-std::array<float,2>{0.557773173f, 0.242742196f},
-std::array<float,2>{0.43448624f, 0.566797614f},
-std::array<float,2>{0.307502687f, 0.0994053856f},
-std::array<float,2>{0.662646532f, 0.670715213f},
-std::array<float,2>{0.847487271f, 0.49855417f},
-std::array<float,2>{0.0262930095f, 0.948121727f},
-std::array<float,2>{0.124717772f, 0.168605164f},
-std::array<float,2>{0.807563841f, 0.551800549f},
-std::array<float,2>{0.735173285f, 0.253187507f},
-std::array<float,2>{0.350704014f, 0.854606986f},
-std::array<float,2>{0.448793054f, 0.378044039f},
-std::array<float,2>{0.567480087f, 0.931546509f},
-std::array<float,2>{0.916296065f, 0.0492324233f},
-std::array<float,2>{0.160243407f, 0.698557794f},
-std::array<float,2>{0.232605934f, 0.491670072f},
-std::array<float,2>{0.965286493f, 0.938067853f},
-std::array<float,2>{0.514085472f, 0.105384998f},
-std::array<float,2>{0.385384321f, 0.658044219f},
-std::array<float,2>{0.262024909f, 0.235307351f},
-std::array<float,2>{0.655706942f, 0.575187266f},
-std::array<float,2>{0.824613154f, 0.346037f},
-std::array<float,2>{0.0623181537f, 0.758567452f},
-std::array<float,2>{0.0714931637f, 0.0616671965f},
-std::array<float,2>{0.77805692f, 0.689366817f},
-std::array<float,2>{0.692550421f, 0.386946917f},
-std::array<float,2>{0.333763957f, 0.927719772f},
-std::array<float,2>{0.477788419f, 0.264992595f},
-std::array<float,2>{0.616915584f, 0.847111046f},
-std::array<float,2>{0.893458724f, 0.161042869f},
-std::array<float,2>{0.137912348f, 0.557804406f},
-std::array<float,2>{0.0169427823f, 0.343212903f},
-std::array<float,2>{0.857654095f, 0.809009254f},
-std::array<float,2>{0.670349181f, 0.192736834f},
-std::array<float,2>{0.300731361f, 0.597162127f},
-std::array<float,2>{0.429441303f, 0.0810685903f},
-std::array<float,2>{0.551901698f, 0.643181622f},
-std::array<float,2>{0.991142035f, 0.466789454f},
-std::array<float,2>{0.187790096f, 0.98481071f},
-std::array<float,2>{0.167852253f, 0.14860177f},
-std::array<float,2>{0.913068652f, 0.528136373f},
-std::array<float,2>{0.572770238f, 0.289467454f},
-std::array<float,2>{0.438097984f, 0.818642318f},
-std::array<float,2>{0.354239672f, 0.407024473f},
-std::array<float,2>{0.743312299f, 0.889491379f},
-std::array<float,2>{0.802303612f, 0.025454117f},
-std::array<float,2>{0.115153536f, 0.749466717f},
-std::array<float,2>{0.0978237912f, 0.398402959f},
-std::array<float,2>{0.781677306f, 0.92066586f},
-std::array<float,2>{0.729708552f, 0.0324422605f},
-std::array<float,2>{0.370658219f, 0.706460416f},
-std::array<float,2>{0.453208417f, 0.175130934f},
-std::array<float,2>{0.590998828f, 0.544811904f},
-std::array<float,2>{0.928490162f, 0.266933024f},
-std::array<float,2>{0.1752446f, 0.865229189f},
-std::array<float,2>{0.20655258f, 0.118071921f},
-std::array<float,2>{0.973771691f, 0.685180843f},
-std::array<float,2>{0.535381496f, 0.480918646f},
-std::array<float,2>{0.409757346f, 0.954931319f},
-std::array<float,2>{0.295831263f, 0.364403486f},
-std::array<float,2>{0.672302008f, 0.779812396f},
-std::array<float,2>{0.874227881f, 0.220051736f},
-std::array<float,2>{0.0119451527f, 0.590143502f},
-std::array<float,2>{0.146435037f, 0.29919365f},
-std::array<float,2>{0.885773718f, 0.836261332f},
-std::array<float,2>{0.596809745f, 0.127075389f},
-std::array<float,2>{0.49497509f, 0.512365401f},
-std::array<float,2>{0.323449761f, 0.00273958058f},
-std::array<float,2>{0.71795541f, 0.723280489f},
-std::array<float,2>{0.760899901f, 0.427877486f},
-std::array<float,2>{0.0796344355f, 0.897855997f},
-std::array<float,2>{0.0430162475f, 0.207852587f},
-std::array<float,2>{0.831330836f, 0.615321219f},
-std::array<float,2>{0.625779569f, 0.322612345f},
-std::array<float,2>{0.277455777f, 0.795092106f},
-std::array<float,2>{0.390879065f, 0.439226687f},
-std::array<float,2>{0.51586169f, 0.981761575f},
-std::array<float,2>{0.941346109f, 0.0706897154f},
-std::array<float,2>{0.244511917f, 0.627259076f},
-std::array<float,2>{0.216255456f, 0.383799464f},
-std::array<float,2>{0.980071723f, 0.921987295f},
-std::array<float,2>{0.539648473f, 0.0555794276f},
-std::array<float,2>{0.419287443f, 0.691930532f},
-std::array<float,2>{0.283357233f, 0.156989872f},
-std::array<float,2>{0.686384499f, 0.558726072f},
-std::array<float,2>{0.860123932f, 0.258881837f},
-std::array<float,2>{0.000873790588f, 0.848456025f},
-std::array<float,2>{0.107959583f, 0.107840732f},
-std::array<float,2>{0.795351028f, 0.662179351f},
-std::array<float,2>{0.725764215f, 0.485896915f},
-std::array<float,2>{0.364456862f, 0.942056656f},
-std::array<float,2>{0.467061758f, 0.351128459f},
-std::array<float,2>{0.579544485f, 0.763154626f},
-std::array<float,2>{0.935004234f, 0.241342291f},
-std::array<float,2>{0.184890747f, 0.573691547f},
-std::array<float,2>{0.0361031108f, 0.295445144f},
-std::array<float,2>{0.836861968f, 0.814301491f},
-std::array<float,2>{0.638639271f, 0.155737996f},
-std::array<float,2>{0.270741671f, 0.523445606f},
-std::array<float,2>{0.401863635f, 0.02819895f},
-std::array<float,2>{0.530895233f, 0.744903922f},
-std::array<float,2>{0.952409506f, 0.410576254f},
-std::array<float,2>{0.23532632f, 0.883394361f},
-std::array<float,2>{0.150809094f, 0.189177647f},
-std::array<float,2>{0.877297878f, 0.599985063f},
-std::array<float,2>{0.603847623f, 0.336720258f},
-std::array<float,2>{0.490633786f, 0.806453466f},
-std::array<float,2>{0.32017684f, 0.461964488f},
-std::array<float,2>{0.710714161f, 0.991576433f},
-std::array<float,2>{0.754872322f, 0.0826782435f},
-std::array<float,2>{0.0888650268f, 0.645473182f},
-std::array<float,2>{0.0684408993f, 0.477521062f},
-std::array<float,2>{0.766886711f, 0.959483981f},
-std::array<float,2>{0.698444307f, 0.122878313f},
-std::array<float,2>{0.33675012f, 0.682574749f},
-std::array<float,2>{0.474582195f, 0.224070549f},
-std::array<float,2>{0.621927738f, 0.586386442f},
-std::array<float,2>{0.899416506f, 0.36277616f},
-std::array<float,2>{0.130175412f, 0.77477169f},
-std::array<float,2>{0.222445965f, 0.0362849571f},
-std::array<float,2>{0.957684219f, 0.709395826f},
-std::array<float,2>{0.502583742f, 0.39325887f},
-std::array<float,2>{0.382320583f, 0.916725159f},
-std::array<float,2>{0.251636356f, 0.269992828f},
-std::array<float,2>{0.645623326f, 0.860791981f},
-std::array<float,2>{0.812846899f, 0.178317532f},
-std::array<float,2>{0.0479049459f, 0.541969597f},
-std::array<float,2>{0.156808689f, 0.324396104f},
-std::array<float,2>{0.919795454f, 0.791123033f},
-std::array<float,2>{0.563170493f, 0.203622535f},
-std::array<float,2>{0.45208776f, 0.609656692f},
-std::array<float,2>{0.344545215f, 0.0753877759f},
-std::array<float,2>{0.741033196f, 0.6294173f},
-std::array<float,2>{0.809232652f, 0.443619221f},
-std::array<float,2>{0.11735598f, 0.979930878f},
-std::array<float,2>{0.0294638071f, 0.129248649f},
-std::array<float,2>{0.85123843f, 0.511361182f},
-std::array<float,2>{0.656453848f, 0.302369773f},
-std::array<float,2>{0.310709298f, 0.841804028f},
-std::array<float,2>{0.430089802f, 0.424271941f},
-std::array<float,2>{0.55888921f, 0.890892029f},
-std::array<float,2>{0.995463133f, 0.00679119723f},
-std::array<float,2>{0.20122692f, 0.719036043f},
-std::array<float,2>{0.133470401f, 0.450551927f},
-std::array<float,2>{0.895912528f, 0.969534516f},
-std::array<float,2>{0.610005617f, 0.0671756938f},
-std::array<float,2>{0.482880622f, 0.637737274f},
-std::array<float,2>{0.329997122f, 0.213306397f},
-std::array<float,2>{0.690370321f, 0.618576527f},
-std::array<float,2>{0.776391685f, 0.315767258f},
-std::array<float,2>{0.0763897598f, 0.786419451f},
-std::array<float,2>{0.0558515452f, 0.0102378009f},
-std::array<float,2>{0.820334136f, 0.729943752f},
-std::array<float,2>{0.651205063f, 0.432097852f},
-std::array<float,2>{0.26043722f, 0.900694132f},
-std::array<float,2>{0.387831748f, 0.311632395f},
-std::array<float,2>{0.508544981f, 0.833864093f},
-std::array<float,2>{0.961965561f, 0.136850506f},
-std::array<float,2>{0.227396592f, 0.503720462f},
-std::array<float,2>{0.109935962f, 0.369870543f},
-std::array<float,2>{0.799143195f, 0.772433519f},
-std::array<float,2>{0.749189317f, 0.231799111f},
-std::array<float,2>{0.356854111f, 0.579950511f},
-std::array<float,2>{0.444007874f, 0.112101518f},
-std::array<float,2>{0.574551105f, 0.674478769f},
-std::array<float,2>{0.909625947f, 0.473381579f},
-std::array<float,2>{0.16949898f, 0.96170193f},
-std::array<float,2>{0.194477931f, 0.186609656f},
-std::array<float,2>{0.984415948f, 0.535159111f},
-std::array<float,2>{0.550459683f, 0.273492992f},
-std::array<float,2>{0.424002707f, 0.869510829f},
-std::array<float,2>{0.301984221f, 0.399610698f},
-std::array<float,2>{0.667405665f, 0.912730396f},
-std::array<float,2>{0.854186058f, 0.0464938134f},
-std::array<float,2>{0.0204363633f, 0.716779172f},
-std::array<float,2>{0.00832133554f, 0.417640656f},
-std::array<float,2>{0.867770433f, 0.879703879f},
-std::array<float,2>{0.676370144f, 0.0159153733f},
-std::array<float,2>{0.289537847f, 0.740374923f},
-std::array<float,2>{0.411111504f, 0.147851244f},
-std::array<float,2>{0.532515228f, 0.522835076f},
-std::array<float,2>{0.972353995f, 0.283675879f},
-std::array<float,2>{0.209542781f, 0.821640134f},
-std::array<float,2>{0.178288504f, 0.0874746665f},
-std::array<float,2>{0.925066411f, 0.655558825f},
-std::array<float,2>{0.589257538f, 0.454809278f},
-std::array<float,2>{0.457094163f, 0.997412026f},
-std::array<float,2>{0.371574372f, 0.332513839f},
-std::array<float,2>{0.73227036f, 0.79962033f},
-std::array<float,2>{0.78682375f, 0.199631587f},
-std::array<float,2>{0.0975484326f, 0.603423953f},
-std::array<float,2>{0.246724248f, 0.256711334f},
-std::array<float,2>{0.941993594f, 0.858264804f},
-std::array<float,2>{0.520404577f, 0.166432038f},
-std::array<float,2>{0.397809178f, 0.549490154f},
-std::array<float,2>{0.275349706f, 0.0517894439f},
-std::array<float,2>{0.628913045f, 0.702912748f},
-std::array<float,2>{0.833743155f, 0.379079401f},
-std::array<float,2>{0.0415195934f, 0.937157154f},
-std::array<float,2>{0.0835468248f, 0.249572784f},
-std::array<float,2>{0.762590051f, 0.56467694f},
-std::array<float,2>{0.714793324f, 0.351744324f},
-std::array<float,2>{0.325279921f, 0.757545471f},
-std::array<float,2>{0.496390283f, 0.493562609f},
-std::array<float,2>{0.598280966f, 0.952976227f},
-std::array<float,2>{0.889051437f, 0.0950888321f},
-std::array<float,2>{0.141387641f, 0.665911376f},
-std::array<float,2>{0.125261128f, 0.419960976f},
-std::array<float,2>{0.905350029f, 0.875204206f},
-std::array<float,2>{0.61837095f, 0.0205582436f},
-std::array<float,2>{0.470271051f, 0.735414624f},
-std::array<float,2>{0.342805296f, 0.144120172f},
-std::array<float,2>{0.702601254f, 0.517744422f},
-std::array<float,2>{0.769883513f, 0.286325127f},
-std::array<float,2>{0.0632587373f, 0.826608002f},
-std::array<float,2>{0.0530939028f, 0.0912965536f},
-std::array<float,2>{0.818391085f, 0.652034581f},
-std::array<float,2>{0.64418453f, 0.459855109f},
-std::array<float,2>{0.255714506f, 0.993701458f},
-std::array<float,2>{0.37740162f, 0.331811488f},
-std::array<float,2>{0.505494773f, 0.802443862f},
-std::array<float,2>{0.956446946f, 0.195954904f},
-std::array<float,2>{0.223553851f, 0.605861127f},
-std::array<float,2>{0.121856898f, 0.252563268f},
-std::array<float,2>{0.806530595f, 0.854001582f},
-std::array<float,2>{0.737549603f, 0.169520959f},
-std::array<float,2>{0.3495166f, 0.551267087f},
-std::array<float,2>{0.445835173f, 0.0500007123f},
-std::array<float,2>{0.569390774f, 0.69744426f},
-std::array<float,2>{0.915046275f, 0.377409369f},
-std::array<float,2>{0.162281901f, 0.930013835f},
-std::array<float,2>{0.195334315f, 0.2439906f},
-std::array<float,2>{0.999809742f, 0.567394853f},
-std::array<float,2>{0.554727316f, 0.358022898f},
-std::array<float,2>{0.436556488f, 0.751058459f},
-std::array<float,2>{0.305118591f, 0.499290377f},
-std::array<float,2>{0.660318911f, 0.948412776f},
-std::array<float,2>{0.844817996f, 0.0982404724f},
-std::array<float,2>{0.0247477125f, 0.67138344f},
-std::array<float,2>{0.00615823967f, 0.446704924f},
-std::array<float,2>{0.865997732f, 0.975135326f},
-std::array<float,2>{0.682283044f, 0.0655959547f},
-std::array<float,2>{0.287712872f, 0.633836567f},
-std::array<float,2>{0.415596575f, 0.215048879f},
-std::array<float,2>{0.544873059f, 0.62292701f},
-std::array<float,2>{0.983405352f, 0.319759607f},
-std::array<float,2>{0.214626208f, 0.784205377f},
-std::array<float,2>{0.180889428f, 0.0133499382f},
-std::array<float,2>{0.932199538f, 0.732976437f},
-std::array<float,2>{0.584201515f, 0.435038149f},
-std::array<float,2>{0.461143017f, 0.903840661f},
-std::array<float,2>{0.36274004f, 0.30537197f},
-std::array<float,2>{0.719480157f, 0.830344498f},
-std::array<float,2>{0.78956145f, 0.133190766f},
-std::array<float,2>{0.104136676f, 0.50660336f},
-std::array<float,2>{0.241129309f, 0.371938139f},
-std::array<float,2>{0.948897302f, 0.767941117f},
-std::array<float,2>{0.526571929f, 0.229901671f},
-std::array<float,2>{0.403144091f, 0.582655668f},
-std::array<float,2>{0.269180715f, 0.113690823f},
-std::array<float,2>{0.634125888f, 0.679045677f},
-std::array<float,2>{0.842058599f, 0.472593963f},
-std::array<float,2>{0.0327556729f, 0.966459394f},
-std::array<float,2>{0.09184926f, 0.179845154f},
-std::array<float,2>{0.750020504f, 0.534048676f},
-std::array<float,2>{0.704894304f, 0.277487844f},
-std::array<float,2>{0.312960863f, 0.871926188f},
-std::array<float,2>{0.48818621f, 0.403980047f},
-std::array<float,2>{0.607011557f, 0.908842206f},
-std::array<float,2>{0.879731476f, 0.0406967849f},
-std::array<float,2>{0.155032381f, 0.713154733f},
-std::array<float,2>{0.204676285f, 0.481544226f},
-std::array<float,2>{0.975651622f, 0.953876138f},
-std::array<float,2>{0.537791014f, 0.118648566f},
-std::array<float,2>{0.4079445f, 0.684020877f},
-std::array<float,2>{0.293774754f, 0.219084352f},
-std::array<float,2>{0.674390197f, 0.590962172f},
-std::array<float,2>{0.872326314f, 0.363502532f},
-std::array<float,2>{0.0152065689f, 0.780850291f},
-std::array<float,2>{0.100012906f, 0.0314844921f},
-std::array<float,2>{0.783637583f, 0.705979347f},
-std::array<float,2>{0.72675544f, 0.396869987f},
-std::array<float,2>{0.368742436f, 0.920902073f},
-std::array<float,2>{0.455560863f, 0.265868962f},
-std::array<float,2>{0.592750371f, 0.863777161f},
-std::array<float,2>{0.926164031f, 0.174737006f},
-std::array<float,2>{0.173567414f, 0.543334723f},
-std::array<float,2>{0.0455279425f, 0.32328248f},
-std::array<float,2>{0.82845968f, 0.79672271f},
-std::array<float,2>{0.627724826f, 0.208216369f},
-std::array<float,2>{0.279577911f, 0.616233408f},
-std::array<float,2>{0.3939206f, 0.0721713454f},
-std::array<float,2>{0.517649293f, 0.6285761f},
-std::array<float,2>{0.938445449f, 0.438125104f},
-std::array<float,2>{0.243316054f, 0.981292903f},
-std::array<float,2>{0.146788821f, 0.128568932f},
-std::array<float,2>{0.883872032f, 0.512890399f},
-std::array<float,2>{0.593948305f, 0.300043941f},
-std::array<float,2>{0.494057566f, 0.837463796f},
-std::array<float,2>{0.320870489f, 0.429010004f},
-std::array<float,2>{0.714868665f, 0.896640062f},
-std::array<float,2>{0.759232879f, 0.00373658817f},
-std::array<float,2>{0.081386365f, 0.724342525f},
-std::array<float,2>{0.0729080588f, 0.387835532f},
-std::array<float,2>{0.781025887f, 0.925868273f},
-std::array<float,2>{0.694572926f, 0.0613609254f},
-std::array<float,2>{0.334007293f, 0.688197136f},
-std::array<float,2>{0.479924679f, 0.162083492f},
-std::array<float,2>{0.613402188f, 0.557274699f},
-std::array<float,2>{0.890837371f, 0.264257193f},
-std::array<float,2>{0.140005469f, 0.846174657f},
-std::array<float,2>{0.231295586f, 0.10394863f},
-std::array<float,2>{0.96827209f, 0.656882465f},
-std::array<float,2>{0.512162447f, 0.490611583f},
-std::array<float,2>{0.384040415f, 0.938953161f},
-std::array<float,2>{0.264055997f, 0.347269058f},
-std::array<float,2>{0.653183341f, 0.759466171f},
-std::array<float,2>{0.828044355f, 0.235453904f},
-std::array<float,2>{0.0592195392f, 0.576068938f},
-std::array<float,2>{0.165295333f, 0.290567011f},
-std::array<float,2>{0.911574602f, 0.819557607f},
-std::array<float,2>{0.572257519f, 0.149923548f},
-std::array<float,2>{0.440952659f, 0.529061496f},
-std::array<float,2>{0.351902425f, 0.0265159644f},
-std::array<float,2>{0.744283259f, 0.748666048f},
-std::array<float,2>{0.803809464f, 0.407524407f},
-std::array<float,2>{0.115385465f, 0.890329003f},
-std::array<float,2>{0.0181373581f, 0.191870242f},
-std::array<float,2>{0.857345939f, 0.596295357f},
-std::array<float,2>{0.669624329f, 0.34261772f},
-std::array<float,2>{0.296966404f, 0.809652925f},
-std::array<float,2>{0.427578539f, 0.465395033f},
-std::array<float,2>{0.552947342f, 0.985521436f},
-std::array<float,2>{0.988402128f, 0.080579333f},
-std::array<float,2>{0.190919712f, 0.643846393f},
-std::array<float,2>{0.21940285f, 0.393994957f},
-std::array<float,2>{0.960448742f, 0.917426169f},
-std::array<float,2>{0.501779199f, 0.0351617672f},
-std::array<float,2>{0.380434424f, 0.710370779f},
-std::array<float,2>{0.252383143f, 0.178745657f},
-std::array<float,2>{0.64767158f, 0.542493761f},
-std::array<float,2>{0.814538598f, 0.27145955f},
-std::array<float,2>{0.0489628762f, 0.859643877f},
-std::array<float,2>{0.0679006055f, 0.121692367f},
-std::array<float,2>{0.768344104f, 0.682685137f},
-std::array<float,2>{0.695740104f, 0.477965564f},
-std::array<float,2>{0.339778423f, 0.960904002f},
-std::array<float,2>{0.474970788f, 0.361813277f},
-std::array<float,2>{0.623777926f, 0.773530722f},
-std::array<float,2>{0.901402593f, 0.222711429f},
-std::array<float,2>{0.13138862f, 0.58764106f},
-std::array<float,2>{0.0289617889f, 0.301114351f},
-std::array<float,2>{0.848408937f, 0.84349364f},
-std::array<float,2>{0.6600582f, 0.130681098f},
-std::array<float,2>{0.309872925f, 0.510424912f},
-std::array<float,2>{0.433183581f, 0.00758662773f},
-std::array<float,2>{0.561337471f, 0.720445752f},
-std::array<float,2>{0.993715167f, 0.425531894f},
-std::array<float,2>{0.200863481f, 0.891708791f},
-std::array<float,2>{0.159203947f, 0.204935342f},
-std::array<float,2>{0.920779526f, 0.611300468f},
-std::array<float,2>{0.564553022f, 0.32564649f},
-std::array<float,2>{0.450994492f, 0.792429805f},
-std::array<float,2>{0.3473607f, 0.444810033f},
-std::array<float,2>{0.738693237f, 0.978916764f},
-std::array<float,2>{0.812069178f, 0.0748322383f},
-std::array<float,2>{0.120427437f, 0.630180717f},
-std::array<float,2>{0.107077055f, 0.484379351f},
-std::array<float,2>{0.794448674f, 0.942541003f},
-std::array<float,2>{0.723971009f, 0.108984828f},
-std::array<float,2>{0.367037505f, 0.663428485f},
-std::array<float,2>{0.465732038f, 0.241207495f},
-std::array<float,2>{0.581877828f, 0.573130906f},
-std::array<float,2>{0.936733723f, 0.349895865f},
-std::array<float,2>{0.1856042f, 0.76174742f},
-std::array<float,2>{0.216924697f, 0.0564436018f},
-std::array<float,2>{0.978432953f, 0.692393482f},
-std::array<float,2>{0.542206645f, 0.383227766f},
-std::array<float,2>{0.420108587f, 0.923746765f},
-std::array<float,2>{0.281271785f, 0.258436888f},
-std::array<float,2>{0.684792399f, 0.848767817f},
-std::array<float,2>{0.86301142f, 0.157799482f},
-std::array<float,2>{0.00236085942f, 0.560179889f},
-std::array<float,2>{0.149404213f, 0.3378793f},
-std::array<float,2>{0.875660837f, 0.804899931f},
-std::array<float,2>{0.601899505f, 0.187940896f},
-std::array<float,2>{0.490186483f, 0.601347983f},
-std::array<float,2>{0.316454083f, 0.0839610025f},
-std::array<float,2>{0.707360983f, 0.645861268f},
-std::array<float,2>{0.757107198f, 0.461428612f},
-std::array<float,2>{0.0877220333f, 0.991035998f},
-std::array<float,2>{0.0390138775f, 0.154867038f},
-std::array<float,2>{0.839647114f, 0.524989545f},
-std::array<float,2>{0.638834953f, 0.29651171f},
-std::array<float,2>{0.272277236f, 0.813034952f},
-std::array<float,2>{0.400318533f, 0.411359996f},
-std::array<float,2>{0.528136551f, 0.884404659f},
-std::array<float,2>{0.950375319f, 0.0283281468f},
-std::array<float,2>{0.236394465f, 0.745956719f},
-std::array<float,2>{0.176782504f, 0.453350455f},
-std::array<float,2>{0.922218382f, 0.996547401f},
-std::array<float,2>{0.586279869f, 0.0863513052f},
-std::array<float,2>{0.459192067f, 0.654895782f},
-std::array<float,2>{0.37306267f, 0.200305879f},
-std::array<float,2>{0.733933866f, 0.602353692f},
-std::array<float,2>{0.788345814f, 0.333397895f},
-std::array<float,2>{0.0947455019f, 0.799914837f},
-std::array<float,2>{0.0108718751f, 0.0175556075f},
-std::array<float,2>{0.871069252f, 0.741401315f},
-std::array<float,2>{0.678734779f, 0.416927427f},
-std::array<float,2>{0.292785138f, 0.880390525f},
-std::array<float,2>{0.413605154f, 0.285112858f},
-std::array<float,2>{0.533462882f, 0.820422411f},
-std::array<float,2>{0.969137192f, 0.146647304f},
-std::array<float,2>{0.20807153f, 0.521778882f},
-std::array<float,2>{0.0857576281f, 0.352979928f},
-std::array<float,2>{0.76452142f, 0.756287634f},
-std::array<float,2>{0.712201178f, 0.248610169f},
-std::array<float,2>{0.327104568f, 0.565850914f},
-std::array<float,2>{0.499310762f, 0.0944609195f},
-std::array<float,2>{0.600245535f, 0.664483845f},
-std::array<float,2>{0.887406766f, 0.493014991f},
-std::array<float,2>{0.142962649f, 0.951538622f},
-std::array<float,2>{0.248699829f, 0.167798296f},
-std::array<float,2>{0.944169283f, 0.55041045f},
-std::array<float,2>{0.522872567f, 0.256968111f},
-std::array<float,2>{0.394949436f, 0.858445108f},
-std::array<float,2>{0.275839776f, 0.380387127f},
-std::array<float,2>{0.631667912f, 0.936380863f},
-std::array<float,2>{0.834240317f, 0.0508523248f},
-std::array<float,2>{0.0406384766f, 0.702014029f},
-std::array<float,2>{0.0579724871f, 0.432792217f},
-std::array<float,2>{0.82264477f, 0.902149081f},
-std::array<float,2>{0.649972975f, 0.0108637596f},
-std::array<float,2>{0.258291423f, 0.729436636f},
-std::array<float,2>{0.390327811f, 0.138493672f},
-std::array<float,2>{0.510955811f, 0.50227952f},
-std::array<float,2>{0.964813292f, 0.311220825f},
-std::array<float,2>{0.230055407f, 0.832048357f},
-std::array<float,2>{0.134963781f, 0.0681887493f},
-std::array<float,2>{0.897075236f, 0.636839092f},
-std::array<float,2>{0.612897873f, 0.449300647f},
-std::array<float,2>{0.480493158f, 0.970025122f},
-std::array<float,2>{0.33194527f, 0.314665198f},
-std::array<float,2>{0.688072324f, 0.785684407f},
-std::array<float,2>{0.773783684f, 0.214113951f},
-std::array<float,2>{0.0754068345f, 0.617842853f},
-std::array<float,2>{0.191424921f, 0.274969965f},
-std::array<float,2>{0.988011539f, 0.870145321f},
-std::array<float,2>{0.54850024f, 0.186215281f},
-std::array<float,2>{0.422260493f, 0.536294937f},
-std::array<float,2>{0.303055942f, 0.0452581421f},
-std::array<float,2>{0.66432327f, 0.715345562f},
-std::array<float,2>{0.85186708f, 0.399012327f},
-std::array<float,2>{0.0234266035f, 0.913817227f},
-std::array<float,2>{0.11162281f, 0.230643943f},
-std::array<float,2>{0.797277033f, 0.57836324f},
-std::array<float,2>{0.747710466f, 0.370254815f},
-std::array<float,2>{0.358704776f, 0.773150146f},
-std::array<float,2>{0.44250232f, 0.473972708f},
-std::array<float,2>{0.57755661f, 0.962414622f},
-std::array<float,2>{0.90764612f, 0.112721458f},
-std::array<float,2>{0.170819774f, 0.675034106f},
-std::array<float,2>{0.161326528f, 0.375908822f},
-std::array<float,2>{0.917109489f, 0.933430076f},
-std::array<float,2>{0.567312121f, 0.0480025299f},
-std::array<float,2>{0.447623551f, 0.696890056f},
-std::array<float,2>{0.350536764f, 0.170002937f},
-std::array<float,2>{0.735920966f, 0.553648412f},
-std::array<float,2>{0.808155179f, 0.251652211f},
-std::array<float,2>{0.123998851f, 0.852783322f},
-std::array<float,2>{0.0272215921f, 0.100070536f},
-std::array<float,2>{0.846464574f, 0.668528199f},
-std::array<float,2>{0.663920105f, 0.496198386f},
-std::array<float,2>{0.308544338f, 0.945940256f},
-std::array<float,2>{0.435398817f, 0.356403738f},
-std::array<float,2>{0.557366192f, 0.75299269f},
-std::array<float,2>{0.996791065f, 0.244220793f},
-std::array<float,2>{0.198178783f, 0.569435596f},
-std::array<float,2>{0.065909721f, 0.287288785f},
-std::array<float,2>{0.772199512f, 0.825834751f},
-std::array<float,2>{0.700933874f, 0.142141521f},
-std::array<float,2>{0.341237098f, 0.517555535f},
-std::array<float,2>{0.471554607f, 0.0222818498f},
-std::array<float,2>{0.620221317f, 0.737275958f},
-std::array<float,2>{0.903101027f, 0.419855654f},
-std::array<float,2>{0.127980843f, 0.878888071f},
-std::array<float,2>{0.225828454f, 0.198172346f},
-std::array<float,2>{0.954751372f, 0.608427167f},
-std::array<float,2>{0.507021666f, 0.329776615f},
-std::array<float,2>{0.376476973f, 0.803924441f},
-std::array<float,2>{0.257289022f, 0.457921892f},
-std::array<float,2>{0.64177537f, 0.995447099f},
-std::array<float,2>{0.816648841f, 0.0923641622f},
-std::array<float,2>{0.0513780862f, 0.649502456f},
-std::array<float,2>{0.0346950479f, 0.469977021f},
-std::array<float,2>{0.841391921f, 0.967311561f},
-std::array<float,2>{0.63634795f, 0.116189443f},
-std::array<float,2>{0.266912133f, 0.67771554f},
-std::array<float,2>{0.40435493f, 0.226924896f},
-std::array<float,2>{0.523671985f, 0.584253728f},
-std::array<float,2>{0.94718349f, 0.373380899f},
-std::array<float,2>{0.238572717f, 0.76584214f},
-std::array<float,2>{0.15420115f, 0.0412004851f},
-std::array<float,2>{0.882094085f, 0.711604774f},
-std::array<float,2>{0.608193159f, 0.404706001f},
-std::array<float,2>{0.485304147f, 0.906613708f},
-std::array<float,2>{0.315025657f, 0.280223727f},
-std::array<float,2>{0.706618011f, 0.874818027f},
-std::array<float,2>{0.752333879f, 0.182241976f},
-std::array<float,2>{0.0914238915f, 0.532424867f},
-std::array<float,2>{0.211789772f, 0.317590058f},
-std::array<float,2>{0.981376112f, 0.782868028f},
-std::array<float,2>{0.546663761f, 0.218510538f},
-std::array<float,2>{0.416790307f, 0.623598933f},
-std::array<float,2>{0.286085606f, 0.063399367f},
-std::array<float,2>{0.681209207f, 0.635691047f},
-std::array<float,2>{0.865094423f, 0.447612852f},
-std::array<float,2>{0.00480477512f, 0.97301501f},
-std::array<float,2>{0.102561526f, 0.135585204f},
-std::array<float,2>{0.792344809f, 0.505246401f},
-std::array<float,2>{0.722266912f, 0.308267295f},
-std::array<float,2>{0.360426277f, 0.828225851f},
-std::array<float,2>{0.464033157f, 0.435606003f},
-std::array<float,2>{0.582699239f, 0.90512979f},
-std::array<float,2>{0.929834366f, 0.0139269903f},
-std::array<float,2>{0.18288292f, 0.731549442f},
-std::array<float,2>{0.245183215f, 0.44067353f},
-std::array<float,2>{0.940123856f, 0.98357594f},
-std::array<float,2>{0.517010033f, 0.0731419995f},
-std::array<float,2>{0.391606688f, 0.62553072f},
-std::array<float,2>{0.279213071f, 0.20981878f},
-std::array<float,2>{0.626920342f, 0.613676608f},
-std::array<float,2>{0.830321491f, 0.320445418f},
-std::array<float,2>{0.0444605723f, 0.793715119f},
-std::array<float,2>{0.0789019838f, 0.00112557597f},
-std::array<float,2>{0.760626912f, 0.725269854f},
-std::array<float,2>{0.717409909f, 0.426410437f},
-std::array<float,2>{0.32294175f, 0.89621079f},
-std::array<float,2>{0.495619327f, 0.298734039f},
-std::array<float,2>{0.595829189f, 0.839152038f},
-std::array<float,2>{0.885127962f, 0.125628322f},
-std::array<float,2>{0.14527823f, 0.515016675f},
-std::array<float,2>{0.0130978068f, 0.365903169f},
-std::array<float,2>{0.873441815f, 0.778984129f},
-std::array<float,2>{0.672872007f, 0.221902207f},
-std::array<float,2>{0.296345621f, 0.593096793f},
-std::array<float,2>{0.408733517f, 0.120192684f},
-std::array<float,2>{0.537069261f, 0.68737489f},
-std::array<float,2>{0.972779036f, 0.482433289f},
-std::array<float,2>{0.205750138f, 0.95542866f},
-std::array<float,2>{0.174619213f, 0.17300047f},
-std::array<float,2>{0.929442406f, 0.546246588f},
-std::array<float,2>{0.589884818f, 0.268170595f},
-std::array<float,2>{0.454307735f, 0.866229713f},
-std::array<float,2>{0.369957179f, 0.395942658f},
-std::array<float,2>{0.728702724f, 0.918273807f},
-std::array<float,2>{0.782818496f, 0.0334713906f},
-std::array<float,2>{0.0995510966f, 0.70490247f},
-std::array<float,2>{0.113599241f, 0.408864915f},
-std::array<float,2>{0.800835609f, 0.888358891f},
-std::array<float,2>{0.742292166f, 0.0237117242f},
-std::array<float,2>{0.355165571f, 0.746710718f},
-std::array<float,2>{0.438866645f, 0.152205825f},
-std::array<float,2>{0.574066401f, 0.531242669f},
-std::array<float,2>{0.91403687f, 0.292015791f},
-std::array<float,2>{0.166797519f, 0.816449881f},
-std::array<float,2>{0.189066514f, 0.0797879994f},
-std::array<float,2>{0.992170334f, 0.640923202f},
-std::array<float,2>{0.550845146f, 0.468145192f},
-std::array<float,2>{0.427877784f, 0.987275481f},
-std::array<float,2>{0.299248874f, 0.341671169f},
-std::array<float,2>{0.671800613f, 0.811844826f},
-std::array<float,2>{0.858729422f, 0.19395557f},
-std::array<float,2>{0.0157831628f, 0.59463805f},
-std::array<float,2>{0.136877894f, 0.263400257f},
-std::array<float,2>{0.89423269f, 0.8451491f},
-std::array<float,2>{0.615997434f, 0.163327724f},
-std::array<float,2>{0.477307379f, 0.556564629f},
-std::array<float,2>{0.332557589f, 0.0593075715f},
-std::array<float,2>{0.692336619f, 0.689943731f},
-std::array<float,2>{0.77924186f, 0.389634103f},
-std::array<float,2>{0.0703683496f, 0.929549813f},
-std::array<float,2>{0.0614665933f, 0.236414418f},
-std::array<float,2>{0.825590968f, 0.576983154f},
-std::array<float,2>{0.654972613f, 0.343883395f},
-std::array<float,2>{0.263371944f, 0.760951877f},
-std::array<float,2>{0.386523694f, 0.488489777f},
-std::array<float,2>{0.514690518f, 0.941303968f},
-std::array<float,2>{0.965863824f, 0.103176959f},
-std::array<float,2>{0.234336138f, 0.658207357f},
-std::array<float,2>{0.202299505f, 0.423485905f},
-std::array<float,2>{0.994881332f, 0.8945207f},
-std::array<float,2>{0.559708238f, 0.00562857324f},
-std::array<float,2>{0.431372583f, 0.72257328f},
-std::array<float,2>{0.312461019f, 0.131882921f},
-std::array<float,2>{0.657984853f, 0.50886637f},
-std::array<float,2>{0.849896252f, 0.303191811f},
-std::array<float,2>{0.0307457894f, 0.840796411f},
-std::array<float,2>{0.11882057f, 0.0777149573f},
-std::array<float,2>{0.80980587f, 0.63149178f},
-std::array<float,2>{0.741829693f, 0.441992193f},
-std::array<float,2>{0.344920427f, 0.977791131f},
-std::array<float,2>{0.452459842f, 0.327871263f},
-std::array<float,2>{0.564450026f, 0.789842725f},
-std::array<float,2>{0.918575764f, 0.206528902f},
-std::array<float,2>{0.15756914f, 0.613068283f},
-std::array<float,2>{0.0475482941f, 0.272142351f},
-std::array<float,2>{0.814257562f, 0.862400055f},
-std::array<float,2>{0.645027578f, 0.177464992f},
-std::array<float,2>{0.250806451f, 0.539383054f},
-std::array<float,2>{0.381769568f, 0.0389824696f},
-std::array<float,2>{0.503568888f, 0.708360195f},
-std::array<float,2>{0.958222687f, 0.392086536f},
-std::array<float,2>{0.221204013f, 0.914079189f},
-std::array<float,2>{0.129243225f, 0.224952802f},
-std::array<float,2>{0.898482203f, 0.588927865f},
-std::array<float,2>{0.622617126f, 0.359991908f},
-std::array<float,2>{0.472777963f, 0.77633214f},
-std::array<float,2>{0.337571204f, 0.479591519f},
-std::array<float,2>{0.697524488f, 0.958922088f},
-std::array<float,2>{0.765945196f, 0.124688566f},
-std::array<float,2>{0.0700776801f, 0.680079758f},
-std::array<float,2>{0.0890595466f, 0.463578075f},
-std::array<float,2>{0.755584478f, 0.990142643f},
-std::array<float,2>{0.709826171f, 0.0844996199f},
-std::array<float,2>{0.318605065f, 0.647620976f},
-std::array<float,2>{0.491497666f, 0.190560788f},
-std::array<float,2>{0.605101287f, 0.599242628f},
-std::array<float,2>{0.878208041f, 0.33916086f},
-std::array<float,2>{0.152250856f, 0.806752086f},
-std::array<float,2>{0.236208454f, 0.0307152644f},
-std::array<float,2>{0.952075779f, 0.743483305f},
-std::array<float,2>{0.530099392f, 0.413377404f},
-std::array<float,2>{0.401343375f, 0.886321425f},
-std::array<float,2>{0.270385742f, 0.294613093f},
-std::array<float,2>{0.637398243f, 0.814626634f},
-std::array<float,2>{0.837865472f, 0.153136805f},
-std::array<float,2>{0.0367049687f, 0.525506258f},
-std::array<float,2>{0.183902115f, 0.348617882f},
-std::array<float,2>{0.934277534f, 0.763835371f},
-std::array<float,2>{0.579053462f, 0.238702595f},
-std::array<float,2>{0.468622804f, 0.571159482f},
-std::array<float,2>{0.363876551f, 0.106855534f},
-std::array<float,2>{0.724774182f, 0.660842836f},
-std::array<float,2>{0.796340048f, 0.487014204f},
-std::array<float,2>{0.109247893f, 0.944235265f},
-std::array<float,2>{0.00138229888f, 0.158230931f},
-std::array<float,2>{0.860404491f, 0.561217606f},
-std::array<float,2>{0.687098861f, 0.25982216f},
-std::array<float,2>{0.285050839f, 0.851499081f},
-std::array<float,2>{0.418539554f, 0.386280388f},
-std::array<float,2>{0.540952444f, 0.923962295f},
-std::array<float,2>{0.978741705f, 0.0583503693f},
-std::array<float,2>{0.215297967f, 0.694217205f},
-std::array<float,2>{0.141655326f, 0.495594323f},
-std::array<float,2>{0.890394866f, 0.949320376f},
-std::array<float,2>{0.598741293f, 0.0963978469f},
-std::array<float,2>{0.497869194f, 0.666732192f},
-std::array<float,2>{0.324254334f, 0.247543722f},
-std::array<float,2>{0.71323812f, 0.562689662f},
-std::array<float,2>{0.763625681f, 0.355175555f},
-std::array<float,2>{0.0824390501f, 0.755753875f},
-std::array<float,2>{0.0425253063f, 0.0530702695f},
-std::array<float,2>{0.832066476f, 0.699255705f},
-std::array<float,2>{0.630639195f, 0.381100565f},
-std::array<float,2>{0.273929298f, 0.934205353f},
-std::array<float,2>{0.396694273f, 0.255612075f},
-std::array<float,2>{0.521002233f, 0.857219398f},
-std::array<float,2>{0.943001032f, 0.164973512f},
-std::array<float,2>{0.247537777f, 0.548227489f},
-std::array<float,2>{0.0960104764f, 0.334268153f},
-std::array<float,2>{0.785293221f, 0.797873139f},
-std::array<float,2>{0.730601311f, 0.201334044f},
-std::array<float,2>{0.372096598f, 0.605392873f},
-std::array<float,2>{0.458355367f, 0.0890107602f},
-std::array<float,2>{0.587931573f, 0.653481007f},
-std::array<float,2>{0.924189091f, 0.45637849f},
-std::array<float,2>{0.179241896f, 0.999941587f},
-std::array<float,2>{0.210685208f, 0.145709097f},
-std::array<float,2>{0.971652687f, 0.520062268f},
-std::array<float,2>{0.531790853f, 0.281463414f},
-std::array<float,2>{0.411549151f, 0.823007226f},
-std::array<float,2>{0.290627569f, 0.414236009f},
-std::array<float,2>{0.677108645f, 0.881879747f},
-std::array<float,2>{0.868398368f, 0.0185639169f},
-std::array<float,2>{0.00947236083f, 0.739748597f},
-std::array<float,2>{0.0214407388f, 0.401171625f},
-std::array<float,2>{0.855209291f, 0.911395311f},
-std::array<float,2>{0.666549504f, 0.0432748757f},
-std::array<float,2>{0.30118376f, 0.71793741f},
-std::array<float,2>{0.425172567f, 0.184812725f},
-std::array<float,2>{0.549028158f, 0.539008379f},
-std::array<float,2>{0.986126363f, 0.275940686f},
-std::array<float,2>{0.193668008f, 0.868316054f},
-std::array<float,2>{0.168697044f, 0.109560534f},
-std::array<float,2>{0.909073412f, 0.673360229f},
-std::array<float,2>{0.575951934f, 0.476093948f},
-std::array<float,2>{0.445297539f, 0.963611841f},
-std::array<float,2>{0.356047541f, 0.368622452f},
-std::array<float,2>{0.748852551f, 0.769787312f},
-std::array<float,2>{0.800253212f, 0.232562363f},
-std::array<float,2>{0.111212499f, 0.581616461f},
-std::array<float,2>{0.227739662f, 0.308901489f},
-std::array<float,2>{0.961236656f, 0.834352732f},
-std::array<float,2>{0.509690642f, 0.140555114f},
-std::array<float,2>{0.387133837f, 0.500686824f},
-std::array<float,2>{0.261279315f, 0.00804590248f},
-std::array<float,2>{0.651376188f, 0.72842288f},
-std::array<float,2>{0.821677625f, 0.430512071f},
-std::array<float,2>{0.055080615f, 0.899353385f},
-std::array<float,2>{0.0773907676f, 0.211074173f},
-std::array<float,2>{0.776250303f, 0.621078193f},
-std::array<float,2>{0.691347718f, 0.31434238f},
-std::array<float,2>{0.32863149f, 0.788120389f},
-std::array<float,2>{0.483843446f, 0.45219633f},
-std::array<float,2>{0.610530198f, 0.970748782f},
-std::array<float,2>{0.895185411f, 0.0700739846f},
-std::array<float,2>{0.13456957f, 0.638807893f},
-std::array<float,2>{0.140362516f, 0.388795525f},
-std::array<float,2>{0.891485155f, 0.928998649f},
-std::array<float,2>{0.614016354f, 0.0590613559f},
-std::array<float,2>{0.480084777f, 0.689703107f},
-std::array<float,2>{0.334852248f, 0.163592324f},
-std::array<float,2>{0.695293725f, 0.555776119f},
-std::array<float,2>{0.780686319f, 0.262699664f},
-std::array<float,2>{0.0723444298f, 0.845506012f},
-std::array<float,2>{0.0587271787f, 0.102886982f},
-std::array<float,2>{0.827176273f, 0.659141958f},
-std::array<float,2>{0.652458251f, 0.489157796f},
-std::array<float,2>{0.264451683f, 0.940632999f},
-std::array<float,2>{0.384459943f, 0.344311982f},
-std::array<float,2>{0.512645781f, 0.761271954f},
-std::array<float,2>{0.967891634f, 0.236982509f},
-std::array<float,2>{0.230779663f, 0.576393723f},
-std::array<float,2>{0.116005972f, 0.292928517f},
-std::array<float,2>{0.8044433f, 0.81728816f},
-std::array<float,2>{0.744730949f, 0.151634648f},
-std::array<float,2>{0.352052689f, 0.530390143f},
-std::array<float,2>{0.440495431f, 0.0243511125f},
-std::array<float,2>{0.571316659f, 0.746233404f},
-std::array<float,2>{0.911668181f, 0.408655018f},
-std::array<float,2>{0.165906087f, 0.888070345f},
-std::array<float,2>{0.190846816f, 0.193700671f},
-std::array<float,2>{0.988933444f, 0.593951285f},
-std::array<float,2>{0.55333513f, 0.341136992f},
-std::array<float,2>{0.426990271f, 0.812136889f},
-std::array<float,2>{0.297636062f, 0.468553871f},
-std::array<float,2>{0.669427276f, 0.986508727f},
-std::array<float,2>{0.856877744f, 0.0795823187f},
-std::array<float,2>{0.0177422948f, 0.641384423f},
-std::array<float,2>{0.0149177276f, 0.483242422f},
-std::array<float,2>{0.872968912f, 0.955568373f},
-std::array<float,2>{0.673843086f, 0.120618299f},
-std::array<float,2>{0.293043971f, 0.686550856f},
-std::array<float,2>{0.407579124f, 0.222576916f},
-std::array<float,2>{0.537170172f, 0.59348917f},
-std::array<float,2>{0.976320446f, 0.365583986f},
-std::array<float,2>{0.204116568f, 0.778376222f},
-std::array<float,2>{0.173334643f, 0.0339073502f},
-std::array<float,2>{0.926682949f, 0.704586387f},
-std::array<float,2>{0.592256248f, 0.396234185f},
-std::array<float,2>{0.456003696f, 0.91893363f},
-std::array<float,2>{0.368564844f, 0.26761806f},
-std::array<float,2>{0.727369547f, 0.866894662f},
-std::array<float,2>{0.784030318f, 0.173804328f},
-std::array<float,2>{0.100174747f, 0.546580613f},
-std::array<float,2>{0.243859395f, 0.321260095f},
-std::array<float,2>{0.93786025f, 0.793105543f},
-std::array<float,2>{0.518094003f, 0.209289134f},
-std::array<float,2>{0.394422978f, 0.6138376f},
-std::array<float,2>{0.280270457f, 0.0724488348f},
-std::array<float,2>{0.627264142f, 0.62514019f},
-std::array<float,2>{0.828951478f, 0.44122541f},
-std::array<float,2>{0.0450874977f, 0.983901322f},
-std::array<float,2>{0.0817626119f, 0.125105307f},
-std::array<float,2>{0.759285629f, 0.515344381f},
-std::array<float,2>{0.715535045f, 0.298256218f},
-std::array<float,2>{0.320586711f, 0.839748085f},
-std::array<float,2>{0.493528903f, 0.42584902f},
-std::array<float,2>{0.594547212f, 0.895638108f},
-std::array<float,2>{0.884482861f, 0.0015608808f},
-std::array<float,2>{0.147269547f, 0.725056469f},
-std::array<float,2>{0.214214027f, 0.448017627f},
-std::array<float,2>{0.984370351f, 0.973499298f},
-std::array<float,2>{0.543979049f, 0.0626998171f},
-std::array<float,2>{0.415133774f, 0.634884238f},
-std::array<float,2>{0.287344694f, 0.217802182f},
-std::array<float,2>{0.682067394f, 0.623340547f},
-std::array<float,2>{0.865337253f, 0.318176508f},
-std::array<float,2>{0.00665233145f, 0.782437921f},
-std::array<float,2>{0.10391625f, 0.0141658708f},
-std::array<float,2>{0.789231241f, 0.73228395f},
-std::array<float,2>{0.718995333f, 0.436386764f},
-std::array<float,2>{0.363258958f, 0.904422343f},
-std::array<float,2>{0.4617562f, 0.307741016f},
-std::array<float,2>{0.584580839f, 0.828908801f},
-std::array<float,2>{0.931991577f, 0.13521266f},
-std::array<float,2>{0.181252018f, 0.505693495f},
-std::array<float,2>{0.0325595178f, 0.373918414f},
-std::array<float,2>{0.842622399f, 0.766352475f},
-std::array<float,2>{0.634760976f, 0.22708942f},
-std::array<float,2>{0.268584579f, 0.584559977f},
-std::array<float,2>{0.402794927f, 0.115319811f},
-std::array<float,2>{0.527228892f, 0.67676127f},
-std::array<float,2>{0.94863683f, 0.470246881f},
-std::array<float,2>{0.240377888f, 0.967192411f},
-std::array<float,2>{0.154480249f, 0.182027534f},
-std::array<float,2>{0.879180849f, 0.533027112f},
-std::array<float,2>{0.606765628f, 0.279684216f},
-std::array<float,2>{0.48747918f, 0.874254525f},
-std::array<float,2>{0.313382208f, 0.405186236f},
-std::array<float,2>{0.704255581f, 0.906856239f},
-std::array<float,2>{0.750531614f, 0.0416707732f},
-std::array<float,2>{0.0926907212f, 0.71129936f},
-std::array<float,2>{0.0628017634f, 0.419352978f},
-std::array<float,2>{0.770190179f, 0.878144205f},
-std::array<float,2>{0.702998638f, 0.0216319021f},
-std::array<float,2>{0.343415171f, 0.736403704f},
-std::array<float,2>{0.469800115f, 0.141883418f},
-std::array<float,2>{0.618794382f, 0.5169999f},
-std::array<float,2>{0.906021059f, 0.287960261f},
-std::array<float,2>{0.125606477f, 0.825682998f},
-std::array<float,2>{0.223117083f, 0.0922753885f},
-std::array<float,2>{0.95702517f, 0.650348723f},
-std::array<float,2>{0.504988432f, 0.457115799f},
-std::array<float,2>{0.377798468f, 0.995647848f},
-std::array<float,2>{0.255350441f, 0.32931149f},
-std::array<float,2>{0.643567502f, 0.804288805f},
-std::array<float,2>{0.819287598f, 0.197446465f},
-std::array<float,2>{0.0533008762f, 0.608945131f},
-std::array<float,2>{0.16296272f, 0.251464307f},
-std::array<float,2>{0.915748477f, 0.853136063f},
-std::array<float,2>{0.569950342f, 0.170545712f},
-std::array<float,2>{0.445570827f, 0.553192496f},
-std::array<float,2>{0.348725498f, 0.0488107838f},
-std::array<float,2>{0.737903118f, 0.696454048f},
-std::array<float,2>{0.805920541f, 0.375268787f},
-std::array<float,2>{0.121248722f, 0.932993412f},
-std::array<float,2>{0.0252819471f, 0.244637221f},
-std::array<float,2>{0.845518053f, 0.570093572f},
-std::array<float,2>{0.661090195f, 0.355854511f},
-std::array<float,2>{0.305532724f, 0.753820837f},
-std::array<float,2>{0.437011927f, 0.49703747f},
-std::array<float,2>{0.555640638f, 0.945676088f},
-std::array<float,2>{0.999248981f, 0.10018751f},
-std::array<float,2>{0.196141019f, 0.668276429f},
-std::array<float,2>{0.2295596f, 0.430056989f},
-std::array<float,2>{0.964079738f, 0.898511887f},
-std::array<float,2>{0.511240244f, 0.00855284464f},
-std::array<float,2>{0.390072256f, 0.727554798f},
-std::array<float,2>{0.25876677f, 0.139658391f},
-std::array<float,2>{0.64967984f, 0.500423729f},
-std::array<float,2>{0.823194325f, 0.309497654f},
-std::array<float,2>{0.0585190132f, 0.834715545f},
-std::array<float,2>{0.0760427341f, 0.0694588572f},
-std::array<float,2>{0.773953617f, 0.639517844f},
-std::array<float,2>{0.687966287f, 0.453112721f},
-std::array<float,2>{0.331268519f, 0.971619427f},
-std::array<float,2>{0.481158018f, 0.313659668f},
-std::array<float,2>{0.612752914f, 0.788755774f},
-std::array<float,2>{0.896772265f, 0.21172139f},
-std::array<float,2>{0.135550782f, 0.620308995f},
-std::array<float,2>{0.0224930979f, 0.275789976f},
-std::array<float,2>{0.852426589f, 0.869096458f},
-std::array<float,2>{0.66462177f, 0.185322702f},
-std::array<float,2>{0.303670436f, 0.538246572f},
-std::array<float,2>{0.4225187f, 0.0436216891f},
-std::array<float,2>{0.548179507f, 0.718549192f},
-std::array<float,2>{0.987368941f, 0.400794148f},
-std::array<float,2>{0.192173734f, 0.911684394f},
-std::array<float,2>{0.170044228f, 0.233297452f},
-std::array<float,2>{0.907807231f, 0.58137244f},
-std::array<float,2>{0.577731609f, 0.368770033f},
-std::array<float,2>{0.442878187f, 0.770096719f},
-std::array<float,2>{0.359205008f, 0.475893378f},
-std::array<float,2>{0.74724853f, 0.963334084f},
-std::array<float,2>{0.797765672f, 0.110051244f},
-std::array<float,2>{0.112154089f, 0.673023641f},
-std::array<float,2>{0.095414184f, 0.456852973f},
-std::array<float,2>{0.788811743f, 0.999114573f},
-std::array<float,2>{0.733817816f, 0.0896688178f},
-std::array<float,2>{0.373873413f, 0.65388608f},
-std::array<float,2>{0.459755212f, 0.202034563f},
-std::array<float,2>{0.586522043f, 0.604801655f},
-std::array<float,2>{0.922588289f, 0.334914654f},
-std::array<float,2>{0.177677587f, 0.798752785f},
-std::array<float,2>{0.208914235f, 0.0191431567f},
-std::array<float,2>{0.969711185f, 0.739452362f},
-std::array<float,2>{0.533940196f, 0.414650291f},
-std::array<float,2>{0.413351148f, 0.882497609f},
-std::array<float,2>{0.292410582f, 0.281900287f},
-std::array<float,2>{0.679420829f, 0.822742164f},
-std::array<float,2>{0.870503247f, 0.146402031f},
-std::array<float,2>{0.0116467113f, 0.519660771f},
-std::array<float,2>{0.143536761f, 0.354687095f},
-std::array<float,2>{0.887026191f, 0.755065739f},
-std::array<float,2>{0.599619508f, 0.247842342f},
-std::array<float,2>{0.499669045f, 0.563310206f},
-std::array<float,2>{0.326242268f, 0.0959380046f},
-std::array<float,2>{0.712504864f, 0.666318595f},
-std::array<float,2>{0.763838351f, 0.495863527f},
-std::array<float,2>{0.0854370371f, 0.949800551f},
-std::array<float,2>{0.040047776f, 0.164203376f},
-std::array<float,2>{0.834757209f, 0.548354924f},
-std::array<float,2>{0.630873501f, 0.254982024f},
-std::array<float,2>{0.276174098f, 0.856848061f},
-std::array<float,2>{0.395136535f, 0.381356686f},
-std::array<float,2>{0.523332417f, 0.933737576f},
-std::array<float,2>{0.943720222f, 0.0534870401f},
-std::array<float,2>{0.248136446f, 0.700034916f},
-std::array<float,2>{0.186515689f, 0.486343652f},
-std::array<float,2>{0.937045336f, 0.943505883f},
-std::array<float,2>{0.581379235f, 0.107332669f},
-std::array<float,2>{0.465318561f, 0.660432041f},
-std::array<float,2>{0.366392106f, 0.238796815f},
-std::array<float,2>{0.724283934f, 0.570430636f},
-std::array<float,2>{0.794237792f, 0.348110318f},
-std::array<float,2>{0.106556557f, 0.764634848f},
-std::array<float,2>{0.00281379209f, 0.0576228723f},
-std::array<float,2>{0.862655401f, 0.693536401f},
-std::array<float,2>{0.685324967f, 0.386181325f},
-std::array<float,2>{0.282107353f, 0.924573779f},
-std::array<float,2>{0.42087999f, 0.260351449f},
-std::array<float,2>{0.542784691f, 0.850898206f},
-std::array<float,2>{0.977859259f, 0.158697575f},
-std::array<float,2>{0.217765182f, 0.56073004f},
-std::array<float,2>{0.0869865641f, 0.33966282f},
-std::array<float,2>{0.757746875f, 0.80757308f},
-std::array<float,2>{0.707528353f, 0.191255331f},
-std::array<float,2>{0.317160815f, 0.59894979f},
-std::array<float,2>{0.489636898f, 0.0844374746f},
-std::array<float,2>{0.602114618f, 0.648017406f},
-std::array<float,2>{0.87526685f, 0.463204801f},
-std::array<float,2>{0.148781493f, 0.989660621f},
-std::array<float,2>{0.236908183f, 0.152398318f},
-std::array<float,2>{0.951132059f, 0.526134253f},
-std::array<float,2>{0.527485788f, 0.293997288f},
-std::array<float,2>{0.399832457f, 0.815177262f},
-std::array<float,2>{0.271518737f, 0.413916916f},
-std::array<float,2>{0.639635623f, 0.885837317f},
-std::array<float,2>{0.838886261f, 0.0308984909f},
-std::array<float,2>{0.0382740274f, 0.743732452f},
-std::array<float,2>{0.0496524759f, 0.392220378f},
-std::array<float,2>{0.815420747f, 0.915008962f},
-std::array<float,2>{0.648129642f, 0.038553223f},
-std::array<float,2>{0.252926588f, 0.708511412f},
-std::array<float,2>{0.380204886f, 0.176831752f},
-std::array<float,2>{0.501222074f, 0.539824963f},
-std::array<float,2>{0.960551858f, 0.271868885f},
-std::array<float,2>{0.218803868f, 0.863046646f},
-std::array<float,2>{0.131080121f, 0.124411516f},
-std::array<float,2>{0.902211726f, 0.680337965f},
-std::array<float,2>{0.623255491f, 0.480150372f},
-std::array<float,2>{0.475545943f, 0.958141387f},
-std::array<float,2>{0.339221388f, 0.359401107f},
-std::array<float,2>{0.696047544f, 0.775857329f},
-std::array<float,2>{0.767941892f, 0.225563467f},
-std::array<float,2>{0.0676149353f, 0.589782596f},
-std::array<float,2>{0.200353354f, 0.303500921f},
-std::array<float,2>{0.993507743f, 0.840286732f},
-std::array<float,2>{0.561034977f, 0.132466599f},
-std::array<float,2>{0.432984769f, 0.509383798f},
-std::array<float,2>{0.310346276f, 0.0050866222f},
-std::array<float,2>{0.659564316f, 0.721686661f},
-std::array<float,2>{0.847766101f, 0.423126042f},
-std::array<float,2>{0.0284104962f, 0.893828511f},
-std::array<float,2>{0.120901905f, 0.206868395f},
-std::array<float,2>{0.811615109f, 0.612365782f},
-std::array<float,2>{0.738886952f, 0.327404171f},
-std::array<float,2>{0.346793741f, 0.789215386f},
-std::array<float,2>{0.450564206f, 0.441485405f},
-std::array<float,2>{0.565429628f, 0.978148401f},
-std::array<float,2>{0.920229077f, 0.0773274079f},
-std::array<float,2>{0.159997344f, 0.63112694f},
-std::array<float,2>{0.166118234f, 0.40786311f},
-std::array<float,2>{0.913490772f, 0.890024602f},
-std::array<float,2>{0.573335409f, 0.027117556f},
-std::array<float,2>{0.439298749f, 0.748334467f},
-std::array<float,2>{0.354796588f, 0.149692386f},
-std::array<float,2>{0.7431373f, 0.528494954f},
-std::array<float,2>{0.801603496f, 0.290191263f},
-std::array<float,2>{0.113934822f, 0.819837511f},
-std::array<float,2>{0.0165312476f, 0.0803024843f},
-std::array<float,2>{0.858978391f, 0.644179106f},
-std::array<float,2>{0.671324253f, 0.465030342f},
-std::array<float,2>{0.29932192f, 0.986001134f},
-std::array<float,2>{0.428533733f, 0.342235416f},
-std::array<float,2>{0.551424682f, 0.810399234f},
-std::array<float,2>{0.991590977f, 0.191963956f},
-std::array<float,2>{0.18872191f, 0.595932901f},
-std::array<float,2>{0.071145989f, 0.263986021f},
-std::array<float,2>{0.778395712f, 0.846464574f},
-std::array<float,2>{0.691565812f, 0.16144143f},
-std::array<float,2>{0.332054287f, 0.556833386f},
-std::array<float,2>{0.477032989f, 0.0608948842f},
-std::array<float,2>{0.61552006f, 0.687952518f},
-std::array<float,2>{0.893923879f, 0.388213575f},
-std::array<float,2>{0.137288168f, 0.92652148f},
-std::array<float,2>{0.233736932f, 0.236318946f},
-std::array<float,2>{0.9666664f, 0.575439155f},
-std::array<float,2>{0.515509427f, 0.347134173f},
-std::array<float,2>{0.385847747f, 0.758841097f},
-std::array<float,2>{0.263043672f, 0.490915716f},
-std::array<float,2>{0.654771507f, 0.939132512f},
-std::array<float,2>{0.826048076f, 0.10443493f},
-std::array<float,2>{0.0606845357f, 0.656348228f},
-std::array<float,2>{0.0443567485f, 0.437872827f},
-std::array<float,2>{0.830743909f, 0.980947852f},
-std::array<float,2>{0.626422465f, 0.0714185461f},
-std::array<float,2>{0.278547496f, 0.628381908f},
-std::array<float,2>{0.392250001f, 0.208852559f},
-std::array<float,2>{0.517510533f, 0.616960645f},
-std::array<float,2>{0.939502954f, 0.324123681f},
-std::array<float,2>{0.245831937f, 0.796127856f},
-std::array<float,2>{0.144947201f, 0.00336386263f},
-std::array<float,2>{0.885405064f, 0.72397989f},
-std::array<float,2>{0.596517026f, 0.42953214f},
-std::array<float,2>{0.495529383f, 0.89713484f},
-std::array<float,2>{0.322522044f, 0.300577074f},
-std::array<float,2>{0.717162848f, 0.836941659f},
-std::array<float,2>{0.760230958f, 0.128104195f},
-std::array<float,2>{0.0782163143f, 0.513275325f},
-std::array<float,2>{0.20520404f, 0.364062577f},
-std::array<float,2>{0.973353326f, 0.780410528f},
-std::array<float,2>{0.536465168f, 0.219611034f},
-std::array<float,2>{0.40840435f, 0.591593087f},
-std::array<float,2>{0.296683311f, 0.118958496f},
-std::array<float,2>{0.673564196f, 0.684264421f},
-std::array<float,2>{0.873954892f, 0.482148707f},
-std::array<float,2>{0.0133910226f, 0.953513205f},
-std::array<float,2>{0.0989228934f, 0.174106851f},
-std::array<float,2>{0.782580972f, 0.543614328f},
-std::array<float,2>{0.729030371f, 0.266348302f},
-std::array<float,2>{0.369540393f, 0.863671899f},
-std::array<float,2>{0.454836249f, 0.397287011f},
-std::array<float,2>{0.590812266f, 0.921422064f},
-std::array<float,2>{0.929184139f, 0.0320257694f},
-std::array<float,2>{0.173908591f, 0.70535934f},
-std::array<float,2>{0.238860965f, 0.471917897f},
-std::array<float,2>{0.946680963f, 0.966150105f},
-std::array<float,2>{0.52400589f, 0.113994643f},
-std::array<float,2>{0.405174762f, 0.679250658f},
-std::array<float,2>{0.267308503f, 0.230273202f},
-std::array<float,2>{0.63587141f, 0.582045674f},
-std::array<float,2>{0.840989351f, 0.371502161f},
-std::array<float,2>{0.0346270874f, 0.768140435f},
-std::array<float,2>{0.0909161642f, 0.0402816907f},
-std::array<float,2>{0.752745926f, 0.713500977f},
-std::array<float,2>{0.706258893f, 0.403618038f},
-std::array<float,2>{0.314488977f, 0.908406675f},
-std::array<float,2>{0.484750688f, 0.278143436f},
-std::array<float,2>{0.607469261f, 0.871167183f},
-std::array<float,2>{0.882355392f, 0.180635422f},
-std::array<float,2>{0.15372248f, 0.533312201f},
-std::array<float,2>{0.00436674524f, 0.320017487f},
-std::array<float,2>{0.864663064f, 0.78492409f},
-std::array<float,2>{0.680746257f, 0.215332255f},
-std::array<float,2>{0.285589695f, 0.622452378f},
-std::array<float,2>{0.416222394f, 0.0660622716f},
-std::array<float,2>{0.546134412f, 0.634387851f},
-std::array<float,2>{0.980756521f, 0.446984082f},
-std::array<float,2>{0.211333051f, 0.97488445f},
-std::array<float,2>{0.183318064f, 0.133707002f},
-std::array<float,2>{0.930620372f, 0.506020129f},
-std::array<float,2>{0.5823856f, 0.304854214f},
-std::array<float,2>{0.464741379f, 0.830852866f},
-std::array<float,2>{0.360893518f, 0.435402364f},
-std::array<float,2>{0.721709549f, 0.903766155f},
-std::array<float,2>{0.792880237f, 0.0131567577f},
-std::array<float,2>{0.103314437f, 0.732518017f},
-std::array<float,2>{0.123412013f, 0.377655476f},
-std::array<float,2>{0.80806762f, 0.930385709f},
-std::array<float,2>{0.735828757f, 0.0506910048f},
-std::array<float,2>{0.349656999f, 0.698018551f},
-std::array<float,2>{0.448105365f, 0.169226944f},
-std::array<float,2>{0.566853642f, 0.551493585f},
-std::array<float,2>{0.917739153f, 0.252148479f},
-std::array<float,2>{0.162052765f, 0.854316115f},
-std::array<float,2>{0.1973636f, 0.0978795364f},
-std::array<float,2>{0.99630326f, 0.671608508f},
-std::array<float,2>{0.557096541f, 0.499694049f},
-std::array<float,2>{0.434851289f, 0.948938131f},
-std::array<float,2>{0.307934761f, 0.357662171f},
-std::array<float,2>{0.663387895f, 0.751549125f},
-std::array<float,2>{0.845785439f, 0.243253112f},
-std::array<float,2>{0.0266653895f, 0.568280637f},
-std::array<float,2>{0.128742784f, 0.286863476f},
-std::array<float,2>{0.902367651f, 0.827059209f},
-std::array<float,2>{0.620950639f, 0.143904671f},
-std::array<float,2>{0.470711917f, 0.518285215f},
-std::array<float,2>{0.341585487f, 0.0210144967f},
-std::array<float,2>{0.700556993f, 0.736024261f},
-std::array<float,2>{0.771543562f, 0.420586228f},
-std::array<float,2>{0.0662413463f, 0.87576586f},
-std::array<float,2>{0.0510703698f, 0.195742637f},
-std::array<float,2>{0.817089975f, 0.60599184f},
-std::array<float,2>{0.642206311f, 0.331201047f},
-std::array<float,2>{0.257734954f, 0.801878333f},
-std::array<float,2>{0.37600553f, 0.45902884f},
-std::array<float,2>{0.507709801f, 0.993302107f},
-std::array<float,2>{0.954134762f, 0.0913539678f},
-std::array<float,2>{0.2265587f, 0.651462257f},
-std::array<float,2>{0.194030255f, 0.398605824f},
-std::array<float,2>{0.985418141f, 0.913342714f},
-std::array<float,2>{0.549558997f, 0.0454151146f},
-std::array<float,2>{0.425334781f, 0.715206802f},
-std::array<float,2>{0.301338762f, 0.185557008f},
-std::array<float,2>{0.66647464f, 0.536660314f},
-std::array<float,2>{0.85473901f, 0.274543554f},
-std::array<float,2>{0.0207621176f, 0.870861292f},
-std::array<float,2>{0.110358551f, 0.113079377f},
-std::array<float,2>{0.800296307f, 0.675437272f},
-std::array<float,2>{0.748478115f, 0.474219352f},
-std::array<float,2>{0.355823159f, 0.96225214f},
-std::array<float,2>{0.444799155f, 0.371089578f},
-std::array<float,2>{0.575515211f, 0.772691607f},
-std::array<float,2>{0.908228219f, 0.2310206f},
-std::array<float,2>{0.167991117f, 0.578937709f},
-std::array<float,2>{0.0555167384f, 0.310718f},
-std::array<float,2>{0.822248399f, 0.832990885f},
-std::array<float,2>{0.652255833f, 0.137818515f},
-std::array<float,2>{0.260864556f, 0.502524495f},
-std::array<float,2>{0.387271911f, 0.0113847554f},
-std::array<float,2>{0.509144604f, 0.728611231f},
-std::array<float,2>{0.961476803f, 0.433169872f},
-std::array<float,2>{0.228495151f, 0.901400626f},
-std::array<float,2>{0.133884862f, 0.214838445f},
-std::array<float,2>{0.89493078f, 0.617241859f},
-std::array<float,2>{0.61112088f, 0.31519556f},
-std::array<float,2>{0.484229654f, 0.785217941f},
-std::array<float,2>{0.328439504f, 0.449838489f},
-std::array<float,2>{0.69048816f, 0.970465839f},
-std::array<float,2>{0.775405347f, 0.0674034357f},
-std::array<float,2>{0.077691175f, 0.6375947f},
-std::array<float,2>{0.0825271904f, 0.492345989f},
-std::array<float,2>{0.762824535f, 0.951807082f},
-std::array<float,2>{0.713721693f, 0.0941999182f},
-std::array<float,2>{0.325193673f, 0.664932072f},
-std::array<float,2>{0.497457534f, 0.248481169f},
-std::array<float,2>{0.599128366f, 0.565973282f},
-std::array<float,2>{0.889966249f, 0.353447884f},
-std::array<float,2>{0.142338395f, 0.756352544f},
-std::array<float,2>{0.247791037f, 0.0517408438f},
-std::array<float,2>{0.942808211f, 0.701190174f},
-std::array<float,2>{0.520899832f, 0.380302429f},
-std::array<float,2>{0.397036582f, 0.93590194f},
-std::array<float,2>{0.273786128f, 0.257634878f},
-std::array<float,2>{0.62990576f, 0.85898608f},
-std::array<float,2>{0.832881033f, 0.167245373f},
-std::array<float,2>{0.0421053134f, 0.550218344f},
-std::array<float,2>{0.179071397f, 0.333909184f},
-std::array<float,2>{0.924668014f, 0.800657451f},
-std::array<float,2>{0.58870405f, 0.200866595f},
-std::array<float,2>{0.458712041f, 0.601827741f},
-std::array<float,2>{0.372824848f, 0.0866034701f},
-std::array<float,2>{0.731133699f, 0.654414713f},
-std::array<float,2>{0.785963535f, 0.453628153f},
-std::array<float,2>{0.0966168046f, 0.996707201f},
-std::array<float,2>{0.00910391659f, 0.147359848f},
-std::array<float,2>{0.869123399f, 0.522018254f},
-std::array<float,2>{0.677666008f, 0.284517586f},
-std::array<float,2>{0.290282518f, 0.820842803f},
-std::array<float,2>{0.412003845f, 0.416439444f},
-std::array<float,2>{0.531725109f, 0.879898071f},
-std::array<float,2>{0.971013904f, 0.016718803f},
-std::array<float,2>{0.210049644f, 0.741738439f},
-std::array<float,2>{0.151792869f, 0.460990071f},
-std::array<float,2>{0.878478527f, 0.990354002f},
-std::array<float,2>{0.604975641f, 0.0831380412f},
-std::array<float,2>{0.491920024f, 0.646300077f},
-std::array<float,2>{0.31888479f, 0.188438311f},
-std::array<float,2>{0.70925194f, 0.600898683f},
-std::array<float,2>{0.75507468f, 0.337304622f},
-std::array<float,2>{0.0897907317f, 0.805547953f},
-std::array<float,2>{0.036571227f, 0.0289924536f},
-std::array<float,2>{0.837231696f, 0.745242178f},
-std::array<float,2>{0.637126327f, 0.411951095f},
-std::array<float,2>{0.269982457f, 0.883815646f},
-std::array<float,2>{0.400613785f, 0.296343684f},
-std::array<float,2>{0.529319763f, 0.812652528f},
-std::array<float,2>{0.951574028f, 0.154411271f},
-std::array<float,2>{0.235357761f, 0.524839103f},
-std::array<float,2>{0.10886848f, 0.350159705f},
-std::array<float,2>{0.796398938f, 0.76240617f},
-std::array<float,2>{0.725194216f, 0.240605623f},
-std::array<float,2>{0.363401294f, 0.572560489f},
-std::array<float,2>{0.46786195f, 0.108442716f},
-std::array<float,2>{0.578155994f, 0.663941145f},
-std::array<float,2>{0.93367213f, 0.48499909f},
-std::array<float,2>{0.184125155f, 0.943183005f},
-std::array<float,2>{0.215664059f, 0.157489374f},
-std::array<float,2>{0.979434192f, 0.559891224f},
-std::array<float,2>{0.540211141f, 0.258103132f},
-std::array<float,2>{0.418311924f, 0.84957552f},
-std::array<float,2>{0.284371555f, 0.383403599f},
-std::array<float,2>{0.686807573f, 0.92332381f},
-std::array<float,2>{0.860946476f, 0.0561244749f},
-std::array<float,2>{0.00190397701f, 0.692980051f},
-std::array<float,2>{0.0309900977f, 0.425010651f},
-std::array<float,2>{0.850559235f, 0.892338991f},
-std::array<float,2>{0.657668531f, 0.00706425076f},
-std::array<float,2>{0.311716318f, 0.719869077f},
-std::array<float,2>{0.430887014f, 0.130344212f},
-std::array<float,2>{0.560522914f, 0.509821415f},
-std::array<float,2>{0.994319618f, 0.301491112f},
-std::array<float,2>{0.2028431f, 0.843025625f},
-std::array<float,2>{0.157991767f, 0.0746782646f},
-std::array<float,2>{0.918276846f, 0.630762756f},
-std::array<float,2>{0.563803494f, 0.44501704f},
-std::array<float,2>{0.45280385f, 0.979079068f},
-std::array<float,2>{0.345333695f, 0.326039523f},
-std::array<float,2>{0.741627038f, 0.792965949f},
-std::array<float,2>{0.810365736f, 0.204375908f},
-std::array<float,2>{0.118635729f, 0.610449612f},
-std::array<float,2>{0.220917478f, 0.270995528f},
-std::array<float,2>{0.958941758f, 0.86010617f},
-std::array<float,2>{0.502931178f, 0.179679528f},
-std::array<float,2>{0.380919456f, 0.542274594f},
-std::array<float,2>{0.250278026f, 0.0359378569f},
-std::array<float,2>{0.644682467f, 0.71057117f},
-std::array<float,2>{0.813539684f, 0.394264966f},
-std::array<float,2>{0.0471142791f, 0.917770565f},
-std::array<float,2>{0.0693684667f, 0.223220333f},
-std::array<float,2>{0.76611501f, 0.586983085f},
-std::array<float,2>{0.697808146f, 0.362123162f},
-std::array<float,2>{0.337271035f, 0.77437675f},
-std::array<float,2>{0.47324428f, 0.478111207f},
-std::array<float,2>{0.622217119f, 0.960190535f},
-std::array<float,2>{0.899037361f, 0.121402778f},
-std::array<float,2>{0.129784912f, 0.683186293f},
-std::array<float,2>{0.14820613f, 0.428342074f},
-std::array<float,2>{0.883096576f, 0.898205042f},
-std::array<float,2>{0.595228493f, 0.00220158533f},
-std::array<float,2>{0.492334068f, 0.722903192f},
-std::array<float,2>{0.322148234f, 0.127859145f},
-std::array<float,2>{0.716092646f, 0.511909902f},
-std::array<float,2>{0.757895172f, 0.299701005f},
-std::array<float,2>{0.0806608349f, 0.836730719f},
-std::array<float,2>{0.0462836027f, 0.0711232424f},
-std::array<float,2>{0.829928219f, 0.627638996f},
-std::array<float,2>{0.628194332f, 0.43885532f},
-std::array<float,2>{0.280783832f, 0.982039869f},
-std::array<float,2>{0.393045962f, 0.323059767f},
-std::array<float,2>{0.518773258f, 0.795657754f},
-std::array<float,2>{0.938981473f, 0.207296625f},
-std::array<float,2>{0.243011683f, 0.616159618f},
-std::array<float,2>{0.101235971f, 0.267547488f},
-std::array<float,2>{0.784946561f, 0.864275575f},
-std::array<float,2>{0.728082895f, 0.175383091f},
-std::array<float,2>{0.367385924f, 0.544169664f},
-std::array<float,2>{0.456795663f, 0.0330329277f},
-std::array<float,2>{0.593731701f, 0.70665139f},
-std::array<float,2>{0.927179992f, 0.3978917f},
-std::array<float,2>{0.172827959f, 0.920193434f},
-std::array<float,2>{0.204001561f, 0.220324278f},
-std::array<float,2>{0.97502619f, 0.590430677f},
-std::array<float,2>{0.538737357f, 0.36477679f},
-std::array<float,2>{0.406873345f, 0.779556334f},
-std::array<float,2>{0.294082701f, 0.481192708f},
-std::array<float,2>{0.675134718f, 0.954546213f},
-std::array<float,2>{0.871498704f, 0.117652573f},
-std::array<float,2>{0.0146343801f, 0.684970498f},
-std::array<float,2>{0.0189883206f, 0.466057688f},
-std::array<float,2>{0.855702043f, 0.985012949f},
-std::array<float,2>{0.668547332f, 0.0816760957f},
-std::array<float,2>{0.297897547f, 0.64294821f},
-std::array<float,2>{0.426069915f, 0.193019047f},
-std::array<float,2>{0.553988457f, 0.597249687f},
-std::array<float,2>{0.989606738f, 0.343416691f},
-std::array<float,2>{0.18963252f, 0.809407175f},
-std::array<float,2>{0.164428964f, 0.0261276402f},
-std::array<float,2>{0.910619974f, 0.749544084f},
-std::array<float,2>{0.570344031f, 0.406322896f},
-std::array<float,2>{0.440385967f, 0.888807595f},
-std::array<float,2>{0.352888048f, 0.289654464f},
-std::array<float,2>{0.745156169f, 0.819311619f},
-std::array<float,2>{0.802850842f, 0.14914602f},
-std::array<float,2>{0.116288304f, 0.527703702f},
-std::array<float,2>{0.232382447f, 0.346631169f},
-std::array<float,2>{0.967452407f, 0.757963359f},
-std::array<float,2>{0.512785614f, 0.23456876f},
-std::array<float,2>{0.382971406f, 0.574348748f},
-std::array<float,2>{0.264789611f, 0.1045276f},
-std::array<float,2>{0.653701007f, 0.657332003f},
-std::array<float,2>{0.826210499f, 0.491900176f},
-std::array<float,2>{0.0600583516f, 0.937666357f},
-std::array<float,2>{0.0740229115f, 0.160468683f},
-std::array<float,2>{0.779524446f, 0.558277726f},
-std::array<float,2>{0.693678319f, 0.26557067f},
-std::array<float,2>{0.335815579f, 0.847193956f},
-std::array<float,2>{0.479212999f, 0.387402833f},
-std::array<float,2>{0.614859402f, 0.926958263f},
-std::array<float,2>{0.891751647f, 0.062230207f},
-std::array<float,2>{0.13939403f, 0.688786924f},
-std::array<float,2>{0.196839616f, 0.498310447f},
-std::array<float,2>{0.998385251f, 0.947301388f},
-std::array<float,2>{0.555871427f, 0.099099502f},
-std::array<float,2>{0.435975641f, 0.670179605f},
-std::array<float,2>{0.305773586f, 0.242296517f},
-std::array<float,2>{0.66127187f, 0.567354977f},
-std::array<float,2>{0.843922615f, 0.358465701f},
-std::array<float,2>{0.0238949843f, 0.750619769f},
-std::array<float,2>{0.122173965f, 0.0495079905f},
-std::array<float,2>{0.805597425f, 0.699036598f},
-std::array<float,2>{0.736374021f, 0.378681332f},
-std::array<float,2>{0.347918689f, 0.931129277f},
-std::array<float,2>{0.446478456f, 0.253491253f},
-std::array<float,2>{0.568833411f, 0.85506165f},
-std::array<float,2>{0.914967179f, 0.168069243f},
-std::array<float,2>{0.163163483f, 0.552733362f},
-std::array<float,2>{0.0544334501f, 0.330328345f},
-std::array<float,2>{0.820151269f, 0.800898492f},
-std::array<float,2>{0.642877758f, 0.196548566f},
-std::array<float,2>{0.254265249f, 0.607334673f},
-std::array<float,2>{0.378348589f, 0.0902551711f},
-std::array<float,2>{0.50456208f, 0.65136236f},
-std::array<float,2>{0.955653846f, 0.460932314f},
-std::array<float,2>{0.224152282f, 0.99278003f},
-std::array<float,2>{0.126382902f, 0.143020272f},
-std::array<float,2>{0.90517509f, 0.519384086f},
-std::array<float,2>{0.617830515f, 0.28596586f},
-std::array<float,2>{0.46927622f, 0.827963173f},
-std::array<float,2>{0.342761576f, 0.421490669f},
-std::array<float,2>{0.701201856f, 0.876947522f},
-std::array<float,2>{0.771205723f, 0.0200794246f},
-std::array<float,2>{0.0639462173f, 0.734625578f},
-std::array<float,2>{0.0930185616f, 0.402771235f},
-std::array<float,2>{0.7510885f, 0.909889579f},
-std::array<float,2>{0.703358173f, 0.0398694649f},
-std::array<float,2>{0.313609868f, 0.714266837f},
-std::array<float,2>{0.487186998f, 0.180698454f},
-std::array<float,2>{0.605917811f, 0.534887671f},
-std::array<float,2>{0.880568147f, 0.279121608f},
-std::array<float,2>{0.156129301f, 0.872372329f},
-std::array<float,2>{0.241808534f, 0.114659227f},
-std::array<float,2>{0.947842538f, 0.678617835f},
-std::array<float,2>{0.526087821f, 0.471332818f},
-std::array<float,2>{0.404254109f, 0.964927852f},
-std::array<float,2>{0.267758489f, 0.372390032f},
-std::array<float,2>{0.633379519f, 0.769207418f},
-std::array<float,2>{0.843388975f, 0.228608266f},
-std::array<float,2>{0.0319013968f, 0.583623052f},
-std::array<float,2>{0.180271059f, 0.306461543f},
-std::array<float,2>{0.933196723f, 0.831377685f},
-std::array<float,2>{0.585310817f, 0.133893311f},
-std::array<float,2>{0.462658972f, 0.507262588f},
-std::array<float,2>{0.361471295f, 0.0118028922f},
-std::array<float,2>{0.720388293f, 0.733644962f},
-std::array<float,2>{0.790996671f, 0.434077919f},
-std::array<float,2>{0.104542777f, 0.902681768f},
-std::array<float,2>{0.00689936057f, 0.21629408f},
-std::array<float,2>{0.866565049f, 0.621525288f},
-std::array<float,2>{0.682620704f, 0.318914264f},
-std::array<float,2>{0.288923562f, 0.78323698f},
-std::array<float,2>{0.414402217f, 0.446067929f},
-std::array<float,2>{0.543050587f, 0.975927949f},
-std::array<float,2>{0.983160973f, 0.0653117076f},
-std::array<float,2>{0.213845775f, 0.63305223f},
-std::array<float,2>{0.249591738f, 0.379422337f},
-std::array<float,2>{0.945046604f, 0.936721385f},
-std::array<float,2>{0.522194624f, 0.0526395999f},
-std::array<float,2>{0.396449596f, 0.702583432f},
-std::array<float,2>{0.277090549f, 0.166526854f},
-std::array<float,2>{0.631857872f, 0.549131393f},
-std::array<float,2>{0.835022986f, 0.25590995f},
-std::array<float,2>{0.0394434631f, 0.857889473f},
-std::array<float,2>{0.0846913308f, 0.0955352336f},
-std::array<float,2>{0.765167773f, 0.66524148f},
-std::array<float,2>{0.711858034f, 0.494103014f},
-std::array<float,2>{0.327555001f, 0.952150345f},
-std::array<float,2>{0.498880953f, 0.352149904f},
-std::array<float,2>{0.601162553f, 0.757226884f},
-std::array<float,2>{0.888414443f, 0.24905704f},
-std::array<float,2>{0.144049525f, 0.565231621f},
-std::array<float,2>{0.0103428904f, 0.283764482f},
-std::array<float,2>{0.869748592f, 0.821967781f},
-std::array<float,2>{0.678387165f, 0.148144975f},
-std::array<float,2>{0.291473955f, 0.523031533f},
-std::array<float,2>{0.412762195f, 0.0164451525f},
-std::array<float,2>{0.534377813f, 0.740775287f},
-std::array<float,2>{0.969948351f, 0.417373687f},
-std::array<float,2>{0.207701474f, 0.879098833f},
-std::array<float,2>{0.176061764f, 0.199820459f},
-std::array<float,2>{0.923652351f, 0.602741599f},
-std::array<float,2>{0.587129116f, 0.332536131f},
-std::array<float,2>{0.460848719f, 0.799260318f},
-std::array<float,2>{0.374226332f, 0.454500496f},
-std::array<float,2>{0.732579827f, 0.997855186f},
-std::array<float,2>{0.787496328f, 0.0869941339f},
-std::array<float,2>{0.0942949802f, 0.656139314f},
-std::array<float,2>{0.113213822f, 0.47278139f},
-std::array<float,2>{0.798303902f, 0.961209416f},
-std::array<float,2>{0.74703151f, 0.111706614f},
-std::array<float,2>{0.357928902f, 0.674134374f},
-std::array<float,2>{0.441794157f, 0.2319583f},
-std::array<float,2>{0.576818705f, 0.579187214f},
-std::array<float,2>{0.906493604f, 0.369557053f},
-std::array<float,2>{0.171091288f, 0.771853745f},
-std::array<float,2>{0.192772746f, 0.04615077f},
-std::array<float,2>{0.98641181f, 0.716097891f},
-std::array<float,2>{0.547358692f, 0.4002783f},
-std::array<float,2>{0.423079431f, 0.912307084f},
-std::array<float,2>{0.304324389f, 0.274135947f},
-std::array<float,2>{0.665140629f, 0.870092869f},
-std::array<float,2>{0.852878392f, 0.187450901f},
-std::array<float,2>{0.0216861051f, 0.536068082f},
-std::array<float,2>{0.13628526f, 0.316150069f},
-std::array<float,2>{0.898210287f, 0.786740184f},
-std::array<float,2>{0.611757338f, 0.213517696f},
-std::array<float,2>{0.481585562f, 0.618655205f},
-std::array<float,2>{0.330951303f, 0.0664771721f},
-std::array<float,2>{0.689388573f, 0.638652384f},
-std::array<float,2>{0.774458408f, 0.451152712f},
-std::array<float,2>{0.0747432858f, 0.96902895f},
-std::array<float,2>{0.0571409315f, 0.137284294f},
-std::array<float,2>{0.823591709f, 0.503332615f},
-std::array<float,2>{0.648867309f, 0.312310994f},
-std::array<float,2>{0.259219557f, 0.833139479f},
-std::array<float,2>{0.389162809f, 0.432567388f},
-std::array<float,2>{0.510374665f, 0.901254356f},
-std::array<float,2>{0.963052273f, 0.0104726702f},
-std::array<float,2>{0.229424834f, 0.730089366f},
-std::array<float,2>{0.15906328f, 0.444126248f},
-std::array<float,2>{0.921373129f, 0.980417967f},
-std::array<float,2>{0.566020668f, 0.0756985024f},
-std::array<float,2>{0.449395716f, 0.629026771f},
-std::array<float,2>{0.345788091f, 0.203215823f},
-std::array<float,2>{0.739337802f, 0.610162675f},
-std::array<float,2>{0.811454833f, 0.32506901f},
-std::array<float,2>{0.119390257f, 0.79190892f},
-std::array<float,2>{0.0280653611f, 0.00602305634f},
-std::array<float,2>{0.849561572f, 0.719449818f},
-std::array<float,2>{0.65887934f, 0.42437765f},
-std::array<float,2>{0.308898449f, 0.891358137f},
-std::array<float,2>{0.432560384f, 0.301980555f},
-std::array<float,2>{0.561719418f, 0.842354298f},
-std::array<float,2>{0.992650628f, 0.12947683f},
-std::array<float,2>{0.199934751f, 0.511015952f},
-std::array<float,2>{0.0667907745f, 0.362888902f},
-std::array<float,2>{0.768685937f, 0.774951935f},
-std::array<float,2>{0.696858525f, 0.224497497f},
-std::array<float,2>{0.338780046f, 0.586453259f},
-std::array<float,2>{0.476363242f, 0.122353896f},
-std::array<float,2>{0.624153018f, 0.682121038f},
-std::array<float,2>{0.901249826f, 0.476903975f},
-std::array<float,2>{0.132287472f, 0.95909071f},
-std::array<float,2>{0.220103145f, 0.177910879f},
-std::array<float,2>{0.959905922f, 0.541194439f},
-std::array<float,2>{0.500525415f, 0.270120025f},
-std::array<float,2>{0.378939003f, 0.861317337f},
-std::array<float,2>{0.253324986f, 0.392933577f},
-std::array<float,2>{0.647230148f, 0.916478992f},
-std::array<float,2>{0.816197455f, 0.0367430225f},
-std::array<float,2>{0.0502285138f, 0.709478319f},
-std::array<float,2>{0.0374239199f, 0.411114842f},
-std::array<float,2>{0.838421345f, 0.882974923f},
-std::array<float,2>{0.640597165f, 0.0275910571f},
-std::array<float,2>{0.273228019f, 0.744222343f},
-std::array<float,2>{0.399088532f, 0.156141371f},
-std::array<float,2>{0.528847933f, 0.523942709f},
-std::array<float,2>{0.949469328f, 0.294943571f},
-std::array<float,2>{0.237573519f, 0.81361717f},
-std::array<float,2>{0.150376588f, 0.0822586417f},
-std::array<float,2>{0.876826704f, 0.644941449f},
-std::array<float,2>{0.603203833f, 0.462755948f},
-std::array<float,2>{0.488396823f, 0.991755724f},
-std::array<float,2>{0.317523986f, 0.336034566f},
-std::array<float,2>{0.708491385f, 0.806106508f},
-std::array<float,2>{0.756488025f, 0.188511282f},
-std::array<float,2>{0.0865996704f, 0.600319386f},
-std::array<float,2>{0.218552753f, 0.259612471f},
-std::array<float,2>{0.977444232f, 0.848002672f},
-std::array<float,2>{0.541599751f, 0.156635404f},
-std::array<float,2>{0.420997053f, 0.559348106f},
-std::array<float,2>{0.282967806f, 0.0548798926f},
-std::array<float,2>{0.684506476f, 0.691690505f},
-std::array<float,2>{0.861971378f, 0.384648353f},
-std::array<float,2>{0.00382172968f, 0.922661483f},
-std::array<float,2>{0.105741456f, 0.241820827f},
-std::array<float,2>{0.793277144f, 0.57420218f},
-std::array<float,2>{0.722717166f, 0.350608557f},
-std::array<float,2>{0.36589992f, 0.763196588f},
-std::array<float,2>{0.465991378f, 0.485713631f},
-std::array<float,2>{0.580748379f, 0.941578805f},
-std::array<float,2>{0.936245203f, 0.108171031f},
-std::array<float,2>{0.187389761f, 0.663065553f},
-std::array<float,2>{0.175431758f, 0.395365864f},
-std::array<float,2>{0.927821219f, 0.919364214f},
-std::array<float,2>{0.591504633f, 0.0350921005f},
-std::array<float,2>{0.453854918f, 0.703894734f},
-std::array<float,2>{0.370473862f, 0.172554374f},
-std::array<float,2>{0.730114281f, 0.545298815f},
-std::array<float,2>{0.781848371f, 0.2693367f},
-std::array<float,2>{0.0984708667f, 0.865849316f},
-std::array<float,2>{0.012557039f, 0.119978502f},
-std::array<float,2>{0.874723315f, 0.686414063f},
-std::array<float,2>{0.672733963f, 0.483844012f},
-std::array<float,2>{0.295235515f, 0.956135929f},
-std::array<float,2>{0.409470588f, 0.366555691f},
-std::array<float,2>{0.536010206f, 0.778119087f},
-std::array<float,2>{0.974232197f, 0.221660063f},
-std::array<float,2>{0.206364259f, 0.592743337f},
-std::array<float,2>{0.079140462f, 0.297705293f},
-std::array<float,2>{0.761488199f, 0.838606834f},
-std::array<float,2>{0.718347013f, 0.12624374f},
-std::array<float,2>{0.323732942f, 0.514387965f},
-std::array<float,2>{0.4944821f, 6.47641937e-05f},
-std::array<float,2>{0.597369313f, 0.726196706f},
-std::array<float,2>{0.886398911f, 0.427185446f},
-std::array<float,2>{0.145830125f, 0.894541562f},
-std::array<float,2>{0.244891137f, 0.210620746f},
-std::array<float,2>{0.940486848f, 0.614440739f},
-std::array<float,2>{0.516531467f, 0.322133482f},
-std::array<float,2>{0.391443253f, 0.794220209f},
-std::array<float,2>{0.278317809f, 0.439873397f},
-std::array<float,2>{0.625047803f, 0.982542098f},
-std::array<float,2>{0.831690967f, 0.0739752352f},
-std::array<float,2>{0.0435437113f, 0.626939178f},
-std::array<float,2>{0.0616948307f, 0.490038961f},
-std::array<float,2>{0.824716866f, 0.939955533f},
-std::array<float,2>{0.655870736f, 0.102192365f},
-std::array<float,2>{0.26244387f, 0.65964824f},
-std::array<float,2>{0.385160834f, 0.238081455f},
-std::array<float,2>{0.514271975f, 0.577320218f},
-std::array<float,2>{0.965386689f, 0.345134467f},
-std::array<float,2>{0.233098581f, 0.760253668f},
-std::array<float,2>{0.138367429f, 0.0597183369f},
-std::array<float,2>{0.892837226f, 0.690994322f},
-std::array<float,2>{0.616643131f, 0.39041999f},
-std::array<float,2>{0.478318542f, 0.927761614f},
-std::array<float,2>{0.333328396f, 0.262616456f},
-std::array<float,2>{0.693118215f, 0.844476283f},
-std::array<float,2>{0.777565777f, 0.162482157f},
-std::array<float,2>{0.0721857175f, 0.554800868f},
-std::array<float,2>{0.188348442f, 0.340634972f},
-std::array<float,2>{0.990507305f, 0.810665548f},
-std::array<float,2>{0.552460372f, 0.194947153f},
-std::array<float,2>{0.428876251f, 0.59544158f},
-std::array<float,2>{0.299855173f, 0.078971155f},
-std::array<float,2>{0.670464098f, 0.641806126f},
-std::array<float,2>{0.857981443f, 0.467022359f},
-std::array<float,2>{0.017110208f, 0.988103628f},
-std::array<float,2>{0.114487164f, 0.150514334f},
-std::array<float,2>{0.802041411f, 0.529459655f},
-std::array<float,2>{0.743661821f, 0.291324466f},
-std::array<float,2>{0.353728414f, 0.818280995f},
-std::array<float,2>{0.437547654f, 0.409535229f},
-std::array<float,2>{0.572528303f, 0.8875615f},
-std::array<float,2>{0.912588894f, 0.0252758376f},
-std::array<float,2>{0.167335138f, 0.747509956f},
-std::array<float,2>{0.224789947f, 0.458481371f},
-std::array<float,2>{0.953636587f, 0.994721115f},
-std::array<float,2>{0.506416619f, 0.0930736661f},
-std::array<float,2>{0.375862837f, 0.649401128f},
-std::array<float,2>{0.256051153f, 0.198742539f},
-std::array<float,2>{0.641161323f, 0.607423902f},
-std::array<float,2>{0.81814456f, 0.32907933f},
-std::array<float,2>{0.0522022396f, 0.803402305f},
-std::array<float,2>{0.0647218898f, 0.0226000044f},
-std::array<float,2>{0.77305007f, 0.737695873f},
-std::array<float,2>{0.69990772f, 0.418814242f},
-std::array<float,2>{0.340566307f, 0.877019644f},
-std::array<float,2>{0.472109884f, 0.288320154f},
-std::array<float,2>{0.620081842f, 0.82456249f},
-std::array<float,2>{0.903337181f, 0.14098382f},
-std::array<float,2>{0.127099395f, 0.516448498f},
-std::array<float,2>{0.0257604662f, 0.357288957f},
-std::array<float,2>{0.846833229f, 0.752794623f},
-std::array<float,2>{0.662221372f, 0.245460734f},
-std::array<float,2>{0.306663543f, 0.569046259f},
-std::array<float,2>{0.433894038f, 0.100933813f},
-std::array<float,2>{0.558151662f, 0.669328451f},
-std::array<float,2>{0.997177601f, 0.497649819f},
-std::array<float,2>{0.198971659f, 0.946684241f},
-std::array<float,2>{0.161048397f, 0.170932114f},
-std::array<float,2>{0.916967452f, 0.553823113f},
-std::array<float,2>{0.568229079f, 0.250797063f},
-std::array<float,2>{0.448520601f, 0.852179885f},
-std::array<float,2>{0.351352245f, 0.376015902f},
-std::array<float,2>{0.734696507f, 0.932316363f},
-std::array<float,2>{0.806945801f, 0.0470502488f},
-std::array<float,2>{0.124278508f, 0.696268559f},
-std::array<float,2>{0.101966314f, 0.436541498f},
-std::array<float,2>{0.791558027f, 0.906221807f},
-std::array<float,2>{0.721106827f, 0.0155791566f},
-std::array<float,2>{0.359733075f, 0.731124997f},
-std::array<float,2>{0.463120699f, 0.136266157f},
-std::array<float,2>{0.583341002f, 0.50423938f},
-std::array<float,2>{0.931113899f, 0.307610154f},
-std::array<float,2>{0.181900591f, 0.829714477f},
-std::array<float,2>{0.212398484f, 0.0634824634f},
-std::array<float,2>{0.981672704f, 0.636128664f},
-std::array<float,2>{0.544937909f, 0.449214399f},
-std::array<float,2>{0.417380154f, 0.974503875f},
-std::array<float,2>{0.286670148f, 0.317336649f},
-std::array<float,2>{0.680524111f, 0.78184557f},
-std::array<float,2>{0.863517046f, 0.216906518f},
-std::array<float,2>{0.00566424523f, 0.624572992f},
-std::array<float,2>{0.152497992f, 0.280661702f},
-std::array<float,2>{0.880873859f, 0.873796284f},
-std::array<float,2>{0.608680964f, 0.182672769f},
-std::array<float,2>{0.486220449f, 0.532170832f},
-std::array<float,2>{0.316174865f, 0.042758815f},
-std::array<float,2>{0.70594871f, 0.712313294f},
-std::array<float,2>{0.753646135f, 0.405327618f},
-std::array<float,2>{0.0899126083f, 0.907626867f},
-std::array<float,2>{0.0334802717f, 0.228010908f},
-std::array<float,2>{0.84060663f, 0.585418105f},
-std::array<float,2>{0.63569665f, 0.374639601f},
-std::array<float,2>{0.265987575f, 0.767383575f},
-std::array<float,2>{0.405762702f, 0.468765408f},
-std::array<float,2>{0.525275111f, 0.968156636f},
-std::array<float,2>{0.946175158f, 0.116770566f},
-std::array<float,2>{0.239701897f, 0.676167846f},
-std::array<float,2>{0.208994031f, 0.415452003f},
-std::array<float,2>{0.972061038f, 0.881505013f},
-std::array<float,2>{0.533195019f, 0.018548714f},
-std::array<float,2>{0.410414308f, 0.739042759f},
-std::array<float,2>{0.28986761f, 0.145291403f},
-std::array<float,2>{0.675945163f, 0.521016896f},
-std::array<float,2>{0.867657006f, 0.282764256f},
-std::array<float,2>{0.00804017484f, 0.824105442f},
-std::array<float,2>{0.0968558341f, 0.0886012539f},
-std::array<float,2>{0.786347985f, 0.652452648f},
-std::array<float,2>{0.731828332f, 0.455536127f},
-std::array<float,2>{0.371979326f, 0.998723269f},
-std::array<float,2>{0.457666636f, 0.33508721f},
-std::array<float,2>{0.589433491f, 0.797563195f},
-std::array<float,2>{0.925551713f, 0.202264205f},
-std::array<float,2>{0.177910492f, 0.604046702f},
-std::array<float,2>{0.0411001667f, 0.254459739f},
-std::array<float,2>{0.833087504f, 0.855601609f},
-std::array<float,2>{0.629638731f, 0.165916011f},
-std::array<float,2>{0.274534255f, 0.547340393f},
-std::array<float,2>{0.398235142f, 0.0539086349f},
-std::array<float,2>{0.519849122f, 0.70024997f},
-std::array<float,2>{0.941608369f, 0.382174492f},
-std::array<float,2>{0.246167243f, 0.934973955f},
-std::array<float,2>{0.14071992f, 0.246100068f},
-std::array<float,2>{0.889333725f, 0.563625157f},
-std::array<float,2>{0.59812355f, 0.353877872f},
-std::array<float,2>{0.496644586f, 0.754099429f},
-std::array<float,2>{0.325956464f, 0.494277686f},
-std::array<float,2>{0.714055955f, 0.950763702f},
-std::array<float,2>{0.761966169f, 0.0975163877f},
-std::array<float,2>{0.083446309f, 0.667333424f},
-std::array<float,2>{0.0770924091f, 0.451401442f},
-std::array<float,2>{0.7769894f, 0.971904337f},
-std::array<float,2>{0.689848661f, 0.0691236407f},
-std::array<float,2>{0.329261005f, 0.639855146f},
-std::array<float,2>{0.482938439f, 0.212006494f},
-std::array<float,2>{0.609524906f, 0.61973536f},
-std::array<float,2>{0.896298647f, 0.313453615f},
-std::array<float,2>{0.132951692f, 0.787254095f},
-std::array<float,2>{0.226912469f, 0.00918731f},
-std::array<float,2>{0.962668598f, 0.726762652f},
-std::array<float,2>{0.50818181f, 0.431609869f},
-std::array<float,2>{0.388276756f, 0.899765432f},
-std::array<float,2>{0.259777099f, 0.310242981f},
-std::array<float,2>{0.650586545f, 0.835517585f},
-std::array<float,2>{0.821222305f, 0.139505416f},
-std::array<float,2>{0.0563469306f, 0.501044154f},
-std::array<float,2>{0.169244796f, 0.367709219f},
-std::array<float,2>{0.909939766f, 0.771211982f},
-std::array<float,2>{0.574784875f, 0.234039351f},
-std::array<float,2>{0.443551183f, 0.580147207f},
-std::array<float,2>{0.357064009f, 0.110629223f},
-std::array<float,2>{0.749535084f, 0.672692358f},
-std::array<float,2>{0.799331844f, 0.475297421f},
-std::array<float,2>{0.109397933f, 0.963886738f},
-std::array<float,2>{0.0199466422f, 0.184341341f},
-std::array<float,2>{0.853858829f, 0.537992477f},
-std::array<float,2>{0.667846382f, 0.276527673f},
-std::array<float,2>{0.302371204f, 0.867998004f},
-std::array<float,2>{0.424424022f, 0.401434213f},
-std::array<float,2>{0.549990356f, 0.910366118f},
-std::array<float,2>{0.98495239f, 0.0446552448f},
-std::array<float,2>{0.195172638f, 0.717156053f},
-std::array<float,2>{0.130489051f, 0.479093641f},
-std::array<float,2>{0.900066853f, 0.957984507f},
-std::array<float,2>{0.62122947f, 0.123062633f},
-std::array<float,2>{0.473654836f, 0.681289911f},
-std::array<float,2>{0.336337537f, 0.226108119f},
-std::array<float,2>{0.698976398f, 0.588173926f},
-std::array<float,2>{0.76746887f, 0.360720634f},
-std::array<float,2>{0.0689879209f, 0.777142882f},
-std::array<float,2>{0.048436854f, 0.0377038904f},
-std::array<float,2>{0.813144863f, 0.707883239f},
-std::array<float,2>{0.646069229f, 0.391177833f},
-std::array<float,2>{0.251260847f, 0.915108383f},
-std::array<float,2>{0.38252762f, 0.272614002f},
-std::array<float,2>{0.501995981f, 0.862105191f},
-std::array<float,2>{0.957515776f, 0.176664114f},
-std::array<float,2>{0.22201556f, 0.540857017f},
-std::array<float,2>{0.118114419f, 0.326781392f},
-std::array<float,2>{0.808627665f, 0.790332079f},
-std::array<float,2>{0.740412354f, 0.205481261f},
-std::array<float,2>{0.343758881f, 0.611987054f},
-std::array<float,2>{0.451465577f, 0.0771308169f},
-std::array<float,2>{0.562985361f, 0.632680357f},
-std::array<float,2>{0.919057429f, 0.44275254f},
-std::array<float,2>{0.156662196f, 0.977353036f},
-std::array<float,2>{0.201807588f, 0.131251812f},
-std::array<float,2>{0.995628178f, 0.508372009f},
-std::array<float,2>{0.559293568f, 0.304553032f},
-std::array<float,2>{0.430480748f, 0.84135735f},
-std::array<float,2>{0.311384946f, 0.422032505f},
-std::array<float,2>{0.656811833f, 0.892859936f},
-std::array<float,2>{0.850919485f, 0.00452001579f},
-std::array<float,2>{0.0299621914f, 0.721305549f},
-std::array<float,2>{0.00021391816f, 0.384994119f},
-std::array<float,2>{0.859624743f, 0.925772846f},
-std::array<float,2>{0.685559571f, 0.0566914603f},
-std::array<float,2>{0.283767283f, 0.695015371f},
-std::array<float,2>{0.41990459f, 0.159479126f},
-std::array<float,2>{0.539247394f, 0.562340021f},
-std::array<float,2>{0.979960203f, 0.261053145f},
-std::array<float,2>{0.216750681f, 0.850450099f},
-std::array<float,2>{0.185062334f, 0.105600871f},
-std::array<float,2>{0.935415268f, 0.661525846f},
-std::array<float,2>{0.579788685f, 0.488037616f},
-std::array<float,2>{0.467312664f, 0.944373369f},
-std::array<float,2>{0.364920855f, 0.349157035f},
-std::array<float,2>{0.726111829f, 0.765567422f},
-std::array<float,2>{0.795881927f, 0.239504814f},
-std::array<float,2>{0.107512496f, 0.571800351f},
-std::array<float,2>{0.234466508f, 0.293726295f},
-std::array<float,2>{0.952685654f, 0.816349149f},
-std::array<float,2>{0.530368388f, 0.153817132f},
-std::array<float,2>{0.401729554f, 0.526884615f},
-std::array<float,2>{0.27143237f, 0.0301644821f},
-std::array<float,2>{0.63777566f, 0.742505252f},
-std::array<float,2>{0.836257398f, 0.413047194f},
-std::array<float,2>{0.0352651663f, 0.885702491f},
-std::array<float,2>{0.0878943056f, 0.189583629f},
-std::array<float,2>{0.754158318f, 0.59837532f},
-std::array<float,2>{0.71009928f, 0.338478982f},
-std::array<float,2>{0.319672853f, 0.808532238f},
-std::array<float,2>{0.490875185f, 0.464752465f},
-std::array<float,2>{0.604235709f, 0.988591731f},
-std::array<float,2>{0.877905428f, 0.0854718536f},
-std::array<float,2>{0.15091902f, 0.647205353f},
-std::array<float,2>{0.144424632f, 0.381204963f},
-std::array<float,2>{0.888467968f, 0.934484243f},
-std::array<float,2>{0.601478994f, 0.0528230555f},
-std::array<float,2>{0.49866119f, 0.699665725f},
-std::array<float,2>{0.327158511f, 0.164567545f},
-std::array<float,2>{0.711591125f, 0.547915101f},
-std::array<float,2>{0.765536427f, 0.255669981f},
-std::array<float,2>{0.0848093033f, 0.857028782f},
-std::array<float,2>{0.0391099043f, 0.0964749902f},
-std::array<float,2>{0.835408449f, 0.666828275f},
-std::array<float,2>{0.632235527f, 0.495161295f},
-std::array<float,2>{0.277290523f, 0.949503362f},
-std::array<float,2>{0.396030515f, 0.355433255f},
-std::array<float,2>{0.522390544f, 0.755438745f},
-std::array<float,2>{0.945261061f, 0.247099385f},
-std::array<float,2>{0.249838859f, 0.562977195f},
-std::array<float,2>{0.0947030187f, 0.281541586f},
-std::array<float,2>{0.7873317f, 0.822776794f},
-std::array<float,2>{0.732796013f, 0.145926327f},
-std::array<float,2>{0.374394506f, 0.520377219f},
-std::array<float,2>{0.46052137f, 0.0189045146f},
-std::array<float,2>{0.587304354f, 0.740137994f},
-std::array<float,2>{0.923532248f, 0.414425045f},
-std::array<float,2>{0.175844699f, 0.882288873f},
-std::array<float,2>{0.207831651f, 0.201544017f},
-std::array<float,2>{0.970111251f, 0.604984045f},
-std::array<float,2>{0.534649789f, 0.334220111f},
-std::array<float,2>{0.41304493f, 0.798231363f},
-std::array<float,2>{0.291122615f, 0.456255436f},
-std::array<float,2>{0.678510487f, 0.999566913f},
-std::array<float,2>{0.87001127f, 0.0893258378f},
-std::array<float,2>{0.0105985329f, 0.653602183f},
-std::array<float,2>{0.0219393186f, 0.476428121f},
-std::array<float,2>{0.852713346f, 0.963825464f},
-std::array<float,2>{0.665342748f, 0.109701037f},
-std::array<float,2>{0.304648578f, 0.67379576f},
-std::array<float,2>{0.423175931f, 0.232805461f},
-std::array<float,2>{0.547092974f, 0.581969261f},
-std::array<float,2>{0.986662447f, 0.368338883f},
-std::array<float,2>{0.192581534f, 0.76970005f},
-std::array<float,2>{0.17137605f, 0.0431121774f},
-std::array<float,2>{0.906683683f, 0.718219221f},
-std::array<float,2>{0.577068627f, 0.401095748f},
-std::array<float,2>{0.441537529f, 0.91113627f},
-std::array<float,2>{0.358224541f, 0.276335925f},
-std::array<float,2>{0.746605814f, 0.868647158f},
-std::array<float,2>{0.797959566f, 0.18494226f},
-std::array<float,2>{0.113028117f, 0.538711607f},
-std::array<float,2>{0.229189828f, 0.314020604f},
-std::array<float,2>{0.963169396f, 0.788345575f},
-std::array<float,2>{0.510545969f, 0.211422965f},
-std::array<float,2>{0.389573812f, 0.620744705f},
-std::array<float,2>{0.258820385f, 0.0700016469f},
-std::array<float,2>{0.648581207f, 0.638984799f},
-std::array<float,2>{0.823383152f, 0.452624708f},
-std::array<float,2>{0.0574229546f, 0.971001804f},
-std::array<float,2>{0.075151071f, 0.140229359f},
-std::array<float,2>{0.774753094f, 0.500785351f},
-std::array<float,2>{0.689137757f, 0.308795393f},
-std::array<float,2>{0.330571651f, 0.833988726f},
-std::array<float,2>{0.481836349f, 0.430199325f},
-std::array<float,2>{0.611405194f, 0.899062216f},
-std::array<float,2>{0.89795202f, 0.00823155697f},
-std::array<float,2>{0.136594415f, 0.728195548f},
-std::array<float,2>{0.200005129f, 0.442165792f},
-std::array<float,2>{0.992314756f, 0.977552116f},
-std::array<float,2>{0.561983645f, 0.0780451596f},
-std::array<float,2>{0.432156384f, 0.631819308f},
-std::array<float,2>{0.308643103f, 0.206204087f},
-std::array<float,2>{0.659113824f, 0.612991393f},
-std::array<float,2>{0.849122822f, 0.328080386f},
-std::array<float,2>{0.0282544252f, 0.789619327f},
-std::array<float,2>{0.119197391f, 0.00542880548f},
-std::array<float,2>{0.811195672f, 0.722187519f},
-std::array<float,2>{0.739514053f, 0.423602641f},
-std::array<float,2>{0.346186608f, 0.894153416f},
-std::array<float,2>{0.449611276f, 0.302794844f},
-std::array<float,2>{0.566344798f, 0.840534389f},
-std::array<float,2>{0.921107292f, 0.132155821f},
-std::array<float,2>{0.158703923f, 0.509155095f},
-std::array<float,2>{0.049926471f, 0.360133886f},
-std::array<float,2>{0.81601876f, 0.776107609f},
-std::array<float,2>{0.64720583f, 0.224648088f},
-std::array<float,2>{0.253087521f, 0.589176238f},
-std::array<float,2>{0.379393309f, 0.124926724f},
-std::array<float,2>{0.500878453f, 0.679729342f},
-std::array<float,2>{0.959586799f, 0.479878545f},
-std::array<float,2>{0.219809324f, 0.958605468f},
-std::array<float,2>{0.132068262f, 0.177555591f},
-std::array<float,2>{0.90104115f, 0.539253712f},
-std::array<float,2>{0.624480665f, 0.272316068f},
-std::array<float,2>{0.476088256f, 0.86278671f},
-std::array<float,2>{0.338555247f, 0.391628921f},
-std::array<float,2>{0.697202921f, 0.914500415f},
-std::array<float,2>{0.768929541f, 0.0385897532f},
-std::array<float,2>{0.0664731413f, 0.708153367f},
-std::array<float,2>{0.086740002f, 0.413284898f},
-std::array<float,2>{0.756769598f, 0.88655144f},
-std::array<float,2>{0.708072782f, 0.0304432064f},
-std::array<float,2>{0.317854136f, 0.743389368f},
-std::array<float,2>{0.488704473f, 0.152903765f},
-std::array<float,2>{0.603380978f, 0.525756538f},
-std::array<float,2>{0.876596928f, 0.294717789f},
-std::array<float,2>{0.150061399f, 0.814798236f},
-std::array<float,2>{0.237372443f, 0.0849072412f},
-std::array<float,2>{0.949319243f, 0.647851348f},
-std::array<float,2>{0.529141247f, 0.463631809f},
-std::array<float,2>{0.399396658f, 0.989895225f},
-std::array<float,2>{0.273178339f, 0.339046419f},
-std::array<float,2>{0.64023f, 0.807006359f},
-std::array<float,2>{0.83875066f, 0.19073309f},
-std::array<float,2>{0.0372973941f, 0.599590421f},
-std::array<float,2>{0.18717882f, 0.260094017f},
-std::array<float,2>{0.936459541f, 0.851128161f},
-std::array<float,2>{0.580893755f, 0.158617929f},
-std::array<float,2>{0.466231614f, 0.561369777f},
-std::array<float,2>{0.366081804f, 0.0583178103f},
-std::array<float,2>{0.723025441f, 0.6938712f},
-std::array<float,2>{0.79308933f, 0.386541635f},
-std::array<float,2>{0.105685383f, 0.92429775f},
-std::array<float,2>{0.00361606479f, 0.238462314f},
-std::array<float,2>{0.86206156f, 0.570831358f},
-std::array<float,2>{0.68423146f, 0.348337024f},
-std::array<float,2>{0.282842249f, 0.764023125f},
-std::array<float,2>{0.421275675f, 0.487191498f},
-std::array<float,2>{0.541921794f, 0.944043219f},
-std::array<float,2>{0.977066457f, 0.106512859f},
-std::array<float,2>{0.218448341f, 0.660998285f},
-std::array<float,2>{0.242850199f, 0.426676601f},
-std::array<float,2>{0.939225137f, 0.896379888f},
-std::array<float,2>{0.51881212f, 0.00123031053f},
-std::array<float,2>{0.392606139f, 0.725463569f},
-std::array<float,2>{0.281029105f, 0.125892192f},
-std::array<float,2>{0.628086388f, 0.514816463f},
-std::array<float,2>{0.82978034f, 0.298350573f},
-std::array<float,2>{0.0459070131f, 0.838892341f},
-std::array<float,2>{0.0808256641f, 0.0728506222f},
-std::array<float,2>{0.758284628f, 0.625802398f},
-std::array<float,2>{0.71586591f, 0.440787047f},
-std::array<float,2>{0.321952611f, 0.983881891f},
-std::array<float,2>{0.49247092f, 0.320642769f},
-std::array<float,2>{0.595497251f, 0.793694198f},
-std::array<float,2>{0.882864535f, 0.209523171f},
-std::array<float,2>{0.148025498f, 0.613446712f},
-std::array<float,2>{0.0143026626f, 0.268466949f},
-std::array<float,2>{0.871185839f, 0.866517127f},
-std::array<float,2>{0.674857199f, 0.173177168f},
-std::array<float,2>{0.294216156f, 0.546088517f},
-std::array<float,2>{0.40711996f, 0.0333661214f},
-std::array<float,2>{0.538990498f, 0.704648137f},
-std::array<float,2>{0.974832296f, 0.395604491f},
-std::array<float,2>{0.203677937f, 0.918132842f},
-std::array<float,2>{0.172567308f, 0.221972004f},
-std::array<float,2>{0.926902294f, 0.592960596f},
-std::array<float,2>{0.593398154f, 0.366163641f},
-std::array<float,2>{0.456774771f, 0.779289424f},
-std::array<float,2>{0.367445111f, 0.48277995f},
-std::array<float,2>{0.72838974f, 0.955275893f},
-std::array<float,2>{0.784887016f, 0.12042813f},
-std::array<float,2>{0.101511292f, 0.687218487f},
-std::array<float,2>{0.116663545f, 0.467881083f},
-std::array<float,2>{0.803151011f, 0.987015367f},
-std::array<float,2>{0.745486259f, 0.0800378397f},
-std::array<float,2>{0.352714002f, 0.640848637f},
-std::array<float,2>{0.440088987f, 0.194155604f},
-std::array<float,2>{0.570729136f, 0.594307065f},
-std::array<float,2>{0.910220921f, 0.341481894f},
-std::array<float,2>{0.164261475f, 0.811611116f},
-std::array<float,2>{0.189905703f, 0.0235383157f},
-std::array<float,2>{0.989475846f, 0.746939063f},
-std::array<float,2>{0.553756356f, 0.409017622f},
-std::array<float,2>{0.42582798f, 0.888478518f},
-std::array<float,2>{0.298103482f, 0.292319506f},
-std::array<float,2>{0.668757677f, 0.816857576f},
-std::array<float,2>{0.855937302f, 0.151998356f},
-std::array<float,2>{0.0187178403f, 0.530947089f},
-std::array<float,2>{0.139488369f, 0.344161659f},
-std::array<float,2>{0.892029822f, 0.76105845f},
-std::array<float,2>{0.61521852f, 0.236721143f},
-std::array<float,2>{0.479270995f, 0.576721311f},
-std::array<float,2>{0.335650712f, 0.103477612f},
-std::array<float,2>{0.693423331f, 0.658614695f},
-std::array<float,2>{0.7796942f, 0.488605589f},
-std::array<float,2>{0.0737754777f, 0.941072881f},
-std::array<float,2>{0.0596335419f, 0.163363889f},
-std::array<float,2>{0.826435864f, 0.556367099f},
-std::array<float,2>{0.653402448f, 0.263528198f},
-std::array<float,2>{0.264972746f, 0.844820142f},
-std::array<float,2>{0.38312608f, 0.389316827f},
-std::array<float,2>{0.51296562f, 0.929369569f},
-std::array<float,2>{0.967618823f, 0.0594254695f},
-std::array<float,2>{0.232027471f, 0.690296352f},
-std::array<float,2>{0.163463131f, 0.496433824f},
-std::array<float,2>{0.914693594f, 0.946173072f},
-std::array<float,2>{0.568435967f, 0.0996471643f},
-std::array<float,2>{0.446569681f, 0.668925762f},
-std::array<float,2>{0.347707778f, 0.244537428f},
-std::array<float,2>{0.736752689f, 0.569775462f},
-std::array<float,2>{0.805395544f, 0.356187761f},
-std::array<float,2>{0.122536838f, 0.753255546f},
-std::array<float,2>{0.0235362481f, 0.048218336f},
-std::array<float,2>{0.844180763f, 0.697070599f},
-std::array<float,2>{0.661469698f, 0.37571317f},
-std::array<float,2>{0.306047261f, 0.933269203f},
-std::array<float,2>{0.435664028f, 0.251814395f},
-std::array<float,2>{0.555940211f, 0.852596104f},
-std::array<float,2>{0.99825424f, 0.170327038f},
-std::array<float,2>{0.197058022f, 0.553224504f},
-std::array<float,2>{0.0637061745f, 0.330054402f},
-std::array<float,2>{0.771371067f, 0.804031789f},
-std::array<float,2>{0.701628804f, 0.197903678f},
-std::array<float,2>{0.342332989f, 0.608865201f},
-std::array<float,2>{0.469646841f, 0.0926978067f},
-std::array<float,2>{0.617928028f, 0.649818838f},
-std::array<float,2>{0.90492022f, 0.457664579f},
-std::array<float,2>{0.126151308f, 0.995193541f},
-std::array<float,2>{0.224377364f, 0.142500475f},
-std::array<float,2>{0.95586592f, 0.51717931f},
-std::array<float,2>{0.504829705f, 0.287457615f},
-std::array<float,2>{0.378098845f, 0.825964391f},
-std::array<float,2>{0.254126757f, 0.419661671f},
-std::array<float,2>{0.642629266f, 0.878660858f},
-std::array<float,2>{0.819943488f, 0.0220060833f},
-std::array<float,2>{0.0545207076f, 0.736871839f},
-std::array<float,2>{0.0320377871f, 0.404529512f},
-std::array<float,2>{0.84374392f, 0.906416357f},
-std::array<float,2>{0.633652449f, 0.0414197184f},
-std::array<float,2>{0.267852694f, 0.711879611f},
-std::array<float,2>{0.403900415f, 0.182445854f},
-std::array<float,2>{0.526179433f, 0.532587111f},
-std::array<float,2>{0.947998047f, 0.279980034f},
-std::array<float,2>{0.242136687f, 0.874530733f},
-std::array<float,2>{0.155790582f, 0.11586117f},
-std::array<float,2>{0.880668819f, 0.677384734f},
-std::array<float,2>{0.605505109f, 0.469869435f},
-std::array<float,2>{0.486879259f, 0.96760875f},
-std::array<float,2>{0.313944966f, 0.373274833f},
-std::array<float,2>{0.703417361f, 0.765945971f},
-std::array<float,2>{0.751271427f, 0.226594374f},
-std::array<float,2>{0.0928201079f, 0.584076703f},
-std::array<float,2>{0.213440433f, 0.308419526f},
-std::array<float,2>{0.983071566f, 0.828508615f},
-std::array<float,2>{0.543412149f, 0.135275185f},
-std::array<float,2>{0.414238393f, 0.505009234f},
-std::array<float,2>{0.288628668f, 0.0138068469f},
-std::array<float,2>{0.6829198f, 0.731741667f},
-std::array<float,2>{0.866431713f, 0.435849398f},
-std::array<float,2>{0.00723118288f, 0.904948831f},
-std::array<float,2>{0.104901634f, 0.21833092f},
-std::array<float,2>{0.790662229f, 0.623883307f},
-std::array<float,2>{0.720501304f, 0.317870826f},
-std::array<float,2>{0.361730307f, 0.783182263f},
-std::array<float,2>{0.462465167f, 0.447279304f},
-std::array<float,2>{0.585052311f, 0.972668886f},
-std::array<float,2>{0.933527946f, 0.0631965995f},
-std::array<float,2>{0.180639818f, 0.635335147f},
-std::array<float,2>{0.178190365f, 0.416508615f},
-std::array<float,2>{0.925413847f, 0.88073498f},
-std::array<float,2>{0.58983165f, 0.0172685012f},
-std::array<float,2>{0.457869917f, 0.7415573f},
-std::array<float,2>{0.371673852f, 0.146955252f},
-std::array<float,2>{0.731634021f, 0.521621168f},
-std::array<float,2>{0.786598742f, 0.284843326f},
-std::array<float,2>{0.0969881192f, 0.820708811f},
-std::array<float,2>{0.00828339998f, 0.0860435963f},
-std::array<float,2>{0.867369294f, 0.655065835f},
-std::array<float,2>{0.67616421f, 0.453595728f},
-std::array<float,2>{0.28959474f, 0.996303439f},
-std::array<float,2>{0.410268635f, 0.333187938f},
-std::array<float,2>{0.532775879f, 0.800254107f},
-std::array<float,2>{0.971742511f, 0.200507149f},
-std::array<float,2>{0.20941624f, 0.602177382f},
-std::array<float,2>{0.0830283239f, 0.257203251f},
-std::array<float,2>{0.761779904f, 0.85887301f},
-std::array<float,2>{0.714307845f, 0.167635173f},
-std::array<float,2>{0.325794041f, 0.550770164f},
-std::array<float,2>{0.496923089f, 0.0511613078f},
-std::array<float,2>{0.597751379f, 0.701874971f},
-std::array<float,2>{0.889598668f, 0.380853713f},
-std::array<float,2>{0.141031042f, 0.936244607f},
-std::array<float,2>{0.246550456f, 0.248883024f},
-std::array<float,2>{0.941749215f, 0.565550983f},
-std::array<float,2>{0.519586921f, 0.35276556f},
-std::array<float,2>{0.397980362f, 0.75605303f},
-std::array<float,2>{0.274821818f, 0.492704004f},
-std::array<float,2>{0.629554749f, 0.951212764f},
-std::array<float,2>{0.833297133f, 0.0945727527f},
-std::array<float,2>{0.0414539166f, 0.664300442f},
-std::array<float,2>{0.0564950258f, 0.449561089f},
-std::array<float,2>{0.820985258f, 0.96985656f},
-std::array<float,2>{0.650825322f, 0.0678827986f},
-std::array<float,2>{0.260123461f, 0.637035191f},
-std::array<float,2>{0.388537139f, 0.213955015f},
-std::array<float,2>{0.507986367f, 0.617960751f},
-std::array<float,2>{0.962593079f, 0.314754218f},
-std::array<float,2>{0.22677508f, 0.786052346f},
-std::array<float,2>{0.133159295f, 0.0110497894f},
-std::array<float,2>{0.896157682f, 0.72917825f},
-std::array<float,2>{0.609710753f, 0.432958633f},
-std::array<float,2>{0.483396798f, 0.901923656f},
-std::array<float,2>{0.329420418f, 0.311322957f},
-std::array<float,2>{0.689675391f, 0.832308292f},
-std::array<float,2>{0.777138948f, 0.138253793f},
-std::array<float,2>{0.0767428726f, 0.502007604f},
-std::array<float,2>{0.194990695f, 0.37046203f},
-std::array<float,2>{0.985231459f, 0.773309231f},
-std::array<float,2>{0.550243735f, 0.230850041f},
-std::array<float,2>{0.424609125f, 0.578390002f},
-std::array<float,2>{0.30251509f, 0.11232774f},
-std::array<float,2>{0.66750294f, 0.675189137f},
-std::array<float,2>{0.853588521f, 0.473816842f},
-std::array<float,2>{0.0196199194f, 0.962884367f},
-std::array<float,2>{0.10964708f, 0.186385587f},
-std::array<float,2>{0.799625039f, 0.536566257f},
-std::array<float,2>{0.749789655f, 0.275230616f},
-std::array<float,2>{0.357192785f, 0.87058121f},
-std::array<float,2>{0.443769187f, 0.399287909f},
-std::array<float,2>{0.575058997f, 0.913966656f},
-std::array<float,2>{0.909858346f, 0.0449326821f},
-std::array<float,2>{0.169126749f, 0.715704679f},
-std::array<float,2>{0.221873686f, 0.477765083f},
-std::array<float,2>{0.957157314f, 0.960599303f},
-std::array<float,2>{0.502392888f, 0.121904723f},
-std::array<float,2>{0.382596463f, 0.682922602f},
-std::array<float,2>{0.251166821f, 0.222955659f},
-std::array<float,2>{0.646474123f, 0.58764714f},
-std::array<float,2>{0.813412726f, 0.361468524f},
-std::array<float,2>{0.0487775207f, 0.773882985f},
-std::array<float,2>{0.0693085268f, 0.0354315415f},
-std::array<float,2>{0.76711899f, 0.710100412f},
-std::array<float,2>{0.698863864f, 0.393783778f},
-std::array<float,2>{0.336158603f, 0.917190254f},
-std::array<float,2>{0.47388944f, 0.271010399f},
-std::array<float,2>{0.621389985f, 0.859604537f},
-std::array<float,2>{0.900187314f, 0.179177359f},
-std::array<float,2>{0.130771205f, 0.542879999f},
-std::array<float,2>{0.0301496349f, 0.325282365f},
-std::array<float,2>{0.850829542f, 0.792102814f},
-std::array<float,2>{0.657049716f, 0.204816192f},
-std::array<float,2>{0.311199278f, 0.611029565f},
-std::array<float,2>{0.430192202f, 0.0750560537f},
-std::array<float,2>{0.559502959f, 0.630103767f},
-std::array<float,2>{0.996079326f, 0.444513619f},
-std::array<float,2>{0.202034429f, 0.978630602f},
-std::array<float,2>{0.156416863f, 0.130614758f},
-std::array<float,2>{0.919203222f, 0.510673702f},
-std::array<float,2>{0.562537968f, 0.300994158f},
-std::array<float,2>{0.45139274f, 0.84360069f},
-std::array<float,2>{0.34405154f, 0.425710469f},
-std::array<float,2>{0.740688026f, 0.892077982f},
-std::array<float,2>{0.80893141f, 0.00736868242f},
-std::array<float,2>{0.117838182f, 0.720611513f},
-std::array<float,2>{0.10779646f, 0.382860184f},
-std::array<float,2>{0.795482576f, 0.923578203f},
-std::array<float,2>{0.72642076f, 0.0563890897f},
-std::array<float,2>{0.365191162f, 0.692844927f},
-std::array<float,2>{0.467629522f, 0.158001244f},
-std::array<float,2>{0.579934537f, 0.560484231f},
-std::array<float,2>{0.935298741f, 0.258549362f},
-std::array<float,2>{0.185322165f, 0.848897696f},
-std::array<float,2>{0.216338962f, 0.109152347f},
-std::array<float,2>{0.979653597f, 0.663323283f},
-std::array<float,2>{0.539546907f, 0.484652072f},
-std::array<float,2>{0.41946432f, 0.942779064f},
-std::array<float,2>{0.284051895f, 0.349802375f},
-std::array<float,2>{0.685791254f, 0.761982381f},
-std::array<float,2>{0.859535933f, 0.240915254f},
-std::array<float,2>{0.000448613457f, 0.572831273f},
-std::array<float,2>{0.151220962f, 0.296801031f},
-std::array<float,2>{0.877616465f, 0.813371122f},
-std::array<float,2>{0.604365408f, 0.155257776f},
-std::array<float,2>{0.491012514f, 0.525169969f},
-std::array<float,2>{0.319475263f, 0.0287149176f},
-std::array<float,2>{0.710373521f, 0.745648742f},
-std::array<float,2>{0.753957689f, 0.411598593f},
-std::array<float,2>{0.0881844983f, 0.884559155f},
-std::array<float,2>{0.0356338471f, 0.187676013f},
-std::array<float,2>{0.836031258f, 0.601266742f},
-std::array<float,2>{0.63800472f, 0.337482721f},
-std::array<float,2>{0.271149307f, 0.805129707f},
-std::array<float,2>{0.401566833f, 0.461740077f},
-std::array<float,2>{0.530660033f, 0.990891993f},
-std::array<float,2>{0.953002751f, 0.0836967304f},
-std::array<float,2>{0.234829605f, 0.645676672f},
-std::array<float,2>{0.206275418f, 0.396634519f},
-std::array<float,2>{0.974569976f, 0.921340048f},
-std::array<float,2>{0.535841227f, 0.0316308327f},
-std::array<float,2>{0.409406513f, 0.705729306f},
-std::array<float,2>{0.295057982f, 0.174555734f},
-std::array<float,2>{0.672394931f, 0.543166041f},
-std::array<float,2>{0.87478143f, 0.265959144f},
-std::array<float,2>{0.0123432335f, 0.864149034f},
-std::array<float,2>{0.0982493013f, 0.118184291f},
-std::array<float,2>{0.782090724f, 0.683748841f},
-std::array<float,2>{0.730394185f, 0.481735647f},
-std::array<float,2>{0.370352089f, 0.953721046f},
-std::array<float,2>{0.453920066f, 0.363582492f},
-std::array<float,2>{0.591756999f, 0.781053305f},
-std::array<float,2>{0.928092897f, 0.218832806f},
-std::array<float,2>{0.175770938f, 0.591289341f},
-std::array<float,2>{0.0438797511f, 0.300253808f},
-std::array<float,2>{0.831908345f, 0.837866127f},
-std::array<float,2>{0.625361443f, 0.12889263f},
-std::array<float,2>{0.277853191f, 0.513062835f},
-std::array<float,2>{0.391308457f, 0.00365249277f},
-std::array<float,2>{0.516293526f, 0.724437833f},
-std::array<float,2>{0.940917909f, 0.428889245f},
-std::array<float,2>{0.244863823f, 0.896766365f},
-std::array<float,2>{0.145521879f, 0.208456054f},
-std::array<float,2>{0.88670069f, 0.616697669f},
-std::array<float,2>{0.597554982f, 0.323663026f},
-std::array<float,2>{0.494320363f, 0.796608388f},
-std::array<float,2>{0.32402575f, 0.438339502f},
-std::array<float,2>{0.718725383f, 0.981024325f},
-std::array<float,2>{0.761459231f, 0.071873121f},
-std::array<float,2>{0.0795451924f, 0.628709614f},
-std::array<float,2>{0.0719750375f, 0.490371764f},
-std::array<float,2>{0.777625084f, 0.938629985f},
-std::array<float,2>{0.693042457f, 0.103536904f},
-std::array<float,2>{0.333194494f, 0.657052159f},
-std::array<float,2>{0.478129864f, 0.235642821f},
-std::array<float,2>{0.616239846f, 0.575909317f},
-std::array<float,2>{0.892609119f, 0.347448468f},
-std::array<float,2>{0.138462737f, 0.759626985f},
-std::array<float,2>{0.2332405f, 0.061138995f},
-std::array<float,2>{0.965673923f, 0.688360453f},
-std::array<float,2>{0.514418244f, 0.387974173f},
-std::array<float,2>{0.384875804f, 0.926142752f},
-std::array<float,2>{0.262467712f, 0.264592648f},
-std::array<float,2>{0.656067252f, 0.845898628f},
-std::array<float,2>{0.825107813f, 0.161828443f},
-std::array<float,2>{0.0619035959f, 0.557420015f},
-std::array<float,2>{0.167144135f, 0.342426628f},
-std::array<float,2>{0.912239075f, 0.810002863f},
-std::array<float,2>{0.572509527f, 0.191611186f},
-std::array<float,2>{0.437932283f, 0.59666872f},
-std::array<float,2>{0.353834063f, 0.0809116662f},
-std::array<float,2>{0.744012177f, 0.643749774f},
-std::array<float,2>{0.801978469f, 0.465619236f},
-std::array<float,2>{0.114673868f, 0.985753179f},
-std::array<float,2>{0.0175112374f, 0.150372639f},
-std::array<float,2>{0.858174801f, 0.528973937f},
-std::array<float,2>{0.670776248f, 0.290948451f},
-std::array<float,2>{0.300170183f, 0.819657803f},
-std::array<float,2>{0.429096431f, 0.407232404f},
-std::array<float,2>{0.552643299f, 0.890388489f},
-std::array<float,2>{0.990393102f, 0.0266299993f},
-std::array<float,2>{0.188225567f, 0.748951316f},
-std::array<float,2>{0.12735863f, 0.459708601f},
-std::array<float,2>{0.903744459f, 0.993926644f},
-std::array<float,2>{0.619868457f, 0.0909629911f},
-std::array<float,2>{0.471779883f, 0.652105212f},
-std::array<float,2>{0.340790868f, 0.196252435f},
-std::array<float,2>{0.700012207f, 0.605557561f},
-std::array<float,2>{0.773437262f, 0.331771135f},
-std::array<float,2>{0.0646850392f, 0.802518725f},
-std::array<float,2>{0.0518320762f, 0.0208736658f},
-std::array<float,2>{0.817985535f, 0.735596716f},
-std::array<float,2>{0.641451299f, 0.420358479f},
-std::array<float,2>{0.256235659f, 0.875359714f},
-std::array<float,2>{0.375677556f, 0.286408573f},
-std::array<float,2>{0.506827712f, 0.826286137f},
-std::array<float,2>{0.953859508f, 0.144335926f},
-std::array<float,2>{0.225026339f, 0.517831981f},
-std::array<float,2>{0.124127693f, 0.358314633f},
-std::array<float,2>{0.806653798f, 0.75129199f},
-std::array<float,2>{0.734393775f, 0.243703485f},
-std::array<float,2>{0.351084203f, 0.567833066f},
-std::array<float,2>{0.448326677f, 0.0984913409f},
-std::array<float,2>{0.568018734f, 0.671117723f},
-std::array<float,2>{0.916640043f, 0.499041945f},
-std::array<float,2>{0.160805076f, 0.948695958f},
-std::array<float,2>{0.199018434f, 0.169697031f},
-std::array<float,2>{0.997380614f, 0.550842524f},
-std::array<float,2>{0.558535159f, 0.252909988f},
-std::array<float,2>{0.433759809f, 0.853743374f},
-std::array<float,2>{0.307076514f, 0.376968026f},
-std::array<float,2>{0.662436903f, 0.929715276f},
-std::array<float,2>{0.847137034f, 0.0502643995f},
-std::array<float,2>{0.0255152807f, 0.697534502f},
-std::array<float,2>{0.00552162714f, 0.434720933f},
-std::array<float,2>{0.863550782f, 0.904144824f},
-std::array<float,2>{0.680385172f, 0.0136316558f},
-std::array<float,2>{0.287092686f, 0.733185768f},
-std::array<float,2>{0.417097747f, 0.133016601f},
-std::array<float,2>{0.545295894f, 0.506356418f},
-std::array<float,2>{0.98174727f, 0.305457592f},
-std::array<float,2>{0.212080881f, 0.830243707f},
-std::array<float,2>{0.181669608f, 0.0657256618f},
-std::array<float,2>{0.930884004f, 0.634099185f},
-std::array<float,2>{0.58315593f, 0.446384519f},
-std::array<float,2>{0.463175595f, 0.975442171f},
-std::array<float,2>{0.359527349f, 0.319506258f},
-std::array<float,2>{0.720878363f, 0.784628808f},
-std::array<float,2>{0.791788101f, 0.215221673f},
-std::array<float,2>{0.101713665f, 0.62279284f},
-std::array<float,2>{0.23929067f, 0.277670234f},
-std::array<float,2>{0.945978999f, 0.871805429f},
-std::array<float,2>{0.525007129f, 0.179953545f},
-std::array<float,2>{0.406053007f, 0.533854783f},
-std::array<float,2>{0.265716702f, 0.0409800299f},
-std::array<float,2>{0.635402203f, 0.712962091f},
-std::array<float,2>{0.8404333f, 0.404118299f},
-std::array<float,2>{0.0333339088f, 0.909052014f},
-std::array<float,2>{0.0902724564f, 0.229551435f},
-std::array<float,2>{0.75382185f, 0.582859695f},
-std::array<float,2>{0.705776334f, 0.371654987f},
-std::array<float,2>{0.316004276f, 0.767644942f},
-std::array<float,2>{0.485984087f, 0.47234574f},
-std::array<float,2>{0.60859412f, 0.966753125f},
-std::array<float,2>{0.88132906f, 0.113327168f},
-std::array<float,2>{0.15263699f, 0.67885834f},
-std::array<float,2>{0.135362342f, 0.431659818f},
-std::array<float,2>{0.896540463f, 0.900588691f},
-std::array<float,2>{0.612462342f, 0.00986773241f},
-std::array<float,2>{0.481365383f, 0.729571581f},
-std::array<float,2>{0.331365407f, 0.13699238f},
-std::array<float,2>{0.687555909f, 0.50342536f},
-std::array<float,2>{0.774367154f, 0.311783105f},
-std::array<float,2>{0.0758934617f, 0.833636165f},
-std::array<float,2>{0.0582371652f, 0.0670606717f},
-std::array<float,2>{0.822853088f, 0.638030469f},
-std::array<float,2>{0.649490476f, 0.450331569f},
-std::array<float,2>{0.258367509f, 0.969318986f},
-std::array<float,2>{0.389764547f, 0.315535605f},
-std::array<float,2>{0.511558294f, 0.786138654f},
-std::array<float,2>{0.964187741f, 0.2130052f},
-std::array<float,2>{0.229942232f, 0.618248403f},
-std::array<float,2>{0.112042204f, 0.273786187f},
-std::array<float,2>{0.797473907f, 0.869311869f},
-std::array<float,2>{0.747335732f, 0.186945453f},
-std::array<float,2>{0.359071195f, 0.535447001f},
-std::array<float,2>{0.443335474f, 0.0466426387f},
-std::array<float,2>{0.578015089f, 0.716426194f},
-std::array<float,2>{0.908033192f, 0.399758995f},
-std::array<float,2>{0.170285568f, 0.9130795f},
-std::array<float,2>{0.192086577f, 0.231665492f},
-std::array<float,2>{0.987753093f, 0.579738557f},
-std::array<float,2>{0.548036397f, 0.370075762f},
-std::array<float,2>{0.422819376f, 0.771999478f},
-std::array<float,2>{0.303308189f, 0.473513126f},
-std::array<float,2>{0.664918959f, 0.961550772f},
-std::array<float,2>{0.852101743f, 0.111841209f},
-std::array<float,2>{0.0229256358f, 0.674604654f},
-std::array<float,2>{0.0112577369f, 0.455054939f},
-std::array<float,2>{0.870154798f, 0.997257531f},
-std::array<float,2>{0.679524243f, 0.0876773372f},
-std::array<float,2>{0.292210281f, 0.655408084f},
-std::array<float,2>{0.413280666f, 0.19921951f},
-std::array<float,2>{0.53376627f, 0.603087068f},
-std::array<float,2>{0.969314456f, 0.332270354f},
-std::array<float,2>{0.208570302f, 0.799333096f},
-std::array<float,2>{0.177375525f, 0.0157258194f},
-std::array<float,2>{0.922725737f, 0.740576088f},
-std::array<float,2>{0.586776435f, 0.417941749f},
-std::array<float,2>{0.459588498f, 0.879542589f},
-std::array<float,2>{0.373717695f, 0.283296287f},
-std::array<float,2>{0.733452141f, 0.82131207f},
-std::array<float,2>{0.788990498f, 0.14756988f},
-std::array<float,2>{0.0955111384f, 0.522501945f},
-std::array<float,2>{0.248381034f, 0.351969242f},
-std::array<float,2>{0.943383157f, 0.757599115f},
-std::array<float,2>{0.523071468f, 0.249912903f},
-std::array<float,2>{0.395286262f, 0.56491977f},
-std::array<float,2>{0.27608934f, 0.0949320793f},
-std::array<float,2>{0.631134629f, 0.665600419f},
-std::array<float,2>{0.834480822f, 0.493272692f},
-std::array<float,2>{0.0403935798f, 0.952763796f},
-std::array<float,2>{0.0850086808f, 0.166198999f},
-std::array<float,2>{0.763916135f, 0.549621582f},
-std::array<float,2>{0.712834179f, 0.256587505f},
-std::array<float,2>{0.326497257f, 0.857913435f},
-std::array<float,2>{0.499934286f, 0.379363865f},
-std::array<float,2>{0.599933267f, 0.937378049f},
-std::array<float,2>{0.886799335f, 0.0520355739f},
-std::array<float,2>{0.143267453f, 0.702653408f},
-std::array<float,2>{0.217483521f, 0.486171573f},
-std::array<float,2>{0.977606177f, 0.942300081f},
-std::array<float,2>{0.542523801f, 0.107465416f},
-std::array<float,2>{0.420515388f, 0.66254431f},
-std::array<float,2>{0.281838328f, 0.24157992f},
-std::array<float,2>{0.685141265f, 0.573460877f},
-std::array<float,2>{0.862345278f, 0.351494759f},
-std::array<float,2>{0.00260974304f, 0.762741148f},
-std::array<float,2>{0.106910326f, 0.0553855449f},
-std::array<float,2>{0.794021666f, 0.692295194f},
-std::array<float,2>{0.724500358f, 0.384091645f},
-std::array<float,2>{0.366660565f, 0.922163606f},
-std::array<float,2>{0.464956731f, 0.259205192f},
-std::array<float,2>{0.581142366f, 0.848175466f},
-std::array<float,2>{0.93748486f, 0.156862184f},
-std::array<float,2>{0.186278224f, 0.559065402f},
-std::array<float,2>{0.0383799747f, 0.336453795f},
-std::array<float,2>{0.839351058f, 0.806215703f},
-std::array<float,2>{0.63931936f, 0.18932645f},
-std::array<float,2>{0.271753699f, 0.599609792f},
-std::array<float,2>{0.399531662f, 0.0829989836f},
-std::array<float,2>{0.527745545f, 0.645176709f},
-std::array<float,2>{0.950852215f, 0.462171704f},
-std::array<float,2>{0.23708123f, 0.991380274f},
-std::array<float,2>{0.148607925f, 0.155468673f},
-std::array<float,2>{0.87519145f, 0.523889184f},
-std::array<float,2>{0.602470279f, 0.295790523f},
-std::array<float,2>{0.489427865f, 0.813987672f},
-std::array<float,2>{0.31707266f, 0.410169244f},
-std::array<float,2>{0.70800668f, 0.883667469f},
-std::array<float,2>{0.757483721f, 0.0279173329f},
-std::array<float,2>{0.0873457417f, 0.74473989f},
-std::array<float,2>{0.0678088441f, 0.393328547f},
-std::array<float,2>{0.76780045f, 0.916876376f},
-std::array<float,2>{0.695927918f, 0.036569342f},
-std::array<float,2>{0.339097172f, 0.708992958f},
-std::array<float,2>{0.475171119f, 0.178664476f},
-std::array<float,2>{0.623406053f, 0.541715622f},
-std::array<float,2>{0.902075946f, 0.26958555f},
-std::array<float,2>{0.131275594f, 0.860438645f},
-std::array<float,2>{0.219155028f, 0.122771062f},
-std::array<float,2>{0.960933626f, 0.682309449f},
-std::array<float,2>{0.501114726f, 0.477212906f},
-std::array<float,2>{0.380040705f, 0.959932029f},
-std::array<float,2>{0.252620637f, 0.362313539f},
-std::array<float,2>{0.648414493f, 0.774460733f},
-std::array<float,2>{0.814990222f, 0.223841354f},
-std::array<float,2>{0.0493266694f, 0.586145878f},
-std::array<float,2>{0.15975365f, 0.302534312f},
-std::array<float,2>{0.920153499f, 0.842190385f},
-std::array<float,2>{0.564964116f, 0.129084751f},
-std::array<float,2>{0.450414956f, 0.511699259f},
-std::array<float,2>{0.347034931f, 0.0065261554f},
-std::array<float,2>{0.739141405f, 0.7187953f},
-std::array<float,2>{0.811978042f, 0.423943073f},
-std::array<float,2>{0.120789126f, 0.890844762f},
-std::array<float,2>{0.0287526734f, 0.2040198f},
-std::array<float,2>{0.848048151f, 0.609474659f},
-std::array<float,2>{0.659389317f, 0.324562222f},
-std::array<float,2>{0.310241878f, 0.791406214f},
-std::array<float,2>{0.432795346f, 0.443463564f},
-std::array<float,2>{0.56067878f, 0.979511917f},
-std::array<float,2>{0.993194938f, 0.0755185634f},
-std::array<float,2>{0.200478345f, 0.629689157f},
-std::array<float,2>{0.230669469f, 0.387017131f},
-std::array<float,2>{0.968151033f, 0.927311599f},
-std::array<float,2>{0.512279153f, 0.0618381463f},
-std::array<float,2>{0.384647429f, 0.689152062f},
-std::array<float,2>{0.264279157f, 0.160715744f},
-std::array<float,2>{0.652682304f, 0.558093607f},
-std::array<float,2>{0.827459276f, 0.264797807f},
-std::array<float,2>{0.058975853f, 0.846723318f},
-std::array<float,2>{0.0726391673f, 0.105035327f},
-std::array<float,2>{0.780399144f, 0.65780282f},
-std::array<float,2>{0.694949031f, 0.491241962f},
-std::array<float,2>{0.334610999f, 0.938458622f},
-std::array<float,2>{0.480318785f, 0.34571442f},
-std::array<float,2>{0.613850296f, 0.758396089f},
-std::array<float,2>{0.891195059f, 0.235005349f},
-std::array<float,2>{0.140470058f, 0.574941874f},
-std::array<float,2>{0.0179707631f, 0.289225072f},
-std::array<float,2>{0.856469154f, 0.81842339f},
-std::array<float,2>{0.66903162f, 0.14879021f},
-std::array<float,2>{0.297602385f, 0.52792865f},
-std::array<float,2>{0.427015007f, 0.0258582793f},
-std::array<float,2>{0.553584099f, 0.749212921f},
-std::array<float,2>{0.989136279f, 0.406817645f},
-std::array<float,2>{0.190474153f, 0.889403224f},
-std::array<float,2>{0.165724337f, 0.192536667f},
-std::array<float,2>{0.911887944f, 0.596879601f},
-std::array<float,2>{0.571562946f, 0.342868418f},
-std::array<float,2>{0.440757006f, 0.808794081f},
-std::array<float,2>{0.352473915f, 0.46649605f},
-std::array<float,2>{0.74503839f, 0.984439254f},
-std::array<float,2>{0.804485559f, 0.0815317258f},
-std::array<float,2>{0.1158197f, 0.643368125f},
-std::array<float,2>{0.100389943f, 0.480588168f},
-std::array<float,2>{0.783892274f, 0.954660773f},
-std::array<float,2>{0.727163434f, 0.11787682f},
-std::array<float,2>{0.368323624f, 0.685384154f},
-std::array<float,2>{0.455607206f, 0.219770268f},
-std::array<float,2>{0.591976821f, 0.590048075f},
-std::array<float,2>{0.926438689f, 0.364703268f},
-std::array<float,2>{0.173034728f, 0.78019172f},
-std::array<float,2>{0.20456633f, 0.0326541811f},
-std::array<float,2>{0.976236343f, 0.706069827f},
-std::array<float,2>{0.537497342f, 0.397952586f},
-std::array<float,2>{0.407370925f, 0.920414329f},
-std::array<float,2>{0.293274075f, 0.266737878f},
-std::array<float,2>{0.674308002f, 0.864844501f},
-std::array<float,2>{0.872668087f, 0.174911097f},
-std::array<float,2>{0.0148263602f, 0.544546008f},
-std::array<float,2>{0.147019655f, 0.322478503f},
-std::array<float,2>{0.884675741f, 0.79534775f},
-std::array<float,2>{0.594409108f, 0.207551241f},
-std::array<float,2>{0.493350536f, 0.615620732f},
-std::array<float,2>{0.320486605f, 0.0704135522f},
-std::array<float,2>{0.715676725f, 0.627029717f},
-std::array<float,2>{0.759655297f, 0.439053565f},
-std::array<float,2>{0.081999667f, 0.981656075f},
-std::array<float,2>{0.0453092754f, 0.127420381f},
-std::array<float,2>{0.828626633f, 0.512644768f},
-std::array<float,2>{0.627065599f, 0.299005687f},
-std::array<float,2>{0.279845536f, 0.836075723f},
-std::array<float,2>{0.394116908f, 0.428182513f},
-std::array<float,2>{0.518310905f, 0.897572696f},
-std::array<float,2>{0.937621832f, 0.00258172629f},
-std::array<float,2>{0.244096383f, 0.723530173f},
-std::array<float,2>{0.181410745f, 0.445353031f},
-std::array<float,2>{0.931877375f, 0.976530373f},
-std::array<float,2>{0.584881127f, 0.0646263957f},
-std::array<float,2>{0.461463004f, 0.633782685f},
-std::array<float,2>{0.362887084f, 0.216351226f},
-std::array<float,2>{0.718865216f, 0.621695876f},
-std::array<float,2>{0.789436936f, 0.318516999f},
-std::array<float,2>{0.103594482f, 0.784083486f},
-std::array<float,2>{0.00649323361f, 0.0124669466f},
-std::array<float,2>{0.865581155f, 0.734194696f},
-std::array<float,2>{0.681849778f, 0.434120208f},
-std::array<float,2>{0.287595451f, 0.903007805f},
-std::array<float,2>{0.415333629f, 0.305770725f},
-std::array<float,2>{0.544409096f, 0.831777871f},
-std::array<float,2>{0.984031081f, 0.134479403f},
-std::array<float,2>{0.214042172f, 0.507456243f},
-std::array<float,2>{0.0923071057f, 0.372918487f},
-std::array<float,2>{0.750961542f, 0.76901406f},
-std::array<float,2>{0.704474866f, 0.229026869f},
-std::array<float,2>{0.313161194f, 0.583175004f},
-std::array<float,2>{0.487719387f, 0.115080908f},
-std::array<float,2>{0.606507301f, 0.677860856f},
-std::array<float,2>{0.879098117f, 0.471186996f},
-std::array<float,2>{0.154784858f, 0.965654492f},
-std::array<float,2>{0.240505695f, 0.181264505f},
-std::array<float,2>{0.948404849f, 0.534360349f},
-std::array<float,2>{0.527063966f, 0.278604209f},
-std::array<float,2>{0.402425081f, 0.873004019f},
-std::array<float,2>{0.269000918f, 0.402910292f},
-std::array<float,2>{0.634305716f, 0.909601152f},
-std::array<float,2>{0.842390418f, 0.0392741375f},
-std::array<float,2>{0.0323192403f, 0.714710474f},
-std::array<float,2>{0.0535679571f, 0.421235651f},
-std::array<float,2>{0.818929315f, 0.875984609f},
-std::array<float,2>{0.644015014f, 0.0196317472f},
-std::array<float,2>{0.255002975f, 0.735119522f},
-std::array<float,2>{0.377441853f, 0.143263757f},
-std::array<float,2>{0.505320966f, 0.518678904f},
-std::array<float,2>{0.956546664f, 0.285223991f},
-std::array<float,2>{0.222806886f, 0.827425897f},
-std::array<float,2>{0.125912637f, 0.0907252207f},
-std::array<float,2>{0.905783832f, 0.650484145f},
-std::array<float,2>{0.619111955f, 0.460021287f},
-std::array<float,2>{0.470007271f, 0.992238522f},
-std::array<float,2>{0.343533576f, 0.330996126f},
-std::array<float,2>{0.702643216f, 0.801525056f},
-std::array<float,2>{0.770353138f, 0.19703044f},
-std::array<float,2>{0.062637724f, 0.606676161f},
-std::array<float,2>{0.195974305f, 0.253022134f},
-std::array<float,2>{0.999463737f, 0.854915261f},
-std::array<float,2>{0.555418074f, 0.168888286f},
-std::array<float,2>{0.437496036f, 0.552144945f},
-std::array<float,2>{0.305362701f, 0.0488416515f},
-std::array<float,2>{0.660787463f, 0.698245823f},
-std::array<float,2>{0.845329285f, 0.378304541f},
-std::array<float,2>{0.0250150952f, 0.931296647f},
-std::array<float,2>{0.121451139f, 0.243022934f},
-std::array<float,2>{0.805791497f, 0.566481173f},
-std::array<float,2>{0.738267362f, 0.359044611f},
-std::array<float,2>{0.349035978f, 0.750266135f},
-std::array<float,2>{0.445521683f, 0.498858809f},
-std::array<float,2>{0.57011354f, 0.9479568f},
-std::array<float,2>{0.915902317f, 0.0991879478f},
-std::array<float,2>{0.1627215f, 0.670419931f},
-std::array<float,2>{0.168232292f, 0.40188399f},
-std::array<float,2>{0.908557415f, 0.911127985f},
-std::array<float,2>{0.575432718f, 0.0443954542f},
-std::array<float,2>{0.444527656f, 0.717616022f},
-std::array<float,2>{0.355510741f, 0.183612645f},
-std::array<float,2>{0.748181522f, 0.537276566f},
-std::array<float,2>{0.800734401f, 0.276994556f},
-std::array<float,2>{0.110810645f, 0.867222607f},
-std::array<float,2>{0.0206828974f, 0.110862277f},
-std::array<float,2>{0.85449928f, 0.671988845f},
-std::array<float,2>{0.666106641f, 0.475044429f},
-std::array<float,2>{0.301514179f, 0.96459353f},
-std::array<float,2>{0.42571032f, 0.367543817f},
-std::array<float,2>{0.549703598f, 0.770512879f},
-std::array<float,2>{0.985752285f, 0.233775631f},
-std::array<float,2>{0.194239378f, 0.581047773f},
-std::array<float,2>{0.0780675337f, 0.309935361f},
-std::array<float,2>{0.775855124f, 0.835042238f},
-std::array<float,2>{0.690866411f, 0.138829261f},
-std::array<float,2>{0.328158021f, 0.501868308f},
-std::array<float,2>{0.484089077f, 0.00950361509f},
-std::array<float,2>{0.610981822f, 0.727494061f},
-std::array<float,2>{0.894538105f, 0.430931181f},
-std::array<float,2>{0.134111404f, 0.899984837f},
-std::array<float,2>{0.228196934f, 0.212554112f},
-std::array<float,2>{0.961696565f, 0.619449079f},
-std::array<float,2>{0.508858681f, 0.312917858f},
-std::array<float,2>{0.387622416f, 0.787953138f},
-std::array<float,2>{0.26122734f, 0.451937854f},
-std::array<float,2>{0.652036965f, 0.972491741f},
-std::array<float,2>{0.821884274f, 0.0688268915f},
-std::array<float,2>{0.0552357957f, 0.640486956f},
-std::array<float,2>{0.0423139483f, 0.494742334f},
-std::array<float,2>{0.832556427f, 0.950650752f},
-std::array<float,2>{0.630304217f, 0.0971384123f},
-std::array<float,2>{0.273527086f, 0.667511284f},
-std::array<float,2>{0.397382498f, 0.246988073f},
-std::array<float,2>{0.520708919f, 0.564335585f},
-std::array<float,2>{0.942477286f, 0.35428077f},
-std::array<float,2>{0.248041704f, 0.754877627f},
-std::array<float,2>{0.142239347f, 0.0546574928f},
-std::array<float,2>{0.889802456f, 0.701157391f},
-std::array<float,2>{0.599452138f, 0.382698417f},
-std::array<float,2>{0.49730286f, 0.935137868f},
-std::array<float,2>{0.324707896f, 0.254115015f},
-std::array<float,2>{0.713387549f, 0.855963886f},
-std::array<float,2>{0.763023138f, 0.165250659f},
-std::array<float,2>{0.082917586f, 0.547799051f},
-std::array<float,2>{0.210317805f, 0.335512847f},
-std::array<float,2>{0.970945895f, 0.797045469f},
-std::array<float,2>{0.531321168f, 0.202714831f},
-std::array<float,2>{0.411825508f, 0.603770673f},
-std::array<float,2>{0.290470362f, 0.0878963843f},
-std::array<float,2>{0.677386105f, 0.652979553f},
-std::array<float,2>{0.868877232f, 0.455756873f},
-std::array<float,2>{0.00900514517f, 0.998241007f},
-std::array<float,2>{0.0962223932f, 0.14474234f},
-std::array<float,2>{0.785687089f, 0.520639956f},
-std::array<float,2>{0.731310844f, 0.282286674f},
-std::array<float,2>{0.372562438f, 0.823504806f},
-std::array<float,2>{0.458962888f, 0.415598989f},
-std::array<float,2>{0.588455975f, 0.881044567f},
-std::array<float,2>{0.92439872f, 0.017673796f},
-std::array<float,2>{0.178911716f, 0.738284349f},
-std::array<float,2>{0.235632986f, 0.464014739f},
-std::array<float,2>{0.951338172f, 0.989175379f},
-std::array<float,2>{0.529622972f, 0.0852291584f},
-std::array<float,2>{0.400728941f, 0.646663666f},
-std::array<float,2>{0.269621193f, 0.190152735f},
-std::array<float,2>{0.636852026f, 0.597830474f},
-std::array<float,2>{0.837075531f, 0.337902188f},
-std::array<float,2>{0.0361498892f, 0.807857811f},
-std::array<float,2>{0.089507781f, 0.0297615342f},
-std::array<float,2>{0.755172968f, 0.743158281f},
-std::array<float,2>{0.709115028f, 0.412407696f},
-std::array<float,2>{0.319170505f, 0.884961486f},
-std::array<float,2>{0.491947055f, 0.292986751f},
-std::array<float,2>{0.60458833f, 0.815686882f},
-std::array<float,2>{0.878857493f, 0.153575897f},
-std::array<float,2>{0.1515847f, 0.526501656f},
-std::array<float,2>{0.00152793003f, 0.348867148f},
-std::array<float,2>{0.861227751f, 0.764903665f},
-std::array<float,2>{0.686661363f, 0.239844948f},
-std::array<float,2>{0.284507245f, 0.571752071f},
-std::array<float,2>{0.417981088f, 0.106162012f},
-std::array<float,2>{0.540328383f, 0.662038505f},
-std::array<float,2>{0.979156137f, 0.487452656f},
-std::array<float,2>{0.215357453f, 0.945305645f},
-std::array<float,2>{0.184505686f, 0.15967752f},
-std::array<float,2>{0.933996737f, 0.561560333f},
-std::array<float,2>{0.578585565f, 0.261416346f},
-std::array<float,2>{0.468253106f, 0.849663377f},
-std::array<float,2>{0.363732278f, 0.385625064f},
-std::array<float,2>{0.725568712f, 0.925100803f},
-std::array<float,2>{0.796666145f, 0.0575114861f},
-std::array<float,2>{0.108533934f, 0.694384992f},
-std::array<float,2>{0.118346386f, 0.422623575f},
-std::array<float,2>{0.81009239f, 0.893247902f},
-std::array<float,2>{0.741280675f, 0.00408825511f},
-std::array<float,2>{0.345488161f, 0.720932424f},
-std::array<float,2>{0.453081876f, 0.13162002f},
-std::array<float,2>{0.563488543f, 0.508026898f},
-std::array<float,2>{0.918188751f, 0.303760171f},
-std::array<float,2>{0.157737017f, 0.841142774f},
-std::array<float,2>{0.202942431f, 0.0764361918f},
-std::array<float,2>{0.994503677f, 0.632149518f},
-std::array<float,2>{0.560155809f, 0.443117529f},
-std::array<float,2>{0.430924088f, 0.976616144f},
-std::array<float,2>{0.311826319f, 0.326627314f},
-std::array<float,2>{0.65732491f, 0.790549159f},
-std::array<float,2>{0.85011977f, 0.206016317f},
-std::array<float,2>{0.0310814045f, 0.611546218f},
-std::array<float,2>{0.129589632f, 0.273391515f},
-std::array<float,2>{0.899215996f, 0.861711979f},
-std::array<float,2>{0.622388601f, 0.175820261f},
-std::array<float,2>{0.473622322f, 0.540307164f},
-std::array<float,2>{0.337038666f, 0.0375749357f},
-std::array<float,2>{0.698181689f, 0.707383215f},
-std::array<float,2>{0.766512692f, 0.390965879f},
-std::array<float,2>{0.0697099045f, 0.915993094f},
-std::array<float,2>{0.047190696f, 0.225800335f},
-std::array<float,2>{0.813722908f, 0.588480592f},
-std::array<float,2>{0.644833028f, 0.360959738f},
-std::array<float,2>{0.250008851f, 0.776825905f},
-std::array<float,2>{0.381136537f, 0.478585333f},
-std::array<float,2>{0.503200233f, 0.957103908f},
-std::array<float,2>{0.958727121f, 0.123707213f},
-std::array<float,2>{0.220955968f, 0.680960417f},
-std::array<float,2>{0.188671902f, 0.410148144f},
-std::array<float,2>{0.991388381f, 0.887063086f},
-std::array<float,2>{0.551620543f, 0.0246614162f},
-std::array<float,2>{0.428337544f, 0.747846186f},
-std::array<float,2>{0.299599171f, 0.151366115f},
-std::array<float,2>{0.670929849f, 0.529909253f},
-std::array<float,2>{0.859161675f, 0.291894764f},
-std::array<float,2>{0.016166782f, 0.817515671f},
-std::array<float,2>{0.114026345f, 0.0782962888f},
-std::array<float,2>{0.801488876f, 0.642257273f},
-std::array<float,2>{0.74269408f, 0.467496246f},
-std::array<float,2>{0.354718387f, 0.987331092f},
-std::array<float,2>{0.43919605f, 0.340230972f},
-std::array<float,2>{0.573596001f, 0.81138438f},
-std::array<float,2>{0.913160026f, 0.194781467f},
-std::array<float,2>{0.166398421f, 0.594930053f},
-std::array<float,2>{0.0609285869f, 0.262002259f},
-std::array<float,2>{0.825707853f, 0.84376055f},
-std::array<float,2>{0.654425025f, 0.162743866f},
-std::array<float,2>{0.262785435f, 0.555536926f},
-std::array<float,2>{0.386119157f, 0.0602830015f},
-std::array<float,2>{0.515320718f, 0.690751374f},
-std::array<float,2>{0.966502964f, 0.390059948f},
-std::array<float,2>{0.233583882f, 0.928538501f},
-std::array<float,2>{0.137611315f, 0.237508103f},
-std::array<float,2>{0.893744648f, 0.57776618f},
-std::array<float,2>{0.615468919f, 0.345620871f},
-std::array<float,2>{0.476567894f, 0.760615468f},
-std::array<float,2>{0.332418829f, 0.489321947f},
-std::array<float,2>{0.69169271f, 0.939872384f},
-std::array<float,2>{0.778603733f, 0.10162501f},
-std::array<float,2>{0.0710111335f, 0.66012466f},
-std::array<float,2>{0.0784761384f, 0.44004643f},
-std::array<float,2>{0.759797812f, 0.983141959f},
-std::array<float,2>{0.716916561f, 0.073426798f},
-std::array<float,2>{0.322480679f, 0.626136422f},
-std::array<float,2>{0.495283186f, 0.210015163f},
-std::array<float,2>{0.59636873f, 0.61504364f},
-std::array<float,2>{0.885518968f, 0.321722925f},
-std::array<float,2>{0.144734204f, 0.794759214f},
-std::array<float,2>{0.246036202f, 0.000975493342f},
-std::array<float,2>{0.939788997f, 0.725857735f},
-std::array<float,2>{0.517266929f, 0.427541375f},
-std::array<float,2>{0.392334491f, 0.895117223f},
-std::array<float,2>{0.278647423f, 0.296888411f},
-std::array<float,2>{0.626090109f, 0.838221014f},
-std::array<float,2>{0.831038415f, 0.126682654f},
-std::array<float,2>{0.0439711474f, 0.514123738f},
-std::array<float,2>{0.174204379f, 0.367169082f},
-std::array<float,2>{0.928744674f, 0.777672231f},
-std::array<float,2>{0.590467632f, 0.221123293f},
-std::array<float,2>{0.454684049f, 0.591985404f},
-std::array<float,2>{0.369323343f, 0.119332224f},
-std::array<float,2>{0.729437232f, 0.685821533f},
-std::array<float,2>{0.782275319f, 0.484236211f},
-std::array<float,2>{0.0986658186f, 0.95696485f},
-std::array<float,2>{0.0136606423f, 0.172258779f},
-std::array<float,2>{0.873760343f, 0.54581058f},
-std::array<float,2>{0.673769474f, 0.268782675f},
-std::array<float,2>{0.296390682f, 0.865348101f},
-std::array<float,2>{0.408487767f, 0.39469856f},
-std::array<float,2>{0.536277115f, 0.91990453f},
-std::array<float,2>{0.973415792f, 0.034530215f},
-std::array<float,2>{0.205488116f, 0.70354563f},
-std::array<float,2>{0.153500065f, 0.469600976f},
-std::array<float,2>{0.882761836f, 0.968611419f},
-std::array<float,2>{0.607719421f, 0.116354749f},
-std::array<float,2>{0.484425575f, 0.676667869f},
-std::array<float,2>{0.314862579f, 0.228042349f},
-std::array<float,2>{0.706300795f, 0.58582896f},
-std::array<float,2>{0.752639294f, 0.374070108f},
-std::array<float,2>{0.0911061019f, 0.766932607f},
-std::array<float,2>{0.0343779847f, 0.042350132f},
-std::array<float,2>{0.841218174f, 0.712466657f},
-std::array<float,2>{0.63619864f, 0.406028599f},
-std::array<float,2>{0.267497033f, 0.908133805f},
-std::array<float,2>{0.404836506f, 0.280992955f},
-std::array<float,2>{0.524284482f, 0.873149633f},
-std::array<float,2>{0.946428001f, 0.183440372f},
-std::array<float,2>{0.239120498f, 0.531614542f},
-std::array<float,2>{0.103085361f, 0.316800833f},
-std::array<float,2>{0.792491972f, 0.781434059f},
-std::array<float,2>{0.722014189f, 0.217393592f},
-std::array<float,2>{0.361302614f, 0.624302447f},
-std::array<float,2>{0.464413315f, 0.0643478036f},
-std::array<float,2>{0.582253337f, 0.636345267f},
-std::array<float,2>{0.930344105f, 0.448537856f},
-std::array<float,2>{0.183518738f, 0.973763108f},
-std::array<float,2>{0.210969999f, 0.135806248f},
-std::array<float,2>{0.980703831f, 0.504423499f},
-std::array<float,2>{0.546192527f, 0.306762993f},
-std::array<float,2>{0.416457444f, 0.82935667f},
-std::array<float,2>{0.285211176f, 0.437284738f},
-std::array<float,2>{0.680999279f, 0.905707777f},
-std::array<float,2>{0.864337564f, 0.014812598f},
-std::array<float,2>{0.00393773383f, 0.730592728f},
-std::array<float,2>{0.0265616551f, 0.376932532f},
-std::array<float,2>{0.846106052f, 0.931932926f},
-std::array<float,2>{0.663117826f, 0.0476065762f},
-std::array<float,2>{0.307756335f, 0.695751846f},
-std::array<float,2>{0.434674025f, 0.171713069f},
-std::array<float,2>{0.556744099f, 0.554250181f},
-std::array<float,2>{0.996533215f, 0.250401467f},
-std::array<float,2>{0.197626695f, 0.851871312f},
-std::array<float,2>{0.161796153f, 0.10132996f},
-std::array<float,2>{0.917621553f, 0.669461906f},
-std::array<float,2>{0.56654495f, 0.497108281f},
-std::array<float,2>{0.447798193f, 0.947171569f},
-std::array<float,2>{0.349985719f, 0.356684834f},
-std::array<float,2>{0.735433221f, 0.752117276f},
-std::array<float,2>{0.80780381f, 0.245915428f},
-std::array<float,2>{0.123232521f, 0.568611681f},
-std::array<float,2>{0.226090819f, 0.288769722f},
-std::array<float,2>{0.954548001f, 0.824794948f},
-std::array<float,2>{0.507546067f, 0.141512215f},
-std::array<float,2>{0.376240134f, 0.515853226f},
-std::array<float,2>{0.257338732f, 0.0230211802f},
-std::array<float,2>{0.642539322f, 0.738197625f},
-std::array<float,2>{0.817299068f, 0.417990804f},
-std::array<float,2>{0.0509281904f, 0.87766403f},
-std::array<float,2>{0.066102162f, 0.198383674f},
-std::array<float,2>{0.771817029f, 0.608251691f},
-std::array<float,2>{0.700215399f, 0.328474551f},
-std::array<float,2>{0.341477334f, 0.803098798f},
-std::array<float,2>{0.47095111f, 0.45875749f},
-std::array<float,2>{0.620743334f, 0.994228661f},
-std::array<float,2>{0.902754784f, 0.0936876982f},
-std::array<float,2>{0.128428817f, 0.64879626f},
-std::array<float,2>{0.131778508f, 0.391490847f},
-std::array<float,2>{0.901819408f, 0.915406764f},
-std::array<float,2>{0.623800039f, 0.0380226895f},
-std::array<float,2>{0.474849582f, 0.707547665f},
-std::array<float,2>{0.339582652f, 0.176483512f},
-std::array<float,2>{0.695355415f, 0.540584564f},
-std::array<float,2>{0.768105268f, 0.272947907f},
-std::array<float,2>{0.0682449266f, 0.862027705f},
-std::array<float,2>{0.0492650494f, 0.123431265f},
-std::array<float,2>{0.814923704f, 0.681450069f},
-std::array<float,2>{0.647889972f, 0.479457468f},
-std::array<float,2>{0.252016276f, 0.95768702f},
-std::array<float,2>{0.380836368f, 0.360512912f},
-std::array<float,2>{0.501534641f, 0.776949883f},
-std::array<float,2>{0.960060954f, 0.226377651f},
-std::array<float,2>{0.219662562f, 0.588013172f},
-std::array<float,2>{0.120166108f, 0.304379255f},
-std::array<float,2>{0.812298298f, 0.84159714f},
-std::array<float,2>{0.738346219f, 0.130909562f},
-std::array<float,2>{0.347473919f, 0.50866735f},
-std::array<float,2>{0.45074302f, 0.0047584381f},
-std::array<float,2>{0.564700603f, 0.721595883f},
-std::array<float,2>{0.920603514f, 0.422288924f},
-std::array<float,2>{0.159450546f, 0.892717898f},
-std::array<float,2>{0.200953439f, 0.205225855f},
-std::array<float,2>{0.993990064f, 0.612099588f},
-std::array<float,2>{0.561200261f, 0.326937467f},
-std::array<float,2>{0.433398753f, 0.790063739f},
-std::array<float,2>{0.309608966f, 0.442496717f},
-std::array<float,2>{0.659682989f, 0.977140009f},
-std::array<float,2>{0.848247409f, 0.0768585131f},
-std::array<float,2>{0.0292063374f, 0.63252604f},
-std::array<float,2>{0.00210159901f, 0.487814546f},
-std::array<float,2>{0.863187492f, 0.944773018f},
-std::array<float,2>{0.684979916f, 0.105796501f},
-std::array<float,2>{0.281562477f, 0.661351562f},
-std::array<float,2>{0.420341134f, 0.239492998f},
-std::array<float,2>{0.542419612f, 0.572238684f},
-std::array<float,2>{0.97826767f, 0.349430174f},
-std::array<float,2>{0.217089862f, 0.765199304f},
-std::array<float,2>{0.185804948f, 0.0569399111f},
-std::array<float,2>{0.936934531f, 0.695094705f},
-std::array<float,2>{0.581597984f, 0.385207713f},
-std::array<float,2>{0.465370923f, 0.925502539f},
-std::array<float,2>{0.366770327f, 0.260772407f},
-std::array<float,2>{0.723854959f, 0.850236773f},
-std::array<float,2>{0.794873595f, 0.159330189f},
-std::array<float,2>{0.107196413f, 0.562179029f},
-std::array<float,2>{0.236623451f, 0.338649988f},
-std::array<float,2>{0.950671852f, 0.808225751f},
-std::array<float,2>{0.527883828f, 0.189815357f},
-std::array<float,2>{0.399943262f, 0.598486364f},
-std::array<float,2>{0.272043645f, 0.0859292671f},
-std::array<float,2>{0.639113188f, 0.6474424f},
-std::array<float,2>{0.839586735f, 0.46447444f},
-std::array<float,2>{0.0386095382f, 0.988388956f},
-std::array<float,2>{0.0875726268f, 0.154056415f},
-std::array<float,2>{0.757021189f, 0.527329087f},
-std::array<float,2>{0.707152843f, 0.293558061f},
-std::array<float,2>{0.316796422f, 0.816132665f},
-std::array<float,2>{0.489980459f, 0.41267857f},
-std::array<float,2>{0.601605415f, 0.885401607f},
-std::array<float,2>{0.875907004f, 0.0298941974f},
-std::array<float,2>{0.149106443f, 0.742422521f},
-std::array<float,2>{0.20848605f, 0.455258667f},
-std::array<float,2>{0.968907773f, 0.998822451f},
-std::array<float,2>{0.53325808f, 0.0886576846f},
-std::array<float,2>{0.413844794f, 0.652786553f},
-std::array<float,2>{0.292692423f, 0.202399313f},
-std::array<float,2>{0.67908299f, 0.604456902f},
-std::array<float,2>{0.870756745f, 0.335298181f},
-std::array<float,2>{0.0111932671f, 0.79776597f},
-std::array<float,2>{0.0950023532f, 0.0182899702f},
-std::array<float,2>{0.788161755f, 0.73881042f},
-std::array<float,2>{0.734227896f, 0.415173084f},
-std::array<float,2>{0.373506606f, 0.881751716f},
-std::array<float,2>{0.459307611f, 0.283147842f},
-std::array<float,2>{0.586087584f, 0.823931456f},
-std::array<float,2>{0.92195642f, 0.145048812f},
-std::array<float,2>{0.177078128f, 0.521364808f},
-std::array<float,2>{0.0408173278f, 0.353739083f},
-std::array<float,2>{0.834152102f, 0.75423336f},
-std::array<float,2>{0.631500602f, 0.246497005f},
-std::array<float,2>{0.275436491f, 0.563797414f},
-std::array<float,2>{0.394699931f, 0.0972782895f},
-std::array<float,2>{0.522603691f, 0.667036831f},
-std::array<float,2>{0.944082916f, 0.494499058f},
-std::array<float,2>{0.248934641f, 0.951009631f},
-std::array<float,2>{0.142587662f, 0.165761411f},
-std::array<float,2>{0.887520432f, 0.547016263f},
-std::array<float,2>{0.600395083f, 0.254804164f},
-std::array<float,2>{0.499205559f, 0.855914533f},
-std::array<float,2>{0.326755166f, 0.382040799f},
-std::array<float,2>{0.712013841f, 0.93471992f},
-std::array<float,2>{0.764247298f, 0.0540413447f},
-std::array<float,2>{0.0855901763f, 0.700516284f},
-std::array<float,2>{0.0754980072f, 0.4312931f},
-std::array<float,2>{0.773598135f, 0.899432182f},
-std::array<float,2>{0.688425541f, 0.00898214336f},
-std::array<float,2>{0.331697851f, 0.726909876f},
-std::array<float,2>{0.480792761f, 0.139372796f},
-std::array<float,2>{0.613097727f, 0.501299858f},
-std::array<float,2>{0.897349358f, 0.310428143f},
-std::array<float,2>{0.135179296f, 0.835911274f},
-std::array<float,2>{0.23027876f, 0.0690211803f},
-std::array<float,2>{0.964449823f, 0.640080512f},
-std::array<float,2>{0.511202335f, 0.451597124f},
-std::array<float,2>{0.390559256f, 0.97199595f},
-std::array<float,2>{0.257848591f, 0.31305632f},
-std::array<float,2>{0.65038228f, 0.787417114f},
-std::array<float,2>{0.822366118f, 0.212222815f},
-std::array<float,2>{0.0577765964f, 0.619908571f},
-std::array<float,2>{0.170525819f, 0.276719272f},
-std::array<float,2>{0.907269776f, 0.867799163f},
-std::array<float,2>{0.57736516f, 0.18425338f},
-std::array<float,2>{0.442747265f, 0.537804663f},
-std::array<float,2>{0.35861513f, 0.044888474f},
-std::array<float,2>{0.747999966f, 0.716831148f},
-std::array<float,2>{0.796954334f, 0.401762873f},
-std::array<float,2>{0.11147213f, 0.910636246f},
-std::array<float,2>{0.0231112894f, 0.234310314f},
-std::array<float,2>{0.851714969f, 0.580447614f},
-std::array<float,2>{0.664113879f, 0.367951393f},
-std::array<float,2>{0.302835047f, 0.771291494f},
-std::array<float,2>{0.421946585f, 0.475463271f},
-std::array<float,2>{0.548732758f, 0.964218318f},
-std::array<float,2>{0.988202929f, 0.110561483f},
-std::array<float,2>{0.191884488f, 0.67249465f},
-std::array<float,2>{0.223261178f, 0.418685198f},
-std::array<float,2>{0.956269383f, 0.877274632f},
-std::array<float,2>{0.505764544f, 0.0228718426f},
-std::array<float,2>{0.377187341f, 0.737536609f},
-std::array<float,2>{0.255436301f, 0.140734002f},
-std::array<float,2>{0.64445889f, 0.516120017f},
-std::array<float,2>{0.818610609f, 0.288490206f},
-std::array<float,2>{0.0529010631f, 0.824273169f},
-std::array<float,2>{0.0631437153f, 0.0928219333f},
-std::array<float,2>{0.769566178f, 0.649087369f},
-std::array<float,2>{0.702286005f, 0.458052605f},
-std::array<float,2>{0.343260914f, 0.995113194f},
-std::array<float,2>{0.470563829f, 0.328844368f},
-std::array<float,2>{0.618588209f, 0.803576827f},
-std::array<float,2>{0.905757189f, 0.198983237f},
-std::array<float,2>{0.125213712f, 0.607830763f},
-std::array<float,2>{0.0244793128f, 0.250697017f},
-std::array<float,2>{0.845016062f, 0.85229528f},
-std::array<float,2>{0.660454333f, 0.171175092f},
-std::array<float,2>{0.304729402f, 0.554080188f},
-std::array<float,2>{0.436780244f, 0.0472825579f},
-std::array<float,2>{0.555077493f, 0.695995867f},
-std::array<float,2>{0.999534607f, 0.376408547f},
-std::array<float,2>{0.195702732f, 0.932378352f},
-std::array<float,2>{0.162460551f, 0.24526991f},
-std::array<float,2>{0.915355563f, 0.569326341f},
-std::array<float,2>{0.569687068f, 0.35706228f},
-std::array<float,2>{0.446090013f, 0.752479434f},
-std::array<float,2>{0.349172682f, 0.497952104f},
-std::array<float,2>{0.737415135f, 0.946506977f},
-std::array<float,2>{0.806350112f, 0.100809544f},
-std::array<float,2>{0.121587373f, 0.669029117f},
-std::array<float,2>{0.10445188f, 0.448858708f},
-std::array<float,2>{0.789927244f, 0.974272847f},
-std::array<float,2>{0.71964252f, 0.0638105869f},
-std::array<float,2>{0.362436801f, 0.635856152f},
-std::array<float,2>{0.461404055f, 0.217190951f},
-std::array<float,2>{0.58444798f, 0.624983668f},
-std::array<float,2>{0.932388186f, 0.316987038f},
-std::array<float,2>{0.181012735f, 0.782122612f},
-std::array<float,2>{0.214500889f, 0.0152941383f},
-std::array<float,2>{0.983868241f, 0.731329322f},
-std::array<float,2>{0.544478238f, 0.437010705f},
-std::array<float,2>{0.41591841f, 0.905824542f},
-std::array<float,2>{0.287929207f, 0.30722481f},
-std::array<float,2>{0.682578743f, 0.830035031f},
-std::array<float,2>{0.865878999f, 0.136707798f},
-std::array<float,2>{0.00594570069f, 0.504140794f},
-std::array<float,2>{0.154811531f, 0.374910742f},
-std::array<float,2>{0.87940675f, 0.767147779f},
-std::array<float,2>{0.607332945f, 0.227623537f},
-std::array<float,2>{0.487901866f, 0.585164666f},
-std::array<float,2>{0.312735379f, 0.117081493f},
-std::array<float,2>{0.704751074f, 0.675894558f},
-std::array<float,2>{0.750258267f, 0.469088078f},
-std::array<float,2>{0.0921484306f, 0.968012631f},
-std::array<float,2>{0.0330746584f, 0.182941139f},
-std::array<float,2>{0.841808915f, 0.531764448f},
-std::array<float,2>{0.633981049f, 0.280490667f},
-std::array<float,2>{0.269351423f, 0.873618305f},
-std::array<float,2>{0.403003335f, 0.40563339f},
-std::array<float,2>{0.526832044f, 0.907305658f},
-std::array<float,2>{0.949082553f, 0.0424865074f},
-std::array<float,2>{0.24073258f, 0.71213758f},
-std::array<float,2>{0.173666954f, 0.483424813f},
-std::array<float,2>{0.925996721f, 0.956375241f},
-std::array<float,2>{0.592320502f, 0.119634703f},
-std::array<float,2>{0.455093801f, 0.686200678f},
-std::array<float,2>{0.368950993f, 0.221258163f},
-std::array<float,2>{0.726938248f, 0.592441082f},
-std::array<float,2>{0.783321559f, 0.366335034f},
-std::array<float,2>{0.0997957215f, 0.777870357f},
-std::array<float,2>{0.0154759083f, 0.0348489843f},
-std::array<float,2>{0.872161448f, 0.703636646f},
-std::array<float,2>{0.674763262f, 0.395019531f},
-std::array<float,2>{0.293571949f, 0.919177771f},
-std::array<float,2>{0.408053249f, 0.269043893f},
-std::array<float,2>{0.537873328f, 0.866122246f},
-std::array<float,2>{0.976009905f, 0.172685504f},
-std::array<float,2>{0.204859465f, 0.544971108f},
-std::array<float,2>{0.0812546909f, 0.321787447f},
-std::array<float,2>{0.758950055f, 0.794128358f},
-std::array<float,2>{0.715269327f, 0.210934326f},
-std::array<float,2>{0.321228176f, 0.614620447f},
-std::array<float,2>{0.493829459f, 0.0738974065f},
-std::array<float,2>{0.594041228f, 0.626708746f},
-std::array<float,2>{0.884215593f, 0.439456552f},
-std::array<float,2>{0.14654772f, 0.982857704f},
-std::array<float,2>{0.243446335f, 0.126094043f},
-std::array<float,2>{0.937991738f, 0.514533937f},
-std::array<float,2>{0.51790005f, 0.297483355f},
-std::array<float,2>{0.393566608f, 0.838684082f},
-std::array<float,2>{0.279343933f, 0.426868796f},
-std::array<float,2>{0.627662599f, 0.894796729f},
-std::array<float,2>{0.828210294f, 0.000388066313f},
-std::array<float,2>{0.0457779616f, 0.726556182f},
-std::array<float,2>{0.0593549646f, 0.390344769f},
-std::array<float,2>{0.827778339f, 0.928219199f},
-std::array<float,2>{0.65301007f, 0.0599889755f},
-std::array<float,2>{0.263879448f, 0.691386044f},
-std::array<float,2>{0.384026766f, 0.162169516f},
-std::array<float,2>{0.511954606f, 0.555030644f},
-std::array<float,2>{0.968607545f, 0.262256056f},
-std::array<float,2>{0.231022909f, 0.84471339f},
-std::array<float,2>{0.139810398f, 0.102367282f},
-std::array<float,2>{0.891061783f, 0.65932256f},
-std::array<float,2>{0.613636255f, 0.489758134f},
-std::array<float,2>{0.479541302f, 0.940236449f},
-std::array<float,2>{0.334360421f, 0.344898224f},
-std::array<float,2>{0.694751441f, 0.759953618f},
-std::array<float,2>{0.780810356f, 0.237828285f},
-std::array<float,2>{0.0731035173f, 0.57754451f},
-std::array<float,2>{0.19139792f, 0.29103446f},
-std::array<float,2>{0.988755763f, 0.817949176f},
-std::array<float,2>{0.553047538f, 0.15084821f},
-std::array<float,2>{0.427354395f, 0.529774308f},
-std::array<float,2>{0.297347754f, 0.0250010863f},
-std::array<float,2>{0.669901609f, 0.747092485f},
-std::array<float,2>{0.857110977f, 0.409297168f},
-std::array<float,2>{0.0184503011f, 0.887224972f},
-std::array<float,2>{0.115517199f, 0.195142195f},
-std::array<float,2>{0.804146469f, 0.59562856f},
-std::array<float,2>{0.744622707f, 0.340479434f},
-std::array<float,2>{0.351782829f, 0.81083107f},
-std::array<float,2>{0.441194475f, 0.467234284f},
-std::array<float,2>{0.572012424f, 0.987801075f},
-std::array<float,2>{0.911198735f, 0.0787723809f},
-std::array<float,2>{0.165182278f, 0.64202565f},
-std::array<float,2>{0.15724282f, 0.424681544f},
-std::array<float,2>{0.918832302f, 0.89114356f},
-std::array<float,2>{0.564006865f, 0.00612162054f},
-std::array<float,2>{0.452234179f, 0.719495952f},
-std::array<float,2>{0.345056593f, 0.129780754f},
-std::array<float,2>{0.74195528f, 0.510934472f},
-std::array<float,2>{0.810047209f, 0.302212507f},
-std::array<float,2>{0.119071789f, 0.842692137f},
-std::array<float,2>{0.0303174816f, 0.0760660544f},
-std::array<float,2>{0.849726021f, 0.629355907f},
-std::array<float,2>{0.657818437f, 0.443972439f},
-std::array<float,2>{0.312203884f, 0.980074763f},
-std::array<float,2>{0.431517065f, 0.324894398f},
-std::array<float,2>{0.559993923f, 0.791569233f},
-std::array<float,2>{0.994735658f, 0.20346424f},
-std::array<float,2>{0.202584788f, 0.60991776f},
-std::array<float,2>{0.0700160041f, 0.270404309f},
-std::array<float,2>{0.765643954f, 0.860887766f},
-std::array<float,2>{0.697405994f, 0.178110585f},
-std::array<float,2>{0.337741554f, 0.541324377f},
-std::array<float,2>{0.47294569f, 0.0370597281f},
-std::array<float,2>{0.623034179f, 0.709848464f},
-std::array<float,2>{0.898742735f, 0.392648995f},
-std::array<float,2>{0.128961876f, 0.916104913f},
-std::array<float,2>{0.221563607f, 0.224263862f},
-std::array<float,2>{0.958473861f, 0.586755037f},
-std::array<float,2>{0.503855765f, 0.363170654f},
-std::array<float,2>{0.38157782f, 0.775219798f},
-std::array<float,2>{0.250668347f, 0.476669639f},
-std::array<float,2>{0.645317316f, 0.959269822f},
-std::array<float,2>{0.813995242f, 0.122278914f},
-std::array<float,2>{0.0477296486f, 0.68165344f},
-std::array<float,2>{0.0369130932f, 0.462459236f},
-std::array<float,2>{0.837581873f, 0.992088795f},
-std::array<float,2>{0.637687266f, 0.0824315771f},
-std::array<float,2>{0.270142883f, 0.644630075f},
-std::array<float,2>{0.401062965f, 0.188743547f},
-std::array<float,2>{0.529821515f, 0.600545704f},
-std::array<float,2>{0.951749086f, 0.336291999f},
-std::array<float,2>{0.236016631f, 0.805903733f},
-std::array<float,2>{0.151933089f, 0.0273887571f},
-std::array<float,2>{0.87798351f, 0.744562149f},
-std::array<float,2>{0.605316639f, 0.410686582f},
-std::array<float,2>{0.491348773f, 0.883078337f},
-std::array<float,2>{0.318496197f, 0.295307875f},
-std::array<float,2>{0.709668577f, 0.813793182f},
-std::array<float,2>{0.755853653f, 0.155869946f},
-std::array<float,2>{0.0893118903f, 0.524269283f},
-std::array<float,2>{0.215054795f, 0.350972056f},
-std::array<float,2>{0.97888273f, 0.76356411f},
-std::array<float,2>{0.540719569f, 0.242001623f},
-std::array<float,2>{0.418821454f, 0.573734641f},
-std::array<float,2>{0.284750074f, 0.107917242f},
-std::array<float,2>{0.687276721f, 0.662830293f},
-std::array<float,2>{0.86060065f, 0.485460371f},
-std::array<float,2>{0.00102555403f, 0.941667974f},
-std::array<float,2>{0.10893064f, 0.156307563f},
-std::array<float,2>{0.796062529f, 0.559149086f},
-std::array<float,2>{0.725025952f, 0.259281248f},
-std::array<float,2>{0.364185959f, 0.847704351f},
-std::array<float,2>{0.468432367f, 0.384388179f},
-std::array<float,2>{0.578689039f, 0.922577798f},
-std::array<float,2>{0.934417069f, 0.055054199f},
-std::array<float,2>{0.183780879f, 0.691486418f},
-std::array<float,2>{0.247268572f, 0.49367699f},
-std::array<float,2>{0.943203032f, 0.952578068f},
-std::array<float,2>{0.52134198f, 0.0954570994f},
-std::array<float,2>{0.396739364f, 0.665284157f},
-std::array<float,2>{0.274382651f, 0.24927783f},
-std::array<float,2>{0.630436718f, 0.564942181f},
-std::array<float,2>{0.832422197f, 0.352405876f},
-std::array<float,2>{0.0427348651f, 0.756878197f},
-std::array<float,2>{0.0822521374f, 0.0524183176f},
-std::array<float,2>{0.763251007f, 0.702248573f},
-std::array<float,2>{0.713052571f, 0.379772842f},
-std::array<float,2>{0.324647784f, 0.936871469f},
-std::array<float,2>{0.497767717f, 0.25632894f},
-std::array<float,2>{0.598934472f, 0.857457101f},
-std::array<float,2>{0.890153646f, 0.166926384f},
-std::array<float,2>{0.142086834f, 0.548895657f},
-std::array<float,2>{0.00964188017f, 0.332963973f},
-std::array<float,2>{0.868522346f, 0.79894197f},
-std::array<float,2>{0.6769104f, 0.200173259f},
-std::array<float,2>{0.290851563f, 0.602854729f},
-std::array<float,2>{0.411335498f, 0.0872230008f},
-std::array<float,2>{0.532033622f, 0.65594393f},
-std::array<float,2>{0.971206486f, 0.454125792f},
-std::array<float,2>{0.210807294f, 0.997785389f},
-std::array<float,2>{0.179462373f, 0.14823994f},
-std::array<float,2>{0.923922539f, 0.52329427f},
-std::array<float,2>{0.588204801f, 0.283963084f},
-std::array<float,2>{0.458056688f, 0.822049975f},
-std::array<float,2>{0.372385383f, 0.417232633f},
-std::array<float,2>{0.730731487f, 0.879167974f},
-std::array<float,2>{0.785423219f, 0.0162268765f},
-std::array<float,2>{0.0958026052f, 0.741122007f},
-std::array<float,2>{0.111078776f, 0.400015652f},
-std::array<float,2>{0.799998283f, 0.91251868f},
-std::array<float,2>{0.748765469f, 0.0460806563f},
-std::array<float,2>{0.356311351f, 0.715928376f},
-std::array<float,2>{0.445054501f, 0.187177345f},
-std::array<float,2>{0.575770795f, 0.535764575f},
-std::array<float,2>{0.908866882f, 0.274293721f},
-std::array<float,2>{0.168744102f, 0.869865537f},
-std::array<float,2>{0.193464145f, 0.111426368f},
-std::array<float,2>{0.986006975f, 0.673854351f},
-std::array<float,2>{0.549249172f, 0.472946465f},
-std::array<float,2>{0.42495802f, 0.960955143f},
-std::array<float,2>{0.300856501f, 0.369286746f},
-std::array<float,2>{0.666967571f, 0.771565795f},
-std::array<float,2>{0.855266809f, 0.23223348f},
-std::array<float,2>{0.0210773107f, 0.579458058f},
-std::array<float,2>{0.134346768f, 0.312113225f},
-std::array<float,2>{0.895371258f, 0.833485603f},
-std::array<float,2>{0.610708833f, 0.137595296f},
-std::array<float,2>{0.483471572f, 0.503065765f},
-std::array<float,2>{0.329011947f, 0.0106371371f},
-std::array<float,2>{0.691143453f, 0.730233133f},
-std::array<float,2>{0.775929809f, 0.4322851f},
-std::array<float,2>{0.0775815621f, 0.900983036f},
-std::array<float,2>{0.054859262f, 0.213859886f},
-std::array<float,2>{0.821426809f, 0.619077682f},
-std::array<float,2>{0.651632667f, 0.316230804f},
-std::array<float,2>{0.261675686f, 0.786878407f},
-std::array<float,2>{0.386814564f, 0.450884372f},
-std::array<float,2>{0.509329855f, 0.968856752f},
-std::array<float,2>{0.961093366f, 0.0668429211f},
-std::array<float,2>{0.228020608f, 0.638283908f},
-std::array<float,2>{0.197939768f, 0.378533572f},
-std::array<float,2>{0.996932149f, 0.930702448f},
-std::array<float,2>{0.557484448f, 0.0497272611f},
-std::array<float,2>{0.435246259f, 0.698830962f},
-std::array<float,2>{0.308211178f, 0.168358475f},
-std::array<float,2>{0.66377908f, 0.552420616f},
-std::array<float,2>{0.846293151f, 0.253755391f},
-std::array<float,2>{0.0269988645f, 0.855413139f},
-std::array<float,2>{0.123672113f, 0.0986910015f},
-std::array<float,2>{0.808499038f, 0.669967532f},
-std::array<float,2>{0.73617667f, 0.498253852f},
-std::array<float,2>{0.350216031f, 0.947577536f},
-std::array<float,2>{0.447356075f, 0.358880401f},
-std::array<float,2>{0.56696862f, 0.750879288f},
-std::array<float,2>{0.917433202f, 0.242519274f},
-std::array<float,2>{0.161380231f, 0.566903353f},
-std::array<float,2>{0.0516129173f, 0.285691082f},
-std::array<float,2>{0.8168571f, 0.827877283f},
-std::array<float,2>{0.64195466f, 0.142681301f},
-std::array<float,2>{0.256913513f, 0.519244909f},
-std::array<float,2>{0.376770288f, 0.0203377809f},
-std::array<float,2>{0.507147193f, 0.734551132f},
-std::array<float,2>{0.954878449f, 0.421765387f},
-std::array<float,2>{0.225951388f, 0.876565635f},
-std::array<float,2>{0.128408223f, 0.196442544f},
-std::array<float,2>{0.903017104f, 0.607007325f},
-std::array<float,2>{0.620469332f, 0.33012104f},
-std::array<float,2>{0.471414208f, 0.801139534f},
-std::array<float,2>{0.341029733f, 0.460589349f},
-std::array<float,2>{0.700850844f, 0.993010163f},
-std::array<float,2>{0.772278011f, 0.0899189115f},
-std::array<float,2>{0.0654930696f, 0.650894105f},
-std::array<float,2>{0.0915701985f, 0.471589446f},
-std::array<float,2>{0.752084136f, 0.965331435f},
-std::array<float,2>{0.707003355f, 0.114462733f},
-std::array<float,2>{0.315275282f, 0.678340793f},
-std::array<float,2>{0.48490569f, 0.228804782f},
-std::array<float,2>{0.607956111f, 0.58377254f},
-std::array<float,2>{0.881918848f, 0.372123539f},
-std::array<float,2>{0.15390043f, 0.769465625f},
-std::array<float,2>{0.238439217f, 0.03974602f},
-std::array<float,2>{0.946916401f, 0.713918328f},
-std::array<float,2>{0.523701906f, 0.402477771f},
-std::array<float,2>{0.404718131f, 0.91008991f},
-std::array<float,2>{0.266773731f, 0.278883129f},
-std::array<float,2>{0.636710465f, 0.87211442f},
-std::array<float,2>{0.841577888f, 0.181136757f},
-std::array<float,2>{0.0349426456f, 0.534957469f},
-std::array<float,2>{0.182756558f, 0.319215059f},
-std::array<float,2>{0.930007219f, 0.783631444f},
-std::array<float,2>{0.582823455f, 0.215991706f},
-std::array<float,2>{0.464206845f, 0.621181607f},
-std::array<float,2>{0.360803127f, 0.065148212f},
-std::array<float,2>{0.722430468f, 0.633247018f},
-std::array<float,2>{0.792149782f, 0.445953935f},
-std::array<float,2>{0.102999426f, 0.97560519f},
-std::array<float,2>{0.0045675938f, 0.134239197f},
-std::array<float,2>{0.864879608f, 0.507001281f},
-std::array<float,2>{0.681548834f, 0.306358516f},
-std::array<float,2>{0.285817921f, 0.831156373f},
-std::array<float,2>{0.41655159f, 0.43381989f},
-std::array<float,2>{0.546489894f, 0.902384937f},
-std::array<float,2>{0.981136918f, 0.0121041872f},
-std::array<float,2>{0.211476967f, 0.7334162f},
-std::array<float,2>{0.145219415f, 0.438490003f},
-std::array<float,2>{0.884941638f, 0.982281148f},
-std::array<float,2>{0.596072376f, 0.0708301514f},
-std::array<float,2>{0.4960379f, 0.627730131f},
-std::array<float,2>{0.323176503f, 0.207129762f},
-std::array<float,2>{0.717591166f, 0.615767717f},
-std::array<float,2>{0.760444343f, 0.32293874f},
-std::array<float,2>{0.0787019134f, 0.795498252f},
-std::array<float,2>{0.044793535f, 0.00201048702f},
-std::array<float,2>{0.830378532f, 0.722658515f},
-std::array<float,2>{0.626560211f, 0.42855677f},
-std::array<float,2>{0.278924674f, 0.898192823f},
-std::array<float,2>{0.392053097f, 0.299528688f},
-std::array<float,2>{0.516799212f, 0.836478055f},
-std::array<float,2>{0.940192938f, 0.127623603f},
-std::array<float,2>{0.245589942f, 0.512168348f},
-std::array<float,2>{0.0993516296f, 0.365144342f},
-std::array<float,2>{0.782999754f, 0.779466867f},
-std::array<float,2>{0.728818417f, 0.22065407f},
-std::array<float,2>{0.369840056f, 0.590736866f},
-std::array<float,2>{0.454568535f, 0.117224224f},
-std::array<float,2>{0.590151787f, 0.684803426f},
-std::array<float,2>{0.929684997f, 0.481330246f},
-std::array<float,2>{0.174337596f, 0.954117477f},
-std::array<float,2>{0.205853447f, 0.175688475f},
-std::array<float,2>{0.973036647f, 0.544374883f},
-std::array<float,2>{0.53676033f, 0.267220259f},
-std::array<float,2>{0.408995509f, 0.864736915f},
-std::array<float,2>{0.296014786f, 0.397540718f},
-std::array<float,2>{0.673221231f, 0.919993043f},
-std::array<float,2>{0.873112798f, 0.032921046f},
-std::array<float,2>{0.0128674321f, 0.706848621f},
-std::array<float,2>{0.015873868f, 0.406562299f},
-std::array<float,2>{0.858610928f, 0.889126241f},
-std::array<float,2>{0.671417594f, 0.0260778274f},
-std::array<float,2>{0.298988432f, 0.749833584f},
-std::array<float,2>{0.428049594f, 0.149257287f},
-std::array<float,2>{0.551138461f, 0.527508259f},
-std::array<float,2>{0.991783857f, 0.289955884f},
-std::array<float,2>{0.189323068f, 0.819042444f},
-std::array<float,2>{0.166740954f, 0.0819772333f},
-std::array<float,2>{0.913601875f, 0.642622471f},
-std::array<float,2>{0.57377404f, 0.466133177f},
-std::array<float,2>{0.438710392f, 0.985262036f},
-std::array<float,2>{0.355371475f, 0.34354049f},
-std::array<float,2>{0.742539287f, 0.80926609f},
-std::array<float,2>{0.801027298f, 0.19323045f},
-std::array<float,2>{0.113334127f, 0.597558796f},
-std::array<float,2>{0.234103695f, 0.265160084f},
-std::array<float,2>{0.966240168f, 0.847493827f},
-std::array<float,2>{0.514968932f, 0.160302565f},
-std::array<float,2>{0.386262447f, 0.558554351f},
-std::array<float,2>{0.263575643f, 0.0623667948f},
-std::array<float,2>{0.655177653f, 0.688540995f},
-std::array<float,2>{0.82533896f, 0.387454331f},
-std::array<float,2>{0.0611304715f, 0.927068889f},
-std::array<float,2>{0.0707881153f, 0.234780774f},
-std::array<float,2>{0.778866768f, 0.574543893f},
-std::array<float,2>{0.691937625f, 0.346302509f},
-std::array<float,2>{0.332887322f, 0.758114398f},
-std::array<float,2>{0.477197111f, 0.492129385f},
-std::array<float,2>{0.615814269f, 0.937968731f},
-std::array<float,2>{0.894341469f, 0.10493809f},
-std::array<float,2>{0.137067512f, 0.657653689f},
-std::array<float,2>{0.149417669f, 0.411741048f},
-std::array<float,2>{0.87610358f, 0.884147465f},
-std::array<float,2>{0.602811933f, 0.0291387886f},
-std::array<float,2>{0.48885563f, 0.745577931f},
-std::array<float,2>{0.318037689f, 0.154760033f},
-std::array<float,2>{0.708646178f, 0.524487495f},
-std::array<float,2>{0.755998552f, 0.295944005f},
-std::array<float,2>{0.0859992206f, 0.812983274f},
-std::array<float,2>{0.037653476f, 0.0833574831f},
-std::array<float,2>{0.838039577f, 0.646091402f},
-std::array<float,2>{0.639703989f, 0.461215049f},
-std::array<float,2>{0.272741735f, 0.990605593f},
-std::array<float,2>{0.39866811f, 0.336927891f},
-std::array<float,2>{0.528528154f, 0.805312574f},
-std::array<float,2>{0.949955225f, 0.188015446f},
-std::array<float,2>{0.237851396f, 0.600781381f},
-std::array<float,2>{0.106303379f, 0.257995337f},
-std::array<float,2>{0.793577373f, 0.849197209f},
-std::array<float,2>{0.723162949f, 0.157300234f},
-std::array<float,2>{0.365616947f, 0.55971539f},
-std::array<float,2>{0.466330022f, 0.0557481535f},
-std::array<float,2>{0.580187321f, 0.69318217f},
-std::array<float,2>{0.935904026f, 0.383749068f},
-std::array<float,2>{0.186717331f, 0.923049092f},
-std::array<float,2>{0.217892513f, 0.240386531f},
-std::array<float,2>{0.976776183f, 0.572438478f},
-std::array<float,2>{0.541450202f, 0.350582808f},
-std::array<float,2>{0.421700209f, 0.762660384f},
-std::array<float,2>{0.282705814f, 0.485255092f},
-std::array<float,2>{0.683781683f, 0.942877471f},
-std::array<float,2>{0.861566067f, 0.108716808f},
-std::array<float,2>{0.00338187767f, 0.663775206f},
-std::array<float,2>{0.0276508927f, 0.445175976f},
-std::array<float,2>{0.848667085f, 0.979295611f},
-std::array<float,2>{0.658663809f, 0.0742809251f},
-std::array<float,2>{0.30951941f, 0.630385935f},
-std::array<float,2>{0.432124406f, 0.204190105f},
-std::array<float,2>{0.562378287f, 0.610624254f},
-std::array<float,2>{0.992680728f, 0.325724572f},
-std::array<float,2>{0.199620739f, 0.792487442f},
-std::array<float,2>{0.158337325f, 0.00717869541f},
-std::array<float,2>{0.921569705f, 0.719978631f},
-std::array<float,2>{0.565466583f, 0.425050855f},
-std::array<float,2>{0.449990392f, 0.892269373f},
-std::array<float,2>{0.346444756f, 0.301648736f},
-std::array<float,2>{0.739907205f, 0.842802346f},
-std::array<float,2>{0.810734928f, 0.130024925f},
-std::array<float,2>{0.119707726f, 0.510026991f},
-std::array<float,2>{0.220221236f, 0.361899674f},
-std::array<float,2>{0.959304333f, 0.774092317f},
-std::array<float,2>{0.500190616f, 0.223391876f},
-std::array<float,2>{0.379652739f, 0.587364018f},
-std::array<float,2>{0.253601223f, 0.121289179f},
-std::array<float,2>{0.646888375f, 0.683392048f},
-std::array<float,2>{0.815838635f, 0.478454232f},
-std::array<float,2>{0.0507006645f, 0.960297644f},
-std::array<float,2>{0.0672648773f, 0.179300755f},
-std::array<float,2>{0.769116461f, 0.542168736f},
-std::array<float,2>{0.696605027f, 0.270579606f},
-std::array<float,2>{0.338099509f, 0.86032331f},
-std::array<float,2>{0.475859642f, 0.394519895f},
-std::array<float,2>{0.62495923f, 0.917492449f},
-std::array<float,2>{0.900489986f, 0.0358065367f},
-std::array<float,2>{0.132407621f, 0.710813403f},
-std::array<float,2>{0.193175033f, 0.474559873f},
-std::array<float,2>{0.987107396f, 0.962133169f},
-std::array<float,2>{0.547605574f, 0.112960242f},
-std::array<float,2>{0.423375219f, 0.675711572f},
-std::array<float,2>{0.303969681f, 0.231424853f},
-std::array<float,2>{0.665600121f, 0.578844965f},
-std::array<float,2>{0.853218138f, 0.370671064f},
-std::array<float,2>{0.0221250467f, 0.77271843f},
-std::array<float,2>{0.112335838f, 0.0458321385f},
-std::array<float,2>{0.79864043f, 0.715050936f},
-std::array<float,2>{0.746390104f, 0.398731858f},
-std::array<float,2>{0.357628465f, 0.91318506f},
-std::array<float,2>{0.442377895f, 0.274751514f},
-std::array<float,2>{0.576318324f, 0.870800912f},
-std::array<float,2>{0.907197237f, 0.18582803f},
-std::array<float,2>{0.171700582f, 0.536903977f},
-std::array<float,2>{0.0570334308f, 0.315008104f},
-std::array<float,2>{0.824147463f, 0.785462558f},
-std::array<float,2>{0.648955286f, 0.21456483f},
-std::array<float,2>{0.259468973f, 0.617501676f},
-std::array<float,2>{0.388818741f, 0.0678282231f},
-std::array<float,2>{0.510152459f, 0.637411177f},
-std::array<float,2>{0.963769734f, 0.449959695f},
-std::array<float,2>{0.22873503f, 0.970228255f},
-std::array<float,2>{0.13592723f, 0.137943089f},
-std::array<float,2>{0.897787929f, 0.502706051f},
-std::array<float,2>{0.61214453f, 0.310872734f},
-std::array<float,2>{0.481983066f, 0.832719862f},
-std::array<float,2>{0.330307633f, 0.433505088f},
-std::array<float,2>{0.688681543f, 0.901684701f},
-std::array<float,2>{0.775040448f, 0.0115371412f},
-std::array<float,2>{0.0746602193f, 0.728833735f},
-std::array<float,2>{0.0841035992f, 0.380101323f},
-std::array<float,2>{0.764656901f, 0.935726643f},
-std::array<float,2>{0.711001277f, 0.0513828918f},
-std::array<float,2>{0.328029722f, 0.701646149f},
-std::array<float,2>{0.498270214f, 0.167230338f},
-std::array<float,2>{0.600776017f, 0.549855471f},
-std::array<float,2>{0.88796097f, 0.257369012f},
-std::array<float,2>{0.143577456f, 0.859141767f},
-std::array<float,2>{0.249368697f, 0.0937794968f},
-std::array<float,2>{0.944710016f, 0.664623499f},
-std::array<float,2>{0.521946013f, 0.492599249f},
-std::array<float,2>{0.395747632f, 0.952079892f},
-std::array<float,2>{0.276657701f, 0.353214115f},
-std::array<float,2>{0.632417083f, 0.756761253f},
-std::array<float,2>{0.835543931f, 0.248229459f},
-std::array<float,2>{0.0395863727f, 0.566390276f},
-std::array<float,2>{0.176510856f, 0.284423053f},
-std::array<float,2>{0.923032463f, 0.821143866f},
-std::array<float,2>{0.587797284f, 0.146990627f},
-std::array<float,2>{0.459962636f, 0.52242142f},
-std::array<float,2>{0.374985039f, 0.017038025f},
-std::array<float,2>{0.73329699f, 0.741963625f},
-std::array<float,2>{0.787676275f, 0.416017234f},
-std::array<float,2>{0.0939757451f, 0.880201221f},
-std::array<float,2>{0.0100552188f, 0.200980037f},
-std::array<float,2>{0.86959064f, 0.601737797f},
-std::array<float,2>{0.678044617f, 0.333693147f},
-std::array<float,2>{0.291844994f, 0.800301254f},
-std::array<float,2>{0.412306398f, 0.454101413f},
-std::array<float,2>{0.535078883f, 0.997012615f},
-std::array<float,2>{0.970221281f, 0.0867743045f},
-std::array<float,2>{0.207318202f, 0.654562593f},
-std::array<float,2>{0.241509736f, 0.403470725f},
-std::array<float,2>{0.947510004f, 0.908619702f},
-std::array<float,2>{0.525525153f, 0.0404863507f},
-std::array<float,2>{0.403703719f, 0.7137236f},
-std::array<float,2>{0.268494159f, 0.18033579f},
-std::array<float,2>{0.632907689f, 0.533463597f},
-std::array<float,2>{0.842975378f, 0.27786696f},
-std::array<float,2>{0.0315508768f, 0.871350408f},
-std::array<float,2>{0.0937463865f, 0.114161462f},
-std::array<float,2>{0.751841128f, 0.679463625f},
-std::array<float,2>{0.703662276f, 0.471985936f},
-std::array<float,2>{0.314441174f, 0.965890706f},
-std::array<float,2>{0.486471176f, 0.371180981f},
-std::array<float,2>{0.606094778f, 0.768351436f},
-std::array<float,2>{0.88013345f, 0.23002933f},
-std::array<float,2>{0.155407265f, 0.582358778f},
-std::array<float,2>{0.00777701149f, 0.305105418f},
-std::array<float,2>{0.866905212f, 0.830774546f},
-std::array<float,2>{0.683264434f, 0.133351281f},
-std::array<float,2>{0.288140416f, 0.506244004f},
-std::array<float,2>{0.414768189f, 0.0127968593f},
-std::array<float,2>{0.543944418f, 0.732882142f},
-std::array<float,2>{0.982643545f, 0.435096145f},
-std::array<float,2>{0.212952346f, 0.903553605f},
-std::array<float,2>{0.179699257f, 0.215688273f},
-std::array<float,2>{0.933038712f, 0.622239113f},
-std::array<float,2>{0.585469246f, 0.320268452f},
-std::array<float,2>{0.461991191f, 0.784676552f},
-std::array<float,2>{0.36220935f, 0.447245419f},
-std::array<float,2>{0.720162451f, 0.974675357f},
-std::array<float,2>{0.790192962f, 0.0662627071f},
-std::array<float,2>{0.105245322f, 0.634647965f},
-std::array<float,2>{0.122717261f, 0.499763757f},
-std::array<float,2>{0.805003941f, 0.948976159f},
-std::array<float,2>{0.736872196f, 0.0980243385f},
-std::array<float,2>{0.348464906f, 0.671659291f},
-std::array<float,2>{0.446784616f, 0.243457004f},
-std::array<float,2>{0.569012344f, 0.567992151f},
-std::array<float,2>{0.914348722f, 0.357804835f},
-std::array<float,2>{0.163728431f, 0.751738608f},
-std::array<float,2>{0.19665581f, 0.0504308715f},
-std::array<float,2>{0.998939455f, 0.697812796f},
-std::array<float,2>{0.55620718f, 0.377848625f},
-std::array<float,2>{0.43637085f, 0.930496395f},
-std::array<float,2>{0.306322575f, 0.25231117f},
-std::array<float,2>{0.662099302f, 0.854162514f},
-std::array<float,2>{0.844376802f, 0.169052288f},
-std::array<float,2>{0.0240863897f, 0.551572978f},
-std::array<float,2>{0.126659811f, 0.331481397f},
-std::array<float,2>{0.904302299f, 0.802181482f},
-std::array<float,2>{0.617433131f, 0.195403174f},
-std::array<float,2>{0.468878597f, 0.606204808f},
-std::array<float,2>{0.342046916f, 0.0916482881f},
-std::array<float,2>{0.702067494f, 0.651660264f},
-std::array<float,2>{0.770640075f, 0.459258109f},
-std::array<float,2>{0.0644210652f, 0.993622541f},
-std::array<float,2>{0.0540105477f, 0.14377749f},
-std::array<float,2>{0.819420874f, 0.518490493f},
-std::array<float,2>{0.643369138f, 0.287014306f},
-std::array<float,2>{0.254591405f, 0.826695025f},
-std::array<float,2>{0.37864536f, 0.42072624f},
-std::array<float,2>{0.504278779f, 0.87559551f},
-std::array<float,2>{0.955088854f, 0.0213027727f},
-std::array<float,2>{0.223873883f, 0.736097872f},
-std::array<float,2>{0.165015981f, 0.465108424f},
-std::array<float,2>{0.910730124f, 0.986203372f},
-std::array<float,2>{0.571051359f, 0.080476597f},
-std::array<float,2>{0.439720601f, 0.644302666f},
-std::array<float,2>{0.353422493f, 0.192228585f},
-std::array<float,2>{0.745696485f, 0.596160531f},
-std::array<float,2>{0.803489983f, 0.341849923f},
-std::array<float,2>{0.117005087f, 0.81013155f},
-std::array<float,2>{0.0191705432f, 0.0269883256f},
-std::array<float,2>{0.856181324f, 0.748207033f},
-std::array<float,2>{0.668434501f, 0.408032119f},
-std::array<float,2>{0.298520893f, 0.889828801f},
-std::array<float,2>{0.426307768f, 0.290303737f},
-std::array<float,2>{0.554546535f, 0.820195794f},
-std::array<float,2>{0.990011275f, 0.149549246f},
-std::array<float,2>{0.190222263f, 0.528785348f},
-std::array<float,2>{0.0736884996f, 0.346863657f},
-std::array<float,2>{0.780216396f, 0.759151578f},
-std::array<float,2>{0.693884432f, 0.235964745f},
-std::array<float,2>{0.335159063f, 0.57547015f},
-std::array<float,2>{0.47891295f, 0.104131684f},
-std::array<float,2>{0.614700973f, 0.656522691f},
-std::array<float,2>{0.892212391f, 0.491097599f},
-std::array<float,2>{0.138689101f, 0.939263463f},
-std::array<float,2>{0.231458321f, 0.161180541f},
-std::array<float,2>{0.966890693f, 0.556953311f},
-std::array<float,2>{0.513404012f, 0.263804197f},
-std::array<float,2>{0.383408993f, 0.846346557f},
-std::array<float,2>{0.265362054f, 0.388513833f},
-std::array<float,2>{0.654269278f, 0.926410377f},
-std::array<float,2>{0.827052534f, 0.0605955794f},
-std::array<float,2>{0.0602151565f, 0.687540531f},
-std::array<float,2>{0.0465454645f, 0.429384977f},
-std::array<float,2>{0.829179645f, 0.897294164f},
-std::array<float,2>{0.628513634f, 0.00299116899f},
-std::array<float,2>{0.280314684f, 0.723703384f},
-std::array<float,2>{0.393375576f, 0.128262222f},
-std::array<float,2>{0.51934129f, 0.51358223f},
-std::array<float,2>{0.938582897f, 0.300381213f},
-std::array<float,2>{0.242195129f, 0.837366939f},
-std::array<float,2>{0.147860005f, 0.0715444013f},
-std::array<float,2>{0.8835935f, 0.628040016f},
-std::array<float,2>{0.595160544f, 0.43766734f},
-std::array<float,2>{0.492705226f, 0.980595946f},
-std::array<float,2>{0.321339041f, 0.323833942f},
-std::array<float,2>{0.716747463f, 0.796273887f},
-std::array<float,2>{0.758590996f, 0.208563879f},
-std::array<float,2>{0.0805161521f, 0.616872013f},
-std::array<float,2>{0.203242227f, 0.266548514f},
-std::array<float,2>{0.975240588f, 0.863504887f},
-std::array<float,2>{0.538489282f, 0.173892811f},
-std::array<float,2>{0.406388581f, 0.543911874f},
-std::array<float,2>{0.294520289f, 0.0317824781f},
-std::array<float,2>{0.675445318f, 0.705238044f},
-std::array<float,2>{0.872036934f, 0.397085071f},
-std::array<float,2>{0.0137521913f, 0.921663821f},
-std::array<float,2>{0.101011761f, 0.219428629f},
-std::array<float,2>{0.784655869f, 0.591484427f},
-std::array<float,2>{0.727712095f, 0.363920242f},
-std::array<float,2>{0.367923915f, 0.780714989f},
-std::array<float,2>{0.456370115f, 0.482364982f},
-std::array<float,2>{0.592871428f, 0.953205824f},
-std::array<float,2>{0.927608132f, 0.11866989f},
-std::array<float,2>{0.171883628f, 0.684461176f},
-std::array<float,2>{0.184707388f, 0.385839403f},
-std::array<float,2>{0.934631169f, 0.924516439f},
-std::array<float,2>{0.579181671f, 0.0579036027f},
-std::array<float,2>{0.466947168f, 0.693660438f},
-std::array<float,2>{0.364547938f, 0.159061685f},
-std::array<float,2>{0.725999475f, 0.56102854f},
-std::array<float,2>{0.794987798f, 0.260671943f},
-std::array<float,2>{0.10833516f, 0.850746095f},
-std::array<float,2>{0.000710404827f, 0.107103795f},
-std::array<float,2>{0.860027909f, 0.660209954f},
-std::array<float,2>{0.686082959f, 0.486643672f},
-std::array<float,2>{0.283560753f, 0.943658113f},
-std::array<float,2>{0.419123113f, 0.347831249f},
-std::array<float,2>{0.539932311f, 0.764344871f},
-std::array<float,2>{0.98026377f, 0.239090666f},
-std::array<float,2>{0.215976343f, 0.570712268f},
-std::array<float,2>{0.0885350704f, 0.294385374f},
-std::array<float,2>{0.754624426f, 0.815403521f},
-std::array<float,2>{0.7104972f, 0.152715892f},
-std::array<float,2>{0.319839478f, 0.526086569f},
-std::array<float,2>{0.490260512f, 0.0310350843f},
-std::array<float,2>{0.6037274f, 0.744026065f},
-std::array<float,2>{0.876965523f, 0.413739413f},
-std::array<float,2>{0.150464013f, 0.886005998f},
-std::array<float,2>{0.234903619f, 0.190948427f},
-std::array<float,2>{0.952372491f, 0.598721504f},
-std::array<float,2>{0.531107187f, 0.339458793f},
-std::array<float,2>{0.402249306f, 0.807133019f},
-std::array<float,2>{0.270947427f, 0.462952495f},
-std::array<float,2>{0.638205707f, 0.989432395f},
-std::array<float,2>{0.836638927f, 0.0840534493f},
-std::array<float,2>{0.0357099064f, 0.648330271f},
-std::array<float,2>{0.0482440405f, 0.480445802f},
-std::array<float,2>{0.812698305f, 0.958426952f},
-std::array<float,2>{0.645821214f, 0.124203086f},
-std::array<float,2>{0.25179553f, 0.680605352f},
-std::array<float,2>{0.381927133f, 0.225327656f},
-std::array<float,2>{0.502817035f, 0.589557767f},
-std::array<float,2>{0.957992911f, 0.359673649f},
-std::array<float,2>{0.222399935f, 0.775598824f},
-std::array<float,2>{0.130034089f, 0.0382538289f},
-std::array<float,2>{0.899695754f, 0.708755136f},
-std::array<float,2>{0.621633232f, 0.392389894f},
-std::array<float,2>{0.474123925f, 0.914709151f},
-std::array<float,2>{0.336632669f, 0.271499813f},
-std::array<float,2>{0.698698759f, 0.862870574f},
-std::array<float,2>{0.766752124f, 0.177023426f},
-std::array<float,2>{0.0687566027f, 0.539610922f},
-std::array<float,2>{0.201634496f, 0.327262431f},
-std::array<float,2>{0.995151579f, 0.789330661f},
-std::array<float,2>{0.55865258f, 0.206771359f},
-std::array<float,2>{0.429808229f, 0.612708628f},
-std::array<float,2>{0.311021745f, 0.0774063468f},
-std::array<float,2>{0.656715095f, 0.631096601f},
-std::array<float,2>{0.851484835f, 0.441773534f},
-std::array<float,2>{0.0297318809f, 0.978424549f},
-std::array<float,2>{0.117558517f, 0.132642806f},
-std::array<float,2>{0.809569776f, 0.509675384f},
-std::array<float,2>{0.74088484f, 0.303462386f},
-std::array<float,2>{0.34437573f, 0.839879334f},
-std::array<float,2>{0.451744854f, 0.42301017f},
-std::array<float,2>{0.563355625f, 0.893569529f},
-std::array<float,2>{0.919625103f, 0.00525659695f},
-std::array<float,2>{0.157023877f, 0.722019374f},
-std::array<float,2>{0.227158085f, 0.452844799f},
-std::array<float,2>{0.962392986f, 0.971226454f},
-std::array<float,2>{0.508369446f, 0.0696941093f},
-std::array<float,2>{0.388100505f, 0.639223814f},
-std::array<float,2>{0.260505795f, 0.211450532f},
-std::array<float,2>{0.650885344f, 0.620414555f},
-std::array<float,2>{0.820641935f, 0.313822657f},
-std::array<float,2>{0.0560421795f, 0.7890203f},
-std::array<float,2>{0.0764347911f, 0.00845214352f},
-std::array<float,2>{0.776650131f, 0.727925658f},
-std::array<float,2>{0.690026939f, 0.429847538f},
-std::array<float,2>{0.329604298f, 0.898687124f},
-std::array<float,2>{0.482450724f, 0.309178144f},
-std::array<float,2>{0.610144138f, 0.834740341f},
-std::array<float,2>{0.895624518f, 0.140031233f},
-std::array<float,2>{0.133703366f, 0.500169098f},
-std::array<float,2>{0.0201138295f, 0.369032651f},
-std::array<float,2>{0.854376853f, 0.770490289f},
-std::array<float,2>{0.66716814f, 0.232932284f},
-std::array<float,2>{0.302122802f, 0.581171513f},
-std::array<float,2>{0.424112856f, 0.11030715f},
-std::array<float,2>{0.55063957f, 0.673227251f},
-std::array<float,2>{0.984702766f, 0.475669533f},
-std::array<float,2>{0.194668755f, 0.96293956f},
-std::array<float,2>{0.169738278f, 0.185153872f},
-std::array<float,2>{0.909274399f, 0.538541973f},
-std::array<float,2>{0.574392796f, 0.275561452f},
-std::array<float,2>{0.444297731f, 0.868806839f},
-std::array<float,2>{0.356517851f, 0.400395662f},
-std::array<float,2>{0.749404967f, 0.912052751f},
-std::array<float,2>{0.798869312f, 0.0438699611f},
-std::array<float,2>{0.11025124f, 0.718331575f},
-std::array<float,2>{0.0971712843f, 0.414889663f},
-std::array<float,2>{0.786951721f, 0.882765591f},
-std::array<float,2>{0.732095599f, 0.0194863304f},
-std::array<float,2>{0.371315211f, 0.739699244f},
-std::array<float,2>{0.457506537f, 0.146199942f},
-std::array<float,2>{0.588896036f, 0.519857049f},
-std::array<float,2>{0.924986839f, 0.282120824f},
-std::array<float,2>{0.178613767f, 0.822365105f},
-std::array<float,2>{0.209775016f, 0.089460969f},
-std::array<float,2>{0.972589314f, 0.654163659f},
-std::array<float,2>{0.532381594f, 0.456782401f},
-std::array<float,2>{0.410813987f, 0.999424338f},
-std::array<float,2>{0.289120376f, 0.334656566f},
-std::array<float,2>{0.676631987f, 0.798377097f},
-std::array<float,2>{0.867921352f, 0.201864526f},
-std::array<float,2>{0.00870017987f, 0.604647756f},
-std::array<float,2>{0.141343936f, 0.255349576f},
-std::array<float,2>{0.888857365f, 0.856579185f},
-std::array<float,2>{0.598473728f, 0.164320707f},
-std::array<float,2>{0.496293396f, 0.548747361f},
-std::array<float,2>{0.32550016f, 0.0532959923f},
-std::array<float,2>{0.714447498f, 0.699738562f},
-std::array<float,2>{0.762248993f, 0.381729901f},
-std::array<float,2>{0.0839538574f, 0.934054494f},
-std::array<float,2>{0.0418980941f, 0.247721389f},
-std::array<float,2>{0.833622754f, 0.563052893f},
-std::array<float,2>{0.629235685f, 0.354749352f},
-std::array<float,2>{0.275022298f, 0.755210102f},
-std::array<float,2>{0.397492111f, 0.495704651f},
-std::array<float,2>{0.520136058f, 0.950085878f},
-std::array<float,2>{0.94230026f, 0.0959487259f},
-std::array<float,2>{0.247066483f, 0.666064441f},
-std::array<float,2>{0.2124663f, 0.436233103f},
-std::array<float,2>{0.982382119f, 0.904643059f},
-std::array<float,2>{0.545711875f, 0.014418398f},
-std::array<float,2>{0.417546719f, 0.732096434f},
-std::array<float,2>{0.286252618f, 0.134826213f},
-std::array<float,2>{0.67971164f, 0.505452871f},
-std::array<float,2>{0.86388886f, 0.307939321f},
-std::array<float,2>{0.00491948985f, 0.82861495f},
-std::array<float,2>{0.102280639f, 0.0629156828f},
-std::array<float,2>{0.791353524f, 0.635233998f},
-std::array<float,2>{0.721221566f, 0.447897255f},
-std::array<float,2>{0.360262245f, 0.973340392f},
-std::array<float,2>{0.463563621f, 0.318048477f},
-std::array<float,2>{0.583827019f, 0.782712281f},
-std::array<float,2>{0.931466699f, 0.218179882f},
-std::array<float,2>{0.182291165f, 0.623090506f},
-std::array<float,2>{0.0338197872f, 0.27943632f},
-std::array<float,2>{0.83994031f, 0.874467909f},
-std::array<float,2>{0.635144353f, 0.18179597f},
-std::array<float,2>{0.266298652f, 0.532942653f},
-std::array<float,2>{0.405392051f, 0.0419665501f},
-std::array<float,2>{0.524786711f, 0.710944474f},
-std::array<float,2>{0.945674419f, 0.404814839f},
-std::array<float,2>{0.240091369f, 0.907161176f},
-std::array<float,2>{0.153260902f, 0.227436557f},
-std::array<float,2>{0.881811857f, 0.584852636f},
-std::array<float,2>{0.609156907f, 0.373673707f},
-std::array<float,2>{0.485638201f, 0.766459882f},
-std::array<float,2>{0.315477878f, 0.470676601f},
-std::array<float,2>{0.705167651f, 0.966972411f},
-std::array<float,2>{0.75320363f, 0.115632512f},
-std::array<float,2>{0.0907486677f, 0.677106678f},
-std::array<float,2>{0.0653527081f, 0.457468897f},
-std::array<float,2>{0.772721827f, 0.996076345f},
-std::array<float,2>{0.699496746f, 0.0918213576f},
-std::array<float,2>{0.340221137f, 0.649923801f},
-std::array<float,2>{0.472267836f, 0.197673306f},
-std::array<float,2>{0.61958766f, 0.609224379f},
-std::array<float,2>{0.9038468f, 0.329378545f},
-std::array<float,2>{0.127762049f, 0.804676235f},
-std::array<float,2>{0.225368172f, 0.0217716731f},
-std::array<float,2>{0.953217328f, 0.736648142f},
-std::array<float,2>{0.506240785f, 0.419156343f},
-std::array<float,2>{0.375287056f, 0.878195286f},
-std::array<float,2>{0.256425053f, 0.28780517f},
-std::array<float,2>{0.641106129f, 0.825224817f},
-std::array<float,2>{0.817587197f, 0.141843617f},
-std::array<float,2>{0.0524194837f, 0.516636074f},
-std::array<float,2>{0.160593972f, 0.355622649f},
-std::array<float,2>{0.916231334f, 0.753510594f},
-std::array<float,2>{0.567648768f, 0.244991422f},
-std::array<float,2>{0.449080616f, 0.569881201f},
-std::array<float,2>{0.350894958f, 0.100384451f},
-std::array<float,2>{0.735102177f, 0.668043613f},
-std::array<float,2>{0.807274044f, 0.496793777f},
-std::array<float,2>{0.124881566f, 0.94554764f},
-std::array<float,2>{0.0260622837f, 0.170744061f},
-std::array<float,2>{0.847180367f, 0.55276829f},
-std::array<float,2>{0.662867069f, 0.251205176f},
-std::array<float,2>{0.307334036f, 0.853403032f},
-std::array<float,2>{0.434230596f, 0.375078827f},
-std::array<float,2>{0.5579772f, 0.932680607f},
-std::array<float,2>{0.997803271f, 0.0484920368f},
-std::array<float,2>{0.198397174f, 0.696582258f},
-std::array<float,2>{0.138058677f, 0.488834411f},
-std::array<float,2>{0.893164277f, 0.940901756f},
-std::array<float,2>{0.617112994f, 0.102760419f},
-std::array<float,2>{0.477584064f, 0.658727765f},
-std::array<float,2>{0.333547354f, 0.237205997f},
-std::array<float,2>{0.692674577f, 0.576637089f},
-std::array<float,2>{0.778080821f, 0.344487339f},
-std::array<float,2>{0.0715522021f, 0.76148504f},
-std::array<float,2>{0.0621153079f, 0.0587402023f},
-std::array<float,2>{0.824340701f, 0.689656198f},
-std::array<float,2>{0.655353546f, 0.389005214f},
-std::array<float,2>{0.261909574f, 0.928718209f},
-std::array<float,2>{0.385583371f, 0.262941688f},
-std::array<float,2>{0.513730288f, 0.845296144f},
-std::array<float,2>{0.964995265f, 0.164022416f},
-std::array<float,2>{0.232858375f, 0.556080043f},
-std::array<float,2>{0.114926755f, 0.34104979f},
-std::array<float,2>{0.802562177f, 0.812403798f},
-std::array<float,2>{0.743474901f, 0.193444625f},
-std::array<float,2>{0.354474962f, 0.594020307f},
-std::array<float,2>{0.438430667f, 0.079300046f},
-std::array<float,2>{0.57310462f, 0.641351998f},
-std::array<float,2>{0.912809908f, 0.468390346f},
-std::array<float,2>{0.167701989f, 0.986739993f},
-std::array<float,2>{0.187701195f, 0.151466742f},
-std::array<float,2>{0.99083209f, 0.530714333f},
-std::array<float,2>{0.552147508f, 0.292562574f},
-std::array<float,2>{0.429462969f, 0.816907883f},
-std::array<float,2>{0.300448537f, 0.408406526f},
-std::array<float,2>{0.670107365f, 0.887783766f},
-std::array<float,2>{0.857730865f, 0.0241407268f},
-std::array<float,2>{0.0167451389f, 0.746563256f},
-std::array<float,2>{0.0120087536f, 0.396448225f},
-std::array<float,2>{0.87430799f, 0.918592691f},
-std::array<float,2>{0.671961606f, 0.0340307578f},
-std::array<float,2>{0.295451015f, 0.704103529f},
-std::array<float,2>{0.409917742f, 0.173357144f},
-std::array<float,2>{0.53553611f, 0.546829402f},
-std::array<float,2>{0.974010408f, 0.268062949f},
-std::array<float,2>{0.206996217f, 0.867166042f},
-std::array<float,2>{0.1748849f, 0.120920442f},
-std::array<float,2>{0.92840904f, 0.686839104f},
-std::array<float,2>{0.591109455f, 0.483015269f},
-std::array<float,2>{0.453516692f, 0.956010759f},
-std::array<float,2>{0.37096414f, 0.36530295f},
-std::array<float,2>{0.729961157f, 0.778675795f},
-std::array<float,2>{0.781488001f, 0.222194165f},
-std::array<float,2>{0.0981145203f, 0.593563974f},
-std::array<float,2>{0.244217545f, 0.297904193f},
-std::array<float,2>{0.941068172f, 0.839443982f},
-std::array<float,2>{0.516052902f, 0.125299409f},
-std::array<float,2>{0.390843451f, 0.515617847f},
-std::array<float,2>{0.277713716f, 0.00174760725f},
-std::array<float,2>{0.625489295f, 0.72485292f},
-std::array<float,2>{0.831255674f, 0.426127225f},
-std::array<float,2>{0.0433826521f, 0.895826221f},
-std::array<float,2>{0.0798466355f, 0.209155887f},
-std::array<float,2>{0.761131585f, 0.614182711f},
-std::array<float,2>{0.718222201f, 0.321042418f},
-std::array<float,2>{0.323690116f, 0.793407202f},
-std::array<float,2>{0.494649947f, 0.44099918f},
-std::array<float,2>{0.597141862f, 0.984360099f},
-std::array<float,2>{0.886148512f, 0.0726451427f},
-std::array<float,2>{0.146059811f, 0.625475764f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.859260201f, 0.739219546f},
-std::array<float,2>{0.305175126f, 0.132299721f},
-std::array<float,2>{0.00265007862f, 0.868091643f},
-std::array<float,2>{0.588872731f, 0.443129957f},
-std::array<float,2>{0.666573465f, 0.949148893f},
-std::array<float,2>{0.190788373f, 0.353569627f},
-std::array<float,2>{0.403357148f, 0.593353629f},
-std::array<float,2>{0.886789799f, 0.0874745101f},
-std::array<float,2>{0.550938666f, 0.514442205f},
-std::array<float,2>{0.10839285f, 0.0365509391f},
-std::array<float,2>{0.319441527f, 0.928376853f},
-std::array<float,2>{0.765204549f, 0.28140077f},
-std::array<float,2>{0.949062467f, 0.781917572f},
-std::array<float,2>{0.487532288f, 0.380977064f},
-std::array<float,2>{0.129807264f, 0.66800499f},
-std::array<float,2>{0.7401703f, 0.228804901f},
-std::array<float,2>{0.92574954f, 0.599482656f},
-std::array<float,2>{0.430491775f, 0.112012058f},
-std::array<float,2>{0.246234685f, 0.995617092f},
-std::array<float,2>{0.631529748f, 0.32053715f},
-std::array<float,2>{0.6070894f, 0.825059533f},
-std::array<float,2>{0.0444796123f, 0.497168481f},
-std::array<float,2>{0.254532933f, 0.708573699f},
-std::array<float,2>{0.813743591f, 0.176403821f},
-std::array<float,2>{0.705399334f, 0.635928988f},
-std::array<float,2>{0.156349629f, 0.201128647f},
-std::array<float,2>{0.463476092f, 0.771784127f},
-std::array<float,2>{0.990828812f, 0.415180832f},
-std::array<float,2>{0.796089828f, 0.883886337f},
-std::array<float,2>{0.344545215f, 0.260443866f},
-std::array<float,2>{0.0863107517f, 0.540367663f},
-std::array<float,2>{0.51195991f, 0.0290751252f},
-std::array<float,2>{0.779876053f, 0.556988001f},
-std::array<float,2>{0.3285411f, 0.00865549129f},
-std::array<float,2>{0.11927744f, 0.891117096f},
-std::array<float,2>{0.539945364f, 0.277404338f},
-std::array<float,2>{0.730766118f, 0.753420949f},
-std::array<float,2>{0.150861129f, 0.430309087f},
-std::array<float,2>{0.476857781f, 0.646042824f},
-std::array<float,2>{0.954017997f, 0.211326256f},
-std::array<float,2>{0.562543988f, 0.691165626f},
-std::array<float,2>{0.0183947477f, 0.170663193f},
-std::array<float,2>{0.286375105f, 0.843262374f},
-std::array<float,2>{0.874308825f, 0.477444142f},
-std::array<float,2>{0.898526371f, 0.974383652f},
-std::array<float,2>{0.382439375f, 0.329825372f},
-std::array<float,2>{0.215204373f, 0.624462247f},
-std::array<float,2>{0.686336994f, 0.0960770771f},
-std::array<float,2>{0.970963478f, 0.681398749f},
-std::array<float,2>{0.444279611f, 0.246438697f},
-std::array<float,2>{0.18577905f, 0.809320986f},
-std::array<float,2>{0.688506544f, 0.400107443f},
-std::array<float,2>{0.525957704f, 0.917298436f},
-std::array<float,2>{0.0723261163f, 0.301919401f},
-std::array<float,2>{0.365277112f, 0.520797968f},
-std::array<float,2>{0.810416877f, 0.0574619472f},
-std::array<float,2>{0.654212892f, 0.562536299f},
-std::array<float,2>{0.222025782f, 0.0724786445f},
-std::array<float,2>{0.411289543f, 0.962954044f},
-std::array<float,2>{0.908654273f, 0.361672729f},
-std::array<float,2>{0.841397047f, 0.850465775f},
-std::array<float,2>{0.274927646f, 0.466139108f},
-std::array<float,2>{0.0569737218f, 0.723611414f},
-std::array<float,2>{0.624744475f, 0.144998506f},
-std::array<float,2>{0.797642589f, 0.652642131f},
-std::array<float,2>{0.371976644f, 0.203648627f},
-std::array<float,2>{0.0634610355f, 0.76522696f},
-std::array<float,2>{0.517565668f, 0.428519934f},
-std::array<float,2>{0.695630074f, 0.902272522f},
-std::array<float,2>{0.176626772f, 0.272251219f},
-std::array<float,2>{0.449931592f, 0.549650133f},
-std::array<float,2>{0.982986569f, 0.00707692513f},
-std::array<float,2>{0.616738737f, 0.60974735f},
-std::array<float,2>{0.0541256331f, 0.104272582f},
-std::array<float,2>{0.268935323f, 0.978146732f},
-std::array<float,2>{0.835543096f, 0.342215359f},
-std::array<float,2>{0.91888684f, 0.832509637f},
-std::array<float,2>{0.418602526f, 0.471828669f},
-std::array<float,2>{0.232054323f, 0.699168861f},
-std::array<float,2>{0.642970502f, 0.163941413f},
-std::array<float,2>{0.963087261f, 0.526312292f},
-std::array<float,2>{0.474949509f, 0.0529831462f},
-std::array<float,2>{0.146196842f, 0.906536102f},
-std::array<float,2>{0.726022422f, 0.306844801f},
-std::array<float,2>{0.535552919f, 0.798864126f},
-std::array<float,2>{0.117155828f, 0.396361232f},
-std::array<float,2>{0.340375394f, 0.676686645f},
-std::array<float,2>{0.766625643f, 0.235050663f},
-std::array<float,2>{0.673658311f, 0.731633484f},
-std::array<float,2>{0.204606563f, 0.154655784f},
-std::array<float,2>{0.387297124f, 0.859042525f},
-std::array<float,2>{0.896326959f, 0.456442595f},
-std::array<float,2>{0.861693919f, 0.959036291f},
-std::array<float,2>{0.290198922f, 0.367637366f},
-std::array<float,2>{0.0264828745f, 0.576885998f},
-std::array<float,2>{0.572222531f, 0.0654516071f},
-std::array<float,2>{0.824583352f, 0.580917597f},
-std::array<float,2>{0.261454403f, 0.0828469992f},
-std::array<float,2>{0.038851019f, 0.944451213f},
-std::array<float,2>{0.596025288f, 0.348239422f},
-std::array<float,2>{0.633051932f, 0.866558611f},
-std::array<float,2>{0.240616754f, 0.448637068f},
-std::array<float,2>{0.426316172f, 0.74566853f},
-std::array<float,2>{0.930967689f, 0.139473662f},
-std::array<float,2>{0.50645864f, 0.656972229f},
-std::array<float,2>{0.0794725716f, 0.226432785f},
-std::array<float,2>{0.359269053f, 0.789604604f},
-std::array<float,2>{0.78644985f, 0.384880513f},
-std::array<float,2>{0.996561289f, 0.934701681f},
-std::array<float,2>{0.455289632f, 0.29541865f},
-std::array<float,2>{0.170831949f, 0.504614651f},
-std::array<float,2>{0.713620782f, 0.0441739038f},
-std::array<float,2>{0.87807858f, 0.715709805f},
-std::array<float,2>{0.396536499f, 0.180367753f},
-std::array<float,2>{0.200758532f, 0.81836009f},
-std::array<float,2>{0.65777415f, 0.489604533f},
-std::array<float,2>{0.581786335f, 0.985841691f},
-std::array<float,2>{0.0124742687f, 0.312666148f},
-std::array<float,2>{0.303776175f, 0.606082678f},
-std::array<float,2>{0.850981712f, 0.124427497f},
-std::array<float,2>{0.747988105f, 0.536707401f},
-std::array<float,2>{0.134100616f, 0.0164399091f},
-std::array<float,2>{0.497857243f, 0.879710674f},
-std::array<float,2>{0.942509592f, 0.250477016f},
-std::array<float,2>{0.755481124f, 0.780942917f},
-std::array<float,2>{0.325525701f, 0.409531087f},
-std::array<float,2>{0.0977985188f, 0.626662493f},
-std::array<float,2>{0.556804121f, 0.194050208f},
-std::array<float,2>{0.75968641f, 0.702690721f},
-std::array<float,2>{0.313121974f, 0.15923804f},
-std::array<float,2>{0.1053771f, 0.831269681f},
-std::array<float,2>{0.550008476f, 0.476247311f},
-std::array<float,2>{0.734809756f, 0.982569158f},
-std::array<float,2>{0.125794217f, 0.337621987f},
-std::array<float,2>{0.492179841f, 0.615726113f},
-std::array<float,2>{0.951149642f, 0.105921172f},
-std::array<float,2>{0.591212094f, 0.551778853f},
-std::array<float,2>{0.00565033173f, 0.00293419557f},
-std::array<float,2>{0.311852664f, 0.902802944f},
-std::array<float,2>{0.852447212f, 0.26885435f},
-std::array<float,2>{0.884815276f, 0.757847667f},
-std::array<float,2>{0.400999606f, 0.424506038f},
-std::array<float,2>{0.193837523f, 0.651176155f},
-std::array<float,2>{0.670285821f, 0.210882321f},
-std::array<float,2>{0.985076368f, 0.572178423f},
-std::array<float,2>{0.467585236f, 0.0664508939f},
-std::array<float,2>{0.162926346f, 0.953341663f},
-std::array<float,2>{0.708583713f, 0.373423964f},
-std::array<float,2>{0.5112409f, 0.852208436f},
-std::array<float,2>{0.0921471864f, 0.45881471f},
-std::array<float,2>{0.34837088f, 0.727041543f},
-std::array<float,2>{0.792858183f, 0.150709853f},
-std::array<float,2>{0.628383398f, 0.671966851f},
-std::array<float,2>{0.24344717f, 0.240114436f},
-std::array<float,2>{0.433843911f, 0.804253995f},
-std::array<float,2>{0.92594409f, 0.391406775f},
-std::array<float,2>{0.81942898f, 0.913721204f},
-std::array<float,2>{0.250082105f, 0.309538871f},
-std::array<float,2>{0.0414257757f, 0.529387295f},
-std::array<float,2>{0.602747023f, 0.0491689257f},
-std::array<float,2>{0.869537294f, 0.500213146f},
-std::array<float,2>{0.283584237f, 0.0420563035f},
-std::array<float,2>{0.0203561056f, 0.930528045f},
-std::array<float,2>{0.568250358f, 0.290069073f},
-std::array<float,2>{0.679857254f, 0.796053886f},
-std::array<float,2>{0.213568911f, 0.390031129f},
-std::array<float,2>{0.378608584f, 0.66362077f},
-std::array<float,2>{0.902584016f, 0.219032243f},
-std::array<float,2>{0.543163598f, 0.747897089f},
-std::array<float,2>{0.123042785f, 0.133592933f},
-std::array<float,2>{0.335436672f, 0.862332702f},
-std::array<float,2>{0.776437163f, 0.449712723f},
-std::array<float,2>{0.960022688f, 0.938108444f},
-std::array<float,2>{0.482026696f, 0.344361246f},
-std::array<float,2>{0.152608529f, 0.584593117f},
-std::array<float,2>{0.727268338f, 0.0811400414f},
-std::array<float,2>{0.911214113f, 0.629481316f},
-std::array<float,2>{0.406548411f, 0.190866992f},
-std::array<float,2>{0.225215197f, 0.775971889f},
-std::array<float,2>{0.651875138f, 0.41370216f},
-std::array<float,2>{0.621001482f, 0.875910521f},
-std::array<float,2>{0.0601017103f, 0.256495029f},
-std::array<float,2>{0.280113727f, 0.533229887f},
-std::array<float,2>{0.837670028f, 0.019649744f},
-std::array<float,2>{0.694208443f, 0.604592681f},
-std::array<float,2>{0.180969864f, 0.117954403f},
-std::array<float,2>{0.440385014f, 0.988758504f},
-std::array<float,2>{0.976084054f, 0.32005015f},
-std::array<float,2>{0.804729044f, 0.813187778f},
-std::array<float,2>{0.359681755f, 0.485986829f},
-std::array<float,2>{0.0778277218f, 0.713379085f},
-std::array<float,2>{0.529663563f, 0.186863199f},
-std::array<float,2>{0.829924464f, 0.665463388f},
-std::array<float,2>{0.272720128f, 0.231467873f},
-std::array<float,2>{0.0496022068f, 0.788157284f},
-std::array<float,2>{0.610508502f, 0.377821594f},
-std::array<float,2>{0.646230459f, 0.924272895f},
-std::array<float,2>{0.229857743f, 0.285231262f},
-std::array<float,2>{0.41719842f, 0.510412455f},
-std::array<float,2>{0.915296972f, 0.0320524648f},
-std::array<float,2>{0.523428917f, 0.58877939f},
-std::array<float,2>{0.0695527345f, 0.0928855836f},
-std::array<float,2>{0.369714916f, 0.949341238f},
-std::array<float,2>{0.802665651f, 0.355764478f},
-std::array<float,2>{0.97827363f, 0.872423708f},
-std::array<float,2>{0.44770512f, 0.440410048f},
-std::array<float,2>{0.175617993f, 0.734402895f},
-std::array<float,2>{0.700620949f, 0.128439412f},
-std::array<float,2>{0.891351104f, 0.543083966f},
-std::array<float,2>{0.385940939f, 0.0270924009f},
-std::array<float,2>{0.207190588f, 0.890005291f},
-std::array<float,2>{0.678516865f, 0.26493898f},
-std::array<float,2>{0.575566053f, 0.765975416f},
-std::array<float,2>{0.0283261109f, 0.418246925f},
-std::array<float,2>{0.292991221f, 0.638365328f},
-std::array<float,2>{0.863292873f, 0.19916603f},
-std::array<float,2>{0.720357001f, 0.706800282f},
-std::array<float,2>{0.141238198f, 0.172000095f},
-std::array<float,2>{0.469395697f, 0.823537111f},
-std::array<float,2>{0.967940629f, 0.492603928f},
-std::array<float,2>{0.77102977f, 0.999506772f},
-std::array<float,2>{0.336083353f, 0.324835688f},
-std::array<float,2>{0.109449558f, 0.594194353f},
-std::array<float,2>{0.532525718f, 0.116368152f},
-std::array<float,2>{0.785048246f, 0.620323777f},
-std::array<float,2>{0.35222441f, 0.100889347f},
-std::array<float,2>{0.0857065246f, 0.970458031f},
-std::array<float,2>{0.503545582f, 0.334410995f},
-std::array<float,2>{0.718119919f, 0.838584244f},
-std::array<float,2>{0.164565161f, 0.483861834f},
-std::array<float,2>{0.457103491f, 0.694116592f},
-std::array<float,2>{0.993487179f, 0.16547361f},
-std::array<float,2>{0.599106371f, 0.64100033f},
-std::array<float,2>{0.0323415138f, 0.216841623f},
-std::array<float,2>{0.262977004f, 0.757309258f},
-std::array<float,2>{0.821252942f, 0.434024781f},
-std::array<float,2>{0.936776102f, 0.895178318f},
-std::array<float,2>{0.424124151f, 0.274913877f},
-std::array<float,2>{0.238074943f, 0.561109781f},
-std::array<float,2>{0.638535917f, 0.0133567806f},
-std::array<float,2>{0.937616825f, 0.719643831f},
-std::array<float,2>{0.494923562f, 0.144452497f},
-std::array<float,2>{0.137923479f, 0.847230554f},
-std::array<float,2>{0.745448172f, 0.464304775f},
-std::array<float,2>{0.562284827f, 0.966366649f},
-std::array<float,2>{0.0960113928f, 0.363493234f},
-std::array<float,2>{0.323518485f, 0.567667544f},
-std::array<float,2>{0.751771331f, 0.0751189366f},
-std::array<float,2>{0.663464546f, 0.516427338f},
-std::array<float,2>{0.198027387f, 0.0594336055f},
-std::array<float,2>{0.391070127f, 0.918615997f},
-std::array<float,2>{0.879718781f, 0.299266756f},
-std::array<float,2>{0.845246673f, 0.808456481f},
-std::array<float,2>{0.298651695f, 0.405294657f},
-std::array<float,2>{0.00985377934f, 0.68445313f},
-std::array<float,2>{0.582445204f, 0.245268986f},
-std::array<float,2>{0.81506145f, 0.709995031f},
-std::array<float,2>{0.256724119f, 0.178097889f},
-std::array<float,2>{0.0450089946f, 0.827535689f},
-std::array<float,2>{0.607916057f, 0.498673588f},
-std::array<float,2>{0.630500853f, 0.993244171f},
-std::array<float,2>{0.249609321f, 0.323051125f},
-std::array<float,2>{0.432559073f, 0.599673331f},
-std::array<float,2>{0.922277153f, 0.11096397f},
-std::array<float,2>{0.513861537f, 0.542793751f},
-std::array<float,2>{0.0892324448f, 0.0305290073f},
-std::array<float,2>{0.34641847f, 0.886653721f},
-std::array<float,2>{0.794839084f, 0.257865787f},
-std::array<float,2>{0.988664031f, 0.770690501f},
-std::array<float,2>{0.462824792f, 0.417195678f},
-std::array<float,2>{0.160039142f, 0.63402015f},
-std::array<float,2>{0.704574466f, 0.201346606f},
-std::array<float,2>{0.889418185f, 0.591244817f},
-std::array<float,2>{0.405482948f, 0.0897038803f},
-std::array<float,2>{0.18923746f, 0.946867466f},
-std::array<float,2>{0.665976048f, 0.353242517f},
-std::array<float,2>{0.586048782f, 0.870034158f},
-std::array<float,2>{0.00104473659f, 0.443617821f},
-std::array<float,2>{0.307563722f, 0.742184639f},
-std::array<float,2>{0.856952012f, 0.129760206f},
-std::array<float,2>{0.742114544f, 0.670406461f},
-std::array<float,2>{0.131484449f, 0.227400318f},
-std::array<float,2>{0.486152261f, 0.784997225f},
-std::array<float,2>{0.945800126f, 0.380072325f},
-std::array<float,2>{0.763139009f, 0.927436292f},
-std::array<float,2>{0.31772849f, 0.284875184f},
-std::array<float,2>{0.107326038f, 0.511929095f},
-std::array<float,2>{0.554077685f, 0.0380154103f},
-std::array<float,2>{0.811871946f, 0.523032725f},
-std::array<float,2>{0.364220768f, 0.0555350035f},
-std::array<float,2>{0.0705000237f, 0.914197266f},
-std::array<float,2>{0.524973452f, 0.304502696f},
-std::array<float,2>{0.689723432f, 0.812032223f},
-std::array<float,2>{0.185268313f, 0.400447905f},
-std::array<float,2>{0.441934466f, 0.682042599f},
-std::array<float,2>{0.969995916f, 0.249323815f},
-std::array<float,2>{0.621655345f, 0.72542423f},
-std::array<float,2>{0.0557454862f, 0.148087457f},
-std::array<float,2>{0.277176529f, 0.849303663f},
-std::array<float,2>{0.843153596f, 0.468026519f},
-std::array<float,2>{0.907721937f, 0.962423325f},
-std::array<float,2>{0.412761092f, 0.360340118f},
-std::array<float,2>{0.218988478f, 0.56613344f},
-std::array<float,2>{0.655761719f, 0.0722259805f},
-std::array<float,2>{0.956583023f, 0.647766829f},
-std::array<float,2>{0.478737026f, 0.213980436f},
-std::array<float,2>{0.149260208f, 0.750634611f},
-std::array<float,2>{0.733560503f, 0.432725877f},
-std::array<float,2>{0.542549193f, 0.89284271f},
-std::array<float,2>{0.117477484f, 0.280254751f},
-std::array<float,2>{0.331278741f, 0.55618161f},
-std::array<float,2>{0.779288411f, 0.0114771891f},
-std::array<float,2>{0.684490621f, 0.622988343f},
-std::array<float,2>{0.21851255f, 0.0950688794f},
-std::array<float,2>{0.379090399f, 0.976065159f},
-std::array<float,2>{0.901794672f, 0.331693888f},
-std::array<float,2>{0.872365773f, 0.841278553f},
-std::array<float,2>{0.288751543f, 0.478948534f},
-std::array<float,2>{0.0156862941f, 0.689272821f},
-std::array<float,2>{0.565010726f, 0.169332191f},
-std::array<float,2>{0.768818915f, 0.678060472f},
-std::array<float,2>{0.341938883f, 0.236517206f},
-std::array<float,2>{0.11469622f, 0.797532082f},
-std::array<float,2>{0.539009988f, 0.396951884f},
-std::array<float,2>{0.723446906f, 0.910096765f},
-std::array<float,2>{0.147325709f, 0.304687887f},
-std::array<float,2>{0.473490298f, 0.523654521f},
-std::array<float,2>{0.962083638f, 0.0518460311f},
-std::array<float,2>{0.572477281f, 0.574694455f},
-std::array<float,2>{0.0244186707f, 0.0625488237f},
-std::array<float,2>{0.291075051f, 0.957291245f},
-std::array<float,2>{0.859938383f, 0.369273663f},
-std::array<float,2>{0.897851348f, 0.855939388f},
-std::array<float,2>{0.38909179f, 0.453276336f},
-std::array<float,2>{0.205228925f, 0.732496381f},
-std::array<float,2>{0.674819469f, 0.152599826f},
-std::array<float,2>{0.980772018f, 0.548293889f},
-std::array<float,2>{0.452584475f, 0.00443656975f},
-std::array<float,2>{0.179476917f, 0.900096834f},
-std::array<float,2>{0.698320806f, 0.270939112f},
-std::array<float,2>{0.517898977f, 0.763536036f},
-std::array<float,2>{0.0645195544f, 0.425973564f},
-std::array<float,2>{0.374507099f, 0.654491365f},
-std::array<float,2>{0.799270391f, 0.206358895f},
-std::array<float,2>{0.642304063f, 0.695924401f},
-std::array<float,2>{0.232890844f, 0.160427332f},
-std::array<float,2>{0.420268476f, 0.8343063f},
-std::array<float,2>{0.921027958f, 0.468792021f},
-std::array<float,2>{0.83295244f, 0.978743017f},
-std::array<float,2>{0.265877217f, 0.340769589f},
-std::array<float,2>{0.0517650209f, 0.612615168f},
-std::array<float,2>{0.61484921f, 0.102891862f},
-std::array<float,2>{0.8485443f, 0.609199643f},
-std::array<float,2>{0.301547766f, 0.121235602f},
-std::array<float,2>{0.0141716674f, 0.988266647f},
-std::array<float,2>{0.579851985f, 0.315212816f},
-std::array<float,2>{0.658343434f, 0.816791713f},
-std::array<float,2>{0.202174872f, 0.491967589f},
-std::array<float,2>{0.395574689f, 0.716887116f},
-std::array<float,2>{0.876563549f, 0.183157608f},
-std::array<float,2>{0.556045592f, 0.628376663f},
-std::array<float,2>{0.0997971445f, 0.191435784f},
-std::array<float,2>{0.326530665f, 0.778220356f},
-std::array<float,2>{0.755986691f, 0.406826109f},
-std::array<float,2>{0.944848537f, 0.881966829f},
-std::array<float,2>{0.49945417f, 0.252563089f},
-std::array<float,2>{0.134798124f, 0.537977219f},
-std::array<float,2>{0.748110175f, 0.019491924f},
-std::array<float,2>{0.931815028f, 0.742860556f},
-std::array<float,2>{0.428640753f, 0.137064964f},
-std::array<float,2>{0.240201995f, 0.864431798f},
-std::array<float,2>{0.635111451f, 0.445678502f},
-std::array<float,2>{0.594206572f, 0.941627026f},
-std::array<float,2>{0.036933694f, 0.350900114f},
-std::array<float,2>{0.259044617f, 0.579802632f},
-std::array<float,2>{0.827963889f, 0.0850818008f},
-std::array<float,2>{0.712855458f, 0.506571114f},
-std::array<float,2>{0.168711752f, 0.0459929518f},
-std::array<float,2>{0.453658879f, 0.937448442f},
-std::array<float,2>{0.999510169f, 0.294235736f},
-std::array<float,2>{0.78753835f, 0.791297257f},
-std::array<float,2>{0.356140375f, 0.382887244f},
-std::array<float,2>{0.0809130445f, 0.659926832f},
-std::array<float,2>{0.505685091f, 0.222771287f},
-std::array<float,2>{0.789340079f, 0.730093241f},
-std::array<float,2>{0.350095034f, 0.150380149f},
-std::array<float,2>{0.0903181583f, 0.854069173f},
-std::array<float,2>{0.509125948f, 0.459775299f},
-std::array<float,2>{0.709577858f, 0.95603472f},
-std::array<float,2>{0.160765573f, 0.371813655f},
-std::array<float,2>{0.46643737f, 0.573244452f},
-std::array<float,2>{0.986876607f, 0.0698298514f},
-std::array<float,2>{0.604055226f, 0.527772367f},
-std::array<float,2>{0.0398645774f, 0.0478635952f},
-std::array<float,2>{0.252568364f, 0.911697626f},
-std::array<float,2>{0.81815511f, 0.311672479f},
-std::array<float,2>{0.928425372f, 0.8020069f},
-std::array<float,2>{0.436903268f, 0.394239217f},
-std::array<float,2>{0.245357454f, 0.67385751f},
-std::array<float,2>{0.625230432f, 0.240323767f},
-std::array<float,2>{0.951495469f, 0.614399493f},
-std::array<float,2>{0.488543093f, 0.108126976f},
-std::array<float,2>{0.12736927f, 0.980628192f},
-std::array<float,2>{0.737697601f, 0.338006467f},
-std::array<float,2>{0.547223628f, 0.828759909f},
-std::array<float,2>{0.102797657f, 0.474028826f},
-std::array<float,2>{0.31526491f, 0.700951636f},
-std::array<float,2>{0.76132369f, 0.157221735f},
-std::array<float,2>{0.668934584f, 0.650372148f},
-std::array<float,2>{0.192670614f, 0.207204178f},
-std::array<float,2>{0.39963451f, 0.761111021f},
-std::array<float,2>{0.883435845f, 0.421929419f},
-std::array<float,2>{0.854504287f, 0.906039298f},
-std::array<float,2>{0.310392559f, 0.265633762f},
-std::array<float,2>{0.00640001381f, 0.554334879f},
-std::array<float,2>{0.592162669f, 0.00117930595f},
-std::array<float,2>{0.838848531f, 0.531935394f},
-std::array<float,2>{0.277784348f, 0.021626886f},
-std::array<float,2>{0.0617560185f, 0.877969742f},
-std::array<float,2>{0.618495703f, 0.255083174f},
-std::array<float,2>{0.64919579f, 0.775139034f},
-std::array<float,2>{0.223435432f, 0.411615849f},
-std::array<float,2>{0.408254176f, 0.631203234f},
-std::array<float,2>{0.912920237f, 0.188714147f},
-std::array<float,2>{0.528746247f, 0.71141547f},
-std::array<float,2>{0.0745826364f, 0.184530318f},
-std::array<float,2>{0.361984521f, 0.816243351f},
-std::array<float,2>{0.808402121f, 0.48752892f},
-std::array<float,2>{0.972881377f, 0.991931617f},
-std::array<float,2>{0.438248336f, 0.316919863f},
-std::array<float,2>{0.182401568f, 0.60164535f},
-std::array<float,2>{0.692021906f, 0.120980196f},
-std::array<float,2>{0.904310405f, 0.661624014f},
-std::array<float,2>{0.376684248f, 0.222642958f},
-std::array<float,2>{0.211437643f, 0.793567002f},
-std::array<float,2>{0.682626545f, 0.388137996f},
-std::array<float,2>{0.570192039f, 0.933364928f},
-std::array<float,2>{0.0223635621f, 0.291836649f},
-std::array<float,2>{0.282495767f, 0.502275646f},
-std::array<float,2>{0.868139029f, 0.0391153358f},
-std::array<float,2>{0.729100764f, 0.583950877f},
-std::array<float,2>{0.15622282f, 0.0782480761f},
-std::array<float,2>{0.483573467f, 0.940102994f},
-std::array<float,2>{0.957315683f, 0.346593797f},
-std::array<float,2>{0.774868548f, 0.861127555f},
-std::array<float,2>{0.333054364f, 0.452241302f},
-std::array<float,2>{0.124929376f, 0.748984993f},
-std::array<float,2>{0.545968294f, 0.13569136f},
-std::array<float,2>{0.865949571f, 0.639371812f},
-std::array<float,2>{0.295747578f, 0.19677864f},
-std::array<float,2>{0.0301437005f, 0.769499183f},
-std::array<float,2>{0.576496422f, 0.421303213f},
-std::array<float,2>{0.676228046f, 0.887387514f},
-std::array<float,2>{0.210332662f, 0.262332588f},
-std::array<float,2>{0.383635938f, 0.546261966f},
-std::array<float,2>{0.893921494f, 0.024737671f},
-std::array<float,2>{0.533988893f, 0.597343206f},
-std::array<float,2>{0.112128355f, 0.114385009f},
-std::array<float,2>{0.339153022f, 0.997746646f},
-std::array<float,2>{0.772203743f, 0.327105463f},
-std::array<float,2>{0.966571987f, 0.820911109f},
-std::array<float,2>{0.472321123f, 0.495891333f},
-std::array<float,2>{0.143186703f, 0.703307629f},
-std::array<float,2>{0.72217977f, 0.175711975f},
-std::array<float,2>{0.916718364f, 0.50958097f},
-std::array<float,2>{0.414094985f, 0.0340102427f},
-std::array<float,2>{0.228087246f, 0.923278093f},
-std::array<float,2>{0.647262514f, 0.288758665f},
-std::array<float,2>{0.612297475f, 0.786943197f},
-std::array<float,2>{0.0471542776f, 0.375398934f},
-std::array<float,2>{0.271427125f, 0.667499185f},
-std::array<float,2>{0.831570208f, 0.232677564f},
-std::array<float,2>{0.701536894f, 0.737957656f},
-std::array<float,2>{0.172013894f, 0.125480026f},
-std::array<float,2>{0.445924819f, 0.874245584f},
-std::array<float,2>{0.979930997f, 0.438723177f},
-std::array<float,2>{0.80427295f, 0.952145576f},
-std::array<float,2>{0.368736356f, 0.35812223f},
-std::array<float,2>{0.0672130585f, 0.587580383f},
-std::array<float,2>{0.51969558f, 0.0907479972f},
-std::array<float,2>{0.752461374f, 0.569433689f},
-std::array<float,2>{0.321543366f, 0.0763051808f},
-std::array<float,2>{0.0944164544f, 0.968617857f},
-std::array<float,2>{0.560384452f, 0.365496337f},
-std::array<float,2>{0.742273271f, 0.844368994f},
-std::array<float,2>{0.140066922f, 0.461800098f},
-std::array<float,2>{0.49231413f, 0.721908331f},
-std::array<float,2>{0.940003991f, 0.141461223f},
-std::array<float,2>{0.584223509f, 0.686090946f},
-std::array<float,2>{0.00925328676f, 0.243066266f},
-std::array<float,2>{0.299110323f, 0.805800736f},
-std::array<float,2>{0.847376645f, 0.40308708f},
-std::array<float,2>{0.881462276f, 0.921371818f},
-std::array<float,2>{0.393095225f, 0.29788664f},
-std::array<float,2>{0.196192041f, 0.517729104f},
-std::array<float,2>{0.66138047f, 0.0614273846f},
-std::array<float,2>{0.995618224f, 0.692496896f},
-std::array<float,2>{0.459947497f, 0.167897969f},
-std::array<float,2>{0.167054832f, 0.835966825f},
-std::array<float,2>{0.715965629f, 0.4811804f},
-std::array<float,2>{0.500765979f, 0.972141981f},
-std::array<float,2>{0.0839285627f, 0.332770795f},
-std::array<float,2>{0.3552275f, 0.618090272f},
-std::array<float,2>{0.781991661f, 0.0988250151f},
-std::array<float,2>{0.638705611f, 0.560412407f},
-std::array<float,2>{0.235089347f, 0.0143652037f},
-std::array<float,2>{0.423442423f, 0.897020042f},
-std::array<float,2>{0.935177088f, 0.277124822f},
-std::array<float,2>{0.822400689f, 0.754275799f},
-std::array<float,2>{0.264323831f, 0.435640514f},
-std::array<float,2>{0.0346844196f, 0.64342016f},
-std::array<float,2>{0.600865245f, 0.216336399f},
-std::array<float,2>{0.873175383f, 0.687782943f},
-std::array<float,2>{0.285712302f, 0.168525577f},
-std::array<float,2>{0.0188569855f, 0.840763986f},
-std::array<float,2>{0.564016759f, 0.480272859f},
-std::array<float,2>{0.687445283f, 0.975290358f},
-std::array<float,2>{0.215952054f, 0.330906689f},
-std::array<float,2>{0.381621927f, 0.621826112f},
-std::array<float,2>{0.900191605f, 0.0945397392f},
-std::array<float,2>{0.540240228f, 0.554887593f},
-std::array<float,2>{0.120339379f, 0.0102027655f},
-std::array<float,2>{0.329606652f, 0.894241393f},
-std::array<float,2>{0.780647159f, 0.280688196f},
-std::array<float,2>{0.954763532f, 0.751521409f},
-std::array<float,2>{0.47757411f, 0.432417989f},
-std::array<float,2>{0.152136549f, 0.646629214f},
-std::array<float,2>{0.731545329f, 0.213780507f},
-std::array<float,2>{0.909192502f, 0.565428615f},
-std::array<float,2>{0.41053459f, 0.0706255287f},
-std::array<float,2>{0.221276432f, 0.961185753f},
-std::array<float,2>{0.652445793f, 0.36111939f},
-std::array<float,2>{0.623302698f, 0.848569691f},
-std::array<float,2>{0.058497332f, 0.467471361f},
-std::array<float,2>{0.274376839f, 0.726323068f},
-std::array<float,2>{0.840264678f, 0.147325978f},
-std::array<float,2>{0.688451827f, 0.683016658f},
-std::array<float,2>{0.186647072f, 0.248640299f},
-std::array<float,2>{0.44481352f, 0.810857236f},
-std::array<float,2>{0.972583055f, 0.402316898f},
-std::array<float,2>{0.808898211f, 0.915209711f},
-std::array<float,2>{0.366624475f, 0.302747011f},
-std::array<float,2>{0.0736425892f, 0.522013605f},
-std::array<float,2>{0.527322471f, 0.0556754507f},
-std::array<float,2>{0.763676584f, 0.512972355f},
-std::array<float,2>{0.318924844f, 0.0383841731f},
-std::array<float,2>{0.109111756f, 0.926248789f},
-std::array<float,2>{0.552250922f, 0.283775002f},
-std::array<float,2>{0.738973081f, 0.783634901f},
-std::array<float,2>{0.130479172f, 0.379667252f},
-std::array<float,2>{0.486982763f, 0.670965612f},
-std::array<float,2>{0.94798559f, 0.227708265f},
-std::array<float,2>{0.588118255f, 0.740353465f},
-std::array<float,2>{0.00324677094f, 0.130156934f},
-std::array<float,2>{0.306398094f, 0.870469868f},
-std::array<float,2>{0.858152092f, 0.445020378f},
-std::array<float,2>{0.888519824f, 0.946099222f},
-std::array<float,2>{0.403063864f, 0.352147877f},
-std::array<float,2>{0.190237418f, 0.590197086f},
-std::array<float,2>{0.667916238f, 0.0881928056f},
-std::array<float,2>{0.991567373f, 0.633303404f},
-std::array<float,2>{0.463902146f, 0.202179521f},
-std::array<float,2>{0.158098549f, 0.769572675f},
-std::array<float,2>{0.706290662f, 0.416590899f},
-std::array<float,2>{0.513480067f, 0.884815037f},
-std::array<float,2>{0.0878419504f, 0.258990198f},
-std::array<float,2>{0.344760627f, 0.54124403f},
-std::array<float,2>{0.795560837f, 0.0296295825f},
-std::array<float,2>{0.632070422f, 0.60059607f},
-std::array<float,2>{0.247380465f, 0.110246338f},
-std::array<float,2>{0.431221932f, 0.992538512f},
-std::array<float,2>{0.924686432f, 0.324189037f},
-std::array<float,2>{0.812974155f, 0.827051282f},
-std::array<float,2>{0.255382836f, 0.499970406f},
-std::array<float,2>{0.043485105f, 0.709411144f},
-std::array<float,2>{0.606248379f, 0.179591626f},
-std::array<float,2>{0.785419941f, 0.658661067f},
-std::array<float,2>{0.357507885f, 0.223800257f},
-std::array<float,2>{0.07834059f, 0.792520225f},
-std::array<float,2>{0.506870747f, 0.383995056f},
-std::array<float,2>{0.714779854f, 0.936058104f},
-std::array<float,2>{0.171560332f, 0.293691844f},
-std::array<float,2>{0.456825644f, 0.507130742f},
-std::array<float,2>{0.997339129f, 0.045060616f},
-std::array<float,2>{0.597612858f, 0.578338683f},
-std::array<float,2>{0.0372598208f, 0.0846851319f},
-std::array<float,2>{0.260273486f, 0.943273425f},
-std::array<float,2>{0.825366855f, 0.350322217f},
-std::array<float,2>{0.930349231f, 0.863446295f},
-std::array<float,2>{0.427109897f, 0.447237521f},
-std::array<float,2>{0.242015511f, 0.743668199f},
-std::array<float,2>{0.634501219f, 0.137925074f},
-std::array<float,2>{0.941461325f, 0.538771689f},
-std::array<float,2>{0.496452928f, 0.0181491654f},
-std::array<float,2>{0.133518875f, 0.880899251f},
-std::array<float,2>{0.746629417f, 0.25338158f},
-std::array<float,2>{0.558568776f, 0.77838552f},
-std::array<float,2>{0.0987710506f, 0.407937348f},
-std::array<float,2>{0.325057447f, 0.627670646f},
-std::array<float,2>{0.754304588f, 0.192751408f},
-std::array<float,2>{0.656661928f, 0.718355596f},
-std::array<float,2>{0.199758276f, 0.182101458f},
-std::array<float,2>{0.397714138f, 0.817745447f},
-std::array<float,2>{0.877284646f, 0.490867794f},
-std::array<float,2>{0.849843204f, 0.986948311f},
-std::array<float,2>{0.302737743f, 0.31627208f},
-std::array<float,2>{0.0130790779f, 0.607888758f},
-std::array<float,2>{0.580492258f, 0.12268246f},
-std::array<float,2>{0.83458972f, 0.611460686f},
-std::array<float,2>{0.268511653f, 0.10200768f},
-std::array<float,2>{0.0533250049f, 0.979882956f},
-std::array<float,2>{0.616113842f, 0.340903759f},
-std::array<float,2>{0.64357245f, 0.835831583f},
-std::array<float,2>{0.231324747f, 0.470254093f},
-std::array<float,2>{0.419345826f, 0.696675062f},
-std::array<float,2>{0.91934073f, 0.161631137f},
-std::array<float,2>{0.516360939f, 0.656139016f},
-std::array<float,2>{0.0639775544f, 0.206018642f},
-std::array<float,2>{0.3727521f, 0.762304604f},
-std::array<float,2>{0.798135817f, 0.426837534f},
-std::array<float,2>{0.983577132f, 0.898999333f},
-std::array<float,2>{0.450364321f, 0.270290673f},
-std::array<float,2>{0.177524805f, 0.547214389f},
-std::array<float,2>{0.697256267f, 0.00494640693f},
-std::array<float,2>{0.894795954f, 0.733725309f},
-std::array<float,2>{0.387834787f, 0.154276147f},
-std::array<float,2>{0.203426361f, 0.857037008f},
-std::array<float,2>{0.672406495f, 0.454828829f},
-std::array<float,2>{0.570679903f, 0.95854646f},
-std::array<float,2>{0.0261146054f, 0.370303273f},
-std::array<float,2>{0.289750814f, 0.57597369f},
-std::array<float,2>{0.86315757f, 0.0635828599f},
-std::array<float,2>{0.725195229f, 0.525157213f},
-std::array<float,2>{0.14458856f, 0.050971251f},
-std::array<float,2>{0.47597298f, 0.90833801f},
-std::array<float,2>{0.964099467f, 0.305932134f},
-std::array<float,2>{0.765902281f, 0.797970176f},
-std::array<float,2>{0.341341823f, 0.398010731f},
-std::array<float,2>{0.115543544f, 0.679504752f},
-std::array<float,2>{0.537027776f, 0.237458393f},
-std::array<float,2>{0.776098728f, 0.74910444f},
-std::array<float,2>{0.334334671f, 0.136540368f},
-std::array<float,2>{0.121462174f, 0.859540582f},
-std::array<float,2>{0.544043541f, 0.451342136f},
-std::array<float,2>{0.728383899f, 0.941214085f},
-std::array<float,2>{0.154186264f, 0.347273976f},
-std::array<float,2>{0.48063612f, 0.582505226f},
-std::array<float,2>{0.959148467f, 0.0800661817f},
-std::array<float,2>{0.567185938f, 0.503449082f},
-std::array<float,2>{0.020595111f, 0.0406783707f},
-std::array<float,2>{0.28438428f, 0.931764185f},
-std::array<float,2>{0.870162964f, 0.29259485f},
-std::array<float,2>{0.903700113f, 0.794420481f},
-std::array<float,2>{0.37735948f, 0.387653649f},
-std::array<float,2>{0.214778796f, 0.660505593f},
-std::array<float,2>{0.680693805f, 0.221405327f},
-std::array<float,2>{0.975122094f, 0.603282332f},
-std::array<float,2>{0.441305876f, 0.119799405f},
-std::array<float,2>{0.179861709f, 0.990847111f},
-std::array<float,2>{0.695060372f, 0.317842871f},
-std::array<float,2>{0.53082639f, 0.81485033f},
-std::array<float,2>{0.0767551363f, 0.486964077f},
-std::array<float,2>{0.360522628f, 0.712270796f},
-std::array<float,2>{0.806444407f, 0.184758186f},
-std::array<float,2>{0.65096128f, 0.63263756f},
-std::array<float,2>{0.225984931f, 0.188425019f},
-std::array<float,2>{0.407519728f, 0.774212837f},
-std::array<float,2>{0.910633802f, 0.410794169f},
-std::array<float,2>{0.836794972f, 0.877302885f},
-std::array<float,2>{0.281228006f, 0.254395127f},
-std::array<float,2>{0.0587287545f, 0.532536149f},
-std::array<float,2>{0.619585335f, 0.0226630569f},
-std::array<float,2>{0.853306711f, 0.553041458f},
-std::array<float,2>{0.310601562f, 0.000655173673f},
-std::array<float,2>{0.00460363971f, 0.905184209f},
-std::array<float,2>{0.590806127f, 0.267172813f},
-std::array<float,2>{0.671468973f, 0.760283232f},
-std::array<float,2>{0.195276722f, 0.423098296f},
-std::array<float,2>{0.402058929f, 0.649147749f},
-std::array<float,2>{0.886347234f, 0.208210543f},
-std::array<float,2>{0.549162269f, 0.699650288f},
-std::array<float,2>{0.104439333f, 0.158097968f},
-std::array<float,2>{0.313695282f, 0.82956183f},
-std::array<float,2>{0.758687437f, 0.473512888f},
-std::array<float,2>{0.950105965f, 0.981966376f},
-std::array<float,2>{0.491092056f, 0.338946909f},
-std::array<float,2>{0.126055554f, 0.613795877f},
-std::array<float,2>{0.735996306f, 0.109035686f},
-std::array<float,2>{0.927696407f, 0.675748944f},
-std::array<float,2>{0.434679687f, 0.241436481f},
-std::array<float,2>{0.242281824f, 0.801051199f},
-std::array<float,2>{0.627314746f, 0.393466055f},
-std::array<float,2>{0.60245347f, 0.910618663f},
-std::array<float,2>{0.0427774079f, 0.311223179f},
-std::array<float,2>{0.251393318f, 0.528968513f},
-std::array<float,2>{0.819229484f, 0.0470162742f},
-std::array<float,2>{0.707748294f, 0.573024809f},
-std::array<float,2>{0.163791403f, 0.0689345077f},
-std::array<float,2>{0.468502343f, 0.956385374f},
-std::array<float,2>{0.985821187f, 0.37289086f},
-std::array<float,2>{0.791173875f, 0.854725599f},
-std::array<float,2>{0.348888457f, 0.460374087f},
-std::array<float,2>{0.093495965f, 0.728783786f},
-std::array<float,2>{0.510634899f, 0.149317011f},
-std::array<float,2>{0.821323216f, 0.644249439f},
-std::array<float,2>{0.262357056f, 0.214857072f},
-std::array<float,2>{0.0321928486f, 0.755399942f},
-std::array<float,2>{0.597667575f, 0.437361985f},
-std::array<float,2>{0.637471437f, 0.897974968f},
-std::array<float,2>{0.237048194f, 0.275853753f},
-std::array<float,2>{0.425173074f, 0.558856189f},
-std::array<float,2>{0.936390877f, 0.0154345287f},
-std::array<float,2>{0.502422452f, 0.618422985f},
-std::array<float,2>{0.0849425346f, 0.0979666263f},
-std::array<float,2>{0.353056192f, 0.970980108f},
-std::array<float,2>{0.783299267f, 0.333286852f},
-std::array<float,2>{0.992435336f, 0.837318718f},
-std::array<float,2>{0.458503306f, 0.481735528f},
-std::array<float,2>{0.165123105f, 0.692098856f},
-std::array<float,2>{0.717195868f, 0.166334569f},
-std::array<float,2>{0.880458236f, 0.518741071f},
-std::array<float,2>{0.391934723f, 0.0616692565f},
-std::array<float,2>{0.198800981f, 0.920004308f},
-std::array<float,2>{0.662271261f, 0.296923459f},
-std::array<float,2>{0.583120584f, 0.805302739f},
-std::array<float,2>{0.0110160317f, 0.404224306f},
-std::array<float,2>{0.297705323f, 0.686731577f},
-std::array<float,2>{0.844037592f, 0.243207082f},
-std::array<float,2>{0.744945824f, 0.720998406f},
-std::array<float,2>{0.136807442f, 0.142400116f},
-std::array<float,2>{0.495638758f, 0.845179439f},
-std::array<float,2>{0.938728333f, 0.462574363f},
-std::array<float,2>{0.750419676f, 0.967759192f},
-std::array<float,2>{0.322979599f, 0.366240442f},
-std::array<float,2>{0.0970452726f, 0.568518281f},
-std::array<float,2>{0.561351895f, 0.0772603676f},
-std::array<float,2>{0.801359951f, 0.586503625f},
-std::array<float,2>{0.370618105f, 0.0912185982f},
-std::array<float,2>{0.0684704334f, 0.952215254f},
-std::array<float,2>{0.521992207f, 0.358717829f},
-std::array<float,2>{0.700050473f, 0.87309283f},
-std::array<float,2>{0.174095839f, 0.43841961f},
-std::array<float,2>{0.448415279f, 0.737127006f},
-std::array<float,2>{0.977484107f, 0.126147851f},
-std::array<float,2>{0.610073566f, 0.6663118f},
-std::array<float,2>{0.0507402569f, 0.234252408f},
-std::array<float,2>{0.271770418f, 0.786012709f},
-std::array<float,2>{0.828846753f, 0.376145184f},
-std::array<float,2>{0.914814472f, 0.922761321f},
-std::array<float,2>{0.416802436f, 0.28716132f},
-std::array<float,2>{0.228869513f, 0.508211315f},
-std::array<float,2>{0.645293355f, 0.0343173034f},
-std::array<float,2>{0.967493892f, 0.704394937f},
-std::array<float,2>{0.469795972f, 0.174719617f},
-std::array<float,2>{0.142166108f, 0.821823001f},
-std::array<float,2>{0.719443142f, 0.494912565f},
-std::array<float,2>{0.531610668f, 0.996509671f},
-std::array<float,2>{0.111120857f, 0.327191472f},
-std::array<float,2>{0.337580979f, 0.595727146f},
-std::array<float,2>{0.770429909f, 0.113836259f},
-std::array<float,2>{0.67952162f, 0.545065105f},
-std::array<float,2>{0.208050758f, 0.0238802861f},
-std::array<float,2>{0.385388076f, 0.888087094f},
-std::array<float,2>{0.891792119f, 0.26365146f},
-std::array<float,2>{0.865008593f, 0.767772138f},
-std::array<float,2>{0.294256091f, 0.420610964f},
-std::array<float,2>{0.0276803356f, 0.640535355f},
-std::array<float,2>{0.574313402f, 0.196046144f},
-std::array<float,2>{0.842410266f, 0.724324465f},
-std::array<float,2>{0.275876492f, 0.146087378f},
-std::array<float,2>{0.0553589575f, 0.851045907f},
-std::array<float,2>{0.622436285f, 0.465137601f},
-std::array<float,2>{0.654482424f, 0.964618385f},
-std::array<float,2>{0.220178694f, 0.363028616f},
-std::array<float,2>{0.413695604f, 0.56419456f},
-std::array<float,2>{0.906259894f, 0.0741600916f},
-std::array<float,2>{0.523844481f, 0.519586444f},
-std::array<float,2>{0.0714079067f, 0.0580571108f},
-std::array<float,2>{0.365193129f, 0.916207314f},
-std::array<float,2>{0.811409175f, 0.301684171f},
-std::array<float,2>{0.96957612f, 0.810052574f},
-std::array<float,2>{0.442881137f, 0.39871943f},
-std::array<float,2>{0.184216365f, 0.680450499f},
-std::array<float,2>{0.691402435f, 0.247684285f},
-std::array<float,2>{0.900827765f, 0.623179495f},
-std::array<float,2>{0.380457073f, 0.0967779458f},
-std::array<float,2>{0.217274025f, 0.972825944f},
-std::array<float,2>{0.685473621f, 0.328594267f},
-std::array<float,2>{0.566025794f, 0.842178404f},
-std::array<float,2>{0.0166485589f, 0.478262872f},
-std::array<float,2>{0.287386537f, 0.689837575f},
-std::array<float,2>{0.871498466f, 0.171822622f},
-std::array<float,2>{0.7332142f, 0.644532204f},
-std::array<float,2>{0.150225997f, 0.212033778f},
-std::array<float,2>{0.479503751f, 0.752578318f},
-std::array<float,2>{0.955762386f, 0.430944115f},
-std::array<float,2>{0.777549326f, 0.892147243f},
-std::array<float,2>{0.33048901f, 0.278531343f},
-std::array<float,2>{0.118663624f, 0.557728589f},
-std::array<float,2>{0.541216075f, 0.00888960529f},
-std::array<float,2>{0.793104053f, 0.539861679f},
-std::array<float,2>{0.347351998f, 0.0277134143f},
-std::array<float,2>{0.0882489234f, 0.883654416f},
-std::array<float,2>{0.514818311f, 0.260872751f},
-std::array<float,2>{0.703191698f, 0.773208737f},
-std::array<float,2>{0.158209249f, 0.414387107f},
-std::array<float,2>{0.461201012f, 0.634828806f},
-std::array<float,2>{0.989792109f, 0.199232996f},
-std::array<float,2>{0.60900718f, 0.707768202f},
-std::array<float,2>{0.0467114933f, 0.176959917f},
-std::array<float,2>{0.257426322f, 0.825852513f},
-std::array<float,2>{0.816330135f, 0.496748716f},
-std::array<float,2>{0.923528492f, 0.995018184f},
-std::array<float,2>{0.433248132f, 0.321822703f},
-std::array<float,2>{0.24820599f, 0.597855628f},
-std::array<float,2>{0.629590929f, 0.112647712f},
-std::array<float,2>{0.9471609f, 0.669425666f},
-std::array<float,2>{0.484671593f, 0.229712799f},
-std::array<float,2>{0.1328004f, 0.783069968f},
-std::array<float,2>{0.740766823f, 0.382410645f},
-std::array<float,2>{0.553221226f, 0.929028451f},
-std::array<float,2>{0.105539098f, 0.28294012f},
-std::array<float,2>{0.317222267f, 0.515304267f},
-std::array<float,2>{0.762224436f, 0.0355974138f},
-std::array<float,2>{0.664168775f, 0.592052639f},
-std::array<float,2>{0.188077748f, 0.0867241621f},
-std::array<float,2>{0.405050427f, 0.947716177f},
-std::array<float,2>{0.890376031f, 0.355303913f},
-std::array<float,2>{0.856267691f, 0.86847496f},
-std::array<float,2>{0.308390558f, 0.441827595f},
-std::array<float,2>{0.000874227146f, 0.740169942f},
-std::array<float,2>{0.586988091f, 0.131498948f},
-std::array<float,2>{0.757718861f, 0.625399649f},
-std::array<float,2>{0.327279449f, 0.194455341f},
-std::array<float,2>{0.101541065f, 0.779996216f},
-std::array<float,2>{0.555028379f, 0.408468217f},
-std::array<float,2>{0.749855161f, 0.880482197f},
-std::array<float,2>{0.135887355f, 0.251502067f},
-std::array<float,2>{0.498823434f, 0.535826743f},
-std::array<float,2>{0.943630755f, 0.0170252565f},
-std::array<float,2>{0.578273356f, 0.606670618f},
-std::array<float,2>{0.0146895414f, 0.12326245f},
-std::array<float,2>{0.302025735f, 0.985347807f},
-std::array<float,2>{0.849258065f, 0.314022481f},
-std::array<float,2>{0.875670731f, 0.819454789f},
-std::array<float,2>{0.395081967f, 0.489215732f},
-std::array<float,2>{0.201572463f, 0.716353178f},
-std::array<float,2>{0.659389496f, 0.18101874f},
-std::array<float,2>{0.998957098f, 0.505041242f},
-std::array<float,2>{0.454578549f, 0.0435674973f},
-std::array<float,2>{0.169256702f, 0.933733523f},
-std::array<float,2>{0.711478531f, 0.295914263f},
-std::array<float,2>{0.50468272f, 0.79009825f},
-std::array<float,2>{0.0819828436f, 0.386130303f},
-std::array<float,2>{0.357256919f, 0.657987714f},
-std::array<float,2>{0.788102686f, 0.225405529f},
-std::array<float,2>{0.636051178f, 0.744840145f},
-std::array<float,2>{0.238883555f, 0.140079319f},
-std::array<float,2>{0.429496944f, 0.865623891f},
-std::array<float,2>{0.932792962f, 0.448043376f},
-std::array<float,2>{0.826976955f, 0.943680882f},
-std::array<float,2>{0.258616835f, 0.348921508f},
-std::array<float,2>{0.035620898f, 0.582002282f},
-std::array<float,2>{0.595588982f, 0.083857365f},
-std::array<float,2>{0.861203671f, 0.577162862f},
-std::array<float,2>{0.292238414f, 0.0651154295f},
-std::array<float,2>{0.0239701793f, 0.96032232f},
-std::array<float,2>{0.574056327f, 0.368611455f},
-std::array<float,2>{0.674470305f, 0.857898176f},
-std::array<float,2>{0.206134528f, 0.455702603f},
-std::array<float,2>{0.390091151f, 0.730558932f},
-std::array<float,2>{0.897273302f, 0.155572653f},
-std::array<float,2>{0.53788048f, 0.676914632f},
-std::array<float,2>{0.113712542f, 0.23620306f},
-std::array<float,2>{0.34316355f, 0.800696015f},
-std::array<float,2>{0.767692149f, 0.395249486f},
-std::array<float,2>{0.960953712f, 0.90787667f},
-std::array<float,2>{0.4738774f, 0.307737529f},
-std::array<float,2>{0.148387268f, 0.526877224f},
-std::array<float,2>{0.72385329f, 0.0540827885f},
-std::array<float,2>{0.920134425f, 0.697455943f},
-std::array<float,2>{0.420917183f, 0.16218923f},
-std::array<float,2>{0.234241247f, 0.833284259f},
-std::array<float,2>{0.640785635f, 0.471232951f},
-std::array<float,2>{0.614050627f, 0.976738274f},
-std::array<float,2>{0.0507920049f, 0.343261063f},
-std::array<float,2>{0.267510891f, 0.610367715f},
-std::array<float,2>{0.833964348f, 0.105438516f},
-std::array<float,2>{0.69787544f, 0.549852014f},
-std::array<float,2>{0.177997068f, 0.00630580215f},
-std::array<float,2>{0.452077448f, 0.901303291f},
-std::array<float,2>{0.981771052f, 0.273379654f},
-std::array<float,2>{0.80028379f, 0.764416099f},
-std::array<float,2>{0.373275459f, 0.429383665f},
-std::array<float,2>{0.0657297969f, 0.653752804f},
-std::array<float,2>{0.519165337f, 0.204751819f},
-std::array<float,2>{0.807588816f, 0.714090407f},
-std::array<float,2>{0.362467945f, 0.185898125f},
-std::array<float,2>{0.0756432191f, 0.813873887f},
-std::array<float,2>{0.527426302f, 0.485083729f},
-std::array<float,2>{0.693073869f, 0.989281118f},
-std::array<float,2>{0.183254734f, 0.318374604f},
-std::array<float,2>{0.439079136f, 0.603807092f},
-std::array<float,2>{0.974098742f, 0.118604504f},
-std::array<float,2>{0.617856383f, 0.534780383f},
-std::array<float,2>{0.0614650398f, 0.0207040552f},
-std::array<float,2>{0.278731942f, 0.876762748f},
-std::array<float,2>{0.839007974f, 0.257665545f},
-std::array<float,2>{0.913625598f, 0.776699781f},
-std::array<float,2>{0.409748673f, 0.41266194f},
-std::array<float,2>{0.223752141f, 0.630604386f},
-std::array<float,2>{0.649686217f, 0.190101027f},
-std::array<float,2>{0.958032787f, 0.585451126f},
-std::array<float,2>{0.482661515f, 0.0808945894f},
-std::array<float,2>{0.15434508f, 0.9392066f},
-std::array<float,2>{0.730060697f, 0.345202386f},
-std::array<float,2>{0.545681179f, 0.861694038f},
-std::array<float,2>{0.123322271f, 0.450692058f},
-std::array<float,2>{0.332423002f, 0.746945441f},
-std::array<float,2>{0.773909569f, 0.134559795f},
-std::array<float,2>{0.682461023f, 0.662820399f},
-std::array<float,2>{0.212410137f, 0.219758853f},
-std::array<float,2>{0.375904649f, 0.795169413f},
-std::array<float,2>{0.905694366f, 0.389547467f},
-std::array<float,2>{0.868340373f, 0.931212485f},
-std::array<float,2>{0.281700402f, 0.289447427f},
-std::array<float,2>{0.0226652082f, 0.501414418f},
-std::array<float,2>{0.56901139f, 0.0411549881f},
-std::array<float,2>{0.816604555f, 0.530349374f},
-std::array<float,2>{0.253093511f, 0.0505211614f},
-std::array<float,2>{0.0406893156f, 0.912792027f},
-std::array<float,2>{0.604801476f, 0.309816629f},
-std::array<float,2>{0.626220047f, 0.803466439f},
-std::array<float,2>{0.245065942f, 0.391827911f},
-std::array<float,2>{0.435885638f, 0.673821986f},
-std::array<float,2>{0.928733885f, 0.238572538f},
-std::array<float,2>{0.508681417f, 0.728121996f},
-std::array<float,2>{0.0916188955f, 0.151791155f},
-std::array<float,2>{0.350752294f, 0.852550983f},
-std::array<float,2>{0.790746868f, 0.457484365f},
-std::array<float,2>{0.98749876f, 0.954328954f},
-std::array<float,2>{0.465271026f, 0.374193043f},
-std::array<float,2>{0.161783442f, 0.570844471f},
-std::array<float,2>{0.710247695f, 0.0682293028f},
-std::array<float,2>{0.884565473f, 0.652130783f},
-std::array<float,2>{0.399275213f, 0.20932886f},
-std::array<float,2>{0.19152239f, 0.758867443f},
-std::array<float,2>{0.669181168f, 0.42495504f},
-std::array<float,2>{0.593343675f, 0.904280901f},
-std::array<float,2>{0.0074914475f, 0.267885387f},
-std::array<float,2>{0.309494585f, 0.551228523f},
-std::array<float,2>{0.853844643f, 0.00281715021f},
-std::array<float,2>{0.736800969f, 0.617134571f},
-std::array<float,2>{0.128673896f, 0.106814124f},
-std::array<float,2>{0.489589572f, 0.984178841f},
-std::array<float,2>{0.953109205f, 0.336721122f},
-std::array<float,2>{0.760073721f, 0.830814898f},
-std::array<float,2>{0.316026747f, 0.475285679f},
-std::array<float,2>{0.10211429f, 0.701503098f},
-std::array<float,2>{0.548315227f, 0.158574656f},
-std::array<float,2>{0.846153021f, 0.684606016f},
-std::array<float,2>{0.300351888f, 0.244776607f},
-std::array<float,2>{0.0078843832f, 0.806752861f},
-std::array<float,2>{0.585868418f, 0.404658288f},
-std::array<float,2>{0.660632193f, 0.919496536f},
-std::array<float,2>{0.196963593f, 0.300778419f},
-std::array<float,2>{0.393780887f, 0.516807675f},
-std::array<float,2>{0.882316053f, 0.0601800941f},
-std::array<float,2>{0.559540153f, 0.567297399f},
-std::array<float,2>{0.0948977172f, 0.0753484443f},
-std::array<float,2>{0.320764393f, 0.965441883f},
-std::array<float,2>{0.753090262f, 0.364723563f},
-std::array<float,2>{0.940485537f, 0.846087158f},
-std::array<float,2>{0.493383139f, 0.462911636f},
-std::array<float,2>{0.139280006f, 0.720447123f},
-std::array<float,2>{0.743684113f, 0.143174082f},
-std::array<float,2>{0.934251428f, 0.562431574f},
-std::array<float,2>{0.422082007f, 0.012106671f},
-std::array<float,2>{0.235449001f, 0.896408021f},
-std::array<float,2>{0.639744282f, 0.273890197f},
-std::array<float,2>{0.600584924f, 0.756741285f},
-std::array<float,2>{0.0334201381f, 0.43499881f},
-std::array<float,2>{0.265199363f, 0.641977131f},
-std::array<float,2>{0.823964059f, 0.218141645f},
-std::array<float,2>{0.715461433f, 0.695088446f},
-std::array<float,2>{0.166547373f, 0.164106995f},
-std::array<float,2>{0.460138142f, 0.839631617f},
-std::array<float,2>{0.994552255f, 0.482962191f},
-std::array<float,2>{0.782730699f, 0.969151318f},
-std::array<float,2>{0.354355007f, 0.335866928f},
-std::array<float,2>{0.0821035355f, 0.619289517f},
-std::array<float,2>{0.501180291f, 0.100135647f},
-std::array<float,2>{0.772909164f, 0.595597267f},
-std::array<float,2>{0.338072866f, 0.116149046f},
-std::array<float,2>{0.112631112f, 0.998770893f},
-std::array<float,2>{0.534871578f, 0.325798094f},
-std::array<float,2>{0.720980883f, 0.822930098f},
-std::array<float,2>{0.143764317f, 0.494128168f},
-std::array<float,2>{0.471445054f, 0.705348551f},
-std::array<float,2>{0.964947939f, 0.173406735f},
-std::array<float,2>{0.577568889f, 0.637545228f},
-std::array<float,2>{0.0309464019f, 0.19749023f},
-std::array<float,2>{0.296217382f, 0.766939223f},
-std::array<float,2>{0.866595507f, 0.419753999f},
-std::array<float,2>{0.892988861f, 0.889017224f},
-std::array<float,2>{0.384721369f, 0.264410943f},
-std::array<float,2>{0.209574923f, 0.544059157f},
-std::array<float,2>{0.677681029f, 0.0262393244f},
-std::array<float,2>{0.978828549f, 0.735882461f},
-std::array<float,2>{0.446584582f, 0.127206042f},
-std::array<float,2>{0.173505679f, 0.871474326f},
-std::array<float,2>{0.702961564f, 0.441043943f},
-std::array<float,2>{0.520748317f, 0.950221896f},
-std::array<float,2>{0.0676074699f, 0.356630355f},
-std::array<float,2>{0.367214113f, 0.589165986f},
-std::array<float,2>{0.803290546f, 0.0923689827f},
-std::array<float,2>{0.64789933f, 0.5111233f},
-std::array<float,2>{0.227414936f, 0.0330023281f},
-std::array<float,2>{0.415232867f, 0.925319672f},
-std::array<float,2>{0.917047143f, 0.286836654f},
-std::array<float,2>{0.831052423f, 0.787788749f},
-std::array<float,2>{0.270501524f, 0.378163964f},
-std::array<float,2>{0.0488241799f, 0.664776683f},
-std::array<float,2>{0.61320585f, 0.231353f},
-std::array<float,2>{0.862578869f, 0.731123745f},
-std::array<float,2>{0.289153427f, 0.155904263f},
-std::array<float,2>{0.0255460832f, 0.858256936f},
-std::array<float,2>{0.570837498f, 0.455117226f},
-std::array<float,2>{0.672232091f, 0.960897744f},
-std::array<float,2>{0.204025567f, 0.368746758f},
-std::array<float,2>{0.388223171f, 0.577802062f},
-std::array<float,2>{0.895113885f, 0.0648470148f},
-std::array<float,2>{0.536524415f, 0.52671963f},
-std::array<float,2>{0.116194963f, 0.0543675087f},
-std::array<float,2>{0.34118408f, 0.907602668f},
-std::array<float,2>{0.766381323f, 0.308134854f},
-std::array<float,2>{0.964516819f, 0.800182462f},
-std::array<float,2>{0.47652179f, 0.394970566f},
-std::array<float,2>{0.145032868f, 0.677657306f},
-std::array<float,2>{0.724955261f, 0.235792443f},
-std::array<float,2>{0.919753253f, 0.610861063f},
-std::array<float,2>{0.419701725f, 0.104543112f},
-std::array<float,2>{0.230678231f, 0.977241755f},
-std::array<float,2>{0.644476414f, 0.343320191f},
-std::array<float,2>{0.615556538f, 0.833844602f},
-std::array<float,2>{0.0527967997f, 0.471144229f},
-std::array<float,2>{0.267617881f, 0.697789669f},
-std::array<float,2>{0.834107637f, 0.162889466f},
-std::array<float,2>{0.696512103f, 0.654256403f},
-std::array<float,2>{0.177029535f, 0.204510361f},
-std::array<float,2>{0.451084346f, 0.764128923f},
-std::array<float,2>{0.984196663f, 0.4290407f},
-std::array<float,2>{0.798615456f, 0.900577605f},
-std::array<float,2>{0.372276127f, 0.272472054f},
-std::array<float,2>{0.0635682717f, 0.550473094f},
-std::array<float,2>{0.515764475f, 0.0064975298f},
-std::array<float,2>{0.754875898f, 0.535423338f},
-std::array<float,2>{0.324282348f, 0.0173872449f},
-std::array<float,2>{0.0994786099f, 0.879972219f},
-std::array<float,2>{0.557814658f, 0.251293331f},
-std::array<float,2>{0.746490896f, 0.779424608f},
-std::array<float,2>{0.133031517f, 0.408860296f},
-std::array<float,2>{0.497000694f, 0.625688016f},
-std::array<float,2>{0.942148507f, 0.195205107f},
-std::array<float,2>{0.580657005f, 0.715883136f},
-std::array<float,2>{0.013299753f, 0.181548148f},
-std::array<float,2>{0.303560197f, 0.819919944f},
-std::array<float,2>{0.850271344f, 0.48852542f},
-std::array<float,2>{0.877741754f, 0.984724641f},
-std::array<float,2>{0.398218513f, 0.313900918f},
-std::array<float,2>{0.199526057f, 0.607417166f},
-std::array<float,2>{0.65674293f, 0.123765245f},
-std::array<float,2>{0.997919738f, 0.657560349f},
-std::array<float,2>{0.456397533f, 0.224882692f},
-std::array<float,2>{0.171286985f, 0.790788889f},
-std::array<float,2>{0.713898301f, 0.386234492f},
-std::array<float,2>{0.507670462f, 0.93451488f},
-std::array<float,2>{0.0786699429f, 0.296642482f},
-std::array<float,2>{0.358302563f, 0.505376875f},
-std::array<float,2>{0.785881877f, 0.0431905203f},
-std::array<float,2>{0.633963048f, 0.58111006f},
-std::array<float,2>{0.241215706f, 0.0830528289f},
-std::array<float,2>{0.42769891f, 0.94407934f},
-std::array<float,2>{0.929827034f, 0.349513888f},
-std::array<float,2>{0.825874805f, 0.865951717f},
-std::array<float,2>{0.259935647f, 0.447653621f},
-std::array<float,2>{0.0380261391f, 0.744142532f},
-std::array<float,2>{0.596746683f, 0.140516385f},
-std::array<float,2>{0.795342982f, 0.635668635f},
-std::array<float,2>{0.345254511f, 0.199723572f},
-std::array<float,2>{0.0869542807f, 0.772814035f},
-std::array<float,2>{0.512710452f, 0.414938152f},
-std::array<float,2>{0.706905961f, 0.883138955f},
-std::array<float,2>{0.157553434f, 0.261421144f},
-std::array<float,2>{0.464804888f, 0.539211571f},
-std::array<float,2>{0.991921127f, 0.0280842315f},
-std::array<float,2>{0.605862379f, 0.598169684f},
-std::array<float,2>{0.0430531651f, 0.112965271f},
-std::array<float,2>{0.255222887f, 0.994557619f},
-std::array<float,2>{0.813001394f, 0.321645617f},
-std::array<float,2>{0.924071312f, 0.82558006f},
-std::array<float,2>{0.430680096f, 0.496368885f},
-std::array<float,2>{0.247915238f, 0.707454324f},
-std::array<float,2>{0.63258791f, 0.177246839f},
-std::array<float,2>{0.947389245f, 0.515103519f},
-std::array<float,2>{0.486472756f, 0.0359615907f},
-std::array<float,2>{0.129953772f, 0.929382145f},
-std::array<float,2>{0.738383889f, 0.282677144f},
-std::array<float,2>{0.552184582f, 0.782708704f},
-std::array<float,2>{0.108423278f, 0.382128567f},
-std::array<float,2>{0.318629354f, 0.669727325f},
-std::array<float,2>{0.764303148f, 0.230334058f},
-std::array<float,2>{0.667102993f, 0.739375055f},
-std::array<float,2>{0.189596862f, 0.131238639f},
-std::array<float,2>{0.402363092f, 0.869076788f},
-std::array<float,2>{0.888013542f, 0.442051381f},
-std::array<float,2>{0.857795954f, 0.947937727f},
-std::array<float,2>{0.305782676f, 0.354648143f},
-std::array<float,2>{0.00374838663f, 0.592759609f},
-std::array<float,2>{0.588739812f, 0.0862676874f},
-std::array<float,2>{0.840710461f, 0.563756704f},
-std::array<float,2>{0.273438573f, 0.073576048f},
-std::array<float,2>{0.057989303f, 0.964104354f},
-std::array<float,2>{0.623722196f, 0.362781972f},
-std::array<float,2>{0.653318763f, 0.851382732f},
-std::array<float,2>{0.221052706f, 0.465705693f},
-std::array<float,2>{0.410679013f, 0.724049509f},
-std::array<float,2>{0.909990907f, 0.145923004f},
-std::array<float,2>{0.526783288f, 0.68000406f},
-std::array<float,2>{0.0739234164f, 0.247153595f},
-std::array<float,2>{0.366950274f, 0.810393035f},
-std::array<float,2>{0.809342742f, 0.399335712f},
-std::array<float,2>{0.971813977f, 0.916810691f},
-std::array<float,2>{0.445069432f, 0.300989032f},
-std::array<float,2>{0.187258914f, 0.520391107f},
-std::array<float,2>{0.68779999f, 0.0583390296f},
-std::array<float,2>{0.899570048f, 0.690139055f},
-std::array<float,2>{0.381064266f, 0.171369627f},
-std::array<float,2>{0.216523871f, 0.842652678f},
-std::array<float,2>{0.686825871f, 0.477561265f},
-std::array<float,2>{0.563659012f, 0.973525763f},
-std::array<float,2>{0.0192122497f, 0.328776419f},
-std::array<float,2>{0.285167813f, 0.623832822f},
-std::array<float,2>{0.873768449f, 0.097292766f},
-std::array<float,2>{0.732257485f, 0.558289587f},
-std::array<float,2>{0.151565984f, 0.00975590851f},
-std::array<float,2>{0.478394717f, 0.891901195f},
-std::array<float,2>{0.954139829f, 0.278957129f},
-std::array<float,2>{0.780868769f, 0.75219965f},
-std::array<float,2>{0.329203367f, 0.431436896f},
-std::array<float,2>{0.120819189f, 0.645346284f},
-std::array<float,2>{0.540869534f, 0.212758586f},
-std::array<float,2>{0.769952714f, 0.705925107f},
-std::array<float,2>{0.337335467f, 0.173201248f},
-std::array<float,2>{0.110435016f, 0.822694182f},
-std::array<float,2>{0.531786919f, 0.493169636f},
-std::array<float,2>{0.718799472f, 0.998367906f},
-std::array<float,2>{0.141987696f, 0.32562989f},
-std::array<float,2>{0.470561713f, 0.594834208f},
-std::array<float,2>{0.967063844f, 0.115267649f},
-std::array<float,2>{0.575187027f, 0.544713616f},
-std::array<float,2>{0.0282845423f, 0.0254402161f},
-std::array<float,2>{0.294573367f, 0.889174104f},
-std::array<float,2>{0.864660382f, 0.264091253f},
-std::array<float,2>{0.892327249f, 0.767484903f},
-std::array<float,2>{0.385250717f, 0.419304758f},
-std::array<float,2>{0.208532512f, 0.636808097f},
-std::array<float,2>{0.679058731f, 0.198149979f},
-std::array<float,2>{0.976654112f, 0.58944875f},
-std::array<float,2>{0.448742151f, 0.0922470689f},
-std::array<float,2>{0.174725339f, 0.950966716f},
-std::array<float,2>{0.699391782f, 0.357077003f},
-std::array<float,2>{0.52153784f, 0.871715069f},
-std::array<float,2>{0.068848595f, 0.440804273f},
-std::array<float,2>{0.370604664f, 0.735818684f},
-std::array<float,2>{0.80092746f, 0.127830625f},
-std::array<float,2>{0.644714296f, 0.664397955f},
-std::array<float,2>{0.229132742f, 0.230611861f},
-std::array<float,2>{0.416429996f, 0.787148356f},
-std::array<float,2>{0.914537787f, 0.378418297f},
-std::array<float,2>{0.828474939f, 0.924849868f},
-std::array<float,2>{0.272229522f, 0.286252201f},
-std::array<float,2>{0.0498756878f, 0.511615038f},
-std::array<float,2>{0.609626472f, 0.0324720219f},
-std::array<float,2>{0.844639659f, 0.517305851f},
-std::array<float,2>{0.297260851f, 0.0598436072f},
-std::array<float,2>{0.0113540571f, 0.919265985f},
-std::array<float,2>{0.583598912f, 0.299870878f},
-std::array<float,2>{0.662771285f, 0.807240188f},
-std::array<float,2>{0.19834052f, 0.405108064f},
-std::array<float,2>{0.392374784f, 0.685494959f},
-std::array<float,2>{0.880341709f, 0.244548932f},
-std::array<float,2>{0.560943305f, 0.719956875f},
-std::array<float,2>{0.0974986181f, 0.142600819f},
-std::array<float,2>{0.322277188f, 0.846197426f},
-std::array<float,2>{0.750653684f, 0.463536918f},
-std::array<float,2>{0.939113915f, 0.965045571f},
-std::array<float,2>{0.495429039f, 0.365174145f},
-std::array<float,2>{0.137528524f, 0.566472769f},
-std::array<float,2>{0.744532108f, 0.0757433325f},
-std::array<float,2>{0.935999691f, 0.642503798f},
-std::array<float,2>{0.425304651f, 0.218497023f},
-std::array<float,2>{0.236522824f, 0.756288528f},
-std::array<float,2>{0.637111425f, 0.435304403f},
-std::array<float,2>{0.598279476f, 0.895870447f},
-std::array<float,2>{0.0313718244f, 0.274392486f},
-std::array<float,2>{0.262054712f, 0.561891973f},
-std::array<float,2>{0.82224226f, 0.0125316409f},
-std::array<float,2>{0.717488885f, 0.620116174f},
-std::array<float,2>{0.165839642f, 0.0996323526f},
-std::array<float,2>{0.458427399f, 0.969296992f},
-std::array<float,2>{0.9929263f, 0.335104197f},
-std::array<float,2>{0.784018278f, 0.839231133f},
-std::array<float,2>{0.352979004f, 0.482645869f},
-std::array<float,2>{0.0842401981f, 0.694666088f},
-std::array<float,2>{0.502688885f, 0.165024772f},
-std::array<float,2>{0.818740904f, 0.673092484f},
-std::array<float,2>{0.251621276f, 0.239098042f},
-std::array<float,2>{0.0422760993f, 0.803016961f},
-std::array<float,2>{0.602042615f, 0.392361104f},
-std::array<float,2>{0.627655625f, 0.912580073f},
-std::array<float,2>{0.242960364f, 0.310437232f},
-std::array<float,2>{0.435429484f, 0.531213999f},
-std::array<float,2>{0.927033782f, 0.050256107f},
-std::array<float,2>{0.510196745f, 0.570763826f},
-std::array<float,2>{0.0931519642f, 0.067602545f},
-std::array<float,2>{0.349401146f, 0.954759479f},
-std::array<float,2>{0.791542113f, 0.374725133f},
-std::array<float,2>{0.986021876f, 0.853187144f},
-std::array<float,2>{0.468081892f, 0.457686782f},
-std::array<float,2>{0.163332313f, 0.72782737f},
-std::array<float,2>{0.707118154f, 0.152051374f},
-std::array<float,2>{0.885926902f, 0.551664948f},
-std::array<float,2>{0.401730746f, 0.00240459526f},
-std::array<float,2>{0.194636822f, 0.903682053f},
-std::array<float,2>{0.671126068f, 0.268191606f},
-std::array<float,2>{0.589984596f, 0.759459376f},
-std::array<float,2>{0.00422701193f, 0.425316721f},
-std::array<float,2>{0.311404556f, 0.65165621f},
-std::array<float,2>{0.853017628f, 0.209516868f},
-std::array<float,2>{0.735498071f, 0.701706052f},
-std::array<float,2>{0.126876622f, 0.159034222f},
-std::array<float,2>{0.490455419f, 0.830447495f},
-std::array<float,2>{0.949693382f, 0.474896878f},
-std::array<float,2>{0.757904887f, 0.983542144f},
-std::array<float,2>{0.314309657f, 0.33622691f},
-std::array<float,2>{0.103531189f, 0.616639853f},
-std::array<float,2>{0.549723446f, 0.107112005f},
-std::array<float,2>{0.805838227f, 0.604415834f},
-std::array<float,2>{0.360927761f, 0.11905282f},
-std::array<float,2>{0.076451689f, 0.989834547f},
-std::array<float,2>{0.530439198f, 0.319285005f},
-std::array<float,2>{0.694405019f, 0.81421721f},
-std::array<float,2>{0.180277064f, 0.48438254f},
-std::array<float,2>{0.440763474f, 0.714696705f},
-std::array<float,2>{0.974713683f, 0.186053485f},
-std::array<float,2>{0.619977713f, 0.630298436f},
-std::array<float,2>{0.0591903552f, 0.189610153f},
-std::array<float,2>{0.280448794f, 0.776903331f},
-std::array<float,2>{0.836318612f, 0.412483811f},
-std::array<float,2>{0.910856128f, 0.876356483f},
-std::array<float,2>{0.40782389f, 0.257253587f},
-std::array<float,2>{0.226464391f, 0.534385443f},
-std::array<float,2>{0.650505543f, 0.0210318044f},
-std::array<float,2>{0.959683239f, 0.746451974f},
-std::array<float,2>{0.481254309f, 0.134270102f},
-std::array<float,2>{0.15346691f, 0.862163901f},
-std::array<float,2>{0.7279917f, 0.450208545f},
-std::array<float,2>{0.544508576f, 0.93880254f},
-std::array<float,2>{0.121828422f, 0.345701545f},
-std::array<float,2>{0.334516674f, 0.585105121f},
-std::array<float,2>{0.775695384f, 0.0805241987f},
-std::array<float,2>{0.681164563f, 0.501862824f},
-std::array<float,2>{0.214045838f, 0.0415992513f},
-std::array<float,2>{0.377583146f, 0.931143939f},
-std::array<float,2>{0.903885543f, 0.29001978f},
-std::array<float,2>{0.870754004f, 0.795435548f},
-std::array<float,2>{0.284678191f, 0.389020532f},
-std::array<float,2>{0.0211750343f, 0.662298203f},
-std::array<float,2>{0.566754282f, 0.220412746f},
-std::array<float,2>{0.833252847f, 0.696855307f},
-std::array<float,2>{0.266951829f, 0.161341548f},
-std::array<float,2>{0.0515105426f, 0.835081637f},
-std::array<float,2>{0.613590598f, 0.470196545f},
-std::array<float,2>{0.641480684f, 0.980458617f},
-std::array<float,2>{0.233792409f, 0.341639459f},
-std::array<float,2>{0.421530694f, 0.611880302f},
-std::array<float,2>{0.920697749f, 0.102449059f},
-std::array<float,2>{0.518802941f, 0.547813833f},
-std::array<float,2>{0.0663939938f, 0.00578671228f},
-std::array<float,2>{0.37402305f, 0.898759305f},
-std::array<float,2>{0.800381839f, 0.269607663f},
-std::array<float,2>{0.982251227f, 0.761778057f},
-std::array<float,2>{0.451477855f, 0.427670926f},
-std::array<float,2>{0.178291097f, 0.655342996f},
-std::array<float,2>{0.697376668f, 0.205204025f},
-std::array<float,2>{0.89685446f, 0.575485587f},
-std::array<float,2>{0.390602648f, 0.063971512f},
-std::array<float,2>{0.206913829f, 0.958369553f},
-std::array<float,2>{0.674008071f, 0.37060976f},
-std::array<float,2>{0.573335886f, 0.856913209f},
-std::array<float,2>{0.023543613f, 0.454418033f},
-std::array<float,2>{0.292932063f, 0.734305382f},
-std::array<float,2>{0.860720873f, 0.153494358f},
-std::array<float,2>{0.724582434f, 0.678939819f},
-std::array<float,2>{0.14780812f, 0.237905428f},
-std::array<float,2>{0.474162161f, 0.798681498f},
-std::array<float,2>{0.961890697f, 0.397690475f},
-std::array<float,2>{0.768547297f, 0.909166157f},
-std::array<float,2>{0.343262106f, 0.306465894f},
-std::array<float,2>{0.114129551f, 0.524727643f},
-std::array<float,2>{0.537236989f, 0.0515480638f},
-std::array<float,2>{0.788817406f, 0.507513344f},
-std::array<float,2>{0.356596589f, 0.0456876718f},
-std::array<float,2>{0.0815300569f, 0.935567081f},
-std::array<float,2>{0.504283726f, 0.293010712f},
-std::array<float,2>{0.711290121f, 0.792350888f},
-std::array<float,2>{0.169434309f, 0.384556442f},
-std::array<float,2>{0.454654604f, 0.65883559f},
-std::array<float,2>{0.998526037f, 0.224373296f},
-std::array<float,2>{0.594941795f, 0.743421435f},
-std::array<float,2>{0.0357699841f, 0.138189971f},
-std::array<float,2>{0.257895678f, 0.863775373f},
-std::array<float,2>{0.82638371f, 0.446624666f},
-std::array<float,2>{0.933486104f, 0.942561865f},
-std::array<float,2>{0.428843796f, 0.349841446f},
-std::array<float,2>{0.238632247f, 0.578756392f},
-std::array<float,2>{0.636608362f, 0.0840693563f},
-std::array<float,2>{0.944206834f, 0.627435088f},
-std::array<float,2>{0.498238981f, 0.193093047f},
-std::array<float,2>{0.136520088f, 0.778962076f},
-std::array<float,2>{0.749120116f, 0.407319307f},
-std::array<float,2>{0.555203438f, 0.881799221f},
-std::array<float,2>{0.100674808f, 0.253828973f},
-std::array<float,2>{0.327793121f, 0.538498878f},
-std::array<float,2>{0.757185459f, 0.0180068724f},
-std::array<float,2>{0.659808993f, 0.608091056f},
-std::array<float,2>{0.201789126f, 0.122101434f},
-std::array<float,2>{0.394868821f, 0.986727953f},
-std::array<float,2>{0.875433445f, 0.315622002f},
-std::array<float,2>{0.849071622f, 0.818256199f},
-std::array<float,2>{0.30257979f, 0.490376621f},
-std::array<float,2>{0.0152984159f, 0.717783689f},
-std::array<float,2>{0.57862246f, 0.18251045f},
-std::array<float,2>{0.762015939f, 0.671504617f},
-std::array<float,2>{0.316856533f, 0.228309885f},
-std::array<float,2>{0.105972596f, 0.784140706f},
-std::array<float,2>{0.553339124f, 0.379013389f},
-std::array<float,2>{0.740315497f, 0.926505208f},
-std::array<float,2>{0.131850705f, 0.283406615f},
-std::array<float,2>{0.484943271f, 0.51318866f},
-std::array<float,2>{0.946372271f, 0.0389809422f},
-std::array<float,2>{0.587516248f, 0.59054172f},
-std::array<float,2>{0.000134464281f, 0.0887844115f},
-std::array<float,2>{0.307960391f, 0.945634961f},
-std::array<float,2>{0.85589391f, 0.35187158f},
-std::array<float,2>{0.889870465f, 0.871052384f},
-std::array<float,2>{0.404479563f, 0.444488674f},
-std::array<float,2>{0.1876522f, 0.741182268f},
-std::array<float,2>{0.664676785f, 0.130660281f},
-std::array<float,2>{0.989640355f, 0.541830719f},
-std::array<float,2>{0.461584628f, 0.029806817f},
-std::array<float,2>{0.158816114f, 0.885657072f},
-std::array<float,2>{0.703918576f, 0.259343743f},
-std::array<float,2>{0.515190363f, 0.770145655f},
-std::array<float,2>{0.0884009972f, 0.416309297f},
-std::array<float,2>{0.346875012f, 0.632924139f},
-std::array<float,2>{0.793837667f, 0.203060672f},
-std::array<float,2>{0.629339755f, 0.709947228f},
-std::array<float,2>{0.248607084f, 0.178932488f},
-std::array<float,2>{0.433021247f, 0.826598406f},
-std::array<float,2>{0.92331934f, 0.499308586f},
-std::array<float,2>{0.815534174f, 0.992977619f},
-std::array<float,2>{0.257152557f, 0.323642969f},
-std::array<float,2>{0.0462028794f, 0.601463437f},
-std::array<float,2>{0.608544886f, 0.109690398f},
-std::array<float,2>{0.871800244f, 0.621369898f},
-std::array<float,2>{0.28801918f, 0.0939069316f},
-std::array<float,2>{0.0173582546f, 0.975009799f},
-std::array<float,2>{0.565472245f, 0.330150723f},
-std::array<float,2>{0.684742153f, 0.840230525f},
-std::array<float,2>{0.217353508f, 0.479604244f},
-std::array<float,2>{0.380233169f, 0.688350201f},
-std::array<float,2>{0.901042163f, 0.168123916f},
-std::array<float,2>{0.541983604f, 0.64725244f},
-std::array<float,2>{0.118308201f, 0.213313639f},
-std::array<float,2>{0.330680907f, 0.751341224f},
-std::array<float,2>{0.778166652f, 0.431777656f},
-std::array<float,2>{0.955160737f, 0.89372772f},
-std::array<float,2>{0.480250061f, 0.280808717f},
-std::array<float,2>{0.149589777f, 0.555581272f},
-std::array<float,2>{0.732547522f, 0.0104091838f},
-std::array<float,2>{0.906859219f, 0.725852191f},
-std::array<float,2>{0.413147181f, 0.146822438f},
-std::array<float,2>{0.220239237f, 0.84811753f},
-std::array<float,2>{0.654838979f, 0.467134237f},
-std::array<float,2>{0.62286371f, 0.961580217f},
-std::array<float,2>{0.0547767393f, 0.360806704f},
-std::array<float,2>{0.276197344f, 0.564548671f},
-std::array<float,2>{0.842030048f, 0.071197547f},
-std::array<float,2>{0.690826297f, 0.521847844f},
-std::array<float,2>{0.183769837f, 0.0563904345f},
-std::array<float,2>{0.442493081f, 0.916008234f},
-std::array<float,2>{0.969100893f, 0.303386062f},
-std::array<float,2>{0.81072855f, 0.811097026f},
-std::array<float,2>{0.364296407f, 0.401397139f},
-std::array<float,2>{0.071927987f, 0.683109224f},
-std::array<float,2>{0.524172723f, 0.248405308f},
-std::array<float,2>{0.802981079f, 0.736603022f},
-std::array<float,2>{0.367773145f, 0.126582846f},
-std::array<float,2>{0.0681381673f, 0.873806715f},
-std::array<float,2>{0.521234334f, 0.437793016f},
-std::array<float,2>{0.702180624f, 0.952950716f},
-std::array<float,2>{0.173229918f, 0.35912931f},
-std::array<float,2>{0.446972519f, 0.5860039f},
-std::array<float,2>{0.979258716f, 0.0916737467f},
-std::array<float,2>{0.612441897f, 0.508564711f},
-std::array<float,2>{0.0478618219f, 0.0350789428f},
-std::array<float,2>{0.269628674f, 0.921901047f},
-std::array<float,2>{0.83018595f, 0.287624389f},
-std::array<float,2>{0.917615831f, 0.785443127f},
-std::array<float,2>{0.415642411f, 0.376869678f},
-std::array<float,2>{0.227043837f, 0.666542411f},
-std::array<float,2>{0.648233771f, 0.233422607f},
-std::array<float,2>{0.965813041f, 0.59628129f},
-std::array<float,2>{0.470774651f, 0.113314241f},
-std::array<float,2>{0.144463912f, 0.996910751f},
-std::array<float,2>{0.721211195f, 0.328102499f},
-std::array<float,2>{0.534234285f, 0.821503937f},
-std::array<float,2>{0.113028087f, 0.494501144f},
-std::array<float,2>{0.338454813f, 0.704686701f},
-std::array<float,2>{0.773349643f, 0.173943043f},
-std::array<float,2>{0.677179635f, 0.639905274f},
-std::array<float,2>{0.209283173f, 0.195701689f},
-std::array<float,2>{0.38403815f, 0.768224597f},
-std::array<float,2>{0.893471777f, 0.42039752f},
-std::array<float,2>{0.866986454f, 0.888553083f},
-std::array<float,2>{0.296600223f, 0.262713045f},
-std::array<float,2>{0.0306313764f, 0.545778513f},
-std::array<float,2>{0.5779863f, 0.0241474025f},
-std::array<float,2>{0.823714674f, 0.559492886f},
-std::array<float,2>{0.264724344f, 0.0148124211f},
-std::array<float,2>{0.0338738896f, 0.897768676f},
-std::array<float,2>{0.599705994f, 0.276155084f},
-std::array<float,2>{0.640618086f, 0.754966915f},
-std::array<float,2>{0.23612535f, 0.436677456f},
-std::array<float,2>{0.422751665f, 0.643572152f},
-std::array<float,2>{0.934049368f, 0.215800285f},
-std::array<float,2>{0.501918495f, 0.691790223f},
-std::array<float,2>{0.0829653516f, 0.166692093f},
-std::array<float,2>{0.353789598f, 0.837767243f},
-std::array<float,2>{0.782476068f, 0.482053727f},
-std::array<float,2>{0.994723678f, 0.971214414f},
-std::array<float,2>{0.460692585f, 0.333977669f},
-std::array<float,2>{0.166291788f, 0.618755519f},
-std::array<float,2>{0.715084612f, 0.0985471606f},
-std::array<float,2>{0.882448792f, 0.687015414f},
-std::array<float,2>{0.394526392f, 0.243743658f},
-std::array<float,2>{0.196432039f, 0.805153728f},
-std::array<float,2>{0.660953283f, 0.403549194f},
-std::array<float,2>{0.585433543f, 0.920426965f},
-std::array<float,2>{0.00847128592f, 0.29761225f},
-std::array<float,2>{0.300004184f, 0.519171119f},
-std::array<float,2>{0.846234739f, 0.0624704286f},
-std::array<float,2>{0.743175149f, 0.568930805f},
-std::array<float,2>{0.138909459f, 0.0779546425f},
-std::array<float,2>{0.493980676f, 0.966817915f},
-std::array<float,2>{0.941053987f, 0.367088139f},
-std::array<float,2>{0.753755033f, 0.845622003f},
-std::array<float,2>{0.321079254f, 0.462103039f},
-std::array<float,2>{0.0956483185f, 0.72154367f},
-std::array<float,2>{0.558755279f, 0.141777739f},
-std::array<float,2>{0.854255915f, 0.648458004f},
-std::array<float,2>{0.308690876f, 0.208885074f},
-std::array<float,2>{0.00706278998f, 0.760136306f},
-std::array<float,2>{0.592946649f, 0.423777074f},
-std::array<float,2>{0.669554889f, 0.904738903f},
-std::array<float,2>{0.192381278f, 0.266752481f},
-std::array<float,2>{0.398502648f, 0.553434312f},
-std::array<float,2>{0.88424933f, 0.00027835244f},
-std::array<float,2>{0.548625648f, 0.613351166f},
-std::array<float,2>{0.101901226f, 0.108698629f},
-std::array<float,2>{0.315595597f, 0.981569588f},
-std::array<float,2>{0.760601282f, 0.339668155f},
-std::array<float,2>{0.95250541f, 0.829845428f},
-std::array<float,2>{0.490110308f, 0.472686589f},
-std::array<float,2>{0.12838845f, 0.700034976f},
-std::array<float,2>{0.737250865f, 0.157536238f},
-std::array<float,2>{0.929637611f, 0.528503239f},
-std::array<float,2>{0.436108977f, 0.0474706739f},
-std::array<float,2>{0.244543672f, 0.910763383f},
-std::array<float,2>{0.626599014f, 0.311034977f},
-std::array<float,2>{0.605183005f, 0.801365733f},
-std::array<float,2>{0.0401525572f, 0.392917395f},
-std::array<float,2>{0.253538132f, 0.675168991f},
-std::array<float,2>{0.817074597f, 0.241996184f},
-std::array<float,2>{0.710822701f, 0.729121447f},
-std::array<float,2>{0.161483496f, 0.148759872f},
-std::array<float,2>{0.465617955f, 0.85526377f},
-std::array<float,2>{0.987994492f, 0.460799694f},
-std::array<float,2>{0.790345669f, 0.956825316f},
-std::array<float,2>{0.351305187f, 0.372300297f},
-std::array<float,2>{0.0908645764f, 0.572604597f},
-std::array<float,2>{0.507966876f, 0.0687227696f},
-std::array<float,2>{0.773961246f, 0.582848787f},
-std::array<float,2>{0.332893163f, 0.0793246478f},
-std::array<float,2>{0.124018885f, 0.940638721f},
-std::array<float,2>{0.545228541f, 0.34673515f},
-std::array<float,2>{0.729657352f, 0.860205412f},
-std::array<float,2>{0.154820159f, 0.45214045f},
-std::array<float,2>{0.483052611f, 0.749624431f},
-std::array<float,2>{0.958804786f, 0.135941207f},
-std::array<float,2>{0.568771303f, 0.661059678f},
-std::array<float,2>{0.023089895f, 0.221156508f},
-std::array<float,2>{0.281971991f, 0.794895291f},
-std::array<float,2>{0.868789792f, 0.387118965f},
-std::array<float,2>{0.906217933f, 0.932368517f},
-std::array<float,2>{0.375022143f, 0.292297691f},
-std::array<float,2>{0.212141722f, 0.503225505f},
-std::array<float,2>{0.682114124f, 0.0404105484f},
-std::array<float,2>{0.974607468f, 0.712874532f},
-std::array<float,2>{0.438789397f, 0.18547821f},
-std::array<float,2>{0.182962835f, 0.81518507f},
-std::array<float,2>{0.692403734f, 0.486725807f},
-std::array<float,2>{0.528102279f, 0.99067378f},
-std::array<float,2>{0.0761439055f, 0.318048924f},
-std::array<float,2>{0.362820923f, 0.602919877f},
-std::array<float,2>{0.806816518f, 0.119260028f},
-std::array<float,2>{0.650072217f, 0.532844901f},
-std::array<float,2>{0.224467114f, 0.0230870917f},
-std::array<float,2>{0.409602106f, 0.877843499f},
-std::array<float,2>{0.913209915f, 0.253923327f},
-std::array<float,2>{0.839531064f, 0.773501217f},
-std::array<float,2>{0.279236168f, 0.410404891f},
-std::array<float,2>{0.0606899261f, 0.631992221f},
-std::array<float,2>{0.61755079f, 0.187539712f},
-std::array<float,2>{0.85109669f, 0.71768266f},
-std::array<float,2>{0.304518193f, 0.182766438f},
-std::array<float,2>{0.0117212627f, 0.817282617f},
-std::array<float,2>{0.581332028f, 0.491356671f},
-std::array<float,2>{0.657709837f, 0.987594724f},
-std::array<float,2>{0.200308084f, 0.314786851f},
-std::array<float,2>{0.397450566f, 0.608622074f},
-std::array<float,2>{0.878680468f, 0.121752404f},
-std::array<float,2>{0.557452619f, 0.53732115f},
-std::array<float,2>{0.0983285084f, 0.0187578555f},
-std::array<float,2>{0.325957328f, 0.882361233f},
-std::array<float,2>{0.755269825f, 0.252113849f},
-std::array<float,2>{0.943180144f, 0.77744621f},
-std::array<float,2>{0.497103214f, 0.406630099f},
-std::array<float,2>{0.134703308f, 0.628735363f},
-std::array<float,2>{0.747201383f, 0.192058608f},
-std::array<float,2>{0.931331336f, 0.579212904f},
-std::array<float,2>{0.425965607f, 0.0855234489f},
-std::array<float,2>{0.241116479f, 0.942323446f},
-std::array<float,2>{0.633603811f, 0.351384401f},
-std::array<float,2>{0.596528769f, 0.864867508f},
-std::array<float,2>{0.0382110663f, 0.446145475f},
-std::array<float,2>{0.260820985f, 0.742400289f},
-std::array<float,2>{0.825035155f, 0.137249783f},
-std::array<float,2>{0.712947249f, 0.659333766f},
-std::array<float,2>{0.169971347f, 0.223561332f},
-std::array<float,2>{0.455955446f, 0.791983306f},
-std::array<float,2>{0.996983469f, 0.383395016f},
-std::array<float,2>{0.787015319f, 0.936999142f},
-std::array<float,2>{0.35883534f, 0.2946302f},
-std::array<float,2>{0.0796894431f, 0.505913377f},
-std::array<float,2>{0.506059468f, 0.046850726f},
-std::array<float,2>{0.767544329f, 0.52400291f},
-std::array<float,2>{0.340079248f, 0.0526143089f},
-std::array<float,2>{0.116583772f, 0.90937674f},
-std::array<float,2>{0.5357095f, 0.305547148f},
-std::array<float,2>{0.726398468f, 0.797072411f},
-std::array<float,2>{0.145764425f, 0.397452742f},
-std::array<float,2>{0.475290388f, 0.6783095f},
-std::array<float,2>{0.963616967f, 0.236946687f},
-std::array<float,2>{0.571774662f, 0.733267903f},
-std::array<float,2>{0.0269886348f, 0.152906641f},
-std::array<float,2>{0.290530145f, 0.85618943f},
-std::array<float,2>{0.862112522f, 0.453704208f},
-std::array<float,2>{0.895707846f, 0.957547009f},
-std::array<float,2>{0.386746109f, 0.369682878f},
-std::array<float,2>{0.204296574f, 0.574821115f},
-std::array<float,2>{0.672871828f, 0.0630567223f},
-std::array<float,2>{0.982793272f, 0.654880524f},
-std::array<float,2>{0.449393541f, 0.206962556f},
-std::array<float,2>{0.175938651f, 0.762923956f},
-std::array<float,2>{0.696164966f, 0.426572561f},
-std::array<float,2>{0.516817451f, 0.899539948f},
-std::array<float,2>{0.0627573431f, 0.271410078f},
-std::array<float,2>{0.371175647f, 0.548567951f},
-std::array<float,2>{0.797318459f, 0.00427619508f},
-std::array<float,2>{0.643094718f, 0.613199115f},
-std::array<float,2>{0.231720105f, 0.10304141f},
-std::array<float,2>{0.418378174f, 0.979198337f},
-std::array<float,2>{0.918345213f, 0.339869529f},
-std::array<float,2>{0.835067034f, 0.834914505f},
-std::array<float,2>{0.269465238f, 0.469304472f},
-std::array<float,2>{0.05431097f, 0.695608199f},
-std::array<float,2>{0.616570532f, 0.160701469f},
-std::array<float,2>{0.809727669f, 0.682288885f},
-std::array<float,2>{0.366099238f, 0.249989077f},
-std::array<float,2>{0.0729863867f, 0.811641574f},
-std::array<float,2>{0.525611043f, 0.400934905f},
-std::array<float,2>{0.689074576f, 0.915012121f},
-std::array<float,2>{0.186157569f, 0.304092884f},
-std::array<float,2>{0.443693221f, 0.522619843f},
-std::array<float,2>{0.971309602f, 0.0550272353f},
-std::array<float,2>{0.624484301f, 0.565593243f},
-std::array<float,2>{0.0572036803f, 0.0716344118f},
-std::array<float,2>{0.274861157f, 0.961953282f},
-std::array<float,2>{0.8408342f, 0.359703332f},
-std::array<float,2>{0.908950388f, 0.84909749f},
-std::array<float,2>{0.412070721f, 0.468412876f},
-std::array<float,2>{0.222422004f, 0.724994421f},
-std::array<float,2>{0.653321683f, 0.147498608f},
-std::array<float,2>{0.953398705f, 0.556059182f},
-std::array<float,2>{0.477297872f, 0.0109041138f},
-std::array<float,2>{0.150901511f, 0.89351052f},
-std::array<float,2>{0.731252193f, 0.279375553f},
-std::array<float,2>{0.53921479f, 0.750161111f},
-std::array<float,2>{0.119996361f, 0.433352917f},
-std::array<float,2>{0.328891307f, 0.648143411f},
-std::array<float,2>{0.779705167f, 0.214696765f},
-std::array<float,2>{0.685999393f, 0.688645422f},
-std::array<float,2>{0.215564966f, 0.169740602f},
-std::array<float,2>{0.382276446f, 0.841708541f},
-std::array<float,2>{0.89927429f, 0.479291797f},
-std::array<float,2>{0.874829769f, 0.976503372f},
-std::array<float,2>{0.286906511f, 0.331111342f},
-std::array<float,2>{0.0175836049f, 0.622296035f},
-std::array<float,2>{0.563240767f, 0.0955239311f},
-std::array<float,2>{0.814216971f, 0.600143313f},
-std::array<float,2>{0.253976762f, 0.110468857f},
-std::array<float,2>{0.0440960117f, 0.993658006f},
-std::array<float,2>{0.606674433f, 0.322613716f},
-std::array<float,2>{0.631187201f, 0.827758908f},
-std::array<float,2>{0.24682045f, 0.498370916f},
-std::array<float,2>{0.429820061f, 0.710652709f},
-std::array<float,2>{0.925138474f, 0.178341299f},
-std::array<float,2>{0.512358248f, 0.634719014f},
-std::array<float,2>{0.0865557194f, 0.201702058f},
-std::array<float,2>{0.343858987f, 0.771105051f},
-std::array<float,2>{0.796464205f, 0.417941868f},
-std::array<float,2>{0.990712047f, 0.886010408f},
-std::array<float,2>{0.463271022f, 0.258549184f},
-std::array<float,2>{0.156916723f, 0.542055666f},
-std::array<float,2>{0.705972731f, 0.0310813561f},
-std::array<float,2>{0.887684226f, 0.741275966f},
-std::array<float,2>{0.404115409f, 0.129068792f},
-std::array<float,2>{0.191298962f, 0.869443357f},
-std::array<float,2>{0.666437149f, 0.443962216f},
-std::array<float,2>{0.589373767f, 0.946374416f},
-std::array<float,2>{0.00241170195f, 0.352748662f},
-std::array<float,2>{0.305332363f, 0.591355681f},
-std::array<float,2>{0.858869612f, 0.0892888904f},
-std::array<float,2>{0.739430904f, 0.512415946f},
-std::array<float,2>{0.128921479f, 0.0375569798f},
-std::array<float,2>{0.488042891f, 0.92710954f},
-std::array<float,2>{0.948271871f, 0.284279674f},
-std::array<float,2>{0.764697433f, 0.784286737f},
-std::array<float,2>{0.320070833f, 0.380612403f},
-std::array<float,2>{0.107574135f, 0.670580626f},
-std::array<float,2>{0.551561952f, 0.226796165f},
-std::array<float,2>{0.751026332f, 0.722296953f},
-std::array<float,2>{0.324070156f, 0.14094013f},
-std::array<float,2>{0.0963984057f, 0.844088614f},
-std::array<float,2>{0.561742067f, 0.461272746f},
-std::array<float,2>{0.745836496f, 0.968175769f},
-std::array<float,2>{0.1381962f, 0.36576885f},
-std::array<float,2>{0.494294703f, 0.570100725f},
-std::array<float,2>{0.938284636f, 0.0768778771f},
-std::array<float,2>{0.582754314f, 0.518292427f},
-std::array<float,2>{0.0106549663f, 0.060869202f},
-std::array<float,2>{0.29810521f, 0.921622753f},
-std::array<float,2>{0.845173657f, 0.298618346f},
-std::array<float,2>{0.879225254f, 0.806318164f},
-std::array<float,2>{0.391325742f, 0.402613431f},
-std::array<float,2>{0.19756116f, 0.685677469f},
-std::array<float,2>{0.663823247f, 0.242556185f},
-std::array<float,2>{0.993687928f, 0.617307186f},
-std::array<float,2>{0.457874417f, 0.0994705856f},
-std::array<float,2>{0.164545968f, 0.972261429f},
-std::array<float,2>{0.718664467f, 0.33235833f},
-std::array<float,2>{0.503253162f, 0.836740077f},
-std::array<float,2>{0.0851157084f, 0.480788291f},
-std::array<float,2>{0.351790696f, 0.692965806f},
-std::array<float,2>{0.784194291f, 0.167020977f},
-std::array<float,2>{0.637934029f, 0.64274919f},
-std::array<float,2>{0.237311691f, 0.216036364f},
-std::array<float,2>{0.424778432f, 0.754696786f},
-std::array<float,2>{0.93708688f, 0.436037123f},
-std::array<float,2>{0.820730329f, 0.896935999f},
-std::array<float,2>{0.263468117f, 0.276523173f},
-std::array<float,2>{0.0327839106f, 0.559673667f},
-std::array<float,2>{0.599348545f, 0.0139004393f},
-std::array<float,2>{0.86389035f, 0.546687305f},
-std::array<float,2>{0.293641865f, 0.0249404497f},
-std::array<float,2>{0.0292397402f, 0.887069941f},
-std::array<float,2>{0.575931251f, 0.261893094f},
-std::array<float,2>{0.677973926f, 0.768601656f},
-std::array<float,2>{0.207771704f, 0.421422541f},
-std::array<float,2>{0.38649407f, 0.638876975f},
-std::array<float,2>{0.891066909f, 0.196492329f},
-std::array<float,2>{0.532917321f, 0.703926206f},
-std::array<float,2>{0.11008466f, 0.175087184f},
-std::array<float,2>{0.336470187f, 0.820437789f},
-std::array<float,2>{0.770685792f, 0.495552272f},
-std::array<float,2>{0.968347549f, 0.99745357f},
-std::array<float,2>{0.468934953f, 0.326194733f},
-std::array<float,2>{0.140744179f, 0.596932411f},
-std::array<float,2>{0.720128655f, 0.114910446f},
-std::array<float,2>{0.915814936f, 0.667140901f},
-std::array<float,2>{0.41765058f, 0.233394951f},
-std::array<float,2>{0.230348274f, 0.786277711f},
-std::array<float,2>{0.645610988f, 0.375850141f},
-std::array<float,2>{0.610951781f, 0.923725784f},
-std::array<float,2>{0.0491914973f, 0.288423628f},
-std::array<float,2>{0.273141086f, 0.508876681f},
-std::array<float,2>{0.829454303f, 0.0332747996f},
-std::array<float,2>{0.700858831f, 0.587370098f},
-std::array<float,2>{0.174867004f, 0.0900537223f},
-std::array<float,2>{0.447849095f, 0.951191306f},
-std::array<float,2>{0.977918565f, 0.357554913f},
-std::array<float,2>{0.80194068f, 0.87485534f},
-std::array<float,2>{0.369582593f, 0.439449161f},
-std::array<float,2>{0.069979459f, 0.737585008f},
-std::array<float,2>{0.522597253f, 0.12579076f},
-std::array<float,2>{0.836969554f, 0.631380439f},
-std::array<float,2>{0.279627681f, 0.189266428f},
-std::array<float,2>{0.0596042722f, 0.774478614f},
-std::array<float,2>{0.620238841f, 0.41175437f},
-std::array<float,2>{0.651529253f, 0.878668308f},
-std::array<float,2>{0.224652097f, 0.25576219f},
-std::array<float,2>{0.406901032f, 0.531656325f},
-std::array<float,2>{0.911632478f, 0.0219900794f},
-std::array<float,2>{0.529816449f, 0.602238715f},
-std::array<float,2>{0.077456668f, 0.120265633f},
-std::array<float,2>{0.359977126f, 0.991222262f},
-std::array<float,2>{0.805604756f, 0.316491872f},
-std::array<float,2>{0.975981712f, 0.815523267f},
-std::array<float,2>{0.439499974f, 0.488007903f},
-std::array<float,2>{0.181472301f, 0.711556375f},
-std::array<float,2>{0.693787277f, 0.183712333f},
-std::array<float,2>{0.903062046f, 0.502612531f},
-std::array<float,2>{0.378270894f, 0.0397790223f},
-std::array<float,2>{0.213083267f, 0.932910144f},
-std::array<float,2>{0.680374205f, 0.291354924f},
-std::array<float,2>{0.567409217f, 0.793363929f},
-std::array<float,2>{0.0196472406f, 0.388384908f},
-std::array<float,2>{0.28398183f, 0.661492169f},
-std::array<float,2>{0.869687855f, 0.221981466f},
-std::array<float,2>{0.726961613f, 0.748071313f},
-std::array<float,2>{0.152952656f, 0.135062009f},
-std::array<float,2>{0.481841743f, 0.86057359f},
-std::array<float,2>{0.960476935f, 0.453052878f},
-std::array<float,2>{0.77687794f, 0.939611077f},
-std::array<float,2>{0.335568309f, 0.346141994f},
-std::array<float,2>{0.122170821f, 0.583313227f},
-std::array<float,2>{0.54392159f, 0.0788249597f},
-std::array<float,2>{0.792461455f, 0.573954344f},
-std::array<float,2>{0.347721845f, 0.0695930719f},
-std::array<float,2>{0.0926139131f, 0.955095053f},
-std::array<float,2>{0.511166632f, 0.371354967f},
-std::array<float,2>{0.70832026f, 0.853949666f},
-std::array<float,2>{0.162374198f, 0.459060907f},
-std::array<float,2>{0.466879398f, 0.729858756f},
-std::array<float,2>{0.984561384f, 0.149615839f},
-std::array<float,2>{0.603497267f, 0.674443066f},
-std::array<float,2>{0.0417434797f, 0.240986213f},
-std::array<float,2>{0.250973284f, 0.802572727f},
-std::array<float,2>{0.820025861f, 0.393601745f},
-std::array<float,2>{0.926650584f, 0.911322534f},
-std::array<float,2>{0.434223741f, 0.312038839f},
-std::array<float,2>{0.244105682f, 0.528160095f},
-std::array<float,2>{0.628661036f, 0.0488268845f},
-std::array<float,2>{0.950623095f, 0.700632393f},
-std::array<float,2>{0.491278559f, 0.156582296f},
-std::array<float,2>{0.125100017f, 0.828263819f},
-std::array<float,2>{0.734885097f, 0.474176705f},
-std::array<float,2>{0.550564051f, 0.981194615f},
-std::array<float,2>{0.104947679f, 0.338652849f},
-std::array<float,2>{0.312612087f, 0.614863217f},
-std::array<float,2>{0.759221911f, 0.107660286f},
-std::array<float,2>{0.670653105f, 0.554107308f},
-std::array<float,2>{0.193914637f, 0.00151662843f},
-std::array<float,2>{0.400461555f, 0.905561388f},
-std::array<float,2>{0.885546863f, 0.266302317f},
-std::array<float,2>{0.851778984f, 0.761453927f},
-std::array<float,2>{0.312343568f, 0.422502816f},
-std::array<float,2>{0.00515208626f, 0.649817109f},
-std::array<float,2>{0.591486394f, 0.207530722f},
-std::array<float,2>{0.827519417f, 0.745235443f},
-std::array<float,2>{0.259433359f, 0.138967618f},
-std::array<float,2>{0.0362219699f, 0.867176414f},
-std::array<float,2>{0.594454229f, 0.448886156f},
-std::array<float,2>{0.635436237f, 0.944915473f},
-std::array<float,2>{0.239302054f, 0.347833812f},
-std::array<float,2>{0.428066075f, 0.580531001f},
-std::array<float,2>{0.932440579f, 0.0820452124f},
-std::array<float,2>{0.504915833f, 0.503922045f},
-std::array<float,2>{0.0802352354f, 0.0445629992f},
-std::array<float,2>{0.35585475f, 0.935244679f},
-std::array<float,2>{0.78806901f, 0.295135409f},
-std::array<float,2>{0.999981344f, 0.789200604f},
-std::array<float,2>{0.453266829f, 0.385492444f},
-std::array<float,2>{0.167975932f, 0.656387269f},
-std::array<float,2>{0.711932063f, 0.225871488f},
-std::array<float,2>{0.876231492f, 0.605948508f},
-std::array<float,2>{0.396259904f, 0.124886364f},
-std::array<float,2>{0.202789396f, 0.985785067f},
-std::array<float,2>{0.659061968f, 0.313030362f},
-std::array<float,2>{0.579502285f, 0.819205403f},
-std::array<float,2>{0.0137310838f, 0.490018934f},
-std::array<float,2>{0.300845861f, 0.715138197f},
-std::array<float,2>{0.848076463f, 0.179740429f},
-std::array<float,2>{0.748681903f, 0.626144767f},
-std::array<float,2>{0.135660455f, 0.19349353f},
-std::array<float,2>{0.49975571f, 0.780410767f},
-std::array<float,2>{0.944750547f, 0.410051793f},
-std::array<float,2>{0.756710649f, 0.879349828f},
-std::array<float,2>{0.326996922f, 0.250604898f},
-std::array<float,2>{0.100142665f, 0.536285043f},
-std::array<float,2>{0.556405067f, 0.015991725f},
-std::array<float,2>{0.799322784f, 0.54926753f},
-std::array<float,2>{0.37473011f, 0.00750317844f},
-std::array<float,2>{0.0651744753f, 0.901522815f},
-std::array<float,2>{0.51827246f, 0.271811247f},
-std::array<float,2>{0.698828518f, 0.764711201f},
-std::array<float,2>{0.179128766f, 0.42813617f},
-std::array<float,2>{0.452973187f, 0.652938187f},
-std::array<float,2>{0.981109858f, 0.203437403f},
-std::array<float,2>{0.614665508f, 0.698290646f},
-std::array<float,2>{0.0527188778f, 0.163348675f},
-std::array<float,2>{0.266247839f, 0.832792521f},
-std::array<float,2>{0.832254708f, 0.472327918f},
-std::array<float,2>{0.921740651f, 0.977553606f},
-std::array<float,2>{0.4206177f, 0.342698872f},
-std::array<float,2>{0.233117968f, 0.609997988f},
-std::array<float,2>{0.641654551f, 0.103688799f},
-std::array<float,2>{0.962730229f, 0.676242828f},
-std::array<float,2>{0.473048985f, 0.234486654f},
-std::array<float,2>{0.146724194f, 0.799362004f},
-std::array<float,2>{0.72285217f, 0.395545095f},
-std::array<float,2>{0.538272023f, 0.907102287f},
-std::array<float,2>{0.114956751f, 0.307567328f},
-std::array<float,2>{0.342449546f, 0.525437117f},
-std::array<float,2>{0.769495785f, 0.0533373319f},
-std::array<float,2>{0.67561841f, 0.576464534f},
-std::array<float,2>{0.20599623f, 0.0660602376f},
-std::array<float,2>{0.389528126f, 0.959929466f},
-std::array<float,2>{0.898086011f, 0.368106574f},
-std::array<float,2>{0.859733522f, 0.858841002f},
-std::array<float,2>{0.291566879f, 0.456700057f},
-std::array<float,2>{0.0252575036f, 0.732204914f},
-std::array<float,2>{0.572946727f, 0.155125082f},
-std::array<float,2>{0.778486609f, 0.645872474f},
-std::array<float,2>{0.331962764f, 0.211868003f},
-std::array<float,2>{0.117783904f, 0.753121555f},
-std::array<float,2>{0.542323589f, 0.430063367f},
-std::array<float,2>{0.734197676f, 0.890703917f},
-std::array<float,2>{0.148892388f, 0.278058916f},
-std::array<float,2>{0.479080319f, 0.557199299f},
-std::array<float,2>{0.956112325f, 0.00814728718f},
-std::array<float,2>{0.564752579f, 0.624593139f},
-std::array<float,2>{0.0162433852f, 0.0965978876f},
-std::array<float,2>{0.288251668f, 0.973765671f},
-std::array<float,2>{0.872621417f, 0.329460055f},
-std::array<float,2>{0.902098477f, 0.843181312f},
-std::array<float,2>{0.379517287f, 0.476880133f},
-std::array<float,2>{0.217889279f, 0.690554023f},
-std::array<float,2>{0.683683753f, 0.170240581f},
-std::array<float,2>{0.970270336f, 0.521287858f},
-std::array<float,2>{0.441884428f, 0.0570855029f},
-std::array<float,2>{0.184759825f, 0.917639971f},
-std::array<float,2>{0.689970791f, 0.302308708f},
-std::array<float,2>{0.524506211f, 0.808805704f},
-std::array<float,2>{0.0709299818f, 0.399541408f},
-std::array<float,2>{0.363306433f, 0.680685401f},
-std::array<float,2>{0.812420905f, 0.246881425f},
-std::array<float,2>{0.655734241f, 0.723018646f},
-std::array<float,2>{0.219418749f, 0.145101011f},
-std::array<float,2>{0.412155032f, 0.850008786f},
-std::array<float,2>{0.907236814f, 0.466690123f},
-std::array<float,2>{0.843677521f, 0.963452101f},
-std::array<float,2>{0.27644062f, 0.361989468f},
-std::array<float,2>{0.0565484241f, 0.563421667f},
-std::array<float,2>{0.621147335f, 0.0730805993f},
-std::array<float,2>{0.856795967f, 0.592900276f},
-std::array<float,2>{0.306784332f, 0.0872589275f},
-std::array<float,2>{0.0014763166f, 0.948726356f},
-std::array<float,2>{0.586592197f, 0.354215503f},
-std::array<float,2>{0.665259778f, 0.867487073f},
-std::array<float,2>{0.188632816f, 0.44241786f},
-std::array<float,2>{0.405960947f, 0.738572121f},
-std::array<float,2>{0.888701618f, 0.132561564f},
-std::array<float,2>{0.5542472f, 0.668659925f},
-std::array<float,2>{0.106574185f, 0.229466885f},
-std::array<float,2>{0.318234086f, 0.781592786f},
-std::array<float,2>{0.763352513f, 0.381724685f},
-std::array<float,2>{0.94602716f, 0.927753508f},
-std::array<float,2>{0.485506862f, 0.282135308f},
-std::array<float,2>{0.1310011f, 0.513871312f},
-std::array<float,2>{0.74132061f, 0.0366941653f},
-std::array<float,2>{0.922816396f, 0.708484948f},
-std::array<float,2>{0.431802273f, 0.175826728f},
-std::array<float,2>{0.249385089f, 0.824572802f},
-std::array<float,2>{0.630245924f, 0.497645676f},
-std::array<float,2>{0.607889175f, 0.995558798f},
-std::array<float,2>{0.0454293415f, 0.321192265f},
-std::array<float,2>{0.256217778f, 0.598957717f},
-std::array<float,2>{0.814733565f, 0.11142654f},
-std::array<float,2>{0.705041826f, 0.540784061f},
-std::array<float,2>{0.159283742f, 0.0286561269f},
-std::array<float,2>{0.462224215f, 0.884657264f},
-std::array<float,2>{0.98890996f, 0.259907871f},
-std::array<float,2>{0.794049144f, 0.772365868f},
-std::array<float,2>{0.345976979f, 0.415787965f},
-std::array<float,2>{0.0896321535f, 0.636498511f},
-std::array<float,2>{0.514519989f, 0.200209871f},
-std::array<float,2>{0.781463087f, 0.693632483f},
-std::array<float,2>{0.354787409f, 0.166007236f},
-std::array<float,2>{0.0833895281f, 0.837996006f},
-std::array<float,2>{0.500219643f, 0.484244615f},
-std::array<float,2>{0.716745675f, 0.969808459f},
-std::array<float,2>{0.167815477f, 0.334535241f},
-std::array<float,2>{0.459071904f, 0.620879889f},
-std::array<float,2>{0.995250762f, 0.101275235f},
-std::array<float,2>{0.601541996f, 0.560958326f},
-std::array<float,2>{0.0345522538f, 0.0131410751f},
-std::array<float,2>{0.264003009f, 0.89472717f},
-std::array<float,2>{0.822804391f, 0.274672598f},
-std::array<float,2>{0.934977949f, 0.757608354f},
-std::array<float,2>{0.423155546f, 0.434421659f},
-std::array<float,2>{0.234419808f, 0.641562462f},
-std::array<float,2>{0.639202356f, 0.21751155f},
-std::array<float,2>{0.93972069f, 0.568113625f},
-std::array<float,2>{0.492902786f, 0.0742230862f},
-std::array<float,2>{0.140237644f, 0.965874016f},
-std::array<float,2>{0.743102491f, 0.363960654f},
-std::array<float,2>{0.559809327f, 0.846905708f},
-std::array<float,2>{0.0938084722f, 0.464379519f},
-std::array<float,2>{0.321971267f, 0.719088733f},
-std::array<float,2>{0.752183557f, 0.143785909f},
-std::array<float,2>{0.661731601f, 0.683745146f},
-std::array<float,2>{0.19544594f, 0.245684013f},
-std::array<float,2>{0.392818898f, 0.807978213f},
-std::array<float,2>{0.881035209f, 0.406170875f},
-std::array<float,2>{0.846827745f, 0.918206394f},
-std::array<float,2>{0.299520612f, 0.299625844f},
-std::array<float,2>{0.00963796955f, 0.515698671f},
-std::array<float,2>{0.584618747f, 0.0589363314f},
-std::array<float,2>{0.831414461f, 0.510141611f},
-std::array<float,2>{0.270970583f, 0.0315528214f},
-std::array<float,2>{0.0477697589f, 0.924661279f},
-std::array<float,2>{0.61180687f, 0.285980999f},
-std::array<float,2>{0.64654696f, 0.788742781f},
-std::array<float,2>{0.227757499f, 0.377065569f},
-std::array<float,2>{0.414643079f, 0.665797114f},
-std::array<float,2>{0.916215241f, 0.232083008f},
-std::array<float,2>{0.520048499f, 0.735003173f},
-std::array<float,2>{0.0664524212f, 0.12829721f},
-std::array<float,2>{0.368296415f, 0.872574687f},
-std::array<float,2>{0.803880095f, 0.439511985f},
-std::array<float,2>{0.980315983f, 0.949937224f},
-std::array<float,2>{0.445404857f, 0.356321841f},
-std::array<float,2>{0.172561154f, 0.588125527f},
-std::array<float,2>{0.702089131f, 0.0936273262f},
-std::array<float,2>{0.894044161f, 0.638093233f},
-std::array<float,2>{0.382975578f, 0.19863838f},
-std::array<float,2>{0.210884228f, 0.766581595f},
-std::array<float,2>{0.676357746f, 0.418707877f},
-std::array<float,2>{0.576685727f, 0.890287697f},
-std::array<float,2>{0.0292978883f, 0.265505522f},
-std::array<float,2>{0.295226783f, 0.543904543f},
-std::array<float,2>{0.865348995f, 0.0266409088f},
-std::array<float,2>{0.722073257f, 0.594268143f},
-std::array<float,2>{0.142764807f, 0.11697831f},
-std::array<float,2>{0.471982777f, 0.999732852f},
-std::array<float,2>{0.966237187f, 0.324523896f},
-std::array<float,2>{0.77186662f, 0.823816359f},
-std::array<float,2>{0.339493394f, 0.492774069f},
-std::array<float,2>{0.111372404f, 0.706495225f},
-std::array<float,2>{0.533291578f, 0.172618628f},
-std::array<float,2>{0.867474914f, 0.663238227f},
-std::array<float,2>{0.282887131f, 0.219696566f},
-std::array<float,2>{0.0217843652f, 0.796642303f},
-std::array<float,2>{0.569572508f, 0.39028725f},
-std::array<float,2>{0.683307588f, 0.930080712f},
-std::array<float,2>{0.21102272f, 0.290842146f},
-std::array<float,2>{0.376028508f, 0.500759244f},
-std::array<float,2>{0.905168772f, 0.0429362804f},
-std::array<float,2>{0.546650469f, 0.584324479f},
-std::array<float,2>{0.124247603f, 0.0818509012f},
-std::array<float,2>{0.333630204f, 0.937677503f},
-std::array<float,2>{0.77517575f, 0.344009221f},
-std::array<float,2>{0.957822084f, 0.862933874f},
-std::array<float,2>{0.484222412f, 0.449389577f},
-std::array<float,2>{0.155359551f, 0.747230947f},
-std::array<float,2>{0.728879273f, 0.132972956f},
-std::array<float,2>{0.912349403f, 0.533801973f},
-std::array<float,2>{0.408808231f, 0.0203973614f},
-std::array<float,2>{0.222722083f, 0.875025928f},
-std::array<float,2>{0.648755789f, 0.256313056f},
-std::array<float,2>{0.618979871f, 0.775427282f},
-std::array<float,2>{0.0620280541f, 0.413495183f},
-std::array<float,2>{0.277895391f, 0.629019916f},
-std::array<float,2>{0.838122666f, 0.191187084f},
-std::array<float,2>{0.691610515f, 0.713063717f},
-std::array<float,2>{0.182046428f, 0.187389776f},
-std::array<float,2>{0.437831342f, 0.812610924f},
-std::array<float,2>{0.973282039f, 0.485573143f},
-std::array<float,2>{0.807644784f, 0.988992453f},
-std::array<float,2>{0.361760467f, 0.31957671f},
-std::array<float,2>{0.075079523f, 0.605000854f},
-std::array<float,2>{0.528845429f, 0.11721012f},
-std::array<float,2>{0.761016607f, 0.615403056f},
-std::array<float,2>{0.314556807f, 0.106388688f},
-std::array<float,2>{0.103505246f, 0.982972741f},
-std::array<float,2>{0.547450662f, 0.337028712f},
-std::array<float,2>{0.73808527f, 0.831571877f},
-std::array<float,2>{0.127626017f, 0.47563836f},
-std::array<float,2>{0.48878032f, 0.702636361f},
-std::array<float,2>{0.951898634f, 0.160098478f},
-std::array<float,2>{0.592518985f, 0.650481164f},
-std::array<float,2>{0.00628014561f, 0.210003838f},
-std::array<float,2>{0.30997777f, 0.75864774f},
-std::array<float,2>{0.85505867f, 0.424218416f},
-std::array<float,2>{0.883205831f, 0.90327388f},
-std::array<float,2>{0.400153488f, 0.269136071f},
-std::array<float,2>{0.193206102f, 0.552571476f},
-std::array<float,2>{0.668397903f, 0.00384337897f},
-std::array<float,2>{0.986769021f, 0.72706908f},
-std::array<float,2>{0.465969861f, 0.151366144f},
-std::array<float,2>{0.160564825f, 0.851912975f},
-std::array<float,2>{0.709291577f, 0.458029062f},
-std::array<float,2>{0.509500563f, 0.953624547f},
-std::array<float,2>{0.0908032283f, 0.373545766f},
-std::array<float,2>{0.350296795f, 0.571354866f},
-std::array<float,2>{0.789842665f, 0.0669659972f},
-std::array<float,2>{0.625702858f, 0.529980063f},
-std::array<float,2>{0.246013105f, 0.0497380123f},
-std::array<float,2>{0.437265098f, 0.913252771f},
-std::array<float,2>{0.928098202f, 0.3089284f},
-std::array<float,2>{0.817491889f, 0.803905427f},
-std::array<float,2>{0.252389759f, 0.390960902f},
-std::array<float,2>{0.0393702686f, 0.67239821f},
-std::array<float,2>{0.603558779f, 0.239282385f},
-std::array<float,2>{0.870398939f, 0.747415423f},
-std::array<float,2>{0.284438729f, 0.133216336f},
-std::array<float,2>{0.0209456179f, 0.863122106f},
-std::array<float,2>{0.56709367f, 0.44969216f},
-std::array<float,2>{0.680967271f, 0.937913537f},
-std::array<float,2>{0.214525238f, 0.343874484f},
-std::array<float,2>{0.377034545f, 0.584099114f},
-std::array<float,2>{0.903536141f, 0.0817321539f},
-std::array<float,2>{0.544240892f, 0.500615478f},
-std::array<float,2>{0.121111408f, 0.0426138751f},
-std::array<float,2>{0.334076256f, 0.929711878f},
-std::array<float,2>{0.776173413f, 0.290627182f},
-std::array<float,2>{0.959359109f, 0.796482325f},
-std::array<float,2>{0.480802298f, 0.390491426f},
-std::array<float,2>{0.153909221f, 0.663525403f},
-std::array<float,2>{0.728131473f, 0.219440103f},
-std::array<float,2>{0.910162687f, 0.605465055f},
-std::array<float,2>{0.407319903f, 0.117542431f},
-std::array<float,2>{0.22571446f, 0.989244878f},
-std::array<float,2>{0.651194155f, 0.319706529f},
-std::array<float,2>{0.619354188f, 0.812789679f},
-std::array<float,2>{0.0589064769f, 0.485601872f},
-std::array<float,2>{0.280875415f, 0.713332951f},
-std::array<float,2>{0.836534202f, 0.18718572f},
-std::array<float,2>{0.695230544f, 0.629380882f},
-std::array<float,2>{0.179953635f, 0.19092308f},
-std::array<float,2>{0.441066802f, 0.775708258f},
-std::array<float,2>{0.975440383f, 0.41313377f},
-std::array<float,2>{0.806263804f, 0.875304401f},
-std::array<float,2>{0.3607243f, 0.255945772f},
-std::array<float,2>{0.077102609f, 0.534081936f},
-std::array<float,2>{0.531227469f, 0.02014466f},
-std::array<float,2>{0.758406579f, 0.552419484f},
-std::array<float,2>{0.313748151f, 0.00344955525f},
-std::array<float,2>{0.104134493f, 0.902902424f},
-std::array<float,2>{0.54896903f, 0.269287527f},
-std::array<float,2>{0.736211658f, 0.758312225f},
-std::array<float,2>{0.126405358f, 0.423890978f},
-std::array<float,2>{0.49081105f, 0.650817454f},
-std::array<float,2>{0.949773788f, 0.21036917f},
-std::array<float,2>{0.590540051f, 0.702151299f},
-std::array<float,2>{0.00485334778f, 0.159777433f},
-std::array<float,2>{0.310845256f, 0.832011044f},
-std::array<float,2>{0.853177965f, 0.475930691f},
-std::array<float,2>{0.886525095f, 0.983236074f},
-std::array<float,2>{0.402202398f, 0.337208509f},
-std::array<float,2>{0.194846436f, 0.615574419f},
-std::array<float,2>{0.671652615f, 0.106053144f},
-std::array<float,2>{0.985522926f, 0.672645152f},
-std::array<float,2>{0.468749613f, 0.239734411f},
-std::array<float,2>{0.164056286f, 0.804170787f},
-std::array<float,2>{0.707897007f, 0.390687436f},
-std::array<float,2>{0.510379493f, 0.913446248f},
-std::array<float,2>{0.0935873911f, 0.308597982f},
-std::array<float,2>{0.348662049f, 0.530050457f},
-std::array<float,2>{0.791306376f, 0.0493969955f},
-std::array<float,2>{0.62705338f, 0.571608603f},
-std::array<float,2>{0.242602497f, 0.067297928f},
-std::array<float,2>{0.435001224f, 0.954051554f},
-std::array<float,2>{0.927412331f, 0.374013245f},
-std::array<float,2>{0.819087386f, 0.851805389f},
-std::array<float,2>{0.251008123f, 0.458385676f},
-std::array<float,2>{0.0426488779f, 0.727434993f},
-std::array<float,2>{0.602186561f, 0.15096426f},
-std::array<float,2>{0.783655524f, 0.641182065f},
-std::array<float,2>{0.353505671f, 0.217599556f},
-std::array<float,2>{0.0846827552f, 0.757341325f},
-std::array<float,2>{0.50208956f, 0.434229702f},
-std::array<float,2>{0.716857314f, 0.89478904f},
-std::array<float,2>{0.16534093f, 0.274622679f},
-std::array<float,2>{0.458792269f, 0.560666621f},
-std::array<float,2>{0.992206454f, 0.0128792953f},
-std::array<float,2>{0.598098874f, 0.620671391f},
-std::array<float,2>{0.0317608677f, 0.101545162f},
-std::array<float,2>{0.262634575f, 0.970129609f},
-std::array<float,2>{0.82176584f, 0.334926337f},
-std::array<float,2>{0.936106145f, 0.838240206f},
-std::array<float,2>{0.425014555f, 0.483964801f},
-std::array<float,2>{0.237281606f, 0.693435431f},
-std::array<float,2>{0.637438357f, 0.165684506f},
-std::array<float,2>{0.938569784f, 0.515949667f},
-std::array<float,2>{0.495973021f, 0.0586351864f},
-std::array<float,2>{0.137060195f, 0.918391526f},
-std::array<float,2>{0.74481082f, 0.299465865f},
-std::array<float,2>{0.561220825f, 0.807682395f},
-std::array<float,2>{0.0968313068f, 0.405773312f},
-std::array<float,2>{0.323032528f, 0.684037268f},
-std::array<float,2>{0.75018543f, 0.246039554f},
-std::array<float,2>{0.662582338f, 0.718857348f},
-std::array<float,2>{0.1990408f, 0.143890321f},
-std::array<float,2>{0.391734987f, 0.847015381f},
-std::array<float,2>{0.880793333f, 0.464702725f},
-std::array<float,2>{0.843874574f, 0.966256738f},
-std::array<float,2>{0.297479421f, 0.364145339f},
-std::array<float,2>{0.0107532442f, 0.568136156f},
-std::array<float,2>{0.583289325f, 0.0746251792f},
-std::array<float,2>{0.829013169f, 0.588353574f},
-std::array<float,2>{0.271719068f, 0.0933678672f},
-std::array<float,2>{0.0503378659f, 0.950014651f},
-std::array<float,2>{0.610226512f, 0.356134117f},
-std::array<float,2>{0.64505136f, 0.872991443f},
-std::array<float,2>{0.228694499f, 0.439887732f},
-std::array<float,2>{0.416528195f, 0.735180557f},
-std::array<float,2>{0.914772809f, 0.127947301f},
-std::array<float,2>{0.522279918f, 0.6656304f},
-std::array<float,2>{0.0686723962f, 0.232402444f},
-std::array<float,2>{0.371018529f, 0.789043009f},
-std::array<float,2>{0.801756263f, 0.377399087f},
-std::array<float,2>{0.977106631f, 0.924451232f},
-std::array<float,2>{0.448706031f, 0.285664469f},
-std::array<float,2>{0.173908904f, 0.509818137f},
-std::array<float,2>{0.699725509f, 0.0313192494f},
-std::array<float,2>{0.891900361f, 0.706184208f},
-std::array<float,2>{0.385689646f, 0.172404245f},
-std::array<float,2>{0.20835717f, 0.823989034f},
-std::array<float,2>{0.67939043f, 0.493077248f},
-std::array<float,2>{0.57465601f, 0.999957025f},
-std::array<float,2>{0.0273990836f, 0.324449122f},
-std::array<float,2>{0.294179529f, 0.594584644f},
-std::array<float,2>{0.864814937f, 0.11671821f},
-std::array<float,2>{0.71970278f, 0.543674171f},
-std::array<float,2>{0.142411262f, 0.0265293512f},
-std::array<float,2>{0.470070183f, 0.890596569f},
-std::array<float,2>{0.967761636f, 0.265197039f},
-std::array<float,2>{0.770059884f, 0.766200423f},
-std::array<float,2>{0.337727904f, 0.418525398f},
-std::array<float,2>{0.111027278f, 0.637772977f},
-std::array<float,2>{0.531446159f, 0.198436573f},
-std::array<float,2>{0.780509651f, 0.690905273f},
-std::array<float,2>{0.329956353f, 0.170136407f},
-std::array<float,2>{0.12036255f, 0.842925072f},
-std::array<float,2>{0.540435076f, 0.476715118f},
-std::array<float,2>{0.731894791f, 0.974052906f},
-std::array<float,2>{0.152083054f, 0.329169661f},
-std::array<float,2>{0.477985591f, 0.624972105f},
-std::array<float,2>{0.954871953f, 0.096296072f},
-std::array<float,2>{0.564273775f, 0.557415128f},
-std::array<float,2>{0.0186853651f, 0.0080245398f},
-std::array<float,2>{0.286115557f, 0.890971184f},
-std::array<float,2>{0.873312056f, 0.278269053f},
-std::array<float,2>{0.899991751f, 0.753273547f},
-std::array<float,2>{0.38138026f, 0.429698169f},
-std::array<float,2>{0.216226578f, 0.645710468f},
-std::array<float,2>{0.687026262f, 0.21152021f},
-std::array<float,2>{0.972226262f, 0.563080847f},
-std::array<float,2>{0.444406033f, 0.0727794021f},
-std::array<float,2>{0.186825812f, 0.9638623f},
-std::array<float,2>{0.688051939f, 0.362298161f},
-std::array<float,2>{0.526971877f, 0.849820912f},
-std::array<float,2>{0.0734721944f, 0.466482937f},
-std::array<float,2>{0.366452277f, 0.722797632f},
-std::array<float,2>{0.808603764f, 0.145447716f},
-std::array<float,2>{0.652733803f, 0.680983782f},
-std::array<float,2>{0.221489936f, 0.246670857f},
-std::array<float,2>{0.410371363f, 0.809013605f},
-std::array<float,2>{0.909588575f, 0.399702042f},
-std::array<float,2>{0.839952409f, 0.917858899f},
-std::array<float,2>{0.27410695f, 0.302498847f},
-std::array<float,2>{0.0581299737f, 0.521184683f},
-std::array<float,2>{0.623226404f, 0.0568723939f},
-std::array<float,2>{0.858195126f, 0.514114082f},
-std::array<float,2>{0.306297243f, 0.0369425826f},
-std::array<float,2>{0.0031690686f, 0.92808336f},
-std::array<float,2>{0.588201761f, 0.281884581f},
-std::array<float,2>{0.667673886f, 0.781482518f},
-std::array<float,2>{0.190120354f, 0.381580591f},
-std::array<float,2>{0.403203547f, 0.668768346f},
-std::array<float,2>{0.888379037f, 0.229155958f},
-std::array<float,2>{0.55263263f, 0.738486052f},
-std::array<float,2>{0.109161139f, 0.132684752f},
-std::array<float,2>{0.319224089f, 0.86720103f},
-std::array<float,2>{0.764007866f, 0.442689568f},
-std::array<float,2>{0.948008418f, 0.948367178f},
-std::array<float,2>{0.487283766f, 0.354322225f},
-std::array<float,2>{0.130634189f, 0.593222082f},
-std::array<float,2>{0.739246428f, 0.0870202482f},
-std::array<float,2>{0.924479246f, 0.636396706f},
-std::array<float,2>{0.431616426f, 0.200645506f},
-std::array<float,2>{0.247076184f, 0.771998405f},
-std::array<float,2>{0.632313967f, 0.415591925f},
-std::array<float,2>{0.606022477f, 0.884436548f},
-std::array<float,2>{0.0438207276f, 0.260139495f},
-std::array<float,2>{0.255824506f, 0.540651739f},
-std::array<float,2>{0.812713504f, 0.0283539239f},
-std::array<float,2>{0.706300557f, 0.598677576f},
-std::array<float,2>{0.157766521f, 0.111607499f},
-std::array<float,2>{0.464137942f, 0.995125473f},
-std::array<float,2>{0.99131608f, 0.320930153f},
-std::array<float,2>{0.795824587f, 0.824263513f},
-std::array<float,2>{0.345037371f, 0.498002887f},
-std::array<float,2>{0.0874276832f, 0.708029151f},
-std::array<float,2>{0.51337266f, 0.17622523f},
-std::array<float,2>{0.825665891f, 0.656605482f},
-std::array<float,2>{0.260700136f, 0.225684032f},
-std::array<float,2>{0.0374683514f, 0.789510787f},
-std::array<float,2>{0.597287774f, 0.385654569f},
-std::array<float,2>{0.634563684f, 0.935355902f},
-std::array<float,2>{0.24171187f, 0.29527697f},
-std::array<float,2>{0.426879466f, 0.504205525f},
-std::array<float,2>{0.930481017f, 0.0447026305f},
-std::array<float,2>{0.507292747f, 0.58017242f},
-std::array<float,2>{0.0785172507f, 0.0823491514f},
-std::array<float,2>{0.357682437f, 0.945102394f},
-std::array<float,2>{0.785181582f, 0.348026335f},
-std::array<float,2>{0.997185826f, 0.86691916f},
-std::array<float,2>{0.456578046f, 0.449189782f},
-std::array<float,2>{0.171852857f, 0.745590627f},
-std::array<float,2>{0.714407861f, 0.1388136f},
-std::array<float,2>{0.877052426f, 0.536391497f},
-std::array<float,2>{0.397623062f, 0.0156319439f},
-std::array<float,2>{0.200048298f, 0.878974319f},
-std::array<float,2>{0.656344652f, 0.250906169f},
-std::array<float,2>{0.58011359f, 0.780569196f},
-std::array<float,2>{0.0127714518f, 0.409812182f},
-std::array<float,2>{0.303161144f, 0.626268983f},
-std::array<float,2>{0.849933982f, 0.193638772f},
-std::array<float,2>{0.747058332f, 0.715076804f},
-std::array<float,2>{0.133780286f, 0.179966569f},
-std::array<float,2>{0.496171266f, 0.818966806f},
-std::array<float,2>{0.941855788f, 0.489949584f},
-std::array<float,2>{0.753954947f, 0.985496104f},
-std::array<float,2>{0.3249394f, 0.313375264f},
-std::array<float,2>{0.0990085527f, 0.605501294f},
-std::array<float,2>{0.558202982f, 0.124754831f},
-std::array<float,2>{0.798008859f, 0.610110223f},
-std::array<float,2>{0.373001397f, 0.103962079f},
-std::array<float,2>{0.0643354133f, 0.977918804f},
-std::array<float,2>{0.516191602f, 0.342404693f},
-std::array<float,2>{0.696838677f, 0.832740784f},
-std::array<float,2>{0.177292317f, 0.472622961f},
-std::array<float,2>{0.450630158f, 0.698693097f},
-std::array<float,2>{0.983781159f, 0.163137645f},
-std::array<float,2>{0.615899265f, 0.653237045f},
-std::array<float,2>{0.0535727628f, 0.20317097f},
-std::array<float,2>{0.268140346f, 0.765032172f},
-std::array<float,2>{0.834801555f, 0.427792788f},
-std::array<float,2>{0.918993652f, 0.901815951f},
-std::array<float,2>{0.419040859f, 0.271671921f},
-std::array<float,2>{0.231115401f, 0.548975408f},
-std::array<float,2>{0.643802881f, 0.00778804393f},
-std::array<float,2>{0.964300036f, 0.73211652f},
-std::array<float,2>{0.475777775f, 0.154857188f},
-std::array<float,2>{0.144923136f, 0.858422399f},
-std::array<float,2>{0.72536093f, 0.456848174f},
-std::array<float,2>{0.536750019f, 0.959584475f},
-std::array<float,2>{0.115422919f, 0.36769709f},
-std::array<float,2>{0.341742843f, 0.576176465f},
-std::array<float,2>{0.765709877f, 0.0662231743f},
-std::array<float,2>{0.672780633f, 0.52574116f},
-std::array<float,2>{0.203263864f, 0.0535671972f},
-std::array<float,2>{0.388063878f, 0.906899691f},
-std::array<float,2>{0.894608557f, 0.307331979f},
-std::array<float,2>{0.862801731f, 0.799683094f},
-std::array<float,2>{0.289799511f, 0.395786285f},
-std::array<float,2>{0.0263278168f, 0.675939798f},
-std::array<float,2>{0.570492744f, 0.234697506f},
-std::array<float,2>{0.839337051f, 0.71167475f},
-std::array<float,2>{0.278388441f, 0.183878198f},
-std::array<float,2>{0.0610467084f, 0.815708637f},
-std::array<float,2>{0.617962122f, 0.48823151f},
-std::array<float,2>{0.649617553f, 0.991641223f},
-std::array<float,2>{0.224036619f, 0.316679209f},
-std::array<float,2>{0.410138607f, 0.602337718f},
-std::array<float,2>{0.913842738f, 0.120477915f},
-std::array<float,2>{0.527743936f, 0.531358123f},
-std::array<float,2>{0.0751986355f, 0.022410294f},
-std::array<float,2>{0.362567276f, 0.878659487f},
-std::array<float,2>{0.807310939f, 0.255479068f},
-std::array<float,2>{0.973805785f, 0.774703622f},
-std::array<float,2>{0.439399779f, 0.411892265f},
-std::array<float,2>{0.183438495f, 0.631697297f},
-std::array<float,2>{0.693128109f, 0.189164713f},
-std::array<float,2>{0.90550977f, 0.583011329f},
-std::array<float,2>{0.375638902f, 0.0789249539f},
-std::array<float,2>{0.212728888f, 0.939847589f},
-std::array<float,2>{0.68230623f, 0.345787704f},
-std::array<float,2>{0.569326878f, 0.860776067f},
-std::array<float,2>{0.0227101706f, 0.452758372f},
-std::array<float,2>{0.281450629f, 0.748295307f},
-std::array<float,2>{0.868480384f, 0.134962842f},
-std::array<float,2>{0.730342746f, 0.661275864f},
-std::array<float,2>{0.154778048f, 0.221904501f},
-std::array<float,2>{0.482709199f, 0.79300046f},
-std::array<float,2>{0.95848906f, 0.388549805f},
-std::array<float,2>{0.773602962f, 0.93273735f},
-std::array<float,2>{0.332069099f, 0.291156501f},
-std::array<float,2>{0.123176366f, 0.502694547f},
-std::array<float,2>{0.545640409f, 0.0397964977f},
-std::array<float,2>{0.790815771f, 0.52794838f},
-std::array<float,2>{0.351054966f, 0.0484061986f},
-std::array<float,2>{0.0914344937f, 0.911507666f},
-std::array<float,2>{0.508438826f, 0.312303513f},
-std::array<float,2>{0.710141897f, 0.802330375f},
-std::array<float,2>{0.161960378f, 0.393801272f},
-std::array<float,2>{0.464939773f, 0.674698472f},
-std::array<float,2>{0.987689495f, 0.240958527f},
-std::array<float,2>{0.604668856f, 0.729693532f},
-std::array<float,2>{0.0409166478f, 0.149663091f},
-std::array<float,2>{0.253284782f, 0.853620589f},
-std::array<float,2>{0.816872716f, 0.459269315f},
-std::array<float,2>{0.928960562f, 0.955439389f},
-std::array<float,2>{0.435727954f, 0.371239096f},
-std::array<float,2>{0.244708464f, 0.573995471f},
-std::array<float,2>{0.626447678f, 0.069393836f},
-std::array<float,2>{0.952856123f, 0.649575949f},
-std::array<float,2>{0.489461541f, 0.207866639f},
-std::array<float,2>{0.128534853f, 0.761515856f},
-std::array<float,2>{0.736422598f, 0.422780931f},
-std::array<float,2>{0.547896087f, 0.905456066f},
-std::array<float,2>{0.102519073f, 0.266530305f},
-std::array<float,2>{0.316316307f, 0.553790212f},
-std::array<float,2>{0.759902775f, 0.00180626323f},
-std::array<float,2>{0.669225812f, 0.615216374f},
-std::array<float,2>{0.191724241f, 0.10783086f},
-std::array<float,2>{0.398953378f, 0.981386065f},
-std::array<float,2>{0.884308875f, 0.338493168f},
-std::array<float,2>{0.853645146f, 0.828590333f},
-std::array<float,2>{0.309109479f, 0.474584162f},
-std::array<float,2>{0.00763504021f, 0.700360298f},
-std::array<float,2>{0.593729377f, 0.156493604f},
-std::array<float,2>{0.753266037f, 0.685930192f},
-std::array<float,2>{0.320495516f, 0.242228448f},
-std::array<float,2>{0.0951220319f, 0.806633353f},
-std::array<float,2>{0.559298873f, 0.402546316f},
-std::array<float,2>{0.744131207f, 0.921747863f},
-std::array<float,2>{0.139623851f, 0.29849565f},
-std::array<float,2>{0.493519664f, 0.518503845f},
-std::array<float,2>{0.940878689f, 0.0605668277f},
-std::array<float,2>{0.585602105f, 0.569946706f},
-std::array<float,2>{0.00813500676f, 0.0769267455f},
-std::array<float,2>{0.300727963f, 0.96778959f},
-std::array<float,2>{0.845913291f, 0.36605373f},
-std::array<float,2>{0.881866276f, 0.843863964f},
-std::array<float,2>{0.393828362f, 0.461046994f},
-std::array<float,2>{0.197159857f, 0.722530186f},
-std::array<float,2>{0.660239697f, 0.140673995f},
-std::array<float,2>{0.994248927f, 0.559942961f},
-std::array<float,2>{0.460206956f, 0.0140732508f},
-std::array<float,2>{0.166861445f, 0.896668196f},
-std::array<float,2>{0.715811133f, 0.27662769f},
-std::array<float,2>{0.501410663f, 0.754428804f},
-std::array<float,2>{0.0822944269f, 0.43633002f},
-std::array<float,2>{0.354025006f, 0.643065453f},
-std::array<float,2>{0.783153951f, 0.216185048f},
-std::array<float,2>{0.640035808f, 0.693316221f},
-std::array<float,2>{0.235632703f, 0.167391285f},
-std::array<float,2>{0.422232091f, 0.836584926f},
-std::array<float,2>{0.934502363f, 0.480539948f},
-std::array<float,2>{0.824090779f, 0.972421229f},
-std::array<float,2>{0.265617967f, 0.332206875f},
-std::array<float,2>{0.0334720984f, 0.617670655f},
-std::array<float,2>{0.600299597f, 0.0992860794f},
-std::array<float,2>{0.866212726f, 0.596799195f},
-std::array<float,2>{0.295969129f, 0.115086034f},
-std::array<float,2>{0.0310703553f, 0.99712199f},
-std::array<float,2>{0.577339172f, 0.326427132f},
-std::array<float,2>{0.677329779f, 0.820733905f},
-std::array<float,2>{0.209736004f, 0.495132089f},
-std::array<float,2>{0.384285718f, 0.703614771f},
-std::array<float,2>{0.892608941f, 0.175007224f},
-std::array<float,2>{0.535111487f, 0.639016986f},
-std::array<float,2>{0.112517275f, 0.196672857f},
-std::array<float,2>{0.338229626f, 0.768976867f},
-std::array<float,2>{0.772622585f, 0.421766311f},
-std::array<float,2>{0.965136349f, 0.886734545f},
-std::array<float,2>{0.471224189f, 0.262157351f},
-std::array<float,2>{0.143860474f, 0.546626329f},
-std::array<float,2>{0.720880628f, 0.025316596f},
-std::array<float,2>{0.917293131f, 0.737474561f},
-std::array<float,2>{0.415368319f, 0.125707224f},
-std::array<float,2>{0.227204874f, 0.874641836f},
-std::array<float,2>{0.647559524f, 0.439024389f},
-std::array<float,2>{0.612965524f, 0.951523602f},
-std::array<float,2>{0.0484275147f, 0.357843161f},
-std::array<float,2>{0.270150453f, 0.587136149f},
-std::array<float,2>{0.83059895f, 0.0902482867f},
-std::array<float,2>{0.702654839f, 0.509112298f},
-std::array<float,2>{0.173680484f, 0.0336336307f},
-std::array<float,2>{0.446430594f, 0.923535168f},
-std::array<float,2>{0.978746653f, 0.288239896f},
-std::array<float,2>{0.803509653f, 0.786453009f},
-std::array<float,2>{0.3674528f, 0.375672638f},
-std::array<float,2>{0.0678621158f, 0.667347729f},
-std::array<float,2>{0.520819008f, 0.233021304f},
-std::array<float,2>{0.811247289f, 0.724798977f},
-std::array<float,2>{0.36479333f, 0.147756159f},
-std::array<float,2>{0.0716542974f, 0.848775029f},
-std::array<float,2>{0.52346164f, 0.468697667f},
-std::array<float,2>{0.691076398f, 0.962278247f},
-std::array<float,2>{0.184436366f, 0.359579414f},
-std::array<float,2>{0.443158507f, 0.565868139f},
-std::array<float,2>{0.969330311f, 0.0714927316f},
-std::array<float,2>{0.622200787f, 0.522910953f},
-std::array<float,2>{0.0555417389f, 0.054915566f},
-std::array<float,2>{0.275596112f, 0.91459626f},
-std::array<float,2>{0.842693627f, 0.303751171f},
-std::array<float,2>{0.906558335f, 0.81180793f},
-std::array<float,2>{0.413845241f, 0.401131302f},
-std::array<float,2>{0.219791487f, 0.68255645f},
-std::array<float,2>{0.654700577f, 0.249732822f},
-std::array<float,2>{0.955875397f, 0.622529745f},
-std::array<float,2>{0.479737103f, 0.0952388048f},
-std::array<float,2>{0.149972185f, 0.97609818f},
-std::array<float,2>{0.733150601f, 0.331315279f},
-std::array<float,2>{0.541326284f, 0.841338754f},
-std::array<float,2>{0.119031295f, 0.479150474f},
-std::array<float,2>{0.330213517f, 0.688869357f},
-std::array<float,2>{0.777700424f, 0.169479936f},
-std::array<float,2>{0.685249567f, 0.648327708f},
-std::array<float,2>{0.216810346f, 0.214362666f},
-std::array<float,2>{0.380696774f, 0.750359297f},
-std::array<float,2>{0.900618851f, 0.433328778f},
-std::array<float,2>{0.871292174f, 0.89328438f},
-std::array<float,2>{0.287296116f, 0.27960974f},
-std::array<float,2>{0.0169164799f, 0.555881977f},
-std::array<float,2>{0.56619513f, 0.0111585353f},
-std::array<float,2>{0.816107035f, 0.542285025f},
-std::array<float,2>{0.257616162f, 0.0308050215f},
-std::array<float,2>{0.046620734f, 0.885791361f},
-std::array<float,2>{0.609318793f, 0.258461535f},
-std::array<float,2>{0.629738271f, 0.771479249f},
-std::array<float,2>{0.248512655f, 0.417627811f},
-std::array<float,2>{0.433425456f, 0.634488046f},
-std::array<float,2>{0.923774481f, 0.202008873f},
-std::array<float,2>{0.515035987f, 0.710798085f},
-std::array<float,2>{0.0881022438f, 0.178541556f},
-std::array<float,2>{0.347566098f, 0.827968955f},
-std::array<float,2>{0.793264568f, 0.498208284f},
-std::array<float,2>{0.990116179f, 0.994134545f},
-std::array<float,2>{0.461132139f, 0.322295636f},
-std::array<float,2>{0.158581898f, 0.600553989f},
-std::array<float,2>{0.703453958f, 0.11069718f},
-std::array<float,2>{0.890483201f, 0.67088443f},
-std::array<float,2>{0.404991865f, 0.227024287f},
-std::array<float,2>{0.188426882f, 0.784431636f},
-std::array<float,2>{0.664333284f, 0.380809426f},
-std::array<float,2>{0.587185681f, 0.926985443f},
-std::array<float,2>{0.000501148461f, 0.284649134f},
-std::array<float,2>{0.30815053f, 0.512653589f},
-std::array<float,2>{0.856191516f, 0.0373064876f},
-std::array<float,2>{0.740973949f, 0.591707051f},
-std::array<float,2>{0.132408381f, 0.088898994f},
-std::array<float,2>{0.484561801f, 0.946607769f},
-std::array<float,2>{0.94682771f, 0.352959782f},
-std::array<float,2>{0.762584984f, 0.86914742f},
-std::array<float,2>{0.316966772f, 0.444144517f},
-std::array<float,2>{0.105733626f, 0.74164325f},
-std::array<float,2>{0.552734673f, 0.129177704f},
-std::array<float,2>{0.849536419f, 0.628426254f},
-std::array<float,2>{0.30180338f, 0.192140222f},
-std::array<float,2>{0.014982257f, 0.777691066f},
-std::array<float,2>{0.578496218f, 0.406480461f},
-std::array<float,2>{0.659618974f, 0.882732213f},
-std::array<float,2>{0.201326504f, 0.252198398f},
-std::array<float,2>{0.395292372f, 0.537384033f},
-std::array<float,2>{0.87588346f, 0.0188554302f},
-std::array<float,2>{0.554720998f, 0.608824968f},
-std::array<float,2>{0.101162225f, 0.121855475f},
-std::array<float,2>{0.327423275f, 0.987546027f},
-std::array<float,2>{0.757397771f, 0.314533085f},
-std::array<float,2>{0.943518102f, 0.816982388f},
-std::array<float,2>{0.498732448f, 0.491663247f},
-std::array<float,2>{0.136056751f, 0.717288673f},
-std::array<float,2>{0.749691308f, 0.183061838f},
-std::array<float,2>{0.93286562f, 0.506198943f},
-std::array<float,2>{0.429393947f, 0.0465092547f},
-std::array<float,2>{0.239084587f, 0.936730444f},
-std::array<float,2>{0.635778368f, 0.294833958f},
-std::array<float,2>{0.595357955f, 0.791652739f},
-std::array<float,2>{0.0352496207f, 0.383692354f},
-std::array<float,2>{0.258403301f, 0.659647882f},
-std::array<float,2>{0.826771379f, 0.223225087f},
-std::array<float,2>{0.711883783f, 0.742618024f},
-std::array<float,2>{0.169028804f, 0.13745974f},
-std::array<float,2>{0.454231143f, 0.86522156f},
-std::array<float,2>{0.998774529f, 0.445865244f},
-std::array<float,2>{0.788406312f, 0.941949308f},
-std::array<float,2>{0.356993407f, 0.351095349f},
-std::array<float,2>{0.0815518871f, 0.579563379f},
-std::array<float,2>{0.504434228f, 0.0858628973f},
-std::array<float,2>{0.767903924f, 0.57503289f},
-std::array<float,2>{0.343001276f, 0.0633219108f},
-std::array<float,2>{0.113524541f, 0.957871735f},
-std::array<float,2>{0.53765589f, 0.369922549f},
-std::array<float,2>{0.724065125f, 0.856321752f},
-std::array<float,2>{0.148171887f, 0.453893214f},
-std::array<float,2>{0.473684907f, 0.732959211f},
-std::array<float,2>{0.961366653f, 0.153104156f},
-std::array<float,2>{0.573969722f, 0.678655803f},
-std::array<float,2>{0.0243332591f, 0.237118915f},
-std::array<float,2>{0.292120963f, 0.797185123f},
-std::array<float,2>{0.861039877f, 0.397166729f},
-std::array<float,2>{0.897078097f, 0.909604728f},
-std::array<float,2>{0.389695466f, 0.305283308f},
-std::array<float,2>{0.206320599f, 0.524290681f},
-std::array<float,2>{0.67463696f, 0.0524821952f},
-std::array<float,2>{0.981634021f, 0.695513368f},
-std::array<float,2>{0.451814502f, 0.161016315f},
-std::array<float,2>{0.177761853f, 0.834589541f},
-std::array<float,2>{0.698005676f, 0.469491363f},
-std::array<float,2>{0.519357026f, 0.979290187f},
-std::array<float,2>{0.0656275749f, 0.340246081f},
-std::array<float,2>{0.373417974f, 0.612862468f},
-std::array<float,2>{0.800008357f, 0.103310935f},
-std::array<float,2>{0.641093493f, 0.548657238f},
-std::array<float,2>{0.234127134f, 0.00401109364f},
-std::array<float,2>{0.421278715f, 0.899714291f},
-std::array<float,2>{0.920212984f, 0.271159083f},
-std::array<float,2>{0.833664596f, 0.7630319f},
-std::array<float,2>{0.267119199f, 0.426393718f},
-std::array<float,2>{0.0512493029f, 0.655169368f},
-std::array<float,2>{0.613791764f, 0.206662789f},
-std::array<float,2>{0.852194309f, 0.699775755f},
-std::array<float,2>{0.31169188f, 0.157227486f},
-std::array<float,2>{0.00540147722f, 0.829779208f},
-std::array<float,2>{0.591015577f, 0.47292769f},
-std::array<float,2>{0.670070052f, 0.981907129f},
-std::array<float,2>{0.193469837f, 0.339472502f},
-std::array<float,2>{0.401259392f, 0.613735735f},
-std::array<float,2>{0.885020971f, 0.10845165f},
-std::array<float,2>{0.550140142f, 0.553648412f},
-std::array<float,2>{0.105020069f, 0.000188275197f},
-std::array<float,2>{0.313370436f, 0.904311538f},
-std::array<float,2>{0.759311616f, 0.266932428f},
-std::array<float,2>{0.950890958f, 0.759999275f},
-std::array<float,2>{0.491739154f, 0.423541397f},
-std::array<float,2>{0.125496924f, 0.648860037f},
-std::array<float,2>{0.734421015f, 0.208640113f},
-std::array<float,2>{0.926093817f, 0.572457969f},
-std::array<float,2>{0.433779001f, 0.0684961081f},
-std::array<float,2>{0.243360266f, 0.956735075f},
-std::array<float,2>{0.628027797f, 0.372344822f},
-std::array<float,2>{0.602910876f, 0.855130851f},
-std::array<float,2>{0.0412099026f, 0.46058622f},
-std::array<float,2>{0.250442773f, 0.729325652f},
-std::array<float,2>{0.819729865f, 0.148512974f},
-std::array<float,2>{0.708902836f, 0.674957037f},
-std::array<float,2>{0.162748843f, 0.241943061f},
-std::array<float,2>{0.467486352f, 0.80155766f},
-std::array<float,2>{0.985342145f, 0.392704517f},
-std::array<float,2>{0.792598188f, 0.911035419f},
-std::array<float,2>{0.348626345f, 0.310699642f},
-std::array<float,2>{0.0919236168f, 0.528795123f},
-std::array<float,2>{0.511655092f, 0.0476253293f},
-std::array<float,2>{0.776754916f, 0.503167212f},
-std::array<float,2>{0.335155457f, 0.0402190797f},
-std::array<float,2>{0.122572929f, 0.932404101f},
-std::array<float,2>{0.543313861f, 0.292158842f},
-std::array<float,2>{0.727508008f, 0.794623792f},
-std::array<float,2>{0.152459398f, 0.386850506f},
-std::array<float,2>{0.482268363f, 0.660839677f},
-std::array<float,2>{0.960322857f, 0.220810547f},
-std::array<float,2>{0.567915738f, 0.749944866f},
-std::array<float,2>{0.0200840607f, 0.136025369f},
-std::array<float,2>{0.283382624f, 0.860071182f},
-std::array<float,2>{0.869199514f, 0.451755166f},
-std::array<float,2>{0.902812898f, 0.940868914f},
-std::array<float,2>{0.378820509f, 0.347033441f},
-std::array<float,2>{0.213750362f, 0.582714617f},
-std::array<float,2>{0.67999512f, 0.0794761628f},
-std::array<float,2>{0.97654891f, 0.63208437f},
-std::array<float,2>{0.440006673f, 0.187980652f},
-std::array<float,2>{0.180879191f, 0.773819268f},
-std::array<float,2>{0.693967581f, 0.410320729f},
-std::array<float,2>{0.529502153f, 0.877517462f},
-std::array<float,2>{0.0781056583f, 0.254245967f},
-std::array<float,2>{0.359393895f, 0.533188999f},
-std::array<float,2>{0.805017173f, 0.0232602563f},
-std::array<float,2>{0.652220488f, 0.602551699f},
-std::array<float,2>{0.225388467f, 0.119441897f},
-std::array<float,2>{0.406285942f, 0.990311205f},
-std::array<float,2>{0.911438107f, 0.318324953f},
-std::array<float,2>{0.837564468f, 0.815362751f},
-std::array<float,2>{0.280017763f, 0.4864631f},
-std::array<float,2>{0.0604109317f, 0.712584853f},
-std::array<float,2>{0.620760322f, 0.185087383f},
-std::array<float,2>{0.802368522f, 0.666826189f},
-std::array<float,2>{0.369905472f, 0.233799145f},
-std::array<float,2>{0.0696821734f, 0.785395443f},
-std::array<float,2>{0.523105979f, 0.376695037f},
-std::array<float,2>{0.700201988f, 0.922199726f},
-std::array<float,2>{0.175471872f, 0.288061053f},
-std::array<float,2>{0.447411954f, 0.508316398f},
-std::array<float,2>{0.978095114f, 0.0348914154f},
-std::array<float,2>{0.610750318f, 0.586201072f},
-std::array<float,2>{0.0494024642f, 0.0914988071f},
-std::array<float,2>{0.272697508f, 0.952742279f},
-std::array<float,2>{0.82974416f, 0.359202951f},
-std::array<float,2>{0.915238023f, 0.87367177f},
-std::array<float,2>{0.41748026f, 0.437717974f},
-std::array<float,2>{0.229616761f, 0.736341596f},
-std::array<float,2>{0.646322131f, 0.126891017f},
-std::array<float,2>{0.968230724f, 0.545499861f},
-std::array<float,2>{0.469534785f, 0.0243508965f},
-std::array<float,2>{0.141590551f, 0.888222456f},
-std::array<float,2>{0.720613599f, 0.263014168f},
-std::array<float,2>{0.532288194f, 0.76832062f},
-std::array<float,2>{0.109830968f, 0.420151711f},
-std::array<float,2>{0.336394012f, 0.63966459f},
-std::array<float,2>{0.771405041f, 0.195513964f},
-std::array<float,2>{0.678283691f, 0.705055654f},
-std::array<float,2>{0.207508266f, 0.17421174f},
-std::array<float,2>{0.386196285f, 0.821546674f},
-std::array<float,2>{0.891534925f, 0.494306713f},
-std::array<float,2>{0.863751292f, 0.996682525f},
-std::array<float,2>{0.293432653f, 0.327781528f},
-std::array<float,2>{0.0288039073f, 0.596500039f},
-std::array<float,2>{0.57519871f, 0.113710999f},
-std::array<float,2>{0.820876062f, 0.619057536f},
-std::array<float,2>{0.262922585f, 0.0981928334f},
-std::array<float,2>{0.032572981f, 0.971664071f},
-std::array<float,2>{0.598868251f, 0.333726496f},
-std::array<float,2>{0.638332367f, 0.837486565f},
-std::array<float,2>{0.238011166f, 0.482295662f},
-std::array<float,2>{0.424041092f, 0.691609144f},
-std::array<float,2>{0.936725378f, 0.166845635f},
-std::array<float,2>{0.503720284f, 0.64401871f},
-std::array<float,2>{0.0854534879f, 0.215405747f},
-std::array<float,2>{0.352381289f, 0.755325615f},
-std::array<float,2>{0.784685612f, 0.436897904f},
-std::array<float,2>{0.99334079f, 0.897575974f},
-std::array<float,2>{0.457294524f, 0.27608344f},
-std::array<float,2>{0.164795727f, 0.559082627f},
-std::array<float,2>{0.717913508f, 0.0149642779f},
-std::array<float,2>{0.879632115f, 0.721355677f},
-std::array<float,2>{0.390680403f, 0.141945332f},
-std::array<float,2>{0.1977631f, 0.845394015f},
-std::array<float,2>{0.663262904f, 0.462211668f},
-std::array<float,2>{0.5820719f, 0.967175782f},
-std::array<float,2>{0.0100576254f, 0.36670211f},
-std::array<float,2>{0.298457503f, 0.569179475f},
-std::array<float,2>{0.845521331f, 0.0777062029f},
-std::array<float,2>{0.745296359f, 0.519412518f},
-std::array<float,2>{0.137978449f, 0.0622360222f},
-std::array<float,2>{0.494842231f, 0.920739412f},
-std::array<float,2>{0.937945247f, 0.297501713f},
-std::array<float,2>{0.751629174f, 0.804727614f},
-std::array<float,2>{0.323385924f, 0.403607875f},
-std::array<float,2>{0.0957397521f, 0.687375724f},
-std::array<float,2>{0.56223166f, 0.243937671f},
-std::array<float,2>{0.765394807f, 0.740860105f},
-std::array<float,2>{0.319645643f, 0.130507305f},
-std::array<float,2>{0.108084254f, 0.870734274f},
-std::array<float,2>{0.551227868f, 0.444587588f},
-std::array<float,2>{0.739912152f, 0.945365965f},
-std::array<float,2>{0.129487559f, 0.351688325f},
-std::array<float,2>{0.487604707f, 0.590750217f},
-std::array<float,2>{0.948962688f, 0.0884424075f},
-std::array<float,2>{0.589296699f, 0.513445616f},
-std::array<float,2>{0.00291930395f, 0.0386931822f},
-std::array<float,2>{0.304808289f, 0.926743329f},
-std::array<float,2>{0.858948946f, 0.283469796f},
-std::array<float,2>{0.887071133f, 0.783755362f},
-std::array<float,2>{0.403661251f, 0.379172802f},
-std::array<float,2>{0.190485001f, 0.671830535f},
-std::array<float,2>{0.666930854f, 0.22817041f},
-std::array<float,2>{0.991041362f, 0.601075351f},
-std::array<float,2>{0.463644058f, 0.109556802f},
-std::array<float,2>{0.156548589f, 0.992866516f},
-std::array<float,2>{0.705082417f, 0.323275387f},
-std::array<float,2>{0.512126327f, 0.826276064f},
-std::array<float,2>{0.0860427991f, 0.499210566f},
-std::array<float,2>{0.344396025f, 0.709615946f},
-std::array<float,2>{0.796152949f, 0.178959161f},
-std::array<float,2>{0.63163358f, 0.633247435f},
-std::array<float,2>{0.246489421f, 0.202856347f},
-std::array<float,2>{0.430252612f, 0.770470321f},
-std::array<float,2>{0.925312936f, 0.416200906f},
-std::array<float,2>{0.813505232f, 0.885454297f},
-std::array<float,2>{0.254659355f, 0.259570479f},
-std::array<float,2>{0.0447671302f, 0.541645586f},
-std::array<float,2>{0.607227802f, 0.0302492157f},
-std::array<float,2>{0.874195576f, 0.555372298f},
-std::array<float,2>{0.286438942f, 0.0106112529f},
-std::array<float,2>{0.0181098282f, 0.893839598f},
-std::array<float,2>{0.562952936f, 0.281078637f},
-std::array<float,2>{0.68608743f, 0.750998139f},
-std::array<float,2>{0.215081245f, 0.431976557f},
-std::array<float,2>{0.382769734f, 0.6471802f},
-std::array<float,2>{0.898706496f, 0.213081434f},
-std::array<float,2>{0.539767265f, 0.688095808f},
-std::array<float,2>{0.119626887f, 0.168406203f},
-std::array<float,2>{0.328361779f, 0.839998007f},
-std::array<float,2>{0.780225992f, 0.479794353f},
-std::array<float,2>{0.953781784f, 0.974785984f},
-std::array<float,2>{0.476725072f, 0.330408245f},
-std::array<float,2>{0.150515035f, 0.621252954f},
-std::array<float,2>{0.730604589f, 0.0940557867f},
-std::array<float,2>{0.908311486f, 0.683499336f},
-std::array<float,2>{0.41160953f, 0.248091266f},
-std::array<float,2>{0.221769229f, 0.811449766f},
-std::array<float,2>{0.653808951f, 0.401813567f},
-std::array<float,2>{0.62476182f, 0.915661275f},
-std::array<float,2>{0.0567188375f, 0.303566128f},
-std::array<float,2>{0.275199264f, 0.52171284f},
-std::array<float,2>{0.841745079f, 0.0564484075f},
-std::array<float,2>{0.688839912f, 0.564863503f},
-std::array<float,2>{0.186021745f, 0.0708271787f},
-std::array<float,2>{0.443889588f, 0.961861372f},
-std::array<float,2>{0.970937252f, 0.360554129f},
-std::array<float,2>{0.810256124f, 0.847873688f},
-std::array<float,2>{0.36548093f, 0.46683681f},
-std::array<float,2>{0.0727499649f, 0.725775242f},
-std::array<float,2>{0.526137173f, 0.146716252f},
-std::array<float,2>{0.835887134f, 0.655554175f},
-std::array<float,2>{0.268773824f, 0.205540523f},
-std::array<float,2>{0.0537742637f, 0.762077451f},
-std::array<float,2>{0.616968393f, 0.4273839f},
-std::array<float,2>{0.642673671f, 0.898663163f},
-std::array<float,2>{0.232182056f, 0.269930273f},
-std::array<float,2>{0.418931633f, 0.547595084f},
-std::array<float,2>{0.918568075f, 0.00554365898f},
-std::array<float,2>{0.517224967f, 0.612269938f},
-std::array<float,2>{0.0632174537f, 0.10212303f},
-std::array<float,2>{0.371747166f, 0.980074048f},
-std::array<float,2>{0.797470331f, 0.341321945f},
-std::array<float,2>{0.983267307f, 0.835205197f},
-std::array<float,2>{0.450146347f, 0.46994105f},
-std::array<float,2>{0.176406205f, 0.697208941f},
-std::array<float,2>{0.695436895f, 0.161567315f},
-std::array<float,2>{0.89622879f, 0.524458706f},
-std::array<float,2>{0.387558371f, 0.051332172f},
-std::array<float,2>{0.204895005f, 0.908824861f},
-std::array<float,2>{0.673563421f, 0.306348622f},
-std::array<float,2>{0.571823537f, 0.798565745f},
-std::array<float,2>{0.0266149547f, 0.397945195f},
-std::array<float,2>{0.290457815f, 0.67900759f},
-std::array<float,2>{0.861564577f, 0.238116875f},
-std::array<float,2>{0.7256459f, 0.733946323f},
-std::array<float,2>{0.146322682f, 0.153779238f},
-std::array<float,2>{0.474686295f, 0.856660008f},
-std::array<float,2>{0.963231802f, 0.454123914f},
-std::array<float,2>{0.767014503f, 0.958221257f},
-std::array<float,2>{0.340759695f, 0.371032625f},
-std::array<float,2>{0.116904467f, 0.575216413f},
-std::array<float,2>{0.535223782f, 0.0643656552f},
-std::array<float,2>{0.786258698f, 0.578913867f},
-std::array<float,2>{0.358907342f, 0.0844247714f},
-std::array<float,2>{0.079162322f, 0.942735493f},
-std::array<float,2>{0.506652534f, 0.349932224f},
-std::array<float,2>{0.713748157f, 0.864071071f},
-std::array<float,2>{0.170575798f, 0.446530879f},
-std::array<float,2>{0.455351114f, 0.743335962f},
-std::array<float,2>{0.996175885f, 0.138517812f},
-std::array<float,2>{0.595883369f, 0.658943415f},
-std::array<float,2>{0.0387239195f, 0.224284366f},
-std::array<float,2>{0.261503965f, 0.792105973f},
-std::array<float,2>{0.824440479f, 0.384285361f},
-std::array<float,2>{0.930745423f, 0.935937583f},
-std::array<float,2>{0.426544845f, 0.293415636f},
-std::array<float,2>{0.240342289f, 0.507719398f},
-std::array<float,2>{0.633175075f, 0.0455282331f},
-std::array<float,2>{0.942719638f, 0.718079746f},
-std::array<float,2>{0.497686684f, 0.182264745f},
-std::array<float,2>{0.133989826f, 0.818030238f},
-std::array<float,2>{0.747599542f, 0.490560114f},
-std::array<float,2>{0.557011962f, 0.986422181f},
-std::array<float,2>{0.0979438573f, 0.315894097f},
-std::array<float,2>{0.32534647f, 0.608289659f},
-std::array<float,2>{0.755746126f, 0.122338004f},
-std::array<float,2>{0.658188105f, 0.538292527f},
-std::array<float,2>{0.201024741f, 0.0178153254f},
-std::array<float,2>{0.39693293f, 0.881355822f},
-std::array<float,2>{0.878288031f, 0.253567874f},
-std::array<float,2>{0.850617528f, 0.779233217f},
-std::array<float,2>{0.304000467f, 0.407498121f},
-std::array<float,2>{0.0122581134f, 0.626988113f},
-std::array<float,2>{0.581974506f, 0.193287179f},
-std::array<float,2>{0.817966819f, 0.727703452f},
-std::array<float,2>{0.252688825f, 0.152309075f},
-std::array<float,2>{0.0395732448f, 0.85331893f},
-std::array<float,2>{0.60446316f, 0.457819611f},
-std::array<float,2>{0.625336945f, 0.954896092f},
-std::array<float,2>{0.245369211f, 0.374817044f},
-std::array<float,2>{0.436627626f, 0.570346653f},
-std::array<float,2>{0.928513944f, 0.0676435232f},
-std::array<float,2>{0.508977354f, 0.530889034f},
-std::array<float,2>{0.0900156498f, 0.0498660877f},
-std::array<float,2>{0.349639297f, 0.912169039f},
-std::array<float,2>{0.789127946f, 0.310061604f},
-std::array<float,2>{0.987199962f, 0.802976906f},
-std::array<float,2>{0.466565579f, 0.392313957f},
-std::array<float,2>{0.161016732f, 0.673301637f},
-std::array<float,2>{0.709724367f, 0.23901242f},
-std::array<float,2>{0.883748174f, 0.616338491f},
-std::array<float,2>{0.399775624f, 0.107305452f},
-std::array<float,2>{0.192413464f, 0.983680189f},
-std::array<float,2>{0.668603957f, 0.336116284f},
-std::array<float,2>{0.591885686f, 0.830157161f},
-std::array<float,2>{0.00663039926f, 0.474745572f},
-std::array<float,2>{0.310086459f, 0.701914489f},
-std::array<float,2>{0.854915798f, 0.158930868f},
-std::array<float,2>{0.737309039f, 0.651465178f},
-std::array<float,2>{0.126992792f, 0.209841579f},
-std::array<float,2>{0.488465786f, 0.759677172f},
-std::array<float,2>{0.951325297f, 0.425554067f},
-std::array<float,2>{0.761572123f, 0.90347451f},
-std::array<float,2>{0.315076947f, 0.268377811f},
-std::array<float,2>{0.102727205f, 0.551322699f},
-std::array<float,2>{0.546947479f, 0.00215663598f},
-std::array<float,2>{0.808147192f, 0.534551859f},
-std::array<float,2>{0.362101704f, 0.0213233642f},
-std::array<float,2>{0.0743539929f, 0.876142383f},
-std::array<float,2>{0.528562188f, 0.257022351f},
-std::array<float,2>{0.692303121f, 0.777299583f},
-std::array<float,2>{0.182328835f, 0.412329167f},
-std::array<float,2>{0.438008964f, 0.629912317f},
-std::array<float,2>{0.973100364f, 0.189718395f},
-std::array<float,2>{0.618182421f, 0.71456641f},
-std::array<float,2>{0.0619939305f, 0.186284751f},
-std::array<float,2>{0.277368605f, 0.813995779f},
-std::array<float,2>{0.838485599f, 0.484803855f},
-std::array<float,2>{0.91283232f, 0.990079105f},
-std::array<float,2>{0.408684909f, 0.319007516f},
-std::array<float,2>{0.223150566f, 0.604172111f},
-std::array<float,2>{0.649092555f, 0.11884518f},
-std::array<float,2>{0.957036912f, 0.662372112f},
-std::array<float,2>{0.483654618f, 0.220568523f},
-std::array<float,2>{0.155809879f, 0.795846999f},
-std::array<float,2>{0.729312956f, 0.388870955f},
-std::array<float,2>{0.546165109f, 0.930741012f},
-std::array<float,2>{0.124627985f, 0.289613605f},
-std::array<float,2>{0.333447754f, 0.501487672f},
-std::array<float,2>{0.774462342f, 0.0418767557f},
-std::array<float,2>{0.68306613f, 0.585219741f},
-std::array<float,2>{0.211886555f, 0.0801816434f},
-std::array<float,2>{0.376789421f, 0.93862021f},
-std::array<float,2>{0.904543161f, 0.345295906f},
-std::array<float,2>{0.867746353f, 0.861920118f},
-std::array<float,2>{0.28246966f, 0.450576723f},
-std::array<float,2>{0.0219849441f, 0.746105731f},
-std::array<float,2>{0.569911778f, 0.133945495f},
-std::array<float,2>{0.772401214f, 0.637037992f},
-std::array<float,2>{0.339032769f, 0.197823688f},
-std::array<float,2>{0.111941613f, 0.767247617f},
-std::array<float,2>{0.533927083f, 0.419027686f},
-std::array<float,2>{0.722567856f, 0.88949585f},
-std::array<float,2>{0.143485054f, 0.263727218f},
-std::array<float,2>{0.472492278f, 0.544595718f},
-std::array<float,2>{0.966465473f, 0.0256768316f},
-std::array<float,2>{0.576262653f, 0.595131695f},
-std::array<float,2>{0.0300085209f, 0.115617655f},
-std::array<float,2>{0.295491695f, 0.998113155f},
-std::array<float,2>{0.866207898f, 0.325196743f},
-std::array<float,2>{0.893580675f, 0.822321534f},
-std::array<float,2>{0.383354127f, 0.493430167f},
-std::array<float,2>{0.210032448f, 0.705674589f},
-std::array<float,2>{0.675820172f, 0.173005074f},
-std::array<float,2>{0.979545176f, 0.511253655f},
-std::array<float,2>{0.446073443f, 0.0323329568f},
-std::array<float,2>{0.172301292f, 0.925193369f},
-std::array<float,2>{0.701390028f, 0.286583841f},
-std::array<float,2>{0.519902349f, 0.787434042f},
-std::array<float,2>{0.0670211688f, 0.378670305f},
-std::array<float,2>{0.36907199f, 0.664213657f},
-std::array<float,2>{0.804677308f, 0.230875045f},
-std::array<float,2>{0.647137165f, 0.735388279f},
-std::array<float,2>{0.228279695f, 0.12757349f},
-std::array<float,2>{0.414527684f, 0.871986151f},
-std::array<float,2>{0.916775763f, 0.440493852f},
-std::array<float,2>{0.832021534f, 0.950909615f},
-std::array<float,2>{0.271167278f, 0.357196331f},
-std::array<float,2>{0.0470215864f, 0.589614868f},
-std::array<float,2>{0.611817837f, 0.0918943137f},
-std::array<float,2>{0.847569168f, 0.566759467f},
-std::array<float,2>{0.298933566f, 0.075982511f},
-std::array<float,2>{0.00886167865f, 0.965306282f},
-std::array<float,2>{0.584306061f, 0.364930749f},
-std::array<float,2>{0.661253572f, 0.846675158f},
-std::array<float,2>{0.19598411f, 0.463813454f},
-std::array<float,2>{0.393363714f, 0.720086694f},
-std::array<float,2>{0.8818205f, 0.142892882f},
-std::array<float,2>{0.560285926f, 0.685255945f},
-std::array<float,2>{0.0947168544f, 0.244147629f},
-std::array<float,2>{0.321334392f, 0.807600975f},
-std::array<float,2>{0.752709031f, 0.404957116f},
-std::array<float,2>{0.940244138f, 0.918962657f},
-std::array<float,2>{0.49264136f, 0.300232351f},
-std::array<float,2>{0.139747888f, 0.517353833f},
-std::array<float,2>{0.742663562f, 0.0597155169f},
-std::array<float,2>{0.935506999f, 0.694534779f},
-std::array<float,2>{0.423634231f, 0.164754272f},
-std::array<float,2>{0.235138938f, 0.838931859f},
-std::array<float,2>{0.639105082f, 0.482884467f},
-std::array<float,2>{0.600738883f, 0.969530165f},
-std::array<float,2>{0.0349372886f, 0.335271209f},
-std::array<float,2>{0.264420092f, 0.619819999f},
-std::array<float,2>{0.822686493f, 0.099868916f},
-std::array<float,2>{0.716181099f, 0.561654925f},
-std::array<float,2>{0.167398974f, 0.0124206552f},
-std::array<float,2>{0.459549159f, 0.895516813f},
-std::array<float,2>{0.995981038f, 0.274052203f},
-std::array<float,2>{0.781790793f, 0.756028473f},
-std::array<float,2>{0.355110645f, 0.435100347f},
-std::array<float,2>{0.0836442038f, 0.642311692f},
-std::array<float,2>{0.50071454f, 0.218735948f},
-std::array<float,2>{0.794447243f, 0.707100451f},
-std::array<float,2>{0.346508801f, 0.177730218f},
-std::array<float,2>{0.0890845507f, 0.825387001f},
-std::array<float,2>{0.514089167f, 0.496274948f},
-std::array<float,2>{0.704258144f, 0.994207203f},
-std::array<float,2>{0.159700453f, 0.32148549f},
-std::array<float,2>{0.462436736f, 0.598574221f},
-std::array<float,2>{0.988442481f, 0.113131352f},
-std::array<float,2>{0.608322382f, 0.539470792f},
-std::array<float,2>{0.0452131219f, 0.0278903898f},
-std::array<float,2>{0.256388754f, 0.882935882f},
-std::array<float,2>{0.815207899f, 0.261626065f},
-std::array<float,2>{0.922042906f, 0.77248323f},
-std::array<float,2>{0.432331622f, 0.414576709f},
-std::array<float,2>{0.249869242f, 0.635412097f},
-std::array<float,2>{0.630829334f, 0.200110316f},
-std::array<float,2>{0.945466101f, 0.592493832f},
-std::array<float,2>{0.485992163f, 0.0861185342f},
-std::array<float,2>{0.131666183f, 0.948013127f},
-std::array<float,2>{0.741831124f, 0.354959309f},
-std::array<float,2>{0.553763688f, 0.868684351f},
-std::array<float,2>{0.107056156f, 0.442330241f},
-std::array<float,2>{0.317445278f, 0.739535511f},
-std::array<float,2>{0.76275295f, 0.131030172f},
-std::array<float,2>{0.665637732f, 0.669640422f},
-std::array<float,2>{0.188986599f, 0.230059057f},
-std::array<float,2>{0.405700982f, 0.782259107f},
-std::array<float,2>{0.889351487f, 0.381918728f},
-std::array<float,2>{0.857324541f, 0.929508328f},
-std::array<float,2>{0.307147592f, 0.282437354f},
-std::array<float,2>{0.00132609531f, 0.514840543f},
-std::array<float,2>{0.586206675f, 0.0357361175f},
-std::array<float,2>{0.84301275f, 0.520219445f},
-std::array<float,2>{0.277092516f, 0.0585414879f},
-std::array<float,2>{0.0560253225f, 0.916742265f},
-std::array<float,2>{0.622035444f, 0.301218957f},
-std::array<float,2>{0.656171799f, 0.810283661f},
-std::array<float,2>{0.219051272f, 0.399144918f},
-std::array<float,2>{0.413069993f, 0.679882705f},
-std::array<float,2>{0.908072352f, 0.247528329f},
-std::array<float,2>{0.525265574f, 0.723750234f},
-std::array<float,2>{0.0706031322f, 0.145601511f},
-std::array<float,2>{0.363975734f, 0.851077914f},
-std::array<float,2>{0.811642945f, 0.465397567f},
-std::array<float,2>{0.969842792f, 0.96423161f},
-std::array<float,2>{0.442164272f, 0.362475932f},
-std::array<float,2>{0.185306698f, 0.563610256f},
-std::array<float,2>{0.689622164f, 0.0733302757f},
-std::array<float,2>{0.901423633f, 0.645228505f},
-std::array<float,2>{0.379158735f, 0.21247147f},
-std::array<float,2>{0.218374982f, 0.751956105f},
-std::array<float,2>{0.684127092f, 0.431293428f},
-std::array<float,2>{0.565278649f, 0.891634881f},
-std::array<float,2>{0.0159655455f, 0.279108346f},
-std::array<float,2>{0.288978606f, 0.558489323f},
-std::array<float,2>{0.872220755f, 0.00940376148f},
-std::array<float,2>{0.733736157f, 0.623629034f},
-std::array<float,2>{0.149131775f, 0.0975824669f},
-std::array<float,2>{0.478839666f, 0.973161936f},
-std::array<float,2>{0.956819832f, 0.328925043f},
-std::array<float,2>{0.779012442f, 0.842440724f},
-std::array<float,2>{0.331352055f, 0.477854908f},
-std::array<float,2>{0.117289513f, 0.690413535f},
-std::array<float,2>{0.542738557f, 0.170952335f},
-std::array<float,2>{0.860187531f, 0.677455783f},
-std::array<float,2>{0.291371495f, 0.235479251f},
-std::array<float,2>{0.0248677302f, 0.799970031f},
-std::array<float,2>{0.572747171f, 0.394600749f},
-std::array<float,2>{0.675159633f, 0.907405794f},
-std::array<float,2>{0.205556318f, 0.308540046f},
-std::array<float,2>{0.388688326f, 0.52638948f},
-std::array<float,2>{0.897610009f, 0.0545824915f},
-std::array<float,2>{0.538660884f, 0.577886164f},
-std::array<float,2>{0.114323847f, 0.0644804761f},
-std::array<float,2>{0.342240363f, 0.960556805f},
-std::array<float,2>{0.768658042f, 0.369112015f},
-std::array<float,2>{0.962177098f, 0.858149886f},
-std::array<float,2>{0.47320047f, 0.455406129f},
-std::array<float,2>{0.146982446f, 0.731404364f},
-std::array<float,2>{0.723172605f, 0.156012103f},
-std::array<float,2>{0.92125833f, 0.550639808f},
-std::array<float,2>{0.420096993f, 0.00681888126f},
-std::array<float,2>{0.2324498f, 0.900652766f},
-std::array<float,2>{0.642497718f, 0.272754699f},
-std::array<float,2>{0.615206122f, 0.763893723f},
-std::array<float,2>{0.0520741753f, 0.428846985f},
-std::array<float,2>{0.265819222f, 0.654001892f},
-std::array<float,2>{0.832524478f, 0.204151377f},
-std::array<float,2>{0.698727906f, 0.698122799f},
-std::array<float,2>{0.179405361f, 0.162781224f},
-std::array<float,2>{0.452180207f, 0.833624899f},
-std::array<float,2>{0.980611503f, 0.470944583f},
-std::array<float,2>{0.799036384f, 0.977430344f},
-std::array<float,2>{0.374110281f, 0.343665361f},
-std::array<float,2>{0.0648520514f, 0.611216545f},
-std::array<float,2>{0.517769456f, 0.104952104f},
-std::array<float,2>{0.756144702f, 0.607161701f},
-std::array<float,2>{0.326301783f, 0.123975687f},
-std::array<float,2>{0.099901557f, 0.984560728f},
-std::array<float,2>{0.555750549f, 0.313696057f},
-std::array<float,2>{0.748336852f, 0.820146978f},
-std::array<float,2>{0.135152936f, 0.488320321f},
-std::array<float,2>{0.499224395f, 0.716103613f},
-std::array<float,2>{0.945068777f, 0.181304172f},
-std::array<float,2>{0.579742134f, 0.625913382f},
-std::array<float,2>{0.0145074734f, 0.194946632f},
-std::array<float,2>{0.301511765f, 0.779663086f},
-std::array<float,2>{0.84832114f, 0.409045637f},
-std::array<float,2>{0.876889884f, 0.880155742f},
-std::array<float,2>{0.395785093f, 0.251098752f},
-std::array<float,2>{0.202477872f, 0.535369277f},
-std::array<float,2>{0.658646941f, 0.0172840096f},
-std::array<float,2>{0.999235749f, 0.744595706f},
-std::array<float,2>{0.453988343f, 0.140242234f},
-std::array<float,2>{0.168699533f, 0.866122961f},
-std::array<float,2>{0.712500095f, 0.447405338f},
-std::array<float,2>{0.505465567f, 0.944268703f},
-std::array<float,2>{0.0807660371f, 0.349254102f},
-std::array<float,2>{0.356221497f, 0.58138752f},
-std::array<float,2>{0.787167668f, 0.0834490359f},
-std::array<float,2>{0.635005236f, 0.505761743f},
-std::array<float,2>{0.239934281f, 0.0434509665f},
-std::array<float,2>{0.428239286f, 0.934301019f},
-std::array<float,2>{0.932040691f, 0.296592444f},
-std::array<float,2>{0.827833414f, 0.79063952f},
-std::array<float,2>{0.258844197f, 0.386570334f},
-std::array<float,2>{0.0366698205f, 0.657427311f},
-std::array<float,2>{0.593924284f, 0.224683657f},
-std::array<float,2>{0.844960868f, 0.720487893f},
-std::array<float,2>{0.297938317f, 0.143420175f},
-std::array<float,2>{0.0104260696f, 0.845757604f},
-std::array<float,2>{0.58295697f, 0.46322763f},
-std::array<float,2>{0.663590014f, 0.965778649f},
-std::array<float,2>{0.197473153f, 0.364467442f},
-std::array<float,2>{0.39151147f, 0.567023993f},
-std::array<float,2>{0.879086018f, 0.0755302012f},
-std::array<float,2>{0.561906457f, 0.51701653f},
-std::array<float,2>{0.0965122133f, 0.060359396f},
-std::array<float,2>{0.323736727f, 0.919820189f},
-std::array<float,2>{0.751254261f, 0.300342798f},
-std::array<float,2>{0.938053191f, 0.807065248f},
-std::array<float,2>{0.494488299f, 0.404309958f},
-std::array<float,2>{0.138649434f, 0.684975147f},
-std::array<float,2>{0.745903075f, 0.245005429f},
-std::array<float,2>{0.937467098f, 0.619560122f},
-std::array<float,2>{0.424361974f, 0.100354522f},
-std::array<float,2>{0.237629399f, 0.968993425f},
-std::array<float,2>{0.638108015f, 0.335579664f},
-std::array<float,2>{0.599480391f, 0.839360774f},
-std::array<float,2>{0.0331737883f, 0.483157188f},
-std::array<float,2>{0.263303727f, 0.69489336f},
-std::array<float,2>{0.820325375f, 0.164489105f},
-std::array<float,2>{0.718270183f, 0.641726434f},
-std::array<float,2>{0.164152071f, 0.217840612f},
-std::array<float,2>{0.457579345f, 0.756387591f},
-std::array<float,2>{0.994033098f, 0.43458271f},
-std::array<float,2>{0.784635961f, 0.896176696f},
-std::array<float,2>{0.351842016f, 0.273557097f},
-std::array<float,2>{0.0852410793f, 0.562083662f},
-std::array<float,2>{0.50312835f, 0.0117230508f},
-std::array<float,2>{0.770790398f, 0.544397652f},
-std::array<float,2>{0.336854011f, 0.0261110403f},
-std::array<float,2>{0.110300303f, 0.888799727f},
-std::array<float,2>{0.533073425f, 0.264388949f},
-std::array<float,2>{0.719864368f, 0.76679945f},
-std::array<float,2>{0.14092645f, 0.419611663f},
-std::array<float,2>{0.469130516f, 0.637225986f},
-std::array<float,2>{0.968537211f, 0.197716117f},
-std::array<float,2>{0.575915039f, 0.70521456f},
-std::array<float,2>{0.0288644917f, 0.173620045f},
-std::array<float,2>{0.293897659f, 0.823187768f},
-std::array<float,2>{0.864069879f, 0.493728846f},
-std::array<float,2>{0.89077419f, 0.998919785f},
-std::array<float,2>{0.386367828f, 0.325986058f},
-std::array<float,2>{0.207659274f, 0.595362902f},
-std::array<float,2>{0.678189158f, 0.115857981f},
-std::array<float,2>{0.977632642f, 0.664825857f},
-std::array<float,2>{0.448163688f, 0.231044173f},
-std::array<float,2>{0.175235212f, 0.788041294f},
-std::array<float,2>{0.701088369f, 0.378184825f},
-std::array<float,2>{0.522859633f, 0.925612092f},
-std::array<float,2>{0.0701042712f, 0.287016362f},
-std::array<float,2>{0.369272947f, 0.510985196f},
-std::array<float,2>{0.802094996f, 0.0329520367f},
-std::array<float,2>{0.645873785f, 0.588935912f},
-std::array<float,2>{0.23020032f, 0.0927100331f},
-std::array<float,2>{0.417841971f, 0.950563192f},
-std::array<float,2>{0.915573239f, 0.356725931f},
-std::array<float,2>{0.829202414f, 0.871319234f},
-std::array<float,2>{0.273414642f, 0.441256791f},
-std::array<float,2>{0.0489982143f, 0.736288249f},
-std::array<float,2>{0.611146748f, 0.127166823f},
-std::array<float,2>{0.805282295f, 0.630759895f},
-std::array<float,2>{0.360257596f, 0.190382689f},
-std::array<float,2>{0.0773455277f, 0.776517928f},
-std::array<float,2>{0.530198395f, 0.412856072f},
-std::array<float,2>{0.693423688f, 0.876514494f},
-std::array<float,2>{0.181205735f, 0.257354289f},
-std::array<float,2>{0.439821035f, 0.534967184f},
-std::array<float,2>{0.975739181f, 0.0209945738f},
-std::array<float,2>{0.620505214f, 0.6035707f},
-std::array<float,2>{0.0598609708f, 0.118369065f},
-std::array<float,2>{0.279448539f, 0.989653468f},
-std::array<float,2>{0.837393463f, 0.318614781f},
-std::array<float,2>{0.911970437f, 0.813651741f},
-std::array<float,2>{0.407041997f, 0.48521632f},
-std::array<float,2>{0.224957943f, 0.714168549f},
-std::array<float,2>{0.65167582f, 0.185774967f},
-std::array<float,2>{0.960880041f, 0.501067996f},
-std::array<float,2>{0.481488287f, 0.041271504f},
-std::array<float,2>{0.153305843f, 0.931634247f},
-std::array<float,2>{0.72660929f, 0.289271861f},
-std::array<float,2>{0.543622196f, 0.795164466f},
-std::array<float,2>{0.122410558f, 0.389371246f},
-std::array<float,2>{0.335789531f, 0.662942886f},
-std::array<float,2>{0.777153611f, 0.220018551f},
-std::array<float,2>{0.680501044f, 0.74664253f},
-std::array<float,2>{0.213221207f, 0.134338543f},
-std::array<float,2>{0.378032535f, 0.861415386f},
-std::array<float,2>{0.903259814f, 0.451000929f},
-std::array<float,2>{0.870030999f, 0.939290941f},
-std::array<float,2>{0.283797503f, 0.344826847f},
-std::array<float,2>{0.0199224986f, 0.585781574f},
-std::array<float,2>{0.567865491f, 0.080697298f},
-std::array<float,2>{0.820163012f, 0.571252584f},
-std::array<float,2>{0.250565618f, 0.0681073666f},
-std::array<float,2>{0.0419434197f, 0.954519749f},
-std::array<float,2>{0.603159785f, 0.374412835f},
-std::array<float,2>{0.628775895f, 0.852913857f},
-std::array<float,2>{0.243722677f, 0.457082987f},
-std::array<float,2>{0.434536338f, 0.728469372f},
-std::array<float,2>{0.926506341f, 0.151555821f},
-std::array<float,2>{0.510852039f, 0.673408568f},
-std::array<float,2>{0.0925128385f, 0.238489211f},
-std::array<float,2>{0.348103613f, 0.803480029f},
-std::array<float,2>{0.792106092f, 0.3920286f},
-std::array<float,2>{0.984657764f, 0.913056314f},
-std::array<float,2>{0.467249602f, 0.309739411f},
-std::array<float,2>{0.162241846f, 0.53071934f},
-std::array<float,2>{0.708201408f, 0.0505660288f},
-std::array<float,2>{0.885340035f, 0.701276124f},
-std::array<float,2>{0.40080148f, 0.158394873f},
-std::array<float,2>{0.194250301f, 0.830655873f},
-std::array<float,2>{0.670825303f, 0.475471556f},
-std::array<float,2>{0.591773331f, 0.983993709f},
-std::array<float,2>{0.00490956707f, 0.336463094f},
-std::array<float,2>{0.312137246f, 0.616787672f},
-std::array<float,2>{0.851859331f, 0.106576137f},
-std::array<float,2>{0.735183358f, 0.550972879f},
-std::array<float,2>{0.125320882f, 0.0026041586f},
-std::array<float,2>{0.491473019f, 0.904045582f},
-std::array<float,2>{0.950324416f, 0.267579705f},
-std::array<float,2>{0.758914113f, 0.759052455f},
-std::array<float,2>{0.312835693f, 0.425206244f},
-std::array<float,2>{0.104506157f, 0.651864886f},
-std::array<float,2>{0.550393462f, 0.209191144f},
-std::array<float,2>{0.754992723f, 0.716626108f},
-std::array<float,2>{0.32585147f, 0.180703357f},
-std::array<float,2>{0.0985424072f, 0.819638014f},
-std::array<float,2>{0.557329059f, 0.488965988f},
-std::array<float,2>{0.747440219f, 0.984885156f},
-std::array<float,2>{0.134331673f, 0.314268112f},
-std::array<float,2>{0.497476637f, 0.606801331f},
-std::array<float,2>{0.943085492f, 0.123291098f},
-std::array<float,2>{0.581216991f, 0.5360291f},
-std::array<float,2>{0.0120832482f, 0.0166686103f},
-std::array<float,2>{0.304414332f, 0.880802095f},
-std::array<float,2>{0.851536393f, 0.251850635f},
-std::array<float,2>{0.87864989f, 0.780088603f},
-std::array<float,2>{0.396980047f, 0.408307523f},
-std::array<float,2>{0.200446978f, 0.625072956f},
-std::array<float,2>{0.657286823f, 0.194726393f},
-std::array<float,2>{0.9967013f, 0.58162266f},
-std::array<float,2>{0.455674142f, 0.083530888f},
-std::array<float,2>{0.170297384f, 0.943448603f},
-std::array<float,2>{0.713268638f, 0.348771989f},
-std::array<float,2>{0.506267846f, 0.865255237f},
-std::array<float,2>{0.0799637586f, 0.447943121f},
-std::array<float,2>{0.358465672f, 0.74509263f},
-std::array<float,2>{0.786790907f, 0.139872655f},
-std::array<float,2>{0.633354843f, 0.657886267f},
-std::array<float,2>{0.240937889f, 0.225338936f},
-std::array<float,2>{0.426066011f, 0.790400028f},
-std::array<float,2>{0.931532323f, 0.385913044f},
-std::array<float,2>{0.82482487f, 0.933998704f},
-std::array<float,2>{0.261142105f, 0.29630208f},
-std::array<float,2>{0.0385250188f, 0.505143881f},
-std::array<float,2>{0.596243083f, 0.0437074304f},
-std::array<float,2>{0.86185199f, 0.527325988f},
-std::array<float,2>{0.290786743f, 0.0538740382f},
-std::array<float,2>{0.0271062646f, 0.9081406f},
-std::array<float,2>{0.571315467f, 0.307981759f},
-std::array<float,2>{0.673101246f, 0.800532937f},
-std::array<float,2>{0.204553798f, 0.395395786f},
-std::array<float,2>{0.386982381f, 0.677062571f},
-std::array<float,2>{0.895839453f, 0.235932067f},
-std::array<float,2>{0.536030531f, 0.730763316f},
-std::array<float,2>{0.116312675f, 0.15540275f},
-std::array<float,2>{0.340297252f, 0.857462406f},
-std::array<float,2>{0.767155468f, 0.456011802f},
-std::array<float,2>{0.96383065f, 0.960171998f},
-std::array<float,2>{0.4754228f, 0.368365347f},
-std::array<float,2>{0.145708069f, 0.5775159f},
-std::array<float,2>{0.726103008f, 0.065276958f},
-std::array<float,2>{0.918111503f, 0.653330624f},
-std::array<float,2>{0.418080062f, 0.20484364f},
-std::array<float,2>{0.231662691f, 0.764305651f},
-std::array<float,2>{0.643421113f, 0.429610372f},
-std::array<float,2>{0.616262317f, 0.901114523f},
-std::array<float,2>{0.0545697995f, 0.273132294f},
-std::array<float,2>{0.269137561f, 0.550284505f},
-std::array<float,2>{0.835225165f, 0.00602045143f},
-std::array<float,2>{0.696008861f, 0.610755384f},
-std::array<float,2>{0.176216587f, 0.105081096f},
-std::array<float,2>{0.449536294f, 0.976811409f},
-std::array<float,2>{0.982465446f, 0.342853278f},
-std::array<float,2>{0.797055542f, 0.833080471f},
-std::array<float,2>{0.37148279f, 0.471637815f},
-std::array<float,2>{0.0625612587f, 0.697530091f},
-std::array<float,2>{0.517082274f, 0.162525028f},
-std::array<float,2>{0.841167808f, 0.680301785f},
-std::array<float,2>{0.274475396f, 0.248036802f},
-std::array<float,2>{0.057551194f, 0.809756756f},
-std::array<float,2>{0.624092519f, 0.398568392f},
-std::array<float,2>{0.653636634f, 0.916332662f},
-std::array<float,2>{0.222383931f, 0.301427752f},
-std::array<float,2>{0.411663324f, 0.519858122f},
-std::array<float,2>{0.908706307f, 0.0576311648f},
-std::array<float,2>{0.52584511f, 0.564227283f},
-std::array<float,2>{0.0732155666f, 0.0738050193f},
-std::array<float,2>{0.365872324f, 0.964443803f},
-std::array<float,2>{0.809840918f, 0.363236696f},
-std::array<float,2>{0.971624613f, 0.850776315f},
-std::array<float,2>{0.443536997f, 0.465050429f},
-std::array<float,2>{0.186430633f, 0.724525809f},
-std::array<float,2>{0.689318836f, 0.146457151f},
-std::array<float,2>{0.898955822f, 0.558104753f},
-std::array<float,2>{0.381941706f, 0.00912084337f},
-std::array<float,2>{0.215577781f, 0.892450809f},
-std::array<float,2>{0.685687304f, 0.278740883f},
-std::array<float,2>{0.563070595f, 0.752848804f},
-std::array<float,2>{0.0178356934f, 0.430866659f},
-std::array<float,2>{0.286649913f, 0.644965112f},
-std::array<float,2>{0.874548614f, 0.2122778f},
-std::array<float,2>{0.731181622f, 0.68955791f},
-std::array<float,2>{0.151241794f, 0.171581164f},
-std::array<float,2>{0.4771761f, 0.841968119f},
-std::array<float,2>{0.953366458f, 0.478330433f},
-std::array<float,2>{0.779305279f, 0.972945452f},
-std::array<float,2>{0.328715652f, 0.328231364f},
-std::array<float,2>{0.119774722f, 0.623364389f},
-std::array<float,2>{0.539419472f, 0.0971432626f},
-std::array<float,2>{0.796776354f, 0.598087847f},
-std::array<float,2>{0.344078273f, 0.112444654f},
-std::array<float,2>{0.0867169201f, 0.994689345f},
-std::array<float,2>{0.512531161f, 0.322101444f},
-std::array<float,2>{0.705649197f, 0.826049149f},
-std::array<float,2>{0.157135293f, 0.497037858f},
-std::array<float,2>{0.463106871f, 0.707572281f},
-std::array<float,2>{0.990335047f, 0.177200556f},
-std::array<float,2>{0.606718719f, 0.635196328f},
-std::array<float,2>{0.044264853f, 0.199677005f},
-std::array<float,2>{0.25421536f, 0.773048818f},
-std::array<float,2>{0.814142108f, 0.414137989f},
-std::array<float,2>{0.924931884f, 0.883532584f},
-std::array<float,2>{0.42998597f, 0.260987788f},
-std::array<float,2>{0.246892676f, 0.539676964f},
-std::array<float,2>{0.631047785f, 0.027417019f},
-std::array<float,2>{0.948594511f, 0.739860892f},
-std::array<float,2>{0.487954497f, 0.131772995f},
-std::array<float,2>{0.129154399f, 0.868202448f},
-std::array<float,2>{0.739569545f, 0.44144246f},
-std::array<float,2>{0.551508129f, 0.947295964f},
-std::array<float,2>{0.107778028f, 0.355139554f},
-std::array<float,2>{0.319976568f, 0.591849387f},
-std::array<float,2>{0.765102625f, 0.0865747482f},
-std::array<float,2>{0.666161716f, 0.515451014f},
-std::array<float,2>{0.190948501f, 0.0353187919f},
-std::array<float,2>{0.403902978f, 0.928919315f},
-std::array<float,2>{0.88721323f, 0.28318727f},
-std::array<float,2>{0.858585656f, 0.782842875f},
-std::array<float,2>{0.305425167f, 0.382605106f},
-std::array<float,2>{0.00217630225f, 0.669115126f},
-std::array<float,2>{0.589796603f, 0.229908079f},
-std::array<float,2>{0.823159575f, 0.692187846f},
-std::array<float,2>{0.26379174f, 0.166036293f},
-std::array<float,2>{0.0342125781f, 0.837026358f},
-std::array<float,2>{0.60113883f, 0.481581867f},
-std::array<float,2>{0.639436543f, 0.970739186f},
-std::array<float,2>{0.234852582f, 0.333022773f},
-std::array<float,2>{0.423021823f, 0.61817342f},
-std::array<float,2>{0.934776843f, 0.0978638083f},
-std::array<float,2>{0.500400782f, 0.558737576f},
-std::array<float,2>{0.083164379f, 0.0153191658f},
-std::array<float,2>{0.354645491f, 0.898220599f},
-std::array<float,2>{0.781554759f, 0.275577813f},
-std::array<float,2>{0.995514333f, 0.755631745f},
-std::array<float,2>{0.459369957f, 0.437217206f},
-std::array<float,2>{0.167616442f, 0.644440651f},
-std::array<float,2>{0.716334641f, 0.21521084f},
-std::array<float,2>{0.88128525f, 0.568655312f},
-std::array<float,2>{0.393021405f, 0.077600956f},
-std::array<float,2>{0.1957618f, 0.967438936f},
-std::array<float,2>{0.661926806f, 0.366681069f},
-std::array<float,2>{0.584884167f, 0.844821453f},
-std::array<float,2>{0.00932082441f, 0.462697983f},
-std::array<float,2>{0.299584776f, 0.720916808f},
-std::array<float,2>{0.846991897f, 0.142199293f},
-std::array<float,2>{0.742899895f, 0.686917067f},
-std::array<float,2>{0.140445858f, 0.243626609f},
-std::array<float,2>{0.492996484f, 0.80562824f},
-std::array<float,2>{0.939572573f, 0.404001743f},
-std::array<float,2>{0.752293169f, 0.920365274f},
-std::array<float,2>{0.32219246f, 0.297261357f},
-std::array<float,2>{0.0940020531f, 0.518800497f},
-std::array<float,2>{0.559880853f, 0.0618593767f},
-std::array<float,2>{0.804173112f, 0.508040726f},
-std::array<float,2>{0.368495464f, 0.0344347991f},
-std::array<float,2>{0.0666724443f, 0.92241025f},
-std::array<float,2>{0.520428002f, 0.287531137f},
-std::array<float,2>{0.701660752f, 0.785879016f},
-std::array<float,2>{0.172828704f, 0.3763946f},
-std::array<float,2>{0.445797205f, 0.66604501f},
-std::array<float,2>{0.980200827f, 0.23395291f},
-std::array<float,2>{0.61144948f, 0.73694092f},
-std::array<float,2>{0.0475192182f, 0.126422405f},
-std::array<float,2>{0.27069509f, 0.87349087f},
-std::array<float,2>{0.831075788f, 0.438094676f},
-std::array<float,2>{0.9163661f, 0.952586532f},
-std::array<float,2>{0.414919257f, 0.358403265f},
-std::array<float,2>{0.227859318f, 0.586684763f},
-std::array<float,2>{0.646918178f, 0.0909084454f},
-std::array<float,2>{0.966056287f, 0.640240192f},
-std::array<float,2>{0.471823543f, 0.195824996f},
-std::array<float,2>{0.143065676f, 0.768020153f},
-std::array<float,2>{0.721715271f, 0.4208951f},
-std::array<float,2>{0.533532143f, 0.887726843f},
-std::array<float,2>{0.111775666f, 0.263331145f},
-std::array<float,2>{0.339829892f, 0.54520762f},
-std::array<float,2>{0.771723449f, 0.0236541517f},
-std::array<float,2>{0.676650405f, 0.595968366f},
-std::array<float,2>{0.210451752f, 0.114217713f},
-std::array<float,2>{0.383113116f, 0.996241629f},
-std::array<float,2>{0.89433074f, 0.327454418f},
-std::array<float,2>{0.865610659f, 0.822075903f},
-std::array<float,2>{0.295152754f, 0.494654566f},
-std::array<float,2>{0.0296323057f, 0.704212666f},
-std::array<float,2>{0.576963603f, 0.174526662f},
-std::array<float,2>{0.774960458f, 0.66036427f},
-std::array<float,2>{0.333788425f, 0.22161001f},
-std::array<float,2>{0.124408551f, 0.794131815f},
-std::array<float,2>{0.546507835f, 0.387227386f},
-std::array<float,2>{0.72870177f, 0.931994498f},
-std::array<float,2>{0.155756593f, 0.292828321f},
-std::array<float,2>{0.48412621f, 0.503859162f},
-std::array<float,2>{0.957660317f, 0.0408024676f},
-std::array<float,2>{0.569730639f, 0.582274854f},
-std::array<float,2>{0.0215677507f, 0.0797413215f},
-std::array<float,2>{0.283027619f, 0.941007078f},
-std::array<float,2>{0.867241144f, 0.347547799f},
-std::array<float,2>{0.904894829f, 0.859756052f},
-std::array<float,2>{0.376370698f, 0.451442599f},
-std::array<float,2>{0.211288765f, 0.749406517f},
-std::array<float,2>{0.683542311f, 0.136260703f},
-std::array<float,2>{0.97356075f, 0.53233248f},
-std::array<float,2>{0.437734812f, 0.0227775201f},
-std::array<float,2>{0.181691393f, 0.877163053f},
-std::array<float,2>{0.691838384f, 0.254752219f},
-std::array<float,2>{0.529183805f, 0.774135649f},
-std::array<float,2>{0.0749139488f, 0.411062449f},
-std::array<float,2>{0.361535341f, 0.632460058f},
-std::array<float,2>{0.80786854f, 0.188033566f},
-std::array<float,2>{0.648667216f, 0.711947083f},
-std::array<float,2>{0.223005012f, 0.18491672f},
-std::array<float,2>{0.409096658f, 0.814513981f},
-std::array<float,2>{0.91251862f, 0.487146199f},
-std::array<float,2>{0.838211179f, 0.991142571f},
-std::array<float,2>{0.278220087f, 0.317444295f},
-std::array<float,2>{0.0623855814f, 0.603248239f},
-std::array<float,2>{0.618699491f, 0.119900711f},
-std::array<float,2>{0.8552531f, 0.614123404f},
-std::array<float,2>{0.309615016f, 0.109358385f},
-std::array<float,2>{0.00597034115f, 0.982302308f},
-std::array<float,2>{0.592592776f, 0.339342564f},
-std::array<float,2>{0.668084264f, 0.829144061f},
-std::array<float,2>{0.19298254f, 0.473176032f},
-std::array<float,2>{0.400072455f, 0.699432611f},
-std::array<float,2>{0.88291347f, 0.157942533f},
-std::array<float,2>{0.547824144f, 0.649285018f},
-std::array<float,2>{0.103065826f, 0.208441734f},
-std::array<float,2>{0.314808935f, 0.760616004f},
-std::array<float,2>{0.760935903f, 0.422899574f},
-std::array<float,2>{0.952004611f, 0.904938936f},
-std::array<float,2>{0.489112705f, 0.267573565f},
-std::array<float,2>{0.127711535f, 0.552878499f},
-std::array<float,2>{0.73803091f, 0.000801411399f},
-std::array<float,2>{0.92782557f, 0.728526413f},
-std::array<float,2>{0.437250614f, 0.149056032f},
-std::array<float,2>{0.245732784f, 0.854922831f},
-std::array<float,2>{0.625820816f, 0.46019578f},
-std::array<float,2>{0.603889167f, 0.956185579f},
-std::array<float,2>{0.0392854847f, 0.372745186f},
-std::array<float,2>{0.252095163f, 0.572855234f},
-std::array<float,2>{0.817677915f, 0.0693201795f},
-std::array<float,2>{0.709226012f, 0.529262424f},
-std::array<float,2>{0.160195142f, 0.0473328121f},
-std::array<float,2>{0.466112763f, 0.910308123f},
-std::array<float,2>{0.986555099f, 0.311433375f},
-std::array<float,2>{0.789678752f, 0.800898075f},
-std::array<float,2>{0.350527436f, 0.393214226f},
-std::array<float,2>{0.0904995948f, 0.675380349f},
-std::array<float,2>{0.509666383f, 0.241495043f},
-std::array<float,2>{0.787599087f, 0.744115651f},
-std::array<float,2>{0.355645478f, 0.137963727f},
-std::array<float,2>{0.0804528818f, 0.863672495f},
-std::array<float,2>{0.505276382f, 0.447000474f},
-std::array<float,2>{0.712238967f, 0.943052351f},
-std::array<float,2>{0.168253914f, 0.350516915f},
-std::array<float,2>{0.453563392f, 0.578594446f},
-std::array<float,2>{0.999699175f, 0.0847367495f},
-std::array<float,2>{0.594630182f, 0.507040799f},
-std::array<float,2>{0.0363985077f, 0.0453482494f},
-std::array<float,2>{0.259670019f, 0.936371505f},
-std::array<float,2>{0.82721585f, 0.293708622f},
-std::array<float,2>{0.93235141f, 0.792887628f},
-std::array<float,2>{0.427767813f, 0.384154558f},
-std::array<float,2>{0.239601344f, 0.658296824f},
-std::array<float,2>{0.63570708f, 0.223948017f},
-std::array<float,2>{0.944393992f, 0.607527912f},
-std::array<float,2>{0.499790043f, 0.123005234f},
-std::array<float,2>{0.135469973f, 0.987212598f},
-std::array<float,2>{0.748843133f, 0.315961957f},
-std::array<float,2>{0.556327283f, 0.817528427f},
-std::array<float,2>{0.100533776f, 0.49113974f},
-std::array<float,2>{0.326712728f, 0.718516469f},
-std::array<float,2>{0.75654459f, 0.181870893f},
-std::array<float,2>{0.658747971f, 0.627834558f},
-std::array<float,2>{0.202998608f, 0.1925724f},
-std::array<float,2>{0.396041274f, 0.778756142f},
-std::array<float,2>{0.876030385f, 0.407978714f},
-std::array<float,2>{0.847854137f, 0.881342709f},
-std::array<float,2>{0.301258504f, 0.253083467f},
-std::array<float,2>{0.0140809985f, 0.538853467f},
-std::array<float,2>{0.579124868f, 0.0183476228f},
-std::array<float,2>{0.832352698f, 0.546936929f},
-std::array<float,2>{0.266432524f, 0.00526776817f},
-std::array<float,2>{0.0522624105f, 0.899210036f},
-std::array<float,2>{0.614497006f, 0.270196319f},
-std::array<float,2>{0.642024755f, 0.762597144f},
-std::array<float,2>{0.233317688f, 0.427146345f},
-std::array<float,2>{0.420732796f, 0.65587616f},
-std::array<float,2>{0.921542585f, 0.205761239f},
-std::array<float,2>{0.518337786f, 0.696404159f},
-std::array<float,2>{0.0652934834f, 0.161912784f},
-std::array<float,2>{0.374991626f, 0.835535944f},
-std::array<float,2>{0.799779892f, 0.470488429f},
-std::array<float,2>{0.981415987f, 0.979607224f},
-std::array<float,2>{0.452776074f, 0.341290504f},
-std::array<float,2>{0.178789139f, 0.61176455f},
-std::array<float,2>{0.699134767f, 0.101679616f},
-std::array<float,2>{0.898333549f, 0.679324985f},
-std::array<float,2>{0.389187872f, 0.237785846f},
-std::array<float,2>{0.205645844f, 0.798131704f},
-std::array<float,2>{0.675430655f, 0.398253262f},
-std::array<float,2>{0.573076189f, 0.90853709f},
-std::array<float,2>{0.0249071922f, 0.305705607f},
-std::array<float,2>{0.291830719f, 0.52496314f},
-std::array<float,2>{0.859604001f, 0.0512038358f},
-std::array<float,2>{0.7230165f, 0.575858772f},
-std::array<float,2>{0.146937877f, 0.0639098063f},
-std::array<float,2>{0.472667485f, 0.958976388f},
-std::array<float,2>{0.962452412f, 0.370585501f},
-std::array<float,2>{0.769047141f, 0.857307911f},
-std::array<float,2>{0.342680156f, 0.455025375f},
-std::array<float,2>{0.115147106f, 0.733402908f},
-std::array<float,2>{0.538508534f, 0.153982729f},
-std::array<float,2>{0.872952878f, 0.64676553f},
-std::array<float,2>{0.288553685f, 0.213618562f},
-std::array<float,2>{0.0165642519f, 0.751826406f},
-std::array<float,2>{0.564562142f, 0.432198673f},
-std::array<float,2>{0.683940768f, 0.894444466f},
-std::array<float,2>{0.218222052f, 0.280479729f},
-std::array<float,2>{0.379831374f, 0.555024385f},
-std::array<float,2>{0.902120352f, 0.00984382164f},
-std::array<float,2>{0.542033076f, 0.622023821f},
-std::array<float,2>{0.118083924f, 0.0942986757f},
-std::array<float,2>{0.331573695f, 0.975414872f},
-std::array<float,2>{0.778730869f, 0.330646336f},
-std::array<float,2>{0.956314087f, 0.840569556f},
-std::array<float,2>{0.479469061f, 0.479992419f},
-std::array<float,2>{0.148635015f, 0.687592506f},
-std::array<float,2>{0.734105945f, 0.168799058f},
-std::array<float,2>{0.907632768f, 0.522459328f},
-std::array<float,2>{0.412535697f, 0.0559819825f},
-std::array<float,2>{0.219486803f, 0.915409684f},
-std::array<float,2>{0.655373693f, 0.303091794f},
-std::array<float,2>{0.621527731f, 0.810558975f},
-std::array<float,2>{0.0561624542f, 0.401951283f},
-std::array<float,2>{0.276771814f, 0.682677925f},
-std::array<float,2>{0.843481123f, 0.248814031f},
-std::array<float,2>{0.690428078f, 0.72618252f},
-std::array<float,2>{0.185050637f, 0.147175759f},
-std::array<float,2>{0.441475719f, 0.848180413f},
-std::array<float,2>{0.970609248f, 0.467560858f},
-std::array<float,2>{0.812017739f, 0.961014032f},
-std::array<float,2>{0.363566309f, 0.360896289f},
-std::array<float,2>{0.0712569878f, 0.565075457f},
-std::array<float,2>{0.524849892f, 0.0704438463f},
-std::array<float,2>{0.763556957f, 0.589944482f},
-std::array<float,2>{0.31805554f, 0.087974526f},
-std::array<float,2>{0.106867954f, 0.945987046f},
-std::array<float,2>{0.554632545f, 0.352357179f},
-std::array<float,2>{0.741628051f, 0.870221972f},
-std::array<float,2>{0.131270811f, 0.445265234f},
-std::array<float,2>{0.48565498f, 0.740669787f},
-std::array<float,2>{0.946120322f, 0.130023718f},
-std::array<float,2>{0.586780667f, 0.671227217f},
-std::array<float,2>{0.00189459557f, 0.228020534f},
-std::array<float,2>{0.306960285f, 0.783278584f},
-std::array<float,2>{0.856529176f, 0.379600495f},
-std::array<float,2>{0.889135182f, 0.925790071f},
-std::array<float,2>{0.406156838f, 0.284133136f},
-std::array<float,2>{0.188832924f, 0.512831211f},
-std::array<float,2>{0.665350318f, 0.0382748842f},
-std::array<float,2>{0.989252448f, 0.709052026f},
-std::array<float,2>{0.461995542f, 0.179249138f},
-std::array<float,2>{0.159497976f, 0.826845109f},
-std::array<float,2>{0.704737067f, 0.499709547f},
-std::array<float,2>{0.514237821f, 0.992387235f},
-std::array<float,2>{0.0894917175f, 0.323963076f},
-std::array<float,2>{0.345781893f, 0.600945055f},
-std::array<float,2>{0.794416249f, 0.110014059f},
-std::array<float,2>{0.630035937f, 0.541430056f},
-std::array<float,2>{0.249106899f, 0.0294644702f},
-std::array<float,2>{0.431984663f, 0.885241985f},
-std::array<float,2>{0.922584951f, 0.25905323f},
-std::array<float,2>{0.814637721f, 0.769828439f},
-std::array<float,2>{0.256047994f, 0.416977793f},
-std::array<float,2>{0.045858413f, 0.633784473f},
-std::array<float,2>{0.607607782f, 0.202394426f},
-std::array<float,2>{0.864319921f, 0.70346117f},
-std::array<float,2>{0.294749111f, 0.175362453f},
-std::array<float,2>{0.0279252771f, 0.821134448f},
-std::array<float,2>{0.574898362f, 0.495778739f},
-std::array<float,2>{0.67889446f, 0.997887075f},
-std::array<float,2>{0.208782434f, 0.32673049f},
-std::array<float,2>{0.38486287f, 0.597639501f},
-std::array<float,2>{0.892464101f, 0.114502214f},
-std::array<float,2>{0.532098055f, 0.546117246f},
-std::array<float,2>{0.11078614f, 0.0244285297f},
-std::array<float,2>{0.337141335f, 0.887457848f},
-std::array<float,2>{0.769704401f, 0.262635916f},
-std::array<float,2>{0.966921687f, 0.769131482f},
-std::array<float,2>{0.470380872f, 0.420966655f},
-std::array<float,2>{0.141706273f, 0.63950485f},
-std::array<float,2>{0.719138086f, 0.197200283f},
-std::array<float,2>{0.914124846f, 0.587811649f},
-std::array<float,2>{0.416020244f, 0.0903490931f},
-std::array<float,2>{0.229283303f, 0.951673567f},
-std::array<float,2>{0.644779146f, 0.358165681f},
-std::array<float,2>{0.609499812f, 0.874274731f},
-std::array<float,2>{0.0500686094f, 0.438713402f},
-std::array<float,2>{0.272138357f, 0.738129497f},
-std::array<float,2>{0.828176618f, 0.125028864f},
-std::array<float,2>{0.699519098f, 0.667891204f},
-std::array<float,2>{0.174375117f, 0.232505545f},
-std::array<float,2>{0.44916296f, 0.78669399f},
-std::array<float,2>{0.976843476f, 0.375050604f},
-std::array<float,2>{0.801121175f, 0.922992229f},
-std::array<float,2>{0.370176464f, 0.288873613f},
-std::array<float,2>{0.0693264529f, 0.509489059f},
-std::array<float,2>{0.521777987f, 0.0338826478f},
-std::array<float,2>{0.75077039f, 0.517843783f},
-std::array<float,2>{0.32261306f, 0.0612466745f},
-std::array<float,2>{0.0973214582f, 0.92101258f},
-std::array<float,2>{0.56058079f, 0.298277259f},
-std::array<float,2>{0.744338691f, 0.806114197f},
-std::array<float,2>{0.137300298f, 0.402857035f},
-std::array<float,2>{0.49521327f, 0.686440885f},
-std::array<float,2>{0.939302444f, 0.242788672f},
-std::array<float,2>{0.583763063f, 0.72203517f},
-std::array<float,2>{0.0116725359f, 0.14122276f},
-std::array<float,2>{0.297021478f, 0.844694257f},
-std::array<float,2>{0.844313502f, 0.461565882f},
-std::array<float,2>{0.879993618f, 0.96837765f},
-std::array<float,2>{0.392308027f, 0.36535722f},
-std::array<float,2>{0.198671609f, 0.569635212f},
-std::array<float,2>{0.663042188f, 0.0765438825f},
-std::array<float,2>{0.99272114f, 0.643253088f},
-std::array<float,2>{0.458042264f, 0.216675147f},
-std::array<float,2>{0.165634185f, 0.754140913f},
-std::array<float,2>{0.71775645f, 0.435824066f},
-std::array<float,2>{0.502658248f, 0.897434771f},
-std::array<float,2>{0.0842140466f, 0.276950717f},
-std::array<float,2>{0.352751136f, 0.560247838f},
-std::array<float,2>{0.78379637f, 0.0144049013f},
-std::array<float,2>{0.636854172f, 0.617748141f},
-std::array<float,2>{0.236597046f, 0.0990603715f},
-std::array<float,2>{0.425728649f, 0.971849859f},
-std::array<float,2>{0.935697436f, 0.332613438f},
-std::array<float,2>{0.821988523f, 0.836345077f},
-std::array<float,2>{0.261887789f, 0.481317699f},
-std::array<float,2>{0.0316390544f, 0.692725718f},
-std::array<float,2>{0.598571599f, 0.167602852f},
-std::array<float,2>{0.791971266f, 0.674232721f},
-std::array<float,2>{0.349312365f, 0.24054563f},
-std::array<float,2>{0.0928173065f, 0.801884115f},
-std::array<float,2>{0.509911835f, 0.394412398f},
-std::array<float,2>{0.707366645f, 0.912106454f},
-std::array<float,2>{0.163229987f, 0.311982274f},
-std::array<float,2>{0.46781373f, 0.527565181f},
-std::array<float,2>{0.986194015f, 0.0481052026f},
-std::array<float,2>{0.601672351f, 0.573640645f},
-std::array<float,2>{0.0421724878f, 0.0701962635f},
-std::array<float,2>{0.251841754f, 0.955667973f},
-std::array<float,2>{0.81842494f, 0.371942729f},
-std::array<float,2>{0.926913321f, 0.854277432f},
-std::array<float,2>{0.435092717f, 0.459601492f},
-std::array<float,2>{0.242818832f, 0.730364084f},
-std::array<float,2>{0.627898932f, 0.150031388f},
-std::array<float,2>{0.949364841f, 0.554639935f},
-std::array<float,2>{0.490675062f, 0.0014181392f},
-std::array<float,2>{0.126534313f, 0.905944049f},
-std::array<float,2>{0.735672832f, 0.266063601f},
-std::array<float,2>{0.549494982f, 0.760961831f},
-std::array<float,2>{0.103860416f, 0.422313511f},
-std::array<float,2>{0.31408447f, 0.650020063f},
-std::array<float,2>{0.758254111f, 0.207467571f},
-std::array<float,2>{0.67129755f, 0.700788438f},
-std::array<float,2>{0.194532275f, 0.156847179f},
-std::array<float,2>{0.401446015f, 0.828940153f},
-std::array<float,2>{0.886122048f, 0.473829448f},
-std::array<float,2>{0.852696896f, 0.980874658f},
-std::array<float,2>{0.31115064f, 0.338141412f},
-std::array<float,2>{0.00397757161f, 0.614708006f},
-std::array<float,2>{0.590165198f, 0.108381726f},
-std::array<float,2>{0.835942507f, 0.601955175f},
-std::array<float,2>{0.280527771f, 0.120648786f},
-std::array<float,2>{0.0594100095f, 0.992023706f},
-std::array<float,2>{0.619654477f, 0.317281306f},
-std::array<float,2>{0.650680244f, 0.815928042f},
-std::array<float,2>{0.226277396f, 0.487601697f},
-std::array<float,2>{0.408077955f, 0.7109707f},
-std::array<float,2>{0.911103845f, 0.184121698f},
-std::array<float,2>{0.530537367f, 0.631044865f},
-std::array<float,2>{0.0763776824f, 0.188906848f},
-std::array<float,2>{0.361274928f, 0.775229931f},
-std::array<float,2>{0.805964231f, 0.411150724f},
-std::array<float,2>{0.974883378f, 0.878382683f},
-std::array<float,2>{0.44045186f, 0.255313903f},
-std::array<float,2>{0.180475518f, 0.532219529f},
-std::array<float,2>{0.694688559f, 0.0219099727f},
-std::array<float,2>{0.904081702f, 0.748637736f},
-std::array<float,2>{0.377758473f, 0.13545765f},
-std::array<float,2>{0.214331686f, 0.861023486f},
-std::array<float,2>{0.681461275f, 0.452498615f},
-std::array<float,2>{0.566498518f, 0.940401375f},
-std::array<float,2>{0.0213908646f, 0.346432328f},
-std::array<float,2>{0.284966797f, 0.583497763f},
-std::array<float,2>{0.871022522f, 0.0784831569f},
-std::array<float,2>{0.727688193f, 0.502089083f},
-std::array<float,2>{0.153769389f, 0.0393155888f},
-std::array<float,2>{0.480981588f, 0.93320477f},
-std::array<float,2>{0.959860623f, 0.291542381f},
-std::array<float,2>{0.775486231f, 0.793797612f},
-std::array<float,2>{0.334782183f, 0.387734234f},
-std::array<float,2>{0.121748455f, 0.66207695f},
-std::array<float,2>{0.544865131f, 0.222282544f},
-std::array<float,2>{0.766204894f, 0.732749343f},
-std::array<float,2>{0.341009706f, 0.152522683f},
-std::array<float,2>{0.115757257f, 0.855627954f},
-std::array<float,2>{0.536192536f, 0.453550249f},
-std::array<float,2>{0.724789262f, 0.957216322f},
-std::array<float,2>{0.14548862f, 0.369589895f},
-std::array<float,2>{0.476129025f, 0.57431215f},
-std::array<float,2>{0.96461463f, 0.062815167f},
-std::array<float,2>{0.571199238f, 0.52392149f},
-std::array<float,2>{0.0257114265f, 0.0520101301f},
-std::array<float,2>{0.289337873f, 0.909706354f},
-std::array<float,2>{0.862537444f, 0.305107832f},
-std::array<float,2>{0.895415008f, 0.797690511f},
-std::array<float,2>{0.388671607f, 0.396568209f},
-std::array<float,2>{0.203815505f, 0.677791178f},
-std::array<float,2>{0.671952605f, 0.236775815f},
-std::array<float,2>{0.983926773f, 0.612482727f},
-std::array<float,2>{0.4507249f, 0.102704749f},
-std::array<float,2>{0.176857665f, 0.978822887f},
-std::array<float,2>{0.69668889f, 0.340363145f},
-std::array<float,2>{0.516073763f, 0.834097803f},
-std::array<float,2>{0.0639065802f, 0.469048858f},
-std::array<float,2>{0.372451454f, 0.696151912f},
-std::array<float,2>{0.798422694f, 0.160251766f},
-std::array<float,2>{0.644058824f, 0.654556572f},
-std::array<float,2>{0.230749294f, 0.206248477f},
-std::array<float,2>{0.419658303f, 0.763345003f},
-std::array<float,2>{0.919507682f, 0.426119328f},
-std::array<float,2>{0.834469736f, 0.900366783f},
-std::array<float,2>{0.267912984f, 0.270526081f},
-std::array<float,2>{0.0531464405f, 0.548045337f},
-std::array<float,2>{0.61533916f, 0.00472363317f},
-std::array<float,2>{0.850433767f, 0.537670791f},
-std::array<float,2>{0.303293645f, 0.0192497354f},
-std::array<float,2>{0.013645648f, 0.882320523f},
-std::array<float,2>{0.580927968f, 0.252782702f},
-std::array<float,2>{0.657214522f, 0.777898431f},
-std::array<float,2>{0.199391946f, 0.407085657f},
-std::array<float,2>{0.397972882f, 0.628133655f},
-std::array<float,2>{0.877521515f, 0.191749826f},
-std::array<float,2>{0.557887495f, 0.717161953f},
-std::array<float,2>{0.0992736965f, 0.183582962f},
-std::array<float,2>{0.324657679f, 0.816564381f},
-std::array<float,2>{0.754504323f, 0.491895288f},
-std::array<float,2>{0.942119002f, 0.987916112f},
-std::array<float,2>{0.496802002f, 0.315113217f},
-std::array<float,2>{0.133291453f, 0.609036922f},
-std::array<float,2>{0.746228993f, 0.121549949f},
-std::array<float,2>{0.9300372f, 0.659752667f},
-std::array<float,2>{0.427350491f, 0.223129317f},
-std::array<float,2>{0.241527006f, 0.79108125f},
-std::array<float,2>{0.634175539f, 0.383214831f},
-std::array<float,2>{0.597008228f, 0.937093556f},
-std::array<float,2>{0.0378020257f, 0.294007808f},
-std::array<float,2>{0.260216027f, 0.506680489f},
-std::array<float,2>{0.826129615f, 0.0462429039f},
-std::array<float,2>{0.714196086f, 0.57987535f},
-std::array<float,2>{0.171140894f, 0.0853146166f},
-std::array<float,2>{0.456110924f, 0.941864073f},
-std::array<float,2>{0.997691393f, 0.350707382f},
-std::array<float,2>{0.785975158f, 0.864704549f},
-std::array<float,2>{0.357929826f, 0.445461601f},
-std::array<float,2>{0.0789332688f, 0.743090332f},
-std::array<float,2>{0.507524133f, 0.13691324f},
-std::array<float,2>{0.813468039f, 0.634085178f},
-std::array<float,2>{0.255120724f, 0.201625913f},
-std::array<float,2>{0.0434462689f, 0.770823956f},
-std::array<float,2>{0.605559886f, 0.417284459f},
-std::array<float,2>{0.63256532f, 0.886324942f},
-std::array<float,2>{0.247689933f, 0.258133322f},
-std::array<float,2>{0.43093285f, 0.542652488f},
-std::array<float,2>{0.924182117f, 0.0303815585f},
-std::array<float,2>{0.512983918f, 0.599965513f},
-std::array<float,2>{0.0872566849f, 0.111188382f},
-std::array<float,2>{0.345578998f, 0.993442237f},
-std::array<float,2>{0.794926107f, 0.322793514f},
-std::array<float,2>{0.992060781f, 0.827282727f},
-std::array<float,2>{0.464595199f, 0.498856366f},
-std::array<float,2>{0.157411844f, 0.710314035f},
-std::array<float,2>{0.706680357f, 0.177830413f},
-std::array<float,2>{0.887881875f, 0.512144089f},
-std::array<float,2>{0.402734548f, 0.0376883335f},
-std::array<float,2>{0.189906433f, 0.927678406f},
-std::array<float,2>{0.667244256f, 0.285014838f},
-std::array<float,2>{0.588411212f, 0.784818888f},
-std::array<float,2>{0.00357809523f, 0.380195916f},
-std::array<float,2>{0.306076795f, 0.67007339f},
-std::array<float,2>{0.85751152f, 0.227271959f},
-std::array<float,2>{0.738532782f, 0.741915226f},
-std::array<float,2>{0.130236059f, 0.129526809f},
-std::array<float,2>{0.486756235f, 0.869724631f},
-std::array<float,2>{0.947656989f, 0.443374604f},
-std::array<float,2>{0.764526606f, 0.94706434f},
-std::array<float,2>{0.318393797f, 0.35341996f},
-std::array<float,2>{0.108794138f, 0.591036022f},
-std::array<float,2>{0.551937282f, 0.0895901397f},
-std::array<float,2>{0.809145212f, 0.566257596f},
-std::array<float,2>{0.366790682f, 0.0720119998f},
-std::array<float,2>{0.0740703791f, 0.962796807f},
-std::array<float,2>{0.526481867f, 0.359971136f},
-std::array<float,2>{0.687660158f, 0.849517524f},
-std::array<float,2>{0.187021598f, 0.467883289f},
-std::array<float,2>{0.444982529f, 0.725318372f},
-std::array<float,2>{0.972085476f, 0.148335636f},
-std::array<float,2>{0.62402308f, 0.681787133f},
-std::array<float,2>{0.0577357933f, 0.249035731f},
-std::array<float,2>{0.273805439f, 0.812375665f},
-std::array<float,2>{0.840526998f, 0.400863677f},
-std::array<float,2>{0.909690976f, 0.914525628f},
-std::array<float,2>{0.411067367f, 0.304341108f},
-std::array<float,2>{0.220788449f, 0.523198128f},
-std::array<float,2>{0.652953565f, 0.0552537665f},
-std::array<float,2>{0.954492986f, 0.689073086f},
-std::array<float,2>{0.478133589f, 0.169056132f},
-std::array<float,2>{0.15180406f, 0.841001034f},
-std::array<float,2>{0.732065618f, 0.478680879f},
-std::array<float,2>{0.54071486f, 0.975737393f},
-std::array<float,2>{0.120974854f, 0.331928372f},
-std::array<float,2>{0.329476953f, 0.622761071f},
-std::array<float,2>{0.781158268f, 0.0948728696f},
-std::array<float,2>{0.686625481f, 0.556475282f},
-std::array<float,2>{0.21678105f, 0.0112870699f},
-std::array<float,2>{0.381188542f, 0.892658055f},
-std::array<float,2>{0.899763703f, 0.279958308f},
-std::array<float,2>{0.874013424f, 0.750888586f},
-std::array<float,2>{0.285639495f, 0.433013618f},
-std::array<float,2>{0.0193696171f, 0.647674501f},
-std::array<float,2>{0.563908756f, 0.21417515f},
-std::array<float,2>{0.830456018f, 0.734670997f},
-std::array<float,2>{0.269789934f, 0.128755271f},
-std::array<float,2>{0.0482885689f, 0.872296095f},
-std::array<float,2>{0.61255157f, 0.440156102f},
-std::array<float,2>{0.648040831f, 0.949540555f},
-std::array<float,2>{0.226728365f, 0.355613381f},
-std::array<float,2>{0.415944278f, 0.588540554f},
-std::array<float,2>{0.917774677f, 0.0930881053f},
-std::array<float,2>{0.521276891f, 0.5105142f},
-std::array<float,2>{0.0679414123f, 0.0317675471f},
-std::array<float,2>{0.368067473f, 0.923905969f},
-std::array<float,2>{0.802973986f, 0.285413742f},
-std::array<float,2>{0.979099512f, 0.788557827f},
-std::array<float,2>{0.447209328f, 0.377660513f},
-std::array<float,2>{0.172949269f, 0.665176809f},
-std::array<float,2>{0.702517748f, 0.231788769f},
-std::array<float,2>{0.893253028f, 0.593856514f},
-std::array<float,2>{0.38391602f, 0.116467558f},
-std::array<float,2>{0.209064811f, 0.999252856f},
-std::array<float,2>{0.676938415f, 0.325000614f},
-std::array<float,2>{0.577673376f, 0.823370278f},
-std::array<float,2>{0.0304639544f, 0.492339462f},
-std::array<float,2>{0.296716273f, 0.70659095f},
-std::array<float,2>{0.866942763f, 0.172122136f},
-std::array<float,2>{0.72146529f, 0.638647795f},
-std::array<float,2>{0.144176245f, 0.198888198f},
-std::array<float,2>{0.471140891f, 0.765642941f},
-std::array<float,2>{0.965354383f, 0.418056667f},
-std::array<float,2>{0.772977293f, 0.889719486f},
-std::array<float,2>{0.338658988f, 0.264805585f},
-std::array<float,2>{0.113240533f, 0.543354034f},
-std::array<float,2>{0.53452903f, 0.0271686465f},
-std::array<float,2>{0.782410085f, 0.561497092f},
-std::array<float,2>{0.353535384f, 0.0134803439f},
-std::array<float,2>{0.082713671f, 0.895488322f},
-std::array<float,2>{0.501553655f, 0.275260299f},
-std::array<float,2>{0.715147555f, 0.756936252f},
-std::array<float,2>{0.166114092f, 0.433815002f},
-std::array<float,2>{0.460757375f, 0.640769541f},
-std::array<float,2>{0.995091498f, 0.217185438f},
-std::array<float,2>{0.599945426f, 0.693894923f},
-std::array<float,2>{0.0340875909f, 0.165072069f},
-std::array<float,2>{0.265131861f, 0.838700414f},
-std::array<float,2>{0.823459923f, 0.48362273f},
-std::array<float,2>{0.933737755f, 0.970537066f},
-std::array<float,2>{0.422554761f, 0.334138781f},
-std::array<float,2>{0.235958382f, 0.620524764f},
-std::array<float,2>{0.640351951f, 0.100716703f},
-std::array<float,2>{0.941405177f, 0.6842677f},
-std::array<float,2>{0.493736416f, 0.245519012f},
-std::array<float,2>{0.139117733f, 0.808217347f},
-std::array<float,2>{0.743489146f, 0.405717969f},
-std::array<float,2>{0.558923304f, 0.918848515f},
-std::array<float,2>{0.0953940153f, 0.298907727f},
-std::array<float,2>{0.320995748f, 0.516157627f},
-std::array<float,2>{0.75342828f, 0.0592639446f},
-std::array<float,2>{0.660772443f, 0.567391098f},
-std::array<float,2>{0.196637645f, 0.0747902095f},
-std::array<float,2>{0.394113421f, 0.966579139f},
-std::array<float,2>{0.88280338f, 0.363596857f},
-std::array<float,2>{0.846603394f, 0.847573578f},
-std::array<float,2>{0.300226718f, 0.463869333f},
-std::array<float,2>{0.00855579413f, 0.719245732f},
-std::array<float,2>{0.585071981f, 0.144252717f},
-std::array<float,2>{0.760284781f, 0.650879681f},
-std::array<float,2>{0.315894485f, 0.210526645f},
-std::array<float,2>{0.101723909f, 0.75823766f},
-std::array<float,2>{0.548404753f, 0.424768925f},
-std::array<float,2>{0.736854255f, 0.902482033f},
-std::array<float,2>{0.127993792f, 0.268789709f},
-std::array<float,2>{0.489853024f, 0.552245557f},
-std::array<float,2>{0.952391982f, 0.0032160331f},
-std::array<float,2>{0.593029618f, 0.616063535f},
-std::array<float,2>{0.00726531912f, 0.105541244f},
-std::array<float,2>{0.308862627f, 0.982763946f},
-std::array<float,2>{0.854052484f, 0.337796718f},
-std::array<float,2>{0.883940279f, 0.831429183f},
-std::array<float,2>{0.398732722f, 0.476382852f},
-std::array<float,2>{0.192002267f, 0.702966154f},
-std::array<float,2>{0.669912517f, 0.159442827f},
-std::array<float,2>{0.988267243f, 0.529570639f},
-std::array<float,2>{0.46550402f, 0.0488950163f},
-std::array<float,2>{0.161357284f, 0.913889587f},
-std::array<float,2>{0.71048516f, 0.309292495f},
-std::array<float,2>{0.508163273f, 0.804562747f},
-std::array<float,2>{0.0911696479f, 0.391353875f},
-std::array<float,2>{0.351436198f, 0.672151804f},
-std::array<float,2>{0.790123165f, 0.239831209f},
-std::array<float,2>{0.626902103f, 0.726623535f},
-std::array<float,2>{0.244153246f, 0.150420859f},
-std::array<float,2>{0.436333597f, 0.852413654f},
-std::array<float,2>{0.929259479f, 0.45864594f},
-std::array<float,2>{0.81716162f, 0.953463912f},
-std::array<float,2>{0.253863364f, 0.373090208f},
-std::array<float,2>{0.0405121781f, 0.571794212f},
-std::array<float,2>{0.605408132f, 0.0668147579f},
-std::array<float,2>{0.868962407f, 0.584874451f},
-std::array<float,2>{0.282070786f, 0.0815154687f},
-std::array<float,2>{0.0233137812f, 0.938343048f},
-std::array<float,2>{0.568475068f, 0.344602734f},
-std::array<float,2>{0.681809068f, 0.862569511f},
-std::array<float,2>{0.212265402f, 0.450001389f},
-std::array<float,2>{0.375323027f, 0.747626543f},
-std::array<float,2>{0.90579015f, 0.133387119f},
-std::array<float,2>{0.544957936f, 0.66387099f},
-std::array<float,2>{0.123592943f, 0.218942612f},
-std::array<float,2>{0.332579434f, 0.796190381f},
-std::array<float,2>{0.774357617f, 0.389743418f},
-std::array<float,2>{0.958599031f, 0.930197358f},
-std::array<float,2>{0.483325869f, 0.290292472f},
-std::array<float,2>{0.155208796f, 0.500431418f},
-std::array<float,2>{0.729903877f, 0.0424228683f},
-std::array<float,2>{0.913504004f, 0.71386075f},
-std::array<float,2>{0.409365207f, 0.186689839f},
-std::array<float,2>{0.224204034f, 0.813267887f},
-std::array<float,2>{0.65017277f, 0.486163884f},
-std::array<float,2>{0.617315948f, 0.988356411f},
-std::array<float,2>{0.0608431324f, 0.320111006f},
-std::array<float,2>{0.278940618f, 0.604915321f},
-std::array<float,2>{0.839751899f, 0.117795125f},
-std::array<float,2>{0.692648828f, 0.533621013f},
-std::array<float,2>{0.182846308f, 0.0198268592f},
-std::array<float,2>{0.438616782f, 0.875588953f},
-std::array<float,2>{0.974255383f, 0.256740898f},
-std::array<float,2>{0.807126164f, 0.776337087f},
-std::array<float,2>{0.36311087f, 0.414047629f},
-std::array<float,2>{0.0757137313f, 0.629773498f},
-std::array<float,2>{0.527837574f, 0.190525234f},
-std::array<float,2>{0.800687551f, 0.698780298f},
-std::array<float,2>{0.373576343f, 0.163620815f},
-std::array<float,2>{0.0660342276f, 0.832229495f},
-std::array<float,2>{0.518584311f, 0.472132266f},
-std::array<float,2>{0.697724581f, 0.978318334f},
-std::array<float,2>{0.178583473f, 0.341802716f},
-std::array<float,2>{0.451263785f, 0.609497607f},
-std::array<float,2>{0.982016683f, 0.104211345f},
-std::array<float,2>{0.613510311f, 0.549467504f},
-std::array<float,2>{0.0515669622f, 0.00713751046f},
-std::array<float,2>{0.266646028f, 0.901886284f},
-std::array<float,2>{0.833008587f, 0.272078246f},
-std::array<float,2>{0.920551121f, 0.76554805f},
-std::array<float,2>{0.421642184f, 0.428315938f},
-std::array<float,2>{0.233599782f, 0.652534246f},
-std::array<float,2>{0.64112246f, 0.204037249f},
-std::array<float,2>{0.96159035f, 0.577094793f},
-std::array<float,2>{0.474414408f, 0.0658589825f},
-std::array<float,2>{0.147673354f, 0.959387243f},
-std::array<float,2>{0.724149823f, 0.367397904f},
-std::array<float,2>{0.537417054f, 0.859194934f},
-std::array<float,2>{0.113923945f, 0.456145108f},
-std::array<float,2>{0.343661308f, 0.731754899f},
-std::array<float,2>{0.768072844f, 0.154491365f},
-std::array<float,2>{0.674218297f, 0.676499009f},
-std::array<float,2>{0.206768706f, 0.235350519f},
-std::array<float,2>{0.390196264f, 0.79910928f},
-std::array<float,2>{0.896547258f, 0.396138608f},
-std::array<float,2>{0.860434592f, 0.906455994f},
-std::array<float,2>{0.292485684f, 0.306963176f},
-std::array<float,2>{0.0237069875f, 0.525883913f},
-std::array<float,2>{0.573672175f, 0.0529156104f},
-std::array<float,2>{0.826437294f, 0.504706264f},
-std::array<float,2>{0.258190006f, 0.0442855246f},
-std::array<float,2>{0.0359645188f, 0.934966505f},
-std::array<float,2>{0.595203519f, 0.295792073f},
-std::array<float,2>{0.636387408f, 0.79001987f},
-std::array<float,2>{0.238313615f, 0.385174721f},
-std::array<float,2>{0.429083586f, 0.657093346f},
-std::array<float,2>{0.933127761f, 0.226147056f},
-std::array<float,2>{0.504064202f, 0.746025085f},
-std::array<float,2>{0.081262134f, 0.139259547f},
-std::array<float,2>{0.356798679f, 0.866384268f},
-std::array<float,2>{0.788821638f, 0.44830215f},
-std::array<float,2>{0.998223126f, 0.944638133f},
-std::array<float,2>{0.454910517f, 0.348400027f},
-std::array<float,2>{0.169888422f, 0.580591738f},
-std::array<float,2>{0.710990965f, 0.0825744644f},
-std::array<float,2>{0.875225902f, 0.626875699f},
-std::array<float,2>{0.394724965f, 0.194111064f},
-std::array<float,2>{0.2021451f, 0.78113389f},
-std::array<float,2>{0.659941256f, 0.409420609f},
-std::array<float,2>{0.578927994f, 0.879533648f},
-std::array<float,2>{0.0156218065f, 0.250166297f},
-std::array<float,2>{0.302415282f, 0.537012875f},
-std::array<float,2>{0.848700583f, 0.0161856022f},
-std::array<float,2>{0.749479115f, 0.606373906f},
-std::array<float,2>{0.136384457f, 0.124121442f},
-std::array<float,2>{0.498354197f, 0.986222386f},
-std::array<float,2>{0.943893909f, 0.312759817f},
-std::array<float,2>{0.756864429f, 0.818689764f},
-std::array<float,2>{0.327965498f, 0.489400983f},
-std::array<float,2>{0.101073176f, 0.71541065f},
-std::array<float,2>{0.555444479f, 0.18051444f},
-std::array<float,2>{0.855686486f, 0.668454409f},
-std::array<float,2>{0.307790905f, 0.228625163f},
-std::array<float,2>{0.000290803931f, 0.78212291f},
-std::array<float,2>{0.587671995f, 0.381302983f},
-std::array<float,2>{0.66479665f, 0.928540647f},
-std::array<float,2>{0.187948182f, 0.281569093f},
-std::array<float,2>{0.404579163f, 0.51422292f},
-std::array<float,2>{0.890004754f, 0.0361329578f},
-std::array<float,2>{0.553646982f, 0.593633771f},
-std::array<float,2>{0.106302559f, 0.0877030119f},
-std::array<float,2>{0.316458613f, 0.948803484f},
-std::array<float,2>{0.761914313f, 0.353834093f},
-std::array<float,2>{0.94671303f, 0.867691815f},
-std::array<float,2>{0.485147029f, 0.442967564f},
-std::array<float,2>{0.132130951f, 0.73887229f},
-std::array<float,2>{0.740679204f, 0.131988898f},
-std::array<float,2>{0.923005044f, 0.540195644f},
-std::array<float,2>{0.432645291f, 0.0288108829f},
-std::array<float,2>{0.249017045f, 0.884258687f},
-std::array<float,2>{0.629010797f, 0.260560244f},
-std::array<float,2>{0.608804464f, 0.771605432f},
-std::array<float,2>{0.0460790657f, 0.415400475f},
-std::array<float,2>{0.257003695f, 0.636207819f},
-std::array<float,2>{0.815839231f, 0.200788334f},
-std::array<float,2>{0.7037431f, 0.708799422f},
-std::array<float,2>{0.158972979f, 0.176534817f},
-std::array<float,2>{0.461823225f, 0.824775934f},
-std::array<float,2>{0.98928529f, 0.497556955f},
-std::array<float,2>{0.793626964f, 0.995895982f},
-std::array<float,2>{0.347011209f, 0.320758253f},
-std::array<float,2>{0.0888344944f, 0.599321187f},
-std::array<float,2>{0.51554811f, 0.112258732f},
-std::array<float,2>{0.777877092f, 0.624100447f},
-std::array<float,2>{0.330900162f, 0.0958108231f},
-std::array<float,2>{0.118608333f, 0.974260211f},
-std::array<float,2>{0.541663229f, 0.330058396f},
-std::array<float,2>{0.732887566f, 0.843650997f},
-std::array<float,2>{0.149731249f, 0.477096438f},
-std::array<float,2>{0.480055034f, 0.690986633f},
-std::array<float,2>{0.95547843f, 0.170428053f},
-std::array<float,2>{0.565768957f, 0.646347702f},
-std::array<float,2>{0.0172998141f, 0.211045146f},
-std::array<float,2>{0.28769955f, 0.753688395f},
-std::array<float,2>{0.871844888f, 0.430422395f},
-std::array<float,2>{0.901314855f, 0.891437232f},
-std::array<float,2>{0.379945755f, 0.277825803f},
-std::array<float,2>{0.217765689f, 0.55666548f},
-std::array<float,2>{0.684873164f, 0.00840260182f},
-std::array<float,2>{0.968834281f, 0.723147213f},
-std::array<float,2>{0.442658395f, 0.144771218f},
-std::array<float,2>{0.183902502f, 0.850206494f},
-std::array<float,2>{0.690439641f, 0.465893716f},
-std::array<float,2>{0.523949206f, 0.963195622f},
-std::array<float,2>{0.0721098706f, 0.361516744f},
-std::array<float,2>{0.364626765f, 0.562956989f},
-std::array<float,2>{0.810961425f, 0.0726091266f},
-std::array<float,2>{0.655105829f, 0.520730257f},
-std::array<float,2>{0.2205026f, 0.0571348481f},
-std::array<float,2>{0.413367718f, 0.917019784f},
-std::array<float,2>{0.907078564f, 0.302171677f},
-std::array<float,2>{0.842209339f, 0.809464037f},
-std::array<float,2>{0.275970906f, 0.400316119f},
-std::array<float,2>{0.05504914f, 0.681253016f},
-std::array<float,2>{0.622596622f, 0.246206582f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.71633184f, 0.760177314f},
-std::array<float,2>{0.232152984f, 0.139618888f},
-std::array<float,2>{0.357752234f, 0.583124757f},
-std::array<float,2>{0.841299772f, 0.348190099f},
-std::array<float,2>{0.889927626f, 0.711799741f},
-std::array<float,2>{0.481509566f, 0.438145608f},
-std::array<float,2>{0.0660957024f, 0.899130762f},
-std::array<float,2>{0.55945611f, 0.0198925808f},
-std::array<float,2>{0.600853145f, 0.537060976f},
-std::array<float,2>{0.0140564637f, 0.2918621f},
-std::array<float,2>{0.37710312f, 0.813231111f},
-std::array<float,2>{0.966740668f, 0.209203631f},
-std::array<float,2>{0.778452754f, 0.994732201f},
-std::array<float,2>{0.307073444f, 0.0767617822f},
-std::array<float,2>{0.159280032f, 0.646830976f},
-std::array<float,2>{0.631183565f, 0.396083117f},
-std::array<float,2>{0.519325733f, 0.9354195f},
-std::array<float,2>{0.0978550762f, 0.0478308871f},
-std::array<float,2>{0.466805756f, 0.73104465f},
-std::array<float,2>{0.918795764f, 0.469816983f},
-std::array<float,2>{0.854574442f, 0.599971712f},
-std::array<float,2>{0.323229045f, 0.319724232f},
-std::array<float,2>{0.200106233f, 0.797192454f},
-std::array<float,2>{0.723185837f, 0.167370588f},
-std::array<float,2>{0.659525633f, 0.683834493f},
-std::array<float,2>{0.141184419f, 0.413814455f},
-std::array<float,2>{0.276040852f, 0.966353297f},
-std::array<float,2>{0.785081387f, 0.119658902f},
-std::array<float,2>{0.980089962f, 0.867512167f},
-std::array<float,2>{0.426969618f, 0.248693898f},
-std::array<float,2>{0.0424184762f, 0.525334179f},
-std::array<float,2>{0.563715339f, 0.265944451f},
-std::array<float,2>{0.579295278f, 0.834563732f},
-std::array<float,2>{0.0522896014f, 0.192004696f},
-std::array<float,2>{0.408916444f, 0.547121525f},
-std::array<float,2>{0.997746944f, 0.305691451f},
-std::array<float,2>{0.797343254f, 0.625878394f},
-std::array<float,2>{0.250657201f, 0.376512825f},
-std::array<float,2>{0.125813246f, 0.979529262f},
-std::array<float,2>{0.68392694f, 0.0801099092f},
-std::array<float,2>{0.7460621f, 0.577802122f},
-std::array<float,2>{0.206892982f, 0.368542552f},
-std::array<float,2>{0.33767581f, 0.778489292f},
-std::array<float,2>{0.866792142f, 0.155493975f},
-std::array<float,2>{0.925370157f, 0.887659788f},
-std::array<float,2>{0.445219666f, 0.0147645343f},
-std::array<float,2>{0.119988084f, 0.689489484f},
-std::array<float,2>{0.514236987f, 0.454127818f},
-std::array<float,2>{0.642507792f, 0.938905597f},
-std::array<float,2>{0.175610751f, 0.0972906649f},
-std::array<float,2>{0.287666172f, 0.658383131f},
-std::array<float,2>{0.754164398f, 0.437105238f},
-std::array<float,2>{0.943251193f, 0.500199914f},
-std::array<float,2>{0.402531445f, 0.263104826f},
-std::array<float,2>{0.0230011046f, 0.853965342f},
-std::array<float,2>{0.61289978f, 0.232310757f},
-std::array<float,2>{0.540177286f, 0.736882448f},
-std::array<float,2>{0.0792070627f, 0.488692075f},
-std::array<float,2>{0.491133839f, 0.919713318f},
-std::array<float,2>{0.904533029f, 0.0435983315f},
-std::array<float,2>{0.812550247f, 0.783582628f},
-std::array<float,2>{0.364081651f, 0.186823547f},
-std::array<float,2>{0.236675531f, 0.617932916f},
-std::array<float,2>{0.701219678f, 0.328461289f},
-std::array<float,2>{0.672919095f, 0.846725762f},
-std::array<float,2>{0.137163371f, 0.224354967f},
-std::array<float,2>{0.263277113f, 0.515586138f},
-std::array<float,2>{0.81105423f, 0.253488153f},
-std::array<float,2>{0.984553456f, 0.667068005f},
-std::array<float,2>{0.416157722f, 0.427337736f},
-std::array<float,2>{0.0612609833f, 0.948578894f},
-std::array<float,2>{0.59033829f, 0.109245457f},
-std::array<float,2>{0.502758026f, 0.616384387f},
-std::array<float,2>{0.115078941f, 0.338021457f},
-std::array<float,2>{0.446085483f, 0.795793056f},
-std::array<float,2>{0.936497629f, 0.178242162f},
-std::array<float,2>{0.872480929f, 0.906973481f},
-std::array<float,2>{0.328200579f, 0.0341992527f},
-std::array<float,2>{0.216393933f, 0.747057199f},
-std::array<float,2>{0.734756768f, 0.493467867f},
-std::array<float,2>{0.624916494f, 0.976485074f},
-std::array<float,2>{0.0299615264f, 0.0930408761f},
-std::array<float,2>{0.390847653f, 0.635975182f},
-std::array<float,2>{0.948143959f, 0.385217488f},
-std::array<float,2>{0.765163481f, 0.555754662f},
-std::array<float,2>{0.29338035f, 0.30325976f},
-std::array<float,2>{0.182335958f, 0.840854466f},
-std::array<float,2>{0.651016116f, 0.196595669f},
-std::array<float,2>{0.689713836f, 0.696889639f},
-std::array<float,2>{0.245738566f, 0.462120414f},
-std::array<float,2>{0.367214918f, 0.880061865f},
-std::array<float,2>{0.82526195f, 0.00462307921f},
-std::array<float,2>{0.897083044f, 0.767561853f},
-std::array<float,2>{0.494829535f, 0.141291097f},
-std::array<float,2>{0.0932234302f, 0.56744504f},
-std::array<float,2>{0.538609564f, 0.360123962f},
-std::array<float,2>{0.550775707f, 0.804875493f},
-std::array<float,2>{0.0780935287f, 0.160811141f},
-std::array<float,2>{0.471267343f, 0.6086905f},
-std::array<float,2>{0.876015604f, 0.32709381f},
-std::array<float,2>{0.828428149f, 0.723306715f},
-std::array<float,2>{0.346720457f, 0.478969961f},
-std::array<float,2>{0.224094987f, 0.925807476f},
-std::array<float,2>{0.703281641f, 0.0554001853f},
-std::array<float,2>{0.639315128f, 0.516126633f},
-std::array<float,2>{0.171584293f, 0.273555845f},
-std::array<float,2>{0.297263712f, 0.863282204f},
-std::array<float,2>{0.76650387f, 0.239380151f},
-std::array<float,2>{0.953875065f, 0.959854245f},
-std::array<float,2>{0.38640058f, 0.112381659f},
-std::array<float,2>{0.0060878098f, 0.674534678f},
-std::array<float,2>{0.604050756f, 0.416799724f},
-std::array<float,2>{0.727655411f, 0.893131137f},
-std::array<float,2>{0.191832677f, 0.0257807001f},
-std::array<float,2>{0.314930707f, 0.706784844f},
-std::array<float,2>{0.849712253f, 0.44598335f},
-std::array<float,2>{0.913944423f, 0.58823967f},
-std::array<float,2>{0.45664975f, 0.359172434f},
-std::array<float,2>{0.105579123f, 0.753469825f},
-std::array<float,2>{0.5293383f, 0.126115903f},
-std::array<float,2>{0.57212615f, 0.655414879f},
-std::array<float,2>{0.0331573002f, 0.398948312f},
-std::array<float,2>{0.434208184f, 0.988973141f},
-std::array<float,2>{0.975885153f, 0.0634019673f},
-std::array<float,2>{0.790644646f, 0.823587179f},
-std::array<float,2>{0.272099644f, 0.211505488f},
-std::array<float,2>{0.152120396f, 0.540952086f},
-std::array<float,2>{0.670287848f, 0.2855286f},
-std::array<float,2>{0.74040556f, 0.818547487f},
-std::array<float,2>{0.211260021f, 0.205629125f},
-std::array<float,2>{0.333108604f, 0.531518161f},
-std::array<float,2>{0.869081914f, 0.295089006f},
-std::array<float,2>{0.930202007f, 0.64425832f},
-std::array<float,2>{0.451369554f, 0.393332332f},
-std::array<float,2>{0.109948672f, 0.999169588f},
-std::array<float,2>{0.507789552f, 0.0708891004f},
-std::array<float,2>{0.586663127f, 0.581945002f},
-std::array<float,2>{0.0551732369f, 0.344278693f},
-std::array<float,2>{0.419945151f, 0.765375733f},
-std::array<float,2>{0.990126073f, 0.133780047f},
-std::array<float,2>{0.805105925f, 0.906030476f},
-std::array<float,2>{0.259806812f, 0.017344337f},
-std::array<float,2>{0.135614842f, 0.718273401f},
-std::array<float,2>{0.678283572f, 0.443312764f},
-std::array<float,2>{0.533803284f, 0.963326216f},
-std::array<float,2>{0.0897718593f, 0.123128988f},
-std::array<float,2>{0.496403068f, 0.680722237f},
-std::array<float,2>{0.893631339f, 0.40769583f},
-std::array<float,2>{0.821688771f, 0.528560102f},
-std::array<float,2>{0.372327358f, 0.271848112f},
-std::array<float,2>{0.247373134f, 0.874077499f},
-std::array<float,2>{0.693469107f, 0.245762482f},
-std::array<float,2>{0.656125486f, 0.72889632f},
-std::array<float,2>{0.186730295f, 0.476119518f},
-std::array<float,2>{0.292405903f, 0.932155728f},
-std::array<float,2>{0.759550869f, 0.0528073348f},
-std::array<float,2>{0.951046705f, 0.803728878f},
-std::array<float,2>{0.396899253f, 0.170663297f},
-std::array<float,2>{0.0243149213f, 0.596022785f},
-std::array<float,2>{0.620250046f, 0.312588543f},
-std::array<float,2>{0.609142005f, 0.776189864f},
-std::array<float,2>{0.0017185813f, 0.149564072f},
-std::array<float,2>{0.387948841f, 0.573144376f},
-std::array<float,2>{0.957902193f, 0.373502582f},
-std::array<float,2>{0.772212505f, 0.691727638f},
-std::array<float,2>{0.30085519f, 0.458211482f},
-std::array<float,2>{0.167523563f, 0.886546612f},
-std::array<float,2>{0.636509597f, 0.0114132222f},
-std::array<float,2>{0.709423482f, 0.552918673f},
-std::array<float,2>{0.221775651f, 0.309117466f},
-std::array<float,2>{0.349079579f, 0.830515146f},
-std::array<float,2>{0.833800495f, 0.188133806f},
-std::array<float,2>{0.881620109f, 0.981470466f},
-std::array<float,2>{0.473130524f, 0.0828918815f},
-std::array<float,2>{0.0707647726f, 0.629698873f},
-std::array<float,2>{0.551699281f, 0.379623264f},
-std::array<float,2>{0.665368676f, 0.914497256f},
-std::array<float,2>{0.155887425f, 0.0424370244f},
-std::array<float,2>{0.266728699f, 0.741709292f},
-std::array<float,2>{0.795536637f, 0.48594591f},
-std::array<float,2>{0.970183611f, 0.623582184f},
-std::array<float,2>{0.429763108f, 0.334554166f},
-std::array<float,2>{0.0390294045f, 0.786681354f},
-std::array<float,2>{0.576160192f, 0.180096045f},
-std::array<float,2>{0.524661541f, 0.663898408f},
-std::array<float,2>{0.104440056f, 0.433363557f},
-std::array<float,2>{0.459668934f, 0.94220072f},
-std::array<float,2>{0.909936249f, 0.101416364f},
-std::array<float,2>{0.845526695f, 0.857684553f},
-std::array<float,2>{0.319048941f, 0.229939207f},
-std::array<float,2>{0.189048514f, 0.504820049f},
-std::array<float,2>{0.734286427f, 0.260598958f},
-std::array<float,2>{0.625953197f, 0.789084792f},
-std::array<float,2>{0.160628453f, 0.174515724f},
-std::array<float,2>{0.311849236f, 0.609527349f},
-std::array<float,2>{0.777240038f, 0.339886308f},
-std::array<float,2>{0.96462661f, 0.744535089f},
-std::array<float,2>{0.382037789f, 0.49836731f},
-std::array<float,2>{0.0108642867f, 0.91071254f},
-std::array<float,2>{0.596343577f, 0.0378508009f},
-std::array<float,2>{0.556311071f, 0.508595645f},
-std::array<float,2>{0.0672971159f, 0.257176727f},
-std::array<float,2>{0.479143441f, 0.849106371f},
-std::array<float,2>{0.883535624f, 0.218931273f},
-std::array<float,2>{0.838315308f, 0.952953219f},
-std::array<float,2>{0.352840722f, 0.104951181f},
-std::array<float,2>{0.226834759f, 0.671761036f},
-std::array<float,2>{0.714706659f, 0.42366606f},
-std::array<float,2>{0.568756819f, 0.875098705f},
-std::array<float,2>{0.0442062393f, 0.00144723686f},
-std::array<float,2>{0.425370872f, 0.700511634f},
-std::array<float,2>{0.982973695f, 0.467973351f},
-std::array<float,2>{0.787400186f, 0.566346109f},
-std::array<float,2>{0.277419299f, 0.364705265f},
-std::array<float,2>{0.148052901f, 0.772499919f},
-std::array<float,2>{0.662564218f, 0.147813872f},
-std::array<float,2>{0.722060621f, 0.638356864f},
-std::array<float,2>{0.196437851f, 0.389875412f},
-std::array<float,2>{0.325608641f, 0.970663846f},
-std::array<float,2>{0.856054664f, 0.0891167447f},
-std::array<float,2>{0.914298892f, 0.838208377f},
-std::array<float,2>{0.463463336f, 0.199550673f},
-std::array<float,2>{0.0942857191f, 0.56015867f},
-std::array<float,2>{0.521107018f, 0.300566882f},
-std::array<float,2>{0.508569479f, 0.861109495f},
-std::array<float,2>{0.122995086f, 0.234576866f},
-std::array<float,2>{0.440525681f, 0.521671593f},
-std::array<float,2>{0.928069949f, 0.28098157f},
-std::array<float,2>{0.861901283f, 0.678388f},
-std::array<float,2>{0.343548417f, 0.418979287f},
-std::array<float,2>{0.208144009f, 0.956923246f},
-std::array<float,2>{0.746801376f, 0.113368057f},
-std::array<float,2>{0.682424128f, 0.60228771f},
-std::array<float,2>{0.129251122f, 0.321236879f},
-std::array<float,2>{0.256814212f, 0.810759246f},
-std::array<float,2>{0.801102996f, 0.157899559f},
-std::array<float,2>{0.99362278f, 0.924523771f},
-std::array<float,2>{0.411711842f, 0.0611931011f},
-std::array<float,2>{0.0496116988f, 0.719311893f},
-std::array<float,2>{0.582257688f, 0.48155126f},
-std::array<float,2>{0.696640968f, 0.985616505f},
-std::array<float,2>{0.23993507f, 0.0681680441f},
-std::array<float,2>{0.360017091f, 0.650653005f},
-std::array<float,2>{0.819879472f, 0.404773504f},
-std::array<float,2>{0.900750995f, 0.543328762f},
-std::array<float,2>{0.485644877f, 0.281331062f},
-std::array<float,2>{0.0857645348f, 0.827171385f},
-std::array<float,2>{0.543789148f, 0.217421636f},
-std::array<float,2>{0.615878522f, 0.70968312f},
-std::array<float,2>{0.0180867296f, 0.452067077f},
-std::array<float,2>{0.399031401f, 0.894847155f},
-std::array<float,2>{0.937567115f, 0.0312236343f},
-std::array<float,2>{0.752671003f, 0.755283356f},
-std::array<float,2>{0.28461349f, 0.13071692f},
-std::array<float,2>{0.179240689f, 0.59022969f},
-std::array<float,2>{0.644551754f, 0.352446795f},
-std::array<float,2>{0.726168454f, 0.799572527f},
-std::array<float,2>{0.202680439f, 0.164104715f},
-std::array<float,2>{0.321447998f, 0.599420607f},
-std::array<float,2>{0.851629078f, 0.317499191f},
-std::array<float,2>{0.920264721f, 0.733097792f},
-std::array<float,2>{0.464907527f, 0.471669465f},
-std::array<float,2>{0.100154631f, 0.936934054f},
-std::array<float,2>{0.515829623f, 0.0506447479f},
-std::array<float,2>{0.565127254f, 0.526678622f},
-std::array<float,2>{0.0408111326f, 0.269428581f},
-std::array<float,2>{0.427927762f, 0.869738221f},
-std::array<float,2>{0.976986229f, 0.2463388f},
-std::array<float,2>{0.782544971f, 0.967695892f},
-std::array<float,2>{0.274185777f, 0.117485218f},
-std::array<float,2>{0.144446805f, 0.68718189f},
-std::array<float,2>{0.656840622f, 0.410266042f},
-std::array<float,2>{0.561953485f, 0.901160538f},
-std::array<float,2>{0.0627332106f, 0.0223227441f},
-std::array<float,2>{0.483881652f, 0.712926447f},
-std::array<float,2>{0.887259722f, 0.439516932f},
-std::array<float,2>{0.842225194f, 0.584273636f},
-std::array<float,2>{0.356221765f, 0.351070851f},
-std::array<float,2>{0.232514918f, 0.75795275f},
-std::array<float,2>{0.718162477f, 0.138320923f},
-std::array<float,2>{0.62946558f, 0.645462155f},
-std::array<float,2>{0.156466275f, 0.396736383f},
-std::array<float,2>{0.30631727f, 0.99273771f},
-std::array<float,2>{0.779516995f, 0.0758356601f},
-std::array<float,2>{0.967801809f, 0.816120207f},
-std::array<float,2>{0.376395851f, 0.207347602f},
-std::array<float,2>{0.0118976366f, 0.538471878f},
-std::array<float,2>{0.598756135f, 0.290983081f},
-std::array<float,2>{0.610098124f, 0.85265249f},
-std::array<float,2>{0.0204356648f, 0.232992098f},
-std::array<float,2>{0.405936927f, 0.502066314f},
-std::array<float,2>{0.943888724f, 0.265133321f},
-std::array<float,2>{0.757258713f, 0.656588972f},
-std::array<float,2>{0.285359949f, 0.435412139f},
-std::array<float,2>{0.172746152f, 0.939974904f},
-std::array<float,2>{0.643329024f, 0.0949572027f},
-std::array<float,2>{0.700550258f, 0.620545566f},
-std::array<float,2>{0.234537378f, 0.331056595f},
-std::array<float,2>{0.366652399f, 0.782705426f},
-std::array<float,2>{0.814575136f, 0.183844939f},
-std::array<float,2>{0.904022813f, 0.921132684f},
-std::array<float,2>{0.488479972f, 0.0456153266f},
-std::array<float,2>{0.0817200243f, 0.73590678f},
-std::array<float,2>{0.541642666f, 0.490525961f},
-std::array<float,2>{0.686708093f, 0.976807714f},
-std::array<float,2>{0.12813668f, 0.078659907f},
-std::array<float,2>{0.253615737f, 0.627903521f},
-std::array<float,2>{0.798901498f, 0.378902107f},
-std::array<float,2>{0.999389529f, 0.550537407f},
-std::array<float,2>{0.407460362f, 0.306992561f},
-std::array<float,2>{0.0537688807f, 0.833434045f},
-std::array<float,2>{0.580543756f, 0.193568215f},
-std::array<float,2>{0.513216674f, 0.687552571f},
-std::array<float,2>{0.118726656f, 0.45668447f},
-std::array<float,2>{0.442848414f, 0.888944745f},
-std::array<float,2>{0.922881663f, 0.0129790688f},
-std::array<float,2>{0.865142643f, 0.780227363f},
-std::array<float,2>{0.338777751f, 0.152348787f},
-std::array<float,2>{0.203762233f, 0.575214148f},
-std::array<float,2>{0.742714524f, 0.371035218f},
-std::array<float,2>{0.649440467f, 0.843105674f},
-std::array<float,2>{0.181540877f, 0.198040202f},
-std::array<float,2>{0.296270192f, 0.55729562f},
-std::array<float,2>{0.761815012f, 0.30130586f},
-std::array<float,2>{0.94691354f, 0.633776009f},
-std::array<float,2>{0.394148439f, 0.384048939f},
-std::array<float,2>{0.0290131923f, 0.972959697f},
-std::array<float,2>{0.621324062f, 0.0903552249f},
-std::array<float,2>{0.536070287f, 0.568451107f},
-std::array<float,2>{0.0908149183f, 0.36140126f},
-std::array<float,2>{0.493402213f, 0.767900109f},
-std::array<float,2>{0.895476937f, 0.143311203f},
-std::array<float,2>{0.826747f, 0.882749021f},
-std::array<float,2>{0.370134622f, 0.00742552849f},
-std::array<float,2>{0.243784875f, 0.69746536f},
-std::array<float,2>{0.689186156f, 0.463047057f},
-std::array<float,2>{0.592872322f, 0.946353555f},
-std::array<float,2>{0.0592385232f, 0.107230648f},
-std::array<float,2>{0.415913254f, 0.664275587f},
-std::array<float,2>{0.988251448f, 0.429577023f},
-std::array<float,2>{0.809302628f, 0.51341784f},
-std::array<float,2>{0.26558724f, 0.251888931f},
-std::array<float,2>{0.139687836f, 0.84502697f},
-std::array<float,2>{0.675672233f, 0.226485282f},
-std::array<float,2>{0.736957669f, 0.749767601f},
-std::array<float,2>{0.217428312f, 0.495483369f},
-std::array<float,2>{0.330972791f, 0.909844577f},
-std::array<float,2>{0.874263465f, 0.0313410424f},
-std::array<float,2>{0.935451627f, 0.79487282f},
-std::array<float,2>{0.447268873f, 0.177229762f},
-std::array<float,2>{0.11556372f, 0.614009261f},
-std::array<float,2>{0.500327528f, 0.337145627f},
-std::array<float,2>{0.527869582f, 0.751284242f},
-std::array<float,2>{0.109191634f, 0.127134487f},
-std::array<float,2>{0.453386068f, 0.585940778f},
-std::array<float,2>{0.911282182f, 0.356726199f},
-std::array<float,2>{0.849009335f, 0.7040115f},
-std::array<float,2>{0.31306842f, 0.447778374f},
-std::array<float,2>{0.195238054f, 0.891351402f},
-std::array<float,2>{0.729545236f, 0.0241701715f},
-std::array<float,2>{0.668030202f, 0.542679012f},
-std::array<float,2>{0.150120541f, 0.288966358f},
-std::array<float,2>{0.270364046f, 0.82057178f},
-std::array<float,2>{0.79131192f, 0.213839829f},
-std::array<float,2>{0.973211825f, 0.991920531f},
-std::array<float,2>{0.436260164f, 0.0652476177f},
-std::array<float,2>{0.0340929963f, 0.652842879f},
-std::array<float,2>{0.573621333f, 0.401575178f},
-std::array<float,2>{0.7060588f, 0.929076493f},
-std::array<float,2>{0.225762546f, 0.0583979078f},
-std::array<float,2>{0.345643371f, 0.726252675f},
-std::array<float,2>{0.831129611f, 0.478158623f},
-std::array<float,2>{0.877272964f, 0.606468022f},
-std::array<float,2>{0.470241427f, 0.324825048f},
-std::array<float,2>{0.0758953467f, 0.806655586f},
-std::array<float,2>{0.54840982f, 0.162939191f},
-std::array<float,2>{0.602309406f, 0.673541903f},
-std::array<float,2>{0.00438358728f, 0.41525805f},
-std::array<float,2>{0.38367039f, 0.957544565f},
-std::array<float,2>{0.956178367f, 0.11107862f},
-std::array<float,2>{0.76864332f, 0.867070317f},
-std::array<float,2>{0.298985094f, 0.241000563f},
-std::array<float,2>{0.168126747f, 0.519355834f},
-std::array<float,2>{0.638354421f, 0.276111901f},
-std::array<float,2>{0.693158746f, 0.87168318f},
-std::array<float,2>{0.249096692f, 0.243637457f},
-std::array<float,2>{0.3748568f, 0.530134141f},
-std::array<float,2>{0.824114859f, 0.271078944f},
-std::array<float,2>{0.890709817f, 0.682074726f},
-std::array<float,2>{0.498883694f, 0.408650458f},
-std::array<float,2>{0.0861736014f, 0.962643385f},
-std::array<float,2>{0.53267616f, 0.122782841f},
-std::array<float,2>{0.617189109f, 0.594252229f},
-std::array<float,2>{0.025871329f, 0.31526342f},
-std::array<float,2>{0.395779669f, 0.801980913f},
-std::array<float,2>{0.951726198f, 0.168232173f},
-std::array<float,2>{0.760121584f, 0.930534661f},
-std::array<float,2>{0.290099591f, 0.0509045199f},
-std::array<float,2>{0.185527444f, 0.726997375f},
-std::array<float,2>{0.654222369f, 0.473534644f},
-std::array<float,2>{0.505794764f, 0.996628881f},
-std::array<float,2>{0.113248959f, 0.0741155967f},
-std::array<float,2>{0.449582756f, 0.640913606f},
-std::array<float,2>{0.931843579f, 0.392104864f},
-std::array<float,2>{0.869368136f, 0.53411895f},
-std::array<float,2>{0.335039318f, 0.293999135f},
-std::array<float,2>{0.213272125f, 0.816610336f},
-std::array<float,2>{0.739505649f, 0.203708321f},
-std::array<float,2>{0.676681936f, 0.715571105f},
-std::array<float,2>{0.1347128f, 0.44446075f},
-std::array<float,2>{0.258675992f, 0.902649224f},
-std::array<float,2>{0.807018042f, 0.0178465657f},
-std::array<float,2>{0.991418421f, 0.762952328f},
-std::array<float,2>{0.419150889f, 0.136033714f},
-std::array<float,2>{0.0567075871f, 0.578158736f},
-std::array<float,2>{0.587894678f, 0.34632811f},
-std::array<float,2>{0.57758224f, 0.788119853f},
-std::array<float,2>{0.035934642f, 0.182373792f},
-std::array<float,2>{0.432805121f, 0.622588277f},
-std::array<float,2>{0.971348524f, 0.332446069f},
-std::array<float,2>{0.794891477f, 0.739689052f},
-std::array<float,2>{0.267892003f, 0.48808828f},
-std::array<float,2>{0.152352005f, 0.917021334f},
-std::array<float,2>{0.667755902f, 0.0398717858f},
-std::array<float,2>{0.731915832f, 0.506364405f},
-std::array<float,2>{0.189969242f, 0.258631557f},
-std::array<float,2>{0.317470402f, 0.856059372f},
-std::array<float,2>{0.846122563f, 0.226859674f},
-std::array<float,2>{0.906436801f, 0.94492811f},
-std::array<float,2>{0.457293332f, 0.0980213359f},
-std::array<float,2>{0.102566607f, 0.661949396f},
-std::array<float,2>{0.526858866f, 0.429715484f},
-std::array<float,2>{0.633763731f, 0.884186745f},
-std::array<float,2>{0.165831015f, 0.00835362636f},
-std::array<float,2>{0.302763522f, 0.694768012f},
-std::array<float,2>{0.76960963f, 0.459611028f},
-std::array<float,2>{0.96083194f, 0.572058022f},
-std::array<float,2>{0.38949886f, 0.372126222f},
-std::array<float,2>{0.00323632057f, 0.773644209f},
-std::array<float,2>{0.605702877f, 0.152311906f},
-std::array<float,2>{0.55455333f, 0.632462502f},
-std::array<float,2>{0.0733250603f, 0.381834388f},
-std::array<float,2>{0.474746257f, 0.983646572f},
-std::array<float,2>{0.879556f, 0.0847588554f},
-std::array<float,2>{0.834354997f, 0.828671992f},
-std::array<float,2>{0.349921227f, 0.190039977f},
-std::array<float,2>{0.219500959f, 0.552331567f},
-std::array<float,2>{0.708552003f, 0.311322331f},
-std::array<float,2>{0.660933316f, 0.771029413f},
-std::array<float,2>{0.145500049f, 0.145863235f},
-std::array<float,2>{0.279898018f, 0.563192487f},
-std::array<float,2>{0.786340356f, 0.365815043f},
-std::array<float,2>{0.981047451f, 0.702179968f},
-std::array<float,2>{0.42294234f, 0.466042727f},
-std::array<float,2>{0.0457911268f, 0.87855351f},
-std::array<float,2>{0.566516936f, 0.00214182585f},
-std::array<float,2>{0.522583246f, 0.562320054f},
-std::array<float,2>{0.097460933f, 0.298514038f},
-std::array<float,2>{0.461610049f, 0.836220205f},
-std::array<float,2>{0.916281104f, 0.201261222f},
-std::array<float,2>{0.858879089f, 0.971604347f},
-std::array<float,2>{0.32723242f, 0.0876630694f},
-std::array<float,2>{0.197486088f, 0.640598536f},
-std::array<float,2>{0.718767703f, 0.388221473f},
-std::array<float,2>{0.594084442f, 0.913850546f},
-std::array<float,2>{0.00788203161f, 0.0365252681f},
-std::array<float,2>{0.380213946f, 0.74229902f},
-std::array<float,2>{0.962546289f, 0.496686637f},
-std::array<float,2>{0.774954915f, 0.613157749f},
-std::array<float,2>{0.31040439f, 0.342936784f},
-std::array<float,2>{0.162846655f, 0.792649388f},
-std::array<float,2>{0.62755537f, 0.173372015f},
-std::array<float,2>{0.712072372f, 0.668622196f},
-std::array<float,2>{0.229382172f, 0.423902184f},
-std::array<float,2>{0.355126083f, 0.950977504f},
-std::array<float,2>{0.837721229f, 0.103173666f},
-std::array<float,2>{0.885497093f, 0.850334346f},
-std::array<float,2>{0.4783746f, 0.222492054f},
-std::array<float,2>{0.0701999813f, 0.511485934f},
-std::array<float,2>{0.557647705f, 0.255280793f},
-std::array<float,2>{0.546729684f, 0.826002419f},
-std::array<float,2>{0.0828597173f, 0.215901121f},
-std::array<float,2>{0.488243848f, 0.546246171f},
-std::array<float,2>{0.899018109f, 0.285002857f},
-std::array<float,2>{0.817597568f, 0.649938285f},
-std::array<float,2>{0.362248719f, 0.403589964f},
-std::array<float,2>{0.240554616f, 0.986846566f},
-std::array<float,2>{0.697289944f, 0.0695388466f},
-std::array<float,2>{0.646582544f, 0.592067063f},
-std::array<float,2>{0.176074818f, 0.354387522f},
-std::array<float,2>{0.282542974f, 0.756095469f},
-std::array<float,2>{0.75057143f, 0.132130831f},
-std::array<float,2>{0.940057814f, 0.898320615f},
-std::array<float,2>{0.401149809f, 0.0292537473f},
-std::array<float,2>{0.0171945561f, 0.707148015f},
-std::array<float,2>{0.614048958f, 0.44944796f},
-std::array<float,2>{0.74840647f, 0.953938186f},
-std::array<float,2>{0.210581869f, 0.116835259f},
-std::array<float,2>{0.340715945f, 0.677470684f},
-std::array<float,2>{0.861200809f, 0.420024276f},
-std::array<float,2>{0.926970899f, 0.519609034f},
-std::array<float,2>{0.438251168f, 0.278962076f},
-std::array<float,2>{0.124634773f, 0.862748265f},
-std::array<float,2>{0.50991559f, 0.236427501f},
-std::array<float,2>{0.585723162f, 0.721376836f},
-std::array<float,2>{0.0480222069f, 0.484030068f},
-std::array<float,2>{0.413751036f, 0.922119021f},
-std::array<float,2>{0.995973527f, 0.0588031933f},
-std::array<float,2>{0.80444026f, 0.809949398f},
-std::array<float,2>{0.255453169f, 0.158791795f},
-std::array<float,2>{0.131528765f, 0.60454464f},
-std::array<float,2>{0.680737495f, 0.322510242f},
-std::array<float,2>{0.702393591f, 0.781516016f},
-std::array<float,2>{0.237542421f, 0.184758708f},
-std::array<float,2>{0.365208626f, 0.620093644f},
-std::array<float,2>{0.813608646f, 0.330571026f},
-std::array<float,2>{0.905706763f, 0.734564483f},
-std::array<float,2>{0.491460294f, 0.491966367f},
-std::array<float,2>{0.079051204f, 0.920388997f},
-std::array<float,2>{0.539397717f, 0.0466472208f},
-std::array<float,2>{0.61159873f, 0.502984405f},
-std::array<float,2>{0.021737f, 0.26456964f},
-std::array<float,2>{0.403407007f, 0.852176011f},
-std::array<float,2>{0.941736877f, 0.233738303f},
-std::array<float,2>{0.754948556f, 0.940482497f},
-std::array<float,2>{0.288737565f, 0.0939887092f},
-std::array<float,2>{0.174678445f, 0.657424688f},
-std::array<float,2>{0.641357541f, 0.434335798f},
-std::array<float,2>{0.515258014f, 0.889802277f},
-std::array<float,2>{0.12045671f, 0.0122633986f},
-std::array<float,2>{0.443909228f, 0.688525915f},
-std::array<float,2>{0.924374819f, 0.455985695f},
-std::array<float,2>{0.865562677f, 0.574675322f},
-std::array<float,2>{0.336899847f, 0.369917035f},
-std::array<float,2>{0.205328807f, 0.78103739f},
-std::array<float,2>{0.744766414f, 0.153529301f},
-std::array<float,2>{0.685401797f, 0.62808466f},
-std::array<float,2>{0.126593962f, 0.377151102f},
-std::array<float,2>{0.25153473f, 0.977566242f},
-std::array<float,2>{0.798587024f, 0.0799154341f},
-std::array<float,2>{0.996272147f, 0.832946062f},
-std::array<float,2>{0.409931451f, 0.194636449f},
-std::array<float,2>{0.0508835651f, 0.549316645f},
-std::array<float,2>{0.579064727f, 0.308358103f},
-std::array<float,2>{0.562765419f, 0.871023893f},
-std::array<float,2>{0.0413201116f, 0.247085974f},
-std::array<float,2>{0.426142424f, 0.525828719f},
-std::array<float,2>{0.979112923f, 0.268287033f},
-std::array<float,2>{0.783701658f, 0.685902417f},
-std::array<float,2>{0.276686698f, 0.411583602f},
-std::array<float,2>{0.141807303f, 0.9683339f},
-std::array<float,2>{0.658427238f, 0.118366495f},
-std::array<float,2>{0.724488139f, 0.598276556f},
-std::array<float,2>{0.200205594f, 0.317317367f},
-std::array<float,2>{0.323408484f, 0.799904168f},
-std::array<float,2>{0.854394436f, 0.165396661f},
-std::array<float,2>{0.919276834f, 0.936314464f},
-std::array<float,2>{0.468276948f, 0.0488968939f},
-std::array<float,2>{0.099504374f, 0.733672738f},
-std::array<float,2>{0.518429756f, 0.472025096f},
-std::array<float,2>{0.631887138f, 0.993209422f},
-std::array<float,2>{0.158866301f, 0.0749380589f},
-std::array<float,2>{0.307816297f, 0.645804167f},
-std::array<float,2>{0.777403057f, 0.397817612f},
-std::array<float,2>{0.965791166f, 0.537697017f},
-std::array<float,2>{0.377990335f, 0.289438695f},
-std::array<float,2>{0.0147141917f, 0.815316439f},
-std::array<float,2>{0.600394189f, 0.208750904f},
-std::array<float,2>{0.560279846f, 0.714580595f},
-std::array<float,2>{0.065210551f, 0.440812439f},
-std::array<float,2>{0.481444538f, 0.901837468f},
-std::array<float,2>{0.889059186f, 0.022532884f},
-std::array<float,2>{0.840082586f, 0.759601176f},
-std::array<float,2>{0.359254628f, 0.137272388f},
-std::array<float,2>{0.230673552f, 0.585171759f},
-std::array<float,2>{0.715129793f, 0.350186974f},
-std::array<float,2>{0.671804667f, 0.821736395f},
-std::array<float,2>{0.151149809f, 0.214723676f},
-std::array<float,2>{0.273105562f, 0.541585147f},
-std::array<float,2>{0.789211571f, 0.287700623f},
-std::array<float,2>{0.975064516f, 0.653573692f},
-std::array<float,2>{0.435021579f, 0.400638372f},
-std::array<float,2>{0.0320879258f, 0.990830183f},
-std::array<float,2>{0.570616126f, 0.0656231642f},
-std::array<float,2>{0.530783296f, 0.587218285f},
-std::array<float,2>{0.106505133f, 0.356098175f},
-std::array<float,2>{0.45602718f, 0.750821412f},
-std::array<float,2>{0.91237396f, 0.128894031f},
-std::array<float,2>{0.851442277f, 0.892210186f},
-std::array<float,2>{0.315722108f, 0.0249220245f},
-std::array<float,2>{0.192401811f, 0.705036938f},
-std::array<float,2>{0.727021158f, 0.448281288f},
-std::array<float,2>{0.60481751f, 0.958663464f},
-std::array<float,2>{0.00760465115f, 0.109587416f},
-std::array<float,2>{0.384771287f, 0.672635734f},
-std::array<float,2>{0.954250813f, 0.414486319f},
-std::array<float,2>{0.767576396f, 0.517804444f},
-std::array<float,2>{0.29798612f, 0.277288705f},
-std::array<float,2>{0.170638233f, 0.865643501f},
-std::array<float,2>{0.639770806f, 0.241994917f},
-std::array<float,2>{0.704895258f, 0.725452781f},
-std::array<float,2>{0.222806036f, 0.476953655f},
-std::array<float,2>{0.346246809f, 0.927790463f},
-std::array<float,2>{0.829229653f, 0.057197433f},
-std::array<float,2>{0.87552619f, 0.808220327f},
-std::array<float,2>{0.472469002f, 0.163212553f},
-std::array<float,2>{0.0762805864f, 0.606292546f},
-std::array<float,2>{0.549261093f, 0.3255997f},
-std::array<float,2>{0.537389278f, 0.769438744f},
-std::array<float,2>{0.0924163461f, 0.144087136f},
-std::array<float,2>{0.495738447f, 0.569750071f},
-std::array<float,2>{0.897849858f, 0.363183677f},
-std::array<float,2>{0.825095356f, 0.698870182f},
-std::array<float,2>{0.368699789f, 0.464507878f},
-std::array<float,2>{0.244481057f, 0.881118417f},
-std::array<float,2>{0.691075265f, 0.00605487823f},
-std::array<float,2>{0.651706994f, 0.558088362f},
-std::array<float,2>{0.183544502f, 0.302539766f},
-std::array<float,2>{0.294740051f, 0.842734098f},
-std::array<float,2>{0.76429677f, 0.198562235f},
-std::array<float,2>{0.948575795f, 0.973847926f},
-std::array<float,2>{0.392271966f, 0.091333963f},
-std::array<float,2>{0.0303274449f, 0.634210885f},
-std::array<float,2>{0.62382251f, 0.383576512f},
-std::array<float,2>{0.735946834f, 0.908384442f},
-std::array<float,2>{0.21566391f, 0.0322864875f},
-std::array<float,2>{0.329923958f, 0.748465419f},
-std::array<float,2>{0.871893883f, 0.494905651f},
-std::array<float,2>{0.937165082f, 0.615151405f},
-std::array<float,2>{0.446972013f, 0.336876482f},
-std::array<float,2>{0.11385937f, 0.793419957f},
-std::array<float,2>{0.503638208f, 0.176447451f},
-std::array<float,2>{0.591429114f, 0.665685833f},
-std::array<float,2>{0.0622324161f, 0.428017795f},
-std::array<float,2>{0.417827219f, 0.945314705f},
-std::array<float,2>{0.98552227f, 0.106425412f},
-std::array<float,2>{0.811534405f, 0.844672203f},
-std::array<float,2>{0.262479842f, 0.224978238f},
-std::array<float,2>{0.138635367f, 0.512148678f},
-std::array<float,2>{0.67216903f, 0.250572115f},
-std::array<float,2>{0.732852757f, 0.857093334f},
-std::array<float,2>{0.187693879f, 0.2278229f},
-std::array<float,2>{0.319446743f, 0.507411897f},
-std::array<float,2>{0.844192803f, 0.259371698f},
-std::array<float,2>{0.908902824f, 0.660918653f},
-std::array<float,2>{0.460889578f, 0.431308448f},
-std::array<float,2>{0.104833022f, 0.943788767f},
-std::array<float,2>{0.524164796f, 0.0987475291f},
-std::array<float,2>{0.574815869f, 0.621541023f},
-std::array<float,2>{0.0379851721f, 0.333882958f},
-std::array<float,2>{0.430968791f, 0.787970185f},
-std::array<float,2>{0.96897316f, 0.183579624f},
-std::array<float,2>{0.796654344f, 0.916395009f},
-std::array<float,2>{0.266435534f, 0.0401249267f},
-std::array<float,2>{0.155136555f, 0.73889488f},
-std::array<float,2>{0.664826393f, 0.487000555f},
-std::array<float,2>{0.552408993f, 0.982806742f},
-std::array<float,2>{0.0718315318f, 0.0857983902f},
-std::array<float,2>{0.474024832f, 0.630909622f},
-std::array<float,2>{0.882513404f, 0.381856054f},
-std::array<float,2>{0.832577944f, 0.551492989f},
-std::array<float,2>{0.348513365f, 0.311571419f},
-std::array<float,2>{0.221071795f, 0.82943362f},
-std::array<float,2>{0.710877657f, 0.190955192f},
-std::array<float,2>{0.635129273f, 0.69390887f},
-std::array<float,2>{0.166652486f, 0.460439354f},
-std::array<float,2>{0.301796317f, 0.882830799f},
-std::array<float,2>{0.773314953f, 0.00904535502f},
-std::array<float,2>{0.95804286f, 0.774768233f},
-std::array<float,2>{0.386801928f, 0.151038989f},
-std::array<float,2>{0.000252965518f, 0.570840836f},
-std::array<float,2>{0.607963622f, 0.371212691f},
-std::array<float,2>{0.619425952f, 0.801624954f},
-std::array<float,2>{0.024767654f, 0.169046164f},
-std::array<float,2>{0.397541165f, 0.594841123f},
-std::array<float,2>{0.949777842f, 0.316020697f},
-std::array<float,2>{0.758779347f, 0.727785707f},
-std::array<float,2>{0.291589022f, 0.473637968f},
-std::array<float,2>{0.18643178f, 0.931582451f},
-std::array<float,2>{0.655076385f, 0.0520018823f},
-std::array<float,2>{0.695143342f, 0.530832827f},
-std::array<float,2>{0.246147379f, 0.270162374f},
-std::array<float,2>{0.371276379f, 0.872409463f},
-std::array<float,2>{0.820324779f, 0.242955387f},
-std::array<float,2>{0.892709553f, 0.961063743f},
-std::array<float,2>{0.497123748f, 0.121475771f},
-std::array<float,2>{0.0885628313f, 0.682721794f},
-std::array<float,2>{0.534375191f, 0.40932253f},
-std::array<float,2>{0.678882301f, 0.903413951f},
-std::array<float,2>{0.136525631f, 0.0192233007f},
-std::array<float,2>{0.260994226f, 0.716264665f},
-std::array<float,2>{0.806065083f, 0.443539709f},
-std::array<float,2>{0.988446653f, 0.579988718f},
-std::array<float,2>{0.421624869f, 0.347140461f},
-std::array<float,2>{0.0564804636f, 0.762618244f},
-std::array<float,2>{0.587219179f, 0.135194942f},
-std::array<float,2>{0.506613076f, 0.641651988f},
-std::array<float,2>{0.111128546f, 0.391419828f},
-std::array<float,2>{0.452769309f, 0.997515202f},
-std::array<float,2>{0.931638062f, 0.0726498216f},
-std::array<float,2>{0.86775744f, 0.817948043f},
-std::array<float,2>{0.332463235f, 0.204557985f},
-std::array<float,2>{0.21259512f, 0.53498137f},
-std::array<float,2>{0.741439521f, 0.293410122f},
-std::array<float,2>{0.645777464f, 0.757540524f},
-std::array<float,2>{0.178435549f, 0.131383643f},
-std::array<float,2>{0.283329874f, 0.593341053f},
-std::array<float,2>{0.753241062f, 0.355177999f},
-std::array<float,2>{0.93882072f, 0.708839536f},
-std::array<float,2>{0.399637312f, 0.450814605f},
-std::array<float,2>{0.019457113f, 0.896923423f},
-std::array<float,2>{0.617088377f, 0.0280157607f},
-std::array<float,2>{0.544433236f, 0.545883596f},
-std::array<float,2>{0.0847449899f, 0.28353703f},
-std::array<float,2>{0.48519814f, 0.824824572f},
-std::array<float,2>{0.901457787f, 0.215236887f},
-std::array<float,2>{0.818504751f, 0.987494051f},
-std::array<float,2>{0.360673487f, 0.0693111196f},
-std::array<float,2>{0.238422409f, 0.649118781f},
-std::array<float,2>{0.696076512f, 0.402702183f},
-std::array<float,2>{0.583624661f, 0.923110902f},
-std::array<float,2>{0.0501351915f, 0.0603311397f},
-std::array<float,2>{0.41059643f, 0.72233355f},
-std::array<float,2>{0.992924154f, 0.48284775f},
-std::array<float,2>{0.802478611f, 0.603935838f},
-std::array<float,2>{0.257230818f, 0.323987871f},
-std::array<float,2>{0.130444497f, 0.808701038f},
-std::array<float,2>{0.683341801f, 0.15967451f},
-std::array<float,2>{0.747683465f, 0.67600441f},
-std::array<float,2>{0.207477063f, 0.420909345f},
-std::array<float,2>{0.34243241f, 0.954486966f},
-std::array<float,2>{0.86326617f, 0.115414426f},
-std::array<float,2>{0.929683328f, 0.862032473f},
-std::array<float,2>{0.439684093f, 0.237791911f},
-std::array<float,2>{0.121290579f, 0.520509481f},
-std::array<float,2>{0.508856714f, 0.278063983f},
-std::array<float,2>{0.520078897f, 0.83787781f},
-std::array<float,2>{0.0953905359f, 0.202160075f},
-std::array<float,2>{0.464379787f, 0.561435819f},
-std::array<float,2>{0.915117443f, 0.297788858f},
-std::array<float,2>{0.857335865f, 0.638677716f},
-std::array<float,2>{0.324511915f, 0.38722077f},
-std::array<float,2>{0.195513994f, 0.972303689f},
-std::array<float,2>{0.72160852f, 0.086749427f},
-std::array<float,2>{0.663600564f, 0.564397395f},
-std::array<float,2>{0.146655336f, 0.367109746f},
-std::array<float,2>{0.278866351f, 0.769800603f},
-std::array<float,2>{0.788538158f, 0.145431623f},
-std::array<float,2>{0.984179616f, 0.877527475f},
-std::array<float,2>{0.424161047f, 0.00384367513f},
-std::array<float,2>{0.0438057147f, 0.701486647f},
-std::array<float,2>{0.569355547f, 0.4651317f},
-std::array<float,2>{0.713800728f, 0.949671447f},
-std::array<float,2>{0.228208259f, 0.101925172f},
-std::array<float,2>{0.352222294f, 0.669390976f},
-std::array<float,2>{0.839427173f, 0.42555967f},
-std::array<float,2>{0.884464204f, 0.510100842f},
-std::array<float,2>{0.479548275f, 0.254060149f},
-std::array<float,2>{0.0678310096f, 0.851381302f},
-std::array<float,2>{0.555399895f, 0.221043482f},
-std::array<float,2>{0.596863091f, 0.743304193f},
-std::array<float,2>{0.0106632337f, 0.497602642f},
-std::array<float,2>{0.381182194f, 0.913021863f},
-std::array<float,2>{0.963362455f, 0.0354660526f},
-std::array<float,2>{0.776180923f, 0.791343272f},
-std::array<float,2>{0.310640544f, 0.172660351f},
-std::array<float,2>{0.161987975f, 0.611582279f},
-std::array<float,2>{0.626313984f, 0.342465997f},
-std::array<float,2>{0.743623018f, 0.777920902f},
-std::array<float,2>{0.204676822f, 0.154732049f},
-std::array<float,2>{0.339815289f, 0.576914549f},
-std::array<float,2>{0.863395929f, 0.36766848f},
-std::array<float,2>{0.922498941f, 0.691361427f},
-std::array<float,2>{0.441726059f, 0.454099923f},
-std::array<float,2>{0.117701821f, 0.88863045f},
-std::array<float,2>{0.512553275f, 0.0146327605f},
-std::array<float,2>{0.581976831f, 0.548797727f},
-std::array<float,2>{0.0533479229f, 0.304999977f},
-std::array<float,2>{0.406976819f, 0.835834801f},
-std::array<float,2>{0.998536408f, 0.193284556f},
-std::array<float,2>{0.799845755f, 0.978763878f},
-std::array<float,2>{0.25265342f, 0.0818630382f},
-std::array<float,2>{0.127662838f, 0.626096666f},
-std::array<float,2>{0.686204731f, 0.375845075f},
-std::array<float,2>{0.542209804f, 0.918636501f},
-std::array<float,2>{0.0802192688f, 0.0441514552f},
-std::array<float,2>{0.489753872f, 0.738048375f},
-std::array<float,2>{0.902982533f, 0.489537418f},
-std::array<float,2>{0.815758407f, 0.618948877f},
-std::array<float,2>{0.365829706f, 0.329195291f},
-std::array<float,2>{0.235850006f, 0.785153866f},
-std::array<float,2>{0.699979126f, 0.185935497f},
-std::array<float,2>{0.643707156f, 0.659780741f},
-std::array<float,2>{0.173210084f, 0.435948044f},
-std::array<float,2>{0.286623806f, 0.93796891f},
-std::array<float,2>{0.756178737f, 0.0963099003f},
-std::array<float,2>{0.945041955f, 0.855337262f},
-std::array<float,2>{0.405158758f, 0.230600312f},
-std::array<float,2>{0.0211335849f, 0.501730919f},
-std::array<float,2>{0.610667348f, 0.261979371f},
-std::array<float,2>{0.598205328f, 0.813619435f},
-std::array<float,2>{0.013505972f, 0.210669056f},
-std::array<float,2>{0.375595391f, 0.53589648f},
-std::array<float,2>{0.967541635f, 0.292199552f},
-std::array<float,2>{0.780274093f, 0.647796154f},
-std::array<float,2>{0.305031687f, 0.395453453f},
-std::array<float,2>{0.157958761f, 0.995128155f},
-std::array<float,2>{0.630183816f, 0.0773377568f},
-std::array<float,2>{0.717172742f, 0.582962394f},
-std::array<float,2>{0.23368375f, 0.348970443f},
-std::array<float,2>{0.356573045f, 0.761606455f},
-std::array<float,2>{0.842825294f, 0.140392154f},
-std::array<float,2>{0.888635218f, 0.900138795f},
-std::array<float,2>{0.482452273f, 0.0214717817f},
-std::array<float,2>{0.0642672032f, 0.712194264f},
-std::array<float,2>{0.560809135f, 0.439021289f},
-std::array<float,2>{0.657269001f, 0.964967668f},
-std::array<float,2>{0.143118158f, 0.121013939f},
-std::array<float,2>{0.274989635f, 0.684814751f},
-std::array<float,2>{0.781608522f, 0.413028032f},
-std::array<float,2>{0.97781682f, 0.523498118f},
-std::array<float,2>{0.429604471f, 0.267272592f},
-std::array<float,2>{0.0395409167f, 0.868907988f},
-std::array<float,2>{0.565845728f, 0.249150589f},
-std::array<float,2>{0.517345071f, 0.732116759f},
-std::array<float,2>{0.101462945f, 0.469414115f},
-std::array<float,2>{0.466748923f, 0.934341192f},
-std::array<float,2>{0.921494782f, 0.0479980111f},
-std::array<float,2>{0.853443921f, 0.798241615f},
-std::array<float,2>{0.321220309f, 0.166653425f},
-std::array<float,2>{0.201664627f, 0.601221681f},
-std::array<float,2>{0.725544631f, 0.318775237f},
-std::array<float,2>{0.637515962f, 0.864852488f},
-std::array<float,2>{0.169619709f, 0.23866725f},
-std::array<float,2>{0.300050765f, 0.516836703f},
-std::array<float,2>{0.767830074f, 0.274932474f},
-std::array<float,2>{0.955743551f, 0.675436378f},
-std::array<float,2>{0.384605229f, 0.417440504f},
-std::array<float,2>{0.00520358467f, 0.960591018f},
-std::array<float,2>{0.60298574f, 0.111578695f},
-std::array<float,2>{0.547381282f, 0.607572377f},
-std::array<float,2>{0.0746229142f, 0.327787817f},
-std::array<float,2>{0.469445884f, 0.806579888f},
-std::array<float,2>{0.878005683f, 0.161382109f},
-std::array<float,2>{0.830785334f, 0.926912665f},
-std::array<float,2>{0.343833417f, 0.0565070398f},
-std::array<float,2>{0.225555032f, 0.723966122f},
-std::array<float,2>{0.705646574f, 0.480139345f},
-std::array<float,2>{0.57266748f, 0.989811957f},
-std::array<float,2>{0.0349888206f, 0.063810885f},
-std::array<float,2>{0.436929524f, 0.655269086f},
-std::array<float,2>{0.97415787f, 0.400108278f},
-std::array<float,2>{0.792707384f, 0.539474785f},
-std::array<float,2>{0.271171778f, 0.286587626f},
-std::array<float,2>{0.148523718f, 0.823031306f},
-std::array<float,2>{0.669518828f, 0.212552369f},
-std::array<float,2>{0.729340434f, 0.705676973f},
-std::array<float,2>{0.194317922f, 0.446949542f},
-std::array<float,2>{0.314055502f, 0.894055367f},
-std::array<float,2>{0.848501623f, 0.0272557773f},
-std::array<float,2>{0.910686314f, 0.751970351f},
-std::array<float,2>{0.454512954f, 0.125669152f},
-std::array<float,2>{0.108221255f, 0.589042306f},
-std::array<float,2>{0.529202521f, 0.357442766f},
-std::array<float,2>{0.501351178f, 0.796355009f},
-std::array<float,2>{0.116896816f, 0.17904751f},
-std::array<float,2>{0.448471218f, 0.615477324f},
-std::array<float,2>{0.934412837f, 0.338901758f},
-std::array<float,2>{0.873783708f, 0.747785628f},
-std::array<float,2>{0.331693798f, 0.492772013f},
-std::array<float,2>{0.217847124f, 0.907849252f},
-std::array<float,2>{0.738135755f, 0.0335179791f},
-std::array<float,2>{0.67422092f, 0.51387465f},
-std::array<float,2>{0.139526635f, 0.252173543f},
-std::array<float,2>{0.263846159f, 0.846133947f},
-std::array<float,2>{0.809848666f, 0.222934663f},
-std::array<float,2>{0.986938179f, 0.947579801f},
-std::array<float,2>{0.414657503f, 0.107641481f},
-std::array<float,2>{0.0599185675f, 0.666430235f},
-std::array<float,2>{0.592126846f, 0.426111281f},
-std::array<float,2>{0.688236654f, 0.879770339f},
-std::array<float,2>{0.242805228f, 0.00499670347f},
-std::array<float,2>{0.369289964f, 0.695636153f},
-std::array<float,2>{0.827185988f, 0.461622238f},
-std::array<float,2>{0.896013558f, 0.566736221f},
-std::array<float,2>{0.492716461f, 0.361326545f},
-std::array<float,2>{0.0914864838f, 0.7659958f},
-std::array<float,2>{0.536791325f, 0.142412826f},
-std::array<float,2>{0.622557342f, 0.63498044f},
-std::array<float,2>{0.027425969f, 0.385875225f},
-std::array<float,2>{0.392910212f, 0.974834621f},
-std::array<float,2>{0.945922136f, 0.0925377086f},
-std::array<float,2>{0.762743294f, 0.840649784f},
-std::array<float,2>{0.295338571f, 0.196164981f},
-std::array<float,2>{0.179832637f, 0.554764926f},
-std::array<float,2>{0.648970008f, 0.303787857f},
-std::array<float,2>{0.707603753f, 0.831520796f},
-std::array<float,2>{0.220454022f, 0.189222351f},
-std::array<float,2>{0.350854814f, 0.554143429f},
-std::array<float,2>{0.835643113f, 0.310275853f},
-std::array<float,2>{0.879915237f, 0.630286276f},
-std::array<float,2>{0.476348191f, 0.380312979f},
-std::array<float,2>{0.0730465353f, 0.981074333f},
-std::array<float,2>{0.553214192f, 0.083500579f},
-std::array<float,2>{0.607103705f, 0.573945642f},
-std::array<float,2>{0.00218093302f, 0.37412864f},
-std::array<float,2>{0.389917076f, 0.777255297f},
-std::array<float,2>{0.959614336f, 0.149117023f},
-std::array<float,2>{0.771157742f, 0.885050178f},
-std::array<float,2>{0.303803325f, 0.0103013702f},
-std::array<float,2>{0.164363131f, 0.692764938f},
-std::array<float,2>{0.634656906f, 0.457584679f},
-std::array<float,2>{0.525489807f, 0.943333745f},
-std::array<float,2>{0.102254294f, 0.100522302f},
-std::array<float,2>{0.458751678f, 0.662195742f},
-std::array<float,2>{0.90729624f, 0.431752354f},
-std::array<float,2>{0.847547114f, 0.505766451f},
-std::array<float,2>{0.316787452f, 0.261694431f},
-std::array<float,2>{0.191121697f, 0.859300613f},
-std::array<float,2>{0.731269777f, 0.229406759f},
-std::array<float,2>{0.666308045f, 0.740846217f},
-std::array<float,2>{0.153909624f, 0.485025346f},
-std::array<float,2>{0.269241124f, 0.915144682f},
-std::array<float,2>{0.793586195f, 0.0415784679f},
-std::array<float,2>{0.972584963f, 0.785499871f},
-std::array<float,2>{0.432081223f, 0.180813625f},
-std::array<float,2>{0.0370889381f, 0.624736428f},
-std::array<float,2>{0.576585352f, 0.335077107f},
-std::array<float,2>{0.589540541f, 0.764312685f},
-std::array<float,2>{0.0584160276f, 0.134735048f},
-std::array<float,2>{0.418816328f, 0.580362737f},
-std::array<float,2>{0.990498364f, 0.345222861f},
-std::array<float,2>{0.807658613f, 0.717703402f},
-std::array<float,2>{0.259091109f, 0.442037851f},
-std::array<float,2>{0.13304767f, 0.904607356f},
-std::array<float,2>{0.676973879f, 0.0156978499f},
-std::array<float,2>{0.738739192f, 0.532705486f},
-std::array<float,2>{0.21462667f, 0.296489149f},
-std::array<float,2>{0.334333271f, 0.81949836f},
-std::array<float,2>{0.870910704f, 0.206757382f},
-std::array<float,2>{0.933210671f, 0.998122334f},
-std::array<float,2>{0.450671703f, 0.0717106983f},
-std::array<float,2>{0.111819096f, 0.64341116f},
-std::array<float,2>{0.504240692f, 0.393946201f},
-std::array<float,2>{0.65326488f, 0.932920158f},
-std::array<float,2>{0.184270725f, 0.0540765263f},
-std::array<float,2>{0.289631188f, 0.73039037f},
-std::array<float,2>{0.761124969f, 0.474899441f},
-std::array<float,2>{0.952367127f, 0.596998155f},
-std::array<float,2>{0.394550174f, 0.313710779f},
-std::array<float,2>{0.0270042997f, 0.803562224f},
-std::array<float,2>{0.618418455f, 0.171284929f},
-std::array<float,2>{0.531339228f, 0.680232525f},
-std::array<float,2>{0.0877344012f, 0.406509787f},
-std::array<float,2>{0.499079466f, 0.964755893f},
-std::array<float,2>{0.891684651f, 0.124263361f},
-std::array<float,2>{0.823172212f, 0.873462677f},
-std::array<float,2>{0.373895913f, 0.244338915f},
-std::array<float,2>{0.24892275f, 0.527447402f},
-std::array<float,2>{0.691941977f, 0.272737414f},
-std::array<float,2>{0.679771841f, 0.81152755f},
-std::array<float,2>{0.132522523f, 0.156644613f},
-std::array<float,2>{0.254544854f, 0.602674305f},
-std::array<float,2>{0.803185821f, 0.321967542f},
-std::array<float,2>{0.994620919f, 0.7204898f},
-std::array<float,2>{0.413025737f, 0.481237203f},
-std::array<float,2>{0.0471605286f, 0.925466359f},
-std::array<float,2>{0.584262073f, 0.0619404204f},
-std::array<float,2>{0.511417091f, 0.522795022f},
-std::array<float,2>{0.123802729f, 0.279391289f},
-std::array<float,2>{0.438494772f, 0.860337973f},
-std::array<float,2>{0.926004171f, 0.235668033f},
-std::array<float,2>{0.860267401f, 0.955650866f},
-std::array<float,2>{0.341775179f, 0.114410773f},
-std::array<float,2>{0.209116817f, 0.678798795f},
-std::array<float,2>{0.749111533f, 0.41885075f},
-std::array<float,2>{0.614425659f, 0.895765841f},
-std::array<float,2>{0.0164420027f, 0.0293164197f},
-std::array<float,2>{0.40198487f, 0.710619986f},
-std::array<float,2>{0.941229045f, 0.452562392f},
-std::array<float,2>{0.751167595f, 0.590960383f},
-std::array<float,2>{0.281352818f, 0.353163153f},
-std::array<float,2>{0.17724663f, 0.754750669f},
-std::array<float,2>{0.647867382f, 0.129205197f},
-std::array<float,2>{0.699040234f, 0.651440084f},
-std::array<float,2>{0.241400436f, 0.40614f},
-std::array<float,2>{0.36276409f, 0.984931648f},
-std::array<float,2>{0.817251563f, 0.066977866f},
-std::array<float,2>{0.900350153f, 0.826506138f},
-std::array<float,2>{0.486534536f, 0.218277171f},
-std::array<float,2>{0.0835880786f, 0.544210017f},
-std::array<float,2>{0.545383811f, 0.283003062f},
-std::array<float,2>{0.556761265f, 0.847943604f},
-std::array<float,2>{0.0687450394f, 0.220167279f},
-std::array<float,2>{0.477517158f, 0.509356499f},
-std::array<float,2>{0.885938704f, 0.256633669f},
-std::array<float,2>{0.836781204f, 0.670438111f},
-std::array<float,2>{0.354368865f, 0.422276318f},
-std::array<float,2>{0.23031491f, 0.951493204f},
-std::array<float,2>{0.711336493f, 0.104296535f},
-std::array<float,2>{0.627958953f, 0.610742331f},
-std::array<float,2>{0.163848743f, 0.340886027f},
-std::array<float,2>{0.309218615f, 0.790703833f},
-std::array<float,2>{0.773462296f, 0.175316364f},
-std::array<float,2>{0.961721539f, 0.911220193f},
-std::array<float,2>{0.379597723f, 0.0388736688f},
-std::array<float,2>{0.00928195193f, 0.745970488f},
-std::array<float,2>{0.595123351f, 0.499990553f},
-std::array<float,2>{0.720544159f, 0.9690907f},
-std::array<float,2>{0.19915925f, 0.0879800841f},
-std::array<float,2>{0.326387107f, 0.637255967f},
-std::array<float,2>{0.858292818f, 0.389575601f},
-std::array<float,2>{0.917615831f, 0.559168994f},
-std::array<float,2>{0.462684005f, 0.29965955f},
-std::array<float,2>{0.0964498818f, 0.839364648f},
-std::array<float,2>{0.521821082f, 0.2002258f},
-std::array<float,2>{0.567793131f, 0.700063109f},
-std::array<float,2>{0.0465600863f, 0.466971517f},
-std::array<float,2>{0.422780156f, 0.876501799f},
-std::array<float,2>{0.982155323f, 0.00041885837f},
-std::array<float,2>{0.78588146f, 0.772374451f},
-std::array<float,2>{0.280809551f, 0.146996081f},
-std::array<float,2>{0.14572531f, 0.565254271f},
-std::array<float,2>{0.661241651f, 0.363847703f},
-std::array<float,2>{0.690735579f, 0.766394019f},
-std::array<float,2>{0.244706482f, 0.141603261f},
-std::array<float,2>{0.368238986f, 0.566978753f},
-std::array<float,2>{0.824611902f, 0.3607831f},
-std::array<float,2>{0.898252606f, 0.696195602f},
-std::array<float,2>{0.495118976f, 0.46107021f},
-std::array<float,2>{0.0918266252f, 0.879313886f},
-std::array<float,2>{0.537681162f, 0.00561601529f},
-std::array<float,2>{0.623295605f, 0.555521429f},
-std::array<float,2>{0.0307712443f, 0.304600805f},
-std::array<float,2>{0.392068982f, 0.840170324f},
-std::array<float,2>{0.949031889f, 0.195373774f},
-std::array<float,2>{0.764084697f, 0.975266099f},
-std::array<float,2>{0.294016302f, 0.0919518545f},
-std::array<float,2>{0.183045894f, 0.635690868f},
-std::array<float,2>{0.652013361f, 0.386518955f},
-std::array<float,2>{0.502970695f, 0.907342196f},
-std::array<float,2>{0.113284774f, 0.0340043753f},
-std::array<float,2>{0.446651906f, 0.74736917f},
-std::array<float,2>{0.936976194f, 0.492356658f},
-std::array<float,2>{0.871411383f, 0.616138458f},
-std::array<float,2>{0.32937634f, 0.339434683f},
-std::array<float,2>{0.215154216f, 0.796687365f},
-std::array<float,2>{0.735420108f, 0.179271802f},
-std::array<float,2>{0.67280364f, 0.666826606f},
-std::array<float,2>{0.138094917f, 0.426703125f},
-std::array<float,2>{0.262092829f, 0.948196769f},
-std::array<float,2>{0.812359452f, 0.108254857f},
-std::array<float,2>{0.985936999f, 0.846594274f},
-std::array<float,2>{0.417061418f, 0.2233174f},
-std::array<float,2>{0.0617265143f, 0.51444912f},
-std::array<float,2>{0.591178417f, 0.252516985f},
-std::array<float,2>{0.571088552f, 0.822709739f},
-std::array<float,2>{0.0315707177f, 0.212293535f},
-std::array<float,2>{0.435301423f, 0.5398224f},
-std::array<float,2>{0.975179017f, 0.286708474f},
-std::array<float,2>{0.789910018f, 0.654384613f},
-std::array<float,2>{0.272760272f, 0.399723679f},
-std::array<float,2>{0.150858477f, 0.989610791f},
-std::array<float,2>{0.671172798f, 0.0643055737f},
-std::array<float,2>{0.727358937f, 0.58955884f},
-std::array<float,2>{0.192874074f, 0.358204067f},
-std::array<float,2>{0.315986007f, 0.75246346f},
-std::array<float,2>{0.851024985f, 0.125191778f},
-std::array<float,2>{0.912879586f, 0.893868983f},
-std::array<float,2>{0.455518574f, 0.0267011914f},
-std::array<float,2>{0.107401825f, 0.705236197f},
-std::array<float,2>{0.530703902f, 0.446490198f},
-std::array<float,2>{0.64015317f, 0.960328579f},
-std::array<float,2>{0.170013368f, 0.11221192f},
-std::array<float,2>{0.29836005f, 0.675106943f},
-std::array<float,2>{0.766628742f, 0.41752398f},
-std::array<float,2>{0.95479399f, 0.517217398f},
-std::array<float,2>{0.38574028f, 0.274763495f},
-std::array<float,2>{0.00702081202f, 0.864731789f},
-std::array<float,2>{0.605382204f, 0.239129603f},
-std::array<float,2>{0.54980129f, 0.724164486f},
-std::array<float,2>{0.0770944357f, 0.47991097f},
-std::array<float,2>{0.471953869f, 0.927315772f},
-std::array<float,2>{0.875173032f, 0.0558773801f},
-std::array<float,2>{0.829928637f, 0.805993795f},
-std::array<float,2>{0.345922977f, 0.161994264f},
-std::array<float,2>{0.223421112f, 0.608100832f},
-std::array<float,2>{0.704516709f, 0.327476948f},
-std::array<float,2>{0.658763885f, 0.868329406f},
-std::array<float,2>{0.142316669f, 0.249760881f},
-std::array<float,2>{0.27690807f, 0.52399379f},
-std::array<float,2>{0.783670902f, 0.266990989f},
-std::array<float,2>{0.978829145f, 0.685207367f},
-std::array<float,2>{0.426447958f, 0.412146509f},
-std::array<float,2>{0.041822169f, 0.965445042f},
-std::array<float,2>{0.563354194f, 0.120295607f},
-std::array<float,2>{0.517810941f, 0.600628674f},
-std::array<float,2>{0.0990810096f, 0.319331646f},
-std::array<float,2>{0.46789813f, 0.79849261f},
-std::array<float,2>{0.919881582f, 0.166086674f},
-std::array<float,2>{0.853879631f, 0.934039354f},
-std::array<float,2>{0.324019521f, 0.0485300347f},
-std::array<float,2>{0.200842127f, 0.731567442f},
-std::array<float,2>{0.723969579f, 0.468853474f},
-std::array<float,2>{0.599640548f, 0.995821238f},
-std::array<float,2>{0.0151422732f, 0.0778666288f},
-std::array<float,2>{0.378527403f, 0.648298383f},
-std::array<float,2>{0.965135574f, 0.39459452f},
-std::array<float,2>{0.778152406f, 0.535497427f},
-std::array<float,2>{0.308270127f, 0.292942375f},
-std::array<float,2>{0.158255175f, 0.81431067f},
-std::array<float,2>{0.632540941f, 0.210238695f},
-std::array<float,2>{0.715348899f, 0.712703705f},
-std::array<float,2>{0.231123984f, 0.438865006f},
-std::array<float,2>{0.358736008f, 0.899418652f},
-std::array<float,2>{0.840813756f, 0.0205865912f},
-std::array<float,2>{0.889214635f, 0.760747612f},
-std::array<float,2>{0.480626702f, 0.139655605f},
-std::array<float,2>{0.0649071857f, 0.582090318f},
-std::array<float,2>{0.559791625f, 0.349551797f},
-std::array<float,2>{0.539954484f, 0.784536541f},
-std::array<float,2>{0.0782552287f, 0.18615444f},
-std::array<float,2>{0.491761893f, 0.618602633f},
-std::array<float,2>{0.905888438f, 0.329776078f},
-std::array<float,2>{0.814282775f, 0.737383127f},
-std::array<float,2>{0.364352673f, 0.49002555f},
-std::array<float,2>{0.23824665f, 0.918355346f},
-std::array<float,2>{0.703009188f, 0.044669468f},
-std::array<float,2>{0.640867889f, 0.501367748f},
-std::array<float,2>{0.17423965f, 0.262345344f},
-std::array<float,2>{0.288273871f, 0.854567766f},
-std::array<float,2>{0.755438924f, 0.231119722f},
-std::array<float,2>{0.942065418f, 0.938268423f},
-std::array<float,2>{0.403990716f, 0.0960930586f},
-std::array<float,2>{0.0219840612f, 0.659646034f},
-std::array<float,2>{0.611872911f, 0.436225861f},
-std::array<float,2>{0.744438112f, 0.888111413f},
-std::array<float,2>{0.205784544f, 0.0141095137f},
-std::array<float,2>{0.336041778f, 0.690892696f},
-std::array<float,2>{0.865844011f, 0.453139514f},
-std::array<float,2>{0.924264491f, 0.576410413f},
-std::array<float,2>{0.443679571f, 0.367906064f},
-std::array<float,2>{0.120854735f, 0.777803898f},
-std::array<float,2>{0.514787614f, 0.154886395f},
-std::array<float,2>{0.578206718f, 0.626892686f},
-std::array<float,2>{0.0513823479f, 0.375019848f},
-std::array<float,2>{0.40919295f, 0.979191244f},
-std::array<float,2>{0.996816635f, 0.0812639222f},
-std::array<float,2>{0.797887206f, 0.835256755f},
-std::array<float,2>{0.251182228f, 0.19242917f},
-std::array<float,2>{0.126183867f, 0.548176706f},
-std::array<float,2>{0.68460989f, 0.305573881f},
-std::array<float,2>{0.720831215f, 0.839317858f},
-std::array<float,2>{0.195950821f, 0.20114547f},
-std::array<float,2>{0.325134933f, 0.558628142f},
-std::array<float,2>{0.856923878f, 0.29910183f},
-std::array<float,2>{0.915842831f, 0.637170494f},
-std::array<float,2>{0.464317799f, 0.389007568f},
-std::array<float,2>{0.0952117145f, 0.969424367f},
-std::array<float,2>{0.519663334f, 0.0885512531f},
-std::array<float,2>{0.569891155f, 0.56451416f},
-std::array<float,2>{0.0430054218f, 0.36361295f},
-std::array<float,2>{0.424374193f, 0.771870077f},
-std::array<float,2>{0.983558953f, 0.146645948f},
-std::array<float,2>{0.78887558f, 0.876025438f},
-std::array<float,2>{0.278478682f, 0.00052946381f},
-std::array<float,2>{0.147392139f, 0.699264526f},
-std::array<float,2>{0.663546205f, 0.467484206f},
-std::array<float,2>{0.554732859f, 0.952112675f},
-std::array<float,2>{0.0681665987f, 0.103587642f},
-std::array<float,2>{0.480285823f, 0.670134962f},
-std::array<float,2>{0.883828998f, 0.422773153f},
-std::array<float,2>{0.838869154f, 0.509264231f},
-std::array<float,2>{0.352050304f, 0.255883217f},
-std::array<float,2>{0.227961794f, 0.848275959f},
-std::array<float,2>{0.71303153f, 0.220483616f},
-std::array<float,2>{0.626603663f, 0.745178759f},
-std::array<float,2>{0.161367685f, 0.499328136f},
-std::array<float,2>{0.311364621f, 0.911682069f},
-std::array<float,2>{0.775521815f, 0.038573768f},
-std::array<float,2>{0.963737547f, 0.790295422f},
-std::array<float,2>{0.381417453f, 0.174904004f},
-std::array<float,2>{0.0100821871f, 0.611211777f},
-std::array<float,2>{0.597515821f, 0.341476917f},
-std::array<float,2>{0.616311491f, 0.753967047f},
-std::array<float,2>{0.0188178923f, 0.129817531f},
-std::array<float,2>{0.40015325f, 0.591691434f},
-std::array<float,2>{0.939202249f, 0.353004664f},
-std::array<float,2>{0.753554285f, 0.710262775f},
-std::array<float,2>{0.284015268f, 0.453026801f},
-std::array<float,2>{0.178089246f, 0.896090746f},
-std::array<float,2>{0.646113575f, 0.0302405376f},
-std::array<float,2>{0.695786893f, 0.544907451f},
-std::array<float,2>{0.239020556f, 0.282386839f},
-std::array<float,2>{0.361154586f, 0.826927781f},
-std::array<float,2>{0.819156229f, 0.218027294f},
-std::array<float,2>{0.901960671f, 0.984758735f},
-std::array<float,2>{0.484808832f, 0.0668796599f},
-std::array<float,2>{0.0840325952f, 0.652231991f},
-std::array<float,2>{0.544508576f, 0.405418128f},
-std::array<float,2>{0.682768345f, 0.925178111f},
-std::array<float,2>{0.129922122f, 0.0623873547f},
-std::array<float,2>{0.257732153f, 0.719827235f},
-std::array<float,2>{0.801899135f, 0.480826527f},
-std::array<float,2>{0.992508054f, 0.603498101f},
-std::array<float,2>{0.410742551f, 0.32138446f},
-std::array<float,2>{0.0504806265f, 0.812079132f},
-std::array<float,2>{0.583439052f, 0.156753749f},
-std::array<float,2>{0.509326339f, 0.679368019f},
-std::array<float,2>{0.122043438f, 0.418026954f},
-std::array<float,2>{0.440347463f, 0.955210567f},
-std::array<float,2>{0.929118156f, 0.115162306f},
-std::array<float,2>{0.862531662f, 0.85985589f},
-std::array<float,2>{0.342076302f, 0.236256823f},
-std::array<float,2>{0.20754458f, 0.523241043f},
-std::array<float,2>{0.747490764f, 0.279901594f},
-std::array<float,2>{0.654363394f, 0.80321461f},
-std::array<float,2>{0.185566843f, 0.171642393f},
-std::array<float,2>{0.291255683f, 0.597252846f},
-std::array<float,2>{0.757863343f, 0.314085126f},
-std::array<float,2>{0.949582696f, 0.729510009f},
-std::array<float,2>{0.398011029f, 0.475518942f},
-std::array<float,2>{0.0252918713f, 0.933309257f},
-std::array<float,2>{0.619760215f, 0.0546358116f},
-std::array<float,2>{0.534869194f, 0.528125823f},
-std::array<float,2>{0.0881209746f, 0.272964418f},
-std::array<float,2>{0.497613013f, 0.873726726f},
-std::array<float,2>{0.893548787f, 0.245057747f},
-std::array<float,2>{0.821231723f, 0.964247346f},
-std::array<float,2>{0.372050256f, 0.124580011f},
-std::array<float,2>{0.246637464f, 0.679925978f},
-std::array<float,2>{0.694538653f, 0.406874061f},
-std::array<float,2>{0.587753594f, 0.905136108f},
-std::array<float,2>{0.056060344f, 0.0163781215f},
-std::array<float,2>{0.421255916f, 0.717203498f},
-std::array<float,2>{0.989005983f, 0.441592157f},
-std::array<float,2>{0.8063519f, 0.580611944f},
-std::array<float,2>{0.261527956f, 0.344870895f},
-std::array<float,2>{0.135760665f, 0.763714731f},
-std::array<float,2>{0.679580033f, 0.133999497f},
-std::array<float,2>{0.741777897f, 0.642736375f},
-std::array<float,2>{0.211967766f, 0.394522935f},
-std::array<float,2>{0.332805425f, 0.998573661f},
-std::array<float,2>{0.86762619f, 0.0721401349f},
-std::array<float,2>{0.931075931f, 0.820131302f},
-std::array<float,2>{0.45263195f, 0.206304207f},
-std::array<float,2>{0.110543005f, 0.532720625f},
-std::array<float,2>{0.506330132f, 0.296233803f},
-std::array<float,2>{0.523514628f, 0.858726382f},
-std::array<float,2>{0.10538391f, 0.228700802f},
-std::array<float,2>{0.459982932f, 0.505118668f},
-std::array<float,2>{0.908283114f, 0.261108071f},
-std::array<float,2>{0.844555736f, 0.662995756f},
-std::array<float,2>{0.320115745f, 0.432444632f},
-std::array<float,2>{0.188046128f, 0.942540824f},
-std::array<float,2>{0.733346224f, 0.100088567f},
-std::array<float,2>{0.664156795f, 0.624487102f},
-std::array<float,2>{0.154549703f, 0.335635424f},
-std::array<float,2>{0.266036004f, 0.78572911f},
-std::array<float,2>{0.795942903f, 0.181505188f},
-std::array<float,2>{0.969648421f, 0.91599071f},
-std::array<float,2>{0.431444138f, 0.0410255156f},
-std::array<float,2>{0.0372036695f, 0.74059087f},
-std::array<float,2>{0.574258149f, 0.484845191f},
-std::array<float,2>{0.710394859f, 0.980904877f},
-std::array<float,2>{0.221488044f, 0.0833586976f},
-std::array<float,2>{0.348033667f, 0.630485535f},
-std::array<float,2>{0.832313836f, 0.380502194f},
-std::array<float,2>{0.881949008f, 0.554355562f},
-std::array<float,2>{0.474597633f, 0.310050428f},
-std::array<float,2>{0.0714895055f, 0.831916332f},
-std::array<float,2>{0.552181721f, 0.188873723f},
-std::array<float,2>{0.607606053f, 0.692871392f},
-std::array<float,2>{0.000765549543f, 0.457033664f},
-std::array<float,2>{0.38765046f, 0.88544488f},
-std::array<float,2>{0.958936334f, 0.00986782555f},
-std::array<float,2>{0.772626758f, 0.776641369f},
-std::array<float,2>{0.302330166f, 0.148472086f},
-std::array<float,2>{0.166487098f, 0.573681891f},
-std::array<float,2>{0.635533333f, 0.374894142f},
-std::array<float,2>{0.737478793f, 0.793514311f},
-std::array<float,2>{0.218478933f, 0.176220983f},
-std::array<float,2>{0.331278712f, 0.614426494f},
-std::array<float,2>{0.873077273f, 0.336414754f},
-std::array<float,2>{0.933811188f, 0.748630106f},
-std::array<float,2>{0.448867977f, 0.494513839f},
-std::array<float,2>{0.116694979f, 0.909000158f},
-std::array<float,2>{0.501593053f, 0.0330561027f},
-std::array<float,2>{0.592697978f, 0.5125103f},
-std::array<float,2>{0.0604513027f, 0.250019491f},
-std::array<float,2>{0.414506257f, 0.843761146f},
-std::array<float,2>{0.986782551f, 0.225249782f},
-std::array<float,2>{0.81012255f, 0.945934236f},
-std::array<float,2>{0.264294058f, 0.105686545f},
-std::array<float,2>{0.139040753f, 0.665377438f},
-std::array<float,2>{0.674502611f, 0.428607017f},
-std::array<float,2>{0.536481202f, 0.881757736f},
-std::array<float,2>{0.0909752175f, 0.0066669276f},
-std::array<float,2>{0.492544889f, 0.698364437f},
-std::array<float,2>{0.89582783f, 0.464343786f},
-std::array<float,2>{0.827686012f, 0.570301414f},
-std::array<float,2>{0.369930208f, 0.362731189f},
-std::array<float,2>{0.242501989f, 0.7688815f},
-std::array<float,2>{0.687866032f, 0.143772542f},
-std::array<float,2>{0.648460388f, 0.634445071f},
-std::array<float,2>{0.180554733f, 0.382939547f},
-std::array<float,2>{0.295595914f, 0.974519908f},
-std::array<float,2>{0.763328433f, 0.0910160691f},
-std::array<float,2>{0.945586145f, 0.841958821f},
-std::array<float,2>{0.393397808f, 0.198909625f},
-std::array<float,2>{0.0281591285f, 0.558572531f},
-std::array<float,2>{0.622802913f, 0.301909059f},
-std::array<float,2>{0.60320121f, 0.865827978f},
-std::array<float,2>{0.00548278121f, 0.241353825f},
-std::array<float,2>{0.384102017f, 0.518536627f},
-std::array<float,2>{0.95535326f, 0.276496381f},
-std::array<float,2>{0.768269956f, 0.672199607f},
-std::array<float,2>{0.300316751f, 0.414632916f},
-std::array<float,2>{0.169214636f, 0.958153009f},
-std::array<float,2>{0.637148023f, 0.110005237f},
-std::array<float,2>{0.705139101f, 0.605845988f},
-std::array<float,2>{0.224902585f, 0.325807542f},
-std::array<float,2>{0.344500601f, 0.807632267f},
-std::array<float,2>{0.830150843f, 0.163778275f},
-std::array<float,2>{0.878591776f, 0.928386033f},
-std::array<float,2>{0.468794078f, 0.0570551902f},
-std::array<float,2>{0.0751482472f, 0.724676013f},
-std::array<float,2>{0.547333539f, 0.477190346f},
-std::array<float,2>{0.669033647f, 0.990668356f},
-std::array<float,2>{0.149381593f, 0.0661915988f},
-std::array<float,2>{0.270865649f, 0.653978229f},
-std::array<float,2>{0.792386353f, 0.401145548f},
-std::array<float,2>{0.973754227f, 0.541470528f},
-std::array<float,2>{0.437404841f, 0.287340969f},
-std::array<float,2>{0.0344817713f, 0.821907103f},
-std::array<float,2>{0.573168576f, 0.213905931f},
-std::array<float,2>{0.528802693f, 0.704403162f},
-std::array<float,2>{0.107685082f, 0.449190229f},
-std::array<float,2>{0.454613626f, 0.891805112f},
-std::array<float,2>{0.910197675f, 0.0245887563f},
-std::array<float,2>{0.847759664f, 0.750376463f},
-std::array<float,2>{0.313528717f, 0.128034249f},
-std::array<float,2>{0.193824679f, 0.587765396f},
-std::array<float,2>{0.728817046f, 0.355553657f},
-std::array<float,2>{0.630824804f, 0.814545393f},
-std::array<float,2>{0.157567933f, 0.20833993f},
-std::array<float,2>{0.305573404f, 0.537596941f},
-std::array<float,2>{0.780981004f, 0.289625585f},
-std::array<float,2>{0.967186511f, 0.646320105f},
-std::array<float,2>{0.375147939f, 0.398411542f},
-std::array<float,2>{0.0127915433f, 0.993714213f},
-std::array<float,2>{0.597914219f, 0.0742658973f},
-std::array<float,2>{0.561181009f, 0.585622609f},
-std::array<float,2>{0.0639558136f, 0.349614203f},
-std::array<float,2>{0.483244836f, 0.75917238f},
-std::array<float,2>{0.887739897f, 0.137034088f},
-std::array<float,2>{0.843597531f, 0.902265847f},
-std::array<float,2>{0.357196242f, 0.023240706f},
-std::array<float,2>{0.233937413f, 0.713966131f},
-std::array<float,2>{0.717458963f, 0.44116199f},
-std::array<float,2>{0.566390693f, 0.967950642f},
-std::array<float,2>{0.0398144349f, 0.119050853f},
-std::array<float,2>{0.429104269f, 0.686428428f},
-std::array<float,2>{0.978230238f, 0.411859483f},
-std::array<float,2>{0.78221184f, 0.52628088f},
-std::array<float,2>{0.274578601f, 0.268002659f},
-std::array<float,2>{0.142673731f, 0.870456338f},
-std::array<float,2>{0.658002913f, 0.247784391f},
-std::array<float,2>{0.724757016f, 0.734182954f},
-std::array<float,2>{0.201241374f, 0.47247687f},
-std::array<float,2>{0.320746303f, 0.935994983f},
-std::array<float,2>{0.852725863f, 0.0494583659f},
-std::array<float,2>{0.92093873f, 0.800675571f},
-std::array<float,2>{0.466209799f, 0.165960237f},
-std::array<float,2>{0.101025619f, 0.597796023f},
-std::array<float,2>{0.516898811f, 0.316557527f},
-std::array<float,2>{0.512126803f, 0.780506194f},
-std::array<float,2>{0.117338963f, 0.154186606f},
-std::array<float,2>{0.441942245f, 0.575043619f},
-std::array<float,2>{0.92191112f, 0.36961627f},
-std::array<float,2>{0.863917708f, 0.689279556f},
-std::array<float,2>{0.33889541f, 0.455396414f},
-std::array<float,2>{0.204129428f, 0.890348613f},
-std::array<float,2>{0.743660092f, 0.0117680915f},
-std::array<float,2>{0.686016381f, 0.549181879f},
-std::array<float,2>{0.127068564f, 0.308007121f},
-std::array<float,2>{0.252336293f, 0.832093775f},
-std::array<float,2>{0.800646305f, 0.195220724f},
-std::array<float,2>{0.9984833f, 0.978206456f},
-std::array<float,2>{0.406344295f, 0.0793457031f},
-std::array<float,2>{0.0529115163f, 0.628681123f},
-std::array<float,2>{0.581127644f, 0.377647936f},
-std::array<float,2>{0.699674666f, 0.920829833f},
-std::array<float,2>{0.235407025f, 0.0460526347f},
-std::array<float,2>{0.365657657f, 0.734990954f},
-std::array<float,2>{0.816261828f, 0.491445333f},
-std::array<float,2>{0.902368784f, 0.619377196f},
-std::array<float,2>{0.489354104f, 0.330516249f},
-std::array<float,2>{0.0808097422f, 0.781915486f},
-std::array<float,2>{0.542571843f, 0.18541798f},
-std::array<float,2>{0.610941112f, 0.657997847f},
-std::array<float,2>{0.0209492873f, 0.433711052f},
-std::array<float,2>{0.404622942f, 0.941118062f},
-std::array<float,2>{0.94446981f, 0.0946362242f},
-std::array<float,2>{0.756664515f, 0.851856768f},
-std::array<float,2>{0.286162555f, 0.233995795f},
-std::array<float,2>{0.173787132f, 0.503779948f},
-std::array<float,2>{0.644429564f, 0.263949126f},
-std::array<float,2>{0.711857378f, 0.850868642f},
-std::array<float,2>{0.229527622f, 0.221387193f},
-std::array<float,2>{0.353587806f, 0.510554373f},
-std::array<float,2>{0.836332858f, 0.2545802f},
-std::array<float,2>{0.886715353f, 0.669855595f},
-std::array<float,2>{0.476762146f, 0.42497918f},
-std::array<float,2>{0.069064863f, 0.949858427f},
-std::array<float,2>{0.557231545f, 0.102437317f},
-std::array<float,2>{0.595377803f, 0.612261355f},
-std::array<float,2>{0.00910000131f, 0.341804087f},
-std::array<float,2>{0.379349828f, 0.791703999f},
-std::array<float,2>{0.961141646f, 0.172117114f},
-std::array<float,2>{0.774073839f, 0.912149072f},
-std::array<float,2>{0.308647692f, 0.0357969515f},
-std::array<float,2>{0.163151518f, 0.743829072f},
-std::array<float,2>{0.628853917f, 0.497223198f},
-std::array<float,2>{0.52218008f, 0.971788466f},
-std::array<float,2>{0.0960009247f, 0.0861639529f},
-std::array<float,2>{0.461988688f, 0.639583647f},
-std::array<float,2>{0.917235494f, 0.386977464f},
-std::array<float,2>{0.857873559f, 0.560780048f},
-std::array<float,2>{0.326948553f, 0.297258675f},
-std::array<float,2>{0.198279515f, 0.83720392f},
-std::array<float,2>{0.719751239f, 0.202837512f},
-std::array<float,2>{0.66169697f, 0.701729596f},
-std::array<float,2>{0.1464798f, 0.465444207f},
-std::array<float,2>{0.280688167f, 0.877322137f},
-std::array<float,2>{0.785265744f, 0.00318274018f},
-std::array<float,2>{0.981445909f, 0.770101666f},
-std::array<float,2>{0.422153443f, 0.144882664f},
-std::array<float,2>{0.0462585017f, 0.563664198f},
-std::array<float,2>{0.567890048f, 0.366212368f},
-std::array<float,2>{0.584947109f, 0.809295297f},
-std::array<float,2>{0.0476293936f, 0.159272909f},
-std::array<float,2>{0.412426502f, 0.604047656f},
-std::array<float,2>{0.994872987f, 0.323657125f},
-std::array<float,2>{0.803576767f, 0.722034216f},
-std::array<float,2>{0.254122704f, 0.483233899f},
-std::array<float,2>{0.131920025f, 0.923680842f},
-std::array<float,2>{0.680566728f, 0.0597811975f},
-std::array<float,2>{0.749905407f, 0.521169186f},
-std::array<float,2>{0.20971635f, 0.277767479f},
-std::array<float,2>{0.341212213f, 0.861379147f},
-std::array<float,2>{0.859620333f, 0.237895116f},
-std::array<float,2>{0.926517665f, 0.954601109f},
-std::array<float,2>{0.439166456f, 0.115882151f},
-std::array<float,2>{0.123440705f, 0.676391602f},
-std::array<float,2>{0.510830879f, 0.421590388f},
-std::array<float,2>{0.648197472f, 0.897180617f},
-std::array<float,2>{0.177003846f, 0.0273930673f},
-std::array<float,2>{0.281809837f, 0.708337843f},
-std::array<float,2>{0.751865149f, 0.450619638f},
-std::array<float,2>{0.940596461f, 0.592932224f},
-std::array<float,2>{0.401425481f, 0.354590535f},
-std::array<float,2>{0.0159477443f, 0.757143676f},
-std::array<float,2>{0.615184665f, 0.131091937f},
-std::array<float,2>{0.545789421f, 0.64867115f},
-std::array<float,2>{0.0831019282f, 0.402867287f},
-std::array<float,2>{0.486948848f, 0.987842441f},
-std::array<float,2>{0.899876535f, 0.068830952f},
-std::array<float,2>{0.816732466f, 0.824475884f},
-std::array<float,2>{0.362863272f, 0.2153465f},
-std::array<float,2>{0.241946712f, 0.545327961f},
-std::array<float,2>{0.698638976f, 0.284142315f},
-std::array<float,2>{0.677679777f, 0.761907637f},
-std::array<float,2>{0.133490354f, 0.135591656f},
-std::array<float,2>{0.259761214f, 0.579507113f},
-std::array<float,2>{0.808148801f, 0.347319305f},
-std::array<float,2>{0.991067529f, 0.716325819f},
-std::array<float,2>{0.418145895f, 0.444238067f},
-std::array<float,2>{0.0576901995f, 0.904164612f},
-std::array<float,2>{0.589276969f, 0.0188054275f},
-std::array<float,2>{0.504505157f, 0.53460151f},
-std::array<float,2>{0.11150565f, 0.293464154f},
-std::array<float,2>{0.45084241f, 0.817684948f},
-std::array<float,2>{0.933029532f, 0.204697296f},
-std::array<float,2>{0.870265365f, 0.99759692f},
-std::array<float,2>{0.334775358f, 0.0730708614f},
-std::array<float,2>{0.213956937f, 0.642166972f},
-std::array<float,2>{0.739111245f, 0.391052037f},
-std::array<float,2>{0.618846595f, 0.930789173f},
-std::array<float,2>{0.0265657958f, 0.0526347347f},
-std::array<float,2>{0.395030707f, 0.728389323f},
-std::array<float,2>{0.952821136f, 0.4744744f},
-std::array<float,2>{0.761702597f, 0.595435321f},
-std::array<float,2>{0.289285213f, 0.315906882f},
-std::array<float,2>{0.183737725f, 0.801093221f},
-std::array<float,2>{0.652807355f, 0.16986008f},
-std::array<float,2>{0.69152385f, 0.683229804f},
-std::array<float,2>{0.248113066f, 0.409736753f},
-std::array<float,2>{0.37305516f, 0.961509407f},
-std::array<float,2>{0.822739899f, 0.121930957f},
-std::array<float,2>{0.89251858f, 0.87291503f},
-std::array<float,2>{0.499712259f, 0.242612034f},
-std::array<float,2>{0.0870548636f, 0.530489802f},
-std::array<float,2>{0.531931221f, 0.269570827f},
-std::array<float,2>{0.553676367f, 0.829977989f},
-std::array<float,2>{0.0723317564f, 0.190774664f},
-std::array<float,2>{0.476072311f, 0.550985575f},
-std::array<float,2>{0.880629063f, 0.312208056f},
-std::array<float,2>{0.835045338f, 0.631732464f},
-std::array<float,2>{0.351299882f, 0.382635742f},
-std::array<float,2>{0.219905555f, 0.98316735f},
-std::array<float,2>{0.707093537f, 0.0852815956f},
-std::array<float,2>{0.633887231f, 0.570526898f},
-std::array<float,2>{0.16477792f, 0.372021586f},
-std::array<float,2>{0.304287672f, 0.775149703f},
-std::array<float,2>{0.770873368f, 0.150453061f},
-std::array<float,2>{0.959383667f, 0.883776665f},
-std::array<float,2>{0.390487075f, 0.00945348665f},
-std::array<float,2>{0.00280526048f, 0.6934008f},
-std::array<float,2>{0.606762826f, 0.46058926f},
-std::array<float,2>{0.730772972f, 0.944124341f},
-std::array<float,2>{0.190504625f, 0.099149771f},
-std::array<float,2>{0.317092478f, 0.66050458f},
-std::array<float,2>{0.847126782f, 0.430684388f},
-std::array<float,2>{0.907958031f, 0.507062316f},
-std::array<float,2>{0.458300203f, 0.258945435f},
-std::array<float,2>{0.102046512f, 0.856606781f},
-std::array<float,2>{0.525960207f, 0.228378594f},
-std::array<float,2>{0.576761544f, 0.738705695f},
-std::array<float,2>{0.0364020616f, 0.486526519f},
-std::array<float,2>{0.432545066f, 0.916572273f},
-std::array<float,2>{0.972004235f, 0.0409342907f},
-std::array<float,2>{0.79322356f, 0.787528217f},
-std::array<float,2>{0.268642664f, 0.182723194f},
-std::array<float,2>{0.153480902f, 0.621754766f},
-std::array<float,2>{0.66658771f, 0.333131313f},
-std::array<float,2>{0.703686237f, 0.807135224f},
-std::array<float,2>{0.224177584f, 0.162157655f},
-std::array<float,2>{0.347342491f, 0.607072532f},
-std::array<float,2>{0.829028487f, 0.324581057f},
-std::array<float,2>{0.876529694f, 0.725653231f},
-std::array<float,2>{0.471148133f, 0.477974504f},
-std::array<float,2>{0.0771807954f, 0.929649472f},
-std::array<float,2>{0.549996376f, 0.0579853244f},
-std::array<float,2>{0.603848159f, 0.51901108f},
-std::array<float,2>{0.00664244639f, 0.275541008f},
-std::array<float,2>{0.386018902f, 0.866458118f},
-std::array<float,2>{0.953359962f, 0.240238026f},
-std::array<float,2>{0.766084373f, 0.957186401f},
-std::array<float,2>{0.297490776f, 0.110560253f},
-std::array<float,2>{0.171380922f, 0.673277318f},
-std::array<float,2>{0.638943791f, 0.415670335f},
-std::array<float,2>{0.529997528f, 0.891088605f},
-std::array<float,2>{0.10632018f, 0.0238110684f},
-std::array<float,2>{0.456147343f, 0.703479171f},
-std::array<float,2>{0.913093925f, 0.447743118f},
-std::array<float,2>{0.850343466f, 0.586688995f},
-std::array<float,2>{0.315167814f, 0.357027948f},
-std::array<float,2>{0.192300394f, 0.751633883f},
-std::array<float,2>{0.728477895f, 0.12782006f},
-std::array<float,2>{0.670573652f, 0.652792215f},
-std::array<float,2>{0.151477724f, 0.402217954f},
-std::array<float,2>{0.271934837f, 0.991352856f},
-std::array<float,2>{0.790329218f, 0.0647806004f},
-std::array<float,2>{0.976427734f, 0.820920885f},
-std::array<float,2>{0.433618873f, 0.213263154f},
-std::array<float,2>{0.0325166099f, 0.54232347f},
-std::array<float,2>{0.571470797f, 0.288372487f},
-std::array<float,2>{0.590263069f, 0.845373929f},
-std::array<float,2>{0.0607836246f, 0.225625172f},
-std::array<float,2>{0.416520119f, 0.513028562f},
-std::array<float,2>{0.985015213f, 0.251223296f},
-std::array<float,2>{0.810689628f, 0.664959371f},
-std::array<float,2>{0.262953043f, 0.428761512f},
-std::array<float,2>{0.137449443f, 0.94697237f},
-std::array<float,2>{0.673523724f, 0.106773391f},
-std::array<float,2>{0.734874725f, 0.61343199f},
-std::array<float,2>{0.216112122f, 0.337524951f},
-std::array<float,2>{0.328903556f, 0.79405725f},
-std::array<float,2>{0.872706175f, 0.177430123f},
-std::array<float,2>{0.935773432f, 0.909613609f},
-std::array<float,2>{0.44564721f, 0.0317652076f},
-std::array<float,2>{0.11474248f, 0.749381423f},
-std::array<float,2>{0.502131522f, 0.495704114f},
-std::array<float,2>{0.650669694f, 0.973215282f},
-std::array<float,2>{0.181903601f, 0.0899212509f},
-std::array<float,2>{0.293783218f, 0.633057892f},
-std::array<float,2>{0.765120924f, 0.384661138f},
-std::array<float,2>{0.947302461f, 0.557117522f},
-std::array<float,2>{0.391309202f, 0.300903916f},
-std::array<float,2>{0.0296546817f, 0.84350884f},
-std::array<float,2>{0.624099612f, 0.197566673f},
-std::array<float,2>{0.538534284f, 0.697977424f},
-std::array<float,2>{0.0933459103f, 0.463606149f},
-std::array<float,2>{0.494591087f, 0.882296979f},
-std::array<float,2>{0.896894634f, 0.00711318385f},
-std::array<float,2>{0.825948f, 0.768360019f},
-std::array<float,2>{0.36772576f, 0.142892972f},
-std::array<float,2>{0.2454312f, 0.569279075f},
-std::array<float,2>{0.690339267f, 0.362052739f},
-std::array<float,2>{0.684130073f, 0.833842814f},
-std::array<float,2>{0.125050649f, 0.194335744f},
-std::array<float,2>{0.250460893f, 0.550246596f},
-std::array<float,2>{0.797451198f, 0.307516754f},
-std::array<float,2>{0.997338772f, 0.627266228f},
-std::array<float,2>{0.408418983f, 0.378269315f},
-std::array<float,2>{0.0519682057f, 0.977325261f},
-std::array<float,2>{0.579894722f, 0.0781549141f},
-std::array<float,2>{0.513936758f, 0.575964868f},
-std::array<float,2>{0.11938709f, 0.370212883f},
-std::array<float,2>{0.444665939f, 0.779498041f},
-std::array<float,2>{0.925017595f, 0.152952686f},
-std::array<float,2>{0.866489589f, 0.889473975f},
-std::array<float,2>{0.337240815f, 0.0133200027f},
-std::array<float,2>{0.206376165f, 0.6880759f},
-std::array<float,2>{0.74520129f, 0.456290871f},
-std::array<float,2>{0.612324834f, 0.939719498f},
-std::array<float,2>{0.0225628819f, 0.095691219f},
-std::array<float,2>{0.402938187f, 0.657137334f},
-std::array<float,2>{0.942763329f, 0.43470782f},
-std::array<float,2>{0.754804552f, 0.502883255f},
-std::array<float,2>{0.287161529f, 0.265606254f},
-std::array<float,2>{0.174995452f, 0.853036582f},
-std::array<float,2>{0.641724706f, 0.232725695f},
-std::array<float,2>{0.702100337f, 0.73578608f},
-std::array<float,2>{0.23688592f, 0.49096626f},
-std::array<float,2>{0.363344967f, 0.921642005f},
-std::array<float,2>{0.813143373f, 0.0450274087f},
-std::array<float,2>{0.904854357f, 0.782890797f},
-std::array<float,2>{0.490665406f, 0.184232295f},
-std::array<float,2>{0.0800288916f, 0.620918572f},
-std::array<float,2>{0.540789902f, 0.331715167f},
-std::array<float,2>{0.55870378f, 0.758676469f},
-std::array<float,2>{0.0658605471f, 0.137829468f},
-std::array<float,2>{0.48211962f, 0.58453238f},
-std::array<float,2>{0.890579939f, 0.351300269f},
-std::array<float,2>{0.841775894f, 0.713725746f},
-std::array<float,2>{0.358038932f, 0.439991564f},
-std::array<float,2>{0.231602699f, 0.900770485f},
-std::array<float,2>{0.715857744f, 0.0215378944f},
-std::array<float,2>{0.631772935f, 0.538677871f},
-std::array<float,2>{0.160156131f, 0.290318698f},
-std::array<float,2>{0.307245851f, 0.815871477f},
-std::array<float,2>{0.779026568f, 0.207558677f},
-std::array<float,2>{0.966038942f, 0.992341161f},
-std::array<float,2>{0.377783507f, 0.0755145773f},
-std::array<float,2>{0.0143178795f, 0.644894302f},
-std::array<float,2>{0.60116899f, 0.397341162f},
-std::array<float,2>{0.722869098f, 0.937410176f},
-std::array<float,2>{0.19946903f, 0.0498660207f},
-std::array<float,2>{0.322493762f, 0.732424021f},
-std::array<float,2>{0.85519433f, 0.470724255f},
-std::array<float,2>{0.918097734f, 0.598924875f},
-std::array<float,2>{0.467620939f, 0.318089813f},
-std::array<float,2>{0.0981753394f, 0.799281478f},
-std::array<float,2>{0.518609464f, 0.164953709f},
-std::array<float,2>{0.564003706f, 0.686950266f},
-std::array<float,2>{0.0429460369f, 0.410839945f},
-std::array<float,2>{0.427310139f, 0.967194676f},
-std::array<float,2>{0.979753852f, 0.117789805f},
-std::array<float,2>{0.784501374f, 0.86942929f},
-std::array<float,2>{0.275395483f, 0.246591881f},
-std::array<float,2>{0.1411127f, 0.527155817f},
-std::array<float,2>{0.659981728f, 0.26864624f},
-std::array<float,2>{0.746104121f, 0.863275409f},
-std::array<float,2>{0.208748981f, 0.23713024f},
-std::array<float,2>{0.342915982f, 0.520454228f},
-std::array<float,2>{0.861677527f, 0.278424859f},
-std::array<float,2>{0.928340673f, 0.677113175f},
-std::array<float,2>{0.441146642f, 0.420855701f},
-std::array<float,2>{0.122403398f, 0.953341961f},
-std::array<float,2>{0.507839859f, 0.116636269f},
-std::array<float,2>{0.582997382f, 0.605217457f},
-std::array<float,2>{0.0488937534f, 0.323220164f},
-std::array<float,2>{0.411149025f, 0.810156941f},
-std::array<float,2>{0.993762672f, 0.158593163f},
-std::array<float,2>{0.801662028f, 0.9224298f},
-std::array<float,2>{0.255878627f, 0.0591322891f},
-std::array<float,2>{0.129821301f, 0.720743537f},
-std::array<float,2>{0.681963801f, 0.483829081f},
-std::array<float,2>{0.543418169f, 0.986711264f},
-std::array<float,2>{0.085335806f, 0.0701660439f},
-std::array<float,2>{0.485946089f, 0.649507761f},
-std::array<float,2>{0.901198983f, 0.403838038f},
-std::array<float,2>{0.819430351f, 0.546388328f},
-std::array<float,2>{0.359741867f, 0.284340858f},
-std::array<float,2>{0.239278138f, 0.825327456f},
-std::array<float,2>{0.697031736f, 0.216380388f},
-std::array<float,2>{0.645030618f, 0.707901597f},
-std::array<float,2>{0.178726956f, 0.449729234f},
-std::array<float,2>{0.284688026f, 0.897771358f},
-std::array<float,2>{0.752011597f, 0.0286655687f},
-std::array<float,2>{0.938196301f, 0.756600022f},
-std::array<float,2>{0.398686141f, 0.13242133f},
-std::array<float,2>{0.0176971536f, 0.592559218f},
-std::array<float,2>{0.615559101f, 0.353815109f},
-std::array<float,2>{0.596149147f, 0.792307258f},
-std::array<float,2>{0.0112465415f, 0.173296601f},
-std::array<float,2>{0.3824431f, 0.612578511f},
-std::array<float,2>{0.964120448f, 0.343273848f},
-std::array<float,2>{0.776465535f, 0.743062496f},
-std::array<float,2>{0.312330127f, 0.496231914f},
-std::array<float,2>{0.161014035f, 0.91340369f},
-std::array<float,2>{0.625209272f, 0.0370818935f},
-std::array<float,2>{0.714023054f, 0.510862589f},
-std::array<float,2>{0.22717765f, 0.255485982f},
-std::array<float,2>{0.353218615f, 0.849775791f},
-std::array<float,2>{0.838798225f, 0.222015202f},
-std::array<float,2>{0.883220553f, 0.950634956f},
-std::array<float,2>{0.47851634f, 0.102837376f},
-std::array<float,2>{0.0668592602f, 0.668158948f},
-std::array<float,2>{0.555814743f, 0.424401492f},
-std::array<float,2>{0.66298759f, 0.878136218f},
-std::array<float,2>{0.147578076f, 0.00268015382f},
-std::array<float,2>{0.278264254f, 0.702770054f},
-std::array<float,2>{0.787939072f, 0.466742665f},
-std::array<float,2>{0.982865751f, 0.562722325f},
-std::array<float,2>{0.424903154f, 0.365577698f},
-std::array<float,2>{0.0444669425f, 0.770518482f},
-std::array<float,2>{0.569324553f, 0.14610894f},
-std::array<float,2>{0.520614207f, 0.640135527f},
-std::array<float,2>{0.0941455513f, 0.387738764f},
-std::array<float,2>{0.463003695f, 0.970850408f},
-std::array<float,2>{0.914659381f, 0.0870062262f},
-std::array<float,2>{0.855920315f, 0.836600661f},
-std::array<float,2>{0.326097161f, 0.20198679f},
-std::array<float,2>{0.196907043f, 0.561526835f},
-std::array<float,2>{0.722256958f, 0.298198104f},
-std::array<float,2>{0.636049986f, 0.774048567f},
-std::array<float,2>{0.167473525f, 0.151465133f},
-std::array<float,2>{0.30165109f, 0.571718156f},
-std::array<float,2>{0.771807671f, 0.37266165f},
-std::array<float,2>{0.957352519f, 0.695093334f},
-std::array<float,2>{0.388257146f, 0.45937407f},
-std::array<float,2>{0.00139921717f, 0.884496927f},
-std::array<float,2>{0.608465612f, 0.00812875573f},
-std::array<float,2>{0.551098704f, 0.551765144f},
-std::array<float,2>{0.0710362643f, 0.310964942f},
-std::array<float,2>{0.47338146f, 0.828514338f},
-std::array<float,2>{0.881158471f, 0.189827293f},
-std::array<float,2>{0.833352029f, 0.984208047f},
-std::array<float,2>{0.349395066f, 0.0839883462f},
-std::array<float,2>{0.222247601f, 0.632034302f},
-std::array<float,2>{0.70993638f, 0.381213367f},
-std::array<float,2>{0.575535834f, 0.917802334f},
-std::array<float,2>{0.0385235511f, 0.0391868055f},
-std::array<float,2>{0.430342823f, 0.739901364f},
-std::array<float,2>{0.970277727f, 0.487772763f},
-std::array<float,2>{0.795150101f, 0.622417927f},
-std::array<float,2>{0.267167836f, 0.332888365f},
-std::array<float,2>{0.155700162f, 0.788815856f},
-std::array<float,2>{0.66555357f, 0.181916997f},
-std::array<float,2>{0.733584642f, 0.661606371f},
-std::array<float,2>{0.188702613f, 0.430476665f},
-std::array<float,2>{0.318531603f, 0.944728434f},
-std::array<float,2>{0.845142066f, 0.0985902995f},
-std::array<float,2>{0.909237087f, 0.855512738f},
-std::array<float,2>{0.459048212f, 0.227297157f},
-std::array<float,2>{0.103619382f, 0.506070256f},
-std::array<float,2>{0.525267243f, 0.257908881f},
-std::array<float,2>{0.507069111f, 0.81703639f},
-std::array<float,2>{0.109728239f, 0.203459114f},
-std::array<float,2>{0.452126354f, 0.533478081f},
-std::array<float,2>{0.930124938f, 0.294790953f},
-std::array<float,2>{0.868173063f, 0.641151845f},
-std::array<float,2>{0.333812445f, 0.391675234f},
-std::array<float,2>{0.211519763f, 0.99640739f},
-std::array<float,2>{0.740805447f, 0.0732440352f},
-std::array<float,2>{0.677991807f, 0.578783453f},
-std::array<float,2>{0.134885639f, 0.346061498f},
-std::array<float,2>{0.260567039f, 0.763270497f},
-std::array<float,2>{0.805559933f, 0.136429355f},
-std::array<float,2>{0.989340365f, 0.903126538f},
-std::array<float,2>{0.420709848f, 0.0182261094f},
-std::array<float,2>{0.0553355142f, 0.714905798f},
-std::array<float,2>{0.586304486f, 0.444828421f},
-std::array<float,2>{0.693979919f, 0.961997211f},
-std::array<float,2>{0.247787043f, 0.122318618f},
-std::array<float,2>{0.373027444f, 0.682299197f},
-std::array<float,2>{0.822177291f, 0.409035236f},
-std::array<float,2>{0.894135416f, 0.529678404f},
-std::array<float,2>{0.496895492f, 0.270576179f},
-std::array<float,2>{0.0890536383f, 0.871231675f},
-std::array<float,2>{0.533426762f, 0.243661851f},
-std::array<float,2>{0.621022522f, 0.727432907f},
-std::array<float,2>{0.0235168934f, 0.47303766f},
-std::array<float,2>{0.39725697f, 0.930152237f},
-std::array<float,2>{0.950643182f, 0.0515849441f},
-std::array<float,2>{0.758857191f, 0.802338898f},
-std::array<float,2>{0.292816311f, 0.168615937f},
-std::array<float,2>{0.187091723f, 0.593927324f},
-std::array<float,2>{0.655380726f, 0.314858019f},
-std::array<float,2>{0.73043251f, 0.75295794f},
-std::array<float,2>{0.194749475f, 0.126916096f},
-std::array<float,2>{0.312870771f, 0.588743269f},
-std::array<float,2>{0.849197328f, 0.35858345f},
-std::array<float,2>{0.911780894f, 0.706223071f},
-std::array<float,2>{0.454100698f, 0.445605457f},
-std::array<float,2>{0.108766362f, 0.892595887f},
-std::array<float,2>{0.527703345f, 0.0261950381f},
-std::array<float,2>{0.574166477f, 0.540154278f},
-std::array<float,2>{0.0336608775f, 0.285665214f},
-std::array<float,2>{0.435766339f, 0.824052393f},
-std::array<float,2>{0.972957075f, 0.210960612f},
-std::array<float,2>{0.791711152f, 0.988536119f},
-std::array<float,2>{0.269637972f, 0.0628466159f},
-std::array<float,2>{0.149630889f, 0.656081378f},
-std::array<float,2>{0.668476701f, 0.398631036f},
-std::array<float,2>{0.547946811f, 0.926322401f},
-std::array<float,2>{0.07552398f, 0.0549921095f},
-std::array<float,2>{0.469837189f, 0.722885251f},
-std::array<float,2>{0.877812266f, 0.479305595f},
-std::array<float,2>{0.83156532f, 0.609268129f},
-std::array<float,2>{0.345134676f, 0.32644099f},
-std::array<float,2>{0.22609961f, 0.805347264f},
-std::array<float,2>{0.706868172f, 0.160278708f},
-std::array<float,2>{0.637727559f, 0.674297392f},
-std::array<float,2>{0.168675259f, 0.416268528f},
-std::array<float,2>{0.299366176f, 0.959216416f},
-std::array<float,2>{0.769066155f, 0.11291182f},
-std::array<float,2>{0.956607342f, 0.864138067f},
-std::array<float,2>{0.383182704f, 0.240043566f},
-std::array<float,2>{0.00450469786f, 0.515933812f},
-std::array<float,2>{0.601884842f, 0.273978531f},
-std::array<float,2>{0.621771991f, 0.84164232f},
-std::array<float,2>{0.0285698734f, 0.19696416f},
-std::array<float,2>{0.393717438f, 0.556157231f},
-std::array<float,2>{0.946610928f, 0.302944064f},
-std::array<float,2>{0.762658358f, 0.636567831f},
-std::array<float,2>{0.296549976f, 0.385545522f},
-std::array<float,2>{0.180890098f, 0.975732923f},
-std::array<float,2>{0.650354147f, 0.0936209336f},
-std::array<float,2>{0.68884182f, 0.568141341f},
-std::array<float,2>{0.243373826f, 0.359484196f},
-std::array<float,2>{0.370762855f, 0.766601801f},
-std::array<float,2>{0.826552868f, 0.14092502f},
-std::array<float,2>{0.894791722f, 0.880855024f},
-std::array<float,2>{0.493945301f, 0.00423022918f},
-std::array<float,2>{0.0898980722f, 0.696475625f},
-std::array<float,2>{0.535419643f, 0.462769151f},
-std::array<float,2>{0.675015271f, 0.948951423f},
-std::array<float,2>{0.140357867f, 0.108780988f},
-std::array<float,2>{0.265068322f, 0.66796869f},
-std::array<float,2>{0.808808684f, 0.426955789f},
-std::array<float,2>{0.987521768f, 0.514820576f},
-std::array<float,2>{0.41508767f, 0.253114402f},
-std::array<float,2>{0.0587539449f, 0.84738189f},
-std::array<float,2>{0.593387365f, 0.223747551f},
-std::array<float,2>{0.500816405f, 0.746213198f},
-std::array<float,2>{0.115817815f, 0.493735611f},
-std::array<float,2>{0.448128104f, 0.906383455f},
-std::array<float,2>{0.934891284f, 0.0350712612f},
-std::array<float,2>{0.874624133f, 0.795010746f},
-std::array<float,2>{0.330174983f, 0.178179801f},
-std::array<float,2>{0.217195317f, 0.617043734f},
-std::array<float,2>{0.736443281f, 0.338835806f},
-std::array<float,2>{0.642983437f, 0.854045689f},
-std::array<float,2>{0.172132805f, 0.231793821f},
-std::array<float,2>{0.285858482f, 0.500679791f},
-std::array<float,2>{0.757486939f, 0.263594002f},
-std::array<float,2>{0.94344461f, 0.658900023f},
-std::array<float,2>{0.405697763f, 0.436548471f},
-std::array<float,2>{0.0199342351f, 0.939193547f},
-std::array<float,2>{0.609769583f, 0.0967340916f},
-std::array<float,2>{0.541185915f, 0.617587268f},
-std::array<float,2>{0.0813804194f, 0.328707516f},
-std::array<float,2>{0.4889009f, 0.783777237f},
-std::array<float,2>{0.903615236f, 0.187324107f},
-std::array<float,2>{0.815278113f, 0.919223726f},
-std::array<float,2>{0.366900414f, 0.0431239828f},
-std::array<float,2>{0.235225052f, 0.736463428f},
-std::array<float,2>{0.700853586f, 0.489166617f},
-std::array<float,2>{0.580934703f, 0.980271637f},
-std::array<float,2>{0.0542700551f, 0.080726482f},
-std::array<float,2>{0.407809198f, 0.62510848f},
-std::array<float,2>{0.999792635f, 0.37638247f},
-std::array<float,2>{0.799685478f, 0.547599971f},
-std::array<float,2>{0.253124148f, 0.306499779f},
-std::array<float,2>{0.12866886f, 0.83399868f},
-std::array<float,2>{0.68734479f, 0.191837728f},
-std::array<float,2>{0.742659032f, 0.690262914f},
-std::array<float,2>{0.203598231f, 0.454985052f},
-std::array<float,2>{0.338208556f, 0.887021184f},
-std::array<float,2>{0.864468098f, 0.0153139643f},
-std::array<float,2>{0.92365551f, 0.779054403f},
-std::array<float,2>{0.443310142f, 0.156128556f},
-std::array<float,2>{0.118536659f, 0.577587485f},
-std::array<float,2>{0.513088346f, 0.368811071f},
-std::array<float,2>{0.516127706f, 0.797783434f},
-std::array<float,2>{0.0999105573f, 0.167920515f},
-std::array<float,2>{0.465673268f, 0.600224257f},
-std::array<float,2>{0.920434356f, 0.320154041f},
-std::array<float,2>{0.852240801f, 0.730761588f},
-std::array<float,2>{0.322251141f, 0.470369995f},
-std::array<float,2>{0.202159896f, 0.934609056f},
-std::array<float,2>{0.72599858f, 0.0471079238f},
-std::array<float,2>{0.656703055f, 0.524527133f},
-std::array<float,2>{0.143761218f, 0.266331136f},
-std::array<float,2>{0.273500502f, 0.868122876f},
-std::array<float,2>{0.78279686f, 0.248183623f},
-std::array<float,2>{0.977380812f, 0.96585077f},
-std::array<float,2>{0.428472877f, 0.11962539f},
-std::array<float,2>{0.0403510928f, 0.684218943f},
-std::array<float,2>{0.564892471f, 0.413183659f},
-std::array<float,2>{0.718673944f, 0.898812592f},
-std::array<float,2>{0.233377233f, 0.0204562899f},
-std::array<float,2>{0.355539769f, 0.711283207f},
-std::array<float,2>{0.842519164f, 0.437753201f},
-std::array<float,2>{0.887008727f, 0.583592236f},
-std::array<float,2>{0.4842695f, 0.348061323f},
-std::array<float,2>{0.0631701723f, 0.760508657f},
-std::array<float,2>{0.562350214f, 0.138826802f},
-std::array<float,2>{0.599363744f, 0.647154927f},
-std::array<float,2>{0.0124896998f, 0.395630658f},
-std::array<float,2>{0.376533389f, 0.994173765f},
-std::array<float,2>{0.968271196f, 0.0762880594f},
-std::array<float,2>{0.779959023f, 0.812931478f},
-std::array<float,2>{0.30566439f, 0.209894106f},
-std::array<float,2>{0.15688841f, 0.536455572f},
-std::array<float,2>{0.62925905f, 0.291293055f},
-std::array<float,2>{0.698197186f, 0.827690899f},
-std::array<float,2>{0.240912527f, 0.217035487f},
-std::array<float,2>{0.361665368f, 0.543772101f},
-std::array<float,2>{0.818024933f, 0.282205969f},
-std::array<float,2>{0.898474276f, 0.650941014f},
-std::array<float,2>{0.487687379f, 0.405063361f},
-std::array<float,2>{0.0821422562f, 0.985895216f},
-std::array<float,2>{0.546350479f, 0.0674363524f},
-std::array<float,2>{0.61357981f, 0.590541542f},
-std::array<float,2>{0.0170722026f, 0.351864159f},
-std::array<float,2>{0.400724709f, 0.755613446f},
-std::array<float,2>{0.939740121f, 0.130237028f},
-std::array<float,2>{0.750290036f, 0.89507097f},
-std::array<float,2>{0.282822251f, 0.0305876918f},
-std::array<float,2>{0.176346183f, 0.709258914f},
-std::array<float,2>{0.64723295f, 0.451508909f},
-std::array<float,2>{0.510581613f, 0.956420243f},
-std::array<float,2>{0.124128707f, 0.114166029f},
-std::array<float,2>{0.4375754f, 0.677862048f},
-std::array<float,2>{0.927383721f, 0.419667304f},
-std::array<float,2>{0.860358059f, 0.522319496f},
-std::array<float,2>{0.34021464f, 0.280309081f},
-std::array<float,2>{0.210142687f, 0.860828102f},
-std::array<float,2>{0.748823702f, 0.235103279f},
-std::array<float,2>{0.681502938f, 0.718918622f},
-std::array<float,2>{0.131069839f, 0.48235178f},
-std::array<float,2>{0.255180448f, 0.923863471f},
-std::array<float,2>{0.804119468f, 0.060995549f},
-std::array<float,2>{0.995435297f, 0.811319768f},
-std::array<float,2>{0.413468748f, 0.157255009f},
-std::array<float,2>{0.0485082865f, 0.601646185f},
-std::array<float,2>{0.58525908f, 0.320631683f},
-std::array<float,2>{0.567110479f, 0.773285866f},
-std::array<float,2>{0.0450851768f, 0.147954762f},
-std::array<float,2>{0.42354092f, 0.565494835f},
-std::array<float,2>{0.980493724f, 0.364801317f},
-std::array<float,2>{0.786936104f, 0.700838566f},
-std::array<float,2>{0.279545784f, 0.468517184f},
-std::array<float,2>{0.144634768f, 0.87560904f},
-std::array<float,2>{0.660285175f, 0.00149581092f},
-std::array<float,2>{0.719526112f, 0.55977118f},
-std::array<float,2>{0.198022664f, 0.299862802f},
-std::array<float,2>{0.327667952f, 0.838575065f},
-std::array<float,2>{0.859071791f, 0.199719489f},
-std::array<float,2>{0.916594267f, 0.970068216f},
-std::array<float,2>{0.460945904f, 0.0895867571f},
-std::array<float,2>{0.0971540213f, 0.637884736f},
-std::array<float,2>{0.523034215f, 0.390338838f},
-std::array<float,2>{0.627165616f, 0.910469234f},
-std::array<float,2>{0.162533313f, 0.0371314771f},
-std::array<float,2>{0.30983901f, 0.744709671f},
-std::array<float,2>{0.774724007f, 0.498726815f},
-std::array<float,2>{0.962377548f, 0.610210478f},
-std::array<float,2>{0.380469471f, 0.340600461f},
-std::array<float,2>{0.00859356485f, 0.789864004f},
-std::array<float,2>{0.594363987f, 0.174299493f},
-std::array<float,2>{0.558559418f, 0.671284914f},
-std::array<float,2>{0.069734849f, 0.423232466f},
-std::array<float,2>{0.47795707f, 0.952274323f},
-std::array<float,2>{0.885082662f, 0.105350219f},
-std::array<float,2>{0.837044239f, 0.849151373f},
-std::array<float,2>{0.354649156f, 0.219661549f},
-std::array<float,2>{0.228906244f, 0.507840812f},
-std::array<float,2>{0.712656081f, 0.257653326f},
-std::array<float,2>{0.667350054f, 0.786449671f},
-std::array<float,2>{0.153305307f, 0.180223092f},
-std::array<float,2>{0.268284291f, 0.623110831f},
-std::array<float,2>{0.793983877f, 0.334077597f},
-std::array<float,2>{0.971159935f, 0.741372406f},
-std::array<float,2>{0.433203548f, 0.485577375f},
-std::array<float,2>{0.0354323797f, 0.914912939f},
-std::array<float,2>{0.577932417f, 0.0429019518f},
-std::array<float,2>{0.526757061f, 0.504173398f},
-std::array<float,2>{0.103128083f, 0.259806365f},
-std::array<float,2>{0.457874f, 0.85817337f},
-std::array<float,2>{0.907108545f, 0.230147451f},
-std::array<float,2>{0.846566081f, 0.941872537f},
-std::array<float,2>{0.317961991f, 0.10093686f},
-std::array<float,2>{0.189482495f, 0.663393497f},
-std::array<float,2>{0.732218802f, 0.432713777f},
-std::array<float,2>{0.606059849f, 0.8859846f},
-std::array<float,2>{0.00366162439f, 0.0109321857f},
-std::array<float,2>{0.38903144f, 0.69202143f},
-std::array<float,2>{0.959990501f, 0.458499163f},
-std::array<float,2>{0.770238757f, 0.572455406f},
-std::array<float,2>{0.303400993f, 0.373681396f},
-std::array<float,2>{0.165178344f, 0.775589466f},
-std::array<float,2>{0.63327086f, 0.150085822f},
-std::array<float,2>{0.708299756f, 0.629283011f},
-std::array<float,2>{0.219225317f, 0.37914744f},
-std::array<float,2>{0.350308627f, 0.982133031f},
-std::array<float,2>{0.834638298f, 0.0824872181f},
-std::array<float,2>{0.879210174f, 0.830601633f},
-std::array<float,2>{0.475286692f, 0.187780619f},
-std::array<float,2>{0.0739886686f, 0.553308129f},
-std::array<float,2>{0.553721726f, 0.308761358f},
-std::array<float,2>{0.533122718f, 0.874712408f},
-std::array<float,2>{0.0865406469f, 0.245451748f},
-std::array<float,2>{0.498495996f, 0.528816223f},
-std::array<float,2>{0.891270339f, 0.272372037f},
-std::array<float,2>{0.823529661f, 0.681557298f},
-std::array<float,2>{0.374394476f, 0.408074796f},
-std::array<float,2>{0.249615535f, 0.96372211f},
-std::array<float,2>{0.692811787f, 0.124005213f},
-std::array<float,2>{0.653511584f, 0.596467078f},
-std::array<float,2>{0.184785053f, 0.313041419f},
-std::array<float,2>{0.29074195f, 0.804544985f},
-std::array<float,2>{0.760435641f, 0.170122445f},
-std::array<float,2>{0.951281309f, 0.931831002f},
-std::array<float,2>{0.396002561f, 0.0535140745f},
-std::array<float,2>{0.0259836055f, 0.729464293f},
-std::array<float,2>{0.617955446f, 0.475619644f},
-std::array<float,2>{0.740123391f, 0.999667287f},
-std::array<float,2>{0.213493153f, 0.0706965923f},
-std::array<float,2>{0.335676908f, 0.643868923f},
-std::array<float,2>{0.869808257f, 0.392688751f},
-std::array<float,2>{0.932446957f, 0.531966388f},
-std::array<float,2>{0.449796885f, 0.295452833f},
-std::array<float,2>{0.112770066f, 0.819104433f},
-std::array<float,2>{0.504926503f, 0.205458626f},
-std::array<float,2>{0.588497519f, 0.718223214f},
-std::array<float,2>{0.0571609735f, 0.44240433f},
-std::array<float,2>{0.419695884f, 0.905413151f},
-std::array<float,2>{0.992187262f, 0.0168481786f},
-std::array<float,2>{0.807279646f, 0.764803529f},
-std::array<float,2>{0.258287907f, 0.133165941f},
-std::array<float,2>{0.133849531f, 0.581528127f},
-std::array<float,2>{0.676033437f, 0.343770146f},
-std::array<float,2>{0.696003079f, 0.755723059f},
-std::array<float,2>{0.238729507f, 0.129906088f},
-std::array<float,2>{0.360387832f, 0.590601563f},
-std::array<float,2>{0.818825901f, 0.351696491f},
-std::array<float,2>{0.901692271f, 0.709108889f},
-std::array<float,2>{0.484869897f, 0.451346695f},
-std::array<float,2>{0.0847112462f, 0.895379126f},
-std::array<float,2>{0.544007361f, 0.0304633956f},
-std::array<float,2>{0.616802871f, 0.543543279f},
-std::array<float,2>{0.0191019662f, 0.281794667f},
-std::array<float,2>{0.399844617f, 0.828030348f},
-std::array<float,2>{0.938567579f, 0.217112109f},
-std::array<float,2>{0.753129184f, 0.986091435f},
-std::array<float,2>{0.283653438f, 0.0676413476f},
-std::array<float,2>{0.178542405f, 0.651160896f},
-std::array<float,2>{0.645658135f, 0.405020595f},
-std::array<float,2>{0.509109974f, 0.924262285f},
-std::array<float,2>{0.121442452f, 0.0606137216f},
-std::array<float,2>{0.439906716f, 0.719116092f},
-std::array<float,2>{0.929227412f, 0.482027978f},
-std::array<float,2>{0.862969875f, 0.601898432f},
-std::array<float,2>{0.34255895f, 0.320517033f},
-std::array<float,2>{0.207263738f, 0.811074376f},
-std::array<float,2>{0.747925997f, 0.157636702f},
-std::array<float,2>{0.683525264f, 0.678165853f},
-std::array<float,2>{0.130732864f, 0.419813216f},
-std::array<float,2>{0.256901741f, 0.956258595f},
-std::array<float,2>{0.802673221f, 0.113811962f},
-std::array<float,2>{0.992892742f, 0.860379636f},
-std::array<float,2>{0.410191178f, 0.23520197f},
-std::array<float,2>{0.0498795509f, 0.522144675f},
-std::array<float,2>{0.583931386f, 0.280742347f},
-std::array<float,2>{0.56973505f, 0.838668466f},
-std::array<float,2>{0.0436736941f, 0.200151145f},
-std::array<float,2>{0.423867941f, 0.560011208f},
-std::array<float,2>{0.983958304f, 0.300169826f},
-std::array<float,2>{0.788193405f, 0.63793987f},
-std::array<float,2>{0.279148817f, 0.390457749f},
-std::array<float,2>{0.146781936f, 0.969852149f},
-std::array<float,2>{0.663921297f, 0.0897571146f},
-std::array<float,2>{0.721220851f, 0.565685689f},
-std::array<float,2>{0.195800275f, 0.365142077f},
-std::array<float,2>{0.324230015f, 0.77304101f},
-std::array<float,2>{0.857064903f, 0.148242936f},
-std::array<float,2>{0.915445149f, 0.875738978f},
-std::array<float,2>{0.464614242f, 0.00172449206f},
-std::array<float,2>{0.0955461636f, 0.701132894f},
-std::array<float,2>{0.52033627f, 0.468443453f},
-std::array<float,2>{0.626038253f, 0.952627718f},
-std::array<float,2>{0.161785752f, 0.105143227f},
-std::array<float,2>{0.310894489f, 0.671077967f},
-std::array<float,2>{0.776048303f, 0.423038036f},
-std::array<float,2>{0.962943017f, 0.508075714f},
-std::array<float,2>{0.380930841f, 0.257355332f},
-std::array<float,2>{0.0103474688f, 0.849529207f},
-std::array<float,2>{0.596933424f, 0.219264999f},
-std::array<float,2>{0.555593491f, 0.74489212f},
-std::array<float,2>{0.0674041882f, 0.498990119f},
-std::array<float,2>{0.479751408f, 0.910293102f},
-std::array<float,2>{0.884586096f, 0.0374645293f},
-std::array<float,2>{0.839634776f, 0.789678931f},
-std::array<float,2>{0.352538854f, 0.173863083f},
-std::array<float,2>{0.228291005f, 0.610026002f},
-std::array<float,2>{0.713600874f, 0.340387166f},
-std::array<float,2>{0.664733589f, 0.857922435f},
-std::array<float,2>{0.154887229f, 0.230381235f},
-std::array<float,2>{0.26635623f, 0.504134834f},
-std::array<float,2>{0.79662317f, 0.260214061f},
-std::array<float,2>{0.969163954f, 0.663171411f},
-std::array<float,2>{0.430864662f, 0.432877004f},
-std::array<float,2>{0.0378232859f, 0.941628635f},
-std::array<float,2>{0.575124502f, 0.100593545f},
-std::array<float,2>{0.524301767f, 0.623428643f},
-std::array<float,2>{0.104653813f, 0.334294558f},
-std::array<float,2>{0.460482687f, 0.78634131f},
-std::array<float,2>{0.909036994f, 0.180601463f},
-std::array<float,2>{0.843889058f, 0.914721549f},
-std::array<float,2>{0.319604516f, 0.0426409505f},
-std::array<float,2>{0.187856838f, 0.74165529f},
-std::array<float,2>{0.732564867f, 0.485774487f},
-std::array<float,2>{0.608282089f, 0.982214332f},
-std::array<float,2>{5.16197761e-05f, 0.0821030438f},
-std::array<float,2>{0.387019157f, 0.628982127f},
-std::array<float,2>{0.958322346f, 0.379367948f},
-std::array<float,2>{0.773073494f, 0.553651631f},
-std::array<float,2>{0.302059382f, 0.308993638f},
-std::array<float,2>{0.166845873f, 0.830819309f},
-std::array<float,2>{0.634866178f, 0.187667295f},
-std::array<float,2>{0.710575819f, 0.692199051f},
-std::array<float,2>{0.220764786f, 0.458876222f},
-std::array<float,2>{0.348332822f, 0.88622427f},
-std::array<float,2>{0.832765341f, 0.0112229632f},
-std::array<float,2>{0.882735789f, 0.775825143f},
-std::array<float,2>{0.473756522f, 0.150231376f},
-std::array<float,2>{0.0720951781f, 0.572596133f},
-std::array<float,2>{0.552642167f, 0.373975307f},
-std::array<float,2>{0.534472644f, 0.804209113f},
-std::array<float,2>{0.0886329934f, 0.170172662f},
-std::array<float,2>{0.497534513f, 0.596271217f},
-std::array<float,2>{0.89299798f, 0.313351065f},
-std::array<float,2>{0.820577085f, 0.729122758f},
-std::array<float,2>{0.371395707f, 0.475995988f},
-std::array<float,2>{0.246430069f, 0.932065487f},
-std::array<float,2>{0.694846988f, 0.0534172393f},
-std::array<float,2>{0.654849887f, 0.529272497f},
-std::array<float,2>{0.186122775f, 0.27202332f},
-std::array<float,2>{0.291791201f, 0.874851763f},
-std::array<float,2>{0.758482337f, 0.245162725f},
-std::array<float,2>{0.950168967f, 0.963450313f},
-std::array<float,2>{0.39790377f, 0.123629645f},
-std::array<float,2>{0.0244277678f, 0.681181788f},
-std::array<float,2>{0.619263649f, 0.407945365f},
-std::array<float,2>{0.741649151f, 0.905599058f},
-std::array<float,2>{0.212667689f, 0.0166800898f},
-std::array<float,2>{0.332061619f, 0.717832685f},
-std::array<float,2>{0.868073225f, 0.442812473f},
-std::array<float,2>{0.931175351f, 0.581083894f},
-std::array<float,2>{0.453123808f, 0.344145566f},
-std::array<float,2>{0.11085134f, 0.765124083f},
-std::array<float,2>{0.506563902f, 0.132983863f},
-std::array<float,2>{0.587115943f, 0.643559635f},
-std::array<float,2>{0.0561818182f, 0.392901897f},
-std::array<float,2>{0.42183131f, 0.9998312f},
-std::array<float,2>{0.988766015f, 0.070448041f},
-std::array<float,2>{0.805748761f, 0.819015205f},
-std::array<float,2>{0.260840714f, 0.205135152f},
-std::array<float,2>{0.136317253f, 0.532043099f},
-std::array<float,2>{0.679166973f, 0.295698404f},
-std::array<float,2>{0.726642251f, 0.823896289f},
-std::array<float,2>{0.192827463f, 0.211258516f},
-std::array<float,2>{0.315555423f, 0.540499091f},
-std::array<float,2>{0.851075947f, 0.286109209f},
-std::array<float,2>{0.912150085f, 0.655861735f},
-std::array<float,2>{0.455582708f, 0.398808807f},
-std::array<float,2>{0.106833778f, 0.988322794f},
-std::array<float,2>{0.531064034f, 0.0625052601f},
-std::array<float,2>{0.570507109f, 0.58839947f},
-std::array<float,2>{0.0319122151f, 0.358724862f},
-std::array<float,2>{0.434709549f, 0.753376305f},
-std::array<float,2>{0.974687397f, 0.126567706f},
-std::array<float,2>{0.789395869f, 0.892892063f},
-std::array<float,2>{0.27338016f, 0.0260828305f},
-std::array<float,2>{0.150899678f, 0.706357479f},
-std::array<float,2>{0.671410203f, 0.445526063f},
-std::array<float,2>{0.548915863f, 0.95928663f},
-std::array<float,2>{0.0765551478f, 0.113259956f},
-std::array<float,2>{0.472299248f, 0.67394042f},
-std::array<float,2>{0.875772059f, 0.416248381f},
-std::array<float,2>{0.829559147f, 0.515722454f},
-std::array<float,2>{0.346599728f, 0.274202228f},
-std::array<float,2>{0.223017588f, 0.863913536f},
-std::array<float,2>{0.70479852f, 0.239801496f},
-std::array<float,2>{0.639986694f, 0.722916305f},
-std::array<float,2>{0.170759797f, 0.479077786f},
-std::array<float,2>{0.298220009f, 0.926632643f},
-std::array<float,2>{0.76723057f, 0.0547613911f},
-std::array<float,2>{0.954347849f, 0.805464268f},
-std::array<float,2>{0.385138512f, 0.160546035f},
-std::array<float,2>{0.00755632389f, 0.609044254f},
-std::array<float,2>{0.60451442f, 0.326327652f},
-std::array<float,2>{0.623734951f, 0.767088652f},
-std::array<float,2>{0.0307279266f, 0.14086476f},
-std::array<float,2>{0.392353237f, 0.567908108f},
-std::array<float,2>{0.948439896f, 0.359802574f},
-std::array<float,2>{0.764515758f, 0.696741641f},
-std::array<float,2>{0.294441998f, 0.462443143f},
-std::array<float,2>{0.183314428f, 0.880520165f},
-std::array<float,2>{0.65145272f, 0.00408247579f},
-std::array<float,2>{0.691190422f, 0.556555331f},
-std::array<float,2>{0.244315192f, 0.303085446f},
-std::array<float,2>{0.369118601f, 0.8413288f},
-std::array<float,2>{0.824793756f, 0.197158098f},
-std::array<float,2>{0.897662342f, 0.975949705f},
-std::array<float,2>{0.496048301f, 0.0933602974f},
-std::array<float,2>{0.0925739631f, 0.636316419f},
-std::array<float,2>{0.537110865f, 0.385481089f},
-std::array<float,2>{0.671905041f, 0.90662843f},
-std::array<float,2>{0.138206735f, 0.0347148813f},
-std::array<float,2>{0.262281418f, 0.74643302f},
-std::array<float,2>{0.81182754f, 0.494071156f},
-std::array<float,2>{0.985605896f, 0.616860211f},
-std::array<float,2>{0.41760996f, 0.338480204f},
-std::array<float,2>{0.0623703673f, 0.795186102f},
-std::array<float,2>{0.591744483f, 0.17791754f},
-std::array<float,2>{0.503877461f, 0.667629659f},
-std::array<float,2>{0.114165097f, 0.427158475f},
-std::array<float,2>{0.44711566f, 0.949040651f},
-std::array<float,2>{0.937283993f, 0.108579487f},
-std::array<float,2>{0.871806681f, 0.847625911f},
-std::array<float,2>{0.329624385f, 0.224093765f},
-std::array<float,2>{0.215510949f, 0.515099287f},
-std::array<float,2>{0.736185789f, 0.253201246f},
-std::array<float,2>{0.641335785f, 0.78412503f},
-std::array<float,2>{0.174422875f, 0.187099352f},
-std::array<float,2>{0.289059281f, 0.61740768f},
-std::array<float,2>{0.755227685f, 0.328933716f},
-std::array<float,2>{0.941475689f, 0.736640096f},
-std::array<float,2>{0.40364331f, 0.488877237f},
-std::array<float,2>{0.0215846058f, 0.919182241f},
-std::array<float,2>{0.611539006f, 0.0432804488f},
-std::array<float,2>{0.539214849f, 0.500905931f},
-std::array<float,2>{0.078689754f, 0.263207763f},
-std::array<float,2>{0.491347969f, 0.854250312f},
-std::array<float,2>{0.905371666f, 0.231487289f},
-std::array<float,2>{0.813893676f, 0.939218342f},
-std::array<float,2>{0.36496985f, 0.096945703f},
-std::array<float,2>{0.237736464f, 0.659062147f},
-std::array<float,2>{0.702152669f, 0.436807066f},
-std::array<float,2>{0.578687549f, 0.886808872f},
-std::array<float,2>{0.0510878749f, 0.0154433018f},
-std::array<float,2>{0.409821957f, 0.689958513f},
-std::array<float,2>{0.996571302f, 0.454643905f},
-std::array<float,2>{0.798510551f, 0.577286005f},
-std::array<float,2>{0.251836538f, 0.369051814f},
-std::array<float,2>{0.126816183f, 0.778879404f},
-std::array<float,2>{0.68514818f, 0.155857891f},
-std::array<float,2>{0.744976521f, 0.625338852f},
-std::array<float,2>{0.205142811f, 0.376203686f},
-std::array<float,2>{0.336461663f, 0.980039299f},
-std::array<float,2>{0.865276933f, 0.0810084492f},
-std::array<float,2>{0.924597621f, 0.834233224f},
-std::array<float,2>{0.444301128f, 0.19161582f},
-std::array<float,2>{0.120248638f, 0.54760921f},
-std::array<float,2>{0.515473962f, 0.306272f},
-std::array<float,2>{0.518265367f, 0.867735982f},
-std::array<float,2>{0.0992514491f, 0.248375401f},
-std::array<float,2>{0.46855098f, 0.524795055f},
-std::array<float,2>{0.918958068f, 0.266539901f},
-std::array<float,2>{0.854076624f, 0.684541583f},
-std::array<float,2>{0.323596418f, 0.413458139f},
-std::array<float,2>{0.200522721f, 0.966105819f},
-std::array<float,2>{0.724351406f, 0.119199298f},
-std::array<float,2>{0.658644021f, 0.600473285f},
-std::array<float,2>{0.141981751f, 0.320018679f},
-std::array<float,2>{0.276477963f, 0.797441065f},
-std::array<float,2>{0.784083903f, 0.167652354f},
-std::array<float,2>{0.979278386f, 0.934972882f},
-std::array<float,2>{0.426001161f, 0.0473255813f},
-std::array<float,2>{0.0410346016f, 0.730546236f},
-std::array<float,2>{0.562727571f, 0.470529705f},
-std::array<float,2>{0.715064168f, 0.99440676f},
-std::array<float,2>{0.230893612f, 0.0766296685f},
-std::array<float,2>{0.359095722f, 0.647271693f},
-std::array<float,2>{0.840215862f, 0.395862043f},
-std::array<float,2>{0.888880491f, 0.536325812f},
-std::array<float,2>{0.481146812f, 0.291155219f},
-std::array<float,2>{0.0650171489f, 0.812644362f},
-std::array<float,2>{0.56051141f, 0.209704578f},
-std::array<float,2>{0.600235105f, 0.710967183f},
-std::array<float,2>{0.0149945738f, 0.437688798f},
-std::array<float,2>{0.378296912f, 0.898588955f},
-std::array<float,2>{0.965459108f, 0.0201685987f},
-std::array<float,2>{0.777671099f, 0.760454237f},
-std::array<float,2>{0.307895094f, 0.138950288f},
-std::array<float,2>{0.159128353f, 0.583968699f},
-std::array<float,2>{0.63217175f, 0.347894162f},
-std::array<float,2>{0.749435008f, 0.810441256f},
-std::array<float,2>{0.209270418f, 0.158372998f},
-std::array<float,2>{0.341519386f, 0.605260015f},
-std::array<float,2>{0.860100687f, 0.322787881f},
-std::array<float,2>{0.926035047f, 0.721152008f},
-std::array<float,2>{0.43885392f, 0.483612478f},
-std::array<float,2>{0.123632997f, 0.922754526f},
-std::array<float,2>{0.511505842f, 0.0594215356f},
-std::array<float,2>{0.584170341f, 0.520213485f},
-std::array<float,2>{0.0469403043f, 0.278784007f},
-std::array<float,2>{0.412711263f, 0.862922192f},
-std::array<float,2>{0.994230926f, 0.236879125f},
-std::array<float,2>{0.802897096f, 0.953468084f},
-std::array<float,2>{0.254823446f, 0.116319917f},
-std::array<float,2>{0.132615238f, 0.676775396f},
-std::array<float,2>{0.680143654f, 0.420633584f},
-std::array<float,2>{0.545047283f, 0.897676528f},
-std::array<float,2>{0.083775267f, 0.0284573734f},
-std::array<float,2>{0.486672878f, 0.707738757f},
-std::array<float,2>{0.900128126f, 0.4501535f},
-std::array<float,2>{0.816972911f, 0.592473269f},
-std::array<float,2>{0.362364352f, 0.353669405f},
-std::array<float,2>{0.241594523f, 0.756548822f},
-std::array<float,2>{0.698895097f, 0.132797509f},
-std::array<float,2>{0.647693336f, 0.649752438f},
-std::array<float,2>{0.17757687f, 0.404185921f},
-std::array<float,2>{0.281723976f, 0.986463487f},
-std::array<float,2>{0.751423597f, 0.0698747039f},
-std::array<float,2>{0.941137791f, 0.825640261f},
-std::array<float,2>{0.402270228f, 0.216727674f},
-std::array<float,2>{0.0161656868f, 0.546803594f},
-std::array<float,2>{0.614674389f, 0.284472048f},
-std::array<float,2>{0.594840646f, 0.849927783f},
-std::array<float,2>{0.00973110553f, 0.221813738f},
-std::array<float,2>{0.379661083f, 0.511110246f},
-std::array<float,2>{0.961661935f, 0.255680323f},
-std::array<float,2>{0.77371949f, 0.668320119f},
-std::array<float,2>{0.309356987f, 0.424641371f},
-std::array<float,2>{0.163612023f, 0.950427413f},
-std::array<float,2>{0.628382385f, 0.10256625f},
-std::array<float,2>{0.711071134f, 0.612531543f},
-std::array<float,2>{0.230087474f, 0.34364742f},
-std::array<float,2>{0.354031503f, 0.792179525f},
-std::array<float,2>{0.836448371f, 0.173083082f},
-std::array<float,2>{0.886143088f, 0.913282156f},
-std::array<float,2>{0.477260768f, 0.0366951264f},
-std::array<float,2>{0.0685293823f, 0.742827058f},
-std::array<float,2>{0.557016373f, 0.496413976f},
-std::array<float,2>{0.661577165f, 0.970978796f},
-std::array<float,2>{0.145849362f, 0.0873745903f},
-std::array<float,2>{0.281115443f, 0.63965553f},
-std::array<float,2>{0.786080718f, 0.387940049f},
-std::array<float,2>{0.982273936f, 0.561777055f},
-std::array<float,2>{0.42244333f, 0.298043162f},
-std::array<float,2>{0.0468035191f, 0.836816728f},
-std::array<float,2>{0.567551911f, 0.201749161f},
-std::array<float,2>{0.521544933f, 0.702968776f},
-std::array<float,2>{0.0962334722f, 0.466381878f},
-std::array<float,2>{0.462409973f, 0.878323495f},
-std::array<float,2>{0.917780638f, 0.00284257834f},
-std::array<float,2>{0.858008862f, 0.770967484f},
-std::array<float,2>{0.326505542f, 0.146329492f},
-std::array<float,2>{0.198972911f, 0.562839031f},
-std::array<float,2>{0.720275462f, 0.36536175f},
-std::array<float,2>{0.634346068f, 0.828234494f},
-std::array<float,2>{0.164147228f, 0.189652726f},
-std::array<float,2>{0.304004937f, 0.552150488f},
-std::array<float,2>{0.771357775f, 0.31065169f},
-std::array<float,2>{0.959879518f, 0.632245004f},
-std::array<float,2>{0.389709055f, 0.380992651f},
-std::array<float,2>{0.00234668888f, 0.984095156f},
-std::array<float,2>{0.607348919f, 0.0842651576f},
-std::array<float,2>{0.55278337f, 0.571423769f},
-std::array<float,2>{0.0729249492f, 0.372821808f},
-std::array<float,2>{0.476200402f, 0.774351835f},
-std::array<float,2>{0.880207181f, 0.151732162f},
-std::array<float,2>{0.83586663f, 0.884553552f},
-std::array<float,2>{0.350620359f, 0.00794567727f},
-std::array<float,2>{0.220700517f, 0.694846213f},
-std::array<float,2>{0.707874537f, 0.459063292f},
-std::array<float,2>{0.576287925f, 0.944427907f},
-std::array<float,2>{0.0368526131f, 0.098210074f},
-std::array<float,2>{0.431875318f, 0.661231816f},
-std::array<float,2>{0.972247481f, 0.430394888f},
-std::array<float,2>{0.793705344f, 0.506235063f},
-std::array<float,2>{0.269346416f, 0.258186907f},
-std::array<float,2>{0.154284969f, 0.855771422f},
-std::array<float,2>{0.666127563f, 0.227076128f},
-std::array<float,2>{0.730962455f, 0.740076482f},
-std::array<float,2>{0.191179737f, 0.487341255f},
-std::array<float,2>{0.316601902f, 0.917684913f},
-std::array<float,2>{0.847302735f, 0.039539896f},
-std::array<float,2>{0.907565773f, 0.789042175f},
-std::array<float,2>{0.45867756f, 0.181676269f},
-std::array<float,2>{0.102516152f, 0.622181952f},
-std::array<float,2>{0.525844991f, 0.332708657f},
-std::array<float,2>{0.504027188f, 0.7634359f},
-std::array<float,2>{0.112238541f, 0.136499479f},
-std::array<float,2>{0.450384259f, 0.579061985f},
-std::array<float,2>{0.933510423f, 0.345717877f},
-std::array<float,2>{0.870673954f, 0.715169668f},
-std::array<float,2>{0.334171027f, 0.445108771f},
-std::array<float,2>{0.21437642f, 0.902882457f},
-std::array<float,2>{0.73836267f, 0.0183914471f},
-std::array<float,2>{0.677226424f, 0.533396423f},
-std::array<float,2>{0.133169517f, 0.294596016f},
-std::array<float,2>{0.258826494f, 0.817205369f},
-std::array<float,2>{0.808097243f, 0.203159869f},
-std::array<float,2>{0.990456283f, 0.996198297f},
-std::array<float,2>{0.418679833f, 0.0736447647f},
-std::array<float,2>{0.0581437647f, 0.641377449f},
-std::array<float,2>{0.589787543f, 0.391869098f},
-std::array<float,2>{0.692270696f, 0.929875672f},
-std::array<float,2>{0.248643592f, 0.05148286f},
-std::array<float,2>{0.373604357f, 0.727288365f},
-std::array<float,2>{0.82292217f, 0.472730279f},
-std::array<float,2>{0.891915917f, 0.594007611f},
-std::array<float,2>{0.499337822f, 0.314472258f},
-std::array<float,2>{0.0875670388f, 0.802517056f},
-std::array<float,2>{0.531697869f, 0.168921486f},
-std::array<float,2>{0.618353367f, 0.682472229f},
-std::array<float,2>{0.027228741f, 0.408935219f},
-std::array<float,2>{0.394776434f, 0.962206185f},
-std::array<float,2>{0.952593446f, 0.122131586f},
-std::array<float,2>{0.760795116f, 0.871352911f},
-std::array<float,2>{0.28992492f, 0.244015694f},
-std::array<float,2>{0.184405431f, 0.529460073f},
-std::array<float,2>{0.652847707f, 0.27093178f},
-std::array<float,2>{0.705990553f, 0.866409242f},
-std::array<float,2>{0.225201339f, 0.240521297f},
-std::array<float,2>{0.344154924f, 0.518671155f},
-std::array<float,2>{0.830855012f, 0.275774479f},
-std::array<float,2>{0.87834084f, 0.672980845f},
-std::array<float,2>{0.469513446f, 0.415919513f},
-std::array<float,2>{0.0744500607f, 0.957369864f},
-std::array<float,2>{0.547665834f, 0.110807009f},
-std::array<float,2>{0.602777541f, 0.607198358f},
-std::array<float,2>{0.00488417875f, 0.324358761f},
-std::array<float,2>{0.384518981f, 0.807580352f},
-std::array<float,2>{0.955831587f, 0.162447706f},
-std::array<float,2>{0.767596841f, 0.929284275f},
-std::array<float,2>{0.299906999f, 0.0577432252f},
-std::array<float,2>{0.169761375f, 0.725884497f},
-std::array<float,2>{0.637386382f, 0.477649122f},
-std::array<float,2>{0.528934777f, 0.991634965f},
-std::array<float,2>{0.107930884f, 0.0646444038f},
-std::array<float,2>{0.454123467f, 0.652488053f},
-std::array<float,2>{0.911047041f, 0.401989251f},
-std::array<float,2>{0.848372161f, 0.542190254f},
-std::array<float,2>{0.3142941f, 0.288214445f},
-std::array<float,2>{0.193990856f, 0.821189106f},
-std::array<float,2>{0.72902745f, 0.213119596f},
-std::array<float,2>{0.669753194f, 0.703205109f},
-std::array<float,2>{0.148904279f, 0.447502494f},
-std::array<float,2>{0.271311492f, 0.890678167f},
-std::array<float,2>{0.792802513f, 0.0235861074f},
-std::array<float,2>{0.974543452f, 0.751948535f},
-std::array<float,2>{0.436685055f, 0.127479419f},
-std::array<float,2>{0.0348122381f, 0.586455882f},
-std::array<float,2>{0.572377741f, 0.357324332f},
-std::array<float,2>{0.591896236f, 0.794419348f},
-std::array<float,2>{0.0595772192f, 0.177592918f},
-std::array<float,2>{0.415019453f, 0.613567889f},
-std::array<float,2>{0.987295091f, 0.337871581f},
-std::array<float,2>{0.809754014f, 0.749163032f},
-std::array<float,2>{0.264035285f, 0.496047467f},
-std::array<float,2>{0.139350519f, 0.909208596f},
-std::array<float,2>{0.674014091f, 0.0320604965f},
-std::array<float,2>{0.738008499f, 0.51280731f},
-std::array<float,2>{0.218163878f, 0.251094967f},
-std::array<float,2>{0.331959635f, 0.845520616f},
-std::array<float,2>{0.873642027f, 0.226003692f},
-std::array<float,2>{0.934263825f, 0.947145104f},
-std::array<float,2>{0.448545367f, 0.10649807f},
-std::array<float,2>{0.117136888f, 0.664767146f},
-std::array<float,2>{0.501190245f, 0.429118276f},
-std::array<float,2>{0.649224222f, 0.881905913f},
-std::array<float,2>{0.179973677f, 0.00687238993f},
-std::array<float,2>{0.295154303f, 0.698061407f},
-std::array<float,2>{0.763063967f, 0.463728935f},
-std::array<float,2>{0.946045518f, 0.568853378f},
-std::array<float,2>{0.392738581f, 0.362172812f},
-std::array<float,2>{0.027595181f, 0.768096089f},
-std::array<float,2>{0.622198641f, 0.142704189f},
-std::array<float,2>{0.536964774f, 0.632996321f},
-std::array<float,2>{0.0917803571f, 0.384436995f},
-std::array<float,2>{0.493131965f, 0.973395526f},
-std::array<float,2>{0.896303952f, 0.0901714042f},
-std::array<float,2>{0.827579916f, 0.843437076f},
-std::array<float,2>{0.369455963f, 0.197415128f},
-std::array<float,2>{0.24307844f, 0.556857824f},
-std::array<float,2>{0.688067198f, 0.301264107f},
-std::array<float,2>{0.686339378f, 0.779619753f},
-std::array<float,2>{0.1277574f, 0.15320611f},
-std::array<float,2>{0.252913177f, 0.575778067f},
-std::array<float,2>{0.800185561f, 0.370580375f},
-std::array<float,2>{0.998917103f, 0.688360095f},
-std::array<float,2>{0.406988621f, 0.456455886f},
-std::array<float,2>{0.0537033491f, 0.889218688f},
-std::array<float,2>{0.581631899f, 0.0134499809f},
-std::array<float,2>{0.512284279f, 0.549998105f},
-std::array<float,2>{0.118071035f, 0.30716452f},
-std::array<float,2>{0.441615075f, 0.833658636f},
-std::array<float,2>{0.922642171f, 0.193939582f},
-std::array<float,2>{0.863535464f, 0.977250218f},
-std::array<float,2>{0.339589059f, 0.0784916431f},
-std::array<float,2>{0.204865515f, 0.627182066f},
-std::array<float,2>{0.743303716f, 0.377964675f},
-std::array<float,2>{0.610546529f, 0.92157495f},
-std::array<float,2>{0.0213325117f, 0.0452644266f},
-std::array<float,2>{0.404972017f, 0.735554278f},
-std::array<float,2>{0.945115268f, 0.491083056f},
-std::array<float,2>{0.755882978f, 0.620610178f},
-std::array<float,2>{0.287063867f, 0.3319996f},
-std::array<float,2>{0.172959521f, 0.783051252f},
-std::array<float,2>{0.644027352f, 0.184474498f},
-std::array<float,2>{0.699790359f, 0.656944692f},
-std::array<float,2>{0.236183867f, 0.434839875f},
-std::array<float,2>{0.36597684f, 0.939576387f},
-std::array<float,2>{0.815595984f, 0.0952242315f},
-std::array<float,2>{0.903161407f, 0.853322029f},
-std::array<float,2>{0.490161031f, 0.232518092f},
-std::array<float,2>{0.080486685f, 0.502587616f},
-std::array<float,2>{0.542453051f, 0.265326142f},
-std::array<float,2>{0.560725391f, 0.815548956f},
-std::array<float,2>{0.0641515702f, 0.20782657f},
-std::array<float,2>{0.482722819f, 0.538993537f},
-std::array<float,2>{0.88837254f, 0.290075779f},
-std::array<float,2>{0.843246758f, 0.644558251f},
-std::array<float,2>{0.356871128f, 0.397093683f},
-std::array<float,2>{0.233620927f, 0.992560685f},
-std::array<float,2>{0.71699053f, 0.0752311647f},
-std::array<float,2>{0.630096793f, 0.584871054f},
-std::array<float,2>{0.158009723f, 0.351350427f},
-std::array<float,2>{0.304706335f, 0.758456945f},
-std::array<float,2>{0.780710578f, 0.137955666f},
-std::array<float,2>{0.967325211f, 0.900443792f},
-std::array<float,2>{0.375824928f, 0.0217702165f},
-std::array<float,2>{0.0132361967f, 0.713528574f},
-std::array<float,2>{0.598511398f, 0.440325558f},
-std::array<float,2>{0.725319922f, 0.966967165f},
-std::array<float,2>{0.202013329f, 0.118115164f},
-std::array<float,2>{0.320848614f, 0.686720431f},
-std::array<float,2>{0.853251576f, 0.411102116f},
-std::array<float,2>{0.921779275f, 0.526918888f},
-std::array<float,2>{0.46631068f, 0.268837661f},
-std::array<float,2>{0.101298846f, 0.869336903f},
-std::array<float,2>{0.517296612f, 0.246936128f},
-std::array<float,2>{0.5656299f, 0.732690752f},
-std::array<float,2>{0.0392733701f, 0.471011907f},
-std::array<float,2>{0.429432273f, 0.937079728f},
-std::array<float,2>{0.977706075f, 0.0500705354f},
-std::array<float,2>{0.781452358f, 0.798923969f},
-std::array<float,2>{0.27517432f, 0.164610073f},
-std::array<float,2>{0.14335461f, 0.598740101f},
-std::array<float,2>{0.657686353f, 0.318163514f},
-std::array<float,2>{0.714538574f, 0.791876256f},
-std::array<float,2>{0.226666674f, 0.17230776f},
-std::array<float,2>{0.352579057f, 0.61184454f},
-std::array<float,2>{0.837961555f, 0.342152268f},
-std::array<float,2>{0.883677125f, 0.744098842f},
-std::array<float,2>{0.479364008f, 0.497396737f},
-std::array<float,2>{0.0669101477f, 0.91255182f},
-std::array<float,2>{0.556612432f, 0.036032889f},
-std::array<float,2>{0.596649289f, 0.510380507f},
-std::array<float,2>{0.0111497827f, 0.254827768f},
-std::array<float,2>{0.382236391f, 0.850769699f},
-std::array<float,2>{0.964581192f, 0.221572891f},
-std::array<float,2>{0.777055383f, 0.950104237f},
-std::array<float,2>{0.311733186f, 0.102254592f},
-std::array<float,2>{0.160345793f, 0.669547439f},
-std::array<float,2>{0.625579178f, 0.425155371f},
-std::array<float,2>{0.521431863f, 0.87703383f},
-std::array<float,2>{0.0946864635f, 0.00303419773f},
-std::array<float,2>{0.463728935f, 0.702082932f},
-std::array<float,2>{0.914488614f, 0.465593308f},
-std::array<float,2>{0.856381118f, 0.563885033f},
-std::array<float,2>{0.325386047f, 0.366626889f},
-std::array<float,2>{0.196560428f, 0.770289958f},
-std::array<float,2>{0.721834898f, 0.144720837f},
-std::array<float,2>{0.662216246f, 0.639385462f},
-std::array<float,2>{0.148284808f, 0.386915743f},
-std::array<float,2>{0.277665913f, 0.97205776f},
-std::array<float,2>{0.787305176f, 0.0864073858f},
-std::array<float,2>{0.983339369f, 0.83705163f},
-std::array<float,2>{0.425632387f, 0.203023732f},
-std::array<float,2>{0.0440587178f, 0.560914397f},
-std::array<float,2>{0.568545043f, 0.296925426f},
-std::array<float,2>{0.582354963f, 0.861763656f},
-std::array<float,2>{0.049401734f, 0.238130465f},
-std::array<float,2>{0.411940396f, 0.521389067f},
-std::array<float,2>{0.993249834f, 0.277376264f},
-std::array<float,2>{0.800818622f, 0.676622033f},
-std::array<float,2>{0.256378174f, 0.421656281f},
-std::array<float,2>{0.129019201f, 0.954866529f},
-std::array<float,2>{0.682144225f, 0.11613322f},
-std::array<float,2>{0.746955812f, 0.604352176f},
-std::array<float,2>{0.208402202f, 0.323420584f},
-std::array<float,2>{0.343337804f, 0.809565008f},
-std::array<float,2>{0.862213969f, 0.159562081f},
-std::array<float,2>{0.927797437f, 0.923362613f},
-std::array<float,2>{0.440866053f, 0.060035646f},
-std::array<float,2>{0.122703791f, 0.721760154f},
-std::array<float,2>{0.50842154f, 0.482917011f},
-std::array<float,2>{0.644925177f, 0.988114953f},
-std::array<float,2>{0.179588333f, 0.068396911f},
-std::array<float,2>{0.28433755f, 0.648714006f},
-std::array<float,2>{0.752690911f, 0.403303325f},
-std::array<float,2>{0.937773705f, 0.545099854f},
-std::array<float,2>{0.399346411f, 0.28386569f},
-std::array<float,2>{0.018370023f, 0.824313879f},
-std::array<float,2>{0.616126597f, 0.215777978f},
-std::array<float,2>{0.54360199f, 0.708043694f},
-std::array<float,2>{0.0855950713f, 0.450433969f},
-std::array<float,2>{0.485430837f, 0.897374988f},
-std::array<float,2>{0.900531709f, 0.0276469011f},
-std::array<float,2>{0.820185304f, 0.757047594f},
-std::array<float,2>{0.360141993f, 0.131120712f},
-std::array<float,2>{0.240102604f, 0.593137145f},
-std::array<float,2>{0.696372628f, 0.354917794f},
-std::array<float,2>{0.67865026f, 0.817622304f},
-std::array<float,2>{0.135287091f, 0.204936609f},
-std::array<float,2>{0.260070175f, 0.534291923f},
-std::array<float,2>{0.804882407f, 0.293827116f},
-std::array<float,2>{0.989819884f, 0.642354012f},
-std::array<float,2>{0.420286059f, 0.390857339f},
-std::array<float,2>{0.0547950491f, 0.997877777f},
-std::array<float,2>{0.586746156f, 0.0729806647f},
-std::array<float,2>{0.507342339f, 0.579277575f},
-std::array<float,2>{0.110265836f, 0.347565502f},
-std::array<float,2>{0.451498836f, 0.762134671f},
-std::array<float,2>{0.930531025f, 0.135493264f},
-std::array<float,2>{0.868860841f, 0.904032469f},
-std::array<float,2>{0.333342344f, 0.0187258795f},
-std::array<float,2>{0.21110177f, 0.716748118f},
-std::array<float,2>{0.740694046f, 0.444006979f},
-std::array<float,2>{0.620519519f, 0.96180588f},
-std::array<float,2>{0.0241405182f, 0.121662825f},
-std::array<float,2>{0.396620125f, 0.683517754f},
-std::array<float,2>{0.95084554f, 0.41006434f},
-std::array<float,2>{0.759352624f, 0.530546606f},
-std::array<float,2>{0.291999817f, 0.269803852f},
-std::array<float,2>{0.186905488f, 0.872780442f},
-std::array<float,2>{0.655840933f, 0.242285386f},
-std::array<float,2>{0.693768442f, 0.728143096f},
-std::array<float,2>{0.247212335f, 0.47427994f},
-std::array<float,2>{0.372213602f, 0.930957556f},
-std::array<float,2>{0.821506381f, 0.0524237752f},
-std::array<float,2>{0.893938065f, 0.800979674f},
-std::array<float,2>{0.496246189f, 0.169509575f},
-std::array<float,2>{0.0894118547f, 0.595556259f},
-std::array<float,2>{0.534159422f, 0.315524876f},
-std::array<float,2>{0.55141288f, 0.775075614f},
-std::array<float,2>{0.0704199001f, 0.150679454f},
-std::array<float,2>{0.47286281f, 0.570608675f},
-std::array<float,2>{0.881552696f, 0.371726334f},
-std::array<float,2>{0.833683789f, 0.693624139f},
-std::array<float,2>{0.348829985f, 0.46091935f},
-std::array<float,2>{0.222039223f, 0.883429885f},
-std::array<float,2>{0.709102571f, 0.00968014449f},
-std::array<float,2>{0.636430621f, 0.551075161f},
-std::array<float,2>{0.167807236f, 0.312292159f},
-std::array<float,2>{0.30108273f, 0.829701126f},
-std::array<float,2>{0.772245526f, 0.190566316f},
-std::array<float,2>{0.957627356f, 0.982976317f},
-std::array<float,2>{0.387915283f, 0.0851360038f},
-std::array<float,2>{0.00146548136f, 0.63154614f},
-std::array<float,2>{0.608958304f, 0.382488638f},
-std::array<float,2>{0.734122574f, 0.91687721f},
-std::array<float,2>{0.189212054f, 0.0406881161f},
-std::array<float,2>{0.319242895f, 0.738313138f},
-std::array<float,2>{0.845456362f, 0.48668161f},
-std::array<float,2>{0.909867048f, 0.621864974f},
-std::array<float,2>{0.459948093f, 0.333457381f},
-std::array<float,2>{0.104199916f, 0.787255049f},
-std::array<float,2>{0.524588704f, 0.182956189f},
-std::array<float,2>{0.575800419f, 0.660192728f},
-std::array<float,2>{0.0387145132f, 0.43095091f},
-std::array<float,2>{0.430034786f, 0.94405967f},
-std::array<float,2>{0.969793975f, 0.0994890481f},
-std::array<float,2>{0.79569155f, 0.856809616f},
-std::array<float,2>{0.267087698f, 0.228097513f},
-std::array<float,2>{0.156227067f, 0.507134855f},
-std::array<float,2>{0.66512084f, 0.259065896f},
-std::array<float,2>{0.734538496f, 0.844138086f},
-std::array<float,2>{0.216722578f, 0.225507036f},
-std::array<float,2>{0.328379273f, 0.512330294f},
-std::array<float,2>{0.8723014f, 0.250448734f},
-std::array<float,2>{0.936254799f, 0.665228069f},
-std::array<float,2>{0.445829034f, 0.428378224f},
-std::array<float,2>{0.114980556f, 0.94617784f},
-std::array<float,2>{0.502493382f, 0.105871648f},
-std::array<float,2>{0.590685725f, 0.614700913f},
-std::array<float,2>{0.0614805408f, 0.33615759f},
-std::array<float,2>{0.416327864f, 0.793785751f},
-std::array<float,2>{0.984795153f, 0.175914377f},
-std::array<float,2>{0.811441123f, 0.908917248f},
-std::array<float,2>{0.263504624f, 0.032922551f},
-std::array<float,2>{0.136773989f, 0.748937488f},
-std::array<float,2>{0.673208356f, 0.494241178f},
-std::array<float,2>{0.538875937f, 0.974278331f},
-std::array<float,2>{0.092865251f, 0.0911175311f},
-std::array<float,2>{0.495011866f, 0.634713531f},
-std::array<float,2>{0.897221744f, 0.383232147f},
-std::array<float,2>{0.825593889f, 0.55820024f},
-std::array<float,2>{0.36744082f, 0.302117318f},
-std::array<float,2>{0.245958671f, 0.842092335f},
-std::array<float,2>{0.689670622f, 0.199127644f},
-std::array<float,2>{0.651216865f, 0.698571324f},
-std::array<float,2>{0.182581753f, 0.463994026f},
-std::array<float,2>{0.292993397f, 0.881557822f},
-std::array<float,2>{0.765557051f, 0.00647927541f},
-std::array<float,2>{0.947790325f, 0.76873225f},
-std::array<float,2>{0.391061723f, 0.143862188f},
-std::array<float,2>{0.0301068984f, 0.569959819f},
-std::array<float,2>{0.624740005f, 0.362530977f},
-std::array<float,2>{0.604295015f, 0.807904541f},
-std::array<float,2>{0.00624832744f, 0.163852245f},
-std::array<float,2>{0.386700451f, 0.605486929f},
-std::array<float,2>{0.953842998f, 0.325988442f},
-std::array<float,2>{0.766134739f, 0.724888861f},
-std::array<float,2>{0.296912253f, 0.477529913f},
-std::array<float,2>{0.171760663f, 0.928673327f},
-std::array<float,2>{0.639437973f, 0.056728147f},
-std::array<float,2>{0.703371286f, 0.518305361f},
-std::array<float,2>{0.22381705f, 0.276809126f},
-std::array<float,2>{0.3470276f, 0.866206646f},
-std::array<float,2>{0.82823348f, 0.24162212f},
-std::array<float,2>{0.876305878f, 0.958300292f},
-std::array<float,2>{0.471642196f, 0.11025615f},
-std::array<float,2>{0.0777766779f, 0.672063708f},
-std::array<float,2>{0.550356209f, 0.414877057f},
-std::array<float,2>{0.670165181f, 0.892088711f},
-std::array<float,2>{0.152030036f, 0.0247549526f},
-std::array<float,2>{0.272323966f, 0.704262078f},
-std::array<float,2>{0.791012228f, 0.448845953f},
-std::array<float,2>{0.975818753f, 0.587600172f},
-std::array<float,2>{0.434561193f, 0.355808675f},
-std::array<float,2>{0.0327798799f, 0.750124395f},
-std::array<float,2>{0.572008312f, 0.128249377f},
-std::array<float,2>{0.529561162f, 0.654063046f},
-std::array<float,2>{0.105896562f, 0.400986254f},
-std::array<float,2>{0.456966788f, 0.990381539f},
-std::array<float,2>{0.913709819f, 0.0660913438f},
-std::array<float,2>{0.849960804f, 0.82204473f},
-std::array<float,2>{0.314486802f, 0.21419093f},
-std::array<float,2>{0.191461861f, 0.541246653f},
-std::array<float,2>{0.727849722f, 0.287416369f},
-std::array<float,2>{0.631006062f, 0.759005427f},
-std::array<float,2>{0.159508169f, 0.136837423f},
-std::array<float,2>{0.306714594f, 0.585855484f},
-std::array<float,2>{0.778775334f, 0.349860728f},
-std::array<float,2>{0.966527939f, 0.714148462f},
-std::array<float,2>{0.377344608f, 0.44126457f},
-std::array<float,2>{0.0138815539f, 0.901903331f},
-std::array<float,2>{0.600663066f, 0.0231371447f},
-std::array<float,2>{0.55926007f, 0.537327349f},
-std::array<float,2>{0.0662763789f, 0.290009439f},
-std::array<float,2>{0.481863827f, 0.814794958f},
-std::array<float,2>{0.889746189f, 0.208058462f},
-std::array<float,2>{0.840987682f, 0.99410224f},
-std::array<float,2>{0.357647061f, 0.0747058168f},
-std::array<float,2>{0.232369184f, 0.646117389f},
-std::array<float,2>{0.716570795f, 0.397967994f},
-std::array<float,2>{0.563936651f, 0.935681462f},
-std::array<float,2>{0.0421925262f, 0.0495633185f},
-std::array<float,2>{0.427080959f, 0.734029353f},
-std::array<float,2>{0.980320394f, 0.472217083f},
-std::array<float,2>{0.784832835f, 0.598095536f},
-std::array<float,2>{0.276346296f, 0.316699475f},
-std::array<float,2>{0.141467854f, 0.800448239f},
-std::array<float,2>{0.659303963f, 0.165664181f},
-std::array<float,2>{0.72341758f, 0.6862638f},
-std::array<float,2>{0.199736983f, 0.411975324f},
-std::array<float,2>{0.322764665f, 0.968136191f},
-std::array<float,2>{0.854799926f, 0.118756898f},
-std::array<float,2>{0.918700218f, 0.870184124f},
-std::array<float,2>{0.467172325f, 0.247809127f},
-std::array<float,2>{0.0980115607f, 0.526094317f},
-std::array<float,2>{0.519127727f, 0.267724305f},
-std::array<float,2>{0.514633715f, 0.832431972f},
-std::array<float,2>{0.119824812f, 0.194913387f},
-std::array<float,2>{0.444965094f, 0.548926473f},
-std::array<float,2>{0.925563753f, 0.307714522f},
-std::array<float,2>{0.8670789f, 0.628470838f},
-std::array<float,2>{0.337603718f, 0.377821773f},
-std::array<float,2>{0.206553638f, 0.978319883f},
-std::array<float,2>{0.745731771f, 0.0792932138f},
-std::array<float,2>{0.683652341f, 0.574849963f},
-std::array<float,2>{0.125667736f, 0.369246989f},
-std::array<float,2>{0.250764728f, 0.780596197f},
-std::array<float,2>{0.796957791f, 0.153860867f},
-std::array<float,2>{0.997872055f, 0.8905195f},
-std::array<float,2>{0.409039795f, 0.0121909436f},
-std::array<float,2>{0.0525988266f, 0.68920207f},
-std::array<float,2>{0.579578936f, 0.455133379f},
-std::array<float,2>{0.701441944f, 0.941384077f},
-std::array<float,2>{0.236522391f, 0.0944668278f},
-std::array<float,2>{0.36394006f, 0.657815635f},
-std::array<float,2>{0.812769294f, 0.434004277f},
-std::array<float,2>{0.904618859f, 0.503479302f},
-std::array<float,2>{0.490852386f, 0.263824046f},
-std::array<float,2>{0.0794063434f, 0.851670504f},
-std::array<float,2>{0.540363729f, 0.234210253f},
-std::array<float,2>{0.613044381f, 0.735292494f},
-std::array<float,2>{0.0232001636f, 0.491557956f},
-std::array<float,2>{0.402765006f, 0.92047745f},
-std::array<float,2>{0.943012357f, 0.0463580526f},
-std::array<float,2>{0.754012585f, 0.782139063f},
-std::array<float,2>{0.288019657f, 0.185139075f},
-std::array<float,2>{0.175346717f, 0.619542539f},
-std::array<float,2>{0.642184675f, 0.33022067f},
-std::array<float,2>{0.719202042f, 0.771603703f},
-std::array<float,2>{0.197632357f, 0.146930277f},
-std::array<float,2>{0.327523798f, 0.564744532f},
-std::array<float,2>{0.85852623f, 0.363328785f},
-std::array<float,2>{0.916257977f, 0.699515462f},
-std::array<float,2>{0.46174252f, 0.467614114f},
-std::array<float,2>{0.0972397923f, 0.876368225f},
-std::array<float,2>{0.522897005f, 0.000847928866f},
-std::array<float,2>{0.566849232f, 0.55901587f},
-std::array<float,2>{0.0455667377f, 0.298831701f},
-std::array<float,2>{0.423230857f, 0.839084268f},
-std::array<float,2>{0.981356382f, 0.200804621f},
-std::array<float,2>{0.786550105f, 0.969537854f},
-std::array<float,2>{0.280067563f, 0.0886930227f},
-std::array<float,2>{0.145096302f, 0.636817634f},
-std::array<float,2>{0.660679579f, 0.388914436f},
-std::array<float,2>{0.557884932f, 0.911894739f},
-std::array<float,2>{0.0700386688f, 0.0383148119f},
-std::array<float,2>{0.478196889f, 0.745572805f},
-std::array<float,2>{0.885584116f, 0.499139458f},
-std::array<float,2>{0.837446272f, 0.610952377f},
-std::array<float,2>{0.355278164f, 0.341574579f},
-std::array<float,2>{0.229079053f, 0.79027003f},
-std::array<float,2>{0.71232301f, 0.175181001f},
-std::array<float,2>{0.627686441f, 0.670389354f},
-std::array<float,2>{0.162801981f, 0.422450483f},
-std::array<float,2>{0.310088038f, 0.951678574f},
-std::array<float,2>{0.775156081f, 0.103863068f},
-std::array<float,2>{0.962849915f, 0.848593175f},
-std::array<float,2>{0.379964203f, 0.220444128f},
-std::array<float,2>{0.00811363943f, 0.508933663f},
-std::array<float,2>{0.593949497f, 0.256274492f},
-std::array<float,2>{0.613902152f, 0.826708972f},
-std::array<float,2>{0.017497424f, 0.218006313f},
-std::array<float,2>{0.401032597f, 0.544550717f},
-std::array<float,2>{0.940374792f, 0.282595515f},
-std::array<float,2>{0.750745654f, 0.652098119f},
-std::array<float,2>{0.282330304f, 0.405583173f},
-std::array<float,2>{0.175836205f, 0.98456496f},
-std::array<float,2>{0.646939993f, 0.0665392801f},
-std::array<float,2>{0.697636902f, 0.591467917f},
-std::array<float,2>{0.240426287f, 0.352569848f},
-std::array<float,2>{0.362028956f, 0.754275858f},
-std::array<float,2>{0.817737281f, 0.129425958f},
-std::array<float,2>{0.899284601f, 0.896446109f},
-std::array<float,2>{0.48788029f, 0.0298340525f},
-std::array<float,2>{0.0825563669f, 0.710187674f},
-std::array<float,2>{0.546439588f, 0.452709824f},
-std::array<float,2>{0.680966318f, 0.955335557f},
-std::array<float,2>{0.131695256f, 0.114972301f},
-std::array<float,2>{0.255813122f, 0.679671705f},
-std::array<float,2>{0.804464221f, 0.418451101f},
-std::array<float,2>{0.995722115f, 0.523111224f},
-std::array<float,2>{0.413834363f, 0.280082881f},
-std::array<float,2>{0.0481298864f, 0.859403133f},
-std::array<float,2>{0.585484743f, 0.235841095f},
-std::array<float,2>{0.510021448f, 0.720067918f},
-std::array<float,2>{0.124840528f, 0.480635047f},
-std::array<float,2>{0.43815574f, 0.924837828f},
-std::array<float,2>{0.927190006f, 0.0621768385f},
-std::array<float,2>{0.860868752f, 0.812323809f},
-std::array<float,2>{0.340468794f, 0.157006621f},
-std::array<float,2>{0.210767046f, 0.603121817f},
-std::array<float,2>{0.748273551f, 0.321537942f},
-std::array<float,2>{0.654001415f, 0.873831987f},
-std::array<float,2>{0.185167789f, 0.2447128f},
-std::array<float,2>{0.290448368f, 0.527971208f},
-std::array<float,2>{0.75990051f, 0.273303986f},
-std::array<float,2>{0.951983631f, 0.680094361f},
-std::array<float,2>{0.395672798f, 0.407065064f},
-std::array<float,2>{0.0254775174f, 0.963981748f},
-std::array<float,2>{0.617579699f, 0.124778412f},
-std::array<float,2>{0.532431543f, 0.597641587f},
-std::array<float,2>{0.0861999169f, 0.314412773f},
-std::array<float,2>{0.498734534f, 0.802927673f},
-std::array<float,2>{0.890957355f, 0.171522155f},
-std::array<float,2>{0.823764682f, 0.933551133f},
-std::array<float,2>{0.374661446f, 0.0542496145f},
-std::array<float,2>{0.249497846f, 0.729883134f},
-std::array<float,2>{0.692998409f, 0.475165933f},
-std::array<float,2>{0.588309348f, 0.998941123f},
-std::array<float,2>{0.0569973253f, 0.0719303787f},
-std::array<float,2>{0.419289231f, 0.642903686f},
-std::array<float,2>{0.991584063f, 0.394160002f},
-std::array<float,2>{0.806835294f, 0.533073545f},
-std::array<float,2>{0.258499116f, 0.296116889f},
-std::array<float,2>{0.134459883f, 0.819927096f},
-std::array<float,2>{0.676480889f, 0.206176624f},
-std::array<float,2>{0.739376605f, 0.71682626f},
-std::array<float,2>{0.213018715f, 0.441663563f},
-std::array<float,2>{0.335364014f, 0.904905558f},
-std::array<float,2>{0.869610429f, 0.0161818918f},
-std::array<float,2>{0.932098091f, 0.763933182f},
-std::array<float,2>{0.449311256f, 0.13419117f},
-std::array<float,2>{0.112880655f, 0.580968022f},
-std::array<float,2>{0.505411386f, 0.34521395f},
-std::array<float,2>{0.527239442f, 0.785997033f},
-std::array<float,2>{0.102802806f, 0.18123357f},
-std::array<float,2>{0.457095236f, 0.624248087f},
-std::array<float,2>{0.906573892f, 0.33572638f},
-std::array<float,2>{0.845885634f, 0.740348399f},
-std::array<float,2>{0.317814112f, 0.484431684f},
-std::array<float,2>{0.190319523f, 0.915553451f},
-std::array<float,2>{0.731667519f, 0.0414957218f},
-std::array<float,2>{0.667557597f, 0.505352259f},
-std::array<float,2>{0.152665094f, 0.260888338f},
-std::array<float,2>{0.267659307f, 0.858592451f},
-std::array<float,2>{0.794622481f, 0.228899762f},
-std::array<float,2>{0.971536398f, 0.942675948f},
-std::array<float,2>{0.433012366f, 0.0997228622f},
-std::array<float,2>{0.0357592329f, 0.662696183f},
-std::array<float,2>{0.577382565f, 0.432144821f},
-std::array<float,2>{0.70894295f, 0.885695696f},
-std::array<float,2>{0.219465658f, 0.010185251f},
-std::array<float,2>{0.349660248f, 0.693342626f},
-std::array<float,2>{0.834051967f, 0.457325488f},
-std::array<float,2>{0.879758239f, 0.57332015f},
-std::array<float,2>{0.474917591f, 0.374585479f},
-std::array<float,2>{0.0736448169f, 0.776607096f},
-std::array<float,2>{0.554201007f, 0.148884922f},
-std::array<float,2>{0.605881035f, 0.630815029f},
-std::array<float,2>{0.00302105932f, 0.380695224f},
-std::array<float,2>{0.389172286f, 0.980685711f},
-std::array<float,2>{0.960616589f, 0.0830498412f},
-std::array<float,2>{0.769782543f, 0.831580818f},
-std::array<float,2>{0.303157657f, 0.188483015f},
-std::array<float,2>{0.165686265f, 0.554448247f},
-std::array<float,2>{0.633426368f, 0.309704512f},
-std::array<float,2>{0.689243376f, 0.839946866f},
-std::array<float,2>{0.243975267f, 0.195665509f},
-std::array<float,2>{0.37045899f, 0.555367172f},
-std::array<float,2>{0.826936066f, 0.304406673f},
-std::array<float,2>{0.895068884f, 0.635389805f},
-std::array<float,2>{0.493555129f, 0.386335194f},
-std::array<float,2>{0.0905520543f, 0.975361168f},
-std::array<float,2>{0.535705268f, 0.0922807977f},
-std::array<float,2>{0.621416569f, 0.567329824f},
-std::array<float,2>{0.0292045828f, 0.360501319f},
-std::array<float,2>{0.394388139f, 0.766151071f},
-std::array<float,2>{0.947240114f, 0.142019719f},
-std::array<float,2>{0.762202561f, 0.878925979f},
-std::array<float,2>{0.296131253f, 0.00549376151f},
-std::array<float,2>{0.181203663f, 0.695908725f},
-std::array<float,2>{0.64982605f, 0.461332142f},
-std::array<float,2>{0.500036657f, 0.947820783f},
-std::array<float,2>{0.115242653f, 0.108112827f},
-std::array<float,2>{0.447522014f, 0.666664183f},
-std::array<float,2>{0.935301185f, 0.426502198f},
-std::array<float,2>{0.874343693f, 0.514362633f},
-std::array<float,2>{0.330674022f, 0.25285399f},
-std::array<float,2>{0.217621982f, 0.846388519f},
-std::array<float,2>{0.737116873f, 0.223527968f},
-std::array<float,2>{0.675413907f, 0.747104824f},
-std::array<float,2>{0.139986411f, 0.49257043f},
-std::array<float,2>{0.265236229f, 0.907475591f},
-std::array<float,2>{0.809472024f, 0.0337517336f},
-std::array<float,2>{0.988000691f, 0.796410561f},
-std::array<float,2>{0.415753275f, 0.179577887f},
-std::array<float,2>{0.0594524592f, 0.615764976f},
-std::array<float,2>{0.593140721f, 0.339793354f},
-std::array<float,2>{0.573443115f, 0.752874613f},
-std::array<float,2>{0.0337491482f, 0.125347003f},
-std::array<float,2>{0.436299682f, 0.58968693f},
-std::array<float,2>{0.973448157f, 0.358100176f},
-std::array<float,2>{0.791116416f, 0.705537975f},
-std::array<float,2>{0.270227134f, 0.446594685f},
-std::array<float,2>{0.150325298f, 0.893782437f},
-std::array<float,2>{0.668442667f, 0.0263818447f},
-std::array<float,2>{0.729912639f, 0.539785981f},
-std::array<float,2>{0.194923267f, 0.28694883f},
-std::array<float,2>{0.313334376f, 0.822443962f},
-std::array<float,2>{0.848732054f, 0.21206139f},
-std::array<float,2>{0.911549389f, 0.989410818f},
-std::array<float,2>{0.453137815f, 0.0640951917f},
-std::array<float,2>{0.10896156f, 0.654740691f},
-std::array<float,2>{0.528305709f, 0.399496824f},
-std::array<float,2>{0.638441145f, 0.927599072f},
-std::array<float,2>{0.168272421f, 0.0559491962f},
-std::array<float,2>{0.299257398f, 0.72460115f},
-std::array<float,2>{0.768877506f, 0.479634464f},
-std::array<float,2>{0.956478655f, 0.608287692f},
-std::array<float,2>{0.383499831f, 0.327171564f},
-std::array<float,2>{0.00406151079f, 0.80589819f},
-std::array<float,2>{0.602189064f, 0.161672115f},
-std::array<float,2>{0.548818469f, 0.674869776f},
-std::array<float,2>{0.0760810524f, 0.417756081f},
-std::array<float,2>{0.470486164f, 0.960134983f},
-std::array<float,2>{0.877170444f, 0.111880817f},
-std::array<float,2>{0.831499815f, 0.864435017f},
-std::array<float,2>{0.345342636f, 0.238957718f},
-std::array<float,2>{0.226060644f, 0.517341435f},
-std::array<float,2>{0.706418037f, 0.274495482f},
-std::array<float,2>{0.657195628f, 0.798735976f},
-std::array<float,2>{0.144063264f, 0.166323438f},
-std::array<float,2>{0.273932397f, 0.600901902f},
-std::array<float,2>{0.782418311f, 0.319011748f},
-std::array<float,2>{0.976668298f, 0.731814027f},
-std::array<float,2>{0.428183407f, 0.469044924f},
-std::array<float,2>{0.0407198966f, 0.933634579f},
-std::array<float,2>{0.565282166f, 0.048679851f},
-std::array<float,2>{0.515898943f, 0.524399459f},
-std::array<float,2>{0.100531623f, 0.266724855f},
-std::array<float,2>{0.465111017f, 0.868460536f},
-std::array<float,2>{0.9200809f, 0.249755368f},
-std::array<float,2>{0.852037191f, 0.965637326f},
-std::array<float,2>{0.321751595f, 0.120421261f},
-std::array<float,2>{0.20304139f, 0.685340703f},
-std::array<float,2>{0.726521313f, 0.412400097f},
-std::array<float,2>{0.59895426f, 0.899708927f},
-std::array<float,2>{0.0120663671f, 0.0208752174f},
-std::array<float,2>{0.376156658f, 0.712451875f},
-std::array<float,2>{0.968099356f, 0.4384785f},
-std::array<float,2>{0.779655218f, 0.582300186f},
-std::array<float,2>{0.306473702f, 0.349207729f},
-std::array<float,2>{0.156727865f, 0.761059046f},
-std::array<float,2>{0.629880667f, 0.140018418f},
-std::array<float,2>{0.717869461f, 0.64803952f},
-std::array<float,2>{0.232832238f, 0.394886613f},
-std::array<float,2>{0.356034338f, 0.996090651f},
-std::array<float,2>{0.841971993f, 0.0780587122f},
-std::array<float,2>{0.887454033f, 0.814063191f},
-std::array<float,2>{0.483614475f, 0.210162535f},
-std::array<float,2>{0.0628439039f, 0.535366476f},
-std::array<float,2>{0.561681509f, 0.292641997f},
-std::array<float,2>{0.541900456f, 0.854806542f},
-std::array<float,2>{0.081804812f, 0.231337607f},
-std::array<float,2>{0.488560438f, 0.501027822f},
-std::array<float,2>{0.904228687f, 0.262658715f},
-std::array<float,2>{0.81478709f, 0.659362853f},
-std::array<float,2>{0.366279334f, 0.436289847f},
-std::array<float,2>{0.234859258f, 0.938148439f},
-std::array<float,2>{0.700309634f, 0.0957297087f},
-std::array<float,2>{0.643118262f, 0.6184026f},
-std::array<float,2>{0.172448829f, 0.330033243f},
-std::array<float,2>{0.285404623f, 0.784422696f},
-std::array<float,2>{0.756845295f, 0.186356112f},
-std::array<float,2>{0.944206536f, 0.918168843f},
-std::array<float,2>{0.406124562f, 0.0447842404f},
-std::array<float,2>{0.0202163439f, 0.737609446f},
-std::array<float,2>{0.610230803f, 0.489788055f},
-std::array<float,2>{0.742996037f, 0.979359508f},
-std::array<float,2>{0.203858033f, 0.0815408155f},
-std::array<float,2>{0.338530451f, 0.62661165f},
-std::array<float,2>{0.864798009f, 0.375358015f},
-std::array<float,2>{0.923116565f, 0.54794389f},
-std::array<float,2>{0.442535371f, 0.305184484f},
-std::array<float,2>{0.1190795f, 0.8351143f},
-std::array<float,2>{0.513671577f, 0.192736536f},
-std::array<float,2>{0.580233395f, 0.690590858f},
-std::array<float,2>{0.0540919453f, 0.453374237f},
-std::array<float,2>{0.407714665f, 0.887699544f},
-std::array<float,2>{0.999176681f, 0.0138801849f},
-std::array<float,2>{0.799080431f, 0.777532279f},
-std::array<float,2>{0.253738075f, 0.155210271f},
-std::array<float,2>{0.128178418f, 0.576442122f},
-std::array<float,2>{0.686965287f, 0.368050575f},
-std::array<float,2>{0.709560931f, 0.776899576f},
-std::array<float,2>{0.222625181f, 0.149227127f},
-std::array<float,2>{0.349132448f, 0.574055254f},
-std::array<float,2>{0.833049536f, 0.374274284f},
-std::array<float,2>{0.881046772f, 0.692600369f},
-std::array<float,2>{0.473562747f, 0.458004713f},
-std::array<float,2>{0.0711385682f, 0.884815454f},
-std::array<float,2>{0.550855398f, 0.0106956968f},
-std::array<float,2>{0.608764708f, 0.553759992f},
-std::array<float,2>{0.00111501629f, 0.310359985f},
-std::array<float,2>{0.388655365f, 0.831262767f},
-std::array<float,2>{0.957223654f, 0.189143196f},
-std::array<float,2>{0.771563351f, 0.981386006f},
-std::array<float,2>{0.301306695f, 0.0838881806f},
-std::array<float,2>{0.16713272f, 0.62993449f},
-std::array<float,2>{0.635876119f, 0.380047739f},
-std::array<float,2>{0.524944603f, 0.915517807f},
-std::array<float,2>{0.103836745f, 0.0417808034f},
-std::array<float,2>{0.459342897f, 0.741196275f},
-std::array<float,2>{0.909567416f, 0.485170722f},
-std::array<float,2>{0.84496218f, 0.624916315f},
-std::array<float,2>{0.318667501f, 0.335219204f},
-std::array<float,2>{0.188790426f, 0.785376668f},
-std::array<float,2>{0.733689904f, 0.180951953f},
-std::array<float,2>{0.665855229f, 0.662506819f},
-std::array<float,2>{0.155496001f, 0.4319897f},
-std::array<float,2>{0.267541468f, 0.942928433f},
-std::array<float,2>{0.79533726f, 0.100336805f},
-std::array<float,2>{0.970536888f, 0.859048903f},
-std::array<float,2>{0.430639267f, 0.229231134f},
-std::array<float,2>{0.0383294486f, 0.505508959f},
-std::array<float,2>{0.575346708f, 0.261321038f},
-std::array<float,2>{0.585960031f, 0.819761276f},
-std::array<float,2>{0.0555678792f, 0.2070041f},
-std::array<float,2>{0.420578718f, 0.532436192f},
-std::array<float,2>{0.989535928f, 0.296857715f},
-std::array<float,2>{0.805269122f, 0.643226087f},
-std::array<float,2>{0.260370672f, 0.393669665f},
-std::array<float,2>{0.135044605f, 0.998312771f},
-std::array<float,2>{0.677836776f, 0.0714528114f},
-std::array<float,2>{0.741146803f, 0.580183268f},
-std::array<float,2>{0.211724132f, 0.345499933f},
-std::array<float,2>{0.333705038f, 0.764535785f},
-std::array<float,2>{0.868496954f, 0.134488359f},
-std::array<float,2>{0.92971766f, 0.904348254f},
-std::array<float,2>{0.451789051f, 0.0159952529f},
-std::array<float,2>{0.109471694f, 0.717433274f},
-std::array<float,2>{0.507131875f, 0.442249596f},
-std::array<float,2>{0.655654311f, 0.964416146f},
-std::array<float,2>{0.187258199f, 0.124505594f},
-std::array<float,2>{0.292611778f, 0.680525899f},
-std::array<float,2>{0.759128511f, 0.406374574f},
-std::array<float,2>{0.95040524f, 0.52769959f},
-std::array<float,2>{0.39717859f, 0.272601187f},
-std::array<float,2>{0.0239018891f, 0.873181224f},
-std::array<float,2>{0.620787919f, 0.24451454f},
-std::array<float,2>{0.533586621f, 0.730055153f},
-std::array<float,2>{0.0893247202f, 0.474626482f},
-std::array<float,2>{0.496802688f, 0.932617724f},
-std::array<float,2>{0.894457161f, 0.0537495874f},
-std::array<float,2>{0.822004676f, 0.803448856f},
-std::array<float,2>{0.372612894f, 0.171023801f},
-std::array<float,2>{0.247960269f, 0.596865952f},
-std::array<float,2>{0.694301784f, 0.313760638f},
-std::array<float,2>{0.68183744f, 0.860032976f},
-std::array<float,2>{0.129569292f, 0.235368252f},
-std::array<float,2>{0.25613144f, 0.522682607f},
-std::array<float,2>{0.801387727f, 0.279665202f},
-std::array<float,2>{0.993938208f, 0.679122984f},
-std::array<float,2>{0.411552489f, 0.418585598f},
-std::array<float,2>{0.0492016673f, 0.955930829f},
-std::array<float,2>{0.582714319f, 0.114585772f},
-std::array<float,2>{0.508083403f, 0.602967858f},
-std::array<float,2>{0.122162007f, 0.32222563f},
-std::array<float,2>{0.441180289f, 0.811789155f},
-std::array<float,2>{0.928623855f, 0.15634118f},
-std::array<float,2>{0.861489415f, 0.925697148f},
-std::array<float,2>{0.343230486f, 0.0616119727f},
-std::array<float,2>{0.208721265f, 0.720362902f},
-std::array<float,2>{0.746537805f, 0.481085002f},
-std::array<float,2>{0.615309834f, 0.985178709f},
-std::array<float,2>{0.01792337f, 0.0672461987f},
-std::array<float,2>{0.398530573f, 0.651691616f},
-std::array<float,2>{0.938254237f, 0.405809283f},
-std::array<float,2>{0.752307653f, 0.544160426f},
-std::array<float,2>{0.285076618f, 0.282745808f},
-std::array<float,2>{0.179053813f, 0.826328933f},
-std::array<float,2>{0.645301044f, 0.218608096f},
-std::array<float,2>{0.696847498f, 0.710924566f},
-std::array<float,2>{0.239531323f, 0.452229172f},
-std::array<float,2>{0.359558791f, 0.895510137f},
-std::array<float,2>{0.819725633f, 0.0296309255f},
-std::array<float,2>{0.900969803f, 0.754575014f},
-std::array<float,2>{0.486276716f, 0.129050478f},
-std::array<float,2>{0.0851600245f, 0.591196835f},
-std::array<float,2>{0.543147564f, 0.353300035f},
-std::array<float,2>{0.556129813f, 0.790879011f},
-std::array<float,2>{0.0666369423f, 0.175642282f},
-std::array<float,2>{0.478940636f, 0.610424519f},
-std::array<float,2>{0.882840037f, 0.341276407f},
-std::array<float,2>{0.838528931f, 0.745702863f},
-std::array<float,2>{0.353434354f, 0.499637991f},
-std::array<float,2>{0.227398828f, 0.911489129f},
-std::array<float,2>{0.714330614f, 0.0387095213f},
-std::array<float,2>{0.625285208f, 0.509607613f},
-std::array<float,2>{0.160647288f, 0.256545156f},
-std::array<float,2>{0.31215325f, 0.847670674f},
-std::array<float,2>{0.776744187f, 0.21989578f},
-std::array<float,2>{0.963931561f, 0.951391757f},
-std::array<float,2>{0.382662833f, 0.104087591f},
-std::array<float,2>{0.0115387579f, 0.670850754f},
-std::array<float,2>{0.595812201f, 0.4218795f},
-std::array<float,2>{0.722468734f, 0.876857996f},
-std::array<float,2>{0.19718571f, 0.000196018998f},
-std::array<float,2>{0.325768262f, 0.699845433f},
-std::array<float,2>{0.855552495f, 0.467122704f},
-std::array<float,2>{0.914989054f, 0.564946115f},
-std::array<float,2>{0.463222951f, 0.364171594f},
-std::array<float,2>{0.0938273147f, 0.771983087f},
-std::array<float,2>{0.520843387f, 0.147257924f},
-std::array<float,2>{0.568956435f, 0.637456179f},
-std::array<float,2>{0.0447125472f, 0.389165223f},
-std::array<float,2>{0.425236881f, 0.968945503f},
-std::array<float,2>{0.982573986f, 0.0881388113f},
-std::array<float,2>{0.78765893f, 0.839757383f},
-std::array<float,2>{0.27799651f, 0.200510293f},
-std::array<float,2>{0.147719815f, 0.559345841f},
-std::array<float,2>{0.662652612f, 0.299386561f},
-std::array<float,2>{0.745458841f, 0.835671723f},
-std::array<float,2>{0.206239969f, 0.193063244f},
-std::array<float,2>{0.337129116f, 0.548368096f},
-std::array<float,2>{0.866386652f, 0.304872274f},
-std::array<float,2>{0.9250862f, 0.626320899f},
-std::array<float,2>{0.444346488f, 0.375573695f},
-std::array<float,2>{0.119337671f, 0.978693128f},
-std::array<float,2>{0.513915181f, 0.081631951f},
-std::array<float,2>{0.579775095f, 0.576840401f},
-std::array<float,2>{0.0521458238f, 0.367365032f},
-std::array<float,2>{0.408456922f, 0.778076351f},
-std::array<float,2>{0.997268796f, 0.154513597f},
-std::array<float,2>{0.797761202f, 0.888342559f},
-std::array<float,2>{0.25017038f, 0.0143050198f},
-std::array<float,2>{0.1254161f, 0.691046357f},
-std::array<float,2>{0.684462965f, 0.453774869f},
-std::array<float,2>{0.540556908f, 0.937611401f},
-std::array<float,2>{0.0798222423f, 0.0965463296f},
-std::array<float,2>{0.49025026f, 0.660037637f},
-std::array<float,2>{0.905087531f, 0.435772061f},
-std::array<float,2>{0.81330198f, 0.501599193f},
-std::array<float,2>{0.363764614f, 0.261751413f},
-std::array<float,2>{0.237147823f, 0.855106652f},
-std::array<float,2>{0.701896131f, 0.23084414f},
-std::array<float,2>{0.641960263f, 0.737894416f},
-std::array<float,2>{0.175098598f, 0.489266366f},
-std::array<float,2>{0.287389547f, 0.918897569f},
-std::array<float,2>{0.754492223f, 0.0444046184f},
-std::array<float,2>{0.942604005f, 0.784872949f},
-std::array<float,2>{0.403174639f, 0.185654491f},
-std::array<float,2>{0.0227252413f, 0.618843615f},
-std::array<float,2>{0.612614572f, 0.329520524f},
-std::array<float,2>{0.601383269f, 0.761345208f},
-std::array<float,2>{0.0144278537f, 0.14015156f},
-std::array<float,2>{0.377481669f, 0.582602918f},
-std::array<float,2>{0.966076136f, 0.348657489f},
-std::array<float,2>{0.779289007f, 0.711927831f},
-std::array<float,2>{0.30754593f, 0.439283788f},
-std::array<float,2>{0.159781009f, 0.900226831f},
-std::array<float,2>{0.631382823f, 0.0211085882f},
-std::array<float,2>{0.716109931f, 0.535821497f},
-std::array<float,2>{0.231727883f, 0.292468786f},
-std::array<float,2>{0.35819903f, 0.813782394f},
-std::array<float,2>{0.841364741f, 0.210755423f},
-std::array<float,2>{0.890361249f, 0.995598197f},
-std::array<float,2>{0.482240677f, 0.0775339231f},
-std::array<float,2>{0.0654313043f, 0.647610843f},
-std::array<float,2>{0.558851779f, 0.395169884f},
-std::array<float,2>{0.659752429f, 0.934312642f},
-std::array<float,2>{0.140865549f, 0.0481706858f},
-std::array<float,2>{0.275653809f, 0.732330441f},
-std::array<float,2>{0.784368515f, 0.469657272f},
-std::array<float,2>{0.979623497f, 0.601337075f},
-std::array<float,2>{0.427579165f, 0.318541586f},
-std::array<float,2>{0.0425997674f, 0.797942877f},
-std::array<float,2>{0.564315498f, 0.166879565f},
-std::array<float,2>{0.518920183f, 0.684597611f},
-std::array<float,2>{0.0984815657f, 0.412723869f},
-std::array<float,2>{0.467307657f, 0.965307236f},
-std::array<float,2>{0.918399274f, 0.120728366f},
-std::array<float,2>{0.855290771f, 0.868715167f},
-std::array<float,2>{0.322564274f, 0.249460816f},
-std::array<float,2>{0.199240059f, 0.523837686f},
-std::array<float,2>{0.722964764f, 0.267457664f},
-std::array<float,2>{0.638674796f, 0.806360483f},
-std::array<float,2>{0.171101853f, 0.161316499f},
-std::array<float,2>{0.297752142f, 0.607893348f},
-std::array<float,2>{0.76573956f, 0.327971071f},
-std::array<float,2>{0.953498006f, 0.723791599f},
-std::array<float,2>{0.385916293f, 0.480383307f},
-std::array<float,2>{0.0064987517f, 0.927152216f},
-std::array<float,2>{0.603521645f, 0.056229502f},
-std::array<float,2>{0.550169885f, 0.516919434f},
-std::array<float,2>{0.077503413f, 0.275162369f},
-std::array<float,2>{0.470861495f, 0.865013182f},
-std::array<float,2>{0.876711965f, 0.238425165f},
-std::array<float,2>{0.828823924f, 0.960814178f},
-std::array<float,2>{0.347526222f, 0.111377403f},
-std::array<float,2>{0.224415869f, 0.675620556f},
-std::array<float,2>{0.703934908f, 0.41720134f},
-std::array<float,2>{0.571764052f, 0.894381881f},
-std::array<float,2>{0.0324314572f, 0.0269903019f},
-std::array<float,2>{0.433892578f, 0.705880582f},
-std::array<float,2>{0.976200044f, 0.447246641f},
-std::array<float,2>{0.790220797f, 0.589125037f},
-std::array<float,2>{0.271500975f, 0.357714415f},
-std::array<float,2>{0.151624948f, 0.752278745f},
-std::array<float,2>{0.670811713f, 0.125902772f},
-std::array<float,2>{0.728235185f, 0.654908001f},
-std::array<float,2>{0.191997036f, 0.400159955f},
-std::array<float,2>{0.315313637f, 0.990225554f},
-std::array<float,2>{0.850235224f, 0.0635835454f},
-std::array<float,2>{0.913384199f, 0.822780252f},
-std::array<float,2>{0.456434488f, 0.212828502f},
-std::array<float,2>{0.106023401f, 0.539302289f},
-std::array<float,2>{0.530196726f, 0.286236197f},
-std::array<float,2>{0.50239867f, 0.845877707f},
-std::array<float,2>{0.114280276f, 0.222796679f},
-std::array<float,2>{0.44542852f, 0.514144182f},
-std::array<float,2>{0.935812771f, 0.25220561f},
-std::array<float,2>{0.872861981f, 0.666213751f},
-std::array<float,2>{0.328825891f, 0.426012516f},
-std::array<float,2>{0.215869948f, 0.947393417f},
-std::array<float,2>{0.735141575f, 0.107821248f},
-std::array<float,2>{0.673607469f, 0.615713835f},
-std::array<float,2>{0.137477338f, 0.339266181f},
-std::array<float,2>{0.262814522f, 0.795965433f},
-std::array<float,2>{0.810823739f, 0.17892541f},
-std::array<float,2>{0.985189974f, 0.90803355f},
-std::array<float,2>{0.416921198f, 0.0333764777f},
-std::array<float,2>{0.0609569289f, 0.747848451f},
-std::array<float,2>{0.590015769f, 0.493148029f},
-std::array<float,2>{0.690184176f, 0.975002706f},
-std::array<float,2>{0.245161042f, 0.0924254879f},
-std::array<float,2>{0.368023604f, 0.635132849f},
-std::array<float,2>{0.825781226f, 0.386007607f},
-std::array<float,2>{0.896563411f, 0.555041671f},
-std::array<float,2>{0.494336486f, 0.304146737f},
-std::array<float,2>{0.0936297253f, 0.840441167f},
-std::array<float,2>{0.538288414f, 0.195861265f},
-std::array<float,2>{0.624292552f, 0.695435822f},
-std::array<float,2>{0.0294774212f, 0.461704522f},
-std::array<float,2>{0.391361654f, 0.879637659f},
-std::array<float,2>{0.947539568f, 0.00519772014f},
-std::array<float,2>{0.764816344f, 0.765855014f},
-std::array<float,2>{0.293469757f, 0.142170861f},
-std::array<float,2>{0.181677252f, 0.566620708f},
-std::array<float,2>{0.650453448f, 0.361079603f},
-std::array<float,2>{0.73205483f, 0.78774482f},
-std::array<float,2>{0.189841509f, 0.183240443f},
-std::array<float,2>{0.31814754f, 0.621224284f},
-std::array<float,2>{0.846319497f, 0.333539307f},
-std::array<float,2>{0.906781435f, 0.739207208f},
-std::array<float,2>{0.457526863f, 0.487204075f},
-std::array<float,2>{0.103492282f, 0.916143775f},
-std::array<float,2>{0.526504517f, 0.0403492786f},
-std::array<float,2>{0.577811122f, 0.507778049f},
-std::array<float,2>{0.0352891348f, 0.259687096f},
-std::array<float,2>{0.433493167f, 0.857343972f},
-std::array<float,2>{0.970888793f, 0.227644056f},
-std::array<float,2>{0.794328034f, 0.94345808f},
-std::array<float,2>{0.268408358f, 0.0991125628f},
-std::array<float,2>{0.152953342f, 0.660759747f},
-std::array<float,2>{0.667143524f, 0.43163681f},
-std::array<float,2>{0.554191649f, 0.883194506f},
-std::array<float,2>{0.073844865f, 0.00890578423f},
-std::array<float,2>{0.475404531f, 0.694113851f},
-std::array<float,2>{0.879122853f, 0.459964126f},
-std::array<float,2>{0.834863007f, 0.571244597f},
-std::array<float,2>{0.350453824f, 0.371360958f},
-std::array<float,2>{0.218870193f, 0.774538219f},
-std::array<float,2>{0.708164036f, 0.151154265f},
-std::array<float,2>{0.633023858f, 0.631130993f},
-std::array<float,2>{0.165499046f, 0.382218897f},
-std::array<float,2>{0.303533345f, 0.982498229f},
-std::array<float,2>{0.770324588f, 0.0854516476f},
-std::array<float,2>{0.960362196f, 0.829304159f},
-std::array<float,2>{0.388806701f, 0.191308647f},
-std::array<float,2>{0.00389755843f, 0.551659286f},
-std::array<float,2>{0.606376588f, 0.311955512f},
-std::array<float,2>{0.617915809f, 0.872281075f},
-std::array<float,2>{0.0263190381f, 0.242753118f},
-std::array<float,2>{0.39626193f, 0.531239688f},
-std::array<float,2>{0.951618552f, 0.270383388f},
-std::array<float,2>{0.760728598f, 0.682955861f},
-std::array<float,2>{0.2910088f, 0.409513354f},
-std::array<float,2>{0.184987932f, 0.96142453f},
-std::array<float,2>{0.653784931f, 0.121150516f},
-std::array<float,2>{0.692523479f, 0.59506911f},
-std::array<float,2>{0.249914289f, 0.316395879f},
-std::array<float,2>{0.374193758f, 0.801503956f},
-std::array<float,2>{0.823312402f, 0.169377103f},
-std::array<float,2>{0.891433775f, 0.931215107f},
-std::array<float,2>{0.498048127f, 0.0521519445f},
-std::array<float,2>{0.0866765603f, 0.727694988f},
-std::array<float,2>{0.532904327f, 0.474022627f},
-std::array<float,2>{0.67581445f, 0.997154832f},
-std::array<float,2>{0.134158924f, 0.0725025758f},
-std::array<float,2>{0.257996172f, 0.641932487f},
-std::array<float,2>{0.807579696f, 0.39127171f},
-std::array<float,2>{0.991740882f, 0.5347054f},
-std::array<float,2>{0.419655085f, 0.293127835f},
-std::array<float,2>{0.0574441627f, 0.818271995f},
-std::array<float,2>{0.588846862f, 0.204181105f},
-std::array<float,2>{0.505345941f, 0.715869963f},
-std::array<float,2>{0.112389229f, 0.443737566f},
-std::array<float,2>{0.449991643f, 0.903764904f},
-std::array<float,2>{0.932354212f, 0.0193475299f},
-std::array<float,2>{0.870088041f, 0.762369215f},
-std::array<float,2>{0.335766286f, 0.134898141f},
-std::array<float,2>{0.213675514f, 0.579671383f},
-std::array<float,2>{0.739953458f, 0.346762061f},
-std::array<float,2>{0.646992981f, 0.825111806f},
-std::array<float,2>{0.176535934f, 0.215064541f},
-std::array<float,2>{0.283146888f, 0.545634985f},
-std::array<float,2>{0.750084817f, 0.283423156f},
-std::array<float,2>{0.939476132f, 0.64928627f},
-std::array<float,2>{0.400395781f, 0.402472347f},
-std::array<float,2>{0.0166471303f, 0.987657607f},
-std::array<float,2>{0.613465011f, 0.0690353811f},
-std::array<float,2>{0.545978606f, 0.593577981f},
-std::array<float,2>{0.0824067146f, 0.355403244f},
-std::array<float,2>{0.487314165f, 0.75772357f},
-std::array<float,2>{0.898774087f, 0.13164565f},
-std::array<float,2>{0.81825614f, 0.896516383f},
-std::array<float,2>{0.361563712f, 0.028254468f},
-std::array<float,2>{0.241167381f, 0.708554268f},
-std::array<float,2>{0.697955489f, 0.450991392f},
-std::array<float,2>{0.585135639f, 0.954324305f},
-std::array<float,2>{0.0487873182f, 0.115648322f},
-std::array<float,2>{0.413216084f, 0.676113725f},
-std::array<float,2>{0.995245337f, 0.421294749f},
-std::array<float,2>{0.803758144f, 0.520958841f},
-std::array<float,2>{0.254974037f, 0.278309137f},
-std::array<float,2>{0.131229728f, 0.862175226f},
-std::array<float,2>{0.681178391f, 0.23736617f},
-std::array<float,2>{0.748563647f, 0.722573102f},
-std::array<float,2>{0.210404277f, 0.482544959f},
-std::array<float,2>{0.339989185f, 0.923062503f},
-std::array<float,2>{0.86062479f, 0.0600773916f},
-std::array<float,2>{0.927622914f, 0.809041023f},
-std::array<float,2>{0.437793016f, 0.160021871f},
-std::array<float,2>{0.124350272f, 0.603541136f},
-std::array<float,2>{0.510348737f, 0.323902965f},
-std::array<float,2>{0.523294985f, 0.769708335f},
-std::array<float,2>{0.0967331231f, 0.145041764f},
-std::array<float,2>{0.461193323f, 0.564046323f},
-std::array<float,2>{0.916983664f, 0.366855651f},
-std::array<float,2>{0.859181166f, 0.701384366f},
-std::array<float,2>{0.328056663f, 0.465053141f},
-std::array<float,2>{0.197857708f, 0.877760589f},
-std::array<float,2>{0.719472289f, 0.00343235023f},
-std::array<float,2>{0.660533965f, 0.561053753f},
-std::array<float,2>{0.144852445f, 0.297556013f},
-std::array<float,2>{0.279312611f, 0.8374542f},
-std::array<float,2>{0.786701798f, 0.202524513f},
-std::array<float,2>{0.980796456f, 0.972476244f},
-std::array<float,2>{0.423713297f, 0.0865519345f},
-std::array<float,2>{0.0452594385f, 0.63914001f},
-std::array<float,2>{0.567314148f, 0.387451351f},
-std::array<float,2>{0.712450147f, 0.912812293f},
-std::array<float,2>{0.228670835f, 0.0352057666f},
-std::array<float,2>{0.35488224f, 0.743478835f},
-std::array<float,2>{0.83716923f, 0.497849673f},
-std::array<float,2>{0.884879887f, 0.611506224f},
-std::array<float,2>{0.477676243f, 0.342679948f},
-std::array<float,2>{0.0694272667f, 0.791039824f},
-std::array<float,2>{0.558139324f, 0.172410935f},
-std::array<float,2>{0.594527006f, 0.669037104f},
-std::array<float,2>{0.0083268648f, 0.42544663f},
-std::array<float,2>{0.380805463f, 0.949339092f},
-std::array<float,2>{0.962081194f, 0.101704143f},
-std::array<float,2>{0.774559796f, 0.851235807f},
-std::array<float,2>{0.309620082f, 0.220825881f},
-std::array<float,2>{0.162186429f, 0.510008991f},
-std::array<float,2>{0.627286375f, 0.254390687f},
-std::array<float,2>{0.701033831f, 0.852425337f},
-std::array<float,2>{0.235010728f, 0.233445197f},
-std::array<float,2>{0.367050409f, 0.503269851f},
-std::array<float,2>{0.815165102f, 0.264165699f},
-std::array<float,2>{0.90347445f, 0.657683849f},
-std::array<float,2>{0.489079118f, 0.434255779f},
-std::array<float,2>{0.0810998306f, 0.940878332f},
-std::array<float,2>{0.541296959f, 0.0941250548f},
-std::array<float,2>{0.609484971f, 0.61965245f},
-std::array<float,2>{0.0196813289f, 0.330942035f},
-std::array<float,2>{0.405425787f, 0.781441569f},
-std::array<float,2>{0.94365114f, 0.184882164f},
-std::array<float,2>{0.757605731f, 0.919959366f},
-std::array<float,2>{0.286109567f, 0.0465368666f},
-std::array<float,2>{0.172053292f, 0.734737635f},
-std::array<float,2>{0.642660558f, 0.49190709f},
-std::array<float,2>{0.512861848f, 0.977924764f},
-std::array<float,2>{0.118168421f, 0.0798120424f},
-std::array<float,2>{0.442990333f, 0.628227234f},
-std::array<float,2>{0.923476756f, 0.37730518f},
-std::array<float,2>{0.864644408f, 0.549630761f},
-std::array<float,2>{0.338071644f, 0.308127284f},
-std::array<float,2>{0.203256562f, 0.832535505f},
-std::array<float,2>{0.742238462f, 0.19457902f},
-std::array<float,2>{0.687049031f, 0.688750625f},
-std::array<float,2>{0.128564402f, 0.455768555f},
-std::array<float,2>{0.253190279f, 0.890052617f},
-std::array<float,2>{0.799338758f, 0.012551262f},
-std::array<float,2>{0.999638975f, 0.781003475f},
-std::array<float,2>{0.408199281f, 0.15365696f},
-std::array<float,2>{0.0545143038f, 0.574306726f},
-std::array<float,2>{0.58080864f, 0.369723648f},
-std::array<float,2>{0.564505637f, 0.800233781f},
-std::array<float,2>{0.0402529165f, 0.165106058f},
-std::array<float,2>{0.428338736f, 0.598441482f},
-std::array<float,2>{0.977172136f, 0.316913009f},
-std::array<float,2>{0.783078849f, 0.733503878f},
-std::array<float,2>{0.27369222f, 0.471821755f},
-std::array<float,2>{0.143945694f, 0.936100543f},
-std::array<float,2>{0.656300366f, 0.0491957478f},
-std::array<float,2>{0.725799382f, 0.525582969f},
-std::array<float,2>{0.202593431f, 0.268492341f},
-std::array<float,2>{0.321990907f, 0.870635331f},
-std::array<float,2>{0.852519929f, 0.247315452f},
-std::array<float,2>{0.920846939f, 0.968537331f},
-std::array<float,2>{0.465560794f, 0.118652143f},
-std::array<float,2>{0.0997348577f, 0.685638964f},
-std::array<float,2>{0.516585767f, 0.411173135f},
-std::array<float,2>{0.629132211f, 0.901403606f},
-std::array<float,2>{0.156989112f, 0.0227084067f},
-std::array<float,2>{0.306089044f, 0.714835405f},
-std::array<float,2>{0.780237436f, 0.440545499f},
-std::array<float,2>{0.968682528f, 0.585333765f},
-std::array<float,2>{0.37675941f, 0.350388944f},
-std::array<float,2>{0.0123651661f, 0.759341598f},
-std::array<float,2>{0.599446058f, 0.137674212f},
-std::array<float,2>{0.562013328f, 0.645736933f},
-std::array<float,2>{0.0633629486f, 0.397526503f},
-std::array<float,2>{0.4839046f, 0.993635714f},
-std::array<float,2>{0.88681072f, 0.0750820115f},
-std::array<float,2>{0.842711031f, 0.815095246f},
-std::array<float,2>{0.355738938f, 0.208566591f},
-std::array<float,2>{0.233151719f, 0.538071513f},
-std::array<float,2>{0.71835047f, 0.289155751f},
-std::array<float,2>{0.66883713f, 0.750701129f},
-std::array<float,2>{0.149826214f, 0.128432304f},
-std::array<float,2>{0.26997152f, 0.587002873f},
-std::array<float,2>{0.791902125f, 0.356413782f},
-std::array<float,2>{0.97282654f, 0.704771996f},
-std::array<float,2>{0.435924202f, 0.44858411f},
-std::array<float,2>{0.0333691165f, 0.892453551f},
-std::array<float,2>{0.573731542f, 0.0253244694f},
-std::array<float,2>{0.527418673f, 0.541970849f},
-std::array<float,2>{0.10842333f, 0.288081616f},
-std::array<float,2>{0.453635275f, 0.821513295f},
-std::array<float,2>{0.912099123f, 0.214406222f},
-std::array<float,2>{0.849593759f, 0.991084397f},
-std::array<float,2>{0.312541693f, 0.065849863f},
-std::array<float,2>{0.194440991f, 0.653348565f},
-std::array<float,2>{0.730037212f, 0.400473744f},
-std::array<float,2>{0.601661861f, 0.928144574f},
-std::array<float,2>{0.00468087941f, 0.0574538521f},
-std::array<float,2>{0.382857114f, 0.7251001f},
-std::array<float,2>{0.956874132f, 0.476592422f},
-std::array<float,2>{0.769432008f, 0.606042027f},
-std::array<float,2>{0.299566656f, 0.325412482f},
-std::array<float,2>{0.168887645f, 0.808436453f},
-std::array<float,2>{0.637978673f, 0.163430646f},
-std::array<float,2>{0.706779778f, 0.6725384f},
-std::array<float,2>{0.226552829f, 0.414262742f},
-std::array<float,2>{0.344823182f, 0.958973706f},
-std::array<float,2>{0.831892192f, 0.109699465f},
-std::array<float,2>{0.877604902f, 0.865297198f},
-std::array<float,2>{0.470071912f, 0.241882369f},
-std::array<float,2>{0.0752435476f, 0.517907798f},
-std::array<float,2>{0.548230231f, 0.27701202f},
-std::array<float,2>{0.535387516f, 0.842334807f},
-std::array<float,2>{0.0901749358f, 0.198354587f},
-std::array<float,2>{0.49388957f, 0.55779779f},
-std::array<float,2>{0.894588947f, 0.302371264f},
-std::array<float,2>{0.826327741f, 0.633872449f},
-std::array<float,2>{0.371003479f, 0.383398503f},
-std::array<float,2>{0.243481621f, 0.974024475f},
-std::array<float,2>{0.688631415f, 0.0915899426f},
-std::array<float,2>{0.649966419f, 0.569438457f},
-std::array<float,2>{0.181108102f, 0.362829f},
-std::array<float,2>{0.296790004f, 0.769235432f},
-std::array<float,2>{0.762244701f, 0.144395635f},
-std::array<float,2>{0.946401f, 0.881045163f},
-std::array<float,2>{0.393865019f, 0.0061161546f},
-std::array<float,2>{0.0284082554f, 0.699026823f},
-std::array<float,2>{0.622042179f, 0.464715332f},
-std::array<float,2>{0.736661196f, 0.945604205f},
-std::array<float,2>{0.216934487f, 0.105984688f},
-std::array<float,2>{0.330354273f, 0.665874958f},
-std::array<float,2>{0.874824882f, 0.427918881f},
-std::array<float,2>{0.934701681f, 0.511953413f},
-std::array<float,2>{0.447808564f, 0.250806272f},
-std::array<float,2>{0.116162002f, 0.844346702f},
-std::array<float,2>{0.500601709f, 0.224640518f},
-std::array<float,2>{0.593596458f, 0.748228908f},
-std::array<float,2>{0.0588912219f, 0.4948484f},
-std::array<float,2>{0.415519774f, 0.908562064f},
-std::array<float,2>{0.987570047f, 0.0327118337f},
-std::array<float,2>{0.80894351f, 0.793153346f},
-std::array<float,2>{0.264851332f, 0.176578686f},
-std::array<float,2>{0.140595123f, 0.614917874f},
-std::array<float,2>{0.675191522f, 0.336492151f},
-std::array<float,2>{0.694746971f, 0.802113891f},
-std::array<float,2>{0.246879786f, 0.16798839f},
-std::array<float,2>{0.371720254f, 0.594649613f},
-std::array<float,2>{0.82101953f, 0.31515345f},
-std::array<float,2>{0.893181264f, 0.726585627f},
-std::array<float,2>{0.497828633f, 0.473240435f},
-std::array<float,2>{0.0882459879f, 0.9302513f},
-std::array<float,2>{0.535111487f, 0.0512493327f},
-std::array<float,2>{0.619891167f, 0.529954851f},
-std::array<float,2>{0.0249485485f, 0.271326214f},
-std::array<float,2>{0.398420155f, 0.871947587f},
-std::array<float,2>{0.949283779f, 0.243399024f},
-std::array<float,2>{0.758130312f, 0.962809324f},
-std::array<float,2>{0.291485459f, 0.123008728f},
-std::array<float,2>{0.185792327f, 0.681715488f},
-std::array<float,2>{0.654542625f, 0.408402503f},
-std::array<float,2>{0.50592643f, 0.902461708f},
-std::array<float,2>{0.110835381f, 0.0176671501f},
-std::array<float,2>{0.452354133f, 0.715640128f},
-std::array<float,2>{0.930823982f, 0.444648176f},
-std::array<float,2>{0.867425919f, 0.57840997f},
-std::array<float,2>{0.332726926f, 0.346617669f},
-std::array<float,2>{0.212363988f, 0.762839675f},
-std::array<float,2>{0.7421211f, 0.135742933f},
-std::array<float,2>{0.67923665f, 0.64079833f},
-std::array<float,2>{0.13603735f, 0.392564386f},
-std::array<float,2>{0.261341453f, 0.996844351f},
-std::array<float,2>{0.806554735f, 0.0738445744f},
-std::array<float,2>{0.989214897f, 0.816716015f},
-std::array<float,2>{0.421111315f, 0.203994811f},
-std::array<float,2>{0.0558322109f, 0.533839107f},
-std::array<float,2>{0.587487102f, 0.294258863f},
-std::array<float,2>{0.574705362f, 0.856314003f},
-std::array<float,2>{0.0373842157f, 0.226590157f},
-std::array<float,2>{0.431198567f, 0.506631434f},
-std::array<float,2>{0.96937871f, 0.258458704f},
-std::array<float,2>{0.796299756f, 0.661691248f},
-std::array<float,2>{0.265832514f, 0.430058092f},
-std::array<float,2>{0.154376447f, 0.945248842f},
-std::array<float,2>{0.664321661f, 0.0977877006f},
-std::array<float,2>{0.732915819f, 0.622854471f},
-std::array<float,2>{0.188439474f, 0.332270861f},
-std::array<float,2>{0.319869876f, 0.788401902f},
-std::array<float,2>{0.844329774f, 0.182151839f},
-std::array<float,2>{0.908554852f, 0.91725409f},
-std::array<float,2>{0.460324764f, 0.0396020152f},
-std::array<float,2>{0.105146997f, 0.739455104f},
-std::array<float,2>{0.523705006f, 0.488025784f},
-std::array<float,2>{0.635319769f, 0.983404279f},
-std::array<float,2>{0.166081771f, 0.0845151544f},
-std::array<float,2>{0.302646041f, 0.632666767f},
-std::array<float,2>{0.772859991f, 0.381522536f},
-std::array<float,2>{0.958604336f, 0.552558959f},
-std::array<float,2>{0.387386918f, 0.311257899f},
-std::array<float,2>{0.000714773836f, 0.828967392f},
-std::array<float,2>{0.607822061f, 0.190280393f},
-std::array<float,2>{0.5519225f, 0.694487572f},
-std::array<float,2>{0.0715921074f, 0.459793389f},
-std::array<float,2>{0.474300474f, 0.883865237f},
-std::array<float,2>{0.882128954f, 0.00855004415f},
-std::array<float,2>{0.832153976f, 0.773808897f},
-std::array<float,2>{0.347896129f, 0.152057841f},
-std::array<float,2>{0.221311122f, 0.571804941f},
-std::array<float,2>{0.710158765f, 0.372439444f},
-std::array<float,2>{0.663220823f, 0.835937917f},
-std::array<float,2>{0.147109583f, 0.201613143f},
-std::array<float,2>{0.278668523f, 0.562074423f},
-std::array<float,2>{0.788698792f, 0.29871133f},
-std::array<float,2>{0.983876109f, 0.640288234f},
-std::array<float,2>{0.424712002f, 0.388508052f},
-std::array<float,2>{0.0434281081f, 0.971376479f},
-std::array<float,2>{0.570243418f, 0.0876005888f},
-std::array<float,2>{0.519881129f, 0.56335777f},
-std::array<float,2>{0.0948318392f, 0.366062731f},
-std::array<float,2>{0.463960737f, 0.771382451f},
-std::array<float,2>{0.915566266f, 0.145647153f},
-std::array<float,2>{0.856609643f, 0.878862619f},
-std::array<float,2>{0.324816704f, 0.00226537511f},
-std::array<float,2>{0.196134105f, 0.702598691f},
-std::array<float,2>{0.721010387f, 0.466145933f},
-std::array<float,2>{0.597216785f, 0.950696468f},
-std::array<float,2>{0.00996817928f, 0.103372425f},
-std::array<float,2>{0.381663561f, 0.668872178f},
-std::array<float,2>{0.963450134f, 0.424153686f},
-std::array<float,2>{0.775843859f, 0.511466384f},
-std::array<float,2>{0.31118837f, 0.255101562f},
-std::array<float,2>{0.161466837f, 0.850414395f},
-std::array<float,2>{0.626867056f, 0.222317338f},
-std::array<float,2>{0.713229954f, 0.74250406f},
-std::array<float,2>{0.227681756f, 0.496921331f},
-std::array<float,2>{0.351629883f, 0.91370672f},
-std::array<float,2>{0.839209676f, 0.0363274775f},
-std::array<float,2>{0.884091616f, 0.792767406f},
-std::array<float,2>{0.480089933f, 0.173808053f},
-std::array<float,2>{0.0679645538f, 0.612978637f},
-std::array<float,2>{0.555121303f, 0.343175381f},
-std::array<float,2>{0.544853628f, 0.756326079f},
-std::array<float,2>{0.0843797326f, 0.131941751f},
-std::array<float,2>{0.484583467f, 0.591829836f},
-std::array<float,2>{0.902156591f, 0.354044855f},
-std::array<float,2>{0.818959892f, 0.707385063f},
-std::array<float,2>{0.361075133f, 0.449604779f},
-std::array<float,2>{0.238836452f, 0.898147881f},
-std::array<float,2>{0.695340574f, 0.0288614687f},
-std::array<float,2>{0.646270573f, 0.545962751f},
-std::array<float,2>{0.177749351f, 0.284818083f},
-std::array<float,2>{0.283709437f, 0.825878561f},
-std::array<float,2>{0.753726542f, 0.216111675f},
-std::array<float,2>{0.939381242f, 0.987080574f},
-std::array<float,2>{0.400042892f, 0.0697369576f},
-std::array<float,2>{0.0187726393f, 0.65026778f},
-std::array<float,2>{0.616556942f, 0.403468877f},
-std::array<float,2>{0.747110069f, 0.922291875f},
-std::array<float,2>{0.20799832f, 0.0590717308f},
-std::array<float,2>{0.341975331f, 0.721474946f},
-std::array<float,2>{0.862562299f, 0.48430118f},
-std::array<float,2>{0.928831458f, 0.604948282f},
-std::array<float,2>{0.440011591f, 0.322313577f},
-std::array<float,2>{0.121623442f, 0.809661388f},
-std::array<float,2>{0.509610415f, 0.159124672f},
-std::array<float,2>{0.583224595f, 0.677520394f},
-std::array<float,2>{0.0506248213f, 0.420300364f},
-std::array<float,2>{0.411089659f, 0.953665614f},
-std::array<float,2>{0.992369652f, 0.11699082f},
-std::array<float,2>{0.802009761f, 0.862442911f},
-std::array<float,2>{0.257412136f, 0.23665306f},
-std::array<float,2>{0.130289495f, 0.519820333f},
-std::array<float,2>{0.683033288f, 0.279261023f},
-std::array<float,2>{0.723819137f, 0.869946063f},
-std::array<float,2>{0.201084554f, 0.246324331f},
-std::array<float,2>{0.323960245f, 0.526603758f},
-std::array<float,2>{0.85355103f, 0.269242585f},
-std::array<float,2>{0.919542909f, 0.687432706f},
-std::array<float,2>{0.468146205f, 0.410613596f},
-std::array<float,2>{0.0988728404f, 0.967398047f},
-std::array<float,2>{0.517988026f, 0.117325269f},
-std::array<float,2>{0.56307739f, 0.599210858f},
-std::array<float,2>{0.0417134166f, 0.317833662f},
-std::array<float,2>{0.426656365f, 0.799515188f},
-std::array<float,2>{0.978633642f, 0.164394915f},
-std::array<float,2>{0.783327997f, 0.93671447f},
-std::array<float,2>{0.27729091f, 0.0504612252f},
-std::array<float,2>{0.142475083f, 0.733158588f},
-std::array<float,2>{0.659062147f, 0.47121048f},
-std::array<float,2>{0.55999893f, 0.993009388f},
-std::array<float,2>{0.0645410269f, 0.0761238635f},
-std::array<float,2>{0.480785012f, 0.645240545f},
-std::array<float,2>{0.889647126f, 0.396673858f},
-std::array<float,2>{0.840483785f, 0.538144052f},
-std::array<float,2>{0.358457357f, 0.290586233f},
-std::array<float,2>{0.231213927f, 0.81620872f},
-std::array<float,2>{0.715666413f, 0.207056984f},
-std::array<float,2>{0.632620037f, 0.71326375f},
-std::array<float,2>{0.158450648f, 0.43972683f},
-std::array<float,2>{0.30847919f, 0.900957882f},
-std::array<float,2>{0.777906895f, 0.0220764764f},
-std::array<float,2>{0.965069234f, 0.758223355f},
-std::array<float,2>{0.378773034f, 0.138429448f},
-std::array<float,2>{0.0154258963f, 0.584007442f},
-std::array<float,2>{0.59999311f, 0.350631982f},
-std::array<float,2>{0.612069726f, 0.782391667f},
-std::array<float,2>{0.0223082043f, 0.18381381f},
-std::array<float,2>{0.404117286f, 0.620218992f},
-std::array<float,2>{0.942241251f, 0.331345052f},
-std::array<float,2>{0.755632877f, 0.736230314f},
-std::array<float,2>{0.288418353f, 0.49024716f},
-std::array<float,2>{0.173915222f, 0.921234906f},
-std::array<float,2>{0.641052127f, 0.045849748f},
-std::array<float,2>{0.702821732f, 0.502224267f},
-std::array<float,2>{0.237942204f, 0.264751643f},
-std::array<float,2>{0.364597321f, 0.852997839f},
-std::array<float,2>{0.813973606f, 0.233356372f},
-std::array<float,2>{0.906202734f, 0.940332711f},
-std::array<float,2>{0.492007256f, 0.0951883271f},
-std::array<float,2>{0.0785908774f, 0.656329215f},
-std::array<float,2>{0.539572001f, 0.435202628f},
-std::array<float,2>{0.684839725f, 0.888763368f},
-std::array<float,2>{0.126405701f, 0.0129218241f},
-std::array<float,2>{0.251286924f, 0.687926829f},
-std::array<float,2>{0.798320174f, 0.456847072f},
-std::array<float,2>{0.997034609f, 0.575642288f},
-std::array<float,2>{0.409499854f, 0.370709211f},
-std::array<float,2>{0.0515891574f, 0.779940188f},
-std::array<float,2>{0.578453779f, 0.152719185f},
-std::array<float,2>{0.515128016f, 0.62749809f},
-std::array<float,2>{0.120637745f, 0.378473401f},
-std::array<float,2>{0.443531722f, 0.976750433f},
-std::array<float,2>{0.923912346f, 0.0789522901f},
-std::array<float,2>{0.86619848f, 0.833208442f},
-std::array<float,2>{0.336380571f, 0.193793833f},
-std::array<float,2>{0.205834255f, 0.550382614f},
-std::array<float,2>{0.744175375f, 0.306810677f},
-std::array<float,2>{0.652142942f, 0.767768741f},
-std::array<float,2>{0.182816356f, 0.143089846f},
-std::array<float,2>{0.294261307f, 0.5687989f},
-std::array<float,2>{0.763697565f, 0.36169517f},
-std::array<float,2>{0.948954344f, 0.697647452f},
-std::array<float,2>{0.391618729f, 0.463319212f},
-std::array<float,2>{0.0310185924f, 0.882375598f},
-std::array<float,2>{0.623273849f, 0.00775709096f},
-std::array<float,2>{0.53801316f, 0.557378531f},
-std::array<float,2>{0.0921011195f, 0.301667541f},
-std::array<float,2>{0.4954696f, 0.842904985f},
-std::array<float,2>{0.898068309f, 0.197919592f},
-std::array<float,2>{0.824353039f, 0.972825825f},
-std::array<float,2>{0.368564487f, 0.0907455236f},
-std::array<float,2>{0.245006472f, 0.633519471f},
-std::array<float,2>{0.69055289f, 0.38399151f},
-std::array<float,2>{0.590933025f, 0.910077393f},
-std::array<float,2>{0.0619035959f, 0.0314990245f},
-std::array<float,2>{0.417322189f, 0.749639273f},
-std::array<float,2>{0.986318588f, 0.495154858f},
-std::array<float,2>{0.812044263f, 0.614082277f},
-std::array<float,2>{0.261885256f, 0.337302625f},
-std::array<float,2>{0.137750104f, 0.794642866f},
-std::array<float,2>{0.672448575f, 0.176952273f},
-std::array<float,2>{0.735727012f, 0.664366543f},
-std::array<float,2>{0.215009972f, 0.429421961f},
-std::array<float,2>{0.32920292f, 0.946705341f},
-std::array<float,2>{0.87122792f, 0.106989466f},
-std::array<float,2>{0.936690331f, 0.844895065f},
-std::array<float,2>{0.446478397f, 0.226220384f},
-std::array<float,2>{0.113755412f, 0.513467371f},
-std::array<float,2>{0.503319442f, 0.251490206f},
-std::array<float,2>{0.530399323f, 0.820401073f},
-std::array<float,2>{0.107151762f, 0.213499755f},
-std::array<float,2>{0.455202788f, 0.542944133f},
-std::array<float,2>{0.912611246f, 0.288592815f},
-std::array<float,2>{0.850755692f, 0.653192043f},
-std::array<float,2>{0.316314638f, 0.401676446f},
-std::array<float,2>{0.193249911f, 0.992159367f},
-std::array<float,2>{0.727096558f, 0.0650947243f},
-std::array<float,2>{0.670999944f, 0.58627528f},
-std::array<float,2>{0.150504738f, 0.356624246f},
-std::array<float,2>{0.272561729f, 0.751084805f},
-std::array<float,2>{0.789697409f, 0.127421871f},
-std::array<float,2>{0.975406289f, 0.891536653f},
-std::array<float,2>{0.435409814f, 0.0241312981f},
-std::array<float,2>{0.0313995779f, 0.703646958f},
-std::array<float,2>{0.570915282f, 0.448123038f},
-std::array<float,2>{0.704132855f, 0.957784474f},
-std::array<float,2>{0.223211929f, 0.111318111f},
-std::array<float,2>{0.346157134f, 0.673823714f},
-std::array<float,2>{0.829714358f, 0.415346473f},
-std::array<float,2>{0.875244915f, 0.519285977f},
-std::array<float,2>{0.471866786f, 0.276159078f},
-std::array<float,2>{0.0768155456f, 0.866759777f},
-std::array<float,2>{0.54932344f, 0.240909129f},
-std::array<float,2>{0.605218887f, 0.726495743f},
-std::array<float,2>{0.00711573008f, 0.478310466f},
-std::array<float,2>{0.385472924f, 0.928900063f},
-std::array<float,2>{0.954947889f, 0.0582413077f},
-std::array<float,2>{0.767034113f, 0.807004869f},
-std::array<float,2>{0.298822969f, 0.162765801f},
-std::array<float,2>{0.170373783f, 0.606724501f},
-std::array<float,2>{0.640433311f, 0.325166315f},
-std::array<float,2>{0.738928735f, 0.765593469f},
-std::array<float,2>{0.214261681f, 0.133344159f},
-std::array<float,2>{0.334511071f, 0.581775784f},
-std::array<float,2>{0.870420277f, 0.344501883f},
-std::array<float,2>{0.932702422f, 0.718551457f},
-std::array<float,2>{0.451062649f, 0.443042129f},
-std::array<float,2>{0.111808524f, 0.905976236f},
-std::array<float,2>{0.504830599f, 0.0172384195f},
-std::array<float,2>{0.58900404f, 0.531408787f},
-std::array<float,2>{0.0580600314f, 0.295344323f},
-std::array<float,2>{0.418303728f, 0.818680346f},
-std::array<float,2>{0.990801096f, 0.205953971f},
-std::array<float,2>{0.808423221f, 0.999486744f},
-std::array<float,2>{0.259465337f, 0.0712042078f},
-std::array<float,2>{0.133776978f, 0.644372761f},
-std::array<float,2>{0.677310646f, 0.393192887f},
-std::array<float,2>{0.532201886f, 0.93261075f},
-std::array<float,2>{0.0871665329f, 0.0531033501f},
-std::array<float,2>{0.499929965f, 0.728730023f},
-std::array<float,2>{0.892241657f, 0.476534605f},
-std::array<float,2>{0.822367549f, 0.595785201f},
-std::array<float,2>{0.373513788f, 0.312755048f},
-std::array<float,2>{0.248341411f, 0.804022133f},
-std::array<float,2>{0.691802442f, 0.170620948f},
-std::array<float,2>{0.65254885f, 0.681000471f},
-std::array<float,2>{0.183986872f, 0.407418042f},
-std::array<float,2>{0.289385974f, 0.963053584f},
-std::array<float,2>{0.761263371f, 0.123523287f},
-std::array<float,2>{0.953101516f, 0.874424875f},
-std::array<float,2>{0.39530465f, 0.245905638f},
-std::array<float,2>{0.0266736876f, 0.528760493f},
-std::array<float,2>{0.619085968f, 0.271572948f},
-std::array<float,2>{0.606471419f, 0.830244899f},
-std::array<float,2>{0.00247878954f, 0.188452229f},
-std::array<float,2>{0.390170813f, 0.553185225f},
-std::array<float,2>{0.95900321f, 0.309450954f},
-std::array<float,2>{0.77054894f, 0.629412413f},
-std::array<float,2>{0.304462314f, 0.3797777f},
-std::array<float,2>{0.164891854f, 0.981743634f},
-std::array<float,2>{0.63405174f, 0.0825864673f},
-std::array<float,2>{0.707502782f, 0.572773397f},
-std::array<float,2>{0.220109344f, 0.373070329f},
-std::array<float,2>{0.351523995f, 0.776094913f},
-std::array<float,2>{0.83540982f, 0.149692655f},
-std::array<float,2>{0.880472839f, 0.886279345f},
-std::array<float,2>{0.475782067f, 0.0116322497f},
-std::array<float,2>{0.0726557821f, 0.691543162f},
-std::array<float,2>{0.553292871f, 0.45836252f},
-std::array<float,2>{0.666807115f, 0.942060411f},
-std::array<float,2>{0.153723016f, 0.101314045f},
-std::array<float,2>{0.269039452f, 0.663717031f},
-std::array<float,2>{0.79303515f, 0.433194101f},
-std::array<float,2>{0.971767366f, 0.504520833f},
-std::array<float,2>{0.432145506f, 0.260299653f},
-std::array<float,2>{0.0362778381f, 0.857523918f},
-std::array<float,2>{0.577070475f, 0.229639649f},
-std::array<float,2>{0.526318014f, 0.742096364f},
-std::array<float,2>{0.10169486f, 0.486102194f},
-std::array<float,2>{0.458169878f, 0.914176166f},
-std::array<float,2>{0.908185184f, 0.042078983f},
-std::array<float,2>{0.846805215f, 0.786927104f},
-std::array<float,2>{0.317330122f, 0.179879978f},
-std::array<float,2>{0.190841481f, 0.623955548f},
-std::array<float,2>{0.730691373f, 0.334927499f},
-std::array<float,2>{0.628618598f, 0.84869343f},
-std::array<float,2>{0.163463682f, 0.219179824f},
-std::array<float,2>{0.309064448f, 0.508405685f},
-std::array<float,2>{0.774404168f, 0.257064879f},
-std::array<float,2>{0.961340487f, 0.671546459f},
-std::array<float,2>{0.378992498f, 0.423409104f},
-std::array<float,2>{0.00886500441f, 0.952776074f},
-std::array<float,2>{0.595687091f, 0.104528174f},
-std::array<float,2>{0.557436109f, 0.60973829f},
-std::array<float,2>{0.0693302602f, 0.340293586f},
-std::array<float,2>{0.476865113f, 0.789329469f},
-std::array<float,2>{0.886417091f, 0.174590498f},
-std::array<float,2>{0.836121678f, 0.911044776f},
-std::array<float,2>{0.353775024f, 0.037641041f},
-std::array<float,2>{0.229920536f, 0.744373083f},
-std::array<float,2>{0.711622417f, 0.498220891f},
-std::array<float,2>{0.568356037f, 0.970347941f},
-std::array<float,2>{0.0460711457f, 0.08908429f},
-std::array<float,2>{0.422091007f, 0.638620555f},
-std::array<float,2>{0.981715024f, 0.389934808f},
-std::array<float,2>{0.785448194f, 0.560512185f},
-std::array<float,2>{0.280337781f, 0.300401956f},
-std::array<float,2>{0.146191567f, 0.838028312f},
-std::array<float,2>{0.661928535f, 0.199326381f},
-std::array<float,2>{0.720143318f, 0.700356126f},
-std::array<float,2>{0.19854179f, 0.468186796f},
-std::array<float,2>{0.326699615f, 0.875373423f},
-std::array<float,2>{0.857538223f, 0.00110486429f},
-std::array<float,2>{0.917465925f, 0.77292192f},
-std::array<float,2>{0.462179899f, 0.14749597f},
-std::array<float,2>{0.0959138721f, 0.566137671f},
-std::array<float,2>{0.52224499f, 0.364288241f},
-std::array<float,2>{0.511038184f, 0.811025321f},
-std::array<float,2>{0.123085305f, 0.157997146f},
-std::array<float,2>{0.439385653f, 0.602532983f},
-std::array<float,2>{0.92630589f, 0.320812196f},
-std::array<float,2>{0.859447777f, 0.719629765f},
-std::array<float,2>{0.340886325f, 0.481878728f},
-std::array<float,2>{0.209950984f, 0.924683571f},
-std::array<float,2>{0.749723554f, 0.0612886548f},
-std::array<float,2>{0.680188179f, 0.52186799f},
-std::array<float,2>{0.132264867f, 0.281200111f},
-std::array<float,2>{0.254246414f, 0.860916555f},
-std::array<float,2>{0.803395152f, 0.234710932f},
-std::array<float,2>{0.995093167f, 0.956577301f},
-std::array<float,2>{0.41217798f, 0.113704175f},
-std::array<float,2>{0.0474271625f, 0.678602099f},
-std::array<float,2>{0.584599018f, 0.419371247f},
-std::array<float,2>{0.698369026f, 0.894637525f},
-std::array<float,2>{0.241705641f, 0.0308725107f},
-std::array<float,2>{0.363098562f, 0.709747434f},
-std::array<float,2>{0.816560507f, 0.451823413f},
-std::array<float,2>{0.899479032f, 0.589883149f},
-std::array<float,2>{0.487201542f, 0.352246881f},
-std::array<float,2>{0.0834499523f, 0.754890561f},
-std::array<float,2>{0.545553863f, 0.130529702f},
-std::array<float,2>{0.614951372f, 0.650466502f},
-std::array<float,2>{0.0157162175f, 0.404307991f},
-std::array<float,2>{0.401708543f, 0.985430598f},
-std::array<float,2>{0.940860569f, 0.0680950955f},
-std::array<float,2>{0.751508713f, 0.827579677f},
-std::array<float,2>{0.282203913f, 0.217584357f},
-std::array<float,2>{0.176777005f, 0.54312402f},
-std::array<float,2>{0.648185432f, 0.281658769f},
-std::array<float,2>{0.717708528f, 0.813352227f},
-std::array<float,2>{0.234142244f, 0.20922929f},
-std::array<float,2>{0.357031286f, 0.536718071f},
-std::array<float,2>{0.843336761f, 0.291641891f},
-std::array<float,2>{0.888053656f, 0.646701753f},
-std::array<float,2>{0.483055204f, 0.396384686f},
-std::array<float,2>{0.0635489002f, 0.995038569f},
-std::array<float,2>{0.561333895f, 0.0770538524f},
-std::array<float,2>{0.597883701f, 0.583361328f},
-std::array<float,2>{0.0131414821f, 0.34853819f},
-std::array<float,2>{0.375305861f, 0.759991825f},
-std::array<float,2>{0.96702826f, 0.139181584f},
-std::array<float,2>{0.78122437f, 0.899327993f},
-std::array<float,2>{0.305383176f, 0.019711161f},
-std::array<float,2>{0.157312423f, 0.71158576f},
-std::array<float,2>{0.630479813f, 0.438345164f},
-std::array<float,2>{0.516839266f, 0.966794908f},
-std::array<float,2>{0.100811057f, 0.119919807f},
-std::array<float,2>{0.465934634f, 0.683912456f},
-std::array<float,2>{0.92128849f, 0.413924783f},
-std::array<float,2>{0.852842867f, 0.525069535f},
-std::array<float,2>{0.320314318f, 0.265817374f},
-std::array<float,2>{0.201587081f, 0.867427111f},
-std::array<float,2>{0.725048661f, 0.248928413f},
-std::array<float,2>{0.657887757f, 0.731206179f},
-std::array<float,2>{0.142965272f, 0.470016062f},
-std::array<float,2>{0.27474609f, 0.935155332f},
-std::array<float,2>{0.781855345f, 0.04741285f},
-std::array<float,2>{0.978462815f, 0.797071218f},
-std::array<float,2>{0.428914428f, 0.167201459f},
-std::array<float,2>{0.0397336408f, 0.599711597f},
-std::array<float,2>{0.565922022f, 0.319353878f},
-std::array<float,2>{0.581363499f, 0.778598547f},
-std::array<float,2>{0.0532215089f, 0.155535534f},
-std::array<float,2>{0.406596929f, 0.578026295f},
-std::array<float,2>{0.998066127f, 0.368223161f},
-std::array<float,2>{0.800509989f, 0.689782083f},
-std::array<float,2>{0.252015501f, 0.454428494f},
-std::array<float,2>{0.127413139f, 0.887256324f},
-std::array<float,2>{0.685694695f, 0.0149087561f},
-std::array<float,2>{0.74409616f, 0.54707396f},
-std::array<float,2>{0.204460382f, 0.305931985f},
-std::array<float,2>{0.339173824f, 0.834862649f},
-std::array<float,2>{0.864202499f, 0.192162544f},
-std::array<float,2>{0.922127903f, 0.979852498f},
-std::array<float,2>{0.442317247f, 0.0804341957f},
-std::array<float,2>{0.117546558f, 0.625506103f},
-std::array<float,2>{0.511817276f, 0.376724988f},
-std::array<float,2>{0.644139767f, 0.919476032f},
-std::array<float,2>{0.17354627f, 0.0438997373f},
-std::array<float,2>{0.286426753f, 0.737154901f},
-std::array<float,2>{0.756476283f, 0.48844853f},
-std::array<float,2>{0.944666207f, 0.617730618f},
-std::array<float,2>{0.404371738f, 0.328131586f},
-std::array<float,2>{0.0206637457f, 0.783355772f},
-std::array<float,2>{0.611211956f, 0.186684728f},
-std::array<float,2>{0.542867184f, 0.658547878f},
-std::array<float,2>{0.0808558315f, 0.437412858f},
-std::array<float,2>{0.489551246f, 0.9385252f},
-std::array<float,2>{0.902608871f, 0.0975105613f},
-std::array<float,2>{0.815928936f, 0.853676796f},
-std::array<float,2>{0.365255177f, 0.232105494f},
-std::array<float,2>{0.235748887f, 0.500450194f},
-std::array<float,2>{0.699248791f, 0.262881041f},
-std::array<float,2>{0.674621224f, 0.795463622f},
-std::array<float,2>{0.1386967f, 0.178594232f},
-std::array<float,2>{0.264636964f, 0.616557717f},
-std::array<float,2>{0.810329437f, 0.338319808f},
-std::array<float,2>{0.986562014f, 0.746607482f},
-std::array<float,2>{0.41415441f, 0.493406653f},
-std::array<float,2>{0.0600718819f, 0.907155216f},
-std::array<float,2>{0.592373729f, 0.0345424227f},
-std::array<float,2>{0.501906991f, 0.515372574f},
-std::array<float,2>{0.116348363f, 0.253749192f},
-std::array<float,2>{0.449019253f, 0.846953869f},
-std::array<float,2>{0.933878303f, 0.224468604f},
-std::array<float,2>{0.873370409f, 0.948268712f},
-std::array<float,2>{0.331345558f, 0.108896971f},
-std::array<float,2>{0.218522936f, 0.667479038f},
-std::array<float,2>{0.737584352f, 0.42760253f},
-std::array<float,2>{0.622789741f, 0.880176127f},
-std::array<float,2>{0.027877504f, 0.00472814776f},
-std::array<float,2>{0.393214405f, 0.697022498f},
-std::array<float,2>{0.945484459f, 0.462291658f},
-std::array<float,2>{0.763486445f, 0.567870677f},
-std::array<float,2>{0.295859009f, 0.359982073f},
-std::array<float,2>{0.180201173f, 0.767121911f},
-std::array<float,2>{0.648747385f, 0.141505525f},
-std::array<float,2>{0.687544405f, 0.63598901f},
-std::array<float,2>{0.242282823f, 0.384860247f},
-std::array<float,2>{0.369662195f, 0.97618264f},
-std::array<float,2>{0.827895224f, 0.092999272f},
-std::array<float,2>{0.895705163f, 0.841271162f},
-std::array<float,2>{0.492378592f, 0.196377322f},
-std::array<float,2>{0.091298528f, 0.556000233f},
-std::array<float,2>{0.536276758f, 0.303530842f},
-std::array<float,2>{0.547112107f, 0.863693178f},
-std::array<float,2>{0.0747185275f, 0.239669964f},
-std::array<float,2>{0.469211519f, 0.516569436f},
-std::array<float,2>{0.878735006f, 0.273891598f},
-std::array<float,2>{0.830455601f, 0.674570143f},
-std::array<float,2>{0.344406068f, 0.416668653f},
-std::array<float,2>{0.224632531f, 0.959547102f},
-std::array<float,2>{0.705485523f, 0.112732463f},
-std::array<float,2>{0.636873901f, 0.608430743f},
-std::array<float,2>{0.169056997f, 0.326865792f},
-std::array<float,2>{0.300738633f, 0.804939806f},
-std::array<float,2>{0.768387735f, 0.160996884f},
-std::array<float,2>{0.955247879f, 0.926236153f},
-std::array<float,2>{0.383901894f, 0.0556216426f},
-std::array<float,2>{0.0057736747f, 0.72353971f},
-std::array<float,2>{0.603356957f, 0.478568792f},
-std::array<float,2>{0.728518844f, 0.989088476f},
-std::array<float,2>{0.193513975f, 0.0630801842f},
-std::array<float,2>{0.31382069f, 0.655581892f},
-std::array<float,2>{0.847931385f, 0.399185032f},
-std::array<float,2>{0.910522103f, 0.540747404f},
-std::array<float,2>{0.454873174f, 0.285195559f},
-std::array<float,2>{0.107549585f, 0.823253512f},
-std::array<float,2>{0.528485596f, 0.211889029f},
-std::array<float,2>{0.572824597f, 0.706917286f},
-std::array<float,2>{0.0343520008f, 0.44606176f},
-std::array<float,2>{0.437247932f, 0.89339298f},
-std::array<float,2>{0.974098623f, 0.0256146509f},
-std::array<float,2>{0.792209864f, 0.753782272f},
-std::array<float,2>{0.270666242f, 0.126227796f},
-std::array<float,2>{0.149051815f, 0.588130295f},
-std::array<float,2>{0.669226348f, 0.359106511f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.294868559f, 0.486702561f},
-std::array<float,2>{0.655109107f, 0.635469735f},
-std::array<float,2>{0.930609345f, 0.155407801f},
-std::array<float,2>{0.0130536128f, 0.92444694f},
-std::array<float,2>{0.229893953f, 0.0536426306f},
-std::array<float,2>{0.753561437f, 0.823331594f},
-std::array<float,2>{0.516667724f, 0.312864184f},
-std::array<float,2>{0.452855378f, 0.579092741f},
-std::array<float,2>{0.124997795f, 0.286937594f},
-std::array<float,2>{0.966821611f, 0.509004593f},
-std::array<float,2>{0.715175748f, 0.0985933021f},
-std::array<float,2>{0.372173309f, 0.781413436f},
-std::array<float,2>{0.412547648f, 0.216765195f},
-std::array<float,2>{0.576672375f, 0.977804422f},
-std::array<float,2>{0.824761331f, 0.436413437f},
-std::array<float,2>{0.162901416f, 0.708485603f},
-std::array<float,2>{0.470359236f, 0.346029967f},
-std::array<float,2>{0.534554005f, 0.596176744f},
-std::array<float,2>{0.811842501f, 0.0139061837f},
-std::array<float,2>{0.193557277f, 0.846000254f},
-std::array<float,2>{0.0575622842f, 0.165455595f},
-std::array<float,2>{0.89810127f, 0.882751167f},
-std::array<float,2>{0.680387437f, 0.457519233f},
-std::array<float,2>{0.259927571f, 0.681161165f},
-std::array<float,2>{0.126518756f, 0.395849675f},
-std::array<float,2>{0.871073246f, 0.744261265f},
-std::array<float,2>{0.611710966f, 0.222273245f},
-std::array<float,2>{0.385144889f, 0.956369579f},
-std::array<float,2>{0.334376246f, 0.0700895041f},
-std::array<float,2>{0.740114868f, 0.76985836f},
-std::array<float,2>{0.980601311f, 0.256264448f},
-std::array<float,2>{0.0670436025f, 0.555959463f},
-std::array<float,2>{0.40356496f, 0.417245656f},
-std::array<float,2>{0.60275358f, 0.699831784f},
-std::array<float,2>{0.849126935f, 0.20089747f},
-std::array<float,2>{0.144158617f, 0.985195816f},
-std::array<float,2>{0.0892392695f, 0.121307299f},
-std::array<float,2>{0.999259949f, 0.798229098f},
-std::array<float,2>{0.729527831f, 0.3100667f},
-std::array<float,2>{0.313660234f, 0.518714786f},
-std::array<float,2>{0.211381346f, 0.335777432f},
-std::array<float,2>{0.782333016f, 0.566763103f},
-std::array<float,2>{0.558897018f, 0.0429258645f},
-std::array<float,2>{0.49477464f, 0.833909154f},
-std::array<float,2>{0.27212891f, 0.140304983f},
-std::array<float,2>{0.661663294f, 0.912859321f},
-std::array<float,2>{0.890344024f, 0.48070693f},
-std::array<float,2>{0.0416093729f, 0.641839206f},
-std::array<float,2>{0.344770849f, 0.28044644f},
-std::array<float,2>{0.692248821f, 0.544625103f},
-std::array<float,2>{0.939101934f, 0.085018754f},
-std::array<float,2>{0.0973615646f, 0.754955232f},
-std::array<float,2>{0.179504141f, 0.240507692f},
-std::array<float,2>{0.84112674f, 0.940841734f},
-std::array<float,2>{0.587770104f, 0.376211643f},
-std::array<float,2>{0.432611614f, 0.727892578f},
-std::array<float,2>{0.0224163197f, 0.449311137f},
-std::array<float,2>{0.909191728f, 0.668290019f},
-std::array<float,2>{0.637484431f, 0.176339567f},
-std::array<float,2>{0.303139061f, 0.899396837f},
-std::array<float,2>{0.467120022f, 0.0310613122f},
-std::array<float,2>{0.50353545f, 0.865179777f},
-std::array<float,2>{0.778301299f, 0.359905273f},
-std::array<float,2>{0.246911287f, 0.613550663f},
-std::array<float,2>{0.324227571f, 0.386205077f},
-std::array<float,2>{0.723904312f, 0.72117722f},
-std::array<float,2>{0.989348471f, 0.244198367f},
-std::array<float,2>{0.081778191f, 0.952701032f},
-std::array<float,2>{0.153701723f, 0.0864463598f},
-std::array<float,2>{0.856058359f, 0.765574336f},
-std::array<float,2>{0.597068071f, 0.265817285f},
-std::array<float,2>{0.398288876f, 0.536346614f},
-std::array<float,2>{0.0376277119f, 0.369179577f},
-std::array<float,2>{0.875115275f, 0.622602105f},
-std::array<float,2>{0.67037338f, 0.0217076559f},
-std::array<float,2>{0.277605146f, 0.870918214f},
-std::array<float,2>{0.487694889f, 0.184384912f},
-std::array<float,2>{0.549179316f, 0.891983509f},
-std::array<float,2>{0.789504766f, 0.438375175f},
-std::array<float,2>{0.207675666f, 0.659387648f},
-std::array<float,2>{0.425439f, 0.300551713f},
-std::array<float,2>{0.584057152f, 0.529249251f},
-std::array<float,2>{0.832600892f, 0.112247601f},
-std::array<float,2>{0.180470899f, 0.810857832f},
-std::array<float,2>{0.107680582f, 0.192574322f},
-std::array<float,2>{0.948182821f, 0.997590244f},
-std::array<float,2>{0.696641207f, 0.407967359f},
-std::array<float,2>{0.352581948f, 0.692198932f},
-std::array<float,2>{0.239884928f, 0.470455438f},
-std::array<float,2>{0.771406293f, 0.654996514f},
-std::array<float,2>{0.515602589f, 0.129603714f},
-std::array<float,2>{0.458757967f, 0.921306968f},
-std::array<float,2>{0.312345684f, 0.0333705582f},
-std::array<float,2>{0.630749643f, 0.837855697f},
-std::array<float,2>{0.920984805f, 0.338235945f},
-std::array<float,2>{0.0238046944f, 0.572855234f},
-std::array<float,2>{0.444666326f, 0.461498141f},
-std::array<float,2>{0.523675919f, 0.679231107f},
-std::array<float,2>{0.761802495f, 0.162817389f},
-std::array<float,2>{0.219921023f, 0.890485406f},
-std::array<float,2>{0.00524654612f, 0.00398689648f},
-std::array<float,2>{0.925931275f, 0.855282545f},
-std::array<float,2>{0.643326521f, 0.357953489f},
-std::array<float,2>{0.285405487f, 0.608320177f},
-std::array<float,2>{0.168624237f, 0.261395305f},
-std::array<float,2>{0.814590037f, 0.547995925f},
-std::array<float,2>{0.567763627f, 0.0755939931f},
-std::array<float,2>{0.420890301f, 0.77582711f},
-std::array<float,2>{0.366396904f, 0.226795197f},
-std::array<float,2>{0.70777005f, 0.967763066f},
-std::array<float,2>{0.956394672f, 0.400789857f},
-std::array<float,2>{0.11033646f, 0.74159205f},
-std::array<float,2>{0.255790532f, 0.322600365f},
-std::array<float,2>{0.675171554f, 0.59043479f},
-std::array<float,2>{0.900058687f, 0.0563064665f},
-std::array<float,2>{0.0518953539f, 0.818142772f},
-std::array<float,2>{0.200272217f, 0.142684266f},
-std::array<float,2>{0.799876511f, 0.930368662f},
-std::array<float,2>{0.545670509f, 0.492276371f},
-std::array<float,2>{0.479424626f, 0.631791472f},
-std::array<float,2>{0.0729407147f, 0.422537148f},
-std::array<float,2>{0.973522007f, 0.71289283f},
-std::array<float,2>{0.744802177f, 0.204440057f},
-std::array<float,2>{0.339189947f, 0.969539046f},
-std::array<float,2>{0.375162542f, 0.107900515f},
-std::array<float,2>{0.62090981f, 0.795466125f},
-std::array<float,2>{0.862471104f, 0.29654181f},
-std::array<float,2>{0.135639966f, 0.504241467f},
-std::array<float,2>{0.276339382f, 0.433343887f},
-std::array<float,2>{0.667707741f, 0.704344451f},
-std::array<float,2>{0.881955922f, 0.211206585f},
-std::array<float,2>{0.0348688029f, 0.983090818f},
-std::array<float,2>{0.203396887f, 0.096062623f},
-std::array<float,2>{0.796040058f, 0.78822428f},
-std::array<float,2>{0.551650703f, 0.281554818f},
-std::array<float,2>{0.490100831f, 0.512851775f},
-std::array<float,2>{0.0830946565f, 0.318048954f},
-std::array<float,2>{0.988147199f, 0.584167659f},
-std::array<float,2>{0.722649515f, 0.0487833805f},
-std::array<float,2>{0.321287692f, 0.827851355f},
-std::array<float,2>{0.392793268f, 0.149352387f},
-std::array<float,2>{0.599636078f, 0.927990913f},
-std::array<float,2>{0.854170442f, 0.48833406f},
-std::array<float,2>{0.149121538f, 0.640503943f},
-std::array<float,2>{0.453296632f, 0.252980143f},
-std::array<float,2>{0.510458052f, 0.55903697f},
-std::array<float,2>{0.766424716f, 0.0627630427f},
-std::array<float,2>{0.234672293f, 0.766504407f},
-std::array<float,2>{0.0290727001f, 0.226139024f},
-std::array<float,2>{0.915481329f, 0.959132552f},
-std::array<float,2>{0.62666893f, 0.392340779f},
-std::array<float,2>{0.305865705f, 0.747793317f},
-std::array<float,2>{0.185375988f, 0.453800023f},
-std::array<float,2>{0.828387558f, 0.684409976f},
-std::array<float,2>{0.57838279f, 0.168567359f},
-std::array<float,2>{0.427142709f, 0.876118958f},
-std::array<float,2>{0.35585627f, 0.00987428799f},
-std::array<float,2>{0.701971352f, 0.850215614f},
-std::array<float,2>{0.952174067f, 0.350137323f},
-std::array<float,2>{0.104825363f, 0.598487735f},
-std::array<float,2>{0.414297998f, 0.47717467f},
-std::array<float,2>{0.564540803f, 0.646477282f},
-std::array<float,2>{0.817660511f, 0.13628234f},
-std::array<float,2>{0.166487381f, 0.909025848f},
-std::array<float,2>{0.116109058f, 0.0447644219f},
-std::array<float,2>{0.95888865f, 0.830937564f},
-std::array<float,2>{0.706480503f, 0.328475863f},
-std::array<float,2>{0.361977935f, 0.563969254f},
-std::array<float,2>{0.22511515f, 0.306408763f},
-std::array<float,2>{0.759421647f, 0.521633625f},
-std::array<float,2>{0.527713537f, 0.118886545f},
-std::array<float,2>{0.439636797f, 0.801341712f},
-std::array<float,2>{0.284187555f, 0.197820857f},
-std::array<float,2>{0.647169232f, 0.991168618f},
-std::array<float,2>{0.923280239f, 0.419460297f},
-std::array<float,2>{0.00341303181f, 0.69631052f},
-std::array<float,2>{0.34260729f, 0.366035968f},
-std::array<float,2>{0.746756494f, 0.611352205f},
-std::array<float,2>{0.9717381f, 0.0272041466f},
-std::array<float,2>{0.0771178305f, 0.860539675f},
-std::array<float,2>{0.13895911f, 0.172747388f},
-std::array<float,2>{0.86572957f, 0.903108954f},
-std::array<float,2>{0.621845126f, 0.447784185f},
-std::array<float,2>{0.382087171f, 0.667733133f},
-std::array<float,2>{0.0500623398f, 0.38103947f},
-std::array<float,2>{0.905633509f, 0.733698964f},
-std::array<float,2>{0.677945077f, 0.235916764f},
-std::array<float,2>{0.250291049f, 0.943407953f},
-std::array<float,2>{0.480658233f, 0.0816644728f},
-std::array<float,2>{0.540815055f, 0.753840625f},
-std::array<float,2>{0.802654386f, 0.273928195f},
-std::array<float,2>{0.19856666f, 0.540049374f},
-std::array<float,2>{0.368014157f, 0.443581283f},
-std::array<float,2>{0.711690962f, 0.66069448f},
-std::array<float,2>{0.964731395f, 0.181289241f},
-std::array<float,2>{0.117291428f, 0.895209074f},
-std::array<float,2>{0.160019919f, 0.0172270089f},
-std::array<float,2>{0.823009312f, 0.874122202f},
-std::array<float,2>{0.573458195f, 0.373583645f},
-std::array<float,2>{0.409424007f, 0.621053636f},
-std::array<float,2>{0.00992084388f, 0.27204144f},
-std::array<float,2>{0.937002838f, 0.531497896f},
-std::array<float,2>{0.650577486f, 0.0929538459f},
-std::array<float,2>{0.29170984f, 0.761602104f},
-std::array<float,2>{0.448858649f, 0.248538569f},
-std::array<float,2>{0.522460282f, 0.948402703f},
-std::array<float,2>{0.755053818f, 0.389989376f},
-std::array<float,2>{0.233354077f, 0.72596997f},
-std::array<float,2>{0.388578147f, 0.340771079f},
-std::array<float,2>{0.615735888f, 0.576652288f},
-std::array<float,2>{0.8741225f, 0.0386860967f},
-std::array<float,2>{0.131782144f, 0.841655731f},
-std::array<float,2>{0.0649144799f, 0.126522273f},
-std::array<float,2>{0.976957142f, 0.914868951f},
-std::array<float,2>{0.736266553f, 0.473161012f},
-std::array<float,2>{0.330848396f, 0.65053463f},
-std::array<float,2>{0.191133603f, 0.411509782f},
-std::array<float,2>{0.806653917f, 0.690419972f},
-std::array<float,2>{0.536820114f, 0.190485775f},
-std::array<float,2>{0.474762738f, 0.993559301f},
-std::array<float,2>{0.2630741f, 0.114654824f},
-std::array<float,2>{0.686732948f, 0.805952251f},
-std::array<float,2>{0.892376781f, 0.304605603f},
-std::array<float,2>{0.0591624975f, 0.527272284f},
-std::array<float,2>{0.498882174f, 0.402369738f},
-std::array<float,2>{0.556506634f, 0.734979033f},
-std::array<float,2>{0.788122714f, 0.231107503f},
-std::array<float,2>{0.217017859f, 0.96459955f},
-std::array<float,2>{0.0460645594f, 0.0740958601f},
-std::array<float,2>{0.885189831f, 0.777801096f},
-std::array<float,2>{0.658603847f, 0.263593584f},
-std::array<float,2>{0.269417644f, 0.551252961f},
-std::array<float,2>{0.1463404f, 0.35540098f},
-std::array<float,2>{0.847649753f, 0.604697287f},
-std::array<float,2>{0.6088503f, 0.00254869997f},
-std::array<float,2>{0.399516851f, 0.855516911f},
-std::array<float,2>{0.318145514f, 0.159398884f},
-std::array<float,2>{0.731686771f, 0.883502185f},
-std::array<float,2>{0.992504954f, 0.468515724f},
-std::array<float,2>{0.0929451883f, 0.6730299f},
-std::array<float,2>{0.30057317f, 0.292901218f},
-std::array<float,2>{0.635896564f, 0.501450181f},
-std::array<float,2>{0.910603106f, 0.105396762f},
-std::array<float,2>{0.0168308541f, 0.790860951f},
-std::array<float,2>{0.245312348f, 0.207560912f},
-std::array<float,2>{0.777081311f, 0.975876033f},
-std::array<float,2>{0.505584478f, 0.427024037f},
-std::array<float,2>{0.461002648f, 0.716967583f},
-std::array<float,2>{0.101179883f, 0.499013573f},
-std::array<float,2>{0.94333607f, 0.628613949f},
-std::array<float,2>{0.68799758f, 0.148119405f},
-std::array<float,2>{0.348925054f, 0.934600949f},
-std::array<float,2>{0.434986174f, 0.0619955435f},
-std::array<float,2>{0.592515349f, 0.813361526f},
-std::array<float,2>{0.837637067f, 0.32426393f},
-std::array<float,2>{0.174321309f, 0.58905375f},
-std::array<float,2>{0.25805074f, 0.459053636f},
-std::array<float,2>{0.681916654f, 0.682461739f},
-std::array<float,2>{0.894592464f, 0.167935297f},
-std::array<float,2>{0.0565992482f, 0.879339993f},
-std::array<float,2>{0.192594811f, 0.0134619223f},
-std::array<float,2>{0.809227884f, 0.844074011f},
-std::array<float,2>{0.533028185f, 0.343993038f},
-std::array<float,2>{0.472500503f, 0.595405638f},
-std::array<float,2>{0.0698871836f, 0.255281717f},
-std::array<float,2>{0.982498944f, 0.557629585f},
-std::array<float,2>{0.741481721f, 0.0682790726f},
-std::array<float,2>{0.332556009f, 0.77302146f},
-std::array<float,2>{0.384100914f, 0.219085366f},
-std::array<float,2>{0.610188365f, 0.954278886f},
-std::array<float,2>{0.867485285f, 0.397268027f},
-std::array<float,2>{0.128123179f, 0.743713439f},
-std::array<float,2>{0.450347662f, 0.315144449f},
-std::array<float,2>{0.517657757f, 0.581920266f},
-std::array<float,2>{0.750410974f, 0.052402053f},
-std::array<float,2>{0.228396758f, 0.82211256f},
-std::array<float,2>{0.0144894421f, 0.154118016f},
-std::array<float,2>{0.933311403f, 0.921985865f},
-std::array<float,2>{0.65420115f, 0.485662192f},
-std::array<float,2>{0.296377003f, 0.634283006f},
-std::array<float,2>{0.161711693f, 0.435285419f},
-std::array<float,2>{0.826174915f, 0.710163057f},
-std::array<float,2>{0.574686944f, 0.217461318f},
-std::array<float,2>{0.411139667f, 0.979544163f},
-std::array<float,2>{0.374804676f, 0.0996891111f},
-std::array<float,2>{0.718280494f, 0.784899235f},
-std::array<float,2>{0.965271831f, 0.287542999f},
-std::array<float,2>{0.12134026f, 0.511125803f},
-std::array<float,2>{0.431635827f, 0.378749847f},
-std::array<float,2>{0.589107692f, 0.729577363f},
-std::array<float,2>{0.843681693f, 0.239226893f},
-std::array<float,2>{0.177440986f, 0.93928355f},
-std::array<float,2>{0.0953942761f, 0.0828182995f},
-std::array<float,2>{0.939862907f, 0.757680416f},
-std::array<float,2>{0.693374574f, 0.278635681f},
-std::array<float,2>{0.346093446f, 0.545480847f},
-std::array<float,2>{0.249137312f, 0.361742288f},
-std::array<float,2>{0.780692041f, 0.616217792f},
-std::array<float,2>{0.500395358f, 0.0284963585f},
-std::array<float,2>{0.466515422f, 0.866752386f},
-std::array<float,2>{0.301951319f, 0.177960098f},
-std::array<float,2>{0.639001966f, 0.900511265f},
-std::array<float,2>{0.906481981f, 0.452881396f},
-std::array<float,2>{0.0208210982f, 0.670161247f},
-std::array<float,2>{0.315449655f, 0.312246263f},
-std::array<float,2>{0.728400469f, 0.515851855f},
-std::array<float,2>{0.997075856f, 0.123161539f},
-std::array<float,2>{0.087096706f, 0.800176442f},
-std::array<float,2>{0.141650468f, 0.201411456f},
-std::array<float,2>{0.849715531f, 0.987324893f},
-std::array<float,2>{0.605311453f, 0.41417411f},
-std::array<float,2>{0.404354483f, 0.702639163f},
-std::array<float,2>{0.0400000997f, 0.483989298f},
-std::array<float,2>{0.88811332f, 0.643202901f},
-std::array<float,2>{0.66212225f, 0.137200281f},
-std::array<float,2>{0.271211207f, 0.911269963f},
-std::array<float,2>{0.493479371f, 0.0394919477f},
-std::array<float,2>{0.560998082f, 0.834105611f},
-std::array<float,2>{0.784465194f, 0.333245277f},
-std::array<float,2>{0.212920114f, 0.569345593f},
-std::array<float,2>{0.354965538f, 0.409104675f},
-std::array<float,2>{0.698687613f, 0.6936028f},
-std::array<float,2>{0.945337415f, 0.194800571f},
-std::array<float,2>{0.106119864f, 0.999503374f},
-std::array<float,2>{0.183172703f, 0.110587128f},
-std::array<float,2>{0.835759759f, 0.809458852f},
-std::array<float,2>{0.583516955f, 0.297778934f},
-std::array<float,2>{0.423487514f, 0.530516565f},
-std::array<float,2>{0.0260130931f, 0.336442679f},
-std::array<float,2>{0.919162393f, 0.570757806f},
-std::array<float,2>{0.631233454f, 0.0322613716f},
-std::array<float,2>{0.3089073f, 0.83892411f},
-std::array<float,2>{0.459564954f, 0.130918518f},
-std::array<float,2>{0.511825502f, 0.918842316f},
-std::array<float,2>{0.772219777f, 0.472426772f},
-std::array<float,2>{0.241353512f, 0.653555572f},
-std::array<float,2>{0.396454394f, 0.26885733f},
-std::array<float,2>{0.59564054f, 0.53789252f},
-std::array<float,2>{0.859054625f, 0.0893197805f},
-std::array<float,2>{0.154990897f, 0.762924075f},
-std::array<float,2>{0.0794222653f, 0.242769524f},
-std::array<float,2>{0.991824687f, 0.950679302f},
-std::array<float,2>{0.724975169f, 0.38305071f},
-std::array<float,2>{0.326454222f, 0.719703853f},
-std::array<float,2>{0.210533798f, 0.439824164f},
-std::array<float,2>{0.791868389f, 0.656734347f},
-std::array<float,2>{0.547064245f, 0.18649222f},
-std::array<float,2>{0.486048281f, 0.892758429f},
-std::array<float,2>{0.279360861f, 0.0201989207f},
-std::array<float,2>{0.668340385f, 0.868325353f},
-std::array<float,2>{0.878634751f, 0.368406296f},
-std::array<float,2>{0.0352550596f, 0.624975443f},
-std::array<float,2>{0.477409124f, 0.495756775f},
-std::array<float,2>{0.543854177f, 0.629413009f},
-std::array<float,2>{0.798053503f, 0.140938118f},
-std::array<float,2>{0.202790245f, 0.931887925f},
-std::array<float,2>{0.0530598275f, 0.0566763245f},
-std::array<float,2>{0.901728511f, 0.820091724f},
-std::array<float,2>{0.673589826f, 0.321951807f},
-std::array<float,2>{0.256523997f, 0.592122376f},
-std::array<float,2>{0.132952556f, 0.294216543f},
-std::array<float,2>{0.861012816f, 0.507240593f},
-std::array<float,2>{0.618856907f, 0.105865009f},
-std::array<float,2>{0.378274679f, 0.794768989f},
-std::array<float,2>{0.337722808f, 0.206615835f},
-std::array<float,2>{0.743850231f, 0.972502053f},
-std::array<float,2>{0.974749029f, 0.425160319f},
-std::array<float,2>{0.0711158812f, 0.711658359f},
-std::array<float,2>{0.28775683f, 0.356784046f},
-std::array<float,2>{0.641013205f, 0.606012285f},
-std::array<float,2>{0.927922249f, 0.00593770854f},
-std::array<float,2>{0.00612487411f, 0.851733327f},
-std::array<float,2>{0.222253978f, 0.162045971f},
-std::array<float,2>{0.764401555f, 0.887126505f},
-std::array<float,2>{0.526907563f, 0.46445626f},
-std::array<float,2>{0.442171991f, 0.676103175f},
-std::array<float,2>{0.112103246f, 0.398888648f},
-std::array<float,2>{0.95331955f, 0.738496244f},
-std::array<float,2>{0.7095716f, 0.229065061f},
-std::array<float,2>{0.365222931f, 0.966227055f},
-std::array<float,2>{0.418903828f, 0.0769079179f},
-std::array<float,2>{0.568730593f, 0.774702311f},
-std::array<float,2>{0.813653469f, 0.25933972f},
-std::array<float,2>{0.170349464f, 0.550296664f},
-std::array<float,2>{0.307956487f, 0.39422369f},
-std::array<float,2>{0.627803624f, 0.749516308f},
-std::array<float,2>{0.916502595f, 0.223124221f},
-std::array<float,2>{0.0310599636f, 0.958004534f},
-std::array<float,2>{0.23823297f, 0.0653941855f},
-std::array<float,2>{0.768783391f, 0.768139362f},
-std::array<float,2>{0.509503126f, 0.251931012f},
-std::array<float,2>{0.456920743f, 0.562404811f},
-std::array<float,2>{0.102149576f, 0.34833169f},
-std::array<float,2>{0.951053798f, 0.599633276f},
-std::array<float,2>{0.700089455f, 0.00905488338f},
-std::array<float,2>{0.358910531f, 0.848443389f},
-std::array<float,2>{0.428348422f, 0.170814395f},
-std::array<float,2>{0.581085801f, 0.877065241f},
-std::array<float,2>{0.83099556f, 0.45605725f},
-std::array<float,2>{0.185957924f, 0.686690748f},
-std::array<float,2>{0.490990788f, 0.283679783f},
-std::array<float,2>{0.554511666f, 0.515215993f},
-std::array<float,2>{0.794350266f, 0.0954096243f},
-std::array<float,2>{0.205872208f, 0.78608942f},
-std::array<float,2>{0.0322790928f, 0.2131989f},
-std::array<float,2>{0.879836738f, 0.982020199f},
-std::array<float,2>{0.665557563f, 0.431086004f},
-std::array<float,2>{0.274468243f, 0.705899f},
-std::array<float,2>{0.152334362f, 0.490675896f},
-std::array<float,2>{0.853280604f, 0.637002468f},
-std::array<float,2>{0.598341465f, 0.151282936f},
-std::array<float,2>{0.392258704f, 0.926530182f},
-std::array<float,2>{0.323715121f, 0.0489415824f},
-std::array<float,2>{0.718987226f, 0.824714601f},
-std::array<float,2>{0.984545648f, 0.31853649f},
-std::array<float,2>{0.0852527022f, 0.583256781f},
-std::array<float,2>{0.379096806f, 0.446780056f},
-std::array<float,2>{0.623080909f, 0.664213181f},
-std::array<float,2>{0.865150034f, 0.174670562f},
-std::array<float,2>{0.138557687f, 0.904760659f},
-std::array<float,2>{0.0754012391f, 0.0249078292f},
-std::array<float,2>{0.969059467f, 0.862383604f},
-std::array<float,2>{0.749984443f, 0.364168227f},
-std::array<float,2>{0.341483802f, 0.61011523f},
-std::array<float,2>{0.196116939f, 0.275696129f},
-std::array<float,2>{0.803693354f, 0.542547524f},
-std::array<float,2>{0.541179299f, 0.0788597614f},
-std::array<float,2>{0.48333025f, 0.751091242f},
-std::array<float,2>{0.252940238f, 0.23768197f},
-std::array<float,2>{0.677517593f, 0.941698492f},
-std::array<float,2>{0.902880788f, 0.379957169f},
-std::array<float,2>{0.0481232665f, 0.732095718f},
-std::array<float,2>{0.360816032f, 0.330774903f},
-std::array<float,2>{0.704368234f, 0.564751446f},
-std::array<float,2>{0.959404647f, 0.0454977006f},
-std::array<float,2>{0.114360996f, 0.82950598f},
-std::array<float,2>{0.16419889f, 0.134127825f},
-std::array<float,2>{0.81984818f, 0.906556845f},
-std::array<float,2>{0.562730908f, 0.479823172f},
-std::array<float,2>{0.417182893f, 0.647325695f},
-std::array<float,2>{0.0012182655f, 0.420941502f},
-std::array<float,2>{0.924575269f, 0.699212372f},
-std::array<float,2>{0.645014584f, 0.195712283f},
-std::array<float,2>{0.283152789f, 0.988627553f},
-std::array<float,2>{0.438680977f, 0.120166853f},
-std::array<float,2>{0.531026542f, 0.804349601f},
-std::array<float,2>{0.760628879f, 0.307583094f},
-std::array<float,2>{0.223212183f, 0.520355463f},
-std::array<float,2>{0.328195423f, 0.476284295f},
-std::array<float,2>{0.737662435f, 0.648935616f},
-std::array<float,2>{0.978679419f, 0.128547654f},
-std::array<float,2>{0.0636808127f, 0.916062593f},
-std::array<float,2>{0.130336702f, 0.0369718522f},
-std::array<float,2>{0.871266425f, 0.843146026f},
-std::array<float,2>{0.614692152f, 0.343532145f},
-std::array<float,2>{0.389109462f, 0.574636161f},
-std::array<float,2>{0.0606235862f, 0.302460194f},
-std::array<float,2>{0.892949522f, 0.523895264f},
-std::array<float,2>{0.684711576f, 0.115999863f},
-std::array<float,2>{0.263684303f, 0.80807215f},
-std::array<float,2>{0.474268585f, 0.189388126f},
-std::array<float,2>{0.537305295f, 0.994493604f},
-std::array<float,2>{0.806247234f, 0.413765132f},
-std::array<float,2>{0.18863152f, 0.688100994f},
-std::array<float,2>{0.406924158f, 0.37253812f},
-std::array<float,2>{0.571925342f, 0.618237674f},
-std::array<float,2>{0.821216881f, 0.0177396983f},
-std::array<float,2>{0.15714547f, 0.871952593f},
-std::array<float,2>{0.119618259f, 0.182108387f},
-std::array<float,2>{0.961482167f, 0.897283792f},
-std::array<float,2>{0.714731634f, 0.442091733f},
-std::array<float,2>{0.370480627f, 0.664029241f},
-std::array<float,2>{0.232221678f, 0.387797117f},
-std::array<float,2>{0.75762701f, 0.72276032f},
-std::array<float,2>{0.519799888f, 0.246359736f},
-std::array<float,2>{0.446260273f, 0.946508944f},
-std::array<float,2>{0.290788233f, 0.0914220288f},
-std::array<float,2>{0.648748219f, 0.759019732f},
-std::array<float,2>{0.934173465f, 0.270079911f},
-std::array<float,2>{0.00794606004f, 0.533866823f},
-std::array<float,2>{0.463305354f, 0.428742081f},
-std::array<float,2>{0.50665468f, 0.715489566f},
-std::array<float,2>{0.775112391f, 0.210002512f},
-std::array<float,2>{0.242408261f, 0.973086059f},
-std::array<float,2>{0.0188574214f, 0.101995371f},
-std::array<float,2>{0.914047301f, 0.79157269f},
-std::array<float,2>{0.633688748f, 0.289698333f},
-std::array<float,2>{0.298417866f, 0.502156019f},
-std::array<float,2>{0.172555417f, 0.327641249f},
-std::array<float,2>{0.838624537f, 0.58641237f},
-std::array<float,2>{0.591462731f, 0.0602238066f},
-std::array<float,2>{0.436405659f, 0.816026866f},
-std::array<float,2>{0.350441426f, 0.145011604f},
-std::array<float,2>{0.690553606f, 0.937419951f},
-std::array<float,2>{0.944634438f, 0.496285766f},
-std::array<float,2>{0.0992368907f, 0.625981688f},
-std::array<float,2>{0.265963823f, 0.264126569f},
-std::array<float,2>{0.657236099f, 0.554208875f},
-std::array<float,2>{0.884694338f, 0.0715305582f},
-std::array<float,2>{0.044260107f, 0.779478371f},
-std::array<float,2>{0.214915603f, 0.232987717f},
-std::array<float,2>{0.785636187f, 0.961596489f},
-std::array<float,2>{0.557802975f, 0.406194985f},
-std::array<float,2>{0.496992975f, 0.737956405f},
-std::array<float,2>{0.0914059058f, 0.464892268f},
-std::array<float,2>{0.995004475f, 0.674817562f},
-std::array<float,2>{0.733908296f, 0.157563776f},
-std::array<float,2>{0.318705589f, 0.885534227f},
-std::array<float,2>{0.400891244f, 0.000411502668f},
-std::array<float,2>{0.605674744f, 0.859102786f},
-std::array<float,2>{0.845542014f, 0.352247357f},
-std::array<float,2>{0.147603467f, 0.602616727f},
-std::array<float,2>{0.270303518f, 0.481493503f},
-std::array<float,2>{0.663970232f, 0.641476989f},
-std::array<float,2>{0.886932313f, 0.139420524f},
-std::array<float,2>{0.0405950136f, 0.913974166f},
-std::array<float,2>{0.214698344f, 0.0415298231f},
-std::array<float,2>{0.783482909f, 0.832369804f},
-std::array<float,2>{0.562004209f, 0.334131479f},
-std::array<float,2>{0.492906749f, 0.56768018f},
-std::array<float,2>{0.086703971f, 0.30916664f},
-std::array<float,2>{0.996334553f, 0.518352151f},
-std::array<float,2>{0.726900935f, 0.12257275f},
-std::array<float,2>{0.314668566f, 0.797707856f},
-std::array<float,2>{0.406243593f, 0.199336544f},
-std::array<float,2>{0.604080617f, 0.985824585f},
-std::array<float,2>{0.850960612f, 0.416369528f},
-std::array<float,2>{0.141473025f, 0.700220823f},
-std::array<float,2>{0.465789467f, 0.360568136f},
-std::array<float,2>{0.501236618f, 0.615201116f},
-std::array<float,2>{0.780251861f, 0.02999302f},
-std::array<float,2>{0.248466805f, 0.863716066f},
-std::array<float,2>{0.0201161429f, 0.176784918f},
-std::array<float,2>{0.907892525f, 0.900077164f},
-std::array<float,2>{0.640015483f, 0.450471103f},
-std::array<float,2>{0.301072478f, 0.669867814f},
-std::array<float,2>{0.175965384f, 0.375472039f},
-std::array<float,2>{0.842649281f, 0.726956189f},
-std::array<float,2>{0.587909937f, 0.242153764f},
-std::array<float,2>{0.42977795f, 0.939735889f},
-std::array<float,2>{0.347622126f, 0.084959507f},
-std::array<float,2>{0.694524288f, 0.754698813f},
-std::array<float,2>{0.94119817f, 0.280195236f},
-std::array<float,2>{0.0938364342f, 0.542978764f},
-std::array<float,2>{0.410473555f, 0.436839551f},
-std::array<float,2>{0.575564563f, 0.707455397f},
-std::array<float,2>{0.828017414f, 0.215395108f},
-std::array<float,2>{0.161043867f, 0.977527976f},
-std::array<float,2>{0.122090407f, 0.0990314633f},
-std::array<float,2>{0.966399074f, 0.783053458f},
-std::array<float,2>{0.717048585f, 0.285424948f},
-std::array<float,2>{0.373362541f, 0.50868535f},
-std::array<float,2>{0.227285221f, 0.313930929f},
-std::array<float,2>{0.751116931f, 0.579800248f},
-std::array<float,2>{0.519398272f, 0.0541746728f},
-std::array<float,2>{0.449358255f, 0.822905838f},
-std::array<float,2>{0.295320809f, 0.155028135f},
-std::array<float,2>{0.653068125f, 0.924969673f},
-std::array<float,2>{0.932478011f, 0.487691224f},
-std::array<float,2>{0.0150525281f, 0.636618078f},
-std::array<float,2>{0.333574295f, 0.257753581f},
-std::array<float,2>{0.741159439f, 0.554876149f},
-std::array<float,2>{0.984010279f, 0.0689886436f},
-std::array<float,2>{0.0689682141f, 0.771434009f},
-std::array<float,2>{0.127052173f, 0.22071445f},
-std::array<float,2>{0.868417859f, 0.955738783f},
-std::array<float,2>{0.610982835f, 0.394533783f},
-std::array<float,2>{0.383726358f, 0.746060669f},
-std::array<float,2>{0.0550942384f, 0.458348274f},
-std::array<float,2>{0.895876408f, 0.680389822f},
-std::array<float,2>{0.68314904f, 0.164762899f},
-std::array<float,2>{0.259740144f, 0.881544292f},
-std::array<float,2>{0.471664876f, 0.0146958744f},
-std::array<float,2>{0.531945944f, 0.846985579f},
-std::array<float,2>{0.80985707f, 0.347356141f},
-std::array<float,2>{0.192248389f, 0.596746385f},
-std::array<float,2>{0.363722324f, 0.401501864f},
-std::array<float,2>{0.71049875f, 0.741118968f},
-std::array<float,2>{0.954774797f, 0.227634922f},
-std::array<float,2>{0.113150209f, 0.968443692f},
-std::array<float,2>{0.171850815f, 0.0746221989f},
-std::array<float,2>{0.813273191f, 0.776486695f},
-std::array<float,2>{0.570037603f, 0.260330379f},
-std::array<float,2>{0.419051021f, 0.547559381f},
-std::array<float,2>{0.00712162023f, 0.358668804f},
-std::array<float,2>{0.928954124f, 0.608657122f},
-std::array<float,2>{0.641923904f, 0.00564635685f},
-std::array<float,2>{0.288444042f, 0.854141772f},
-std::array<float,2>{0.442834109f, 0.164061531f},
-std::array<float,2>{0.525656343f, 0.88907069f},
-std::array<float,2>{0.765384674f, 0.462149888f},
-std::array<float,2>{0.220768586f, 0.678079724f},
-std::array<float,2>{0.377412379f, 0.295134723f},
-std::array<float,2>{0.617494345f, 0.505018413f},
-std::array<float,2>{0.859790206f, 0.109225102f},
-std::array<float,2>{0.134453923f, 0.796137333f},
-std::array<float,2>{0.0714957491f, 0.20397532f},
-std::array<float,2>{0.976315558f, 0.969744623f},
-std::array<float,2>{0.742758512f, 0.423422337f},
-std::array<float,2>{0.336599767f, 0.714820325f},
-std::array<float,2>{0.201198921f, 0.494136393f},
-std::array<float,2>{0.797474384f, 0.632720232f},
-std::array<float,2>{0.544511795f, 0.143924713f},
-std::array<float,2>{0.47810486f, 0.930684566f},
-std::array<float,2>{0.257003993f, 0.0550264344f},
-std::array<float,2>{0.672114611f, 0.816516936f},
-std::array<float,2>{0.900442064f, 0.323829412f},
-std::array<float,2>{0.0544672497f, 0.591718972f},
-std::array<float,2>{0.485004723f, 0.438733339f},
-std::array<float,2>{0.548460424f, 0.659157515f},
-std::array<float,2>{0.792223632f, 0.185035378f},
-std::array<float,2>{0.209906146f, 0.891501904f},
-std::array<float,2>{0.0370005034f, 0.0232157856f},
-std::array<float,2>{0.877206981f, 0.870034158f},
-std::array<float,2>{0.668958724f, 0.37050423f},
-std::array<float,2>{0.280371696f, 0.621789575f},
-std::array<float,2>{0.155321643f, 0.267454475f},
-std::array<float,2>{0.857580662f, 0.535741568f},
-std::array<float,2>{0.593763649f, 0.0878349394f},
-std::array<float,2>{0.394815981f, 0.764634848f},
-std::array<float,2>{0.327561557f, 0.245622724f},
-std::array<float,2>{0.725990832f, 0.951319754f},
-std::array<float,2>{0.990480125f, 0.385437399f},
-std::array<float,2>{0.0790592507f, 0.721683145f},
-std::array<float,2>{0.309987873f, 0.339615583f},
-std::array<float,2>{0.632380664f, 0.573826015f},
-std::array<float,2>{0.91889596f, 0.0351471156f},
-std::array<float,2>{0.0266941972f, 0.836819589f},
-std::array<float,2>{0.240689814f, 0.130528882f},
-std::array<float,2>{0.772836924f, 0.920109212f},
-std::array<float,2>{0.512762964f, 0.46946016f},
-std::array<float,2>{0.460501254f, 0.655479789f},
-std::array<float,2>{0.107311293f, 0.406835318f},
-std::array<float,2>{0.946772635f, 0.693271101f},
-std::array<float,2>{0.69751507f, 0.192088798f},
-std::array<float,2>{0.353537172f, 0.996237695f},
-std::array<float,2>{0.4226937f, 0.112813681f},
-std::array<float,2>{0.58296144f, 0.811572433f},
-std::array<float,2>{0.83489424f, 0.298843622f},
-std::array<float,2>{0.18208167f, 0.528039753f},
-std::array<float,2>{0.281391233f, 0.418723375f},
-std::array<float,2>{0.646235049f, 0.695834279f},
-std::array<float,2>{0.925697446f, 0.19857268f},
-std::array<float,2>{0.000465594087f, 0.991297722f},
-std::array<float,2>{0.224435374f, 0.117828764f},
-std::array<float,2>{0.76118356f, 0.802507699f},
-std::array<float,2>{0.530239522f, 0.305278063f},
-std::array<float,2>{0.437882543f, 0.52289474f},
-std::array<float,2>{0.11401692f, 0.329482079f},
-std::array<float,2>{0.96076262f, 0.56319195f},
-std::array<float,2>{0.704078555f, 0.0435201973f},
-std::array<float,2>{0.360151052f, 0.831196368f},
-std::array<float,2>{0.41698122f, 0.134888962f},
-std::array<float,2>{0.564069092f, 0.90994072f},
-std::array<float,2>{0.818953335f, 0.478459656f},
-std::array<float,2>{0.165240377f, 0.645029247f},
-std::array<float,2>{0.483798862f, 0.274752438f},
-std::array<float,2>{0.542589366f, 0.539745986f},
-std::array<float,2>{0.804388642f, 0.0808007419f},
-std::array<float,2>{0.197205052f, 0.752872646f},
-std::array<float,2>{0.047691036f, 0.235131368f},
-std::array<float,2>{0.903778613f, 0.944847167f},
-std::array<float,2>{0.676586688f, 0.382011712f},
-std::array<float,2>{0.252260923f, 0.733335912f},
-std::array<float,2>{0.137555853f, 0.448901504f},
-std::array<float,2>{0.8639431f, 0.666734099f},
-std::array<float,2>{0.624498427f, 0.173500329f},
-std::array<float,2>{0.380199999f, 0.903948545f},
-std::array<float,2>{0.340766579f, 0.0262603499f},
-std::array<float,2>{0.748533309f, 0.859906495f},
-std::array<float,2>{0.970201015f, 0.366560966f},
-std::array<float,2>{0.0748035535f, 0.612541258f},
-std::array<float,2>{0.391533345f, 0.489312261f},
-std::array<float,2>{0.598702848f, 0.639521599f},
-std::array<float,2>{0.852351904f, 0.150334567f},
-std::array<float,2>{0.151309028f, 0.928812861f},
-std::array<float,2>{0.0842892826f, 0.0469875224f},
-std::array<float,2>{0.985728204f, 0.827096999f},
-std::array<float,2>{0.720211565f, 0.316966265f},
-std::array<float,2>{0.322279811f, 0.585708082f},
-std::array<float,2>{0.206300497f, 0.283082992f},
-std::array<float,2>{0.793486595f, 0.512431204f},
-std::array<float,2>{0.553028345f, 0.0974413902f},
-std::array<float,2>{0.491284698f, 0.787238657f},
-std::array<float,2>{0.274383277f, 0.212775365f},
-std::array<float,2>{0.664094388f, 0.984337807f},
-std::array<float,2>{0.880043924f, 0.432100236f},
-std::array<float,2>{0.0314919278f, 0.704021513f},
-std::array<float,2>{0.357852072f, 0.351165265f},
-std::array<float,2>{0.700475276f, 0.598639667f},
-std::array<float,2>{0.950018227f, 0.0112954555f},
-std::array<float,2>{0.103175774f, 0.850855291f},
-std::array<float,2>{0.187162474f, 0.169920489f},
-std::array<float,2>{0.831270158f, 0.875789881f},
-std::array<float,2>{0.58029443f, 0.454354286f},
-std::array<float,2>{0.429270059f, 0.684933126f},
-std::array<float,2>{0.0294826683f, 0.391137153f},
-std::array<float,2>{0.917516351f, 0.74628669f},
-std::array<float,2>{0.628097713f, 0.225285262f},
-std::array<float,2>{0.307026148f, 0.960728824f},
-std::array<float,2>{0.455431312f, 0.0638132542f},
-std::array<float,2>{0.508114815f, 0.767155945f},
-std::array<float,2>{0.767826617f, 0.25291726f},
-std::array<float,2>{0.237055525f, 0.560450435f},
-std::array<float,2>{0.319870085f, 0.467053771f},
-std::array<float,2>{0.73285383f, 0.672102928f},
-std::array<float,2>{0.995619237f, 0.159176007f},
-std::array<float,2>{0.0907710046f, 0.884672105f},
-std::array<float,2>{0.146560892f, 0.0038492023f},
-std::array<float,2>{0.844614327f, 0.857061505f},
-std::array<float,2>{0.606943011f, 0.354010522f},
-std::array<float,2>{0.401837647f, 0.6035586f},
-std::array<float,2>{0.0432391278f, 0.262693822f},
-std::array<float,2>{0.88352704f, 0.55202949f},
-std::array<float,2>{0.656926274f, 0.072284624f},
-std::array<float,2>{0.267553329f, 0.778435469f},
-std::array<float,2>{0.49800244f, 0.231724426f},
-std::array<float,2>{0.55728358f, 0.96332258f},
-std::array<float,2>{0.786793113f, 0.4037233f},
-std::array<float,2>{0.216445088f, 0.735412359f},
-std::array<float,2>{0.436762869f, 0.325383127f},
-std::array<float,2>{0.590174437f, 0.58794266f},
-std::array<float,2>{0.839128196f, 0.0612412319f},
-std::array<float,2>{0.173305228f, 0.813599885f},
-std::array<float,2>{0.0976996347f, 0.146641597f},
-std::array<float,2>{0.943831265f, 0.934260428f},
-std::array<float,2>{0.690150142f, 0.499166638f},
-std::array<float,2>{0.351535708f, 0.627773583f},
-std::array<float,2>{0.243730724f, 0.42602855f},
-std::array<float,2>{0.773768187f, 0.718355417f},
-std::array<float,2>{0.507013261f, 0.208073542f},
-std::array<float,2>{0.464532703f, 0.974825144f},
-std::array<float,2>{0.297694534f, 0.103961267f},
-std::array<float,2>{0.634189069f, 0.789135635f},
-std::array<float,2>{0.912271917f, 0.291262716f},
-std::array<float,2>{0.0184218977f, 0.500931442f},
-std::array<float,2>{0.446532309f, 0.388736367f},
-std::array<float,2>{0.520585895f, 0.725217581f},
-std::array<float,2>{0.756200016f, 0.249758109f},
-std::array<float,2>{0.231082007f, 0.947374284f},
-std::array<float,2>{0.00888521597f, 0.0920119062f},
-std::array<float,2>{0.935399711f, 0.760251462f},
-std::array<float,2>{0.650383174f, 0.273303717f},
-std::array<float,2>{0.289992839f, 0.533024073f},
-std::array<float,2>{0.157489225f, 0.37479347f},
-std::array<float,2>{0.821866214f, 0.619489491f},
-std::array<float,2>{0.570561409f, 0.0162100922f},
-std::array<float,2>{0.407231957f, 0.87393117f},
-std::array<float,2>{0.369168192f, 0.179710776f},
-std::array<float,2>{0.713519871f, 0.895539999f},
-std::array<float,2>{0.96222949f, 0.444419742f},
-std::array<float,2>{0.120609947f, 0.661848605f},
-std::array<float,2>{0.265577376f, 0.303042769f},
-std::array<float,2>{0.684254646f, 0.526183546f},
-std::array<float,2>{0.893655539f, 0.113965958f},
-std::array<float,2>{0.0624086149f, 0.805116177f},
-std::array<float,2>{0.188147962f, 0.190108001f},
-std::array<float,2>{0.804966867f, 0.993160963f},
-std::array<float,2>{0.538110852f, 0.410401851f},
-std::array<float,2>{0.472769678f, 0.691103935f},
-std::array<float,2>{0.0629301593f, 0.473747313f},
-std::array<float,2>{0.980389297f, 0.651867747f},
-std::array<float,2>{0.736544907f, 0.125366077f},
-std::array<float,2>{0.329735637f, 0.915556908f},
-std::array<float,2>{0.389665872f, 0.0379987694f},
-std::array<float,2>{0.613620937f, 0.84055829f},
-std::array<float,2>{0.872894645f, 0.341597497f},
-std::array<float,2>{0.129696429f, 0.577328026f},
-std::array<float,2>{0.303791463f, 0.451332539f},
-std::array<float,2>{0.638168156f, 0.67178899f},
-std::array<float,2>{0.908617795f, 0.179628879f},
-std::array<float,2>{0.022575615f, 0.902054667f},
-std::array<float,2>{0.247814208f, 0.0278072376f},
-std::array<float,2>{0.779253602f, 0.865608752f},
-std::array<float,2>{0.502440095f, 0.362879366f},
-std::array<float,2>{0.46791482f, 0.615509391f},
-std::array<float,2>{0.0966714472f, 0.278065741f},
-std::array<float,2>{0.93835783f, 0.546400309f},
-std::array<float,2>{0.692777634f, 0.0836646706f},
-std::array<float,2>{0.343928665f, 0.756448984f},
-std::array<float,2>{0.433021396f, 0.239879087f},
-std::array<float,2>{0.586263299f, 0.937536895f},
-std::array<float,2>{0.84081769f, 0.377198577f},
-std::array<float,2>{0.178607672f, 0.729140043f},
-std::array<float,2>{0.495470345f, 0.332605332f},
-std::array<float,2>{0.560453773f, 0.569277346f},
-std::array<float,2>{0.781531036f, 0.0404139347f},
-std::array<float,2>{0.212725401f, 0.835075617f},
-std::array<float,2>{0.0428762548f, 0.137753114f},
-std::array<float,2>{0.889013171f, 0.911074281f},
-std::array<float,2>{0.6606161f, 0.482946545f},
-std::array<float,2>{0.272660285f, 0.644077599f},
-std::array<float,2>{0.143262982f, 0.415654451f},
-std::array<float,2>{0.848584533f, 0.701493263f},
-std::array<float,2>{0.602399111f, 0.202940553f},
-std::array<float,2>{0.402360976f, 0.986801386f},
-std::array<float,2>{0.313182056f, 0.124124423f},
-std::array<float,2>{0.729188085f, 0.798901081f},
-std::array<float,2>{0.998929858f, 0.311289608f},
-std::array<float,2>{0.0879226923f, 0.517550349f},
-std::array<float,2>{0.386461228f, 0.397986531f},
-std::array<float,2>{0.613270998f, 0.742970288f},
-std::array<float,2>{0.869839966f, 0.219930977f},
-std::array<float,2>{0.125018835f, 0.95325774f},
-std::array<float,2>{0.0675114319f, 0.0666959435f},
-std::array<float,2>{0.98218292f, 0.771816671f},
-std::array<float,2>{0.738772929f, 0.254505336f},
-std::array<float,2>{0.335621744f, 0.55733794f},
-std::array<float,2>{0.194405839f, 0.344753683f},
-std::array<float,2>{0.810682178f, 0.594595671f},
-std::array<float,2>{0.533229411f, 0.0120170843f},
-std::array<float,2>{0.469072789f, 0.845388174f},
-std::array<float,2>{0.261642456f, 0.166663244f},
-std::array<float,2>{0.680853307f, 0.880207717f},
-std::array<float,2>{0.896708667f, 0.460377634f},
-std::array<float,2>{0.0579403639f, 0.68309176f},
-std::array<float,2>{0.371174961f, 0.288442701f},
-std::array<float,2>{0.716721356f, 0.510348856f},
-std::array<float,2>{0.96867919f, 0.101285622f},
-std::array<float,2>{0.123781793f, 0.783250928f},
-std::array<float,2>{0.163372949f, 0.218400136f},
-std::array<float,2>{0.825240374f, 0.979055047f},
-std::array<float,2>{0.577721417f, 0.434290528f},
-std::array<float,2>{0.413160473f, 0.709492624f},
-std::array<float,2>{0.0120643247f, 0.485087812f},
-std::array<float,2>{0.931079566f, 0.63313669f},
-std::array<float,2>{0.655883551f, 0.152755663f},
-std::array<float,2>{0.293647766f, 0.923684895f},
-std::array<float,2>{0.451194912f, 0.0514381528f},
-std::array<float,2>{0.516028583f, 0.821051836f},
-std::array<float,2>{0.75258255f, 0.315490812f},
-std::array<float,2>{0.228869736f, 0.580316722f},
-std::array<float,2>{0.33871749f, 0.424693972f},
-std::array<float,2>{0.746059597f, 0.712132931f},
-std::array<float,2>{0.974144697f, 0.205547109f},
-std::array<float,2>{0.0738180578f, 0.971049905f},
-std::array<float,2>{0.13645114f, 0.107045263f},
-std::array<float,2>{0.862195313f, 0.793556929f},
-std::array<float,2>{0.619388223f, 0.293639332f},
-std::array<float,2>{0.376871258f, 0.506690443f},
-std::array<float,2>{0.0509916283f, 0.321009517f},
-std::array<float,2>{0.899253786f, 0.593301535f},
-std::array<float,2>{0.674362063f, 0.0584797151f},
-std::array<float,2>{0.254829526f, 0.818644464f},
-std::array<float,2>{0.480015069f, 0.141705737f},
-std::array<float,2>{0.54673022f, 0.933358431f},
-std::array<float,2>{0.799416363f, 0.494390935f},
-std::array<float,2>{0.199719399f, 0.630479693f},
-std::array<float,2>{0.421570539f, 0.258061826f},
-std::array<float,2>{0.567063749f, 0.549398124f},
-std::array<float,2>{0.815596998f, 0.0772504732f},
-std::array<float,2>{0.169122905f, 0.774258912f},
-std::array<float,2>{0.110603355f, 0.229746878f},
-std::array<float,2>{0.955745101f, 0.965453625f},
-std::array<float,2>{0.708200991f, 0.399722993f},
-std::array<float,2>{0.366209328f, 0.740206659f},
-std::array<float,2>{0.218829229f, 0.463041008f},
-std::array<float,2>{0.763467371f, 0.677459359f},
-std::array<float,2>{0.524929523f, 0.160864726f},
-std::array<float,2>{0.444216818f, 0.887698829f},
-std::array<float,2>{0.28706792f, 0.00734818447f},
-std::array<float,2>{0.644301116f, 0.852671981f},
-std::array<float,2>{0.926768541f, 0.356401265f},
-std::array<float,2>{0.00404181285f, 0.606445551f},
-std::array<float,2>{0.457906365f, 0.470894217f},
-std::array<float,2>{0.513920903f, 0.652761698f},
-std::array<float,2>{0.769759655f, 0.131862417f},
-std::array<float,2>{0.238511249f, 0.919191957f},
-std::array<float,2>{0.0252811667f, 0.0317976177f},
-std::array<float,2>{0.920286119f, 0.838157833f},
-std::array<float,2>{0.629188776f, 0.337094307f},
-std::array<float,2>{0.310686857f, 0.571993291f},
-std::array<float,2>{0.180895597f, 0.298087955f},
-std::array<float,2>{0.833862543f, 0.529838741f},
-std::array<float,2>{0.585928142f, 0.109467879f},
-std::array<float,2>{0.424183011f, 0.809672534f},
-std::array<float,2>{0.351857603f, 0.194259211f},
-std::array<float,2>{0.69591099f, 0.998405397f},
-std::array<float,2>{0.948295355f, 0.409256577f},
-std::array<float,2>{0.108676173f, 0.694812119f},
-std::array<float,2>{0.279128611f, 0.367885411f},
-std::array<float,2>{0.67108494f, 0.623251498f},
-std::array<float,2>{0.876124084f, 0.0207403805f},
-std::array<float,2>{0.038156122f, 0.86743927f},
-std::array<float,2>{0.208311394f, 0.186971337f},
-std::array<float,2>{0.790428281f, 0.894466817f},
-std::array<float,2>{0.550538361f, 0.440518796f},
-std::array<float,2>{0.486827224f, 0.657727838f},
-std::array<float,2>{0.0806683898f, 0.384360969f},
-std::array<float,2>{0.988801062f, 0.719805002f},
-std::array<float,2>{0.722795188f, 0.243821517f},
-std::array<float,2>{0.325312912f, 0.949670911f},
-std::array<float,2>{0.397154599f, 0.0880149826f},
-std::array<float,2>{0.596678317f, 0.762382984f},
-std::array<float,2>{0.856989324f, 0.268540144f},
-std::array<float,2>{0.153144091f, 0.538574219f},
-std::array<float,2>{0.251322925f, 0.37922284f},
-std::array<float,2>{0.678943574f, 0.731215239f},
-std::array<float,2>{0.9049142f, 0.236914679f},
-std::array<float,2>{0.0491995998f, 0.943036377f},
-std::array<float,2>{0.197885036f, 0.0796543136f},
-std::array<float,2>{0.800801933f, 0.750248551f},
-std::array<float,2>{0.539301217f, 0.27658233f},
-std::array<float,2>{0.48159194f, 0.541969836f},
-std::array<float,2>{0.0772721246f, 0.365129143f},
-std::array<float,2>{0.971356988f, 0.610934615f},
-std::array<float,2>{0.747767627f, 0.023755325f},
-std::array<float,2>{0.343330294f, 0.861367285f},
-std::array<float,2>{0.381596059f, 0.175050244f},
-std::array<float,2>{0.622427821f, 0.906074226f},
-std::array<float,2>{0.867028713f, 0.445349008f},
-std::array<float,2>{0.140134081f, 0.66519928f},
-std::array<float,2>{0.441264749f, 0.308470815f},
-std::array<float,2>{0.528804481f, 0.521110594f},
-std::array<float,2>{0.758002102f, 0.119322255f},
-std::array<float,2>{0.22563374f, 0.802980661f},
-std::array<float,2>{0.00254334579f, 0.196917295f},
-std::array<float,2>{0.922341049f, 0.989394188f},
-std::array<float,2>{0.647693992f, 0.419992596f},
-std::array<float,2>{0.283622682f, 0.697868764f},
-std::array<float,2>{0.167018831f, 0.478715241f},
-std::array<float,2>{0.816640854f, 0.64794004f},
-std::array<float,2>{0.565461576f, 0.133263707f},
-std::array<float,2>{0.415593892f, 0.908182144f},
-std::array<float,2>{0.36292395f, 0.0465514362f},
-std::array<float,2>{0.705347717f, 0.828409433f},
-std::array<float,2>{0.957749546f, 0.331578255f},
-std::array<float,2>{0.11644689f, 0.566153467f},
-std::array<float,2>{0.425972641f, 0.455245763f},
-std::array<float,2>{0.579522014f, 0.685924709f},
-std::array<float,2>{0.829513013f, 0.171111494f},
-std::array<float,2>{0.184547812f, 0.878627062f},
-std::array<float,2>{0.103947192f, 0.00834808778f},
-std::array<float,2>{0.951728821f, 0.848757625f},
-std::array<float,2>{0.702844322f, 0.349197328f},
-std::array<float,2>{0.357208133f, 0.601106346f},
-std::array<float,2>{0.235764906f, 0.250311345f},
-std::array<float,2>{0.766960502f, 0.560609758f},
-std::array<float,2>{0.511702478f, 0.0661121607f},
-std::array<float,2>{0.455066293f, 0.768821836f},
-std::array<float,2>{0.304861963f, 0.224213973f},
-std::array<float,2>{0.6253106f, 0.958664417f},
-std::array<float,2>{0.914800882f, 0.392803907f},
-std::array<float,2>{0.0275619645f, 0.749007642f},
-std::array<float,2>{0.321352154f, 0.320265919f},
-std::array<float,2>{0.720738411f, 0.582491457f},
-std::array<float,2>{0.986807287f, 0.0503403358f},
-std::array<float,2>{0.0823449939f, 0.825431049f},
-std::array<float,2>{0.150335893f, 0.152170599f},
-std::array<float,2>{0.854592502f, 0.927665174f},
-std::array<float,2>{0.601046562f, 0.491519213f},
-std::array<float,2>{0.394007325f, 0.638177812f},
-std::array<float,2>{0.0336255543f, 0.430404216f},
-std::array<float,2>{0.881315291f, 0.706163526f},
-std::array<float,2>{0.666750789f, 0.213945061f},
-std::array<float,2>{0.277076781f, 0.981290877f},
-std::array<float,2>{0.488648921f, 0.0941732675f},
-std::array<float,2>{0.55189532f, 0.786792874f},
-std::array<float,2>{0.794999182f, 0.285028964f},
-std::array<float,2>{0.204546779f, 0.51367867f},
-std::array<float,2>{0.348209918f, 0.497744322f},
-std::array<float,2>{0.689129293f, 0.625006318f},
-std::array<float,2>{0.941737592f, 0.146263272f},
-std::array<float,2>{0.100064829f, 0.935923338f},
-std::array<float,2>{0.175574139f, 0.0588976033f},
-std::array<float,2>{0.836080253f, 0.81465137f},
-std::array<float,2>{0.593000829f, 0.32707864f},
-std::array<float,2>{0.434005141f, 0.587051034f},
-std::array<float,2>{0.0158310253f, 0.290962249f},
-std::array<float,2>{0.911345959f, 0.503329337f},
-std::array<float,2>{0.634834588f, 0.10307093f},
-std::array<float,2>{0.299538851f, 0.79212147f},
-std::array<float,2>{0.462757438f, 0.209243238f},
-std::array<float,2>{0.504098475f, 0.973774314f},
-std::array<float,2>{0.775660753f, 0.428254694f},
-std::array<float,2>{0.244837999f, 0.716019809f},
-std::array<float,2>{0.398633152f, 0.352778971f},
-std::array<float,2>{0.608059943f, 0.601863384f},
-std::array<float,2>{0.845770359f, 0.00179449411f},
-std::array<float,2>{0.145497456f, 0.857787669f},
-std::array<float,2>{0.0927392244f, 0.156447098f},
-std::array<float,2>{0.994128942f, 0.88634485f},
-std::array<float,2>{0.730581939f, 0.465981483f},
-std::array<float,2>{0.316678047f, 0.673895776f},
-std::array<float,2>{0.218102813f, 0.404809177f},
-std::array<float,2>{0.787929773f, 0.737296522f},
-std::array<float,2>{0.555142641f, 0.233498409f},
-std::array<float,2>{0.49970299f, 0.962354839f},
-std::array<float,2>{0.268057019f, 0.0712784752f},
-std::array<float,2>{0.65952599f, 0.780802071f},
-std::array<float,2>{0.886640787f, 0.265100867f},
-std::array<float,2>{0.0449309237f, 0.553476155f},
-std::array<float,2>{0.475643426f, 0.412702918f},
-std::array<float,2>{0.535226107f, 0.689338982f},
-std::array<float,2>{0.807752967f, 0.187781334f},
-std::array<float,2>{0.189922258f, 0.995177865f},
-std::array<float,2>{0.0604913756f, 0.116925687f},
-std::array<float,2>{0.891067684f, 0.806693316f},
-std::array<float,2>{0.685581565f, 0.300867885f},
-std::array<float,2>{0.262204498f, 0.525069892f},
-std::array<float,2>{0.131998986f, 0.341845572f},
-std::array<float,2>{0.873889625f, 0.575199306f},
-std::array<float,2>{0.616990745f, 0.0354177803f},
-std::array<float,2>{0.386799544f, 0.842483759f},
-std::array<float,2>{0.331127703f, 0.127913564f},
-std::array<float,2>{0.734796107f, 0.917301476f},
-std::array<float,2>{0.977764487f, 0.475044698f},
-std::array<float,2>{0.0660529882f, 0.650068641f},
-std::array<float,2>{0.292831838f, 0.271108508f},
-std::array<float,2>{0.652194738f, 0.5347929f},
-std::array<float,2>{0.936246991f, 0.090535f},
-std::array<float,2>{0.0113190562f, 0.758503556f},
-std::array<float,2>{0.234179348f, 0.24726668f},
-std::array<float,2>{0.754510224f, 0.945844114f},
-std::array<float,2>{0.522605717f, 0.386869133f},
-std::array<float,2>{0.447768539f, 0.724544346f},
-std::array<float,2>{0.118541121f, 0.442491025f},
-std::array<float,2>{0.963694811f, 0.66217649f},
-std::array<float,2>{0.712346435f, 0.183532014f},
-std::array<float,2>{0.368404955f, 0.898195744f},
-std::array<float,2>{0.408715457f, 0.019349901f},
-std::array<float,2>{0.572662413f, 0.87224853f},
-std::array<float,2>{0.824041247f, 0.371587694f},
-std::array<float,2>{0.158662438f, 0.618004501f},
-std::array<float,2>{0.311117828f, 0.468869001f},
-std::array<float,2>{0.62953037f, 0.656087816f},
-std::array<float,2>{0.920612812f, 0.13004373f},
-std::array<float,2>{0.0246845465f, 0.920666218f},
-std::array<float,2>{0.238783121f, 0.034524098f},
-std::array<float,2>{0.770027041f, 0.836268604f},
-std::array<float,2>{0.514494061f, 0.339134842f},
-std::array<float,2>{0.457125455f, 0.573519468f},
-std::array<float,2>{0.108904921f, 0.299574524f},
-std::array<float,2>{0.949170291f, 0.527612269f},
-std::array<float,2>{0.695368052f, 0.112728335f},
-std::array<float,2>{0.352076441f, 0.81235677f},
-std::array<float,2>{0.424518913f, 0.191530526f},
-std::array<float,2>{0.585294783f, 0.996968389f},
-std::array<float,2>{0.833431184f, 0.406466216f},
-std::array<float,2>{0.181597307f, 0.692653358f},
-std::array<float,2>{0.486335099f, 0.370801002f},
-std::array<float,2>{0.55002588f, 0.621178985f},
-std::array<float,2>{0.791006565f, 0.0226245578f},
-std::array<float,2>{0.208711609f, 0.869209111f},
-std::array<float,2>{0.0386663154f, 0.185500115f},
-std::array<float,2>{0.876844764f, 0.890715361f},
-std::array<float,2>{0.671550214f, 0.439300776f},
-std::array<float,2>{0.278794259f, 0.65823251f},
-std::array<float,2>{0.152356654f, 0.385060072f},
-std::array<float,2>{0.85687089f, 0.72217226f},
-std::array<float,2>{0.595982134f, 0.245174304f},
-std::array<float,2>{0.396761f, 0.952106953f},
-std::array<float,2>{0.32615599f, 0.0872472972f},
-std::array<float,2>{0.723204672f, 0.763750911f},
-std::array<float,2>{0.988652468f, 0.266935199f},
-std::array<float,2>{0.0801782683f, 0.53552711f},
-std::array<float,2>{0.376165181f, 0.423285216f},
-std::array<float,2>{0.619803786f, 0.714223206f},
-std::array<float,2>{0.861514747f, 0.203239813f},
-std::array<float,2>{0.135996789f, 0.970462441f},
-std::array<float,2>{0.0736999512f, 0.108849086f},
-std::array<float,2>{0.973833621f, 0.796836972f},
-std::array<float,2>{0.745423555f, 0.29580766f},
-std::array<float,2>{0.338340193f, 0.505431831f},
-std::array<float,2>{0.199632764f, 0.323395461f},
-std::array<float,2>{0.799069524f, 0.590861201f},
-std::array<float,2>{0.546279669f, 0.0554742403f},
-std::array<float,2>{0.479906917f, 0.817076266f},
-std::array<float,2>{0.254337788f, 0.144256771f},
-std::array<float,2>{0.67398113f, 0.931161284f},
-std::array<float,2>{0.89857775f, 0.493179113f},
-std::array<float,2>{0.0516610742f, 0.632197261f},
-std::array<float,2>{0.365239799f, 0.259849995f},
-std::array<float,2>{0.708850026f, 0.547066867f},
-std::array<float,2>{0.955532908f, 0.0748471096f},
-std::array<float,2>{0.111184172f, 0.777101755f},
-std::array<float,2>{0.169528544f, 0.228058398f},
-std::array<float,2>{0.816036463f, 0.968209207f},
-std::array<float,2>{0.566513777f, 0.402140945f},
-std::array<float,2>{0.421330929f, 0.740626931f},
-std::array<float,2>{0.00458728569f, 0.462469816f},
-std::array<float,2>{0.927427113f, 0.678670824f},
-std::array<float,2>{0.643818736f, 0.163544267f},
-std::array<float,2>{0.286493182f, 0.889239848f},
-std::array<float,2>{0.443444759f, 0.00494887354f},
-std::array<float,2>{0.524765253f, 0.853964627f},
-std::array<float,2>{0.762708843f, 0.358918995f},
-std::array<float,2>{0.219377965f, 0.609065771f},
-std::array<float,2>{0.335055232f, 0.395085156f},
-std::array<float,2>{0.738629758f, 0.745387673f},
-std::array<float,2>{0.981742084f, 0.221430406f},
-std::array<float,2>{0.0682835951f, 0.955521643f},
-std::array<float,2>{0.125881076f, 0.068810679f},
-std::array<float,2>{0.869283259f, 0.770642936f},
-std::array<float,2>{0.612548411f, 0.257179856f},
-std::array<float,2>{0.385807216f, 0.555590808f},
-std::array<float,2>{0.0583282039f, 0.346726388f},
-std::array<float,2>{0.89703393f, 0.597587824f},
-std::array<float,2>{0.681285679f, 0.0152296852f},
-std::array<float,2>{0.260773867f, 0.847613275f},
-std::array<float,2>{0.469284952f, 0.164349779f},
-std::array<float,2>{0.533837616f, 0.881172657f},
-std::array<float,2>{0.811442673f, 0.458833307f},
-std::array<float,2>{0.195269793f, 0.679847181f},
-std::array<float,2>{0.413760215f, 0.285948902f},
-std::array<float,2>{0.577463984f, 0.508251965f},
-std::array<float,2>{0.826013625f, 0.0993302986f},
-std::array<float,2>{0.163616642f, 0.782256842f},
-std::array<float,2>{0.123058483f, 0.214851171f},
-std::array<float,2>{0.967888355f, 0.976626277f},
-std::array<float,2>{0.716188848f, 0.437215328f},
-std::array<float,2>{0.3718566f, 0.707827449f},
-std::array<float,2>{0.229265049f, 0.487859666f},
-std::array<float,2>{0.752116501f, 0.635950744f},
-std::array<float,2>{0.516513646f, 0.154509827f},
-std::array<float,2>{0.452127367f, 0.925415933f},
-std::array<float,2>{0.293283045f, 0.0542906076f},
-std::array<float,2>{0.655717432f, 0.822680235f},
-std::array<float,2>{0.931519866f, 0.31427297f},
-std::array<float,2>{0.0123529378f, 0.579337955f},
-std::array<float,2>{0.468337297f, 0.45072186f},
-std::array<float,2>{0.502882302f, 0.669382632f},
-std::array<float,2>{0.778512001f, 0.177537203f},
-std::array<float,2>{0.247471496f, 0.899447978f},
-std::array<float,2>{0.0231914353f, 0.0293766577f},
-std::array<float,2>{0.908939481f, 0.863964856f},
-std::array<float,2>{0.638531744f, 0.361061513f},
-std::array<float,2>{0.304504901f, 0.614480019f},
-std::array<float,2>{0.177829057f, 0.279553175f},
-std::array<float,2>{0.839961827f, 0.543919623f},
-std::array<float,2>{0.58655405f, 0.0842600167f},
-std::array<float,2>{0.433255613f, 0.753955901f},
-std::array<float,2>{0.344721705f, 0.241359353f},
-std::array<float,2>{0.692887723f, 0.940422356f},
-std::array<float,2>{0.937713027f, 0.375741959f},
-std::array<float,2>{0.0961346105f, 0.727499366f},
-std::array<float,2>{0.273397535f, 0.334811181f},
-std::array<float,2>{0.660928369f, 0.567973733f},
-std::array<float,2>{0.889419019f, 0.041056294f},
-std::array<float,2>{0.0421203934f, 0.832959294f},
-std::array<float,2>{0.212338179f, 0.139113069f},
-std::array<float,2>{0.781765699f, 0.913439929f},
-std::array<float,2>{0.559615672f, 0.48231867f},
-std::array<float,2>{0.496004641f, 0.640793502f},
-std::array<float,2>{0.0886732936f, 0.416816682f},
-std::array<float,2>{0.998188972f, 0.701143801f},
-std::array<float,2>{0.728613615f, 0.199798927f},
-std::array<float,2>{0.312874317f, 0.985960364f},
-std::array<float,2>{0.40298906f, 0.12219812f},
-std::array<float,2>{0.601805151f, 0.797197402f},
-std::array<float,2>{0.847806334f, 0.308812916f},
-std::array<float,2>{0.142726496f, 0.517967999f},
-std::array<float,2>{0.262443095f, 0.410823256f},
-std::array<float,2>{0.686383367f, 0.690868199f},
-std::array<float,2>{0.891157269f, 0.189929992f},
-std::array<float,2>{0.0595790148f, 0.992483497f},
-std::array<float,2>{0.190259129f, 0.113445774f},
-std::array<float,2>{0.808262348f, 0.805573225f},
-std::array<float,2>{0.536033332f, 0.303607047f},
-std::array<float,2>{0.476345837f, 0.525629401f},
-std::array<float,2>{0.0659109503f, 0.340869695f},
-std::array<float,2>{0.978435755f, 0.577857494f},
-std::array<float,2>{0.734948874f, 0.0374911651f},
-std::array<float,2>{0.331756413f, 0.839928269f},
-std::array<float,2>{0.387561768f, 0.125914037f},
-std::array<float,2>{0.616254747f, 0.915377736f},
-std::array<float,2>{0.873412967f, 0.474271864f},
-std::array<float,2>{0.13241896f, 0.651715398f},
-std::array<float,2>{0.44732374f, 0.272786468f},
-std::array<float,2>{0.523131251f, 0.532447755f},
-std::array<float,2>{0.75435406f, 0.0927482694f},
-std::array<float,2>{0.23382318f, 0.760473013f},
-std::array<float,2>{0.0108828144f, 0.249284759f},
-std::array<float,2>{0.935924768f, 0.948046386f},
-std::array<float,2>{0.651393235f, 0.38941884f},
-std::array<float,2>{0.292468339f, 0.725092053f},
-std::array<float,2>{0.15917027f, 0.445055693f},
-std::array<float,2>{0.823678315f, 0.661586046f},
-std::array<float,2>{0.572995126f, 0.180322796f},
-std::array<float,2>{0.408403039f, 0.896379173f},
-std::array<float,2>{0.368776619f, 0.0157233607f},
-std::array<float,2>{0.712540925f, 0.873143196f},
-std::array<float,2>{0.963100672f, 0.374087214f},
-std::array<float,2>{0.118934482f, 0.620098174f},
-std::array<float,2>{0.434233308f, 0.499856204f},
-std::array<float,2>{0.593729854f, 0.627294958f},
-std::array<float,2>{0.836544335f, 0.147284165f},
-std::array<float,2>{0.174822196f, 0.934038937f},
-std::array<float,2>{0.100430876f, 0.0609079897f},
-std::array<float,2>{0.942222774f, 0.814064085f},
-std::array<float,2>{0.688559473f, 0.32596159f},
-std::array<float,2>{0.34786734f, 0.588668942f},
-std::array<float,2>{0.244531602f, 0.291876644f},
-std::array<float,2>{0.775962234f, 0.500264525f},
-std::array<float,2>{0.504442036f, 0.104478642f},
-std::array<float,2>{0.462247938f, 0.789677441f},
-std::array<float,2>{0.299312323f, 0.208536714f},
-std::array<float,2>{0.635312378f, 0.975484371f},
-std::array<float,2>{0.911652744f, 0.426326752f},
-std::array<float,2>{0.01657038f, 0.717845201f},
-std::array<float,2>{0.317235619f, 0.353625149f},
-std::array<float,2>{0.731050193f, 0.60444206f},
-std::array<float,2>{0.993563414f, 0.00325315166f},
-std::array<float,2>{0.0921074897f, 0.856820047f},
-std::array<float,2>{0.144963712f, 0.158650637f},
-std::array<float,2>{0.846372426f, 0.884174287f},
-std::array<float,2>{0.607607901f, 0.46762079f},
-std::array<float,2>{0.399167359f, 0.672508538f},
-std::array<float,2>{0.0454805829f, 0.403995961f},
-std::array<float,2>{0.885784447f, 0.736020684f},
-std::array<float,2>{0.660001516f, 0.232290789f},
-std::array<float,2>{0.268478692f, 0.963676453f},
-std::array<float,2>{0.499152541f, 0.072897099f},
-std::array<float,2>{0.555405855f, 0.778863788f},
-std::array<float,2>{0.78720516f, 0.26218012f},
-std::array<float,2>{0.218546569f, 0.552619398f},
-std::array<float,2>{0.356836617f, 0.455066025f},
-std::array<float,2>{0.702516437f, 0.685290515f},
-std::array<float,2>{0.951231182f, 0.169011921f},
-std::array<float,2>{0.10423293f, 0.875000536f},
-std::array<float,2>{0.183660135f, 0.0108077107f},
-std::array<float,2>{0.830054402f, 0.851136148f},
-std::array<float,2>{0.58004272f, 0.350846678f},
-std::array<float,2>{0.426329195f, 0.59928757f},
-std::array<float,2>{0.0279925056f, 0.252339751f},
-std::array<float,2>{0.914307952f, 0.5598014f},
-std::array<float,2>{0.625892758f, 0.0643547624f},
-std::array<float,2>{0.305288881f, 0.766794682f},
-std::array<float,2>{0.454518884f, 0.224625349f},
-std::array<float,2>{0.511087418f, 0.960108042f},
-std::array<float,2>{0.767568707f, 0.390720844f},
-std::array<float,2>{0.235990182f, 0.746836483f},
-std::array<float,2>{0.394269198f, 0.316472471f},
-std::array<float,2>{0.601177394f, 0.58520484f},
-std::array<float,2>{0.85498935f, 0.0474753119f},
-std::array<float,2>{0.149613589f, 0.826273263f},
-std::array<float,2>{0.082934998f, 0.149625152f},
-std::array<float,2>{0.987109721f, 0.929257691f},
-std::array<float,2>{0.721438646f, 0.489888489f},
-std::array<float,2>{0.322160304f, 0.638979137f},
-std::array<float,2>{0.204843059f, 0.432472795f},
-std::array<float,2>{0.795502245f, 0.703444481f},
-std::array<float,2>{0.552625418f, 0.212065324f},
-std::array<float,2>{0.489074796f, 0.983737946f},
-std::array<float,2>{0.276442915f, 0.0969605595f},
-std::array<float,2>{0.666121304f, 0.787854612f},
-std::array<float,2>{0.881473184f, 0.282414615f},
-std::array<float,2>{0.033883132f, 0.512077987f},
-std::array<float,2>{0.482238173f, 0.382465541f},
-std::array<float,2>{0.539867997f, 0.732636869f},
-std::array<float,2>{0.801715612f, 0.234414414f},
-std::array<float,2>{0.197561204f, 0.944627404f},
-std::array<float,2>{0.0493404828f, 0.0805283412f},
-std::array<float,2>{0.904337525f, 0.75241065f},
-std::array<float,2>{0.679222524f, 0.274939984f},
-std::array<float,2>{0.251909405f, 0.539492726f},
-std::array<float,2>{0.140306115f, 0.367066145f},
-std::array<float,2>{0.866517186f, 0.612910271f},
-std::array<float,2>{0.622896731f, 0.0257710461f},
-std::array<float,2>{0.380927265f, 0.859400332f},
-std::array<float,2>{0.342861772f, 0.173066705f},
-std::array<float,2>{0.747388542f, 0.9037624f},
-std::array<float,2>{0.970961869f, 0.448624045f},
-std::array<float,2>{0.0779717937f, 0.666380286f},
-std::array<float,2>{0.283822328f, 0.304793447f},
-std::array<float,2>{0.64823401f, 0.523145914f},
-std::array<float,2>{0.922641098f, 0.117422126f},
-std::array<float,2>{0.00240748492f, 0.801853836f},
-std::array<float,2>{0.226209134f, 0.198837638f},
-std::array<float,2>{0.758531451f, 0.991869152f},
-std::array<float,2>{0.529015005f, 0.418160588f},
-std::array<float,2>{0.440518677f, 0.695319474f},
-std::array<float,2>{0.117155939f, 0.477639169f},
-std::array<float,2>{0.957361937f, 0.644868791f},
-std::array<float,2>{0.705858529f, 0.135647595f},
-std::array<float,2>{0.362607718f, 0.909611225f},
-std::array<float,2>{0.41509676f, 0.0430527292f},
-std::array<float,2>{0.566308439f, 0.83157593f},
-std::array<float,2>{0.817174971f, 0.330002606f},
-std::array<float,2>{0.16750057f, 0.56284517f},
-std::array<float,2>{0.281224161f, 0.440953612f},
-std::array<float,2>{0.669866562f, 0.657421708f},
-std::array<float,2>{0.87745744f, 0.187314048f},
-std::array<float,2>{0.0363414511f, 0.894036353f},
-std::array<float,2>{0.209233418f, 0.021106882f},
-std::array<float,2>{0.792868495f, 0.867885113f},
-std::array<float,2>{0.548144579f, 0.36763975f},
-std::array<float,2>{0.484671175f, 0.624020934f},
-std::array<float,2>{0.0781261325f, 0.268063396f},
-std::array<float,2>{0.990946889f, 0.53877455f},
-std::array<float,2>{0.726227045f, 0.0886946991f},
-std::array<float,2>{0.327730685f, 0.762056589f},
-std::array<float,2>{0.395418882f, 0.243511677f},
-std::array<float,2>{0.594592273f, 0.950166702f},
-std::array<float,2>{0.8579337f, 0.383964509f},
-std::array<float,2>{0.15594992f, 0.720274746f},
-std::array<float,2>{0.460338533f, 0.337662369f},
-std::array<float,2>{0.513617635f, 0.571397245f},
-std::array<float,2>{0.773347616f, 0.031529054f},
-std::array<float,2>{0.241013765f, 0.838801801f},
-std::array<float,2>{0.0272999648f, 0.132647052f},
-std::array<float,2>{0.918143868f, 0.919559419f},
-std::array<float,2>{0.632100999f, 0.471434444f},
-std::array<float,2>{0.310492933f, 0.653209746f},
-std::array<float,2>{0.18216686f, 0.409886301f},
-std::array<float,2>{0.834362924f, 0.695125103f},
-std::array<float,2>{0.582338095f, 0.193798602f},
-std::array<float,2>{0.422203332f, 0.998907745f},
-std::array<float,2>{0.354447037f, 0.109956957f},
-std::array<float,2>{0.697937727f, 0.810193956f},
-std::array<float,2>{0.947048664f, 0.298652917f},
-std::array<float,2>{0.106504537f, 0.529657602f},
-std::array<float,2>{0.419874042f, 0.400068462f},
-std::array<float,2>{0.569411099f, 0.73963964f},
-std::array<float,2>{0.812858403f, 0.230455831f},
-std::array<float,2>{0.171268851f, 0.964977026f},
-std::array<float,2>{0.112730518f, 0.0778895095f},
-std::array<float,2>{0.954340279f, 0.77367878f},
-std::array<float,2>{0.71005553f, 0.258461952f},
-std::array<float,2>{0.364020467f, 0.549086869f},
-std::array<float,2>{0.221220419f, 0.35565725f},
-std::array<float,2>{0.764659107f, 0.607242525f},
-std::array<float,2>{0.526040792f, 0.00701826392f},
-std::array<float,2>{0.443145722f, 0.853347063f},
-std::array<float,2>{0.289029002f, 0.160211474f},
-std::array<float,2>{0.642211139f, 0.888284743f},
-std::array<float,2>{0.929608107f, 0.463604748f},
-std::array<float,2>{0.00753726996f, 0.676798224f},
-std::array<float,2>{0.336220562f, 0.293047726f},
-std::array<float,2>{0.742655277f, 0.506106794f},
-std::array<float,2>{0.975987673f, 0.10673891f},
-std::array<float,2>{0.071807459f, 0.793296099f},
-std::array<float,2>{0.134206608f, 0.205960929f},
-std::array<float,2>{0.860159397f, 0.971231461f},
-std::array<float,2>{0.618066907f, 0.424219012f},
-std::array<float,2>{0.377871662f, 0.712445617f},
-std::array<float,2>{0.0539606623f, 0.494994313f},
-std::array<float,2>{0.901296616f, 0.630055428f},
-std::array<float,2>{0.672812521f, 0.142304078f},
-std::array<float,2>{0.257438153f, 0.93282032f},
-std::array<float,2>{0.477716178f, 0.0580720715f},
-std::array<float,2>{0.544103801f, 0.819321394f},
-std::array<float,2>{0.797318816f, 0.320614964f},
-std::array<float,2>{0.201900512f, 0.592922509f},
-std::array<float,2>{0.373923808f, 0.433794916f},
-std::array<float,2>{0.717631817f, 0.709201753f},
-std::array<float,2>{0.966022491f, 0.21807763f},
-std::array<float,2>{0.122753523f, 0.978936911f},
-std::array<float,2>{0.160517931f, 0.100892864f},
-std::array<float,2>{0.827242911f, 0.783758283f},
-std::array<float,2>{0.575947464f, 0.288617551f},
-std::array<float,2>{0.410892129f, 0.510097086f},
-std::array<float,2>{0.015496687f, 0.316217273f},
-std::array<float,2>{0.931942761f, 0.580725431f},
-std::array<float,2>{0.65252167f, 0.050887946f},
-std::array<float,2>{0.295424968f, 0.820503175f},
-std::array<float,2>{0.449734747f, 0.153073877f},
-std::array<float,2>{0.518581688f, 0.92310071f},
-std::array<float,2>{0.751932025f, 0.484657735f},
-std::array<float,2>{0.226732627f, 0.633421004f},
-std::array<float,2>{0.383207917f, 0.254261464f},
-std::array<float,2>{0.610828578f, 0.556955636f},
-std::array<float,2>{0.869056582f, 0.0673410073f},
-std::array<float,2>{0.127478823f, 0.772121549f},
-std::array<float,2>{0.0684624463f, 0.220593467f},
-std::array<float,2>{0.983425498f, 0.953950286f},
-std::array<float,2>{0.740528941f, 0.397714049f},
-std::array<float,2>{0.333066195f, 0.742566407f},
-std::array<float,2>{0.191862151f, 0.460511774f},
-std::array<float,2>{0.810312688f, 0.683515429f},
-std::array<float,2>{0.531695485f, 0.166349813f},
-std::array<float,2>{0.471009284f, 0.880485535f},
-std::array<float,2>{0.25918299f, 0.0126196761f},
-std::array<float,2>{0.68282479f, 0.844810009f},
-std::array<float,2>{0.896013379f, 0.345263362f},
-std::array<float,2>{0.055379305f, 0.594098687f},
-std::array<float,2>{0.492592216f, 0.482431084f},
-std::array<float,2>{0.562435865f, 0.643938124f},
-std::array<float,2>{0.784044743f, 0.138223708f},
-std::array<float,2>{0.21405755f, 0.910196066f},
-std::array<float,2>{0.0404093638f, 0.0406196602f},
-std::array<float,2>{0.887301683f, 0.835481644f},
-std::array<float,2>{0.663230479f, 0.332054526f},
-std::array<float,2>{0.269663692f, 0.568679452f},
-std::array<float,2>{0.140660405f, 0.310978711f},
-std::array<float,2>{0.851509392f, 0.516653478f},
-std::array<float,2>{0.603961885f, 0.124717183f},
-std::array<float,2>{0.405756831f, 0.79970932f},
-std::array<float,2>{0.315292746f, 0.202600047f},
-std::array<float,2>{0.727365553f, 0.987004519f},
-std::array<float,2>{0.996656418f, 0.41522342f},
-std::array<float,2>{0.0860235319f, 0.702106237f},
-std::array<float,2>{0.301582307f, 0.36266309f},
-std::array<float,2>{0.640276432f, 0.615788758f},
-std::array<float,2>{0.907428145f, 0.0279071387f},
-std::array<float,2>{0.0197281446f, 0.865872741f},
-std::array<float,2>{0.248811945f, 0.178835392f},
-std::array<float,2>{0.779685915f, 0.901408911f},
-std::array<float,2>{0.501567543f, 0.452079326f},
-std::array<float,2>{0.464974582f, 0.671135187f},
-std::array<float,2>{0.0945490822f, 0.377717316f},
-std::array<float,2>{0.940508962f, 0.728898287f},
-std::array<float,2>{0.695115626f, 0.2393547f},
-std::array<float,2>{0.347079426f, 0.938103616f},
-std::array<float,2>{0.430454373f, 0.0831366554f},
-std::array<float,2>{0.588771105f, 0.75618118f},
-std::array<float,2>{0.842078447f, 0.27735886f},
-std::array<float,2>{0.176379725f, 0.546186805f},
-std::array<float,2>{0.289172173f, 0.387585908f},
-std::array<float,2>{0.649839997f, 0.724010944f},
-std::array<float,2>{0.934887409f, 0.247749418f},
-std::array<float,2>{0.009688491f, 0.945589721f},
-std::array<float,2>{0.230554551f, 0.0899313018f},
-std::array<float,2>{0.756726265f, 0.758195698f},
-std::array<float,2>{0.521040201f, 0.270520091f},
-std::array<float,2>{0.447115511f, 0.53429395f},
-std::array<float,2>{0.120279975f, 0.371214271f},
-std::array<float,2>{0.96268791f, 0.617626727f},
-std::array<float,2>{0.713249803f, 0.0189281236f},
-std::array<float,2>{0.370054036f, 0.872978508f},
-std::array<float,2>{0.407767892f, 0.18283163f},
-std::array<float,2>{0.571025431f, 0.897519767f},
-std::array<float,2>{0.82151866f, 0.442980468f},
-std::array<float,2>{0.157840207f, 0.662799656f},
-std::array<float,2>{0.473343909f, 0.301445484f},
-std::array<float,2>{0.538989723f, 0.524455011f},
-std::array<float,2>{0.805560589f, 0.116373263f},
-std::array<float,2>{0.187974975f, 0.807191432f},
-std::array<float,2>{0.0618468001f, 0.188384801f},
-std::array<float,2>{0.894508839f, 0.995823383f},
-std::array<float,2>{0.684034169f, 0.412572205f},
-std::array<float,2>{0.264771372f, 0.688759327f},
-std::array<float,2>{0.128934786f, 0.475550532f},
-std::array<float,2>{0.872205317f, 0.649653554f},
-std::array<float,2>{0.614223599f, 0.127433181f},
-std::array<float,2>{0.390433908f, 0.917827427f},
-std::array<float,2>{0.329137534f, 0.0360473655f},
-std::array<float,2>{0.73717159f, 0.841880202f},
-std::array<float,2>{0.979544103f, 0.342605025f},
-std::array<float,2>{0.0633664951f, 0.575989723f},
-std::array<float,2>{0.401976019f, 0.466388434f},
-std::array<float,2>{0.606561542f, 0.674767613f},
-std::array<float,2>{0.843859076f, 0.156931043f},
-std::array<float,2>{0.1473995f, 0.885852337f},
-std::array<float,2>{0.09005218f, 0.00114143139f},
-std::array<float,2>{0.995270967f, 0.857958555f},
-std::array<float,2>{0.733231485f, 0.35311839f},
-std::array<float,2>{0.319409281f, 0.602383196f},
-std::array<float,2>{0.216136277f, 0.265305698f},
-std::array<float,2>{0.786232769f, 0.553121388f},
-std::array<float,2>{0.556728661f, 0.0707146451f},
-std::array<float,2>{0.497392535f, 0.780754983f},
-std::array<float,2>{0.266840428f, 0.233986363f},
-std::array<float,2>{0.656476498f, 0.962815404f},
-std::array<float,2>{0.88290602f, 0.404720485f},
-std::array<float,2>{0.0438940488f, 0.736530423f},
-std::array<float,2>{0.350657672f, 0.32656306f},
-std::array<float,2>{0.689693987f, 0.587507367f},
-std::array<float,2>{0.944115102f, 0.0592323728f},
-std::array<float,2>{0.0983472466f, 0.815350652f},
-std::array<float,2>{0.173741505f, 0.14551045f},
-std::array<float,2>{0.83978045f, 0.936432302f},
-std::array<float,2>{0.590664983f, 0.497436911f},
-std::array<float,2>{0.437453002f, 0.625675976f},
-std::array<float,2>{0.0180538669f, 0.428123236f},
-std::array<float,2>{0.912770748f, 0.716424048f},
-std::array<float,2>{0.634704292f, 0.20956029f},
-std::array<float,2>{0.297075897f, 0.974195123f},
-std::array<float,2>{0.464027286f, 0.102890536f},
-std::array<float,2>{0.507663667f, 0.792960465f},
-std::array<float,2>{0.774043441f, 0.290042937f},
-std::array<float,2>{0.243579477f, 0.503860176f},
-std::array<float,2>{0.322999954f, 0.492152512f},
-std::array<float,2>{0.720225155f, 0.63846606f},
-std::array<float,2>{0.986007452f, 0.151558399f},
-std::array<float,2>{0.0848577172f, 0.926822126f},
-std::array<float,2>{0.150416315f, 0.0502353199f},
-std::array<float,2>{0.851741254f, 0.825739861f},
-std::array<float,2>{0.599449694f, 0.319497555f},
-std::array<float,2>{0.39100796f, 0.582542002f},
-std::array<float,2>{0.0318511166f, 0.284459203f},
-std::array<float,2>{0.880383849f, 0.514368594f},
-std::array<float,2>{0.664788783f, 0.0944326371f},
-std::array<float,2>{0.273728639f, 0.786506355f},
-std::array<float,2>{0.491748661f, 0.214490965f},
-std::array<float,2>{0.553551257f, 0.980692506f},
-std::array<float,2>{0.793106496f, 0.430000365f},
-std::array<float,2>{0.206854701f, 0.706953466f},
-std::array<float,2>{0.428883851f, 0.348907411f},
-std::array<float,2>{0.580887079f, 0.600710452f},
-std::array<float,2>{0.831690669f, 0.00798787363f},
-std::array<float,2>{0.186997816f, 0.849187434f},
-std::array<float,2>{0.10294766f, 0.171823591f},
-std::array<float,2>{0.949672639f, 0.878177762f},
-std::array<float,2>{0.701164544f, 0.455742955f},
-std::array<float,2>{0.358242452f, 0.686061382f},
-std::array<float,2>{0.236516118f, 0.393410385f},
-std::array<float,2>{0.768510163f, 0.748466909f},
-std::array<float,2>{0.508318901f, 0.223853528f},
-std::array<float,2>{0.455752969f, 0.958485007f},
-std::array<float,2>{0.307173491f, 0.065552935f},
-std::array<float,2>{0.628670156f, 0.769123673f},
-std::array<float,2>{0.917374432f, 0.250534385f},
-std::array<float,2>{0.0302340034f, 0.561469436f},
-std::array<float,2>{0.438087016f, 0.420796126f},
-std::array<float,2>{0.529353261f, 0.697682142f},
-std::array<float,2>{0.761674523f, 0.196540356f},
-std::array<float,2>{0.22380653f, 0.990133464f},
-std::array<float,2>{0.000557274965f, 0.119684704f},
-std::array<float,2>{0.924950063f, 0.803240776f},
-std::array<float,2>{0.645612717f, 0.307734489f},
-std::array<float,2>{0.282080948f, 0.520632029f},
-std::array<float,2>{0.165989891f, 0.331093669f},
-std::array<float,2>{0.818579972f, 0.565761387f},
-std::array<float,2>{0.563856065f, 0.0461914688f},
-std::array<float,2>{0.416377068f, 0.829013109f},
-std::array<float,2>{0.35961172f, 0.133413836f},
-std::array<float,2>{0.703564763f, 0.907528996f},
-std::array<float,2>{0.960294902f, 0.479035079f},
-std::array<float,2>{0.113328375f, 0.648242652f},
-std::array<float,2>{0.252526522f, 0.27706629f},
-std::array<float,2>{0.676226258f, 0.541261911f},
-std::array<float,2>{0.903989494f, 0.0792517066f},
-std::array<float,2>{0.0470706001f, 0.750727057f},
-std::array<float,2>{0.196375549f, 0.236329198f},
-std::array<float,2>{0.80378741f, 0.942456782f},
-std::array<float,2>{0.542471945f, 0.379423022f},
-std::array<float,2>{0.484332263f, 0.730609298f},
-std::array<float,2>{0.0745865256f, 0.446104586f},
-std::array<float,2>{0.970470071f, 0.665967345f},
-std::array<float,2>{0.74897939f, 0.175466329f},
-std::array<float,2>{0.340277404f, 0.905606806f},
-std::array<float,2>{0.380792499f, 0.0242994763f},
-std::array<float,2>{0.624550223f, 0.861885428f},
-std::array<float,2>{0.863322377f, 0.364526629f},
-std::array<float,2>{0.136842623f, 0.610825121f},
-std::array<float,2>{0.256297708f, 0.493143857f},
-std::array<float,2>{0.673308909f, 0.631299615f},
-std::array<float,2>{0.901927233f, 0.143361062f},
-std::array<float,2>{0.0535181649f, 0.930045843f},
-std::array<float,2>{0.202205881f, 0.0560609624f},
-std::array<float,2>{0.798752844f, 0.817852437f},
-std::array<float,2>{0.543028951f, 0.323014528f},
-std::array<float,2>{0.476685107f, 0.589924037f},
-std::array<float,2>{0.0703178719f, 0.296213597f},
-std::array<float,2>{0.97552669f, 0.504665554f},
-std::array<float,2>{0.743361413f, 0.10799925f},
-std::array<float,2>{0.337080866f, 0.794945002f},
-std::array<float,2>{0.378801495f, 0.205024853f},
-std::array<float,2>{0.61841464f, 0.969103217f},
-std::array<float,2>{0.860635579f, 0.422162145f},
-std::array<float,2>{0.133567229f, 0.713584542f},
-std::array<float,2>{0.441577882f, 0.357670873f},
-std::array<float,2>{0.52665329f, 0.607658803f},
-std::array<float,2>{0.763891816f, 0.00455625588f},
-std::array<float,2>{0.221701697f, 0.854834974f},
-std::array<float,2>{0.00677640364f, 0.162241131f},
-std::array<float,2>{0.928621292f, 0.889712095f},
-std::array<float,2>{0.641325831f, 0.461026102f},
-std::array<float,2>{0.287464917f, 0.678928971f},
-std::array<float,2>{0.170834035f, 0.401164562f},
-std::array<float,2>{0.814448655f, 0.742008686f},
-std::array<float,2>{0.569307089f, 0.227170318f},
-std::array<float,2>{0.41798231f, 0.966853917f},
-std::array<float,2>{0.364609212f, 0.075955838f},
-std::array<float,2>{0.709087133f, 0.776340723f},
-std::array<float,2>{0.953736544f, 0.261085272f},
-std::array<float,2>{0.111364752f, 0.548397422f},
-std::array<float,2>{0.42308858f, 0.407639921f},
-std::array<float,2>{0.583391249f, 0.691867054f},
-std::array<float,2>{0.835227907f, 0.193213195f},
-std::array<float,2>{0.183039874f, 0.997517645f},
-std::array<float,2>{0.105847806f, 0.111361936f},
-std::array<float,2>{0.946202934f, 0.811067045f},
-std::array<float,2>{0.698805749f, 0.300154746f},
-std::array<float,2>{0.355189115f, 0.528679073f},
-std::array<float,2>{0.241762161f, 0.338510662f},
-std::array<float,2>{0.771894157f, 0.572444856f},
-std::array<float,2>{0.512683034f, 0.0339927673f},
-std::array<float,2>{0.459100962f, 0.837282002f},
-std::array<float,2>{0.309294969f, 0.129086956f},
-std::array<float,2>{0.631669998f, 0.921487272f},
-std::array<float,2>{0.919561446f, 0.470009804f},
-std::array<float,2>{0.0254936498f, 0.654575586f},
-std::array<float,2>{0.326848924f, 0.266509533f},
-std::array<float,2>{0.725142419f, 0.536633193f},
-std::array<float,2>{0.991518259f, 0.0859401897f},
-std::array<float,2>{0.0797826797f, 0.764969468f},
-std::array<float,2>{0.154722631f, 0.244814411f},
-std::array<float,2>{0.858415961f, 0.952577114f},
-std::array<float,2>{0.595009148f, 0.38664645f},
-std::array<float,2>{0.395950496f, 0.721327126f},
-std::array<float,2>{0.0360471122f, 0.437887937f},
-std::array<float,2>{0.87836802f, 0.660084486f},
-std::array<float,2>{0.668459654f, 0.183979794f},
-std::array<float,2>{0.280121535f, 0.892191887f},
-std::array<float,2>{0.485447377f, 0.0222509503f},
-std::array<float,2>{0.547605455f, 0.870353162f},
-std::array<float,2>{0.791140497f, 0.370003223f},
-std::array<float,2>{0.210204765f, 0.62223506f},
-std::array<float,2>{0.346223265f, 0.376878023f},
-std::array<float,2>{0.69387573f, 0.728093505f},
-std::array<float,2>{0.940306246f, 0.240917668f},
-std::array<float,2>{0.0947988704f, 0.941314459f},
-std::array<float,2>{0.177089885f, 0.0856864303f},
-std::array<float,2>{0.842884123f, 0.755449891f},
-std::array<float,2>{0.58943224f, 0.280810416f},
-std::array<float,2>{0.431121916f, 0.544200003f},
-std::array<float,2>{0.0214311089f, 0.359444141f},
-std::array<float,2>{0.906927884f, 0.613917232f},
-std::array<float,2>{0.639394045f, 0.0304676723f},
-std::array<float,2>{0.302411169f, 0.864731431f},
-std::array<float,2>{0.46626693f, 0.175886452f},
-std::array<float,2>{0.500678003f, 0.898526728f},
-std::array<float,2>{0.780912578f, 0.449973851f},
-std::array<float,2>{0.249849349f, 0.668612719f},
-std::array<float,2>{0.404830456f, 0.309731752f},
-std::array<float,2>{0.604674876f, 0.519340992f},
-std::array<float,2>{0.85054487f, 0.121958785f},
-std::array<float,2>{0.142136365f, 0.798750103f},
-std::array<float,2>{0.0875171497f, 0.200503901f},
-std::array<float,2>{0.998040318f, 0.984829783f},
-std::array<float,2>{0.727569997f, 0.41796279f},
-std::array<float,2>{0.316338211f, 0.699539542f},
-std::array<float,2>{0.213548288f, 0.481069595f},
-std::array<float,2>{0.785062432f, 0.642352641f},
-std::array<float,2>{0.561064124f, 0.139831379f},
-std::array<float,2>{0.494031042f, 0.91258651f},
-std::array<float,2>{0.270738751f, 0.0423393212f},
-std::array<float,2>{0.662879646f, 0.833433151f},
-std::array<float,2>{0.888190806f, 0.335431337f},
-std::array<float,2>{0.0392388441f, 0.567246079f},
-std::array<float,2>{0.471709579f, 0.457940876f},
-std::array<float,2>{0.532492518f, 0.680797875f},
-std::array<float,2>{0.808869004f, 0.165732488f},
-std::array<float,2>{0.193162352f, 0.882065237f},
-std::array<float,2>{0.0559875108f, 0.0141797857f},
-std::array<float,2>{0.895196617f, 0.846667409f},
-std::array<float,2>{0.682177901f, 0.346535206f},
-std::array<float,2>{0.258366764f, 0.596674681f},
-std::array<float,2>{0.128847525f, 0.256747872f},
-std::array<float,2>{0.868116617f, 0.556485236f},
-std::array<float,2>{0.609696984f, 0.069545947f},
-std::array<float,2>{0.384286076f, 0.77033186f},
-std::array<float,2>{0.332406074f, 0.221769705f},
-std::array<float,2>{0.742104173f, 0.95673722f},
-std::array<float,2>{0.983336031f, 0.396382898f},
-std::array<float,2>{0.0696720928f, 0.744993329f},
-std::array<float,2>{0.296603918f, 0.313328505f},
-std::array<float,2>{0.653330028f, 0.578195691f},
-std::array<float,2>{0.933001518f, 0.0529278107f},
-std::array<float,2>{0.0139833307f, 0.823877275f},
-std::array<float,2>{0.227926195f, 0.155997366f},
-std::array<float,2>{0.750735939f, 0.924242496f},
-std::array<float,2>{0.518355608f, 0.487197369f},
-std::array<float,2>{0.450989813f, 0.635021448f},
-std::array<float,2>{0.121743366f, 0.435706824f},
-std::array<float,2>{0.965524495f, 0.708834827f},
-std::array<float,2>{0.718189597f, 0.215938449f},
-std::array<float,2>{0.374085218f, 0.978424907f},
-std::array<float,2>{0.412100881f, 0.0978178382f},
-std::array<float,2>{0.574868679f, 0.782136321f},
-std::array<float,2>{0.826708078f, 0.286177397f},
-std::array<float,2>{0.161499262f, 0.509431899f},
-std::array<float,2>{0.298081189f, 0.427477479f},
-std::array<float,2>{0.633144915f, 0.717386782f},
-std::array<float,2>{0.913406551f, 0.207087085f},
-std::array<float,2>{0.0194697157f, 0.976285756f},
-std::array<float,2>{0.242708161f, 0.104504481f},
-std::array<float,2>{0.774549901f, 0.790163279f},
-std::array<float,2>{0.506268203f, 0.292190105f},
-std::array<float,2>{0.463528454f, 0.501638353f},
-std::array<float,2>{0.0988241509f, 0.324969649f},
-std::array<float,2>{0.944984555f, 0.589358866f},
-std::array<float,2>{0.691230774f, 0.0624781214f},
-std::array<float,2>{0.350010484f, 0.812962234f},
-std::array<float,2>{0.43589589f, 0.147479311f},
-std::array<float,2>{0.590853274f, 0.935542345f},
-std::array<float,2>{0.837923169f, 0.498514384f},
-std::array<float,2>{0.172245339f, 0.628082097f},
-std::array<float,2>{0.496436536f, 0.263095409f},
-std::array<float,2>{0.55858171f, 0.551399291f},
-std::array<float,2>{0.785789609f, 0.0733722225f},
-std::array<float,2>{0.215369239f, 0.777941167f},
-std::array<float,2>{0.044692263f, 0.230480537f},
-std::array<float,2>{0.883953929f, 0.964231133f},
-std::array<float,2>{0.657767117f, 0.402868032f},
-std::array<float,2>{0.266412884f, 0.734462678f},
-std::array<float,2>{0.148174673f, 0.467880934f},
-std::array<float,2>{0.844952524f, 0.673355281f},
-std::array<float,2>{0.606431305f, 0.160090789f},
-std::array<float,2>{0.400402069f, 0.883062541f},
-std::array<float,2>{0.319297671f, 0.0020082132f},
-std::array<float,2>{0.733521163f, 0.856130064f},
-std::array<float,2>{0.994271696f, 0.354654461f},
-std::array<float,2>{0.0912733525f, 0.605261683f},
-std::array<float,2>{0.389202833f, 0.472900748f},
-std::array<float,2>{0.615019441f, 0.651224554f},
-std::array<float,2>{0.871908545f, 0.126297072f},
-std::array<float,2>{0.130533338f, 0.914272368f},
-std::array<float,2>{0.0639698878f, 0.0385567136f},
-std::array<float,2>{0.979353845f, 0.841300666f},
-std::array<float,2>{0.738168299f, 0.340094179f},
-std::array<float,2>{0.329073638f, 0.577023625f},
-std::array<float,2>{0.189063296f, 0.304179847f},
-std::array<float,2>{0.805685401f, 0.526489496f},
-std::array<float,2>{0.537858129f, 0.114865236f},
-std::array<float,2>{0.473905861f, 0.806299746f},
-std::array<float,2>{0.264494538f, 0.191366538f},
-std::array<float,2>{0.685205817f, 0.994033575f},
-std::array<float,2>{0.893514931f, 0.411990166f},
-std::array<float,2>{0.0614772588f, 0.689617932f},
-std::array<float,2>{0.370627731f, 0.373514056f},
-std::array<float,2>{0.714193285f, 0.620271027f},
-std::array<float,2>{0.96118629f, 0.0166571196f},
-std::array<float,2>{0.119767457f, 0.874800742f},
-std::array<float,2>{0.156643093f, 0.180953383f},
-std::array<float,2>{0.820579052f, 0.894792974f},
-std::array<float,2>{0.571503878f, 0.443903267f},
-std::array<float,2>{0.406662315f, 0.660524011f},
-std::array<float,2>{0.00862300582f, 0.390226722f},
-std::array<float,2>{0.933627605f, 0.726125538f},
-std::array<float,2>{0.649401188f, 0.248064443f},
-std::array<float,2>{0.290231854f, 0.94912976f},
-std::array<float,2>{0.44538632f, 0.0936838016f},
-std::array<float,2>{0.520096362f, 0.760881543f},
-std::array<float,2>{0.75696826f, 0.271509945f},
-std::array<float,2>{0.231483608f, 0.531980693f},
-std::array<float,2>{0.341077358f, 0.447525233f},
-std::array<float,2>{0.74902904f, 0.667173505f},
-std::array<float,2>{0.969512522f, 0.172240719f},
-std::array<float,2>{0.0758761764f, 0.902486622f},
-std::array<float,2>{0.137984529f, 0.0267383549f},
-std::array<float,2>{0.864550471f, 0.861278713f},
-std::array<float,2>{0.623874485f, 0.365677476f},
-std::array<float,2>{0.379818439f, 0.61187005f},
-std::array<float,2>{0.0485281125f, 0.273731947f},
-std::array<float,2>{0.902519822f, 0.540863931f},
-std::array<float,2>{0.676864386f, 0.0814401209f},
-std::array<float,2>{0.253546536f, 0.75329572f},
-std::array<float,2>{0.482687861f, 0.235594347f},
-std::array<float,2>{0.541535854f, 0.944082916f},
-std::array<float,2>{0.802796781f, 0.381377935f},
-std::array<float,2>{0.195539758f, 0.734002411f},
-std::array<float,2>{0.41785863f, 0.328760326f},
-std::array<float,2>{0.563395321f, 0.563767552f},
-std::array<float,2>{0.819443464f, 0.0439866446f},
-std::array<float,2>{0.164670274f, 0.830086231f},
-std::array<float,2>{0.114794761f, 0.135924742f},
-std::array<float,2>{0.959923923f, 0.908213794f},
-std::array<float,2>{0.704876959f, 0.476647854f},
-std::array<float,2>{0.361276746f, 0.645895064f},
-std::array<float,2>{0.222997695f, 0.419236988f},
-std::array<float,2>{0.760200679f, 0.696991086f},
-std::array<float,2>{0.530303657f, 0.197616577f},
-std::array<float,2>{0.439386904f, 0.990607619f},
-std::array<float,2>{0.282453477f, 0.11851722f},
-std::array<float,2>{0.645365179f, 0.801055849f},
-std::array<float,2>{0.924065113f, 0.305711001f},
-std::array<float,2>{0.00194545707f, 0.522232771f},
-std::array<float,2>{0.456511497f, 0.391619116f},
-std::array<float,2>{0.509152472f, 0.747387767f},
-std::array<float,2>{0.769222379f, 0.225924045f},
-std::array<float,2>{0.237644076f, 0.959669888f},
-std::array<float,2>{0.0303897336f, 0.0630976111f},
-std::array<float,2>{0.916644335f, 0.76583904f},
-std::array<float,2>{0.627156317f, 0.253849983f},
-std::array<float,2>{0.30848828f, 0.559092939f},
-std::array<float,2>{0.186513528f, 0.349866837f},
-std::array<float,2>{0.830441594f, 0.597807467f},
-std::array<float,2>{0.581571639f, 0.0102821225f},
-std::array<float,2>{0.427862138f, 0.849995255f},
-std::array<float,2>{0.358507007f, 0.168329433f},
-std::array<float,2>{0.699669659f, 0.876921058f},
-std::array<float,2>{0.950269699f, 0.453489363f},
-std::array<float,2>{0.101996697f, 0.683983743f},
-std::array<float,2>{0.275310278f, 0.281899422f},
-std::array<float,2>{0.665473819f, 0.513507307f},
-std::array<float,2>{0.879093051f, 0.0965050906f},
-std::array<float,2>{0.032746572f, 0.788871109f},
-std::array<float,2>{0.205455884f, 0.211831659f},
-std::array<float,2>{0.794485748f, 0.982769549f},
-std::array<float,2>{0.554109931f, 0.432878613f},
-std::array<float,2>{0.490458131f, 0.705021739f},
-std::array<float,2>{0.0858552828f, 0.489028573f},
-std::array<float,2>{0.984943092f, 0.639725268f},
-std::array<float,2>{0.719695866f, 0.14857924f},
-std::array<float,2>{0.323852628f, 0.928636909f},
-std::array<float,2>{0.392063648f, 0.0478994288f},
-std::array<float,2>{0.598125279f, 0.827291608f},
-std::array<float,2>{0.852788448f, 0.317471474f},
-std::array<float,2>{0.151509762f, 0.584602952f},
-std::array<float,2>{0.286048025f, 0.463923305f},
-std::array<float,2>{0.642943084f, 0.676638246f},
-std::array<float,2>{0.926567316f, 0.161494166f},
-std::array<float,2>{0.00579541922f, 0.887605667f},
-std::array<float,2>{0.220454872f, 0.00652057258f},
-std::array<float,2>{0.762607872f, 0.852218628f},
-std::array<float,2>{0.52429682f, 0.357150376f},
-std::array<float,2>{0.445090681f, 0.6059376f},
-std::array<float,2>{0.109464802f, 0.259063542f},
-std::array<float,2>{0.956783056f, 0.549923062f},
-std::array<float,2>{0.707121551f, 0.0762877986f},
-std::array<float,2>{0.366810232f, 0.775170565f},
-std::array<float,2>{0.420203835f, 0.228591397f},
-std::array<float,2>{0.568110228f, 0.966311336f},
-std::array<float,2>{0.814988434f, 0.39899078f},
-std::array<float,2>{0.16817145f, 0.738991976f},
-std::array<float,2>{0.478914827f, 0.321706206f},
-std::array<float,2>{0.545173287f, 0.592593253f},
-std::array<float,2>{0.800481617f, 0.0572866984f},
-std::array<float,2>{0.200791433f, 0.819554806f},
-std::array<float,2>{0.0525792278f, 0.141510114f},
-std::array<float,2>{0.899632514f, 0.932373762f},
-std::array<float,2>{0.675315976f, 0.495578617f},
-std::array<float,2>{0.255157113f, 0.629096091f},
-std::array<float,2>{0.134841368f, 0.425695926f},
-std::array<float,2>{0.863142312f, 0.710983336f},
-std::array<float,2>{0.620553732f, 0.206505939f},
-std::array<float,2>{0.375834525f, 0.971715987f},
-std::array<float,2>{0.339455098f, 0.106390759f},
-std::array<float,2>{0.744567335f, 0.794152498f},
-std::array<float,2>{0.972736955f, 0.294483095f},
-std::array<float,2>{0.0726259202f, 0.507389307f},
-std::array<float,2>{0.397683918f, 0.383483469f},
-std::array<float,2>{0.597300649f, 0.718904197f},
-std::array<float,2>{0.855786443f, 0.242325544f},
-std::array<float,2>{0.153995588f, 0.950878799f},
-std::array<float,2>{0.0815083534f, 0.0897837132f},
-std::array<float,2>{0.990112245f, 0.763225973f},
-std::array<float,2>{0.724270523f, 0.269195169f},
-std::array<float,2>{0.325074047f, 0.537495196f},
-std::array<float,2>{0.20750986f, 0.368804693f},
-std::array<float,2>{0.789924443f, 0.624318659f},
-std::array<float,2>{0.549381614f, 0.0196750648f},
-std::array<float,2>{0.487969637f, 0.868999898f},
-std::array<float,2>{0.278092086f, 0.185793266f},
-std::array<float,2>{0.670880079f, 0.893335879f},
-std::array<float,2>{0.875603676f, 0.440394402f},
-std::array<float,2>{0.0372543484f, 0.656792998f},
-std::array<float,2>{0.353418201f, 0.296916127f},
-std::array<float,2>{0.696832359f, 0.531058252f},
-std::array<float,2>{0.947546005f, 0.111097209f},
-std::array<float,2>{0.108169973f, 0.808687508f},
-std::array<float,2>{0.180060923f, 0.195294142f},
-std::array<float,2>{0.832362652f, 0.999566793f},
-std::array<float,2>{0.584660113f, 0.408561319f},
-std::array<float,2>{0.424898237f, 0.694119573f},
-std::array<float,2>{0.0240912344f, 0.472100824f},
-std::array<float,2>{0.921692848f, 0.654219568f},
-std::array<float,2>{0.630046904f, 0.131790057f},
-std::array<float,2>{0.31195578f, 0.918279946f},
-std::array<float,2>{0.458248585f, 0.0327729061f},
-std::array<float,2>{0.514687955f, 0.839529335f},
-std::array<float,2>{0.770763159f, 0.335977346f},
-std::array<float,2>{0.239546984f, 0.570864618f},
-std::array<float,2>{0.314178109f, 0.414570212f},
-std::array<float,2>{0.730371416f, 0.702377856f},
-std::array<float,2>{0.999837101f, 0.201865003f},
-std::array<float,2>{0.0894673988f, 0.988152742f},
-std::array<float,2>{0.143963501f, 0.123778574f},
-std::array<float,2>{0.848710001f, 0.800385296f},
-std::array<float,2>{0.603384495f, 0.311892569f},
-std::array<float,2>{0.403937489f, 0.516246259f},
-std::array<float,2>{0.0411732383f, 0.333937943f},
-std::array<float,2>{0.889735758f, 0.570042908f},
-std::array<float,2>{0.661205888f, 0.0398858227f},
-std::array<float,2>{0.271672606f, 0.834921896f},
-std::array<float,2>{0.494541019f, 0.137545571f},
-std::array<float,2>{0.559285641f, 0.911738992f},
-std::array<float,2>{0.783128381f, 0.483674318f},
-std::array<float,2>{0.211789519f, 0.642800748f},
-std::array<float,2>{0.431971282f, 0.279128045f},
-std::array<float,2>{0.586934805f, 0.545071661f},
-std::array<float,2>{0.84171015f, 0.0823479667f},
-std::array<float,2>{0.179099411f, 0.75732249f},
-std::array<float,2>{0.0970290899f, 0.238687173f},
-std::array<float,2>{0.938845932f, 0.938686967f},
-std::array<float,2>{0.691704988f, 0.378062755f},
-std::array<float,2>{0.345649689f, 0.729983747f},
-std::array<float,2>{0.246475965f, 0.452488929f},
-std::array<float,2>{0.77773118f, 0.67062372f},
-std::array<float,2>{0.502983451f, 0.178680703f},
-std::array<float,2>{0.467731684f, 0.900890708f},
-std::array<float,2>{0.30325824f, 0.0291351359f},
-std::array<float,2>{0.636787415f, 0.866500497f},
-std::array<float,2>{0.909851193f, 0.361948341f},
-std::array<float,2>{0.0215647463f, 0.616880119f},
-std::array<float,2>{0.452495813f, 0.48625505f},
-std::array<float,2>{0.517379403f, 0.633804023f},
-std::array<float,2>{0.753026664f, 0.15365155f},
-std::array<float,2>{0.2303112f, 0.922393501f},
-std::array<float,2>{0.0133427754f, 0.0522297285f},
-std::array<float,2>{0.929774582f, 0.82155627f},
-std::array<float,2>{0.654725254f, 0.314673871f},
-std::array<float,2>{0.294317335f, 0.581092536f},
-std::array<float,2>{0.16229333f, 0.287802726f},
-std::array<float,2>{0.824635744f, 0.51160562f},
-std::array<float,2>{0.576654792f, 0.100508064f},
-std::array<float,2>{0.41287446f, 0.784187317f},
-std::array<float,2>{0.373045594f, 0.217145085f},
-std::array<float,2>{0.715549827f, 0.980188906f},
-std::array<float,2>{0.967585504f, 0.434678018f},
-std::array<float,2>{0.124237262f, 0.71053791f},
-std::array<float,2>{0.260360926f, 0.344479293f},
-std::array<float,2>{0.6801337f, 0.595167279f},
-std::array<float,2>{0.897678494f, 0.0130116753f},
-std::array<float,2>{0.0569823049f, 0.844583452f},
-std::array<float,2>{0.194270551f, 0.167327806f},
-std::array<float,2>{0.812307954f, 0.879697263f},
-std::array<float,2>{0.534854472f, 0.459925294f},
-std::array<float,2>{0.469791859f, 0.681873977f},
-std::array<float,2>{0.0666739568f, 0.396956891f},
-std::array<float,2>{0.980960011f, 0.743315697f},
-std::array<float,2>{0.739435315f, 0.219674736f},
-std::array<float,2>{0.334644496f, 0.955006003f},
-std::array<float,2>{0.385380238f, 0.0674795434f},
-std::array<float,2>{0.612049103f, 0.772548318f},
-std::array<float,2>{0.870567322f, 0.255740821f},
-std::array<float,2>{0.126339108f, 0.558134198f},
-std::array<float,2>{0.268567353f, 0.405680388f},
-std::array<float,2>{0.658905685f, 0.737346888f},
-std::array<float,2>{0.885588408f, 0.232623458f},
-std::array<float,2>{0.046582751f, 0.961338878f},
-std::array<float,2>{0.217570454f, 0.0722160935f},
-std::array<float,2>{0.789020658f, 0.779988945f},
-std::array<float,2>{0.556060493f, 0.264324695f},
-std::array<float,2>{0.498454452f, 0.554166615f},
-std::array<float,2>{0.0936601311f, 0.351643205f},
-std::array<float,2>{0.992689371f, 0.603217065f},
-std::array<float,2>{0.7321105f, 0.000825104828f},
-std::array<float,2>{0.317508787f, 0.858690083f},
-std::array<float,2>{0.400039285f, 0.157787353f},
-std::array<float,2>{0.609245479f, 0.885072351f},
-std::array<float,2>{0.846745551f, 0.465686828f},
-std::array<float,2>{0.145647988f, 0.675495386f},
-std::array<float,2>{0.461546838f, 0.289097488f},
-std::array<float,2>{0.505270958f, 0.502625883f},
-std::array<float,2>{0.776519895f, 0.102278538f},
-std::array<float,2>{0.245639428f, 0.791235566f},
-std::array<float,2>{0.0172384288f, 0.210695758f},
-std::array<float,2>{0.910925329f, 0.97340256f},
-std::array<float,2>{0.636627257f, 0.429287434f},
-std::array<float,2>{0.30021143f, 0.714910865f},
-std::array<float,2>{0.173944265f, 0.496794194f},
-std::array<float,2>{0.837070763f, 0.626826048f},
-std::array<float,2>{0.591827631f, 0.145276606f},
-std::array<float,2>{0.435119003f, 0.936621845f},
-std::array<float,2>{0.349122018f, 0.0597524643f},
-std::array<float,2>{0.68796587f, 0.815894246f},
-std::array<float,2>{0.942522824f, 0.327488244f},
-std::array<float,2>{0.100924805f, 0.586561799f},
-std::array<float,2>{0.409798741f, 0.441810936f},
-std::array<float,2>{0.573943853f, 0.663325965f},
-std::array<float,2>{0.822346032f, 0.182282567f},
-std::array<float,2>{0.159606323f, 0.896672785f},
-std::array<float,2>{0.118005149f, 0.0183460247f},
-std::array<float,2>{0.964034438f, 0.871147215f},
-std::array<float,2>{0.711333454f, 0.372898817f},
-std::array<float,2>{0.367607564f, 0.618937314f},
-std::array<float,2>{0.232588485f, 0.269697338f},
-std::array<float,2>{0.755634367f, 0.533549488f},
-std::array<float,2>{0.521610975f, 0.091004394f},
-std::array<float,2>{0.448590606f, 0.759368837f},
-std::array<float,2>{0.291190624f, 0.246904954f},
-std::array<float,2>{0.650934279f, 0.947023332f},
-std::array<float,2>{0.937292874f, 0.388240367f},
-std::array<float,2>{0.0103633106f, 0.723429084f},
-std::array<float,2>{0.330342293f, 0.342877865f},
-std::array<float,2>{0.735708773f, 0.574825644f},
-std::array<float,2>{0.977462351f, 0.036363136f},
-std::array<float,2>{0.0652802065f, 0.843747675f},
-std::array<float,2>{0.131160483f, 0.128086179f},
-std::array<float,2>{0.874726236f, 0.916597307f},
-std::array<float,2>{0.615606785f, 0.47572425f},
-std::array<float,2>{0.388086617f, 0.648906529f},
-std::array<float,2>{0.0588661917f, 0.413281679f},
-std::array<float,2>{0.892087936f, 0.687832654f},
-std::array<float,2>{0.687143564f, 0.188774675f},
-std::array<float,2>{0.263515681f, 0.994784355f},
-std::array<float,2>{0.475151122f, 0.115260124f},
-std::array<float,2>{0.5366171f, 0.808592498f},
-std::array<float,2>{0.80714643f, 0.30189532f},
-std::array<float,2>{0.190799549f, 0.524073541f},
-std::array<float,2>{0.361550182f, 0.480074733f},
-std::array<float,2>{0.706561923f, 0.646537304f},
-std::array<float,2>{0.958435774f, 0.13466756f},
-std::array<float,2>{0.115599535f, 0.906816006f},
-std::array<float,2>{0.166885376f, 0.0451676324f},
-std::array<float,2>{0.81831044f, 0.82967329f},
-std::array<float,2>{0.565315247f, 0.330406636f},
-std::array<float,2>{0.414552391f, 0.56532377f},
-std::array<float,2>{0.00373628107f, 0.306696445f},
-std::array<float,2>{0.923522353f, 0.51954484f},
-std::array<float,2>{0.646606028f, 0.120655119f},
-std::array<float,2>{0.285117656f, 0.804114223f},
-std::array<float,2>{0.439957201f, 0.195861205f},
-std::array<float,2>{0.527945995f, 0.988837421f},
-std::array<float,2>{0.758876622f, 0.421831399f},
-std::array<float,2>{0.225038737f, 0.69838053f},
-std::array<float,2>{0.382804364f, 0.363440454f},
-std::array<float,2>{0.62136209f, 0.609655678f},
-std::array<float,2>{0.865439296f, 0.0246039927f},
-std::array<float,2>{0.13930662f, 0.863070428f},
-std::array<float,2>{0.0763410181f, 0.174056634f},
-std::array<float,2>{0.972394526f, 0.905005336f},
-std::array<float,2>{0.746292353f, 0.446562767f},
-std::array<float,2>{0.342010498f, 0.664879382f},
-std::array<float,2>{0.198865175f, 0.380425274f},
-std::array<float,2>{0.802224815f, 0.731792569f},
-std::array<float,2>{0.540247083f, 0.23811841f},
-std::array<float,2>{0.481067359f, 0.942377388f},
-std::array<float,2>{0.250821382f, 0.0782780573f},
-std::array<float,2>{0.678485394f, 0.751862288f},
-std::array<float,2>{0.905941367f, 0.276114881f},
-std::array<float,2>{0.0503091067f, 0.542416155f},
-std::array<float,2>{0.489600271f, 0.431336403f},
-std::array<float,2>{0.551147044f, 0.705480635f},
-std::array<float,2>{0.796723962f, 0.213784531f},
-std::array<float,2>{0.203794166f, 0.981759429f},
-std::array<float,2>{0.0342405662f, 0.0951158181f},
-std::array<float,2>{0.882696867f, 0.785474539f},
-std::array<float,2>{0.667252421f, 0.283771425f},
-std::array<float,2>{0.275666833f, 0.514752269f},
-std::array<float,2>{0.148502529f, 0.31901744f},
-std::array<float,2>{0.853994608f, 0.583538175f},
-std::array<float,2>{0.600299656f, 0.0494850874f},
-std::array<float,2>{0.393551737f, 0.824509025f},
-std::array<float,2>{0.320557326f, 0.150507733f},
-std::array<float,2>{0.72184068f, 0.926063657f},
-std::array<float,2>{0.987318516f, 0.490815818f},
-std::array<float,2>{0.0837130845f, 0.637452185f},
-std::array<float,2>{0.306400031f, 0.251444936f},
-std::array<float,2>{0.626087785f, 0.561607361f},
-std::array<float,2>{0.915867269f, 0.0645731986f},
-std::array<float,2>{0.0284269825f, 0.767673433f},
-std::array<float,2>{0.235000566f, 0.223595396f},
-std::array<float,2>{0.765794992f, 0.957096338f},
-std::array<float,2>{0.509948552f, 0.393767327f},
-std::array<float,2>{0.454080641f, 0.749132574f},
-std::array<float,2>{0.105267905f, 0.456904203f},
-std::array<float,2>{0.952821076f, 0.68702811f},
-std::array<float,2>{0.701596856f, 0.17012018f},
-std::array<float,2>{0.35605517f, 0.877569914f},
-std::array<float,2>{0.427520484f, 0.00937831588f},
-std::array<float,2>{0.578658998f, 0.848017216f},
-std::array<float,2>{0.828763485f, 0.348044455f},
-std::array<float,2>{0.184899837f, 0.60043478f},
-std::array<float,2>{0.284749568f, 0.478054762f},
-std::array<float,2>{0.646760762f, 0.645273685f},
-std::array<float,2>{0.923750103f, 0.135209739f},
-std::array<float,2>{0.00343697215f, 0.9097507f},
-std::array<float,2>{0.224652588f, 0.0438278243f},
-std::array<float,2>{0.759210348f, 0.831500828f},
-std::array<float,2>{0.528193951f, 0.329285413f},
-std::array<float,2>{0.440321267f, 0.563449085f},
-std::array<float,2>{0.115348645f, 0.305626035f},
-std::array<float,2>{0.958248138f, 0.522623062f},
-std::array<float,2>{0.706815183f, 0.117928408f},
-std::array<float,2>{0.361749858f, 0.802264929f},
-std::array<float,2>{0.414817214f, 0.198353931f},
-std::array<float,2>{0.56510824f, 0.991600037f},
-std::array<float,2>{0.817981839f, 0.418632984f},
-std::array<float,2>{0.166613877f, 0.696162641f},
-std::array<float,2>{0.48130244f, 0.366442025f},
-std::array<float,2>{0.540362179f, 0.612617671f},
-std::array<float,2>{0.801787019f, 0.0258888695f},
-std::array<float,2>{0.19905065f, 0.860348523f},
-std::array<float,2>{0.0506673232f, 0.173630655f},
-std::array<float,2>{0.906198561f, 0.904194653f},
-std::array<float,2>{0.678266168f, 0.449195206f},
-std::array<float,2>{0.250593513f, 0.666939914f},
-std::array<float,2>{0.139553472f, 0.382261038f},
-std::array<float,2>{0.865710914f, 0.732939422f},
-std::array<float,2>{0.621177256f, 0.235025346f},
-std::array<float,2>{0.382334232f, 0.945091605f},
-std::array<float,2>{0.342234582f, 0.0808328763f},
-std::array<float,2>{0.746554673f, 0.752641857f},
-std::array<float,2>{0.972574174f, 0.274535924f},
-std::array<float,2>{0.0765093416f, 0.53982383f},
-std::array<float,2>{0.393281639f, 0.431884468f},
-std::array<float,2>{0.600531638f, 0.703633666f},
-std::array<float,2>{0.853531778f, 0.212592125f},
-std::array<float,2>{0.148823798f, 0.984019816f},
-std::array<float,2>{0.0837930739f, 0.0972370058f},
-std::array<float,2>{0.987682402f, 0.787518024f},
-std::array<float,2>{0.722104788f, 0.282930404f},
-std::array<float,2>{0.320482552f, 0.512484133f},
-std::array<float,2>{0.203922436f, 0.317150831f},
-std::array<float,2>{0.796612382f, 0.585457981f},
-std::array<float,2>{0.550914407f, 0.0471464805f},
-std::array<float,2>{0.489472568f, 0.826818407f},
-std::array<float,2>{0.275573045f, 0.150102794f},
-std::array<float,2>{0.667221487f, 0.929163873f},
-std::array<float,2>{0.882454515f, 0.489743263f},
-std::array<float,2>{0.034572158f, 0.639301419f},
-std::array<float,2>{0.356391937f, 0.25263378f},
-std::array<float,2>{0.701199114f, 0.560257256f},
-std::array<float,2>{0.953114033f, 0.0635642856f},
-std::array<float,2>{0.105111606f, 0.767502725f},
-std::array<float,2>{0.184732392f, 0.225419238f},
-std::array<float,2>{0.829018593f, 0.960652769f},
-std::array<float,2>{0.578863859f, 0.391583264f},
-std::array<float,2>{0.427426755f, 0.746530116f},
-std::array<float,2>{0.0286889337f, 0.454147071f},
-std::array<float,2>{0.915705502f, 0.684592426f},
-std::array<float,2>{0.626417696f, 0.169600815f},
-std::array<float,2>{0.306156784f, 0.875554979f},
-std::array<float,2>{0.453673452f, 0.0116310455f},
-std::array<float,2>{0.510111511f, 0.85082829f},
-std::array<float,2>{0.766068161f, 0.351328313f},
-std::array<float,2>{0.235131428f, 0.598950744f},
-std::array<float,2>{0.317789644f, 0.403335929f},
-std::array<float,2>{0.732265234f, 0.735740364f},
-std::array<float,2>{0.993109703f, 0.23161988f},
-std::array<float,2>{0.0933155194f, 0.963129461f},
-std::array<float,2>{0.145967126f, 0.0727361217f},
-std::array<float,2>{0.84693414f, 0.778636277f},
-std::array<float,2>{0.609007657f, 0.262235969f},
-std::array<float,2>{0.400281459f, 0.551841259f},
-std::array<float,2>{0.0468336977f, 0.354378313f},
-std::array<float,2>{0.885427237f, 0.603854954f},
-std::array<float,2>{0.6591236f, 0.00341800856f},
-std::array<float,2>{0.269028246f, 0.857297361f},
-std::array<float,2>{0.498230875f, 0.158845782f},
-std::array<float,2>{0.555745363f, 0.884491503f},
-std::array<float,2>{0.78861779f, 0.467032641f},
-std::array<float,2>{0.217490911f, 0.672304809f},
-std::array<float,2>{0.435440511f, 0.291258514f},
-std::array<float,2>{0.592069626f, 0.500514209f},
-std::array<float,2>{0.837183118f, 0.103746414f},
-std::array<float,2>{0.174114674f, 0.789362133f},
-std::array<float,2>{0.100689009f, 0.208466485f},
-std::array<float,2>{0.942860603f, 0.974982202f},
-std::array<float,2>{0.687739432f, 0.425975978f},
-std::array<float,2>{0.349507302f, 0.718567967f},
-std::array<float,2>{0.246006608f, 0.499338239f},
-std::array<float,2>{0.776756465f, 0.627561629f},
-std::array<float,2>{0.504956007f, 0.146794155f},
-std::array<float,2>{0.461801261f, 0.934352517f},
-std::array<float,2>{0.299923986f, 0.06139661f},
-std::array<float,2>{0.636280596f, 0.813937128f},
-std::array<float,2>{0.910732508f, 0.325665921f},
-std::array<float,2>{0.0174013991f, 0.588156343f},
-std::array<float,2>{0.44829005f, 0.444681168f},
-std::array<float,2>{0.52184552f, 0.661910355f},
-std::array<float,2>{0.755410612f, 0.179961741f},
-std::array<float,2>{0.232667401f, 0.895964026f},
-std::array<float,2>{0.0105092609f, 0.0165433269f},
-std::array<float,2>{0.93714571f, 0.873597741f},
-std::array<float,2>{0.651201844f, 0.37452352f},
-std::array<float,2>{0.291272968f, 0.619293809f},
-std::array<float,2>{0.15918389f, 0.273083359f},
-std::array<float,2>{0.822538793f, 0.532727599f},
-std::array<float,2>{0.574052274f, 0.0922413841f},
-std::array<float,2>{0.410085499f, 0.759908676f},
-std::array<float,2>{0.367213637f, 0.249652594f},
-std::array<float,2>{0.711051822f, 0.947610736f},
-std::array<float,2>{0.964157104f, 0.388969004f},
-std::array<float,2>{0.11767859f, 0.725459695f},
-std::array<float,2>{0.263229758f, 0.341440201f},
-std::array<float,2>{0.687449038f, 0.577615559f},
-std::array<float,2>{0.891736329f, 0.0376724452f},
-std::array<float,2>{0.0586016476f, 0.840596378f},
-std::array<float,2>{0.190657914f, 0.125068203f},
-std::array<float,2>{0.807468474f, 0.916009963f},
-std::array<float,2>{0.536166549f, 0.4740448f},
-std::array<float,2>{0.475410014f, 0.65222919f},
-std::array<float,2>{0.0651653931f, 0.410310537f},
-std::array<float,2>{0.977193236f, 0.691352963f},
-std::array<float,2>{0.735365391f, 0.190274075f},
-std::array<float,2>{0.330285251f, 0.992715418f},
-std::array<float,2>{0.387832403f, 0.114133216f},
-std::array<float,2>{0.61523515f, 0.804723084f},
-std::array<float,2>{0.87475884f, 0.302942157f},
-std::array<float,2>{0.131014302f, 0.525992811f},
-std::array<float,2>{0.271781802f, 0.416218162f},
-std::array<float,2>{0.66156882f, 0.700491786f},
-std::array<float,2>{0.88990134f, 0.199612722f},
-std::array<float,2>{0.0414079241f, 0.985377967f},
-std::array<float,2>{0.211653098f, 0.122863486f},
-std::array<float,2>{0.782947838f, 0.797493756f},
-std::array<float,2>{0.559404016f, 0.309333503f},
-std::array<float,2>{0.494380623f, 0.5182814f},
-std::array<float,2>{0.0897620693f, 0.334320635f},
-std::array<float,2>{0.999672592f, 0.567404926f},
-std::array<float,2>{0.730178118f, 0.0419255309f},
-std::array<float,2>{0.314240754f, 0.832074702f},
-std::array<float,2>{0.40408501f, 0.139325798f},
-std::array<float,2>{0.603172243f, 0.913650513f},
-std::array<float,2>{0.849074721f, 0.481854886f},
-std::array<float,2>{0.143644631f, 0.641270816f},
-std::array<float,2>{0.467438459f, 0.279884368f},
-std::array<float,2>{0.503242671f, 0.543373942f},
-std::array<float,2>{0.777413607f, 0.0845594853f},
-std::array<float,2>{0.246162683f, 0.754501104f},
-std::array<float,2>{0.0218869764f, 0.241781294f},
-std::array<float,2>{0.909993768f, 0.939610779f},
-std::array<float,2>{0.636977017f, 0.3751598f},
-std::array<float,2>{0.303559721f, 0.726779699f},
-std::array<float,2>{0.178822249f, 0.450368613f},
-std::array<float,2>{0.841510475f, 0.669674814f},
-std::array<float,2>{0.587221622f, 0.177006721f},
-std::array<float,2>{0.431667835f, 0.900390565f},
-std::array<float,2>{0.345362693f, 0.030158598f},
-std::array<float,2>{0.691578567f, 0.863348365f},
-std::array<float,2>{0.938715994f, 0.36068055f},
-std::array<float,2>{0.0968215317f, 0.614920974f},
-std::array<float,2>{0.412754327f, 0.487409711f},
-std::array<float,2>{0.576289594f, 0.63645792f},
-std::array<float,2>{0.824397862f, 0.155087978f},
-std::array<float,2>{0.162469625f, 0.925228179f},
-std::array<float,2>{0.124449827f, 0.0538882613f},
-std::array<float,2>{0.96744132f, 0.823227465f},
-std::array<float,2>{0.715801358f, 0.313705146f},
-std::array<float,2>{0.37268579f, 0.579875231f},
-std::array<float,2>{0.230072752f, 0.285335779f},
-std::array<float,2>{0.753254056f, 0.508381784f},
-std::array<float,2>{0.51724273f, 0.0986717418f},
-std::array<float,2>{0.452242464f, 0.78271687f},
-std::array<float,2>{0.294109285f, 0.215812698f},
-std::array<float,2>{0.654513657f, 0.977122843f},
-std::array<float,2>{0.930145502f, 0.436642647f},
-std::array<float,2>{0.0136656025f, 0.707262397f},
-std::array<float,2>{0.334753633f, 0.347478539f},
-std::array<float,2>{0.739521146f, 0.596975207f},
-std::array<float,2>{0.981229544f, 0.0150397588f},
-std::array<float,2>{0.0665154904f, 0.846822083f},
-std::array<float,2>{0.12606065f, 0.164962336f},
-std::array<float,2>{0.870334625f, 0.881604731f},
-std::array<float,2>{0.612109303f, 0.458108455f},
-std::array<float,2>{0.3855308f, 0.680593014f},
-std::array<float,2>{0.0568372831f, 0.394815534f},
-std::array<float,2>{0.897757292f, 0.745794713f},
-std::array<float,2>{0.679789662f, 0.221061245f},
-std::array<float,2>{0.260681093f, 0.955859005f},
-std::array<float,2>{0.470148027f, 0.069165118f},
-std::array<float,2>{0.535143316f, 0.771158993f},
-std::array<float,2>{0.812094867f, 0.257337749f},
-std::array<float,2>{0.193992883f, 0.554972351f},
-std::array<float,2>{0.367091238f, 0.462349534f},
-std::array<float,2>{0.707277834f, 0.677961469f},
-std::array<float,2>{0.956887007f, 0.163635895f},
-std::array<float,2>{0.109830819f, 0.888808787f},
-std::array<float,2>{0.16826272f, 0.00549729588f},
-std::array<float,2>{0.815229774f, 0.854370117f},
-std::array<float,2>{0.568170965f, 0.35840553f},
-std::array<float,2>{0.420031309f, 0.608538151f},
-std::array<float,2>{0.00560320262f, 0.26068598f},
-std::array<float,2>{0.926502109f, 0.547784269f},
-std::array<float,2>{0.642697334f, 0.0744277164f},
-std::array<float,2>{0.285747051f, 0.776774108f},
-std::array<float,2>{0.444926411f, 0.227941111f},
-std::array<float,2>{0.524133384f, 0.968608558f},
-std::array<float,2>{0.762313604f, 0.40183714f},
-std::array<float,2>{0.220594168f, 0.740960658f},
-std::array<float,2>{0.375496387f, 0.324177325f},
-std::array<float,2>{0.620288193f, 0.591544807f},
-std::array<float,2>{0.862810194f, 0.0548639521f},
-std::array<float,2>{0.135093153f, 0.816739321f},
-std::array<float,2>{0.0723028108f, 0.143695101f},
-std::array<float,2>{0.973119378f, 0.930981874f},
-std::array<float,2>{0.744352281f, 0.49379155f},
-std::array<float,2>{0.339664012f, 0.632370412f},
-std::array<float,2>{0.201007798f, 0.423713088f},
-std::array<float,2>{0.800651431f, 0.714586198f},
-std::array<float,2>{0.544953346f, 0.203649402f},
-std::array<float,2>{0.478604168f, 0.970139802f},
-std::array<float,2>{0.254921794f, 0.109107748f},
-std::array<float,2>{0.675675929f, 0.796172619f},
-std::array<float,2>{0.899882972f, 0.295244664f},
-std::array<float,2>{0.0523074605f, 0.505135298f},
-std::array<float,2>{0.488104999f, 0.385550231f},
-std::array<float,2>{0.549769461f, 0.721969068f},
-std::array<float,2>{0.789672613f, 0.246008396f},
-std::array<float,2>{0.207233712f, 0.951597452f},
-std::array<float,2>{0.0373566486f, 0.0874317661f},
-std::array<float,2>{0.875830114f, 0.76434052f},
-std::array<float,2>{0.670470595f, 0.267189115f},
-std::array<float,2>{0.277951986f, 0.535964012f},
-std::array<float,2>{0.154058889f, 0.370355606f},
-std::array<float,2>{0.855493248f, 0.621935785f},
-std::array<float,2>{0.597461164f, 0.023140816f},
-std::array<float,2>{0.397934824f, 0.86970228f},
-std::array<float,2>{0.324949622f, 0.184785172f},
-std::array<float,2>{0.724609137f, 0.891145051f},
-std::array<float,2>{0.98990196f, 0.438643336f},
-std::array<float,2>{0.0812357143f, 0.658734977f},
-std::array<float,2>{0.311593443f, 0.299184978f},
-std::array<float,2>{0.630158007f, 0.528163433f},
-std::array<float,2>{0.921569586f, 0.113169208f},
-std::array<float,2>{0.0243592523f, 0.811811566f},
-std::array<float,2>{0.239478081f, 0.192374632f},
-std::array<float,2>{0.770531893f, 0.996451437f},
-std::array<float,2>{0.515074611f, 0.40706414f},
-std::array<float,2>{0.458282232f, 0.693057418f},
-std::array<float,2>{0.107930839f, 0.469694823f},
-std::array<float,2>{0.94750607f, 0.655661523f},
-std::array<float,2>{0.697047353f, 0.13070251f},
-std::array<float,2>{0.353179485f, 0.920269132f},
-std::array<float,2>{0.425114483f, 0.0348681286f},
-std::array<float,2>{0.584833264f, 0.836651921f},
-std::array<float,2>{0.832121491f, 0.339363873f},
-std::array<float,2>{0.179700807f, 0.574084222f},
-std::array<float,2>{0.253789723f, 0.44565779f},
-std::array<float,2>{0.677090347f, 0.665410042f},
-std::array<float,2>{0.902811885f, 0.175030753f},
-std::array<float,2>{0.0487550236f, 0.905990064f},
-std::array<float,2>{0.195671454f, 0.0235841218f},
-std::array<float,2>{0.802987576f, 0.861746907f},
-std::array<float,2>{0.541794538f, 0.364868194f},
-std::array<float,2>{0.48244223f, 0.611298859f},
-std::array<float,2>{0.0761691704f, 0.276679486f},
-std::array<float,2>{0.96932441f, 0.541567862f},
-std::array<float,2>{0.749399543f, 0.0798934177f},
-std::array<float,2>{0.341027588f, 0.75006026f},
-std::array<float,2>{0.37962544f, 0.237076104f},
-std::array<float,2>{0.623765409f, 0.94326067f},
-std::array<float,2>{0.864283025f, 0.379015088f},
-std::array<float,2>{0.137918591f, 0.730986714f},
-std::array<float,2>{0.438981712f, 0.331882715f},
-std::array<float,2>{0.530718803f, 0.566260338f},
-std::array<float,2>{0.759878457f, 0.0468698256f},
-std::array<float,2>{0.222865403f, 0.82835871f},
-std::array<float,2>{0.00157037564f, 0.132870495f},
-std::array<float,2>{0.92415607f, 0.907859623f},
-std::array<float,2>{0.645238101f, 0.478889674f},
-std::array<float,2>{0.282541603f, 0.64748615f},
-std::array<float,2>{0.164935529f, 0.420363247f},
-std::array<float,2>{0.819580138f, 0.698201001f},
-std::array<float,2>{0.563002527f, 0.197171465f},
-std::array<float,2>{0.41752246f, 0.989534914f},
-std::array<float,2>{0.36092335f, 0.119527005f},
-std::array<float,2>{0.704829574f, 0.802854359f},
-std::array<float,2>{0.959620237f, 0.308112144f},
-std::array<float,2>{0.115233019f, 0.521338105f},
-std::array<float,2>{0.428137809f, 0.392891169f},
-std::array<float,2>{0.581992388f, 0.74870187f},
-std::array<float,2>{0.830217123f, 0.224370271f},
-std::array<float,2>{0.186116442f, 0.958862185f},
-std::array<float,2>{0.101649858f, 0.0662209466f},
-std::array<float,2>{0.950585783f, 0.768643379f},
-std::array<float,2>{0.699278355f, 0.250068545f},
-std::array<float,2>{0.358713388f, 0.560866117f},
-std::array<float,2>{0.237453386f, 0.349541485f},
-std::array<float,2>{0.769289076f, 0.601366997f},
-std::array<float,2>{0.508953929f, 0.00858432427f},
-std::array<float,2>{0.45622921f, 0.849010289f},
-std::array<float,2>{0.308214426f, 0.17122516f},
-std::array<float,2>{0.627233982f, 0.878668964f},
-std::array<float,2>{0.916925788f, 0.455337375f},
-std::array<float,2>{0.0306601357f, 0.685578823f},
-std::array<float,2>{0.324001104f, 0.28489846f},
-std::array<float,2>{0.719385326f, 0.513944447f},
-std::array<float,2>{0.985260427f, 0.0938515589f},
-std::array<float,2>{0.0855266005f, 0.787074149f},
-std::array<float,2>{0.151782662f, 0.214113131f},
-std::array<float,2>{0.852767348f, 0.981037974f},
-std::array<float,2>{0.597657859f, 0.430557638f},
-std::array<float,2>{0.391646355f, 0.706470311f},
-std::array<float,2>{0.0330294706f, 0.491438746f},
-std::array<float,2>{0.879159749f, 0.637711525f},
-std::array<float,2>{0.665196955f, 0.152004719f},
-std::array<float,2>{0.274988443f, 0.927442193f},
-std::array<float,2>{0.490656018f, 0.0506279171f},
-std::array<float,2>{0.553874552f, 0.825511813f},
-std::array<float,2>{0.794681847f, 0.31998533f},
-std::array<float,2>{0.205113709f, 0.582058966f},
-std::array<float,2>{0.349812508f, 0.428688169f},
-std::array<float,2>{0.690982938f, 0.716217697f},
-std::array<float,2>{0.945068479f, 0.209010512f},
-std::array<float,2>{0.0990349948f, 0.973892689f},
-std::array<float,2>{0.172034338f, 0.10338103f},
-std::array<float,2>{0.838358939f, 0.792298317f},
-std::array<float,2>{0.591300488f, 0.290754139f},
-std::array<float,2>{0.43564716f, 0.503044248f},
-std::array<float,2>{0.0192005448f, 0.326801658f},
-std::array<float,2>{0.91310972f, 0.587304294f},
-std::array<float,2>{0.632875502f, 0.0587835349f},
-std::array<float,2>{0.298107952f, 0.814913511f},
-std::array<float,2>{0.463629901f, 0.146069765f},
-std::array<float,2>{0.505998135f, 0.935633719f},
-std::array<float,2>{0.774710238f, 0.497903496f},
-std::array<float,2>{0.243071362f, 0.625319362f},
-std::array<float,2>{0.400740892f, 0.264669389f},
-std::array<float,2>{0.606143296f, 0.553439498f},
-std::array<float,2>{0.845188916f, 0.0709818006f},
-std::array<float,2>{0.148259655f, 0.781147301f},
-std::array<float,2>{0.0908397064f, 0.233742699f},
-std::array<float,2>{0.994416833f, 0.962073803f},
-std::array<float,2>{0.733874023f, 0.405133218f},
-std::array<float,2>{0.319016576f, 0.736872256f},
-std::array<float,2>{0.215612158f, 0.466132194f},
-std::array<float,2>{0.786059499f, 0.674282312f},
-std::array<float,2>{0.558277428f, 0.156606793f},
-std::array<float,2>{0.496311635f, 0.886552095f},
-std::array<float,2>{0.266259551f, 0.00166463375f},
-std::array<float,2>{0.65802604f, 0.857470214f},
-std::array<float,2>{0.884225428f, 0.352883518f},
-std::array<float,2>{0.0446404852f, 0.601581454f},
-std::array<float,2>{0.473775834f, 0.474669456f},
-std::array<float,2>{0.537656486f, 0.650167346f},
-std::array<float,2>{0.805988729f, 0.127594516f},
-std::array<float,2>{0.189394623f, 0.917003214f},
-std::array<float,2>{0.06105702f, 0.0351826884f},
-std::array<float,2>{0.89308095f, 0.842575729f},
-std::array<float,2>{0.685373366f, 0.342229247f},
-std::array<float,2>{0.264212102f, 0.575483024f},
-std::array<float,2>{0.13072814f, 0.301172644f},
-std::array<float,2>{0.871774197f, 0.525207758f},
-std::array<float,2>{0.61493516f, 0.117088564f},
-std::array<float,2>{0.389603943f, 0.807123542f},
-std::array<float,2>{0.32883203f, 0.187674358f},
-std::array<float,2>{0.737871885f, 0.995395482f},
-std::array<float,2>{0.979185283f, 0.412879437f},
-std::array<float,2>{0.0643379241f, 0.689186275f},
-std::array<float,2>{0.290440679f, 0.371947646f},
-std::array<float,2>{0.64908421f, 0.617835462f},
-std::array<float,2>{0.933855474f, 0.019129023f},
-std::array<float,2>{0.00845374074f, 0.872406721f},
-std::array<float,2>{0.231851369f, 0.18330586f},
-std::array<float,2>{0.757272124f, 0.898133516f},
-std::array<float,2>{0.520500958f, 0.442735702f},
-std::array<float,2>{0.445652664f, 0.662476361f},
-std::array<float,2>{0.119964026f, 0.387065858f},
-std::array<float,2>{0.961081564f, 0.724127948f},
-std::array<float,2>{0.713890851f, 0.247338861f},
-std::array<float,2>{0.371035844f, 0.946200192f},
-std::array<float,2>{0.406457722f, 0.0908097774f},
-std::array<float,2>{0.571594357f, 0.758552074f},
-std::array<float,2>{0.820451081f, 0.271429449f},
-std::array<float,2>{0.156329706f, 0.535082102f},
-std::array<float,2>{0.302725971f, 0.376968831f},
-std::array<float,2>{0.639644086f, 0.729365766f},
-std::array<float,2>{0.907132804f, 0.240059718f},
-std::array<float,2>{0.0211127121f, 0.937836111f},
-std::array<float,2>{0.249569297f, 0.083827585f},
-std::array<float,2>{0.781143606f, 0.756777287f},
-std::array<float,2>{0.500891328f, 0.27810213f},
-std::array<float,2>{0.465837538f, 0.546785355f},
-std::array<float,2>{0.0951510593f, 0.363054305f},
-std::array<float,2>{0.939964831f, 0.615421653f},
-std::array<float,2>{0.694109678f, 0.0274119284f},
-std::array<float,2>{0.346633226f, 0.865258515f},
-std::array<float,2>{0.430728525f, 0.179275185f},
-std::array<float,2>{0.589833796f, 0.902160823f},
-std::array<float,2>{0.843237221f, 0.451464355f},
-std::array<float,2>{0.176916063f, 0.67155689f},
-std::array<float,2>{0.493828714f, 0.311245084f},
-std::array<float,2>{0.561490238f, 0.517159879f},
-std::array<float,2>{0.784770727f, 0.12447983f},
-std::array<float,2>{0.213771418f, 0.799185753f},
-std::array<float,2>{0.0393665433f, 0.20285356f},
-std::array<float,2>{0.888574839f, 0.986504316f},
-std::array<float,2>{0.6626302f, 0.415959805f},
-std::array<float,2>{0.270989239f, 0.701182663f},
-std::array<float,2>{0.142397508f, 0.483316183f},
-std::array<float,2>{0.850128472f, 0.644392252f},
-std::array<float,2>{0.604756415f, 0.138142228f},
-std::array<float,2>{0.405252635f, 0.9107548f},
-std::array<float,2>{0.316104323f, 0.0401521698f},
-std::array<float,2>{0.727949798f, 0.83525914f},
-std::array<float,2>{0.997600675f, 0.332819223f},
-std::array<float,2>{0.087774612f, 0.569074631f},
-std::array<float,2>{0.384570301f, 0.459994555f},
-std::array<float,2>{0.609481752f, 0.682775915f},
-std::array<float,2>{0.867753983f, 0.166824937f},
-std::array<float,2>{0.128532946f, 0.880115688f},
-std::array<float,2>{0.0695070699f, 0.0117885536f},
-std::array<float,2>{0.98295939f, 0.845553041f},
-std::array<float,2>{0.741712213f, 0.345057547f},
-std::array<float,2>{0.332266361f, 0.594454706f},
-std::array<float,2>{0.192881003f, 0.254777044f},
-std::array<float,2>{0.808601856f, 0.557488263f},
-std::array<float,2>{0.53227061f, 0.0664998293f},
-std::array<float,2>{0.472166002f, 0.771569908f},
-std::array<float,2>{0.258698136f, 0.220007628f},
-std::array<float,2>{0.682556689f, 0.95338279f},
-std::array<float,2>{0.895281553f, 0.398286611f},
-std::array<float,2>{0.0556757264f, 0.742763758f},
-std::array<float,2>{0.37444225f, 0.315836251f},
-std::array<float,2>{0.717913568f, 0.580435991f},
-std::array<float,2>{0.965661645f, 0.0517322607f},
-std::array<float,2>{0.121837869f, 0.820952415f},
-std::array<float,2>{0.16118069f, 0.15234448f},
-std::array<float,2>{0.827068806f, 0.923496306f},
-std::array<float,2>{0.575005651f, 0.485132009f},
-std::array<float,2>{0.411844611f, 0.63304764f},
-std::array<float,2>{0.0137665849f, 0.43442896f},
-std::array<float,2>{0.932725966f, 0.709829688f},
-std::array<float,2>{0.653752863f, 0.218639821f},
-std::array<float,2>{0.296823978f, 0.979249299f},
-std::array<float,2>{0.450847417f, 0.101418793f},
-std::array<float,2>{0.518100023f, 0.783516824f},
-std::array<float,2>{0.750704229f, 0.288307041f},
-std::array<float,2>{0.227565691f, 0.510679901f},
-std::array<float,2>{0.337234706f, 0.494152546f},
-std::array<float,2>{0.743520319f, 0.630626619f},
-std::array<float,2>{0.975275159f, 0.142080411f},
-std::array<float,2>{0.0705925524f, 0.93315053f},
-std::array<float,2>{0.133520544f, 0.0582891628f},
-std::array<float,2>{0.860470891f, 0.818595886f},
-std::array<float,2>{0.61840409f, 0.321107775f},
-std::array<float,2>{0.378613055f, 0.593550563f},
-std::array<float,2>{0.0533841178f, 0.293887615f},
-std::array<float,2>{0.902284741f, 0.506422639f},
-std::array<float,2>{0.673007905f, 0.107252218f},
-std::array<float,2>{0.256028384f, 0.793838143f},
-std::array<float,2>{0.476896405f, 0.205110788f},
-std::array<float,2>{0.543413699f, 0.970834553f},
-std::array<float,2>{0.798423111f, 0.424442172f},
-std::array<float,2>{0.202593878f, 0.712161422f},
-std::array<float,2>{0.418391317f, 0.356099755f},
-std::array<float,2>{0.5688501f, 0.606889486f},
-std::array<float,2>{0.814102173f, 0.00765588181f},
-std::array<float,2>{0.17055814f, 0.852961063f},
-std::array<float,2>{0.111744702f, 0.161103562f},
-std::array<float,2>{0.954074442f, 0.887996018f},
-std::array<float,2>{0.709372461f, 0.463329345f},
-std::array<float,2>{0.364485502f, 0.677516818f},
-std::array<float,2>{0.221939281f, 0.399440646f},
-std::array<float,2>{0.764003456f, 0.739957154f},
-std::array<float,2>{0.526395321f, 0.229547128f},
-std::array<float,2>{0.441751212f, 0.965586305f},
-std::array<float,2>{0.287292331f, 0.0775871798f},
-std::array<float,2>{0.641449273f, 0.774093032f},
-std::array<float,2>{0.928291917f, 0.257926702f},
-std::array<float,2>{0.00645326637f, 0.549769044f},
-std::array<float,2>{0.459278852f, 0.409538686f},
-std::array<float,2>{0.512365758f, 0.694420278f},
-std::array<float,2>{0.771517754f, 0.193901256f},
-std::array<float,2>{0.24202776f, 0.998176694f},
-std::array<float,2>{0.0257116444f, 0.109627612f},
-std::array<float,2>{0.919812918f, 0.809840262f},
-std::array<float,2>{0.63137579f, 0.298104674f},
-std::array<float,2>{0.309446216f, 0.530035913f},
-std::array<float,2>{0.182851017f, 0.337254286f},
-std::array<float,2>{0.835079253f, 0.572081149f},
-std::array<float,2>{0.583008349f, 0.0319897421f},
-std::array<float,2>{0.423318475f, 0.838075936f},
-std::array<float,2>{0.355431855f, 0.132313758f},
-std::array<float,2>{0.69918853f, 0.919156313f},
-std::array<float,2>{0.946023762f, 0.470988184f},
-std::array<float,2>{0.105656542f, 0.652395129f},
-std::array<float,2>{0.279871613f, 0.268213302f},
-std::array<float,2>{0.668929815f, 0.538112819f},
-std::array<float,2>{0.8779971f, 0.0882279947f},
-std::array<float,2>{0.0358456224f, 0.762532771f},
-std::array<float,2>{0.21041736f, 0.244034201f},
-std::array<float,2>{0.79133743f, 0.949246228f},
-std::array<float,2>{0.547661602f, 0.384659767f},
-std::array<float,2>{0.485772014f, 0.720035136f},
-std::array<float,2>{0.0799411684f, 0.440888584f},
-std::array<float,2>{0.991403997f, 0.658115804f},
-std::array<float,2>{0.725348711f, 0.186575726f},
-std::array<float,2>{0.327049196f, 0.894104958f},
-std::array<float,2>{0.395692974f, 0.020932164f},
-std::array<float,2>{0.594862759f, 0.867304146f},
-std::array<float,2>{0.858873487f, 0.368067265f},
-std::array<float,2>{0.154363662f, 0.623339236f},
-std::array<float,2>{0.273478538f, 0.488607317f},
-std::array<float,2>{0.664963424f, 0.640344322f},
-std::array<float,2>{0.880841076f, 0.14915143f},
-std::array<float,2>{0.032002721f, 0.927797079f},
-std::array<float,2>{0.206657544f, 0.0484799147f},
-std::array<float,2>{0.793316662f, 0.828056872f},
-std::array<float,2>{0.553371847f, 0.31829989f},
-std::array<float,2>{0.491988152f, 0.584235847f},
-std::array<float,2>{0.0845324844f, 0.281480998f},
-std::array<float,2>{0.986097097f, 0.513132215f},
-std::array<float,2>{0.72053045f, 0.0959450454f},
-std::array<float,2>{0.322946876f, 0.788406134f},
-std::array<float,2>{0.390779436f, 0.211092502f},
-std::array<float,2>{0.599153638f, 0.983236969f},
-std::array<float,2>{0.852020979f, 0.433560014f},
-std::array<float,2>{0.150759384f, 0.704455912f},
-std::array<float,2>{0.45587793f, 0.350512803f},
-std::array<float,2>{0.508570135f, 0.598360777f},
-std::array<float,2>{0.768134475f, 0.0102380365f},
-std::array<float,2>{0.236797795f, 0.850454152f},
-std::array<float,2>{0.0299384613f, 0.168845221f},
-std::array<float,2>{0.917161405f, 0.876278162f},
-std::array<float,2>{0.62864399f, 0.453983605f},
-std::array<float,2>{0.307510704f, 0.684264243f},
-std::array<float,2>{0.186687276f, 0.392328858f},
-std::array<float,2>{0.831799924f, 0.747877061f},
-std::array<float,2>{0.580801725f, 0.226326078f},
-std::array<float,2>{0.429084778f, 0.959453404f},
-std::array<float,2>{0.358002037f, 0.0627021566f},
-std::array<float,2>{0.700843871f, 0.766231f},
-std::array<float,2>{0.949461818f, 0.253339171f},
-std::array<float,2>{0.102758907f, 0.55871284f},
-std::array<float,2>{0.41601932f, 0.419880748f},
-std::array<float,2>{0.563498497f, 0.696610212f},
-std::array<float,2>{0.818705559f, 0.19802317f},
-std::array<float,2>{0.165651977f, 0.990723073f},
-std::array<float,2>{0.113708757f, 0.119037785f},
-std::array<float,2>{0.959997833f, 0.801670015f},
-std::array<float,2>{0.703351676f, 0.306332767f},
-std::array<float,2>{0.359684825f, 0.521744311f},
-std::array<float,2>{0.223963842f, 0.328177929f},
-std::array<float,2>{0.761248767f, 0.564415455f},
-std::array<float,2>{0.529585361f, 0.0445943028f},
-std::array<float,2>{0.438246727f, 0.830793679f},
-std::array<float,2>{0.281777412f, 0.136529192f},
-std::array<float,2>{0.645832539f, 0.908787072f},
-std::array<float,2>{0.925064862f, 0.477510214f},
-std::array<float,2>{0.000764913391f, 0.646157265f},
-std::array<float,2>{0.339910656f, 0.274186462f},
-std::array<float,2>{0.74857384f, 0.54045105f},
-std::array<float,2>{0.970250785f, 0.0819113478f},
-std::array<float,2>{0.0744456425f, 0.753542185f},
-std::array<float,2>{0.137160331f, 0.236302614f},
-std::array<float,2>{0.863627434f, 0.943644166f},
-std::array<float,2>{0.624838114f, 0.381168395f},
-std::array<float,2>{0.380397797f, 0.733402133f},
-std::array<float,2>{0.0473319702f, 0.448117942f},
-std::array<float,2>{0.904254258f, 0.667578816f},
-std::array<float,2>{0.675807834f, 0.172503456f},
-std::array<float,2>{0.252845675f, 0.903012216f},
-std::array<float,2>{0.484106004f, 0.0270030349f},
-std::array<float,2>{0.542061508f, 0.860628068f},
-std::array<float,2>{0.804116428f, 0.365787178f},
-std::array<float,2>{0.196633726f, 0.611599565f},
-std::array<float,2>{0.369643986f, 0.389821827f},
-std::array<float,2>{0.71292901f, 0.725752532f},
-std::array<float,2>{0.962495923f, 0.248947069f},
-std::array<float,2>{0.120409235f, 0.94851172f},
-std::array<float,2>{0.15807052f, 0.0930570662f},
-std::array<float,2>{0.821617901f, 0.761361659f},
-std::array<float,2>{0.571084738f, 0.272391945f},
-std::array<float,2>{0.408007324f, 0.531420052f},
-std::array<float,2>{0.00934985839f, 0.373855859f},
-std::array<float,2>{0.9347381f, 0.620761096f},
-std::array<float,2>{0.649551094f, 0.0175700951f},
-std::array<float,2>{0.289414555f, 0.874392867f},
-std::array<float,2>{0.446854442f, 0.181419238f},
-std::array<float,2>{0.521243334f, 0.895470321f},
-std::array<float,2>{0.756470859f, 0.443650991f},
-std::array<float,2>{0.230882972f, 0.66091007f},
-std::array<float,2>{0.390175164f, 0.304429561f},
-std::array<float,2>{0.614005208f, 0.526988924f},
-std::array<float,2>{0.872543991f, 0.114377551f},
-std::array<float,2>{0.129370257f, 0.80569011f},
-std::array<float,2>{0.063168548f, 0.190867648f},
-std::array<float,2>{0.979937375f, 0.993223071f},
-std::array<float,2>{0.736843288f, 0.411138147f},
-std::array<float,2>{0.329426765f, 0.690012455f},
-std::array<float,2>{0.187710077f, 0.473499894f},
-std::array<float,2>{0.805333257f, 0.650712132f},
-std::array<float,2>{0.538815737f, 0.12693502f},
-std::array<float,2>{0.473581076f, 0.914564192f},
-std::array<float,2>{0.26512596f, 0.0389299579f},
-std::array<float,2>{0.683714747f, 0.841341376f},
-std::array<float,2>{0.894242227f, 0.34041971f},
-std::array<float,2>{0.0615379214f, 0.576367021f},
-std::array<float,2>{0.497266173f, 0.468443155f},
-std::array<float,2>{0.557039917f, 0.67318815f},
-std::array<float,2>{0.786572218f, 0.15950501f},
-std::array<float,2>{0.216006488f, 0.883654773f},
-std::array<float,2>{0.0435251258f, 0.00278405612f},
-std::array<float,2>{0.883112609f, 0.855715573f},
-std::array<float,2>{0.656497657f, 0.355159074f},
-std::array<float,2>{0.266993642f, 0.604973972f},
-std::array<float,2>{0.147142172f, 0.263248473f},
-std::array<float,2>{0.844103694f, 0.550995767f},
-std::array<float,2>{0.606809556f, 0.0738253295f},
-std::array<float,2>{0.402238607f, 0.777440906f},
-std::array<float,2>{0.319789588f, 0.231404394f},
-std::array<float,2>{0.732919157f, 0.964810729f},
-std::array<float,2>{0.995545924f, 0.402608991f},
-std::array<float,2>{0.0902501047f, 0.73532027f},
-std::array<float,2>{0.297237039f, 0.324599355f},
-std::array<float,2>{0.634487569f, 0.589168429f},
-std::array<float,2>{0.913005412f, 0.0617284551f},
-std::array<float,2>{0.0177173931f, 0.813182652f},
-std::array<float,2>{0.243203998f, 0.148348868f},
-std::array<float,2>{0.774230063f, 0.934996188f},
-std::array<float,2>{0.50737536f, 0.498570561f},
-std::array<float,2>{0.464280963f, 0.62870127f},
-std::array<float,2>{0.0985787734f, 0.426962346f},
-std::array<float,2>{0.943879962f, 0.717216134f},
-std::array<float,2>{0.689902902f, 0.207966849f},
-std::array<float,2>{0.35103628f, 0.975791991f},
-std::array<float,2>{0.437175065f, 0.105097577f},
-std::array<float,2>{0.590541184f, 0.790600359f},
-std::array<float,2>{0.839372098f, 0.292564094f},
-std::array<float,2>{0.173389927f, 0.501095355f},
-std::array<float,2>{0.29575935f, 0.436276466f},
-std::array<float,2>{0.652722061f, 0.708033741f},
-std::array<float,2>{0.931730866f, 0.216470808f},
-std::array<float,2>{0.0151973646f, 0.977668226f},
-std::array<float,2>{0.226818681f, 0.0983329639f},
-std::array<float,2>{0.751557469f, 0.781548142f},
-std::array<float,2>{0.518959641f, 0.286845684f},
-std::array<float,2>{0.450074196f, 0.509097457f},
-std::array<float,2>{0.122975938f, 0.312519222f},
-std::array<float,2>{0.96621418f, 0.578782022f},
-std::array<float,2>{0.717303514f, 0.0533493236f},
-std::array<float,2>{0.373649597f, 0.823520601f},
-std::array<float,2>{0.41070658f, 0.155606657f},
-std::array<float,2>{0.575797796f, 0.924785018f},
-std::array<float,2>{0.82750088f, 0.486511767f},
-std::array<float,2>{0.160385296f, 0.635626674f},
-std::array<float,2>{0.470907867f, 0.256090283f},
-std::array<float,2>{0.531413913f, 0.555728614f},
-std::array<float,2>{0.810213685f, 0.0700331181f},
-std::array<float,2>{0.191413969f, 0.769757509f},
-std::array<float,2>{0.0554995798f, 0.222516015f},
-std::array<float,2>{0.896431029f, 0.95621562f},
-std::array<float,2>{0.68305397f, 0.395737797f},
-std::array<float,2>{0.259005189f, 0.744464934f},
-std::array<float,2>{0.127796173f, 0.457123607f},
-std::array<float,2>{0.868801236f, 0.681589484f},
-std::array<float,2>{0.610471606f, 0.165130958f},
-std::array<float,2>{0.382956743f, 0.882508993f},
-std::array<float,2>{0.333420515f, 0.0141122732f},
-std::array<float,2>{0.740446806f, 0.845717371f},
-std::array<float,2>{0.983779252f, 0.345769018f},
-std::array<float,2>{0.0686578453f, 0.595719934f},
-std::array<float,2>{0.405413449f, 0.480886459f},
-std::array<float,2>{0.603595972f, 0.641858041f},
-std::array<float,2>{0.851151705f, 0.140491545f},
-std::array<float,2>{0.140894026f, 0.912599981f},
-std::array<float,2>{0.0862772912f, 0.042484954f},
-std::array<float,2>{0.996937752f, 0.833560944f},
-std::array<float,2>{0.727266967f, 0.335576385f},
-std::array<float,2>{0.315133721f, 0.566632092f},
-std::array<float,2>{0.21412468f, 0.3103351f},
-std::array<float,2>{0.783794165f, 0.518921196f},
-std::array<float,2>{0.56202817f, 0.121345446f},
-std::array<float,2>{0.492266715f, 0.797975659f},
-std::array<float,2>{0.269871175f, 0.201153606f},
-std::array<float,2>{0.66335237f, 0.985070825f},
-std::array<float,2>{0.887517631f, 0.417201698f},
-std::array<float,2>{0.040072877f, 0.700172007f},
-std::array<float,2>{0.34686622f, 0.360212386f},
-std::array<float,2>{0.695012271f, 0.613522708f},
-std::array<float,2>{0.940719485f, 0.030956408f},
-std::array<float,2>{0.0943287164f, 0.864910245f},
-std::array<float,2>{0.176541716f, 0.176587448f},
-std::array<float,2>{0.841883183f, 0.899104834f},
-std::array<float,2>{0.588491797f, 0.449601918f},
-std::array<float,2>{0.430387676f, 0.66799742f},
-std::array<float,2>{0.0200062152f, 0.376307011f},
-std::array<float,2>{0.90766722f, 0.727593303f},
-std::array<float,2>{0.640513897f, 0.24023515f},
-std::array<float,2>{0.301299065f, 0.940492988f},
-std::array<float,2>{0.465201348f, 0.0853484645f},
-std::array<float,2>{0.501912534f, 0.755217433f},
-std::array<float,2>{0.779397845f, 0.280698925f},
-std::array<float,2>{0.248612761f, 0.544828475f},
-std::array<float,2>{0.328004003f, 0.437993437f},
-std::array<float,2>{0.726351023f, 0.659576416f},
-std::array<float,2>{0.991100967f, 0.184264287f},
-std::array<float,2>{0.0785806328f, 0.891608f},
-std::array<float,2>{0.156113118f, 0.0217307787f},
-std::array<float,2>{0.858397424f, 0.870805085f},
-std::array<float,2>{0.594377816f, 0.369460046f},
-std::array<float,2>{0.395257384f, 0.623013496f},
-std::array<float,2>{0.0364398435f, 0.265978068f},
-std::array<float,2>{0.87780118f, 0.536473691f},
-std::array<float,2>{0.669528782f, 0.0867877975f},
-std::array<float,2>{0.280963272f, 0.765248537f},
-std::array<float,2>{0.484589934f, 0.244533703f},
-std::array<float,2>{0.548042715f, 0.952920437f},
-std::array<float,2>{0.792527616f, 0.385771871f},
-std::array<float,2>{0.209225178f, 0.720740259f},
-std::array<float,2>{0.421897262f, 0.337923139f},
-std::array<float,2>{0.582036018f, 0.573127449f},
-std::array<float,2>{0.834157646f, 0.0336569659f},
-std::array<float,2>{0.182601169f, 0.837473691f},
-std::array<float,2>{0.106743865f, 0.129848227f},
-std::array<float,2>{0.946866214f, 0.921135724f},
-std::array<float,2>{0.69821322f, 0.470702827f},
-std::array<float,2>{0.354163468f, 0.655154824f},
-std::array<float,2>{0.240761071f, 0.407838494f},
-std::array<float,2>{0.773131013f, 0.691899896f},
-std::array<float,2>{0.513250172f, 0.192816541f},
-std::array<float,2>{0.460181624f, 0.997992456f},
-std::array<float,2>{0.310285568f, 0.111937605f},
-std::array<float,2>{0.631967902f, 0.810579836f},
-std::array<float,2>{0.918435276f, 0.30040583f},
-std::array<float,2>{0.0270500556f, 0.528980255f},
-std::array<float,2>{0.442946166f, 0.400390774f},
-std::array<float,2>{0.5263533f, 0.7413674f},
-std::array<float,2>{0.764999926f, 0.226848587f},
-std::array<float,2>{0.221573368f, 0.967398584f},
-std::array<float,2>{0.00759974774f, 0.0753787085f},
-std::array<float,2>{0.929388225f, 0.775540292f},
-std::array<float,2>{0.642463684f, 0.261525124f},
-std::array<float,2>{0.288611382f, 0.548205435f},
-std::array<float,2>{0.171092913f, 0.358236194f},
-std::array<float,2>{0.812532127f, 0.608022332f},
-std::array<float,2>{0.569763243f, 0.00432656333f},
-std::array<float,2>{0.419652432f, 0.855009973f},
-std::array<float,2>{0.363874584f, 0.162999809f},
-std::array<float,2>{0.710408807f, 0.890251458f},
-std::array<float,2>{0.95439589f, 0.461832255f},
-std::array<float,2>{0.1125395f, 0.679628849f},
-std::array<float,2>{0.25779593f, 0.296648055f},
-std::array<float,2>{0.672567427f, 0.504110515f},
-std::array<float,2>{0.901059628f, 0.107459381f},
-std::array<float,2>{0.0539135002f, 0.795703351f},
-std::array<float,2>{0.201944828f, 0.204309106f},
-std::array<float,2>{0.796888351f, 0.969450295f},
-std::array<float,2>{0.544386208f, 0.422633141f},
-std::array<float,2>{0.477800459f, 0.713211834f},
-std::array<float,2>{0.0721779391f, 0.492438853f},
-std::array<float,2>{0.975591123f, 0.631478488f},
-std::array<float,2>{0.742352068f, 0.142953575f},
-std::array<float,2>{0.336005032f, 0.930549264f},
-std::array<float,2>{0.377450734f, 0.056400355f},
-std::array<float,2>{0.617901981f, 0.817927361f},
-std::array<float,2>{0.86000973f, 0.322401285f},
-std::array<float,2>{0.133861601f, 0.590610027f},
-std::array<float,2>{0.305624485f, 0.45634383f},
-std::array<float,2>{0.625710309f, 0.686939001f},
-std::array<float,2>{0.914150298f, 0.170482621f},
-std::array<float,2>{0.0281495322f, 0.877280414f},
-std::array<float,2>{0.236119881f, 0.00882353168f},
-std::array<float,2>{0.76720506f, 0.8482126f},
-std::array<float,2>{0.510917723f, 0.348513484f},
-std::array<float,2>{0.454161555f, 0.600090563f},
-std::array<float,2>{0.104267009f, 0.251531243f},
-std::array<float,2>{0.95161289f, 0.56206274f},
-std::array<float,2>{0.702200413f, 0.0650075749f},
-std::array<float,2>{0.356628507f, 0.768387675f},
-std::array<float,2>{0.426613241f, 0.222873285f},
-std::array<float,2>{0.579748034f, 0.957752585f},
-std::array<float,2>{0.829727948f, 0.394301802f},
-std::array<float,2>{0.183986381f, 0.749839127f},
-std::array<float,2>{0.488880873f, 0.318691462f},
-std::array<float,2>{0.55229032f, 0.583149135f},
-std::array<float,2>{0.795768142f, 0.0491557904f},
-std::array<float,2>{0.204712138f, 0.824967682f},
-std::array<float,2>{0.033940006f, 0.150889024f},
-std::array<float,2>{0.881609797f, 0.926357806f},
-std::array<float,2>{0.666270256f, 0.490397602f},
-std::array<float,2>{0.276620626f, 0.636808634f},
-std::array<float,2>{0.14979957f, 0.430740505f},
-std::array<float,2>{0.855245113f, 0.705615044f},
-std::array<float,2>{0.601351142f, 0.213013172f},
-std::array<float,2>{0.394522399f, 0.982213855f},
-std::array<float,2>{0.321881384f, 0.0955492705f},
-std::array<float,2>{0.721234858f, 0.785817027f},
-std::array<float,2>{0.986902654f, 0.28320837f},
-std::array<float,2>{0.0827500373f, 0.515408754f},
-std::array<float,2>{0.381119132f, 0.380274862f},
-std::array<float,2>{0.622642159f, 0.732340634f},
-std::array<float,2>{0.866367877f, 0.237366572f},
-std::array<float,2>{0.140528053f, 0.941643417f},
-std::array<float,2>{0.077747114f, 0.078662172f},
-std::array<float,2>{0.970902741f, 0.751417637f},
-std::array<float,2>{0.7471295f, 0.275457829f},
-std::array<float,2>{0.343257427f, 0.542957842f},
-std::array<float,2>{0.197386205f, 0.363769948f},
-std::array<float,2>{0.801469028f, 0.609967768f},
-std::array<float,2>{0.53962636f, 0.0252227131f},
-std::array<float,2>{0.482166618f, 0.862605572f},
-std::array<float,2>{0.251708567f, 0.174494818f},
-std::array<float,2>{0.67948705f, 0.904485762f},
-std::array<float,2>{0.904670954f, 0.447210878f},
-std::array<float,2>{0.0497304797f, 0.664426148f},
-std::array<float,2>{0.362496883f, 0.307294011f},
-std::array<float,2>{0.705637455f, 0.520136714f},
-std::array<float,2>{0.957201421f, 0.120499998f},
-std::array<float,2>{0.116800487f, 0.804537714f},
-std::array<float,2>{0.167789161f, 0.19538343f},
-std::array<float,2>{0.817075789f, 0.988350809f},
-std::array<float,2>{0.566075146f, 0.421304584f},
-std::array<float,2>{0.415409058f, 0.698847771f},
-std::array<float,2>{0.00207270542f, 0.479595423f},
-std::array<float,2>{0.922473788f, 0.647069454f},
-std::array<float,2>{0.647997797f, 0.133926839f},
-std::array<float,2>{0.283971161f, 0.906439781f},
-std::array<float,2>{0.44090876f, 0.0458451137f},
-std::array<float,2>{0.52913934f, 0.829163015f},
-std::array<float,2>{0.758733273f, 0.330996364f},
-std::array<float,2>{0.22635223f, 0.564624667f},
-std::array<float,2>{0.33195734f, 0.413998544f},
-std::array<float,2>{0.735236883f, 0.688440561f},
-std::array<float,2>{0.978267789f, 0.188985601f},
-std::array<float,2>{0.0656402633f, 0.994310796f},
-std::array<float,2>{0.132581636f, 0.115870461f},
-std::array<float,2>{0.873090386f, 0.807765424f},
-std::array<float,2>{0.616592646f, 0.302619159f},
-std::array<float,2>{0.38739422f, 0.523508191f},
-std::array<float,2>{0.0600479245f, 0.343455523f},
-std::array<float,2>{0.891489983f, 0.574270427f},
-std::array<float,2>{0.686240315f, 0.0368462056f},
-std::array<float,2>{0.262681782f, 0.842972755f},
-std::array<float,2>{0.476191074f, 0.128901213f},
-std::array<float,2>{0.535647213f, 0.916430295f},
-std::array<float,2>{0.808590829f, 0.476337165f},
-std::array<float,2>{0.190054551f, 0.649273098f},
-std::array<float,2>{0.408543378f, 0.270502865f},
-std::array<float,2>{0.573027551f, 0.533948958f},
-std::array<float,2>{0.823328972f, 0.0916120261f},
-std::array<float,2>{0.158778623f, 0.759039819f},
-std::array<float,2>{0.118825972f, 0.246158212f},
-std::array<float,2>{0.963166773f, 0.946593344f},
-std::array<float,2>{0.712755978f, 0.388125628f},
-std::array<float,2>{0.36897108f, 0.722961187f},
-std::array<float,2>{0.233445749f, 0.442166209f},
-std::array<float,2>{0.753908217f, 0.663639784f},
-std::array<float,2>{0.523311317f, 0.181796178f},
-std::array<float,2>{0.447672725f, 0.89708358f},
-std::array<float,2>{0.292191595f, 0.0179964788f},
-std::array<float,2>{0.65182668f, 0.871820271f},
-std::array<float,2>{0.935706019f, 0.372100145f},
-std::array<float,2>{0.0109875072f, 0.618580997f},
-std::array<float,2>{0.461993039f, 0.496493995f},
-std::array<float,2>{0.504656017f, 0.626228392f},
-std::array<float,2>{0.776194811f, 0.144601107f},
-std::array<float,2>{0.244298577f, 0.937069714f},
-std::array<float,2>{0.0163310897f, 0.0603304692f},
-std::array<float,2>{0.91201812f, 0.816176891f},
-std::array<float,2>{0.635701418f, 0.328067839f},
-std::array<float,2>{0.299057961f, 0.586103678f},
-std::array<float,2>{0.175211728f, 0.289795488f},
-std::array<float,2>{0.836841702f, 0.502216697f},
-std::array<float,2>{0.593472719f, 0.101612449f},
-std::array<float,2>{0.434527367f, 0.791756749f},
-std::array<float,2>{0.348077148f, 0.210366279f},
-std::array<float,2>{0.68872726f, 0.972740233f},
-std::array<float,2>{0.942132592f, 0.429072797f},
-std::array<float,2>{0.100231104f, 0.715600789f},
-std::array<float,2>{0.268105626f, 0.352449656f},
-std::array<float,2>{0.659893632f, 0.602923751f},
-std::array<float,2>{0.886128128f, 5.07316436e-05f},
-std::array<float,2>{0.0456722192f, 0.859332979f},
-std::array<float,2>{0.21841386f, 0.157276928f},
-std::array<float,2>{0.787394822f, 0.885383725f},
-std::array<float,2>{0.555461466f, 0.465108901f},
-std::array<float,2>{0.499404788f, 0.675161481f},
-std::array<float,2>{0.0918983296f, 0.405956686f},
-std::array<float,2>{0.993260264f, 0.738128722f},
-std::array<float,2>{0.731324673f, 0.233239144f},
-std::array<float,2>{0.317082733f, 0.961882055f},
-std::array<float,2>{0.399372071f, 0.0716809928f},
-std::array<float,2>{0.607691288f, 0.779762447f},
-std::array<float,2>{0.846603096f, 0.263863415f},
-std::array<float,2>{0.144671187f, 0.554531991f},
-std::array<float,2>{0.261089712f, 0.396979779f},
-std::array<float,2>{0.681595206f, 0.744110167f},
-std::array<float,2>{0.897386134f, 0.218758047f},
-std::array<float,2>{0.0585174859f, 0.954353213f},
-std::array<float,2>{0.194855884f, 0.0680137426f},
-std::array<float,2>{0.811246812f, 0.773310006f},
-std::array<float,2>{0.534169614f, 0.255081922f},
-std::array<float,2>{0.469720274f, 0.558072686f},
-std::array<float,2>{0.068079561f, 0.344089061f},
-std::array<float,2>{0.981684923f, 0.59549135f},
-std::array<float,2>{0.73843056f, 0.0134239923f},
-std::array<float,2>{0.335432678f, 0.843782127f},
-std::array<float,2>{0.386079788f, 0.167493746f},
-std::array<float,2>{0.612706721f, 0.879011869f},
-std::array<float,2>{0.869556427f, 0.459407926f},
-std::array<float,2>{0.125649601f, 0.682186186f},
-std::array<float,2>{0.451698333f, 0.287313372f},
-std::array<float,2>{0.516206682f, 0.510873735f},
-std::array<float,2>{0.752328038f, 0.100027442f},
-std::array<float,2>{0.229167789f, 0.784918129f},
-std::array<float,2>{0.0126432022f, 0.217731908f},
-std::array<float,2>{0.931278229f, 0.979839563f},
-std::array<float,2>{0.655417264f, 0.435463548f},
-std::array<float,2>{0.292977959f, 0.710330129f},
-std::array<float,2>{0.163860291f, 0.485352486f},
-std::array<float,2>{0.825734019f, 0.634763956f},
-std::array<float,2>{0.577389359f, 0.153934538f},
-std::array<float,2>{0.414037764f, 0.922170103f},
-std::array<float,2>{0.371735185f, 0.0525275283f},
-std::array<float,2>{0.715826571f, 0.821805418f},
-std::array<float,2>{0.968221784f, 0.315251142f},
-std::array<float,2>{0.123297006f, 0.581666231f},
-std::array<float,2>{0.433474004f, 0.452785164f},
-std::array<float,2>{0.586816192f, 0.670377254f},
-std::array<float,2>{0.840115905f, 0.178146824f},
-std::array<float,2>{0.178197905f, 0.900642097f},
-std::array<float,2>{0.0957740098f, 0.0285979472f},
-std::array<float,2>{0.937806845f, 0.867132902f},
-std::array<float,2>{0.693170667f, 0.361571103f},
-std::array<float,2>{0.344286174f, 0.616583169f},
-std::array<float,2>{0.247128516f, 0.278383791f},
-std::array<float,2>{0.77867347f, 0.545667112f},
-std::array<float,2>{0.502555549f, 0.0826689824f},
-std::array<float,2>{0.468529344f, 0.757359862f},
-std::array<float,2>{0.304201722f, 0.238971964f},
-std::array<float,2>{0.638310909f, 0.939026356f},
-std::array<float,2>{0.908699691f, 0.378465801f},
-std::array<float,2>{0.0232372377f, 0.729900658f},
-std::array<float,2>{0.312678128f, 0.333351463f},
-std::array<float,2>{0.728798985f, 0.569686949f},
-std::array<float,2>{0.99832052f, 0.0392261334f},
-std::array<float,2>{0.0885071382f, 0.83424598f},
-std::array<float,2>{0.142923385f, 0.13682425f},
-std::array<float,2>{0.848109245f, 0.911387384f},
-std::array<float,2>{0.602021277f, 0.484161615f},
-std::array<float,2>{0.403092504f, 0.643332899f},
-std::array<float,2>{0.0424099639f, 0.414384812f},
-std::array<float,2>{0.889309704f, 0.702906787f},
-std::array<float,2>{0.660721004f, 0.201551914f},
-std::array<float,2>{0.273139447f, 0.987708211f},
-std::array<float,2>{0.49573648f, 0.123427413f},
-std::array<float,2>{0.55993551f, 0.800019026f},
-std::array<float,2>{0.782083631f, 0.312310785f},
-std::array<float,2>{0.21202074f, 0.516072094f},
-std::array<float,2>{0.352373898f, 0.472301155f},
-std::array<float,2>{0.695629358f, 0.653770268f},
-std::array<float,2>{0.948868036f, 0.131130502f},
-std::array<float,2>{0.109179407f, 0.918612778f},
-std::array<float,2>{0.181222498f, 0.0325955115f},
-std::array<float,2>{0.833091021f, 0.839324236f},
-std::array<float,2>{0.585011482f, 0.336763144f},
-std::array<float,2>{0.424598634f, 0.570393562f},
-std::array<float,2>{0.0246092565f, 0.297368258f},
-std::array<float,2>{0.920774221f, 0.530692399f},
-std::array<float,2>{0.629870832f, 0.110721879f},
-std::array<float,2>{0.3113015f, 0.809303403f},
-std::array<float,2>{0.457414091f, 0.194375992f},
-std::array<float,2>{0.514213502f, 0.999123633f},
-std::array<float,2>{0.770423174f, 0.408896744f},
-std::array<float,2>{0.239133611f, 0.693729162f},
-std::array<float,2>{0.396728158f, 0.368476093f},
-std::array<float,2>{0.595892549f, 0.624551475f},
-std::array<float,2>{0.856675625f, 0.0204449389f},
-std::array<float,2>{0.152821004f, 0.868573785f},
-std::array<float,2>{0.0805657506f, 0.186100408f},
-std::array<float,2>{0.988417447f, 0.89295125f},
-std::array<float,2>{0.723599613f, 0.439588726f},
-std::array<float,2>{0.325912416f, 0.656341314f},
-std::array<float,2>{0.208789334f, 0.383248687f},
-std::array<float,2>{0.790577888f, 0.719402373f},
-std::array<float,2>{0.5501073f, 0.242970243f},
-std::array<float,2>{0.486580908f, 0.95026356f},
-std::array<float,2>{0.278475553f, 0.0888962597f},
-std::array<float,2>{0.671854496f, 0.763154268f},
-std::array<float,2>{0.87665695f, 0.268561751f},
-std::array<float,2>{0.0389012508f, 0.537769735f},
-std::array<float,2>{0.479492903f, 0.424821645f},
-std::array<float,2>{0.546010315f, 0.711715162f},
-std::array<float,2>{0.799257696f, 0.206951633f},
-std::array<float,2>{0.199382946f, 0.972314596f},
-std::array<float,2>{0.0514634252f, 0.105587199f},
-std::array<float,2>{0.898886323f, 0.7944628f},
-std::array<float,2>{0.674079776f, 0.294126183f},
-std::array<float,2>{0.253988981f, 0.506985366f},
-std::array<float,2>{0.135809913f, 0.322256625f},
-std::array<float,2>{0.861632049f, 0.591882527f},
-std::array<float,2>{0.62002337f, 0.0569600686f},
-std::array<float,2>{0.37637049f, 0.819865465f},
-std::array<float,2>{0.338072389f, 0.140741751f},
-std::array<float,2>{0.745157182f, 0.931844592f},
-std::array<float,2>{0.973950922f, 0.496080935f},
-std::array<float,2>{0.0733549222f, 0.629641652f},
-std::array<float,2>{0.286358416f, 0.259551495f},
-std::array<float,2>{0.64373219f, 0.550603509f},
-std::array<float,2>{0.927639365f, 0.0767618492f},
-std::array<float,2>{0.0047864248f, 0.774618685f},
-std::array<float,2>{0.219567284f, 0.229356587f},
-std::array<float,2>{0.762979388f, 0.966000378f},
-std::array<float,2>{0.524435043f, 0.398620278f},
-std::array<float,2>{0.443693995f, 0.738678753f},
-std::array<float,2>{0.11094407f, 0.464708f},
-std::array<float,2>{0.955084622f, 0.675835013f},
-std::array<float,2>{0.708632529f, 0.161695749f},
-std::array<float,2>{0.365663379f, 0.886744797f},
-std::array<float,2>{0.421051979f, 0.00616212049f},
-std::array<float,2>{0.566825807f, 0.852029443f},
-std::array<float,2>{0.816394091f, 0.356596559f},
-std::array<float,2>{0.169814497f, 0.606299818f},
-std::array<float,2>{0.299637824f, 0.498121828f},
-std::array<float,2>{0.635040462f, 0.628245533f},
-std::array<float,2>{0.911436856f, 0.147720009f},
-std::array<float,2>{0.0159039423f, 0.935126781f},
-std::array<float,2>{0.244932726f, 0.062090423f},
-std::array<float,2>{0.775455058f, 0.812698245f},
-std::array<float,2>{0.504257202f, 0.324802041f},
-std::array<float,2>{0.462623656f, 0.589677751f},
-std::array<float,2>{0.0996868387f, 0.292322546f},
-std::array<float,2>{0.94149828f, 0.501820922f},
-std::array<float,2>{0.689247012f, 0.104962856f},
-std::array<float,2>{0.348462492f, 0.790349841f},
-std::array<float,2>{0.433809072f, 0.207368538f},
-std::array<float,2>{0.593204558f, 0.976430535f},
-std::array<float,2>{0.836274862f, 0.427733898f},
-std::array<float,2>{0.175390884f, 0.717632771f},
-std::array<float,2>{0.499824375f, 0.354891837f},
-std::array<float,2>{0.554804146f, 0.605173767f},
-std::array<float,2>{0.787698865f, 0.00240923348f},
-std::array<float,2>{0.217999697f, 0.856213272f},
-std::array<float,2>{0.0452223606f, 0.159850314f},
-std::array<float,2>{0.886279464f, 0.882842064f},
-std::array<float,2>{0.659373224f, 0.46826008f},
-std::array<float,2>{0.267769933f, 0.673609316f},
-std::array<float,2>{0.145253688f, 0.403316617f},
-std::array<float,2>{0.845992744f, 0.734719038f},
-std::array<float,2>{0.608228207f, 0.230805188f},
-std::array<float,2>{0.398891121f, 0.964038491f},
-std::array<float,2>{0.316420972f, 0.0737083852f},
-std::array<float,2>{0.730727732f, 0.778096199f},
-std::array<float,2>{0.993672371f, 0.262838244f},
-std::array<float,2>{0.0924175829f, 0.551562071f},
-std::array<float,2>{0.387105107f, 0.411852896f},
-std::array<float,2>{0.616891742f, 0.689893425f},
-std::array<float,2>{0.873668194f, 0.191111684f},
-std::array<float,2>{0.132133693f, 0.993879259f},
-std::array<float,2>{0.066334866f, 0.115222126f},
-std::array<float,2>{0.977869213f, 0.806554556f},
-std::array<float,2>{0.73460418f, 0.303768754f},
-std::array<float,2>{0.331421226f, 0.526803851f},
-std::array<float,2>{0.18966645f, 0.339882046f},
-std::array<float,2>{0.808088601f, 0.576660275f},
-std::array<float,2>{0.535523653f, 0.0381956138f},
-std::array<float,2>{0.475879878f, 0.840984464f},
-std::array<float,2>{0.261857182f, 0.126058266f},
-std::array<float,2>{0.685951412f, 0.914433002f},
-std::array<float,2>{0.890705764f, 0.472841203f},
-std::array<float,2>{0.0601108931f, 0.650903881f},
-std::array<float,2>{0.368499845f, 0.271824718f},
-std::array<float,2>{0.712138653f, 0.532095313f},
-std::array<float,2>{0.963466883f, 0.0932632089f},
-std::array<float,2>{0.118174411f, 0.761160731f},
-std::array<float,2>{0.158362195f, 0.248325109f},
-std::array<float,2>{0.823857188f, 0.948910296f},
-std::array<float,2>{0.572277904f, 0.390559644f},
-std::array<float,2>{0.409148693f, 0.726500392f},
-std::array<float,2>{0.0116047896f, 0.444095641f},
-std::array<float,2>{0.936366558f, 0.660324454f},
-std::array<float,2>{0.652098298f, 0.180869773f},
-std::array<float,2>{0.292664468f, 0.894659519f},
-std::array<float,2>{0.448222727f, 0.0168784428f},
-std::array<float,2>{0.5227952f, 0.874710441f},
-std::array<float,2>{0.754719079f, 0.373133391f},
-std::array<float,2>{0.234126955f, 0.620458603f},
-std::array<float,2>{0.343598425f, 0.381640255f},
-std::array<float,2>{0.747831345f, 0.734301388f},
-std::array<float,2>{0.971669853f, 0.235721633f},
-std::array<float,2>{0.0775047541f, 0.944244385f},
-std::array<float,2>{0.139872804f, 0.0810895786f},
-std::array<float,2>{0.866761148f, 0.753105521f},
-std::array<float,2>{0.622080684f, 0.273629427f},
-std::array<float,2>{0.381407678f, 0.540697932f},
-std::array<float,2>{0.0489375517f, 0.365258664f},
-std::array<float,2>{0.905151665f, 0.612113237f},
-std::array<float,2>{0.679178596f, 0.0263806731f},
-std::array<float,2>{0.251144588f, 0.860918462f},
-std::array<float,2>{0.48179251f, 0.172029242f},
-std::array<float,2>{0.539513648f, 0.902793884f},
-std::array<float,2>{0.801165819f, 0.447485626f},
-std::array<float,2>{0.198166952f, 0.667292714f},
-std::array<float,2>{0.415832549f, 0.305970967f},
-std::array<float,2>{0.565852582f, 0.522190988f},
-std::array<float,2>{0.816689312f, 0.118348293f},
-std::array<float,2>{0.167457923f, 0.800799191f},
-std::array<float,2>{0.116600238f, 0.1975016f},
-std::array<float,2>{0.957778037f, 0.990416646f},
-std::array<float,2>{0.70521909f, 0.419181675f},
-std::array<float,2>{0.363233179f, 0.697056055f},
-std::array<float,2>{0.226054266f, 0.476839751f},
-std::array<float,2>{0.758238375f, 0.645545065f},
-std::array<float,2>{0.528551996f, 0.13616325f},
-std::array<float,2>{0.441135108f, 0.908471823f},
-std::array<float,2>{0.283288628f, 0.0443113483f},
-std::array<float,2>{0.647855163f, 0.830403388f},
-std::array<float,2>{0.921901524f, 0.32897836f},
-std::array<float,2>{0.00290793553f, 0.563599169f},
-std::array<float,2>{0.454743087f, 0.453307599f},
-std::array<float,2>{0.511406004f, 0.683696806f},
-std::array<float,2>{0.766809225f, 0.168015912f},
-std::array<float,2>{0.235519096f, 0.876557648f},
-std::array<float,2>{0.0277495813f, 0.0107242921f},
-std::array<float,2>{0.914689004f, 0.849792004f},
-std::array<float,2>{0.625102043f, 0.349740863f},
-std::array<float,2>{0.305037916f, 0.598002911f},
-std::array<float,2>{0.184177384f, 0.253502518f},
-std::array<float,2>{0.829322278f, 0.559336305f},
-std::array<float,2>{0.579229295f, 0.0633549914f},
-std::array<float,2>{0.42611137f, 0.766108692f},
-std::array<float,2>{0.3569628f, 0.225610241f},
-std::array<float,2>{0.702902794f, 0.959852159f},
-std::array<float,2>{0.952046573f, 0.391886652f},
-std::array<float,2>{0.103723362f, 0.747191966f},
-std::array<float,2>{0.277178377f, 0.317764133f},
-std::array<float,2>{0.666673779f, 0.584721267f},
-std::array<float,2>{0.880947351f, 0.0483326241f},
-std::array<float,2>{0.0334051065f, 0.827515244f},
-std::array<float,2>{0.204164103f, 0.14878644f},
-std::array<float,2>{0.795406818f, 0.928401172f},
-std::array<float,2>{0.552090406f, 0.488934249f},
-std::array<float,2>{0.488329768f, 0.639961183f},
-std::array<float,2>{0.0821337402f, 0.432738245f},
-std::array<float,2>{0.986468732f, 0.704759836f},
-std::array<float,2>{0.721108198f, 0.211482182f},
-std::array<float,2>{0.32163012f, 0.982526779f},
-std::array<float,2>{0.3935799f, 0.0963558108f},
-std::array<float,2>{0.600652874f, 0.78878963f},
-std::array<float,2>{0.85478735f, 0.282016367f},
-std::array<float,2>{0.150118962f, 0.513417363f},
-std::array<float,2>{0.254521191f, 0.421986967f},
-std::array<float,2>{0.674679279f, 0.713797748f},
-std::array<float,2>{0.898932397f, 0.204699486f},
-std::array<float,2>{0.0512231439f, 0.968889713f},
-std::array<float,2>{0.199999824f, 0.108216539f},
-std::array<float,2>{0.799624324f, 0.795409679f},
-std::array<float,2>{0.546450675f, 0.295971155f},
-std::array<float,2>{0.480263799f, 0.50458771f},
-std::array<float,2>{0.0740410164f, 0.322765052f},
-std::array<float,2>{0.974388063f, 0.590209365f},
-std::array<float,2>{0.745629013f, 0.0557211973f},
-std::array<float,2>{0.338461727f, 0.817433238f},
-std::array<float,2>{0.37660715f, 0.143209741f},
-std::array<float,2>{0.619223893f, 0.92971313f},
-std::array<float,2>{0.861948133f, 0.492685109f},
-std::array<float,2>{0.136658818f, 0.630927026f},
-std::array<float,2>{0.44397071f, 0.260947615f},
-std::array<float,2>{0.525176108f, 0.54861021f},
-std::array<float,2>{0.763307869f, 0.0757051706f},
-std::array<float,2>{0.219130754f, 0.775942206f},
-std::array<float,2>{0.00433821371f, 0.227409452f},
-std::array<float,2>{0.927183867f, 0.967258573f},
-std::array<float,2>{0.644112527f, 0.400984585f},
-std::array<float,2>{0.286792189f, 0.74190563f},
-std::array<float,2>{0.169286311f, 0.461242318f},
-std::array<float,2>{0.815674305f, 0.679162741f},
-std::array<float,2>{0.567238033f, 0.162358791f},
-std::array<float,2>{0.421693832f, 0.889952719f},
-std::array<float,2>{0.365870804f, 0.00476187747f},
-std::array<float,2>{0.708456039f, 0.854547083f},
-std::array<float,2>{0.955966532f, 0.35762009f},
-std::array<float,2>{0.110378347f, 0.607882917f},
-std::array<float,2>{0.424026221f, 0.469790429f},
-std::array<float,2>{0.585583389f, 0.654505372f},
-std::array<float,2>{0.833575964f, 0.129337296f},
-std::array<float,2>{0.181132972f, 0.92164129f},
-std::array<float,2>{0.108594127f, 0.0338828564f},
-std::array<float,2>{0.948573053f, 0.837064087f},
-std::array<float,2>{0.696131289f, 0.338811934f},
-std::array<float,2>{0.351722449f, 0.572588027f},
-std::array<float,2>{0.238605618f, 0.299904734f},
-std::array<float,2>{0.769980907f, 0.528465807f},
-std::array<float,2>{0.513770163f, 0.111654036f},
-std::array<float,2>{0.457679689f, 0.811319947f},
-std::array<float,2>{0.310928375f, 0.192960232f},
-std::array<float,2>{0.628914535f, 0.997194231f},
-std::array<float,2>{0.919985592f, 0.4073264f},
-std::array<float,2>{0.0249895919f, 0.691647828f},
-std::array<float,2>{0.325659215f, 0.369864941f},
-std::array<float,2>{0.723012567f, 0.622408688f},
-std::array<float,2>{0.989070833f, 0.0220273137f},
-std::array<float,2>{0.0809117407f, 0.870527685f},
-std::array<float,2>{0.15306811f, 0.183792189f},
-std::array<float,2>{0.857248902f, 0.8924703f},
-std::array<float,2>{0.596413434f, 0.4377276f},
-std::array<float,2>{0.397231519f, 0.659682631f},
-std::array<float,2>{0.0384049639f, 0.386422276f},
-std::array<float,2>{0.876240253f, 0.721631825f},
-std::array<float,2>{0.671321273f, 0.244937509f},
-std::array<float,2>{0.278904289f, 0.952255189f},
-std::array<float,2>{0.487226158f, 0.0862445086f},
-std::array<float,2>{0.550355196f, 0.764679432f},
-std::array<float,2>{0.790206075f, 0.266265124f},
-std::array<float,2>{0.208225161f, 0.537107468f},
-std::array<float,2>{0.34416315f, 0.44994843f},
-std::array<float,2>{0.692400098f, 0.668938935f},
-std::array<float,2>{0.93822068f, 0.17609489f},
-std::array<float,2>{0.0964064151f, 0.898773551f},
-std::array<float,2>{0.178253099f, 0.0306518227f},
-std::array<float,2>{0.840448678f, 0.864422262f},
-std::array<float,2>{0.585960627f, 0.359685302f},
-std::array<float,2>{0.432815284f, 0.614126027f},
-std::array<float,2>{0.0229282789f, 0.281126648f},
-std::array<float,2>{0.908381701f, 0.544073284f},
-std::array<float,2>{0.637709022f, 0.0859130919f},
-std::array<float,2>{0.303978682f, 0.755713701f},
-std::array<float,2>{0.468113333f, 0.24098818f},
-std::array<float,2>{0.502019167f, 0.940949202f},
-std::array<float,2>{0.778898954f, 0.376577914f},
-std::array<float,2>{0.24772571f, 0.728488266f},
-std::array<float,2>{0.402784884f, 0.335141301f},
-std::array<float,2>{0.602168083f, 0.566960752f},
-std::array<float,2>{0.848160267f, 0.0422209948f},
-std::array<float,2>{0.143423125f, 0.833015144f},
-std::array<float,2>{0.0882771239f, 0.139940739f},
-std::array<float,2>{0.99863106f, 0.912344813f},
-std::array<float,2>{0.729428113f, 0.481242508f},
-std::array<float,2>{0.313283354f, 0.642107606f},
-std::array<float,2>{0.212509155f, 0.41750896f},
-std::array<float,2>{0.7814219f, 0.699413121f},
-std::array<float,2>{0.560059309f, 0.200430974f},
-std::array<float,2>{0.495122343f, 0.984558642f},
-std::array<float,2>{0.272763789f, 0.121619776f},
-std::array<float,2>{0.660183251f, 0.79848212f},
-std::array<float,2>{0.88868922f, 0.309912086f},
-std::array<float,2>{0.0426403098f, 0.519150019f},
-std::array<float,2>{0.468751997f, 0.396100372f},
-std::array<float,2>{0.533522487f, 0.7446661f},
-std::array<float,2>{0.810997963f, 0.221941218f},
-std::array<float,2>{0.194743633f, 0.956969738f},
-std::array<float,2>{0.0578551032f, 0.069696039f},
-std::array<float,2>{0.896767795f, 0.77007246f},
-std::array<float,2>{0.680977225f, 0.256538004f},
-std::array<float,2>{0.26126501f, 0.556360722f},
-std::array<float,2>{0.125401869f, 0.346377581f},
-std::array<float,2>{0.8699103f, 0.596344173f},
-std::array<float,2>{0.612980187f, 0.0144601855f},
-std::array<float,2>{0.386571586f, 0.846286058f},
-std::array<float,2>{0.335761875f, 0.1658694f},
-std::array<float,2>{0.739200294f, 0.882190645f},
-std::array<float,2>{0.982034564f, 0.45767042f},
-std::array<float,2>{0.0676436275f, 0.681108296f},
-std::array<float,2>{0.293812275f, 0.286502212f},
-std::array<float,2>{0.656033576f, 0.509549856f},
-std::array<float,2>{0.930742443f, 0.098108694f},
-std::array<float,2>{0.0119360825f, 0.781794727f},
-std::array<float,2>{0.228640959f, 0.216219991f},
-std::array<float,2>{0.752859652f, 0.978109896f},
-std::array<float,2>{0.515708923f, 0.435800254f},
-std::array<float,2>{0.451645017f, 0.708654523f},
-std::array<float,2>{0.123751789f, 0.486865282f},
-std::array<float,2>{0.968288481f, 0.63482523f},
-std::array<float,2>{0.71651268f, 0.156172335f},
-std::array<float,2>{0.371542692f, 0.923840702f},
-std::array<float,2>{0.413473129f, 0.0531250536f},
-std::array<float,2>{0.577893972f, 0.824045002f},
-std::array<float,2>{0.825674772f, 0.313120484f},
-std::array<float,2>{0.163166314f, 0.5784114f},
-std::array<float,2>{0.267092377f, 0.4655734f},
-std::array<float,2>{0.657026231f, 0.67563206f},
-std::array<float,2>{0.883660674f, 0.158038765f},
-std::array<float,2>{0.0430960394f, 0.884966433f},
-std::array<float,2>{0.216759041f, 0.000521697511f},
-std::array<float,2>{0.78686893f, 0.858578861f},
-std::array<float,2>{0.557571173f, 0.351975203f},
-std::array<float,2>{0.497636586f, 0.603482902f},
-std::array<float,2>{0.0903743431f, 0.26445207f},
-std::array<float,2>{0.996051133f, 0.553850532f},
-std::array<float,2>{0.732653737f, 0.0718215704f},
-std::array<float,2>{0.320255101f, 0.78003943f},
-std::array<float,2>{0.401559949f, 0.232885376f},
-std::array<float,2>{0.607290626f, 0.960996389f},
-std::array<float,2>{0.844290853f, 0.405506581f},
-std::array<float,2>{0.146825835f, 0.73757118f},
-std::array<float,2>{0.464792699f, 0.327178627f},
-std::array<float,2>{0.507292867f, 0.586892545f},
-std::array<float,2>{0.773613632f, 0.0598381199f},
-std::array<float,2>{0.244116619f, 0.815648377f},
-std::array<float,2>{0.0183099117f, 0.14525266f},
-std::array<float,2>{0.912387013f, 0.936800241f},
-std::array<float,2>{0.633899391f, 0.496865749f},
-std::array<float,2>{0.29747951f, 0.626693964f},
-std::array<float,2>{0.17307891f, 0.429628462f},
-std::array<float,2>{0.839028239f, 0.715236604f},
-std::array<float,2>{0.590064943f, 0.210627571f},
-std::array<float,2>{0.436930597f, 0.973385096f},
-std::array<float,2>{0.351259321f, 0.102459177f},
-std::array<float,2>{0.690355182f, 0.791421533f},
-std::array<float,2>{0.943443894f, 0.28934744f},
-std::array<float,2>{0.0980613083f, 0.502711296f},
-std::array<float,2>{0.407573193f, 0.388491541f},
-std::array<float,2>{0.570529819f, 0.723317027f},
-std::array<float,2>{0.822038651f, 0.246739089f},
-std::array<float,2>{0.157265618f, 0.946907938f},
-std::array<float,2>{0.120883085f, 0.0910952464f},
-std::array<float,2>{0.961990714f, 0.759658039f},
-std::array<float,2>{0.713667929f, 0.269785136f},
-std::array<float,2>{0.369454056f, 0.533230901f},
-std::array<float,2>{0.231374234f, 0.372561753f},
-std::array<float,2>{0.755937934f, 0.618826389f},
-std::array<float,2>{0.520794332f, 0.0182374213f},
-std::array<float,2>{0.446674913f, 0.871491134f},
-std::array<float,2>{0.289578497f, 0.182581261f},
-std::array<float,2>{0.65011996f, 0.89696151f},
-std::array<float,2>{0.935243011f, 0.441613734f},
-std::array<float,2>{0.00926912017f, 0.663523793f},
-std::array<float,2>{0.329885215f, 0.302122444f},
-std::array<float,2>{0.736608207f, 0.524326622f},
-std::array<float,2>{0.980045855f, 0.115715533f},
-std::array<float,2>{0.0627104267f, 0.808203816f},
-std::array<float,2>{0.129414424f, 0.188660711f},
-std::array<float,2>{0.872748613f, 0.994950831f},
-std::array<float,2>{0.61349982f, 0.413427144f},
-std::array<float,2>{0.390092254f, 0.687565744f},
-std::array<float,2>{0.0621650703f, 0.47594139f},
-std::array<float,2>{0.894014239f, 0.648493409f},
-std::array<float,2>{0.684336841f, 0.1283333f},
-std::array<float,2>{0.26521793f, 0.916862845f},
-std::array<float,2>{0.472923189f, 0.03655627f},
-std::array<float,2>{0.538483799f, 0.843353808f},
-std::array<float,2>{0.804840326f, 0.343194783f},
-std::array<float,2>{0.188393354f, 0.575130165f},
-std::array<float,2>{0.360019147f, 0.421603799f},
-std::array<float,2>{0.703700781f, 0.698490679f},
-std::array<float,2>{0.960614383f, 0.196270838f},
-std::array<float,2>{0.114000782f, 0.989057899f},
-std::array<float,2>{0.165365174f, 0.121053778f},
-std::array<float,2>{0.819299698f, 0.803755999f},
-std::array<float,2>{0.564280868f, 0.307047158f},
-std::array<float,2>{0.416513205f, 0.519792557f},
-std::array<float,2>{0.000132587593f, 0.330166429f},
-std::array<float,2>{0.925507605f, 0.565149546f},
-std::array<float,2>{0.646289766f, 0.045109503f},
-std::array<float,2>{0.281687647f, 0.830058873f},
-std::array<float,2>{0.437522978f, 0.134461045f},
-std::array<float,2>{0.529989719f, 0.90704459f},
-std::array<float,2>{0.760961652f, 0.480427533f},
-std::array<float,2>{0.224222466f, 0.646913648f},
-std::array<float,2>{0.379965186f, 0.276209354f},
-std::array<float,2>{0.624230504f, 0.542085052f},
-std::array<float,2>{0.864060283f, 0.0784682855f},
-std::array<float,2>{0.137288406f, 0.751617432f},
-std::array<float,2>{0.075003989f, 0.237848327f},
-std::array<float,2>{0.969832897f, 0.94191736f},
-std::array<float,2>{0.748080194f, 0.380757809f},
-std::array<float,2>{0.340433538f, 0.731460929f},
-std::array<float,2>{0.196985304f, 0.446378469f},
-std::array<float,2>{0.804682076f, 0.664560854f},
-std::array<float,2>{0.542906165f, 0.174234286f},
-std::array<float,2>{0.483599812f, 0.905188262f},
-std::array<float,2>{0.251966387f, 0.0248556547f},
-std::array<float,2>{0.676495373f, 0.862887681f},
-std::array<float,2>{0.903505564f, 0.36362654f},
-std::array<float,2>{0.0475928448f, 0.609401703f},
-std::array<float,2>{0.49167192f, 0.49099049f},
-std::array<float,2>{0.552889585f, 0.637246132f},
-std::array<float,2>{0.793799758f, 0.150661305f},
-std::array<float,2>{0.206215173f, 0.925916612f},
-std::array<float,2>{0.0315945931f, 0.0497099906f},
-std::array<float,2>{0.880212367f, 0.824426413f},
-std::array<float,2>{0.664419889f, 0.319213778f},
-std::array<float,2>{0.274085373f, 0.583927751f},
-std::array<float,2>{0.151060313f, 0.284143269f},
-std::array<float,2>{0.852067828f, 0.514988303f},
-std::array<float,2>{0.598922789f, 0.0949134901f},
-std::array<float,2>{0.391257644f, 0.785166085f},
-std::array<float,2>{0.322665393f, 0.213522881f},
-std::array<float,2>{0.719757199f, 0.981493056f},
-std::array<float,2>{0.985446632f, 0.431625903f},
-std::array<float,2>{0.0841021314f, 0.705091f},
-std::array<float,2>{0.306803674f, 0.347673327f},
-std::array<float,2>{0.628283739f, 0.600292623f},
-std::array<float,2>{0.917747498f, 0.00975106936f},
-std::array<float,2>{0.0295604225f, 0.847658515f},
-std::array<float,2>{0.237183899f, 0.170311064f},
-std::array<float,2>{0.76761508f, 0.877778769f},
-std::array<float,2>{0.507866561f, 0.456650108f},
-std::array<float,2>{0.455214322f, 0.687311172f},
-std::array<float,2>{0.10347186f, 0.393851489f},
-std::array<float,2>{0.949848175f, 0.74948442f},
-std::array<float,2>{0.700430334f, 0.223311692f},
-std::array<float,2>{0.357590437f, 0.95743233f},
-std::array<float,2>{0.42947343f, 0.0648477152f},
-std::array<float,2>{0.580393851f, 0.768050909f},
-std::array<float,2>{0.831356585f, 0.251170307f},
-std::array<float,2>{0.187462822f, 0.561784387f},
-std::array<float,2>{0.288096309f, 0.399277776f},
-std::array<float,2>{0.641617656f, 0.739112556f},
-std::array<float,2>{0.929117143f, 0.228923902f},
-std::array<float,2>{0.00695675379f, 0.966587365f},
-std::array<float,2>{0.22102268f, 0.0766311511f},
-std::array<float,2>{0.76534766f, 0.775071859f},
-std::array<float,2>{0.525467753f, 0.259016514f},
-std::array<float,2>{0.44260034f, 0.550208151f},
-std::array<float,2>{0.11293973f, 0.357390672f},
-std::array<float,2>{0.955073118f, 0.605522096f},
-std::array<float,2>{0.710727632f, 0.00669424376f},
-std::array<float,2>{0.363380671f, 0.852401137f},
-std::array<float,2>{0.419297963f, 0.161255121f},
-std::array<float,2>{0.570168376f, 0.88728261f},
-std::array<float,2>{0.813184559f, 0.464164555f},
-std::array<float,2>{0.171464726f, 0.676314116f},
-std::array<float,2>{0.478386194f, 0.294853956f},
-std::array<float,2>{0.54491353f, 0.507634878f},
-std::array<float,2>{0.7978369f, 0.106070921f},
-std::array<float,2>{0.201572329f, 0.794399261f},
-std::array<float,2>{0.0543524474f, 0.206137478f},
-std::array<float,2>{0.900664628f, 0.972166777f},
-std::array<float,2>{0.672298253f, 0.425371855f},
-std::array<float,2>{0.257231444f, 0.711376905f},
-std::array<float,2>{0.13452214f, 0.495169133f},
-std::array<float,2>{0.859547675f, 0.62926954f},
-std::array<float,2>{0.617345154f, 0.141311675f},
-std::array<float,2>{0.376970023f, 0.932144344f},
-std::array<float,2>{0.336698949f, 0.0575264655f},
-std::array<float,2>{0.742943883f, 0.819806576f},
-std::array<float,2>{0.976453185f, 0.321290493f},
-std::array<float,2>{0.071556665f, 0.592402458f},
-std::array<float,2>{0.394658655f, 0.439977676f},
-std::array<float,2>{0.594010115f, 0.657102466f},
-std::array<float,2>{0.857712984f, 0.18559736f},
-std::array<float,2>{0.155759096f, 0.893251836f},
-std::array<float,2>{0.0787482411f, 0.0198922027f},
-std::array<float,2>{0.990448534f, 0.868723392f},
-std::array<float,2>{0.72567445f, 0.369115174f},
-std::array<float,2>{0.32728681f, 0.62426734f},
-std::array<float,2>{0.209599137f, 0.269463092f},
-std::array<float,2>{0.792394698f, 0.537245393f},
-std::array<float,2>{0.548675478f, 0.089559786f},
-std::array<float,2>{0.485303849f, 0.763585269f},
-std::array<float,2>{0.280636251f, 0.242534667f},
-std::array<float,2>{0.669317007f, 0.95103544f},
-std::array<float,2>{0.877013862f, 0.383611619f},
-std::array<float,2>{0.0366427526f, 0.71920085f},
-std::array<float,2>{0.353917718f, 0.336365432f},
-std::array<float,2>{0.697313488f, 0.571056366f},
-std::array<float,2>{0.946410835f, 0.0329937935f},
-std::array<float,2>{0.107057624f, 0.839716733f},
-std::array<float,2>{0.18167074f, 0.131428882f},
-std::array<float,2>{0.834535956f, 0.917993903f},
-std::array<float,2>{0.582615077f, 0.471894592f},
-std::array<float,2>{0.422487825f, 0.654004097f},
-std::array<float,2>{0.0263920669f, 0.408270657f},
-std::array<float,2>{0.918493569f, 0.694047153f},
-std::array<float,2>{0.632799685f, 0.194890708f},
-std::array<float,2>{0.309597731f, 0.999807239f},
-std::array<float,2>{0.460888773f, 0.111064978f},
-std::array<float,2>{0.513081133f, 0.809004486f},
-std::array<float,2>{0.772580087f, 0.297357172f},
-std::array<float,2>{0.240432099f, 0.530857801f},
-std::array<float,2>{0.314774394f, 0.483553857f},
-std::array<float,2>{0.726742744f, 0.642990947f},
-std::array<float,2>{0.996550679f, 0.137276396f},
-std::array<float,2>{0.0865968838f, 0.911875069f},
-std::array<float,2>{0.141197369f, 0.0396760851f},
-std::array<float,2>{0.850828707f, 0.834690094f},
-std::array<float,2>{0.604256511f, 0.333544254f},
-std::array<float,2>{0.405873984f, 0.570257783f},
-std::array<float,2>{0.0407970175f, 0.311650187f},
-std::array<float,2>{0.887074172f, 0.51638478f},
-std::array<float,2>{0.66364193f, 0.123858668f},
-std::array<float,2>{0.270195067f, 0.800738811f},
-std::array<float,2>{0.493002445f, 0.202140421f},
-std::array<float,2>{0.561542928f, 0.987854064f},
-std::array<float,2>{0.783214569f, 0.414986044f},
-std::array<float,2>{0.21451959f, 0.702448845f},
-std::array<float,2>{0.430028468f, 0.362279296f},
-std::array<float,2>{0.588267267f, 0.617154956f},
-std::array<float,2>{0.842396677f, 0.0290071517f},
-std::array<float,2>{0.176143944f, 0.866415918f},
-std::array<float,2>{0.0941901356f, 0.178254753f},
-std::array<float,2>{0.94111222f, 0.901365399f},
-std::array<float,2>{0.694792867f, 0.452345371f},
-std::array<float,2>{0.347254395f, 0.670680404f},
-std::array<float,2>{0.248086542f, 0.378193706f},
-std::array<float,2>{0.779943943f, 0.730394661f},
-std::array<float,2>{0.501086354f, 0.238445267f},
-std::array<float,2>{0.4654558f, 0.938926041f},
-std::array<float,2>{0.30081892f, 0.082072854f},
-std::array<float,2>{0.639801085f, 0.757066488f},
-std::array<float,2>{0.90808624f, 0.278906226f},
-std::array<float,2>{0.020404581f, 0.545394063f},
-std::array<float,2>{0.449508607f, 0.435051978f},
-std::array<float,2>{0.519254029f, 0.710764706f},
-std::array<float,2>{0.751245022f, 0.216804266f},
-std::array<float,2>{0.227436945f, 0.980243981f},
-std::array<float,2>{0.0147742489f, 0.100123368f},
-std::array<float,2>{0.932156026f, 0.784540832f},
-std::array<float,2>{0.653270125f, 0.287904799f},
-std::array<float,2>{0.295047641f, 0.511250257f},
-std::array<float,2>{0.160732821f, 0.314913124f},
-std::array<float,2>{0.827723026f, 0.581300795f},
-std::array<float,2>{0.575206399f, 0.0519819818f},
-std::array<float,2>{0.410242468f, 0.82134378f},
-std::array<float,2>{0.373270273f, 0.153442383f},
-std::array<float,2>{0.717031777f, 0.92277211f},
-std::array<float,2>{0.966629863f, 0.485966206f},
-std::array<float,2>{0.122478999f, 0.634264708f},
-std::array<float,2>{0.259412259f, 0.255438089f},
-std::array<float,2>{0.683526337f, 0.558473766f},
-std::array<float,2>{0.895614326f, 0.0677791685f},
-std::array<float,2>{0.0547173694f, 0.772923589f},
-std::array<float,2>{0.192097932f, 0.21929203f},
-std::array<float,2>{0.809637725f, 0.954678416f},
-std::array<float,2>{0.532174766f, 0.396510631f},
-std::array<float,2>{0.471328586f, 0.743418634f},
-std::array<float,2>{0.0693027303f, 0.45952329f},
-std::array<float,2>{0.984204352f, 0.682099998f},
-std::array<float,2>{0.740893602f, 0.167143419f},
-std::array<float,2>{0.333971977f, 0.879537046f},
-std::array<float,2>{0.38342309f, 0.012882988f},
-std::array<float,2>{0.611117184f, 0.844369352f},
-std::array<float,2>{0.868244171f, 0.344560444f},
-std::array<float,2>{0.127347738f, 0.594792187f},
-std::array<float,2>{0.263946146f, 0.474507481f},
-std::array<float,2>{0.685050189f, 0.651482463f},
-std::array<float,2>{0.892634273f, 0.125528067f},
-std::array<float,2>{0.0608950518f, 0.915269077f},
-std::array<float,2>{0.188790455f, 0.0372307375f},
-std::array<float,2>{0.806431055f, 0.840254843f},
-std::array<float,2>{0.537371516f, 0.341294318f},
-std::array<float,2>{0.474394739f, 0.577901185f},
-std::array<float,2>{0.0637748539f, 0.303273141f},
-std::array<float,2>{0.978881896f, 0.525711596f},
-std::array<float,2>{0.737433314f, 0.113726787f},
-std::array<float,2>{0.328458607f, 0.805379093f},
-std::array<float,2>{0.388756216f, 0.189569771f},
-std::array<float,2>{0.614481926f, 0.99236387f},
-std::array<float,2>{0.871484935f, 0.410935849f},
-std::array<float,2>{0.130084887f, 0.690535843f},
-std::array<float,2>{0.445850432f, 0.374438822f},
-std::array<float,2>{0.519548655f, 0.619731784f},
-std::array<float,2>{0.757451415f, 0.0158797894f},
-std::array<float,2>{0.232171357f, 0.873515248f},
-std::array<float,2>{0.00808712281f, 0.180605441f},
-std::array<float,2>{0.934443593f, 0.896096408f},
-std::array<float,2>{0.648483694f, 0.445113122f},
-std::array<float,2>{0.290558517f, 0.661272049f},
-std::array<float,2>{0.156907618f, 0.389225215f},
-std::array<float,2>{0.820970237f, 0.724774063f},
-std::array<float,2>{0.57218951f, 0.249041036f},
-std::array<float,2>{0.407211095f, 0.947969079f},
-std::array<float,2>{0.370162368f, 0.0924193263f},
-std::array<float,2>{0.714484751f, 0.760683894f},
-std::array<float,2>{0.96181953f, 0.272537112f},
-std::array<float,2>{0.119296744f, 0.532594025f},
-std::array<float,2>{0.436143309f, 0.426590294f},
-std::array<float,2>{0.591663897f, 0.718098521f},
-std::array<float,2>{0.838602483f, 0.208806783f},
-std::array<float,2>{0.172765732f, 0.975281239f},
-std::array<float,2>{0.0995192304f, 0.104135521f},
-std::array<float,2>{0.94456768f, 0.789935708f},
-std::array<float,2>{0.690678716f, 0.291624159f},
-std::array<float,2>{0.350115001f, 0.500038028f},
-std::array<float,2>{0.242506117f, 0.325698614f},
-std::array<float,2>{0.775357068f, 0.588398933f},
-std::array<float,2>{0.506469071f, 0.0607441664f},
-std::array<float,2>{0.463053435f, 0.814258933f},
-std::array<float,2>{0.298769861f, 0.147104815f},
-std::array<float,2>{0.633499444f, 0.933722258f},
-std::array<float,2>{0.913581491f, 0.499551564f},
-std::array<float,2>{0.0186311454f, 0.627129853f},
-std::array<float,2>{0.318487883f, 0.261836439f},
-std::array<float,2>{0.734238803f, 0.552286625f},
-std::array<float,2>{0.994678855f, 0.0731897056f},
-std::array<float,2>{0.0917039961f, 0.779126346f},
-std::array<float,2>{0.147907481f, 0.23201324f},
-std::array<float,2>{0.845369697f, 0.96354866f},
-std::array<float,2>{0.605723858f, 0.404207468f},
-std::array<float,2>{0.401346743f, 0.736168742f},
-std::array<float,2>{0.0440440886f, 0.46750918f},
-std::array<float,2>{0.884414017f, 0.672722757f},
-std::array<float,2>{0.657651365f, 0.158217132f},
-std::array<float,2>{0.265680134f, 0.883971751f},
-std::array<float,2>{0.496602565f, 0.00308623794f},
-std::array<float,2>{0.558100581f, 0.856669664f},
-std::array<float,2>{0.785329163f, 0.353881091f},
-std::array<float,2>{0.215236872f, 0.60403347f},
-std::array<float,2>{0.359250605f, 0.390879393f},
-std::array<float,2>{0.699912727f, 0.746749818f},
-std::array<float,2>{0.950887859f, 0.225085393f},
-std::array<float,2>{0.102535836f, 0.96043998f},
-std::array<float,2>{0.185659379f, 0.0639879555f},
-std::array<float,2>{0.830649078f, 0.766933739f},
-std::array<float,2>{0.581516445f, 0.252076447f},
-std::array<float,2>{0.428576857f, 0.559892178f},
-std::array<float,2>{0.0309395306f, 0.350600451f},
-std::array<float,2>{0.916016996f, 0.59951669f},
-std::array<float,2>{0.62761724f, 0.011074204f},
-std::array<float,2>{0.307775736f, 0.851344228f},
-std::array<float,2>{0.4566603f, 0.169281796f},
-std::array<float,2>{0.509572446f, 0.875469387f},
-std::array<float,2>{0.768958628f, 0.454809099f},
-std::array<float,2>{0.237908706f, 0.685305178f},
-std::array<float,2>{0.392472833f, 0.282644749f},
-std::array<float,2>{0.59848702f, 0.511857569f},
-std::array<float,2>{0.853077352f, 0.0968466327f},
-std::array<float,2>{0.151958823f, 0.787836373f},
-std::array<float,2>{0.0849977061f, 0.212159783f},
-std::array<float,2>{0.984726489f, 0.983473897f},
-std::array<float,2>{0.719107985f, 0.432130218f},
-std::array<float,2>{0.323391706f, 0.703312278f},
-std::array<float,2>{0.205581576f, 0.490201026f},
-std::array<float,2>{0.794133723f, 0.638893604f},
-std::array<float,2>{0.554416418f, 0.14969638f},
-std::array<float,2>{0.490737557f, 0.929522038f},
-std::array<float,2>{0.274719834f, 0.0478188358f},
-std::array<float,2>{0.665816605f, 0.826620698f},
-std::array<float,2>{0.879515767f, 0.316848159f},
-std::array<float,2>{0.0325635262f, 0.585404098f},
-std::array<float,2>{0.482991844f, 0.448422194f},
-std::array<float,2>{0.541263402f, 0.666028619f},
-std::array<float,2>{0.803421438f, 0.173209816f},
-std::array<float,2>{0.19588384f, 0.903344929f},
-std::array<float,2>{0.048042357f, 0.025468234f},
-std::array<float,2>{0.903080285f, 0.859638512f},
-std::array<float,2>{0.677431285f, 0.366853625f},
-std::array<float,2>{0.253388137f, 0.613150239f},
-std::array<float,2>{0.138274059f, 0.275260657f},
-std::array<float,2>{0.864928246f, 0.539167583f},
-std::array<float,2>{0.623425663f, 0.0803028941f},
-std::array<float,2>{0.379183084f, 0.751973271f},
-std::array<float,2>{0.341600418f, 0.234816939f},
-std::array<float,2>{0.749603927f, 0.944371402f},
-std::array<float,2>{0.968919992f, 0.382727802f},
-std::array<float,2>{0.0754887834f, 0.732879937f},
-std::array<float,2>{0.282809794f, 0.329740763f},
-std::array<float,2>{0.644773424f, 0.562740266f},
-std::array<float,2>{0.924421847f, 0.0433852673f},
-std::array<float,2>{0.00127553241f, 0.831925631f},
-std::array<float,2>{0.223550588f, 0.135430142f},
-std::array<float,2>{0.760303617f, 0.909188151f},
-std::array<float,2>{0.530892193f, 0.477999806f},
-std::array<float,2>{0.438760072f, 0.64473027f},
-std::array<float,2>{0.114575155f, 0.418310553f},
-std::array<float,2>{0.959186375f, 0.695794225f},
-std::array<float,2>{0.704275668f, 0.199186996f},
-std::array<float,2>{0.360408276f, 0.992023647f},
-std::array<float,2>{0.417238891f, 0.117576301f},
-std::array<float,2>{0.562950075f, 0.802010477f},
-std::array<float,2>{0.820153058f, 0.305078208f},
-std::array<float,2>{0.164320037f, 0.523390949f},
-std::array<float,2>{0.308640361f, 0.406721354f},
-std::array<float,2>{0.630916595f, 0.692536891f},
-std::array<float,2>{0.919228673f, 0.191886887f},
-std::array<float,2>{0.026332844f, 0.996718109f},
-std::array<float,2>{0.241598755f, 0.11251431f},
-std::array<float,2>{0.772032082f, 0.812089682f},
-std::array<float,2>{0.512105703f, 0.299419761f},
-std::array<float,2>{0.459792674f, 0.527570665f},
-std::array<float,2>{0.106202342f, 0.33887586f},
-std::array<float,2>{0.945576489f, 0.573289931f},
-std::array<float,2>{0.698359847f, 0.0343657956f},
-std::array<float,2>{0.35450995f, 0.836132944f},
-std::array<float,2>{0.423735201f, 0.130294129f},
-std::array<float,2>{0.583963215f, 0.9206146f},
-std::array<float,2>{0.835464418f, 0.46901685f},
-std::array<float,2>{0.183571339f, 0.655923963f},
-std::array<float,2>{0.486202091f, 0.266835362f},
-std::array<float,2>{0.547282279f, 0.53526175f},
-std::array<float,2>{0.791698635f, 0.0870684609f},
-std::array<float,2>{0.210823983f, 0.764080763f},
-std::array<float,2>{0.0355874039f, 0.245572388f},
-std::array<float,2>{0.878790736f, 0.951865613f},
-std::array<float,2>{0.668199897f, 0.384878248f},
-std::array<float,2>{0.279563874f, 0.722533047f},
-std::array<float,2>{0.155142829f, 0.439013213f},
-std::array<float,2>{0.859369814f, 0.658518732f},
-std::array<float,2>{0.595300674f, 0.18515563f},
-std::array<float,2>{0.396209568f, 0.891079724f},
-std::array<float,2>{0.326319367f, 0.0227054842f},
-std::array<float,2>{0.724848449f, 0.869455934f},
-std::array<float,2>{0.99199158f, 0.370921046f},
-std::array<float,2>{0.0793151185f, 0.621420741f},
-std::array<float,2>{0.378043681f, 0.493429661f},
-std::array<float,2>{0.61905998f, 0.632055461f},
-std::array<float,2>{0.861092567f, 0.144411728f},
-std::array<float,2>{0.133073121f, 0.931447923f},
-std::array<float,2>{0.0708377957f, 0.0552979596f},
-std::array<float,2>{0.974880278f, 0.817327201f},
-std::array<float,2>{0.744027674f, 0.323560357f},
-std::array<float,2>{0.337450564f, 0.591226995f},
-std::array<float,2>{0.20298852f, 0.295485497f},
-std::array<float,2>{0.798126221f, 0.505842686f},
-std::array<float,2>{0.543587804f, 0.108518757f},
-std::array<float,2>{0.477097273f, 0.79643476f},
-std::array<float,2>{0.256798148f, 0.203393131f},
-std::array<float,2>{0.673343241f, 0.970330119f},
-std::array<float,2>{0.901587188f, 0.422852129f},
-std::array<float,2>{0.0528394096f, 0.71397239f},
-std::array<float,2>{0.3647587f, 0.359366238f},
-std::array<float,2>{0.709874988f, 0.609244943f},
-std::array<float,2>{0.953562677f, 0.00513163302f},
-std::array<float,2>{0.112006396f, 0.853556037f},
-std::array<float,2>{0.169958323f, 0.163309306f},
-std::array<float,2>{0.813936889f, 0.889640808f},
-std::array<float,2>{0.568599939f, 0.46282205f},
-std::array<float,2>{0.41854164f, 0.678347588f},
-std::array<float,2>{0.00603320962f, 0.402040392f},
-std::array<float,2>{0.92820394f, 0.740420997f},
-std::array<float,2>{0.640653491f, 0.228406861f},
-std::array<float,2>{0.287938505f, 0.967959046f},
-std::array<float,2>{0.441960692f, 0.0751579702f},
-std::array<float,2>{0.527104914f, 0.777083576f},
-std::array<float,2>{0.76442796f, 0.26022166f},
-std::array<float,2>{0.222603351f, 0.547230363f},
-std::array<float,2>{0.332766354f, 0.458512694f},
-std::array<float,2>{0.741342366f, 0.680008113f},
-std::array<float,2>{0.982756376f, 0.164154381f},
-std::array<float,2>{0.0701222047f, 0.880924642f},
-std::array<float,2>{0.12836729f, 0.0154731981f},
-std::array<float,2>{0.867301166f, 0.84736681f},
-std::array<float,2>{0.610100091f, 0.347038329f},
-std::array<float,2>{0.383903116f, 0.597247481f},
-std::array<float,2>{0.0562237874f, 0.256871909f},
-std::array<float,2>{0.895018697f, 0.555379987f},
-std::array<float,2>{0.6816504f, 0.0684706867f},
-std::array<float,2>{0.258178145f, 0.770773351f},
-std::array<float,2>{0.4722763f, 0.221458942f},
-std::array<float,2>{0.532798469f, 0.955154121f},
-std::array<float,2>{0.809330821f, 0.395414799f},
-std::array<float,2>{0.192808136f, 0.745121181f},
-std::array<float,2>{0.411406696f, 0.314153403f},
-std::array<float,2>{0.574314058f, 0.579376042f},
-std::array<float,2>{0.826416433f, 0.0544559211f},
-std::array<float,2>{0.162059322f, 0.822327554f},
-std::array<float,2>{0.121133037f, 0.154625624f},
-std::array<float,2>{0.965064824f, 0.925628245f},
-std::array<float,2>{0.718599796f, 0.488217294f},
-std::array<float,2>{0.374749035f, 0.636058688f},
-std::array<float,2>{0.228242159f, 0.437412769f},
-std::array<float,2>{0.750223517f, 0.707557559f},
-std::array<float,2>{0.517852187f, 0.215320751f},
-std::array<float,2>{0.450554401f, 0.976914644f},
-std::array<float,2>{0.295990556f, 0.0993912816f},
-std::array<float,2>{0.653939247f, 0.782703161f},
-std::array<float,2>{0.933384717f, 0.285794139f},
-std::array<float,2>{0.0141905034f, 0.507977843f},
-std::array<float,2>{0.466554046f, 0.375726283f},
-std::array<float,2>{0.500200868f, 0.727217376f},
-std::array<float,2>{0.780425489f, 0.241625026f},
-std::array<float,2>{0.249370798f, 0.940005481f},
-std::array<float,2>{0.0206872784f, 0.0839846209f},
-std::array<float,2>{0.906557918f, 0.754185557f},
-std::array<float,2>{0.638704896f, 0.279528528f},
-std::array<float,2>{0.302219182f, 0.543526173f},
-std::array<float,2>{0.17772454f, 0.361255527f},
-std::array<float,2>{0.843283296f, 0.614593863f},
-std::array<float,2>{0.589219034f, 0.029633902f},
-std::array<float,2>{0.431243092f, 0.864069939f},
-std::array<float,2>{0.345705152f, 0.177476302f},
-std::array<float,2>{0.69384557f, 0.89976871f},
-std::array<float,2>{0.939575732f, 0.450939804f},
-std::array<float,2>{0.0954771638f, 0.669030368f},
-std::array<float,2>{0.271461725f, 0.309073389f},
-std::array<float,2>{0.662550092f, 0.517602503f},
-std::array<float,2>{0.887712181f, 0.122373715f},
-std::array<float,2>{0.039663218f, 0.796896517f},
-std::array<float,2>{0.213325799f, 0.200020239f},
-std::array<float,2>{0.784417987f, 0.986294389f},
-std::array<float,2>{0.56064707f, 0.416599661f},
-std::array<float,2>{0.493358225f, 0.700873733f},
-std::array<float,2>{0.0873371214f, 0.482026935f},
-std::array<float,2>{0.997496247f, 0.641098917f},
-std::array<float,2>{0.728263497f, 0.138777927f},
-std::array<float,2>{0.315894276f, 0.913088739f},
-std::array<float,2>{0.404774606f, 0.0414033532f},
-std::array<float,2>{0.605143487f, 0.832635283f},
-std::array<float,2>{0.850035071f, 0.334644198f},
-std::array<float,2>{0.14198409f, 0.568175793f},
-std::array<float,2>{0.291960716f, 0.44326514f},
-std::array<float,2>{0.650812566f, 0.663033068f},
-std::array<float,2>{0.936596334f, 0.183074534f},
-std::array<float,2>{0.0101454565f, 0.897918284f},
-std::array<float,2>{0.232916474f, 0.0185903534f},
-std::array<float,2>{0.755213141f, 0.872667015f},
-std::array<float,2>{0.522112489f, 0.371462077f},
-std::array<float,2>{0.44912827f, 0.617301285f},
-std::array<float,2>{0.117662534f, 0.270958126f},
-std::array<float,2>{0.96459192f, 0.534613371f},
-std::array<float,2>{0.711480737f, 0.0902184099f},
-std::array<float,2>{0.367900968f, 0.757881701f},
-std::array<float,2>{0.40928039f, 0.247956559f},
-std::array<float,2>{0.573726058f, 0.945414722f},
-std::array<float,2>{0.822915554f, 0.387327492f},
-std::array<float,2>{0.159703404f, 0.72386539f},
-std::array<float,2>{0.474968612f, 0.34243983f},
-std::array<float,2>{0.537013173f, 0.57585144f},
-std::array<float,2>{0.806987405f, 0.035660699f},
-std::array<float,2>{0.191330075f, 0.842142522f},
-std::array<float,2>{0.0594704673f, 0.126978785f},
-std::array<float,2>{0.892131031f, 0.917551458f},
-std::array<float,2>{0.686935902f, 0.475333899f},
-std::array<float,2>{0.262881458f, 0.649680078f},
-std::array<float,2>{0.131591588f, 0.41222769f},
-std::array<float,2>{0.874372423f, 0.688625515f},
-std::array<float,2>{0.616088212f, 0.188027456f},
-std::array<float,2>{0.388212085f, 0.995874226f},
-std::array<float,2>{0.3306126f, 0.116540186f},
-std::array<float,2>{0.735852003f, 0.807465672f},
-std::array<float,2>{0.976565301f, 0.301626265f},
-std::array<float,2>{0.0646588728f, 0.524850607f},
-std::array<float,2>{0.399737418f, 0.404532343f},
-std::array<float,2>{0.60845685f, 0.73674047f},
-std::array<float,2>{0.847365439f, 0.234254271f},
-std::array<float,2>{0.146123618f, 0.962592721f},
-std::array<float,2>{0.0930469632f, 0.0704588443f},
-std::array<float,2>{0.992264152f, 0.780443132f},
-std::array<float,2>{0.731827259f, 0.265446454f},
-std::array<float,2>{0.318085998f, 0.552921057f},
-std::array<float,2>{0.217189595f, 0.353447139f},
-std::array<float,2>{0.788491547f, 0.602248609f},
-std::array<float,2>{0.556219995f, 0.00132558227f},
-std::array<float,2>{0.49861294f, 0.858362198f},
-std::array<float,2>{0.269097239f, 0.157024994f},
-std::array<float,2>{0.658440292f, 0.886023045f},
-std::array<float,2>{0.884842277f, 0.466713309f},
-std::array<float,2>{0.0463749617f, 0.674420953f},
-std::array<float,2>{0.348831266f, 0.290502131f},
-std::array<float,2>{0.688296258f, 0.503429174f},
-std::array<float,2>{0.942928672f, 0.102613218f},
-std::array<float,2>{0.101546533f, 0.792643726f},
-std::array<float,2>{0.174714163f, 0.209753677f},
-std::array<float,2>{0.837752521f, 0.974553883f},
-std::array<float,2>{0.592574835f, 0.427933902f},
-std::array<float,2>{0.434630662f, 0.716575623f},
-std::array<float,2>{0.0170637351f, 0.497305095f},
-std::array<float,2>{0.91027844f, 0.62582916f},
-std::array<float,2>{0.636226296f, 0.145835549f},
-std::array<float,2>{0.300479323f, 0.936250448f},
-std::array<float,2>{0.461419284f, 0.0594795756f},
-std::array<float,2>{0.505825162f, 0.814956427f},
-std::array<float,2>{0.777322352f, 0.32634455f},
-std::array<float,2>{0.245408714f, 0.587752163f},
-std::array<float,2>{0.320854366f, 0.429905176f},
-std::array<float,2>{0.722271562f, 0.706562459f},
-std::array<float,2>{0.987888217f, 0.21483244f},
-std::array<float,2>{0.0833575651f, 0.980793715f},
-std::array<float,2>{0.14931567f, 0.0946878493f},
-std::array<float,2>{0.85431689f, 0.78630513f},
-std::array<float,2>{0.599907875f, 0.284189194f},
-std::array<float,2>{0.392926931f, 0.514449954f},
-std::array<float,2>{0.0350547619f, 0.319801092f},
-std::array<float,2>{0.882144213f, 0.582960904f},
-std::array<float,2>{0.667927861f, 0.0498469844f},
-std::array<float,2>{0.275881737f, 0.826027632f},
-std::array<float,2>{0.489835173f, 0.151726827f},
-std::array<float,2>{0.551478386f, 0.927131057f},
-std::array<float,2>{0.796289623f, 0.491859406f},
-std::array<float,2>{0.203347981f, 0.638332129f},
-std::array<float,2>{0.426853895f, 0.250804216f},
-std::array<float,2>{0.578237116f, 0.561227918f},
-std::array<float,2>{0.828166544f, 0.0658990443f},
-std::array<float,2>{0.185223863f, 0.769308865f},
-std::array<float,2>{0.104500026f, 0.224039897f},
-std::array<float,2>{0.952491045f, 0.958044529f},
-std::array<float,2>{0.701782584f, 0.393119365f},
-std::array<float,2>{0.355494618f, 0.7482692f},
-std::array<float,2>{0.234526426f, 0.455862582f},
-std::array<float,2>{0.766201437f, 0.686322153f},
-std::array<float,2>{0.510707796f, 0.171596423f},
-std::array<float,2>{0.453418851f, 0.878154516f},
-std::array<float,2>{0.306150734f, 0.00817542616f},
-std::array<float,2>{0.626907647f, 0.849548876f},
-std::array<float,2>{0.915091753f, 0.34884575f},
-std::array<float,2>{0.0288140196f, 0.600834727f},
-std::array<float,2>{0.439905077f, 0.479424149f},
-std::array<float,2>{0.527583778f, 0.64804697f},
-std::array<float,2>{0.759593546f, 0.13378796f},
-std::array<float,2>{0.225524083f, 0.907404959f},
-std::array<float,2>{0.00311576994f, 0.046033401f},
-std::array<float,2>{0.922946274f, 0.828758478f},
-std::array<float,2>{0.647444665f, 0.331328928f},
-std::array<float,2>{0.284553021f, 0.565547705f},
-std::array<float,2>{0.166228682f, 0.30807066f},
-std::array<float,2>{0.817625165f, 0.52094692f},
-std::array<float,2>{0.564793885f, 0.119899936f},
-std::array<float,2>{0.414398104f, 0.803525388f},
-std::array<float,2>{0.362242371f, 0.196306974f},
-std::array<float,2>{0.706103623f, 0.989910543f},
-std::array<float,2>{0.958574653f, 0.420639873f},
-std::array<float,2>{0.115732238f, 0.697380364f},
-std::array<float,2>{0.250191271f, 0.364305526f},
-std::array<float,2>{0.678145945f, 0.610478699f},
-std::array<float,2>{0.905512571f, 0.0240060966f},
-std::array<float,2>{0.0498413853f, 0.862232864f},
-std::array<float,2>{0.19845736f, 0.175673693f},
-std::array<float,2>{0.802373946f, 0.905516088f},
-std::array<float,2>{0.540694416f, 0.445863634f},
-std::array<float,2>{0.480864674f, 0.665528119f},
-std::array<float,2>{0.0767947063f, 0.379800975f},
-std::array<float,2>{0.972114146f, 0.73075515f},
-std::array<float,2>{0.747035742f, 0.236717939f},
-std::array<float,2>{0.342447042f, 0.942678988f},
-std::array<float,2>{0.381836176f, 0.0793761611f},
-std::array<float,2>{0.621643484f, 0.750787795f},
-std::array<float,2>{0.866092682f, 0.277301192f},
-std::array<float,2>{0.138754964f, 0.541197717f},
-std::array<float,2>{0.277375907f, 0.384191781f},
-std::array<float,2>{0.670010805f, 0.720671535f},
-std::array<float,2>{0.875300586f, 0.243259743f},
-std::array<float,2>{0.0378505774f, 0.94973129f},
-std::array<float,2>{0.20788084f, 0.0884309337f},
-std::array<float,2>{0.789066553f, 0.761917233f},
-std::array<float,2>{0.549059451f, 0.267618537f},
-std::array<float,2>{0.48746267f, 0.538992524f},
-std::array<float,2>{0.0818861201f, 0.367326111f},
-std::array<float,2>{0.98957926f, 0.623630881f},
-std::array<float,2>{0.723669052f, 0.0214541759f},
-std::array<float,2>{0.324609309f, 0.868118346f},
-std::array<float,2>{0.398028553f, 0.187041357f},
-std::array<float,2>{0.596919f, 0.89365232f},
-std::array<float,2>{0.85620141f, 0.441379547f},
-std::array<float,2>{0.153562874f, 0.657624245f},
-std::array<float,2>{0.45870176f, 0.298460186f},
-std::array<float,2>{0.515344024f, 0.529535353f},
-std::array<float,2>{0.7712394f, 0.110311896f},
-std::array<float,2>{0.240191728f, 0.810531914f},
-std::array<float,2>{0.0235149823f, 0.193434134f},
-std::array<float,2>{0.921186507f, 0.998686314f},
-std::array<float,2>{0.630387127f, 0.410155028f},
-std::array<float,2>{0.312176019f, 0.694929659f},
-std::array<float,2>{0.180176541f, 0.471537471f},
-std::array<float,2>{0.83280623f, 0.65306443f},
-std::array<float,2>{0.584347606f, 0.132469967f},
-std::array<float,2>{0.425655812f, 0.919828653f},
-std::array<float,2>{0.352801472f, 0.0312831514f},
-std::array<float,2>{0.696317017f, 0.838431239f},
-std::array<float,2>{0.947785735f, 0.337522686f},
-std::array<float,2>{0.107468285f, 0.571619391f},
-std::array<float,2>{0.420441866f, 0.463681698f},
-std::array<float,2>{0.567521691f, 0.677211583f},
-std::array<float,2>{0.814704359f, 0.16058062f},
-std::array<float,2>{0.168749124f, 0.888629019f},
-std::array<float,2>{0.10991887f, 0.00720956922f},
-std::array<float,2>{0.956201136f, 0.853253603f},
-std::array<float,2>{0.707649171f, 0.355787963f},
-std::array<float,2>{0.366567075f, 0.607096732f},
-std::array<float,2>{0.22001411f, 0.258568078f},
-std::array<float,2>{0.762049139f, 0.548877358f},
-std::array<float,2>{0.523893595f, 0.0776399001f},
-std::array<float,2>{0.444404304f, 0.773866415f},
-std::array<float,2>{0.285244346f, 0.230119005f},
-std::array<float,2>{0.643220842f, 0.965092719f},
-std::array<float,2>{0.92617023f, 0.400195867f},
-std::array<float,2>{0.00490710465f, 0.739376068f},
-std::array<float,2>{0.33897686f, 0.320473939f},
-std::array<float,2>{0.745049417f, 0.593230128f},
-std::array<float,2>{0.973197222f, 0.0576992594f},
-std::array<float,2>{0.0730331242f, 0.818847835f},
-std::array<float,2>{0.135341167f, 0.142496139f},
-std::array<float,2>{0.862661362f, 0.932957411f},
-std::array<float,2>{0.620632648f, 0.494816959f},
-std::array<float,2>{0.375435144f, 0.630300701f},
-std::array<float,2>{0.0520269684f, 0.423910141f},
-std::array<float,2>{0.900278807f, 0.712664187f},
-std::array<float,2>{0.674956679f, 0.205674291f},
-std::array<float,2>{0.255446374f, 0.971645951f},
-std::array<float,2>{0.479023904f, 0.106628612f},
-std::array<float,2>{0.545549333f, 0.793031871f},
-std::array<float,2>{0.800292075f, 0.293261558f},
-std::array<float,2>{0.200498506f, 0.505933046f},
-std::array<float,2>{0.372408152f, 0.484425068f},
-std::array<float,2>{0.714866579f, 0.633766472f},
-std::array<float,2>{0.967154562f, 0.153155953f},
-std::array<float,2>{0.124585345f, 0.922863841f},
-std::array<float,2>{0.162625685f, 0.0511454903f},
-std::array<float,2>{0.825005472f, 0.820757508f},
-std::array<float,2>{0.577011406f, 0.316132694f},
-std::array<float,2>{0.412310869f, 0.581045926f},
-std::array<float,2>{0.0128159765f, 0.288882941f},
-std::array<float,2>{0.93019408f, 0.509923518f},
-std::array<float,2>{0.654921174f, 0.100733563f},
-std::array<float,2>{0.294588745f, 0.784091711f},
-std::array<float,2>{0.452913821f, 0.217946902f},
-std::array<float,2>{0.517033398f, 0.978634119f},
-std::array<float,2>{0.75386703f, 0.433897465f},
-std::array<float,2>{0.229510486f, 0.709303916f},
-std::array<float,2>{0.384868473f, 0.3454853f},
-std::array<float,2>{0.61144489f, 0.593978882f},
-std::array<float,2>{0.870817721f, 0.0122595867f},
-std::array<float,2>{0.126773089f, 0.84513855f},
-std::array<float,2>{0.0673118308f, 0.166218743f},
-std::array<float,2>{0.980758488f, 0.880698204f},
-std::array<float,2>{0.739801526f, 0.460917056f},
-std::array<float,2>{0.33414942f, 0.683260977f},
-std::array<float,2>{0.193748921f, 0.397518516f},
-std::array<float,2>{0.811642051f, 0.742428899f},
-std::array<float,2>{0.534287274f, 0.22032401f},
-std::array<float,2>{0.47066769f, 0.953758121f},
-std::array<float,2>{0.260117412f, 0.0669071451f},
-std::array<float,2>{0.680591941f, 0.77236867f},
-std::array<float,2>{0.898405492f, 0.25408268f},
-std::array<float,2>{0.057284832f, 0.556858301f},
-std::array<float,2>{0.495083749f, 0.415383846f},
-std::array<float,2>{0.558778346f, 0.701883554f},
-std::array<float,2>{0.782568038f, 0.202183738f},
-std::array<float,2>{0.21106483f, 0.987065852f},
-std::array<float,2>{0.0417660698f, 0.124976963f},
-std::array<float,2>{0.890587926f, 0.799501657f},
-std::array<float,2>{0.661906898f, 0.310726702f},
-std::array<float,2>{0.272318095f, 0.516971767f},
-std::array<float,2>{0.144515648f, 0.332469374f},
-std::array<float,2>{0.849563539f, 0.568503797f},
-std::array<float,2>{0.602844238f, 0.0407919697f},
-std::array<float,2>{0.403345674f, 0.835875571f},
-std::array<float,2>{0.313887984f, 0.138470143f},
-std::array<float,2>{0.729748905f, 0.91042906f},
-std::array<float,2>{0.999417484f, 0.482825816f},
-std::array<float,2>{0.0890493467f, 0.643742144f},
-std::array<float,2>{0.302808404f, 0.277728975f},
-std::array<float,2>{0.637239277f, 0.545994759f},
-std::array<float,2>{0.909470975f, 0.0832904503f},
-std::array<float,2>{0.0221607219f, 0.756100118f},
-std::array<float,2>{0.24659276f, 0.239598289f},
-std::array<float,2>{0.778046012f, 0.938325465f},
-std::array<float,2>{0.503801763f, 0.377463698f},
-std::array<float,2>{0.466970682f, 0.728546262f},
-std::array<float,2>{0.0974984616f, 0.451741129f},
-std::array<float,2>{0.939403415f, 0.671379864f},
-std::array<float,2>{0.69196856f, 0.179169804f},
-std::array<float,2>{0.345129639f, 0.901682913f},
-std::array<float,2>{0.432219118f, 0.0282399282f},
-std::array<float,2>{0.58745867f, 0.866084993f},
-std::array<float,2>{0.840959132f, 0.362522781f},
-std::array<float,2>{0.179402679f, 0.616055131f}}
\ No newline at end of file
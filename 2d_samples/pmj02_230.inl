@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.542123914f, 0.390146315f},
-std::array<float,2>{0.252747625f, 0.554125488f},
-std::array<float,2>{0.931257725f, 0.946857631f},
-std::array<float,2>{0.0116935987f, 0.0554003604f},
-std::array<float,2>{0.793481708f, 0.20128949f},
-std::array<float,2>{0.212327406f, 0.807968974f},
-std::array<float,2>{0.705324471f, 0.626178563f},
-std::array<float,2>{0.390685707f, 0.272665143f},
-std::array<float,2>{0.987749636f, 0.370124131f},
-std::array<float,2>{0.121337146f, 0.697398961f},
-std::array<float,2>{0.603059053f, 0.820543766f},
-std::array<float,2>{0.312668622f, 0.156881139f},
-std::array<float,2>{0.659590065f, 0.0829468295f},
-std::array<float,2>{0.490225285f, 0.932386339f},
-std::array<float,2>{0.8666237f, 0.616804838f},
-std::array<float,2>{0.185184821f, 0.459673077f},
-std::array<float,2>{0.732161701f, 0.292173594f},
-std::array<float,2>{0.42851302f, 0.658946872f},
-std::array<float,2>{0.776718259f, 0.76252526f},
-std::array<float,2>{0.231881887f, 0.225460932f},
-std::array<float,2>{0.894908249f, 0.00841997378f},
-std::array<float,2>{0.0511264876f, 0.991482377f},
-std::array<float,2>{0.509691715f, 0.525377274f},
-std::array<float,2>{0.300026894f, 0.418948442f},
-std::array<float,2>{0.838286817f, 0.485295713f},
-std::array<float,2>{0.129740179f, 0.57053411f},
-std::array<float,2>{0.640801966f, 0.881187499f},
-std::array<float,2>{0.458596468f, 0.111535445f},
-std::array<float,2>{0.588722348f, 0.141979769f},
-std::array<float,2>{0.345029294f, 0.86839062f},
-std::array<float,2>{0.949522436f, 0.727263391f},
-std::array<float,2>{0.0772099197f, 0.31977886f},
-std::array<float,2>{0.619234085f, 0.328902662f},
-std::array<float,2>{0.33341378f, 0.741715789f},
-std::array<float,2>{0.968978167f, 0.85604167f},
-std::array<float,2>{0.100958757f, 0.125200793f},
-std::array<float,2>{0.851572096f, 0.0982747599f},
-std::array<float,2>{0.156774089f, 0.905783355f},
-std::array<float,2>{0.678364933f, 0.581655562f},
-std::array<float,2>{0.476240396f, 0.479423553f},
-std::array<float,2>{0.910174727f, 0.423758298f},
-std::array<float,2>{0.026657531f, 0.51559335f},
-std::array<float,2>{0.548325181f, 0.979976237f},
-std::array<float,2>{0.276565701f, 0.0281721596f},
-std::array<float,2>{0.7012465f, 0.23637107f},
-std::array<float,2>{0.389784992f, 0.772011459f},
-std::array<float,2>{0.807148218f, 0.674835324f},
-std::array<float,2>{0.202799872f, 0.302713513f},
-std::array<float,2>{0.636932552f, 0.447627097f},
-std::array<float,2>{0.438299924f, 0.607403278f},
-std::array<float,2>{0.823029876f, 0.90995115f},
-std::array<float,2>{0.146821141f, 0.0707097277f},
-std::array<float,2>{0.968269765f, 0.185438439f},
-std::array<float,2>{0.0909650773f, 0.837927103f},
-std::array<float,2>{0.567368448f, 0.716105044f},
-std::array<float,2>{0.373503357f, 0.357650191f},
-std::array<float,2>{0.75955224f, 0.256446391f},
-std::array<float,2>{0.235409826f, 0.645647526f},
-std::array<float,2>{0.742084265f, 0.793320775f},
-std::array<float,2>{0.408409894f, 0.215152889f},
-std::array<float,2>{0.530498028f, 0.045453608f},
-std::array<float,2>{0.290257305f, 0.958571434f},
-std::array<float,2>{0.88474232f, 0.540784299f},
-std::array<float,2>{0.0398022495f, 0.393917143f},
-std::array<float,2>{0.575852573f, 0.469692022f},
-std::array<float,2>{0.360715628f, 0.593245208f},
-std::array<float,2>{0.956412435f, 0.894595981f},
-std::array<float,2>{0.0810626373f, 0.107133918f},
-std::array<float,2>{0.815213561f, 0.134841636f},
-std::array<float,2>{0.152824193f, 0.847037911f},
-std::array<float,2>{0.631412923f, 0.74713248f},
-std::array<float,2>{0.452235669f, 0.336929649f},
-std::array<float,2>{0.879788816f, 0.308083355f},
-std::array<float,2>{0.0312693156f, 0.682240665f},
-std::array<float,2>{0.51945436f, 0.78022784f},
-std::array<float,2>{0.288221598f, 0.244188279f},
-std::array<float,2>{0.748238206f, 0.0215264801f},
-std::array<float,2>{0.415858626f, 0.970578015f},
-std::array<float,2>{0.755900562f, 0.505703032f},
-std::array<float,2>{0.24317044f, 0.435703665f},
-std::array<float,2>{0.686721504f, 0.34845975f},
-std::array<float,2>{0.482081503f, 0.706979394f},
-std::array<float,2>{0.849050045f, 0.829072475f},
-std::array<float,2>{0.165383592f, 0.176147461f},
-std::array<float,2>{0.982243121f, 0.063240841f},
-std::array<float,2>{0.104297586f, 0.919222236f},
-std::array<float,2>{0.609962583f, 0.59831512f},
-std::array<float,2>{0.340936661f, 0.440569341f},
-std::array<float,2>{0.796919286f, 0.403848976f},
-std::array<float,2>{0.195221871f, 0.53833127f},
-std::array<float,2>{0.691707671f, 0.961026847f},
-std::array<float,2>{0.377317458f, 0.0347212479f},
-std::array<float,2>{0.561308682f, 0.207617968f},
-std::array<float,2>{0.271926343f, 0.785378635f},
-std::array<float,2>{0.920538425f, 0.652526796f},
-std::array<float,2>{0.0224899333f, 0.263917208f},
-std::array<float,2>{0.50413245f, 0.279630899f},
-std::array<float,2>{0.311468393f, 0.635849833f},
-std::array<float,2>{0.903339982f, 0.799284279f},
-std::array<float,2>{0.0559136719f, 0.194492623f},
-std::array<float,2>{0.768099785f, 0.0529832467f},
-std::array<float,2>{0.225151956f, 0.944869459f},
-std::array<float,2>{0.723829985f, 0.555654526f},
-std::array<float,2>{0.431563318f, 0.37869969f},
-std::array<float,2>{0.94047749f, 0.468000501f},
-std::array<float,2>{0.0639839545f, 0.624657154f},
-std::array<float,2>{0.580186546f, 0.923446834f},
-std::array<float,2>{0.355433673f, 0.0901482552f},
-std::array<float,2>{0.654047132f, 0.168477044f},
-std::array<float,2>{0.465829015f, 0.814577103f},
-std::array<float,2>{0.829702914f, 0.691366553f},
-std::array<float,2>{0.140429989f, 0.359998435f},
-std::array<float,2>{0.715122938f, 0.409828871f},
-std::array<float,2>{0.400622606f, 0.519923925f},
-std::array<float,2>{0.784232736f, 0.992358208f},
-std::array<float,2>{0.204636455f, 0.0053532524f},
-std::array<float,2>{0.92800498f, 0.231941372f},
-std::array<float,2>{0.00126170553f, 0.752225637f},
-std::array<float,2>{0.53406179f, 0.671526909f},
-std::array<float,2>{0.260361999f, 0.281743318f},
-std::array<float,2>{0.869927704f, 0.326062888f},
-std::array<float,2>{0.178307459f, 0.719909966f},
-std::array<float,2>{0.671068966f, 0.861132324f},
-std::array<float,2>{0.498970717f, 0.155093014f},
-std::array<float,2>{0.599532783f, 0.11809627f},
-std::array<float,2>{0.322622538f, 0.890449464f},
-std::array<float,2>{0.994109631f, 0.566777349f},
-std::array<float,2>{0.113055319f, 0.493608356f},
-std::array<float,2>{0.608430922f, 0.431879103f},
-std::array<float,2>{0.317427367f, 0.502900898f},
-std::array<float,2>{0.99167949f, 0.973081231f},
-std::array<float,2>{0.118328989f, 0.0187915359f},
-std::array<float,2>{0.862772405f, 0.247541115f},
-std::array<float,2>{0.181570143f, 0.774221301f},
-std::array<float,2>{0.661409199f, 0.686674654f},
-std::array<float,2>{0.484397441f, 0.312490731f},
-std::array<float,2>{0.934638739f, 0.343181789f},
-std::array<float,2>{0.0152337393f, 0.745022416f},
-std::array<float,2>{0.545470119f, 0.848585188f},
-std::array<float,2>{0.254955024f, 0.139664114f},
-std::array<float,2>{0.708376944f, 0.10439378f},
-std::array<float,2>{0.396624684f, 0.892972052f},
-std::array<float,2>{0.79199034f, 0.58788991f},
-std::array<float,2>{0.218379438f, 0.475102484f},
-std::array<float,2>{0.645250857f, 0.261047482f},
-std::array<float,2>{0.45348078f, 0.649691463f},
-std::array<float,2>{0.841916025f, 0.784428298f},
-std::array<float,2>{0.12624447f, 0.203252628f},
-std::array<float,2>{0.948519766f, 0.0382962972f},
-std::array<float,2>{0.070596002f, 0.966773748f},
-std::array<float,2>{0.591804266f, 0.534205794f},
-std::array<float,2>{0.348523289f, 0.398640722f},
-std::array<float,2>{0.779014826f, 0.442483723f},
-std::array<float,2>{0.22781533f, 0.596816361f},
-std::array<float,2>{0.727314115f, 0.915824294f},
-std::array<float,2>{0.424110293f, 0.0695343688f},
-std::array<float,2>{0.513523161f, 0.175507367f},
-std::array<float,2>{0.301955819f, 0.834143221f},
-std::array<float,2>{0.892921984f, 0.707192719f},
-std::array<float,2>{0.0473245159f, 0.344227225f},
-std::array<float,2>{0.553734899f, 0.365586609f},
-std::array<float,2>{0.278169096f, 0.693459094f},
-std::array<float,2>{0.907376111f, 0.817385793f},
-std::array<float,2>{0.0275143869f, 0.167027593f},
-std::array<float,2>{0.810331166f, 0.0878569409f},
-std::array<float,2>{0.198162049f, 0.925908864f},
-std::array<float,2>{0.698831558f, 0.619384646f},
-std::array<float,2>{0.384894431f, 0.464187086f},
-std::array<float,2>{0.974285364f, 0.379576325f},
-std::array<float,2>{0.0950536802f, 0.561476648f},
-std::array<float,2>{0.622780085f, 0.940123379f},
-std::array<float,2>{0.330727309f, 0.049428232f},
-std::array<float,2>{0.672005653f, 0.187702343f},
-std::array<float,2>{0.470982045f, 0.80365783f},
-std::array<float,2>{0.856118858f, 0.636918962f},
-std::array<float,2>{0.162958205f, 0.277295589f},
-std::array<float,2>{0.737428784f, 0.496771753f},
-std::array<float,2>{0.411414772f, 0.56633234f},
-std::array<float,2>{0.762885869f, 0.885014594f},
-std::array<float,2>{0.239025578f, 0.121337868f},
-std::array<float,2>{0.887231171f, 0.148989141f},
-std::array<float,2>{0.0445266776f, 0.864555895f},
-std::array<float,2>{0.526180565f, 0.723454893f},
-std::array<float,2>{0.293021113f, 0.324147135f},
-std::array<float,2>{0.825651407f, 0.286151111f},
-std::array<float,2>{0.141935751f, 0.667436421f},
-std::array<float,2>{0.633082986f, 0.755003452f},
-std::array<float,2>{0.441852748f, 0.227043524f},
-std::array<float,2>{0.565225482f, 0.00209113839f},
-std::array<float,2>{0.370856196f, 0.999015033f},
-std::array<float,2>{0.961030006f, 0.517394543f},
-std::array<float,2>{0.088305451f, 0.410388082f},
-std::array<float,2>{0.521216929f, 0.454247475f},
-std::array<float,2>{0.283929914f, 0.612919867f},
-std::array<float,2>{0.87832576f, 0.935193896f},
-std::array<float,2>{0.0367375724f, 0.0814759284f},
-std::array<float,2>{0.751692593f, 0.163791999f},
-std::array<float,2>{0.249102727f, 0.828107059f},
-std::array<float,2>{0.743882716f, 0.701821089f},
-std::array<float,2>{0.420886785f, 0.372255206f},
-std::array<float,2>{0.959848046f, 0.26577577f},
-std::array<float,2>{0.083509922f, 0.629400909f},
-std::array<float,2>{0.573520839f, 0.810951591f},
-std::array<float,2>{0.367059737f, 0.197577834f},
-std::array<float,2>{0.625446141f, 0.061855752f},
-std::array<float,2>{0.447735548f, 0.95152998f},
-std::array<float,2>{0.81823802f, 0.550019205f},
-std::array<float,2>{0.149615288f, 0.38619113f},
-std::array<float,2>{0.689434826f, 0.315066546f},
-std::array<float,2>{0.382784396f, 0.730841994f},
-std::array<float,2>{0.803411663f, 0.871926308f},
-std::array<float,2>{0.190267265f, 0.147883281f},
-std::array<float,2>{0.915942729f, 0.115942001f},
-std::array<float,2>{0.0181675646f, 0.877251506f},
-std::array<float,2>{0.555574417f, 0.575035155f},
-std::array<float,2>{0.265793204f, 0.489847571f},
-std::array<float,2>{0.843914211f, 0.4157525f},
-std::array<float,2>{0.171672121f, 0.53010273f},
-std::array<float,2>{0.682446599f, 0.985714555f},
-std::array<float,2>{0.479352295f, 0.0121356836f},
-std::array<float,2>{0.61354655f, 0.221849889f},
-std::array<float,2>{0.336588264f, 0.75849086f},
-std::array<float,2>{0.979162931f, 0.661520064f},
-std::array<float,2>{0.106227398f, 0.29552871f},
-std::array<float,2>{0.582110226f, 0.298169672f},
-std::array<float,2>{0.355652303f, 0.67828089f},
-std::array<float,2>{0.942526519f, 0.766289711f},
-std::array<float,2>{0.0673665181f, 0.242010981f},
-std::array<float,2>{0.832444727f, 0.0271307062f},
-std::array<float,2>{0.13340582f, 0.981835544f},
-std::array<float,2>{0.649508059f, 0.511493206f},
-std::array<float,2>{0.462852508f, 0.428625703f},
-std::array<float,2>{0.900284827f, 0.482658267f},
-std::array<float,2>{0.0592179894f, 0.583825767f},
-std::array<float,2>{0.502608299f, 0.899135649f},
-std::array<float,2>{0.306960076f, 0.0958558321f},
-std::array<float,2>{0.718781948f, 0.130166247f},
-std::array<float,2>{0.434844166f, 0.853630841f},
-std::array<float,2>{0.773010492f, 0.734973133f},
-std::array<float,2>{0.218954906f, 0.33350119f},
-std::array<float,2>{0.664210021f, 0.397854209f},
-std::array<float,2>{0.493234962f, 0.545617402f},
-std::array<float,2>{0.87132585f, 0.955757678f},
-std::array<float,2>{0.17386198f, 0.0417122394f},
-std::array<float,2>{0.997524261f, 0.214190334f},
-std::array<float,2>{0.114146076f, 0.792611003f},
-std::array<float,2>{0.59378624f, 0.642388642f},
-std::array<float,2>{0.327204973f, 0.252616733f},
-std::array<float,2>{0.788608909f, 0.355190039f},
-std::array<float,2>{0.209219694f, 0.714080691f},
-std::array<float,2>{0.711952448f, 0.839980483f},
-std::array<float,2>{0.403769583f, 0.179857984f},
-std::array<float,2>{0.537572324f, 0.0755114034f},
-std::array<float,2>{0.265615582f, 0.911824226f},
-std::array<float,2>{0.922823966f, 0.602732599f},
-std::array<float,2>{0.00489288988f, 0.449906349f},
-std::array<float,2>{0.511367679f, 0.421720892f},
-std::array<float,2>{0.29749769f, 0.527100861f},
-std::array<float,2>{0.897048771f, 0.989135385f},
-std::array<float,2>{0.0544041917f, 0.00997366663f},
-std::array<float,2>{0.774778128f, 0.223242834f},
-std::array<float,2>{0.232862979f, 0.764033496f},
-std::array<float,2>{0.733146191f, 0.657690108f},
-std::array<float,2>{0.426185906f, 0.289219558f},
-std::array<float,2>{0.952589571f, 0.318182498f},
-std::array<float,2>{0.0755455568f, 0.729688942f},
-std::array<float,2>{0.587615252f, 0.86924541f},
-std::array<float,2>{0.345722884f, 0.144443929f},
-std::array<float,2>{0.643250287f, 0.109825023f},
-std::array<float,2>{0.460669756f, 0.879312754f},
-std::array<float,2>{0.836082935f, 0.574145019f},
-std::array<float,2>{0.13249591f, 0.48643738f},
-std::array<float,2>{0.704228163f, 0.270837039f},
-std::array<float,2>{0.393980652f, 0.62748009f},
-std::array<float,2>{0.79533875f, 0.806428552f},
-std::array<float,2>{0.213776633f, 0.199949667f},
-std::array<float,2>{0.933215797f, 0.0571208447f},
-std::array<float,2>{0.0087374039f, 0.94778204f},
-std::array<float,2>{0.540385485f, 0.552423835f},
-std::array<float,2>{0.251622528f, 0.38812691f},
-std::array<float,2>{0.863488197f, 0.457684606f},
-std::array<float,2>{0.187033013f, 0.614683032f},
-std::array<float,2>{0.6581738f, 0.92981112f},
-std::array<float,2>{0.491364062f, 0.0853001475f},
-std::array<float,2>{0.60427475f, 0.158835545f},
-std::array<float,2>{0.315265924f, 0.822412193f},
-std::array<float,2>{0.985746145f, 0.697030425f},
-std::array<float,2>{0.123075448f, 0.368839771f},
-std::array<float,2>{0.56937921f, 0.355491608f},
-std::array<float,2>{0.37182042f, 0.717541337f},
-std::array<float,2>{0.965875566f, 0.837203085f},
-std::array<float,2>{0.0925176889f, 0.186670974f},
-std::array<float,2>{0.821055532f, 0.0727825463f},
-std::array<float,2>{0.144946411f, 0.907238185f},
-std::array<float,2>{0.640538096f, 0.607901633f},
-std::array<float,2>{0.440118819f, 0.446246922f},
-std::array<float,2>{0.885548711f, 0.391627908f},
-std::array<float,2>{0.0415699892f, 0.542638421f},
-std::array<float,2>{0.527870476f, 0.960505188f},
-std::array<float,2>{0.29277876f, 0.0442381911f},
-std::array<float,2>{0.74005729f, 0.218228683f},
-std::array<float,2>{0.407176942f, 0.796764195f},
-std::array<float,2>{0.760732234f, 0.647367358f},
-std::array<float,2>{0.237371966f, 0.255813062f},
-std::array<float,2>{0.676618338f, 0.476913929f},
-std::array<float,2>{0.472702831f, 0.578594983f},
-std::array<float,2>{0.854811847f, 0.903777957f},
-std::array<float,2>{0.159214422f, 0.100846291f},
-std::array<float,2>{0.971672356f, 0.127657086f},
-std::array<float,2>{0.0977331325f, 0.858518958f},
-std::array<float,2>{0.618409753f, 0.738500893f},
-std::array<float,2>{0.335415781f, 0.330524802f},
-std::array<float,2>{0.805786133f, 0.304200262f},
-std::array<float,2>{0.201139808f, 0.673055947f},
-std::array<float,2>{0.700206935f, 0.771269858f},
-std::array<float,2>{0.387360722f, 0.235865027f},
-std::array<float,2>{0.550311089f, 0.0301753245f},
-std::array<float,2>{0.275343299f, 0.976695955f},
-std::array<float,2>{0.912471771f, 0.511902869f},
-std::array<float,2>{0.0236293543f, 0.423997402f},
-std::array<float,2>{0.611617565f, 0.438366175f},
-std::array<float,2>{0.342180967f, 0.600432158f},
-std::array<float,2>{0.982493222f, 0.921662927f},
-std::array<float,2>{0.10292121f, 0.0653907135f},
-std::array<float,2>{0.849832654f, 0.177848563f},
-std::array<float,2>{0.166882262f, 0.831851661f},
-std::array<float,2>{0.683841228f, 0.704167306f},
-std::array<float,2>{0.48297134f, 0.349912703f},
-std::array<float,2>{0.919443369f, 0.263375252f},
-std::array<float,2>{0.0212857611f, 0.656236231f},
-std::array<float,2>{0.560302675f, 0.787297726f},
-std::array<float,2>{0.270925373f, 0.210371703f},
-std::array<float,2>{0.695224583f, 0.0317279063f},
-std::array<float,2>{0.376746118f, 0.962940395f},
-std::array<float,2>{0.800287843f, 0.535923719f},
-std::array<float,2>{0.191799074f, 0.406152844f},
-std::array<float,2>{0.628932059f, 0.338948727f},
-std::array<float,2>{0.450746566f, 0.749430418f},
-std::array<float,2>{0.814450026f, 0.84544915f},
-std::array<float,2>{0.155584767f, 0.134255677f},
-std::array<float,2>{0.954217494f, 0.109211713f},
-std::array<float,2>{0.0799312666f, 0.896633625f},
-std::array<float,2>{0.577796161f, 0.591707706f},
-std::array<float,2>{0.362386763f, 0.472541869f},
-std::array<float,2>{0.754823864f, 0.433968127f},
-std::array<float,2>{0.245274171f, 0.507541239f},
-std::array<float,2>{0.747334719f, 0.972140074f},
-std::array<float,2>{0.417584985f, 0.0196820516f},
-std::array<float,2>{0.516270697f, 0.244045109f},
-std::array<float,2>{0.285435438f, 0.777996302f},
-std::array<float,2>{0.881037831f, 0.679776549f},
-std::array<float,2>{0.0350283571f, 0.305784762f},
-std::array<float,2>{0.531277001f, 0.283636332f},
-std::array<float,2>{0.258923352f, 0.669501364f},
-std::array<float,2>{0.925921619f, 0.751759529f},
-std::array<float,2>{0.0029741053f, 0.234046206f},
-std::array<float,2>{0.781577587f, 0.00673939334f},
-std::array<float,2>{0.206045344f, 0.994574785f},
-std::array<float,2>{0.717799962f, 0.522408247f},
-std::array<float,2>{0.399624139f, 0.406983495f},
-std::array<float,2>{0.994621336f, 0.494912714f},
-std::array<float,2>{0.110939793f, 0.568557262f},
-std::array<float,2>{0.600889266f, 0.888585925f},
-std::array<float,2>{0.321857601f, 0.12065918f},
-std::array<float,2>{0.66873318f, 0.154149801f},
-std::array<float,2>{0.496533453f, 0.861900926f},
-std::array<float,2>{0.867924273f, 0.721249044f},
-std::array<float,2>{0.176942453f, 0.327106148f},
-std::array<float,2>{0.72472775f, 0.376255274f},
-std::array<float,2>{0.432922244f, 0.558178902f},
-std::array<float,2>{0.767210424f, 0.941625237f},
-std::array<float,2>{0.22271888f, 0.0513523929f},
-std::array<float,2>{0.9060148f, 0.191665709f},
-std::array<float,2>{0.0575055219f, 0.796879232f},
-std::array<float,2>{0.506589115f, 0.634198785f},
-std::array<float,2>{0.309755296f, 0.278568596f},
-std::array<float,2>{0.83133775f, 0.362451971f},
-std::array<float,2>{0.137718037f, 0.688421965f},
-std::array<float,2>{0.655395627f, 0.812908769f},
-std::array<float,2>{0.4671067f, 0.17077978f},
-std::array<float,2>{0.579704821f, 0.091917336f},
-std::array<float,2>{0.352426201f, 0.924298048f},
-std::array<float,2>{0.937937319f, 0.621721804f},
-std::array<float,2>{0.0656889752f, 0.465789974f},
-std::array<float,2>{0.591242135f, 0.401977986f},
-std::array<float,2>{0.350047022f, 0.531524718f},
-std::array<float,2>{0.947256029f, 0.968590081f},
-std::array<float,2>{0.0722726583f, 0.0361549817f},
-std::array<float,2>{0.8409307f, 0.205774099f},
-std::array<float,2>{0.127865016f, 0.782171726f},
-std::array<float,2>{0.647520185f, 0.651740313f},
-std::array<float,2>{0.455964327f, 0.259353638f},
-std::array<float,2>{0.891395688f, 0.347379535f},
-std::array<float,2>{0.0496100597f, 0.7091223f},
-std::array<float,2>{0.514050841f, 0.832318664f},
-std::array<float,2>{0.304546654f, 0.172159091f},
-std::array<float,2>{0.728978932f, 0.0674379915f},
-std::array<float,2>{0.422821164f, 0.91762954f},
-std::array<float,2>{0.780960798f, 0.595584452f},
-std::array<float,2>{0.229905814f, 0.444688648f},
-std::array<float,2>{0.662210822f, 0.309713483f},
-std::array<float,2>{0.487436354f, 0.684510469f},
-std::array<float,2>{0.860171318f, 0.775551736f},
-std::array<float,2>{0.181855753f, 0.249722272f},
-std::array<float,2>{0.989755511f, 0.0165996421f},
-std::array<float,2>{0.119916797f, 0.97583884f},
-std::array<float,2>{0.605508804f, 0.500035703f},
-std::array<float,2>{0.319195211f, 0.431282818f},
-std::array<float,2>{0.790492058f, 0.473167121f},
-std::array<float,2>{0.216096491f, 0.588540912f},
-std::array<float,2>{0.709468067f, 0.890710294f},
-std::array<float,2>{0.395406127f, 0.102253757f},
-std::array<float,2>{0.543972194f, 0.137071118f},
-std::array<float,2>{0.257362902f, 0.850690365f},
-std::array<float,2>{0.937150061f, 0.742464721f},
-std::array<float,2>{0.0124598453f, 0.341655761f},
-std::array<float,2>{0.524651647f, 0.322066158f},
-std::array<float,2>{0.295994848f, 0.725327015f},
-std::array<float,2>{0.889875829f, 0.866061926f},
-std::array<float,2>{0.0457619689f, 0.150502548f},
-std::array<float,2>{0.764300108f, 0.124502942f},
-std::array<float,2>{0.241298407f, 0.884267867f},
-std::array<float,2>{0.735947549f, 0.563672841f},
-std::array<float,2>{0.413548619f, 0.499289155f},
-std::array<float,2>{0.963364601f, 0.413799018f},
-std::array<float,2>{0.0860278979f, 0.519331694f},
-std::array<float,2>{0.562605619f, 0.997651339f},
-std::array<float,2>{0.368658394f, 0.00121076254f},
-std::array<float,2>{0.635929048f, 0.229440287f},
-std::array<float,2>{0.445282936f, 0.757163465f},
-std::array<float,2>{0.827135086f, 0.665043414f},
-std::array<float,2>{0.144511089f, 0.287725121f},
-std::array<float,2>{0.696959436f, 0.461196601f},
-std::array<float,2>{0.383584768f, 0.617282927f},
-std::array<float,2>{0.812231243f, 0.928406537f},
-std::array<float,2>{0.195906729f, 0.0895404443f},
-std::array<float,2>{0.909782648f, 0.165102571f},
-std::array<float,2>{0.0305187106f, 0.819185317f},
-std::array<float,2>{0.550811052f, 0.692704439f},
-std::array<float,2>{0.280070841f, 0.364978552f},
-std::array<float,2>{0.858820617f, 0.274241537f},
-std::array<float,2>{0.161367655f, 0.639145255f},
-std::array<float,2>{0.67533195f, 0.802481115f},
-std::array<float,2>{0.469797075f, 0.191128567f},
-std::array<float,2>{0.62423116f, 0.0479409546f},
-std::array<float,2>{0.328291059f, 0.938286304f},
-std::array<float,2>{0.975027502f, 0.558977664f},
-std::array<float,2>{0.0957864001f, 0.381450921f},
-std::array<float,2>{0.556822419f, 0.490440667f},
-std::array<float,2>{0.269100726f, 0.577231467f},
-std::array<float,2>{0.917124033f, 0.87619102f},
-std::array<float,2>{0.0168706719f, 0.114358559f},
-std::array<float,2>{0.801584244f, 0.1464376f},
-std::array<float,2>{0.188371554f, 0.873582184f},
-std::array<float,2>{0.68950069f, 0.733732581f},
-std::array<float,2>{0.380497664f, 0.313447893f},
-std::array<float,2>{0.977909207f, 0.293599159f},
-std::array<float,2>{0.107427575f, 0.663390458f},
-std::array<float,2>{0.615404844f, 0.760111094f},
-std::array<float,2>{0.337929964f, 0.219111398f},
-std::array<float,2>{0.680414259f, 0.0148209622f},
-std::array<float,2>{0.478378981f, 0.986492932f},
-std::array<float,2>{0.847431958f, 0.527723253f},
-std::array<float,2>{0.1692826f, 0.417898834f},
-std::array<float,2>{0.745589256f, 0.373307884f},
-std::array<float,2>{0.417984098f, 0.700875103f},
-std::array<float,2>{0.752212942f, 0.825731039f},
-std::array<float,2>{0.246566907f, 0.162059292f},
-std::array<float,2>{0.876422346f, 0.0799650401f},
-std::array<float,2>{0.0385022387f, 0.936552763f},
-std::array<float,2>{0.523017764f, 0.61102891f},
-std::array<float,2>{0.282058984f, 0.455508143f},
-std::array<float,2>{0.820151031f, 0.383407354f},
-std::array<float,2>{0.151658595f, 0.548636913f},
-std::array<float,2>{0.627248764f, 0.94952786f},
-std::array<float,2>{0.446253031f, 0.0590632372f},
-std::array<float,2>{0.57204318f, 0.195378795f},
-std::array<float,2>{0.364974111f, 0.81025821f},
-std::array<float,2>{0.958513319f, 0.631179333f},
-std::array<float,2>{0.0856628045f, 0.26950857f},
-std::array<float,2>{0.596509457f, 0.251612514f},
-std::array<float,2>{0.326149464f, 0.643407285f},
-std::array<float,2>{0.999860764f, 0.789075255f},
-std::array<float,2>{0.11600332f, 0.211298585f},
-std::array<float,2>{0.873126745f, 0.0390660278f},
-std::array<float,2>{0.172438607f, 0.95413655f},
-std::array<float,2>{0.666025519f, 0.543975711f},
-std::array<float,2>{0.494879007f, 0.395432442f},
-std::array<float,2>{0.923995197f, 0.452201992f},
-std::array<float,2>{0.00706794905f, 0.605327547f},
-std::array<float,2>{0.535939872f, 0.912920773f},
-std::array<float,2>{0.262161016f, 0.0765241832f},
-std::array<float,2>{0.714127183f, 0.183410987f},
-std::array<float,2>{0.405306578f, 0.843417108f},
-std::array<float,2>{0.78572917f, 0.711148024f},
-std::array<float,2>{0.207375973f, 0.352610469f},
-std::array<float,2>{0.650841236f, 0.427003831f},
-std::array<float,2>{0.464685053f, 0.507873714f},
-std::array<float,2>{0.834690332f, 0.982453942f},
-std::array<float,2>{0.136305556f, 0.0247306433f},
-std::array<float,2>{0.943620682f, 0.239368707f},
-std::array<float,2>{0.069353275f, 0.768205523f},
-std::array<float,2>{0.585183144f, 0.676141977f},
-std::array<float,2>{0.358469367f, 0.300128698f},
-std::array<float,2>{0.769583642f, 0.335776836f},
-std::array<float,2>{0.222475529f, 0.737402022f},
-std::array<float,2>{0.72265178f, 0.852589607f},
-std::array<float,2>{0.435637474f, 0.132106513f},
-std::array<float,2>{0.501691103f, 0.0951615572f},
-std::array<float,2>{0.30648917f, 0.901583314f},
-std::array<float,2>{0.901359916f, 0.584372759f},
-std::array<float,2>{0.0613924973f, 0.481653899f},
-std::array<float,2>{0.547290206f, 0.425361603f},
-std::array<float,2>{0.275446445f, 0.513296187f},
-std::array<float,2>{0.911165297f, 0.978437722f},
-std::array<float,2>{0.0255365297f, 0.0312358588f},
-std::array<float,2>{0.808493674f, 0.234489158f},
-std::array<float,2>{0.201996341f, 0.770276487f},
-std::array<float,2>{0.703053355f, 0.672489941f},
-std::array<float,2>{0.389605612f, 0.303125381f},
-std::array<float,2>{0.969813704f, 0.331129044f},
-std::array<float,2>{0.100392394f, 0.740065753f},
-std::array<float,2>{0.620706081f, 0.857484102f},
-std::array<float,2>{0.332654893f, 0.128311679f},
-std::array<float,2>{0.679486632f, 0.0998370796f},
-std::array<float,2>{0.475141913f, 0.903218448f},
-std::array<float,2>{0.852740765f, 0.579221547f},
-std::array<float,2>{0.157946855f, 0.478049338f},
-std::array<float,2>{0.741024733f, 0.254047275f},
-std::array<float,2>{0.409434766f, 0.647663534f},
-std::array<float,2>{0.758393526f, 0.795792401f},
-std::array<float,2>{0.234427288f, 0.217716143f},
-std::array<float,2>{0.883489609f, 0.0435261913f},
-std::array<float,2>{0.0402097665f, 0.959160209f},
-std::array<float,2>{0.529772818f, 0.541903615f},
-std::array<float,2>{0.289856941f, 0.391524881f},
-std::array<float,2>{0.823520899f, 0.446804971f},
-std::array<float,2>{0.148192853f, 0.608907878f},
-std::array<float,2>{0.638044f, 0.906863689f},
-std::array<float,2>{0.439206004f, 0.0740547851f},
-std::array<float,2>{0.568075001f, 0.185862303f},
-std::array<float,2>{0.374957711f, 0.836826205f},
-std::array<float,2>{0.967092216f, 0.718459487f},
-std::array<float,2>{0.090063706f, 0.357033432f},
-std::array<float,2>{0.602395654f, 0.368037879f},
-std::array<float,2>{0.314341068f, 0.696275771f},
-std::array<float,2>{0.986626863f, 0.823987961f},
-std::array<float,2>{0.122896776f, 0.159283161f},
-std::array<float,2>{0.865415156f, 0.084831588f},
-std::array<float,2>{0.183652565f, 0.931203306f},
-std::array<float,2>{0.658860505f, 0.61362803f},
-std::array<float,2>{0.488853991f, 0.458282053f},
-std::array<float,2>{0.930615902f, 0.386805236f},
-std::array<float,2>{0.0102639683f, 0.550899684f},
-std::array<float,2>{0.541050494f, 0.949132562f},
-std::array<float,2>{0.253109664f, 0.0577748157f},
-std::array<float,2>{0.706104994f, 0.200774848f},
-std::array<float,2>{0.39199695f, 0.804754019f},
-std::array<float,2>{0.794806063f, 0.628633499f},
-std::array<float,2>{0.211438805f, 0.269714743f},
-std::array<float,2>{0.641832769f, 0.48740074f},
-std::array<float,2>{0.457770348f, 0.572985947f},
-std::array<float,2>{0.839007735f, 0.880528212f},
-std::array<float,2>{0.130094409f, 0.111196987f},
-std::array<float,2>{0.95034802f, 0.14266479f},
-std::array<float,2>{0.0766518041f, 0.87082392f},
-std::array<float,2>{0.589733064f, 0.72931546f},
-std::array<float,2>{0.343769729f, 0.316438168f},
-std::array<float,2>{0.776248276f, 0.290962398f},
-std::array<float,2>{0.231255516f, 0.656925857f},
-std::array<float,2>{0.731375039f, 0.76510787f},
-std::array<float,2>{0.429517776f, 0.224293172f},
-std::array<float,2>{0.507882178f, 0.0112201264f},
-std::array<float,2>{0.299428314f, 0.989364028f},
-std::array<float,2>{0.896001101f, 0.525416195f},
-std::array<float,2>{0.0517990999f, 0.420541853f},
-std::array<float,2>{0.582021415f, 0.465980738f},
-std::array<float,2>{0.353518337f, 0.622880936f},
-std::array<float,2>{0.940401614f, 0.925761819f},
-std::array<float,2>{0.0630854666f, 0.0937281102f},
-std::array<float,2>{0.828769624f, 0.171754092f},
-std::array<float,2>{0.139278442f, 0.814346969f},
-std::array<float,2>{0.652887225f, 0.689128458f},
-std::array<float,2>{0.465327054f, 0.362022132f},
-std::array<float,2>{0.902976096f, 0.277754337f},
-std::array<float,2>{0.0553112552f, 0.633611143f},
-std::array<float,2>{0.505165696f, 0.798395693f},
-std::array<float,2>{0.311533064f, 0.193091497f},
-std::array<float,2>{0.722721219f, 0.0519959256f},
-std::array<float,2>{0.430299878f, 0.942490995f},
-std::array<float,2>{0.76942277f, 0.556770146f},
-std::array<float,2>{0.226513326f, 0.375830054f},
-std::array<float,2>{0.670441985f, 0.327982694f},
-std::array<float,2>{0.499553293f, 0.721948683f},
-std::array<float,2>{0.87027663f, 0.862520695f},
-std::array<float,2>{0.178857863f, 0.152938172f},
-std::array<float,2>{0.993074298f, 0.119864762f},
-std::array<float,2>{0.111656912f, 0.88752985f},
-std::array<float,2>{0.598051429f, 0.569630265f},
-std::array<float,2>{0.323489398f, 0.495284528f},
-std::array<float,2>{0.78413552f, 0.407887846f},
-std::array<float,2>{0.204063594f, 0.523021042f},
-std::array<float,2>{0.716356039f, 0.995229185f},
-std::array<float,2>{0.401865363f, 0.0071120318f},
-std::array<float,2>{0.535146177f, 0.232545719f},
-std::array<float,2>{0.260928571f, 0.750743568f},
-std::array<float,2>{0.929602563f, 0.66893816f},
-std::array<float,2>{0.000837044325f, 0.284320325f},
-std::array<float,2>{0.517781138f, 0.305279344f},
-std::array<float,2>{0.287147522f, 0.680821359f},
-std::array<float,2>{0.879998028f, 0.778661489f},
-std::array<float,2>{0.0328319296f, 0.242536992f},
-std::array<float,2>{0.756972134f, 0.0207510926f},
-std::array<float,2>{0.242711559f, 0.970752239f},
-std::array<float,2>{0.749469519f, 0.506071687f},
-std::array<float,2>{0.414625704f, 0.435002953f},
-std::array<float,2>{0.955969751f, 0.471354008f},
-std::array<float,2>{0.0803222507f, 0.590561211f},
-std::array<float,2>{0.574932754f, 0.898126483f},
-std::array<float,2>{0.35956192f, 0.107627191f},
-std::array<float,2>{0.632165611f, 0.133195728f},
-std::array<float,2>{0.451185018f, 0.844513953f},
-std::array<float,2>{0.815663636f, 0.748082161f},
-std::array<float,2>{0.153914198f, 0.338410556f},
-std::array<float,2>{0.692387402f, 0.404934436f},
-std::array<float,2>{0.378339529f, 0.536694586f},
-std::array<float,2>{0.797979772f, 0.964500785f},
-std::array<float,2>{0.194036216f, 0.0331596285f},
-std::array<float,2>{0.921526492f, 0.209475115f},
-std::array<float,2>{0.0220829695f, 0.788300395f},
-std::array<float,2>{0.561738849f, 0.654708326f},
-std::array<float,2>{0.272548258f, 0.262605309f},
-std::array<float,2>{0.847722232f, 0.350684047f},
-std::array<float,2>{0.164265871f, 0.703641295f},
-std::array<float,2>{0.685664356f, 0.830805957f},
-std::array<float,2>{0.480745345f, 0.179208562f},
-std::array<float,2>{0.611198545f, 0.0658346117f},
-std::array<float,2>{0.340172231f, 0.920168519f},
-std::array<float,2>{0.981429458f, 0.600627363f},
-std::array<float,2>{0.104557425f, 0.439413518f},
-std::array<float,2>{0.62155658f, 0.38217935f},
-std::array<float,2>{0.331779063f, 0.559895456f},
-std::array<float,2>{0.973141134f, 0.93850559f},
-std::array<float,2>{0.0947115496f, 0.0471940413f},
-std::array<float,2>{0.856925249f, 0.190113574f},
-std::array<float,2>{0.163173884f, 0.801640332f},
-std::array<float,2>{0.673501372f, 0.639920533f},
-std::array<float,2>{0.472571522f, 0.275257647f},
-std::array<float,2>{0.907082081f, 0.36419934f},
-std::array<float,2>{0.0288873073f, 0.691680849f},
-std::array<float,2>{0.55357182f, 0.819656372f},
-std::array<float,2>{0.278642088f, 0.164960474f},
-std::array<float,2>{0.697823346f, 0.088118054f},
-std::array<float,2>{0.386295199f, 0.92956239f},
-std::array<float,2>{0.809511662f, 0.619107604f},
-std::array<float,2>{0.198555335f, 0.462372452f},
-std::array<float,2>{0.634010911f, 0.28820771f},
-std::array<float,2>{0.442687988f, 0.66428113f},
-std::array<float,2>{0.824926972f, 0.756113946f},
-std::array<float,2>{0.141600758f, 0.230299085f},
-std::array<float,2>{0.962287843f, 0.000374021154f},
-std::array<float,2>{0.089650251f, 0.996836007f},
-std::array<float,2>{0.565970957f, 0.517614186f},
-std::array<float,2>{0.369837821f, 0.412547022f},
-std::array<float,2>{0.762659252f, 0.498601973f},
-std::array<float,2>{0.239377111f, 0.563427627f},
-std::array<float,2>{0.736608028f, 0.883637667f},
-std::array<float,2>{0.41019091f, 0.123467617f},
-std::array<float,2>{0.526734412f, 0.151883468f},
-std::array<float,2>{0.294252574f, 0.866651118f},
-std::array<float,2>{0.888229728f, 0.72648406f},
-std::array<float,2>{0.0438717082f, 0.320922554f},
-std::array<float,2>{0.545924902f, 0.3404724f},
-std::array<float,2>{0.254267275f, 0.743286252f},
-std::array<float,2>{0.934386969f, 0.85024178f},
-std::array<float,2>{0.0140888132f, 0.138036847f},
-std::array<float,2>{0.792553782f, 0.102958195f},
-std::array<float,2>{0.217502713f, 0.892265797f},
-std::array<float,2>{0.707954884f, 0.589484274f},
-std::array<float,2>{0.398406655f, 0.473963916f},
-std::array<float,2>{0.990874469f, 0.429805368f},
-std::array<float,2>{0.117363147f, 0.50189805f},
-std::array<float,2>{0.608103156f, 0.975399673f},
-std::array<float,2>{0.316721767f, 0.017477233f},
-std::array<float,2>{0.661112964f, 0.248942748f},
-std::array<float,2>{0.486234933f, 0.777074695f},
-std::array<float,2>{0.8617571f, 0.68473047f},
-std::array<float,2>{0.180610627f, 0.30865106f},
-std::array<float,2>{0.727788448f, 0.443558961f},
-std::array<float,2>{0.425623715f, 0.593766153f},
-std::array<float,2>{0.777976751f, 0.916327596f},
-std::array<float,2>{0.227189258f, 0.0671115443f},
-std::array<float,2>{0.894142628f, 0.173200056f},
-std::array<float,2>{0.0480571426f, 0.833495677f},
-std::array<float,2>{0.512220979f, 0.710330963f},
-std::array<float,2>{0.301330894f, 0.346191376f},
-std::array<float,2>{0.843062162f, 0.25849244f},
-std::array<float,2>{0.125242725f, 0.650621951f},
-std::array<float,2>{0.645903826f, 0.782999396f},
-std::array<float,2>{0.454504937f, 0.206106335f},
-std::array<float,2>{0.592876792f, 0.0354678221f},
-std::array<float,2>{0.349097848f, 0.967099726f},
-std::array<float,2>{0.947823763f, 0.533133209f},
-std::array<float,2>{0.0713000149f, 0.400858253f},
-std::array<float,2>{0.503364623f, 0.480866611f},
-std::array<float,2>{0.308021843f, 0.585046291f},
-std::array<float,2>{0.899028659f, 0.900967896f},
-std::array<float,2>{0.0604016259f, 0.0945518091f},
-std::array<float,2>{0.772231698f, 0.131172612f},
-std::array<float,2>{0.219982326f, 0.851753891f},
-std::array<float,2>{0.720361352f, 0.737207174f},
-std::array<float,2>{0.434555143f, 0.334131122f},
-std::array<float,2>{0.942053139f, 0.298840821f},
-std::array<float,2>{0.0678380951f, 0.676999569f},
-std::array<float,2>{0.58370471f, 0.768866122f},
-std::array<float,2>{0.356824458f, 0.23922959f},
-std::array<float,2>{0.648975492f, 0.0243622977f},
-std::array<float,2>{0.461184412f, 0.984249651f},
-std::array<float,2>{0.833507359f, 0.508909941f},
-std::array<float,2>{0.134637386f, 0.426371694f},
-std::array<float,2>{0.710939467f, 0.352062702f},
-std::array<float,2>{0.403318614f, 0.712090194f},
-std::array<float,2>{0.787891567f, 0.842607796f},
-std::array<float,2>{0.210395202f, 0.182424113f},
-std::array<float,2>{0.923186421f, 0.0779405162f},
-std::array<float,2>{0.00428065332f, 0.913299143f},
-std::array<float,2>{0.539041877f, 0.60379523f},
-std::array<float,2>{0.263868719f, 0.451624751f},
-std::array<float,2>{0.872517645f, 0.395526111f},
-std::array<float,2>{0.175092116f, 0.543350518f},
-std::array<float,2>{0.665913761f, 0.95316875f},
-std::array<float,2>{0.492435992f, 0.0407142006f},
-std::array<float,2>{0.595372915f, 0.212288097f},
-std::array<float,2>{0.326755106f, 0.790410161f},
-std::array<float,2>{0.996463716f, 0.644350111f},
-std::array<float,2>{0.114993975f, 0.25069651f},
-std::array<float,2>{0.573022842f, 0.268281281f},
-std::array<float,2>{0.365595043f, 0.632015109f},
-std::array<float,2>{0.960605443f, 0.809319854f},
-std::array<float,2>{0.0821304172f, 0.196768194f},
-std::array<float,2>{0.817249835f, 0.0603314266f},
-std::array<float,2>{0.148676977f, 0.950608313f},
-std::array<float,2>{0.626019299f, 0.547268748f},
-std::array<float,2>{0.449177027f, 0.384361506f},
-std::array<float,2>{0.877609253f, 0.456448048f},
-std::array<float,2>{0.0360222459f, 0.610267997f},
-std::array<float,2>{0.519735157f, 0.935822189f},
-std::array<float,2>{0.284570724f, 0.078545779f},
-std::array<float,2>{0.742516696f, 0.160596684f},
-std::array<float,2>{0.42112416f, 0.824372649f},
-std::array<float,2>{0.750169992f, 0.699875116f},
-std::array<float,2>{0.248134732f, 0.374233752f},
-std::array<float,2>{0.683061957f, 0.416169971f},
-std::array<float,2>{0.479549795f, 0.529258847f},
-std::array<float,2>{0.844970107f, 0.987339377f},
-std::array<float,2>{0.170336068f, 0.0142750032f},
-std::array<float,2>{0.979652286f, 0.22001265f},
-std::array<float,2>{0.106958725f, 0.760832012f},
-std::array<float,2>{0.614682198f, 0.66247052f},
-std::array<float,2>{0.337864846f, 0.294826418f},
-std::array<float,2>{0.804164946f, 0.314174443f},
-std::array<float,2>{0.191149697f, 0.732640266f},
-std::array<float,2>{0.688111961f, 0.874752998f},
-std::array<float,2>{0.380969226f, 0.144942358f},
-std::array<float,2>{0.556389153f, 0.113828912f},
-std::array<float,2>{0.267082155f, 0.875625968f},
-std::array<float,2>{0.914376497f, 0.576429009f},
-std::array<float,2>{0.019230295f, 0.491310984f},
-std::array<float,2>{0.529221892f, 0.393330216f},
-std::array<float,2>{0.291520536f, 0.539996147f},
-std::array<float,2>{0.885817468f, 0.957177043f},
-std::array<float,2>{0.0423771702f, 0.0464755781f},
-std::array<float,2>{0.761372745f, 0.216044769f},
-std::array<float,2>{0.237079024f, 0.79478246f},
-std::array<float,2>{0.739167333f, 0.645318389f},
-std::array<float,2>{0.407560736f, 0.25725916f},
-std::array<float,2>{0.965533495f, 0.359287411f},
-std::array<float,2>{0.0928281322f, 0.71560055f},
-std::array<float,2>{0.568493903f, 0.839379609f},
-std::array<float,2>{0.372588217f, 0.184432968f},
-std::array<float,2>{0.639527023f, 0.0716298074f},
-std::array<float,2>{0.440610588f, 0.908845782f},
-std::array<float,2>{0.82156086f, 0.605641186f},
-std::array<float,2>{0.146171451f, 0.448321432f},
-std::array<float,2>{0.700141072f, 0.301551312f},
-std::array<float,2>{0.388632983f, 0.673957944f},
-std::array<float,2>{0.805230916f, 0.773349345f},
-std::array<float,2>{0.199572653f, 0.238000527f},
-std::array<float,2>{0.913590789f, 0.0286702383f},
-std::array<float,2>{0.0249424577f, 0.978812099f},
-std::array<float,2>{0.549636424f, 0.514299214f},
-std::array<float,2>{0.273577094f, 0.422261655f},
-std::array<float,2>{0.854242504f, 0.479743809f},
-std::array<float,2>{0.159044892f, 0.580611229f},
-std::array<float,2>{0.67773062f, 0.905035555f},
-std::array<float,2>{0.474560857f, 0.0988311619f},
-std::array<float,2>{0.617551208f, 0.126818925f},
-std::array<float,2>{0.334330887f, 0.857002378f},
-std::array<float,2>{0.972126245f, 0.740680456f},
-std::array<float,2>{0.0986787081f, 0.329954296f},
-std::array<float,2>{0.585970163f, 0.318751097f},
-std::array<float,2>{0.347447008f, 0.728427768f},
-std::array<float,2>{0.951450646f, 0.867864668f},
-std::array<float,2>{0.0743280947f, 0.1414029f},
-std::array<float,2>{0.837538838f, 0.112961985f},
-std::array<float,2>{0.130964607f, 0.882474661f},
-std::array<float,2>{0.644524515f, 0.571402133f},
-std::array<float,2>{0.459635556f, 0.485855997f},
-std::array<float,2>{0.89831835f, 0.418191224f},
-std::array<float,2>{0.0532478169f, 0.52428925f},
-std::array<float,2>{0.510077119f, 0.990575016f},
-std::array<float,2>{0.298745275f, 0.00895710476f},
-std::array<float,2>{0.734002113f, 0.226401895f},
-std::array<float,2>{0.427358031f, 0.762900889f},
-std::array<float,2>{0.774248302f, 0.659562469f},
-std::array<float,2>{0.233404845f, 0.291717976f},
-std::array<float,2>{0.656797349f, 0.460288197f},
-std::array<float,2>{0.491101861f, 0.61531651f},
-std::array<float,2>{0.864891171f, 0.932954431f},
-std::array<float,2>{0.186395034f, 0.0832224786f},
-std::array<float,2>{0.985295117f, 0.157734647f},
-std::array<float,2>{0.124072693f, 0.821542442f},
-std::array<float,2>{0.605276048f, 0.698927045f},
-std::array<float,2>{0.315475047f, 0.369781613f},
-std::array<float,2>{0.79662776f, 0.271555603f},
-std::array<float,2>{0.214691281f, 0.625470638f},
-std::array<float,2>{0.703403533f, 0.807515144f},
-std::array<float,2>{0.393049717f, 0.202340499f},
-std::array<float,2>{0.539628923f, 0.0565011911f},
-std::array<float,2>{0.250470608f, 0.945914328f},
-std::array<float,2>{0.931805611f, 0.553390086f},
-std::array<float,2>{0.00896776933f, 0.389573067f},
-std::array<float,2>{0.599818587f, 0.492954254f},
-std::array<float,2>{0.320475459f, 0.56796968f},
-std::array<float,2>{0.996006668f, 0.888872385f},
-std::array<float,2>{0.109759927f, 0.119082175f},
-std::array<float,2>{0.86822927f, 0.155585125f},
-std::array<float,2>{0.176168084f, 0.859550297f},
-std::array<float,2>{0.669567883f, 0.719502211f},
-std::array<float,2>{0.497092903f, 0.324417263f},
-std::array<float,2>{0.927326083f, 0.282471538f},
-std::array<float,2>{0.00269902707f, 0.670089424f},
-std::array<float,2>{0.532558024f, 0.753897667f},
-std::array<float,2>{0.258633614f, 0.230849579f},
-std::array<float,2>{0.717712879f, 0.00412941631f},
-std::array<float,2>{0.3991431f, 0.994006693f},
-std::array<float,2>{0.782233894f, 0.521069646f},
-std::array<float,2>{0.206648454f, 0.408422112f},
-std::array<float,2>{0.654701889f, 0.36066708f},
-std::array<float,2>{0.468425333f, 0.690280497f},
-std::array<float,2>{0.830457866f, 0.815600038f},
-std::array<float,2>{0.136782929f, 0.169649184f},
-std::array<float,2>{0.939223468f, 0.0916427299f},
-std::array<float,2>{0.0652973726f, 0.922832489f},
-std::array<float,2>{0.578220546f, 0.623713672f},
-std::array<float,2>{0.353015661f, 0.466982216f},
-std::array<float,2>{0.765690923f, 0.377791047f},
-std::array<float,2>{0.224154308f, 0.556274772f},
-std::array<float,2>{0.726352334f, 0.943596303f},
-std::array<float,2>{0.432075888f, 0.0546682663f},
-std::array<float,2>{0.507471681f, 0.194257751f},
-std::array<float,2>{0.309257507f, 0.799822211f},
-std::array<float,2>{0.904645443f, 0.63518846f},
-std::array<float,2>{0.0577430651f, 0.280687183f},
-std::array<float,2>{0.559096634f, 0.265156895f},
-std::array<float,2>{0.269955158f, 0.653466225f},
-std::array<float,2>{0.918361783f, 0.78621453f},
-std::array<float,2>{0.0196832661f, 0.208117902f},
-std::array<float,2>{0.798901796f, 0.033717148f},
-std::array<float,2>{0.192489579f, 0.962828577f},
-std::array<float,2>{0.693664312f, 0.537871778f},
-std::array<float,2>{0.375857651f, 0.402692735f},
-std::array<float,2>{0.983793557f, 0.439626575f},
-std::array<float,2>{0.102139041f, 0.599022746f},
-std::array<float,2>{0.612422824f, 0.91835463f},
-std::array<float,2>{0.343564481f, 0.0641825199f},
-std::array<float,2>{0.68513447f, 0.17758207f},
-std::array<float,2>{0.48369503f, 0.82984525f},
-std::array<float,2>{0.850876629f, 0.70522058f},
-std::array<float,2>{0.16716297f, 0.348787189f},
-std::array<float,2>{0.747031808f, 0.43665421f},
-std::array<float,2>{0.416857481f, 0.504035592f},
-std::array<float,2>{0.755248249f, 0.969274402f},
-std::array<float,2>{0.244161278f, 0.0229679476f},
-std::array<float,2>{0.882279694f, 0.245215833f},
-std::array<float,2>{0.0334630199f, 0.78086549f},
-std::array<float,2>{0.516745865f, 0.682928801f},
-std::array<float,2>{0.286773384f, 0.307439655f},
-std::array<float,2>{0.81260407f, 0.335976511f},
-std::array<float,2>{0.155064553f, 0.746674001f},
-std::array<float,2>{0.629942596f, 0.846411765f},
-std::array<float,2>{0.449433714f, 0.136537179f},
-std::array<float,2>{0.576700389f, 0.10609673f},
-std::array<float,2>{0.36142692f, 0.895854294f},
-std::array<float,2>{0.954056263f, 0.592502832f},
-std::array<float,2>{0.0790374726f, 0.470473737f},
-std::array<float,2>{0.564296544f, 0.411626309f},
-std::array<float,2>{0.367778301f, 0.515917897f},
-std::array<float,2>{0.964133859f, 0.999370277f},
-std::array<float,2>{0.0873394608f, 0.0035602455f},
-std::array<float,2>{0.827424109f, 0.227852255f},
-std::array<float,2>{0.142703667f, 0.754642308f},
-std::array<float,2>{0.635230958f, 0.666692078f},
-std::array<float,2>{0.444168359f, 0.285216749f},
-std::array<float,2>{0.889592648f, 0.323225856f},
-std::array<float,2>{0.0467641354f, 0.724491537f},
-std::array<float,2>{0.52429986f, 0.863563895f},
-std::array<float,2>{0.29551661f, 0.1496263f},
-std::array<float,2>{0.734876394f, 0.122502133f},
-std::array<float,2>{0.412327677f, 0.885825992f},
-std::array<float,2>{0.765373528f, 0.565367758f},
-std::array<float,2>{0.240749389f, 0.497095227f},
-std::array<float,2>{0.674329579f, 0.276226252f},
-std::array<float,2>{0.469468564f, 0.63801223f},
-std::array<float,2>{0.857542694f, 0.804415524f},
-std::array<float,2>{0.160553068f, 0.189216241f},
-std::array<float,2>{0.976289868f, 0.0504843332f},
-std::array<float,2>{0.097042039f, 0.940652013f},
-std::array<float,2>{0.623425603f, 0.56195128f},
-std::array<float,2>{0.329987317f, 0.380741924f},
-std::array<float,2>{0.811212242f, 0.463723302f},
-std::array<float,2>{0.196584448f, 0.620963097f},
-std::array<float,2>{0.695554137f, 0.927221954f},
-std::array<float,2>{0.38420549f, 0.0863810629f},
-std::array<float,2>{0.552461147f, 0.166294798f},
-std::array<float,2>{0.281225234f, 0.817118227f},
-std::array<float,2>{0.908291459f, 0.695290685f},
-std::array<float,2>{0.0295955036f, 0.366486669f},
-std::array<float,2>{0.514879167f, 0.344797552f},
-std::array<float,2>{0.303535819f, 0.708135664f},
-std::array<float,2>{0.892118812f, 0.835254073f},
-std::array<float,2>{0.0500763096f, 0.17398122f},
-std::array<float,2>{0.77933085f, 0.0690105632f},
-std::array<float,2>{0.22934556f, 0.914106369f},
-std::array<float,2>{0.730111182f, 0.596126199f},
-std::array<float,2>{0.423572868f, 0.441759616f},
-std::array<float,2>{0.945384622f, 0.399627745f},
-std::array<float,2>{0.074202463f, 0.533781767f},
-std::array<float,2>{0.590298533f, 0.965241432f},
-std::array<float,2>{0.350637823f, 0.0372369848f},
-std::array<float,2>{0.646782994f, 0.204302087f},
-std::array<float,2>{0.456247926f, 0.783861637f},
-std::array<float,2>{0.840586782f, 0.648877442f},
-std::array<float,2>{0.128138259f, 0.260202557f},
-std::array<float,2>{0.710071921f, 0.475998104f},
-std::array<float,2>{0.396378279f, 0.58636266f},
-std::array<float,2>{0.789943755f, 0.893943489f},
-std::array<float,2>{0.215393171f, 0.104587644f},
-std::array<float,2>{0.936508894f, 0.139582142f},
-std::array<float,2>{0.0130382646f, 0.849156201f},
-std::array<float,2>{0.543911397f, 0.745704651f},
-std::array<float,2>{0.256777465f, 0.342498124f},
-std::array<float,2>{0.860755861f, 0.310686857f},
-std::array<float,2>{0.18272236f, 0.686479807f},
-std::array<float,2>{0.663288653f, 0.774824858f},
-std::array<float,2>{0.486767411f, 0.246990725f},
-std::array<float,2>{0.607326388f, 0.0183873139f},
-std::array<float,2>{0.319923759f, 0.974061847f},
-std::array<float,2>{0.988420367f, 0.503325224f},
-std::array<float,2>{0.120604165f, 0.433168501f},
-std::array<float,2>{0.536356211f, 0.450524062f},
-std::array<float,2>{0.262961f, 0.602031648f},
-std::array<float,2>{0.925411224f, 0.910297692f},
-std::array<float,2>{0.00614824845f, 0.0746390894f},
-std::array<float,2>{0.786931455f, 0.181551307f},
-std::array<float,2>{0.208343282f, 0.840883315f},
-std::array<float,2>{0.713579714f, 0.713217139f},
-std::array<float,2>{0.405261964f, 0.354317188f},
-std::array<float,2>{0.998516023f, 0.25339672f},
-std::array<float,2>{0.117048845f, 0.641532242f},
-std::array<float,2>{0.59679234f, 0.791090369f},
-std::array<float,2>{0.32500717f, 0.213592306f},
-std::array<float,2>{0.667684555f, 0.0422300696f},
-std::array<float,2>{0.495264202f, 0.956783712f},
-std::array<float,2>{0.874100566f, 0.546663105f},
-std::array<float,2>{0.173204616f, 0.397246122f},
-std::array<float,2>{0.720819354f, 0.332774609f},
-std::array<float,2>{0.437092245f, 0.735581279f},
-std::array<float,2>{0.770891011f, 0.855191946f},
-std::array<float,2>{0.221031412f, 0.128984779f},
-std::array<float,2>{0.902114928f, 0.0972624943f},
-std::array<float,2>{0.0618298948f, 0.899542093f},
-std::array<float,2>{0.500877798f, 0.582662344f},
-std::array<float,2>{0.304995984f, 0.484018654f},
-std::array<float,2>{0.835779667f, 0.429448158f},
-std::array<float,2>{0.134889513f, 0.510422707f},
-std::array<float,2>{0.651745379f, 0.980689466f},
-std::array<float,2>{0.463258773f, 0.0259631891f},
-std::array<float,2>{0.584898293f, 0.241166666f},
-std::array<float,2>{0.357941061f, 0.767242432f},
-std::array<float,2>{0.944963872f, 0.678982258f},
-std::array<float,2>{0.0690863281f, 0.296882361f},
-std::array<float,2>{0.616918445f, 0.29681775f},
-std::array<float,2>{0.339339197f, 0.66058445f},
-std::array<float,2>{0.977361798f, 0.759705365f},
-std::array<float,2>{0.10884697f, 0.221341252f},
-std::array<float,2>{0.84620738f, 0.0131480638f},
-std::array<float,2>{0.168054298f, 0.98502028f},
-std::array<float,2>{0.681613088f, 0.530377269f},
-std::array<float,2>{0.476851732f, 0.414146364f},
-std::array<float,2>{0.916596353f, 0.488370299f},
-std::array<float,2>{0.0158829354f, 0.575438857f},
-std::array<float,2>{0.558540285f, 0.878868401f},
-std::array<float,2>{0.268106669f, 0.116265886f},
-std::array<float,2>{0.69115752f, 0.147203147f},
-std::array<float,2>{0.379349917f, 0.872463822f},
-std::array<float,2>{0.802593172f, 0.732092857f},
-std::array<float,2>{0.18903099f, 0.316122949f},
-std::array<float,2>{0.628331542f, 0.384778351f},
-std::array<float,2>{0.446751952f, 0.549305558f},
-std::array<float,2>{0.819219947f, 0.952298164f},
-std::array<float,2>{0.151258856f, 0.0606047474f},
-std::array<float,2>{0.957893968f, 0.198999077f},
-std::array<float,2>{0.0842149183f, 0.812121451f},
-std::array<float,2>{0.570554376f, 0.630646646f},
-std::array<float,2>{0.36412254f, 0.267487884f},
-std::array<float,2>{0.75301373f, 0.371448934f},
-std::array<float,2>{0.247120887f, 0.703119934f},
-std::array<float,2>{0.744967759f, 0.826286495f},
-std::array<float,2>{0.419596136f, 0.162822604f},
-std::array<float,2>{0.521929204f, 0.0806396976f},
-std::array<float,2>{0.282545805f, 0.934212923f},
-std::array<float,2>{0.875654459f, 0.611439764f},
-std::array<float,2>{0.0372932963f, 0.453469247f},
-std::array<float,2>{0.562406301f, 0.403250754f},
-std::array<float,2>{0.273418725f, 0.537564039f},
-std::array<float,2>{0.921360373f, 0.962312102f},
-std::array<float,2>{0.0215924028f, 0.0332284607f},
-std::array<float,2>{0.798526347f, 0.208709806f},
-std::array<float,2>{0.193782255f, 0.786628902f},
-std::array<float,2>{0.693288207f, 0.653939068f},
-std::array<float,2>{0.378441483f, 0.264698654f},
-std::array<float,2>{0.980705619f, 0.349377275f},
-std::array<float,2>{0.105389148f, 0.70600152f},
-std::array<float,2>{0.610537648f, 0.829528928f},
-std::array<float,2>{0.340403765f, 0.177153975f},
-std::array<float,2>{0.686227918f, 0.0638933405f},
-std::array<float,2>{0.481226385f, 0.918750882f},
-std::array<float,2>{0.848572254f, 0.599515021f},
-std::array<float,2>{0.16487512f, 0.440122962f},
-std::array<float,2>{0.749761283f, 0.306780517f},
-std::array<float,2>{0.414135247f, 0.683358729f},
-std::array<float,2>{0.757348895f, 0.780402839f},
-std::array<float,2>{0.242602989f, 0.24573037f},
-std::array<float,2>{0.880657732f, 0.0228039846f},
-std::array<float,2>{0.0326883718f, 0.969226301f},
-std::array<float,2>{0.518310547f, 0.504712224f},
-std::array<float,2>{0.287993193f, 0.437393337f},
-std::array<float,2>{0.816061676f, 0.47000441f},
-std::array<float,2>{0.153440163f, 0.5918625f},
-std::array<float,2>{0.632359624f, 0.89630121f},
-std::array<float,2>{0.452020407f, 0.105585471f},
-std::array<float,2>{0.574337184f, 0.135998756f},
-std::array<float,2>{0.360173911f, 0.845981658f},
-std::array<float,2>{0.955442846f, 0.746133685f},
-std::array<float,2>{0.081046246f, 0.336760342f},
-std::array<float,2>{0.598503053f, 0.324721873f},
-std::array<float,2>{0.323962152f, 0.718957961f},
-std::array<float,2>{0.992245376f, 0.859927475f},
-std::array<float,2>{0.112130575f, 0.155794412f},
-std::array<float,2>{0.87062788f, 0.118613668f},
-std::array<float,2>{0.179661408f, 0.88920629f},
-std::array<float,2>{0.66994679f, 0.567667484f},
-std::array<float,2>{0.499141484f, 0.492418826f},
-std::array<float,2>{0.92875278f, 0.409003973f},
-std::array<float,2>{5.19580026e-05f, 0.520983279f},
-std::array<float,2>{0.534182847f, 0.993183434f},
-std::array<float,2>{0.261335939f, 0.00451130886f},
-std::array<float,2>{0.715864956f, 0.231289089f},
-std::array<float,2>{0.40152815f, 0.753355443f},
-std::array<float,2>{0.783278167f, 0.670802355f},
-std::array<float,2>{0.203497052f, 0.282923669f},
-std::array<float,2>{0.652423978f, 0.467676908f},
-std::array<float,2>{0.465436637f, 0.623238087f},
-std::array<float,2>{0.828604519f, 0.921928048f},
-std::array<float,2>{0.138760522f, 0.091043897f},
-std::array<float,2>{0.939911604f, 0.169154346f},
-std::array<float,2>{0.0627010763f, 0.816372097f},
-std::array<float,2>{0.581508696f, 0.689666867f},
-std::array<float,2>{0.354025632f, 0.360853821f},
-std::array<float,2>{0.768625438f, 0.280799806f},
-std::array<float,2>{0.226021647f, 0.635364115f},
-std::array<float,2>{0.723559201f, 0.800400972f},
-std::array<float,2>{0.429708242f, 0.193537027f},
-std::array<float,2>{0.505616546f, 0.0541125648f},
-std::array<float,2>{0.312254012f, 0.94402802f},
-std::array<float,2>{0.902635038f, 0.555697739f},
-std::array<float,2>{0.0549161173f, 0.377002567f},
-std::array<float,2>{0.589323103f, 0.485366106f},
-std::array<float,2>{0.344291866f, 0.572111785f},
-std::array<float,2>{0.950710714f, 0.881972075f},
-std::array<float,2>{0.0769164711f, 0.112612396f},
-std::array<float,2>{0.839785695f, 0.140644237f},
-std::array<float,2>{0.130833462f, 0.86719507f},
-std::array<float,2>{0.642517328f, 0.727970362f},
-std::array<float,2>{0.457364976f, 0.31919384f},
-std::array<float,2>{0.895914555f, 0.291065127f},
-std::array<float,2>{0.0523086339f, 0.659968972f},
-std::array<float,2>{0.508686364f, 0.763426781f},
-std::array<float,2>{0.298972219f, 0.226043344f},
-std::array<float,2>{0.73082757f, 0.00952134188f},
-std::array<float,2>{0.429174453f, 0.990952075f},
-std::array<float,2>{0.775739074f, 0.523814619f},
-std::array<float,2>{0.23083213f, 0.418547869f},
-std::array<float,2>{0.658508122f, 0.369304121f},
-std::array<float,2>{0.488303691f, 0.698587596f},
-std::array<float,2>{0.866057515f, 0.822021961f},
-std::array<float,2>{0.18434459f, 0.157708332f},
-std::array<float,2>{0.987209558f, 0.0839169398f},
-std::array<float,2>{0.122275583f, 0.933113992f},
-std::array<float,2>{0.601870418f, 0.615948677f},
-std::array<float,2>{0.313506216f, 0.460733503f},
-std::array<float,2>{0.794418633f, 0.389144808f},
-std::array<float,2>{0.211368129f, 0.552856565f},
-std::array<float,2>{0.706859529f, 0.945460141f},
-std::array<float,2>{0.392337143f, 0.0557493828f},
-std::array<float,2>{0.541974604f, 0.202683851f},
-std::array<float,2>{0.253844738f, 0.806652665f},
-std::array<float,2>{0.929807186f, 0.625554502f},
-std::array<float,2>{0.00987642072f, 0.272273242f},
-std::array<float,2>{0.529995501f, 0.257727385f},
-std::array<float,2>{0.289376855f, 0.644573569f},
-std::array<float,2>{0.883167148f, 0.794098675f},
-std::array<float,2>{0.040813949f, 0.216347173f},
-std::array<float,2>{0.758130312f, 0.0462001897f},
-std::array<float,2>{0.234961003f, 0.957979441f},
-std::array<float,2>{0.740471184f, 0.539522052f},
-std::array<float,2>{0.409869313f, 0.392704338f},
-std::array<float,2>{0.967299283f, 0.448825985f},
-std::array<float,2>{0.0903384537f, 0.60635978f},
-std::array<float,2>{0.56772536f, 0.908246338f},
-std::array<float,2>{0.374471992f, 0.0719680637f},
-std::array<float,2>{0.638388515f, 0.183943436f},
-std::array<float,2>{0.438601375f, 0.839276493f},
-std::array<float,2>{0.823943675f, 0.715108097f},
-std::array<float,2>{0.147610232f, 0.358503073f},
-std::array<float,2>{0.702226698f, 0.422633886f},
-std::array<float,2>{0.389021337f, 0.513726473f},
-std::array<float,2>{0.807918489f, 0.979135275f},
-std::array<float,2>{0.201635316f, 0.0291444641f},
-std::array<float,2>{0.912078977f, 0.237459078f},
-std::array<float,2>{0.0263486169f, 0.772945642f},
-std::array<float,2>{0.547668993f, 0.674653292f},
-std::array<float,2>{0.276151747f, 0.300782681f},
-std::array<float,2>{0.853334725f, 0.329125315f},
-std::array<float,2>{0.157288566f, 0.741202116f},
-std::array<float,2>{0.678764641f, 0.856591225f},
-std::array<float,2>{0.474807322f, 0.126194134f},
-std::array<float,2>{0.620148659f, 0.0992089659f},
-std::array<float,2>{0.332161874f, 0.904752553f},
-std::array<float,2>{0.97034657f, 0.580166638f},
-std::array<float,2>{0.100006066f, 0.480287284f},
-std::array<float,2>{0.614930689f, 0.414644361f},
-std::array<float,2>{0.337395698f, 0.531116426f},
-std::array<float,2>{0.98010838f, 0.984484136f},
-std::array<float,2>{0.106593996f, 0.01348559f},
-std::array<float,2>{0.84521997f, 0.22103411f},
-std::array<float,2>{0.170441508f, 0.758881152f},
-std::array<float,2>{0.683404386f, 0.660781622f},
-std::array<float,2>{0.480390847f, 0.296322882f},
-std::array<float,2>{0.914849341f, 0.315780252f},
-std::array<float,2>{0.0186417215f, 0.731461823f},
-std::array<float,2>{0.556095064f, 0.872760892f},
-std::array<float,2>{0.26729995f, 0.146830812f},
-std::array<float,2>{0.687740326f, 0.116774738f},
-std::array<float,2>{0.381596714f, 0.877999365f},
-std::array<float,2>{0.804434776f, 0.575954854f},
-std::array<float,2>{0.190760106f, 0.489066482f},
-std::array<float,2>{0.626888156f, 0.266936898f},
-std::array<float,2>{0.448577881f, 0.630221665f},
-std::array<float,2>{0.816629529f, 0.811663628f},
-std::array<float,2>{0.149385452f, 0.198428109f},
-std::array<float,2>{0.960219085f, 0.0610699281f},
-std::array<float,2>{0.0827471316f, 0.952978015f},
-std::array<float,2>{0.572498858f, 0.549403369f},
-std::array<float,2>{0.366034061f, 0.385279685f},
-std::array<float,2>{0.750681877f, 0.454050124f},
-std::array<float,2>{0.248975977f, 0.611984134f},
-std::array<float,2>{0.743032634f, 0.933952451f},
-std::array<float,2>{0.421416998f, 0.0804107562f},
-std::array<float,2>{0.520069122f, 0.162349552f},
-std::array<float,2>{0.285120428f, 0.826768398f},
-std::array<float,2>{0.877202034f, 0.702276766f},
-std::array<float,2>{0.0354857594f, 0.371790081f},
-std::array<float,2>{0.538147748f, 0.353926629f},
-std::array<float,2>{0.264273375f, 0.713709354f},
-std::array<float,2>{0.923459351f, 0.841635823f},
-std::array<float,2>{0.00453970162f, 0.18078436f},
-std::array<float,2>{0.787406385f, 0.0747159943f},
-std::array<float,2>{0.210753247f, 0.911043704f},
-std::array<float,2>{0.711847365f, 0.602099895f},
-std::array<float,2>{0.402721107f, 0.451115996f},
-std::array<float,2>{0.996639609f, 0.39671427f},
-std::array<float,2>{0.114553981f, 0.54634428f},
-std::array<float,2>{0.594842792f, 0.956073642f},
-std::array<float,2>{0.326616347f, 0.0427098796f},
-std::array<float,2>{0.6654194f, 0.213184237f},
-std::array<float,2>{0.493117094f, 0.791585863f},
-std::array<float,2>{0.873022079f, 0.640832067f},
-std::array<float,2>{0.175392792f, 0.253708482f},
-std::array<float,2>{0.720127046f, 0.483704627f},
-std::array<float,2>{0.433677286f, 0.5821504f},
-std::array<float,2>{0.771566451f, 0.900356114f},
-std::array<float,2>{0.220534548f, 0.0967569724f},
-std::array<float,2>{0.898514152f, 0.12972495f},
-std::array<float,2>{0.0598110706f, 0.854559541f},
-std::array<float,2>{0.503582537f, 0.735993922f},
-std::array<float,2>{0.308258355f, 0.33228907f},
-std::array<float,2>{0.833326459f, 0.297553778f},
-std::array<float,2>{0.134121865f, 0.679528713f},
-std::array<float,2>{0.648694396f, 0.766608298f},
-std::array<float,2>{0.461490273f, 0.240234435f},
-std::array<float,2>{0.583336353f, 0.0257500615f},
-std::array<float,2>{0.357279569f, 0.981089413f},
-std::array<float,2>{0.941699803f, 0.510069013f},
-std::array<float,2>{0.0683442131f, 0.428849518f},
-std::array<float,2>{0.511899352f, 0.442140132f},
-std::array<float,2>{0.301161677f, 0.596228004f},
-std::array<float,2>{0.893891156f, 0.914812863f},
-std::array<float,2>{0.0483457893f, 0.0684200749f},
-std::array<float,2>{0.777468801f, 0.17433472f},
-std::array<float,2>{0.226978138f, 0.835801423f},
-std::array<float,2>{0.728103101f, 0.708549142f},
-std::array<float,2>{0.425119162f, 0.345489115f},
-std::array<float,2>{0.947429955f, 0.260666907f},
-std::array<float,2>{0.0717801824f, 0.64922142f},
-std::array<float,2>{0.593614578f, 0.783635437f},
-std::array<float,2>{0.34955883f, 0.204617649f},
-std::array<float,2>{0.646293342f, 0.038029395f},
-std::array<float,2>{0.454743505f, 0.965334237f},
-std::array<float,2>{0.843626559f, 0.533571362f},
-std::array<float,2>{0.125637054f, 0.400099158f},
-std::array<float,2>{0.707300067f, 0.341823965f},
-std::array<float,2>{0.397583693f, 0.745527685f},
-std::array<float,2>{0.792328238f, 0.849071085f},
-std::array<float,2>{0.217284724f, 0.139011323f},
-std::array<float,2>{0.933789968f, 0.105391115f},
-std::array<float,2>{0.014366651f, 0.894201934f},
-std::array<float,2>{0.546727359f, 0.586492598f},
-std::array<float,2>{0.254487813f, 0.476230174f},
-std::array<float,2>{0.862124979f, 0.43291539f},
-std::array<float,2>{0.180169135f, 0.503865182f},
-std::array<float,2>{0.660192251f, 0.974163234f},
-std::array<float,2>{0.485507011f, 0.0176915005f},
-std::array<float,2>{0.607753575f, 0.246278882f},
-std::array<float,2>{0.317134172f, 0.775135815f},
-std::array<float,2>{0.990566432f, 0.685617149f},
-std::array<float,2>{0.118032955f, 0.311230868f},
-std::array<float,2>{0.565548718f, 0.28585881f},
-std::array<float,2>{0.369490772f, 0.666082859f},
-std::array<float,2>{0.962497234f, 0.754017115f},
-std::array<float,2>{0.0891596228f, 0.228129163f},
-std::array<float,2>{0.824353456f, 0.00333783659f},
-std::array<float,2>{0.140673831f, 0.99957633f},
-std::array<float,2>{0.634740114f, 0.516495287f},
-std::array<float,2>{0.442917824f, 0.411615133f},
-std::array<float,2>{0.888065219f, 0.497995049f},
-std::array<float,2>{0.0434394553f, 0.564894021f},
-std::array<float,2>{0.527202725f, 0.886404753f},
-std::array<float,2>{0.294618696f, 0.122681044f},
-std::array<float,2>{0.736851275f, 0.150056496f},
-std::array<float,2>{0.410728216f, 0.864076495f},
-std::array<float,2>{0.761778533f, 0.723959923f},
-std::array<float,2>{0.239993468f, 0.322277367f},
-std::array<float,2>{0.673266828f, 0.380088508f},
-std::array<float,2>{0.472015947f, 0.562385082f},
-std::array<float,2>{0.857110262f, 0.941349268f},
-std::array<float,2>{0.163925231f, 0.0502164587f},
-std::array<float,2>{0.973334849f, 0.188670307f},
-std::array<float,2>{0.0941073522f, 0.804186642f},
-std::array<float,2>{0.621756613f, 0.638345182f},
-std::array<float,2>{0.331299305f, 0.275394022f},
-std::array<float,2>{0.809048057f, 0.366982043f},
-std::array<float,2>{0.198966578f, 0.694663644f},
-std::array<float,2>{0.697358787f, 0.816554248f},
-std::array<float,2>{0.385769308f, 0.166837573f},
-std::array<float,2>{0.552846014f, 0.0865551606f},
-std::array<float,2>{0.279070795f, 0.927527785f},
-std::array<float,2>{0.906613052f, 0.620385468f},
-std::array<float,2>{0.0285792891f, 0.463317662f},
-std::array<float,2>{0.517193735f, 0.43530789f},
-std::array<float,2>{0.286222726f, 0.506833792f},
-std::array<float,2>{0.882615149f, 0.971316218f},
-std::array<float,2>{0.0338779688f, 0.0212401524f},
-std::array<float,2>{0.755575299f, 0.242895186f},
-std::array<float,2>{0.244659558f, 0.77914542f},
-std::array<float,2>{0.746222615f, 0.681403399f},
-std::array<float,2>{0.416028827f, 0.304952711f},
-std::array<float,2>{0.95326978f, 0.338169307f},
-std::array<float,2>{0.0782199726f, 0.749020755f},
-std::array<float,2>{0.576571345f, 0.844000578f},
-std::array<float,2>{0.362061441f, 0.133504212f},
-std::array<float,2>{0.630849123f, 0.108379036f},
-std::array<float,2>{0.449752241f, 0.897769809f},
-std::array<float,2>{0.813282192f, 0.59018755f},
-std::array<float,2>{0.154400215f, 0.471162736f},
-std::array<float,2>{0.694172919f, 0.262188077f},
-std::array<float,2>{0.37545675f, 0.655122638f},
-std::array<float,2>{0.799656212f, 0.788873672f},
-std::array<float,2>{0.192875549f, 0.209031627f},
-std::array<float,2>{0.9186849f, 0.0326408893f},
-std::array<float,2>{0.0202010497f, 0.963897884f},
-std::array<float,2>{0.55906105f, 0.536330819f},
-std::array<float,2>{0.270207882f, 0.404686391f},
-std::array<float,2>{0.851377666f, 0.438912302f},
-std::array<float,2>{0.167578816f, 0.601411939f},
-std::array<float,2>{0.68459934f, 0.920781314f},
-std::array<float,2>{0.484049499f, 0.0661713108f},
-std::array<float,2>{0.613076091f, 0.179084241f},
-std::array<float,2>{0.34307465f, 0.83047986f},
-std::array<float,2>{0.983929157f, 0.703513086f},
-std::array<float,2>{0.101814836f, 0.351282895f},
-std::array<float,2>{0.579069555f, 0.361483902f},
-std::array<float,2>{0.353098452f, 0.688709378f},
-std::array<float,2>{0.938854635f, 0.813572764f},
-std::array<float,2>{0.0646315366f, 0.17128852f},
-std::array<float,2>{0.830713153f, 0.0928866044f},
-std::array<float,2>{0.137405857f, 0.925271571f},
-std::array<float,2>{0.655124784f, 0.622228622f},
-std::array<float,2>{0.467973828f, 0.466705412f},
-std::array<float,2>{0.90510124f, 0.375030994f},
-std::array<float,2>{0.0583678931f, 0.557252109f},
-std::array<float,2>{0.506869197f, 0.942974329f},
-std::array<float,2>{0.308879584f, 0.052256804f},
-std::array<float,2>{0.725821435f, 0.192730203f},
-std::array<float,2>{0.432428449f, 0.798160434f},
-std::array<float,2>{0.766471386f, 0.633092821f},
-std::array<float,2>{0.223938212f, 0.277945995f},
-std::array<float,2>{0.669401646f, 0.495682895f},
-std::array<float,2>{0.497594327f, 0.570267558f},
-std::array<float,2>{0.868730962f, 0.886948049f},
-std::array<float,2>{0.176273704f, 0.119508676f},
-std::array<float,2>{0.995581865f, 0.152482271f},
-std::array<float,2>{0.11025162f, 0.863225877f},
-std::array<float,2>{0.600388348f, 0.722485542f},
-std::array<float,2>{0.321083784f, 0.32757169f},
-std::array<float,2>{0.782961667f, 0.284874916f},
-std::array<float,2>{0.206092149f, 0.668162048f},
-std::array<float,2>{0.717229187f, 0.750418067f},
-std::array<float,2>{0.398912936f, 0.232953802f},
-std::array<float,2>{0.533100843f, 0.00756897638f},
-std::array<float,2>{0.258049041f, 0.995636463f},
-std::array<float,2>{0.926941752f, 0.522765398f},
-std::array<float,2>{0.00199925038f, 0.407476604f},
-std::array<float,2>{0.60481441f, 0.458705723f},
-std::array<float,2>{0.316165656f, 0.613791108f},
-std::array<float,2>{0.984385192f, 0.931120038f},
-std::array<float,2>{0.12453407f, 0.0843122154f},
-std::array<float,2>{0.864383936f, 0.15973112f},
-std::array<float,2>{0.185971931f, 0.823718488f},
-std::array<float,2>{0.65667516f, 0.695383251f},
-std::array<float,2>{0.490715533f, 0.36761114f},
-std::array<float,2>{0.932510138f, 0.270025492f},
-std::array<float,2>{0.00932457019f, 0.62832433f},
-std::array<float,2>{0.539464474f, 0.805290699f},
-std::array<float,2>{0.250907481f, 0.200457945f},
-std::array<float,2>{0.704008877f, 0.0584759861f},
-std::array<float,2>{0.393191457f, 0.948450506f},
-std::array<float,2>{0.795976818f, 0.551742077f},
-std::array<float,2>{0.214282081f, 0.387506008f},
-std::array<float,2>{0.643962145f, 0.31731993f},
-std::array<float,2>{0.459065795f, 0.728904724f},
-std::array<float,2>{0.83733356f, 0.870207369f},
-std::array<float,2>{0.131762773f, 0.143141016f},
-std::array<float,2>{0.952038407f, 0.11056266f},
-std::array<float,2>{0.0749048442f, 0.879900336f},
-std::array<float,2>{0.586442769f, 0.572266996f},
-std::array<float,2>{0.346760064f, 0.487915576f},
-std::array<float,2>{0.773757577f, 0.4201985f},
-std::array<float,2>{0.233973682f, 0.526224911f},
-std::array<float,2>{0.733735383f, 0.989959478f},
-std::array<float,2>{0.426819712f, 0.0114167109f},
-std::array<float,2>{0.510576069f, 0.223681346f},
-std::array<float,2>{0.298321843f, 0.765334308f},
-std::array<float,2>{0.897770166f, 0.656615317f},
-std::array<float,2>{0.0528254546f, 0.290062904f},
-std::array<float,2>{0.549304247f, 0.303379059f},
-std::array<float,2>{0.274227589f, 0.671877742f},
-std::array<float,2>{0.913472176f, 0.769895852f},
-std::array<float,2>{0.0245467797f, 0.235187054f},
-std::array<float,2>{0.805119872f, 0.0304074734f},
-std::array<float,2>{0.200191215f, 0.977613211f},
-std::array<float,2>{0.699305892f, 0.512998641f},
-std::array<float,2>{0.388171524f, 0.425114214f},
-std::array<float,2>{0.972355485f, 0.477686971f},
-std::array<float,2>{0.0994878784f, 0.579869211f},
-std::array<float,2>{0.617930233f, 0.902617633f},
-std::array<float,2>{0.334477991f, 0.100311317f},
-std::array<float,2>{0.676984012f, 0.12863484f},
-std::array<float,2>{0.473965794f, 0.858267784f},
-std::array<float,2>{0.853632152f, 0.739345849f},
-std::array<float,2>{0.158618942f, 0.331748009f},
-std::array<float,2>{0.738719463f, 0.390761763f},
-std::array<float,2>{0.40799126f, 0.541392446f},
-std::array<float,2>{0.761014819f, 0.959934473f},
-std::array<float,2>{0.236371681f, 0.0431873761f},
-std::array<float,2>{0.886712968f, 0.21714583f},
-std::array<float,2>{0.0424880199f, 0.795331359f},
-std::array<float,2>{0.528659642f, 0.648027778f},
-std::array<float,2>{0.291206896f, 0.254763156f},
-std::array<float,2>{0.821958661f, 0.356827766f},
-std::array<float,2>{0.145726889f, 0.717906117f},
-std::array<float,2>{0.638877213f, 0.836089671f},
-std::array<float,2>{0.440936834f, 0.186227143f},
-std::array<float,2>{0.569283962f, 0.0735773221f},
-std::array<float,2>{0.372228324f, 0.906357408f},
-std::array<float,2>{0.965067446f, 0.608648658f},
-std::array<float,2>{0.0933829397f, 0.44664526f},
-std::array<float,2>{0.571065724f, 0.383983254f},
-std::array<float,2>{0.363352776f, 0.547749102f},
-std::array<float,2>{0.957383811f, 0.950783372f},
-std::array<float,2>{0.0846443698f, 0.0596348569f},
-std::array<float,2>{0.818683684f, 0.196838126f},
-std::array<float,2>{0.150515795f, 0.808977604f},
-std::array<float,2>{0.628622115f, 0.632761657f},
-std::array<float,2>{0.446927577f, 0.268021464f},
-std::array<float,2>{0.875259995f, 0.374519497f},
-std::array<float,2>{0.038081117f, 0.699440181f},
-std::array<float,2>{0.522287726f, 0.824962735f},
-std::array<float,2>{0.283095062f, 0.160750285f},
-std::array<float,2>{0.744361222f, 0.078972064f},
-std::array<float,2>{0.419028312f, 0.936040998f},
-std::array<float,2>{0.753422916f, 0.609861672f},
-std::array<float,2>{0.247975737f, 0.45677653f},
-std::array<float,2>{0.680926085f, 0.294099569f},
-std::array<float,2>{0.477387428f, 0.66307354f},
-std::array<float,2>{0.846058488f, 0.761348128f},
-std::array<float,2>{0.168465495f, 0.220296502f},
-std::array<float,2>{0.976895928f, 0.0139273014f},
-std::array<float,2>{0.109140724f, 0.987885475f},
-std::array<float,2>{0.616571724f, 0.528322101f},
-std::array<float,2>{0.339647651f, 0.416902125f},
-std::array<float,2>{0.801894367f, 0.492089152f},
-std::array<float,2>{0.188621983f, 0.576872885f},
-std::array<float,2>{0.690837502f, 0.875124812f},
-std::array<float,2>{0.379602551f, 0.113303468f},
-std::array<float,2>{0.557743788f, 0.145362437f},
-std::array<float,2>{0.268050611f, 0.874082386f},
-std::array<float,2>{0.916052938f, 0.733168781f},
-std::array<float,2>{0.0165862739f, 0.31364724f},
-std::array<float,2>{0.500451028f, 0.334512025f},
-std::array<float,2>{0.305360496f, 0.736335814f},
-std::array<float,2>{0.901438177f, 0.852422118f},
-std::array<float,2>{0.0624880232f, 0.131407887f},
-std::array<float,2>{0.771198392f, 0.0939311758f},
-std::array<float,2>{0.221303612f, 0.900548041f},
-std::array<float,2>{0.721255898f, 0.585555673f},
-std::array<float,2>{0.43660447f, 0.481407851f},
-std::array<float,2>{0.944450915f, 0.425988764f},
-std::array<float,2>{0.0685981587f, 0.50938338f},
-std::array<float,2>{0.584309995f, 0.983778536f},
-std::array<float,2>{0.357453138f, 0.023815494f},
-std::array<float,2>{0.651961982f, 0.238530293f},
-std::array<float,2>{0.463560849f, 0.769115329f},
-std::array<float,2>{0.835431516f, 0.677726805f},
-std::array<float,2>{0.135296389f, 0.299665332f},
-std::array<float,2>{0.713308275f, 0.45189473f},
-std::array<float,2>{0.404726416f, 0.604438245f},
-std::array<float,2>{0.786518812f, 0.913771152f},
-std::array<float,2>{0.2086806f, 0.0774496421f},
-std::array<float,2>{0.924912155f, 0.181770265f},
-std::array<float,2>{0.00642794417f, 0.841873884f},
-std::array<float,2>{0.536817491f, 0.712501884f},
-std::array<float,2>{0.263420314f, 0.351854622f},
-std::array<float,2>{0.874522388f, 0.250072598f},
-std::array<float,2>{0.173366487f, 0.643727362f},
-std::array<float,2>{0.667359948f, 0.790644765f},
-std::array<float,2>{0.495908111f, 0.21240966f},
-std::array<float,2>{0.597228229f, 0.0400556065f},
-std::array<float,2>{0.324691147f, 0.953911543f},
-std::array<float,2>{0.998724639f, 0.543583155f},
-std::array<float,2>{0.116641939f, 0.396039009f},
-std::array<float,2>{0.543183446f, 0.474220544f},
-std::array<float,2>{0.256240875f, 0.5891065f},
-std::array<float,2>{0.935643911f, 0.891923964f},
-std::array<float,2>{0.0133166462f, 0.103103697f},
-std::array<float,2>{0.789509416f, 0.138274491f},
-std::array<float,2>{0.21527116f, 0.850045919f},
-std::array<float,2>{0.710749984f, 0.743985772f},
-std::array<float,2>{0.395886689f, 0.339966655f},
-std::array<float,2>{0.988838077f, 0.309545428f},
-std::array<float,2>{0.120818064f, 0.685371637f},
-std::array<float,2>{0.606708169f, 0.776529133f},
-std::array<float,2>{0.319589794f, 0.248213604f},
-std::array<float,2>{0.664057434f, 0.0166058335f},
-std::array<float,2>{0.487179548f, 0.974920392f},
-std::array<float,2>{0.861241937f, 0.501179516f},
-std::array<float,2>{0.183348015f, 0.430184722f},
-std::array<float,2>{0.729822934f, 0.34648478f},
-std::array<float,2>{0.42329669f, 0.710711479f},
-std::array<float,2>{0.779954314f, 0.833961427f},
-std::array<float,2>{0.228871316f, 0.173463836f},
-std::array<float,2>{0.891796112f, 0.0668779686f},
-std::array<float,2>{0.0506946743f, 0.916580677f},
-std::array<float,2>{0.51537478f, 0.594376206f},
-std::array<float,2>{0.303120106f, 0.444220752f},
-std::array<float,2>{0.840280533f, 0.400886416f},
-std::array<float,2>{0.128457233f, 0.532263637f},
-std::array<float,2>{0.646992445f, 0.967750609f},
-std::array<float,2>{0.457010359f, 0.0358500928f},
-std::array<float,2>{0.590491712f, 0.206872329f},
-std::array<float,2>{0.351089001f, 0.782694578f},
-std::array<float,2>{0.946217179f, 0.651027262f},
-std::array<float,2>{0.0733867437f, 0.258262962f},
-std::array<float,2>{0.623702884f, 0.274482727f},
-std::array<float,2>{0.329400003f, 0.640619993f},
-std::array<float,2>{0.975962758f, 0.800961912f},
-std::array<float,2>{0.0973682925f, 0.189736366f},
-std::array<float,2>{0.858356476f, 0.0476666763f},
-std::array<float,2>{0.160893708f, 0.938996494f},
-std::array<float,2>{0.674040616f, 0.560538888f},
-std::array<float,2>{0.468871772f, 0.382357091f},
-std::array<float,2>{0.908692539f, 0.46269843f},
-std::array<float,2>{0.0299600866f, 0.618370652f},
-std::array<float,2>{0.551859677f, 0.92905724f},
-std::array<float,2>{0.280510694f, 0.0887396336f},
-std::array<float,2>{0.695841074f, 0.16417186f},
-std::array<float,2>{0.384358555f, 0.81996423f},
-std::array<float,2>{0.810761213f, 0.692277968f},
-std::array<float,2>{0.197112679f, 0.363335669f},
-std::array<float,2>{0.635570765f, 0.412842393f},
-std::array<float,2>{0.443570316f, 0.518069744f},
-std::array<float,2>{0.827872753f, 0.996189356f},
-std::array<float,2>{0.143354133f, 0.000544893497f},
-std::array<float,2>{0.964469671f, 0.229935616f},
-std::array<float,2>{0.087836571f, 0.756804287f},
-std::array<float,2>{0.563954532f, 0.664561749f},
-std::array<float,2>{0.367433161f, 0.289038092f},
-std::array<float,2>{0.764880598f, 0.320687056f},
-std::array<float,2>{0.240519941f, 0.726067066f},
-std::array<float,2>{0.734416187f, 0.866791487f},
-std::array<float,2>{0.412614822f, 0.151454121f},
-std::array<float,2>{0.523799896f, 0.124017924f},
-std::array<float,2>{0.295227617f, 0.883218229f},
-std::array<float,2>{0.888882875f, 0.562979221f},
-std::array<float,2>{0.0459879413f, 0.498261482f},
-std::array<float,2>{0.533287108f, 0.406711102f},
-std::array<float,2>{0.259976923f, 0.521518528f},
-std::array<float,2>{0.928488374f, 0.995079994f},
-std::array<float,2>{0.00173784792f, 0.00598771777f},
-std::array<float,2>{0.785067976f, 0.233709961f},
-std::array<float,2>{0.204233035f, 0.751351595f},
-std::array<float,2>{0.715596497f, 0.669181883f},
-std::array<float,2>{0.40097788f, 0.284044743f},
-std::array<float,2>{0.993390858f, 0.326421589f},
-std::array<float,2>{0.112587802f, 0.721036911f},
-std::array<float,2>{0.599017024f, 0.861403227f},
-std::array<float,2>{0.322856456f, 0.153805241f},
-std::array<float,2>{0.671631694f, 0.1202479f},
-std::array<float,2>{0.498188019f, 0.888074338f},
-std::array<float,2>{0.869209588f, 0.569283664f},
-std::array<float,2>{0.178001106f, 0.494249195f},
-std::array<float,2>{0.724551976f, 0.278943002f},
-std::array<float,2>{0.430744886f, 0.634698212f},
-std::array<float,2>{0.767969847f, 0.797378719f},
-std::array<float,2>{0.225043565f, 0.192195982f},
-std::array<float,2>{0.903956354f, 0.0509139709f},
-std::array<float,2>{0.0563226976f, 0.942268968f},
-std::array<float,2>{0.504499912f, 0.557923079f},
-std::array<float,2>{0.310573846f, 0.376546115f},
-std::array<float,2>{0.829220831f, 0.465018153f},
-std::array<float,2>{0.139656186f, 0.621426582f},
-std::array<float,2>{0.653727055f, 0.924355865f},
-std::array<float,2>{0.466378778f, 0.0925504938f},
-std::array<float,2>{0.581011057f, 0.170382366f},
-std::array<float,2>{0.354612827f, 0.81314975f},
-std::array<float,2>{0.941399217f, 0.68781203f},
-std::array<float,2>{0.0638780296f, 0.362824947f},
-std::array<float,2>{0.609788537f, 0.350478649f},
-std::array<float,2>{0.341510028f, 0.704963624f},
-std::array<float,2>{0.981633186f, 0.831449807f},
-std::array<float,2>{0.103920922f, 0.178291157f},
-std::array<float,2>{0.849144459f, 0.0648415983f},
-std::array<float,2>{0.1657473f, 0.921372712f},
-std::array<float,2>{0.68711251f, 0.600093782f},
-std::array<float,2>{0.481918126f, 0.437680066f},
-std::array<float,2>{0.920075953f, 0.405704945f},
-std::array<float,2>{0.0230850987f, 0.535509765f},
-std::array<float,2>{0.56067282f, 0.963453293f},
-std::array<float,2>{0.272237688f, 0.0320017189f},
-std::array<float,2>{0.692229569f, 0.210538566f},
-std::array<float,2>{0.377453804f, 0.787848532f},
-std::array<float,2>{0.797635496f, 0.655290246f},
-std::array<float,2>{0.194338977f, 0.262881041f},
-std::array<float,2>{0.631281257f, 0.472009331f},
-std::array<float,2>{0.452674538f, 0.591073573f},
-std::array<float,2>{0.814710498f, 0.897116601f},
-std::array<float,2>{0.153098434f, 0.108621396f},
-std::array<float,2>{0.956989527f, 0.134701103f},
-std::array<float,2>{0.0816070661f, 0.844810486f},
-std::array<float,2>{0.575633347f, 0.749615192f},
-std::array<float,2>{0.361278832f, 0.339584738f},
-std::array<float,2>{0.756506085f, 0.306337714f},
-std::array<float,2>{0.244067073f, 0.680388093f},
-std::array<float,2>{0.748948038f, 0.7777493f},
-std::array<float,2>{0.415194362f, 0.243429556f},
-std::array<float,2>{0.519033134f, 0.0200568698f},
-std::array<float,2>{0.288678885f, 0.97258693f},
-std::array<float,2>{0.879149258f, 0.507193506f},
-std::array<float,2>{0.0321449488f, 0.434259951f},
-std::array<float,2>{0.566553295f, 0.445341974f},
-std::array<float,2>{0.37400943f, 0.60794127f},
-std::array<float,2>{0.967850745f, 0.907946646f},
-std::array<float,2>{0.0913522616f, 0.0727339461f},
-std::array<float,2>{0.822609425f, 0.187175304f},
-std::array<float,2>{0.147223413f, 0.837774754f},
-std::array<float,2>{0.637597859f, 0.716978967f},
-std::array<float,2>{0.437889725f, 0.356429279f},
-std::array<float,2>{0.884006262f, 0.255158782f},
-std::array<float,2>{0.0393546484f, 0.64662087f},
-std::array<float,2>{0.530865014f, 0.796154916f},
-std::array<float,2>{0.29054144f, 0.21861504f},
-std::array<float,2>{0.741561651f, 0.0445751734f},
-std::array<float,2>{0.409091234f, 0.960196853f},
-std::array<float,2>{0.758908093f, 0.542039335f},
-std::array<float,2>{0.236029819f, 0.392389059f},
-std::array<float,2>{0.677857757f, 0.330878228f},
-std::array<float,2>{0.475795865f, 0.739100754f},
-std::array<float,2>{0.852275312f, 0.859304011f},
-std::array<float,2>{0.156696782f, 0.127168223f},
-std::array<float,2>{0.969527662f, 0.101246327f},
-std::array<float,2>{0.101366758f, 0.904038608f},
-std::array<float,2>{0.619633317f, 0.578968823f},
-std::array<float,2>{0.333726346f, 0.477240562f},
-std::array<float,2>{0.806927085f, 0.424774528f},
-std::array<float,2>{0.202372953f, 0.512248933f},
-std::array<float,2>{0.701909304f, 0.977432311f},
-std::array<float,2>{0.390270144f, 0.0297126416f},
-std::array<float,2>{0.548361063f, 0.23537074f},
-std::array<float,2>{0.276900828f, 0.770590723f},
-std::array<float,2>{0.911032736f, 0.673411727f},
-std::array<float,2>{0.0271221846f, 0.303789258f},
-std::array<float,2>{0.509260297f, 0.289567918f},
-std::array<float,2>{0.300329179f, 0.657928646f},
-std::array<float,2>{0.895474494f, 0.764428139f},
-std::array<float,2>{0.05165134f, 0.223122925f},
-std::array<float,2>{0.776871145f, 0.0106767369f},
-std::array<float,2>{0.23218812f, 0.988432407f},
-std::array<float,2>{0.731527328f, 0.526672065f},
-std::array<float,2>{0.427909195f, 0.421222448f},
-std::array<float,2>{0.949887455f, 0.487242997f},
-std::array<float,2>{0.0777073056f, 0.573486626f},
-std::array<float,2>{0.588250041f, 0.879810631f},
-std::array<float,2>{0.345243484f, 0.109880656f},
-std::array<float,2>{0.641596615f, 0.144021139f},
-std::array<float,2>{0.458453387f, 0.870111585f},
-std::array<float,2>{0.838556588f, 0.730145276f},
-std::array<float,2>{0.129066095f, 0.317828f},
-std::array<float,2>{0.705784082f, 0.388451099f},
-std::array<float,2>{0.391299248f, 0.551904202f},
-std::array<float,2>{0.793031752f, 0.947459161f},
-std::array<float,2>{0.212491482f, 0.0575892515f},
-std::array<float,2>{0.930775285f, 0.199619934f},
-std::array<float,2>{0.010957771f, 0.80598104f},
-std::array<float,2>{0.542792082f, 0.627097428f},
-std::array<float,2>{0.252343029f, 0.271092176f},
-std::array<float,2>{0.867120981f, 0.36854589f},
-std::array<float,2>{0.184802681f, 0.696617663f},
-std::array<float,2>{0.660144329f, 0.822790384f},
-std::array<float,2>{0.48938489f, 0.15838331f},
-std::array<float,2>{0.602750301f, 0.0854892284f},
-std::array<float,2>{0.313427955f, 0.930379629f},
-std::array<float,2>{0.987889409f, 0.614946604f},
-std::array<float,2>{0.121769153f, 0.45723632f},
-std::array<float,2>{0.594712317f, 0.394631386f},
-std::array<float,2>{0.327662557f, 0.544831634f},
-std::array<float,2>{0.997737646f, 0.954952061f},
-std::array<float,2>{0.113525443f, 0.0397754796f},
-std::array<float,2>{0.87160027f, 0.211857423f},
-std::array<float,2>{0.174488842f, 0.789741337f},
-std::array<float,2>{0.664931834f, 0.642967403f},
-std::array<float,2>{0.494033694f, 0.251145363f},
-std::array<float,2>{0.922000051f, 0.353234023f},
-std::array<float,2>{0.00585700059f, 0.711692333f},
-std::array<float,2>{0.537867427f, 0.843134046f},
-std::array<float,2>{0.265013844f, 0.182888269f},
-std::array<float,2>{0.712881982f, 0.0770435706f},
-std::array<float,2>{0.40395686f, 0.912481725f},
-std::array<float,2>{0.788431644f, 0.60490644f},
-std::array<float,2>{0.209910199f, 0.453081399f},
-std::array<float,2>{0.650020301f, 0.300480694f},
-std::array<float,2>{0.462117583f, 0.676634073f},
-std::array<float,2>{0.832533538f, 0.767695785f},
-std::array<float,2>{0.133026198f, 0.239870861f},
-std::array<float,2>{0.942881465f, 0.0250965767f},
-std::array<float,2>{0.0665420964f, 0.983052194f},
-std::array<float,2>{0.582711101f, 0.508379757f},
-std::array<float,2>{0.35604465f, 0.427705407f},
-std::array<float,2>{0.772905409f, 0.481981039f},
-std::array<float,2>{0.219593868f, 0.584828377f},
-std::array<float,2>{0.71964407f, 0.902121842f},
-std::array<float,2>{0.435121566f, 0.0954573825f},
-std::array<float,2>{0.502394021f, 0.132753268f},
-std::array<float,2>{0.307284445f, 0.853029668f},
-std::array<float,2>{0.899706125f, 0.737963557f},
-std::array<float,2>{0.0586828031f, 0.335194796f},
-std::array<float,2>{0.554706991f, 0.312687069f},
-std::array<float,2>{0.266446412f, 0.733982086f},
-std::array<float,2>{0.915466487f, 0.873326063f},
-std::array<float,2>{0.0180376917f, 0.145941719f},
-std::array<float,2>{0.802765965f, 0.115078583f},
-std::array<float,2>{0.189602628f, 0.876649141f},
-std::array<float,2>{0.688817561f, 0.577920079f},
-std::array<float,2>{0.382225275f, 0.491147935f},
-std::array<float,2>{0.978977382f, 0.417281419f},
-std::array<float,2>{0.105578981f, 0.528319776f},
-std::array<float,2>{0.614215672f, 0.987141371f},
-std::array<float,2>{0.336216986f, 0.0155917425f},
-std::array<float,2>{0.68187201f, 0.21964632f},
-std::array<float,2>{0.478554755f, 0.760404646f},
-std::array<float,2>{0.844589949f, 0.664054751f},
-std::array<float,2>{0.171054214f, 0.293073863f},
-std::array<float,2>{0.74336791f, 0.455603421f},
-std::array<float,2>{0.420051366f, 0.610525906f},
-std::array<float,2>{0.751380801f, 0.937055886f},
-std::array<float,2>{0.249981567f, 0.0793221146f},
-std::array<float,2>{0.878843904f, 0.161354512f},
-std::array<float,2>{0.0363729f, 0.825282812f},
-std::array<float,2>{0.520784318f, 0.700448275f},
-std::array<float,2>{0.283689231f, 0.373782426f},
-std::array<float,2>{0.817510009f, 0.268907905f},
-std::array<float,2>{0.150332198f, 0.631581128f},
-std::array<float,2>{0.625806451f, 0.809731662f},
-std::array<float,2>{0.447808385f, 0.196028873f},
-std::array<float,2>{0.574091136f, 0.0594029576f},
-std::array<float,2>{0.366347551f, 0.950037837f},
-std::array<float,2>{0.959093511f, 0.547867715f},
-std::array<float,2>{0.08315368f, 0.382854402f},
-std::array<float,2>{0.525533378f, 0.499538094f},
-std::array<float,2>{0.293856472f, 0.564085484f},
-std::array<float,2>{0.887077868f, 0.884341121f},
-std::array<float,2>{0.0440053679f, 0.124896817f},
-std::array<float,2>{0.763512552f, 0.151354566f},
-std::array<float,2>{0.238454476f, 0.865385711f},
-std::array<float,2>{0.738160312f, 0.724930048f},
-std::array<float,2>{0.411627263f, 0.321742773f},
-std::array<float,2>{0.961826205f, 0.287205338f},
-std::array<float,2>{0.0888257995f, 0.665533781f},
-std::array<float,2>{0.564593256f, 0.757476389f},
-std::array<float,2>{0.370298475f, 0.228893131f},
-std::array<float,2>{0.633529186f, 0.0015843627f},
-std::array<float,2>{0.442325503f, 0.997229159f},
-std::array<float,2>{0.825823307f, 0.518624365f},
-std::array<float,2>{0.142231643f, 0.413309544f},
-std::array<float,2>{0.698722422f, 0.364555627f},
-std::array<float,2>{0.385283321f, 0.693162084f},
-std::array<float,2>{0.809912384f, 0.818380415f},
-std::array<float,2>{0.197718501f, 0.165769592f},
-std::array<float,2>{0.908085823f, 0.089340046f},
-std::array<float,2>{0.0280888043f, 0.927963436f},
-std::array<float,2>{0.55467236f, 0.61813134f},
-std::array<float,2>{0.277804226f, 0.461592108f},
-std::array<float,2>{0.855770528f, 0.380870521f},
-std::array<float,2>{0.162146717f, 0.559436738f},
-std::array<float,2>{0.672549069f, 0.937771976f},
-std::array<float,2>{0.47122699f, 0.0485232174f},
-std::array<float,2>{0.622385561f, 0.190702423f},
-std::array<float,2>{0.330092579f, 0.801970601f},
-std::array<float,2>{0.974050045f, 0.639239848f},
-std::array<float,2>{0.0955567583f, 0.273452878f},
-std::array<float,2>{0.592634559f, 0.258868337f},
-std::array<float,2>{0.347835481f, 0.652029455f},
-std::array<float,2>{0.948741496f, 0.781288266f},
-std::array<float,2>{0.0712163076f, 0.20539543f},
-std::array<float,2>{0.842350364f, 0.0366285816f},
-std::array<float,2>{0.126479998f, 0.96803236f},
-std::array<float,2>{0.644863248f, 0.531838536f},
-std::array<float,2>{0.453630745f, 0.401720613f},
-std::array<float,2>{0.893113434f, 0.445213348f},
-std::array<float,2>{0.047842443f, 0.594814956f},
-std::array<float,2>{0.513049603f, 0.917197704f},
-std::array<float,2>{0.302490175f, 0.0682133213f},
-std::array<float,2>{0.726594985f, 0.172805622f},
-std::array<float,2>{0.424752146f, 0.832645059f},
-std::array<float,2>{0.778511703f, 0.709599316f},
-std::array<float,2>{0.228101835f, 0.347036242f},
-std::array<float,2>{0.661931515f, 0.431046546f},
-std::array<float,2>{0.485001981f, 0.500491142f},
-std::array<float,2>{0.862950444f, 0.976166785f},
-std::array<float,2>{0.181151092f, 0.0160538163f},
-std::array<float,2>{0.991758406f, 0.249391854f},
-std::array<float,2>{0.118747696f, 0.775910199f},
-std::array<float,2>{0.609230042f, 0.683686972f},
-std::array<float,2>{0.318022281f, 0.31026721f},
-std::array<float,2>{0.791485846f, 0.341094792f},
-std::array<float,2>{0.217787802f, 0.742794335f},
-std::array<float,2>{0.708902717f, 0.8514148f},
-std::array<float,2>{0.39697969f, 0.137678489f},
-std::array<float,2>{0.545124352f, 0.102003671f},
-std::array<float,2>{0.255651236f, 0.89131397f},
-std::array<float,2>{0.935280919f, 0.587906837f},
-std::array<float,2>{0.0151060419f, 0.472937554f},
-std::array<float,2>{0.506282985f, 0.378212214f},
-std::array<float,2>{0.310406148f, 0.55499506f},
-std::array<float,2>{0.90565294f, 0.944413722f},
-std::array<float,2>{0.0569424182f, 0.0532435365f},
-std::array<float,2>{0.766822398f, 0.195067123f},
-std::array<float,2>{0.223225564f, 0.799781919f},
-std::array<float,2>{0.725348055f, 0.636637986f},
-std::array<float,2>{0.433241367f, 0.280228198f},
-std::array<float,2>{0.938265443f, 0.359475613f},
-std::array<float,2>{0.0661808774f, 0.690668643f},
-std::array<float,2>{0.579295397f, 0.815309286f},
-std::array<float,2>{0.351818144f, 0.168086931f},
-std::array<float,2>{0.656155884f, 0.0906186253f},
-std::array<float,2>{0.467661947f, 0.922975421f},
-std::array<float,2>{0.831800818f, 0.624109924f},
-std::array<float,2>{0.138525486f, 0.468682051f},
-std::array<float,2>{0.718533278f, 0.281459749f},
-std::array<float,2>{0.400110692f, 0.67115438f},
-std::array<float,2>{0.781906426f, 0.752807975f},
-std::array<float,2>{0.205525234f, 0.231739685f},
-std::array<float,2>{0.926724851f, 0.00583505584f},
-std::array<float,2>{0.00368070044f, 0.993024886f},
-std::array<float,2>{0.531833231f, 0.52044183f},
-std::array<float,2>{0.259355426f, 0.409583241f},
-std::array<float,2>{0.867385805f, 0.493825495f},
-std::array<float,2>{0.17756021f, 0.567255259f},
-std::array<float,2>{0.667971373f, 0.889671266f},
-std::array<float,2>{0.496591926f, 0.117277861f},
-std::array<float,2>{0.601355016f, 0.154619321f},
-std::array<float,2>{0.321620852f, 0.860832095f},
-std::array<float,2>{0.994995356f, 0.720386744f},
-std::array<float,2>{0.11064326f, 0.325674385f},
-std::array<float,2>{0.577346921f, 0.33786723f},
-std::array<float,2>{0.363227129f, 0.747841418f},
-std::array<float,2>{0.954853117f, 0.847293019f},
-std::array<float,2>{0.0795340315f, 0.135554418f},
-std::array<float,2>{0.813580811f, 0.106792353f},
-std::array<float,2>{0.156035393f, 0.895498931f},
-std::array<float,2>{0.629765213f, 0.593672872f},
-std::array<float,2>{0.450288206f, 0.468963951f},
-std::array<float,2>{0.88157481f, 0.436462671f},
-std::array<float,2>{0.0342874303f, 0.505082548f},
-std::array<float,2>{0.515681624f, 0.970101357f},
-std::array<float,2>{0.28600505f, 0.0219935477f},
-std::array<float,2>{0.74770695f, 0.244952217f},
-std::array<float,2>{0.417072266f, 0.779412091f},
-std::array<float,2>{0.75405246f, 0.681738794f},
-std::array<float,2>{0.245934129f, 0.308150321f},
-std::array<float,2>{0.684363067f, 0.441197127f},
-std::array<float,2>{0.482862532f, 0.597961187f},
-std::array<float,2>{0.850310802f, 0.919676304f},
-std::array<float,2>{0.166172758f, 0.0625383109f},
-std::array<float,2>{0.983191252f, 0.176369146f},
-std::array<float,2>{0.103215076f, 0.82822746f},
-std::array<float,2>{0.611972153f, 0.706396282f},
-std::array<float,2>{0.342604846f, 0.347845286f},
-std::array<float,2>{0.8003304f, 0.264495343f},
-std::array<float,2>{0.1919588f, 0.652933717f},
-std::array<float,2>{0.69446677f, 0.785693407f},
-std::array<float,2>{0.37623477f, 0.207243279f},
-std::array<float,2>{0.559948444f, 0.034456756f},
-std::array<float,2>{0.271409363f, 0.961659014f},
-std::array<float,2>{0.919004202f, 0.538839817f},
-std::array<float,2>{0.0206459872f, 0.403384745f},
-std::array<float,2>{0.618707061f, 0.478698969f},
-std::array<float,2>{0.335917681f, 0.581171513f},
-std::array<float,2>{0.970908403f, 0.905646443f},
-std::array<float,2>{0.0984957963f, 0.0981405303f},
-std::array<float,2>{0.855170369f, 0.125887766f},
-std::array<float,2>{0.16000171f, 0.855571032f},
-std::array<float,2>{0.676060259f, 0.741543531f},
-std::array<float,2>{0.473444909f, 0.328490376f},
-std::array<float,2>{0.912633181f, 0.30199638f},
-std::array<float,2>{0.023971187f, 0.675298095f},
-std::array<float,2>{0.550265491f, 0.771929562f},
-std::array<float,2>{0.274693489f, 0.237106606f},
-std::array<float,2>{0.700956345f, 0.027797373f},
-std::array<float,2>{0.387029797f, 0.980038106f},
-std::array<float,2>{0.806445718f, 0.515044808f},
-std::array<float,2>{0.200215057f, 0.423110932f},
-std::array<float,2>{0.64010787f, 0.357994229f},
-std::array<float,2>{0.439752877f, 0.716676414f},
-std::array<float,2>{0.820559084f, 0.838830948f},
-std::array<float,2>{0.145284012f, 0.184836984f},
-std::array<float,2>{0.966644645f, 0.0712122172f},
-std::array<float,2>{0.0918888077f, 0.909588218f},
-std::array<float,2>{0.570298076f, 0.606638491f},
-std::array<float,2>{0.371281356f, 0.447986096f},
-std::array<float,2>{0.760232627f, 0.394503742f},
-std::array<float,2>{0.237902761f, 0.54042685f},
-std::array<float,2>{0.739316165f, 0.958281398f},
-std::array<float,2>{0.406285197f, 0.04539885f},
-std::array<float,2>{0.527516544f, 0.215624779f},
-std::array<float,2>{0.292117089f, 0.79359287f},
-std::array<float,2>{0.884958804f, 0.646475732f},
-std::array<float,2>{0.0410390832f, 0.256157488f},
-std::array<float,2>{0.540899098f, 0.273301482f},
-std::array<float,2>{0.25129804f, 0.626482844f},
-std::array<float,2>{0.932964742f, 0.808409095f},
-std::array<float,2>{0.00783211086f, 0.201827258f},
-std::array<float,2>{0.795778573f, 0.0548761934f},
-std::array<float,2>{0.213248685f, 0.94641602f},
-std::array<float,2>{0.705039561f, 0.554648697f},
-std::array<float,2>{0.394458145f, 0.389819592f},
-std::array<float,2>{0.986118495f, 0.459218472f},
-std::array<float,2>{0.123883575f, 0.616562843f},
-std::array<float,2>{0.603793919f, 0.931979179f},
-std::array<float,2>{0.314532459f, 0.082462579f},
-std::array<float,2>{0.657381356f, 0.156385228f},
-std::array<float,2>{0.492030144f, 0.821207523f},
-std::array<float,2>{0.863860846f, 0.698239863f},
-std::array<float,2>{0.186740205f, 0.37093702f},
-std::array<float,2>{0.732845843f, 0.419730604f},
-std::array<float,2>{0.426652044f, 0.524865031f},
-std::array<float,2>{0.775344968f, 0.992076933f},
-std::array<float,2>{0.233122736f, 0.00795344729f},
-std::array<float,2>{0.89674902f, 0.225015923f},
-std::array<float,2>{0.0538759157f, 0.761994898f},
-std::array<float,2>{0.511217117f, 0.65840596f},
-std::array<float,2>{0.296938837f, 0.292757839f},
-std::array<float,2>{0.836737037f, 0.319905758f},
-std::array<float,2>{0.132203117f, 0.726924598f},
-std::array<float,2>{0.642805457f, 0.86871016f},
-std::array<float,2>{0.460073471f, 0.142221674f},
-std::array<float,2>{0.587033868f, 0.112165511f},
-std::array<float,2>{0.346331716f, 0.881597638f},
-std::array<float,2>{0.952953994f, 0.57082653f},
-std::array<float,2>{0.0758223832f, 0.48482573f},
-std::array<float,2>{0.585872233f, 0.428146005f},
-std::array<float,2>{0.359292209f, 0.511093736f},
-std::array<float,2>{0.944178283f, 0.982086897f},
-std::array<float,2>{0.0699350014f, 0.0267330948f},
-std::array<float,2>{0.834067941f, 0.241540045f},
-std::array<float,2>{0.135880128f, 0.765660405f},
-std::array<float,2>{0.651202321f, 0.678170621f},
-std::array<float,2>{0.464024365f, 0.298522145f},
-std::array<float,2>{0.900847495f, 0.333479971f},
-std::array<float,2>{0.0607009754f, 0.734639406f},
-std::array<float,2>{0.501072764f, 0.854336202f},
-std::array<float,2>{0.305690497f, 0.13081795f},
-std::array<float,2>{0.721805274f, 0.0962468982f},
-std::array<float,2>{0.436238229f, 0.898515821f},
-std::array<float,2>{0.770065367f, 0.583481491f},
-std::array<float,2>{0.221798003f, 0.483381659f},
-std::array<float,2>{0.666684389f, 0.252388507f},
-std::array<float,2>{0.494372547f, 0.641854823f},
-std::array<float,2>{0.873755574f, 0.792436957f},
-std::array<float,2>{0.172037229f, 0.214524835f},
-std::array<float,2>{0.999379754f, 0.0410984345f},
-std::array<float,2>{0.115555339f, 0.955162108f},
-std::array<float,2>{0.595890939f, 0.545012176f},
-std::array<float,2>{0.325252056f, 0.398308456f},
-std::array<float,2>{0.785365939f, 0.449503422f},
-std::array<float,2>{0.207574204f, 0.60348767f},
-std::array<float,2>{0.714663863f, 0.911380291f},
-std::array<float,2>{0.405866176f, 0.0758703426f},
-std::array<float,2>{0.535640776f, 0.180521846f},
-std::array<float,2>{0.262492627f, 0.840450823f},
-std::array<float,2>{0.924672902f, 0.714629591f},
-std::array<float,2>{0.00771162147f, 0.35495767f},
-std::array<float,2>{0.522938669f, 0.3729873f},
-std::array<float,2>{0.281347156f, 0.701538026f},
-std::array<float,2>{0.876500964f, 0.827605247f},
-std::array<float,2>{0.0385925137f, 0.16331242f},
-std::array<float,2>{0.752583146f, 0.0817677677f},
-std::array<float,2>{0.246589676f, 0.934767187f},
-std::array<float,2>{0.745794833f, 0.612438977f},
-std::array<float,2>{0.418523639f, 0.455058932f},
-std::array<float,2>{0.958116651f, 0.386286229f},
-std::array<float,2>{0.0853951052f, 0.550748169f},
-std::array<float,2>{0.571527064f, 0.951947212f},
-std::array<float,2>{0.364338875f, 0.0623139217f},
-std::array<float,2>{0.627809823f, 0.197770342f},
-std::array<float,2>{0.445799142f, 0.811189651f},
-std::array<float,2>{0.819592714f, 0.628950596f},
-std::array<float,2>{0.151944891f, 0.266330153f},
-std::array<float,2>{0.690097868f, 0.489518791f},
-std::array<float,2>{0.380257428f, 0.57423228f},
-std::array<float,2>{0.801125765f, 0.877604246f},
-std::array<float,2>{0.187681034f, 0.115389079f},
-std::array<float,2>{0.917752802f, 0.148428723f},
-std::array<float,2>{0.0175671317f, 0.871521354f},
-std::array<float,2>{0.557596266f, 0.731367528f},
-std::array<float,2>{0.26874274f, 0.314517498f},
-std::array<float,2>{0.846883774f, 0.295341194f},
-std::array<float,2>{0.169779152f, 0.661676407f},
-std::array<float,2>{0.679713249f, 0.757942319f},
-std::array<float,2>{0.477727324f, 0.222501934f},
-std::array<float,2>{0.6158005f, 0.012692593f},
-std::array<float,2>{0.338718086f, 0.98596555f},
-std::array<float,2>{0.978028774f, 0.529720008f},
-std::array<float,2>{0.108158737f, 0.415075958f},
-std::array<float,2>{0.551630735f, 0.464617997f},
-std::array<float,2>{0.279510617f, 0.619745612f},
-std::array<float,2>{0.909483254f, 0.92660135f},
-std::array<float,2>{0.0311074406f, 0.0870004669f},
-std::array<float,2>{0.811869025f, 0.167825803f},
-std::array<float,2>{0.195355564f, 0.818172693f},
-std::array<float,2>{0.696559668f, 0.694032013f},
-std::array<float,2>{0.382875353f, 0.365829974f},
-std::array<float,2>{0.975188315f, 0.276513994f},
-std::array<float,2>{0.0965365618f, 0.637435138f},
-std::array<float,2>{0.624821305f, 0.802841544f},
-std::array<float,2>{0.328881025f, 0.188454509f},
-std::array<float,2>{0.674934387f, 0.0493053235f},
-std::array<float,2>{0.470491171f, 0.939627051f},
-std::array<float,2>{0.859140694f, 0.560997307f},
-std::array<float,2>{0.161837623f, 0.379298896f},
-std::array<float,2>{0.735440791f, 0.323328942f},
-std::array<float,2>{0.413839966f, 0.722790539f},
-std::array<float,2>{0.764011562f, 0.864937305f},
-std::array<float,2>{0.241936609f, 0.148668855f},
-std::array<float,2>{0.890390933f, 0.121824339f},
-std::array<float,2>{0.0453661978f, 0.885407567f},
-std::array<float,2>{0.525143325f, 0.565682113f},
-std::array<float,2>{0.296744436f, 0.496466577f},
-std::array<float,2>{0.826225221f, 0.410978228f},
-std::array<float,2>{0.143995881f, 0.516833305f},
-std::array<float,2>{0.636479855f, 0.998356104f},
-std::array<float,2>{0.444413036f, 0.00270190137f},
-std::array<float,2>{0.563189983f, 0.227280989f},
-std::array<float,2>{0.368372947f, 0.755414903f},
-std::array<float,2>{0.963654459f, 0.667713702f},
-std::array<float,2>{0.0865402669f, 0.286986619f},
-std::array<float,2>{0.606292248f, 0.311884016f},
-std::array<float,2>{0.318631738f, 0.687098086f},
-std::array<float,2>{0.989470899f, 0.773754835f},
-std::array<float,2>{0.119556241f, 0.247886673f},
-std::array<float,2>{0.859758019f, 0.0192187913f},
-std::array<float,2>{0.18256411f, 0.97343272f},
-std::array<float,2>{0.662807047f, 0.502304673f},
-std::array<float,2>{0.488138616f, 0.432242453f},
-std::array<float,2>{0.936836958f, 0.474717289f},
-std::array<float,2>{0.0118523613f, 0.587301373f},
-std::array<float,2>{0.54464972f, 0.89327383f},
-std::array<float,2>{0.256912112f, 0.103701256f},
-std::array<float,2>{0.709662914f, 0.140576839f},
-std::array<float,2>{0.394809335f, 0.847840011f},
-std::array<float,2>{0.790586174f, 0.744341731f},
-std::array<float,2>{0.216369689f, 0.343531132f},
-std::array<float,2>{0.648327768f, 0.399069697f},
-std::array<float,2>{0.455290228f, 0.535153389f},
-std::array<float,2>{0.841497719f, 0.965966702f},
-std::array<float,2>{0.127135515f, 0.0386944786f},
-std::array<float,2>{0.946735322f, 0.204086289f},
-std::array<float,2>{0.0729176626f, 0.784701586f},
-std::array<float,2>{0.591692507f, 0.649978459f},
-std::array<float,2>{0.350243121f, 0.261473835f},
-std::array<float,2>{0.780507922f, 0.344661236f},
-std::array<float,2>{0.230313152f, 0.707972825f},
-std::array<float,2>{0.729156911f, 0.834919691f},
-std::array<float,2>{0.422312111f, 0.17504555f},
-std::array<float,2>{0.514219284f, 0.0702987686f},
-std::array<float,2>{0.303747684f, 0.915202141f},
-std::array<float,2>{0.89110899f, 0.597304106f},
-std::array<float,2>{0.0491167977f, 0.443156004f},
-std::array<float,2>{0.553366482f, 0.378937989f},
-std::array<float,2>{0.27846688f, 0.560561895f},
-std::array<float,2>{0.906920254f, 0.939756632f},
-std::array<float,2>{0.029223524f, 0.0488926582f},
-std::array<float,2>{0.809262156f, 0.188220814f},
-std::array<float,2>{0.198326901f, 0.803001106f},
-std::array<float,2>{0.698120296f, 0.637638509f},
-std::array<float,2>{0.386531085f, 0.276635736f},
-std::array<float,2>{0.972838104f, 0.366146863f},
-std::array<float,2>{0.0942481756f, 0.694217443f},
-std::array<float,2>{0.621317387f, 0.817956209f},
-std::array<float,2>{0.331896693f, 0.167490676f},
-std::array<float,2>{0.673586845f, 0.0871817991f},
-std::array<float,2>{0.472372591f, 0.926499367f},
-std::array<float,2>{0.856604993f, 0.61987716f},
-std::array<float,2>{0.163469777f, 0.464401543f},
-std::array<float,2>{0.736489296f, 0.286794305f},
-std::array<float,2>{0.410546184f, 0.66793108f},
-std::array<float,2>{0.762239039f, 0.75563693f},
-std::array<float,2>{0.239671752f, 0.227519542f},
-std::array<float,2>{0.888593853f, 0.00251139887f},
-std::array<float,2>{0.0436933674f, 0.998214364f},
-std::array<float,2>{0.526368082f, 0.517074406f},
-std::array<float,2>{0.293968529f, 0.410736084f},
-std::array<float,2>{0.825062513f, 0.49623552f},
-std::array<float,2>{0.14119339f, 0.565630138f},
-std::array<float,2>{0.634071589f, 0.88574028f},
-std::array<float,2>{0.442422658f, 0.122060105f},
-std::array<float,2>{0.566339254f, 0.148726165f},
-std::array<float,2>{0.369909734f, 0.865198672f},
-std::array<float,2>{0.961994112f, 0.722961009f},
-std::array<float,2>{0.0894200057f, 0.323626995f},
-std::array<float,2>{0.608346403f, 0.343423754f},
-std::array<float,2>{0.316503853f, 0.744580209f},
-std::array<float,2>{0.991033614f, 0.848109365f},
-std::array<float,2>{0.117613308f, 0.140259907f},
-std::array<float,2>{0.861427426f, 0.103807151f},
-std::array<float,2>{0.180304661f, 0.893440425f},
-std::array<float,2>{0.660837531f, 0.587156951f},
-std::array<float,2>{0.485882193f, 0.474972695f},
-std::array<float,2>{0.934122622f, 0.432488531f},
-std::array<float,2>{0.0138755646f, 0.50195682f},
-std::array<float,2>{0.546194792f, 0.973304749f},
-std::array<float,2>{0.254056185f, 0.0193205718f},
-std::array<float,2>{0.707629323f, 0.247734696f},
-std::array<float,2>{0.398105323f, 0.773541152f},
-std::array<float,2>{0.792799115f, 0.687271655f},
-std::array<float,2>{0.217689931f, 0.311578304f},
-std::array<float,2>{0.645638347f, 0.442916691f},
-std::array<float,2>{0.454238236f, 0.597457945f},
-std::array<float,2>{0.842777729f, 0.915476203f},
-std::array<float,2>{0.125446275f, 0.0699057803f},
-std::array<float,2>{0.948008478f, 0.175128922f},
-std::array<float,2>{0.0716496855f, 0.834683955f},
-std::array<float,2>{0.59323144f, 0.707596183f},
-std::array<float,2>{0.348793596f, 0.344243735f},
-std::array<float,2>{0.778125942f, 0.261567563f},
-std::array<float,2>{0.227370769f, 0.650183558f},
-std::array<float,2>{0.72776252f, 0.785023451f},
-std::array<float,2>{0.425354481f, 0.203773096f},
-std::array<float,2>{0.512553155f, 0.0388204195f},
-std::array<float,2>{0.301701039f, 0.966198325f},
-std::array<float,2>{0.89448303f, 0.534673691f},
-std::array<float,2>{0.0483179502f, 0.399370074f},
-std::array<float,2>{0.58387208f, 0.482967556f},
-std::array<float,2>{0.356447458f, 0.583096921f},
-std::array<float,2>{0.942301035f, 0.898911655f},
-std::array<float,2>{0.0675286576f, 0.0964425802f},
-std::array<float,2>{0.833792031f, 0.130393907f},
-std::array<float,2>{0.134295151f, 0.8541677f},
-std::array<float,2>{0.649359524f, 0.734434605f},
-std::array<float,2>{0.461152583f, 0.333030105f},
-std::array<float,2>{0.899266124f, 0.298792124f},
-std::array<float,2>{0.0602142066f, 0.677746296f},
-std::array<float,2>{0.503005147f, 0.76595372f},
-std::array<float,2>{0.307819337f, 0.241304994f},
-std::array<float,2>{0.720606506f, 0.0265599098f},
-std::array<float,2>{0.434178144f, 0.982254505f},
-std::array<float,2>{0.772036791f, 0.510974646f},
-std::array<float,2>{0.219939291f, 0.427874446f},
-std::array<float,2>{0.665737927f, 0.354656696f},
-std::array<float,2>{0.492308587f, 0.714538932f},
-std::array<float,2>{0.872158825f, 0.840652287f},
-std::array<float,2>{0.174877092f, 0.180311665f},
-std::array<float,2>{0.996228039f, 0.0761708468f},
-std::array<float,2>{0.114947245f, 0.91125989f},
-std::array<float,2>{0.595610917f, 0.603034079f},
-std::array<float,2>{0.327030629f, 0.449227214f},
-std::array<float,2>{0.787753284f, 0.398103297f},
-std::array<float,2>{0.210138693f, 0.545352399f},
-std::array<float,2>{0.711396039f, 0.955547214f},
-std::array<float,2>{0.402928621f, 0.0414791033f},
-std::array<float,2>{0.538583934f, 0.214708388f},
-std::array<float,2>{0.264047384f, 0.792102277f},
-std::array<float,2>{0.922873735f, 0.641840458f},
-std::array<float,2>{0.00392210158f, 0.252173394f},
-std::array<float,2>{0.519895971f, 0.266584098f},
-std::array<float,2>{0.284312427f, 0.629285038f},
-std::array<float,2>{0.877883732f, 0.811359048f},
-std::array<float,2>{0.035659194f, 0.198226631f},
-std::array<float,2>{0.75026685f, 0.0622059479f},
-std::array<float,2>{0.248375699f, 0.95181787f},
-std::array<float,2>{0.742383182f, 0.550385892f},
-std::array<float,2>{0.421223223f, 0.386581987f},
-std::array<float,2>{0.960701883f, 0.454656392f},
-std::array<float,2>{0.0824613944f, 0.612702727f},
-std::array<float,2>{0.572908461f, 0.935029447f},
-std::array<float,2>{0.365244091f, 0.0817887634f},
-std::array<float,2>{0.626332223f, 0.163528517f},
-std::array<float,2>{0.448970467f, 0.827313185f},
-std::array<float,2>{0.817016184f, 0.701194227f},
-std::array<float,2>{0.148866326f, 0.372772902f},
-std::array<float,2>{0.688412666f, 0.415323555f},
-std::array<float,2>{0.381106913f, 0.529506445f},
-std::array<float,2>{0.80394882f, 0.986240327f},
-std::array<float,2>{0.191192031f, 0.0123793781f},
-std::array<float,2>{0.914095879f, 0.222310066f},
-std::array<float,2>{0.0194272157f, 0.758122265f},
-std::array<float,2>{0.556451261f, 0.662107408f},
-std::array<float,2>{0.266831279f, 0.295092493f},
-std::array<float,2>{0.845106423f, 0.314916342f},
-std::array<float,2>{0.170013219f, 0.730980933f},
-std::array<float,2>{0.682649791f, 0.871304989f},
-std::array<float,2>{0.479876459f, 0.14802146f},
-std::array<float,2>{0.614264786f, 0.115576036f},
-std::array<float,2>{0.337527484f, 0.877736866f},
-std::array<float,2>{0.979737461f, 0.574483097f},
-std::array<float,2>{0.107231662f, 0.489448249f},
-std::array<float,2>{0.620885789f, 0.422978938f},
-std::array<float,2>{0.332932025f, 0.514847994f},
-std::array<float,2>{0.970092535f, 0.98042953f},
-std::array<float,2>{0.100237988f, 0.027387064f},
-std::array<float,2>{0.852840602f, 0.236987397f},
-std::array<float,2>{0.158082977f, 0.771579146f},
-std::array<float,2>{0.679323792f, 0.675622702f},
-std::array<float,2>{0.475469679f, 0.302162528f},
-std::array<float,2>{0.911544681f, 0.328300595f},
-std::array<float,2>{0.0256451927f, 0.741351545f},
-std::array<float,2>{0.546878457f, 0.855907679f},
-std::array<float,2>{0.275739491f, 0.125500888f},
-std::array<float,2>{0.702840447f, 0.097690478f},
-std::array<float,2>{0.389241099f, 0.905349553f},
-std::array<float,2>{0.808238268f, 0.581481934f},
-std::array<float,2>{0.201764598f, 0.478775412f},
-std::array<float,2>{0.63778013f, 0.256092191f},
-std::array<float,2>{0.439235806f, 0.646008253f},
-std::array<float,2>{0.82340014f, 0.793745041f},
-std::array<float,2>{0.148406342f, 0.215400636f},
-std::array<float,2>{0.966831386f, 0.0451358184f},
-std::array<float,2>{0.0901441276f, 0.958159685f},
-std::array<float,2>{0.568188071f, 0.540209353f},
-std::array<float,2>{0.374635458f, 0.394124597f},
-std::array<float,2>{0.758581877f, 0.448040843f},
-std::array<float,2>{0.234700993f, 0.606713593f},
-std::array<float,2>{0.740875781f, 0.909382105f},
-std::array<float,2>{0.409319907f, 0.0708453357f},
-std::array<float,2>{0.529517293f, 0.184626609f},
-std::array<float,2>{0.289596289f, 0.838463783f},
-std::array<float,2>{0.883590698f, 0.716412127f},
-std::array<float,2>{0.0403045528f, 0.358382583f},
-std::array<float,2>{0.5412907f, 0.370648861f},
-std::array<float,2>{0.253215939f, 0.697967291f},
-std::array<float,2>{0.930311143f, 0.820914209f},
-std::array<float,2>{0.0106957043f, 0.156644359f},
-std::array<float,2>{0.794584334f, 0.082243517f},
-std::array<float,2>{0.211699679f, 0.931867123f},
-std::array<float,2>{0.706527114f, 0.616390586f},
-std::array<float,2>{0.391723245f, 0.459454298f},
-std::array<float,2>{0.986391842f, 0.389893204f},
-std::array<float,2>{0.122789919f, 0.554297626f},
-std::array<float,2>{0.602228224f, 0.94661051f},
-std::array<float,2>{0.314130396f, 0.0550883487f},
-std::array<float,2>{0.65910989f, 0.201964691f},
-std::array<float,2>{0.489253104f, 0.808250666f},
-std::array<float,2>{0.865484595f, 0.626851976f},
-std::array<float,2>{0.18394886f, 0.273106515f},
-std::array<float,2>{0.731092691f, 0.484521538f},
-std::array<float,2>{0.429368883f, 0.571158707f},
-std::array<float,2>{0.775987804f, 0.881434321f},
-std::array<float,2>{0.230982631f, 0.111978807f},
-std::array<float,2>{0.89628613f, 0.142436162f},
-std::array<float,2>{0.0520161279f, 0.869039178f},
-std::array<float,2>{0.508079171f, 0.726662755f},
-std::array<float,2>{0.299748629f, 0.320253372f},
-std::array<float,2>{0.839213908f, 0.292635262f},
-std::array<float,2>{0.130135298f, 0.658611f},
-std::array<float,2>{0.641929865f, 0.761783779f},
-std::array<float,2>{0.457716465f, 0.224753499f},
-std::array<float,2>{0.589473128f, 0.00823620707f},
-std::array<float,2>{0.344190955f, 0.991886139f},
-std::array<float,2>{0.950564265f, 0.524493992f},
-std::array<float,2>{0.0762327909f, 0.419630677f},
-std::array<float,2>{0.50510937f, 0.468327671f},
-std::array<float,2>{0.312009037f, 0.624422312f},
-std::array<float,2>{0.90322423f, 0.923288107f},
-std::array<float,2>{0.0555105545f, 0.0904771015f},
-std::array<float,2>{0.769084513f, 0.168225557f},
-std::array<float,2>{0.226176336f, 0.814943373f},
-std::array<float,2>{0.72300303f, 0.690723181f},
-std::array<float,2>{0.430542171f, 0.359778166f},
-std::array<float,2>{0.940002024f, 0.280009329f},
-std::array<float,2>{0.0634307116f, 0.636331916f},
-std::array<float,2>{0.581621051f, 0.799501002f},
-std::array<float,2>{0.353776306f, 0.195187777f},
-std::array<float,2>{0.653247714f, 0.0535750054f},
-std::array<float,2>{0.465065002f, 0.944695711f},
-std::array<float,2>{0.829051316f, 0.554727614f},
-std::array<float,2>{0.1395358f, 0.378157884f},
-std::array<float,2>{0.71659869f, 0.325377256f},
-std::array<float,2>{0.402289063f, 0.720606267f},
-std::array<float,2>{0.783870935f, 0.860582888f},
-std::array<float,2>{0.203790337f, 0.154297352f},
-std::array<float,2>{0.929332733f, 0.117573425f},
-std::array<float,2>{0.000639631297f, 0.890019536f},
-std::array<float,2>{0.534754515f, 0.567018092f},
-std::array<float,2>{0.261030346f, 0.494115293f},
-std::array<float,2>{0.870428801f, 0.40931052f},
-std::array<float,2>{0.179140642f, 0.520183623f},
-std::array<float,2>{0.670833468f, 0.992860317f},
-std::array<float,2>{0.499975562f, 0.00546711637f},
-std::array<float,2>{0.597844005f, 0.231518283f},
-std::array<float,2>{0.323408753f, 0.752485156f},
-std::array<float,2>{0.992712379f, 0.671103776f},
-std::array<float,2>{0.111408964f, 0.281571627f},
-std::array<float,2>{0.575133085f, 0.308547139f},
-std::array<float,2>{0.359817207f, 0.681981742f},
-std::array<float,2>{0.955649257f, 0.779586136f},
-std::array<float,2>{0.080441393f, 0.244856656f},
-std::array<float,2>{0.815858662f, 0.0223180838f},
-std::array<float,2>{0.154079169f, 0.969926178f},
-std::array<float,2>{0.631966829f, 0.505276978f},
-std::array<float,2>{0.451446652f, 0.436223f},
-std::array<float,2>{0.880308807f, 0.469192475f},
-std::array<float,2>{0.0329993553f, 0.593335569f},
-std::array<float,2>{0.517828405f, 0.895162702f},
-std::array<float,2>{0.287509918f, 0.106668182f},
-std::array<float,2>{0.749219716f, 0.135268837f},
-std::array<float,2>{0.41488272f, 0.847508788f},
-std::array<float,2>{0.757293701f, 0.747705579f},
-std::array<float,2>{0.243086085f, 0.337405205f},
-std::array<float,2>{0.685848534f, 0.403729618f},
-std::array<float,2>{0.480574757f, 0.538653255f},
-std::array<float,2>{0.848096311f, 0.961889029f},
-std::array<float,2>{0.164422661f, 0.0343426131f},
-std::array<float,2>{0.981054008f, 0.207472354f},
-std::array<float,2>{0.104812466f, 0.785950303f},
-std::array<float,2>{0.611002207f, 0.65315932f},
-std::array<float,2>{0.33995387f, 0.264333129f},
-std::array<float,2>{0.79826653f, 0.348142296f},
-std::array<float,2>{0.194335356f, 0.706103206f},
-std::array<float,2>{0.692709267f, 0.828604579f},
-std::array<float,2>{0.3781299f, 0.176742435f},
-std::array<float,2>{0.561938465f, 0.0628183857f},
-std::array<float,2>{0.272829056f, 0.919876158f},
-std::array<float,2>{0.921809256f, 0.597680867f},
-std::array<float,2>{0.0224398226f, 0.441119194f},
-std::array<float,2>{0.523983896f, 0.413521618f},
-std::array<float,2>{0.295872271f, 0.518799901f},
-std::array<float,2>{0.889181137f, 0.997346759f},
-std::array<float,2>{0.0465109758f, 0.00180859317f},
-std::array<float,2>{0.765564442f, 0.228716075f},
-std::array<float,2>{0.241204217f, 0.757579684f},
-std::array<float,2>{0.73513937f, 0.665926635f},
-std::array<float,2>{0.412469566f, 0.287487447f},
-std::array<float,2>{0.964042127f, 0.321328253f},
-std::array<float,2>{0.0869695172f, 0.724849284f},
-std::array<float,2>{0.564001918f, 0.865561724f},
-std::array<float,2>{0.368157327f, 0.150942653f},
-std::array<float,2>{0.635005534f, 0.124717236f},
-std::array<float,2>{0.444064409f, 0.884717107f},
-std::array<float,2>{0.827220798f, 0.564219773f},
-std::array<float,2>{0.143001109f, 0.499999076f},
-std::array<float,2>{0.695666492f, 0.273876637f},
-std::array<float,2>{0.383888185f, 0.639430523f},
-std::array<float,2>{0.81144619f, 0.802183747f},
-std::array<float,2>{0.196324617f, 0.19046241f},
-std::array<float,2>{0.908490479f, 0.0486258455f},
-std::array<float,2>{0.0295124147f, 0.937567592f},
-std::array<float,2>{0.552662373f, 0.559202194f},
-std::array<float,2>{0.280884415f, 0.381253004f},
-std::array<float,2>{0.857863843f, 0.461743146f},
-std::array<float,2>{0.160386905f, 0.617886424f},
-std::array<float,2>{0.674573839f, 0.928093553f},
-std::array<float,2>{0.469584942f, 0.088953808f},
-std::array<float,2>{0.623111963f, 0.16598317f},
-std::array<float,2>{0.329659611f, 0.818822622f},
-std::array<float,2>{0.976352036f, 0.69288367f},
-std::array<float,2>{0.0968241841f, 0.364491612f},
-std::array<float,2>{0.589967847f, 0.346895665f},
-std::array<float,2>{0.350980639f, 0.70976758f},
-std::array<float,2>{0.945714951f, 0.83280766f},
-std::array<float,2>{0.073823832f, 0.172427088f},
-std::array<float,2>{0.840440392f, 0.0679365769f},
-std::array<float,2>{0.12820214f, 0.917373419f},
-std::array<float,2>{0.6465711f, 0.595154643f},
-std::array<float,2>{0.456389368f, 0.444914132f},
-std::array<float,2>{0.892387867f, 0.401602834f},
-std::array<float,2>{0.049936045f, 0.532113254f},
-std::array<float,2>{0.515115857f, 0.967826784f},
-std::array<float,2>{0.303252399f, 0.0370111987f},
-std::array<float,2>{0.730357707f, 0.205141097f},
-std::array<float,2>{0.42359218f, 0.78154701f},
-std::array<float,2>{0.779781938f, 0.652258575f},
-std::array<float,2>{0.229181617f, 0.259121597f},
-std::array<float,2>{0.663352668f, 0.472739577f},
-std::array<float,2>{0.486476064f, 0.588334918f},
-std::array<float,2>{0.860395968f, 0.891473591f},
-std::array<float,2>{0.183042318f, 0.101601906f},
-std::array<float,2>{0.98857075f, 0.137264624f},
-std::array<float,2>{0.120350376f, 0.85111022f},
-std::array<float,2>{0.607151866f, 0.743031979f},
-std::array<float,2>{0.320142835f, 0.341016442f},
-std::array<float,2>{0.789708018f, 0.310362309f},
-std::array<float,2>{0.215679437f, 0.684009135f},
-std::array<float,2>{0.710360408f, 0.776238322f},
-std::array<float,2>{0.396024436f, 0.249070838f},
-std::array<float,2>{0.543614149f, 0.015711559f},
-std::array<float,2>{0.256354004f, 0.976335943f},
-std::array<float,2>{0.936090052f, 0.500895977f},
-std::array<float,2>{0.0129239755f, 0.430682778f},
-std::array<float,2>{0.597047746f, 0.452774942f},
-std::array<float,2>{0.324745804f, 0.604685068f},
-std::array<float,2>{0.998284101f, 0.912129343f},
-std::array<float,2>{0.116731599f, 0.0768838674f},
-std::array<float,2>{0.874319434f, 0.182820112f},
-std::array<float,2>{0.17292951f, 0.842812419f},
-std::array<float,2>{0.667872727f, 0.711485744f},
-std::array<float,2>{0.49543342f, 0.353366435f},
-std::array<float,2>{0.925662398f, 0.251445085f},
-std::array<float,2>{0.00588333048f, 0.642687082f},
-std::array<float,2>{0.536531746f, 0.789925516f},
-std::array<float,2>{0.262836784f, 0.211633891f},
-std::array<float,2>{0.713643789f, 0.0397953428f},
-std::array<float,2>{0.404864162f, 0.954616308f},
-std::array<float,2>{0.786641121f, 0.544633567f},
-std::array<float,2>{0.208187103f, 0.394865096f},
-std::array<float,2>{0.651480556f, 0.335265696f},
-std::array<float,2>{0.463066071f, 0.738164306f},
-std::array<float,2>{0.835575223f, 0.853334963f},
-std::array<float,2>{0.135186315f, 0.132409081f},
-std::array<float,2>{0.945164084f, 0.0955192f},
-std::array<float,2>{0.0692182854f, 0.901985824f},
-std::array<float,2>{0.58462584f, 0.584561586f},
-std::array<float,2>{0.358159482f, 0.482204139f},
-std::array<float,2>{0.770627558f, 0.427408695f},
-std::array<float,2>{0.220935717f, 0.508608997f},
-std::array<float,2>{0.72112751f, 0.983275712f},
-std::array<float,2>{0.437318236f, 0.0251721237f},
-std::array<float,2>{0.500557184f, 0.240035996f},
-std::array<float,2>{0.304744661f, 0.767969012f},
-std::array<float,2>{0.901891351f, 0.67646867f},
-std::array<float,2>{0.0617303178f, 0.300581098f},
-std::array<float,2>{0.558117151f, 0.293233484f},
-std::array<float,2>{0.268538415f, 0.663609564f},
-std::array<float,2>{0.916753173f, 0.760545373f},
-std::array<float,2>{0.015730761f, 0.219469279f},
-std::array<float,2>{0.802397013f, 0.0153273651f},
-std::array<float,2>{0.189365536f, 0.986994982f},
-std::array<float,2>{0.691301763f, 0.528022826f},
-std::array<float,2>{0.379129499f, 0.417067379f},
-std::array<float,2>{0.977147996f, 0.49076283f},
-std::array<float,2>{0.108422428f, 0.577743173f},
-std::array<float,2>{0.616978109f, 0.876924872f},
-std::array<float,2>{0.339070618f, 0.114779882f},
-std::array<float,2>{0.681353748f, 0.145592332f},
-std::array<float,2>{0.476618558f, 0.873054028f},
-std::array<float,2>{0.846483409f, 0.734333992f},
-std::array<float,2>{0.168252468f, 0.312786967f},
-std::array<float,2>{0.744738579f, 0.383267105f},
-std::array<float,2>{0.419689715f, 0.548131526f},
-std::array<float,2>{0.753345728f, 0.94992584f},
-std::array<float,2>{0.247416899f, 0.0591012649f},
-std::array<float,2>{0.875758052f, 0.196277156f},
-std::array<float,2>{0.0374729112f, 0.809876084f},
-std::array<float,2>{0.521671712f, 0.631722927f},
-std::array<float,2>{0.282357037f, 0.268577099f},
-std::array<float,2>{0.818889976f, 0.373590022f},
-std::array<float,2>{0.151078165f, 0.700430334f},
-std::array<float,2>{0.62798667f, 0.825519085f},
-std::array<float,2>{0.446523041f, 0.161400035f},
-std::array<float,2>{0.570769608f, 0.0793834254f},
-std::array<float,2>{0.364002019f, 0.937368691f},
-std::array<float,2>{0.957739294f, 0.610814214f},
-std::array<float,2>{0.0843946785f, 0.455828398f},
-std::array<float,2>{0.568693459f, 0.392133057f},
-std::array<float,2>{0.372956812f, 0.542280018f},
-std::array<float,2>{0.965757072f, 0.960320592f},
-std::array<float,2>{0.0931502879f, 0.044716768f},
-std::array<float,2>{0.821445584f, 0.218316332f},
-std::array<float,2>{0.146240324f, 0.795945525f},
-std::array<float,2>{0.6392892f, 0.646823347f},
-std::array<float,2>{0.440894455f, 0.254987061f},
-std::array<float,2>{0.886181176f, 0.356127352f},
-std::array<float,2>{0.0421099626f, 0.717133582f},
-std::array<float,2>{0.528988779f, 0.837637722f},
-std::array<float,2>{0.291917771f, 0.187293857f},
-std::array<float,2>{0.738939643f, 0.0724376589f},
-std::array<float,2>{0.40723899f, 0.908025026f},
-std::array<float,2>{0.761710465f, 0.608191669f},
-std::array<float,2>{0.236834466f, 0.445635557f},
-std::array<float,2>{0.67741549f, 0.304017544f},
-std::array<float,2>{0.47435981f, 0.673755884f},
-std::array<float,2>{0.85443747f, 0.770752668f},
-std::array<float,2>{0.158885807f, 0.235658646f},
-std::array<float,2>{0.971724749f, 0.029480515f},
-std::array<float,2>{0.0990935341f, 0.977100015f},
-std::array<float,2>{0.617385328f, 0.512655675f},
-std::array<float,2>{0.334053487f, 0.424374312f},
-std::array<float,2>{0.805425107f, 0.47738111f},
-std::array<float,2>{0.199293822f, 0.578641295f},
-std::array<float,2>{0.69984138f, 0.904167473f},
-std::array<float,2>{0.388324887f, 0.101383977f},
-std::array<float,2>{0.549367607f, 0.127208039f},
-std::array<float,2>{0.273705512f, 0.858899117f},
-std::array<float,2>{0.913982332f, 0.738836825f},
-std::array<float,2>{0.0251487829f, 0.33079204f},
-std::array<float,2>{0.509901822f, 0.317539155f},
-std::array<float,2>{0.298490971f, 0.730402887f},
-std::array<float,2>{0.898081064f, 0.869767725f},
-std::array<float,2>{0.0536486469f, 0.143597439f},
-std::array<float,2>{0.774073482f, 0.110211849f},
-std::array<float,2>{0.23384276f, 0.879569709f},
-std::array<float,2>{0.73435092f, 0.573467433f},
-std::array<float,2>{0.427595347f, 0.486892462f},
-std::array<float,2>{0.951187134f, 0.42090404f},
-std::array<float,2>{0.0745066702f, 0.526542962f},
-std::array<float,2>{0.586385071f, 0.988563418f},
-std::array<float,2>{0.347179979f, 0.0103441859f},
-std::array<float,2>{0.644268513f, 0.222749785f},
-std::array<float,2>{0.459804893f, 0.764194965f},
-std::array<float,2>{0.83765018f, 0.658045888f},
-std::array<float,2>{0.131346494f, 0.289807379f},
-std::array<float,2>{0.703323781f, 0.457443535f},
-std::array<float,2>{0.392741323f, 0.615017295f},
-std::array<float,2>{0.796846211f, 0.93053174f},
-std::array<float,2>{0.214375362f, 0.0859277248f},
-std::array<float,2>{0.932044625f, 0.158621445f},
-std::array<float,2>{0.0090507362f, 0.823195219f},
-std::array<float,2>{0.540036082f, 0.696479499f},
-std::array<float,2>{0.250140995f, 0.368377686f},
-std::array<float,2>{0.865038574f, 0.271432936f},
-std::array<float,2>{0.186112389f, 0.62726289f},
-std::array<float,2>{0.657151401f, 0.805906177f},
-std::array<float,2>{0.49092105f, 0.199397877f},
-std::array<float,2>{0.605172217f, 0.0573113635f},
-std::array<float,2>{0.315907031f, 0.947561443f},
-std::array<float,2>{0.984901547f, 0.552107155f},
-std::array<float,2>{0.124442086f, 0.388371289f},
-std::array<float,2>{0.53225559f, 0.494501799f},
-std::array<float,2>{0.258401453f, 0.56896317f},
-std::array<float,2>{0.927503109f, 0.887722194f},
-std::array<float,2>{0.00263050827f, 0.120518498f},
-std::array<float,2>{0.782683432f, 0.153341591f},
-std::array<float,2>{0.206950113f, 0.861683786f},
-std::array<float,2>{0.717297971f, 0.720816553f},
-std::array<float,2>{0.399329215f, 0.326322794f},
-std::array<float,2>{0.995658457f, 0.283897698f},
-std::array<float,2>{0.109376349f, 0.669358909f},
-std::array<float,2>{0.600047648f, 0.751132071f},
-std::array<float,2>{0.320745826f, 0.233565778f},
-std::array<float,2>{0.669689417f, 0.00629341416f},
-std::array<float,2>{0.497449279f, 0.994863331f},
-std::array<float,2>{0.868542969f, 0.521751881f},
-std::array<float,2>{0.17588833f, 0.40636614f},
-std::array<float,2>{0.726285696f, 0.363125145f},
-std::array<float,2>{0.431820124f, 0.687551498f},
-std::array<float,2>{0.765918672f, 0.813242137f},
-std::array<float,2>{0.224394977f, 0.169984743f},
-std::array<float,2>{0.904521286f, 0.0925184041f},
-std::array<float,2>{0.0578997806f, 0.924779534f},
-std::array<float,2>{0.507585049f, 0.621261239f},
-std::array<float,2>{0.309350163f, 0.465273768f},
-std::array<float,2>{0.830251217f, 0.376921475f},
-std::array<float,2>{0.137170091f, 0.557813823f},
-std::array<float,2>{0.654439628f, 0.941987097f},
-std::array<float,2>{0.468599528f, 0.0510582253f},
-std::array<float,2>{0.578537464f, 0.191972196f},
-std::array<float,2>{0.352728218f, 0.79780072f},
-std::array<float,2>{0.939093173f, 0.634390414f},
-std::array<float,2>{0.0650153831f, 0.279259324f},
-std::array<float,2>{0.612553298f, 0.263017833f},
-std::array<float,2>{0.34346059f, 0.655612409f},
-std::array<float,2>{0.983492434f, 0.787630379f},
-std::array<float,2>{0.102467194f, 0.21081008f},
-std::array<float,2>{0.850676358f, 0.0319567174f},
-std::array<float,2>{0.167261794f, 0.963678062f},
-std::array<float,2>{0.685391784f, 0.53535676f},
-std::array<float,2>{0.483502358f, 0.405383289f},
-std::array<float,2>{0.91810143f, 0.437835902f},
-std::array<float,2>{0.0198120736f, 0.599759221f},
-std::array<float,2>{0.55953896f, 0.921032548f},
-std::array<float,2>{0.269597888f, 0.064606227f},
-std::array<float,2>{0.693483829f, 0.17847006f},
-std::array<float,2>{0.375489324f, 0.831056535f},
-std::array<float,2>{0.799163163f, 0.704668641f},
-std::array<float,2>{0.192838281f, 0.350144446f},
-std::array<float,2>{0.630206168f, 0.434370667f},
-std::array<float,2>{0.449630886f, 0.506977737f},
-std::array<float,2>{0.812903881f, 0.972203195f},
-std::array<float,2>{0.154816449f, 0.0204544924f},
-std::array<float,2>{0.953714967f, 0.24335964f},
-std::array<float,2>{0.07879439f, 0.777446628f},
-std::array<float,2>{0.577144504f, 0.680485785f},
-std::array<float,2>{0.361806482f, 0.306519985f},
-std::array<float,2>{0.754978955f, 0.339800507f},
-std::array<float,2>{0.244461745f, 0.749860823f},
-std::array<float,2>{0.746748865f, 0.845117331f},
-std::array<float,2>{0.416664362f, 0.134286478f},
-std::array<float,2>{0.516862929f, 0.108701698f},
-std::array<float,2>{0.286997825f, 0.897388935f},
-std::array<float,2>{0.881990016f, 0.5910393f},
-std::array<float,2>{0.0334081575f, 0.471766204f},
-std::array<float,2>{0.545779586f, 0.430639803f},
-std::array<float,2>{0.255362779f, 0.501227498f},
-std::array<float,2>{0.934885561f, 0.974824786f},
-std::array<float,2>{0.0155353863f, 0.016952537f},
-std::array<float,2>{0.791725338f, 0.248458266f},
-std::array<float,2>{0.218631193f, 0.776820123f},
-std::array<float,2>{0.708209872f, 0.685278654f},
-std::array<float,2>{0.396731853f, 0.30931285f},
-std::array<float,2>{0.991430759f, 0.340325803f},
-std::array<float,2>{0.118534841f, 0.743743122f},
-std::array<float,2>{0.608735085f, 0.849745393f},
-std::array<float,2>{0.31769976f, 0.138510436f},
-std::array<float,2>{0.661307991f, 0.103332408f},
-std::array<float,2>{0.484748989f, 0.891813815f},
-std::array<float,2>{0.862352252f, 0.589276433f},
-std::array<float,2>{0.181186125f, 0.4745965f},
-std::array<float,2>{0.727063119f, 0.258039623f},
-std::array<float,2>{0.424065679f, 0.651245296f},
-std::array<float,2>{0.779184997f, 0.782409191f},
-std::array<float,2>{0.227554828f, 0.20669663f},
-std::array<float,2>{0.892739356f, 0.0359021388f},
-std::array<float,2>{0.0470875986f, 0.967515945f},
-std::array<float,2>{0.513325393f, 0.532639027f},
-std::array<float,2>{0.302150488f, 0.40113759f},
-std::array<float,2>{0.842074573f, 0.444013834f},
-std::array<float,2>{0.126143157f, 0.594510674f},
-std::array<float,2>{0.645357907f, 0.916794538f},
-std::array<float,2>{0.453239053f, 0.0665556043f},
-std::array<float,2>{0.592245996f, 0.173752725f},
-std::array<float,2>{0.348158419f, 0.833499372f},
-std::array<float,2>{0.948446691f, 0.710680306f},
-std::array<float,2>{0.0705286339f, 0.346389353f},
-std::array<float,2>{0.62298286f, 0.363560081f},
-std::array<float,2>{0.331020385f, 0.692070246f},
-std::array<float,2>{0.974411964f, 0.8202703f},
-std::array<float,2>{0.0947915837f, 0.16450505f},
-std::array<float,2>{0.856412709f, 0.0885170996f},
-std::array<float,2>{0.162691161f, 0.928846836f},
-std::array<float,2>{0.672304988f, 0.618469417f},
-std::array<float,2>{0.470868468f, 0.462440223f},
-std::array<float,2>{0.907539904f, 0.382580936f},
-std::array<float,2>{0.0277377758f, 0.560258925f},
-std::array<float,2>{0.553983867f, 0.939233899f},
-std::array<float,2>{0.277989924f, 0.0474966988f},
-std::array<float,2>{0.699049175f, 0.189475477f},
-std::array<float,2>{0.385112971f, 0.801229954f},
-std::array<float,2>{0.810122907f, 0.640174329f},
-std::array<float,2>{0.197995275f, 0.274833769f},
-std::array<float,2>{0.632984042f, 0.498409837f},
-std::array<float,2>{0.441414654f, 0.562729537f},
-std::array<float,2>{0.82540381f, 0.883042216f},
-std::array<float,2>{0.141629487f, 0.123764142f},
-std::array<float,2>{0.96119225f, 0.151731685f},
-std::array<float,2>{0.0880249739f, 0.867164671f},
-std::array<float,2>{0.565066576f, 0.725768149f},
-std::array<float,2>{0.370827645f, 0.320492089f},
-std::array<float,2>{0.763101339f, 0.288654029f},
-std::array<float,2>{0.238821208f, 0.665021002f},
-std::array<float,2>{0.73776257f, 0.756445885f},
-std::array<float,2>{0.411301434f, 0.229570866f},
-std::array<float,2>{0.525917828f, 0.000799468369f},
-std::array<float,2>{0.293441892f, 0.996447504f},
-std::array<float,2>{0.88760972f, 0.518401384f},
-std::array<float,2>{0.0447304286f, 0.412671f},
-std::array<float,2>{0.573404372f, 0.456972808f},
-std::array<float,2>{0.366894066f, 0.609500468f},
-std::array<float,2>{0.959482491f, 0.936386704f},
-std::array<float,2>{0.0839105994f, 0.0787278861f},
-std::array<float,2>{0.81790483f, 0.161084726f},
-std::array<float,2>{0.149900764f, 0.824730814f},
-std::array<float,2>{0.625000596f, 0.699483335f},
-std::array<float,2>{0.447300255f, 0.374994725f},
-std::array<float,2>{0.878075361f, 0.267629594f},
-std::array<float,2>{0.037004862f, 0.632481337f},
-std::array<float,2>{0.521342099f, 0.808690548f},
-std::array<float,2>{0.283960342f, 0.197063327f},
-std::array<float,2>{0.743947506f, 0.0599585138f},
-std::array<float,2>{0.420533627f, 0.951171815f},
-std::array<float,2>{0.751817107f, 0.547562003f},
-std::array<float,2>{0.249384597f, 0.384113669f},
-std::array<float,2>{0.682312429f, 0.313894868f},
-std::array<float,2>{0.479075819f, 0.733040094f},
-std::array<float,2>{0.844050884f, 0.87436378f},
-std::array<float,2>{0.171452582f, 0.145160675f},
-std::array<float,2>{0.979425371f, 0.113722235f},
-std::array<float,2>{0.106174707f, 0.875441074f},
-std::array<float,2>{0.61329335f, 0.577024221f},
-std::array<float,2>{0.336702168f, 0.491779417f},
-std::array<float,2>{0.803472102f, 0.416515559f},
-std::array<float,2>{0.190133542f, 0.528581977f},
-std::array<float,2>{0.689204872f, 0.988144279f},
-std::array<float,2>{0.382538557f, 0.0139058447f},
-std::array<float,2>{0.555240154f, 0.220596895f},
-std::array<float,2>{0.265977085f, 0.761576176f},
-std::array<float,2>{0.915649652f, 0.662638307f},
-std::array<float,2>{0.0183594674f, 0.294190526f},
-std::array<float,2>{0.502818406f, 0.299354166f},
-std::array<float,2>{0.306657851f, 0.677399516f},
-std::array<float,2>{0.899971187f, 0.769290626f},
-std::array<float,2>{0.0593622364f, 0.238388836f},
-std::array<float,2>{0.773262084f, 0.0235097874f},
-std::array<float,2>{0.219183162f, 0.983562529f},
-std::array<float,2>{0.719052553f, 0.509664834f},
-std::array<float,2>{0.434691578f, 0.426042765f},
-std::array<float,2>{0.942831814f, 0.481171131f},
-std::array<float,2>{0.0670303628f, 0.585932612f},
-std::array<float,2>{0.582311749f, 0.900822639f},
-std::array<float,2>{0.355913848f, 0.0942187831f},
-std::array<float,2>{0.649832189f, 0.13163054f},
-std::array<float,2>{0.462549865f, 0.852261841f},
-std::array<float,2>{0.832079351f, 0.736744344f},
-std::array<float,2>{0.133661434f, 0.33487311f},
-std::array<float,2>{0.712262273f, 0.396318346f},
-std::array<float,2>{0.403493792f, 0.543929935f},
-std::array<float,2>{0.789012432f, 0.95381093f},
-std::array<float,2>{0.209406242f, 0.0403292999f},
-std::array<float,2>{0.922481f, 0.212799206f},
-std::array<float,2>{0.00518829422f, 0.790866971f},
-std::array<float,2>{0.537254572f, 0.64380157f},
-std::array<float,2>{0.265312821f, 0.250362575f},
-std::array<float,2>{0.871403158f, 0.351750076f},
-std::array<float,2>{0.17419374f, 0.712870777f},
-std::array<float,2>{0.66437304f, 0.84204191f},
-std::array<float,2>{0.493607521f, 0.181898594f},
-std::array<float,2>{0.594227135f, 0.077306211f},
-std::array<float,2>{0.327587128f, 0.913850367f},
-std::array<float,2>{0.997273982f, 0.604130208f},
-std::array<float,2>{0.11391075f, 0.452127337f},
-std::array<float,2>{0.603367031f, 0.387359738f},
-std::array<float,2>{0.312783599f, 0.551511884f},
-std::array<float,2>{0.987490296f, 0.94855231f},
-std::array<float,2>{0.121348023f, 0.0582055263f},
-std::array<float,2>{0.866230488f, 0.200373352f},
-std::array<float,2>{0.185350895f, 0.805539191f},
-std::array<float,2>{0.659185827f, 0.628080904f},
-std::array<float,2>{0.489815861f, 0.270281583f},
-std::array<float,2>{0.931571007f, 0.367401153f},
-std::array<float,2>{0.0113300057f, 0.695722997f},
-std::array<float,2>{0.542425394f, 0.823445141f},
-std::array<float,2>{0.252551854f, 0.160076052f},
-std::array<float,2>{0.705148458f, 0.0842094272f},
-std::array<float,2>{0.391038626f, 0.930836022f},
-std::array<float,2>{0.793808937f, 0.614023626f},
-std::array<float,2>{0.212046713f, 0.458886474f},
-std::array<float,2>{0.640944242f, 0.290374339f},
-std::array<float,2>{0.458743125f, 0.656480908f},
-std::array<float,2>{0.838044941f, 0.765611887f},
-std::array<float,2>{0.129554108f, 0.224092588f},
-std::array<float,2>{0.949314117f, 0.0114998082f},
-std::array<float,2>{0.0775561705f, 0.990172505f},
-std::array<float,2>{0.588603735f, 0.5259431f},
-std::array<float,2>{0.34477219f, 0.419968665f},
-std::array<float,2>{0.776525378f, 0.488120586f},
-std::array<float,2>{0.231662825f, 0.57263422f},
-std::array<float,2>{0.732335687f, 0.880138516f},
-std::array<float,2>{0.428345442f, 0.110672012f},
-std::array<float,2>{0.509501755f, 0.143462345f},
-std::array<float,2>{0.300251842f, 0.870595753f},
-std::array<float,2>{0.894550622f, 0.728721619f},
-std::array<float,2>{0.0508643948f, 0.316902578f},
-std::array<float,2>{0.547985315f, 0.331953079f},
-std::array<float,2>{0.276836842f, 0.739713371f},
-std::array<float,2>{0.910413742f, 0.858149409f},
-std::array<float,2>{0.0264569204f, 0.128741264f},
-std::array<float,2>{0.807594657f, 0.100461096f},
-std::array<float,2>{0.203022376f, 0.902464032f},
-std::array<float,2>{0.701463401f, 0.579721093f},
-std::array<float,2>{0.390094817f, 0.477784336f},
-std::array<float,2>{0.969196975f, 0.424972713f},
-std::array<float,2>{0.100785688f, 0.512794852f},
-std::array<float,2>{0.61951226f, 0.977851808f},
-std::array<float,2>{0.333102375f, 0.0305681098f},
-std::array<float,2>{0.678629756f, 0.234919325f},
-std::array<float,2>{0.476538062f, 0.769647658f},
-std::array<float,2>{0.851868272f, 0.672152638f},
-std::array<float,2>{0.156989634f, 0.303567797f},
-std::array<float,2>{0.741864085f, 0.446447283f},
-std::array<float,2>{0.408497393f, 0.608436346f},
-std::array<float,2>{0.759388268f, 0.906591475f},
-std::array<float,2>{0.235601604f, 0.0734161288f},
-std::array<float,2>{0.884329677f, 0.186518818f},
-std::array<float,2>{0.039655447f, 0.836280406f},
-std::array<float,2>{0.530529976f, 0.718101501f},
-std::array<float,2>{0.290413678f, 0.356576055f},
-std::array<float,2>{0.822862089f, 0.254399151f},
-std::array<float,2>{0.146603465f, 0.64841193f},
-std::array<float,2>{0.637087226f, 0.795042872f},
-std::array<float,2>{0.438044548f, 0.217013568f},
-std::array<float,2>{0.567036033f, 0.0433020405f},
-std::array<float,2>{0.37316519f, 0.959608078f},
-std::array<float,2>{0.968636692f, 0.541153014f},
-std::array<float,2>{0.0912180543f, 0.3909024f},
-std::array<float,2>{0.519156039f, 0.470742434f},
-std::array<float,2>{0.288573146f, 0.589875758f},
-std::array<float,2>{0.879489422f, 0.89763242f},
-std::array<float,2>{0.0316015817f, 0.108081236f},
-std::array<float,2>{0.756217062f, 0.133614704f},
-std::array<float,2>{0.243412226f, 0.843751907f},
-std::array<float,2>{0.748364389f, 0.748731136f},
-std::array<float,2>{0.415710926f, 0.337994605f},
-std::array<float,2>{0.956112266f, 0.304874003f},
-std::array<float,2>{0.0814957991f, 0.681214154f},
-std::array<float,2>{0.576079249f, 0.778832436f},
-std::array<float,2>{0.360415071f, 0.243055269f},
-std::array<float,2>{0.631707668f, 0.0214722324f},
-std::array<float,2>{0.452630728f, 0.971641243f},
-std::array<float,2>{0.815162659f, 0.50641942f},
-std::array<float,2>{0.152389556f, 0.435251623f},
-std::array<float,2>{0.691649675f, 0.351336956f},
-std::array<float,2>{0.377102584f, 0.703196704f},
-std::array<float,2>{0.797352374f, 0.830101848f},
-std::array<float,2>{0.195023f, 0.178871602f},
-std::array<float,2>{0.920703411f, 0.0660617426f},
-std::array<float,2>{0.0227259994f, 0.920538723f},
-std::array<float,2>{0.561046362f, 0.601221859f},
-std::array<float,2>{0.271692723f, 0.438598067f},
-std::array<float,2>{0.848850608f, 0.404386848f},
-std::array<float,2>{0.165199488f, 0.536453843f},
-std::array<float,2>{0.686776996f, 0.964111984f},
-std::array<float,2>{0.482393295f, 0.0324610993f},
-std::array<float,2>{0.61022675f, 0.209252313f},
-std::array<float,2>{0.341264993f, 0.788636267f},
-std::array<float,2>{0.98215723f, 0.655007958f},
-std::array<float,2>{0.104129672f, 0.261821687f},
-std::array<float,2>{0.580454886f, 0.278318226f},
-std::array<float,2>{0.355178893f, 0.632967293f},
-std::array<float,2>{0.94067806f, 0.797980964f},
-std::array<float,2>{0.0643691197f, 0.192460865f},
-std::array<float,2>{0.830026388f, 0.0525165573f},
-std::array<float,2>{0.140325755f, 0.943164647f},
-std::array<float,2>{0.654085875f, 0.557497084f},
-std::array<float,2>{0.466236055f, 0.37538895f},
-std::array<float,2>{0.903673649f, 0.466482341f},
-std::array<float,2>{0.0556945428f, 0.62245357f},
-std::array<float,2>{0.504236221f, 0.924810231f},
-std::array<float,2>{0.311157435f, 0.0930852592f},
-std::array<float,2>{0.723880947f, 0.171001092f},
-std::array<float,2>{0.431176245f, 0.813895702f},
-std::array<float,2>{0.768446505f, 0.688933074f},
-std::array<float,2>{0.225506306f, 0.361735702f},
-std::array<float,2>{0.671175241f, 0.40731442f},
-std::array<float,2>{0.498715848f, 0.522647917f},
-std::array<float,2>{0.86974746f, 0.995990217f},
-std::array<float,2>{0.178486958f, 0.00740764011f},
-std::array<float,2>{0.99388057f, 0.233351707f},
-std::array<float,2>{0.112896264f, 0.750222683f},
-std::array<float,2>{0.599288046f, 0.668301284f},
-std::array<float,2>{0.322295845f, 0.284962833f},
-std::array<float,2>{0.784614742f, 0.327155143f},
-std::array<float,2>{0.204860985f, 0.722241282f},
-std::array<float,2>{0.714942276f, 0.863030732f},
-std::array<float,2>{0.4008421f, 0.15277414f},
-std::array<float,2>{0.533854902f, 0.119339719f},
-std::array<float,2>{0.260625154f, 0.887038171f},
-std::array<float,2>{0.927812397f, 0.569981098f},
-std::array<float,2>{0.00106219214f, 0.496008486f},
-std::array<float,2>{0.513807178f, 0.400383323f},
-std::array<float,2>{0.304320812f, 0.533248425f},
-std::array<float,2>{0.891129494f, 0.965711176f},
-std::array<float,2>{0.0493748225f, 0.0377029665f},
-std::array<float,2>{0.781245828f, 0.20506981f},
-std::array<float,2>{0.229617f, 0.783386409f},
-std::array<float,2>{0.728717268f, 0.649000227f},
-std::array<float,2>{0.422397435f, 0.260379404f},
-std::array<float,2>{0.946870685f, 0.345433503f},
-std::array<float,2>{0.0725284442f, 0.70897758f},
-std::array<float,2>{0.590935349f, 0.835471988f},
-std::array<float,2>{0.349827945f, 0.174791753f},
-std::array<float,2>{0.647750676f, 0.0686409324f},
-std::array<float,2>{0.455726296f, 0.914674222f},
-std::array<float,2>{0.841167748f, 0.596443415f},
-std::array<float,2>{0.127564028f, 0.441949159f},
-std::array<float,2>{0.709194779f, 0.311304301f},
-std::array<float,2>{0.395073146f, 0.685800672f},
-std::array<float,2>{0.790053904f, 0.775368512f},
-std::array<float,2>{0.215966612f, 0.246399999f},
-std::array<float,2>{0.937352002f, 0.0179061461f},
-std::array<float,2>{0.012348433f, 0.974445105f},
-std::array<float,2>{0.544368505f, 0.503588617f},
-std::array<float,2>{0.257804453f, 0.432730854f},
-std::array<float,2>{0.85988903f, 0.476434797f},
-std::array<float,2>{0.181915924f, 0.586817026f},
-std::array<float,2>{0.662375808f, 0.894336522f},
-std::array<float,2>{0.487778872f, 0.105099447f},
-std::array<float,2>{0.605724812f, 0.138827339f},
-std::array<float,2>{0.318995625f, 0.848788381f},
-std::array<float,2>{0.990008771f, 0.745175123f},
-std::array<float,2>{0.119731501f, 0.342226863f},
-std::array<float,2>{0.562779427f, 0.322617054f},
-std::array<float,2>{0.368912548f, 0.723864973f},
-std::array<float,2>{0.963119328f, 0.863903582f},
-std::array<float,2>{0.086314179f, 0.150279671f},
-std::array<float,2>{0.826722324f, 0.12291237f},
-std::array<float,2>{0.144115388f, 0.886642754f},
-std::array<float,2>{0.636181772f, 0.564671814f},
-std::array<float,2>{0.445062399f, 0.497674555f},
-std::array<float,2>{0.890001357f, 0.411158681f},
-std::array<float,2>{0.0454181023f, 0.516281605f},
-std::array<float,2>{0.524809241f, 0.999885321f},
-std::array<float,2>{0.296200037f, 0.00302679208f},
-std::array<float,2>{0.736304879f, 0.228431851f},
-std::array<float,2>{0.413301826f, 0.754181802f},
-std::array<float,2>{0.764638066f, 0.666331887f},
-std::array<float,2>{0.241678417f, 0.28599292f},
-std::array<float,2>{0.675630867f, 0.4629336f},
-std::array<float,2>{0.470205814f, 0.620347619f},
-std::array<float,2>{0.858549714f, 0.92726469f},
-std::array<float,2>{0.161455497f, 0.0867236033f},
-std::array<float,2>{0.974616885f, 0.166711465f},
-std::array<float,2>{0.0959676355f, 0.816716254f},
-std::array<float,2>{0.62437278f, 0.694436371f},
-std::array<float,2>{0.328391522f, 0.366775036f},
-std::array<float,2>{0.812396765f, 0.275716603f},
-std::array<float,2>{0.19626075f, 0.63844651f},
-std::array<float,2>{0.697167456f, 0.803778589f},
-std::array<float,2>{0.383332372f, 0.188760847f},
-std::array<float,2>{0.551219404f, 0.0499100946f},
-std::array<float,2>{0.279836476f, 0.941050649f},
-std::array<float,2>{0.90999037f, 0.562149048f},
-std::array<float,2>{0.0302819293f, 0.380288869f},
-std::array<float,2>{0.615715504f, 0.48899588f},
-std::array<float,2>{0.338227272f, 0.575911105f},
-std::array<float,2>{0.977607369f, 0.878291726f},
-std::array<float,2>{0.107781693f, 0.117026255f},
-std::array<float,2>{0.847221017f, 0.146722361f},
-std::array<float,2>{0.169010714f, 0.872826159f},
-std::array<float,2>{0.680493355f, 0.731793761f},
-std::array<float,2>{0.478135854f, 0.315537125f},
-std::array<float,2>{0.917399764f, 0.295924664f},
-std::array<float,2>{0.0167652257f, 0.660996139f},
-std::array<float,2>{0.556913435f, 0.75904417f},
-std::array<float,2>{0.269500166f, 0.220799685f},
-std::array<float,2>{0.689870596f, 0.0133433631f},
-std::array<float,2>{0.380725443f, 0.984820485f},
-std::array<float,2>{0.801447213f, 0.530820131f},
-std::array<float,2>{0.188232049f, 0.414834648f},
-std::array<float,2>{0.62716502f, 0.371975541f},
-std::array<float,2>{0.445954859f, 0.702585936f},
-std::array<float,2>{0.819840729f, 0.827118576f},
-std::array<float,2>{0.151453823f, 0.162470058f},
-std::array<float,2>{0.958906353f, 0.0801748782f},
-std::array<float,2>{0.0857168287f, 0.933701217f},
-std::array<float,2>{0.57187289f, 0.612091064f},
-std::array<float,2>{0.365089297f, 0.453824818f},
-std::array<float,2>{0.752159894f, 0.385510176f},
-std::array<float,2>{0.24627775f, 0.549701035f},
-std::array<float,2>{0.745142162f, 0.952727258f},
-std::array<float,2>{0.41827926f, 0.0614698119f},
-std::array<float,2>{0.523302376f, 0.1985199f},
-std::array<float,2>{0.281870753f, 0.811999202f},
-std::array<float,2>{0.875985324f, 0.62990731f},
-std::array<float,2>{0.0383161791f, 0.266737163f},
-std::array<float,2>{0.535648525f, 0.253621042f},
-std::array<float,2>{0.261778086f, 0.641100526f},
-std::array<float,2>{0.924253345f, 0.791792274f},
-std::array<float,2>{0.00713126501f, 0.212929681f},
-std::array<float,2>{0.78603518f, 0.0427736528f},
-std::array<float,2>{0.207131326f, 0.956317544f},
-std::array<float,2>{0.714103997f, 0.545904636f},
-std::array<float,2>{0.405526131f, 0.39695093f},
-std::array<float,2>{0.999705613f, 0.450695634f},
-std::array<float,2>{0.115885541f, 0.602320731f},
-std::array<float,2>{0.596276045f, 0.910811901f},
-std::array<float,2>{0.325919569f, 0.0751352832f},
-std::array<float,2>{0.66648376f, 0.181052893f},
-std::array<float,2>{0.494771928f, 0.841430962f},
-std::array<float,2>{0.873455346f, 0.71359098f},
-std::array<float,2>{0.172824517f, 0.353700221f},
-std::array<float,2>{0.722274065f, 0.429040045f},
-std::array<float,2>{0.435864508f, 0.509834349f},
-std::array<float,2>{0.769952714f, 0.981377482f},
-std::array<float,2>{0.222228855f, 0.025444353f},
-std::array<float,2>{0.900902271f, 0.240563765f},
-std::array<float,2>{0.0612175986f, 0.767001092f},
-std::array<float,2>{0.501831412f, 0.679363728f},
-std::array<float,2>{0.306251734f, 0.297806293f},
-std::array<float,2>{0.834841013f, 0.33216548f},
-std::array<float,2>{0.136629418f, 0.736321568f},
-std::array<float,2>{0.650608838f, 0.854808986f},
-std::array<float,2>{0.464532316f, 0.129596099f},
-std::array<float,2>{0.585440159f, 0.0971328095f},
-std::array<float,2>{0.358877093f, 0.900142848f},
-std::array<float,2>{0.943415463f, 0.582290232f},
-std::array<float,2>{0.0695992634f, 0.483534485f},
-std::array<float,2>{0.587772965f, 0.418903887f},
-std::array<float,2>{0.34595412f, 0.52353704f},
-std::array<float,2>{0.952305973f, 0.991036057f},
-std::array<float,2>{0.075438641f, 0.00965174194f},
-std::array<float,2>{0.836396992f, 0.225782618f},
-std::array<float,2>{0.132808074f, 0.763579845f},
-std::array<float,2>{0.643332005f, 0.6598472f},
-std::array<float,2>{0.460858852f, 0.291473478f},
-std::array<float,2>{0.897350669f, 0.318920225f},
-std::array<float,2>{0.0545646995f, 0.727649629f},
-std::array<float,2>{0.51153332f, 0.867487073f},
-std::array<float,2>{0.297767758f, 0.141107053f},
-std::array<float,2>{0.733178377f, 0.112546436f},
-std::array<float,2>{0.425934941f, 0.882239163f},
-std::array<float,2>{0.774627388f, 0.571777999f},
-std::array<float,2>{0.232432559f, 0.4857077f},
-std::array<float,2>{0.657754064f, 0.272154093f},
-std::array<float,2>{0.491495728f, 0.625958443f},
-std::array<float,2>{0.863686919f, 0.806934178f},
-std::array<float,2>{0.187358692f, 0.203037441f},
-std::array<float,2>{0.985438168f, 0.0560925379f},
-std::array<float,2>{0.1233031f, 0.945751965f},
-std::array<float,2>{0.60402745f, 0.553106546f},
-std::array<float,2>{0.315116554f, 0.38884303f},
-std::array<float,2>{0.795165181f, 0.460569531f},
-std::array<float,2>{0.213408515f, 0.616016626f},
-std::array<float,2>{0.704431236f, 0.933570921f},
-std::array<float,2>{0.393651217f, 0.0837258771f},
-std::array<float,2>{0.540153086f, 0.157297462f},
-std::array<float,2>{0.251877278f, 0.821825027f},
-std::array<float,2>{0.933535159f, 0.698242545f},
-std::array<float,2>{0.00837929174f, 0.369616091f},
-std::array<float,2>{0.528086901f, 0.358750999f},
-std::array<float,2>{0.292506367f, 0.715063334f},
-std::array<float,2>{0.88542062f, 0.839054346f},
-std::array<float,2>{0.0417580828f, 0.183723539f},
-std::array<float,2>{0.760329247f, 0.0720862001f},
-std::array<float,2>{0.237596422f, 0.908608079f},
-std::array<float,2>{0.739750981f, 0.606006682f},
-std::array<float,2>{0.406961322f, 0.449001193f},
-std::array<float,2>{0.966268837f, 0.392884135f},
-std::array<float,2>{0.0927169174f, 0.539129555f},
-std::array<float,2>{0.569779694f, 0.95757252f},
-std::array<float,2>{0.371979803f, 0.0460590385f},
-std::array<float,2>{0.640209019f, 0.216683999f},
-std::array<float,2>{0.440389335f, 0.794278979f},
-std::array<float,2>{0.82093817f, 0.645006061f},
-std::array<float,2>{0.14466621f, 0.257391036f},
-std::array<float,2>{0.700464547f, 0.480019778f},
-std::array<float,2>{0.387635469f, 0.580406964f},
-std::array<float,2>{0.806096613f, 0.904502988f},
-std::array<float,2>{0.200873211f, 0.0995436832f},
-std::array<float,2>{0.912214041f, 0.126447007f},
-std::array<float,2>{0.0237706751f, 0.856838226f},
-std::array<float,2>{0.550732374f, 0.740937173f},
-std::array<float,2>{0.275126368f, 0.329562306f},
-std::array<float,2>{0.854705811f, 0.301079214f},
-std::array<float,2>{0.159586802f, 0.674379647f},
-std::array<float,2>{0.676320314f, 0.772556841f},
-std::array<float,2>{0.47295177f, 0.237689108f},
-std::array<float,2>{0.618326604f, 0.0290320497f},
-std::array<float,2>{0.335187316f, 0.979288161f},
-std::array<float,2>{0.971378088f, 0.513993561f},
-std::array<float,2>{0.0979644954f, 0.422414511f},
-std::array<float,2>{0.560419083f, 0.440306306f},
-std::array<float,2>{0.270678222f, 0.599295497f},
-std::array<float,2>{0.919902444f, 0.918467879f},
-std::array<float,2>{0.0211015511f, 0.0635232404f},
-std::array<float,2>{0.79982847f, 0.176956773f},
-std::array<float,2>{0.191532433f, 0.829272389f},
-std::array<float,2>{0.694984615f, 0.705736578f},
-std::array<float,2>{0.376698971f, 0.349220484f},
-std::array<float,2>{0.982820809f, 0.265110701f},
-std::array<float,2>{0.10270758f, 0.654134452f},
-std::array<float,2>{0.611474395f, 0.787074625f},
-std::array<float,2>{0.341821492f, 0.208900377f},
-std::array<float,2>{0.683719516f, 0.0335454717f},
-std::array<float,2>{0.483271658f, 0.961918056f},
-std::array<float,2>{0.849914491f, 0.537276924f},
-std::array<float,2>{0.166573718f, 0.403045535f},
-std::array<float,2>{0.747195661f, 0.336578697f},
-std::array<float,2>{0.417777508f, 0.746390343f},
-std::array<float,2>{0.754448354f, 0.845905781f},
-std::array<float,2>{0.245395437f, 0.135920942f},
-std::array<float,2>{0.881208599f, 0.105713345f},
-std::array<float,2>{0.0347884148f, 0.896086097f},
-std::array<float,2>{0.516393721f, 0.592209041f},
-std::array<float,2>{0.285274804f, 0.469869465f},
-std::array<float,2>{0.814134002f, 0.437096238f},
-std::array<float,2>{0.155343696f, 0.504553199f},
-std::array<float,2>{0.629193962f, 0.968802154f},
-std::array<float,2>{0.451092422f, 0.0225374345f},
-std::array<float,2>{0.577952921f, 0.245942175f},
-std::array<float,2>{0.362775564f, 0.780742228f},
-std::array<float,2>{0.954364121f, 0.683198571f},
-std::array<float,2>{0.0796757415f, 0.3069745f},
-std::array<float,2>{0.600616813f, 0.283055395f},
-std::array<float,2>{0.322225571f, 0.670472383f},
-std::array<float,2>{0.994169652f, 0.753029227f},
-std::array<float,2>{0.111317188f, 0.231058359f},
-std::array<float,2>{0.867752314f, 0.00468738284f},
-std::array<float,2>{0.177042961f, 0.993465543f},
-std::array<float,2>{0.668577433f, 0.520657301f},
-std::array<float,2>{0.496116191f, 0.408706993f},
-std::array<float,2>{0.926245272f, 0.492564559f},
-std::array<float,2>{0.00323067699f, 0.567481995f},
-std::array<float,2>{0.531668842f, 0.88948226f},
-std::array<float,2>{0.259230345f, 0.118206672f},
-std::array<float,2>{0.718215764f, 0.15618144f},
-std::array<float,2>{0.399877042f, 0.860246062f},
-std::array<float,2>{0.781300962f, 0.719090343f},
-std::array<float,2>{0.205763653f, 0.325035512f},
-std::array<float,2>{0.655635536f, 0.377376199f},
-std::array<float,2>{0.466827363f, 0.555985928f},
-std::array<float,2>{0.831100225f, 0.944108665f},
-std::array<float,2>{0.13808006f, 0.0537833981f},
-std::array<float,2>{0.937564194f, 0.193803847f},
-std::array<float,2>{0.0655213222f, 0.80073756f},
-std::array<float,2>{0.579978406f, 0.635517895f},
-std::array<float,2>{0.352260143f, 0.281209111f},
-std::array<float,2>{0.767521143f, 0.361221731f},
-std::array<float,2>{0.222989991f, 0.689831197f},
-std::array<float,2>{0.725094259f, 0.816086113f},
-std::array<float,2>{0.432850599f, 0.169264182f},
-std::array<float,2>{0.506610751f, 0.0912756547f},
-std::array<float,2>{0.309872419f, 0.92236042f},
-std::array<float,2>{0.905942321f, 0.623449683f},
-std::array<float,2>{0.0573353656f, 0.467294753f},
-std::array<float,2>{0.537710249f, 0.396978766f},
-std::array<float,2>{0.264859825f, 0.546627223f},
-std::array<float,2>{0.922241449f, 0.956898332f},
-std::array<float,2>{0.00543256337f, 0.0424595252f},
-std::array<float,2>{0.788140297f, 0.213829115f},
-std::array<float,2>{0.209618092f, 0.791358352f},
-std::array<float,2>{0.71264118f, 0.641292751f},
-std::array<float,2>{0.404281318f, 0.253076613f},
-std::array<float,2>{0.997986317f, 0.354022145f},
-std::array<float,2>{0.113439023f, 0.712920845f},
-std::array<float,2>{0.59438169f, 0.841174185f},
-std::array<float,2>{0.327982008f, 0.181337193f},
-std::array<float,2>{0.664624929f, 0.0744253546f},
-std::array<float,2>{0.493778735f, 0.91053623f},
-std::array<float,2>{0.871951938f, 0.601608574f},
-std::array<float,2>{0.174790531f, 0.450336337f},
-std::array<float,2>{0.719384372f, 0.297218055f},
-std::array<float,2>{0.435471326f, 0.67873913f},
-std::array<float,2>{0.772612631f, 0.767353654f},
-std::array<float,2>{0.219276652f, 0.240729466f},
-std::array<float,2>{0.899491429f, 0.0261753071f},
-std::array<float,2>{0.0590103865f, 0.98079896f},
-std::array<float,2>{0.502114296f, 0.510514855f},
-std::array<float,2>{0.307425499f, 0.42921865f},
-std::array<float,2>{0.832918286f, 0.484232187f},
-std::array<float,2>{0.133248538f, 0.582811594f},
-std::array<float,2>{0.650348902f, 0.899726391f},
-std::array<float,2>{0.46218434f, 0.0974747762f},
-std::array<float,2>{0.582820117f, 0.129348978f},
-std::array<float,2>{0.35629341f, 0.8553406f},
-std::array<float,2>{0.943246961f, 0.735724628f},
-std::array<float,2>{0.0668732226f, 0.332669854f},
-std::array<float,2>{0.613984823f, 0.316218108f},
-std::array<float,2>{0.33607915f, 0.732239783f},
-std::array<float,2>{0.978615642f, 0.872191668f},
-std::array<float,2>{0.105798364f, 0.147362038f},
-std::array<float,2>{0.844428897f, 0.116585426f},
-std::array<float,2>{0.17123197f, 0.878642857f},
-std::array<float,2>{0.681927562f, 0.57555598f},
-std::array<float,2>{0.478884459f, 0.488731295f},
-std::array<float,2>{0.915256858f, 0.414459854f},
-std::array<float,2>{0.0176265426f, 0.530526459f},
-std::array<float,2>{0.555141032f, 0.985341549f},
-std::array<float,2>{0.266151994f, 0.0127075985f},
-std::array<float,2>{0.688585579f, 0.221478358f},
-std::array<float,2>{0.381950438f, 0.759392262f},
-std::array<float,2>{0.802983165f, 0.660273552f},
-std::array<float,2>{0.189761415f, 0.296552718f},
-std::array<float,2>{0.625662386f, 0.453209251f},
-std::array<float,2>{0.448054105f, 0.611767769f},
-std::array<float,2>{0.81773001f, 0.934482217f},
-std::array<float,2>{0.150109619f, 0.0810135454f},
-std::array<float,2>{0.959319115f, 0.162942156f},
-std::array<float,2>{0.0834372267f, 0.82652539f},
-std::array<float,2>{0.573807895f, 0.70272696f},
-std::array<float,2>{0.366556406f, 0.371145874f},
-std::array<float,2>{0.751123428f, 0.267290205f},
-std::array<float,2>{0.249707595f, 0.630530655f},
-std::array<float,2>{0.743482888f, 0.81233269f},
-std::array<float,2>{0.420345753f, 0.19880417f},
-std::array<float,2>{0.520532072f, 0.0608598851f},
-std::array<float,2>{0.283444583f, 0.952612102f},
-std::array<float,2>{0.878425956f, 0.548957407f},
-std::array<float,2>{0.0365599245f, 0.385227263f},
-std::array<float,2>{0.564844549f, 0.49735269f},
-std::array<float,2>{0.370594114f, 0.565121651f},
-std::array<float,2>{0.961514533f, 0.886074424f},
-std::array<float,2>{0.0886133388f, 0.122229777f},
-std::array<float,2>{0.826161325f, 0.149796069f},
-std::array<float,2>{0.142499283f, 0.863430977f},
-std::array<float,2>{0.633756638f, 0.724180877f},
-std::array<float,2>{0.442030311f, 0.322963506f},
-std::array<float,2>{0.886807621f, 0.285553992f},
-std::array<float,2>{0.0442856848f, 0.666953027f},
-std::array<float,2>{0.525735438f, 0.754627585f},
-std::array<float,2>{0.293668211f, 0.227647424f},
-std::array<float,2>{0.737915516f, 0.00369949569f},
-std::array<float,2>{0.412045717f, 0.999072731f},
-std::array<float,2>{0.763287663f, 0.51586169f},
-std::array<float,2>{0.238748446f, 0.411979198f},
-std::array<float,2>{0.672830224f, 0.366402596f},
-std::array<float,2>{0.471483976f, 0.694913805f},
-std::array<float,2>{0.855479777f, 0.817165017f},
-std::array<float,2>{0.162548557f, 0.166139781f},
-std::array<float,2>{0.973793805f, 0.086178042f},
-std::array<float,2>{0.0953242257f, 0.926760137f},
-std::array<float,2>{0.622220695f, 0.620718122f},
-std::array<float,2>{0.330462784f, 0.463538796f},
-std::array<float,2>{0.809742987f, 0.380581081f},
-std::array<float,2>{0.197431281f, 0.561592162f},
-std::array<float,2>{0.698360324f, 0.940676332f},
-std::array<float,2>{0.385594308f, 0.0507185534f},
-std::array<float,2>{0.554276407f, 0.189012721f},
-std::array<float,2>{0.277438372f, 0.804619908f},
-std::array<float,2>{0.907825351f, 0.637924194f},
-std::array<float,2>{0.0280497316f, 0.276057094f},
-std::array<float,2>{0.512815356f, 0.259795994f},
-std::array<float,2>{0.302555352f, 0.648478806f},
-std::array<float,2>{0.893424273f, 0.784143627f},
-std::array<float,2>{0.0476058163f, 0.204571769f},
-std::array<float,2>{0.778664708f, 0.037472371f},
-std::array<float,2>{0.228493348f, 0.964940786f},
-std::array<float,2>{0.726961553f, 0.534056723f},
-std::array<float,2>{0.42442444f, 0.399839371f},
-std::array<float,2>{0.948990405f, 0.441418946f},
-std::array<float,2>{0.0708940923f, 0.595835209f},
-std::array<float,2>{0.592440903f, 0.914503515f},
-std::array<float,2>{0.347902983f, 0.0693347007f},
-std::array<float,2>{0.644769907f, 0.174188375f},
-std::array<float,2>{0.454040557f, 0.835162997f},
-std::array<float,2>{0.842750728f, 0.708396435f},
-std::array<float,2>{0.126943558f, 0.345033437f},
-std::array<float,2>{0.7086941f, 0.433407485f},
-std::array<float,2>{0.397390544f, 0.503092945f},
-std::array<float,2>{0.791143358f, 0.973751366f},
-std::array<float,2>{0.218234077f, 0.0182353146f},
-std::array<float,2>{0.935544372f, 0.2467134f},
-std::array<float,2>{0.0147422664f, 0.774418175f},
-std::array<float,2>{0.545222461f, 0.686196923f},
-std::array<float,2>{0.255470991f, 0.311004311f},
-std::array<float,2>{0.863221347f, 0.342613459f},
-std::array<float,2>{0.180683091f, 0.745869339f},
-std::array<float,2>{0.661771297f, 0.849401832f},
-std::array<float,2>{0.485265285f, 0.13931933f},
-std::array<float,2>{0.609017551f, 0.104843281f},
-std::array<float,2>{0.318165034f, 0.893746614f},
-std::array<float,2>{0.992018104f, 0.586012304f},
-std::array<float,2>{0.11911995f, 0.475710362f},
-std::array<float,2>{0.598637223f, 0.408570111f},
-std::array<float,2>{0.323169947f, 0.521427274f},
-std::array<float,2>{0.993516564f, 0.99386394f},
-std::array<float,2>{0.112386458f, 0.00429608533f},
-std::array<float,2>{0.869558275f, 0.230610922f},
-std::array<float,2>{0.177859142f, 0.753586709f},
-std::array<float,2>{0.671602428f, 0.670320153f},
-std::array<float,2>{0.498391986f, 0.282244295f},
-std::array<float,2>{0.928383529f, 0.324508071f},
-std::array<float,2>{0.00149961223f, 0.719313264f},
-std::array<float,2>{0.533478439f, 0.859641075f},
-std::array<float,2>{0.260231495f, 0.15540494f},
-std::array<float,2>{0.715442836f, 0.118695743f},
-std::array<float,2>{0.401278734f, 0.88908112f},
-std::array<float,2>{0.784742057f, 0.568247139f},
-std::array<float,2>{0.204546705f, 0.492774636f},
-std::array<float,2>{0.653465331f, 0.280456781f},
-std::array<float,2>{0.466566175f, 0.634910524f},
-std::array<float,2>{0.829439104f, 0.800123274f},
-std::array<float,2>{0.139902338f, 0.194023624f},
-std::array<float,2>{0.941109002f, 0.0543802716f},
-std::array<float,2>{0.0637081116f, 0.94372803f},
-std::array<float,2>{0.580726802f, 0.556574106f},
-std::array<float,2>{0.3548114f, 0.377623588f},
-std::array<float,2>{0.767591178f, 0.467184663f},
-std::array<float,2>{0.224710539f, 0.623963356f},
-std::array<float,2>{0.72423768f, 0.922418356f},
-std::array<float,2>{0.431096971f, 0.0915302038f},
-std::array<float,2>{0.504787743f, 0.169875547f},
-std::array<float,2>{0.310982764f, 0.81584847f},
-std::array<float,2>{0.904280186f, 0.690010905f},
-std::array<float,2>{0.0565479882f, 0.360585213f},
-std::array<float,2>{0.56085974f, 0.348921359f},
-std::array<float,2>{0.271986425f, 0.705344379f},
-std::array<float,2>{0.920206487f, 0.829703212f},
-std::array<float,2>{0.0232627988f, 0.177286848f},
-std::array<float,2>{0.797467589f, 0.0643923283f},
-std::array<float,2>{0.194733784f, 0.918128073f},
-std::array<float,2>{0.69209516f, 0.598658681f},
-std::array<float,2>{0.377854019f, 0.439902931f},
-std::array<float,2>{0.981921434f, 0.40254584f},
-std::array<float,2>{0.103591524f, 0.537740946f},
-std::array<float,2>{0.609409034f, 0.96243608f},
-std::array<float,2>{0.341717809f, 0.0340462066f},
-std::array<float,2>{0.687384844f, 0.208270699f},
-std::array<float,2>{0.481578201f, 0.786611319f},
-std::array<float,2>{0.849447966f, 0.653654099f},
-std::array<float,2>{0.165849626f, 0.265394449f},
-std::array<float,2>{0.748630881f, 0.470452636f},
-std::array<float,2>{0.415460199f, 0.592556655f},
-std::array<float,2>{0.756806016f, 0.895628095f},
-std::array<float,2>{0.243799359f, 0.106217638f},
-std::array<float,2>{0.879282773f, 0.136432841f},
-std::array<float,2>{0.0319429003f, 0.846641421f},
-std::array<float,2>{0.518789411f, 0.746896386f},
-std::array<float,2>{0.288848937f, 0.336243749f},
-std::array<float,2>{0.814615548f, 0.307205349f},
-std::array<float,2>{0.153019011f, 0.682742238f},
-std::array<float,2>{0.63109535f, 0.781053007f},
-std::array<float,2>{0.453023553f, 0.245514631f},
-std::array<float,2>{0.575266242f, 0.0232709758f},
-std::array<float,2>{0.360849768f, 0.969500422f},
-std::array<float,2>{0.956645429f, 0.504288018f},
-std::array<float,2>{0.081959106f, 0.437004089f},
-std::array<float,2>{0.531091213f, 0.448596865f},
-std::array<float,2>{0.290786117f, 0.605797112f},
-std::array<float,2>{0.884079993f, 0.909092903f},
-std::array<float,2>{0.0392683372f, 0.0715102926f},
-std::array<float,2>{0.759058297f, 0.184194282f},
-std::array<float,2>{0.236191168f, 0.839668036f},
-std::array<float,2>{0.741358995f, 0.715565741f},
-std::array<float,2>{0.408837944f, 0.359109581f},
-std::array<float,2>{0.968178391f, 0.256836623f},
-std::array<float,2>{0.0917410851f, 0.645050347f},
-std::array<float,2>{0.566769481f, 0.794606686f},
-std::array<float,2>{0.373777032f, 0.216178656f},
-std::array<float,2>{0.637251258f, 0.0466794111f},
-std::array<float,2>{0.437574416f, 0.957397699f},
-std::array<float,2>{0.822286248f, 0.539559662f},
-std::array<float,2>{0.146995097f, 0.393278182f},
-std::array<float,2>{0.701861322f, 0.329689682f},
-std::array<float,2>{0.390425861f, 0.740354598f},
-std::array<float,2>{0.806859314f, 0.857194602f},
-std::array<float,2>{0.202459067f, 0.126475558f},
-std::array<float,2>{0.910819948f, 0.0991007686f},
-std::array<float,2>{0.0270237587f, 0.904818356f},
-std::array<float,2>{0.548777282f, 0.580889285f},
-std::array<float,2>{0.27716434f, 0.479670346f},
-std::array<float,2>{0.85250181f, 0.422021329f},
-std::array<float,2>{0.156404912f, 0.514585078f},
-std::array<float,2>{0.67808038f, 0.978598356f},
-std::array<float,2>{0.475857437f, 0.028547626f},
-std::array<float,2>{0.620053172f, 0.238186628f},
-std::array<float,2>{0.333899021f, 0.773096561f},
-std::array<float,2>{0.969462812f, 0.674094915f},
-std::array<float,2>{0.101145931f, 0.301454902f},
-std::array<float,2>{0.587987185f, 0.291991889f},
-std::array<float,2>{0.345652103f, 0.659389496f},
-std::array<float,2>{0.950033247f, 0.763160229f},
-std::array<float,2>{0.0779440254f, 0.226092279f},
-std::array<float,2>{0.838747501f, 0.00920381024f},
-std::array<float,2>{0.129245102f, 0.990338802f},
-std::array<float,2>{0.641215682f, 0.524159789f},
-std::array<float,2>{0.458102316f, 0.41845277f},
-std::array<float,2>{0.895209134f, 0.486292899f},
-std::array<float,2>{0.0514727123f, 0.571533442f},
-std::array<float,2>{0.508946121f, 0.882698059f},
-std::array<float,2>{0.300571561f, 0.113039821f},
-std::array<float,2>{0.731794238f, 0.141161472f},
-std::array<float,2>{0.428171784f, 0.868113995f},
-std::array<float,2>{0.777280271f, 0.728125811f},
-std::array<float,2>{0.232060909f, 0.318598986f},
-std::array<float,2>{0.659825087f, 0.389345914f},
-std::array<float,2>{0.489543915f, 0.553592801f},
-std::array<float,2>{0.866925657f, 0.946275294f},
-std::array<float,2>{0.184837341f, 0.0562793128f},
-std::array<float,2>{0.988057256f, 0.202551439f},
-std::array<float,2>{0.121899471f, 0.807287037f},
-std::array<float,2>{0.602973461f, 0.625096262f},
-std::array<float,2>{0.313076675f, 0.271767199f},
-std::array<float,2>{0.79342562f, 0.370043904f},
-std::array<float,2>{0.212677196f, 0.699003398f},
-std::array<float,2>{0.705881298f, 0.821438909f},
-std::array<float,2>{0.391472071f, 0.158034503f},
-std::array<float,2>{0.542493403f, 0.0832776725f},
-std::array<float,2>{0.252041459f, 0.932623446f},
-std::array<float,2>{0.930999279f, 0.615646839f},
-std::array<float,2>{0.0111372173f, 0.459985077f},
-std::array<float,2>{0.501346409f, 0.426554531f},
-std::array<float,2>{0.306138664f, 0.509235859f},
-std::array<float,2>{0.900515914f, 0.983891308f},
-std::array<float,2>{0.0609940886f, 0.024009278f},
-std::array<float,2>{0.770377755f, 0.238861486f},
-std::array<float,2>{0.222037748f, 0.76874578f},
-std::array<float,2>{0.721979201f, 0.677173257f},
-std::array<float,2>{0.436335176f, 0.29929629f},
-std::array<float,2>{0.943994701f, 0.334373087f},
-std::array<float,2>{0.0702745616f, 0.736933172f},
-std::array<float,2>{0.585557342f, 0.85190767f},
-std::array<float,2>{0.359095097f, 0.130890355f},
-std::array<float,2>{0.650924504f, 0.0943007618f},
-std::array<float,2>{0.464200228f, 0.901296616f},
-std::array<float,2>{0.83436197f, 0.585328698f},
-std::array<float,2>{0.136069492f, 0.480601162f},
-std::array<float,2>{0.714565694f, 0.250808924f},
-std::array<float,2>{0.406171739f, 0.644061387f},
-std::array<float,2>{0.785533071f, 0.790189326f},
-std::array<float,2>{0.207981601f, 0.212064669f},
-std::array<float,2>{0.92453742f, 0.040984109f},
-std::array<float,2>{0.00736748846f, 0.953543603f},
-std::array<float,2>{0.535275817f, 0.54319793f},
-std::array<float,2>{0.262376696f, 0.395836234f},
-std::array<float,2>{0.873826981f, 0.451325446f},
-std::array<float,2>{0.172137231f, 0.603520989f},
-std::array<float,2>{0.666861892f, 0.913334846f},
-std::array<float,2>{0.494607866f, 0.0776661858f},
-std::array<float,2>{0.596129119f, 0.182336614f},
-std::array<float,2>{0.325683475f, 0.84237355f},
-std::array<float,2>{0.999127209f, 0.712324023f},
-std::array<float,2>{0.115283735f, 0.352337122f},
-std::array<float,2>{0.57175833f, 0.374401182f},
-std::array<float,2>{0.364663243f, 0.700123191f},
-std::array<float,2>{0.958443403f, 0.824549735f},
-std::array<float,2>{0.0850485563f, 0.160397813f},
-std::array<float,2>{0.819508135f, 0.0782425776f},
-std::array<float,2>{0.152122751f, 0.935782492f},
-std::array<float,2>{0.627622843f, 0.60990864f},
-std::array<float,2>{0.445550442f, 0.456245482f},
-std::array<float,2>{0.876753271f, 0.384572715f},
-std::array<float,2>{0.038821727f, 0.547066391f},
-std::array<float,2>{0.522578001f, 0.95032835f},
-std::array<float,2>{0.281565428f, 0.0601796098f},
-std::array<float,2>{0.745856464f, 0.19645983f},
-std::array<float,2>{0.418939501f, 0.809412599f},
-std::array<float,2>{0.752791464f, 0.632157385f},
-std::array<float,2>{0.247067958f, 0.268371671f},
-std::array<float,2>{0.680004835f, 0.491521388f},
-std::array<float,2>{0.478011936f, 0.576226175f},
-std::array<float,2>{0.846926451f, 0.875961363f},
-std::array<float,2>{0.169586942f, 0.114205755f},
-std::array<float,2>{0.978385329f, 0.144630343f},
-std::array<float,2>{0.107958794f, 0.874763846f},
-std::array<float,2>{0.615970671f, 0.732754648f},
-std::array<float,2>{0.338433206f, 0.314219743f},
-std::array<float,2>{0.800858736f, 0.294487655f},
-std::array<float,2>{0.187776342f, 0.66233319f},
-std::array<float,2>{0.690203667f, 0.761115849f},
-std::array<float,2>{0.379951507f, 0.21975179f},
-std::array<float,2>{0.55725354f, 0.0144524798f},
-std::array<float,2>{0.268845856f, 0.987710893f},
-std::array<float,2>{0.917688191f, 0.529045224f},
-std::array<float,2>{0.0173005257f, 0.416282266f},
-std::array<float,2>{0.624625504f, 0.462078869f},
-std::array<float,2>{0.328689039f, 0.618685663f},
-std::array<float,2>{0.97535044f, 0.929329932f},
-std::array<float,2>{0.0962543041f, 0.0881661922f},
-std::array<float,2>{0.859079361f, 0.164596364f},
-std::array<float,2>{0.161946237f, 0.819485366f},
-std::array<float,2>{0.67507261f, 0.691412926f},
-std::array<float,2>{0.470457315f, 0.363911569f},
-std::array<float,2>{0.909359634f, 0.274951637f},
-std::array<float,2>{0.030807469f, 0.639841437f},
-std::array<float,2>{0.551303089f, 0.801400125f},
-std::array<float,2>{0.279752761f, 0.190298527f},
-std::array<float,2>{0.696290493f, 0.0470024273f},
-std::array<float,2>{0.383202165f, 0.938817143f},
-std::array<float,2>{0.811652362f, 0.559603572f},
-std::array<float,2>{0.195622489f, 0.382045567f},
-std::array<float,2>{0.636388719f, 0.321191549f},
-std::array<float,2>{0.444737166f, 0.726260304f},
-std::array<float,2>{0.826445222f, 0.86635524f},
-std::array<float,2>{0.143582091f, 0.152307138f},
-std::array<float,2>{0.963417828f, 0.123272926f},
-std::array<float,2>{0.0867553204f, 0.88333106f},
-std::array<float,2>{0.5632447f, 0.563226879f},
-std::array<float,2>{0.36851418f, 0.498897076f},
-std::array<float,2>{0.763696909f, 0.412123412f},
-std::array<float,2>{0.242021009f, 0.518010497f},
-std::array<float,2>{0.735713959f, 0.996804476f},
-std::array<float,2>{0.413758457f, 0.000166488579f},
-std::array<float,2>{0.525295258f, 0.229981706f},
-std::array<float,2>{0.296418667f, 0.755990505f},
-std::array<float,2>{0.890146017f, 0.664464176f},
-std::array<float,2>{0.0450694524f, 0.288410306f},
-std::array<float,2>{0.544884741f, 0.308991283f},
-std::array<float,2>{0.257081211f, 0.68494302f},
-std::array<float,2>{0.936754048f, 0.777308881f},
-std::array<float,2>{0.0121481875f, 0.248669267f},
-std::array<float,2>{0.790880919f, 0.0173080731f},
-std::array<float,2>{0.216777429f, 0.975149632f},
-std::array<float,2>{0.709790826f, 0.501567125f},
-std::array<float,2>{0.394697726f, 0.430127501f},
-std::array<float,2>{0.989716709f, 0.473735422f},
-std::array<float,2>{0.119343825f, 0.589661956f},
-std::array<float,2>{0.606009841f, 0.892529666f},
-std::array<float,2>{0.31846121f, 0.102731049f},
-std::array<float,2>{0.663056076f, 0.137842745f},
-std::array<float,2>{0.487954587f, 0.850559771f},
-std::array<float,2>{0.859487712f, 0.743429899f},
-std::array<float,2>{0.182193801f, 0.340694875f},
-std::array<float,2>{0.729385257f, 0.400476128f},
-std::array<float,2>{0.421946973f, 0.532935262f},
-std::array<float,2>{0.780701518f, 0.966952741f},
-std::array<float,2>{0.230058432f, 0.0352933183f},
-std::array<float,2>{0.890661597f, 0.20652613f},
-std::array<float,2>{0.0488356836f, 0.782848239f},
-std::array<float,2>{0.514590323f, 0.650731981f},
-std::array<float,2>{0.3041825f, 0.258678049f},
-std::array<float,2>{0.841635287f, 0.345899105f},
-std::array<float,2>{0.127417833f, 0.710020483f},
-std::array<float,2>{0.647952259f, 0.83305645f},
-std::array<float,2>{0.455560565f, 0.172934189f},
-std::array<float,2>{0.591440737f, 0.0672241822f},
-std::array<float,2>{0.350441486f, 0.916163743f},
-std::array<float,2>{0.946515799f, 0.594127417f},
-std::array<float,2>{0.073135078f, 0.443678945f},
-std::array<float,2>{0.579357266f, 0.375522494f},
-std::array<float,2>{0.351677388f, 0.557059705f},
-std::array<float,2>{0.938119233f, 0.942848504f},
-std::array<float,2>{0.0661287457f, 0.0521445833f},
-std::array<float,2>{0.831747532f, 0.193269357f},
-std::array<float,2>{0.138268694f, 0.798742115f},
-std::array<float,2>{0.655952215f, 0.633532047f},
-std::array<float,2>{0.467381984f, 0.277458787f},
-std::array<float,2>{0.90534234f, 0.362194955f},
-std::array<float,2>{0.0568451062f, 0.689447224f},
-std::array<float,2>{0.505953789f, 0.814166367f},
-std::array<float,2>{0.310114712f, 0.17139034f},
-std::array<float,2>{0.725234509f, 0.0933051556f},
-std::array<float,2>{0.43353641f, 0.925520957f},
-std::array<float,2>{0.766919434f, 0.622658849f},
-std::array<float,2>{0.223565862f, 0.466255277f},
-std::array<float,2>{0.668245256f, 0.284482002f},
-std::array<float,2>{0.496922165f, 0.668646634f},
-std::array<float,2>{0.867642045f, 0.750723779f},
-std::array<float,2>{0.177346244f, 0.232900679f},
-std::array<float,2>{0.994668007f, 0.00688010966f},
-std::array<float,2>{0.110368542f, 0.995573342f},
-std::array<float,2>{0.601252854f, 0.523356795f},
-std::array<float,2>{0.321417809f, 0.407999218f},
-std::array<float,2>{0.782041073f, 0.495463073f},
-std::array<float,2>{0.205275223f, 0.569519758f},
-std::array<float,2>{0.718499005f, 0.887393892f},
-std::array<float,2>{0.400199175f, 0.120030031f},
-std::array<float,2>{0.532116115f, 0.153098211f},
-std::array<float,2>{0.259600282f, 0.862648547f},
-std::array<float,2>{0.926333666f, 0.721830249f},
-std::array<float,2>{0.00346359704f, 0.327867597f},
-std::array<float,2>{0.516067564f, 0.338777274f},
-std::array<float,2>{0.285743058f, 0.74830097f},
-std::array<float,2>{0.881767988f, 0.84435904f},
-std::array<float,2>{0.0345609412f, 0.132998556f},
-std::array<float,2>{0.754269421f, 0.10772568f},
-std::array<float,2>{0.245829314f, 0.898380816f},
-std::array<float,2>{0.748018384f, 0.590811729f},
-std::array<float,2>{0.417245895f, 0.471467435f},
-std::array<float,2>{0.954752028f, 0.434727699f},
-std::array<float,2>{0.0792963579f, 0.506267428f},
-std::array<float,2>{0.577484012f, 0.970969915f},
-std::array<float,2>{0.362850666f, 0.0208775401f},
-std::array<float,2>{0.629611969f, 0.242190033f},
-std::array<float,2>{0.450490355f, 0.778422356f},
-std::array<float,2>{0.813916624f, 0.681129694f},
-std::array<float,2>{0.155847222f, 0.305555969f},
-std::array<float,2>{0.694615662f, 0.439129472f},
-std::array<float,2>{0.37609753f, 0.600945055f},
-std::array<float,2>{0.800606728f, 0.920092463f},
-std::array<float,2>{0.192271039f, 0.0656574741f},
-std::array<float,2>{0.919214606f, 0.179609954f},
-std::array<float,2>{0.0208589435f, 0.83085376f},
-std::array<float,2>{0.559773803f, 0.703981876f},
-std::array<float,2>{0.271084964f, 0.351072907f},
-std::array<float,2>{0.850570619f, 0.262374938f},
-std::array<float,2>{0.166299984f, 0.654484689f},
-std::array<float,2>{0.684176028f, 0.78841871f},
-std::array<float,2>{0.482623994f, 0.209881395f},
-std::array<float,2>{0.612076402f, 0.0329104513f},
-std::array<float,2>{0.342440575f, 0.964726627f},
-std::array<float,2>{0.983087063f, 0.536961257f},
-std::array<float,2>{0.103402019f, 0.405085593f},
-std::array<float,2>{0.549982548f, 0.478297323f},
-std::array<float,2>{0.274414122f, 0.579419434f},
-std::array<float,2>{0.912894428f, 0.903059959f},
-std::array<float,2>{0.0242679119f, 0.0998816714f},
-std::array<float,2>{0.806174874f, 0.128140733f},
-std::array<float,2>{0.200571522f, 0.857771754f},
-std::array<float,2>{0.700715005f, 0.739769399f},
-std::array<float,2>{0.386857033f, 0.331318527f},
-std::array<float,2>{0.971100926f, 0.302746654f},
-std::array<float,2>{0.0983791053f, 0.67269206f},
-std::array<float,2>{0.618968487f, 0.770132422f},
-std::array<float,2>{0.335619628f, 0.234662279f},
-std::array<float,2>{0.675969601f, 0.03098749f},
-std::array<float,2>{0.473203212f, 0.978262722f},
-std::array<float,2>{0.855421007f, 0.513431132f},
-std::array<float,2>{0.15982832f, 0.425643027f},
-std::array<float,2>{0.739603281f, 0.357400477f},
-std::array<float,2>{0.406690896f, 0.718678117f},
-std::array<float,2>{0.759791493f, 0.836467028f},
-std::array<float,2>{0.238221452f, 0.185774758f},
-std::array<float,2>{0.885119498f, 0.0739126056f},
-std::array<float,2>{0.0414706878f, 0.907144606f},
-std::array<float,2>{0.527687609f, 0.609326482f},
-std::array<float,2>{0.292324603f, 0.447133154f},
-std::array<float,2>{0.820530593f, 0.391303062f},
-std::array<float,2>{0.145125329f, 0.541568756f},
-std::array<float,2>{0.639771163f, 0.959421575f},
-std::array<float,2>{0.439547241f, 0.0438185371f},
-std::array<float,2>{0.569901288f, 0.217353165f},
-std::array<float,2>{0.371469438f, 0.795554161f},
-std::array<float,2>{0.966438651f, 0.647929966f},
-std::array<float,2>{0.0921962112f, 0.254303187f},
-std::array<float,2>{0.603572011f, 0.269813538f},
-std::array<float,2>{0.314938396f, 0.628795445f},
-std::array<float,2>{0.985988736f, 0.804972708f},
-std::array<float,2>{0.123596363f, 0.200991035f},
-std::array<float,2>{0.864191055f, 0.0579957329f},
-std::array<float,2>{0.186944306f, 0.948750019f},
-std::array<float,2>{0.657498956f, 0.551093578f},
-std::array<float,2>{0.491716325f, 0.387122184f},
-std::array<float,2>{0.932717979f, 0.458082438f},
-std::array<float,2>{0.00825630501f, 0.613425314f},
-std::array<float,2>{0.540678442f, 0.931501925f},
-std::array<float,2>{0.251022011f, 0.0845229775f},
-std::array<float,2>{0.704631925f, 0.159539133f},
-std::array<float,2>{0.394279003f, 0.82387656f},
-std::array<float,2>{0.795580804f, 0.696015477f},
-std::array<float,2>{0.213091418f, 0.36771208f},
-std::array<float,2>{0.642848194f, 0.420699358f},
-std::array<float,2>{0.460275143f, 0.525807679f},
-std::array<float,2>{0.836497486f, 0.989574134f},
-std::array<float,2>{0.131977171f, 0.0108913621f},
-std::array<float,2>{0.9528023f, 0.224372f},
-std::array<float,2>{0.0759996176f, 0.764845788f},
-std::array<float,2>{0.5873757f, 0.657038748f},
-std::array<float,2>{0.346583813f, 0.290684223f},
-std::array<float,2>{0.774919331f, 0.316865116f},
-std::array<float,2>{0.233192891f, 0.729124069f},
-std::array<float,2>{0.73257786f, 0.870869398f},
-std::array<float,2>{0.426338732f, 0.14297007f},
-std::array<float,2>{0.510821581f, 0.11088001f},
-std::array<float,2>{0.297216684f, 0.880779207f},
-std::array<float,2>{0.89671427f, 0.573000669f},
-std::array<float,2>{0.054067038f, 0.487551063f},
-std::array<float,2>{0.555791497f, 0.417646497f},
-std::array<float,2>{0.267546624f, 0.527485132f},
-std::array<float,2>{0.914656639f, 0.986610055f},
-std::array<float,2>{0.0190204009f, 0.0151350973f},
-std::array<float,2>{0.804445207f, 0.218971461f},
-std::array<float,2>{0.19060044f, 0.759775043f},
-std::array<float,2>{0.687805593f, 0.663143635f},
-std::array<float,2>{0.381574273f, 0.293729573f},
-std::array<float,2>{0.980228066f, 0.313048035f},
-std::array<float,2>{0.106890619f, 0.733569801f},
-std::array<float,2>{0.615130305f, 0.873846591f},
-std::array<float,2>{0.336949617f, 0.14620319f},
-std::array<float,2>{0.683173239f, 0.11471349f},
-std::array<float,2>{0.480109185f, 0.876273513f},
-std::array<float,2>{0.845701993f, 0.577596188f},
-std::array<float,2>{0.170773819f, 0.490533084f},
-std::array<float,2>{0.742910981f, 0.269123286f},
-std::array<float,2>{0.42179051f, 0.631090939f},
-std::array<float,2>{0.750886858f, 0.810407221f},
-std::array<float,2>{0.248735324f, 0.195676938f},
-std::array<float,2>{0.877130091f, 0.0586604029f},
-std::array<float,2>{0.0353472382f, 0.949448287f},
-std::array<float,2>{0.520398021f, 0.548500657f},
-std::array<float,2>{0.284810424f, 0.383635938f},
-std::array<float,2>{0.816778779f, 0.455201834f},
-std::array<float,2>{0.148996875f, 0.611264586f},
-std::array<float,2>{0.626590908f, 0.937009811f},
-std::array<float,2>{0.44838962f, 0.0797397643f},
-std::array<float,2>{0.572568119f, 0.161742181f},
-std::array<float,2>{0.365925491f, 0.826037407f},
-std::array<float,2>{0.960162282f, 0.700968087f},
-std::array<float,2>{0.0829681382f, 0.373117f},
-std::array<float,2>{0.595005274f, 0.352952003f},
-std::array<float,2>{0.326314896f, 0.711316645f},
-std::array<float,2>{0.996856689f, 0.84358418f},
-std::array<float,2>{0.114452235f, 0.183307856f},
-std::array<float,2>{0.87257278f, 0.0762397572f},
-std::array<float,2>{0.175721526f, 0.912724912f},
-std::array<float,2>{0.66527909f, 0.605023086f},
-std::array<float,2>{0.492848545f, 0.452577561f},
-std::array<float,2>{0.923750937f, 0.395152181f},
-std::array<float,2>{0.00481076259f, 0.544260383f},
-std::array<float,2>{0.538441598f, 0.954414606f},
-std::array<float,2>{0.264475971f, 0.0394422039f},
-std::array<float,2>{0.711546302f, 0.211013943f},
-std::array<float,2>{0.402526289f, 0.789513171f},
-std::array<float,2>{0.787298203f, 0.643114507f},
-std::array<float,2>{0.210590571f, 0.251828104f},
-std::array<float,2>{0.648479342f, 0.481916964f},
-std::array<float,2>{0.461839586f, 0.584174931f},
-std::array<float,2>{0.833168268f, 0.901748598f},
-std::array<float,2>{0.134019881f, 0.0948137492f},
-std::array<float,2>{0.941519499f, 0.131984174f},
-std::array<float,2>{0.0679486319f, 0.852924645f},
-std::array<float,2>{0.583245575f, 0.737740219f},
-std::array<float,2>{0.357114434f, 0.335575283f},
-std::array<float,2>{0.771947324f, 0.299826384f},
-std::array<float,2>{0.220369995f, 0.675969064f},
-std::array<float,2>{0.719950259f, 0.768358231f},
-std::array<float,2>{0.433932304f, 0.239670679f},
-std::array<float,2>{0.503780425f, 0.0245834868f},
-std::array<float,2>{0.308482617f, 0.982836485f},
-std::array<float,2>{0.89875263f, 0.50807941f},
-std::array<float,2>{0.0598642826f, 0.427001238f},
-std::array<float,2>{0.593435228f, 0.444468826f},
-std::array<float,2>{0.349341273f, 0.595419168f},
-std::array<float,2>{0.94759351f, 0.917958379f},
-std::array<float,2>{0.0722647682f, 0.0677314624f},
-std::array<float,2>{0.84331733f, 0.172062606f},
-std::array<float,2>{0.125799656f, 0.832223237f},
-std::array<float,2>{0.646071672f, 0.709331691f},
-std::array<float,2>{0.455010206f, 0.347599238f},
-std::array<float,2>{0.893600285f, 0.259606391f},
-std::array<float,2>{0.0486105978f, 0.65156424f},
-std::array<float,2>{0.512192369f, 0.781828523f},
-std::array<float,2>{0.300869912f, 0.205857113f},
-std::array<float,2>{0.72850883f, 0.0365514047f},
-std::array<float,2>{0.424856097f, 0.968446791f},
-std::array<float,2>{0.777734578f, 0.531268179f},
-std::array<float,2>{0.226688892f, 0.402273327f},
-std::array<float,2>{0.66046977f, 0.341372699f},
-std::array<float,2>{0.485686779f, 0.742241144f},
-std::array<float,2>{0.861915171f, 0.85086751f},
-std::array<float,2>{0.179804683f, 0.136896223f},
-std::array<float,2>{0.990295231f, 0.102536052f},
-std::array<float,2>{0.117778249f, 0.890901804f},
-std::array<float,2>{0.60758853f, 0.588658571f},
-std::array<float,2>{0.317177027f, 0.473533064f},
-std::array<float,2>{0.792039394f, 0.431514055f},
-std::array<float,2>{0.216853276f, 0.500245631f},
-std::array<float,2>{0.70715332f, 0.975789487f},
-std::array<float,2>{0.397766382f, 0.0161357597f},
-std::array<float,2>{0.546561539f, 0.249841407f},
-std::array<float,2>{0.254817933f, 0.775689304f},
-std::array<float,2>{0.933913767f, 0.684171438f},
-std::array<float,2>{0.0145217599f, 0.309908807f},
-std::array<float,2>{0.526875913f, 0.287844718f},
-std::array<float,2>{0.294700801f, 0.665315866f},
-std::array<float,2>{0.887833357f, 0.756986618f},
-std::array<float,2>{0.0429783054f, 0.229073003f},
-std::array<float,2>{0.762206972f, 0.0013174928f},
-std::array<float,2>{0.239879772f, 0.997983932f},
-std::array<float,2>{0.737063587f, 0.519262791f},
-std::array<float,2>{0.410971761f, 0.413923264f},
-std::array<float,2>{0.962851584f, 0.499168932f},
-std::array<float,2>{0.0890139267f, 0.563882768f},
-std::array<float,2>{0.565864086f, 0.883878887f},
-std::array<float,2>{0.369268447f, 0.124121323f},
-std::array<float,2>{0.634368181f, 0.1507961f},
-std::array<float,2>{0.443230391f, 0.865932822f},
-std::array<float,2>{0.824650228f, 0.725555956f},
-std::array<float,2>{0.141027659f, 0.321993351f},
-std::array<float,2>{0.697545886f, 0.381775707f},
-std::array<float,2>{0.386221439f, 0.558807373f},
-std::array<float,2>{0.808738172f, 0.938165307f},
-std::array<float,2>{0.199003518f, 0.0483333133f},
-std::array<float,2>{0.906395078f, 0.19118394f},
-std::array<float,2>{0.0285476744f, 0.802620828f},
-std::array<float,2>{0.553162396f, 0.638686657f},
-std::array<float,2>{0.279041916f, 0.274054945f},
-std::array<float,2>{0.857403815f, 0.365091652f},
-std::array<float,2>{0.163779005f, 0.692472219f},
-std::array<float,2>{0.673013866f, 0.819037914f},
-std::array<float,2>{0.471699625f, 0.165288523f},
-std::array<float,2>{0.6220541f, 0.0898234174f},
-std::array<float,2>{0.331124842f, 0.928577304f},
-std::array<float,2>{0.973399162f, 0.617513895f},
-std::array<float,2>{0.0938359275f, 0.46116367f},
-std::array<float,2>{0.610804319f, 0.405779362f},
-std::array<float,2>{0.34058252f, 0.535876632f},
-std::array<float,2>{0.980907559f, 0.96332109f},
-std::array<float,2>{0.105024382f, 0.0313411877f},
-std::array<float,2>{0.848305106f, 0.210154012f},
-std::array<float,2>{0.164650381f, 0.787391186f},
-std::array<float,2>{0.686415911f, 0.655845404f},
-std::array<float,2>{0.481026262f, 0.263619483f},
-std::array<float,2>{0.921093702f, 0.349705964f},
-std::array<float,2>{0.0219291188f, 0.704500735f},
-std::array<float,2>{0.562127829f, 0.831615329f},
-std::array<float,2>{0.273134381f, 0.178015396f},
-std::array<float,2>{0.692937493f, 0.0649803653f},
-std::array<float,2>{0.378773957f, 0.921527088f},
-std::array<float,2>{0.798815846f, 0.600298703f},
-std::array<float,2>{0.193563312f, 0.438068092f},
-std::array<float,2>{0.63273561f, 0.306038231f},
-std::array<float,2>{0.451681554f, 0.680098593f},
-std::array<float,2>{0.816399217f, 0.778152287f},
-std::array<float,2>{0.153752416f, 0.243724287f},
-std::array<float,2>{0.955160558f, 0.0198775437f},
-std::array<float,2>{0.0807884261f, 0.971873701f},
-std::array<float,2>{0.574502647f, 0.507629037f},
-std::array<float,2>{0.359930366f, 0.433743566f},
-std::array<float,2>{0.757696867f, 0.472216457f},
-std::array<float,2>{0.242229015f, 0.591349483f},
-std::array<float,2>{0.749696672f, 0.896922469f},
-std::array<float,2>{0.414406031f, 0.108932622f},
-std::array<float,2>{0.518213809f, 0.133929491f},
-std::array<float,2>{0.287749052f, 0.845629096f},
-std::array<float,2>{0.880501986f, 0.749215782f},
-std::array<float,2>{0.0323073827f, 0.339355052f},
-std::array<float,2>{0.534589946f, 0.326814443f},
-std::array<float,2>{0.261673361f, 0.721531749f},
-std::array<float,2>{0.929086328f, 0.862129569f},
-std::array<float,2>{0.000308184681f, 0.153903544f},
-std::array<float,2>{0.783467293f, 0.120908059f},
-std::array<float,2>{0.203276679f, 0.888393462f},
-std::array<float,2>{0.716169f, 0.568660259f},
-std::array<float,2>{0.401803643f, 0.49483192f},
-std::array<float,2>{0.992605805f, 0.406754225f},
-std::array<float,2>{0.111830547f, 0.522076309f},
-std::array<float,2>{0.598168731f, 0.994189918f},
-std::array<float,2>{0.324030668f, 0.00640765671f},
-std::array<float,2>{0.670320094f, 0.234177738f},
-std::array<float,2>{0.499406695f, 0.751561701f},
-std::array<float,2>{0.871021509f, 0.669855356f},
-std::array<float,2>{0.179208264f, 0.283286512f},
-std::array<float,2>{0.723295629f, 0.465374202f},
-std::array<float,2>{0.430018276f, 0.621943176f},
-std::array<float,2>{0.768877089f, 0.924017787f},
-std::array<float,2>{0.22559908f, 0.0920666829f},
-std::array<float,2>{0.902430415f, 0.170471743f},
-std::array<float,2>{0.0549341887f, 0.812663436f},
-std::array<float,2>{0.505533636f, 0.688093185f},
-std::array<float,2>{0.31234774f, 0.362597585f},
-std::array<float,2>{0.828246832f, 0.278553009f},
-std::array<float,2>{0.139089406f, 0.633867145f},
-std::array<float,2>{0.652777612f, 0.797125816f},
-std::array<float,2>{0.465606779f, 0.191466808f},
-std::array<float,2>{0.581114888f, 0.0516655035f},
-std::array<float,2>{0.354427159f, 0.941744268f},
-std::array<float,2>{0.939461529f, 0.558591127f},
-std::array<float,2>{0.0627676696f, 0.376106769f},
-std::array<float,2>{0.508367836f, 0.486623138f},
-std::array<float,2>{0.299277127f, 0.573848069f},
-std::array<float,2>{0.895586431f, 0.878907502f},
-std::array<float,2>{0.0527093597f, 0.109580271f},
-std::array<float,2>{0.775504708f, 0.144193187f},
-std::array<float,2>{0.230587393f, 0.869392216f},
-std::array<float,2>{0.730527759f, 0.729851484f},
-std::array<float,2>{0.428942323f, 0.318009585f},
-std::array<float,2>{0.950981796f, 0.289492786f},
-std::array<float,2>{0.0767924339f, 0.657240927f},
-std::array<float,2>{0.589072526f, 0.763895035f},
-std::array<float,2>{0.344644248f, 0.223618075f},
-std::array<float,2>{0.642244637f, 0.0101583088f},
-std::array<float,2>{0.457169712f, 0.988845289f},
-std::array<float,2>{0.83941263f, 0.52702105f},
-std::array<float,2>{0.130579814f, 0.421536803f},
-std::array<float,2>{0.706587791f, 0.369134068f},
-std::array<float,2>{0.392200857f, 0.696998477f},
-std::array<float,2>{0.793972611f, 0.82262069f},
-std::array<float,2>{0.210964039f, 0.158954144f},
-std::array<float,2>{0.930033386f, 0.0850014314f},
-std::array<float,2>{0.0102438489f, 0.930036128f},
-std::array<float,2>{0.541729987f, 0.614384353f},
-std::array<float,2>{0.253424853f, 0.45793885f},
-std::array<float,2>{0.865793288f, 0.387868911f},
-std::array<float,2>{0.184183627f, 0.552575767f},
-std::array<float,2>{0.658330858f, 0.948087215f},
-std::array<float,2>{0.488681734f, 0.0567755587f},
-std::array<float,2>{0.601719439f, 0.200030506f},
-std::array<float,2>{0.313949436f, 0.806208909f},
-std::array<float,2>{0.986979842f, 0.627921641f},
-std::array<float,2>{0.122342408f, 0.270748764f},
-std::array<float,2>{0.567440927f, 0.255602181f},
-std::array<float,2>{0.37408945f, 0.647187948f},
-std::array<float,2>{0.967665136f, 0.796421707f},
-std::array<float,2>{0.0906694382f, 0.217843711f},
-std::array<float,2>{0.824061632f, 0.0439520292f},
-std::array<float,2>{0.147855774f, 0.960756481f},
-std::array<float,2>{0.63861686f, 0.542896748f},
-std::array<float,2>{0.438875526f, 0.391920984f},
-std::array<float,2>{0.882960081f, 0.446000218f},
-std::array<float,2>{0.040722087f, 0.607594609f},
-std::array<float,2>{0.530222774f, 0.907555699f},
-std::array<float,2>{0.289287031f, 0.0731561109f},
-std::array<float,2>{0.740616381f, 0.186888412f},
-std::array<float,2>{0.410142601f, 0.836988449f},
-std::array<float,2>{0.75791353f, 0.71742779f},
-std::array<float,2>{0.235289246f, 0.355733573f},
-std::array<float,2>{0.6791749f, 0.42424956f},
-std::array<float,2>{0.474957556f, 0.512117863f},
-std::array<float,2>{0.85308665f, 0.97693193f},
-std::array<float,2>{0.157487482f, 0.029925352f},
-std::array<float,2>{0.9706828f, 0.236285076f},
-std::array<float,2>{0.0998068824f, 0.771028817f},
-std::array<float,2>{0.620514512f, 0.673231184f},
-std::array<float,2>{0.332475692f, 0.304627508f},
-std::array<float,2>{0.807784915f, 0.330144316f},
-std::array<float,2>{0.201341555f, 0.738610804f},
-std::array<float,2>{0.702453971f, 0.858834267f},
-std::array<float,2>{0.38874191f, 0.127726898f},
-std::array<float,2>{0.54750818f, 0.100645356f},
-std::array<float,2>{0.275884777f, 0.90340215f},
-std::array<float,2>{0.911749482f, 0.578187585f},
-std::array<float,2>{0.0260098912f, 0.476681799f},
-std::array<float,2>{0.52204895f, 0.38592881f},
-std::array<float,2>{0.282746971f, 0.55011344f},
-std::array<float,2>{0.875017345f, 0.951224208f},
-std::array<float,2>{0.0377245769f, 0.061612457f},
-std::array<float,2>{0.753765821f, 0.19728145f},
-std::array<float,2>{0.247567639f, 0.810739338f},
-std::array<float,2>{0.744575322f, 0.629677415f},
-std::array<float,2>{0.419270188f, 0.265993237f},
-std::array<float,2>{0.957158625f, 0.372413993f},
-std::array<float,2>{0.0848981664f, 0.70213443f},
-std::array<float,2>{0.570999682f, 0.827755928f},
-std::array<float,2>{0.363667279f, 0.163971901f},
-std::array<float,2>{0.628811955f, 0.0812228248f},
-std::array<float,2>{0.447204262f, 0.93554467f},
-std::array<float,2>{0.818519652f, 0.613251507f},
-std::array<float,2>{0.150743842f, 0.454443038f},
-std::array<float,2>{0.690455914f, 0.295690298f},
-std::array<float,2>{0.379650146f, 0.661245525f},
-std::array<float,2>{0.802159667f, 0.75861913f},
-std::array<float,2>{0.188722804f, 0.221961677f},
-std::array<float,2>{0.916470826f, 0.0118142115f},
-std::array<float,2>{0.0162497964f, 0.985584199f},
-std::array<float,2>{0.557982683f, 0.529905677f},
-std::array<float,2>{0.267684996f, 0.41590938f},
-std::array<float,2>{0.845898747f, 0.490160435f},
-std::array<float,2>{0.168766871f, 0.574913681f},
-std::array<float,2>{0.680861712f, 0.877083123f},
-std::array<float,2>{0.477059931f, 0.11617171f},
-std::array<float,2>{0.61639142f, 0.147598162f},
-std::array<float,2>{0.339579403f, 0.871684432f},
-std::array<float,2>{0.976652026f, 0.730579913f},
-std::array<float,2>{0.109073088f, 0.315381855f},
-std::array<float,2>{0.584221184f, 0.33385396f},
-std::array<float,2>{0.357768774f, 0.735344768f},
-std::array<float,2>{0.944596112f, 0.853899777f},
-std::array<float,2>{0.0687221438f, 0.129908144f},
-std::array<float,2>{0.835097492f, 0.0961043388f},
-std::array<float,2>{0.135529116f, 0.899186492f},
-std::array<float,2>{0.652196705f, 0.583655417f},
-std::array<float,2>{0.463830262f, 0.482736081f},
-std::array<float,2>{0.901840627f, 0.428365827f},
-std::array<float,2>{0.0621125847f, 0.511418104f},
-std::array<float,2>{0.500147521f, 0.981574297f},
-std::array<float,2>{0.305538535f, 0.0269703958f},
-std::array<float,2>{0.721665144f, 0.24184218f},
-std::array<float,2>{0.436893702f, 0.76657474f},
-std::array<float,2>{0.771470845f, 0.678698242f},
-std::array<float,2>{0.221572399f, 0.297890007f},
-std::array<float,2>{0.667075396f, 0.450019717f},
-std::array<float,2>{0.495642424f, 0.602800071f},
-std::array<float,2>{0.874933958f, 0.911893249f},
-std::array<float,2>{0.173709884f, 0.075397566f},
-std::array<float,2>{0.998910189f, 0.180124164f},
-std::array<float,2>{0.116431721f, 0.840138435f},
-std::array<float,2>{0.597637117f, 0.714261055f},
-std::array<float,2>{0.324319452f, 0.355432928f},
-std::array<float,2>{0.786204636f, 0.252740592f},
-std::array<float,2>{0.208842352f, 0.642195046f},
-std::array<float,2>{0.712976933f, 0.792771101f},
-std::array<float,2>{0.404409111f, 0.214019224f},
-std::array<float,2>{0.536935508f, 0.0419904217f},
-std::array<float,2>{0.263570935f, 0.956022978f},
-std::array<float,2>{0.925067186f, 0.545713842f},
-std::array<float,2>{0.0067284829f, 0.39765805f},
-std::array<float,2>{0.606491804f, 0.475409687f},
-std::array<float,2>{0.319479287f, 0.587410688f},
-std::array<float,2>{0.989199162f, 0.89278084f},
-std::array<float,2>{0.121067397f, 0.104234047f},
-std::array<float,2>{0.860882819f, 0.140027121f},
-std::array<float,2>{0.183465183f, 0.848160982f},
-std::array<float,2>{0.663598061f, 0.744788766f},
-std::array<float,2>{0.487007946f, 0.342945248f},
-std::array<float,2>{0.936030984f, 0.312090278f},
-std::array<float,2>{0.0135038765f, 0.686912715f},
-std::array<float,2>{0.543426335f, 0.77412039f},
-std::array<float,2>{0.255938083f, 0.247313708f},
-std::array<float,2>{0.710520804f, 0.0190277658f},
-std::array<float,2>{0.395534635f, 0.972895741f},
-std::array<float,2>{0.789144814f, 0.502503395f},
-std::array<float,2>{0.214863002f, 0.432008237f},
-std::array<float,2>{0.647414982f, 0.343828976f},
-std::array<float,2>{0.456585079f, 0.707363188f},
-std::array<float,2>{0.840071797f, 0.834376633f},
-std::array<float,2>{0.128764555f, 0.175653562f},
-std::array<float,2>{0.946006775f, 0.0696513578f},
-std::array<float,2>{0.0735738501f, 0.915696681f},
-std::array<float,2>{0.590783894f, 0.596954763f},
-std::array<float,2>{0.351335436f, 0.442680091f},
-std::array<float,2>{0.780036688f, 0.398860455f},
-std::array<float,2>{0.228520244f, 0.534538627f},
-std::array<float,2>{0.729538321f, 0.966417789f},
-std::array<float,2>{0.423014373f, 0.0384329967f},
-std::array<float,2>{0.515604198f, 0.203386173f},
-std::array<float,2>{0.302870184f, 0.78439182f},
-std::array<float,2>{0.891893506f, 0.649622262f},
-std::array<float,2>{0.0503124185f, 0.260963321f},
-std::array<float,2>{0.552095175f, 0.277061164f},
-std::array<float,2>{0.280651391f, 0.637054384f},
-std::array<float,2>{0.909089804f, 0.803435564f},
-std::array<float,2>{0.0300551243f, 0.187780246f},
-std::array<float,2>{0.81085968f, 0.0497135781f},
-std::array<float,2>{0.196910873f, 0.940266669f},
-std::array<float,2>{0.696236134f, 0.561155975f},
-std::array<float,2>{0.384581685f, 0.379792005f},
-std::array<float,2>{0.975788713f, 0.464067638f},
-std::array<float,2>{0.0976416543f, 0.619624138f},
-std::array<float,2>{0.623987198f, 0.926182568f},
-std::array<float,2>{0.329324901f, 0.0875093117f},
-std::array<float,2>{0.67423898f, 0.167379305f},
-std::array<float,2>{0.469093531f, 0.817824423f},
-std::array<float,2>{0.857996762f, 0.693785191f},
-std::array<float,2>{0.160888076f, 0.365447223f},
-std::array<float,2>{0.734714329f, 0.410402954f},
-std::array<float,2>{0.413053125f, 0.517123461f},
-std::array<float,2>{0.765104175f, 0.998730361f},
-std::array<float,2>{0.24023813f, 0.0022440874f},
-std::array<float,2>{0.889064431f, 0.226660028f},
-std::array<float,2>{0.0463426709f, 0.755268812f},
-std::array<float,2>{0.523657858f, 0.66709435f},
-std::array<float,2>{0.295050025f, 0.286386073f},
-std::array<float,2>{0.828064978f, 0.323966861f},
-std::array<float,2>{0.143095747f, 0.723311603f},
-std::array<float,2>{0.635486364f, 0.864357829f},
-std::array<float,2>{0.443676263f, 0.149207324f},
-std::array<float,2>{0.563493907f, 0.121528395f},
-std::array<float,2>{0.367273837f, 0.884924829f},
-std::array<float,2>{0.964816451f, 0.566067457f},
-std::array<float,2>{0.0874070376f, 0.496943772f},
-std::array<float,2>{0.576369703f, 0.436006635f},
-std::array<float,2>{0.361968756f, 0.505505383f},
-std::array<float,2>{0.953455806f, 0.9702456f},
-std::array<float,2>{0.0785256997f, 0.0217500627f},
-std::array<float,2>{0.813008487f, 0.244494379f},
-std::array<float,2>{0.154712006f, 0.779826701f},
-std::array<float,2>{0.630556464f, 0.682503402f},
-std::array<float,2>{0.45010975f, 0.307838023f},
-std::array<float,2>{0.882381141f, 0.337312847f},
-std::array<float,2>{0.033941038f, 0.747428894f},
-std::array<float,2>{0.517365754f, 0.846712172f},
-std::array<float,2>{0.286519617f, 0.135112703f},
-std::array<float,2>{0.746408761f, 0.107271001f},
-std::array<float,2>{0.416361511f, 0.894987822f},
-std::array<float,2>{0.755648434f, 0.59282428f},
-std::array<float,2>{0.245041102f, 0.469294757f},
-std::array<float,2>{0.684843421f, 0.2638188f},
-std::array<float,2>{0.484271497f, 0.652604163f},
-std::array<float,2>{0.851100862f, 0.785533667f},
-std::array<float,2>{0.167923957f, 0.207863361f},
-std::array<float,2>{0.98430264f, 0.0351089947f},
-std::array<float,2>{0.101564817f, 0.961418271f},
-std::array<float,2>{0.612897396f, 0.538095117f},
-std::array<float,2>{0.342954636f, 0.404262781f},
-std::array<float,2>{0.79940778f, 0.440702438f},
-std::array<float,2>{0.193263113f, 0.598590851f},
-std::array<float,2>{0.693943977f, 0.919146359f},
-std::array<float,2>{0.375234574f, 0.0630781204f},
-std::array<float,2>{0.558692038f, 0.175827831f},
-std::array<float,2>{0.270344496f, 0.828726053f},
-std::array<float,2>{0.918864608f, 0.70672071f},
-std::array<float,2>{0.0203309953f, 0.348337889f},
-std::array<float,2>{0.507121384f, 0.360227942f},
-std::array<float,2>{0.308807075f, 0.690987468f},
-std::array<float,2>{0.90486306f, 0.814840376f},
-std::array<float,2>{0.0583258867f, 0.168784514f},
-std::array<float,2>{0.766301036f, 0.0898680314f},
-std::array<float,2>{0.223871544f, 0.9237988f},
-std::array<float,2>{0.726064742f, 0.624822021f},
-std::array<float,2>{0.432244629f, 0.468152791f},
-std::array<float,2>{0.938603222f, 0.378632098f},
-std::array<float,2>{0.0649257079f, 0.55517906f},
-std::array<float,2>{0.578635097f, 0.94521594f},
-std::array<float,2>{0.353397638f, 0.0527992807f},
-std::array<float,2>{0.65501368f, 0.194805413f},
-std::array<float,2>{0.46820417f, 0.798900962f},
-std::array<float,2>{0.830900073f, 0.636122108f},
-std::array<float,2>{0.137629598f, 0.279316127f},
-std::array<float,2>{0.716804266f, 0.493307263f},
-std::array<float,2>{0.398437709f, 0.566588223f},
-std::array<float,2>{0.782729328f, 0.890351355f},
-std::array<float,2>{0.206526011f, 0.1176873f},
-std::array<float,2>{0.927167654f, 0.154906735f},
-std::array<float,2>{0.00222272286f, 0.861058533f},
-std::array<float,2>{0.532745421f, 0.720160067f},
-std::array<float,2>{0.258162022f, 0.325775236f},
-std::array<float,2>{0.868925869f, 0.282141238f},
-std::array<float,2>{0.176590711f, 0.671810627f},
-std::array<float,2>{0.669129074f, 0.752076209f},
-std::array<float,2>{0.497855246f, 0.232290998f},
-std::array<float,2>{0.600265861f, 0.00508304732f},
-std::array<float,2>{0.320813f, 0.992599368f},
-std::array<float,2>{0.995252252f, 0.519725263f},
-std::array<float,2>{0.110088602f, 0.410067022f},
-std::array<float,2>{0.539251626f, 0.459931254f},
-std::array<float,2>{0.250650197f, 0.616995573f},
-std::array<float,2>{0.932140112f, 0.932168722f},
-std::array<float,2>{0.00973101519f, 0.0826151222f},
-std::array<float,2>{0.796289504f, 0.156991184f},
-std::array<float,2>{0.213971227f, 0.820691824f},
-std::array<float,2>{0.70361948f, 0.697514236f},
-std::array<float,2>{0.393434018f, 0.370407403f},
-std::array<float,2>{0.984790981f, 0.272824049f},
-std::array<float,2>{0.12476936f, 0.626353621f},
-std::array<float,2>{0.604581296f, 0.807631969f},
-std::array<float,2>{0.316041857f, 0.201485023f},
-std::array<float,2>{0.656394303f, 0.0555174761f},
-std::array<float,2>{0.49046877f, 0.94709903f},
-std::array<float,2>{0.864686668f, 0.553909123f},
-std::array<float,2>{0.18568857f, 0.390593886f},
-std::array<float,2>{0.73339963f, 0.319382101f},
-std::array<float,2>{0.427046955f, 0.727510631f},
-std::array<float,2>{0.773590147f, 0.868643343f},
-std::array<float,2>{0.234238803f, 0.141671762f},
-std::array<float,2>{0.897526026f, 0.111816227f},
-std::array<float,2>{0.0531738661f, 0.881088853f},
-std::array<float,2>{0.510439515f, 0.570650041f},
-std::array<float,2>{0.297861129f, 0.484945476f},
-std::array<float,2>{0.837150514f, 0.419294745f},
-std::array<float,2>{0.13156499f, 0.524984419f},
-std::array<float,2>{0.643625498f, 0.991388917f},
-std::array<float,2>{0.459232628f, 0.00870819204f},
-std::array<float,2>{0.586823165f, 0.225332484f},
-std::array<float,2>{0.347068459f, 0.762218535f},
-std::array<float,2>{0.951882184f, 0.658884764f},
-std::array<float,2>{0.0750647113f, 0.292427748f},
-std::array<float,2>{0.617705762f, 0.302408665f},
-std::array<float,2>{0.334895968f, 0.675282538f},
-std::array<float,2>{0.972543836f, 0.772358239f},
-std::array<float,2>{0.0993131399f, 0.23663184f},
-std::array<float,2>{0.853858054f, 0.0279329959f},
-std::array<float,2>{0.158351377f, 0.979597747f},
-std::array<float,2>{0.677160144f, 0.515341341f},
-std::array<float,2>{0.473796457f, 0.423517048f},
-std::array<float,2>{0.913113594f, 0.47910136f},
-std::array<float,2>{0.0247791335f, 0.581829488f},
-std::array<float,2>{0.548938513f, 0.906198919f},
-std::array<float,2>{0.274078429f, 0.0983908325f},
-std::array<float,2>{0.699539244f, 0.125348628f},
-std::array<float,2>{0.387772173f, 0.85639143f},
-std::array<float,2>{0.80479449f, 0.74196893f},
-std::array<float,2>{0.199781552f, 0.32874763f},
-std::array<float,2>{0.639027357f, 0.393690556f},
-std::array<float,2>{0.441218555f, 0.54076314f},
-std::array<float,2>{0.822084904f, 0.958942771f},
-std::array<float,2>{0.145762578f, 0.0457929149f},
-std::array<float,2>{0.965168893f, 0.2148837f},
-std::array<float,2>{0.0936565623f, 0.793192267f},
-std::array<float,2>{0.568893075f, 0.645757854f},
-std::array<float,2>{0.37249729f, 0.256723017f},
-std::array<float,2>{0.760923207f, 0.357669652f},
-std::array<float,2>{0.23657988f, 0.716045976f},
-std::array<float,2>{0.73847425f, 0.838297725f},
-std::array<float,2>{0.407788426f, 0.18514064f},
-std::array<float,2>{0.528335512f, 0.0705409721f},
-std::array<float,2>{0.291264236f, 0.909711599f},
-std::array<float,2>{0.88645035f, 0.606965184f},
-std::array<float,2>{0.0427583233f, 0.447485179f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.484930038f, 0.186994433f},
-std::array<float,2>{0.797733665f, 0.55727005f},
-std::array<float,2>{0.160225913f, 0.842984617f},
-std::array<float,2>{0.563194394f, 0.252893627f},
-std::array<float,2>{0.0435947329f, 0.426077038f},
-std::array<float,2>{0.676650465f, 0.947728693f},
-std::array<float,2>{0.336658269f, 0.650238574f},
-std::array<float,2>{0.921673119f, 0.088062562f},
-std::array<float,2>{0.267711818f, 0.371521592f},
-std::array<float,2>{0.950357139f, 0.79329294f},
-std::array<float,2>{0.0908580348f, 0.616095841f},
-std::array<float,2>{0.695723474f, 0.214554489f},
-std::array<float,2>{0.199027866f, 0.0281901564f},
-std::array<float,2>{0.529068291f, 0.700592935f},
-std::array<float,2>{0.38329044f, 0.914279878f},
-std::array<float,2>{0.837204337f, 0.449135453f},
-std::array<float,2>{0.361281514f, 0.119155221f},
-std::array<float,2>{0.876206934f, 0.686273456f},
-std::array<float,2>{0.00722686015f, 0.988285184f},
-std::array<float,2>{0.654421747f, 0.378350705f},
-std::array<float,2>{0.127742916f, 0.298535258f},
-std::array<float,2>{0.618106663f, 0.847644866f},
-std::array<float,2>{0.450961828f, 0.510507286f},
-std::array<float,2>{0.762856662f, 0.147435784f},
-std::array<float,2>{0.43390128f, 0.493468523f},
-std::array<float,2>{0.863709033f, 0.892471671f},
-std::array<float,2>{0.222887963f, 0.744306326f},
-std::array<float,2>{0.534944773f, 0.0491522066f},
-std::array<float,2>{0.10995651f, 0.229163229f},
-std::array<float,2>{0.746226072f, 0.588326275f},
-std::array<float,2>{0.283560961f, 0.7805444f},
-std::array<float,2>{0.993726552f, 0.333307236f},
-std::array<float,2>{0.397080183f, 0.039204821f},
-std::array<float,2>{0.824706316f, 0.722816586f},
-std::array<float,2>{0.211532056f, 0.882232726f},
-std::array<float,2>{0.507746398f, 0.474727303f},
-std::array<float,2>{0.0707821921f, 0.31988135f},
-std::array<float,2>{0.70840925f, 0.759328604f},
-std::array<float,2>{0.251662225f, 0.566208482f},
-std::array<float,2>{0.958901942f, 0.241899192f},
-std::array<float,2>{0.314029127f, 0.392337441f},
-std::array<float,2>{0.927397013f, 0.981143296f},
-std::array<float,2>{0.0592492484f, 0.659111857f},
-std::array<float,2>{0.665422022f, 0.0949857533f},
-std::array<float,2>{0.181291029f, 0.134271115f},
-std::array<float,2>{0.579166353f, 0.524735689f},
-std::array<float,2>{0.476073653f, 0.870344579f},
-std::array<float,2>{0.786436498f, 0.286888093f},
-std::array<float,2>{0.307184786f, 0.196667254f},
-std::array<float,2>{0.968756318f, 0.601152837f},
-std::array<float,2>{0.103551321f, 0.802556396f},
-std::array<float,2>{0.724711657f, 0.35066247f},
-std::array<float,2>{0.249943227f, 0.45584029f},
-std::array<float,2>{0.547955751f, 0.923011124f},
-std::array<float,2>{0.420949519f, 0.703455389f},
-std::array<float,2>{0.849003792f, 0.0147326598f},
-std::array<float,2>{0.455957919f, 0.276935309f},
-std::array<float,2>{0.769884825f, 0.825334787f},
-std::array<float,2>{0.148648977f, 0.544934452f},
-std::array<float,2>{0.599074662f, 0.156726539f},
-std::array<float,2>{0.0190718211f, 0.0684433877f},
-std::array<float,2>{0.636326134f, 0.632451653f},
-std::array<float,2>{0.354990035f, 0.964358568f},
-std::array<float,2>{0.897593617f, 0.419528842f},
-std::array<float,2>{0.407468259f, 0.248185784f},
-std::array<float,2>{0.855980098f, 0.575482547f},
-std::array<float,2>{0.234864876f, 0.750772715f},
-std::array<float,2>{0.555629373f, 0.323080003f},
-std::array<float,2>{0.0950204656f, 0.483951598f},
-std::array<float,2>{0.728536606f, 0.88911587f},
-std::array<float,2>{0.2978158f, 0.734341502f},
-std::array<float,2>{0.983331561f, 0.0385795049f},
-std::array<float,2>{0.346994698f, 0.290154546f},
-std::array<float,2>{0.902208984f, 0.860424519f},
-std::array<float,2>{0.0288167186f, 0.52048856f},
-std::array<float,2>{0.630630374f, 0.132567286f},
-std::array<float,2>{0.14665316f, 0.104082808f},
-std::array<float,2>{0.606353581f, 0.669960916f},
-std::array<float,2>{0.467702895f, 0.975029767f},
-std::array<float,2>{0.775635004f, 0.401060551f},
-std::array<float,2>{0.263289273f, 0.00687820185f},
-std::array<float,2>{0.962690175f, 0.716116548f},
-std::array<float,2>{0.0638490394f, 0.933236897f},
-std::array<float,2>{0.714576244f, 0.465072274f},
-std::array<float,2>{0.208708465f, 0.355038166f},
-std::array<float,2>{0.513679743f, 0.809880793f},
-std::array<float,2>{0.402067751f, 0.609151065f},
-std::array<float,2>{0.814378679f, 0.194372058f},
-std::array<float,2>{0.483539164f, 0.413488388f},
-std::array<float,2>{0.790328383f, 0.955922961f},
-std::array<float,2>{0.176592633f, 0.632898569f},
-std::array<float,2>{0.587476373f, 0.0778836831f},
-std::array<float,2>{0.0470766723f, 0.168587476f},
-std::array<float,2>{0.657577932f, 0.535345852f},
-std::array<float,2>{0.321166098f, 0.817852914f},
-std::array<float,2>{0.930664301f, 0.270822912f},
-std::array<float,2>{0.440482944f, 0.0811006799f},
-std::array<float,2>{0.755065143f, 0.644072652f},
-std::array<float,2>{0.134597421f, 0.939556241f},
-std::array<float,2>{0.614519835f, 0.429931223f},
-std::array<float,2>{0.00924875773f, 0.264119148f},
-std::array<float,2>{0.646029115f, 0.835171342f},
-std::array<float,2>{0.369714588f, 0.547824562f},
-std::array<float,2>{0.884901464f, 0.173475847f},
-std::array<float,2>{0.29047364f, 0.438947916f},
-std::array<float,2>{0.990489364f, 0.91015774f},
-std::array<float,2>{0.123158939f, 0.692057729f},
-std::array<float,2>{0.736484647f, 0.0213538837f},
-std::array<float,2>{0.228958666f, 0.206224978f},
-std::array<float,2>{0.546359241f, 0.624383271f},
-std::array<float,2>{0.428039938f, 0.785745203f},
-std::array<float,2>{0.867649615f, 0.361759245f},
-std::array<float,2>{0.335575223f, 0.154675841f},
-std::array<float,2>{0.912912071f, 0.503863573f},
-std::array<float,2>{0.0365033485f, 0.856637239f},
-std::array<float,2>{0.67969805f, 0.312378049f},
-std::array<float,2>{0.165203676f, 0.384474248f},
-std::array<float,2>{0.576693714f, 0.992513835f},
-std::array<float,2>{0.498052418f, 0.672981858f},
-std::array<float,2>{0.806477606f, 0.113010742f},
-std::array<float,2>{0.38195914f, 0.339964986f},
-std::array<float,2>{0.833141148f, 0.766221464f},
-std::array<float,2>{0.188058928f, 0.578352153f},
-std::array<float,2>{0.522186279f, 0.221446455f},
-std::array<float,2>{0.0794322565f, 0.0619086698f},
-std::array<float,2>{0.693570018f, 0.739268959f},
-std::array<float,2>{0.276750147f, 0.902570486f},
-std::array<float,2>{0.940374792f, 0.490074158f},
-std::array<float,2>{0.390460402f, 0.127946183f},
-std::array<float,2>{0.842503548f, 0.515802085f},
-std::array<float,2>{0.202405915f, 0.86677593f},
-std::array<float,2>{0.525014758f, 0.294544399f},
-std::array<float,2>{0.0894446224f, 0.40376243f},
-std::array<float,2>{0.701480627f, 0.971016645f},
-std::array<float,2>{0.271048367f, 0.666409373f},
-std::array<float,2>{0.946792841f, 0.107333243f},
-std::array<float,2>{0.343638748f, 0.326476276f},
-std::array<float,2>{0.914336026f, 0.75444442f},
-std::array<float,2>{0.0404693186f, 0.57203424f},
-std::array<float,2>{0.673308194f, 0.243318781f},
-std::array<float,2>{0.156645969f, 0.032954108f},
-std::array<float,2>{0.566922903f, 0.727659762f},
-std::array<float,2>{0.491743028f, 0.883565724f},
-std::array<float,2>{0.803018868f, 0.47717312f},
-std::array<float,2>{0.285549253f, 0.0705747902f},
-std::array<float,2>{0.998738825f, 0.638313711f},
-std::array<float,2>{0.116035506f, 0.95816046f},
-std::array<float,2>{0.743212461f, 0.409085512f},
-std::array<float,2>{0.220199734f, 0.266786993f},
-std::array<float,2>{0.537283301f, 0.815636396f},
-std::array<float,2>{0.433338314f, 0.532866418f},
-std::array<float,2>{0.862382472f, 0.166872159f},
-std::array<float,2>{0.448766977f, 0.461088449f},
-std::array<float,2>{0.76004225f, 0.933612823f},
-std::array<float,2>{0.132378116f, 0.713672042f},
-std::array<float,2>{0.62278229f, 0.00336982054f},
-std::array<float,2>{0.00215206807f, 0.190695211f},
-std::array<float,2>{0.649299979f, 0.601693213f},
-std::array<float,2>{0.366936505f, 0.805895269f},
-std::array<float,2>{0.879476249f, 0.35692969f},
-std::array<float,2>{0.469575077f, 0.0184479002f},
-std::array<float,2>{0.784070909f, 0.68981111f},
-std::array<float,2>{0.184776872f, 0.908487856f},
-std::array<float,2>{0.585902929f, 0.443327487f},
-std::array<float,2>{0.0561561957f, 0.366252244f},
-std::array<float,2>{0.670113802f, 0.783482969f},
-std::array<float,2>{0.316518188f, 0.620497823f},
-std::array<float,2>{0.925736308f, 0.209902912f},
-std::array<float,2>{0.254406124f, 0.434415609f},
-std::array<float,2>{0.956776559f, 0.944650888f},
-std::array<float,2>{0.0742643848f, 0.646599114f},
-std::array<float,2>{0.706027865f, 0.0849794f},
-std::array<float,2>{0.216100782f, 0.178269699f},
-std::array<float,2>{0.50035876f, 0.553153932f},
-std::array<float,2>{0.394515663f, 0.830735862f},
-std::array<float,2>{0.823670089f, 0.261683226f},
-std::array<float,2>{0.359034777f, 0.225018486f},
-std::array<float,2>{0.894229889f, 0.584010899f},
-std::array<float,2>{0.0210236963f, 0.772177994f},
-std::array<float,2>{0.637187839f, 0.337556034f},
-std::array<float,2>{0.154229298f, 0.48610726f},
-std::array<float,2>{0.597609401f, 0.901915491f},
-std::array<float,2>{0.45905146f, 0.734387159f},
-std::array<float,2>{0.76730001f, 0.054828193f},
-std::array<float,2>{0.41445452f, 0.30494085f},
-std::array<float,2>{0.844235182f, 0.855427265f},
-std::array<float,2>{0.244109482f, 0.507580698f},
-std::array<float,2>{0.553885281f, 0.150481358f},
-std::array<float,2>{0.105878554f, 0.11411906f},
-std::array<float,2>{0.722473085f, 0.677628934f},
-std::array<float,2>{0.31003204f, 0.999878943f},
-std::array<float,2>{0.97485584f, 0.388000995f},
-std::array<float,2>{0.462794572f, 0.218499333f},
-std::array<float,2>{0.777697563f, 0.611407995f},
-std::array<float,2>{0.140987366f, 0.789497435f},
-std::array<float,2>{0.603433788f, 0.367889166f},
-std::array<float,2>{0.0256704055f, 0.451377988f},
-std::array<float,2>{0.626541793f, 0.91907835f},
-std::array<float,2>{0.348984629f, 0.698173702f},
-std::array<float,2>{0.90563935f, 0.0237681493f},
-std::array<float,2>{0.301539749f, 0.256449372f},
-std::array<float,2>{0.978711128f, 0.837727427f},
-std::array<float,2>{0.0981428996f, 0.558862031f},
-std::array<float,2>{0.731346011f, 0.183547571f},
-std::array<float,2>{0.241051704f, 0.0931570232f},
-std::array<float,2>{0.560418963f, 0.656209767f},
-std::array<float,2>{0.412995964f, 0.952071071f},
-std::array<float,2>{0.854629397f, 0.423859477f},
-std::array<float,2>{0.32805872f, 0.0521865822f},
-std::array<float,2>{0.936160266f, 0.747289598f},
-std::array<float,2>{0.0544686466f, 0.894900918f},
-std::array<float,2>{0.66060698f, 0.497424781f},
-std::array<float,2>{0.174918681f, 0.32993108f},
-std::array<float,2>{0.592517614f, 0.774502814f},
-std::array<float,2>{0.476643175f, 0.589869618f},
-std::array<float,2>{0.795538068f, 0.232836008f},
-std::array<float,2>{0.403843492f, 0.381601661f},
-std::array<float,2>{0.8169626f, 0.986690879f},
-std::array<float,2>{0.203592375f, 0.682479262f},
-std::array<float,2>{0.508120358f, 0.122940928f},
-std::array<float,2>{0.0682100728f, 0.143238693f},
-std::array<float,2>{0.715362549f, 0.512717605f},
-std::array<float,2>{0.260880828f, 0.850253522f},
-std::array<float,2>{0.965415597f, 0.301188111f},
-std::array<float,2>{0.424588412f, 0.0991761908f},
-std::array<float,2>{0.87249428f, 0.66078335f},
-std::array<float,2>{0.232519478f, 0.978511333f},
-std::array<float,2>{0.540342569f, 0.394655257f},
-std::array<float,2>{0.118171446f, 0.282224894f},
-std::array<float,2>{0.739158094f, 0.871641099f},
-std::array<float,2>{0.293313116f, 0.52793771f},
-std::array<float,2>{0.988177299f, 0.140335128f},
-std::array<float,2>{0.374385744f, 0.470764399f},
-std::array<float,2>{0.889088333f, 0.875787497f},
-std::array<float,2>{0.0139498925f, 0.721351326f},
-std::array<float,2>{0.644325197f, 0.0433654152f},
-std::array<float,2>{0.13928476f, 0.235156462f},
-std::array<float,2>{0.611727417f, 0.567393839f},
-std::array<float,2>{0.443259984f, 0.764517665f},
-std::array<float,2>{0.751426697f, 0.313942313f},
-std::array<float,2>{0.279808789f, 0.160707667f},
-std::array<float,2>{0.94159466f, 0.541020393f},
-std::array<float,2>{0.0820982456f, 0.824022055f},
-std::array<float,2>{0.688274443f, 0.279891461f},
-std::array<float,2>{0.191909924f, 0.415271699f},
-std::array<float,2>{0.518982172f, 0.967448235f},
-std::array<float,2>{0.375631332f, 0.627709508f},
-std::array<float,2>{0.83101958f, 0.0635347739f},
-std::array<float,2>{0.492601812f, 0.347326279f},
-std::array<float,2>{0.811754107f, 0.797870338f},
-std::array<float,2>{0.170384049f, 0.597140729f},
-std::array<float,2>{0.573564351f, 0.202597603f},
-std::array<float,2>{0.0332763568f, 0.00786881614f},
-std::array<float,2>{0.685831845f, 0.709086657f},
-std::array<float,2>{0.329724163f, 0.9264853f},
-std::array<float,2>{0.909829855f, 0.459249854f},
-std::array<float,2>{0.452052474f, 0.145275503f},
-std::array<float,2>{0.764710307f, 0.50890851f},
-std::array<float,2>{0.126241535f, 0.845360458f},
-std::array<float,2>{0.619323194f, 0.299783945f},
-std::array<float,2>{0.00453007547f, 0.376662582f},
-std::array<float,2>{0.65282464f, 0.991951466f},
-std::array<float,2>{0.36194545f, 0.684376061f},
-std::array<float,2>{0.87768203f, 0.117937326f},
-std::array<float,2>{0.282643765f, 0.334128201f},
-std::array<float,2>{0.99418056f, 0.777993619f},
-std::array<float,2>{0.11233478f, 0.586602569f},
-std::array<float,2>{0.748744249f, 0.228019759f},
-std::array<float,2>{0.225280389f, 0.0481360778f},
-std::array<float,2>{0.531921864f, 0.743913531f},
-std::array<float,2>{0.43625766f, 0.892667234f},
-std::array<float,2>{0.866276622f, 0.494836897f},
-std::array<float,2>{0.338360339f, 0.0865864754f},
-std::array<float,2>{0.91897893f, 0.650471926f},
-std::array<float,2>{0.046132654f, 0.946178615f},
-std::array<float,2>{0.678670347f, 0.42865482f},
-std::array<float,2>{0.163812816f, 0.250060141f},
-std::array<float,2>{0.566050589f, 0.841524661f},
-std::array<float,2>{0.487697244f, 0.555526257f},
-std::array<float,2>{0.798909783f, 0.184514552f},
-std::array<float,2>{0.38489899f, 0.445393682f},
-std::array<float,2>{0.839232266f, 0.916662037f},
-std::array<float,2>{0.195661932f, 0.701416373f},
-std::array<float,2>{0.531041801f, 0.0297348946f},
-std::array<float,2>{0.0928304046f, 0.212266415f},
-std::array<float,2>{0.6990605f, 0.614008486f},
-std::array<float,2>{0.26673004f, 0.794977784f},
-std::array<float,2>{0.952625513f, 0.374870926f},
-std::array<float,2>{0.419751763f, 0.0135177234f},
-std::array<float,2>{0.849873364f, 0.705413997f},
-std::array<float,2>{0.247287661f, 0.924203217f},
-std::array<float,2>{0.549375474f, 0.453430921f},
-std::array<float,2>{0.102018632f, 0.348203093f},
-std::array<float,2>{0.723430693f, 0.803331554f},
-std::array<float,2>{0.304943562f, 0.599231541f},
-std::array<float,2>{0.971109867f, 0.198278323f},
-std::array<float,2>{0.352264822f, 0.420803189f},
-std::array<float,2>{0.894976139f, 0.961813033f},
-std::array<float,2>{0.0170330685f, 0.629918635f},
-std::array<float,2>{0.632924318f, 0.0683092996f},
-std::array<float,2>{0.151069045f, 0.158851251f},
-std::array<float,2>{0.600868702f, 0.543608665f},
-std::array<float,2>{0.453281432f, 0.827716589f},
-std::array<float,2>{0.771690726f, 0.274466157f},
-std::array<float,2>{0.25251478f, 0.239659995f},
-std::array<float,2>{0.960710585f, 0.563769341f},
-std::array<float,2>{0.073789753f, 0.761352956f},
-std::array<float,2>{0.710634887f, 0.316669166f},
-std::array<float,2>{0.213855043f, 0.47376892f},
-std::array<float,2>{0.505258143f, 0.880349755f},
-std::array<float,2>{0.395295203f, 0.725299776f},
-std::array<float,2>{0.826892197f, 0.0418521203f},
-std::array<float,2>{0.473128796f, 0.289033264f},
-std::array<float,2>{0.787426889f, 0.867847443f},
-std::array<float,2>{0.181709737f, 0.525499046f},
-std::array<float,2>{0.580141544f, 0.136090264f},
-std::array<float,2>{0.0615409836f, 0.0966598094f},
-std::array<float,2>{0.667720973f, 0.656492233f},
-std::array<float,2>{0.315430284f, 0.983008862f},
-std::array<float,2>{0.929397166f, 0.393481344f},
-std::array<float,2>{0.400335491f, 0.192395404f},
-std::array<float,2>{0.814825118f, 0.605558813f},
-std::array<float,2>{0.210498929f, 0.81217283f},
-std::array<float,2>{0.513314188f, 0.35285905f},
-std::array<float,2>{0.064522773f, 0.4681575f},
-std::array<float,2>{0.711998463f, 0.930860162f},
-std::array<float,2>{0.264842272f, 0.718485713f},
-std::array<float,2>{0.964637816f, 0.00582975987f},
-std::array<float,2>{0.323979884f, 0.272621512f},
-std::array<float,2>{0.932437837f, 0.819261253f},
-std::array<float,2>{0.0504097752f, 0.537136614f},
-std::array<float,2>{0.65869379f, 0.171292976f},
-std::array<float,2>{0.179336786f, 0.0761009455f},
-std::array<float,2>{0.588901639f, 0.635853648f},
-std::array<float,2>{0.481475353f, 0.953215003f},
-std::array<float,2>{0.791355073f, 0.410476416f},
-std::array<float,2>{0.299098521f, 0.0358864553f},
-std::array<float,2>{0.981629133f, 0.731013656f},
-std::array<float,2>{0.0968185738f, 0.888065517f},
-std::array<float,2>{0.727378905f, 0.480680048f},
-std::array<float,2>{0.236395493f, 0.320537657f},
-std::array<float,2>{0.556853592f, 0.753227234f},
-std::array<float,2>{0.409320325f, 0.578005731f},
-std::array<float,2>{0.858579278f, 0.246830553f},
-std::array<float,2>{0.46608299f, 0.399105191f},
-std::array<float,2>{0.773497164f, 0.974362135f},
-std::array<float,2>{0.146180615f, 0.668573976f},
-std::array<float,2>{0.608012795f, 0.102622911f},
-std::array<float,2>{0.0311714374f, 0.130453616f},
-std::array<float,2>{0.632691026f, 0.522059739f},
-std::array<float,2>{0.343757153f, 0.863190353f},
-std::array<float,2>{0.89948988f, 0.291774333f},
-std::array<float,2>{0.497476161f, 0.109784402f},
-std::array<float,2>{0.807216346f, 0.675526619f},
-std::array<float,2>{0.167285189f, 0.995328546f},
-std::array<float,2>{0.575752974f, 0.385200113f},
-std::array<float,2>{0.0377826355f, 0.308837712f},
-std::array<float,2>{0.682421744f, 0.859314024f},
-std::array<float,2>{0.333821028f, 0.500067413f},
-std::array<float,2>{0.911543965f, 0.152915806f},
-std::array<float,2>{0.273739785f, 0.490823567f},
-std::array<float,2>{0.93773073f, 0.905795813f},
-std::array<float,2>{0.0804461315f, 0.741704345f},
-std::array<float,2>{0.692838788f, 0.0589483567f},
-std::array<float,2>{0.190513343f, 0.218761876f},
-std::array<float,2>{0.521043479f, 0.580609977f},
-std::array<float,2>{0.380845249f, 0.769046187f},
-std::array<float,2>{0.835379064f, 0.342792541f},
-std::array<float,2>{0.368433923f, 0.175668478f},
-std::array<float,2>{0.884025633f, 0.550644696f},
-std::array<float,2>{0.0102967555f, 0.833039045f},
-std::array<float,2>{0.646594524f, 0.261893839f},
-std::array<float,2>{0.135104775f, 0.431769133f},
-std::array<float,2>{0.617102742f, 0.938023984f},
-std::array<float,2>{0.438194335f, 0.640766323f},
-std::array<float,2>{0.756022632f, 0.0794889927f},
-std::array<float,2>{0.425932825f, 0.360596538f},
-std::array<float,2>{0.869952321f, 0.788274825f},
-std::array<float,2>{0.226899087f, 0.622335613f},
-std::array<float,2>{0.544237792f, 0.20443365f},
-std::array<float,2>{0.122499324f, 0.0219487306f},
-std::array<float,2>{0.735304236f, 0.694356799f},
-std::array<float,2>{0.292474955f, 0.912110567f},
-std::array<float,2>{0.989535868f, 0.439996451f},
-std::array<float,2>{0.430356055f, 0.165165171f},
-std::array<float,2>{0.859796762f, 0.534196258f},
-std::array<float,2>{0.222193062f, 0.812674582f},
-std::array<float,2>{0.536661744f, 0.268205494f},
-std::array<float,2>{0.114266835f, 0.407176852f},
-std::array<float,2>{0.744427204f, 0.95936507f},
-std::array<float,2>{0.287718832f, 0.638923883f},
-std::array<float,2>{0.996108651f, 0.0740759671f},
-std::array<float,2>{0.364624172f, 0.35934332f},
-std::array<float,2>{0.881544888f, 0.806736171f},
-std::array<float,2>{0.000332626951f, 0.60429436f},
-std::array<float,2>{0.651442587f, 0.188567489f},
-std::array<float,2>{0.129109666f, 0.00109685981f},
-std::array<float,2>{0.623384297f, 0.711141944f},
-std::array<float,2>{0.445760578f, 0.935980916f},
-std::array<float,2>{0.758761048f, 0.463444978f},
-std::array<float,2>{0.271635324f, 0.108199544f},
-std::array<float,2>{0.948914707f, 0.664881349f},
-std::array<float,2>{0.0872767568f, 0.969213605f},
-std::array<float,2>{0.701150358f, 0.404334724f},
-std::array<float,2>{0.200390756f, 0.295274198f},
-std::array<float,2>{0.525972307f, 0.864434481f},
-std::array<float,2>{0.387545943f, 0.518397033f},
-std::array<float,2>{0.841170073f, 0.126531228f},
-std::array<float,2>{0.488677859f, 0.479353756f},
-std::array<float,2>{0.801702499f, 0.886631906f},
-std::array<float,2>{0.159250975f, 0.728893876f},
-std::array<float,2>{0.568671465f, 0.0347713083f},
-std::array<float,2>{0.0418007113f, 0.245462179f},
-std::array<float,2>{0.675376117f, 0.572336435f},
-std::array<float,2>{0.341257781f, 0.756754398f},
-std::array<float,2>{0.916039169f, 0.325235009f},
-std::array<float,2>{0.458256453f, 0.0575873293f},
-std::array<float,2>{0.769200861f, 0.737549245f},
-std::array<float,2>{0.155529931f, 0.900018573f},
-std::array<float,2>{0.595035255f, 0.48698625f},
-std::array<float,2>{0.0225592442f, 0.338956892f},
-std::array<float,2>{0.639781058f, 0.769613266f},
-std::array<float,2>{0.357381374f, 0.582284331f},
-std::array<float,2>{0.890729308f, 0.222811475f},
-std::array<float,2>{0.31087476f, 0.389520854f},
-std::array<float,2>{0.973059654f, 0.996315718f},
-std::array<float,2>{0.107636102f, 0.67963171f},
-std::array<float,2>{0.718808889f, 0.115653053f},
-std::array<float,2>{0.245119289f, 0.148558766f},
-std::array<float,2>{0.551610053f, 0.505186737f},
-std::array<float,2>{0.416339159f, 0.852488041f},
-std::array<float,2>{0.84685725f, 0.307266951f},
-std::array<float,2>{0.318968326f, 0.207287207f},
-std::array<float,2>{0.923345625f, 0.618501782f},
-std::array<float,2>{0.0567342751f, 0.782500803f},
-std::array<float,2>{0.668663144f, 0.365064889f},
-std::array<float,2>{0.185931757f, 0.444081515f},
-std::array<float,2>{0.582521737f, 0.907972455f},
-std::array<float,2>{0.472655237f, 0.689068198f},
-std::array<float,2>{0.781983018f, 0.0170840733f},
-std::array<float,2>{0.392354935f, 0.258478016f},
-std::array<float,2>{0.820443034f, 0.828316987f},
-std::array<float,2>{0.217945546f, 0.552502453f},
-std::array<float,2>{0.502475858f, 0.177263305f},
-std::array<float,2>{0.0761765018f, 0.0825811625f},
-std::array<float,2>{0.70507592f, 0.644718349f},
-std::array<float,2>{0.25708279f, 0.942133248f},
-std::array<float,2>{0.954816043f, 0.436478853f},
-std::array<float,2>{0.479366362f, 0.232234061f},
-std::array<float,2>{0.793731511f, 0.592367828f},
-std::array<float,2>{0.173753247f, 0.777144253f},
-std::array<float,2>{0.590242326f, 0.331539065f},
-std::array<float,2>{0.0523664467f, 0.499871105f},
-std::array<float,2>{0.663596332f, 0.897862256f},
-std::array<float,2>{0.325980902f, 0.749664366f},
-std::array<float,2>{0.934364259f, 0.0542588197f},
-std::array<float,2>{0.259197742f, 0.302881032f},
-std::array<float,2>{0.967498183f, 0.849205136f},
-std::array<float,2>{0.0697688907f, 0.514749229f},
-std::array<float,2>{0.717880011f, 0.142556086f},
-std::array<float,2>{0.206026807f, 0.123859413f},
-std::array<float,2>{0.511137068f, 0.680063903f},
-std::array<float,2>{0.405080497f, 0.985891044f},
-std::array<float,2>{0.819726884f, 0.38074401f},
-std::array<float,2>{0.351351202f, 0.0261570532f},
-std::array<float,2>{0.90410763f, 0.697213709f},
-std::array<float,2>{0.024977576f, 0.920089066f},
-std::array<float,2>{0.62848717f, 0.450612336f},
-std::array<float,2>{0.144145906f, 0.369948775f},
-std::array<float,2>{0.604618132f, 0.791178226f},
-std::array<float,2>{0.463064909f, 0.60958463f},
-std::array<float,2>{0.780709326f, 0.215799749f},
-std::array<float,2>{0.411270052f, 0.423196137f},
-std::array<float,2>{0.852924168f, 0.950434148f},
-std::array<float,2>{0.239548162f, 0.652719975f},
-std::array<float,2>{0.561906397f, 0.0917467102f},
-std::array<float,2>{0.101000875f, 0.181011617f},
-std::array<float,2>{0.733847737f, 0.561837018f},
-std::array<float,2>{0.304493129f, 0.83811456f},
-std::array<float,2>{0.977731645f, 0.254704654f},
-std::array<float,2>{0.377361715f, 0.0645347461f},
-std::array<float,2>{0.828395963f, 0.625952661f},
-std::array<float,2>{0.19523342f, 0.965093136f},
-std::array<float,2>{0.517208874f, 0.416808814f},
-std::array<float,2>{0.0848478451f, 0.278366059f},
-std::array<float,2>{0.690816224f, 0.821803272f},
-std::array<float,2>{0.277755916f, 0.540354311f},
-std::array<float,2>{0.944776654f, 0.163711786f},
-std::array<float,2>{0.331854016f, 0.457114786f},
-std::array<float,2>{0.906970859f, 0.92909354f},
-std::array<float,2>{0.0320522562f, 0.707813203f},
-std::array<float,2>{0.684627116f, 0.0110115018f},
-std::array<float,2>{0.169005916f, 0.199847221f},
-std::array<float,2>{0.570815325f, 0.595368147f},
-std::array<float,2>{0.494325608f, 0.799931765f},
-std::array<float,2>{0.810191154f, 0.345432967f},
-std::array<float,2>{0.295690119f, 0.138098925f},
-std::array<float,2>{0.985064864f, 0.530767024f},
-std::array<float,2>{0.119613804f, 0.873211324f},
-std::array<float,2>{0.740522146f, 0.284126669f},
-std::array<float,2>{0.231484205f, 0.397596538f},
-std::array<float,2>{0.541525543f, 0.978587031f},
-std::array<float,2>{0.423344553f, 0.663946927f},
-std::array<float,2>{0.874731541f, 0.10107749f},
-std::array<float,2>{0.444636136f, 0.314600855f},
-std::array<float,2>{0.75336796f, 0.763434768f},
-std::array<float,2>{0.138141155f, 0.570237219f},
-std::array<float,2>{0.610003889f, 0.2365098f},
-std::array<float,2>{0.0119182542f, 0.0464123823f},
-std::array<float,2>{0.642435133f, 0.71995306f},
-std::array<float,2>{0.372443616f, 0.878454626f},
-std::array<float,2>{0.888432086f, 0.47066316f},
-std::array<float,2>{0.47492668f, 0.135464534f},
-std::array<float,2>{0.786109209f, 0.526409507f},
-std::array<float,2>{0.179855376f, 0.868651867f},
-std::array<float,2>{0.579057574f, 0.287962824f},
-std::array<float,2>{0.0600724742f, 0.393565655f},
-std::array<float,2>{0.664394081f, 0.984087586f},
-std::array<float,2>{0.312847614f, 0.65775907f},
-std::array<float,2>{0.925993145f, 0.0969156474f},
-std::array<float,2>{0.250734359f, 0.318143547f},
-std::array<float,2>{0.957133889f, 0.760344803f},
-std::array<float,2>{0.0715297088f, 0.563113034f},
-std::array<float,2>{0.707161963f, 0.239048898f},
-std::array<float,2>{0.212612629f, 0.0423615985f},
-std::array<float,2>{0.506073773f, 0.725856721f},
-std::array<float,2>{0.398338407f, 0.879398227f},
-std::array<float,2>{0.825694442f, 0.473116219f},
-std::array<float,2>{0.353951275f, 0.0667535961f},
-std::array<float,2>{0.896707714f, 0.629107594f},
-std::array<float,2>{0.0181985609f, 0.962121367f},
-std::array<float,2>{0.634933412f, 0.421317428f},
-std::array<float,2>{0.149569362f, 0.274149537f},
-std::array<float,2>{0.598325908f, 0.826219141f},
-std::array<float,2>{0.456671357f, 0.544235229f},
-std::array<float,2>{0.771247149f, 0.159421787f},
-std::array<float,2>{0.420558631f, 0.454848677f},
-std::array<float,2>{0.847704828f, 0.925657749f},
-std::array<float,2>{0.248615384f, 0.706602097f},
-std::array<float,2>{0.547350824f, 0.0126830321f},
-std::array<float,2>{0.104778238f, 0.197754249f},
-std::array<float,2>{0.726341426f, 0.597882271f},
-std::array<float,2>{0.307966799f, 0.803730726f},
-std::array<float,2>{0.970680475f, 0.349209398f},
-std::array<float,2>{0.383981884f, 0.0303519182f},
-std::array<float,2>{0.836064279f, 0.702831805f},
-std::array<float,2>{0.198018327f, 0.917284489f},
-std::array<float,2>{0.528143525f, 0.447189778f},
-std::array<float,2>{0.0899680406f, 0.373067468f},
-std::array<float,2>{0.697087467f, 0.796459079f},
-std::array<float,2>{0.269293189f, 0.614453495f},
-std::array<float,2>{0.949596047f, 0.211115852f},
-std::array<float,2>{0.336922258f, 0.429224342f},
-std::array<float,2>{0.920710444f, 0.947053909f},
-std::array<float,2>{0.0446882918f, 0.651924133f},
-std::array<float,2>{0.677343845f, 0.0870975927f},
-std::array<float,2>{0.161605477f, 0.184783086f},
-std::array<float,2>{0.564305842f, 0.556324959f},
-std::array<float,2>{0.485686183f, 0.840495467f},
-std::array<float,2>{0.798080325f, 0.251877904f},
-std::array<float,2>{0.284594834f, 0.22713089f},
-std::array<float,2>{0.992229939f, 0.587724149f},
-std::array<float,2>{0.11075367f, 0.778879821f},
-std::array<float,2>{0.747578442f, 0.335385442f},
-std::array<float,2>{0.224287882f, 0.495890111f},
-std::array<float,2>{0.533998251f, 0.894022822f},
-std::array<float,2>{0.435509145f, 0.742683947f},
-std::array<float,2>{0.864528418f, 0.0478214547f},
-std::array<float,2>{0.449934512f, 0.300250947f},
-std::array<float,2>{0.76266259f, 0.844398379f},
-std::array<float,2>{0.127965584f, 0.508255363f},
-std::array<float,2>{0.618546009f, 0.145515949f},
-std::array<float,2>{0.00653377082f, 0.118846819f},
-std::array<float,2>{0.655864298f, 0.68492347f},
-std::array<float,2>{0.360206187f, 0.991009772f},
-std::array<float,2>{0.875951469f, 0.375824958f},
-std::array<float,2>{0.429659307f, 0.203970715f},
-std::array<float,2>{0.868367195f, 0.621353507f},
-std::array<float,2>{0.230330348f, 0.787887573f},
-std::array<float,2>{0.545491993f, 0.359739542f},
-std::array<float,2>{0.124464869f, 0.44078353f},
-std::array<float,2>{0.737813354f, 0.91373837f},
-std::array<float,2>{0.289346695f, 0.693619728f},
-std::array<float,2>{0.991959512f, 0.0230213795f},
-std::array<float,2>{0.370727748f, 0.263357103f},
-std::array<float,2>{0.886461914f, 0.832724571f},
-std::array<float,2>{0.00787420571f, 0.548913479f},
-std::array<float,2>{0.644749463f, 0.174318239f},
-std::array<float,2>{0.133333728f, 0.0785645097f},
-std::array<float,2>{0.614232302f, 0.642422557f},
-std::array<float,2>{0.440148115f, 0.939071894f},
-std::array<float,2>{0.75467205f, 0.433341384f},
-std::array<float,2>{0.275529087f, 0.0602896251f},
-std::array<float,2>{0.941085815f, 0.741165876f},
-std::array<float,2>{0.0783969834f, 0.904816568f},
-std::array<float,2>{0.694826543f, 0.491295516f},
-std::array<float,2>{0.189027622f, 0.342067122f},
-std::array<float,2>{0.522603214f, 0.768312693f},
-std::array<float,2>{0.380963594f, 0.581242383f},
-std::array<float,2>{0.832903087f, 0.220016435f},
-std::array<float,2>{0.499211669f, 0.386325777f},
-std::array<float,2>{0.804925263f, 0.994149089f},
-std::array<float,2>{0.164121091f, 0.674057961f},
-std::array<float,2>{0.577335179f, 0.110648014f},
-std::array<float,2>{0.0352763832f, 0.154071465f},
-std::array<float,2>{0.680761755f, 0.501454473f},
-std::array<float,2>{0.334853709f, 0.857979476f},
-std::array<float,2>{0.913329422f, 0.310496807f},
-std::array<float,2>{0.468358129f, 0.101595677f},
-std::array<float,2>{0.776391745f, 0.669639945f},
-std::array<float,2>{0.14777942f, 0.973204553f},
-std::array<float,2>{0.607102394f, 0.399913967f},
-std::array<float,2>{0.0279237051f, 0.292305291f},
-std::array<float,2>{0.629191816f, 0.861757815f},
-std::array<float,2>{0.345980108f, 0.522779584f},
-std::array<float,2>{0.900643766f, 0.129782051f},
-std::array<float,2>{0.298246235f, 0.482300609f},
-std::array<float,2>{0.983561754f, 0.887478888f},
-std::array<float,2>{0.0945555046f, 0.73190695f},
-std::array<float,2>{0.730326295f, 0.0365314893f},
-std::array<float,2>{0.235988885f, 0.24749817f},
-std::array<float,2>{0.556376755f, 0.576726735f},
-std::array<float,2>{0.407222331f, 0.752551496f},
-std::array<float,2>{0.856951892f, 0.321725935f},
-std::array<float,2>{0.321811706f, 0.170474708f},
-std::array<float,2>{0.929726243f, 0.538571f},
-std::array<float,2>{0.0485593006f, 0.819464862f},
-std::array<float,2>{0.657137573f, 0.272423416f},
-std::array<float,2>{0.177730814f, 0.411394417f},
-std::array<float,2>{0.586463332f, 0.954502344f},
-std::array<float,2>{0.48262015f, 0.635483861f},
-std::array<float,2>{0.789211392f, 0.0744741634f},
-std::array<float,2>{0.400411844f, 0.35245055f},
-std::array<float,2>{0.812550962f, 0.811434925f},
-std::array<float,2>{0.207265139f, 0.607333183f},
-std::array<float,2>{0.514747679f, 0.191985399f},
-std::array<float,2>{0.0625001043f, 0.00452483632f},
-std::array<float,2>{0.713241577f, 0.717287302f},
-std::array<float,2>{0.262523204f, 0.929913402f},
-std::array<float,2>{0.96103847f, 0.46681419f},
-std::array<float,2>{0.39348191f, 0.175786704f},
-std::array<float,2>{0.822616041f, 0.551513553f},
-std::array<float,2>{0.215216175f, 0.829865813f},
-std::array<float,2>{0.501420557f, 0.25927493f},
-std::array<float,2>{0.0752424523f, 0.437177837f},
-std::array<float,2>{0.706058025f, 0.942887008f},
-std::array<float,2>{0.255274475f, 0.645601273f},
-std::array<float,2>{0.955403268f, 0.0839535743f},
-std::array<float,2>{0.317441255f, 0.364081651f},
-std::array<float,2>{0.92431742f, 0.781666219f},
-std::array<float,2>{0.0552999713f, 0.617286921f},
-std::array<float,2>{0.671102107f, 0.208815932f},
-std::array<float,2>{0.184165061f, 0.0163254905f},
-std::array<float,2>{0.584005952f, 0.688305378f},
-std::array<float,2>{0.470324934f, 0.906774759f},
-std::array<float,2>{0.784964263f, 0.444414645f},
-std::array<float,2>{0.308634847f, 0.116298959f},
-std::array<float,2>{0.976075172f, 0.677844763f},
-std::array<float,2>{0.107123584f, 0.997514129f},
-std::array<float,2>{0.721650124f, 0.390618294f},
-std::array<float,2>{0.242722809f, 0.308216006f},
-std::array<float,2>{0.553512275f, 0.852616787f},
-std::array<float,2>{0.415248454f, 0.503962934f},
-std::array<float,2>{0.845032036f, 0.150040314f},
-std::array<float,2>{0.46014446f, 0.487838656f},
-std::array<float,2>{0.765884221f, 0.898551941f},
-std::array<float,2>{0.152874961f, 0.737290502f},
-std::array<float,2>{0.59571594f, 0.0577464178f},
-std::array<float,2>{0.0199699067f, 0.22418572f},
-std::array<float,2>{0.637812853f, 0.583779335f},
-std::array<float,2>{0.358083218f, 0.770986855f},
-std::array<float,2>{0.893497348f, 0.338799864f},
-std::array<float,2>{0.490633279f, 0.0336292014f},
-std::array<float,2>{0.804622114f, 0.729553342f},
-std::array<float,2>{0.157290921f, 0.885112464f},
-std::array<float,2>{0.567862034f, 0.480114669f},
-std::array<float,2>{0.039473895f, 0.324719667f},
-std::array<float,2>{0.672328353f, 0.756840229f},
-std::array<float,2>{0.342135966f, 0.574089706f},
-std::array<float,2>{0.915519714f, 0.245099917f},
-std::array<float,2>{0.269700527f, 0.405775815f},
-std::array<float,2>{0.945656717f, 0.970205784f},
-std::array<float,2>{0.0886622295f, 0.66598326f},
-std::array<float,2>{0.702654183f, 0.108536147f},
-std::array<float,2>{0.201681599f, 0.125226617f},
-std::array<float,2>{0.52379334f, 0.519117177f},
-std::array<float,2>{0.389260769f, 0.864020646f},
-std::array<float,2>{0.842951357f, 0.296433091f},
-std::array<float,2>{0.365472168f, 0.187779576f},
-std::array<float,2>{0.880852759f, 0.60526216f},
-std::array<float,2>{0.00329283206f, 0.808051944f},
-std::array<float,2>{0.649643719f, 0.358329445f},
-std::array<float,2>{0.131349936f, 0.464034379f},
-std::array<float,2>{0.621618688f, 0.936724484f},
-std::array<float,2>{0.447996318f, 0.712335527f},
-std::array<float,2>{0.760942221f, 0.000519069319f},
-std::array<float,2>{0.431722015f, 0.269151181f},
-std::array<float,2>{0.861577749f, 0.81350404f},
-std::array<float,2>{0.219534919f, 0.533407271f},
-std::array<float,2>{0.53896755f, 0.164193556f},
-std::array<float,2>{0.117072843f, 0.0731465593f},
-std::array<float,2>{0.742983758f, 0.640523672f},
-std::array<float,2>{0.286303282f, 0.960223734f},
-std::array<float,2>{0.99989754f, 0.407942086f},
-std::array<float,2>{0.442180336f, 0.238213986f},
-std::array<float,2>{0.750168025f, 0.569057047f},
-std::array<float,2>{0.139976695f, 0.761740267f},
-std::array<float,2>{0.613230288f, 0.315632194f},
-std::array<float,2>{0.0155857997f, 0.468880177f},
-std::array<float,2>{0.64266932f, 0.877340257f},
-std::array<float,2>{0.373176485f, 0.719534159f},
-std::array<float,2>{0.889685214f, 0.0457677543f},
-std::array<float,2>{0.294407248f, 0.284972131f},
-std::array<float,2>{0.986567914f, 0.874075174f},
-std::array<float,2>{0.117695473f, 0.530218661f},
-std::array<float,2>{0.740007162f, 0.137242079f},
-std::array<float,2>{0.234224856f, 0.100140698f},
-std::array<float,2>{0.539369166f, 0.662878215f},
-std::array<float,2>{0.42517218f, 0.980043948f},
-std::array<float,2>{0.871535003f, 0.397254765f},
-std::array<float,2>{0.328828394f, 0.0104633942f},
-std::array<float,2>{0.90868926f, 0.708261251f},
-std::array<float,2>{0.0343738832f, 0.927789509f},
-std::array<float,2>{0.686843097f, 0.458698392f},
-std::array<float,2>{0.171717569f, 0.34424898f},
-std::array<float,2>{0.573219657f, 0.79922843f},
-std::array<float,2>{0.494067997f, 0.593812406f},
-std::array<float,2>{0.810766995f, 0.200243801f},
-std::array<float,2>{0.376525462f, 0.417190135f},
-std::array<float,2>{0.831582367f, 0.966439366f},
-std::array<float,2>{0.192473128f, 0.626710057f},
-std::array<float,2>{0.518409073f, 0.0656533763f},
-std::array<float,2>{0.0839147493f, 0.162218899f},
-std::array<float,2>{0.689159691f, 0.539248407f},
-std::array<float,2>{0.281156421f, 0.821092486f},
-std::array<float,2>{0.943250775f, 0.277643651f},
-std::array<float,2>{0.413100064f, 0.0903939828f},
-std::array<float,2>{0.853798807f, 0.653857946f},
-std::array<float,2>{0.241887614f, 0.949789643f},
-std::array<float,2>{0.558730185f, 0.422660798f},
-std::array<float,2>{0.0995992422f, 0.255200207f},
-std::array<float,2>{0.732228279f, 0.839004338f},
-std::array<float,2>{0.30188477f, 0.560989022f},
-std::array<float,2>{0.979562283f, 0.180165499f},
-std::array<float,2>{0.348012209f, 0.449872345f},
-std::array<float,2>{0.904982448f, 0.921834052f},
-std::array<float,2>{0.0272976626f, 0.695488632f},
-std::array<float,2>{0.625318944f, 0.0266634896f},
-std::array<float,2>{0.141603261f, 0.215867281f},
-std::array<float,2>{0.602207303f, 0.610653937f},
-std::array<float,2>{0.461495101f, 0.792717636f},
-std::array<float,2>{0.77913177f, 0.370559096f},
-std::array<float,2>{0.259863973f, 0.140956581f},
-std::array<float,2>{0.965887845f, 0.513854504f},
-std::array<float,2>{0.0671824068f, 0.84798038f},
-std::array<float,2>{0.716028273f, 0.304092884f},
-std::array<float,2>{0.204794839f, 0.379304528f},
-std::array<float,2>{0.509558141f, 0.984452844f},
-std::array<float,2>{0.402992457f, 0.681334496f},
-std::array<float,2>{0.818221569f, 0.124129727f},
-std::array<float,2>{0.478013724f, 0.330663383f},
-std::array<float,2>{0.796783864f, 0.776250899f},
-std::array<float,2>{0.174799025f, 0.593490601f},
-std::array<float,2>{0.59313494f, 0.231224805f},
-std::array<float,2>{0.0536796786f, 0.0536647215f},
-std::array<float,2>{0.661385834f, 0.748604178f},
-std::array<float,2>{0.326446503f, 0.896818161f},
-std::array<float,2>{0.937151968f, 0.498198539f},
-std::array<float,2>{0.454304159f, 0.157399207f},
-std::array<float,2>{0.772795737f, 0.546185076f},
-std::array<float,2>{0.151408449f, 0.825186491f},
-std::array<float,2>{0.600527644f, 0.275932074f},
-std::array<float,2>{0.0164341126f, 0.4188402f},
-std::array<float,2>{0.634512365f, 0.963321865f},
-std::array<float,2>{0.352651089f, 0.631671727f},
-std::array<float,2>{0.896026373f, 0.0699220076f},
-std::array<float,2>{0.306289434f, 0.350494832f},
-std::array<float,2>{0.971973658f, 0.801250577f},
-std::array<float,2>{0.10347148f, 0.600200415f},
-std::array<float,2>{0.724012733f, 0.195484713f},
-std::array<float,2>{0.246280253f, 0.0144023206f},
-std::array<float,2>{0.549865425f, 0.705015242f},
-std::array<float,2>{0.418541551f, 0.921931148f},
-std::array<float,2>{0.851106405f, 0.45608446f},
-std::array<float,2>{0.315095901f, 0.0938755944f},
-std::array<float,2>{0.92824471f, 0.659462214f},
-std::array<float,2>{0.0615169965f, 0.982083023f},
-std::array<float,2>{0.666795015f, 0.390740097f},
-std::array<float,2>{0.182719603f, 0.285979748f},
-std::array<float,2>{0.581579864f, 0.869636893f},
-std::array<float,2>{0.474488378f, 0.523943365f},
-std::array<float,2>{0.788250208f, 0.133073032f},
-std::array<float,2>{0.39591381f, 0.476468027f},
-std::array<float,2>{0.827810049f, 0.881240129f},
-std::array<float,2>{0.213893846f, 0.723671138f},
-std::array<float,2>{0.504445314f, 0.0402651988f},
-std::array<float,2>{0.0724331141f, 0.240661353f},
-std::array<float,2>{0.709273756f, 0.564861178f},
-std::array<float,2>{0.253733546f, 0.758209407f},
-std::array<float,2>{0.959268391f, 0.318959922f},
-std::array<float,2>{0.436572492f, 0.0501026027f},
-std::array<float,2>{0.866045773f, 0.746055961f},
-std::array<float,2>{0.225666746f, 0.891240954f},
-std::array<float,2>{0.532398641f, 0.493026376f},
-std::array<float,2>{0.111884899f, 0.332343727f},
-std::array<float,2>{0.749089599f, 0.780023158f},
-std::array<float,2>{0.281273693f, 0.589469552f},
-std::array<float,2>{0.995409489f, 0.230459288f},
-std::array<float,2>{0.362657219f, 0.377122879f},
-std::array<float,2>{0.878324151f, 0.989373147f},
-std::array<float,2>{0.0057381494f, 0.686526775f},
-std::array<float,2>{0.653931916f, 0.120142348f},
-std::array<float,2>{0.125169098f, 0.147783577f},
-std::array<float,2>{0.620769083f, 0.51152283f},
-std::array<float,2>{0.45260179f, 0.846645176f},
-std::array<float,2>{0.764464557f, 0.297196448f},
-std::array<float,2>{0.266554534f, 0.213155091f},
-std::array<float,2>{0.951333404f, 0.616509259f},
-std::array<float,2>{0.0925119296f, 0.794080794f},
-std::array<float,2>{0.697573185f, 0.372325778f},
-std::array<float,2>{0.196418822f, 0.448101819f},
-std::array<float,2>{0.530090332f, 0.915097058f},
-std::array<float,2>{0.386090517f, 0.699531555f},
-std::array<float,2>{0.838529646f, 0.0286220722f},
-std::array<float,2>{0.48651439f, 0.253005683f},
-std::array<float,2>{0.800245225f, 0.842423856f},
-std::array<float,2>{0.162758544f, 0.558240831f},
-std::array<float,2>{0.564725578f, 0.185631886f},
-std::array<float,2>{0.0452310331f, 0.0893233195f},
-std::array<float,2>{0.679493785f, 0.649252474f},
-std::array<float,2>{0.339202672f, 0.949088931f},
-std::array<float,2>{0.917997181f, 0.426993608f},
-std::array<float,2>{0.379339188f, 0.222167537f},
-std::array<float,2>{0.834750831f, 0.579119623f},
-std::array<float,2>{0.189789608f, 0.767428756f},
-std::array<float,2>{0.51984036f, 0.341780752f},
-std::array<float,2>{0.0813134611f, 0.488534421f},
-std::array<float,2>{0.692136168f, 0.903815091f},
-std::array<float,2>{0.274773061f, 0.738726914f},
-std::array<float,2>{0.939409733f, 0.0607445091f},
-std::array<float,2>{0.332690567f, 0.311143517f},
-std::array<float,2>{0.910562396f, 0.855571926f},
-std::array<float,2>{0.0382806845f, 0.502923548f},
-std::array<float,2>{0.683422685f, 0.156234398f},
-std::array<float,2>{0.166313589f, 0.111440204f},
-std::array<float,2>{0.574505329f, 0.672713637f},
-std::array<float,2>{0.496760786f, 0.993344307f},
-std::array<float,2>{0.808492005f, 0.383037567f},
-std::array<float,2>{0.291938186f, 0.0200879164f},
-std::array<float,2>{0.989090145f, 0.692433178f},
-std::array<float,2>{0.121994019f, 0.911514223f},
-std::array<float,2>{0.735467851f, 0.437716722f},
-std::array<float,2>{0.228108078f, 0.362392545f},
-std::array<float,2>{0.543245077f, 0.786426365f},
-std::array<float,2>{0.426767498f, 0.623390317f},
-std::array<float,2>{0.870897651f, 0.205715671f},
-std::array<float,2>{0.438535422f, 0.430893183f},
-std::array<float,2>{0.756949723f, 0.940975308f},
-std::array<float,2>{0.135933399f, 0.643028617f},
-std::array<float,2>{0.615752459f, 0.0802526921f},
-std::array<float,2>{0.0111963823f, 0.172707736f},
-std::array<float,2>{0.64751792f, 0.548532546f},
-std::array<float,2>{0.367306888f, 0.834306836f},
-std::array<float,2>{0.88347441f, 0.265143394f},
-std::array<float,2>{0.480914742f, 0.0769414976f},
-std::array<float,2>{0.792426765f, 0.634385347f},
-std::array<float,2>{0.178428665f, 0.956473649f},
-std::array<float,2>{0.588496447f, 0.41226846f},
-std::array<float,2>{0.0488399565f, 0.270245552f},
-std::array<float,2>{0.659615338f, 0.816696405f},
-std::array<float,2>{0.32300669f, 0.537072957f},
-std::array<float,2>{0.933038354f, 0.169131503f},
-std::array<float,2>{0.263945699f, 0.465873361f},
-std::array<float,2>{0.963029206f, 0.932233274f},
-std::array<float,2>{0.0660714731f, 0.715629816f},
-std::array<float,2>{0.711813688f, 0.00607418083f},
-std::array<float,2>{0.209223002f, 0.194073394f},
-std::array<float,2>{0.511767447f, 0.608015895f},
-std::array<float,2>{0.399058938f, 0.8094244f},
-std::array<float,2>{0.815725982f, 0.353722513f},
-std::array<float,2>{0.345331907f, 0.130911097f},
-std::array<float,2>{0.899032593f, 0.520595789f},
-std::array<float,2>{0.0302594863f, 0.859512627f},
-std::array<float,2>{0.631343305f, 0.289721191f},
-std::array<float,2>{0.145440623f, 0.402051538f},
-std::array<float,2>{0.608416796f, 0.975837767f},
-std::array<float,2>{0.465341747f, 0.671268523f},
-std::array<float,2>{0.774932146f, 0.104570746f},
-std::array<float,2>{0.408286303f, 0.323414087f},
-std::array<float,2>{0.858309388f, 0.751525164f},
-std::array<float,2>{0.237335533f, 0.574337125f},
-std::array<float,2>{0.55825454f, 0.249330327f},
-std::array<float,2>{0.0963194147f, 0.0380327329f},
-std::array<float,2>{0.727873266f, 0.732800901f},
-std::array<float,2>{0.299954683f, 0.889825106f},
-std::array<float,2>{0.980835497f, 0.482764512f},
-std::array<float,2>{0.417193651f, 0.151812479f},
-std::array<float,2>{0.846616268f, 0.506155252f},
-std::array<float,2>{0.244341597f, 0.853794515f},
-std::array<float,2>{0.552643478f, 0.306443959f},
-std::array<float,2>{0.10862308f, 0.387507528f},
-std::array<float,2>{0.720002711f, 0.998350441f},
-std::array<float,2>{0.311677575f, 0.676353514f},
-std::array<float,2>{0.974460423f, 0.114486784f},
-std::array<float,2>{0.3556059f, 0.336582184f},
-std::array<float,2>{0.892307878f, 0.772981048f},
-std::array<float,2>{0.0218871329f, 0.58580792f},
-std::array<float,2>{0.638844192f, 0.22607778f},
-std::array<float,2>{0.15461053f, 0.0560911819f},
-std::array<float,2>{0.594574153f, 0.736110806f},
-std::array<float,2>{0.457446486f, 0.901155293f},
-std::array<float,2>{0.767737627f, 0.484560281f},
-std::array<float,2>{0.256242245f, 0.0844265595f},
-std::array<float,2>{0.953575015f, 0.647810042f},
-std::array<float,2>{0.0777300596f, 0.94414854f},
-std::array<float,2>{0.703859568f, 0.435225159f},
-std::array<float,2>{0.217386588f, 0.260186225f},
-std::array<float,2>{0.503226399f, 0.831383586f},
-std::array<float,2>{0.390859634f, 0.554591596f},
-std::array<float,2>{0.821587026f, 0.178926066f},
-std::array<float,2>{0.471413106f, 0.441677064f},
-std::array<float,2>{0.782435298f, 0.909211636f},
-std::array<float,2>{0.187308475f, 0.690957606f},
-std::array<float,2>{0.583785236f, 0.0189233627f},
-std::array<float,2>{0.0584068559f, 0.210826635f},
-std::array<float,2>{0.669407129f, 0.620065987f},
-std::array<float,2>{0.319448382f, 0.78479445f},
-std::array<float,2>{0.922311187f, 0.365615129f},
-std::array<float,2>{0.446714461f, 0.00210800883f},
-std::array<float,2>{0.759587944f, 0.714456022f},
-std::array<float,2>{0.13002342f, 0.935091019f},
-std::array<float,2>{0.624355376f, 0.462685198f},
-std::array<float,2>{0.00162122643f, 0.356433451f},
-std::array<float,2>{0.651072264f, 0.805028439f},
-std::array<float,2>{0.36401099f, 0.603003621f},
-std::array<float,2>{0.882753313f, 0.19030416f},
-std::array<float,2>{0.288838327f, 0.409402996f},
-std::array<float,2>{0.99718678f, 0.957950294f},
-std::array<float,2>{0.114133261f, 0.637414396f},
-std::array<float,2>{0.745974481f, 0.0722617432f},
-std::array<float,2>{0.221228153f, 0.167331114f},
-std::array<float,2>{0.536017537f, 0.531942129f},
-std::array<float,2>{0.431123674f, 0.814959466f},
-std::array<float,2>{0.860627353f, 0.266480803f},
-std::array<float,2>{0.3404544f, 0.242615134f},
-std::array<float,2>{0.917782843f, 0.570378125f},
-std::array<float,2>{0.0423825234f, 0.754900634f},
-std::array<float,2>{0.674533904f, 0.327878892f},
-std::array<float,2>{0.158778906f, 0.477679223f},
-std::array<float,2>{0.569348097f, 0.883980274f},
-std::array<float,2>{0.490062654f, 0.727278948f},
-std::array<float,2>{0.801971078f, 0.0319544524f},
-std::array<float,2>{0.388274342f, 0.29344672f},
-std::array<float,2>{0.84008342f, 0.865443528f},
-std::array<float,2>{0.199823707f, 0.516717434f},
-std::array<float,2>{0.527214468f, 0.127222463f},
-std::array<float,2>{0.0859574378f, 0.105769649f},
-std::array<float,2>{0.699988484f, 0.667878211f},
-std::array<float,2>{0.272937208f, 0.972160399f},
-std::array<float,2>{0.948121905f, 0.402948558f},
-std::array<float,2>{0.496069223f, 0.201624975f},
-std::array<float,2>{0.809006393f, 0.595813394f},
-std::array<float,2>{0.168222845f, 0.797062159f},
-std::array<float,2>{0.571994185f, 0.346457362f},
-std::array<float,2>{0.0330891572f, 0.460852176f},
-std::array<float,2>{0.68431741f, 0.926852405f},
-std::array<float,2>{0.330815315f, 0.71035105f},
-std::array<float,2>{0.908159316f, 0.00917600468f},
-std::array<float,2>{0.278612942f, 0.280377269f},
-std::array<float,2>{0.94430691f, 0.822492599f},
-std::array<float,2>{0.085271582f, 0.542153001f},
-std::array<float,2>{0.690364718f, 0.161554307f},
-std::array<float,2>{0.193992123f, 0.0633489564f},
-std::array<float,2>{0.516555369f, 0.628384113f},
-std::array<float,2>{0.378429204f, 0.9679389f},
-std::array<float,2>{0.829564929f, 0.414874256f},
-std::array<float,2>{0.37128219f, 0.044715602f},
-std::array<float,2>{0.887191653f, 0.722411573f},
-std::array<float,2>{0.0135153132f, 0.876370847f},
-std::array<float,2>{0.640833914f, 0.472034067f},
-std::array<float,2>{0.137450278f, 0.313303977f},
-std::array<float,2>{0.611175776f, 0.765031099f},
-std::array<float,2>{0.443492532f, 0.5672701f},
-std::array<float,2>{0.752310157f, 0.235823661f},
-std::array<float,2>{0.422108501f, 0.396232337f},
-std::array<float,2>{0.873607218f, 0.977270722f},
-std::array<float,2>{0.230654731f, 0.661937654f},
-std::array<float,2>{0.542703748f, 0.098295182f},
-std::array<float,2>{0.120489761f, 0.139064893f},
-std::array<float,2>{0.74126929f, 0.529289007f},
-std::array<float,2>{0.296746492f, 0.872590363f},
-std::array<float,2>{0.985805035f, 0.282653064f},
-std::array<float,2>{0.405377507f, 0.12193758f},
-std::array<float,2>{0.819174349f, 0.683472812f},
-std::array<float,2>{0.206875205f, 0.987890124f},
-std::array<float,2>{0.510510504f, 0.382072359f},
-std::array<float,2>{0.0686697215f, 0.302208245f},
-std::array<float,2>{0.716933131f, 0.851288438f},
-std::array<float,2>{0.258455426f, 0.512128055f},
-std::array<float,2>{0.968361259f, 0.143978491f},
-std::array<float,2>{0.324977845f, 0.496160507f},
-std::array<float,2>{0.934774101f, 0.89636308f},
-std::array<float,2>{0.0511633083f, 0.746681392f},
-std::array<float,2>{0.662237287f, 0.0513341352f},
-std::array<float,2>{0.172513947f, 0.233536601f},
-std::array<float,2>{0.591291904f, 0.590889812f},
-std::array<float,2>{0.480322331f, 0.773492217f},
-std::array<float,2>{0.79462862f, 0.328187734f},
-std::array<float,2>{0.302844316f, 0.181820422f},
-std::array<float,2>{0.977012098f, 0.560184121f},
-std::array<float,2>{0.0999952853f, 0.836246967f},
-std::array<float,2>{0.733264506f, 0.257682204f},
-std::array<float,2>{0.238885686f, 0.425665736f},
-std::array<float,2>{0.560996711f, 0.95215106f},
-std::array<float,2>{0.410769612f, 0.654869258f},
-std::array<float,2>{0.852503598f, 0.0924729556f},
-std::array<float,2>{0.464755684f, 0.368225396f},
-std::array<float,2>{0.779702961f, 0.790551603f},
-std::array<float,2>{0.143117547f, 0.612402081f},
-std::array<float,2>{0.604347587f, 0.216804698f},
-std::array<float,2>{0.0239448436f, 0.0247060023f},
-std::array<float,2>{0.627707839f, 0.69911617f},
-std::array<float,2>{0.349997848f, 0.918824136f},
-std::array<float,2>{0.902574062f, 0.452995092f},
-std::array<float,2>{0.482951224f, 0.169584498f},
-std::array<float,2>{0.789997518f, 0.536619067f},
-std::array<float,2>{0.177194655f, 0.8171013f},
-std::array<float,2>{0.585979819f, 0.269840568f},
-std::array<float,2>{0.0479410701f, 0.412996501f},
-std::array<float,2>{0.656584084f, 0.956711769f},
-std::array<float,2>{0.321694672f, 0.634039223f},
-std::array<float,2>{0.930514812f, 0.0762185752f},
-std::array<float,2>{0.261845201f, 0.354260355f},
-std::array<float,2>{0.961462915f, 0.809019804f},
-std::array<float,2>{0.0631932467f, 0.60773629f},
-std::array<float,2>{0.713831007f, 0.193523318f},
-std::array<float,2>{0.207584441f, 0.00639440306f},
-std::array<float,2>{0.515364707f, 0.715018451f},
-std::array<float,2>{0.401230723f, 0.931970417f},
-std::array<float,2>{0.813114524f, 0.466726482f},
-std::array<float,2>{0.346263677f, 0.105355665f},
-std::array<float,2>{0.901019096f, 0.671438158f},
-std::array<float,2>{0.0274948832f, 0.976504505f},
-std::array<float,2>{0.629604161f, 0.401611775f},
-std::array<float,2>{0.148230538f, 0.289150149f},
-std::array<float,2>{0.606674314f, 0.859950662f},
-std::array<float,2>{0.468141735f, 0.521475255f},
-std::array<float,2>{0.777043641f, 0.131515756f},
-std::array<float,2>{0.406555533f, 0.483390301f},
-std::array<float,2>{0.856529295f, 0.890299976f},
-std::array<float,2>{0.235673249f, 0.732937515f},
-std::array<float,2>{0.555900633f, 0.0373425744f},
-std::array<float,2>{0.0938787907f, 0.24981162f},
-std::array<float,2>{0.729547203f, 0.574846625f},
-std::array<float,2>{0.298471749f, 0.751345336f},
-std::array<float,2>{0.98388958f, 0.324104577f},
-std::array<float,2>{0.381800652f, 0.0612010546f},
-std::array<float,2>{0.832301855f, 0.738930225f},
-std::array<float,2>{0.188872904f, 0.903667748f},
-std::array<float,2>{0.523373306f, 0.489175558f},
-std::array<float,2>{0.0786903352f, 0.34104389f},
-std::array<float,2>{0.694562316f, 0.766786277f},
-std::array<float,2>{0.275973886f, 0.579888582f},
-std::array<float,2>{0.940865457f, 0.222534433f},
-std::array<float,2>{0.334316581f, 0.38375327f},
-std::array<float,2>{0.914050341f, 0.994050026f},
-std::array<float,2>{0.0357281268f, 0.672147632f},
-std::array<float,2>{0.681156814f, 0.112234987f},
-std::array<float,2>{0.164665759f, 0.155446827f},
-std::array<float,2>{0.577753842f, 0.50221312f},
-std::array<float,2>{0.499914199f, 0.856137991f},
-std::array<float,2>{0.805506468f, 0.310583174f},
-std::array<float,2>{0.289626062f, 0.205149904f},
-std::array<float,2>{0.991413057f, 0.62376219f},
-std::array<float,2>{0.124740742f, 0.787086785f},
-std::array<float,2>{0.737644672f, 0.363058001f},
-std::array<float,2>{0.229773208f, 0.438323528f},
-std::array<float,2>{0.544994593f, 0.911735237f},
-std::array<float,2>{0.428894728f, 0.69288224f},
-std::array<float,2>{0.868938744f, 0.0196290761f},
-std::array<float,2>{0.439727485f, 0.264955342f},
-std::array<float,2>{0.754161835f, 0.834872782f},
-std::array<float,2>{0.13283059f, 0.547888935f},
-std::array<float,2>{0.613706589f, 0.17189151f},
-std::array<float,2>{0.00834080484f, 0.0808753073f},
-std::array<float,2>{0.6451419f, 0.643333554f},
-std::array<float,2>{0.370397627f, 0.940758586f},
-std::array<float,2>{0.885834634f, 0.431492627f},
-std::array<float,2>{0.434909791f, 0.22996068f},
-std::array<float,2>{0.864762962f, 0.588881552f},
-std::array<float,2>{0.223943904f, 0.779506981f},
-std::array<float,2>{0.533635378f, 0.332752466f},
-std::array<float,2>{0.111156926f, 0.492480099f},
-std::array<float,2>{0.747112274f, 0.891029179f},
-std::array<float,2>{0.28504917f, 0.745434284f},
-std::array<float,2>{0.993080318f, 0.0505398326f},
-std::array<float,2>{0.359709054f, 0.297659636f},
-std::array<float,2>{0.875450969f, 0.84618932f},
-std::array<float,2>{0.00617509102f, 0.510844648f},
-std::array<float,2>{0.655376077f, 0.148376554f},
-std::array<float,2>{0.128885955f, 0.121083833f},
-std::array<float,2>{0.618957937f, 0.687277913f},
-std::array<float,2>{0.4492248f, 0.990203381f},
-std::array<float,2>{0.762029052f, 0.377818912f},
-std::array<float,2>{0.268893778f, 0.0291252881f},
-std::array<float,2>{0.949819088f, 0.699984074f},
-std::array<float,2>{0.0907778069f, 0.915918946f},
-std::array<float,2>{0.696545184f, 0.447669178f},
-std::array<float,2>{0.197528452f, 0.372662961f},
-std::array<float,2>{0.527598739f, 0.794865608f},
-std::array<float,2>{0.384616226f, 0.617001593f},
-std::array<float,2>{0.83684963f, 0.213440359f},
-std::array<float,2>{0.486319751f, 0.427263141f},
-std::array<float,2>{0.798637688f, 0.948313355f},
-std::array<float,2>{0.162092716f, 0.648678124f},
-std::array<float,2>{0.563542783f, 0.0896577463f},
-std::array<float,2>{0.0440223552f, 0.186490148f},
-std::array<float,2>{0.677036226f, 0.557673931f},
-std::array<float,2>{0.337739557f, 0.841984808f},
-std::array<float,2>{0.9203403f, 0.253730118f},
-std::array<float,2>{0.456434906f, 0.0695969015f},
-std::array<float,2>{0.770729423f, 0.631088674f},
-std::array<float,2>{0.150343075f, 0.963464499f},
-std::array<float,2>{0.597744524f, 0.418396503f},
-std::array<float,2>{0.0180227421f, 0.275765002f},
-std::array<float,2>{0.635572135f, 0.824324965f},
-std::array<float,2>{0.354403555f, 0.546473026f},
-std::array<float,2>{0.897337496f, 0.158036515f},
-std::array<float,2>{0.308177352f, 0.456795722f},
-std::array<float,2>{0.969935954f, 0.922804534f},
-std::array<float,2>{0.105466492f, 0.704162359f},
-std::array<float,2>{0.725618243f, 0.0137572177f},
-std::array<float,2>{0.248526111f, 0.195911735f},
-std::array<float,2>{0.547510445f, 0.600054979f},
-std::array<float,2>{0.420365572f, 0.801443934f},
-std::array<float,2>{0.848313093f, 0.349949181f},
-std::array<float,2>{0.313337296f, 0.133658156f},
-std::array<float,2>{0.92633599f, 0.523599207f},
-std::array<float,2>{0.059874773f, 0.869449675f},
-std::array<float,2>{0.664935887f, 0.285363793f},
-std::array<float,2>{0.180441156f, 0.391204566f},
-std::array<float,2>{0.578251839f, 0.98149693f},
-std::array<float,2>{0.47521916f, 0.660104036f},
-std::array<float,2>{0.785213232f, 0.0943653286f},
-std::array<float,2>{0.397463739f, 0.318543226f},
-std::array<float,2>{0.825617433f, 0.758706868f},
-std::array<float,2>{0.212242365f, 0.56519866f},
-std::array<float,2>{0.506689727f, 0.241157308f},
-std::array<float,2>{0.072216779f, 0.0406858027f},
-std::array<float,2>{0.707973897f, 0.724219978f},
-std::array<float,2>{0.250124067f, 0.881634533f},
-std::array<float,2>{0.957669973f, 0.4756051f},
-std::array<float,2>{0.402637959f, 0.14449209f},
-std::array<float,2>{0.817440748f, 0.512229025f},
-std::array<float,2>{0.204391643f, 0.851028681f},
-std::array<float,2>{0.509114265f, 0.302555561f},
-std::array<float,2>{0.0667337477f, 0.382427812f},
-std::array<float,2>{0.716341317f, 0.987559319f},
-std::array<float,2>{0.260611862f, 0.682687283f},
-std::array<float,2>{0.966701686f, 0.121566162f},
-std::array<float,2>{0.326747924f, 0.328818411f},
-std::array<float,2>{0.936884642f, 0.774067998f},
-std::array<float,2>{0.0531639792f, 0.59161675f},
-std::array<float,2>{0.661790729f, 0.234006584f},
-std::array<float,2>{0.173895195f, 0.0508569479f},
-std::array<float,2>{0.593412638f, 0.74636972f},
-std::array<float,2>{0.478326529f, 0.895552814f},
-std::array<float,2>{0.796130598f, 0.496806324f},
-std::array<float,2>{0.302368701f, 0.0919066444f},
-std::array<float,2>{0.980269611f, 0.654401004f},
-std::array<float,2>{0.0989807546f, 0.952813387f},
-std::array<float,2>{0.731681108f, 0.425189406f},
-std::array<float,2>{0.241460964f, 0.257073343f},
-std::array<float,2>{0.559420347f, 0.836731553f},
-std::array<float,2>{0.414003462f, 0.560052454f},
-std::array<float,2>{0.854479849f, 0.182468429f},
-std::array<float,2>{0.461081684f, 0.452350259f},
-std::array<float,2>{0.778508604f, 0.918121099f},
-std::array<float,2>{0.142119721f, 0.698652387f},
-std::array<float,2>{0.601764381f, 0.0253545716f},
-std::array<float,2>{0.0268410798f, 0.217439592f},
-std::array<float,2>{0.625884473f, 0.613269687f},
-std::array<float,2>{0.348386914f, 0.79010278f},
-std::array<float,2>{0.904772401f, 0.369080812f},
-std::array<float,2>{0.49337402f, 0.00963359512f},
-std::array<float,2>{0.811234891f, 0.710518479f},
-std::array<float,2>{0.171151236f, 0.927477241f},
-std::array<float,2>{0.572352171f, 0.460042745f},
-std::array<float,2>{0.0351172797f, 0.34573707f},
-std::array<float,2>{0.687463701f, 0.797818244f},
-std::array<float,2>{0.328487188f, 0.596428394f},
-std::array<float,2>{0.909007311f, 0.201729402f},
-std::array<float,2>{0.280324399f, 0.414379954f},
-std::array<float,2>{0.942642987f, 0.968660891f},
-std::array<float,2>{0.0831200778f, 0.628619969f},
-std::array<float,2>{0.688644588f, 0.0627719536f},
-std::array<float,2>{0.192988843f, 0.161884725f},
-std::array<float,2>{0.517808378f, 0.542583287f},
-std::array<float,2>{0.376146019f, 0.82310307f},
-std::array<float,2>{0.831485808f, 0.280817747f},
-std::array<float,2>{0.373895228f, 0.236134008f},
-std::array<float,2>{0.89027828f, 0.566494703f},
-std::array<float,2>{0.0147158392f, 0.765494704f},
-std::array<float,2>{0.643109262f, 0.312960744f},
-std::array<float,2>{0.140217096f, 0.472531676f},
-std::array<float,2>{0.612632275f, 0.876885355f},
-std::array<float,2>{0.441523165f, 0.721973479f},
-std::array<float,2>{0.750783622f, 0.0441046096f},
-std::array<float,2>{0.425775379f, 0.282924354f},
-std::array<float,2>{0.871933222f, 0.872303367f},
-std::array<float,2>{0.233575523f, 0.528663039f},
-std::array<float,2>{0.539788961f, 0.139323786f},
-std::array<float,2>{0.117349237f, 0.0978689566f},
-std::array<float,2>{0.739640117f, 0.661538839f},
-std::array<float,2>{0.294597834f, 0.976786017f},
-std::array<float,2>{0.987188935f, 0.395822704f},
-std::array<float,2>{0.447290748f, 0.189454079f},
-std::array<float,2>{0.761624634f, 0.603402317f},
-std::array<float,2>{0.131272495f, 0.805391669f},
-std::array<float,2>{0.621311784f, 0.355736405f},
-std::array<float,2>{0.00347161666f, 0.46208781f},
-std::array<float,2>{0.650309682f, 0.934825599f},
-std::array<float,2>{0.366153419f, 0.714010835f},
-std::array<float,2>{0.880013108f, 0.0028193756f},
-std::array<float,2>{0.287097842f, 0.266082585f},
-std::array<float,2>{0.999072433f, 0.814921021f},
-std::array<float,2>{0.11655429f, 0.53163451f},
-std::array<float,2>{0.742567718f, 0.167529881f},
-std::array<float,2>{0.219146952f, 0.0716928616f},
-std::array<float,2>{0.538167477f, 0.636918366f},
-std::array<float,2>{0.432133406f, 0.957244575f},
-std::array<float,2>{0.862010181f, 0.410101354f},
-std::array<float,2>{0.34248513f, 0.0316930525f},
-std::array<float,2>{0.915903986f, 0.726708531f},
-std::array<float,2>{0.0398244038f, 0.884358704f},
-std::array<float,2>{0.672455311f, 0.478358895f},
-std::array<float,2>{0.158066258f, 0.32756871f},
-std::array<float,2>{0.56827724f, 0.755843163f},
-std::array<float,2>{0.490834862f, 0.571124613f},
-std::array<float,2>{0.803930759f, 0.243134931f},
-std::array<float,2>{0.388731301f, 0.402801722f},
-std::array<float,2>{0.843646407f, 0.972394526f},
-std::array<float,2>{0.201501712f, 0.667381048f},
-std::array<float,2>{0.524141371f, 0.105998337f},
-std::array<float,2>{0.0883437917f, 0.12769559f},
-std::array<float,2>{0.702305138f, 0.517561436f},
-std::array<float,2>{0.270152062f, 0.865846992f},
-std::array<float,2>{0.946111381f, 0.293495685f},
-std::array<float,2>{0.415952057f, 0.115096398f},
-std::array<float,2>{0.8452335f, 0.6760692f},
-std::array<float,2>{0.242589876f, 0.998579502f},
-std::array<float,2>{0.553169847f, 0.387141973f},
-std::array<float,2>{0.106658839f, 0.305714399f},
-std::array<float,2>{0.720800936f, 0.854059339f},
-std::array<float,2>{0.309323996f, 0.506703079f},
-std::array<float,2>{0.975943446f, 0.152225003f},
-std::array<float,2>{0.357648641f, 0.484926522f},
-std::array<float,2>{0.893033206f, 0.900750816f},
-std::array<float,2>{0.0203330908f, 0.73577714f},
-std::array<float,2>{0.638496578f, 0.056306459f},
-std::array<float,2>{0.152797937f, 0.22603941f},
-std::array<float,2>{0.596460998f, 0.585448921f},
-std::array<float,2>{0.460704505f, 0.772823155f},
-std::array<float,2>{0.766539812f, 0.336171865f},
-std::array<float,2>{0.255509853f, 0.179379448f},
-std::array<float,2>{0.955986321f, 0.554195762f},
-std::array<float,2>{0.0760144293f, 0.831757963f},
-std::array<float,2>{0.706778646f, 0.260501057f},
-std::array<float,2>{0.215550557f, 0.435046643f},
-std::array<float,2>{0.501684189f, 0.943395913f},
-std::array<float,2>{0.392881989f, 0.648405969f},
-std::array<float,2>{0.822892129f, 0.0848168656f},
-std::array<float,2>{0.469834238f, 0.366166621f},
-std::array<float,2>{0.784508288f, 0.784448922f},
-std::array<float,2>{0.183766678f, 0.619241893f},
-std::array<float,2>{0.584697485f, 0.210441336f},
-std::array<float,2>{0.0551249534f, 0.0191317778f},
-std::array<float,2>{0.671710432f, 0.690505326f},
-std::array<float,2>{0.318048626f, 0.910039008f},
-std::array<float,2>{0.924014866f, 0.441928267f},
-std::array<float,2>{0.464994431f, 0.129369959f},
-std::array<float,2>{0.774737298f, 0.52311486f},
-std::array<float,2>{0.14493221f, 0.862201512f},
-std::array<float,2>{0.609336376f, 0.29289934f},
-std::array<float,2>{0.0297003239f, 0.399526477f},
-std::array<float,2>{0.631721199f, 0.972796321f},
-std::array<float,2>{0.34495607f, 0.669233203f},
-std::array<float,2>{0.898825824f, 0.1023665f},
-std::array<float,2>{0.300300539f, 0.321908146f},
-std::array<float,2>{0.981139004f, 0.752299964f},
-std::array<float,2>{0.0960227847f, 0.576610148f},
-std::array<float,2>{0.728280246f, 0.247777298f},
-std::array<float,2>{0.237801954f, 0.0369343236f},
-std::array<float,2>{0.557687819f, 0.732028306f},
-std::array<float,2>{0.409034669f, 0.887115896f},
-std::array<float,2>{0.857783079f, 0.481891334f},
-std::array<float,2>{0.32270962f, 0.0748827755f},
-std::array<float,2>{0.933264971f, 0.634901404f},
-std::array<float,2>{0.0494287573f, 0.954815567f},
-std::array<float,2>{0.660096526f, 0.412087142f},
-std::array<float,2>{0.177872121f, 0.271559447f},
-std::array<float,2>{0.587967098f, 0.820105672f},
-std::array<float,2>{0.481417626f, 0.538697839f},
-std::array<float,2>{0.79273206f, 0.17016995f},
-std::array<float,2>{0.398903489f, 0.467285424f},
-std::array<float,2>{0.815922916f, 0.930276215f},
-std::array<float,2>{0.209834918f, 0.716862082f},
-std::array<float,2>{0.512249887f, 0.0039659231f},
-std::array<float,2>{0.0656056181f, 0.191665143f},
-std::array<float,2>{0.711327136f, 0.606886566f},
-std::array<float,2>{0.264292181f, 0.810622692f},
-std::array<float,2>{0.963422894f, 0.351985842f},
-std::array<float,2>{0.427527845f, 0.0228512958f},
-std::array<float,2>{0.87058872f, 0.694018543f},
-std::array<float,2>{0.227590978f, 0.913151979f},
-std::array<float,2>{0.54374969f, 0.441004604f},
-std::array<float,2>{0.121480301f, 0.360196084f},
-std::array<float,2>{0.735855579f, 0.787428141f},
-std::array<float,2>{0.291452795f, 0.622026086f},
-std::array<float,2>{0.98865813f, 0.203137994f},
-std::array<float,2>{0.367805988f, 0.433095783f},
-std::array<float,2>{0.88288033f, 0.938773334f},
-std::array<float,2>{0.0116492631f, 0.641730249f},
-std::array<float,2>{0.648328245f, 0.0786409527f},
-std::array<float,2>{0.136443123f, 0.174055085f},
-std::array<float,2>{0.615327239f, 0.549602389f},
-std::array<float,2>{0.439347535f, 0.832174778f},
-std::array<float,2>{0.757354498f, 0.262868077f},
-std::array<float,2>{0.275083154f, 0.220548928f},
-std::array<float,2>{0.938852966f, 0.581990778f},
-std::array<float,2>{0.0815470144f, 0.76782161f},
-std::array<float,2>{0.691857457f, 0.342767268f},
-std::array<float,2>{0.19026126f, 0.491878211f},
-std::array<float,2>{0.520439386f, 0.904648721f},
-std::array<float,2>{0.379822135f, 0.740563393f},
-std::array<float,2>{0.834050417f, 0.060001675f},
-std::array<float,2>{0.496238351f, 0.310057253f},
-std::array<float,2>{0.807794333f, 0.857752502f},
-std::array<float,2>{0.166808784f, 0.501549125f},
-std::array<float,2>{0.575028658f, 0.153738528f},
-std::array<float,2>{0.0390624776f, 0.110852227f},
-std::array<float,2>{0.683039129f, 0.674758613f},
-std::array<float,2>{0.332323045f, 0.994740725f},
-std::array<float,2>{0.91093123f, 0.38594842f},
-std::array<float,2>{0.386306852f, 0.211458385f},
-std::array<float,2>{0.838277698f, 0.614863276f},
-std::array<float,2>{0.197063565f, 0.796124935f},
-std::array<float,2>{0.529550374f, 0.373987466f},
-std::array<float,2>{0.0922393948f, 0.446723819f},
-std::array<float,2>{0.698031425f, 0.917907298f},
-std::array<float,2>{0.265861332f, 0.70230031f},
-std::array<float,2>{0.951750815f, 0.0308942851f},
-std::array<float,2>{0.339515924f, 0.251098871f},
-std::array<float,2>{0.91878134f, 0.840083361f},
-std::array<float,2>{0.045486819f, 0.556018174f},
-std::array<float,2>{0.678747296f, 0.18538788f},
-std::array<float,2>{0.16250886f, 0.0875120386f},
-std::array<float,2>{0.565307796f, 0.651604235f},
-std::array<float,2>{0.487084299f, 0.946520805f},
-std::array<float,2>{0.800295591f, 0.428936481f},
-std::array<float,2>{0.282175213f, 0.047343269f},
-std::array<float,2>{0.995984316f, 0.742395222f},
-std::array<float,2>{0.111505561f, 0.894382894f},
-std::array<float,2>{0.749675632f, 0.495152473f},
-std::array<float,2>{0.226302654f, 0.335736483f},
-std::array<float,2>{0.532878518f, 0.778385878f},
-std::array<float,2>{0.437304705f, 0.586999357f},
-std::array<float,2>{0.865418613f, 0.226781726f},
-std::array<float,2>{0.452905446f, 0.375207186f},
-std::array<float,2>{0.764056623f, 0.990430892f},
-std::array<float,2>{0.125678167f, 0.685068369f},
-std::array<float,2>{0.620124638f, 0.118562147f},
-std::array<float,2>{0.00520931277f, 0.146152899f},
-std::array<float,2>{0.653793693f, 0.508328319f},
-std::array<float,2>{0.362835437f, 0.843778491f},
-std::array<float,2>{0.878809094f, 0.300471961f},
-std::array<float,2>{0.474109203f, 0.0974416658f},
-std::array<float,2>{0.788759768f, 0.657693148f},
-std::array<float,2>{0.183230311f, 0.983885467f},
-std::array<float,2>{0.581434131f, 0.394117653f},
-std::array<float,2>{0.0605817214f, 0.287135124f},
-std::array<float,2>{0.666044533f, 0.868776917f},
-std::array<float,2>{0.314776361f, 0.527139127f},
-std::array<float,2>{0.927930772f, 0.135072798f},
-std::array<float,2>{0.253181785f, 0.473553151f},
-std::array<float,2>{0.959746778f, 0.879057646f},
-std::array<float,2>{0.0731518492f, 0.726111472f},
-std::array<float,2>{0.709894538f, 0.0428937748f},
-std::array<float,2>{0.214486256f, 0.238567799f},
-std::array<float,2>{0.504104733f, 0.562980175f},
-std::array<float,2>{0.396374673f, 0.759837985f},
-std::array<float,2>{0.82746774f, 0.317720383f},
-std::array<float,2>{0.353483707f, 0.159745514f},
-std::array<float,2>{0.895853519f, 0.544483006f},
-std::array<float,2>{0.0157608297f, 0.8268888f},
-std::array<float,2>{0.633961797f, 0.27377063f},
-std::array<float,2>{0.152044073f, 0.421699494f},
-std::array<float,2>{0.600089967f, 0.962480664f},
-std::array<float,2>{0.454873592f, 0.62954706f},
-std::array<float,2>{0.773048341f, 0.0671712235f},
-std::array<float,2>{0.418415636f, 0.348869145f},
-std::array<float,2>{0.850893199f, 0.804331422f},
-std::array<float,2>{0.246694639f, 0.598389208f},
-std::array<float,2>{0.550690711f, 0.19735986f},
-std::array<float,2>{0.102737255f, 0.012035273f},
-std::array<float,2>{0.724160612f, 0.706307709f},
-std::array<float,2>{0.30611673f, 0.925150156f},
-std::array<float,2>{0.97232312f, 0.454378933f},
-std::array<float,2>{0.410442919f, 0.180502817f},
-std::array<float,2>{0.851868629f, 0.561369538f},
-std::array<float,2>{0.238701582f, 0.839785337f},
-std::array<float,2>{0.561492682f, 0.255802035f},
-std::array<float,2>{0.100440547f, 0.42195338f},
-std::array<float,2>{0.732630074f, 0.94958961f},
-std::array<float,2>{0.303706378f, 0.653754592f},
-std::array<float,2>{0.977411449f, 0.0901817232f},
-std::array<float,2>{0.350440323f, 0.371012479f},
-std::array<float,2>{0.903119445f, 0.79243201f},
-std::array<float,2>{0.0238724761f, 0.611291707f},
-std::array<float,2>{0.627285302f, 0.216586813f},
-std::array<float,2>{0.14272958f, 0.0273365732f},
-std::array<float,2>{0.603741467f, 0.695907593f},
-std::array<float,2>{0.463897854f, 0.921004295f},
-std::array<float,2>{0.780088127f, 0.449276626f},
-std::array<float,2>{0.258071721f, 0.124896929f},
-std::array<float,2>{0.968079805f, 0.680890679f},
-std::array<float,2>{0.0689408109f, 0.985280454f},
-std::array<float,2>{0.717355192f, 0.379614443f},
-std::array<float,2>{0.206080988f, 0.304496318f},
-std::array<float,2>{0.509799302f, 0.848213732f},
-std::array<float,2>{0.406146348f, 0.514371991f},
-std::array<float,2>{0.81879884f, 0.141508132f},
-std::array<float,2>{0.479507565f, 0.498918235f},
-std::array<float,2>{0.794073403f, 0.89726162f},
-std::array<float,2>{0.172019348f, 0.748231113f},
-std::array<float,2>{0.591701746f, 0.0529471934f},
-std::array<float,2>{0.0515386537f, 0.23073338f},
-std::array<float,2>{0.662932575f, 0.593203247f},
-std::array<float,2>{0.324616045f, 0.775611401f},
-std::array<float,2>{0.935242355f, 0.330164373f},
-std::array<float,2>{0.443900347f, 0.0450157635f},
-std::array<float,2>{0.752489448f, 0.719083667f},
-std::array<float,2>{0.136768535f, 0.877870321f},
-std::array<float,2>{0.610689938f, 0.469263226f},
-std::array<float,2>{0.0130216544f, 0.316093624f},
-std::array<float,2>{0.641563416f, 0.762408614f},
-std::array<float,2>{0.371665299f, 0.568517625f},
-std::array<float,2>{0.887407243f, 0.237751499f},
-std::array<float,2>{0.296013832f, 0.396749645f},
-std::array<float,2>{0.986089289f, 0.979607403f},
-std::array<float,2>{0.120868608f, 0.662111461f},
-std::array<float,2>{0.741962373f, 0.100087941f},
-std::array<float,2>{0.231310591f, 0.137060344f},
-std::array<float,2>{0.542195678f, 0.529328942f},
-std::array<float,2>{0.422456086f, 0.874739885f},
-std::array<float,2>{0.873389542f, 0.284656405f},
-std::array<float,2>{0.330495805f, 0.201063603f},
-std::array<float,2>{0.90755111f, 0.59454596f},
-std::array<float,2>{0.0326199606f, 0.799587429f},
-std::array<float,2>{0.683931589f, 0.344043374f},
-std::array<float,2>{0.168538436f, 0.458461463f},
-std::array<float,2>{0.571357489f, 0.928497434f},
-std::array<float,2>{0.495463431f, 0.708680391f},
-std::array<float,2>{0.809379518f, 0.010207939f},
-std::array<float,2>{0.378330439f, 0.277980328f},
-std::array<float,2>{0.829916298f, 0.820417345f},
-std::array<float,2>{0.193715289f, 0.539979994f},
-std::array<float,2>{0.51604408f, 0.16262652f},
-std::array<float,2>{0.0856532007f, 0.065939568f},
-std::array<float,2>{0.689718008f, 0.626064539f},
-std::array<float,2>{0.279260904f, 0.966282845f},
-std::array<float,2>{0.943600953f, 0.417853743f},
-std::array<float,2>{0.489433795f, 0.244503647f},
-std::array<float,2>{0.802711487f, 0.573362231f},
-std::array<float,2>{0.158538908f, 0.757664323f},
-std::array<float,2>{0.56993252f, 0.324264795f},
-std::array<float,2>{0.0424998365f, 0.479933113f},
-std::array<float,2>{0.674253047f, 0.88559103f},
-std::array<float,2>{0.340292096f, 0.730064273f},
-std::array<float,2>{0.917426527f, 0.0337225795f},
-std::array<float,2>{0.273111671f, 0.295968622f},
-std::array<float,2>{0.947591245f, 0.863465846f},
-std::array<float,2>{0.0864741281f, 0.518930733f},
-std::array<float,2>{0.699267864f, 0.125892341f},
-std::array<float,2>{0.199345976f, 0.10907688f},
-std::array<float,2>{0.526489258f, 0.665501773f},
-std::array<float,2>{0.387826711f, 0.970398962f},
-std::array<float,2>{0.840780199f, 0.405684382f},
-std::array<float,2>{0.363344163f, 0.000261290435f},
-std::array<float,2>{0.88194406f, 0.712799549f},
-std::array<float,2>{0.00130449655f, 0.937206507f},
-std::array<float,2>{0.650581002f, 0.464484483f},
-std::array<float,2>{0.130649224f, 0.357816041f},
-std::array<float,2>{0.624676287f, 0.808505833f},
-std::array<float,2>{0.447120011f, 0.604564488f},
-std::array<float,2>{0.758942842f, 0.188157752f},
-std::array<float,2>{0.431193888f, 0.407349825f},
-std::array<float,2>{0.861065328f, 0.960671902f},
-std::array<float,2>{0.220957011f, 0.640032649f},
-std::array<float,2>{0.535483539f, 0.0723869503f},
-std::array<float,2>{0.113311358f, 0.165025458f},
-std::array<float,2>{0.74520731f, 0.533912063f},
-std::array<float,2>{0.288089693f, 0.814423919f},
-std::array<float,2>{0.997884095f, 0.268720537f},
-std::array<float,2>{0.39159295f, 0.0831299648f},
-std::array<float,2>{0.821981013f, 0.646065772f},
-std::array<float,2>{0.217061535f, 0.942719698f},
-std::array<float,2>{0.503635526f, 0.436807871f},
-std::array<float,2>{0.0774433166f, 0.259332657f},
-std::array<float,2>{0.703220963f, 0.829203188f},
-std::array<float,2>{0.256661862f, 0.550912976f},
-std::array<float,2>{0.953793764f, 0.176721245f},
-std::array<float,2>{0.320005715f, 0.445133388f},
-std::array<float,2>{0.922596216f, 0.906528234f},
-std::array<float,2>{0.0580087788f, 0.687987149f},
-std::array<float,2>{0.669696212f, 0.015857799f},
-std::array<float,2>{0.186725006f, 0.208431751f},
-std::array<float,2>{0.583296955f, 0.617965221f},
-std::array<float,2>{0.470983505f, 0.781847835f},
-std::array<float,2>{0.783032775f, 0.363581747f},
-std::array<float,2>{0.312011987f, 0.149441183f},
-std::array<float,2>{0.974098444f, 0.504689157f},
-std::array<float,2>{0.109074637f, 0.853280425f},
-std::array<float,2>{0.720678389f, 0.30785197f},
-std::array<float,2>{0.244789883f, 0.390063375f},
-std::array<float,2>{0.552065909f, 0.997928381f},
-std::array<float,2>{0.417608619f, 0.678458273f},
-std::array<float,2>{0.846185207f, 0.116921917f},
-std::array<float,2>{0.457599938f, 0.338375866f},
-std::array<float,2>{0.768155456f, 0.771311283f},
-std::array<float,2>{0.155123979f, 0.583080769f},
-std::array<float,2>{0.594163954f, 0.223768979f},
-std::array<float,2>{0.0222078711f, 0.0581199564f},
-std::array<float,2>{0.639638662f, 0.736455083f},
-std::array<float,2>{0.356051803f, 0.89902252f},
-std::array<float,2>{0.891827583f, 0.487723708f},
-std::array<float,2>{0.498973876f, 0.152612776f},
-std::array<float,2>{0.805954039f, 0.500837147f},
-std::array<float,2>{0.165938973f, 0.858633935f},
-std::array<float,2>{0.576572657f, 0.309436023f},
-std::array<float,2>{0.0367057323f, 0.385301083f},
-std::array<float,2>{0.680326462f, 0.99581188f},
-std::array<float,2>{0.334996104f, 0.674839079f},
-std::array<float,2>{0.912379801f, 0.110076465f},
-std::array<float,2>{0.277332574f, 0.343290478f},
-std::array<float,2>{0.939836621f, 0.768599331f},
-std::array<float,2>{0.0799803659f, 0.580289781f},
-std::array<float,2>{0.694258094f, 0.219471157f},
-std::array<float,2>{0.187633663f, 0.0593507066f},
-std::array<float,2>{0.521668136f, 0.741263986f},
-std::array<float,2>{0.382544249f, 0.905695081f},
-std::array<float,2>{0.833535135f, 0.490518361f},
-std::array<float,2>{0.369464159f, 0.0796223953f},
-std::array<float,2>{0.88532877f, 0.641403079f},
-std::array<float,2>{0.00935516506f, 0.93771863f},
-std::array<float,2>{0.645525932f, 0.432448834f},
-std::array<float,2>{0.133839041f, 0.26221174f},
-std::array<float,2>{0.614761531f, 0.833844006f},
-std::array<float,2>{0.441119522f, 0.549919426f},
-std::array<float,2>{0.755611837f, 0.174994737f},
-std::array<float,2>{0.428448439f, 0.439740777f},
-std::array<float,2>{0.868018448f, 0.913037479f},
-std::array<float,2>{0.229063481f, 0.695160389f},
-std::array<float,2>{0.546612263f, 0.0220866296f},
-std::array<float,2>{0.123538002f, 0.204852015f},
-std::array<float,2>{0.73719877f, 0.62261939f},
-std::array<float,2>{0.290554792f, 0.788984478f},
-std::array<float,2>{0.991082191f, 0.360991985f},
-std::array<float,2>{0.401838779f, 0.00530066667f},
-std::array<float,2>{0.813770473f, 0.718014061f},
-std::array<float,2>{0.208109289f, 0.93139118f},
-std::array<float,2>{0.514213026f, 0.468689501f},
-std::array<float,2>{0.0642279908f, 0.353341639f},
-std::array<float,2>{0.713920593f, 0.81177479f},
-std::array<float,2>{0.262767047f, 0.606312752f},
-std::array<float,2>{0.96206677f, 0.193122983f},
-std::array<float,2>{0.320359617f, 0.411026597f},
-std::array<float,2>{0.931327701f, 0.953781247f},
-std::array<float,2>{0.0475112051f, 0.636437595f},
-std::array<float,2>{0.658019245f, 0.075414218f},
-std::array<float,2>{0.175900534f, 0.171494529f},
-std::array<float,2>{0.587370276f, 0.538003445f},
-std::array<float,2>{0.484046847f, 0.818553448f},
-std::array<float,2>{0.79069227f, 0.273367524f},
-std::array<float,2>{0.297349781f, 0.246163726f},
-std::array<float,2>{0.982870638f, 0.577545822f},
-std::array<float,2>{0.0952306911f, 0.753888845f},
-std::array<float,2>{0.729199111f, 0.321020603f},
-std::array<float,2>{0.234683365f, 0.481168628f},
-std::array<float,2>{0.554920733f, 0.888193905f},
-std::array<float,2>{0.408069402f, 0.730610728f},
-std::array<float,2>{0.855925381f, 0.0352215767f},
-std::array<float,2>{0.467106372f, 0.291172802f},
-std::array<float,2>{0.77593118f, 0.86271596f},
-std::array<float,2>{0.147082552f, 0.521852732f},
-std::array<float,2>{0.605610013f, 0.130078733f},
-std::array<float,2>{0.0284930952f, 0.103329495f},
-std::array<float,2>{0.630229652f, 0.6683079f},
-std::array<float,2>{0.3475537f, 0.973838449f},
-std::array<float,2>{0.901843548f, 0.398796469f},
-std::array<float,2>{0.421616912f, 0.198934361f},
-std::array<float,2>{0.849252105f, 0.598691344f},
-std::array<float,2>{0.24912338f, 0.802838087f},
-std::array<float,2>{0.548471451f, 0.347971022f},
-std::array<float,2>{0.104222715f, 0.453720719f},
-std::array<float,2>{0.72540015f, 0.924343884f},
-std::array<float,2>{0.307080925f, 0.705641389f},
-std::array<float,2>{0.969513535f, 0.0131537523f},
-std::array<float,2>{0.354668677f, 0.275008082f},
-std::array<float,2>{0.898142815f, 0.827524185f},
-std::array<float,2>{0.0186950155f, 0.543454885f},
-std::array<float,2>{0.636168778f, 0.158484027f},
-std::array<float,2>{0.149210408f, 0.0676195249f},
-std::array<float,2>{0.599425495f, 0.630586326f},
-std::array<float,2>{0.455328166f, 0.961365402f},
-std::array<float,2>{0.770238161f, 0.42024824f},
-std::array<float,2>{0.251048476f, 0.0412212722f},
-std::array<float,2>{0.958230376f, 0.72506988f},
-std::array<float,2>{0.0708203614f, 0.88063848f},
-std::array<float,2>{0.708655536f, 0.474212646f},
-std::array<float,2>{0.211189687f, 0.317167401f},
-std::array<float,2>{0.507155716f, 0.761002898f},
-std::array<float,2>{0.396655828f, 0.56437403f},
-std::array<float,2>{0.825074732f, 0.239802331f},
-std::array<float,2>{0.476545066f, 0.392627597f},
-std::array<float,2>{0.786639035f, 0.982521176f},
-std::array<float,2>{0.181123286f, 0.656965494f},
-std::array<float,2>{0.579681158f, 0.0959564969f},
-std::array<float,2>{0.0587425716f, 0.136358425f},
-std::array<float,2>{0.665698886f, 0.525924206f},
-std::array<float,2>{0.313534737f, 0.867416859f},
-std::array<float,2>{0.927115321f, 0.288181841f},
-std::array<float,2>{0.450268418f, 0.11740943f},
-std::array<float,2>{0.763666034f, 0.683736801f},
-std::array<float,2>{0.127352834f, 0.991473079f},
-std::array<float,2>{0.617204905f, 0.376426905f},
-std::array<float,2>{0.00758992461f, 0.299155116f},
-std::array<float,2>{0.655116379f, 0.844927907f},
-std::array<float,2>{0.360655665f, 0.509549677f},
-std::array<float,2>{0.876686871f, 0.14474389f},
-std::array<float,2>{0.283802718f, 0.494318813f},
-std::array<float,2>{0.993589997f, 0.893492818f},
-std::array<float,2>{0.109778821f, 0.743524671f},
-std::array<float,2>{0.74666363f, 0.0485612005f},
-std::array<float,2>{0.223244697f, 0.228440776f},
-std::array<float,2>{0.534453094f, 0.586169481f},
-std::array<float,2>{0.434511006f, 0.777770221f},
-std::array<float,2>{0.863787055f, 0.334770262f},
-std::array<float,2>{0.336109757f, 0.183710128f},
-std::array<float,2>{0.920917571f, 0.555058002f},
-std::array<float,2>{0.0433418602f, 0.840850353f},
-std::array<float,2>{0.675990045f, 0.25061962f},
-std::array<float,2>{0.16110608f, 0.428105503f},
-std::array<float,2>{0.562609017f, 0.945373535f},
-std::array<float,2>{0.484792024f, 0.651331663f},
-std::array<float,2>{0.79731971f, 0.0860656053f},
-std::array<float,2>{0.383420825f, 0.374480724f},
-std::array<float,2>{0.837608933f, 0.795505226f},
-std::array<float,2>{0.19853659f, 0.613713264f},
-std::array<float,2>{0.528716922f, 0.212471709f},
-std::array<float,2>{0.0913095996f, 0.029802708f},
-std::array<float,2>{0.696241856f, 0.701688766f},
-std::array<float,2>{0.268537849f, 0.916420817f},
-std::array<float,2>{0.950714111f, 0.446260989f},
-std::array<float,2>{0.375278443f, 0.163343266f},
-std::array<float,2>{0.830255806f, 0.540980875f},
-std::array<float,2>{0.191623241f, 0.821377158f},
-std::array<float,2>{0.51918298f, 0.278957665f},
-std::array<float,2>{0.0828552097f, 0.416153461f},
-std::array<float,2>{0.687932074f, 0.965600669f},
-std::array<float,2>{0.279557765f, 0.625428796f},
-std::array<float,2>{0.942144096f, 0.064991422f},
-std::array<float,2>{0.329565018f, 0.344957978f},
-std::array<float,2>{0.909211099f, 0.800630569f},
-std::array<float,2>{0.0341323614f, 0.594918847f},
-std::array<float,2>{0.686448872f, 0.199358404f},
-std::array<float,2>{0.170458093f, 0.0113592148f},
-std::array<float,2>{0.573955894f, 0.707441092f},
-std::array<float,2>{0.492678404f, 0.929658771f},
-std::array<float,2>{0.812382162f, 0.457751364f},
-std::array<float,2>{0.293649107f, 0.100770704f},
-std::array<float,2>{0.987481117f, 0.663471222f},
-std::array<float,2>{0.118722044f, 0.979295492f},
-std::array<float,2>{0.738745928f, 0.398162484f},
-std::array<float,2>{0.23330991f, 0.283363611f},
-std::array<float,2>{0.541002274f, 0.873814702f},
-std::array<float,2>{0.423885345f, 0.530323863f},
-std::array<float,2>{0.872796655f, 0.1385317f},
-std::array<float,2>{0.442536324f, 0.470093966f},
-std::array<float,2>{0.751655996f, 0.878377318f},
-std::array<float,2>{0.139153436f, 0.720241427f},
-std::array<float,2>{0.611881971f, 0.046012219f},
-std::array<float,2>{0.0144728962f, 0.237178728f},
-std::array<float,2>{0.64373368f, 0.569571853f},
-std::array<float,2>{0.374648929f, 0.763124526f},
-std::array<float,2>{0.889178693f, 0.315003663f},
-std::array<float,2>{0.477303892f, 0.0537312888f},
-std::array<float,2>{0.795142055f, 0.749480188f},
-std::array<float,2>{0.175773084f, 0.898119926f},
-std::array<float,2>{0.591860592f, 0.499242127f},
-std::array<float,2>{0.0537297502f, 0.331673205f},
-std::array<float,2>{0.660698175f, 0.776682079f},
-std::array<float,2>{0.327200145f, 0.591877699f},
-std::array<float,2>{0.935567975f, 0.231888965f},
-std::array<float,2>{0.261424839f, 0.380324036f},
-std::array<float,2>{0.965330422f, 0.985648453f},
-std::array<float,2>{0.0676722378f, 0.68018496f},
-std::array<float,2>{0.714916825f, 0.123462334f},
-std::array<float,2>{0.204006121f, 0.141932845f},
-std::array<float,2>{0.508369207f, 0.515519738f},
-std::array<float,2>{0.403448403f, 0.848922193f},
-std::array<float,2>{0.816684186f, 0.303449571f},
-std::array<float,2>{0.349135667f, 0.215234235f},
-std::array<float,2>{0.905884683f, 0.610041618f},
-std::array<float,2>{0.026053194f, 0.791509211f},
-std::array<float,2>{0.626253247f, 0.369364172f},
-std::array<float,2>{0.141475081f, 0.451022595f},
-std::array<float,2>{0.602730274f, 0.920421839f},
-std::array<float,2>{0.462031513f, 0.696731567f},
-std::array<float,2>{0.778109848f, 0.0254216418f},
-std::array<float,2>{0.412516862f, 0.254019499f},
-std::array<float,2>{0.855080366f, 0.838724017f},
-std::array<float,2>{0.240379974f, 0.56236726f},
-std::array<float,2>{0.559581161f, 0.181582451f},
-std::array<float,2>{0.0981841385f, 0.0910476521f},
-std::array<float,2>{0.730657756f, 0.653170586f},
-std::array<float,2>{0.301029861f, 0.951143801f},
-std::array<float,2>{0.979064047f, 0.423452318f},
-std::array<float,2>{0.459592938f, 0.223167434f},
-std::array<float,2>{0.766991973f, 0.582980871f},
-std::array<float,2>{0.153339759f, 0.7701177f},
-std::array<float,2>{0.596844912f, 0.339672267f},
-std::array<float,2>{0.0205976628f, 0.48666054f},
-std::array<float,2>{0.637482882f, 0.899519265f},
-std::array<float,2>{0.358786315f, 0.737823129f},
-std::array<float,2>{0.893652678f, 0.0569657572f},
-std::array<float,2>{0.310256064f, 0.307107776f},
-std::array<float,2>{0.975548208f, 0.851835847f},
-std::array<float,2>{0.105960093f, 0.505641043f},
-std::array<float,2>{0.722089708f, 0.149036169f},
-std::array<float,2>{0.243543223f, 0.115930654f},
-std::array<float,2>{0.554439962f, 0.678959787f},
-std::array<float,2>{0.414554715f, 0.99705267f},
-std::array<float,2>{0.844419897f, 0.388997942f},
-std::array<float,2>{0.316993773f, 0.0173155665f},
-std::array<float,2>{0.924965203f, 0.688666999f},
-std::array<float,2>{0.0556767061f, 0.907346129f},
-std::array<float,2>{0.670578957f, 0.443433642f},
-std::array<float,2>{0.185189381f, 0.364573598f},
-std::array<float,2>{0.584991395f, 0.782942951f},
-std::array<float,2>{0.469124079f, 0.618727326f},
-std::array<float,2>{0.783440471f, 0.207674503f},
-std::array<float,2>{0.393800646f, 0.435713083f},
-std::array<float,2>{0.824015856f, 0.941447794f},
-std::array<float,2>{0.216533124f, 0.645058334f},
-std::array<float,2>{0.500883639f, 0.0822829306f},
-std::array<float,2>{0.0750247985f, 0.176853105f},
-std::array<float,2>{0.705184758f, 0.551778913f},
-std::array<float,2>{0.254247665f, 0.828880608f},
-std::array<float,2>{0.956099868f, 0.257957697f},
-std::array<float,2>{0.432809323f, 0.0734825581f},
-std::array<float,2>{0.862895966f, 0.639410615f},
-std::array<float,2>{0.220378757f, 0.959773004f},
-std::array<float,2>{0.537698269f, 0.406497508f},
-std::array<float,2>{0.115601204f, 0.267977983f},
-std::array<float,2>{0.743686855f, 0.813334942f},
-std::array<float,2>{0.285830706f, 0.534757793f},
-std::array<float,2>{0.998323023f, 0.165613264f},
-std::array<float,2>{0.366564006f, 0.463215441f},
-std::array<float,2>{0.879154444f, 0.936317027f},
-std::array<float,2>{0.00290229707f, 0.71167165f},
-std::array<float,2>{0.648845375f, 0.0017411079f},
-std::array<float,2>{0.132040188f, 0.189197391f},
-std::array<float,2>{0.622099817f, 0.603555441f},
-std::array<float,2>{0.448272884f, 0.807384908f},
-std::array<float,2>{0.76064676f, 0.35856086f},
-std::array<float,2>{0.270627707f, 0.126071543f},
-std::array<float,2>{0.946466386f, 0.517725468f},
-std::array<float,2>{0.0892801508f, 0.864864767f},
-std::array<float,2>{0.701865256f, 0.295449197f},
-std::array<float,2>{0.202949151f, 0.404838294f},
-std::array<float,2>{0.524810731f, 0.969403982f},
-std::array<float,2>{0.389721781f, 0.664530456f},
-std::array<float,2>{0.84219414f, 0.107697003f},
-std::array<float,2>{0.491283566f, 0.325703412f},
-std::array<float,2>{0.803664625f, 0.756293595f},
-std::array<float,2>{0.15679042f, 0.573216259f},
-std::array<float,2>{0.566785276f, 0.245974183f},
-std::array<float,2>{0.0405469723f, 0.0343016163f},
-std::array<float,2>{0.673451781f, 0.729140639f},
-std::array<float,2>{0.343211502f, 0.886070251f},
-std::array<float,2>{0.914892793f, 0.478520542f},
-std::array<float,2>{0.437685043f, 0.173039496f},
-std::array<float,2>{0.756404221f, 0.547300816f},
-std::array<float,2>{0.135503039f, 0.835772514f},
-std::array<float,2>{0.616323411f, 0.26440385f},
-std::array<float,2>{0.0102097252f, 0.430614591f},
-std::array<float,2>{0.647261202f, 0.940175653f},
-std::array<float,2>{0.369123548f, 0.643943071f},
-std::array<float,2>{0.884675801f, 0.0816943794f},
-std::array<float,2>{0.292896152f, 0.362074554f},
-std::array<float,2>{0.989798784f, 0.785411716f},
-std::array<float,2>{0.122715481f, 0.624893963f},
-std::array<float,2>{0.734778583f, 0.206592023f},
-std::array<float,2>{0.227273226f, 0.0207604859f},
-std::array<float,2>{0.544878364f, 0.691714287f},
-std::array<float,2>{0.426709801f, 0.910935104f},
-std::array<float,2>{0.869460702f, 0.439010918f},
-std::array<float,2>{0.333456278f, 0.112435006f},
-std::array<float,2>{0.911943257f, 0.673344254f},
-std::array<float,2>{0.0373347327f, 0.993054271f},
-std::array<float,2>{0.682123542f, 0.384064972f},
-std::array<float,2>{0.16767253f, 0.311912686f},
-std::array<float,2>{0.57545799f, 0.857226551f},
-std::array<float,2>{0.49762556f, 0.503234744f},
-std::array<float,2>{0.806788087f, 0.155220747f},
-std::array<float,2>{0.380113304f, 0.48952353f},
-std::array<float,2>{0.835595727f, 0.902978539f},
-std::array<float,2>{0.191035151f, 0.740140915f},
-std::array<float,2>{0.520683587f, 0.0621558726f},
-std::array<float,2>{0.0806571543f, 0.220731631f},
-std::array<float,2>{0.693091691f, 0.578925431f},
-std::array<float,2>{0.273964077f, 0.7659657f},
-std::array<float,2>{0.93820709f, 0.340474784f},
-std::array<float,2>{0.409970343f, 0.0384986065f},
-std::array<float,2>{0.858972132f, 0.733776987f},
-std::array<float,2>{0.237186253f, 0.889361143f},
-std::array<float,2>{0.557419777f, 0.483408779f},
-std::array<float,2>{0.0974001884f, 0.322700977f},
-std::array<float,2>{0.726881623f, 0.750426352f},
-std::array<float,2>{0.299783021f, 0.576070964f},
-std::array<float,2>{0.982027829f, 0.248860061f},
-std::array<float,2>{0.344572991f, 0.400442123f},
-std::array<float,2>{0.900114477f, 0.975284636f},
-std::array<float,2>{0.0304134116f, 0.670752525f},
-std::array<float,2>{0.632118464f, 0.103800632f},
-std::array<float,2>{0.14568527f, 0.13232249f},
-std::array<float,2>{0.607672989f, 0.519809186f},
-std::array<float,2>{0.466765046f, 0.861152411f},
-std::array<float,2>{0.774057508f, 0.290580988f},
-std::array<float,2>{0.26538533f, 0.195237324f},
-std::array<float,2>{0.964291096f, 0.608737826f},
-std::array<float,2>{0.0652836263f, 0.810518205f},
-std::array<float,2>{0.712483823f, 0.354572982f},
-std::array<float,2>{0.210287705f, 0.465334445f},
-std::array<float,2>{0.512697875f, 0.932875931f},
-std::array<float,2>{0.399743795f, 0.716350436f},
-std::array<float,2>{0.815095901f, 0.00765184825f},
-std::array<float,2>{0.48198849f, 0.271355689f},
-std::array<float,2>{0.791629851f, 0.818033993f},
-std::array<float,2>{0.17884019f, 0.5361166f},
-std::array<float,2>{0.589506626f, 0.168296129f},
-std::array<float,2>{0.0500599965f, 0.0775591806f},
-std::array<float,2>{0.658305764f, 0.633526325f},
-std::array<float,2>{0.323686063f, 0.955188453f},
-std::array<float,2>{0.931646883f, 0.413668305f},
-std::array<float,2>{0.394965202f, 0.241219729f},
-std::array<float,2>{0.826474249f, 0.56554544f},
-std::array<float,2>{0.213336661f, 0.759144902f},
-std::array<float,2>{0.505853534f, 0.319618762f},
-std::array<float,2>{0.0737090781f, 0.475575566f},
-std::array<float,2>{0.710220575f, 0.882608831f},
-std::array<float,2>{0.252150804f, 0.723386049f},
-std::array<float,2>{0.960009217f, 0.0396481641f},
-std::array<float,2>{0.316327959f, 0.286295444f},
-std::array<float,2>{0.92916894f, 0.870640755f},
-std::array<float,2>{0.0622165427f, 0.525099039f},
-std::array<float,2>{0.667304635f, 0.134752512f},
-std::array<float,2>{0.182591379f, 0.0953855664f},
-std::array<float,2>{0.581009507f, 0.658663392f},
-std::array<float,2>{0.473349422f, 0.980739534f},
-std::array<float,2>{0.787968397f, 0.391967684f},
-std::array<float,2>{0.305238217f, 0.0155354589f},
-std::array<float,2>{0.97138536f, 0.70396477f},
-std::array<float,2>{0.102419645f, 0.923492193f},
-std::array<float,2>{0.723064244f, 0.455130041f},
-std::array<float,2>{0.247625902f, 0.351278692f},
-std::array<float,2>{0.548888206f, 0.801919937f},
-std::array<float,2>{0.419125199f, 0.600752294f},
-std::array<float,2>{0.85010463f, 0.19684054f},
-std::array<float,2>{0.453977078f, 0.419049859f},
-std::array<float,2>{0.772118747f, 0.964299738f},
-std::array<float,2>{0.150486574f, 0.631947041f},
-std::array<float,2>{0.601539373f, 0.0692023784f},
-std::array<float,2>{0.0174171347f, 0.156847671f},
-std::array<float,2>{0.633782446f, 0.545602024f},
-std::array<float,2>{0.351643175f, 0.825791895f},
-std::array<float,2>{0.895325661f, 0.276386112f},
-std::array<float,2>{0.487857133f, 0.0884814635f},
-std::array<float,2>{0.799447656f, 0.649742305f},
-std::array<float,2>{0.163195372f, 0.94784832f},
-std::array<float,2>{0.565622389f, 0.426500797f},
-std::array<float,2>{0.0466587171f, 0.25242573f},
-std::array<float,2>{0.678207994f, 0.843442798f},
-std::array<float,2>{0.338410914f, 0.556822658f},
-std::array<float,2>{0.919562936f, 0.187050372f},
-std::array<float,2>{0.267171323f, 0.448309839f},
-std::array<float,2>{0.952713013f, 0.914733469f},
-std::array<float,2>{0.0936780795f, 0.701115608f},
-std::array<float,2>{0.698433638f, 0.0276360177f},
-std::array<float,2>{0.196004421f, 0.213984683f},
-std::array<float,2>{0.530574918f, 0.615611672f},
-std::array<float,2>{0.385352403f, 0.793753445f},
-std::array<float,2>{0.839481711f, 0.371789545f},
-std::array<float,2>{0.361705631f, 0.146713465f},
-std::array<float,2>{0.877117038f, 0.509857297f},
-std::array<float,2>{0.00412624143f, 0.847125292f},
-std::array<float,2>{0.652849734f, 0.298276335f},
-std::array<float,2>{0.126846045f, 0.378888965f},
-std::array<float,2>{0.619786084f, 0.988840342f},
-std::array<float,2>{0.451341182f, 0.685748994f},
-std::array<float,2>{0.76544553f, 0.120090418f},
-std::array<float,2>{0.435896158f, 0.333933592f},
-std::array<float,2>{0.867054701f, 0.781053543f},
-std::array<float,2>{0.224678114f, 0.588815689f},
-std::array<float,2>{0.531482399f, 0.228937954f},
-std::array<float,2>{0.113255717f, 0.0493308417f},
-std::array<float,2>{0.748516858f, 0.745008051f},
-std::array<float,2>{0.282768071f, 0.892026007f},
-std::array<float,2>{0.994748533f, 0.493865162f},
-std::array<float,2>{0.422920287f, 0.139745429f},
-std::array<float,2>{0.874043226f, 0.527526379f},
-std::array<float,2>{0.232141629f, 0.871321559f},
-std::array<float,2>{0.541078687f, 0.281440884f},
-std::array<float,2>{0.119838983f, 0.395344675f},
-std::array<float,2>{0.741183996f, 0.977838159f},
-std::array<float,2>{0.295249104f, 0.660344243f},
-std::array<float,2>{0.984457672f, 0.0989675745f},
-std::array<float,2>{0.372681379f, 0.314207971f},
-std::array<float,2>{0.888099074f, 0.764028192f},
-std::array<float,2>{0.0122294622f, 0.568260074f},
-std::array<float,2>{0.641690612f, 0.234765887f},
-std::array<float,2>{0.138463452f, 0.0435008593f},
-std::array<float,2>{0.609628916f, 0.721134543f},
-std::array<float,2>{0.445112765f, 0.875222147f},
-std::array<float,2>{0.753628671f, 0.471360564f},
-std::array<float,2>{0.277916908f, 0.0642358139f},
-std::array<float,2>{0.945172608f, 0.627005041f},
-std::array<float,2>{0.0843951032f, 0.966818929f},
-std::array<float,2>{0.691178679f, 0.415771931f},
-std::array<float,2>{0.194563076f, 0.279367179f},
-std::array<float,2>{0.516789436f, 0.823330462f},
-std::array<float,2>{0.37786895f, 0.541837454f},
-std::array<float,2>{0.828863204f, 0.160321206f},
-std::array<float,2>{0.494722843f, 0.45979917f},
-std::array<float,2>{0.809688151f, 0.925989091f},
-std::array<float,2>{0.169819266f, 0.709713757f},
-std::array<float,2>{0.57056284f, 0.00873854849f},
-std::array<float,2>{0.0313517265f, 0.202731058f},
-std::array<float,2>{0.685179055f, 0.597533226f},
-std::array<float,2>{0.331128657f, 0.798767626f},
-std::array<float,2>{0.906466901f, 0.346871257f},
-std::array<float,2>{0.463404536f, 0.024145266f},
-std::array<float,2>{0.781189084f, 0.697693586f},
-std::array<float,2>{0.144016862f, 0.919785619f},
-std::array<float,2>{0.605341673f, 0.451930791f},
-std::array<float,2>{0.024524048f, 0.367514133f},
-std::array<float,2>{0.628208637f, 0.789766073f},
-std::array<float,2>{0.35100317f, 0.612038851f},
-std::array<float,2>{0.903656185f, 0.217982635f},
-std::array<float,2>{0.303896397f, 0.424542457f},
-std::array<float,2>{0.978075981f, 0.951263309f},
-std::array<float,2>{0.101336688f, 0.655340075f},
-std::array<float,2>{0.734208107f, 0.0934478268f},
-std::array<float,2>{0.240069345f, 0.1826635f},
-std::array<float,2>{0.562412083f, 0.559298515f},
-std::array<float,2>{0.411923021f, 0.837183833f},
-std::array<float,2>{0.853121817f, 0.256058872f},
-std::array<float,2>{0.325454444f, 0.233145103f},
-std::array<float,2>{0.933599234f, 0.590450764f},
-std::array<float,2>{0.0519605242f, 0.775042236f},
-std::array<float,2>{0.663410127f, 0.329196572f},
-std::array<float,2>{0.172904477f, 0.497816741f},
-std::array<float,2>{0.590620458f, 0.895430565f},
-std::array<float,2>{0.47863096f, 0.747655571f},
-std::array<float,2>{0.793353856f, 0.0522797853f},
-std::array<float,2>{0.40451771f, 0.301490396f},
-std::array<float,2>{0.820061326f, 0.850005329f},
-std::array<float,2>{0.205158666f, 0.51335901f},
-std::array<float,2>{0.511249483f, 0.142733246f},
-std::array<float,2>{0.0698878616f, 0.122504905f},
-std::array<float,2>{0.718652427f, 0.681972742f},
-std::array<float,2>{0.259362787f, 0.98700881f},
-std::array<float,2>{0.966796935f, 0.381026626f},
-std::array<float,2>{0.471745521f, 0.209192529f},
-std::array<float,2>{0.78144908f, 0.620680273f},
-std::array<float,2>{0.186085984f, 0.783971548f},
-std::array<float,2>{0.582272589f, 0.366890043f},
-std::array<float,2>{0.0574748963f, 0.442507863f},
-std::array<float,2>{0.668117225f, 0.908703864f},
-std::array<float,2>{0.318456829f, 0.690242887f},
-std::array<float,2>{0.923144639f, 0.0177602526f},
-std::array<float,2>{0.25771457f, 0.260910481f},
-std::array<float,2>{0.954286456f, 0.830252171f},
-std::array<float,2>{0.0771171749f, 0.553263664f},
-std::array<float,2>{0.70443517f, 0.177953422f},
-std::array<float,2>{0.218741357f, 0.0856718421f},
-std::array<float,2>{0.502102911f, 0.647201657f},
-std::array<float,2>{0.392089665f, 0.944961548f},
-std::array<float,2>{0.821104527f, 0.433908492f},
-std::array<float,2>{0.356579036f, 0.055596184f},
-std::array<float,2>{0.89133215f, 0.735246718f},
-std::array<float,2>{0.0229577851f, 0.901621878f},
-std::array<float,2>{0.640140116f, 0.485466629f},
-std::array<float,2>{0.155788973f, 0.337351114f},
-std::array<float,2>{0.595253587f, 0.771574378f},
-std::array<float,2>{0.458882123f, 0.584911048f},
-std::array<float,2>{0.76885891f, 0.225385487f},
-std::array<float,2>{0.416756809f, 0.388218254f},
-std::array<float,2>{0.847540021f, 0.999474406f},
-std::array<float,2>{0.245758519f, 0.676972866f},
-std::array<float,2>{0.551127255f, 0.11359971f},
-std::array<float,2>{0.108216517f, 0.15104188f},
-std::array<float,2>{0.719599128f, 0.506946266f},
-std::array<float,2>{0.311193466f, 0.854727626f},
-std::array<float,2>{0.973395348f, 0.305455834f},
-std::array<float,2>{0.387158692f, 0.106768958f},
-std::array<float,2>{0.841477692f, 0.666979194f},
-std::array<float,2>{0.200691476f, 0.971333981f},
-std::array<float,2>{0.525416315f, 0.404257238f},
-std::array<float,2>{0.0875188708f, 0.294139087f},
-std::array<float,2>{0.700303018f, 0.866312861f},
-std::array<float,2>{0.272336602f, 0.516139627f},
-std::array<float,2>{0.948632896f, 0.128688574f},
-std::array<float,2>{0.341448218f, 0.477030605f},
-std::array<float,2>{0.916952252f, 0.883212566f},
-std::array<float,2>{0.0414819457f, 0.728225887f},
-std::array<float,2>{0.674930871f, 0.0327009112f},
-std::array<float,2>{0.160125315f, 0.243761078f},
-std::array<float,2>{0.568880677f, 0.57142514f},
-std::array<float,2>{0.489207655f, 0.754111111f},
-std::array<float,2>{0.80102098f, 0.327101499f},
-std::array<float,2>{0.287373453f, 0.166163653f},
-std::array<float,2>{0.996845901f, 0.532572925f},
-std::array<float,2>{0.114981659f, 0.816069365f},
-std::array<float,2>{0.744652867f, 0.26736176f},
-std::array<float,2>{0.22207655f, 0.408470541f},
-std::array<float,2>{0.536573112f, 0.958941758f},
-std::array<float,2>{0.429698765f, 0.637950003f},
-std::array<float,2>{0.859974265f, 0.0710425153f},
-std::array<float,2>{0.446166635f, 0.357230186f},
-std::array<float,2>{0.758234262f, 0.806180596f},
-std::array<float,2>{0.129684031f, 0.60224998f},
-std::array<float,2>{0.623729289f, 0.190986961f},
-std::array<float,2>{0.000529582787f, 0.00373141747f},
-std::array<float,2>{0.652005732f, 0.713038802f},
-std::array<float,2>{0.36488843f, 0.934237063f},
-std::array<float,2>{0.880916715f, 0.461630076f},
-std::array<float,2>{0.470478475f, 0.178105876f},
-std::array<float,2>{0.784723282f, 0.55357182f},
-std::array<float,2>{0.184558511f, 0.830431998f},
-std::array<float,2>{0.584391892f, 0.261115342f},
-std::array<float,2>{0.0554227233f, 0.433611482f},
-std::array<float,2>{0.67120409f, 0.94524169f},
-std::array<float,2>{0.317862511f, 0.647358894f},
-std::array<float,2>{0.924794912f, 0.0857430398f},
-std::array<float,2>{0.255067676f, 0.367075533f},
-std::array<float,2>{0.955227017f, 0.783760846f},
-std::array<float,2>{0.0754793957f, 0.620883882f},
-std::array<float,2>{0.7064569f, 0.209370404f},
-std::array<float,2>{0.215012074f, 0.0178492516f},
-std::array<float,2>{0.500982583f, 0.690027297f},
-std::array<float,2>{0.39321965f, 0.90900439f},
-std::array<float,2>{0.822401524f, 0.442700863f},
-std::array<float,2>{0.358256727f, 0.113481477f},
-std::array<float,2>{0.893076241f, 0.677131772f},
-std::array<float,2>{0.0196319297f, 0.999261081f},
-std::array<float,2>{0.638065875f, 0.38853997f},
-std::array<float,2>{0.153141782f, 0.305419445f},
-std::array<float,2>{0.596189916f, 0.854790807f},
-std::array<float,2>{0.460375518f, 0.507217586f},
-std::array<float,2>{0.765736818f, 0.15124023f},
-std::array<float,2>{0.415325105f, 0.485670209f},
-std::array<float,2>{0.84484762f, 0.901384592f},
-std::array<float,2>{0.24295865f, 0.735034883f},
-std::array<float,2>{0.553275466f, 0.055370789f},
-std::array<float,2>{0.107179098f, 0.225250497f},
-std::array<float,2>{0.721378922f, 0.58447969f},
-std::array<float,2>{0.308959156f, 0.771750152f},
-std::array<float,2>{0.976419806f, 0.337068677f},
-std::array<float,2>{0.38942489f, 0.0324072614f},
-std::array<float,2>{0.843140066f, 0.728410423f},
-std::array<float,2>{0.202007934f, 0.882953703f},
-std::array<float,2>{0.523457885f, 0.476725101f},
-std::array<float,2>{0.0885114446f, 0.326706231f},
-std::array<float,2>{0.703119576f, 0.754231334f},
-std::array<float,2>{0.270011574f, 0.57177645f},
-std::array<float,2>{0.945389628f, 0.243915871f},
-std::array<float,2>{0.341857791f, 0.403964013f},
-std::array<float,2>{0.915203154f, 0.971554697f},
-std::array<float,2>{0.0392533466f, 0.66652441f},
-std::array<float,2>{0.672093689f, 0.106685117f},
-std::array<float,2>{0.157537848f, 0.128601566f},
-std::array<float,2>{0.567439198f, 0.516545117f},
-std::array<float,2>{0.490454048f, 0.866574824f},
-std::array<float,2>{0.804391205f, 0.294290036f},
-std::array<float,2>{0.286511421f, 0.191371486f},
-std::array<float,2>{0.999685466f, 0.602390409f},
-std::array<float,2>{0.116723947f, 0.806504428f},
-std::array<float,2>{0.742824197f, 0.357016951f},
-std::array<float,2>{0.219396785f, 0.461775005f},
-std::array<float,2>{0.538636088f, 0.934457302f},
-std::array<float,2>{0.432081848f, 0.713286102f},
-std::array<float,2>{0.861558974f, 0.00353280385f},
-std::array<float,2>{0.448185265f, 0.267302483f},
-std::array<float,2>{0.761114419f, 0.816172481f},
-std::array<float,2>{0.131813213f, 0.532262027f},
-std::array<float,2>{0.621859968f, 0.166277394f},
-std::array<float,2>{0.00302439788f, 0.0711506382f},
-std::array<float,2>{0.649827182f, 0.637933433f},
-std::array<float,2>{0.36568898f, 0.958690822f},
-std::array<float,2>{0.880448222f, 0.408388048f},
-std::array<float,2>{0.424924612f, 0.234551877f},
-std::array<float,2>{0.871331751f, 0.567964137f},
-std::array<float,2>{0.234111741f, 0.763814807f},
-std::array<float,2>{0.539237916f, 0.314320058f},
-std::array<float,2>{0.118098609f, 0.471457571f},
-std::array<float,2>{0.739924967f, 0.875477016f},
-std::array<float,2>{0.294010043f, 0.720903337f},
-std::array<float,2>{0.986779094f, 0.043898195f},
-std::array<float,2>{0.373510599f, 0.281624347f},
-std::array<float,2>{0.890130699f, 0.871360242f},
-std::array<float,2>{0.0151611418f, 0.527715981f},
-std::array<float,2>{0.642945826f, 0.140031427f},
-std::array<float,2>{0.139666349f, 0.0988529027f},
-std::array<float,2>{0.612807572f, 0.660509348f},
-std::array<float,2>{0.441996813f, 0.977620184f},
-std::array<float,2>{0.750469267f, 0.395156145f},
-std::array<float,2>{0.280901551f, 0.00851774309f},
-std::array<float,2>{0.943041742f, 0.709930003f},
-std::array<float,2>{0.0835548118f, 0.926041365f},
-std::array<float,2>{0.68941915f, 0.459659368f},
-std::array<float,2>{0.192815781f, 0.347082049f},
-std::array<float,2>{0.518267393f, 0.7984671f},
-std::array<float,2>{0.376802593f, 0.597399473f},
-std::array<float,2>{0.831972837f, 0.202982634f},
-std::array<float,2>{0.493841439f, 0.41563952f},
-std::array<float,2>{0.810982883f, 0.967196882f},
-std::array<float,2>{0.171478182f, 0.627365589f},
-std::array<float,2>{0.572788537f, 0.0641906038f},
-std::array<float,2>{0.0344857164f, 0.160469085f},
-std::array<float,2>{0.686724663f, 0.541661918f},
-std::array<float,2>{0.329088956f, 0.823716462f},
-std::array<float,2>{0.908212245f, 0.279593259f},
-std::array<float,2>{0.461694211f, 0.093586497f},
-std::array<float,2>{0.778938174f, 0.655702055f},
-std::array<float,2>{0.14208436f, 0.95161891f},
-std::array<float,2>{0.60251534f, 0.424694061f},
-std::array<float,2>{0.0269914865f, 0.256324202f},
-std::array<float,2>{0.625193238f, 0.836977541f},
-std::array<float,2>{0.347794652f, 0.559471071f},
-std::array<float,2>{0.905180693f, 0.182955801f},
-std::array<float,2>{0.302075684f, 0.451745123f},
-std::array<float,2>{0.979777634f, 0.919619501f},
-std::array<float,2>{0.0991797298f, 0.697359741f},
-std::array<float,2>{0.732154071f, 0.0243534259f},
-std::array<float,2>{0.242123425f, 0.218061015f},
-std::array<float,2>{0.559057176f, 0.612209082f},
-std::array<float,2>{0.413352698f, 0.789810538f},
-std::array<float,2>{0.853567123f, 0.367287785f},
-std::array<float,2>{0.326379746f, 0.142972454f},
-std::array<float,2>{0.937485874f, 0.513537943f},
-std::array<float,2>{0.053236641f, 0.849637628f},
-std::array<float,2>{0.661318004f, 0.301652491f},
-std::array<float,2>{0.174403206f, 0.38133201f},
-std::array<float,2>{0.592815876f, 0.987196267f},
-std::array<float,2>{0.47776407f, 0.681764722f},
-std::array<float,2>{0.796435416f, 0.122076415f},
-std::array<float,2>{0.403192788f, 0.329562664f},
-std::array<float,2>{0.818031371f, 0.775254786f},
-std::array<float,2>{0.205012128f, 0.590697408f},
-std::array<float,2>{0.509309769f, 0.233226612f},
-std::array<float,2>{0.0671322569f, 0.0526857339f},
-std::array<float,2>{0.716177225f, 0.747922182f},
-std::array<float,2>{0.260154486f, 0.895102322f},
-std::array<float,2>{0.966185749f, 0.49763608f},
-std::array<float,2>{0.398158073f, 0.134370849f},
-std::array<float,2>{0.826151133f, 0.52524811f},
-std::array<float,2>{0.212695479f, 0.871091604f},
-std::array<float,2>{0.506306291f, 0.286523044f},
-std::array<float,2>{0.0717748404f, 0.391844302f},
-std::array<float,2>{0.7073856f, 0.980594158f},
-std::array<float,2>{0.250593543f, 0.658262432f},
-std::array<float,2>{0.957340181f, 0.0954954997f},
-std::array<float,2>{0.312514812f, 0.319577605f},
-std::array<float,2>{0.926106334f, 0.758848906f},
-std::array<float,2>{0.060396798f, 0.565848231f},
-std::array<float,2>{0.664183021f, 0.241636947f},
-std::array<float,2>{0.180115506f, 0.0399366356f},
-std::array<float,2>{0.578839898f, 0.723582089f},
-std::array<float,2>{0.474688739f, 0.88233912f},
-std::array<float,2>{0.785752714f, 0.47512874f},
-std::array<float,2>{0.307824373f, 0.0689938888f},
-std::array<float,2>{0.970262885f, 0.632230818f},
-std::array<float,2>{0.104510151f, 0.963951886f},
-std::array<float,2>{0.726125002f, 0.41938138f},
-std::array<float,2>{0.248938069f, 0.276613086f},
-std::array<float,2>{0.546883941f, 0.826099038f},
-std::array<float,2>{0.420833528f, 0.545671582f},
-std::array<float,2>{0.847979248f, 0.157195956f},
-std::array<float,2>{0.456833035f, 0.455377966f},
-std::array<float,2>{0.771019518f, 0.923689425f},
-std::array<float,2>{0.149749964f, 0.703754187f},
-std::array<float,2>{0.598562181f, 0.0152494451f},
-std::array<float,2>{0.0184826944f, 0.197025806f},
-std::array<float,2>{0.635132134f, 0.600895584f},
-std::array<float,2>{0.353559166f, 0.80224508f},
-std::array<float,2>{0.896910429f, 0.351413548f},
-std::array<float,2>{0.485413879f, 0.0273972414f},
-std::array<float,2>{0.798233092f, 0.700747311f},
-std::array<float,2>{0.161232471f, 0.914939225f},
-std::array<float,2>{0.564051032f, 0.448574632f},
-std::array<float,2>{0.0446114875f, 0.371901333f},
-std::array<float,2>{0.677567065f, 0.793517292f},
-std::array<float,2>{0.337299764f, 0.615368307f},
-std::array<float,2>{0.920413792f, 0.21416676f},
-std::array<float,2>{0.269215643f, 0.426635981f},
-std::array<float,2>{0.94927007f, 0.94817096f},
-std::array<float,2>{0.0901039764f, 0.649460614f},
-std::array<float,2>{0.696930349f, 0.088817887f},
-std::array<float,2>{0.197995842f, 0.187418073f},
-std::array<float,2>{0.52793175f, 0.557044029f},
-std::array<float,2>{0.384159505f, 0.843533158f},
-std::array<float,2>{0.836186349f, 0.252089918f},
-std::array<float,2>{0.360056788f, 0.22864081f},
-std::array<float,2>{0.875515103f, 0.588465989f},
-std::array<float,2>{0.00665691635f, 0.780856252f},
-std::array<float,2>{0.656048536f, 0.333506554f},
-std::array<float,2>{0.128308326f, 0.493935794f},
-std::array<float,2>{0.618205667f, 0.89179486f},
-std::array<float,2>{0.450012684f, 0.744686902f},
-std::array<float,2>{0.762434006f, 0.049707666f},
-std::array<float,2>{0.435269594f, 0.297984481f},
-std::array<float,2>{0.864363313f, 0.846907794f},
-std::array<float,2>{0.224595249f, 0.510084212f},
-std::array<float,2>{0.533789158f, 0.146849722f},
-std::array<float,2>{0.110478841f, 0.11978393f},
-std::array<float,2>{0.747867107f, 0.685953796f},
-std::array<float,2>{0.284350902f, 0.989065051f},
-std::array<float,2>{0.992652714f, 0.378614068f},
-std::array<float,2>{0.440368652f, 0.206809625f},
-std::array<float,2>{0.754435897f, 0.624567032f},
-std::array<float,2>{0.133706614f, 0.785177946f},
-std::array<float,2>{0.613911808f, 0.361950219f},
-std::array<float,2>{0.0081682913f, 0.439304709f},
-std::array<float,2>{0.644870043f, 0.910857737f},
-std::array<float,2>{0.370876133f, 0.691531837f},
-std::array<float,2>{0.886679888f, 0.0206522848f},
-std::array<float,2>{0.289098173f, 0.264441103f},
-std::array<float,2>{0.99184674f, 0.83552134f},
-std::array<float,2>{0.124215856f, 0.546876848f},
-std::array<float,2>{0.738149166f, 0.173251718f},
-std::array<float,2>{0.230018869f, 0.082030654f},
-std::array<float,2>{0.545837164f, 0.643777728f},
-std::array<float,2>{0.429245919f, 0.940395415f},
-std::array<float,2>{0.868617654f, 0.430319875f},
-std::array<float,2>{0.334612697f, 0.0623691268f},
-std::array<float,2>{0.913479626f, 0.73991555f},
-std::array<float,2>{0.0355069973f, 0.903103411f},
-std::array<float,2>{0.681072235f, 0.489282876f},
-std::array<float,2>{0.164391369f, 0.340659201f},
-std::array<float,2>{0.577468514f, 0.765642703f},
-std::array<float,2>{0.499400735f, 0.578620315f},
-std::array<float,2>{0.805063844f, 0.221128225f},
-std::array<float,2>{0.381111354f, 0.383849978f},
-std::array<float,2>{0.832520187f, 0.992855072f},
-std::array<float,2>{0.189405367f, 0.673585653f},
-std::array<float,2>{0.522938371f, 0.112652525f},
-std::array<float,2>{0.0783368126f, 0.154933155f},
-std::array<float,2>{0.695111513f, 0.502952456f},
-std::array<float,2>{0.27564162f, 0.856941402f},
-std::array<float,2>{0.941265881f, 0.311586797f},
-std::array<float,2>{0.406780958f, 0.103562891f},
-std::array<float,2>{0.857236683f, 0.670634031f},
-std::array<float,2>{0.236283481f, 0.975412667f},
-std::array<float,2>{0.556623042f, 0.400787503f},
-std::array<float,2>{0.0944749638f, 0.290956765f},
-std::array<float,2>{0.730032802f, 0.860954702f},
-std::array<float,2>{0.297936499f, 0.519735038f},
-std::array<float,2>{0.983862698f, 0.131837055f},
-std::array<float,2>{0.345779866f, 0.483696461f},
-std::array<float,2>{0.900482178f, 0.889484107f},
-std::array<float,2>{0.0282111764f, 0.733641624f},
-std::array<float,2>{0.629054248f, 0.0381420851f},
-std::array<float,2>{0.147651494f, 0.248602286f},
-std::array<float,2>{0.607275784f, 0.575779974f},
-std::array<float,2>{0.468536198f, 0.750169933f},
-std::array<float,2>{0.776797771f, 0.322324693f},
-std::array<float,2>{0.262374401f, 0.168110967f},
-std::array<float,2>{0.961226106f, 0.535669386f},
-std::array<float,2>{0.06296321f, 0.818206847f},
-std::array<float,2>{0.713098347f, 0.271041155f},
-std::array<float,2>{0.207435116f, 0.413839191f},
-std::array<float,2>{0.514987588f, 0.955331445f},
-std::array<float,2>{0.400798738f, 0.633751392f},
-std::array<float,2>{0.812847614f, 0.0773528367f},
-std::array<float,2>{0.482880384f, 0.354928017f},
-std::array<float,2>{0.789362907f, 0.810285628f},
-std::array<float,2>{0.177380085f, 0.608453631f},
-std::array<float,2>{0.586842358f, 0.195028663f},
-std::array<float,2>{0.0487578511f, 0.00749807851f},
-std::array<float,2>{0.656966507f, 0.716597736f},
-std::array<float,2>{0.322172046f, 0.932663023f},
-std::array<float,2>{0.929992795f, 0.465643466f},
-std::array<float,2>{0.457150161f, 0.149254411f},
-std::array<float,2>{0.767999232f, 0.505456924f},
-std::array<float,2>{0.154472873f, 0.851601601f},
-std::array<float,2>{0.594249964f, 0.306644052f},
-std::array<float,2>{0.0216008816f, 0.388839632f},
-std::array<float,2>{0.639023066f, 0.99670887f},
-std::array<float,2>{0.355754584f, 0.678740799f},
-std::array<float,2>{0.892536104f, 0.116207048f},
-std::array<float,2>{0.311924487f, 0.339543879f},
-std::array<float,2>{0.974317133f, 0.770465314f},
-std::array<float,2>{0.108662292f, 0.582573831f},
-std::array<float,2>{0.719763696f, 0.223541722f},
-std::array<float,2>{0.244511768f, 0.056781359f},
-std::array<float,2>{0.552351058f, 0.738072693f},
-std::array<float,2>{0.417288423f, 0.899801433f},
-std::array<float,2>{0.846251309f, 0.486442834f},
-std::array<float,2>{0.31967333f, 0.0821466818f},
-std::array<float,2>{0.922043264f, 0.645462692f},
-std::array<float,2>{0.0583202504f, 0.94188565f},
-std::array<float,2>{0.668971837f, 0.435868651f},
-std::array<float,2>{0.187129498f, 0.258243948f},
-std::array<float,2>{0.583545089f, 0.828801692f},
-std::array<float,2>{0.471473515f, 0.552221835f},
-std::array<float,2>{0.782501936f, 0.177172944f},
-std::array<float,2>{0.390956312f, 0.443679571f},
-std::array<float,2>{0.82149905f, 0.907542408f},
-std::array<float,2>{0.217731014f, 0.688770115f},
-std::array<float,2>{0.502970576f, 0.0175629295f},
-std::array<float,2>{0.0779235065f, 0.207805663f},
-std::array<float,2>{0.703647971f, 0.619054615f},
-std::array<float,2>{0.255880892f, 0.783128142f},
-std::array<float,2>{0.953246713f, 0.36428529f},
-std::array<float,2>{0.43073526f, 0.00149912888f},
-std::array<float,2>{0.860365033f, 0.711454868f},
-std::array<float,2>{0.221464202f, 0.936235011f},
-std::array<float,2>{0.535873413f, 0.4629004f},
-std::array<float,2>{0.114003614f, 0.358878881f},
-std::array<float,2>{0.745655298f, 0.807218313f},
-std::array<float,2>{0.288698137f, 0.60385859f},
-std::array<float,2>{0.997391224f, 0.18934463f},
-std::array<float,2>{0.364138931f, 0.406342953f},
-std::array<float,2>{0.882399917f, 0.959606111f},
-std::array<float,2>{0.00186561351f, 0.639374793f},
-std::array<float,2>{0.651285887f, 0.0736105964f},
-std::array<float,2>{0.130177736f, 0.16592063f},
-std::array<float,2>{0.624228597f, 0.535004079f},
-std::array<float,2>{0.446457297f, 0.8131001f},
-std::array<float,2>{0.759373903f, 0.267623842f},
-std::array<float,2>{0.272545487f, 0.245677665f},
-std::array<float,2>{0.947963476f, 0.572797656f},
-std::array<float,2>{0.0864178538f, 0.755895615f},
-std::array<float,2>{0.699869275f, 0.326120853f},
-std::array<float,2>{0.200132266f, 0.478849143f},
-std::array<float,2>{0.526865363f, 0.885870576f},
-std::array<float,2>{0.388545722f, 0.729373932f},
-std::array<float,2>{0.840212107f, 0.0344703905f},
-std::array<float,2>{0.489836216f, 0.295741618f},
-std::array<float,2>{0.802226186f, 0.865098f},
-std::array<float,2>{0.158956572f, 0.517989635f},
-std::array<float,2>{0.569663823f, 0.126389772f},
-std::array<float,2>{0.0420712978f, 0.107653357f},
-std::array<float,2>{0.674569607f, 0.664250553f},
-std::array<float,2>{0.340762436f, 0.969529629f},
-std::array<float,2>{0.917703331f, 0.405089915f},
-std::array<float,2>{0.378699362f, 0.199532166f},
-std::array<float,2>{0.829299152f, 0.595182896f},
-std::array<float,2>{0.19419162f, 0.800380349f},
-std::array<float,2>{0.5162521f, 0.345178485f},
-std::array<float,2>{0.0851214454f, 0.457906574f},
-std::array<float,2>{0.690050662f, 0.929383755f},
-std::array<float,2>{0.278492063f, 0.70711261f},
-std::array<float,2>{0.944048762f, 0.0116455937f},
-std::array<float,2>{0.330720067f, 0.279091477f},
-std::array<float,2>{0.907721221f, 0.821693957f},
-std::array<float,2>{0.0328168646f, 0.540725291f},
-std::array<float,2>{0.684418321f, 0.163243458f},
-std::array<float,2>{0.168211207f, 0.0652192831f},
-std::array<float,2>{0.572047353f, 0.62510854f},
-std::array<float,2>{0.495701075f, 0.96548748f},
-std::array<float,2>{0.808759034f, 0.416330934f},
-std::array<float,2>{0.296613306f, 0.0462109409f},
-std::array<float,2>{0.985574424f, 0.720564961f},
-std::array<float,2>{0.120161556f, 0.877948761f},
-std::array<float,2>{0.741658926f, 0.46989727f},
-std::array<float,2>{0.230871856f, 0.31534636f},
-std::array<float,2>{0.542860389f, 0.762709141f},
-std::array<float,2>{0.422289401f, 0.569591939f},
-std::array<float,2>{0.873819888f, 0.236982033f},
-std::array<float,2>{0.44378227f, 0.398388773f},
-std::array<float,2>{0.752093613f, 0.979232252f},
-std::array<float,2>{0.137514383f, 0.663205385f},
-std::array<float,2>{0.610956311f, 0.10099569f},
-std::array<float,2>{0.013207254f, 0.138215348f},
-std::array<float,2>{0.641031623f, 0.530554473f},
-std::array<float,2>{0.37139526f, 0.87359488f},
-std::array<float,2>{0.886953115f, 0.283650309f},
-std::array<float,2>{0.480140209f, 0.123235323f},
-std::array<float,2>{0.794722557f, 0.680431128f},
-std::array<float,2>{0.172639906f, 0.985424161f},
-std::array<float,2>{0.590940058f, 0.380011231f},
-std::array<float,2>{0.0509437583f, 0.30357033f},
-std::array<float,2>{0.662526071f, 0.848698497f},
-std::array<float,2>{0.324906141f, 0.51517415f},
-std::array<float,2>{0.934921026f, 0.141769439f},
-std::array<float,2>{0.258590668f, 0.499311924f},
-std::array<float,2>{0.968511999f, 0.898271501f},
-std::array<float,2>{0.0684599206f, 0.749030173f},
-std::array<float,2>{0.717254162f, 0.0540821999f},
-std::array<float,2>{0.206652686f, 0.231584892f},
-std::array<float,2>{0.510307014f, 0.592103243f},
-std::array<float,2>{0.405528456f, 0.776601315f},
-std::array<float,2>{0.818950295f, 0.331962913f},
-std::array<float,2>{0.349835366f, 0.181360826f},
-std::array<float,2>{0.902711093f, 0.562200367f},
-std::array<float,2>{0.0243533067f, 0.838594377f},
-std::array<float,2>{0.627534449f, 0.254385591f},
-std::array<float,2>{0.143554538f, 0.423793525f},
-std::array<float,2>{0.604065537f, 0.950691938f},
-std::array<float,2>{0.464381993f, 0.653032243f},
-std::array<float,2>{0.779459596f, 0.091064468f},
-std::array<float,2>{0.411009103f, 0.369487315f},
-std::array<float,2>{0.852116525f, 0.791942894f},
-std::array<float,2>{0.239195317f, 0.610136926f},
-std::array<float,2>{0.560694158f, 0.214997262f},
-std::array<float,2>{0.0996269211f, 0.0258666258f},
-std::array<float,2>{0.733093739f, 0.696409345f},
-std::array<float,2>{0.30298999f, 0.920786023f},
-std::array<float,2>{0.976631939f, 0.450844616f},
-std::array<float,2>{0.418839067f, 0.158262447f},
-std::array<float,2>{0.851332128f, 0.543079376f},
-std::array<float,2>{0.246509269f, 0.827304363f},
-std::array<float,2>{0.550133348f, 0.275150299f},
-std::array<float,2>{0.103203252f, 0.419980228f},
-std::array<float,2>{0.723734617f, 0.96110791f},
-std::array<float,2>{0.306460619f, 0.630847335f},
-std::array<float,2>{0.971684515f, 0.067788668f},
-std::array<float,2>{0.352844596f, 0.347759128f},
-std::array<float,2>{0.896288693f, 0.80302161f},
-std::array<float,2>{0.0162293855f, 0.598945916f},
-std::array<float,2>{0.634669721f, 0.199030653f},
-std::array<float,2>{0.151625931f, 0.0128920404f},
-std::array<float,2>{0.600117505f, 0.705992937f},
-std::array<float,2>{0.454540819f, 0.924673855f},
-std::array<float,2>{0.772512078f, 0.453956664f},
-std::array<float,2>{0.25342527f, 0.095827654f},
-std::array<float,2>{0.959063351f, 0.657079101f},
-std::array<float,2>{0.0727462992f, 0.982880592f},
-std::array<float,2>{0.709182382f, 0.39305228f},
-std::array<float,2>{0.21423918f, 0.288479954f},
-std::array<float,2>{0.504868448f, 0.867607474f},
-std::array<float,2>{0.395653963f, 0.526324689f},
-std::array<float,2>{0.828084469f, 0.136489913f},
-std::array<float,2>{0.474252552f, 0.474580169f},
-std::array<float,2>{0.788552284f, 0.880528331f},
-std::array<float,2>{0.18302317f, 0.72470814f},
-std::array<float,2>{0.581905067f, 0.0414942354f},
-std::array<float,2>{0.0610930696f, 0.240164056f},
-std::array<float,2>{0.666722536f, 0.564062953f},
-std::array<float,2>{0.315305561f, 0.760766685f},
-std::array<float,2>{0.928709328f, 0.317136347f},
-std::array<float,2>{0.452166498f, 0.0486367494f},
-std::array<float,2>{0.764229894f, 0.743195295f},
-std::array<float,2>{0.125320733f, 0.893178582f},
-std::array<float,2>{0.620913267f, 0.494601876f},
-std::array<float,2>{0.0055359602f, 0.334623367f},
-std::array<float,2>{0.654108167f, 0.77737397f},
-std::array<float,2>{0.362489343f, 0.586346686f},
-std::array<float,2>{0.877982676f, 0.228101715f},
-std::array<float,2>{0.281528682f, 0.37611413f},
-std::array<float,2>{0.995123386f, 0.991302133f},
-std::array<float,2>{0.11222773f, 0.684032977f},
-std::array<float,2>{0.749359727f, 0.117587738f},
-std::array<float,2>{0.225982204f, 0.144855693f},
-std::array<float,2>{0.532577872f, 0.509341359f},
-std::array<float,2>{0.436771423f, 0.845127106f},
-std::array<float,2>{0.865764856f, 0.298891097f},
-std::array<float,2>{0.338923603f, 0.212741286f},
-std::array<float,2>{0.918453336f, 0.613348007f},
-std::array<float,2>{0.0451357216f, 0.795689881f},
-std::array<float,2>{0.679435492f, 0.374223441f},
-std::array<float,2>{0.162867188f, 0.445857823f},
-std::array<float,2>{0.56458652f, 0.916212201f},
-std::array<float,2>{0.48663196f, 0.701983154f},
-std::array<float,2>{0.799923062f, 0.0300996099f},
-std::array<float,2>{0.385948479f, 0.250967771f},
-std::array<float,2>{0.838700354f, 0.841135323f},
-std::array<float,2>{0.196612671f, 0.554887235f},
-std::array<float,2>{0.529958069f, 0.183882326f},
-std::array<float,2>{0.0925911888f, 0.0862052813f},
-std::array<float,2>{0.69734484f, 0.651031196f},
-std::array<float,2>{0.266287595f, 0.945596933f},
-std::array<float,2>{0.9515751f, 0.427916795f},
-std::array<float,2>{0.496916622f, 0.219711453f},
-std::array<float,2>{0.808186114f, 0.58041954f},
-std::array<float,2>{0.166203991f, 0.768922389f},
-std::array<float,2>{0.574420393f, 0.343719155f},
-std::array<float,2>{0.0385501422f, 0.49047181f},
-std::array<float,2>{0.683275282f, 0.905463994f},
-std::array<float,2>{0.332826585f, 0.74156791f},
-std::array<float,2>{0.910170436f, 0.0592730567f},
-std::array<float,2>{0.274426639f, 0.309282601f},
-std::array<float,2>{0.939167619f, 0.858705461f},
-std::array<float,2>{0.0812531337f, 0.500610888f},
-std::array<float,2>{0.692172229f, 0.152537853f},
-std::array<float,2>{0.189564794f, 0.110332951f},
-std::array<float,2>{0.519634306f, 0.675051212f},
-std::array<float,2>{0.379142612f, 0.996011078f},
-std::array<float,2>{0.834563851f, 0.385605156f},
-std::array<float,2>{0.367477059f, 0.0224370863f},
-std::array<float,2>{0.883614719f, 0.694990277f},
-std::array<float,2>{0.0109620364f, 0.912731409f},
-std::array<float,2>{0.647859275f, 0.439573348f},
-std::array<float,2>{0.136175841f, 0.361157089f},
-std::array<float,2>{0.616090417f, 0.788670897f},
-std::array<float,2>{0.438730687f, 0.622805119f},
-std::array<float,2>{0.75710243f, 0.204811081f},
-std::array<float,2>{0.427106529f, 0.432280123f},
-std::array<float,2>{0.870634258f, 0.937935054f},
-std::array<float,2>{0.228415728f, 0.641294539f},
-std::array<float,2>{0.543058336f, 0.0799113214f},
-std::array<float,2>{0.121600896f, 0.175183579f},
-std::array<float,2>{0.735608637f, 0.550136328f},
-std::array<float,2>{0.291729689f, 0.833616555f},
-std::array<float,2>{0.988931417f, 0.262668699f},
-std::array<float,2>{0.399279743f, 0.0754428953f},
-std::array<float,2>{0.815614223f, 0.636685371f},
-std::array<float,2>{0.209290817f, 0.953889132f},
-std::array<float,2>{0.512150049f, 0.410849661f},
-std::array<float,2>{0.0662490949f, 0.273161739f},
-std::array<float,2>{0.711606562f, 0.818775415f},
-std::array<float,2>{0.26378724f, 0.537611842f},
-std::array<float,2>{0.963161826f, 0.1717107f},
-std::array<float,2>{0.32289061f, 0.468296498f},
-std::array<float,2>{0.932792008f, 0.931434989f},
-std::array<float,2>{0.0490796976f, 0.718058765f},
-std::array<float,2>{0.65942204f, 0.00504302187f},
-std::array<float,2>{0.178683341f, 0.192925692f},
-std::array<float,2>{0.588681698f, 0.606122553f},
-std::array<float,2>{0.480535716f, 0.811583281f},
-std::array<float,2>{0.792147458f, 0.35308072f},
-std::array<float,2>{0.300071865f, 0.130363971f},
-std::array<float,2>{0.98047781f, 0.521622181f},
-std::array<float,2>{0.0964777991f, 0.862546027f},
-std::array<float,2>{0.727654219f, 0.291326761f},
-std::array<float,2>{0.237762183f, 0.398646891f},
-std::array<float,2>{0.558404505f, 0.974104881f},
-std::array<float,2>{0.408584028f, 0.668168247f},
-std::array<float,2>{0.857934952f, 0.103035323f},
-std::array<float,2>{0.465716511f, 0.321095288f},
-std::array<float,2>{0.775263906f, 0.753425658f},
-std::array<float,2>{0.14512527f, 0.577288091f},
-std::array<float,2>{0.608656108f, 0.246532723f},
-std::array<float,2>{0.0299096555f, 0.0354203396f},
-std::array<float,2>{0.631014645f, 0.73076576f},
-std::array<float,2>{0.345643014f, 0.888601482f},
-std::array<float,2>{0.899193347f, 0.481327355f},
-std::array<float,2>{0.491969526f, 0.125609681f},
-std::array<float,2>{0.802966893f, 0.518623888f},
-std::array<float,2>{0.156361848f, 0.863650858f},
-std::array<float,2>{0.567262948f, 0.296323955f},
-std::array<float,2>{0.0402143858f, 0.405314088f},
-std::array<float,2>{0.672944486f, 0.970466495f},
-std::array<float,2>{0.343402386f, 0.665080547f},
-std::array<float,2>{0.914091408f, 0.1093091f},
-std::array<float,2>{0.27128619f, 0.324483961f},
-std::array<float,2>{0.947260737f, 0.757502377f},
-std::array<float,2>{0.089843221f, 0.573524415f},
-std::array<float,2>{0.701230526f, 0.244316101f},
-std::array<float,2>{0.202244252f, 0.0339551382f},
-std::array<float,2>{0.525375903f, 0.730300844f},
-std::array<float,2>{0.390194654f, 0.885300994f},
-std::array<float,2>{0.842586994f, 0.479720354f},
-std::array<float,2>{0.367020279f, 0.0727303028f},
-std::array<float,2>{0.879662454f, 0.639656484f},
-std::array<float,2>{0.00229012896f, 0.960706055f},
-std::array<float,2>{0.648959219f, 0.40757069f},
-std::array<float,2>{0.132642567f, 0.269038856f},
-std::array<float,2>{0.622812688f, 0.814087331f},
-std::array<float,2>{0.449121922f, 0.534041822f},
-std::array<float,2>{0.759772599f, 0.164608464f},
-std::array<float,2>{0.433508188f, 0.464836746f},
-std::array<float,2>{0.862727284f, 0.937370777f},
-std::array<float,2>{0.219850898f, 0.712405503f},
-std::array<float,2>{0.537574708f, 0.000108323235f},
-std::array<float,2>{0.115916461f, 0.18843466f},
-std::array<float,2>{0.743530512f, 0.604932189f},
-std::array<float,2>{0.285380393f, 0.808146894f},
-std::array<float,2>{0.99901545f, 0.357448399f},
-std::array<float,2>{0.394234568f, 0.0161010846f},
-std::array<float,2>{0.823439956f, 0.687611997f},
-std::array<float,2>{0.215964019f, 0.906357288f},
-std::array<float,2>{0.500145316f, 0.444996864f},
-std::array<float,2>{0.0746305585f, 0.363449544f},
-std::array<float,2>{0.705614448f, 0.782080531f},
-std::array<float,2>{0.254858226f, 0.61771071f},
-std::array<float,2>{0.956968725f, 0.208190262f},
-std::array<float,2>{0.316672206f, 0.436624438f},
-std::array<float,2>{0.925536871f, 0.942458153f},
-std::array<float,2>{0.0565518513f, 0.646431446f},
-std::array<float,2>{0.670324922f, 0.0833387747f},
-std::array<float,2>{0.185053363f, 0.176378176f},
-std::array<float,2>{0.585622132f, 0.551157117f},
-std::array<float,2>{0.469435811f, 0.829541624f},
-std::array<float,2>{0.783866405f, 0.259680361f},
-std::array<float,2>{0.309609711f, 0.224058762f},
-std::array<float,2>{0.974679828f, 0.583257616f},
-std::array<float,2>{0.105555438f, 0.771009803f},
-std::array<float,2>{0.722329378f, 0.337902069f},
-std::array<float,2>{0.243786469f, 0.487399518f},
-std::array<float,2>{0.554003894f, 0.899343491f},
-std::array<float,2>{0.414277464f, 0.736662567f},
-std::array<float,2>{0.843857765f, 0.0585802682f},
-std::array<float,2>{0.459372103f, 0.30787167f},
-std::array<float,2>{0.767336547f, 0.85314244f},
-std::array<float,2>{0.154008061f, 0.504582822f},
-std::array<float,2>{0.597229183f, 0.149835423f},
-std::array<float,2>{0.0214046389f, 0.117043369f},
-std::array<float,2>{0.63673085f, 0.678472102f},
-std::array<float,2>{0.359300226f, 0.997567117f},
-std::array<float,2>{0.894374728f, 0.389837623f},
-std::array<float,2>{0.412716776f, 0.2164509f},
-std::array<float,2>{0.854762256f, 0.610997915f},
-std::array<float,2>{0.24078235f, 0.792134523f},
-std::array<float,2>{0.560088694f, 0.370794356f},
-std::array<float,2>{0.097752586f, 0.449660808f},
-std::array<float,2>{0.73112911f, 0.92133683f},
-std::array<float,2>{0.301330924f, 0.696049333f},
-std::array<float,2>{0.979002297f, 0.0270592235f},
-std::array<float,2>{0.348853499f, 0.25549987f},
-std::array<float,2>{0.905433536f, 0.839388251f},
-std::array<float,2>{0.0255769063f, 0.561038733f},
-std::array<float,2>{0.626889348f, 0.180356205f},
-std::array<float,2>{0.140845641f, 0.089886196f},
-std::array<float,2>{0.603153646f, 0.65351671f},
-std::array<float,2>{0.462593347f, 0.949391186f},
-std::array<float,2>{0.777538836f, 0.422324449f},
-std::array<float,2>{0.261074185f, 0.0532195829f},
-std::array<float,2>{0.965593755f, 0.748326421f},
-std::array<float,2>{0.0680539012f, 0.897100866f},
-std::array<float,2>{0.715600073f, 0.498678774f},
-std::array<float,2>{0.203303799f, 0.330490857f},
-std::array<float,2>{0.5079422f, 0.775679886f},
-std::array<float,2>{0.404187143f, 0.592993379f},
-std::array<float,2>{0.817250073f, 0.230654627f},
-std::array<float,2>{0.477032959f, 0.379755586f},
-std::array<float,2>{0.795830011f, 0.985061765f},
-std::array<float,2>{0.175067127f, 0.681087852f},
-std::array<float,2>{0.592742383f, 0.124754384f},
-std::array<float,2>{0.0543195866f, 0.141318113f},
-std::array<float,2>{0.660397291f, 0.514577866f},
-std::array<float,2>{0.32779637f, 0.848424375f},
-std::array<float,2>{0.936394632f, 0.304415166f},
-std::array<float,2>{0.442899555f, 0.0997629389f},
-std::array<float,2>{0.751044393f, 0.662575722f},
-std::array<float,2>{0.139502242f, 0.979861856f},
-std::array<float,2>{0.611523509f, 0.396654963f},
-std::array<float,2>{0.0137308715f, 0.284210712f},
-std::array<float,2>{0.644159317f, 0.874905109f},
-std::array<float,2>{0.374102622f, 0.529640019f},
-std::array<float,2>{0.888697743f, 0.136874735f},
-std::array<float,2>{0.29309237f, 0.46951589f},
-std::array<float,2>{0.98794955f, 0.877540052f},
-std::array<float,2>{0.118556514f, 0.718825579f},
-std::array<float,2>{0.739012539f, 0.0453850031f},
-std::array<float,2>{0.232735306f, 0.237425476f},
-std::array<float,2>{0.540113032f, 0.568778932f},
-std::array<float,2>{0.424323976f, 0.762571514f},
-std::array<float,2>{0.872164011f, 0.316225946f},
-std::array<float,2>{0.329839975f, 0.162947997f},
-std::array<float,2>{0.909942269f, 0.539626062f},
-std::array<float,2>{0.0335107297f, 0.82057339f},
-std::array<float,2>{0.685582876f, 0.278213441f},
-std::array<float,2>{0.170154035f, 0.417525262f},
-std::array<float,2>{0.573347211f, 0.966004789f},
-std::array<float,2>{0.49236089f, 0.62634933f},
-std::array<float,2>{0.811902642f, 0.0662495866f},
-std::array<float,2>{0.375743806f, 0.343815744f},
-std::array<float,2>{0.830744624f, 0.799547553f},
-std::array<float,2>{0.192297474f, 0.594416618f},
-std::array<float,2>{0.518654406f, 0.200802118f},
-std::array<float,2>{0.082488291f, 0.0099340938f},
-std::array<float,2>{0.688098371f, 0.708795846f},
-std::array<float,2>{0.28025353f, 0.928464949f},
-std::array<float,2>{0.941701472f, 0.458141088f},
-std::array<float,2>{0.382817566f, 0.185110703f},
-std::array<float,2>{0.837125361f, 0.555713058f},
-std::array<float,2>{0.198838159f, 0.840142488f},
-std::array<float,2>{0.528946698f, 0.251396418f},
-std::array<float,2>{0.0912213996f, 0.429012984f},
-std::array<float,2>{0.695319176f, 0.946732283f},
-std::array<float,2>{0.267842054f, 0.651776433f},
-std::array<float,2>{0.950636923f, 0.0877910182f},
-std::array<float,2>{0.336725771f, 0.373607188f},
-std::array<float,2>{0.921432853f, 0.796357691f},
-std::array<float,2>{0.0439301766f, 0.615146995f},
-std::array<float,2>{0.676421463f, 0.21189636f},
-std::array<float,2>{0.160418674f, 0.0312363505f},
-std::array<float,2>{0.563399613f, 0.702425003f},
-std::array<float,2>{0.485285729f, 0.917531788f},
-std::array<float,2>{0.797500134f, 0.446450442f},
-std::array<float,2>{0.28338328f, 0.118258812f},
-std::array<float,2>{0.993940234f, 0.685349345f},
-std::array<float,2>{0.11018683f, 0.990639925f},
-std::array<float,2>{0.74650538f, 0.375407189f},
-std::array<float,2>{0.223109782f, 0.300612777f},
-std::array<float,2>{0.534787178f, 0.844061911f},
-std::array<float,2>{0.433751822f, 0.508653879f},
-std::array<float,2>{0.863472939f, 0.146278203f},
-std::array<float,2>{0.450856745f, 0.495581329f},
-std::array<float,2>{0.762946784f, 0.894264877f},
-std::array<float,2>{0.127449259f, 0.742432058f},
-std::array<float,2>{0.61768949f, 0.0470459089f},
-std::array<float,2>{0.00700369431f, 0.226990417f},
-std::array<float,2>{0.654746771f, 0.587314725f},
-std::array<float,2>{0.361028552f, 0.778744876f},
-std::array<float,2>{0.87643218f, 0.335503936f},
-std::array<float,2>{0.475703537f, 0.0426396765f},
-std::array<float,2>{0.786217988f, 0.7265113f},
-std::array<float,2>{0.181573704f, 0.879261672f},
-std::array<float,2>{0.579525709f, 0.473169684f},
-std::array<float,2>{0.0594469979f, 0.317404658f},
-std::array<float,2>{0.665076196f, 0.76002872f},
-std::array<float,2>{0.314354569f, 0.562681913f},
-std::array<float,2>{0.927502871f, 0.238373131f},
-std::array<float,2>{0.251747876f, 0.394312888f},
-std::array<float,2>{0.958500266f, 0.983537078f},
-std::array<float,2>{0.0703889057f, 0.657302916f},
-std::array<float,2>{0.708195508f, 0.0971867889f},
-std::array<float,2>{0.211900279f, 0.13487272f},
-std::array<float,2>{0.507535815f, 0.526970506f},
-std::array<float,2>{0.397280604f, 0.869020402f},
-std::array<float,2>{0.824320614f, 0.287579626f},
-std::array<float,2>{0.355281949f, 0.197691143f},
-std::array<float,2>{0.897877276f, 0.598245203f},
-std::array<float,2>{0.0194474533f, 0.804631054f},
-std::array<float,2>{0.636486948f, 0.349065632f},
-std::array<float,2>{0.148876265f, 0.454281986f},
-std::array<float,2>{0.59872514f, 0.924810648f},
-std::array<float,2>{0.455720544f, 0.70613724f},
-std::array<float,2>{0.769577086f, 0.0117449816f},
-std::array<float,2>{0.421335876f, 0.273481548f},
-std::array<float,2>{0.848723888f, 0.827051759f},
-std::array<float,2>{0.249685168f, 0.544893444f},
-std::array<float,2>{0.548154414f, 0.159997374f},
-std::array<float,2>{0.103839539f, 0.0670422241f},
-std::array<float,2>{0.725019395f, 0.62981534f},
-std::array<float,2>{0.307593942f, 0.962697148f},
-std::array<float,2>{0.969144166f, 0.421583146f},
-std::array<float,2>{0.467499673f, 0.247967586f},
-std::array<float,2>{0.775501966f, 0.576316953f},
-std::array<float,2>{0.146859452f, 0.751980424f},
-std::array<float,2>{0.60598141f, 0.322132826f},
-std::array<float,2>{0.0291231889f, 0.481680334f},
-std::array<float,2>{0.63039422f, 0.886962891f},
-std::array<float,2>{0.346686661f, 0.732355118f},
-std::array<float,2>{0.902061343f, 0.036684677f},
-std::array<float,2>{0.297410458f, 0.292632371f},
-std::array<float,2>{0.983036578f, 0.862015665f},
-std::array<float,2>{0.094743669f, 0.523336172f},
-std::array<float,2>{0.728995919f, 0.128995389f},
-std::array<float,2>{0.235274583f, 0.102212489f},
-std::array<float,2>{0.555188775f, 0.668954253f},
-std::array<float,2>{0.407673925f, 0.972934127f},
-std::array<float,2>{0.856319249f, 0.399686545f},
-std::array<float,2>{0.32085219f, 0.00426922925f},
-std::array<float,2>{0.931077719f, 0.717201471f},
-std::array<float,2>{0.0471755937f, 0.930485845f},
-std::array<float,2>{0.657268584f, 0.467647642f},
-std::array<float,2>{0.176433533f, 0.351801991f},
-std::array<float,2>{0.587747157f, 0.810950518f},
-std::array<float,2>{0.483668089f, 0.606548309f},
-std::array<float,2>{0.790199697f, 0.191612795f},
-std::array<float,2>{0.402147919f, 0.411745191f},
-std::array<float,2>{0.814086735f, 0.955073893f},
-std::array<float,2>{0.208767399f, 0.635117531f},
-std::array<float,2>{0.513975441f, 0.0750493482f},
-std::array<float,2>{0.0635556057f, 0.169978097f},
-std::array<float,2>{0.714785457f, 0.538984358f},
-std::array<float,2>{0.263575643f, 0.820047736f},
-std::array<float,2>{0.962581992f, 0.271823555f},
-std::array<float,2>{0.427826703f, 0.078914687f},
-std::array<float,2>{0.867410183f, 0.641854286f},
-std::array<float,2>{0.228693157f, 0.938633084f},
-std::array<float,2>{0.545899153f, 0.432810098f},
-std::array<float,2>{0.123437181f, 0.263170809f},
-std::array<float,2>{0.736713648f, 0.83239615f},
-std::array<float,2>{0.290275782f, 0.549530268f},
-std::array<float,2>{0.990283847f, 0.17428416f},
-std::array<float,2>{0.370015323f, 0.441235423f},
-std::array<float,2>{0.885245323f, 0.913486481f},
-std::array<float,2>{0.00884025358f, 0.69426614f},
-std::array<float,2>{0.646357119f, 0.0226166975f},
-std::array<float,2>{0.134495929f, 0.203443602f},
-std::array<float,2>{0.614466965f, 0.621658266f},
-std::array<float,2>{0.440911233f, 0.787335277f},
-std::array<float,2>{0.755236268f, 0.360083669f},
-std::array<float,2>{0.276460856f, 0.153501719f},
-std::array<float,2>{0.94000268f, 0.501792789f},
-std::array<float,2>{0.0792950168f, 0.857623994f},
-std::array<float,2>{0.693750679f, 0.309597254f},
-std::array<float,2>{0.188290045f, 0.386018187f},
-std::array<float,2>{0.522368133f, 0.994957268f},
-std::array<float,2>{0.382284909f, 0.674437463f},
-std::array<float,2>{0.833254576f, 0.111157008f},
-std::array<float,2>{0.498430967f, 0.342370242f},
-std::array<float,2>{0.806305885f, 0.767968357f},
-std::array<float,2>{0.165368438f, 0.581603765f},
-std::array<float,2>{0.577139437f, 0.22021921f},
-std::array<float,2>{0.0363381915f, 0.0598002151f},
-std::array<float,2>{0.679970562f, 0.740393698f},
-std::array<float,2>{0.335932314f, 0.904511273f},
-std::array<float,2>{0.912820697f, 0.491996408f},
-std::array<float,2>{0.445414633f, 0.167893067f},
-std::array<float,2>{0.758529902f, 0.531328499f},
-std::array<float,2>{0.129215583f, 0.814460576f},
-std::array<float,2>{0.623188853f, 0.265632093f},
-std::array<float,2>{4.04183775e-05f, 0.409885168f},
-std::array<float,2>{0.651687324f, 0.957468331f},
-std::array<float,2>{0.364458382f, 0.636964142f},
-std::array<float,2>{0.881687462f, 0.0713092238f},
-std::array<float,2>{0.287957281f, 0.355653316f},
-std::array<float,2>{0.996474028f, 0.805452883f},
-std::array<float,2>{0.114594512f, 0.603041053f},
-std::array<float,2>{0.744262278f, 0.189928129f},
-std::array<float,2>{0.222554713f, 0.00268339436f},
-std::array<float,2>{0.537032723f, 0.714140534f},
-std::array<float,2>{0.43058899f, 0.934622288f},
-std::array<float,2>{0.859539688f, 0.462231576f},
-std::array<float,2>{0.340833098f, 0.106381424f},
-std::array<float,2>{0.916274071f, 0.667218924f},
-std::array<float,2>{0.0416856706f, 0.972486675f},
-std::array<float,2>{0.675612032f, 0.402464747f},
-std::array<float,2>{0.159531817f, 0.293885231f},
-std::array<float,2>{0.568489075f, 0.86606741f},
-std::array<float,2>{0.488345176f, 0.517248869f},
-std::array<float,2>{0.801392794f, 0.127506196f},
-std::array<float,2>{0.387298375f, 0.478248775f},
-std::array<float,2>{0.841025591f, 0.88458401f},
-std::array<float,2>{0.200659692f, 0.72704792f},
-std::array<float,2>{0.526249886f, 0.0312752426f},
-std::array<float,2>{0.0871357247f, 0.242677018f},
-std::array<float,2>{0.700797439f, 0.570977151f},
-std::array<float,2>{0.271931112f, 0.755371571f},
-std::array<float,2>{0.949130476f, 0.327327013f},
-std::array<float,2>{0.416160136f, 0.056483943f},
-std::array<float,2>{0.846942663f, 0.73552686f},
-std::array<float,2>{0.245471388f, 0.900526285f},
-std::array<float,2>{0.551472247f, 0.485308766f},
-std::array<float,2>{0.10787347f, 0.336350262f},
-std::array<float,2>{0.719023585f, 0.772546768f},
-std::array<float,2>{0.310576439f, 0.584976733f},
-std::array<float,2>{0.972754598f, 0.225763381f},
-std::array<float,2>{0.356969774f, 0.386846751f},
-std::array<float,2>{0.891051948f, 0.99883908f},
-std::array<float,2>{0.0228943303f, 0.675783277f},
-std::array<float,2>{0.640027344f, 0.114866376f},
-std::array<float,2>{0.15540354f, 0.152021021f},
-std::array<float,2>{0.594937623f, 0.506546855f},
-std::array<float,2>{0.45810467f, 0.854333401f},
-std::array<float,2>{0.769428134f, 0.30604735f},
-std::array<float,2>{0.256916314f, 0.21013543f},
-std::array<float,2>{0.955055177f, 0.619433105f},
-std::array<float,2>{0.076614581f, 0.784218431f},
-std::array<float,2>{0.704814434f, 0.365769863f},
-std::array<float,2>{0.218183622f, 0.442200243f},
-std::array<float,2>{0.502686501f, 0.909793496f},
-std::array<float,2>{0.392228574f, 0.690803409f},
-std::array<float,2>{0.820799828f, 0.0193869397f},
-std::array<float,2>{0.472172678f, 0.260269046f},
-std::array<float,2>{0.781794965f, 0.831926703f},
-std::array<float,2>{0.185726911f, 0.553737164f},
-std::array<float,2>{0.583006859f, 0.179523081f},
-std::array<float,2>{0.0570007116f, 0.0847125351f},
-std::array<float,2>{0.66892916f, 0.648185968f},
-std::array<float,2>{0.319157571f, 0.943712711f},
-std::array<float,2>{0.923615277f, 0.434714198f},
-std::array<float,2>{0.404873103f, 0.234371394f},
-std::array<float,2>{0.81936729f, 0.591510713f},
-std::array<float,2>{0.205682978f, 0.774399281f},
-std::array<float,2>{0.510861874f, 0.328981012f},
-std::array<float,2>{0.0693410337f, 0.496828556f},
-std::array<float,2>{0.718167007f, 0.895880222f},
-std::array<float,2>{0.25890848f, 0.746204495f},
-std::array<float,2>{0.967680335f, 0.0510595106f},
-std::array<float,2>{0.325903028f, 0.30241403f},
-std::array<float,2>{0.934202015f, 0.85072124f},
-std::array<float,2>{0.0525723733f, 0.512483239f},
-std::array<float,2>{0.66384244f, 0.144045159f},
-std::array<float,2>{0.173489317f, 0.121186785f},
-std::array<float,2>{0.590007544f, 0.683025301f},
-std::array<float,2>{0.479234248f, 0.987515509f},
-std::array<float,2>{0.793612778f, 0.382668734f},
-std::array<float,2>{0.304220945f, 0.024920132f},
-std::array<float,2>{0.977788985f, 0.698326528f},
-std::array<float,2>{0.100658871f, 0.918386281f},
-std::array<float,2>{0.73351717f, 0.452540129f},
-std::array<float,2>{0.239486694f, 0.368876278f},
-std::array<float,2>{0.561662614f, 0.79032445f},
-std::array<float,2>{0.411447316f, 0.61291784f},
-std::array<float,2>{0.852617502f, 0.217535332f},
-std::array<float,2>{0.463328928f, 0.424991906f},
-std::array<float,2>{0.780453444f, 0.952900469f},
-std::array<float,2>{0.144493118f, 0.654757679f},
-std::array<float,2>{0.604750991f, 0.0921463519f},
-std::array<float,2>{0.0252215043f, 0.182192817f},
-std::array<float,2>{0.628778338f, 0.559742212f},
-std::array<float,2>{0.351236254f, 0.836443484f},
-std::array<float,2>{0.903921902f, 0.257293791f},
-std::array<float,2>{0.494599223f, 0.0625994951f},
-std::array<float,2>{0.810476124f, 0.62868607f},
-std::array<float,2>{0.169362426f, 0.96840167f},
-std::array<float,2>{0.571243107f, 0.414075732f},
-std::array<float,2>{0.0318681076f, 0.281110436f},
-std::array<float,2>{0.684863269f, 0.822858274f},
-std::array<float,2>{0.331562519f, 0.542773664f},
-std::array<float,2>{0.90707022f, 0.161654741f},
-std::array<float,2>{0.277554542f, 0.460371047f},
-std::array<float,2>{0.944363892f, 0.927633107f},
-std::array<float,2>{0.084604606f, 0.710717678f},
-std::array<float,2>{0.690579057f, 0.00933760125f},
-std::array<float,2>{0.195000574f, 0.202000245f},
-std::array<float,2>{0.517452419f, 0.596538246f},
-std::array<float,2>{0.37696147f, 0.797550142f},
-std::array<float,2>{0.828194737f, 0.346018314f},
-std::array<float,2>{0.372232914f, 0.139422506f},
-std::array<float,2>{0.888263166f, 0.528509259f},
-std::array<float,2>{0.0121775763f, 0.872553527f},
-std::array<float,2>{0.64232868f, 0.283044696f},
-std::array<float,2>{0.13772127f, 0.395578086f},
-std::array<float,2>{0.610117376f, 0.976822793f},
-std::array<float,2>{0.444416642f, 0.661345482f},
-std::array<float,2>{0.75298804f, 0.0980206132f},
-std::array<float,2>{0.423823863f, 0.312669694f},
-std::array<float,2>{0.874992728f, 0.765380323f},
-std::array<float,2>{0.231849119f, 0.56676054f},
-std::array<float,2>{0.541802406f, 0.236029401f},
-std::array<float,2>{0.11917723f, 0.044302579f},
-std::array<float,2>{0.740440726f, 0.7218768f},
-std::array<float,2>{0.295500666f, 0.876515269f},
-std::array<float,2>{0.985204637f, 0.472169638f},
-std::array<float,2>{0.436513096f, 0.148136601f},
-std::array<float,2>{0.866657972f, 0.511068821f},
-std::array<float,2>{0.225441813f, 0.845833778f},
-std::array<float,2>{0.532156348f, 0.297599465f},
-std::array<float,2>{0.11269132f, 0.377650559f},
-std::array<float,2>{0.748999f, 0.989858747f},
-std::array<float,2>{0.282241374f, 0.687240005f},
-std::array<float,2>{0.994415104f, 0.120658219f},
-std::array<float,2>{0.362224221f, 0.33299166f},
-std::array<float,2>{0.877813697f, 0.779731631f},
-std::array<float,2>{0.00482556224f, 0.589301705f},
-std::array<float,2>{0.652544141f, 0.229495332f},
-std::array<float,2>{0.126191497f, 0.050506629f},
-std::array<float,2>{0.619586349f, 0.74531424f},
-std::array<float,2>{0.45174247f, 0.890790582f},
-std::array<float,2>{0.76512593f, 0.492364556f},
-std::array<float,2>{0.266893774f, 0.0894582644f},
-std::array<float,2>{0.952345669f, 0.648887277f},
-std::array<float,2>{0.0930364951f, 0.948554933f},
-std::array<float,2>{0.698852479f, 0.427598983f},
-std::array<float,2>{0.1955221f, 0.253560811f},
-std::array<float,2>{0.530826986f, 0.842259943f},
-std::array<float,2>{0.385023981f, 0.558094621f},
-std::array<float,2>{0.839097619f, 0.186062485f},
-std::array<float,2>{0.487493992f, 0.447318107f},
-std::array<float,2>{0.799143791f, 0.915712595f},
-std::array<float,2>{0.163833782f, 0.699950933f},
-std::array<float,2>{0.566177309f, 0.0288407262f},
-std::array<float,2>{0.0463453978f, 0.213699833f},
-std::array<float,2>{0.678282857f, 0.616718829f},
-std::array<float,2>{0.3380844f, 0.794648468f},
-std::array<float,2>{0.919364989f, 0.372974724f},
-std::array<float,2>{0.453459114f, 0.0139337769f},
-std::array<float,2>{0.771902859f, 0.704464257f},
-std::array<float,2>{0.151224107f, 0.922499955f},
-std::array<float,2>{0.600768924f, 0.456733346f},
-std::array<float,2>{0.0166280288f, 0.349670917f},
-std::array<float,2>{0.633203387f, 0.801675439f},
-std::array<float,2>{0.352355927f, 0.599755108f},
-std::array<float,2>{0.894710004f, 0.196129948f},
-std::array<float,2>{0.304813355f, 0.418170631f},
-std::array<float,2>{0.97075516f, 0.96363467f},
-std::array<float,2>{0.101789013f, 0.631291747f},
-std::array<float,2>{0.72317785f, 0.0694060624f},
-std::array<float,2>{0.247362375f, 0.157949001f},
-std::array<float,2>{0.549772263f, 0.546770394f},
-std::array<float,2>{0.41944775f, 0.824676275f},
-std::array<float,2>{0.849847794f, 0.275411338f},
-std::array<float,2>{0.315790296f, 0.240814134f},
-std::array<float,2>{0.929661512f, 0.565077066f},
-std::array<float,2>{0.0619750656f, 0.7584126f},
-std::array<float,2>{0.667853713f, 0.318609715f},
-std::array<float,2>{0.181989491f, 0.475887924f},
-std::array<float,2>{0.580471754f, 0.881559134f},
-std::array<float,2>{0.472884744f, 0.724453211f},
-std::array<float,2>{0.787262797f, 0.0408526957f},
-std::array<float,2>{0.395089626f, 0.285532892f},
-std::array<float,2>{0.826924145f, 0.86928606f},
-std::array<float,2>{0.213509455f, 0.523831427f},
-std::array<float,2>{0.505036175f, 0.133511499f},
-std::array<float,2>{0.0740945935f, 0.0944861919f},
-std::array<float,2>{0.710875571f, 0.659898818f},
-std::array<float,2>{0.252877235f, 0.981859326f},
-std::array<float,2>{0.960635483f, 0.391427428f},
-std::array<float,2>{0.481829852f, 0.193805471f},
-std::array<float,2>{0.791190684f, 0.607628644f},
-std::array<float,2>{0.179480016f, 0.808636606f},
-std::array<float,2>{0.589274287f, 0.354240865f},
-std::array<float,2>{0.0507506989f, 0.466495544f},
-std::array<float,2>{0.658977926f, 0.931870818f},
-std::array<float,2>{0.323922783f, 0.715165198f},
-std::array<float,2>{0.932184756f, 0.00661113998f},
-std::array<float,2>{0.26495102f, 0.269537389f},
-std::array<float,2>{0.964380324f, 0.817245007f},
-std::array<float,2>{0.0648598149f, 0.536372244f},
-std::array<float,2>{0.712358594f, 0.169789359f},
-std::array<float,2>{0.210710764f, 0.0764218718f},
-std::array<float,2>{0.513644636f, 0.633959293f},
-std::array<float,2>{0.399932981f, 0.956831574f},
-std::array<float,2>{0.814489841f, 0.41263938f},
-std::array<float,2>{0.344197333f, 0.0374313854f},
-std::array<float,2>{0.899787843f, 0.733317912f},
-std::array<float,2>{0.0308057927f, 0.890470684f},
-std::array<float,2>{0.632461607f, 0.483094394f},
-std::array<float,2>{0.146364018f, 0.323731303f},
-std::array<float,2>{0.608252048f, 0.751169682f},
-std::array<float,2>{0.465983719f, 0.574981451f},
-std::array<float,2>{0.773832083f, 0.249697551f},
-std::array<float,2>{0.409531653f, 0.401398301f},
-std::array<float,2>{0.85872519f, 0.976218343f},
-std::array<float,2>{0.236677855f, 0.671813548f},
-std::array<float,2>{0.556998074f, 0.105158359f},
-std::array<float,2>{0.0969907194f, 0.131724223f},
-std::array<float,2>{0.727065027f, 0.521085739f},
-std::array<float,2>{0.298917741f, 0.860153377f},
-std::array<float,2>{0.981713474f, 0.289358139f},
-std::array<float,2>{0.380612224f, 0.111913174f},
-std::array<float,2>{0.835145652f, 0.672061324f},
-std::array<float,2>{0.190750927f, 0.993681252f},
-std::array<float,2>{0.521306932f, 0.383526027f},
-std::array<float,2>{0.0801722854f, 0.310976207f},
-std::array<float,2>{0.692435086f, 0.856353581f},
-std::array<float,2>{0.273574293f, 0.502103925f},
-std::array<float,2>{0.937963724f, 0.155527562f},
-std::array<float,2>{0.333608091f, 0.488791466f},
-std::array<float,2>{0.911162794f, 0.903421402f},
-std::array<float,2>{0.0379483253f, 0.739042521f},
-std::array<float,2>{0.682268083f, 0.061292477f},
-std::array<float,2>{0.167037889f, 0.222378388f},
-std::array<float,2>{0.576043725f, 0.579745829f},
-std::array<float,2>{0.497276157f, 0.766848087f},
-std::array<float,2>{0.807561755f, 0.34123534f},
-std::array<float,2>{0.292111784f, 0.172197178f},
-std::array<float,2>{0.989316702f, 0.548318326f},
-std::array<float,2>{0.122183651f, 0.834500372f},
-std::array<float,2>{0.734993219f, 0.264890432f},
-std::array<float,2>{0.226711541f, 0.431220829f},
-std::array<float,2>{0.544002056f, 0.940474212f},
-std::array<float,2>{0.426260233f, 0.643168449f},
-std::array<float,2>{0.869743168f, 0.0807308704f},
-std::array<float,2>{0.438311309f, 0.362917334f},
-std::array<float,2>{0.756297648f, 0.786819398f},
-std::array<float,2>{0.134964392f, 0.623840511f},
-std::array<float,2>{0.616871774f, 0.205391616f},
-std::array<float,2>{0.0106859384f, 0.0198008064f},
-std::array<float,2>{0.646946907f, 0.69320035f},
-std::array<float,2>{0.368238598f, 0.911957145f},
-std::array<float,2>{0.884052455f, 0.438146412f},
-std::array<float,2>{0.493019581f, 0.16114679f},
-std::array<float,2>{0.812193632f, 0.542309999f},
-std::array<float,2>{0.170694441f, 0.822511435f},
-std::array<float,2>{0.573999822f, 0.280518353f},
-std::array<float,2>{0.0339297354f, 0.414679527f},
-std::array<float,2>{0.686102986f, 0.968159795f},
-std::array<float,2>{0.329297304f, 0.628136933f},
-std::array<float,2>{0.909610331f, 0.0630588904f},
-std::array<float,2>{0.279487818f, 0.34632054f},
-std::array<float,2>{0.941954732f, 0.797250152f},
-std::array<float,2>{0.0825254172f, 0.596128047f},
-std::array<float,2>{0.687663734f, 0.201196283f},
-std::array<float,2>{0.191670492f, 0.00891749747f},
-std::array<float,2>{0.519317746f, 0.710112989f},
-std::array<float,2>{0.375028998f, 0.927165806f},
-std::array<float,2>{0.830477357f, 0.460605234f},
-std::array<float,2>{0.3749865f, 0.0985626355f},
-std::array<float,2>{0.889421046f, 0.661665142f},
-std::array<float,2>{0.0142676961f, 0.977458239f},
-std::array<float,2>{0.644034982f, 0.396351784f},
-std::array<float,2>{0.138853192f, 0.282396734f},
-std::array<float,2>{0.612167358f, 0.87298882f},
-std::array<float,2>{0.442632645f, 0.528960288f},
-std::array<float,2>{0.75175333f, 0.13867417f},
-std::array<float,2>{0.424257398f, 0.471786529f},
-std::array<float,2>{0.872954369f, 0.8762182f},
-std::array<float,2>{0.233115092f, 0.722512007f},
-std::array<float,2>{0.540694416f, 0.0444494858f},
-std::array<float,2>{0.119004332f, 0.235474542f},
-std::array<float,2>{0.73845762f, 0.567105412f},
-std::array<float,2>{0.293871939f, 0.764884472f},
-std::array<float,2>{0.987604022f, 0.313096195f},
-std::array<float,2>{0.403643727f, 0.0516890362f},
-std::array<float,2>{0.816491067f, 0.746981919f},
-std::array<float,2>{0.203626022f, 0.89609462f},
-std::array<float,2>{0.508684635f, 0.4965159f},
-std::array<float,2>{0.0675872564f, 0.32855922f},
-std::array<float,2>{0.715175211f, 0.773918748f},
-std::array<float,2>{0.261569738f, 0.591262221f},
-std::array<float,2>{0.965076327f, 0.233776987f},
-std::array<float,2>{0.327545464f, 0.382125527f},
-std::array<float,2>{0.936023057f, 0.988133073f},
-std::array<float,2>{0.054055091f, 0.683304846f},
-std::array<float,2>{0.66111362f, 0.121744715f},
-std::array<float,2>{0.175423443f, 0.143657446f},
-std::array<float,2>{0.592270792f, 0.511861205f},
-std::array<float,2>{0.477102786f, 0.851383567f},
-std::array<float,2>{0.795319557f, 0.301838815f},
-std::array<float,2>{0.300918043f, 0.217271432f},
-std::array<float,2>{0.979322255f, 0.612613261f},
-std::array<float,2>{0.0986033231f, 0.790814996f},
-std::array<float,2>{0.730803013f, 0.368616849f},
-std::array<float,2>{0.240496248f, 0.452736646f},
-std::array<float,2>{0.559860706f, 0.918463409f},
-std::array<float,2>{0.412125677f, 0.69876653f},
-std::array<float,2>{0.85526073f, 0.0246579535f},
-std::array<float,2>{0.462183177f, 0.257402748f},
-std::array<float,2>{0.777890801f, 0.836112976f},
-std::array<float,2>{0.141342714f, 0.560413718f},
-std::array<float,2>{0.602802873f, 0.18198438f},
-std::array<float,2>{0.0262564644f, 0.0925849602f},
-std::array<float,2>{0.626081288f, 0.655128896f},
-std::array<float,2>{0.349445015f, 0.952519059f},
-std::array<float,2>{0.906192899f, 0.425399244f},
-std::array<float,2>{0.414818436f, 0.226479352f},
-std::array<float,2>{0.844510496f, 0.585628271f},
-std::array<float,2>{0.24318707f, 0.773335576f},
-std::array<float,2>{0.55449748f, 0.336703688f},
-std::array<float,2>{0.106246516f, 0.484808028f},
-std::array<float,2>{0.721823275f, 0.900913656f},
-std::array<float,2>{0.310312212f, 0.736080945f},
-std::array<float,2>{0.975299835f, 0.0557274073f},
-std::array<float,2>{0.358587235f, 0.306238323f},
-std::array<float,2>{0.893960178f, 0.85366565f},
-std::array<float,2>{0.0209716037f, 0.505950391f},
-std::array<float,2>{0.637306035f, 0.151542023f},
-std::array<float,2>{0.153626144f, 0.114578739f},
-std::array<float,2>{0.597146571f, 0.676591158f},
-std::array<float,2>{0.459896177f, 0.998237908f},
-std::array<float,2>{0.766727507f, 0.387263536f},
-std::array<float,2>{0.253932357f, 0.0187556222f},
-std::array<float,2>{0.956311584f, 0.691168666f},
-std::array<float,2>{0.0749003664f, 0.909528196f},
-std::array<float,2>{0.705335796f, 0.441562206f},
-std::array<float,2>{0.216583326f, 0.365277082f},
-std::array<float,2>{0.500534415f, 0.785122871f},
-std::array<float,2>{0.39369452f, 0.619730651f},
-std::array<float,2>{0.823913038f, 0.210633501f},
-std::array<float,2>{0.46876362f, 0.435447395f},
-std::array<float,2>{0.783536553f, 0.944018722f},
-std::array<float,2>{0.185358912f, 0.647619605f},
-std::array<float,2>{0.585324645f, 0.0842047334f},
-std::array<float,2>{0.0559822172f, 0.179187611f},
-std::array<float,2>{0.670672357f, 0.554408908f},
-std::array<float,2>{0.317239553f, 0.831210971f},
-std::array<float,2>{0.92509079f, 0.259958506f},
-std::array<float,2>{0.448528975f, 0.0718938708f},
-std::array<float,2>{0.76038897f, 0.637596607f},
-std::array<float,2>{0.132275522f, 0.957736433f},
-std::array<float,2>{0.622418046f, 0.409433782f},
-std::array<float,2>{0.00247484143f, 0.26632008f},
-std::array<float,2>{0.648611844f, 0.815364897f},
-std::array<float,2>{0.366216332f, 0.532078445f},
-std::array<float,2>{0.879021227f, 0.167003185f},
-std::array<float,2>{0.285982341f, 0.462569088f},
-std::array<float,2>{0.998109281f, 0.93531698f},
-std::array<float,2>{0.115295134f, 0.714745462f},
-std::array<float,2>{0.74404031f, 0.00233075046f},
-std::array<float,2>{0.220615014f, 0.190136641f},
-std::array<float,2>{0.538050413f, 0.602553546f},
-std::array<float,2>{0.4330042f, 0.804867864f},
-std::array<float,2>{0.863041043f, 0.356162816f},
-std::array<float,2>{0.342833459f, 0.126972601f},
-std::array<float,2>{0.914777339f, 0.516896784f},
-std::array<float,2>{0.040897768f, 0.865524769f},
-std::array<float,2>{0.673605621f, 0.293040544f},
-std::array<float,2>{0.157175615f, 0.403088301f},
-std::array<float,2>{0.566644907f, 0.971819699f},
-std::array<float,2>{0.491512537f, 0.667699814f},
-std::array<float,2>{0.803447425f, 0.105516635f},
-std::array<float,2>{0.390091866f, 0.328096122f},
-std::array<float,2>{0.841829896f, 0.755318701f},
-std::array<float,2>{0.202675521f, 0.570574343f},
-std::array<float,2>{0.524535894f, 0.242199451f},
-std::array<float,2>{0.089033924f, 0.032085672f},
-std::array<float,2>{0.702026486f, 0.727299333f},
-std::array<float,2>{0.270831287f, 0.884098291f},
-std::array<float,2>{0.946730494f, 0.477814168f},
-std::array<float,2>{0.382673442f, 0.155799374f},
-std::array<float,2>{0.833821058f, 0.502545893f},
-std::array<float,2>{0.187981173f, 0.855764866f},
-std::array<float,2>{0.521880507f, 0.311410934f},
-std::array<float,2>{0.0795963258f, 0.383237153f},
-std::array<float,2>{0.69400084f, 0.993621886f},
-std::array<float,2>{0.276977062f, 0.672563493f},
-std::array<float,2>{0.939565837f, 0.11178299f},
-std::array<float,2>{0.335297614f, 0.341311723f},
-std::array<float,2>{0.91215235f, 0.767238498f},
-std::array<float,2>{0.0370126255f, 0.579504907f},
-std::array<float,2>{0.680546224f, 0.221890852f},
-std::array<float,2>{0.165760323f, 0.0608330444f},
-std::array<float,2>{0.576188624f, 0.738313317f},
-std::array<float,2>{0.498657674f, 0.904279113f},
-std::array<float,2>{0.805731297f, 0.488439381f},
-std::array<float,2>{0.290912837f, 0.0805638283f},
-std::array<float,2>{0.99082762f, 0.642597795f},
-std::array<float,2>{0.123814575f, 0.941315293f},
-std::array<float,2>{0.736944377f, 0.431025505f},
-std::array<float,2>{0.229482442f, 0.265507847f},
-std::array<float,2>{0.546796679f, 0.834026575f},
-std::array<float,2>{0.428551048f, 0.548726201f},
-std::array<float,2>{0.867910743f, 0.17255868f},
-std::array<float,2>{0.441195101f, 0.437910318f},
-std::array<float,2>{0.755665481f, 0.911293268f},
-std::array<float,2>{0.134204373f, 0.692686737f},
-std::array<float,2>{0.615188241f, 0.0202859808f},
-std::array<float,2>{0.00955641642f, 0.205959827f},
-std::array<float,2>{0.645797729f, 0.623072505f},
-std::array<float,2>{0.369295686f, 0.786360383f},
-std::array<float,2>{0.885606289f, 0.362693042f},
-std::array<float,2>{0.484173059f, 0.00629765214f},
-std::array<float,2>{0.790825367f, 0.715545356f},
-std::array<float,2>{0.176239401f, 0.93250227f},
-std::array<float,2>{0.586925149f, 0.466165632f},
-std::array<float,2>{0.0477053411f, 0.353808016f},
-std::array<float,2>{0.657958329f, 0.809115112f},
-std::array<float,2>{0.320697457f, 0.608185768f},
-std::array<float,2>{0.931458294f, 0.194222301f},
-std::array<float,2>{0.263071418f, 0.412476838f},
-std::array<float,2>{0.962347329f, 0.956175387f},
-std::array<float,2>{0.0641909614f, 0.634547234f},
-std::array<float,2>{0.714317083f, 0.076682575f},
-std::array<float,2>{0.208277568f, 0.169340745f},
-std::array<float,2>{0.514530361f, 0.536772609f},
-std::array<float,2>{0.40144223f, 0.816616297f},
-std::array<float,2>{0.813619435f, 0.270448893f},
-std::array<float,2>{0.347283036f, 0.249024004f},
-std::array<float,2>{0.901505172f, 0.574504018f},
-std::array<float,2>{0.0287254956f, 0.751940906f},
-std::array<float,2>{0.630105376f, 0.32358402f},
-std::array<float,2>{0.147296384f, 0.482470989f},
-std::array<float,2>{0.605812013f, 0.890020609f},
-std::array<float,2>{0.466815203f, 0.732446551f},
-std::array<float,2>{0.776313901f, 0.0377002582f},
-std::array<float,2>{0.40784055f, 0.289985895f},
-std::array<float,2>{0.855637252f, 0.859862387f},
-std::array<float,2>{0.234400988f, 0.520755112f},
-std::array<float,2>{0.555167139f, 0.131259799f},
-std::array<float,2>{0.0954744145f, 0.104766987f},
-std::array<float,2>{0.729435205f, 0.671090007f},
-std::array<float,2>{0.297000617f, 0.975751102f},
-std::array<float,2>{0.982512236f, 0.402197838f},
-std::array<float,2>{0.455293536f, 0.195762709f},
-std::array<float,2>{0.770401776f, 0.600428998f},
-std::array<float,2>{0.149167836f, 0.800951004f},
-std::array<float,2>{0.599337339f, 0.350105822f},
-std::array<float,2>{0.0188531615f, 0.456438303f},
-std::array<float,2>{0.635771334f, 0.922305703f},
-std::array<float,2>{0.354975015f, 0.704713404f},
-std::array<float,2>{0.898231387f, 0.0145003712f},
-std::array<float,2>{0.306711137f, 0.276363045f},
-std::array<float,2>{0.969475985f, 0.82490766f},
-std::array<float,2>{0.10444621f, 0.545953751f},
-std::array<float,2>{0.725240827f, 0.157588348f},
-std::array<float,2>{0.249448195f, 0.0703036264f},
-std::array<float,2>{0.548601985f, 0.631359935f},
-std::array<float,2>{0.421826899f, 0.962928653f},
-std::array<float,2>{0.8494488f, 0.418555051f},
-std::array<float,2>{0.313783258f, 0.040337f},
-std::array<float,2>{0.926812112f, 0.724062383f},
-std::array<float,2>{0.058844436f, 0.880877912f},
-std::array<float,2>{0.66579628f, 0.476221025f},
-std::array<float,2>{0.180789262f, 0.319333047f},
-std::array<float,2>{0.579904437f, 0.757907629f},
-std::array<float,2>{0.476123661f, 0.564567804f},
-std::array<float,2>{0.786949575f, 0.240355402f},
-std::array<float,2>{0.39691928f, 0.390997559f},
-std::array<float,2>{0.824730814f, 0.982415974f},
-std::array<float,2>{0.211086869f, 0.659249902f},
-std::array<float,2>{0.506853878f, 0.0939957872f},
-std::array<float,2>{0.0712546259f, 0.132948577f},
-std::array<float,2>{0.708868623f, 0.524229825f},
-std::array<float,2>{0.25140357f, 0.870016754f},
-std::array<float,2>{0.958439946f, 0.285813123f},
-std::array<float,2>{0.434123039f, 0.120519899f},
-std::array<float,2>{0.864176452f, 0.6869542f},
-std::array<float,2>{0.22348243f, 0.989696383f},
-std::array<float,2>{0.534345269f, 0.377264738f},
-std::array<float,2>{0.10942857f, 0.296978503f},
-std::array<float,2>{0.746914506f, 0.846225262f},
-std::array<float,2>{0.284062773f, 0.511451602f},
-std::array<float,2>{0.993215084f, 0.147466049f},
-std::array<float,2>{0.360497802f, 0.492824703f},
-std::array<float,2>{0.876830399f, 0.89142251f},
-std::array<float,2>{0.00749739166f, 0.74564296f},
-std::array<float,2>{0.654789984f, 0.0498456806f},
-std::array<float,2>{0.126972944f, 0.230034664f},
-std::array<float,2>{0.617502332f, 0.589637697f},
-std::array<float,2>{0.450481325f, 0.780152798f},
-std::array<float,2>{0.763427258f, 0.332250774f},
-std::array<float,2>{0.268250674f, 0.185939804f},
-std::array<float,2>{0.95106256f, 0.558591187f},
-std::array<float,2>{0.0917712599f, 0.842582762f},
-std::array<float,2>{0.695936501f, 0.253180444f},
-std::array<float,2>{0.198302731f, 0.427222282f},
-std::array<float,2>{0.528458595f, 0.948961139f},
-std::array<float,2>{0.383671254f, 0.649067163f},
-std::array<float,2>{0.837885857f, 0.089106366f},
-std::array<float,2>{0.484379292f, 0.372155577f},
-std::array<float,2>{0.797061205f, 0.794415832f},
-std::array<float,2>{0.160825402f, 0.616382837f},
-std::array<float,2>{0.562864006f, 0.212982461f},
-std::array<float,2>{0.0431942418f, 0.0284528192f},
-std::array<float,2>{0.67604804f, 0.699287415f},
-std::array<float,2>{0.33629328f, 0.915318549f},
-std::array<float,2>{0.921167552f, 0.447972387f},
-std::array<float,2>{0.444987893f, 0.137602925f},
-std::array<float,2>{0.753683209f, 0.529990077f},
-std::array<float,2>{0.138409942f, 0.874340296f},
-std::array<float,2>{0.609461606f, 0.284847081f},
-std::array<float,2>{0.0125562726f, 0.397109896f},
-std::array<float,2>{0.641982853f, 0.980333984f},
-std::array<float,2>{0.372814476f, 0.662804008f},
-std::array<float,2>{0.887863755f, 0.100454867f},
-std::array<float,2>{0.295052022f, 0.315706074f},
-std::array<float,2>{0.984643042f, 0.76220119f},
-std::array<float,2>{0.120086268f, 0.569151223f},
-std::array<float,2>{0.740933895f, 0.237986669f},
-std::array<float,2>{0.232374281f, 0.0456061736f},
-std::array<float,2>{0.541483045f, 0.719467163f},
-std::array<float,2>{0.423254162f, 0.877103031f},
-std::array<float,2>{0.874354362f, 0.469214737f},
-std::array<float,2>{0.331520557f, 0.0658600107f},
-std::array<float,2>{0.906687737f, 0.626609027f},
-std::array<float,2>{0.0317092054f, 0.96670568f},
-std::array<float,2>{0.685383022f, 0.417357683f},
-std::array<float,2>{0.169662312f, 0.277481943f},
-std::array<float,2>{0.570501864f, 0.821023881f},
-std::array<float,2>{0.495006382f, 0.539441884f},
-std::array<float,2>{0.80986172f, 0.162582234f},
-std::array<float,2>{0.377634674f, 0.458895683f},
-std::array<float,2>{0.828712165f, 0.927980363f},
-std::array<float,2>{0.194594234f, 0.708077788f},
-std::array<float,2>{0.516866982f, 0.0107268868f},
-std::array<float,2>{0.0840509757f, 0.200605735f},
-std::array<float,2>{0.691040039f, 0.594066381f},
-std::array<float,2>{0.278262585f, 0.798842013f},
-std::array<float,2>{0.944986641f, 0.344717234f},
-std::array<float,2>{0.411748976f, 0.0263994429f},
-std::array<float,2>{0.853321195f, 0.695630431f},
-std::array<float,2>{0.239752978f, 0.921512485f},
-std::array<float,2>{0.562187374f, 0.450187594f},
-std::array<float,2>{0.101117775f, 0.370144099f},
-std::array<float,2>{0.73389107f, 0.792941988f},
-std::array<float,2>{0.304008454f, 0.610494316f},
-std::array<float,2>{0.97840935f, 0.216104597f},
-std::array<float,2>{0.350759894f, 0.422573358f},
-std::array<float,2>{0.903342724f, 0.950100362f},
-std::array<float,2>{0.0247191917f, 0.654218912f},
-std::array<float,2>{0.628056586f, 0.0907945856f},
-std::array<float,2>{0.143692151f, 0.179714084f},
-std::array<float,2>{0.605202794f, 0.560572386f},
-std::array<float,2>{0.463737786f, 0.839157522f},
-std::array<float,2>{0.780835271f, 0.255025983f},
-std::array<float,2>{0.259660661f, 0.231129259f},
-std::array<float,2>{0.967159271f, 0.59351933f},
-std::array<float,2>{0.0701878592f, 0.77597028f},
-std::array<float,2>{0.718447328f, 0.330864787f},
-std::array<float,2>{0.20534423f, 0.498429149f},
-std::array<float,2>{0.511688828f, 0.896691382f},
-std::array<float,2>{0.40474683f, 0.748906136f},
-std::array<float,2>{0.820147395f, 0.0533653945f},
-std::array<float,2>{0.478928894f, 0.303726941f},
-std::array<float,2>{0.793119311f, 0.847672522f},
-std::array<float,2>{0.17324616f, 0.514026642f},
-std::array<float,2>{0.590386271f, 0.140860066f},
-std::array<float,2>{0.0521336682f, 0.124370337f},
-std::array<float,2>{0.663121879f, 0.681458533f},
-std::array<float,2>{0.325328529f, 0.984767497f},
-std::array<float,2>{0.933987916f, 0.379079998f},
-std::array<float,2>{0.391674876f, 0.208513558f},
-std::array<float,2>{0.820827544f, 0.617469132f},
-std::array<float,2>{0.218447581f, 0.781421125f},
-std::array<float,2>{0.502242506f, 0.363885134f},
-std::array<float,2>{0.0768394545f, 0.444789559f},
-std::array<float,2>{0.704288006f, 0.907175004f},
-std::array<float,2>{0.257391781f, 0.688165963f},
-std::array<float,2>{0.95454824f, 0.0164667442f},
-std::array<float,2>{0.31862542f, 0.258791f},
-std::array<float,2>{0.922884941f, 0.829822719f},
-std::array<float,2>{0.0573329031f, 0.551712632f},
-std::array<float,2>{0.668388426f, 0.176175639f},
-std::array<float,2>{0.186414734f, 0.0835218057f},
-std::array<float,2>{0.582333028f, 0.645917118f},
-std::array<float,2>{0.472118288f, 0.94312942f},
-std::array<float,2>{0.781570673f, 0.437315792f},
-std::array<float,2>{0.311325192f, 0.0578701571f},
-std::array<float,2>{0.973297238f, 0.737035871f},
-std::array<float,2>{0.10792309f, 0.898818314f},
-std::array<float,2>{0.719304025f, 0.488079399f},
-std::array<float,2>{0.246047288f, 0.338409662f},
-std::array<float,2>{0.550847352f, 0.770728707f},
-std::array<float,2>{0.416647255f, 0.583642185f},
-std::array<float,2>{0.847399771f, 0.224583432f},
-std::array<float,2>{0.458652109f, 0.390147686f},
-std::array<float,2>{0.768731534f, 0.997099519f},
-std::array<float,2>{0.156005859f, 0.678158045f},
-std::array<float,2>{0.595494866f, 0.116569147f},
-std::array<float,2>{0.0234040357f, 0.150313616f},
-std::array<float,2>{0.640421212f, 0.504236937f},
-std::array<float,2>{0.356743515f, 0.852835119f},
-std::array<float,2>{0.891409397f, 0.308565259f},
-std::array<float,2>{0.488967746f, 0.108874328f},
-std::array<float,2>{0.80105716f, 0.665555835f},
-std::array<float,2>{0.159910873f, 0.969863951f},
-std::array<float,2>{0.56915319f, 0.406140059f},
-std::array<float,2>{0.0412288718f, 0.296828449f},
-std::array<float,2>{0.675254047f, 0.863817632f},
-std::array<float,2>{0.341700047f, 0.51946044f},
-std::array<float,2>{0.916684389f, 0.125487819f},
-std::array<float,2>{0.272168517f, 0.48025614f},
-std::array<float,2>{0.948244274f, 0.884799302f},
-std::array<float,2>{0.0877706259f, 0.729791224f},
-std::array<float,2>{0.700621426f, 0.0333749838f},
-std::array<float,2>{0.200998634f, 0.244633079f},
-std::array<float,2>{0.525650382f, 0.573735356f},
-std::array<float,2>{0.386739224f, 0.757250547f},
-std::array<float,2>{0.841691196f, 0.325167805f},
-std::array<float,2>{0.365210086f, 0.164534315f},
-std::array<float,2>{0.881330311f, 0.533661664f},
-std::array<float,2>{0.000961790502f, 0.813762367f},
-std::array<float,2>{0.65230751f, 0.269305617f},
-std::array<float,2>{0.129434198f, 0.407968521f},
-std::array<float,2>{0.62388432f, 0.960113466f},
-std::array<float,2>{0.445810169f, 0.640184104f},
-std::array<float,2>{0.757986605f, 0.0729839429f},
-std::array<float,2>{0.43008402f, 0.358046621f},
-std::array<float,2>{0.860135555f, 0.807789385f},
-std::array<float,2>{0.22173661f, 0.605218947f},
-std::array<float,2>{0.536169171f, 0.187599555f},
-std::array<float,2>{0.115032323f, 0.000762059761f},
-std::array<float,2>{0.744994164f, 0.7119205f},
-std::array<float,2>{0.287243605f, 0.93685931f},
-std::array<float,2>{0.996628881f, 0.464206964f},
-std::array<float,2>{0.426477939f, 0.174725458f},
-std::array<float,2>{0.869266391f, 0.549247205f},
-std::array<float,2>{0.227521881f, 0.832886517f},
-std::array<float,2>{0.544677496f, 0.26352343f},
-std::array<float,2>{0.122844905f, 0.433413357f},
-std::array<float,2>{0.734442651f, 0.939418018f},
-std::array<float,2>{0.292607039f, 0.642281175f},
-std::array<float,2>{0.990020156f, 0.0781813636f},
-std::array<float,2>{0.368815362f, 0.359443486f},
-std::array<float,2>{0.884471893f, 0.787607014f},
-std::array<float,2>{0.00994415116f, 0.62120223f},
-std::array<float,2>{0.647116125f, 0.203618959f},
-std::array<float,2>{0.135281786f, 0.0234209038f},
-std::array<float,2>{0.616547346f, 0.693430603f},
-std::array<float,2>{0.437821984f, 0.91405046f},
-std::array<float,2>{0.756829441f, 0.440615058f},
-std::array<float,2>{0.274413854f, 0.110472292f},
-std::array<float,2>{0.938395023f, 0.674185336f},
-std::array<float,2>{0.0809008926f, 0.994445622f},
-std::array<float,2>{0.693233609f, 0.386570573f},
-std::array<float,2>{0.191278413f, 0.310082078f},
-std::array<float,2>{0.52088052f, 0.858271718f},
-std::array<float,2>{0.380199373f, 0.501068652f},
-std::array<float,2>{0.835776508f, 0.153939426f},
-std::array<float,2>{0.49792254f, 0.491612971f},
-std::array<float,2>{0.807075322f, 0.905104101f},
-std::array<float,2>{0.167877808f, 0.740881503f},
-std::array<float,2>{0.575313747f, 0.0604052506f},
-std::array<float,2>{0.0374165848f, 0.219816953f},
-std::array<float,2>{0.681881964f, 0.581414402f},
-std::array<float,2>{0.333121628f, 0.768092036f},
-std::array<float,2>{0.911724865f, 0.341837257f},
-std::array<float,2>{0.466488332f, 0.0362143405f},
-std::array<float,2>{0.77433753f, 0.731560767f},
-std::array<float,2>{0.145754978f, 0.887296617f},
-std::array<float,2>{0.607663095f, 0.481946588f},
-std::array<float,2>{0.0307232644f, 0.321529239f},
-std::array<float,2>{0.631969094f, 0.752790749f},
-std::array<float,2>{0.344424605f, 0.576911449f},
-std::array<float,2>{0.900359631f, 0.24727954f},
-std::array<float,2>{0.299466461f, 0.400168151f},
-std::array<float,2>{0.982347012f, 0.973487437f},
-std::array<float,2>{0.0975188613f, 0.669749975f},
-std::array<float,2>{0.726644516f, 0.101877317f},
-std::array<float,2>{0.236860678f, 0.129525572f},
-std::array<float,2>{0.557325721f, 0.522629499f},
-std::array<float,2>{0.409867674f, 0.861524284f},
-std::array<float,2>{0.859198332f, 0.292012125f},
-std::array<float,2>{0.323407263f, 0.192187741f},
-std::array<float,2>{0.932080805f, 0.607140124f},
-std::array<float,2>{0.0499656163f, 0.811079025f},
-std::array<float,2>{0.658689916f, 0.352260619f},
-std::array<float,2>{0.179092154f, 0.467174262f},
-std::array<float,2>{0.589650095f, 0.929970741f},
-std::array<float,2>{0.482358068f, 0.717763782f},
-std::array<float,2>{0.791979849f, 0.00481523713f},
-std::array<float,2>{0.399495661f, 0.272058725f},
-std::array<float,2>{0.815354049f, 0.819616079f},
-std::array<float,2>{0.209963173f, 0.538096428f},
-std::array<float,2>{0.512985766f, 0.170746133f},
-std::array<float,2>{0.0651555061f, 0.0743597448f},
-std::array<float,2>{0.712835193f, 0.635664523f},
-std::array<float,2>{0.265225232f, 0.954192817f},
-std::array<float,2>{0.963934422f, 0.411316603f},
-std::array<float,2>{0.473402351f, 0.239003912f},
-std::array<float,2>{0.787772775f, 0.563426197f},
-std::array<float,2>{0.182258427f, 0.760721564f},
-std::array<float,2>{0.580589116f, 0.317887276f},
-std::array<float,2>{0.0623972751f, 0.472674727f},
-std::array<float,2>{0.66702342f, 0.879706919f},
-std::array<float,2>{0.315936834f, 0.725740969f},
-std::array<float,2>{0.928745091f, 0.0420333743f},
-std::array<float,2>{0.25238207f, 0.28779453f},
-std::array<float,2>{0.960380435f, 0.868314207f},
-std::array<float,2>{0.0732846931f, 0.526631117f},
-std::array<float,2>{0.710052252f, 0.135642037f},
-std::array<float,2>{0.212957755f, 0.0969798118f},
-std::array<float,2>{0.505425036f, 0.658045411f},
-std::array<float,2>{0.394556373f, 0.984279454f},
-std::array<float,2>{0.826402307f, 0.394000173f},
-std::array<float,2>{0.352033168f, 0.0124387955f},
-std::array<float,2>{0.895034015f, 0.70696491f},
-std::array<float,2>{0.0170956329f, 0.925363183f},
-std::array<float,2>{0.633301139f, 0.454814017f},
-std::array<float,2>{0.15077059f, 0.349560261f},
-std::array<float,2>{0.601181686f, 0.804021895f},
-std::array<float,2>{0.453730643f, 0.598050296f},
-std::array<float,2>{0.772270918f, 0.198091462f},
-std::array<float,2>{0.419353545f, 0.421085387f},
-std::array<float,2>{0.850398004f, 0.962372065f},
-std::array<float,2>{0.247907698f, 0.629335701f},
-std::array<float,2>{0.54929024f, 0.0665551275f},
-std::array<float,2>{0.102193221f, 0.159486651f},
-std::array<float,2>{0.722869515f, 0.544136167f},
-std::array<float,2>{0.305496573f, 0.826633692f},
-std::array<float,2>{0.97149533f, 0.274226964f},
-std::array<float,2>{0.385655612f, 0.087242052f},
-std::array<float,2>{0.839721262f, 0.652308464f},
-std::array<float,2>{0.196276903f, 0.946858764f},
-std::array<float,2>{0.530329347f, 0.429682106f},
-std::array<float,2>{0.0934065506f, 0.251500905f},
-std::array<float,2>{0.698714852f, 0.840787292f},
-std::array<float,2>{0.267510384f, 0.556477606f},
-std::array<float,2>{0.95306927f, 0.185022727f},
-std::array<float,2>{0.338830352f, 0.446893841f},
-std::array<float,2>{0.919830263f, 0.917126656f},
-std::array<float,2>{0.0464041047f, 0.702907205f},
-std::array<float,2>{0.677806973f, 0.0306688529f},
-std::array<float,2>{0.163407177f, 0.211234808f},
-std::array<float,2>{0.565899074f, 0.614735663f},
-std::array<float,2>{0.488112301f, 0.796731949f},
-std::array<float,2>{0.799626768f, 0.373293787f},
-std::array<float,2>{0.283100009f, 0.145834029f},
-std::array<float,2>{0.9949646f, 0.508013904f},
-std::array<float,2>{0.113020726f, 0.844705284f},
-std::array<float,2>{0.748167515f, 0.299960732f},
-std::array<float,2>{0.224964038f, 0.375723064f},
-std::array<float,2>{0.531639874f, 0.990729928f},
-std::array<float,2>{0.435608178f, 0.684780121f},
-std::array<float,2>{0.866810143f, 0.11907661f},
-std::array<float,2>{0.451433718f, 0.335014522f},
-std::array<float,2>{0.765177131f, 0.779269874f},
-std::array<float,2>{0.126580656f, 0.587474763f},
-std::array<float,2>{0.619956434f, 0.227351978f},
-std::array<float,2>{0.00432355143f, 0.047434397f},
-std::array<float,2>{0.653240919f, 0.742940605f},
-std::array<float,2>{0.361342549f, 0.893670142f},
-std::array<float,2>{0.877254426f, 0.49567157f},
-std::array<float,2>{0.478215307f, 0.142190397f},
-std::array<float,2>{0.796248019f, 0.514908969f},
-std::array<float,2>{0.174130917f, 0.849442244f},
-std::array<float,2>{0.59363544f, 0.30304423f},
-std::array<float,2>{0.0528253913f, 0.38052398f},
-std::array<float,2>{0.661914468f, 0.986250043f},
-std::array<float,2>{0.327062041f, 0.679906547f},
-std::array<float,2>{0.936758876f, 0.123598889f},
-std::array<float,2>{0.260319173f, 0.331251442f},
-std::array<float,2>{0.966478646f, 0.777081907f},
-std::array<float,2>{0.0664851218f, 0.592654169f},
-std::array<float,2>{0.716673017f, 0.232035995f},
-std::array<float,2>{0.204280853f, 0.0545927919f},
-std::array<float,2>{0.509023249f, 0.749891758f},
-std::array<float,2>{0.402464986f, 0.897590041f},
-std::array<float,2>{0.81785053f, 0.499582589f},
-std::array<float,2>{0.348400623f, 0.0913258418f},
-std::array<float,2>{0.904384196f, 0.65256083f},
-std::array<float,2>{0.0266059358f, 0.950589895f},
-std::array<float,2>{0.625658929f, 0.422972083f},
-std::array<float,2>{0.142335042f, 0.254469812f},
-std::array<float,2>{0.601876795f, 0.838265359f},
-std::array<float,2>{0.461204499f, 0.561634123f},
-std::array<float,2>{0.77860713f, 0.18086566f},
-std::array<float,2>{0.413709909f, 0.450323164f},
-std::array<float,2>{0.854199827f, 0.920354128f},
-std::array<float,2>{0.241309822f, 0.696890712f},
-std::array<float,2>{0.559303105f, 0.0260726158f},
-std::array<float,2>{0.0988109484f, 0.215391263f},
-std::array<float,2>{0.731769264f, 0.609672606f},
-std::array<float,2>{0.302530766f, 0.791383147f},
-std::array<float,2>{0.980210125f, 0.36966455f},
-std::array<float,2>{0.376362622f, 0.0107728802f},
-std::array<float,2>{0.83107549f, 0.707598805f},
-std::array<float,2>{0.193187162f, 0.928720117f},
-std::array<float,2>{0.517891288f, 0.457473934f},
-std::array<float,2>{0.0833828971f, 0.34559235f},
-std::array<float,2>{0.68879205f, 0.800056458f},
-std::array<float,2>{0.280612111f, 0.595648885f},
-std::array<float,2>{0.942413568f, 0.200051114f},
-std::array<float,2>{0.328232467f, 0.416664898f},
-std::array<float,2>{0.908794463f, 0.964905322f},
-std::array<float,2>{0.0348053984f, 0.625531316f},
-std::array<float,2>{0.687054455f, 0.0647580326f},
-std::array<float,2>{0.171077117f, 0.163854927f},
-std::array<float,2>{0.572690547f, 0.540115416f},
-std::array<float,2>{0.493617654f, 0.822179079f},
-std::array<float,2>{0.811359227f, 0.278797179f},
-std::array<float,2>{0.294754207f, 0.236579448f},
-std::array<float,2>{0.986993849f, 0.570015848f},
-std::array<float,2>{0.117479116f, 0.763388097f},
-std::array<float,2>{0.739272654f, 0.314920127f},
-std::array<float,2>{0.233877733f, 0.470247358f},
-std::array<float,2>{0.539866984f, 0.87871331f},
-std::array<float,2>{0.425422937f, 0.7200948f},
-std::array<float,2>{0.871675551f, 0.0468192473f},
-std::array<float,2>{0.441749722f, 0.283795595f},
-std::array<float,2>{0.750555336f, 0.873484194f},
-std::array<float,2>{0.140574187f, 0.531110168f},
-std::array<float,2>{0.612323523f, 0.137918666f},
-std::array<float,2>{0.0148934312f, 0.1013446f},
-std::array<float,2>{0.643537104f, 0.663660169f},
-std::array<float,2>{0.373640507f, 0.97883445f},
-std::array<float,2>{0.890519381f, 0.397733182f},
-std::array<float,2>{0.43237415f, 0.188932434f},
-std::array<float,2>{0.862239718f, 0.604131639f},
-std::array<float,2>{0.218844429f, 0.807051778f},
-std::array<float,2>{0.538384855f, 0.3588956f},
-std::array<float,2>{0.116370946f, 0.463697672f},
-std::array<float,2>{0.742221177f, 0.93575114f},
-std::array<float,2>{0.286756575f, 0.71120894f},
-std::array<float,2>{0.999381304f, 0.00143661338f},
-std::array<float,2>{0.365830123f, 0.268471181f},
-std::array<float,2>{0.880170584f, 0.812935889f},
-std::array<float,2>{0.00386075256f, 0.534544945f},
-std::array<float,2>{0.650133252f, 0.165491253f},
-std::array<float,2>{0.130873471f, 0.073844932f},
-std::array<float,2>{0.621506453f, 0.638674557f},
-std::array<float,2>{0.447580427f, 0.958994448f},
-std::array<float,2>{0.761353076f, 0.406976908f},
-std::array<float,2>{0.270390511f, 0.0350615606f},
-std::array<float,2>{0.945869744f, 0.728667736f},
-std::array<float,2>{0.0879145488f, 0.886462152f},
-std::array<float,2>{0.702408493f, 0.479029953f},
-std::array<float,2>{0.201377317f, 0.325546443f},
-std::array<float,2>{0.524321854f, 0.756585062f},
-std::array<float,2>{0.389010996f, 0.572668672f},
-std::array<float,2>{0.843391478f, 0.245335296f},
-std::array<float,2>{0.491027057f, 0.404654503f},
-std::array<float,2>{0.804191351f, 0.968864262f},
-std::array<float,2>{0.157802731f, 0.664656222f},
-std::array<float,2>{0.567969739f, 0.10803809f},
-std::array<float,2>{0.039661441f, 0.126882657f},
-std::array<float,2>{0.672720909f, 0.518264592f},
-std::array<float,2>{0.342595249f, 0.864642501f},
-std::array<float,2>{0.915734589f, 0.294936627f},
-std::array<float,2>{0.460493177f, 0.115397632f},
-std::array<float,2>{0.766226292f, 0.679319382f},
-std::array<float,2>{0.152510002f, 0.996540487f},
-std::array<float,2>{0.596237302f, 0.389231801f},
-std::array<float,2>{0.0201889593f, 0.307454377f},
-std::array<float,2>{0.638212442f, 0.852175295f},
-std::array<float,2>{0.357708216f, 0.505116761f},
-std::array<float,2>{0.892809331f, 0.148803115f},
-std::array<float,2>{0.309485734f, 0.487244308f},
-std::array<float,2>{0.975629091f, 0.900330663f},
-std::array<float,2>{0.106874868f, 0.737498045f},
-std::array<float,2>{0.72118932f, 0.0572329536f},
-std::array<float,2>{0.242315173f, 0.223131686f},
-std::array<float,2>{0.55288744f, 0.582050025f},
-std::array<float,2>{0.415756494f, 0.769930482f},
-std::array<float,2>{0.845634818f, 0.339178503f},
-std::array<float,2>{0.318174899f, 0.177503824f},
-std::array<float,2>{0.924196899f, 0.552392602f},
-std::array<float,2>{0.0548414923f, 0.828567505f},
-std::array<float,2>{0.671619654f, 0.258604556f},
-std::array<float,2>{0.184054464f, 0.436065495f},
-std::array<float,2>{0.584937453f, 0.94228071f},
-std::array<float,2>{0.470054358f, 0.644885659f},
-std::array<float,2>{0.784362137f, 0.0829263255f},
-std::array<float,2>{0.39274016f, 0.364927828f},
-std::array<float,2>{0.823139191f, 0.782238424f},
-std::array<float,2>{0.215714872f, 0.618173599f},
-std::array<float,2>{0.501729369f, 0.207054198f},
-std::array<float,2>{0.0759254172f, 0.0166510902f},
-std::array<float,2>{0.706975639f, 0.689447165f},
-std::array<float,2>{0.255832851f, 0.907913983f},
-std::array<float,2>{0.955793977f, 0.44411546f},
-std::array<float,2>{0.401088774f, 0.170955554f},
-std::array<float,2>{0.813444674f, 0.537583053f},
-std::array<float,2>{0.207783282f, 0.818878055f},
-std::array<float,2>{0.515540183f, 0.272941321f},
-std::array<float,2>{0.0632679611f, 0.410302788f},
-std::array<float,2>{0.71356827f, 0.953375816f},
-std::array<float,2>{0.262164742f, 0.636146486f},
-std::array<float,2>{0.961872339f, 0.0757821724f},
-std::array<float,2>{0.321465284f, 0.352749377f},
-std::array<float,2>{0.930215657f, 0.812334716f},
-std::array<float,2>{0.048108574f, 0.605726421f},
-std::array<float,2>{0.65633148f, 0.192642733f},
-std::array<float,2>{0.176928669f, 0.00540452637f},
-std::array<float,2>{0.586382329f, 0.718735218f},
-std::array<float,2>{0.483212769f, 0.930916488f},
-std::array<float,2>{0.789606333f, 0.467946142f},
-std::array<float,2>{0.298787564f, 0.103011265f},
-std::array<float,2>{0.984327614f, 0.668734133f},
-std::array<float,2>{0.0942112431f, 0.974601984f},
-std::array<float,2>{0.729764163f, 0.399201959f},
-std::array<float,2>{0.235571519f, 0.291698068f},
-std::array<float,2>{0.556063533f, 0.862928092f},
-std::array<float,2>{0.4064219f, 0.522425294f},
-std::array<float,2>{0.856728435f, 0.130688146f},
-std::array<float,2>{0.46794337f, 0.480807781f},
-std::array<float,2>{0.777267456f, 0.887786448f},
-std::array<float,2>{0.148051247f, 0.731298983f},
-std::array<float,2>{0.6068874f, 0.036128249f},
-std::array<float,2>{0.0276171528f, 0.246671274f},
-std::array<float,2>{0.62987572f, 0.577715337f},
-std::array<float,2>{0.34663704f, 0.752980769f},
-std::array<float,2>{0.901262462f, 0.320587456f},
-std::array<float,2>{0.499680489f, 0.0586882569f},
-std::array<float,2>{0.805245936f, 0.741951108f},
-std::array<float,2>{0.16500394f, 0.906217277f},
-std::array<float,2>{0.577915013f, 0.491147131f},
-std::array<float,2>{0.0359735042f, 0.343055904f},
-std::array<float,2>{0.681601465f, 0.769328535f},
-std::array<float,2>{0.334011137f, 0.580820501f},
-std::array<float,2>{0.913648725f, 0.219214961f},
-std::array<float,2>{0.276287556f, 0.384825766f},
-std::array<float,2>{0.940499127f, 0.995480835f},
-std::array<float,2>{0.0790447071f, 0.675617874f},
-std::array<float,2>{0.694695294f, 0.109479591f},
-std::array<float,2>{0.188659295f, 0.153162569f},
-std::array<float,2>{0.523188889f, 0.500371575f},
-std::array<float,2>{0.381556422f, 0.85904783f},
-std::array<float,2>{0.832047582f, 0.308883697f},
-std::array<float,2>{0.370251983f, 0.204170138f},
-std::array<float,2>{0.886039197f, 0.622119546f},
-std::array<float,2>{0.00865983777f, 0.788429976f},
-std::array<float,2>{0.645463824f, 0.360545278f},
-std::array<float,2>{0.133071795f, 0.440312088f},
-std::array<float,2>{0.613490164f, 0.912573159f},
-std::array<float,2>{0.439537108f, 0.694706857f},
-std::array<float,2>{0.753940105f, 0.0216260441f},
-std::array<float,2>{0.429122895f, 0.26206553f},
-std::array<float,2>{0.868824065f, 0.833454728f},
-std::array<float,2>{0.229556635f, 0.55052346f},
-std::array<float,2>{0.545242488f, 0.175389305f},
-std::array<float,2>{0.124915294f, 0.0793144703f},
-std::array<float,2>{0.73753643f, 0.641065955f},
-std::array<float,2>{0.289918065f, 0.938328803f},
-std::array<float,2>{0.991654038f, 0.432112575f},
-std::array<float,2>{0.449664563f, 0.227550402f},
-std::array<float,2>{0.761858821f, 0.586806238f},
-std::array<float,2>{0.12856923f, 0.778146982f},
-std::array<float,2>{0.618861258f, 0.334239125f},
-std::array<float,2>{0.00599045353f, 0.494927734f},
-std::array<float,2>{0.655683756f, 0.893001974f},
-std::array<float,2>{0.359585822f, 0.743652642f},
-std::array<float,2>{0.87509048f, 0.0479048006f},
-std::array<float,2>{0.284820944f, 0.299372554f},
-std::array<float,2>{0.992845893f, 0.845526814f},
-std::array<float,2>{0.110973395f, 0.509187043f},
-std::array<float,2>{0.747403741f, 0.145031497f},
-std::array<float,2>{0.223683f, 0.117906116f},
-std::array<float,2>{0.533335745f, 0.684153974f},
-std::array<float,2>{0.43475163f, 0.991938055f},
-std::array<float,2>{0.865195334f, 0.376817733f},
-std::array<float,2>{0.337451488f, 0.0294639673f},
-std::array<float,2>{0.920056581f, 0.701351404f},
-std::array<float,2>{0.0441926382f, 0.916921735f},
-std::array<float,2>{0.67682606f, 0.445741266f},
-std::array<float,2>{0.161777675f, 0.374664932f},
-std::array<float,2>{0.563943088f, 0.795354426f},
-std::array<float,2>{0.485877484f, 0.614033997f},
-std::array<float,2>{0.798525333f, 0.21210815f},
-std::array<float,2>{0.384314686f, 0.428258568f},
-std::array<float,2>{0.836628318f, 0.945911765f},
-std::array<float,2>{0.197437182f, 0.650738955f},
-std::array<float,2>{0.52742219f, 0.0867260769f},
-std::array<float,2>{0.0905519202f, 0.184140429f},
-std::array<float,2>{0.696531594f, 0.555216432f},
-std::array<float,2>{0.268640667f, 0.841721117f},
-std::array<float,2>{0.950066328f, 0.250332355f},
-std::array<float,2>{0.419973165f, 0.0678870007f},
-std::array<float,2>{0.848528326f, 0.630186319f},
-std::array<float,2>{0.248112142f, 0.961609602f},
-std::array<float,2>{0.547693849f, 0.420591146f},
-std::array<float,2>{0.105102621f, 0.274698466f},
-std::array<float,2>{0.726032138f, 0.828022838f},
-std::array<float,2>{0.308436096f, 0.543742537f},
-std::array<float,2>{0.97008723f, 0.158965096f},
-std::array<float,2>{0.354161024f, 0.453166246f},
-std::array<float,2>{0.89705044f, 0.923958123f},
-std::array<float,2>{0.0176575687f, 0.705316424f},
-std::array<float,2>{0.635466576f, 0.0133959148f},
-std::array<float,2>{0.149992213f, 0.198541373f},
-std::array<float,2>{0.597971439f, 0.599446356f},
-std::array<float,2>{0.456144899f, 0.803698123f},
-std::array<float,2>{0.770933688f, 0.348414123f},
-std::array<float,2>{0.250424206f, 0.13585636f},
-std::array<float,2>{0.95792681f, 0.525802374f},
-std::array<float,2>{0.0718032345f, 0.868133426f},
-std::array<float,2>{0.707677543f, 0.288576692f},
-std::array<float,2>{0.211993724f, 0.393145204f},
-std::array<float,2>{0.506511629f, 0.983324349f},
-std::array<float,2>{0.397875607f, 0.656665683f},
-std::array<float,2>{0.825400949f, 0.09626019f},
-std::array<float,2>{0.475494415f, 0.316599548f},
-std::array<float,2>{0.785633862f, 0.76167661f},
-std::array<float,2>{0.180376649f, 0.563607693f},
-std::array<float,2>{0.578468442f, 0.239320651f},
-std::array<float,2>{0.0597202182f, 0.0415897109f},
-std::array<float,2>{0.664779246f, 0.725434005f},
-std::array<float,2>{0.313047856f, 0.879889131f},
-std::array<float,2>{0.926617742f, 0.473940581f},
-std::array<float,2>{0.464334428f, 0.183125108f},
-std::array<float,2>{0.779881418f, 0.558616817f},
-std::array<float,2>{0.143031582f, 0.837600529f},
-std::array<float,2>{0.603875399f, 0.256632805f},
-std::array<float,2>{0.0235943682f, 0.424081713f},
-std::array<float,2>{0.627140582f, 0.951792061f},
-std::array<float,2>{0.350117058f, 0.655983686f},
-std::array<float,2>{0.903006434f, 0.0928886309f},
-std::array<float,2>{0.3033095f, 0.368125945f},
-std::array<float,2>{0.977061927f, 0.789151192f},
-std::array<float,2>{0.100169405f, 0.61179322f},
-std::array<float,2>{0.732840121f, 0.218712151f},
-std::array<float,2>{0.238510013f, 0.0234485324f},
-std::array<float,2>{0.561272025f, 0.697977185f},
-std::array<float,2>{0.41029799f, 0.919301271f},
-std::array<float,2>{0.851651549f, 0.451588959f},
-std::array<float,2>{0.324307978f, 0.122787647f},
-std::array<float,2>{0.935454607f, 0.682231486f},
-std::array<float,2>{0.0513589717f, 0.986501932f},
-std::array<float,2>{0.662680924f, 0.381432503f},
-std::array<float,2>{0.172346622f, 0.300870806f},
-std::array<float,2>{0.591430604f, 0.85040307f},
-std::array<float,2>{0.479845852f, 0.513080716f},
-std::array<float,2>{0.794294894f, 0.143328696f},
-std::array<float,2>{0.405878723f, 0.497212589f},
-std::array<float,2>{0.818416774f, 0.894724786f},
-std::array<float,2>{0.206311226f, 0.747324526f},
-std::array<float,2>{0.510198414f, 0.0517645068f},
-std::array<float,2>{0.0692746937f, 0.232522473f},
-std::array<float,2>{0.717611849f, 0.590324521f},
-std::array<float,2>{0.257864743f, 0.774775267f},
-std::array<float,2>{0.967815757f, 0.329642057f},
-std::array<float,2>{0.422770202f, 0.0430209227f},
-std::array<float,2>{0.87326014f, 0.72167176f},
-std::array<float,2>{0.231090352f, 0.875673354f},
-std::array<float,2>{0.542241275f, 0.471182495f},
-std::array<float,2>{0.120789289f, 0.313672334f},
-std::array<float,2>{0.741799414f, 0.76417917f},
-std::array<float,2>{0.296302497f, 0.567777157f},
-std::array<float,2>{0.986042261f, 0.235017478f},
-std::array<float,2>{0.371833026f, 0.394799024f},
-std::array<float,2>{0.887532055f, 0.978208184f},
-std::array<float,2>{0.0128997359f, 0.660994053f},
-std::array<float,2>{0.641130328f, 0.0994481668f},
-std::array<float,2>{0.137085527f, 0.140574157f},
-std::array<float,2>{0.610519767f, 0.528143227f},
-std::array<float,2>{0.444301993f, 0.87201792f},
-std::array<float,2>{0.752862036f, 0.28186366f},
-std::array<float,2>{0.278941184f, 0.202383369f},
-std::array<float,2>{0.943770945f, 0.596805155f},
-std::array<float,2>{0.0859205648f, 0.798110306f},
-std::array<float,2>{0.689488828f, 0.347530961f},
-std::array<float,2>{0.193506405f, 0.45916003f},
-std::array<float,2>{0.515639722f, 0.926635325f},
-std::array<float,2>{0.377993166f, 0.709265947f},
-std::array<float,2>{0.829660296f, 0.00817144196f},
-std::array<float,2>{0.495227158f, 0.280172169f},
-std::array<float,2>{0.809175789f, 0.823868394f},
-std::array<float,2>{0.168814853f, 0.541330278f},
-std::array<float,2>{0.57174021f, 0.160892367f},
-std::array<float,2>{0.032367412f, 0.0638393387f},
-std::array<float,2>{0.683638334f, 0.627537072f},
-std::array<float,2>{0.330178976f, 0.967598796f},
-std::array<float,2>{0.907375336f, 0.415303528f},
-std::array<float,2>{0.388004601f, 0.243551075f},
-std::array<float,2>{0.840459406f, 0.571845591f},
-std::array<float,2>{0.199535444f, 0.754698396f},
-std::array<float,2>{0.526797116f, 0.326376081f},
-std::array<float,2>{0.0867830813f, 0.47739476f},
-std::array<float,2>{0.699536204f, 0.883342445f},
-std::array<float,2>{0.273331195f, 0.727895737f},
-std::array<float,2>{0.947395325f, 0.0330097713f},
-std::array<float,2>{0.339870483f, 0.294834107f},
-std::array<float,2>{0.917227805f, 0.866972685f},
-std::array<float,2>{0.0428363904f, 0.515893042f},
-std::array<float,2>{0.674003184f, 0.128285632f},
-std::array<float,2>{0.158419192f, 0.106988356f},
-std::array<float,2>{0.570228159f, 0.666255355f},
-std::array<float,2>{0.489737928f, 0.970715404f},
-std::array<float,2>{0.802428007f, 0.403389841f},
-std::array<float,2>{0.288379043f, 0.00299851596f},
-std::array<float,2>{0.997588098f, 0.713438869f},
-std::array<float,2>{0.113761127f, 0.933964849f},
-std::array<float,2>{0.745476484f, 0.461191565f},
-std::array<float,2>{0.220733106f, 0.356455058f},
-std::array<float,2>{0.535156548f, 0.806042075f},
-std::array<float,2>{0.431422442f, 0.601917863f},
-std::array<float,2>{0.861220479f, 0.190629378f},
-std::array<float,2>{0.44681555f, 0.408887267f},
-std::array<float,2>{0.759181976f, 0.958278298f},
-std::array<float,2>{0.130548209f, 0.638491452f},
-std::array<float,2>{0.624945104f, 0.0703734532f},
-std::array<float,2>{0.00101113576f, 0.166669354f},
-std::array<float,2>{0.650811911f, 0.533058643f},
-std::array<float,2>{0.363606453f, 0.815877259f},
-std::array<float,2>{0.882222891f, 0.26701653f},
-std::array<float,2>{0.47091186f, 0.0852466673f},
-std::array<float,2>{0.782873333f, 0.64680016f},
-std::array<float,2>{0.186862141f, 0.944567084f},
-std::array<float,2>{0.583107352f, 0.434171855f},
-std::array<float,2>{0.0576678216f, 0.261444479f},
-std::array<float,2>{0.669626355f, 0.831030786f},
-std::array<float,2>{0.320109904f, 0.552865386f},
-std::array<float,2>{0.922806323f, 0.178699598f},
-std::array<float,2>{0.256477445f, 0.44299382f},
-std::array<float,2>{0.954083979f, 0.908276737f},
-std::array<float,2>{0.0773878768f, 0.68956399f},
-std::array<float,2>{0.703568578f, 0.0181343965f},
-std::array<float,2>{0.216973886f, 0.209600136f},
-std::array<float,2>{0.503873825f, 0.62035197f},
-std::array<float,2>{0.391285956f, 0.783365428f},
-std::array<float,2>{0.822057843f, 0.366568208f},
-std::array<float,2>{0.356360644f, 0.150692865f},
-std::array<float,2>{0.891952097f, 0.507365882f},
-std::array<float,2>{0.0222703535f, 0.855020344f},
-std::array<float,2>{0.639367759f, 0.304766357f},
-std::array<float,2>{0.15495947f, 0.387807757f},
-std::array<float,2>{0.593829274f, 0.999614358f},
-std::array<float,2>{0.457966506f, 0.677406013f},
-std::array<float,2>{0.76846993f, 0.113900304f},
-std::array<float,2>{0.417939603f, 0.337729096f},
-std::array<float,2>{0.845775247f, 0.772451878f},
-std::array<float,2>{0.244984075f, 0.584246695f},
-std::array<float,2>{0.551775277f, 0.224675849f},
-std::array<float,2>{0.109144591f, 0.054954458f},
-std::array<float,2>{0.720298707f, 0.73463738f},
-std::array<float,2>{0.312484741f, 0.902239323f},
-std::array<float,2>{0.973807573f, 0.48584038f},
-std::array<float,2>{0.408899039f, 0.13268508f},
-std::array<float,2>{0.857589304f, 0.520195484f},
-std::array<float,2>{0.238235295f, 0.860815108f},
-std::array<float,2>{0.557919502f, 0.290506184f},
-std::array<float,2>{0.0958462954f, 0.401321471f},
-std::array<float,2>{0.728148401f, 0.97481662f},
-std::array<float,2>{0.300678253f, 0.670409143f},
-std::array<float,2>{0.981219769f, 0.104288027f},
-std::array<float,2>{0.345145285f, 0.32294035f},
-std::array<float,2>{0.898505569f, 0.750575006f},
-std::array<float,2>{0.0294657107f, 0.575411141f},
-std::array<float,2>{0.631474972f, 0.248357907f},
-std::array<float,2>{0.144576833f, 0.0390533544f},
-std::array<float,2>{0.60898912f, 0.733916759f},
-std::array<float,2>{0.465262115f, 0.888774693f},
-std::array<float,2>{0.774482846f, 0.484148711f},
-std::array<float,2>{0.264496893f, 0.077763401f},
-std::array<float,2>{0.963838756f, 0.633115351f},
-std::array<float,2>{0.0658668727f, 0.95561558f},
-std::array<float,2>{0.711174726f, 0.413116097f},
-std::array<float,2>{0.209576994f, 0.270728499f},
-std::array<float,2>{0.512641788f, 0.817506731f},
-std::array<float,2>{0.398649037f, 0.535419762f},
-std::array<float,2>{0.816292882f, 0.168847606f},
-std::array<float,2>{0.481146067f, 0.465301871f},
-std::array<float,2>{0.79263109f, 0.933517873f},
-std::array<float,2>{0.178122357f, 0.715990841f},
-std::array<float,2>{0.58817476f, 0.00731174741f},
-std::array<float,2>{0.0495966114f, 0.194628641f},
-std::array<float,2>{0.659735739f, 0.60901773f},
-std::array<float,2>{0.322421908f, 0.809797823f},
-std::array<float,2>{0.933422029f, 0.355381578f},
-std::array<float,2>{0.439203739f, 0.0211586244f},
-std::array<float,2>{0.757752478f, 0.692167282f},
-std::array<float,2>{0.136495993f, 0.91060251f},
-std::array<float,2>{0.615563631f, 0.438664675f},
-std::array<float,2>{0.0112911379f, 0.361360967f},
-std::array<float,2>{0.648155868f, 0.785893083f},
-std::array<float,2>{0.368105531f, 0.624075294f},
-std::array<float,2>{0.883085549f, 0.206451789f},
-std::array<float,2>{0.291226059f, 0.429995745f},
-std::array<float,2>{0.988434315f, 0.939898133f},
-std::array<float,2>{0.121226303f, 0.644392431f},
-std::array<float,2>{0.736294806f, 0.0814509913f},
-std::array<float,2>{0.227829129f, 0.17374827f},
-std::array<float,2>{0.543463647f, 0.547369421f},
-std::array<float,2>{0.427405208f, 0.835332274f},
-std::array<float,2>{0.870153606f, 0.263739884f},
-std::array<float,2>{0.33216238f, 0.221274301f},
-std::array<float,2>{0.910863519f, 0.578518152f},
-std::array<float,2>{0.0385794118f, 0.766578794f},
-std::array<float,2>{0.682721674f, 0.340224832f},
-std::array<float,2>{0.166600674f, 0.489881843f},
-std::array<float,2>{0.574904919f, 0.902685225f},
-std::array<float,2>{0.496418446f, 0.739721119f},
-std::array<float,2>{0.807928324f, 0.0615634397f},
-std::array<float,2>{0.379470915f, 0.312127054f},
-std::array<float,2>{0.834334791f, 0.856818914f},
-std::array<float,2>{0.1900682f, 0.503623903f},
-std::array<float,2>{0.52007246f, 0.154511616f},
-std::array<float,2>{0.0819428563f, 0.113185927f},
-std::array<float,2>{0.691510558f, 0.673331261f},
-std::array<float,2>{0.275188625f, 0.992353022f},
-std::array<float,2>{0.938514888f, 0.384721041f},
-std::array<float,2>{0.48695305f, 0.214652121f},
-std::array<float,2>{0.800640821f, 0.615757227f},
-std::array<float,2>{0.162212655f, 0.793077886f},
-std::array<float,2>{0.565013945f, 0.371277303f},
-std::array<float,2>{0.04572675f, 0.448874205f},
-std::array<float,2>{0.678972602f, 0.914428949f},
-std::array<float,2>{0.339839071f, 0.700342834f},
-std::array<float,2>{0.918657362f, 0.0278602727f},
-std::array<float,2>{0.265901059f, 0.252513856f},
-std::array<float,2>{0.951946199f, 0.843070209f},
-std::array<float,2>{0.0919019505f, 0.557409644f},
-std::array<float,2>{0.69789201f, 0.186535344f},
-std::array<float,2>{0.196820632f, 0.0883622095f},
-std::array<float,2>{0.529458225f, 0.649905682f},
-std::array<float,2>{0.386685491f, 0.947455168f},
-std::array<float,2>{0.837980032f, 0.425820917f},
-std::array<float,2>{0.363042116f, 0.0489473417f},
-std::array<float,2>{0.878427327f, 0.744549811f},
-std::array<float,2>{0.00512095168f, 0.892257571f},
-std::array<float,2>{0.653337538f, 0.493385166f},
-std::array<float,2>{0.125798792f, 0.33302027f},
-std::array<float,2>{0.620450616f, 0.780426919f},
-std::array<float,2>{0.452851146f, 0.588131249f},
-std::array<float,2>{0.7638219f, 0.229360566f},
-std::array<float,2>{0.437124342f, 0.378163934f},
-std::array<float,2>{0.865721405f, 0.988705993f},
-std::array<float,2>{0.226430431f, 0.686476707f},
-std::array<float,2>{0.533176959f, 0.11943619f},
-std::array<float,2>{0.111814916f, 0.147155344f},
-std::array<float,2>{0.749833465f, 0.510434031f},
-std::array<float,2>{0.281918287f, 0.847251773f},
-std::array<float,2>{0.995729148f, 0.298728824f},
-std::array<float,2>{0.396173477f, 0.0948078483f},
-std::array<float,2>{0.827374756f, 0.658701718f},
-std::array<float,2>{0.21462898f, 0.981363297f},
-std::array<float,2>{0.504284739f, 0.392279208f},
-std::array<float,2>{0.0729859993f, 0.286717325f},
-std::array<float,2>{0.709623456f, 0.870414674f},
-std::array<float,2>{0.252997994f, 0.524571836f},
-std::array<float,2>{0.959589422f, 0.133986473f},
-std::array<float,2>{0.314485461f, 0.475069135f},
-std::array<float,2>{0.928114712f, 0.881978273f},
-std::array<float,2>{0.061007347f, 0.723131061f},
-std::array<float,2>{0.66626519f, 0.0394059382f},
-std::array<float,2>{0.183489621f, 0.241963997f},
-std::array<float,2>{0.581110954f, 0.56594032f},
-std::array<float,2>{0.473651439f, 0.759687066f},
-std::array<float,2>{0.788919806f, 0.320287049f},
-std::array<float,2>{0.305882841f, 0.156310871f},
-std::array<float,2>{0.972417176f, 0.545261443f},
-std::array<float,2>{0.102985114f, 0.825615525f},
-std::array<float,2>{0.724523425f, 0.277325094f},
-std::array<float,2>{0.246982351f, 0.419868857f},
-std::array<float,2>{0.550414026f, 0.96480006f},
-std::array<float,2>{0.418066263f, 0.632772624f},
-std::array<float,2>{0.850797713f, 0.068765521f},
-std::array<float,2>{0.454720497f, 0.351070344f},
-std::array<float,2>{0.773227751f, 0.802439272f},
-std::array<float,2>{0.152198568f, 0.601495326f},
-std::array<float,2>{0.599648833f, 0.196487159f},
-std::array<float,2>{0.0160311069f, 0.0149078695f},
-std::array<float,2>{0.634111226f, 0.703236401f},
-std::array<float,2>{0.353058428f, 0.923127234f},
-std::array<float,2>{0.895599663f, 0.455808461f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.117336705f, 0.280301034f},
-std::array<float,2>{0.588025331f, 0.94455564f},
-std::array<float,2>{0.934590101f, 0.15533331f},
-std::array<float,2>{0.443226606f, 0.729359031f},
-std::array<float,2>{0.25278917f, 0.0411832891f},
-std::array<float,2>{0.759073853f, 0.510870218f},
-std::array<float,2>{0.636985362f, 0.38027972f},
-std::array<float,2>{0.158608884f, 0.832432628f},
-std::array<float,2>{0.200499803f, 0.218463585f},
-std::array<float,2>{0.703107417f, 0.655849934f},
-std::array<float,2>{0.863722801f, 0.325841308f},
-std::array<float,2>{0.338173062f, 0.929162621f},
-std::array<float,2>{0.435582817f, 0.47516191f},
-std::array<float,2>{0.943769515f, 0.773729444f},
-std::array<float,2>{0.503886342f, 0.113998838f},
-std::array<float,2>{0.0357162282f, 0.590089917f},
-std::array<float,2>{0.139061108f, 0.432064444f},
-std::array<float,2>{0.671892345f, 0.856429756f},
-std::array<float,2>{0.81191504f, 0.00183124258f},
-std::array<float,2>{0.296737969f, 0.5428285f},
-std::array<float,2>{0.474704504f, 0.179810375f},
-std::array<float,2>{0.898109078f, 0.700341284f},
-std::array<float,2>{0.594348192f, 0.281386852f},
-std::array<float,2>{0.0714642853f, 0.988330543f},
-std::array<float,2>{0.0296185128f, 0.0826444551f},
-std::array<float,2>{0.544467807f, 0.610139608f},
-std::array<float,2>{0.979792058f, 0.45481962f},
-std::array<float,2>{0.375456214f, 0.810759187f},
-std::array<float,2>{0.372898638f, 0.348950952f},
-std::array<float,2>{0.819651425f, 0.899588227f},
-std::array<float,2>{0.738448381f, 0.226630524f},
-std::array<float,2>{0.227958113f, 0.668164074f},
-std::array<float,2>{0.0534385554f, 0.440607309f},
-std::array<float,2>{0.526907325f, 0.785685241f},
-std::array<float,2>{0.957042933f, 0.0703327954f},
-std::array<float,2>{0.412436068f, 0.609082699f},
-std::array<float,2>{0.323161542f, 0.235765085f},
-std::array<float,2>{0.850233316f, 0.680427074f},
-std::array<float,2>{0.717553556f, 0.359810919f},
-std::array<float,2>{0.208426774f, 0.885185599f},
-std::array<float,2>{0.177024156f, 0.0218445659f},
-std::array<float,2>{0.644040585f, 0.560747325f},
-std::array<float,2>{0.780024171f, 0.408708513f},
-std::array<float,2>{0.273841023f, 0.865330458f},
-std::array<float,2>{0.462170511f, 0.304456681f},
-std::array<float,2>{0.908756375f, 0.977014363f},
-std::array<float,2>{0.571129799f, 0.171416327f},
-std::array<float,2>{0.104629561f, 0.710721672f},
-std::array<float,2>{0.245753542f, 0.332452834f},
-std::array<float,2>{0.726192772f, 0.918569565f},
-std::array<float,2>{0.835059643f, 0.202053532f},
-std::array<float,2>{0.359284014f, 0.634322286f},
-std::array<float,2>{0.400556266f, 0.101078987f},
-std::array<float,2>{0.991500914f, 0.562645912f},
-std::array<float,2>{0.547231615f, 0.487095416f},
-std::array<float,2>{0.0143943662f, 0.758964777f},
-std::array<float,2>{0.0861027613f, 0.138289928f},
-std::array<float,2>{0.621736288f, 0.739406407f},
-std::array<float,2>{0.890054464f, 0.253251374f},
-std::array<float,2>{0.497281581f, 0.955337882f},
-std::array<float,2>{0.299070626f, 0.399154633f},
-std::array<float,2>{0.786025286f, 0.827471077f},
-std::array<float,2>{0.657010257f, 0.053519357f},
-std::array<float,2>{0.14259252f, 0.529420555f},
-std::array<float,2>{0.00605920656f, 0.37089771f},
-std::array<float,2>{0.562482715f, 0.880479872f},
-std::array<float,2>{0.998951495f, 0.244974419f},
-std::array<float,2>{0.39637205f, 0.674745798f},
-std::array<float,2>{0.349981874f, 0.0628739074f},
-std::array<float,2>{0.838244677f, 0.60041362f},
-std::array<float,2>{0.728699565f, 0.451744378f},
-std::array<float,2>{0.235730112f, 0.790871859f},
-std::array<float,2>{0.149931148f, 0.157044843f},
-std::array<float,2>{0.66804105f, 0.715536416f},
-std::array<float,2>{0.7922858f, 0.307192653f},
-std::array<float,2>{0.309710264f, 0.972428024f},
-std::array<float,2>{0.486948699f, 0.420712739f},
-std::array<float,2>{0.876594722f, 0.874513149f},
-std::array<float,2>{0.609703898f, 0.0311451871f},
-std::array<float,2>{0.0848584324f, 0.548723578f},
-std::array<float,2>{0.211283147f, 0.498037428f},
-std::array<float,2>{0.707894206f, 0.750635266f},
-std::array<float,2>{0.854415476f, 0.104506426f},
-std::array<float,2>{0.314477831f, 0.575149953f},
-std::array<float,2>{0.416355789f, 0.192979246f},
-std::array<float,2>{0.967927992f, 0.626944065f},
-std::array<float,2>{0.51889199f, 0.336645514f},
-std::array<float,2>{0.0602292158f, 0.909809172f},
-std::array<float,2>{0.0973754451f, 0.0558653362f},
-std::array<float,2>{0.563286722f, 0.519815147f},
-std::array<float,2>{0.921846688f, 0.395574152f},
-std::array<float,2>{0.455450058f, 0.814545929f},
-std::array<float,2>{0.273327708f, 0.262746185f},
-std::array<float,2>{0.769877732f, 0.967888415f},
-std::array<float,2>{0.656194508f, 0.131062627f},
-std::array<float,2>{0.187334314f, 0.744873405f},
-std::array<float,2>{0.0658800453f, 0.389275312f},
-std::array<float,2>{0.606223226f, 0.84211272f},
-std::array<float,2>{0.900239527f, 0.0389274321f},
-std::array<float,2>{0.48297748f, 0.501986086f},
-std::array<float,2>{0.283480585f, 0.143017218f},
-std::array<float,2>{0.797513723f, 0.725415528f},
-std::array<float,2>{0.683375835f, 0.270912766f},
-std::array<float,2>{0.132503852f, 0.945665896f},
-std::array<float,2>{0.225633696f, 0.124447815f},
-std::array<float,2>{0.749407411f, 0.583244503f},
-std::array<float,2>{0.823063612f, 0.477842659f},
-std::array<float,2>{0.360450536f, 0.770573974f},
-std::array<float,2>{0.388603956f, 0.320220023f},
-std::array<float,2>{0.971282184f, 0.932996154f},
-std::array<float,2>{0.536855638f, 0.20671998f},
-std::array<float,2>{0.0189475361f, 0.645293415f},
-std::array<float,2>{0.166248843f, 0.290722489f},
-std::array<float,2>{0.630403996f, 0.994914293f},
-std::array<float,2>{0.750557125f, 0.17492488f},
-std::array<float,2>{0.261981577f, 0.693829894f},
-std::array<float,2>{0.4488042f, 0.0145166889f},
-std::array<float,2>{0.922228754f, 0.534732163f},
-std::array<float,2>{0.580986083f, 0.423978567f},
-std::array<float,2>{0.116818622f, 0.84531039f},
-std::array<float,2>{0.0441670269f, 0.221146315f},
-std::array<float,2>{0.513504803f, 0.65965426f},
-std::array<float,2>{0.947499156f, 0.358697951f},
-std::array<float,2>{0.425305694f, 0.895932674f},
-std::array<float,2>{0.33103469f, 0.467107087f},
-std::array<float,2>{0.87226516f, 0.800236404f},
-std::array<float,2>{0.693932772f, 0.0934282318f},
-std::array<float,2>{0.189162567f, 0.623243332f},
-std::array<float,2>{0.0792555287f, 0.323610812f},
-std::array<float,2>{0.616937518f, 0.924251139f},
-std::array<float,2>{0.880654931f, 0.214217842f},
-std::array<float,2>{0.489961505f, 0.651598275f},
-std::array<float,2>{0.30527398f, 0.111350104f},
-std::array<float,2>{0.795187771f, 0.586220026f},
-std::array<float,2>{0.666203141f, 0.469537497f},
-std::array<float,2>{0.156074971f, 0.780075848f},
-std::array<float,2>{0.240227029f, 0.149250641f},
-std::array<float,2>{0.732066154f, 0.732155323f},
-std::array<float,2>{0.841741621f, 0.273916662f},
-std::array<float,2>{0.344146818f, 0.941043019f},
-std::array<float,2>{0.394373268f, 0.378463715f},
-std::array<float,2>{0.992520452f, 0.829489112f},
-std::array<float,2>{0.557335854f, 0.0431810766f},
-std::array<float,2>{0.00177434646f, 0.515370071f},
-std::array<float,2>{0.182903379f, 0.458369166f},
-std::array<float,2>{0.649118006f, 0.80603838f},
-std::array<float,2>{0.768200338f, 0.0786308348f},
-std::array<float,2>{0.267472476f, 0.61604327f},
-std::array<float,2>{0.460154176f, 0.232100591f},
-std::array<float,2>{0.914734304f, 0.664402664f},
-std::array<float,2>{0.57005018f, 0.346140027f},
-std::array<float,2>{0.0979744419f, 0.905214071f},
-std::array<float,2>{0.0558486059f, 0.0045061959f},
-std::array<float,2>{0.520490527f, 0.545048475f},
-std::array<float,2>{0.963332772f, 0.435134947f},
-std::array<float,2>{0.420688689f, 0.854497552f},
-std::array<float,2>{0.319229603f, 0.28866154f},
-std::array<float,2>{0.857370794f, 0.988227904f},
-std::array<float,2>{0.704676151f, 0.184630439f},
-std::array<float,2>{0.214919746f, 0.69916749f},
-std::array<float,2>{0.019744629f, 0.410829872f},
-std::array<float,2>{0.534418285f, 0.859688759f},
-std::array<float,2>{0.974663913f, 0.0179785639f},
-std::array<float,2>{0.382889867f, 0.556063771f},
-std::array<float,2>{0.367151141f, 0.164972946f},
-std::array<float,2>{0.827271521f, 0.705130398f},
-std::array<float,2>{0.74514848f, 0.297990888f},
-std::array<float,2>{0.220603928f, 0.982729316f},
-std::array<float,2>{0.127773881f, 0.0759863481f},
-std::array<float,2>{0.686144948f, 0.605039954f},
-std::array<float,2>{0.801186085f, 0.442915976f},
-std::array<float,2>{0.286791831f, 0.78142035f},
-std::array<float,2>{0.479549021f, 0.36517325f},
-std::array<float,2>{0.904857337f, 0.889076054f},
-std::array<float,2>{0.605003774f, 0.239793509f},
-std::array<float,2>{0.0690777525f, 0.684712827f},
-std::array<float,2>{0.191778466f, 0.256296545f},
-std::array<float,2>{0.690265477f, 0.960627735f},
-std::array<float,2>{0.868793666f, 0.136479065f},
-std::array<float,2>{0.335423708f, 0.736879587f},
-std::array<float,2>{0.42623508f, 0.0504572541f},
-std::array<float,2>{0.950051665f, 0.526766241f},
-std::array<float,2>{0.511105895f, 0.40247637f},
-std::array<float,2>{0.0406870991f, 0.821375668f},
-std::array<float,2>{0.111125752f, 0.196825922f},
-std::array<float,2>{0.585460782f, 0.638261974f},
-std::array<float,2>{0.928550303f, 0.330281496f},
-std::array<float,2>{0.449390978f, 0.917572916f},
-std::array<float,2>{0.261085868f, 0.490215212f},
-std::array<float,2>{0.75395292f, 0.765065312f},
-std::array<float,2>{0.627475381f, 0.0946287364f},
-std::array<float,2>{0.168901742f, 0.567929506f},
-std::array<float,2>{0.0329714529f, 0.310870022f},
-std::array<float,2>{0.504103184f, 0.973368526f},
-std::array<float,2>{0.939091146f, 0.163886636f},
-std::array<float,2>{0.42971769f, 0.713524163f},
-std::array<float,2>{0.34079805f, 0.0251513869f},
-std::array<float,2>{0.861217082f, 0.55200541f},
-std::array<float,2>{0.69740802f, 0.414321512f},
-std::array<float,2>{0.197295442f, 0.867369294f},
-std::array<float,2>{0.160437137f, 0.24973011f},
-std::array<float,2>{0.636248052f, 0.678240895f},
-std::array<float,2>{0.763636768f, 0.374348402f},
-std::array<float,2>{0.256592423f, 0.878639579f},
-std::array<float,2>{0.440427691f, 0.445508659f},
-std::array<float,2>{0.931584835f, 0.795920968f},
-std::array<float,2>{0.591124833f, 0.0688980445f},
-std::array<float,2>{0.12127164f, 0.595740616f},
-std::array<float,2>{0.230775282f, 0.394286305f},
-std::array<float,2>{0.73678869f, 0.819647551f},
-std::array<float,2>{0.813815296f, 0.0618567728f},
-std::array<float,2>{0.368300349f, 0.515702128f},
-std::array<float,2>{0.38150385f, 0.128550142f},
-std::array<float,2>{0.983429372f, 0.746644199f},
-std::array<float,2>{0.539644122f, 0.258323967f},
-std::array<float,2>{0.0269213971f, 0.961583912f},
-std::array<float,2>{0.0745731369f, 0.107650295f},
-std::array<float,2>{0.598936737f, 0.574049175f},
-std::array<float,2>{0.891826749f, 0.494197875f},
-std::array<float,2>{0.468990386f, 0.754763722f},
-std::array<float,2>{0.289916635f, 0.341146767f},
-std::array<float,2>{0.806886196f, 0.912400126f},
-std::array<float,2>{0.677887857f, 0.190215245f},
-std::array<float,2>{0.133578703f, 0.629642725f},
-std::array<float,2>{0.107940152f, 0.481551319f},
-std::array<float,2>{0.574240625f, 0.765832186f},
-std::array<float,2>{0.913525522f, 0.119402252f},
-std::array<float,2>{0.46692431f, 0.580766737f},
-std::array<float,2>{0.278699726f, 0.208388567f},
-std::array<float,2>{0.774484217f, 0.643613517f},
-std::array<float,2>{0.64710784f, 0.312592924f},
-std::array<float,2>{0.173150033f, 0.935016215f},
-std::array<float,2>{0.205849499f, 0.0315200724f},
-std::array<float,2>{0.712574601f, 0.505894542f},
-std::array<float,2>{0.844637156f, 0.385309368f},
-std::array<float,2>{0.325178862f, 0.836463213f},
-std::array<float,2>{0.407861859f, 0.266397387f},
-std::array<float,2>{0.955769718f, 0.951527655f},
-std::array<float,2>{0.531063497f, 0.147491753f},
-std::array<float,2>{0.0477547795f, 0.720399082f},
-std::array<float,2>{0.148402289f, 0.354741096f},
-std::array<float,2>{0.663191259f, 0.892339885f},
-std::array<float,2>{0.783492625f, 0.223833546f},
-std::array<float,2>{0.302493036f, 0.663738608f},
-std::array<float,2>{0.492880493f, 0.0878024325f},
-std::array<float,2>{0.884328663f, 0.617419004f},
-std::array<float,2>{0.619313359f, 0.462259531f},
-std::array<float,2>{0.0900735483f, 0.801894069f},
-std::array<float,2>{0.00930874888f, 0.177399576f},
-std::array<float,2>{0.551647663f, 0.690961361f},
-std::array<float,2>{0.987638474f, 0.294230312f},
-std::array<float,2>{0.405474484f, 0.999327838f},
-std::array<float,2>{0.352144212f, 0.428720385f},
-std::array<float,2>{0.829054475f, 0.850856006f},
-std::array<float,2>{0.721044838f, 0.0103411339f},
-std::array<float,2>{0.248121098f, 0.535654426f},
-std::array<float,2>{0.0731592551f, 0.284152299f},
-std::array<float,2>{0.596138775f, 0.991776049f},
-std::array<float,2>{0.895781875f, 0.182338208f},
-std::array<float,2>{0.474296391f, 0.701712608f},
-std::array<float,2>{0.293189555f, 0.00328485109f},
-std::array<float,2>{0.809668362f, 0.540116966f},
-std::array<float,2>{0.674317122f, 0.431614906f},
-std::array<float,2>{0.138472036f, 0.857714355f},
-std::array<float,2>{0.229351506f, 0.230405346f},
-std::array<float,2>{0.741060674f, 0.671686351f},
-std::array<float,2>{0.818323076f, 0.351357609f},
-std::array<float,2>{0.373413354f, 0.900545001f},
-std::array<float,2>{0.377477407f, 0.456760705f},
-std::array<float,2>{0.977619946f, 0.809222043f},
-std::array<float,2>{0.545989394f, 0.0844879746f},
-std::array<float,2>{0.0291620847f, 0.61165154f},
-std::array<float,2>{0.157702774f, 0.3809385f},
-std::array<float,2>{0.639201701f, 0.834979773f},
-std::array<float,2>{0.760457277f, 0.0396108143f},
-std::array<float,2>{0.251519591f, 0.508116126f},
-std::array<float,2>{0.443506628f, 0.15367654f},
-std::array<float,2>{0.937186241f, 0.726650536f},
-std::array<float,2>{0.587247133f, 0.27927348f},
-std::array<float,2>{0.12007954f, 0.942854404f},
-std::array<float,2>{0.0372244641f, 0.116755277f},
-std::array<float,2>{0.501234531f, 0.59230268f},
-std::array<float,2>{0.942851305f, 0.474509895f},
-std::array<float,2>{0.434818506f, 0.776885152f},
-std::array<float,2>{0.336890489f, 0.327159494f},
-std::array<float,2>{0.866261482f, 0.926292121f},
-std::array<float,2>{0.70034349f, 0.216486767f},
-std::array<float,2>{0.201219141f, 0.653267741f},
-std::array<float,2>{0.0118323173f, 0.48488453f},
-std::array<float,2>{0.550167084f, 0.761053264f},
-std::array<float,2>{0.988694489f, 0.0982385948f},
-std::array<float,2>{0.39868769f, 0.56585598f},
-std::array<float,2>{0.357215971f, 0.199474618f},
-std::array<float,2>{0.833548784f, 0.63495332f},
-std::array<float,2>{0.72402215f, 0.334602296f},
-std::array<float,2>{0.243185073f, 0.921432972f},
-std::array<float,2>{0.141967222f, 0.0512463823f},
-std::array<float,2>{0.658275902f, 0.527624249f},
-std::array<float,2>{0.78858f, 0.402057201f},
-std::array<float,2>{0.297844201f, 0.82613337f},
-std::array<float,2>{0.499519885f, 0.250071973f},
-std::array<float,2>{0.888659835f, 0.954831779f},
-std::array<float,2>{0.623501599f, 0.139021039f},
-std::array<float,2>{0.0881824493f, 0.741489768f},
-std::array<float,2>{0.20929575f, 0.362786949f},
-std::array<float,2>{0.715650916f, 0.88282901f},
-std::array<float,2>{0.847688913f, 0.237925127f},
-std::array<float,2>{0.321267545f, 0.68353188f},
-std::array<float,2>{0.410545945f, 0.0728306919f},
-std::array<float,2>{0.959552944f, 0.606916785f},
-std::array<float,2>{0.523939967f, 0.437795848f},
-std::array<float,2>{0.0513291582f, 0.788751006f},
-std::array<float,2>{0.103455521f, 0.169426709f},
-std::array<float,2>{0.57280302f, 0.708304942f},
-std::array<float,2>{0.907196522f, 0.30239749f},
-std::array<float,2>{0.463825732f, 0.979552567f},
-std::array<float,2>{0.275696754f, 0.407378614f},
-std::array<float,2>{0.778259695f, 0.863633513f},
-std::array<float,2>{0.64169538f, 0.0210553873f},
-std::array<float,2>{0.178399846f, 0.560228229f},
-std::array<float,2>{0.0612704195f, 0.339385718f},
-std::array<float,2>{0.515930116f, 0.907013237f},
-std::array<float,2>{0.965758383f, 0.194543794f},
-std::array<float,2>{0.416001409f, 0.628503263f},
-std::array<float,2>{0.314401537f, 0.102351904f},
-std::array<float,2>{0.852253854f, 0.577033877f},
-std::array<float,2>{0.709294319f, 0.498362899f},
-std::array<float,2>{0.214532822f, 0.752541244f},
-std::array<float,2>{0.183793724f, 0.130830169f},
-std::array<float,2>{0.653059006f, 0.742423952f},
-std::array<float,2>{0.772756219f, 0.264814138f},
-std::array<float,2>{0.270142943f, 0.966407895f},
-std::array<float,2>{0.454443127f, 0.397943109f},
-std::array<float,2>{0.919420183f, 0.814079881f},
-std::array<float,2>{0.566062033f, 0.0572556555f},
-std::array<float,2>{0.0946213081f, 0.522483349f},
-std::array<float,2>{0.236961648f, 0.449233145f},
-std::array<float,2>{0.727675378f, 0.791961908f},
-std::array<float,2>{0.837291241f, 0.0654924288f},
-std::array<float,2>{0.347967386f, 0.598290205f},
-std::array<float,2>{0.396906495f, 0.243846506f},
-std::array<float,2>{0.996339083f, 0.673813879f},
-std::array<float,2>{0.558791637f, 0.368973345f},
-std::array<float,2>{0.00508398283f, 0.882334054f},
-std::array<float,2>{0.0830380246f, 0.0281609055f},
-std::array<float,2>{0.611387789f, 0.549209058f},
-std::array<float,2>{0.878422439f, 0.419748187f},
-std::array<float,2>{0.485440284f, 0.87233144f},
-std::array<float,2>{0.312239528f, 0.305274725f},
-std::array<float,2>{0.790655911f, 0.969669342f},
-std::array<float,2>{0.670770705f, 0.159612f},
-std::array<float,2>{0.152206138f, 0.718707383f},
-std::array<float,2>{0.11364384f, 0.42233023f},
-std::array<float,2>{0.579426467f, 0.847459435f},
-std::array<float,2>{0.92502588f, 0.0136019429f},
-std::array<float,2>{0.445674598f, 0.532383204f},
-std::array<float,2>{0.264062524f, 0.17234537f},
-std::array<float,2>{0.753616691f, 0.691810012f},
-std::array<float,2>{0.632430553f, 0.292315394f},
-std::array<float,2>{0.16591768f, 0.99394089f},
-std::array<float,2>{0.191362336f, 0.0914140046f},
-std::array<float,2>{0.693337381f, 0.621626854f},
-std::array<float,2>{0.874500275f, 0.465683758f},
-std::array<float,2>{0.328202784f, 0.797651112f},
-std::array<float,2>{0.421988487f, 0.356321216f},
-std::array<float,2>{0.945807815f, 0.897032797f},
-std::array<float,2>{0.514059365f, 0.220086545f},
-std::array<float,2>{0.0451596752f, 0.657731652f},
-std::array<float,2>{0.130250931f, 0.273184597f},
-std::array<float,2>{0.68082732f, 0.948994517f},
-std::array<float,2>{0.800591528f, 0.14070408f},
-std::array<float,2>{0.282617539f, 0.723850846f},
-std::array<float,2>{0.481485009f, 0.0355551802f},
-std::array<float,2>{0.901932836f, 0.500007451f},
-std::array<float,2>{0.608053327f, 0.387098074f},
-std::array<float,2>{0.0633397475f, 0.840765119f},
-std::array<float,2>{0.0166256633f, 0.20421584f},
-std::array<float,2>{0.538222373f, 0.647466779f},
-std::array<float,2>{0.96938169f, 0.317439079f},
-std::array<float,2>{0.388911754f, 0.930834234f},
-std::array<float,2>{0.363139868f, 0.480010569f},
-std::array<float,2>{0.821981549f, 0.771841109f},
-std::array<float,2>{0.746482372f, 0.122545093f},
-std::array<float,2>{0.224201933f, 0.58421123f},
-std::array<float,2>{0.100735568f, 0.343896657f},
-std::array<float,2>{0.56666857f, 0.902475536f},
-std::array<float,2>{0.917435825f, 0.232963949f},
-std::array<float,2>{0.458292961f, 0.666093051f},
-std::array<float,2>{0.269267231f, 0.0814510137f},
-std::array<float,2>{0.766679645f, 0.614835382f},
-std::array<float,2>{0.65058428f, 0.460112572f},
-std::array<float,2>{0.18100518f, 0.807847738f},
-std::array<float,2>{0.216954425f, 0.186258405f},
-std::array<float,2>{0.706669092f, 0.697132647f},
-std::array<float,2>{0.858695984f, 0.287043363f},
-std::array<float,2>{0.317736894f, 0.985603571f},
-std::array<float,2>{0.418276161f, 0.436123312f},
-std::array<float,2>{0.961842299f, 0.852754354f},
-std::array<float,2>{0.52201128f, 0.00599644613f},
-std::array<float,2>{0.0578371398f, 0.543417931f},
-std::array<float,2>{0.154095516f, 0.472316474f},
-std::array<float,2>{0.665570915f, 0.777941167f},
-std::array<float,2>{0.794257939f, 0.110888623f},
-std::array<float,2>{0.307589501f, 0.589136183f},
-std::array<float,2>{0.491404742f, 0.212547779f},
-std::array<float,2>{0.880974829f, 0.649350524f},
-std::array<float,2>{0.613455355f, 0.321615189f},
-std::array<float,2>{0.0819577128f, 0.923140824f},
-std::array<float,2>{0.00234454637f, 0.0462622866f},
-std::array<float,2>{0.555513978f, 0.512405217f},
-std::array<float,2>{0.994663537f, 0.3753227f},
-std::array<float,2>{0.391671598f, 0.831155658f},
-std::array<float,2>{0.346460253f, 0.277252376f},
-std::array<float,2>{0.843713641f, 0.939438045f},
-std::array<float,2>{0.733494103f, 0.15157941f},
-std::array<float,2>{0.241865054f, 0.733734608f},
-std::array<float,2>{0.0415684842f, 0.404495806f},
-std::array<float,2>{0.509382844f, 0.823218465f},
-std::array<float,2>{0.952075899f, 0.0474198647f},
-std::array<float,2>{0.428726912f, 0.52527535f},
-std::array<float,2>{0.332704127f, 0.13410835f},
-std::array<float,2>{0.870229423f, 0.734886706f},
-std::array<float,2>{0.688428581f, 0.254144371f},
-std::array<float,2>{0.194437325f, 0.957659423f},
-std::array<float,2>{0.170272544f, 0.095905669f},
-std::array<float,2>{0.625908613f, 0.570114195f},
-std::array<float,2>{0.757518709f, 0.491112083f},
-std::array<float,2>{0.259055525f, 0.762534797f},
-std::array<float,2>{0.45121938f, 0.328886271f},
-std::array<float,2>{0.926250339f, 0.914245844f},
-std::array<float,2>{0.582348764f, 0.19862026f},
-std::array<float,2>{0.111411691f, 0.640263498f},
-std::array<float,2>{0.22185342f, 0.300489187f},
-std::array<float,2>{0.742240191f, 0.980718791f},
-std::array<float,2>{0.825404167f, 0.166868076f},
-std::array<float,2>{0.36449945f, 0.705033123f},
-std::array<float,2>{0.386192858f, 0.0165382065f},
-std::array<float,2>{0.974376559f, 0.55679214f},
-std::array<float,2>{0.531990647f, 0.41339913f},
-std::array<float,2>{0.0219306182f, 0.861367583f},
-std::array<float,2>{0.0668914989f, 0.240817562f},
-std::array<float,2>{0.603086948f, 0.685855925f},
-std::array<float,2>{0.902738869f, 0.365922183f},
-std::array<float,2>{0.478377581f, 0.888098896f},
-std::array<float,2>{0.288341612f, 0.44493261f},
-std::array<float,2>{0.803297818f, 0.783621252f},
-std::array<float,2>{0.685322881f, 0.0762871206f},
-std::array<float,2>{0.126070946f, 0.602157474f},
-std::array<float,2>{0.0242291f, 0.2602247f},
-std::array<float,2>{0.542046905f, 0.964452386f},
-std::array<float,2>{0.980784118f, 0.126388356f},
-std::array<float,2>{0.380669743f, 0.749142528f},
-std::array<float,2>{0.371092409f, 0.0597697459f},
-std::array<float,2>{0.815278888f, 0.518515527f},
-std::array<float,2>{0.734588146f, 0.390858829f},
-std::array<float,2>{0.233824387f, 0.818355501f},
-std::array<float,2>{0.135639742f, 0.189377531f},
-std::array<float,2>{0.67750752f, 0.631989837f},
-std::array<float,2>{0.805603206f, 0.342913181f},
-std::array<float,2>{0.291857839f, 0.912012458f},
-std::array<float,2>{0.472148299f, 0.493153244f},
-std::array<float,2>{0.893045902f, 0.756780684f},
-std::array<float,2>{0.600683808f, 0.106663078f},
-std::array<float,2>{0.076908499f, 0.571183026f},
-std::array<float,2>{0.197096407f, 0.416353077f},
-std::array<float,2>{0.695557415f, 0.869814634f},
-std::array<float,2>{0.862920165f, 0.0272518955f},
-std::array<float,2>{0.342776477f, 0.554567933f},
-std::array<float,2>{0.43237406f, 0.161273733f},
-std::array<float,2>{0.941322863f, 0.711689353f},
-std::array<float,2>{0.506980777f, 0.308993012f},
-std::array<float,2>{0.0341366902f, 0.974669158f},
-std::array<float,2>{0.123576857f, 0.0673740208f},
-std::array<float,2>{0.592021465f, 0.59502852f},
-std::array<float,2>{0.933391035f, 0.448896945f},
-std::array<float,2>{0.438278347f, 0.793582022f},
-std::array<float,2>{0.255207181f, 0.371974587f},
-std::array<float,2>{0.764042616f, 0.875377536f},
-std::array<float,2>{0.634077013f, 0.247373655f},
-std::array<float,2>{0.162571207f, 0.675926507f},
-std::array<float,2>{0.0932567418f, 0.46426037f},
-std::array<float,2>{0.617622733f, 0.803517938f},
-std::array<float,2>{0.885025382f, 0.0886104628f},
-std::array<float,2>{0.494149536f, 0.621002853f},
-std::array<float,2>{0.302999407f, 0.22547771f},
-std::array<float,2>{0.781370759f, 0.661825359f},
-std::array<float,2>{0.660961509f, 0.351731092f},
-std::array<float,2>{0.145048499f, 0.892642498f},
-std::array<float,2>{0.246483043f, 0.0079910662f},
-std::array<float,2>{0.719940066f, 0.537676156f},
-std::array<float,2>{0.831332028f, 0.426314503f},
-std::array<float,2>{0.355044216f, 0.848578334f},
-std::array<float,2>{0.402953506f, 0.295300722f},
-std::array<float,2>{0.984508574f, 0.996983647f},
-std::array<float,2>{0.554621398f, 0.179224089f},
-std::array<float,2>{0.00982127525f, 0.688261926f},
-std::array<float,2>{0.1751948f, 0.314491034f},
-std::array<float,2>{0.645694196f, 0.936338425f},
-std::array<float,2>{0.777078569f, 0.210875466f},
-std::array<float,2>{0.279322982f, 0.64239192f},
-std::array<float,2>{0.465880811f, 0.117270723f},
-std::array<float,2>{0.91080457f, 0.578163147f},
-std::array<float,2>{0.576864243f, 0.484254658f},
-std::array<float,2>{0.105652146f, 0.767683864f},
-std::array<float,2>{0.0498857498f, 0.146303222f},
-std::array<float,2>{0.527367294f, 0.720758438f},
-std::array<float,2>{0.953531206f, 0.268115968f},
-std::array<float,2>{0.408292383f, 0.950941741f},
-std::array<float,2>{0.326949447f, 0.383697957f},
-std::array<float,2>{0.847656071f, 0.839451909f},
-std::array<float,2>{0.712975323f, 0.0332098901f},
-std::array<float,2>{0.204631686f, 0.505732715f},
-std::array<float,2>{0.0891158655f, 0.252791405f},
-std::array<float,2>{0.624487698f, 0.956708252f},
-std::array<float,2>{0.887456834f, 0.137205333f},
-std::array<float,2>{0.498410821f, 0.738722861f},
-std::array<float,2>{0.298828036f, 0.0540265627f},
-std::array<float,2>{0.788018346f, 0.530600727f},
-std::array<float,2>{0.659677446f, 0.400240123f},
-std::array<float,2>{0.141142696f, 0.826709986f},
-std::array<float,2>{0.242410213f, 0.203033969f},
-std::array<float,2>{0.723415375f, 0.632978737f},
-std::array<float,2>{0.832991421f, 0.333895832f},
-std::array<float,2>{0.355614662f, 0.919798434f},
-std::array<float,2>{0.399595946f, 0.48764804f},
-std::array<float,2>{0.989482105f, 0.757831931f},
-std::array<float,2>{0.549219608f, 0.0997928381f},
-std::array<float,2>{0.0128703369f, 0.564049363f},
-std::array<float,2>{0.178806007f, 0.410052896f},
-std::array<float,2>{0.640717089f, 0.867005944f},
-std::array<float,2>{0.778576374f, 0.0228686798f},
-std::array<float,2>{0.276570499f, 0.562125325f},
-std::array<float,2>{0.464631826f, 0.170585945f},
-std::array<float,2>{0.907357216f, 0.709422827f},
-std::array<float,2>{0.573524892f, 0.303423017f},
-std::array<float,2>{0.102343574f, 0.97846216f},
-std::array<float,2>{0.052550558f, 0.0721630976f},
-std::array<float,2>{0.525044203f, 0.607519209f},
-std::array<float,2>{0.960325778f, 0.440121055f},
-std::array<float,2>{0.411781192f, 0.786530375f},
-std::array<float,2>{0.321838409f, 0.360594779f},
-std::array<float,2>{0.848729849f, 0.886084497f},
-std::array<float,2>{0.716271102f, 0.234810263f},
-std::array<float,2>{0.210598454f, 0.681123137f},
-std::array<float,2>{0.0274730083f, 0.453129888f},
-std::array<float,2>{0.545002341f, 0.81191051f},
-std::array<float,2>{0.976700723f, 0.0839374661f},
-std::array<float,2>{0.378363937f, 0.610965848f},
-std::array<float,2>{0.374403059f, 0.228201985f},
-std::array<float,2>{0.816729307f, 0.669587135f},
-std::array<float,2>{0.741417706f, 0.348234057f},
-std::array<float,2>{0.23017019f, 0.899103761f},
-std::array<float,2>{0.137568668f, 0.000947363384f},
-std::array<float,2>{0.675693691f, 0.541303694f},
-std::array<float,2>{0.808705568f, 0.433386624f},
-std::array<float,2>{0.29480648f, 0.857080519f},
-std::array<float,2>{0.473108619f, 0.28308031f},
-std::array<float,2>{0.894680917f, 0.989476204f},
-std::array<float,2>{0.596899569f, 0.180887848f},
-std::array<float,2>{0.0734403506f, 0.700095713f},
-std::array<float,2>{0.202683419f, 0.324748963f},
-std::array<float,2>{0.699365258f, 0.928315938f},
-std::array<float,2>{0.86569345f, 0.217384577f},
-std::array<float,2>{0.337819934f, 0.654847264f},
-std::array<float,2>{0.433996797f, 0.114951544f},
-std::array<float,2>{0.942246556f, 0.590957582f},
-std::array<float,2>{0.500130892f, 0.475713819f},
-std::array<float,2>{0.0389651954f, 0.774443567f},
-std::array<float,2>{0.120189793f, 0.154552445f},
-std::array<float,2>{0.586628199f, 0.729967237f},
-std::array<float,2>{0.935802042f, 0.279409766f},
-std::array<float,2>{0.444998264f, 0.943444252f},
-std::array<float,2>{0.250303775f, 0.379406124f},
-std::array<float,2>{0.760821164f, 0.833796263f},
-std::array<float,2>{0.640449226f, 0.0427014716f},
-std::array<float,2>{0.156857029f, 0.510679841f},
-std::array<float,2>{0.0466727763f, 0.357938409f},
-std::array<float,2>{0.515215576f, 0.894563258f},
-std::array<float,2>{0.947195768f, 0.222639561f},
-std::array<float,2>{0.423248768f, 0.658366919f},
-std::array<float,2>{0.330003023f, 0.0921137854f},
-std::array<float,2>{0.87377733f, 0.624146402f},
-std::array<float,2>{0.691793144f, 0.468539149f},
-std::array<float,2>{0.189911261f, 0.79918623f},
-std::array<float,2>{0.164386198f, 0.174533203f},
-std::array<float,2>{0.631100774f, 0.694364309f},
-std::array<float,2>{0.752731919f, 0.28928265f},
-std::array<float,2>{0.264709651f, 0.995608807f},
-std::array<float,2>{0.446835846f, 0.425743103f},
-std::array<float,2>{0.924467325f, 0.843792379f},
-std::array<float,2>{0.578282297f, 0.0150318285f},
-std::array<float,2>{0.114306234f, 0.533929527f},
-std::array<float,2>{0.223072082f, 0.476851195f},
-std::array<float,2>{0.747823119f, 0.769839466f},
-std::array<float,2>{0.820500314f, 0.123806313f},
-std::array<float,2>{0.361460418f, 0.582785428f},
-std::array<float,2>{0.390125901f, 0.205982208f},
-std::array<float,2>{0.97012341f, 0.646353662f},
-std::array<float,2>{0.537959337f, 0.319207728f},
-std::array<float,2>{0.0160205681f, 0.932384789f},
-std::array<float,2>{0.0643528327f, 0.0375485159f},
-std::array<float,2>{0.608645499f, 0.503002405f},
-std::array<float,2>{0.90134424f, 0.389998347f},
-std::array<float,2>{0.48138234f, 0.843202531f},
-std::array<float,2>{0.281256437f, 0.269744843f},
-std::array<float,2>{0.799708605f, 0.946429491f},
-std::array<float,2>{0.680600762f, 0.144184276f},
-std::array<float,2>{0.129548028f, 0.726207674f},
-std::array<float,2>{0.095539242f, 0.394539088f},
-std::array<float,2>{0.564875603f, 0.81566906f},
-std::array<float,2>{0.918318689f, 0.0549645871f},
-std::array<float,2>{0.453475177f, 0.520850003f},
-std::array<float,2>{0.271379054f, 0.131998569f},
-std::array<float,2>{0.772387445f, 0.746046484f},
-std::array<float,2>{0.654271722f, 0.26230222f},
-std::array<float,2>{0.184886888f, 0.967699707f},
-std::array<float,2>{0.213521153f, 0.10366419f},
-std::array<float,2>{0.710858762f, 0.576143205f},
-std::array<float,2>{0.853220403f, 0.496221304f},
-std::array<float,2>{0.31329757f, 0.751878262f},
-std::array<float,2>{0.414337069f, 0.337888718f},
-std::array<float,2>{0.966148734f, 0.908501983f},
-std::array<float,2>{0.517565727f, 0.191684306f},
-std::array<float,2>{0.0620787516f, 0.625651658f},
-std::array<float,2>{0.150876239f, 0.307832748f},
-std::array<float,2>{0.671872556f, 0.971474469f},
-std::array<float,2>{0.789101124f, 0.157981128f},
-std::array<float,2>{0.310572565f, 0.716426671f},
-std::array<float,2>{0.484636247f, 0.0299924351f},
-std::array<float,2>{0.877102733f, 0.547421634f},
-std::array<float,2>{0.6128878f, 0.42154488f},
-std::array<float,2>{0.0822139382f, 0.873757482f},
-std::array<float,2>{0.00417575706f, 0.24515149f},
-std::array<float,2>{0.560437799f, 0.675229788f},
-std::array<float,2>{0.997866988f, 0.370070487f},
-std::array<float,2>{0.397697926f, 0.87922436f},
-std::array<float,2>{0.348832935f, 0.452777058f},
-std::array<float,2>{0.836249352f, 0.789748907f},
-std::array<float,2>{0.727291107f, 0.0642650425f},
-std::array<float,2>{0.237667635f, 0.601467013f},
-std::array<float,2>{0.112746388f, 0.331865072f},
-std::array<float,2>{0.583702683f, 0.916902483f},
-std::array<float,2>{0.927266359f, 0.19573155f},
-std::array<float,2>{0.452697247f, 0.636769891f},
-std::array<float,2>{0.258052498f, 0.0947461352f},
-std::array<float,2>{0.756120741f, 0.566513956f},
-std::array<float,2>{0.626348794f, 0.488551438f},
-std::array<float,2>{0.171150625f, 0.764038563f},
-std::array<float,2>{0.194104403f, 0.135656461f},
-std::array<float,2>{0.688789606f, 0.737607658f},
-std::array<float,2>{0.869335353f, 0.257388532f},
-std::array<float,2>{0.333832294f, 0.959164321f},
-std::array<float,2>{0.428447872f, 0.404049903f},
-std::array<float,2>{0.952987313f, 0.820798814f},
-std::array<float,2>{0.508727193f, 0.04890237f},
-std::array<float,2>{0.0422294177f, 0.526055336f},
-std::array<float,2>{0.125745192f, 0.442152053f},
-std::array<float,2>{0.68412447f, 0.782387435f},
-std::array<float,2>{0.804202497f, 0.0747164935f},
-std::array<float,2>{0.287395149f, 0.604275465f},
-std::array<float,2>{0.476623952f, 0.238633782f},
-std::array<float,2>{0.903448224f, 0.683934212f},
-std::array<float,2>{0.602292299f, 0.363512844f},
-std::array<float,2>{0.0676233396f, 0.890130401f},
-std::array<float,2>{0.0224875081f, 0.01904504f},
-std::array<float,2>{0.532788515f, 0.555349231f},
-std::array<float,2>{0.973203778f, 0.411487073f},
-std::array<float,2>{0.384895951f, 0.861035585f},
-std::array<float,2>{0.363388926f, 0.297223181f},
-std::array<float,2>{0.82454443f, 0.98411113f},
-std::array<float,2>{0.743282437f, 0.165642023f},
-std::array<float,2>{0.220800743f, 0.706580937f},
-std::array<float,2>{0.0576094203f, 0.434254229f},
-std::array<float,2>{0.523137569f, 0.854075134f},
-std::array<float,2>{0.962519586f, 0.00578032341f},
-std::array<float,2>{0.419080079f, 0.546762705f},
-std::array<float,2>{0.317047119f, 0.184084311f},
-std::array<float,2>{0.857857347f, 0.697593629f},
-std::array<float,2>{0.705450535f, 0.287700742f},
-std::array<float,2>{0.218246594f, 0.986945689f},
-std::array<float,2>{0.179925978f, 0.0793154463f},
-std::array<float,2>{0.651559651f, 0.616714358f},
-std::array<float,2>{0.766025424f, 0.457960278f},
-std::array<float,2>{0.267653853f, 0.805277169f},
-std::array<float,2>{0.45744741f, 0.346868902f},
-std::array<float,2>{0.916684031f, 0.905274212f},
-std::array<float,2>{0.567893863f, 0.231283233f},
-std::array<float,2>{0.100296751f, 0.665131211f},
-std::array<float,2>{0.240887314f, 0.275008768f},
-std::array<float,2>{0.732914627f, 0.939576864f},
-std::array<float,2>{0.842045963f, 0.15027003f},
-std::array<float,2>{0.347144783f, 0.731308043f},
-std::array<float,2>{0.390755862f, 0.0447232239f},
-std::array<float,2>{0.99537617f, 0.513698399f},
-std::array<float,2>{0.555971563f, 0.377748668f},
-std::array<float,2>{0.00388207752f, 0.828710616f},
-std::array<float,2>{0.0803599283f, 0.213744298f},
-std::array<float,2>{0.615126491f, 0.650717258f},
-std::array<float,2>{0.882464945f, 0.322339982f},
-std::array<float,2>{0.491048783f, 0.92568934f},
-std::array<float,2>{0.308470309f, 0.470312327f},
-std::array<float,2>{0.793150902f, 0.780502319f},
-std::array<float,2>{0.664333284f, 0.112780534f},
-std::array<float,2>{0.152739376f, 0.586940229f},
-std::array<float,2>{0.0113805914f, 0.293880075f},
-std::array<float,2>{0.552854598f, 0.99870342f},
-std::array<float,2>{0.986112058f, 0.176294446f},
-std::array<float,2>{0.403860599f, 0.68987453f},
-std::array<float,2>{0.353569865f, 0.0108570214f},
-std::array<float,2>{0.830140769f, 0.536613584f},
-std::array<float,2>{0.719391286f, 0.427810937f},
-std::array<float,2>{0.247644678f, 0.849782705f},
-std::array<float,2>{0.146224767f, 0.22302106f},
-std::array<float,2>{0.661314726f, 0.662992775f},
-std::array<float,2>{0.782740235f, 0.353560805f},
-std::array<float,2>{0.304507941f, 0.890720248f},
-std::array<float,2>{0.495307595f, 0.461433411f},
-std::array<float,2>{0.885972977f, 0.801017225f},
-std::array<float,2>{0.618904948f, 0.0865946636f},
-std::array<float,2>{0.0923818424f, 0.618539929f},
-std::array<float,2>{0.203580007f, 0.386305243f},
-std::array<float,2>{0.714018345f, 0.83781451f},
-std::array<float,2>{0.846504033f, 0.032391157f},
-std::array<float,2>{0.327643812f, 0.507733405f},
-std::array<float,2>{0.40992859f, 0.147020504f},
-std::array<float,2>{0.954406977f, 0.719465971f},
-std::array<float,2>{0.529261589f, 0.266608208f},
-std::array<float,2>{0.0488862284f, 0.952455103f},
-std::array<float,2>{0.107267551f, 0.120777927f},
-std::array<float,2>{0.57793498f, 0.581540883f},
-std::array<float,2>{0.911436021f, 0.481227338f},
-std::array<float,2>{0.464937419f, 0.766647041f},
-std::array<float,2>{0.280887634f, 0.314127177f},
-std::array<float,2>{0.775900126f, 0.93439132f},
-std::array<float,2>{0.644858539f, 0.207768187f},
-std::array<float,2>{0.174595967f, 0.643018603f},
-std::array<float,2>{0.0777824298f, 0.496012509f},
-std::array<float,2>{0.600404382f, 0.755319059f},
-std::array<float,2>{0.89436233f, 0.109347373f},
-std::array<float,2>{0.471264213f, 0.573127866f},
-std::array<float,2>{0.292180061f, 0.190993071f},
-std::array<float,2>{0.806208909f, 0.630161583f},
-std::array<float,2>{0.676573038f, 0.340010464f},
-std::array<float,2>{0.13624306f, 0.913123667f},
-std::array<float,2>{0.233298957f, 0.0605647415f},
-std::array<float,2>{0.735371828f, 0.517276406f},
-std::array<float,2>{0.815633118f, 0.392973095f},
-std::array<float,2>{0.369307697f, 0.819152057f},
-std::array<float,2>{0.379077613f, 0.259051502f},
-std::array<float,2>{0.981981456f, 0.962068439f},
-std::array<float,2>{0.541872501f, 0.127623141f},
-std::array<float,2>{0.0244513098f, 0.747175574f},
-std::array<float,2>{0.163251549f, 0.373930603f},
-std::array<float,2>{0.633412182f, 0.876981258f},
-std::array<float,2>{0.76473105f, 0.248328388f},
-std::array<float,2>{0.254394561f, 0.679158986f},
-std::array<float,2>{0.439187318f, 0.0702736676f},
-std::array<float,2>{0.931983292f, 0.596874118f},
-std::array<float,2>{0.593033195f, 0.446943372f},
-std::array<float,2>{0.124087825f, 0.795050204f},
-std::array<float,2>{0.0346119776f, 0.162110686f},
-std::array<float,2>{0.506442666f, 0.714286149f},
-std::array<float,2>{0.940043032f, 0.312252045f},
-std::array<float,2>{0.432794034f, 0.974568784f},
-std::array<float,2>{0.342607707f, 0.415539324f},
-std::array<float,2>{0.8620525f, 0.868504703f},
-std::array<float,2>{0.696294785f, 0.0241767578f},
-std::array<float,2>{0.195863515f, 0.551578879f},
-std::array<float,2>{0.104432613f, 0.301600665f},
-std::array<float,2>{0.572206795f, 0.979017973f},
-std::array<float,2>{0.909593403f, 0.168788031f},
-std::array<float,2>{0.461171776f, 0.707455695f},
-std::array<float,2>{0.274762392f, 0.0203580018f},
-std::array<float,2>{0.780361056f, 0.559139311f},
-std::array<float,2>{0.642874539f, 0.406607538f},
-std::array<float,2>{0.176044613f, 0.86445415f},
-std::array<float,2>{0.207752332f, 0.237154186f},
-std::array<float,2>{0.718433857f, 0.681969702f},
-std::array<float,2>{0.851247668f, 0.362229824f},
-std::array<float,2>{0.32365647f, 0.884371698f},
-std::array<float,2>{0.413988531f, 0.438888848f},
-std::array<float,2>{0.958762944f, 0.787999749f},
-std::array<float,2>{0.52587378f, 0.07363341f},
-std::array<float,2>{0.0541185997f, 0.60616231f},
-std::array<float,2>{0.144461796f, 0.400805473f},
-std::array<float,2>{0.657796443f, 0.82515198f},
-std::array<float,2>{0.786892354f, 0.0524296388f},
-std::array<float,2>{0.300165385f, 0.528518915f},
-std::array<float,2>{0.496343762f, 0.139890134f},
-std::array<float,2>{0.889032602f, 0.741027296f},
-std::array<float,2>{0.622958899f, 0.251555234f},
-std::array<float,2>{0.0871113539f, 0.953830004f},
-std::array<float,2>{0.0149273043f, 0.0987039804f},
-std::array<float,2>{0.548454225f, 0.564645469f},
-std::array<float,2>{0.990744531f, 0.485596001f},
-std::array<float,2>{0.402025253f, 0.759852946f},
-std::array<float,2>{0.35822919f, 0.33497107f},
-std::array<float,2>{0.834223568f, 0.920571029f},
-std::array<float,2>{0.725279093f, 0.200501874f},
-std::array<float,2>{0.244408116f, 0.635783076f},
-std::array<float,2>{0.0362947285f, 0.473267347f},
-std::array<float,2>{0.502887845f, 0.775955915f},
-std::array<float,2>{0.944560766f, 0.116161406f},
-std::array<float,2>{0.43664664f, 0.593314946f},
-std::array<float,2>{0.339774907f, 0.215192005f},
-std::array<float,2>{0.864927053f, 0.653728306f},
-std::array<float,2>{0.701412976f, 0.326496959f},
-std::array<float,2>{0.200036079f, 0.927267671f},
-std::array<float,2>{0.160128742f, 0.0408601537f},
-std::array<float,2>{0.638105869f, 0.50944978f},
-std::array<float,2>{0.758225143f, 0.382428706f},
-std::array<float,2>{0.253267825f, 0.834501982f},
-std::array<float,2>{0.442109525f, 0.277936161f},
-std::array<float,2>{0.933942854f, 0.941548944f},
-std::array<float,2>{0.589087546f, 0.152779266f},
-std::array<float,2>{0.118779667f, 0.728096306f},
-std::array<float,2>{0.226990357f, 0.349808216f},
-std::array<float,2>{0.739711642f, 0.901822031f},
-std::array<float,2>{0.819005549f, 0.228798762f},
-std::array<float,2>{0.372062325f, 0.670060575f},
-std::array<float,2>{0.37605828f, 0.0858243555f},
-std::array<float,2>{0.978942871f, 0.613188267f},
-std::array<float,2>{0.54380703f, 0.455447048f},
-std::array<float,2>{0.0308474489f, 0.810171068f},
-std::array<float,2>{0.0707068816f, 0.183253989f},
-std::array<float,2>{0.59520787f, 0.702407598f},
-std::array<float,2>{0.896503389f, 0.284828335f},
-std::array<float,2>{0.476227641f, 0.990703464f},
-std::array<float,2>{0.295227557f, 0.430219293f},
-std::array<float,2>{0.810580492f, 0.858947039f},
-std::array<float,2>{0.673657715f, 0.00263675419f},
-std::array<float,2>{0.139849573f, 0.539672196f},
-std::array<float,2>{0.0176204909f, 0.31644395f},
-std::array<float,2>{0.535461366f, 0.929843366f},
-std::array<float,2>{0.972023845f, 0.203537434f},
-std::array<float,2>{0.387058824f, 0.647361696f},
-std::array<float,2>{0.359965801f, 0.121553361f},
-std::array<float,2>{0.823389113f, 0.585462093f},
-std::array<float,2>{0.748814285f, 0.479442656f},
-std::array<float,2>{0.224675283f, 0.773297071f},
-std::array<float,2>{0.131013915f, 0.141868114f},
-std::array<float,2>{0.682608426f, 0.722673476f},
-std::array<float,2>{0.798213065f, 0.272266954f},
-std::array<float,2>{0.284933567f, 0.947617292f},
-std::array<float,2>{0.484209806f, 0.387775391f},
-std::array<float,2>{0.899150252f, 0.841335237f},
-std::array<float,2>{0.606924176f, 0.0369505137f},
-std::array<float,2>{0.0646699965f, 0.501790285f},
-std::array<float,2>{0.18794772f, 0.466616154f},
-std::array<float,2>{0.694836736f, 0.798272431f},
-std::array<float,2>{0.871096194f, 0.0903532133f},
-std::array<float,2>{0.331112504f, 0.62256819f},
-std::array<float,2>{0.423855126f, 0.218798593f},
-std::array<float,2>{0.948707819f, 0.65689522f},
-std::array<float,2>{0.512075424f, 0.356875539f},
-std::array<float,2>{0.0437776521f, 0.898228943f},
-std::array<float,2>{0.115985252f, 0.0125772702f},
-std::array<float,2>{0.581771255f, 0.531936288f},
-std::array<float,2>{0.923154414f, 0.423671693f},
-std::array<float,2>{0.447768778f, 0.846228123f},
-std::array<float,2>{0.263544858f, 0.291591465f},
-std::array<float,2>{0.75140965f, 0.992273808f},
-std::array<float,2>{0.629802763f, 0.173357978f},
-std::array<float,2>{0.167960301f, 0.692660451f},
-std::array<float,2>{0.0851597339f, 0.418249428f},
-std::array<float,2>{0.611138701f, 0.871770084f},
-std::array<float,2>{0.875330985f, 0.0284053478f},
-std::array<float,2>{0.487990439f, 0.550751448f},
-std::array<float,2>{0.308926135f, 0.158267677f},
-std::array<float,2>{0.791823208f, 0.717052698f},
-std::array<float,2>{0.669497192f, 0.30620259f},
-std::array<float,2>{0.149335936f, 0.9706043f},
-std::array<float,2>{0.234512076f, 0.064656049f},
-std::array<float,2>{0.729993403f, 0.599601567f},
-std::array<float,2>{0.839742124f, 0.450968832f},
-std::array<float,2>{0.3513439f, 0.792939723f},
-std::array<float,2>{0.395484328f, 0.367608517f},
-std::array<float,2>{0.999862671f, 0.88149929f},
-std::array<float,2>{0.560588896f, 0.242628083f},
-std::array<float,2>{0.00737286126f, 0.672513306f},
-std::array<float,2>{0.185965881f, 0.264309466f},
-std::array<float,2>{0.655014098f, 0.965688229f},
-std::array<float,2>{0.771288514f, 0.129029885f},
-std::array<float,2>{0.272460818f, 0.743911386f},
-std::array<float,2>{0.456154466f, 0.0583362877f},
-std::array<float,2>{0.920734882f, 0.521655262f},
-std::array<float,2>{0.564087152f, 0.396524489f},
-std::array<float,2>{0.095768854f, 0.813195109f},
-std::array<float,2>{0.0591228716f, 0.194244012f},
-std::array<float,2>{0.518540382f, 0.627393305f},
-std::array<float,2>{0.966975093f, 0.338613212f},
-std::array<float,2>{0.417922169f, 0.908048749f},
-std::array<float,2>{0.315576047f, 0.499481708f},
-std::array<float,2>{0.854715109f, 0.753464758f},
-std::array<float,2>{0.708319128f, 0.103096165f},
-std::array<float,2>{0.212676436f, 0.577689767f},
-std::array<float,2>{0.0695139021f, 0.366337597f},
-std::array<float,2>{0.603968859f, 0.886959374f},
-std::array<float,2>{0.905702233f, 0.241535202f},
-std::array<float,2>{0.478804708f, 0.687196314f},
-std::array<float,2>{0.285562485f, 0.0781244412f},
-std::array<float,2>{0.802630186f, 0.602666855f},
-std::array<float,2>{0.68723613f, 0.443946034f},
-std::array<float,2>{0.128090635f, 0.784528196f},
-std::array<float,2>{0.219121575f, 0.167624503f},
-std::array<float,2>{0.744942725f, 0.703600109f},
-std::array<float,2>{0.826198757f, 0.298918903f},
-std::array<float,2>{0.365923971f, 0.982218623f},
-std::array<float,2>{0.384606808f, 0.412931859f},
-std::array<float,2>{0.976010382f, 0.862851977f},
-std::array<float,2>{0.533441782f, 0.016970668f},
-std::array<float,2>{0.0205339547f, 0.558108628f},
-std::array<float,2>{0.169889927f, 0.491271496f},
-std::array<float,2>{0.628387749f, 0.763573825f},
-std::array<float,2>{0.755743742f, 0.0974728465f},
-std::array<float,2>{0.260667831f, 0.569320083f},
-std::array<float,2>{0.451090008f, 0.197956502f},
-std::array<float,2>{0.929550767f, 0.639051199f},
-std::array<float,2>{0.584440649f, 0.329316288f},
-std::array<float,2>{0.109684728f, 0.915762842f},
-std::array<float,2>{0.0398992784f, 0.0487568229f},
-std::array<float,2>{0.510106444f, 0.524119139f},
-std::array<float,2>{0.95065856f, 0.405727655f},
-std::array<float,2>{0.427331448f, 0.823589683f},
-std::array<float,2>{0.334666997f, 0.255547911f},
-std::array<float,2>{0.867410898f, 0.958428264f},
-std::array<float,2>{0.691037357f, 0.133544594f},
-std::array<float,2>{0.19317688f, 0.735897601f},
-std::array<float,2>{0.000523922849f, 0.376138359f},
-std::array<float,2>{0.558549285f, 0.830952108f},
-std::array<float,2>{0.994080067f, 0.0456545055f},
-std::array<float,2>{0.392905623f, 0.513189971f},
-std::array<float,2>{0.345082283f, 0.151255861f},
-std::array<float,2>{0.840015709f, 0.732531667f},
-std::array<float,2>{0.730667412f, 0.276314288f},
-std::array<float,2>{0.238868564f, 0.938303649f},
-std::array<float,2>{0.154444665f, 0.109598525f},
-std::array<float,2>{0.667366207f, 0.588512123f},
-std::array<float,2>{0.796689987f, 0.470753849f},
-std::array<float,2>{0.306523114f, 0.77895081f},
-std::array<float,2>{0.488828421f, 0.321269929f},
-std::array<float,2>{0.879878581f, 0.922495425f},
-std::array<float,2>{0.615477383f, 0.211086079f},
-std::array<float,2>{0.0785819516f, 0.650235593f},
-std::array<float,2>{0.21616827f, 0.28575632f},
-std::array<float,2>{0.703399718f, 0.98468256f},
-std::array<float,2>{0.85588491f, 0.187418386f},
-std::array<float,2>{0.319940805f, 0.695610523f},
-std::array<float,2>{0.421116441f, 0.00761459488f},
-std::array<float,2>{0.964403987f, 0.544695497f},
-std::array<float,2>{0.521235883f, 0.437073112f},
-std::array<float,2>{0.0553573966f, 0.852228343f},
-std::array<float,2>{0.0994329229f, 0.234352112f},
-std::array<float,2>{0.569262922f, 0.667945862f},
-std::array<float,2>{0.91545856f, 0.345034391f},
-std::array<float,2>{0.459484577f, 0.903493881f},
-std::array<float,2>{0.265902311f, 0.459213883f},
-std::array<float,2>{0.769303143f, 0.807265937f},
-std::array<float,2>{0.65021354f, 0.0809775665f},
-std::array<float,2>{0.182451516f, 0.613420904f},
-std::array<float,2>{0.0482451022f, 0.269043744f},
-std::array<float,2>{0.530258179f, 0.950172961f},
-std::array<float,2>{0.956651568f, 0.145454809f},
-std::array<float,2>{0.406692743f, 0.722563863f},
-std::array<float,2>{0.325830162f, 0.0346665941f},
-std::array<float,2>{0.845643997f, 0.503948331f},
-std::array<float,2>{0.711471975f, 0.384243548f},
-std::array<float,2>{0.207013994f, 0.838153839f},
-std::array<float,2>{0.172296092f, 0.209075436f},
-std::array<float,2>{0.648409665f, 0.640897274f},
-std::array<float,2>{0.773594618f, 0.316405177f},
-std::array<float,2>{0.277994066f, 0.93741107f},
-std::array<float,2>{0.468163073f, 0.482902586f},
-std::array<float,2>{0.9122895f, 0.768838763f},
-std::array<float,2>{0.575479925f, 0.119117416f},
-std::array<float,2>{0.108503111f, 0.579371274f},
-std::array<float,2>{0.249031082f, 0.427119404f},
-std::array<float,2>{0.722257614f, 0.848743856f},
-std::array<float,2>{0.829988301f, 0.00917375181f},
-std::array<float,2>{0.352784485f, 0.538601398f},
-std::array<float,2>{0.404630572f, 0.178254932f},
-std::array<float,2>{0.986377597f, 0.688903391f},
-std::array<float,2>{0.552177787f, 0.296658963f},
-std::array<float,2>{0.00856537465f, 0.997742653f},
-std::array<float,2>{0.0912514552f, 0.088971965f},
-std::array<float,2>{0.620910645f, 0.619518578f},
-std::array<float,2>{0.882984698f, 0.463592172f},
-std::array<float,2>{0.493333131f, 0.804339409f},
-std::array<float,2>{0.30103159f, 0.352568507f},
-std::array<float,2>{0.784184754f, 0.894205749f},
-std::array<float,2>{0.662762463f, 0.225784406f},
-std::array<float,2>{0.147158369f, 0.661045611f},
-std::array<float,2>{0.122943766f, 0.447464615f},
-std::array<float,2>{0.59013325f, 0.794639528f},
-std::array<float,2>{0.929697216f, 0.0673860312f},
-std::array<float,2>{0.44090274f, 0.594294846f},
-std::array<float,2>{0.257279396f, 0.246696666f},
-std::array<float,2>{0.762202501f, 0.677339077f},
-std::array<float,2>{0.635157883f, 0.372778594f},
-std::array<float,2>{0.161966473f, 0.876789749f},
-std::array<float,2>{0.198254839f, 0.0261342246f},
-std::array<float,2>{0.698907554f, 0.553554893f},
-std::array<float,2>{0.859700322f, 0.417436987f},
-std::array<float,2>{0.341181815f, 0.870372534f},
-std::array<float,2>{0.430914223f, 0.309797615f},
-std::array<float,2>{0.937932312f, 0.975958169f},
-std::array<float,2>{0.504974365f, 0.160629645f},
-std::array<float,2>{0.0321185887f, 0.712472796f},
-std::array<float,2>{0.133803546f, 0.34224239f},
-std::array<float,2>{0.679224312f, 0.910982728f},
-std::array<float,2>{0.80804348f, 0.187649846f},
-std::array<float,2>{0.290982664f, 0.63105911f},
-std::array<float,2>{0.469943434f, 0.106399551f},
-std::array<float,2>{0.891205132f, 0.571625531f},
-std::array<float,2>{0.598333538f, 0.493195027f},
-std::array<float,2>{0.0755300969f, 0.756849289f},
-std::array<float,2>{0.0256590862f, 0.125210658f},
-std::array<float,2>{0.540374041f, 0.748694062f},
-std::array<float,2>{0.983284891f, 0.260773718f},
-std::array<float,2>{0.382546604f, 0.963722169f},
-std::array<float,2>{0.367719442f, 0.392145604f},
-std::array<float,2>{0.812731028f, 0.816605926f},
-std::array<float,2>{0.737765908f, 0.0592797436f},
-std::array<float,2>{0.232229799f, 0.519102097f},
-std::array<float,2>{0.0963348597f, 0.261859983f},
-std::array<float,2>{0.563494325f, 0.96691221f},
-std::array<float,2>{0.920132041f, 0.13266246f},
-std::array<float,2>{0.456928045f, 0.745472848f},
-std::array<float,2>{0.271601409f, 0.0556548797f},
-std::array<float,2>{0.770813346f, 0.521411777f},
-std::array<float,2>{0.654744864f, 0.395363688f},
-std::array<float,2>{0.186062068f, 0.816043794f},
-std::array<float,2>{0.212366745f, 0.192262828f},
-std::array<float,2>{0.708530188f, 0.625173271f},
-std::array<float,2>{0.854994416f, 0.337071538f},
-std::array<float,2>{0.316293836f, 0.908790827f},
-std::array<float,2>{0.417240828f, 0.496667951f},
-std::array<float,2>{0.967318535f, 0.751424849f},
-std::array<float,2>{0.517768741f, 0.10448952f},
-std::array<float,2>{0.0590069778f, 0.575467765f},
-std::array<float,2>{0.148664668f, 0.421244532f},
-std::array<float,2>{0.669232607f, 0.873495519f},
-std::array<float,2>{0.791420221f, 0.0295979474f},
-std::array<float,2>{0.309507281f, 0.546911061f},
-std::array<float,2>{0.487365097f, 0.157314435f},
-std::array<float,2>{0.875905275f, 0.715858877f},
-std::array<float,2>{0.610396266f, 0.308591366f},
-std::array<float,2>{0.0858599022f, 0.971163929f},
-std::array<float,2>{0.00729284715f, 0.0638488457f},
-std::array<float,2>{0.56139636f, 0.601009965f},
-std::array<float,2>{0.99911797f, 0.452209085f},
-std::array<float,2>{0.394592881f, 0.789367855f},
-std::array<float,2>{0.35106501f, 0.369230896f},
-std::array<float,2>{0.838906467f, 0.879428446f},
-std::array<float,2>{0.729546249f, 0.245972857f},
-std::array<float,2>{0.234874666f, 0.675538182f},
-std::array<float,2>{0.043273136f, 0.467977524f},
-std::array<float,2>{0.512339234f, 0.799639642f},
-std::array<float,2>{0.949029982f, 0.0925791264f},
-std::array<float,2>{0.424345285f, 0.624634206f},
-std::array<float,2>{0.331849456f, 0.221952319f},
-std::array<float,2>{0.871728241f, 0.658691645f},
-std::array<float,2>{0.694662213f, 0.357456386f},
-std::array<float,2>{0.18809253f, 0.895091832f},
-std::array<float,2>{0.167384461f, 0.0154492371f},
-std::array<float,2>{0.629168332f, 0.533239663f},
-std::array<float,2>{0.751692414f, 0.424914718f},
-std::array<float,2>{0.262713015f, 0.844348431f},
-std::array<float,2>{0.447398812f, 0.289787591f},
-std::array<float,2>{0.923596084f, 0.995450258f},
-std::array<float,2>{0.581229985f, 0.174001217f},
-std::array<float,2>{0.115437515f, 0.695044458f},
-std::array<float,2>{0.225347877f, 0.318806648f},
-std::array<float,2>{0.74832952f, 0.931936502f},
-std::array<float,2>{0.824200094f, 0.205364808f},
-std::array<float,2>{0.359760314f, 0.645716012f},
-std::array<float,2>{0.387662768f, 0.123179004f},
-std::array<float,2>{0.972257137f, 0.582088053f},
-std::array<float,2>{0.535929203f, 0.477342308f},
-std::array<float,2>{0.0181418601f, 0.770038545f},
-std::array<float,2>{0.0653680265f, 0.143733233f},
-std::array<float,2>{0.607380509f, 0.725930214f},
-std::array<float,2>{0.898595214f, 0.270494699f},
-std::array<float,2>{0.483841449f, 0.947122157f},
-std::array<float,2>{0.284569383f, 0.390523702f},
-std::array<float,2>{0.798656344f, 0.843614995f},
-std::array<float,2>{0.682013452f, 0.0379900523f},
-std::array<float,2>{0.131552488f, 0.503497064f},
-std::array<float,2>{0.0306036454f, 0.347967148f},
-std::array<float,2>{0.543102682f, 0.898860753f},
-std::array<float,2>{0.979029715f, 0.227986336f},
-std::array<float,2>{0.376722604f, 0.668945789f},
-std::array<float,2>{0.371478319f, 0.083046712f},
-std::array<float,2>{0.81882143f, 0.610479116f},
-std::array<float,2>{0.739965379f, 0.453924567f},
-std::array<float,2>{0.227235854f, 0.812202811f},
-std::array<float,2>{0.140533358f, 0.18135187f},
-std::array<float,2>{0.673183918f, 0.699450493f},
-std::array<float,2>{0.811192036f, 0.282641679f},
-std::array<float,2>{0.295715064f, 0.990193546f},
-std::array<float,2>{0.47567901f, 0.432746768f},
-std::array<float,2>{0.897033453f, 0.856711984f},
-std::array<float,2>{0.595263779f, 0.00047730378f},
-std::array<float,2>{0.0709077641f, 0.541581988f},
-std::array<float,2>{0.199505627f, 0.476113409f},
-std::array<float,2>{0.702032864f, 0.77526474f},
-std::array<float,2>{0.864588916f, 0.11441949f},
-std::array<float,2>{0.339318514f, 0.591379642f},
-std::array<float,2>{0.437013656f, 0.217024118f},
-std::array<float,2>{0.945308089f, 0.654650331f},
-std::array<float,2>{0.502425313f, 0.324386537f},
-std::array<float,2>{0.0367754847f, 0.928100407f},
-std::array<float,2>{0.118171342f, 0.0420370437f},
-std::array<float,2>{0.589607716f, 0.50995332f},
-std::array<float,2>{0.934385121f, 0.379052043f},
-std::array<float,2>{0.441553235f, 0.833208919f},
-std::array<float,2>{0.25371781f, 0.279883415f},
-std::array<float,2>{0.758734524f, 0.943911612f},
-std::array<float,2>{0.63859868f, 0.155175731f},
-std::array<float,2>{0.159230426f, 0.730009794f},
-std::array<float,2>{0.0876805335f, 0.399733275f},
-std::array<float,2>{0.622260094f, 0.826259494f},
-std::array<float,2>{0.88924545f, 0.0544376187f},
-std::array<float,2>{0.496970117f, 0.531141937f},
-std::array<float,2>{0.300430745f, 0.137235001f},
-std::array<float,2>{0.786558032f, 0.739044487f},
-std::array<float,2>{0.657563746f, 0.252381563f},
-std::array<float,2>{0.143980086f, 0.956217468f},
-std::array<float,2>{0.244962513f, 0.100191079f},
-std::array<float,2>{0.724621296f, 0.563854456f},
-std::array<float,2>{0.834558666f, 0.488058984f},
-std::array<float,2>{0.357745677f, 0.758701563f},
-std::array<float,2>{0.401819974f, 0.33305636f},
-std::array<float,2>{0.990683794f, 0.919276357f},
-std::array<float,2>{0.54819715f, 0.202429488f},
-std::array<float,2>{0.0155933369f, 0.633549809f},
-std::array<float,2>{0.176559806f, 0.303120375f},
-std::array<float,2>{0.643135726f, 0.977654278f},
-std::array<float,2>{0.781013489f, 0.170388624f},
-std::array<float,2>{0.274946928f, 0.709770501f},
-std::array<float,2>{0.461559653f, 0.0230330341f},
-std::array<float,2>{0.909930766f, 0.561960042f},
-std::array<float,2>{0.571632802f, 0.409341723f},
-std::array<float,2>{0.103614628f, 0.866397023f},
-std::array<float,2>{0.0543992035f, 0.235038698f},
-std::array<float,2>{0.526073933f, 0.681292117f},
-std::array<float,2>{0.95812428f, 0.361088574f},
-std::array<float,2>{0.413211882f, 0.886628687f},
-std::array<float,2>{0.323813528f, 0.439630657f},
-std::array<float,2>{0.850965261f, 0.786964595f},
-std::array<float,2>{0.718014181f, 0.071487017f},
-std::array<float,2>{0.207097173f, 0.608242214f},
-std::array<float,2>{0.0756997615f, 0.340432554f},
-std::array<float,2>{0.597864807f, 0.913588285f},
-std::array<float,2>{0.890828609f, 0.190605551f},
-std::array<float,2>{0.470319957f, 0.630392671f},
-std::array<float,2>{0.290149182f, 0.10888198f},
-std::array<float,2>{0.808374047f, 0.572321415f},
-std::array<float,2>{0.678952932f, 0.495588213f},
-std::array<float,2>{0.13470605f, 0.755839765f},
-std::array<float,2>{0.231815532f, 0.127015799f},
-std::array<float,2>{0.737829268f, 0.747731745f},
-std::array<float,2>{0.813287079f, 0.259746104f},
-std::array<float,2>{0.367617011f, 0.962695241f},
-std::array<float,2>{0.382142723f, 0.393498003f},
-std::array<float,2>{0.982682168f, 0.818513215f},
-std::array<float,2>{0.54081434f, 0.0611312948f},
-std::array<float,2>{0.0259384345f, 0.516819954f},
-std::array<float,2>{0.161442533f, 0.446664512f},
-std::array<float,2>{0.635695517f, 0.795797348f},
-std::array<float,2>{0.762551129f, 0.0697797984f},
-std::array<float,2>{0.25750193f, 0.597292721f},
-std::array<float,2>{0.440936893f, 0.248786956f},
-std::array<float,2>{0.930524528f, 0.679509163f},
-std::array<float,2>{0.590365529f, 0.373364508f},
-std::array<float,2>{0.12248455f, 0.877608359f},
-std::array<float,2>{0.0313254371f, 0.0234599877f},
-std::array<float,2>{0.505649626f, 0.55115211f},
-std::array<float,2>{0.938143313f, 0.415089786f},
-std::array<float,2>{0.431618154f, 0.868795335f},
-std::array<float,2>{0.341565311f, 0.311956674f},
-std::array<float,2>{0.860032976f, 0.973724186f},
-std::array<float,2>{0.698275685f, 0.1628685f},
-std::array<float,2>{0.199104235f, 0.714537263f},
-std::array<float,2>{0.00790516473f, 0.428268045f},
-std::array<float,2>{0.552279174f, 0.850128889f},
-std::array<float,2>{0.986862361f, 0.0112909256f},
-std::array<float,2>{0.405227214f, 0.536656976f},
-std::array<float,2>{0.353145063f, 0.175930679f},
-std::array<float,2>{0.82953912f, 0.690402746f},
-std::array<float,2>{0.721792519f, 0.29329893f},
-std::array<float,2>{0.249750569f, 0.998469532f},
-std::array<float,2>{0.146648824f, 0.0862762257f},
-std::array<float,2>{0.66241771f, 0.619099975f},
-std::array<float,2>{0.784844637f, 0.461355776f},
-std::array<float,2>{0.301649839f, 0.801544905f},
-std::array<float,2>{0.493772775f, 0.354075462f},
-std::array<float,2>{0.883548379f, 0.891590655f},
-std::array<float,2>{0.62026912f, 0.223476544f},
-std::array<float,2>{0.0914122313f, 0.662341952f},
-std::array<float,2>{0.206486702f, 0.267443061f},
-std::array<float,2>{0.711229563f, 0.953120708f},
-std::array<float,2>{0.844781101f, 0.146759033f},
-std::array<float,2>{0.325564116f, 0.718846798f},
-std::array<float,2>{0.406959504f, 0.0330062248f},
-std::array<float,2>{0.956135273f, 0.507166505f},
-std::array<float,2>{0.529471815f, 0.386093944f},
-std::array<float,2>{0.0484890826f, 0.837284863f},
-std::array<float,2>{0.109313197f, 0.207050502f},
-std::array<float,2>{0.575926185f, 0.643446863f},
-std::array<float,2>{0.912712336f, 0.313758045f},
-std::array<float,2>{0.46832338f, 0.933798492f},
-std::array<float,2>{0.27777344f, 0.480698377f},
-std::array<float,2>{0.774285972f, 0.767238438f},
-std::array<float,2>{0.647490501f, 0.120250866f},
-std::array<float,2>{0.172445074f, 0.581721067f},
-std::array<float,2>{0.054956682f, 0.287248522f},
-std::array<float,2>{0.520882905f, 0.98670119f},
-std::array<float,2>{0.964312792f, 0.18369098f},
-std::array<float,2>{0.421673685f, 0.698078692f},
-std::array<float,2>{0.319402337f, 0.0050465907f},
-std::array<float,2>{0.856400549f, 0.546377361f},
-std::array<float,2>{0.703802645f, 0.4336842f},
-std::array<float,2>{0.216672435f, 0.853542507f},
-std::array<float,2>{0.181665808f, 0.230703056f},
-std::array<float,2>{0.649872601f, 0.665686727f},
-std::array<float,2>{0.768855453f, 0.347415119f},
-std::array<float,2>{0.266595066f, 0.905906618f},
-std::array<float,2>{0.459235489f, 0.457227379f},
-std::array<float,2>{0.915767312f, 0.805010557f},
-std::array<float,2>{0.568765938f, 0.0800604671f},
-std::array<float,2>{0.0988439023f, 0.616318285f},
-std::array<float,2>{0.238489956f, 0.37697041f},
-std::array<float,2>{0.731354833f, 0.828392029f},
-std::array<float,2>{0.840701163f, 0.04412416f},
-std::array<float,2>{0.345677108f, 0.514160275f},
-std::array<float,2>{0.393427998f, 0.149424881f},
-std::array<float,2>{0.993187249f, 0.730539143f},
-std::array<float,2>{0.558033586f, 0.274846256f},
-std::array<float,2>{0.000385287858f, 0.940191507f},
-std::array<float,2>{0.0789187029f, 0.112903081f},
-std::array<float,2>{0.615894437f, 0.587648034f},
-std::array<float,2>{0.878970861f, 0.470082581f},
-std::array<float,2>{0.488294512f, 0.781007469f},
-std::array<float,2>{0.306068033f, 0.322992682f},
-std::array<float,2>{0.79634136f, 0.925192416f},
-std::array<float,2>{0.66752696f, 0.212907597f},
-std::array<float,2>{0.155235618f, 0.651170909f},
-std::array<float,2>{0.109993666f, 0.488952726f},
-std::array<float,2>{0.584734857f, 0.76458025f},
-std::array<float,2>{0.928718567f, 0.0954824314f},
-std::array<float,2>{0.450672626f, 0.567316949f},
-std::array<float,2>{0.259973288f, 0.196105555f},
-std::array<float,2>{0.755082726f, 0.637571633f},
-std::array<float,2>{0.628715873f, 0.331178784f},
-std::array<float,2>{0.169380292f, 0.916184485f},
-std::array<float,2>{0.192384526f, 0.0497061908f},
-std::array<float,2>{0.690813899f, 0.525866926f},
-std::array<float,2>{0.86768055f, 0.403609663f},
-std::array<float,2>{0.334096372f, 0.820955992f},
-std::array<float,2>{0.426884741f, 0.257290095f},
-std::array<float,2>{0.950779557f, 0.959666193f},
-std::array<float,2>{0.510340214f, 0.135045215f},
-std::array<float,2>{0.0394442379f, 0.738125622f},
-std::array<float,2>{0.128809288f, 0.363891572f},
-std::array<float,2>{0.686948061f, 0.890434265f},
-std::array<float,2>{0.80194658f, 0.239241615f},
-std::array<float,2>{0.286107987f, 0.684418499f},
-std::array<float,2>{0.479210615f, 0.0745496452f},
-std::array<float,2>{0.906135321f, 0.603805602f},
-std::array<float,2>{0.604230762f, 0.441688091f},
-std::array<float,2>{0.0699200481f, 0.783141792f},
-std::array<float,2>{0.0214259699f, 0.16544205f},
-std::array<float,2>{0.533926368f, 0.706518412f},
-std::array<float,2>{0.97637099f, 0.297630221f},
-std::array<float,2>{0.384172529f, 0.983584404f},
-std::array<float,2>{0.365340352f, 0.412057251f},
-std::array<float,2>{0.826819837f, 0.860750794f},
-std::array<float,2>{0.74426645f, 0.0185612012f},
-std::array<float,2>{0.219395608f, 0.555169523f},
-std::array<float,2>{0.0828504339f, 0.3059448f},
-std::array<float,2>{0.612639964f, 0.970010996f},
-std::array<float,2>{0.877821982f, 0.15871273f},
-std::array<float,2>{0.485324532f, 0.717326105f},
-std::array<float,2>{0.311148673f, 0.0288323574f},
-std::array<float,2>{0.78957504f, 0.550225258f},
-std::array<float,2>{0.671133041f, 0.418516397f},
-std::array<float,2>{0.151268169f, 0.87149173f},
-std::array<float,2>{0.238191694f, 0.242903039f},
-std::array<float,2>{0.726657569f, 0.67217344f},
-std::array<float,2>{0.836732507f, 0.36804238f},
-std::array<float,2>{0.349598616f, 0.881330013f},
-std::array<float,2>{0.398345143f, 0.450461388f},
-std::array<float,2>{0.997227788f, 0.792237759f},
-std::array<float,2>{0.559944868f, 0.0649508089f},
-std::array<float,2>{0.0048047509f, 0.598808706f},
-std::array<float,2>{0.185505211f, 0.397441149f},
-std::array<float,2>{0.653675199f, 0.812796593f},
-std::array<float,2>{0.771585166f, 0.0578947999f},
-std::array<float,2>{0.270800143f, 0.522356808f},
-std::array<float,2>{0.453912079f, 0.129550695f},
-std::array<float,2>{0.918564737f, 0.743465543f},
-std::array<float,2>{0.565239608f, 0.263788372f},
-std::array<float,2>{0.0949867889f, 0.965189457f},
-std::array<float,2>{0.0619992688f, 0.102603689f},
-std::array<float,2>{0.517081201f, 0.577334523f},
-std::array<float,2>{0.966741562f, 0.499597192f},
-std::array<float,2>{0.414560229f, 0.753092408f},
-std::array<float,2>{0.312759161f, 0.338100612f},
-std::array<float,2>{0.852956712f, 0.907246172f},
-std::array<float,2>{0.710109532f, 0.193639457f},
-std::array<float,2>{0.213253841f, 0.6275509f},
-std::array<float,2>{0.0165841822f, 0.478837848f},
-std::array<float,2>{0.537394524f, 0.772934854f},
-std::array<float,2>{0.970679939f, 0.12170773f},
-std::array<float,2>{0.390138209f, 0.585377395f},
-std::array<float,2>{0.361935586f, 0.203830063f},
-std::array<float,2>{0.821058452f, 0.646699727f},
-std::array<float,2>{0.747210801f, 0.317254215f},
-std::array<float,2>{0.223589301f, 0.930464685f},
-std::array<float,2>{0.129055202f, 0.0366004482f},
-std::array<float,2>{0.68014282f, 0.501186073f},
-std::array<float,2>{0.79903698f, 0.388298929f},
-std::array<float,2>{0.281807691f, 0.841110468f},
-std::array<float,2>{0.480776846f, 0.271510392f},
-std::array<float,2>{0.900757194f, 0.947936177f},
-std::array<float,2>{0.608910859f, 0.142095551f},
-std::array<float,2>{0.0636869073f, 0.723356068f},
-std::array<float,2>{0.190054119f, 0.357060522f},
-std::array<float,2>{0.692305863f, 0.897724748f},
-std::array<float,2>{0.87333858f, 0.219673544f},
-std::array<float,2>{0.329207957f, 0.656363666f},
-std::array<float,2>{0.423717827f, 0.0902252048f},
-std::array<float,2>{0.946382105f, 0.622148693f},
-std::array<float,2>{0.514725745f, 0.465917677f},
-std::array<float,2>{0.0459089093f, 0.798824191f},
-std::array<float,2>{0.114912406f, 0.172986835f},
-std::array<float,2>{0.578862071f, 0.693039596f},
-std::array<float,2>{0.92416501f, 0.291290849f},
-std::array<float,2>{0.446486175f, 0.992919981f},
-std::array<float,2>{0.265458763f, 0.423238665f},
-std::array<float,2>{0.752383232f, 0.8459813f},
-std::array<float,2>{0.631735563f, 0.0117872339f},
-std::array<float,2>{0.164825022f, 0.531698942f},
-std::array<float,2>{0.0384509303f, 0.326664895f},
-std::array<float,2>{0.50085932f, 0.926802337f},
-std::array<float,2>{0.941702366f, 0.215737507f},
-std::array<float,2>{0.434439749f, 0.654246211f},
-std::array<float,2>{0.33702305f, 0.115637578f},
-std::array<float,2>{0.866108656f, 0.593079448f},
-std::array<float,2>{0.6998505f, 0.47277981f},
-std::array<float,2>{0.202486753f, 0.775814474f},
-std::array<float,2>{0.156466067f, 0.15296936f},
-std::array<float,2>{0.639718771f, 0.727824986f},
-std::array<float,2>{0.761242986f, 0.277660787f},
-std::array<float,2>{0.250613153f, 0.942293406f},
-std::array<float,2>{0.444696575f, 0.382226974f},
-std::array<float,2>{0.936489463f, 0.834232926f},
-std::array<float,2>{0.5861637f, 0.0400703289f},
-std::array<float,2>{0.120814405f, 0.509068072f},
-std::array<float,2>{0.229495704f, 0.455700815f},
-std::array<float,2>{0.742005348f, 0.809771836f},
-std::array<float,2>{0.816975296f, 0.0850276873f},
-std::array<float,2>{0.374546945f, 0.612520516f},
-std::array<float,2>{0.378605366f, 0.229424685f},
-std::array<float,2>{0.977101505f, 0.670695066f},
-std::array<float,2>{0.545859039f, 0.350452751f},
-std::array<float,2>{0.028305687f, 0.902281582f},
-std::array<float,2>{0.0740912706f, 0.00243253959f},
-std::array<float,2>{0.597338438f, 0.539550602f},
-std::array<float,2>{0.895397007f, 0.429995567f},
-std::array<float,2>{0.47328195f, 0.85885936f},
-std::array<float,2>{0.294215411f, 0.284582496f},
-std::array<float,2>{0.80929172f, 0.991200686f},
-std::array<float,2>{0.675232112f, 0.183023021f},
-std::array<float,2>{0.136934862f, 0.703077078f},
-std::array<float,2>{0.101995155f, 0.407008052f},
-std::array<float,2>{0.57401073f, 0.864983797f},
-std::array<float,2>{0.908123553f, 0.0195963569f},
-std::array<float,2>{0.463980168f, 0.55869931f},
-std::array<float,2>{0.276993811f, 0.168322265f},
-std::array<float,2>{0.779080272f, 0.707589328f},
-std::array<float,2>{0.641450346f, 0.301149279f},
-std::array<float,2>{0.179672942f, 0.978709042f},
-std::array<float,2>{0.210081741f, 0.0741367862f},
-std::array<float,2>{0.7167961f, 0.605506718f},
-std::array<float,2>{0.849570632f, 0.439300865f},
-std::array<float,2>{0.321464241f, 0.787543416f},
-std::array<float,2>{0.411348969f, 0.361656427f},
-std::array<float,2>{0.960791886f, 0.884109974f},
-std::array<float,2>{0.524677575f, 0.236518696f},
-std::array<float,2>{0.0519911237f, 0.682339787f},
-std::array<float,2>{0.140813679f, 0.251417667f},
-std::array<float,2>{0.659297705f, 0.953365982f},
-std::array<float,2>{0.787175417f, 0.140401036f},
-std::array<float,2>{0.298154354f, 0.740393758f},
-std::array<float,2>{0.498667657f, 0.0518127568f},
-std::array<float,2>{0.886983156f, 0.529183209f},
-std::array<float,2>{0.624842107f, 0.400959641f},
-std::array<float,2>{0.0893763676f, 0.824554861f},
-std::array<float,2>{0.0134714404f, 0.20102112f},
-std::array<float,2>{0.549546897f, 0.636257768f},
-std::array<float,2>{0.990031242f, 0.335825652f},
-std::array<float,2>{0.40034613f, 0.919998407f},
-std::array<float,2>{0.356084794f, 0.485868096f},
-std::array<float,2>{0.832131505f, 0.760616601f},
-std::array<float,2>{0.722789764f, 0.099296771f},
-std::array<float,2>{0.242931351f, 0.56496644f},
-std::array<float,2>{0.124799244f, 0.37249282f},
-std::array<float,2>{0.593650043f, 0.8763026f},
-std::array<float,2>{0.932152569f, 0.246202603f},
-std::array<float,2>{0.438777864f, 0.676860631f},
-std::array<float,2>{0.254032731f, 0.0682184994f},
-std::array<float,2>{0.765259385f, 0.593930483f},
-std::array<float,2>{0.633039236f, 0.447882712f},
-std::array<float,2>{0.163713351f, 0.794246793f},
-std::array<float,2>{0.195716053f, 0.161064446f},
-std::array<float,2>{0.697226167f, 0.712249517f},
-std::array<float,2>{0.861552954f, 0.310224384f},
-std::array<float,2>{0.342055053f, 0.976097047f},
-std::array<float,2>{0.433503032f, 0.417932004f},
-std::array<float,2>{0.939790189f, 0.870982766f},
-std::array<float,2>{0.506215096f, 0.0257144552f},
-std::array<float,2>{0.0347217545f, 0.553091943f},
-std::array<float,2>{0.136014581f, 0.493888408f},
-std::array<float,2>{0.67597419f, 0.757715404f},
-std::array<float,2>{0.805895805f, 0.105504125f},
-std::array<float,2>{0.292888463f, 0.572076917f},
-std::array<float,2>{0.47116977f, 0.188352451f},
-std::array<float,2>{0.893711686f, 0.63181293f},
-std::array<float,2>{0.600069344f, 0.342561692f},
-std::array<float,2>{0.077234365f, 0.91030854f},
-std::array<float,2>{0.0249174554f, 0.058614783f},
-std::array<float,2>{0.541168153f, 0.518816829f},
-std::array<float,2>{0.981600642f, 0.391709447f},
-std::array<float,2>{0.379878938f, 0.817076206f},
-std::array<float,2>{0.370104462f, 0.261670977f},
-std::array<float,2>{0.816024899f, 0.96289289f},
-std::array<float,2>{0.736028433f, 0.125976279f},
-std::array<float,2>{0.232554361f, 0.748504698f},
-std::array<float,2>{0.0493788868f, 0.38435778f},
-std::array<float,2>{0.528732598f, 0.838790536f},
-std::array<float,2>{0.954674959f, 0.0351014882f},
-std::array<float,2>{0.409552187f, 0.50482583f},
-std::array<float,2>{0.327262372f, 0.144956186f},
-std::array<float,2>{0.846019983f, 0.72202307f},
-std::array<float,2>{0.714657426f, 0.268873543f},
-std::array<float,2>{0.203851044f, 0.949558496f},
-std::array<float,2>{0.174136192f, 0.118192978f},
-std::array<float,2>{0.645129979f, 0.579801679f},
-std::array<float,2>{0.775787354f, 0.483031899f},
-std::array<float,2>{0.280327857f, 0.769440413f},
-std::array<float,2>{0.465789795f, 0.315826535f},
-std::array<float,2>{0.911675274f, 0.936817586f},
-std::array<float,2>{0.577470243f, 0.209703773f},
-std::array<float,2>{0.106679752f, 0.641381502f},
-std::array<float,2>{0.247221634f, 0.296205521f},
-std::array<float,2>{0.719133019f, 0.99728018f},
-std::array<float,2>{0.830865085f, 0.177841127f},
-std::array<float,2>{0.35446462f, 0.689085901f},
-std::array<float,2>{0.403475761f, 0.00929488149f},
-std::array<float,2>{0.985475898f, 0.538133621f},
-std::array<float,2>{0.553365409f, 0.427533269f},
-std::array<float,2>{0.0112042306f, 0.849130154f},
-std::array<float,2>{0.0918116793f, 0.226347804f},
-std::array<float,2>{0.618348837f, 0.66064024f},
-std::array<float,2>{0.886518836f, 0.35347718f},
-std::array<float,2>{0.495677918f, 0.893798411f},
-std::array<float,2>{0.304102272f, 0.462942958f},
-std::array<float,2>{0.782658637f, 0.803860605f},
-std::array<float,2>{0.661720216f, 0.0897416472f},
-std::array<float,2>{0.145857796f, 0.61987108f},
-std::array<float,2>{0.0033922228f, 0.275678635f},
-std::array<float,2>{0.556517363f, 0.93780458f},
-std::array<float,2>{0.995770752f, 0.150540575f},
-std::array<float,2>{0.391486406f, 0.73319298f},
-std::array<float,2>{0.347526133f, 0.0451187007f},
-std::array<float,2>{0.842349291f, 0.512848914f},
-std::array<float,2>{0.732708395f, 0.376469046f},
-std::array<float,2>{0.240337655f, 0.830534875f},
-std::array<float,2>{0.153152972f, 0.211537734f},
-std::array<float,2>{0.664892197f, 0.649739385f},
-std::array<float,2>{0.793574572f, 0.320333838f},
-std::array<float,2>{0.307808429f, 0.921924651f},
-std::array<float,2>{0.490467638f, 0.471493572f},
-std::array<float,2>{0.882062912f, 0.778477907f},
-std::array<float,2>{0.614530206f, 0.110311843f},
-std::array<float,2>{0.0809267238f, 0.588215828f},
-std::array<float,2>{0.218396351f, 0.436576009f},
-std::array<float,2>{0.705692232f, 0.851864159f},
-std::array<float,2>{0.858230293f, 0.00683860667f},
-std::array<float,2>{0.316584647f, 0.544181585f},
-std::array<float,2>{0.419720173f, 0.186943114f},
-std::array<float,2>{0.962042093f, 0.695910275f},
-std::array<float,2>{0.522646725f, 0.285166293f},
-std::array<float,2>{0.0566492304f, 0.98494935f},
-std::array<float,2>{0.0998172909f, 0.0802937225f},
-std::array<float,2>{0.567567945f, 0.61379534f},
-std::array<float,2>{0.916047037f, 0.459846705f},
-std::array<float,2>{0.457847178f, 0.807047665f},
-std::array<float,2>{0.26854372f, 0.345317513f},
-std::array<float,2>{0.766163826f, 0.90398109f},
-std::array<float,2>{0.651878059f, 0.233579144f},
-std::array<float,2>{0.180625752f, 0.667381883f},
-std::array<float,2>{0.0683358833f, 0.443631172f},
-std::array<float,2>{0.60159415f, 0.784966052f},
-std::array<float,2>{0.903851509f, 0.0772457123f},
-std::array<float,2>{0.477062792f, 0.603476465f},
-std::array<float,2>{0.287668884f, 0.24181892f},
-std::array<float,2>{0.804032862f, 0.686538219f},
-std::array<float,2>{0.683909893f, 0.366813809f},
-std::array<float,2>{0.125037223f, 0.887378991f},
-std::array<float,2>{0.221577495f, 0.0175487529f},
-std::array<float,2>{0.744137228f, 0.557732463f},
-std::array<float,2>{0.824789226f, 0.412400424f},
-std::array<float,2>{0.364192694f, 0.862538993f},
-std::array<float,2>{0.385412574f, 0.299341738f},
-std::array<float,2>{0.97303915f, 0.981549025f},
-std::array<float,2>{0.532553196f, 0.167155921f},
-std::array<float,2>{0.0230279155f, 0.703822911f},
-std::array<float,2>{0.17149505f, 0.329661518f},
-std::array<float,2>{0.626948178f, 0.915425181f},
-std::array<float,2>{0.756655157f, 0.197734118f},
-std::array<float,2>{0.258714348f, 0.639439285f},
-std::array<float,2>{0.452538222f, 0.0968458727f},
-std::array<float,2>{0.927161396f, 0.568740427f},
-std::array<float,2>{0.583163977f, 0.491913706f},
-std::array<float,2>{0.113156796f, 0.762744188f},
-std::array<float,2>{0.0424807295f, 0.13299799f},
-std::array<float,2>{0.508253396f, 0.735393345f},
-std::array<float,2>{0.95238167f, 0.255219311f},
-std::array<float,2>{0.428138912f, 0.958721042f},
-std::array<float,2>{0.333166718f, 0.40611288f},
-std::array<float,2>{0.869971693f, 0.824051142f},
-std::array<float,2>{0.689250052f, 0.048200123f},
-std::array<float,2>{0.193662524f, 0.523644507f},
-std::array<float,2>{0.0626915991f, 0.271082103f},
-std::array<float,2>{0.60767597f, 0.946276546f},
-std::array<float,2>{0.901430368f, 0.143404394f},
-std::array<float,2>{0.482050717f, 0.724845648f},
-std::array<float,2>{0.282865614f, 0.0382839106f},
-std::array<float,2>{0.800173759f, 0.502740622f},
-std::array<float,2>{0.681512654f, 0.388804972f},
-std::array<float,2>{0.130751088f, 0.842559874f},
-std::array<float,2>{0.22374557f, 0.206089675f},
-std::array<float,2>{0.746726573f, 0.644680679f},
-std::array<float,2>{0.821730614f, 0.319801718f},
-std::array<float,2>{0.362686306f, 0.933137f},
-std::array<float,2>{0.389482886f, 0.478229016f},
-std::array<float,2>{0.969077051f, 0.771081328f},
-std::array<float,2>{0.538889408f, 0.124683075f},
-std::array<float,2>{0.0174478218f, 0.58368814f},
-std::array<float,2>{0.165138006f, 0.424322903f},
-std::array<float,2>{0.631920278f, 0.845091701f},
-std::array<float,2>{0.753166735f, 0.0141066564f},
-std::array<float,2>{0.264617324f, 0.534333646f},
-std::array<float,2>{0.445851207f, 0.175353169f},
-std::array<float,2>{0.925414324f, 0.69417572f},
-std::array<float,2>{0.58005619f, 0.29031837f},
-std::array<float,2>{0.114122242f, 0.994515717f},
-std::array<float,2>{0.0458317287f, 0.0930071622f},
-std::array<float,2>{0.51464802f, 0.623945415f},
-std::array<float,2>{0.945656955f, 0.467347175f},
-std::array<float,2>{0.422690243f, 0.800594032f},
-std::array<float,2>{0.328738749f, 0.359048933f},
-std::array<float,2>{0.874671638f, 0.896244586f},
-std::array<float,2>{0.692502916f, 0.221466914f},
-std::array<float,2>{0.190859139f, 0.659717798f},
-std::array<float,2>{0.00584951881f, 0.451274306f},
-std::array<float,2>{0.559096336f, 0.790342867f},
-std::array<float,2>{0.996725261f, 0.0634359941f},
-std::array<float,2>{0.397227645f, 0.600080252f},
-std::array<float,2>{0.348356783f, 0.24418816f},
-std::array<float,2>{0.837512255f, 0.674151063f},
-std::array<float,2>{0.728071094f, 0.370323032f},
-std::array<float,2>{0.236750171f, 0.880090058f},
-std::array<float,2>{0.151787445f, 0.0305440091f},
-std::array<float,2>{0.670381725f, 0.548223436f},
-std::array<float,2>{0.790452182f, 0.420209318f},
-std::array<float,2>{0.311580539f, 0.874504149f},
-std::array<float,2>{0.485996753f, 0.306901515f},
-std::array<float,2>{0.87802577f, 0.972163498f},
-std::array<float,2>{0.612234354f, 0.15640606f},
-std::array<float,2>{0.0839338675f, 0.715190947f},
-std::array<float,2>{0.214056805f, 0.336088896f},
-std::array<float,2>{0.709881425f, 0.909537852f},
-std::array<float,2>{0.851617515f, 0.192770347f},
-std::array<float,2>{0.313558668f, 0.62608099f},
-std::array<float,2>{0.415362984f, 0.105336539f},
-std::array<float,2>{0.965135276f, 0.574445069f},
-std::array<float,2>{0.516192198f, 0.497504056f},
-std::array<float,2>{0.0607540607f, 0.750244856f},
-std::array<float,2>{0.0942063257f, 0.131599382f},
-std::array<float,2>{0.565697551f, 0.744376123f},
-std::array<float,2>{0.919479728f, 0.263258964f},
-std::array<float,2>{0.454765737f, 0.968474329f},
-std::array<float,2>{0.269601077f, 0.396085501f},
-std::array<float,2>{0.773170471f, 0.814962685f},
-std::array<float,2>{0.652770162f, 0.0562821254f},
-std::array<float,2>{0.184125125f, 0.520370126f},
-std::array<float,2>{0.0509219244f, 0.359927088f},
-std::array<float,2>{0.523532152f, 0.885570228f},
-std::array<float,2>{0.95928365f, 0.235937327f},
-std::array<float,2>{0.411011845f, 0.67984885f},
-std::array<float,2>{0.320551276f, 0.0711121708f},
-std::array<float,2>{0.848305345f, 0.60879308f},
-std::array<float,2>{0.714889348f, 0.441401005f},
-std::array<float,2>{0.209935024f, 0.78555733f},
-std::array<float,2>{0.178011239f, 0.171093076f},
-std::array<float,2>{0.64233005f, 0.710008681f},
-std::array<float,2>{0.777746499f, 0.303939402f},
-std::array<float,2>{0.276339442f, 0.977154255f},
-std::array<float,2>{0.463151157f, 0.408413351f},
-std::array<float,2>{0.906696916f, 0.866068959f},
-std::array<float,2>{0.572708726f, 0.0221885871f},
-std::array<float,2>{0.102794372f, 0.561076045f},
-std::array<float,2>{0.244090587f, 0.486472994f},
-std::array<float,2>{0.724377692f, 0.759721637f},
-std::array<float,2>{0.833426237f, 0.100719392f},
-std::array<float,2>{0.356848419f, 0.563399076f},
-std::array<float,2>{0.399029255f, 0.201410368f},
-std::array<float,2>{0.989082873f, 0.634264827f},
-std::array<float,2>{0.550392389f, 0.332961023f},
-std::array<float,2>{0.0126367733f, 0.918004155f},
-std::array<float,2>{0.0885184184f, 0.0527396426f},
-std::array<float,2>{0.623612463f, 0.530202568f},
-std::array<float,2>{0.887946963f, 0.398842007f},
-std::array<float,2>{0.499162316f, 0.828030348f},
-std::array<float,2>{0.297035187f, 0.253850073f},
-std::array<float,2>{0.788464844f, 0.955844223f},
-std::array<float,2>{0.658997416f, 0.137982145f},
-std::array<float,2>{0.142374322f, 0.740030706f},
-std::array<float,2>{0.11946445f, 0.38063705f},
-std::array<float,2>{0.587755084f, 0.832841694f},
-std::array<float,2>{0.936928093f, 0.0418188088f},
-std::array<float,2>{0.444132477f, 0.511602521f},
-std::array<float,2>{0.250994802f, 0.155787975f},
-std::array<float,2>{0.759935856f, 0.728523552f},
-std::array<float,2>{0.638693333f, 0.280842096f},
-std::array<float,2>{0.158104271f, 0.94525373f},
-std::array<float,2>{0.20185636f, 0.113507584f},
-std::array<float,2>{0.700740933f, 0.590742111f},
-std::array<float,2>{0.867093682f, 0.474792302f},
-std::array<float,2>{0.336121291f, 0.77407372f},
-std::array<float,2>{0.435427248f, 0.325497419f},
-std::array<float,2>{0.943271279f, 0.929369628f},
-std::array<float,2>{0.50192219f, 0.217800319f},
-std::array<float,2>{0.0379196405f, 0.655465543f},
-std::array<float,2>{0.137847975f, 0.28195852f},
-std::array<float,2>{0.674035072f, 0.989240944f},
-std::array<float,2>{0.810283184f, 0.180279508f},
-std::array<float,2>{0.293499678f, 0.701126575f},
-std::array<float,2>{0.474112689f, 0.00108681864f},
-std::array<float,2>{0.896056175f, 0.542230368f},
-std::array<float,2>{0.596250117f, 0.432483077f},
-std::array<float,2>{0.0723881125f, 0.855600238f},
-std::array<float,2>{0.028362561f, 0.227093354f},
-std::array<float,2>{0.546783268f, 0.668640673f},
-std::array<float,2>{0.978055477f, 0.349339634f},
-std::array<float,2>{0.37720722f, 0.900173426f},
-std::array<float,2>{0.373952836f, 0.454144925f},
-std::array<float,2>{0.817408919f, 0.811078489f},
-std::array<float,2>{0.74029392f, 0.0824490488f},
-std::array<float,2>{0.228641301f, 0.609417617f},
-std::array<float,2>{0.105978921f, 0.313233882f},
-std::array<float,2>{0.57641995f, 0.935190856f},
-std::array<float,2>{0.910323083f, 0.208893791f},
-std::array<float,2>{0.466551542f, 0.644245863f},
-std::array<float,2>{0.279926509f, 0.119803093f},
-std::array<float,2>{0.776573837f, 0.580082297f},
-std::array<float,2>{0.646043837f, 0.482262731f},
-std::array<float,2>{0.175652936f, 0.76645422f},
-std::array<float,2>{0.204588816f, 0.148130119f},
-std::array<float,2>{0.713380992f, 0.719834149f},
-std::array<float,2>{0.84674567f, 0.265803963f},
-std::array<float,2>{0.326279163f, 0.951980174f},
-std::array<float,2>{0.409042984f, 0.385240018f},
-std::array<float,2>{0.9539451f, 0.836190522f},
-std::array<float,2>{0.528110623f, 0.0320732258f},
-std::array<float,2>{0.0506543405f, 0.506601274f},
-std::array<float,2>{0.144900292f, 0.462529182f},
-std::array<float,2>{0.660380542f, 0.802412808f},
-std::array<float,2>{0.782116354f, 0.0872420147f},
-std::array<float,2>{0.303603917f, 0.618026137f},
-std::array<float,2>{0.495055586f, 0.22438772f},
-std::array<float,2>{0.885293901f, 0.663259745f},
-std::array<float,2>{0.61807847f, 0.355288863f},
-std::array<float,2>{0.093298398f, 0.89163363f},
-std::array<float,2>{0.010573593f, 0.0102114165f},
-std::array<float,2>{0.554096282f, 0.535174966f},
-std::array<float,2>{0.985086679f, 0.429458737f},
-std::array<float,2>{0.402559191f, 0.851166964f},
-std::array<float,2>{0.354563057f, 0.294457972f},
-std::array<float,2>{0.831605434f, 0.999838531f},
-std::array<float,2>{0.720236063f, 0.176859498f},
-std::array<float,2>{0.246612087f, 0.690522373f},
-std::array<float,2>{0.0334822312f, 0.414795905f},
-std::array<float,2>{0.507688224f, 0.868152082f},
-std::array<float,2>{0.940910935f, 0.0248551853f},
-std::array<float,2>{0.431980968f, 0.552673042f},
-std::array<float,2>{0.343682736f, 0.163099736f},
-std::array<float,2>{0.862786233f, 0.71333003f},
-std::array<float,2>{0.69581157f, 0.311272323f},
-std::array<float,2>{0.196502253f, 0.972957671f},
-std::array<float,2>{0.162687868f, 0.0684185028f},
-std::array<float,2>{0.634613574f, 0.596522033f},
-std::array<float,2>{0.764339983f, 0.4460271f},
-std::array<float,2>{0.255591482f, 0.796852052f},
-std::array<float,2>{0.437887877f, 0.374720484f},
-std::array<float,2>{0.932862163f, 0.878176272f},
-std::array<float,2>{0.592673957f, 0.249469742f},
-std::array<float,2>{0.123094544f, 0.678044796f},
-std::array<float,2>{0.23395966f, 0.257927001f},
-std::array<float,2>{0.735176921f, 0.961213648f},
-std::array<float,2>{0.814483464f, 0.128133386f},
-std::array<float,2>{0.370499134f, 0.74633193f},
-std::array<float,2>{0.380124241f, 0.0621483661f},
-std::array<float,2>{0.981440306f, 0.516491711f},
-std::array<float,2>{0.542827427f, 0.393674046f},
-std::array<float,2>{0.0234422293f, 0.820069134f},
-std::array<float,2>{0.0762450695f, 0.189875245f},
-std::array<float,2>{0.601186156f, 0.62932539f},
-std::array<float,2>{0.893460333f, 0.341500431f},
-std::array<float,2>{0.472423673f, 0.913063288f},
-std::array<float,2>{0.291193515f, 0.495106995f},
-std::array<float,2>{0.804778695f, 0.754259288f},
-std::array<float,2>{0.677056134f, 0.108178109f},
-std::array<float,2>{0.13482441f, 0.573560536f},
-std::array<float,2>{0.0221467596f, 0.29878056f},
-std::array<float,2>{0.53131783f, 0.983111084f},
-std::array<float,2>{0.973685145f, 0.164549738f},
-std::array<float,2>{0.386718482f, 0.705657482f},
-std::array<float,2>{0.365132183f, 0.0183597021f},
-std::array<float,2>{0.826153457f, 0.556286931f},
-std::array<float,2>{0.742989898f, 0.410535395f},
-std::array<float,2>{0.222571179f, 0.860074043f},
-std::array<float,2>{0.126569435f, 0.239475831f},
-std::array<float,2>{0.684729457f, 0.685426176f},
-std::array<float,2>{0.802926242f, 0.364563972f},
-std::array<float,2>{0.288812548f, 0.889560342f},
-std::array<float,2>{0.477677315f, 0.442487448f},
-std::array<float,2>{0.903290451f, 0.782185256f},
-std::array<float,2>{0.60280329f, 0.0754068792f},
-std::array<float,2>{0.0669167265f, 0.604913771f},
-std::array<float,2>{0.194957897f, 0.403128892f},
-std::array<float,2>{0.68792367f, 0.822153747f},
-std::array<float,2>{0.870752513f, 0.049917642f},
-std::array<float,2>{0.332114428f, 0.527088165f},
-std::array<float,2>{0.429509252f, 0.13618879f},
-std::array<float,2>{0.951197028f, 0.73661536f},
-std::array<float,2>{0.509073079f, 0.256698757f},
-std::array<float,2>{0.0411134288f, 0.960006475f},
-std::array<float,2>{0.112040415f, 0.0941898599f},
-std::array<float,2>{0.582650185f, 0.567870677f},
-std::array<float,2>{0.926594734f, 0.489569962f},
-std::array<float,2>{0.451866925f, 0.765319765f},
-std::array<float,2>{0.259298384f, 0.330954134f},
-std::array<float,2>{0.757211149f, 0.917019129f},
-std::array<float,2>{0.625026584f, 0.19674252f},
-std::array<float,2>{0.170607626f, 0.63785845f},
-std::array<float,2>{0.0813659877f, 0.468822002f},
-std::array<float,2>{0.61399436f, 0.779702842f},
-std::array<float,2>{0.881636322f, 0.112259835f},
-std::array<float,2>{0.492002189f, 0.586598635f},
-std::array<float,2>{0.307000548f, 0.214525133f},
-std::array<float,2>{0.794520915f, 0.652229965f},
-std::array<float,2>{0.665044844f, 0.324061006f},
-std::array<float,2>{0.15347974f, 0.924358845f},
-std::array<float,2>{0.241220906f, 0.0434986651f},
-std::array<float,2>{0.734130085f, 0.51470685f},
-std::array<float,2>{0.843034565f, 0.377996624f},
-std::array<float,2>{0.34580645f, 0.829827487f},
-std::array<float,2>{0.392348409f, 0.274354786f},
-std::array<float,2>{0.994232059f, 0.940914094f},
-std::array<float,2>{0.554767907f, 0.148704514f},
-std::array<float,2>{0.00272030197f, 0.731929541f},
-std::array<float,2>{0.181603581f, 0.346646905f},
-std::array<float,2>{0.650957882f, 0.904313147f},
-std::array<float,2>{0.767140031f, 0.231722519f},
-std::array<float,2>{0.268691272f, 0.664683819f},
-std::array<float,2>{0.45877111f, 0.0785890594f},
-std::array<float,2>{0.917675436f, 0.615436256f},
-std::array<float,2>{0.567369998f, 0.458739221f},
-std::array<float,2>{0.101504222f, 0.806168973f},
-std::array<float,2>{0.0585180409f, 0.185082838f},
-std::array<float,2>{0.521811306f, 0.69845897f},
-std::array<float,2>{0.961397469f, 0.288564444f},
-std::array<float,2>{0.418494076f, 0.987488568f},
-std::array<float,2>{0.317919105f, 0.434771419f},
-std::array<float,2>{0.859076738f, 0.855197966f},
-std::array<float,2>{0.706364095f, 0.00395905459f},
-std::array<float,2>{0.217717379f, 0.545500875f},
-std::array<float,2>{0.116368644f, 0.292537004f},
-std::array<float,2>{0.580240488f, 0.993395865f},
-std::array<float,2>{0.922825515f, 0.17276293f},
-std::array<float,2>{0.448287517f, 0.692199707f},
-std::array<float,2>{0.262640506f, 0.0130819939f},
-std::array<float,2>{0.750412405f, 0.533169389f},
-std::array<float,2>{0.630251169f, 0.422595799f},
-std::array<float,2>{0.166510746f, 0.846881568f},
-std::array<float,2>{0.188553616f, 0.220473051f},
-std::array<float,2>{0.693473279f, 0.657535076f},
-std::array<float,2>{0.873046637f, 0.35582754f},
-std::array<float,2>{0.330499709f, 0.896668911f},
-std::array<float,2>{0.425273985f, 0.465028822f},
-std::array<float,2>{0.948212981f, 0.79719305f},
-std::array<float,2>{0.512729704f, 0.0910487249f},
-std::array<float,2>{0.0446990356f, 0.621527672f},
-std::array<float,2>{0.131844148f, 0.387393147f},
-std::array<float,2>{0.682765663f, 0.839980364f},
-std::array<float,2>{0.797026157f, 0.0358411744f},
-std::array<float,2>{0.283744186f, 0.500837803f},
-std::array<float,2>{0.48266241f, 0.141571149f},
-std::array<float,2>{0.899442434f, 0.724194407f},
-std::array<float,2>{0.605861008f, 0.272844821f},
-std::array<float,2>{0.066115655f, 0.948352039f},
-std::array<float,2>{0.0192171298f, 0.122923017f},
-std::array<float,2>{0.536358297f, 0.584932923f},
-std::array<float,2>{0.970716655f, 0.479519904f},
-std::array<float,2>{0.38789618f, 0.772135794f},
-std::array<float,2>{0.361170024f, 0.318287641f},
-std::array<float,2>{0.822299898f, 0.931300938f},
-std::array<float,2>{0.749946952f, 0.204733863f},
-std::array<float,2>{0.226417705f, 0.64809221f},
-std::array<float,2>{0.0598936193f, 0.498688042f},
-std::array<float,2>{0.519320846f, 0.752050638f},
-std::array<float,2>{0.968459606f, 0.101786472f},
-std::array<float,2>{0.416748613f, 0.576495349f},
-std::array<float,2>{0.315232754f, 0.194828957f},
-std::array<float,2>{0.853744924f, 0.628334939f},
-std::array<float,2>{0.707452774f, 0.339162797f},
-std::array<float,2>{0.211506784f, 0.906295121f},
-std::array<float,2>{0.186750025f, 0.0570595227f},
-std::array<float,2>{0.655412257f, 0.5230003f},
-std::array<float,2>{0.770388663f, 0.398070872f},
-std::array<float,2>{0.272632241f, 0.813930571f},
-std::array<float,2>{0.455581248f, 0.265191078f},
-std::array<float,2>{0.921115458f, 0.966125369f},
-std::array<float,2>{0.56264931f, 0.130246997f},
-std::array<float,2>{0.096875608f, 0.742971838f},
-std::array<float,2>{0.235880539f, 0.368622512f},
-std::array<float,2>{0.729240894f, 0.881968439f},
-std::array<float,2>{0.838775396f, 0.243510649f},
-std::array<float,2>{0.350443989f, 0.67303139f},
-std::array<float,2>{0.395550668f, 0.066102311f},
-std::array<float,2>{0.998302758f, 0.59792763f},
-std::array<float,2>{0.561885417f, 0.450072676f},
-std::array<float,2>{0.00650495151f, 0.791437984f},
-std::array<float,2>{0.0844224021f, 0.159761876f},
-std::array<float,2>{0.609946847f, 0.718175352f},
-std::array<float,2>{0.876434147f, 0.304767221f},
-std::array<float,2>{0.486699849f, 0.968972445f},
-std::array<float,2>{0.310238272f, 0.419027001f},
-std::array<float,2>{0.792922378f, 0.872589886f},
-std::array<float,2>{0.66864413f, 0.0273674764f},
-std::array<float,2>{0.149618581f, 0.549621701f},
-std::array<float,2>{0.0137032801f, 0.334460676f},
-std::array<float,2>{0.547554433f, 0.921022058f},
-std::array<float,2>{0.991971076f, 0.200167984f},
-std::array<float,2>{0.401231796f, 0.635280848f},
-std::array<float,2>{0.358513564f, 0.0977048054f},
-std::array<float,2>{0.835727692f, 0.566105425f},
-std::array<float,2>{0.725835443f, 0.484750241f},
-std::array<float,2>{0.245302826f, 0.761669695f},
-std::array<float,2>{0.143113434f, 0.13929598f},
-std::array<float,2>{0.656607509f, 0.741972029f},
-std::array<float,2>{0.785175085f, 0.250678778f},
-std::array<float,2>{0.299484819f, 0.954113901f},
-std::array<float,2>{0.497570336f, 0.401461184f},
-std::array<float,2>{0.890355706f, 0.825504661f},
-std::array<float,2>{0.621356368f, 0.051483877f},
-std::array<float,2>{0.0868075788f, 0.528192461f},
-std::array<float,2>{0.208580792f, 0.438469857f},
-std::array<float,2>{0.717001021f, 0.788130283f},
-std::array<float,2>{0.849785805f, 0.0724168122f},
-std::array<float,2>{0.322419018f, 0.607018828f},
-std::array<float,2>{0.412688822f, 0.237627551f},
-std::array<float,2>{0.957924962f, 0.683068156f},
-std::array<float,2>{0.526623785f, 0.363094062f},
-std::array<float,2>{0.052766785f, 0.883714378f},
-std::array<float,2>{0.105427451f, 0.0206217803f},
-std::array<float,2>{0.570672989f, 0.559712112f},
-std::array<float,2>{0.90831238f, 0.408177733f},
-std::array<float,2>{0.46241504f, 0.863800704f},
-std::array<float,2>{0.273991674f, 0.301872253f},
-std::array<float,2>{0.779563546f, 0.980444551f},
-std::array<float,2>{0.644207239f, 0.169527471f},
-std::array<float,2>{0.177434027f, 0.708949208f},
-std::array<float,2>{0.0721712336f, 0.430695355f},
-std::array<float,2>{0.593940616f, 0.858350754f},
-std::array<float,2>{0.89765203f, 0.00371561619f},
-std::array<float,2>{0.47552371f, 0.54101485f},
-std::array<float,2>{0.29622221f, 0.181984931f},
-std::array<float,2>{0.812109411f, 0.701465428f},
-std::array<float,2>{0.672633946f, 0.283225f},
-std::array<float,2>{0.139229879f, 0.991615057f},
-std::array<float,2>{0.228356674f, 0.084147118f},
-std::array<float,2>{0.739226043f, 0.611959279f},
-std::array<float,2>{0.81991446f, 0.456393003f},
-std::array<float,2>{0.372138411f, 0.808662653f},
-std::array<float,2>{0.37594223f, 0.350882947f},
-std::array<float,2>{0.98044759f, 0.90107137f},
-std::array<float,2>{0.544264793f, 0.229734123f},
-std::array<float,2>{0.0299917758f, 0.671289802f},
-std::array<float,2>{0.158915147f, 0.278788179f},
-std::array<float,2>{0.63735956f, 0.942903221f},
-std::array<float,2>{0.759323597f, 0.154039502f},
-std::array<float,2>{0.25242734f, 0.727225542f},
-std::array<float,2>{0.442706317f, 0.0393401198f},
-std::array<float,2>{0.935300767f, 0.508651078f},
-std::array<float,2>{0.588782549f, 0.381551385f},
-std::array<float,2>{0.117905311f, 0.83567816f},
-std::array<float,2>{0.0353812985f, 0.216212288f},
-std::array<float,2>{0.503417373f, 0.652386904f},
-std::array<float,2>{0.944152892f, 0.327824444f},
-std::array<float,2>{0.436069369f, 0.926253557f},
-std::array<float,2>{0.338558853f, 0.473968178f},
-std::array<float,2>{0.863927484f, 0.776454926f},
-std::array<float,2>{0.702284634f, 0.116493471f},
-std::array<float,2>{0.201055557f, 0.592129827f},
-std::array<float,2>{0.0907797664f, 0.352223635f},
-std::array<float,2>{0.619653285f, 0.893240869f},
-std::array<float,2>{0.883898795f, 0.224742591f},
-std::array<float,2>{0.492613554f, 0.661360621f},
-std::array<float,2>{0.302013338f, 0.0880456269f},
-std::array<float,2>{0.783810854f, 0.620312035f},
-std::array<float,2>{0.663924158f, 0.464752585f},
-std::array<float,2>{0.147900507f, 0.803006291f},
-std::array<float,2>{0.248741016f, 0.179090992f},
-std::array<float,2>{0.721527755f, 0.687661707f},
-std::array<float,2>{0.828152239f, 0.295632452f},
-std::array<float,2>{0.35197857f, 0.996519327f},
-std::array<float,2>{0.405823082f, 0.425918639f},
-std::array<float,2>{0.988117039f, 0.847888827f},
-std::array<float,2>{0.551245809f, 0.00861781836f},
-std::array<float,2>{0.00892188493f, 0.537244916f},
-std::array<float,2>{0.173386112f, 0.483864367f},
-std::array<float,2>{0.646882057f, 0.768093467f},
-std::array<float,2>{0.775288284f, 0.117876723f},
-std::array<float,2>{0.279120713f, 0.579040468f},
-std::array<float,2>{0.467415184f, 0.210397661f},
-std::array<float,2>{0.913897216f, 0.642089427f},
-std::array<float,2>{0.575019121f, 0.315316051f},
-std::array<float,2>{0.107571676f, 0.935884416f},
-std::array<float,2>{0.0472979955f, 0.0338341445f},
-std::array<float,2>{0.530666292f, 0.505201221f},
-std::array<float,2>{0.955171645f, 0.38289088f},
-std::array<float,2>{0.407481402f, 0.839155853f},
-std::array<float,2>{0.324517608f, 0.267837197f},
-std::array<float,2>{0.844162762f, 0.950482547f},
-std::array<float,2>{0.711952984f, 0.145747557f},
-std::array<float,2>{0.205304652f, 0.721443594f},
-std::array<float,2>{0.0266557131f, 0.39147681f},
-std::array<float,2>{0.539292037f, 0.817471802f},
-std::array<float,2>{0.984278858f, 0.0603756458f},
-std::array<float,2>{0.381236345f, 0.517724156f},
-std::array<float,2>{0.36900416f, 0.126758143f},
-std::array<float,2>{0.814129055f, 0.749635875f},
-std::array<float,2>{0.736862838f, 0.260432959f},
-std::array<float,2>{0.23129718f, 0.964230716f},
-std::array<float,2>{0.133135408f, 0.107217968f},
-std::array<float,2>{0.678659678f, 0.570629656f},
-std::array<float,2>{0.807312191f, 0.492442161f},
-std::array<float,2>{0.289363384f, 0.756110311f},
-std::array<float,2>{0.469419837f, 0.343391985f},
-std::array<float,2>{0.892205834f, 0.911481977f},
-std::array<float,2>{0.599260807f, 0.188504726f},
-std::array<float,2>{0.0747606084f, 0.632749021f},
-std::array<float,2>{0.198216662f, 0.309375286f},
-std::array<float,2>{0.698155522f, 0.975334525f},
-std::array<float,2>{0.860352993f, 0.162082061f},
-std::array<float,2>{0.339915574f, 0.711217761f},
-std::array<float,2>{0.430207103f, 0.0263863541f},
-std::array<float,2>{0.938520253f, 0.553873301f},
-std::array<float,2>{0.504814923f, 0.416602612f},
-std::array<float,2>{0.0325231217f, 0.869184554f},
-std::array<float,2>{0.121938333f, 0.247705624f},
-std::array<float,2>{0.591790259f, 0.676619768f},
-std::array<float,2>{0.930734992f, 0.371182621f},
-std::array<float,2>{0.439661592f, 0.875722468f},
-std::array<float,2>{0.255870104f, 0.448527873f},
-std::array<float,2>{0.762775898f, 0.793044269f},
-std::array<float,2>{0.636204958f, 0.0666042864f},
-std::array<float,2>{0.161022142f, 0.595555961f},
-std::array<float,2>{0.0402180478f, 0.254732817f},
-std::array<float,2>{0.511693716f, 0.957352877f},
-std::array<float,2>{0.949383974f, 0.134567946f},
-std::array<float,2>{0.426329672f, 0.734478414f},
-std::array<float,2>{0.335498363f, 0.0472710989f},
-std::array<float,2>{0.86839962f, 0.524437129f},
-std::array<float,2>{0.689854801f, 0.405071974f},
-std::array<float,2>{0.192216367f, 0.822584152f},
-std::array<float,2>{0.168339878f, 0.198825985f},
-std::array<float,2>{0.627123058f, 0.64006716f},
-std::array<float,2>{0.754709601f, 0.328382105f},
-std::array<float,2>{0.261338562f, 0.914912462f},
-std::array<float,2>{0.450176835f, 0.490548611f},
-std::array<float,2>{0.928032577f, 0.762138128f},
-std::array<float,2>{0.58532089f, 0.0963948816f},
-std::array<float,2>{0.110530265f, 0.569703341f},
-std::array<float,2>{0.21997796f, 0.414011121f},
-std::array<float,2>{0.746038258f, 0.862002015f},
-std::array<float,2>{0.827929318f, 0.0159704015f},
-std::array<float,2>{0.366467088f, 0.557301283f},
-std::array<float,2>{0.383688211f, 0.1661603f},
-std::array<float,2>{0.975284219f, 0.704550385f},
-std::array<float,2>{0.534889817f, 0.300182253f},
-std::array<float,2>{0.0201857779f, 0.980991781f},
-std::array<float,2>{0.0687694177f, 0.0770829692f},
-std::array<float,2>{0.604502678f, 0.601969659f},
-std::array<float,2>{0.904574871f, 0.444406629f},
-std::array<float,2>{0.480240762f, 0.78400588f},
-std::array<float,2>{0.28645277f, 0.365564913f},
-std::array<float,2>{0.801530898f, 0.888363898f},
-std::array<float,2>{0.685999751f, 0.24043484f},
-std::array<float,2>{0.127242163f, 0.686257064f},
-std::array<float,2>{0.098407872f, 0.460475951f},
-std::array<float,2>{0.569432497f, 0.808303118f},
-std::array<float,2>{0.914092958f, 0.0817416161f},
-std::array<float,2>{0.46085149f, 0.614506066f},
-std::array<float,2>{0.266709656f, 0.232594296f},
-std::array<float,2>{0.767824352f, 0.666654527f},
-std::array<float,2>{0.648694992f, 0.344534993f},
-std::array<float,2>{0.183517694f, 0.903165162f},
-std::array<float,2>{0.215538502f, 0.00675325003f},
-std::array<float,2>{0.704272926f, 0.54377073f},
-std::array<float,2>{0.856567025f, 0.435694635f},
-std::array<float,2>{0.318585783f, 0.853078783f},
-std::array<float,2>{0.420191079f, 0.286506295f},
-std::array<float,2>{0.963565111f, 0.986292124f},
-std::array<float,2>{0.519810677f, 0.185812175f},
-std::array<float,2>{0.0564004965f, 0.696766257f},
-std::array<float,2>{0.155577183f, 0.322002113f},
-std::array<float,2>{0.666985214f, 0.923450172f},
-std::array<float,2>{0.795458555f, 0.212002754f},
-std::array<float,2>{0.304934382f, 0.648667693f},
-std::array<float,2>{0.48948434f, 0.110465415f},
-std::array<float,2>{0.880212784f, 0.589401305f},
-std::array<float,2>{0.616211832f, 0.471926481f},
-std::array<float,2>{0.0799692869f, 0.777498603f},
-std::array<float,2>{0.00134500221f, 0.152334884f},
-std::array<float,2>{0.556792796f, 0.733984292f},
-std::array<float,2>{0.993093431f, 0.276812345f},
-std::array<float,2>{0.394016922f, 0.938773751f},
-std::array<float,2>{0.344639391f, 0.375496f},
-std::array<float,2>{0.841245472f, 0.831864893f},
-std::array<float,2>{0.731528342f, 0.0468139537f},
-std::array<float,2>{0.23942925f, 0.511820257f},
-std::array<float,2>{0.10887938f, 0.265923113f},
-std::array<float,2>{0.575323462f, 0.951665163f},
-std::array<float,2>{0.9125067f, 0.148373291f},
-std::array<float,2>{0.467924297f, 0.720141113f},
-std::array<float,2>{0.278228551f, 0.0317855217f},
-std::array<float,2>{0.773752451f, 0.506416678f},
-std::array<float,2>{0.648166656f, 0.384920239f},
-std::array<float,2>{0.172054678f, 0.836107552f},
-std::array<float,2>{0.20677267f, 0.208513826f},
-std::array<float,2>{0.711788058f, 0.644454837f},
-std::array<float,2>{0.845309615f, 0.313171178f},
-std::array<float,2>{0.326104581f, 0.935425222f},
-std::array<float,2>{0.406323224f, 0.482064277f},
-std::array<float,2>{0.95682174f, 0.766302049f},
-std::array<float,2>{0.529911578f, 0.119991928f},
-std::array<float,2>{0.0479909293f, 0.580562413f},
-std::array<float,2>{0.14726226f, 0.429283291f},
-std::array<float,2>{0.663064361f, 0.851379395f},
-std::array<float,2>{0.784632742f, 0.00977424905f},
-std::array<float,2>{0.300896883f, 0.535531521f},
-std::array<float,2>{0.49354136f, 0.17701076f},
-std::array<float,2>{0.883293331f, 0.690766037f},
-std::array<float,2>{0.620805264f, 0.294766724f},
-std::array<float,2>{0.0908230618f, 0.999624252f},
-std::array<float,2>{0.00830526371f, 0.0869970992f},
-std::array<float,2>{0.551863313f, 0.617751718f},
-std::array<float,2>{0.986645341f, 0.462842166f},
-std::array<float,2>{0.404528946f, 0.80268836f},
-std::array<float,2>{0.352607965f, 0.35520494f},
-std::array<float,2>{0.829642475f, 0.892003536f},
-std::array<float,2>{0.722586095f, 0.224274039f},
-std::array<float,2>{0.249493808f, 0.663383484f},
-std::array<float,2>{0.0317589752f, 0.44611457f},
-std::array<float,2>{0.505271196f, 0.796534657f},
-std::array<float,2>{0.937668622f, 0.0688082874f},
-std::array<float,2>{0.430831224f, 0.59632355f},
-std::array<float,2>{0.340930074f, 0.249192446f},
-std::array<float,2>{0.859442055f, 0.677740455f},
-std::array<float,2>{0.699050188f, 0.374897659f},
-std::array<float,2>{0.198617503f, 0.877977014f},
-std::array<float,2>{0.161827296f, 0.024551684f},
-std::array<float,2>{0.634869576f, 0.552316427f},
-std::array<float,2>{0.76177007f, 0.414744526f},
-std::array<float,2>{0.256924182f, 0.867704511f},
-std::array<float,2>{0.440498203f, 0.31134364f},
-std::array<float,2>{0.929948747f, 0.972830474f},
-std::array<float,2>{0.589875758f, 0.163414508f},
-std::array<float,2>{0.122651353f, 0.712981462f},
-std::array<float,2>{0.232133299f, 0.341658533f},
-std::array<float,2>{0.737339854f, 0.912668943f},
-std::array<float,2>{0.812971413f, 0.189578831f},
-std::array<float,2>{0.368077487f, 0.628945649f},
-std::array<float,2>{0.382591039f, 0.107996337f},
-std::array<float,2>{0.983116329f, 0.573462486f},
-std::array<float,2>{0.540241659f, 0.494754434f},
-std::array<float,2>{0.025518043f, 0.753980041f},
-std::array<float,2>{0.0753235891f, 0.128302634f},
-std::array<float,2>{0.598465443f, 0.746514022f},
-std::array<float,2>{0.891490459f, 0.258063436f},
-std::array<float,2>{0.470070243f, 0.960992873f},
-std::array<float,2>{0.290617496f, 0.394040823f},
-std::array<float,2>{0.807638764f, 0.819992363f},
-std::array<float,2>{0.679476261f, 0.0623198338f},
-std::array<float,2>{0.134241149f, 0.516296744f},
-std::array<float,2>{0.0209536012f, 0.364408344f},
-std::array<float,2>{0.533531427f, 0.889388084f},
-std::array<float,2>{0.975641012f, 0.239669189f},
-std::array<float,2>{0.384372473f, 0.685150683f},
-std::array<float,2>{0.366204321f, 0.075674817f},
-std::array<float,2>{0.826555073f, 0.604682863f},
-std::array<float,2>{0.744662464f, 0.442867458f},
-std::array<float,2>{0.21893841f, 0.78197062f},
-std::array<float,2>{0.128354564f, 0.164224491f},
-std::array<float,2>{0.687420905f, 0.705927134f},
-std::array<float,2>{0.802473962f, 0.298430055f},
-std::array<float,2>{0.285301238f, 0.983157754f},
-std::array<float,2>{0.478604704f, 0.410315573f},
-std::array<float,2>{0.905288279f, 0.860170722f},
-std::array<float,2>{0.603633642f, 0.0182338934f},
-std::array<float,2>{0.0695851669f, 0.556563616f},
-std::array<float,2>{0.193018734f, 0.489275753f},
-std::array<float,2>{0.691286325f, 0.765609503f},
-std::array<float,2>{0.867589533f, 0.0938472524f},
-std::array<float,2>{0.33474043f, 0.567549407f},
-std::array<float,2>{0.427634478f, 0.196354806f},
-std::array<float,2>{0.950383782f, 0.638170362f},
-std::array<float,2>{0.509940088f, 0.330604613f},
-std::array<float,2>{0.0396484919f, 0.917356193f},
-std::array<float,2>{0.109375358f, 0.0501100831f},
-std::array<float,2>{0.584071696f, 0.527206302f},
-std::array<float,2>{0.929202795f, 0.402968019f},
-std::array<float,2>{0.450908244f, 0.821965218f},
-std::array<float,2>{0.260372907f, 0.256562322f},
-std::array<float,2>{0.755490184f, 0.960324049f},
-std::array<float,2>{0.6280182f, 0.135859191f},
-std::array<float,2>{0.169636831f, 0.73653686f},
-std::array<float,2>{0.0783208534f, 0.378177643f},
-std::array<float,2>{0.615527093f, 0.830073178f},
-std::array<float,2>{0.879527628f, 0.0439155288f},
-std::array<float,2>{0.489023179f, 0.515034854f},
-std::array<float,2>{0.306172043f, 0.148490041f},
-std::array<float,2>{0.79641825f, 0.731533945f},
-std::array<float,2>{0.667198777f, 0.273958474f},
-std::array<float,2>{0.154693305f, 0.940537035f},
-std::array<float,2>{0.239083886f, 0.111959219f},
-std::array<float,2>{0.730894327f, 0.586862862f},
-std::array<float,2>{0.840329766f, 0.469026357f},
-std::array<float,2>{0.344830662f, 0.779397607f},
-std::array<float,2>{0.392580956f, 0.323872328f},
-std::array<float,2>{0.993822455f, 0.924714088f},
-std::array<float,2>{0.558253944f, 0.214624032f},
-std::array<float,2>{0.000964509614f, 0.65186429f},
-std::array<float,2>{0.18234849f, 0.288094461f},
-std::array<float,2>{0.650104702f, 0.987760663f},
-std::array<float,2>{0.769149721f, 0.185473382f},
-std::array<float,2>{0.265666634f, 0.698600173f},
-std::array<float,2>{0.459912062f, 0.00432937266f},
-std::array<float,2>{0.915112436f, 0.545850933f},
-std::array<float,2>{0.568946719f, 0.434931874f},
-std::array<float,2>{0.0992186666f, 0.855288148f},
-std::array<float,2>{0.0555618256f, 0.231579065f},
-std::array<float,2>{0.521394014f, 0.664976537f},
-std::array<float,2>{0.964756429f, 0.346380681f},
-std::array<float,2>{0.421220809f, 0.904564202f},
-std::array<float,2>{0.3201949f, 0.458847433f},
-std::array<float,2>{0.855508387f, 0.806587994f},
-std::array<float,2>{0.703289151f, 0.0782995075f},
-std::array<float,2>{0.215852648f, 0.615642369f},
-std::array<float,2>{0.0648603812f, 0.31954819f},
-std::array<float,2>{0.606638074f, 0.9333691f},
-std::array<float,2>{0.899199903f, 0.206472799f},
-std::array<float,2>{0.483990282f, 0.644995689f},
-std::array<float,2>{0.284881175f, 0.124909259f},
-std::array<float,2>{0.798008442f, 0.583819568f},
-std::array<float,2>{0.682243526f, 0.478303611f},
-std::array<float,2>{0.131288067f, 0.771393359f},
-std::array<float,2>{0.224941641f, 0.14328149f},
-std::array<float,2>{0.748678565f, 0.725021064f},
-std::array<float,2>{0.823641479f, 0.271391392f},
-std::array<float,2>{0.360273302f, 0.945970118f},
-std::array<float,2>{0.386771888f, 0.389113814f},
-std::array<float,2>{0.971818268f, 0.842415631f},
-std::array<float,2>{0.535345972f, 0.0385582335f},
-std::array<float,2>{0.0178794358f, 0.502585888f},
-std::array<float,2>{0.167627573f, 0.467622668f},
-std::array<float,2>{0.629407763f, 0.800484955f},
-std::array<float,2>{0.751053095f, 0.093228966f},
-std::array<float,2>{0.263233185f, 0.623626888f},
-std::array<float,2>{0.448226362f, 0.221417874f},
-std::array<float,2>{0.92291379f, 0.660098135f},
-std::array<float,2>{0.581939936f, 0.359226644f},
-std::array<float,2>{0.11572656f, 0.896027505f},
-std::array<float,2>{0.043507494f, 0.0137550803f},
-std::array<float,2>{0.51188916f, 0.534621537f},
-std::array<float,2>{0.948303163f, 0.424716324f},
-std::array<float,2>{0.424292624f, 0.84494853f},
-std::array<float,2>{0.331529111f, 0.290196836f},
-std::array<float,2>{0.871431291f, 0.994256616f},
-std::array<float,2>{0.695070624f, 0.175648317f},
-std::array<float,2>{0.187505528f, 0.693913341f},
-std::array<float,2>{0.00762397377f, 0.41998598f},
-std::array<float,2>{0.560909331f, 0.874248683f},
-std::array<float,2>{0.999714315f, 0.0303712618f},
-std::array<float,2>{0.395142972f, 0.547907293f},
-std::array<float,2>{0.351087362f, 0.156616345f},
-std::array<float,2>{0.839421988f, 0.71495235f},
-std::array<float,2>{0.73034972f, 0.306873947f},
-std::array<float,2>{0.234712631f, 0.971899927f},
-std::array<float,2>{0.148954615f, 0.0631304756f},
-std::array<float,2>{0.669780135f, 0.599665225f},
-std::array<float,2>{0.791737795f, 0.451530874f},
-std::array<float,2>{0.308772147f, 0.790119588f},
-std::array<float,2>{0.48827067f, 0.37048769f},
-std::array<float,2>{0.875022471f, 0.880142093f},
-std::array<float,2>{0.61093688f, 0.244547054f},
-std::array<float,2>{0.0853185803f, 0.673875332f},
-std::array<float,2>{0.212547928f, 0.263492882f},
-std::array<float,2>{0.708219528f, 0.968556225f},
-std::array<float,2>{0.854876041f, 0.131409317f},
-std::array<float,2>{0.315719396f, 0.744620681f},
-std::array<float,2>{0.417540461f, 0.056543231f},
-std::array<float,2>{0.967209458f, 0.520179749f},
-std::array<float,2>{0.51824373f, 0.396342844f},
-std::array<float,2>{0.0594334751f, 0.815318525f},
-std::array<float,2>{0.0960693657f, 0.192619607f},
-std::array<float,2>{0.564238667f, 0.62632817f},
-std::array<float,2>{0.920417309f, 0.336407095f},
-std::array<float,2>{0.456526011f, 0.909214079f},
-std::array<float,2>{0.27217868f, 0.497101456f},
-std::array<float,2>{0.771158755f, 0.750137329f},
-std::array<float,2>{0.655217111f, 0.105186641f},
-std::array<float,2>{0.185694352f, 0.574702322f},
-std::array<float,2>{0.0538193583f, 0.303962141f},
-std::array<float,2>{0.525605619f, 0.977377594f},
-std::array<float,2>{0.958684385f, 0.171235174f},
-std::array<float,2>{0.413697243f, 0.710373104f},
-std::array<float,2>{0.323445678f, 0.0223723408f},
-std::array<float,2>{0.851554632f, 0.561456621f},
-std::array<float,2>{0.718538523f, 0.408465475f},
-std::array<float,2>{0.207778707f, 0.865951359f},
-std::array<float,2>{0.17591247f, 0.236106053f},
-std::array<float,2>{0.642769337f, 0.680091262f},
-std::array<float,2>{0.780744672f, 0.360323399f},
-std::array<float,2>{0.274635613f, 0.88541621f},
-std::array<float,2>{0.461301506f, 0.44106853f},
-std::array<float,2>{0.909356415f, 0.785282135f},
-std::array<float,2>{0.571780741f, 0.0710324571f},
-std::array<float,2>{0.104114838f, 0.608641088f},
-std::array<float,2>{0.244357571f, 0.398671031f},
-std::array<float,2>{0.725388408f, 0.827720881f},
-std::array<float,2>{0.834265709f, 0.0530028902f},
-std::array<float,2>{0.358126491f, 0.529788196f},
-std::array<float,2>{0.40221706f, 0.137763336f},
-std::array<float,2>{0.991207898f, 0.73979342f},
-std::array<float,2>{0.548779964f, 0.253427297f},
-std::array<float,2>{0.0146852033f, 0.955584645f},
-std::array<float,2>{0.0871680006f, 0.100895673f},
-std::array<float,2>{0.622742653f, 0.563231707f},
-std::array<float,2>{0.888745904f, 0.486670434f},
-std::array<float,2>{0.496187299f, 0.759487987f},
-std::array<float,2>{0.299811602f, 0.332731396f},
-std::array<float,2>{0.786844313f, 0.918438554f},
-std::array<float,2>{0.658194482f, 0.201630503f},
-std::array<float,2>{0.144263208f, 0.633874238f},
-std::array<float,2>{0.118968979f, 0.475028008f},
-std::array<float,2>{0.58926636f, 0.77440238f},
-std::array<float,2>{0.933712006f, 0.11356134f},
-std::array<float,2>{0.442160487f, 0.590428889f},
-std::array<float,2>{0.253113598f, 0.218019769f},
-std::array<float,2>{0.757828116f, 0.655638874f},
-std::array<float,2>{0.637877762f, 0.325331092f},
-std::array<float,2>{0.159733117f, 0.929535031f},
-std::array<float,2>{0.199790746f, 0.0417456776f},
-std::array<float,2>{0.701439261f, 0.511471152f},
-std::array<float,2>{0.865084112f, 0.38052091f},
-std::array<float,2>{0.33948788f, 0.832600415f},
-std::array<float,2>{0.436908603f, 0.281220883f},
-std::array<float,2>{0.944784403f, 0.944883287f},
-std::array<float,2>{0.502512813f, 0.156200826f},
-std::array<float,2>{0.0366099477f, 0.728815556f},
-std::array<float,2>{0.140015081f, 0.34960115f},
-std::array<float,2>{0.673396766f, 0.899990857f},
-std::array<float,2>{0.810969949f, 0.227493241f},
-std::array<float,2>{0.295127273f, 0.668832481f},
-std::array<float,2>{0.476452321f, 0.0820509791f},
-std::array<float,2>{0.896743894f, 0.609830141f},
-std::array<float,2>{0.594780147f, 0.454378098f},
-std::array<float,2>{0.0705394894f, 0.811377943f},
-std::array<float,2>{0.0311698783f, 0.180541441f},
-std::array<float,2>{0.543474138f, 0.700880229f},
-std::array<float,2>{0.978676915f, 0.282033712f},
-std::array<float,2>{0.376252323f, 0.988838136f},
-std::array<float,2>{0.371703297f, 0.432291895f},
-std::array<float,2>{0.81913358f, 0.85572511f},
-std::array<float,2>{0.739310682f, 0.00141420343f},
-std::array<float,2>{0.226670444f, 0.542446494f},
-std::array<float,2>{0.092611149f, 0.295855641f},
-std::array<float,2>{0.618778288f, 0.996134579f},
-std::array<float,2>{0.886153877f, 0.178917423f},
-std::array<float,2>{0.495595962f, 0.687940359f},
-std::array<float,2>{0.304263175f, 0.00852625072f},
-std::array<float,2>{0.782984376f, 0.537559927f},
-std::array<float,2>{0.661539376f, 0.426194698f},
-std::array<float,2>{0.146335647f, 0.848077178f},
-std::array<float,2>{0.248008877f, 0.225029379f},
-std::array<float,2>{0.719611883f, 0.661441147f},
-std::array<float,2>{0.830447316f, 0.352521062f},
-std::array<float,2>{0.353865057f, 0.893420041f},
-std::array<float,2>{0.404161543f, 0.464451939f},
-std::array<float,2>{0.986012161f, 0.802944601f},
-std::array<float,2>{0.55301106f, 0.0881437734f},
-std::array<float,2>{0.0114987912f, 0.620495677f},
-std::array<float,2>{0.174393371f, 0.383155733f},
-std::array<float,2>{0.644757271f, 0.839000702f},
-std::array<float,2>{0.776199281f, 0.0339599065f},
-std::array<float,2>{0.281038225f, 0.505075514f},
-std::array<float,2>{0.465131104f, 0.145955965f},
-std::array<float,2>{0.911373734f, 0.721255004f},
-std::array<float,2>{0.577824712f, 0.267645568f},
-std::array<float,2>{0.107064538f, 0.950313687f},
-std::array<float,2>{0.0493123792f, 0.117942646f},
-std::array<float,2>{0.528903663f, 0.578738391f},
-std::array<float,2>{0.954312384f, 0.483416408f},
-std::array<float,2>{0.409777671f, 0.768435001f},
-std::array<float,2>{0.32806164f, 0.315058738f},
-std::array<float,2>{0.84641552f, 0.935640872f},
-std::array<float,2>{0.714297414f, 0.210191786f},
-std::array<float,2>{0.203238904f, 0.641624212f},
-std::array<float,2>{0.0248148348f, 0.492227972f},
-std::array<float,2>{0.541717649f, 0.756102204f},
-std::array<float,2>{0.982334197f, 0.106985509f},
-std::array<float,2>{0.379213929f, 0.570445776f},
-std::array<float,2>{0.369563729f, 0.188854113f},
-std::array<float,2>{0.815778375f, 0.632508814f},
-std::array<float,2>{0.735818624f, 0.343613923f},
-std::array<float,2>{0.232998133f, 0.91137445f},
-std::array<float,2>{0.136543423f, 0.0602829345f},
-std::array<float,2>{0.676428318f, 0.51803422f},
-std::array<float,2>{0.806619585f, 0.391322196f},
-std::array<float,2>{0.292254031f, 0.817717493f},
-std::array<float,2>{0.471632987f, 0.260586917f},
-std::array<float,2>{0.894265771f, 0.963888288f},
-std::array<float,2>{0.600294292f, 0.126708657f},
-std::array<float,2>{0.0779670179f, 0.749771655f},
-std::array<float,2>{0.196114063f, 0.371393055f},
-std::array<float,2>{0.696553707f, 0.875953734f},
-std::array<float,2>{0.862301648f, 0.247917682f},
-std::array<float,2>{0.342529237f, 0.676483452f},
-std::array<float,2>{0.433000505f, 0.0666519776f},
-std::array<float,2>{0.940243244f, 0.595400631f},
-std::array<float,2>{0.506640017f, 0.448341668f},
-std::array<float,2>{0.0342512429f, 0.793373287f},
-std::array<float,2>{0.124452077f, 0.161665007f},
-std::array<float,2>{0.592901468f, 0.7109707f},
-std::array<float,2>{0.931705296f, 0.309323132f},
-std::array<float,2>{0.439341068f, 0.975368857f},
-std::array<float,2>{0.254842013f, 0.416946024f},
-std::array<float,2>{0.764991641f, 0.869584918f},
-std::array<float,2>{0.633785307f, 0.0267081242f},
-std::array<float,2>{0.163347408f, 0.554189503f},
-std::array<float,2>{0.0423965566f, 0.328167737f},
-std::array<float,2>{0.508535504f, 0.914553165f},
-std::array<float,2>{0.952871919f, 0.199133843f},
-std::array<float,2>{0.428678304f, 0.639885843f},
-std::array<float,2>{0.33350566f, 0.0966159627f},
-std::array<float,2>{0.86962378f, 0.569381952f},
-std::array<float,2>{0.688495576f, 0.490321338f},
-std::array<float,2>{0.193986446f, 0.761873901f},
-std::array<float,2>{0.171050668f, 0.134482443f},
-std::array<float,2>{0.626034856f, 0.734835446f},
-std::array<float,2>{0.755906522f, 0.254434705f},
-std::array<float,2>{0.25819537f, 0.957042098f},
-std::array<float,2>{0.453090429f, 0.404887319f},
-std::array<float,2>{0.927621603f, 0.822380722f},
-std::array<float,2>{0.583938122f, 0.0468807407f},
-std::array<float,2>{0.112495124f, 0.524662435f},
-std::array<float,2>{0.221106902f, 0.444723219f},
-std::array<float,2>{0.743546724f, 0.783732653f},
-std::array<float,2>{0.824455261f, 0.0767302066f},
-std::array<float,2>{0.363752723f, 0.60161376f},
-std::array<float,2>{0.385172457f, 0.240532294f},
-std::array<float,2>{0.973496437f, 0.686357319f},
-std::array<float,2>{0.533120751f, 0.36533013f},
-std::array<float,2>{0.0227722507f, 0.888549507f},
-std::array<float,2>{0.0676427409f, 0.0157122593f},
-std::array<float,2>{0.602438033f, 0.557540894f},
-std::array<float,2>{0.903600812f, 0.41363731f},
-std::array<float,2>{0.476888895f, 0.862089932f},
-std::array<float,2>{0.28716293f, 0.29994154f},
-std::array<float,2>{0.804599941f, 0.981337965f},
-std::array<float,2>{0.684554935f, 0.166386262f},
-std::array<float,2>{0.125639215f, 0.704327524f},
-std::array<float,2>{0.100395985f, 0.435820192f},
-std::array<float,2>{0.568123043f, 0.85329771f},
-std::array<float,2>{0.916950345f, 0.00635599624f},
-std::array<float,2>{0.457050115f, 0.543643177f},
-std::array<float,2>{0.267985463f, 0.185605824f},
-std::array<float,2>{0.765837789f, 0.696373224f},
-std::array<float,2>{0.651625395f, 0.286168367f},
-std::array<float,2>{0.179991186f, 0.985974371f},
-std::array<float,2>{0.217952356f, 0.0819083974f},
-std::array<float,2>{0.705127537f, 0.614277661f},
-std::array<float,2>{0.857558787f, 0.460827053f},
-std::array<float,2>{0.31726107f, 0.808491528f},
-std::array<float,2>{0.419244438f, 0.344296604f},
-std::array<float,2>{0.962811828f, 0.902839482f},
-std::array<float,2>{0.523273766f, 0.232823581f},
-std::array<float,2>{0.0571604334f, 0.666769028f},
-std::array<float,2>{0.152407527f, 0.276509821f},
-std::array<float,2>{0.664263904f, 0.938686728f},
-std::array<float,2>{0.793366611f, 0.151921049f},
-std::array<float,2>{0.308205664f, 0.73437053f},
-std::array<float,2>{0.49073863f, 0.0465701409f},
-std::array<float,2>{0.882594705f, 0.512156904f},
-std::array<float,2>{0.614929676f, 0.375888944f},
-std::array<float,2>{0.0801503137f, 0.831668615f},
-std::array<float,2>{0.0035023836f, 0.212377772f},
-std::array<float,2>{0.555811584f, 0.648779333f},
-std::array<float,2>{0.995130181f, 0.322193384f},
-std::array<float,2>{0.390910089f, 0.923612058f},
-std::array<float,2>{0.346778691f, 0.471733779f},
-std::array<float,2>{0.841882646f, 0.777773023f},
-std::array<float,2>{0.733230591f, 0.110752977f},
-std::array<float,2>{0.241044194f, 0.58965987f},
-std::array<float,2>{0.114524364f, 0.355493218f},
-std::array<float,2>{0.578503966f, 0.896813989f},
-std::array<float,2>{0.924651623f, 0.220387951f},
-std::array<float,2>{0.447086543f, 0.657313704f},
-std::array<float,2>{0.264982492f, 0.091233246f},
-std::array<float,2>{0.752622187f, 0.621222496f},
-std::array<float,2>{0.631159484f, 0.465288132f},
-std::array<float,2>{0.164195687f, 0.797042191f},
-std::array<float,2>{0.189485624f, 0.172425747f},
-std::array<float,2>{0.691616535f, 0.691945732f},
-std::array<float,2>{0.874004304f, 0.292728573f},
-std::array<float,2>{0.329715848f, 0.993572593f},
-std::array<float,2>{0.422905743f, 0.422795206f},
-std::array<float,2>{0.94697243f, 0.847115874f},
-std::array<float,2>{0.515411735f, 0.0127116907f},
-std::array<float,2>{0.0464681573f, 0.532842934f},
-std::array<float,2>{0.129649118f, 0.479926616f},
-std::array<float,2>{0.680369198f, 0.77244693f},
-std::array<float,2>{0.799322486f, 0.122624889f},
-std::array<float,2>{0.281563371f, 0.584473312f},
-std::array<float,2>{0.481187642f, 0.204975456f},
-std::array<float,2>{0.901115f, 0.648248672f},
-std::array<float,2>{0.608620465f, 0.317882895f},
-std::array<float,2>{0.0640592501f, 0.931585073f},
-std::array<float,2>{0.0156846028f, 0.0359317511f},
-std::array<float,2>{0.537772596f, 0.500523686f},
-std::array<float,2>{0.969796538f, 0.387665391f},
-std::array<float,2>{0.389680117f, 0.84018594f},
-std::array<float,2>{0.361779571f, 0.272691339f},
-std::array<float,2>{0.820631683f, 0.94857955f},
-std::array<float,2>{0.747615457f, 0.141262159f},
-std::array<float,2>{0.222897276f, 0.724469483f},
-std::array<float,2>{0.0624704435f, 0.398217022f},
-std::array<float,2>{0.517096579f, 0.813669562f},
-std::array<float,2>{0.965967f, 0.0568244494f},
-std::array<float,2>{0.414096385f, 0.52323401f},
-std::array<float,2>{0.313078433f, 0.129895449f},
-std::array<float,2>{0.853330672f, 0.742824197f},
-std::array<float,2>{0.710687995f, 0.265494049f},
-std::array<float,2>{0.213864505f, 0.9660272f},
-std::array<float,2>{0.184777707f, 0.102010474f},
-std::array<float,2>{0.653920472f, 0.57619673f},
-std::array<float,2>{0.772119641f, 0.498979449f},
-std::array<float,2>{0.271216691f, 0.752281785f},
-std::array<float,2>{0.453168899f, 0.338968962f},
-std::array<float,2>{0.918088555f, 0.906677604f},
-std::array<float,2>{0.564598799f, 0.195122331f},
-std::array<float,2>{0.0952723622f, 0.627930343f},
-std::array<float,2>{0.237429827f, 0.305096865f},
-std::array<float,2>{0.727527201f, 0.969224095f},
-std::array<float,2>{0.836070955f, 0.160088316f},
-std::array<float,2>{0.349054247f, 0.717841148f},
-std::array<float,2>{0.397943944f, 0.0278173145f},
-std::array<float,2>{0.997698724f, 0.549344897f},
-std::array<float,2>{0.560269356f, 0.419246763f},
-std::array<float,2>{0.00411645137f, 0.873010576f},
-std::array<float,2>{0.0823840201f, 0.2433974f},
-std::array<float,2>{0.613215983f, 0.673263907f},
-std::array<float,2>{0.877261221f, 0.368372828f},
-std::array<float,2>{0.484433442f, 0.882289529f},
-std::array<float,2>{0.310843199f, 0.449770957f},
-std::array<float,2>{0.789504826f, 0.791050017f},
-std::array<float,2>{0.671581447f, 0.0662787333f},
-std::array<float,2>{0.150464773f, 0.597865999f},
-std::array<float,2>{0.0130595444f, 0.2508398f},
-std::array<float,2>{0.549015999f, 0.954564512f},
-std::array<float,2>{0.9896608f, 0.139419019f},
-std::array<float,2>{0.399716496f, 0.741804004f},
-std::array<float,2>{0.355786562f, 0.0515742674f},
-std::array<float,2>{0.832748413f, 0.527902246f},
-std::array<float,2>{0.723336458f, 0.401839316f},
-std::array<float,2>{0.242492944f, 0.825273514f},
-std::array<float,2>{0.141368359f, 0.199854687f},
-std::array<float,2>{0.660084307f, 0.635552645f},
-std::array<float,2>{0.787753522f, 0.334191322f},
-std::array<float,2>{0.298525453f, 0.921158552f},
-std::array<float,2>{0.498128206f, 0.484582782f},
-std::array<float,2>{0.887214899f, 0.761383772f},
-std::array<float,2>{0.624126732f, 0.0980020761f},
-std::array<float,2>{0.0890000463f, 0.566360295f},
-std::array<float,2>{0.210730374f, 0.40779987f},
-std::array<float,2>{0.715984643f, 0.864100575f},
-std::array<float,2>{0.848968625f, 0.0209002215f},
-std::array<float,2>{0.322150648f, 0.559835792f},
-std::array<float,2>{0.412040204f, 0.169834524f},
-std::array<float,2>{0.960121334f, 0.708703339f},
-std::array<float,2>{0.525210798f, 0.302203f},
-std::array<float,2>{0.0523546673f, 0.980006814f},
-std::array<float,2>{0.102240384f, 0.0726997629f},
-std::array<float,2>{0.573461711f, 0.607420981f},
-std::array<float,2>{0.907580018f, 0.438066334f},
-std::array<float,2>{0.464499474f, 0.788470268f},
-std::array<float,2>{0.276748985f, 0.362992793f},
-std::array<float,2>{0.778386176f, 0.883331239f},
-std::array<float,2>{0.641031623f, 0.23732847f},
-std::array<float,2>{0.179123297f, 0.682648659f},
-std::array<float,2>{0.0735244304f, 0.45629859f},
-std::array<float,2>{0.597066402f, 0.809035063f},
-std::array<float,2>{0.895013452f, 0.0843317136f},
-std::array<float,2>{0.472665131f, 0.612166584f},
-std::array<float,2>{0.294554502f, 0.229822934f},
-std::array<float,2>{0.809068561f, 0.670967579f},
-std::array<float,2>{0.675521791f, 0.350643009f},
-std::array<float,2>{0.137434497f, 0.901243865f},
-std::array<float,2>{0.23037149f, 0.00354799978f},
-std::array<float,2>{0.741651416f, 0.540551305f},
-std::array<float,2>{0.816496551f, 0.430923909f},
-std::array<float,2>{0.374098063f, 0.858153224f},
-std::array<float,2>{0.378112793f, 0.283628374f},
-std::array<float,2>{0.976867557f, 0.99141705f},
-std::array<float,2>{0.545398176f, 0.181880847f},
-std::array<float,2>{0.0275896918f, 0.70120734f},
-std::array<float,2>{0.157084554f, 0.327983916f},
-std::array<float,2>{0.640216112f, 0.925961792f},
-std::array<float,2>{0.761217058f, 0.215945765f},
-std::array<float,2>{0.250210792f, 0.652609408f},
-std::array<float,2>{0.445188165f, 0.116313986f},
-std::array<float,2>{0.935777128f, 0.591908753f},
-std::array<float,2>{0.5867998f, 0.473755926f},
-std::array<float,2>{0.120399013f, 0.7768538f},
-std::array<float,2>{0.0387427583f, 0.154094845f},
-std::array<float,2>{0.500383198f, 0.727325737f},
-std::array<float,2>{0.942085087f, 0.278471917f},
-std::array<float,2>{0.433729529f, 0.943212271f},
-std::array<float,2>{0.337412626f, 0.381718665f},
-std::array<float,2>{0.865326464f, 0.835722506f},
-std::array<float,2>{0.699600041f, 0.0392064378f},
-std::array<float,2>{0.203120992f, 0.508428454f},
-std::array<float,2>{0.0768025443f, 0.259288102f},
-std::array<float,2>{0.600928962f, 0.962524712f},
-std::array<float,2>{0.892799318f, 0.127316445f},
-std::array<float,2>{0.471910328f, 0.747844636f},
-std::array<float,2>{0.291649401f, 0.0614618771f},
-std::array<float,2>{0.805316687f, 0.516905963f},
-std::array<float,2>{0.677311778f, 0.39316982f},
-std::array<float,2>{0.135487229f, 0.81861496f},
-std::array<float,2>{0.233622864f, 0.190795124f},
-std::array<float,2>{0.734796703f, 0.630645037f},
-std::array<float,2>{0.814971626f, 0.340692282f},
-std::array<float,2>{0.370760024f, 0.914035439f},
-std::array<float,2>{0.380454391f, 0.495319963f},
-std::array<float,2>{0.980647564f, 0.755398631f},
-std::array<float,2>{0.542243183f, 0.108511999f},
-std::array<float,2>{0.0240376331f, 0.57259357f},
-std::array<float,2>{0.162290484f, 0.415393382f},
-std::array<float,2>{0.633937776f, 0.869098008f},
-std::array<float,2>{0.76389122f, 0.0237237141f},
-std::array<float,2>{0.254933715f, 0.550811946f},
-std::array<float,2>{0.438221604f, 0.162806377f},
-std::array<float,2>{0.933260322f, 0.714719057f},
-std::array<float,2>{0.592218697f, 0.311747015f},
-std::array<float,2>{0.123911865f, 0.973999262f},
-std::array<float,2>{0.0338091701f, 0.0695141256f},
-std::array<float,2>{0.507094443f, 0.597653687f},
-std::array<float,2>{0.9409343f, 0.446310818f},
-std::array<float,2>{0.432309657f, 0.795528114f},
-std::array<float,2>{0.343188316f, 0.373283029f},
-std::array<float,2>{0.863256872f, 0.877790391f},
-std::array<float,2>{0.695382059f, 0.248598874f},
-std::array<float,2>{0.19695127f, 0.679253042f},
-std::array<float,2>{0.0101680821f, 0.461119711f},
-std::array<float,2>{0.554338217f, 0.801282525f},
-std::array<float,2>{0.984650254f, 0.0860227495f},
-std::array<float,2>{0.403275013f, 0.618661761f},
-std::array<float,2>{0.355394125f, 0.223305255f},
-std::array<float,2>{0.8312608f, 0.662392259f},
-std::array<float,2>{0.720202565f, 0.354266018f},
-std::array<float,2>{0.246229023f, 0.89129436f},
-std::array<float,2>{0.145290837f, 0.0117024221f},
-std::array<float,2>{0.660826743f, 0.537043273f},
-std::array<float,2>{0.781517327f, 0.428591222f},
-std::array<float,2>{0.302739322f, 0.850576878f},
-std::array<float,2>{0.494556725f, 0.29319331f},
-std::array<float,2>{0.884776652f, 0.9980793f},
-std::array<float,2>{0.61721158f, 0.176124856f},
-std::array<float,2>{0.0929797366f, 0.690080702f},
-std::array<float,2>{0.205007106f, 0.313691139f},
-std::array<float,2>{0.713148832f, 0.93391341f},
-std::array<float,2>{0.847179055f, 0.207472056f},
-std::array<float,2>{0.326691985f, 0.643088818f},
-std::array<float,2>{0.408488065f, 0.120453916f},
-std::array<float,2>{0.953155458f, 0.581838727f},
-std::array<float,2>{0.527676761f, 0.480795503f},
-std::array<float,2>{0.050173074f, 0.767471969f},
-std::array<float,2>{0.105846882f, 0.146509126f},
-std::array<float,2>{0.57691586f, 0.719222963f},
-std::array<float,2>{0.910912752f, 0.26725772f},
-std::array<float,2>{0.46630317f, 0.952639163f},
-std::array<float,2>{0.279643804f, 0.385829687f},
-std::array<float,2>{0.77714777f, 0.836965263f},
-std::array<float,2>{0.645880699f, 0.0327641964f},
-std::array<float,2>{0.174917281f, 0.507007241f},
-std::array<float,2>{0.0580411591f, 0.347215146f},
-std::array<float,2>{0.52231127f, 0.90615654f},
-std::array<float,2>{0.961634398f, 0.230834469f},
-std::array<float,2>{0.418098003f, 0.665985405f},
-std::array<float,2>{0.31761083f, 0.0797593892f},
-std::array<float,2>{0.85863477f, 0.616654277f},
-std::array<float,2>{0.706787407f, 0.457379162f},
-std::array<float,2>{0.217222527f, 0.804849148f},
-std::array<float,2>{0.180901706f, 0.184018493f},
-std::array<float,2>{0.650742948f, 0.697889745f},
-std::array<float,2>{0.766998947f, 0.287551969f},
-std::array<float,2>{0.269499958f, 0.986422122f},
-std::array<float,2>{0.458069056f, 0.434028924f},
-std::array<float,2>{0.917089343f, 0.853981197f},
-std::array<float,2>{0.566624343f, 0.00522137899f},
-std::array<float,2>{0.100971855f, 0.546031535f},
-std::array<float,2>{0.242028639f, 0.469952673f},
-std::array<float,2>{0.733838856f, 0.780881584f},
-std::array<float,2>{0.843492448f, 0.11315506f},
-std::array<float,2>{0.346326828f, 0.587513983f},
-std::array<float,2>{0.391862571f, 0.213332981f},
-std::array<float,2>{0.99492842f, 0.650883555f},
-std::array<float,2>{0.555291235f, 0.323159516f},
-std::array<float,2>{0.00212292885f, 0.924954355f},
-std::array<float,2>{0.0816309527f, 0.0442384444f},
-std::array<float,2>{0.613691866f, 0.5145365f},
-std::array<float,2>{0.881223619f, 0.377267629f},
-std::array<float,2>{0.491513819f, 0.828129292f},
-std::array<float,2>{0.30734998f, 0.274432838f},
-std::array<float,2>{0.794143617f, 0.940182209f},
-std::array<float,2>{0.666015387f, 0.14979361f},
-std::array<float,2>{0.153999954f, 0.730874062f},
-std::array<float,2>{0.111753531f, 0.403457016f},
-std::array<float,2>{0.582164109f, 0.821176171f},
-std::array<float,2>{0.925946116f, 0.0495311543f},
-std::array<float,2>{0.451636255f, 0.525394976f},
-std::array<float,2>{0.258979201f, 0.134792238f},
-std::array<float,2>{0.757577956f, 0.737797916f},
-std::array<float,2>{0.62568903f, 0.256918311f},
-std::array<float,2>{0.169975758f, 0.959782541f},
-std::array<float,2>{0.194616929f, 0.0952318758f},
-std::array<float,2>{0.688116789f, 0.566898048f},
-std::array<float,2>{0.870435715f, 0.489123911f},
-std::array<float,2>{0.332994848f, 0.764392614f},
-std::array<float,2>{0.428980112f, 0.331299394f},
-std::array<float,2>{0.95178932f, 0.91630584f},
-std::array<float,2>{0.509748757f, 0.195898056f},
-std::array<float,2>{0.0418591313f, 0.637285352f},
-std::array<float,2>{0.126398161f, 0.297534436f},
-std::array<float,2>{0.68529886f, 0.983733416f},
-std::array<float,2>{0.803582668f, 0.165251389f},
-std::array<float,2>{0.288100153f, 0.706106484f},
-std::array<float,2>{0.478096843f, 0.0188417342f},
-std::array<float,2>{0.902508974f, 0.554859996f},
-std::array<float,2>{0.603274703f, 0.411819667f},
-std::array<float,2>{0.0664991066f, 0.860512614f},
-std::array<float,2>{0.0216482468f, 0.238999769f},
-std::array<float,2>{0.531772792f, 0.684312344f},
-std::array<float,2>{0.974130094f, 0.364204705f},
-std::array<float,2>{0.385896116f, 0.8901847f},
-std::array<float,2>{0.36461252f, 0.441451997f},
-std::array<float,2>{0.825558603f, 0.782743692f},
-std::array<float,2>{0.742622614f, 0.0743427947f},
-std::array<float,2>{0.221958891f, 0.60358423f},
-std::array<float,2>{0.0944258049f, 0.337389857f},
-std::array<float,2>{0.566238105f, 0.909071803f},
-std::array<float,2>{0.919045389f, 0.192094147f},
-std::array<float,2>{0.454221457f, 0.62525183f},
-std::array<float,2>{0.270267814f, 0.104155719f},
-std::array<float,2>{0.772477925f, 0.575206339f},
-std::array<float,2>{0.653093636f, 0.497059703f},
-std::array<float,2>{0.183925673f, 0.751104653f},
-std::array<float,2>{0.214770421f, 0.132515013f},
-std::array<float,2>{0.709185362f, 0.745238364f},
-std::array<float,2>{0.852494836f, 0.261996001f},
-std::array<float,2>{0.314140141f, 0.967121124f},
-std::array<float,2>{0.415615529f, 0.395262301f},
-std::array<float,2>{0.965536594f, 0.816209972f},
-std::array<float,2>{0.515687764f, 0.0553904995f},
-std::array<float,2>{0.0614897944f, 0.521037757f},
-std::array<float,2>{0.152064472f, 0.452603459f},
-std::array<float,2>{0.670553565f, 0.789112687f},
-std::array<float,2>{0.790973544f, 0.0636894777f},
-std::array<float,2>{0.3124111f, 0.600735962f},
-std::array<float,2>{0.485748053f, 0.245680943f},
-std::array<float,2>{0.878757656f, 0.67548579f},
-std::array<float,2>{0.611808717f, 0.369532585f},
-std::array<float,2>{0.0833076462f, 0.879741788f},
-std::array<float,2>{0.00532437395f, 0.029447373f},
-std::array<float,2>{0.559030175f, 0.547330022f},
-std::array<float,2>{0.996208012f, 0.420983672f},
-std::array<float,2>{0.396553934f, 0.873181403f},
-std::array<float,2>{0.347813994f, 0.308239281f},
-std::array<float,2>{0.836940169f, 0.9708094f},
-std::array<float,2>{0.727814257f, 0.157587275f},
-std::array<float,2>{0.237179786f, 0.716284215f},
-std::array<float,2>{0.0453302786f, 0.425157666f},
-std::array<float,2>{0.513748109f, 0.844566464f},
-std::array<float,2>{0.946061492f, 0.0152742639f},
-std::array<float,2>{0.422343701f, 0.533616543f},
-std::array<float,2>{0.328515291f, 0.174316168f},
-std::array<float,2>{0.874205053f, 0.695288002f},
-std::array<float,2>{0.693093121f, 0.290021092f},
-std::array<float,2>{0.191014454f, 0.995298982f},
-std::array<float,2>{0.165714979f, 0.09250319f},
-std::array<float,2>{0.632764816f, 0.624869227f},
-std::array<float,2>{0.753808975f, 0.468108922f},
-std::array<float,2>{0.263689548f, 0.799508929f},
-std::array<float,2>{0.44548285f, 0.357759893f},
-std::array<float,2>{0.925052404f, 0.895371497f},
-std::array<float,2>{0.579326212f, 0.221871212f},
-std::array<float,2>{0.113294303f, 0.658964455f},
-std::array<float,2>{0.224503517f, 0.27014184f},
-std::array<float,2>{0.74609828f, 0.946984887f},
-std::array<float,2>{0.822264969f, 0.143990323f},
-std::array<float,2>{0.363003701f, 0.725810409f},
-std::array<float,2>{0.388946503f, 0.0377099589f},
-std::array<float,2>{0.969603658f, 0.503818691f},
-std::array<float,2>{0.538543582f, 0.390205115f},
-std::array<float,2>{0.0169253498f, 0.843460679f},
-std::array<float,2>{0.0631276742f, 0.205090716f},
-std::array<float,2>{0.608394742f, 0.64597249f},
-std::array<float,2>{0.902239203f, 0.318517506f},
-std::array<float,2>{0.481902748f, 0.931779027f},
-std::array<float,2>{0.282313585f, 0.477156788f},
-std::array<float,2>{0.800472736f, 0.770489693f},
-std::array<float,2>{0.681093872f, 0.123309366f},
-std::array<float,2>{0.130075723f, 0.582354188f},
-std::array<float,2>{0.0288282949f, 0.282398731f},
-std::array<float,2>{0.546304107f, 0.989919543f},
-std::array<float,2>{0.978011727f, 0.181606635f},
-std::array<float,2>{0.377687961f, 0.699600697f},
-std::array<float,2>{0.373241037f, 8.80880034e-05f},
-std::array<float,2>{0.817914486f, 0.541944504f},
-std::array<float,2>{0.740753114f, 0.432923228f},
-std::array<float,2>{0.229060501f, 0.856610715f},
-std::array<float,2>{0.138204738f, 0.227694452f},
-std::array<float,2>{0.674598217f, 0.669314325f},
-std::array<float,2>{0.81001687f, 0.347673565f},
-std::array<float,2>{0.293404251f, 0.898585975f},
-std::array<float,2>{0.474387765f, 0.453772187f},
-std::array<float,2>{0.895515859f, 0.812371194f},
-std::array<float,2>{0.595748127f, 0.083272554f},
-std::array<float,2>{0.0729937628f, 0.610770762f},
-std::array<float,2>{0.201571733f, 0.37917909f},
-std::array<float,2>{0.700574696f, 0.833367348f},
-std::array<float,2>{0.866564512f, 0.0424414203f},
-std::array<float,2>{0.336533397f, 0.510145068f},
-std::array<float,2>{0.434753984f, 0.154808879f},
-std::array<float,2>{0.94260174f, 0.730363369f},
-std::array<float,2>{0.501150429f, 0.280110002f},
-std::array<float,2>{0.0374753214f, 0.944216907f},
-std::array<float,2>{0.119641237f, 0.114536829f},
-std::array<float,2>{0.587114096f, 0.591714382f},
-std::array<float,2>{0.937471151f, 0.476500988f},
-std::array<float,2>{0.443722159f, 0.774986744f},
-std::array<float,2>{0.251731485f, 0.324574977f},
-std::array<float,2>{0.760641932f, 0.927902341f},
-std::array<float,2>{0.639432788f, 0.217161462f},
-std::array<float,2>{0.157426357f, 0.654340506f},
-std::array<float,2>{0.0881259963f, 0.487850189f},
-std::array<float,2>{0.623260021f, 0.758388162f},
-std::array<float,2>{0.888408482f, 0.100468501f},
-std::array<float,2>{0.49984163f, 0.563711047f},
-std::array<float,2>{0.297489375f, 0.202352777f},
-std::array<float,2>{0.78900069f, 0.633504748f},
-std::array<float,2>{0.658481002f, 0.333468586f},
-std::array<float,2>{0.141778454f, 0.918984473f},
-std::array<float,2>{0.243411288f, 0.0545213185f},
-std::array<float,2>{0.723719418f, 0.53088522f},
-std::array<float,2>{0.833911359f, 0.399541497f},
-std::array<float,2>{0.356973112f, 0.826466143f},
-std::array<float,2>{0.398630857f, 0.252186805f},
-std::array<float,2>{0.988453329f, 0.95635277f},
-std::array<float,2>{0.549893081f, 0.137636557f},
-std::array<float,2>{0.0120541472f, 0.738922119f},
-std::array<float,2>{0.178635731f, 0.361055762f},
-std::array<float,2>{0.642028153f, 0.886291742f},
-std::array<float,2>{0.777937651f, 0.235231504f},
-std::array<float,2>{0.275413036f, 0.68140465f},
-std::array<float,2>{0.463613749f, 0.0715803429f},
-std::array<float,2>{0.906755626f, 0.607981205f},
-std::array<float,2>{0.573045015f, 0.439749271f},
-std::array<float,2>{0.103192575f, 0.786644042f},
-std::array<float,2>{0.051732f, 0.170154646f},
-std::array<float,2>{0.524339736f, 0.709652245f},
-std::array<float,2>{0.959725499f, 0.302780628f},
-std::array<float,2>{0.41023761f, 0.977986395f},
-std::array<float,2>{0.320939779f, 0.409607589f},
-std::array<float,2>{0.847930908f, 0.866525888f},
-std::array<float,2>{0.715368271f, 0.023290256f},
-std::array<float,2>{0.209004864f, 0.56163156f},
-std::array<float,2>{0.121547222f, 0.31033805f},
-std::array<float,2>{0.591039121f, 0.976362824f},
-std::array<float,2>{0.931240261f, 0.160663009f},
-std::array<float,2>{0.44001019f, 0.712017953f},
-std::array<float,2>{0.256415665f, 0.0254108738f},
-std::array<float,2>{0.763209343f, 0.552791834f},
-std::array<float,2>{0.636599422f, 0.417643785f},
-std::array<float,2>{0.160313293f, 0.870616674f},
-std::array<float,2>{0.197558001f, 0.24651359f},
-std::array<float,2>{0.697665751f, 0.677069902f},
-std::array<float,2>{0.861030042f, 0.372262716f},
-std::array<float,2>{0.340500981f, 0.87611866f},
-std::array<float,2>{0.429988474f, 0.448024899f},
-std::array<float,2>{0.93925041f, 0.794022501f},
-std::array<float,2>{0.504172266f, 0.0680808276f},
-std::array<float,2>{0.0329572707f, 0.594112992f},
-std::array<float,2>{0.133531496f, 0.392085105f},
-std::array<float,2>{0.678022563f, 0.817193985f},
-std::array<float,2>{0.806659222f, 0.0590475947f},
-std::array<float,2>{0.289725155f, 0.518688142f},
-std::array<float,2>{0.469177008f, 0.125583291f},
-std::array<float,2>{0.892033875f, 0.748262942f},
-std::array<float,2>{0.598659158f, 0.261320651f},
-std::array<float,2>{0.0744409263f, 0.963295281f},
-std::array<float,2>{0.0272293314f, 0.105714895f},
-std::array<float,2>{0.53983885f, 0.571810484f},
-std::array<float,2>{0.983866453f, 0.493928552f},
-std::array<float,2>{0.381703198f, 0.757499754f},
-std::array<float,2>{0.368604362f, 0.342396587f},
-std::array<float,2>{0.813617051f, 0.910413265f},
-std::array<float,2>{0.736404657f, 0.188065231f},
-std::array<float,2>{0.23059167f, 0.631391048f},
-std::array<float,2>{0.0475393496f, 0.483353943f},
-std::array<float,2>{0.530938685f, 0.769284666f},
-std::array<float,2>{0.955901921f, 0.118425198f},
-std::array<float,2>{0.408088773f, 0.580060899f},
-std::array<float,2>{0.324852258f, 0.209826201f},
-std::array<float,2>{0.844262958f, 0.641305387f},
-std::array<float,2>{0.7126472f, 0.315641373f},
-std::array<float,2>{0.205585346f, 0.936721623f},
-std::array<float,2>{0.17299898f, 0.0346741192f},
-std::array<float,2>{0.64733839f, 0.504501224f},
-std::array<float,2>{0.774661958f, 0.3846443f},
-std::array<float,2>{0.278352946f, 0.838459611f},
-std::array<float,2>{0.467251986f, 0.26876384f},
-std::array<float,2>{0.913229644f, 0.949292183f},
-std::array<float,2>{0.574509382f, 0.144594312f},
-std::array<float,2>{0.108391955f, 0.721919835f},
-std::array<float,2>{0.248307019f, 0.353129953f},
-std::array<float,2>{0.720908523f, 0.893868566f},
-std::array<float,2>{0.828622818f, 0.226310447f},
-std::array<float,2>{0.352420688f, 0.660181046f},
-std::array<float,2>{0.405635297f, 0.0895230696f},
-std::array<float,2>{0.987313449f, 0.620089948f},
-std::array<float,2>{0.551369548f, 0.463209003f},
-std::array<float,2>{0.00957166404f, 0.804008067f},
-std::array<float,2>{0.0901528597f, 0.178073138f},
-std::array<float,2>{0.619389534f, 0.689228833f},
-std::array<float,2>{0.884711921f, 0.295917809f},
-std::array<float,2>{0.493001312f, 0.997447968f},
-std::array<float,2>{0.302429199f, 0.427387506f},
-std::array<float,2>{0.783258855f, 0.849504828f},
-std::array<float,2>{0.663460553f, 0.00967693795f},
-std::array<float,2>{0.148075342f, 0.538435221f},
-std::array<float,2>{0.00154720608f, 0.320589542f},
-std::array<float,2>{0.557533741f, 0.922192574f},
-std::array<float,2>{0.992238104f, 0.211685449f},
-std::array<float,2>{0.394109666f, 0.649583519f},
-std::array<float,2>{0.343896151f, 0.110018142f},
-std::array<float,2>{0.84145993f, 0.587914765f},
-std::array<float,2>{0.732293844f, 0.47134164f},
-std::array<float,2>{0.23996304f, 0.778567791f},
-std::array<float,2>{0.155794814f, 0.15076825f},
-std::array<float,2>{0.666263878f, 0.733132958f},
-std::array<float,2>{0.795081854f, 0.275439054f},
-std::array<float,2>{0.305644155f, 0.937546968f},
-std::array<float,2>{0.490058452f, 0.376805454f},
-std::array<float,2>{0.880375326f, 0.830184281f},
-std::array<float,2>{0.616987705f, 0.0453252085f},
-std::array<float,2>{0.0795696005f, 0.513015985f},
-std::array<float,2>{0.215302661f, 0.459632248f},
-std::array<float,2>{0.704841018f, 0.806650341f},
-std::array<float,2>{0.85699302f, 0.0803241879f},
-std::array<float,2>{0.318931997f, 0.614208102f},
-std::array<float,2>{0.420485437f, 0.233648986f},
-std::array<float,2>{0.963121593f, 0.667136252f},
-std::array<float,2>{0.520019591f, 0.345485121f},
-std::array<float,2>{0.0559209362f, 0.904187322f},
-std::array<float,2>{0.0976737663f, 0.0070941723f},
-std::array<float,2>{0.570277512f, 0.544342577f},
-std::array<float,2>{0.914910734f, 0.436989546f},
-std::array<float,2>{0.460377842f, 0.851675034f},
-std::array<float,2>{0.267291248f, 0.2855542f},
-std::array<float,2>{0.768422306f, 0.985251486f},
-std::array<float,2>{0.649217188f, 0.18674168f},
-std::array<float,2>{0.182771638f, 0.696206987f},
-std::array<float,2>{0.0691348538f, 0.412227422f},
-std::array<float,2>{0.60540694f, 0.862599969f},
-std::array<float,2>{0.905140221f, 0.0171847399f},
-std::array<float,2>{0.479765147f, 0.557973325f},
-std::array<float,2>{0.286881179f, 0.16742672f},
-std::array<float,2>{0.801018f, 0.703892469f},
-std::array<float,2>{0.686462343f, 0.299565792f},
-std::array<float,2>{0.127469033f, 0.981880665f},
-std::array<float,2>{0.220244586f, 0.0775219202f},
-std::array<float,2>{0.745537221f, 0.60323149f},
-std::array<float,2>{0.827590704f, 0.443470746f},
-std::array<float,2>{0.366932541f, 0.784672081f},
-std::array<float,2>{0.383155286f, 0.367140561f},
-std::array<float,2>{0.974860668f, 0.887553215f},
-std::array<float,2>{0.534573257f, 0.242150858f},
-std::array<float,2>{0.0199352149f, 0.686996877f},
-std::array<float,2>{0.168638185f, 0.254978448f},
-std::array<float,2>{0.627844214f, 0.958832204f},
-std::array<float,2>{0.754182756f, 0.13324444f},
-std::array<float,2>{0.260744244f, 0.735807121f},
-std::array<float,2>{0.449561238f, 0.0479999296f},
-std::array<float,2>{0.928449631f, 0.523832977f},
-std::array<float,2>{0.585817158f, 0.405946732f},
-std::array<float,2>{0.110891886f, 0.823780656f},
-std::array<float,2>{0.0409130976f, 0.197469443f},
-std::array<float,2>{0.510752618f, 0.639328182f},
-std::array<float,2>{0.94986707f, 0.329898059f},
-std::array<float,2>{0.425789028f, 0.915161967f},
-std::array<float,2>{0.335108638f, 0.492151827f},
-std::array<float,2>{0.86893779f, 0.763022184f},
-std::array<float,2>{0.690026164f, 0.0971589014f},
-std::array<float,2>{0.191448659f, 0.568469584f},
-std::array<float,2>{0.0845326856f, 0.367688596f},
-std::array<float,2>{0.609581649f, 0.881064951f},
-std::array<float,2>{0.876831174f, 0.242933765f},
-std::array<float,2>{0.48724249f, 0.672023654f},
-std::array<float,2>{0.309936136f, 0.0653798357f},
-std::array<float,2>{0.792006075f, 0.598988295f},
-std::array<float,2>{0.668218434f, 0.450200737f},
-std::array<float,2>{0.150247604f, 0.792229295f},
-std::array<float,2>{0.23550871f, 0.159130797f},
-std::array<float,2>{0.728785038f, 0.717619181f},
-std::array<float,2>{0.838017464f, 0.305762619f},
-std::array<float,2>{0.349729449f, 0.969940066f},
-std::array<float,2>{0.39600724f, 0.418810248f},
-std::array<float,2>{0.998771191f, 0.871337414f},
-std::array<float,2>{0.562215745f, 0.0292319935f},
-std::array<float,2>{0.00611747336f, 0.550002694f},
-std::array<float,2>{0.18707718f, 0.499777704f},
-std::array<float,2>{0.655844927f, 0.753328681f},
-std::array<float,2>{0.769652486f, 0.102860026f},
-std::array<float,2>{0.273002505f, 0.577417731f},
-std::array<float,2>{0.455271244f, 0.193574652f},
-std::array<float,2>{0.921607196f, 0.62774545f},
-std::array<float,2>{0.563095629f, 0.338265151f},
-std::array<float,2>{0.0976486132f, 0.907626748f},
-std::array<float,2>{0.0605075918f, 0.0576461218f},
-std::array<float,2>{0.518673182f, 0.522208571f},
-std::array<float,2>{0.96823591f, 0.397149622f},
-std::array<float,2>{0.41613093f, 0.812713683f},
-std::array<float,2>{0.314924002f, 0.26407665f},
-std::array<float,2>{0.854191959f, 0.965030909f},
-std::array<float,2>{0.707663417f, 0.129743561f},
-std::array<float,2>{0.211058885f, 0.743167043f},
-std::array<float,2>{0.0185750965f, 0.38848716f},
-std::array<float,2>{0.536978781f, 0.840851188f},
-std::array<float,2>{0.971586525f, 0.0362021178f},
-std::array<float,2>{0.38839823f, 0.501270652f},
-std::array<float,2>{0.360668987f, 0.14256154f},
-std::array<float,2>{0.82284832f, 0.72346729f},
-std::array<float,2>{0.749058068f, 0.271756977f},
-std::array<float,2>{0.225847483f, 0.948016286f},
-std::array<float,2>{0.132715732f, 0.12196707f},
-std::array<float,2>{0.683115184f, 0.585072935f},
-std::array<float,2>{0.797685087f, 0.478628963f},
-std::array<float,2>{0.283306777f, 0.772491157f},
-std::array<float,2>{0.483198375f, 0.316927135f},
-std::array<float,2>{0.899963737f, 0.930336773f},
-std::array<float,2>{0.606035948f, 0.204057172f},
-std::array<float,2>{0.0655162781f, 0.646855831f},
-std::array<float,2>{0.189231157f, 0.291087657f},
-std::array<float,2>{0.694330573f, 0.992756784f},
-std::array<float,2>{0.872412145f, 0.173312768f},
-std::array<float,2>{0.330583543f, 0.69318974f},
-std::array<float,2>{0.425599992f, 0.0121343378f},
-std::array<float,2>{0.947691202f, 0.531379521f},
-std::array<float,2>{0.513345003f, 0.423088282f},
-std::array<float,2>{0.044365786f, 0.845830321f},
-std::array<float,2>{0.117137104f, 0.219389156f},
-std::array<float,2>{0.580785692f, 0.656729758f},
-std::array<float,2>{0.922011495f, 0.357284248f},
-std::array<float,2>{0.449051589f, 0.89764595f},
-std::array<float,2>{0.261945963f, 0.466159791f},
-std::array<float,2>{0.750754774f, 0.798492908f},
-std::array<float,2>{0.630830526f, 0.089921914f},
-std::array<float,2>{0.166486382f, 0.622428f},
-std::array<float,2>{0.035902407f, 0.277551919f},
-std::array<float,2>{0.503506422f, 0.941941321f},
-std::array<float,2>{0.943564057f, 0.153076351f},
-std::array<float,2>{0.436000109f, 0.727571249f},
-std::array<float,2>{0.338080734f, 0.0404394418f},
-std::array<float,2>{0.863524795f, 0.5089733f},
-std::array<float,2>{0.702801406f, 0.382076651f},
-std::array<float,2>{0.200290993f, 0.834195137f},
-std::array<float,2>{0.158306628f, 0.215344071f},
-std::array<float,2>{0.636958957f, 0.653931201f},
-std::array<float,2>{0.758876324f, 0.327118218f},
-std::array<float,2>{0.252519578f, 0.927155554f},
-std::array<float,2>{0.442993343f, 0.472989559f},
-std::array<float,2>{0.934978127f, 0.775393188f},
-std::array<float,2>{0.588220537f, 0.115455322f},
-std::array<float,2>{0.117491901f, 0.592827857f},
-std::array<float,2>{0.227782995f, 0.429883212f},
-std::array<float,2>{0.738544524f, 0.85861057f},
-std::array<float,2>{0.819450974f, 0.00201842375f},
-std::array<float,2>{0.372630596f, 0.539276123f},
-std::array<float,2>{0.375198483f, 0.182774499f},
-std::array<float,2>{0.979666173f, 0.702670515f},
-std::array<float,2>{0.544884026f, 0.284423083f},
-std::array<float,2>{0.0293402169f, 0.990861475f},
-std::array<float,2>{0.0716732442f, 0.0853636861f},
-std::array<float,2>{0.594571352f, 0.612677932f},
-std::array<float,2>{0.898197651f, 0.455888748f},
-std::array<float,2>{0.474858254f, 0.81003511f},
-std::array<float,2>{0.29660359f, 0.350335389f},
-std::array<float,2>{0.811632037f, 0.901873767f},
-std::array<float,2>{0.67215997f, 0.22914958f},
-std::array<float,2>{0.138802245f, 0.670513511f},
-std::array<float,2>{0.10490071f, 0.439055115f},
-std::array<float,2>{0.571003616f, 0.787174165f},
-std::array<float,2>{0.909155965f, 0.073966302f},
-std::array<float,2>{0.46215564f, 0.605810165f},
-std::array<float,2>{0.273523569f, 0.23681064f},
-std::array<float,2>{0.780047119f, 0.68238759f},
-std::array<float,2>{0.643764853f, 0.361397743f},
-std::array<float,2>{0.176932633f, 0.883832097f},
-std::array<float,2>{0.208115265f, 0.019908851f},
-std::array<float,2>{0.717475712f, 0.559064984f},
-std::array<float,2>{0.850519598f, 0.406771988f},
-std::array<float,2>{0.322964966f, 0.865128517f},
-std::array<float,2>{0.412351221f, 0.301015437f},
-std::array<float,2>{0.957516432f, 0.978879631f},
-std::array<float,2>{0.527307391f, 0.168012187f},
-std::array<float,2>{0.0536404736f, 0.707996368f},
-std::array<float,2>{0.142864794f, 0.335678041f},
-std::array<float,2>{0.656973004f, 0.920175254f},
-std::array<float,2>{0.785874963f, 0.200735375f},
-std::array<float,2>{0.299243808f, 0.636490881f},
-std::array<float,2>{0.497532248f, 0.0995170996f},
-std::array<float,2>{0.889783978f, 0.565394163f},
-std::array<float,2>{0.621931016f, 0.486226916f},
-std::array<float,2>{0.0862212405f, 0.760295033f},
-std::array<float,2>{0.0144235082f, 0.140219256f},
-std::array<float,2>{0.547099233f, 0.740671754f},
-std::array<float,2>{0.991271555f, 0.251211554f},
-std::array<float,2>{0.40066123f, 0.953544557f},
-std::array<float,2>{0.359010845f, 0.401328504f},
-std::array<float,2>{0.835214674f, 0.824446023f},
-std::array<float,2>{0.726324797f, 0.0521978252f},
-std::array<float,2>{0.246060088f, 0.528958082f},
-std::array<float,2>{0.110791601f, 0.257582903f},
-std::array<float,2>{0.584973335f, 0.959256768f},
-std::array<float,2>{0.927924395f, 0.135436222f},
-std::array<float,2>{0.449899435f, 0.737390161f},
-std::array<float,2>{0.261707634f, 0.049135007f},
-std::array<float,2>{0.754468381f, 0.52618283f},
-std::array<float,2>{0.62732172f, 0.404117733f},
-std::array<float,2>{0.168161988f, 0.820541441f},
-std::array<float,2>{0.19204028f, 0.195384085f},
-std::array<float,2>{0.689462304f, 0.636988819f},
-std::array<float,2>{0.868546903f, 0.331648678f},
-std::array<float,2>{0.335890144f, 0.916710079f},
-std::array<float,2>{0.426727712f, 0.488322198f},
-std::array<float,2>{0.949530363f, 0.763742745f},
-std::array<float,2>{0.511240125f, 0.0950720832f},
-std::array<float,2>{0.0403250828f, 0.56681627f},
-std::array<float,2>{0.127087861f, 0.41116488f},
-std::array<float,2>{0.685564458f, 0.861326098f},
-std::array<float,2>{0.801429451f, 0.0195129048f},
-std::array<float,2>{0.28624931f, 0.555612445f},
-std::array<float,2>{0.480200052f, 0.165956378f},
-std::array<float,2>{0.904469371f, 0.707017958f},
-std::array<float,2>{0.604778945f, 0.297110826f},
-std::array<float,2>{0.068537049f, 0.984373689f},
-std::array<float,2>{0.0204478838f, 0.0749671385f},
-std::array<float,2>{0.534980416f, 0.604198992f},
-std::array<float,2>{0.975549102f, 0.442019284f},
-std::array<float,2>{0.383536726f, 0.782646f},
-std::array<float,2>{0.36639294f, 0.363536894f},
-std::array<float,2>{0.827698648f, 0.889793098f},
-std::array<float,2>{0.745692015f, 0.238328487f},
-std::array<float,2>{0.219760299f, 0.683624387f},
-std::array<float,2>{0.0563284718f, 0.457614481f},
-std::array<float,2>{0.519586027f, 0.805543721f},
-std::array<float,2>{0.963752568f, 0.0793579966f},
-std::array<float,2>{0.420111626f, 0.617013752f},
-std::array<float,2>{0.318704158f, 0.231103882f},
-std::array<float,2>{0.8567186f, 0.66535604f},
-std::array<float,2>{0.704413533f, 0.347164541f},
-std::array<float,2>{0.215771392f, 0.905612648f},
-std::array<float,2>{0.183138222f, 0.00544447871f},
-std::array<float,2>{0.648470223f, 0.546587288f},
-std::array<float,2>{0.767807603f, 0.434498608f},
-std::array<float,2>{0.266991884f, 0.854459465f},
-std::array<float,2>{0.460618079f, 0.288022906f},
-std::array<float,2>{0.914525986f, 0.987253845f},
-std::array<float,2>{0.569667697f, 0.184471205f},
-std::array<float,2>{0.098367095f, 0.69750309f},
-std::array<float,2>{0.239699289f, 0.32272616f},
-std::array<float,2>{0.731835902f, 0.925436795f},
-std::array<float,2>{0.840916991f, 0.21351409f},
-std::array<float,2>{0.344293565f, 0.650541008f},
-std::array<float,2>{0.393729568f, 0.112357356f},
-std::array<float,2>{0.992805481f, 0.587382436f},
-std::array<float,2>{0.556973994f, 0.470562756f},
-std::array<float,2>{0.00110199151f, 0.780681729f},
-std::array<float,2>{0.0795983449f, 0.150049105f},
-std::array<float,2>{0.616621912f, 0.731056511f},
-std::array<float,2>{0.879889548f, 0.275149614f},
-std::array<float,2>{0.489554733f, 0.939860225f},
-std::array<float,2>{0.30479449f, 0.377664924f},
-std::array<float,2>{0.795753241f, 0.829090416f},
-std::array<float,2>{0.666579843f, 0.0445554741f},
-std::array<float,2>{0.15540491f, 0.513927042f},
-std::array<float,2>{0.00926106796f, 0.353788465f},
-std::array<float,2>{0.550877213f, 0.890923858f},
-std::array<float,2>{0.987954676f, 0.222862512f},
-std::array<float,2>{0.40612638f, 0.662684441f},
-std::array<float,2>{0.351737529f, 0.0868424475f},
-std::array<float,2>{0.82861203f, 0.618281186f},
-std::array<float,2>{0.721375763f, 0.46182555f},
-std::array<float,2>{0.248895735f, 0.801264644f},
-std::array<float,2>{0.147668138f, 0.17671077f},
-std::array<float,2>{0.663796902f, 0.68962574f},
-std::array<float,2>{0.783946276f, 0.29345721f},
-std::array<float,2>{0.30194062f, 0.998842299f},
-std::array<float,2>{0.492327482f, 0.428089321f},
-std::array<float,2>{0.884034514f, 0.850046456f},
-std::array<float,2>{0.620097041f, 0.0110841654f},
-std::array<float,2>{0.0904742703f, 0.536177397f},
-std::array<float,2>{0.205461532f, 0.480988175f},
-std::array<float,2>{0.712387025f, 0.767071784f},
-std::array<float,2>{0.843849838f, 0.120938778f},
-std::array<float,2>{0.324225485f, 0.581290424f},
-std::array<float,2>{0.407263428f, 0.20775646f},
-std::array<float,2>{0.955436409f, 0.642792404f},
-std::array<float,2>{0.530473173f, 0.314277232f},
-std::array<float,2>{0.0471076444f, 0.934301615f},
-std::array<float,2>{0.107694879f, 0.0325555764f},
-std::array<float,2>{0.574945331f, 0.507356882f},
-std::array<float,2>{0.913677514f, 0.386670858f},
-std::array<float,2>{0.46755439f, 0.837628305f},
-std::array<float,2>{0.279041469f, 0.266884983f},
-std::array<float,2>{0.774983585f, 0.952200651f},
-std::array<float,2>{0.646522999f, 0.147443593f},
-std::array<float,2>{0.173714355f, 0.719634235f},
-std::array<float,2>{0.0750421286f, 0.392660916f},
-std::array<float,2>{0.599465549f, 0.819032073f},
-std::array<float,2>{0.892500401f, 0.0609129816f},
-std::array<float,2>{0.469714224f, 0.517345607f},
-std::array<float,2>{0.289196283f, 0.12789619f},
-std::array<float,2>{0.807604194f, 0.747499585f},
-std::array<float,2>{0.678412199f, 0.25902611f},
-std::array<float,2>{0.133034945f, 0.962277532f},
-std::array<float,2>{0.23118116f, 0.1091116f},
-std::array<float,2>{0.737082541f, 0.572908163f},
-std::array<float,2>{0.814393103f, 0.495687842f},
-std::array<float,2>{0.368810654f, 0.755074978f},
-std::array<float,2>{0.381042212f, 0.340294033f},
-std::array<float,2>{0.984093189f, 0.913570106f},
-std::array<float,2>{0.539545953f, 0.191174597f},
-std::array<float,2>{0.0265367404f, 0.62994498f},
-std::array<float,2>{0.16071564f, 0.312426567f},
-std::array<float,2>{0.635910511f, 0.974321187f},
-std::array<float,2>{0.763040185f, 0.162463382f},
-std::array<float,2>{0.256231815f, 0.714018524f},
-std::array<float,2>{0.439785033f, 0.024092298f},
-std::array<float,2>{0.931123078f, 0.551308215f},
-std::array<float,2>{0.59134084f, 0.415802568f},
-std::array<float,2>{0.121643111f, 0.868339658f},
-std::array<float,2>{0.0323852226f, 0.248103455f},
-std::array<float,2>{0.504448414f, 0.678720355f},
-std::array<float,2>{0.938940406f, 0.373535842f},
-std::array<float,2>{0.430609256f, 0.877254426f},
-std::array<float,2>{0.340229541f, 0.447041512f},
-std::array<float,2>{0.860657692f, 0.795356214f},
-std::array<float,2>{0.697851121f, 0.0699301139f},
-std::array<float,2>{0.197938636f, 0.597146928f},
-std::array<float,2>{0.086499624f, 0.333533227f},
-std::array<float,2>{0.621137142f, 0.919496655f},
-std::array<float,2>{0.890500307f, 0.202828318f},
-std::array<float,2>{0.49791047f, 0.633139491f},
-std::array<float,2>{0.299777389f, 0.100032002f},
-std::array<float,2>{0.785544395f, 0.564272821f},
-std::array<float,2>{0.656409562f, 0.487351149f},
-std::array<float,2>{0.143514201f, 0.758269727f},
-std::array<float,2>{0.24540323f, 0.136742786f},
-std::array<float,2>{0.725587487f, 0.738473535f},
-std::array<float,2>{0.835499167f, 0.252613306f},
-std::array<float,2>{0.358682662f, 0.956915855f},
-std::array<float,2>{0.400966138f, 0.400128663f},
-std::array<float,2>{0.991897106f, 0.826943576f},
-std::array<float,2>{0.547799647f, 0.053908553f},
-std::array<float,2>{0.0139730629f, 0.530433893f},
-std::array<float,2>{0.177529305f, 0.440381795f},
-std::array<float,2>{0.644387722f, 0.786256731f},
-std::array<float,2>{0.779355466f, 0.0717986226f},
-std::array<float,2>{0.274185687f, 0.607819378f},
-std::array<float,2>{0.462773085f, 0.234401911f},
-std::array<float,2>{0.908634186f, 0.680780411f},
-std::array<float,2>{0.570537627f, 0.360603601f},
-std::array<float,2>{0.105092317f, 0.885813773f},
-std::array<float,2>{0.0531141907f, 0.0225793496f},
-std::array<float,2>{0.526429355f, 0.562259555f},
-std::array<float,2>{0.957531095f, 0.409849644f},
-std::array<float,2>{0.413078904f, 0.866936207f},
-std::array<float,2>{0.322557628f, 0.303683788f},
-std::array<float,2>{0.850052595f, 0.978201926f},
-std::array<float,2>{0.71709013f, 0.17083621f},
-std::array<float,2>{0.20883514f, 0.709225237f},
-std::array<float,2>{0.0301302783f, 0.433155984f},
-std::array<float,2>{0.54407084f, 0.857268631f},
-std::array<float,2>{0.980077982f, 0.000671162561f},
-std::array<float,2>{0.375709236f, 0.541163921f},
-std::array<float,2>{0.372477561f, 0.181012541f},
-std::array<float,2>{0.82026875f, 0.699918151f},
-std::array<float,2>{0.738978565f, 0.282768488f},
-std::array<float,2>{0.228254497f, 0.989727199f},
-std::array<float,2>{0.139447793f, 0.0836154893f},
-std::array<float,2>{0.67257452f, 0.611131012f},
-std::array<float,2>{0.81237489f, 0.453495473f},
-std::array<float,2>{0.296137303f, 0.81174773f},
-std::array<float,2>{0.47529f, 0.3485457f},
-std::array<float,2>{0.897792161f, 0.899190903f},
-std::array<float,2>{0.594028294f, 0.22830613f},
-std::array<float,2>{0.0718401968f, 0.669920087f},
-std::array<float,2>{0.200815439f, 0.279593438f},
-std::array<float,2>{0.702432036f, 0.943797052f},
-std::array<float,2>{0.864251912f, 0.154501781f},
-std::array<float,2>{0.338719159f, 0.729613662f},
-std::array<float,2>{0.436310321f, 0.0427411236f},
-std::array<float,2>{0.943975866f, 0.510297835f},
-std::array<float,2>{0.503130615f, 0.379705727f},
-std::array<float,2>{0.0356404036f, 0.833608389f},
-std::array<float,2>{0.118035771f, 0.217572525f},
-std::array<float,2>{0.588621855f, 0.655043662f},
-std::array<float,2>{0.935441494f, 0.324991852f},
-std::array<float,2>{0.442447484f, 0.928660214f},
-std::array<float,2>{0.252036542f, 0.476047844f},
-std::array<float,2>{0.759698689f, 0.774884284f},
-std::array<float,2>{0.637538135f, 0.115058221f},
-std::array<float,2>{0.159148946f, 0.591257036f},
-std::array<float,2>{0.0445775092f, 0.289528638f},
-std::array<float,2>{0.513154685f, 0.995880187f},
-std::array<float,2>{0.947784424f, 0.174655423f},
-std::array<float,2>{0.424992919f, 0.694781661f},
-std::array<float,2>{0.330204874f, 0.0146693913f},
-std::array<float,2>{0.872582316f, 0.534133971f},
-std::array<float,2>{0.693795979f, 0.425470889f},
-std::array<float,2>{0.188802779f, 0.843994677f},
-std::array<float,2>{0.166853324f, 0.22219038f},
-std::array<float,2>{0.629938006f, 0.658570409f},
-std::array<float,2>{0.750082731f, 0.358365506f},
-std::array<float,2>{0.262435883f, 0.894864738f},
-std::array<float,2>{0.448607236f, 0.468343109f},
-std::array<float,2>{0.922544956f, 0.798913419f},
-std::array<float,2>{0.580516577f, 0.0917996243f},
-std::array<float,2>{0.116570219f, 0.624319136f},
-std::array<float,2>{0.226148337f, 0.389688224f},
-std::array<float,2>{0.749542594f, 0.842834353f},
-std::array<float,2>{0.822573125f, 0.0372618549f},
-std::array<float,2>{0.360979617f, 0.503272176f},
-std::array<float,2>{0.388061345f, 0.144290179f},
-std::array<float,2>{0.970993698f, 0.726414561f},
-std::array<float,2>{0.536481559f, 0.269799769f},
-std::array<float,2>{0.0193743613f, 0.946726739f},
-std::array<float,2>{0.0663501695f, 0.123616703f},
-std::array<float,2>{0.605688572f, 0.582670867f},
-std::array<float,2>{0.899868131f, 0.476678014f},
-std::array<float,2>{0.48277244f, 0.769661605f},
-std::array<float,2>{0.284124613f, 0.318972945f},
-std::array<float,2>{0.797352731f, 0.932366669f},
-std::array<float,2>{0.682880878f, 0.2055801f},
-std::array<float,2>{0.132264838f, 0.646146536f},
-std::array<float,2>{0.0969954804f, 0.496541739f},
-std::array<float,2>{0.562969089f, 0.751562834f},
-std::array<float,2>{0.921166778f, 0.103869393f},
-std::array<float,2>{0.455877066f, 0.575798869f},
-std::array<float,2>{0.272896349f, 0.19154723f},
-std::array<float,2>{0.770062208f, 0.625900805f},
-std::array<float,2>{0.655531287f, 0.337457627f},
-std::array<float,2>{0.186800778f, 0.908403218f},
-std::array<float,2>{0.211896941f, 0.0547300838f},
-std::array<float,2>{0.707241714f, 0.520629168f},
-std::array<float,2>{0.853867412f, 0.394802541f},
-std::array<float,2>{0.315061688f, 0.815706551f},
-std::array<float,2>{0.416668057f, 0.26261878f},
-std::array<float,2>{0.968695521f, 0.96736598f},
-std::array<float,2>{0.519222021f, 0.132155597f},
-std::array<float,2>{0.0596878454f, 0.745831072f},
-std::array<float,2>{0.149750546f, 0.369867414f},
-std::array<float,2>{0.668718994f, 0.879043996f},
-std::array<float,2>{0.792586684f, 0.245466456f},
-std::array<float,2>{0.310474038f, 0.675035238f},
-std::array<float,2>{0.486500025f, 0.0640718043f},
-std::array<float,2>{0.876089096f, 0.601099849f},
-std::array<float,2>{0.610123158f, 0.452990055f},
-std::array<float,2>{0.0841766521f, 0.789905429f},
-std::array<float,2>{0.00679971045f, 0.157757401f},
-std::array<float,2>{0.561627984f, 0.716582f},
-std::array<float,2>{0.998263359f, 0.308094233f},
-std::array<float,2>{0.395774364f, 0.971211135f},
-std::array<float,2>{0.350194663f, 0.4216443f},
-std::array<float,2>{0.838621855f, 0.873996019f},
-std::array<float,2>{0.729305863f, 0.030241264f},
-std::array<float,2>{0.23626557f, 0.547804534f},
-std::array<float,2>{0.0672689229f, 0.299189627f},
-std::array<float,2>{0.602696121f, 0.98209548f},
-std::array<float,2>{0.903044641f, 0.167801231f},
-std::array<float,2>{0.477821559f, 0.703359306f},
-std::array<float,2>{0.288893253f, 0.0166666973f},
-std::array<float,2>{0.803017914f, 0.558540285f},
-std::array<float,2>{0.685002089f, 0.412627131f},
-std::array<float,2>{0.126744673f, 0.863230646f},
-std::array<float,2>{0.222319826f, 0.241447613f},
-std::array<float,2>{0.742887318f, 0.687463999f},
-std::array<float,2>{0.825877428f, 0.366510898f},
-std::array<float,2>{0.364807218f, 0.887131035f},
-std::array<float,2>{0.386400998f, 0.444295585f},
-std::array<float,2>{0.97399205f, 0.784376383f},
-std::array<float,2>{0.531648934f, 0.0778790414f},
-std::array<float,2>{0.0223888755f, 0.602826178f},
-std::array<float,2>{0.170753017f, 0.405399084f},
-std::array<float,2>{0.625442564f, 0.823270142f},
-std::array<float,2>{0.756859839f, 0.048526343f},
-std::array<float,2>{0.259708852f, 0.524298489f},
-std::array<float,2>{0.452084541f, 0.13375175f},
-std::array<float,2>{0.926277757f, 0.736181557f},
-std::array<float,2>{0.582792997f, 0.255715281f},
-std::array<float,2>{0.112229213f, 0.958084822f},
-std::array<float,2>{0.0414890535f, 0.0972126052f},
-std::array<float,2>{0.508856952f, 0.569025278f},
-std::array<float,2>{0.951426864f, 0.491470844f},
-std::array<float,2>{0.42926991f, 0.763208866f},
-std::array<float,2>{0.332417667f, 0.329487592f},
-std::array<float,2>{0.870938182f, 0.915979326f},
-std::array<float,2>{0.687502623f, 0.198067233f},
-std::array<float,2>{0.195144206f, 0.638696969f},
-std::array<float,2>{0.00263355556f, 0.471059442f},
-std::array<float,2>{0.55512327f, 0.779099226f},
-std::array<float,2>{0.994545698f, 0.109702617f},
-std::array<float,2>{0.392171979f, 0.588752329f},
-std::array<float,2>{0.346160293f, 0.211289778f},
-std::array<float,2>{0.842855036f, 0.650146425f},
-std::array<float,2>{0.734317362f, 0.321032494f},
-std::array<float,2>{0.241659865f, 0.922743738f},
-std::array<float,2>{0.153790981f, 0.0455348864f},
-std::array<float,2>{0.665332794f, 0.513499856f},
-std::array<float,2>{0.794867098f, 0.376318961f},
-std::array<float,2>{0.306782067f, 0.830742836f},
-std::array<float,2>{0.49182272f, 0.276078522f},
-std::array<float,2>{0.881364405f, 0.938153148f},
-std::array<float,2>{0.614202619f, 0.150935531f},
-std::array<float,2>{0.0812080279f, 0.732737422f},
-std::array<float,2>{0.217505947f, 0.344885528f},
-std::array<float,2>{0.706091762f, 0.903707206f},
-std::array<float,2>{0.859321237f, 0.23407343f},
-std::array<float,2>{0.318316966f, 0.667495608f},
-std::array<float,2>{0.418860257f, 0.0805786774f},
-std::array<float,2>{0.96106565f, 0.613707244f},
-std::array<float,2>{0.521505713f, 0.459248751f},
-std::array<float,2>{0.0582659394f, 0.807585478f},
-std::array<float,2>{0.101218842f, 0.187025428f},
-std::array<float,2>{0.567125678f, 0.695421159f},
-std::array<float,2>{0.91792202f, 0.285944939f},
-std::array<float,2>{0.458696246f, 0.984491408f},
-std::array<float,2>{0.269011617f, 0.43728742f},
-std::array<float,2>{0.767457187f, 0.852372468f},
-std::array<float,2>{0.651348352f, 0.00738914218f},
-std::array<float,2>{0.181212544f, 0.544588089f},
-std::array<float,2>{0.0503169708f, 0.316007167f},
-std::array<float,2>{0.52784133f, 0.93708539f},
-std::array<float,2>{0.953821421f, 0.209297881f},
-std::array<float,2>{0.408742875f, 0.640635371f},
-std::array<float,2>{0.326485366f, 0.118785888f},
-std::array<float,2>{0.84694159f, 0.5792436f},
-std::array<float,2>{0.713697731f, 0.482646883f},
-std::array<float,2>{0.204275936f, 0.768624902f},
-std::array<float,2>{0.17539759f, 0.145089388f},
-std::array<float,2>{0.646271288f, 0.722391903f},
-std::array<float,2>{0.77678287f, 0.269355804f},
-std::array<float,2>{0.280043155f, 0.949922085f},
-std::array<float,2>{0.466617465f, 0.384010255f},
-std::array<float,2>{0.910623491f, 0.838050902f},
-std::array<float,2>{0.576287568f, 0.0342584811f},
-std::array<float,2>{0.106375948f, 0.504357696f},
-std::array<float,2>{0.246914163f, 0.463795722f},
-std::array<float,2>{0.720649779f, 0.804586411f},
-std::array<float,2>{0.83179903f, 0.0893191621f},
-std::array<float,2>{0.354777128f, 0.619156897f},
-std::array<float,2>{0.402604789f, 0.225982353f},
-std::array<float,2>{0.98531121f, 0.660875618f},
-std::array<float,2>{0.55388242f, 0.352832347f},
-std::array<float,2>{0.0104600266f, 0.89446193f},
-std::array<float,2>{0.0935817659f, 0.0089356862f},
-std::array<float,2>{0.617866039f, 0.538952649f},
-std::array<float,2>{0.885738909f, 0.426761687f},
-std::array<float,2>{0.49466151f, 0.849084973f},
-std::array<float,2>{0.303326041f, 0.296415418f},
-std::array<float,2>{0.781919301f, 0.997972548f},
-std::array<float,2>{0.660629869f, 0.17871061f},
-std::array<float,2>{0.144662619f, 0.688534677f},
-std::array<float,2>{0.123345315f, 0.417159081f},
-std::array<float,2>{0.592435241f, 0.870210826f},
-std::array<float,2>{0.932810903f, 0.0260631274f},
-std::array<float,2>{0.437585384f, 0.553245842f},
-std::array<float,2>{0.25569433f, 0.160306334f},
-std::array<float,2>{0.764481068f, 0.712836266f},
-std::array<float,2>{0.634472013f, 0.31004703f},
-std::array<float,2>{0.163076401f, 0.97577107f},
-std::array<float,2>{0.196768641f, 0.0676597804f},
-std::array<float,2>{0.696060836f, 0.594594836f},
-std::array<float,2>{0.862325549f, 0.447514474f},
-std::array<float,2>{0.343432337f, 0.794759691f},
-std::array<float,2>{0.431795329f, 0.373030633f},
-std::array<float,2>{0.940497577f, 0.876611114f},
-std::array<float,2>{0.507388532f, 0.246898115f},
-std::array<float,2>{0.0332361236f, 0.677507401f},
-std::array<float,2>{0.135014072f, 0.261003107f},
-std::array<float,2>{0.676928699f, 0.963571429f},
-std::array<float,2>{0.804941535f, 0.125370085f},
-std::array<float,2>{0.291285753f, 0.748829067f},
-std::array<float,2>{0.472260982f, 0.0595539361f},
-std::array<float,2>{0.893298447f, 0.519443452f},
-std::array<float,2>{0.601525724f, 0.392567545f},
-std::array<float,2>{0.0764849484f, 0.816659331f},
-std::array<float,2>{0.0238949787f, 0.187852636f},
-std::array<float,2>{0.542535126f, 0.631153464f},
-std::array<float,2>{0.980976701f, 0.341997921f},
-std::array<float,2>{0.380369633f, 0.910730779f},
-std::array<float,2>{0.370273203f, 0.493546844f},
-std::array<float,2>{0.814714134f, 0.757255971f},
-std::array<float,2>{0.73491317f, 0.106185302f},
-std::array<float,2>{0.234173074f, 0.57145983f},
-std::array<float,2>{0.102552302f, 0.362008363f},
-std::array<float,2>{0.572491705f, 0.8845312f},
-std::array<float,2>{0.906376183f, 0.237009734f},
-std::array<float,2>{0.463070631f, 0.681823969f},
-std::array<float,2>{0.275914669f, 0.0734167695f},
-std::array<float,2>{0.777433634f, 0.606318772f},
-std::array<float,2>{0.642561316f, 0.43863079f},
-std::array<float,2>{0.177879348f, 0.787840068f},
-std::array<float,2>{0.209496632f, 0.168493018f},
-std::array<float,2>{0.715175688f, 0.707175136f},
-std::array<float,2>{0.848389268f, 0.301347464f},
-std::array<float,2>{0.320669532f, 0.979280472f},
-std::array<float,2>{0.410849959f, 0.406328112f},
-std::array<float,2>{0.959089398f, 0.864694357f},
-std::array<float,2>{0.523911417f, 0.0200470909f},
-std::array<float,2>{0.051153034f, 0.559365749f},
-std::array<float,2>{0.142241105f, 0.485504806f},
-std::array<float,2>{0.658764541f, 0.760039151f},
-std::array<float,2>{0.788236022f, 0.0989333838f},
-std::array<float,2>{0.297195375f, 0.564735711f},
-std::array<float,2>{0.499466062f, 0.200395644f},
-std::array<float,2>{0.887722015f, 0.636180401f},
-std::array<float,2>{0.623878896f, 0.335319042f},
-std::array<float,2>{0.0887171403f, 0.920681179f},
-std::array<float,2>{0.0124043114f, 0.0526980534f},
-std::array<float,2>{0.550650299f, 0.528772354f},
-std::array<float,2>{0.988862276f, 0.400633574f},
-std::array<float,2>{0.399413437f, 0.824845254f},
-std::array<float,2>{0.356477618f, 0.251826435f},
-std::array<float,2>{0.833044648f, 0.954045296f},
-std::array<float,2>{0.724297285f, 0.140021056f},
-std::array<float,2>{0.243786529f, 0.74090296f},
-std::array<float,2>{0.0378270671f, 0.382801384f},
-std::array<float,2>{0.501660287f, 0.834887207f},
-std::array<float,2>{0.943037689f, 0.0406790115f},
-std::array<float,2>{0.435279042f, 0.509750545f},
-std::array<float,2>{0.336245239f, 0.152537242f},
-std::array<float,2>{0.866853297f, 0.728449047f},
-std::array<float,2>{0.701084375f, 0.278208524f},
-std::array<float,2>{0.201951504f, 0.941820562f},
-std::array<float,2>{0.157799825f, 0.115962781f},
-std::array<float,2>{0.638916314f, 0.593548894f},
-std::array<float,2>{0.760137558f, 0.473520547f},
-std::array<float,2>{0.251374871f, 0.77615279f},
-std::array<float,2>{0.444001406f, 0.326403707f},
-std::array<float,2>{0.936733842f, 0.927689254f},
-std::array<float,2>{0.587599695f, 0.214968309f},
-std::array<float,2>{0.119223617f, 0.653536379f},
-std::array<float,2>{0.228769004f, 0.285060108f},
-std::array<float,2>{0.740552306f, 0.990338385f},
-std::array<float,2>{0.817775726f, 0.18348293f},
-std::array<float,2>{0.373751342f, 0.702281356f},
-std::array<float,2>{0.377073199f, 0.00283107348f},
-std::array<float,2>{0.978319287f, 0.539832532f},
-std::array<float,2>{0.546518683f, 0.430616796f},
-std::array<float,2>{0.0286155697f, 0.859260798f},
-std::array<float,2>{0.0725565553f, 0.2286212f},
-std::array<float,2>{0.596551061f, 0.67017746f},
-std::array<float,2>{0.896363556f, 0.349886984f},
-std::array<float,2>{0.473643452f, 0.901507914f},
-std::array<float,2>{0.293912798f, 0.455209345f},
-std::array<float,2>{0.810388088f, 0.81039685f},
-std::array<float,2>{0.674098611f, 0.0855389461f},
-std::array<float,2>{0.138069794f, 0.61289531f},
-std::array<float,2>{0.0171006545f, 0.272148371f},
-std::array<float,2>{0.538779438f, 0.947341144f},
-std::array<float,2>{0.968812823f, 0.141655356f},
-std::array<float,2>{0.389387161f, 0.723039031f},
-std::array<float,2>{0.362381697f, 0.0368034244f},
-std::array<float,2>{0.821480989f, 0.501499653f},
-std::array<float,2>{0.746965408f, 0.387997866f},
-std::array<float,2>{0.224055618f, 0.841778219f},
-std::array<float,2>{0.130448267f, 0.203266889f},
-std::array<float,2>{0.681229293f, 0.647140324f},
-std::array<float,2>{0.799948156f, 0.316870064f},
-std::array<float,2>{0.283101559f, 0.929942787f},
-std::array<float,2>{0.482321441f, 0.479139358f},
-std::array<float,2>{0.901614726f, 0.77316457f},
-std::array<float,2>{0.607472479f, 0.1211835f},
-std::array<float,2>{0.0628885403f, 0.585841656f},
-std::array<float,2>{0.190437645f, 0.423531145f},
-std::array<float,2>{0.692667782f, 0.846498132f},
-std::array<float,2>{0.874763548f, 0.0124034425f},
-std::array<float,2>{0.328860521f, 0.532045245f},
-std::array<float,2>{0.422481984f, 0.173626974f},
-std::array<float,2>{0.945419014f, 0.69250983f},
-std::array<float,2>{0.514299691f, 0.29189676f},
-std::array<float,2>{0.0455434099f, 0.992564559f},
-std::array<float,2>{0.113886975f, 0.090732187f},
-std::array<float,2>{0.579689503f, 0.622914314f},
-std::array<float,2>{0.925671637f, 0.466472566f},
-std::array<float,2>{0.446284711f, 0.798026919f},
-std::array<float,2>{0.264182597f, 0.356501341f},
-std::array<float,2>{0.753238142f, 0.898114443f},
-std::array<float,2>{0.632262528f, 0.21900323f},
-std::array<float,2>{0.165433735f, 0.657009304f},
-std::array<float,2>{0.0837391093f, 0.450715512f},
-std::array<float,2>{0.611931562f, 0.792708635f},
-std::array<float,2>{0.878352702f, 0.0647396222f},
-std::array<float,2>{0.486139387f, 0.599259079f},
-std::array<float,2>{0.311932653f, 0.242217585f},
-std::array<float,2>{0.790142834f, 0.672800004f},
-std::array<float,2>{0.670120835f, 0.367355436f},
-std::array<float,2>{0.151600584f, 0.881616294f},
-std::array<float,2>{0.236441776f, 0.0286861025f},
-std::array<float,2>{0.728326321f, 0.550297379f},
-std::array<float,2>{0.837758362f, 0.417990088f},
-std::array<float,2>{0.348540515f, 0.872036994f},
-std::array<float,2>{0.397000849f, 0.306618363f},
-std::array<float,2>{0.996969879f, 0.970236361f},
-std::array<float,2>{0.559545815f, 0.1586743f},
-std::array<float,2>{0.00553662609f, 0.716984153f},
-std::array<float,2>{0.184429124f, 0.338630229f},
-std::array<float,2>{0.652577996f, 0.90785265f},
-std::array<float,2>{0.773324788f, 0.194083989f},
-std::array<float,2>{0.269930243f, 0.627083719f},
-std::array<float,2>{0.455060512f, 0.103487328f},
-std::array<float,2>{0.919904351f, 0.577890992f},
-std::array<float,2>{0.565552175f, 0.499177486f},
-std::array<float,2>{0.0937570035f, 0.753876984f},
-std::array<float,2>{0.0608359799f, 0.129206017f},
-std::array<float,2>{0.516417205f, 0.743856609f},
-std::array<float,2>{0.964965403f, 0.264526665f},
-std::array<float,2>{0.415093064f, 0.965364754f},
-std::array<float,2>{0.313787669f, 0.396890432f},
-std::array<float,2>{0.851883352f, 0.81337744f},
-std::array<float,2>{0.709530354f, 0.0585454777f},
-std::array<float,2>{0.21413143f, 0.521862745f},
-std::array<float,2>{0.0806572139f, 0.273478329f},
-std::array<float,2>{0.614395022f, 0.941361725f},
-std::array<float,2>{0.882275879f, 0.148935392f},
-std::array<float,2>{0.490488112f, 0.732270539f},
-std::array<float,2>{0.307980776f, 0.0432677865f},
-std::array<float,2>{0.793817103f, 0.515543878f},
-std::array<float,2>{0.664630353f, 0.378869355f},
-std::array<float,2>{0.15288581f, 0.829289675f},
-std::array<float,2>{0.240507305f, 0.214030832f},
-std::array<float,2>{0.732463419f, 0.651823223f},
-std::array<float,2>{0.842646062f, 0.323334038f},
-std::array<float,2>{0.347278565f, 0.923867464f},
-std::array<float,2>{0.391221404f, 0.469346941f},
-std::array<float,2>{0.996038795f, 0.779977798f},
-std::array<float,2>{0.556189954f, 0.111784324f},
-std::array<float,2>{0.00303289481f, 0.586167514f},
-std::array<float,2>{0.180273652f, 0.43541649f},
-std::array<float,2>{0.652219594f, 0.854887962f},
-std::array<float,2>{0.766447008f, 0.00485069957f},
-std::array<float,2>{0.268230438f, 0.54521811f},
-std::array<float,2>{0.457674444f, 0.18495746f},
-std::array<float,2>{0.916315913f, 0.698930204f},
-std::array<float,2>{0.567753792f, 0.288823545f},
-std::array<float,2>{0.0999175832f, 0.987856686f},
-std::array<float,2>{0.0570692867f, 0.0789784119f},
-std::array<float,2>{0.522785902f, 0.615862131f},
-std::array<float,2>{0.9621948f, 0.458067179f},
-std::array<float,2>{0.419667602f, 0.805874944f},
-std::array<float,2>{0.316746086f, 0.345740378f},
-std::array<float,2>{0.858127415f, 0.904887557f},
-std::array<float,2>{0.705883086f, 0.232242465f},
-std::array<float,2>{0.218657643f, 0.664117634f},
-std::array<float,2>{0.023224378f, 0.443299949f},
-std::array<float,2>{0.532415688f, 0.781714022f},
-std::array<float,2>{0.972693026f, 0.075724259f},
-std::array<float,2>{0.385667205f, 0.605451882f},
-std::array<float,2>{0.36377579f, 0.240002438f},
-std::array<float,2>{0.82502234f, 0.685025573f},
-std::array<float,2>{0.74384594f, 0.364849746f},
-std::array<float,2>{0.221338302f, 0.888821304f},
-std::array<float,2>{0.125439554f, 0.0176763516f},
-std::array<float,2>{0.68360883f, 0.555835485f},
-std::array<float,2>{0.803717792f, 0.410992235f},
-std::array<float,2>{0.288009852f, 0.859506786f},
-std::array<float,2>{0.477363586f, 0.29819268f},
-std::array<float,2>{0.904210031f, 0.982452631f},
-std::array<float,2>{0.601964355f, 0.164761573f},
-std::array<float,2>{0.0679971427f, 0.70533967f},
-std::array<float,2>{0.193386361f, 0.330489427f},
-std::array<float,2>{0.689186394f, 0.917791784f},
-std::array<float,2>{0.869756043f, 0.197098166f},
-std::array<float,2>{0.333337486f, 0.638586581f},
-std::array<float,2>{0.427847922f, 0.0943867788f},
-std::array<float,2>{0.952575326f, 0.568122268f},
-std::array<float,2>{0.508050382f, 0.48976317f},
-std::array<float,2>{0.0429381765f, 0.764683306f},
-std::array<float,2>{0.112816177f, 0.136339411f},
-std::array<float,2>{0.583435059f, 0.737127781f},
-std::array<float,2>{0.926834881f, 0.256083161f},
-std::array<float,2>{0.45236969f, 0.960747957f},
-std::array<float,2>{0.258407205f, 0.402817637f},
-std::array<float,2>{0.7565552f, 0.821686566f},
-std::array<float,2>{0.626510322f, 0.0506540202f},
-std::array<float,2>{0.171815977f, 0.526389837f},
-std::array<float,2>{0.0350379534f, 0.374200732f},
-std::array<float,2>{0.505985975f, 0.87869072f},
-std::array<float,2>{0.939493954f, 0.24984479f},
-std::array<float,2>{0.433216095f, 0.678642869f},
-std::array<float,2>{0.341843158f, 0.0691576004f},
-std::array<float,2>{0.861706078f, 0.596144974f},
-std::array<float,2>{0.69682163f, 0.445715994f},
-std::array<float,2>{0.195413843f, 0.79635334f},
-std::array<float,2>{0.163827837f, 0.16376622f},
-std::array<float,2>{0.633073688f, 0.71383357f},
-std::array<float,2>{0.765604794f, 0.310716152f},
-std::array<float,2>{0.254371345f, 0.973575592f},
-std::array<float,2>{0.438633323f, 0.414244592f},
-std::array<float,2>{0.932581425f, 0.867529809f},
-std::array<float,2>{0.593381882f, 0.025052933f},
-std::array<float,2>{0.124741949f, 0.551933408f},
-std::array<float,2>{0.232885122f, 0.494500637f},
-std::array<float,2>{0.736126602f, 0.754451931f},
-std::array<float,2>{0.816405773f, 0.107851759f},
-std::array<float,2>{0.369759589f, 0.573897898f},
-std::array<float,2>{0.379434139f, 0.189964578f},
-std::array<float,2>{0.981841922f, 0.629529178f},
-std::array<float,2>{0.541319013f, 0.341040581f},
-std::array<float,2>{0.0252664797f, 0.91226691f},
-std::array<float,2>{0.0776166394f, 0.0615250543f},
-std::array<float,2>{0.599733531f, 0.515984118f},
-std::array<float,2>{0.893856704f, 0.394502759f},
-std::array<float,2>{0.470891893f, 0.819437802f},
-std::array<float,2>{0.29249841f, 0.258786708f},
-std::array<float,2>{0.805985987f, 0.961790681f},
-std::array<float,2>{0.676027179f, 0.128881544f},
-std::array<float,2>{0.135925278f, 0.746841311f},
-std::array<float,2>{0.106717862f, 0.385566235f},
-std::array<float,2>{0.57734555f, 0.836710811f},
-std::array<float,2>{0.911870658f, 0.0312792212f},
-std::array<float,2>{0.465572715f, 0.50616008f},
-std::array<float,2>{0.280521363f, 0.147850022f},
-std::array<float,2>{0.775616884f, 0.720610976f},
-std::array<float,2>{0.645415246f, 0.266350001f},
-std::array<float,2>{0.174026161f, 0.95139122f},
-std::array<float,2>{0.203944191f, 0.119282588f},
-std::array<float,2>{0.714514613f, 0.580877066f},
-std::array<float,2>{0.845819116f, 0.481902748f},
-std::array<float,2>{0.327455074f, 0.766022146f},
-std::array<float,2>{0.409326345f, 0.312767684f},
-std::array<float,2>{0.954859912f, 0.9346506f},
-std::array<float,2>{0.528404176f, 0.208167791f},
-std::array<float,2>{0.0496999659f, 0.643957257f},
-std::array<float,2>{0.145682231f, 0.294124335f},
-std::array<float,2>{0.661954463f, 0.999046683f},
-std::array<float,2>{0.78239876f, 0.177491382f},
-std::array<float,2>{0.303828955f, 0.69140029f},
-std::array<float,2>{0.496078074f, 0.0107023269f},
-std::array<float,2>{0.886234999f, 0.536123157f},
-std::array<float,2>{0.618650794f, 0.429016918f},
-std::array<float,2>{0.0921296403f, 0.850780964f},
-std::array<float,2>{0.010970111f, 0.224061042f},
-std::array<float,2>{0.553532779f, 0.664040387f},
-std::array<float,2>{0.985614896f, 0.354695678f},
-std::array<float,2>{0.403709799f, 0.892299056f},
-std::array<float,2>{0.354114324f, 0.462009192f},
-std::array<float,2>{0.830679178f, 0.80214268f},
-std::array<float,2>{0.718762815f, 0.0874585435f},
-std::array<float,2>{0.247328982f, 0.61763525f},
-std::array<float,2>{0.120882884f, 0.325975239f},
-std::array<float,2>{0.586262405f, 0.928779244f},
-std::array<float,2>{0.936057568f, 0.218660027f},
-std::array<float,2>{0.444367111f, 0.656184316f},
-std::array<float,2>{0.250956118f, 0.114078969f},
-std::array<float,2>{0.761664569f, 0.589852393f},
-std::array<float,2>{0.640111327f, 0.475523263f},
-std::array<float,2>{0.15665783f, 0.773679912f},
-std::array<float,2>{0.202224657f, 0.155651718f},
-std::array<float,2>{0.700108409f, 0.729026794f},
-std::array<float,2>{0.865760505f, 0.280721724f},
-std::array<float,2>{0.337174475f, 0.944642961f},
-std::array<float,2>{0.434307516f, 0.380124986f},
-std::array<float,2>{0.941453815f, 0.832184196f},
-std::array<float,2>{0.500644326f, 0.0412701517f},
-std::array<float,2>{0.0382580906f, 0.511049271f},
-std::array<float,2>{0.137195662f, 0.454892039f},
-std::array<float,2>{0.674979925f, 0.810815692f},
-std::array<float,2>{0.809396505f, 0.0828601345f},
-std::array<float,2>{0.294182628f, 0.609962761f},
-std::array<float,2>{0.473476887f, 0.226984873f},
-std::array<float,2>{0.895091176f, 0.668453753f},
-std::array<float,2>{0.597647846f, 0.348759502f},
-std::array<float,2>{0.0737787411f, 0.899674654f},
-std::array<float,2>{0.027882034f, 0.00161439739f},
-std::array<float,2>{0.545419037f, 0.542499423f},
-std::array<float,2>{0.977454782f, 0.431878328f},
-std::array<float,2>{0.378693461f, 0.856102824f},
-std::array<float,2>{0.374983102f, 0.281611472f},
-std::array<float,2>{0.817181408f, 0.988757908f},
-std::array<float,2>{0.741731644f, 0.180090189f},
-std::array<float,2>{0.229861364f, 0.700474799f},
-std::array<float,2>{0.0521202572f, 0.409158409f},
-std::array<float,2>{0.524641812f, 0.865563691f},
-std::array<float,2>{0.960494518f, 0.0215734113f},
-std::array<float,2>{0.411588699f, 0.5608266f},
-std::array<float,2>{0.321536422f, 0.171837538f},
-std::array<float,2>{0.849346757f, 0.710487247f},
-std::array<float,2>{0.716350079f, 0.304231435f},
-std::array<float,2>{0.210243836f, 0.976674259f},
-std::array<float,2>{0.179276362f, 0.0706202388f},
-std::array<float,2>{0.64132899f, 0.609218597f},
-std::array<float,2>{0.77896136f, 0.440676063f},
-std::array<float,2>{0.277338654f, 0.786101222f},
-std::array<float,2>{0.464239687f, 0.359417737f},
-std::array<float,2>{0.907793701f, 0.884942174f},
-std::array<float,2>{0.573779702f, 0.235405952f},
-std::array<float,2>{0.101721898f, 0.680315793f},
-std::array<float,2>{0.242918998f, 0.252985716f},
-std::array<float,2>{0.722988367f, 0.955306232f},
-std::array<float,2>{0.83230108f, 0.138552353f},
-std::array<float,2>{0.356301546f, 0.739690304f},
-std::array<float,2>{0.400003999f, 0.0533002988f},
-std::array<float,2>{0.989766061f, 0.529545844f},
-std::array<float,2>{0.549659193f, 0.399240345f},
-std::array<float,2>{0.0132480944f, 0.8273471f},
-std::array<float,2>{0.0897574052f, 0.201790571f},
-std::array<float,2>{0.624558091f, 0.634753346f},
-std::array<float,2>{0.886734664f, 0.332118422f},
-std::array<float,2>{0.498840928f, 0.91876775f},
-std::array<float,2>{0.297882825f, 0.486832947f},
-std::array<float,2>{0.787519872f, 0.759221256f},
-std::array<float,2>{0.659475625f, 0.101335362f},
-std::array<float,2>{0.141086027f, 0.562980533f},
-std::array<float,2>{0.00450225174f, 0.307544261f},
-std::array<float,2>{0.55957067f, 0.97219944f},
-std::array<float,2>{0.997529566f, 0.156924427f},
-std::array<float,2>{0.397997886f, 0.715782523f},
-std::array<float,2>{0.349182099f, 0.0307956636f},
-std::array<float,2>{0.836663067f, 0.548542798f},
-std::array<float,2>{0.726825953f, 0.420487165f},
-std::array<float,2>{0.23788546f, 0.874783456f},
-std::array<float,2>{0.150995433f, 0.244743481f},
-std::array<float,2>{0.671365857f, 0.674525023f},
-std::array<float,2>{0.790023565f, 0.370775938f},
-std::array<float,2>{0.311506003f, 0.880857646f},
-std::array<float,2>{0.484874099f, 0.452066392f},
-std::array<float,2>{0.877552807f, 0.790586412f},
-std::array<float,2>{0.612447441f, 0.0626937822f},
-std::array<float,2>{0.0825909898f, 0.600160778f},
-std::array<float,2>{0.213090241f, 0.395901084f},
-std::array<float,2>{0.710367203f, 0.814837694f},
-std::array<float,2>{0.852731049f, 0.055966258f},
-std::array<float,2>{0.312739044f, 0.519585311f},
-std::array<float,2>{0.414974719f, 0.13118504f},
-std::array<float,2>{0.966419339f, 0.744798422f},
-std::array<float,2>{0.516831577f, 0.263018578f},
-std::array<float,2>{0.0616795085f, 0.96821171f},
-std::array<float,2>{0.0948677957f, 0.104750052f},
-std::array<float,2>{0.565083802f, 0.57488519f},
-std::array<float,2>{0.918834686f, 0.497781307f},
-std::array<float,2>{0.453757882f, 0.750797391f},
-std::array<float,2>{0.270537376f, 0.336699039f},
-std::array<float,2>{0.771939814f, 0.910054207f},
-std::array<float,2>{0.653368652f, 0.193214625f},
-std::array<float,2>{0.185139969f, 0.626526117f},
-std::array<float,2>{0.0638297722f, 0.477619171f},
-std::array<float,2>{0.60932523f, 0.770938396f},
-std::array<float,2>{0.900601745f, 0.124234304f},
-std::array<float,2>{0.48057428f, 0.583300114f},
-std::array<float,2>{0.282094598f, 0.206799582f},
-std::array<float,2>{0.79930985f, 0.645082533f},
-std::array<float,2>{0.679889739f, 0.319836557f},
-std::array<float,2>{0.129366726f, 0.932759404f},
-std::array<float,2>{0.223340586f, 0.0387870558f},
-std::array<float,2>{0.747434795f, 0.502310753f},
-std::array<float,2>{0.820829093f, 0.389503121f},
-std::array<float,2>{0.36222589f, 0.841929078f},
-std::array<float,2>{0.390470266f, 0.270697594f},
-std::array<float,2>{0.970417142f, 0.945433736f},
-std::array<float,2>{0.537289917f, 0.142644957f},
-std::array<float,2>{0.0162097123f, 0.725200951f},
-std::array<float,2>{0.16461131f, 0.358455092f},
-std::array<float,2>{0.631483078f, 0.895726025f},
-std::array<float,2>{0.752106607f, 0.22079955f},
-std::array<float,2>{0.265264153f, 0.659254909f},
-std::array<float,2>{0.446740001f, 0.0935820714f},
-std::array<float,2>{0.924035132f, 0.623424113f},
-std::array<float,2>{0.578834116f, 0.466988504f},
-std::array<float,2>{0.115193203f, 0.79989326f},
-std::array<float,2>{0.0463127978f, 0.175115719f},
-std::array<float,2>{0.514893413f, 0.693481028f},
-std::array<float,2>{0.94662261f, 0.290886134f},
-std::array<float,2>{0.423384309f, 0.99479574f},
-std::array<float,2>{0.329577595f, 0.424194157f},
-std::array<float,2>{0.873087883f, 0.845561385f},
-std::array<float,2>{0.691939116f, 0.0143775549f},
-std::array<float,2>{0.190210328f, 0.535033226f},
-std::array<float,2>{0.0990920439f, 0.286857933f},
-std::array<float,2>{0.568453431f, 0.985384643f},
-std::array<float,2>{0.916007638f, 0.186343506f},
-std::array<float,2>{0.459212005f, 0.696970344f},
-std::array<float,2>{0.266324848f, 0.00628928654f},
-std::array<float,2>{0.768745124f, 0.543088198f},
-std::array<float,2>{0.649547756f, 0.436396033f},
-std::array<float,2>{0.182077527f, 0.853014052f},
-std::array<float,2>{0.216351345f, 0.233204454f},
-std::array<float,2>{0.703943431f, 0.666402936f},
-std::array<float,2>{0.85615176f, 0.344061881f},
-std::array<float,2>{0.319677889f, 0.902647853f},
-std::array<float,2>{0.421500772f, 0.460276097f},
-std::array<float,2>{0.96399051f, 0.807934284f},
-std::array<float,2>{0.520521283f, 0.0812753513f},
-std::array<float,2>{0.0548166931f, 0.615209281f},
-std::array<float,2>{0.154971644f, 0.375140995f},
-std::array<float,2>{0.66783762f, 0.831400454f},
-std::array<float,2>{0.796079159f, 0.0459182523f},
-std::array<float,2>{0.305798829f, 0.512589574f},
-std::array<float,2>{0.488709599f, 0.151744023f},
-std::array<float,2>{0.879321814f, 0.733459115f},
-std::array<float,2>{0.616051018f, 0.276947677f},
-std::array<float,2>{0.0787128732f, 0.939091206f},
-std::array<float,2>{7.73213615e-05f, 0.111326501f},
-std::array<float,2>{0.557800949f, 0.588918209f},
-std::array<float,2>{0.993531048f, 0.472620577f},
-std::array<float,2>{0.393217146f, 0.778111696f},
-std::array<float,2>{0.345275342f, 0.321500152f},
-std::array<float,2>{0.84037745f, 0.922885716f},
-std::array<float,2>{0.731102347f, 0.212671891f},
-std::array<float,2>{0.238568798f, 0.649157226f},
-std::array<float,2>{0.0391044095f, 0.490785062f},
-std::array<float,2>{0.510682404f, 0.762217641f},
-std::array<float,2>{0.950963378f, 0.0960049555f},
-std::array<float,2>{0.427030176f, 0.569907248f},
-std::array<float,2>{0.334418774f, 0.198361993f},
-std::array<float,2>{0.867955565f, 0.640563905f},
-std::array<float,2>{0.690611482f, 0.328780591f},
-std::array<float,2>{0.192757517f, 0.914500475f},
-std::array<float,2>{0.168972611f, 0.0476797298f},
-std::array<float,2>{0.628599286f, 0.524979591f},
-std::array<float,2>{0.755261898f, 0.404574573f},
-std::array<float,2>{0.26004073f, 0.822891057f},
-std::array<float,2>{0.450279742f, 0.254325867f},
-std::array<float,2>{0.92902112f, 0.957895994f},
-std::array<float,2>{0.58448267f, 0.133899018f},
-std::array<float,2>{0.110271536f, 0.735249162f},
-std::array<float,2>{0.219615549f, 0.366053641f},
-std::array<float,2>{0.744466245f, 0.887853444f},
-std::array<float,2>{0.826994777f, 0.241090804f},
-std::array<float,2>{0.365719438f, 0.685625136f},
-std::array<float,2>{0.38389954f, 0.0765401497f},
-std::array<float,2>{0.976265252f, 0.602518678f},
-std::array<float,2>{0.533958256f, 0.44518292f},
-std::array<float,2>{0.0210400838f, 0.783374608f},
-std::array<float,2>{0.0701390654f, 0.166578621f},
-std::array<float,2>{0.604417682f, 0.704638004f},
-std::array<float,2>{0.905982077f, 0.300589889f},
-std::array<float,2>{0.479385495f, 0.980677128f},
-std::array<float,2>{0.285811782f, 0.413143784f},
-std::array<float,2>{0.802104175f, 0.861752987f},
-std::array<float,2>{0.686758518f, 0.016220415f},
-std::array<float,2>{0.128462285f, 0.557080746f},
-std::array<float,2>{0.0263445899f, 0.343064159f},
-std::array<float,2>{0.540659845f, 0.911809027f},
-std::array<float,2>{0.982568979f, 0.18898043f},
-std::array<float,2>{0.38192597f, 0.632318437f},
-std::array<float,2>{0.36721155f, 0.106874719f},
-std::array<float,2>{0.813020229f, 0.570888698f},
-std::array<float,2>{0.738149464f, 0.492729813f},
-std::array<float,2>{0.231599569f, 0.756437659f},
-std::array<float,2>{0.134335339f, 0.126000181f},
-std::array<float,2>{0.679096997f, 0.749361575f},
-std::array<float,2>{0.808283091f, 0.25993222f},
-std::array<float,2>{0.290298939f, 0.96463424f},
-std::array<float,2>{0.470670193f, 0.391112059f},
-std::array<float,2>{0.890927136f, 0.81791687f},
-std::array<float,2>{0.598078787f, 0.0598484054f},
-std::array<float,2>{0.0761156976f, 0.518077493f},
-std::array<float,2>{0.19878161f, 0.449187815f},
-std::array<float,2>{0.698597968f, 0.793798983f},
-std::array<float,2>{0.860313356f, 0.067104198f},
-std::array<float,2>{0.341383547f, 0.59479785f},
-std::array<float,2>{0.431267291f, 0.247229829f},
-std::array<float,2>{0.938273787f, 0.676066995f},
-std::array<float,2>{0.505421817f, 0.371792823f},
-std::array<float,2>{0.0316568688f, 0.875059545f},
-std::array<float,2>{0.12219847f, 0.026949713f},
-std::array<float,2>{0.590587735f, 0.554391384f},
-std::array<float,2>{0.930382848f, 0.416105717f},
-std::array<float,2>{0.441365838f, 0.870088875f},
-std::array<float,2>{0.257625341f, 0.30859375f},
-std::array<float,2>{0.762433708f, 0.975040555f},
-std::array<float,2>{0.635463119f, 0.161491379f},
-std::array<float,2>{0.161351845f, 0.711583734f},
-std::array<float,2>{0.0917118266f, 0.42659232f},
-std::array<float,2>{0.620454907f, 0.848387361f},
-std::array<float,2>{0.883416116f, 0.00824026205f},
-std::array<float,2>{0.49396807f, 0.537934005f},
-std::array<float,2>{0.301298052f, 0.179580271f},
-std::array<float,2>{0.785038948f, 0.68821907f},
-std::array<float,2>{0.662214875f, 0.294986486f},
-std::array<float,2>{0.146741763f, 0.996776104f},
-std::array<float,2>{0.249989927f, 0.08864896f},
-std::array<float,2>{0.721966982f, 0.62080276f},
-std::array<float,2>{0.829140604f, 0.464098662f},
-std::array<float,2>{0.353442818f, 0.803251684f},
-std::array<float,2>{0.404853672f, 0.351940155f},
-std::array<float,2>{0.98725909f, 0.892982423f},
-std::array<float,2>{0.552551329f, 0.225209087f},
-std::array<float,2>{0.00825588126f, 0.66200906f},
-std::array<float,2>{0.172751918f, 0.268480957f},
-std::array<float,2>{0.647758365f, 0.950781822f},
-std::array<float,2>{0.774035335f, 0.146221668f},
-std::array<float,2>{0.277518123f, 0.721073866f},
-std::array<float,2>{0.468634307f, 0.0336754434f},
-std::array<float,2>{0.913056731f, 0.505583465f},
-std::array<float,2>{0.576085448f, 0.383543879f},
-std::array<float,2>{0.108977139f, 0.839795053f},
-std::array<float,2>{0.0488229655f, 0.210523486f},
-std::array<float,2>{0.529736459f, 0.642148256f},
-std::array<float,2>{0.95649153f, 0.31478548f},
-std::array<float,2>{0.407028884f, 0.936107278f},
-std::array<float,2>{0.325205088f, 0.483912826f},
-std::array<float,2>{0.844988286f, 0.767915785f},
-std::array<float,2>{0.711101353f, 0.117643118f},
-std::array<float,2>{0.206204623f, 0.578382432f},
-std::array<float,2>{0.0712594464f, 0.351292282f},
-std::array<float,2>{0.595479965f, 0.900731564f},
-std::array<float,2>{0.89735347f, 0.230140254f},
-std::array<float,2>{0.475968778f, 0.671503663f},
-std::array<float,2>{0.295622617f, 0.0849464908f},
-std::array<float,2>{0.811447859f, 0.611564815f},
-std::array<float,2>{0.672978401f, 0.456879973f},
-std::array<float,2>{0.140334427f, 0.809408426f},
-std::array<float,2>{0.227298483f, 0.182603523f},
-std::array<float,2>{0.74002111f, 0.701941073f},
-std::array<float,2>{0.818470716f, 0.283761114f},
-std::array<float,2>{0.371327937f, 0.992152393f},
-std::array<float,2>{0.376561761f, 0.431231201f},
-std::array<float,2>{0.979251146f, 0.85743916f},
-std::array<float,2>{0.54328233f, 0.00315684266f},
-std::array<float,2>{0.0303067584f, 0.540398955f},
-std::array<float,2>{0.159652188f, 0.474261999f},
-std::array<float,2>{0.638337553f, 0.77728802f},
-std::array<float,2>{0.758417726f, 0.116958275f},
-std::array<float,2>{0.25356552f, 0.592704296f},
-std::array<float,2>{0.44179067f, 0.216693938f},
-std::array<float,2>{0.934310496f, 0.652990222f},
-std::array<float,2>{0.589599609f, 0.327430069f},
-std::array<float,2>{0.118410684f, 0.926631451f},
-std::array<float,2>{0.0370202214f, 0.0398592651f},
-std::array<float,2>{0.502150178f, 0.50781405f},
-std::array<float,2>{0.944918096f, 0.381292135f},
-std::array<float,2>{0.43739596f, 0.83538419f},
-std::array<float,2>{0.339063615f, 0.278979659f},
-std::array<float,2>{0.864331484f, 0.942566693f},
-std::array<float,2>{0.701740921f, 0.153413147f},
-std::array<float,2>{0.199420333f, 0.726900518f},
-std::array<float,2>{0.0151837999f, 0.402138442f},
-std::array<float,2>{0.547935426f, 0.825724244f},
-std::array<float,2>{0.990435421f, 0.0510006621f},
-std::array<float,2>{0.401550561f, 0.527383208f},
-std::array<float,2>{0.357532114f, 0.13887848f},
-std::array<float,2>{0.83475101f, 0.741347969f},
-std::array<float,2>{0.724859595f, 0.250380635f},
-std::array<float,2>{0.244678184f, 0.954910219f},
-std::array<float,2>{0.143582776f, 0.0985232443f},
-std::array<float,2>{0.657364666f, 0.56549859f},
-std::array<float,2>{0.786277771f, 0.48524493f},
-std::array<float,2>{0.300653577f, 0.760762095f},
-std::array<float,2>{0.496614784f, 0.334837198f},
-std::array<float,2>{0.889487386f, 0.921675742f},
-std::array<float,2>{0.622395158f, 0.199431151f},
-std::array<float,2>{0.0875713006f, 0.635052443f},
-std::array<float,2>{0.207462147f, 0.302625418f},
-std::array<float,2>{0.718044162f, 0.97981441f},
-std::array<float,2>{0.850638568f, 0.16903156f},
-std::array<float,2>{0.32413736f, 0.708099127f},
-std::array<float,2>{0.413496464f, 0.0213643387f},
-std::array<float,2>{0.958494961f, 0.560313821f},
-std::array<float,2>{0.526242375f, 0.407485455f},
-std::array<float,2>{0.0545351952f, 0.863404989f},
-std::array<float,2>{0.103772528f, 0.238208845f},
-std::array<float,2>{0.571474552f, 0.683244765f},
-std::array<float,2>{0.909888089f, 0.362446696f},
-std::array<float,2>{0.461675882f, 0.883272588f},
-std::array<float,2>{0.275253177f, 0.437510222f},
-std::array<float,2>{0.780841529f, 0.788852572f},
-std::array<float,2>{0.643462896f, 0.0730814636f},
-std::array<float,2>{0.176372007f, 0.606491566f},
-std::array<float,2>{0.0588090271f, 0.26503247f},
-std::array<float,2>{0.517871022f, 0.966618776f},
-std::array<float,2>{0.967586398f, 0.130401477f},
-std::array<float,2>{0.417178869f, 0.742617428f},
-std::array<float,2>{0.31600377f, 0.0573959351f},
-std::array<float,2>{0.855461538f, 0.52283293f},
-std::array<float,2>{0.708767474f, 0.397671521f},
-std::array<float,2>{0.212135494f, 0.814223826f},
-std::array<float,2>{0.186516479f, 0.194618851f},
-std::array<float,2>{0.654433131f, 0.628724337f},
-std::array<float,2>{0.770572543f, 0.339607418f},
-std::array<float,2>{0.271867484f, 0.906870544f},
-std::array<float,2>{0.456567138f, 0.49821195f},
-std::array<float,2>{0.920170605f, 0.752762616f},
-std::array<float,2>{0.563887775f, 0.102113992f},
-std::array<float,2>{0.0965897441f, 0.576856852f},
-std::array<float,2>{0.235238522f, 0.419491827f},
-std::array<float,2>{0.729833066f, 0.872232497f},
-std::array<float,2>{0.839230418f, 0.0280758683f},
-std::array<float,2>{0.350603878f, 0.548974276f},
-std::array<float,2>{0.394895524f, 0.159377009f},
-std::array<float,2>{0.999425173f, 0.718331933f},
-std::array<float,2>{0.561124384f, 0.305635959f},
-std::array<float,2>{0.00687512103f, 0.969278693f},
-std::array<float,2>{0.0855647922f, 0.0656898022f},
-std::array<float,2>{0.61062026f, 0.598614812f},
-std::array<float,2>{0.875695288f, 0.449639887f},
-std::array<float,2>{0.48775214f, 0.791604757f},
-std::array<float,2>{0.309203953f, 0.368739635f},
-std::array<float,2>{0.791125476f, 0.882768393f},
-std::array<float,2>{0.669109344f, 0.244108737f},
-std::array<float,2>{0.148793846f, 0.673526525f},
-std::array<float,2>{0.115679346f, 0.465548038f},
-std::array<float,2>{0.581311345f, 0.797414184f},
-std::array<float,2>{0.923344433f, 0.0916031078f},
-std::array<float,2>{0.447671354f, 0.622010767f},
-std::array<float,2>{0.263022453f, 0.219890773f},
-std::array<float,2>{0.751838684f, 0.657991171f},
-std::array<float,2>{0.628957033f, 0.356131464f},
-std::array<float,2>{0.167146891f, 0.897318065f},
-std::array<float,2>{0.188296422f, 0.0133401072f},
-std::array<float,2>{0.694418907f, 0.532561123f},
-std::array<float,2>{0.871970952f, 0.421948284f},
-std::array<float,2>{0.331547797f, 0.847322822f},
-std::array<float,2>{0.424779296f, 0.292012006f},
-std::array<float,2>{0.948794901f, 0.993802845f},
-std::array<float,2>{0.512492061f, 0.17190592f},
-std::array<float,2>{0.0431793407f, 0.69152683f},
-std::array<float,2>{0.131764814f, 0.317741126f},
-std::array<float,2>{0.681797624f, 0.931042373f},
-std::array<float,2>{0.798549354f, 0.204366118f},
-std::array<float,2>{0.284288138f, 0.647879183f},
-std::array<float,2>{0.483577877f, 0.122311495f},
-std::array<float,2>{0.898688197f, 0.584463418f},
-std::array<float,2>{0.60697484f, 0.480382144f},
-std::array<float,2>{0.0649480447f, 0.77160579f},
-std::array<float,2>{0.0183770433f, 0.140878931f},
-std::array<float,2>{0.535793483f, 0.724087894f},
-std::array<float,2>{0.972442091f, 0.273284227f},
-std::array<float,2>{0.387317955f, 0.948775172f},
-std::array<float,2>{0.359448075f, 0.386761785f},
-std::array<float,2>{0.823863387f, 0.840363681f},
-std::array<float,2>{0.748132944f, 0.0352601632f},
-std::array<float,2>{0.225269333f, 0.500384569f}}
\ No newline at end of file
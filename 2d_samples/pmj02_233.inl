@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.641245127f, 0.425033092f},
-std::array<float,2>{0.00071931124f, 0.670953751f},
-std::array<float,2>{0.388680637f, 0.247971147f},
-std::array<float,2>{0.933783412f, 0.960398316f},
-std::array<float,2>{0.834824026f, 0.0832810029f},
-std::array<float,2>{0.347140193f, 0.8333233f},
-std::array<float,2>{0.138195887f, 0.346309274f},
-std::array<float,2>{0.615887165f, 0.5288468f},
-std::array<float,2>{0.509238362f, 0.125778511f},
-std::array<float,2>{0.224481806f, 0.900978982f},
-std::array<float,2>{0.274196714f, 0.474015474f},
-std::array<float,2>{0.776878238f, 0.747258961f},
-std::array<float,2>{0.987137079f, 0.253174931f},
-std::array<float,2>{0.484754682f, 0.588179886f},
-std::array<float,2>{0.0733324587f, 0.0555095561f},
-std::array<float,2>{0.725676656f, 0.804983377f},
-std::array<float,2>{0.578997076f, 0.328295439f},
-std::array<float,2>{0.156808004f, 0.556520998f},
-std::array<float,2>{0.319813728f, 0.121774957f},
-std::array<float,2>{0.860415101f, 0.853091836f},
-std::array<float,2>{0.892882347f, 0.201904848f},
-std::array<float,2>{0.421225399f, 0.97302413f},
-std::array<float,2>{0.0524201319f, 0.390423238f},
-std::array<float,2>{0.656977832f, 0.633235991f},
-std::array<float,2>{0.69316256f, 0.00784355029f},
-std::array<float,2>{0.11616274f, 0.754077017f},
-std::array<float,2>{0.458971709f, 0.28399989f},
-std::array<float,2>{0.967870593f, 0.608268857f},
-std::array<float,2>{0.788736105f, 0.452344388f},
-std::array<float,2>{0.309534281f, 0.696510613f},
-std::array<float,2>{0.201547861f, 0.186699614f},
-std::array<float,2>{0.549816847f, 0.92024076f},
-std::array<float,2>{0.745216668f, 0.312172174f},
-std::array<float,2>{0.0931517035f, 0.621503234f},
-std::array<float,2>{0.477098167f, 0.0308579542f},
-std::array<float,2>{0.975975752f, 0.777920663f},
-std::array<float,2>{0.750409603f, 0.158099294f},
-std::array<float,2>{0.2510162f, 0.924839258f},
-std::array<float,2>{0.242333204f, 0.455827892f},
-std::array<float,2>{0.526163697f, 0.707880855f},
-std::array<float,2>{0.604795039f, 0.101688996f},
-std::array<float,2>{0.15134038f, 0.868713975f},
-std::array<float,2>{0.368736267f, 0.320899874f},
-std::array<float,2>{0.814429045f, 0.538574696f},
-std::array<float,2>{0.917565167f, 0.393638045f},
-std::array<float,2>{0.404669702f, 0.651832283f},
-std::array<float,2>{0.0193716064f, 0.203910932f},
-std::array<float,2>{0.633845091f, 0.989926815f},
-std::array<float,2>{0.541919887f, 0.493303388f},
-std::array<float,2>{0.214556977f, 0.72572571f},
-std::array<float,2>{0.296251893f, 0.147151113f},
-std::array<float,2>{0.810040057f, 0.881878495f},
-std::array<float,2>{0.941364884f, 0.0331350081f},
-std::array<float,2>{0.438753963f, 0.790753603f},
-std::array<float,2>{0.0949157327f, 0.266583085f},
-std::array<float,2>{0.708674908f, 0.56391871f},
-std::array<float,2>{0.673998594f, 0.231917858f},
-std::array<float,2>{0.0342684537f, 0.945659518f},
-std::array<float,2>{0.434475631f, 0.407535344f},
-std::array<float,2>{0.887628734f, 0.683425903f},
-std::array<float,2>{0.845047653f, 0.368301481f},
-std::array<float,2>{0.330971897f, 0.503170252f},
-std::array<float,2>{0.181952998f, 0.0750456825f},
-std::array<float,2>{0.564407587f, 0.819434404f},
-std::array<float,2>{0.717907429f, 0.46212396f},
-std::array<float,2>{0.108118728f, 0.716750145f},
-std::array<float,2>{0.446016222f, 0.164881825f},
-std::array<float,2>{0.948658347f, 0.931336462f},
-std::array<float,2>{0.803530276f, 0.0219646264f},
-std::array<float,2>{0.284604192f, 0.76832974f},
-std::array<float,2>{0.208984539f, 0.302627653f},
-std::array<float,2>{0.533650815f, 0.612709463f},
-std::array<float,2>{0.571871161f, 0.211378485f},
-std::array<float,2>{0.174822703f, 0.994333982f},
-std::array<float,2>{0.341761112f, 0.399404556f},
-std::array<float,2>{0.851947546f, 0.642490745f},
-std::array<float,2>{0.876003921f, 0.315363467f},
-std::array<float,2>{0.424258351f, 0.543118f},
-std::array<float,2>{0.039210692f, 0.0997625515f},
-std::array<float,2>{0.681383729f, 0.864489734f},
-std::array<float,2>{0.518994927f, 0.275417149f},
-std::array<float,2>{0.237955391f, 0.573832095f},
-std::array<float,2>{0.259195566f, 0.0407299437f},
-std::array<float,2>{0.759545147f, 0.785622239f},
-std::array<float,2>{0.984022856f, 0.153777882f},
-std::array<float,2>{0.471342027f, 0.883796215f},
-std::array<float,2>{0.079223983f, 0.491773725f},
-std::array<float,2>{0.739766121f, 0.733554959f},
-std::array<float,2>{0.62638998f, 0.0677737221f},
-std::array<float,2>{0.0274638087f, 0.824040473f},
-std::array<float,2>{0.398147672f, 0.359669715f},
-std::array<float,2>{0.906493664f, 0.510168612f},
-std::array<float,2>{0.827563941f, 0.415424943f},
-std::array<float,2>{0.361673355f, 0.674812078f},
-std::array<float,2>{0.14078939f, 0.222518265f},
-std::array<float,2>{0.596331656f, 0.94314599f},
-std::array<float,2>{0.67059052f, 0.355234087f},
-std::array<float,2>{0.0570713952f, 0.522768497f},
-std::array<float,2>{0.406888783f, 0.0931397304f},
-std::array<float,2>{0.90478766f, 0.836568832f},
-std::array<float,2>{0.87079066f, 0.235083237f},
-std::array<float,2>{0.322046816f, 0.967792213f},
-std::array<float,2>{0.170956552f, 0.433834672f},
-std::array<float,2>{0.588819981f, 0.660684466f},
-std::array<float,2>{0.55689007f, 0.0506603271f},
-std::array<float,2>{0.18925637f, 0.801785409f},
-std::array<float,2>{0.29728049f, 0.26511088f},
-std::array<float,2>{0.792412102f, 0.578561485f},
-std::array<float,2>{0.955879271f, 0.477752447f},
-std::array<float,2>{0.466360331f, 0.735768139f},
-std::array<float,2>{0.119986616f, 0.136904508f},
-std::array<float,2>{0.697376549f, 0.896226943f},
-std::array<float,2>{0.622479796f, 0.377368033f},
-std::array<float,2>{0.130363703f, 0.626692057f},
-std::array<float,2>{0.35202834f, 0.187616006f},
-std::array<float,2>{0.839579642f, 0.978195906f},
-std::array<float,2>{0.92644012f, 0.115260266f},
-std::array<float,2>{0.37591508f, 0.845065415f},
-std::array<float,2>{0.0085140625f, 0.338621289f},
-std::array<float,2>{0.652410626f, 0.551009357f},
-std::array<float,2>{0.731155872f, 0.172330856f},
-std::array<float,2>{0.0695858896f, 0.907335043f},
-std::array<float,2>{0.495230377f, 0.443606526f},
-std::array<float,2>{0.99712497f, 0.690764666f},
-std::array<float,2>{0.772271574f, 0.294843912f},
-std::array<float,2>{0.268655926f, 0.595918417f},
-std::array<float,2>{0.228471205f, 0.00233351975f},
-std::array<float,2>{0.502544999f, 0.763322294f},
-std::array<float,2>{0.719274044f, 0.403102577f},
-std::array<float,2>{0.0774005577f, 0.645083606f},
-std::array<float,2>{0.491682053f, 0.215149015f},
-std::array<float,2>{0.989014924f, 0.999645054f},
-std::array<float,2>{0.77842772f, 0.0970729142f},
-std::array<float,2>{0.278996438f, 0.862740815f},
-std::array<float,2>{0.220813408f, 0.316470325f},
-std::array<float,2>{0.512674451f, 0.539379835f},
-std::array<float,2>{0.610945284f, 0.168069482f},
-std::array<float,2>{0.136211723f, 0.935917258f},
-std::array<float,2>{0.349009931f, 0.467623591f},
-std::array<float,2>{0.831353128f, 0.71446079f},
-std::array<float,2>{0.932037473f, 0.298830599f},
-std::array<float,2>{0.385604918f, 0.615624487f},
-std::array<float,2>{0.0049756784f, 0.0161832068f},
-std::array<float,2>{0.647856534f, 0.770803928f},
-std::array<float,2>{0.552450359f, 0.363948882f},
-std::array<float,2>{0.198895633f, 0.515353084f},
-std::array<float,2>{0.305523813f, 0.0637980774f},
-std::array<float,2>{0.783935905f, 0.826405287f},
-std::array<float,2>{0.964271069f, 0.223423645f},
-std::array<float,2>{0.455341518f, 0.938270628f},
-std::array<float,2>{0.111847237f, 0.421681166f},
-std::array<float,2>{0.690278649f, 0.678612649f},
-std::array<float,2>{0.6607216f, 0.0465561934f},
-std::array<float,2>{0.0480988733f, 0.783560514f},
-std::array<float,2>{0.415038615f, 0.280153155f},
-std::array<float,2>{0.897376776f, 0.577533841f},
-std::array<float,2>{0.86471945f, 0.48673448f},
-std::array<float,2>{0.315091312f, 0.730428457f},
-std::array<float,2>{0.163968056f, 0.149974942f},
-std::array<float,2>{0.585641742f, 0.889799535f},
-std::array<float,2>{0.638525903f, 0.259062022f},
-std::array<float,2>{0.0214756168f, 0.584342241f},
-std::array<float,2>{0.400758862f, 0.0530430861f},
-std::array<float,2>{0.921345472f, 0.79948467f},
-std::array<float,2>{0.817466676f, 0.132929087f},
-std::array<float,2>{0.372149229f, 0.890861094f},
-std::array<float,2>{0.152889088f, 0.483416647f},
-std::array<float,2>{0.606231511f, 0.741852045f},
-std::array<float,2>{0.529629946f, 0.08889772f},
-std::array<float,2>{0.246917039f, 0.843149662f},
-std::array<float,2>{0.256334066f, 0.359320283f},
-std::array<float,2>{0.757677853f, 0.518273652f},
-std::array<float,2>{0.972504139f, 0.432024181f},
-std::array<float,2>{0.48245731f, 0.657079041f},
-std::array<float,2>{0.0864958242f, 0.240792811f},
-std::array<float,2>{0.746363938f, 0.961166799f},
-std::array<float,2>{0.568767905f, 0.439296812f},
-std::array<float,2>{0.18552421f, 0.694693565f},
-std::array<float,2>{0.332843602f, 0.176678717f},
-std::array<float,2>{0.84827286f, 0.910472035f},
-std::array<float,2>{0.885222554f, 0.00643787766f},
-std::array<float,2>{0.432113051f, 0.759524167f},
-std::array<float,2>{0.0355429687f, 0.292587548f},
-std::array<float,2>{0.677014291f, 0.600134075f},
-std::array<float,2>{0.705311596f, 0.19205676f},
-std::array<float,2>{0.0979046151f, 0.981789649f},
-std::array<float,2>{0.443063766f, 0.380714118f},
-std::array<float,2>{0.943226337f, 0.62948662f},
-std::array<float,2>{0.807518661f, 0.341619253f},
-std::array<float,2>{0.290827185f, 0.549270868f},
-std::array<float,2>{0.217141166f, 0.113060914f},
-std::array<float,2>{0.544260263f, 0.850843787f},
-std::array<float,2>{0.685231447f, 0.470437169f},
-std::array<float,2>{0.04578951f, 0.745750785f},
-std::array<float,2>{0.428355962f, 0.129849181f},
-std::array<float,2>{0.88230896f, 0.904429317f},
-std::array<float,2>{0.857122362f, 0.0597604327f},
-std::array<float,2>{0.338005006f, 0.811305046f},
-std::array<float,2>{0.176261812f, 0.25755325f},
-std::array<float,2>{0.574439883f, 0.592377186f},
-std::array<float,2>{0.53568548f, 0.243333101f},
-std::array<float,2>{0.205481797f, 0.953648329f},
-std::array<float,2>{0.288713485f, 0.429612011f},
-std::array<float,2>{0.797396302f, 0.665183365f},
-std::array<float,2>{0.952106416f, 0.349015832f},
-std::array<float,2>{0.451539099f, 0.524378777f},
-std::array<float,2>{0.10476847f, 0.0804893449f},
-std::array<float,2>{0.711858571f, 0.828664422f},
-std::array<float,2>{0.597808063f, 0.288089514f},
-std::array<float,2>{0.145839214f, 0.604672909f},
-std::array<float,2>{0.363370746f, 0.0134397093f},
-std::array<float,2>{0.823704839f, 0.75300765f},
-std::array<float,2>{0.912283242f, 0.183304086f},
-std::array<float,2>{0.390907824f, 0.914069414f},
-std::array<float,2>{0.0253752582f, 0.446792185f},
-std::array<float,2>{0.630676389f, 0.701832771f},
-std::array<float,2>{0.737756014f, 0.118087292f},
-std::array<float,2>{0.0832357854f, 0.858547509f},
-std::array<float,2>{0.476037443f, 0.332983077f},
-std::array<float,2>{0.979698122f, 0.560090005f},
-std::array<float,2>{0.765041232f, 0.383124799f},
-std::array<float,2>{0.263887674f, 0.639939904f},
-std::array<float,2>{0.241422728f, 0.195429146f},
-std::array<float,2>{0.520402312f, 0.970710874f},
-std::array<float,2>{0.700249672f, 0.324356675f},
-std::array<float,2>{0.122180156f, 0.532681167f},
-std::array<float,2>{0.462098569f, 0.105757676f},
-std::array<float,2>{0.957179248f, 0.874375045f},
-std::array<float,2>{0.793109417f, 0.209307879f},
-std::array<float,2>{0.301172197f, 0.987914979f},
-std::array<float,2>{0.193744406f, 0.3973037f},
-std::array<float,2>{0.561073959f, 0.655771673f},
-std::array<float,2>{0.592090547f, 0.0253014918f},
-std::array<float,2>{0.165302441f, 0.774126351f},
-std::array<float,2>{0.32488054f, 0.30546698f},
-std::array<float,2>{0.871625781f, 0.619244516f},
-std::array<float,2>{0.899019957f, 0.459849954f},
-std::array<float,2>{0.41081059f, 0.704506338f},
-std::array<float,2>{0.0615932271f, 0.160603061f},
-std::array<float,2>{0.666709542f, 0.927866995f},
-std::array<float,2>{0.506574571f, 0.411050618f},
-std::array<float,2>{0.233836353f, 0.686795771f},
-std::array<float,2>{0.269933552f, 0.229810447f},
-std::array<float,2>{0.766229272f, 0.949647009f},
-std::array<float,2>{0.992343843f, 0.0729513243f},
-std::array<float,2>{0.498816073f, 0.813384891f},
-std::array<float,2>{0.0644067302f, 0.372508705f},
-std::array<float,2>{0.727402568f, 0.504364073f},
-std::array<float,2>{0.650711f, 0.14101094f},
-std::array<float,2>{0.0130495913f, 0.877236366f},
-std::array<float,2>{0.379499257f, 0.498203754f},
-std::array<float,2>{0.923605442f, 0.71879065f},
-std::array<float,2>{0.842636049f, 0.27047646f},
-std::array<float,2>{0.358860046f, 0.56645292f},
-std::array<float,2>{0.127725556f, 0.0365082882f},
-std::array<float,2>{0.618322968f, 0.793940008f},
-std::array<float,2>{0.659690499f, 0.387996703f},
-std::array<float,2>{0.0542871319f, 0.635811567f},
-std::array<float,2>{0.41818431f, 0.200175628f},
-std::array<float,2>{0.89076066f, 0.976545513f},
-std::array<float,2>{0.861476839f, 0.123385005f},
-std::array<float,2>{0.317893922f, 0.85450089f},
-std::array<float,2>{0.158485636f, 0.330473781f},
-std::array<float,2>{0.581884682f, 0.557126462f},
-std::array<float,2>{0.547815382f, 0.184611529f},
-std::array<float,2>{0.200513005f, 0.919665158f},
-std::array<float,2>{0.311571926f, 0.450523049f},
-std::array<float,2>{0.786164403f, 0.699021339f},
-std::array<float,2>{0.966440678f, 0.282159865f},
-std::array<float,2>{0.460480005f, 0.606761456f},
-std::array<float,2>{0.114554822f, 0.0109753618f},
-std::array<float,2>{0.694574893f, 0.755950332f},
-std::array<float,2>{0.615015924f, 0.344679415f},
-std::array<float,2>{0.140261829f, 0.531147301f},
-std::array<float,2>{0.343925148f, 0.0859227702f},
-std::array<float,2>{0.832508385f, 0.835912824f},
-std::array<float,2>{0.93604207f, 0.248381495f},
-std::array<float,2>{0.387398034f, 0.958769083f},
-std::array<float,2>{0.00230295677f, 0.422249496f},
-std::array<float,2>{0.643110693f, 0.669685066f},
-std::array<float,2>{0.723904371f, 0.0585703775f},
-std::array<float,2>{0.0710612163f, 0.808099687f},
-std::array<float,2>{0.487992287f, 0.251147598f},
-std::array<float,2>{0.985249341f, 0.586263895f},
-std::array<float,2>{0.77378726f, 0.474928588f},
-std::array<float,2>{0.2768206f, 0.749802649f},
-std::array<float,2>{0.224754661f, 0.12828207f},
-std::array<float,2>{0.510700524f, 0.900243819f},
-std::array<float,2>{0.709264219f, 0.268497407f},
-std::array<float,2>{0.0973160341f, 0.565472126f},
-std::array<float,2>{0.440773815f, 0.0339764319f},
-std::array<float,2>{0.938347518f, 0.791656852f},
-std::array<float,2>{0.812309027f, 0.145658433f},
-std::array<float,2>{0.294888556f, 0.879302323f},
-std::array<float,2>{0.211481258f, 0.494784713f},
-std::array<float,2>{0.53957516f, 0.722768605f},
-std::array<float,2>{0.565150261f, 0.0778528079f},
-std::array<float,2>{0.180245161f, 0.817697465f},
-std::array<float,2>{0.329864055f, 0.36972338f},
-std::array<float,2>{0.84607929f, 0.500527918f},
-std::array<float,2>{0.888811052f, 0.40986228f},
-std::array<float,2>{0.436027437f, 0.679721236f},
-std::array<float,2>{0.0316668674f, 0.232780457f},
-std::array<float,2>{0.673717916f, 0.947419405f},
-std::array<float,2>{0.52449882f, 0.453125358f},
-std::array<float,2>{0.245518044f, 0.709456205f},
-std::array<float,2>{0.252777427f, 0.15893963f},
-std::array<float,2>{0.75200814f, 0.922054589f},
-std::array<float,2>{0.973752975f, 0.0288567469f},
-std::array<float,2>{0.479218721f, 0.780703366f},
-std::array<float,2>{0.0914724544f, 0.308985233f},
-std::array<float,2>{0.743666351f, 0.623165429f},
-std::array<float,2>{0.635498405f, 0.206814066f},
-std::array<float,2>{0.0158777162f, 0.991125047f},
-std::array<float,2>{0.402563155f, 0.391739488f},
-std::array<float,2>{0.914777935f, 0.648721039f},
-std::array<float,2>{0.815277934f, 0.323156029f},
-std::array<float,2>{0.370375544f, 0.537076771f},
-std::array<float,2>{0.150163263f, 0.104294047f},
-std::array<float,2>{0.602754593f, 0.869840205f},
-std::array<float,2>{0.740393758f, 0.488639325f},
-std::array<float,2>{0.0810122341f, 0.730526984f},
-std::array<float,2>{0.470174998f, 0.155344248f},
-std::array<float,2>{0.982358634f, 0.884903252f},
-std::array<float,2>{0.761400819f, 0.0411448069f},
-std::array<float,2>{0.259967983f, 0.788450718f},
-std::array<float,2>{0.23538661f, 0.27373457f},
-std::array<float,2>{0.516987383f, 0.571960509f},
-std::array<float,2>{0.594309151f, 0.21933049f},
-std::array<float,2>{0.142633945f, 0.94374305f},
-std::array<float,2>{0.36030367f, 0.416788518f},
-std::array<float,2>{0.824833751f, 0.673789442f},
-std::array<float,2>{0.909542918f, 0.363042712f},
-std::array<float,2>{0.396392554f, 0.508752704f},
-std::array<float,2>{0.0306726992f, 0.0683599114f},
-std::array<float,2>{0.628902376f, 0.821762145f},
-std::array<float,2>{0.531769514f, 0.304231644f},
-std::array<float,2>{0.208260968f, 0.611308455f},
-std::array<float,2>{0.282878071f, 0.0196521338f},
-std::array<float,2>{0.801562846f, 0.767091215f},
-std::array<float,2>{0.945511758f, 0.166949987f},
-std::array<float,2>{0.448731214f, 0.931769907f},
-std::array<float,2>{0.106160343f, 0.463397771f},
-std::array<float,2>{0.715533078f, 0.718279779f},
-std::array<float,2>{0.683593154f, 0.099005945f},
-std::array<float,2>{0.0410917662f, 0.866722703f},
-std::array<float,2>{0.422596902f, 0.312624037f},
-std::array<float,2>{0.878899157f, 0.546736777f},
-std::array<float,2>{0.855428755f, 0.400658131f},
-std::array<float,2>{0.342334479f, 0.64391768f},
-std::array<float,2>{0.17214717f, 0.214713112f},
-std::array<float,2>{0.572546363f, 0.992836416f},
-std::array<float,2>{0.65484643f, 0.336690515f},
-std::array<float,2>{0.00994978286f, 0.554000318f},
-std::array<float,2>{0.378477305f, 0.113704756f},
-std::array<float,2>{0.928952038f, 0.847041488f},
-std::array<float,2>{0.836536348f, 0.190050647f},
-std::array<float,2>{0.353988498f, 0.979089141f},
-std::array<float,2>{0.131727695f, 0.375170857f},
-std::array<float,2>{0.624740481f, 0.627887547f},
-std::array<float,2>{0.500798464f, 0.000442319695f},
-std::array<float,2>{0.229869485f, 0.765044928f},
-std::array<float,2>{0.265903682f, 0.296132118f},
-std::array<float,2>{0.770225763f, 0.594280541f},
-std::array<float,2>{0.99898386f, 0.442500383f},
-std::array<float,2>{0.49241063f, 0.688093841f},
-std::array<float,2>{0.0671221018f, 0.17473723f},
-std::array<float,2>{0.732523561f, 0.908950806f},
-std::array<float,2>{0.587825537f, 0.436093837f},
-std::array<float,2>{0.169561505f, 0.663027108f},
-std::array<float,2>{0.322724611f, 0.237569615f},
-std::array<float,2>{0.868568301f, 0.965375721f},
-std::array<float,2>{0.902832687f, 0.090047352f},
-std::array<float,2>{0.409641147f, 0.83978951f},
-std::array<float,2>{0.0555153228f, 0.352316022f},
-std::array<float,2>{0.668311238f, 0.521254063f},
-std::array<float,2>{0.696084797f, 0.139430583f},
-std::array<float,2>{0.118605554f, 0.896618783f},
-std::array<float,2>{0.468471199f, 0.479671478f},
-std::array<float,2>{0.954683542f, 0.737747908f},
-std::array<float,2>{0.790733755f, 0.26190424f},
-std::array<float,2>{0.300525695f, 0.58148855f},
-std::array<float,2>{0.191062972f, 0.0477447659f},
-std::array<float,2>{0.555952668f, 0.80410248f},
-std::array<float,2>{0.688165188f, 0.419741273f},
-std::array<float,2>{0.109415181f, 0.675907969f},
-std::array<float,2>{0.453511119f, 0.224902704f},
-std::array<float,2>{0.962108731f, 0.939459026f},
-std::array<float,2>{0.782791138f, 0.0658118278f},
-std::array<float,2>{0.306789011f, 0.82543695f},
-std::array<float,2>{0.195890397f, 0.366573393f},
-std::array<float,2>{0.553042233f, 0.512445033f},
-std::array<float,2>{0.582202911f, 0.151015177f},
-std::array<float,2>{0.160315365f, 0.888289213f},
-std::array<float,2>{0.313901663f, 0.485944033f},
-std::array<float,2>{0.866234481f, 0.728235543f},
-std::array<float,2>{0.89606601f, 0.278502345f},
-std::array<float,2>{0.416640043f, 0.575492859f},
-std::array<float,2>{0.0495872609f, 0.043060489f},
-std::array<float,2>{0.663716614f, 0.7813797f},
-std::array<float,2>{0.515623271f, 0.319556266f},
-std::array<float,2>{0.220484853f, 0.541483402f},
-std::array<float,2>{0.280921638f, 0.0956910476f},
-std::array<float,2>{0.779767394f, 0.861078322f},
-std::array<float,2>{0.990670741f, 0.21717836f},
-std::array<float,2>{0.48861295f, 0.997902751f},
-std::array<float,2>{0.0746837482f, 0.405796081f},
-std::array<float,2>{0.721597314f, 0.647139728f},
-std::array<float,2>{0.645374179f, 0.0180752408f},
-std::array<float,2>{0.00639585685f, 0.772064567f},
-std::array<float,2>{0.383588284f, 0.298370302f},
-std::array<float,2>{0.930143535f, 0.613526583f},
-std::array<float,2>{0.828826368f, 0.465491563f},
-std::array<float,2>{0.350226492f, 0.711849391f},
-std::array<float,2>{0.133437172f, 0.170206577f},
-std::array<float,2>{0.611463368f, 0.933897376f},
-std::array<float,2>{0.678665757f, 0.290316015f},
-std::array<float,2>{0.0385362245f, 0.599330187f},
-std::array<float,2>{0.430041134f, 0.00408931216f},
-std::array<float,2>{0.884342134f, 0.760447919f},
-std::array<float,2>{0.850434482f, 0.179188892f},
-std::array<float,2>{0.334296495f, 0.912769258f},
-std::array<float,2>{0.185689062f, 0.439802468f},
-std::array<float,2>{0.567619801f, 0.691752076f},
-std::array<float,2>{0.546028376f, 0.110790521f},
-std::array<float,2>{0.216377079f, 0.849213183f},
-std::array<float,2>{0.29282093f, 0.342584252f},
-std::array<float,2>{0.804871798f, 0.546939492f},
-std::array<float,2>{0.943683624f, 0.381236166f},
-std::array<float,2>{0.443651706f, 0.632004499f},
-std::array<float,2>{0.100031078f, 0.193698809f},
-std::array<float,2>{0.703451216f, 0.984197259f},
-std::array<float,2>{0.608038604f, 0.48221764f},
-std::array<float,2>{0.155305386f, 0.740079284f},
-std::array<float,2>{0.37346229f, 0.135013923f},
-std::array<float,2>{0.818475246f, 0.892642558f},
-std::array<float,2>{0.918447554f, 0.0510222204f},
-std::array<float,2>{0.399818271f, 0.798579335f},
-std::array<float,2>{0.0221628398f, 0.261326939f},
-std::array<float,2>{0.640543461f, 0.582968295f},
-std::array<float,2>{0.748317838f, 0.238347217f},
-std::array<float,2>{0.0897397175f, 0.964035392f},
-std::array<float,2>{0.481465012f, 0.430665553f},
-std::array<float,2>{0.96879822f, 0.658792138f},
-std::array<float,2>{0.754544318f, 0.357376158f},
-std::array<float,2>{0.255046606f, 0.51569587f},
-std::array<float,2>{0.249466747f, 0.0868235752f},
-std::array<float,2>{0.528863251f, 0.841371477f},
-std::array<float,2>{0.631973624f, 0.448572814f},
-std::array<float,2>{0.0265540052f, 0.700667083f},
-std::array<float,2>{0.394193918f, 0.180048361f},
-std::array<float,2>{0.910403252f, 0.916565299f},
-std::array<float,2>{0.821457744f, 0.0146809584f},
-std::array<float,2>{0.366960675f, 0.750535965f},
-std::array<float,2>{0.147071332f, 0.285611302f},
-std::array<float,2>{0.600070775f, 0.603219569f},
-std::array<float,2>{0.522467554f, 0.19920747f},
-std::array<float,2>{0.238602966f, 0.969301939f},
-std::array<float,2>{0.263655245f, 0.386111289f},
-std::array<float,2>{0.763242185f, 0.637490034f},
-std::array<float,2>{0.977515042f, 0.334457815f},
-std::array<float,2>{0.472835302f, 0.56200695f},
-std::array<float,2>{0.0845619366f, 0.120219551f},
-std::array<float,2>{0.735310435f, 0.856126964f},
-std::array<float,2>{0.576358318f, 0.254805505f},
-std::array<float,2>{0.179117948f, 0.591765523f},
-std::array<float,2>{0.337279767f, 0.0623021536f},
-std::array<float,2>{0.858363688f, 0.810043395f},
-std::array<float,2>{0.878994882f, 0.130978763f},
-std::array<float,2>{0.427103937f, 0.902984738f},
-std::array<float,2>{0.0442410968f, 0.472462773f},
-std::array<float,2>{0.686281562f, 0.743760288f},
-std::array<float,2>{0.714492023f, 0.0795991197f},
-std::array<float,2>{0.102696128f, 0.830507755f},
-std::array<float,2>{0.450685441f, 0.35095793f},
-std::array<float,2>{0.950575531f, 0.526224375f},
-std::array<float,2>{0.800089836f, 0.427265376f},
-std::array<float,2>{0.286990315f, 0.666087091f},
-std::array<float,2>{0.204234362f, 0.245278686f},
-std::array<float,2>{0.538740396f, 0.956643283f},
-std::array<float,2>{0.730311036f, 0.374326587f},
-std::array<float,2>{0.0659955218f, 0.505919755f},
-std::array<float,2>{0.497108281f, 0.0703960732f},
-std::array<float,2>{0.995767832f, 0.815379441f},
-std::array<float,2>{0.767884791f, 0.226978898f},
-std::array<float,2>{0.273406774f, 0.951538742f},
-std::array<float,2>{0.231203958f, 0.412842214f},
-std::array<float,2>{0.504253089f, 0.684232116f},
-std::array<float,2>{0.620374024f, 0.038538903f},
-std::array<float,2>{0.125659734f, 0.795688033f},
-std::array<float,2>{0.356175512f, 0.27307412f},
-std::array<float,2>{0.840005398f, 0.568507493f},
-std::array<float,2>{0.9253636f, 0.496201068f},
-std::array<float,2>{0.382717401f, 0.722097576f},
-std::array<float,2>{0.0153700328f, 0.143428966f},
-std::array<float,2>{0.650218487f, 0.875463426f},
-std::array<float,2>{0.559516907f, 0.396358907f},
-std::array<float,2>{0.192086384f, 0.65307951f},
-std::array<float,2>{0.303054839f, 0.208076537f},
-std::array<float,2>{0.795200586f, 0.985876381f},
-std::array<float,2>{0.960561752f, 0.107765876f},
-std::array<float,2>{0.463911027f, 0.871652484f},
-std::array<float,2>{0.124138683f, 0.327319801f},
-std::array<float,2>{0.701546311f, 0.534954607f},
-std::array<float,2>{0.664321184f, 0.162668958f},
-std::array<float,2>{0.0589223318f, 0.926362097f},
-std::array<float,2>{0.413222939f, 0.457758516f},
-std::array<float,2>{0.900735021f, 0.706098795f},
-std::array<float,2>{0.873356462f, 0.307045221f},
-std::array<float,2>{0.327240944f, 0.61778605f},
-std::array<float,2>{0.166039556f, 0.0269981846f},
-std::array<float,2>{0.591052294f, 0.776979446f},
-std::array<float,2>{0.672420025f, 0.406327099f},
-std::array<float,2>{0.032854937f, 0.681667507f},
-std::array<float,2>{0.436893135f, 0.230702743f},
-std::array<float,2>{0.88992852f, 0.946765542f},
-std::array<float,2>{0.846680641f, 0.0753985271f},
-std::array<float,2>{0.328223407f, 0.819099069f},
-std::array<float,2>{0.181092978f, 0.367309481f},
-std::array<float,2>{0.566195905f, 0.502218664f},
-std::array<float,2>{0.540382743f, 0.147931337f},
-std::array<float,2>{0.212462947f, 0.881251633f},
-std::array<float,2>{0.293280542f, 0.493016779f},
-std::array<float,2>{0.810974836f, 0.725117028f},
-std::array<float,2>{0.938927114f, 0.266614467f},
-std::array<float,2>{0.439993888f, 0.563268363f},
-std::array<float,2>{0.0962344259f, 0.0320533626f},
-std::array<float,2>{0.710908055f, 0.789771795f},
-std::array<float,2>{0.602463663f, 0.321972698f},
-std::array<float,2>{0.148779854f, 0.537712693f},
-std::array<float,2>{0.369954973f, 0.102686174f},
-std::array<float,2>{0.815922976f, 0.867698431f},
-std::array<float,2>{0.915489137f, 0.204717755f},
-std::array<float,2>{0.403571397f, 0.98920393f},
-std::array<float,2>{0.0172017831f, 0.392806083f},
-std::array<float,2>{0.636250913f, 0.650658309f},
-std::array<float,2>{0.742807448f, 0.0302471612f},
-std::array<float,2>{0.0899739712f, 0.778437555f},
-std::array<float,2>{0.479888886f, 0.31063804f},
-std::array<float,2>{0.97327137f, 0.622699022f},
-std::array<float,2>{0.753502965f, 0.45666495f},
-std::array<float,2>{0.253281891f, 0.708121955f},
-std::array<float,2>{0.244584307f, 0.156655475f},
-std::array<float,2>{0.523606181f, 0.924042702f},
-std::array<float,2>{0.693940341f, 0.285058528f},
-std::array<float,2>{0.113765381f, 0.608505487f},
-std::array<float,2>{0.459880382f, 0.0088900784f},
-std::array<float,2>{0.965365529f, 0.754924655f},
-std::array<float,2>{0.785165668f, 0.185790285f},
-std::array<float,2>{0.311331362f, 0.921149909f},
-std::array<float,2>{0.199415341f, 0.451488674f},
-std::array<float,2>{0.548229456f, 0.695464313f},
-std::array<float,2>{0.580890238f, 0.122819044f},
-std::array<float,2>{0.159769282f, 0.851683021f},
-std::array<float,2>{0.316579163f, 0.32944271f},
-std::array<float,2>{0.862781346f, 0.554875553f},
-std::array<float,2>{0.892439544f, 0.389187604f},
-std::array<float,2>{0.419135004f, 0.634287417f},
-std::array<float,2>{0.0528706387f, 0.203090459f},
-std::array<float,2>{0.65853411f, 0.973740458f},
-std::array<float,2>{0.511655092f, 0.473475814f},
-std::array<float,2>{0.226149902f, 0.7464661f},
-std::array<float,2>{0.275569111f, 0.126459688f},
-std::array<float,2>{0.774663091f, 0.901734114f},
-std::array<float,2>{0.986110628f, 0.0557639822f},
-std::array<float,2>{0.487257183f, 0.806334019f},
-std::array<float,2>{0.0719979629f, 0.252313972f},
-std::array<float,2>{0.723198891f, 0.589760303f},
-std::array<float,2>{0.643849909f, 0.246917948f},
-std::array<float,2>{0.00348640583f, 0.959357381f},
-std::array<float,2>{0.387998939f, 0.424773514f},
-std::array<float,2>{0.937201202f, 0.669942439f},
-std::array<float,2>{0.833086729f, 0.346886575f},
-std::array<float,2>{0.345698178f, 0.527641535f},
-std::array<float,2>{0.139599189f, 0.0826111063f},
-std::array<float,2>{0.614075363f, 0.832193851f},
-std::array<float,2>{0.734164298f, 0.444861025f},
-std::array<float,2>{0.0678885207f, 0.6903283f},
-std::array<float,2>{0.493912876f, 0.173461989f},
-std::array<float,2>{0.999877453f, 0.907199204f},
-std::array<float,2>{0.770556152f, 0.00334339868f},
-std::array<float,2>{0.267392129f, 0.761900246f},
-std::array<float,2>{0.228916734f, 0.293226331f},
-std::array<float,2>{0.501495183f, 0.597563624f},
-std::array<float,2>{0.623058558f, 0.188647151f},
-std::array<float,2>{0.132301986f, 0.976629555f},
-std::array<float,2>{0.355074972f, 0.378156155f},
-std::array<float,2>{0.83719933f, 0.625533104f},
-std::array<float,2>{0.928090096f, 0.338962853f},
-std::array<float,2>{0.377735853f, 0.552537024f},
-std::array<float,2>{0.0108750118f, 0.116573155f},
-std::array<float,2>{0.65587163f, 0.844305575f},
-std::array<float,2>{0.555248916f, 0.263835847f},
-std::array<float,2>{0.19020538f, 0.579741716f},
-std::array<float,2>{0.299070954f, 0.0494988225f},
-std::array<float,2>{0.789128482f, 0.801185489f},
-std::array<float,2>{0.953667045f, 0.138428256f},
-std::array<float,2>{0.467090398f, 0.89510715f},
-std::array<float,2>{0.117964052f, 0.477090389f},
-std::array<float,2>{0.696701944f, 0.734585106f},
-std::array<float,2>{0.66947484f, 0.0926670656f},
-std::array<float,2>{0.0562726408f, 0.836967826f},
-std::array<float,2>{0.40843749f, 0.354250968f},
-std::array<float,2>{0.903993845f, 0.522386551f},
-std::array<float,2>{0.867647529f, 0.434823513f},
-std::array<float,2>{0.323425293f, 0.662004769f},
-std::array<float,2>{0.168941617f, 0.235770926f},
-std::array<float,2>{0.586461484f, 0.967696011f},
-std::array<float,2>{0.627823353f, 0.361182064f},
-std::array<float,2>{0.0295859277f, 0.510991037f},
-std::array<float,2>{0.395386368f, 0.0666779429f},
-std::array<float,2>{0.908832848f, 0.822597086f},
-std::array<float,2>{0.825961709f, 0.221011877f},
-std::array<float,2>{0.360925019f, 0.942103744f},
-std::array<float,2>{0.143583551f, 0.414072692f},
-std::array<float,2>{0.595246136f, 0.673972666f},
-std::array<float,2>{0.516349077f, 0.0390663072f},
-std::array<float,2>{0.235146195f, 0.786856771f},
-std::array<float,2>{0.261043876f, 0.276854277f},
-std::array<float,2>{0.760600388f, 0.573060274f},
-std::array<float,2>{0.980965316f, 0.49111858f},
-std::array<float,2>{0.469591111f, 0.73298806f},
-std::array<float,2>{0.0812885016f, 0.152667299f},
-std::array<float,2>{0.741781712f, 0.882978976f},
-std::array<float,2>{0.573476672f, 0.400163502f},
-std::array<float,2>{0.172959104f, 0.640962839f},
-std::array<float,2>{0.342992306f, 0.212447956f},
-std::array<float,2>{0.854483187f, 0.996025443f},
-std::array<float,2>{0.87718308f, 0.100733705f},
-std::array<float,2>{0.423694074f, 0.863450825f},
-std::array<float,2>{0.0426336825f, 0.315813512f},
-std::array<float,2>{0.681793511f, 0.544549286f},
-std::array<float,2>{0.716061473f, 0.16547142f},
-std::array<float,2>{0.107336521f, 0.930197358f},
-std::array<float,2>{0.448021442f, 0.461744487f},
-std::array<float,2>{0.947246671f, 0.715120852f},
-std::array<float,2>{0.801810682f, 0.301341504f},
-std::array<float,2>{0.281542808f, 0.611925066f},
-std::array<float,2>{0.207675099f, 0.0231610741f},
-std::array<float,2>{0.53312695f, 0.768934369f},
-std::array<float,2>{0.704139471f, 0.379161507f},
-std::array<float,2>{0.100931019f, 0.630506337f},
-std::array<float,2>{0.444698304f, 0.192492738f},
-std::array<float,2>{0.944860995f, 0.981444776f},
-std::array<float,2>{0.80590874f, 0.112000987f},
-std::array<float,2>{0.291354328f, 0.850434601f},
-std::array<float,2>{0.21539335f, 0.339891791f},
-std::array<float,2>{0.545165837f, 0.549921691f},
-std::array<float,2>{0.56703186f, 0.176965699f},
-std::array<float,2>{0.186725557f, 0.91115272f},
-std::array<float,2>{0.335704118f, 0.437711686f},
-std::array<float,2>{0.850732207f, 0.693922758f},
-std::array<float,2>{0.883391201f, 0.291247934f},
-std::array<float,2>{0.431184679f, 0.601451457f},
-std::array<float,2>{0.0376502462f, 0.00687752245f},
-std::array<float,2>{0.679497182f, 0.75843817f},
-std::array<float,2>{0.527446568f, 0.358338892f},
-std::array<float,2>{0.248838946f, 0.519046962f},
-std::array<float,2>{0.253908813f, 0.0881376937f},
-std::array<float,2>{0.755657852f, 0.842008054f},
-std::array<float,2>{0.970335901f, 0.242112249f},
-std::array<float,2>{0.480598211f, 0.962525547f},
-std::array<float,2>{0.0888211727f, 0.433124423f},
-std::array<float,2>{0.749299288f, 0.657705605f},
-std::array<float,2>{0.638806581f, 0.0537916087f},
-std::array<float,2>{0.0228590555f, 0.800164521f},
-std::array<float,2>{0.398808211f, 0.258244306f},
-std::array<float,2>{0.919306993f, 0.585014284f},
-std::array<float,2>{0.819629014f, 0.483027756f},
-std::array<float,2>{0.374962717f, 0.740400016f},
-std::array<float,2>{0.155093834f, 0.134181857f},
-std::array<float,2>{0.608546853f, 0.891909659f},
-std::array<float,2>{0.662869036f, 0.28101182f},
-std::array<float,2>{0.0504506715f, 0.576880217f},
-std::array<float,2>{0.417374492f, 0.0452614762f},
-std::array<float,2>{0.894681633f, 0.784718931f},
-std::array<float,2>{0.866097867f, 0.148835003f},
-std::array<float,2>{0.31337887f, 0.889558375f},
-std::array<float,2>{0.161285356f, 0.487785667f},
-std::array<float,2>{0.583309352f, 0.728721917f},
-std::array<float,2>{0.554014266f, 0.0630010292f},
-std::array<float,2>{0.196337774f, 0.827414691f},
-std::array<float,2>{0.307802469f, 0.364747971f},
-std::array<float,2>{0.781408489f, 0.513851047f},
-std::array<float,2>{0.961072624f, 0.420449406f},
-std::array<float,2>{0.454562962f, 0.679206669f},
-std::array<float,2>{0.111006849f, 0.224162087f},
-std::array<float,2>{0.6888327f, 0.939028561f},
-std::array<float,2>{0.612379074f, 0.467813969f},
-std::array<float,2>{0.133833006f, 0.713020682f},
-std::array<float,2>{0.351267427f, 0.169552416f},
-std::array<float,2>{0.829508185f, 0.936843932f},
-std::array<float,2>{0.931426525f, 0.0170626156f},
-std::array<float,2>{0.384132534f, 0.770259798f},
-std::array<float,2>{0.00695674028f, 0.300070345f},
-std::array<float,2>{0.645843625f, 0.616440296f},
-std::array<float,2>{0.722503364f, 0.21662055f},
-std::array<float,2>{0.0756952539f, 0.998239875f},
-std::array<float,2>{0.489398032f, 0.404292583f},
-std::array<float,2>{0.99200356f, 0.645775974f},
-std::array<float,2>{0.780493021f, 0.317761242f},
-std::array<float,2>{0.280226231f, 0.540998757f},
-std::array<float,2>{0.219003379f, 0.0958831459f},
-std::array<float,2>{0.514568031f, 0.862010241f},
-std::array<float,2>{0.64933461f, 0.499161243f},
-std::array<float,2>{0.0141455084f, 0.719878197f},
-std::array<float,2>{0.380889386f, 0.14252241f},
-std::array<float,2>{0.924263835f, 0.878667593f},
-std::array<float,2>{0.8412503f, 0.0359710269f},
-std::array<float,2>{0.356698036f, 0.79458952f},
-std::array<float,2>{0.12658903f, 0.270823598f},
-std::array<float,2>{0.619643569f, 0.567930937f},
-std::array<float,2>{0.505671203f, 0.229418889f},
-std::array<float,2>{0.231785059f, 0.950406611f},
-std::array<float,2>{0.272119403f, 0.41184485f},
-std::array<float,2>{0.768728495f, 0.685609758f},
-std::array<float,2>{0.994834423f, 0.371218562f},
-std::array<float,2>{0.497035354f, 0.505600631f},
-std::array<float,2>{0.0646331534f, 0.0735243782f},
-std::array<float,2>{0.72892338f, 0.813521147f},
-std::array<float,2>{0.590520263f, 0.306095064f},
-std::array<float,2>{0.167155623f, 0.620791137f},
-std::array<float,2>{0.326329947f, 0.0241021439f},
-std::array<float,2>{0.874777138f, 0.775275886f},
-std::array<float,2>{0.902041316f, 0.161307469f},
-std::array<float,2>{0.412463605f, 0.929406285f},
-std::array<float,2>{0.0597830676f, 0.460108519f},
-std::array<float,2>{0.665702581f, 0.703346491f},
-std::array<float,2>{0.703044832f, 0.106770091f},
-std::array<float,2>{0.123745129f, 0.8731668f},
-std::array<float,2>{0.463619858f, 0.325236917f},
-std::array<float,2>{0.959390998f, 0.531875134f},
-std::array<float,2>{0.795922995f, 0.398019224f},
-std::array<float,2>{0.304424971f, 0.654436469f},
-std::array<float,2>{0.193086669f, 0.210916579f},
-std::array<float,2>{0.56033963f, 0.986760497f},
-std::array<float,2>{0.735355139f, 0.333905011f},
-std::array<float,2>{0.0855742693f, 0.559318364f},
-std::array<float,2>{0.47387144f, 0.118294112f},
-std::array<float,2>{0.978002191f, 0.85750252f},
-std::array<float,2>{0.762239873f, 0.196576506f},
-std::array<float,2>{0.262223452f, 0.971754313f},
-std::array<float,2>{0.239895523f, 0.383902639f},
-std::array<float,2>{0.521560848f, 0.639223218f},
-std::array<float,2>{0.601049125f, 0.0124525456f},
-std::array<float,2>{0.148198903f, 0.752222419f},
-std::array<float,2>{0.36611554f, 0.287706733f},
-std::array<float,2>{0.820410967f, 0.60415107f},
-std::array<float,2>{0.912054002f, 0.445458829f},
-std::array<float,2>{0.393244684f, 0.702780664f},
-std::array<float,2>{0.0254656635f, 0.182418093f},
-std::array<float,2>{0.63117379f, 0.915712714f},
-std::array<float,2>{0.537555277f, 0.428667456f},
-std::array<float,2>{0.203506112f, 0.664073229f},
-std::array<float,2>{0.285671294f, 0.243130028f},
-std::array<float,2>{0.799738586f, 0.954382718f},
-std::array<float,2>{0.950099528f, 0.0815604255f},
-std::array<float,2>{0.449262619f, 0.829214931f},
-std::array<float,2>{0.101792842f, 0.347967327f},
-std::array<float,2>{0.713684916f, 0.52535224f},
-std::array<float,2>{0.686528504f, 0.130823776f},
-std::array<float,2>{0.0439401604f, 0.905596554f},
-std::array<float,2>{0.42593497f, 0.469616741f},
-std::array<float,2>{0.88051486f, 0.744190097f},
-std::array<float,2>{0.859206319f, 0.256358773f},
-std::array<float,2>{0.336215287f, 0.593633175f},
-std::array<float,2>{0.178223595f, 0.0594140626f},
-std::array<float,2>{0.57791692f, 0.812089264f},
-std::array<float,2>{0.633100271f, 0.391336828f},
-std::array<float,2>{0.0181170087f, 0.649689078f},
-std::array<float,2>{0.405863255f, 0.206053957f},
-std::array<float,2>{0.916694641f, 0.991714716f},
-std::array<float,2>{0.812786877f, 0.104776807f},
-std::array<float,2>{0.36747396f, 0.870485842f},
-std::array<float,2>{0.151743889f, 0.323441446f},
-std::array<float,2>{0.604324937f, 0.535442054f},
-std::array<float,2>{0.526678264f, 0.159673214f},
-std::array<float,2>{0.243397832f, 0.923822284f},
-std::array<float,2>{0.250692636f, 0.454911739f},
-std::array<float,2>{0.751002431f, 0.710202992f},
-std::array<float,2>{0.975135446f, 0.309689999f},
-std::array<float,2>{0.478191763f, 0.624561429f},
-std::array<float,2>{0.0924586281f, 0.0278387908f},
-std::array<float,2>{0.74473685f, 0.7793594f},
-std::array<float,2>{0.563158631f, 0.370141178f},
-std::array<float,2>{0.182648465f, 0.501028001f},
-std::array<float,2>{0.331936955f, 0.0767380446f},
-std::array<float,2>{0.84468025f, 0.816905022f},
-std::array<float,2>{0.888274014f, 0.233466119f},
-std::array<float,2>{0.435341328f, 0.948312223f},
-std::array<float,2>{0.0338249579f, 0.408307105f},
-std::array<float,2>{0.675537467f, 0.681094766f},
-std::array<float,2>{0.70778501f, 0.0343166329f},
-std::array<float,2>{0.0943576768f, 0.792827547f},
-std::array<float,2>{0.437659293f, 0.269394368f},
-std::array<float,2>{0.939532518f, 0.564919531f},
-std::array<float,2>{0.80941087f, 0.495388895f},
-std::array<float,2>{0.295262754f, 0.723721743f},
-std::array<float,2>{0.213392109f, 0.144668341f},
-std::array<float,2>{0.542960167f, 0.88025099f},
-std::array<float,2>{0.724903762f, 0.250839412f},
-std::array<float,2>{0.0732014105f, 0.587511778f},
-std::array<float,2>{0.48569712f, 0.0574615039f},
-std::array<float,2>{0.987544894f, 0.806995332f},
-std::array<float,2>{0.775706768f, 0.127823517f},
-std::array<float,2>{0.274589747f, 0.898815691f},
-std::array<float,2>{0.223510563f, 0.475862861f},
-std::array<float,2>{0.507988036f, 0.748980165f},
-std::array<float,2>{0.617145777f, 0.0842320323f},
-std::array<float,2>{0.137396976f, 0.834303617f},
-std::array<float,2>{0.346202374f, 0.344942451f},
-std::array<float,2>{0.835395753f, 0.529654503f},
-std::array<float,2>{0.934777737f, 0.423122048f},
-std::array<float,2>{0.389730275f, 0.668334723f},
-std::array<float,2>{0.00111567089f, 0.249710441f},
-std::array<float,2>{0.641818464f, 0.957344413f},
-std::array<float,2>{0.549187481f, 0.449678749f},
-std::array<float,2>{0.202968091f, 0.698237479f},
-std::array<float,2>{0.31043914f, 0.183978811f},
-std::array<float,2>{0.78734231f, 0.9185583f},
-std::array<float,2>{0.967197597f, 0.0101280324f},
-std::array<float,2>{0.457698226f, 0.757261097f},
-std::array<float,2>{0.117143124f, 0.282411814f},
-std::array<float,2>{0.692234933f, 0.606294394f},
-std::array<float,2>{0.657688081f, 0.200830773f},
-std::array<float,2>{0.0515211299f, 0.97485584f},
-std::array<float,2>{0.420786768f, 0.386734366f},
-std::array<float,2>{0.893694699f, 0.635372639f},
-std::array<float,2>{0.860181212f, 0.331530124f},
-std::array<float,2>{0.319200814f, 0.558508813f},
-std::array<float,2>{0.157757968f, 0.124908194f},
-std::array<float,2>{0.579931676f, 0.854121923f},
-std::array<float,2>{0.698483229f, 0.478840739f},
-std::array<float,2>{0.120185785f, 0.736510158f},
-std::array<float,2>{0.465561777f, 0.140573397f},
-std::array<float,2>{0.956087053f, 0.898029387f},
-std::array<float,2>{0.791471839f, 0.0487166308f},
-std::array<float,2>{0.298814476f, 0.803170145f},
-std::array<float,2>{0.188278854f, 0.263210475f},
-std::array<float,2>{0.558387697f, 0.58013767f},
-std::array<float,2>{0.589032829f, 0.237113252f},
-std::array<float,2>{0.170170337f, 0.966125906f},
-std::array<float,2>{0.32050088f, 0.437183917f},
-std::array<float,2>{0.869847596f, 0.663297296f},
-std::array<float,2>{0.905436099f, 0.35317567f},
-std::array<float,2>{0.408074111f, 0.519595444f},
-std::array<float,2>{0.0578198694f, 0.0914034322f},
-std::array<float,2>{0.671733975f, 0.838649273f},
-std::array<float,2>{0.503216982f, 0.295542955f},
-std::array<float,2>{0.226642817f, 0.595592976f},
-std::array<float,2>{0.267986983f, 0.00129941152f},
-std::array<float,2>{0.772882044f, 0.764491975f},
-std::array<float,2>{0.996776581f, 0.175517872f},
-std::array<float,2>{0.494197369f, 0.909255147f},
-std::array<float,2>{0.0688080415f, 0.442112654f},
-std::array<float,2>{0.731642485f, 0.689340413f},
-std::array<float,2>{0.653753042f, 0.114330821f},
-std::array<float,2>{0.00960615557f, 0.846552134f},
-std::array<float,2>{0.376298279f, 0.337641329f},
-std::array<float,2>{0.927595675f, 0.553231537f},
-std::array<float,2>{0.838591337f, 0.376886874f},
-std::array<float,2>{0.352708668f, 0.628446996f},
-std::array<float,2>{0.129305094f, 0.191258952f},
-std::array<float,2>{0.621665418f, 0.98037374f},
-std::array<float,2>{0.680146992f, 0.31418246f},
-std::array<float,2>{0.0408984758f, 0.545728028f},
-std::array<float,2>{0.425299704f, 0.0985613242f},
-std::array<float,2>{0.875465333f, 0.866060495f},
-std::array<float,2>{0.85306102f, 0.213707209f},
-std::array<float,2>{0.340700716f, 0.993358612f},
-std::array<float,2>{0.174337387f, 0.401988238f},
-std::array<float,2>{0.570897996f, 0.643048584f},
-std::array<float,2>{0.534889758f, 0.0207437016f},
-std::array<float,2>{0.21011439f, 0.766320169f},
-std::array<float,2>{0.283967942f, 0.302882344f},
-std::array<float,2>{0.804279983f, 0.609656394f},
-std::array<float,2>{0.948108554f, 0.464064091f},
-std::array<float,2>{0.446796536f, 0.717325866f},
-std::array<float,2>{0.108400822f, 0.167581111f},
-std::array<float,2>{0.717105925f, 0.933285892f},
-std::array<float,2>{0.596803606f, 0.41703406f},
-std::array<float,2>{0.142552257f, 0.672166646f},
-std::array<float,2>{0.362364471f, 0.220085248f},
-std::array<float,2>{0.826734781f, 0.944869399f},
-std::array<float,2>{0.907467961f, 0.0693977624f},
-std::array<float,2>{0.397278845f, 0.820572078f},
-std::array<float,2>{0.0287014693f, 0.36137566f},
-std::array<float,2>{0.625141799f, 0.508949041f},
-std::array<float,2>{0.738349617f, 0.154993221f},
-std::array<float,2>{0.0781751946f, 0.88583988f},
-std::array<float,2>{0.472279459f, 0.489348859f},
-std::array<float,2>{0.983385026f, 0.731623828f},
-std::array<float,2>{0.758280098f, 0.274674416f},
-std::array<float,2>{0.258087844f, 0.571063519f},
-std::array<float,2>{0.236771166f, 0.0429027118f},
-std::array<float,2>{0.518529654f, 0.787740171f},
-std::array<float,2>{0.747757196f, 0.429844081f},
-std::array<float,2>{0.0876600444f, 0.659461379f},
-std::array<float,2>{0.483417302f, 0.239321545f},
-std::array<float,2>{0.970927954f, 0.963770092f},
-std::array<float,2>{0.756670833f, 0.0872287527f},
-std::array<float,2>{0.25731498f, 0.840644538f},
-std::array<float,2>{0.247924969f, 0.356345206f},
-std::array<float,2>{0.531186759f, 0.516973436f},
-std::array<float,2>{0.606740773f, 0.136268973f},
-std::array<float,2>{0.153855026f, 0.89442265f},
-std::array<float,2>{0.371975511f, 0.480536669f},
-std::array<float,2>{0.816439688f, 0.738801837f},
-std::array<float,2>{0.920711517f, 0.260173917f},
-std::array<float,2>{0.402244985f, 0.583632231f},
-std::array<float,2>{0.0196413603f, 0.0519571938f},
-std::array<float,2>{0.637608886f, 0.796932161f},
-std::array<float,2>{0.543225169f, 0.343322039f},
-std::array<float,2>{0.21861355f, 0.548791349f},
-std::array<float,2>{0.289389104f, 0.109851405f},
-std::array<float,2>{0.808198392f, 0.848482013f},
-std::array<float,2>{0.941650093f, 0.194476157f},
-std::array<float,2>{0.441983879f, 0.982778609f},
-std::array<float,2>{0.0987164974f, 0.38221994f},
-std::array<float,2>{0.706800699f, 0.631470859f},
-std::array<float,2>{0.676599205f, 0.0049188314f},
-std::array<float,2>{0.0368292443f, 0.761045039f},
-std::array<float,2>{0.433255672f, 0.28942278f},
-std::array<float,2>{0.886550486f, 0.598005474f},
-std::array<float,2>{0.849546731f, 0.440789193f},
-std::array<float,2>{0.333691448f, 0.692850053f},
-std::array<float,2>{0.183912396f, 0.178642944f},
-std::array<float,2>{0.569769084f, 0.913583398f},
-std::array<float,2>{0.646918476f, 0.297535598f},
-std::array<float,2>{0.004345024f, 0.615000546f},
-std::array<float,2>{0.385894746f, 0.0193239544f},
-std::array<float,2>{0.93339932f, 0.773412228f},
-std::array<float,2>{0.830657184f, 0.171216935f},
-std::array<float,2>{0.348154366f, 0.934949577f},
-std::array<float,2>{0.134778768f, 0.466364831f},
-std::array<float,2>{0.609828055f, 0.71194303f},
-std::array<float,2>{0.513301075f, 0.0947165489f},
-std::array<float,2>{0.222618058f, 0.860023618f},
-std::array<float,2>{0.277766854f, 0.319291919f},
-std::array<float,2>{0.778022766f, 0.542131186f},
-std::array<float,2>{0.990217268f, 0.404553354f},
-std::array<float,2>{0.490504682f, 0.648020208f},
-std::array<float,2>{0.0770228282f, 0.217778087f},
-std::array<float,2>{0.720289886f, 0.996849954f},
-std::array<float,2>{0.584960938f, 0.485248178f},
-std::array<float,2>{0.162503123f, 0.726775229f},
-std::array<float,2>{0.3161304f, 0.151696146f},
-std::array<float,2>{0.863510132f, 0.887219131f},
-std::array<float,2>{0.897503138f, 0.0446293391f},
-std::array<float,2>{0.415594161f, 0.78243953f},
-std::array<float,2>{0.0472003706f, 0.277488261f},
-std::array<float,2>{0.661147177f, 0.574438334f},
-std::array<float,2>{0.69129473f, 0.225902811f},
-std::array<float,2>{0.112676919f, 0.940503836f},
-std::array<float,2>{0.457007617f, 0.418354303f},
-std::array<float,2>{0.963824153f, 0.677604675f},
-std::array<float,2>{0.784498751f, 0.366041183f},
-std::array<float,2>{0.306497425f, 0.513253689f},
-std::array<float,2>{0.197346196f, 0.065302968f},
-std::array<float,2>{0.55087328f, 0.824623048f},
-std::array<float,2>{0.66768682f, 0.458972722f},
-std::array<float,2>{0.0605781861f, 0.705999911f},
-std::array<float,2>{0.411275417f, 0.163914219f},
-std::array<float,2>{0.900146484f, 0.927214384f},
-std::array<float,2>{0.872342944f, 0.025905218f},
-std::array<float,2>{0.32520625f, 0.776249826f},
-std::array<float,2>{0.164433584f, 0.308389425f},
-std::array<float,2>{0.592828572f, 0.618248165f},
-std::array<float,2>{0.561763763f, 0.207932919f},
-std::array<float,2>{0.194890738f, 0.984773636f},
-std::array<float,2>{0.30261755f, 0.395463258f},
-std::array<float,2>{0.794339001f, 0.654220164f},
-std::array<float,2>{0.958928168f, 0.326561332f},
-std::array<float,2>{0.461137712f, 0.534115672f},
-std::array<float,2>{0.121431462f, 0.108601242f},
-std::array<float,2>{0.699464142f, 0.873004496f},
-std::array<float,2>{0.617937326f, 0.271609873f},
-std::array<float,2>{0.12812385f, 0.570053518f},
-std::array<float,2>{0.35757333f, 0.037185397f},
-std::array<float,2>{0.84319526f, 0.796855688f},
-std::array<float,2>{0.922052681f, 0.144485623f},
-std::array<float,2>{0.380197197f, 0.876606047f},
-std::array<float,2>{0.0125239259f, 0.497888297f},
-std::array<float,2>{0.651538908f, 0.721576691f},
-std::array<float,2>{0.727836192f, 0.0718892738f},
-std::array<float,2>{0.06306196f, 0.816278815f},
-std::array<float,2>{0.499543726f, 0.373357087f},
-std::array<float,2>{0.993980169f, 0.506941259f},
-std::array<float,2>{0.767369807f, 0.413226426f},
-std::array<float,2>{0.27116996f, 0.685301006f},
-std::array<float,2>{0.232484818f, 0.227934986f},
-std::array<float,2>{0.507575452f, 0.952629864f},
-std::array<float,2>{0.712350845f, 0.350525171f},
-std::array<float,2>{0.104266755f, 0.526512325f},
-std::array<float,2>{0.45281601f, 0.0789482892f},
-std::array<float,2>{0.952717543f, 0.831091166f},
-std::array<float,2>{0.79813385f, 0.244143918f},
-std::array<float,2>{0.287365377f, 0.955694556f},
-std::array<float,2>{0.206887141f, 0.426080346f},
-std::array<float,2>{0.536650836f, 0.667008221f},
-std::array<float,2>{0.575228572f, 0.0611253865f},
-std::array<float,2>{0.177133098f, 0.809345901f},
-std::array<float,2>{0.339287758f, 0.255178273f},
-std::array<float,2>{0.856298029f, 0.590754092f},
-std::array<float,2>{0.880893409f, 0.471546352f},
-std::array<float,2>{0.429504216f, 0.742758393f},
-std::array<float,2>{0.0468644202f, 0.132363886f},
-std::array<float,2>{0.684102774f, 0.903603554f},
-std::array<float,2>{0.520769715f, 0.385029018f},
-std::array<float,2>{0.240841553f, 0.638555646f},
-std::array<float,2>{0.265323758f, 0.198026821f},
-std::array<float,2>{0.764085352f, 0.970492899f},
-std::array<float,2>{0.979480863f, 0.119220637f},
-std::array<float,2>{0.475096494f, 0.856517673f},
-std::array<float,2>{0.0821434259f, 0.335275054f},
-std::array<float,2>{0.736364484f, 0.560629547f},
-std::array<float,2>{0.629070461f, 0.180928528f},
-std::array<float,2>{0.0240956396f, 0.917482853f},
-std::array<float,2>{0.391622454f, 0.447972476f},
-std::array<float,2>{0.914015353f, 0.699372232f},
-std::array<float,2>{0.822384834f, 0.286716074f},
-std::array<float,2>{0.364562601f, 0.602169871f},
-std::array<float,2>{0.14524579f, 0.0142455669f},
-std::array<float,2>{0.598728478f, 0.751390934f},
-std::array<float,2>{0.625761867f, 0.414683133f},
-std::array<float,2>{0.0288967732f, 0.674331665f},
-std::array<float,2>{0.396547228f, 0.221495435f},
-std::array<float,2>{0.90780437f, 0.941886604f},
-std::array<float,2>{0.826584637f, 0.0673301592f},
-std::array<float,2>{0.363010675f, 0.823019207f},
-std::array<float,2>{0.141766638f, 0.3608208f},
-std::array<float,2>{0.597602785f, 0.51147157f},
-std::array<float,2>{0.517737329f, 0.153280154f},
-std::array<float,2>{0.237118497f, 0.883440852f},
-std::array<float,2>{0.258434743f, 0.490466565f},
-std::array<float,2>{0.758331835f, 0.732719243f},
-std::array<float,2>{0.982587636f, 0.276965171f},
-std::array<float,2>{0.471850425f, 0.572432339f},
-std::array<float,2>{0.0788911954f, 0.0396337956f},
-std::array<float,2>{0.738911748f, 0.786334336f},
-std::array<float,2>{0.570538878f, 0.316302359f},
-std::array<float,2>{0.174098372f, 0.544316173f},
-std::array<float,2>{0.339892924f, 0.101370528f},
-std::array<float,2>{0.852605343f, 0.86392045f},
-std::array<float,2>{0.875552118f, 0.212057412f},
-std::array<float,2>{0.425102443f, 0.99542135f},
-std::array<float,2>{0.0404540226f, 0.399873555f},
-std::array<float,2>{0.680444062f, 0.641415298f},
-std::array<float,2>{0.717649579f, 0.0226135161f},
-std::array<float,2>{0.109357454f, 0.769207716f},
-std::array<float,2>{0.446674466f, 0.300945491f},
-std::array<float,2>{0.947648704f, 0.611454904f},
-std::array<float,2>{0.803742826f, 0.461134285f},
-std::array<float,2>{0.283321321f, 0.715567231f},
-std::array<float,2>{0.210569546f, 0.16559954f},
-std::array<float,2>{0.534616768f, 0.929940641f},
-std::array<float,2>{0.732158661f, 0.293670177f},
-std::array<float,2>{0.0690870434f, 0.596967995f},
-std::array<float,2>{0.495019615f, 0.00346542057f},
-std::array<float,2>{0.996462703f, 0.762265503f},
-std::array<float,2>{0.773299992f, 0.172959045f},
-std::array<float,2>{0.268458694f, 0.906420171f},
-std::array<float,2>{0.227469698f, 0.444755167f},
-std::array<float,2>{0.503847182f, 0.689680636f},
-std::array<float,2>{0.621100605f, 0.117141448f},
-std::array<float,2>{0.129779622f, 0.84381175f},
-std::array<float,2>{0.353468537f, 0.339623392f},
-std::array<float,2>{0.83794266f, 0.552005649f},
-std::array<float,2>{0.927103221f, 0.37856698f},
-std::array<float,2>{0.37660569f, 0.625233114f},
-std::array<float,2>{0.00921150204f, 0.189162284f},
-std::array<float,2>{0.653904319f, 0.977263212f},
-std::array<float,2>{0.557716608f, 0.476961195f},
-std::array<float,2>{0.187773854f, 0.735189676f},
-std::array<float,2>{0.298066318f, 0.137763813f},
-std::array<float,2>{0.791822195f, 0.894603014f},
-std::array<float,2>{0.956913352f, 0.0492625386f},
-std::array<float,2>{0.465062529f, 0.801425517f},
-std::array<float,2>{0.121003419f, 0.264554679f},
-std::array<float,2>{0.699162543f, 0.579450369f},
-std::array<float,2>{0.67096585f, 0.236044392f},
-std::array<float,2>{0.0582175292f, 0.966970146f},
-std::array<float,2>{0.407642066f, 0.43531388f},
-std::array<float,2>{0.906175435f, 0.661527753f},
-std::array<float,2>{0.869389117f, 0.353728443f},
-std::array<float,2>{0.32091102f, 0.5217219f},
-std::array<float,2>{0.170435712f, 0.0919221491f},
-std::array<float,2>{0.589458168f, 0.837772787f},
-std::array<float,2>{0.691523254f, 0.452133179f},
-std::array<float,2>{0.116516262f, 0.695838273f},
-std::array<float,2>{0.457343608f, 0.186112016f},
-std::array<float,2>{0.967582703f, 0.921871841f},
-std::array<float,2>{0.78807056f, 0.00970955845f},
-std::array<float,2>{0.309989631f, 0.755655527f},
-std::array<float,2>{0.202592507f, 0.284237981f},
-std::array<float,2>{0.549390733f, 0.609031498f},
-std::array<float,2>{0.579393148f, 0.202370882f},
-std::array<float,2>{0.15769209f, 0.974183321f},
-std::array<float,2>{0.318793267f, 0.389025927f},
-std::array<float,2>{0.859859347f, 0.633874238f},
-std::array<float,2>{0.894411683f, 0.330046803f},
-std::array<float,2>{0.420103461f, 0.555448532f},
-std::array<float,2>{0.0510955118f, 0.122287311f},
-std::array<float,2>{0.658108056f, 0.852387428f},
-std::array<float,2>{0.50867945f, 0.252906024f},
-std::array<float,2>{0.222826421f, 0.589114547f},
-std::array<float,2>{0.275033206f, 0.0561748259f},
-std::array<float,2>{0.77601254f, 0.805780232f},
-std::array<float,2>{0.987870038f, 0.126471981f},
-std::array<float,2>{0.486035824f, 0.901974082f},
-std::array<float,2>{0.0727324709f, 0.472660691f},
-std::array<float,2>{0.725466907f, 0.746754229f},
-std::array<float,2>{0.642536819f, 0.0824798271f},
-std::array<float,2>{0.00194593717f, 0.832566142f},
-std::array<float,2>{0.390514761f, 0.347263068f},
-std::array<float,2>{0.935530841f, 0.528040707f},
-std::array<float,2>{0.83579272f, 0.424035311f},
-std::array<float,2>{0.346088171f, 0.670738339f},
-std::array<float,2>{0.136852339f, 0.246269792f},
-std::array<float,2>{0.616266966f, 0.959810734f},
-std::array<float,2>{0.675268352f, 0.368163466f},
-std::array<float,2>{0.0335266367f, 0.502743304f},
-std::array<float,2>{0.434944123f, 0.0760749504f},
-std::array<float,2>{0.887776971f, 0.818732321f},
-std::array<float,2>{0.843919516f, 0.231359348f},
-std::array<float,2>{0.331122339f, 0.946984589f},
-std::array<float,2>{0.183379233f, 0.406863034f},
-std::array<float,2>{0.562679827f, 0.682238638f},
-std::array<float,2>{0.542220354f, 0.0316398218f},
-std::array<float,2>{0.213199183f, 0.789470136f},
-std::array<float,2>{0.29579708f, 0.267355025f},
-std::array<float,2>{0.808855951f, 0.562652707f},
-std::array<float,2>{0.940348387f, 0.492503613f},
-std::array<float,2>{0.438311815f, 0.72482866f},
-std::array<float,2>{0.0940573961f, 0.148285359f},
-std::array<float,2>{0.707122505f, 0.881713927f},
-std::array<float,2>{0.603787243f, 0.393157423f},
-std::array<float,2>{0.152018487f, 0.651103258f},
-std::array<float,2>{0.367863119f, 0.204496026f},
-std::array<float,2>{0.813148856f, 0.988541484f},
-std::array<float,2>{0.916408181f, 0.103335939f},
-std::array<float,2>{0.405283779f, 0.867503881f},
-std::array<float,2>{0.0176585857f, 0.321623296f},
-std::array<float,2>{0.633650124f, 0.537248313f},
-std::array<float,2>{0.744479358f, 0.156960964f},
-std::array<float,2>{0.0920892805f, 0.92467916f},
-std::array<float,2>{0.477641791f, 0.456358939f},
-std::array<float,2>{0.974691272f, 0.708526969f},
-std::array<float,2>{0.751891792f, 0.311221153f},
-std::array<float,2>{0.250444472f, 0.622555256f},
-std::array<float,2>{0.243846238f, 0.0295079742f},
-std::array<float,2>{0.526904821f, 0.778879344f},
-std::array<float,2>{0.736882687f, 0.384526849f},
-std::array<float,2>{0.0825992227f, 0.638996005f},
-std::array<float,2>{0.475285113f, 0.197123587f},
-std::array<float,2>{0.978794158f, 0.972295225f},
-std::array<float,2>{0.764286518f, 0.119007468f},
-std::array<float,2>{0.265004426f, 0.858323872f},
-std::array<float,2>{0.240698338f, 0.333182007f},
-std::array<float,2>{0.521090329f, 0.558637738f},
-std::array<float,2>{0.599225819f, 0.181728065f},
-std::array<float,2>{0.144858196f, 0.915285289f},
-std::array<float,2>{0.364749938f, 0.445951521f},
-std::array<float,2>{0.823025465f, 0.702416122f},
-std::array<float,2>{0.913413823f, 0.28726548f},
-std::array<float,2>{0.39238742f, 0.603553593f},
-std::array<float,2>{0.0235423967f, 0.0118100606f},
-std::array<float,2>{0.629503191f, 0.752662659f},
-std::array<float,2>{0.536439478f, 0.348312765f},
-std::array<float,2>{0.206155568f, 0.524616361f},
-std::array<float,2>{0.287848353f, 0.0813836828f},
-std::array<float,2>{0.798513949f, 0.829924285f},
-std::array<float,2>{0.952431619f, 0.24250637f},
-std::array<float,2>{0.452158451f, 0.95478344f},
-std::array<float,2>{0.103559844f, 0.427982301f},
-std::array<float,2>{0.712808788f, 0.665001929f},
-std::array<float,2>{0.683682919f, 0.0586423688f},
-std::array<float,2>{0.0460136458f, 0.811832488f},
-std::array<float,2>{0.428793848f, 0.255921692f},
-std::array<float,2>{0.881806433f, 0.593161821f},
-std::array<float,2>{0.855753541f, 0.469181806f},
-std::array<float,2>{0.339569747f, 0.745081425f},
-std::array<float,2>{0.177399248f, 0.130110279f},
-std::array<float,2>{0.576023877f, 0.905823827f},
-std::array<float,2>{0.651920795f, 0.271403134f},
-std::array<float,2>{0.0117987925f, 0.567466617f},
-std::array<float,2>{0.380578309f, 0.0351831652f},
-std::array<float,2>{0.922826946f, 0.794292152f},
-std::array<float,2>{0.843407571f, 0.141852111f},
-std::array<float,2>{0.357920587f, 0.878368974f},
-std::array<float,2>{0.128553614f, 0.499887586f},
-std::array<float,2>{0.617552876f, 0.720276296f},
-std::array<float,2>{0.507305026f, 0.074130483f},
-std::array<float,2>{0.233077541f, 0.814202905f},
-std::array<float,2>{0.270694077f, 0.372047693f},
-std::array<float,2>{0.767011285f, 0.505095541f},
-std::array<float,2>{0.993578196f, 0.41158253f},
-std::array<float,2>{0.499426782f, 0.686259389f},
-std::array<float,2>{0.0625114366f, 0.228619248f},
-std::array<float,2>{0.728500009f, 0.951084673f},
-std::array<float,2>{0.593576074f, 0.460801363f},
-std::array<float,2>{0.164784387f, 0.704087973f},
-std::array<float,2>{0.326028168f, 0.162096784f},
-std::array<float,2>{0.872573495f, 0.92873162f},
-std::array<float,2>{0.899658382f, 0.0235728305f},
-std::array<float,2>{0.412002772f, 0.774462402f},
-std::array<float,2>{0.0611594692f, 0.306357384f},
-std::array<float,2>{0.667066455f, 0.620127976f},
-std::array<float,2>{0.6998474f, 0.210125417f},
-std::array<float,2>{0.121807158f, 0.987206221f},
-std::array<float,2>{0.461464643f, 0.397672415f},
-std::array<float,2>{0.958301842f, 0.655121684f},
-std::array<float,2>{0.794817984f, 0.326083064f},
-std::array<float,2>{0.302208334f, 0.531399906f},
-std::array<float,2>{0.194395468f, 0.107269362f},
-std::array<float,2>{0.562331498f, 0.873766899f},
-std::array<float,2>{0.661771476f, 0.487981349f},
-std::array<float,2>{0.0475135893f, 0.729058743f},
-std::array<float,2>{0.415270686f, 0.149056315f},
-std::array<float,2>{0.898077607f, 0.888739407f},
-std::array<float,2>{0.864138663f, 0.0454979837f},
-std::array<float,2>{0.31551823f, 0.784419417f},
-std::array<float,2>{0.163063288f, 0.280753016f},
-std::array<float,2>{0.584418595f, 0.576257586f},
-std::array<float,2>{0.551712334f, 0.223832145f},
-std::array<float,2>{0.197798654f, 0.938803196f},
-std::array<float,2>{0.306045115f, 0.419988871f},
-std::array<float,2>{0.784772038f, 0.679104745f},
-std::array<float,2>{0.963219345f, 0.364579052f},
-std::array<float,2>{0.456076443f, 0.514618278f},
-std::array<float,2>{0.112879038f, 0.0626143292f},
-std::array<float,2>{0.690443337f, 0.828010857f},
-std::array<float,2>{0.610139966f, 0.300542504f},
-std::array<float,2>{0.135613084f, 0.61705792f},
-std::array<float,2>{0.347687721f, 0.0172823295f},
-std::array<float,2>{0.830562234f, 0.769955575f},
-std::array<float,2>{0.932999492f, 0.169334188f},
-std::array<float,2>{0.386496305f, 0.937022626f},
-std::array<float,2>{0.00446188403f, 0.468399465f},
-std::array<float,2>{0.647102714f, 0.71378392f},
-std::array<float,2>{0.719966352f, 0.0964305103f},
-std::array<float,2>{0.0765686557f, 0.861371756f},
-std::array<float,2>{0.491010875f, 0.318027556f},
-std::array<float,2>{0.989480197f, 0.540306509f},
-std::array<float,2>{0.777379632f, 0.403593183f},
-std::array<float,2>{0.277980715f, 0.646198928f},
-std::array<float,2>{0.221804202f, 0.216090038f},
-std::array<float,2>{0.512827873f, 0.998804271f},
-std::array<float,2>{0.70639956f, 0.340587556f},
-std::array<float,2>{0.0994972289f, 0.550295651f},
-std::array<float,2>{0.441716403f, 0.111536145f},
-std::array<float,2>{0.942269206f, 0.849711239f},
-std::array<float,2>{0.807656109f, 0.193185151f},
-std::array<float,2>{0.289700091f, 0.980617821f},
-std::array<float,2>{0.2181959f, 0.379449725f},
-std::array<float,2>{0.543623626f, 0.630264223f},
-std::array<float,2>{0.570222497f, 0.00764021929f},
-std::array<float,2>{0.184186757f, 0.758099854f},
-std::array<float,2>{0.333024085f, 0.291564703f},
-std::array<float,2>{0.848922431f, 0.600907624f},
-std::array<float,2>{0.886010587f, 0.43808195f},
-std::array<float,2>{0.432709992f, 0.693807662f},
-std::array<float,2>{0.0365128592f, 0.177261114f},
-std::array<float,2>{0.675864518f, 0.911656439f},
-std::array<float,2>{0.530700505f, 0.433006048f},
-std::array<float,2>{0.247245222f, 0.65771693f},
-std::array<float,2>{0.257470936f, 0.241531163f},
-std::array<float,2>{0.755911827f, 0.9623999f},
-std::array<float,2>{0.971364558f, 0.0885556117f},
-std::array<float,2>{0.484334707f, 0.842733979f},
-std::array<float,2>{0.0870040506f, 0.357698232f},
-std::array<float,2>{0.747340202f, 0.518575191f},
-std::array<float,2>{0.636720955f, 0.134653032f},
-std::array<float,2>{0.0200569779f, 0.892453313f},
-std::array<float,2>{0.401378959f, 0.482672602f},
-std::array<float,2>{0.920302212f, 0.740867496f},
-std::array<float,2>{0.816937327f, 0.258644849f},
-std::array<float,2>{0.371267647f, 0.585518658f},
-std::array<float,2>{0.153621122f, 0.054499466f},
-std::array<float,2>{0.607221782f, 0.800660372f},
-std::array<float,2>{0.682366908f, 0.401382297f},
-std::array<float,2>{0.0422283895f, 0.643349767f},
-std::array<float,2>{0.423011631f, 0.213251412f},
-std::array<float,2>{0.877806962f, 0.994021595f},
-std::array<float,2>{0.853991628f, 0.0979580507f},
-std::array<float,2>{0.343412966f, 0.865554094f},
-std::array<float,2>{0.173635051f, 0.313914865f},
-std::array<float,2>{0.574101329f, 0.545175314f},
-std::array<float,2>{0.532611668f, 0.167014137f},
-std::array<float,2>{0.207508162f, 0.933092356f},
-std::array<float,2>{0.282095164f, 0.464551717f},
-std::array<float,2>{0.802304626f, 0.717137933f},
-std::array<float,2>{0.946571589f, 0.303699195f},
-std::array<float,2>{0.447349936f, 0.610348523f},
-std::array<float,2>{0.106778145f, 0.0213271156f},
-std::array<float,2>{0.716725886f, 0.766084969f},
-std::array<float,2>{0.595190048f, 0.361866474f},
-std::array<float,2>{0.144080281f, 0.509404719f},
-std::array<float,2>{0.360397875f, 0.0701227337f},
-std::array<float,2>{0.825516641f, 0.820987046f},
-std::array<float,2>{0.908674836f, 0.220606908f},
-std::array<float,2>{0.394785196f, 0.944575667f},
-std::array<float,2>{0.030171074f, 0.41787222f},
-std::array<float,2>{0.627373755f, 0.672846138f},
-std::array<float,2>{0.741692603f, 0.0420852974f},
-std::array<float,2>{0.0816270187f, 0.787438571f},
-std::array<float,2>{0.468826801f, 0.27537787f},
-std::array<float,2>{0.980544269f, 0.570421517f},
-std::array<float,2>{0.760057747f, 0.490105987f},
-std::array<float,2>{0.261610031f, 0.732087314f},
-std::array<float,2>{0.234527841f, 0.154339135f},
-std::array<float,2>{0.515829861f, 0.886232674f},
-std::array<float,2>{0.69701308f, 0.262855679f},
-std::array<float,2>{0.117521636f, 0.58059299f},
-std::array<float,2>{0.467585355f, 0.0482329242f},
-std::array<float,2>{0.953552425f, 0.803597987f},
-std::array<float,2>{0.790035188f, 0.139657587f},
-std::array<float,2>{0.29969874f, 0.897860467f},
-std::array<float,2>{0.189771935f, 0.479245007f},
-std::array<float,2>{0.555027366f, 0.736922443f},
-std::array<float,2>{0.586410284f, 0.0909418464f},
-std::array<float,2>{0.168071613f, 0.83829695f},
-std::array<float,2>{0.324123442f, 0.352731109f},
-std::array<float,2>{0.868129432f, 0.520046711f},
-std::array<float,2>{0.903431416f, 0.43674159f},
-std::array<float,2>{0.408702791f, 0.66400528f},
-std::array<float,2>{0.0559939072f, 0.236394465f},
-std::array<float,2>{0.669126511f, 0.966494381f},
-std::array<float,2>{0.50099647f, 0.441755474f},
-std::array<float,2>{0.229165599f, 0.688595295f},
-std::array<float,2>{0.266973585f, 0.174857855f},
-std::array<float,2>{0.77127713f, 0.909688294f},
-std::array<float,2>{0.999153376f, 0.00146595319f},
-std::array<float,2>{0.493624181f, 0.763950825f},
-std::array<float,2>{0.0678064004f, 0.295188904f},
-std::array<float,2>{0.733424902f, 0.594849944f},
-std::array<float,2>{0.655297279f, 0.190594077f},
-std::array<float,2>{0.0115447063f, 0.979562342f},
-std::array<float,2>{0.377265364f, 0.376106709f},
-std::array<float,2>{0.928397357f, 0.628171265f},
-std::array<float,2>{0.837832332f, 0.336969584f},
-std::array<float,2>{0.354578048f, 0.552998006f},
-std::array<float,2>{0.132699698f, 0.114941172f},
-std::array<float,2>{0.62394917f, 0.845729291f},
-std::array<float,2>{0.722940743f, 0.476253867f},
-std::array<float,2>{0.071405381f, 0.748528838f},
-std::array<float,2>{0.486474872f, 0.1269591f},
-std::array<float,2>{0.985444546f, 0.899057984f},
-std::array<float,2>{0.775012136f, 0.0571138002f},
-std::array<float,2>{0.27613917f, 0.807208419f},
-std::array<float,2>{0.226027548f, 0.250146091f},
-std::array<float,2>{0.510850728f, 0.587109387f},
-std::array<float,2>{0.613321543f, 0.249065533f},
-std::array<float,2>{0.13898164f, 0.957601547f},
-std::array<float,2>{0.345206618f, 0.423671007f},
-std::array<float,2>{0.833521426f, 0.668567002f},
-std::array<float,2>{0.936734915f, 0.345409632f},
-std::array<float,2>{0.388323337f, 0.529934287f},
-std::array<float,2>{0.00297231786f, 0.0846036151f},
-std::array<float,2>{0.644270241f, 0.834564626f},
-std::array<float,2>{0.548442721f, 0.282866865f},
-std::array<float,2>{0.200087294f, 0.605847418f},
-std::array<float,2>{0.310931534f, 0.0107280547f},
-std::array<float,2>{0.785902619f, 0.757430017f},
-std::array<float,2>{0.965084195f, 0.184513092f},
-std::array<float,2>{0.459234029f, 0.918180645f},
-std::array<float,2>{0.114180885f, 0.450057268f},
-std::array<float,2>{0.693842947f, 0.697595596f},
-std::array<float,2>{0.65896517f, 0.124240778f},
-std::array<float,2>{0.0536073744f, 0.853831232f},
-std::array<float,2>{0.419750839f, 0.331992626f},
-std::array<float,2>{0.891652644f, 0.557649851f},
-std::array<float,2>{0.863111019f, 0.387612164f},
-std::array<float,2>{0.317171127f, 0.635247052f},
-std::array<float,2>{0.159563184f, 0.200664386f},
-std::array<float,2>{0.580108225f, 0.975411892f},
-std::array<float,2>{0.636107087f, 0.323998928f},
-std::array<float,2>{0.0168780573f, 0.535697997f},
-std::array<float,2>{0.40416038f, 0.10514354f},
-std::array<float,2>{0.915659189f, 0.871088684f},
-std::array<float,2>{0.815913558f, 0.205562189f},
-std::array<float,2>{0.369550705f, 0.991445959f},
-std::array<float,2>{0.149133265f, 0.390728801f},
-std::array<float,2>{0.601602972f, 0.650253773f},
-std::array<float,2>{0.524196327f, 0.0278202388f},
-std::array<float,2>{0.244740546f, 0.779876232f},
-std::array<float,2>{0.253647983f, 0.310463607f},
-std::array<float,2>{0.753062308f, 0.624124289f},
-std::array<float,2>{0.97294575f, 0.454436868f},
-std::array<float,2>{0.480097085f, 0.71049279f},
-std::array<float,2>{0.0907782167f, 0.15921998f},
-std::array<float,2>{0.742286026f, 0.923128903f},
-std::array<float,2>{0.565438867f, 0.408757597f},
-std::array<float,2>{0.1811665f, 0.681209743f},
-std::array<float,2>{0.328628659f, 0.234344929f},
-std::array<float,2>{0.847236633f, 0.949185371f},
-std::array<float,2>{0.890532732f, 0.0765360221f},
-std::array<float,2>{0.437290132f, 0.816541135f},
-std::array<float,2>{0.0324291326f, 0.371069491f},
-std::array<float,2>{0.671918213f, 0.5018574f},
-std::array<float,2>{0.710293651f, 0.145378783f},
-std::array<float,2>{0.096061103f, 0.880636871f},
-std::array<float,2>{0.439840108f, 0.49608919f},
-std::array<float,2>{0.939013958f, 0.724455595f},
-std::array<float,2>{0.811227977f, 0.268630385f},
-std::array<float,2>{0.293523699f, 0.564976454f},
-std::array<float,2>{0.21221298f, 0.0350426659f},
-std::array<float,2>{0.540598392f, 0.792457461f},
-std::array<float,2>{0.713035285f, 0.426741868f},
-std::array<float,2>{0.102144279f, 0.667677999f},
-std::array<float,2>{0.450011879f, 0.244922385f},
-std::array<float,2>{0.949378312f, 0.955303192f},
-std::array<float,2>{0.799076557f, 0.0782131925f},
-std::array<float,2>{0.285612434f, 0.831566334f},
-std::array<float,2>{0.203828827f, 0.349785209f},
-std::array<float,2>{0.538013041f, 0.527113318f},
-std::array<float,2>{0.577436864f, 0.13226749f},
-std::array<float,2>{0.178204477f, 0.903958678f},
-std::array<float,2>{0.336779624f, 0.471115381f},
-std::array<float,2>{0.858632505f, 0.742257118f},
-std::array<float,2>{0.880334079f, 0.255617648f},
-std::array<float,2>{0.426351607f, 0.589991271f},
-std::array<float,2>{0.0430895165f, 0.0605559945f},
-std::array<float,2>{0.687421262f, 0.808769643f},
-std::array<float,2>{0.522019684f, 0.335699797f},
-std::array<float,2>{0.239653528f, 0.561448693f},
-std::array<float,2>{0.262056023f, 0.119655944f},
-std::array<float,2>{0.76187402f, 0.857108414f},
-std::array<float,2>{0.978252709f, 0.197708026f},
-std::array<float,2>{0.474314868f, 0.970095515f},
-std::array<float,2>{0.0853334591f, 0.385662496f},
-std::array<float,2>{0.736004055f, 0.637699962f},
-std::array<float,2>{0.631741703f, 0.0141475145f},
-std::array<float,2>{0.026087353f, 0.751668334f},
-std::array<float,2>{0.392869741f, 0.286478221f},
-std::array<float,2>{0.911324322f, 0.601658642f},
-std::array<float,2>{0.821044803f, 0.447532475f},
-std::array<float,2>{0.365317315f, 0.699841976f},
-std::array<float,2>{0.147473484f, 0.181225568f},
-std::array<float,2>{0.601473629f, 0.917460442f},
-std::array<float,2>{0.665246427f, 0.307872385f},
-std::array<float,2>{0.0604928285f, 0.619013369f},
-std::array<float,2>{0.412763059f, 0.0256252736f},
-std::array<float,2>{0.901464462f, 0.775697649f},
-std::array<float,2>{0.874352455f, 0.163353905f},
-std::array<float,2>{0.327110618f, 0.927399397f},
-std::array<float,2>{0.167600393f, 0.458364338f},
-std::array<float,2>{0.589867055f, 0.705311775f},
-std::array<float,2>{0.5600003f, 0.108991727f},
-std::array<float,2>{0.19241859f, 0.872321308f},
-std::array<float,2>{0.30411014f, 0.326771915f},
-std::array<float,2>{0.7967152f, 0.533251286f},
-std::array<float,2>{0.959783733f, 0.394964188f},
-std::array<float,2>{0.463131994f, 0.653789699f},
-std::array<float,2>{0.123270623f, 0.20714891f},
-std::array<float,2>{0.702502489f, 0.985132515f},
-std::array<float,2>{0.619266868f, 0.497123867f},
-std::array<float,2>{0.12644437f, 0.720983922f},
-std::array<float,2>{0.357200563f, 0.143674031f},
-std::array<float,2>{0.841584384f, 0.876401126f},
-std::array<float,2>{0.924374819f, 0.037753392f},
-std::array<float,2>{0.381391913f, 0.796013892f},
-std::array<float,2>{0.0141714029f, 0.272188336f},
-std::array<float,2>{0.648855627f, 0.569550276f},
-std::array<float,2>{0.729209185f, 0.228506193f},
-std::array<float,2>{0.0651416034f, 0.952653944f},
-std::array<float,2>{0.496271133f, 0.41392982f},
-std::array<float,2>{0.994186699f, 0.684612095f},
-std::array<float,2>{0.769114673f, 0.373807967f},
-std::array<float,2>{0.271785378f, 0.507385433f},
-std::array<float,2>{0.232009798f, 0.0717621967f},
-std::array<float,2>{0.50535953f, 0.815819621f},
-std::array<float,2>{0.646221757f, 0.466232896f},
-std::array<float,2>{0.00743478118f, 0.712878644f},
-std::array<float,2>{0.384294331f, 0.171491295f},
-std::array<float,2>{0.931010902f, 0.935395896f},
-std::array<float,2>{0.8299914f, 0.0189027656f},
-std::array<float,2>{0.35076052f, 0.772560537f},
-std::array<float,2>{0.134496301f, 0.297046185f},
-std::array<float,2>{0.613215327f, 0.614577472f},
-std::array<float,2>{0.51411432f, 0.218508422f},
-std::array<float,2>{0.219254181f, 0.996321261f},
-std::array<float,2>{0.279534698f, 0.405164242f},
-std::array<float,2>{0.780969441f, 0.647840619f},
-std::array<float,2>{0.991220117f, 0.318589687f},
-std::array<float,2>{0.489881724f, 0.542847931f},
-std::array<float,2>{0.0754362494f, 0.0940547809f},
-std::array<float,2>{0.721952736f, 0.859470367f},
-std::array<float,2>{0.583577514f, 0.278213769f},
-std::array<float,2>{0.161927715f, 0.574785233f},
-std::array<float,2>{0.312812746f, 0.044401329f},
-std::array<float,2>{0.865247071f, 0.782903016f},
-std::array<float,2>{0.89535439f, 0.152093589f},
-std::array<float,2>{0.417876005f, 0.887073934f},
-std::array<float,2>{0.0498324186f, 0.484823853f},
-std::array<float,2>{0.662136316f, 0.72737807f},
-std::array<float,2>{0.689273596f, 0.0645674616f},
-std::array<float,2>{0.110719353f, 0.825189769f},
-std::array<float,2>{0.454800934f, 0.365254998f},
-std::array<float,2>{0.961618781f, 0.512925327f},
-std::array<float,2>{0.782065928f, 0.418899298f},
-std::array<float,2>{0.308165342f, 0.677226007f},
-std::array<float,2>{0.197007075f, 0.226130351f},
-std::array<float,2>{0.554469049f, 0.941019416f},
-std::array<float,2>{0.749598503f, 0.355784565f},
-std::array<float,2>{0.0882890597f, 0.51744169f},
-std::array<float,2>{0.481118292f, 0.0875709504f},
-std::array<float,2>{0.969991803f, 0.840290904f},
-std::array<float,2>{0.755222797f, 0.239908934f},
-std::array<float,2>{0.254528195f, 0.963113666f},
-std::array<float,2>{0.248367399f, 0.430379599f},
-std::array<float,2>{0.527944565f, 0.659931839f},
-std::array<float,2>{0.608977735f, 0.052481588f},
-std::array<float,2>{0.154541612f, 0.797598243f},
-std::array<float,2>{0.374495745f, 0.260694444f},
-std::array<float,2>{0.820147097f, 0.583113432f},
-std::array<float,2>{0.919757843f, 0.481011331f},
-std::array<float,2>{0.399411768f, 0.738699019f},
-std::array<float,2>{0.0230451785f, 0.135823235f},
-std::array<float,2>{0.639242113f, 0.893736303f},
-std::array<float,2>{0.545714557f, 0.382492602f},
-std::array<float,2>{0.215313554f, 0.631197453f},
-std::array<float,2>{0.291632295f, 0.195038617f},
-std::array<float,2>{0.806228101f, 0.983040571f},
-std::array<float,2>{0.944512963f, 0.109889708f},
-std::array<float,2>{0.444840968f, 0.847793281f},
-std::array<float,2>{0.101086952f, 0.343242437f},
-std::array<float,2>{0.704614878f, 0.547931015f},
-std::array<float,2>{0.678944767f, 0.178003386f},
-std::array<float,2>{0.0371243581f, 0.913538635f},
-std::array<float,2>{0.431091309f, 0.441009045f},
-std::array<float,2>{0.883180141f, 0.693232715f},
-std::array<float,2>{0.85133028f, 0.28957957f},
-std::array<float,2>{0.335056573f, 0.598198831f},
-std::array<float,2>{0.187389672f, 0.00544930017f},
-std::array<float,2>{0.566653013f, 0.761505365f},
-std::array<float,2>{0.668623388f, 0.434312463f},
-std::array<float,2>{0.0547796413f, 0.66057235f},
-std::array<float,2>{0.409700423f, 0.234531179f},
-std::array<float,2>{0.902543485f, 0.968302011f},
-std::array<float,2>{0.868875444f, 0.093493402f},
-std::array<float,2>{0.322903216f, 0.835974574f},
-std::array<float,2>{0.16915305f, 0.354683429f},
-std::array<float,2>{0.587388635f, 0.523233473f},
-std::array<float,2>{0.556562841f, 0.137648329f},
-std::array<float,2>{0.190764442f, 0.895877123f},
-std::array<float,2>{0.300222129f, 0.47822386f},
-std::array<float,2>{0.79017812f, 0.735867977f},
-std::array<float,2>{0.954359949f, 0.265480101f},
-std::array<float,2>{0.468232453f, 0.579030216f},
-std::array<float,2>{0.119100444f, 0.0498876944f},
-std::array<float,2>{0.695423007f, 0.802612364f},
-std::array<float,2>{0.624226987f, 0.338064283f},
-std::array<float,2>{0.130943403f, 0.551669717f},
-std::array<float,2>{0.354147315f, 0.115734458f},
-std::array<float,2>{0.836147189f, 0.845430553f},
-std::array<float,2>{0.929250956f, 0.188026682f},
-std::array<float,2>{0.3779459f, 0.977817893f},
-std::array<float,2>{0.0104114711f, 0.37775287f},
-std::array<float,2>{0.65452373f, 0.626005173f},
-std::array<float,2>{0.733226299f, 0.00250531523f},
-std::array<float,2>{0.0664926022f, 0.762781799f},
-std::array<float,2>{0.492884994f, 0.294256866f},
-std::array<float,2>{0.998281181f, 0.596201718f},
-std::array<float,2>{0.769989431f, 0.444199771f},
-std::array<float,2>{0.266335994f, 0.691230237f},
-std::array<float,2>{0.230176628f, 0.172799811f},
-std::array<float,2>{0.500037968f, 0.908046305f},
-std::array<float,2>{0.714904547f, 0.301864594f},
-std::array<float,2>{0.10571108f, 0.613133371f},
-std::array<float,2>{0.448260516f, 0.0223843101f},
-std::array<float,2>{0.945864201f, 0.767670691f},
-std::array<float,2>{0.80081737f, 0.164410055f},
-std::array<float,2>{0.282518208f, 0.93085283f},
-std::array<float,2>{0.208806083f, 0.462834597f},
-std::array<float,2>{0.531718493f, 0.716150224f},
-std::array<float,2>{0.573073268f, 0.100274786f},
-std::array<float,2>{0.172576234f, 0.8648929f},
-std::array<float,2>{0.342212945f, 0.31480971f},
-std::array<float,2>{0.854643166f, 0.543785214f},
-std::array<float,2>{0.878340125f, 0.398532957f},
-std::array<float,2>{0.422194779f, 0.642023265f},
-std::array<float,2>{0.041585885f, 0.211896747f},
-std::array<float,2>{0.682718933f, 0.994838119f},
-std::array<float,2>{0.517177761f, 0.491680771f},
-std::array<float,2>{0.236036748f, 0.734113753f},
-std::array<float,2>{0.260433882f, 0.153812394f},
-std::array<float,2>{0.760863602f, 0.884506881f},
-std::array<float,2>{0.981795073f, 0.0401229262f},
-std::array<float,2>{0.470279962f, 0.785676479f},
-std::array<float,2>{0.0801129714f, 0.276196867f},
-std::array<float,2>{0.740843534f, 0.573638797f},
-std::array<float,2>{0.628081203f, 0.221747905f},
-std::array<float,2>{0.0310210306f, 0.94265461f},
-std::array<float,2>{0.395643771f, 0.415961921f},
-std::array<float,2>{0.910050988f, 0.675553679f},
-std::array<float,2>{0.824464023f, 0.359887242f},
-std::array<float,2>{0.359721005f, 0.51064384f},
-std::array<float,2>{0.143114895f, 0.068024084f},
-std::array<float,2>{0.593919098f, 0.823443353f},
-std::array<float,2>{0.743564188f, 0.45511961f},
-std::array<float,2>{0.0908310935f, 0.707293868f},
-std::array<float,2>{0.478831232f, 0.157256156f},
-std::array<float,2>{0.974478126f, 0.925457239f},
-std::array<float,2>{0.752913654f, 0.0306465086f},
-std::array<float,2>{0.252265543f, 0.777765572f},
-std::array<float,2>{0.245695755f, 0.311594486f},
-std::array<float,2>{0.525062382f, 0.621780097f},
-std::array<float,2>{0.603304684f, 0.203491673f},
-std::array<float,2>{0.149715841f, 0.989471972f},
-std::array<float,2>{0.370674223f, 0.394342095f},
-std::array<float,2>{0.81474036f, 0.652130544f},
-std::array<float,2>{0.914497852f, 0.320319951f},
-std::array<float,2>{0.403104424f, 0.538466513f},
-std::array<float,2>{0.016553212f, 0.102167279f},
-std::array<float,2>{0.635235846f, 0.868514061f},
-std::array<float,2>{0.539114475f, 0.266062915f},
-std::array<float,2>{0.211027414f, 0.564279675f},
-std::array<float,2>{0.294036448f, 0.0325389877f},
-std::array<float,2>{0.811839461f, 0.790300965f},
-std::array<float,2>{0.937895715f, 0.146720141f},
-std::array<float,2>{0.44121635f, 0.882523f},
-std::array<float,2>{0.0970689878f, 0.493724734f},
-std::array<float,2>{0.709852099f, 0.726434529f},
-std::array<float,2>{0.672885299f, 0.0746414587f},
-std::array<float,2>{0.0318315662f, 0.820038497f},
-std::array<float,2>{0.436362416f, 0.368822217f},
-std::array<float,2>{0.889636278f, 0.503490806f},
-std::array<float,2>{0.846473396f, 0.407951117f},
-std::array<float,2>{0.329438001f, 0.682923913f},
-std::array<float,2>{0.179994628f, 0.232397527f},
-std::array<float,2>{0.564819515f, 0.945929289f},
-std::array<float,2>{0.642590761f, 0.346132845f},
-std::array<float,2>{0.00269571925f, 0.528606832f},
-std::array<float,2>{0.386795402f, 0.0839304402f},
-std::array<float,2>{0.935639381f, 0.833849907f},
-std::array<float,2>{0.832733452f, 0.247201279f},
-std::array<float,2>{0.344445139f, 0.960735798f},
-std::array<float,2>{0.13994287f, 0.425680697f},
-std::array<float,2>{0.614665329f, 0.671433687f},
-std::array<float,2>{0.509916306f, 0.0548042133f},
-std::array<float,2>{0.225267664f, 0.805391669f},
-std::array<float,2>{0.277156651f, 0.253650725f},
-std::array<float,2>{0.774312079f, 0.588653147f},
-std::array<float,2>{0.98484236f, 0.474271387f},
-std::array<float,2>{0.487667233f, 0.747911036f},
-std::array<float,2>{0.0707648173f, 0.125014767f},
-std::array<float,2>{0.724263072f, 0.90078032f},
-std::array<float,2>{0.581432283f, 0.389741331f},
-std::array<float,2>{0.159102961f, 0.633433282f},
-std::array<float,2>{0.317609638f, 0.201421767f},
-std::array<float,2>{0.861972749f, 0.973207057f},
-std::array<float,2>{0.891601562f, 0.121195108f},
-std::array<float,2>{0.418877006f, 0.852688551f},
-std::array<float,2>{0.0537788123f, 0.328683496f},
-std::array<float,2>{0.659203827f, 0.555771708f},
-std::array<float,2>{0.694951534f, 0.187488317f},
-std::array<float,2>{0.114807695f, 0.920559764f},
-std::array<float,2>{0.460429966f, 0.452784687f},
-std::array<float,2>{0.966193736f, 0.697061121f},
-std::array<float,2>{0.786909699f, 0.283420056f},
-std::array<float,2>{0.312109053f, 0.607544541f},
-std::array<float,2>{0.200788319f, 0.00868516695f},
-std::array<float,2>{0.547267258f, 0.754461765f},
-std::array<float,2>{0.7017138f, 0.396528304f},
-std::array<float,2>{0.124945186f, 0.655307472f},
-std::array<float,2>{0.464733064f, 0.209896877f},
-std::array<float,2>{0.96034652f, 0.987651587f},
-std::array<float,2>{0.795472622f, 0.106094278f},
-std::array<float,2>{0.30327183f, 0.874636114f},
-std::array<float,2>{0.191455111f, 0.325189114f},
-std::array<float,2>{0.558908343f, 0.532957196f},
-std::array<float,2>{0.591723144f, 0.160984784f},
-std::array<float,2>{0.166600659f, 0.928563714f},
-std::array<float,2>{0.328040779f, 0.459332705f},
-std::array<float,2>{0.873582602f, 0.704786837f},
-std::array<float,2>{0.901116192f, 0.304719061f},
-std::array<float,2>{0.413654953f, 0.619722784f},
-std::array<float,2>{0.0593068562f, 0.0245306231f},
-std::array<float,2>{0.664799035f, 0.773502052f},
-std::array<float,2>{0.504626572f, 0.372821212f},
-std::array<float,2>{0.230515584f, 0.504622996f},
-std::array<float,2>{0.272556186f, 0.0725117922f},
-std::array<float,2>{0.768318355f, 0.812939763f},
-std::array<float,2>{0.995396316f, 0.230252191f},
-std::array<float,2>{0.497911811f, 0.949741066f},
-std::array<float,2>{0.0656196102f, 0.410361946f},
-std::array<float,2>{0.729876578f, 0.687294006f},
-std::array<float,2>{0.649650455f, 0.0366966538f},
-std::array<float,2>{0.0149203017f, 0.793372691f},
-std::array<float,2>{0.382022738f, 0.269857496f},
-std::array<float,2>{0.924849808f, 0.56732291f},
-std::array<float,2>{0.840392053f, 0.498962522f},
-std::array<float,2>{0.355738044f, 0.719390571f},
-std::array<float,2>{0.125038549f, 0.141159296f},
-std::array<float,2>{0.620948374f, 0.877476335f},
-std::array<float,2>{0.685807407f, 0.25697726f},
-std::array<float,2>{0.0447616316f, 0.592017233f},
-std::array<float,2>{0.42729184f, 0.0603302009f},
-std::array<float,2>{0.879533589f, 0.810931921f},
-std::array<float,2>{0.857737541f, 0.129278824f},
-std::array<float,2>{0.337815166f, 0.90518415f},
-std::array<float,2>{0.179313019f, 0.469751388f},
-std::array<float,2>{0.576933205f, 0.745486617f},
-std::array<float,2>{0.538280606f, 0.0806064606f},
-std::array<float,2>{0.204839349f, 0.828475833f},
-std::array<float,2>{0.286251158f, 0.349588811f},
-std::array<float,2>{0.800720334f, 0.523841143f},
-std::array<float,2>{0.951121628f, 0.42889145f},
-std::array<float,2>{0.450625807f, 0.665592134f},
-std::array<float,2>{0.103493311f, 0.24397856f},
-std::array<float,2>{0.713973522f, 0.953500688f},
-std::array<float,2>{0.600584149f, 0.446380764f},
-std::array<float,2>{0.146933943f, 0.701598108f},
-std::array<float,2>{0.366277546f, 0.182987064f},
-std::array<float,2>{0.822175443f, 0.914616525f},
-std::array<float,2>{0.910764813f, 0.0128276413f},
-std::array<float,2>{0.393796623f, 0.753762484f},
-std::array<float,2>{0.026983358f, 0.288801223f},
-std::array<float,2>{0.632592976f, 0.605169415f},
-std::array<float,2>{0.734621763f, 0.195935398f},
-std::array<float,2>{0.0841561779f, 0.971668005f},
-std::array<float,2>{0.473297477f, 0.383557409f},
-std::array<float,2>{0.976781487f, 0.640570641f},
-std::array<float,2>{0.762697756f, 0.332241029f},
-std::array<float,2>{0.262939692f, 0.560049355f},
-std::array<float,2>{0.239059135f, 0.117348365f},
-std::array<float,2>{0.523051202f, 0.859121919f},
-std::array<float,2>{0.640031159f, 0.483993471f},
-std::array<float,2>{0.0216428377f, 0.741472006f},
-std::array<float,2>{0.400251746f, 0.133517429f},
-std::array<float,2>{0.918572664f, 0.891237259f},
-std::array<float,2>{0.819053054f, 0.0534265675f},
-std::array<float,2>{0.373882174f, 0.799235523f},
-std::array<float,2>{0.155887723f, 0.259374052f},
-std::array<float,2>{0.60773766f, 0.584640741f},
-std::array<float,2>{0.528563321f, 0.24026826f},
-std::array<float,2>{0.249646634f, 0.961710989f},
-std::array<float,2>{0.255442947f, 0.432363808f},
-std::array<float,2>{0.753936946f, 0.656502128f},
-std::array<float,2>{0.969338f, 0.358462214f},
-std::array<float,2>{0.482362539f, 0.518030703f},
-std::array<float,2>{0.0889768004f, 0.0895954669f},
-std::array<float,2>{0.748771787f, 0.843600452f},
-std::array<float,2>{0.568192899f, 0.292135864f},
-std::array<float,2>{0.186515659f, 0.600048602f},
-std::array<float,2>{0.334590495f, 0.00601522438f},
-std::array<float,2>{0.849634528f, 0.759093761f},
-std::array<float,2>{0.883963227f, 0.175952613f},
-std::array<float,2>{0.430334032f, 0.910652876f},
-std::array<float,2>{0.0385953262f, 0.438889444f},
-std::array<float,2>{0.67777735f, 0.695072055f},
-std::array<float,2>{0.703911304f, 0.112558641f},
-std::array<float,2>{0.100315444f, 0.85113734f},
-std::array<float,2>{0.444173604f, 0.341240019f},
-std::array<float,2>{0.944138706f, 0.549738646f},
-std::array<float,2>{0.805591643f, 0.380345851f},
-std::array<float,2>{0.292258769f, 0.629033983f},
-std::array<float,2>{0.21613574f, 0.191464826f},
-std::array<float,2>{0.546581566f, 0.981993437f},
-std::array<float,2>{0.721006155f, 0.317010462f},
-std::array<float,2>{0.0749074593f, 0.539930522f},
-std::array<float,2>{0.48877427f, 0.0975535959f},
-std::array<float,2>{0.991130471f, 0.8629722f},
-std::array<float,2>{0.780209064f, 0.215483472f},
-std::array<float,2>{0.28043595f, 0.99927336f},
-std::array<float,2>{0.219759226f, 0.402516156f},
-std::array<float,2>{0.515021801f, 0.645010233f},
-std::array<float,2>{0.611943483f, 0.0157221965f},
-std::array<float,2>{0.133066714f, 0.771276295f},
-std::array<float,2>{0.349913478f, 0.299602687f},
-std::array<float,2>{0.82822597f, 0.616115034f},
-std::array<float,2>{0.930506766f, 0.467210144f},
-std::array<float,2>{0.383130223f, 0.713921905f},
-std::array<float,2>{0.00621175813f, 0.168576747f},
-std::array<float,2>{0.644828796f, 0.936354816f},
-std::array<float,2>{0.553631127f, 0.421025544f},
-std::array<float,2>{0.195762515f, 0.677801788f},
-std::array<float,2>{0.307538062f, 0.222802967f},
-std::array<float,2>{0.782432199f, 0.937958956f},
-std::array<float,2>{0.962705195f, 0.064208366f},
-std::array<float,2>{0.454002738f, 0.827146351f},
-std::array<float,2>{0.110081345f, 0.363519043f},
-std::array<float,2>{0.687577128f, 0.515022278f},
-std::array<float,2>{0.663484097f, 0.149692953f},
-std::array<float,2>{0.0492217839f, 0.890497983f},
-std::array<float,2>{0.416251898f, 0.486844778f},
-std::array<float,2>{0.895947337f, 0.729864836f},
-std::array<float,2>{0.866935253f, 0.279624164f},
-std::array<float,2>{0.314319909f, 0.577673376f},
-std::array<float,2>{0.160821438f, 0.0461919345f},
-std::array<float,2>{0.582846284f, 0.784099281f},
-std::array<float,2>{0.653155208f, 0.375858396f},
-std::array<float,2>{0.00794032868f, 0.627315462f},
-std::array<float,2>{0.37518841f, 0.189581022f},
-std::array<float,2>{0.926172197f, 0.978997231f},
-std::array<float,2>{0.839044631f, 0.113962062f},
-std::array<float,2>{0.35209465f, 0.8474347f},
-std::array<float,2>{0.130396739f, 0.336067587f},
-std::array<float,2>{0.622800529f, 0.554454148f},
-std::array<float,2>{0.502411723f, 0.174062386f},
-std::array<float,2>{0.227672726f, 0.908327997f},
-std::array<float,2>{0.269427687f, 0.442946255f},
-std::array<float,2>{0.771549344f, 0.687948823f},
-std::array<float,2>{0.997620821f, 0.296853691f},
-std::array<float,2>{0.495889455f, 0.593935132f},
-std::array<float,2>{0.0698551163f, 0.000555883336f},
-std::array<float,2>{0.730914474f, 0.76532042f},
-std::array<float,2>{0.587948143f, 0.352026492f},
-std::array<float,2>{0.171713114f, 0.520507812f},
-std::array<float,2>{0.32166329f, 0.0907815844f},
-std::array<float,2>{0.870366871f, 0.83924824f},
-std::array<float,2>{0.904429078f, 0.238201171f},
-std::array<float,2>{0.406540245f, 0.965009928f},
-std::array<float,2>{0.0574212559f, 0.435949475f},
-std::array<float,2>{0.670025468f, 0.662583947f},
-std::array<float,2>{0.698208988f, 0.0473407805f},
-std::array<float,2>{0.119509459f, 0.804676235f},
-std::array<float,2>{0.466270626f, 0.262402654f},
-std::array<float,2>{0.955082178f, 0.58188504f},
-std::array<float,2>{0.792818427f, 0.480141371f},
-std::array<float,2>{0.297492802f, 0.737799168f},
-std::array<float,2>{0.188814566f, 0.138716787f},
-std::array<float,2>{0.557548463f, 0.897236049f},
-std::array<float,2>{0.739330053f, 0.274401426f},
-std::array<float,2>{0.07972987f, 0.571434617f},
-std::array<float,2>{0.470707208f, 0.0417163111f},
-std::array<float,2>{0.983842254f, 0.788691401f},
-std::array<float,2>{0.759232461f, 0.155958161f},
-std::array<float,2>{0.259312809f, 0.8853544f},
-std::array<float,2>{0.237361476f, 0.488952875f},
-std::array<float,2>{0.519335747f, 0.731063306f},
-std::array<float,2>{0.596093476f, 0.0692348182f},
-std::array<float,2>{0.141534716f, 0.821873903f},
-std::array<float,2>{0.361911684f, 0.362541735f},
-std::array<float,2>{0.827834725f, 0.508182645f},
-std::array<float,2>{0.906790495f, 0.416424006f},
-std::array<float,2>{0.397712797f, 0.672921777f},
-std::array<float,2>{0.0278660413f, 0.219235227f},
-std::array<float,2>{0.626853704f, 0.944182217f},
-std::array<float,2>{0.533778548f, 0.463140488f},
-std::array<float,2>{0.20957233f, 0.71788466f},
-std::array<float,2>{0.28514424f, 0.166224822f},
-std::array<float,2>{0.803040564f, 0.932549894f},
-std::array<float,2>{0.948895514f, 0.0202762149f},
-std::array<float,2>{0.445405632f, 0.766738772f},
-std::array<float,2>{0.107688457f, 0.303988665f},
-std::array<float,2>{0.718266666f, 0.610596299f},
-std::array<float,2>{0.680843055f, 0.214249045f},
-std::array<float,2>{0.0397531912f, 0.992421985f},
-std::array<float,2>{0.424641907f, 0.40108797f},
-std::array<float,2>{0.876868427f, 0.644452274f},
-std::array<float,2>{0.852231801f, 0.313298643f},
-std::array<float,2>{0.34112829f, 0.546200156f},
-std::array<float,2>{0.175721988f, 0.099397704f},
-std::array<float,2>{0.571399987f, 0.86622709f},
-std::array<float,2>{0.708480656f, 0.494572788f},
-std::array<float,2>{0.0953607634f, 0.723223925f},
-std::array<float,2>{0.439053237f, 0.14643842f},
-std::array<float,2>{0.940478683f, 0.879569054f},
-std::array<float,2>{0.810285449f, 0.0332054608f},
-std::array<float,2>{0.296720326f, 0.791362882f},
-std::array<float,2>{0.214345455f, 0.267817616f},
-std::array<float,2>{0.541088343f, 0.565967679f},
-std::array<float,2>{0.563604832f, 0.233270451f},
-std::array<float,2>{0.182583645f, 0.948063731f},
-std::array<float,2>{0.330233872f, 0.409657001f},
-std::array<float,2>{0.845650375f, 0.680492342f},
-std::array<float,2>{0.887186229f, 0.369568229f},
-std::array<float,2>{0.433796763f, 0.500301838f},
-std::array<float,2>{0.0348331183f, 0.0773253068f},
-std::array<float,2>{0.67462492f, 0.818251252f},
-std::array<float,2>{0.525602639f, 0.309317023f},
-std::array<float,2>{0.242770791f, 0.62385869f},
-std::array<float,2>{0.251791745f, 0.0285508633f},
-std::array<float,2>{0.750831246f, 0.781155765f},
-std::array<float,2>{0.976284027f, 0.158469573f},
-std::array<float,2>{0.476731002f, 0.922822654f},
-std::array<float,2>{0.0935749188f, 0.453692079f},
-std::array<float,2>{0.745742977f, 0.709686458f},
-std::array<float,2>{0.634522915f, 0.103727564f},
-std::array<float,2>{0.0188595466f, 0.869378924f},
-std::array<float,2>{0.404801399f, 0.322404712f},
-std::array<float,2>{0.917394578f, 0.536190748f},
-std::array<float,2>{0.813739061f, 0.392207265f},
-std::array<float,2>{0.368586987f, 0.649355233f},
-std::array<float,2>{0.150815293f, 0.206226364f},
-std::array<float,2>{0.605226278f, 0.990332365f},
-std::array<float,2>{0.65672636f, 0.331036925f},
-std::array<float,2>{0.0521680638f, 0.557245016f},
-std::array<float,2>{0.42161572f, 0.123921536f},
-std::array<float,2>{0.893105567f, 0.855294347f},
-std::array<float,2>{0.860972404f, 0.199224561f},
-std::array<float,2>{0.320244521f, 0.975849509f},
-std::array<float,2>{0.156534955f, 0.388216287f},
-std::array<float,2>{0.578561544f, 0.636703372f},
-std::array<float,2>{0.550715089f, 0.0112464642f},
-std::array<float,2>{0.201877087f, 0.756709516f},
-std::array<float,2>{0.308853f, 0.281637609f},
-std::array<float,2>{0.788538277f, 0.607115328f},
-std::array<float,2>{0.968598306f, 0.450932294f},
-std::array<float,2>{0.458212852f, 0.698307395f},
-std::array<float,2>{0.115249522f, 0.18514508f},
-std::array<float,2>{0.692382932f, 0.919253469f},
-std::array<float,2>{0.615415692f, 0.422365308f},
-std::array<float,2>{0.137782067f, 0.668978155f},
-std::array<float,2>{0.347631663f, 0.248874098f},
-std::array<float,2>{0.833999872f, 0.958340108f},
-std::array<float,2>{0.934324086f, 0.085122399f},
-std::array<float,2>{0.389374673f, 0.835008562f},
-std::array<float,2>{0.000420879223f, 0.344082892f},
-std::array<float,2>{0.640821874f, 0.530631721f},
-std::array<float,2>{0.726465821f, 0.128554806f},
-std::array<float,2>{0.0739987046f, 0.899569988f},
-std::array<float,2>{0.485310644f, 0.475427866f},
-std::array<float,2>{0.986382127f, 0.74923563f},
-std::array<float,2>{0.776781738f, 0.251549512f},
-std::array<float,2>{0.273851812f, 0.586730957f},
-std::array<float,2>{0.22375299f, 0.0576270074f},
-std::array<float,2>{0.509537578f, 0.808549762f},
-std::array<float,2>{0.727017403f, 0.412521303f},
-std::array<float,2>{0.0638058931f, 0.683895826f},
-std::array<float,2>{0.498071194f, 0.227469683f},
-std::array<float,2>{0.992991149f, 0.951750338f},
-std::array<float,2>{0.76607275f, 0.0712364465f},
-std::array<float,2>{0.270460814f, 0.814857483f},
-std::array<float,2>{0.234266102f, 0.37469539f},
-std::array<float,2>{0.506252944f, 0.506783664f},
-std::array<float,2>{0.618974984f, 0.143012896f},
-std::array<float,2>{0.12735042f, 0.875505745f},
-std::array<float,2>{0.358924806f, 0.497013181f},
-std::array<float,2>{0.841900229f, 0.722377777f},
-std::array<float,2>{0.923272848f, 0.272715747f},
-std::array<float,2>{0.379131287f, 0.569269598f},
-std::array<float,2>{0.0134542957f, 0.0388222784f},
-std::array<float,2>{0.651054978f, 0.794922411f},
-std::array<float,2>{0.560652256f, 0.327835649f},
-std::array<float,2>{0.194289565f, 0.534568012f},
-std::array<float,2>{0.301395714f, 0.107958712f},
-std::array<float,2>{0.79392755f, 0.871450663f},
-std::array<float,2>{0.957536399f, 0.208502561f},
-std::array<float,2>{0.462666839f, 0.985556781f},
-std::array<float,2>{0.122566059f, 0.395708352f},
-std::array<float,2>{0.700750411f, 0.652536452f},
-std::array<float,2>{0.666339159f, 0.0264087096f},
-std::array<float,2>{0.062441539f, 0.776679397f},
-std::array<float,2>{0.410346597f, 0.307337821f},
-std::array<float,2>{0.898818851f, 0.61721164f},
-std::array<float,2>{0.871578217f, 0.457516998f},
-std::array<float,2>{0.324642301f, 0.70691359f},
-std::array<float,2>{0.165833339f, 0.162255049f},
-std::array<float,2>{0.5926283f, 0.926023245f},
-std::array<float,2>{0.630195498f, 0.285819322f},
-std::array<float,2>{0.0246695112f, 0.602710962f},
-std::array<float,2>{0.391404033f, 0.0154421814f},
-std::array<float,2>{0.912818253f, 0.75033015f},
-std::array<float,2>{0.824057102f, 0.180373415f},
-std::array<float,2>{0.363967538f, 0.916328847f},
-std::array<float,2>{0.146331728f, 0.448760241f},
-std::array<float,2>{0.598553896f, 0.700795591f},
-std::array<float,2>{0.519692719f, 0.120704681f},
-std::array<float,2>{0.24173601f, 0.855647683f},
-std::array<float,2>{0.26424703f, 0.334750742f},
-std::array<float,2>{0.765565991f, 0.562437654f},
-std::array<float,2>{0.980164051f, 0.386402994f},
-std::array<float,2>{0.476328999f, 0.636953712f},
-std::array<float,2>{0.0839515179f, 0.198584557f},
-std::array<float,2>{0.737952471f, 0.969207823f},
-std::array<float,2>{0.574926615f, 0.472167045f},
-std::array<float,2>{0.176308006f, 0.743240833f},
-std::array<float,2>{0.338759065f, 0.131795645f},
-std::array<float,2>{0.856671512f, 0.902445078f},
-std::array<float,2>{0.882784069f, 0.0619081073f},
-std::array<float,2>{0.428100854f, 0.810506582f},
-std::array<float,2>{0.0450077392f, 0.254136235f},
-std::array<float,2>{0.685056865f, 0.591247261f},
-std::array<float,2>{0.711415827f, 0.246049479f},
-std::array<float,2>{0.105352469f, 0.956371665f},
-std::array<float,2>{0.452036142f, 0.427134603f},
-std::array<float,2>{0.951542795f, 0.66657871f},
-std::array<float,2>{0.79733479f, 0.351312906f},
-std::array<float,2>{0.28834185f, 0.525444686f},
-std::array<float,2>{0.20558542f, 0.0792153701f},
-std::array<float,2>{0.535217762f, 0.830857992f},
-std::array<float,2>{0.677635312f, 0.440267205f},
-std::array<float,2>{0.0360358618f, 0.691900432f},
-std::array<float,2>{0.43219164f, 0.179230556f},
-std::array<float,2>{0.885616064f, 0.91233778f},
-std::array<float,2>{0.848109961f, 0.00447032135f},
-std::array<float,2>{0.332487643f, 0.760055602f},
-std::array<float,2>{0.18486397f, 0.290672988f},
-std::array<float,2>{0.568987012f, 0.598787069f},
-std::array<float,2>{0.544575751f, 0.193882763f},
-std::array<float,2>{0.217478707f, 0.983533084f},
-std::array<float,2>{0.290423542f, 0.381806612f},
-std::array<float,2>{0.806721628f, 0.632479131f},
-std::array<float,2>{0.94246763f, 0.341940016f},
-std::array<float,2>{0.442730665f, 0.547460794f},
-std::array<float,2>{0.0985248014f, 0.110915467f},
-std::array<float,2>{0.705603898f, 0.848812461f},
-std::array<float,2>{0.605654657f, 0.261090219f},
-std::array<float,2>{0.152434856f, 0.582328677f},
-std::array<float,2>{0.372900188f, 0.0517495163f},
-std::array<float,2>{0.818271339f, 0.797866344f},
-std::array<float,2>{0.921784818f, 0.135446519f},
-std::array<float,2>{0.401183993f, 0.893234253f},
-std::array<float,2>{0.0205206946f, 0.481454879f},
-std::array<float,2>{0.638066471f, 0.739411414f},
-std::array<float,2>{0.746684551f, 0.0860838071f},
-std::array<float,2>{0.0862310678f, 0.84119308f},
-std::array<float,2>{0.483330548f, 0.356645226f},
-std::array<float,2>{0.971927166f, 0.516220152f},
-std::array<float,2>{0.756920516f, 0.431379974f},
-std::array<float,2>{0.256728292f, 0.658335268f},
-std::array<float,2>{0.24631089f, 0.238931522f},
-std::array<float,2>{0.529828668f, 0.964571476f},
-std::array<float,2>{0.689886272f, 0.366953284f},
-std::array<float,2>{0.111423887f, 0.511975706f},
-std::array<float,2>{0.455801576f, 0.0662728399f},
-std::array<float,2>{0.964451075f, 0.826041341f},
-std::array<float,2>{0.783543348f, 0.225102007f},
-std::array<float,2>{0.305063605f, 0.940345228f},
-std::array<float,2>{0.198271662f, 0.419009268f},
-std::array<float,2>{0.551801682f, 0.676687658f},
-std::array<float,2>{0.585380554f, 0.043540895f},
-std::array<float,2>{0.16356124f, 0.781782329f},
-std::array<float,2>{0.314538002f, 0.27908662f},
-std::array<float,2>{0.864871621f, 0.575842917f},
-std::array<float,2>{0.896541238f, 0.485584229f},
-std::array<float,2>{0.414378375f, 0.72791338f},
-std::array<float,2>{0.0483823344f, 0.150717571f},
-std::array<float,2>{0.660643935f, 0.888134897f},
-std::array<float,2>{0.512075603f, 0.405275524f},
-std::array<float,2>{0.221302271f, 0.646510482f},
-std::array<float,2>{0.278329194f, 0.217599407f},
-std::array<float,2>{0.77883023f, 0.997119963f},
-std::array<float,2>{0.988762736f, 0.0951891914f},
-std::array<float,2>{0.491860062f, 0.860375464f},
-std::array<float,2>{0.0781248659f, 0.319872588f},
-std::array<float,2>{0.719070911f, 0.541800737f},
-std::array<float,2>{0.648014128f, 0.170546755f},
-std::array<float,2>{0.00549877388f, 0.934096575f},
-std::array<float,2>{0.38505581f, 0.465125293f},
-std::array<float,2>{0.932130754f, 0.711277962f},
-std::array<float,2>{0.831835687f, 0.298268318f},
-std::array<float,2>{0.349199355f, 0.614067554f},
-std::array<float,2>{0.136380494f, 0.0179872867f},
-std::array<float,2>{0.610704541f, 0.771496892f},
-std::array<float,2>{0.651310682f, 0.412013918f},
-std::array<float,2>{0.0132415164f, 0.68581599f},
-std::array<float,2>{0.379162967f, 0.2290252f},
-std::array<float,2>{0.922954142f, 0.950528026f},
-std::array<float,2>{0.842271209f, 0.0733920336f},
-std::array<float,2>{0.359235406f, 0.813739538f},
-std::array<float,2>{0.126977056f, 0.371373534f},
-std::array<float,2>{0.618851662f, 0.505643427f},
-std::array<float,2>{0.505992055f, 0.142323762f},
-std::array<float,2>{0.233904094f, 0.878528476f},
-std::array<float,2>{0.270093024f, 0.499383688f},
-std::array<float,2>{0.765698075f, 0.720028043f},
-std::array<float,2>{0.992823482f, 0.270574033f},
-std::array<float,2>{0.498533249f, 0.568342507f},
-std::array<float,2>{0.0636371747f, 0.035713952f},
-std::array<float,2>{0.726740122f, 0.794723034f},
-std::array<float,2>{0.592476189f, 0.325625181f},
-std::array<float,2>{0.165550381f, 0.532129645f},
-std::array<float,2>{0.324269027f, 0.106496915f},
-std::array<float,2>{0.871109545f, 0.873371243f},
-std::array<float,2>{0.89859283f, 0.210631907f},
-std::array<float,2>{0.410592794f, 0.986535192f},
-std::array<float,2>{0.0622449517f, 0.398355424f},
-std::array<float,2>{0.666171849f, 0.654625058f},
-std::array<float,2>{0.701170027f, 0.0241784956f},
-std::array<float,2>{0.122836821f, 0.775121689f},
-std::array<float,2>{0.462554067f, 0.305733204f},
-std::array<float,2>{0.95798111f, 0.620854497f},
-std::array<float,2>{0.793701112f, 0.460286289f},
-std::array<float,2>{0.301595092f, 0.703528404f},
-std::array<float,2>{0.194083959f, 0.161591813f},
-std::array<float,2>{0.560894012f, 0.929541588f},
-std::array<float,2>{0.738240898f, 0.288057923f},
-std::array<float,2>{0.0836189836f, 0.604307592f},
-std::array<float,2>{0.47617051f, 0.0122923786f},
-std::array<float,2>{0.980245948f, 0.752025008f},
-std::array<float,2>{0.765300274f, 0.182256877f},
-std::array<float,2>{0.264643401f, 0.915888369f},
-std::array<float,2>{0.242093667f, 0.445654064f},
-std::array<float,2>{0.519882023f, 0.702893794f},
-std::array<float,2>{0.598270297f, 0.118602939f},
-std::array<float,2>{0.146028742f, 0.857710183f},
-std::array<float,2>{0.3641572f, 0.333626121f},
-std::array<float,2>{0.823758543f, 0.559423506f},
-std::array<float,2>{0.912971079f, 0.384220213f},
-std::array<float,2>{0.391154081f, 0.639415562f},
-std::array<float,2>{0.0245295186f, 0.196353123f},
-std::array<float,2>{0.62996465f, 0.971933305f},
-std::array<float,2>{0.535428762f, 0.469340652f},
-std::array<float,2>{0.206050754f, 0.744446635f},
-std::array<float,2>{0.288115084f, 0.130449682f},
-std::array<float,2>{0.79708463f, 0.905483186f},
-std::array<float,2>{0.951274037f, 0.0591472387f},
-std::array<float,2>{0.451890647f, 0.812347949f},
-std::array<float,2>{0.105198629f, 0.256718487f},
-std::array<float,2>{0.711064219f, 0.593301773f},
-std::array<float,2>{0.684714377f, 0.242726788f},
-std::array<float,2>{0.0452272519f, 0.954266787f},
-std::array<float,2>{0.427786946f, 0.428393424f},
-std::array<float,2>{0.882458985f, 0.664485753f},
-std::array<float,2>{0.856760263f, 0.347896606f},
-std::array<float,2>{0.338555306f, 0.52506882f},
-std::array<float,2>{0.176557586f, 0.0819991156f},
-std::array<float,2>{0.57505548f, 0.829395592f},
-std::array<float,2>{0.706027448f, 0.437971771f},
-std::array<float,2>{0.0983728394f, 0.694265783f},
-std::array<float,2>{0.44242841f, 0.177136824f},
-std::array<float,2>{0.942671657f, 0.911391258f},
-std::array<float,2>{0.807022452f, 0.00721091358f},
-std::array<float,2>{0.290052742f, 0.758784592f},
-std::array<float,2>{0.217724398f, 0.291385889f},
-std::array<float,2>{0.544881165f, 0.601177812f},
-std::array<float,2>{0.569218218f, 0.192806497f},
-std::array<float,2>{0.184589133f, 0.981057048f},
-std::array<float,2>{0.332170486f, 0.378987998f},
-std::array<float,2>{0.84774226f, 0.630686998f},
-std::array<float,2>{0.885304153f, 0.340128273f},
-std::array<float,2>{0.432452738f, 0.550101638f},
-std::array<float,2>{0.0357423574f, 0.112286814f},
-std::array<float,2>{0.677357435f, 0.850218952f},
-std::array<float,2>{0.530203044f, 0.257864147f},
-std::array<float,2>{0.246355474f, 0.585241556f},
-std::array<float,2>{0.256476462f, 0.0541312434f},
-std::array<float,2>{0.757291436f, 0.799832642f},
-std::array<float,2>{0.971915245f, 0.133890346f},
-std::array<float,2>{0.48295781f, 0.891803622f},
-std::array<float,2>{0.0860413536f, 0.483360708f},
-std::array<float,2>{0.74704504f, 0.740608692f},
-std::array<float,2>{0.637885392f, 0.0880808532f},
-std::array<float,2>{0.0208835192f, 0.842233896f},
-std::array<float,2>{0.400982141f, 0.35805741f},
-std::array<float,2>{0.921479344f, 0.519431949f},
-std::array<float,2>{0.817990422f, 0.433399022f},
-std::array<float,2>{0.372769177f, 0.657317877f},
-std::array<float,2>{0.152681515f, 0.241866022f},
-std::array<float,2>{0.605880618f, 0.962718189f},
-std::array<float,2>{0.660381675f, 0.3651447f},
-std::array<float,2>{0.0487805009f, 0.514079571f},
-std::array<float,2>{0.414152443f, 0.0634248853f},
-std::array<float,2>{0.8968997f, 0.827221572f},
-std::array<float,2>{0.865192533f, 0.224576563f},
-std::array<float,2>{0.314717472f, 0.939388871f},
-std::array<float,2>{0.163223073f, 0.420681208f},
-std::array<float,2>{0.585009575f, 0.679539979f},
-std::array<float,2>{0.552123964f, 0.0451131575f},
-std::array<float,2>{0.198656932f, 0.785080612f},
-std::array<float,2>{0.304897547f, 0.280963212f},
-std::array<float,2>{0.783242226f, 0.577016592f},
-std::array<float,2>{0.964610219f, 0.48747611f},
-std::array<float,2>{0.455958337f, 0.728919685f},
-std::array<float,2>{0.111637592f, 0.148489133f},
-std::array<float,2>{0.689495265f, 0.889187932f},
-std::array<float,2>{0.610477924f, 0.403829634f},
-std::array<float,2>{0.136479214f, 0.645733714f},
-std::array<float,2>{0.34946087f, 0.216542616f},
-std::array<float,2>{0.831593394f, 0.998328745f},
-std::array<float,2>{0.932374775f, 0.0959931612f},
-std::array<float,2>{0.384804249f, 0.862138569f},
-std::array<float,2>{0.00580415968f, 0.317451775f},
-std::array<float,2>{0.648320019f, 0.540704131f},
-std::array<float,2>{0.71897614f, 0.16974467f},
-std::array<float,2>{0.0777294189f, 0.936765313f},
-std::array<float,2>{0.492068797f, 0.46823138f},
-std::array<float,2>{0.988338768f, 0.713297129f},
-std::array<float,2>{0.77925241f, 0.299899578f},
-std::array<float,2>{0.278731465f, 0.61663568f},
-std::array<float,2>{0.221508145f, 0.0167360753f},
-std::array<float,2>{0.511853576f, 0.770482063f},
-std::array<float,2>{0.7306844f, 0.378210604f},
-std::array<float,2>{0.0702538267f, 0.625879288f},
-std::array<float,2>{0.495811701f, 0.188847616f},
-std::array<float,2>{0.998015106f, 0.976911545f},
-std::array<float,2>{0.771785796f, 0.116396956f},
-std::array<float,2>{0.269052744f, 0.844723821f},
-std::array<float,2>{0.227928296f, 0.339301914f},
-std::array<float,2>{0.502166629f, 0.552250803f},
-std::array<float,2>{0.622861922f, 0.17371425f},
-std::array<float,2>{0.130724534f, 0.906805396f},
-std::array<float,2>{0.352369606f, 0.445180565f},
-std::array<float,2>{0.839289844f, 0.690006018f},
-std::array<float,2>{0.925903499f, 0.293119669f},
-std::array<float,2>{0.375336468f, 0.597302794f},
-std::array<float,2>{0.00806684885f, 0.00297434977f},
-std::array<float,2>{0.652863085f, 0.762171745f},
-std::array<float,2>{0.557246447f, 0.354050398f},
-std::array<float,2>{0.188597888f, 0.522215724f},
-std::array<float,2>{0.297793627f, 0.0923198536f},
-std::array<float,2>{0.79249078f, 0.837299287f},
-std::array<float,2>{0.955492496f, 0.235550866f},
-std::array<float,2>{0.466061592f, 0.96729517f},
-std::array<float,2>{0.119210973f, 0.434794694f},
-std::array<float,2>{0.697997093f, 0.66170752f},
-std::array<float,2>{0.670311511f, 0.0495677516f},
-std::array<float,2>{0.0572477654f, 0.80095464f},
-std::array<float,2>{0.406468898f, 0.264021963f},
-std::array<float,2>{0.904629707f, 0.579877973f},
-std::array<float,2>{0.870304346f, 0.477384746f},
-std::array<float,2>{0.321412712f, 0.734720826f},
-std::array<float,2>{0.171623036f, 0.138392597f},
-std::array<float,2>{0.588136733f, 0.895450413f},
-std::array<float,2>{0.62651068f, 0.276386708f},
-std::array<float,2>{0.0282580815f, 0.572759032f},
-std::array<float,2>{0.397586823f, 0.0394495428f},
-std::array<float,2>{0.9070099f, 0.786923528f},
-std::array<float,2>{0.828009427f, 0.152420208f},
-std::array<float,2>{0.362100005f, 0.88326776f},
-std::array<float,2>{0.141239554f, 0.490907848f},
-std::array<float,2>{0.595713854f, 0.733299375f},
-std::array<float,2>{0.519180596f, 0.0664110184f},
-std::array<float,2>{0.237555593f, 0.822420955f},
-std::array<float,2>{0.259723693f, 0.361008972f},
-std::array<float,2>{0.75883323f, 0.510822833f},
-std::array<float,2>{0.983552992f, 0.414373696f},
-std::array<float,2>{0.471059203f, 0.674293578f},
-std::array<float,2>{0.0800475106f, 0.220780373f},
-std::array<float,2>{0.739710748f, 0.942311645f},
-std::array<float,2>{0.571748555f, 0.461492687f},
-std::array<float,2>{0.175412595f, 0.714931607f},
-std::array<float,2>{0.340949833f, 0.165212914f},
-std::array<float,2>{0.852341771f, 0.930450141f},
-std::array<float,2>{0.876577377f, 0.0233671721f},
-std::array<float,2>{0.424406528f, 0.768600702f},
-std::array<float,2>{0.0398148634f, 0.301651299f},
-std::array<float,2>{0.681012928f, 0.612115681f},
-std::array<float,2>{0.718551219f, 0.212657109f},
-std::array<float,2>{0.10762313f, 0.99571389f},
-std::array<float,2>{0.445699573f, 0.399937481f},
-std::array<float,2>{0.949162424f, 0.640657008f},
-std::array<float,2>{0.802893937f, 0.315598011f},
-std::array<float,2>{0.284865469f, 0.544737756f},
-std::array<float,2>{0.20989193f, 0.101060607f},
-std::array<float,2>{0.534006894f, 0.863707006f},
-std::array<float,2>{0.674350142f, 0.492915839f},
-std::array<float,2>{0.0350435637f, 0.725460589f},
-std::array<float,2>{0.434000999f, 0.147686794f},
-std::array<float,2>{0.886955857f, 0.881093919f},
-std::array<float,2>{0.845395327f, 0.031812232f},
-std::array<float,2>{0.330434591f, 0.789966106f},
-std::array<float,2>{0.182184309f, 0.266869783f},
-std::array<float,2>{0.563910544f, 0.563058794f},
-std::array<float,2>{0.541316628f, 0.230763137f},
-std::array<float,2>{0.213928968f, 0.946330965f},
-std::array<float,2>{0.296569228f, 0.406707942f},
-std::array<float,2>{0.810488224f, 0.682087362f},
-std::array<float,2>{0.940905511f, 0.367507786f},
-std::array<float,2>{0.439430326f, 0.502114534f},
-std::array<float,2>{0.0955131724f, 0.0754990578f},
-std::array<float,2>{0.70808506f, 0.818875194f},
-std::array<float,2>{0.604989529f, 0.310951203f},
-std::array<float,2>{0.15059644f, 0.62287879f},
-std::array<float,2>{0.368280381f, 0.0298712309f},
-std::array<float,2>{0.813623786f, 0.778690636f},
-std::array<float,2>{0.917000473f, 0.156354681f},
-std::array<float,2>{0.405071408f, 0.924229085f},
-std::array<float,2>{0.0185747538f, 0.456802785f},
-std::array<float,2>{0.634379745f, 0.708416462f},
-std::array<float,2>{0.746079743f, 0.102920152f},
-std::array<float,2>{0.093387939f, 0.867950737f},
-std::array<float,2>{0.477038503f, 0.322225273f},
-std::array<float,2>{0.976408064f, 0.537939668f},
-std::array<float,2>{0.750706196f, 0.392945319f},
-std::array<float,2>{0.251571208f, 0.650453389f},
-std::array<float,2>{0.243088752f, 0.204893216f},
-std::array<float,2>{0.52582252f, 0.98886019f},
-std::array<float,2>{0.692675114f, 0.329152167f},
-std::array<float,2>{0.115668155f, 0.554955542f},
-std::array<float,2>{0.458259404f, 0.122677691f},
-std::array<float,2>{0.968488693f, 0.85190922f},
-std::array<float,2>{0.788138807f, 0.202679589f},
-std::array<float,2>{0.308772951f, 0.973891437f},
-std::array<float,2>{0.202064916f, 0.389411479f},
-std::array<float,2>{0.550352216f, 0.634679735f},
-std::array<float,2>{0.578280687f, 0.00913794618f},
-std::array<float,2>{0.156413555f, 0.755228519f},
-std::array<float,2>{0.319881648f, 0.284798801f},
-std::array<float,2>{0.861310005f, 0.608672738f},
-std::array<float,2>{0.893474162f, 0.451179385f},
-std::array<float,2>{0.421718985f, 0.695580542f},
-std::array<float,2>{0.0519440398f, 0.185910851f},
-std::array<float,2>{0.656312585f, 0.921116769f},
-std::array<float,2>{0.509420037f, 0.424529344f},
-std::array<float,2>{0.224082723f, 0.670381188f},
-std::array<float,2>{0.273496717f, 0.246644333f},
-std::array<float,2>{0.776570261f, 0.959086418f},
-std::array<float,2>{0.986579478f, 0.0828860551f},
-std::array<float,2>{0.484923214f, 0.832339585f},
-std::array<float,2>{0.0737892985f, 0.346977741f},
-std::array<float,2>{0.726215422f, 0.527552724f},
-std::array<float,2>{0.640870512f, 0.126028955f},
-std::array<float,2>{9.93966023e-05f, 0.901533246f},
-std::array<float,2>{0.389642298f, 0.473330051f},
-std::array<float,2>{0.934392512f, 0.746113539f},
-std::array<float,2>{0.834412396f, 0.25217402f},
-std::array<float,2>{0.347389847f, 0.589511275f},
-std::array<float,2>{0.138139248f, 0.0560462773f},
-std::array<float,2>{0.615624428f, 0.806433082f},
-std::array<float,2>{0.66467905f, 0.39512518f},
-std::array<float,2>{0.0594721735f, 0.653819561f},
-std::array<float,2>{0.413894862f, 0.207611308f},
-std::array<float,2>{0.901164055f, 0.984578848f},
-std::array<float,2>{0.873798728f, 0.108809464f},
-std::array<float,2>{0.327662498f, 0.872764587f},
-std::array<float,2>{0.166774407f, 0.3263641f},
-std::array<float,2>{0.591433942f, 0.533754766f},
-std::array<float,2>{0.558663249f, 0.16358754f},
-std::array<float,2>{0.191877887f, 0.926789999f},
-std::array<float,2>{0.303665459f, 0.458594739f},
-std::array<float,2>{0.7958076f, 0.705665171f},
-std::array<float,2>{0.960120797f, 0.308156908f},
-std::array<float,2>{0.464504272f, 0.618621111f},
-std::array<float,2>{0.124591127f, 0.0263331737f},
-std::array<float,2>{0.702091038f, 0.776089311f},
-std::array<float,2>{0.620715737f, 0.373115838f},
-std::array<float,2>{0.125375167f, 0.507242799f},
-std::array<float,2>{0.355532646f, 0.0720450804f},
-std::array<float,2>{0.840816021f, 0.816023707f},
-std::array<float,2>{0.925278962f, 0.227622673f},
-std::array<float,2>{0.382162213f, 0.95218128f},
-std::array<float,2>{0.0147676542f, 0.413548172f},
-std::array<float,2>{0.649864197f, 0.685308516f},
-std::array<float,2>{0.72951597f, 0.0375944488f},
-std::array<float,2>{0.0657057613f, 0.796491742f},
-std::array<float,2>{0.497802734f, 0.271923065f},
-std::array<float,2>{0.995166063f, 0.570209801f},
-std::array<float,2>{0.768194735f, 0.497765511f},
-std::array<float,2>{0.272903323f, 0.721349716f},
-std::array<float,2>{0.23084186f, 0.144248828f},
-std::array<float,2>{0.504823625f, 0.87674886f},
-std::array<float,2>{0.714250386f, 0.255063713f},
-std::array<float,2>{0.103172019f, 0.59041959f},
-std::array<float,2>{0.450368434f, 0.0614841431f},
-std::array<float,2>{0.950731397f, 0.809301972f},
-std::array<float,2>{0.800349951f, 0.132580668f},
-std::array<float,2>{0.286608249f, 0.903441548f},
-std::array<float,2>{0.204648331f, 0.471241832f},
-std::array<float,2>{0.53850019f, 0.742973983f},
-std::array<float,2>{0.576662183f, 0.0787460729f},
-std::array<float,2>{0.179574847f, 0.831435204f},
-std::array<float,2>{0.337510556f, 0.350193918f},
-std::array<float,2>{0.857440948f, 0.52666682f},
-std::array<float,2>{0.879651546f, 0.425978452f},
-std::array<float,2>{0.427682608f, 0.667428613f},
-std::array<float,2>{0.0445678048f, 0.244542971f},
-std::array<float,2>{0.685769975f, 0.956026375f},
-std::array<float,2>{0.523431063f, 0.448130459f},
-std::array<float,2>{0.238796622f, 0.699649811f},
-std::array<float,2>{0.262811005f, 0.180831924f},
-std::array<float,2>{0.763090849f, 0.917920589f},
-std::array<float,2>{0.976807952f, 0.0144426012f},
-std::array<float,2>{0.47361964f, 0.751125515f},
-std::array<float,2>{0.0842622742f, 0.287011385f},
-std::array<float,2>{0.734601796f, 0.60252291f},
-std::array<float,2>{0.63254416f, 0.19783172f},
-std::array<float,2>{0.0273402147f, 0.970395803f},
-std::array<float,2>{0.393943399f, 0.384883761f},
-std::array<float,2>{0.911000967f, 0.638218939f},
-std::array<float,2>{0.821892023f, 0.335024029f},
-std::array<float,2>{0.366577327f, 0.560969651f},
-std::array<float,2>{0.146720588f, 0.119623445f},
-std::array<float,2>{0.60022527f, 0.856837094f},
-std::array<float,2>{0.748834848f, 0.480864882f},
-std::array<float,2>{0.0892009363f, 0.739023924f},
-std::array<float,2>{0.482111305f, 0.13665849f},
-std::array<float,2>{0.969488382f, 0.894145906f},
-std::array<float,2>{0.754353464f, 0.0522216335f},
-std::array<float,2>{0.255696088f, 0.79713589f},
-std::array<float,2>{0.249999091f, 0.259919673f},
-std::array<float,2>{0.528598964f, 0.583959758f},
-std::array<float,2>{0.607604861f, 0.239668369f},
-std::array<float,2>{0.156071976f, 0.96348846f},
-std::array<float,2>{0.373719186f, 0.430090755f},
-std::array<float,2>{0.819142163f, 0.659297645f},
-std::array<float,2>{0.918862224f, 0.35603565f},
-std::array<float,2>{0.399961799f, 0.516627073f},
-std::array<float,2>{0.0217441097f, 0.0870855153f},
-std::array<float,2>{0.639725387f, 0.840485275f},
-std::array<float,2>{0.546776891f, 0.289265245f},
-std::array<float,2>{0.215903953f, 0.597890317f},
-std::array<float,2>{0.292216092f, 0.00533902831f},
-std::array<float,2>{0.80528909f, 0.760787427f},
-std::array<float,2>{0.944042921f, 0.178416625f},
-std::array<float,2>{0.443987936f, 0.913949251f},
-std::array<float,2>{0.100401461f, 0.440584064f},
-std::array<float,2>{0.703837037f, 0.692518473f},
-std::array<float,2>{0.678220868f, 0.10949216f},
-std::array<float,2>{0.0389541127f, 0.848178327f},
-std::array<float,2>{0.430477768f, 0.343665928f},
-std::array<float,2>{0.884054542f, 0.54853189f},
-std::array<float,2>{0.850015104f, 0.381884545f},
-std::array<float,2>{0.334736466f, 0.631726861f},
-std::array<float,2>{0.1861922f, 0.194726139f},
-std::array<float,2>{0.567911983f, 0.982426465f},
-std::array<float,2>{0.644665718f, 0.318983883f},
-std::array<float,2>{0.00587884523f, 0.542322874f},
-std::array<float,2>{0.382963926f, 0.0944690853f},
-std::array<float,2>{0.930418611f, 0.860125721f},
-std::array<float,2>{0.828436255f, 0.218186885f},
-std::array<float,2>{0.349699438f, 0.996602595f},
-std::array<float,2>{0.13302353f, 0.404535562f},
-std::array<float,2>{0.612231195f, 0.648332059f},
-std::array<float,2>{0.514884233f, 0.0192218013f},
-std::array<float,2>{0.220128119f, 0.773183048f},
-std::array<float,2>{0.280622035f, 0.297643304f},
-std::array<float,2>{0.779995561f, 0.614818871f},
-std::array<float,2>{0.990875483f, 0.466560394f},
-std::array<float,2>{0.489235312f, 0.712173045f},
-std::array<float,2>{0.075079143f, 0.171122983f},
-std::array<float,2>{0.720759451f, 0.934664309f},
-std::array<float,2>{0.582544088f, 0.41812855f},
-std::array<float,2>{0.161079675f, 0.677410543f},
-std::array<float,2>{0.314025015f, 0.225586027f},
-std::array<float,2>{0.867007792f, 0.940685391f},
-std::array<float,2>{0.895586431f, 0.065110594f},
-std::array<float,2>{0.416340679f, 0.824337542f},
-std::array<float,2>{0.0490628704f, 0.365742683f},
-std::array<float,2>{0.663259804f, 0.513483942f},
-std::array<float,2>{0.687976062f, 0.151464626f},
-std::array<float,2>{0.110257655f, 0.887564063f},
-std::array<float,2>{0.45385465f, 0.484968185f},
-std::array<float,2>{0.962597847f, 0.72687161f},
-std::array<float,2>{0.782690823f, 0.277645171f},
-std::array<float,2>{0.307220638f, 0.574505746f},
-std::array<float,2>{0.195341498f, 0.0448891595f},
-std::array<float,2>{0.553257465f, 0.782577634f},
-std::array<float,2>{0.695793986f, 0.437476218f},
-std::array<float,2>{0.118770503f, 0.663488269f},
-std::array<float,2>{0.468016177f, 0.236889169f},
-std::array<float,2>{0.95411557f, 0.965984523f},
-std::array<float,2>{0.790383458f, 0.0915563628f},
-std::array<float,2>{0.299992234f, 0.838384807f},
-std::array<float,2>{0.190594375f, 0.353361428f},
-std::array<float,2>{0.556238472f, 0.519950986f},
-std::array<float,2>{0.586937964f, 0.140311688f},
-std::array<float,2>{0.169432968f, 0.898275316f},
-std::array<float,2>{0.323154002f, 0.478642434f},
-std::array<float,2>{0.868980944f, 0.736588895f},
-std::array<float,2>{0.902682662f, 0.263590395f},
-std::array<float,2>{0.410130143f, 0.580413818f},
-std::array<float,2>{0.0549400523f, 0.0485622771f},
-std::array<float,2>{0.668760359f, 0.802748978f},
-std::array<float,2>{0.500337183f, 0.337671578f},
-std::array<float,2>{0.230234221f, 0.553554118f},
-std::array<float,2>{0.266434222f, 0.114581257f},
-std::array<float,2>{0.769561827f, 0.846361995f},
-std::array<float,2>{0.998306334f, 0.191010177f},
-std::array<float,2>{0.493002146f, 0.980000615f},
-std::array<float,2>{0.0666724294f, 0.376672924f},
-std::array<float,2>{0.733057141f, 0.628746092f},
-std::array<float,2>{0.65454495f, 0.00119222887f},
-std::array<float,2>{0.0106878662f, 0.764342368f},
-std::array<float,2>{0.378234416f, 0.295816183f},
-std::array<float,2>{0.929524183f, 0.595391095f},
-std::array<float,2>{0.836409569f, 0.44218868f},
-std::array<float,2>{0.354275763f, 0.689037979f},
-std::array<float,2>{0.131257385f, 0.17554228f},
-std::array<float,2>{0.624314606f, 0.909452558f},
-std::array<float,2>{0.683095753f, 0.303115249f},
-std::array<float,2>{0.0418532155f, 0.609549582f},
-std::array<float,2>{0.422098607f, 0.0208435543f},
-std::array<float,2>{0.878135324f, 0.766532779f},
-std::array<float,2>{0.854834139f, 0.167816952f},
-std::array<float,2>{0.341865689f, 0.933397889f},
-std::array<float,2>{0.172624245f, 0.464330316f},
-std::array<float,2>{0.572803855f, 0.71765995f},
-std::array<float,2>{0.531435311f, 0.0983327329f},
-std::array<float,2>{0.208512664f, 0.865860879f},
-std::array<float,2>{0.282259107f, 0.314278007f},
-std::array<float,2>{0.801220119f, 0.545567691f},
-std::array<float,2>{0.946119666f, 0.402218312f},
-std::array<float,2>{0.448552459f, 0.642742276f},
-std::array<float,2>{0.105803221f, 0.213419601f},
-std::array<float,2>{0.715249658f, 0.993522525f},
-std::array<float,2>{0.594003856f, 0.489699602f},
-std::array<float,2>{0.14353022f, 0.731854022f},
-std::array<float,2>{0.359424233f, 0.155204341f},
-std::array<float,2>{0.82437557f, 0.886196911f},
-std::array<float,2>{0.909845531f, 0.0425649807f},
-std::array<float,2>{0.395947784f, 0.78801018f},
-std::array<float,2>{0.0308664236f, 0.274429768f},
-std::array<float,2>{0.6283077f, 0.570977747f},
-std::array<float,2>{0.741180122f, 0.219829887f},
-std::array<float,2>{0.0803462937f, 0.945295334f},
-std::array<float,2>{0.4704642f, 0.41734606f},
-std::array<float,2>{0.981467605f, 0.672047436f},
-std::array<float,2>{0.761089742f, 0.361683488f},
-std::array<float,2>{0.260739207f, 0.509263813f},
-std::array<float,2>{0.236091748f, 0.0697574839f},
-std::array<float,2>{0.517424524f, 0.820326626f},
-std::array<float,2>{0.634807467f, 0.454664975f},
-std::array<float,2>{0.0163023435f, 0.710317492f},
-std::array<float,2>{0.402961582f, 0.160075605f},
-std::array<float,2>{0.91412878f, 0.923382163f},
-std::array<float,2>{0.814469278f, 0.0282840654f},
-std::array<float,2>{0.370965123f, 0.779766977f},
-std::array<float,2>{0.149569601f, 0.310001105f},
-std::array<float,2>{0.603105962f, 0.624761522f},
-std::array<float,2>{0.525342941f, 0.205579564f},
-std::array<float,2>{0.246081725f, 0.992150724f},
-std::array<float,2>{0.252023458f, 0.391560018f},
-std::array<float,2>{0.752620339f, 0.649589598f},
-std::array<float,2>{0.974200189f, 0.323494315f},
-std::array<float,2>{0.478609562f, 0.535301268f},
-std::array<float,2>{0.0912526026f, 0.104559392f},
-std::array<float,2>{0.743213415f, 0.870169163f},
-std::array<float,2>{0.564631581f, 0.269120127f},
-std::array<float,2>{0.179734856f, 0.564500391f},
-std::array<float,2>{0.32933414f, 0.0345261693f},
-std::array<float,2>{0.846373677f, 0.792555809f},
-std::array<float,2>{0.889400363f, 0.144917846f},
-std::array<float,2>{0.436177641f, 0.8800506f},
-std::array<float,2>{0.0319870338f, 0.49518767f},
-std::array<float,2>{0.673271954f, 0.724111438f},
-std::array<float,2>{0.709639907f, 0.0771418437f},
-std::array<float,2>{0.0968674496f, 0.81717205f},
-std::array<float,2>{0.441114992f, 0.370510131f},
-std::array<float,2>{0.937683642f, 0.501289964f},
-std::array<float,2>{0.811757088f, 0.40858981f},
-std::array<float,2>{0.294279873f, 0.680683732f},
-std::array<float,2>{0.211317554f, 0.233843893f},
-std::array<float,2>{0.539458632f, 0.948602557f},
-std::array<float,2>{0.724399269f, 0.345034778f},
-std::array<float,2>{0.0705028474f, 0.529430807f},
-std::array<float,2>{0.487441123f, 0.084178485f},
-std::array<float,2>{0.984484315f, 0.834103465f},
-std::array<float,2>{0.774136126f, 0.249927208f},
-std::array<float,2>{0.277071238f, 0.957271636f},
-std::array<float,2>{0.225414246f, 0.422999203f},
-std::array<float,2>{0.510196805f, 0.668180645f},
-std::array<float,2>{0.614304304f, 0.0573344268f},
-std::array<float,2>{0.139859542f, 0.806871295f},
-std::array<float,2>{0.344713032f, 0.250564605f},
-std::array<float,2>{0.832812607f, 0.58766675f},
-std::array<float,2>{0.935991645f, 0.475656837f},
-std::array<float,2>{0.387067318f, 0.748570621f},
-std::array<float,2>{0.00246419827f, 0.127592504f},
-std::array<float,2>{0.642897367f, 0.898498952f},
-std::array<float,2>{0.546965897f, 0.387149692f},
-std::array<float,2>{0.201000214f, 0.635499477f},
-std::array<float,2>{0.312418431f, 0.200938448f},
-std::array<float,2>{0.786785483f, 0.974786758f},
-std::array<float,2>{0.966005802f, 0.12456952f},
-std::array<float,2>{0.459980994f, 0.854414582f},
-std::array<float,2>{0.115126967f, 0.331137627f},
-std::array<float,2>{0.695291162f, 0.558131099f},
-std::array<float,2>{0.659441948f, 0.183601618f},
-std::array<float,2>{0.0540020056f, 0.9187271f},
-std::array<float,2>{0.418654799f, 0.44923538f},
-std::array<float,2>{0.891148865f, 0.697926462f},
-std::array<float,2>{0.862231314f, 0.282573849f},
-std::array<float,2>{0.317701668f, 0.605960131f},
-std::array<float,2>{0.158831522f, 0.00998382084f},
-std::array<float,2>{0.581218302f, 0.756957114f},
-std::array<float,2>{0.687054455f, 0.429251432f},
-std::array<float,2>{0.0434111729f, 0.665356755f},
-std::array<float,2>{0.426623076f, 0.243627638f},
-std::array<float,2>{0.880069554f, 0.95408988f},
-std::array<float,2>{0.858683944f, 0.0803016052f},
-std::array<float,2>{0.336477399f, 0.829084694f},
-std::array<float,2>{0.177960649f, 0.34864682f},
-std::array<float,2>{0.577164292f, 0.524047613f},
-std::array<float,2>{0.537603617f, 0.129530892f},
-std::array<float,2>{0.204054728f, 0.904628038f},
-std::array<float,2>{0.285393566f, 0.470528126f},
-std::array<float,2>{0.798837304f, 0.746069789f},
-std::array<float,2>{0.949653447f, 0.257652164f},
-std::array<float,2>{0.449818343f, 0.592684865f},
-std::array<float,2>{0.102380633f, 0.0600055344f},
-std::array<float,2>{0.713363588f, 0.811226606f},
-std::array<float,2>{0.601112247f, 0.332559139f},
-std::array<float,2>{0.147817329f, 0.560325205f},
-std::array<float,2>{0.365682691f, 0.117713094f},
-std::array<float,2>{0.821164668f, 0.858668327f},
-std::array<float,2>{0.911542296f, 0.195656762f},
-std::array<float,2>{0.392602265f, 0.970965266f},
-std::array<float,2>{0.0261659399f, 0.382837683f},
-std::array<float,2>{0.631522357f, 0.63988471f},
-std::array<float,2>{0.736177742f, 0.0134273674f},
-std::array<float,2>{0.0850042999f, 0.753384054f},
-std::array<float,2>{0.474417418f, 0.288522065f},
-std::array<float,2>{0.978411078f, 0.604960144f},
-std::array<float,2>{0.761987329f, 0.447246969f},
-std::array<float,2>{0.261755109f, 0.70205158f},
-std::array<float,2>{0.239404514f, 0.183416739f},
-std::array<float,2>{0.522440135f, 0.914349079f},
-std::array<float,2>{0.702265084f, 0.305219114f},
-std::array<float,2>{0.123454146f, 0.619549155f},
-std::array<float,2>{0.463347644f, 0.0250435527f},
-std::array<float,2>{0.959563971f, 0.774357915f},
-std::array<float,2>{0.7965644f, 0.160201266f},
-std::array<float,2>{0.303897649f, 0.928072512f},
-std::array<float,2>{0.192846149f, 0.4595716f},
-std::array<float,2>{0.559664309f, 0.704120457f},
-std::array<float,2>{0.590297461f, 0.105485477f},
-std::array<float,2>{0.167894945f, 0.87413317f},
-std::array<float,2>{0.326702088f, 0.324495584f},
-std::array<float,2>{0.874212027f, 0.53227967f},
-std::array<float,2>{0.90173322f, 0.397043556f},
-std::array<float,2>{0.412958026f, 0.656143963f},
-std::array<float,2>{0.060091801f, 0.209158063f},
-std::array<float,2>{0.66550827f, 0.988058925f},
-std::array<float,2>{0.505054116f, 0.498497337f},
-std::array<float,2>{0.232189983f, 0.719186604f},
-std::array<float,2>{0.271580428f, 0.140757352f},
-std::array<float,2>{0.769289315f, 0.877140522f},
-std::array<float,2>{0.994460642f, 0.03632278f},
-std::array<float,2>{0.496483266f, 0.793484092f},
-std::array<float,2>{0.0652098879f, 0.270160109f},
-std::array<float,2>{0.729466558f, 0.566784739f},
-std::array<float,2>{0.648499608f, 0.229652643f},
-std::array<float,2>{0.0144844977f, 0.949383497f},
-std::array<float,2>{0.381793678f, 0.410675943f},
-std::array<float,2>{0.924778044f, 0.686555624f},
-std::array<float,2>{0.841326356f, 0.372301459f},
-std::array<float,2>{0.357120484f, 0.504072309f},
-std::array<float,2>{0.126206607f, 0.0730086118f},
-std::array<float,2>{0.619542599f, 0.813221931f},
-std::array<float,2>{0.721896946f, 0.467324078f},
-std::array<float,2>{0.0756723508f, 0.714669347f},
-std::array<float,2>{0.490220517f, 0.168234676f},
-std::array<float,2>{0.991610944f, 0.935692072f},
-std::array<float,2>{0.78112179f, 0.016493421f},
-std::array<float,2>{0.279660106f, 0.770573974f},
-std::array<float,2>{0.219505638f, 0.299124092f},
-std::array<float,2>{0.513825297f, 0.615305781f},
-std::array<float,2>{0.612826884f, 0.215081215f},
-std::array<float,2>{0.134764463f, 0.999971092f},
-std::array<float,2>{0.350875139f, 0.402981609f},
-std::array<float,2>{0.829641759f, 0.645359993f},
-std::array<float,2>{0.930743217f, 0.31679976f},
-std::array<float,2>{0.384566724f, 0.539081395f},
-std::array<float,2>{0.00780541683f, 0.0969164297f},
-std::array<float,2>{0.646472812f, 0.86240083f},
-std::array<float,2>{0.5543468f, 0.279921323f},
-std::array<float,2>{0.197082028f, 0.577311933f},
-std::array<float,2>{0.308554113f, 0.0466596484f},
-std::array<float,2>{0.781893492f, 0.783276081f},
-std::array<float,2>{0.961754322f, 0.150157318f},
-std::array<float,2>{0.454868406f, 0.88997817f},
-std::array<float,2>{0.11036703f, 0.486352891f},
-std::array<float,2>{0.689047813f, 0.730033159f},
-std::array<float,2>{0.662496746f, 0.0636449978f},
-std::array<float,2>{0.0501965731f, 0.826569378f},
-std::array<float,2>{0.417549551f, 0.364197075f},
-std::array<float,2>{0.895179331f, 0.515450418f},
-std::array<float,2>{0.865660787f, 0.421593785f},
-std::array<float,2>{0.31269294f, 0.678376496f},
-std::array<float,2>{0.161659941f, 0.223307624f},
-std::array<float,2>{0.583808661f, 0.938003182f},
-std::array<float,2>{0.639493823f, 0.358963341f},
-std::array<float,2>{0.0233062189f, 0.518416464f},
-std::array<float,2>{0.399047941f, 0.0893115252f},
-std::array<float,2>{0.919587433f, 0.842989266f},
-std::array<float,2>{0.820046842f, 0.240983173f},
-std::array<float,2>{0.374249488f, 0.961238861f},
-std::array<float,2>{0.154529661f, 0.431774169f},
-std::array<float,2>{0.609333038f, 0.656982362f},
-std::array<float,2>{0.528076828f, 0.0529390201f},
-std::array<float,2>{0.248119757f, 0.799758136f},
-std::array<float,2>{0.254688829f, 0.258802235f},
-std::array<float,2>{0.754926324f, 0.584179819f},
-std::array<float,2>{0.969755471f, 0.483798057f},
-std::array<float,2>{0.48131448f, 0.742105842f},
-std::array<float,2>{0.0879657641f, 0.133194059f},
-std::array<float,2>{0.74984622f, 0.890969634f},
-std::array<float,2>{0.566503942f, 0.380500168f},
-std::array<float,2>{0.187036991f, 0.629717946f},
-std::array<float,2>{0.335314572f, 0.192178622f},
-std::array<float,2>{0.85117054f, 0.981639206f},
-std::array<float,2>{0.882997692f, 0.112936765f},
-std::array<float,2>{0.430721164f, 0.850798845f},
-std::array<float,2>{0.037417911f, 0.341550857f},
-std::array<float,2>{0.679052889f, 0.548848212f},
-std::array<float,2>{0.705069721f, 0.176273227f},
-std::array<float,2>{0.101405218f, 0.9103778f},
-std::array<float,2>{0.445197344f, 0.439016283f},
-std::array<float,2>{0.944813073f, 0.694386959f},
-std::array<float,2>{0.806458473f, 0.292838305f},
-std::array<float,2>{0.291832745f, 0.600489199f},
-std::array<float,2>{0.214878142f, 0.00679761078f},
-std::array<float,2>{0.545643091f, 0.759304702f},
-std::array<float,2>{0.716315627f, 0.399088234f},
-std::array<float,2>{0.10658779f, 0.642118752f},
-std::array<float,2>{0.447684437f, 0.211143225f},
-std::array<float,2>{0.946484327f, 0.994388282f},
-std::array<float,2>{0.802666247f, 0.0998621061f},
-std::array<float,2>{0.281740725f, 0.864656389f},
-std::array<float,2>{0.207220376f, 0.315144062f},
-std::array<float,2>{0.532230437f, 0.543238819f},
-std::array<float,2>{0.57373172f, 0.16474767f},
-std::array<float,2>{0.173437491f, 0.931482196f},
-std::array<float,2>{0.343614608f, 0.462346017f},
-std::array<float,2>{0.853519738f, 0.716518939f},
-std::array<float,2>{0.877609432f, 0.302335083f},
-std::array<float,2>{0.423312873f, 0.612321973f},
-std::array<float,2>{0.0424048193f, 0.0216641296f},
-std::array<float,2>{0.682499111f, 0.768201113f},
-std::array<float,2>{0.516003013f, 0.359412193f},
-std::array<float,2>{0.234787896f, 0.509975433f},
-std::array<float,2>{0.261455357f, 0.0675005689f},
-std::array<float,2>{0.759911656f, 0.823884964f},
-std::array<float,2>{0.980891705f, 0.222246766f},
-std::array<float,2>{0.469146788f, 0.942885339f},
-std::array<float,2>{0.0818001926f, 0.415150374f},
-std::array<float,2>{0.741290867f, 0.67510885f},
-std::array<float,2>{0.627084732f, 0.0409089923f},
-std::array<float,2>{0.0299149118f, 0.78532362f},
-std::array<float,2>{0.394550294f, 0.275838703f},
-std::array<float,2>{0.908443213f, 0.574064732f},
-std::array<float,2>{0.825229585f, 0.492106706f},
-std::array<float,2>{0.360599607f, 0.733645439f},
-std::array<float,2>{0.144309297f, 0.153421909f},
-std::array<float,2>{0.594845951f, 0.884120226f},
-std::array<float,2>{0.669224322f, 0.264679819f},
-std::array<float,2>{0.0558949932f, 0.578126788f},
-std::array<float,2>{0.40904507f, 0.0504893847f},
-std::array<float,2>{0.903798223f, 0.802116811f},
-std::array<float,2>{0.867781818f, 0.137003541f},
-std::array<float,2>{0.32373184f, 0.896390855f},
-std::array<float,2>{0.168310642f, 0.477972746f},
-std::array<float,2>{0.586042345f, 0.7355358f},
-std::array<float,2>{0.554885089f, 0.0929665715f},
-std::array<float,2>{0.189687654f, 0.836704791f},
-std::array<float,2>{0.299433827f, 0.355098039f},
-std::array<float,2>{0.789629996f, 0.522492528f},
-std::array<float,2>{0.953249216f, 0.434022993f},
-std::array<float,2>{0.467427552f, 0.66103828f},
-std::array<float,2>{0.117265835f, 0.235137016f},
-std::array<float,2>{0.697056174f, 0.968225181f},
-std::array<float,2>{0.623708725f, 0.443587095f},
-std::array<float,2>{0.132384434f, 0.690479755f},
-std::array<float,2>{0.354822129f, 0.171903253f},
-std::array<float,2>{0.837627053f, 0.907496095f},
-std::array<float,2>{0.928538799f, 0.00206941226f},
-std::array<float,2>{0.377023846f, 0.763565421f},
-std::array<float,2>{0.0114620542f, 0.294464976f},
-std::array<float,2>{0.655720055f, 0.596069396f},
-std::array<float,2>{0.733789861f, 0.187810957f},
-std::array<float,2>{0.0675513148f, 0.978308856f},
-std::array<float,2>{0.493169487f, 0.377076238f},
-std::array<float,2>{0.999481916f, 0.626768768f},
-std::array<float,2>{0.771012306f, 0.338816464f},
-std::array<float,2>{0.26661849f, 0.551094174f},
-std::array<float,2>{0.229358956f, 0.115641497f},
-std::array<float,2>{0.501263559f, 0.844826698f},
-std::array<float,2>{0.644512951f, 0.473706454f},
-std::array<float,2>{0.00335344067f, 0.747343004f},
-std::array<float,2>{0.388457626f, 0.125533491f},
-std::array<float,2>{0.936920285f, 0.901200593f},
-std::array<float,2>{0.833762944f, 0.0553602837f},
-std::array<float,2>{0.34491387f, 0.804885745f},
-std::array<float,2>{0.138813376f, 0.252967298f},
-std::array<float,2>{0.613535225f, 0.588046074f},
-std::array<float,2>{0.510989487f, 0.247711822f},
-std::array<float,2>{0.225590929f, 0.960053802f},
-std::array<float,2>{0.275934666f, 0.425088376f},
-std::array<float,2>{0.775323689f, 0.671377897f},
-std::array<float,2>{0.985664725f, 0.346630961f},
-std::array<float,2>{0.486781567f, 0.529093981f},
-std::array<float,2>{0.0717551708f, 0.0830160603f},
-std::array<float,2>{0.722797394f, 0.833163738f},
-std::array<float,2>{0.580349505f, 0.283750415f},
-std::array<float,2>{0.159289911f, 0.607979476f},
-std::array<float,2>{0.316933244f, 0.00824153516f},
-std::array<float,2>{0.863004923f, 0.754155993f},
-std::array<float,2>{0.891879201f, 0.186792046f},
-std::array<float,2>{0.419600397f, 0.920006454f},
-std::array<float,2>{0.0534207113f, 0.452488869f},
-std::array<float,2>{0.658699572f, 0.696600497f},
-std::array<float,2>{0.693475127f, 0.121926963f},
-std::array<float,2>{0.113988444f, 0.853514493f},
-std::array<float,2>{0.459049016f, 0.328584254f},
-std::array<float,2>{0.965313971f, 0.556161821f},
-std::array<float,2>{0.785693169f, 0.390236616f},
-std::array<float,2>{0.310749769f, 0.633025408f},
-std::array<float,2>{0.199747011f, 0.201732844f},
-std::array<float,2>{0.548656106f, 0.972670436f},
-std::array<float,2>{0.742654264f, 0.32106477f},
-std::array<float,2>{0.0903832167f, 0.538828492f},
-std::array<float,2>{0.480275899f, 0.101915441f},
-std::array<float,2>{0.972668707f, 0.869045317f},
-std::array<float,2>{0.753261268f, 0.203631967f},
-std::array<float,2>{0.253838658f, 0.990079105f},
-std::array<float,2>{0.245097488f, 0.393891096f},
-std::array<float,2>{0.524110258f, 0.651537895f},
-std::array<float,2>{0.601957977f, 0.0310887937f},
-std::array<float,2>{0.149402931f, 0.778122723f},
-std::array<float,2>{0.369364023f, 0.312287956f},
-std::array<float,2>{0.815550745f, 0.621159911f},
-std::array<float,2>{0.915981174f, 0.455633014f},
-std::array<float,2>{0.40404129f, 0.707647681f},
-std::array<float,2>{0.0166329481f, 0.157896608f},
-std::array<float,2>{0.635819256f, 0.925135732f},
-std::array<float,2>{0.540837228f, 0.407326192f},
-std::array<float,2>{0.212078184f, 0.683177829f},
-std::array<float,2>{0.293844163f, 0.231580198f},
-std::array<float,2>{0.811511815f, 0.945524752f},
-std::array<float,2>{0.939336538f, 0.0748566687f},
-std::array<float,2>{0.439615279f, 0.819713593f},
-std::array<float,2>{0.0959051698f, 0.368641108f},
-std::array<float,2>{0.709966063f, 0.503188431f},
-std::array<float,2>{0.672271132f, 0.147446245f},
-std::array<float,2>{0.0326504186f, 0.882304013f},
-std::array<float,2>{0.437111795f, 0.493519366f},
-std::array<float,2>{0.890379488f, 0.725961149f},
-std::array<float,2>{0.847532094f, 0.266206235f},
-std::array<float,2>{0.328872114f, 0.563686192f},
-std::array<float,2>{0.181451708f, 0.0327754132f},
-std::array<float,2>{0.565772533f, 0.791002274f},
-std::array<float,2>{0.629769325f, 0.385906756f},
-std::array<float,2>{0.0238051433f, 0.637352109f},
-std::array<float,2>{0.392157316f, 0.198906913f},
-std::array<float,2>{0.913212121f, 0.969686747f},
-std::array<float,2>{0.822979391f, 0.120372236f},
-std::array<float,2>{0.365069777f, 0.856304765f},
-std::array<float,2>{0.144672036f, 0.334036946f},
-std::array<float,2>{0.599486411f, 0.561689198f},
-std::array<float,2>{0.521276295f, 0.179758504f},
-std::array<float,2>{0.240327016f, 0.916987479f},
-std::array<float,2>{0.264651507f, 0.448268741f},
-std::array<float,2>{0.764527738f, 0.700213075f},
-std::array<float,2>{0.978588283f, 0.285278499f},
-std::array<float,2>{0.475559235f, 0.60336858f},
-std::array<float,2>{0.0828058571f, 0.0150854699f},
-std::array<float,2>{0.737160742f, 0.750843763f},
-std::array<float,2>{0.575799942f, 0.350606233f},
-std::array<float,2>{0.177733764f, 0.526044607f},
-std::array<float,2>{0.339636832f, 0.0799382478f},
-std::array<float,2>{0.855674446f, 0.830091298f},
-std::array<float,2>{0.881581485f, 0.245478287f},
-std::array<float,2>{0.429042339f, 0.956848681f},
-std::array<float,2>{0.046171274f, 0.427669495f},
-std::array<float,2>{0.684029281f, 0.666490197f},
-std::array<float,2>{0.712427557f, 0.0620201826f},
-std::array<float,2>{0.103771418f, 0.809722066f},
-std::array<float,2>{0.452567339f, 0.254596889f},
-std::array<float,2>{0.952322066f, 0.59148097f},
-std::array<float,2>{0.798584759f, 0.472268581f},
-std::array<float,2>{0.287707061f, 0.744027793f},
-std::array<float,2>{0.206486046f, 0.13128677f},
-std::array<float,2>{0.536310554f, 0.903187692f},
-std::array<float,2>{0.728038847f, 0.273238063f},
-std::array<float,2>{0.0628514662f, 0.568737566f},
-std::array<float,2>{0.499095827f, 0.0382600166f},
-std::array<float,2>{0.993241131f, 0.795423567f},
-std::array<float,2>{0.766666591f, 0.14318642f},
-std::array<float,2>{0.270941019f, 0.875016689f},
-std::array<float,2>{0.233260542f, 0.496427804f},
-std::array<float,2>{0.506851077f, 0.721848607f},
-std::array<float,2>{0.617314279f, 0.0705841184f},
-std::array<float,2>{0.128713176f, 0.81513685f},
-std::array<float,2>{0.358222753f, 0.374156564f},
-std::array<float,2>{0.843542695f, 0.506131291f},
-std::array<float,2>{0.922539353f, 0.412791848f},
-std::array<float,2>{0.380822599f, 0.684405684f},
-std::array<float,2>{0.0120477946f, 0.2267223f},
-std::array<float,2>{0.652319908f, 0.951280951f},
-std::array<float,2>{0.562015712f, 0.457817644f},
-std::array<float,2>{0.19477509f, 0.706491709f},
-std::array<float,2>{0.301875144f, 0.163079217f},
-std::array<float,2>{0.794438303f, 0.926739812f},
-std::array<float,2>{0.958055556f, 0.0272850096f},
-std::array<float,2>{0.461874753f, 0.777243376f},
-std::array<float,2>{0.121893637f, 0.306848139f},
-std::array<float,2>{0.700103164f, 0.618161738f},
-std::array<float,2>{0.667358279f, 0.208452582f},
-std::array<float,2>{0.0613910332f, 0.986106098f},
-std::array<float,2>{0.411664635f, 0.396013051f},
-std::array<float,2>{0.899454117f, 0.652852356f},
-std::array<float,2>{0.872821927f, 0.327619851f},
-std::array<float,2>{0.325759262f, 0.534885406f},
-std::array<float,2>{0.16485326f, 0.107601002f},
-std::array<float,2>{0.593486309f, 0.871860445f},
-std::array<float,2>{0.690825105f, 0.486240387f},
-std::array<float,2>{0.113225453f, 0.728441477f},
-std::array<float,2>{0.456493258f, 0.151241466f},
-std::array<float,2>{0.963018f, 0.888548315f},
-std::array<float,2>{0.784966707f, 0.0433024019f},
-std::array<float,2>{0.305744708f, 0.781564415f},
-std::array<float,2>{0.198192582f, 0.278640926f},
-std::array<float,2>{0.551319361f, 0.575421572f},
-std::array<float,2>{0.584187448f, 0.224650234f},
-std::array<float,2>{0.162788272f, 0.939795256f},
-std::array<float,2>{0.315886974f, 0.419499308f},
-std::array<float,2>{0.863949656f, 0.676029146f},
-std::array<float,2>{0.898324788f, 0.366285622f},
-std::array<float,2>{0.415407747f, 0.51260227f},
-std::array<float,2>{0.0476236716f, 0.0654427484f},
-std::array<float,2>{0.661939442f, 0.825654566f},
-std::array<float,2>{0.513120532f, 0.298618495f},
-std::array<float,2>{0.222160473f, 0.613312364f},
-std::array<float,2>{0.278303474f, 0.0183592383f},
-std::array<float,2>{0.777661502f, 0.772268355f},
-std::array<float,2>{0.989740252f, 0.170051232f},
-std::array<float,2>{0.490767181f, 0.933828771f},
-std::array<float,2>{0.0762846395f, 0.46569255f},
-std::array<float,2>{0.720188439f, 0.711593211f},
-std::array<float,2>{0.647274315f, 0.0953094065f},
-std::array<float,2>{0.0047137565f, 0.861268282f},
-std::array<float,2>{0.386240721f, 0.319667816f},
-std::array<float,2>{0.932713032f, 0.541077912f},
-std::array<float,2>{0.830229044f, 0.406208187f},
-std::array<float,2>{0.34812668f, 0.647221327f},
-std::array<float,2>{0.13531664f, 0.216877609f},
-std::array<float,2>{0.610021472f, 0.997633219f},
-std::array<float,2>{0.676265597f, 0.342499495f},
-std::array<float,2>{0.0361748151f, 0.547275901f},
-std::array<float,2>{0.432943463f, 0.11040847f},
-std::array<float,2>{0.885906875f, 0.849508226f},
-std::array<float,2>{0.848819852f, 0.193520635f},
-std::array<float,2>{0.333461702f, 0.9840312f},
-std::array<float,2>{0.18433924f, 0.381025642f},
-std::array<float,2>{0.569988191f, 0.632321417f},
-std::array<float,2>{0.543796659f, 0.00429527322f},
-std::array<float,2>{0.217928573f, 0.760711014f},
-std::array<float,2>{0.28990677f, 0.29010722f},
-std::array<float,2>{0.80806762f, 0.599372387f},
-std::array<float,2>{0.941896319f, 0.439577967f},
-std::array<float,2>{0.441621751f, 0.691558778f},
-std::array<float,2>{0.0992355123f, 0.178835869f},
-std::array<float,2>{0.706293344f, 0.913029134f},
-std::array<float,2>{0.606960952f, 0.430972129f},
-std::array<float,2>{0.153502092f, 0.65910852f},
-std::array<float,2>{0.371422023f, 0.23870714f},
-std::array<float,2>{0.8173365f, 0.964318871f},
-std::array<float,2>{0.920139372f, 0.0865929797f},
-std::array<float,2>{0.401800394f, 0.841637135f},
-std::array<float,2>{0.0203352366f, 0.356997639f},
-std::array<float,2>{0.63700211f, 0.516109645f},
-std::array<float,2>{0.747088313f, 0.13492088f},
-std::array<float,2>{0.0872872844f, 0.892877221f},
-std::array<float,2>{0.483967602f, 0.48195982f},
-std::array<float,2>{0.971609414f, 0.739835262f},
-std::array<float,2>{0.756200254f, 0.261558056f},
-std::array<float,2>{0.257700115f, 0.582757413f},
-std::array<float,2>{0.24740462f, 0.0510865413f},
-std::array<float,2>{0.530394793f, 0.798677266f},
-std::array<float,2>{0.739048123f, 0.416567326f},
-std::array<float,2>{0.0788137987f, 0.673346579f},
-std::array<float,2>{0.472041637f, 0.219721437f},
-std::array<float,2>{0.982701004f, 0.943389952f},
-std::array<float,2>{0.758674502f, 0.0686112642f},
-std::array<float,2>{0.258555114f, 0.821515203f},
-std::array<float,2>{0.236827657f, 0.362877756f},
-std::array<float,2>{0.517911911f, 0.508458316f},
-std::array<float,2>{0.597198904f, 0.155670896f},
-std::array<float,2>{0.142043039f, 0.885157585f},
-std::array<float,2>{0.363201439f, 0.488359958f},
-std::array<float,2>{0.826237082f, 0.730738401f},
-std::array<float,2>{0.908109903f, 0.273499697f},
-std::array<float,2>{0.396819621f, 0.572161853f},
-std::array<float,2>{0.029214602f, 0.041296877f},
-std::array<float,2>{0.625656188f, 0.788225412f},
-std::array<float,2>{0.534206212f, 0.312757313f},
-std::array<float,2>{0.210755646f, 0.546434879f},
-std::array<float,2>{0.283664614f, 0.0987891257f},
-std::array<float,2>{0.804118574f, 0.86708945f},
-std::array<float,2>{0.947476864f, 0.214442909f},
-std::array<float,2>{0.446337342f, 0.993142068f},
-std::array<float,2>{0.109118536f, 0.400503516f},
-std::array<float,2>{0.717367828f, 0.643716216f},
-std::array<float,2>{0.680402815f, 0.0198732149f},
-std::array<float,2>{0.0402574278f, 0.767526209f},
-std::array<float,2>{0.424841911f, 0.304584682f},
-std::array<float,2>{0.875741303f, 0.611015201f},
-std::array<float,2>{0.852986813f, 0.463786036f},
-std::array<float,2>{0.340301931f, 0.718596458f},
-std::array<float,2>{0.174066126f, 0.166515291f},
-std::array<float,2>{0.570581436f, 0.932114959f},
-std::array<float,2>{0.654133022f, 0.296206117f},
-std::array<float,2>{0.00888753776f, 0.594613552f},
-std::array<float,2>{0.376903266f, 8.08304394e-05f},
-std::array<float,2>{0.926808059f, 0.764834106f},
-std::array<float,2>{0.838162959f, 0.174512073f},
-std::array<float,2>{0.353099406f, 0.908799291f},
-std::array<float,2>{0.129546374f, 0.442762524f},
-std::array<float,2>{0.621451199f, 0.688384533f},
-std::array<float,2>{0.503521025f, 0.11348141f},
-std::array<float,2>{0.227083579f, 0.846842051f},
-std::array<float,2>{0.268127352f, 0.336500496f},
-std::array<float,2>{0.773007393f, 0.553892434f},
-std::array<float,2>{0.996117413f, 0.375326663f},
-std::array<float,2>{0.494644403f, 0.627616048f},
-std::array<float,2>{0.0692213997f, 0.190333471f},
-std::array<float,2>{0.73219192f, 0.979456782f},
-std::array<float,2>{0.589699268f, 0.479970306f},
-std::array<float,2>{0.170674503f, 0.737351835f},
-std::array<float,2>{0.321092039f, 0.139344797f},
-std::array<float,2>{0.869282126f, 0.896736681f},
-std::array<float,2>{0.905796349f, 0.0475203991f},
-std::array<float,2>{0.407425761f, 0.803806305f},
-std::array<float,2>{0.0584684908f, 0.262077689f},
-std::array<float,2>{0.67134583f, 0.581097722f},
-std::array<float,2>{0.698780119f, 0.237481043f},
-std::array<float,2>{0.120772824f, 0.965621769f},
-std::array<float,2>{0.465253562f, 0.436432213f},
-std::array<float,2>{0.956568599f, 0.662722886f},
-std::array<float,2>{0.791520715f, 0.352214426f},
-std::array<float,2>{0.298178434f, 0.521141231f},
-std::array<float,2>{0.187579691f, 0.0901641175f},
-std::array<float,2>{0.557937443f, 0.839401424f},
-std::array<float,2>{0.657732368f, 0.450411052f},
-std::array<float,2>{0.0509336926f, 0.698923886f},
-std::array<float,2>{0.420178682f, 0.184833243f},
-std::array<float,2>{0.894101977f, 0.919836521f},
-std::array<float,2>{0.859420717f, 0.0111723766f},
-std::array<float,2>{0.31844157f, 0.756166101f},
-std::array<float,2>{0.157370791f, 0.281874746f},
-std::array<float,2>{0.579332829f, 0.60654211f},
-std::array<float,2>{0.549765706f, 0.199863195f},
-std::array<float,2>{0.202157989f, 0.976101339f},
-std::array<float,2>{0.309756964f, 0.387766123f},
-std::array<float,2>{0.787612677f, 0.636203289f},
-std::array<float,2>{0.967455208f, 0.330321878f},
-std::array<float,2>{0.457157016f, 0.556835592f},
-std::array<float,2>{0.116245836f, 0.123105511f},
-std::array<float,2>{0.69180876f, 0.854847789f},
-std::array<float,2>{0.616681516f, 0.25128752f},
-std::array<float,2>{0.137078822f, 0.586097002f},
-std::array<float,2>{0.345935076f, 0.058253821f},
-std::array<float,2>{0.835654795f, 0.807632208f},
-std::array<float,2>{0.9352687f, 0.128143206f},
-std::array<float,2>{0.390164316f, 0.900095284f},
-std::array<float,2>{0.00148829259f, 0.474824995f},
-std::array<float,2>{0.642228484f, 0.749720752f},
-std::array<float,2>{0.72518003f, 0.0855164826f},
-std::array<float,2>{0.0722706094f, 0.835637152f},
-std::array<float,2>{0.486293823f, 0.344400197f},
-std::array<float,2>{0.988170624f, 0.530909121f},
-std::array<float,2>{0.776281714f, 0.42192471f},
-std::array<float,2>{0.275277168f, 0.669674039f},
-std::array<float,2>{0.223128587f, 0.248197928f},
-std::array<float,2>{0.50850153f, 0.958665669f},
-std::array<float,2>{0.70742923f, 0.369939506f},
-std::array<float,2>{0.0938780978f, 0.500807345f},
-std::array<float,2>{0.438197523f, 0.0780305043f},
-std::array<float,2>{0.939998925f, 0.817423999f},
-std::array<float,2>{0.808720469f, 0.232471719f},
-std::array<float,2>{0.295510769f, 0.947731733f},
-std::array<float,2>{0.212906525f, 0.409996867f},
-std::array<float,2>{0.542331636f, 0.680008352f},
-std::array<float,2>{0.562905371f, 0.033784546f},
-std::array<float,2>{0.183228642f, 0.79177326f},
-std::array<float,2>{0.331375182f, 0.268076241f},
-std::array<float,2>{0.844173133f, 0.565859497f},
-std::array<float,2>{0.887973487f, 0.495030791f},
-std::array<float,2>{0.434775025f, 0.723129869f},
-std::array<float,2>{0.0332885236f, 0.145869091f},
-std::array<float,2>{0.674829543f, 0.878914058f},
-std::array<float,2>{0.527263701f, 0.391887128f},
-std::array<float,2>{0.244116858f, 0.648508251f},
-std::array<float,2>{0.250110716f, 0.206634894f},
-std::array<float,2>{0.751678228f, 0.990754962f},
-std::array<float,2>{0.975013077f, 0.104033411f},
-std::array<float,2>{0.477813184f, 0.869982004f},
-std::array<float,2>{0.0919155255f, 0.322975606f},
-std::array<float,2>{0.744303823f, 0.536838531f},
-std::array<float,2>{0.633455515f, 0.158826038f},
-std::array<float,2>{0.0180611704f, 0.922286332f},
-std::array<float,2>{0.40575242f, 0.453381866f},
-std::array<float,2>{0.9161973f, 0.709207833f},
-std::array<float,2>{0.813328266f, 0.308786839f},
-std::array<float,2>{0.368020713f, 0.623503864f},
-std::array<float,2>{0.152149141f, 0.029285429f},
-std::array<float,2>{0.603567719f, 0.780381322f},
-std::array<float,2>{0.637326121f, 0.432593018f},
-std::array<float,2>{0.0198232681f, 0.656271219f},
-std::array<float,2>{0.402013391f, 0.240652502f},
-std::array<float,2>{0.920555174f, 0.961473048f},
-std::array<float,2>{0.816766024f, 0.0896810815f},
-std::array<float,2>{0.371746808f, 0.843401253f},
-std::array<float,2>{0.15418911f, 0.358711898f},
-std::array<float,2>{0.606462657f, 0.517741382f},
-std::array<float,2>{0.530985355f, 0.133545592f},
-std::array<float,2>{0.247792959f, 0.891530812f},
-std::array<float,2>{0.257060111f, 0.484263122f},
-std::array<float,2>{0.756489575f, 0.74130559f},
-std::array<float,2>{0.970974803f, 0.259760708f},
-std::array<float,2>{0.483792067f, 0.584803283f},
-std::array<float,2>{0.0874065384f, 0.0536368154f},
-std::array<float,2>{0.74800843f, 0.799068809f},
-std::array<float,2>{0.569345772f, 0.341028243f},
-std::array<float,2>{0.183746859f, 0.549451709f},
-std::array<float,2>{0.333868206f, 0.11245589f},
-std::array<float,2>{0.849169314f, 0.851525307f},
-std::array<float,2>{0.886408031f, 0.191831708f},
-std::array<float,2>{0.433388799f, 0.982193053f},
-std::array<float,2>{0.0369529501f, 0.379973918f},
-std::array<float,2>{0.676405787f, 0.629356205f},
-std::array<float,2>{0.706560254f, 0.00611164002f},
-std::array<float,2>{0.0989565328f, 0.758843243f},
-std::array<float,2>{0.442320019f, 0.292316943f},
-std::array<float,2>{0.941842735f, 0.599624634f},
-std::array<float,2>{0.80835402f, 0.438602328f},
-std::array<float,2>{0.28906557f, 0.694853723f},
-std::array<float,2>{0.218418464f, 0.176200986f},
-std::array<float,2>{0.543004572f, 0.911080837f},
-std::array<float,2>{0.720486462f, 0.29943186f},
-std::array<float,2>{0.0767409503f, 0.615876019f},
-std::array<float,2>{0.490453064f, 0.0158941764f},
-std::array<float,2>{0.989874423f, 0.771147609f},
-std::array<float,2>{0.778083444f, 0.168902785f},
-std::array<float,2>{0.277363628f, 0.936259925f},
-std::array<float,2>{0.222174585f, 0.466970772f},
-std::array<float,2>{0.513659239f, 0.714308739f},
-std::array<float,2>{0.609429121f, 0.0973405018f},
-std::array<float,2>{0.135102227f, 0.863158166f},
-std::array<float,2>{0.348397791f, 0.317270368f},
-std::array<float,2>{0.830849588f, 0.539619029f},
-std::array<float,2>{0.933110774f, 0.402618438f},
-std::array<float,2>{0.386109352f, 0.644549072f},
-std::array<float,2>{0.00394246867f, 0.215715185f},
-std::array<float,2>{0.646620452f, 0.999190986f},
-std::array<float,2>{0.551143527f, 0.487206608f},
-std::array<float,2>{0.197598428f, 0.729553401f},
-std::array<float,2>{0.306297064f, 0.149439692f},
-std::array<float,2>{0.784264863f, 0.89027977f},
-std::array<float,2>{0.963482261f, 0.0459015481f},
-std::array<float,2>{0.456720442f, 0.783770561f},
-std::array<float,2>{0.112482332f, 0.279456615f},
-std::array<float,2>{0.691075027f, 0.577909231f},
-std::array<float,2>{0.66139257f, 0.222912818f},
-std::array<float,2>{0.0469170846f, 0.937645495f},
-std::array<float,2>{0.415895104f, 0.421282351f},
-std::array<float,2>{0.897707701f, 0.677982748f},
-std::array<float,2>{0.863687456f, 0.363713592f},
-std::array<float,2>{0.316331685f, 0.514807463f},
-std::array<float,2>{0.162159562f, 0.0643952414f},
-std::array<float,2>{0.584691525f, 0.82678175f},
-std::array<float,2>{0.699399352f, 0.459194899f},
-std::array<float,2>{0.12113677f, 0.704852581f},
-std::array<float,2>{0.461365819f, 0.160724238f},
-std::array<float,2>{0.958622456f, 0.928309679f},
-std::array<float,2>{0.793994606f, 0.0248294938f},
-std::array<float,2>{0.302482009f, 0.773873389f},
-std::array<float,2>{0.195280552f, 0.305138439f},
-std::array<float,2>{0.56190598f, 0.619951308f},
-std::array<float,2>{0.593134522f, 0.209679574f},
-std::array<float,2>{0.164273307f, 0.987543344f},
-std::array<float,2>{0.325576216f, 0.396856546f},
-std::array<float,2>{0.872071028f, 0.655523956f},
-std::array<float,2>{0.900328219f, 0.324778616f},
-std::array<float,2>{0.411533475f, 0.533180475f},
-std::array<float,2>{0.060930647f, 0.106329143f},
-std::array<float,2>{0.667790294f, 0.874949455f},
-std::array<float,2>{0.507537007f, 0.26976943f},
-std::array<float,2>{0.232764184f, 0.567020357f},
-std::array<float,2>{0.271355718f, 0.0368966311f},
-std::array<float,2>{0.767124355f, 0.793162465f},
-std::array<float,2>{0.993708909f, 0.141455591f},
-std::array<float,2>{0.499958277f, 0.877786756f},
-std::array<float,2>{0.0632362589f, 0.498730123f},
-std::array<float,2>{0.727595329f, 0.719651937f},
-std::array<float,2>{0.651672304f, 0.0723783821f},
-std::array<float,2>{0.0123648867f, 0.812645793f},
-std::array<float,2>{0.3799631f, 0.372658432f},
-std::array<float,2>{0.922238529f, 0.504640102f},
-std::array<float,2>{0.842855752f, 0.410483927f},
-std::array<float,2>{0.357892513f, 0.687184811f},
-std::array<float,2>{0.128396153f, 0.230157167f},
-std::array<float,2>{0.617739141f, 0.950092793f},
-std::array<float,2>{0.684527934f, 0.349254519f},
-std::array<float,2>{0.0465877391f, 0.523602545f},
-std::array<float,2>{0.429313928f, 0.0809790418f},
-std::array<float,2>{0.881258368f, 0.828311801f},
-std::array<float,2>{0.856074989f, 0.243820205f},
-std::array<float,2>{0.339072466f, 0.953209579f},
-std::array<float,2>{0.176787615f, 0.429181844f},
-std::array<float,2>{0.575504601f, 0.665971994f},
-std::array<float,2>{0.536882877f, 0.0600859486f},
-std::array<float,2>{0.206732988f, 0.810611844f},
-std::array<float,2>{0.287183076f, 0.257289469f},
-std::array<float,2>{0.797860682f, 0.592117727f},
-std::array<float,2>{0.953097105f, 0.470175147f},
-std::array<float,2>{0.452925146f, 0.745211482f},
-std::array<float,2>{0.104041785f, 0.129056215f},
-std::array<float,2>{0.712086797f, 0.905007899f},
-std::array<float,2>{0.599092782f, 0.38354376f},
-std::array<float,2>{0.145404905f, 0.64022994f},
-std::array<float,2>{0.364487022f, 0.196090102f},
-std::array<float,2>{0.822731614f, 0.97143358f},
-std::array<float,2>{0.913578689f, 0.117639497f},
-std::array<float,2>{0.392088085f, 0.859374583f},
-std::array<float,2>{0.0242890846f, 0.332304984f},
-std::array<float,2>{0.629380584f, 0.559682012f},
-std::array<float,2>{0.736587822f, 0.182778582f},
-std::array<float,2>{0.0823525116f, 0.914795816f},
-std::array<float,2>{0.47464177f, 0.446643144f},
-std::array<float,2>{0.979061306f, 0.701257646f},
-std::array<float,2>{0.763798356f, 0.288948804f},
-std::array<float,2>{0.265516937f, 0.605240166f},
-std::array<float,2>{0.240969121f, 0.0131388623f},
-std::array<float,2>{0.520687342f, 0.75364697f},
-std::array<float,2>{0.744876325f, 0.394159079f},
-std::array<float,2>{0.0926635414f, 0.651984394f},
-std::array<float,2>{0.478343248f, 0.203241974f},
-std::array<float,2>{0.975546837f, 0.989658237f},
-std::array<float,2>{0.751352608f, 0.102445982f},
-std::array<float,2>{0.25097388f, 0.868198097f},
-std::array<float,2>{0.243483573f, 0.320571631f},
-std::array<float,2>{0.526486278f, 0.538229048f},
-std::array<float,2>{0.604204655f, 0.157568783f},
-std::array<float,2>{0.151549757f, 0.925602853f},
-std::array<float,2>{0.367364407f, 0.455438256f},
-std::array<float,2>{0.81271708f, 0.70707953f},
-std::array<float,2>{0.916752875f, 0.311881453f},
-std::array<float,2>{0.406087279f, 0.621834517f},
-std::array<float,2>{0.0184952524f, 0.0303150341f},
-std::array<float,2>{0.632938266f, 0.777567625f},
-std::array<float,2>{0.542655766f, 0.369051516f},
-std::array<float,2>{0.213778675f, 0.503825903f},
-std::array<float,2>{0.294955045f, 0.0744358078f},
-std::array<float,2>{0.809265375f, 0.820210338f},
-std::array<float,2>{0.939720631f, 0.232076749f},
-std::array<float,2>{0.437943876f, 0.946054161f},
-std::array<float,2>{0.0947131068f, 0.40805918f},
-std::array<float,2>{0.707649469f, 0.682803571f},
-std::array<float,2>{0.675366044f, 0.0323594511f},
-std::array<float,2>{0.0339907371f, 0.790232837f},
-std::array<float,2>{0.435281992f, 0.265649825f},
-std::array<float,2>{0.888547838f, 0.563987136f},
-std::array<float,2>{0.84425354f, 0.493984401f},
-std::array<float,2>{0.331594974f, 0.726306617f},
-std::array<float,2>{0.182964265f, 0.146971807f},
-std::array<float,2>{0.5634619f, 0.882692695f},
-std::array<float,2>{0.641899943f, 0.253845602f},
-std::array<float,2>{0.00131711655f, 0.588531315f},
-std::array<float,2>{0.390049011f, 0.0551603027f},
-std::array<float,2>{0.935018241f, 0.805539012f},
-std::array<float,2>{0.835074604f, 0.125372276f},
-std::array<float,2>{0.346541405f, 0.900620282f},
-std::array<float,2>{0.137673467f, 0.474532455f},
-std::array<float,2>{0.616878211f, 0.74758321f},
-std::array<float,2>{0.508141339f, 0.0836813673f},
-std::array<float,2>{0.223297834f, 0.833579659f},
-std::array<float,2>{0.274852276f, 0.3457582f},
-std::array<float,2>{0.775620639f, 0.528472066f},
-std::array<float,2>{0.987662911f, 0.425342292f},
-std::array<float,2>{0.485511929f, 0.671633184f},
-std::array<float,2>{0.0727810487f, 0.247325242f},
-std::array<float,2>{0.724714398f, 0.960449934f},
-std::array<float,2>{0.579719007f, 0.452924013f},
-std::array<float,2>{0.158072412f, 0.696786702f},
-std::array<float,2>{0.318988144f, 0.187063128f},
-std::array<float,2>{0.860073209f, 0.920713365f},
-std::array<float,2>{0.893950284f, 0.00841310155f},
-std::array<float,2>{0.420559436f, 0.754660428f},
-std::array<float,2>{0.0514907911f, 0.283459812f},
-std::array<float,2>{0.657390654f, 0.60782814f},
-std::array<float,2>{0.69207263f, 0.201405838f},
-std::array<float,2>{0.116786622f, 0.973468781f},
-std::array<float,2>{0.457827687f, 0.38997224f},
-std::array<float,2>{0.966932654f, 0.633715153f},
-std::array<float,2>{0.787460029f, 0.328925014f},
-std::array<float,2>{0.310290426f, 0.556055307f},
-std::array<float,2>{0.202774405f, 0.121498547f},
-std::array<float,2>{0.549036562f, 0.852789342f},
-std::array<float,2>{0.671398342f, 0.478345037f},
-std::array<float,2>{0.057962995f, 0.736206353f},
-std::array<float,2>{0.407739371f, 0.137279525f},
-std::array<float,2>{0.90575695f, 0.89559865f},
-std::array<float,2>{0.870070696f, 0.050216224f},
-std::array<float,2>{0.320604771f, 0.802248716f},
-std::array<float,2>{0.17014645f, 0.265334338f},
-std::array<float,2>{0.589299619f, 0.578719616f},
-std::array<float,2>{0.558215797f, 0.234833166f},
-std::array<float,2>{0.188043207f, 0.968663037f},
-std::array<float,2>{0.298502684f, 0.434555918f},
-std::array<float,2>{0.791153789f, 0.660175383f},
-std::array<float,2>{0.956501186f, 0.354828715f},
-std::array<float,2>{0.465728402f, 0.523076177f},
-std::array<float,2>{0.12046282f, 0.0937159657f},
-std::array<float,2>{0.698565602f, 0.83628726f},
-std::array<float,2>{0.621965706f, 0.293949336f},
-std::array<float,2>{0.129128918f, 0.596569955f},
-std::array<float,2>{0.352889746f, 0.00291670812f},
-std::array<float,2>{0.838864148f, 0.763072431f},
-std::array<float,2>{0.927362382f, 0.172529787f},
-std::array<float,2>{0.375988603f, 0.907831609f},
-std::array<float,2>{0.00940823555f, 0.443892419f},
-std::array<float,2>{0.653547645f, 0.691045642f},
-std::array<float,2>{0.731870055f, 0.116018578f},
-std::array<float,2>{0.068512857f, 0.845553339f},
-std::array<float,2>{0.494388133f, 0.338273585f},
-std::array<float,2>{0.996841609f, 0.551350594f},
-std::array<float,2>{0.77257508f, 0.377587706f},
-std::array<float,2>{0.267607898f, 0.626284838f},
-std::array<float,2>{0.226991192f, 0.18826212f},
-std::array<float,2>{0.503128171f, 0.977726877f},
-std::array<float,2>{0.716892958f, 0.314495087f},
-std::array<float,2>{0.108781382f, 0.543588936f},
-std::array<float,2>{0.447122455f, 0.100390762f},
-std::array<float,2>{0.947883666f, 0.865120053f},
-std::array<float,2>{0.804488957f, 0.211563498f},
-std::array<float,2>{0.283737063f, 0.99507308f},
-std::array<float,2>{0.210295111f, 0.398749352f},
-std::array<float,2>{0.53501749f, 0.641668618f},
-std::array<float,2>{0.571228623f, 0.0220887922f},
-std::array<float,2>{0.174687475f, 0.767928898f},
-std::array<float,2>{0.340456098f, 0.30223915f},
-std::array<float,2>{0.853343844f, 0.613023996f},
-std::array<float,2>{0.87500006f, 0.46253866f},
-std::array<float,2>{0.425538421f, 0.71601063f},
-std::array<float,2>{0.0406257771f, 0.164240927f},
-std::array<float,2>{0.679695547f, 0.931124568f},
-std::array<float,2>{0.518253744f, 0.41561693f},
-std::array<float,2>{0.236401483f, 0.675401151f},
-std::array<float,2>{0.257831067f, 0.221971139f},
-std::array<float,2>{0.757906377f, 0.942532837f},
-std::array<float,2>{0.98312974f, 0.0682462156f},
-std::array<float,2>{0.472604573f, 0.823676944f},
-std::array<float,2>{0.078506723f, 0.360349625f},
-std::array<float,2>{0.738623977f, 0.510350525f},
-std::array<float,2>{0.625368536f, 0.15415898f},
-std::array<float,2>{0.0285132937f, 0.884655774f},
-std::array<float,2>{0.397067279f, 0.491419584f},
-std::array<float,2>{0.907711029f, 0.734294176f},
-std::array<float,2>{0.82707727f, 0.276016414f},
-std::array<float,2>{0.362647414f, 0.573334634f},
-std::array<float,2>{0.142090634f, 0.0404875204f},
-std::array<float,2>{0.597047329f, 0.786051631f},
-std::array<float,2>{0.679279745f, 0.381531239f},
-std::array<float,2>{0.037896879f, 0.632802963f},
-std::array<float,2>{0.431512684f, 0.19424659f},
-std::array<float,2>{0.883712769f, 0.983828247f},
-std::array<float,2>{0.850923479f, 0.111244783f},
-std::array<float,2>{0.335476577f, 0.849021852f},
-std::array<float,2>{0.186892122f, 0.342172563f},
-std::array<float,2>{0.567285895f, 0.547772825f},
-std::array<float,2>{0.545205057f, 0.179536253f},
-std::array<float,2>{0.215817764f, 0.912423253f},
-std::array<float,2>{0.291078508f, 0.4400042f},
-std::array<float,2>{0.805906355f, 0.692380369f},
-std::array<float,2>{0.945149302f, 0.290855229f},
-std::array<float,2>{0.444483906f, 0.599061728f},
-std::array<float,2>{0.100669786f, 0.0048606731f},
-std::array<float,2>{0.704521596f, 0.759828389f},
-std::array<float,2>{0.608771205f, 0.356713235f},
-std::array<float,2>{0.154981032f, 0.516362548f},
-std::array<float,2>{0.374615073f, 0.086418964f},
-std::array<float,2>{0.819552422f, 0.840901911f},
-std::array<float,2>{0.919082522f, 0.23907356f},
-std::array<float,2>{0.398598462f, 0.964609683f},
-std::array<float,2>{0.0224833023f, 0.431543916f},
-std::array<float,2>{0.639065921f, 0.658534467f},
-std::array<float,2>{0.749228179f, 0.0515069477f},
-std::array<float,2>{0.0885475725f, 0.798323274f},
-std::array<float,2>{0.480789185f, 0.260937095f},
-std::array<float,2>{0.970592797f, 0.582081318f},
-std::array<float,2>{0.755403817f, 0.481918603f},
-std::array<float,2>{0.254338264f, 0.739581764f},
-std::array<float,2>{0.248722076f, 0.135729149f},
-std::array<float,2>{0.527629733f, 0.893509328f},
-std::array<float,2>{0.688542664f, 0.278945565f},
-std::array<float,2>{0.11109966f, 0.576081872f},
-std::array<float,2>{0.454197317f, 0.0439414121f},
-std::array<float,2>{0.961244345f, 0.782069564f},
-std::array<float,2>{0.781570971f, 0.150477305f},
-std::array<float,2>{0.307894051f, 0.887780964f},
-std::array<float,2>{0.196590886f, 0.485787123f},
-std::array<float,2>{0.553861141f, 0.727762878f},
-std::array<float,2>{0.583046913f, 0.0660936683f},
-std::array<float,2>{0.161549807f, 0.825702906f},
-std::array<float,2>{0.313031822f, 0.366782576f},
-std::array<float,2>{0.86581856f, 0.511840403f},
-std::array<float,2>{0.894877136f, 0.419228196f},
-std::array<float,2>{0.417090535f, 0.676361918f},
-std::array<float,2>{0.0506524183f, 0.225427732f},
-std::array<float,2>{0.662771404f, 0.940056145f},
-std::array<float,2>{0.514217138f, 0.464994699f},
-std::array<float,2>{0.218962699f, 0.711112857f},
-std::array<float,2>{0.279821247f, 0.170817897f},
-std::array<float,2>{0.780613124f, 0.93440038f},
-std::array<float,2>{0.991726816f, 0.0175896138f},
-std::array<float,2>{0.489640862f, 0.771959662f},
-std::array<float,2>{0.0761279762f, 0.29805398f},
-std::array<float,2>{0.722324073f, 0.613883018f},
-std::array<float,2>{0.645693839f, 0.21751906f},
-std::array<float,2>{0.007223967f, 0.997532606f},
-std::array<float,2>{0.383802474f, 0.405695826f},
-std::array<float,2>{0.931177437f, 0.646775484f},
-std::array<float,2>{0.829204321f, 0.320113033f},
-std::array<float,2>{0.351416975f, 0.541590452f},
-std::array<float,2>{0.134086788f, 0.094951205f},
-std::array<float,2>{0.612695098f, 0.860685349f},
-std::array<float,2>{0.728608072f, 0.496629953f},
-std::array<float,2>{0.0647994354f, 0.722518086f},
-std::array<float,2>{0.496816337f, 0.142813474f},
-std::array<float,2>{0.994974375f, 0.875832498f},
-std::array<float,2>{0.769006431f, 0.0387364626f},
-std::array<float,2>{0.272265583f, 0.79519856f},
-std::array<float,2>{0.231620058f, 0.272626996f},
-std::array<float,2>{0.5054968f, 0.568966091f},
-std::array<float,2>{0.620001733f, 0.227142334f},
-std::array<float,2>{0.126747847f, 0.951968908f},
-std::array<float,2>{0.356574506f, 0.412109852f},
-std::array<float,2>{0.840999603f, 0.683753371f},
-std::array<float,2>{0.924070716f, 0.374815822f},
-std::array<float,2>{0.381189674f, 0.50649637f},
-std::array<float,2>{0.013747273f, 0.0710221156f},
-std::array<float,2>{0.649152994f, 0.814645052f},
-std::array<float,2>{0.560295343f, 0.307616413f},
-std::array<float,2>{0.193134636f, 0.617574513f},
-std::array<float,2>{0.304663479f, 0.0267589521f},
-std::array<float,2>{0.796327949f, 0.776382267f},
-std::array<float,2>{0.959166706f, 0.162551448f},
-std::array<float,2>{0.463667452f, 0.92615217f},
-std::array<float,2>{0.123912036f, 0.457188457f},
-std::array<float,2>{0.702799618f, 0.706550896f},
-std::array<float,2>{0.665922821f, 0.108254857f},
-std::array<float,2>{0.05986882f, 0.871273756f},
-std::array<float,2>{0.412305713f, 0.32788986f},
-std::array<float,2>{0.902175725f, 0.534261942f},
-std::array<float,2>{0.874633193f, 0.395977855f},
-std::array<float,2>{0.326441675f, 0.652625799f},
-std::array<float,2>{0.167354345f, 0.208803192f},
-std::array<float,2>{0.590728939f, 0.985699356f},
-std::array<float,2>{0.630955935f, 0.334627002f},
-std::array<float,2>{0.0257166289f, 0.562012076f},
-std::array<float,2>{0.393503398f, 0.121065214f},
-std::array<float,2>{0.911855161f, 0.855897963f},
-std::array<float,2>{0.820654154f, 0.198263094f},
-std::array<float,2>{0.365726918f, 0.968868375f},
-std::array<float,2>{0.148160502f, 0.386550486f},
-std::array<float,2>{0.600634515f, 0.637126446f},
-std::array<float,2>{0.52178514f, 0.0153651452f},
-std::array<float,2>{0.23999913f, 0.750175059f},
-std::array<float,2>{0.26260078f, 0.285970271f},
-std::array<float,2>{0.762509108f, 0.602834463f},
-std::array<float,2>{0.977545023f, 0.449000865f},
-std::array<float,2>{0.473923266f, 0.701004505f},
-std::array<float,2>{0.0857050717f, 0.18064642f},
-std::array<float,2>{0.735606611f, 0.916085899f},
-std::array<float,2>{0.577650428f, 0.426777095f},
-std::array<float,2>{0.178703949f, 0.666913331f},
-std::array<float,2>{0.336015105f, 0.245762601f},
-std::array<float,2>{0.859113455f, 0.956104517f},
-std::array<float,2>{0.880784094f, 0.0795053318f},
-std::array<float,2>{0.426203281f, 0.830585122f},
-std::array<float,2>{0.0434713736f, 0.351491034f},
-std::array<float,2>{0.686877906f, 0.525701821f},
-std::array<float,2>{0.713562548f, 0.131493255f},
-std::array<float,2>{0.101965629f, 0.902638793f},
-std::array<float,2>{0.449652195f, 0.47174105f},
-std::array<float,2>{0.949750602f, 0.743436158f},
-std::array<float,2>{0.799477518f, 0.254265577f},
-std::array<float,2>{0.286008298f, 0.590996623f},
-std::array<float,2>{0.203177929f, 0.0616360866f},
-std::array<float,2>{0.537229657f, 0.810063422f},
-std::array<float,2>{0.710465133f, 0.409388989f},
-std::array<float,2>{0.0965912938f, 0.680232942f},
-std::array<float,2>{0.440207064f, 0.2330883f},
-std::array<float,2>{0.938601613f, 0.947906375f},
-std::array<float,2>{0.810664296f, 0.0774693042f},
-std::array<float,2>{0.293113977f, 0.818077862f},
-std::array<float,2>{0.212653697f, 0.369199157f},
-std::array<float,2>{0.540253758f, 0.50013417f},
-std::array<float,2>{0.56599015f, 0.146076441f},
-std::array<float,2>{0.180777937f, 0.879797757f},
-std::array<float,2>{0.328455985f, 0.494174868f},
-std::array<float,2>{0.847020984f, 0.723481953f},
-std::array<float,2>{0.889840007f, 0.267998457f},
-std::array<float,2>{0.436573029f, 0.566277683f},
-std::array<float,2>{0.0331508704f, 0.0336158983f},
-std::array<float,2>{0.672813654f, 0.791120946f},
-std::array<float,2>{0.523779333f, 0.322689474f},
-std::array<float,2>{0.244308144f, 0.536540866f},
-std::array<float,2>{0.252964497f, 0.10392727f},
-std::array<float,2>{0.75379616f, 0.869510472f},
-std::array<float,2>{0.973528564f, 0.206541315f},
-std::array<float,2>{0.479603022f, 0.990653694f},
-std::array<float,2>{0.0901189968f, 0.392563641f},
-std::array<float,2>{0.742951512f, 0.649140239f},
-std::array<float,2>{0.636583507f, 0.0286486112f},
-std::array<float,2>{0.0175180454f, 0.780849338f},
-std::array<float,2>{0.403415591f, 0.309554964f},
-std::array<float,2>{0.91506654f, 0.623535454f},
-std::array<float,2>{0.816299021f, 0.453959942f},
-std::array<float,2>{0.369845927f, 0.709846973f},
-std::array<float,2>{0.148655504f, 0.158344239f},
-std::array<float,2>{0.602239251f, 0.922510803f},
-std::array<float,2>{0.658426702f, 0.281383097f},
-std::array<float,2>{0.0529829897f, 0.607267797f},
-std::array<float,2>{0.419225812f, 0.0116176419f},
-std::array<float,2>{0.892308772f, 0.756373405f},
-std::array<float,2>{0.862480342f, 0.185391232f},
-std::array<float,2>{0.316849858f, 0.919154525f},
-std::array<float,2>{0.159967005f, 0.45074597f},
-std::array<float,2>{0.580672085f, 0.698565722f},
-std::array<float,2>{0.547971666f, 0.123766117f},
-std::array<float,2>{0.199578151f, 0.854987025f},
-std::array<float,2>{0.311279058f, 0.330722302f},
-std::array<float,2>{0.785505593f, 0.557555616f},
-std::array<float,2>{0.965706766f, 0.388592005f},
-std::array<float,2>{0.459519356f, 0.636271834f},
-std::array<float,2>{0.113387577f, 0.199599788f},
-std::array<float,2>{0.694272518f, 0.975773811f},
-std::array<float,2>{0.614005983f, 0.475225419f},
-std::array<float,2>{0.139173388f, 0.749391615f},
-std::array<float,2>{0.345328033f, 0.128802061f},
-std::array<float,2>{0.833441556f, 0.899703145f},
-std::array<float,2>{0.937331259f, 0.0580384657f},
-std::array<float,2>{0.387790352f, 0.808199048f},
-std::array<float,2>{0.00386499241f, 0.251794338f},
-std::array<float,2>{0.643598676f, 0.586579978f},
-std::array<float,2>{0.723572671f, 0.248682246f},
-std::array<float,2>{0.0721061155f, 0.958067417f},
-std::array<float,2>{0.487013787f, 0.422642022f},
-std::array<float,2>{0.98586607f, 0.669197083f},
-std::array<float,2>{0.774423182f, 0.34387973f},
-std::array<float,2>{0.275746584f, 0.530409098f},
-std::array<float,2>{0.226320937f, 0.0853628516f},
-std::array<float,2>{0.511424482f, 0.835332811f},
-std::array<float,2>{0.656070173f, 0.443141013f},
-std::array<float,2>{0.0110663585f, 0.687693894f},
-std::array<float,2>{0.377609253f, 0.174288377f},
-std::array<float,2>{0.927809f, 0.908618391f},
-std::array<float,2>{0.836961985f, 0.000975212315f},
-std::array<float,2>{0.355246902f, 0.765384257f},
-std::array<float,2>{0.132017553f, 0.296484143f},
-std::array<float,2>{0.623414457f, 0.594159067f},
-std::array<float,2>{0.501729429f, 0.189781278f},
-std::array<float,2>{0.228547081f, 0.978656948f},
-std::array<float,2>{0.267253846f, 0.37559095f},
-std::array<float,2>{0.77088654f, 0.627044797f},
-std::array<float,2>{0.99961096f, 0.336183727f},
-std::array<float,2>{0.493665367f, 0.55438745f},
-std::array<float,2>{0.0683498979f, 0.11409767f},
-std::array<float,2>{0.733998239f, 0.847299635f},
-std::array<float,2>{0.586740911f, 0.262465805f},
-std::array<float,2>{0.168683767f, 0.58160609f},
-std::array<float,2>{0.323688477f, 0.0470310375f},
-std::array<float,2>{0.867311239f, 0.804422796f},
-std::array<float,2>{0.904167056f, 0.138995931f},
-std::array<float,2>{0.408646554f, 0.897161543f},
-std::array<float,2>{0.0564071499f, 0.480366796f},
-std::array<float,2>{0.669680774f, 0.738253057f},
-std::array<float,2>{0.696309149f, 0.0905271098f},
-std::array<float,2>{0.117710777f, 0.838956177f},
-std::array<float,2>{0.466805428f, 0.351781696f},
-std::array<float,2>{0.954085648f, 0.520910084f},
-std::array<float,2>{0.789501786f, 0.435612321f},
-std::array<float,2>{0.299301624f, 0.662151456f},
-std::array<float,2>{0.190050662f, 0.237832293f},
-std::array<float,2>{0.555527031f, 0.965134084f},
-std::array<float,2>{0.741970658f, 0.362587363f},
-std::array<float,2>{0.081357792f, 0.5079844f},
-std::array<float,2>{0.469303131f, 0.0690375045f},
-std::array<float,2>{0.981256664f, 0.822204411f},
-std::array<float,2>{0.760475457f, 0.218851909f},
-std::array<float,2>{0.26086551f, 0.944033086f},
-std::array<float,2>{0.234937072f, 0.416074246f},
-std::array<float,2>{0.516395867f, 0.673298955f},
-std::array<float,2>{0.595537364f, 0.0419807434f},
-std::array<float,2>{0.143809125f, 0.788923562f},
-std::array<float,2>{0.361264676f, 0.274007022f},
-std::array<float,2>{0.825881243f, 0.571738362f},
-std::array<float,2>{0.909056246f, 0.489110768f},
-std::array<float,2>{0.395203531f, 0.731367588f},
-std::array<float,2>{0.0294310376f, 0.156119153f},
-std::array<float,2>{0.627443492f, 0.885610282f},
-std::array<float,2>{0.532755196f, 0.401273251f},
-std::array<float,2>{0.207958654f, 0.644189358f},
-std::array<float,2>{0.281391531f, 0.214056656f},
-std::array<float,2>{0.802177131f, 0.992586136f},
-std::array<float,2>{0.946816027f, 0.0991830602f},
-std::array<float,2>{0.447979718f, 0.866503596f},
-std::array<float,2>{0.106945455f, 0.313006192f},
-std::array<float,2>{0.71620369f, 0.546071053f},
-std::array<float,2>{0.682077706f, 0.166292801f},
-std::array<float,2>{0.0429035835f, 0.932320595f},
-std::array<float,2>{0.423536241f, 0.462976485f},
-std::array<float,2>{0.877418637f, 0.718146145f},
-std::array<float,2>{0.854068756f, 0.303813666f},
-std::array<float,2>{0.343044132f, 0.610479236f},
-std::array<float,2>{0.17332837f, 0.0200308692f},
-std::array<float,2>{0.573569298f, 0.767055511f},
-std::array<float,2>{0.663896143f, 0.420355082f},
-std::array<float,2>{0.0493420288f, 0.678777695f},
-std::array<float,2>{0.416765362f, 0.224082306f},
-std::array<float,2>{0.896477163f, 0.938518226f},
-std::array<float,2>{0.866651952f, 0.0627887696f},
-std::array<float,2>{0.313634694f, 0.827818274f},
-std::array<float,2>{0.160459995f, 0.364271104f},
-std::array<float,2>{0.58249861f, 0.514278889f},
-std::array<float,2>{0.552952409f, 0.149215192f},
-std::array<float,2>{0.196178839f, 0.888923943f},
-std::array<float,2>{0.307081759f, 0.488141209f},
-std::array<float,2>{0.783111215f, 0.72928226f},
-std::array<float,2>{0.962192237f, 0.280404717f},
-std::array<float,2>{0.453252405f, 0.576545775f},
-std::array<float,2>{0.109703086f, 0.0458674096f},
-std::array<float,2>{0.688364446f, 0.784464538f},
-std::array<float,2>{0.611680984f, 0.318125397f},
-std::array<float,2>{0.133545697f, 0.540132284f},
-std::array<float,2>{0.350579172f, 0.0965994373f},
-std::array<float,2>{0.828948557f, 0.861588836f},
-std::array<float,2>{0.929921925f, 0.215860337f},
-std::array<float,2>{0.383327007f, 0.998634458f},
-std::array<float,2>{0.00668369653f, 0.403507471f},
-std::array<float,2>{0.64504844f, 0.646388948f},
-std::array<float,2>{0.721359015f, 0.0173704531f},
-std::array<float,2>{0.07440418f, 0.769748867f},
-std::array<float,2>{0.488442034f, 0.300294787f},
-std::array<float,2>{0.990447164f, 0.616868079f},
-std::array<float,2>{0.77946502f, 0.468581051f},
-std::array<float,2>{0.281039059f, 0.713534713f},
-std::array<float,2>{0.220437601f, 0.169032037f},
-std::array<float,2>{0.515301347f, 0.937313497f},
-std::array<float,2>{0.703315437f, 0.291941643f},
-std::array<float,2>{0.099715136f, 0.60070771f},
-std::array<float,2>{0.443473935f, 0.00753635587f},
-std::array<float,2>{0.943533838f, 0.757885098f},
-std::array<float,2>{0.805136085f, 0.177669227f},
-std::array<float,2>{0.29249081f, 0.912020385f},
-std::array<float,2>{0.216778487f, 0.438314497f},
-std::array<float,2>{0.546232462f, 0.693367302f},
-std::array<float,2>{0.567811131f, 0.111697569f},
-std::array<float,2>{0.185796708f, 0.849929214f},
-std::array<float,2>{0.334033668f, 0.340526193f},
-std::array<float,2>{0.850286782f, 0.550553441f},
-std::array<float,2>{0.884631932f, 0.379687518f},
-std::array<float,2>{0.42969352f, 0.630031228f},
-std::array<float,2>{0.0381942876f, 0.192875713f},
-std::array<float,2>{0.678364754f, 0.980897963f},
-std::array<float,2>{0.529076517f, 0.482574075f},
-std::array<float,2>{0.24916622f, 0.741042614f},
-std::array<float,2>{0.255171925f, 0.134511903f},
-std::array<float,2>{0.754841447f, 0.892228723f},
-std::array<float,2>{0.96899718f, 0.054336749f},
-std::array<float,2>{0.481911719f, 0.800299585f},
-std::array<float,2>{0.0895918682f, 0.258403331f},
-std::array<float,2>{0.748237312f, 0.585793436f},
-std::array<float,2>{0.640193999f, 0.241306588f},
-std::array<float,2>{0.0223018099f, 0.962076426f},
-std::array<float,2>{0.399612814f, 0.432847768f},
-std::array<float,2>{0.918195546f, 0.657969475f},
-std::array<float,2>{0.818682671f, 0.357570142f},
-std::array<float,2>{0.373219192f, 0.51882726f},
-std::array<float,2>{0.155646071f, 0.0888665617f},
-std::array<float,2>{0.608240724f, 0.842445791f},
-std::array<float,2>{0.734923244f, 0.446136683f},
-std::array<float,2>{0.0847408623f, 0.702281773f},
-std::array<float,2>{0.473008633f, 0.182122901f},
-std::array<float,2>{0.977096736f, 0.915187061f},
-std::array<float,2>{0.763621509f, 0.0120156631f},
-std::array<float,2>{0.263263881f, 0.752787292f},
-std::array<float,2>{0.238345072f, 0.287577182f},
-std::array<float,2>{0.522718072f, 0.603802741f},
-std::array<float,2>{0.599769592f, 0.196932182f},
-std::array<float,2>{0.147342637f, 0.972491622f},
-std::array<float,2>{0.366785914f, 0.384437591f},
-std::array<float,2>{0.821641922f, 0.638840139f},
-std::array<float,2>{0.910271943f, 0.333275676f},
-std::array<float,2>{0.394289672f, 0.558879793f},
-std::array<float,2>{0.0268178172f, 0.118880168f},
-std::array<float,2>{0.632133007f, 0.85791111f},
-std::array<float,2>{0.539032876f, 0.256153703f},
-std::array<float,2>{0.204503775f, 0.592806518f},
-std::array<float,2>{0.286845803f, 0.0589063503f},
-std::array<float,2>{0.799888611f, 0.811764359f},
-std::array<float,2>{0.950366855f, 0.13014102f},
-std::array<float,2>{0.450986922f, 0.906199932f},
-std::array<float,2>{0.103002407f, 0.468992174f},
-std::array<float,2>{0.714826763f, 0.744861126f},
-std::array<float,2>{0.686067581f, 0.0810652897f},
-std::array<float,2>{0.0440359823f, 0.829714417f},
-std::array<float,2>{0.426969528f, 0.34845373f},
-std::array<float,2>{0.879154563f, 0.524680436f},
-std::array<float,2>{0.857963204f, 0.42784369f},
-std::array<float,2>{0.336916089f, 0.66465497f},
-std::array<float,2>{0.178895816f, 0.242422536f},
-std::array<float,2>{0.576516092f, 0.954998136f},
-std::array<float,2>{0.650052369f, 0.371678233f},
-std::array<float,2>{0.0155666033f, 0.505355477f},
-std::array<float,2>{0.382434517f, 0.0738181695f},
-std::array<float,2>{0.925557077f, 0.814450145f},
-std::array<float,2>{0.840219557f, 0.228793487f},
-std::array<float,2>{0.356395483f, 0.9508605f},
-std::array<float,2>{0.125926822f, 0.411257565f},
-std::array<float,2>{0.620276034f, 0.686348855f},
-std::array<float,2>{0.503959239f, 0.0355522297f},
-std::array<float,2>{0.231041446f, 0.794098437f},
-std::array<float,2>{0.273091435f, 0.27118814f},
-std::array<float,2>{0.76780194f, 0.567680657f},
-std::array<float,2>{0.996014237f, 0.499616712f},
-std::array<float,2>{0.497503817f, 0.72051388f},
-std::array<float,2>{0.0662420243f, 0.141677558f},
-std::array<float,2>{0.730120361f, 0.878006577f},
-std::array<float,2>{0.591087222f, 0.397842079f},
-std::array<float,2>{0.166443944f, 0.654967666f},
-std::array<float,2>{0.327493668f, 0.210398838f},
-std::array<float,2>{0.873271406f, 0.986980677f},
-std::array<float,2>{0.900417984f, 0.107084572f},
-std::array<float,2>{0.413523525f, 0.873996854f},
-std::array<float,2>{0.0586822145f, 0.325726122f},
-std::array<float,2>{0.664164126f, 0.531593263f},
-std::array<float,2>{0.701233208f, 0.161828369f},
-std::array<float,2>{0.124270253f, 0.928982317f},
-std::array<float,2>{0.464223564f, 0.460660219f},
-std::array<float,2>{0.960918427f, 0.703728735f},
-std::array<float,2>{0.795034349f, 0.306424618f},
-std::array<float,2>{0.302935719f, 0.620570183f},
-std::array<float,2>{0.192175224f, 0.0237915814f},
-std::array<float,2>{0.559261203f, 0.774761498f},
-std::array<float,2>{0.694806337f, 0.388683319f},
-std::array<float,2>{0.114464208f, 0.634142935f},
-std::array<float,2>{0.460852742f, 0.202614427f},
-std::array<float,2>{0.966709137f, 0.974436462f},
-std::array<float,2>{0.786421061f, 0.122389004f},
-std::array<float,2>{0.311926186f, 0.85211724f},
-std::array<float,2>{0.200275674f, 0.329809666f},
-std::array<float,2>{0.547604501f, 0.555330098f},
-std::array<float,2>{0.581571758f, 0.186341509f},
-std::array<float,2>{0.158246219f, 0.921392977f},
-std::array<float,2>{0.318165869f, 0.451736122f},
-std::array<float,2>{0.861619532f, 0.69625628f},
-std::array<float,2>{0.890906692f, 0.284552157f},
-std::array<float,2>{0.418388546f, 0.609321177f},
-std::array<float,2>{0.0544748716f, 0.00947880931f},
-std::array<float,2>{0.65999198f, 0.755578458f},
-std::array<float,2>{0.510370851f, 0.34757182f},
-std::array<float,2>{0.224984765f, 0.52827239f},
-std::array<float,2>{0.276409686f, 0.0821315497f},
-std::array<float,2>{0.773566902f, 0.832890034f},
-std::array<float,2>{0.984932363f, 0.246525303f},
-std::array<float,2>{0.488188058f, 0.959509909f},
-std::array<float,2>{0.070922181f, 0.424077004f},
-std::array<float,2>{0.72369647f, 0.670573413f},
-std::array<float,2>{0.643325627f, 0.0564078242f},
-std::array<float,2>{0.00195542793f, 0.80597192f},
-std::array<float,2>{0.387663245f, 0.252679318f},
-std::array<float,2>{0.936381936f, 0.589015126f},
-std::array<float,2>{0.832222998f, 0.472958744f},
-std::array<float,2>{0.344137162f, 0.74705857f},
-std::array<float,2>{0.14052622f, 0.126894876f},
-std::array<float,2>{0.614814878f, 0.902239442f},
-std::array<float,2>{0.673354328f, 0.26714921f},
-std::array<float,2>{0.0314428471f, 0.562979162f},
-std::array<float,2>{0.435721904f, 0.0314410962f},
-std::array<float,2>{0.8889606f, 0.789235771f},
-std::array<float,2>{0.845734596f, 0.14812386f},
-std::array<float,2>{0.329663008f, 0.881561041f},
-std::array<float,2>{0.180617765f, 0.492194206f},
-std::array<float,2>{0.565428138f, 0.72495985f},
-std::array<float,2>{0.539947033f, 0.0757670254f},
-std::array<float,2>{0.211900786f, 0.818370461f},
-std::array<float,2>{0.294520676f, 0.367677838f},
-std::array<float,2>{0.812042952f, 0.502596378f},
-std::array<float,2>{0.938042283f, 0.407019585f},
-std::array<float,2>{0.440664351f, 0.682408035f},
-std::array<float,2>{0.0974890515f, 0.231177509f},
-std::array<float,2>{0.709089935f, 0.947081923f},
-std::array<float,2>{0.602844059f, 0.456261426f},
-std::array<float,2>{0.149913192f, 0.708919287f},
-std::array<float,2>{0.370300144f, 0.157071382f},
-std::array<float,2>{0.815155506f, 0.924348176f},
-std::array<float,2>{0.914897799f, 0.0296835154f},
-std::array<float,2>{0.402680576f, 0.779077947f},
-std::array<float,2>{0.0158542991f, 0.311326712f},
-std::array<float,2>{0.635263622f, 0.622222185f},
-std::array<float,2>{0.743959129f, 0.204189971f},
-std::array<float,2>{0.0917431861f, 0.988424003f},
-std::array<float,2>{0.479357809f, 0.393441767f},
-std::array<float,2>{0.97401768f, 0.651365936f},
-std::array<float,2>{0.752396345f, 0.321503848f},
-std::array<float,2>{0.252512306f, 0.537546396f},
-std::array<float,2>{0.245282844f, 0.10308931f},
-std::array<float,2>{0.524808049f, 0.867230058f},
-std::array<float,2>{0.628425539f, 0.490526855f},
-std::array<float,2>{0.0303482208f, 0.732656002f},
-std::array<float,2>{0.396088094f, 0.15300183f},
-std::array<float,2>{0.909277976f, 0.88373214f},
-std::array<float,2>{0.825084686f, 0.0398973636f},
-std::array<float,2>{0.359944105f, 0.786399066f},
-std::array<float,2>{0.14293918f, 0.277126759f},
-std::array<float,2>{0.594582856f, 0.572552085f},
-std::array<float,2>{0.516694009f, 0.221210659f},
-std::array<float,2>{0.235741585f, 0.941444874f},
-std::array<float,2>{0.260105014f, 0.414949805f},
-std::array<float,2>{0.761637568f, 0.674627721f},
-std::array<float,2>{0.982084036f, 0.360462815f},
-std::array<float,2>{0.46981883f, 0.511581957f},
-std::array<float,2>{0.080586575f, 0.0669695511f},
-std::array<float,2>{0.740516782f, 0.822765589f},
-std::array<float,2>{0.572266638f, 0.301118314f},
-std::array<float,2>{0.172048226f, 0.611659467f},
-std::array<float,2>{0.342581123f, 0.0228937622f},
-std::array<float,2>{0.855056643f, 0.769412935f},
-std::array<float,2>{0.878534555f, 0.165916249f},
-std::array<float,2>{0.422825933f, 0.929731488f},
-std::array<float,2>{0.0414810516f, 0.461364716f},
-std::array<float,2>{0.68316561f, 0.71581322f},
-std::array<float,2>{0.715591133f, 0.101167612f},
-std::array<float,2>{0.106313474f, 0.864089549f},
-std::array<float,2>{0.448974669f, 0.31600818f},
-std::array<float,2>{0.945779324f, 0.543966115f},
-std::array<float,2>{0.801446319f, 0.399472237f},
-std::array<float,2>{0.283026248f, 0.641115487f},
-std::array<float,2>{0.208036929f, 0.212173909f},
-std::array<float,2>{0.532024801f, 0.995279312f},
-std::array<float,2>{0.73275286f, 0.339470357f},
-std::array<float,2>{0.0673740208f, 0.551795661f},
-std::array<float,2>{0.492500514f, 0.116803288f},
-std::array<float,2>{0.998618543f, 0.844129324f},
-std::array<float,2>{0.770466685f, 0.18934384f},
-std::array<float,2>{0.265836507f, 0.977385342f},
-std::array<float,2>{0.229660541f, 0.378781557f},
-std::array<float,2>{0.500606775f, 0.62539053f},
-std::array<float,2>{0.624901652f, 0.00384711567f},
-std::array<float,2>{0.131421059f, 0.762493968f},
-std::array<float,2>{0.35374704f, 0.293764234f},
-std::array<float,2>{0.83676815f, 0.596808136f},
-std::array<float,2>{0.929184496f, 0.444469094f},
-std::array<float,2>{0.378892541f, 0.689906716f},
-std::array<float,2>{0.0101432335f, 0.173149064f},
-std::array<float,2>{0.655260444f, 0.906665564f},
-std::array<float,2>{0.55574578f, 0.435251802f},
-std::array<float,2>{0.191304386f, 0.661206603f},
-std::array<float,2>{0.30071488f, 0.236283928f},
-std::array<float,2>{0.790939867f, 0.967168689f},
-std::array<float,2>{0.955017626f, 0.0922835991f},
-std::array<float,2>{0.46872133f, 0.837624967f},
-std::array<float,2>{0.118399277f, 0.353798538f},
-std::array<float,2>{0.695967853f, 0.521808565f},
-std::array<float,2>{0.668139458f, 0.138143778f},
-std::array<float,2>{0.0552432872f, 0.89479804f},
-std::array<float,2>{0.409208149f, 0.476739883f},
-std::array<float,2>{0.903218329f, 0.734880507f},
-std::array<float,2>{0.868221939f, 0.264212579f},
-std::array<float,2>{0.32245931f, 0.579175353f},
-std::array<float,2>{0.169746205f, 0.0490475856f},
-std::array<float,2>{0.58758688f, 0.801702201f},
-std::array<float,2>{0.647516727f, 0.404862374f},
-std::array<float,2>{0.00513052149f, 0.647469401f},
-std::array<float,2>{0.385493368f, 0.218359053f},
-std::array<float,2>{0.931793749f, 0.99656707f},
-std::array<float,2>{0.831104636f, 0.0938096121f},
-std::array<float,2>{0.348721445f, 0.859832168f},
-std::array<float,2>{0.135985374f, 0.31884405f},
-std::array<float,2>{0.611281276f, 0.542571068f},
-std::array<float,2>{0.512427568f, 0.171711206f},
-std::array<float,2>{0.221191153f, 0.935282469f},
-std::array<float,2>{0.279075056f, 0.46601209f},
-std::array<float,2>{0.778609872f, 0.712453544f},
-std::array<float,2>{0.98882395f, 0.297219902f},
-std::array<float,2>{0.491425157f, 0.614404857f},
-std::array<float,2>{0.0772665739f, 0.0186098088f},
-std::array<float,2>{0.719698608f, 0.772883117f},
-std::array<float,2>{0.585822582f, 0.365692765f},
-std::array<float,2>{0.163717523f, 0.512975812f},
-std::array<float,2>{0.315423578f, 0.0647157803f},
-std::array<float,2>{0.864363134f, 0.824739933f},
-std::array<float,2>{0.897013009f, 0.226472244f},
-std::array<float,2>{0.414740831f, 0.941290915f},
-std::array<float,2>{0.0480728559f, 0.418636799f},
-std::array<float,2>{0.661031365f, 0.676826894f},
-std::array<float,2>{0.690154433f, 0.0441619679f},
-std::array<float,2>{0.112088807f, 0.782970369f},
-std::array<float,2>{0.45514217f, 0.277910858f},
-std::array<float,2>{0.964035749f, 0.57504797f},
-std::array<float,2>{0.783729374f, 0.484380007f},
-std::array<float,2>{0.305361629f, 0.727275968f},
-std::array<float,2>{0.199088156f, 0.152211577f},
-std::array<float,2>{0.552661479f, 0.886874855f},
-std::array<float,2>{0.746292055f, 0.26035893f},
-std::array<float,2>{0.0866925195f, 0.583474398f},
-std::array<float,2>{0.482825816f, 0.0525349006f},
-std::array<float,2>{0.972337484f, 0.797844052f},
-std::array<float,2>{0.757542491f, 0.136150748f},
-std::array<float,2>{0.256090105f, 0.893978417f},
-std::array<float,2>{0.246698737f, 0.481264502f},
-std::array<float,2>{0.529508114f, 0.738408506f},
-std::array<float,2>{0.605999768f, 0.0878282934f},
-std::array<float,2>{0.153299853f, 0.840058863f},
-std::array<float,2>{0.372335821f, 0.355652034f},
-std::array<float,2>{0.817752123f, 0.51722616f},
-std::array<float,2>{0.920958221f, 0.430490792f},
-std::array<float,2>{0.400422752f, 0.659832954f},
-std::array<float,2>{0.0211767312f, 0.240025222f},
-std::array<float,2>{0.638418496f, 0.963378549f},
-std::array<float,2>{0.544173539f, 0.4412947f},
-std::array<float,2>{0.216994956f, 0.693028629f},
-std::array<float,2>{0.290767193f, 0.177796453f},
-std::array<float,2>{0.807331562f, 0.913278639f},
-std::array<float,2>{0.942993641f, 0.00575312227f},
-std::array<float,2>{0.44316873f, 0.761381626f},
-std::array<float,2>{0.0976607203f, 0.289940983f},
-std::array<float,2>{0.705476761f, 0.598535776f},
-std::array<float,2>{0.676989138f, 0.195268437f},
-std::array<float,2>{0.0353946351f, 0.983325183f},
-std::array<float,2>{0.431823134f, 0.382808149f},
-std::array<float,2>{0.884929061f, 0.630986869f},
-std::array<float,2>{0.8485744f, 0.342861384f},
-std::array<float,2>{0.332548022f, 0.54817009f},
-std::array<float,2>{0.18527551f, 0.110314444f},
-std::array<float,2>{0.568368375f, 0.848036349f},
-std::array<float,2>{0.711663306f, 0.470863789f},
-std::array<float,2>{0.104584575f, 0.742604613f},
-std::array<float,2>{0.451336831f, 0.1318672f},
-std::array<float,2>{0.95188278f, 0.904152513f},
-std::array<float,2>{0.797684431f, 0.0609725825f},
-std::array<float,2>{0.289006591f, 0.808875203f},
-std::array<float,2>{0.205259725f, 0.255615026f},
-std::array<float,2>{0.536009908f, 0.590144932f},
-std::array<float,2>{0.574589014f, 0.244807854f},
-std::array<float,2>{0.17584835f, 0.95536983f},
-std::array<float,2>{0.338247031f, 0.42633158f},
-std::array<float,2>{0.857279539f, 0.667749584f},
-std::array<float,2>{0.882009327f, 0.349857479f},
-std::array<float,2>{0.428568304f, 0.526964724f},
-std::array<float,2>{0.0455635302f, 0.0784417167f},
-std::array<float,2>{0.685421228f, 0.831819773f},
-std::array<float,2>{0.520078301f, 0.286320388f},
-std::array<float,2>{0.241686791f, 0.601865232f},
-std::array<float,2>{0.264089137f, 0.0137105556f},
-std::array<float,2>{0.764714241f, 0.751777291f},
-std::array<float,2>{0.979750872f, 0.181491956f},
-std::array<float,2>{0.475591213f, 0.917066693f},
-std::array<float,2>{0.0833757222f, 0.447381437f},
-std::array<float,2>{0.737354755f, 0.700036466f},
-std::array<float,2>{0.630518436f, 0.119926944f},
-std::array<float,2>{0.0250132903f, 0.857391417f},
-std::array<float,2>{0.390716612f, 0.335547715f},
-std::array<float,2>{0.912429154f, 0.561214328f},
-std::array<float,2>{0.823298514f, 0.385479122f},
-std::array<float,2>{0.36357215f, 0.638101041f},
-std::array<float,2>{0.145585492f, 0.197299987f},
-std::array<float,2>{0.598141313f, 0.969728649f},
-std::array<float,2>{0.666802049f, 0.326987386f},
-std::array<float,2>{0.0619345643f, 0.533618391f},
-std::array<float,2>{0.411011368f, 0.109207548f},
-std::array<float,2>{0.899281442f, 0.872271299f},
-std::array<float,2>{0.871842146f, 0.207329944f},
-std::array<float,2>{0.32511726f, 0.984933853f},
-std::array<float,2>{0.165058509f, 0.394743115f},
-std::array<float,2>{0.592008114f, 0.653395593f},
-std::array<float,2>{0.561480105f, 0.0257750303f},
-std::array<float,2>{0.193484619f, 0.775405467f},
-std::array<float,2>{0.300819516f, 0.307842255f},
-std::array<float,2>{0.79322499f, 0.618715763f},
-std::array<float,2>{0.957461238f, 0.458117664f},
-std::array<float,2>{0.462225467f, 0.705399811f},
-std::array<float,2>{0.122481175f, 0.163208708f},
-std::array<float,2>{0.700659692f, 0.927625f},
-std::array<float,2>{0.618496358f, 0.413614124f},
-std::array<float,2>{0.127508119f, 0.684947431f},
-std::array<float,2>{0.35853529f, 0.22813648f},
-std::array<float,2>{0.842355192f, 0.953075349f},
-std::array<float,2>{0.92357564f, 0.0713598058f},
-std::array<float,2>{0.379758269f, 0.815545499f},
-std::array<float,2>{0.0129182041f, 0.373582363f},
-std::array<float,2>{0.650562286f, 0.50766319f},
-std::array<float,2>{0.727173328f, 0.143956274f},
-std::array<float,2>{0.0641003102f, 0.87611866f},
-std::array<float,2>{0.498655945f, 0.497326076f},
-std::array<float,2>{0.992450476f, 0.720931947f},
-std::array<float,2>{0.766556919f, 0.272443891f},
-std::array<float,2>{0.269737929f, 0.569620013f},
-std::array<float,2>{0.233587399f, 0.0379273556f},
-std::array<float,2>{0.506729543f, 0.79632926f},
-std::array<float,2>{0.725909173f, 0.423345506f},
-std::array<float,2>{0.0735549107f, 0.668854117f},
-std::array<float,2>{0.484605074f, 0.249446154f},
-std::array<float,2>{0.986982465f, 0.957935274f},
-std::array<float,2>{0.777257979f, 0.0848260149f},
-std::array<float,2>{0.274051696f, 0.834894061f},
-std::array<float,2>{0.224298388f, 0.345655382f},
-std::array<float,2>{0.508804142f, 0.530071139f},
-std::array<float,2>{0.616044104f, 0.127239093f},
-std::array<float,2>{0.13856779f, 0.899229109f},
-std::array<float,2>{0.346922219f, 0.47653994f},
-std::array<float,2>{0.834696531f, 0.748072565f},
-std::array<float,2>{0.933945715f, 0.250371993f},
-std::array<float,2>{0.38903892f, 0.587160051f},
-std::array<float,2>{0.000878239167f, 0.0566493273f},
-std::array<float,2>{0.641569495f, 0.807598054f},
-std::array<float,2>{0.55010879f, 0.331640273f},
-std::array<float,2>{0.201381773f, 0.558011413f},
-std::array<float,2>{0.309271634f, 0.124410182f},
-std::array<float,2>{0.789008856f, 0.853702784f},
-std::array<float,2>{0.968025267f, 0.200284034f},
-std::array<float,2>{0.458539128f, 0.975317299f},
-std::array<float,2>{0.115918592f, 0.387390375f},
-std::array<float,2>{0.692886889f, 0.634922802f},
-std::array<float,2>{0.657032311f, 0.0102931894f},
-std::array<float,2>{0.0526951589f, 0.757675827f},
-std::array<float,2>{0.421132237f, 0.283106118f},
-std::array<float,2>{0.892580748f, 0.605697393f},
-std::array<float,2>{0.860700428f, 0.449857235f},
-std::array<float,2>{0.319433272f, 0.697324395f},
-std::array<float,2>{0.157043919f, 0.184138209f},
-std::array<float,2>{0.578794777f, 0.918450952f},
-std::array<float,2>{0.634140253f, 0.310128659f},
-std::array<float,2>{0.0192306265f, 0.624280035f},
-std::array<float,2>{0.40451926f, 0.0275417715f},
-std::array<float,2>{0.917833745f, 0.780241668f},
-std::array<float,2>{0.81396836f, 0.159667745f},
-std::array<float,2>{0.368899345f, 0.92307049f},
-std::array<float,2>{0.151021227f, 0.45421204f},
-std::array<float,2>{0.604498863f, 0.710705101f},
-std::array<float,2>{0.526039958f, 0.105241962f},
-std::array<float,2>{0.242485359f, 0.870663702f},
-std::array<float,2>{0.251223743f, 0.32387799f},
-std::array<float,2>{0.750166178f, 0.536063552f},
-std::array<float,2>{0.97561574f, 0.39100039f},
-std::array<float,2>{0.477297127f, 0.650087118f},
-std::array<float,2>{0.0928388163f, 0.205090821f},
-std::array<float,2>{0.745536625f, 0.991683245f},
-std::array<float,2>{0.564091861f, 0.495829761f},
-std::array<float,2>{0.181837544f, 0.724262953f},
-std::array<float,2>{0.330806077f, 0.145165399f},
-std::array<float,2>{0.844896138f, 0.880587578f},
-std::array<float,2>{0.887221456f, 0.0348395929f},
-std::array<float,2>{0.43430686f, 0.792073011f},
-std::array<float,2>{0.0344503373f, 0.26893273f},
-std::array<float,2>{0.674274981f, 0.565401256f},
-std::array<float,2>{0.708793581f, 0.233952567f},
-std::array<float,2>{0.0951934606f, 0.948913157f},
-std::array<float,2>{0.438716292f, 0.409098804f},
-std::array<float,2>{0.941113174f, 0.681420386f},
-std::array<float,2>{0.809730947f, 0.37067154f},
-std::array<float,2>{0.296045721f, 0.501684189f},
-std::array<float,2>{0.214726314f, 0.076390788f},
-std::array<float,2>{0.541567087f, 0.81669265f},
-std::array<float,2>{0.681410551f, 0.464651287f},
-std::array<float,2>{0.0394692943f, 0.717009723f},
-std::array<float,2>{0.424049288f, 0.167384282f},
-std::array<float,2>{0.876435697f, 0.932809174f},
-std::array<float,2>{0.851753891f, 0.0211263653f},
-std::array<float,2>{0.341349095f, 0.765703082f},
-std::array<float,2>{0.175177738f, 0.303278059f},
-std::array<float,2>{0.572231352f, 0.609882474f},
-std::array<float,2>{0.533363163f, 0.213089257f},
-std::array<float,2>{0.20922868f, 0.993701696f},
-std::array<float,2>{0.284267575f, 0.401830405f},
-std::array<float,2>{0.803253353f, 0.643144608f},
-std::array<float,2>{0.948410094f, 0.313634783f},
-std::array<float,2>{0.446132421f, 0.545161903f},
-std::array<float,2>{0.108390711f, 0.0977698267f},
-std::array<float,2>{0.718149424f, 0.865464091f},
-std::array<float,2>{0.596463978f, 0.275038928f},
-std::array<float,2>{0.141083792f, 0.570687592f},
-std::array<float,2>{0.361331284f, 0.0422662348f},
-std::array<float,2>{0.827237964f, 0.787350833f},
-std::array<float,2>{0.906610608f, 0.154569164f},
-std::array<float,2>{0.398347199f, 0.886675239f},
-std::array<float,2>{0.0278166998f, 0.489892632f},
-std::array<float,2>{0.62618947f, 0.73220557f},
-std::array<float,2>{0.740184128f, 0.070048511f},
-std::array<float,2>{0.0794918612f, 0.821219862f},
-std::array<float,2>{0.471564919f, 0.362273186f},
-std::array<float,2>{0.984216273f, 0.509590328f},
-std::array<float,2>{0.759344578f, 0.417576313f},
-std::array<float,2>{0.258874416f, 0.672431231f},
-std::array<float,2>{0.23818852f, 0.220422685f},
-std::array<float,2>{0.518636644f, 0.944697857f},
-std::array<float,2>{0.697567761f, 0.352862358f},
-std::array<float,2>{0.119862787f, 0.520460606f},
-std::array<float,2>{0.466699302f, 0.0911755487f},
-std::array<float,2>{0.95577836f, 0.838108778f},
-std::array<float,2>{0.792070568f, 0.236671895f},
-std::array<float,2>{0.297096223f, 0.966559231f},
-std::array<float,2>{0.189067468f, 0.436988324f},
-std::array<float,2>{0.556880951f, 0.663737416f},
-std::array<float,2>{0.588586211f, 0.0478638485f},
-std::array<float,2>{0.171171993f, 0.803228736f},
-std::array<float,2>{0.321967185f, 0.26316905f},
-std::array<float,2>{0.870889902f, 0.580955148f},
-std::array<float,2>{0.905123174f, 0.479469121f},
-std::array<float,2>{0.406984806f, 0.7370646f},
-std::array<float,2>{0.056765452f, 0.139905438f},
-std::array<float,2>{0.670782626f, 0.897488773f},
-std::array<float,2>{0.502806246f, 0.376447976f},
-std::array<float,2>{0.228199452f, 0.628275156f},
-std::array<float,2>{0.269015282f, 0.190734237f},
-std::array<float,2>{0.772118092f, 0.979813755f},
-std::array<float,2>{0.997454107f, 0.115045644f},
-std::array<float,2>{0.495502323f, 0.845947504f},
-std::array<float,2>{0.0694066808f, 0.337258548f},
-std::array<float,2>{0.731312096f, 0.552887738f},
-std::array<float,2>{0.652703464f, 0.175176159f},
-std::array<float,2>{0.0085707875f, 0.910053968f},
-std::array<float,2>{0.375717819f, 0.441577554f},
-std::array<float,2>{0.926611841f, 0.688782036f},
-std::array<float,2>{0.839654207f, 0.295025706f},
-std::array<float,2>{0.351738483f, 0.595005572f},
-std::array<float,2>{0.129996791f, 0.00186582736f},
-std::array<float,2>{0.622266591f, 0.763676703f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.362416178f, 0.351878971f},
-std::array<float,2>{0.887339234f, 0.920120597f},
-std::array<float,2>{0.633446157f, 0.185832292f},
-std::array<float,2>{0.226315439f, 0.652869046f},
-std::array<float,2>{0.0712834299f, 0.0562625714f},
-std::array<float,2>{0.571542859f, 0.501499355f},
-std::array<float,2>{0.765287042f, 0.48140195f},
-std::array<float,2>{0.481749713f, 0.819604695f},
-std::array<float,2>{0.40664202f, 0.239793554f},
-std::array<float,2>{0.841674268f, 0.727282405f},
-std::array<float,2>{0.537029624f, 0.256343424f},
-std::array<float,2>{0.0496861599f, 0.972904742f},
-std::array<float,2>{0.128343016f, 0.401757121f},
-std::array<float,2>{0.744681418f, 0.783533275f},
-std::array<float,2>{0.992103577f, 0.118324585f},
-std::array<float,2>{0.27967307f, 0.584568858f},
-std::array<float,2>{0.441087723f, 0.457547367f},
-std::array<float,2>{0.793115437f, 0.84620595f},
-std::array<float,2>{0.620063484f, 0.0150512466f},
-std::array<float,2>{0.122204594f, 0.558531761f},
-std::array<float,2>{0.206150174f, 0.125093132f},
-std::array<float,2>{0.67133224f, 0.668828726f},
-std::array<float,2>{0.936465383f, 0.343444258f},
-std::array<float,2>{0.317925066f, 0.896576643f},
-std::array<float,2>{0.299448043f, 0.0918685198f},
-std::array<float,2>{0.963831961f, 0.62004137f},
-std::array<float,2>{0.699939728f, 0.422108382f},
-std::array<float,2>{0.179774925f, 0.771504939f},
-std::array<float,2>{0.0183528531f, 0.284456462f},
-std::array<float,2>{0.522415936f, 0.938235343f},
-std::array<float,2>{0.870371938f, 0.197237134f},
-std::array<float,2>{0.38491118f, 0.706720114f},
-std::array<float,2>{0.403936327f, 0.27617237f},
-std::array<float,2>{0.850425005f, 0.99818784f},
-std::array<float,2>{0.512171984f, 0.230397105f},
-std::array<float,2>{0.0123894485f, 0.734717131f},
-std::array<float,2>{0.156605929f, 0.0956037864f},
-std::array<float,2>{0.714822769f, 0.576480329f},
-std::array<float,2>{0.948799133f, 0.384340167f},
-std::array<float,2>{0.281683564f, 0.803583384f},
-std::array<float,2>{0.338305891f, 0.163464978f},
-std::array<float,2>{0.914440811f, 0.627035856f},
-std::array<float,2>{0.679456651f, 0.36235258f},
-std::array<float,2>{0.197131053f, 0.927317917f},
-std::array<float,2>{0.097754389f, 0.492215097f},
-std::array<float,2>{0.596155822f, 0.835919678f},
-std::array<float,2>{0.805198193f, 0.0315432027f},
-std::array<float,2>{0.457003266f, 0.519120455f},
-std::array<float,2>{0.253420264f, 0.41794306f},
-std::array<float,2>{0.982608736f, 0.750695586f},
-std::array<float,2>{0.734303653f, 0.0644509941f},
-std::array<float,2>{0.142010182f, 0.5967803f},
-std::array<float,2>{0.0435116664f, 0.215775579f},
-std::array<float,2>{0.560070753f, 0.687777579f},
-std::array<float,2>{0.819555998f, 0.308766425f},
-std::array<float,2>{0.434249908f, 0.96688056f},
-std::array<float,2>{0.496648669f, 0.0295457486f},
-std::array<float,2>{0.771443903f, 0.537170351f},
-std::array<float,2>{0.588018835f, 0.443054527f},
-std::array<float,2>{0.0817377642f, 0.864824772f},
-std::array<float,2>{0.246702969f, 0.319089592f},
-std::array<float,2>{0.64971143f, 0.886292338f},
-std::array<float,2>{0.896958828f, 0.143675283f},
-std::array<float,2>{0.348315299f, 0.677847445f},
-std::array<float,2>{0.294043332f, 0.30169335f},
-std::array<float,2>{0.943693221f, 0.96084398f},
-std::array<float,2>{0.706755161f, 0.203611895f},
-std::array<float,2>{0.166801855f, 0.701648772f},
-std::array<float,2>{0.00492905965f, 0.0724089667f},
-std::array<float,2>{0.50440073f, 0.607475042f},
-std::array<float,2>{0.852792501f, 0.408149391f},
-std::array<float,2>{0.392710835f, 0.765500784f},
-std::array<float,2>{0.466387331f, 0.149217039f},
-std::array<float,2>{0.801598608f, 0.682358384f},
-std::array<float,2>{0.602550864f, 0.321136683f},
-std::array<float,2>{0.106659636f, 0.877696872f},
-std::array<float,2>{0.188196227f, 0.447163999f},
-std::array<float,2>{0.686312437f, 0.871132016f},
-std::array<float,2>{0.907756329f, 0.0230557509f},
-std::array<float,2>{0.330142885f, 0.544178307f},
-std::array<float,2>{0.428321093f, 0.377626657f},
-std::array<float,2>{0.824666321f, 0.807231843f},
-std::array<float,2>{0.550810277f, 0.107817568f},
-std::array<float,2>{0.0357800275f, 0.566150486f},
-std::array<float,2>{0.156041905f, 0.220076799f},
-std::array<float,2>{0.7261343f, 0.746292889f},
-std::array<float,2>{0.971260428f, 0.266655505f},
-std::array<float,2>{0.259645194f, 0.986393392f},
-std::array<float,2>{0.357826561f, 0.044205945f},
-std::array<float,2>{0.903393686f, 0.523778975f},
-std::array<float,2>{0.647359729f, 0.484659076f},
-std::array<float,2>{0.239024326f, 0.839204192f},
-std::array<float,2>{0.0900378376f, 0.367401004f},
-std::array<float,2>{0.582685113f, 0.93505013f},
-std::array<float,2>{0.779742718f, 0.164399043f},
-std::array<float,2>{0.489101976f, 0.634376943f},
-std::array<float,2>{0.470869482f, 0.332716197f},
-std::array<float,2>{0.755309701f, 0.902997792f},
-std::array<float,2>{0.562787712f, 0.136286288f},
-std::array<float,2>{0.0653346255f, 0.660603464f},
-std::array<float,2>{0.227937892f, 0.00461132266f},
-std::array<float,2>{0.626410604f, 0.550445199f},
-std::array<float,2>{0.880900502f, 0.463640928f},
-std::array<float,2>{0.373768091f, 0.852022886f},
-std::array<float,2>{0.272993535f, 0.191898093f},
-std::array<float,2>{0.99353081f, 0.718603075f},
-std::array<float,2>{0.741886795f, 0.296368361f},
-std::array<float,2>{0.135889232f, 0.950540662f},
-std::array<float,2>{0.057346642f, 0.430005461f},
-std::array<float,2>{0.546101868f, 0.777457297f},
-std::array<float,2>{0.834841788f, 0.0837405398f},
-std::array<float,2>{0.414421916f, 0.609675944f},
-std::array<float,2>{0.32345593f, 0.473152697f},
-std::array<float,2>{0.92763859f, 0.827431083f},
-std::array<float,2>{0.658863485f, 0.0510701947f},
-std::array<float,2>{0.216831222f, 0.509421051f},
-std::array<float,2>{0.110290825f, 0.179228783f},
-std::array<float,2>{0.614260912f, 0.641207337f},
-std::array<float,2>{0.782794952f, 0.346690595f},
-std::array<float,2>{0.445501328f, 0.911989033f},
-std::array<float,2>{0.377592653f, 0.114488117f},
-std::array<float,2>{0.865748525f, 0.591228008f},
-std::array<float,2>{0.523634374f, 0.395855278f},
-std::array<float,2>{0.0257484578f, 0.793765366f},
-std::array<float,2>{0.173972517f, 0.259963632f},
-std::array<float,2>{0.694803715f, 0.979291856f},
-std::array<float,2>{0.95382309f, 0.244758666f},
-std::array<float,2>{0.310738653f, 0.720959902f},
-std::array<float,2>{0.276738793f, 0.326105863f},
-std::array<float,2>{0.98679477f, 0.880060613f},
-std::array<float,2>{0.746939123f, 0.155331731f},
-std::array<float,2>{0.131568864f, 0.683615208f},
-std::array<float,2>{0.0528123491f, 0.0163219236f},
-std::array<float,2>{0.533379972f, 0.542810977f},
-std::array<float,2>{0.83811295f, 0.452898711f},
-std::array<float,2>{0.412442297f, 0.870577931f},
-std::array<float,2>{0.47673443f, 0.210748568f},
-std::array<float,2>{0.759256601f, 0.695509732f},
-std::array<float,2>{0.577799261f, 0.29997915f},
-std::array<float,2>{0.076676771f, 0.954587042f},
-std::array<float,2>{0.21977286f, 0.413353831f},
-std::array<float,2>{0.637876034f, 0.759335339f},
-std::array<float,2>{0.886567235f, 0.0743329599f},
-std::array<float,2>{0.366529495f, 0.604521096f},
-std::array<float,2>{0.388706356f, 0.489679486f},
-std::array<float,2>{0.871788144f, 0.840402544f},
-std::array<float,2>{0.516556442f, 0.0413621068f},
-std::array<float,2>{0.0227253474f, 0.528841257f},
-std::array<float,2>{0.184957653f, 0.17185697f},
-std::array<float,2>{0.695395648f, 0.636987388f},
-std::array<float,2>{0.966648936f, 0.374638736f},
-std::array<float,2>{0.304148465f, 0.931633949f},
-std::array<float,2>{0.315499187f, 0.104280896f},
-std::array<float,2>{0.930577755f, 0.567774475f},
-std::array<float,2>{0.667685688f, 0.378946096f},
-std::array<float,2>{0.21051304f, 0.81046319f},
-std::array<float,2>{0.119475521f, 0.272704005f},
-std::array<float,2>{0.624897957f, 0.990602732f},
-std::array<float,2>{0.789352894f, 0.225051537f},
-std::array<float,2>{0.445218563f, 0.744590223f},
-std::array<float,2>{0.45812279f, 0.290753216f},
-std::array<float,2>{0.810592473f, 0.94902277f},
-std::array<float,2>{0.598061681f, 0.190897807f},
-std::array<float,2>{0.09567523f, 0.71101439f},
-std::array<float,2>{0.200335056f, 0.0799840465f},
-std::array<float,2>{0.675053358f, 0.614150643f},
-std::array<float,2>{0.921712279f, 0.436450332f},
-std::array<float,2>{0.342253596f, 0.777054131f},
-std::array<float,2>{0.288524836f, 0.138393864f},
-std::array<float,2>{0.950905442f, 0.659904182f},
-std::array<float,2>{0.716148376f, 0.330817789f},
-std::array<float,2>{0.161362469f, 0.898567736f},
-std::array<float,2>{0.00886518694f, 0.467760682f},
-std::array<float,2>{0.508114398f, 0.856617033f},
-std::array<float,2>{0.844859421f, 0.000734981382f},
-std::array<float,2>{0.400954396f, 0.553024292f},
-std::array<float,2>{0.344208002f, 0.393645287f},
-std::array<float,2>{0.892556489f, 0.790200651f},
-std::array<float,2>{0.655571461f, 0.111104749f},
-std::array<float,2>{0.243404776f, 0.587215006f},
-std::array<float,2>{0.085131675f, 0.249891266f},
-std::array<float,2>{0.591089487f, 0.725495517f},
-std::array<float,2>{0.76703769f, 0.265076518f},
-std::array<float,2>{0.49487558f, 0.982096553f},
-std::array<float,2>{0.430796117f, 0.0479219519f},
-std::array<float,2>{0.813176811f, 0.514201581f},
-std::array<float,2>{0.555185795f, 0.471319228f},
-std::array<float,2>{0.0390760973f, 0.822588682f},
-std::array<float,2>{0.144600704f, 0.348218679f},
-std::array<float,2>{0.729133606f, 0.907133937f},
-std::array<float,2>{0.97996527f, 0.17478472f},
-std::array<float,2>{0.255901068f, 0.647924304f},
-std::array<float,2>{0.332317203f, 0.251231939f},
-std::array<float,2>{0.912286401f, 0.972297132f},
-std::array<float,2>{0.680013359f, 0.235210106f},
-std::array<float,2>{0.1945308f, 0.733838201f},
-std::array<float,2>{0.104223937f, 0.123174489f},
-std::array<float,2>{0.605689883f, 0.581724823f},
-std::array<float,2>{0.800158262f, 0.406179994f},
-std::array<float,2>{0.461805552f, 0.787351251f},
-std::array<float,2>{0.39572525f, 0.182820171f},
-std::array<float,2>{0.856179416f, 0.651178002f},
-std::array<float,2>{0.501059115f, 0.356589377f},
-std::array<float,2>{0.00231556012f, 0.916654468f},
-std::array<float,2>{0.169764698f, 0.47897163f},
-std::array<float,2>{0.710634828f, 0.815619886f},
-std::array<float,2>{0.937753201f, 0.0609175228f},
-std::array<float,2>{0.291787446f, 0.506017148f},
-std::array<float,2>{0.486387521f, 0.428631693f},
-std::array<float,2>{0.774507105f, 0.768225551f},
-std::array<float,2>{0.580130339f, 0.0882603154f},
-std::array<float,2>{0.0862278119f, 0.621393025f},
-std::array<float,2>{0.237678915f, 0.201728955f},
-std::array<float,2>{0.643245816f, 0.709104419f},
-std::array<float,2>{0.900655389f, 0.287412077f},
-std::array<float,2>{0.351607084f, 0.943619311f},
-std::array<float,2>{0.263847023f, 0.0115790013f},
-std::array<float,2>{0.974496543f, 0.558970332f},
-std::array<float,2>{0.721756577f, 0.455438852f},
-std::array<float,2>{0.14869006f, 0.848284483f},
-std::array<float,2>{0.0334981717f, 0.336418599f},
-std::array<float,2>{0.549453378f, 0.893719614f},
-std::array<float,2>{0.822414219f, 0.13262926f},
-std::array<float,2>{0.425564647f, 0.666453362f},
-std::array<float,2>{0.420444667f, 0.365871072f},
-std::array<float,2>{0.830853581f, 0.924979627f},
-std::array<float,2>{0.539741158f, 0.158384889f},
-std::array<float,2>{0.0586026199f, 0.630057693f},
-std::array<float,2>{0.137921095f, 0.0358017236f},
-std::array<float,2>{0.735500455f, 0.521083713f},
-std::array<float,2>{0.999053895f, 0.498456717f},
-std::array<float,2>{0.268142492f, 0.828598797f},
-std::array<float,2>{0.3676171f, 0.232216001f},
-std::array<float,2>{0.876936257f, 0.740349889f},
-std::array<float,2>{0.631840885f, 0.27772814f},
-std::array<float,2>{0.234326392f, 0.992868423f},
-std::array<float,2>{0.0684541166f, 0.386951059f},
-std::array<float,2>{0.568582773f, 0.79705435f},
-std::array<float,2>{0.751705885f, 0.101187885f},
-std::array<float,2>{0.476430088f, 0.574055254f},
-std::array<float,2>{0.305198371f, 0.440131992f},
-std::array<float,2>{0.960338533f, 0.859856188f},
-std::array<float,2>{0.688860595f, 0.0266439077f},
-std::array<float,2>{0.175911501f, 0.532926917f},
-std::array<float,2>{0.0276524331f, 0.146572709f},
-std::array<float,2>{0.52898097f, 0.67416507f},
-std::array<float,2>{0.862770438f, 0.315886617f},
-std::array<float,2>{0.378993005f, 0.888593912f},
-std::array<float,2>{0.45233801f, 0.0700635538f},
-std::array<float,2>{0.787480831f, 0.600462198f},
-std::array<float,2>{0.613103271f, 0.420840442f},
-std::array<float,2>{0.11422009f, 0.757552087f},
-std::array<float,2>{0.212340057f, 0.30768767f},
-std::array<float,2>{0.663041949f, 0.962636352f},
-std::array<float,2>{0.92233783f, 0.211117446f},
-std::array<float,2>{0.327590466f, 0.692886829f},
-std::array<float,2>{0.319815487f, 0.34002012f},
-std::array<float,2>{0.934322715f, 0.895982265f},
-std::array<float,2>{0.668512881f, 0.128312826f},
-std::array<float,2>{0.20450291f, 0.671620965f},
-std::array<float,2>{0.123663098f, 0.0132107455f},
-std::array<float,2>{0.618834019f, 0.554830134f},
-std::array<float,2>{0.795040667f, 0.460808963f},
-std::array<float,2>{0.438095123f, 0.844553828f},
-std::array<float,2>{0.383564174f, 0.198564246f},
-std::array<float,2>{0.867787063f, 0.70481354f},
-std::array<float,2>{0.520007312f, 0.281698227f},
-std::array<float,2>{0.0157989785f, 0.939527273f},
-std::array<float,2>{0.182480648f, 0.42454496f},
-std::array<float,2>{0.701714754f, 0.770195186f},
-std::array<float,2>{0.962047637f, 0.0904241055f},
-std::array<float,2>{0.297044218f, 0.618554831f},
-std::array<float,2>{0.483244002f, 0.483115971f},
-std::array<float,2>{0.762615323f, 0.816979945f},
-std::array<float,2>{0.573149502f, 0.0576559044f},
-std::array<float,2>{0.0739391297f, 0.503640354f},
-std::array<float,2>{0.223833278f, 0.184698403f},
-std::array<float,2>{0.635888934f, 0.655021489f},
-std::array<float,2>{0.890551984f, 0.354302943f},
-std::array<float,2>{0.359858602f, 0.918738186f},
-std::array<float,2>{0.278741509f, 0.120863467f},
-std::array<float,2>{0.989013851f, 0.582541823f},
-std::array<float,2>{0.742693484f, 0.400061458f},
-std::array<float,2>{0.12505044f, 0.782855153f},
-std::array<float,2>{0.047293365f, 0.255287021f},
-std::array<float,2>{0.538485706f, 0.975943208f},
-std::array<float,2>{0.842100739f, 0.241264433f},
-std::array<float,2>{0.409231305f, 0.729761779f},
-std::array<float,2>{0.43719992f, 0.311114073f},
-std::array<float,2>{0.818329155f, 0.964867532f},
-std::array<float,2>{0.561154425f, 0.218646511f},
-std::array<float,2>{0.0467903838f, 0.690347373f},
-std::array<float,2>{0.1433613f, 0.0654008985f},
-std::array<float,2>{0.73155117f, 0.594691277f},
-std::array<float,2>{0.981685758f, 0.415780604f},
-std::array<float,2>{0.251303464f, 0.752961516f},
-std::array<float,2>{0.350698441f, 0.141856074f},
-std::array<float,2>{0.895467222f, 0.677590609f},
-std::array<float,2>{0.652215242f, 0.316791952f},
-std::array<float,2>{0.24884586f, 0.883517563f},
-std::array<float,2>{0.0790601969f, 0.444287777f},
-std::array<float,2>{0.586096108f, 0.866863012f},
-std::array<float,2>{0.772737801f, 0.0287279505f},
-std::array<float,2>{0.498205304f, 0.535182416f},
-std::array<float,2>{0.285098225f, 0.385228574f},
-std::array<float,2>{0.946258783f, 0.801146746f},
-std::array<float,2>{0.711694241f, 0.0967609361f},
-std::array<float,2>{0.158355877f, 0.575723171f},
-std::array<float,2>{0.0150877656f, 0.226865426f},
-std::array<float,2>{0.514930069f, 0.736376286f},
-std::array<float,2>{0.849608243f, 0.273633301f},
-std::array<float,2>{0.405580789f, 0.99694699f},
-std::array<float,2>{0.454889089f, 0.0339627825f},
-std::array<float,2>{0.806792259f, 0.516249716f},
-std::array<float,2>{0.594962597f, 0.495219141f},
-std::array<float,2>{0.100050174f, 0.8333987f},
-std::array<float,2>{0.197773889f, 0.359785497f},
-std::array<float,2>{0.676650107f, 0.927907944f},
-std::array<float,2>{0.917308152f, 0.160251841f},
-std::array<float,2>{0.337403834f, 0.626652479f},
-std::array<float,2>{0.261652201f, 0.26910162f},
-std::array<float,2>{0.970093966f, 0.985114455f},
-std::array<float,2>{0.723672569f, 0.221195936f},
-std::array<float,2>{0.153730601f, 0.748992503f},
-std::array<float,2>{0.0373541638f, 0.10691794f},
-std::array<float,2>{0.553727984f, 0.563277364f},
-std::array<float,2>{0.827212214f, 0.376228243f},
-std::array<float,2>{0.427407414f, 0.806607068f},
-std::array<float,2>{0.491217524f, 0.167069718f},
-std::array<float,2>{0.778491378f, 0.636199713f},
-std::array<float,2>{0.584528267f, 0.369413912f},
-std::array<float,2>{0.0918682739f, 0.936758041f},
-std::array<float,2>{0.241018802f, 0.486790717f},
-std::array<float,2>{0.644807994f, 0.836001873f},
-std::array<float,2>{0.904558301f, 0.0467841029f},
-std::array<float,2>{0.356088191f, 0.525874794f},
-std::array<float,2>{0.390686244f, 0.409657419f},
-std::array<float,2>{0.854091108f, 0.761808932f},
-std::array<float,2>{0.5072155f, 0.0712958723f},
-std::array<float,2>{0.00596342469f, 0.607048333f},
-std::array<float,2>{0.165313274f, 0.206052348f},
-std::array<float,2>{0.703142524f, 0.700204313f},
-std::array<float,2>{0.94231081f, 0.30357933f},
-std::array<float,2>{0.295505762f, 0.957933426f},
-std::array<float,2>{0.329850554f, 0.0197832864f},
-std::array<float,2>{0.908762574f, 0.545330226f},
-std::array<float,2>{0.683783352f, 0.448528916f},
-std::array<float,2>{0.190971181f, 0.874191761f},
-std::array<float,2>{0.108848132f, 0.322514892f},
-std::array<float,2>{0.605301678f, 0.875339568f},
-std::array<float,2>{0.802934229f, 0.151389524f},
-std::array<float,2>{0.468508661f, 0.679968715f},
-std::array<float,2>{0.447563857f, 0.345035553f},
-std::array<float,2>{0.784033597f, 0.912791431f},
-std::array<float,2>{0.615333319f, 0.177461386f},
-std::array<float,2>{0.111443803f, 0.644367874f},
-std::array<float,2>{0.215354457f, 0.0531222411f},
-std::array<float,2>{0.65790844f, 0.511524916f},
-std::array<float,2>{0.92934078f, 0.475438714f},
-std::array<float,2>{0.321144313f, 0.82442522f},
-std::array<float,2>{0.310088247f, 0.243381023f},
-std::array<float,2>{0.956483364f, 0.718904018f},
-std::array<float,2>{0.692573786f, 0.258785754f},
-std::array<float,2>{0.171985194f, 0.9775998f},
-std::array<float,2>{0.0238958467f, 0.397935987f},
-std::array<float,2>{0.526965678f, 0.795016587f},
-std::array<float,2>{0.86446768f, 0.11702463f},
-std::array<float,2>{0.375697732f, 0.593486011f},
-std::array<float,2>{0.372149289f, 0.461528003f},
-std::array<float,2>{0.879236162f, 0.855303645f},
-std::array<float,2>{0.628732204f, 0.00593374157f},
-std::array<float,2>{0.229538649f, 0.547486305f},
-std::array<float,2>{0.0637481362f, 0.133921996f},
-std::array<float,2>{0.565190792f, 0.662194967f},
-std::array<float,2>{0.75595665f, 0.335722506f},
-std::array<float,2>{0.469420135f, 0.904769242f},
-std::array<float,2>{0.416370273f, 0.0846141577f},
-std::array<float,2>{0.83234787f, 0.611384213f},
-std::array<float,2>{0.544007897f, 0.433484703f},
-std::array<float,2>{0.0548826642f, 0.780501783f},
-std::array<float,2>{0.133707762f, 0.293601155f},
-std::array<float,2>{0.740039289f, 0.951356888f},
-std::array<float,2>{0.99457413f, 0.195051238f},
-std::array<float,2>{0.269603938f, 0.715856373f},
-std::array<float,2>{0.301114649f, 0.372527063f},
-std::array<float,2>{0.968292058f, 0.931789875f},
-std::array<float,2>{0.699057877f, 0.168370366f},
-std::array<float,2>{0.185617447f, 0.639823139f},
-std::array<float,2>{0.0208982732f, 0.0398310199f},
-std::array<float,2>{0.5185588f, 0.530868411f},
-std::array<float,2>{0.874401212f, 0.491699845f},
-std::array<float,2>{0.386971116f, 0.843163252f},
-std::array<float,2>{0.441755563f, 0.22410956f},
-std::array<float,2>{0.791608334f, 0.742672265f},
-std::array<float,2>{0.621624947f, 0.270985067f},
-std::array<float,2>{0.118052259f, 0.989172757f},
-std::array<float,2>{0.208594888f, 0.382472485f},
-std::array<float,2>{0.665697217f, 0.811606586f},
-std::array<float,2>{0.932690322f, 0.102976754f},
-std::array<float,2>{0.312915653f, 0.568972945f},
-std::array<float,2>{0.41210413f, 0.451159447f},
-std::array<float,2>{0.836535454f, 0.867928445f},
-std::array<float,2>{0.531756163f, 0.0186961815f},
-std::array<float,2>{0.0512130149f, 0.540710092f},
-std::array<float,2>{0.130112767f, 0.1531986f},
-std::array<float,2>{0.748181522f, 0.687382698f},
-std::array<float,2>{0.98443979f, 0.327946842f},
-std::array<float,2>{0.273953348f, 0.881655037f},
-std::array<float,2>{0.364198744f, 0.077367194f},
-std::array<float,2>{0.884335876f, 0.60235548f},
-std::array<float,2>{0.640423f, 0.411168844f},
-std::array<float,2>{0.222220734f, 0.760888994f},
-std::array<float,2>{0.0748711079f, 0.298627466f},
-std::array<float,2>{0.575814068f, 0.955984592f},
-std::array<float,2>{0.761341035f, 0.207168952f},
-std::array<float,2>{0.479450226f, 0.699207544f},
-std::array<float,2>{0.493554562f, 0.263378382f},
-std::array<float,2>{0.769327104f, 0.982756138f},
-std::array<float,2>{0.592119336f, 0.246824995f},
-std::array<float,2>{0.0823446363f, 0.723362565f},
-std::array<float,2>{0.245687589f, 0.111738175f},
-std::array<float,2>{0.653339446f, 0.589253068f},
-std::array<float,2>{0.892603219f, 0.392223418f},
-std::array<float,2>{0.346778691f, 0.79176414f},
-std::array<float,2>{0.254132181f, 0.172694787f},
-std::array<float,2>{0.977698803f, 0.646114349f},
-std::array<float,2>{0.727755487f, 0.351345807f},
-std::array<float,2>{0.14675425f, 0.909199059f},
-std::array<float,2>{0.0417398103f, 0.470019519f},
-std::array<float,2>{0.558572948f, 0.820699751f},
-std::array<float,2>{0.815476477f, 0.0493168868f},
-std::array<float,2>{0.433092952f, 0.512953699f},
-std::array<float,2>{0.34106642f, 0.433651298f},
-std::array<float,2>{0.91922307f, 0.774560034f},
-std::array<float,2>{0.673772693f, 0.0813617483f},
-std::array<float,2>{0.202067003f, 0.616959095f},
-std::array<float,2>{0.0974287689f, 0.188613012f},
-std::array<float,2>{0.600166798f, 0.713256538f},
-std::array<float,2>{0.809780061f, 0.291478515f},
-std::array<float,2>{0.459379435f, 0.945358932f},
-std::array<float,2>{0.39945066f, 0.00303358864f},
-std::array<float,2>{0.846571743f, 0.551564455f},
-std::array<float,2>{0.510975778f, 0.466716051f},
-std::array<float,2>{0.0105366157f, 0.858998001f},
-std::array<float,2>{0.163421497f, 0.328910083f},
-std::array<float,2>{0.718294978f, 0.900591493f},
-std::array<float,2>{0.951588869f, 0.139320359f},
-std::array<float,2>{0.285196871f, 0.656701744f},
-std::array<float,2>{0.355369449f, 0.286596209f},
-std::array<float,2>{0.899255216f, 0.943225086f},
-std::array<float,2>{0.642492056f, 0.201028615f},
-std::array<float,2>{0.236009568f, 0.707993746f},
-std::array<float,2>{0.0889037475f, 0.0875993893f},
-std::array<float,2>{0.578245997f, 0.623364627f},
-std::array<float,2>{0.776831627f, 0.426539063f},
-std::array<float,2>{0.486041069f, 0.766251981f},
-std::array<float,2>{0.421979636f, 0.130112424f},
-std::array<float,2>{0.82131052f, 0.664612651f},
-std::array<float,2>{0.54794991f, 0.338846207f},
-std::array<float,2>{0.0322960541f, 0.892563939f},
-std::array<float,2>{0.151712388f, 0.454954445f},
-std::array<float,2>{0.719774067f, 0.850237608f},
-std::array<float,2>{0.975803435f, 0.00869090483f},
-std::array<float,2>{0.261737496f, 0.561810315f},
-std::array<float,2>{0.464800268f, 0.403499007f},
-std::array<float,2>{0.798161328f, 0.78539443f},
-std::array<float,2>{0.607703626f, 0.121469148f},
-std::array<float,2>{0.102836281f, 0.579440713f},
-std::array<float,2>{0.19167541f, 0.237385899f},
-std::array<float,2>{0.682063878f, 0.731689095f},
-std::array<float,2>{0.910962999f, 0.252900839f},
-std::array<float,2>{0.334572434f, 0.969074011f},
-std::array<float,2>{0.290308893f, 0.0588801205f},
-std::array<float,2>{0.940336883f, 0.504744709f},
-std::array<float,2>{0.708223164f, 0.476903856f},
-std::array<float,2>{0.171093807f, 0.813322961f},
-std::array<float,2>{0.000261032517f, 0.358425409f},
-std::array<float,2>{0.502790749f, 0.915724337f},
-std::array<float,2>{0.85786289f, 0.180253133f},
-std::array<float,2>{0.396978259f, 0.648873329f},
-std::array<float,2>{0.381591767f, 0.314218491f},
-std::array<float,2>{0.860887587f, 0.889158726f},
-std::array<float,2>{0.530532837f, 0.145223781f},
-std::array<float,2>{0.0302788597f, 0.672279119f},
-std::array<float,2>{0.178200245f, 0.0250703208f},
-std::array<float,2>{0.691152096f, 0.53456527f},
-std::array<float,2>{0.957077861f, 0.439027011f},
-std::array<float,2>{0.306958646f, 0.863116324f},
-std::array<float,2>{0.325461894f, 0.21383135f},
-std::array<float,2>{0.924749494f, 0.69364059f},
-std::array<float,2>{0.660250127f, 0.305118084f},
-std::array<float,2>{0.214245513f, 0.964114249f},
-std::array<float,2>{0.115415528f, 0.419539958f},
-std::array<float,2>{0.610012531f, 0.754270852f},
-std::array<float,2>{0.786111772f, 0.066537343f},
-std::array<float,2>{0.450145632f, 0.598550498f},
-std::array<float,2>{0.266151875f, 0.49701497f},
-std::array<float,2>{0.997748375f, 0.831234455f},
-std::array<float,2>{0.737865567f, 0.0371651538f},
-std::array<float,2>{0.140333787f, 0.52195859f},
-std::array<float,2>{0.0612618476f, 0.156909719f},
-std::array<float,2>{0.542878449f, 0.63264972f},
-std::array<float,2>{0.829898715f, 0.363405496f},
-std::array<float,2>{0.419187158f, 0.923435271f},
-std::array<float,2>{0.473495573f, 0.0982193947f},
-std::array<float,2>{0.753690481f, 0.571418583f},
-std::array<float,2>{0.567545891f, 0.390021265f},
-std::array<float,2>{0.0672738254f, 0.799069583f},
-std::array<float,2>{0.230542734f, 0.280013293f},
-std::array<float,2>{0.630197644f, 0.995985806f},
-std::array<float,2>{0.877382517f, 0.233273044f},
-std::array<float,2>{0.370218575f, 0.738664925f},
-std::array<float,2>{0.336509109f, 0.361479729f},
-std::array<float,2>{0.916916668f, 0.926348686f},
-std::array<float,2>{0.676761687f, 0.162514299f},
-std::array<float,2>{0.198468298f, 0.628465593f},
-std::array<float,2>{0.10094849f, 0.03276572f},
-std::array<float,2>{0.594596148f, 0.51842016f},
-std::array<float,2>{0.807637691f, 0.494134754f},
-std::array<float,2>{0.453711778f, 0.834351897f},
-std::array<float,2>{0.40481469f, 0.229075447f},
-std::array<float,2>{0.848570466f, 0.735818505f},
-std::array<float,2>{0.514257908f, 0.277271956f},
-std::array<float,2>{0.0136921415f, 0.999579489f},
-std::array<float,2>{0.16010128f, 0.382816344f},
-std::array<float,2>{0.71282649f, 0.804040194f},
-std::array<float,2>{0.946916997f, 0.0944356918f},
-std::array<float,2>{0.283203155f, 0.577979565f},
-std::array<float,2>{0.499967456f, 0.441684812f},
-std::array<float,2>{0.77152729f, 0.863468289f},
-std::array<float,2>{0.586941898f, 0.0311871823f},
-std::array<float,2>{0.0800431445f, 0.53865236f},
-std::array<float,2>{0.249519244f, 0.143100485f},
-std::array<float,2>{0.651173353f, 0.678981721f},
-std::array<float,2>{0.895688355f, 0.319849968f},
-std::array<float,2>{0.350449234f, 0.88502872f},
-std::array<float,2>{0.250165373f, 0.063405402f},
-std::array<float,2>{0.980997622f, 0.596251547f},
-std::array<float,2>{0.730471909f, 0.416838348f},
-std::array<float,2>{0.144155905f, 0.751150548f},
-std::array<float,2>{0.0452001728f, 0.309900671f},
-std::array<float,2>{0.56196034f, 0.968411922f},
-std::array<float,2>{0.817317545f, 0.215848669f},
-std::array<float,2>{0.436052322f, 0.688742518f},
-std::array<float,2>{0.408504188f, 0.256853789f},
-std::array<float,2>{0.842899978f, 0.974008501f},
-std::array<float,2>{0.53769803f, 0.239021808f},
-std::array<float,2>{0.0478921086f, 0.727570295f},
-std::array<float,2>{0.126040339f, 0.117346577f},
-std::array<float,2>{0.743647337f, 0.584966898f},
-std::array<float,2>{0.990074098f, 0.400715411f},
-std::array<float,2>{0.277785778f, 0.784345329f},
-std::array<float,2>{0.360466748f, 0.186906144f},
-std::array<float,2>{0.888739467f, 0.653676271f},
-std::array<float,2>{0.63560766f, 0.353505313f},
-std::array<float,2>{0.222860366f, 0.921103179f},
-std::array<float,2>{0.0726101547f, 0.481936574f},
-std::array<float,2>{0.573851228f, 0.818880856f},
-std::array<float,2>{0.762973905f, 0.0547784418f},
-std::array<float,2>{0.484023422f, 0.50031364f},
-std::array<float,2>{0.298163414f, 0.423534751f},
-std::array<float,2>{0.961853147f, 0.773177087f},
-std::array<float,2>{0.702200592f, 0.093107596f},
-std::array<float,2>{0.183156908f, 0.620405495f},
-std::array<float,2>{0.0173191968f, 0.195635036f},
-std::array<float,2>{0.521064997f, 0.705668688f},
-std::array<float,2>{0.868601203f, 0.283448517f},
-std::array<float,2>{0.384574294f, 0.938563704f},
-std::array<float,2>{0.439407229f, 0.0136872539f},
-std::array<float,2>{0.796599984f, 0.556812406f},
-std::array<float,2>{0.617773116f, 0.458364785f},
-std::array<float,2>{0.124496333f, 0.847311497f},
-std::array<float,2>{0.203325868f, 0.342634052f},
-std::array<float,2>{0.669113696f, 0.898180902f},
-std::array<float,2>{0.93502754f, 0.126114681f},
-std::array<float,2>{0.319265187f, 0.669373274f},
-std::array<float,2>{0.270774424f, 0.295821726f},
-std::array<float,2>{0.995918572f, 0.949227154f},
-std::array<float,2>{0.739137471f, 0.192705646f},
-std::array<float,2>{0.134209126f, 0.71723491f},
-std::array<float,2>{0.0561527014f, 0.0823314264f},
-std::array<float,2>{0.543465257f, 0.61052376f},
-std::array<float,2>{0.833825946f, 0.430954754f},
-std::array<float,2>{0.417517185f, 0.778383136f},
-std::array<float,2>{0.470167667f, 0.135426253f},
-std::array<float,2>{0.757695854f, 0.661907256f},
-std::array<float,2>{0.565713584f, 0.333803952f},
-std::array<float,2>{0.0630480051f, 0.903786659f},
-std::array<float,2>{0.228539288f, 0.464471668f},
-std::array<float,2>{0.627100646f, 0.853280365f},
-std::array<float,2>{0.880081952f, 0.00489513669f},
-std::array<float,2>{0.371329486f, 0.549474478f},
-std::array<float,2>{0.376627415f, 0.394722819f},
-std::array<float,2>{0.863540471f, 0.794884503f},
-std::array<float,2>{0.526293278f, 0.113867849f},
-std::array<float,2>{0.0245388821f, 0.59030652f},
-std::array<float,2>{0.173525244f, 0.24592568f},
-std::array<float,2>{0.691437185f, 0.722487748f},
-std::array<float,2>{0.955993295f, 0.261415601f},
-std::array<float,2>{0.30915153f, 0.980077922f},
-std::array<float,2>{0.322154254f, 0.0525957681f},
-std::array<float,2>{0.928627729f, 0.508055091f},
-std::array<float,2>{0.657074749f, 0.474584162f},
-std::array<float,2>{0.215955064f, 0.826922834f},
-std::array<float,2>{0.112703957f, 0.34598884f},
-std::array<float,2>{0.616551995f, 0.910716712f},
-std::array<float,2>{0.784933984f, 0.178612068f},
-std::array<float,2>{0.449131459f, 0.642118931f},
-std::array<float,2>{0.467312574f, 0.321461231f},
-std::array<float,2>{0.803804874f, 0.87809962f},
-std::array<float,2>{0.604109108f, 0.149588123f},
-std::array<float,2>{0.108219519f, 0.68327111f},
-std::array<float,2>{0.190124258f, 0.0216746479f},
-std::array<float,2>{0.684674919f, 0.543210983f},
-std::array<float,2>{0.909769535f, 0.445317864f},
-std::array<float,2>{0.328636378f, 0.87226063f},
-std::array<float,2>{0.296468437f, 0.205077142f},
-std::array<float,2>{0.942799091f, 0.703022003f},
-std::array<float,2>{0.704708397f, 0.302330077f},
-std::array<float,2>{0.164648101f, 0.959851801f},
-std::array<float,2>{0.00724109635f, 0.406907558f},
-std::array<float,2>{0.506317019f, 0.763717532f},
-std::array<float,2>{0.855198503f, 0.0732839182f},
-std::array<float,2>{0.391923338f, 0.608581781f},
-std::array<float,2>{0.357305259f, 0.486293286f},
-std::array<float,2>{0.905683339f, 0.838796198f},
-std::array<float,2>{0.645533264f, 0.043580126f},
-std::array<float,2>{0.241436645f, 0.524921954f},
-std::array<float,2>{0.0928608254f, 0.165387049f},
-std::array<float,2>{0.585646629f, 0.633177638f},
-std::array<float,2>{0.778259873f, 0.36871472f},
-std::array<float,2>{0.490911722f, 0.93425864f},
-std::array<float,2>{0.426555455f, 0.108450606f},
-std::array<float,2>{0.826749623f, 0.564472318f},
-std::array<float,2>{0.55314523f, 0.378538936f},
-std::array<float,2>{0.0389350839f, 0.808262944f},
-std::array<float,2>{0.152594402f, 0.266331106f},
-std::array<float,2>{0.722900093f, 0.987906098f},
-std::array<float,2>{0.96900034f, 0.218925402f},
-std::array<float,2>{0.259988576f, 0.747552395f},
-std::array<float,2>{0.28674981f, 0.331301689f},
-std::array<float,2>{0.952926219f, 0.900295615f},
-std::array<float,2>{0.717048228f, 0.13684015f},
-std::array<float,2>{0.16288057f, 0.658565998f},
-std::array<float,2>{0.0111212693f, 0.00107167207f},
-std::array<float,2>{0.51073724f, 0.554005265f},
-std::array<float,2>{0.846899033f, 0.468396068f},
-std::array<float,2>{0.398907125f, 0.855608106f},
-std::array<float,2>{0.46085f, 0.190361291f},
-std::array<float,2>{0.809552252f, 0.712680697f},
-std::array<float,2>{0.601190269f, 0.289064288f},
-std::array<float,2>{0.0963713005f, 0.94749701f},
-std::array<float,2>{0.202615738f, 0.436673164f},
-std::array<float,2>{0.672464907f, 0.776098609f},
-std::array<float,2>{0.91811347f, 0.0781283081f},
-std::array<float,2>{0.340416014f, 0.614269614f},
-std::array<float,2>{0.431774825f, 0.472202063f},
-std::array<float,2>{0.814719319f, 0.824057937f},
-std::array<float,2>{0.556756139f, 0.0470649339f},
-std::array<float,2>{0.0427722074f, 0.515054345f},
-std::array<float,2>{0.148258075f, 0.175261497f},
-std::array<float,2>{0.726800919f, 0.646548212f},
-std::array<float,2>{0.977235138f, 0.349077165f},
-std::array<float,2>{0.255033702f, 0.907302678f},
-std::array<float,2>{0.34619686f, 0.109468982f},
-std::array<float,2>{0.894033968f, 0.586472452f},
-std::array<float,2>{0.653147757f, 0.393253505f},
-std::array<float,2>{0.244907051f, 0.789736331f},
-std::array<float,2>{0.0830680728f, 0.263776034f},
-std::array<float,2>{0.59355253f, 0.981084168f},
-std::array<float,2>{0.76846087f, 0.248559311f},
-std::array<float,2>{0.492284f, 0.725599825f},
-std::array<float,2>{0.480038583f, 0.299120635f},
-std::array<float,2>{0.760020435f, 0.953681648f},
-std::array<float,2>{0.575034916f, 0.209642604f},
-std::array<float,2>{0.0757332295f, 0.696305156f},
-std::array<float,2>{0.221506834f, 0.0752616227f},
-std::array<float,2>{0.639214337f, 0.603533268f},
-std::array<float,2>{0.883426011f, 0.41287294f},
-std::array<float,2>{0.364482105f, 0.75803256f},
-std::array<float,2>{0.274904072f, 0.154340908f},
-std::array<float,2>{0.985635042f, 0.685317695f},
-std::array<float,2>{0.749616742f, 0.324613363f},
-std::array<float,2>{0.128951669f, 0.879675865f},
-std::array<float,2>{0.0521332994f, 0.452091366f},
-std::array<float,2>{0.532665968f, 0.869564354f},
-std::array<float,2>{0.83766228f, 0.0167790242f},
-std::array<float,2>{0.410354197f, 0.541733325f},
-std::array<float,2>{0.314325482f, 0.379939437f},
-std::array<float,2>{0.932434738f, 0.809245408f},
-std::array<float,2>{0.664151371f, 0.105325811f},
-std::array<float,2>{0.207879961f, 0.56690973f},
-std::array<float,2>{0.118271507f, 0.226380438f},
-std::array<float,2>{0.622134745f, 0.745966077f},
-std::array<float,2>{0.792660177f, 0.272450566f},
-std::array<float,2>{0.442957878f, 0.991659939f},
-std::array<float,2>{0.388433635f, 0.0420934297f},
-std::array<float,2>{0.873105526f, 0.52804476f},
-std::array<float,2>{0.51839149f, 0.48868686f},
-std::array<float,2>{0.0198745411f, 0.840832114f},
-std::array<float,2>{0.187486559f, 0.373751491f},
-std::array<float,2>{0.698020995f, 0.929746628f},
-std::array<float,2>{0.966826916f, 0.170223325f},
-std::array<float,2>{0.30189395f, 0.6377303f},
-std::array<float,2>{0.369788557f, 0.278596491f},
-std::array<float,2>{0.878544629f, 0.993364096f},
-std::array<float,2>{0.629236281f, 0.230476424f},
-std::array<float,2>{0.231792971f, 0.74129951f},
-std::array<float,2>{0.0674140975f, 0.0997406542f},
-std::array<float,2>{0.567256212f, 0.572969794f},
-std::array<float,2>{0.752497733f, 0.38797605f},
-std::array<float,2>{0.474343777f, 0.798461914f},
-std::array<float,2>{0.418185771f, 0.159435004f},
-std::array<float,2>{0.828606069f, 0.629880488f},
-std::array<float,2>{0.541299939f, 0.366908848f},
-std::array<float,2>{0.0617729239f, 0.923857749f},
-std::array<float,2>{0.138700798f, 0.499986917f},
-std::array<float,2>{0.736774981f, 0.829406202f},
-std::array<float,2>{0.996725857f, 0.0365465656f},
-std::array<float,2>{0.266809642f, 0.519976616f},
-std::array<float,2>{0.450642526f, 0.421761572f},
-std::array<float,2>{0.786883473f, 0.755917847f},
-std::array<float,2>{0.610778689f, 0.0691800192f},
-std::array<float,2>{0.116779476f, 0.601160824f},
-std::array<float,2>{0.213089645f, 0.21230951f},
-std::array<float,2>{0.661775887f, 0.691619098f},
-std::array<float,2>{0.924807012f, 0.307435274f},
-std::array<float,2>{0.325184762f, 0.961713254f},
-std::array<float,2>{0.307652473f, 0.0259673391f},
-std::array<float,2>{0.958649099f, 0.531932414f},
-std::array<float,2>{0.690407634f, 0.440943211f},
-std::array<float,2>{0.179448813f, 0.861075342f},
-std::array<float,2>{0.0296047963f, 0.314535826f},
-std::array<float,2>{0.529775202f, 0.887336433f},
-std::array<float,2>{0.860026062f, 0.148221642f},
-std::array<float,2>{0.382083416f, 0.674805284f},
-std::array<float,2>{0.397980273f, 0.356140405f},
-std::array<float,2>{0.858636081f, 0.917410493f},
-std::array<float,2>{0.503427982f, 0.181771278f},
-std::array<float,2>{0.00137727428f, 0.652045906f},
-std::array<float,2>{0.170091763f, 0.0615701191f},
-std::array<float,2>{0.707445741f, 0.507651806f},
-std::array<float,2>{0.941377521f, 0.479789376f},
-std::array<float,2>{0.289781958f, 0.814620793f},
-std::array<float,2>{0.335698158f, 0.235788941f},
-std::array<float,2>{0.911170721f, 0.732656419f},
-std::array<float,2>{0.68345058f, 0.250458091f},
-std::array<float,2>{0.193268165f, 0.971031427f},
-std::array<float,2>{0.101995952f, 0.405006886f},
-std::array<float,2>{0.609030724f, 0.788924217f},
-std::array<float,2>{0.797796547f, 0.124194562f},
-std::array<float,2>{0.46328783f, 0.581035137f},
-std::array<float,2>{0.262805253f, 0.456952661f},
-std::array<float,2>{0.97472918f, 0.848959744f},
-std::array<float,2>{0.719347358f, 0.0103871897f},
-std::array<float,2>{0.150911957f, 0.560467541f},
-std::array<float,2>{0.0320220739f, 0.131739169f},
-std::array<float,2>{0.547851324f, 0.667521834f},
-std::array<float,2>{0.820770085f, 0.337433815f},
-std::array<float,2>{0.423029035f, 0.893249452f},
-std::array<float,2>{0.485136926f, 0.0895296261f},
-std::array<float,2>{0.775522172f, 0.622091055f},
-std::array<float,2>{0.579723895f, 0.428910196f},
-std::array<float,2>{0.0888315141f, 0.769471467f},
-std::array<float,2>{0.235227063f, 0.288239866f},
-std::array<float,2>{0.640731633f, 0.944890618f},
-std::array<float,2>{0.899474263f, 0.202631608f},
-std::array<float,2>{0.354256094f, 0.710088134f},
-std::array<float,2>{0.348917693f, 0.318179667f},
-std::array<float,2>{0.897491217f, 0.884632528f},
-std::array<float,2>{0.649058461f, 0.141467422f},
-std::array<float,2>{0.247817233f, 0.67585057f},
-std::array<float,2>{0.0807235464f, 0.0275316592f},
-std::array<float,2>{0.58907634f, 0.536727667f},
-std::array<float,2>{0.769638002f, 0.445064336f},
-std::array<float,2>{0.497949809f, 0.866172373f},
-std::array<float,2>{0.434929609f, 0.217125162f},
-std::array<float,2>{0.819199383f, 0.690690339f},
-std::array<float,2>{0.558774889f, 0.311678231f},
-std::array<float,2>{0.0442845933f, 0.966056049f},
-std::array<float,2>{0.141194955f, 0.414222628f},
-std::array<float,2>{0.732813179f, 0.7524001f},
-std::array<float,2>{0.983910859f, 0.066389963f},
-std::array<float,2>{0.252440035f, 0.595591903f},
-std::array<float,2>{0.455869436f, 0.494206995f},
-std::array<float,2>{0.805901587f, 0.832546413f},
-std::array<float,2>{0.597024322f, 0.0344404876f},
-std::array<float,2>{0.0994790345f, 0.517368972f},
-std::array<float,2>{0.195601568f, 0.161515102f},
-std::array<float,2>{0.678480029f, 0.625141144f},
-std::array<float,2>{0.915940106f, 0.360863298f},
-std::array<float,2>{0.339122981f, 0.929100513f},
-std::array<float,2>{0.282639802f, 0.0962619558f},
-std::array<float,2>{0.947464347f, 0.575074732f},
-std::array<float,2>{0.713450372f, 0.386342138f},
-std::array<float,2>{0.157926053f, 0.802144408f},
-std::array<float,2>{0.0130922189f, 0.275299758f},
-std::array<float,2>{0.513432443f, 0.997220516f},
-std::array<float,2>{0.850832164f, 0.228208944f},
-std::array<float,2>{0.402503371f, 0.737420559f},
-std::array<float,2>{0.386354506f, 0.283021897f},
-std::array<float,2>{0.869922936f, 0.940568268f},
-std::array<float,2>{0.523069203f, 0.19772777f},
-std::array<float,2>{0.0194637254f, 0.703295052f},
-std::array<float,2>{0.181073561f, 0.0916729569f},
-std::array<float,2>{0.700448096f, 0.617332637f},
-std::array<float,2>{0.964185894f, 0.42485258f},
-std::array<float,2>{0.300141513f, 0.771263897f},
-std::array<float,2>{0.317094713f, 0.127865851f},
-std::array<float,2>{0.937336564f, 0.670666099f},
-std::array<float,2>{0.670644104f, 0.341344386f},
-std::array<float,2>{0.205956295f, 0.89476347f},
-std::array<float,2>{0.121620864f, 0.459777594f},
-std::array<float,2>{0.620952249f, 0.845466852f},
-std::array<float,2>{0.794463336f, 0.0126779377f},
-std::array<float,2>{0.440124661f, 0.556594431f},
-std::array<float,2>{0.28059864f, 0.398767084f},
-std::array<float,2>{0.991148591f, 0.781316817f},
-std::array<float,2>{0.745554328f, 0.11995817f},
-std::array<float,2>{0.127039969f, 0.583795786f},
-std::array<float,2>{0.0500818342f, 0.241023615f},
-std::array<float,2>{0.535837889f, 0.729457974f},
-std::array<float,2>{0.840180337f, 0.254586041f},
-std::array<float,2>{0.408117175f, 0.975128472f},
-std::array<float,2>{0.481113702f, 0.0567706265f},
-std::array<float,2>{0.76435411f, 0.502495944f},
-std::array<float,2>{0.571203291f, 0.483820736f},
-std::array<float,2>{0.0716747269f, 0.81746161f},
-std::array<float,2>{0.225296631f, 0.355179489f},
-std::array<float,2>{0.634358048f, 0.91916436f},
-std::array<float,2>{0.888269186f, 0.183745772f},
-std::array<float,2>{0.361387432f, 0.656231701f},
-std::array<float,2>{0.311583221f, 0.259555817f},
-std::array<float,2>{0.954599679f, 0.977292776f},
-std::array<float,2>{0.694066465f, 0.243161291f},
-std::array<float,2>{0.175268039f, 0.720012844f},
-std::array<float,2>{0.0266339239f, 0.115963578f},
-std::array<float,2>{0.524777651f, 0.591990829f},
-std::array<float,2>{0.867075443f, 0.397357732f},
-std::array<float,2>{0.378726691f, 0.796491981f},
-std::array<float,2>{0.446381271f, 0.176056266f},
-std::array<float,2>{0.781752229f, 0.64317733f},
-std::array<float,2>{0.614113629f, 0.344061553f},
-std::array<float,2>{0.11093872f, 0.914012671f},
-std::array<float,2>{0.218315735f, 0.475603074f},
-std::array<float,2>{0.659301996f, 0.825909376f},
-std::array<float,2>{0.926007807f, 0.0538299121f},
-std::array<float,2>{0.322459519f, 0.510041654f},
-std::array<float,2>{0.415406644f, 0.43239525f},
-std::array<float,2>{0.835536957f, 0.780215144f},
-std::array<float,2>{0.545895994f, 0.0854913741f},
-std::array<float,2>{0.0583066568f, 0.612917006f},
-std::array<float,2>{0.135435984f, 0.194292605f},
-std::array<float,2>{0.740270615f, 0.715517104f},
-std::array<float,2>{0.992927134f, 0.294895113f},
-std::array<float,2>{0.272390932f, 0.952246249f},
-std::array<float,2>{0.374099165f, 0.00684710918f},
-std::array<float,2>{0.881857395f, 0.54787153f},
-std::array<float,2>{0.625629425f, 0.462533802f},
-std::array<float,2>{0.226802096f, 0.854325712f},
-std::array<float,2>{0.0661872551f, 0.334111512f},
-std::array<float,2>{0.564404547f, 0.905699253f},
-std::array<float,2>{0.754779339f, 0.133679762f},
-std::array<float,2>{0.471714109f, 0.663190365f},
-std::array<float,2>{0.489738733f, 0.3706927f},
-std::array<float,2>{0.780586004f, 0.935791314f},
-std::array<float,2>{0.583950341f, 0.166351721f},
-std::array<float,2>{0.0911252201f, 0.635497689f},
-std::array<float,2>{0.23956424f, 0.0449640118f},
-std::array<float,2>{0.647867501f, 0.527225256f},
-std::array<float,2>{0.903045177f, 0.488232017f},
-std::array<float,2>{0.358861715f, 0.83776319f},
-std::array<float,2>{0.258070886f, 0.22191605f},
-std::array<float,2>{0.971776962f, 0.749797225f},
-std::array<float,2>{0.725339949f, 0.267787427f},
-std::array<float,2>{0.154350996f, 0.986066937f},
-std::array<float,2>{0.0369069949f, 0.375109494f},
-std::array<float,2>{0.552562177f, 0.805648088f},
-std::array<float,2>{0.825894594f, 0.106085725f},
-std::array<float,2>{0.428857476f, 0.564294875f},
-std::array<float,2>{0.331806451f, 0.44786191f},
-std::array<float,2>{0.907087862f, 0.873695076f},
-std::array<float,2>{0.686581075f, 0.0211077612f},
-std::array<float,2>{0.189149424f, 0.546793878f},
-std::array<float,2>{0.105926618f, 0.15085125f},
-std::array<float,2>{0.602093458f, 0.681424618f},
-std::array<float,2>{0.802419126f, 0.32347542f},
-std::array<float,2>{0.464874297f, 0.876872838f},
-std::array<float,2>{0.393676966f, 0.0707957074f},
-std::array<float,2>{0.852081478f, 0.606305838f},
-std::array<float,2>{0.505123734f, 0.408815891f},
-std::array<float,2>{0.00486768782f, 0.76281774f},
-std::array<float,2>{0.167608559f, 0.304562181f},
-std::array<float,2>{0.705953777f, 0.958931744f},
-std::array<float,2>{0.944409072f, 0.2060965f},
-std::array<float,2>{0.293311715f, 0.70016706f},
-std::array<float,2>{0.256986141f, 0.349906981f},
-std::array<float,2>{0.979314983f, 0.908472478f},
-std::array<float,2>{0.729737282f, 0.173707485f},
-std::array<float,2>{0.146234408f, 0.644967675f},
-std::array<float,2>{0.0406574719f, 0.0507395044f},
-std::array<float,2>{0.555749238f, 0.512339354f},
-std::array<float,2>{0.814264774f, 0.469050705f},
-std::array<float,2>{0.429976106f, 0.821398914f},
-std::array<float,2>{0.49568525f, 0.247790992f},
-std::array<float,2>{0.766075075f, 0.724285066f},
-std::array<float,2>{0.590228677f, 0.261967391f},
-std::array<float,2>{0.0843028873f, 0.983936667f},
-std::array<float,2>{0.242549032f, 0.390849829f},
-std::array<float,2>{0.655204654f, 0.792185545f},
-std::array<float,2>{0.890979588f, 0.112398364f},
-std::array<float,2>{0.3455396f, 0.588118255f},
-std::array<float,2>{0.40209654f, 0.465118378f},
-std::array<float,2>{0.844618797f, 0.857588708f},
-std::array<float,2>{0.5097453f, 0.00237962953f},
-std::array<float,2>{0.00872355048f, 0.55244112f},
-std::array<float,2>{0.160633892f, 0.140360534f},
-std::array<float,2>{0.715338051f, 0.657279313f},
-std::array<float,2>{0.949527442f, 0.329520017f},
-std::array<float,2>{0.287278622f, 0.902264893f},
-std::array<float,2>{0.342837065f, 0.0803979561f},
-std::array<float,2>{0.920190394f, 0.616056561f},
-std::array<float,2>{0.674401283f, 0.435137987f},
-std::array<float,2>{0.199432209f, 0.774362624f},
-std::array<float,2>{0.0944598243f, 0.292314529f},
-std::array<float,2>{0.598693669f, 0.946650684f},
-std::array<float,2>{0.811970651f, 0.187618315f},
-std::array<float,2>{0.457451344f, 0.71421802f},
-std::array<float,2>{0.443668514f, 0.269590408f},
-std::array<float,2>{0.790791392f, 0.990109384f},
-std::array<float,2>{0.623073578f, 0.223108724f},
-std::array<float,2>{0.120286316f, 0.74391371f},
-std::array<float,2>{0.209951043f, 0.102388702f},
-std::array<float,2>{0.6667732f, 0.570204973f},
-std::array<float,2>{0.931034327f, 0.381248176f},
-std::array<float,2>{0.314730883f, 0.811018407f},
-std::array<float,2>{0.303629667f, 0.16945146f},
-std::array<float,2>{0.964914024f, 0.638869107f},
-std::array<float,2>{0.696617663f, 0.371463984f},
-std::array<float,2>{0.184554294f, 0.932702482f},
-std::array<float,2>{0.0217919946f, 0.490327179f},
-std::array<float,2>{0.517344654f, 0.84244591f},
-std::array<float,2>{0.872301936f, 0.0405316949f},
-std::array<float,2>{0.390276641f, 0.529936135f},
-std::array<float,2>{0.365743309f, 0.410610735f},
-std::array<float,2>{0.885495961f, 0.760059416f},
-std::array<float,2>{0.636958539f, 0.0764035285f},
-std::array<float,2>{0.218868241f, 0.603155971f},
-std::array<float,2>{0.0775527135f, 0.2089241f},
-std::array<float,2>{0.576428294f, 0.698028922f},
-std::array<float,2>{0.758460164f, 0.297783852f},
-std::array<float,2>{0.477632314f, 0.956464112f},
-std::array<float,2>{0.413610876f, 0.018102847f},
-std::array<float,2>{0.83942014f, 0.539078057f},
-std::array<float,2>{0.534227371f, 0.449870467f},
-std::array<float,2>{0.0538900122f, 0.868188858f},
-std::array<float,2>{0.131946757f, 0.326299995f},
-std::array<float,2>{0.747811437f, 0.882610917f},
-std::array<float,2>{0.987898409f, 0.153447554f},
-std::array<float,2>{0.275974154f, 0.686366677f},
-std::array<float,2>{0.326421261f, 0.305817068f},
-std::array<float,2>{0.923494756f, 0.963848352f},
-std::array<float,2>{0.663143814f, 0.214673236f},
-std::array<float,2>{0.211145625f, 0.694442332f},
-std::array<float,2>{0.114471659f, 0.0675416142f},
-std::array<float,2>{0.612019598f, 0.599085867f},
-std::array<float,2>{0.788529217f, 0.418409258f},
-std::array<float,2>{0.451833934f, 0.755309463f},
-std::array<float,2>{0.379905224f, 0.145849153f},
-std::array<float,2>{0.861978292f, 0.673358083f},
-std::array<float,2>{0.528312147f, 0.313193589f},
-std::array<float,2>{0.0286844578f, 0.89040029f},
-std::array<float,2>{0.177207425f, 0.438433677f},
-std::array<float,2>{0.688230276f, 0.861816943f},
-std::array<float,2>{0.959142029f, 0.0243406929f},
-std::array<float,2>{0.305854559f, 0.533569872f},
-std::array<float,2>{0.474750847f, 0.388787538f},
-std::array<float,2>{0.750659108f, 0.799905479f},
-std::array<float,2>{0.569686592f, 0.0994826779f},
-std::array<float,2>{0.0697987303f, 0.570943177f},
-std::array<float,2>{0.232980654f, 0.233688146f},
-std::array<float,2>{0.631029963f, 0.740069926f},
-std::array<float,2>{0.875275612f, 0.281049877f},
-std::array<float,2>{0.36890164f, 0.994339049f},
-std::array<float,2>{0.269241452f, 0.0386664495f},
-std::array<float,2>{0.998864055f, 0.523349166f},
-std::array<float,2>{0.734721124f, 0.497575134f},
-std::array<float,2>{0.137130618f, 0.830155492f},
-std::array<float,2>{0.0603106096f, 0.364946008f},
-std::array<float,2>{0.540240884f, 0.9220649f},
-std::array<float,2>{0.831335604f, 0.157994434f},
-std::array<float,2>{0.420954049f, 0.631828308f},
-std::array<float,2>{0.424248159f, 0.33896181f},
-std::array<float,2>{0.8234725f, 0.891511858f},
-std::array<float,2>{0.550724864f, 0.129592717f},
-std::array<float,2>{0.0349008739f, 0.665116966f},
-std::array<float,2>{0.149827793f, 0.00909280311f},
-std::array<float,2>{0.720842361f, 0.561062872f},
-std::array<float,2>{0.973054647f, 0.454063237f},
-std::array<float,2>{0.265203625f, 0.850960433f},
-std::array<float,2>{0.353287518f, 0.199674472f},
-std::array<float,2>{0.901595891f, 0.708213627f},
-std::array<float,2>{0.644341707f, 0.285635442f},
-std::array<float,2>{0.236610174f, 0.941572487f},
-std::array<float,2>{0.0874041319f, 0.427533805f},
-std::array<float,2>{0.581655264f, 0.767483056f},
-std::array<float,2>{0.774353325f, 0.0867858082f},
-std::array<float,2>{0.488150269f, 0.62472707f},
-std::array<float,2>{0.292947471f, 0.478048861f},
-std::array<float,2>{0.939295292f, 0.813951433f},
-std::array<float,2>{0.70927465f, 0.059794765f},
-std::array<float,2>{0.168753088f, 0.504923701f},
-std::array<float,2>{0.00317071402f, 0.18160893f},
-std::array<float,2>{0.500695467f, 0.650369227f},
-std::array<float,2>{0.857043684f, 0.358281106f},
-std::array<float,2>{0.394638389f, 0.914384186f},
-std::array<float,2>{0.462017f, 0.122798815f},
-std::array<float,2>{0.799737275f, 0.578275681f},
-std::array<float,2>{0.607081831f, 0.402877569f},
-std::array<float,2>{0.104819648f, 0.78644985f},
-std::array<float,2>{0.194291383f, 0.253679991f},
-std::array<float,2>{0.68156749f, 0.97048229f},
-std::array<float,2>{0.913873255f, 0.236513272f},
-std::array<float,2>{0.333076835f, 0.73048991f},
-std::array<float,2>{0.359355539f, 0.368463039f},
-std::array<float,2>{0.902402639f, 0.933742285f},
-std::array<float,2>{0.648419678f, 0.165550828f},
-std::array<float,2>{0.240047425f, 0.633698821f},
-std::array<float,2>{0.0914367959f, 0.0429766588f},
-std::array<float,2>{0.58345145f, 0.524635971f},
-std::array<float,2>{0.781113088f, 0.485428214f},
-std::array<float,2>{0.490020633f, 0.838244081f},
-std::array<float,2>{0.429631025f, 0.219561875f},
-std::array<float,2>{0.825489044f, 0.747652173f},
-std::array<float,2>{0.551883101f, 0.265896112f},
-std::array<float,2>{0.0363326669f, 0.987658024f},
-std::array<float,2>{0.155083388f, 0.37795347f},
-std::array<float,2>{0.724813044f, 0.807684124f},
-std::array<float,2>{0.972295105f, 0.109116726f},
-std::array<float,2>{0.258369923f, 0.565151393f},
-std::array<float,2>{0.465718865f, 0.445949852f},
-std::array<float,2>{0.801999867f, 0.872929931f},
-std::array<float,2>{0.601796329f, 0.0222009309f},
-std::array<float,2>{0.106191814f, 0.543765545f},
-std::array<float,2>{0.188610688f, 0.15011774f},
-std::array<float,2>{0.687471926f, 0.68271637f},
-std::array<float,2>{0.906547427f, 0.322113156f},
-std::array<float,2>{0.331407964f, 0.878613949f},
-std::array<float,2>{0.293814301f, 0.0738927498f},
-std::array<float,2>{0.945071876f, 0.60925293f},
-std::array<float,2>{0.705383956f, 0.406650752f},
-std::array<float,2>{0.167083606f, 0.764556706f},
-std::array<float,2>{0.00399158336f, 0.301795304f},
-std::array<float,2>{0.505759478f, 0.959176302f},
-std::array<float,2>{0.851994395f, 0.204565242f},
-std::array<float,2>{0.394488126f, 0.702189863f},
-std::array<float,2>{0.377942711f, 0.260953039f},
-std::array<float,2>{0.866535187f, 0.979628801f},
-std::array<float,2>{0.525370657f, 0.245313987f},
-std::array<float,2>{0.0271465145f, 0.72169292f},
-std::array<float,2>{0.17569764f, 0.113733247f},
-std::array<float,2>{0.693496525f, 0.590377867f},
-std::array<float,2>{0.954518914f, 0.395136952f},
-std::array<float,2>{0.312049985f, 0.794002414f},
-std::array<float,2>{0.322764307f, 0.177798495f},
-std::array<float,2>{0.926332414f, 0.64198935f},
-std::array<float,2>{0.660154045f, 0.34634456f},
-std::array<float,2>{0.218047291f, 0.910350621f},
-std::array<float,2>{0.110358492f, 0.473931611f},
-std::array<float,2>{0.613667727f, 0.826568723f},
-std::array<float,2>{0.781712294f, 0.0521180704f},
-std::array<float,2>{0.446787745f, 0.508707464f},
-std::array<float,2>{0.271652132f, 0.431248158f},
-std::array<float,2>{0.992552996f, 0.77908963f},
-std::array<float,2>{0.741067708f, 0.0827369839f},
-std::array<float,2>{0.134845719f, 0.611223161f},
-std::array<float,2>{0.0580400601f, 0.193261072f},
-std::array<float,2>{0.545106947f, 0.717521489f},
-std::array<float,2>{0.835048437f, 0.295226574f},
-std::array<float,2>{0.415596753f, 0.95006907f},
-std::array<float,2>{0.472276658f, 0.0057833828f},
-std::array<float,2>{0.754078746f, 0.549076736f},
-std::array<float,2>{0.563927948f, 0.464264691f},
-std::array<float,2>{0.0655894503f, 0.852593362f},
-std::array<float,2>{0.227435872f, 0.333439499f},
-std::array<float,2>{0.625217497f, 0.904125392f},
-std::array<float,2>{0.882715583f, 0.134807646f},
-std::array<float,2>{0.374873966f, 0.661369622f},
-std::array<float,2>{0.300643265f, 0.283851683f},
-std::array<float,2>{0.964750648f, 0.938967288f},
-std::array<float,2>{0.700953126f, 0.195895031f},
-std::array<float,2>{0.181616068f, 0.705347538f},
-std::array<float,2>{0.0186573435f, 0.0936236903f},
-std::array<float,2>{0.522492051f, 0.621078968f},
-std::array<float,2>{0.869172096f, 0.422891527f},
-std::array<float,2>{0.385982096f, 0.772502959f},
-std::array<float,2>{0.439861745f, 0.126811877f},
-std::array<float,2>{0.794331849f, 0.669582605f},
-std::array<float,2>{0.620169163f, 0.341988087f},
-std::array<float,2>{0.121103287f, 0.897768378f},
-std::array<float,2>{0.2051889f, 0.458918661f},
-std::array<float,2>{0.669943333f, 0.847162724f},
-std::array<float,2>{0.936999023f, 0.0143710934f},
-std::array<float,2>{0.316445351f, 0.557604969f},
-std::array<float,2>{0.407474667f, 0.401248842f},
-std::array<float,2>{0.840493143f, 0.784724534f},
-std::array<float,2>{0.535367668f, 0.117686629f},
-std::array<float,2>{0.0506172851f, 0.58588624f},
-std::array<float,2>{0.127773389f, 0.238500834f},
-std::array<float,2>{0.74587518f, 0.728177845f},
-std::array<float,2>{0.990601778f, 0.257684231f},
-std::array<float,2>{0.280820221f, 0.974462986f},
-std::array<float,2>{0.362260818f, 0.0551919714f},
-std::array<float,2>{0.88783443f, 0.500831902f},
-std::array<float,2>{0.634021044f, 0.481573641f},
-std::array<float,2>{0.22477147f, 0.818461359f},
-std::array<float,2>{0.0720370263f, 0.352780163f},
-std::array<float,2>{0.570646465f, 0.921744525f},
-std::array<float,2>{0.763734877f, 0.187171638f},
-std::array<float,2>{0.480851859f, 0.653961003f},
-std::array<float,2>{0.497443616f, 0.319374949f},
-std::array<float,2>{0.770416021f, 0.885525227f},
-std::array<float,2>{0.589627743f, 0.142967969f},
-std::array<float,2>{0.0803610608f, 0.679312289f},
-std::array<float,2>{0.247362524f, 0.0306938309f},
-std::array<float,2>{0.648491323f, 0.538268209f},
-std::array<float,2>{0.898006082f, 0.442160428f},
-std::array<float,2>{0.349573016f, 0.863999665f},
-std::array<float,2>{0.252562612f, 0.216564924f},
-std::array<float,2>{0.983648837f, 0.689180493f},
-std::array<float,2>{0.733009756f, 0.310126424f},
-std::array<float,2>{0.140777007f, 0.967777073f},
-std::array<float,2>{0.0448859148f, 0.416319877f},
-std::array<float,2>{0.559232235f, 0.751466215f},
-std::array<float,2>{0.818534613f, 0.0627729222f},
-std::array<float,2>{0.435284704f, 0.595736325f},
-std::array<float,2>{0.33944723f, 0.493453354f},
-std::array<float,2>{0.915395737f, 0.834960639f},
-std::array<float,2>{0.678118408f, 0.032240957f},
-std::array<float,2>{0.195890933f, 0.517885268f},
-std::array<float,2>{0.0990846604f, 0.16262269f},
-std::array<float,2>{0.597600222f, 0.628216803f},
-std::array<float,2>{0.80617106f, 0.361995488f},
-std::array<float,2>{0.455395013f, 0.926164448f},
-std::array<float,2>{0.402990937f, 0.0939362496f},
-std::array<float,2>{0.851110041f, 0.577607393f},
-std::array<float,2>{0.513123214f, 0.383769155f},
-std::array<float,2>{0.0133753251f, 0.80436337f},
-std::array<float,2>{0.157460362f, 0.276843578f},
-std::array<float,2>{0.71314013f, 0.999067545f},
-std::array<float,2>{0.947892308f, 0.228948042f},
-std::array<float,2>{0.282809526f, 0.736065209f},
-std::array<float,2>{0.264961332f, 0.337292284f},
-std::array<float,2>{0.973367751f, 0.892876148f},
-std::array<float,2>{0.721677423f, 0.131110236f},
-std::array<float,2>{0.150176048f, 0.66702193f},
-std::array<float,2>{0.0343290605f, 0.0099992333f},
-std::array<float,2>{0.549847841f, 0.560004175f},
-std::array<float,2>{0.824073732f, 0.456391364f},
-std::array<float,2>{0.424545467f, 0.849405527f},
-std::array<float,2>{0.48774749f, 0.202914611f},
-std::array<float,2>{0.773618937f, 0.710887015f},
-std::array<float,2>{0.581458449f, 0.288669169f},
-std::array<float,2>{0.0872605368f, 0.944640219f},
-std::array<float,2>{0.237074807f, 0.429390162f},
-std::array<float,2>{0.643737316f, 0.76879859f},
-std::array<float,2>{0.902056575f, 0.0891781077f},
-std::array<float,2>{0.352759957f, 0.623022377f},
-std::array<float,2>{0.395080596f, 0.480118632f},
-std::array<float,2>{0.856855333f, 0.815290391f},
-std::array<float,2>{0.500029802f, 0.0623492971f},
-std::array<float,2>{0.0037540521f, 0.507152796f},
-std::array<float,2>{0.16805011f, 0.182323858f},
-std::array<float,2>{0.70983696f, 0.651761174f},
-std::array<float,2>{0.938870728f, 0.35590598f},
-std::array<float,2>{0.292011797f, 0.917571366f},
-std::array<float,2>{0.333684325f, 0.124685146f},
-std::array<float,2>{0.913479447f, 0.580180764f},
-std::array<float,2>{0.680780828f, 0.404767036f},
-std::array<float,2>{0.193399698f, 0.788470626f},
-std::array<float,2>{0.105096258f, 0.250625849f},
-std::array<float,2>{0.606501758f, 0.971478224f},
-std::array<float,2>{0.799150169f, 0.235886991f},
-std::array<float,2>{0.462632716f, 0.733383834f},
-std::array<float,2>{0.451316506f, 0.306844294f},
-std::array<float,2>{0.788801551f, 0.961091459f},
-std::array<float,2>{0.611517012f, 0.212720394f},
-std::array<float,2>{0.114775233f, 0.692337632f},
-std::array<float,2>{0.21188423f, 0.0683656484f},
-std::array<float,2>{0.663989246f, 0.600687921f},
-std::array<float,2>{0.922864497f, 0.421128601f},
-std::array<float,2>{0.326789558f, 0.756593704f},
-std::array<float,2>{0.306331009f, 0.147704378f},
-std::array<float,2>{0.959648907f, 0.675620914f},
-std::array<float,2>{0.687953532f, 0.314994425f},
-std::array<float,2>{0.177326217f, 0.886957526f},
-std::array<float,2>{0.0289780758f, 0.440639585f},
-std::array<float,2>{0.527641475f, 0.86067301f},
-std::array<float,2>{0.861768365f, 0.025776051f},
-std::array<float,2>{0.380465418f, 0.531500936f},
-std::array<float,2>{0.368369877f, 0.388252258f},
-std::array<float,2>{0.875755131f, 0.798292458f},
-std::array<float,2>{0.631353617f, 0.100514628f},
-std::array<float,2>{0.232803762f, 0.572502196f},
-std::array<float,2>{0.0702428967f, 0.23097086f},
-std::array<float,2>{0.569983959f, 0.742049634f},
-std::array<float,2>{0.750066817f, 0.278895229f},
-std::array<float,2>{0.47533986f, 0.993957579f},
-std::array<float,2>{0.421805054f, 0.0366775021f},
-std::array<float,2>{0.831648946f, 0.520110846f},
-std::array<float,2>{0.540670872f, 0.499286592f},
-std::array<float,2>{0.0596682541f, 0.829891443f},
-std::array<float,2>{0.137529314f, 0.366657257f},
-std::array<float,2>{0.735313296f, 0.92452246f},
-std::array<float,2>{0.99816972f, 0.159856752f},
-std::array<float,2>{0.268916905f, 0.629303217f},
-std::array<float,2>{0.315405905f, 0.271631271f},
-std::array<float,2>{0.931283951f, 0.991869926f},
-std::array<float,2>{0.666060865f, 0.225621209f},
-std::array<float,2>{0.209391445f, 0.745425701f},
-std::array<float,2>{0.120616123f, 0.104719304f},
-std::array<float,2>{0.623839736f, 0.566585362f},
-std::array<float,2>{0.790508449f, 0.380404681f},
-std::array<float,2>{0.444319516f, 0.808856785f},
-std::array<float,2>{0.389688492f, 0.170558706f},
-std::array<float,2>{0.873037755f, 0.638488233f},
-std::array<float,2>{0.516616166f, 0.373322815f},
-std::array<float,2>{0.0220209919f, 0.930254519f},
-std::array<float,2>{0.183861241f, 0.488841265f},
-std::array<float,2>{0.697187543f, 0.841359556f},
-std::array<float,2>{0.96577388f, 0.0425967164f},
-std::array<float,2>{0.302965969f, 0.527662754f},
-std::array<float,2>{0.478124857f, 0.412188172f},
-std::array<float,2>{0.758277237f, 0.758333087f},
-std::array<float,2>{0.576995194f, 0.076016441f},
-std::array<float,2>{0.0781229436f, 0.604150414f},
-std::array<float,2>{0.219443083f, 0.209204137f},
-std::array<float,2>{0.637215674f, 0.697130263f},
-std::array<float,2>{0.884870708f, 0.299407363f},
-std::array<float,2>{0.365429252f, 0.953518033f},
-std::array<float,2>{0.275675714f, 0.0172339864f},
-std::array<float,2>{0.987557948f, 0.541260004f},
-std::array<float,2>{0.74711597f, 0.451596737f},
-std::array<float,2>{0.132421687f, 0.870049238f},
-std::array<float,2>{0.0546862893f, 0.324722439f},
-std::array<float,2>{0.534742951f, 0.879100919f},
-std::array<float,2>{0.839063287f, 0.154943183f},
-std::array<float,2>{0.413336486f, 0.684733212f},
-std::array<float,2>{0.430338591f, 0.349336058f},
-std::array<float,2>{0.813493073f, 0.908140302f},
-std::array<float,2>{0.556466758f, 0.175303817f},
-std::array<float,2>{0.0403580219f, 0.647264183f},
-std::array<float,2>{0.145972893f, 0.0477385558f},
-std::array<float,2>{0.730356932f, 0.515303552f},
-std::array<float,2>{0.978825331f, 0.471927375f},
-std::array<float,2>{0.257382572f, 0.823676705f},
-std::array<float,2>{0.345055044f, 0.248095647f},
-std::array<float,2>{0.891493559f, 0.726480305f},
-std::array<float,2>{0.654589653f, 0.264370143f},
-std::array<float,2>{0.242732868f, 0.980907321f},
-std::array<float,2>{0.0849000514f, 0.392733276f},
-std::array<float,2>{0.59074229f, 0.789211571f},
-std::array<float,2>{0.766301692f, 0.110193171f},
-std::array<float,2>{0.49554956f, 0.586274743f},
-std::array<float,2>{0.28762731f, 0.468022764f},
-std::array<float,2>{0.950079679f, 0.856016219f},
-std::array<float,2>{0.715005994f, 0.00172599813f},
-std::array<float,2>{0.160966456f, 0.554513216f},
-std::array<float,2>{0.00798479002f, 0.137335539f},
-std::array<float,2>{0.509152651f, 0.65913862f},
-std::array<float,2>{0.844118774f, 0.331729889f},
-std::array<float,2>{0.401443064f, 0.899807811f},
-std::array<float,2>{0.457742006f, 0.0787552148f},
-std::array<float,2>{0.812180281f, 0.615086615f},
-std::array<float,2>{0.599208295f, 0.437410802f},
-std::array<float,2>{0.0937798247f, 0.775878847f},
-std::array<float,2>{0.200060099f, 0.28956607f},
-std::array<float,2>{0.674105167f, 0.947952867f},
-std::array<float,2>{0.920886219f, 0.189747706f},
-std::array<float,2>{0.343586504f, 0.712304056f},
-std::array<float,2>{0.328309864f, 0.323886007f},
-std::array<float,2>{0.909345627f, 0.8760553f},
-std::array<float,2>{0.685265481f, 0.1513457f},
-std::array<float,2>{0.189732328f, 0.680841148f},
-std::array<float,2>{0.107712977f, 0.0206938498f},
-std::array<float,2>{0.603549182f, 0.546278f},
-std::array<float,2>{0.804641366f, 0.447565168f},
-std::array<float,2>{0.466975182f, 0.873475552f},
-std::array<float,2>{0.392161161f, 0.206649393f},
-std::array<float,2>{0.854948819f, 0.699656725f},
-std::array<float,2>{0.506495595f, 0.303944916f},
-std::array<float,2>{0.00741371047f, 0.958054662f},
-std::array<float,2>{0.164299861f, 0.408433139f},
-std::array<float,2>{0.704275131f, 0.763638496f},
-std::array<float,2>{0.943283498f, 0.0708141029f},
-std::array<float,2>{0.296361148f, 0.6055516f},
-std::array<float,2>{0.490454942f, 0.487751633f},
-std::array<float,2>{0.777589679f, 0.837338984f},
-std::array<float,2>{0.584971786f, 0.0455324426f},
-std::array<float,2>{0.0934325308f, 0.526373506f},
-std::array<float,2>{0.241892993f, 0.166592687f},
-std::array<float,2>{0.646341324f, 0.634807348f},
-std::array<float,2>{0.90608871f, 0.370301396f},
-std::array<float,2>{0.356614977f, 0.936080813f},
-std::array<float,2>{0.260411173f, 0.105524823f},
-std::array<float,2>{0.969379902f, 0.563780725f},
-std::array<float,2>{0.72315377f, 0.375607163f},
-std::array<float,2>{0.153166354f, 0.804916978f},
-std::array<float,2>{0.0382609032f, 0.26815623f},
-std::array<float,2>{0.553390265f, 0.985725462f},
-std::array<float,2>{0.826250911f, 0.222587734f},
-std::array<float,2>{0.425980777f, 0.749451518f},
-std::array<float,2>{0.417337567f, 0.294297427f},
-std::array<float,2>{0.833208025f, 0.952924907f},
-std::array<float,2>{0.542986035f, 0.193411633f},
-std::array<float,2>{0.0558121838f, 0.714951277f},
-std::array<float,2>{0.134393618f, 0.0852826834f},
-std::array<float,2>{0.738591075f, 0.612320662f},
-std::array<float,2>{0.995444f, 0.432013571f},
-std::array<float,2>{0.271455199f, 0.77962482f},
-std::array<float,2>{0.37175709f, 0.133003697f},
-std::array<float,2>{0.880806208f, 0.664016068f},
-std::array<float,2>{0.62778163f, 0.334603637f},
-std::array<float,2>{0.229403168f, 0.906033814f},
-std::array<float,2>{0.0629602298f, 0.462357253f},
-std::array<float,2>{0.566345096f, 0.853544235f},
-std::array<float,2>{0.757250369f, 0.00739473244f},
-std::array<float,2>{0.470403463f, 0.548537493f},
-std::array<float,2>{0.308885306f, 0.396822035f},
-std::array<float,2>{0.955493987f, 0.795950115f},
-std::array<float,2>{0.692148268f, 0.115587316f},
-std::array<float,2>{0.17306976f, 0.592319727f},
-std::array<float,2>{0.0251439922f, 0.242456496f},
-std::array<float,2>{0.525746882f, 0.720640004f},
-std::array<float,2>{0.863857388f, 0.258864403f},
-std::array<float,2>{0.376004905f, 0.976929665f},
-std::array<float,2>{0.448548913f, 0.0545454659f},
-std::array<float,2>{0.784190655f, 0.510633588f},
-std::array<float,2>{0.617087543f, 0.476119846f},
-std::array<float,2>{0.113260254f, 0.825449705f},
-std::array<float,2>{0.216731533f, 0.344635963f},
-std::array<float,2>{0.656372011f, 0.913171113f},
-std::array<float,2>{0.928165495f, 0.176433206f},
-std::array<float,2>{0.321667165f, 0.643055737f},
-std::array<float,2>{0.278193116f, 0.254330456f},
-std::array<float,2>{0.989500642f, 0.975071609f},
-std::array<float,2>{0.743717313f, 0.240531966f},
-std::array<float,2>{0.126898989f, 0.728900015f},
-std::array<float,2>{0.0488124005f, 0.119286358f},
-std::array<float,2>{0.537543356f, 0.583128333f},
-std::array<float,2>{0.843419492f, 0.398988873f},
-std::array<float,2>{0.40879634f, 0.782119811f},
-std::array<float,2>{0.48355031f, 0.184229538f},
-std::array<float,2>{0.763333619f, 0.655708313f},
-std::array<float,2>{0.573598802f, 0.354560554f},
-std::array<float,2>{0.0729726031f, 0.919791996f},
-std::array<float,2>{0.223222658f, 0.484268874f},
-std::array<float,2>{0.635172188f, 0.818334758f},
-std::array<float,2>{0.889278054f, 0.0574308373f},
-std::array<float,2>{0.361171424f, 0.501989245f},
-std::array<float,2>{0.383864254f, 0.425496876f},
-std::array<float,2>{0.868976116f, 0.770834863f},
-std::array<float,2>{0.520915568f, 0.0912179872f},
-std::array<float,2>{0.0170507841f, 0.617815971f},
-std::array<float,2>{0.182763323f, 0.197834328f},
-std::array<float,2>{0.702883422f, 0.703747869f},
-std::array<float,2>{0.961277008f, 0.282474011f},
-std::array<float,2>{0.298495054f, 0.941208243f},
-std::array<float,2>{0.318537235f, 0.0119488472f},
-std::array<float,2>{0.935406089f, 0.555753708f},
-std::array<float,2>{0.66967386f, 0.459153801f},
-std::array<float,2>{0.203934804f, 0.844918311f},
-std::array<float,2>{0.124617852f, 0.341288775f},
-std::array<float,2>{0.617293596f, 0.895080209f},
-std::array<float,2>{0.795916736f, 0.127209872f},
-std::array<float,2>{0.438485354f, 0.670139492f},
-std::array<float,2>{0.453287035f, 0.360435754f},
-std::array<float,2>{0.80842948f, 0.929589331f},
-std::array<float,2>{0.594150424f, 0.16176036f},
-std::array<float,2>{0.101290137f, 0.625944078f},
-std::array<float,2>{0.199120075f, 0.0347160809f},
-std::array<float,2>{0.677518249f, 0.516709626f},
-std::array<float,2>{0.916325808f, 0.494693369f},
-std::array<float,2>{0.336126119f, 0.832476914f},
-std::array<float,2>{0.283786833f, 0.227553129f},
-std::array<float,2>{0.946529686f, 0.738013446f},
-std::array<float,2>{0.712056279f, 0.274516851f},
-std::array<float,2>{0.159652665f, 0.997957885f},
-std::array<float,2>{0.0145041291f, 0.385890871f},
-std::array<float,2>{0.514105856f, 0.802305281f},
-std::array<float,2>{0.847664058f, 0.0958238244f},
-std::array<float,2>{0.404771179f, 0.574702442f},
-std::array<float,2>{0.349835008f, 0.444667578f},
-std::array<float,2>{0.896021903f, 0.865338027f},
-std::array<float,2>{0.650684655f, 0.0279172491f},
-std::array<float,2>{0.249091849f, 0.536236107f},
-std::array<float,2>{0.0792370215f, 0.140987545f},
-std::array<float,2>{0.587437093f, 0.676445305f},
-std::array<float,2>{0.772299707f, 0.317496121f},
-std::array<float,2>{0.499352515f, 0.884046972f},
-std::array<float,2>{0.435945064f, 0.0655902177f},
-std::array<float,2>{0.816668749f, 0.594772875f},
-std::array<float,2>{0.562477589f, 0.414693117f},
-std::array<float,2>{0.0456686243f, 0.752881825f},
-std::array<float,2>{0.143718719f, 0.312430799f},
-std::array<float,2>{0.731309831f, 0.966436684f},
-std::array<float,2>{0.980779827f, 0.217602581f},
-std::array<float,2>{0.250680208f, 0.691376567f},
-std::array<float,2>{0.289325804f, 0.357822567f},
-std::array<float,2>{0.940492511f, 0.914636731f},
-std::array<float,2>{0.707749546f, 0.180988997f},
-std::array<float,2>{0.170734048f, 0.649438798f},
-std::array<float,2>{0.00182091421f, 0.0603159182f},
-std::array<float,2>{0.50309515f, 0.505736291f},
-std::array<float,2>{0.859214604f, 0.477543503f},
-std::array<float,2>{0.397859097f, 0.814085186f},
-std::array<float,2>{0.46376276f, 0.236920804f},
-std::array<float,2>{0.797096848f, 0.731418967f},
-std::array<float,2>{0.608623922f, 0.253144115f},
-std::array<float,2>{0.102472797f, 0.969970465f},
-std::array<float,2>{0.192793056f, 0.402530402f},
-std::array<float,2>{0.683084607f, 0.78704083f},
-std::array<float,2>{0.911975205f, 0.12211667f},
-std::array<float,2>{0.335394204f, 0.57905513f},
-std::array<float,2>{0.423368126f, 0.453587443f},
-std::array<float,2>{0.821053982f, 0.851425171f},
-std::array<float,2>{0.547163546f, 0.00959182344f},
-std::array<float,2>{0.0314503647f, 0.560764134f},
-std::array<float,2>{0.150468573f, 0.129023999f},
-std::array<float,2>{0.718961835f, 0.665850282f},
-std::array<float,2>{0.975170135f, 0.339486301f},
-std::array<float,2>{0.263284266f, 0.890999138f},
-std::array<float,2>{0.353615403f, 0.0863317922f},
-std::array<float,2>{0.900272727f, 0.624132156f},
-std::array<float,2>{0.641422272f, 0.426784307f},
-std::array<float,2>{0.23467958f, 0.76700747f},
-std::array<float,2>{0.0882753804f, 0.285840601f},
-std::array<float,2>{0.579508424f, 0.942069232f},
-std::array<float,2>{0.775976717f, 0.200157583f},
-std::array<float,2>{0.484411627f, 0.708840728f},
-std::array<float,2>{0.47382462f, 0.280467808f},
-std::array<float,2>{0.752269268f, 0.994781494f},
-std::array<float,2>{0.566643238f, 0.23426415f},
-std::array<float,2>{0.0678884163f, 0.739631474f},
-std::array<float,2>{0.232083172f, 0.098651275f},
-std::array<float,2>{0.62985611f, 0.570609331f},
-std::array<float,2>{0.878017008f, 0.389233351f},
-std::array<float,2>{0.369396269f, 0.800645709f},
-std::array<float,2>{0.267303854f, 0.157301337f},
-std::array<float,2>{0.996137321f, 0.630992651f},
-std::array<float,2>{0.737301469f, 0.364405215f},
-std::array<float,2>{0.139291897f, 0.922575057f},
-std::array<float,2>{0.0621581115f, 0.497353405f},
-std::array<float,2>{0.541676998f, 0.831034303f},
-std::array<float,2>{0.828965127f, 0.0381035805f},
-std::array<float,2>{0.418709278f, 0.522704422f},
-std::array<float,2>{0.324252695f, 0.418572634f},
-std::array<float,2>{0.925324857f, 0.755462646f},
-std::array<float,2>{0.661591828f, 0.0682932884f},
-std::array<float,2>{0.213435084f, 0.599149287f},
-std::array<float,2>{0.116223834f, 0.214064404f},
-std::array<float,2>{0.611123741f, 0.694962859f},
-std::array<float,2>{0.786291063f, 0.30642432f},
-std::array<float,2>{0.450773686f, 0.962928891f},
-std::array<float,2>{0.382358879f, 0.0238310248f},
-std::array<float,2>{0.859401941f, 0.534149051f},
-std::array<float,2>{0.530107021f, 0.43783015f},
-std::array<float,2>{0.0300551448f, 0.861495495f},
-std::array<float,2>{0.178977221f, 0.31297487f},
-std::array<float,2>{0.689742625f, 0.889974236f},
-std::array<float,2>{0.958470345f, 0.146083578f},
-std::array<float,2>{0.308124721f, 0.673277497f},
-std::array<float,2>{0.365035027f, 0.297193378f},
-std::array<float,2>{0.883061767f, 0.956918001f},
-std::array<float,2>{0.639121354f, 0.208189741f},
-std::array<float,2>{0.22089529f, 0.697540343f},
-std::array<float,2>{0.0752846301f, 0.0767067671f},
-std::array<float,2>{0.574689984f, 0.603021502f},
-std::array<float,2>{0.760370195f, 0.410974562f},
-std::array<float,2>{0.479625255f, 0.760631621f},
-std::array<float,2>{0.410680264f, 0.154072896f},
-std::array<float,2>{0.836933553f, 0.68600601f},
-std::array<float,2>{0.533026338f, 0.326886714f},
-std::array<float,2>{0.0523900874f, 0.882150471f},
-std::array<float,2>{0.129565343f, 0.449366868f},
-std::array<float,2>{0.749210596f, 0.868711352f},
-std::array<float,2>{0.986319661f, 0.0178532805f},
-std::array<float,2>{0.274666965f, 0.539870381f},
-std::array<float,2>{0.44256404f, 0.381499082f},
-std::array<float,2>{0.792286277f, 0.811427772f},
-std::array<float,2>{0.622644007f, 0.10188359f},
-std::array<float,2>{0.118898571f, 0.56939888f},
-std::array<float,2>{0.207502499f, 0.223402992f},
-std::array<float,2>{0.665031314f, 0.743329406f},
-std::array<float,2>{0.931703568f, 0.27049467f},
-std::array<float,2>{0.313931674f, 0.989467382f},
-std::array<float,2>{0.302536279f, 0.0403114259f},
-std::array<float,2>{0.96775353f, 0.529358447f},
-std::array<float,2>{0.697604775f, 0.491006285f},
-std::array<float,2>{0.186998889f, 0.842171609f},
-std::array<float,2>{0.020140782f, 0.371871382f},
-std::array<float,2>{0.517977417f, 0.933123827f},
-std::array<float,2>{0.873724937f, 0.169352621f},
-std::array<float,2>{0.387969941f, 0.639321446f},
-std::array<float,2>{0.399276167f, 0.329884171f},
-std::array<float,2>{0.847652197f, 0.901658416f},
-std::array<float,2>{0.509799898f, 0.139909416f},
-std::array<float,2>{0.011579534f, 0.658188581f},
-std::array<float,2>{0.16237238f, 0.0028408994f},
-std::array<float,2>{0.717598081f, 0.552029729f},
-std::array<float,2>{0.952358961f, 0.465643346f},
-std::array<float,2>{0.286469012f, 0.858220756f},
-std::array<float,2>{0.339922935f, 0.188439295f},
-std::array<float,2>{0.918690324f, 0.714791358f},
-std::array<float,2>{0.672046602f, 0.292805135f},
-std::array<float,2>{0.202773347f, 0.947216868f},
-std::array<float,2>{0.0960934609f, 0.434631288f},
-std::array<float,2>{0.600729346f, 0.773834705f},
-std::array<float,2>{0.808879256f, 0.0808710158f},
-std::array<float,2>{0.460374892f, 0.615705431f},
-std::array<float,2>{0.255742252f, 0.46926558f},
-std::array<float,2>{0.976642013f, 0.821985722f},
-std::array<float,2>{0.727515042f, 0.0500845388f},
-std::array<float,2>{0.147761777f, 0.51180464f},
-std::array<float,2>{0.0421977602f, 0.173051551f},
-std::array<float,2>{0.557475626f, 0.645390928f},
-std::array<float,2>{0.815242767f, 0.350209385f},
-std::array<float,2>{0.432406068f, 0.908912838f},
-std::array<float,2>{0.492718905f, 0.113035068f},
-std::array<float,2>{0.768065929f, 0.588420987f},
-std::array<float,2>{0.5928545f, 0.391573519f},
-std::array<float,2>{0.0838632211f, 0.792814016f},
-std::array<float,2>{0.24462457f, 0.26233384f},
-std::array<float,2>{0.652774036f, 0.983564973f},
-std::array<float,2>{0.894216657f, 0.247093618f},
-std::array<float,2>{0.346099019f, 0.723844647f},
-std::array<float,2>{0.320722997f, 0.347426713f},
-std::array<float,2>{0.929050684f, 0.911193848f},
-std::array<float,2>{0.657584488f, 0.178783029f},
-std::array<float,2>{0.215042546f, 0.641105056f},
-std::array<float,2>{0.111924611f, 0.051702328f},
-std::array<float,2>{0.616134763f, 0.509101152f},
-std::array<float,2>{0.78366071f, 0.47270605f},
-std::array<float,2>{0.447830737f, 0.827642202f},
-std::array<float,2>{0.375243694f, 0.244234309f},
-std::array<float,2>{0.865108907f, 0.72137928f},
-std::array<float,2>{0.526741326f, 0.260274649f},
-std::array<float,2>{0.0239818506f, 0.978562772f},
-std::array<float,2>{0.172542408f, 0.396226585f},
-std::array<float,2>{0.69289279f, 0.793064892f},
-std::array<float,2>{0.95673579f, 0.115199998f},
-std::array<float,2>{0.309733421f, 0.591532886f},
-std::array<float,2>{0.468817055f, 0.462994188f},
-std::array<float,2>{0.756486535f, 0.852170527f},
-std::array<float,2>{0.564543247f, 0.00399175473f},
-std::array<float,2>{0.064089857f, 0.549824476f},
-std::array<float,2>{0.230268061f, 0.136109173f},
-std::array<float,2>{0.628191769f, 0.660999775f},
-std::array<float,2>{0.879875183f, 0.332398444f},
-std::array<float,2>{0.372895479f, 0.902403414f},
-std::array<float,2>{0.270087898f, 0.0833185688f},
-std::array<float,2>{0.994996846f, 0.60994935f},
-std::array<float,2>{0.739271283f, 0.430280864f},
-std::array<float,2>{0.132996395f, 0.777982473f},
-std::array<float,2>{0.0552302785f, 0.296698809f},
-std::array<float,2>{0.54490912f, 0.95105648f},
-std::array<float,2>{0.832893431f, 0.19166556f},
-std::array<float,2>{0.416767269f, 0.718229949f},
-std::array<float,2>{0.426818341f, 0.267439932f},
-std::array<float,2>{0.828119874f, 0.987016499f},
-std::array<float,2>{0.554575384f, 0.220436707f},
-std::array<float,2>{0.0378844142f, 0.746691763f},
-std::array<float,2>{0.153892428f, 0.108172014f},
-std::array<float,2>{0.724167824f, 0.565443039f},
-std::array<float,2>{0.970695496f, 0.377006471f},
-std::array<float,2>{0.261063933f, 0.806962609f},
-std::array<float,2>{0.355736762f, 0.164562315f},
-std::array<float,2>{0.905210912f, 0.633821607f},
-std::array<float,2>{0.645171106f, 0.367691457f},
-std::array<float,2>{0.240498692f, 0.935430288f},
-std::array<float,2>{0.0925142914f, 0.485340148f},
-std::array<float,2>{0.5840832f, 0.839683115f},
-std::array<float,2>{0.778939009f, 0.0445587896f},
-std::array<float,2>{0.491889298f, 0.524413943f},
-std::array<float,2>{0.295268923f, 0.407227576f},
-std::array<float,2>{0.941882253f, 0.76484704f},
-std::array<float,2>{0.703650773f, 0.0728846639f},
-std::array<float,2>{0.165886328f, 0.608178735f},
-std::array<float,2>{0.00658421265f, 0.203716293f},
-std::array<float,2>{0.50773263f, 0.701793075f},
-std::array<float,2>{0.853797674f, 0.301148891f},
-std::array<float,2>{0.391353905f, 0.959993005f},
-std::array<float,2>{0.468204528f, 0.0226357058f},
-std::array<float,2>{0.803421557f, 0.544798791f},
-std::array<float,2>{0.604839802f, 0.446466208f},
-std::array<float,2>{0.109139375f, 0.872040331f},
-std::array<float,2>{0.190795034f, 0.320627868f},
-std::array<float,2>{0.684565723f, 0.877104044f},
-std::array<float,2>{0.908546984f, 0.148842588f},
-std::array<float,2>{0.329235584f, 0.682060599f},
-std::array<float,2>{0.251535743f, 0.309510231f},
-std::array<float,2>{0.982014358f, 0.967323303f},
-std::array<float,2>{0.731976032f, 0.215312257f},
-std::array<float,2>{0.142981514f, 0.688088417f},
-std::array<float,2>{0.0462435186f, 0.0637261569f},
-std::array<float,2>{0.561011732f, 0.597557783f},
-std::array<float,2>{0.81768322f, 0.417467207f},
-std::array<float,2>{0.437000036f, 0.750443399f},
-std::array<float,2>{0.498900533f, 0.144338086f},
-std::array<float,2>{0.773093462f, 0.678428471f},
-std::array<float,2>{0.586621404f, 0.31883508f},
-std::array<float,2>{0.0781557485f, 0.8858307f},
-std::array<float,2>{0.248189077f, 0.442534536f},
-std::array<float,2>{0.651583135f, 0.864390731f},
-std::array<float,2>{0.894559383f, 0.0298517682f},
-std::array<float,2>{0.351153344f, 0.537947774f},
-std::array<float,2>{0.405768812f, 0.384019494f},
-std::array<float,2>{0.849101245f, 0.802748442f},
-std::array<float,2>{0.515254319f, 0.0950837135f},
-std::array<float,2>{0.0154259102f, 0.576700747f},
-std::array<float,2>{0.158793166f, 0.229970336f},
-std::array<float,2>{0.710975707f, 0.735164583f},
-std::array<float,2>{0.945420623f, 0.275667548f},
-std::array<float,2>{0.284553587f, 0.998850107f},
-std::array<float,2>{0.337385595f, 0.0321552418f},
-std::array<float,2>{0.917521954f, 0.518999159f},
-std::array<float,2>{0.676158369f, 0.493148476f},
-std::array<float,2>{0.197487414f, 0.835438192f},
-std::array<float,2>{0.10025233f, 0.363107592f},
-std::array<float,2>{0.59549731f, 0.927051306f},
-std::array<float,2>{0.807428539f, 0.164005339f},
-std::array<float,2>{0.454477817f, 0.627580881f},
-std::array<float,2>{0.437555015f, 0.342799544f},
-std::array<float,2>{0.79568547f, 0.897435308f},
-std::array<float,2>{0.618616819f, 0.125521719f},
-std::array<float,2>{0.123455115f, 0.66821754f},
-std::array<float,2>{0.204697549f, 0.015495236f},
-std::array<float,2>{0.668241739f, 0.55765146f},
-std::array<float,2>{0.933856547f, 0.457276583f},
-std::array<float,2>{0.320063382f, 0.846103191f},
-std::array<float,2>{0.29743889f, 0.19637993f},
-std::array<float,2>{0.962806284f, 0.706057429f},
-std::array<float,2>{0.701335609f, 0.284729272f},
-std::array<float,2>{0.181956336f, 0.937742591f},
-std::array<float,2>{0.016236065f, 0.422424406f},
-std::array<float,2>{0.520224273f, 0.772221208f},
-std::array<float,2>{0.86767298f, 0.0927053839f},
-std::array<float,2>{0.382898271f, 0.619185388f},
-std::array<float,2>{0.359894514f, 0.480927557f},
-std::array<float,2>{0.88985014f, 0.82014817f},
-std::array<float,2>{0.636713922f, 0.0556918159f},
-std::array<float,2>{0.22412543f, 0.501125574f},
-std::array<float,2>{0.0735889003f, 0.186143979f},
-std::array<float,2>{0.572404027f, 0.652573049f},
-std::array<float,2>{0.762083054f, 0.35228461f},
-std::array<float,2>{0.482519001f, 0.920423985f},
-std::array<float,2>{0.409753323f, 0.118866712f},
-std::array<float,2>{0.84260428f, 0.58439976f},
-std::array<float,2>{0.538835049f, 0.402056545f},
-std::array<float,2>{0.04741491f, 0.783859968f},
-std::array<float,2>{0.12575151f, 0.25660646f},
-std::array<float,2>{0.742190003f, 0.973504007f},
-std::array<float,2>{0.988283992f, 0.239616767f},
-std::array<float,2>{0.27928257f, 0.726903617f},
-std::array<float,2>{0.307149023f, 0.316150159f},
-std::array<float,2>{0.957753658f, 0.887766182f},
-std::array<float,2>{0.690856278f, 0.147437409f},
-std::array<float,2>{0.178660318f, 0.674595654f},
-std::array<float,2>{0.030852234f, 0.027004065f},
-std::array<float,2>{0.530886233f, 0.532331169f},
-std::array<float,2>{0.860731781f, 0.439797968f},
-std::array<float,2>{0.381137699f, 0.860111117f},
-std::array<float,2>{0.449374169f, 0.211781621f},
-std::array<float,2>{0.785606027f, 0.692477763f},
-std::array<float,2>{0.609390616f, 0.308202535f},
-std::array<float,2>{0.115802616f, 0.961997569f},
-std::array<float,2>{0.214684889f, 0.420177221f},
-std::array<float,2>{0.660749078f, 0.75696069f},
-std::array<float,2>{0.923882842f, 0.0696515292f},
-std::array<float,2>{0.325957894f, 0.600072443f},
-std::array<float,2>{0.419436842f, 0.498612285f},
-std::array<float,2>{0.829423547f, 0.828867137f},
-std::array<float,2>{0.54219836f, 0.0353890099f},
-std::array<float,2>{0.0606542528f, 0.520507812f},
-std::array<float,2>{0.140032217f, 0.158962429f},
-std::array<float,2>{0.737531304f, 0.630469978f},
-std::array<float,2>{0.997462809f, 0.365276009f},
-std::array<float,2>{0.266009003f, 0.925764143f},
-std::array<float,2>{0.370997518f, 0.100873411f},
-std::array<float,2>{0.877658904f, 0.573625922f},
-std::array<float,2>{0.63077879f, 0.387582719f},
-std::array<float,2>{0.231125563f, 0.797556579f},
-std::array<float,2>{0.0664293617f, 0.27819559f},
-std::array<float,2>{0.568149805f, 0.992221951f},
-std::array<float,2>{0.753154576f, 0.231791988f},
-std::array<float,2>{0.472729951f, 0.741189301f},
-std::array<float,2>{0.485486358f, 0.28785792f},
-std::array<float,2>{0.7769261f, 0.944173932f},
-std::array<float,2>{0.57885164f, 0.201247051f},
-std::array<float,2>{0.0895220637f, 0.709539294f},
-std::array<float,2>{0.23546727f, 0.0884393379f},
-std::array<float,2>{0.641836226f, 0.621672094f},
-std::array<float,2>{0.898674965f, 0.42808634f},
-std::array<float,2>{0.354860038f, 0.767999589f},
-std::array<float,2>{0.262466252f, 0.132040292f},
-std::array<float,2>{0.976541698f, 0.666707158f},
-std::array<float,2>{0.720355868f, 0.336890072f},
-std::array<float,2>{0.152313009f, 0.894513249f},
-std::array<float,2>{0.0332004055f, 0.455845356f},
-std::array<float,2>{0.54841131f, 0.847824097f},
-std::array<float,2>{0.822244585f, 0.010862465f},
-std::array<float,2>{0.422798306f, 0.559094012f},
-std::array<float,2>{0.334440023f, 0.40555495f},
-std::array<float,2>{0.910506487f, 0.787948966f},
-std::array<float,2>{0.682153046f, 0.123790495f},
-std::array<float,2>{0.192348689f, 0.581134975f},
-std::array<float,2>{0.103029862f, 0.234394252f},
-std::array<float,2>{0.608306587f, 0.734080017f},
-std::array<float,2>{0.798622012f, 0.251663476f},
-std::array<float,2>{0.463873506f, 0.972150564f},
-std::array<float,2>{0.396523416f, 0.0613368042f},
-std::array<float,2>{0.85798192f, 0.506728172f},
-std::array<float,2>{0.501996934f, 0.479119867f},
-std::array<float,2>{0.000546142051f, 0.816241562f},
-std::array<float,2>{0.171784014f, 0.35697037f},
-std::array<float,2>{0.708728909f, 0.916409492f},
-std::array<float,2>{0.939577937f, 0.183472872f},
-std::array<float,2>{0.290669173f, 0.650538862f},
-std::array<float,2>{0.347264349f, 0.265494406f},
-std::array<float,2>{0.893128932f, 0.981696725f},
-std::array<float,2>{0.654147327f, 0.24905625f},
-std::array<float,2>{0.245430812f, 0.724665463f},
-std::array<float,2>{0.0825404525f, 0.110639334f},
-std::array<float,2>{0.592494905f, 0.587836981f},
-std::array<float,2>{0.768834591f, 0.39416945f},
-std::array<float,2>{0.493925482f, 0.790989935f},
-std::array<float,2>{0.433254033f, 0.174194798f},
-std::array<float,2>{0.816010714f, 0.648196161f},
-std::array<float,2>{0.558016419f, 0.348010123f},
-std::array<float,2>{0.0410899557f, 0.906414092f},
-std::array<float,2>{0.147390217f, 0.470720083f},
-std::array<float,2>{0.728051186f, 0.822860181f},
-std::array<float,2>{0.978028238f, 0.0485519581f},
-std::array<float,2>{0.254475534f, 0.514137983f},
-std::array<float,2>{0.459630996f, 0.435634851f},
-std::array<float,2>{0.810380816f, 0.776605785f},
-std::array<float,2>{0.599764228f, 0.0795078501f},
-std::array<float,2>{0.0970227569f, 0.613686681f},
-std::array<float,2>{0.201622546f, 0.191210866f},
-std::array<float,2>{0.673333704f, 0.711872816f},
-std::array<float,2>{0.919636369f, 0.290207386f},
-std::array<float,2>{0.341698736f, 0.948365211f},
-std::array<float,2>{0.28608644f, 0.000113586568f},
-std::array<float,2>{0.951806009f, 0.553501666f},
-std::array<float,2>{0.718107879f, 0.466859132f},
-std::array<float,2>{0.163920417f, 0.857075274f},
-std::array<float,2>{0.010238573f, 0.330129176f},
-std::array<float,2>{0.511269629f, 0.89935708f},
-std::array<float,2>{0.845959663f, 0.137881786f},
-std::array<float,2>{0.399915904f, 0.659296334f},
-std::array<float,2>{0.387597412f, 0.374109268f},
-std::array<float,2>{0.87453568f, 0.930790603f},
-std::array<float,2>{0.519398689f, 0.171177521f},
-std::array<float,2>{0.0212711804f, 0.63730818f},
-std::array<float,2>{0.186071903f, 0.041772034f},
-std::array<float,2>{0.698718607f, 0.528501213f},
-std::array<float,2>{0.967796922f, 0.489932179f},
-std::array<float,2>{0.301519096f, 0.839968204f},
-std::array<float,2>{0.313019693f, 0.225338295f},
-std::array<float,2>{0.933267355f, 0.745037794f},
-std::array<float,2>{0.665495515f, 0.273362905f},
-std::array<float,2>{0.208314106f, 0.990845203f},
-std::array<float,2>{0.117355354f, 0.379858315f},
-std::array<float,2>{0.621522605f, 0.8099612f},
-std::array<float,2>{0.791420102f, 0.103650391f},
-std::array<float,2>{0.442359865f, 0.567980051f},
-std::array<float,2>{0.273653239f, 0.452571779f},
-std::array<float,2>{0.984981537f, 0.870664358f},
-std::array<float,2>{0.749000669f, 0.0158399213f},
-std::array<float,2>{0.130655617f, 0.542162955f},
-std::array<float,2>{0.0514633916f, 0.15593031f},
-std::array<float,2>{0.531434f, 0.68419224f},
-std::array<float,2>{0.836137354f, 0.325465977f},
-std::array<float,2>{0.411618263f, 0.880812526f},
-std::array<float,2>{0.478634f, 0.0750011355f},
-std::array<float,2>{0.76108855f, 0.605066478f},
-std::array<float,2>{0.575666964f, 0.414002031f},
-std::array<float,2>{0.0742404163f, 0.75907141f},
-std::array<float,2>{0.221913099f, 0.300772905f},
-std::array<float,2>{0.639830709f, 0.954606593f},
-std::array<float,2>{0.883845806f, 0.21029748f},
-std::array<float,2>{0.363457292f, 0.695807636f},
-std::array<float,2>{0.373496622f, 0.335277081f},
-std::array<float,2>{0.881762743f, 0.904861093f},
-std::array<float,2>{0.626504183f, 0.134444058f},
-std::array<float,2>{0.228231922f, 0.662869096f},
-std::array<float,2>{0.0648902655f, 0.00655389763f},
-std::array<float,2>{0.562992215f, 0.546966553f},
-std::array<float,2>{0.755500793f, 0.461006939f},
-std::array<float,2>{0.471242428f, 0.854525745f},
-std::array<float,2>{0.414845616f, 0.194520131f},
-std::array<float,2>{0.834047019f, 0.716497183f},
-std::array<float,2>{0.546576917f, 0.293275267f},
-std::array<float,2>{0.0569784604f, 0.951775491f},
-std::array<float,2>{0.136341617f, 0.432992101f},
-std::array<float,2>{0.741375029f, 0.781249642f},
-std::array<float,2>{0.994042516f, 0.0841371268f},
-std::array<float,2>{0.272920161f, 0.612275779f},
-std::array<float,2>{0.445948958f, 0.474638343f},
-std::array<float,2>{0.782610714f, 0.82500428f},
-std::array<float,2>{0.615201354f, 0.0534534939f},
-std::array<float,2>{0.109788552f, 0.510976315f},
-std::array<float,2>{0.217588499f, 0.176873624f},
-std::array<float,2>{0.6583848f, 0.643923283f},
-std::array<float,2>{0.927028f, 0.345396817f},
-std::array<float,2>{0.323898166f, 0.91211319f},
-std::array<float,2>{0.311165869f, 0.116224021f},
-std::array<float,2>{0.95355469f, 0.593208909f},
-std::array<float,2>{0.695060849f, 0.397974819f},
-std::array<float,2>{0.174430013f, 0.79553777f},
-std::array<float,2>{0.0260089654f, 0.257904261f},
-std::array<float,2>{0.524303615f, 0.978359461f},
-std::array<float,2>{0.865564287f, 0.243902102f},
-std::array<float,2>{0.377420545f, 0.719718277f},
-std::array<float,2>{0.393130958f, 0.302823991f},
-std::array<float,2>{0.853102744f, 0.957274497f},
-std::array<float,2>{0.503932178f, 0.205462441f},
-std::array<float,2>{0.00581147242f, 0.70083338f},
-std::array<float,2>{0.166362673f, 0.0718089119f},
-std::array<float,2>{0.706520617f, 0.606614292f},
-std::array<float,2>{0.944095552f, 0.410098583f},
-std::array<float,2>{0.294644833f, 0.762421668f},
-std::array<float,2>{0.330603957f, 0.152155042f},
-std::array<float,2>{0.907245874f, 0.680238187f},
-std::array<float,2>{0.685859978f, 0.322793841f},
-std::array<float,2>{0.187871486f, 0.875882328f},
-std::array<float,2>{0.107390173f, 0.449101597f},
-std::array<float,2>{0.603447139f, 0.874906301f},
-std::array<float,2>{0.800938606f, 0.0203150157f},
-std::array<float,2>{0.466286808f, 0.545772314f},
-std::array<float,2>{0.259202361f, 0.376747429f},
-std::array<float,2>{0.970791519f, 0.805675924f},
-std::array<float,2>{0.72600174f, 0.107026353f},
-std::array<float,2>{0.155397639f, 0.562807262f},
-std::array<float,2>{0.0352615491f, 0.220745444f},
-std::array<float,2>{0.551356435f, 0.748084009f},
-std::array<float,2>{0.82506448f, 0.268767208f},
-std::array<float,2>{0.427829683f, 0.98465097f},
-std::array<float,2>{0.48855707f, 0.0461063869f},
-std::array<float,2>{0.780054033f, 0.526020169f},
-std::array<float,2>{0.58207804f, 0.487182528f},
-std::array<float,2>{0.0903874114f, 0.836564302f},
-std::array<float,2>{0.238417625f, 0.369719237f},
-std::array<float,2>{0.646966636f, 0.937475026f},
-std::array<float,2>{0.904214799f, 0.167633533f},
-std::array<float,2>{0.358068138f, 0.636451721f},
-std::array<float,2>{0.282167315f, 0.274352312f},
-std::array<float,2>{0.948494375f, 0.996406794f},
-std::array<float,2>{0.714134395f, 0.227421612f},
-std::array<float,2>{0.157128558f, 0.737019598f},
-std::array<float,2>{0.0117847137f, 0.0974854827f},
-std::array<float,2>{0.512694538f, 0.575463057f},
-std::array<float,2>{0.850060344f, 0.385666966f},
-std::array<float,2>{0.403645247f, 0.801460862f},
-std::array<float,2>{0.456351489f, 0.160978034f},
-std::array<float,2>{0.804783821f, 0.626382232f},
-std::array<float,2>{0.596409023f, 0.360089868f},
-std::array<float,2>{0.0981651768f, 0.928484142f},
-std::array<float,2>{0.196377963f, 0.495721906f},
-std::array<float,2>{0.679055572f, 0.83391273f},
-std::array<float,2>{0.914841175f, 0.0335335545f},
-std::array<float,2>{0.338788927f, 0.516057789f},
-std::array<float,2>{0.433820039f, 0.415055424f},
-std::array<float,2>{0.819895625f, 0.753698707f},
-std::array<float,2>{0.559831142f, 0.0645287409f},
-std::array<float,2>{0.0431894287f, 0.593931317f},
-std::array<float,2>{0.142142907f, 0.218092486f},
-std::array<float,2>{0.733808935f, 0.689709723f},
-std::array<float,2>{0.983388066f, 0.31092298f},
-std::array<float,2>{0.252965301f, 0.965442002f},
-std::array<float,2>{0.347881615f, 0.0291488636f},
-std::array<float,2>{0.897040665f, 0.536045432f},
-std::array<float,2>{0.650367141f, 0.443620801f},
-std::array<float,2>{0.24632442f, 0.866270125f},
-std::array<float,2>{0.0814494342f, 0.317162603f},
-std::array<float,2>{0.588687718f, 0.883210063f},
-std::array<float,2>{0.770537436f, 0.142199188f},
-std::array<float,2>{0.496396869f, 0.676858783f},
-std::array<float,2>{0.482157767f, 0.353701472f},
-std::array<float,2>{0.764775574f, 0.918240666f},
-std::array<float,2>{0.57205534f, 0.185232818f},
-std::array<float,2>{0.0707018748f, 0.654420018f},
-std::array<float,2>{0.225662574f, 0.0585666224f},
-std::array<float,2>{0.633118093f, 0.503265917f},
-std::array<float,2>{0.886945546f, 0.482573777f},
-std::array<float,2>{0.362925321f, 0.816802561f},
-std::array<float,2>{0.280252159f, 0.241830528f},
-std::array<float,2>{0.991444826f, 0.730335772f},
-std::array<float,2>{0.744549572f, 0.255580366f},
-std::array<float,2>{0.128870785f, 0.976475894f},
-std::array<float,2>{0.0491707623f, 0.399689406f},
-std::array<float,2>{0.536333025f, 0.782573879f},
-std::array<float,2>{0.840820312f, 0.120375425f},
-std::array<float,2>{0.406880826f, 0.58227098f},
-std::array<float,2>{0.317545265f, 0.460264057f},
-std::array<float,2>{0.935641766f, 0.843927741f},
-std::array<float,2>{0.671497643f, 0.0129488762f},
-std::array<float,2>{0.20691736f, 0.555212021f},
-std::array<float,2>{0.12266957f, 0.128675833f},
-std::array<float,2>{0.619346142f, 0.671150625f},
-std::array<float,2>{0.793471634f, 0.340477556f},
-std::array<float,2>{0.440878034f, 0.896212578f},
-std::array<float,2>{0.385507166f, 0.0900287703f},
-std::array<float,2>{0.870803714f, 0.618921101f},
-std::array<float,2>{0.521691501f, 0.42413336f},
-std::array<float,2>{0.0177039113f, 0.769824505f},
-std::array<float,2>{0.180242404f, 0.281970561f},
-std::array<float,2>{0.699609339f, 0.940146506f},
-std::array<float,2>{0.963145852f, 0.198830798f},
-std::array<float,2>{0.299210459f, 0.704193115f},
-std::array<float,2>{0.267681599f, 0.363805979f},
-std::array<float,2>{0.999609351f, 0.923301816f},
-std::array<float,2>{0.736097395f, 0.156481504f},
-std::array<float,2>{0.138193533f, 0.632185578f},
-std::array<float,2>{0.059471786f, 0.037748307f},
-std::array<float,2>{0.53925252f, 0.522039115f},
-std::array<float,2>{0.830114245f, 0.496358246f},
-std::array<float,2>{0.420105815f, 0.831814051f},
-std::array<float,2>{0.47583583f, 0.232470304f},
-std::array<float,2>{0.751366436f, 0.739026546f},
-std::array<float,2>{0.569248676f, 0.279420406f},
-std::array<float,2>{0.0692772195f, 0.995224059f},
-std::array<float,2>{0.233645424f, 0.390140593f},
-std::array<float,2>{0.632416666f, 0.799667418f},
-std::array<float,2>{0.876398981f, 0.0978451893f},
-std::array<float,2>{0.367679268f, 0.572023749f},
-std::array<float,2>{0.379571229f, 0.438789159f},
-std::array<float,2>{0.862991095f, 0.862327039f},
-std::array<float,2>{0.528782547f, 0.0246722996f},
-std::array<float,2>{0.0280951615f, 0.534936607f},
-std::array<float,2>{0.176711351f, 0.144561768f},
-std::array<float,2>{0.689101756f, 0.67238307f},
-std::array<float,2>{0.960900784f, 0.313532293f},
-std::array<float,2>{0.305119812f, 0.889161944f},
-std::array<float,2>{0.327880532f, 0.0670455247f},
-std::array<float,2>{0.922770202f, 0.597748876f},
-std::array<float,2>{0.662274599f, 0.419327557f},
-std::array<float,2>{0.212408558f, 0.754452884f},
-std::array<float,2>{0.113557935f, 0.305288702f},
-std::array<float,2>{0.612448454f, 0.964760363f},
-std::array<float,2>{0.787958443f, 0.213157296f},
-std::array<float,2>{0.452744961f, 0.694040596f},
-std::array<float,2>{0.460975289f, 0.251966327f},
-std::array<float,2>{0.800745726f, 0.969254196f},
-std::array<float,2>{0.606354594f, 0.237986416f},
-std::array<float,2>{0.103690952f, 0.732157767f},
-std::array<float,2>{0.194868803f, 0.12159235f},
-std::array<float,2>{0.680259824f, 0.579607129f},
-std::array<float,2>{0.912740231f, 0.404194564f},
-std::array<float,2>{0.332564652f, 0.785678983f},
-std::array<float,2>{0.291183025f, 0.180132866f},
-std::array<float,2>{0.938060701f, 0.649075568f},
-std::array<float,2>{0.710440874f, 0.35916543f},
-std::array<float,2>{0.169033349f, 0.915393889f},
-std::array<float,2>{0.00259156036f, 0.477372348f},
-std::array<float,2>{0.501831889f, 0.812856913f},
-std::array<float,2>{0.855954468f, 0.0595567152f},
-std::array<float,2>{0.396472603f, 0.504082799f},
-std::array<float,2>{0.352146626f, 0.425905019f},
-std::array<float,2>{0.901118577f, 0.765927553f},
-std::array<float,2>{0.642689466f, 0.0874002501f},
-std::array<float,2>{0.238251328f, 0.623729467f},
-std::array<float,2>{0.0868739933f, 0.200503543f},
-std::array<float,2>{0.580769897f, 0.707325578f},
-std::array<float,2>{0.774906099f, 0.286740452f},
-std::array<float,2>{0.486935884f, 0.942708015f},
-std::array<float,2>{0.425017089f, 0.00826757587f},
-std::array<float,2>{0.823171139f, 0.562478483f},
-std::array<float,2>{0.549006045f, 0.454182804f},
-std::array<float,2>{0.0340620913f, 0.850093305f},
-std::array<float,2>{0.148972571f, 0.338251889f},
-std::array<float,2>{0.722536027f, 0.891910553f},
-std::array<float,2>{0.974064589f, 0.130836144f},
-std::array<float,2>{0.264311403f, 0.664271474f},
-std::array<float,2>{0.342364371f, 0.291876018f},
-std::array<float,2>{0.921171248f, 0.946232975f},
-std::array<float,2>{0.675539076f, 0.189052194f},
-std::array<float,2>{0.200763613f, 0.713643193f},
-std::array<float,2>{0.0951789171f, 0.0816732273f},
-std::array<float,2>{0.59849745f, 0.616359949f},
-std::array<float,2>{0.811088502f, 0.434356272f},
-std::array<float,2>{0.45879513f, 0.77506125f},
-std::array<float,2>{0.400399774f, 0.139029562f},
-std::array<float,2>{0.845384896f, 0.656844079f},
-std::array<float,2>{0.50861448f, 0.328201175f},
-std::array<float,2>{0.00974967796f, 0.901093841f},
-std::array<float,2>{0.161868259f, 0.466057181f},
-std::array<float,2>{0.71649766f, 0.858826637f},
-std::array<float,2>{0.950515747f, 0.00360140298f},
-std::array<float,2>{0.288716882f, 0.550788581f},
-std::array<float,2>{0.494581878f, 0.391628921f},
-std::array<float,2>{0.767517805f, 0.791355312f},
-std::array<float,2>{0.591535985f, 0.112124354f},
-std::array<float,2>{0.0855028555f, 0.589409828f},
-std::array<float,2>{0.244007319f, 0.246113509f},
-std::array<float,2>{0.656147659f, 0.723081172f},
-std::array<float,2>{0.891633391f, 0.263144732f},
-std::array<float,2>{0.344608814f, 0.983037591f},
-std::array<float,2>{0.256539375f, 0.0489385985f},
-std::array<float,2>{0.980140746f, 0.513282418f},
-std::array<float,2>{0.728671908f, 0.470370948f},
-std::array<float,2>{0.145229369f, 0.820941985f},
-std::array<float,2>{0.0396778323f, 0.350873441f},
-std::array<float,2>{0.555062711f, 0.910076082f},
-std::array<float,2>{0.81271553f, 0.17191045f},
-std::array<float,2>{0.431469917f, 0.645822227f},
-std::array<float,2>{0.413002908f, 0.327335626f},
-std::array<float,2>{0.838608921f, 0.881083786f},
-std::array<float,2>{0.53375721f, 0.152735204f},
-std::array<float,2>{0.0535656698f, 0.686568975f},
-std::array<float,2>{0.130899891f, 0.0190978143f},
-std::array<float,2>{0.746527374f, 0.540185452f},
-std::array<float,2>{0.986949146f, 0.450357109f},
-std::array<float,2>{0.277066916f, 0.867374361f},
-std::array<float,2>{0.367052615f, 0.207559079f},
-std::array<float,2>{0.886229098f, 0.69869417f},
-std::array<float,2>{0.638409853f, 0.298108011f},
-std::array<float,2>{0.220662892f, 0.955400229f},
-std::array<float,2>{0.0766216666f, 0.411971658f},
-std::array<float,2>{0.577311218f, 0.761351407f},
-std::array<float,2>{0.759576023f, 0.0778835416f},
-std::array<float,2>{0.4771595f, 0.601942062f},
-std::array<float,2>{0.304535151f, 0.491493613f},
-std::array<float,2>{0.965934515f, 0.8435601f},
-std::array<float,2>{0.696269333f, 0.0395400897f},
-std::array<float,2>{0.185446769f, 0.530459285f},
-std::array<float,2>{0.0232815072f, 0.168563157f},
-std::array<float,2>{0.515718341f, 0.640417039f},
-std::array<float,2>{0.871314228f, 0.37273559f},
-std::array<float,2>{0.389160216f, 0.932149649f},
-std::array<float,2>{0.444533974f, 0.10331893f},
-std::array<float,2>{0.789909482f, 0.5685004f},
-std::array<float,2>{0.624342918f, 0.381939828f},
-std::array<float,2>{0.119763158f, 0.812179625f},
-std::array<float,2>{0.210184738f, 0.271367878f},
-std::array<float,2>{0.667096555f, 0.98867029f},
-std::array<float,2>{0.930144608f, 0.224140748f},
-std::array<float,2>{0.316343874f, 0.742993116f},
-std::array<float,2>{0.34530893f, 0.347696841f},
-std::array<float,2>{0.890855849f, 0.906566024f},
-std::array<float,2>{0.654939055f, 0.173953429f},
-std::array<float,2>{0.242351964f, 0.647990406f},
-std::array<float,2>{0.0841926485f, 0.0488053709f},
-std::array<float,2>{0.59007591f, 0.51379621f},
-std::array<float,2>{0.765662968f, 0.471066952f},
-std::array<float,2>{0.495930701f, 0.823022842f},
-std::array<float,2>{0.429729581f, 0.249335051f},
-std::array<float,2>{0.814171553f, 0.725075841f},
-std::array<float,2>{0.556126475f, 0.265161246f},
-std::array<float,2>{0.0408995748f, 0.981670022f},
-std::array<float,2>{0.146448642f, 0.394354373f},
-std::array<float,2>{0.729627669f, 0.790572524f},
-std::array<float,2>{0.9790501f, 0.110428289f},
-std::array<float,2>{0.257183939f, 0.587620735f},
-std::array<float,2>{0.457231909f, 0.467124909f},
-std::array<float,2>{0.811569691f, 0.857277095f},
-std::array<float,2>{0.599046886f, 0.000475187378f},
-std::array<float,2>{0.0946556926f, 0.553456128f},
-std::array<float,2>{0.199541584f, 0.138078719f},
-std::array<float,2>{0.674571455f, 0.659447074f},
-std::array<float,2>{0.920015395f, 0.330444902f},
-std::array<float,2>{0.343105584f, 0.898983717f},
-std::array<float,2>{0.287532985f, 0.0793154538f},
-std::array<float,2>{0.949459374f, 0.613399267f},
-std::array<float,2>{0.715704083f, 0.435810059f},
-std::array<float,2>{0.160365313f, 0.77677536f},
-std::array<float,2>{0.0083715748f, 0.290320337f},
-std::array<float,2>{0.509335995f, 0.948620141f},
-std::array<float,2>{0.844314575f, 0.191097632f},
-std::array<float,2>{0.402229846f, 0.711467922f},
-std::array<float,2>{0.390588552f, 0.272985101f},
-std::array<float,2>{0.872329712f, 0.991149783f},
-std::array<float,2>{0.517288387f, 0.225579843f},
-std::array<float,2>{0.0216150675f, 0.744718373f},
-std::array<float,2>{0.184154227f, 0.10388606f},
-std::array<float,2>{0.696533144f, 0.568348229f},
-std::array<float,2>{0.965275347f, 0.3796134f},
-std::array<float,2>{0.303424716f, 0.809814155f},
-std::array<float,2>{0.314496398f, 0.1710843f},
-std::array<float,2>{0.930856407f, 0.637559235f},
-std::array<float,2>{0.666552067f, 0.374488056f},
-std::array<float,2>{0.209681451f, 0.930966973f},
-std::array<float,2>{0.120501272f, 0.490170211f},
-std::array<float,2>{0.623431802f, 0.840093851f},
-std::array<float,2>{0.79069525f, 0.0417346582f},
-std::array<float,2>{0.443464071f, 0.528633952f},
-std::array<float,2>{0.276147604f, 0.413657129f},
-std::array<float,2>{0.988202393f, 0.758971155f},
-std::array<float,2>{0.747793794f, 0.0749122873f},
-std::array<float,2>{0.132084206f, 0.605449677f},
-std::array<float,2>{0.0539898053f, 0.210059822f},
-std::array<float,2>{0.534606755f, 0.696262121f},
-std::array<float,2>{0.839776635f, 0.30040729f},
-std::array<float,2>{0.413971096f, 0.954976141f},
-std::array<float,2>{0.477799088f, 0.0159562826f},
-std::array<float,2>{0.758782804f, 0.542340696f},
-std::array<float,2>{0.576413512f, 0.452241927f},
-std::array<float,2>{0.0772760436f, 0.87100178f},
-std::array<float,2>{0.219234675f, 0.325231105f},
-std::array<float,2>{0.637037277f, 0.880442441f},
-std::array<float,2>{0.885616004f, 0.156138361f},
-std::array<float,2>{0.366165698f, 0.684331059f},
-std::array<float,2>{0.305986404f, 0.30841291f},
-std::array<float,2>{0.959375501f, 0.96218884f},
-std::array<float,2>{0.688325644f, 0.211546481f},
-std::array<float,2>{0.176774979f, 0.692815781f},
-std::array<float,2>{0.0284437817f, 0.069342345f},
-std::array<float,2>{0.52787286f, 0.599847555f},
-std::array<float,2>{0.862130165f, 0.420059115f},
-std::array<float,2>{0.380216926f, 0.757238388f},
-std::array<float,2>{0.452020556f, 0.147018746f},
-std::array<float,2>{0.788231909f, 0.674390793f},
-std::array<float,2>{0.612107813f, 0.31637463f},
-std::array<float,2>{0.114521079f, 0.88807112f},
-std::array<float,2>{0.211380079f, 0.439460963f},
-std::array<float,2>{0.663382411f, 0.860078871f},
-std::array<float,2>{0.92380774f, 0.0272704177f},
-std::array<float,2>{0.326193482f, 0.532531679f},
-std::array<float,2>{0.421176225f, 0.38733232f},
-std::array<float,2>{0.831083179f, 0.797634482f},
-std::array<float,2>{0.540481746f, 0.10059268f},
-std::array<float,2>{0.0602071956f, 0.573254883f},
-std::array<float,2>{0.136859745f, 0.231672406f},
-std::array<float,2>{0.734433115f, 0.740864933f},
-std::array<float,2>{0.99854964f, 0.27807048f},
-std::array<float,2>{0.269435883f, 0.992456555f},
-std::array<float,2>{0.368876845f, 0.0355471373f},
-std::array<float,2>{0.875070453f, 0.520782351f},
-std::array<float,2>{0.631238222f, 0.498844177f},
-std::array<float,2>{0.233162314f, 0.828718305f},
-std::array<float,2>{0.0693378821f, 0.365581572f},
-std::array<float,2>{0.569472492f, 0.92546159f},
-std::array<float,2>{0.750942886f, 0.158731759f},
-std::array<float,2>{0.475010931f, 0.630811274f},
-std::array<float,2>{0.487921596f, 0.336652994f},
-std::array<float,2>{0.774001777f, 0.894228756f},
-std::array<float,2>{0.58197701f, 0.132108673f},
-std::array<float,2>{0.087792404f, 0.666768789f},
-std::array<float,2>{0.236505136f, 0.011035799f},
-std::array<float,2>{0.644050658f, 0.559536636f},
-std::array<float,2>{0.901804149f, 0.455648899f},
-std::array<float,2>{0.353194714f, 0.84810859f},
-std::array<float,2>{0.265598089f, 0.201466009f},
-std::array<float,2>{0.972741187f, 0.709774971f},
-std::array<float,2>{0.721082926f, 0.287629038f},
-std::array<float,2>{0.14965494f, 0.943871975f},
-std::array<float,2>{0.0350456648f, 0.427829444f},
-std::array<float,2>{0.55047828f, 0.767592907f},
-std::array<float,2>{0.823611259f, 0.0888121128f},
-std::array<float,2>{0.424041748f, 0.621838272f},
-std::array<float,2>{0.333266288f, 0.479457647f},
-std::array<float,2>{0.913689852f, 0.816009045f},
-std::array<float,2>{0.681163967f, 0.0611895435f},
-std::array<float,2>{0.193857536f, 0.506407201f},
-std::array<float,2>{0.104610734f, 0.183190346f},
-std::array<float,2>{0.607229412f, 0.650686979f},
-std::array<float,2>{0.799477935f, 0.357344627f},
-std::array<float,2>{0.462170035f, 0.916097522f},
-std::array<float,2>{0.394885808f, 0.123661339f},
-std::array<float,2>{0.857256055f, 0.581359506f},
-std::array<float,2>{0.500949919f, 0.405433595f},
-std::array<float,2>{0.00324903638f, 0.787694335f},
-std::array<float,2>{0.16850394f, 0.251730949f},
-std::array<float,2>{0.709166348f, 0.971810579f},
-std::array<float,2>{0.939204812f, 0.234841421f},
-std::array<float,2>{0.292528868f, 0.734280527f},
-std::array<float,2>{0.252144337f, 0.318574965f},
-std::array<float,2>{0.984210491f, 0.88603431f},
-std::array<float,2>{0.732492328f, 0.144143641f},
-std::array<float,2>{0.141466767f, 0.678567708f},
-std::array<float,2>{0.0440995656f, 0.0301283915f},
-std::array<float,2>{0.558985293f, 0.537680984f},
-std::array<float,2>{0.818995178f, 0.4428626f},
-std::array<float,2>{0.434681475f, 0.864721417f},
-std::array<float,2>{0.49773559f, 0.214853734f},
-std::array<float,2>{0.769929647f, 0.68843329f},
-std::array<float,2>{0.589293957f, 0.309162766f},
-std::array<float,2>{0.0810081735f, 0.967733562f},
-std::array<float,2>{0.247716263f, 0.41717723f},
-std::array<float,2>{0.649220169f, 0.750109971f},
-std::array<float,2>{0.897729993f, 0.0637159199f},
-std::array<float,2>{0.348708272f, 0.597215235f},
-std::array<float,2>{0.402600557f, 0.492751539f},
-std::array<float,2>{0.850746572f, 0.835029781f},
-std::array<float,2>{0.513184428f, 0.0319408625f},
-std::array<float,2>{0.0128435204f, 0.518792272f},
-std::array<float,2>{0.158096865f, 0.163715899f},
-std::array<float,2>{0.71368587f, 0.627875566f},
-std::array<float,2>{0.947630346f, 0.362826765f},
-std::array<float,2>{0.282428861f, 0.926996529f},
-std::array<float,2>{0.339063227f, 0.0948984846f},
-std::array<float,2>{0.915528655f, 0.576950908f},
-std::array<float,2>{0.678466141f, 0.384214789f},
-std::array<float,2>{0.195390239f, 0.803056955f},
-std::array<float,2>{0.0992489755f, 0.27559194f},
-std::array<float,2>{0.596844733f, 0.998671234f},
-std::array<float,2>{0.805983603f, 0.229502141f},
-std::array<float,2>{0.455583036f, 0.734997094f},
-std::array<float,2>{0.440384954f, 0.285148352f},
-std::array<float,2>{0.79486078f, 0.937962592f},
-std::array<float,2>{0.62074393f, 0.196538359f},
-std::array<float,2>{0.122024611f, 0.706418216f},
-std::array<float,2>{0.205790162f, 0.0923901945f},
-std::array<float,2>{0.670767903f, 0.619595945f},
-std::array<float,2>{0.937214375f, 0.422710627f},
-std::array<float,2>{0.317329556f, 0.772138357f},
-std::array<float,2>{0.299928933f, 0.125771001f},
-std::array<float,2>{0.964069843f, 0.668050349f},
-std::array<float,2>{0.700389862f, 0.3431997f},
-std::array<float,2>{0.18081224f, 0.897078216f},
-std::array<float,2>{0.0191471931f, 0.457112759f},
-std::array<float,2>{0.523388982f, 0.845867634f},
-std::array<float,2>{0.86986798f, 0.015319854f},
-std::array<float,2>{0.386623561f, 0.557988524f},
-std::array<float,2>{0.361668229f, 0.402212203f},
-std::array<float,2>{0.888654113f, 0.783963919f},
-std::array<float,2>{0.634730875f, 0.11905624f},
-std::array<float,2>{0.225447953f, 0.584205806f},
-std::array<float,2>{0.0714522749f, 0.23944512f},
-std::array<float,2>{0.570844471f, 0.726641595f},
-std::array<float,2>{0.764470518f, 0.256542087f},
-std::array<float,2>{0.481253535f, 0.973295987f},
-std::array<float,2>{0.407729745f, 0.0560988821f},
-std::array<float,2>{0.839985669f, 0.501459122f},
-std::array<float,2>{0.53606379f, 0.480572194f},
-std::array<float,2>{0.0500320271f, 0.820046782f},
-std::array<float,2>{0.127228484f, 0.352320284f},
-std::array<float,2>{0.745344758f, 0.920882046f},
-std::array<float,2>{0.990891516f, 0.186412066f},
-std::array<float,2>{0.280510426f, 0.65274179f},
-std::array<float,2>{0.32260561f, 0.260618001f},
-std::array<float,2>{0.926039636f, 0.978953779f},
-std::array<float,2>{0.659464538f, 0.24440372f},
-std::array<float,2>{0.218626678f, 0.721600294f},
-std::array<float,2>{0.11122065f, 0.114925742f},
-std::array<float,2>{0.613822639f, 0.59157598f},
-std::array<float,2>{0.782177925f, 0.396344006f},
-std::array<float,2>{0.446626782f, 0.793231547f},
-std::array<float,2>{0.378609151f, 0.179030746f},
-std::array<float,2>{0.866844773f, 0.640694976f},
-std::array<float,2>{0.524519563f, 0.347252578f},
-std::array<float,2>{0.0264744908f, 0.911435604f},
-std::array<float,2>{0.175038397f, 0.473080277f},
-std::array<float,2>{0.694219112f, 0.828109324f},
-std::array<float,2>{0.95498085f, 0.051464323f},
-std::array<float,2>{0.31188184f, 0.508846045f},
-std::array<float,2>{0.472159028f, 0.430495888f},
-std::array<float,2>{0.754415452f, 0.778235078f},
-std::array<float,2>{0.56396693f, 0.0830945894f},
-std::array<float,2>{0.066146329f, 0.610347509f},
-std::array<float,2>{0.226924062f, 0.191607416f},
-std::array<float,2>{0.625883102f, 0.717910409f},
-std::array<float,2>{0.88222605f, 0.296428025f},
-std::array<float,2>{0.374448895f, 0.950794756f},
-std::array<float,2>{0.272162348f, 0.00428063655f},
-std::array<float,2>{0.992893994f, 0.55028075f},
-std::array<float,2>{0.740516305f, 0.463292897f},
-std::array<float,2>{0.135729194f, 0.852486849f},
-std::array<float,2>{0.0584784783f, 0.332176745f},
-std::array<float,2>{0.54551661f, 0.902666092f},
-std::array<float,2>{0.835911214f, 0.135874927f},
-std::array<float,2>{0.415112466f, 0.660796821f},
-std::array<float,2>{0.429093987f, 0.368094385f},
-std::array<float,2>{0.825966299f, 0.935135841f},
-std::array<float,2>{0.552305281f, 0.16486381f},
-std::array<float,2>{0.0368535891f, 0.634209454f},
-std::array<float,2>{0.154701501f, 0.0448222011f},
-std::array<float,2>{0.725358546f, 0.524080455f},
-std::array<float,2>{0.972117186f, 0.48493582f},
-std::array<float,2>{0.257899702f, 0.839456677f},
-std::array<float,2>{0.358462304f, 0.220683336f},
-std::array<float,2>{0.903083324f, 0.746916831f},
-std::array<float,2>{0.647617102f, 0.267170459f},
-std::array<float,2>{0.239436209f, 0.987148821f},
-std::array<float,2>{0.0910627469f, 0.377323896f},
-std::array<float,2>{0.583661497f, 0.806672633f},
-std::array<float,2>{0.780346036f, 0.108113818f},
-std::array<float,2>{0.489341855f, 0.565856278f},
-std::array<float,2>{0.293171197f, 0.446700096f},
-std::array<float,2>{0.944696307f, 0.871754229f},
-std::array<float,2>{0.705683529f, 0.0227132086f},
-std::array<float,2>{0.16796653f, 0.544522464f},
-std::array<float,2>{0.0045473855f, 0.148517102f},
-std::array<float,2>{0.505208433f, 0.681737065f},
-std::array<float,2>{0.852298558f, 0.320483148f},
-std::array<float,2>{0.393830538f, 0.877306879f},
-std::array<float,2>{0.465273499f, 0.0730870888f},
-std::array<float,2>{0.802502096f, 0.607911527f},
-std::array<float,2>{0.602416813f, 0.407632083f},
-std::array<float,2>{0.105483949f, 0.765041471f},
-std::array<float,2>{0.189296573f, 0.300784975f},
-std::array<float,2>{0.68697226f, 0.960205615f},
-std::array<float,2>{0.906870127f, 0.203873113f},
-std::array<float,2>{0.331663281f, 0.701945841f},
-std::array<float,2>{0.340683371f, 0.328579009f},
-std::array<float,2>{0.918456256f, 0.901261568f},
-std::array<float,2>{0.672814846f, 0.138907209f},
-std::array<float,2>{0.202378973f, 0.657036901f},
-std::array<float,2>{0.0964640826f, 0.00384015776f},
-std::array<float,2>{0.601345062f, 0.551143587f},
-std::array<float,2>{0.809111297f, 0.466256529f},
-std::array<float,2>{0.460641593f, 0.858488977f},
-std::array<float,2>{0.398439735f, 0.189328149f},
-std::array<float,2>{0.8470276f, 0.713544309f},
-std::array<float,2>{0.510462165f, 0.291642845f},
-std::array<float,2>{0.0108358217f, 0.945983529f},
-std::array<float,2>{0.162808195f, 0.434149355f},
-std::array<float,2>{0.71682781f, 0.775342882f},
-std::array<float,2>{0.952651322f, 0.0818608627f},
-std::array<float,2>{0.286899954f, 0.616614342f},
-std::array<float,2>{0.492471278f, 0.470527619f},
-std::array<float,2>{0.768269241f, 0.821145594f},
-std::array<float,2>{0.593429625f, 0.0492811576f},
-std::array<float,2>{0.0832827017f, 0.513664424f},
-std::array<float,2>{0.244700283f, 0.17229864f},
-std::array<float,2>{0.65290308f, 0.645587921f},
-std::array<float,2>{0.893773258f, 0.350670159f},
-std::array<float,2>{0.346525878f, 0.909836233f},
-std::array<float,2>{0.255356729f, 0.111972809f},
-std::array<float,2>{0.977405429f, 0.58983773f},
-std::array<float,2>{0.72689563f, 0.392054349f},
-std::array<float,2>{0.148005128f, 0.791131139f},
-std::array<float,2>{0.0425701961f, 0.262703598f},
-std::array<float,2>{0.55707854f, 0.983187616f},
-std::array<float,2>{0.814608514f, 0.246573105f},
-std::array<float,2>{0.431894004f, 0.722836792f},
-std::array<float,2>{0.410635442f, 0.297858506f},
-std::array<float,2>{0.837520123f, 0.955139935f},
-std::array<float,2>{0.5324682f, 0.207976863f},
-std::array<float,2>{0.0518949442f, 0.698453367f},
-std::array<float,2>{0.129353359f, 0.0778215975f},
-std::array<float,2>{0.749869168f, 0.601605713f},
-std::array<float,2>{0.985547602f, 0.411758929f},
-std::array<float,2>{0.275315523f, 0.761559367f},
-std::array<float,2>{0.364657074f, 0.152524203f},
-std::array<float,2>{0.883643866f, 0.686825097f},
-std::array<float,2>{0.639438629f, 0.327595472f},
-std::array<float,2>{0.221364036f, 0.88127768f},
-std::array<float,2>{0.0759875849f, 0.450525641f},
-std::array<float,2>{0.574901044f, 0.867607057f},
-std::array<float,2>{0.759793639f, 0.019330645f},
-std::array<float,2>{0.480294198f, 0.540454865f},
-std::array<float,2>{0.302202851f, 0.382214695f},
-std::array<float,2>{0.967102051f, 0.81240201f},
-std::array<float,2>{0.697975039f, 0.103125036f},
-std::array<float,2>{0.187242776f, 0.568671703f},
-std::array<float,2>{0.0197635237f, 0.224454045f},
-std::array<float,2>{0.518174648f, 0.742679775f},
-std::array<float,2>{0.873456001f, 0.271199942f},
-std::array<float,2>{0.388345748f, 0.988462269f},
-std::array<float,2>{0.443213075f, 0.0391416252f},
-std::array<float,2>{0.792873144f, 0.530687809f},
-std::array<float,2>{0.622328877f, 0.491330624f},
-std::array<float,2>{0.118542545f, 0.843439579f},
-std::array<float,2>{0.207662567f, 0.372943342f},
-std::array<float,2>{0.664460599f, 0.932510555f},
-std::array<float,2>{0.932322919f, 0.168783024f},
-std::array<float,2>{0.313973278f, 0.640233517f},
-std::array<float,2>{0.266921163f, 0.279577464f},
-std::array<float,2>{0.996995568f, 0.9954018f},
-std::array<float,2>{0.736416399f, 0.23281078f},
-std::array<float,2>{0.139097914f, 0.739001453f},
-std::array<float,2>{0.061694786f, 0.0979093164f},
-std::array<float,2>{0.541168511f, 0.571924031f},
-std::array<float,2>{0.828191817f, 0.390403241f},
-std::array<float,2>{0.418329895f, 0.799345553f},
-std::array<float,2>{0.474435031f, 0.15658614f},
-std::array<float,2>{0.752716124f, 0.631897211f},
-std::array<float,2>{0.566998243f, 0.364042461f},
-std::array<float,2>{0.0676464811f, 0.923059881f},
-std::array<float,2>{0.231588602f, 0.496310502f},
-std::array<float,2>{0.628930151f, 0.831716359f},
-std::array<float,2>{0.878861427f, 0.0378511325f},
-std::array<float,2>{0.370073706f, 0.522300303f},
-std::array<float,2>{0.382021666f, 0.419046581f},
-std::array<float,2>{0.860259652f, 0.754749775f},
-std::array<float,2>{0.529448211f, 0.0671986565f},
-std::array<float,2>{0.0295174401f, 0.597938716f},
-std::array<float,2>{0.179210484f, 0.212956786f},
-std::array<float,2>{0.690158427f, 0.694219768f},
-std::array<float,2>{0.95874685f, 0.305602401f},
-std::array<float,2>{0.307881862f, 0.964516699f},
-std::array<float,2>{0.324839979f, 0.0244633351f},
-std::array<float,2>{0.925132751f, 0.534887314f},
-std::array<float,2>{0.662070513f, 0.438701868f},
-std::array<float,2>{0.213345364f, 0.862600863f},
-std::array<float,2>{0.117139734f, 0.313774407f},
-std::array<float,2>{0.610429049f, 0.889570951f},
-std::array<float,2>{0.78681469f, 0.144977435f},
-std::array<float,2>{0.45035252f, 0.672723591f},
-std::array<float,2>{0.462967187f, 0.358985811f},
-std::array<float,2>{0.797465742f, 0.915104389f},
-std::array<float,2>{0.609130919f, 0.179705694f},
-std::array<float,2>{0.101625279f, 0.649369121f},
-std::array<float,2>{0.193096161f, 0.059130013f},
-std::array<float,2>{0.683227003f, 0.504317522f},
-std::array<float,2>{0.911399841f, 0.47721681f},
-std::array<float,2>{0.335539639f, 0.812617123f},
-std::array<float,2>{0.289799541f, 0.238233954f},
-std::array<float,2>{0.940967739f, 0.732307673f},
-std::array<float,2>{0.707195342f, 0.252426147f},
-std::array<float,2>{0.170277491f, 0.969672978f},
-std::array<float,2>{0.00099777407f, 0.403875709f},
-std::array<float,2>{0.503890693f, 0.786036432f},
-std::array<float,2>{0.858732164f, 0.121866331f},
-std::array<float,2>{0.398373365f, 0.579879165f},
-std::array<float,2>{0.3540425f, 0.454438508f},
-std::array<float,2>{0.899728715f, 0.849705398f},
-std::array<float,2>{0.640893519f, 0.00781733543f},
-std::array<float,2>{0.23503907f, 0.562048137f},
-std::array<float,2>{0.0885032192f, 0.130589887f},
-std::array<float,2>{0.579994619f, 0.664426446f},
-std::array<float,2>{0.775823236f, 0.33799234f},
-std::array<float,2>{0.484884739f, 0.891718566f},
-std::array<float,2>{0.423256844f, 0.0870489553f},
-std::array<float,2>{0.82046479f, 0.623838305f},
-std::array<float,2>{0.547500491f, 0.426202208f},
-std::array<float,2>{0.0317723751f, 0.765737414f},
-std::array<float,2>{0.151238993f, 0.287064672f},
-std::array<float,2>{0.719518661f, 0.942607045f},
-std::array<float,2>{0.974906325f, 0.200208738f},
-std::array<float,2>{0.262944281f, 0.707259297f},
-std::array<float,2>{0.283619195f, 0.360208273f},
-std::array<float,2>{0.947211325f, 0.928249419f},
-std::array<float,2>{0.71255976f, 0.160674304f},
-std::array<float,2>{0.159683302f, 0.625989139f},
-std::array<float,2>{0.0141554112f, 0.0334189758f},
-std::array<float,2>{0.514600396f, 0.515654981f},
-std::array<float,2>{0.848235309f, 0.495884418f},
-std::array<float,2>{0.405141652f, 0.833615661f},
-std::array<float,2>{0.453986168f, 0.227144286f},
-std::array<float,2>{0.807954431f, 0.737238407f},
-std::array<float,2>{0.594417095f, 0.273946971f},
-std::array<float,2>{0.100637592f, 0.996299088f},
-std::array<float,2>{0.198503166f, 0.385454863f},
-std::array<float,2>{0.677091479f, 0.801672816f},
-std::array<float,2>{0.916711152f, 0.0972025469f},
-std::array<float,2>{0.33687681f, 0.575370371f},
-std::array<float,2>{0.436404586f, 0.443390787f},
-std::array<float,2>{0.817051411f, 0.866559625f},
-std::array<float,2>{0.56162411f, 0.0290182475f},
-std::array<float,2>{0.0451354049f, 0.535838425f},
-std::array<float,2>{0.144373089f, 0.142352015f},
-std::array<float,2>{0.730843484f, 0.677084863f},
-std::array<float,2>{0.981368363f, 0.31693849f},
-std::array<float,2>{0.2503663f, 0.88291043f},
-std::array<float,2>{0.350258827f, 0.064938657f},
-std::array<float,2>{0.895855844f, 0.594169796f},
-std::array<float,2>{0.651101351f, 0.41551134f},
-std::array<float,2>{0.249785885f, 0.753564894f},
-std::array<float,2>{0.0797340646f, 0.310776263f},
-std::array<float,2>{0.587376297f, 0.965814829f},
-std::array<float,2>{0.771765471f, 0.217831925f},
-std::array<float,2>{0.499730855f, 0.689500034f},
-std::array<float,2>{0.484143883f, 0.255715787f},
-std::array<float,2>{0.762926459f, 0.976087332f},
-std::array<float,2>{0.574213326f, 0.24214223f},
-std::array<float,2>{0.0722671002f, 0.729985833f},
-std::array<float,2>{0.223084196f, 0.120192185f},
-std::array<float,2>{0.635466337f, 0.58242166f},
-std::array<float,2>{0.889034629f, 0.399438411f},
-std::array<float,2>{0.360676736f, 0.782354057f},
-std::array<float,2>{0.277463526f, 0.185303703f},
-std::array<float,2>{0.989864469f, 0.65476805f},
-std::array<float,2>{0.743207812f, 0.35389024f},
-std::array<float,2>{0.126330867f, 0.918143213f},
-std::array<float,2>{0.0481042229f, 0.482810706f},
-std::array<float,2>{0.537965178f, 0.816471517f},
-std::array<float,2>{0.843253732f, 0.0583301038f},
-std::array<float,2>{0.408384979f, 0.503113449f},
-std::array<float,2>{0.319004297f, 0.424028009f},
-std::array<float,2>{0.934664428f, 0.769546509f},
-std::array<float,2>{0.669284821f, 0.0901908204f},
-std::array<float,2>{0.203530088f, 0.618751764f},
-std::array<float,2>{0.124170959f, 0.199177548f},
-std::array<float,2>{0.618137479f, 0.704464912f},
-std::array<float,2>{0.796847463f, 0.282095969f},
-std::array<float,2>{0.438969702f, 0.940186381f},
-std::array<float,2>{0.384505749f, 0.0128646651f},
-std::array<float,2>{0.868398964f, 0.555625558f},
-std::array<float,2>{0.521359086f, 0.459963173f},
-std::array<float,2>{0.0173445344f, 0.844230115f},
-std::array<float,2>{0.183416247f, 0.340737849f},
-std::array<float,2>{0.702412426f, 0.896414995f},
-std::array<float,2>{0.961461604f, 0.128526688f},
-std::array<float,2>{0.29798618f, 0.670932889f},
-std::array<float,2>{0.371547282f, 0.293095618f},
-std::array<float,2>{0.880286634f, 0.952059448f},
-std::array<float,2>{0.627336085f, 0.194707975f},
-std::array<float,2>{0.228797585f, 0.716754615f},
-std::array<float,2>{0.0634545609f, 0.08438728f},
-std::array<float,2>{0.565629065f, 0.611860812f},
-std::array<float,2>{0.757484913f, 0.432759911f},
-std::array<float,2>{0.469730735f, 0.78083992f},
-std::array<float,2>{0.417938799f, 0.134741709f},
-std::array<float,2>{0.833706021f, 0.662732124f},
-std::array<float,2>{0.543783784f, 0.33497566f},
-std::array<float,2>{0.0564606488f, 0.90514034f},
-std::array<float,2>{0.133910313f, 0.461185426f},
-std::array<float,2>{0.738780558f, 0.854936957f},
-std::array<float,2>{0.995758295f, 0.00682946434f},
-std::array<float,2>{0.270583719f, 0.547155082f},
-std::array<float,2>{0.448871523f, 0.398314655f},
-std::array<float,2>{0.784871936f, 0.795680046f},
-std::array<float,2>{0.616436899f, 0.116525233f},
-std::array<float,2>{0.112381063f, 0.592897534f},
-std::array<float,2>{0.21623303f, 0.24372752f},
-std::array<float,2>{0.656773508f, 0.719293237f},
-std::array<float,2>{0.928295255f, 0.25826028f},
-std::array<float,2>{0.321789235f, 0.978114128f},
-std::array<float,2>{0.309390813f, 0.0536889657f},
-std::array<float,2>{0.9556427f, 0.511160731f},
-std::array<float,2>{0.691668153f, 0.475055099f},
-std::array<float,2>{0.173752621f, 0.824802697f},
-std::array<float,2>{0.0248321407f, 0.345656723f},
-std::array<float,2>{0.525939703f, 0.91243118f},
-std::array<float,2>{0.863444388f, 0.177088127f},
-std::array<float,2>{0.376719773f, 0.643574297f},
-std::array<float,2>{0.391633004f, 0.323130935f},
-std::array<float,2>{0.855271697f, 0.875706851f},
-std::array<float,2>{0.505970538f, 0.151952595f},
-std::array<float,2>{0.00685200095f, 0.680662155f},
-std::array<float,2>{0.164904013f, 0.0202141237f},
-std::array<float,2>{0.704886854f, 0.545569658f},
-std::array<float,2>{0.942595124f, 0.448843122f},
-std::array<float,2>{0.296676397f, 0.874725044f},
-std::array<float,2>{0.328919172f, 0.205174431f},
-std::array<float,2>{0.910141706f, 0.701105535f},
-std::array<float,2>{0.684998095f, 0.303077132f},
-std::array<float,2>{0.190263137f, 0.957353234f},
-std::array<float,2>{0.108010374f, 0.409692377f},
-std::array<float,2>{0.60425818f, 0.762678683f},
-std::array<float,2>{0.804083347f, 0.0720828846f},
-std::array<float,2>{0.467746288f, 0.606851339f},
-std::array<float,2>{0.260077536f, 0.486817956f},
-std::array<float,2>{0.968850851f, 0.836770415f},
-std::array<float,2>{0.722989917f, 0.0461995751f},
-std::array<float,2>{0.152456313f, 0.526318312f},
-std::array<float,2>{0.0386229567f, 0.167749524f},
-std::array<float,2>{0.552936852f, 0.636529684f},
-std::array<float,2>{0.827076912f, 0.370113879f},
-std::array<float,2>{0.426321834f, 0.93705672f},
-std::array<float,2>{0.491182655f, 0.107305422f},
-std::array<float,2>{0.777864695f, 0.562573314f},
-std::array<float,2>{0.585761368f, 0.376467198f},
-std::array<float,2>{0.0931755528f, 0.806083798f},
-std::array<float,2>{0.241548672f, 0.269027293f},
-std::array<float,2>{0.645789146f, 0.984395385f},
-std::array<float,2>{0.905353546f, 0.221045718f},
-std::array<float,2>{0.357064486f, 0.74849695f},
-std::array<float,2>{0.312740177f, 0.373247832f},
-std::array<float,2>{0.933097899f, 0.930503488f},
-std::array<float,2>{0.665789425f, 0.170726702f},
-std::array<float,2>{0.208847627f, 0.638248682f},
-std::array<float,2>{0.117787436f, 0.0428380109f},
-std::array<float,2>{0.622034788f, 0.52755779f},
-std::array<float,2>{0.791895032f, 0.489114344f},
-std::array<float,2>{0.441534162f, 0.841680408f},
-std::array<float,2>{0.386779815f, 0.226041079f},
-std::array<float,2>{0.87417984f, 0.745230734f},
-std::array<float,2>{0.518840373f, 0.271858126f},
-std::array<float,2>{0.0206432603f, 0.991945982f},
-std::array<float,2>{0.185816854f, 0.380684257f},
-std::array<float,2>{0.698939264f, 0.808833599f},
-std::array<float,2>{0.968539715f, 0.104954988f},
-std::array<float,2>{0.300896436f, 0.566854596f},
-std::array<float,2>{0.479195565f, 0.451294839f},
-std::array<float,2>{0.761508405f, 0.869773448f},
-std::array<float,2>{0.576008141f, 0.0174151491f},
-std::array<float,2>{0.0751197562f, 0.54108578f},
-std::array<float,2>{0.22245875f, 0.155155227f},
-std::array<float,2>{0.640336633f, 0.684964061f},
-std::array<float,2>{0.884588897f, 0.325144559f},
-std::array<float,2>{0.363817543f, 0.879153728f},
-std::array<float,2>{0.274295807f, 0.0758881792f},
-std::array<float,2>{0.984649479f, 0.604402184f},
-std::array<float,2>{0.748458445f, 0.412366301f},
-std::array<float,2>{0.130291492f, 0.758734941f},
-std::array<float,2>{0.0509677343f, 0.299698293f},
-std::array<float,2>{0.532218874f, 0.95332551f},
-std::array<float,2>{0.836854279f, 0.209288299f},
-std::array<float,2>{0.411816299f, 0.696807921f},
-std::array<float,2>{0.432812721f, 0.264549226f},
-std::array<float,2>{0.815682232f, 0.980608225f},
-std::array<float,2>{0.558321595f, 0.248381898f},
-std::array<float,2>{0.0418341756f, 0.726233661f},
-std::array<float,2>{0.146553561f, 0.110096365f},
-std::array<float,2>{0.728025615f, 0.586117029f},
-std::array<float,2>{0.977969825f, 0.392906517f},
-std::array<float,2>{0.254285932f, 0.789326012f},
-std::array<float,2>{0.347091138f, 0.175717205f},
-std::array<float,2>{0.892981231f, 0.647013843f},
-std::array<float,2>{0.653715491f, 0.349447429f},
-std::array<float,2>{0.245970532f, 0.907873392f},
-std::array<float,2>{0.0821722224f, 0.471809864f},
-std::array<float,2>{0.592025459f, 0.823411405f},
-std::array<float,2>{0.76908356f, 0.0475376621f},
-std::array<float,2>{0.493184656f, 0.515506148f},
-std::array<float,2>{0.285439581f, 0.43703562f},
-std::array<float,2>{0.951327145f, 0.775529683f},
-std::array<float,2>{0.718708336f, 0.0789967701f},
-std::array<float,2>{0.16317147f, 0.614870131f},
-std::array<float,2>{0.0104228258f, 0.189622477f},
-std::array<float,2>{0.511096179f, 0.711920559f},
-std::array<float,2>{0.846341729f, 0.289866537f},
-std::array<float,2>{0.399800926f, 0.948106647f},
-std::array<float,2>{0.459203571f, 0.00147267338f},
-std::array<float,2>{0.809998155f, 0.554358244f},
-std::array<float,2>{0.600573003f, 0.467947692f},
-std::array<float,2>{0.0973014086f, 0.856231749f},
-std::array<float,2>{0.201898307f, 0.332010329f},
-std::array<float,2>{0.673396349f, 0.899465263f},
-std::array<float,2>{0.919142485f, 0.137647972f},
-std::array<float,2>{0.340957433f, 0.65876925f},
-std::array<float,2>{0.26207754f, 0.288917065f},
-std::array<float,2>{0.975917935f, 0.944501936f},
-std::array<float,2>{0.719977796f, 0.202676058f},
-std::array<float,2>{0.151532188f, 0.710550666f},
-std::array<float,2>{0.0327003822f, 0.0889820307f},
-std::array<float,2>{0.548198342f, 0.622739613f},
-std::array<float,2>{0.821761906f, 0.429573476f},
-std::array<float,2>{0.422331721f, 0.768881917f},
-std::array<float,2>{0.486234516f, 0.130910039f},
-std::array<float,2>{0.776429594f, 0.667479455f},
-std::array<float,2>{0.578521967f, 0.336943418f},
-std::array<float,2>{0.0892196745f, 0.892622769f},
-std::array<float,2>{0.23629494f, 0.456065446f},
-std::array<float,2>{0.642258167f, 0.849301636f},
-std::array<float,2>{0.89900142f, 0.0100746527f},
-std::array<float,2>{0.355009556f, 0.559622407f},
-std::array<float,2>{0.397281259f, 0.404444665f},
-std::array<float,2>{0.857488871f, 0.788324058f},
-std::array<float,2>{0.502496123f, 0.124844924f},
-std::array<float,2>{0.000107446744f, 0.580436468f},
-std::array<float,2>{0.17115137f, 0.23622562f},
-std::array<float,2>{0.708288848f, 0.732994378f},
-std::array<float,2>{0.940079033f, 0.250855327f},
-std::array<float,2>{0.290273666f, 0.971249819f},
-std::array<float,2>{0.334946185f, 0.0622496419f},
-std::array<float,2>{0.910720825f, 0.506884396f},
-std::array<float,2>{0.681706727f, 0.480308294f},
-std::array<float,2>{0.191567197f, 0.814984679f},
-std::array<float,2>{0.102782331f, 0.355535567f},
-std::array<float,2>{0.607517838f, 0.917964041f},
-std::array<float,2>{0.797977626f, 0.182442129f},
-std::array<float,2>{0.464360982f, 0.651503921f},
-std::array<float,2>{0.449847549f, 0.315218836f},
-std::array<float,2>{0.785747766f, 0.886998177f},
-std::array<float,2>{0.610141337f, 0.147722945f},
-std::array<float,2>{0.115556501f, 0.675450921f},
-std::array<float,2>{0.214109376f, 0.0255031157f},
-std::array<float,2>{0.660507619f, 0.531489372f},
-std::array<float,2>{0.924468279f, 0.440719664f},
-std::array<float,2>{0.32526499f, 0.860353947f},
-std::array<float,2>{0.306849897f, 0.212462738f},
-std::array<float,2>{0.95743382f, 0.692117035f},
-std::array<float,2>{0.691352129f, 0.307113737f},
-std::array<float,2>{0.177947789f, 0.96119225f},
-std::array<float,2>{0.0305464249f, 0.421358496f},
-std::array<float,2>{0.530389667f, 0.756441772f},
-std::array<float,2>{0.861155152f, 0.0686525851f},
-std::array<float,2>{0.381650329f, 0.600984037f},
-std::array<float,2>{0.37059927f, 0.49907878f},
-std::array<float,2>{0.877153814f, 0.829805613f},
-std::array<float,2>{0.629907787f, 0.0369746238f},
-std::array<float,2>{0.230784327f, 0.520417988f},
-std::array<float,2>{0.066914089f, 0.160090148f},
-std::array<float,2>{0.567835391f, 0.629140079f},
-std::array<float,2>{0.753422976f, 0.366345346f},
-std::array<float,2>{0.473234862f, 0.924680352f},
-std::array<float,2>{0.41919145f, 0.10012722f},
-std::array<float,2>{0.82969141f, 0.572586775f},
-std::array<float,2>{0.542653561f, 0.388615251f},
-std::array<float,2>{0.0613876656f, 0.797898889f},
-std::array<float,2>{0.14058952f, 0.279056668f},
-std::array<float,2>{0.73827666f, 0.993826449f},
-std::array<float,2>{0.997836649f, 0.231210619f},
-std::array<float,2>{0.266466856f, 0.741865337f},
-std::array<float,2>{0.297134966f, 0.342283189f},
-std::array<float,2>{0.962378502f, 0.897581816f},
-std::array<float,2>{0.702013671f, 0.126516357f},
-std::array<float,2>{0.182251573f, 0.669709206f},
-std::array<float,2>{0.0159499235f, 0.0146365436f},
-std::array<float,2>{0.519607246f, 0.557177424f},
-std::array<float,2>{0.868086338f, 0.458699077f},
-std::array<float,2>{0.383314043f, 0.846845508f},
-std::array<float,2>{0.43832013f, 0.196050048f},
-std::array<float,2>{0.795282781f, 0.705133319f},
-std::array<float,2>{0.619116902f, 0.284111589f},
-std::array<float,2>{0.123848408f, 0.939380348f},
-std::array<float,2>{0.204269886f, 0.423289716f},
-std::array<float,2>{0.668896377f, 0.772854686f},
-std::array<float,2>{0.934411466f, 0.0933037996f},
-std::array<float,2>{0.319563001f, 0.620844185f},
-std::array<float,2>{0.409631789f, 0.481889248f},
-std::array<float,2>{0.84195447f, 0.818776488f},
-std::array<float,2>{0.538319767f, 0.0555698387f},
-std::array<float,2>{0.0469185002f, 0.500510097f},
-std::array<float,2>{0.125353277f, 0.187414244f},
-std::array<float,2>{0.743006825f, 0.654147923f},
-std::array<float,2>{0.988815308f, 0.352995366f},
-std::array<float,2>{0.278468996f, 0.921518683f},
-std::array<float,2>{0.359410375f, 0.118052185f},
-std::array<float,2>{0.890236855f, 0.585541487f},
-std::array<float,2>{0.636142313f, 0.401000738f},
-std::array<float,2>{0.223986924f, 0.785027146f},
-std::array<float,2>{0.0741126537f, 0.257374197f},
-std::array<float,2>{0.572918236f, 0.974268675f},
-std::array<float,2>{0.762419224f, 0.238766521f},
-std::array<float,2>{0.482989609f, 0.728505909f},
-std::array<float,2>{0.498392254f, 0.310493708f},
-std::array<float,2>{0.772477329f, 0.968017936f},
-std::array<float,2>{0.586391091f, 0.216479778f},
-std::array<float,2>{0.0786278397f, 0.689249635f},
-std::array<float,2>{0.248568326f, 0.06260553f},
-std::array<float,2>{0.651923299f, 0.596183896f},
-std::array<float,2>{0.895229042f, 0.416182518f},
-std::array<float,2>{0.351063251f, 0.751739562f},
-std::array<float,2>{0.251139313f, 0.142802536f},
-std::array<float,2>{0.981854677f, 0.679582119f},
-std::array<float,2>{0.731778979f, 0.319638968f},
-std::array<float,2>{0.143310457f, 0.885292947f},
-std::array<float,2>{0.0464987718f, 0.442081511f},
-std::array<float,2>{0.561445594f, 0.864159584f},
-std::array<float,2>{0.817989886f, 0.0305073652f},
-std::array<float,2>{0.437498152f, 0.538361609f},
-std::array<float,2>{0.33778435f, 0.383530527f},
-std::array<float,2>{0.91704154f, 0.804561198f},
-std::array<float,2>{0.676373243f, 0.0941759124f},
-std::array<float,2>{0.198105082f, 0.577203393f},
-std::array<float,2>{0.0998160988f, 0.228563383f},
-std::array<float,2>{0.595135331f, 0.736201108f},
-std::array<float,2>{0.807025969f, 0.276390284f},
-std::array<float,2>{0.454699159f, 0.99936074f},
-std::array<float,2>{0.405507982f, 0.0325223505f},
-std::array<float,2>{0.849341094f, 0.517645001f},
-std::array<float,2>{0.514736116f, 0.493375808f},
-std::array<float,2>{0.0146829495f, 0.834713876f},
-std::array<float,2>{0.158521265f, 0.36214608f},
-std::array<float,2>{0.711434782f, 0.925942838f},
-std::array<float,2>{0.94585377f, 0.163049355f},
-std::array<float,2>{0.284813344f, 0.628022194f},
-std::array<float,2>{0.356375247f, 0.265663564f},
-std::array<float,2>{0.904349804f, 0.987321019f},
-std::array<float,2>{0.644768655f, 0.219384328f},
-std::array<float,2>{0.240723476f, 0.747837484f},
-std::array<float,2>{0.0920886621f, 0.109243363f},
-std::array<float,2>{0.584760904f, 0.565339983f},
-std::array<float,2>{0.778640211f, 0.37818265f},
-std::array<float,2>{0.491588891f, 0.807925701f},
-std::array<float,2>{0.427717328f, 0.165784165f},
-std::array<float,2>{0.827452481f, 0.633396506f},
-std::array<float,2>{0.554158211f, 0.368336797f},
-std::array<float,2>{0.0372304469f, 0.934022725f},
-std::array<float,2>{0.153381839f, 0.485617548f},
-std::array<float,2>{0.724064767f, 0.837943852f},
-std::array<float,2>{0.969767034f, 0.0432945825f},
-std::array<float,2>{0.261464119f, 0.52489388f},
-std::array<float,2>{0.468444467f, 0.406406254f},
-std::array<float,2>{0.803092539f, 0.764186919f},
-std::array<float,2>{0.605102837f, 0.0740470439f},
-std::array<float,2>{0.108603917f, 0.609103441f},
-std::array<float,2>{0.19119598f, 0.204291463f},
-std::array<float,2>{0.683888078f, 0.70254451f},
-std::array<float,2>{0.909148812f, 0.302204698f},
-std::array<float,2>{0.329746157f, 0.959347606f},
-std::array<float,2>{0.29567489f, 0.0222421438f},
-std::array<float,2>{0.942072988f, 0.543678343f},
-std::array<float,2>{0.703489006f, 0.446233392f},
-std::array<float,2>{0.165237978f, 0.872764707f},
-std::array<float,2>{0.00624300865f, 0.321954936f},
-std::array<float,2>{0.506942689f, 0.878866136f},
-std::array<float,2>{0.854376435f, 0.150252119f},
-std::array<float,2>{0.391111076f, 0.682924151f},
-std::array<float,2>{0.375862122f, 0.346678257f},
-std::array<float,2>{0.864719748f, 0.91054666f},
-std::array<float,2>{0.527150512f, 0.178073451f},
-std::array<float,2>{0.0235593729f, 0.641714811f},
-std::array<float,2>{0.172306925f, 0.0519075952f},
-std::array<float,2>{0.692638695f, 0.508406758f},
-std::array<float,2>{0.956202745f, 0.473650873f},
-std::array<float,2>{0.310414076f, 0.826275527f},
-std::array<float,2>{0.321008056f, 0.245586768f},
-std::array<float,2>{0.929684699f, 0.722163081f},
-std::array<float,2>{0.658002496f, 0.261065304f},
-std::array<float,2>{0.215648398f, 0.979771614f},
-std::array<float,2>{0.111685745f, 0.395314038f},
-std::array<float,2>{0.615659654f, 0.794426918f},
-std::array<float,2>{0.783881128f, 0.113382943f},
-std::array<float,2>{0.447413713f, 0.590625703f},
-std::array<float,2>{0.269846201f, 0.464036077f},
-std::array<float,2>{0.994266093f, 0.852980733f},
-std::array<float,2>{0.739772499f, 0.0056134942f},
-std::array<float,2>{0.133370191f, 0.548926592f},
-std::array<float,2>{0.0550208129f, 0.135109708f},
-std::array<float,2>{0.544384003f, 0.661439896f},
-std::array<float,2>{0.832168102f, 0.33308202f},
-std::array<float,2>{0.416106492f, 0.904002547f},
-std::array<float,2>{0.469676197f, 0.0828626007f},
-std::array<float,2>{0.756106615f, 0.610842109f},
-std::array<float,2>{0.565033197f, 0.43161431f},
-std::array<float,2>{0.063689962f, 0.778903186f},
-std::array<float,2>{0.229818687f, 0.294922054f},
-std::array<float,2>{0.628555954f, 0.949910641f},
-std::array<float,2>{0.878916442f, 0.19301948f},
-std::array<float,2>{0.37253052f, 0.717768133f},
-std::array<float,2>{0.366292655f, 0.32702902f},
-std::array<float,2>{0.88643378f, 0.881888747f},
-std::array<float,2>{0.638018906f, 0.153913483f},
-std::array<float,2>{0.220021859f, 0.685678244f},
-std::array<float,2>{0.0769080967f, 0.0177062061f},
-std::array<float,2>{0.577900231f, 0.539629936f},
-std::array<float,2>{0.758877873f, 0.449472725f},
-std::array<float,2>{0.476976782f, 0.868942916f},
-std::array<float,2>{0.412252218f, 0.208364233f},
-std::array<float,2>{0.838181674f, 0.697401285f},
-std::array<float,2>{0.533483803f, 0.297037214f},
-std::array<float,2>{0.0531676598f, 0.95657742f},
-std::array<float,2>{0.131638005f, 0.410718888f},
-std::array<float,2>{0.746634722f, 0.760418892f},
-std::array<float,2>{0.986547291f, 0.077086091f},
-std::array<float,2>{0.276455671f, 0.602664113f},
-std::array<float,2>{0.444924623f, 0.490859002f},
-std::array<float,2>{0.789174855f, 0.841874599f},
-std::array<float,2>{0.624746561f, 0.040169578f},
-std::array<float,2>{0.119239137f, 0.529681087f},
-std::array<float,2>{0.210704938f, 0.168975204f},
-std::array<float,2>{0.667798817f, 0.639635742f},
-std::array<float,2>{0.93024075f, 0.371759564f},
-std::array<float,2>{0.315847486f, 0.933373511f},
-std::array<float,2>{0.303951204f, 0.101626039f},
-std::array<float,2>{0.966487467f, 0.569732964f},
-std::array<float,2>{0.695736468f, 0.381640315f},
-std::array<float,2>{0.184752837f, 0.811117828f},
-std::array<float,2>{0.02270489f, 0.270087749f},
-std::array<float,2>{0.516203284f, 0.989579737f},
-std::array<float,2>{0.871976495f, 0.223303914f},
-std::array<float,2>{0.388953686f, 0.743539989f},
-std::array<float,2>{0.401357383f, 0.292495847f},
-std::array<float,2>{0.844992876f, 0.94685936f},
-std::array<float,2>{0.508006871f, 0.188027352f},
-std::array<float,2>{0.00927590951f, 0.7144292f},
-std::array<float,2>{0.16138947f, 0.080625914f},
-std::array<float,2>{0.715964496f, 0.615456283f},
-std::array<float,2>{0.951124132f, 0.434861779f},
-std::array<float,2>{0.288212657f, 0.773557365f},
-std::array<float,2>{0.341924667f, 0.139760688f},
-std::array<float,2>{0.921518028f, 0.657755852f},
-std::array<float,2>{0.674930155f, 0.329677194f},
-std::array<float,2>{0.200625688f, 0.901446164f},
-std::array<float,2>{0.0952445045f, 0.465390354f},
-std::array<float,2>{0.597898662f, 0.858076453f},
-std::array<float,2>{0.811019599f, 0.00263606827f},
-std::array<float,2>{0.458478808f, 0.551789939f},
-std::array<float,2>{0.256147921f, 0.391116351f},
-std::array<float,2>{0.979646862f, 0.792689085f},
-std::array<float,2>{0.729464233f, 0.113067456f},
-std::array<float,2>{0.144845724f, 0.588701606f},
-std::array<float,2>{0.0394244418f, 0.247443244f},
-std::array<float,2>{0.555623233f, 0.724038899f},
-std::array<float,2>{0.813361108f, 0.262690783f},
-std::array<float,2>{0.431009501f, 0.983700752f},
-std::array<float,2>{0.494815618f, 0.0498302095f},
-std::array<float,2>{0.766721487f, 0.512170374f},
-std::array<float,2>{0.591061234f, 0.469667226f},
-std::array<float,2>{0.0852768645f, 0.822184145f},
-std::array<float,2>{0.243571222f, 0.350521088f},
-std::array<float,2>{0.655361354f, 0.909158289f},
-std::array<float,2>{0.892148018f, 0.17313531f},
-std::array<float,2>{0.343877047f, 0.64517343f},
-std::array<float,2>{0.291698128f, 0.253196836f},
-std::array<float,2>{0.937686622f, 0.970011115f},
-std::array<float,2>{0.710756183f, 0.23706764f},
-std::array<float,2>{0.169675082f, 0.731160641f},
-std::array<float,2>{0.0020130421f, 0.122377768f},
-std::array<float,2>{0.501446605f, 0.578702807f},
-std::array<float,2>{0.856399f, 0.402673006f},
-std::array<float,2>{0.395768672f, 0.786687613f},
-std::array<float,2>{0.461630315f, 0.180787355f},
-std::array<float,2>{0.800025403f, 0.649757683f},
-std::array<float,2>{0.605741024f, 0.357450634f},
-std::array<float,2>{0.104287893f, 0.914991438f},
-std::array<float,2>{0.194692373f, 0.477996558f},
-std::array<float,2>{0.679731548f, 0.814328074f},
-std::array<float,2>{0.91257447f, 0.0601074137f},
-std::array<float,2>{0.332079083f, 0.505440474f},
-std::array<float,2>{0.425311565f, 0.427108973f},
-std::array<float,2>{0.822682619f, 0.766626f},
-std::array<float,2>{0.549565852f, 0.08594767f},
-std::array<float,2>{0.0334135816f, 0.624351442f},
-std::array<float,2>{0.148541585f, 0.199710384f},
-std::array<float,2>{0.722097814f, 0.708731234f},
-std::array<float,2>{0.974332809f, 0.285983324f},
-std::array<float,2>{0.264143825f, 0.942285776f},
-std::array<float,2>{0.351899207f, 0.00934966747f},
-std::array<float,2>{0.900591433f, 0.560913563f},
-std::array<float,2>{0.643421888f, 0.453136027f},
-std::array<float,2>{0.237529546f, 0.851221621f},
-std::array<float,2>{0.0860759914f, 0.339756221f},
-std::array<float,2>{0.58042109f, 0.890630782f},
-std::array<float,2>{0.774900913f, 0.129305199f},
-std::array<float,2>{0.486620069f, 0.665662944f},
-std::array<float,2>{0.47630322f, 0.364666671f},
-std::array<float,2>{0.751860261f, 0.922842622f},
-std::array<float,2>{0.568746984f, 0.157611832f},
-std::array<float,2>{0.068696551f, 0.631332576f},
-std::array<float,2>{0.234002575f, 0.0385141559f},
-std::array<float,2>{0.632130742f, 0.522712469f},
-std::array<float,2>{0.876636505f, 0.49715215f},
-std::array<float,2>{0.367318839f, 0.830586553f},
-std::array<float,2>{0.268454403f, 0.234004319f},
-std::array<float,2>{0.999451995f, 0.739375055f},
-std::array<float,2>{0.735782087f, 0.280717164f},
-std::array<float,2>{0.138124958f, 0.994983554f},
-std::array<float,2>{0.0590747744f, 0.389546365f},
-std::array<float,2>{0.540034652f, 0.800294459f},
-std::array<float,2>{0.830773056f, 0.0989407375f},
-std::array<float,2>{0.420783043f, 0.570383966f},
-std::array<float,2>{0.327270657f, 0.437643856f},
-std::array<float,2>{0.922006309f, 0.861717224f},
-std::array<float,2>{0.662653565f, 0.0236014593f},
-std::array<float,2>{0.212105647f, 0.533796072f},
-std::array<float,2>{0.113960803f, 0.146264121f},
-std::array<float,2>{0.612920463f, 0.673023641f},
-std::array<float,2>{0.787131846f, 0.312710196f},
-std::array<float,2>{0.452507734f, 0.889691055f},
-std::array<float,2>{0.379249275f, 0.068084918f},
-std::array<float,2>{0.862365425f, 0.59951061f},
-std::array<float,2>{0.529254198f, 0.41881901f},
-std::array<float,2>{0.0274574999f, 0.755841613f},
-std::array<float,2>{0.176102832f, 0.306166083f},
-std::array<float,2>{0.688676119f, 0.963325381f},
-std::array<float,2>{0.960017502f, 0.214302048f},
-std::array<float,2>{0.305584192f, 0.695281506f},
-std::array<float,2>{0.279425293f, 0.354968488f},
-std::array<float,2>{0.991741717f, 0.919543743f},
-std::array<float,2>{0.744977295f, 0.184568122f},
-std::array<float,2>{0.128048345f, 0.655327916f},
-std::array<float,2>{0.0493376143f, 0.0573136546f},
-std::array<float,2>{0.536842704f, 0.502337217f},
-std::array<float,2>{0.841404796f, 0.484044194f},
-std::array<float,2>{0.40642786f, 0.818074286f},
-std::array<float,2>{0.481529117f, 0.240424886f},
-std::array<float,2>{0.765502512f, 0.728583574f},
-std::array<float,2>{0.571406841f, 0.254044056f},
-std::array<float,2>{0.0708546788f, 0.974654317f},
-std::array<float,2>{0.226422936f, 0.399290562f},
-std::array<float,2>{0.633760154f, 0.781968653f},
-std::array<float,2>{0.887520492f, 0.11960274f},
-std::array<float,2>{0.362567723f, 0.583261251f},
-std::array<float,2>{0.385118693f, 0.459271252f},
-std::array<float,2>{0.870298028f, 0.845016181f},
-std::array<float,2>{0.522143662f, 0.0120803276f},
-std::array<float,2>{0.0180886704f, 0.556060374f},
-std::array<float,2>{0.17998904f, 0.126976356f},
-std::array<float,2>{0.699963391f, 0.670396268f},
-std::array<float,2>{0.963545382f, 0.340963006f},
-std::array<float,2>{0.299620509f, 0.895480633f},
-std::array<float,2>{0.318202347f, 0.0910324603f},
-std::array<float,2>{0.936038554f, 0.617952526f},
-std::array<float,2>{0.670936704f, 0.42558679f},
-std::array<float,2>{0.206342578f, 0.770647049f},
-std::array<float,2>{0.122357897f, 0.282305121f},
-std::array<float,2>{0.619635046f, 0.940956473f},
-std::array<float,2>{0.793230891f, 0.198235586f},
-std::array<float,2>{0.441334784f, 0.703987002f},
-std::array<float,2>{0.45662111f, 0.274664223f},
-std::array<float,2>{0.805578947f, 0.997612834f},
-std::array<float,2>{0.59593159f, 0.22788164f},
-std::array<float,2>{0.0980666801f, 0.738106191f},
-std::array<float,2>{0.19678545f, 0.0961632207f},
-std::array<float,2>{0.679335773f, 0.574461281f},
-std::array<float,2>{0.914161026f, 0.386215955f},
-std::array<float,2>{0.338099688f, 0.802608609f},
-std::array<float,2>{0.281267166f, 0.161987916f},
-std::array<float,2>{0.949043572f, 0.625690162f},
-std::array<float,2>{0.714387536f, 0.360813349f},
-std::array<float,2>{0.156380534f, 0.929431617f},
-std::array<float,2>{0.012495691f, 0.495035142f},
-std::array<float,2>{0.511729062f, 0.832170725f},
-std::array<float,2>{0.850151658f, 0.0349152163f},
-std::array<float,2>{0.404126018f, 0.516883194f},
-std::array<float,2>{0.348584801f, 0.415020078f},
-std::array<float,2>{0.896632135f, 0.752511382f},
-std::array<float,2>{0.649585009f, 0.0657088235f},
-std::array<float,2>{0.246900201f, 0.595030248f},
-std::array<float,2>{0.0819741562f, 0.217502981f},
-std::array<float,2>{0.588372707f, 0.691075265f},
-std::array<float,2>{0.771109581f, 0.312087089f},
-std::array<float,2>{0.496865213f, 0.966678619f},
-std::array<float,2>{0.434518576f, 0.0283107981f},
-std::array<float,2>{0.819583893f, 0.536419809f},
-std::array<float,2>{0.560439765f, 0.444409132f},
-std::array<float,2>{0.0438907109f, 0.865707278f},
-std::array<float,2>{0.141765207f, 0.317651451f},
-std::array<float,2>{0.73412174f, 0.883921742f},
-std::array<float,2>{0.982885897f, 0.140815973f},
-std::array<float,2>{0.25379768f, 0.676699638f},
-std::array<float,2>{0.330389142f, 0.304175019f},
-std::array<float,2>{0.908045471f, 0.958371341f},
-std::array<float,2>{0.686159909f, 0.206980392f},
-std::array<float,2>{0.188347653f, 0.699322462f},
-std::array<float,2>{0.10678345f, 0.0711329952f},
-std::array<float,2>{0.602972031f, 0.605888486f},
-std::array<float,2>{0.801310062f, 0.408478051f},
-std::array<float,2>{0.466601014f, 0.763297379f},
-std::array<float,2>{0.393015116f, 0.15100947f},
-std::array<float,2>{0.852760792f, 0.681076944f},
-std::array<float,2>{0.504872322f, 0.324196368f},
-std::array<float,2>{0.00519639114f, 0.876335323f},
-std::array<float,2>{0.166698471f, 0.44746533f},
-std::array<float,2>{0.706907272f, 0.873234391f},
-std::array<float,2>{0.94354862f, 0.0208893642f},
-std::array<float,2>{0.294291407f, 0.546107352f},
-std::array<float,2>{0.489006132f, 0.375808477f},
-std::array<float,2>{0.779366374f, 0.805058599f},
-std::array<float,2>{0.582889915f, 0.105761409f},
-std::array<float,2>{0.090147689f, 0.563480377f},
-std::array<float,2>{0.238819614f, 0.222362339f},
-std::array<float,2>{0.647033691f, 0.74925971f},
-std::array<float,2>{0.903583169f, 0.268376291f},
-std::array<float,2>{0.35743919f, 0.985433757f},
-std::array<float,2>{0.259289235f, 0.0458410345f},
-std::array<float,2>{0.971524417f, 0.526733935f},
-std::array<float,2>{0.726497471f, 0.487457156f},
-std::array<float,2>{0.155805245f, 0.837041259f},
-std::array<float,2>{0.0360067412f, 0.370543748f},
-std::array<float,2>{0.551247895f, 0.936357141f},
-std::array<float,2>{0.824269831f, 0.166866452f},
-std::array<float,2>{0.428604007f, 0.635180771f},
-std::array<float,2>{0.414216012f, 0.334933609f},
-std::array<float,2>{0.834684551f, 0.905817986f},
-std::array<float,2>{0.546165407f, 0.133195773f},
-std::array<float,2>{0.0574697033f, 0.663609445f},
-std::array<float,2>{0.136139899f, 0.00767716952f},
-std::array<float,2>{0.742107987f, 0.548753858f},
-std::array<float,2>{0.993325412f, 0.462090313f},
-std::array<float,2>{0.273198664f, 0.853807747f},
-std::array<float,2>{0.373786002f, 0.193747088f},
-std::array<float,2>{0.881137848f, 0.715329826f},
-std::array<float,2>{0.626086175f, 0.294146836f},
-std::array<float,2>{0.22775951f, 0.952784777f},
-std::array<float,2>{0.0651128292f, 0.431827098f},
-std::array<float,2>{0.562640131f, 0.779428124f},
-std::array<float,2>{0.755100489f, 0.0851597935f},
-std::array<float,2>{0.471117735f, 0.612724066f},
-std::array<float,2>{0.310945481f, 0.476551473f},
-std::array<float,2>{0.953900516f, 0.825219035f},
-std::array<float,2>{0.694391727f, 0.0543258712f},
-std::array<float,2>{0.174099922f, 0.510457397f},
-std::array<float,2>{0.0255240425f, 0.176640302f},
-std::array<float,2>{0.523903549f, 0.642653823f},
-std::array<float,2>{0.865985811f, 0.34440881f},
-std::array<float,2>{0.37777862f, 0.913555026f},
-std::array<float,2>{0.445608258f, 0.11542809f},
-std::array<float,2>{0.783179164f, 0.592704773f},
-std::array<float,2>{0.614516318f, 0.396567196f},
-std::array<float,2>{0.109967507f, 0.796162069f},
-std::array<float,2>{0.217086166f, 0.259241074f},
-std::array<float,2>{0.659166694f, 0.976589322f},
-std::array<float,2>{0.927412987f, 0.242220834f},
-std::array<float,2>{0.323682874f, 0.720357656f},
-std::array<float,2>{0.368058324f, 0.367116719f},
-std::array<float,2>{0.876029253f, 0.924218774f},
-std::array<float,2>{0.632758856f, 0.159343898f},
-std::array<float,2>{0.233455136f, 0.629470706f},
-std::array<float,2>{0.0690633953f, 0.0362210199f},
-std::array<float,2>{0.568930984f, 0.519543111f},
-std::array<float,2>{0.750981152f, 0.499605536f},
-std::array<float,2>{0.475597382f, 0.829330802f},
-std::array<float,2>{0.420168579f, 0.230904207f},
-std::array<float,2>{0.830472827f, 0.741620004f},
-std::array<float,2>{0.539358675f, 0.278425038f},
-std::array<float,2>{0.0591611415f, 0.993594408f},
-std::array<float,2>{0.1384684f, 0.387872189f},
-std::array<float,2>{0.735923707f, 0.798650146f},
-std::array<float,2>{0.999885261f, 0.100056782f},
-std::array<float,2>{0.268020332f, 0.573148072f},
-std::array<float,2>{0.452988297f, 0.44118005f},
-std::array<float,2>{0.787829995f, 0.861086249f},
-std::array<float,2>{0.612770736f, 0.0262628794f},
-std::array<float,2>{0.113363013f, 0.532018065f},
-std::array<float,2>{0.212705582f, 0.147970393f},
-std::array<float,2>{0.662442505f, 0.675269961f},
-std::array<float,2>{0.922479868f, 0.314940423f},
-std::array<float,2>{0.327952474f, 0.887602687f},
-std::array<float,2>{0.304690421f, 0.0690771714f},
-std::array<float,2>{0.960513294f, 0.601323903f},
-std::array<float,2>{0.689374983f, 0.421573311f},
-std::array<float,2>{0.1763376f, 0.756287754f},
-std::array<float,2>{0.0280631371f, 0.307144582f},
-std::array<float,2>{0.528540373f, 0.961568952f},
-std::array<float,2>{0.863066375f, 0.212117851f},
-std::array<float,2>{0.379758984f, 0.691829443f},
-std::array<float,2>{0.396111816f, 0.250004441f},
-std::array<float,2>{0.855687499f, 0.970835507f},
-std::array<float,2>{0.50146693f, 0.235509053f},
-std::array<float,2>{0.00286207069f, 0.732814491f},
-std::array<float,2>{0.169414207f, 0.124444149f},
-std::array<float,2>{0.709975183f, 0.580567479f},
-std::array<float,2>{0.938294113f, 0.405068696f},
-std::array<float,2>{0.29130584f, 0.788817465f},
-std::array<float,2>{0.332854927f, 0.182001442f},
-std::array<float,2>{0.913055658f, 0.652253687f},
-std::array<float,2>{0.680471301f, 0.356285691f},
-std::array<float,2>{0.195121467f, 0.917164683f},
-std::array<float,2>{0.103806771f, 0.479687601f},
-std::array<float,2>{0.606102884f, 0.814845026f},
-std::array<float,2>{0.800414801f, 0.0620069914f},
-std::array<float,2>{0.46127066f, 0.507333517f},
-std::array<float,2>{0.264600366f, 0.429090559f},
-std::array<float,2>{0.973761499f, 0.769146383f},
-std::array<float,2>{0.722263813f, 0.0897595584f},
-std::array<float,2>{0.149379984f, 0.622542679f},
-std::array<float,2>{0.033754278f, 0.202328146f},
-std::array<float,2>{0.549248934f, 0.710356474f},
-std::array<float,2>{0.822974741f, 0.288513422f},
-std::array<float,2>{0.425233871f, 0.94508481f},
-std::array<float,2>{0.487291396f, 0.0106335999f},
-std::array<float,2>{0.775245488f, 0.560173631f},
-std::array<float,2>{0.581042826f, 0.456784785f},
-std::array<float,2>{0.0865140855f, 0.848830104f},
-std::array<float,2>{0.237955093f, 0.337733448f},
-std::array<float,2>{0.642893612f, 0.893420458f},
-std::array<float,2>{0.901195109f, 0.131550595f},
-std::array<float,2>{0.352418065f, 0.667762041f},
-std::array<float,2>{0.288859367f, 0.289433956f},
-std::array<float,2>{0.950359106f, 0.947661102f},
-std::array<float,2>{0.71675235f, 0.190037966f},
-std::array<float,2>{0.161696568f, 0.712480068f},
-std::array<float,2>{0.00936920568f, 0.0785843655f},
-std::array<float,2>{0.508324206f, 0.614642382f},
-std::array<float,2>{0.845536411f, 0.436847597f},
-std::array<float,2>{0.400668412f, 0.776311636f},
-std::array<float,2>{0.458608299f, 0.137019753f},
-std::array<float,2>{0.811342776f, 0.658344209f},
-std::array<float,2>{0.598280549f, 0.33111456f},
-std::array<float,2>{0.0949642733f, 0.899929285f},
-std::array<float,2>{0.201159954f, 0.468718112f},
-std::array<float,2>{0.675389707f, 0.855862975f},
-std::array<float,2>{0.92096895f, 0.00145469175f},
-std::array<float,2>{0.342692792f, 0.553758144f},
-std::array<float,2>{0.431194872f, 0.393505245f},
-std::array<float,2>{0.812888443f, 0.790031135f},
-std::array<float,2>{0.554838717f, 0.109743923f},
-std::array<float,2>{0.0399172008f, 0.586873889f},
-std::array<float,2>{0.145358101f, 0.248780966f},
-std::array<float,2>{0.728853524f, 0.725939691f},
-std::array<float,2>{0.980284393f, 0.264118105f},
-std::array<float,2>{0.256593406f, 0.981367052f},
-std::array<float,2>{0.344298154f, 0.0472483672f},
-std::array<float,2>{0.892048419f, 0.514721096f},
-std::array<float,2>{0.655821979f, 0.472531885f},
-std::array<float,2>{0.243792072f, 0.823930204f},
-std::array<float,2>{0.0857350379f, 0.348807245f},
-std::array<float,2>{0.591709316f, 0.907534003f},
-std::array<float,2>{0.767150164f, 0.174964413f},
-std::array<float,2>{0.494144976f, 0.646849632f},
-std::array<float,2>{0.477533162f, 0.324248701f},
-std::array<float,2>{0.759508729f, 0.879411817f},
-std::array<float,2>{0.577432752f, 0.15468429f},
-std::array<float,2>{0.0763258189f, 0.685079515f},
-std::array<float,2>{0.220447704f, 0.016980812f},
-std::array<float,2>{0.638594687f, 0.541796565f},
-std::array<float,2>{0.885970294f, 0.451684326f},
-std::array<float,2>{0.366757005f, 0.869231343f},
-std::array<float,2>{0.277154297f, 0.209752664f},
-std::array<float,2>{0.987269044f, 0.696551561f},
-std::array<float,2>{0.746093929f, 0.298947513f},
-std::array<float,2>{0.131274626f, 0.953922987f},
-std::array<float,2>{0.0533698872f, 0.41271168f},
-std::array<float,2>{0.534168422f, 0.75820297f},
-std::array<float,2>{0.838771284f, 0.0756715462f},
-std::array<float,2>{0.412792921f, 0.603922844f},
-std::array<float,2>{0.315958351f, 0.48837626f},
-std::array<float,2>{0.929792941f, 0.841303825f},
-std::array<float,2>{0.667405427f, 0.0423772261f},
-std::array<float,2>{0.210334539f, 0.528167069f},
-std::array<float,2>{0.119954102f, 0.169981137f},
-std::array<float,2>{0.624186218f, 0.638121367f},
-std::array<float,2>{0.789758325f, 0.374021411f},
-std::array<float,2>{0.444763124f, 0.929967046f},
-std::array<float,2>{0.389404356f, 0.104984745f},
-std::array<float,2>{0.871555209f, 0.567280412f},
-std::array<float,2>{0.515920877f, 0.380294412f},
-std::array<float,2>{0.0231409445f, 0.809394956f},
-std::array<float,2>{0.185295105f, 0.272095144f},
-std::array<float,2>{0.695816696f, 0.991452813f},
-std::array<float,2>{0.96622777f, 0.226074621f},
-std::array<float,2>{0.304422438f, 0.745848477f},
-std::array<float,2>{0.272478908f, 0.333723992f},
-std::array<float,2>{0.993715763f, 0.903490424f},
-std::array<float,2>{0.74156481f, 0.135566324f},
-std::array<float,2>{0.136704981f, 0.661756337f},
-std::array<float,2>{0.0567231812f, 0.00519674784f},
-std::array<float,2>{0.546645701f, 0.549670875f},
-std::array<float,2>{0.834430218f, 0.464761585f},
-std::array<float,2>{0.414772481f, 0.85308522f},
-std::array<float,2>{0.471503496f, 0.192580521f},
-std::array<float,2>{0.75572896f, 0.716853499f},
-std::array<float,2>{0.563417673f, 0.295562744f},
-std::array<float,2>{0.0644543916f, 0.949624062f},
-std::array<float,2>{0.228425026f, 0.430697262f},
-std::array<float,2>{0.62683475f, 0.778571606f},
-std::array<float,2>{0.881564379f, 0.0820972025f},
-std::array<float,2>{0.373260468f, 0.610825002f},
-std::array<float,2>{0.377055347f, 0.474329054f},
-std::array<float,2>{0.865297735f, 0.826841772f},
-std::array<float,2>{0.52396518f, 0.0523613952f},
-std::array<float,2>{0.0262924898f, 0.508070886f},
-std::array<float,2>{0.174611613f, 0.17826587f},
-std::array<float,2>{0.695095003f, 0.642546713f},
-std::array<float,2>{0.953141212f, 0.345852613f},
-std::array<float,2>{0.311516047f, 0.911091506f},
-std::array<float,2>{0.324006498f, 0.114055179f},
-std::array<float,2>{0.926781416f, 0.589940786f},
-std::array<float,2>{0.658640981f, 0.394831359f},
-std::array<float,2>{0.217525721f, 0.794615865f},
-std::array<float,2>{0.109467715f, 0.261683106f},
-std::array<float,2>{0.61489141f, 0.980354309f},
-std::array<float,2>{0.782287717f, 0.245656803f},
-std::array<float,2>{0.446125329f, 0.722390294f},
-std::array<float,2>{0.466051668f, 0.302555829f},
-std::array<float,2>{0.801140368f, 0.959563494f},
-std::array<float,2>{0.603138208f, 0.204695955f},
-std::array<float,2>{0.107112408f, 0.702637136f},
-std::array<float,2>{0.18759568f, 0.073567003f},
-std::array<float,2>{0.685660183f, 0.608879745f},
-std::array<float,2>{0.907482803f, 0.407218635f},
-std::array<float,2>{0.330819815f, 0.763935804f},
-std::array<float,2>{0.294867009f, 0.149769753f},
-std::array<float,2>{0.944052339f, 0.683501005f},
-std::array<float,2>{0.706082225f, 0.32171315f},
-std::array<float,2>{0.166143522f, 0.878387749f},
-std::array<float,2>{0.00555182714f, 0.445601493f},
-std::array<float,2>{0.504279733f, 0.872443795f},
-std::array<float,2>{0.853392065f, 0.0218021367f},
-std::array<float,2>{0.393350303f, 0.543252051f},
-std::array<float,2>{0.358337045f, 0.378768682f},
-std::array<float,2>{0.904038191f, 0.808364689f},
-std::array<float,2>{0.646676779f, 0.108724453f},
-std::array<float,2>{0.238592327f, 0.564800262f},
-std::array<float,2>{0.0907057673f, 0.219097838f},
-std::array<float,2>{0.582474709f, 0.747210264f},
-std::array<float,2>{0.779854953f, 0.266584098f},
-std::array<float,2>{0.488301128f, 0.988250852f},
-std::array<float,2>{0.428010404f, 0.0438394435f},
-std::array<float,2>{0.824846148f, 0.525208056f},
-std::array<float,2>{0.551540613f, 0.485939443f},
-std::array<float,2>{0.035472706f, 0.838582575f},
-std::array<float,2>{0.155688033f, 0.369115025f},
-std::array<float,2>{0.725819111f, 0.934461117f},
-std::array<float,2>{0.971146047f, 0.165272117f},
-std::array<float,2>{0.258843541f, 0.632814586f},
-std::array<float,2>{0.338587105f, 0.276966751f},
-std::array<float,2>{0.914703786f, 0.999805152f},
-std::array<float,2>{0.678885818f, 0.229423314f},
-std::array<float,2>{0.196706727f, 0.735482454f},
-std::array<float,2>{0.0985138789f, 0.0945229307f},
-std::array<float,2>{0.596589208f, 0.57770443f},
-std::array<float,2>{0.804978371f, 0.383072674f},
-std::array<float,2>{0.456091046f, 0.803819656f},
-std::array<float,2>{0.403414309f, 0.162340701f},
-std::array<float,2>{0.849736691f, 0.628852308f},
-std::array<float,2>{0.512328267f, 0.361801118f},
-std::array<float,2>{0.0120783262f, 0.926522791f},
-std::array<float,2>{0.156891987f, 0.493733644f},
-std::array<float,2>{0.713901401f, 0.834025383f},
-std::array<float,2>{0.948411942f, 0.033201389f},
-std::array<float,2>{0.281755894f, 0.518185616f},
-std::array<float,2>{0.49624297f, 0.416582465f},
-std::array<float,2>{0.770915389f, 0.751269579f},
-std::array<float,2>{0.588383794f, 0.063231118f},
-std::array<float,2>{0.0812611803f, 0.596505523f},
-std::array<float,2>{0.246346012f, 0.216111645f},
-std::array<float,2>{0.649912f, 0.688553214f},
-std::array<float,2>{0.8972525f, 0.309641689f},
-std::array<float,2>{0.348104447f, 0.968567073f},
-std::array<float,2>{0.253403127f, 0.0308656059f},
-std::array<float,2>{0.983095407f, 0.538976192f},
-std::array<float,2>{0.73343569f, 0.441422969f},
-std::array<float,2>{0.142528847f, 0.863532424f},
-std::array<float,2>{0.0433829799f, 0.320101112f},
-std::array<float,2>{0.559781611f, 0.88487184f},
-std::array<float,2>{0.820245445f, 0.143477648f},
-std::array<float,2>{0.434033453f, 0.678812325f},
-std::array<float,2>{0.407018393f, 0.353053987f},
-std::array<float,2>{0.841211796f, 0.921212077f},
-std::array<float,2>{0.536497116f, 0.186680123f},
-std::array<float,2>{0.0490540825f, 0.653552294f},
-std::array<float,2>{0.128574267f, 0.0550180152f},
-std::array<float,2>{0.744270802f, 0.500152528f},
-std::array<float,2>{0.991497576f, 0.482302725f},
-std::array<float,2>{0.280001372f, 0.81921488f},
-std::array<float,2>{0.363213569f, 0.238900319f},
-std::array<float,2>{0.887124062f, 0.727966309f},
-std::array<float,2>{0.632905185f, 0.257256627f},
-std::array<float,2>{0.22598657f, 0.973812997f},
-std::array<float,2>{0.0703434795f, 0.400439948f},
-std::array<float,2>{0.571960449f, 0.784609556f},
-std::array<float,2>{0.765050411f, 0.11746785f},
-std::array<float,2>{0.482346058f, 0.585366964f},
-std::array<float,2>{0.298921436f, 0.45812425f},
-std::array<float,2>{0.9629457f, 0.847447574f},
-std::array<float,2>{0.699232221f, 0.0139271952f},
-std::array<float,2>{0.180531248f, 0.556941032f},
-std::array<float,2>{0.0178369153f, 0.126320124f},
-std::array<float,2>{0.52187562f, 0.66915226f},
-std::array<float,2>{0.870949686f, 0.342293143f},
-std::array<float,2>{0.385434568f, 0.898230314f},
-std::array<float,2>{0.440585405f, 0.0929832533f},
-std::array<float,2>{0.79379487f, 0.62027812f},
-std::array<float,2>{0.619508684f, 0.423606515f},
-std::array<float,2>{0.122906826f, 0.773208201f},
-std::array<float,2>{0.206588745f, 0.283361256f},
-std::array<float,2>{0.671654165f, 0.938722014f},
-std::array<float,2>{0.935967088f, 0.195456654f},
-std::array<float,2>{0.317745298f, 0.70585531f},
-std::array<float,2>{0.325927198f, 0.313399822f},
-std::array<float,2>{0.924147487f, 0.890284359f},
-std::array<float,2>{0.660894156f, 0.145634413f},
-std::array<float,2>{0.214436993f, 0.673741698f},
-std::array<float,2>{0.116055951f, 0.024004057f},
-std::array<float,2>{0.609654844f, 0.533362806f},
-std::array<float,2>{0.785359859f, 0.43806389f},
-std::array<float,2>{0.449612379f, 0.862175405f},
-std::array<float,2>{0.380972445f, 0.214444101f},
-std::array<float,2>{0.860484242f, 0.694760799f},
-std::array<float,2>{0.531131923f, 0.306011647f},
-std::array<float,2>{0.0311685428f, 0.963554204f},
-std::array<float,2>{0.178253084f, 0.418017864f},
-std::array<float,2>{0.69050914f, 0.75493139f},
-std::array<float,2>{0.957840621f, 0.0678268895f},
-std::array<float,2>{0.307432532f, 0.598646998f},
-std::array<float,2>{0.473032564f, 0.497982442f},
-std::array<float,2>{0.753388286f, 0.830395758f},
-std::array<float,2>{0.568017066f, 0.0388719514f},
-std::array<float,2>{0.0668556169f, 0.523117304f},
-std::array<float,2>{0.231201246f, 0.157934621f},
-std::array<float,2>{0.630547166f, 0.631386399f},
-std::array<float,2>{0.877805769f, 0.365083069f},
-std::array<float,2>{0.370635688f, 0.922185481f},
-std::array<float,2>{0.265763819f, 0.0992634147f},
-std::array<float,2>{0.997185349f, 0.571204066f},
-std::array<float,2>{0.7375772f, 0.389122158f},
-std::array<float,2>{0.139874771f, 0.800268948f},
-std::array<float,2>{0.0608632565f, 0.280872405f},
-std::array<float,2>{0.542249739f, 0.994480848f},
-std::array<float,2>{0.829278767f, 0.233468518f},
-std::array<float,2>{0.419692278f, 0.739955962f},
-std::array<float,2>{0.422396868f, 0.285302967f},
-std::array<float,2>{0.821806192f, 0.941885054f},
-std::array<float,2>{0.548711717f, 0.199250117f},
-std::array<float,2>{0.0329464078f, 0.708406389f},
-std::array<float,2>{0.151925832f, 0.086528562f},
-std::array<float,2>{0.720526695f, 0.624883294f},
-std::array<float,2>{0.976281464f, 0.427358121f},
-std::array<float,2>{0.262426019f, 0.767268896f},
-std::array<float,2>{0.354603082f, 0.12963888f},
-std::array<float,2>{0.89868784f, 0.665510356f},
-std::array<float,2>{0.642056823f, 0.33924073f},
-std::array<float,2>{0.235774279f, 0.891230583f},
-std::array<float,2>{0.0896904394f, 0.453794628f},
-std::array<float,2>{0.579043031f, 0.850648701f},
-std::array<float,2>{0.777221382f, 0.00898201484f},
-std::array<float,2>{0.485830456f, 0.561409712f},
-std::array<float,2>{0.290876091f, 0.403273374f},
-std::array<float,2>{0.939939201f, 0.786321223f},
-std::array<float,2>{0.708801031f, 0.122994892f},
-std::array<float,2>{0.171445906f, 0.578495741f},
-std::array<float,2>{0.000800371519f, 0.236594737f},
-std::array<float,2>{0.502247095f, 0.730919063f},
-std::array<float,2>{0.858220041f, 0.253578007f},
-std::array<float,2>{0.396817148f, 0.970372915f},
-std::array<float,2>{0.464144588f, 0.0598432198f},
-std::array<float,2>{0.798561811f, 0.505283773f},
-std::array<float,2>{0.607917368f, 0.478466153f},
-std::array<float,2>{0.103488296f, 0.813553572f},
-std::array<float,2>{0.191949666f, 0.357972145f},
-std::array<float,2>{0.682477891f, 0.914200842f},
-std::array<float,2>{0.910184979f, 0.181298137f},
-std::array<float,2>{0.334026814f, 0.649918318f},
-std::array<float,2>{0.254817367f, 0.261950344f},
-std::array<float,2>{0.978317678f, 0.984305978f},
-std::array<float,2>{0.728321075f, 0.247981057f},
-std::array<float,2>{0.147014454f, 0.724586725f},
-std::array<float,2>{0.0414206982f, 0.112554707f},
-std::array<float,2>{0.557847261f, 0.588221073f},
-std::array<float,2>{0.81623745f, 0.391061634f},
-std::array<float,2>{0.433585793f, 0.792395294f},
-std::array<float,2>{0.493686527f, 0.173500448f},
-std::array<float,2>{0.768721998f, 0.644645214f},
-std::array<float,2>{0.592739165f, 0.349631459f},
-std::array<float,2>{0.0829956904f, 0.908288836f},
-std::array<float,2>{0.245172024f, 0.468947679f},
-std::array<float,2>{0.654028594f, 0.821750224f},
-std::array<float,2>{0.893316984f, 0.05042262f},
-std::array<float,2>{0.347630352f, 0.51253742f},
-std::array<float,2>{0.400246143f, 0.435306191f},
-std::array<float,2>{0.845862269f, 0.774145484f},
-std::array<float,2>{0.511595607f, 0.0803052858f},
-std::array<float,2>{0.00996415876f, 0.615724862f},
-std::array<float,2>{0.163721636f, 0.18778339f},
-std::array<float,2>{0.717824399f, 0.713931918f},
-std::array<float,2>{0.951986194f, 0.29200232f},
-std::array<float,2>{0.285874665f, 0.946305752f},
-std::array<float,2>{0.341354966f, 0.00204576389f},
-std::array<float,2>{0.919860303f, 0.5525828f},
-std::array<float,2>{0.673069417f, 0.465065718f},
-std::array<float,2>{0.201370358f, 0.857908607f},
-std::array<float,2>{0.0968296379f, 0.329164892f},
-std::array<float,2>{0.600016236f, 0.902060628f},
-std::array<float,2>{0.810221612f, 0.140427262f},
-std::array<float,2>{0.459869504f, 0.65747273f},
-std::array<float,2>{0.442092448f, 0.371130079f},
-std::array<float,2>{0.791187406f, 0.933057308f},
-std::array<float,2>{0.621255636f, 0.169833273f},
-std::array<float,2>{0.117664203f, 0.638979554f},
-std::array<float,2>{0.208201587f, 0.0408991687f},
-std::array<float,2>{0.665259838f, 0.530109584f},
-std::array<float,2>{0.933565021f, 0.490518332f},
-std::array<float,2>{0.313276589f, 0.842740834f},
-std::array<float,2>{0.301317066f, 0.222781003f},
-std::array<float,2>{0.96806711f, 0.743730724f},
-std::array<float,2>{0.69842732f, 0.269895196f},
-std::array<float,2>{0.186414525f, 0.989792049f},
-std::array<float,2>{0.0210948437f, 0.38090232f},
-std::array<float,2>{0.519079149f, 0.81069088f},
-std::array<float,2>{0.874773979f, 0.102211699f},
-std::array<float,2>{0.387316763f, 0.570022821f},
-std::array<float,2>{0.363685936f, 0.450134486f},
-std::array<float,2>{0.884202063f, 0.868580461f},
-std::array<float,2>{0.640097916f, 0.0184881985f},
-std::array<float,2>{0.222024709f, 0.539442182f},
-std::array<float,2>{0.0746811777f, 0.153629646f},
-std::array<float,2>{0.575238943f, 0.686202824f},
-std::array<float,2>{0.760746837f, 0.326503694f},
-std::array<float,2>{0.478799164f, 0.882481217f},
-std::array<float,2>{0.411188483f, 0.0765834004f},
-std::array<float,2>{0.836317062f, 0.603371978f},
-std::array<float,2>{0.531733096f, 0.410357505f},
-std::array<float,2>{0.0516087711f, 0.759857833f},
-std::array<float,2>{0.130491346f, 0.297556132f},
-std::array<float,2>{0.748683333f, 0.956261277f},
-std::array<float,2>{0.985331416f, 0.208568484f},
-std::array<float,2>{0.273755938f, 0.697882354f},
-std::array<float,2>{0.30984357f, 0.343992472f},
-std::array<float,2>{0.957021117f, 0.913689435f},
-std::array<float,2>{0.693166256f, 0.175782204f},
-std::array<float,2>{0.172666639f, 0.643446803f},
-std::array<float,2>{0.0244116932f, 0.0541880317f},
-std::array<float,2>{0.526425421f, 0.509772837f},
-std::array<float,2>{0.864957392f, 0.475896478f},
-std::array<float,2>{0.375411689f, 0.825929642f},
-std::array<float,2>{0.44817543f, 0.2427717f},
-std::array<float,2>{0.783230364f, 0.71986866f},
-std::array<float,2>{0.615829825f, 0.259411484f},
-std::array<float,2>{0.112099327f, 0.977367699f},
-std::array<float,2>{0.215324983f, 0.396987826f},
-std::array<float,2>{0.65733254f, 0.796652973f},
-std::array<float,2>{0.928821385f, 0.11613632f},
-std::array<float,2>{0.320422471f, 0.59219569f},
-std::array<float,2>{0.416671842f, 0.462681085f},
-std::array<float,2>{0.832642019f, 0.854144692f},
-std::array<float,2>{0.544528902f, 0.00719555886f},
-std::array<float,2>{0.0554264486f, 0.548339486f},
-std::array<float,2>{0.133203208f, 0.133476064f},
-std::array<float,2>{0.739669144f, 0.663543761f},
-std::array<float,2>{0.994681895f, 0.334405154f},
-std::array<float,2>{0.27047044f, 0.90537858f},
-std::array<float,2>{0.372643501f, 0.0857619569f},
-std::array<float,2>{0.879592597f, 0.613073945f},
-std::array<float,2>{0.628047407f, 0.432212234f},
-std::array<float,2>{0.230197892f, 0.780015826f},
-std::array<float,2>{0.0643439218f, 0.294532329f},
-std::array<float,2>{0.564796031f, 0.952444971f},
-std::array<float,2>{0.756673634f, 0.193913057f},
-std::array<float,2>{0.468994409f, 0.715630293f},
-std::array<float,2>{0.492056459f, 0.267873496f},
-std::array<float,2>{0.779127121f, 0.986100137f},
-std::array<float,2>{0.584349394f, 0.222057492f},
-std::array<float,2>{0.0927209109f, 0.74952817f},
-std::array<float,2>{0.240248665f, 0.106266849f},
-std::array<float,2>{0.645469248f, 0.564071655f},
-std::array<float,2>{0.904919028f, 0.375488013f},
-std::array<float,2>{0.355675876f, 0.80529052f},
-std::array<float,2>{0.260861844f, 0.166229889f},
-std::array<float,2>{0.970308304f, 0.63560766f},
-std::array<float,2>{0.72439748f, 0.371007532f},
-std::array<float,2>{0.154200584f, 0.935628891f},
-std::array<float,2>{0.0376850553f, 0.488029182f},
-std::array<float,2>{0.554317534f, 0.837576926f},
-std::array<float,2>{0.827839136f, 0.0453491323f},
-std::array<float,2>{0.427104026f, 0.527063489f},
-std::array<float,2>{0.329514176f, 0.40898627f},
-std::array<float,2>{0.908312798f, 0.763032377f},
-std::array<float,2>{0.684175253f, 0.0705289841f},
-std::array<float,2>{0.190521792f, 0.606070101f},
-std::array<float,2>{0.109033301f, 0.20646517f},
-std::array<float,2>{0.604635715f, 0.699739099f},
-std::array<float,2>{0.803646266f, 0.304217994f},
-std::array<float,2>{0.467906624f, 0.958599508f},
-std::array<float,2>{0.391546845f, 0.0214219689f},
-std::array<float,2>{0.853697479f, 0.546546757f},
-std::array<float,2>{0.507344306f, 0.448173344f},
-std::array<float,2>{0.00681350566f, 0.873858154f},
-std::array<float,2>{0.16553852f, 0.323589772f},
-std::array<float,2>{0.704032481f, 0.876578987f},
-std::array<float,2>{0.941617608f, 0.150486782f},
-std::array<float,2>{0.295156389f, 0.681245565f},
-std::array<float,2>{0.35136205f, 0.31184864f},
-std::array<float,2>{0.894883931f, 0.966149867f},
-std::array<float,2>{0.651755631f, 0.216865942f},
-std::array<float,2>{0.248354018f, 0.690449655f},
-std::array<float,2>{0.0785633847f, 0.0659924597f},
-std::array<float,2>{0.586836994f, 0.595371664f},
-std::array<float,2>{0.773339272f, 0.414548695f},
-std::array<float,2>{0.498735279f, 0.752193809f},
-std::array<float,2>{0.436642587f, 0.141290978f},
-std::array<float,2>{0.817391515f, 0.676251173f},
-std::array<float,2>{0.560737133f, 0.318001717f},
-std::array<float,2>{0.0460828692f, 0.884519339f},
-std::array<float,2>{0.142803699f, 0.445222914f},
-std::array<float,2>{0.732342482f, 0.865739882f},
-std::array<float,2>{0.982183158f, 0.0276238583f},
-std::array<float,2>{0.251883596f, 0.537041843f},
-std::array<float,2>{0.454206616f, 0.386695892f},
-std::array<float,2>{0.807280779f, 0.801950037f},
-std::array<float,2>{0.595231712f, 0.0966574624f},
-std::array<float,2>{0.100550964f, 0.574781775f},
-std::array<float,2>{0.197669744f, 0.228455991f},
-std::array<float,2>{0.675795794f, 0.737789631f},
-std::array<float,2>{0.917730033f, 0.274970353f},
-std::array<float,2>{0.336984038f, 0.997354329f},
-std::array<float,2>{0.284239471f, 0.0343809649f},
-std::array<float,2>{0.945688963f, 0.517095208f},
-std::array<float,2>{0.711334229f, 0.494409591f},
-std::array<float,2>{0.158962548f, 0.833006144f},
-std::array<float,2>{0.0153216003f, 0.361088365f},
-std::array<float,2>{0.515452027f, 0.928851247f},
-std::array<float,2>{0.848872721f, 0.161323383f},
-std::array<float,2>{0.406093448f, 0.62527591f},
-std::array<float,2>{0.383255929f, 0.341761202f},
-std::array<float,2>{0.867398441f, 0.894850135f},
-std::array<float,2>{0.520296693f, 0.12761198f},
-std::array<float,2>{0.0163624939f, 0.67051667f},
-std::array<float,2>{0.181655958f, 0.0123702483f},
-std::array<float,2>{0.701557338f, 0.556324482f},
-std::array<float,2>{0.962630033f, 0.459477335f},
-std::array<float,2>{0.29775539f, 0.845369101f},
-std::array<float,2>{0.320221514f, 0.197456703f},
-std::array<float,2>{0.933628976f, 0.703500032f},
-std::array<float,2>{0.668037355f, 0.282904714f},
-std::array<float,2>{0.204952255f, 0.940813005f},
-std::array<float,2>{0.123087823f, 0.42513296f},
-std::array<float,2>{0.618360817f, 0.771025479f},
-std::array<float,2>{0.795511723f, 0.0915371329f},
-std::array<float,2>{0.43787688f, 0.617444992f},
-std::array<float,2>{0.279005677f, 0.483619422f},
-std::array<float,2>{0.988704622f, 0.817667425f},
-std::array<float,2>{0.742665112f, 0.0569626689f},
-std::array<float,2>{0.12551932f, 0.502785027f},
-std::array<float,2>{0.0477474928f, 0.183970764f},
-std::array<float,2>{0.538575649f, 0.655949533f},
-std::array<float,2>{0.842424035f, 0.35530293f},
-std::array<float,2>{0.410075396f, 0.91924572f},
-std::array<float,2>{0.482695222f, 0.119732328f},
-std::array<float,2>{0.761733651f, 0.583572447f},
-std::array<float,2>{0.572645009f, 0.398503691f},
-std::array<float,2>{0.073356688f, 0.781730235f},
-std::array<float,2>{0.224408492f, 0.254716903f},
-std::array<float,2>{0.63637358f, 0.975409687f},
-std::array<float,2>{0.890046597f, 0.240839005f},
-std::array<float,2>{0.36030978f, 0.729075432f},
-std::array<float,2>{0.33511734f, 0.356847137f},
-std::array<float,2>{0.911635518f, 0.916795373f},
-std::array<float,2>{0.682653844f, 0.183000669f},
-std::array<float,2>{0.192542717f, 0.650992155f},
-std::array<float,2>{0.102145642f, 0.0606306866f},
-std::array<float,2>{0.608800292f, 0.506138504f},
-std::array<float,2>{0.797233582f, 0.478634298f},
-std::array<float,2>{0.463461369f, 0.815752923f},
-std::array<float,2>{0.397570521f, 0.235059008f},
-std::array<float,2>{0.859008253f, 0.733468115f},
-std::array<float,2>{0.503220439f, 0.251033336f},
-std::array<float,2>{0.00166605215f, 0.97255218f},
-std::array<float,2>{0.170477018f, 0.405864984f},
-std::array<float,2>{0.707978249f, 0.787451088f},
-std::array<float,2>{0.940853655f, 0.123451844f},
-std::array<float,2>{0.289066434f, 0.581809938f},
-std::array<float,2>{0.484686017f, 0.455215067f},
-std::array<float,2>{0.776153505f, 0.848441005f},
-std::array<float,2>{0.579138219f, 0.011326489f},
-std::array<float,2>{0.0878964588f, 0.558726251f},
-std::array<float,2>{0.234596044f, 0.132453829f},
-std::array<float,2>{0.641230762f, 0.666042805f},
-std::array<float,2>{0.900049269f, 0.336017489f},
-std::array<float,2>{0.353764981f, 0.893958032f},
-std::array<float,2>{0.26358068f, 0.087949574f},
-std::array<float,2>{0.975464404f, 0.621235788f},
-std::array<float,2>{0.71917665f, 0.428315222f},
-std::array<float,2>{0.15084821f, 0.768426955f},
-std::array<float,2>{0.0316634476f, 0.287314802f},
-std::array<float,2>{0.546959341f, 0.943546891f},
-std::array<float,2>{0.820973158f, 0.201954246f},
-std::array<float,2>{0.423650801f, 0.709394276f},
-std::array<float,2>{0.418654501f, 0.277550519f},
-std::array<float,2>{0.828799248f, 0.993129134f},
-std::array<float,2>{0.541862071f, 0.232073128f},
-std::array<float,2>{0.0623483099f, 0.740495205f},
-std::array<float,2>{0.139568731f, 0.101440571f},
-std::array<float,2>{0.736958742f, 0.573915541f},
-std::array<float,2>{0.996499896f, 0.387012064f},
-std::array<float,2>{0.267390549f, 0.79728651f},
-std::array<float,2>{0.369211495f, 0.158638224f},
-std::array<float,2>{0.878306806f, 0.630219817f},
-std::array<float,2>{0.629583418f, 0.365995973f},
-std::array<float,2>{0.232206509f, 0.925097346f},
-std::array<float,2>{0.0681236163f, 0.498283029f},
-std::array<float,2>{0.56686902f, 0.828306198f},
-std::array<float,2>{0.752173245f, 0.0359862f},
-std::array<float,2>{0.474081784f, 0.521296144f},
-std::array<float,2>{0.308379024f, 0.420525432f},
-std::array<float,2>{0.958073735f, 0.757661939f},
-std::array<float,2>{0.689476609f, 0.0700916126f},
-std::array<float,2>{0.178719521f, 0.600228608f},
-std::array<float,2>{0.029928837f, 0.211289749f},
-std::array<float,2>{0.530023515f, 0.693175495f},
-std::array<float,2>{0.859697521f, 0.308003128f},
-std::array<float,2>{0.382785827f, 0.962836802f},
-std::array<float,2>{0.451159269f, 0.0264035538f},
-std::array<float,2>{0.786431313f, 0.533151746f},
-std::array<float,2>{0.610926092f, 0.440254271f},
-std::array<float,2>{0.116555423f, 0.859564781f},
-std::array<float,2>{0.213856891f, 0.315661579f},
-std::array<float,2>{0.661231577f, 0.888355732f},
-std::array<float,2>{0.925562918f, 0.146912143f},
-std::array<float,2>{0.324519366f, 0.673962057f},
-std::array<float,2>{0.274414152f, 0.300171196f},
-std::array<float,2>{0.985893548f, 0.954160213f},
-std::array<float,2>{0.749340773f, 0.210538641f},
-std::array<float,2>{0.129665852f, 0.695779145f},
-std::array<float,2>{0.0526449233f, 0.0745919123f},
-std::array<float,2>{0.532735527f, 0.604914725f},
-std::array<float,2>{0.837300837f, 0.413305312f},
-std::array<float,2>{0.410963386f, 0.759758949f},
-std::array<float,2>{0.47996828f, 0.15570426f},
-std::array<float,2>{0.760685205f, 0.684022188f},
-std::array<float,2>{0.574365973f, 0.325883031f},
-std::array<float,2>{0.0755343363f, 0.880215645f},
-std::array<float,2>{0.221054792f, 0.45266214f},
-std::array<float,2>{0.638755083f, 0.870312452f},
-std::array<float,2>{0.882873774f, 0.0163579918f},
-std::array<float,2>{0.364958733f, 0.542519987f},
-std::array<float,2>{0.387847632f, 0.37927103f},
-std::array<float,2>{0.873993635f, 0.810266912f},
-std::array<float,2>{0.517690539f, 0.104180753f},
-std::array<float,2>{0.0204793178f, 0.567543685f},
-std::array<float,2>{0.186752915f, 0.224729538f},
-std::array<float,2>{0.69734478f, 0.744286597f},
-std::array<float,2>{0.967522562f, 0.272781789f},
-std::array<float,2>{0.302405059f, 0.990237355f},
-std::array<float,2>{0.313547105f, 0.0410468802f},
-std::array<float,2>{0.932097733f, 0.529204309f},
-std::array<float,2>{0.664706886f, 0.489479601f},
-std::array<float,2>{0.207081839f, 0.840650439f},
-std::array<float,2>{0.118742354f, 0.374798089f},
-std::array<float,2>{0.622898161f, 0.931155324f},
-std::array<float,2>{0.792118311f, 0.171457872f},
-std::array<float,2>{0.442843765f, 0.636848927f},
-std::array<float,2>{0.459968656f, 0.330686957f},
-std::array<float,2>{0.808655739f, 0.89880842f},
-std::array<float,2>{0.601052225f, 0.138520584f},
-std::array<float,2>{0.0958686024f, 0.660083234f},
-std::array<float,2>{0.203067675f, 0.000554870057f},
-std::array<float,2>{0.67227453f, 0.552788496f},
-std::array<float,2>{0.918876767f, 0.467300385f},
-std::array<float,2>{0.340284497f, 0.856827974f},
-std::array<float,2>{0.286198318f, 0.190624759f},
-std::array<float,2>{0.952594221f, 0.711309731f},
-std::array<float,2>{0.717428327f, 0.290776402f},
-std::array<float,2>{0.162318766f, 0.948871315f},
-std::array<float,2>{0.0112540266f, 0.436164528f},
-std::array<float,2>{0.510097802f, 0.777315199f},
-std::array<float,2>{0.847271681f, 0.0798013806f},
-std::array<float,2>{0.398954481f, 0.613790512f},
-std::array<float,2>{0.345878482f, 0.471617132f},
-std::array<float,2>{0.894518018f, 0.82241714f},
-std::array<float,2>{0.652401805f, 0.0482930355f},
-std::array<float,2>{0.244346604f, 0.514442563f},
-std::array<float,2>{0.083731629f, 0.174439713f},
-std::array<float,2>{0.593142569f, 0.647660494f},
-std::array<float,2>{0.767685473f, 0.348457277f},
-std::array<float,2>{0.492942631f, 0.906767249f},
-std::array<float,2>{0.432190299f, 0.110868707f},
-std::array<float,2>{0.815124333f, 0.587124944f},
-std::array<float,2>{0.557335734f, 0.39401564f},
-std::array<float,2>{0.0424369872f, 0.790410697f},
-std::array<float,2>{0.147623822f, 0.264835715f},
-std::array<float,2>{0.727151692f, 0.982304096f},
-std::array<float,2>{0.976961315f, 0.24958545f},
-std::array<float,2>{0.255545199f, 0.725253642f},
-std::array<float,2>{0.295976579f, 0.320851028f},
-std::array<float,2>{0.943012834f, 0.877551496f},
-std::array<float,2>{0.704531372f, 0.149080634f},
-std::array<float,2>{0.164496616f, 0.682473898f},
-std::array<float,2>{0.00763901463f, 0.0234212987f},
-std::array<float,2>{0.506647944f, 0.544365585f},
-std::array<float,2>{0.854596436f, 0.446803361f},
-std::array<float,2>{0.392466694f, 0.871416152f},
-std::array<float,2>{0.46708414f, 0.203192726f},
-std::array<float,2>{0.80429244f, 0.701257944f},
-std::array<float,2>{0.603916228f, 0.301329851f},
-std::array<float,2>{0.107530199f, 0.960615098f},
-std::array<float,2>{0.189517677f, 0.407898068f},
-std::array<float,2>{0.685450494f, 0.765327513f},
-std::array<float,2>{0.909451365f, 0.0725608021f},
-std::array<float,2>{0.328565627f, 0.607838929f},
-std::array<float,2>{0.426258653f, 0.484492332f},
-std::array<float,2>{0.826579571f, 0.839105844f},
-std::array<float,2>{0.553526044f, 0.0440365784f},
-std::array<float,2>{0.0385435708f, 0.523660421f},
-std::array<float,2>{0.153059497f, 0.16407606f},
-std::array<float,2>{0.723439276f, 0.63476181f},
-std::array<float,2>{0.969523311f, 0.367531538f},
-std::array<float,2>{0.260585636f, 0.934594095f},
-std::array<float,2>{0.356899023f, 0.107578285f},
-std::array<float,2>{0.905921817f, 0.566331446f},
-std::array<float,2>{0.646040738f, 0.377740741f},
-std::array<float,2>{0.242020324f, 0.8073892f},
-std::array<float,2>{0.0937382802f, 0.267079026f},
-std::array<float,2>{0.585331559f, 0.986667514f},
-std::array<float,2>{0.777548909f, 0.219950631f},
-std::array<float,2>{0.490548074f, 0.746505976f},
-std::array<float,2>{0.47064966f, 0.296082348f},
-std::array<float,2>{0.756922424f, 0.95033145f},
-std::array<float,2>{0.565924764f, 0.192293286f},
-std::array<float,2>{0.0626888797f, 0.718476653f},
-std::array<float,2>{0.229016095f, 0.0835129246f},
-std::array<float,2>{0.627601147f, 0.609436512f},
-std::array<float,2>{0.88052249f, 0.429903477f},
-std::array<float,2>{0.371899039f, 0.777628958f},
-std::array<float,2>{0.271196991f, 0.136579737f},
-std::array<float,2>{0.995226741f, 0.660288215f},
-std::array<float,2>{0.738444567f, 0.332994223f},
-std::array<float,2>{0.134694666f, 0.90319699f},
-std::array<float,2>{0.0560295433f, 0.463506967f},
-std::array<float,2>{0.543295085f, 0.851613224f},
-std::array<float,2>{0.83348757f, 0.00481626811f},
-std::array<float,2>{0.417183727f, 0.550774515f},
-std::array<float,2>{0.321318626f, 0.39552933f},
-std::array<float,2>{0.927915394f, 0.793636143f},
-std::array<float,2>{0.656536758f, 0.114735879f},
-std::array<float,2>{0.216472998f, 0.590944767f},
-std::array<float,2>{0.112902418f, 0.245044664f},
-std::array<float,2>{0.616859913f, 0.720723093f},
-std::array<float,2>{0.7845065f, 0.260102868f},
-std::array<float,2>{0.448287189f, 0.979223967f},
-std::array<float,2>{0.376263499f, 0.0509834699f},
-std::array<float,2>{0.864244759f, 0.509572208f},
-std::array<float,2>{0.525606036f, 0.473392904f},
-std::array<float,2>{0.0251668468f, 0.827332318f},
-std::array<float,2>{0.173225373f, 0.346984923f},
-std::array<float,2>{0.691937208f, 0.911783397f},
-std::array<float,2>{0.955263793f, 0.179457277f},
-std::array<float,2>{0.308692008f, 0.641376495f},
-std::array<float,2>{0.360938221f, 0.256091326f},
-std::array<float,2>{0.889428556f, 0.972718179f},
-std::array<float,2>{0.634783685f, 0.239996314f},
-std::array<float,2>{0.22340402f, 0.727495015f},
-std::array<float,2>{0.0731576085f, 0.11851646f},
-std::array<float,2>{0.573365927f, 0.584795237f},
-std::array<float,2>{0.763430119f, 0.401415765f},
-std::array<float,2>{0.483856738f, 0.783381939f},
-std::array<float,2>{0.409015357f, 0.185674772f},
-std::array<float,2>{0.843542397f, 0.653091252f},
-std::array<float,2>{0.537289441f, 0.351583689f},
-std::array<float,2>{0.0485257208f, 0.920392632f},
-std::array<float,2>{0.126489133f, 0.481029272f},
-std::array<float,2>{0.744026482f, 0.819399893f},
-std::array<float,2>{0.98952055f, 0.0564879328f},
-std::array<float,2>{0.277910709f, 0.50175482f},
-std::array<float,2>{0.438799232f, 0.4222458f},
-std::array<float,2>{0.796293378f, 0.771935701f},
-std::array<float,2>{0.617665529f, 0.0921879038f},
-std::array<float,2>{0.124989718f, 0.619743049f},
-std::array<float,2>{0.203706071f, 0.19683589f},
-std::array<float,2>{0.669816434f, 0.706889451f},
-std::array<float,2>{0.935225964f, 0.284277588f},
-std::array<float,2>{0.318694293f, 0.938008785f},
-std::array<float,2>{0.298806369f, 0.0148578873f},
-std::array<float,2>{0.961130202f, 0.558268785f},
-std::array<float,2>{0.702685118f, 0.457781225f},
-std::array<float,2>{0.183094174f, 0.846460581f},
-std::array<float,2>{0.0167196542f, 0.343618333f},
-std::array<float,2>{0.520606399f, 0.896874428f},
-std::array<float,2>{0.86876297f, 0.125324547f},
-std::array<float,2>{0.3841573f, 0.668589532f},
-std::array<float,2>{0.404365212f, 0.3626315f},
-std::array<float,2>{0.847927153f, 0.927695453f},
-std::array<float,2>{0.513789356f, 0.163279667f},
-std::array<float,2>{0.0142797288f, 0.627374589f},
-std::array<float,2>{0.159191296f, 0.0313784815f},
-std::array<float,2>{0.712195456f, 0.51945436f},
-std::array<float,2>{0.946724594f, 0.492631435f},
-std::array<float,2>{0.284004033f, 0.835456014f},
-std::array<float,2>{0.336366534f, 0.230012774f},
-std::array<float,2>{0.916039348f, 0.734585166f},
-std::array<float,2>{0.677423358f, 0.276091307f},
-std::array<float,2>{0.198943153f, 0.998431444f},
-std::array<float,2>{0.101379581f, 0.384573847f},
-std::array<float,2>{0.593907654f, 0.803346694f},
-std::array<float,2>{0.808261871f, 0.0953188241f},
-std::array<float,2>{0.453420907f, 0.576399028f},
-std::array<float,2>{0.250905156f, 0.443145603f},
-std::array<float,2>{0.980573833f, 0.865033746f},
-std::array<float,2>{0.731120706f, 0.0293403268f},
-std::array<float,2>{0.144024014f, 0.537425935f},
-std::array<float,2>{0.045495946f, 0.143901408f},
-std::array<float,2>{0.562105417f, 0.678210139f},
-std::array<float,2>{0.816494405f, 0.31916219f},
-std::array<float,2>{0.435650826f, 0.886574149f},
-std::array<float,2>{0.499182016f, 0.0640073195f},
-std::array<float,2>{0.771975219f, 0.596967697f},
-std::array<float,2>{0.587708235f, 0.417489409f},
-std::array<float,2>{0.0793579295f, 0.750936627f},
-std::array<float,2>{0.249500096f, 0.308852375f},
-std::array<float,2>{0.650558293f, 0.967064023f},
-std::array<float,2>{0.896290302f, 0.215485945f},
-std::array<float,2>{0.350085109f, 0.687693238f},
-std::array<float,2>{0.353021652f, 0.338422477f},
-std::array<float,2>{0.902146697f, 0.892171979f},
-std::array<float,2>{0.643960416f, 0.130135477f},
-std::array<float,2>{0.236818686f, 0.665017664f},
-std::array<float,2>{0.0869168714f, 0.00830228161f},
-std::array<float,2>{0.581179738f, 0.561734378f},
-std::array<float,2>{0.77371031f, 0.454633862f},
-std::array<float,2>{0.487509549f, 0.850353956f},
-std::array<float,2>{0.424649626f, 0.200755671f},
-std::array<float,2>{0.82394433f, 0.707667112f},
-std::array<float,2>{0.550228894f, 0.286201477f},
-std::array<float,2>{0.0344957225f, 0.943049967f},
-std::array<float,2>{0.150013968f, 0.426333576f},
-std::array<float,2>{0.721294165f, 0.766568184f},
-std::array<float,2>{0.973429561f, 0.0877679363f},
-std::array<float,2>{0.264730185f, 0.623248994f},
-std::array<float,2>{0.462873906f, 0.476569504f},
-std::array<float,2>{0.799020112f, 0.813180566f},
-std::array<float,2>{0.606722772f, 0.0587339699f},
-std::array<float,2>{0.105251409f, 0.504588902f},
-std::array<float,2>{0.193764791f, 0.180432051f},
-std::array<float,2>{0.680937111f, 0.648600698f},
-std::array<float,2>{0.913158655f, 0.35875988f},
-std::array<float,2>{0.333944589f, 0.915965676f},
-std::array<float,2>{0.292399555f, 0.12111102f},
-std::array<float,2>{0.938509583f, 0.579203308f},
-std::array<float,2>{0.70955795f, 0.403598189f},
-std::array<float,2>{0.168221965f, 0.78557992f},
-std::array<float,2>{0.0034292764f, 0.252543211f},
-std::array<float,2>{0.500334442f, 0.968929231f},
-std::array<float,2>{0.856671154f, 0.237731472f},
-std::array<float,2>{0.395404249f, 0.731896579f},
-std::array<float,2>{0.380852491f, 0.304706514f},
-std::array<float,2>{0.861486852f, 0.964075863f},
-std::array<float,2>{0.527571797f, 0.213556752f},
-std::array<float,2>{0.0290660635f, 0.693369806f},
-std::array<float,2>{0.17749849f, 0.0667297617f},
-std::array<float,2>{0.687584996f, 0.598203242f},
-std::array<float,2>{0.959743321f, 0.419811398f},
-std::array<float,2>{0.306445241f, 0.754015625f},
-std::array<float,2>{0.326907903f, 0.145408228f},
-std::array<float,2>{0.923101902f, 0.671910048f},
-std::array<float,2>{0.663599372f, 0.313990325f},
-std::array<float,2>{0.211533546f, 0.888792574f},
-std::array<float,2>{0.115055062f, 0.43926993f},
-std::array<float,2>{0.611787736f, 0.862909138f},
-std::array<float,2>{0.788947225f, 0.0251749996f},
-std::array<float,2>{0.451620251f, 0.534382939f},
-std::array<float,2>{0.268661797f, 0.389655948f},
-std::array<float,2>{0.998337626f, 0.79918921f},
-std::array<float,2>{0.734982312f, 0.0984943733f},
-std::array<float,2>{0.137364283f, 0.571755886f},
-std::array<float,2>{0.0599986501f, 0.233106986f},
-std::array<float,2>{0.540853977f, 0.738359392f},
-std::array<float,2>{0.831802487f, 0.280222028f},
-std::array<float,2>{0.421505451f, 0.995825231f},
-std::array<float,2>{0.475575864f, 0.0374984443f},
-std::array<float,2>{0.750344753f, 0.521593869f},
-std::array<float,2>{0.570084214f, 0.496702254f},
-std::array<float,2>{0.0699462742f, 0.831477106f},
-std::array<float,2>{0.232662752f, 0.363552302f},
-std::array<float,2>{0.631706774f, 0.923595488f},
-std::array<float,2>{0.875626504f, 0.15721114f},
-std::array<float,2>{0.368534088f, 0.632531285f},
-std::array<float,2>{0.303041875f, 0.270707965f},
-std::array<float,2>{0.965367734f, 0.988895535f},
-std::array<float,2>{0.696780145f, 0.223706037f},
-std::array<float,2>{0.183698893f, 0.742324412f},
-std::array<float,2>{0.0224430561f, 0.102643013f},
-std::array<float,2>{0.516884923f, 0.569271863f},
-std::array<float,2>{0.872687638f, 0.382628083f},
-std::array<float,2>{0.389910132f, 0.811962783f},
-std::array<float,2>{0.444015414f, 0.168139502f},
-std::array<float,2>{0.790094435f, 0.639947474f},
-std::array<float,2>{0.623768866f, 0.372220486f},
-std::array<float,2>{0.120859556f, 0.932014585f},
-std::array<float,2>{0.209065974f, 0.492002487f},
-std::array<float,2>{0.666275322f, 0.843007267f},
-std::array<float,2>{0.931584239f, 0.0397115722f},
-std::array<float,2>{0.315081567f, 0.531107128f},
-std::array<float,2>{0.413093656f, 0.411394477f},
-std::array<float,2>{0.839138269f, 0.761167765f},
-std::array<float,2>{0.534966469f, 0.0775076523f},
-std::array<float,2>{0.0542257465f, 0.602244794f},
-std::array<float,2>{0.132664219f, 0.207301438f},
-std::array<float,2>{0.7474702f, 0.698879659f},
-std::array<float,2>{0.987422168f, 0.298355132f},
-std::array<float,2>{0.275595695f, 0.955753565f},
-std::array<float,2>{0.365492076f, 0.0190192107f},
-std::array<float,2>{0.885154009f, 0.54099369f},
-std::array<float,2>{0.637475908f, 0.450701177f},
-std::array<float,2>{0.21971035f, 0.867813528f},
-std::array<float,2>{0.0777088031f, 0.327803463f},
-std::array<float,2>{0.576736569f, 0.881446481f},
-std::array<float,2>{0.757829368f, 0.153070837f},
-std::array<float,2>{0.478496134f, 0.687160194f},
-std::array<float,2>{0.495347381f, 0.351261288f},
-std::array<float,2>{0.766368568f, 0.909522355f},
-std::array<float,2>{0.590438962f, 0.172545329f},
-std::array<float,2>{0.084557429f, 0.646414816f},
-std::array<float,2>{0.243054941f, 0.0496584773f},
-std::array<float,2>{0.65446949f, 0.512885392f},
-std::array<float,2>{0.891270697f, 0.469921231f},
-std::array<float,2>{0.344954252f, 0.820473433f},
-std::array<float,2>{0.25774166f, 0.247023821f},
-std::array<float,2>{0.978530705f, 0.723418415f},
-std::array<float,2>{0.730002642f, 0.263549f},
-std::array<float,2>{0.145561844f, 0.982506692f},
-std::array<float,2>{0.0400718562f, 0.392455846f},
-std::array<float,2>{0.556362391f, 0.791607738f},
-std::array<float,2>{0.813835084f, 0.111495622f},
-std::array<float,2>{0.430644244f, 0.589061797f},
-std::array<float,2>{0.34342134f, 0.466491878f},
-std::array<float,2>{0.920488596f, 0.85916549f},
-std::array<float,2>{0.673866689f, 0.00321604707f},
-std::array<float,2>{0.199873999f, 0.551485538f},
-std::array<float,2>{0.0941977948f, 0.13952668f},
-std::array<float,2>{0.599502563f, 0.656321287f},
-std::array<float,2>{0.81226939f, 0.328674704f},
-std::array<float,2>{0.457993358f, 0.900651813f},
-std::array<float,2>{0.401635379f, 0.0811497867f},
-std::array<float,2>{0.843955159f, 0.61683023f},
-std::array<float,2>{0.508928776f, 0.434033245f},
-std::array<float,2>{0.00822630897f, 0.77483809f},
-std::array<float,2>{0.160847738f, 0.291030437f},
-std::array<float,2>{0.715249181f, 0.945795417f},
-std::array<float,2>{0.949769557f, 0.188778713f},
-std::array<float,2>{0.287950724f, 0.713109732f},
-std::array<float,2>{0.258551717f, 0.369230002f},
-std::array<float,2>{0.972412646f, 0.93683213f},
-std::array<float,2>{0.724996388f, 0.16743587f},
-std::array<float,2>{0.154823452f, 0.635830939f},
-std::array<float,2>{0.0364029519f, 0.0464374349f},
-std::array<float,2>{0.552040756f, 0.52548492f},
-std::array<float,2>{0.825389028f, 0.486454278f},
-std::array<float,2>{0.429267019f, 0.836197436f},
-std::array<float,2>{0.489810079f, 0.221475765f},
-std::array<float,2>{0.780791283f, 0.748673081f},
-std::array<float,2>{0.583140135f, 0.26930964f},
-std::array<float,2>{0.0915683359f, 0.985082626f},
-std::array<float,2>{0.239980504f, 0.376133353f},
-std::array<float,2>{0.648017287f, 0.806309879f},
-std::array<float,2>{0.902754545f, 0.10655231f},
-std::array<float,2>{0.359116793f, 0.563149273f},
-std::array<float,2>{0.394051075f, 0.448372155f},
-std::array<float,2>{0.851782799f, 0.874339759f},
-std::array<float,2>{0.50556016f, 0.0196263772f},
-std::array<float,2>{0.00415549241f, 0.545124292f},
-std::array<float,2>{0.167354777f, 0.151753649f},
-std::array<float,2>{0.70531863f, 0.679902315f},
-std::array<float,2>{0.944936216f, 0.322451293f},
-std::array<float,2>{0.293667376f, 0.875022531f},
-std::array<float,2>{0.331192404f, 0.0715603083f},
-std::array<float,2>{0.906349599f, 0.607382715f},
-std::array<float,2>{0.687132239f, 0.409202933f},
-std::array<float,2>{0.188851714f, 0.762019873f},
-std::array<float,2>{0.1064054f, 0.30336225f},
-std::array<float,2>{0.601949215f, 0.957686603f},
-std::array<float,2>{0.80209446f, 0.205801994f},
-std::array<float,2>{0.465499848f, 0.700500429f},
-std::array<float,2>{0.44706282f, 0.258350402f},
-std::array<float,2>{0.781474233f, 0.977956414f},
-std::array<float,2>{0.613389611f, 0.243516043f},
-std::array<float,2>{0.110676266f, 0.719020188f},
-std::array<float,2>{0.217877552f, 0.116906047f},
-std::array<float,2>{0.659674764f, 0.593681335f},
-std::array<float,2>{0.926756442f, 0.397469252f},
-std::array<float,2>{0.323074996f, 0.795349002f},
-std::array<float,2>{0.312363237f, 0.17756635f},
-std::array<float,2>{0.954111516f, 0.644207001f},
-std::array<float,2>{0.693662643f, 0.344865918f},
-std::array<float,2>{0.175426006f, 0.913055718f},
-std::array<float,2>{0.02686028f, 0.475266725f},
-std::array<float,2>{0.525042117f, 0.824521601f},
-std::array<float,2>{0.866449237f, 0.0528120436f},
-std::array<float,2>{0.378270119f, 0.511390805f},
-std::array<float,2>{0.374683261f, 0.433321893f},
-std::array<float,2>{0.882526219f, 0.780610025f},
-std::array<float,2>{0.625339568f, 0.0848317593f},
-std::array<float,2>{0.227074325f, 0.611721873f},
-std::array<float,2>{0.0658227578f, 0.195144966f},
-std::array<float,2>{0.563497007f, 0.716148555f},
-std::array<float,2>{0.754205585f, 0.293791801f},
-std::array<float,2>{0.472622991f, 0.951608419f},
-std::array<float,2>{0.415866166f, 0.00621823501f},
-std::array<float,2>{0.835266471f, 0.547685146f},
-std::array<float,2>{0.545268297f, 0.461868405f},
-std::array<float,2>{0.0576436967f, 0.855207622f},
-std::array<float,2>{0.135125369f, 0.335501492f},
-std::array<float,2>{0.740775883f, 0.904454231f},
-std::array<float,2>{0.992305458f, 0.134065717f},
-std::array<float,2>{0.271751493f, 0.662366152f},
-std::array<float,2>{0.316834986f, 0.281395376f},
-std::array<float,2>{0.936626494f, 0.939868331f},
-std::array<float,2>{0.670326054f, 0.198355004f},
-std::array<float,2>{0.205394551f, 0.704888403f},
-std::array<float,2>{0.121465385f, 0.0907318145f},
-std::array<float,2>{0.620380402f, 0.618174195f},
-std::array<float,2>{0.794117749f, 0.424644917f},
-std::array<float,2>{0.439531118f, 0.770325065f},
-std::array<float,2>{0.386085182f, 0.128141478f},
-std::array<float,2>{0.869546115f, 0.671772897f},
-std::array<float,2>{0.52290386f, 0.340270162f},
-std::array<float,2>{0.018928159f, 0.895520568f},
-std::array<float,2>{0.181394622f, 0.460527599f},
-std::array<float,2>{0.700772703f, 0.844284117f},
-std::array<float,2>{0.964491069f, 0.0135068037f},
-std::array<float,2>{0.300417811f, 0.555033386f},
-std::array<float,2>{0.480600417f, 0.400193125f},
-std::array<float,2>{0.764027178f, 0.783128202f},
-std::array<float,2>{0.570402443f, 0.120727584f},
-std::array<float,2>{0.0720102489f, 0.582996905f},
-std::array<float,2>{0.224873543f, 0.241652876f},
-std::array<float,2>{0.634099066f, 0.729536176f},
-std::array<float,2>{0.888046145f, 0.254915357f},
-std::array<float,2>{0.362015635f, 0.975720942f},
-std::array<float,2>{0.281115949f, 0.0579873472f},
-std::array<float,2>{0.990304291f, 0.50386405f},
-std::array<float,2>{0.745704472f, 0.483225465f},
-std::array<float,2>{0.127598703f, 0.817346811f},
-std::array<float,2>{0.0503279418f, 0.354126841f},
-std::array<float,2>{0.535576642f, 0.918675065f},
-std::array<float,2>{0.840765834f, 0.184913307f},
-std::array<float,2>{0.407250881f, 0.655117929f},
-std::array<float,2>{0.435309112f, 0.316496491f},
-std::array<float,2>{0.818630636f, 0.883563221f},
-std::array<float,2>{0.559415042f, 0.141809911f},
-std::array<float,2>{0.0446416661f, 0.677324414f},
-std::array<float,2>{0.141046301f, 0.0283702891f},
-std::array<float,2>{0.733268082f, 0.535640597f},
-std::array<float,2>{0.9834764f, 0.443972975f},
-std::array<float,2>{0.252711385f, 0.867130637f},
-std::array<float,2>{0.349124372f, 0.218454883f},
-std::array<float,2>{0.898220062f, 0.690086961f},
-std::array<float,2>{0.648864269f, 0.311357409f},
-std::array<float,2>{0.247097135f, 0.965244472f},
-std::array<float,2>{0.0802668631f, 0.41568616f},
-std::array<float,2>{0.589487851f, 0.753265619f},
-std::array<float,2>{0.770195365f, 0.0651281923f},
-std::array<float,2>{0.497077167f, 0.594360292f},
-std::array<float,2>{0.283076942f, 0.49550426f},
-std::array<float,2>{0.948217392f, 0.833089352f},
-std::array<float,2>{0.713004649f, 0.0339195877f},
-std::array<float,2>{0.157557547f, 0.516495585f},
-std::array<float,2>{0.0136552611f, 0.160592198f},
-std::array<float,2>{0.512848794f, 0.62693435f},
-std::array<float,2>{0.851319015f, 0.359450907f},
-std::array<float,2>{0.403083503f, 0.928207517f},
-std::array<float,2>{0.455281436f, 0.0969853103f},
-std::array<float,2>{0.806609154f, 0.575958669f},
-std::array<float,2>{0.597173333f, 0.384814292f},
-std::array<float,2>{0.0988089517f, 0.800832272f},
-std::array<float,2>{0.196175292f, 0.273720294f},
-std::array<float,2>{0.677922666f, 0.996598899f},
-std::array<float,2>{0.915194154f, 0.226792276f},
-std::array<float,2>{0.339660108f, 0.736685812f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.312249333f, 0.746088207f},
-std::array<float,2>{0.904528499f, 0.409918725f},
-std::array<float,2>{0.194963962f, 0.126565188f},
-std::array<float,2>{0.674003005f, 0.989251792f},
-std::array<float,2>{0.0885687023f, 0.798401833f},
-std::array<float,2>{0.564775825f, 0.028973056f},
-std::array<float,2>{0.417748123f, 0.269783109f},
-std::array<float,2>{0.758706808f, 0.522324502f},
-std::array<float,2>{0.484517187f, 0.919245899f},
-std::array<float,2>{0.826898277f, 0.248374149f},
-std::array<float,2>{0.00242291787f, 0.469570726f},
-std::array<float,2>{0.507631361f, 0.651346505f},
-std::array<float,2>{0.12578629f, 0.609873414f},
-std::array<float,2>{0.710048735f, 0.342819273f},
-std::array<float,2>{0.357914746f, 0.123576187f},
-std::array<float,2>{0.948184013f, 0.836212277f},
-std::array<float,2>{0.388962448f, 0.554703653f},
-std::array<float,2>{0.809808195f, 0.297947854f},
-std::array<float,2>{0.100687198f, 0.0623835735f},
-std::array<float,2>{0.610259652f, 0.780297995f},
-std::array<float,2>{0.227952227f, 0.960104823f},
-std::array<float,2>{0.626548946f, 0.170129374f},
-std::array<float,2>{0.253881842f, 0.401819348f},
-std::array<float,2>{0.906670868f, 0.709570467f},
-std::array<float,2>{0.327759445f, 0.860699654f},
-std::array<float,2>{0.992103815f, 0.0768956691f},
-std::array<float,2>{0.176872969f, 0.369443119f},
-std::array<float,2>{0.732104123f, 0.582843184f},
-std::array<float,2>{0.0423256122f, 0.676716566f},
-std::array<float,2>{0.533523262f, 0.445828408f},
-std::array<float,2>{0.446375936f, 0.190994188f},
-std::array<float,2>{0.856783748f, 0.895753682f},
-std::array<float,2>{0.360745132f, 0.571510136f},
-std::array<float,2>{0.954622924f, 0.358900338f},
-std::array<float,2>{0.154463276f, 0.0902187303f},
-std::array<float,2>{0.692704976f, 0.856973708f},
-std::array<float,2>{0.0299783237f, 0.878833115f},
-std::array<float,2>{0.519499183f, 0.212073028f},
-std::array<float,2>{0.470754951f, 0.460036963f},
-std::array<float,2>{0.842487991f, 0.66425091f},
-std::array<float,2>{0.432656467f, 0.756079435f},
-std::array<float,2>{0.776836216f, 0.0376667045f},
-std::array<float,2>{0.0743648261f, 0.286606848f},
-std::array<float,2>{0.58837384f, 0.539545715f},
-std::array<float,2>{0.216944471f, 0.701246083f},
-std::array<float,2>{0.658549905f, 0.377518654f},
-std::array<float,2>{0.294226497f, 0.177951679f},
-std::array<float,2>{0.887054563f, 0.951285839f},
-std::array<float,2>{0.467889518f, 0.628647923f},
-std::array<float,2>{0.864235818f, 0.495116562f},
-std::array<float,2>{0.0516488515f, 0.232783526f},
-std::array<float,2>{0.559409082f, 0.922556221f},
-std::array<float,2>{0.167179093f, 0.818654954f},
-std::array<float,2>{0.748128057f, 0.101788849f},
-std::array<float,2>{0.334308624f, 0.319624394f},
-std::array<float,2>{0.969791234f, 0.603809297f},
-std::array<float,2>{0.274808079f, 0.977000237f},
-std::array<float,2>{0.926917195f, 0.146640256f},
-std::array<float,2>{0.24667868f, 0.437420368f},
-std::array<float,2>{0.651000559f, 0.720672607f},
-std::array<float,2>{0.114184633f, 0.514683068f},
-std::array<float,2>{0.60697943f, 0.263474196f},
-std::array<float,2>{0.4017784f, 0.00323810824f},
-std::array<float,2>{0.792249262f, 0.794377089f},
-std::array<float,2>{0.342850655f, 0.66166836f},
-std::array<float,2>{0.978659451f, 0.467402309f},
-std::array<float,2>{0.162007242f, 0.2083565f},
-std::array<float,2>{0.735188663f, 0.889737606f},
-std::array<float,2>{0.0564017519f, 0.846713006f},
-std::array<float,2>{0.550892293f, 0.08406654f},
-std::array<float,2>{0.454697877f, 0.346547425f},
-std::array<float,2>{0.874359965f, 0.567011416f},
-std::array<float,2>{0.392820716f, 0.940317452f},
-std::array<float,2>{0.782458544f, 0.18011862f},
-std::array<float,2>{0.122181483f, 0.387985468f},
-std::array<float,2>{0.599647403f, 0.694901824f},
-std::array<float,2>{0.235862419f, 0.537453234f},
-std::array<float,2>{0.641602218f, 0.291990399f},
-std::array<float,2>{0.268129021f, 0.0442858897f},
-std::array<float,2>{0.937374651f, 0.759204388f},
-std::array<float,2>{0.477239996f, 0.601536036f},
-std::array<float,2>{0.830724418f, 0.327409804f},
-std::array<float,2>{0.0233192835f, 0.0957849547f},
-std::array<float,2>{0.52914238f, 0.823748887f},
-std::array<float,2>{0.141075522f, 0.934444904f},
-std::array<float,2>{0.695855916f, 0.220964119f},
-std::array<float,2>{0.370647401f, 0.484998107f},
-std::array<float,2>{0.968565404f, 0.633710265f},
-std::array<float,2>{0.281770796f, 0.788682044f},
-std::array<float,2>{0.877242625f, 0.0154774794f},
-std::array<float,2>{0.206179693f, 0.253325164f},
-std::array<float,2>{0.664287627f, 0.504141808f},
-std::array<float,2>{0.0646035448f, 0.729048371f},
-std::array<float,2>{0.585239053f, 0.423638225f},
-std::array<float,2>{0.42547822f, 0.151246518f},
-std::array<float,2>{0.769884527f, 0.970964074f},
-std::array<float,2>{0.26517123f, 0.526699305f},
-std::array<float,2>{0.916139483f, 0.276523858f},
-std::array<float,2>{0.223414898f, 0.0185819678f},
-std::array<float,2>{0.637895107f, 0.810164154f},
-std::array<float,2>{0.106756933f, 0.996911287f},
-std::array<float,2>{0.623341143f, 0.135730132f},
-std::array<float,2>{0.381756693f, 0.42154628f},
-std::array<float,2>{0.798894346f, 0.741273522f},
-std::array<float,2>{0.442973912f, 0.828743577f},
-std::array<float,2>{0.85137403f, 0.112172566f},
-std::array<float,2>{0.0380982757f, 0.33335799f},
-std::array<float,2>{0.54117924f, 0.619283855f},
-std::array<float,2>{0.184037581f, 0.643816769f},
-std::array<float,2>{0.724145055f, 0.481391728f},
-std::array<float,2>{0.318315387f, 0.236052305f},
-std::array<float,2>{0.994273722f, 0.911892593f},
-std::array<float,2>{0.41365537f, 0.713201642f},
-std::array<float,2>{0.753321886f, 0.396173209f},
-std::array<float,2>{0.0824292228f, 0.159135774f},
-std::array<float,2>{0.574790359f, 0.967410862f},
-std::array<float,2>{0.202538028f, 0.7663486f},
-std::array<float,2>{0.684109509f, 0.0538050756f},
-std::array<float,2>{0.304539919f, 0.311329693f},
-std::array<float,2>{0.891107738f, 0.554452062f},
-std::array<float,2>{0.344664752f, 0.902854443f},
-std::array<float,2>{0.943965614f, 0.195966944f},
-std::array<float,2>{0.134540454f, 0.443236232f},
-std::array<float,2>{0.71349287f, 0.68018043f},
-std::array<float,2>{0.0144899236f, 0.590520322f},
-std::array<float,2>{0.513040185f, 0.366063863f},
-std::array<float,2>{0.495719135f, 0.0700076744f},
-std::array<float,2>{0.81422168f, 0.872928262f},
-std::array<float,2>{0.353970796f, 0.691240013f},
-std::array<float,2>{0.951382697f, 0.3837578f},
-std::array<float,2>{0.132549793f, 0.186503798f},
-std::array<float,2>{0.705179691f, 0.9427104f},
-std::array<float,2>{0.00445187511f, 0.764763892f},
-std::array<float,2>{0.501866639f, 0.0396567434f},
-std::array<float,2>{0.488428801f, 0.294210434f},
-std::array<float,2>{0.823168337f, 0.533278465f},
-std::array<float,2>{0.420561522f, 0.886330605f},
-std::array<float,2>{0.763267815f, 0.206045657f},
-std::array<float,2>{0.090974398f, 0.46201703f},
-std::array<float,2>{0.567383111f, 0.658852339f},
-std::array<float,2>{0.189250365f, 0.564023137f},
-std::array<float,2>{0.677134693f, 0.351268262f},
-std::array<float,2>{0.306833535f, 0.0790516362f},
-std::array<float,2>{0.902179539f, 0.851091981f},
-std::array<float,2>{0.44961977f, 0.501597524f},
-std::array<float,2>{0.853304386f, 0.256075293f},
-std::array<float,2>{0.0451327227f, 0.0117025441f},
-std::array<float,2>{0.536225319f, 0.783095837f},
-std::array<float,2>{0.175154433f, 0.97372973f},
-std::array<float,2>{0.728665531f, 0.156198665f},
-std::array<float,2>{0.32210511f, 0.426792622f},
-std::array<float,2>{0.984545469f, 0.731621981f},
-std::array<float,2>{0.256924719f, 0.824912488f},
-std::array<float,2>{0.910223246f, 0.0987395495f},
-std::array<float,2>{0.234014884f, 0.321030617f},
-std::array<float,2>{0.630494118f, 0.59641248f},
-std::array<float,2>{0.0961796269f, 0.640398502f},
-std::array<float,2>{0.613490701f, 0.489231318f},
-std::array<float,2>{0.384348243f, 0.22413975f},
-std::array<float,2>{0.806754947f, 0.932018995f},
-std::array<float,2>{0.292226553f, 0.622768223f},
-std::array<float,2>{0.885248482f, 0.328893483f},
-std::array<float,2>{0.212539271f, 0.116219744f},
-std::array<float,2>{0.661821663f, 0.83516252f},
-std::array<float,2>{0.0732339397f, 0.908110142f},
-std::array<float,2>{0.591335297f, 0.24116239f},
-std::array<float,2>{0.43648535f, 0.480152518f},
-std::array<float,2>{0.780967772f, 0.645343363f},
-std::array<float,2>{0.474791259f, 0.805395305f},
-std::array<float,2>{0.839631736f, 0.0205641203f},
-std::array<float,2>{0.0241973475f, 0.278174013f},
-std::array<float,2>{0.521522164f, 0.527957916f},
-std::array<float,2>{0.150910214f, 0.736574054f},
-std::array<float,2>{0.690367162f, 0.415708065f},
-std::array<float,2>{0.364280432f, 0.137454286f},
-std::array<float,2>{0.957736135f, 0.994196534f},
-std::array<float,2>{0.40499112f, 0.685102522f},
-std::array<float,2>{0.793497622f, 0.440920681f},
-std::array<float,2>{0.112145625f, 0.201611072f},
-std::array<float,2>{0.605351567f, 0.900993884f},
-std::array<float,2>{0.245142043f, 0.86937952f},
-std::array<float,2>{0.655463517f, 0.066355899f},
-std::array<float,2>{0.280674338f, 0.361216873f},
-std::array<float,2>{0.922542274f, 0.586470842f},
-std::array<float,2>{0.329902381f, 0.962194979f},
-std::array<float,2>{0.97618711f, 0.163043857f},
-std::array<float,2>{0.171647727f, 0.390696913f},
-std::array<float,2>{0.742745817f, 0.715682328f},
-std::array<float,2>{0.0490953997f, 0.549013197f},
-std::array<float,2>{0.555857182f, 0.308451444f},
-std::array<float,2>{0.460999131f, 0.0489136465f},
-std::array<float,2>{0.859954536f, 0.770294189f},
-std::array<float,2>{0.271282852f, 0.656196475f},
-std::array<float,2>{0.930827081f, 0.472825676f},
-std::array<float,2>{0.241835922f, 0.24450393f},
-std::array<float,2>{0.646802306f, 0.914410293f},
-std::array<float,2>{0.117452182f, 0.843629062f},
-std::array<float,2>{0.595103979f, 0.11751359f},
-std::array<float,2>{0.395598024f, 0.336281061f},
-std::array<float,2>{0.787992179f, 0.616685927f},
-std::array<float,2>{0.460645467f, 0.987003028f},
-std::array<float,2>{0.870773852f, 0.130090803f},
-std::array<float,2>{0.060720183f, 0.412473857f},
-std::array<float,2>{0.549499035f, 0.746566117f},
-std::array<float,2>{0.159721091f, 0.518987f},
-std::array<float,2>{0.739133418f, 0.26656872f},
-std::array<float,2>{0.337612212f, 0.0238642786f},
-std::array<float,2>{0.983150244f, 0.804663956f},
-std::array<float,2>{0.429373533f, 0.581147194f},
-std::array<float,2>{0.766760945f, 0.372750252f},
-std::array<float,2>{0.0683830306f, 0.0726533756f},
-std::array<float,2>{0.579203367f, 0.86482507f},
-std::array<float,2>{0.209734902f, 0.894288301f},
-std::array<float,2>{0.670181155f, 0.194294125f},
-std::array<float,2>{0.289054334f, 0.451297134f},
-std::array<float,2>{0.881963432f, 0.67532593f},
-std::array<float,2>{0.371226907f, 0.775859296f},
-std::array<float,2>{0.961020172f, 0.0583670139f},
-std::array<float,2>{0.14465028f, 0.30367738f},
-std::array<float,2>{0.700180352f, 0.559624672f},
-std::array<float,2>{0.0156286582f, 0.705516398f},
-std::array<float,2>{0.524306893f, 0.405620575f},
-std::array<float,2>{0.48147136f, 0.167695403f},
-std::array<float,2>{0.833009124f, 0.954722941f},
-std::array<float,2>{0.312937558f, 0.546756446f},
-std::array<float,2>{0.996297061f, 0.284444213f},
-std::array<float,2>{0.181841761f, 0.0318509042f},
-std::array<float,2>{0.722567499f, 0.751416504f},
-std::array<float,2>{0.0312584788f, 0.947199285f},
-std::array<float,2>{0.545272529f, 0.173325837f},
-std::array<float,2>{0.440692514f, 0.382402331f},
-std::array<float,2>{0.844945252f, 0.698534489f},
-std::array<float,2>{0.375124723f, 0.852524519f},
-std::array<float,2>{0.803362012f, 0.0898010433f},
-std::array<float,2>{0.101613156f, 0.35413897f},
-std::array<float,2>{0.61828661f, 0.576957762f},
-std::array<float,2>{0.222578496f, 0.670258045f},
-std::array<float,2>{0.634789586f, 0.453520775f},
-std::array<float,2>{0.258080035f, 0.215127468f},
-std::array<float,2>{0.921275735f, 0.879524767f},
-std::array<float,2>{0.499016047f, 0.725840151f},
-std::array<float,2>{0.819636405f, 0.430862784f},
-std::array<float,2>{0.0104223415f, 0.141507238f},
-std::array<float,2>{0.508467376f, 0.983834565f},
-std::array<float,2>{0.140094995f, 0.789178908f},
-std::array<float,2>{0.71851325f, 0.00581813836f},
-std::array<float,2>{0.34851411f, 0.258663565f},
-std::array<float,2>{0.941151559f, 0.509531021f},
-std::array<float,2>{0.299218476f, 0.92640841f},
-std::array<float,2>{0.895499289f, 0.22970137f},
-std::array<float,2>{0.19615823f, 0.49610585f},
-std::array<float,2>{0.68027389f, 0.62915504f},
-std::array<float,2>{0.0785038993f, 0.607616365f},
-std::array<float,2>{0.571127892f, 0.31349656f},
-std::array<float,2>{0.410008997f, 0.107708454f},
-std::array<float,2>{0.756145656f, 0.814808249f},
-std::array<float,2>{0.250471473f, 0.708319962f},
-std::array<float,2>{0.909329832f, 0.398726344f},
-std::array<float,2>{0.229519203f, 0.16818209f},
-std::array<float,2>{0.627882659f, 0.958708763f},
-std::array<float,2>{0.0992836282f, 0.777434409f},
-std::array<float,2>{0.612559378f, 0.0599539094f},
-std::array<float,2>{0.38740024f, 0.300615311f},
-std::array<float,2>{0.811376691f, 0.558440506f},
-std::array<float,2>{0.448399335f, 0.898044109f},
-std::array<float,2>{0.859374583f, 0.187915757f},
-std::array<float,2>{0.0392002538f, 0.448428631f},
-std::array<float,2>{0.532837868f, 0.678303957f},
-std::array<float,2>{0.177808121f, 0.584056199f},
-std::array<float,2>{0.733510852f, 0.368693322f},
-std::array<float,2>{0.325775832f, 0.074414365f},
-std::array<float,2>{0.990048647f, 0.86187923f},
-std::array<float,2>{0.414844841f, 0.520853043f},
-std::array<float,2>{0.760016561f, 0.272952467f},
-std::array<float,2>{0.0873639435f, 0.029639082f},
-std::array<float,2>{0.562659025f, 0.79937166f},
-std::array<float,2>{0.19220759f, 0.991843939f},
-std::array<float,2>{0.672457993f, 0.127355173f},
-std::array<float,2>{0.310185969f, 0.407273114f},
-std::array<float,2>{0.904280484f, 0.742906511f},
-std::array<float,2>{0.355487496f, 0.838187158f},
-std::array<float,2>{0.946613967f, 0.121465333f},
-std::array<float,2>{0.12806493f, 0.340395689f},
-std::array<float,2>{0.708956242f, 0.612059653f},
-std::array<float,2>{0.00112693885f, 0.648616374f},
-std::array<float,2>{0.505622089f, 0.472604781f},
-std::array<float,2>{0.487073898f, 0.247364968f},
-std::array<float,2>{0.824293852f, 0.919959009f},
-std::array<float,2>{0.332040042f, 0.60319066f},
-std::array<float,2>{0.972501278f, 0.317434698f},
-std::array<float,2>{0.164740503f, 0.104612194f},
-std::array<float,2>{0.747617841f, 0.817016661f},
-std::array<float,2>{0.0532961115f, 0.924736559f},
-std::array<float,2>{0.560907543f, 0.23113592f},
-std::array<float,2>{0.465373993f, 0.493691236f},
-std::array<float,2>{0.866950512f, 0.625109851f},
-std::array<float,2>{0.399077564f, 0.795428276f},
-std::array<float,2>{0.790410995f, 0.00100210903f},
-std::array<float,2>{0.115634941f, 0.264680743f},
-std::array<float,2>{0.607771158f, 0.512386322f},
-std::array<float,2>{0.248068348f, 0.722492933f},
-std::array<float,2>{0.649402678f, 0.433975846f},
-std::array<float,2>{0.275920689f, 0.146011561f},
-std::array<float,2>{0.928297281f, 0.978763402f},
-std::array<float,2>{0.469803393f, 0.667730629f},
-std::array<float,2>{0.841768861f, 0.458067805f},
-std::array<float,2>{0.0290970262f, 0.213082448f},
-std::array<float,2>{0.516938388f, 0.876297951f},
-std::array<float,2>{0.152436554f, 0.85814327f},
-std::array<float,2>{0.694776833f, 0.0931328759f},
-std::array<float,2>{0.363220572f, 0.356293738f},
-std::array<float,2>{0.956066072f, 0.572868526f},
-std::array<float,2>{0.295279741f, 0.950065255f},
-std::array<float,2>{0.890495956f, 0.176323384f},
-std::array<float,2>{0.216572568f, 0.376528442f},
-std::array<float,2>{0.656660914f, 0.699401796f},
-std::array<float,2>{0.0772965178f, 0.542174935f},
-std::array<float,2>{0.586510599f, 0.288195997f},
-std::array<float,2>{0.430230647f, 0.0352038778f},
-std::array<float,2>{0.773790479f, 0.755737066f},
-std::array<float,2>{0.369104564f, 0.635596514f},
-std::array<float,2>{0.966290653f, 0.487244487f},
-std::array<float,2>{0.143496022f, 0.219364494f},
-std::array<float,2>{0.697722554f, 0.936667621f},
-std::array<float,2>{0.0203289464f, 0.820495665f},
-std::array<float,2>{0.529574335f, 0.0938531756f},
-std::array<float,2>{0.479211301f, 0.324871808f},
-std::array<float,2>{0.829231322f, 0.598230004f},
-std::array<float,2>{0.422684133f, 0.969194055f},
-std::array<float,2>{0.77231437f, 0.149080738f},
-std::array<float,2>{0.0643936321f, 0.425213963f},
-std::array<float,2>{0.582913458f, 0.726887822f},
-std::array<float,2>{0.204017729f, 0.506710172f},
-std::array<float,2>{0.666136682f, 0.250111431f},
-std::array<float,2>{0.283651084f, 0.0121020367f},
-std::array<float,2>{0.876823366f, 0.786499619f},
-std::array<float,2>{0.456742257f, 0.568980694f},
-std::array<float,2>{0.871791899f, 0.344859511f},
-std::array<float,2>{0.0579125807f, 0.0835874528f},
-std::array<float,2>{0.554507613f, 0.843766212f},
-std::array<float,2>{0.163867652f, 0.888480246f},
-std::array<float,2>{0.73777914f, 0.209296018f},
-std::array<float,2>{0.340521127f, 0.466095328f},
-std::array<float,2>{0.976915717f, 0.662534654f},
-std::array<float,2>{0.267002732f, 0.761032343f},
-std::array<float,2>{0.934729874f, 0.0458902158f},
-std::array<float,2>{0.238157883f, 0.289446861f},
-std::array<float,2>{0.643612087f, 0.535909355f},
-std::array<float,2>{0.123710148f, 0.692671716f},
-std::array<float,2>{0.59870863f, 0.390427679f},
-std::array<float,2>{0.39216429f, 0.183386058f},
-std::array<float,2>{0.78466928f, 0.937783837f},
-std::array<float,2>{0.301965088f, 0.551319599f},
-std::array<float,2>{0.892720997f, 0.309693575f},
-std::array<float,2>{0.200394332f, 0.0523612276f},
-std::array<float,2>{0.68640995f, 0.768418789f},
-std::array<float,2>{0.0844056234f, 0.965474904f},
-std::array<float,2>{0.57702744f, 0.157958731f},
-std::array<float,2>{0.411560535f, 0.39695397f},
-std::array<float,2>{0.750732064f, 0.711922348f},
-std::array<float,2>{0.493897378f, 0.874207139f},
-std::array<float,2>{0.814929783f, 0.066577062f},
-std::array<float,2>{0.0132325767f, 0.364774674f},
-std::array<float,2>{0.513947487f, 0.591830015f},
-std::array<float,2>{0.135165051f, 0.682381332f},
-std::array<float,2>{0.712052763f, 0.444628626f},
-std::array<float,2>{0.34632507f, 0.198086128f},
-std::array<float,2>{0.942019045f, 0.904973507f},
-std::array<float,2>{0.379521728f, 0.739959419f},
-std::array<float,2>{0.79714936f, 0.419006824f},
-std::array<float,2>{0.108875729f, 0.133186623f},
-std::array<float,2>{0.621771753f, 0.999814868f},
-std::array<float,2>{0.224625334f, 0.812057436f},
-std::array<float,2>{0.6405738f, 0.0169233847f},
-std::array<float,2>{0.263021857f, 0.274777263f},
-std::array<float,2>{0.914169788f, 0.524762034f},
-std::array<float,2>{0.318597943f, 0.913445234f},
-std::array<float,2>{0.992550433f, 0.236777812f},
-std::array<float,2>{0.185554489f, 0.483453006f},
-std::array<float,2>{0.72522223f, 0.641003788f},
-std::array<float,2>{0.0359424837f, 0.617239475f},
-std::array<float,2>{0.540877759f, 0.334417552f},
-std::array<float,2>{0.443972588f, 0.109860085f},
-std::array<float,2>{0.849045455f, 0.831261575f},
-std::array<float,2>{0.323730052f, 0.733770728f},
-std::array<float,2>{0.987455964f, 0.428966463f},
-std::array<float,2>{0.172069892f, 0.153337866f},
-std::array<float,2>{0.726667166f, 0.974965453f},
-std::array<float,2>{0.0444588363f, 0.783289492f},
-std::array<float,2>{0.538353264f, 0.00933889113f},
-std::array<float,2>{0.452950865f, 0.255796701f},
-std::array<float,2>{0.854860425f, 0.502628028f},
-std::array<float,2>{0.385754108f, 0.930828035f},
-std::array<float,2>{0.806495786f, 0.225199491f},
-std::array<float,2>{0.0945552215f, 0.491052538f},
-std::array<float,2>{0.615707457f, 0.636931419f},
-std::array<float,2>{0.231591508f, 0.595282793f},
-std::array<float,2>{0.631587565f, 0.322667778f},
-std::array<float,2>{0.255527437f, 0.100443207f},
-std::array<float,2>{0.912179589f, 0.827242911f},
-std::array<float,2>{0.491017371f, 0.532515764f},
-std::array<float,2>{0.820352197f, 0.296498269f},
-std::array<float,2>{0.00720341923f, 0.0420059822f},
-std::array<float,2>{0.503212154f, 0.762798786f},
-std::array<float,2>{0.130603656f, 0.944504261f},
-std::array<float,2>{0.704309106f, 0.185228631f},
-std::array<float,2>{0.353277445f, 0.385185033f},
-std::array<float,2>{0.950184226f, 0.688988805f},
-std::array<float,2>{0.304886997f, 0.849501789f},
-std::array<float,2>{0.900230348f, 0.0811404809f},
-std::array<float,2>{0.191124007f, 0.3480272f},
-std::array<float,2>{0.679299176f, 0.565461695f},
-std::array<float,2>{0.0925647467f, 0.656474471f},
-std::array<float,2>{0.569326818f, 0.463191092f},
-std::array<float,2>{0.418935448f, 0.203534186f},
-std::array<float,2>{0.765481591f, 0.883847535f},
-std::array<float,2>{0.278019726f, 0.588258445f},
-std::array<float,2>{0.924748778f, 0.362191081f},
-std::array<float,2>{0.243141368f, 0.0640097484f},
-std::array<float,2>{0.653563261f, 0.868200898f},
-std::array<float,2>{0.110740028f, 0.898952186f},
-std::array<float,2>{0.602001131f, 0.199301854f},
-std::array<float,2>{0.403203875f, 0.438400269f},
-std::array<float,2>{0.795181572f, 0.68585211f},
-std::array<float,2>{0.464714617f, 0.772128224f},
-std::array<float,2>{0.863010108f, 0.0481949449f},
-std::array<float,2>{0.0474612229f, 0.304959238f},
-std::array<float,2>{0.558550179f, 0.547124088f},
-std::array<float,2>{0.169413596f, 0.717434883f},
-std::array<float,2>{0.745496511f, 0.392745346f},
-std::array<float,2>{0.331593215f, 0.16052866f},
-std::array<float,2>{0.973565578f, 0.963735521f},
-std::array<float,2>{0.433922261f, 0.646967232f},
-std::array<float,2>{0.777525485f, 0.477791786f},
-std::array<float,2>{0.0710987672f, 0.239933744f},
-std::array<float,2>{0.592073917f, 0.908360541f},
-std::array<float,2>{0.213598877f, 0.833788514f},
-std::array<float,2>{0.663540721f, 0.113602042f},
-std::array<float,2>{0.29050836f, 0.330555499f},
-std::array<float,2>{0.88386476f, 0.624002457f},
-std::array<float,2>{0.36570996f, 0.992896855f},
-std::array<float,2>{0.960912943f, 0.140413269f},
-std::array<float,2>{0.149902672f, 0.417208403f},
-std::array<float,2>{0.688025773f, 0.734742343f},
-std::array<float,2>{0.0259085968f, 0.530494034f},
-std::array<float,2>{0.520341277f, 0.281040192f},
-std::array<float,2>{0.473976731f, 0.0227432381f},
-std::array<float,2>{0.837249339f, 0.808587551f},
-std::array<float,2>{0.286465675f, 0.672429323f},
-std::array<float,2>{0.880471051f, 0.450495005f},
-std::array<float,2>{0.207468852f, 0.192601487f},
-std::array<float,2>{0.66805166f, 0.891071141f},
-std::array<float,2>{0.066842854f, 0.865460098f},
-std::array<float,2>{0.581140339f, 0.0721285418f},
-std::array<float,2>{0.426303774f, 0.373245984f},
-std::array<float,2>{0.768852293f, 0.579918981f},
-std::array<float,2>{0.483005106f, 0.955872774f},
-std::array<float,2>{0.834984899f, 0.165946916f},
-std::array<float,2>{0.0184243415f, 0.403294355f},
-std::array<float,2>{0.526840985f, 0.703535557f},
-std::array<float,2>{0.146724567f, 0.561701119f},
-std::array<float,2>{0.70276612f, 0.302677721f},
-std::array<float,2>{0.374280989f, 0.054853417f},
-std::array<float,2>{0.963270247f, 0.773780644f},
-std::array<float,2>{0.396901935f, 0.613419235f},
-std::array<float,2>{0.786823213f, 0.339571178f},
-std::array<float,2>{0.119729355f, 0.120901354f},
-std::array<float,2>{0.596558571f, 0.840311289f},
-std::array<float,2>{0.239359543f, 0.916532516f},
-std::array<float,2>{0.645292282f, 0.244041219f},
-std::array<float,2>{0.271907479f, 0.475833267f},
-std::array<float,2>{0.933456302f, 0.652699471f},
-std::array<float,2>{0.337975204f, 0.801999032f},
-std::array<float,2>{0.980523765f, 0.0261677727f},
-std::array<float,2>{0.157996148f, 0.267729193f},
-std::array<float,2>{0.74113971f, 0.517330587f},
-std::array<float,2>{0.0591253713f, 0.748951256f},
-std::array<float,2>{0.547900617f, 0.410976559f},
-std::array<float,2>{0.458910704f, 0.131233141f},
-std::array<float,2>{0.867627084f, 0.985871851f},
-std::array<float,2>{0.34983027f, 0.511708915f},
-std::array<float,2>{0.939268887f, 0.259973377f},
-std::array<float,2>{0.136773154f, 0.00699702278f},
-std::array<float,2>{0.71512109f, 0.791246653f},
-std::array<float,2>{0.008050167f, 0.981110573f},
-std::array<float,2>{0.510766208f, 0.144307628f},
-std::array<float,2>{0.497008294f, 0.432707727f},
-std::array<float,2>{0.817287385f, 0.724425554f},
-std::array<float,2>{0.407570243f, 0.812900662f},
-std::array<float,2>{0.754998028f, 0.105737194f},
-std::array<float,2>{0.0818954185f, 0.314570338f},
-std::array<float,2>{0.573084176f, 0.607092202f},
-std::array<float,2>{0.199027106f, 0.631705999f},
-std::array<float,2>{0.683509767f, 0.499424487f},
-std::array<float,2>{0.297357142f, 0.228065133f},
-std::array<float,2>{0.897293031f, 0.929007351f},
-std::array<float,2>{0.43885392f, 0.695739388f},
-std::array<float,2>{0.847264528f, 0.379240811f},
-std::array<float,2>{0.0346775278f, 0.175436676f},
-std::array<float,2>{0.544154406f, 0.948067069f},
-std::array<float,2>{0.181299299f, 0.753486753f},
-std::array<float,2>{0.719650567f, 0.0333979689f},
-std::array<float,2>{0.31596598f, 0.282752931f},
-std::array<float,2>{0.999178886f, 0.544164658f},
-std::array<float,2>{0.26088199f, 0.881008208f},
-std::array<float,2>{0.918691039f, 0.217701167f},
-std::array<float,2>{0.219758347f, 0.455123633f},
-std::array<float,2>{0.633235693f, 0.669829965f},
-std::array<float,2>{0.104220152f, 0.574518979f},
-std::array<float,2>{0.620545089f, 0.351832032f},
-std::array<float,2>{0.378030717f, 0.0870872289f},
-std::array<float,2>{0.802250087f, 0.854251981f},
-std::array<float,2>{0.276459128f, 0.719621062f},
-std::array<float,2>{0.929516733f, 0.435658455f},
-std::array<float,2>{0.249689832f, 0.148296595f},
-std::array<float,2>{0.649821579f, 0.977642059f},
-std::array<float,2>{0.116400257f, 0.793825805f},
-std::array<float,2>{0.608927906f, 0.0021040428f},
-std::array<float,2>{0.399555594f, 0.262097687f},
-std::array<float,2>{0.789547443f, 0.514594495f},
-std::array<float,2>{0.466084957f, 0.923782349f},
-std::array<float,2>{0.865894377f, 0.234319523f},
-std::array<float,2>{0.0540447719f, 0.495339215f},
-std::array<float,2>{0.562341392f, 0.627039611f},
-std::array<float,2>{0.165126964f, 0.60545814f},
-std::array<float,2>{0.746261895f, 0.319000661f},
-std::array<float,2>{0.33316204f, 0.10283041f},
-std::array<float,2>{0.970789135f, 0.820021331f},
-std::array<float,2>{0.430701107f, 0.540110528f},
-std::array<float,2>{0.775105298f, 0.285195827f},
-std::array<float,2>{0.0764172375f, 0.038160529f},
-std::array<float,2>{0.587387443f, 0.757293344f},
-std::array<float,2>{0.215129763f, 0.952556729f},
-std::array<float,2>{0.657248139f, 0.179053187f},
-std::array<float,2>{0.296736598f, 0.378588647f},
-std::array<float,2>{0.889559746f, 0.702273071f},
-std::array<float,2>{0.362036914f, 0.856173396f},
-std::array<float,2>{0.955319762f, 0.0916208327f},
-std::array<float,2>{0.153409049f, 0.357918769f},
-std::array<float,2>{0.693506896f, 0.570388734f},
-std::array<float,2>{0.0278079752f, 0.665142f},
-std::array<float,2>{0.516354263f, 0.459321409f},
-std::array<float,2>{0.469534844f, 0.211185262f},
-std::array<float,2>{0.840150356f, 0.877710998f},
-std::array<float,2>{0.324892104f, 0.583441138f},
-std::array<float,2>{0.98889482f, 0.370387137f},
-std::array<float,2>{0.179221854f, 0.0773658454f},
-std::array<float,2>{0.733333111f, 0.859579444f},
-std::array<float,2>{0.0409219339f, 0.89528358f},
-std::array<float,2>{0.531835139f, 0.189978719f},
-std::array<float,2>{0.447890133f, 0.446729392f},
-std::array<float,2>{0.857424676f, 0.677224338f},
-std::array<float,2>{0.387899101f, 0.779327214f},
-std::array<float,2>{0.812377155f, 0.0609096922f},
-std::array<float,2>{0.0981638581f, 0.297691256f},
-std::array<float,2>{0.612141907f, 0.556105971f},
-std::array<float,2>{0.229187399f, 0.710498214f},
-std::array<float,2>{0.628602087f, 0.400545597f},
-std::array<float,2>{0.250994086f, 0.171071082f},
-std::array<float,2>{0.908546925f, 0.95927459f},
-std::array<float,2>{0.487899214f, 0.652325332f},
-std::array<float,2>{0.826014638f, 0.469765991f},
-std::array<float,2>{0.000814112427f, 0.249798253f},
-std::array<float,2>{0.504261553f, 0.918351531f},
-std::array<float,2>{0.126962677f, 0.837513745f},
-std::array<float,2>{0.707309306f, 0.12430869f},
-std::array<float,2>{0.356745631f, 0.341809303f},
-std::array<float,2>{0.945648432f, 0.61065948f},
-std::array<float,2>{0.309036076f, 0.990134835f},
-std::array<float,2>{0.90300256f, 0.125476524f},
-std::array<float,2>{0.192394942f, 0.409016013f},
-std::array<float,2>{0.673075616f, 0.744827807f},
-std::array<float,2>{0.0864997879f, 0.522912979f},
-std::array<float,2>{0.564397335f, 0.271086305f},
-std::array<float,2>{0.415889651f, 0.0280089024f},
-std::array<float,2>{0.761397541f, 0.797532499f},
-std::array<float,2>{0.347103417f, 0.681345344f},
-std::array<float,2>{0.943181753f, 0.441900343f},
-std::array<float,2>{0.13619706f, 0.196505278f},
-std::array<float,2>{0.710960984f, 0.903648853f},
-std::array<float,2>{0.0119921369f, 0.871460259f},
-std::array<float,2>{0.515581667f, 0.0687242746f},
-std::array<float,2>{0.49294281f, 0.36645022f},
-std::array<float,2>{0.815599203f, 0.591781318f},
-std::array<float,2>{0.410541892f, 0.968261242f},
-std::array<float,2>{0.751819134f, 0.160125151f},
-std::array<float,2>{0.0851081982f, 0.394690663f},
-std::array<float,2>{0.578059673f, 0.714616358f},
-std::array<float,2>{0.199740395f, 0.553625286f},
-std::array<float,2>{0.687179804f, 0.311735064f},
-std::array<float,2>{0.301442593f, 0.0528277643f},
-std::array<float,2>{0.894236624f, 0.767198861f},
-std::array<float,2>{0.444882691f, 0.620855808f},
-std::array<float,2>{0.848481357f, 0.332832247f},
-std::array<float,2>{0.0368173905f, 0.112955436f},
-std::array<float,2>{0.539301693f, 0.829981506f},
-std::array<float,2>{0.18684037f, 0.910875738f},
-std::array<float,2>{0.725701213f, 0.234466136f},
-std::array<float,2>{0.319600433f, 0.482260913f},
-std::array<float,2>{0.993490517f, 0.642646492f},
-std::array<float,2>{0.262058884f, 0.80928278f},
-std::array<float,2>{0.915802836f, 0.0179174393f},
-std::array<float,2>{0.226330206f, 0.275882006f},
-std::array<float,2>{0.639273524f, 0.525588989f},
-std::array<float,2>{0.107929789f, 0.740549922f},
-std::array<float,2>{0.622219741f, 0.420880944f},
-std::array<float,2>{0.38082552f, 0.136482194f},
-std::array<float,2>{0.7978912f, 0.998038888f},
-std::array<float,2>{0.284888178f, 0.505770743f},
-std::array<float,2>{0.875163317f, 0.252265304f},
-std::array<float,2>{0.20465897f, 0.0138041358f},
-std::array<float,2>{0.667686045f, 0.787702978f},
-std::array<float,2>{0.0629994795f, 0.971998096f},
-std::array<float,2>{0.583285391f, 0.15154849f},
-std::array<float,2>{0.423161149f, 0.42214337f},
-std::array<float,2>{0.773357868f, 0.729867339f},
-std::array<float,2>{0.479647547f, 0.822295189f},
-std::array<float,2>{0.82900852f, 0.0976254195f},
-std::array<float,2>{0.0210544299f, 0.326763839f},
-std::array<float,2>{0.531034708f, 0.5997473f},
-std::array<float,2>{0.143737897f, 0.634070396f},
-std::array<float,2>{0.698880672f, 0.485555798f},
-std::array<float,2>{0.367206931f, 0.222338185f},
-std::array<float,2>{0.965545237f, 0.935221851f},
-std::array<float,2>{0.391378403f, 0.693701446f},
-std::array<float,2>{0.783795536f, 0.387098551f},
-std::array<float,2>{0.124757245f, 0.18114543f},
-std::array<float,2>{0.598242819f, 0.941212356f},
-std::array<float,2>{0.236420214f, 0.75850755f},
-std::array<float,2>{0.643127203f, 0.0432615429f},
-std::array<float,2>{0.266217738f, 0.292522609f},
-std::array<float,2>{0.934063554f, 0.53897965f},
-std::array<float,2>{0.341754854f, 0.888977706f},
-std::array<float,2>{0.977871597f, 0.207848698f},
-std::array<float,2>{0.162389144f, 0.468517482f},
-std::array<float,2>{0.736793935f, 0.660928726f},
-std::array<float,2>{0.0568149015f, 0.567414165f},
-std::array<float,2>{0.553488076f, 0.347632587f},
-std::array<float,2>{0.455560327f, 0.0859257281f},
-std::array<float,2>{0.872625828f, 0.846261084f},
-std::array<float,2>{0.330212235f, 0.715993524f},
-std::array<float,2>{0.973907411f, 0.391873956f},
-std::array<float,2>{0.168853655f, 0.163305566f},
-std::array<float,2>{0.744274616f, 0.961347878f},
-std::array<float,2>{0.0488188379f, 0.770749092f},
-std::array<float,2>{0.557258427f, 0.0502224714f},
-std::array<float,2>{0.463144898f, 0.307576686f},
-std::array<float,2>{0.862001598f, 0.549924791f},
-std::array<float,2>{0.40429154f, 0.902000427f},
-std::array<float,2>{0.796092093f, 0.20269455f},
-std::array<float,2>{0.110342756f, 0.439620763f},
-std::array<float,2>{0.603005528f, 0.683668077f},
-std::array<float,2>{0.243748844f, 0.587881982f},
-std::array<float,2>{0.652807057f, 0.359553546f},
-std::array<float,2>{0.279257178f, 0.0650486723f},
-std::array<float,2>{0.925224364f, 0.870715857f},
-std::array<float,2>{0.472826213f, 0.528437912f},
-std::array<float,2>{0.836696267f, 0.278557509f},
-std::array<float,2>{0.0271199178f, 0.0199178699f},
-std::array<float,2>{0.520881534f, 0.806426585f},
-std::array<float,2>{0.148943529f, 0.995196939f},
-std::array<float,2>{0.689082444f, 0.138570085f},
-std::array<float,2>{0.366459161f, 0.414973348f},
-std::array<float,2>{0.959917605f, 0.737588286f},
-std::array<float,2>{0.289582223f, 0.834251106f},
-std::array<float,2>{0.883221388f, 0.115423471f},
-std::array<float,2>{0.214604139f, 0.329594105f},
-std::array<float,2>{0.66218245f, 0.621223807f},
-std::array<float,2>{0.0721822456f, 0.645939767f},
-std::array<float,2>{0.59365803f, 0.478605092f},
-std::array<float,2>{0.435447812f, 0.242153719f},
-std::array<float,2>{0.778583646f, 0.906420112f},
-std::array<float,2>{0.254109144f, 0.597332537f},
-std::array<float,2>{0.913181126f, 0.321878046f},
-std::array<float,2>{0.230849236f, 0.098234728f},
-std::array<float,2>{0.632172823f, 0.826056421f},
-std::array<float,2>{0.0954226404f, 0.932775795f},
-std::array<float,2>{0.616954505f, 0.223464519f},
-std::array<float,2>{0.385342121f, 0.490127891f},
-std::array<float,2>{0.804780245f, 0.63932246f},
-std::array<float,2>{0.451419204f, 0.781369388f},
-std::array<float,2>{0.853574574f, 0.00999087375f},
-std::array<float,2>{0.0438972712f, 0.257108718f},
-std::array<float,2>{0.537760615f, 0.500001132f},
-std::array<float,2>{0.173734754f, 0.731341779f},
-std::array<float,2>{0.7279073f, 0.426443011f},
-std::array<float,2>{0.322805762f, 0.15494749f},
-std::array<float,2>{0.987030506f, 0.973579526f},
-std::array<float,2>{0.419025034f, 0.659261703f},
-std::array<float,2>{0.764541626f, 0.461754799f},
-std::array<float,2>{0.0936670229f, 0.206527695f},
-std::array<float,2>{0.56952858f, 0.884884059f},
-std::array<float,2>{0.189845175f, 0.850512803f},
-std::array<float,2>{0.678330779f, 0.0798276737f},
-std::array<float,2>{0.30568257f, 0.349727064f},
-std::array<float,2>{0.899246991f, 0.562946022f},
-std::array<float,2>{0.35177967f, 0.941458106f},
-std::array<float,2>{0.950847149f, 0.187428996f},
-std::array<float,2>{0.129660964f, 0.383947194f},
-std::array<float,2>{0.703784764f, 0.689969599f},
-std::array<float,2>{0.00607928727f, 0.534586012f},
-std::array<float,2>{0.502748728f, 0.293934345f},
-std::array<float,2>{0.491540164f, 0.0407766327f},
-std::array<float,2>{0.821803927f, 0.764559805f},
-std::array<float,2>{0.297887206f, 0.630688787f},
-std::array<float,2>{0.898080409f, 0.49730134f},
-std::array<float,2>{0.197629109f, 0.228619933f},
-std::array<float,2>{0.682310581f, 0.927372456f},
-std::array<float,2>{0.0808497593f, 0.816002071f},
-std::array<float,2>{0.573559523f, 0.108475231f},
-std::array<float,2>{0.406712115f, 0.312774301f},
-std::array<float,2>{0.754514158f, 0.608779788f},
-std::array<float,2>{0.497820765f, 0.983082592f},
-std::array<float,2>{0.81742543f, 0.141830459f},
-std::array<float,2>{0.00968971662f, 0.429794103f},
-std::array<float,2>{0.510392904f, 0.725133777f},
-std::array<float,2>{0.13808842f, 0.50817275f},
-std::array<float,2>{0.715964198f, 0.259648621f},
-std::array<float,2>{0.350599885f, 0.00476003299f},
-std::array<float,2>{0.938063622f, 0.790487349f},
-std::array<float,2>{0.377835691f, 0.577340603f},
-std::array<float,2>{0.80118221f, 0.355344623f},
-std::array<float,2>{0.104948118f, 0.0886684805f},
-std::array<float,2>{0.620091081f, 0.8526721f},
-std::array<float,2>{0.218771383f, 0.880529642f},
-std::array<float,2>{0.63382858f, 0.215866014f},
-std::array<float,2>{0.260241807f, 0.454938859f},
-std::array<float,2>{0.919699192f, 0.671233118f},
-std::array<float,2>{0.314774603f, 0.75009656f},
-std::array<float,2>{0.998623669f, 0.0327657871f},
-std::array<float,2>{0.180108324f, 0.283229679f},
-std::array<float,2>{0.720627785f, 0.54500097f},
-std::array<float,2>{0.0332094058f, 0.697426856f},
-std::array<float,2>{0.543604314f, 0.381381065f},
-std::array<float,2>{0.437502295f, 0.172384843f},
-std::array<float,2>{0.846178174f, 0.945327938f},
-std::array<float,2>{0.373291045f, 0.558829308f},
-std::array<float,2>{0.964803219f, 0.303846627f},
-std::array<float,2>{0.147866979f, 0.0574458688f},
-std::array<float,2>{0.701730371f, 0.777307034f},
-std::array<float,2>{0.0185734108f, 0.953211606f},
-std::array<float,2>{0.525713444f, 0.166740358f},
-std::array<float,2>{0.483647764f, 0.404959828f},
-std::array<float,2>{0.834511995f, 0.706288397f},
-std::array<float,2>{0.427015305f, 0.86328733f},
-std::array<float,2>{0.768499672f, 0.0737882406f},
-std::array<float,2>{0.0676911101f, 0.37187168f},
-std::array<float,2>{0.58072716f, 0.580622017f},
-std::array<float,2>{0.208462849f, 0.674044549f},
-std::array<float,2>{0.669864178f, 0.452250272f},
-std::array<float,2>{0.286120385f, 0.195217326f},
-std::array<float,2>{0.879095554f, 0.892670155f},
-std::array<float,2>{0.457142323f, 0.747196913f},
-std::array<float,2>{0.868211985f, 0.414060682f},
-std::array<float,2>{0.059894409f, 0.129138127f},
-std::array<float,2>{0.547014356f, 0.987921536f},
-std::array<float,2>{0.156730518f, 0.803630948f},
-std::array<float,2>{0.741532207f, 0.0252407435f},
-std::array<float,2>{0.33919543f, 0.266971976f},
-std::array<float,2>{0.981957674f, 0.517874479f},
-std::array<float,2>{0.272985637f, 0.915067673f},
-std::array<float,2>{0.931656063f, 0.245915577f},
-std::array<float,2>{0.239109293f, 0.474235356f},
-std::array<float,2>{0.645667911f, 0.654423177f},
-std::array<float,2>{0.120987825f, 0.616143227f},
-std::array<float,2>{0.596914828f, 0.337337643f},
-std::array<float,2>{0.398047388f, 0.118580915f},
-std::array<float,2>{0.785825253f, 0.84194082f},
-std::array<float,2>{0.293387383f, 0.700661838f},
-std::array<float,2>{0.888136685f, 0.375618398f},
-std::array<float,2>{0.218456984f, 0.17731671f},
-std::array<float,2>{0.659809947f, 0.951011598f},
-std::array<float,2>{0.0754248723f, 0.754482567f},
-std::array<float,2>{0.589267373f, 0.0364931971f},
-std::array<float,2>{0.432524264f, 0.287873626f},
-std::array<float,2>{0.775801301f, 0.541938901f},
-std::array<float,2>{0.472180158f, 0.875340462f},
-std::array<float,2>{0.843400717f, 0.214170277f},
-std::array<float,2>{0.0302776713f, 0.457547426f},
-std::array<float,2>{0.518191457f, 0.666759074f},
-std::array<float,2>{0.155284777f, 0.573830366f},
-std::array<float,2>{0.691568315f, 0.356758028f},
-std::array<float,2>{0.359731913f, 0.0923890099f},
-std::array<float,2>{0.953157306f, 0.859290421f},
-std::array<float,2>{0.400978535f, 0.512941778f},
-std::array<float,2>{0.791581452f, 0.26389128f},
-std::array<float,2>{0.11478138f, 0.000756373047f},
-std::array<float,2>{0.605597436f, 0.796786666f},
-std::array<float,2>{0.247623727f, 0.979986131f},
-std::array<float,2>{0.652305722f, 0.144820228f},
-std::array<float,2>{0.273642689f, 0.434754908f},
-std::array<float,2>{0.925993264f, 0.72116065f},
-std::array<float,2>{0.335620016f, 0.818306744f},
-std::array<float,2>{0.969238639f, 0.104246184f},
-std::array<float,2>{0.166300088f, 0.316553801f},
-std::array<float,2>{0.74933362f, 0.602350295f},
-std::array<float,2>{0.0518463515f, 0.626750827f},
-std::array<float,2>{0.560151279f, 0.49292624f},
-std::array<float,2>{0.467587858f, 0.231625929f},
-std::array<float,2>{0.865063667f, 0.92567879f},
-std::array<float,2>{0.358784676f, 0.613153815f},
-std::array<float,2>{0.949155211f, 0.34126851f},
-std::array<float,2>{0.126524702f, 0.122558288f},
-std::array<float,2>{0.709824264f, 0.839456499f},
-std::array<float,2>{0.00355594605f, 0.921451688f},
-std::array<float,2>{0.506395817f, 0.246282861f},
-std::array<float,2>{0.486208677f, 0.471241981f},
-std::array<float,2>{0.827620089f, 0.650319874f},
-std::array<float,2>{0.416623414f, 0.799945116f},
-std::array<float,2>{0.759764254f, 0.0310493652f},
-std::array<float,2>{0.0890535787f, 0.272034168f},
-std::array<float,2>{0.565638483f, 0.5195539f},
-std::array<float,2>{0.19363004f, 0.743802726f},
-std::array<float,2>{0.675223708f, 0.406320751f},
-std::array<float,2>{0.310624123f, 0.128429577f},
-std::array<float,2>{0.906174362f, 0.990686417f},
-std::array<float,2>{0.446040958f, 0.679354787f},
-std::array<float,2>{0.855687439f, 0.447815657f},
-std::array<float,2>{0.0413491651f, 0.189197153f},
-std::array<float,2>{0.535135627f, 0.897307575f},
-std::array<float,2>{0.176042065f, 0.863028824f},
-std::array<float,2>{0.731335044f, 0.075651519f},
-std::array<float,2>{0.326626897f, 0.367689431f},
-std::array<float,2>{0.991184294f, 0.585738659f},
-std::array<float,2>{0.252278358f, 0.957732558f},
-std::array<float,2>{0.907430172f, 0.169452354f},
-std::array<float,2>{0.226592138f, 0.399883538f},
-std::array<float,2>{0.625119627f, 0.707298994f},
-std::array<float,2>{0.10046865f, 0.557373762f},
-std::array<float,2>{0.610874951f, 0.299233317f},
-std::array<float,2>{0.390231252f, 0.0586151704f},
-std::array<float,2>{0.80924201f, 0.778895319f},
-std::array<float,2>{0.316765904f, 0.642237902f},
-std::array<float,2>{0.996035635f, 0.483359933f},
-std::array<float,2>{0.185083002f, 0.237957761f},
-std::array<float,2>{0.723290443f, 0.912624657f},
-std::array<float,2>{0.0378781036f, 0.830723286f},
-std::array<float,2>{0.542398453f, 0.1104104f},
-std::array<float,2>{0.441934735f, 0.334973603f},
-std::array<float,2>{0.849656701f, 0.618657053f},
-std::array<float,2>{0.381903082f, 0.99869287f},
-std::array<float,2>{0.800288618f, 0.134553879f},
-std::array<float,2>{0.105900206f, 0.418897361f},
-std::array<float,2>{0.624495804f, 0.739208877f},
-std::array<float,2>{0.224550769f, 0.524235308f},
-std::array<float,2>{0.637463927f, 0.273743778f},
-std::array<float,2>{0.263758302f, 0.0159606151f},
-std::array<float,2>{0.917541862f, 0.811089516f},
-std::array<float,2>{0.494821697f, 0.593076289f},
-std::array<float,2>{0.81283927f, 0.364015818f},
-std::array<float,2>{0.0146947606f, 0.0683052242f},
-std::array<float,2>{0.511807382f, 0.873509169f},
-std::array<float,2>{0.133734882f, 0.905451536f},
-std::array<float,2>{0.71407783f, 0.198895559f},
-std::array<float,2>{0.344943851f, 0.443943739f},
-std::array<float,2>{0.944703996f, 0.683172703f},
-std::array<float,2>{0.303510994f, 0.768602431f},
-std::array<float,2>{0.89240557f, 0.0516002923f},
-std::array<float,2>{0.201664239f, 0.309466958f},
-std::array<float,2>{0.684894264f, 0.55204469f},
-std::array<float,2>{0.0839654505f, 0.711868703f},
-std::array<float,2>{0.575822592f, 0.398400784f},
-std::array<float,2>{0.412817419f, 0.156625181f},
-std::array<float,2>{0.752056777f, 0.966706872f},
-std::array<float,2>{0.269472778f, 0.53642118f},
-std::array<float,2>{0.9361673f, 0.290348291f},
-std::array<float,2>{0.234444797f, 0.0463490747f},
-std::array<float,2>{0.641360402f, 0.760368466f},
-std::array<float,2>{0.121815532f, 0.938703239f},
-std::array<float,2>{0.601332903f, 0.181967959f},
-std::array<float,2>{0.393669337f, 0.389352769f},
-std::array<float,2>{0.782066524f, 0.691409409f},
-std::array<float,2>{0.453587651f, 0.845027685f},
-std::array<float,2>{0.873563647f, 0.0829853341f},
-std::array<float,2>{0.0547500588f, 0.34432593f},
-std::array<float,2>{0.552592814f, 0.569435298f},
-std::array<float,2>{0.160776049f, 0.663827598f},
-std::array<float,2>{0.735506177f, 0.465766609f},
-std::array<float,2>{0.342033058f, 0.210748017f},
-std::array<float,2>{0.980035543f, 0.887521148f},
-std::array<float,2>{0.424536705f, 0.728303969f},
-std::array<float,2>{0.771481037f, 0.42401889f},
-std::array<float,2>{0.0660077929f, 0.14955765f},
-std::array<float,2>{0.584865034f, 0.97015965f},
-std::array<float,2>{0.205309764f, 0.786101401f},
-std::array<float,2>{0.665144444f, 0.0129975909f},
-std::array<float,2>{0.283008039f, 0.251846433f},
-std::array<float,2>{0.878516972f, 0.507722616f},
-std::array<float,2>{0.369985342f, 0.936135232f},
-std::array<float,2>{0.966990829f, 0.220087439f},
-std::array<float,2>{0.142147198f, 0.487992465f},
-std::array<float,2>{0.69698f, 0.636558294f},
-std::array<float,2>{0.0218589213f, 0.599467874f},
-std::array<float,2>{0.528003454f, 0.326092571f},
-std::array<float,2>{0.478194803f, 0.0948584229f},
-std::array<float,2>{0.83128655f, 0.821745634f},
-std::array<float,2>{0.363913953f, 0.735801578f},
-std::array<float,2>{0.958149076f, 0.416511029f},
-std::array<float,2>{0.152090982f, 0.139367133f},
-std::array<float,2>{0.690502524f, 0.993948221f},
-std::array<float,2>{0.0246592183f, 0.807469368f},
-std::array<float,2>{0.523198009f, 0.0220140927f},
-std::array<float,2>{0.475781024f, 0.27940622f},
-std::array<float,2>{0.838380873f, 0.530092657f},
-std::array<float,2>{0.436613947f, 0.909259021f},
-std::array<float,2>{0.779355943f, 0.238808408f},
-std::array<float,2>{0.0733794719f, 0.477115691f},
-std::array<float,2>{0.5907377f, 0.647594392f},
-std::array<float,2>{0.211447805f, 0.624587655f},
-std::array<float,2>{0.661115944f, 0.331898093f},
-std::array<float,2>{0.291149527f, 0.114860557f},
-std::array<float,2>{0.886526406f, 0.832238257f},
-std::array<float,2>{0.462645471f, 0.548328042f},
-std::array<float,2>{0.86106652f, 0.305888057f},
-std::array<float,2>{0.0501978919f, 0.047044795f},
-std::array<float,2>{0.554753423f, 0.77306217f},
-std::array<float,2>{0.170576811f, 0.964211822f},
-std::array<float,2>{0.743522823f, 0.161277935f},
-std::array<float,2>{0.328396022f, 0.393691003f},
-std::array<float,2>{0.975382566f, 0.718202531f},
-std::array<float,2>{0.279931098f, 0.867589772f},
-std::array<float,2>{0.923508108f, 0.0628285706f},
-std::array<float,2>{0.244495943f, 0.363128126f},
-std::array<float,2>{0.655057013f, 0.588953495f},
-std::array<float,2>{0.112968266f, 0.686797976f},
-std::array<float,2>{0.603663445f, 0.438723534f},
-std::array<float,2>{0.405716181f, 0.200920939f},
-std::array<float,2>{0.79438746f, 0.900183916f},
-std::array<float,2>{0.3083224f, 0.564732254f},
-std::array<float,2>{0.90110594f, 0.349600285f},
-std::array<float,2>{0.188455984f, 0.0803954825f},
-std::array<float,2>{0.676100373f, 0.847949147f},
-std::array<float,2>{0.0901144519f, 0.883767188f},
-std::array<float,2>{0.566427052f, 0.204442725f},
-std::array<float,2>{0.421837121f, 0.464631468f},
-std::array<float,2>{0.761792183f, 0.657902896f},
-std::array<float,2>{0.489873379f, 0.762628317f},
-std::array<float,2>{0.823964775f, 0.0412655361f},
-std::array<float,2>{0.00524849584f, 0.295298398f},
-std::array<float,2>{0.500447214f, 0.531561315f},
-std::array<float,2>{0.131097063f, 0.687565625f},
-std::array<float,2>{0.706404269f, 0.386494696f},
-std::array<float,2>{0.354537398f, 0.184334964f},
-std::array<float,2>{0.952563047f, 0.943387568f},
-std::array<float,2>{0.383665591f, 0.638241231f},
-std::array<float,2>{0.808187604f, 0.491722643f},
-std::array<float,2>{0.096699588f, 0.225675821f},
-std::array<float,2>{0.614288986f, 0.929833889f},
-std::array<float,2>{0.232602894f, 0.826875925f},
-std::array<float,2>{0.629868209f, 0.101200156f},
-std::array<float,2>{0.255900979f, 0.323796511f},
-std::array<float,2>{0.911411524f, 0.594179451f},
-std::array<float,2>{0.3207708f, 0.975667f},
-std::array<float,2>{0.985921741f, 0.152532041f},
-std::array<float,2>{0.174261928f, 0.428211182f},
-std::array<float,2>{0.729577243f, 0.7328071f},
-std::array<float,2>{0.0465883464f, 0.503389418f},
-std::array<float,2>{0.535579085f, 0.254079551f},
-std::array<float,2>{0.451057374f, 0.00843426306f},
-std::array<float,2>{0.852446079f, 0.784452558f},
-std::array<float,2>{0.25961253f, 0.668624043f},
-std::array<float,2>{0.920148134f, 0.457004935f},
-std::array<float,2>{0.221668288f, 0.218123779f},
-std::array<float,2>{0.635969579f, 0.88225317f},
-std::array<float,2>{0.103287324f, 0.85529393f},
-std::array<float,2>{0.617654383f, 0.0866830349f},
-std::array<float,2>{0.376387626f, 0.352907151f},
-std::array<float,2>{0.804501474f, 0.575951219f},
-std::array<float,2>{0.43981573f, 0.948547304f},
-std::array<float,2>{0.844632685f, 0.173951507f},
-std::array<float,2>{0.0327197202f, 0.380612701f},
-std::array<float,2>{0.545986772f, 0.697201848f},
-std::array<float,2>{0.182838082f, 0.543650091f},
-std::array<float,2>{0.721232057f, 0.281485468f},
-std::array<float,2>{0.314259052f, 0.0345074497f},
-std::array<float,2>{0.997713327f, 0.752552271f},
-std::array<float,2>{0.409006596f, 0.605538428f},
-std::array<float,2>{0.757354438f, 0.315722138f},
-std::array<float,2>{0.0795477405f, 0.107360616f},
-std::array<float,2>{0.571735322f, 0.814389706f},
-std::array<float,2>{0.196759835f, 0.928094149f},
-std::array<float,2>{0.680778265f, 0.226939186f},
-std::array<float,2>{0.300751776f, 0.498646021f},
-std::array<float,2>{0.896285772f, 0.63243854f},
-std::array<float,2>{0.34948197f, 0.792201817f},
-std::array<float,2>{0.939481437f, 0.00602128496f},
-std::array<float,2>{0.13936922f, 0.260878175f},
-std::array<float,2>{0.716830075f, 0.510220408f},
-std::array<float,2>{0.0110145127f, 0.72311914f},
-std::array<float,2>{0.508873522f, 0.431749821f},
-std::array<float,2>{0.499274731f, 0.142807275f},
-std::array<float,2>{0.818688273f, 0.981613994f},
-std::array<float,2>{0.33602947f, 0.516395867f},
-std::array<float,2>{0.983709872f, 0.269512564f},
-std::array<float,2>{0.158504263f, 0.0266418792f},
-std::array<float,2>{0.739691675f, 0.801703691f},
-std::array<float,2>{0.0616400279f, 0.985042572f},
-std::array<float,2>{0.550534427f, 0.132751212f},
-std::array<float,2>{0.459515244f, 0.411536157f},
-std::array<float,2>{0.869735718f, 0.749086022f},
-std::array<float,2>{0.39492473f, 0.84088558f},
-std::array<float,2>{0.78863585f, 0.119457364f},
-std::array<float,2>{0.118586816f, 0.338334322f},
-std::array<float,2>{0.593831897f, 0.61445719f},
-std::array<float,2>{0.240992472f, 0.653374076f},
-std::array<float,2>{0.648216367f, 0.475398719f},
-std::array<float,2>{0.269877225f, 0.243152454f},
-std::array<float,2>{0.929766715f, 0.917654157f},
-std::array<float,2>{0.481053293f, 0.704747677f},
-std::array<float,2>{0.832746208f, 0.404242009f},
-std::array<float,2>{0.0167962816f, 0.164080203f},
-std::array<float,2>{0.524651825f, 0.956146419f},
-std::array<float,2>{0.145829141f, 0.774818063f},
-std::array<float,2>{0.700771451f, 0.0559988692f},
-std::array<float,2>{0.372973442f, 0.300847799f},
-std::array<float,2>{0.96250093f, 0.560717106f},
-std::array<float,2>{0.28730768f, 0.892170548f},
-std::array<float,2>{0.88182044f, 0.192134261f},
-std::array<float,2>{0.210199177f, 0.45010829f},
-std::array<float,2>{0.671353459f, 0.673784673f},
-std::array<float,2>{0.069351688f, 0.579030514f},
-std::array<float,2>{0.578863859f, 0.374423504f},
-std::array<float,2>{0.428179353f, 0.0708199069f},
-std::array<float,2>{0.765746117f, 0.866565168f},
-std::array<float,2>{0.282650769f, 0.730300307f},
-std::array<float,2>{0.878260553f, 0.422710955f},
-std::array<float,2>{0.205750123f, 0.152270183f},
-std::array<float,2>{0.665861726f, 0.972569406f},
-std::array<float,2>{0.0654759407f, 0.78724128f},
-std::array<float,2>{0.584231734f, 0.0141645782f},
-std::array<float,2>{0.423969239f, 0.252830714f},
-std::array<float,2>{0.770876646f, 0.50520426f},
-std::array<float,2>{0.477882773f, 0.934963405f},
-std::array<float,2>{0.831549585f, 0.222104371f},
-std::array<float,2>{0.0220260881f, 0.486216962f},
-std::array<float,2>{0.527666092f, 0.634382486f},
-std::array<float,2>{0.141614467f, 0.600462019f},
-std::array<float,2>{0.696526706f, 0.326606244f},
-std::array<float,2>{0.3694956f, 0.0968672484f},
-std::array<float,2>{0.967356443f, 0.823117256f},
-std::array<float,2>{0.394247472f, 0.538169563f},
-std::array<float,2>{0.781518221f, 0.292053878f},
-std::array<float,2>{0.121102557f, 0.0438936092f},
-std::array<float,2>{0.600898504f, 0.758093715f},
-std::array<float,2>{0.234922767f, 0.940815687f},
-std::array<float,2>{0.640731633f, 0.181559876f},
-std::array<float,2>{0.26886937f, 0.387527615f},
-std::array<float,2>{0.93582499f, 0.694052041f},
-std::array<float,2>{0.342612803f, 0.845743597f},
-std::array<float,2>{0.979619205f, 0.0854087174f},
-std::array<float,2>{0.160389781f, 0.346789479f},
-std::array<float,2>{0.736304045f, 0.567886233f},
-std::array<float,2>{0.0556411222f, 0.660589814f},
-std::array<float,2>{0.552063227f, 0.467820495f},
-std::array<float,2>{0.453648895f, 0.207120836f},
-std::array<float,2>{0.873446703f, 0.889435232f},
-std::array<float,2>{0.34542042f, 0.590902507f},
-std::array<float,2>{0.945063829f, 0.36706093f},
-std::array<float,2>{0.132996887f, 0.0688756034f},
-std::array<float,2>{0.714627564f, 0.871785283f},
-std::array<float,2>{0.0154341133f, 0.903935313f},
-std::array<float,2>{0.512666345f, 0.196931347f},
-std::array<float,2>{0.494549006f, 0.441556275f},
-std::array<float,2>{0.813054621f, 0.680975735f},
-std::array<float,2>{0.412432164f, 0.766727805f},
-std::array<float,2>{0.752827764f, 0.0536998883f},
-std::array<float,2>{0.0834464654f, 0.312205136f},
-std::array<float,2>{0.575404286f, 0.553019643f},
-std::array<float,2>{0.201384455f, 0.714082778f},
-std::array<float,2>{0.685459197f, 0.395124555f},
-std::array<float,2>{0.302908629f, 0.159436777f},
-std::array<float,2>{0.892022431f, 0.968284369f},
-std::array<float,2>{0.441414118f, 0.643078685f},
-std::array<float,2>{0.850260913f, 0.481835991f},
-std::array<float,2>{0.0372482352f, 0.235350445f},
-std::array<float,2>{0.542616069f, 0.910556972f},
-std::array<float,2>{0.184899911f, 0.829293907f},
-std::array<float,2>{0.723027408f, 0.112436339f},
-std::array<float,2>{0.317082137f, 0.33212769f},
-std::array<float,2>{0.99519515f, 0.620189548f},
-std::array<float,2>{0.264311016f, 0.997292459f},
-std::array<float,2>{0.917015433f, 0.136161461f},
-std::array<float,2>{0.223950177f, 0.420222253f},
-std::array<float,2>{0.637040198f, 0.740749061f},
-std::array<float,2>{0.106224567f, 0.526334822f},
-std::array<float,2>{0.624685049f, 0.275414377f},
-std::array<float,2>{0.382547498f, 0.0184926111f},
-std::array<float,2>{0.80063349f, 0.808614373f},
-std::array<float,2>{0.326919705f, 0.677726448f},
-std::array<float,2>{0.990561247f, 0.447066218f},
-std::array<float,2>{0.176646173f, 0.189463958f},
-std::array<float,2>{0.730530083f, 0.894555211f},
-std::array<float,2>{0.0419239551f, 0.860221446f},
-std::array<float,2>{0.534625292f, 0.0777199492f},
-std::array<float,2>{0.445744097f, 0.370762527f},
-std::array<float,2>{0.856357217f, 0.583599985f},
-std::array<float,2>{0.389719754f, 0.959951699f},
-std::array<float,2>{0.808873832f, 0.171668097f},
-std::array<float,2>{0.0999375284f, 0.401104838f},
-std::array<float,2>{0.610562921f, 0.710164726f},
-std::array<float,2>{0.227368996f, 0.556341946f},
-std::array<float,2>{0.625582814f, 0.296888322f},
-std::array<float,2>{0.252453476f, 0.0612835363f},
-std::array<float,2>{0.90792644f, 0.780227959f},
-std::array<float,2>{0.485463291f, 0.611301243f},
-std::array<float,2>{0.827695131f, 0.342680544f},
-std::array<float,2>{0.00326216314f, 0.124782011f},
-std::array<float,2>{0.505859554f, 0.837165415f},
-std::array<float,2>{0.126140252f, 0.918615878f},
-std::array<float,2>{0.709342957f, 0.249459371f},
-std::array<float,2>{0.359216034f, 0.470427334f},
-std::array<float,2>{0.94860357f, 0.651759863f},
-std::array<float,2>{0.31135264f, 0.796989679f},
-std::array<float,2>{0.90537411f, 0.027500907f},
-std::array<float,2>{0.194045678f, 0.270556569f},
-std::array<float,2>{0.675550401f, 0.523351371f},
-std::array<float,2>{0.0893752798f, 0.744150221f},
-std::array<float,2>{0.5664047f, 0.408392787f},
-std::array<float,2>{0.416108847f, 0.12582697f},
-std::array<float,2>{0.758812964f, 0.989623129f},
-std::array<float,2>{0.27408722f, 0.513848722f},
-std::array<float,2>{0.926480949f, 0.262519002f},
-std::array<float,2>{0.247400641f, 0.00265288493f},
-std::array<float,2>{0.651620567f, 0.793344617f},
-std::array<float,2>{0.11461015f, 0.978396356f},
-std::array<float,2>{0.606125891f, 0.147911206f},
-std::array<float,2>{0.400680929f, 0.436232269f},
-std::array<float,2>{0.791356385f, 0.719030976f},
-std::array<float,2>{0.467108577f, 0.819597602f},
-std::array<float,2>{0.864262223f, 0.103048347f},
-std::array<float,2>{0.0526053421f, 0.318404883f},
-std::array<float,2>{0.560028255f, 0.604727864f},
-std::array<float,2>{0.166645586f, 0.627819717f},
-std::array<float,2>{0.749615848f, 0.495992869f},
-std::array<float,2>{0.335085034f, 0.233750999f},
-std::array<float,2>{0.968819141f, 0.923315704f},
-std::array<float,2>{0.432119727f, 0.702846348f},
-std::array<float,2>{0.775955558f, 0.377965689f},
-std::array<float,2>{0.0759254321f, 0.179641768f},
-std::array<float,2>{0.589459777f, 0.953105748f},
-std::array<float,2>{0.218232617f, 0.757559061f},
-std::array<float,2>{0.659338832f, 0.0386138074f},
-std::array<float,2>{0.293911725f, 0.285739005f},
-std::array<float,2>{0.888350487f, 0.540661752f},
-std::array<float,2>{0.35999018f, 0.877436876f},
-std::array<float,2>{0.953745782f, 0.211878464f},
-std::array<float,2>{0.15599905f, 0.459512591f},
-std::array<float,2>{0.69220084f, 0.665769219f},
-std::array<float,2>{0.0307926815f, 0.571096778f},
-std::array<float,2>{0.517716765f, 0.35773474f},
-std::array<float,2>{0.472086042f, 0.0912856385f},
-std::array<float,2>{0.842803836f, 0.85588491f},
-std::array<float,2>{0.372505724f, 0.706879079f},
-std::array<float,2>{0.962173879f, 0.404398769f},
-std::array<float,2>{0.146386281f, 0.16644229f},
-std::array<float,2>{0.700374007f, 0.953723252f},
-std::array<float,2>{0.0172918532f, 0.77642405f},
-std::array<float,2>{0.5252527f, 0.0567562208f},
-std::array<float,2>{0.480900347f, 0.304617137f},
-std::array<float,2>{0.832134902f, 0.559088111f},
-std::array<float,2>{0.428517997f, 0.893481791f},
-std::array<float,2>{0.766463518f, 0.194690913f},
-std::array<float,2>{0.0699778572f, 0.452955574f},
-std::array<float,2>{0.578220963f, 0.674341202f},
-std::array<float,2>{0.210789233f, 0.580350161f},
-std::array<float,2>{0.67178911f, 0.371289283f},
-std::array<float,2>{0.287867695f, 0.0737085193f},
-std::array<float,2>{0.881147325f, 0.864230931f},
-std::array<float,2>{0.459268659f, 0.51849103f},
-std::array<float,2>{0.869410813f, 0.26737839f},
-std::array<float,2>{0.0621708855f, 0.0246232841f},
-std::array<float,2>{0.550204158f, 0.802753568f},
-std::array<float,2>{0.159082264f, 0.987329721f},
-std::array<float,2>{0.740036726f, 0.129814357f},
-std::array<float,2>{0.33658731f, 0.413459182f},
-std::array<float,2>{0.984273374f, 0.747767448f},
-std::array<float,2>{0.27036491f, 0.84252584f},
-std::array<float,2>{0.930652022f, 0.11874938f},
-std::array<float,2>{0.240368634f, 0.337884814f},
-std::array<float,2>{0.64765954f, 0.615579486f},
-std::array<float,2>{0.119128786f, 0.654838681f},
-std::array<float,2>{0.59430474f, 0.474027336f},
-std::array<float,2>{0.395379305f, 0.245138898f},
-std::array<float,2>{0.788562238f, 0.915607512f},
-std::array<float,2>{0.300163388f, 0.609134138f},
-std::array<float,2>{0.895945549f, 0.313080549f},
-std::array<float,2>{0.197076306f, 0.109034538f},
-std::array<float,2>{0.681508124f, 0.815726459f},
-std::array<float,2>{0.0799253285f, 0.927113295f},
-std::array<float,2>{0.571911156f, 0.22905229f},
-std::array<float,2>{0.408338964f, 0.497952431f},
-std::array<float,2>{0.75718689f, 0.629938483f},
-std::array<float,2>{0.499929219f, 0.790822804f},
-std::array<float,2>{0.81891036f, 0.00435355678f},
-std::array<float,2>{0.0114517454f, 0.259172052f},
-std::array<float,2>{0.509702146f, 0.508706391f},
-std::array<float,2>{0.13910526f, 0.724832177f},
-std::array<float,2>{0.717668593f, 0.430430889f},
-std::array<float,2>{0.34892875f, 0.142562583f},
-std::array<float,2>{0.940169096f, 0.982631743f},
-std::array<float,2>{0.376635045f, 0.671700239f},
-std::array<float,2>{0.803954482f, 0.454457194f},
-std::array<float,2>{0.10258425f, 0.216464177f},
-std::array<float,2>{0.617905557f, 0.880245388f},
-std::array<float,2>{0.220769912f, 0.853285193f},
-std::array<float,2>{0.63633889f, 0.0879018977f},
-std::array<float,2>{0.258955538f, 0.354844511f},
-std::array<float,2>{0.920636475f, 0.578118086f},
-std::array<float,2>{0.313589126f, 0.946077764f},
-std::array<float,2>{0.997123599f, 0.171924219f},
-std::array<float,2>{0.183550507f, 0.381204218f},
-std::array<float,2>{0.720923483f, 0.698096871f},
-std::array<float,2>{0.0323770493f, 0.545866191f},
-std::array<float,2>{0.546832979f, 0.28396529f},
-std::array<float,2>{0.440403461f, 0.0323036723f},
-std::array<float,2>{0.843913257f, 0.750586987f},
-std::array<float,2>{0.256792665f, 0.638993323f},
-std::array<float,2>{0.911733985f, 0.489307016f},
-std::array<float,2>{0.23314929f, 0.22303164f},
-std::array<float,2>{0.629363954f, 0.933593094f},
-std::array<float,2>{0.097578302f, 0.825329781f},
-std::array<float,2>{0.615072489f, 0.0979911983f},
-std::array<float,2>{0.383215129f, 0.321393549f},
-std::array<float,2>{0.807720602f, 0.596690476f},
-std::array<float,2>{0.450401038f, 0.973074615f},
-std::array<float,2>{0.851769328f, 0.154642463f},
-std::array<float,2>{0.0461022817f, 0.426163912f},
-std::array<float,2>{0.53581661f, 0.730826855f},
-std::array<float,2>{0.174586087f, 0.50076896f},
-std::array<float,2>{0.730235875f, 0.257622123f},
-std::array<float,2>{0.321122825f, 0.0104013709f},
-std::array<float,2>{0.985646129f, 0.781887412f},
-std::array<float,2>{0.420954347f, 0.563411117f},
-std::array<float,2>{0.762688994f, 0.350205332f},
-std::array<float,2>{0.0904490203f, 0.0792179853f},
-std::array<float,2>{0.567302048f, 0.849972785f},
-std::array<float,2>{0.187616095f, 0.885656297f},
-std::array<float,2>{0.676274002f, 0.206771255f},
-std::array<float,2>{0.308030486f, 0.461358786f},
-std::array<float,2>{0.90077126f, 0.660034239f},
-std::array<float,2>{0.355372161f, 0.76406765f},
-std::array<float,2>{0.952725589f, 0.0400868431f},
-std::array<float,2>{0.1316659f, 0.293370038f},
-std::array<float,2>{0.706589222f, 0.535140872f},
-std::array<float,2>{0.0056017451f, 0.689878583f},
-std::array<float,2>{0.500858843f, 0.384594321f},
-std::array<float,2>{0.489643246f, 0.186749354f},
-std::array<float,2>{0.823354006f, 0.942138553f},
-std::array<float,2>{0.328969896f, 0.550406456f},
-std::array<float,2>{0.974841535f, 0.306712925f},
-std::array<float,2>{0.169955447f, 0.0506955273f},
-std::array<float,2>{0.743921995f, 0.770999193f},
-std::array<float,2>{0.050753165f, 0.961456001f},
-std::array<float,2>{0.555431724f, 0.163730934f},
-std::array<float,2>{0.462052941f, 0.392498404f},
-std::array<float,2>{0.86074847f, 0.716774106f},
-std::array<float,2>{0.406249315f, 0.87040484f},
-std::array<float,2>{0.794759333f, 0.064837195f},
-std::array<float,2>{0.112580121f, 0.359903872f},
-std::array<float,2>{0.604277134f, 0.587050617f},
-std::array<float,2>{0.244633168f, 0.684317648f},
-std::array<float,2>{0.654426694f, 0.440178275f},
-std::array<float,2>{0.279631138f, 0.202360049f},
-std::array<float,2>{0.923024118f, 0.901793957f},
-std::array<float,2>{0.476554185f, 0.738246799f},
-std::array<float,2>{0.838327527f, 0.414081216f},
-std::array<float,2>{0.0251651648f, 0.137782961f},
-std::array<float,2>{0.522753239f, 0.995685697f},
-std::array<float,2>{0.151455745f, 0.806126893f},
-std::array<float,2>{0.691201627f, 0.0203887485f},
-std::array<float,2>{0.36330542f, 0.279080003f},
-std::array<float,2>{0.958669424f, 0.529097676f},
-std::array<float,2>{0.291715622f, 0.907191575f},
-std::array<float,2>{0.885866165f, 0.241370544f},
-std::array<float,2>{0.211012349f, 0.479338735f},
-std::array<float,2>{0.660195768f, 0.646349967f},
-std::array<float,2>{0.0738069341f, 0.621864438f},
-std::array<float,2>{0.58996737f, 0.329118311f},
-std::array<float,2>{0.437377602f, 0.115862086f},
-std::array<float,2>{0.779789448f, 0.834519804f},
-std::array<float,2>{0.265932024f, 0.692179382f},
-std::array<float,2>{0.934328675f, 0.388752222f},
-std::array<float,2>{0.237180859f, 0.182284832f},
-std::array<float,2>{0.642591f, 0.939171791f},
-std::array<float,2>{0.124398291f, 0.760156333f},
-std::array<float,2>{0.597819448f, 0.046532426f},
-std::array<float,2>{0.390639514f, 0.29080981f},
-std::array<float,2>{0.783339918f, 0.537020326f},
-std::array<float,2>{0.455831081f, 0.886777818f},
-std::array<float,2>{0.872277439f, 0.210308194f},
-std::array<float,2>{0.0572616532f, 0.465183556f},
-std::array<float,2>{0.552795589f, 0.663116395f},
-std::array<float,2>{0.162983447f, 0.569967389f},
-std::array<float,2>{0.736828089f, 0.344182551f},
-std::array<float,2>{0.341106683f, 0.0822908208f},
-std::array<float,2>{0.978115916f, 0.845584035f},
-std::array<float,2>{0.423712492f, 0.507306099f},
-std::array<float,2>{0.772592723f, 0.251282185f},
-std::array<float,2>{0.0626287386f, 0.013220611f},
-std::array<float,2>{0.583570659f, 0.785487294f},
-std::array<float,2>{0.20455505f, 0.970475256f},
-std::array<float,2>{0.667238057f, 0.150052622f},
-std::array<float,2>{0.284573764f, 0.424754053f},
-std::array<float,2>{0.875847757f, 0.727688968f},
-std::array<float,2>{0.367898226f, 0.821980834f},
-std::array<float,2>{0.965063453f, 0.0953371599f},
-std::array<float,2>{0.144334838f, 0.325370222f},
-std::array<float,2>{0.698656619f, 0.59867245f},
-std::array<float,2>{0.0208676569f, 0.635843456f},
-std::array<float,2>{0.530594766f, 0.487489522f},
-std::array<float,2>{0.480236024f, 0.220350996f},
-std::array<float,2>{0.828129768f, 0.93583113f},
-std::array<float,2>{0.319994926f, 0.618630588f},
-std::array<float,2>{0.993717909f, 0.335726947f},
-std::array<float,2>{0.187243506f, 0.111287422f},
-std::array<float,2>{0.726168871f, 0.830124676f},
-std::array<float,2>{0.0366017483f, 0.912386954f},
-std::array<float,2>{0.539689064f, 0.237674251f},
-std::array<float,2>{0.444380373f, 0.48269102f},
-std::array<float,2>{0.847981811f, 0.641866028f},
-std::array<float,2>{0.380103111f, 0.810721099f},
-std::array<float,2>{0.798683703f, 0.0162280016f},
-std::array<float,2>{0.107783534f, 0.273961306f},
-std::array<float,2>{0.622619212f, 0.523919523f},
-std::array<float,2>{0.226021096f, 0.73846817f},
-std::array<float,2>{0.638740897f, 0.418398201f},
-std::array<float,2>{0.262639135f, 0.133994207f},
-std::array<float,2>{0.915228069f, 0.998458803f},
-std::array<float,2>{0.492229164f, 0.682736993f},
-std::array<float,2>{0.816330552f, 0.443523586f},
-std::array<float,2>{0.012375473f, 0.198312476f},
-std::array<float,2>{0.514938951f, 0.90618068f},
-std::array<float,2>{0.136711583f, 0.873537242f},
-std::array<float,2>{0.711431682f, 0.0675826594f},
-std::array<float,2>{0.347353131f, 0.36331138f},
-std::array<float,2>{0.942488372f, 0.593701541f},
-std::array<float,2>{0.300977081f, 0.965893507f},
-std::array<float,2>{0.894031107f, 0.157222062f},
-std::array<float,2>{0.199395776f, 0.39792785f},
-std::array<float,2>{0.686593652f, 0.711346447f},
-std::array<float,2>{0.0858886391f, 0.55257988f},
-std::array<float,2>{0.57763344f, 0.308846414f},
-std::array<float,2>{0.411067635f, 0.0511089377f},
-std::array<float,2>{0.75127399f, 0.769197464f},
-std::array<float,2>{0.357352912f, 0.649789453f},
-std::array<float,2>{0.946018398f, 0.471041918f},
-std::array<float,2>{0.127747878f, 0.246618137f},
-std::array<float,2>{0.707947612f, 0.920978367f},
-std::array<float,2>{0.000260486442f, 0.839321375f},
-std::array<float,2>{0.504418552f, 0.122908391f},
-std::array<float,2>{0.487672299f, 0.341435164f},
-std::array<float,2>{0.825650394f, 0.612584114f},
-std::array<float,2>{0.415164888f, 0.990948856f},
-std::array<float,2>{0.760863423f, 0.128296897f},
-std::array<float,2>{0.0860792547f, 0.407055229f},
-std::array<float,2>{0.563723385f, 0.743239224f},
-std::array<float,2>{0.192892343f, 0.520100594f},
-std::array<float,2>{0.673382938f, 0.271777153f},
-std::array<float,2>{0.309520483f, 0.0304567553f},
-std::array<float,2>{0.902751446f, 0.800381303f},
-std::array<float,2>{0.447266161f, 0.585083306f},
-std::array<float,2>{0.85812521f, 0.367570013f},
-std::array<float,2>{0.0403388962f, 0.0761553943f},
-std::array<float,2>{0.531454086f, 0.862500787f},
-std::array<float,2>{0.1788899f, 0.896798551f},
-std::array<float,2>{0.732878327f, 0.188602567f},
-std::array<float,2>{0.324494421f, 0.447723329f},
-std::array<float,2>{0.988477528f, 0.679134488f},
-std::array<float,2>{0.25146997f, 0.778746188f},
-std::array<float,2>{0.908694863f, 0.059560895f},
-std::array<float,2>{0.228626773f, 0.299720258f},
-std::array<float,2>{0.628383696f, 0.557023287f},
-std::array<float,2>{0.097876139f, 0.707582116f},
-std::array<float,2>{0.611789882f, 0.399980515f},
-std::array<float,2>{0.388372749f, 0.169189438f},
-std::array<float,2>{0.811880171f, 0.957100987f},
-std::array<float,2>{0.296327114f, 0.541119337f},
-std::array<float,2>{0.888712227f, 0.287389427f},
-std::array<float,2>{0.215591222f, 0.0370569304f},
-std::array<float,2>{0.657728851f, 0.753936052f},
-std::array<float,2>{0.077115424f, 0.950462103f},
-std::array<float,2>{0.587837815f, 0.176837981f},
-std::array<float,2>{0.43151018f, 0.375297874f},
-std::array<float,2>{0.774507821f, 0.700882137f},
-std::array<float,2>{0.469129384f, 0.858470857f},
-std::array<float,2>{0.84046191f, 0.0918494165f},
-std::array<float,2>{0.027849678f, 0.357081383f},
-std::array<float,2>{0.515699387f, 0.573294163f},
-std::array<float,2>{0.154060826f, 0.666493058f},
-std::array<float,2>{0.693892479f, 0.457345515f},
-std::array<float,2>{0.361356199f, 0.214580953f},
-std::array<float,2>{0.955692053f, 0.875914872f},
-std::array<float,2>{0.400226831f, 0.721657872f},
-std::array<float,2>{0.789663732f, 0.435210437f},
-std::array<float,2>{0.116731249f, 0.145494044f},
-std::array<float,2>{0.608568311f, 0.979610562f},
-std::array<float,2>{0.249487802f, 0.796010017f},
-std::array<float,2>{0.650156379f, 0.000432553643f},
-std::array<float,2>{0.277009666f, 0.264444411f},
-std::array<float,2>{0.92919606f, 0.513311028f},
-std::array<float,2>{0.333609134f, 0.925230801f},
-std::array<float,2>{0.971300423f, 0.232051715f},
-std::array<float,2>{0.165901959f, 0.492512494f},
-std::array<float,2>{0.746613085f, 0.626405954f},
-std::array<float,2>{0.0545661859f, 0.602019429f},
-std::array<float,2>{0.561638534f, 0.317104846f},
-std::array<float,2>{0.466362476f, 0.103575714f},
-std::array<float,2>{0.865340233f, 0.817489982f},
-std::array<float,2>{0.339512408f, 0.749593318f},
-std::array<float,2>{0.981800437f, 0.41184482f},
-std::array<float,2>{0.156788886f, 0.132064074f},
-std::array<float,2>{0.742082894f, 0.984486103f},
-std::array<float,2>{0.0604849868f, 0.801198065f},
-std::array<float,2>{0.547804296f, 0.0273192041f},
-std::array<float,2>{0.457683295f, 0.268860132f},
-std::array<float,2>{0.869059622f, 0.516058087f},
-std::array<float,2>{0.397607744f, 0.917411208f},
-std::array<float,2>{0.785472155f, 0.242258474f},
-std::array<float,2>{0.120399609f, 0.474802434f},
-std::array<float,2>{0.597497761f, 0.654124141f},
-std::array<float,2>{0.238518655f, 0.614878953f},
-std::array<float,2>{0.64631635f, 0.338430077f},
-std::array<float,2>{0.272476971f, 0.120093226f},
-std::array<float,2>{0.93243593f, 0.841634393f},
-std::array<float,2>{0.484173924f, 0.561085284f},
-std::array<float,2>{0.834159374f, 0.301452577f},
-std::array<float,2>{0.0194762982f, 0.056382589f},
-std::array<float,2>{0.526228845f, 0.775110245f},
-std::array<float,2>{0.148339495f, 0.956821144f},
-std::array<float,2>{0.701326728f, 0.164961368f},
-std::array<float,2>{0.374014765f, 0.403504908f},
-std::array<float,2>{0.96402365f, 0.70457387f},
-std::array<float,2>{0.285299569f, 0.866805196f},
-std::array<float,2>{0.879646659f, 0.0706578493f},
-std::array<float,2>{0.208967283f, 0.374738842f},
-std::array<float,2>{0.669349134f, 0.578426719f},
-std::array<float,2>{0.0682691261f, 0.672882259f},
-std::array<float,2>{0.580450296f, 0.449501216f},
-std::array<float,2>{0.427640408f, 0.191555306f},
-std::array<float,2>{0.767633796f, 0.89192307f},
-std::array<float,2>{0.260336876f, 0.575465024f},
-std::array<float,2>{0.919288218f, 0.353231966f},
-std::array<float,2>{0.219372615f, 0.0860232338f},
-std::array<float,2>{0.634295344f, 0.854534805f},
-std::array<float,2>{0.105037279f, 0.882353723f},
-std::array<float,2>{0.619297981f, 0.218545765f},
-std::array<float,2>{0.377034843f, 0.45608747f},
-std::array<float,2>{0.801282287f, 0.668436229f},
-std::array<float,2>{0.438365042f, 0.752023876f},
-std::array<float,2>{0.846429944f, 0.0350931771f},
-std::array<float,2>{0.0341344737f, 0.281879365f},
-std::array<float,2>{0.543139517f, 0.543015182f},
-std::array<float,2>{0.180538446f, 0.696681857f},
-std::array<float,2>{0.719922364f, 0.380222082f},
-std::array<float,2>{0.31507352f, 0.174400404f},
-std::array<float,2>{0.998413205f, 0.949106276f},
-std::array<float,2>{0.407008022f, 0.632115722f},
-std::array<float,2>{0.753939629f, 0.49841553f},
-std::array<float,2>{0.0800903589f, 0.227269575f},
-std::array<float,2>{0.573974669f, 0.928462923f},
-std::array<float,2>{0.197878197f, 0.813864946f},
-std::array<float,2>{0.681697547f, 0.106622472f},
-std::array<float,2>{0.298604816f, 0.316400379f},
-std::array<float,2>{0.897922695f, 0.606287181f},
-std::array<float,2>{0.351394922f, 0.981974125f},
-std::array<float,2>{0.937829852f, 0.143406883f},
-std::array<float,2>{0.138353243f, 0.432546228f},
-std::array<float,2>{0.716596127f, 0.723228097f},
-std::array<float,2>{0.00894399639f, 0.510363877f},
-std::array<float,2>{0.510218322f, 0.261245608f},
-std::array<float,2>{0.497387707f, 0.0065586241f},
-std::array<float,2>{0.818091094f, 0.792679608f},
-std::array<float,2>{0.306586683f, 0.657352924f},
-std::array<float,2>{0.898671329f, 0.464289665f},
-std::array<float,2>{0.190070078f, 0.204790249f},
-std::array<float,2>{0.678024352f, 0.883208513f},
-std::array<float,2>{0.0931483209f, 0.848348677f},
-std::array<float,2>{0.570138037f, 0.0810269192f},
-std::array<float,2>{0.419871479f, 0.349045306f},
-std::array<float,2>{0.76401037f, 0.56503588f},
-std::array<float,2>{0.491869867f, 0.944257915f},
-std::array<float,2>{0.821337223f, 0.183889002f},
-std::array<float,2>{0.00658934703f, 0.386188895f},
-std::array<float,2>{0.50244081f, 0.688366115f},
-std::array<float,2>{0.129138634f, 0.53174752f},
-std::array<float,2>{0.703289688f, 0.295839369f},
-std::array<float,2>{0.352236092f, 0.0419610143f},
-std::array<float,2>{0.950510502f, 0.762090921f},
-std::array<float,2>{0.384951234f, 0.594260812f},
-std::array<float,2>{0.805550158f, 0.323591113f},
-std::array<float,2>{0.0951873213f, 0.10094589f},
-std::array<float,2>{0.616406739f, 0.826590896f},
-std::array<float,2>{0.231112644f, 0.930200458f},
-std::array<float,2>{0.632643402f, 0.226137429f},
-std::array<float,2>{0.254814714f, 0.491214126f},
-std::array<float,2>{0.913708329f, 0.637799919f},
-std::array<float,2>{0.322359115f, 0.785031378f},
-std::array<float,2>{0.986602962f, 0.00786081329f},
-std::array<float,2>{0.172982693f, 0.254879415f},
-std::array<float,2>{0.72841382f, 0.503595889f},
-std::array<float,2>{0.0431965366f, 0.733215809f},
-std::array<float,2>{0.537213922f, 0.428357005f},
-std::array<float,2>{0.451833665f, 0.153091699f},
-std::array<float,2>{0.854151666f, 0.976464748f},
-std::array<float,2>{0.366992414f, 0.529704452f},
-std::array<float,2>{0.959026933f, 0.280268461f},
-std::array<float,2>{0.148516387f, 0.0217835885f},
-std::array<float,2>{0.688889205f, 0.806652725f},
-std::array<float,2>{0.026694078f, 0.993489444f},
-std::array<float,2>{0.52137351f, 0.138677791f},
-std::array<float,2>{0.473492444f, 0.416085541f},
-std::array<float,2>{0.836299956f, 0.736023545f},
-std::array<float,2>{0.434727699f, 0.832681239f},
-std::array<float,2>{0.778865993f, 0.114409119f},
-std::array<float,2>{0.0717535466f, 0.331064194f},
-std::array<float,2>{0.592968643f, 0.624244153f},
-std::array<float,2>{0.214206338f, 0.648307145f},
-std::array<float,2>{0.663073242f, 0.476780951f},
-std::array<float,2>{0.289500654f, 0.238419145f},
-std::array<float,2>{0.883304715f, 0.909937859f},
-std::array<float,2>{0.463449031f, 0.718361676f},
-std::array<float,2>{0.861682534f, 0.394374251f},
-std::array<float,2>{0.0478667878f, 0.161923856f},
-std::array<float,2>{0.557079971f, 0.964496315f},
-std::array<float,2>{0.168237969f, 0.772878647f},
-std::array<float,2>{0.744980693f, 0.0478199124f},
-std::array<float,2>{0.330756754f, 0.306426436f},
-std::array<float,2>{0.974242151f, 0.548665881f},
-std::array<float,2>{0.278631806f, 0.899513304f},
-std::array<float,2>{0.925606847f, 0.200431585f},
-std::array<float,2>{0.243454188f, 0.439270258f},
-std::array<float,2>{0.652922034f, 0.687230408f},
-std::array<float,2>{0.109693371f, 0.589609504f},
-std::array<float,2>{0.603354096f, 0.362383336f},
-std::array<float,2>{0.403563201f, 0.0631636009f},
-std::array<float,2>{0.796447694f, 0.867812157f},
-std::array<float,2>{0.263333976f, 0.742117703f},
-std::array<float,2>{0.91467905f, 0.420948625f},
-std::array<float,2>{0.225527018f, 0.135252818f},
-std::array<float,2>{0.640113294f, 0.996522725f},
-std::array<float,2>{0.1089231f, 0.809872687f},
-std::array<float,2>{0.621419907f, 0.0193187501f},
-std::array<float,2>{0.379280359f, 0.277253479f},
-std::array<float,2>{0.797523618f, 0.527190924f},
-std::array<float,2>{0.44347477f, 0.911191106f},
-std::array<float,2>{0.849140525f, 0.235416055f},
-std::array<float,2>{0.0352496579f, 0.480580628f},
-std::array<float,2>{0.540483654f, 0.644108474f},
-std::array<float,2>{0.186305165f, 0.620054364f},
-std::array<float,2>{0.725067616f, 0.333558589f},
-std::array<float,2>{0.319012612f, 0.111773893f},
-std::array<float,2>{0.992759883f, 0.828278303f},
-std::array<float,2>{0.412054151f, 0.553780615f},
-std::array<float,2>{0.750428319f, 0.310655951f},
-std::array<float,2>{0.0847741961f, 0.0545506179f},
-std::array<float,2>{0.576225817f, 0.765877604f},
-std::array<float,2>{0.200839221f, 0.966961443f},
-std::array<float,2>{0.686030149f, 0.158216879f},
-std::array<float,2>{0.302715242f, 0.395829856f},
-std::array<float,2>{0.893067598f, 0.713820517f},
-std::array<float,2>{0.345740885f, 0.872359574f},
-std::array<float,2>{0.941730499f, 0.0695378333f},
-std::array<float,2>{0.135634229f, 0.365546763f},
-std::array<float,2>{0.712777674f, 0.590188146f},
-std::array<float,2>{0.0127228554f, 0.680071712f},
-std::array<float,2>{0.514539719f, 0.442504972f},
-std::array<float,2>{0.493573636f, 0.195667177f},
-std::array<float,2>{0.815002322f, 0.902766287f},
-std::array<float,2>{0.339909345f, 0.566736579f},
-std::array<float,2>{0.977299333f, 0.346139163f},
-std::array<float,2>{0.163270444f, 0.0847593769f},
-std::array<float,2>{0.737836123f, 0.847496569f},
-std::array<float,2>{0.0584475622f, 0.890231311f},
-std::array<float,2>{0.553883851f, 0.208549738f},
-std::array<float,2>{0.456511676f, 0.466841131f},
-std::array<float,2>{0.871375799f, 0.661404431f},
-std::array<float,2>{0.391632676f, 0.759373724f},
-std::array<float,2>{0.784180045f, 0.0444520451f},
-std::array<float,2>{0.123241842f, 0.291019887f},
-std::array<float,2>{0.599330306f, 0.537965894f},
-std::array<float,2>{0.237597406f, 0.694735229f},
-std::array<float,2>{0.644222498f, 0.388394475f},
-std::array<float,2>{0.267459571f, 0.180578783f},
-std::array<float,2>{0.935123861f, 0.939568877f},
-std::array<float,2>{0.478869885f, 0.63328892f},
-std::array<float,2>{0.829727411f, 0.484404474f},
-std::array<float,2>{0.0199333113f, 0.221650198f},
-std::array<float,2>{0.529796243f, 0.933782637f},
-std::array<float,2>{0.142720431f, 0.823384047f},
-std::array<float,2>{0.697919905f, 0.0965622887f},
-std::array<float,2>{0.368518859f, 0.328122437f},
-std::array<float,2>{0.966604829f, 0.600972295f},
-std::array<float,2>{0.283704251f, 0.971327186f},
-std::array<float,2>{0.876441538f, 0.150518283f},
-std::array<float,2>{0.203252375f, 0.423128128f},
-std::array<float,2>{0.666940749f, 0.728864431f},
-std::array<float,2>{0.0635683984f, 0.504839599f},
-std::array<float,2>{0.58206898f, 0.253784716f},
-std::array<float,2>{0.422057539f, 0.0149225118f},
-std::array<float,2>{0.771913767f, 0.78824383f},
-std::array<float,2>{0.362332344f, 0.664610803f},
-std::array<float,2>{0.956663489f, 0.460695207f},
-std::array<float,2>{0.153064683f, 0.212597981f},
-std::array<float,2>{0.69502604f, 0.877993464f},
-std::array<float,2>{0.0286107063f, 0.856452167f},
-std::array<float,2>{0.517552853f, 0.0907673314f},
-std::array<float,2>{0.470429927f, 0.358720422f},
-std::array<float,2>{0.840981603f, 0.572121024f},
-std::array<float,2>{0.429753184f, 0.951869845f},
-std::array<float,2>{0.77412349f, 0.17856963f},
-std::array<float,2>{0.0780327097f, 0.377276182f},
-std::array<float,2>{0.586162388f, 0.701947927f},
-std::array<float,2>{0.216087714f, 0.539779603f},
-std::array<float,2>{0.657202184f, 0.286624104f},
-std::array<float,2>{0.295659542f, 0.0371589884f},
-std::array<float,2>{0.88999927f, 0.756359637f},
-std::array<float,2>{0.465059191f, 0.604322255f},
-std::array<float,2>{0.866549015f, 0.319932729f},
-std::array<float,2>{0.052849669f, 0.102243491f},
-std::array<float,2>{0.561317682f, 0.818924487f},
-std::array<float,2>{0.164323032f, 0.922042787f},
-std::array<float,2>{0.747497141f, 0.232913986f},
-std::array<float,2>{0.332730234f, 0.494552195f},
-std::array<float,2>{0.972028971f, 0.628169715f},
-std::array<float,2>{0.275523007f, 0.794650614f},
-std::array<float,2>{0.927843094f, 0.00376377325f},
-std::array<float,2>{0.248809904f, 0.262907863f},
-std::array<float,2>{0.648846984f, 0.51562351f},
-std::array<float,2>{0.116057903f, 0.719786584f},
-std::array<float,2>{0.608299673f, 0.436687499f},
-std::array<float,2>{0.398748606f, 0.147375345f},
-std::array<float,2>{0.790970564f, 0.977151453f},
-std::array<float,2>{0.309953034f, 0.521859348f},
-std::array<float,2>{0.903333843f, 0.270384401f},
-std::array<float,2>{0.191854477f, 0.0284299888f},
-std::array<float,2>{0.672080457f, 0.798209727f},
-std::array<float,2>{0.0876680091f, 0.988290131f},
-std::array<float,2>{0.563182771f, 0.126406208f},
-std::array<float,2>{0.414229214f, 0.409593493f},
-std::array<float,2>{0.760389864f, 0.745322049f},
-std::array<float,2>{0.48647964f, 0.836636901f},
-std::array<float,2>{0.824962676f, 0.123254918f},
-std::array<float,2>{0.00162097497f, 0.343595862f},
-std::array<float,2>{0.504909813f, 0.609680712f},
-std::array<float,2>{0.128603637f, 0.650501251f},
-std::array<float,2>{0.708127975f, 0.468954206f},
-std::array<float,2>{0.356319726f, 0.248630077f},
-std::array<float,2>{0.947008431f, 0.919631302f},
-std::array<float,2>{0.387197971f, 0.709136665f},
-std::array<float,2>{0.810612261f, 0.402098268f},
-std::array<float,2>{0.0989075974f, 0.170802742f},
-std::array<float,2>{0.612855852f, 0.96091938f},
-std::array<float,2>{0.230147868f, 0.781229317f},
-std::array<float,2>{0.627048135f, 0.0620113127f},
-std::array<float,2>{0.250556052f, 0.298680335f},
-std::array<float,2>{0.910096943f, 0.555177748f},
-std::array<float,2>{0.325680822f, 0.896060705f},
-std::array<float,2>{0.989711165f, 0.19047384f},
-std::array<float,2>{0.178394899f, 0.445582867f},
-std::array<float,2>{0.734250069f, 0.676165223f},
-std::array<float,2>{0.0397030786f, 0.582051873f},
-std::array<float,2>{0.532231569f, 0.36993897f},
-std::array<float,2>{0.448828071f, 0.0765800476f},
-std::array<float,2>{0.858672619f, 0.861036777f},
-std::array<float,2>{0.315510213f, 0.698968828f},
-std::array<float,2>{0.999914169f, 0.382165253f},
-std::array<float,2>{0.181136936f, 0.173512399f},
-std::array<float,2>{0.719062269f, 0.94668287f},
-std::array<float,2>{0.0343847759f, 0.751574636f},
-std::array<float,2>{0.54444474f, 0.0316324271f},
-std::array<float,2>{0.439254403f, 0.284825563f},
-std::array<float,2>{0.846680284f, 0.546111166f},
-std::array<float,2>{0.378765464f, 0.879206538f},
-std::array<float,2>{0.801983416f, 0.215396002f},
-std::array<float,2>{0.103871673f, 0.453722715f},
-std::array<float,2>{0.620807528f, 0.670837939f},
-std::array<float,2>{0.220325068f, 0.576458633f},
-std::array<float,2>{0.633695424f, 0.353585452f},
-std::array<float,2>{0.26141867f, 0.0892117023f},
-std::array<float,2>{0.918430626f, 0.851721346f},
-std::array<float,2>{0.496305168f, 0.509273767f},
-std::array<float,2>{0.816535115f, 0.258078575f},
-std::array<float,2>{0.00859382935f, 0.00498143956f},
-std::array<float,2>{0.511661112f, 0.78985393f},
-std::array<float,2>{0.137597159f, 0.984073162f},
-std::array<float,2>{0.715626419f, 0.140917689f},
-std::array<float,2>{0.350552052f, 0.431270033f},
-std::array<float,2>{0.938625216f, 0.726391852f},
-std::array<float,2>{0.297723889f, 0.815045476f},
-std::array<float,2>{0.896501958f, 0.10834419f},
-std::array<float,2>{0.198672861f, 0.314392924f},
-std::array<float,2>{0.682859361f, 0.607934773f},
-std::array<float,2>{0.0813271105f, 0.629763067f},
-std::array<float,2>{0.572281718f, 0.496807069f},
-std::array<float,2>{0.407785743f, 0.230092928f},
-std::array<float,2>{0.755529881f, 0.926171005f},
-std::array<float,2>{0.272095948f, 0.616766036f},
-std::array<float,2>{0.932734787f, 0.336887002f},
-std::array<float,2>{0.239906609f, 0.117790781f},
-std::array<float,2>{0.644794464f, 0.843067884f},
-std::array<float,2>{0.119500309f, 0.914855957f},
-std::array<float,2>{0.596140027f, 0.244950861f},
-std::array<float,2>{0.39701274f, 0.47341156f},
-std::array<float,2>{0.786511004f, 0.655564308f},
-std::array<float,2>{0.458220512f, 0.803890526f},
-std::array<float,2>{0.867925763f, 0.0240595117f},
-std::array<float,2>{0.0588222109f, 0.266035497f},
-std::array<float,2>{0.548672795f, 0.519404888f},
-std::array<float,2>{0.157533184f, 0.746928096f},
-std::array<float,2>{0.740623534f, 0.412932813f},
-std::array<float,2>{0.338497311f, 0.130669549f},
-std::array<float,2>{0.981224895f, 0.986454189f},
-std::array<float,2>{0.425975859f, 0.674996912f},
-std::array<float,2>{0.769110441f, 0.451743901f},
-std::array<float,2>{0.0673490912f, 0.193576649f},
-std::array<float,2>{0.581607342f, 0.893773735f},
-std::array<float,2>{0.207561702f, 0.864504516f},
-std::array<float,2>{0.668735087f, 0.0728780553f},
-std::array<float,2>{0.286640763f, 0.372513622f},
-std::array<float,2>{0.880172491f, 0.581628382f},
-std::array<float,2>{0.374528915f, 0.954481602f},
-std::array<float,2>{0.963459671f, 0.167262569f},
-std::array<float,2>{0.147031173f, 0.405948281f},
-std::array<float,2>{0.702305734f, 0.705574036f},
-std::array<float,2>{0.0177060422f, 0.560529411f},
-std::array<float,2>{0.526972413f, 0.302901149f},
-std::array<float,2>{0.482764691f, 0.0580139048f},
-std::array<float,2>{0.83558321f, 0.775948465f},
-std::array<float,2>{0.290743619f, 0.644542813f},
-std::array<float,2>{0.884624541f, 0.47961849f},
-std::array<float,2>{0.213004142f, 0.240350783f},
-std::array<float,2>{0.663908839f, 0.907366455f},
-std::array<float,2>{0.0706510916f, 0.835608065f},
-std::array<float,2>{0.592354417f, 0.117068462f},
-std::array<float,2>{0.434238672f, 0.328172684f},
-std::array<float,2>{0.778234899f, 0.622128725f},
-std::array<float,2>{0.474395931f, 0.994839549f},
-std::array<float,2>{0.837432086f, 0.136928365f},
-std::array<float,2>{0.0256528724f, 0.415190488f},
-std::array<float,2>{0.519840598f, 0.737243831f},
-std::array<float,2>{0.149627939f, 0.527367115f},
-std::array<float,2>{0.687665045f, 0.277490616f},
-std::array<float,2>{0.365882188f, 0.0213301387f},
-std::array<float,2>{0.960056186f, 0.805173934f},
-std::array<float,2>{0.402540177f, 0.58609587f},
-std::array<float,2>{0.795691848f, 0.360632718f},
-std::array<float,2>{0.111057661f, 0.0658614933f},
-std::array<float,2>{0.602498531f, 0.870052636f},
-std::array<float,2>{0.242310271f, 0.900472701f},
-std::array<float,2>{0.653953314f, 0.202103198f},
-std::array<float,2>{0.277652681f, 0.440847605f},
-std::array<float,2>{0.924118042f, 0.684754312f},
-std::array<float,2>{0.331440955f, 0.770000279f},
-std::array<float,2>{0.973086536f, 0.0493874811f},
-std::array<float,2>{0.16966489f, 0.307859838f},
-std::array<float,2>{0.745676875f, 0.54944092f},
-std::array<float,2>{0.0472138338f, 0.715072513f},
-std::array<float,2>{0.558032572f, 0.391413152f},
-std::array<float,2>{0.464048415f, 0.162318915f},
-std::array<float,2>{0.862546325f, 0.962755978f},
-std::array<float,2>{0.352948308f, 0.533771753f},
-std::array<float,2>{0.949294567f, 0.294527739f},
-std::array<float,2>{0.130083144f, 0.0394129455f},
-std::array<float,2>{0.704687119f, 0.765263021f},
-std::array<float,2>{0.00743571296f, 0.943271816f},
-std::array<float,2>{0.503509164f, 0.185920671f},
-std::array<float,2>{0.490683347f, 0.382915497f},
-std::array<float,2>{0.821237683f, 0.69050765f},
-std::array<float,2>{0.418317616f, 0.851069152f},
-std::array<float,2>{0.764879107f, 0.0784222931f},
-std::array<float,2>{0.0918699875f, 0.350745261f},
-std::array<float,2>{0.568518877f, 0.563709557f},
-std::array<float,2>{0.190638557f, 0.658626616f},
-std::array<float,2>{0.678862333f, 0.462715149f},
-std::array<float,2>{0.305354416f, 0.205154911f},
-std::array<float,2>{0.899692893f, 0.885870278f},
-std::array<float,2>{0.45233199f, 0.732091784f},
-std::array<float,2>{0.855265617f, 0.427602679f},
-std::array<float,2>{0.04439836f, 0.155674964f},
-std::array<float,2>{0.538646281f, 0.974324346f},
-std::array<float,2>{0.172806025f, 0.782517374f},
-std::array<float,2>{0.727411389f, 0.0111448178f},
-std::array<float,2>{0.324199528f, 0.256371975f},
-std::array<float,2>{0.988220692f, 0.501039684f},
-std::array<float,2>{0.255235583f, 0.932257116f},
-std::array<float,2>{0.912820578f, 0.223924428f},
-std::array<float,2>{0.232151791f, 0.488584876f},
-std::array<float,2>{0.630965352f, 0.64002347f},
-std::array<float,2>{0.094114691f, 0.595977962f},
-std::array<float,2>{0.615846217f, 0.320327818f},
-std::array<float,2>{0.386646837f, 0.0993547216f},
-std::array<float,2>{0.805937171f, 0.824264109f},
-std::array<float,2>{0.304055244f, 0.712807298f},
-std::array<float,2>{0.891420245f, 0.397052824f},
-std::array<float,2>{0.202740997f, 0.15723367f},
-std::array<float,2>{0.683659077f, 0.965251744f},
-std::array<float,2>{0.0829271525f, 0.767592847f},
-std::array<float,2>{0.574262381f, 0.0522413105f},
-std::array<float,2>{0.413537443f, 0.31017223f},
-std::array<float,2>{0.753810525f, 0.55123502f},
-std::array<float,2>{0.495357782f, 0.904586256f},
-std::array<float,2>{0.813944101f, 0.197454885f},
-std::array<float,2>{0.0138286296f, 0.445051283f},
-std::array<float,2>{0.513256848f, 0.681867242f},
-std::array<float,2>{0.134085968f, 0.592417419f},
-std::array<float,2>{0.713079631f, 0.364669323f},
-std::array<float,2>{0.344038814f, 0.0671020299f},
-std::array<float,2>{0.943426669f, 0.874534905f},
-std::array<float,2>{0.380878001f, 0.525374293f},
-std::array<float,2>{0.799609363f, 0.275281817f},
-std::array<float,2>{0.107191727f, 0.0171382725f},
-std::array<float,2>{0.623863041f, 0.811819792f},
-std::array<float,2>{0.22311604f, 0.999074459f},
-std::array<float,2>{0.638229966f, 0.133585215f},
-std::array<float,2>{0.265017718f, 0.419661582f},
-std::array<float,2>{0.916864634f, 0.739624739f},
-std::array<float,2>{0.317458361f, 0.831676543f},
-std::array<float,2>{0.994771183f, 0.11009936f},
-std::array<float,2>{0.184366018f, 0.334508061f},
-std::array<float,2>{0.723731279f, 0.618126094f},
-std::array<float,2>{0.0386960991f, 0.64148283f},
-std::array<float,2>{0.54168117f, 0.484288305f},
-std::array<float,2>{0.442649186f, 0.237300247f},
-std::array<float,2>{0.85072732f, 0.913633227f},
-std::array<float,2>{0.370197177f, 0.598121464f},
-std::array<float,2>{0.967790961f, 0.32447204f},
-std::array<float,2>{0.14128989f, 0.0944215581f},
-std::array<float,2>{0.695493877f, 0.821150839f},
-std::array<float,2>{0.0229191296f, 0.937131941f},
-std::array<float,2>{0.528602421f, 0.218865216f},
-std::array<float,2>{0.476591915f, 0.486400068f},
-std::array<float,2>{0.830394387f, 0.634992957f},
-std::array<float,2>{0.425197363f, 0.786917448f},
-std::array<float,2>{0.770496726f, 0.0124320891f},
-std::array<float,2>{0.0649450943f, 0.250617772f},
-std::array<float,2>{0.585612357f, 0.505910397f},
-std::array<float,2>{0.206892923f, 0.727284491f},
-std::array<float,2>{0.665011406f, 0.425439f},
-std::array<float,2>{0.281511575f, 0.148532704f},
-std::array<float,2>{0.87782228f, 0.969409525f},
-std::array<float,2>{0.454216421f, 0.662768066f},
-std::array<float,2>{0.874946892f, 0.466364056f},
-std::array<float,2>{0.0558311418f, 0.209500566f},
-std::array<float,2>{0.551648617f, 0.888144374f},
-std::array<float,2>{0.161488384f, 0.844556332f},
-std::array<float,2>{0.734794259f, 0.0833586082f},
-std::array<float,2>{0.343568772f, 0.345343649f},
-std::array<float,2>{0.979300737f, 0.568412542f},
-std::array<float,2>{0.267780483f, 0.938209057f},
-std::array<float,2>{0.936787248f, 0.182628363f},
-std::array<float,2>{0.235450849f, 0.389912456f},
-std::array<float,2>{0.642549396f, 0.693232536f},
-std::array<float,2>{0.122681603f, 0.535427988f},
-std::array<float,2>{0.600129068f, 0.289590001f},
-std::array<float,2>{0.393492728f, 0.0453315079f},
-std::array<float,2>{0.78319782f, 0.76150614f},
-std::array<float,2>{0.33452487f, 0.625798643f},
-std::array<float,2>{0.970343769f, 0.493477106f},
-std::array<float,2>{0.167954057f, 0.230575606f},
-std::array<float,2>{0.7489326f, 0.924119294f},
-std::array<float,2>{0.0511391126f, 0.816470087f},
-std::array<float,2>{0.558640063f, 0.105091088f},
-std::array<float,2>{0.468455106f, 0.317914546f},
-std::array<float,2>{0.863601208f, 0.602592409f},
-std::array<float,2>{0.401945531f, 0.97924757f},
-std::array<float,2>{0.792494476f, 0.14567475f},
-std::array<float,2>{0.113747932f, 0.434503168f},
-std::array<float,2>{0.606585741f, 0.721841335f},
-std::array<float,2>{0.246276155f, 0.511938214f},
-std::array<float,2>{0.650730491f, 0.265548259f},
-std::array<float,2>{0.275089532f, 0.00152960804f},
-std::array<float,2>{0.927719414f, 0.795245826f},
-std::array<float,2>{0.471479356f, 0.572446644f},
-std::array<float,2>{0.841799855f, 0.355667353f},
-std::array<float,2>{0.0293731149f, 0.093666926f},
-std::array<float,2>{0.518956304f, 0.857709467f},
-std::array<float,2>{0.154980496f, 0.876861095f},
-std::array<float,2>{0.693084359f, 0.213584989f},
-std::array<float,2>{0.36087808f, 0.458548814f},
-std::array<float,2>{0.954145312f, 0.667348385f},
-std::array<float,2>{0.29486388f, 0.755079508f},
-std::array<float,2>{0.887501657f, 0.0360777564f},
-std::array<float,2>{0.217590749f, 0.288938195f},
-std::array<float,2>{0.658994317f, 0.542501926f},
-std::array<float,2>{0.0750923306f, 0.699810505f},
-std::array<float,2>{0.588407815f, 0.376417309f},
-std::array<float,2>{0.433202475f, 0.176204845f},
-std::array<float,2>{0.776855469f, 0.949500442f},
-std::array<float,2>{0.252934456f, 0.558000505f},
-std::array<float,2>{0.906776667f, 0.299966931f},
-std::array<float,2>{0.228355348f, 0.0604394823f},
-std::array<float,2>{0.626027048f, 0.778283179f},
-std::array<float,2>{0.101094872f, 0.958472013f},
-std::array<float,2>{0.609563947f, 0.16875574f},
-std::array<float,2>{0.389467865f, 0.399172753f},
-std::array<float,2>{0.810150325f, 0.708701193f},
-std::array<float,2>{0.446978003f, 0.861343682f},
-std::array<float,2>{0.857123792f, 0.0751903504f},
-std::array<float,2>{0.0424994305f, 0.368254006f},
-std::array<float,2>{0.534167826f, 0.584686935f},
-std::array<float,2>{0.177616492f, 0.677835464f},
-std::array<float,2>{0.731464803f, 0.448832572f},
-std::array<float,2>{0.327176839f, 0.188381344f},
-std::array<float,2>{0.991364539f, 0.897613227f},
-std::array<float,2>{0.417257398f, 0.742312729f},
-std::array<float,2>{0.758124948f, 0.407793611f},
-std::array<float,2>{0.0882931054f, 0.127475083f},
-std::array<float,2>{0.56494993f, 0.991616786f},
-std::array<float,2>{0.194350198f, 0.799024105f},
-std::array<float,2>{0.674628496f, 0.0302219708f},
-std::array<float,2>{0.311709851f, 0.272640049f},
-std::array<float,2>{0.905144036f, 0.521386385f},
-std::array<float,2>{0.357873559f, 0.920860887f},
-std::array<float,2>{0.947701454f, 0.247754648f},
-std::array<float,2>{0.12526232f, 0.472012997f},
-std::array<float,2>{0.710686564f, 0.649012208f},
-std::array<float,2>{0.00273430627f, 0.611690044f},
-std::array<float,2>{0.507107019f, 0.339848846f},
-std::array<float,2>{0.485323966f, 0.12191923f},
-std::array<float,2>{0.826411128f, 0.838522732f},
-std::array<float,2>{0.348051369f, 0.72363919f},
-std::array<float,2>{0.940882623f, 0.433128387f},
-std::array<float,2>{0.140473187f, 0.144036621f},
-std::array<float,2>{0.718137026f, 0.980910599f},
-std::array<float,2>{0.0100788567f, 0.791803181f},
-std::array<float,2>{0.507979095f, 0.00766055379f},
-std::array<float,2>{0.498201638f, 0.260395169f},
-std::array<float,2>{0.820133567f, 0.510950506f},
-std::array<float,2>{0.409223646f, 0.929670036f},
-std::array<float,2>{0.756515384f, 0.227881655f},
-std::array<float,2>{0.0789280236f, 0.49991852f},
-std::array<float,2>{0.570337176f, 0.631316423f},
-std::array<float,2>{0.195383281f, 0.606806099f},
-std::array<float,2>{0.679832995f, 0.314942211f},
-std::array<float,2>{0.299725205f, 0.106156126f},
-std::array<float,2>{0.894765496f, 0.813173294f},
-std::array<float,2>{0.441094339f, 0.544684052f},
-std::array<float,2>{0.845382154f, 0.282541215f},
-std::array<float,2>{0.0318745747f, 0.03369762f},
-std::array<float,2>{0.545719206f, 0.753363371f},
-std::array<float,2>{0.182413295f, 0.947312713f},
-std::array<float,2>{0.721761763f, 0.174961179f},
-std::array<float,2>{0.313266128f, 0.37973246f},
-std::array<float,2>{0.997049212f, 0.696126878f},
-std::array<float,2>{0.258612096f, 0.853948712f},
-std::array<float,2>{0.921587884f, 0.0876467973f},
-std::array<float,2>{0.221949294f, 0.352487922f},
-std::array<float,2>{0.635493815f, 0.574983835f},
-std::array<float,2>{0.102128923f, 0.669285536f},
-std::array<float,2>{0.618744552f, 0.455575854f},
-std::array<float,2>{0.375588775f, 0.217085093f},
-std::array<float,2>{0.802805662f, 0.88143599f},
-std::array<float,2>{0.288262576f, 0.579517007f},
-std::array<float,2>{0.882362604f, 0.373611033f},
-std::array<float,2>{0.209402308f, 0.0713264421f},
-std::array<float,2>{0.670518577f, 0.866186678f},
-std::array<float,2>{0.0692485645f, 0.891221225f},
-std::array<float,2>{0.579814255f, 0.192986071f},
-std::array<float,2>{0.429195732f, 0.450749785f},
-std::array<float,2>{0.767364085f, 0.67205584f},
-std::array<float,2>{0.482312351f, 0.773945093f},
-std::array<float,2>{0.833955824f, 0.0551886894f},
-std::array<float,2>{0.0165039692f, 0.302127719f},
-std::array<float,2>{0.523537457f, 0.562230349f},
-std::array<float,2>{0.145245478f, 0.703746021f},
-std::array<float,2>{0.699569583f, 0.402510494f},
-std::array<float,2>{0.371793926f, 0.165198907f},
-std::array<float,2>{0.961603582f, 0.95530349f},
-std::array<float,2>{0.396286279f, 0.653026819f},
-std::array<float,2>{0.787446082f, 0.476346821f},
-std::array<float,2>{0.11809852f, 0.243497908f},
-std::array<float,2>{0.59552443f, 0.916216195f},
-std::array<float,2>{0.241662785f, 0.840539515f},
-std::array<float,2>{0.647386968f, 0.120347135f},
-std::array<float,2>{0.270949662f, 0.338962555f},
-std::array<float,2>{0.931274116f, 0.613822758f},
-std::array<float,2>{0.3371149f, 0.985444248f},
-std::array<float,2>{0.982724488f, 0.131790027f},
-std::array<float,2>{0.159566879f, 0.41062057f},
-std::array<float,2>{0.738650143f, 0.748131156f},
-std::array<float,2>{0.0610431172f, 0.516711652f},
-std::array<float,2>{0.548950851f, 0.268123358f},
-std::array<float,2>{0.460437864f, 0.0256127734f},
-std::array<float,2>{0.870154679f, 0.802375257f},
-std::array<float,2>{0.281031311f, 0.686319113f},
-std::array<float,2>{0.922246635f, 0.437621325f},
-std::array<float,2>{0.245969534f, 0.199761853f},
-std::array<float,2>{0.655865788f, 0.898660541f},
-std::array<float,2>{0.111435927f, 0.868821979f},
-std::array<float,2>{0.604875505f, 0.0638164207f},
-std::array<float,2>{0.404604763f, 0.361454338f},
-std::array<float,2>{0.793340981f, 0.588803053f},
-std::array<float,2>{0.46162644f, 0.962907016f},
-std::array<float,2>{0.859789431f, 0.160869181f},
-std::array<float,2>{0.0497160964f, 0.393528044f},
-std::array<float,2>{0.556189954f, 0.717062831f},
-std::array<float,2>{0.170936495f, 0.547477305f},
-std::array<float,2>{0.742524922f, 0.30534479f},
-std::array<float,2>{0.329399109f, 0.0487190858f},
-std::array<float,2>{0.975988269f, 0.771757185f},
-std::array<float,2>{0.436008424f, 0.623328924f},
-std::array<float,2>{0.780281126f, 0.330730557f},
-std::array<float,2>{0.0724743307f, 0.114179f},
-std::array<float,2>{0.591100931f, 0.833031058f},
-std::array<float,2>{0.212380707f, 0.909002721f},
-std::array<float,2>{0.6612643f, 0.239537343f},
-std::array<float,2>{0.292529285f, 0.47822237f},
-std::array<float,2>{0.885499537f, 0.647165418f},
-std::array<float,2>{0.365004897f, 0.807694495f},
-std::array<float,2>{0.95721817f, 0.0229849555f},
-std::array<float,2>{0.150797114f, 0.280387789f},
-std::array<float,2>{0.689575016f, 0.530909956f},
-std::array<float,2>{0.0236454289f, 0.735252559f},
-std::array<float,2>{0.522245347f, 0.417734593f},
-std::array<float,2>{0.475571156f, 0.139894783f},
-std::array<float,2>{0.839247525f, 0.99247402f},
-std::array<float,2>{0.32175535f, 0.502234042f},
-std::array<float,2>{0.985137463f, 0.255039185f},
-std::array<float,2>{0.17572698f, 0.00893983897f},
-std::array<float,2>{0.729448318f, 0.784067392f},
-std::array<float,2>{0.045694638f, 0.975252926f},
-std::array<float,2>{0.536754072f, 0.154176623f},
-std::array<float,2>{0.449916214f, 0.429261208f},
-std::array<float,2>{0.853000641f, 0.733982742f},
-std::array<float,2>{0.383941203f, 0.828009903f},
-std::array<float,2>{0.807361841f, 0.0996563509f},
-std::array<float,2>{0.0962213352f, 0.323149234f},
-std::array<float,2>{0.61418438f, 0.594899952f},
-std::array<float,2>{0.233841449f, 0.63753283f},
-std::array<float,2>{0.630245805f, 0.490304112f},
-std::array<float,2>{0.257584959f, 0.224667728f},
-std::array<float,2>{0.91067183f, 0.931260109f},
-std::array<float,2>{0.488805562f, 0.688751042f},
-std::array<float,2>{0.822618008f, 0.385654241f},
-std::array<float,2>{0.00396896293f, 0.184935674f},
-std::array<float,2>{0.501222193f, 0.945269227f},
-std::array<float,2>{0.132166266f, 0.7635746f},
-std::array<float,2>{0.705584645f, 0.0425147116f},
-std::array<float,2>{0.354263902f, 0.29619956f},
-std::array<float,2>{0.951795399f, 0.532842219f},
-std::array<float,2>{0.307555765f, 0.884410381f},
-std::array<float,2>{0.901674032f, 0.2040001f},
-std::array<float,2>{0.18874529f, 0.463837594f},
-std::array<float,2>{0.677385569f, 0.656894505f},
-std::array<float,2>{0.0915470868f, 0.566211283f},
-std::array<float,2>{0.567880452f, 0.3482095f},
-std::array<float,2>{0.420387238f, 0.0819896832f},
-std::array<float,2>{0.763044775f, 0.849027336f},
-std::array<float,2>{0.299332857f, 0.725394547f},
-std::array<float,2>{0.894820809f, 0.430017591f},
-std::array<float,2>{0.195796564f, 0.141970232f},
-std::array<float,2>{0.679980874f, 0.983242035f},
-std::array<float,2>{0.0787529051f, 0.790235221f},
-std::array<float,2>{0.570721328f, 0.00457706489f},
-std::array<float,2>{0.409451425f, 0.259291977f},
-std::array<float,2>{0.75674367f, 0.507893741f},
-std::array<float,2>{0.498514444f, 0.927530646f},
-std::array<float,2>{0.81991595f, 0.228901848f},
-std::array<float,2>{0.00985919777f, 0.497434795f},
-std::array<float,2>{0.508110881f, 0.630602539f},
-std::array<float,2>{0.140244365f, 0.608467281f},
-std::array<float,2>{0.718013167f, 0.31264165f},
-std::array<float,2>{0.347813249f, 0.10872627f},
-std::array<float,2>{0.940454185f, 0.816172481f},
-std::array<float,2>{0.375945866f, 0.545271099f},
-std::array<float,2>{0.802993238f, 0.283477336f},
-std::array<float,2>{0.102532744f, 0.0330603831f},
-std::array<float,2>{0.61893034f, 0.750309825f},
-std::array<float,2>{0.22176002f, 0.945698798f},
-std::array<float,2>{0.63570863f, 0.172659576f},
-std::array<float,2>{0.258342236f, 0.381807655f},
-std::array<float,2>{0.92173636f, 0.697575808f},
-std::array<float,2>{0.313229471f, 0.852995098f},
-std::array<float,2>{0.996609569f, 0.0884478688f},
-std::array<float,2>{0.182147086f, 0.355161369f},
-std::array<float,2>{0.722093463f, 0.577560008f},
-std::array<float,2>{0.0320054367f, 0.670965791f},
-std::array<float,2>{0.545471132f, 0.454603434f},
-std::array<float,2>{0.441230774f, 0.216111258f},
-std::array<float,2>{0.845588446f, 0.880697608f},
-std::array<float,2>{0.371888161f, 0.580933392f},
-std::array<float,2>{0.961913943f, 0.371584445f},
-std::array<float,2>{0.145370543f, 0.0740678981f},
-std::array<float,2>{0.699426055f, 0.863704681f},
-std::array<float,2>{0.0161566008f, 0.893032312f},
-std::array<float,2>{0.523703456f, 0.194912016f},
-std::array<float,2>{0.482038885f, 0.452407122f},
-std::array<float,2>{0.833672464f, 0.674177587f},
-std::array<float,2>{0.428784549f, 0.777083397f},
-std::array<float,2>{0.767091811f, 0.0573167168f},
-std::array<float,2>{0.069053337f, 0.304127723f},
-std::array<float,2>{0.579981506f, 0.558905303f},
-std::array<float,2>{0.209206626f, 0.706490815f},
-std::array<float,2>{0.670857608f, 0.405120939f},
-std::array<float,2>{0.28851521f, 0.166836187f},
-std::array<float,2>{0.88276124f, 0.953430235f},
-std::array<float,2>{0.460012883f, 0.65455538f},
-std::array<float,2>{0.870485306f, 0.474605441f},
-std::array<float,2>{0.0614707768f, 0.245740727f},
-std::array<float,2>{0.549144626f, 0.915313482f},
-std::array<float,2>{0.159396335f, 0.842052937f},
-std::array<float,2>{0.738463998f, 0.118248112f},
-std::array<float,2>{0.337399364f, 0.337016821f},
-std::array<float,2>{0.982487321f, 0.615741849f},
-std::array<float,2>{0.270714849f, 0.988123655f},
-std::array<float,2>{0.93142873f, 0.129367024f},
-std::array<float,2>{0.241428256f, 0.413619131f},
-std::array<float,2>{0.64702934f, 0.747543156f},
-std::array<float,2>{0.117849618f, 0.51763159f},
-std::array<float,2>{0.595430791f, 0.266761184f},
-std::array<float,2>{0.39622429f, 0.0250741262f},
-std::array<float,2>{0.787320852f, 0.803385615f},
-std::array<float,2>{0.329142928f, 0.684055865f},
-std::array<float,2>{0.975630403f, 0.439939082f},
-std::array<float,2>{0.171306387f, 0.20293662f},
-std::array<float,2>{0.742215455f, 0.902195454f},
-std::array<float,2>{0.04935617f, 0.871072888f},
-std::array<float,2>{0.556534529f, 0.0653272644f},
-std::array<float,2>{0.461743951f, 0.359769642f},
-std::array<float,2>{0.859606624f, 0.587623894f},
-std::array<float,2>{0.404337585f, 0.960976958f},
-std::array<float,2>{0.79304862f, 0.163428262f},
-std::array<float,2>{0.111812033f, 0.391747147f},
-std::array<float,2>{0.604604721f, 0.716160476f},
-std::array<float,2>{0.245733723f, 0.550167799f},
-std::array<float,2>{0.656125963f, 0.307161987f},
-std::array<float,2>{0.280770868f, 0.0498764664f},
-std::array<float,2>{0.922111452f, 0.770987451f},
-std::array<float,2>{0.475214928f, 0.621580124f},
-std::array<float,2>{0.83891511f, 0.32992062f},
-std::array<float,2>{0.0238484833f, 0.115502872f},
-std::array<float,2>{0.522008717f, 0.834115028f},
-std::array<float,2>{0.150552526f, 0.906686187f},
-std::array<float,2>{0.689843416f, 0.241700768f},
-std::array<float,2>{0.364818215f, 0.478841305f},
-std::array<float,2>{0.957328618f, 0.645553052f},
-std::array<float,2>{0.292898804f, 0.806323111f},
-std::array<float,2>{0.885343015f, 0.0195385832f},
-std::array<float,2>{0.212053016f, 0.27876392f},
-std::array<float,2>{0.661406934f, 0.528649449f},
-std::array<float,2>{0.0726808682f, 0.737514377f},
-std::array<float,2>{0.590919554f, 0.414570928f},
-std::array<float,2>{0.435629994f, 0.138262197f},
-std::array<float,2>{0.780680001f, 0.995400608f},
-std::array<float,2>{0.257363737f, 0.500244856f},
-std::array<float,2>{0.911035359f, 0.25704062f},
-std::array<float,2>{0.233477592f, 0.0100651998f},
-std::array<float,2>{0.630073726f, 0.781629562f},
-std::array<float,2>{0.0964400694f, 0.973383784f},
-std::array<float,2>{0.613778949f, 0.155195788f},
-std::array<float,2>{0.384155184f, 0.426674277f},
-std::array<float,2>{0.807534218f, 0.731095135f},
-std::array<float,2>{0.450008005f, 0.825761318f},
-std::array<float,2>{0.852766991f, 0.0984937549f},
-std::array<float,2>{0.0454573818f, 0.322234273f},
-std::array<float,2>{0.536999524f, 0.597460389f},
-std::array<float,2>{0.175524518f, 0.639483631f},
-std::array<float,2>{0.729130387f, 0.489971697f},
-std::array<float,2>{0.321355522f, 0.223276377f},
-std::array<float,2>{0.984875023f, 0.93300277f},
-std::array<float,2>{0.420085073f, 0.690243363f},
-std::array<float,2>{0.762703955f, 0.384258181f},
-std::array<float,2>{0.0916326568f, 0.187237099f},
-std::array<float,2>{0.568291724f, 0.941816747f},
-std::array<float,2>{0.188707694f, 0.7642169f},
-std::array<float,2>{0.677520812f, 0.0406677872f},
-std::array<float,2>{0.307372957f, 0.293629289f},
-std::array<float,2>{0.901554585f, 0.534331441f},
-std::array<float,2>{0.354070991f, 0.885068953f},
-std::array<float,2>{0.952076614f, 0.206264958f},
-std::array<float,2>{0.131974012f, 0.46143648f},
-std::array<float,2>{0.705849588f, 0.659597754f},
-std::array<float,2>{0.00416484009f, 0.562701166f},
-std::array<float,2>{0.501029372f, 0.3499116f},
-std::array<float,2>{0.489139199f, 0.0800220296f},
-std::array<float,2>{0.822289586f, 0.850225627f},
-std::array<float,2>{0.343883038f, 0.714447677f},
-std::array<float,2>{0.943653226f, 0.394791991f},
-std::array<float,2>{0.133943692f, 0.159741774f},
-std::array<float,2>{0.713268995f, 0.967833698f},
-std::array<float,2>{0.0139421076f, 0.767557025f},
-std::array<float,2>{0.513671637f, 0.05312372f},
-std::array<float,2>{0.495551288f, 0.312000573f},
-std::array<float,2>{0.813622832f, 0.553432643f},
-std::array<float,2>{0.413225949f, 0.903543711f},
-std::array<float,2>{0.753615141f, 0.196760565f},
-std::array<float,2>{0.0825509652f, 0.442295462f},
-std::array<float,2>{0.574510098f, 0.681446493f},
-std::array<float,2>{0.203081742f, 0.591464162f},
-std::array<float,2>{0.683942139f, 0.366531879f},
-std::array<float,2>{0.303887039f, 0.0683964863f},
-std::array<float,2>{0.891354978f, 0.871267974f},
-std::array<float,2>{0.442596138f, 0.525640011f},
-std::array<float,2>{0.850847304f, 0.276241034f},
-std::array<float,2>{0.0389744192f, 0.0178044699f},
-std::array<float,2>{0.541833103f, 0.809551895f},
-std::array<float,2>{0.184213996f, 0.99759841f},
-std::array<float,2>{0.724025846f, 0.136311829f},
-std::array<float,2>{0.317806721f, 0.420491219f},
-std::array<float,2>{0.995002806f, 0.740414798f},
-std::array<float,2>{0.264744699f, 0.829621673f},
-std::array<float,2>{0.916694999f, 0.113250941f},
-std::array<float,2>{0.22267288f, 0.332696646f},
-std::array<float,2>{0.638446748f, 0.620754242f},
-std::array<float,2>{0.107171148f, 0.642874062f},
-std::array<float,2>{0.623666763f, 0.482109457f},
-std::array<float,2>{0.381286919f, 0.234835237f},
-std::array<float,2>{0.799485266f, 0.911007702f},
-std::array<float,2>{0.281288683f, 0.599923253f},
-std::array<float,2>{0.877468526f, 0.327086508f},
-std::array<float,2>{0.206643432f, 0.0973418802f},
-std::array<float,2>{0.664564729f, 0.822718501f},
-std::array<float,2>{0.0652523935f, 0.935425162f},
-std::array<float,2>{0.585889578f, 0.22263597f},
-std::array<float,2>{0.42494306f, 0.485767961f},
-std::array<float,2>{0.770111144f, 0.633926213f},
-std::array<float,2>{0.477027535f, 0.787974298f},
-std::array<float,2>{0.830252171f, 0.0139526101f},
-std::array<float,2>{0.0226167347f, 0.251987547f},
-std::array<float,2>{0.528438389f, 0.505435348f},
-std::array<float,2>{0.141504794f, 0.729692638f},
-std::array<float,2>{0.695725739f, 0.422070473f},
-std::array<float,2>{0.370419681f, 0.151661873f},
-std::array<float,2>{0.968164861f, 0.971704483f},
-std::array<float,2>{0.393150687f, 0.660660625f},
-std::array<float,2>{0.782956123f, 0.468445271f},
-std::array<float,2>{0.1229304f, 0.207596049f},
-std::array<float,2>{0.600429595f, 0.888680935f},
-std::array<float,2>{0.235766128f, 0.846604347f},
-std::array<float,2>{0.642181396f, 0.0854789615f},
-std::array<float,2>{0.268041372f, 0.347186834f},
-std::array<float,2>{0.936727822f, 0.567723334f},
-std::array<float,2>{0.343266815f, 0.941097319f},
-std::array<float,2>{0.979116321f, 0.180771604f},
-std::array<float,2>{0.161166936f, 0.386928529f},
-std::array<float,2>{0.734518766f, 0.693553507f},
-std::array<float,2>{0.0559931658f, 0.538674772f},
-std::array<float,2>{0.551341534f, 0.292940944f},
-std::array<float,2>{0.454498798f, 0.0430402793f},
-std::array<float,2>{0.874636292f, 0.758700848f},
-std::array<float,2>{0.275167435f, 0.627285719f},
-std::array<float,2>{0.927442312f, 0.495367944f},
-std::array<float,2>{0.246401161f, 0.234000593f},
-std::array<float,2>{0.650433302f, 0.923435926f},
-std::array<float,2>{0.113413423f, 0.820211649f},
-std::array<float,2>{0.606889307f, 0.102743588f},
-std::array<float,2>{0.402193964f, 0.319332242f},
-std::array<float,2>{0.792869091f, 0.605193853f},
-std::array<float,2>{0.468687207f, 0.977898359f},
-std::array<float,2>{0.86344707f, 0.148057863f},
-std::array<float,2>{0.0508374013f, 0.435932875f},
-std::array<float,2>{0.558984995f, 0.719456971f},
-std::array<float,2>{0.16749227f, 0.514389277f},
-std::array<float,2>{0.748767555f, 0.261760354f},
-std::array<float,2>{0.334917873f, 0.00243983883f},
-std::array<float,2>{0.970580697f, 0.793506324f},
-std::array<float,2>{0.433370054f, 0.570759714f},
-std::array<float,2>{0.777259529f, 0.358397424f},
-std::array<float,2>{0.0749501511f, 0.0915115029f},
-std::array<float,2>{0.588748753f, 0.856368482f},
-std::array<float,2>{0.217299774f, 0.877642453f},
-std::array<float,2>{0.658747733f, 0.211146221f},
-std::array<float,2>{0.294515759f, 0.459135562f},
-std::array<float,2>{0.887358546f, 0.665453255f},
-std::array<float,2>{0.36120224f, 0.757067323f},
-std::array<float,2>{0.954565525f, 0.0384121835f},
-std::array<float,2>{0.15525344f, 0.285418451f},
-std::array<float,2>{0.693289161f, 0.540388405f},
-std::array<float,2>{0.0296560358f, 0.702497721f},
-std::array<float,2>{0.518729866f, 0.37882033f},
-std::array<float,2>{0.471221089f, 0.178810224f},
-std::array<float,2>{0.842092752f, 0.952196598f},
-std::array<float,2>{0.327499747f, 0.55570668f},
-std::array<float,2>{0.99161762f, 0.297548473f},
-std::array<float,2>{0.1773974f, 0.0605755337f},
-std::array<float,2>{0.731863558f, 0.779610634f},
-std::array<float,2>{0.0428045504f, 0.959160507f},
-std::array<float,2>{0.53378588f, 0.171227083f},
-std::array<float,2>{0.447118521f, 0.400817513f},
-std::array<float,2>{0.857186735f, 0.710845232f},
-std::array<float,2>{0.38923502f, 0.85974884f},
-std::array<float,2>{0.810536265f, 0.077441752f},
-std::array<float,2>{0.101379335f, 0.370282292f},
-std::array<float,2>{0.609723687f, 0.583165348f},
-std::array<float,2>{0.228148878f, 0.676949203f},
-std::array<float,2>{0.62640965f, 0.44633612f},
-std::array<float,2>{0.253417939f, 0.190284535f},
-std::array<float,2>{0.90700376f, 0.895163238f},
-std::array<float,2>{0.484893024f, 0.745083928f},
-std::array<float,2>{0.8266114f, 0.408699781f},
-std::array<float,2>{0.00268259575f, 0.125145763f},
-std::array<float,2>{0.506990731f, 0.989808857f},
-std::array<float,2>{0.125171795f, 0.797742724f},
-std::array<float,2>{0.710773528f, 0.0280843712f},
-std::array<float,2>{0.357476592f, 0.271428794f},
-std::array<float,2>{0.947431386f, 0.522692025f},
-std::array<float,2>{0.31177178f, 0.918188512f},
-std::array<float,2>{0.904952765f, 0.249648228f},
-std::array<float,2>{0.194684505f, 0.469996452f},
-std::array<float,2>{0.674471974f, 0.65196985f},
-std::array<float,2>{0.0879641548f, 0.610408306f},
-std::array<float,2>{0.565345705f, 0.342245609f},
-std::array<float,2>{0.417099148f, 0.124149367f},
-std::array<float,2>{0.758029759f, 0.837762594f},
-std::array<float,2>{0.261528105f, 0.696921527f},
-std::array<float,2>{0.918078899f, 0.380827606f},
-std::array<float,2>{0.220657468f, 0.174284324f},
-std::array<float,2>{0.633487642f, 0.948302507f},
-std::array<float,2>{0.103526838f, 0.752825856f},
-std::array<float,2>{0.620990217f, 0.0342012011f},
-std::array<float,2>{0.378443033f, 0.281659752f},
-std::array<float,2>{0.802186608f, 0.543917775f},
-std::array<float,2>{0.43910259f, 0.881906152f},
-std::array<float,2>{0.847095728f, 0.217948571f},
-std::array<float,2>{0.0345062837f, 0.456543833f},
-std::array<float,2>{0.544916451f, 0.668860257f},
-std::array<float,2>{0.180720538f, 0.575774789f},
-std::array<float,2>{0.718955636f, 0.352716029f},
-std::array<float,2>{0.315850228f, 0.086430721f},
-std::array<float,2>{0.999523222f, 0.855128825f},
-std::array<float,2>{0.408195466f, 0.509917676f},
-std::array<float,2>{0.755745053f, 0.261190027f},
-std::array<float,2>{0.0810637027f, 0.00626528775f},
-std::array<float,2>{0.572569311f, 0.79234767f},
-std::array<float,2>{0.198262319f, 0.981785059f},
-std::array<float,2>{0.682990789f, 0.143036351f},
-std::array<float,2>{0.297446787f, 0.431943089f},
-std::array<float,2>{0.896843731f, 0.722767532f},
-std::array<float,2>{0.350177765f, 0.814037859f},
-std::array<float,2>{0.938871801f, 0.106998138f},
-std::array<float,2>{0.137442246f, 0.315636277f},
-std::array<float,2>{0.715554416f, 0.605789721f},
-std::array<float,2>{0.00848635752f, 0.632806063f},
-std::array<float,2>{0.511319101f, 0.498906523f},
-std::array<float,2>{0.496415436f, 0.226774633f},
-std::array<float,2>{0.816780329f, 0.927850068f},
-std::array<float,2>{0.33883518f, 0.614539325f},
-std::array<float,2>{0.981068969f, 0.337956965f},
-std::array<float,2>{0.15745227f, 0.119161919f},
-std::array<float,2>{0.740435898f, 0.841280341f},
-std::array<float,2>{0.059057463f, 0.917878866f},
-std::array<float,2>{0.548463106f, 0.242752627f},
-std::array<float,2>{0.458258569f, 0.475153893f},
-std::array<float,2>{0.867720604f, 0.653749108f},
-std::array<float,2>{0.397388369f, 0.801490784f},
-std::array<float,2>{0.786309302f, 0.0263681561f},
-std::array<float,2>{0.119305432f, 0.269142985f},
-std::array<float,2>{0.59571296f, 0.516128421f},
-std::array<float,2>{0.240149513f, 0.74937135f},
-std::array<float,2>{0.64470911f, 0.411145151f},
-std::array<float,2>{0.272410363f, 0.132425636f},
-std::array<float,2>{0.932926953f, 0.985245824f},
-std::array<float,2>{0.48263976f, 0.673384368f},
-std::array<float,2>{0.835742474f, 0.449926823f},
-std::array<float,2>{0.0179403573f, 0.19214958f},
-std::array<float,2>{0.527202904f, 0.892536402f},
-std::array<float,2>{0.147273287f, 0.866420686f},
-std::array<float,2>{0.70256722f, 0.0712475255f},
-std::array<float,2>{0.374953121f, 0.374166131f},
-std::array<float,2>{0.963632882f, 0.578671634f},
-std::array<float,2>{0.286937684f, 0.956373572f},
-std::array<float,2>{0.880115807f, 0.164433956f},
-std::array<float,2>{0.207931682f, 0.403973997f},
-std::array<float,2>{0.668636084f, 0.704893053f},
-std::array<float,2>{0.0671075955f, 0.560907543f},
-std::array<float,2>{0.581964135f, 0.301225692f},
-std::array<float,2>{0.426071793f, 0.0558984987f},
-std::array<float,2>{0.769501805f, 0.774422407f},
-std::array<float,2>{0.366091698f, 0.647766173f},
-std::array<float,2>{0.960227787f, 0.477322251f},
-std::array<float,2>{0.149703279f, 0.239115387f},
-std::array<float,2>{0.687896848f, 0.90954411f},
-std::array<float,2>{0.0254636835f, 0.832411349f},
-std::array<float,2>{0.519628406f, 0.115085647f},
-std::array<float,2>{0.47432825f, 0.331580013f},
-std::array<float,2>{0.837710798f, 0.624956846f},
-std::array<float,2>{0.434444368f, 0.993879557f},
-std::array<float,2>{0.77785182f, 0.139599487f},
-std::array<float,2>{0.0704694614f, 0.416828424f},
-std::array<float,2>{0.592648029f, 0.735472023f},
-std::array<float,2>{0.213165462f, 0.529841423f},
-std::array<float,2>{0.66368854f, 0.279651046f},
-std::array<float,2>{0.290902346f, 0.0224402118f},
-std::array<float,2>{0.884425819f, 0.807366788f},
-std::array<float,2>{0.464334011f, 0.589333951f},
-std::array<float,2>{0.862615168f, 0.362921834f},
-std::array<float,2>{0.0470220298f, 0.0627046153f},
-std::array<float,2>{0.557760537f, 0.867399514f},
-std::array<float,2>{0.169705883f, 0.899904549f},
-std::array<float,2>{0.745966971f, 0.201134384f},
-std::array<float,2>{0.331212431f, 0.438626885f},
-std::array<float,2>{0.97269541f, 0.686751664f},
-std::array<float,2>{0.277448475f, 0.773416519f},
-std::array<float,2>{0.924037576f, 0.0473208316f},
-std::array<float,2>{0.242543682f, 0.306032926f},
-std::array<float,2>{0.654287755f, 0.547976196f},
-std::array<float,2>{0.111300051f, 0.717884898f},
-std::array<float,2>{0.602219522f, 0.393893808f},
-std::array<float,2>{0.402775586f, 0.161532104f},
-std::array<float,2>{0.795592248f, 0.963902891f},
-std::array<float,2>{0.305546969f, 0.531323791f},
-std::array<float,2>{0.899518847f, 0.294979513f},
-std::array<float,2>{0.190737247f, 0.0410830192f},
-std::array<float,2>{0.679167628f, 0.762296796f},
-std::array<float,2>{0.0922607854f, 0.943817139f},
-std::array<float,2>{0.568758607f, 0.184302092f},
-std::array<float,2>{0.418043613f, 0.386393607f},
-std::array<float,2>{0.764917076f, 0.687927544f},
-std::array<float,2>{0.490257382f, 0.84779042f},
-std::array<float,2>{0.820815742f, 0.0802584961f},
-std::array<float,2>{0.00779326539f, 0.349200368f},
-std::array<float,2>{0.503670514f, 0.564492047f},
-std::array<float,2>{0.130173132f, 0.658191323f},
-std::array<float,2>{0.705012262f, 0.464585751f},
-std::array<float,2>{0.352708042f, 0.204128429f},
-std::array<float,2>{0.949539244f, 0.883387506f},
-std::array<float,2>{0.386324584f, 0.732465029f},
-std::array<float,2>{0.805876493f, 0.427938908f},
-std::array<float,2>{0.0937819183f, 0.152698502f},
-std::array<float,2>{0.616196692f, 0.976047337f},
-std::array<float,2>{0.23218219f, 0.784186602f},
-std::array<float,2>{0.631278336f, 0.00863815006f},
-std::array<float,2>{0.255018175f, 0.254204363f},
-std::array<float,2>{0.913053215f, 0.503016114f},
-std::array<float,2>{0.323854744f, 0.93013835f},
-std::array<float,2>{0.987870574f, 0.225883856f},
-std::array<float,2>{0.17254065f, 0.492117971f},
-std::array<float,2>{0.727097571f, 0.638610542f},
-std::array<float,2>{0.0440094322f, 0.593943536f},
-std::array<float,2>{0.538866162f, 0.324191958f},
-std::array<float,2>{0.452635825f, 0.101429254f},
-std::array<float,2>{0.855016947f, 0.827089369f},
-std::array<float,2>{0.319108218f, 0.738842309f},
-std::array<float,2>{0.993097067f, 0.418691158f},
-std::array<float,2>{0.186255842f, 0.134428278f},
-std::array<float,2>{0.724641502f, 0.998964429f},
-std::array<float,2>{0.0354192071f, 0.811382174f},
-std::array<float,2>{0.540053427f, 0.0158341452f},
-std::array<float,2>{0.443799645f, 0.273535222f},
-std::array<float,2>{0.849383771f, 0.524111509f},
-std::array<float,2>{0.378986657f, 0.912931859f},
-std::array<float,2>{0.79779321f, 0.238106132f},
-std::array<float,2>{0.109232865f, 0.483089864f},
-std::array<float,2>{0.621299505f, 0.642546296f},
-std::array<float,2>{0.225250557f, 0.618974686f},
-std::array<float,2>{0.639822602f, 0.335268676f},
-std::array<float,2>{0.263635635f, 0.11068967f},
-std::array<float,2>{0.914892733f, 0.830896199f},
-std::array<float,2>{0.493362367f, 0.5517869f},
-std::array<float,2>{0.815349817f, 0.309110582f},
-std::array<float,2>{0.013036917f, 0.0512758456f},
-std::array<float,2>{0.514301062f, 0.768827856f},
-std::array<float,2>{0.135305598f, 0.966387451f},
-std::array<float,2>{0.712640345f, 0.156275794f},
-std::array<float,2>{0.346076041f, 0.398131937f},
-std::array<float,2>{0.941426575f, 0.711512029f},
-std::array<float,2>{0.302381068f, 0.873116791f},
-std::array<float,2>{0.893387437f, 0.0679501444f},
-std::array<float,2>{0.201151833f, 0.363786191f},
-std::array<float,2>{0.685569108f, 0.592901587f},
-std::array<float,2>{0.0846975446f, 0.683591247f},
-std::array<float,2>{0.57652837f, 0.444154084f},
-std::array<float,2>{0.411770582f, 0.199086547f},
-std::array<float,2>{0.750117421f, 0.905731976f},
-std::array<float,2>{0.267240465f, 0.56980747f},
-std::array<float,2>{0.93551749f, 0.344633698f},
-std::array<float,2>{0.237444311f, 0.0826777443f},
-std::array<float,2>{0.644349992f, 0.844860613f},
-std::array<float,2>{0.123360321f, 0.887265086f},
-std::array<float,2>{0.599478543f, 0.210474819f},
-std::array<float,2>{0.392082661f, 0.465544105f},
-std::array<float,2>{0.78457588f, 0.663668036f},
-std::array<float,2>{0.456062853f, 0.760519743f},
-std::array<float,2>{0.871326983f, 0.046027258f},
-std::array<float,2>{0.0582557768f, 0.290214896f},
-std::array<float,2>{0.554064929f, 0.536144555f},
-std::array<float,2>{0.163481995f, 0.691737592f},
-std::array<float,2>{0.738233745f, 0.389429927f},
-std::array<float,2>{0.340274662f, 0.181656376f},
-std::array<float,2>{0.97709167f, 0.938898444f},
-std::array<float,2>{0.422312796f, 0.636400521f},
-std::array<float,2>{0.771700144f, 0.488172024f},
-std::array<float,2>{0.0637476593f, 0.219960898f},
-std::array<float,2>{0.582381129f, 0.936369419f},
-std::array<float,2>{0.203511208f, 0.821349442f},
-std::array<float,2>{0.666578948f, 0.0952082276f},
-std::array<float,2>{0.284087658f, 0.325744927f},
-std::array<float,2>{0.876120448f, 0.599212766f},
-std::array<float,2>{0.368360847f, 0.96996218f},
-std::array<float,2>{0.966466665f, 0.149840802f},
-std::array<float,2>{0.143019035f, 0.424188495f},
-std::array<float,2>{0.698062778f, 0.728223741f},
-std::array<float,2>{0.0197083578f, 0.507545352f},
-std::array<float,2>{0.530030727f, 0.251617938f},
-std::array<float,2>{0.47869277f, 0.0127210673f},
-std::array<float,2>{0.829921544f, 0.785873234f},
-std::array<float,2>{0.295411557f, 0.666728258f},
-std::array<float,2>{0.889851451f, 0.457965761f},
-std::array<float,2>{0.215861335f, 0.21408391f},
-std::array<float,2>{0.656862736f, 0.875175059f},
-std::array<float,2>{0.0777261257f, 0.859025955f},
-std::array<float,2>{0.586311698f, 0.0925774276f},
-std::array<float,2>{0.42993471f, 0.3566342f},
-std::array<float,2>{0.774333894f, 0.574159086f},
-std::array<float,2>{0.470630378f, 0.950799525f},
-std::array<float,2>{0.841247857f, 0.177655503f},
-std::array<float,2>{0.0285232365f, 0.375811547f},
-std::array<float,2>{0.517282128f, 0.700330913f},
-std::array<float,2>{0.153203502f, 0.541639924f},
-std::array<float,2>{0.695128739f, 0.287737519f},
-std::array<float,2>{0.362788409f, 0.036362242f},
-std::array<float,2>{0.956799865f, 0.754667521f},
-std::array<float,2>{0.39851591f, 0.602156878f},
-std::array<float,2>{0.790667295f, 0.316885144f},
-std::array<float,2>{0.115787074f, 0.104355566f},
-std::array<float,2>{0.60798645f, 0.817982852f},
-std::array<float,2>{0.24875696f, 0.92531383f},
-std::array<float,2>{0.648506761f, 0.231780753f},
-std::array<float,2>{0.275776505f, 0.492715567f},
-std::array<float,2>{0.928133488f, 0.626627445f},
-std::array<float,2>{0.332806259f, 0.796413898f},
-std::array<float,2>{0.971814215f, 0.000514264975f},
-std::array<float,2>{0.164071932f, 0.264018953f},
-std::array<float,2>{0.74722147f, 0.512769997f},
-std::array<float,2>{0.0531050302f, 0.720770299f},
-std::array<float,2>{0.561269403f, 0.434814721f},
-std::array<float,2>{0.465312809f, 0.144586816f},
-std::array<float,2>{0.866317153f, 0.980310142f},
-std::array<float,2>{0.356131345f, 0.519806504f},
-std::array<float,2>{0.947113693f, 0.272452414f},
-std::array<float,2>{0.128889352f, 0.0309192631f},
-std::array<float,2>{0.708339989f, 0.800060153f},
-std::array<float,2>{0.00187732978f, 0.990389228f},
-std::array<float,2>{0.505308807f, 0.128806278f},
-std::array<float,2>{0.486611903f, 0.406624466f},
-std::array<float,2>{0.824848115f, 0.744086087f},
-std::array<float,2>{0.414473325f, 0.839637399f},
-std::array<float,2>{0.760681212f, 0.122298583f},
-std::array<float,2>{0.0876009017f, 0.340893f},
-std::array<float,2>{0.563292384f, 0.612820148f},
-std::array<float,2>{0.191428512f, 0.650110304f},
-std::array<float,2>{0.67221278f, 0.471480101f},
-std::array<float,2>{0.309757888f, 0.246506244f},
-std::array<float,2>{0.903796732f, 0.92179215f},
-std::array<float,2>{0.449200094f, 0.707105875f},
-std::array<float,2>{0.858414531f, 0.399484664f},
-std::array<float,2>{0.0397954136f, 0.169887587f},
-std::array<float,2>{0.532713711f, 0.957981586f},
-std::array<float,2>{0.178589091f, 0.779191613f},
-std::array<float,2>{0.733906984f, 0.0589229614f},
-std::array<float,2>{0.325211018f, 0.298858285f},
-std::array<float,2>{0.989267826f, 0.557132304f},
-std::array<float,2>{0.250743836f, 0.897076666f},
-std::array<float,2>{0.909836531f, 0.189360127f},
-std::array<float,2>{0.230453759f, 0.448221117f},
-std::array<float,2>{0.627431095f, 0.679539502f},
-std::array<float,2>{0.0987199545f, 0.585652173f},
-std::array<float,2>{0.613118827f, 0.368158877f},
-std::array<float,2>{0.386866361f, 0.0752534568f},
-std::array<float,2>{0.810792685f, 0.86308533f},
-std::array<float,2>{0.27290228f, 0.746122658f},
-std::array<float,2>{0.932365656f, 0.412272424f},
-std::array<float,2>{0.238597184f, 0.130292907f},
-std::array<float,2>{0.646015286f, 0.987112164f},
-std::array<float,2>{0.120204866f, 0.804251015f},
-std::array<float,2>{0.597403526f, 0.0236027688f},
-std::array<float,2>{0.397713304f, 0.266141057f},
-std::array<float,2>{0.785317659f, 0.518693984f},
-std::array<float,2>{0.457836926f, 0.91408813f},
-std::array<float,2>{0.868760169f, 0.244197503f},
-std::array<float,2>{0.0602815561f, 0.472958744f},
-std::array<float,2>{0.547510982f, 0.655979633f},
-std::array<float,2>{0.157214507f, 0.616396129f},
-std::array<float,2>{0.7418136f, 0.336130232f},
-std::array<float,2>{0.339775592f, 0.117231384f},
-std::array<float,2>{0.981646538f, 0.843428969f},
-std::array<float,2>{0.427489728f, 0.559878528f},
-std::array<float,2>{0.767954767f, 0.303402811f},
-std::array<float,2>{0.0680490211f, 0.0582722649f},
-std::array<float,2>{0.580227077f, 0.775408387f},
-std::array<float,2>{0.208557636f, 0.95487076f},
-std::array<float,2>{0.669109583f, 0.16791591f},
-std::array<float,2>{0.285412878f, 0.405499876f},
-std::array<float,2>{0.879398644f, 0.705146611f},
-std::array<float,2>{0.373645276f, 0.865102112f},
-std::array<float,2>{0.964153886f, 0.072430335f},
-std::array<float,2>{0.147974953f, 0.372859746f},
-std::array<float,2>{0.701597512f, 0.581512511f},
-std::array<float,2>{0.0190473758f, 0.675617635f},
-std::array<float,2>{0.526104987f, 0.45143348f},
-std::array<float,2>{0.483933657f, 0.194022387f},
-std::array<float,2>{0.834446251f, 0.894204617f},
-std::array<float,2>{0.315216273f, 0.576771975f},
-std::array<float,2>{0.998134971f, 0.354491502f},
-std::array<float,2>{0.180287063f, 0.0894498006f},
-std::array<float,2>{0.720015109f, 0.852068186f},
-std::array<float,2>{0.0337155685f, 0.87975651f},
-std::array<float,2>{0.543443441f, 0.214901999f},
-std::array<float,2>{0.438032568f, 0.453223616f},
-std::array<float,2>{0.846445382f, 0.670091271f},
-std::array<float,2>{0.377216995f, 0.751129746f},
-std::array<float,2>{0.801613092f, 0.0320647061f},
-std::array<float,2>{0.105299607f, 0.284320384f},
-std::array<float,2>{0.619518042f, 0.546553075f},
-std::array<float,2>{0.219693005f, 0.698356509f},
-std::array<float,2>{0.634560883f, 0.382652402f},
-std::array<float,2>{0.26069209f, 0.173086688f},
-std::array<float,2>{0.919167399f, 0.946897864f},
-std::array<float,2>{0.497258961f, 0.629001915f},
-std::array<float,2>{0.818209052f, 0.4965491f},
-std::array<float,2>{0.00914113689f, 0.229854792f},
-std::array<float,2>{0.509998083f, 0.926585495f},
-std::array<float,2>{0.138470232f, 0.814599276f},
-std::array<float,2>{0.716486394f, 0.10760463f},
-std::array<float,2>{0.351219356f, 0.313755512f},
-std::array<float,2>{0.937646627f, 0.607782423f},
-std::array<float,2>{0.298471868f, 0.983524024f},
-std::array<float,2>{0.897475481f, 0.141211063f},
-std::array<float,2>{0.198094234f, 0.430915564f},
-std::array<float,2>{0.682116985f, 0.725659668f},
-std::array<float,2>{0.0804075897f, 0.50938791f},
-std::array<float,2>{0.573752522f, 0.258529633f},
-std::array<float,2>{0.406788468f, 0.00557889836f},
-std::array<float,2>{0.754294574f, 0.789466321f},
-std::array<float,2>{0.352349281f, 0.659111738f},
-std::array<float,2>{0.950296402f, 0.462250501f},
-std::array<float,2>{0.129346311f, 0.205602288f},
-std::array<float,2>{0.703521848f, 0.886559069f},
-std::array<float,2>{0.00682598678f, 0.851494074f},
-std::array<float,2>{0.502175331f, 0.0786376595f},
-std::array<float,2>{0.492039859f, 0.351492912f},
-std::array<float,2>{0.821600556f, 0.564263463f},
-std::array<float,2>{0.41965577f, 0.942466497f},
-std::array<float,2>{0.76382643f, 0.186243564f},
-std::array<float,2>{0.0929289237f, 0.383359969f},
-std::array<float,2>{0.569957376f, 0.690949738f},
-std::array<float,2>{0.190186262f, 0.533658385f},
-std::array<float,2>{0.677798092f, 0.293978572f},
-std::array<float,2>{0.3063021f, 0.0398837477f},
-std::array<float,2>{0.898845255f, 0.765034437f},
-std::array<float,2>{0.45204705f, 0.596650243f},
-std::array<float,2>{0.854474485f, 0.321285844f},
-std::array<float,2>{0.043218825f, 0.0989505276f},
-std::array<float,2>{0.537579298f, 0.825088382f},
-std::array<float,2>{0.173226774f, 0.931660295f},
-std::array<float,2>{0.728205681f, 0.224556461f},
-std::array<float,2>{0.322658032f, 0.48885569f},
-std::array<float,2>{0.986412048f, 0.640160263f},
-std::array<float,2>{0.254596233f, 0.782762825f},
-std::array<float,2>{0.913936734f, 0.0112489704f},
-std::array<float,2>{0.231252506f, 0.256150097f},
-std::array<float,2>{0.632534623f, 0.501822293f},
-std::array<float,2>{0.0949164778f, 0.731815994f},
-std::array<float,2>{0.61656791f, 0.427042902f},
-std::array<float,2>{0.38509655f, 0.155983895f},
-std::array<float,2>{0.805399656f, 0.973990738f},
-std::array<float,2>{0.289201051f, 0.528109908f},
-std::array<float,2>{0.883694351f, 0.277958333f},
-std::array<float,2>{0.21388413f, 0.0208262652f},
-std::array<float,2>{0.662645936f, 0.805466175f},
-std::array<float,2>{0.071309194f, 0.994611859f},
-std::array<float,2>{0.593142629f, 0.13735795f},
-std::array<float,2>{0.435008168f, 0.416010678f},
-std::array<float,2>{0.779114604f, 0.736418903f},
-std::array<float,2>{0.473196059f, 0.835399151f},
-std::array<float,2>{0.835987806f, 0.116517536f},
-std::array<float,2>{0.0264963992f, 0.328734368f},
-std::array<float,2>{0.521097422f, 0.622954011f},
-std::array<float,2>{0.148896337f, 0.645119011f},
-std::array<float,2>{0.688628972f, 0.480425328f},
-std::array<float,2>{0.366822571f, 0.24094829f},
-std::array<float,2>{0.959431589f, 0.907898128f},
-std::array<float,2>{0.403665066f, 0.715563893f},
-std::array<float,2>{0.796809912f, 0.391022682f},
-std::array<float,2>{0.109425567f, 0.162635997f},
-std::array<float,2>{0.603040636f, 0.96199739f},
-std::array<float,2>{0.243221015f, 0.770141006f},
-std::array<float,2>{0.653207123f, 0.0493136384f},
-std::array<float,2>{0.278427213f, 0.308209717f},
-std::array<float,2>{0.925385714f, 0.54915297f},
-std::array<float,2>{0.330993146f, 0.901309907f},
-std::array<float,2>{0.974546373f, 0.201408863f},
-std::array<float,2>{0.168033257f, 0.441299647f},
-std::array<float,2>{0.744781017f, 0.685431063f},
-std::array<float,2>{0.0481860898f, 0.586776853f},
-std::array<float,2>{0.556877553f, 0.360941023f},
-std::array<float,2>{0.463789076f, 0.0659529939f},
-std::array<float,2>{0.86150986f, 0.869500697f},
-std::array<float,2>{0.340891838f, 0.695076644f},
-std::array<float,2>{0.978316307f, 0.387871176f},
-std::array<float,2>{0.162600398f, 0.179783255f},
-std::array<float,2>{0.737203419f, 0.940091848f},
-std::array<float,2>{0.0574014708f, 0.758884728f},
-std::array<float,2>{0.553139687f, 0.0439502634f},
-std::array<float,2>{0.45569098f, 0.291685879f},
-std::array<float,2>{0.872468293f, 0.537197769f},
-std::array<float,2>{0.390878677f, 0.889895141f},
-std::array<float,2>{0.783581674f, 0.208103299f},
-std::array<float,2>{0.124144383f, 0.467530042f},
-std::array<float,2>{0.598089159f, 0.661887109f},
-std::array<float,2>{0.237031087f, 0.567309022f},
-std::array<float,2>{0.642918646f, 0.346376389f},
-std::array<float,2>{0.265808195f, 0.0843069181f},
-std::array<float,2>{0.934279323f, 0.847001672f},
-std::array<float,2>{0.480173469f, 0.504350781f},
-std::array<float,2>{0.828469932f, 0.253047585f},
-std::array<float,2>{0.0205344725f, 0.015337971f},
-std::array<float,2>{0.530482411f, 0.789051712f},
-std::array<float,2>{0.144263998f, 0.970862567f},
-std::array<float,2>{0.698298514f, 0.150910705f},
-std::array<float,2>{0.368094921f, 0.423523784f},
-std::array<float,2>{0.965231478f, 0.729367614f},
-std::array<float,2>{0.284211129f, 0.824195623f},
-std::array<float,2>{0.875497162f, 0.0961755812f},
-std::array<float,2>{0.204339355f, 0.327240944f},
-std::array<float,2>{0.667149663f, 0.60118866f},
-std::array<float,2>{0.0629566386f, 0.633431971f},
-std::array<float,2>{0.58382982f, 0.485216022f},
-std::array<float,2>{0.423479199f, 0.22079806f},
-std::array<float,2>{0.772838593f, 0.934156656f},
-std::array<float,2>{0.262401015f, 0.619459212f},
-std::array<float,2>{0.915350735f, 0.333241075f},
-std::array<float,2>{0.22566539f, 0.112045392f},
-std::array<float,2>{0.638924062f, 0.828877151f},
-std::array<float,2>{0.107547887f, 0.911691666f},
-std::array<float,2>{0.623045743f, 0.236188293f},
-std::array<float,2>{0.380266756f, 0.481166214f},
-std::array<float,2>{0.798422992f, 0.643733323f},
-std::array<float,2>{0.444784015f, 0.810497284f},
-std::array<float,2>{0.847783208f, 0.0190073643f},
-std::array<float,2>{0.0361976512f, 0.276825696f},
-std::array<float,2>{0.539975703f, 0.526582956f},
-std::array<float,2>{0.187450424f, 0.74166429f},
-std::array<float,2>{0.726333559f, 0.421791226f},
-std::array<float,2>{0.320127696f, 0.135449678f},
-std::array<float,2>{0.994050562f, 0.996615291f},
-std::array<float,2>{0.410709232f, 0.68059516f},
-std::array<float,2>{0.751114607f, 0.443113595f},
-std::array<float,2>{0.0856180638f, 0.196121618f},
-std::array<float,2>{0.577363908f, 0.903295577f},
-std::array<float,2>{0.199690431f, 0.872570515f},
-std::array<float,2>{0.686881721f, 0.0702939555f},
-std::array<float,2>{0.301196784f, 0.365773618f},
-std::array<float,2>{0.893680155f, 0.590685368f},
-std::array<float,2>{0.347486109f, 0.967537224f},
-std::array<float,2>{0.942662358f, 0.158885136f},
-std::array<float,2>{0.136407644f, 0.396398783f},
-std::array<float,2>{0.711847603f, 0.712933719f},
-std::array<float,2>{0.012528982f, 0.554283381f},
-std::array<float,2>{0.514759183f, 0.31118533f},
-std::array<float,2>{0.492634624f, 0.0540865101f},
-std::array<float,2>{0.816054881f, 0.766427577f},
-std::array<float,2>{0.309217483f, 0.651039541f},
-std::array<float,2>{0.902471542f, 0.46936056f},
-std::array<float,2>{0.193208694f, 0.248200759f},
-std::array<float,2>{0.673597813f, 0.919008911f},
-std::array<float,2>{0.0862512663f, 0.836098552f},
-std::array<float,2>{0.563588083f, 0.123975888f},
-std::array<float,2>{0.415351927f, 0.343214899f},
-std::array<float,2>{0.761161864f, 0.610156f},
-std::array<float,2>{0.487448037f, 0.98884201f},
-std::array<float,2>{0.825380087f, 0.126920149f},
-std::array<float,2>{0.000179260402f, 0.409808457f},
-std::array<float,2>{0.504745841f, 0.745607376f},
-std::array<float,2>{0.127632469f, 0.521986663f},
-std::array<float,2>{0.7075544f, 0.269719541f},
-std::array<float,2>{0.356989324f, 0.0291911233f},
-std::array<float,2>{0.946270227f, 0.79874903f},
-std::array<float,2>{0.388603687f, 0.582758069f},
-std::array<float,2>{0.811561644f, 0.369205147f},
-std::array<float,2>{0.0981139988f, 0.0770486519f},
-std::array<float,2>{0.611556828f, 0.860478818f},
-std::array<float,2>{0.228926107f, 0.895521045f},
-std::array<float,2>{0.628048956f, 0.191322029f},
-std::array<float,2>{0.251713693f, 0.446139902f},
-std::array<float,2>{0.909162104f, 0.676374197f},
-std::array<float,2>{0.32441625f, 0.780675828f},
-std::array<float,2>{0.988756835f, 0.0621177331f},
-std::array<float,2>{0.179189995f, 0.298263878f},
-std::array<float,2>{0.732427418f, 0.554991186f},
-std::array<float,2>{0.0401536189f, 0.709865272f},
-std::array<float,2>{0.531734109f, 0.401549995f},
-std::array<float,2>{0.447643459f, 0.170254618f},
-std::array<float,2>{0.858289003f, 0.960371315f},
-std::array<float,2>{0.361775517f, 0.539167702f},
-std::array<float,2>{0.956010759f, 0.286230981f},
-std::array<float,2>{0.154040471f, 0.0379427411f},
-std::array<float,2>{0.694127202f, 0.756342649f},
-std::array<float,2>{0.0282217804f, 0.951550901f},
-std::array<float,2>{0.515961647f, 0.178145841f},
-std::array<float,2>{0.468809009f, 0.377863586f},
-std::array<float,2>{0.840746701f, 0.701525331f},
-std::array<float,2>{0.43118906f, 0.857407987f},
-std::array<float,2>{0.774726272f, 0.0900186673f},
-std::array<float,2>{0.0768877491f, 0.359335363f},
-std::array<float,2>{0.587463021f, 0.571591794f},
-std::array<float,2>{0.215454146f, 0.664348066f},
-std::array<float,2>{0.658147812f, 0.460445672f},
-std::array<float,2>{0.296052873f, 0.212229207f},
-std::array<float,2>{0.888925135f, 0.878422916f},
-std::array<float,2>{0.4666287f, 0.720350862f},
-std::array<float,2>{0.865495563f, 0.437078416f},
-std::array<float,2>{0.0542024784f, 0.146766722f},
-std::array<float,2>{0.561775208f, 0.97657913f},
-std::array<float,2>{0.165614635f, 0.794038355f},
-std::array<float,2>{0.746961713f, 0.00313251233f},
-std::array<float,2>{0.333780646f, 0.263304323f},
-std::array<float,2>{0.971507013f, 0.515120447f},
-std::array<float,2>{0.27732113f, 0.92263031f},
-std::array<float,2>{0.928868175f, 0.232626796f},
-std::array<float,2>{0.249050528f, 0.494780779f},
-std::array<float,2>{0.649931252f, 0.628750563f},
-std::array<float,2>{0.11700476f, 0.603633285f},
-std::array<float,2>{0.608831942f, 0.319339544f},
-std::array<float,2>{0.400111675f, 0.101866528f},
-std::array<float,2>{0.79002732f, 0.818405747f},
-std::array<float,2>{0.287732303f, 0.703281283f},
-std::array<float,2>{0.881075621f, 0.402934134f},
-std::array<float,2>{0.210491166f, 0.16572535f},
-std::array<float,2>{0.671419144f, 0.955727339f},
-std::array<float,2>{0.0701681823f, 0.773513377f},
-std::array<float,2>{0.57839632f, 0.0551057309f},
-std::array<float,2>{0.428431481f, 0.302259862f},
-std::array<float,2>{0.766275406f, 0.561916947f},
-std::array<float,2>{0.48065865f, 0.890803337f},
-std::array<float,2>{0.832364559f, 0.192825392f},
-std::array<float,2>{0.0175129231f, 0.450428814f},
-std::array<float,2>{0.525103271f, 0.672781169f},
-std::array<float,2>{0.146102846f, 0.579748333f},
-std::array<float,2>{0.700660527f, 0.373534501f},
-std::array<float,2>{0.372217894f, 0.0718491003f},
-std::array<float,2>{0.962017f, 0.865659893f},
-std::array<float,2>{0.395065337f, 0.517533004f},
-std::array<float,2>{0.788236856f, 0.267913163f},
-std::array<float,2>{0.118821368f, 0.0259836148f},
-std::array<float,2>{0.59469074f, 0.802024245f},
-std::array<float,2>{0.240527362f, 0.986134589f},
-std::array<float,2>{0.647923231f, 0.130892605f},
-std::array<float,2>{0.270108491f, 0.410758406f},
-std::array<float,2>{0.930287421f, 0.748646617f},
-std::array<float,2>{0.336759865f, 0.839909792f},
-std::array<float,2>{0.984113336f, 0.120837659f},
-std::array<float,2>{0.158794552f, 0.339608133f},
-std::array<float,2>{0.739802182f, 0.613621771f},
-std::array<float,2>{0.0623375066f, 0.652390897f},
-std::array<float,2>{0.549925625f, 0.47567901f},
-std::array<float,2>{0.458991826f, 0.243751958f},
-std::array<float,2>{0.8693524f, 0.916915894f},
-std::array<float,2>{0.348811805f, 0.607300758f},
-std::array<float,2>{0.940295517f, 0.314838618f},
-std::array<float,2>{0.13880752f, 0.105685033f},
-std::array<float,2>{0.717328072f, 0.812641919f},
-std::array<float,2>{0.0116491858f, 0.928832531f},
-std::array<float,2>{0.509360671f, 0.228296876f},
-std::array<float,2>{0.499612242f, 0.499217808f},
-std::array<float,2>{0.819169164f, 0.631376147f},
-std::array<float,2>{0.40854004f, 0.791267216f},
-std::array<float,2>{0.756897628f, 0.00717092864f},
-std::array<float,2>{0.0796432495f, 0.260092705f},
-std::array<float,2>{0.572254717f, 0.511328816f},
-std::array<float,2>{0.196779683f, 0.724233389f},
-std::array<float,2>{0.681180418f, 0.432932079f},
-std::array<float,2>{0.299970627f, 0.144217402f},
-std::array<float,2>{0.895544291f, 0.981232703f},
-std::array<float,2>{0.440151662f, 0.669650078f},
-std::array<float,2>{0.84401238f, 0.455482513f},
-std::array<float,2>{0.0325254388f, 0.217517093f},
-std::array<float,2>{0.546449602f, 0.881131291f},
-std::array<float,2>{0.183328837f, 0.85412842f},
-std::array<float,2>{0.720971942f, 0.0873307884f},
-std::array<float,2>{0.313851386f, 0.351748466f},
-std::array<float,2>{0.997432053f, 0.574332893f},
-std::array<float,2>{0.259061933f, 0.947881937f},
-std::array<float,2>{0.920680523f, 0.175772011f},
-std::array<float,2>{0.221185043f, 0.378962278f},
-std::array<float,2>{0.636516213f, 0.695445597f},
-std::array<float,2>{0.102789156f, 0.544245362f},
-std::array<float,2>{0.618012428f, 0.282972664f},
-std::array<float,2>{0.376758486f, 0.0335824527f},
-std::array<float,2>{0.803959846f, 0.753715217f},
-std::array<float,2>{0.320928305f, 0.636994302f},
-std::array<float,2>{0.9854213f, 0.490723938f},
-std::array<float,2>{0.17440781f, 0.225421995f},
-std::array<float,2>{0.730014324f, 0.930962443f},
-std::array<float,2>{0.0463802852f, 0.827600598f},
-std::array<float,2>{0.535985768f, 0.100331888f},
-std::array<float,2>{0.450493455f, 0.322296649f},
-std::array<float,2>{0.852004588f, 0.595686913f},
-std::array<float,2>{0.382977396f, 0.974682987f},
-std::array<float,2>{0.807914555f, 0.15365918f},
-std::array<float,2>{0.0972920954f, 0.428869069f},
-std::array<float,2>{0.614858985f, 0.733566582f},
-std::array<float,2>{0.233207732f, 0.502907038f},
-std::array<float,2>{0.628962815f, 0.255465209f},
-std::array<float,2>{0.256399661f, 0.00971853081f},
-std::array<float,2>{0.912041485f, 0.783579111f},
-std::array<float,2>{0.489357859f, 0.565889478f},
-std::array<float,2>{0.823665202f, 0.347764164f},
-std::array<float,2>{0.00561815314f, 0.0815008208f},
-std::array<float,2>{0.500704467f, 0.849299073f},
-std::array<float,2>{0.131349906f, 0.884073734f},
-std::array<float,2>{0.706996202f, 0.203129947f},
-std::array<float,2>{0.355207771f, 0.462919176f},
-std::array<float,2>{0.952909708f, 0.656545162f},
-std::array<float,2>{0.307643712f, 0.762960315f},
-std::array<float,2>{0.900545597f, 0.042414356f},
-std::array<float,2>{0.187861413f, 0.29682079f},
-std::array<float,2>{0.676632166f, 0.532312155f},
-std::array<float,2>{0.0906863213f, 0.689371586f},
-std::array<float,2>{0.566997647f, 0.384934694f},
-std::array<float,2>{0.421294868f, 0.185308754f},
-std::array<float,2>{0.762269199f, 0.944804668f},
-std::array<float,2>{0.279337823f, 0.5470469f},
-std::array<float,2>{0.923336864f, 0.304810464f},
-std::array<float,2>{0.244897157f, 0.0479296036f},
-std::array<float,2>{0.654643595f, 0.772440255f},
-std::array<float,2>{0.11249201f, 0.963611603f},
-std::array<float,2>{0.604064047f, 0.160209209f},
-std::array<float,2>{0.4057827f, 0.392907113f},
-std::array<float,2>{0.794610023f, 0.717635393f},
-std::array<float,2>{0.462285221f, 0.868623316f},
-std::array<float,2>{0.860419214f, 0.0644464642f},
-std::array<float,2>{0.0503435023f, 0.361865789f},
-std::array<float,2>{0.555202425f, 0.588010907f},
-std::array<float,2>{0.170237556f, 0.68562299f},
-std::array<float,2>{0.743823946f, 0.438124061f},
-std::array<float,2>{0.32873103f, 0.199489772f},
-std::array<float,2>{0.975039601f, 0.899369717f},
-std::array<float,2>{0.437034249f, 0.734419346f},
-std::array<float,2>{0.780139089f, 0.417261928f},
-std::array<float,2>{0.0740041882f, 0.140316188f},
-std::array<float,2>{0.590242863f, 0.993044615f},
-std::array<float,2>{0.211308479f, 0.808260083f},
-std::array<float,2>{0.660598934f, 0.0225269906f},
-std::array<float,2>{0.29181388f, 0.281004757f},
-std::array<float,2>{0.886027932f, 0.530706584f},
-std::array<float,2>{0.363609642f, 0.908662558f},
-std::array<float,2>{0.958905756f, 0.240223378f},
-std::array<float,2>{0.151758343f, 0.477713317f},
-std::array<float,2>{0.691124201f, 0.646692038f},
-std::array<float,2>{0.0250282455f, 0.62364465f},
-std::array<float,2>{0.522582471f, 0.330260068f},
-std::array<float,2>{0.476076692f, 0.113359302f},
-std::array<float,2>{0.837965071f, 0.833659112f},
-std::array<float,2>{0.369273722f, 0.7267344f},
-std::array<float,2>{0.967705905f, 0.424930602f},
-std::array<float,2>{0.141934931f, 0.149392143f},
-std::array<float,2>{0.696753263f, 0.968816698f},
-std::array<float,2>{0.0223507769f, 0.786169589f},
-std::array<float,2>{0.527436078f, 0.0117480941f},
-std::array<float,2>{0.477690846f, 0.250485361f},
-std::array<float,2>{0.831869543f, 0.506393254f},
-std::array<float,2>{0.424315453f, 0.936778069f},
-std::array<float,2>{0.770535767f, 0.219578505f},
-std::array<float,2>{0.0657040477f, 0.487048179f},
-std::array<float,2>{0.584104657f, 0.635289431f},
-std::array<float,2>{0.205834851f, 0.598450303f},
-std::array<float,2>{0.665725946f, 0.325170219f},
-std::array<float,2>{0.282368332f, 0.0940220281f},
-std::array<float,2>{0.878096521f, 0.820764244f},
-std::array<float,2>{0.45396322f, 0.535817206f},
-std::array<float,2>{0.873271644f, 0.289261758f},
-std::array<float,2>{0.0552280843f, 0.0455504619f},
-std::array<float,2>{0.551941872f, 0.760962963f},
-std::array<float,2>{0.160405353f, 0.937546432f},
-std::array<float,2>{0.73598659f, 0.183153257f},
-std::array<float,2>{0.342386931f, 0.390246063f},
-std::array<float,2>{0.97983557f, 0.692419291f},
-std::array<float,2>{0.268728197f, 0.844176292f},
-std::array<float,2>{0.93566519f, 0.0838998482f},
-std::array<float,2>{0.235261202f, 0.34516421f},
-std::array<float,2>{0.641105533f, 0.569210351f},
-std::array<float,2>{0.12145181f, 0.662329495f},
-std::array<float,2>{0.600668907f, 0.465906888f},
-std::array<float,2>{0.394378543f, 0.209069729f},
-std::array<float,2>{0.781459808f, 0.888186097f},
-std::array<float,2>{0.303128362f, 0.592191637f},
-std::array<float,2>{0.891689837f, 0.365047216f},
-std::array<float,2>{0.201642796f, 0.0667136535f},
-std::array<float,2>{0.685203969f, 0.874442875f},
-std::array<float,2>{0.0831710026f, 0.905141473f},
-std::array<float,2>{0.575600505f, 0.197763175f},
-std::array<float,2>{0.412220657f, 0.444338292f},
-std::array<float,2>{0.752449036f, 0.682248652f},
-std::array<float,2>{0.494154543f, 0.768273354f},
-std::array<float,2>{0.813359141f, 0.0525169484f},
-std::array<float,2>{0.0151494807f, 0.309984058f},
-std::array<float,2>{0.512236059f, 0.551744521f},
-std::array<float,2>{0.133074522f, 0.712172031f},
-std::array<float,2>{0.714550257f, 0.396522582f},
-std::array<float,2>{0.345568717f, 0.158115447f},
-std::array<float,2>{0.945178926f, 0.965640903f},
-std::array<float,2>{0.382734656f, 0.640755773f},
-std::array<float,2>{0.800536275f, 0.48370418f},
-std::array<float,2>{0.106099837f, 0.23641935f},
-std::array<float,2>{0.624975562f, 0.913236082f},
-std::array<float,2>{0.223638311f, 0.831394732f},
-std::array<float,2>{0.636871517f, 0.109404497f},
-std::array<float,2>{0.26451692f, 0.33415553f},
-std::array<float,2>{0.917438686f, 0.617591739f},
-std::array<float,2>{0.317375541f, 0.999732554f},
-std::array<float,2>{0.995510936f, 0.132900998f},
-std::array<float,2>{0.184596643f, 0.41941002f},
-std::array<float,2>{0.722807527f, 0.740048587f},
-std::array<float,2>{0.0375340618f, 0.52454114f},
-std::array<float,2>{0.542959511f, 0.27444306f},
-std::array<float,2>{0.441661239f, 0.0166179743f},
-std::array<float,2>{0.850503385f, 0.812370479f},
-std::array<float,2>{0.252892971f, 0.678616285f},
-std::array<float,2>{0.908083081f, 0.448486656f},
-std::array<float,2>{0.227269292f, 0.187683895f},
-std::array<float,2>{0.625899434f, 0.898388326f},
-std::array<float,2>{0.0997419059f, 0.862141609f},
-std::array<float,2>{0.610796332f, 0.0744988769f},
-std::array<float,2>{0.389998645f, 0.369024932f},
-std::array<float,2>{0.808782697f, 0.584269762f},
-std::array<float,2>{0.445328772f, 0.95893544f},
-std::array<float,2>{0.856112063f, 0.168287247f},
-std::array<float,2>{0.0415341035f, 0.398510337f},
-std::array<float,2>{0.534251094f, 0.708217502f},
-std::array<float,2>{0.176412076f, 0.55830586f},
-std::array<float,2>{0.730827391f, 0.300325155f},
-std::array<float,2>{0.326740265f, 0.0596208721f},
-std::array<float,2>{0.990474582f, 0.777624249f},
-std::array<float,2>{0.416288525f, 0.612275839f},
-std::array<float,2>{0.759259582f, 0.340746105f},
-std::array<float,2>{0.089729093f, 0.121263772f},
-std::array<float,2>{0.566041529f, 0.837908447f},
-std::array<float,2>{0.194186315f, 0.920348704f},
-std::array<float,2>{0.675374389f, 0.247221231f},
-std::array<float,2>{0.31116429f, 0.472392708f},
-std::array<float,2>{0.905653238f, 0.648705006f},
-std::array<float,2>{0.358896941f, 0.799760222f},
-std::array<float,2>{0.948393464f, 0.0295307972f},
-std::array<float,2>{0.126419231f, 0.273227394f},
-std::array<float,2>{0.709112942f, 0.520686805f},
-std::array<float,2>{0.00310063991f, 0.743006229f},
-std::array<float,2>{0.506127775f, 0.407514632f},
-std::array<float,2>{0.485756606f, 0.126967996f},
-std::array<float,2>{0.82804966f, 0.992175698f},
-std::array<float,2>{0.335361481f, 0.512563169f},
-std::array<float,2>{0.969080746f, 0.26508379f},
-std::array<float,2>{0.166881308f, 0.0013390152f},
-std::array<float,2>{0.749994993f, 0.795731723f},
-std::array<float,2>{0.0523291156f, 0.97874248f},
-std::array<float,2>{0.55964452f, 0.146317571f},
-std::array<float,2>{0.466913283f, 0.433668166f},
-std::array<float,2>{0.864705443f, 0.72222662f},
-std::array<float,2>{0.40041241f, 0.817295313f},
-std::array<float,2>{0.79113102f, 0.104891844f},
-std::array<float,2>{0.114259757f, 0.317836851f},
-std::array<float,2>{0.606207848f, 0.603406847f},
-std::array<float,2>{0.247192144f, 0.625443578f},
-std::array<float,2>{0.651383042f, 0.493946671f},
-std::array<float,2>{0.274361551f, 0.231286675f},
-std::array<float,2>{0.926708341f, 0.924468875f},
-std::array<float,2>{0.471747488f, 0.69949168f},
-std::array<float,2>{0.843190968f, 0.376856029f},
-std::array<float,2>{0.031015601f, 0.176749647f},
-std::array<float,2>{0.517947197f, 0.949783862f},
-std::array<float,2>{0.156163722f, 0.7555812f},
-std::array<float,2>{0.69189781f, 0.0354609825f},
-std::array<float,2>{0.360172272f, 0.288434148f},
-std::array<float,2>{0.95391506f, 0.542378008f},
-std::array<float,2>{0.29353866f, 0.876152694f},
-std::array<float,2>{0.888566017f, 0.213231504f},
-std::array<float,2>{0.218006775f, 0.458362788f},
-std::array<float,2>{0.659582853f, 0.667500317f},
-std::array<float,2>{0.0761601999f, 0.573134303f},
-std::array<float,2>{0.589815915f, 0.356183976f},
-std::array<float,2>{0.431807876f, 0.0928332731f},
-std::array<float,2>{0.776263356f, 0.858336687f},
-std::array<float,2>{0.291482657f, 0.736819446f},
-std::array<float,2>{0.886321723f, 0.415346563f},
-std::array<float,2>{0.211899832f, 0.13702026f},
-std::array<float,2>{0.660838246f, 0.995042086f},
-std::array<float,2>{0.0735628083f, 0.804879487f},
-std::array<float,2>{0.590371668f, 0.0212135389f},
-std::array<float,2>{0.436979592f, 0.277761519f},
-std::array<float,2>{0.779781818f, 0.527610362f},
-std::array<float,2>{0.47595346f, 0.907702684f},
-std::array<float,2>{0.838632941f, 0.240677729f},
-std::array<float,2>{0.0245685354f, 0.479970932f},
-std::array<float,2>{0.523023546f, 0.644994497f},
-std::array<float,2>{0.152230218f, 0.622520447f},
-std::array<float,2>{0.690708995f, 0.328610003f},
-std::array<float,2>{0.364225537f, 0.116873257f},
-std::array<float,2>{0.958272159f, 0.835923314f},
-std::array<float,2>{0.405293226f, 0.549633741f},
-std::array<float,2>{0.793985605f, 0.308082402f},
-std::array<float,2>{0.113267355f, 0.0496933647f},
-std::array<float,2>{0.603890836f, 0.769656241f},
-std::array<float,2>{0.244292229f, 0.962446034f},
-std::array<float,2>{0.654820323f, 0.162473619f},
-std::array<float,2>{0.280089945f, 0.391291857f},
-std::array<float,2>{0.923601806f, 0.715282559f},
-std::array<float,2>{0.328260809f, 0.869764686f},
-std::array<float,2>{0.975255549f, 0.0655034035f},
-std::array<float,2>{0.17067261f, 0.360549659f},
-std::array<float,2>{0.743361533f, 0.586247563f},
-std::array<float,2>{0.0499882847f, 0.684832036f},
-std::array<float,2>{0.555026531f, 0.4404881f},
-std::array<float,2>{0.46281907f, 0.201730534f},
-std::array<float,2>{0.861223161f, 0.900775552f},
-std::array<float,2>{0.354868323f, 0.563917816f},
-std::array<float,2>{0.95221597f, 0.350974053f},
-std::array<float,2>{0.131250367f, 0.0781688616f},
-std::array<float,2>{0.706079721f, 0.850674331f},
-std::array<float,2>{0.00491548888f, 0.886071444f},
-std::array<float,2>{0.500093758f, 0.205353916f},
-std::array<float,2>{0.490009516f, 0.46240589f},
-std::array<float,2>{0.823988914f, 0.658332169f},
-std::array<float,2>{0.421420127f, 0.765511453f},
-std::array<float,2>{0.762173235f, 0.039108973f},
-std::array<float,2>{0.0900343657f, 0.294781268f},
-std::array<float,2>{0.566847146f, 0.533974648f},
-std::array<float,2>{0.188165739f, 0.690704763f},
-std::array<float,2>{0.675892651f, 0.383284658f},
-std::array<float,2>{0.308401078f, 0.185660988f},
-std::array<float,2>{0.901262462f, 0.943020403f},
-std::array<float,2>{0.45091483f, 0.639854848f},
-std::array<float,2>{0.852217257f, 0.488448769f},
-std::array<float,2>{0.0467551127f, 0.223733559f},
-std::array<float,2>{0.535208344f, 0.932458401f},
-std::array<float,2>{0.173900798f, 0.824674428f},
-std::array<float,2>{0.729848802f, 0.0995800868f},
-std::array<float,2>{0.320525825f, 0.320579767f},
-std::array<float,2>{0.986199141f, 0.595891774f},
-std::array<float,2>{0.256299973f, 0.974600554f},
-std::array<float,2>{0.911267221f, 0.155454516f},
-std::array<float,2>{0.23273629f, 0.427455574f},
-std::array<float,2>{0.629519105f, 0.73222822f},
-std::array<float,2>{0.0970241129f, 0.501276135f},
-std::array<float,2>{0.61459285f, 0.25666976f},
-std::array<float,2>{0.383403867f, 0.0109678796f},
-std::array<float,2>{0.80856663f, 0.782378793f},
-std::array<float,2>{0.314073056f, 0.670438945f},
-std::array<float,2>{0.997862041f, 0.453908622f},
-std::array<float,2>{0.183102801f, 0.215743035f},
-std::array<float,2>{0.721512794f, 0.878988743f},
-std::array<float,2>{0.0331241824f, 0.8519997f},
-std::array<float,2>{0.546205938f, 0.0888953134f},
-std::array<float,2>{0.43963477f, 0.353889197f},
-std::array<float,2>{0.84433347f, 0.576212943f},
-std::array<float,2>{0.376024365f, 0.946303964f},
-std::array<float,2>{0.804431915f, 0.173584148f},
-std::array<float,2>{0.103035577f, 0.382020026f},
-std::array<float,2>{0.617222667f, 0.699002743f},
-std::array<float,2>{0.221317559f, 0.546225667f},
-std::array<float,2>{0.636015058f, 0.28493163f},
-std::array<float,2>{0.259424835f, 0.0314077921f},
-std::array<float,2>{0.920240998f, 0.751856446f},
-std::array<float,2>{0.499204546f, 0.608276725f},
-std::array<float,2>{0.818555713f, 0.314207435f},
-std::array<float,2>{0.0107622314f, 0.10798832f},
-std::array<float,2>{0.509114325f, 0.815297902f},
-std::array<float,2>{0.139461622f, 0.925960422f},
-std::array<float,2>{0.717096508f, 0.230324179f},
-std::array<float,2>{0.349281013f, 0.49692601f},
-std::array<float,2>{0.939911485f, 0.62954247f},
-std::array<float,2>{0.300349325f, 0.78962779f},
-std::array<float,2>{0.896076143f, 0.00519337552f},
-std::array<float,2>{0.196455628f, 0.258042723f},
-std::array<float,2>{0.681124449f, 0.508865416f},
-std::array<float,2>{0.0793193728f, 0.726237416f},
-std::array<float,2>{0.571492016f, 0.43145141f},
-std::array<float,2>{0.408892065f, 0.140777424f},
-std::array<float,2>{0.75770098f, 0.984209597f},
-std::array<float,2>{0.269730359f, 0.519043148f},
-std::array<float,2>{0.929995f, 0.265826911f},
-std::array<float,2>{0.240920991f, 0.0242753737f},
-std::array<float,2>{0.648121715f, 0.804059744f},
-std::array<float,2>{0.118176341f, 0.9866907f},
-std::array<float,2>{0.594151556f, 0.1306137f},
-std::array<float,2>{0.394545317f, 0.41279766f},
-std::array<float,2>{0.789036095f, 0.746602058f},
-std::array<float,2>{0.459935993f, 0.842922688f},
-std::array<float,2>{0.870045483f, 0.118048079f},
-std::array<float,2>{0.0619344711f, 0.336611003f},
-std::array<float,2>{0.550623536f, 0.617012262f},
-std::array<float,2>{0.158288956f, 0.655327559f},
-std::array<float,2>{0.739391685f, 0.473205566f},
-std::array<float,2>{0.336420387f, 0.244744405f},
-std::array<float,2>{0.983479202f, 0.914573789f},
-std::array<float,2>{0.427877545f, 0.705906332f},
-std::array<float,2>{0.766013503f, 0.406203628f},
-std::array<float,2>{0.0696260035f, 0.167217597f},
-std::array<float,2>{0.578613818f, 0.954103827f},
-std::array<float,2>{0.210287556f, 0.776287556f},
-std::array<float,2>{0.670953989f, 0.0578569509f},
-std::array<float,2>{0.287360579f, 0.30311799f},
-std::array<float,2>{0.88157022f, 0.560203731f},
-std::array<float,2>{0.372655511f, 0.893870115f},
-std::array<float,2>{0.962739825f, 0.193648785f},
-std::array<float,2>{0.14568761f, 0.451949209f},
-std::array<float,2>{0.70098716f, 0.675278664f},
-std::array<float,2>{0.0168526415f, 0.581999362f},
-std::array<float,2>{0.524902225f, 0.372164488f},
-std::array<float,2>{0.481209129f, 0.0730714947f},
-std::array<float,2>{0.832782269f, 0.86437422f},
-std::array<float,2>{0.359377235f, 0.701751471f},
-std::array<float,2>{0.953525841f, 0.37705335f},
-std::array<float,2>{0.155740485f, 0.178237811f},
-std::array<float,2>{0.69175154f, 0.952004075f},
-std::array<float,2>{0.0307545923f, 0.7566697f},
-std::array<float,2>{0.518503904f, 0.0375456549f},
-std::array<float,2>{0.472564727f, 0.287044406f},
-std::array<float,2>{0.843551576f, 0.539845169f},
-std::array<float,2>{0.432257652f, 0.878307581f},
-std::array<float,2>{0.775493562f, 0.212857142f},
-std::array<float,2>{0.0754871741f, 0.46067667f},
-std::array<float,2>{0.588899314f, 0.665019989f},
-std::array<float,2>{0.218682811f, 0.571874976f},
-std::array<float,2>{0.659967542f, 0.358407617f},
-std::array<float,2>{0.293077886f, 0.0903502256f},
-std::array<float,2>{0.887782454f, 0.85669136f},
-std::array<float,2>{0.467346609f, 0.515221357f},
-std::array<float,2>{0.864965379f, 0.263143718f},
-std::array<float,2>{0.0520651266f, 0.00358836679f},
-std::array<float,2>{0.560389519f, 0.794737756f},
-std::array<float,2>{0.166046321f, 0.977425635f},
-std::array<float,2>{0.749218702f, 0.147009984f},
-std::array<float,2>{0.335811228f, 0.436970711f},
-std::array<float,2>{0.969653904f, 0.720129907f},
-std::array<float,2>{0.273704171f, 0.819236577f},
-std::array<float,2>{0.926094174f, 0.102391928f},
-std::array<float,2>{0.247879684f, 0.320113271f},
-std::array<float,2>{0.651856005f, 0.604044557f},
-std::array<float,2>{0.115087695f, 0.628413618f},
-std::array<float,2>{0.605826735f, 0.494217068f},
-std::array<float,2>{0.401339054f, 0.233293816f},
-std::array<float,2>{0.7917822f, 0.922192097f},
-std::array<float,2>{0.31080848f, 0.609603047f},
-std::array<float,2>{0.905846655f, 0.343293667f},
-std::array<float,2>{0.193571776f, 0.123301074f},
-std::array<float,2>{0.675018966f, 0.836727023f},
-std::array<float,2>{0.0891448036f, 0.919867277f},
-std::array<float,2>{0.565720677f, 0.248986363f},
-std::array<float,2>{0.416906267f, 0.469161421f},
-std::array<float,2>{0.759435415f, 0.650676131f},
-std::array<float,2>{0.485944659f, 0.797983527f},
-std::array<float,2>{0.827202559f, 0.0287071858f},
-std::array<float,2>{0.00372328842f, 0.27022779f},
-std::array<float,2>{0.506607711f, 0.52169615f},
-std::array<float,2>{0.126871973f, 0.745403171f},
-std::array<float,2>{0.709583223f, 0.409213454f},
-std::array<float,2>{0.358531475f, 0.126162454f},
-std::array<float,2>{0.948961198f, 0.988718629f},
-std::array<float,2>{0.39062053f, 0.675849795f},
-std::array<float,2>{0.809399724f, 0.445388496f},
-std::array<float,2>{0.100256793f, 0.190743357f},
-std::array<float,2>{0.611303329f, 0.896378756f},
-std::array<float,2>{0.226824313f, 0.86131233f},
-std::array<float,2>{0.625306129f, 0.076226823f},
-std::array<float,2>{0.252083272f, 0.369827598f},
-std::array<float,2>{0.907530665f, 0.582502544f},
-std::array<float,2>{0.326339453f, 0.960464835f},
-std::array<float,2>{0.990903676f, 0.17063573f},
-std::array<float,2>{0.175890982f, 0.402139485f},
-std::array<float,2>{0.731124818f, 0.709263206f},
-std::array<float,2>{0.0411163196f, 0.5554654f},
-std::array<float,2>{0.534711778f, 0.298544645f},
-std::array<float,2>{0.446096331f, 0.0617277399f},
-std::array<float,2>{0.855800509f, 0.780820727f},
-std::array<float,2>{0.263932914f, 0.644470096f},
-std::array<float,2>{0.917933524f, 0.480840921f},
-std::array<float,2>{0.22434175f, 0.235746965f},
-std::array<float,2>{0.637223184f, 0.911597073f},
-std::array<float,2>{0.105708227f, 0.828404903f},
-std::array<float,2>{0.624052286f, 0.111501738f},
-std::array<float,2>{0.382165551f, 0.333873302f},
-std::array<float,2>{0.800021946f, 0.619646907f},
-std::array<float,2>{0.442354172f, 0.9962942f},
-std::array<float,2>{0.849908113f, 0.134861454f},
-std::array<float,2>{0.0378172994f, 0.421275556f},
-std::array<float,2>{0.542176545f, 0.741801381f},
-std::array<float,2>{0.18540816f, 0.527093351f},
-std::array<float,2>{0.723453462f, 0.276987612f},
-std::array<float,2>{0.316626161f, 0.0191634484f},
-std::array<float,2>{0.995768428f, 0.809594989f},
-std::array<float,2>{0.412851661f, 0.589865744f},
-std::array<float,2>{0.752429366f, 0.365365863f},
-std::array<float,2>{0.0836671889f, 0.0698032901f},
-std::array<float,2>{0.576126039f, 0.872174263f},
-std::array<float,2>{0.202121913f, 0.902510047f},
-std::array<float,2>{0.684580386f, 0.195546642f},
-std::array<float,2>{0.303349227f, 0.442633808f},
-std::array<float,2>{0.892222285f, 0.67987448f},
-std::array<float,2>{0.344984591f, 0.765747845f},
-std::array<float,2>{0.944556355f, 0.0542186163f},
-std::array<float,2>{0.133485079f, 0.310854822f},
-std::array<float,2>{0.714266241f, 0.554152429f},
-std::array<float,2>{0.0150140012f, 0.713522136f},
-std::array<float,2>{0.512126207f, 0.395701677f},
-std::array<float,2>{0.494966924f, 0.158517733f},
-std::array<float,2>{0.812660694f, 0.967206299f},
-std::array<float,2>{0.342070192f, 0.537721574f},
-std::array<float,2>{0.980267286f, 0.291437715f},
-std::array<float,2>{0.161101818f, 0.0448234081f},
-std::array<float,2>{0.73567909f, 0.759621561f},
-std::array<float,2>{0.0549381524f, 0.93983382f},
-std::array<float,2>{0.552417934f, 0.180386245f},
-std::array<float,2>{0.453363121f, 0.388606608f},
-std::array<float,2>{0.873951912f, 0.694484949f},
-std::array<float,2>{0.393840343f, 0.847313881f},
-std::array<float,2>{0.781949043f, 0.0846174583f},
-std::array<float,2>{0.122025743f, 0.345745116f},
-std::array<float,2>{0.6010831f, 0.566487849f},
-std::array<float,2>{0.234844878f, 0.661368489f},
-std::array<float,2>{0.641267419f, 0.46720466f},
-std::array<float,2>{0.269132704f, 0.2088653f},
-std::array<float,2>{0.936521411f, 0.890411079f},
-std::array<float,2>{0.478319794f, 0.728530586f},
-std::array<float,2>{0.831332803f, 0.422983348f},
-std::array<float,2>{0.0216140542f, 0.150737271f},
-std::array<float,2>{0.528118849f, 0.97165674f},
-std::array<float,2>{0.142375335f, 0.788411081f},
-std::array<float,2>{0.697123349f, 0.0148692951f},
-std::array<float,2>{0.369630873f, 0.253648967f},
-std::array<float,2>{0.967041552f, 0.504596472f},
-std::array<float,2>{0.282759637f, 0.933931231f},
-std::array<float,2>{0.878738105f, 0.221373513f},
-std::array<float,2>{0.205382675f, 0.484828353f},
-std::array<float,2>{0.665299058f, 0.632888734f},
-std::array<float,2>{0.0662457645f, 0.600626707f},
-std::array<float,2>{0.584474385f, 0.327844918f},
-std::array<float,2>{0.424765527f, 0.0962503478f},
-std::array<float,2>{0.771125972f, 0.823704004f},
-std::array<float,2>{0.27902475f, 0.71696806f},
-std::array<float,2>{0.924935281f, 0.393216521f},
-std::array<float,2>{0.243916795f, 0.161070928f},
-std::array<float,2>{0.652487159f, 0.963219345f},
-std::array<float,2>{0.110003263f, 0.771591187f},
-std::array<float,2>{0.602666557f, 0.0485727936f},
-std::array<float,2>{0.403896779f, 0.305603176f},
-std::array<float,2>{0.796355546f, 0.547803044f},
-std::array<float,2>{0.462900102f, 0.898764133f},
-std::array<float,2>{0.862250745f, 0.199952498f},
-std::array<float,2>{0.0485559665f, 0.43793714f},
-std::array<float,2>{0.557497919f, 0.686049819f},
-std::array<float,2>{0.168608338f, 0.588453889f},
-std::array<float,2>{0.744579673f, 0.361664563f},
-std::array<float,2>{0.330403864f, 0.06350407f},
-std::array<float,2>{0.973685622f, 0.869116664f},
-std::array<float,2>{0.435203016f, 0.531007111f},
-std::array<float,2>{0.778541923f, 0.2807329f},
-std::array<float,2>{0.071850948f, 0.0233154465f},
-std::array<float,2>{0.593299568f, 0.808069527f},
-std::array<float,2>{0.214484453f, 0.992359221f},
-std::array<float,2>{0.662425518f, 0.139837176f},
-std::array<float,2>{0.289899945f, 0.41752106f},
-std::array<float,2>{0.88283509f, 0.734935105f},
-std::array<float,2>{0.366387129f, 0.833260059f},
-std::array<float,2>{0.959567666f, 0.113852955f},
-std::array<float,2>{0.149173915f, 0.330934525f},
-std::array<float,2>{0.689236581f, 0.623147607f},
-std::array<float,2>{0.0270270184f, 0.647385955f},
-std::array<float,2>{0.520509839f, 0.478302628f},
-std::array<float,2>{0.47295475f, 0.239433199f},
-std::array<float,2>{0.836455286f, 0.908823967f},
-std::array<float,2>{0.32320261f, 0.595024884f},
-std::array<float,2>{0.987117112f, 0.322878152f},
-std::array<float,2>{0.173567578f, 0.100085065f},
-std::array<float,2>{0.727608979f, 0.82786423f},
-std::array<float,2>{0.0435325839f, 0.93161881f},
-std::array<float,2>{0.538066924f, 0.224895224f},
-std::array<float,2>{0.451286823f, 0.490552008f},
-std::array<float,2>{0.853866637f, 0.637377799f},
-std::array<float,2>{0.38554436f, 0.783820152f},
-std::array<float,2>{0.80506289f, 0.00917937048f},
-std::array<float,2>{0.0956146494f, 0.255263746f},
-std::array<float,2>{0.616902113f, 0.502193034f},
-std::array<float,2>{0.23049289f, 0.734328747f},
-std::array<float,2>{0.631928921f, 0.429540396f},
-std::array<float,2>{0.254320741f, 0.153951377f},
-std::array<float,2>{0.913374603f, 0.975362182f},
-std::array<float,2>{0.491237551f, 0.657073557f},
-std::array<float,2>{0.822071791f, 0.463541061f},
-std::array<float,2>{0.00632018782f, 0.203833148f},
-std::array<float,2>{0.502611876f, 0.884723127f},
-std::array<float,2>{0.129524067f, 0.848675191f},
-std::array<float,2>{0.703880787f, 0.0817350075f},
-std::array<float,2>{0.351883888f, 0.348428875f},
-std::array<float,2>{0.951062143f, 0.56614995f},
-std::array<float,2>{0.306117654f, 0.945065439f},
-std::array<float,2>{0.899020255f, 0.184746221f},
-std::array<float,2>{0.18960911f, 0.385335475f},
-std::array<float,2>{0.678533554f, 0.688652813f},
-std::array<float,2>{0.09340965f, 0.533196092f},
-std::array<float,2>{0.569622278f, 0.295921952f},
-std::array<float,2>{0.419269919f, 0.0429510027f},
-std::array<float,2>{0.764297783f, 0.763397455f},
-std::array<float,2>{0.35101679f, 0.631013334f},
-std::array<float,2>{0.938299477f, 0.499571681f},
-std::array<float,2>{0.137756228f, 0.227544308f},
-std::array<float,2>{0.71607095f, 0.929223716f},
-std::array<float,2>{0.00949888024f, 0.813391447f},
-std::array<float,2>{0.510627329f, 0.106398292f},
-std::array<float,2>{0.497685254f, 0.315283924f},
-std::array<float,2>{0.817815423f, 0.606457233f},
-std::array<float,2>{0.406404018f, 0.980501711f},
-std::array<float,2>{0.754703045f, 0.143611252f},
-std::array<float,2>{0.0807410702f, 0.433518946f},
-std::array<float,2>{0.573262513f, 0.723896921f},
-std::array<float,2>{0.197391182f, 0.51119858f},
-std::array<float,2>{0.68253839f, 0.260595888f},
-std::array<float,2>{0.298150331f, 0.00736218737f},
-std::array<float,2>{0.898429096f, 0.791689038f},
-std::array<float,2>{0.437941402f, 0.574724257f},
-std::array<float,2>{0.845919728f, 0.352161318f},
-std::array<float,2>{0.0335348248f, 0.0874097496f},
-std::array<float,2>{0.543752551f, 0.853606284f},
-std::array<float,2>{0.179857954f, 0.881717741f},
-std::array<float,2>{0.720350564f, 0.216867521f},
-std::array<float,2>{0.314629138f, 0.455931634f},
-std::array<float,2>{0.998834491f, 0.669093072f},
-std::array<float,2>{0.259766221f, 0.753035069f},
-std::array<float,2>{0.919506252f, 0.0340427533f},
-std::array<float,2>{0.219214648f, 0.282435745f},
-std::array<float,2>{0.63405019f, 0.544451833f},
-std::array<float,2>{0.104683802f, 0.695860624f},
-std::array<float,2>{0.61973387f, 0.379549474f},
-std::array<float,2>{0.377572864f, 0.175122961f},
-std::array<float,2>{0.800869942f, 0.947593749f},
-std::array<float,2>{0.285730571f, 0.562379062f},
-std::array<float,2>{0.879288793f, 0.302000433f},
-std::array<float,2>{0.208087116f, 0.0554424636f},
-std::array<float,2>{0.669606328f, 0.774276018f},
-std::array<float,2>{0.0674138814f, 0.955375254f},
-std::array<float,2>{0.581031978f, 0.165474534f},
-std::array<float,2>{0.42696628f, 0.402761012f},
-std::array<float,2>{0.768230617f, 0.703861237f},
-std::array<float,2>{0.483486474f, 0.865923226f},
-std::array<float,2>{0.834933341f, 0.071775727f},
-std::array<float,2>{0.0189961866f, 0.373915553f},
-std::array<float,2>{0.52553153f, 0.579137564f},
-std::array<float,2>{0.147604808f, 0.672313631f},
-std::array<float,2>{0.701909065f, 0.450972795f},
-std::array<float,2>{0.373074859f, 0.193203583f},
-std::array<float,2>{0.964499533f, 0.891391993f},
-std::array<float,2>{0.398357719f, 0.748435974f},
-std::array<float,2>{0.786123693f, 0.41037026f},
-std::array<float,2>{0.120836064f, 0.131389767f},
-std::array<float,2>{0.597025275f, 0.985730529f},
-std::array<float,2>{0.238980129f, 0.802616179f},
-std::array<float,2>{0.645870805f, 0.0257177055f},
-std::array<float,2>{0.273309916f, 0.26845631f},
-std::array<float,2>{0.932043672f, 0.516960859f},
-std::array<float,2>{0.33891055f, 0.916413605f},
-std::array<float,2>{0.982341707f, 0.243394211f},
-std::array<float,2>{0.156348079f, 0.476140201f},
-std::array<float,2>{0.741262317f, 0.653285086f},
-std::array<float,2>{0.0596944429f, 0.614057243f},
-std::array<float,2>{0.547211111f, 0.339114666f},
-std::array<float,2>{0.457295686f, 0.120386809f},
-std::array<float,2>{0.86850214f, 0.840584219f},
-std::array<float,2>{0.333463132f, 0.72213012f},
-std::array<float,2>{0.971091509f, 0.434252471f},
-std::array<float,2>{0.165357441f, 0.145917535f},
-std::array<float,2>{0.746497095f, 0.979387879f},
-std::array<float,2>{0.0538804121f, 0.795122564f},
-std::array<float,2>{0.562169373f, 0.00180984556f},
-std::array<float,2>{0.46590507f, 0.265299916f},
-std::array<float,2>{0.866093457f, 0.511972547f},
-std::array<float,2>{0.399823099f, 0.923973918f},
-std::array<float,2>{0.789211154f, 0.230831653f},
-std::array<float,2>{0.116547495f, 0.493368119f},
-std::array<float,2>{0.609348595f, 0.625496507f},
-std::array<float,2>{0.249858975f, 0.60283494f},
-std::array<float,2>{0.649417579f, 0.318294555f},
-std::array<float,2>{0.276810378f, 0.105428025f},
-std::array<float,2>{0.929306924f, 0.81666702f},
-std::array<float,2>{0.469305873f, 0.542924821f},
-std::array<float,2>{0.839886367f, 0.288703561f},
-std::array<float,2>{0.0274514705f, 0.0358290784f},
-std::array<float,2>{0.516542733f, 0.755246639f},
-std::array<float,2>{0.153760284f, 0.949305475f},
-std::array<float,2>{0.693770409f, 0.175828815f},
-std::array<float,2>{0.36219424f, 0.376053542f},
-std::array<float,2>{0.955527067f, 0.70016098f},
-std::array<float,2>{0.296499908f, 0.85747391f},
-std::array<float,2>{0.88937521f, 0.0933221057f},
-std::array<float,2>{0.214950308f, 0.355744183f},
-std::array<float,2>{0.657617152f, 0.57275176f},
-std::array<float,2>{0.0763065964f, 0.667058229f},
-std::array<float,2>{0.58703804f, 0.458929688f},
-std::array<float,2>{0.430983245f, 0.213741943f},
-std::array<float,2>{0.775185525f, 0.876497567f},
-std::array<float,2>{0.25140664f, 0.584812284f},
-std::array<float,2>{0.908206463f, 0.368566185f},
-std::array<float,2>{0.229264379f, 0.0747929439f},
-std::array<float,2>{0.628695846f, 0.86163938f},
-std::array<float,2>{0.0985128507f, 0.897794247f},
-std::array<float,2>{0.611906171f, 0.188138232f},
-std::array<float,2>{0.388042688f, 0.449127555f},
-std::array<float,2>{0.812243998f, 0.678043067f},
-std::array<float,2>{0.448066056f, 0.778013349f},
-std::array<float,2>{0.857763648f, 0.060191486f},
-std::array<float,2>{0.0405520573f, 0.300209165f},
-std::array<float,2>{0.532088161f, 0.557812274f},
-std::array<float,2>{0.179640234f, 0.708802938f},
-std::array<float,2>{0.733045936f, 0.399089485f},
-std::array<float,2>{0.324973404f, 0.168609604f},
-std::array<float,2>{0.989183128f, 0.958173752f},
-std::array<float,2>{0.415560663f, 0.649326384f},
-std::array<float,2>{0.761601388f, 0.471690148f},
-std::array<float,2>{0.0868614241f, 0.247940406f},
-std::array<float,2>{0.564045489f, 0.920603216f},
-std::array<float,2>{0.192798838f, 0.838696599f},
-std::array<float,2>{0.673221529f, 0.121612877f},
-std::array<float,2>{0.308625698f, 0.340210646f},
-std::array<float,2>{0.903261185f, 0.611468971f},
-std::array<float,2>{0.35647288f, 0.991294801f},
-std::array<float,2>{0.945403874f, 0.127802059f},
-std::array<float,2>{0.127408072f, 0.408108801f},
-std::array<float,2>{0.707051814f, 0.742603898f},
-std::array<float,2>{0.000536835054f, 0.521113634f},
-std::array<float,2>{0.5039379f, 0.272707731f},
-std::array<float,2>{0.488053441f, 0.0298852101f},
-std::array<float,2>{0.825893283f, 0.799285173f},
-std::array<float,2>{0.301677376f, 0.682127833f},
-std::array<float,2>{0.894369304f, 0.445256233f},
-std::array<float,2>{0.200136945f, 0.197546065f},
-std::array<float,2>{0.687350214f, 0.904323995f},
-std::array<float,2>{0.0853967294f, 0.874760151f},
-std::array<float,2>{0.577764869f, 0.067149058f},
-std::array<float,2>{0.41016382f, 0.364432245f},
-std::array<float,2>{0.751476347f, 0.592613041f},
-std::array<float,2>{0.492730886f, 0.965077221f},
-std::array<float,2>{0.815829039f, 0.157588243f},
-std::array<float,2>{0.0118421102f, 0.397386283f},
-std::array<float,2>{0.515167832f, 0.712437451f},
-std::array<float,2>{0.135900185f, 0.550958097f},
-std::array<float,2>{0.711262286f, 0.310539186f},
-std::array<float,2>{0.346691638f, 0.0519820154f},
-std::array<float,2>{0.943104565f, 0.767960489f},
-std::array<float,2>{0.380534291f, 0.617699623f},
-std::array<float,2>{0.798105478f, 0.33486402f},
-std::array<float,2>{0.108310528f, 0.110158928f},
-std::array<float,2>{0.622376084f, 0.831797898f},
-std::array<float,2>{0.226253107f, 0.913940191f},
-std::array<float,2>{0.639459372f, 0.236980617f},
-std::array<float,2>{0.261733234f, 0.484103769f},
-std::array<float,2>{0.915689588f, 0.641257942f},
-std::array<float,2>{0.319452852f, 0.811555922f},
-std::array<float,2>{0.993401706f, 0.0173442159f},
-std::array<float,2>{0.186568022f, 0.2749134f},
-std::array<float,2>{0.725956619f, 0.525106788f},
-std::array<float,2>{0.0369820222f, 0.739308119f},
-std::array<float,2>{0.539307415f, 0.419774115f},
-std::array<float,2>{0.445070386f, 0.133397564f},
-std::array<float,2>{0.84832406f, 0.999360144f},
-std::array<float,2>{0.367664903f, 0.506124198f},
-std::array<float,2>{0.965656579f, 0.250734448f},
-std::array<float,2>{0.144035727f, 0.0126318401f},
-std::array<float,2>{0.699074626f, 0.78676939f},
-std::array<float,2>{0.0214399844f, 0.969700515f},
-std::array<float,2>{0.530919492f, 0.148827389f},
-std::array<float,2>{0.479898065f, 0.425773025f},
-std::array<float,2>{0.828681171f, 0.727443874f},
-std::array<float,2>{0.42296204f, 0.820977449f},
-std::array<float,2>{0.772956848f, 0.0944913253f},
-std::array<float,2>{0.0634066984f, 0.324391335f},
-std::array<float,2>{0.583128512f, 0.597733557f},
-std::array<float,2>{0.205011144f, 0.63511759f},
-std::array<float,2>{0.667910576f, 0.486751318f},
-std::array<float,2>{0.285007447f, 0.219014227f},
-std::array<float,2>{0.875448048f, 0.937344372f},
-std::array<float,2>{0.455221564f, 0.693040013f},
-std::array<float,2>{0.872848034f, 0.389793813f},
-std::array<float,2>{0.0570311025f, 0.182893068f},
-std::array<float,2>{0.553381741f, 0.938284039f},
-std::array<float,2>{0.162273645f, 0.761433065f},
-std::array<float,2>{0.736331701f, 0.0449817218f},
-std::array<float,2>{0.341335863f, 0.289922059f},
-std::array<float,2>{0.977765501f, 0.535260022f},
-std::array<float,2>{0.266383022f, 0.887743294f},
-std::array<float,2>{0.933619976f, 0.209769532f},
-std::array<float,2>{0.236645341f, 0.466619909f},
-std::array<float,2>{0.643501878f, 0.66291976f},
-std::array<float,2>{0.124703459f, 0.568826914f},
-std::array<float,2>{0.59839344f, 0.345625132f},
-std::array<float,2>{0.391123891f, 0.08307302f},
-std::array<float,2>{0.784082592f, 0.844354749f},
-std::array<float,2>{0.255789161f, 0.730582237f},
-std::array<float,2>{0.912401438f, 0.425950795f},
-std::array<float,2>{0.231842294f, 0.154376745f},
-std::array<float,2>{0.631724f, 0.972878695f},
-std::array<float,2>{0.0944043025f, 0.782132626f},
-std::array<float,2>{0.615432024f, 0.010544234f},
-std::array<float,2>{0.386028051f, 0.257400692f},
-std::array<float,2>{0.806327105f, 0.500514269f},
-std::array<float,2>{0.452855319f, 0.933220267f},
-std::array<float,2>{0.854583383f, 0.222839072f},
-std::array<float,2>{0.0447211489f, 0.489611179f},
-std::array<float,2>{0.53818208f, 0.638915002f},
-std::array<float,2>{0.172297776f, 0.596998036f},
-std::array<float,2>{0.726948023f, 0.321763724f},
-std::array<float,2>{0.323333859f, 0.0978831276f},
-std::array<float,2>{0.987569511f, 0.825637996f},
-std::array<float,2>{0.418544352f, 0.534890831f},
-std::array<float,2>{0.765360296f, 0.293173134f},
-std::array<float,2>{0.0923575908f, 0.0404504649f},
-std::array<float,2>{0.568847835f, 0.763712466f},
-std::array<float,2>{0.191224262f, 0.942301333f},
-std::array<float,2>{0.679511309f, 0.186891824f},
-std::array<float,2>{0.304979026f, 0.384441435f},
-std::array<float,2>{0.90003705f, 0.689465225f},
-std::array<float,2>{0.353263766f, 0.849666834f},
-std::array<float,2>{0.949842155f, 0.0795310959f},
-std::array<float,2>{0.130801126f, 0.350538462f},
-std::array<float,2>{0.704488039f, 0.563008785f},
-std::array<float,2>{0.00706765009f, 0.659754872f},
-std::array<float,2>{0.503071785f, 0.461053133f},
-std::array<float,2>{0.49095729f, 0.206943199f},
-std::array<float,2>{0.820673168f, 0.885369301f},
-std::array<float,2>{0.331837833f, 0.587326527f},
-std::array<float,2>{0.973364532f, 0.360259593f},
-std::array<float,2>{0.169024035f, 0.0646557584f},
-std::array<float,2>{0.745134473f, 0.870223463f},
-std::array<float,2>{0.0476270095f, 0.901467264f},
-std::array<float,2>{0.558269143f, 0.202538565f},
-std::array<float,2>{0.464513272f, 0.440261424f},
-std::array<float,2>{0.863099813f, 0.684485495f},
-std::array<float,2>{0.40304184f, 0.771418273f},
-std::array<float,2>{0.794978917f, 0.0505255908f},
-std::array<float,2>{0.110592507f, 0.307068557f},
-std::array<float,2>{0.601587355f, 0.550692916f},
-std::array<float,2>{0.24289149f, 0.716515601f},
-std::array<float,2>{0.653675973f, 0.392304033f},
-std::array<float,2>{0.278302848f, 0.164057299f},
-std::array<float,2>{0.924430013f, 0.961755574f},
-std::array<float,2>{0.47371304f, 0.646150708f},
-std::array<float,2>{0.837026894f, 0.479209065f},
-std::array<float,2>{0.0261989664f, 0.241495088f},
-std::array<float,2>{0.520207644f, 0.906811357f},
-std::array<float,2>{0.150365621f, 0.834848464f},
-std::array<float,2>{0.688299477f, 0.116109982f},
-std::array<float,2>{0.365376264f, 0.329482675f},
-std::array<float,2>{0.96068275f, 0.621669888f},
-std::array<float,2>{0.29021737f, 0.996066689f},
-std::array<float,2>{0.884086251f, 0.137955695f},
-std::array<float,2>{0.213844508f, 0.414536387f},
-std::array<float,2>{0.663232028f, 0.737850428f},
-std::array<float,2>{0.0708403587f, 0.528980434f},
-std::array<float,2>{0.591937959f, 0.279050142f},
-std::array<float,2>{0.43374759f, 0.0202520546f},
-std::array<float,2>{0.777597904f, 0.805684268f},
-std::array<float,2>{0.374155611f, 0.674586415f},
-std::array<float,2>{0.962993324f, 0.452655882f},
-std::array<float,2>{0.146875128f, 0.194454476f},
-std::array<float,2>{0.702929497f, 0.893233895f},
-std::array<float,2>{0.0181431193f, 0.863773048f},
-std::array<float,2>{0.526519895f, 0.0733891651f},
-std::array<float,2>{0.483183295f, 0.371578991f},
-std::array<float,2>{0.835434616f, 0.580230474f},
-std::array<float,2>{0.4267551f, 0.953882039f},
-std::array<float,2>{0.768683314f, 0.166200191f},
-std::array<float,2>{0.0665706545f, 0.404710948f},
-std::array<float,2>{0.58130151f, 0.706549287f},
-std::array<float,2>{0.207126215f, 0.55939585f},
-std::array<float,2>{0.66843152f, 0.304404229f},
-std::array<float,2>{0.286373556f, 0.057058759f},
-std::array<float,2>{0.88083142f, 0.776627958f},
-std::array<float,2>{0.458684415f, 0.615324438f},
-std::array<float,2>{0.867374361f, 0.337538093f},
-std::array<float,2>{0.0594115071f, 0.119036101f},
-std::array<float,2>{0.548296988f, 0.842765272f},
-std::array<float,2>{0.157835454f, 0.915780485f},
-std::array<float,2>{0.740947783f, 0.245557055f},
-std::array<float,2>{0.338360667f, 0.473763973f},
-std::array<float,2>{0.98093456f, 0.655087769f},
-std::array<float,2>{0.271704376f, 0.803100824f},
-std::array<float,2>{0.933161438f, 0.0247545466f},
-std::array<float,2>{0.239564911f, 0.267303944f},
-std::array<float,2>{0.645100951f, 0.518149912f},
-std::array<float,2>{0.120039292f, 0.748005092f},
-std::array<float,2>{0.596299529f, 0.413177848f},
-std::array<float,2>{0.396509737f, 0.129586354f},
-std::array<float,2>{0.787092209f, 0.987777293f},
-std::array<float,2>{0.29691717f, 0.508535862f},
-std::array<float,2>{0.897084117f, 0.258829355f},
-std::array<float,2>{0.19883275f, 0.0041181813f},
-std::array<float,2>{0.68316865f, 0.790671468f},
-std::array<float,2>{0.0816547126f, 0.982881963f},
-std::array<float,2>{0.572860897f, 0.142195359f},
-std::array<float,2>{0.407288134f, 0.430291921f},
-std::array<float,2>{0.755358636f, 0.725068033f},
-std::array<float,2>{0.49666521f, 0.815622985f},
-std::array<float,2>{0.817108154f, 0.109194987f},
-std::array<float,2>{0.00816363934f, 0.313394308f},
-std::array<float,2>{0.511187851f, 0.609053493f},
-std::array<float,2>{0.137089744f, 0.630336642f},
-std::array<float,2>{0.71496731f, 0.497778893f},
-std::array<float,2>{0.349901527f, 0.229407176f},
-std::array<float,2>{0.939207196f, 0.92686826f},
-std::array<float,2>{0.378314286f, 0.697888255f},
-std::array<float,2>{0.802719533f, 0.380879968f},
-std::array<float,2>{0.10437271f, 0.172174022f},
-std::array<float,2>{0.62016809f, 0.945885062f},
-std::array<float,2>{0.219970956f, 0.75090766f},
-std::array<float,2>{0.632922232f, 0.0325541198f},
-std::array<float,2>{0.261054516f, 0.283715338f},
-std::array<float,2>{0.918902099f, 0.545547843f},
-std::array<float,2>{0.316196412f, 0.880006552f},
-std::array<float,2>{0.999497652f, 0.216793239f},
-std::array<float,2>{0.181418225f, 0.45431307f},
-std::array<float,2>{0.71929884f, 0.671571732f},
-std::array<float,2>{0.034985967f, 0.57771945f},
-std::array<float,2>{0.544386506f, 0.354710877f},
-std::array<float,2>{0.438648641f, 0.0881557241f},
-std::array<float,2>{0.847613096f, 0.853148639f},
-std::array<float,2>{0.326082647f, 0.710263431f},
-std::array<float,2>{0.989749312f, 0.401179314f},
-std::array<float,2>{0.17811738f, 0.17161724f},
-std::array<float,2>{0.733778775f, 0.959553123f},
-std::array<float,2>{0.0394565053f, 0.779881895f},
-std::array<float,2>{0.533183455f, 0.0611535832f},
-std::array<float,2>{0.448575914f, 0.297338605f},
-std::array<float,2>{0.858894885f, 0.556514621f},
-std::array<float,2>{0.38753292f, 0.894888222f},
-std::array<float,2>{0.811269701f, 0.189889878f},
-std::array<float,2>{0.0993941203f, 0.446952581f},
-std::array<float,2>{0.612517297f, 0.677375376f},
-std::array<float,2>{0.22996892f, 0.58387202f},
-std::array<float,2>{0.627664447f, 0.370864093f},
-std::array<float,2>{0.25019452f, 0.0779063031f},
-std::array<float,2>{0.909604371f, 0.859909832f},
-std::array<float,2>{0.48701641f, 0.522979081f},
-std::array<float,2>{0.824540377f, 0.270925373f},
-std::array<float,2>{0.0012868857f, 0.0276422016f},
-std::array<float,2>{0.505414009f, 0.797248542f},
-std::array<float,2>{0.128204912f, 0.989300251f},
-std::array<float,2>{0.708706737f, 0.125559643f},
-std::array<float,2>{0.355715752f, 0.408460706f},
-std::array<float,2>{0.946450889f, 0.744606435f},
-std::array<float,2>{0.310510069f, 0.837085903f},
-std::array<float,2>{0.904019654f, 0.124633819f},
-std::array<float,2>{0.191947222f, 0.34250626f},
-std::array<float,2>{0.672846854f, 0.611077964f},
-std::array<float,2>{0.0871544331f, 0.651607394f},
-std::array<float,2>{0.562924743f, 0.470578402f},
-std::array<float,2>{0.414717972f, 0.249238327f},
-std::array<float,2>{0.759884f, 0.918766558f},
-std::array<float,2>{0.276353747f, 0.60491991f},
-std::array<float,2>{0.928551912f, 0.318828464f},
-std::array<float,2>{0.248317242f, 0.103455849f},
-std::array<float,2>{0.648946166f, 0.819409847f},
-std::array<float,2>{0.115370125f, 0.923026741f},
-std::array<float,2>{0.607544839f, 0.233540535f},
-std::array<float,2>{0.399199545f, 0.495759338f},
-std::array<float,2>{0.790130317f, 0.627574086f},
-std::array<float,2>{0.465640336f, 0.792969048f},
-std::array<float,2>{0.866772234f, 0.00285439938f},
-std::array<float,2>{0.0535512939f, 0.262391418f},
-std::array<float,2>{0.560584068f, 0.513929188f},
-std::array<float,2>{0.165009558f, 0.718784869f},
-std::array<float,2>{0.747956455f, 0.436321616f},
-std::array<float,2>{0.332283467f, 0.147521779f},
-std::array<float,2>{0.972205698f, 0.978207529f},
-std::array<float,2>{0.430544376f, 0.665862203f},
-std::array<float,2>{0.77358073f, 0.45979476f},
-std::array<float,2>{0.0774540827f, 0.211514264f},
-std::array<float,2>{0.586701751f, 0.877072811f},
-std::array<float,2>{0.216329768f, 0.85562259f},
-std::array<float,2>{0.656292021f, 0.0909561738f},
-std::array<float,2>{0.294997513f, 0.357653648f},
-std::array<float,2>{0.890217245f, 0.570914924f},
-std::array<float,2>{0.36293298f, 0.952844739f},
-std::array<float,2>{0.956377327f, 0.179223016f},
-std::array<float,2>{0.152817741f, 0.378209054f},
-std::array<float,2>{0.694512308f, 0.7030164f},
-std::array<float,2>{0.0289107207f, 0.541012883f},
-std::array<float,2>{0.516792238f, 0.285924345f},
-std::array<float,2>{0.470087022f, 0.038931869f},
-std::array<float,2>{0.841485441f, 0.757599413f},
-std::array<float,2>{0.283236802f, 0.634604037f},
-std::array<float,2>{0.876572073f, 0.485929161f},
-std::array<float,2>{0.20373787f, 0.22175996f},
-std::array<float,2>{0.666288078f, 0.934802413f},
-std::array<float,2>{0.064161554f, 0.822810113f},
-std::array<float,2>{0.582692146f, 0.0969648585f},
-std::array<float,2>{0.422604889f, 0.326414675f},
-std::array<float,2>{0.772146344f, 0.600323856f},
-std::array<float,2>{0.479357868f, 0.972357333f},
-std::array<float,2>{0.829383612f, 0.15205206f},
-std::array<float,2>{0.020099353f, 0.422430933f},
-std::array<float,2>{0.529424071f, 0.730080545f},
-std::array<float,2>{0.143194959f, 0.5050565f},
-std::array<float,2>{0.697419763f, 0.252578646f},
-std::array<float,2>{0.368671268f, 0.0146124121f},
-std::array<float,2>{0.965879142f, 0.787583768f},
-std::array<float,2>{0.392557144f, 0.568346262f},
-std::array<float,2>{0.784944832f, 0.347026438f},
-std::array<float,2>{0.123823576f, 0.0851466358f},
-std::array<float,2>{0.599061906f, 0.846014917f},
-std::array<float,2>{0.237884521f, 0.889201581f},
-std::array<float,2>{0.64382422f, 0.20748578f},
-std::array<float,2>{0.266767919f, 0.468094528f},
-std::array<float,2>{0.934991896f, 0.660180211f},
-std::array<float,2>{0.340592116f, 0.757969499f},
-std::array<float,2>{0.976609349f, 0.0434920862f},
-std::array<float,2>{0.163748339f, 0.292431504f},
-std::array<float,2>{0.737533927f, 0.538422227f},
-std::array<float,2>{0.0578486212f, 0.694127679f},
-std::array<float,2>{0.554418564f, 0.387309492f},
-std::array<float,2>{0.456972271f, 0.181184605f},
-std::array<float,2>{0.871962368f, 0.940475523f},
-std::array<float,2>{0.346503139f, 0.552780688f},
-std::array<float,2>{0.942302823f, 0.31225878f},
-std::array<float,2>{0.13495177f, 0.0533464216f},
-std::array<float,2>{0.71236217f, 0.767063916f},
-std::array<float,2>{0.0136021394f, 0.968548954f},
-std::array<float,2>{0.513750374f, 0.159202486f},
-std::array<float,2>{0.493690044f, 0.39538303f},
-std::array<float,2>{0.814465523f, 0.714194715f},
-std::array<float,2>{0.411307991f, 0.872064054f},
-std::array<float,2>{0.750917852f, 0.0691635758f},
-std::array<float,2>{0.0840810314f, 0.366794884f},
-std::array<float,2>{0.576732874f, 0.59119153f},
-std::array<float,2>{0.200524092f, 0.68074429f},
-std::array<float,2>{0.686249673f, 0.441651821f},
-std::array<float,2>{0.302165568f, 0.197141543f},
-std::array<float,2>{0.892927706f, 0.904295981f},
-std::array<float,2>{0.444235861f, 0.740970731f},
-std::array<float,2>{0.84875226f, 0.420046329f},
-std::array<float,2>{0.0357034765f, 0.135798261f},
-std::array<float,2>{0.540626287f, 0.997504413f},
-std::array<float,2>{0.18592377f, 0.809003353f},
-std::array<float,2>{0.725347281f, 0.0180705078f},
-std::array<float,2>{0.318669051f, 0.275780231f},
-std::array<float,2>{0.992297232f, 0.526100814f},
-std::array<float,2>{0.262779295f, 0.910325289f},
-std::array<float,2>{0.914341092f, 0.235043257f},
-std::array<float,2>{0.225066766f, 0.481528401f},
-std::array<float,2>{0.640255511f, 0.643497169f},
-std::array<float,2>{0.108606376f, 0.620513499f},
-std::array<float,2>{0.621892154f, 0.332288116f},
-std::array<float,2>{0.379650831f, 0.112626739f},
-std::array<float,2>{0.797071457f, 0.829538047f},
-std::array<float,2>{0.306985855f, 0.688082039f},
-std::array<float,2>{0.901962101f, 0.385982484f},
-std::array<float,2>{0.189076304f, 0.183830172f},
-std::array<float,2>{0.676812291f, 0.944009781f},
-std::array<float,2>{0.0910986289f, 0.76181072f},
-std::array<float,2>{0.567642152f, 0.0415163152f},
-std::array<float,2>{0.420702934f, 0.29543516f},
-std::array<float,2>{0.763665557f, 0.532048583f},
-std::array<float,2>{0.488683075f, 0.882955492f},
-std::array<float,2>{0.822885454f, 0.204888403f},
-std::array<float,2>{0.0046993196f, 0.463874042f},
-std::array<float,2>{0.501590192f, 0.657597899f},
-std::array<float,2>{0.132743329f, 0.565268397f},
-std::array<float,2>{0.705428898f, 0.34874779f},
-std::array<float,2>{0.353746742f, 0.0807352588f},
-std::array<float,2>{0.951547384f, 0.848550022f},
-std::array<float,2>{0.38470453f, 0.50376308f},
-std::array<float,2>{0.807072282f, 0.254545599f},
-std::array<float,2>{0.0957925841f, 0.00809596665f},
-std::array<float,2>{0.613538861f, 0.784879565f},
-std::array<float,2>{0.234235197f, 0.976240396f},
-std::array<float,2>{0.630836129f, 0.152938783f},
-std::array<float,2>{0.257232249f, 0.428502887f},
-std::array<float,2>{0.910597026f, 0.733013988f},
-std::array<float,2>{0.321961761f, 0.826216578f},
-std::array<float,2>{0.984677613f, 0.10061492f},
-std::array<float,2>{0.174897864f, 0.323375672f},
-std::array<float,2>{0.728909791f, 0.594608724f},
-std::array<float,2>{0.0453531034f, 0.638060451f},
-std::array<float,2>{0.536466122f, 0.491469771f},
-std::array<float,2>{0.449302882f, 0.226514831f},
-std::array<float,2>{0.853157401f, 0.930578172f},
-std::array<float,2>{0.364591449f, 0.624459863f},
-std::array<float,2>{0.957869053f, 0.331462651f},
-std::array<float,2>{0.15132001f, 0.114536315f},
-std::array<float,2>{0.690124571f, 0.832934082f},
-std::array<float,2>{0.0240102019f, 0.909873068f},
-std::array<float,2>{0.521930039f, 0.23876369f},
-std::array<float,2>{0.475041986f, 0.476841122f},
-std::array<float,2>{0.839493632f, 0.648005188f},
-std::array<float,2>{0.436122417f, 0.806982338f},
-std::array<float,2>{0.781039238f, 0.0217082705f},
-std::array<float,2>{0.0728276968f, 0.279866874f},
-std::array<float,2>{0.591729522f, 0.529531896f},
-std::array<float,2>{0.212835759f, 0.736092508f},
-std::array<float,2>{0.662034869f, 0.416465849f},
-std::array<float,2>{0.292340219f, 0.139118195f},
-std::array<float,2>{0.884998739f, 0.993400931f},
-std::array<float,2>{0.461271435f, 0.687260151f},
-std::array<float,2>{0.860237122f, 0.439189225f},
-std::array<float,2>{0.0488906503f, 0.200513124f},
-std::array<float,2>{0.555956423f, 0.899746001f},
-std::array<float,2>{0.171517551f, 0.868051827f},
-std::array<float,2>{0.74309212f, 0.0633415729f},
-std::array<float,2>{0.329663843f, 0.362643361f},
-std::array<float,2>{0.976403832f, 0.589455366f},
-std::array<float,2>{0.280451566f, 0.964740694f},
-std::array<float,2>{0.922795117f, 0.16164431f},
-std::array<float,2>{0.245588407f, 0.394052774f},
-std::array<float,2>{0.655733407f, 0.718602896f},
-std::array<float,2>{0.111903124f, 0.54848361f},
-std::array<float,2>{0.605143964f, 0.306160957f},
-std::array<float,2>{0.405105084f, 0.0474475883f},
-std::array<float,2>{0.793896437f, 0.772556782f},
-std::array<float,2>{0.33771643f, 0.654001772f},
-std::array<float,2>{0.983191013f, 0.474978954f},
-std::array<float,2>{0.159916833f, 0.242546618f},
-std::array<float,2>{0.73878485f, 0.917126179f},
-std::array<float,2>{0.0608669594f, 0.841344535f},
-std::array<float,2>{0.549789846f, 0.119741179f},
-std::array<float,2>{0.460927665f, 0.338702768f},
-std::array<float,2>{0.870876491f, 0.615078449f},
-std::array<float,2>{0.395991206f, 0.984838426f},
-std::array<float,2>{0.787616313f, 0.132125258f},
-std::array<float,2>{0.11719393f, 0.411975026f},
-std::array<float,2>{0.594813168f, 0.749903202f},
-std::array<float,2>{0.242118835f, 0.515745223f},
-std::array<float,2>{0.64654839f, 0.268669426f},
-std::array<float,2>{0.271214336f, 0.0269716755f},
-std::array<float,2>{0.93100065f, 0.800905526f},
-std::array<float,2>{0.481732011f, 0.578344882f},
-std::array<float,2>{0.833367348f, 0.374936163f},
-std::array<float,2>{0.0159481708f, 0.0703461543f},
-std::array<float,2>{0.524040341f, 0.867001414f},
-std::array<float,2>{0.144905552f, 0.89170748f},
-std::array<float,2>{0.699738324f, 0.191744223f},
-std::array<float,2>{0.37157017f, 0.449352503f},
-std::array<float,2>{0.961205363f, 0.673179686f},
-std::array<float,2>{0.288720995f, 0.775269389f},
-std::array<float,2>{0.882103264f, 0.0565211698f},
-std::array<float,2>{0.209543407f, 0.301592022f},
-std::array<float,2>{0.670038342f, 0.561386704f},
-std::array<float,2>{0.0686063617f, 0.704177499f},
-std::array<float,2>{0.579367876f, 0.403792322f},
-std::array<float,2>{0.429564208f, 0.164675772f},
-std::array<float,2>{0.766865373f, 0.956659973f},
-std::array<float,2>{0.258025259f, 0.543282807f},
-std::array<float,2>{0.921097875f, 0.282186776f},
-std::array<float,2>{0.22225374f, 0.0348613299f},
-std::array<float,2>{0.63518554f, 0.752290666f},
-std::array<float,2>{0.101941153f, 0.948885083f},
-std::array<float,2>{0.618425071f, 0.174598649f},
-std::array<float,2>{0.375451952f, 0.38000682f},
-std::array<float,2>{0.803631365f, 0.696480095f},
-std::array<float,2>{0.440587968f, 0.854746163f},
-std::array<float,2>{0.845042467f, 0.0863964409f},
-std::array<float,2>{0.0314981602f, 0.353279412f},
-std::array<float,2>{0.545054495f, 0.575311303f},
-std::array<float,2>{0.182122767f, 0.66804558f},
-std::array<float,2>{0.722218812f, 0.456417948f},
-std::array<float,2>{0.312530816f, 0.218378767f},
-std::array<float,2>{0.996554732f, 0.882736027f},
-std::array<float,2>{0.409805208f, 0.723563492f},
-std::array<float,2>{0.755879104f, 0.432223797f},
-std::array<float,2>{0.0782433972f, 0.143072322f},
-std::array<float,2>{0.570862412f, 0.982321084f},
-std::array<float,2>{0.195830911f, 0.792763054f},
-std::array<float,2>{0.680465043f, 0.00670032483f},
-std::array<float,2>{0.29904297f, 0.261522621f},
-std::array<float,2>{0.895088673f, 0.510734618f},
-std::array<float,2>{0.348242074f, 0.928577781f},
-std::array<float,2>{0.941369593f, 0.227374062f},
-std::array<float,2>{0.139849558f, 0.498112857f},
-std::array<float,2>{0.718418658f, 0.631940544f},
-std::array<float,2>{0.0106655331f, 0.606194973f},
-std::array<float,2>{0.508681834f, 0.31607303f},
-std::array<float,2>{0.498724818f, 0.106830031f},
-std::array<float,2>{0.819356203f, 0.813637197f},
-std::array<float,2>{0.358194739f, 0.743601501f},
-std::array<float,2>{0.947867453f, 0.406895101f},
-std::array<float,2>{0.125580311f, 0.127989039f},
-std::array<float,2>{0.710355401f, 0.990974426f},
-std::array<float,2>{0.00201715273f, 0.800578415f},
-std::array<float,2>{0.507422447f, 0.0305344183f},
-std::array<float,2>{0.484712511f, 0.271501988f},
-std::array<float,2>{0.827098489f, 0.520451427f},
-std::array<float,2>{0.417688906f, 0.921328843f},
-std::array<float,2>{0.75843358f, 0.246882245f},
-std::array<float,2>{0.088635169f, 0.47084251f},
-std::array<float,2>{0.564600646f, 0.649426043f},
-std::array<float,2>{0.195254579f, 0.612377822f},
-std::array<float,2>{0.674138546f, 0.341763973f},
-std::array<float,2>{0.31245926f, 0.12277092f},
-std::array<float,2>{0.904711902f, 0.838992f},
-std::array<float,2>{0.446552992f, 0.556658089f},
-std::array<float,2>{0.856665611f, 0.299370676f},
-std::array<float,2>{0.0421219803f, 0.0593240447f},
-std::array<float,2>{0.533259332f, 0.778348029f},
-std::array<float,2>{0.177148968f, 0.957441926f},
-std::array<float,2>{0.732417107f, 0.16932562f},
-std::array<float,2>{0.327949017f, 0.400377363f},
-std::array<float,2>{0.991745055f, 0.707932353f},
-std::array<float,2>{0.253509372f, 0.862748623f},
-std::array<float,2>{0.906349301f, 0.0758157969f},
-std::array<float,2>{0.227758646f, 0.367221385f},
-std::array<float,2>{0.626927614f, 0.585238218f},
-std::array<float,2>{0.100830846f, 0.678871989f},
-std::array<float,2>{0.609930575f, 0.447388619f},
-std::array<float,2>{0.388870567f, 0.188892752f},
-std::array<float,2>{0.809879243f, 0.896644771f},
-std::array<float,2>{0.294052243f, 0.57369411f},
-std::array<float,2>{0.886856735f, 0.357181638f},
-std::array<float,2>{0.217223302f, 0.0920975655f},
-std::array<float,2>{0.658204854f, 0.858649135f},
-std::array<float,2>{0.0746170729f, 0.875637352f},
-std::array<float,2>{0.588132262f, 0.214812964f},
-std::array<float,2>{0.432895303f, 0.457227349f},
-std::array<float,2>{0.776495218f, 0.666157782f},
-std::array<float,2>{0.471141815f, 0.754219055f},
-std::array<float,2>{0.842587471f, 0.0366484486f},
-std::array<float,2>{0.0302615259f, 0.287220061f},
-std::array<float,2>{0.519262731f, 0.541408062f},
-std::array<float,2>{0.154715225f, 0.701136053f},
-std::array<float,2>{0.692473412f, 0.375191152f},
-std::array<float,2>{0.360535175f, 0.17705974f},
-std::array<float,2>{0.954881728f, 0.950368464f},
-std::array<float,2>{0.401466429f, 0.625983119f},
-std::array<float,2>{0.792206407f, 0.492371082f},
-std::array<float,2>{0.113806613f, 0.232203454f},
-std::array<float,2>{0.607299089f, 0.924819171f},
-std::array<float,2>{0.246855989f, 0.817673743f},
-std::array<float,2>{0.651167095f, 0.103939965f},
-std::array<float,2>{0.274640709f, 0.317189604f},
-std::array<float,2>{0.927005768f, 0.601756811f},
-std::array<float,2>{0.334026068f, 0.979829371f},
-std::array<float,2>{0.970039129f, 0.145075575f},
-std::array<float,2>{0.167335317f, 0.435457647f},
-std::array<float,2>{0.74835217f, 0.721210957f},
-std::array<float,2>{0.0513805635f, 0.513516366f},
-std::array<float,2>{0.559225976f, 0.264291793f},
-std::array<float,2>{0.468194127f, 0.000115412025f},
-std::array<float,2>{0.863969207f, 0.796225488f},
-std::array<float,2>{0.268457055f, 0.663339436f},
-std::array<float,2>{0.93713665f, 0.464990675f},
-std::array<float,2>{0.236102507f, 0.210161656f},
-std::array<float,2>{0.6420542f, 0.887066603f},
-std::array<float,2>{0.122337855f, 0.845352948f},
-std::array<float,2>{0.599923849f, 0.0820638686f},
-std::array<float,2>{0.392992735f, 0.343753368f},
-std::array<float,2>{0.782527089f, 0.570242226f},
-std::array<float,2>{0.454951137f, 0.939359188f},
-std::array<float,2>{0.874218225f, 0.182528138f},
-std::array<float,2>{0.0563534722f, 0.389141381f},
-std::array<float,2>{0.551036835f, 0.691982269f},
-std::array<float,2>{0.161778927f, 0.536636949f},
-std::array<float,2>{0.734958708f, 0.290640742f},
-std::array<float,2>{0.343179882f, 0.0468726009f},
-std::array<float,2>{0.978832245f, 0.759766817f},
-std::array<float,2>{0.425572515f, 0.599020779f},
-std::array<float,2>{0.769535542f, 0.325670898f},
-std::array<float,2>{0.0649198517f, 0.0956205279f},
-std::array<float,2>{0.58498162f, 0.822080433f},
-std::array<float,2>{0.206512704f, 0.935783923f},
-std::array<float,2>{0.664464593f, 0.220562071f},
-std::array<float,2>{0.282172829f, 0.487756014f},
-std::array<float,2>{0.877011776f, 0.636104822f},
-std::array<float,2>{0.371015757f, 0.785170138f},
-std::array<float,2>{0.968398213f, 0.0135427471f},
-std::array<float,2>{0.140821099f, 0.251094997f},
-std::array<float,2>{0.696253777f, 0.507008195f},
-std::array<float,2>{0.023121275f, 0.727917373f},
-std::array<float,2>{0.528938055f, 0.424320817f},
-std::array<float,2>{0.477418453f, 0.150172934f},
-std::array<float,2>{0.83099407f, 0.970373392f},
-std::array<float,2>{0.317938119f, 0.523513734f},
-std::array<float,2>{0.99441123f, 0.274398446f},
-std::array<float,2>{0.183824286f, 0.0165532492f},
-std::array<float,2>{0.724512637f, 0.810885906f},
-std::array<float,2>{0.0384828113f, 0.998108566f},
-std::array<float,2>{0.541366637f, 0.134151682f},
-std::array<float,2>{0.443187088f, 0.418156534f},
-std::array<float,2>{0.851164281f, 0.738642812f},
-std::array<float,2>{0.381489187f, 0.830492854f},
-std::array<float,2>{0.7992208f, 0.11088641f},
-std::array<float,2>{0.106484853f, 0.335603535f},
-std::array<float,2>{0.623058975f, 0.61816448f},
-std::array<float,2>{0.223208189f, 0.641610622f},
-std::array<float,2>{0.638088644f, 0.48258844f},
-std::array<float,2>{0.26556623f, 0.237543568f},
-std::array<float,2>{0.916345537f, 0.912274718f},
-std::array<float,2>{0.495972723f, 0.710998833f},
-std::array<float,2>{0.814042568f, 0.397553116f},
-std::array<float,2>{0.0143593047f, 0.156843126f},
-std::array<float,2>{0.512882233f, 0.966234505f},
-std::array<float,2>{0.13432321f, 0.769405663f},
-std::array<float,2>{0.713864088f, 0.0509416573f},
-std::array<float,2>{0.344300151f, 0.308835506f},
-std::array<float,2>{0.944277883f, 0.552292883f},
-std::array<float,2>{0.304286838f, 0.905768931f},
-std::array<float,2>{0.890647352f, 0.198567182f},
-std::array<float,2>{0.202170283f, 0.443772674f},
-std::array<float,2>{0.684498131f, 0.682955265f},
-std::array<float,2>{0.082249552f, 0.593380094f},
-std::array<float,2>{0.575138867f, 0.363722891f},
-std::array<float,2>{0.413941979f, 0.0676987693f},
-std::array<float,2>{0.753014088f, 0.873868287f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.446014911f, 0.18929635f},
-std::array<float,2>{0.941453695f, 0.938708901f},
-std::array<float,2>{0.00502683828f, 0.611623824f},
-std::array<float,2>{0.716508806f, 0.428707331f},
-std::array<float,2>{0.192843601f, 0.253411382f},
-std::array<float,2>{0.538114309f, 0.739970446f},
-std::array<float,2>{0.270555973f, 0.849767864f},
-std::array<float,2>{0.852416694f, 0.0221756119f},
-std::array<float,2>{0.336624682f, 0.493024498f},
-std::array<float,2>{0.807042956f, 0.547652781f},
-std::array<float,2>{0.161176294f, 0.900894046f},
-std::array<float,2>{0.565434992f, 0.178678051f},
-std::array<float,2>{0.0655862391f, 0.107208222f},
-std::array<float,2>{0.659097731f, 0.789295375f},
-std::array<float,2>{0.435016781f, 0.669966221f},
-std::array<float,2>{0.927625716f, 0.335655123f},
-std::array<float,2>{0.30057022f, 0.0360882021f},
-std::array<float,2>{0.821896136f, 0.836361349f},
-std::array<float,2>{0.249071524f, 0.692150295f},
-std::array<float,2>{0.527590871f, 0.292221248f},
-std::array<float,2>{0.0537372753f, 0.392376661f},
-std::array<float,2>{0.723084748f, 0.571921706f},
-std::array<float,2>{0.473715186f, 0.985162258f},
-std::array<float,2>{0.97410959f, 0.224647745f},
-std::array<float,2>{0.383572161f, 0.370844781f},
-std::array<float,2>{0.887253642f, 0.647417367f},
-std::array<float,2>{0.0962669104f, 0.757060707f},
-std::array<float,2>{0.655288339f, 0.0630378723f},
-std::array<float,2>{0.15544194f, 0.137828395f},
-std::array<float,2>{0.60430795f, 0.935600281f},
-std::array<float,2>{0.357850283f, 0.516791344f},
-std::array<float,2>{0.760967076f, 0.438489318f},
-std::array<float,2>{0.409199983f, 0.0882015526f},
-std::array<float,2>{0.911820412f, 0.772592247f},
-std::array<float,2>{0.0896996483f, 0.633943379f},
-std::array<float,2>{0.675914407f, 0.357501626f},
-std::array<float,2>{0.178592667f, 0.457238972f},
-std::array<float,2>{0.590851843f, 0.500242352f},
-std::array<float,2>{0.312902182f, 0.920905769f},
-std::array<float,2>{0.793553233f, 0.154701248f},
-std::array<float,2>{0.255933791f, 0.303515941f},
-std::array<float,2>{0.869929731f, 0.718326867f},
-std::array<float,2>{0.212921977f, 0.815782607f},
-std::array<float,2>{0.559962034f, 0.0531709567f},
-std::array<float,2>{0.0186733548f, 0.235304013f},
-std::array<float,2>{0.690993011f, 0.972342968f},
-std::array<float,2>{0.466639042f, 0.585233629f},
-std::array<float,2>{0.958817899f, 0.387912303f},
-std::array<float,2>{0.369850934f, 0.157202706f},
-std::array<float,2>{0.776302278f, 0.883969724f},
-std::array<float,2>{0.134690106f, 0.544109643f},
-std::array<float,2>{0.624487102f, 0.472043395f},
-std::array<float,2>{0.109715931f, 0.321606427f},
-std::array<float,2>{0.635050356f, 0.673430145f},
-std::array<float,2>{0.392737687f, 0.802980602f},
-std::array<float,2>{0.899703741f, 0.117791906f},
-std::array<float,2>{0.496584952f, 0.415221244f},
-std::array<float,2>{0.99511677f, 0.607137024f},
-std::array<float,2>{0.0420336537f, 0.967936516f},
-std::array<float,2>{0.738172054f, 0.217215613f},
-std::array<float,2>{0.232705906f, 0.00316227251f},
-std::array<float,2>{0.511452973f, 0.865249932f},
-std::array<float,2>{0.296328038f, 0.72144556f},
-std::array<float,2>{0.836003363f, 0.267955601f},
-std::array<float,2>{0.398829818f, 0.143602148f},
-std::array<float,2>{0.895172954f, 0.909805179f},
-std::array<float,2>{0.124559052f, 0.513300419f},
-std::array<float,2>{0.629069984f, 0.466325879f},
-std::array<float,2>{0.129394338f, 0.345658094f},
-std::array<float,2>{0.615973413f, 0.630762756f},
-std::array<float,2>{0.364410907f, 0.775826395f},
-std::array<float,2>{0.770769179f, 0.0811016709f},
-std::array<float,2>{0.285600454f, 0.380697757f},
-std::array<float,2>{0.831384599f, 0.589466691f},
-std::array<float,2>{0.223261684f, 0.982932687f},
-std::array<float,2>{0.506026924f, 0.244067058f},
-std::array<float,2>{0.0362262949f, 0.0587963574f},
-std::array<float,2>{0.747957468f, 0.82520324f},
-std::array<float,2>{0.489135683f, 0.704893053f},
-std::array<float,2>{0.987858891f, 0.309495926f},
-std::array<float,2>{0.327013344f, 0.114094682f},
-std::array<float,2>{0.786426723f, 0.809827149f},
-std::array<float,2>{0.179871693f, 0.682661474f},
-std::array<float,2>{0.580176651f, 0.31917119f},
-std::array<float,2>{0.0817212686f, 0.480728894f},
-std::array<float,2>{0.682129323f, 0.532848835f},
-std::array<float,2>{0.415077209f, 0.878904939f},
-std::array<float,2>{0.919190466f, 0.165271878f},
-std::array<float,2>{0.454224825f, 0.274890751f},
-std::array<float,2>{0.965072036f, 0.734185219f},
-std::array<float,2>{0.0307805818f, 0.868682683f},
-std::array<float,2>{0.69668746f, 0.0134504214f},
-std::array<float,2>{0.210787445f, 0.210516527f},
-std::array<float,2>{0.548343897f, 0.956743598f},
-std::array<float,2>{0.260755718f, 0.60083133f},
-std::array<float,2>{0.860033095f, 0.406863928f},
-std::array<float,2>{0.478789479f, 0.0258188955f},
-std::array<float,2>{0.978802264f, 0.85466361f},
-std::array<float,2>{0.0581005104f, 0.749950945f},
-std::array<float,2>{0.729872704f, 0.260318458f},
-std::array<float,2>{0.238711417f, 0.436086923f},
-std::array<float,2>{0.516263545f, 0.620777309f},
-std::array<float,2>{0.306724876f, 0.948718369f},
-std::array<float,2>{0.820124507f, 0.202121541f},
-std::array<float,2>{0.344911218f, 0.341149062f},
-std::array<float,2>{0.75037092f, 0.658263326f},
-std::array<float,2>{0.143251047f, 0.782605052f},
-std::array<float,2>{0.597506166f, 0.100121066f},
-std::array<float,2>{0.102788582f, 0.187191546f},
-std::array<float,2>{0.642610908f, 0.894409001f},
-std::array<float,2>{0.375892997f, 0.555478275f},
-std::array<float,2>{0.877297938f, 0.488732874f},
-std::array<float,2>{0.277421266f, 0.227364942f},
-std::array<float,2>{0.847048283f, 0.997579336f},
-std::array<float,2>{0.197347179f, 0.569223285f},
-std::array<float,2>{0.545443714f, 0.400206476f},
-std::array<float,2>{0.0101143466f, 0.284845442f},
-std::array<float,2>{0.704258084f, 0.701232612f},
-std::array<float,2>{0.441863567f, 0.832627714f},
-std::array<float,2>{0.951348484f, 0.0450118892f},
-std::array<float,2>{0.426079899f, 0.452584684f},
-std::array<float,2>{0.930198431f, 0.524249256f},
-std::array<float,2>{0.0769430026f, 0.925528049f},
-std::array<float,2>{0.668743074f, 0.127457663f},
-std::array<float,2>{0.169507951f, 0.0708289221f},
-std::array<float,2>{0.572459638f, 0.761319935f},
-std::array<float,2>{0.333229393f, 0.649666548f},
-std::array<float,2>{0.803989947f, 0.367041767f},
-std::array<float,2>{0.431781948f, 0.246107087f},
-std::array<float,2>{0.924640477f, 0.978080392f},
-std::array<float,2>{0.0671899021f, 0.59182477f},
-std::array<float,2>{0.663969815f, 0.376944691f},
-std::array<float,2>{0.159059346f, 0.306020766f},
-std::array<float,2>{0.567762911f, 0.708124638f},
-std::array<float,2>{0.342868447f, 0.822990835f},
-std::array<float,2>{0.808930874f, 0.0578149557f},
-std::array<float,2>{0.265658826f, 0.462411284f},
-std::array<float,2>{0.855640054f, 0.509589195f},
-std::array<float,2>{0.187652469f, 0.913121283f},
-std::array<float,2>{0.532496512f, 0.148361415f},
-std::array<float,2>{0.00124008453f, 0.0840298459f},
-std::array<float,2>{0.713807881f, 0.780309618f},
-std::array<float,2>{0.449671f, 0.62604934f},
-std::array<float,2>{0.940101743f, 0.350972742f},
-std::array<float,2>{0.351971209f, 0.0116082337f},
-std::array<float,2>{0.762960196f, 0.873072624f},
-std::array<float,2>{0.150952637f, 0.728219271f},
-std::array<float,2>{0.60627079f, 0.27923578f},
-std::array<float,2>{0.0996765867f, 0.411185741f},
-std::array<float,2>{0.649578929f, 0.59659034f},
-std::array<float,2>{0.388708681f, 0.958321035f},
-std::array<float,2>{0.885378242f, 0.203555301f},
-std::array<float,2>{0.46916011f, 0.313321054f},
-std::array<float,2>{0.970757961f, 0.687357664f},
-std::array<float,2>{0.050180912f, 0.80754441f},
-std::array<float,2>{0.721782506f, 0.110113151f},
-std::array<float,2>{0.244609058f, 0.171068668f},
-std::array<float,2>{0.526492894f, 0.879268169f},
-std::array<float,2>{0.303070188f, 0.536286056f},
-std::array<float,2>{0.825456083f, 0.479790568f},
-std::array<float,2>{0.461976051f, 0.0963997841f},
-std::array<float,2>{0.954334617f, 0.788448572f},
-std::array<float,2>{0.0197757985f, 0.662271559f},
-std::array<float,2>{0.691756368f, 0.337603778f},
-std::array<float,2>{0.217425853f, 0.484472483f},
-std::array<float,2>{0.555806935f, 0.561544359f},
-std::array<float,2>{0.252809078f, 0.895696998f},
-std::array<float,2>{0.873412132f, 0.182341501f},
-std::array<float,2>{0.31897682f, 0.264977485f},
-std::array<float,2>{0.792882323f, 0.745093882f},
-std::array<float,2>{0.174469188f, 0.856094182f},
-std::array<float,2>{0.589310825f, 0.0290593952f},
-std::array<float,2>{0.0923628062f, 0.195693269f},
-std::array<float,2>{0.672016978f, 0.950713754f},
-std::array<float,2>{0.413234621f, 0.621392071f},
-std::array<float,2>{0.908994973f, 0.430109441f},
-std::array<float,2>{0.29178825f, 0.129929125f},
-std::array<float,2>{0.842943013f, 0.928655803f},
-std::array<float,2>{0.227375552f, 0.529643416f},
-std::array<float,2>{0.513511121f, 0.447503954f},
-std::array<float,2>{0.0462163128f, 0.362534553f},
-std::array<float,2>{0.741394162f, 0.6545344f},
-std::array<float,2>{0.494686991f, 0.763036549f},
-std::array<float,2>{0.998986661f, 0.0769289955f},
-std::array<float,2>{0.396039039f, 0.405390024f},
-std::array<float,2>{0.904206812f, 0.563615501f},
-std::array<float,2>{0.115244702f, 0.994169474f},
-std::array<float,2>{0.640274882f, 0.232070848f},
-std::array<float,2>{0.137183428f, 0.0405790582f},
-std::array<float,2>{0.618988395f, 0.829369605f},
-std::array<float,2>{0.37258935f, 0.695910275f},
-std::array<float,2>{0.781080484f, 0.288315445f},
-std::array<float,2>{0.487659723f, 0.174136937f},
-std::array<float,2>{0.992172837f, 0.905138612f},
-std::array<float,2>{0.0321967341f, 0.551724315f},
-std::array<float,2>{0.742263913f, 0.49770388f},
-std::array<float,2>{0.221393719f, 0.329332083f},
-std::array<float,2>{0.503071368f, 0.666895866f},
-std::array<float,2>{0.282568663f, 0.795544922f},
-std::array<float,2>{0.832670093f, 0.101648994f},
-std::array<float,2>{0.361568272f, 0.423961103f},
-std::array<float,2>{0.765745401f, 0.615981102f},
-std::array<float,2>{0.127284899f, 0.943956017f},
-std::array<float,2>{0.61321795f, 0.19263728f},
-std::array<float,2>{0.117724352f, 0.0169562846f},
-std::array<float,2>{0.627613246f, 0.847048998f},
-std::array<float,2>{0.402560741f, 0.737786174f},
-std::array<float,2>{0.894105315f, 0.255619973f},
-std::array<float,2>{0.261739075f, 0.0672142953f},
-std::array<float,2>{0.864708781f, 0.75094074f},
-std::array<float,2>{0.204126045f, 0.642637908f},
-std::array<float,2>{0.552315831f, 0.372139156f},
-std::array<float,2>{0.0241512358f, 0.44434616f},
-std::array<float,2>{0.700722694f, 0.521966338f},
-std::array<float,2>{0.45893994f, 0.930386782f},
-std::array<float,2>{0.962569892f, 0.133711994f},
-std::array<float,2>{0.420187026f, 0.293479353f},
-std::array<float,2>{0.914818406f, 0.691394627f},
-std::array<float,2>{0.0830737799f, 0.84010762f},
-std::array<float,2>{0.68535012f, 0.0339668915f},
-std::array<float,2>{0.185812011f, 0.222109497f},
-std::array<float,2>{0.583102643f, 0.990256786f},
-std::array<float,2>{0.323949993f, 0.574339271f},
-std::array<float,2>{0.784652591f, 0.395839751f},
-std::array<float,2>{0.379100055f, 0.0486562401f},
-std::array<float,2>{0.880062282f, 0.818741739f},
-std::array<float,2>{0.108262405f, 0.711601615f},
-std::array<float,2>{0.64734292f, 0.298067927f},
-std::array<float,2>{0.145567819f, 0.386201888f},
-std::array<float,2>{0.599914968f, 0.578362703f},
-std::array<float,2>{0.349170923f, 0.976185203f},
-std::array<float,2>{0.75462234f, 0.241162851f},
-std::array<float,2>{0.310835302f, 0.353303492f},
-std::array<float,2>{0.814240336f, 0.636984706f},
-std::array<float,2>{0.238025829f, 0.766972482f},
-std::array<float,2>{0.523358583f, 0.0923731476f},
-std::array<float,2>{0.0608974174f, 0.151584789f},
-std::array<float,2>{0.733379841f, 0.915789783f},
-std::array<float,2>{0.481408775f, 0.504687786f},
-std::array<float,2>{0.981151581f, 0.455888718f},
-std::array<float,2>{0.329478621f, 0.213588491f},
-std::array<float,2>{0.79930377f, 0.96174705f},
-std::array<float,2>{0.166623384f, 0.603658974f},
-std::array<float,2>{0.577652454f, 0.418058515f},
-std::array<float,2>{0.0704003051f, 0.272711724f},
-std::array<float,2>{0.665964842f, 0.724472046f},
-std::array<float,2>{0.423150837f, 0.861308753f},
-std::array<float,2>{0.937362909f, 0.00703518838f},
-std::array<float,2>{0.439584017f, 0.474138826f},
-std::array<float,2>{0.949120998f, 0.541499555f},
-std::array<float,2>{0.0122410161f, 0.889636576f},
-std::array<float,2>{0.707854629f, 0.160839856f},
-std::array<float,2>{0.201633587f, 0.12274313f},
-std::array<float,2>{0.540789366f, 0.79944855f},
-std::array<float,2>{0.276152164f, 0.679279506f},
-std::array<float,2>{0.849895477f, 0.326454192f},
-std::array<float,2>{0.474925131f, 0.22460033f},
-std::array<float,2>{0.976209879f, 0.987691104f},
-std::array<float,2>{0.0514016822f, 0.573395729f},
-std::array<float,2>{0.724720895f, 0.392665058f},
-std::array<float,2>{0.247060403f, 0.289973199f},
-std::array<float,2>{0.530042708f, 0.693451226f},
-std::array<float,2>{0.297211468f, 0.838032186f},
-std::array<float,2>{0.823767066f, 0.0386470892f},
-std::array<float,2>{0.355566204f, 0.440775037f},
-std::array<float,2>{0.759058118f, 0.518463314f},
-std::array<float,2>{0.152834877f, 0.933656752f},
-std::array<float,2>{0.603084207f, 0.138795912f},
-std::array<float,2>{0.0948043689f, 0.0660474598f},
-std::array<float,2>{0.652565897f, 0.754380822f},
-std::array<float,2>{0.385874301f, 0.645272732f},
-std::array<float,2>{0.890383005f, 0.368590087f},
-std::array<float,2>{0.272819757f, 0.0196375437f},
-std::array<float,2>{0.854988992f, 0.848570883f},
-std::array<float,2>{0.194812492f, 0.741817892f},
-std::array<float,2>{0.536160886f, 0.250290483f},
-std::array<float,2>{0.00586668961f, 0.427446872f},
-std::array<float,2>{0.718016446f, 0.610568166f},
-std::array<float,2>{0.447574198f, 0.941291749f},
-std::array<float,2>{0.943885207f, 0.190618753f},
-std::array<float,2>{0.435741872f, 0.332655519f},
-std::array<float,2>{0.92859441f, 0.669485033f},
-std::array<float,2>{0.0631899536f, 0.791841745f},
-std::array<float,2>{0.657881379f, 0.109268464f},
-std::array<float,2>{0.163964018f, 0.17722556f},
-std::array<float,2>{0.563486338f, 0.898479581f},
-std::array<float,2>{0.339144826f, 0.548949897f},
-std::array<float,2>{0.804842174f, 0.495867997f},
-std::array<float,2>{0.391983867f, 0.119875357f},
-std::array<float,2>{0.901120722f, 0.802070796f},
-std::array<float,2>{0.111619972f, 0.675763726f},
-std::array<float,2>{0.633196771f, 0.323988944f},
-std::array<float,2>{0.135887742f, 0.468758523f},
-std::array<float,2>{0.622545123f, 0.545471787f},
-std::array<float,2>{0.368821979f, 0.885024428f},
-std::array<float,2>{0.775332808f, 0.1585439f},
-std::array<float,2>{0.294231057f, 0.266558588f},
-std::array<float,2>{0.839059114f, 0.719186664f},
-std::array<float,2>{0.232342333f, 0.86445415f},
-std::array<float,2>{0.508741498f, 0.000375086296f},
-std::array<float,2>{0.039303083f, 0.215130299f},
-std::array<float,2>{0.736019194f, 0.966233134f},
-std::array<float,2>{0.498618931f, 0.608084738f},
-std::array<float,2>{0.993246138f, 0.416071206f},
-std::array<float,2>{0.31532225f, 0.152972206f},
-std::array<float,2>{0.795891762f, 0.917993963f},
-std::array<float,2>{0.176605254f, 0.502431393f},
-std::array<float,2>{0.592128038f, 0.460444063f},
-std::array<float,2>{0.0870076641f, 0.35595274f},
-std::array<float,2>{0.678649962f, 0.63567102f},
-std::array<float,2>{0.406456769f, 0.769916654f},
-std::array<float,2>{0.912376463f, 0.0862038806f},
-std::array<float,2>{0.468644619f, 0.38997817f},
-std::array<float,2>{0.959346294f, 0.583833873f},
-std::array<float,2>{0.0167856887f, 0.969129503f},
-std::array<float,2>{0.688642204f, 0.237947255f},
-std::array<float,2>{0.211981446f, 0.0512645319f},
-std::array<float,2>{0.56236285f, 0.81293869f},
-std::array<float,2>{0.254292846f, 0.714862823f},
-std::array<float,2>{0.868306756f, 0.30174157f},
-std::array<float,2>{0.417833686f, 0.16707167f},
-std::array<float,2>{0.920925677f, 0.87627703f},
-std::array<float,2>{0.0788559243f, 0.533226907f},
-std::array<float,2>{0.681066036f, 0.484254748f},
-std::array<float,2>{0.182751358f, 0.317087799f},
-std::array<float,2>{0.578842402f, 0.680108428f},
-std::array<float,2>{0.324932933f, 0.812478542f},
-std::array<float,2>{0.787150204f, 0.116022713f},
-std::array<float,2>{0.258250922f, 0.4090029f},
-std::array<float,2>{0.861590147f, 0.598546684f},
-std::array<float,2>{0.208632246f, 0.954643488f},
-std::array<float,2>{0.549579978f, 0.208617732f},
-std::array<float,2>{0.0280842092f, 0.0150139928f},
-std::array<float,2>{0.697345138f, 0.87087208f},
-std::array<float,2>{0.456492484f, 0.731440663f},
-std::array<float,2>{0.96815908f, 0.276628613f},
-std::array<float,2>{0.366028577f, 0.0786005408f},
-std::array<float,2>{0.771776676f, 0.774397492f},
-std::array<float,2>{0.132290781f, 0.631174862f},
-std::array<float,2>{0.614645958f, 0.346412927f},
-std::array<float,2>{0.122439168f, 0.467596143f},
-std::array<float,2>{0.631389141f, 0.515413702f},
-std::array<float,2>{0.402089268f, 0.906637371f},
-std::array<float,2>{0.89669925f, 0.141560823f},
-std::array<float,2>{0.490895152f, 0.311614096f},
-std::array<float,2>{0.984588981f, 0.706383884f},
-std::array<float,2>{0.038200371f, 0.827616811f},
-std::array<float,2>{0.748635232f, 0.0618586279f},
-std::array<float,2>{0.2258517f, 0.245726153f},
-std::array<float,2>{0.504167259f, 0.980849087f},
-std::array<float,2>{0.287941277f, 0.58694452f},
-std::array<float,2>{0.828781962f, 0.382597953f},
-std::array<float,2>{0.444800735f, 0.0444509014f},
-std::array<float,2>{0.9506464f, 0.835768402f},
-std::array<float,2>{0.00797281414f, 0.701005101f},
-std::array<float,2>{0.705314577f, 0.281616867f},
-std::array<float,2>{0.197065413f, 0.40168491f},
-std::array<float,2>{0.544635177f, 0.567378104f},
-std::array<float,2>{0.280281186f, 0.999329865f},
-std::array<float,2>{0.844292343f, 0.229819342f},
-std::array<float,2>{0.335110843f, 0.363630056f},
-std::array<float,2>{0.802722752f, 0.651489258f},
-std::array<float,2>{0.171002328f, 0.759710431f},
-std::array<float,2>{0.572022319f, 0.0741270781f},
-std::array<float,2>{0.074516505f, 0.125470221f},
-std::array<float,2>{0.670829654f, 0.922599018f},
-std::array<float,2>{0.429408193f, 0.525435507f},
-std::array<float,2>{0.932416201f, 0.450117409f},
-std::array<float,2>{0.305234194f, 0.199813038f},
-std::array<float,2>{0.817079067f, 0.945334315f},
-std::array<float,2>{0.240904585f, 0.618053496f},
-std::array<float,2>{0.518597603f, 0.434126735f},
-std::array<float,2>{0.0563606247f, 0.25863269f},
-std::array<float,2>{0.727770925f, 0.74646455f},
-std::array<float,2>{0.477055341f, 0.853021979f},
-std::array<float,2>{0.976659834f, 0.0234832019f},
-std::array<float,2>{0.378475398f, 0.490980566f},
-std::array<float,2>{0.875234485f, 0.557149887f},
-std::array<float,2>{0.105324373f, 0.891324818f},
-std::array<float,2>{0.64179498f, 0.184879258f},
-std::array<float,2>{0.142439425f, 0.098157078f},
-std::array<float,2>{0.59455663f, 0.784164965f},
-std::array<float,2>{0.347402483f, 0.656536579f},
-std::array<float,2>{0.752681553f, 0.342762202f},
-std::array<float,2>{0.388233632f, 0.205523625f},
-std::array<float,2>{0.88356787f, 0.960148931f},
-std::array<float,2>{0.0978145152f, 0.593886971f},
-std::array<float,2>{0.651582897f, 0.413760066f},
-std::array<float,2>{0.150303915f, 0.28103292f},
-std::array<float,2>{0.608829081f, 0.730137169f},
-std::array<float,2>{0.353646606f, 0.872563243f},
-std::array<float,2>{0.765397429f, 0.00865603611f},
-std::array<float,2>{0.302416027f, 0.476926416f},
-std::array<float,2>{0.826440632f, 0.538410485f},
-std::array<float,2>{0.243346006f, 0.880985141f},
-std::array<float,2>{0.524889052f, 0.169760808f},
-std::array<float,2>{0.0470724329f, 0.113087282f},
-std::array<float,2>{0.719038248f, 0.804877102f},
-std::array<float,2>{0.47097984f, 0.684648156f},
-std::array<float,2>{0.970229983f, 0.31531024f},
-std::array<float,2>{0.339954436f, 0.0562179461f},
-std::array<float,2>{0.81198436f, 0.821089029f},
-std::array<float,2>{0.157129675f, 0.709225535f},
-std::array<float,2>{0.570071042f, 0.306782484f},
-std::array<float,2>{0.0701047331f, 0.377287298f},
-std::array<float,2>{0.661321819f, 0.590561748f},
-std::array<float,2>{0.429779649f, 0.979822636f},
-std::array<float,2>{0.922589421f, 0.248342335f},
-std::array<float,2>{0.452914894f, 0.347909659f},
-std::array<float,2>{0.939186394f, 0.627317548f},
-std::array<float,2>{0.00202734675f, 0.777718484f},
-std::array<float,2>{0.7115165f, 0.0825246051f},
-std::array<float,2>{0.189871654f, 0.145577699f},
-std::array<float,2>{0.53508538f, 0.91070807f},
-std::array<float,2>{0.267715007f, 0.509816825f},
-std::array<float,2>{0.858948052f, 0.463986456f},
-std::array<float,2>{0.493743807f, 0.0743971094f},
-std::array<float,2>{0.996917605f, 0.765188754f},
-std::array<float,2>{0.044063054f, 0.653019488f},
-std::array<float,2>{0.739634871f, 0.360634744f},
-std::array<float,2>{0.230320305f, 0.446180612f},
-std::array<float,2>{0.514790952f, 0.527405202f},
-std::array<float,2>{0.290519327f, 0.927546144f},
-std::array<float,2>{0.840283573f, 0.132633939f},
-std::array<float,2>{0.374304801f, 0.28524068f},
-std::array<float,2>{0.778538465f, 0.698563635f},
-std::array<float,2>{0.139651045f, 0.831146836f},
-std::array<float,2>{0.619816124f, 0.042604737f},
-std::array<float,2>{0.11493367f, 0.234129012f},
-std::array<float,2>{0.637352169f, 0.993886173f},
-std::array<float,2>{0.397651136f, 0.566210628f},
-std::array<float,2>{0.904829085f, 0.40346694f},
-std::array<float,2>{0.250609636f, 0.181113303f},
-std::array<float,2>{0.871781528f, 0.898137987f},
-std::array<float,2>{0.215961546f, 0.559555531f},
-std::array<float,2>{0.558112085f, 0.487143397f},
-std::array<float,2>{0.0218195505f, 0.339015871f},
-std::array<float,2>{0.694402575f, 0.661388755f},
-std::array<float,2>{0.463993251f, 0.785233676f},
-std::array<float,2>{0.955801606f, 0.0952005386f},
-std::array<float,2>{0.410600871f, 0.432088137f},
-std::array<float,2>{0.908069074f, 0.623708665f},
-std::array<float,2>{0.0914237425f, 0.952755272f},
-std::array<float,2>{0.675686836f, 0.197578534f},
-std::array<float,2>{0.173735082f, 0.0311471596f},
-std::array<float,2>{0.586930811f, 0.857645631f},
-std::array<float,2>{0.317129463f, 0.743380904f},
-std::array<float,2>{0.790885508f, 0.263459563f},
-std::array<float,2>{0.459628731f, 0.135655671f},
-std::array<float,2>{0.963366747f, 0.931849778f},
-std::array<float,2>{0.0272235908f, 0.52026552f},
-std::array<float,2>{0.702450633f, 0.441625923f},
-std::array<float,2>{0.205552012f, 0.373294473f},
-std::array<float,2>{0.553626299f, 0.642395496f},
-std::array<float,2>{0.265001625f, 0.75235188f},
-std::array<float,2>{0.86552155f, 0.0691767335f},
-std::array<float,2>{0.321576357f, 0.398126423f},
-std::array<float,2>{0.781758487f, 0.577168703f},
-std::array<float,2>{0.184966713f, 0.99018389f},
-std::array<float,2>{0.585278809f, 0.220299169f},
-std::array<float,2>{0.0858923197f, 0.0314520821f},
-std::array<float,2>{0.686790228f, 0.842408836f},
-std::array<float,2>{0.419684201f, 0.688987494f},
-std::array<float,2>{0.91719085f, 0.296714813f},
-std::array<float,2>{0.284159869f, 0.103619061f},
-std::array<float,2>{0.834266007f, 0.793299019f},
-std::array<float,2>{0.220025092f, 0.664976954f},
-std::array<float,2>{0.501297057f, 0.330728084f},
-std::array<float,2>{0.0341281854f, 0.49862808f},
-std::array<float,2>{0.745640159f, 0.55456996f},
-std::array<float,2>{0.484538198f, 0.904059708f},
-std::array<float,2>{0.990047991f, 0.173025906f},
-std::array<float,2>{0.405608177f, 0.257747352f},
-std::array<float,2>{0.892372131f, 0.735176444f},
-std::array<float,2>{0.120503761f, 0.844316185f},
-std::array<float,2>{0.625574827f, 0.0176478438f},
-std::array<float,2>{0.125462011f, 0.193923235f},
-std::array<float,2>{0.609530568f, 0.941565752f},
-std::array<float,2>{0.360542804f, 0.614430964f},
-std::array<float,2>{0.769400418f, 0.423712581f},
-std::array<float,2>{0.425737083f, 0.0046725343f},
-std::array<float,2>{0.933700919f, 0.862447083f},
-std::array<float,2>{0.0726814047f, 0.725989163f},
-std::array<float,2>{0.667651772f, 0.270223975f},
-std::array<float,2>{0.165769458f, 0.421526819f},
-std::array<float,2>{0.575106263f, 0.603353441f},
-std::array<float,2>{0.33121419f, 0.964454353f},
-std::array<float,2>{0.797881246f, 0.211680636f},
-std::array<float,2>{0.27385509f, 0.32549566f},
-std::array<float,2>{0.848275483f, 0.67662102f},
-std::array<float,2>{0.199735865f, 0.797927439f},
-std::array<float,2>{0.541116118f, 0.124826558f},
-std::array<float,2>{0.0146551775f, 0.163773805f},
-std::array<float,2>{0.710705042f, 0.887893677f},
-std::array<float,2>{0.438899308f, 0.540127993f},
-std::array<float,2>{0.946199059f, 0.474964797f},
-std::array<float,2>{0.35080114f, 0.239955083f},
-std::array<float,2>{0.756442189f, 0.973760307f},
-std::array<float,2>{0.147235543f, 0.581510127f},
-std::array<float,2>{0.598360121f, 0.383467793f},
-std::array<float,2>{0.1056327f, 0.299197316f},
-std::array<float,2>{0.645966172f, 0.71344775f},
-std::array<float,2>{0.381521791f, 0.816883385f},
-std::array<float,2>{0.88125062f, 0.0505859517f},
-std::array<float,2>{0.483955801f, 0.454036593f},
-std::array<float,2>{0.983251929f, 0.507759631f},
-std::array<float,2>{0.059654586f, 0.917779386f},
-std::array<float,2>{0.731595278f, 0.1493956f},
-std::array<float,2>{0.236183017f, 0.0910338089f},
-std::array<float,2>{0.520771921f, 0.768691182f},
-std::array<float,2>{0.309703261f, 0.639594257f},
-std::array<float,2>{0.815996587f, 0.354116738f},
-std::array<float,2>{0.46525088f, 0.236337632f},
-std::array<float,2>{0.957517326f, 0.970666528f},
-std::array<float,2>{0.0184345879f, 0.582674086f},
-std::array<float,2>{0.689757884f, 0.389232576f},
-std::array<float,2>{0.21466814f, 0.30205968f},
-std::array<float,2>{0.558715761f, 0.716029346f},
-std::array<float,2>{0.257572293f, 0.813721776f},
-std::array<float,2>{0.870314479f, 0.052426625f},
-std::array<float,2>{0.314159304f, 0.459077507f},
-std::array<float,2>{0.794054389f, 0.503605187f},
-std::array<float,2>{0.178894982f, 0.919608951f},
-std::array<float,2>{0.590516865f, 0.153554738f},
-std::array<float,2>{0.0882385597f, 0.0871905014f},
-std::array<float,2>{0.677498519f, 0.770738959f},
-std::array<float,2>{0.408645779f, 0.636221349f},
-std::array<float,2>{0.910565317f, 0.356673896f},
-std::array<float,2>{0.295890242f, 0.00151426811f},
-std::array<float,2>{0.837126076f, 0.864199817f},
-std::array<float,2>{0.233489215f, 0.719998896f},
-std::array<float,2>{0.510649681f, 0.267087191f},
-std::array<float,2>{0.0412849449f, 0.417649955f},
-std::array<float,2>{0.737041771f, 0.609095514f},
-std::array<float,2>{0.497442812f, 0.965291917f},
-std::array<float,2>{0.995791972f, 0.216209084f},
-std::array<float,2>{0.394053221f, 0.323141307f},
-std::array<float,2>{0.8989501f, 0.674628019f},
-std::array<float,2>{0.110403977f, 0.800900638f},
-std::array<float,2>{0.635898411f, 0.120312892f},
-std::array<float,2>{0.1337156f, 0.159220979f},
-std::array<float,2>{0.623137772f, 0.886595249f},
-std::array<float,2>{0.370761037f, 0.545915544f},
-std::array<float,2>{0.77712822f, 0.470203489f},
-std::array<float,2>{0.434190571f, 0.108167253f},
-std::array<float,2>{0.926417053f, 0.792469859f},
-std::array<float,2>{0.0647811219f, 0.668049335f},
-std::array<float,2>{0.659966886f, 0.333836854f},
-std::array<float,2>{0.160688832f, 0.49462676f},
-std::array<float,2>{0.565237284f, 0.550638735f},
-std::array<float,2>{0.337860167f, 0.899865687f},
-std::array<float,2>{0.807786584f, 0.176608607f},
-std::array<float,2>{0.269604295f, 0.251588196f},
-std::array<float,2>{0.853050768f, 0.740841091f},
-std::array<float,2>{0.192314178f, 0.849279583f},
-std::array<float,2>{0.53789711f, 0.0207206476f},
-std::array<float,2>{0.00406103954f, 0.189820066f},
-std::array<float,2>{0.715493619f, 0.939468324f},
-std::array<float,2>{0.446615726f, 0.609532833f},
-std::array<float,2>{0.943227351f, 0.426404685f},
-std::array<float,2>{0.358643293f, 0.139721885f},
-std::array<float,2>{0.760189652f, 0.934751987f},
-std::array<float,2>{0.155197948f, 0.51917243f},
-std::array<float,2>{0.605341375f, 0.440023512f},
-std::array<float,2>{0.0975080952f, 0.367231786f},
-std::array<float,2>{0.655205071f, 0.645937741f},
-std::array<float,2>{0.384518743f, 0.755853534f},
-std::array<float,2>{0.887827575f, 0.0654262826f},
-std::array<float,2>{0.473581076f, 0.393952131f},
-std::array<float,2>{0.973359168f, 0.572379291f},
-std::array<float,2>{0.0531948172f, 0.986727357f},
-std::array<float,2>{0.723849952f, 0.222775593f},
-std::array<float,2>{0.248304591f, 0.0371237807f},
-std::array<float,2>{0.52914089f, 0.839742303f},
-std::array<float,2>{0.298996389f, 0.694812119f},
-std::array<float,2>{0.821065426f, 0.290990531f},
-std::array<float,2>{0.376873136f, 0.184075311f},
-std::array<float,2>{0.87854445f, 0.892271698f},
-std::array<float,2>{0.102225184f, 0.55811733f},
-std::array<float,2>{0.644255817f, 0.49161765f},
-std::array<float,2>{0.143957227f, 0.34326002f},
-std::array<float,2>{0.595995843f, 0.657586992f},
-std::array<float,2>{0.344415307f, 0.78512001f},
-std::array<float,2>{0.751091897f, 0.0990477949f},
-std::array<float,2>{0.308173209f, 0.435010821f},
-std::array<float,2>{0.818723321f, 0.618873954f},
-std::array<float,2>{0.239461377f, 0.947048306f},
-std::array<float,2>{0.516612172f, 0.200233698f},
-std::array<float,2>{0.0569219775f, 0.0247725416f},
-std::array<float,2>{0.728808224f, 0.851840913f},
-std::array<float,2>{0.480153501f, 0.747585297f},
-std::array<float,2>{0.979830921f, 0.259763986f},
-std::array<float,2>{0.332749933f, 0.0723025426f},
-std::array<float,2>{0.803129494f, 0.758410156f},
-std::array<float,2>{0.168715954f, 0.650808573f},
-std::array<float,2>{0.574016929f, 0.364376634f},
-std::array<float,2>{0.0779651329f, 0.450477034f},
-std::array<float,2>{0.66973561f, 0.526847959f},
-std::array<float,2>{0.426919878f, 0.92329812f},
-std::array<float,2>{0.931359112f, 0.126310945f},
-std::array<float,2>{0.443294704f, 0.282834977f},
-std::array<float,2>{0.95296514f, 0.700054765f},
-std::array<float,2>{0.0108857071f, 0.834405363f},
-std::array<float,2>{0.703890502f, 0.0433052219f},
-std::array<float,2>{0.198575512f, 0.228889689f},
-std::array<float,2>{0.546352506f, 0.998064578f},
-std::array<float,2>{0.27902779f, 0.568158805f},
-std::array<float,2>{0.846105337f, 0.40074116f},
-std::array<float,2>{0.490182221f, 0.061456196f},
-std::array<float,2>{0.986941755f, 0.826962829f},
-std::array<float,2>{0.0360675566f, 0.705772877f},
-std::array<float,2>{0.746666372f, 0.311114609f},
-std::array<float,2>{0.224133223f, 0.381636947f},
-std::array<float,2>{0.507341981f, 0.586767197f},
-std::array<float,2>{0.286298662f, 0.982198656f},
-std::array<float,2>{0.830803037f, 0.245042741f},
-std::array<float,2>{0.363300562f, 0.347139478f},
-std::array<float,2>{0.770298898f, 0.63218832f},
-std::array<float,2>{0.130129606f, 0.775051653f},
-std::array<float,2>{0.616769969f, 0.0793507695f},
-std::array<float,2>{0.123119839f, 0.142048016f},
-std::array<float,2>{0.630429208f, 0.9075495f},
-std::array<float,2>{0.400005013f, 0.513819635f},
-std::array<float,2>{0.89584142f, 0.467820287f},
-std::array<float,2>{0.260563314f, 0.207140684f},
-std::array<float,2>{0.86049366f, 0.953753233f},
-std::array<float,2>{0.209372252f, 0.599218249f},
-std::array<float,2>{0.547002316f, 0.409715712f},
-std::array<float,2>{0.0299135726f, 0.276022375f},
-std::array<float,2>{0.696059525f, 0.73179996f},
-std::array<float,2>{0.453608096f, 0.869446695f},
-std::array<float,2>{0.966454148f, 0.0141560733f},
-std::array<float,2>{0.414571136f, 0.483352661f},
-std::array<float,2>{0.918098152f, 0.534767389f},
-std::array<float,2>{0.0803072676f, 0.875281453f},
-std::array<float,2>{0.682853639f, 0.166576385f},
-std::array<float,2>{0.181585595f, 0.117150947f},
-std::array<float,2>{0.581133127f, 0.811203837f},
-std::array<float,2>{0.32741344f, 0.68111521f},
-std::array<float,2>{0.785356641f, 0.31797719f},
-std::array<float,2>{0.412685156f, 0.199213877f},
-std::array<float,2>{0.910080254f, 0.951281071f},
-std::array<float,2>{0.092907615f, 0.624819517f},
-std::array<float,2>{0.673338175f, 0.433086246f},
-std::array<float,2>{0.17513524f, 0.262315691f},
-std::array<float,2>{0.588379562f, 0.74296546f},
-std::array<float,2>{0.319883615f, 0.858795166f},
-std::array<float,2>{0.791882753f, 0.0293398798f},
-std::array<float,2>{0.253077716f, 0.488142431f},
-std::array<float,2>{0.874263704f, 0.559963465f},
-std::array<float,2>{0.217919841f, 0.896825492f},
-std::array<float,2>{0.555573881f, 0.180057272f},
-std::array<float,2>{0.0210040025f, 0.0939669535f},
-std::array<float,2>{0.693206906f, 0.786519468f},
-std::array<float,2>{0.460939825f, 0.660197854f},
-std::array<float,2>{0.953982532f, 0.338209152f},
-std::array<float,2>{0.372038573f, 0.0413971618f},
-std::array<float,2>{0.779859602f, 0.830164135f},
-std::array<float,2>{0.137981102f, 0.6980654f},
-std::array<float,2>{0.617407084f, 0.28672424f},
-std::array<float,2>{0.116624013f, 0.40321666f},
-std::array<float,2>{0.639558792f, 0.564849317f},
-std::array<float,2>{0.394596249f, 0.992973924f},
-std::array<float,2>{0.903083742f, 0.233150959f},
-std::array<float,2>{0.495468497f, 0.359439552f},
-std::array<float,2>{0.999532104f, 0.653421104f},
-std::array<float,2>{0.0456655957f, 0.764203608f},
-std::array<float,2>{0.740463972f, 0.0758401304f},
-std::array<float,2>{0.227885902f, 0.131057531f},
-std::array<float,2>{0.511991203f, 0.926493347f},
-std::array<float,2>{0.292163461f, 0.528675973f},
-std::array<float,2>{0.842589915f, 0.446576953f},
-std::array<float,2>{0.450288177f, 0.0838799179f},
-std::array<float,2>{0.941014707f, 0.778523982f},
-std::array<float,2>{0.000970922643f, 0.628073156f},
-std::array<float,2>{0.714065552f, 0.349284321f},
-std::array<float,2>{0.188787907f, 0.463513374f},
-std::array<float,2>{0.532197952f, 0.511534512f},
-std::array<float,2>{0.267332673f, 0.911492944f},
-std::array<float,2>{0.857298732f, 0.145147368f},
-std::array<float,2>{0.341997415f, 0.308317661f},
-std::array<float,2>{0.810447276f, 0.710883379f},
-std::array<float,2>{0.159203291f, 0.821319401f},
-std::array<float,2>{0.566631019f, 0.0550687462f},
-std::array<float,2>{0.0677415654f, 0.249413133f},
-std::array<float,2>{0.662140846f, 0.978897154f},
-std::array<float,2>{0.433589339f, 0.591471851f},
-std::array<float,2>{0.924923539f, 0.378673136f},
-std::array<float,2>{0.304531395f, 0.168572232f},
-std::array<float,2>{0.824877679f, 0.882741928f},
-std::array<float,2>{0.245291218f, 0.537293911f},
-std::array<float,2>{0.525859296f, 0.47830078f},
-std::array<float,2>{0.049328465f, 0.316196799f},
-std::array<float,2>{0.721394956f, 0.684363127f},
-std::array<float,2>{0.469781101f, 0.806349099f},
-std::array<float,2>{0.972437143f, 0.111496255f},
-std::array<float,2>{0.390601635f, 0.41287145f},
-std::array<float,2>{0.885891736f, 0.594938755f},
-std::array<float,2>{0.101265684f, 0.959751666f},
-std::array<float,2>{0.64866811f, 0.206781611f},
-std::array<float,2>{0.151414678f, 0.0088031264f},
-std::array<float,2>{0.606659472f, 0.87175256f},
-std::array<float,2>{0.352953732f, 0.729323626f},
-std::array<float,2>{0.762575209f, 0.279321373f},
-std::array<float,2>{0.482019067f, 0.149672985f},
-std::array<float,2>{0.981556177f, 0.91609025f},
-std::array<float,2>{0.0618816055f, 0.505981207f},
-std::array<float,2>{0.733655453f, 0.454689831f},
-std::array<float,2>{0.236359522f, 0.354696095f},
-std::array<float,2>{0.521780849f, 0.640600383f},
-std::array<float,2>{0.31179738f, 0.768451214f},
-std::array<float,2>{0.813037038f, 0.089911744f},
-std::array<float,2>{0.347889006f, 0.384373754f},
-std::array<float,2>{0.755176246f, 0.580890775f},
-std::array<float,2>{0.144791394f, 0.973019361f},
-std::array<float,2>{0.60059458f, 0.239080101f},
-std::array<float,2>{0.108900771f, 0.0490845963f},
-std::array<float,2>{0.648354232f, 0.817903161f},
-std::array<float,2>{0.380109191f, 0.714032352f},
-std::array<float,2>{0.879331231f, 0.300587922f},
-std::array<float,2>{0.2763699f, 0.123352773f},
-std::array<float,2>{0.851077199f, 0.796955884f},
-std::array<float,2>{0.20294784f, 0.677582383f},
-std::array<float,2>{0.539827406f, 0.324609399f},
-std::array<float,2>{0.0134237688f, 0.47565347f},
-std::array<float,2>{0.70892179f, 0.53924489f},
-std::array<float,2>{0.440730929f, 0.887353957f},
-std::array<float,2>{0.947682202f, 0.16243203f},
-std::array<float,2>{0.42271021f, 0.270716071f},
-std::array<float,2>{0.936306536f, 0.725267887f},
-std::array<float,2>{0.0718770102f, 0.861586094f},
-std::array<float,2>{0.665011108f, 0.00556369638f},
-std::array<float,2>{0.167695597f, 0.21207352f},
-std::array<float,2>{0.577118576f, 0.962916732f},
-std::array<float,2>{0.328524202f, 0.60240531f},
-std::array<float,2>{0.80037415f, 0.420345724f},
-std::array<float,2>{0.403463364f, 0.0192638263f},
-std::array<float,2>{0.892773271f, 0.845387638f},
-std::array<float,2>{0.118315481f, 0.735566974f},
-std::array<float,2>{0.628749609f, 0.256056875f},
-std::array<float,2>{0.12881273f, 0.422744602f},
-std::array<float,2>{0.612072051f, 0.613966942f},
-std::array<float,2>{0.363055408f, 0.942911565f},
-std::array<float,2>{0.767465234f, 0.194694683f},
-std::array<float,2>{0.281666666f, 0.331149071f},
-std::array<float,2>{0.833414912f, 0.665476799f},
-std::array<float,2>{0.222511411f, 0.794030964f},
-std::array<float,2>{0.502004504f, 0.104579858f},
-std::array<float,2>{0.032456141f, 0.172483712f},
-std::array<float,2>{0.74379003f, 0.903137028f},
-std::array<float,2>{0.486431748f, 0.552903116f},
-std::array<float,2>{0.990755439f, 0.499289572f},
-std::array<float,2>{0.323228002f, 0.219419762f},
-std::array<float,2>{0.783746362f, 0.98869133f},
-std::array<float,2>{0.186688408f, 0.576446056f},
-std::array<float,2>{0.582311094f, 0.397258788f},
-std::array<float,2>{0.0821020827f, 0.295379907f},
-std::array<float,2>{0.684147716f, 0.688149035f},
-std::array<float,2>{0.421796262f, 0.843230665f},
-std::array<float,2>{0.915841222f, 0.0326933265f},
-std::array<float,2>{0.457465351f, 0.442949414f},
-std::array<float,2>{0.961458504f, 0.5205338f},
-std::array<float,2>{0.0245736577f, 0.933503032f},
-std::array<float,2>{0.699560404f, 0.135871321f},
-std::array<float,2>{0.203369305f, 0.0696087405f},
-std::array<float,2>{0.550845504f, 0.753487468f},
-std::array<float,2>{0.263258696f, 0.640730858f},
-std::array<float,2>{0.864017546f, 0.374129117f},
-std::array<float,2>{0.49902457f, 0.218143135f},
-std::array<float,2>{0.992661119f, 0.967615485f},
-std::array<float,2>{0.0400461927f, 0.606239736f},
-std::array<float,2>{0.734440565f, 0.414302886f},
-std::array<float,2>{0.230537832f, 0.268979251f},
-std::array<float,2>{0.509030581f, 0.722310126f},
-std::array<float,2>{0.293596089f, 0.866865695f},
-std::array<float,2>{0.838572264f, 0.00211388874f},
-std::array<float,2>{0.36732167f, 0.4712753f},
-std::array<float,2>{0.773890436f, 0.543097198f},
-std::array<float,2>{0.134845361f, 0.88289535f},
-std::array<float,2>{0.621805012f, 0.157298595f},
-std::array<float,2>{0.112617321f, 0.119048409f},
-std::array<float,2>{0.634456992f, 0.804227233f},
-std::array<float,2>{0.391488045f, 0.67198354f},
-std::array<float,2>{0.902086556f, 0.320536792f},
-std::array<float,2>{0.25516203f, 0.0544824675f},
-std::array<float,2>{0.867603123f, 0.814663708f},
-std::array<float,2>{0.211159766f, 0.717446864f},
-std::array<float,2>{0.561348796f, 0.304219961f},
-std::array<float,2>{0.0164333507f, 0.387682825f},
-std::array<float,2>{0.687729537f, 0.584806919f},
-std::array<float,2>{0.466885567f, 0.971000731f},
-std::array<float,2>{0.960066795f, 0.235398367f},
-std::array<float,2>{0.40769884f, 0.359237462f},
-std::array<float,2>{0.913935006f, 0.633364797f},
-std::array<float,2>{0.0864857361f, 0.772050202f},
-std::array<float,2>{0.679659307f, 0.0891079679f},
-std::array<float,2>{0.177687034f, 0.155918583f},
-std::array<float,2>{0.592883885f, 0.920469284f},
-std::array<float,2>{0.31625098f, 0.501898587f},
-std::array<float,2>{0.796481192f, 0.458807111f},
-std::array<float,2>{0.385174632f, 0.0637009591f},
-std::array<float,2>{0.889211059f, 0.756011188f},
-std::array<float,2>{0.0937518924f, 0.648085415f},
-std::array<float,2>{0.653361499f, 0.369621247f},
-std::array<float,2>{0.153583154f, 0.437503695f},
-std::array<float,2>{0.601845443f, 0.515654922f},
-std::array<float,2>{0.356799752f, 0.936609089f},
-std::array<float,2>{0.757879436f, 0.137482136f},
-std::array<float,2>{0.298764408f, 0.291147619f},
-std::array<float,2>{0.822880268f, 0.692905962f},
-std::array<float,2>{0.247785151f, 0.836957216f},
-std::array<float,2>{0.530315459f, 0.0368670821f},
-std::array<float,2>{0.0525942184f, 0.225997046f},
-std::array<float,2>{0.726362586f, 0.985685825f},
-std::array<float,2>{0.47609064f, 0.570634723f},
-std::array<float,2>{0.975052834f, 0.39132905f},
-std::array<float,2>{0.338387638f, 0.179068491f},
-std::array<float,2>{0.806110501f, 0.902181089f},
-std::array<float,2>{0.162504077f, 0.548212707f},
-std::array<float,2>{0.56306994f, 0.493863404f},
-std::array<float,2>{0.0640103668f, 0.334174305f},
-std::array<float,2>{0.656481922f, 0.671555638f},
-std::array<float,2>{0.436643839f, 0.790246606f},
-std::array<float,2>{0.929356337f, 0.105555214f},
-std::array<float,2>{0.448674381f, 0.42953822f},
-std::array<float,2>{0.944740772f, 0.612788379f},
-std::array<float,2>{0.00751484092f, 0.937760234f},
-std::array<float,2>{0.717753947f, 0.187715694f},
-std::array<float,2>{0.193865284f, 0.0226292517f},
-std::array<float,2>{0.535357296f, 0.851074636f},
-std::array<float,2>{0.271597832f, 0.738514125f},
-std::array<float,2>{0.853822947f, 0.25238055f},
-std::array<float,2>{0.428040206f, 0.128538519f},
-std::array<float,2>{0.933253527f, 0.924203634f},
-std::array<float,2>{0.075613834f, 0.524907529f},
-std::array<float,2>{0.671350539f, 0.451966554f},
-std::array<float,2>{0.169933245f, 0.365576297f},
-std::array<float,2>{0.571259379f, 0.648579538f},
-std::array<float,2>{0.334773719f, 0.760455072f},
-std::array<float,2>{0.801234603f, 0.0715840086f},
-std::array<float,2>{0.279584765f, 0.398661017f},
-std::array<float,2>{0.845052779f, 0.569628119f},
-std::array<float,2>{0.195840642f, 0.996152043f},
-std::array<float,2>{0.543672204f, 0.22766766f},
-std::array<float,2>{0.00936492253f, 0.04638163f},
-std::array<float,2>{0.706854165f, 0.833716094f},
-std::array<float,2>{0.444108814f, 0.7028144f},
-std::array<float,2>{0.949766159f, 0.283611625f},
-std::array<float,2>{0.346655518f, 0.101459339f},
-std::array<float,2>{0.753399193f, 0.781892896f},
-std::array<float,2>{0.141527012f, 0.660101354f},
-std::array<float,2>{0.595377386f, 0.340417176f},
-std::array<float,2>{0.104168467f, 0.490220636f},
-std::array<float,2>{0.641428113f, 0.556445956f},
-std::array<float,2>{0.377442151f, 0.892744422f},
-std::array<float,2>{0.876458406f, 0.186338931f},
-std::array<float,2>{0.477585256f, 0.261330575f},
-std::array<float,2>{0.978262246f, 0.748815179f},
-std::array<float,2>{0.0551088378f, 0.854099512f},
-std::array<float,2>{0.726605237f, 0.0263695717f},
-std::array<float,2>{0.241960138f, 0.202516302f},
-std::array<float,2>{0.518256724f, 0.947560191f},
-std::array<float,2>{0.306279629f, 0.619668245f},
-std::array<float,2>{0.818171859f, 0.436694831f},
-std::array<float,2>{0.455223143f, 0.0120172296f},
-std::array<float,2>{0.967098296f, 0.867896438f},
-std::array<float,2>{0.029285593f, 0.733005524f},
-std::array<float,2>{0.698635101f, 0.273542225f},
-std::array<float,2>{0.207277223f, 0.407446116f},
-std::array<float,2>{0.549851418f, 0.599647582f},
-std::array<float,2>{0.259204f, 0.955772102f},
-std::array<float,2>{0.862326145f, 0.209262535f},
-std::array<float,2>{0.325960696f, 0.319796413f},
-std::array<float,2>{0.788500547f, 0.682145953f},
-std::array<float,2>{0.181872636f, 0.808801591f},
-std::array<float,2>{0.579407513f, 0.114605226f},
-std::array<float,2>{0.0795611292f, 0.164852783f},
-std::array<float,2>{0.679851234f, 0.877100527f},
-std::array<float,2>{0.416492909f, 0.531534195f},
-std::array<float,2>{0.920534492f, 0.482005596f},
-std::array<float,2>{0.288870215f, 0.242659912f},
-std::array<float,2>{0.829574347f, 0.984316409f},
-std::array<float,2>{0.225190148f, 0.588627636f},
-std::array<float,2>{0.505594611f, 0.379348576f},
-std::array<float,2>{0.0373138078f, 0.309879452f},
-std::array<float,2>{0.749956548f, 0.703502536f},
-std::array<float,2>{0.492091328f, 0.824613512f},
-std::array<float,2>{0.985993505f, 0.0596734285f},
-std::array<float,2>{0.400805205f, 0.465435475f},
-std::array<float,2>{0.898228824f, 0.51211822f},
-std::array<float,2>{0.121779718f, 0.908276498f},
-std::array<float,2>{0.632222354f, 0.143307015f},
-std::array<float,2>{0.131048709f, 0.0809837207f},
-std::array<float,2>{0.614074051f, 0.776600242f},
-std::array<float,2>{0.366685033f, 0.629623592f},
-std::array<float,2>{0.772825778f, 0.344042748f},
-std::array<float,2>{0.39741078f, 0.231030107f},
-std::array<float,2>{0.905505598f, 0.995224953f},
-std::array<float,2>{0.113364235f, 0.562566042f},
-std::array<float,2>{0.637924612f, 0.405194998f},
-std::array<float,2>{0.139017031f, 0.287243247f},
-std::array<float,2>{0.620743275f, 0.696308672f},
-std::array<float,2>{0.37345317f, 0.82815671f},
-std::array<float,2>{0.777499795f, 0.0397142135f},
-std::array<float,2>{0.289827704f, 0.448406607f},
-std::array<float,2>{0.84110105f, 0.53063643f},
-std::array<float,2>{0.228724003f, 0.929251611f},
-std::array<float,2>{0.513836324f, 0.129090071f},
-std::array<float,2>{0.0430697724f, 0.0776953921f},
-std::array<float,2>{0.738438666f, 0.762460172f},
-std::array<float,2>{0.492646903f, 0.655658662f},
-std::array<float,2>{0.997864127f, 0.361526191f},
-std::array<float,2>{0.317700565f, 0.0279210489f},
-std::array<float,2>{0.789768934f, 0.856614351f},
-std::array<float,2>{0.172607958f, 0.745447397f},
-std::array<float,2>{0.58690691f, 0.264318824f},
-std::array<float,2>{0.0907700881f, 0.43121776f},
-std::array<float,2>{0.674114764f, 0.622550666f},
-std::array<float,2>{0.411152303f, 0.949870765f},
-std::array<float,2>{0.907144785f, 0.197147816f},
-std::array<float,2>{0.463383824f, 0.336408824f},
-std::array<float,2>{0.956260622f, 0.663723946f},
-std::array<float,2>{0.0232752692f, 0.788042963f},
-std::array<float,2>{0.693778992f, 0.0975053459f},
-std::array<float,2>{0.215625957f, 0.183144331f},
-std::array<float,2>{0.556954682f, 0.894773602f},
-std::array<float,2>{0.251533955f, 0.561469018f},
-std::array<float,2>{0.873002708f, 0.485853285f},
-std::array<float,2>{0.471749455f, 0.110923916f},
-std::array<float,2>{0.968769372f, 0.807691574f},
-std::array<float,2>{0.0483606718f, 0.686294377f},
-std::array<float,2>{0.720240116f, 0.313515961f},
-std::array<float,2>{0.242915452f, 0.479027182f},
-std::array<float,2>{0.524268627f, 0.536014855f},
-std::array<float,2>{0.301263958f, 0.880111337f},
-std::array<float,2>{0.827694893f, 0.170019895f},
-std::array<float,2>{0.355104804f, 0.277650774f},
-std::array<float,2>{0.764241934f, 0.726606607f},
-std::array<float,2>{0.148684576f, 0.874606609f},
-std::array<float,2>{0.607636571f, 0.0101927891f},
-std::array<float,2>{0.0991170779f, 0.204519227f},
-std::array<float,2>{0.650841594f, 0.957726121f},
-std::array<float,2>{0.387274474f, 0.597002804f},
-std::array<float,2>{0.88401103f, 0.41037485f},
-std::array<float,2>{0.269347817f, 0.147179842f},
-std::array<float,2>{0.858271539f, 0.912447393f},
-std::array<float,2>{0.190888137f, 0.508041739f},
-std::array<float,2>{0.53398025f, 0.461220056f},
-std::array<float,2>{0.00335929869f, 0.350418955f},
-std::array<float,2>{0.712768734f, 0.625004768f},
-std::array<float,2>{0.451683939f, 0.779705882f},
-std::array<float,2>{0.937641203f, 0.0856324285f},
-std::array<float,2>{0.43156743f, 0.375023156f},
-std::array<float,2>{0.923153579f, 0.593248665f},
-std::array<float,2>{0.0685152933f, 0.97695756f},
-std::array<float,2>{0.66016674f, 0.247652456f},
-std::array<float,2>{0.157597393f, 0.0571364313f},
-std::array<float,2>{0.568643153f, 0.823336184f},
-std::array<float,2>{0.341662109f, 0.707766771f},
-std::array<float,2>{0.811391532f, 0.305085152f},
-std::array<float,2>{0.438170463f, 0.161228612f},
-std::array<float,2>{0.946439624f, 0.889668584f},
-std::array<float,2>{0.0144079803f, 0.542096734f},
-std::array<float,2>{0.709440231f, 0.472760469f},
-std::array<float,2>{0.201030269f, 0.32794413f},
-std::array<float,2>{0.542859912f, 0.677749634f},
-std::array<float,2>{0.27496931f, 0.799927533f},
-std::array<float,2>{0.849387765f, 0.12190824f},
-std::array<float,2>{0.33009702f, 0.419455856f},
-std::array<float,2>{0.797773123f, 0.604857147f},
-std::array<float,2>{0.164385334f, 0.962785721f},
-std::array<float,2>{0.575942934f, 0.214268014f},
-std::array<float,2>{0.0739280283f, 0.00673607923f},
-std::array<float,2>{0.666348934f, 0.859394789f},
-std::array<float,2>{0.424295664f, 0.72293961f},
-std::array<float,2>{0.934741735f, 0.272162944f},
-std::array<float,2>{0.308954984f, 0.0933680385f},
-std::array<float,2>{0.815125644f, 0.766513586f},
-std::array<float,2>{0.234637707f, 0.638670623f},
-std::array<float,2>{0.520197451f, 0.352343023f},
-std::array<float,2>{0.0586123019f, 0.456521392f},
-std::array<float,2>{0.731076062f, 0.505426049f},
-std::array<float,2>{0.483232677f, 0.914092064f},
-std::array<float,2>{0.983849466f, 0.150446773f},
-std::array<float,2>{0.381966114f, 0.297188997f},
-std::array<float,2>{0.882229269f, 0.712526619f},
-std::array<float,2>{0.107057102f, 0.820217431f},
-std::array<float,2>{0.645013571f, 0.0475005396f},
-std::array<float,2>{0.14748618f, 0.241349638f},
-std::array<float,2>{0.599000514f, 0.975130618f},
-std::array<float,2>{0.349732071f, 0.579726458f},
-std::array<float,2>{0.757162094f, 0.385246873f},
-std::array<float,2>{0.418457657f, 0.0348196216f},
-std::array<float,2>{0.916832924f, 0.840934396f},
-std::array<float,2>{0.0848435238f, 0.690075159f},
-std::array<float,2>{0.685696602f, 0.294829428f},
-std::array<float,2>{0.184203133f, 0.394804835f},
-std::array<float,2>{0.584862232f, 0.576149523f},
-std::array<float,2>{0.320610881f, 0.991279602f},
-std::array<float,2>{0.783007383f, 0.221553296f},
-std::array<float,2>{0.263942122f, 0.371322006f},
-std::array<float,2>{0.866782367f, 0.643767834f},
-std::array<float,2>{0.206754848f, 0.751808941f},
-std::array<float,2>{0.554046273f, 0.0681680143f},
-std::array<float,2>{0.0259848703f, 0.133880094f},
-std::array<float,2>{0.701291442f, 0.931040645f},
-std::array<float,2>{0.460030288f, 0.523246586f},
-std::array<float,2>{0.964277208f, 0.443388075f},
-std::array<float,2>{0.359451681f, 0.1918993f},
-std::array<float,2>{0.767702639f, 0.944801569f},
-std::array<float,2>{0.126273021f, 0.616492987f},
-std::array<float,2>{0.610844135f, 0.424975991f},
-std::array<float,2>{0.119570076f, 0.25425446f},
-std::array<float,2>{0.62693429f, 0.736689448f},
-std::array<float,2>{0.404665053f, 0.846672237f},
-std::array<float,2>{0.890756011f, 0.0157743208f},
-std::array<float,2>{0.486152083f, 0.496223122f},
-std::array<float,2>{0.988818884f, 0.552349031f},
-std::array<float,2>{0.0342563614f, 0.905853868f},
-std::array<float,2>{0.744470596f, 0.175265804f},
-std::array<float,2>{0.219039902f, 0.102557994f},
-std::array<float,2>{0.500578165f, 0.796640575f},
-std::array<float,2>{0.28420496f, 0.667638421f},
-std::array<float,2>{0.83592993f, 0.328563541f},
-std::array<float,2>{0.453879744f, 0.209947199f},
-std::array<float,2>{0.966187477f, 0.955308795f},
-std::array<float,2>{0.0295296852f, 0.600117743f},
-std::array<float,2>{0.695481777f, 0.407770813f},
-std::array<float,2>{0.209956959f, 0.274201095f},
-std::array<float,2>{0.547674298f, 0.732738256f},
-std::array<float,2>{0.259952396f, 0.867379725f},
-std::array<float,2>{0.861146629f, 0.0124985343f},
-std::array<float,2>{0.327982396f, 0.48147881f},
-std::array<float,2>{0.785721362f, 0.532103896f},
-std::array<float,2>{0.180969492f, 0.877852023f},
-std::array<float,2>{0.581599772f, 0.164530903f},
-std::array<float,2>{0.0806039348f, 0.114971541f},
-std::array<float,2>{0.683578551f, 0.809209704f},
-std::array<float,2>{0.41420278f, 0.681658745f},
-std::array<float,2>{0.918726146f, 0.320271641f},
-std::array<float,2>{0.286845863f, 0.0601813607f},
-std::array<float,2>{0.830483496f, 0.824841619f},
-std::array<float,2>{0.223723695f, 0.703690469f},
-std::array<float,2>{0.507057846f, 0.310145646f},
-std::array<float,2>{0.0352641456f, 0.379827529f},
-std::array<float,2>{0.746201992f, 0.588116884f},
-std::array<float,2>{0.489719838f, 0.983761787f},
-std::array<float,2>{0.986733735f, 0.242826194f},
-std::array<float,2>{0.39947626f, 0.344543219f},
-std::array<float,2>{0.8960374f, 0.629055858f},
-std::array<float,2>{0.123740546f, 0.777094245f},
-std::array<float,2>{0.629973352f, 0.0802925453f},
-std::array<float,2>{0.130577952f, 0.142674476f},
-std::array<float,2>{0.616337001f, 0.908982873f},
-std::array<float,2>{0.3637968f, 0.512611747f},
-std::array<float,2>{0.769808888f, 0.464977056f},
-std::array<float,2>{0.427370399f, 0.0721477941f},
-std::array<float,2>{0.93084991f, 0.76010555f},
-std::array<float,2>{0.0773884505f, 0.649169445f},
-std::array<float,2>{0.669221163f, 0.365769297f},
-std::array<float,2>{0.168443114f, 0.451457471f},
-std::array<float,2>{0.57339716f, 0.524835885f},
-std::array<float,2>{0.332504153f, 0.924634814f},
-std::array<float,2>{0.803473234f, 0.128415406f},
-std::array<float,2>{0.278334945f, 0.28417623f},
-std::array<float,2>{0.846406758f, 0.702599645f},
-std::array<float,2>{0.198850825f, 0.83336705f},
-std::array<float,2>{0.546610951f, 0.0466499664f},
-std::array<float,2>{0.0113859912f, 0.228386894f},
-std::array<float,2>{0.703375459f, 0.996621192f},
-std::array<float,2>{0.44251141f, 0.569918156f},
-std::array<float,2>{0.952292025f, 0.399278522f},
-std::array<float,2>{0.344128251f, 0.18588841f},
-std::array<float,2>{0.751865029f, 0.893214762f},
-std::array<float,2>{0.144297197f, 0.556123376f},
-std::array<float,2>{0.596423566f, 0.489432663f},
-std::array<float,2>{0.102031976f, 0.340239048f},
-std::array<float,2>{0.643902421f, 0.659615576f},
-std::array<float,2>{0.376314312f, 0.781663775f},
-std::array<float,2>{0.878350019f, 0.100715987f},
-std::array<float,2>{0.479598433f, 0.437169015f},
-std::array<float,2>{0.980271518f, 0.619228125f},
-std::array<float,2>{0.057183139f, 0.947841942f},
-std::array<float,2>{0.729257822f, 0.202789247f},
-std::array<float,2>{0.240204141f, 0.0271229055f},
-std::array<float,2>{0.51745069f, 0.853523076f},
-std::array<float,2>{0.308042616f, 0.748154104f},
-std::array<float,2>{0.819039822f, 0.261175454f},
-std::array<float,2>{0.384062469f, 0.137192085f},
-std::array<float,2>{0.888658941f, 0.937213778f},
-std::array<float,2>{0.0971010998f, 0.516494811f},
-std::array<float,2>{0.654345393f, 0.438172936f},
-std::array<float,2>{0.154573008f, 0.370035082f},
-std::array<float,2>{0.604723036f, 0.647551358f},
-std::array<float,2>{0.358895928f, 0.756735981f},
-std::array<float,2>{0.760702252f, 0.0639912412f},
-std::array<float,2>{0.299564928f, 0.390748888f},
-std::array<float,2>{0.820667982f, 0.57112509f},
-std::array<float,2>{0.24859941f, 0.986304462f},
-std::array<float,2>{0.528570831f, 0.226299658f},
-std::array<float,2>{0.0535577051f, 0.0365882367f},
-std::array<float,2>{0.724403918f, 0.837688446f},
-std::array<float,2>{0.472753525f, 0.692754686f},
-std::array<float,2>{0.973000109f, 0.291783839f},
-std::array<float,2>{0.337316215f, 0.10641104f},
-std::array<float,2>{0.80810684f, 0.790733874f},
-std::array<float,2>{0.160225764f, 0.671067595f},
-std::array<float,2>{0.564505756f, 0.334874868f},
-std::array<float,2>{0.0653639659f, 0.493624955f},
-std::array<float,2>{0.659379005f, 0.548701227f},
-std::array<float,2>{0.433879346f, 0.9016276f},
-std::array<float,2>{0.925922334f, 0.179252297f},
-std::array<float,2>{0.446852237f, 0.252527535f},
-std::array<float,2>{0.94242239f, 0.738784015f},
-std::array<float,2>{0.00458570989f, 0.850698888f},
-std::array<float,2>{0.715299249f, 0.0230632909f},
-std::array<float,2>{0.191802248f, 0.188225091f},
-std::array<float,2>{0.537123144f, 0.938467979f},
-std::array<float,2>{0.270459205f, 0.612907708f},
-std::array<float,2>{0.852633119f, 0.42910555f},
-std::array<float,2>{0.497564852f, 0.00252323877f},
-std::array<float,2>{0.995232522f, 0.866455376f},
-std::array<float,2>{0.0419466905f, 0.721768558f},
-std::array<float,2>{0.736425817f, 0.269396007f},
-std::array<float,2>{0.233895242f, 0.414991289f},
-std::array<float,2>{0.510245979f, 0.605612576f},
-std::array<float,2>{0.294958055f, 0.967170477f},
-std::array<float,2>{0.837865829f, 0.218584299f},
-std::array<float,2>{0.370595634f, 0.321109802f},
-std::array<float,2>{0.776445687f, 0.672396183f},
-std::array<float,2>{0.133230686f, 0.804140985f},
-std::array<float,2>{0.623744607f, 0.118605487f},
-std::array<float,2>{0.111169137f, 0.158014104f},
-std::array<float,2>{0.636652768f, 0.883636892f},
-std::array<float,2>{0.393851936f, 0.543823123f},
-std::array<float,2>{0.898504734f, 0.470977783f},
-std::array<float,2>{0.257013589f, 0.23592566f},
-std::array<float,2>{0.870776653f, 0.971578002f},
-std::array<float,2>{0.214327469f, 0.584131777f},
-std::array<float,2>{0.559429824f, 0.38679105f},
-std::array<float,2>{0.0177505799f, 0.303987056f},
-std::array<float,2>{0.690298676f, 0.717118084f},
-std::array<float,2>{0.465708137f, 0.815373778f},
-std::array<float,2>{0.95760417f, 0.0537238866f},
-std::array<float,2>{0.408845186f, 0.458283305f},
-std::array<float,2>{0.910920084f, 0.501350105f},
-std::array<float,2>{0.0887611285f, 0.920302093f},
-std::array<float,2>{0.677049339f, 0.155378476f},
-std::array<float,2>{0.179669693f, 0.0897948444f},
-std::array<float,2>{0.589937687f, 0.771680832f},
-std::array<float,2>{0.313671947f, 0.632991433f},
-std::array<float,2>{0.794699788f, 0.358660728f},
-std::array<float,2>{0.421289176f, 0.220824614f},
-std::array<float,2>{0.915360808f, 0.992135227f},
-std::array<float,2>{0.0829436481f, 0.57549119f},
-std::array<float,2>{0.683799446f, 0.395222992f},
-std::array<float,2>{0.187279522f, 0.294077396f},
-std::array<float,2>{0.582692564f, 0.689935148f},
-std::array<float,2>{0.322285742f, 0.841377199f},
-std::array<float,2>{0.783608675f, 0.0344080217f},
-std::array<float,2>{0.263138741f, 0.444176525f},
-std::array<float,2>{0.863453925f, 0.522713661f},
-std::array<float,2>{0.204007775f, 0.931259573f},
-std::array<float,2>{0.551710367f, 0.134580508f},
-std::array<float,2>{0.0253361557f, 0.0677490607f},
-std::array<float,2>{0.699793458f, 0.751265466f},
-std::array<float,2>{0.457790047f, 0.64436096f},
-std::array<float,2>{0.961099505f, 0.371805876f},
-std::array<float,2>{0.362775266f, 0.016533846f},
-std::array<float,2>{0.7666713f, 0.845757306f},
-std::array<float,2>{0.128103673f, 0.736972451f},
-std::array<float,2>{0.611640513f, 0.254815906f},
-std::array<float,2>{0.118944392f, 0.425351351f},
-std::array<float,2>{0.627984524f, 0.616786897f},
-std::array<float,2>{0.404149801f, 0.944869578f},
-std::array<float,2>{0.8932423f, 0.191804647f},
-std::array<float,2>{0.486997634f, 0.328778684f},
-std::array<float,2>{0.990407407f, 0.66707623f},
-std::array<float,2>{0.0330198966f, 0.795966327f},
-std::array<float,2>{0.743302107f, 0.103206858f},
-std::array<float,2>{0.222099498f, 0.175310507f},
-std::array<float,2>{0.502649605f, 0.905537069f},
-std::array<float,2>{0.282109529f, 0.55194664f},
-std::array<float,2>{0.833639503f, 0.496627033f},
-std::array<float,2>{0.441188365f, 0.121574655f},
-std::array<float,2>{0.947922111f, 0.80051589f},
-std::array<float,2>{0.0131650558f, 0.678633451f},
-std::array<float,2>{0.708365321f, 0.327150583f},
-std::array<float,2>{0.202602923f, 0.473153383f},
-std::array<float,2>{0.539330125f, 0.542741358f},
-std::array<float,2>{0.276981831f, 0.890451789f},
-std::array<float,2>{0.850656927f, 0.162082598f},
-std::array<float,2>{0.328782946f, 0.271842599f},
-std::array<float,2>{0.80028379f, 0.723192036f},
-std::array<float,2>{0.167142406f, 0.859994233f},
-std::array<float,2>{0.576181173f, 0.00627468061f},
-std::array<float,2>{0.0714345798f, 0.214616463f},
-std::array<float,2>{0.664305627f, 0.962036192f},
-std::array<float,2>{0.421919376f, 0.605156064f},
-std::array<float,2>{0.935569823f, 0.419101328f},
-std::array<float,2>{0.312296182f, 0.151052594f},
-std::array<float,2>{0.812605441f, 0.915008068f},
-std::array<float,2>{0.236886978f, 0.505142689f},
-std::array<float,2>{0.521975458f, 0.456795692f},
-std::array<float,2>{0.0622107089f, 0.351665437f},
-std::array<float,2>{0.734132111f, 0.637710094f},
-std::array<float,2>{0.481853753f, 0.76602602f},
-std::array<float,2>{0.982049167f, 0.0931007788f},
-std::array<float,2>{0.380377769f, 0.385415822f},
-std::array<float,2>{0.87977773f, 0.579220414f},
-std::array<float,2>{0.108461492f, 0.974636495f},
-std::array<float,2>{0.647526085f, 0.242120937f},
-std::array<float,2>{0.145303324f, 0.0469503291f},
-std::array<float,2>{0.601452947f, 0.819751441f},
-std::array<float,2>{0.348455429f, 0.712361038f},
-std::array<float,2>{0.755749226f, 0.297663122f},
-std::array<float,2>{0.470629603f, 0.170642242f},
-std::array<float,2>{0.972046733f, 0.880562365f},
-std::array<float,2>{0.0488493033f, 0.535351634f},
-std::array<float,2>{0.721184075f, 0.478630066f},
-std::array<float,2>{0.245823786f, 0.314202696f},
-std::array<float,2>{0.525948048f, 0.685974717f},
-std::array<float,2>{0.303939968f, 0.808434069f},
-std::array<float,2>{0.824508548f, 0.110760875f},
-std::array<float,2>{0.353342652f, 0.411048502f},
-std::array<float,2>{0.761824489f, 0.597222924f},
-std::array<float,2>{0.15190959f, 0.957385123f},
-std::array<float,2>{0.607070744f, 0.204628482f},
-std::array<float,2>{0.101038866f, 0.0107050529f},
-std::array<float,2>{0.649203539f, 0.874485195f},
-std::array<float,2>{0.389865577f, 0.727213919f},
-std::array<float,2>{0.886268318f, 0.278235465f},
-std::array<float,2>{0.266712129f, 0.0853261054f},
-std::array<float,2>{0.856745064f, 0.780027986f},
-std::array<float,2>{0.189040989f, 0.625685096f},
-std::array<float,2>{0.531609595f, 0.349788576f},
-std::array<float,2>{0.000244076014f, 0.461668879f},
-std::array<float,2>{0.714606225f, 0.50877279f},
-std::array<float,2>{0.450759679f, 0.91282022f},
-std::array<float,2>{0.940472305f, 0.146490306f},
-std::array<float,2>{0.432727814f, 0.305435598f},
-std::array<float,2>{0.925608754f, 0.707077503f},
-std::array<float,2>{0.068307355f, 0.823783159f},
-std::array<float,2>{0.662976146f, 0.0569219887f},
-std::array<float,2>{0.15970014f, 0.247425064f},
-std::array<float,2>{0.566984117f, 0.977325082f},
-std::array<float,2>{0.342460096f, 0.593547523f},
-std::array<float,2>{0.809938431f, 0.3757644f},
-std::array<float,2>{0.395436108f, 0.0392930768f},
-std::array<float,2>{0.902739882f, 0.828893423f},
-std::array<float,2>{0.116863161f, 0.697236896f},
-std::array<float,2>{0.638825953f, 0.287706941f},
-std::array<float,2>{0.138330385f, 0.404393107f},
-std::array<float,2>{0.617879629f, 0.563382387f},
-std::array<float,2>{0.371284842f, 0.995907664f},
-std::array<float,2>{0.779571414f, 0.230659783f},
-std::array<float,2>{0.292749047f, 0.361933053f},
-std::array<float,2>{0.841917515f, 0.655851841f},
-std::array<float,2>{0.228177041f, 0.762137711f},
-std::array<float,2>{0.512213588f, 0.0772147849f},
-std::array<float,2>{0.0452891327f, 0.129577488f},
-std::array<float,2>{0.740869462f, 0.928798616f},
-std::array<float,2>{0.496031076f, 0.531019866f},
-std::array<float,2>{0.999302089f, 0.448793352f},
-std::array<float,2>{0.319443762f, 0.196771011f},
-std::array<float,2>{0.791430235f, 0.949313283f},
-std::array<float,2>{0.175551176f, 0.623041987f},
-std::array<float,2>{0.588098168f, 0.430921644f},
-std::array<float,2>{0.0934613869f, 0.263801813f},
-std::array<float,2>{0.673346162f, 0.745666027f},
-std::array<float,2>{0.412278235f, 0.857086658f},
-std::array<float,2>{0.90954864f, 0.0275483094f},
-std::array<float,2>{0.461540699f, 0.48579973f},
-std::array<float,2>{0.953450322f, 0.560736895f},
-std::array<float,2>{0.0208153371f, 0.895110726f},
-std::array<float,2>{0.692494273f, 0.182914302f},
-std::array<float,2>{0.21866037f, 0.0966896489f},
-std::array<float,2>{0.554994404f, 0.787512064f},
-std::array<float,2>{0.253532827f, 0.66348058f},
-std::array<float,2>{0.87460655f, 0.336532533f},
-std::array<float,2>{0.491476715f, 0.24456358f},
-std::array<float,2>{0.985711813f, 0.981878459f},
-std::array<float,2>{0.0380558483f, 0.586155355f},
-std::array<float,2>{0.749284089f, 0.38109833f},
-std::array<float,2>{0.224786997f, 0.310821474f},
-std::array<float,2>{0.505335212f, 0.705368578f},
-std::array<float,2>{0.288544625f, 0.826473117f},
-std::array<float,2>{0.829998314f, 0.0609770678f},
-std::array<float,2>{0.366900563f, 0.468265742f},
-std::array<float,2>{0.773195028f, 0.514589548f},
-std::array<float,2>{0.13140668f, 0.90813458f},
-std::array<float,2>{0.613333881f, 0.142577887f},
-std::array<float,2>{0.121150687f, 0.0799723044f},
-std::array<float,2>{0.632639468f, 0.774650216f},
-std::array<float,2>{0.401337892f, 0.632686138f},
-std::array<float,2>{0.897752881f, 0.347218126f},
-std::array<float,2>{0.259530306f, 0.0145743182f},
-std::array<float,2>{0.862931192f, 0.870003343f},
-std::array<float,2>{0.207655594f, 0.732174754f},
-std::array<float,2>{0.550641f, 0.275492221f},
-std::array<float,2>{0.0285835583f, 0.409552038f},
-std::array<float,2>{0.698794067f, 0.598991096f},
-std::array<float,2>{0.455649853f, 0.953296065f},
-std::array<float,2>{0.967546701f, 0.207884878f},
-std::array<float,2>{0.416584104f, 0.317422718f},
-std::array<float,2>{0.920078218f, 0.681262255f},
-std::array<float,2>{0.0796909332f, 0.810827911f},
-std::array<float,2>{0.680421829f, 0.116523109f},
-std::array<float,2>{0.182273209f, 0.166334376f},
-std::array<float,2>{0.579708576f, 0.875821471f},
-std::array<float,2>{0.325280517f, 0.53422612f},
-std::array<float,2>{0.789005339f, 0.482729822f},
-std::array<float,2>{0.377369404f, 0.099132739f},
-std::array<float,2>{0.876617253f, 0.784305751f},
-std::array<float,2>{0.1035266f, 0.657765746f},
-std::array<float,2>{0.640883982f, 0.343639255f},
-std::array<float,2>{0.140787587f, 0.49173981f},
-std::array<float,2>{0.595000863f, 0.557741702f},
-std::array<float,2>{0.346081942f, 0.891628087f},
-std::array<float,2>{0.753665805f, 0.184211716f},
-std::array<float,2>{0.306093097f, 0.259165674f},
-std::array<float,2>{0.817803085f, 0.747470021f},
-std::array<float,2>{0.24151732f, 0.852149069f},
-std::array<float,2>{0.517958701f, 0.0250221174f},
-std::array<float,2>{0.0553515218f, 0.201077878f},
-std::array<float,2>{0.727204919f, 0.946398914f},
-std::array<float,2>{0.478237182f, 0.618211091f},
-std::array<float,2>{0.977995634f, 0.435135752f},
-std::array<float,2>{0.334134519f, 0.126646563f},
-std::array<float,2>{0.801646769f, 0.92342782f},
-std::array<float,2>{0.170836568f, 0.527164519f},
-std::array<float,2>{0.570524633f, 0.450904697f},
-std::array<float,2>{0.0759366304f, 0.365155846f},
-std::array<float,2>{0.671872556f, 0.651319742f},
-std::array<float,2>{0.428586662f, 0.758228719f},
-std::array<float,2>{0.932811677f, 0.073070161f},
-std::array<float,2>{0.443445772f, 0.400892228f},
-std::array<float,2>{0.949613631f, 0.567765176f},
-std::array<float,2>{0.00878985692f, 0.998559594f},
-std::array<float,2>{0.706231356f, 0.229319438f},
-std::array<float,2>{0.19577302f, 0.0439199433f},
-std::array<float,2>{0.543367922f, 0.834653437f},
-std::array<float,2>{0.280032426f, 0.699398816f},
-std::array<float,2>{0.845309138f, 0.282320678f},
-std::array<float,2>{0.437271267f, 0.17624189f},
-std::array<float,2>{0.929180503f, 0.900140285f},
-std::array<float,2>{0.063794069f, 0.549881935f},
-std::array<float,2>{0.657220483f, 0.494998217f},
-std::array<float,2>{0.162642986f, 0.333088636f},
-std::array<float,2>{0.562574685f, 0.668733239f},
-std::array<float,2>{0.338024825f, 0.792491734f},
-std::array<float,2>{0.80630517f, 0.10778226f},
-std::array<float,2>{0.272116184f, 0.425917327f},
-std::array<float,2>{0.854471922f, 0.610011041f},
-std::array<float,2>{0.193551674f, 0.940137923f},
-std::array<float,2>{0.53587091f, 0.189956501f},
-std::array<float,2>{0.00711527653f, 0.0213838443f},
-std::array<float,2>{0.717088699f, 0.84883523f},
-std::array<float,2>{0.448844343f, 0.740237236f},
-std::array<float,2>{0.945137382f, 0.251084149f},
-std::array<float,2>{0.357341468f, 0.0647737086f},
-std::array<float,2>{0.758752286f, 0.75516516f},
-std::array<float,2>{0.153848499f, 0.646366417f},
-std::array<float,2>{0.602243304f, 0.367693931f},
-std::array<float,2>{0.0945334882f, 0.439537197f},
-std::array<float,2>{0.654031634f, 0.518781066f},
-std::array<float,2>{0.385726184f, 0.935526371f},
-std::array<float,2>{0.88915211f, 0.140352428f},
-std::array<float,2>{0.475697726f, 0.290495157f},
-std::array<float,2>{0.975266397f, 0.695179164f},
-std::array<float,2>{0.0518128462f, 0.839220941f},
-std::array<float,2>{0.725735962f, 0.0376456678f},
-std::array<float,2>{0.247281253f, 0.223415568f},
-std::array<float,2>{0.530865312f, 0.987088144f},
-std::array<float,2>{0.29828617f, 0.572796345f},
-std::array<float,2>{0.822436988f, 0.394312978f},
-std::array<float,2>{0.467600912f, 0.0521807037f},
-std::array<float,2>{0.960761189f, 0.814396262f},
-std::array<float,2>{0.0157556664f, 0.71665585f},
-std::array<float,2>{0.688099384f, 0.302547961f},
-std::array<float,2>{0.211680815f, 0.388805807f},
-std::array<float,2>{0.560742378f, 0.582411885f},
-std::array<float,2>{0.255747557f, 0.970026553f},
-std::array<float,2>{0.868118942f, 0.236852974f},
-std::array<float,2>{0.315610707f, 0.357040524f},
-std::array<float,2>{0.796185493f, 0.636303902f},
-std::array<float,2>{0.17691277f, 0.771438658f},
-std::array<float,2>{0.593558311f, 0.0878484249f},
-std::array<float,2>{0.0859429687f, 0.153999016f},
-std::array<float,2>{0.678856015f, 0.918999612f},
-std::array<float,2>{0.40808624f, 0.503196716f},
-std::array<float,2>{0.913254201f, 0.459674448f},
-std::array<float,2>{0.29333511f, 0.216433987f},
-std::array<float,2>{0.838225722f, 0.965669632f},
-std::array<float,2>{0.2311178f, 0.608441412f},
-std::array<float,2>{0.509400606f, 0.417148411f},
-std::array<float,2>{0.0408605225f, 0.267158598f},
-std::array<float,2>{0.735080004f, 0.720254123f},
-std::array<float,2>{0.499654263f, 0.863447011f},
-std::array<float,2>{0.993044734f, 0.00132689031f},
-std::array<float,2>{0.390779167f, 0.470225543f},
-std::array<float,2>{0.901750147f, 0.546795547f},
-std::array<float,2>{0.112980232f, 0.885978043f},
-std::array<float,2>{0.634133101f, 0.159810439f},
-std::array<float,2>{0.135431871f, 0.12099193f},
-std::array<float,2>{0.621215284f, 0.801655591f},
-std::array<float,2>{0.367681414f, 0.674204051f},
-std::array<float,2>{0.774068415f, 0.322573662f},
-std::array<float,2>{0.404960901f, 0.194846794f},
-std::array<float,2>{0.89121449f, 0.942411959f},
-std::array<float,2>{0.120008394f, 0.613679349f},
-std::array<float,2>{0.626145542f, 0.422014982f},
-std::array<float,2>{0.12650615f, 0.256729901f},
-std::array<float,2>{0.610547543f, 0.735847116f},
-std::array<float,2>{0.36002332f, 0.845035791f},
-std::array<float,2>{0.768441677f, 0.0189135484f},
-std::array<float,2>{0.285004854f, 0.499902993f},
-std::array<float,2>{0.835263908f, 0.553517699f},
-std::array<float,2>{0.219297796f, 0.902499616f},
-std::array<float,2>{0.500059903f, 0.172118977f},
-std::array<float,2>{0.0348100848f, 0.105319105f},
-std::array<float,2>{0.744905233f, 0.794729471f},
-std::array<float,2>{0.485737294f, 0.665798485f},
-std::array<float,2>{0.988656759f, 0.331582367f},
-std::array<float,2>{0.321103811f, 0.0328398272f},
-std::array<float,2>{0.782597065f, 0.843359232f},
-std::array<float,2>{0.183780774f, 0.687755644f},
-std::array<float,2>{0.584303558f, 0.295649856f},
-std::array<float,2>{0.0843219832f, 0.396959186f},
-std::array<float,2>{0.686398447f, 0.576953292f},
-std::array<float,2>{0.418117255f, 0.989081204f},
-std::array<float,2>{0.916098356f, 0.219079107f},
-std::array<float,2>{0.460660428f, 0.374695688f},
-std::array<float,2>{0.964673936f, 0.641472578f},
-std::array<float,2>{0.0255208574f, 0.753012717f},
-std::array<float,2>{0.70175457f, 0.0699329525f},
-std::array<float,2>{0.206131503f, 0.136418298f},
-std::array<float,2>{0.554489374f, 0.932723224f},
-std::array<float,2>{0.264516145f, 0.521049023f},
-std::array<float,2>{0.866410494f, 0.442642897f},
-std::array<float,2>{0.482774168f, 0.0904634818f},
-std::array<float,2>{0.983927965f, 0.767699242f},
-std::array<float,2>{0.0595204607f, 0.639944196f},
-std::array<float,2>{0.730811834f, 0.355054379f},
-std::array<float,2>{0.235116109f, 0.45424363f},
-std::array<float,2>{0.519873619f, 0.506650984f},
-std::array<float,2>{0.309510589f, 0.916844249f},
-std::array<float,2>{0.814925432f, 0.149962768f},
-std::array<float,2>{0.350120634f, 0.299969941f},
-std::array<float,2>{0.757529438f, 0.714360952f},
-std::array<float,2>{0.148248404f, 0.817641139f},
-std::array<float,2>{0.599607229f, 0.0494237207f},
-std::array<float,2>{0.106563352f, 0.23852177f},
-std::array<float,2>{0.64512825f, 0.973403931f},
-std::array<float,2>{0.382727683f, 0.580136836f},
-std::array<float,2>{0.882564068f, 0.384138554f},
-std::array<float,2>{0.274783701f, 0.162927315f},
-std::array<float,2>{0.848941386f, 0.887119949f},
-std::array<float,2>{0.200536713f, 0.539839506f},
-std::array<float,2>{0.542095959f, 0.47622323f},
-std::array<float,2>{0.0139401592f, 0.324990869f},
-std::array<float,2>{0.709628105f, 0.6768682f},
-std::array<float,2>{0.437906891f, 0.797438264f},
-std::array<float,2>{0.947155595f, 0.123868085f},
-std::array<float,2>{0.42458123f, 0.42079249f},
-std::array<float,2>{0.935212851f, 0.601921082f},
-std::array<float,2>{0.0736114979f, 0.963646054f},
-std::array<float,2>{0.666828632f, 0.212701291f},
-std::array<float,2>{0.164583385f, 0.00498362537f},
-std::array<float,2>{0.575585365f, 0.861890972f},
-std::array<float,2>{0.330802917f, 0.724730015f},
-std::array<float,2>{0.797360599f, 0.271052182f},
-std::array<float,2>{0.45129016f, 0.144703776f},
-std::array<float,2>{0.938123465f, 0.912057877f},
-std::array<float,2>{0.00358994072f, 0.511209667f},
-std::array<float,2>{0.712318897f, 0.463017583f},
-std::array<float,2>{0.191389278f, 0.34906888f},
-std::array<float,2>{0.53326869f, 0.628502607f},
-std::array<float,2>{0.268727869f, 0.779071152f},
-std::array<float,2>{0.857732296f, 0.0834828466f},
-std::array<float,2>{0.341133714f, 0.3782157f},
-std::array<float,2>{0.810740888f, 0.591166198f},
-std::array<float,2>{0.157804355f, 0.979332209f},
-std::array<float,2>{0.569042265f, 0.249738142f},
-std::array<float,2>{0.068965815f, 0.0556135029f},
-std::array<float,2>{0.66097647f, 0.822125435f},
-std::array<float,2>{0.430764645f, 0.710343599f},
-std::array<float,2>{0.923402548f, 0.308019578f},
-std::array<float,2>{0.301632404f, 0.112253696f},
-std::array<float,2>{0.827458858f, 0.805703759f},
-std::array<float,2>{0.242485628f, 0.684007943f},
-std::array<float,2>{0.52356118f, 0.315595239f},
-std::array<float,2>{0.0482570305f, 0.477862597f},
-std::array<float,2>{0.719950795f, 0.53802824f},
-std::array<float,2>{0.472348303f, 0.881913602f},
-std::array<float,2>{0.96935612f, 0.168278128f},
-std::array<float,2>{0.386756659f, 0.279878765f},
-std::array<float,2>{0.884554327f, 0.728659809f},
-std::array<float,2>{0.0991227776f, 0.871357083f},
-std::array<float,2>{0.65104425f, 0.00950163882f},
-std::array<float,2>{0.149267048f, 0.206334755f},
-std::array<float,2>{0.608162165f, 0.959330499f},
-std::array<float,2>{0.354767919f, 0.595407307f},
-std::array<float,2>{0.764092743f, 0.412377119f},
-std::array<float,2>{0.412093252f, 0.0300750118f},
-std::array<float,2>{0.906671643f, 0.859053671f},
-std::array<float,2>{0.0902272463f, 0.742670774f},
-std::array<float,2>{0.674731076f, 0.262188613f},
-std::array<float,2>{0.172012448f, 0.433493674f},
-std::array<float,2>{0.586374223f, 0.624025762f},
-std::array<float,2>{0.318300068f, 0.95193994f},
-std::array<float,2>{0.789108932f, 0.198433638f},
-std::array<float,2>{0.251364499f, 0.338476658f},
-std::array<float,2>{0.872419715f, 0.661123633f},
-std::array<float,2>{0.215019032f, 0.78692621f},
-std::array<float,2>{0.55730325f, 0.0943449065f},
-std::array<float,2>{0.0228156094f, 0.180608034f},
-std::array<float,2>{0.694285333f, 0.897195041f},
-std::array<float,2>{0.463056058f, 0.560488462f},
-std::array<float,2>{0.956829548f, 0.487643838f},
-std::array<float,2>{0.373583108f, 0.232620224f},
-std::array<float,2>{0.778174818f, 0.992660344f},
-std::array<float,2>{0.139416009f, 0.565048635f},
-std::array<float,2>{0.620413482f, 0.402690351f},
-std::array<float,2>{0.114039734f, 0.286614001f},
-std::array<float,2>{0.638435483f, 0.697388053f},
-std::array<float,2>{0.396560639f, 0.830989659f},
-std::array<float,2>{0.905924857f, 0.0418912545f},
-std::array<float,2>{0.492928118f, 0.447036952f},
-std::array<float,2>{0.997303307f, 0.528810322f},
-std::array<float,2>{0.0438285097f, 0.925806284f},
-std::array<float,2>{0.739082634f, 0.13164027f},
-std::array<float,2>{0.229146019f, 0.0753922984f},
-std::array<float,2>{0.514187276f, 0.763712585f},
-std::array<float,2>{0.289337605f, 0.654146016f},
-std::array<float,2>{0.841641903f, 0.359945416f},
-std::array<float,2>{0.442142844f, 0.230308697f},
-std::array<float,2>{0.951791465f, 0.999760985f},
-std::array<float,2>{0.0105577419f, 0.566823065f},
-std::array<float,2>{0.705073237f, 0.402194202f},
-std::array<float,2>{0.197921723f, 0.281781673f},
-std::array<float,2>{0.545098901f, 0.700492918f},
-std::array<float,2>{0.278131902f, 0.83505708f},
-std::array<float,2>{0.847486258f, 0.0443397351f},
-std::array<float,2>{0.333683789f, 0.449413359f},
-std::array<float,2>{0.804647684f, 0.52608937f},
-std::array<float,2>{0.169364423f, 0.921961546f},
-std::array<float,2>{0.572786868f, 0.125661612f},
-std::array<float,2>{0.0765079036f, 0.0735319182f},
-std::array<float,2>{0.668402374f, 0.759073853f},
-std::array<float,2>{0.426352262f, 0.652068079f},
-std::array<float,2>{0.929919422f, 0.364243537f},
-std::array<float,2>{0.307492673f, 0.024203768f},
-std::array<float,2>{0.819743514f, 0.8534953f},
-std::array<float,2>{0.238845602f, 0.746889591f},
-std::array<float,2>{0.515841246f, 0.258127391f},
-std::array<float,2>{0.0581891276f, 0.433841914f},
-std::array<float,2>{0.73018676f, 0.617252707f},
-std::array<float,2>{0.479450077f, 0.946181417f},
-std::array<float,2>{0.97909385f, 0.199402511f},
-std::array<float,2>{0.375370175f, 0.342207015f},
-std::array<float,2>{0.877794743f, 0.656826615f},
-std::array<float,2>{0.103099965f, 0.783320129f},
-std::array<float,2>{0.643553138f, 0.0977330506f},
-std::array<float,2>{0.142944306f, 0.185309768f},
-std::array<float,2>{0.596821845f, 0.890979826f},
-std::array<float,2>{0.345445007f, 0.556672454f},
-std::array<float,2>{0.750689864f, 0.490705729f},
-std::array<float,2>{0.416001529f, 0.115561038f},
-std::array<float,2>{0.919710398f, 0.811583817f},
-std::array<float,2>{0.0812488347f, 0.680292666f},
-std::array<float,2>{0.681854486f, 0.316684604f},
-std::array<float,2>{0.180274427f, 0.483404696f},
-std::array<float,2>{0.580617607f, 0.534070432f},
-std::array<float,2>{0.326621503f, 0.876759052f},
-std::array<float,2>{0.7867769f, 0.167809471f},
-std::array<float,2>{0.261629343f, 0.277037472f},
-std::array<float,2>{0.859620392f, 0.730613947f},
-std::array<float,2>{0.21009846f, 0.87039423f},
-std::array<float,2>{0.548061371f, 0.0155656096f},
-std::array<float,2>{0.0304374825f, 0.208414972f},
-std::array<float,2>{0.697261333f, 0.9541502f},
-std::array<float,2>{0.454744041f, 0.597925961f},
-std::array<float,2>{0.965425849f, 0.408333898f},
-std::array<float,2>{0.364986002f, 0.141013771f},
-std::array<float,2>{0.77103734f, 0.906825721f},
-std::array<float,2>{0.129494339f, 0.514933228f},
-std::array<float,2>{0.615563989f, 0.467107445f},
-std::array<float,2>{0.124377266f, 0.345803976f},
-std::array<float,2>{0.629498959f, 0.631795168f},
-std::array<float,2>{0.39910078f, 0.773808479f},
-std::array<float,2>{0.894916236f, 0.0789485574f},
-std::array<float,2>{0.488572538f, 0.382305622f},
-std::array<float,2>{0.987409353f, 0.587468326f},
-std::array<float,2>{0.0367150083f, 0.98108536f},
-std::array<float,2>{0.747158051f, 0.245528534f},
-std::array<float,2>{0.223143667f, 0.0622101165f},
-std::array<float,2>{0.506438196f, 0.828123152f},
-std::array<float,2>{0.286014616f, 0.706586897f},
-std::array<float,2>{0.831804156f, 0.312458754f},
-std::array<float,2>{0.393256754f, 0.158942312f},
-std::array<float,2>{0.900367975f, 0.88527143f},
-std::array<float,2>{0.110036999f, 0.545362711f},
-std::array<float,2>{0.635340273f, 0.469506115f},
-std::array<float,2>{0.134214014f, 0.323413819f},
-std::array<float,2>{0.624622643f, 0.675243318f},
-std::array<float,2>{0.369438708f, 0.802506268f},
-std::array<float,2>{0.775750756f, 0.119472913f},
-std::array<float,2>{0.296564728f, 0.416637301f},
-std::array<float,2>{0.83652693f, 0.607825816f},
-std::array<float,2>{0.233280122f, 0.96634233f},
-std::array<float,2>{0.510877311f, 0.215686858f},
-std::array<float,2>{0.0428830832f, 0.000545828138f},
-std::array<float,2>{0.73753953f, 0.865199208f},
-std::array<float,2>{0.496122301f, 0.719591677f},
-std::array<float,2>{0.994418502f, 0.265884906f},
-std::array<float,2>{0.313007265f, 0.0864834562f},
-std::array<float,2>{0.793056071f, 0.770128608f},
-std::array<float,2>{0.177822456f, 0.635105193f},
-std::array<float,2>{0.591391802f, 0.356386065f},
-std::array<float,2>{0.0890856087f, 0.460498363f},
-std::array<float,2>{0.676429808f, 0.502773106f},
-std::array<float,2>{0.409793407f, 0.918656111f},
-std::array<float,2>{0.911192536f, 0.152614608f},
-std::array<float,2>{0.466241807f, 0.301025927f},
-std::array<float,2>{0.958350658f, 0.715776682f},
-std::array<float,2>{0.0193796996f, 0.813433766f},
-std::array<float,2>{0.690646946f, 0.051433906f},
-std::array<float,2>{0.213775039f, 0.237380564f},
-std::array<float,2>{0.560360074f, 0.969726562f},
-std::array<float,2>{0.256808609f, 0.583360016f},
-std::array<float,2>{0.869486094f, 0.390264958f},
-std::array<float,2>{0.474363148f, 0.0385449044f},
-std::array<float,2>{0.974188328f, 0.838669538f},
-std::array<float,2>{0.0544960275f, 0.694186091f},
-std::array<float,2>{0.723438025f, 0.289441854f},
-std::array<float,2>{0.249766722f, 0.393169731f},
-std::array<float,2>{0.527833104f, 0.574048042f},
-std::array<float,2>{0.299928427f, 0.98783344f},
-std::array<float,2>{0.821648836f, 0.224104479f},
-std::array<float,2>{0.358393043f, 0.369045496f},
-std::array<float,2>{0.761619508f, 0.644949317f},
-std::array<float,2>{0.155884087f, 0.754532695f},
-std::array<float,2>{0.60371089f, 0.0657926947f},
-std::array<float,2>{0.0957801044f, 0.139566183f},
-std::array<float,2>{0.655871034f, 0.934174359f},
-std::array<float,2>{0.382964671f, 0.517842114f},
-std::array<float,2>{0.887025118f, 0.441365719f},
-std::array<float,2>{0.271407008f, 0.191268623f},
-std::array<float,2>{0.851980805f, 0.940899372f},
-std::array<float,2>{0.192971915f, 0.611239672f},
-std::array<float,2>{0.539045811f, 0.426861286f},
-std::array<float,2>{0.00543433102f, 0.25095889f},
-std::array<float,2>{0.716062009f, 0.741596758f},
-std::array<float,2>{0.445639759f, 0.847887278f},
-std::array<float,2>{0.942180634f, 0.0204501748f},
-std::array<float,2>{0.435199916f, 0.495476514f},
-std::array<float,2>{0.926840782f, 0.549576223f},
-std::array<float,2>{0.0662342906f, 0.898947954f},
-std::array<float,2>{0.65839082f, 0.177406847f},
-std::array<float,2>{0.161735177f, 0.108766206f},
-std::array<float,2>{0.566126943f, 0.791217327f},
-std::array<float,2>{0.335940778f, 0.669046938f},
-std::array<float,2>{0.807294488f, 0.332250595f},
-std::array<float,2>{0.423462987f, 0.21142064f},
-std::array<float,2>{0.936932564f, 0.964178145f},
-std::array<float,2>{0.0708568469f, 0.60284549f},
-std::array<float,2>{0.665395856f, 0.421125352f},
-std::array<float,2>{0.16635868f, 0.269815207f},
-std::array<float,2>{0.577164471f, 0.726167738f},
-std::array<float,2>{0.329919875f, 0.862852335f},
-std::array<float,2>{0.799436986f, 0.00396569585f},
-std::array<float,2>{0.275507212f, 0.475257963f},
-std::array<float,2>{0.850204885f, 0.540767491f},
-std::array<float,2>{0.201899707f, 0.888328612f},
-std::array<float,2>{0.540480912f, 0.163179249f},
-std::array<float,2>{0.0117851971f, 0.124308437f},
-std::array<float,2>{0.707259715f, 0.798795104f},
-std::array<float,2>{0.440304667f, 0.676028013f},
-std::array<float,2>{0.948468804f, 0.325819373f},
-std::array<float,2>{0.348985434f, 0.0502024814f},
-std::array<float,2>{0.754208624f, 0.816947818f},
-std::array<float,2>{0.146093383f, 0.71302402f},
-std::array<float,2>{0.600253165f, 0.299630582f},
-std::array<float,2>{0.107527435f, 0.382893294f},
-std::array<float,2>{0.64688164f, 0.581648886f},
-std::array<float,2>{0.379466742f, 0.974343896f},
-std::array<float,2>{0.880852044f, 0.239694044f},
-std::array<float,2>{0.480602682f, 0.353869319f},
-std::array<float,2>{0.980605304f, 0.63867259f},
-std::array<float,2>{0.0611471683f, 0.769530654f},
-std::array<float,2>{0.732631326f, 0.0914566144f},
-std::array<float,2>{0.237625048f, 0.148712426f},
-std::array<float,2>{0.522583902f, 0.917101264f},
-std::array<float,2>{0.311221391f, 0.507210672f},
-std::array<float,2>{0.813693225f, 0.453225464f},
-std::array<float,2>{0.458164603f, 0.0685430691f},
-std::array<float,2>{0.962334394f, 0.75284344f},
-std::array<float,2>{0.0234403573f, 0.641844571f},
-std::array<float,2>{0.700591743f, 0.373824507f},
-std::array<float,2>{0.205042958f, 0.442271709f},
-std::array<float,2>{0.551784396f, 0.519851387f},
-std::array<float,2>{0.262236536f, 0.932481766f},
-std::array<float,2>{0.864965618f, 0.135193884f},
-std::array<float,2>{0.323723644f, 0.296111614f},
-std::array<float,2>{0.784877539f, 0.68873632f},
-std::array<float,2>{0.186424196f, 0.841834605f},
-std::array<float,2>{0.583866894f, 0.0319070257f},
-std::array<float,2>{0.083714135f, 0.219824702f},
-std::array<float,2>{0.684836268f, 0.989631236f},
-std::array<float,2>{0.420655251f, 0.578067958f},
-std::array<float,2>{0.914415836f, 0.397714257f},
-std::array<float,2>{0.282741874f, 0.173731238f},
-std::array<float,2>{0.83244276f, 0.90361172f},
-std::array<float,2>{0.220769987f, 0.554076791f},
-std::array<float,2>{0.503628731f, 0.498462021f},
-std::array<float,2>{0.0312815011f, 0.33038342f},
-std::array<float,2>{0.742781639f, 0.664516866f},
-std::array<float,2>{0.487892419f, 0.793847799f},
-std::array<float,2>{0.9915995f, 0.104129761f},
-std::array<float,2>{0.402975351f, 0.423321009f},
-std::array<float,2>{0.893578351f, 0.615221441f},
-std::array<float,2>{0.117344424f, 0.942173958f},
-std::array<float,2>{0.627247691f, 0.193680957f},
-std::array<float,2>{0.127607539f, 0.018143218f},
-std::array<float,2>{0.61265254f, 0.844162762f},
-std::array<float,2>{0.362146139f, 0.734404743f},
-std::array<float,2>{0.766463339f, 0.25715372f},
-std::array<float,2>{0.494585216f, 0.132096574f},
-std::array<float,2>{0.998095214f, 0.92716223f},
-std::array<float,2>{0.0467468463f, 0.527981818f},
-std::array<float,2>{0.741912365f, 0.445548594f},
-std::array<float,2>{0.226656765f, 0.360925853f},
-std::array<float,2>{0.512776792f, 0.652554989f},
-std::array<float,2>{0.291284531f, 0.764886379f},
-std::array<float,2>{0.843609035f, 0.075070329f},
-std::array<float,2>{0.372302562f, 0.404126525f},
-std::array<float,2>{0.780513763f, 0.565831542f},
-std::array<float,2>{0.137501791f, 0.993636727f},
-std::array<float,2>{0.618298531f, 0.23358877f},
-std::array<float,2>{0.115728788f, 0.0419948362f},
-std::array<float,2>{0.639748931f, 0.832030118f},
-std::array<float,2>{0.395605415f, 0.698740244f},
-std::array<float,2>{0.903668463f, 0.28585127f},
-std::array<float,2>{0.251961738f, 0.0955581218f},
-std::array<float,2>{0.873904228f, 0.785789728f},
-std::array<float,2>{0.217103392f, 0.662047029f},
-std::array<float,2>{0.556209981f, 0.339799464f},
-std::array<float,2>{0.0202371012f, 0.486662626f},
-std::array<float,2>{0.692262352f, 0.559032619f},
-std::array<float,2>{0.462691247f, 0.897689819f},
-std::array<float,2>{0.954799831f, 0.181469351f},
-std::array<float,2>{0.413689613f, 0.263029933f},
-std::array<float,2>{0.908477187f, 0.743775725f},
-std::array<float,2>{0.0918215513f, 0.857930362f},
-std::array<float,2>{0.672486484f, 0.030413812f},
-std::array<float,2>{0.174100086f, 0.198147535f},
-std::array<float,2>{0.589633942f, 0.952310383f},
-std::array<float,2>{0.318370998f, 0.623225451f},
-std::array<float,2>{0.792182028f, 0.432159632f},
-std::array<float,2>{0.389610797f, 0.00815022551f},
-std::array<float,2>{0.884772658f, 0.872356713f},
-std::array<float,2>{0.100292474f, 0.729851902f},
-std::array<float,2>{0.650251269f, 0.280611545f},
-std::array<float,2>{0.150840744f, 0.413164794f},
-std::array<float,2>{0.605720878f, 0.594723761f},
-std::array<float,2>{0.352389395f, 0.960772634f},
-std::array<float,2>{0.763667285f, 0.205736563f},
-std::array<float,2>{0.303358972f, 0.314546376f},
-std::array<float,2>{0.825741827f, 0.685348094f},
-std::array<float,2>{0.245066866f, 0.805380225f},
-std::array<float,2>{0.527257979f, 0.112599514f},
-std::array<float,2>{0.0503408685f, 0.169102103f},
-std::array<float,2>{0.722224414f, 0.881407261f},
-std::array<float,2>{0.469571561f, 0.538805723f},
-std::array<float,2>{0.971632063f, 0.477505356f},
-std::array<float,2>{0.34364596f, 0.248634666f},
-std::array<float,2>{0.809122741f, 0.980423212f},
-std::array<float,2>{0.158476025f, 0.589980066f},
-std::array<float,2>{0.56798631f, 0.377449751f},
-std::array<float,2>{0.0666857287f, 0.307571888f},
-std::array<float,2>{0.663558066f, 0.709538758f},
-std::array<float,2>{0.432467401f, 0.820790946f},
-std::array<float,2>{0.924247801f, 0.0558163598f},
-std::array<float,2>{0.449840814f, 0.464719623f},
-std::array<float,2>{0.939540923f, 0.510274708f},
-std::array<float,2>{0.00193734828f, 0.910389125f},
-std::array<float,2>{0.713116765f, 0.146316454f},
-std::array<float,2>{0.188138366f, 0.0822353363f},
-std::array<float,2>{0.532798469f, 0.778127611f},
-std::array<float,2>{0.266534567f, 0.627522409f},
-std::array<float,2>{0.856113732f, 0.348251522f},
-std::array<float,2>{0.477028042f, 0.201558039f},
-std::array<float,2>{0.977537334f, 0.949014008f},
-std::array<float,2>{0.0557993725f, 0.620222688f},
-std::array<float,2>{0.72850728f, 0.435783595f},
-std::array<float,2>{0.240390792f, 0.260152817f},
-std::array<float,2>{0.519160807f, 0.749291658f},
-std::array<float,2>{0.304856747f, 0.855043411f},
-std::array<float,2>{0.816678345f, 0.025908133f},
-std::array<float,2>{0.347065687f, 0.488775313f},
-std::array<float,2>{0.752067566f, 0.55475986f},
-std::array<float,2>{0.141654745f, 0.893560469f},
-std::array<float,2>{0.593819022f, 0.186595842f},
-std::array<float,2>{0.104961619f, 0.0997776538f},
-std::array<float,2>{0.642435968f, 0.782899916f},
-std::array<float,2>{0.377977967f, 0.65916425f},
-std::array<float,2>{0.875788271f, 0.341441184f},
-std::array<float,2>{0.281014293f, 0.0454435498f},
-std::array<float,2>{0.843832135f, 0.832112968f},
-std::array<float,2>{0.196525529f, 0.701803625f},
-std::array<float,2>{0.544025838f, 0.284280092f},
-std::array<float,2>{0.00833844487f, 0.399833977f},
-std::array<float,2>{0.705873549f, 0.568840504f},
-std::array<float,2>{0.444828779f, 0.997516096f},
-std::array<float,2>{0.951108873f, 0.226815939f},
-std::array<float,2>{0.429099351f, 0.366317242f},
-std::array<float,2>{0.931808114f, 0.649939775f},
-std::array<float,2>{0.0747949928f, 0.760803163f},
-std::array<float,2>{0.67007339f, 0.0703816563f},
-std::array<float,2>{0.171431556f, 0.127221033f},
-std::array<float,2>{0.571631908f, 0.925225854f},
-std::array<float,2>{0.335672081f, 0.523622692f},
-std::array<float,2>{0.801926494f, 0.453120172f},
-std::array<float,2>{0.401771545f, 0.0815633684f},
-std::array<float,2>{0.897358894f, 0.776264071f},
-std::array<float,2>{0.12272568f, 0.629974782f},
-std::array<float,2>{0.631112933f, 0.344815522f},
-std::array<float,2>{0.132421136f, 0.465855569f},
-std::array<float,2>{0.614797056f, 0.512900651f},
-std::array<float,2>{0.365550667f, 0.909256756f},
-std::array<float,2>{0.772225976f, 0.144468293f},
-std::array<float,2>{0.287411422f, 0.309005857f},
-std::array<float,2>{0.828467369f, 0.704437494f},
-std::array<float,2>{0.226150066f, 0.826074898f},
-std::array<float,2>{0.504868984f, 0.0594447851f},
-std::array<float,2>{0.0386800878f, 0.243308082f},
-std::array<float,2>{0.748196125f, 0.98265028f},
-std::array<float,2>{0.490292847f, 0.588891566f},
-std::array<float,2>{0.985117674f, 0.379997432f},
-std::array<float,2>{0.324667543f, 0.165657848f},
-std::array<float,2>{0.787763715f, 0.878005207f},
-std::array<float,2>{0.183271497f, 0.53246057f},
-std::array<float,2>{0.578324437f, 0.480971634f},
-std::array<float,2>{0.0784040317f, 0.318603873f},
-std::array<float,2>{0.681165099f, 0.683136702f},
-std::array<float,2>{0.417346507f, 0.810123205f},
-std::array<float,2>{0.921866059f, 0.113493197f},
-std::array<float,2>{0.456738055f, 0.406507164f},
-std::array<float,2>{0.968465745f, 0.601558566f},
-std::array<float,2>{0.0276999082f, 0.956441939f},
-std::array<float,2>{0.697928011f, 0.210024685f},
-std::array<float,2>{0.208208188f, 0.0129097905f},
-std::array<float,2>{0.548884749f, 0.868311405f},
-std::array<float,2>{0.258319557f, 0.733653605f},
-std::array<float,2>{0.862279117f, 0.275223613f},
-std::array<float,2>{0.406742871f, 0.155055389f},
-std::array<float,2>{0.912822247f, 0.921484768f},
-std::array<float,2>{0.0877936333f, 0.50076741f},
-std::array<float,2>{0.678021431f, 0.457986176f},
-std::array<float,2>{0.176198378f, 0.358106792f},
-std::array<float,2>{0.59241277f, 0.634393811f},
-std::array<float,2>{0.314881742f, 0.773201525f},
-std::array<float,2>{0.794992626f, 0.0887573734f},
-std::array<float,2>{0.254851818f, 0.388611257f},
-std::array<float,2>{0.868992329f, 0.585707664f},
-std::array<float,2>{0.212414026f, 0.972102106f},
-std::array<float,2>{0.561621785f, 0.234717369f},
-std::array<float,2>{0.0172535125f, 0.0534354672f},
-std::array<float,2>{0.68921417f, 0.816224992f},
-std::array<float,2>{0.468111277f, 0.717963755f},
-std::array<float,2>{0.959932923f, 0.303097695f},
-std::array<float,2>{0.368212759f, 0.117457405f},
-std::array<float,2>{0.774758995f, 0.803699076f},
-std::array<float,2>{0.136571646f, 0.673270047f},
-std::array<float,2>{0.622682989f, 0.321794957f},
-std::array<float,2>{0.112079442f, 0.472459644f},
-std::array<float,2>{0.63344723f, 0.544664562f},
-std::array<float,2>{0.392227262f, 0.884717941f},
-std::array<float,2>{0.900467396f, 0.1563344f},
-std::array<float,2>{0.498266071f, 0.268397242f},
-std::array<float,2>{0.99379766f, 0.720771909f},
-std::array<float,2>{0.039987091f, 0.866111636f},
-std::array<float,2>{0.735785306f, 0.00369517971f},
-std::array<float,2>{0.231733605f, 0.217428312f},
-std::array<float,2>{0.508094251f, 0.96838516f},
-std::array<float,2>{0.294827312f, 0.606604457f},
-std::array<float,2>{0.839758992f, 0.415960997f},
-std::array<float,2>{0.448186874f, 0.0216384269f},
-std::array<float,2>{0.943367004f, 0.850220799f},
-std::array<float,2>{0.00653077848f, 0.739442587f},
-std::array<float,2>{0.718588829f, 0.253546029f},
-std::array<float,2>{0.194875985f, 0.428215384f},
-std::array<float,2>{0.536728919f, 0.612089813f},
-std::array<float,2>{0.273089617f, 0.939180195f},
-std::array<float,2>{0.854625344f, 0.188538119f},
-std::array<float,2>{0.339357406f, 0.335134208f},
-std::array<float,2>{0.80534935f, 0.6705724f},
-std::array<float,2>{0.163524404f, 0.789854348f},
-std::array<float,2>{0.564173877f, 0.106876016f},
-std::array<float,2>{0.0625624359f, 0.178155363f},
-std::array<float,2>{0.657236636f, 0.900631368f},
-std::array<float,2>{0.436217099f, 0.547205746f},
-std::array<float,2>{0.927893758f, 0.492441058f},
-std::array<float,2>{0.297537357f, 0.22523272f},
-std::array<float,2>{0.823539495f, 0.984467149f},
-std::array<float,2>{0.246450305f, 0.571635902f},
-std::array<float,2>{0.529479086f, 0.391733795f},
-std::array<float,2>{0.0511174947f, 0.292800337f},
-std::array<float,2>{0.725562334f, 0.691677034f},
-std::array<float,2>{0.475459516f, 0.836487532f},
-std::array<float,2>{0.975676894f, 0.0352115892f},
-std::array<float,2>{0.386443079f, 0.439442158f},
-std::array<float,2>{0.889768302f, 0.517498195f},
-std::array<float,2>{0.0955101401f, 0.936304867f},
-std::array<float,2>{0.652912736f, 0.138571009f},
-std::array<float,2>{0.152749568f, 0.0625104085f},
-std::array<float,2>{0.603005409f, 0.757325947f},
-std::array<float,2>{0.356391996f, 0.646488786f},
-std::array<float,2>{0.7595402f, 0.370264918f},
-std::array<float,2>{0.380889982f, 0.24053815f},
-std::array<float,2>{0.881435156f, 0.975903809f},
-std::array<float,2>{0.106115624f, 0.578990638f},
-std::array<float,2>{0.646314204f, 0.386524439f},
-std::array<float,2>{0.146839499f, 0.298811048f},
-std::array<float,2>{0.598065257f, 0.711337447f},
-std::array<float,2>{0.351448506f, 0.819202065f},
-std::array<float,2>{0.756289542f, 0.0479412414f},
-std::array<float,2>{0.310410619f, 0.455323309f},
-std::array<float,2>{0.815854132f, 0.504220903f},
-std::array<float,2>{0.235674992f, 0.915230334f},
-std::array<float,2>{0.521403313f, 0.151996955f},
-std::array<float,2>{0.0601439066f, 0.0922156051f},
-std::array<float,2>{0.732211888f, 0.767267108f},
-std::array<float,2>{0.483797163f, 0.63761878f},
-std::array<float,2>{0.982569337f, 0.352781922f},
-std::array<float,2>{0.331614047f, 0.00737643661f},
-std::array<float,2>{0.798567176f, 0.860392511f},
-std::array<float,2>{0.165100619f, 0.723944962f},
-std::array<float,2>{0.574489653f, 0.273017466f},
-std::array<float,2>{0.0728212371f, 0.418516099f},
-std::array<float,2>{0.667202652f, 0.604393125f},
-std::array<float,2>{0.425225317f, 0.960999131f},
-std::array<float,2>{0.934210241f, 0.213196322f},
-std::array<float,2>{0.438994706f, 0.326705307f},
-std::array<float,2>{0.945623219f, 0.679125726f},
-std::array<float,2>{0.0155190369f, 0.799142063f},
-std::array<float,2>{0.710281968f, 0.122235283f},
-std::array<float,2>{0.199231103f, 0.160235569f},
-std::array<float,2>{0.541879356f, 0.888697088f},
-std::array<float,2>{0.274164647f, 0.54175818f},
-std::array<float,2>{0.847913444f, 0.47403422f},
-std::array<float,2>{0.485290587f, 0.102245264f},
-std::array<float,2>{0.989261866f, 0.79499352f},
-std::array<float,2>{0.0332993492f, 0.666498482f},
-std::array<float,2>{0.745124042f, 0.329845846f},
-std::array<float,2>{0.220346302f, 0.497234762f},
-std::array<float,2>{0.501636386f, 0.551253676f},
-std::array<float,2>{0.283520281f, 0.904769123f},
-std::array<float,2>{0.834795892f, 0.174433842f},
-std::array<float,2>{0.360960603f, 0.255014807f},
-std::array<float,2>{0.768707216f, 0.738104105f},
-std::array<float,2>{0.125911444f, 0.847387016f},
-std::array<float,2>{0.610221624f, 0.0175727885f},
-std::array<float,2>{0.120869443f, 0.193109006f},
-std::array<float,2>{0.625253737f, 0.943425536f},
-std::array<float,2>{0.40590474f, 0.615671515f},
-std::array<float,2>{0.891663432f, 0.424520165f},
-std::array<float,2>{0.265355378f, 0.133136094f},
-std::array<float,2>{0.865902305f, 0.929936469f},
-std::array<float,2>{0.20567596f, 0.522091925f},
-std::array<float,2>{0.553089619f, 0.44525674f},
-std::array<float,2>{0.0267848931f, 0.372664958f},
-std::array<float,2>{0.702999055f, 0.643259883f},
-std::array<float,2>{0.45932284f, 0.750293672f},
-std::array<float,2>{0.963410318f, 0.0667653009f},
-std::array<float,2>{0.419008285f, 0.39625904f},
-std::array<float,2>{0.917867422f, 0.574948132f},
-std::array<float,2>{0.0853390917f, 0.990726948f},
-std::array<float,2>{0.687471986f, 0.22228919f},
-std::array<float,2>{0.185460404f, 0.0334480554f},
-std::array<float,2>{0.585715115f, 0.840656221f},
-std::array<float,2>{0.322141379f, 0.690483868f},
-std::array<float,2>{0.78166765f, 0.293216974f},
-std::array<float,2>{0.464396983f, 0.182030022f},
-std::array<float,2>{0.955202341f, 0.896157086f},
-std::array<float,2>{0.0223804004f, 0.562083304f},
-std::array<float,2>{0.695107341f, 0.485272348f},
-std::array<float,2>{0.216308773f, 0.337190241f},
-std::array<float,2>{0.558020532f, 0.662960351f},
-std::array<float,2>{0.250348747f, 0.788769782f},
-std::array<float,2>{0.871338785f, 0.096059233f},
-std::array<float,2>{0.316567183f, 0.430202246f},
-std::array<float,2>{0.790279806f, 0.621940672f},
-std::array<float,2>{0.17300196f, 0.95039618f},
-std::array<float,2>{0.587667167f, 0.195890158f},
-std::array<float,2>{0.0908325985f, 0.0283471327f},
-std::array<float,2>{0.674954653f, 0.855732858f},
-std::array<float,2>{0.410947919f, 0.744316578f},
-std::array<float,2>{0.907320797f, 0.265410483f},
-std::array<float,2>{0.290786177f, 0.0763620958f},
-std::array<float,2>{0.840465665f, 0.763577104f},
-std::array<float,2>{0.229530022f, 0.655032575f},
-std::array<float,2>{0.515555501f, 0.363214195f},
-std::array<float,2>{0.0448811166f, 0.44797194f},
-std::array<float,2>{0.739835024f, 0.529907763f},
-std::array<float,2>{0.493575662f, 0.927852929f},
-std::array<float,2>{0.996273935f, 0.130670369f},
-std::array<float,2>{0.398371935f, 0.288856328f},
-std::array<float,2>{0.904446185f, 0.695501089f},
-std::array<float,2>{0.114384197f, 0.829612136f},
-std::array<float,2>{0.637063086f, 0.0403206199f},
-std::array<float,2>{0.140308887f, 0.231808409f},
-std::array<float,2>{0.6195755f, 0.99503684f},
-std::array<float,2>{0.374869734f, 0.56444025f},
-std::array<float,2>{0.779229701f, 0.40624088f},
-std::array<float,2>{0.43027094f, 0.0582611524f},
-std::array<float,2>{0.922235131f, 0.822406709f},
-std::array<float,2>{0.0694696978f, 0.708713055f},
-std::array<float,2>{0.66180408f, 0.306562364f},
-std::array<float,2>{0.156615749f, 0.376265287f},
-std::array<float,2>{0.569519401f, 0.592637181f},
-std::array<float,2>{0.340428799f, 0.977923274f},
-std::array<float,2>{0.812219203f, 0.246982425f},
-std::array<float,2>{0.268219262f, 0.351340413f},
-std::array<float,2>{0.858735979f, 0.626898587f},
-std::array<float,2>{0.189967096f, 0.780867934f},
-std::array<float,2>{0.534585059f, 0.0844777524f},
-std::array<float,2>{0.00255875057f, 0.147679731f},
-std::array<float,2>{0.711069643f, 0.913770854f},
-std::array<float,2>{0.452415973f, 0.509003639f},
-std::array<float,2>{0.938504577f, 0.46207127f},
-std::array<float,2>{0.354284137f, 0.204035521f},
-std::array<float,2>{0.764819086f, 0.958687544f},
-std::array<float,2>{0.149834529f, 0.595822752f},
-std::array<float,2>{0.609362066f, 0.412043244f},
-std::array<float,2>{0.0982225686f, 0.278598011f},
-std::array<float,2>{0.652293444f, 0.727830708f},
-std::array<float,2>{0.387881607f, 0.873707175f},
-std::array<float,2>{0.882983088f, 0.0110276705f},
-std::array<float,2>{0.471353114f, 0.480346501f},
-std::array<float,2>{0.970134258f, 0.536818683f},
-std::array<float,2>{0.0477916226f, 0.879481673f},
-std::array<float,2>{0.719685256f, 0.171533763f},
-std::array<float,2>{0.24408415f, 0.109428495f},
-std::array<float,2>{0.525068581f, 0.806766808f},
-std::array<float,2>{0.302096575f, 0.686925292f},
-std::array<float,2>{0.82685703f, 0.312739313f},
-std::array<float,2>{0.461247623f, 0.196235508f},
-std::array<float,2>{0.953825772f, 0.95057559f},
-std::array<float,2>{0.0212936066f, 0.621736407f},
-std::array<float,2>{0.692970097f, 0.430517316f},
-std::array<float,2>{0.218200371f, 0.265168339f},
-std::array<float,2>{0.555258512f, 0.744454741f},
-std::array<float,2>{0.253321528f, 0.855645895f},
-std::array<float,2>{0.874300122f, 0.0287179183f},
-std::array<float,2>{0.320202947f, 0.485080749f},
-std::array<float,2>{0.79156661f, 0.562388778f},
-std::array<float,2>{0.174970672f, 0.896440864f},
-std::array<float,2>{0.588724971f, 0.181835487f},
-std::array<float,2>{0.0930835381f, 0.0959380344f},
-std::array<float,2>{0.672983289f, 0.788902581f},
-std::array<float,2>{0.412979305f, 0.662806034f},
-std::array<float,2>{0.90988487f, 0.336961597f},
-std::array<float,2>{0.292446673f, 0.0402108133f},
-std::array<float,2>{0.842307687f, 0.829893529f},
-std::array<float,2>{0.227755576f, 0.695598364f},
-std::array<float,2>{0.511779785f, 0.288629025f},
-std::array<float,2>{0.0454797857f, 0.405836165f},
-std::array<float,2>{0.740517437f, 0.564177155f},
-std::array<float,2>{0.495230138f, 0.994630396f},
-std::array<float,2>{0.999848604f, 0.231554508f},
-std::array<float,2>{0.394895911f, 0.362893254f},
-std::array<float,2>{0.903000712f, 0.655011892f},
-std::array<float,2>{0.116254441f, 0.763364255f},
-std::array<float,2>{0.639319181f, 0.0765783414f},
-std::array<float,2>{0.137774289f, 0.130533502f},
-std::array<float,2>{0.61749661f, 0.928046763f},
-std::array<float,2>{0.371713966f, 0.530042112f},
-std::array<float,2>{0.780260623f, 0.448073089f},
-std::array<float,2>{0.433280975f, 0.084746182f},
-std::array<float,2>{0.925073743f, 0.781121552f},
-std::array<float,2>{0.0675060973f, 0.626596928f},
-std::array<float,2>{0.662368f, 0.351201355f},
-std::array<float,2>{0.159642354f, 0.462212861f},
-std::array<float,2>{0.566710591f, 0.509152949f},
-std::array<float,2>{0.342256993f, 0.914058864f},
-std::array<float,2>{0.810247779f, 0.147814885f},
-std::array<float,2>{0.267402768f, 0.306347489f},
-std::array<float,2>{0.857000113f, 0.708848596f},
-std::array<float,2>{0.188642398f, 0.822591305f},
-std::array<float,2>{0.531768322f, 0.058444418f},
-std::array<float,2>{0.000641995925f, 0.246696159f},
-std::array<float,2>{0.714208126f, 0.977782845f},
-std::array<float,2>{0.450589031f, 0.592349529f},
-std::array<float,2>{0.941239715f, 0.376069725f},
-std::array<float,2>{0.352778465f, 0.171859697f},
-std::array<float,2>{0.762428701f, 0.879645944f},
-std::array<float,2>{0.15168114f, 0.536981285f},
-std::array<float,2>{0.606814981f, 0.480012119f},
-std::array<float,2>{0.101416849f, 0.312888443f},
-std::array<float,2>{0.648789823f, 0.686759889f},
-std::array<float,2>{0.39029634f, 0.807081163f},
-std::array<float,2>{0.886171043f, 0.109742507f},
-std::array<float,2>{0.469977379f, 0.411860257f},
-std::array<float,2>{0.972213626f, 0.596075356f},
-std::array<float,2>{0.0497070029f, 0.958813012f},
-std::array<float,2>{0.721589267f, 0.203732952f},
-std::array<float,2>{0.245410517f, 0.0108585283f},
-std::array<float,2>{0.525618672f, 0.873858392f},
-std::array<float,2>{0.304425776f, 0.727658391f},
-std::array<float,2>{0.825156093f, 0.27832672f},
-std::array<float,2>{0.380210936f, 0.152305201f},
-std::array<float,2>{0.879146874f, 0.915512741f},
-std::array<float,2>{0.109369971f, 0.503941357f},
-std::array<float,2>{0.648112178f, 0.455196738f},
-std::array<float,2>{0.144567415f, 0.352837116f},
-std::array<float,2>{0.60091275f, 0.637391329f},
-std::array<float,2>{0.34801057f, 0.767489016f},
-std::array<float,2>{0.755007386f, 0.0918257087f},
-std::array<float,2>{0.311567128f, 0.386428952f},
-std::array<float,2>{0.813411295f, 0.578672528f},
-std::array<float,2>{0.236605391f, 0.97578609f},
-std::array<float,2>{0.521569252f, 0.240379065f},
-std::array<float,2>{0.0616606846f, 0.0481658727f},
-std::array<float,2>{0.733492732f, 0.818856359f},
-std::array<float,2>{0.482353717f, 0.711045563f},
-std::array<float,2>{0.981910408f, 0.298509479f},
-std::array<float,2>{0.328139126f, 0.122318789f},
-std::array<float,2>{0.800627828f, 0.798850119f},
-std::array<float,2>{0.167817846f, 0.678784966f},
-std::array<float,2>{0.576759517f, 0.327148259f},
-std::array<float,2>{0.0722365007f, 0.473671913f},
-std::array<float,2>{0.664599836f, 0.541674674f},
-std::array<float,2>{0.422600508f, 0.888975441f},
-std::array<float,2>{0.936184406f, 0.160512254f},
-std::array<float,2>{0.440452844f, 0.273307443f},
-std::array<float,2>{0.947320044f, 0.72383064f},
-std::array<float,2>{0.0136307767f, 0.860645354f},
-std::array<float,2>{0.708608091f, 0.00759236375f},
-std::array<float,2>{0.202645674f, 0.212991193f},
-std::array<float,2>{0.539557099f, 0.96138531f},
-std::array<float,2>{0.276713222f, 0.604166925f},
-std::array<float,2>{0.851327777f, 0.418717444f},
-std::array<float,2>{0.486621737f, 0.0171635319f},
-std::array<float,2>{0.991120398f, 0.847454309f},
-std::array<float,2>{0.0324816033f, 0.73795557f},
-std::array<float,2>{0.743926764f, 0.255161732f},
-std::array<float,2>{0.22221294f, 0.424563468f},
-std::array<float,2>{0.502212346f, 0.615339577f},
-std::array<float,2>{0.281300098f, 0.943633974f},
-std::array<float,2>{0.833102524f, 0.193270087f},
-std::array<float,2>{0.362840563f, 0.329723209f},
-std::array<float,2>{0.767183423f, 0.666101992f},
-std::array<float,2>{0.128529295f, 0.795303822f},
-std::array<float,2>{0.611832261f, 0.102498099f},
-std::array<float,2>{0.118503459f, 0.174610242f},
-std::array<float,2>{0.628612041f, 0.904366076f},
-std::array<float,2>{0.403744519f, 0.551023364f},
-std::array<float,2>{0.892826676f, 0.497465193f},
-std::array<float,2>{0.263652146f, 0.222449765f},
-std::array<float,2>{0.863952994f, 0.991082132f},
-std::array<float,2>{0.203316435f, 0.575123847f},
-std::array<float,2>{0.551052809f, 0.3962107f},
-std::array<float,2>{0.0247485284f, 0.293008745f},
-std::array<float,2>{0.699321926f, 0.690705657f},
-std::array<float,2>{0.457174271f, 0.840511978f},
-std::array<float,2>{0.961684644f, 0.0332855023f},
-std::array<float,2>{0.421537757f, 0.44505924f},
-std::array<float,2>{0.915556133f, 0.522263646f},
-std::array<float,2>{0.0824632347f, 0.929857075f},
-std::array<float,2>{0.684536338f, 0.132920429f},
-std::array<float,2>{0.186950788f, 0.0666138753f},
-std::array<float,2>{0.582209587f, 0.750094712f},
-std::array<float,2>{0.322777122f, 0.643440664f},
-std::array<float,2>{0.784168482f, 0.372920632f},
-std::array<float,2>{0.40827921f, 0.234556794f},
-std::array<float,2>{0.910163879f, 0.971685648f},
-std::array<float,2>{0.0879551247f, 0.585479021f},
-std::array<float,2>{0.677405894f, 0.388224602f},
-std::array<float,2>{0.17903696f, 0.302864164f},
-std::array<float,2>{0.590580285f, 0.718116045f},
-std::array<float,2>{0.314425915f, 0.815958858f},
-std::array<float,2>{0.794413269f, 0.0536991172f},
-std::array<float,2>{0.257463872f, 0.457641602f},
-std::array<float,2>{0.870391548f, 0.500711203f},
-std::array<float,2>{0.214560702f, 0.921741724f},
-std::array<float,2>{0.55890286f, 0.155001447f},
-std::array<float,2>{0.0183102265f, 0.0884307176f},
-std::array<float,2>{0.689511538f, 0.7730093f},
-std::array<float,2>{0.464862585f, 0.634723365f},
-std::array<float,2>{0.957089663f, 0.358313203f},
-std::array<float,2>{0.370955408f, 0.00346715772f},
-std::array<float,2>{0.776962578f, 0.865790009f},
-std::array<float,2>{0.133442387f, 0.721071243f},
-std::array<float,2>{0.623463869f, 0.268288195f},
-std::array<float,2>{0.110599324f, 0.41574201f},
-std::array<float,2>{0.635986447f, 0.606890202f},
-std::array<float,2>{0.394288152f, 0.968551278f},
-std::array<float,2>{0.899362504f, 0.217706755f},
-std::array<float,2>{0.49711144f, 0.322075844f},
-std::array<float,2>{0.995904684f, 0.673031628f},
-std::array<float,2>{0.0410835072f, 0.803325951f},
-std::array<float,2>{0.737213075f, 0.117341153f},
-std::array<float,2>{0.23369424f, 0.156675532f},
-std::array<float,2>{0.510367334f, 0.884444356f},
-std::array<float,2>{0.295479208f, 0.544860244f},
-std::array<float,2>{0.837260246f, 0.472395867f},
-std::array<float,2>{0.446489125f, 0.10668204f},
-std::array<float,2>{0.943086147f, 0.789629519f},
-std::array<float,2>{0.0042897216f, 0.670655191f},
-std::array<float,2>{0.715632617f, 0.335358977f},
-std::array<float,2>{0.191962913f, 0.492357254f},
-std::array<float,2>{0.537627578f, 0.547074139f},
-std::array<float,2>{0.26985833f, 0.900661469f},
-std::array<float,2>{0.853356957f, 0.177793458f},
-std::array<float,2>{0.337604612f, 0.253777504f},
-std::array<float,2>{0.808016062f, 0.739520013f},
-std::array<float,2>{0.161108464f, 0.850466132f},
-std::array<float,2>{0.565038025f, 0.0219492484f},
-std::array<float,2>{0.0644586459f, 0.188797504f},
-std::array<float,2>{0.659719765f, 0.939236641f},
-std::array<float,2>{0.434456229f, 0.611925185f},
-std::array<float,2>{0.926572561f, 0.427792996f},
-std::array<float,2>{0.299221396f, 0.138214037f},
-std::array<float,2>{0.82086128f, 0.936039865f},
-std::array<float,2>{0.248206839f, 0.517147243f},
-std::array<float,2>{0.528998554f, 0.439097285f},
-std::array<float,2>{0.0528676957f, 0.37038368f},
-std::array<float,2>{0.724114239f, 0.646946132f},
-std::array<float,2>{0.473151863f, 0.757642865f},
-std::array<float,2>{0.973447442f, 0.0629463866f},
-std::array<float,2>{0.384572536f, 0.391952842f},
-std::array<float,2>{0.887966275f, 0.571506917f},
-std::array<float,2>{0.0972743034f, 0.984726369f},
-std::array<float,2>{0.654824913f, 0.225419044f},
-std::array<float,2>{0.154891208f, 0.0354614221f},
-std::array<float,2>{0.605131209f, 0.836853981f},
-std::array<float,2>{0.358424932f, 0.691436887f},
-std::array<float,2>{0.759894252f, 0.292658716f},
-std::array<float,2>{0.480299383f, 0.18694818f},
-std::array<float,2>{0.979593694f, 0.893968105f},
-std::array<float,2>{0.0567623489f, 0.554956198f},
-std::array<float,2>{0.728717089f, 0.489204198f},
-std::array<float,2>{0.239544839f, 0.34155491f},
-std::array<float,2>{0.516906798f, 0.658779144f},
-std::array<float,2>{0.30848971f, 0.782990217f},
-std::array<float,2>{0.81838274f, 0.0998992622f},
-std::array<float,2>{0.344495147f, 0.435841203f},
-std::array<float,2>{0.751439214f, 0.620579362f},
-std::array<float,2>{0.143644392f, 0.948927641f},
-std::array<float,2>{0.595912576f, 0.201390475f},
-std::array<float,2>{0.102341816f, 0.0261751469f},
-std::array<float,2>{0.644415617f, 0.855379224f},
-std::array<float,2>{0.376699716f, 0.749229133f},
-std::array<float,2>{0.878691554f, 0.259870827f},
-std::array<float,2>{0.279241651f, 0.0707612708f},
-std::array<float,2>{0.845725119f, 0.761058569f},
-std::array<float,2>{0.198475301f, 0.650236905f},
-std::array<float,2>{0.54613781f, 0.36652559f},
-std::array<float,2>{0.0111853397f, 0.452684373f},
-std::array<float,2>{0.70365721f, 0.523821175f},
-std::array<float,2>{0.44291088f, 0.92502898f},
-std::array<float,2>{0.952765882f, 0.127089664f},
-std::array<float,2>{0.427116513f, 0.284498006f},
-std::array<float,2>{0.93145448f, 0.701984704f},
-std::array<float,2>{0.0778543279f, 0.832280815f},
-std::array<float,2>{0.669561207f, 0.0456652939f},
-std::array<float,2>{0.16851218f, 0.226771906f},
-std::array<float,2>{0.573962986f, 0.997310162f},
-std::array<float,2>{0.332848847f, 0.568499684f},
-std::array<float,2>{0.802765787f, 0.399495274f},
-std::array<float,2>{0.400325865f, 0.0591559671f},
-std::array<float,2>{0.895685196f, 0.825837791f},
-std::array<float,2>{0.123448811f, 0.704118371f},
-std::array<float,2>{0.630812407f, 0.308826834f},
-std::array<float,2>{0.129976422f, 0.380284518f},
-std::array<float,2>{0.617075324f, 0.589120865f},
-std::array<float,2>{0.36363712f, 0.982746005f},
-std::array<float,2>{0.770234168f, 0.243454933f},
-std::array<float,2>{0.28646186f, 0.345050007f},
-std::array<float,2>{0.830813169f, 0.630260527f},
-std::array<float,2>{0.224407271f, 0.775908887f},
-std::array<float,2>{0.50763905f, 0.0820165426f},
-std::array<float,2>{0.0358427465f, 0.144239455f},
-std::array<float,2>{0.746990323f, 0.909552336f},
-std::array<float,2>{0.489760071f, 0.513032377f},
-std::array<float,2>{0.987218559f, 0.466077119f},
-std::array<float,2>{0.327289283f, 0.210208789f},
-std::array<float,2>{0.785536706f, 0.956264138f},
-std::array<float,2>{0.181387603f, 0.601081073f},
-std::array<float,2>{0.58138901f, 0.406333715f},
-std::array<float,2>{0.0805268362f, 0.275081694f},
-std::array<float,2>{0.682871222f, 0.733438432f},
-std::array<float,2>{0.414968103f, 0.868632555f},
-std::array<float,2>{0.918400943f, 0.0131627508f},
-std::array<float,2>{0.453126252f, 0.481357515f},
-std::array<float,2>{0.966682255f, 0.532549918f},
-std::array<float,2>{0.0300719123f, 0.878235936f},
-std::array<float,2>{0.695884407f, 0.165847346f},
-std::array<float,2>{0.209152445f, 0.113565013f},
-std::array<float,2>{0.547311187f, 0.810435176f},
-std::array<float,2>{0.260418087f, 0.683538198f},
-std::array<float,2>{0.860717952f, 0.318490088f},
-std::array<float,2>{0.492430776f, 0.233665362f},
-std::array<float,2>{0.99769783f, 0.993346274f},
-std::array<float,2>{0.0433868691f, 0.565614462f},
-std::array<float,2>{0.738533795f, 0.403913736f},
-std::array<float,2>{0.228810087f, 0.285918236f},
-std::array<float,2>{0.514148235f, 0.699074924f},
-std::array<float,2>{0.28964144f, 0.831594825f},
-std::array<float,2>{0.840931833f, 0.0423389971f},
-std::array<float,2>{0.373146266f, 0.445640087f},
-std::array<float,2>{0.777610958f, 0.528097928f},
-std::array<float,2>{0.138781592f, 0.926875353f},
-std::array<float,2>{0.620874822f, 0.131946161f},
-std::array<float,2>{0.113546498f, 0.0747948512f},
-std::array<float,2>{0.638140917f, 0.765050054f},
-std::array<float,2>{0.39711839f, 0.652631998f},
-std::array<float,2>{0.905586302f, 0.361157835f},
-std::array<float,2>{0.251793712f, 0.0306457449f},
-std::array<float,2>{0.872605979f, 0.858201265f},
-std::array<float,2>{0.215335444f, 0.74402982f},
-std::array<float,2>{0.556736052f, 0.262875885f},
-std::array<float,2>{0.0229957178f, 0.432393551f},
-std::array<float,2>{0.693446815f, 0.623520017f},
-std::array<float,2>{0.463647962f, 0.952615142f},
-std::array<float,2>{0.956341684f, 0.197898209f},
-std::array<float,2>{0.411560684f, 0.339357555f},
-std::array<float,2>{0.906962037f, 0.661654472f},
-std::array<float,2>{0.0904904082f, 0.786029279f},
-std::array<float,2>{0.673915505f, 0.0953252092f},
-std::array<float,2>{0.172435299f, 0.181244582f},
-std::array<float,2>{0.586584449f, 0.89782089f},
-std::array<float,2>{0.317573339f, 0.558706164f},
-std::array<float,2>{0.790002167f, 0.486483276f},
-std::array<float,2>{0.387527287f, 0.112498477f},
-std::array<float,2>{0.88419801f, 0.805455506f},
-std::array<float,2>{0.0988227874f, 0.685128093f},
-std::array<float,2>{0.650435269f, 0.314741105f},
-std::array<float,2>{0.148558885f, 0.477223694f},
-std::array<float,2>{0.607898116f, 0.539027214f},
-std::array<float,2>{0.355311096f, 0.88178426f},
-std::array<float,2>{0.764631689f, 0.169296905f},
-std::array<float,2>{0.30079782f, 0.280456036f},
-std::array<float,2>{0.827911258f, 0.729543626f},
-std::array<float,2>{0.243154749f, 0.872086525f},
-std::array<float,2>{0.523981988f, 0.0078181196f},
-std::array<float,2>{0.0485869609f, 0.205923408f},
-std::array<float,2>{0.720696568f, 0.960533381f},
-std::array<float,2>{0.472148895f, 0.594361782f},
-std::array<float,2>{0.969225466f, 0.413423985f},
-std::array<float,2>{0.341396719f, 0.14608109f},
-std::array<float,2>{0.811249614f, 0.910600424f},
-std::array<float,2>{0.15744406f, 0.510566294f},
-std::array<float,2>{0.568598032f, 0.464513689f},
-std::array<float,2>{0.0688225701f, 0.348437786f},
-std::array<float,2>{0.660464287f, 0.627685964f},
-std::array<float,2>{0.431214035f, 0.77806139f},
-std::array<float,2>{0.92303139f, 0.0823841915f},
-std::array<float,2>{0.452105969f, 0.377818346f},
-std::array<float,2>{0.937914431f, 0.590309024f},
-std::array<float,2>{0.0029900847f, 0.980211616f},
-std::array<float,2>{0.712428749f, 0.24879688f},
-std::array<float,2>{0.190518558f, 0.0561096631f},
-std::array<float,2>{0.533701956f, 0.820454955f},
-std::array<float,2>{0.269176036f, 0.709866524f},
-std::array<float,2>{0.858139455f, 0.307267696f},
-std::array<float,2>{0.423878402f, 0.163463995f},
-std::array<float,2>{0.934914827f, 0.888577461f},
-std::array<float,2>{0.0741020218f, 0.540866196f},
-std::array<float,2>{0.66615802f, 0.475384533f},
-std::array<float,2>{0.164077073f, 0.325970024f},
-std::array<float,2>{0.575686812f, 0.675995827f},
-std::array<float,2>{0.330475181f, 0.798507214f},
-std::array<float,2>{0.797561407f, 0.124037087f},
-std::array<float,2>{0.275379747f, 0.421367079f},
-std::array<float,2>{0.849227071f, 0.602770448f},
-std::array<float,2>{0.200905219f, 0.964104414f},
-std::array<float,2>{0.542611897f, 0.21099709f},
-std::array<float,2>{0.0142587088f, 0.00415271521f},
-std::array<float,2>{0.709202468f, 0.863046408f},
-std::array<float,2>{0.438257486f, 0.726339519f},
-std::array<float,2>{0.946775258f, 0.26965183f},
-std::array<float,2>{0.349932909f, 0.0916382074f},
-std::array<float,2>{0.756847084f, 0.769105256f},
-std::array<float,2>{0.147809237f, 0.63895613f},
-std::array<float,2>{0.598755181f, 0.353619546f},
-std::array<float,2>{0.107387848f, 0.453563094f},
-std::array<float,2>{0.644637108f, 0.506936312f},
-std::array<float,2>{0.382305115f, 0.91730994f},
-std::array<float,2>{0.882066369f, 0.148508638f},
-std::array<float,2>{0.483149499f, 0.29933098f},
-std::array<float,2>{0.983515859f, 0.713311791f},
-std::array<float,2>{0.0590592436f, 0.817243099f},
-std::array<float,2>{0.731321514f, 0.0499413535f},
-std::array<float,2>{0.234424487f, 0.239317968f},
-std::array<float,2>{0.520474195f, 0.974548876f},
-std::array<float,2>{0.308609098f, 0.581823528f},
-std::array<float,2>{0.815387487f, 0.383280724f},
-std::array<float,2>{0.460434854f, 0.0322139524f},
-std::array<float,2>{0.963967741f, 0.842246413f},
-std::array<float,2>{0.0262332931f, 0.688581049f},
-std::array<float,2>{0.701503992f, 0.296304703f},
-std::array<float,2>{0.206845477f, 0.397587001f},
-std::array<float,2>{0.553853989f, 0.577780128f},
-std::array<float,2>{0.26376766f, 0.989369571f},
-std::array<float,2>{0.866945088f, 0.220125198f},
-std::array<float,2>{0.32044068f, 0.373749465f},
-std::array<float,2>{0.782757819f, 0.641871452f},
-std::array<float,2>{0.184547693f, 0.752516925f},
-std::array<float,2>{0.584513247f, 0.068649739f},
-std::array<float,2>{0.0846496075f, 0.134921178f},
-std::array<float,2>{0.685935855f, 0.932331741f},
-std::array<float,2>{0.418812275f, 0.519674003f},
-std::array<float,2>{0.916661501f, 0.442125916f},
-std::array<float,2>{0.284533471f, 0.193493351f},
-std::array<float,2>{0.835642159f, 0.942048192f},
-std::array<float,2>{0.218797281f, 0.614750504f},
-std::array<float,2>{0.500783145f, 0.422995239f},
-std::array<float,2>{0.0345635377f, 0.256930023f},
-std::array<float,2>{0.744174302f, 0.73473835f},
-std::array<float,2>{0.485914558f, 0.843893588f},
-std::array<float,2>{0.989116073f, 0.0184850208f},
-std::array<float,2>{0.404501975f, 0.498236686f},
-std::array<float,2>{0.891026616f, 0.553767502f},
-std::array<float,2>{0.119194925f, 0.903333783f},
-std::array<float,2>{0.626577616f, 0.173454449f},
-std::array<float,2>{0.12613605f, 0.104322359f},
-std::array<float,2>{0.611138761f, 0.79368341f},
-std::array<float,2>{0.359837294f, 0.664303541f},
-std::array<float,2>{0.767883718f, 0.330166817f},
-std::array<float,2>{0.391349435f, 0.215565324f},
-std::array<float,2>{0.902125299f, 0.966778398f},
-std::array<float,2>{0.112336613f, 0.607585192f},
-std::array<float,2>{0.63457787f, 0.416853756f},
-std::array<float,2>{0.135034278f, 0.265752763f},
-std::array<float,2>{0.62185508f, 0.719461381f},
-std::array<float,2>{0.367582262f, 0.864796996f},
-std::array<float,2>{0.773448706f, 0.000971585512f},
-std::array<float,2>{0.293770552f, 0.46931389f},
-std::array<float,2>{0.83873105f, 0.545079589f},
-std::array<float,2>{0.230914846f, 0.88550657f},
-std::array<float,2>{0.509228885f, 0.15870285f},
-std::array<float,2>{0.0403530411f, 0.119187526f},
-std::array<float,2>{0.734849334f, 0.802464724f},
-std::array<float,2>{0.499422163f, 0.674816072f},
-std::array<float,2>{0.992333233f, 0.323697865f},
-std::array<float,2>{0.315948129f, 0.0516583025f},
-std::array<float,2>{0.796634972f, 0.813155651f},
-std::array<float,2>{0.177361518f, 0.715455115f},
-std::array<float,2>{0.593065858f, 0.30091995f},
-std::array<float,2>{0.0868185237f, 0.390591681f},
-std::array<float,2>{0.679284155f, 0.583124518f},
-std::array<float,2>{0.407298446f, 0.969308555f},
-std::array<float,2>{0.913638055f, 0.237705305f},
-std::array<float,2>{0.467280567f, 0.356074065f},
-std::array<float,2>{0.960410357f, 0.634944439f},
-std::array<float,2>{0.0163030345f, 0.770327866f},
-std::array<float,2>{0.687882245f, 0.0867291093f},
-std::array<float,2>{0.2114131f, 0.152382344f},
-std::array<float,2>{0.56120497f, 0.918800652f},
-std::array<float,2>{0.25508377f, 0.502589643f},
-std::array<float,2>{0.867201626f, 0.460780442f},
-std::array<float,2>{0.476441294f, 0.0656042546f},
-std::array<float,2>{0.974687278f, 0.754821241f},
-std::array<float,2>{0.0523629263f, 0.644730985f},
-std::array<float,2>{0.726223588f, 0.368778467f},
-std::array<float,2>{0.247846186f, 0.441078186f},
-std::array<float,2>{0.530548692f, 0.517669737f},
-std::array<float,2>{0.298352867f, 0.934496164f},
-std::array<float,2>{0.823224843f, 0.139374048f},
-std::array<float,2>{0.356485009f, 0.289105237f},
-std::array<float,2>{0.758153617f, 0.693853021f},
-std::array<float,2>{0.153471306f, 0.838497221f},
-std::array<float,2>{0.601792455f, 0.0381684825f},
-std::array<float,2>{0.0940717906f, 0.22366102f},
-std::array<float,2>{0.653573871f, 0.988061368f},
-std::array<float,2>{0.384996176f, 0.5738554f},
-std::array<float,2>{0.88960129f, 0.393482506f},
-std::array<float,2>{0.271759063f, 0.177595079f},
-std::array<float,2>{0.853560627f, 0.899210691f},
-std::array<float,2>{0.194261268f, 0.549533606f},
-std::array<float,2>{0.535434544f, 0.495209545f},
-std::array<float,2>{0.00771819428f, 0.332508594f},
-std::array<float,2>{0.717309713f, 0.669354022f},
-std::array<float,2>{0.44826895f, 0.791397095f},
-std::array<float,2>{0.944498718f, 0.108508669f},
-std::array<float,2>{0.436803609f, 0.42707482f},
-std::array<float,2>{0.929680407f, 0.611079276f},
-std::array<float,2>{0.0643434152f, 0.940439165f},
-std::array<float,2>{0.656584918f, 0.191156432f},
-std::array<float,2>{0.162259996f, 0.0200991202f},
-std::array<float,2>{0.563432217f, 0.847956777f},
-std::array<float,2>{0.33879891f, 0.741279423f},
-std::array<float,2>{0.805706441f, 0.250620544f},
-std::array<float,2>{0.444087118f, 0.125816941f},
-std::array<float,2>{0.95001322f, 0.922151268f},
-std::array<float,2>{0.00974279176f, 0.526175261f},
-std::array<float,2>{0.706598341f, 0.449611336f},
-std::array<float,2>{0.196196064f, 0.363792181f},
-std::array<float,2>{0.543853343f, 0.652156174f},
-std::array<float,2>{0.279358894f, 0.758802712f},
-std::array<float,2>{0.844956934f, 0.0733162835f},
-std::array<float,2>{0.334477395f, 0.402071625f},
-std::array<float,2>{0.800946474f, 0.56644696f},
-std::array<float,2>{0.170304701f, 0.999689877f},
-std::array<float,2>{0.571027577f, 0.230200216f},
-std::array<float,2>{0.0753404424f, 0.0440050773f},
-std::array<float,2>{0.670938432f, 0.835444212f},
-std::array<float,2>{0.42789197f, 0.700243831f},
-std::array<float,2>{0.933540344f, 0.282162637f},
-std::array<float,2>{0.306564242f, 0.0980669707f},
-std::array<float,2>{0.818114877f, 0.783562481f},
-std::array<float,2>{0.24189721f, 0.657084346f},
-std::array<float,2>{0.518345177f, 0.341937542f},
-std::array<float,2>{0.0548834093f, 0.490345985f},
-std::array<float,2>{0.726907909f, 0.557056785f},
-std::array<float,2>{0.477785856f, 0.890673637f},
-std::array<float,2>{0.978305697f, 0.185142979f},
-std::array<float,2>{0.377734035f, 0.257934839f},
-std::array<float,2>{0.876193285f, 0.746642947f},
-std::array<float,2>{0.104362339f, 0.853230655f},
-std::array<float,2>{0.641282797f, 0.0240720287f},
-std::array<float,2>{0.141178712f, 0.199687704f},
-std::array<float,2>{0.595635891f, 0.945885479f},
-std::array<float,2>{0.34632656f, 0.617521048f},
-std::array<float,2>{0.752980292f, 0.433783442f},
-std::array<float,2>{0.416142315f, 0.015256674f},
-std::array<float,2>{0.920679927f, 0.870148301f},
-std::array<float,2>{0.0792682692f, 0.730917156f},
-std::array<float,2>{0.68007344f, 0.277125776f},
-std::array<float,2>{0.18209888f, 0.408563375f},
-std::array<float,2>{0.57921952f, 0.597756207f},
-std::array<float,2>{0.325744808f, 0.954459667f},
-std::array<float,2>{0.788260341f, 0.208073661f},
-std::array<float,2>{0.258918554f, 0.316473395f},
-std::array<float,2>{0.862664282f, 0.680424988f},
-std::array<float,2>{0.20707345f, 0.81186235f},
-std::array<float,2>{0.550197124f, 0.115321726f},
-std::array<float,2>{0.0289848763f, 0.167576417f},
-std::array<float,2>{0.698451817f, 0.876597583f},
-std::array<float,2>{0.45533517f, 0.53370136f},
-std::array<float,2>{0.967028558f, 0.483794302f},
-std::array<float,2>{0.36633119f, 0.245139271f},
-std::array<float,2>{0.772532344f, 0.981259167f},
-std::array<float,2>{0.131137878f, 0.587703168f},
-std::array<float,2>{0.613772511f, 0.381899863f},
-std::array<float,2>{0.122031353f, 0.312233984f},
-std::array<float,2>{0.632053792f, 0.706794679f},
-std::array<float,2>{0.40052259f, 0.827851355f},
-std::array<float,2>{0.898100376f, 0.0622964539f},
-std::array<float,2>{0.491932213f, 0.466850668f},
-std::array<float,2>{0.986183524f, 0.51484406f},
-std::array<float,2>{0.0374488682f, 0.907078207f},
-std::array<float,2>{0.749713719f, 0.1408187f},
-std::array<float,2>{0.225436673f, 0.0786306337f},
-std::array<float,2>{0.50568378f, 0.773681402f},
-std::array<float,2>{0.288654178f, 0.631575465f},
-std::array<float,2>{0.829328239f, 0.345961034f},
-std::array<float,2>{0.449246168f, 0.249768317f},
-std::array<float,2>{0.940303206f, 0.979119241f},
-std::array<float,2>{0.0010708723f, 0.591025412f},
-std::array<float,2>{0.713523448f, 0.378029883f},
-std::array<float,2>{0.187866926f, 0.307657421f},
-std::array<float,2>{0.532233357f, 0.710168958f},
-std::array<float,2>{0.266108602f, 0.821928859f},
-std::array<float,2>{0.855900049f, 0.0552823916f},
-std::array<float,2>{0.343128651f, 0.463227361f},
-std::array<float,2>{0.808749318f, 0.510842383f},
-std::array<float,2>{0.158728749f, 0.911680639f},
-std::array<float,2>{0.567524016f, 0.145007983f},
-std::array<float,2>{0.0670711771f, 0.0830651298f},
-std::array<float,2>{0.663750172f, 0.778861821f},
-std::array<float,2>{0.431973338f, 0.628748238f},
-std::array<float,2>{0.924519897f, 0.348774761f},
-std::array<float,2>{0.302964002f, 0.00952319428f},
-std::array<float,2>{0.82530278f, 0.871328533f},
-std::array<float,2>{0.244289756f, 0.728859603f},
-std::array<float,2>{0.526671767f, 0.280124068f},
-std::array<float,2>{0.0498696938f, 0.412276477f},
-std::array<float,2>{0.721966326f, 0.595553339f},
-std::array<float,2>{0.468894422f, 0.959119499f},
-std::array<float,2>{0.971132874f, 0.206280828f},
-std::array<float,2>{0.389115661f, 0.31583944f},
-std::array<float,2>{0.885704517f, 0.683684945f},
-std::array<float,2>{0.0999631062f, 0.806100905f},
-std::array<float,2>{0.649882913f, 0.111893497f},
-std::array<float,2>{0.151158482f, 0.168093234f},
-std::array<float,2>{0.606164515f, 0.882280588f},
-std::array<float,2>{0.351700217f, 0.537724853f},
-std::array<float,2>{0.762704194f, 0.477623373f},
-std::array<float,2>{0.413445979f, 0.0945975482f},
-std::array<float,2>{0.908925414f, 0.786814928f},
-std::array<float,2>{0.0927696228f, 0.660785377f},
-std::array<float,2>{0.672283351f, 0.338791579f},
-std::array<float,2>{0.174704865f, 0.487463176f},
-std::array<float,2>{0.589066207f, 0.56017822f},
-std::array<float,2>{0.319201022f, 0.897220373f},
-std::array<float,2>{0.792548597f, 0.180267707f},
-std::array<float,2>{0.25246796f, 0.261891365f},
-std::array<float,2>{0.873141229f, 0.742344022f},
-std::array<float,2>{0.217720404f, 0.859278083f},
-std::array<float,2>{0.555943191f, 0.0298314169f},
-std::array<float,2>{0.0196947977f, 0.198564455f},
-std::array<float,2>{0.691463828f, 0.951827168f},
-std::array<float,2>{0.462389439f, 0.624440134f},
-std::array<float,2>{0.95439291f, 0.433169425f},
-std::array<float,2>{0.372943819f, 0.13149032f},
-std::array<float,2>{0.780887783f, 0.926140726f},
-std::array<float,2>{0.136937425f, 0.529145241f},
-std::array<float,2>{0.618653297f, 0.446848214f},
-std::array<float,2>{0.115506478f, 0.360262781f},
-std::array<float,2>{0.640470326f, 0.65395236f},
-std::array<float,2>{0.396409273f, 0.763949156f},
-std::array<float,2>{0.904052079f, 0.0756786093f},
-std::array<float,2>{0.494976431f, 0.402396351f},
-std::array<float,2>{0.998697042f, 0.565308213f},
-std::array<float,2>{0.0460123457f, 0.992336214f},
-std::array<float,2>{0.741667867f, 0.232892126f},
-std::array<float,2>{0.227176726f, 0.0416327752f},
-std::array<float,2>{0.51327312f, 0.830693841f},
-std::array<float,2>{0.291681617f, 0.697746575f},
-std::array<float,2>{0.843257725f, 0.286187172f},
-std::array<float,2>{0.402690947f, 0.172142029f},
-std::array<float,2>{0.89437604f, 0.902719259f},
-std::array<float,2>{0.118158266f, 0.553309679f},
-std::array<float,2>{0.627738178f, 0.499703318f},
-std::array<float,2>{0.12715371f, 0.331981897f},
-std::array<float,2>{0.61288631f, 0.665548682f},
-std::array<float,2>{0.361764729f, 0.794587016f},
-std::array<float,2>{0.765981793f, 0.105201311f},
-std::array<float,2>{0.282328516f, 0.422224402f},
-std::array<float,2>{0.832881927f, 0.613411427f},
-std::array<float,2>{0.221614018f, 0.942849994f},
-std::array<float,2>{0.503192842f, 0.195113569f},
-std::array<float,2>{0.0319016352f, 0.0186386704f},
-std::array<float,2>{0.742471516f, 0.844730854f},
-std::array<float,2>{0.487347275f, 0.736301959f},
-std::array<float,2>{0.991797149f, 0.256492347f},
-std::array<float,2>{0.324044079f, 0.0702515095f},
-std::array<float,2>{0.784205794f, 0.753252923f},
-std::array<float,2>{0.185699061f, 0.64120388f},
-std::array<float,2>{0.583326936f, 0.374874741f},
-std::array<float,2>{0.0833219513f, 0.442572147f},
-std::array<float,2>{0.685068965f, 0.521317244f},
-std::array<float,2>{0.42011559f, 0.933074474f},
-std::array<float,2>{0.914635658f, 0.136574477f},
-std::array<float,2>{0.458703965f, 0.295798481f},
-std::array<float,2>{0.962824762f, 0.687562823f},
-std::array<float,2>{0.0243021324f, 0.843627155f},
-std::array<float,2>{0.701122463f, 0.0330175348f},
-std::array<float,2>{0.204574376f, 0.218828797f},
-std::array<float,2>{0.552626669f, 0.988837838f},
-std::array<float,2>{0.262128085f, 0.576743245f},
-std::array<float,2>{0.864445567f, 0.396568239f},
-std::array<float,2>{0.481132627f, 0.0497588776f},
-std::array<float,2>{0.981260955f, 0.817393482f},
-std::array<float,2>{0.0605998039f, 0.714775324f},
-std::array<float,2>{0.733029008f, 0.300145388f},
-std::array<float,2>{0.238087162f, 0.383836687f},
-std::array<float,2>{0.523029387f, 0.580558419f},
-std::array<float,2>{0.310725242f, 0.973271966f},
-std::array<float,2>{0.814178705f, 0.238728672f},
-std::array<float,2>{0.349491119f, 0.35527426f},
-std::array<float,2>{0.754653215f, 0.639873147f},
-std::array<float,2>{0.145817772f, 0.767909765f},
-std::array<float,2>{0.599704564f, 0.0906168446f},
-std::array<float,2>{0.108070664f, 0.150167987f},
-std::array<float,2>{0.647053897f, 0.916652977f},
-std::array<float,2>{0.379371285f, 0.506351054f},
-std::array<float,2>{0.880332947f, 0.454486847f},
-std::array<float,2>{0.27608496f, 0.212471068f},
-std::array<float,2>{0.84973067f, 0.96356529f},
-std::array<float,2>{0.201378077f, 0.601786554f},
-std::array<float,2>{0.540677965f, 0.420466125f},
-std::array<float,2>{0.0124531165f, 0.271457732f},
-std::array<float,2>{0.707664013f, 0.725065589f},
-std::array<float,2>{0.439816236f, 0.862088799f},
-std::array<float,2>{0.948959231f, 0.00528691942f},
-std::array<float,2>{0.422956914f, 0.476532191f},
-std::array<float,2>{0.937095404f, 0.53957653f},
-std::array<float,2>{0.0707411468f, 0.886760175f},
-std::array<float,2>{0.665592253f, 0.162634164f},
-std::array<float,2>{0.166816935f, 0.123627916f},
-std::array<float,2>{0.578099072f, 0.797695458f},
-std::array<float,2>{0.329292834f, 0.677004576f},
-std::array<float,2>{0.798867047f, 0.324889868f},
-std::array<float,2>{0.434689879f, 0.190216139f},
-std::array<float,2>{0.927365065f, 0.940304875f},
-std::array<float,2>{0.0659010634f, 0.610146165f},
-std::array<float,2>{0.658880293f, 0.426120162f},
-std::array<float,2>{0.161478162f, 0.251429737f},
-std::array<float,2>{0.56587857f, 0.740582943f},
-std::array<float,2>{0.336795658f, 0.849076986f},
-std::array<float,2>{0.806883574f, 0.0210656673f},
-std::array<float,2>{0.270926505f, 0.49464184f},
-std::array<float,2>{0.852214217f, 0.550064981f},
-std::array<float,2>{0.192608103f, 0.900341392f},
-std::array<float,2>{0.538385808f, 0.176022187f},
-std::array<float,2>{0.00534932455f, 0.107625134f},
-std::array<float,2>{0.716576338f, 0.792867661f},
-std::array<float,2>{0.446107507f, 0.668541431f},
-std::array<float,2>{0.941819429f, 0.333288014f},
-std::array<float,2>{0.357614815f, 0.0378650576f},
-std::array<float,2>{0.761051774f, 0.838972867f},
-std::array<float,2>{0.155754179f, 0.695067167f},
-std::array<float,2>{0.604228079f, 0.29020831f},
-std::array<float,2>{0.096524708f, 0.394093454f},
-std::array<float,2>{0.655639589f, 0.572998583f},
-std::array<float,2>{0.383396149f, 0.986863136f},
-std::array<float,2>{0.88750571f, 0.223280758f},
-std::array<float,2>{0.473988086f, 0.368137151f},
-std::array<float,2>{0.973659694f, 0.646098912f},
-std::array<float,2>{0.0539876856f, 0.754900932f},
-std::array<float,2>{0.722899079f, 0.0646329969f},
-std::array<float,2>{0.249355331f, 0.140607789f},
-std::array<float,2>{0.527513146f, 0.935133576f},
-std::array<float,2>{0.300343007f, 0.519003093f},
-std::array<float,2>{0.822147667f, 0.439873189f},
-std::array<float,2>{0.46644035f, 0.0874560252f},
-std::array<float,2>{0.958674967f, 0.771062911f},
-std::array<float,2>{0.0188934132f, 0.636494458f},
-std::array<float,2>{0.691171527f, 0.357200414f},
-std::array<float,2>{0.213264138f, 0.459851027f},
-std::array<float,2>{0.559625626f, 0.503032386f},
-std::array<float,2>{0.256329894f, 0.919402003f},
-std::array<float,2>{0.869720459f, 0.154218018f},
-std::array<float,2>{0.312690675f, 0.302452207f},
-std::array<float,2>{0.793928564f, 0.716480315f},
-std::array<float,2>{0.178463355f, 0.814026237f},
-std::array<float,2>{0.591226637f, 0.0519378521f},
-std::array<float,2>{0.0894710347f, 0.237111807f},
-std::array<float,2>{0.676191747f, 0.969803333f},
-std::array<float,2>{0.40949896f, 0.582043707f},
-std::array<float,2>{0.912047565f, 0.38895005f},
-std::array<float,2>{0.295942038f, 0.160145387f},
-std::array<float,2>{0.836186588f, 0.886138856f},
-std::array<float,2>{0.23251982f, 0.546467245f},
-std::array<float,2>{0.511641622f, 0.470647454f},
-std::array<float,2>{0.0422952659f, 0.3222875f},
-std::array<float,2>{0.737928331f, 0.67399317f},
-std::array<float,2>{0.496832252f, 0.801380754f},
-std::array<float,2>{0.994643688f, 0.120636784f},
-std::array<float,2>{0.392917991f, 0.417331994f},
-std::array<float,2>{0.899586737f, 0.608697295f},
-std::array<float,2>{0.109419182f, 0.965539277f},
-std::array<float,2>{0.634898305f, 0.21679233f},
-std::array<float,2>{0.134347215f, 0.00116596569f},
-std::array<float,2>{0.624050796f, 0.863696754f},
-std::array<float,2>{0.370031834f, 0.720611274f},
-std::array<float,2>{0.77590692f, 0.267531961f},
-std::array<float,2>{0.488801986f, 0.142294496f},
-std::array<float,2>{0.988162398f, 0.907813728f},
-std::array<float,2>{0.0363871828f, 0.514305472f},
-std::array<float,2>{0.747718811f, 0.468515724f},
-std::array<float,2>{0.223420903f, 0.347614229f},
-std::array<float,2>{0.506112456f, 0.632565081f},
-std::array<float,2>{0.28529349f, 0.77480197f},
-std::array<float,2>{0.831254125f, 0.0796738416f},
-std::array<float,2>{0.364632398f, 0.381329566f},
-std::array<float,2>{0.770703435f, 0.586182773f},
-std::array<float,2>{0.129096508f, 0.981672466f},
-std::array<float,2>{0.615917027f, 0.244380295f},
-std::array<float,2>{0.124987349f, 0.0605622828f},
-std::array<float,2>{0.629321694f, 0.826360226f},
-std::array<float,2>{0.398473263f, 0.705159605f},
-std::array<float,2>{0.895489156f, 0.310660481f},
-std::array<float,2>{0.261173725f, 0.116414934f},
-std::array<float,2>{0.860212445f, 0.810654759f},
-std::array<float,2>{0.210535869f, 0.681637883f},
-std::array<float,2>{0.54864192f, 0.317685515f},
-std::array<float,2>{0.0311343316f, 0.482661009f},
-std::array<float,2>{0.696512043f, 0.534612656f},
-std::array<float,2>{0.454416275f, 0.875574827f},
-std::array<float,2>{0.965215325f, 0.166151822f},
-std::array<float,2>{0.415293366f, 0.275704592f},
-std::array<float,2>{0.918967664f, 0.732415259f},
-std::array<float,2>{0.0819787681f, 0.86968416f},
-std::array<float,2>{0.682608187f, 0.0141674783f},
-std::array<float,2>{0.180124059f, 0.207600892f},
-std::array<float,2>{0.580379248f, 0.95343852f},
-std::array<float,2>{0.326808095f, 0.598875642f},
-std::array<float,2>{0.786291063f, 0.409355015f},
-std::array<float,2>{0.375696391f, 0.02532956f},
-std::array<float,2>{0.876969874f, 0.852433622f},
-std::array<float,2>{0.102617584f, 0.747267842f},
-std::array<float,2>{0.642891228f, 0.258919179f},
-std::array<float,2>{0.143336713f, 0.435533077f},
-std::array<float,2>{0.59732163f, 0.618567169f},
-std::array<float,2>{0.345106423f, 0.946677625f},
-std::array<float,2>{0.750165045f, 0.200708672f},
-std::array<float,2>{0.306995571f, 0.343419731f},
-std::array<float,2>{0.819877148f, 0.658035696f},
-std::array<float,2>{0.238504529f, 0.784435034f},
-std::array<float,2>{0.516464055f, 0.0996011347f},
-std::array<float,2>{0.057625398f, 0.184480101f},
-std::array<float,2>{0.729661345f, 0.892024279f},
-std::array<float,2>{0.478654325f, 0.557918012f},
-std::array<float,2>{0.978720784f, 0.492101043f},
-std::array<float,2>{0.333451927f, 0.229190767f},
-std::array<float,2>{0.803935766f, 0.998935223f},
-std::array<float,2>{0.169721276f, 0.567423522f},
-std::array<float,2>{0.572717726f, 0.401240915f},
-std::array<float,2>{0.0768840089f, 0.282662392f},
-std::array<float,2>{0.668512344f, 0.699476838f},
-std::array<float,2>{0.425977468f, 0.834908307f},
-std::array<float,2>{0.930518687f, 0.0435885265f},
-std::array<float,2>{0.441492826f, 0.450940132f},
-std::array<float,2>{0.951441765f, 0.527022421f},
-std::array<float,2>{0.00978944451f, 0.923808038f},
-std::array<float,2>{0.704404235f, 0.126885325f},
-std::array<float,2>{0.197694018f, 0.0728555024f},
-std::array<float,2>{0.545670927f, 0.758038223f},
-std::array<float,2>{0.277620703f, 0.651070356f},
-std::array<float,2>{0.846866131f, 0.364893138f},
-std::array<float,2>{0.470713943f, 0.204834968f},
-std::array<float,2>{0.970659792f, 0.957063377f},
-std::array<float,2>{0.0472270735f, 0.597553909f},
-std::array<float,2>{0.71882838f, 0.410783172f},
-std::array<float,2>{0.243452385f, 0.278057694f},
-std::array<float,2>{0.524623513f, 0.727510095f},
-std::array<float,2>{0.302588463f, 0.874085724f},
-std::array<float,2>{0.826278925f, 0.0103761526f},
-std::array<float,2>{0.353947699f, 0.478781462f},
-std::array<float,2>{0.765292287f, 0.535512984f},
-std::array<float,2>{0.15003264f, 0.880809307f},
-std::array<float,2>{0.608475804f, 0.170775861f},
-std::array<float,2>{0.0979609042f, 0.110559523f},
-std::array<float,2>{0.651769578f, 0.808347881f},
-std::array<float,2>{0.388636172f, 0.685645163f},
-std::array<float,2>{0.883532047f, 0.314338028f},
-std::array<float,2>{0.267944455f, 0.0567693785f},
-std::array<float,2>{0.859240353f, 0.824132204f},
-std::array<float,2>{0.189645648f, 0.707441747f},
-std::array<float,2>{0.534747124f, 0.305378616f},
-std::array<float,2>{0.00230287225f, 0.37558195f},
-std::array<float,2>{0.711893797f, 0.593263805f},
-std::array<float,2>{0.452710301f, 0.97716552f},
-std::array<float,2>{0.939293087f, 0.247258723f},
-std::array<float,2>{0.42999655f, 0.34990865f},
-std::array<float,2>{0.922758698f, 0.625770628f},
-std::array<float,2>{0.0698352009f, 0.780031443f},
-std::array<float,2>{0.66142416f, 0.0851765871f},
-std::array<float,2>{0.156915396f, 0.146919221f},
-std::array<float,2>{0.569924057f, 0.912980676f},
-std::array<float,2>{0.340141535f, 0.508467972f},
-std::array<float,2>{0.811691523f, 0.461718857f},
-std::array<float,2>{0.397800714f, 0.0775554404f},
-std::array<float,2>{0.905215085f, 0.761865854f},
-std::array<float,2>{0.11503505f, 0.656136453f},
-std::array<float,2>{0.637633979f, 0.362281561f},
-std::array<float,2>{0.139974207f, 0.449024111f},
-std::array<float,2>{0.620004296f, 0.530885458f},
-std::array<float,2>{0.374206811f, 0.929040074f},
-std::array<float,2>{0.778589487f, 0.129824147f},
-std::array<float,2>{0.290096134f, 0.288035899f},
-std::array<float,2>{0.839879394f, 0.696827531f},
-std::array<float,2>{0.230177462f, 0.828786492f},
-std::array<float,2>{0.514979899f, 0.0395216197f},
-std::array<float,2>{0.0442943648f, 0.230788767f},
-std::array<float,2>{0.739425182f, 0.995811105f},
-std::array<float,2>{0.493915021f, 0.563089252f},
-std::array<float,2>{0.996772885f, 0.4046202f},
-std::array<float,2>{0.317347378f, 0.182795852f},
-std::array<float,2>{0.790591836f, 0.895460129f},
-std::array<float,2>{0.17353791f, 0.560835361f},
-std::array<float,2>{0.587209284f, 0.485418946f},
-std::array<float,2>{0.0917249769f, 0.33676976f},
-std::array<float,2>{0.675409734f, 0.663187325f},
-std::array<float,2>{0.410271585f, 0.787284553f},
-std::array<float,2>{0.907886863f, 0.0971366242f},
-std::array<float,2>{0.464226812f, 0.430831105f},
-std::array<float,2>{0.9558447f, 0.622778177f},
-std::array<float,2>{0.0217149016f, 0.949503601f},
-std::array<float,2>{0.694735229f, 0.196501374f},
-std::array<float,2>{0.216124177f, 0.0277563334f},
-std::array<float,2>{0.558507383f, 0.857271254f},
-std::array<float,2>{0.250841111f, 0.746075392f},
-std::array<float,2>{0.871953428f, 0.264130592f},
-std::array<float,2>{0.419554174f, 0.134299219f},
-std::array<float,2>{0.917256713f, 0.931443393f},
-std::array<float,2>{0.0856632814f, 0.522684693f},
-std::array<float,2>{0.686632454f, 0.443947434f},
-std::array<float,2>{0.184622869f, 0.3720254f},
-std::array<float,2>{0.585172296f, 0.644133806f},
-std::array<float,2>{0.321332604f, 0.751167059f},
-std::array<float,2>{0.782200336f, 0.0674903691f},
-std::array<float,2>{0.264872491f, 0.395340949f},
-std::array<float,2>{0.865278006f, 0.57538116f},
-std::array<float,2>{0.205131486f, 0.991714537f},
-std::array<float,2>{0.553327024f, 0.220966727f},
-std::array<float,2>{0.0268977378f, 0.0345647596f},
-std::array<float,2>{0.70233047f, 0.841581762f},
-std::array<float,2>{0.459831327f, 0.689581931f},
-std::array<float,2>{0.962994695f, 0.294265121f},
-std::array<float,2>{0.360757738f, 0.103354186f},
-std::array<float,2>{0.769213259f, 0.79623431f},
-std::array<float,2>{0.125233039f, 0.667445183f},
-std::array<float,2>{0.609770179f, 0.328909904f},
-std::array<float,2>{0.120318726f, 0.497040093f},
-std::array<float,2>{0.625788152f, 0.552096248f},
-std::array<float,2>{0.405322552f, 0.905299306f},
-std::array<float,2>{0.892170191f, 0.175555617f},
-std::array<float,2>{0.484667748f, 0.254615635f},
-std::array<float,2>{0.98977679f, 0.737140417f},
-std::array<float,2>{0.033931572f, 0.846016765f},
-std::array<float,2>{0.746043324f, 0.0162638798f},
-std::array<float,2>{0.219822973f, 0.191420153f},
-std::array<float,2>{0.501057029f, 0.945250571f},
-std::array<float,2>{0.283806652f, 0.616949856f},
-std::array<float,2>{0.834012032f, 0.42559433f},
-std::array<float,2>{0.438506871f, 0.00599466031f},
-std::array<float,2>{0.945940435f, 0.860350311f},
-std::array<float,2>{0.0150224967f, 0.723449528f},
-std::array<float,2>{0.710666597f, 0.271502584f},
-std::array<float,2>{0.200127259f, 0.41939193f},
-std::array<float,2>{0.541263521f, 0.605454266f},
-std::array<float,2>{0.273660749f, 0.962218523f},
-std::array<float,2>{0.848583639f, 0.214430422f},
-std::array<float,2>{0.331521749f, 0.327610046f},
-std::array<float,2>{0.798157871f, 0.678422511f},
-std::array<float,2>{0.165966466f, 0.800756931f},
-std::array<float,2>{0.574847102f, 0.121213548f},
-std::array<float,2>{0.0724575743f, 0.161748901f},
-std::array<float,2>{0.66773355f, 0.890266538f},
-std::array<float,2>{0.425481796f, 0.542639673f},
-std::array<float,2>{0.933891237f, 0.473540336f},
-std::array<float,2>{0.310038358f, 0.241878539f},
-std::array<float,2>{0.816291332f, 0.975002348f},
-std::array<float,2>{0.235842034f, 0.579506814f},
-std::array<float,2>{0.520631254f, 0.385677874f},
-std::array<float,2>{0.0599909462f, 0.297578514f},
-std::array<float,2>{0.731897056f, 0.712092698f},
-std::array<float,2>{0.484336734f, 0.819528222f},
-std::array<float,2>{0.983039081f, 0.0473512188f},
-std::array<float,2>{0.381626844f, 0.456574559f},
-std::array<float,2>{0.881021023f, 0.505124331f},
-std::array<float,2>{0.105738461f, 0.914632797f},
-std::array<float,2>{0.645554364f, 0.151181445f},
-std::array<float,2>{0.147132918f, 0.0930062905f},
-std::array<float,2>{0.598523974f, 0.765746415f},
-std::array<float,2>{0.350835472f, 0.638155043f},
-std::array<float,2>{0.756780744f, 0.35191834f},
-std::array<float,2>{0.386025876f, 0.226354316f},
-std::array<float,2>{0.890323102f, 0.98606509f},
-std::array<float,2>{0.0950661004f, 0.570971429f},
-std::array<float,2>{0.652706742f, 0.391042262f},
-std::array<float,2>{0.153244361f, 0.29172796f},
-std::array<float,2>{0.603441954f, 0.692447245f},
-std::array<float,2>{0.35573411f, 0.837555587f},
-std::array<float,2>{0.758812428f, 0.0362470746f},
-std::array<float,2>{0.296948403f, 0.438416839f},
-std::array<float,2>{0.824123979f, 0.516346633f},
-std::array<float,2>{0.246796012f, 0.937485635f},
-std::array<float,2>{0.530011237f, 0.136862531f},
-std::array<float,2>{0.0517481267f, 0.0643534213f},
-std::array<float,2>{0.725078404f, 0.756591618f},
-std::array<float,2>{0.474716932f, 0.647836685f},
-std::array<float,2>{0.976373315f, 0.369822979f},
-std::array<float,2>{0.338972002f, 0.0233184751f},
-std::array<float,2>{0.805062473f, 0.850987613f},
-std::array<float,2>{0.163718805f, 0.739112675f},
-std::array<float,2>{0.56392771f, 0.252851635f},
-std::array<float,2>{0.0634611621f, 0.428713471f},
-std::array<float,2>{0.65797025f, 0.613147199f},
-std::array<float,2>{0.435825884f, 0.93802166f},
-std::array<float,2>{0.928289473f, 0.188408792f},
-std::array<float,2>{0.447448194f, 0.334703237f},
-std::array<float,2>{0.944272399f, 0.67115289f},
-std::array<float,2>{0.00627738563f, 0.790835738f},
-std::array<float,2>{0.718161881f, 0.106159709f},
-std::array<float,2>{0.194354072f, 0.179548934f},
-std::array<float,2>{0.536450863f, 0.901384234f},
-std::array<float,2>{0.272466123f, 0.548557281f},
-std::array<float,2>{0.855363905f, 0.493366778f},
-std::array<float,2>{0.498885512f, 0.118286967f},
-std::array<float,2>{0.993630111f, 0.803806663f},
-std::array<float,2>{0.0394068956f, 0.67270261f},
-std::array<float,2>{0.736277878f, 0.320886075f},
-std::array<float,2>{0.232130319f, 0.470712125f},
-std::array<float,2>{0.508443415f, 0.543473184f},
-std::array<float,2>{0.294031531f, 0.883491397f},
-std::array<float,2>{0.83913666f, 0.157855377f},
-std::array<float,2>{0.369119465f, 0.269108146f},
-std::array<float,2>{0.775097013f, 0.722136021f},
-std::array<float,2>{0.136018947f, 0.866333902f},
-std::array<float,2>{0.622294724f, 0.0028729788f},
-std::array<float,2>{0.111416027f, 0.218365088f},
-std::array<float,2>{0.632989287f, 0.966815472f},
-std::array<float,2>{0.391679794f, 0.605753183f},
-std::array<float,2>{0.901243746f, 0.414734125f},
-std::array<float,2>{0.253965795f, 0.155517846f},
-std::array<float,2>{0.868515313f, 0.920050979f},
-std::array<float,2>{0.212239385f, 0.501032829f},
-std::array<float,2>{0.562200546f, 0.458194554f},
-std::array<float,2>{0.0169534553f, 0.358582377f},
-std::array<float,2>{0.688883066f, 0.633265436f},
-std::array<float,2>{0.468351245f, 0.771746218f},
-std::array<float,2>{0.959218979f, 0.0895603597f},
-std::array<float,2>{0.406657875f, 0.386992127f},
-std::array<float,2>{0.912286758f, 0.584241867f},
-std::array<float,2>{0.0872868374f, 0.971265376f},
-std::array<float,2>{0.678266883f, 0.236260608f},
-std::array<float,2>{0.176433742f, 0.0541591085f},
-std::array<float,2>{0.591932535f, 0.815183401f},
-std::array<float,2>{0.315122336f, 0.716831625f},
-std::array<float,2>{0.795499325f, 0.303769827f},
-std::array<float,2>{0.456125826f, 0.164204136f},
-std::array<float,2>{0.967964828f, 0.877677739f},
-std::array<float,2>{0.0279463809f, 0.531924248f},
-std::array<float,2>{0.69772166f, 0.481690556f},
-std::array<float,2>{0.20878756f, 0.319864511f},
-std::array<float,2>{0.549494386f, 0.681938827f},
-std::array<float,2>{0.258039892f, 0.80948329f},
-std::array<float,2>{0.861503363f, 0.115135185f},
-std::array<float,2>{0.325038999f, 0.408036113f},
-std::array<float,2>{0.787558377f, 0.600527465f},
-std::array<float,2>{0.182915181f, 0.955366135f},
-std::array<float,2>{0.579025686f, 0.209711358f},
-std::array<float,2>{0.0790161341f, 0.0122131808f},
-std::array<float,2>{0.680745959f, 0.867546439f},
-std::array<float,2>{0.417567283f, 0.732600689f},
-std::array<float,2>{0.921156526f, 0.274046808f},
-std::array<float,2>{0.287711471f, 0.0803532302f},
-std::array<float,2>{0.829060733f, 0.777312577f},
-std::array<float,2>{0.225736678f, 0.629351318f},
-std::array<float,2>{0.503911674f, 0.344453305f},
-std::array<float,2>{0.0383390933f, 0.465129495f},
-std::array<float,2>{0.748951554f, 0.512250543f},
-std::array<float,2>{0.491022229f, 0.908776462f},
-std::array<float,2>{0.984795332f, 0.143051118f},
-std::array<float,2>{0.402338892f, 0.310425341f},
-std::array<float,2>{0.896918952f, 0.703982174f},
-std::array<float,2>{0.122176617f, 0.825031936f},
-std::array<float,2>{0.631633759f, 0.0605205335f},
-std::array<float,2>{0.131837621f, 0.243072078f},
-std::array<float,2>{0.614493966f, 0.983551621f},
-std::array<float,2>{0.365822405f, 0.58824873f},
-std::array<float,2>{0.771704674f, 0.379612327f},
-std::array<float,2>{0.429671586f, 0.0465674587f},
-std::array<float,2>{0.932135105f, 0.833041728f},
-std::array<float,2>{0.0743292198f, 0.702198863f},
-std::array<float,2>{0.670418561f, 0.283711672f},
-std::array<float,2>{0.171290278f, 0.399095148f},
-std::array<float,2>{0.571982741f, 0.570298791f},
-std::array<float,2>{0.335302502f, 0.996858656f},
-std::array<float,2>{0.802295208f, 0.228116304f},
-std::array<float,2>{0.280569583f, 0.366109639f},
-std::array<float,2>{0.844506323f, 0.649238527f},
-std::array<float,2>{0.196902618f, 0.759859204f},
-std::array<float,2>{0.544913113f, 0.0719242617f},
-std::array<float,2>{0.00825324934f, 0.128021345f},
-std::array<float,2>{0.705430031f, 0.924512625f},
-std::array<float,2>{0.444389015f, 0.524476886f},
-std::array<float,2>{0.950249672f, 0.451317787f},
-std::array<float,2>{0.347542733f, 0.203027964f},
-std::array<float,2>{0.752914608f, 0.948189437f},
-std::array<float,2>{0.142236933f, 0.619576693f},
-std::array<float,2>{0.594322026f, 0.437281132f},
-std::array<float,2>{0.105005592f, 0.260923684f},
-std::array<float,2>{0.642021596f, 0.748380542f},
-std::array<float,2>{0.378802717f, 0.853844941f},
-std::array<float,2>{0.875329375f, 0.026997136f},
-std::array<float,2>{0.477467358f, 0.489704341f},
-std::array<float,2>{0.976879001f, 0.555735469f},
-std::array<float,2>{0.056632299f, 0.893329561f},
-std::array<float,2>{0.727913678f, 0.185565233f},
-std::array<float,2>{0.241198733f, 0.101060607f},
-std::array<float,2>{0.518810272f, 0.781313121f},
-std::array<float,2>{0.305633038f, 0.659333944f},
-std::array<float,2>{0.817331433f, 0.339948446f},
-std::array<float,2>{0.440174252f, 0.214059979f},
-std::array<float,2>{0.948561788f, 0.962598741f},
-std::array<float,2>{0.0121592488f, 0.604713261f},
-std::array<float,2>{0.707292736f, 0.419771016f},
-std::array<float,2>{0.201928705f, 0.272450745f},
-std::array<float,2>{0.540126562f, 0.722802639f},
-std::array<float,2>{0.275804251f, 0.859824657f},
-std::array<float,2>{0.850367427f, 0.00642139791f},
-std::array<float,2>{0.329618782f, 0.473047137f},
-std::array<float,2>{0.799800932f, 0.542340219f},
-std::array<float,2>{0.166198343f, 0.88999331f},
-std::array<float,2>{0.577624321f, 0.161488712f},
-std::array<float,2>{0.0712857693f, 0.121637665f},
-std::array<float,2>{0.665151179f, 0.800150394f},
-std::array<float,2>{0.423666894f, 0.678204417f},
-std::array<float,2>{0.936732113f, 0.327833354f},
-std::array<float,2>{0.311347127f, 0.0476380475f},
-std::array<float,2>{0.813848257f, 0.819878161f},
-std::array<float,2>{0.237488702f, 0.712862551f},
-std::array<float,2>{0.522765636f, 0.296928763f},
-std::array<float,2>{0.0612965487f, 0.385006636f},
-std::array<float,2>{0.732744813f, 0.579881847f},
-std::array<float,2>{0.480871618f, 0.975343108f},
-std::array<float,2>{0.980786979f, 0.241483286f},
-std::array<float,2>{0.379704148f, 0.352165163f},
-std::array<float,2>{0.880565643f, 0.638248742f},
-std::array<float,2>{0.107744299f, 0.766328931f},
-std::array<float,2>{0.646719754f, 0.0936726406f},
-std::array<float,2>{0.146450177f, 0.150723636f},
-std::array<float,2>{0.600460112f, 0.914541125f},
-std::array<float,2>{0.34866038f, 0.505709171f},
-std::array<float,2>{0.754095316f, 0.456264347f},
-std::array<float,2>{0.420482397f, 0.0680563971f},
-std::array<float,2>{0.914159238f, 0.751474798f},
-std::array<float,2>{0.0838444084f, 0.643845558f},
-std::array<float,2>{0.68462652f, 0.371352494f},
-std::array<float,2>{0.186045811f, 0.443730652f},
-std::array<float,2>{0.583639801f, 0.523097456f},
-std::array<float,2>{0.323356032f, 0.930682957f},
-std::array<float,2>{0.784921765f, 0.134055242f},
-std::array<float,2>{0.262455881f, 0.294471115f},
-std::array<float,2>{0.865032017f, 0.690316856f},
-std::array<float,2>{0.204602405f, 0.84119451f},
-std::array<float,2>{0.552151263f, 0.0349673666f},
-std::array<float,2>{0.0237961579f, 0.221356615f},
-std::array<float,2>{0.700267732f, 0.991581619f},
-std::array<float,2>{0.458276331f, 0.575907826f},
-std::array<float,2>{0.961999834f, 0.394587725f},
-std::array<float,2>{0.362008899f, 0.175035819f},
-std::array<float,2>{0.766262054f, 0.906089365f},
-std::array<float,2>{0.127726823f, 0.552584052f},
-std::array<float,2>{0.612493098f, 0.496433944f},
-std::array<float,2>{0.117552102f, 0.328310728f},
-std::array<float,2>{0.627100945f, 0.667957187f},
-std::array<float,2>{0.403276175f, 0.796456933f},
-std::array<float,2>{0.893902421f, 0.102822043f},
-std::array<float,2>{0.488090545f, 0.425089031f},
-std::array<float,2>{0.991435766f, 0.616286635f},
-std::array<float,2>{0.0316717997f, 0.944445193f},
-std::array<float,2>{0.743026376f, 0.192238063f},
-std::array<float,2>{0.221118197f, 0.0160109196f},
-std::array<float,2>{0.503665328f, 0.846219897f},
-std::array<float,2>{0.283145458f, 0.736426055f},
-std::array<float,2>{0.832211852f, 0.254123509f},
-std::array<float,2>{0.395973057f, 0.129288986f},
-std::array<float,2>{0.903361619f, 0.929599404f},
-std::array<float,2>{0.116018742f, 0.530400693f},
-std::array<float,2>{0.640051246f, 0.44864282f},
-std::array<float,2>{0.137209937f, 0.361619443f},
-std::array<float,2>{0.61844945f, 0.655278683f},
-std::array<float,2>{0.372552425f, 0.762215495f},
-std::array<float,2>{0.780524015f, 0.0779424757f},
-std::array<float,2>{0.291233927f, 0.404910684f},
-std::array<float,2>{0.843311608f, 0.562805712f},
-std::array<float,2>{0.22691372f, 0.995536923f},
-std::array<float,2>{0.512945712f, 0.231381744f},
-std::array<float,2>{0.0464308225f, 0.0398562662f},
-std::array<float,2>{0.742093444f, 0.828566611f},
-std::array<float,2>{0.494188249f, 0.696599722f},
-std::array<float,2>{0.998327434f, 0.287536979f},
-std::array<float,2>{0.318671256f, 0.097331576f},
-std::array<float,2>{0.792322636f, 0.78763324f},
-std::array<float,2>{0.174069017f, 0.663852334f},
-std::array<float,2>{0.589446604f, 0.336144388f},
-std::array<float,2>{0.0921598747f, 0.48609665f},
-std::array<float,2>{0.672642827f, 0.561209261f},
-std::array<float,2>{0.413949966f, 0.894895017f},
-std::array<float,2>{0.908228457f, 0.183507711f},
-std::array<float,2>{0.462562829f, 0.264495194f},
-std::array<float,2>{0.954957008f, 0.745312989f},
-std::array<float,2>{0.0203055292f, 0.856925249f},
-std::array<float,2>{0.692032695f, 0.0282933731f},
-std::array<float,2>{0.216882959f, 0.196885943f},
-std::array<float,2>{0.556626499f, 0.950164497f},
-std::array<float,2>{0.252376586f, 0.622173011f},
-std::array<float,2>{0.873571992f, 0.431604266f},
-std::array<float,2>{0.469296694f, 0.0100097209f},
-std::array<float,2>{0.971279502f, 0.874835908f},
-std::array<float,2>{0.050681252f, 0.72702527f},
-std::array<float,2>{0.722544789f, 0.277408034f},
-std::array<float,2>{0.244701535f, 0.410586178f},
-std::array<float,2>{0.526949108f, 0.596905172f},
-std::array<float,2>{0.303620279f, 0.957884967f},
-std::array<float,2>{0.826046407f, 0.204247221f},
-std::array<float,2>{0.352143675f, 0.313779026f},
-std::array<float,2>{0.763305128f, 0.686105788f},
-std::array<float,2>{0.150611222f, 0.807861447f},
-std::array<float,2>{0.605664194f, 0.111100093f},
-std::array<float,2>{0.100572564f, 0.170189336f},
-std::array<float,2>{0.64999485f, 0.880297124f},
-std::array<float,2>{0.389300764f, 0.535666347f},
-std::array<float,2>{0.885065138f, 0.479266793f},
-std::array<float,2>{0.266219586f, 0.247867987f},
-std::array<float,2>{0.856254399f, 0.976587117f},
-std::array<float,2>{0.188397065f, 0.592822075f},
-std::array<float,2>{0.533008516f, 0.375464648f},
-std::array<float,2>{0.00157472189f, 0.304783851f},
-std::array<float,2>{0.713298798f, 0.707727551f},
-std::array<float,2>{0.450085998f, 0.823614061f},
-std::array<float,2>{0.939911544f, 0.0574154183f},
-std::array<float,2>{0.432257146f, 0.461115837f},
-std::array<float,2>{0.923986971f, 0.508244991f},
-std::array<float,2>{0.0665424392f, 0.912276506f},
-std::array<float,2>{0.663226664f, 0.147245467f},
-std::array<float,2>{0.158415377f, 0.0858135968f},
-std::array<float,2>{0.568310261f, 0.779376686f},
-std::array<float,2>{0.343428105f, 0.625485539f},
-std::array<float,2>{0.809464037f, 0.35028556f},
-std::array<float,2>{0.42668426f, 0.227899417f},
-std::array<float,2>{0.930067062f, 0.996385157f},
-std::array<float,2>{0.0761817098f, 0.569506526f},
-std::array<float,2>{0.668095827f, 0.398896486f},
-std::array<float,2>{0.169153854f, 0.283257931f},
-std::array<float,2>{0.573217332f, 0.702961862f},
-std::array<float,2>{0.333761096f, 0.833822787f},
-std::array<float,2>{0.804394126f, 0.0460742749f},
-std::array<float,2>{0.278024912f, 0.451672494f},
-std::array<float,2>{0.847369492f, 0.525278687f},
-std::array<float,2>{0.198014736f, 0.923841894f},
-std::array<float,2>{0.54530412f, 0.128814176f},
-std::array<float,2>{0.0103893755f, 0.071517989f},
-std::array<float,2>{0.704700649f, 0.76068908f},
-std::array<float,2>{0.442016602f, 0.648864925f},
-std::array<float,2>{0.951982141f, 0.365314752f},
-std::array<float,2>{0.345581055f, 0.0267525278f},
-std::array<float,2>{0.750861406f, 0.85435009f},
-std::array<float,2>{0.142683327f, 0.748637378f},
-std::array<float,2>{0.596962571f, 0.261686891f},
-std::array<float,2>{0.103499167f, 0.436839014f},
-std::array<float,2>{0.643303752f, 0.619965017f},
-std::array<float,2>{0.375225902f, 0.947405279f},
-std::array<float,2>{0.877660573f, 0.202243328f},
-std::array<float,2>{0.479054034f, 0.340626568f},
-std::array<float,2>{0.979266942f, 0.659867227f},
-std::array<float,2>{0.0584363267f, 0.782153726f},
-std::array<float,2>{0.730376959f, 0.101174302f},
-std::array<float,2>{0.239121705f, 0.186079666f},
-std::array<float,2>{0.515872717f, 0.892886341f},
-std::array<float,2>{0.307332516f, 0.556182265f},
-std::array<float,2>{0.819395125f, 0.489840984f},
-std::array<float,2>{0.454842389f, 0.114259817f},
-std::array<float,2>{0.965700984f, 0.808903754f},
-std::array<float,2>{0.0305499751f, 0.682382703f},
-std::array<float,2>{0.696895182f, 0.319410324f},
-std::array<float,2>{0.210227042f, 0.482266665f},
-std::array<float,2>{0.548101008f, 0.531410754f},
-std::array<float,2>{0.261424541f, 0.877317667f},
-std::array<float,2>{0.859553576f, 0.164707363f},
-std::array<float,2>{0.326315939f, 0.273713052f},
-std::array<float,2>{0.787035882f, 0.733327746f},
-std::array<float,2>{0.18059288f, 0.867961168f},
-std::array<float,2>{0.580868185f, 0.0118871573f},
-std::array<float,2>{0.0814880729f, 0.209113359f},
-std::array<float,2>{0.681946158f, 0.955904126f},
-std::array<float,2>{0.415569037f, 0.599885881f},
-std::array<float,2>{0.91964072f, 0.407639414f},
-std::array<float,2>{0.28581953f, 0.143399805f},
-std::array<float,2>{0.83174789f, 0.908539534f},
-std::array<float,2>{0.222809121f, 0.511911094f},
-std::array<float,2>{0.506830573f, 0.465698808f},
-std::array<float,2>{0.0368856154f, 0.343800157f},
-std::array<float,2>{0.747549176f, 0.629766524f},
-std::array<float,2>{0.488323689f, 0.776773691f},
-std::array<float,2>{0.987736046f, 0.0807970092f},
-std::array<float,2>{0.399187446f, 0.378914714f},
-std::array<float,2>{0.894553483f, 0.588616133f},
-std::array<float,2>{0.124135114f, 0.984099209f},
-std::array<float,2>{0.629844069f, 0.242355138f},
-std::array<float,2>{0.129639864f, 0.0599889494f},
-std::array<float,2>{0.615370512f, 0.824324727f},
-std::array<float,2>{0.365087509f, 0.703139961f},
-std::array<float,2>{0.771346152f, 0.30967772f},
-std::array<float,2>{0.496546656f, 0.157584384f},
-std::array<float,2>{0.994205296f, 0.883237302f},
-std::array<float,2>{0.0426965766f, 0.543449044f},
-std::array<float,2>{0.737656653f, 0.471523315f},
-std::array<float,2>{0.232957587f, 0.320577919f},
-std::array<float,2>{0.511000216f, 0.672224104f},
-std::array<float,2>{0.296777964f, 0.804582238f},
-std::array<float,2>{0.836745203f, 0.118844263f},
-std::array<float,2>{0.369189173f, 0.414334625f},
-std::array<float,2>{0.77553463f, 0.606028259f},
-std::array<float,2>{0.133937895f, 0.967334628f},
-std::array<float,2>{0.624933779f, 0.217776641f},
-std::array<float,2>{0.110213794f, 0.00229520234f},
-std::array<float,2>{0.635628998f, 0.867139041f},
-std::array<float,2>{0.393349856f, 0.722546577f},
-std::array<float,2>{0.90001452f, 0.268777579f},
-std::array<float,2>{0.256415546f, 0.0893006623f},
-std::array<float,2>{0.8692922f, 0.772248149f},
-std::array<float,2>{0.213475004f, 0.633671582f},
-std::array<float,2>{0.560176194f, 0.358954459f},
-std::array<float,2>{0.0192616731f, 0.458695412f},
-std::array<float,2>{0.69082129f, 0.501509309f},
-std::array<float,2>{0.465958059f, 0.920714438f},
-std::array<float,2>{0.958030462f, 0.156202376f},
-std::array<float,2>{0.409973592f, 0.304509491f},
-std::array<float,2>{0.911458075f, 0.717741311f},
-std::array<float,2>{0.0892874002f, 0.814804018f},
-std::array<float,2>{0.676726341f, 0.0543771945f},
-std::array<float,2>{0.178192899f, 0.235679552f},
-std::array<float,2>{0.591789901f, 0.970869482f},
-std::array<float,2>{0.313424826f, 0.584598839f},
-std::array<float,2>{0.793420672f, 0.387396336f},
-std::array<float,2>{0.38324067f, 0.0368251503f},
-std::array<float,2>{0.88678354f, 0.837202966f},
-std::array<float,2>{0.0961175188f, 0.693277121f},
-std::array<float,2>{0.656219959f, 0.291478097f},
-std::array<float,2>{0.156064719f, 0.391364902f},
-std::array<float,2>{0.603798449f, 0.570453346f},
-std::array<float,2>{0.358054519f, 0.985475004f},
-std::array<float,2>{0.76132673f, 0.225702941f},
-std::array<float,2>{0.300100654f, 0.369216263f},
-std::array<float,2>{0.821360469f, 0.648388386f},
-std::array<float,2>{0.249643654f, 0.756228328f},
-std::array<float,2>{0.528269589f, 0.0638531744f},
-std::array<float,2>{0.0542719848f, 0.137305766f},
-std::array<float,2>{0.723219335f, 0.936992288f},
-std::array<float,2>{0.474605352f, 0.516110241f},
-std::array<float,2>{0.974526525f, 0.437887639f},
-std::array<float,2>{0.336294323f, 0.187869966f},
-std::array<float,2>{0.807529688f, 0.937708974f},
-std::array<float,2>{0.161929429f, 0.612504065f},
-std::array<float,2>{0.566239059f, 0.429392844f},
-std::array<float,2>{0.0659566894f, 0.25211826f},
-std::array<float,2>{0.658578157f, 0.738753021f},
-std::array<float,2>{0.435517848f, 0.851540148f},
-std::array<float,2>{0.927107692f, 0.0228730123f},
-std::array<float,2>{0.445487469f, 0.49407348f},
-std::array<float,2>{0.941971719f, 0.54791683f},
-std::array<float,2>{0.00565917883f, 0.902070701f},
-std::array<float,2>{0.716248572f, 0.178883359f},
-std::array<float,2>{0.193278745f, 0.105739713f},
-std::array<float,2>{0.538597643f, 0.790364206f},
-std::array<float,2>{0.271083057f, 0.671729863f},
-std::array<float,2>{0.85163492f, 0.334405452f},
-std::array<float,2>{0.483621776f, 0.238849863f},
-std::array<float,2>{0.98282522f, 0.972808599f},
-std::array<float,2>{0.0603543893f, 0.580807686f},
-std::array<float,2>{0.732148647f, 0.384606242f},
-std::array<float,2>{0.235461861f, 0.300466985f},
-std::array<float,2>{0.521076679f, 0.714184105f},
-std::array<float,2>{0.310075164f, 0.818199575f},
-std::array<float,2>{0.815618813f, 0.04898737f},
-std::array<float,2>{0.35112831f, 0.455034494f},
-std::array<float,2>{0.756047368f, 0.506147206f},
-std::array<float,2>{0.146576568f, 0.916294336f},
-std::array<float,2>{0.597771764f, 0.149443045f},
-std::array<float,2>{0.106261991f, 0.0901471078f},
-std::array<float,2>{0.646179259f, 0.768190742f},
-std::array<float,2>{0.381324381f, 0.64038074f},
-std::array<float,2>{0.881835043f, 0.354860187f},
-std::array<float,2>{0.274194419f, 0.00571019109f},
-std::array<float,2>{0.847839832f, 0.861381054f},
-std::array<float,2>{0.199574798f, 0.725579858f},
-std::array<float,2>{0.541625202f, 0.27085191f},
-std::array<float,2>{0.0151984282f, 0.41997534f},
-std::array<float,2>{0.710168958f, 0.602140367f},
-std::array<float,2>{0.439348936f, 0.963235319f},
-std::array<float,2>{0.945448279f, 0.21231468f},
-std::array<float,2>{0.424908787f, 0.32427901f},
-std::array<float,2>{0.934436142f, 0.677488267f},
-std::array<float,2>{0.0731391534f, 0.797120452f},
-std::array<float,2>{0.667441487f, 0.123155303f},
-std::array<float,2>{0.165355816f, 0.162113994f},
-std::array<float,2>{0.574305475f, 0.887519598f},
-std::array<float,2>{0.332022786f, 0.539368212f},
-std::array<float,2>{0.798738599f, 0.475884914f},
-std::array<float,2>{0.406123042f, 0.104889505f},
-std::array<float,2>{0.891946971f, 0.794265926f},
-std::array<float,2>{0.120817244f, 0.6652174f},
-std::array<float,2>{0.625007033f, 0.331321269f},
-std::array<float,2>{0.125531152f, 0.499143481f},
-std::array<float,2>{0.609972417f, 0.553073823f},
-std::array<float,2>{0.361252964f, 0.902981818f},
-std::array<float,2>{0.768987119f, 0.172709659f},
-std::array<float,2>{0.283405244f, 0.256308287f},
-std::array<float,2>{0.834591925f, 0.73563838f},
-std::array<float,2>{0.220483884f, 0.845585644f},
-std::array<float,2>{0.501847684f, 0.0192961302f},
-std::array<float,2>{0.0336221717f, 0.194356978f},
-std::array<float,2>{0.745555162f, 0.943293214f},
-std::array<float,2>{0.484968036f, 0.614192903f},
-std::array<float,2>{0.98953867f, 0.422562599f},
-std::array<float,2>{0.322013348f, 0.136109501f},
-std::array<float,2>{0.781269491f, 0.933341503f},
-std::array<float,2>{0.185137019f, 0.520846486f},
-std::array<float,2>{0.585688293f, 0.443166137f},
-std::array<float,2>{0.0851965994f, 0.374395192f},
-std::array<float,2>{0.687243342f, 0.641085565f},
-std::array<float,2>{0.419213623f, 0.753906012f},
-std::array<float,2>{0.917705953f, 0.0695283338f},
-std::array<float,2>{0.459138721f, 0.397153825f},
-std::array<float,2>{0.963659286f, 0.576233864f},
-std::array<float,2>{0.0264462736f, 0.9884004f},
-std::array<float,2>{0.70271033f, 0.219677985f},
-std::array<float,2>{0.205876008f, 0.0323817655f},
-std::array<float,2>{0.552897274f, 0.84299171f},
-std::array<float,2>{0.265563577f, 0.688387275f},
-std::array<float,2>{0.866206646f, 0.295121789f},
-std::array<float,2>{0.410753816f, 0.179747164f},
-std::array<float,2>{0.907510877f, 0.896709442f},
-std::array<float,2>{0.0911897495f, 0.559646785f},
-std::array<float,2>{0.675140619f, 0.487793356f},
-std::array<float,2>{0.173120931f, 0.33808741f},
-std::array<float,2>{0.587435842f, 0.660599053f},
-std::array<float,2>{0.316871643f, 0.786156297f},
-std::array<float,2>{0.790296078f, 0.0941962749f},
-std::array<float,2>{0.250202447f, 0.432673305f},
-std::array<float,2>{0.871132672f, 0.624588132f},
-std::array<float,2>{0.216726154f, 0.951578796f},
-std::array<float,2>{0.557847083f, 0.198940694f},
-std::array<float,2>{0.0220924094f, 0.0295709223f},
-std::array<float,2>{0.694873214f, 0.858561814f},
-std::array<float,2>{0.464628011f, 0.742915392f},
-std::array<float,2>{0.955560088f, 0.262549371f},
-std::array<float,2>{0.374724984f, 0.0760764554f},
-std::array<float,2>{0.778968632f, 0.764406383f},
-std::array<float,2>{0.140622184f, 0.653572381f},
-std::array<float,2>{0.619282722f, 0.359767705f},
-std::array<float,2>{0.114575505f, 0.446397722f},
-std::array<float,2>{0.636868238f, 0.52853173f},
-std::array<float,2>{0.397953987f, 0.926630437f},
-std::array<float,2>{0.904691041f, 0.131315649f},
-std::array<float,2>{0.493240446f, 0.286979884f},
-std::array<float,2>{0.996465206f, 0.697769105f},
-std::array<float,2>{0.0445158519f, 0.830521166f},
-std::array<float,2>{0.74012506f, 0.0412424617f},
-std::array<float,2>{0.229824752f, 0.233319312f},
-std::array<float,2>{0.515345573f, 0.992817163f},
-std::array<float,2>{0.290572613f, 0.564584017f},
-std::array<float,2>{0.840692461f, 0.402930588f},
-std::array<float,2>{0.452387482f, 0.0547980145f},
-std::array<float,2>{0.938873827f, 0.821549475f},
-std::array<float,2>{0.0028561193f, 0.710685253f},
-std::array<float,2>{0.711315989f, 0.308565229f},
-std::array<float,2>{0.190217271f, 0.378526479f},
-std::array<float,2>{0.53422904f, 0.59174484f},
-std::array<float,2>{0.268421978f, 0.978629887f},
-std::array<float,2>{0.858431876f, 0.249252528f},
-std::array<float,2>{0.340698957f, 0.349430799f},
-std::array<float,2>{0.812467098f, 0.628219068f},
-std::array<float,2>{0.156307459f, 0.778642297f},
-std::array<float,2>{0.56982249f, 0.0835482702f},
-std::array<float,2>{0.0696052983f, 0.145428896f},
-std::array<float,2>{0.661881089f, 0.911232889f},
-std::array<float,2>{0.430444568f, 0.51137948f},
-std::array<float,2>{0.922065914f, 0.463781327f},
-std::array<float,2>{0.301834852f, 0.206970707f},
-std::array<float,2>{0.827080071f, 0.959532142f},
-std::array<float,2>{0.243697718f, 0.595188677f},
-std::array<float,2>{0.525232792f, 0.41272831f},
-std::array<float,2>{0.0475409813f, 0.279664725f},
-std::array<float,2>{0.719344556f, 0.729113758f},
-std::array<float,2>{0.471473902f, 0.871858418f},
-std::array<float,2>{0.969844997f, 0.00903418101f},
-std::array<float,2>{0.388163209f, 0.478155404f},
-std::array<float,2>{0.883138597f, 0.537560046f},
-std::array<float,2>{0.0985724553f, 0.882560015f},
-std::array<float,2>{0.651871741f, 0.168792173f},
-std::array<float,2>{0.149648145f, 0.111589432f},
-std::array<float,2>{0.6090042f, 0.80653435f},
-std::array<float,2>{0.354143113f, 0.684256971f},
-std::array<float,2>{0.764992416f, 0.31602931f},
-std::array<float,2>{0.378227949f, 0.200659305f},
-std::array<float,2>{0.875626981f, 0.947000027f},
-std::array<float,2>{0.104530923f, 0.619104147f},
-std::array<float,2>{0.642234504f, 0.434650749f},
-std::array<float,2>{0.141968444f, 0.259358048f},
-std::array<float,2>{0.594134569f, 0.747982979f},
-std::array<float,2>{0.346785158f, 0.851790965f},
-std::array<float,2>{0.752441406f, 0.024474198f},
-std::array<float,2>{0.305133402f, 0.491300166f},
-std::array<float,2>{0.816623569f, 0.558524847f},
-std::array<float,2>{0.240525633f, 0.892484188f},
-std::array<float,2>{0.519483209f, 0.183835432f},
-std::array<float,2>{0.0560420565f, 0.0986410677f},
-std::array<float,2>{0.728043795f, 0.784803212f},
-std::array<float,2>{0.476588309f, 0.657432973f},
-std::array<float,2>{0.977077544f, 0.342805415f},
-std::array<float,2>{0.335838705f, 0.0430043079f},
-std::array<float,2>{0.802107632f, 0.834046781f},
-std::array<float,2>{0.171680599f, 0.699786246f},
-std::array<float,2>{0.571293533f, 0.283120424f},
-std::array<float,2>{0.0749835148f, 0.400452465f},
-std::array<float,2>{0.670192599f, 0.568008363f},
-std::array<float,2>{0.428886205f, 0.998424888f},
-std::array<float,2>{0.932044208f, 0.228591442f},
-std::array<float,2>{0.445295185f, 0.364727199f},
-std::array<float,2>{0.950919926f, 0.650509596f},
-std::array<float,2>{0.00874288287f, 0.758545995f},
-std::array<float,2>{0.705576122f, 0.072554335f},
-std::array<float,2>{0.196755528f, 0.12618126f},
-std::array<float,2>{0.544256985f, 0.92291373f},
-std::array<float,2>{0.280872762f, 0.526564837f},
-std::array<float,2>{0.844045281f, 0.450326562f},
-std::array<float,2>{0.49050054f, 0.0792091042f},
-std::array<float,2>{0.984920979f, 0.775274158f},
-std::array<float,2>{0.0388469659f, 0.631850839f},
-std::array<float,2>{0.748314321f, 0.346907437f},
-std::array<float,2>{0.226453632f, 0.468190551f},
-std::array<float,2>{0.504396439f, 0.514136434f},
-std::array<float,2>{0.287161231f, 0.90732187f},
-std::array<float,2>{0.828195691f, 0.141773313f},
-std::array<float,2>{0.365329415f, 0.311373383f},
-std::array<float,2>{0.772182345f, 0.705946326f},
-std::array<float,2>{0.13276957f, 0.826875091f},
-std::array<float,2>{0.615213692f, 0.061256431f},
-std::array<float,2>{0.1228173f, 0.244651899f},
-std::array<float,2>{0.631075501f, 0.982039154f},
-std::array<float,2>{0.401566148f, 0.586463034f},
-std::array<float,2>{0.89698416f, 0.381460279f},
-std::array<float,2>{0.258666098f, 0.166932955f},
-std::array<float,2>{0.861872852f, 0.875142813f},
-std::array<float,2>{0.208319724f, 0.535012782f},
-std::array<float,2>{0.549305379f, 0.482944459f},
-std::array<float,2>{0.0275047533f, 0.318305314f},
-std::array<float,2>{0.698067486f, 0.680837393f},
-std::array<float,2>{0.45684579f, 0.81138742f},
-std::array<float,2>{0.968611896f, 0.116729043f},
-std::array<float,2>{0.417135209f, 0.410066038f},
-std::array<float,2>{0.921629965f, 0.599483252f},
-std::array<float,2>{0.0783408806f, 0.953964114f},
-std::array<float,2>{0.681475282f, 0.207343027f},
-std::array<float,2>{0.183359191f, 0.0137506519f},
-std::array<float,2>{0.578496635f, 0.869141519f},
-std::array<float,2>{0.324415743f, 0.731511831f},
-std::array<float,2>{0.787845135f, 0.276259243f},
-std::array<float,2>{0.467832029f, 0.153675064f},
-std::array<float,2>{0.959565222f, 0.919747174f},
-std::array<float,2>{0.0175499599f, 0.503738403f},
-std::array<float,2>{0.689016342f, 0.459411949f},
-std::array<float,2>{0.212784737f, 0.356785595f},
-std::array<float,2>{0.561981082f, 0.635953248f},
-std::array<float,2>{0.25459078f, 0.770975649f},
-std::array<float,2>{0.868889689f, 0.0869400725f},
-std::array<float,2>{0.314684838f, 0.389577985f},
-std::array<float,2>{0.795368969f, 0.58282274f},
-std::array<float,2>{0.175995648f, 0.97037822f},
-std::array<float,2>{0.592612386f, 0.236805141f},
-std::array<float,2>{0.0874327049f, 0.0526956283f},
-std::array<float,2>{0.677868128f, 0.813613117f},
-std::array<float,2>{0.407013327f, 0.716160774f},
-std::array<float,2>{0.912964284f, 0.301990837f},
-std::array<float,2>{0.294532418f, 0.120398834f},
-std::array<float,2>{0.839364231f, 0.801127315f},
-std::array<float,2>{0.231573641f, 0.674403667f},
-std::array<float,2>{0.507992506f, 0.322858334f},
-std::array<float,2>{0.0395840667f, 0.469968647f},
-std::array<float,2>{0.735430777f, 0.54637289f},
-std::array<float,2>{0.498317689f, 0.886425495f},
-std::array<float,2>{0.994044006f, 0.15947856f},
-std::array<float,2>{0.392485738f, 0.266806722f},
-std::array<float,2>{0.900743544f, 0.719856262f},
-std::array<float,2>{0.111926779f, 0.863925695f},
-std::array<float,2>{0.633676171f, 0.00179175951f},
-std::array<float,2>{0.136342198f, 0.216050893f},
-std::array<float,2>{0.62302357f, 0.9650051f},
-std::array<float,2>{0.368522406f, 0.609332561f},
-std::array<float,2>{0.7744596f, 0.417857885f},
-std::array<float,2>{0.436398f, 0.0209072828f},
-std::array<float,2>{0.928149462f, 0.849526346f},
-std::array<float,2>{0.0629153028f, 0.741206825f},
-std::array<float,2>{0.657544851f, 0.251745045f},
-std::array<float,2>{0.163221702f, 0.426617086f},
-std::array<float,2>{0.564330339f, 0.609663248f},
-std::array<float,2>{0.339756399f, 0.939799368f},
-std::array<float,2>{0.805603564f, 0.189530045f},
-std::array<float,2>{0.273212045f, 0.33369559f},
-std::array<float,2>{0.854797006f, 0.668364763f},
-std::array<float,2>{0.195121676f, 0.792058945f},
-std::array<float,2>{0.536904693f, 0.107945658f},
-std::array<float,2>{0.00671309f, 0.176431909f},
-std::array<float,2>{0.718371987f, 0.899489641f},
-std::array<float,2>{0.447799414f, 0.550515711f},
-std::array<float,2>{0.943825841f, 0.494172484f},
-std::array<float,2>{0.356163591f, 0.222985223f},
-std::array<float,2>{0.759454489f, 0.98639071f},
-std::array<float,2>{0.152522668f, 0.572704256f},
-std::array<float,2>{0.602684677f, 0.393759429f},
-std::array<float,2>{0.0952473283f, 0.290534824f},
-std::array<float,2>{0.653199136f, 0.694494545f},
-std::array<float,2>{0.386497915f, 0.839536428f},
-std::array<float,2>{0.889927149f, 0.0374237746f},
-std::array<float,2>{0.475180835f, 0.440343142f},
-std::array<float,2>{0.975909114f, 0.51950556f},
-std::array<float,2>{0.0508537628f, 0.935006022f},
-std::array<float,2>{0.725107074f, 0.14008753f},
-std::array<float,2>{0.246154696f, 0.064949356f},
-std::array<float,2>{0.529555976f, 0.755460858f},
-std::array<float,2>{0.297822475f, 0.645542026f},
-std::array<float,2>{0.82339859f, 0.367474228f},
-std::array<float,2>{0.457580477f, 0.220498785f},
-std::array<float,2>{0.961386442f, 0.989985406f},
-std::array<float,2>{0.0249703545f, 0.577414155f},
-std::array<float,2>{0.699973583f, 0.398424804f},
-std::array<float,2>{0.203843787f, 0.296413928f},
-std::array<float,2>{0.551405132f, 0.689333618f},
-std::array<float,2>{0.262761772f, 0.842605233f},
-std::array<float,2>{0.863569558f, 0.0315731466f},
-std::array<float,2>{0.322659999f, 0.441740543f},
-std::array<float,2>{0.78341186f, 0.520024717f},
-std::array<float,2>{0.187224343f, 0.932011545f},
-std::array<float,2>{0.582781494f, 0.135297179f},
-std::array<float,2>{0.0827118903f, 0.0690180734f},
-std::array<float,2>{0.683856189f, 0.752105594f},
-std::array<float,2>{0.421083122f, 0.642264009f},
-std::array<float,2>{0.915282667f, 0.3730492f},
-std::array<float,2>{0.281933367f, 0.0178753082f},
-std::array<float,2>{0.833860457f, 0.844522536f},
-std::array<float,2>{0.221790999f, 0.734888852f},
-std::array<float,2>{0.502839208f, 0.257529676f},
-std::array<float,2>{0.0327498838f, 0.423547268f},
-std::array<float,2>{0.743649244f, 0.614632308f},
-std::array<float,2>{0.487139255f, 0.941727996f},
-std::array<float,2>{0.990611374f, 0.194143638f},
-std::array<float,2>{0.40383926f, 0.330945879f},
-std::array<float,2>{0.893461823f, 0.664642572f},
-std::array<float,2>{0.118837886f, 0.793035209f},
-std::array<float,2>{0.628243327f, 0.103966862f},
-std::array<float,2>{0.128263623f, 0.173323289f},
-std::array<float,2>{0.611499667f, 0.903859019f},
-std::array<float,2>{0.362505436f, 0.554226696f},
-std::array<float,2>{0.766994178f, 0.498967052f},
-std::array<float,2>{0.422285914f, 0.124696225f},
-std::array<float,2>{0.93598634f, 0.798152924f},
-std::array<float,2>{0.0716601983f, 0.676308572f},
-std::array<float,2>{0.66430968f, 0.325386643f},
-std::array<float,2>{0.167296618f, 0.474737346f},
-std::array<float,2>{0.576522052f, 0.540460229f},
-std::array<float,2>{0.328866482f, 0.888002813f},
-std::array<float,2>{0.799893916f, 0.164030731f},
-std::array<float,2>{0.277215779f, 0.270445228f},
-std::array<float,2>{0.850834429f, 0.725784957f},
-std::array<float,2>{0.202180937f, 0.862700105f},
-std::array<float,2>{0.539248049f, 0.00462590298f},
-std::array<float,2>{0.0127598802f, 0.211504459f},
-std::array<float,2>{0.708090365f, 0.964799821f},
-std::array<float,2>{0.440982491f, 0.603242815f},
-std::array<float,2>{0.948047638f, 0.421860754f},
-std::array<float,2>{0.348320574f, 0.148944393f},
-std::array<float,2>{0.755438983f, 0.917483926f},
-std::array<float,2>{0.145228505f, 0.507444799f},
-std::array<float,2>{0.601256251f, 0.453688174f},
-std::array<float,2>{0.108839974f, 0.354489416f},
-std::array<float,2>{0.647797763f, 0.639399648f},
-std::array<float,2>{0.380670041f, 0.768892288f},
-std::array<float,2>{0.879415035f, 0.0911401585f},
-std::array<float,2>{0.481551588f, 0.383682787f},
-std::array<float,2>{0.982387006f, 0.581088543f},
-std::array<float,2>{0.0624196269f, 0.974013925f},
-std::array<float,2>{0.733984411f, 0.240211457f},
-std::array<float,2>{0.237229139f, 0.0504149012f},
-std::array<float,2>{0.522274196f, 0.816501737f},
-std::array<float,2>{0.312216312f, 0.71385628f},
-std::array<float,2>{0.812929809f, 0.299013048f},
-std::array<float,2>{0.389992565f, 0.169668958f},
-std::array<float,2>{0.886594474f, 0.881175697f},
-std::array<float,2>{0.100723997f, 0.538222849f},
-std::array<float,2>{0.649124324f, 0.476623416f},
-std::array<float,2>{0.152214378f, 0.315113485f},
-std::array<float,2>{0.607346117f, 0.684907317f},
-std::array<float,2>{0.353113651f, 0.805169344f},
-std::array<float,2>{0.762204409f, 0.112869166f},
-std::array<float,2>{0.304149419f, 0.413820237f},
-std::array<float,2>{0.824409664f, 0.594079137f},
-std::array<float,2>{0.24605073f, 0.960282385f},
-std::array<float,2>{0.526187122f, 0.205158606f},
-std::array<float,2>{0.0490925312f, 0.00832089223f},
-std::array<float,2>{0.720912516f, 0.872893512f},
-std::array<float,2>{0.470268607f, 0.730466902f},
-std::array<float,2>{0.971781135f, 0.280776232f},
-std::array<float,2>{0.342723429f, 0.0828428939f},
-std::array<float,2>{0.809587836f, 0.777546465f},
-std::array<float,2>{0.159998119f, 0.627146542f},
-std::array<float,2>{0.567366719f, 0.347677052f},
-std::array<float,2>{0.0680165812f, 0.464157254f},
-std::array<float,2>{0.662726343f, 0.510121405f},
-std::array<float,2>{0.433037281f, 0.910889924f},
-std::array<float,2>{0.925429761f, 0.145905524f},
-std::array<float,2>{0.451157987f, 0.30700931f},
-std::array<float,2>{0.940737605f, 0.709452152f},
-std::array<float,2>{0.000367777888f, 0.820968628f},
-std::array<float,2>{0.714406431f, 0.0565434769f},
-std::array<float,2>{0.189323783f, 0.248275846f},
-std::array<float,2>{0.531480253f, 0.979622602f},
-std::array<float,2>{0.266872853f, 0.590646923f},
-std::array<float,2>{0.856607974f, 0.377074897f},
-std::array<float,2>{0.495714158f, 0.0429414399f},
-std::array<float,2>{0.999101162f, 0.831542432f},
-std::array<float,2>{0.044976227f, 0.698321402f},
-std::array<float,2>{0.741018832f, 0.285437733f},
-std::array<float,2>{0.228350028f, 0.403688848f},
-std::array<float,2>{0.51248318f, 0.566046834f},
-std::array<float,2>{0.2926808f, 0.994132757f},
-std::array<float,2>{0.842230558f, 0.234141111f},
-std::array<float,2>{0.371472806f, 0.360459834f},
-std::array<float,2>{0.779385328f, 0.653303087f},
-std::array<float,2>{0.138547167f, 0.765403032f},
-std::array<float,2>{0.618020594f, 0.0746286288f},
-std::array<float,2>{0.11715515f, 0.13248612f},
-std::array<float,2>{0.63912195f, 0.927355945f},
-std::array<float,2>{0.39520371f, 0.527626932f},
-std::array<float,2>{0.902352393f, 0.445873618f},
-std::array<float,2>{0.253756166f, 0.197310597f},
-std::array<float,2>{0.874987781f, 0.952988923f},
-std::array<float,2>{0.218279764f, 0.623908281f},
-std::array<float,2>{0.554876029f, 0.431663543f},
-std::array<float,2>{0.020577535f, 0.263256937f},
-std::array<float,2>{0.69280833f, 0.743507743f},
-std::array<float,2>{0.461720109f, 0.857868135f},
-std::array<float,2>{0.953334987f, 0.030784132f},
-std::array<float,2>{0.412367702f, 0.487026393f},
-std::array<float,2>{0.909315765f, 0.559153199f},
-std::array<float,2>{0.0935894325f, 0.898388803f},
-std::array<float,2>{0.673622668f, 0.180855006f},
-std::array<float,2>{0.175311372f, 0.094873555f},
-std::array<float,2>{0.588258743f, 0.785598576f},
-std::array<float,2>{0.319737822f, 0.661226213f},
-std::array<float,2>{0.791203797f, 0.339123964f},
-std::array<float,2>{0.414518535f, 0.208806813f},
-std::array<float,2>{0.918668151f, 0.955043852f},
-std::array<float,2>{0.0809830651f, 0.598266125f},
-std::array<float,2>{0.683154821f, 0.408783555f},
-std::array<float,2>{0.180736154f, 0.276375502f},
-std::array<float,2>{0.581935525f, 0.731060684f},
-std::array<float,2>{0.327663749f, 0.87063849f},
-std::array<float,2>{0.786008477f, 0.0147100762f},
-std::array<float,2>{0.260022879f, 0.484123349f},
-std::array<float,2>{0.86085391f, 0.533509672f},
-std::array<float,2>{0.209645197f, 0.876096487f},
-std::array<float,2>{0.547492146f, 0.167236984f},
-std::array<float,2>{0.0297110174f, 0.115775801f},
-std::array<float,2>{0.695683599f, 0.812062979f},
-std::array<float,2>{0.453621864f, 0.67977488f},
-std::array<float,2>{0.965915084f, 0.317149013f},
-std::array<float,2>{0.364185542f, 0.0615959689f},
-std::array<float,2>{0.769602537f, 0.827327788f},
-std::array<float,2>{0.130846217f, 0.70612371f},
-std::array<float,2>{0.616596401f, 0.31188947f},
-std::array<float,2>{0.123809099f, 0.382371962f},
-std::array<float,2>{0.630368471f, 0.587321639f},
-std::array<float,2>{0.399774998f, 0.980555415f},
-std::array<float,2>{0.896351397f, 0.24592267f},
-std::array<float,2>{0.48927027f, 0.346465409f},
-std::array<float,2>{0.986372113f, 0.631021202f},
-std::array<float,2>{0.0355909839f, 0.774051726f},
-std::array<float,2>{0.746437967f, 0.0783476532f},
-std::array<float,2>{0.22391893f, 0.14129819f},
-std::array<float,2>{0.507120192f, 0.906374514f},
-std::array<float,2>{0.287050664f, 0.515327215f},
-std::array<float,2>{0.830101967f, 0.467414975f},
-std::array<float,2>{0.442861199f, 0.0737716034f},
-std::array<float,2>{0.952527881f, 0.759389877f},
-std::array<float,2>{0.011632679f, 0.651648223f},
-std::array<float,2>{0.703219116f, 0.363455206f},
-std::array<float,2>{0.199033678f, 0.449941874f},
-std::array<float,2>{0.546842813f, 0.525787652f},
-std::array<float,2>{0.278733045f, 0.9226408f},
-std::array<float,2>{0.846530735f, 0.125001833f},
-std::array<float,2>{0.332089245f, 0.281271517f},
-std::array<float,2>{0.803230703f, 0.700703084f},
-std::array<float,2>{0.168143094f, 0.835456789f},
-std::array<float,2>{0.573519528f, 0.0447380319f},
-std::array<float,2>{0.0774803683f, 0.229683727f},
-std::array<float,2>{0.669189155f, 0.999137163f},
-std::array<float,2>{0.427690446f, 0.56692332f},
-std::array<float,2>{0.930914402f, 0.401538938f},
-std::array<float,2>{0.3077676f, 0.184662789f},
-std::array<float,2>{0.81927681f, 0.891441703f},
-std::array<float,2>{0.239847705f, 0.557490408f},
-std::array<float,2>{0.517102003f, 0.490909874f},
-std::array<float,2>{0.0575801767f, 0.342359871f},
-std::array<float,2>{0.729120255f, 0.656335235f},
-std::array<float,2>{0.479835659f, 0.783841968f},
-std::array<float,2>{0.979987681f, 0.098458223f},
-std::array<float,2>{0.375994891f, 0.434553474f},
-std::array<float,2>{0.878173172f, 0.61778307f},
-std::array<float,2>{0.101614125f, 0.94578582f},
-std::array<float,2>{0.643736124f, 0.200015351f},
-std::array<float,2>{0.144155875f, 0.0238885898f},
-std::array<float,2>{0.59644413f, 0.852558076f},
-std::array<float,2>{0.343948871f, 0.746155143f},
-std::array<float,2>{0.751546383f, 0.258521497f},
-std::array<float,2>{0.473065436f, 0.139032841f},
-std::array<float,2>{0.972664952f, 0.933992803f},
-std::array<float,2>{0.0532624386f, 0.518280089f},
-std::array<float,2>{0.724301696f, 0.440431684f},
-std::array<float,2>{0.248844907f, 0.368332177f},
-std::array<float,2>{0.528461754f, 0.645169973f},
-std::array<float,2>{0.299385577f, 0.753923953f},
-std::array<float,2>{0.820546746f, 0.0663643256f},
-std::array<float,2>{0.359291881f, 0.392920136f},
-std::array<float,2>{0.760291874f, 0.573620021f},
-std::array<float,2>{0.154503137f, 0.987342298f},
-std::array<float,2>{0.604787052f, 0.224246398f},
-std::array<float,2>{0.096780248f, 0.0389763303f},
-std::array<float,2>{0.654771626f, 0.838253498f},
-std::array<float,2>{0.383926898f, 0.693618298f},
-std::array<float,2>{0.888272405f, 0.289555103f},
-std::array<float,2>{0.270247966f, 0.108916424f},
-std::array<float,2>{0.852844715f, 0.791711688f},
-std::array<float,2>{0.191552728f, 0.669774234f},
-std::array<float,2>{0.537576139f, 0.332889915f},
-std::array<float,2>{0.0048650559f, 0.495766193f},
-std::array<float,2>{0.715002f, 0.549186945f},
-std::array<float,2>{0.447071403f, 0.898732424f},
-std::array<float,2>{0.942712307f, 0.176811025f},
-std::array<float,2>{0.433603168f, 0.250097126f},
-std::array<float,2>{0.926222801f, 0.742092788f},
-std::array<float,2>{0.0651598275f, 0.848161936f},
-std::array<float,2>{0.659425497f, 0.0197794382f},
-std::array<float,2>{0.160404131f, 0.190797031f},
-std::array<float,2>{0.564853847f, 0.941119492f},
-std::array<float,2>{0.337103844f, 0.610834181f},
-std::array<float,2>{0.808521986f, 0.427647918f},
-std::array<float,2>{0.393698752f, 4.45288133e-05f},
-std::array<float,2>{0.898924232f, 0.864680052f},
-std::array<float,2>{0.110993519f, 0.718931437f},
-std::array<float,2>{0.636334181f, 0.266176105f},
-std::array<float,2>{0.133051351f, 0.416317582f},
-std::array<float,2>{0.623856008f, 0.608354211f},
-std::array<float,2>{0.370183557f, 0.965874434f},
-std::array<float,2>{0.776633024f, 0.214996383f},
-std::array<float,2>{0.295240641f, 0.323928624f},
-std::array<float,2>{0.837601244f, 0.675469995f},
-std::array<float,2>{0.234235197f, 0.801931322f},
-std::array<float,2>{0.509983182f, 0.119646028f},
-std::array<float,2>{0.0417464226f, 0.158440396f},
-std::array<float,2>{0.73670429f, 0.884803355f},
-std::array<float,2>{0.497871667f, 0.54581213f},
-std::array<float,2>{0.995580733f, 0.469157547f},
-std::array<float,2>{0.313836247f, 0.238243625f},
-std::array<float,2>{0.794676125f, 0.968804061f},
-std::array<float,2>{0.179425091f, 0.583561718f},
-std::array<float,2>{0.59033066f, 0.389842033f},
-std::array<float,2>{0.0885346308f, 0.30144462f},
-std::array<float,2>{0.676955342f, 0.715137064f},
-std::array<float,2>{0.40913409f, 0.812520146f},
-std::array<float,2>{0.910872757f, 0.0508177616f},
-std::array<float,2>{0.465420544f, 0.45996353f},
-std::array<float,2>{0.957954705f, 0.501984954f},
-std::array<float,2>{0.0180055369f, 0.91845125f},
-std::array<float,2>{0.690161586f, 0.153145432f},
-std::array<float,2>{0.213979617f, 0.0860957727f},
-std::array<float,2>{0.55915302f, 0.769761264f},
-std::array<float,2>{0.25711599f, 0.635450482f},
-std::array<float,2>{0.870986998f, 0.355549514f},
-std::array<float,2>{0.485474378f, 0.192410633f},
-std::array<float,2>{0.988347888f, 0.944163144f},
-std::array<float,2>{0.035041593f, 0.615902483f},
-std::array<float,2>{0.744705796f, 0.424277782f},
-std::array<float,2>{0.219707146f, 0.255429029f},
-std::array<float,2>{0.500366688f, 0.737471104f},
-std::array<float,2>{0.284891754f, 0.846738219f},
-std::array<float,2>{0.835164547f, 0.0166498143f},
-std::array<float,2>{0.360236973f, 0.49793458f},
-std::array<float,2>{0.768284976f, 0.551284492f},
-std::array<float,2>{0.126845852f, 0.904862821f},
-std::array<float,2>{0.610603154f, 0.173949257f},
-std::array<float,2>{0.119740114f, 0.101979092f},
-std::array<float,2>{0.626324892f, 0.795713961f},
-std::array<float,2>{0.405058444f, 0.666711152f},
-std::array<float,2>{0.891508937f, 0.329549789f},
-std::array<float,2>{0.26416862f, 0.0337366685f},
-std::array<float,2>{0.866571724f, 0.839914858f},
-std::array<float,2>{0.20634231f, 0.691091418f},
-std::array<float,2>{0.554399133f, 0.293776333f},
-std::array<float,2>{0.0256794002f, 0.395570129f},
-std::array<float,2>{0.702112257f, 0.574505389f},
-std::array<float,2>{0.460765719f, 0.990479946f},
-std::array<float,2>{0.964411318f, 0.221810564f},
-std::array<float,2>{0.418401808f, 0.372459352f},
-std::array<float,2>{0.916443765f, 0.643036783f},
-std::array<float,2>{0.0841190442f, 0.750655234f},
-std::array<float,2>{0.686254919f, 0.0669371933f},
-std::array<float,2>{0.183894485f, 0.133507058f},
-std::array<float,2>{0.58421272f, 0.930661023f},
-std::array<float,2>{0.320972621f, 0.521564901f},
-std::array<float,2>{0.782253087f, 0.444755286f},
-std::array<float,2>{0.382449389f, 0.0926756337f},
-std::array<float,2>{0.882800996f, 0.766663074f},
-std::array<float,2>{0.106807731f, 0.636749506f},
-std::array<float,2>{0.645365715f, 0.353126168f},
-std::array<float,2>{0.148103788f, 0.455744594f},
-std::array<float,2>{0.599278331f, 0.504579306f},
-std::array<float,2>{0.350508124f, 0.915533245f},
-std::array<float,2>{0.757618845f, 0.151765198f},
-std::array<float,2>{0.309102714f, 0.298288941f},
-std::array<float,2>{0.814460218f, 0.711842954f},
-std::array<float,2>{0.235076949f, 0.818597913f},
-std::array<float,2>{0.519772589f, 0.0485623926f},
-std::array<float,2>{0.0593156777f, 0.240935966f},
-std::array<float,2>{0.730605125f, 0.97643131f},
-std::array<float,2>{0.482657105f, 0.578488529f},
-std::array<float,2>{0.984196305f, 0.385900259f},
-std::array<float,2>{0.330962628f, 0.161042526f},
-std::array<float,2>{0.79697746f, 0.889164269f},
-std::array<float,2>{0.164878428f, 0.541228712f},
-std::array<float,2>{0.575273514f, 0.474439889f},
-std::array<float,2>{0.0733598694f, 0.326251328f},
-std::array<float,2>{0.666623771f, 0.679491758f},
-std::array<float,2>{0.424443603f, 0.79975909f},
-std::array<float,2>{0.935545921f, 0.122822613f},
-std::array<float,2>{0.437589586f, 0.418397725f},
-std::array<float,2>{0.947001219f, 0.603978515f},
-std::array<float,2>{0.0137362182f, 0.961664438f},
-std::array<float,2>{0.70977205f, 0.213720337f},
-std::array<float,2>{0.200201422f, 0.00718484307f},
-std::array<float,2>{0.542390585f, 0.860927343f},
-std::array<float,2>{0.274450839f, 0.724348843f},
-std::array<float,2>{0.848694861f, 0.272529304f},
-std::array<float,2>{0.431007355f, 0.148046851f},
-std::array<float,2>{0.92370069f, 0.913340569f},
-std::array<float,2>{0.0691591725f, 0.509521365f},
-std::array<float,2>{0.660850763f, 0.46265769f},
-std::array<float,2>{0.157977551f, 0.350767702f},
-std::array<float,2>{0.569100559f, 0.626412988f},
-std::array<float,2>{0.341059566f, 0.780587733f},
-std::array<float,2>{0.810864806f, 0.0843051001f},
-std::array<float,2>{0.268978238f, 0.376566678f},
-std::array<float,2>{0.857548654f, 0.592281818f},
-std::array<float,2>{0.190944478f, 0.978509963f},
-std::array<float,2>{0.533523738f, 0.246544972f},
-std::array<float,2>{0.00368587417f, 0.0580267161f},
-std::array<float,2>{0.712008297f, 0.823052704f},
-std::array<float,2>{0.45162636f, 0.708354175f},
-std::array<float,2>{0.938425899f, 0.305882901f},
-std::array<float,2>{0.354498923f, 0.109989718f},
-std::array<float,2>{0.763773441f, 0.80731827f},
-std::array<float,2>{0.148986936f, 0.687223494f},
-std::array<float,2>{0.607914627f, 0.313034505f},
-std::array<float,2>{0.0994890779f, 0.479521245f},
-std::array<float,2>{0.651245773f, 0.53639394f},
-std::array<float,2>{0.386995554f, 0.878960729f},
-std::array<float,2>{0.884432733f, 0.171333447f},
-std::array<float,2>{0.47262466f, 0.278899848f},
-std::array<float,2>{0.969725966f, 0.728319645f},
-std::array<float,2>{0.0479087606f, 0.873524487f},
-std::array<float,2>{0.720050275f, 0.0113344714f},
-std::array<float,2>{0.242314711f, 0.203206107f},
-std::array<float,2>{0.523831964f, 0.958219945f},
-std::array<float,2>{0.30127129f, 0.596275985f},
-std::array<float,2>{0.827277601f, 0.411511689f},
-std::array<float,2>{0.463138402f, 0.029005019f},
-std::array<float,2>{0.956760049f, 0.856409073f},
-std::array<float,2>{0.0226732045f, 0.744676054f},
-std::array<float,2>{0.694059491f, 0.264661759f},
-std::array<float,2>{0.215302065f, 0.429916501f},
-std::array<float,2>{0.557450593f, 0.621219397f},
-std::array<float,2>{0.250981301f, 0.950995624f},
-std::array<float,2>{0.872300923f, 0.195537016f},
-std::array<float,2>{0.31788367f, 0.337750763f},
-std::array<float,2>{0.789519012f, 0.662443936f},
-std::array<float,2>{0.172311082f, 0.7883147f},
-std::array<float,2>{0.586055279f, 0.0965120718f},
-std::array<float,2>{0.0900638923f, 0.182599157f},
-std::array<float,2>{0.674514771f, 0.895903945f},
-std::array<float,2>{0.411641449f, 0.561777711f},
-std::array<float,2>{0.90634799f, 0.484714955f},
-std::array<float,2>{0.289170802f, 0.232388705f},
-std::array<float,2>{0.841524243f, 0.994590402f},
-std::array<float,2>{0.229470193f, 0.563930392f},
-std::array<float,2>{0.514422357f, 0.405580848f},
-std::array<float,2>{0.0435150079f, 0.288403213f},
-std::array<float,2>{0.738852739f, 0.696103513f},
-std::array<float,2>{0.492913157f, 0.829141498f},
-std::array<float,2>{0.997486472f, 0.0409043692f},
-std::array<float,2>{0.396878421f, 0.447622895f},
-std::array<float,2>{0.906083167f, 0.529429555f},
-std::array<float,2>{0.113802455f, 0.928437889f},
-std::array<float,2>{0.638194025f, 0.130290836f},
-std::array<float,2>{0.13933219f, 0.0767746493f},
-std::array<float,2>{0.620197892f, 0.762921691f},
-std::array<float,2>{0.373926014f, 0.654638171f},
-std::array<float,2>{0.777852476f, 0.362579495f},
-std::array<float,2>{0.401026458f, 0.243693992f},
-std::array<float,2>{0.897586048f, 0.983238935f},
-std::array<float,2>{0.121544883f, 0.589787185f},
-std::array<float,2>{0.632354438f, 0.380465358f},
-std::array<float,2>{0.131611139f, 0.309170634f},
-std::array<float,2>{0.613609195f, 0.704597473f},
-std::array<float,2>{0.367121339f, 0.825670362f},
-std::array<float,2>{0.773128748f, 0.0589370206f},
-std::array<float,2>{0.288197011f, 0.46677202f},
-std::array<float,2>{0.829713821f, 0.513527513f},
-std::array<float,2>{0.225093484f, 0.909919024f},
-std::array<float,2>{0.505080044f, 0.143886238f},
-std::array<float,2>{0.0377684198f, 0.0814514682f},
-std::array<float,2>{0.749204099f, 0.775606334f},
-std::array<float,2>{0.491269588f, 0.630467534f},
-std::array<float,2>{0.985449016f, 0.345253944f},
-std::array<float,2>{0.32553646f, 0.0132355802f},
-std::array<float,2>{0.788724661f, 0.869039953f},
-std::array<float,2>{0.18255432f, 0.734115124f},
-std::array<float,2>{0.580060422f, 0.274430692f},
-std::array<float,2>{0.0798381567f, 0.407091826f},
-std::array<float,2>{0.680385768f, 0.600614071f},
-std::array<float,2>{0.416783541f, 0.956975162f},
-std::array<float,2>{0.920337081f, 0.210807323f},
-std::array<float,2>{0.455904663f, 0.319010884f},
-std::array<float,2>{0.967486918f, 0.682998598f},
-std::array<float,2>{0.0283563789f, 0.809756756f},
-std::array<float,2>{0.69907701f, 0.113875166f},
-std::array<float,2>{0.207882166f, 0.165347055f},
-std::array<float,2>{0.550383031f, 0.878647745f},
-std::array<float,2>{0.259357512f, 0.533105373f},
-std::array<float,2>{0.863130867f, 0.480695754f},
-std::array<float,2>{0.478372574f, 0.100473098f},
-std::array<float,2>{0.97758162f, 0.782465756f},
-std::array<float,2>{0.0554256476f, 0.658472717f},
-std::array<float,2>{0.727459431f, 0.340925813f},
-std::array<float,2>{0.241318643f, 0.488451362f},
-std::array<float,2>{0.517690539f, 0.555227518f},
-std::array<float,2>{0.305669427f, 0.894104004f},
-std::array<float,2>{0.817523897f, 0.187333733f},
-std::array<float,2>{0.345725089f, 0.260676503f},
-std::array<float,2>{0.753544271f, 0.749531806f},
-std::array<float,2>{0.141008466f, 0.854781628f},
-std::array<float,2>{0.594868004f, 0.02561187f},
-std::array<float,2>{0.103863128f, 0.20176518f},
-std::array<float,2>{0.640681863f, 0.94827491f},
-std::array<float,2>{0.377023637f, 0.62093097f},
-std::array<float,2>{0.87684536f, 0.436283648f},
-std::array<float,2>{0.279813409f, 0.127688885f},
-std::array<float,2>{0.84569782f, 0.925595641f},
-std::array<float,2>{0.195363849f, 0.524106503f},
-std::array<float,2>{0.542975605f, 0.452187926f},
-std::array<float,2>{0.00921593048f, 0.366877854f},
-std::array<float,2>{0.706396878f, 0.649526536f},
-std::array<float,2>{0.443767041f, 0.76167357f},
-std::array<float,2>{0.949330807f, 0.0711657703f},
-std::array<float,2>{0.428387076f, 0.400028348f},
-std::array<float,2>{0.933053672f, 0.569065332f},
-std::array<float,2>{0.0758910552f, 0.997944474f},
-std::array<float,2>{0.671446085f, 0.227282956f},
-std::array<float,2>{0.170578957f, 0.0452845059f},
-std::array<float,2>{0.570598066f, 0.832767606f},
-std::array<float,2>{0.334247649f, 0.701527178f},
-std::array<float,2>{0.80144769f, 0.284935027f},
-std::array<float,2>{0.449121654f, 0.178424686f},
-std::array<float,2>{0.944837749f, 0.901282191f},
-std::array<float,2>{0.00687000109f, 0.547515631f},
-std::array<float,2>{0.716961145f, 0.492734849f},
-std::array<float,2>{0.193805963f, 0.335900486f},
-std::array<float,2>{0.535915852f, 0.670280099f},
-std::array<float,2>{0.272419512f, 0.789356828f},
-std::array<float,2>{0.854176819f, 0.107037187f},
-std::array<float,2>{0.338377357f, 0.428362161f},
-std::array<float,2>{0.806450129f, 0.611468256f},
-std::array<float,2>{0.162981555f, 0.938910484f},
-std::array<float,2>{0.562775433f, 0.189068362f},
-std::array<float,2>{0.0635041147f, 0.0222357642f},
-std::array<float,2>{0.656964242f, 0.850028455f},
-std::array<float,2>{0.437178224f, 0.740169585f},
-std::array<float,2>{0.928737283f, 0.253050685f},
-std::array<float,2>{0.297881037f, 0.0633172467f},
-std::array<float,2>{0.822690368f, 0.757243097f},
-std::array<float,2>{0.247445479f, 0.647033453f},
-std::array<float,2>{0.531229019f, 0.370893031f},
-std::array<float,2>{0.0521962941f, 0.438739121f},
-std::array<float,2>{0.725914717f, 0.516932845f},
-std::array<float,2>{0.475836694f, 0.935923934f},
-std::array<float,2>{0.975440264f, 0.138014704f},
-std::array<float,2>{0.385288239f, 0.292321622f},
-std::array<float,2>{0.888850391f, 0.691926301f},
-std::array<float,2>{0.0942560509f, 0.836173117f},
-std::array<float,2>{0.65424931f, 0.035834685f},
-std::array<float,2>{0.154167518f, 0.225054249f},
-std::array<float,2>{0.602366924f, 0.984994769f},
-std::array<float,2>{0.357076645f, 0.572091162f},
-std::array<float,2>{0.758332253f, 0.3921839f},
-std::array<float,2>{0.407755226f, 0.0527886115f},
-std::array<float,2>{0.913496196f, 0.815532625f},
-std::array<float,2>{0.0862634853f, 0.718536615f},
-std::array<float,2>{0.678976417f, 0.303422868f},
-std::array<float,2>{0.177111357f, 0.388076544f},
-std::array<float,2>{0.593303621f, 0.585006356f},
-std::array<float,2>{0.315807104f, 0.972637832f},
-std::array<float,2>{0.796028554f, 0.234985247f},
-std::array<float,2>{0.255438656f, 0.357809901f},
-std::array<float,2>{0.867782772f, 0.634232402f},
-std::array<float,2>{0.211511403f, 0.772838652f},
-std::array<float,2>{0.560858488f, 0.087932393f},
-std::array<float,2>{0.01593717f, 0.154452533f},
-std::array<float,2>{0.688385665f, 0.921159089f},
-std::array<float,2>{0.467515349f, 0.500301123f},
-std::array<float,2>{0.96048528f, 0.457316279f},
-std::array<float,2>{0.368069172f, 0.216995791f},
-std::array<float,2>{0.774246693f, 0.968105018f},
-std::array<float,2>{0.135642022f, 0.607374609f},
-std::array<float,2>{0.621344626f, 0.415496647f},
-std::array<float,2>{0.113052391f, 0.267655045f},
-std::array<float,2>{0.633937478f, 0.721305728f},
-std::array<float,2>{0.390907168f, 0.865568817f},
-std::array<float,2>{0.90143019f, 0.00330968387f},
-std::array<float,2>{0.499967664f, 0.471848875f},
-std::array<float,2>{0.992737591f, 0.544406235f},
-std::array<float,2>{0.040614374f, 0.884230614f},
-std::array<float,2>{0.73516655f, 0.156869963f},
-std::array<float,2>{0.231240496f, 0.118070044f},
-std::array<float,2>{0.509760141f, 0.802907944f},
-std::array<float,2>{0.292974293f, 0.673789859f},
-std::array<float,2>{0.838064313f, 0.321388096f}}
\ No newline at end of file
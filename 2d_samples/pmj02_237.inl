@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.231032178f, 0.166963592f},
-std::array<float,2>{0.610130966f, 0.763603151f},
-std::array<float,2>{0.499832809f, 0.515247166f},
-std::array<float,2>{0.968832552f, 0.318517208f},
-std::array<float,2>{0.357117653f, 0.489070296f},
-std::array<float,2>{0.84079951f, 0.746914446f},
-std::array<float,2>{0.0448018759f, 0.925614119f},
-std::array<float,2>{0.680853486f, 0.056979876f},
-std::array<float,2>{0.102792986f, 0.251562983f},
-std::array<float,2>{0.73683697f, 0.576660216f},
-std::array<float,2>{0.255237401f, 0.814995527f},
-std::array<float,2>{0.772602081f, 0.242714942f},
-std::array<float,2>{0.38357228f, 0.0717068762f},
-std::array<float,2>{0.923948824f, 0.953168511f},
-std::array<float,2>{0.183819458f, 0.659136295f},
-std::array<float,2>{0.522891819f, 0.436936706f},
-std::array<float,2>{0.0128575526f, 0.00720050419f},
-std::array<float,2>{0.627262056f, 0.877184808f},
-std::array<float,2>{0.321013361f, 0.711750209f},
-std::array<float,2>{0.860678613f, 0.439715326f},
-std::array<float,2>{0.465012133f, 0.363296717f},
-std::array<float,2>{0.954743564f, 0.545151711f},
-std::array<float,2>{0.204986989f, 0.798686564f},
-std::array<float,2>{0.586993217f, 0.12505959f},
-std::array<float,2>{0.134486333f, 0.402867734f},
-std::array<float,2>{0.531797349f, 0.645190418f},
-std::array<float,2>{0.434900433f, 0.979581654f},
-std::array<float,2>{0.901847601f, 0.097332716f},
-std::array<float,2>{0.301682383f, 0.190875098f},
-std::array<float,2>{0.787837744f, 0.852832437f},
-std::array<float,2>{0.0635220259f, 0.620865881f},
-std::array<float,2>{0.70345962f, 0.296664566f},
-std::array<float,2>{0.0852520615f, 0.224940881f},
-std::array<float,2>{0.697002709f, 0.829138994f},
-std::array<float,2>{0.288129508f, 0.582653344f},
-std::array<float,2>{0.799552321f, 0.267769933f},
-std::array<float,2>{0.416760266f, 0.419374347f},
-std::array<float,2>{0.878843963f, 0.68120712f},
-std::array<float,2>{0.142905638f, 0.947477758f},
-std::array<float,2>{0.54739964f, 0.090271987f},
-std::array<float,2>{0.189874992f, 0.338077992f},
-std::array<float,2>{0.564471304f, 0.528486013f},
-std::array<float,2>{0.451081961f, 0.776032388f},
-std::array<float,2>{0.945477903f, 0.180694714f},
-std::array<float,2>{0.338751614f, 0.0410740264f},
-std::array<float,2>{0.855041146f, 0.921465456f},
-std::array<float,2>{0.0194152948f, 0.719795108f},
-std::array<float,2>{0.655338407f, 0.480739355f},
-std::array<float,2>{0.166225776f, 0.116115265f},
-std::array<float,2>{0.509833097f, 0.997887313f},
-std::array<float,2>{0.400633931f, 0.636678219f},
-std::array<float,2>{0.912317753f, 0.37951684f},
-std::array<float,2>{0.274474472f, 0.304670691f},
-std::array<float,2>{0.764995813f, 0.598121822f},
-std::array<float,2>{0.124263532f, 0.862530529f},
-std::array<float,2>{0.725408077f, 0.212075353f},
-std::array<float,2>{0.0582941882f, 0.463213205f},
-std::array<float,2>{0.657652199f, 0.700354874f},
-std::array<float,2>{0.363262445f, 0.896271229f},
-std::array<float,2>{0.827968061f, 0.0281863678f},
-std::array<float,2>{0.473925799f, 0.146184534f},
-std::array<float,2>{0.98489666f, 0.783617377f},
-std::array<float,2>{0.236724079f, 0.556011021f},
-std::array<float,2>{0.599746108f, 0.349249333f},
-std::array<float,2>{0.154338181f, 0.210932061f},
-std::array<float,2>{0.555307209f, 0.873078704f},
-std::array<float,2>{0.413528889f, 0.606099665f},
-std::array<float,2>{0.890237391f, 0.312162131f},
-std::array<float,2>{0.296631426f, 0.38606438f},
-std::array<float,2>{0.804713309f, 0.629795492f},
-std::array<float,2>{0.0896226168f, 0.989890754f},
-std::array<float,2>{0.693062484f, 0.121087775f},
-std::array<float,2>{0.0248137098f, 0.358359993f},
-std::array<float,2>{0.646207809f, 0.551311851f},
-std::array<float,2>{0.3327277f, 0.790089011f},
-std::array<float,2>{0.845112383f, 0.148542687f},
-std::array<float,2>{0.444621146f, 0.0224545915f},
-std::array<float,2>{0.938298106f, 0.901091814f},
-std::array<float,2>{0.196707383f, 0.690702677f},
-std::array<float,2>{0.571330905f, 0.460614234f},
-std::array<float,2>{0.116359949f, 0.0828334987f},
-std::array<float,2>{0.733890593f, 0.938189268f},
-std::array<float,2>{0.269200504f, 0.673330247f},
-std::array<float,2>{0.754276097f, 0.408930779f},
-std::array<float,2>{0.391961187f, 0.276631773f},
-std::array<float,2>{0.915691495f, 0.586435318f},
-std::array<float,2>{0.157170177f, 0.835962057f},
-std::array<float,2>{0.500601411f, 0.232480809f},
-std::array<float,2>{0.243350655f, 0.474334031f},
-std::array<float,2>{0.603103638f, 0.732041299f},
-std::array<float,2>{0.483680725f, 0.909850717f},
-std::array<float,2>{0.993453741f, 0.0365698524f},
-std::array<float,2>{0.37046966f, 0.178850606f},
-std::array<float,2>{0.818607092f, 0.768924296f},
-std::array<float,2>{0.0545204729f, 0.522182167f},
-std::array<float,2>{0.665262878f, 0.329592675f},
-std::array<float,2>{0.0350161828f, 0.138535291f},
-std::array<float,2>{0.678642273f, 0.808083713f},
-std::array<float,2>{0.34974122f, 0.538560867f},
-std::array<float,2>{0.832592905f, 0.373078257f},
-std::array<float,2>{0.486025274f, 0.450618953f},
-std::array<float,2>{0.980822265f, 0.704801619f},
-std::array<float,2>{0.222001657f, 0.885733247f},
-std::array<float,2>{0.618243694f, 0.0125162583f},
-std::array<float,2>{0.177028969f, 0.287218839f},
-std::array<float,2>{0.529125929f, 0.612845719f},
-std::array<float,2>{0.377948493f, 0.850731492f},
-std::array<float,2>{0.934209168f, 0.20275484f},
-std::array<float,2>{0.258000255f, 0.102558948f},
-std::array<float,2>{0.774404466f, 0.976269603f},
-std::array<float,2>{0.0999112502f, 0.650652945f},
-std::array<float,2>{0.745939672f, 0.391376317f},
-std::array<float,2>{0.216397867f, 0.0505749248f},
-std::array<float,2>{0.578663945f, 0.929711461f},
-std::array<float,2>{0.456772f, 0.742097259f},
-std::array<float,2>{0.967702866f, 0.497677356f},
-std::array<float,2>{0.313985646f, 0.323260844f},
-std::array<float,2>{0.870509624f, 0.504314721f},
-std::array<float,2>{0.000551560428f, 0.750107884f},
-std::array<float,2>{0.632936895f, 0.16401422f},
-std::array<float,2>{0.0707470104f, 0.42893967f},
-std::array<float,2>{0.715976238f, 0.664123356f},
-std::array<float,2>{0.310693115f, 0.962193012f},
-std::array<float,2>{0.795564771f, 0.0675737634f},
-std::array<float,2>{0.424424946f, 0.237328634f},
-std::array<float,2>{0.898355305f, 0.822930455f},
-std::array<float,2>{0.129528448f, 0.563244998f},
-std::array<float,2>{0.546237588f, 0.262025326f},
-std::array<float,2>{0.1819617f, 0.153191134f},
-std::array<float,2>{0.51906538f, 0.796494365f},
-std::array<float,2>{0.389646888f, 0.547087491f},
-std::array<float,2>{0.927209675f, 0.353971571f},
-std::array<float,2>{0.251984507f, 0.456207126f},
-std::array<float,2>{0.766830385f, 0.691424429f},
-std::array<float,2>{0.106885478f, 0.903637707f},
-std::array<float,2>{0.738325894f, 0.0166858323f},
-std::array<float,2>{0.0416267142f, 0.304807752f},
-std::array<float,2>{0.687130451f, 0.60526675f},
-std::array<float,2>{0.353044122f, 0.868602931f},
-std::array<float,2>{0.839822173f, 0.205068976f},
-std::array<float,2>{0.492705673f, 0.121182993f},
-std::array<float,2>{0.973616481f, 0.985183835f},
-std::array<float,2>{0.227915809f, 0.626622736f},
-std::array<float,2>{0.61480701f, 0.389707983f},
-std::array<float,2>{0.0668942332f, 0.0318268389f},
-std::array<float,2>{0.707809031f, 0.910330594f},
-std::array<float,2>{0.300720721f, 0.726682484f},
-std::array<float,2>{0.781932414f, 0.471125066f},
-std::array<float,2>{0.432357877f, 0.335260808f},
-std::array<float,2>{0.90517652f, 0.516823411f},
-std::array<float,2>{0.137999028f, 0.773245037f},
-std::array<float,2>{0.536564589f, 0.174314797f},
-std::array<float,2>{0.210676357f, 0.413274616f},
-std::array<float,2>{0.590040267f, 0.67656976f},
-std::array<float,2>{0.462995976f, 0.942018867f},
-std::array<float,2>{0.959113836f, 0.079321146f},
-std::array<float,2>{0.325251609f, 0.22749871f},
-std::array<float,2>{0.866157055f, 0.842297912f},
-std::array<float,2>{0.00902441517f, 0.591878176f},
-std::array<float,2>{0.629618645f, 0.279252946f},
-std::array<float,2>{0.0232425947f, 0.196743086f},
-std::array<float,2>{0.649544597f, 0.844688833f},
-std::array<float,2>{0.340111345f, 0.615148485f},
-std::array<float,2>{0.859066486f, 0.284435928f},
-std::array<float,2>{0.447613001f, 0.396474987f},
-std::array<float,2>{0.951643229f, 0.655405581f},
-std::array<float,2>{0.195060492f, 0.970680773f},
-std::array<float,2>{0.569788039f, 0.105866671f},
-std::array<float,2>{0.146353692f, 0.370890349f},
-std::array<float,2>{0.554648638f, 0.534116566f},
-std::array<float,2>{0.419839025f, 0.81143558f},
-std::array<float,2>{0.87956053f, 0.133367896f},
-std::array<float,2>{0.284991175f, 0.0103382245f},
-std::array<float,2>{0.802136242f, 0.890420556f},
-std::array<float,2>{0.0805292726f, 0.710099161f},
-std::array<float,2>{0.700695217f, 0.447901934f},
-std::array<float,2>{0.239823461f, 0.0629456416f},
-std::array<float,2>{0.597315609f, 0.968692601f},
-std::array<float,2>{0.469579786f, 0.670384586f},
-std::array<float,2>{0.991006851f, 0.423227936f},
-std::array<float,2>{0.366774976f, 0.258117437f},
-std::array<float,2>{0.822180212f, 0.567653477f},
-std::array<float,2>{0.0619719289f, 0.825864434f},
-std::array<float,2>{0.663530886f, 0.241728276f},
-std::array<float,2>{0.120813325f, 0.495066911f},
-std::array<float,2>{0.719311774f, 0.734521568f},
-std::array<float,2>{0.277572304f, 0.934075475f},
-std::array<float,2>{0.759191155f, 0.053784091f},
-std::array<float,2>{0.405260295f, 0.157463089f},
-std::array<float,2>{0.909720242f, 0.757781565f},
-std::array<float,2>{0.170723587f, 0.503094733f},
-std::array<float,2>{0.515120208f, 0.325641096f},
-std::array<float,2>{0.199423671f, 0.246119767f},
-std::array<float,2>{0.57607007f, 0.819520414f},
-std::array<float,2>{0.439012468f, 0.572185516f},
-std::array<float,2>{0.945163846f, 0.254638731f},
-std::array<float,2>{0.329437584f, 0.432324529f},
-std::array<float,2>{0.850166023f, 0.660270154f},
-std::array<float,2>{0.0298680682f, 0.957134008f},
-std::array<float,2>{0.643847048f, 0.0752997696f},
-std::array<float,2>{0.0905760527f, 0.312960148f},
-std::array<float,2>{0.687865376f, 0.510510266f},
-std::array<float,2>{0.291604877f, 0.760155022f},
-std::array<float,2>{0.809030116f, 0.171612576f},
-std::array<float,2>{0.406758904f, 0.0614841506f},
-std::array<float,2>{0.884702563f, 0.928868234f},
-std::array<float,2>{0.150280923f, 0.745393395f},
-std::array<float,2>{0.561685503f, 0.487895221f},
-std::array<float,2>{0.0492406376f, 0.100783147f},
-std::array<float,2>{0.670514226f, 0.982479453f},
-std::array<float,2>{0.373326898f, 0.643790841f},
-std::array<float,2>{0.814206183f, 0.401668191f},
-std::array<float,2>{0.478053421f, 0.292354465f},
-std::array<float,2>{0.996133327f, 0.621438265f},
-std::array<float,2>{0.246146336f, 0.85616225f},
-std::array<float,2>{0.606769741f, 0.194009513f},
-std::array<float,2>{0.163715094f, 0.442299277f},
-std::array<float,2>{0.50408572f, 0.71830225f},
-std::array<float,2>{0.394858837f, 0.881309628f},
-std::array<float,2>{0.919879794f, 0.00109005859f},
-std::array<float,2>{0.27303651f, 0.132644802f},
-std::array<float,2>{0.750570893f, 0.801017523f},
-std::array<float,2>{0.110378921f, 0.542295635f},
-std::array<float,2>{0.726822674f, 0.360554159f},
-std::array<float,2>{0.0947304219f, 0.186166197f},
-std::array<float,2>{0.749155879f, 0.777521074f},
-std::array<float,2>{0.265180171f, 0.525496542f},
-std::array<float,2>{0.780116677f, 0.342114031f},
-std::array<float,2>{0.379841596f, 0.480095178f},
-std::array<float,2>{0.932204008f, 0.72575742f},
-std::array<float,2>{0.172370732f, 0.916629791f},
-std::array<float,2>{0.526420593f, 0.046495609f},
-std::array<float,2>{0.223063126f, 0.270663649f},
-std::array<float,2>{0.622855723f, 0.579959929f},
-std::array<float,2>{0.489613771f, 0.835710049f},
-std::array<float,2>{0.978242397f, 0.21954523f},
-std::array<float,2>{0.345455468f, 0.0874106288f},
-std::array<float,2>{0.828801274f, 0.951630592f},
-std::array<float,2>{0.0356016643f, 0.685241759f},
-std::array<float,2>{0.672021747f, 0.414712995f},
-std::array<float,2>{0.126494974f, 0.0260355659f},
-std::array<float,2>{0.54063803f, 0.893583894f},
-std::array<float,2>{0.428000957f, 0.697963774f},
-std::array<float,2>{0.892544568f, 0.46487537f},
-std::array<float,2>{0.30697909f, 0.344010562f},
-std::array<float,2>{0.791464031f, 0.56197077f},
-std::array<float,2>{0.0756895989f, 0.785755873f},
-std::array<float,2>{0.713928103f, 0.141960219f},
-std::array<float,2>{0.00513001159f, 0.376832545f},
-std::array<float,2>{0.639481008f, 0.639125228f},
-std::array<float,2>{0.316881567f, 0.992589593f},
-std::array<float,2>{0.871628165f, 0.112975262f},
-std::array<float,2>{0.460874975f, 0.217172667f},
-std::array<float,2>{0.963014185f, 0.866045892f},
-std::array<float,2>{0.213715822f, 0.596224666f},
-std::array<float,2>{0.583661556f, 0.298204601f},
-std::array<float,2>{0.206805691f, 0.127616793f},
-std::array<float,2>{0.588883162f, 0.799288988f},
-std::array<float,2>{0.468594104f, 0.54403162f},
-std::array<float,2>{0.956690907f, 0.366428375f},
-std::array<float,2>{0.324143469f, 0.437821418f},
-std::array<float,2>{0.862921774f, 0.714538991f},
-std::array<float,2>{0.0142252753f, 0.875294805f},
-std::array<float,2>{0.626701534f, 0.00471495325f},
-std::array<float,2>{0.0648607686f, 0.293489039f},
-std::array<float,2>{0.706070065f, 0.618094623f},
-std::array<float,2>{0.304209173f, 0.855092347f},
-std::array<float,2>{0.786835909f, 0.188343644f},
-std::array<float,2>{0.437106371f, 0.0952315852f},
-std::array<float,2>{0.89868468f, 0.977378249f},
-std::array<float,2>{0.135347515f, 0.646656036f},
-std::array<float,2>{0.533455014f, 0.405200452f},
-std::array<float,2>{0.0467060879f, 0.0558338538f},
-std::array<float,2>{0.682121456f, 0.923605084f},
-std::array<float,2>{0.357988298f, 0.749798059f},
-std::array<float,2>{0.843727767f, 0.491831511f},
-std::array<float,2>{0.497459561f, 0.318211436f},
-std::array<float,2>{0.971057832f, 0.513519943f},
-std::array<float,2>{0.232462958f, 0.76481837f},
-std::array<float,2>{0.612526476f, 0.165725842f},
-std::array<float,2>{0.186843365f, 0.433785409f},
-std::array<float,2>{0.521137059f, 0.657479882f},
-std::array<float,2>{0.386024803f, 0.95586431f},
-std::array<float,2>{0.922515869f, 0.0730010569f},
-std::array<float,2>{0.257298857f, 0.2459151f},
-std::array<float,2>{0.771072268f, 0.814073145f},
-std::array<float,2>{0.103630282f, 0.575035453f},
-std::array<float,2>{0.7355268f, 0.253386438f},
-std::array<float,2>{0.121397555f, 0.213863999f},
-std::array<float,2>{0.723548412f, 0.860829353f},
-std::array<float,2>{0.276800901f, 0.600618184f},
-std::array<float,2>{0.76320982f, 0.301415652f},
-std::array<float,2>{0.398920536f, 0.38121146f},
-std::array<float,2>{0.911025584f, 0.633428097f},
-std::array<float,2>{0.165324673f, 0.998438478f},
-std::array<float,2>{0.507855415f, 0.113317229f},
-std::array<float,2>{0.235854611f, 0.351118416f},
-std::array<float,2>{0.598730385f, 0.558229089f},
-std::array<float,2>{0.476423204f, 0.783005238f},
-std::array<float,2>{0.987890244f, 0.14780134f},
-std::array<float,2>{0.360980064f, 0.0299998689f},
-std::array<float,2>{0.82494688f, 0.896722138f},
-std::array<float,2>{0.0551479384f, 0.70308429f},
-std::array<float,2>{0.659223318f, 0.4623079f},
-std::array<float,2>{0.142125532f, 0.0928668827f},
-std::array<float,2>{0.550390303f, 0.94722569f},
-std::array<float,2>{0.416015118f, 0.682897687f},
-std::array<float,2>{0.875628591f, 0.420334131f},
-std::array<float,2>{0.28622821f, 0.265628666f},
-std::array<float,2>{0.797505915f, 0.584237158f},
-std::array<float,2>{0.0835693106f, 0.830560565f},
-std::array<float,2>{0.6984905f, 0.223893523f},
-std::array<float,2>{0.0158234239f, 0.48385492f},
-std::array<float,2>{0.65391165f, 0.721812844f},
-std::array<float,2>{0.33784461f, 0.919827878f},
-std::array<float,2>{0.85216707f, 0.0407215655f},
-std::array<float,2>{0.452739894f, 0.182592779f},
-std::array<float,2>{0.947750628f, 0.774786174f},
-std::array<float,2>{0.189003795f, 0.529926956f},
-std::array<float,2>{0.563715875f, 0.33733353f},
-std::array<float,2>{0.159975275f, 0.231276587f},
-std::array<float,2>{0.503733575f, 0.838007987f},
-std::array<float,2>{0.393351793f, 0.587984085f},
-std::array<float,2>{0.916135967f, 0.274889588f},
-std::array<float,2>{0.266649991f, 0.407919854f},
-std::array<float,2>{0.756616831f, 0.674614429f},
-std::array<float,2>{0.114503093f, 0.939864874f},
-std::array<float,2>{0.730533063f, 0.0852172747f},
-std::array<float,2>{0.0517280661f, 0.330332398f},
-std::array<float,2>{0.667028427f, 0.521258473f},
-std::array<float,2>{0.369118989f, 0.767323315f},
-std::array<float,2>{0.8179245f, 0.176276252f},
-std::array<float,2>{0.480605751f, 0.0385148451f},
-std::array<float,2>{0.996057808f, 0.906614482f},
-std::array<float,2>{0.244612083f, 0.732569516f},
-std::array<float,2>{0.605378747f, 0.47477892f},
-std::array<float,2>{0.0859745517f, 0.11897333f},
-std::array<float,2>{0.693747997f, 0.991574109f},
-std::array<float,2>{0.294046193f, 0.631656349f},
-std::array<float,2>{0.808282912f, 0.383891046f},
-std::array<float,2>{0.411065668f, 0.309644789f},
-std::array<float,2>{0.888014793f, 0.608413219f},
-std::array<float,2>{0.153772563f, 0.871252418f},
-std::array<float,2>{0.557807624f, 0.208191723f},
-std::array<float,2>{0.198388293f, 0.457940578f},
-std::array<float,2>{0.572901785f, 0.688623905f},
-std::array<float,2>{0.441912323f, 0.899438441f},
-std::array<float,2>{0.939919949f, 0.0204883292f},
-std::array<float,2>{0.334678173f, 0.151149705f},
-std::array<float,2>{0.845823705f, 0.792827606f},
-std::array<float,2>{0.0256969184f, 0.554504931f},
-std::array<float,2>{0.64733386f, 0.355739415f},
-std::array<float,2>{0.00257296651f, 0.161115319f},
-std::array<float,2>{0.634889066f, 0.753396392f},
-std::array<float,2>{0.315496355f, 0.506860137f},
-std::array<float,2>{0.868207753f, 0.321153045f},
-std::array<float,2>{0.453440458f, 0.498538911f},
-std::array<float,2>{0.965878546f, 0.738584518f},
-std::array<float,2>{0.218331024f, 0.932620466f},
-std::array<float,2>{0.581457317f, 0.048407156f},
-std::array<float,2>{0.132733956f, 0.264722854f},
-std::array<float,2>{0.544637501f, 0.564956725f},
-std::array<float,2>{0.4233419f, 0.820384502f},
-std::array<float,2>{0.894771338f, 0.235440627f},
-std::array<float,2>{0.30908218f, 0.069188267f},
-std::array<float,2>{0.794877291f, 0.963703156f},
-std::array<float,2>{0.0742035806f, 0.6677894f},
-std::array<float,2>{0.717025995f, 0.42741096f},
-std::array<float,2>{0.219863221f, 0.0147758583f},
-std::array<float,2>{0.619259f, 0.883987963f},
-std::array<float,2>{0.488205671f, 0.706557333f},
-std::array<float,2>{0.98386693f, 0.452818573f},
-std::array<float,2>{0.348360598f, 0.372231185f},
-std::array<float,2>{0.835799038f, 0.536582053f},
-std::array<float,2>{0.0325574949f, 0.806260169f},
-std::array<float,2>{0.676963151f, 0.140560567f},
-std::array<float,2>{0.0989223048f, 0.392656922f},
-std::array<float,2>{0.742881358f, 0.650070131f},
-std::array<float,2>{0.260607272f, 0.973774612f},
-std::array<float,2>{0.776495993f, 0.104034282f},
-std::array<float,2>{0.376515359f, 0.200275451f},
-std::array<float,2>{0.936549783f, 0.847878098f},
-std::array<float,2>{0.178203836f, 0.610286593f},
-std::array<float,2>{0.529766083f, 0.28554821f},
-std::array<float,2>{0.138797104f, 0.173685476f},
-std::array<float,2>{0.538965821f, 0.769874036f},
-std::array<float,2>{0.430333465f, 0.517976582f},
-std::array<float,2>{0.902999818f, 0.333051801f},
-std::array<float,2>{0.297112614f, 0.470218688f},
-std::array<float,2>{0.784322858f, 0.728797376f},
-std::array<float,2>{0.0689969584f, 0.912412643f},
-std::array<float,2>{0.709645867f, 0.0341212638f},
-std::array<float,2>{0.0101482254f, 0.280434877f},
-std::array<float,2>{0.631509066f, 0.591757953f},
-std::array<float,2>{0.327396482f, 0.841715574f},
-std::array<float,2>{0.863475621f, 0.228706911f},
-std::array<float,2>{0.461446851f, 0.0814143345f},
-std::array<float,2>{0.957835674f, 0.943631887f},
-std::array<float,2>{0.207596272f, 0.679257572f},
-std::array<float,2>{0.592173398f, 0.411337584f},
-std::array<float,2>{0.109069414f, 0.0182681363f},
-std::array<float,2>{0.740615845f, 0.906087041f},
-std::array<float,2>{0.251542598f, 0.693642735f},
-std::array<float,2>{0.768712163f, 0.453427762f},
-std::array<float,2>{0.388498545f, 0.352863491f},
-std::array<float,2>{0.928291261f, 0.550195217f},
-std::array<float,2>{0.17988807f, 0.793101013f},
-std::array<float,2>{0.5162009f, 0.154430851f},
-std::array<float,2>{0.229629278f, 0.386823595f},
-std::array<float,2>{0.616744161f, 0.627514303f},
-std::array<float,2>{0.495183021f, 0.987556338f},
-std::array<float,2>{0.975328326f, 0.123208754f},
-std::array<float,2>{0.354380816f, 0.206336915f},
-std::array<float,2>{0.837270081f, 0.869453967f},
-std::array<float,2>{0.0392427854f, 0.602223516f},
-std::array<float,2>{0.683877349f, 0.308326989f},
-std::array<float,2>{0.0596719645f, 0.239091471f},
-std::array<float,2>{0.660218239f, 0.827779651f},
-std::array<float,2>{0.364254087f, 0.568711162f},
-std::array<float,2>{0.822361887f, 0.260473013f},
-std::array<float,2>{0.47089684f, 0.425231993f},
-std::array<float,2>{0.988397062f, 0.668176055f},
-std::array<float,2>{0.241281539f, 0.965910912f},
-std::array<float,2>{0.594982803f, 0.0663024634f},
-std::array<float,2>{0.168450311f, 0.328006506f},
-std::array<float,2>{0.511803687f, 0.501366198f},
-std::array<float,2>{0.403686255f, 0.754799843f},
-std::array<float,2>{0.907486618f, 0.158864871f},
-std::array<float,2>{0.280808687f, 0.0517933927f},
-std::array<float,2>{0.760865331f, 0.936617076f},
-std::array<float,2>{0.117859885f, 0.737256587f},
-std::array<float,2>{0.721506536f, 0.493944108f},
-std::array<float,2>{0.191515952f, 0.109152511f},
-std::array<float,2>{0.566515565f, 0.971160352f},
-std::array<float,2>{0.445536345f, 0.653827786f},
-std::array<float,2>{0.950118721f, 0.397704661f},
-std::array<float,2>{0.343090057f, 0.28306672f},
-std::array<float,2>{0.855640829f, 0.616469264f},
-std::array<float,2>{0.0195327085f, 0.846997201f},
-std::array<float,2>{0.651257336f, 0.198964834f},
-std::array<float,2>{0.0781293362f, 0.446173042f},
-std::array<float,2>{0.701928198f, 0.708684146f},
-std::array<float,2>{0.282875389f, 0.887706876f},
-std::array<float,2>{0.803744137f, 0.00931601971f},
-std::array<float,2>{0.421253294f, 0.1365612f},
-std::array<float,2>{0.882553041f, 0.808683872f},
-std::array<float,2>{0.147813603f, 0.532410145f},
-std::array<float,2>{0.552248716f, 0.367466331f},
-std::array<float,2>{0.249514163f, 0.192533746f},
-std::array<float,2>{0.608645201f, 0.858368456f},
-std::array<float,2>{0.479066938f, 0.624206543f},
-std::array<float,2>{0.998849094f, 0.29008463f},
-std::array<float,2>{0.372181177f, 0.399139464f},
-std::array<float,2>{0.814484298f, 0.640661716f},
-std::array<float,2>{0.0478968844f, 0.981996f},
-std::array<float,2>{0.669389486f, 0.098272264f},
-std::array<float,2>{0.11305777f, 0.362304837f},
-std::array<float,2>{0.73015368f, 0.540908813f},
-std::array<float,2>{0.269586146f, 0.804208934f},
-std::array<float,2>{0.75270021f, 0.130045012f},
-std::array<float,2>{0.397808522f, 0.00339714787f},
-std::array<float,2>{0.921153307f, 0.880265653f},
-std::array<float,2>{0.161009818f, 0.716109514f},
-std::array<float,2>{0.50694555f, 0.444072515f},
-std::array<float,2>{0.0285243373f, 0.0762070045f},
-std::array<float,2>{0.642381847f, 0.960225403f},
-std::array<float,2>{0.331353933f, 0.662257612f},
-std::array<float,2>{0.84881109f, 0.429841578f},
-std::array<float,2>{0.440486252f, 0.257570088f},
-std::array<float,2>{0.94235909f, 0.574188769f},
-std::array<float,2>{0.201639771f, 0.817080379f},
-std::array<float,2>{0.577583194f, 0.24836044f},
-std::array<float,2>{0.150725022f, 0.486210585f},
-std::array<float,2>{0.559531927f, 0.743402898f},
-std::array<float,2>{0.40948084f, 0.926909089f},
-std::array<float,2>{0.886094987f, 0.0602221936f},
-std::array<float,2>{0.290604025f, 0.16901885f},
-std::array<float,2>{0.811228991f, 0.759125829f},
-std::array<float,2>{0.0931527913f, 0.508912265f},
-std::array<float,2>{0.690759838f, 0.315872312f},
-std::array<float,2>{0.0769564286f, 0.144205183f},
-std::array<float,2>{0.711510301f, 0.787464142f},
-std::array<float,2>{0.305291653f, 0.560402036f},
-std::array<float,2>{0.789085984f, 0.34758839f},
-std::array<float,2>{0.425856948f, 0.467233986f},
-std::array<float,2>{0.893765211f, 0.695364833f},
-std::array<float,2>{0.128058344f, 0.891867578f},
-std::array<float,2>{0.541172564f, 0.0251881108f},
-std::array<float,2>{0.212576762f, 0.300687999f},
-std::array<float,2>{0.585015655f, 0.594208896f},
-std::array<float,2>{0.458893925f, 0.863756776f},
-std::array<float,2>{0.961910009f, 0.216374397f},
-std::array<float,2>{0.320129097f, 0.109806642f},
-std::array<float,2>{0.874634087f, 0.994851649f},
-std::array<float,2>{0.00662805839f, 0.63750422f},
-std::array<float,2>{0.637545288f, 0.378084749f},
-std::array<float,2>{0.175096229f, 0.0430849083f},
-std::array<float,2>{0.5249722f, 0.915660381f},
-std::array<float,2>{0.382284641f, 0.724543512f},
-std::array<float,2>{0.931250691f, 0.477587312f},
-std::array<float,2>{0.26357013f, 0.340500236f},
-std::array<float,2>{0.778592825f, 0.523903847f},
-std::array<float,2>{0.0973350331f, 0.780868411f},
-std::array<float,2>{0.747396946f, 0.184657589f},
-std::array<float,2>{0.0372657813f, 0.416362882f},
-std::array<float,2>{0.67563343f, 0.685706615f},
-std::array<float,2>{0.34681648f, 0.950250685f},
-std::array<float,2>{0.830385387f, 0.0895354524f},
-std::array<float,2>{0.491614223f, 0.221893594f},
-std::array<float,2>{0.980014384f, 0.83289057f},
-std::array<float,2>{0.226349801f, 0.582006872f},
-std::array<float,2>{0.623079658f, 0.273213714f},
-std::array<float,2>{0.237685859f, 0.14671573f},
-std::array<float,2>{0.601141036f, 0.781836152f},
-std::array<float,2>{0.47289151f, 0.557135463f},
-std::array<float,2>{0.985525489f, 0.349648178f},
-std::array<float,2>{0.361664802f, 0.46157977f},
-std::array<float,2>{0.826385796f, 0.701857686f},
-std::array<float,2>{0.0575217009f, 0.897789598f},
-std::array<float,2>{0.656948805f, 0.0302887112f},
-std::array<float,2>{0.123180844f, 0.302134514f},
-std::array<float,2>{0.726343691f, 0.600341678f},
-std::array<float,2>{0.274121851f, 0.860244274f},
-std::array<float,2>{0.764460802f, 0.214736745f},
-std::array<float,2>{0.402157068f, 0.114640854f},
-std::array<float,2>{0.913300693f, 0.999415874f},
-std::array<float,2>{0.167584583f, 0.633984268f},
-std::array<float,2>{0.511371911f, 0.382794261f},
-std::array<float,2>{0.0185033027f, 0.0391250402f},
-std::array<float,2>{0.654361367f, 0.918589592f},
-std::array<float,2>{0.339270562f, 0.721013129f},
-std::array<float,2>{0.854361653f, 0.482941389f},
-std::array<float,2>{0.449998319f, 0.33667168f},
-std::array<float,2>{0.946394503f, 0.53099674f},
-std::array<float,2>{0.190730199f, 0.773511291f},
-std::array<float,2>{0.566012919f, 0.182979003f},
-std::array<float,2>{0.144111425f, 0.42124337f},
-std::array<float,2>{0.548629582f, 0.682499468f},
-std::array<float,2>{0.417141497f, 0.945852876f},
-std::array<float,2>{0.877845049f, 0.0919639841f},
-std::array<float,2>{0.287699491f, 0.222688526f},
-std::array<float,2>{0.800710559f, 0.831628919f},
-std::array<float,2>{0.0840950683f, 0.585346699f},
-std::array<float,2>{0.695775926f, 0.267547071f},
-std::array<float,2>{0.0628159419f, 0.18887414f},
-std::array<float,2>{0.704148233f, 0.853946745f},
-std::array<float,2>{0.302212924f, 0.619087696f},
-std::array<float,2>{0.788981259f, 0.294506788f},
-std::array<float,2>{0.433665574f, 0.406028509f},
-std::array<float,2>{0.901300609f, 0.647755802f},
-std::array<float,2>{0.133302018f, 0.977978408f},
-std::array<float,2>{0.533174813f, 0.0942059085f},
-std::array<float,2>{0.203423128f, 0.366033733f},
-std::array<float,2>{0.586242199f, 0.54383862f},
-std::array<float,2>{0.466639459f, 0.800771475f},
-std::array<float,2>{0.953248978f, 0.128154114f},
-std::array<float,2>{0.321860641f, 0.00526308734f},
-std::array<float,2>{0.860205591f, 0.876542628f},
-std::array<float,2>{0.0126499906f, 0.713730395f},
-std::array<float,2>{0.628724217f, 0.438756645f},
-std::array<float,2>{0.185078382f, 0.0741589367f},
-std::array<float,2>{0.521825969f, 0.956489384f},
-std::array<float,2>{0.384737104f, 0.656887352f},
-std::array<float,2>{0.925513804f, 0.434734583f},
-std::array<float,2>{0.254371077f, 0.252098113f},
-std::array<float,2>{0.77149713f, 0.575305104f},
-std::array<float,2>{0.102442831f, 0.812584817f},
-std::array<float,2>{0.738267601f, 0.24494876f},
-std::array<float,2>{0.0436009169f, 0.491129398f},
-std::array<float,2>{0.67975086f, 0.748564124f},
-std::array<float,2>{0.355991989f, 0.922241747f},
-std::array<float,2>{0.84109956f, 0.0554716364f},
-std::array<float,2>{0.498329729f, 0.164289549f},
-std::array<float,2>{0.969961643f, 0.764072835f},
-std::array<float,2>{0.231666654f, 0.512037992f},
-std::array<float,2>{0.61113888f, 0.316929817f},
-std::array<float,2>{0.130365595f, 0.234887883f},
-std::array<float,2>{0.545331001f, 0.821649909f},
-std::array<float,2>{0.424961478f, 0.565811634f},
-std::array<float,2>{0.897390902f, 0.264079779f},
-std::array<float,2>{0.311639518f, 0.426336765f},
-std::array<float,2>{0.795956135f, 0.666215777f},
-std::array<float,2>{0.0718349516f, 0.964694142f},
-std::array<float,2>{0.715176105f, 0.0696206316f},
-std::array<float,2>{0.0013933985f, 0.321961075f},
-std::array<float,2>{0.63474977f, 0.506123483f},
-std::array<float,2>{0.312675595f, 0.752047062f},
-std::array<float,2>{0.869246006f, 0.161459252f},
-std::array<float,2>{0.455528826f, 0.0476100892f},
-std::array<float,2>{0.968663096f, 0.932338178f},
-std::array<float,2>{0.215147182f, 0.739790857f},
-std::array<float,2>{0.579401731f, 0.499616355f},
-std::array<float,2>{0.100990713f, 0.105207026f},
-std::array<float,2>{0.744152844f, 0.972941399f},
-std::array<float,2>{0.259696752f, 0.649142981f},
-std::array<float,2>{0.775377333f, 0.393805534f},
-std::array<float,2>{0.377576828f, 0.286416233f},
-std::array<float,2>{0.934581816f, 0.610935628f},
-std::array<float,2>{0.175893515f, 0.849143028f},
-std::array<float,2>{0.527561545f, 0.199234426f},
-std::array<float,2>{0.221394688f, 0.45175606f},
-std::array<float,2>{0.617807984f, 0.705574512f},
-std::array<float,2>{0.484576702f, 0.883713484f},
-std::array<float,2>{0.982397735f, 0.0139193209f},
-std::array<float,2>{0.351301759f, 0.138894662f},
-std::array<float,2>{0.833311796f, 0.805353761f},
-std::array<float,2>{0.0337520912f, 0.535960197f},
-std::array<float,2>{0.679051101f, 0.371261746f},
-std::array<float,2>{0.0529302545f, 0.176793084f},
-std::array<float,2>{0.664505064f, 0.766238809f},
-std::array<float,2>{0.369806528f, 0.520224273f},
-std::array<float,2>{0.819470823f, 0.331357777f},
-std::array<float,2>{0.48336494f, 0.476158381f},
-std::array<float,2>{0.992308319f, 0.733576298f},
-std::array<float,2>{0.242481023f, 0.907690644f},
-std::array<float,2>{0.602365315f, 0.0372669436f},
-std::array<float,2>{0.157691315f, 0.273893476f},
-std::array<float,2>{0.501404405f, 0.589476287f},
-std::array<float,2>{0.39102f, 0.839450896f},
-std::array<float,2>{0.914945543f, 0.231972709f},
-std::array<float,2>{0.267651707f, 0.0849455521f},
-std::array<float,2>{0.755684316f, 0.94095993f},
-std::array<float,2>{0.116134666f, 0.675654292f},
-std::array<float,2>{0.732844055f, 0.406645983f},
-std::array<float,2>{0.196283251f, 0.0207328591f},
-std::array<float,2>{0.571060181f, 0.898445368f},
-std::array<float,2>{0.443854362f, 0.687989235f},
-std::array<float,2>{0.93898803f, 0.458254576f},
-std::array<float,2>{0.333597511f, 0.357145816f},
-std::array<float,2>{0.844340503f, 0.552873313f},
-std::array<float,2>{0.0239141677f, 0.791384161f},
-std::array<float,2>{0.644554079f, 0.15158464f},
-std::array<float,2>{0.0881377012f, 0.383355886f},
-std::array<float,2>{0.692267478f, 0.632573307f},
-std::array<float,2>{0.295315355f, 0.990695715f},
-std::array<float,2>{0.806617975f, 0.117952071f},
-std::array<float,2>{0.412916392f, 0.207384646f},
-std::array<float,2>{0.888729692f, 0.872680366f},
-std::array<float,2>{0.155343249f, 0.607883573f},
-std::array<float,2>{0.556016088f, 0.308935732f},
-std::array<float,2>{0.170926437f, 0.15923062f},
-std::array<float,2>{0.514326513f, 0.75541532f},
-std::array<float,2>{0.406172454f, 0.500864685f},
-std::array<float,2>{0.908624589f, 0.326320738f},
-std::array<float,2>{0.278584927f, 0.492508411f},
-std::array<float,2>{0.758132398f, 0.73753047f},
-std::array<float,2>{0.119433254f, 0.935624719f},
-std::array<float,2>{0.720134676f, 0.0515420362f},
-std::array<float,2>{0.0613877662f, 0.26122874f},
-std::array<float,2>{0.662994623f, 0.569933295f},
-std::array<float,2>{0.365927637f, 0.826430976f},
-std::array<float,2>{0.821212769f, 0.240083292f},
-std::array<float,2>{0.470264465f, 0.0652447343f},
-std::array<float,2>{0.991408169f, 0.965331137f},
-std::array<float,2>{0.238978282f, 0.66963923f},
-std::array<float,2>{0.595775425f, 0.424133897f},
-std::array<float,2>{0.0819963217f, 0.00813039765f},
-std::array<float,2>{0.699534059f, 0.887672186f},
-std::array<float,2>{0.284086823f, 0.707177103f},
-std::array<float,2>{0.800974846f, 0.447210938f},
-std::array<float,2>{0.41882664f, 0.368720323f},
-std::array<float,2>{0.88025707f, 0.531608701f},
-std::array<float,2>{0.145257026f, 0.809919715f},
-std::array<float,2>{0.553562939f, 0.135668844f},
-std::array<float,2>{0.193889812f, 0.397306979f},
-std::array<float,2>{0.568500996f, 0.652941287f},
-std::array<float,2>{0.448864758f, 0.972447634f},
-std::array<float,2>{0.95273751f, 0.108373381f},
-std::array<float,2>{0.340916306f, 0.197931796f},
-std::array<float,2>{0.858174443f, 0.846365809f},
-std::array<float,2>{0.0222778171f, 0.616140008f},
-std::array<float,2>{0.648842752f, 0.281976193f},
-std::array<float,2>{0.00815242901f, 0.229794353f},
-std::array<float,2>{0.630407929f, 0.84037286f},
-std::array<float,2>{0.324280649f, 0.590354979f},
-std::array<float,2>{0.867109179f, 0.280008167f},
-std::array<float,2>{0.464635611f, 0.410747081f},
-std::array<float,2>{0.960598052f, 0.678317904f},
-std::array<float,2>{0.209594548f, 0.944544017f},
-std::array<float,2>{0.591755748f, 0.0806936398f},
-std::array<float,2>{0.137639895f, 0.332519561f},
-std::array<float,2>{0.535735726f, 0.519362926f},
-std::array<float,2>{0.433553934f, 0.771058023f},
-std::array<float,2>{0.905883551f, 0.172057062f},
-std::array<float,2>{0.299271315f, 0.0343764983f},
-std::array<float,2>{0.782831728f, 0.913273811f},
-std::array<float,2>{0.0679517537f, 0.729733229f},
-std::array<float,2>{0.708107054f, 0.469586939f},
-std::array<float,2>{0.227502927f, 0.124194615f},
-std::array<float,2>{0.613775253f, 0.98651737f},
-std::array<float,2>{0.493575633f, 0.628501058f},
-std::array<float,2>{0.974258244f, 0.387809366f},
-std::array<float,2>{0.351674527f, 0.307581097f},
-std::array<float,2>{0.83815819f, 0.603381455f},
-std::array<float,2>{0.0421002284f, 0.870437026f},
-std::array<float,2>{0.686080813f, 0.205256447f},
-std::array<float,2>{0.106419601f, 0.454589099f},
-std::array<float,2>{0.73955071f, 0.695252478f},
-std::array<float,2>{0.253315598f, 0.90443337f},
-std::array<float,2>{0.765842855f, 0.0191413648f},
-std::array<float,2>{0.390174359f, 0.155584097f},
-std::array<float,2>{0.92633152f, 0.793977678f},
-std::array<float,2>{0.183225691f, 0.549674869f},
-std::array<float,2>{0.518324137f, 0.352223426f},
-std::array<float,2>{0.214101598f, 0.215687498f},
-std::array<float,2>{0.582353473f, 0.865027308f},
-std::array<float,2>{0.459879965f, 0.595190346f},
-std::array<float,2>{0.964466631f, 0.298849314f},
-std::array<float,2>{0.317623258f, 0.377713293f},
-std::array<float,2>{0.872815192f, 0.638379276f},
-std::array<float,2>{0.00415458251f, 0.995384037f},
-std::array<float,2>{0.640242815f, 0.110573508f},
-std::array<float,2>{0.0745672211f, 0.3457838f},
-std::array<float,2>{0.713748395f, 0.559137046f},
-std::array<float,2>{0.307994723f, 0.788539886f},
-std::array<float,2>{0.792661726f, 0.142644376f},
-std::array<float,2>{0.429293752f, 0.0237666573f},
-std::array<float,2>{0.890976369f, 0.891029775f},
-std::array<float,2>{0.125085011f, 0.696576953f},
-std::array<float,2>{0.539307356f, 0.468183905f},
-std::array<float,2>{0.0368533693f, 0.0879107639f},
-std::array<float,2>{0.673002362f, 0.950052261f},
-std::array<float,2>{0.344716609f, 0.687014341f},
-std::array<float,2>{0.829610944f, 0.417517364f},
-std::array<float,2>{0.488935024f, 0.271834552f},
-std::array<float,2>{0.976625681f, 0.580426753f},
-std::array<float,2>{0.224428907f, 0.833754897f},
-std::array<float,2>{0.62131691f, 0.221615836f},
-std::array<float,2>{0.173511088f, 0.476964951f},
-std::array<float,2>{0.52605623f, 0.722725928f},
-std::array<float,2>{0.380105942f, 0.914847076f},
-std::array<float,2>{0.933359802f, 0.044376336f},
-std::array<float,2>{0.264513999f, 0.183676139f},
-std::array<float,2>{0.780657053f, 0.780260086f},
-std::array<float,2>{0.0942362845f, 0.524897218f},
-std::array<float,2>{0.74864924f, 0.340851247f},
-std::array<float,2>{0.109595142f, 0.129551694f},
-std::array<float,2>{0.727790594f, 0.803153098f},
-std::array<float,2>{0.271702021f, 0.539671838f},
-std::array<float,2>{0.75140661f, 0.362014443f},
-std::array<float,2>{0.395882487f, 0.444723934f},
-std::array<float,2>{0.918755531f, 0.715255022f},
-std::array<float,2>{0.162780404f, 0.879613757f},
-std::array<float,2>{0.505238354f, 0.00244454341f},
-std::array<float,2>{0.247378901f, 0.289096862f},
-std::array<float,2>{0.605711341f, 0.623867095f},
-std::array<float,2>{0.476908743f, 0.858508468f},
-std::array<float,2>{0.997763395f, 0.192368716f},
-std::array<float,2>{0.374217063f, 0.0991010815f},
-std::array<float,2>{0.81341964f, 0.980830431f},
-std::array<float,2>{0.0500734262f, 0.642173529f},
-std::array<float,2>{0.671212733f, 0.3994748f},
-std::array<float,2>{0.148527995f, 0.0589530878f},
-std::array<float,2>{0.561355829f, 0.926327825f},
-std::array<float,2>{0.407820851f, 0.742498279f},
-std::array<float,2>{0.882932782f, 0.484958529f},
-std::array<float,2>{0.292888999f, 0.315201014f},
-std::array<float,2>{0.810164094f, 0.508431137f},
-std::array<float,2>{0.0915546343f, 0.758002698f},
-std::array<float,2>{0.689450741f, 0.168721691f},
-std::array<float,2>{0.0303761475f, 0.430730343f},
-std::array<float,2>{0.642932236f, 0.663389385f},
-std::array<float,2>{0.328500003f, 0.959518015f},
-std::array<float,2>{0.851324499f, 0.0779194534f},
-std::array<float,2>{0.437542766f, 0.249144226f},
-std::array<float,2>{0.944177568f, 0.818296432f},
-std::array<float,2>{0.200656936f, 0.572940469f},
-std::array<float,2>{0.574505687f, 0.256381035f},
-std::array<float,2>{0.187842831f, 0.180055991f},
-std::array<float,2>{0.563433051f, 0.776803374f},
-std::array<float,2>{0.451298773f, 0.52768898f},
-std::array<float,2>{0.949183881f, 0.339299172f},
-std::array<float,2>{0.335987359f, 0.481518567f},
-std::array<float,2>{0.852956831f, 0.718768299f},
-std::array<float,2>{0.0167064555f, 0.920192242f},
-std::array<float,2>{0.653053582f, 0.042406667f},
-std::array<float,2>{0.0826366991f, 0.268846095f},
-std::array<float,2>{0.697346866f, 0.583853006f},
-std::array<float,2>{0.28594771f, 0.82897073f},
-std::array<float,2>{0.798789322f, 0.226398498f},
-std::array<float,2>{0.414142966f, 0.0908685029f},
-std::array<float,2>{0.876750469f, 0.948597968f},
-std::array<float,2>{0.140764475f, 0.679756403f},
-std::array<float,2>{0.548927903f, 0.418566912f},
-std::array<float,2>{0.0564106628f, 0.0283499137f},
-std::array<float,2>{0.658866227f, 0.894615769f},
-std::array<float,2>{0.360071868f, 0.700039625f},
-std::array<float,2>{0.825471401f, 0.46416384f},
-std::array<float,2>{0.475395054f, 0.348362148f},
-std::array<float,2>{0.986767471f, 0.555570781f},
-std::array<float,2>{0.23479028f, 0.785081029f},
-std::array<float,2>{0.598448694f, 0.144634217f},
-std::array<float,2>{0.164897129f, 0.38070178f},
-std::array<float,2>{0.509591162f, 0.635484099f},
-std::array<float,2>{0.399734139f, 0.996432006f},
-std::array<float,2>{0.911628067f, 0.116945401f},
-std::array<float,2>{0.276119709f, 0.211276382f},
-std::array<float,2>{0.762349665f, 0.86224097f},
-std::array<float,2>{0.122690007f, 0.598841608f},
-std::array<float,2>{0.724600077f, 0.303157896f},
-std::array<float,2>{0.105074711f, 0.243548781f},
-std::array<float,2>{0.73501128f, 0.816397369f},
-std::array<float,2>{0.256557584f, 0.57808286f},
-std::array<float,2>{0.769927502f, 0.250182033f},
-std::array<float,2>{0.385527402f, 0.436466455f},
-std::array<float,2>{0.923694551f, 0.659443259f},
-std::array<float,2>{0.185939476f, 0.954175651f},
-std::array<float,2>{0.520390868f, 0.070433028f},
-std::array<float,2>{0.234277517f, 0.319445223f},
-std::array<float,2>{0.611673415f, 0.514228523f},
-std::array<float,2>{0.496988803f, 0.762693822f},
-std::array<float,2>{0.971715868f, 0.167198434f},
-std::array<float,2>{0.358531713f, 0.0576818697f},
-std::array<float,2>{0.84260577f, 0.924063444f},
-std::array<float,2>{0.0456727296f, 0.747408807f},
-std::array<float,2>{0.683579504f, 0.489270568f},
-std::array<float,2>{0.135997087f, 0.0961709023f},
-std::array<float,2>{0.534247518f, 0.978671014f},
-std::array<float,2>{0.436045766f, 0.646295905f},
-std::array<float,2>{0.900001526f, 0.404198527f},
-std::array<float,2>{0.303212047f, 0.295792162f},
-std::array<float,2>{0.785378397f, 0.619480431f},
-std::array<float,2>{0.0659026355f, 0.852121055f},
-std::array<float,2>{0.70529902f, 0.189481586f},
-std::array<float,2>{0.0148017639f, 0.441053897f},
-std::array<float,2>{0.625575244f, 0.712534368f},
-std::array<float,2>{0.322419107f, 0.878435433f},
-std::array<float,2>{0.86185205f, 0.00635613548f},
-std::array<float,2>{0.467284054f, 0.12625064f},
-std::array<float,2>{0.955216646f, 0.79688096f},
-std::array<float,2>{0.205973014f, 0.546596289f},
-std::array<float,2>{0.588602602f, 0.364625305f},
-std::array<float,2>{0.179601341f, 0.201414466f},
-std::array<float,2>{0.531056762f, 0.850413442f},
-std::array<float,2>{0.375487864f, 0.611828029f},
-std::array<float,2>{0.936436236f, 0.288670123f},
-std::array<float,2>{0.26144439f, 0.391634583f},
-std::array<float,2>{0.776190877f, 0.652001262f},
-std::array<float,2>{0.0980094746f, 0.974753618f},
-std::array<float,2>{0.743330836f, 0.102278277f},
-std::array<float,2>{0.0320961475f, 0.374886245f},
-std::array<float,2>{0.675877035f, 0.537347913f},
-std::array<float,2>{0.349147141f, 0.807022929f},
-std::array<float,2>{0.834391236f, 0.137676969f},
-std::array<float,2>{0.486397505f, 0.0133718932f},
-std::array<float,2>{0.982726812f, 0.885833502f},
-std::array<float,2>{0.218926355f, 0.703541636f},
-std::array<float,2>{0.620773077f, 0.450117916f},
-std::array<float,2>{0.072539255f, 0.067253381f},
-std::array<float,2>{0.718136013f, 0.961659491f},
-std::array<float,2>{0.310351461f, 0.665241957f},
-std::array<float,2>{0.793883502f, 0.428068995f},
-std::array<float,2>{0.422026247f, 0.263460636f},
-std::array<float,2>{0.896430194f, 0.564122617f},
-std::array<float,2>{0.13165538f, 0.823395252f},
-std::array<float,2>{0.543628991f, 0.236436903f},
-std::array<float,2>{0.217272177f, 0.496790469f},
-std::array<float,2>{0.580934227f, 0.740557134f},
-std::array<float,2>{0.454430878f, 0.930901349f},
-std::array<float,2>{0.965812624f, 0.0491895489f},
-std::array<float,2>{0.315377116f, 0.162788749f},
-std::array<float,2>{0.867749095f, 0.751714647f},
-std::array<float,2>{0.00314904936f, 0.505562067f},
-std::array<float,2>{0.636287451f, 0.322351217f},
-std::array<float,2>{0.0264172535f, 0.150267631f},
-std::array<float,2>{0.647594571f, 0.789767385f},
-std::array<float,2>{0.33512181f, 0.552693188f},
-std::array<float,2>{0.847387314f, 0.359063953f},
-std::array<float,2>{0.4423953f, 0.45989415f},
-std::array<float,2>{0.940591693f, 0.690248072f},
-std::array<float,2>{0.198170736f, 0.901970744f},
-std::array<float,2>{0.573393822f, 0.023155842f},
-std::array<float,2>{0.15237695f, 0.310775876f},
-std::array<float,2>{0.556925237f, 0.60712111f},
-std::array<float,2>{0.411693901f, 0.87414223f},
-std::array<float,2>{0.887321234f, 0.209177017f},
-std::array<float,2>{0.293637902f, 0.119851768f},
-std::array<float,2>{0.807355762f, 0.989102423f},
-std::array<float,2>{0.0873244181f, 0.630410552f},
-std::array<float,2>{0.694892347f, 0.385552287f},
-std::array<float,2>{0.245565832f, 0.03520092f},
-std::array<float,2>{0.60403192f, 0.908723533f},
-std::array<float,2>{0.481449604f, 0.731122375f},
-std::array<float,2>{0.994879842f, 0.473208904f},
-std::array<float,2>{0.368066788f, 0.328218311f},
-std::array<float,2>{0.817213655f, 0.522777855f},
-std::array<float,2>{0.0521212704f, 0.768453896f},
-std::array<float,2>{0.666317046f, 0.178596914f},
-std::array<float,2>{0.114242055f, 0.409506679f},
-std::array<float,2>{0.731524825f, 0.672842503f},
-std::array<float,2>{0.265709728f, 0.938615322f},
-std::array<float,2>{0.756851196f, 0.0835561827f},
-std::array<float,2>{0.393568158f, 0.233835533f},
-std::array<float,2>{0.917010844f, 0.837423623f},
-std::array<float,2>{0.159125835f, 0.587535262f},
-std::array<float,2>{0.502671599f, 0.275409281f},
-std::array<float,2>{0.14690876f, 0.134695575f},
-std::array<float,2>{0.551323891f, 0.812379777f},
-std::array<float,2>{0.420543134f, 0.534785807f},
-std::array<float,2>{0.881151259f, 0.369724572f},
-std::array<float,2>{0.281391799f, 0.448385507f},
-std::array<float,2>{0.802777708f, 0.709127247f},
-std::array<float,2>{0.0800403729f, 0.88939327f},
-std::array<float,2>{0.702457726f, 0.0113748945f},
-std::array<float,2>{0.0210923571f, 0.283265084f},
-std::array<float,2>{0.652165174f, 0.613883555f},
-std::array<float,2>{0.342328101f, 0.844957888f},
-std::array<float,2>{0.85671407f, 0.195332974f},
-std::array<float,2>{0.446615577f, 0.10676536f},
-std::array<float,2>{0.950361431f, 0.9692536f},
-std::array<float,2>{0.192716062f, 0.654817104f},
-std::array<float,2>{0.567697704f, 0.394680232f},
-std::array<float,2>{0.118272796f, 0.0534954965f},
-std::array<float,2>{0.722265005f, 0.935187399f},
-std::array<float,2>{0.280237854f, 0.736188769f},
-std::array<float,2>{0.760383725f, 0.495634109f},
-std::array<float,2>{0.402769685f, 0.324866802f},
-std::array<float,2>{0.906806409f, 0.502637446f},
-std::array<float,2>{0.169181868f, 0.756335974f},
-std::array<float,2>{0.512949407f, 0.156594008f},
-std::array<float,2>{0.240730822f, 0.42191112f},
-std::array<float,2>{0.594193757f, 0.671159565f},
-std::array<float,2>{0.472139388f, 0.967485189f},
-std::array<float,2>{0.989764988f, 0.0636867136f},
-std::array<float,2>{0.365017235f, 0.240880296f},
-std::array<float,2>{0.823687017f, 0.824987173f},
-std::array<float,2>{0.0592527427f, 0.566757798f},
-std::array<float,2>{0.661286891f, 0.259685636f},
-std::array<float,2>{0.0403366424f, 0.203709796f},
-std::array<float,2>{0.685337245f, 0.867406964f},
-std::array<float,2>{0.354924649f, 0.603993595f},
-std::array<float,2>{0.836217999f, 0.305757165f},
-std::array<float,2>{0.494505048f, 0.388706237f},
-std::array<float,2>{0.975845933f, 0.625090897f},
-std::array<float,2>{0.22887671f, 0.985518157f},
-std::array<float,2>{0.615281343f, 0.122651197f},
-std::array<float,2>{0.181013659f, 0.354620308f},
-std::array<float,2>{0.5174492f, 0.548501432f},
-std::array<float,2>{0.387532383f, 0.795401454f},
-std::array<float,2>{0.928880572f, 0.153884739f},
-std::array<float,2>{0.250239581f, 0.0158316884f},
-std::array<float,2>{0.767970145f, 0.903236568f},
-std::array<float,2>{0.107933111f, 0.693088114f},
-std::array<float,2>{0.741660178f, 0.455497265f},
-std::array<float,2>{0.208952621f, 0.0783257186f},
-std::array<float,2>{0.593488693f, 0.94315511f},
-std::array<float,2>{0.46203959f, 0.677073061f},
-std::array<float,2>{0.95812422f, 0.413027436f},
-std::array<float,2>{0.32646805f, 0.277571321f},
-std::array<float,2>{0.864344418f, 0.593611956f},
-std::array<float,2>{0.0113997208f, 0.843293846f},
-std::array<float,2>{0.632621229f, 0.227900967f},
-std::array<float,2>{0.069743678f, 0.472207755f},
-std::array<float,2>{0.709964991f, 0.728361905f},
-std::array<float,2>{0.29810226f, 0.911649883f},
-std::array<float,2>{0.783516169f, 0.0327131376f},
-std::array<float,2>{0.431491196f, 0.175258383f},
-std::array<float,2>{0.904247642f, 0.772213638f},
-std::array<float,2>{0.139841408f, 0.516294897f},
-std::array<float,2>{0.537687957f, 0.334587246f},
-std::array<float,2>{0.225562528f, 0.220272586f},
-std::array<float,2>{0.624643981f, 0.834914684f},
-std::array<float,2>{0.491035491f, 0.579092383f},
-std::array<float,2>{0.97907877f, 0.270414919f},
-std::array<float,2>{0.346414834f, 0.41562143f},
-std::array<float,2>{0.832005978f, 0.684320211f},
-std::array<float,2>{0.0389536433f, 0.952367067f},
-std::array<float,2>{0.673894465f, 0.0861444548f},
-std::array<float,2>{0.0963993669f, 0.343170524f},
-std::array<float,2>{0.746765852f, 0.526646018f},
-std::array<float,2>{0.261911541f, 0.778783917f},
-std::array<float,2>{0.778025746f, 0.186665967f},
-std::array<float,2>{0.381802738f, 0.0452862121f},
-std::array<float,2>{0.92995894f, 0.917904973f},
-std::array<float,2>{0.173940718f, 0.724624932f},
-std::array<float,2>{0.523817062f, 0.479268789f},
-std::array<float,2>{0.00752127916f, 0.111916073f},
-std::array<float,2>{0.637817562f, 0.993849933f},
-std::array<float,2>{0.318681389f, 0.639962435f},
-std::array<float,2>{0.873318315f, 0.375163674f},
-std::array<float,2>{0.457760781f, 0.297761589f},
-std::array<float,2>{0.962217093f, 0.596943617f},
-std::array<float,2>{0.210976616f, 0.866612971f},
-std::array<float,2>{0.584043205f, 0.21831502f},
-std::array<float,2>{0.127552047f, 0.466517866f},
-std::array<float,2>{0.542766035f, 0.698388278f},
-std::array<float,2>{0.427101821f, 0.893379331f},
-std::array<float,2>{0.89267987f, 0.0272460859f},
-std::array<float,2>{0.305866569f, 0.14154014f},
-std::array<float,2>{0.79099077f, 0.786425114f},
-std::array<float,2>{0.0778521448f, 0.560555041f},
-std::array<float,2>{0.712854743f, 0.345160902f},
-std::array<float,2>{0.0922418684f, 0.170248166f},
-std::array<float,2>{0.690130949f, 0.761506557f},
-std::array<float,2>{0.289467067f, 0.511311114f},
-std::array<float,2>{0.812018514f, 0.313481063f},
-std::array<float,2>{0.408870101f, 0.486406744f},
-std::array<float,2>{0.885471761f, 0.744946599f},
-std::array<float,2>{0.151942834f, 0.928213596f},
-std::array<float,2>{0.559721112f, 0.0624824576f},
-std::array<float,2>{0.203051314f, 0.25541845f},
-std::array<float,2>{0.57705605f, 0.57127434f},
-std::array<float,2>{0.439995795f, 0.81884253f},
-std::array<float,2>{0.942393064f, 0.247887328f},
-std::array<float,2>{0.330786794f, 0.0745232329f},
-std::array<float,2>{0.848221898f, 0.958599269f},
-std::array<float,2>{0.0274532605f, 0.661179364f},
-std::array<float,2>{0.641329527f, 0.433141798f},
-std::array<float,2>{0.161629125f, 0.000561909692f},
-std::array<float,2>{0.506293476f, 0.882292509f},
-std::array<float,2>{0.397291094f, 0.716927111f},
-std::array<float,2>{0.920672894f, 0.442794353f},
-std::array<float,2>{0.270525604f, 0.359733164f},
-std::array<float,2>{0.753172338f, 0.541901112f},
-std::array<float,2>{0.111549795f, 0.802582443f},
-std::array<float,2>{0.729103208f, 0.131769702f},
-std::array<float,2>{0.0470364727f, 0.400796324f},
-std::array<float,2>{0.668494999f, 0.643061996f},
-std::array<float,2>{0.371882647f, 0.984277189f},
-std::array<float,2>{0.816217482f, 0.0998268276f},
-std::array<float,2>{0.47974509f, 0.195143536f},
-std::array<float,2>{0.999570072f, 0.85710746f},
-std::array<float,2>{0.248773202f, 0.623026907f},
-std::array<float,2>{0.607789695f, 0.291158199f},
-std::array<float,2>{0.242821187f, 0.177746788f},
-std::array<float,2>{0.602046251f, 0.767942607f},
-std::array<float,2>{0.482624322f, 0.523236334f},
-std::array<float,2>{0.993147194f, 0.32882452f},
-std::array<float,2>{0.36922583f, 0.473032266f},
-std::array<float,2>{0.820013165f, 0.730804861f},
-std::array<float,2>{0.0536005162f, 0.90834868f},
-std::array<float,2>{0.664605379f, 0.0359225012f},
-std::array<float,2>{0.115474522f, 0.276025653f},
-std::array<float,2>{0.733326674f, 0.586953282f},
-std::array<float,2>{0.268458903f, 0.837391138f},
-std::array<float,2>{0.755271494f, 0.234094903f},
-std::array<float,2>{0.391146809f, 0.0830202699f},
-std::array<float,2>{0.914091468f, 0.93911463f},
-std::array<float,2>{0.158161938f, 0.672100604f},
-std::array<float,2>{0.501659393f, 0.410045415f},
-std::array<float,2>{0.0241879411f, 0.022729056f},
-std::array<float,2>{0.645181179f, 0.901777387f},
-std::array<float,2>{0.333430171f, 0.689553022f},
-std::array<float,2>{0.843826234f, 0.459071308f},
-std::array<float,2>{0.44346723f, 0.358789951f},
-std::array<float,2>{0.938961029f, 0.552228987f},
-std::array<float,2>{0.195353374f, 0.789215028f},
-std::array<float,2>{0.570465207f, 0.149565727f},
-std::array<float,2>{0.156039387f, 0.384900719f},
-std::array<float,2>{0.55627805f, 0.630156338f},
-std::array<float,2>{0.412524998f, 0.988478899f},
-std::array<float,2>{0.889416099f, 0.119264528f},
-std::array<float,2>{0.295570403f, 0.209536016f},
-std::array<float,2>{0.806007385f, 0.874943435f},
-std::array<float,2>{0.0886062458f, 0.606815219f},
-std::array<float,2>{0.691760778f, 0.311050504f},
-std::array<float,2>{0.0714255348f, 0.237284616f},
-std::array<float,2>{0.71576649f, 0.824205518f},
-std::array<float,2>{0.312135786f, 0.563702047f},
-std::array<float,2>{0.796397805f, 0.262906879f},
-std::array<float,2>{0.42540881f, 0.428252727f},
-std::array<float,2>{0.896488607f, 0.665972173f},
-std::array<float,2>{0.130467966f, 0.960994899f},
-std::array<float,2>{0.545584619f, 0.0664202198f},
-std::array<float,2>{0.215484247f, 0.323224843f},
-std::array<float,2>{0.579859614f, 0.505031168f},
-std::array<float,2>{0.455629081f, 0.751263738f},
-std::array<float,2>{0.968246102f, 0.162458524f},
-std::array<float,2>{0.313245535f, 0.0494274795f},
-std::array<float,2>{0.869856119f, 0.93124038f},
-std::array<float,2>{0.00190237712f, 0.740980327f},
-std::array<float,2>{0.634160399f, 0.496492654f},
-std::array<float,2>{0.176275507f, 0.102026626f},
-std::array<float,2>{0.528306305f, 0.975316644f},
-std::array<float,2>{0.377364844f, 0.651702344f},
-std::array<float,2>{0.935517013f, 0.392292023f},
-std::array<float,2>{0.258909732f, 0.288179398f},
-std::array<float,2>{0.774777055f, 0.611737788f},
-std::array<float,2>{0.101268098f, 0.849610388f},
-std::array<float,2>{0.744869709f, 0.201679081f},
-std::array<float,2>{0.033521872f, 0.449254572f},
-std::array<float,2>{0.679312289f, 0.703983665f},
-std::array<float,2>{0.351000875f, 0.886700511f},
-std::array<float,2>{0.833537579f, 0.0130559132f},
-std::array<float,2>{0.485007375f, 0.137135088f},
-std::array<float,2>{0.981741965f, 0.807258964f},
-std::array<float,2>{0.221023336f, 0.538036823f},
-std::array<float,2>{0.617466092f, 0.374087214f},
-std::array<float,2>{0.13300465f, 0.190071985f},
-std::array<float,2>{0.532662809f, 0.851815879f},
-std::array<float,2>{0.434442848f, 0.61963439f},
-std::array<float,2>{0.900575817f, 0.294956237f},
-std::array<float,2>{0.302535594f, 0.40350759f},
-std::array<float,2>{0.78845644f, 0.645653546f},
-std::array<float,2>{0.063270621f, 0.979207993f},
-std::array<float,2>{0.704787612f, 0.0964185968f},
-std::array<float,2>{0.0120730652f, 0.364982277f},
-std::array<float,2>{0.628275633f, 0.546179235f},
-std::array<float,2>{0.321684003f, 0.797745407f},
-std::array<float,2>{0.859603703f, 0.126663581f},
-std::array<float,2>{0.465991318f, 0.00602347637f},
-std::array<float,2>{0.95404911f, 0.878143489f},
-std::array<float,2>{0.203995943f, 0.711970568f},
-std::array<float,2>{0.586676657f, 0.440823913f},
-std::array<float,2>{0.102025419f, 0.0711709857f},
-std::array<float,2>{0.737708867f, 0.95468545f},
-std::array<float,2>{0.254832834f, 0.659810603f},
-std::array<float,2>{0.772354722f, 0.435884953f},
-std::array<float,2>{0.384099036f, 0.250970751f},
-std::array<float,2>{0.92522794f, 0.577369273f},
-std::array<float,2>{0.184906498f, 0.815803647f},
-std::array<float,2>{0.522401214f, 0.244061068f},
-std::array<float,2>{0.232195318f, 0.490063995f},
-std::array<float,2>{0.610827982f, 0.747574151f},
-std::array<float,2>{0.498774052f, 0.924368978f},
-std::array<float,2>{0.970499694f, 0.0582057163f},
-std::array<float,2>{0.355493784f, 0.167560741f},
-std::array<float,2>{0.841530085f, 0.761845827f},
-std::array<float,2>{0.0430488475f, 0.513829768f},
-std::array<float,2>{0.68041116f, 0.320307612f},
-std::array<float,2>{0.0566516295f, 0.145299613f},
-std::array<float,2>{0.656494975f, 0.784595907f},
-std::array<float,2>{0.362195104f, 0.554726422f},
-std::array<float,2>{0.826841474f, 0.347795635f},
-std::array<float,2>{0.473526865f, 0.464812875f},
-std::array<float,2>{0.985929608f, 0.699508548f},
-std::array<float,2>{0.237794578f, 0.895467162f},
-std::array<float,2>{0.60102272f, 0.0289405286f},
-std::array<float,2>{0.167033732f, 0.303450882f},
-std::array<float,2>{0.511076272f, 0.599525034f},
-std::array<float,2>{0.401799589f, 0.861620247f},
-std::array<float,2>{0.913919628f, 0.211480677f},
-std::array<float,2>{0.273572266f, 0.116259433f},
-std::array<float,2>{0.764014482f, 0.996943057f},
-std::array<float,2>{0.123745911f, 0.635122061f},
-std::array<float,2>{0.725699544f, 0.380344927f},
-std::array<float,2>{0.19116427f, 0.0428667143f},
-std::array<float,2>{0.565671504f, 0.920697927f},
-std::array<float,2>{0.449386925f, 0.719711304f},
-std::array<float,2>{0.947013676f, 0.48215282f},
-std::array<float,2>{0.339619875f, 0.339820623f},
-std::array<float,2>{0.8539958f, 0.528294683f},
-std::array<float,2>{0.0180542413f, 0.777156651f},
-std::array<float,2>{0.655005097f, 0.1802589f},
-std::array<float,2>{0.0848548785f, 0.417979032f},
-std::array<float,2>{0.695926666f, 0.680322886f},
-std::array<float,2>{0.287267953f, 0.948807418f},
-std::array<float,2>{0.800175369f, 0.0916664302f},
-std::array<float,2>{0.417536765f, 0.22567445f},
-std::array<float,2>{0.8772403f, 0.828388631f},
-std::array<float,2>{0.143781528f, 0.583211958f},
-std::array<float,2>{0.547933817f, 0.269197077f},
-std::array<float,2>{0.16231063f, 0.13124302f},
-std::array<float,2>{0.505608678f, 0.80197072f},
-std::array<float,2>{0.396224469f, 0.541122317f},
-std::array<float,2>{0.918134391f, 0.359899372f},
-std::array<float,2>{0.272294015f, 0.443268478f},
-std::array<float,2>{0.751726508f, 0.717550933f},
-std::array<float,2>{0.109905861f, 0.882680595f},
-std::array<float,2>{0.72844851f, 0.000453343935f},
-std::array<float,2>{0.0507071167f, 0.291700751f},
-std::array<float,2>{0.67161274f, 0.622118413f},
-std::array<float,2>{0.374938905f, 0.856914759f},
-std::array<float,2>{0.812654257f, 0.194722801f},
-std::array<float,2>{0.47713092f, 0.100142315f},
-std::array<float,2>{0.997328937f, 0.98361516f},
-std::array<float,2>{0.247622713f, 0.643151641f},
-std::array<float,2>{0.60611856f, 0.401139677f},
-std::array<float,2>{0.0911036879f, 0.0615433343f},
-std::array<float,2>{0.688717186f, 0.928378999f},
-std::array<float,2>{0.292253315f, 0.744204521f},
-std::array<float,2>{0.809826195f, 0.486890674f},
-std::array<float,2>{0.407318383f, 0.314161927f},
-std::array<float,2>{0.883480847f, 0.511009455f},
-std::array<float,2>{0.149165779f, 0.760865808f},
-std::array<float,2>{0.560939789f, 0.170487612f},
-std::array<float,2>{0.201109782f, 0.43305707f},
-std::array<float,2>{0.575041711f, 0.661767781f},
-std::array<float,2>{0.438149065f, 0.958011568f},
-std::array<float,2>{0.943359554f, 0.074938938f},
-std::array<float,2>{0.32870698f, 0.24718152f},
-std::array<float,2>{0.850598395f, 0.819176018f},
-std::array<float,2>{0.0311828572f, 0.570652068f},
-std::array<float,2>{0.643402159f, 0.255104989f},
-std::array<float,2>{0.00449871272f, 0.218124792f},
-std::array<float,2>{0.640019655f, 0.866823912f},
-std::array<float,2>{0.318324924f, 0.59738946f},
-std::array<float,2>{0.872529626f, 0.297270685f},
-std::array<float,2>{0.458996147f, 0.375500441f},
-std::array<float,2>{0.963871896f, 0.640268683f},
-std::array<float,2>{0.214475602f, 0.993261874f},
-std::array<float,2>{0.582862914f, 0.111525618f},
-std::array<float,2>{0.125582099f, 0.345352739f},
-std::array<float,2>{0.539703369f, 0.561511576f},
-std::array<float,2>{0.429103822f, 0.786734223f},
-std::array<float,2>{0.891216874f, 0.140795171f},
-std::array<float,2>{0.308468312f, 0.0267253369f},
-std::array<float,2>{0.792111695f, 0.892767012f},
-std::array<float,2>{0.074788101f, 0.69901967f},
-std::array<float,2>{0.71294415f, 0.465947479f},
-std::array<float,2>{0.223986641f, 0.0868048072f},
-std::array<float,2>{0.621680021f, 0.952850461f},
-std::array<float,2>{0.488653809f, 0.683910906f},
-std::array<float,2>{0.977370203f, 0.415410519f},
-std::array<float,2>{0.344128013f, 0.269962907f},
-std::array<float,2>{0.829469919f, 0.578323424f},
-std::array<float,2>{0.0362246633f, 0.834244967f},
-std::array<float,2>{0.673606992f, 0.220188349f},
-std::array<float,2>{0.0943934917f, 0.478732377f},
-std::array<float,2>{0.748136878f, 0.725263178f},
-std::array<float,2>{0.2638053f, 0.917193651f},
-std::array<float,2>{0.780919731f, 0.0455879718f},
-std::array<float,2>{0.380424529f, 0.187054217f},
-std::array<float,2>{0.93281889f, 0.779008925f},
-std::array<float,2>{0.173083931f, 0.527099311f},
-std::array<float,2>{0.525656939f, 0.343518585f},
-std::array<float,2>{0.209061757f, 0.22812216f},
-std::array<float,2>{0.591261506f, 0.842784405f},
-std::array<float,2>{0.464102328f, 0.592774928f},
-std::array<float,2>{0.960361063f, 0.278008789f},
-std::array<float,2>{0.325134367f, 0.412577838f},
-std::array<float,2>{0.866390586f, 0.677666008f},
-std::array<float,2>{0.00866580475f, 0.942675054f},
-std::array<float,2>{0.630333841f, 0.078647092f},
-std::array<float,2>{0.0678517744f, 0.334246963f},
-std::array<float,2>{0.70880425f, 0.515915692f},
-std::array<float,2>{0.299640983f, 0.77191025f},
-std::array<float,2>{0.78224349f, 0.17554687f},
-std::array<float,2>{0.432951897f, 0.0330858454f},
-std::array<float,2>{0.905397296f, 0.911371469f},
-std::array<float,2>{0.136887386f, 0.72755748f},
-std::array<float,2>{0.535267591f, 0.472131252f},
-std::array<float,2>{0.0425630435f, 0.12214078f},
-std::array<float,2>{0.685602009f, 0.986088037f},
-std::array<float,2>{0.352268487f, 0.625964582f},
-std::array<float,2>{0.838733912f, 0.389546931f},
-std::array<float,2>{0.493788868f, 0.306557149f},
-std::array<float,2>{0.973894417f, 0.604014933f},
-std::array<float,2>{0.226718798f, 0.868127227f},
-std::array<float,2>{0.613565981f, 0.203193501f},
-std::array<float,2>{0.182956532f, 0.455685467f},
-std::array<float,2>{0.517876267f, 0.692728341f},
-std::array<float,2>{0.389806122f, 0.902827799f},
-std::array<float,2>{0.926047802f, 0.0161922481f},
-std::array<float,2>{0.253742933f, 0.153682992f},
-std::array<float,2>{0.76651758f, 0.795864105f},
-std::array<float,2>{0.105883852f, 0.547950625f},
-std::array<float,2>{0.740099072f, 0.355038643f},
-std::array<float,2>{0.12004444f, 0.157144755f},
-std::array<float,2>{0.720349193f, 0.756461382f},
-std::array<float,2>{0.279247046f, 0.50203681f},
-std::array<float,2>{0.758786619f, 0.324383318f},
-std::array<float,2>{0.405305445f, 0.495527685f},
-std::array<float,2>{0.908771694f, 0.735602617f},
-std::array<float,2>{0.171638608f, 0.935037911f},
-std::array<float,2>{0.513702273f, 0.0529665649f},
-std::array<float,2>{0.238598049f, 0.259173661f},
-std::array<float,2>{0.59652108f, 0.567236304f},
-std::array<float,2>{0.469763398f, 0.824663818f},
-std::array<float,2>{0.992067814f, 0.240393281f},
-std::array<float,2>{0.365652889f, 0.0640695393f},
-std::array<float,2>{0.820643306f, 0.967227042f},
-std::array<float,2>{0.060837809f, 0.671425939f},
-std::array<float,2>{0.662427247f, 0.422544956f},
-std::array<float,2>{0.144976303f, 0.011149683f},
-std::array<float,2>{0.55310142f, 0.888887107f},
-std::array<float,2>{0.418099672f, 0.709690452f},
-std::array<float,2>{0.880722106f, 0.448933631f},
-std::array<float,2>{0.283319324f, 0.369449168f},
-std::array<float,2>{0.801627696f, 0.534516752f},
-std::array<float,2>{0.0811217204f, 0.811753571f},
-std::array<float,2>{0.699802339f, 0.133965075f},
-std::array<float,2>{0.0217628349f, 0.395294458f},
-std::array<float,2>{0.649150729f, 0.654695034f},
-std::array<float,2>{0.341647774f, 0.968867481f},
-std::array<float,2>{0.8574453f, 0.107101396f},
-std::array<float,2>{0.448415905f, 0.196120843f},
-std::array<float,2>{0.952149153f, 0.84542799f},
-std::array<float,2>{0.193688184f, 0.613486886f},
-std::array<float,2>{0.569226563f, 0.28409332f},
-std::array<float,2>{0.197291777f, 0.151931122f},
-std::array<float,2>{0.574140549f, 0.791781425f},
-std::array<float,2>{0.443356872f, 0.553696334f},
-std::array<float,2>{0.941350937f, 0.356542498f},
-std::array<float,2>{0.335516602f, 0.458722889f},
-std::array<float,2>{0.846829355f, 0.687756479f},
-std::array<float,2>{0.0272040982f, 0.899374723f},
-std::array<float,2>{0.648221135f, 0.0212312136f},
-std::array<float,2>{0.0874493271f, 0.309337288f},
-std::array<float,2>{0.694362819f, 0.607987702f},
-std::array<float,2>{0.293197006f, 0.872476459f},
-std::array<float,2>{0.806716084f, 0.20797877f},
-std::array<float,2>{0.411184669f, 0.117608882f},
-std::array<float,2>{0.886757612f, 0.991203964f},
-std::array<float,2>{0.15284887f, 0.632122815f},
-std::array<float,2>{0.5575068f, 0.383040339f},
-std::array<float,2>{0.0525950193f, 0.0376168862f},
-std::array<float,2>{0.666728735f, 0.907716811f},
-std::array<float,2>{0.367477238f, 0.733988106f},
-std::array<float,2>{0.816686869f, 0.475921661f},
-std::array<float,2>{0.482412308f, 0.331695557f},
-std::array<float,2>{0.99456203f, 0.519669294f},
-std::array<float,2>{0.245614678f, 0.76597923f},
-std::array<float,2>{0.603741407f, 0.177467629f},
-std::array<float,2>{0.158280402f, 0.406819224f},
-std::array<float,2>{0.501955867f, 0.675199687f},
-std::array<float,2>{0.394162476f, 0.940585017f},
-std::array<float,2>{0.917707145f, 0.0840385407f},
-std::array<float,2>{0.266200215f, 0.231473356f},
-std::array<float,2>{0.757550359f, 0.839063346f},
-std::array<float,2>{0.113454998f, 0.589122891f},
-std::array<float,2>{0.73195219f, 0.27421084f},
-std::array<float,2>{0.0983832553f, 0.199945807f},
-std::array<float,2>{0.74383986f, 0.849022567f},
-std::array<float,2>{0.261136264f, 0.610423446f},
-std::array<float,2>{0.775525153f, 0.286766499f},
-std::array<float,2>{0.375758737f, 0.394147128f},
-std::array<float,2>{0.935964108f, 0.648685038f},
-std::array<float,2>{0.179103747f, 0.973539472f},
-std::array<float,2>{0.530364394f, 0.104567677f},
-std::array<float,2>{0.219373003f, 0.37198478f},
-std::array<float,2>{0.620431066f, 0.535562336f},
-std::array<float,2>{0.486879379f, 0.80497849f},
-std::array<float,2>{0.982930303f, 0.139357328f},
-std::array<float,2>{0.348798454f, 0.0145845478f},
-std::array<float,2>{0.834904194f, 0.883146405f},
-std::array<float,2>{0.0317032561f, 0.70556426f},
-std::array<float,2>{0.676412165f, 0.451452583f},
-std::array<float,2>{0.130918518f, 0.0702825189f},
-std::array<float,2>{0.543275595f, 0.964244664f},
-std::array<float,2>{0.422584325f, 0.666929185f},
-std::array<float,2>{0.895932734f, 0.425876349f},
-std::array<float,2>{0.309935242f, 0.264285892f},
-std::array<float,2>{0.793221116f, 0.566343129f},
-std::array<float,2>{0.0732170045f, 0.821987152f},
-std::array<float,2>{0.718384087f, 0.234726951f},
-std::array<float,2>{0.00385466171f, 0.499197125f},
-std::array<float,2>{0.635766566f, 0.739701807f},
-std::array<float,2>{0.314902961f, 0.931807518f},
-std::array<float,2>{0.867573917f, 0.0473479927f},
-std::array<float,2>{0.454913735f, 0.161635384f},
-std::array<float,2>{0.965041637f, 0.752829731f},
-std::array<float,2>{0.217614934f, 0.506533921f},
-std::array<float,2>{0.580518425f, 0.321531653f},
-std::array<float,2>{0.18610096f, 0.244176343f},
-std::array<float,2>{0.519931853f, 0.81342715f},
-std::array<float,2>{0.38488999f, 0.576038957f},
-std::array<float,2>{0.923278272f, 0.252682805f},
-std::array<float,2>{0.25593701f, 0.435527295f},
-std::array<float,2>{0.770139396f, 0.656464219f},
-std::array<float,2>{0.104603387f, 0.956558645f},
-std::array<float,2>{0.734693229f, 0.0733201206f},
-std::array<float,2>{0.0451525785f, 0.316637844f},
-std::array<float,2>{0.68310076f, 0.512417436f},
-std::array<float,2>{0.359067142f, 0.764642358f},
-std::array<float,2>{0.842030466f, 0.164599523f},
-std::array<float,2>{0.496524483f, 0.0547712892f},
-std::array<float,2>{0.972433209f, 0.922734737f},
-std::array<float,2>{0.233492002f, 0.748187363f},
-std::array<float,2>{0.611819685f, 0.490358651f},
-std::array<float,2>{0.0662785321f, 0.0945397839f},
-std::array<float,2>{0.705647826f, 0.978111446f},
-std::array<float,2>{0.303480715f, 0.647958696f},
-std::array<float,2>{0.785758913f, 0.405319273f},
-std::array<float,2>{0.43572253f, 0.294417322f},
-std::array<float,2>{0.899587929f, 0.618569076f},
-std::array<float,2>{0.136467606f, 0.854127884f},
-std::array<float,2>{0.534996212f, 0.189245865f},
-std::array<float,2>{0.20526737f, 0.439295799f},
-std::array<float,2>{0.58812356f, 0.71303165f},
-std::array<float,2>{0.467613578f, 0.876242459f},
-std::array<float,2>{0.955738664f, 0.00546448398f},
-std::array<float,2>{0.322853118f, 0.12890467f},
-std::array<float,2>{0.861379325f, 0.799944401f},
-std::array<float,2>{0.0154877203f, 0.543385983f},
-std::array<float,2>{0.625465333f, 0.365641832f},
-std::array<float,2>{0.0172558185f, 0.183241859f},
-std::array<float,2>{0.652822733f, 0.774388134f},
-std::array<float,2>{0.336866468f, 0.530713916f},
-std::array<float,2>{0.853154123f, 0.336027235f},
-std::array<float,2>{0.45178771f, 0.482547671f},
-std::array<float,2>{0.948430061f, 0.721526921f},
-std::array<float,2>{0.188049182f, 0.918172181f},
-std::array<float,2>{0.56279999f, 0.0399827771f},
-std::array<float,2>{0.14119418f, 0.266956866f},
-std::array<float,2>{0.549368083f, 0.585752547f},
-std::array<float,2>{0.414892703f, 0.831328154f},
-std::array<float,2>{0.876029611f, 0.223299697f},
-std::array<float,2>{0.285210937f, 0.0925791636f},
-std::array<float,2>{0.797972381f, 0.945416629f},
-std::array<float,2>{0.0823723003f, 0.682089984f},
-std::array<float,2>{0.697958529f, 0.421673208f},
-std::array<float,2>{0.234930679f, 0.0309970118f},
-std::array<float,2>{0.598080993f, 0.898120224f},
-std::array<float,2>{0.475078583f, 0.701415181f},
-std::array<float,2>{0.987257421f, 0.461293757f},
-std::array<float,2>{0.359852076f, 0.350513905f},
-std::array<float,2>{0.825922787f, 0.556957722f},
-std::array<float,2>{0.0558128469f, 0.781503797f},
-std::array<float,2>{0.658524096f, 0.147352606f},
-std::array<float,2>{0.122378618f, 0.38230294f},
-std::array<float,2>{0.723888099f, 0.634521842f},
-std::array<float,2>{0.275836945f, 0.999937952f},
-std::array<float,2>{0.761749685f, 0.115102619f},
-std::array<float,2>{0.400263458f, 0.214165702f},
-std::array<float,2>{0.911359668f, 0.859614909f},
-std::array<float,2>{0.164362207f, 0.600048959f},
-std::array<float,2>{0.508915603f, 0.302410841f},
-std::array<float,2>{0.151841253f, 0.168382406f},
-std::array<float,2>{0.560359657f, 0.758401513f},
-std::array<float,2>{0.408450156f, 0.508052766f},
-std::array<float,2>{0.884937525f, 0.314522773f},
-std::array<float,2>{0.290029854f, 0.484860748f},
-std::array<float,2>{0.811660886f, 0.742812812f},
-std::array<float,2>{0.0923564807f, 0.926139534f},
-std::array<float,2>{0.689854026f, 0.0592692904f},
-std::array<float,2>{0.0278387573f, 0.256002784f},
-std::array<float,2>{0.640717328f, 0.572366476f},
-std::array<float,2>{0.330352992f, 0.817688644f},
-std::array<float,2>{0.848138154f, 0.249715775f},
-std::array<float,2>{0.439771146f, 0.0773523077f},
-std::array<float,2>{0.943126082f, 0.959258854f},
-std::array<float,2>{0.202529863f, 0.66391027f},
-std::array<float,2>{0.576179862f, 0.43161869f},
-std::array<float,2>{0.112303533f, 0.00209792657f},
-std::array<float,2>{0.728742898f, 0.879241645f},
-std::array<float,2>{0.271413505f, 0.715443194f},
-std::array<float,2>{0.753598154f, 0.444896221f},
-std::array<float,2>{0.396789163f, 0.361780882f},
-std::array<float,2>{0.920201421f, 0.539505422f},
-std::array<float,2>{0.161553398f, 0.803654313f},
-std::array<float,2>{0.506639302f, 0.129357785f},
-std::array<float,2>{0.248317704f, 0.40035516f},
-std::array<float,2>{0.607944965f, 0.641712189f},
-std::array<float,2>{0.480277568f, 0.981382906f},
-std::array<float,2>{0.999430656f, 0.099148348f},
-std::array<float,2>{0.371341199f, 0.191539019f},
-std::array<float,2>{0.815741658f, 0.8591066f},
-std::array<float,2>{0.0474240705f, 0.62341845f},
-std::array<float,2>{0.668173432f, 0.289745152f},
-std::array<float,2>{0.0385017991f, 0.221039504f},
-std::array<float,2>{0.674637198f, 0.833214104f},
-std::array<float,2>{0.345770746f, 0.580890894f},
-std::array<float,2>{0.831510425f, 0.272381127f},
-std::array<float,2>{0.490416855f, 0.417303473f},
-std::array<float,2>{0.978866518f, 0.686778247f},
-std::array<float,2>{0.224896073f, 0.949297428f},
-std::array<float,2>{0.62445879f, 0.0888062268f},
-std::array<float,2>{0.174556389f, 0.341581851f},
-std::array<float,2>{0.523947775f, 0.525390089f},
-std::array<float,2>{0.381051362f, 0.779671192f},
-std::array<float,2>{0.930354238f, 0.184423134f},
-std::array<float,2>{0.262460321f, 0.0445995182f},
-std::array<float,2>{0.777784109f, 0.914176226f},
-std::array<float,2>{0.0959551409f, 0.723551512f},
-std::array<float,2>{0.746125579f, 0.477247566f},
-std::array<float,2>{0.21147503f, 0.110962644f},
-std::array<float,2>{0.584767938f, 0.99602139f},
-std::array<float,2>{0.457185894f, 0.638085246f},
-std::array<float,2>{0.962459862f, 0.377439946f},
-std::array<float,2>{0.319242269f, 0.299615592f},
-std::array<float,2>{0.873971701f, 0.595291615f},
-std::array<float,2>{0.00725199282f, 0.864490211f},
-std::array<float,2>{0.638196945f, 0.214930907f},
-std::array<float,2>{0.0776287615f, 0.468401581f},
-std::array<float,2>{0.712095618f, 0.69685328f},
-std::array<float,2>{0.306271911f, 0.891171038f},
-std::array<float,2>{0.790042222f, 0.0241385046f},
-std::array<float,2>{0.42748788f, 0.143189579f},
-std::array<float,2>{0.893529952f, 0.788951993f},
-std::array<float,2>{0.127329856f, 0.558782756f},
-std::array<float,2>{0.542219818f, 0.346552312f},
-std::array<float,2>{0.229012713f, 0.205658823f},
-std::array<float,2>{0.615993738f, 0.870731413f},
-std::array<float,2>{0.495089233f, 0.602717221f},
-std::array<float,2>{0.976506829f, 0.307038486f},
-std::array<float,2>{0.355437666f, 0.388343841f},
-std::array<float,2>{0.836700261f, 0.628304482f},
-std::array<float,2>{0.0406001918f, 0.987179875f},
-std::array<float,2>{0.684647381f, 0.12468607f},
-std::array<float,2>{0.107623324f, 0.352043778f},
-std::array<float,2>{0.741771638f, 0.549294353f},
-std::array<float,2>{0.250628233f, 0.79445821f},
-std::array<float,2>{0.768186748f, 0.155837163f},
-std::array<float,2>{0.387074381f, 0.0188818127f},
-std::array<float,2>{0.929261625f, 0.905096531f},
-std::array<float,2>{0.181231201f, 0.694516003f},
-std::array<float,2>{0.516796291f, 0.454882056f},
-std::array<float,2>{0.0108675854f, 0.0803728923f},
-std::array<float,2>{0.632289946f, 0.944916844f},
-std::array<float,2>{0.326841176f, 0.677969337f},
-std::array<float,2>{0.864792764f, 0.410620838f},
-std::array<float,2>{0.462468803f, 0.279629171f},
-std::array<float,2>{0.95890522f, 0.590237617f},
-std::array<float,2>{0.208451018f, 0.839876592f},
-std::array<float,2>{0.593231499f, 0.230466709f},
-std::array<float,2>{0.140194237f, 0.46904552f},
-std::array<float,2>{0.537126184f, 0.730256855f},
-std::array<float,2>{0.431060076f, 0.913970828f},
-std::array<float,2>{0.903555632f, 0.0350735262f},
-std::array<float,2>{0.298638314f, 0.172811627f},
-std::array<float,2>{0.784081697f, 0.770543337f},
-std::array<float,2>{0.0699791536f, 0.518571556f},
-std::array<float,2>{0.710840702f, 0.332282692f},
-std::array<float,2>{0.0791903809f, 0.135148138f},
-std::array<float,2>{0.702897072f, 0.810514808f},
-std::array<float,2>{0.281772017f, 0.531811714f},
-std::array<float,2>{0.803464234f, 0.368415952f},
-std::array<float,2>{0.420401096f, 0.446701527f},
-std::array<float,2>{0.881612897f, 0.707638204f},
-std::array<float,2>{0.147114724f, 0.886975646f},
-std::array<float,2>{0.551236808f, 0.00848272908f},
-std::array<float,2>{0.193153143f, 0.281618357f},
-std::array<float,2>{0.567918658f, 0.61547637f},
-std::array<float,2>{0.447146654f, 0.845829666f},
-std::array<float,2>{0.951084673f, 0.197372377f},
-std::array<float,2>{0.341822863f, 0.107633494f},
-std::array<float,2>{0.857399106f, 0.971737087f},
-std::array<float,2>{0.0206048209f, 0.652575612f},
-std::array<float,2>{0.651793599f, 0.396510929f},
-std::array<float,2>{0.169515625f, 0.0509686619f},
-std::array<float,2>{0.513533235f, 0.936319292f},
-std::array<float,2>{0.403233975f, 0.738050401f},
-std::array<float,2>{0.906477928f, 0.492952973f},
-std::array<float,2>{0.279634893f, 0.326739907f},
-std::array<float,2>{0.759892166f, 0.500181198f},
-std::array<float,2>{0.119103931f, 0.754974782f},
-std::array<float,2>{0.721974969f, 0.15994212f},
-std::array<float,2>{0.0587228164f, 0.424457192f},
-std::array<float,2>{0.661758959f, 0.668980181f},
-std::array<float,2>{0.364716262f, 0.965455294f},
-std::array<float,2>{0.824028313f, 0.064823471f},
-std::array<float,2>{0.472405404f, 0.239688322f},
-std::array<float,2>{0.989342809f, 0.826872706f},
-std::array<float,2>{0.240491122f, 0.569681823f},
-std::array<float,2>{0.594613433f, 0.26137954f},
-std::array<float,2>{0.222513333f, 0.140025496f},
-std::array<float,2>{0.618784606f, 0.805804193f},
-std::array<float,2>{0.485485882f, 0.536674738f},
-std::array<float,2>{0.981115103f, 0.37297222f},
-std::array<float,2>{0.350466758f, 0.452476263f},
-std::array<float,2>{0.83204037f, 0.706126451f},
-std::array<float,2>{0.0346193165f, 0.884762108f},
-std::array<float,2>{0.678120971f, 0.015202594f},
-std::array<float,2>{0.10042493f, 0.285860568f},
-std::array<float,2>{0.745390296f, 0.609778285f},
-std::array<float,2>{0.258524418f, 0.848464072f},
-std::array<float,2>{0.773606718f, 0.201115772f},
-std::array<float,2>{0.378659397f, 0.103872113f},
-std::array<float,2>{0.933892608f, 0.974457622f},
-std::array<float,2>{0.17766349f, 0.649832666f},
-std::array<float,2>{0.528416336f, 0.393453151f},
-std::array<float,2>{0.000317196565f, 0.0481298827f},
-std::array<float,2>{0.633724093f, 0.933239102f},
-std::array<float,2>{0.313755959f, 0.738949716f},
-std::array<float,2>{0.870744407f, 0.498284668f},
-std::array<float,2>{0.456443727f, 0.320497692f},
-std::array<float,2>{0.966919899f, 0.507496595f},
-std::array<float,2>{0.216113061f, 0.753844798f},
-std::array<float,2>{0.578255773f, 0.160391256f},
-std::array<float,2>{0.12925221f, 0.427019954f},
-std::array<float,2>{0.546426117f, 0.667412162f},
-std::array<float,2>{0.424246907f, 0.963102043f},
-std::array<float,2>{0.89763552f, 0.0684121549f},
-std::array<float,2>{0.311405122f, 0.236241266f},
-std::array<float,2>{0.795279145f, 0.820894897f},
-std::array<float,2>{0.0710935071f, 0.564589262f},
-std::array<float,2>{0.716492593f, 0.265375316f},
-std::array<float,2>{0.0890999883f, 0.2088608f},
-std::array<float,2>{0.692421794f, 0.871784508f},
-std::array<float,2>{0.296289444f, 0.609255731f},
-std::array<float,2>{0.805596352f, 0.310115427f},
-std::array<float,2>{0.413647145f, 0.384556115f},
-std::array<float,2>{0.889995396f, 0.630931437f},
-std::array<float,2>{0.155067325f, 0.992082834f},
-std::array<float,2>{0.555116415f, 0.118505366f},
-std::array<float,2>{0.197006062f, 0.356300175f},
-std::array<float,2>{0.572182357f, 0.553723097f},
-std::array<float,2>{0.444885582f, 0.792312443f},
-std::array<float,2>{0.937879562f, 0.150707424f},
-std::array<float,2>{0.332285434f, 0.0198719949f},
-std::array<float,2>{0.845343471f, 0.899998307f},
-std::array<float,2>{0.0251313876f, 0.689008534f},
-std::array<float,2>{0.645911098f, 0.457305014f},
-std::array<float,2>{0.156729609f, 0.0855187327f},
-std::array<float,2>{0.500210464f, 0.940034628f},
-std::array<float,2>{0.392329842f, 0.674100041f},
-std::array<float,2>{0.915202081f, 0.40757674f},
-std::array<float,2>{0.268685013f, 0.275182635f},
-std::array<float,2>{0.754542232f, 0.588505089f},
-std::array<float,2>{0.116888218f, 0.838414013f},
-std::array<float,2>{0.73355341f, 0.230688706f},
-std::array<float,2>{0.0539790951f, 0.475399882f},
-std::array<float,2>{0.66583997f, 0.73298198f},
-std::array<float,2>{0.370953768f, 0.907100379f},
-std::array<float,2>{0.819090068f, 0.0388797112f},
-std::array<float,2>{0.484337986f, 0.175879568f},
-std::array<float,2>{0.993695498f, 0.76680243f},
-std::array<float,2>{0.243968323f, 0.520768106f},
-std::array<float,2>{0.602883935f, 0.330574661f},
-std::array<float,2>{0.143422052f, 0.224156961f},
-std::array<float,2>{0.547233403f, 0.830870509f},
-std::array<float,2>{0.41620779f, 0.584937692f},
-std::array<float,2>{0.878329456f, 0.266147077f},
-std::array<float,2>{0.288653851f, 0.420469552f},
-std::array<float,2>{0.79889828f, 0.683271646f},
-std::array<float,2>{0.0856023133f, 0.946635127f},
-std::array<float,2>{0.696693838f, 0.0932688192f},
-std::array<float,2>{0.0187494792f, 0.33779189f},
-std::array<float,2>{0.656003177f, 0.529577374f},
-std::array<float,2>{0.338179529f, 0.775169432f},
-std::array<float,2>{0.85449338f, 0.181852385f},
-std::array<float,2>{0.450309008f, 0.04019811f},
-std::array<float,2>{0.94615823f, 0.919058561f},
-std::array<float,2>{0.190396965f, 0.722434223f},
-std::array<float,2>{0.564949095f, 0.484328389f},
-std::array<float,2>{0.124937199f, 0.114146359f},
-std::array<float,2>{0.724713683f, 0.998847663f},
-std::array<float,2>{0.275241345f, 0.633144021f},
-std::array<float,2>{0.765472293f, 0.381348401f},
-std::array<float,2>{0.400970191f, 0.300943583f},
-std::array<float,2>{0.91260922f, 0.601380885f},
-std::array<float,2>{0.166756555f, 0.861012816f},
-std::array<float,2>{0.510347307f, 0.2129668f},
-std::array<float,2>{0.236843467f, 0.462676615f},
-std::array<float,2>{0.600316584f, 0.702509642f},
-std::array<float,2>{0.474244773f, 0.897169828f},
-std::array<float,2>{0.984590471f, 0.0296083f},
-std::array<float,2>{0.362427026f, 0.148149312f},
-std::array<float,2>{0.827293992f, 0.782342851f},
-std::array<float,2>{0.0577638447f, 0.557753265f},
-std::array<float,2>{0.657820404f, 0.350626886f},
-std::array<float,2>{0.0441436619f, 0.165336788f},
-std::array<float,2>{0.681434512f, 0.765541732f},
-std::array<float,2>{0.356756508f, 0.513002634f},
-std::array<float,2>{0.839938223f, 0.317692488f},
-std::array<float,2>{0.499031395f, 0.491363019f},
-std::array<float,2>{0.969597995f, 0.749099493f},
-std::array<float,2>{0.23078014f, 0.922930539f},
-std::array<float,2>{0.609516919f, 0.0562701635f},
-std::array<float,2>{0.184375927f, 0.253796607f},
-std::array<float,2>{0.523254216f, 0.574562669f},
-std::array<float,2>{0.383166045f, 0.813650727f},
-std::array<float,2>{0.924443364f, 0.245364219f},
-std::array<float,2>{0.255699426f, 0.0726539344f},
-std::array<float,2>{0.773104787f, 0.955539525f},
-std::array<float,2>{0.103319749f, 0.657878339f},
-std::array<float,2>{0.73641938f, 0.434279621f},
-std::array<float,2>{0.204244107f, 0.00399143342f},
-std::array<float,2>{0.587600887f, 0.87561512f},
-std::array<float,2>{0.465335578f, 0.713975608f},
-std::array<float,2>{0.954440534f, 0.438092858f},
-std::array<float,2>{0.320605636f, 0.36687991f},
-std::array<float,2>{0.861136794f, 0.544881463f},
-std::array<float,2>{0.0135504669f, 0.799661279f},
-std::array<float,2>{0.627625406f, 0.127262637f},
-std::array<float,2>{0.0644341633f, 0.40475741f},
-std::array<float,2>{0.703859627f, 0.647270143f},
-std::array<float,2>{0.300889909f, 0.977037311f},
-std::array<float,2>{0.787247658f, 0.0947668254f},
-std::array<float,2>{0.435513258f, 0.187874749f},
-std::array<float,2>{0.902185142f, 0.854973733f},
-std::array<float,2>{0.133970425f, 0.617306828f},
-std::array<float,2>{0.531555474f, 0.293118805f},
-std::array<float,2>{0.171893105f, 0.185525164f},
-std::array<float,2>{0.527265906f, 0.780293345f},
-std::array<float,2>{0.379166842f, 0.52437222f},
-std::array<float,2>{0.931706548f, 0.340088993f},
-std::array<float,2>{0.265016675f, 0.478105515f},
-std::array<float,2>{0.779563367f, 0.723650575f},
-std::array<float,2>{0.0956544727f, 0.915453315f},
-std::array<float,2>{0.749606133f, 0.0435547754f},
-std::array<float,2>{0.0360274091f, 0.272474498f},
-std::array<float,2>{0.672675967f, 0.581179619f},
-std::array<float,2>{0.345018983f, 0.83240819f},
-std::array<float,2>{0.828154206f, 0.222550586f},
-std::array<float,2>{0.490141362f, 0.0893125683f},
-std::array<float,2>{0.977778018f, 0.951032281f},
-std::array<float,2>{0.223461881f, 0.686430514f},
-std::array<float,2>{0.622170389f, 0.416833788f},
-std::array<float,2>{0.0756249651f, 0.0244848672f},
-std::array<float,2>{0.714606524f, 0.892504334f},
-std::array<float,2>{0.307153165f, 0.696130693f},
-std::array<float,2>{0.791661918f, 0.467731565f},
-std::array<float,2>{0.42827341f, 0.347135633f},
-std::array<float,2>{0.891731679f, 0.559884667f},
-std::array<float,2>{0.126154959f, 0.787913144f},
-std::array<float,2>{0.540292859f, 0.143819183f},
-std::array<float,2>{0.213044733f, 0.378682375f},
-std::array<float,2>{0.583157778f, 0.636985838f},
-std::array<float,2>{0.460105151f, 0.994569182f},
-std::array<float,2>{0.963652492f, 0.110249378f},
-std::array<float,2>{0.316932589f, 0.216130614f},
-std::array<float,2>{0.871311367f, 0.863974512f},
-std::array<float,2>{0.00548353372f, 0.594290972f},
-std::array<float,2>{0.639134049f, 0.300026625f},
-std::array<float,2>{0.0297678113f, 0.248567507f},
-std::array<float,2>{0.644306779f, 0.816484332f},
-std::array<float,2>{0.330019504f, 0.57366997f},
-std::array<float,2>{0.849885523f, 0.257000685f},
-std::array<float,2>{0.438669622f, 0.430269241f},
-std::array<float,2>{0.944637656f, 0.66294539f},
-std::array<float,2>{0.19979319f, 0.960819364f},
-std::array<float,2>{0.575274706f, 0.0768872947f},
-std::array<float,2>{0.149773359f, 0.31632641f},
-std::array<float,2>{0.562253892f, 0.509659529f},
-std::array<float,2>{0.40646401f, 0.759343505f},
-std::array<float,2>{0.883880138f, 0.169749364f},
-std::array<float,2>{0.291110247f, 0.0598135106f},
-std::array<float,2>{0.809444308f, 0.92736721f},
-std::array<float,2>{0.0900347382f, 0.743701518f},
-std::array<float,2>{0.688003361f, 0.485432595f},
-std::array<float,2>{0.246978134f, 0.0977549925f},
-std::array<float,2>{0.607165635f, 0.981463909f},
-std::array<float,2>{0.477774143f, 0.641322792f},
-std::array<float,2>{0.996657848f, 0.398518592f},
-std::array<float,2>{0.373704433f, 0.290895879f},
-std::array<float,2>{0.81388694f, 0.624902904f},
-std::array<float,2>{0.0495262817f, 0.857884884f},
-std::array<float,2>{0.67039907f, 0.193339661f},
-std::array<float,2>{0.111164667f, 0.443847001f},
-std::array<float,2>{0.727489591f, 0.716660798f},
-std::array<float,2>{0.272863179f, 0.880680501f},
-std::array<float,2>{0.750238478f, 0.00374481105f},
-std::array<float,2>{0.395272583f, 0.130580127f},
-std::array<float,2>{0.919349849f, 0.803848445f},
-std::array<float,2>{0.163269445f, 0.540367305f},
-std::array<float,2>{0.504583776f, 0.362947077f},
-std::array<float,2>{0.194644719f, 0.198558778f},
-std::array<float,2>{0.570311129f, 0.847327769f},
-std::array<float,2>{0.447963595f, 0.616762578f},
-std::array<float,2>{0.951753914f, 0.282508999f},
-std::array<float,2>{0.340516329f, 0.397979289f},
-std::array<float,2>{0.858708441f, 0.653790295f},
-std::array<float,2>{0.0224642456f, 0.971326232f},
-std::array<float,2>{0.650167406f, 0.108584352f},
-std::array<float,2>{0.0805784464f, 0.367704988f},
-std::array<float,2>{0.700223804f, 0.532807112f},
-std::array<float,2>{0.284319252f, 0.809500039f},
-std::array<float,2>{0.802683711f, 0.136016175f},
-std::array<float,2>{0.419206083f, 0.00885429978f},
-std::array<float,2>{0.87915802f, 0.888410866f},
-std::array<float,2>{0.145571932f, 0.708433032f},
-std::array<float,2>{0.553842127f, 0.445405215f},
-std::array<float,2>{0.0622101501f, 0.0657440573f},
-std::array<float,2>{0.663752556f, 0.966709316f},
-std::array<float,2>{0.366380274f, 0.668933392f},
-std::array<float,2>{0.82136929f, 0.425402373f},
-std::array<float,2>{0.469163358f, 0.260087013f},
-std::array<float,2>{0.990609288f, 0.568958223f},
-std::array<float,2>{0.239735916f, 0.827300549f},
-std::array<float,2>{0.596699238f, 0.23847279f},
-std::array<float,2>{0.170013174f, 0.493627191f},
-std::array<float,2>{0.51520133f, 0.736502945f},
-std::array<float,2>{0.404488117f, 0.93740505f},
-std::array<float,2>{0.909596086f, 0.0523012802f},
-std::array<float,2>{0.278274506f, 0.158387899f},
-std::array<float,2>{0.75962472f, 0.753931642f},
-std::array<float,2>{0.120510593f, 0.501742184f},
-std::array<float,2>{0.718860149f, 0.327157408f},
-std::array<float,2>{0.107156314f, 0.155169249f},
-std::array<float,2>{0.73908031f, 0.793621659f},
-std::array<float,2>{0.252783895f, 0.550537586f},
-std::array<float,2>{0.767486811f, 0.353144348f},
-std::array<float,2>{0.388762176f, 0.454072952f},
-std::array<float,2>{0.927729487f, 0.69427222f},
-std::array<float,2>{0.182473153f, 0.905661464f},
-std::array<float,2>{0.518965423f, 0.0177322179f},
-std::array<float,2>{0.228160307f, 0.307657212f},
-std::array<float,2>{0.614561975f, 0.601697743f},
-std::array<float,2>{0.492236793f, 0.869882822f},
-std::array<float,2>{0.972709239f, 0.206694633f},
-std::array<float,2>{0.352696478f, 0.123536453f},
-std::array<float,2>{0.839031696f, 0.988221228f},
-std::array<float,2>{0.0412622951f, 0.627011657f},
-std::array<float,2>{0.686786056f, 0.387628794f},
-std::array<float,2>{0.138318196f, 0.0335539728f},
-std::array<float,2>{0.536892653f, 0.913051844f},
-std::array<float,2>{0.431703985f, 0.729009092f},
-std::array<float,2>{0.904774904f, 0.470070869f},
-std::array<float,2>{0.299897015f, 0.333938271f},
-std::array<float,2>{0.7814309f, 0.518288553f},
-std::array<float,2>{0.0670477971f, 0.770280659f},
-std::array<float,2>{0.707473695f, 0.172985554f},
-std::array<float,2>{0.00937908888f, 0.41164428f},
-std::array<float,2>{0.629261136f, 0.67900449f},
-std::array<float,2>{0.325997323f, 0.944295704f},
-std::array<float,2>{0.865465224f, 0.0817964748f},
-std::array<float,2>{0.463558197f, 0.229370609f},
-std::array<float,2>{0.959819615f, 0.841054082f},
-std::array<float,2>{0.210356325f, 0.59086287f},
-std::array<float,2>{0.590543032f, 0.280887961f},
-std::array<float,2>{0.218019262f, 0.163122773f},
-std::array<float,2>{0.58159852f, 0.750497997f},
-std::array<float,2>{0.454071581f, 0.504780591f},
-std::array<float,2>{0.966489553f, 0.323797822f},
-std::array<float,2>{0.316326618f, 0.497550875f},
-std::array<float,2>{0.868789613f, 0.741569161f},
-std::array<float,2>{0.00225583953f, 0.930365384f},
-std::array<float,2>{0.635423183f, 0.0499795079f},
-std::array<float,2>{0.0733956322f, 0.262426347f},
-std::array<float,2>{0.717579305f, 0.56294775f},
-std::array<float,2>{0.308648407f, 0.822447002f},
-std::array<float,2>{0.794386387f, 0.238252252f},
-std::array<float,2>{0.423066109f, 0.0679700747f},
-std::array<float,2>{0.895084143f, 0.962762058f},
-std::array<float,2>{0.131924927f, 0.664925277f},
-std::array<float,2>{0.544361591f, 0.429400831f},
-std::array<float,2>{0.0328590311f, 0.012028682f},
-std::array<float,2>{0.677463531f, 0.885041118f},
-std::array<float,2>{0.347922742f, 0.704441667f},
-std::array<float,2>{0.835378826f, 0.450787812f},
-std::array<float,2>{0.48753044f, 0.373803407f},
-std::array<float,2>{0.984342039f, 0.538970709f},
-std::array<float,2>{0.220275849f, 0.808499575f},
-std::array<float,2>{0.619910717f, 0.13792555f},
-std::array<float,2>{0.178496286f, 0.390895903f},
-std::array<float,2>{0.530268788f, 0.651019514f},
-std::array<float,2>{0.376334339f, 0.975991547f},
-std::array<float,2>{0.937228858f, 0.103466839f},
-std::array<float,2>{0.260040879f, 0.202565238f},
-std::array<float,2>{0.776969314f, 0.851261079f},
-std::array<float,2>{0.0995830595f, 0.612774849f},
-std::array<float,2>{0.742578149f, 0.287973106f},
-std::array<float,2>{0.115202762f, 0.233387962f},
-std::array<float,2>{0.731091082f, 0.836540878f},
-std::array<float,2>{0.26754573f, 0.586318374f},
-std::array<float,2>{0.756161988f, 0.277011365f},
-std::array<float,2>{0.392699003f, 0.408240855f},
-std::array<float,2>{0.916738749f, 0.673436403f},
-std::array<float,2>{0.159346968f, 0.937580347f},
-std::array<float,2>{0.503201067f, 0.0825117454f},
-std::array<float,2>{0.24498637f, 0.329385489f},
-std::array<float,2>{0.604667425f, 0.521536708f},
-std::array<float,2>{0.480966806f, 0.769394755f},
-std::array<float,2>{0.995185435f, 0.179686144f},
-std::array<float,2>{0.368289798f, 0.0368794687f},
-std::array<float,2>{0.81752938f, 0.909622967f},
-std::array<float,2>{0.0510303415f, 0.731542826f},
-std::array<float,2>{0.667835295f, 0.474061936f},
-std::array<float,2>{0.154080927f, 0.120135926f},
-std::array<float,2>{0.55836612f, 0.989506125f},
-std::array<float,2>{0.410259008f, 0.62911123f},
-std::array<float,2>{0.888257921f, 0.386486739f},
-std::array<float,2>{0.29446432f, 0.311626345f},
-std::array<float,2>{0.807672977f, 0.605751932f},
-std::array<float,2>{0.0864554048f, 0.873672426f},
-std::array<float,2>{0.694304407f, 0.210296974f},
-std::array<float,2>{0.0261638649f, 0.460297137f},
-std::array<float,2>{0.646592975f, 0.690954804f},
-std::array<float,2>{0.334440947f, 0.900406659f},
-std::array<float,2>{0.846499383f, 0.0215176679f},
-std::array<float,2>{0.441650838f, 0.149160475f},
-std::array<float,2>{0.940122724f, 0.790842772f},
-std::array<float,2>{0.198806286f, 0.550866902f},
-std::array<float,2>{0.572655559f, 0.357845753f},
-std::array<float,2>{0.165927112f, 0.212559134f},
-std::array<float,2>{0.508723557f, 0.862955809f},
-std::array<float,2>{0.399035901f, 0.598407328f},
-std::array<float,2>{0.910212696f, 0.303765297f},
-std::array<float,2>{0.276877314f, 0.378965139f},
-std::array<float,2>{0.762762427f, 0.635950804f},
-std::array<float,2>{0.121782295f, 0.997347295f},
-std::array<float,2>{0.722794533f, 0.115365632f},
-std::array<float,2>{0.0553030409f, 0.348840892f},
-std::array<float,2>{0.659981668f, 0.556193113f},
-std::array<float,2>{0.360505641f, 0.784080684f},
-std::array<float,2>{0.82440567f, 0.145917788f},
-std::array<float,2>{0.475638449f, 0.0274801254f},
-std::array<float,2>{0.987591803f, 0.895644963f},
-std::array<float,2>{0.235832617f, 0.700946391f},
-std::array<float,2>{0.599344313f, 0.463849097f},
-std::array<float,2>{0.0832145587f, 0.0903974548f},
-std::array<float,2>{0.698784292f, 0.948210776f},
-std::array<float,2>{0.287013113f, 0.681075454f},
-std::array<float,2>{0.796978176f, 0.419578791f},
-std::array<float,2>{0.415240794f, 0.268258572f},
-std::array<float,2>{0.875155449f, 0.582417071f},
-std::array<float,2>{0.141765594f, 0.82972151f},
-std::array<float,2>{0.550204575f, 0.225382239f},
-std::array<float,2>{0.188962445f, 0.481220156f},
-std::array<float,2>{0.564281583f, 0.720480084f},
-std::array<float,2>{0.452219069f, 0.921099961f},
-std::array<float,2>{0.948120952f, 0.0418274738f},
-std::array<float,2>{0.336953938f, 0.181621045f},
-std::array<float,2>{0.851753354f, 0.775669456f},
-std::array<float,2>{0.0164068174f, 0.529019058f},
-std::array<float,2>{0.653497875f, 0.338612944f},
-std::array<float,2>{0.0139806699f, 0.125968292f},
-std::array<float,2>{0.626418829f, 0.798125148f},
-std::array<float,2>{0.323330998f, 0.545583129f},
-std::array<float,2>{0.862345994f, 0.363925636f},
-std::array<float,2>{0.467830867f, 0.440073341f},
-std::array<float,2>{0.956165373f, 0.710992038f},
-std::array<float,2>{0.206434324f, 0.877514243f},
-std::array<float,2>{0.589529276f, 0.00742802955f},
-std::array<float,2>{0.135112688f, 0.295951903f},
-std::array<float,2>{0.533715129f, 0.620217621f},
-std::array<float,2>{0.436799437f, 0.853408635f},
-std::array<float,2>{0.899222136f, 0.191400096f},
-std::array<float,2>{0.304170191f, 0.0970808193f},
-std::array<float,2>{0.786443174f, 0.980218351f},
-std::array<float,2>{0.0653082058f, 0.644987345f},
-std::array<float,2>{0.7069754f, 0.40237084f},
-std::array<float,2>{0.233000606f, 0.0572252311f},
-std::array<float,2>{0.613227785f, 0.925046802f},
-std::array<float,2>{0.497608811f, 0.746539712f},
-std::array<float,2>{0.97122699f, 0.488447547f},
-std::array<float,2>{0.357821465f, 0.318862289f},
-std::array<float,2>{0.843043029f, 0.515085757f},
-std::array<float,2>{0.0459276401f, 0.762843311f},
-std::array<float,2>{0.682140708f, 0.166105613f},
-std::array<float,2>{0.104125485f, 0.437117845f},
-std::array<float,2>{0.736132562f, 0.658405185f},
-std::array<float,2>{0.257603347f, 0.953776658f},
-std::array<float,2>{0.770760834f, 0.07177753f},
-std::array<float,2>{0.386513144f, 0.242596954f},
-std::array<float,2>{0.922115266f, 0.814920545f},
-std::array<float,2>{0.187044337f, 0.576520562f},
-std::array<float,2>{0.520850062f, 0.251142919f},
-std::array<float,2>{0.12870793f, 0.142116174f},
-std::array<float,2>{0.541698277f, 0.785587728f},
-std::array<float,2>{0.42652756f, 0.562264204f},
-std::array<float,2>{0.894527495f, 0.344603866f},
-std::array<float,2>{0.304888368f, 0.465604812f},
-std::array<float,2>{0.789887547f, 0.697333515f},
-std::array<float,2>{0.0766439363f, 0.894463181f},
-std::array<float,2>{0.711204171f, 0.0256258305f},
-std::array<float,2>{0.00595403789f, 0.298412055f},
-std::array<float,2>{0.636971891f, 0.595710516f},
-std::array<float,2>{0.319439113f, 0.865495443f},
-std::array<float,2>{0.87442565f, 0.217520505f},
-std::array<float,2>{0.458011657f, 0.112702794f},
-std::array<float,2>{0.961380184f, 0.993068159f},
-std::array<float,2>{0.212118179f, 0.639198184f},
-std::array<float,2>{0.585524142f, 0.376404434f},
-std::array<float,2>{0.0969741791f, 0.0460435301f},
-std::array<float,2>{0.747852266f, 0.916321099f},
-std::array<float,2>{0.262873381f, 0.726205826f},
-std::array<float,2>{0.77910006f, 0.479664415f},
-std::array<float,2>{0.382720649f, 0.342731982f},
-std::array<float,2>{0.931007922f, 0.52592212f},
-std::array<float,2>{0.175492972f, 0.778045714f},
-std::array<float,2>{0.524641275f, 0.185563341f},
-std::array<float,2>{0.225932792f, 0.414478689f},
-std::array<float,2>{0.623630583f, 0.684571981f},
-std::array<float,2>{0.491769552f, 0.952043414f},
-std::array<float,2>{0.979515254f, 0.0872151405f},
-std::array<float,2>{0.347601175f, 0.218795449f},
-std::array<float,2>{0.830809712f, 0.834982574f},
-std::array<float,2>{0.0378038883f, 0.579364061f},
-std::array<float,2>{0.675028503f, 0.271377027f},
-std::array<float,2>{0.0486036427f, 0.193819687f},
-std::array<float,2>{0.669644177f, 0.855879664f},
-std::array<float,2>{0.373023361f, 0.621721089f},
-std::array<float,2>{0.815102398f, 0.292557806f},
-std::array<float,2>{0.478625625f, 0.402184516f},
-std::array<float,2>{0.998387873f, 0.644355834f},
-std::array<float,2>{0.249025404f, 0.983175874f},
-std::array<float,2>{0.609069526f, 0.101560824f},
-std::array<float,2>{0.160211593f, 0.361317903f},
-std::array<float,2>{0.507664263f, 0.542668998f},
-std::array<float,2>{0.398026347f, 0.801647127f},
-std::array<float,2>{0.921804786f, 0.131952599f},
-std::array<float,2>{0.270087004f, 0.00188348012f},
-std::array<float,2>{0.752360761f, 0.881629229f},
-std::array<float,2>{0.112748757f, 0.717877388f},
-std::array<float,2>{0.729810476f, 0.441530704f},
-std::array<float,2>{0.201823667f, 0.0761004165f},
-std::array<float,2>{0.577754319f, 0.957945645f},
-std::array<float,2>{0.441272438f, 0.660820425f},
-std::array<float,2>{0.941637814f, 0.432112426f},
-std::array<float,2>{0.331678361f, 0.254337192f},
-std::array<float,2>{0.849409699f, 0.571766078f},
-std::array<float,2>{0.0291853677f, 0.820069909f},
-std::array<float,2>{0.641827464f, 0.246942386f},
-std::array<float,2>{0.0937134027f, 0.487673908f},
-std::array<float,2>{0.691184819f, 0.745710611f},
-std::array<float,2>{0.290181696f, 0.929640651f},
-std::array<float,2>{0.810666919f, 0.0608619526f},
-std::array<float,2>{0.409670025f, 0.17108953f},
-std::array<float,2>{0.886247337f, 0.760575175f},
-std::array<float,2>{0.151210889f, 0.509998977f},
-std::array<float,2>{0.55897671f, 0.313459337f},
-std::array<float,2>{0.241929486f, 0.241254866f},
-std::array<float,2>{0.595631957f, 0.825673878f},
-std::array<float,2>{0.471431434f, 0.568170846f},
-std::array<float,2>{0.98909694f, 0.258476704f},
-std::array<float,2>{0.363751411f, 0.42376858f},
-std::array<float,2>{0.82288456f, 0.670856178f},
-std::array<float,2>{0.0602500737f, 0.968256056f},
-std::array<float,2>{0.660960793f, 0.0633993372f},
-std::array<float,2>{0.117530778f, 0.325797766f},
-std::array<float,2>{0.721144795f, 0.503540456f},
-std::array<float,2>{0.280278951f, 0.756849945f},
-std::array<float,2>{0.761501253f, 0.158074096f},
-std::array<float,2>{0.404128045f, 0.0542923287f},
-std::array<float,2>{0.908103526f, 0.93442744f},
-std::array<float,2>{0.168919459f, 0.734993994f},
-std::array<float,2>{0.512233734f, 0.494334549f},
-std::array<float,2>{0.0202674381f, 0.106242254f},
-std::array<float,2>{0.650713444f, 0.969978631f},
-std::array<float,2>{0.343279272f, 0.65610677f},
-std::array<float,2>{0.856443465f, 0.395675123f},
-std::array<float,2>{0.445896387f, 0.284715861f},
-std::array<float,2>{0.949413478f, 0.61456728f},
-std::array<float,2>{0.192182958f, 0.843763053f},
-std::array<float,2>{0.566974401f, 0.197077006f},
-std::array<float,2>{0.148407623f, 0.447315127f},
-std::array<float,2>{0.552042842f, 0.710471034f},
-std::array<float,2>{0.421408981f, 0.890106618f},
-std::array<float,2>{0.88222003f, 0.00981808733f},
-std::array<float,2>{0.282400519f, 0.13313289f},
-std::array<float,2>{0.804665387f, 0.810999274f},
-std::array<float,2>{0.0790290833f, 0.533612907f},
-std::array<float,2>{0.701216757f, 0.370358914f},
-std::array<float,2>{0.0684660748f, 0.174548075f},
-std::array<float,2>{0.709205806f, 0.772565365f},
-std::array<float,2>{0.297766656f, 0.517144144f},
-std::array<float,2>{0.785147429f, 0.335618824f},
-std::array<float,2>{0.429860741f, 0.471670717f},
-std::array<float,2>{0.902433217f, 0.727349758f},
-std::array<float,2>{0.139380738f, 0.910743833f},
-std::array<float,2>{0.538492143f, 0.0312621333f},
-std::array<float,2>{0.207364351f, 0.278510004f},
-std::array<float,2>{0.592621863f, 0.592456222f},
-std::array<float,2>{0.461295068f, 0.841868877f},
-std::array<float,2>{0.957276404f, 0.22680153f},
-std::array<float,2>{0.327986032f, 0.0797607228f},
-std::array<float,2>{0.864170074f, 0.941663921f},
-std::array<float,2>{0.0107302889f, 0.676021636f},
-std::array<float,2>{0.630949676f, 0.413754195f},
-std::array<float,2>{0.180215061f, 0.0174210258f},
-std::array<float,2>{0.515766084f, 0.90407151f},
-std::array<float,2>{0.387714148f, 0.692082405f},
-std::array<float,2>{0.928113878f, 0.456788212f},
-std::array<float,2>{0.251307547f, 0.354329824f},
-std::array<float,2>{0.769047678f, 0.547552943f},
-std::array<float,2>{0.108521812f, 0.796317875f},
-std::array<float,2>{0.741126895f, 0.152407929f},
-std::array<float,2>{0.0397169292f, 0.390478402f},
-std::array<float,2>{0.68417716f, 0.626015842f},
-std::array<float,2>{0.353771776f, 0.984402716f},
-std::array<float,2>{0.837417901f, 0.121667683f},
-std::array<float,2>{0.49576512f, 0.204387754f},
-std::array<float,2>{0.974622846f, 0.868886352f},
-std::array<float,2>{0.230236575f, 0.604731262f},
-std::array<float,2>{0.616644561f, 0.305214018f},
-std::array<float,2>{0.239205062f, 0.157923341f},
-std::array<float,2>{0.595950007f, 0.757169068f},
-std::array<float,2>{0.470507711f, 0.503794253f},
-std::array<float,2>{0.991552651f, 0.325979382f},
-std::array<float,2>{0.366002142f, 0.494405627f},
-std::array<float,2>{0.820934892f, 0.735329866f},
-std::array<float,2>{0.0610971116f, 0.934212685f},
-std::array<float,2>{0.662760198f, 0.0546150692f},
-std::array<float,2>{0.119214311f, 0.258661807f},
-std::array<float,2>{0.719929695f, 0.568088949f},
-std::array<float,2>{0.278381675f, 0.825308561f},
-std::array<float,2>{0.757825494f, 0.241590738f},
-std::array<float,2>{0.405837595f, 0.0631580353f},
-std::array<float,2>{0.908320844f, 0.967873394f},
-std::array<float,2>{0.171202153f, 0.670513391f},
-std::array<float,2>{0.514429331f, 0.423350781f},
-std::array<float,2>{0.0220244117f, 0.0101917256f},
-std::array<float,2>{0.648464501f, 0.889723778f},
-std::array<float,2>{0.341065466f, 0.710701466f},
-std::array<float,2>{0.858019531f, 0.447660357f},
-std::array<float,2>{0.449059665f, 0.370506465f},
-std::array<float,2>{0.953072608f, 0.533208311f},
-std::array<float,2>{0.194099233f, 0.810555995f},
-std::array<float,2>{0.568668783f, 0.133042067f},
-std::array<float,2>{0.145469457f, 0.395969629f},
-std::array<float,2>{0.553466618f, 0.655961871f},
-std::array<float,2>{0.418563306f, 0.969881713f},
-std::array<float,2>{0.879990637f, 0.106140748f},
-std::array<float,2>{0.283897907f, 0.197005972f},
-std::array<float,2>{0.801214457f, 0.844205856f},
-std::array<float,2>{0.0815447122f, 0.614397109f},
-std::array<float,2>{0.699445665f, 0.285136878f},
-std::array<float,2>{0.0682794303f, 0.226878628f},
-std::array<float,2>{0.708480895f, 0.842187226f},
-std::array<float,2>{0.299019516f, 0.592670977f},
-std::array<float,2>{0.783045471f, 0.278770268f},
-std::array<float,2>{0.433223248f, 0.414034605f},
-std::array<float,2>{0.906123221f, 0.676186681f},
-std::array<float,2>{0.137273714f, 0.941505134f},
-std::array<float,2>{0.535995305f, 0.0800713599f},
-std::array<float,2>{0.209718481f, 0.335786968f},
-std::array<float,2>{0.591402173f, 0.51745981f},
-std::array<float,2>{0.464538485f, 0.772818983f},
-std::array<float,2>{0.960770845f, 0.174736515f},
-std::array<float,2>{0.324633121f, 0.0315399729f},
-std::array<float,2>{0.866712809f, 0.911098599f},
-std::array<float,2>{0.00796639081f, 0.727146924f},
-std::array<float,2>{0.630731702f, 0.471323341f},
-std::array<float,2>{0.183469161f, 0.121912159f},
-std::array<float,2>{0.518097579f, 0.984666884f},
-std::array<float,2>{0.390391231f, 0.626396894f},
-std::array<float,2>{0.926675141f, 0.390251964f},
-std::array<float,2>{0.25315237f, 0.305663526f},
-std::array<float,2>{0.766076624f, 0.604952872f},
-std::array<float,2>{0.105976127f, 0.868998706f},
-std::array<float,2>{0.739282072f, 0.204267219f},
-std::array<float,2>{0.0423943177f, 0.456639081f},
-std::array<float,2>{0.686518431f, 0.692249954f},
-std::array<float,2>{0.351967007f, 0.903966069f},
-std::array<float,2>{0.83810693f, 0.0172311682f},
-std::array<float,2>{0.493306637f, 0.152604222f},
-std::array<float,2>{0.974607408f, 0.796063244f},
-std::array<float,2>{0.227102384f, 0.547837138f},
-std::array<float,2>{0.614079297f, 0.354043394f},
-std::array<float,2>{0.125252366f, 0.217686236f},
-std::array<float,2>{0.53923279f, 0.865291834f},
-std::array<float,2>{0.429516077f, 0.596099436f},
-std::array<float,2>{0.890629947f, 0.298719525f},
-std::array<float,2>{0.307728648f, 0.376034945f},
-std::array<float,2>{0.792781949f, 0.639520288f},
-std::array<float,2>{0.0742897093f, 0.992745876f},
-std::array<float,2>{0.713608205f, 0.112364396f},
-std::array<float,2>{0.00395498332f, 0.344408453f},
-std::array<float,2>{0.640524328f, 0.5620929f},
-std::array<float,2>{0.317845255f, 0.785212755f},
-std::array<float,2>{0.872648656f, 0.142540887f},
-std::array<float,2>{0.459652364f, 0.0257132072f},
-std::array<float,2>{0.964802563f, 0.894203603f},
-std::array<float,2>{0.214313552f, 0.697744012f},
-std::array<float,2>{0.582239985f, 0.465369612f},
-std::array<float,2>{0.0939711481f, 0.0869528428f},
-std::array<float,2>{0.748808384f, 0.951831162f},
-std::array<float,2>{0.264292806f, 0.684981287f},
-std::array<float,2>{0.780426979f, 0.414171964f},
-std::array<float,2>{0.380313545f, 0.27114293f},
-std::array<float,2>{0.933262765f, 0.579140782f},
-std::array<float,2>{0.173586488f, 0.835426509f},
-std::array<float,2>{0.526178122f, 0.219037831f},
-std::array<float,2>{0.224157706f, 0.479914904f},
-std::array<float,2>{0.621433735f, 0.726518095f},
-std::array<float,2>{0.489046097f, 0.916082978f},
-std::array<float,2>{0.976829946f, 0.0463536941f},
-std::array<float,2>{0.344329119f, 0.18580395f},
-std::array<float,2>{0.829861701f, 0.778262973f},
-std::array<float,2>{0.0370436758f, 0.526202917f},
-std::array<float,2>{0.673334301f, 0.342374057f},
-std::array<float,2>{0.0498152301f, 0.132238597f},
-std::array<float,2>{0.671136737f, 0.8013376f},
-std::array<float,2>{0.374440759f, 0.542829335f},
-std::array<float,2>{0.813138843f, 0.360886544f},
-std::array<float,2>{0.476751089f, 0.441689432f},
-std::array<float,2>{0.997819781f, 0.718132377f},
-std::array<float,2>{0.247249365f, 0.881543338f},
-std::array<float,2>{0.605794072f, 0.0015269689f},
-std::array<float,2>{0.162971452f, 0.292924494f},
-std::array<float,2>{0.505074739f, 0.621994913f},
-std::array<float,2>{0.395655066f, 0.855543971f},
-std::array<float,2>{0.918635964f, 0.193589374f},
-std::array<float,2>{0.271876246f, 0.101190381f},
-std::array<float,2>{0.751157343f, 0.982958496f},
-std::array<float,2>{0.109790891f, 0.644157827f},
-std::array<float,2>{0.727663398f, 0.401913524f},
-std::array<float,2>{0.200215518f, 0.0605696552f},
-std::array<float,2>{0.574326694f, 0.929247975f},
-std::array<float,2>{0.437747359f, 0.74589026f},
-std::array<float,2>{0.943973124f, 0.487430871f},
-std::array<float,2>{0.328192085f, 0.313173234f},
-std::array<float,2>{0.85120672f, 0.510151386f},
-std::array<float,2>{0.0305707455f, 0.76046133f},
-std::array<float,2>{0.642662466f, 0.171378851f},
-std::array<float,2>{0.0913992673f, 0.431779057f},
-std::array<float,2>{0.689172685f, 0.66095978f},
-std::array<float,2>{0.292525917f, 0.957745373f},
-std::array<float,2>{0.810481012f, 0.0759195462f},
-std::array<float,2>{0.40807724f, 0.246707529f},
-std::array<float,2>{0.883199513f, 0.82002455f},
-std::array<float,2>{0.148810804f, 0.571460247f},
-std::array<float,2>{0.56125778f, 0.254092187f},
-std::array<float,2>{0.167866349f, 0.145717204f},
-std::array<float,2>{0.511670113f, 0.783886433f},
-std::array<float,2>{0.402080894f, 0.556434214f},
-std::array<float,2>{0.913432062f, 0.348953545f},
-std::array<float,2>{0.274346948f, 0.463403076f},
-std::array<float,2>{0.764225841f, 0.70072943f},
-std::array<float,2>{0.123441726f, 0.895871162f},
-std::array<float,2>{0.726078272f, 0.027761871f},
-std::array<float,2>{0.0572080649f, 0.303995281f},
-std::array<float,2>{0.657108486f, 0.598220527f},
-std::array<float,2>{0.361461282f, 0.863279581f},
-std::array<float,2>{0.8265903f, 0.212733224f},
-std::array<float,2>{0.472979218f, 0.115508527f},
-std::array<float,2>{0.985758722f, 0.997291386f},
-std::array<float,2>{0.237359554f, 0.636229575f},
-std::array<float,2>{0.601450026f, 0.379363f},
-std::array<float,2>{0.0844333693f, 0.0416463166f},
-std::array<float,2>{0.695314527f, 0.921252012f},
-std::array<float,2>{0.287913263f, 0.72023505f},
-std::array<float,2>{0.800526977f, 0.481008947f},
-std::array<float,2>{0.41729933f, 0.338701874f},
-std::array<float,2>{0.87759459f, 0.529174566f},
-std::array<float,2>{0.144345164f, 0.775446832f},
-std::array<float,2>{0.54843998f, 0.181360364f},
-std::array<float,2>{0.190476239f, 0.419720531f},
-std::array<float,2>{0.566232562f, 0.68080759f},
-std::array<float,2>{0.449775487f, 0.947769284f},
-std::array<float,2>{0.946724236f, 0.0906328112f},
-std::array<float,2>{0.338985741f, 0.225178212f},
-std::array<float,2>{0.854034126f, 0.830065429f},
-std::array<float,2>{0.0181230344f, 0.582063496f},
-std::array<float,2>{0.654766619f, 0.268428594f},
-std::array<float,2>{0.0123484796f, 0.191078275f},
-std::array<float,2>{0.628595352f, 0.853063703f},
-std::array<float,2>{0.3222453f, 0.620422959f},
-std::array<float,2>{0.860085309f, 0.296324551f},
-std::array<float,2>{0.466356725f, 0.402800918f},
-std::array<float,2>{0.953524053f, 0.64460808f},
-std::array<float,2>{0.203325525f, 0.980247438f},
-std::array<float,2>{0.58597666f, 0.096710436f},
-std::array<float,2>{0.133703932f, 0.364095926f},
-std::array<float,2>{0.532916188f, 0.545844436f},
-std::array<float,2>{0.434069514f, 0.797956884f},
-std::array<float,2>{0.901085794f, 0.125629291f},
-std::array<float,2>{0.30189383f, 0.0077228453f},
-std::array<float,2>{0.788637578f, 0.877865553f},
-std::array<float,2>{0.0626673773f, 0.711317003f},
-std::array<float,2>{0.704516411f, 0.440242767f},
-std::array<float,2>{0.231930763f, 0.0722235292f},
-std::array<float,2>{0.610961676f, 0.95389533f},
-std::array<float,2>{0.498253971f, 0.658677101f},
-std::array<float,2>{0.970128715f, 0.437297046f},
-std::array<float,2>{0.356237978f, 0.251453191f},
-std::array<float,2>{0.840858996f, 0.57623291f},
-std::array<float,2>{0.043771401f, 0.81447506f},
-std::array<float,2>{0.679969311f, 0.242292389f},
-std::array<float,2>{0.102162242f, 0.488689274f},
-std::array<float,2>{0.737884045f, 0.746117055f},
-std::array<float,2>{0.254025906f, 0.925153136f},
-std::array<float,2>{0.771858275f, 0.0575195327f},
-std::array<float,2>{0.384442508f, 0.166448101f},
-std::array<float,2>{0.925668955f, 0.763131082f},
-std::array<float,2>{0.185422972f, 0.514791965f},
-std::array<float,2>{0.521560073f, 0.319201142f},
-std::array<float,2>{0.215082839f, 0.237981066f},
-std::array<float,2>{0.579271376f, 0.822572827f},
-std::array<float,2>{0.455245197f, 0.562656522f},
-std::array<float,2>{0.968263149f, 0.262571543f},
-std::array<float,2>{0.312799603f, 0.429508328f},
-std::array<float,2>{0.869404435f, 0.664748192f},
-std::array<float,2>{0.00107785338f, 0.962446988f},
-std::array<float,2>{0.634345591f, 0.0682062507f},
-std::array<float,2>{0.0721207112f, 0.324169546f},
-std::array<float,2>{0.714921653f, 0.504559815f},
-std::array<float,2>{0.311810553f, 0.75092262f},
-std::array<float,2>{0.796149135f, 0.163493633f},
-std::array<float,2>{0.42521888f, 0.0501678027f},
-std::array<float,2>{0.897147596f, 0.930622995f},
-std::array<float,2>{0.129893914f, 0.741432309f},
-std::array<float,2>{0.544932961f, 0.497219831f},
-std::array<float,2>{0.034092281f, 0.103099935f},
-std::array<float,2>{0.678943932f, 0.975610495f},
-std::array<float,2>{0.35146445f, 0.651157618f},
-std::array<float,2>{0.833125353f, 0.390828937f},
-std::array<float,2>{0.484780818f, 0.287765533f},
-std::array<float,2>{0.982050836f, 0.612350106f},
-std::array<float,2>{0.221659735f, 0.851482153f},
-std::array<float,2>{0.618137538f, 0.202165812f},
-std::array<float,2>{0.176227272f, 0.451044738f},
-std::array<float,2>{0.527708471f, 0.704280257f},
-std::array<float,2>{0.377694041f, 0.884865463f},
-std::array<float,2>{0.934985876f, 0.0117799444f},
-std::array<float,2>{0.25939852f, 0.138004839f},
-std::array<float,2>{0.774967611f, 0.808343172f},
-std::array<float,2>{0.100598618f, 0.538616478f},
-std::array<float,2>{0.744538307f, 0.37358737f},
-std::array<float,2>{0.11585582f, 0.179400936f},
-std::array<float,2>{0.732489109f, 0.769250333f},
-std::array<float,2>{0.2678864f, 0.521843433f},
-std::array<float,2>{0.755402625f, 0.329233557f},
-std::array<float,2>{0.390660882f, 0.473744094f},
-std::array<float,2>{0.914644361f, 0.731778502f},
-std::array<float,2>{0.157359183f, 0.909322679f},
-std::array<float,2>{0.501128852f, 0.0367489085f},
-std::array<float,2>{0.242248937f, 0.277210623f},
-std::array<float,2>{0.60212034f, 0.586070776f},
-std::array<float,2>{0.482977629f, 0.836815476f},
-std::array<float,2>{0.992595613f, 0.233115047f},
-std::array<float,2>{0.369944215f, 0.0821411312f},
-std::array<float,2>{0.81979686f, 0.937751472f},
-std::array<float,2>{0.0532044694f, 0.6736238f},
-std::array<float,2>{0.664220035f, 0.408511668f},
-std::array<float,2>{0.155634671f, 0.0218584593f},
-std::array<float,2>{0.555775106f, 0.900662422f},
-std::array<float,2>{0.412832856f, 0.69127053f},
-std::array<float,2>{0.888943374f, 0.460191876f},
-std::array<float,2>{0.295033604f, 0.357452989f},
-std::array<float,2>{0.806386352f, 0.55103302f},
-std::array<float,2>{0.0881095603f, 0.790548623f},
-std::array<float,2>{0.692075551f, 0.149195701f},
-std::array<float,2>{0.0235343892f, 0.386396915f},
-std::array<float,2>{0.644986153f, 0.62917769f},
-std::array<float,2>{0.333817959f, 0.989447415f},
-std::array<float,2>{0.844555616f, 0.120529093f},
-std::array<float,2>{0.444146782f, 0.210128233f},
-std::array<float,2>{0.93932122f, 0.873937845f},
-std::array<float,2>{0.195928469f, 0.60565877f},
-std::array<float,2>{0.570947468f, 0.311970294f},
-std::array<float,2>{0.192431539f, 0.135884777f},
-std::array<float,2>{0.567439556f, 0.809158862f},
-std::array<float,2>{0.446313888f, 0.533097088f},
-std::array<float,2>{0.950606763f, 0.368066937f},
-std::array<float,2>{0.342670709f, 0.445620894f},
-std::array<float,2>{0.856657147f, 0.708164215f},
-std::array<float,2>{0.021427203f, 0.888546169f},
-std::array<float,2>{0.651944578f, 0.00927052461f},
-std::array<float,2>{0.0796066597f, 0.282459199f},
-std::array<float,2>{0.70225668f, 0.617100239f},
-std::array<float,2>{0.281576663f, 0.847426176f},
-std::array<float,2>{0.8030743f, 0.198366821f},
-std::array<float,2>{0.42080301f, 0.108734034f},
-std::array<float,2>{0.880892277f, 0.971477211f},
-std::array<float,2>{0.146530941f, 0.653474212f},
-std::array<float,2>{0.551672399f, 0.398407221f},
-std::array<float,2>{0.0595429651f, 0.0525343791f},
-std::array<float,2>{0.661488831f, 0.937234819f},
-std::array<float,2>{0.364895165f, 0.736695468f},
-std::array<float,2>{0.823266685f, 0.493323088f},
-std::array<float,2>{0.471809804f, 0.327453107f},
-std::array<float,2>{0.990056157f, 0.501593471f},
-std::array<float,2>{0.241183594f, 0.754188716f},
-std::array<float,2>{0.593973815f, 0.158658072f},
-std::array<float,2>{0.169261768f, 0.42569536f},
-std::array<float,2>{0.512703657f, 0.668678641f},
-std::array<float,2>{0.402542025f, 0.966485381f},
-std::array<float,2>{0.907037795f, 0.0656068027f},
-std::array<float,2>{0.279980749f, 0.238634303f},
-std::array<float,2>{0.760650337f, 0.827568054f},
-std::array<float,2>{0.11863333f, 0.569242477f},
-std::array<float,2>{0.722427785f, 0.259900093f},
-std::array<float,2>{0.10828843f, 0.206845954f},
-std::array<float,2>{0.741291702f, 0.869863391f},
-std::array<float,2>{0.250447512f, 0.601956248f},
-std::array<float,2>{0.767742097f, 0.308018267f},
-std::array<float,2>{0.387266964f, 0.387400538f},
-std::array<float,2>{0.929088533f, 0.62729156f},
-std::array<float,2>{0.180692643f, 0.98786819f},
-std::array<float,2>{0.517092407f, 0.123961478f},
-std::array<float,2>{0.228525162f, 0.353281885f},
-std::array<float,2>{0.615552962f, 0.550457776f},
-std::array<float,2>{0.494316995f, 0.793732822f},
-std::array<float,2>{0.975664079f, 0.154891536f},
-std::array<float,2>{0.354676902f, 0.0180388931f},
-std::array<float,2>{0.836154997f, 0.905283988f},
-std::array<float,2>{0.0402024016f, 0.694048941f},
-std::array<float,2>{0.685248256f, 0.453622371f},
-std::array<float,2>{0.139908642f, 0.0817440227f},
-std::array<float,2>{0.538052201f, 0.944060922f},
-std::array<float,2>{0.431316942f, 0.678720355f},
-std::array<float,2>{0.903841317f, 0.411908716f},
-std::array<float,2>{0.297996938f, 0.281115174f},
-std::array<float,2>{0.783394814f, 0.59126085f},
-std::array<float,2>{0.069360733f, 0.841266751f},
-std::array<float,2>{0.710373759f, 0.229236573f},
-std::array<float,2>{0.0116106309f, 0.469768077f},
-std::array<float,2>{0.632358193f, 0.72933501f},
-std::array<float,2>{0.326253951f, 0.912804604f},
-std::array<float,2>{0.864640057f, 0.0334047861f},
-std::array<float,2>{0.462343693f, 0.173274159f},
-std::array<float,2>{0.958261847f, 0.770167828f},
-std::array<float,2>{0.208713546f, 0.518340528f},
-std::array<float,2>{0.593525112f, 0.33369568f},
-std::array<float,2>{0.17424728f, 0.222319752f},
-std::array<float,2>{0.523681462f, 0.832161009f},
-std::array<float,2>{0.38143295f, 0.58139056f},
-std::array<float,2>{0.929891527f, 0.272835821f},
-std::array<float,2>{0.261991024f, 0.416525781f},
-std::array<float,2>{0.7781744f, 0.686057627f},
-std::array<float,2>{0.0965363458f, 0.950840175f},
-std::array<float,2>{0.746989667f, 0.0889432207f},
-std::array<float,2>{0.0387871787f, 0.339876175f},
-std::array<float,2>{0.674284756f, 0.524106324f},
-std::array<float,2>{0.346581399f, 0.780611873f},
-std::array<float,2>{0.831605434f, 0.18515721f},
-std::array<float,2>{0.490935177f, 0.0439069979f},
-std::array<float,2>{0.979294062f, 0.915069282f},
-std::array<float,2>{0.225211442f, 0.724075735f},
-std::array<float,2>{0.624872446f, 0.47831133f},
-std::array<float,2>{0.0778983608f, 0.110061921f},
-std::array<float,2>{0.712479949f, 0.994355679f},
-std::array<float,2>{0.305968463f, 0.636956215f},
-std::array<float,2>{0.790665567f, 0.378614545f},
-std::array<float,2>{0.426758081f, 0.300238639f},
-std::array<float,2>{0.892865181f, 0.594485283f},
-std::array<float,2>{0.127923593f, 0.86412555f},
-std::array<float,2>{0.542645097f, 0.215958357f},
-std::array<float,2>{0.211286455f, 0.467486918f},
-std::array<float,2>{0.584395707f, 0.695838213f},
-std::array<float,2>{0.457786471f, 0.892311335f},
-std::array<float,2>{0.961986542f, 0.0247710589f},
-std::array<float,2>{0.318533033f, 0.143619254f},
-std::array<float,2>{0.873289824f, 0.78768909f},
-std::array<float,2>{0.0077824872f, 0.559576094f},
-std::array<float,2>{0.638068676f, 0.346786618f},
-std::array<float,2>{0.0278306212f, 0.169468716f},
-std::array<float,2>{0.641536593f, 0.759617805f},
-std::array<float,2>{0.330945611f, 0.509351254f},
-std::array<float,2>{0.848450363f, 0.315970272f},
-std::array<float,2>{0.440380812f, 0.48582527f},
-std::array<float,2>{0.942825317f, 0.743922889f},
-std::array<float,2>{0.20267655f, 0.927505434f},
-std::array<float,2>{0.576903045f, 0.0599699207f},
-std::array<float,2>{0.152288184f, 0.257238925f},
-std::array<float,2>{0.559822798f, 0.573436499f},
-std::array<float,2>{0.409038723f, 0.816702545f},
-std::array<float,2>{0.885678411f, 0.24880825f},
-std::array<float,2>{0.289172918f, 0.0769282058f},
-std::array<float,2>{0.812425494f, 0.960637152f},
-std::array<float,2>{0.091821894f, 0.662705302f},
-std::array<float,2>{0.690301061f, 0.430499524f},
-std::array<float,2>{0.248986557f, 0.00347901369f},
-std::array<float,2>{0.607465148f, 0.880384982f},
-std::array<float,2>{0.479687512f, 0.716532469f},
-std::array<float,2>{0.999807179f, 0.443565637f},
-std::array<float,2>{0.371669769f, 0.363114119f},
-std::array<float,2>{0.816091359f, 0.540214539f},
-std::array<float,2>{0.0473473594f, 0.804056466f},
-std::array<float,2>{0.668777645f, 0.130662382f},
-std::array<float,2>{0.111656085f, 0.398779213f},
-std::array<float,2>{0.729482889f, 0.641524673f},
-std::array<float,2>{0.270856708f, 0.981822371f},
-std::array<float,2>{0.753311276f, 0.098001942f},
-std::array<float,2>{0.39718926f, 0.193032146f},
-std::array<float,2>{0.920593619f, 0.857486486f},
-std::array<float,2>{0.162084341f, 0.624671042f},
-std::array<float,2>{0.506034672f, 0.290602773f},
-std::array<float,2>{0.14087972f, 0.181931913f},
-std::array<float,2>{0.549301803f, 0.774937987f},
-std::array<float,2>{0.414528787f, 0.52934134f},
-std::array<float,2>{0.876473606f, 0.337636262f},
-std::array<float,2>{0.285680592f, 0.484003693f},
-std::array<float,2>{0.798375607f, 0.722371519f},
-std::array<float,2>{0.0829788595f, 0.919197977f},
-std::array<float,2>{0.697708011f, 0.0403424092f},
-std::array<float,2>{0.0169715155f, 0.266399026f},
-std::array<float,2>{0.653269708f, 0.584594309f},
-std::array<float,2>{0.336309224f, 0.830743968f},
-std::array<float,2>{0.852539837f, 0.224488363f},
-std::array<float,2>{0.451426744f, 0.0937086493f},
-std::array<float,2>{0.94880569f, 0.946458399f},
-std::array<float,2>{0.187736273f, 0.683530927f},
-std::array<float,2>{0.563046455f, 0.420724303f},
-std::array<float,2>{0.122988418f, 0.0293800607f},
-std::array<float,2>{0.724199831f, 0.897265971f},
-std::array<float,2>{0.276183635f, 0.702177882f},
-std::array<float,2>{0.762613177f, 0.462609172f},
-std::array<float,2>{0.399524987f, 0.350942731f},
-std::array<float,2>{0.911914587f, 0.557887852f},
-std::array<float,2>{0.164611712f, 0.782614172f},
-std::array<float,2>{0.509519875f, 0.148232251f},
-std::array<float,2>{0.234401509f, 0.381788909f},
-std::array<float,2>{0.598296344f, 0.633039653f},
-std::array<float,2>{0.475228012f, 0.998622477f},
-std::array<float,2>{0.986460328f, 0.113998979f},
-std::array<float,2>{0.36020112f, 0.213368833f},
-std::array<float,2>{0.825226068f, 0.8611601f},
-std::array<float,2>{0.0563801676f, 0.601150572f},
-std::array<float,2>{0.659064949f, 0.301200032f},
-std::array<float,2>{0.0456466116f, 0.245132446f},
-std::array<float,2>{0.683347702f, 0.813918769f},
-std::array<float,2>{0.358756155f, 0.574312866f},
-std::array<float,2>{0.842484415f, 0.25353387f},
-std::array<float,2>{0.496751368f, 0.434348643f},
-std::array<float,2>{0.972084999f, 0.658066213f},
-std::array<float,2>{0.23404251f, 0.955235839f},
-std::array<float,2>{0.611522853f, 0.072501801f},
-std::array<float,2>{0.185573518f, 0.317524225f},
-std::array<float,2>{0.520103216f, 0.512782633f},
-std::array<float,2>{0.385443389f, 0.76535809f},
-std::array<float,2>{0.923345268f, 0.165195286f},
-std::array<float,2>{0.256720424f, 0.0564529262f},
-std::array<float,2>{0.769599259f, 0.923273146f},
-std::array<float,2>{0.105368979f, 0.749409556f},
-std::array<float,2>{0.73515588f, 0.491604686f},
-std::array<float,2>{0.205652311f, 0.0951288268f},
-std::array<float,2>{0.588782132f, 0.976601839f},
-std::array<float,2>{0.466814607f, 0.647043228f},
-std::array<float,2>{0.955497682f, 0.404400587f},
-std::array<float,2>{0.322701514f, 0.293253332f},
-std::array<float,2>{0.862148523f, 0.617484033f},
-std::array<float,2>{0.0150238266f, 0.854509592f},
-std::array<float,2>{0.625766456f, 0.187712014f},
-std::array<float,2>{0.0655404851f, 0.438441008f},
-std::array<float,2>{0.705480754f, 0.714167178f},
-std::array<float,2>{0.302768052f, 0.875960588f},
-std::array<float,2>{0.785581172f, 0.00416529551f},
-std::array<float,2>{0.436392397f, 0.127165854f},
-std::array<float,2>{0.90024364f, 0.799474299f},
-std::array<float,2>{0.135844097f, 0.544560969f},
-std::array<float,2>{0.534633219f, 0.367154241f},
-std::array<float,2>{0.218997687f, 0.200923353f},
-std::array<float,2>{0.620922685f, 0.848210096f},
-std::array<float,2>{0.486690342f, 0.609607756f},
-std::array<float,2>{0.98264116f, 0.285995483f},
-std::array<float,2>{0.349574894f, 0.393174767f},
-std::array<float,2>{0.834124744f, 0.649623275f},
-std::array<float,2>{0.0317733921f, 0.974352002f},
-std::array<float,2>{0.676143825f, 0.103723042f},
-std::array<float,2>{0.0978064165f, 0.372658223f},
-std::array<float,2>{0.743420422f, 0.536896884f},
-std::array<float,2>{0.26153326f, 0.80597955f},
-std::array<float,2>{0.7760818f, 0.139693603f},
-std::array<float,2>{0.375223517f, 0.0153893605f},
-std::array<float,2>{0.936122119f, 0.884518743f},
-std::array<float,2>{0.179220319f, 0.706338882f},
-std::array<float,2>{0.530798316f, 0.452150881f},
-std::array<float,2>{0.00328138843f, 0.0687699988f},
-std::array<float,2>{0.636589408f, 0.963231564f},
-std::array<float,2>{0.31502074f, 0.667061627f},
-std::array<float,2>{0.868145108f, 0.426792353f},
-std::array<float,2>{0.454129696f, 0.265413046f},
-std::array<float,2>{0.965510905f, 0.564704657f},
-std::array<float,2>{0.216812849f, 0.82106483f},
-std::array<float,2>{0.580753565f, 0.236056492f},
-std::array<float,2>{0.131363407f, 0.49834457f},
-std::array<float,2>{0.543879926f, 0.739118218f},
-std::array<float,2>{0.422332376f, 0.933581948f},
-std::array<float,2>{0.896059811f, 0.0479719266f},
-std::array<float,2>{0.310150146f, 0.160459533f},
-std::array<float,2>{0.793614686f, 0.753573775f},
-std::array<float,2>{0.0724032f, 0.507812023f},
-std::array<float,2>{0.717945158f, 0.3205612f},
-std::array<float,2>{0.087029174f, 0.150454789f},
-std::array<float,2>{0.695104241f, 0.792033851f},
-std::array<float,2>{0.293743104f, 0.554138184f},
-std::array<float,2>{0.807572067f, 0.356048912f},
-std::array<float,2>{0.412063926f, 0.457103074f},
-std::array<float,2>{0.887479663f, 0.689316332f},
-std::array<float,2>{0.152765229f, 0.900230944f},
-std::array<float,2>{0.556664884f, 0.0196524765f},
-std::array<float,2>{0.197823629f, 0.310376137f},
-std::array<float,2>{0.573696792f, 0.609002948f},
-std::array<float,2>{0.442694306f, 0.871857405f},
-std::array<float,2>{0.940780163f, 0.20866093f},
-std::array<float,2>{0.335391104f, 0.118178517f},
-std::array<float,2>{0.847593307f, 0.991868615f},
-std::array<float,2>{0.0267183911f, 0.631265104f},
-std::array<float,2>{0.647837698f, 0.384345561f},
-std::array<float,2>{0.158730268f, 0.0386281684f},
-std::array<float,2>{0.502880096f, 0.906938493f},
-std::array<float,2>{0.39386338f, 0.733190536f},
-std::array<float,2>{0.917256892f, 0.475270808f},
-std::array<float,2>{0.26610437f, 0.330839276f},
-std::array<float,2>{0.757323742f, 0.520664632f},
-std::array<float,2>{0.11382436f, 0.766923606f},
-std::array<float,2>{0.731771827f, 0.176103592f},
-std::array<float,2>{0.0518320985f, 0.407442451f},
-std::array<float,2>{0.666184604f, 0.673881114f},
-std::array<float,2>{0.36775288f, 0.940212548f},
-std::array<float,2>{0.817123353f, 0.0858761519f},
-std::array<float,2>{0.481734008f, 0.230940163f},
-std::array<float,2>{0.994864166f, 0.838809133f},
-std::array<float,2>{0.24534297f, 0.588699102f},
-std::array<float,2>{0.604274511f, 0.275073081f},
-std::array<float,2>{0.227733985f, 0.156152129f},
-std::array<float,2>{0.615065932f, 0.794772863f},
-std::array<float,2>{0.493037879f, 0.548983335f},
-std::array<float,2>{0.973258793f, 0.351659387f},
-std::array<float,2>{0.353285074f, 0.454708248f},
-std::array<float,2>{0.839519203f, 0.694708407f},
-std::array<float,2>{0.041894231f, 0.904878676f},
-std::array<float,2>{0.68738848f, 0.0187342837f},
-std::array<float,2>{0.106668353f, 0.306802958f},
-std::array<float,2>{0.738696158f, 0.602930129f},
-std::array<float,2>{0.252250075f, 0.870907485f},
-std::array<float,2>{0.766988277f, 0.205862686f},
-std::array<float,2>{0.389374495f, 0.124811783f},
-std::array<float,2>{0.926943362f, 0.986849844f},
-std::array<float,2>{0.181699023f, 0.628098488f},
-std::array<float,2>{0.519500017f, 0.388589472f},
-std::array<float,2>{0.00909435563f, 0.0348614454f},
-std::array<float,2>{0.629841685f, 0.913710892f},
-std::array<float,2>{0.325510353f, 0.73004818f},
-std::array<float,2>{0.865728498f, 0.468935668f},
-std::array<float,2>{0.463320285f, 0.332197547f},
-std::array<float,2>{0.959260821f, 0.518917561f},
-std::array<float,2>{0.210858002f, 0.770995438f},
-std::array<float,2>{0.590182245f, 0.172494218f},
-std::array<float,2>{0.137867779f, 0.410251379f},
-std::array<float,2>{0.536333799f, 0.678037465f},
-std::array<float,2>{0.432492256f, 0.945253909f},
-std::array<float,2>{0.904906213f, 0.0801938251f},
-std::array<float,2>{0.300420374f, 0.229999632f},
-std::array<float,2>{0.782209694f, 0.840158343f},
-std::array<float,2>{0.0665860027f, 0.590007007f},
-std::array<float,2>{0.707740188f, 0.279303998f},
-std::array<float,2>{0.0802271143f, 0.197643176f},
-std::array<float,2>{0.700940132f, 0.84602946f},
-std::array<float,2>{0.284841299f, 0.615656376f},
-std::array<float,2>{0.801848948f, 0.281388879f},
-std::array<float,2>{0.419567615f, 0.396741837f},
-std::array<float,2>{0.879650593f, 0.652723372f},
-std::array<float,2>{0.146145657f, 0.972106218f},
-std::array<float,2>{0.55425185f, 0.107674368f},
-std::array<float,2>{0.195070207f, 0.368275225f},
-std::array<float,2>{0.569455564f, 0.532041311f},
-std::array<float,2>{0.447426826f, 0.8102566f},
-std::array<float,2>{0.951252937f, 0.134814247f},
-std::array<float,2>{0.339929938f, 0.00872878451f},
-std::array<float,2>{0.859244823f, 0.886817336f},
-std::array<float,2>{0.0230257604f, 0.707965851f},
-std::array<float,2>{0.649755955f, 0.446420252f},
-std::array<float,2>{0.170451045f, 0.0646374151f},
-std::array<float,2>{0.514772654f, 0.96570152f},
-std::array<float,2>{0.404807746f, 0.669197738f},
-std::array<float,2>{0.910154998f, 0.424794227f},
-std::array<float,2>{0.277704239f, 0.261588156f},
-std::array<float,2>{0.758804679f, 0.569534719f},
-std::array<float,2>{0.12094333f, 0.827057302f},
-std::array<float,2>{0.719698429f, 0.239489958f},
-std::array<float,2>{0.0616012551f, 0.492878258f},
-std::array<float,2>{0.663252532f, 0.737907112f},
-std::array<float,2>{0.367123753f, 0.936079144f},
-std::array<float,2>{0.821874082f, 0.051053483f},
-std::array<float,2>{0.469361067f, 0.159691691f},
-std::array<float,2>{0.990960479f, 0.755213022f},
-std::array<float,2>{0.24015604f, 0.500289083f},
-std::array<float,2>{0.597509027f, 0.32702896f},
-std::array<float,2>{0.150065646f, 0.249832571f},
-std::array<float,2>{0.56200856f, 0.817442417f},
-std::array<float,2>{0.407064408f, 0.572595358f},
-std::array<float,2>{0.884474337f, 0.256166279f},
-std::array<float,2>{0.291883141f, 0.431298405f},
-std::array<float,2>{0.808769286f, 0.663811445f},
-std::array<float,2>{0.0907597542f, 0.959222913f},
-std::array<float,2>{0.687695205f, 0.0774145499f},
-std::array<float,2>{0.0301390048f, 0.314849615f},
-std::array<float,2>{0.643646061f, 0.508070886f},
-std::array<float,2>{0.329177797f, 0.758766651f},
-std::array<float,2>{0.850508988f, 0.168035984f},
-std::array<float,2>{0.43936947f, 0.0594240241f},
-std::array<float,2>{0.944845855f, 0.925800085f},
-std::array<float,2>{0.199564844f, 0.743112385f},
-std::array<float,2>{0.575867295f, 0.484449685f},
-std::array<float,2>{0.110708743f, 0.0995738953f},
-std::array<float,2>{0.726765156f, 0.980972648f},
-std::array<float,2>{0.273256093f, 0.641997516f},
-std::array<float,2>{0.750745475f, 0.399973601f},
-std::array<float,2>{0.394672334f, 0.290004849f},
-std::array<float,2>{0.919441819f, 0.623073101f},
-std::array<float,2>{0.163831308f, 0.859283328f},
-std::array<float,2>{0.504270673f, 0.191729113f},
-std::array<float,2>{0.246561259f, 0.445085466f},
-std::array<float,2>{0.60644573f, 0.715773284f},
-std::array<float,2>{0.478402793f, 0.878954172f},
-std::array<float,2>{0.996540546f, 0.00241095875f},
-std::array<float,2>{0.373142838f, 0.129116774f},
-std::array<float,2>{0.814376414f, 0.803237796f},
-std::array<float,2>{0.0489987396f, 0.539121866f},
-std::array<float,2>{0.67083776f, 0.361445099f},
-std::array<float,2>{0.035269279f, 0.184252232f},
-std::array<float,2>{0.672328234f, 0.779444039f},
-std::array<float,2>{0.345570326f, 0.525066137f},
-std::array<float,2>{0.829091191f, 0.341519445f},
-std::array<float,2>{0.489372283f, 0.477350235f},
-std::array<float,2>{0.978335977f, 0.723322928f},
-std::array<float,2>{0.222657382f, 0.914468348f},
-std::array<float,2>{0.622729421f, 0.0449170843f},
-std::array<float,2>{0.17279309f, 0.27211979f},
-std::array<float,2>{0.526742995f, 0.580621481f},
-std::array<float,2>{0.379552662f, 0.833258927f},
-std::array<float,2>{0.932550967f, 0.220713332f},
-std::array<float,2>{0.265479356f, 0.0885954499f},
-std::array<float,2>{0.779864132f, 0.949536264f},
-std::array<float,2>{0.0951043293f, 0.686731279f},
-std::array<float,2>{0.749320984f, 0.417093247f},
-std::array<float,2>{0.213536009f, 0.0243156478f},
-std::array<float,2>{0.583831549f, 0.891383171f},
-std::array<float,2>{0.460519671f, 0.697052956f},
-std::array<float,2>{0.963281035f, 0.468559504f},
-std::array<float,2>{0.316507965f, 0.346250027f},
-std::array<float,2>{0.872036815f, 0.559018493f},
-std::array<float,2>{0.00503607374f, 0.788618505f},
-std::array<float,2>{0.639357865f, 0.143461496f},
-std::array<float,2>{0.0759456754f, 0.377004564f},
-std::array<float,2>{0.714259386f, 0.637715161f},
-std::array<float,2>{0.306798458f, 0.995796263f},
-std::array<float,2>{0.791193068f, 0.111090027f},
-std::array<float,2>{0.42782867f, 0.215212032f},
-std::array<float,2>{0.892306685f, 0.86460495f},
-std::array<float,2>{0.126794949f, 0.595662951f},
-std::array<float,2>{0.541007042f, 0.299501836f},
-std::array<float,2>{0.183951125f, 0.16494076f},
-std::array<float,2>{0.522525907f, 0.764249504f},
-std::array<float,2>{0.383479238f, 0.512559295f},
-std::array<float,2>{0.924308836f, 0.316867769f},
-std::array<float,2>{0.255022734f, 0.490654886f},
-std::array<float,2>{0.772809863f, 0.748529017f},
-std::array<float,2>{0.102708928f, 0.922570527f},
-std::array<float,2>{0.737120628f, 0.0549642034f},
-std::array<float,2>{0.0446106568f, 0.252788454f},
-std::array<float,2>{0.680958033f, 0.575752139f},
-std::array<float,2>{0.357187629f, 0.81314826f},
-std::array<float,2>{0.840333223f, 0.244528174f},
-std::array<float,2>{0.499538124f, 0.0736972541f},
-std::array<float,2>{0.969024539f, 0.956824183f},
-std::array<float,2>{0.231230959f, 0.656626821f},
-std::array<float,2>{0.610050321f, 0.435182214f},
-std::array<float,2>{0.0639471933f, 0.00579950772f},
-std::array<float,2>{0.703131735f, 0.876088858f},
-std::array<float,2>{0.301355481f, 0.713292956f},
-std::array<float,2>{0.787862301f, 0.439005882f},
-std::array<float,2>{0.434602916f, 0.365344584f},
-std::array<float,2>{0.901480079f, 0.543174565f},
-std::array<float,2>{0.134540007f, 0.80025804f},
-std::array<float,2>{0.532119632f, 0.128634036f},
-std::array<float,2>{0.204712674f, 0.405714333f},
-std::array<float,2>{0.587282062f, 0.648293555f},
-std::array<float,2>{0.465251595f, 0.978433073f},
-std::array<float,2>{0.954959095f, 0.0943004861f},
-std::array<float,2>{0.321081847f, 0.189134911f},
-std::array<float,2>{0.860562444f, 0.854463279f},
-std::array<float,2>{0.012957246f, 0.618396878f},
-std::array<float,2>{0.627029419f, 0.294074118f},
-std::array<float,2>{0.0191814099f, 0.22360155f},
-std::array<float,2>{0.6556862f, 0.831127465f},
-std::array<float,2>{0.338599652f, 0.585578203f},
-std::array<float,2>{0.855387151f, 0.26683718f},
-std::array<float,2>{0.450734943f, 0.421402723f},
-std::array<float,2>{0.945576072f, 0.681862533f},
-std::array<float,2>{0.189553291f, 0.945743084f},
-std::array<float,2>{0.564857304f, 0.0924795568f},
-std::array<float,2>{0.142791405f, 0.336209327f},
-std::array<float,2>{0.547760248f, 0.530352712f},
-std::array<float,2>{0.416566789f, 0.773958862f},
-std::array<float,2>{0.878607452f, 0.18349956f},
-std::array<float,2>{0.288385779f, 0.039606262f},
-std::array<float,2>{0.799582481f, 0.918317676f},
-std::array<float,2>{0.0851745382f, 0.721313477f},
-std::array<float,2>{0.697065115f, 0.482779562f},
-std::array<float,2>{0.236461267f, 0.114876047f},
-std::array<float,2>{0.600033045f, 0.999701321f},
-std::array<float,2>{0.47370863f, 0.63439244f},
-std::array<float,2>{0.985286355f, 0.381866008f},
-std::array<float,2>{0.362805158f, 0.302692711f},
-std::array<float,2>{0.827786148f, 0.599640548f},
-std::array<float,2>{0.0584888309f, 0.859849989f},
-std::array<float,2>{0.657347739f, 0.213975742f},
-std::array<float,2>{0.124452464f, 0.461106718f},
-std::array<float,2>{0.725184321f, 0.701456666f},
-std::array<float,2>{0.274887502f, 0.898243368f},
-std::array<float,2>{0.764879405f, 0.0311848354f},
-std::array<float,2>{0.400790423f, 0.147009209f},
-std::array<float,2>{0.912543774f, 0.781448841f},
-std::array<float,2>{0.166419491f, 0.556646287f},
-std::array<float,2>{0.510241091f, 0.350184649f},
-std::array<float,2>{0.196386129f, 0.207629189f},
-std::array<float,2>{0.571722448f, 0.872253537f},
-std::array<float,2>{0.444526076f, 0.608299077f},
-std::array<float,2>{0.938183725f, 0.309305459f},
-std::array<float,2>{0.332906365f, 0.383069575f},
-std::array<float,2>{0.844912708f, 0.631841362f},
-std::array<float,2>{0.0245471541f, 0.990743458f},
-std::array<float,2>{0.646336019f, 0.1174303f},
-std::array<float,2>{0.0894685909f, 0.356805474f},
-std::array<float,2>{0.693214178f, 0.553423703f},
-std::array<float,2>{0.296458721f, 0.791714847f},
-std::array<float,2>{0.805006623f, 0.152205393f},
-std::array<float,2>{0.413102299f, 0.0213695653f},
-std::array<float,2>{0.890505433f, 0.899054289f},
-std::array<float,2>{0.154760301f, 0.687572002f},
-std::array<float,2>{0.555528939f, 0.458888322f},
-std::array<float,2>{0.0543719456f, 0.0842315331f},
-std::array<float,2>{0.66545552f, 0.940819263f},
-std::array<float,2>{0.370137095f, 0.67485106f},
-std::array<float,2>{0.818390131f, 0.40714258f},
-std::array<float,2>{0.483416349f, 0.274151951f},
-std::array<float,2>{0.993354082f, 0.588997781f},
-std::array<float,2>{0.243576929f, 0.839315176f},
-std::array<float,2>{0.603431761f, 0.231847733f},
-std::array<float,2>{0.1569345f, 0.475768536f},
-std::array<float,2>{0.500917196f, 0.734243751f},
-std::array<float,2>{0.391764283f, 0.908103466f},
-std::array<float,2>{0.915841997f, 0.0379129313f},
-std::array<float,2>{0.26933974f, 0.17749159f},
-std::array<float,2>{0.75400728f, 0.765863836f},
-std::array<float,2>{0.116556361f, 0.519795179f},
-std::array<float,2>{0.734179974f, 0.331906378f},
-std::array<float,2>{0.0996532813f, 0.139420241f},
-std::array<float,2>{0.745759726f, 0.804836512f},
-std::array<float,2>{0.258260787f, 0.535274327f},
-std::array<float,2>{0.774073005f, 0.371692568f},
-std::array<float,2>{0.378287941f, 0.451319844f},
-std::array<float,2>{0.934398055f, 0.705130816f},
-std::array<float,2>{0.176995978f, 0.882946253f},
-std::array<float,2>{0.528971136f, 0.0142786f},
-std::array<float,2>{0.221684575f, 0.287066042f},
-std::array<float,2>{0.618642211f, 0.610675275f},
-std::array<float,2>{0.486254215f, 0.848709941f},
-std::array<float,2>{0.980624378f, 0.200021312f},
-std::array<float,2>{0.349972457f, 0.104826935f},
-std::array<float,2>{0.832986057f, 0.973276436f},
-std::array<float,2>{0.0348892659f, 0.648438156f},
-std::array<float,2>{0.678353488f, 0.394338071f},
-std::array<float,2>{0.129726216f, 0.0470719114f},
-std::array<float,2>{0.545930445f, 0.931975424f},
-std::array<float,2>{0.42467618f, 0.739281774f},
-std::array<float,2>{0.898051858f, 0.499508888f},
-std::array<float,2>{0.311004311f, 0.321685135f},
-std::array<float,2>{0.795711398f, 0.506740034f},
-std::array<float,2>{0.0704718456f, 0.752555788f},
-std::array<float,2>{0.716216862f, 0.162017673f},
-std::array<float,2>{0.000848602212f, 0.426077336f},
-std::array<float,2>{0.63324219f, 0.666738153f},
-std::array<float,2>{0.314273506f, 0.963953555f},
-std::array<float,2>{0.870285869f, 0.069999449f},
-std::array<float,2>{0.457008272f, 0.234504506f},
-std::array<float,2>{0.967401743f, 0.822093785f},
-std::array<float,2>{0.216627121f, 0.565923929f},
-std::array<float,2>{0.578924596f, 0.264485627f},
-std::array<float,2>{0.207911447f, 0.175335914f},
-std::array<float,2>{0.591993392f, 0.771567106f},
-std::array<float,2>{0.461722553f, 0.515866578f},
-std::array<float,2>{0.957760751f, 0.334074438f},
-std::array<float,2>{0.327348918f, 0.471710771f},
-std::array<float,2>{0.863715649f, 0.727844894f},
-std::array<float,2>{0.00995372888f, 0.911596f},
-std::array<float,2>{0.631756783f, 0.0327761844f},
-std::array<float,2>{0.0691976622f, 0.278315187f},
-std::array<float,2>{0.709953368f, 0.593068063f},
-std::array<float,2>{0.297135621f, 0.84325254f},
-std::array<float,2>{0.784484506f, 0.228275895f},
-std::array<float,2>{0.430602759f, 0.0789509863f},
-std::array<float,2>{0.90329653f, 0.942504287f},
-std::array<float,2>{0.139116287f, 0.677386999f},
-std::array<float,2>{0.538762033f, 0.412148446f},
-std::array<float,2>{0.0394229442f, 0.0163821671f},
-std::array<float,2>{0.683641493f, 0.902506948f},
-std::array<float,2>{0.354017347f, 0.692511559f},
-std::array<float,2>{0.837111831f, 0.455945283f},
-std::array<float,2>{0.495458066f, 0.355463356f},
-std::array<float,2>{0.975403666f, 0.548195899f},
-std::array<float,2>{0.229819432f, 0.795498192f},
-std::array<float,2>{0.617059886f, 0.153334603f},
-std::array<float,2>{0.180173427f, 0.389184445f},
-std::array<float,2>{0.516396344f, 0.625723183f},
-std::array<float,2>{0.388379633f, 0.985955298f},
-std::array<float,2>{0.928609908f, 0.122384727f},
-std::array<float,2>{0.251737714f, 0.203529f},
-std::array<float,2>{0.768847167f, 0.86780107f},
-std::array<float,2>{0.10921932f, 0.604257822f},
-std::array<float,2>{0.740427256f, 0.306189835f},
-std::array<float,2>{0.117994562f, 0.240641966f},
-std::array<float,2>{0.721218824f, 0.824427366f},
-std::array<float,2>{0.281021893f, 0.567053139f},
-std::array<float,2>{0.761008739f, 0.25894478f},
-std::array<float,2>{0.403400004f, 0.42274785f},
-std::array<float,2>{0.907265484f, 0.671761155f},
-std::array<float,2>{0.168058634f, 0.966926932f},
-std::array<float,2>{0.512168109f, 0.064267315f},
-std::array<float,2>{0.241616294f, 0.324564964f},
-std::array<float,2>{0.594823956f, 0.502358615f},
-std::array<float,2>{0.47112757f, 0.756799459f},
-std::array<float,2>{0.988631189f, 0.156801134f},
-std::array<float,2>{0.363908023f, 0.053104721f},
-std::array<float,2>{0.822733819f, 0.934773445f},
-std::array<float,2>{0.0599925444f, 0.735394478f},
-std::array<float,2>{0.660602689f, 0.495238304f},
-std::array<float,2>{0.147701651f, 0.10739693f},
-std::array<float,2>{0.552710176f, 0.969040036f},
-std::array<float,2>{0.42104277f, 0.65438664f},
-std::array<float,2>{0.882616401f, 0.395187795f},
-std::array<float,2>{0.283186585f, 0.283919454f},
-std::array<float,2>{0.804028571f, 0.613669157f},
-std::array<float,2>{0.0786107033f, 0.845566154f},
-std::array<float,2>{0.701856613f, 0.195862934f},
-std::array<float,2>{0.0199851282f, 0.44917509f},
-std::array<float,2>{0.650972486f, 0.709847629f},
-std::array<float,2>{0.342968643f, 0.888970971f},
-std::array<float,2>{0.855728269f, 0.0109032625f},
-std::array<float,2>{0.445679277f, 0.134089187f},
-std::array<float,2>{0.94977653f, 0.811902225f},
-std::array<float,2>{0.191690773f, 0.534298897f},
-std::array<float,2>{0.56676048f, 0.369247347f},
-std::array<float,2>{0.160801545f, 0.194370478f},
-std::array<float,2>{0.507138789f, 0.856475472f},
-std::array<float,2>{0.397552282f, 0.622451246f},
-std::array<float,2>{0.921077609f, 0.291878611f},
-std::array<float,2>{0.269822419f, 0.401092231f},
-std::array<float,2>{0.752470195f, 0.643517792f},
-std::array<float,2>{0.112897463f, 0.983735561f},
-std::array<float,2>{0.730323851f, 0.100362778f},
-std::array<float,2>{0.0481041893f, 0.360302776f},
-std::array<float,2>{0.669016182f, 0.541483045f},
-std::array<float,2>{0.372320384f, 0.802054524f},
-std::array<float,2>{0.814755082f, 0.130941525f},
-std::array<float,2>{0.479448169f, 0.000131222056f},
-std::array<float,2>{0.998758614f, 0.882396519f},
-std::array<float,2>{0.2498568f, 0.717405558f},
-std::array<float,2>{0.608518779f, 0.442880213f},
-std::array<float,2>{0.0929754525f, 0.0749572292f},
-std::array<float,2>{0.690474212f, 0.958464086f},
-std::array<float,2>{0.290909588f, 0.66198498f},
-std::array<float,2>{0.811435282f, 0.432706654f},
-std::array<float,2>{0.409296334f, 0.255263478f},
-std::array<float,2>{0.885820329f, 0.570397615f},
-std::array<float,2>{0.150505051f, 0.819019675f},
-std::array<float,2>{0.559247375f, 0.247337058f},
-std::array<float,2>{0.201410681f, 0.48709181f},
-std::array<float,2>{0.577296078f, 0.744440019f},
-std::array<float,2>{0.440798193f, 0.92858243f},
-std::array<float,2>{0.942023337f, 0.0619322471f},
-std::array<float,2>{0.331256658f, 0.170694858f},
-std::array<float,2>{0.848937809f, 0.761182427f},
-std::array<float,2>{0.0287805535f, 0.510962605f},
-std::array<float,2>{0.642160416f, 0.314271003f},
-std::array<float,2>{0.00635395851f, 0.140889734f},
-std::array<float,2>{0.637423158f, 0.787078023f},
-std::array<float,2>{0.319891393f, 0.561101556f},
-std::array<float,2>{0.874815345f, 0.345604956f},
-std::array<float,2>{0.458625078f, 0.466261536f},
-std::array<float,2>{0.961654961f, 0.698760271f},
-std::array<float,2>{0.212758183f, 0.892911494f},
-std::array<float,2>{0.585446835f, 0.0264812838f},
-std::array<float,2>{0.128239155f, 0.29696995f},
-std::array<float,2>{0.541421592f, 0.597580671f},
-std::array<float,2>{0.426038176f, 0.867105961f},
-std::array<float,2>{0.894011021f, 0.217989489f},
-std::array<float,2>{0.305589855f, 0.111579299f},
-std::array<float,2>{0.789433241f, 0.99342382f},
-std::array<float,2>{0.0768516809f, 0.640530348f},
-std::array<float,2>{0.711767793f, 0.375904143f},
-std::array<float,2>{0.226312697f, 0.0457721353f},
-std::array<float,2>{0.623399675f, 0.917402029f},
-std::array<float,2>{0.491341799f, 0.725521624f},
-std::array<float,2>{0.980355382f, 0.479000717f},
-std::array<float,2>{0.346998841f, 0.343264937f},
-std::array<float,2>{0.830212533f, 0.527149081f},
-std::array<float,2>{0.0374754854f, 0.779077411f},
-std::array<float,2>{0.675362825f, 0.187491357f},
-std::array<float,2>{0.0976460651f, 0.415262431f},
-std::array<float,2>{0.747214794f, 0.683780551f},
-std::array<float,2>{0.263425082f, 0.953023374f},
-std::array<float,2>{0.778377771f, 0.0864702463f},
-std::array<float,2>{0.381930351f, 0.219735444f},
-std::array<float,2>{0.931572855f, 0.834218085f},
-std::array<float,2>{0.174857616f, 0.578484297f},
-std::array<float,2>{0.525241733f, 0.269758016f},
-std::array<float,2>{0.135648698f, 0.126784012f},
-std::array<float,2>{0.533292115f, 0.797499418f},
-std::array<float,2>{0.437317133f, 0.546018422f},
-std::array<float,2>{0.898449779f, 0.36499837f},
-std::array<float,2>{0.304676473f, 0.440469921f},
-std::array<float,2>{0.786931574f, 0.71237129f},
-std::array<float,2>{0.0645838603f, 0.878297746f},
-std::array<float,2>{0.706510186f, 0.00623311149f},
-std::array<float,2>{0.0145943444f, 0.295397341f},
-std::array<float,2>{0.626817644f, 0.619928002f},
-std::array<float,2>{0.323771149f, 0.851734459f},
-std::array<float,2>{0.863156199f, 0.190272018f},
-std::array<float,2>{0.468321145f, 0.0966744721f},
-std::array<float,2>{0.957000792f, 0.979283571f},
-std::array<float,2>{0.206595927f, 0.645870864f},
-std::array<float,2>{0.589238405f, 0.40360713f},
-std::array<float,2>{0.103786074f, 0.0585851483f},
-std::array<float,2>{0.735680342f, 0.924678028f},
-std::array<float,2>{0.256867826f, 0.747958899f},
-std::array<float,2>{0.771346152f, 0.489752561f},
-std::array<float,2>{0.385752916f, 0.320038348f},
-std::array<float,2>{0.922669411f, 0.514029443f},
-std::array<float,2>{0.186678827f, 0.762181222f},
-std::array<float,2>{0.521413565f, 0.167824581f},
-std::array<float,2>{0.232790843f, 0.435687989f},
-std::array<float,2>{0.612697244f, 0.660128832f},
-std::array<float,2>{0.497277439f, 0.954873741f},
-std::array<float,2>{0.970832765f, 0.0710129365f},
-std::array<float,2>{0.358283132f, 0.24376516f},
-std::array<float,2>{0.843393743f, 0.81553334f},
-std::array<float,2>{0.0465423949f, 0.577396691f},
-std::array<float,2>{0.68176651f, 0.250518978f},
-std::array<float,2>{0.054929141f, 0.211743385f},
-std::array<float,2>{0.659564793f, 0.861513138f},
-std::array<float,2>{0.361147046f, 0.599194944f},
-std::array<float,2>{0.825172901f, 0.303521872f},
-std::array<float,2>{0.476296216f, 0.37994194f},
-std::array<float,2>{0.988227129f, 0.634885073f},
-std::array<float,2>{0.2362618f, 0.996645629f},
-std::array<float,2>{0.598995745f, 0.116469242f},
-std::array<float,2>{0.165071115f, 0.347997397f},
-std::array<float,2>{0.508181274f, 0.555042803f},
-std::array<float,2>{0.398508787f, 0.784285486f},
-std::array<float,2>{0.910853267f, 0.14520894f},
-std::array<float,2>{0.276444852f, 0.0291116014f},
-std::array<float,2>{0.763527215f, 0.895220518f},
-std::array<float,2>{0.121165916f, 0.699439943f},
-std::array<float,2>{0.723374724f, 0.4645423f},
-std::array<float,2>{0.189443648f, 0.091475904f},
-std::array<float,2>{0.563792765f, 0.949212193f},
-std::array<float,2>{0.453119427f, 0.680469573f},
-std::array<float,2>{0.947393775f, 0.418275476f},
-std::array<float,2>{0.337482333f, 0.269322336f},
-std::array<float,2>{0.852377415f, 0.583439171f},
-std::array<float,2>{0.0159853455f, 0.828337908f},
-std::array<float,2>{0.654137015f, 0.225875959f},
-std::array<float,2>{0.0837503895f, 0.482329458f},
-std::array<float,2>{0.698268116f, 0.719287217f},
-std::array<float,2>{0.286513299f, 0.920448244f},
-std::array<float,2>{0.797842979f, 0.0426689573f},
-std::array<float,2>{0.415628701f, 0.180560485f},
-std::array<float,2>{0.875738263f, 0.776959896f},
-std::array<float,2>{0.142488375f, 0.527874291f},
-std::array<float,2>{0.550606906f, 0.339394391f},
-std::array<float,2>{0.244155243f, 0.234242067f},
-std::array<float,2>{0.605179071f, 0.836967528f},
-std::array<float,2>{0.480941862f, 0.587251782f},
-std::array<float,2>{0.995781302f, 0.276154429f},
-std::array<float,2>{0.368853748f, 0.409870654f},
-std::array<float,2>{0.818234503f, 0.672269702f},
-std::array<float,2>{0.0514857955f, 0.939231932f},
-std::array<float,2>{0.667286336f, 0.083442919f},
-std::array<float,2>{0.114407636f, 0.328954965f},
-std::array<float,2>{0.730841041f, 0.52306813f},
-std::array<float,2>{0.267074168f, 0.76771462f},
-std::array<float,2>{0.756364167f, 0.178188682f},
-std::array<float,2>{0.39316085f, 0.0356501378f},
-std::array<float,2>{0.916319847f, 0.908641338f},
-std::array<float,2>{0.15975374f, 0.730661035f},
-std::array<float,2>{0.503639281f, 0.472895145f},
-std::array<float,2>{0.0255429503f, 0.119627237f},
-std::array<float,2>{0.646994889f, 0.988620937f},
-std::array<float,2>{0.334865242f, 0.630040884f},
-std::array<float,2>{0.845957994f, 0.38512224f},
-std::array<float,2>{0.442177266f, 0.311366558f},
-std::array<float,2>{0.939647555f, 0.606681645f},
-std::array<float,2>{0.19850482f, 0.874696851f},
-std::array<float,2>{0.573001564f, 0.209772825f},
-std::array<float,2>{0.153431773f, 0.45945996f},
-std::array<float,2>{0.5579983f, 0.689875841f},
-std::array<float,2>{0.410664231f, 0.901372433f},
-std::array<float,2>{0.887806416f, 0.0225063264f},
-std::array<float,2>{0.294208616f, 0.149769977f},
-std::array<float,2>{0.808519721f, 0.789327979f},
-std::array<float,2>{0.0863663927f, 0.551803231f},
-std::array<float,2>{0.693603098f, 0.358589232f},
-std::array<float,2>{0.0739100873f, 0.162295505f},
-std::array<float,2>{0.717058539f, 0.751155019f},
-std::array<float,2>{0.30945909f, 0.50533849f},
-std::array<float,2>{0.794589102f, 0.322780371f},
-std::array<float,2>{0.423637569f, 0.496309757f},
-std::array<float,2>{0.894962668f, 0.740812004f},
-std::array<float,2>{0.132452175f, 0.931436121f},
-std::array<float,2>{0.544698596f, 0.0496369004f},
-std::array<float,2>{0.218730643f, 0.263182968f},
-std::array<float,2>{0.581107974f, 0.563861489f},
-std::array<float,2>{0.453361213f, 0.823955178f},
-std::array<float,2>{0.966164768f, 0.23689203f},
-std::array<float,2>{0.31571272f, 0.0666872412f},
-std::array<float,2>{0.868409693f, 0.961189866f},
-std::array<float,2>{0.00280915666f, 0.665708721f},
-std::array<float,2>{0.635053337f, 0.428517848f},
-std::array<float,2>{0.177858442f, 0.012766324f},
-std::array<float,2>{0.529502213f, 0.886296153f},
-std::array<float,2>{0.376830667f, 0.70361799f},
-std::array<float,2>{0.936841607f, 0.449631751f},
-std::array<float,2>{0.260307401f, 0.374392658f},
-std::array<float,2>{0.776758134f, 0.537628412f},
-std::array<float,2>{0.0987235233f, 0.807521164f},
-std::array<float,2>{0.743090808f, 0.136906326f},
-std::array<float,2>{0.0324016735f, 0.392455786f},
-std::array<float,2>{0.677223265f, 0.651369691f},
-std::array<float,2>{0.348557442f, 0.975429237f},
-std::array<float,2>{0.835467994f, 0.101756334f},
-std::array<float,2>{0.48798421f, 0.20211415f},
-std::array<float,2>{0.983546019f, 0.85009253f},
-std::array<float,2>{0.220146775f, 0.611401856f},
-std::array<float,2>{0.619463742f, 0.28839466f},
-std::array<float,2>{0.22322017f, 0.186918974f},
-std::array<float,2>{0.622319341f, 0.778349876f},
-std::array<float,2>{0.489884704f, 0.52648586f},
-std::array<float,2>{0.977818191f, 0.342930675f},
-std::array<float,2>{0.344767481f, 0.479121089f},
-std::array<float,2>{0.828470469f, 0.72498554f},
-std::array<float,2>{0.0357419178f, 0.917529225f},
-std::array<float,2>{0.672489703f, 0.0450208932f},
-std::array<float,2>{0.095417127f, 0.270059079f},
-std::array<float,2>{0.749938309f, 0.578838587f},
-std::array<float,2>{0.264808744f, 0.834634364f},
-std::array<float,2>{0.779377282f, 0.220596656f},
-std::array<float,2>{0.378997594f, 0.0862350166f},
-std::array<float,2>{0.931942046f, 0.952403486f},
-std::array<float,2>{0.172321096f, 0.684416294f},
-std::array<float,2>{0.526895344f, 0.415971637f},
-std::array<float,2>{0.00562807452f, 0.0270658396f},
-std::array<float,2>{0.638797402f, 0.893292904f},
-std::array<float,2>{0.317343354f, 0.698564649f},
-std::array<float,2>{0.871480048f, 0.466606975f},
-std::array<float,2>{0.460372746f, 0.344870806f},
-std::array<float,2>{0.963549256f, 0.560951352f},
-std::array<float,2>{0.21330066f, 0.786305487f},
-std::array<float,2>{0.583270967f, 0.141346425f},
-std::array<float,2>{0.126308724f, 0.375249505f},
-std::array<float,2>{0.540280402f, 0.639663994f},
-std::array<float,2>{0.428573579f, 0.994067252f},
-std::array<float,2>{0.892018735f, 0.112209514f},
-std::array<float,2>{0.307531714f, 0.218509302f},
-std::array<float,2>{0.791897833f, 0.866273344f},
-std::array<float,2>{0.0753612295f, 0.596690059f},
-std::array<float,2>{0.714563072f, 0.297440469f},
-std::array<float,2>{0.0902201012f, 0.247682542f},
-std::array<float,2>{0.688258052f, 0.818602085f},
-std::array<float,2>{0.291498542f, 0.571030021f},
-std::array<float,2>{0.809088469f, 0.255831301f},
-std::array<float,2>{0.406613946f, 0.433484554f},
-std::array<float,2>{0.884036064f, 0.661583841f},
-std::array<float,2>{0.149499223f, 0.958818078f},
-std::array<float,2>{0.562444091f, 0.0743323416f},
-std::array<float,2>{0.200032309f, 0.31381166f},
-std::array<float,2>{0.575636208f, 0.511559904f},
-std::array<float,2>{0.438924193f, 0.761386335f},
-std::array<float,2>{0.9443627f, 0.170085773f},
-std::array<float,2>{0.329648226f, 0.0621443912f},
-std::array<float,2>{0.849785209f, 0.927879393f},
-std::array<float,2>{0.0294647831f, 0.744838059f},
-std::array<float,2>{0.644132018f, 0.48677966f},
-std::array<float,2>{0.163417459f, 0.100094035f},
-std::array<float,2>{0.504698813f, 0.983913839f},
-std::array<float,2>{0.395260483f, 0.642641068f},
-std::array<float,2>{0.919035017f, 0.40046823f},
-std::array<float,2>{0.272523314f, 0.291320145f},
-std::array<float,2>{0.750266254f, 0.622606277f},
-std::array<float,2>{0.11093387f, 0.85736835f},
-std::array<float,2>{0.727176547f, 0.194892585f},
-std::array<float,2>{0.0496820062f, 0.442492038f},
-std::array<float,2>{0.670087457f, 0.717063129f},
-std::array<float,2>{0.373984933f, 0.881954074f},
-std::array<float,2>{0.813521981f, 0.000813584018f},
-std::array<float,2>{0.477872312f, 0.131525889f},
-std::array<float,2>{0.996839762f, 0.802271903f},
-std::array<float,2>{0.246774137f, 0.541626334f},
-std::array<float,2>{0.607387483f, 0.359511584f},
-std::array<float,2>{0.145764604f, 0.195563942f},
-std::array<float,2>{0.553958356f, 0.845079899f},
-std::array<float,2>{0.419115394f, 0.614134669f},
-std::array<float,2>{0.879011691f, 0.283538282f},
-std::array<float,2>{0.284431338f, 0.394929349f},
-std::array<float,2>{0.802252293f, 0.655117452f},
-std::array<float,2>{0.0808174163f, 0.969590068f},
-std::array<float,2>{0.700634181f, 0.106500074f},
-std::array<float,2>{0.0227922965f, 0.369945019f},
-std::array<float,2>{0.650138557f, 0.535033762f},
-std::array<float,2>{0.340691894f, 0.812121451f},
-std::array<float,2>{0.85863775f, 0.134502456f},
-std::array<float,2>{0.448186666f, 0.0115436641f},
-std::array<float,2>{0.952137887f, 0.889611125f},
-std::array<float,2>{0.194401816f, 0.709293425f},
-std::array<float,2>{0.569893479f, 0.448519439f},
-std::array<float,2>{0.120263979f, 0.0638381019f},
-std::array<float,2>{0.719201505f, 0.967667699f},
-std::array<float,2>{0.277832866f, 0.670998752f},
-std::array<float,2>{0.759437203f, 0.422271609f},
-std::array<float,2>{0.404664248f, 0.259355843f},
-std::array<float,2>{0.909240067f, 0.566484869f},
-std::array<float,2>{0.17037195f, 0.824823678f},
-std::array<float,2>{0.515456021f, 0.241018996f},
-std::array<float,2>{0.239416331f, 0.495898664f},
-std::array<float,2>{0.597108543f, 0.73598367f},
-std::array<float,2>{0.46886611f, 0.935479641f},
-std::array<float,2>{0.990400851f, 0.0533646308f},
-std::array<float,2>{0.366483331f, 0.156351864f},
-std::array<float,2>{0.82156837f, 0.756044686f},
-std::array<float,2>{0.0623724423f, 0.502801239f},
-std::array<float,2>{0.663875878f, 0.325176835f},
-std::array<float,2>{0.0410172343f, 0.154137999f},
-std::array<float,2>{0.686574221f, 0.795120239f},
-std::array<float,2>{0.352944523f, 0.548699439f},
-std::array<float,2>{0.839327335f, 0.354811221f},
-std::array<float,2>{0.492670447f, 0.455186248f},
-std::array<float,2>{0.972922146f, 0.69327724f},
-std::array<float,2>{0.228355214f, 0.903062284f},
-std::array<float,2>{0.614493191f, 0.0160443466f},
-std::array<float,2>{0.182337463f, 0.305939525f},
-std::array<float,2>{0.518782735f, 0.603655577f},
-std::array<float,2>{0.389150202f, 0.867455781f},
-std::array<float,2>{0.927326918f, 0.204013482f},
-std::array<float,2>{0.252530962f, 0.122828647f},
-std::array<float,2>{0.767092764f, 0.985623896f},
-std::array<float,2>{0.107328869f, 0.625306666f},
-std::array<float,2>{0.738960326f, 0.389154434f},
-std::array<float,2>{0.210058272f, 0.0323189236f},
-std::array<float,2>{0.590711594f, 0.911966324f},
-std::array<float,2>{0.463839769f, 0.728227437f},
-std::array<float,2>{0.959520221f, 0.472634941f},
-std::array<float,2>{0.325834632f, 0.334833741f},
-std::array<float,2>{0.865605414f, 0.516518652f},
-std::array<float,2>{0.00970675144f, 0.772410631f},
-std::array<float,2>{0.628949344f, 0.175016239f},
-std::array<float,2>{0.0672513768f, 0.412677497f},
-std::array<float,2>{0.707108319f, 0.676844418f},
-std::array<float,2>{0.300061584f, 0.943067431f},
-std::array<float,2>{0.781612515f, 0.0786081702f},
-std::array<float,2>{0.431974977f, 0.227602169f},
-std::array<float,2>{0.90447247f, 0.84371233f},
-std::array<float,2>{0.138511777f, 0.593345821f},
-std::array<float,2>{0.53669399f, 0.277640343f},
-std::array<float,2>{0.177382275f, 0.1373429f},
-std::array<float,2>{0.528602839f, 0.806681633f},
-std::array<float,2>{0.378679425f, 0.537418664f},
-std::array<float,2>{0.933827758f, 0.374720961f},
-std::array<float,2>{0.258688837f, 0.449824005f},
-std::array<float,2>{0.773908734f, 0.703244209f},
-std::array<float,2>{0.100253269f, 0.88620168f},
-std::array<float,2>{0.745342672f, 0.0135101806f},
-std::array<float,2>{0.0342476629f, 0.288961291f},
-std::array<float,2>{0.677885771f, 0.612286329f},
-std::array<float,2>{0.350283027f, 0.850290775f},
-std::array<float,2>{0.832325757f, 0.201646343f},
-std::array<float,2>{0.485767424f, 0.102472864f},
-std::array<float,2>{0.98141861f, 0.974988699f},
-std::array<float,2>{0.2222206f, 0.652331889f},
-std::array<float,2>{0.618912637f, 0.391958535f},
-std::array<float,2>{0.0710408539f, 0.0489879251f},
-std::array<float,2>{0.716664553f, 0.931010902f},
-std::array<float,2>{0.311165333f, 0.740317345f},
-std::array<float,2>{0.795036554f, 0.496991575f},
-std::array<float,2>{0.423976392f, 0.322568864f},
-std::array<float,2>{0.897937059f, 0.505789518f},
-std::array<float,2>{0.128935024f, 0.751545906f},
-std::array<float,2>{0.546860814f, 0.162854329f},
-std::array<float,2>{0.215943843f, 0.427929819f},
-std::array<float,2>{0.578586221f, 0.665486455f},
-std::array<float,2>{0.456165671f, 0.961781383f},
-std::array<float,2>{0.96704334f, 0.0669490546f},
-std::array<float,2>{0.313533604f, 0.236600325f},
-std::array<float,2>{0.870983839f, 0.823524296f},
-std::array<float,2>{0.000218570378f, 0.564321399f},
-std::array<float,2>{0.633451462f, 0.263193756f},
-std::array<float,2>{0.0253432915f, 0.209427789f},
-std::array<float,2>{0.645635128f, 0.874441743f},
-std::array<float,2>{0.332039773f, 0.607371569f},
-std::array<float,2>{0.845701993f, 0.311012417f},
-std::array<float,2>{0.445119023f, 0.385325938f},
-std::array<float,2>{0.937714458f, 0.630617261f},
-std::array<float,2>{0.197142273f, 0.988915503f},
-std::array<float,2>{0.571988463f, 0.120085016f},
-std::array<float,2>{0.154824793f, 0.359248906f},
-std::array<float,2>{0.554785311f, 0.552283943f},
-std::array<float,2>{0.414044291f, 0.789818287f},
-std::array<float,2>{0.889802575f, 0.150010839f},
-std::array<float,2>{0.296072781f, 0.0233650357f},
-std::array<float,2>{0.805265903f, 0.902218938f},
-std::array<float,2>{0.089140512f, 0.690116227f},
-std::array<float,2>{0.692858279f, 0.459483683f},
-std::array<float,2>{0.243849099f, 0.0839713737f},
-std::array<float,2>{0.602580786f, 0.938727319f},
-std::array<float,2>{0.483904272f, 0.672516465f},
-std::array<float,2>{0.994110048f, 0.409304708f},
-std::array<float,2>{0.370673716f, 0.275667131f},
-std::array<float,2>{0.819299042f, 0.587787509f},
-std::array<float,2>{0.0538778603f, 0.837772608f},
-std::array<float,2>{0.665607452f, 0.233493462f},
-std::array<float,2>{0.1169696f, 0.473623633f},
-std::array<float,2>{0.733722329f, 0.731408179f},
-std::array<float,2>{0.268969089f, 0.908939242f},
-std::array<float,2>{0.75475502f, 0.0354895927f},
-std::array<float,2>{0.392555654f, 0.178438753f},
-std::array<float,2>{0.915455341f, 0.768087745f},
-std::array<float,2>{0.156263247f, 0.522657156f},
-std::array<float,2>{0.500363588f, 0.32858029f},
-std::array<float,2>{0.190127909f, 0.226164714f},
-std::array<float,2>{0.565205932f, 0.828857183f},
-std::array<float,2>{0.450446129f, 0.583507061f},
-std::array<float,2>{0.945996821f, 0.268792093f},
-std::array<float,2>{0.338078201f, 0.418779224f},
-std::array<float,2>{0.854759932f, 0.680134416f},
-std::array<float,2>{0.0189510304f, 0.948301017f},
-std::array<float,2>{0.656201899f, 0.0910899341f},
-std::array<float,2>{0.0859086812f, 0.339014798f},
-std::array<float,2>{0.696472645f, 0.527440488f},
-std::array<float,2>{0.289029866f, 0.776584923f},
-std::array<float,2>{0.799178302f, 0.179754764f},
-std::array<float,2>{0.416494519f, 0.0421888307f},
-std::array<float,2>{0.877980292f, 0.92012012f},
-std::array<float,2>{0.143215343f, 0.719033778f},
-std::array<float,2>{0.546887934f, 0.481700212f},
-std::array<float,2>{0.0578861609f, 0.116942808f},
-std::array<float,2>{0.658008277f, 0.996300399f},
-std::array<float,2>{0.362704068f, 0.635656655f},
-std::array<float,2>{0.827486634f, 0.380436152f},
-std::array<float,2>{0.474440724f, 0.302949786f},
-std::array<float,2>{0.984800339f, 0.598970354f},
-std::array<float,2>{0.237217724f, 0.861837745f},
-std::array<float,2>{0.60038805f, 0.211097747f},
-std::array<float,2>{0.166647196f, 0.463891059f},
-std::array<float,2>{0.510729074f, 0.699804723f},
-std::array<float,2>{0.40119499f, 0.894875407f},
-std::array<float,2>{0.912912369f, 0.0286946893f},
-std::array<float,2>{0.275072217f, 0.144791797f},
-std::array<float,2>{0.765207648f, 0.784764588f},
-std::array<float,2>{0.124605328f, 0.55518496f},
-std::array<float,2>{0.724954009f, 0.34860304f},
-std::array<float,2>{0.103206225f, 0.167246118f},
-std::array<float,2>{0.736593187f, 0.762434363f},
-std::array<float,2>{0.255519748f, 0.514622808f},
-std::array<float,2>{0.773330271f, 0.319776028f},
-std::array<float,2>{0.382903844f, 0.489704639f},
-std::array<float,2>{0.924743533f, 0.747123539f},
-std::array<float,2>{0.184219614f, 0.924082458f},
-std::array<float,2>{0.522995353f, 0.0580368601f},
-std::array<float,2>{0.23051846f, 0.250345886f},
-std::array<float,2>{0.60966146f, 0.577783883f},
-std::array<float,2>{0.499271333f, 0.815987051f},
-std::array<float,2>{0.969451308f, 0.243284315f},
-std::array<float,2>{0.356562555f, 0.0706543699f},
-std::array<float,2>{0.840304911f, 0.95436722f},
-std::array<float,2>{0.0442241654f, 0.659188867f},
-std::array<float,2>{0.681260347f, 0.436273843f},
-std::array<float,2>{0.134228393f, 0.00678246934f},
-std::array<float,2>{0.5313887f, 0.87882328f},
-std::array<float,2>{0.435295701f, 0.712860823f},
-std::array<float,2>{0.902066469f, 0.441349298f},
-std::array<float,2>{0.301075786f, 0.364410549f},
-std::array<float,2>{0.787429094f, 0.546737969f},
-std::array<float,2>{0.0639696792f, 0.797354221f},
-std::array<float,2>{0.703640819f, 0.126037687f},
-std::array<float,2>{0.01323801f, 0.403936088f},
-std::array<float,2>{0.627809405f, 0.646186054f},
-std::array<float,2>{0.320373744f, 0.978956103f},
-std::array<float,2>{0.860945106f, 0.0958787873f},
-std::array<float,2>{0.465666324f, 0.189812809f},
-std::array<float,2>{0.954278588f, 0.852374971f},
-std::array<float,2>{0.204586461f, 0.619143367f},
-std::array<float,2>{0.587695241f, 0.295586497f},
-std::array<float,2>{0.212242737f, 0.143063203f},
-std::array<float,2>{0.585789979f, 0.788184881f},
-std::array<float,2>{0.458410919f, 0.559542298f},
-std::array<float,2>{0.961105943f, 0.346159399f},
-std::array<float,2>{0.319592953f, 0.467951089f},
-std::array<float,2>{0.874091983f, 0.696289599f},
-std::array<float,2>{0.00620547542f, 0.890794933f},
-std::array<float,2>{0.636753857f, 0.023457421f},
-std::array<float,2>{0.0763283446f, 0.299250573f},
-std::array<float,2>{0.711080015f, 0.594781876f},
-std::array<float,2>{0.305015951f, 0.864792407f},
-std::array<float,2>{0.789745212f, 0.215450078f},
-std::array<float,2>{0.426379502f, 0.110775225f},
-std::array<float,2>{0.894244015f, 0.995178878f},
-std::array<float,2>{0.12858665f, 0.638429224f},
-std::array<float,2>{0.541837513f, 0.377608627f},
-std::array<float,2>{0.0379611067f, 0.044168815f},
-std::array<float,2>{0.675104141f, 0.914672017f},
-std::array<float,2>{0.347176492f, 0.723102152f},
-std::array<float,2>{0.830937862f, 0.476806372f},
-std::array<float,2>{0.491955131f, 0.341261953f},
-std::array<float,2>{0.97982198f, 0.524587452f},
-std::array<float,2>{0.225754499f, 0.779938459f},
-std::array<float,2>{0.623889506f, 0.183868602f},
-std::array<float,2>{0.175566077f, 0.417936414f},
-std::array<float,2>{0.524725497f, 0.687265217f},
-std::array<float,2>{0.382441491f, 0.949858427f},
-std::array<float,2>{0.930764258f, 0.0882245004f},
-std::array<float,2>{0.262941003f, 0.2213144f},
-std::array<float,2>{0.77899313f, 0.833624184f},
-std::array<float,2>{0.0969216228f, 0.580194533f},
-std::array<float,2>{0.747562647f, 0.271591097f},
-std::array<float,2>{0.112543643f, 0.191952646f},
-std::array<float,2>{0.729665041f, 0.858796895f},
-std::array<float,2>{0.270421535f, 0.623553753f},
-std::array<float,2>{0.75199151f, 0.289544463f},
-std::array<float,2>{0.398198813f, 0.399705827f},
-std::array<float,2>{0.921578467f, 0.642524064f},
-std::array<float,2>{0.160515457f, 0.980591178f},
-std::array<float,2>{0.50732708f, 0.0987233967f},
-std::array<float,2>{0.249406904f, 0.362299651f},
-std::array<float,2>{0.60929811f, 0.539821148f},
-std::array<float,2>{0.478903502f, 0.802818656f},
-std::array<float,2>{0.998173356f, 0.129836589f},
-std::array<float,2>{0.372621089f, 0.00279935333f},
-std::array<float,2>{0.815326333f, 0.879773498f},
-std::array<float,2>{0.0484928042f, 0.715078175f},
-std::array<float,2>{0.66967845f, 0.444543302f},
-std::array<float,2>{0.150952771f, 0.0777828544f},
-std::array<float,2>{0.558708906f, 0.959783316f},
-std::array<float,2>{0.409979969f, 0.663274527f},
-std::array<float,2>{0.886706233f, 0.431099534f},
-std::array<float,2>{0.29049769f, 0.256661147f},
-std::array<float,2>{0.811010361f, 0.57312566f},
-std::array<float,2>{0.0932671502f, 0.817961633f},
-std::array<float,2>{0.691132307f, 0.249472916f},
-std::array<float,2>{0.028965028f, 0.485317409f},
-std::array<float,2>{0.642036974f, 0.742191255f},
-std::array<float,2>{0.331874162f, 0.926574528f},
-std::array<float,2>{0.849280059f, 0.0587171316f},
-std::array<float,2>{0.441144794f, 0.168648675f},
-std::array<float,2>{0.941797733f, 0.758169353f},
-std::array<float,2>{0.202040732f, 0.508680701f},
-std::array<float,2>{0.578124166f, 0.314970404f},
-std::array<float,2>{0.168573976f, 0.23994942f},
-std::array<float,2>{0.512618423f, 0.826309621f},
-std::array<float,2>{0.403849542f, 0.570091426f},
-std::array<float,2>{0.907847881f, 0.26094535f},
-std::array<float,2>{0.280685484f, 0.42392841f},
-std::array<float,2>{0.761435091f, 0.669900894f},
-std::array<float,2>{0.117365949f, 0.964975834f},
-std::array<float,2>{0.720930219f, 0.0650335401f},
-std::array<float,2>{0.0604580231f, 0.326645643f},
-std::array<float,2>{0.660655916f, 0.500723779f},
-std::array<float,2>{0.363508672f, 0.755622566f},
-std::array<float,2>{0.823116124f, 0.159555018f},
-std::array<float,2>{0.471636951f, 0.0513548143f},
-std::array<float,2>{0.98897022f, 0.935815394f},
-std::array<float,2>{0.242061511f, 0.737624705f},
-std::array<float,2>{0.595261157f, 0.492187738f},
-std::array<float,2>{0.0788038597f, 0.107933179f},
-std::array<float,2>{0.70151329f, 0.972201109f},
-std::array<float,2>{0.28267476f, 0.653156698f},
-std::array<float,2>{0.804242492f, 0.39715296f},
-std::array<float,2>{0.421828926f, 0.282017082f},
-std::array<float,2>{0.881889701f, 0.615805686f},
-std::array<float,2>{0.14817366f, 0.846598148f},
-std::array<float,2>{0.551819205f, 0.198229194f},
-std::array<float,2>{0.192012578f, 0.446810693f},
-std::array<float,2>{0.567354918f, 0.707361042f},
-std::array<float,2>{0.446053386f, 0.887254357f},
-std::array<float,2>{0.949669182f, 0.0079800263f},
-std::array<float,2>{0.343509167f, 0.135365695f},
-std::array<float,2>{0.856173098f, 0.809614599f},
-std::array<float,2>{0.0201179106f, 0.531418204f},
-std::array<float,2>{0.650615931f, 0.369055808f},
-std::array<float,2>{0.0102870371f, 0.172210559f},
-std::array<float,2>{0.631124437f, 0.771372736f},
-std::array<float,2>{0.327717513f, 0.51925528f},
-std::array<float,2>{0.863891244f, 0.332817137f},
-std::array<float,2>{0.461181462f, 0.46936819f},
-std::array<float,2>{0.957154274f, 0.729832709f},
-std::array<float,2>{0.207273006f, 0.913476408f},
-std::array<float,2>{0.592343867f, 0.0345042534f},
-std::array<float,2>{0.139494553f, 0.280035079f},
-std::array<float,2>{0.538325369f, 0.590635896f},
-std::array<float,2>{0.430160671f, 0.840812445f},
-std::array<float,2>{0.902776182f, 0.229606211f},
-std::array<float,2>{0.297590017f, 0.0808944255f},
-std::array<float,2>{0.784857273f, 0.944717467f},
-std::array<float,2>{0.0687937289f, 0.678666711f},
-std::array<float,2>{0.709251285f, 0.411018699f},
-std::array<float,2>{0.230095044f, 0.0194321144f},
-std::array<float,2>{0.616255939f, 0.904684663f},
-std::array<float,2>{0.496003598f, 0.695042133f},
-std::array<float,2>{0.974874794f, 0.454106629f},
-std::array<float,2>{0.353590637f, 0.352474928f},
-std::array<float,2>{0.837828815f, 0.549415588f},
-std::array<float,2>{0.0398116f, 0.794408381f},
-std::array<float,2>{0.684480011f, 0.155401975f},
-std::array<float,2>{0.108806126f, 0.387984723f},
-std::array<float,2>{0.740775704f, 0.628694654f},
-std::array<float,2>{0.251205683f, 0.986682057f},
-std::array<float,2>{0.769423425f, 0.124405973f},
-std::array<float,2>{0.388113409f, 0.205371961f},
-std::array<float,2>{0.927904785f, 0.87032187f},
-std::array<float,2>{0.180556968f, 0.603159249f},
-std::array<float,2>{0.515963733f, 0.307260901f},
-std::array<float,2>{0.132204458f, 0.161175951f},
-std::array<float,2>{0.544098914f, 0.752217114f},
-std::array<float,2>{0.423106432f, 0.506068826f},
-std::array<float,2>{0.895435095f, 0.322049141f},
-std::array<float,2>{0.308906704f, 0.499920458f},
-std::array<float,2>{0.794063985f, 0.740029097f},
-std::array<float,2>{0.073696211f, 0.932552576f},
-std::array<float,2>{0.717427313f, 0.0474540442f},
-std::array<float,2>{0.00206762762f, 0.263688058f},
-std::array<float,2>{0.635498703f, 0.565623283f},
-std::array<float,2>{0.315993518f, 0.821372926f},
-std::array<float,2>{0.868899405f, 0.235259712f},
-std::array<float,2>{0.453800946f, 0.0694991946f},
-std::array<float,2>{0.966687918f, 0.964547038f},
-std::array<float,2>{0.21789299f, 0.666471601f},
-std::array<float,2>{0.581804395f, 0.426526189f},
-std::array<float,2>{0.09923926f, 0.0138295954f},
-std::array<float,2>{0.742289007f, 0.883486152f},
-std::array<float,2>{0.259816289f, 0.705959797f},
-std::array<float,2>{0.777278721f, 0.451983809f},
-std::array<float,2>{0.376158476f, 0.371532857f},
-std::array<float,2>{0.937460601f, 0.535846949f},
-std::array<float,2>{0.178394869f, 0.805636287f},
-std::array<float,2>{0.529834926f, 0.139153451f},
-std::array<float,2>{0.220583871f, 0.393651307f},
-std::array<float,2>{0.619866669f, 0.649251997f},
-std::array<float,2>{0.487579226f, 0.972786307f},
-std::array<float,2>{0.984013081f, 0.105418026f},
-std::array<float,2>{0.347868919f, 0.19953461f},
-std::array<float,2>{0.835027099f, 0.849475205f},
-std::array<float,2>{0.0329605266f, 0.61113435f},
-std::array<float,2>{0.677606881f, 0.286270589f},
-std::array<float,2>{0.0508851223f, 0.232244253f},
-std::array<float,2>{0.66766113f, 0.839809716f},
-std::array<float,2>{0.368560761f, 0.589641571f},
-std::array<float,2>{0.817835212f, 0.273621798f},
-std::array<float,2>{0.481294423f, 0.406265825f},
-std::array<float,2>{0.995405495f, 0.675496995f},
-std::array<float,2>{0.244716212f, 0.94133538f},
-std::array<float,2>{0.604772151f, 0.0846910253f},
-std::array<float,2>{0.15955314f, 0.331250668f},
-std::array<float,2>{0.503130853f, 0.520314932f},
-std::array<float,2>{0.392989099f, 0.766387343f},
-std::array<float,2>{0.916916072f, 0.177242458f},
-std::array<float,2>{0.267290205f, 0.0374528207f},
-std::array<float,2>{0.755937636f, 0.907266915f},
-std::array<float,2>{0.114850692f, 0.733686447f},
-std::array<float,2>{0.731368184f, 0.476453513f},
-std::array<float,2>{0.199076593f, 0.117784612f},
-std::array<float,2>{0.572283208f, 0.990246177f},
-std::array<float,2>{0.441574186f, 0.632534146f},
-std::array<float,2>{0.940301001f, 0.383555889f},
-std::array<float,2>{0.334153473f, 0.308633447f},
-std::array<float,2>{0.846202075f, 0.607490659f},
-std::array<float,2>{0.0258909166f, 0.872960925f},
-std::array<float,2>{0.646904469f, 0.207074836f},
-std::array<float,2>{0.0867374763f, 0.458125442f},
-std::array<float,2>{0.693868876f, 0.688246429f},
-std::array<float,2>{0.294779629f, 0.898782372f},
-std::array<float,2>{0.807985783f, 0.0208091289f},
-std::array<float,2>{0.410492271f, 0.151722461f},
-std::array<float,2>{0.88865298f, 0.791111231f},
-std::array<float,2>{0.15397273f, 0.553148806f},
-std::array<float,2>{0.558280945f, 0.357273608f},
-std::array<float,2>{0.235400051f, 0.214565605f},
-std::array<float,2>{0.599372625f, 0.860061109f},
-std::array<float,2>{0.476036698f, 0.600389421f},
-std::array<float,2>{0.987506628f, 0.301788747f},
-std::array<float,2>{0.360641927f, 0.382518351f},
-std::array<float,2>{0.824633956f, 0.634214282f},
-std::array<float,2>{0.0556101017f, 0.999209583f},
-std::array<float,2>{0.65979898f, 0.114261225f},
-std::array<float,2>{0.121953771f, 0.350085765f},
-std::array<float,2>{0.722937763f, 0.5575068f},
-std::array<float,2>{0.277149707f, 0.782028675f},
-std::array<float,2>{0.762940168f, 0.146811262f},
-std::array<float,2>{0.399276942f, 0.0307416916f},
-std::array<float,2>{0.910411656f, 0.897480011f},
-std::array<float,2>{0.165574655f, 0.702103019f},
-std::array<float,2>{0.508375585f, 0.461862445f},
-std::array<float,2>{0.0161675382f, 0.0921472833f},
-std::array<float,2>{0.653769314f, 0.946149528f},
-std::array<float,2>{0.337257534f, 0.682215154f},
-std::array<float,2>{0.851991892f, 0.420938194f},
-std::array<float,2>{0.452394575f, 0.267317951f},
-std::array<float,2>{0.947762072f, 0.584999859f},
-std::array<float,2>{0.188533023f, 0.831986904f},
-std::array<float,2>{0.564195633f, 0.222934723f},
-std::array<float,2>{0.142005399f, 0.483268291f},
-std::array<float,2>{0.550002813f, 0.72092092f},
-std::array<float,2>{0.415347546f, 0.918858826f},
-std::array<float,2>{0.875386834f, 0.0393681303f},
-std::array<float,2>{0.286860824f, 0.182788894f},
-std::array<float,2>{0.797328055f, 0.77385354f},
-std::array<float,2>{0.0833044797f, 0.531124771f},
-std::array<float,2>{0.699154437f, 0.33643806f},
-std::array<float,2>{0.0651018769f, 0.128236011f},
-std::array<float,2>{0.706619263f, 0.800381124f},
-std::array<float,2>{0.303869307f, 0.543475986f},
-std::array<float,2>{0.786221027f, 0.365911782f},
-std::array<float,2>{0.436623424f, 0.438506424f},
-std::array<float,2>{0.899145782f, 0.713464499f},
-std::array<float,2>{0.13479273f, 0.876734436f},
-std::array<float,2>{0.534161925f, 0.00505608693f},
-std::array<float,2>{0.206165031f, 0.294872373f},
-std::array<float,2>{0.589773774f, 0.61867696f},
-std::array<float,2>{0.468169272f, 0.853678763f},
-std::array<float,2>{0.956381261f, 0.188709006f},
-std::array<float,2>{0.323715895f, 0.0939389393f},
-std::array<float,2>{0.862613678f, 0.977614939f},
-std::array<float,2>{0.0138412528f, 0.647637129f},
-std::array<float,2>{0.626122594f, 0.405965775f},
-std::array<float,2>{0.187401861f, 0.0552526079f},
-std::array<float,2>{0.520668745f, 0.922035754f},
-std::array<float,2>{0.386294574f, 0.748996675f},
-std::array<float,2>{0.922133684f, 0.490865439f},
-std::array<float,2>{0.257535934f, 0.317213118f},
-std::array<float,2>{0.770734966f, 0.511878252f},
-std::array<float,2>{0.10435985f, 0.763713241f},
-std::array<float,2>{0.735985696f, 0.164385036f},
-std::array<float,2>{0.0463516302f, 0.435048729f},
-std::array<float,2>{0.68255192f, 0.65720278f},
-std::array<float,2>{0.357566774f, 0.95617491f},
-std::array<float,2>{0.842941761f, 0.0738270357f},
-std::array<float,2>{0.497853935f, 0.244682118f},
-std::array<float,2>{0.971460104f, 0.812759995f},
-std::array<float,2>{0.233176127f, 0.575630367f},
-std::array<float,2>{0.61287421f, 0.252399117f},
-std::array<float,2>{0.247814715f, 0.130244851f},
-std::array<float,2>{0.606329501f, 0.804686725f},
-std::array<float,2>{0.477343172f, 0.540550768f},
-std::array<float,2>{0.997147918f, 0.362562984f},
-std::array<float,2>{0.374735653f, 0.444266737f},
-std::array<float,2>{0.812830508f, 0.715976298f},
-std::array<float,2>{0.0505150594f, 0.879917562f},
-std::array<float,2>{0.671650648f, 0.00301365019f},
-std::array<float,2>{0.110309422f, 0.290475249f},
-std::array<float,2>{0.728125274f, 0.624452591f},
-std::array<float,2>{0.272141397f, 0.857988358f},
-std::array<float,2>{0.751482189f, 0.192842677f},
-std::array<float,2>{0.396305233f, 0.0985808223f},
-std::array<float,2>{0.918455362f, 0.982317567f},
-std::array<float,2>{0.16241774f, 0.6410954f},
-std::array<float,2>{0.505770922f, 0.399236947f},
-std::array<float,2>{0.030932229f, 0.0603059642f},
-std::array<float,2>{0.6433056f, 0.927159131f},
-std::array<float,2>{0.328871697f, 0.743611753f},
-std::array<float,2>{0.850986362f, 0.486063749f},
-std::array<float,2>{0.438402265f, 0.31547761f},
-std::array<float,2>{0.943784356f, 0.509164572f},
-std::array<float,2>{0.200769678f, 0.758961499f},
-std::array<float,2>{0.574790895f, 0.169355601f},
-std::array<float,2>{0.14929986f, 0.430051208f},
-std::array<float,2>{0.560613334f, 0.662535012f},
-std::array<float,2>{0.4075315f, 0.960117936f},
-std::array<float,2>{0.883741021f, 0.0764692351f},
-std::array<float,2>{0.292161107f, 0.248205215f},
-std::array<float,2>{0.809670031f, 0.817335606f},
-std::array<float,2>{0.0910246149f, 0.573891699f},
-std::array<float,2>{0.688824356f, 0.257428855f},
-std::array<float,2>{0.0750912875f, 0.216718167f},
-std::array<float,2>{0.71320945f, 0.863325238f},
-std::array<float,2>{0.308277369f, 0.593977988f},
-std::array<float,2>{0.79226476f, 0.300483435f},
-std::array<float,2>{0.428731322f, 0.37817511f},
-std::array<float,2>{0.891520083f, 0.637321532f},
-std::array<float,2>{0.125809968f, 0.994879127f},
-std::array<float,2>{0.539869785f, 0.109589316f},
-std::array<float,2>{0.214821473f, 0.347381681f},
-std::array<float,2>{0.582603335f, 0.560119629f},
-std::array<float,2>{0.459467888f, 0.787348926f},
-std::array<float,2>{0.964143932f, 0.144357607f},
-std::array<float,2>{0.318002403f, 0.0250536203f},
-std::array<float,2>{0.872296512f, 0.891657054f},
-std::array<float,2>{0.00466399034f, 0.69571501f},
-std::array<float,2>{0.639790773f, 0.466873497f},
-std::array<float,2>{0.173236981f, 0.0896459073f},
-std::array<float,2>{0.525624573f, 0.950662553f},
-std::array<float,2>{0.38063252f, 0.685866773f},
-std::array<float,2>{0.932942688f, 0.416212201f},
-std::array<float,2>{0.264010519f, 0.273097426f},
-std::array<float,2>{0.781100929f, 0.581688404f},
-std::array<float,2>{0.0944917873f, 0.832663178f},
-std::array<float,2>{0.748523235f, 0.222116485f},
-std::array<float,2>{0.0364003293f, 0.477965146f},
-std::array<float,2>{0.673502207f, 0.724288702f},
-std::array<float,2>{0.343807399f, 0.91590488f},
-std::array<float,2>{0.829263747f, 0.0432753377f},
-std::array<float,2>{0.488318861f, 0.184837893f},
-std::array<float,2>{0.977173924f, 0.78121525f},
-std::array<float,2>{0.223731086f, 0.523566544f},
-std::array<float,2>{0.621922731f, 0.340583324f},
-std::array<float,2>{0.137010917f, 0.228863582f},
-std::array<float,2>{0.535575688f, 0.841380775f},
-std::array<float,2>{0.432683468f, 0.59146452f},
-std::array<float,2>{0.905642152f, 0.280685633f},
-std::array<float,2>{0.299380511f, 0.411435783f},
-std::array<float,2>{0.782625973f, 0.679549873f},
-std::array<float,2>{0.0675229356f, 0.943442583f},
-std::array<float,2>{0.708640099f, 0.0811702907f},
-std::array<float,2>{0.00849372428f, 0.333346039f},
-std::array<float,2>{0.63004601f, 0.517599881f},
-std::array<float,2>{0.324940026f, 0.769750237f},
-std::array<float,2>{0.866626322f, 0.17356655f},
-std::array<float,2>{0.464310378f, 0.033768408f},
-std::array<float,2>{0.960116625f, 0.912168384f},
-std::array<float,2>{0.209268406f, 0.72869122f},
-std::array<float,2>{0.59089601f, 0.470652431f},
-std::array<float,2>{0.105545267f, 0.123346113f},
-std::array<float,2>{0.739844441f, 0.987344503f},
-std::array<float,2>{0.253485322f, 0.62792635f},
-std::array<float,2>{0.766278386f, 0.387069136f},
-std::array<float,2>{0.390056044f, 0.308566481f},
-std::array<float,2>{0.925828695f, 0.602315664f},
-std::array<float,2>{0.182752207f, 0.869337618f},
-std::array<float,2>{0.517800152f, 0.206227079f},
-std::array<float,2>{0.226900607f, 0.45315367f},
-std::array<float,2>{0.61342144f, 0.693513572f},
-std::array<float,2>{0.494072914f, 0.905761957f},
-std::array<float,2>{0.973822773f, 0.0184855442f},
-std::array<float,2>{0.352514029f, 0.154783905f},
-std::array<float,2>{0.838492393f, 0.793218672f},
-std::array<float,2>{0.042742081f, 0.549975336f},
-std::array<float,2>{0.685933173f, 0.352757692f},
-std::array<float,2>{0.0606726743f, 0.158978194f},
-std::array<float,2>{0.662306845f, 0.754416108f},
-std::array<float,2>{0.365357876f, 0.501026273f},
-std::array<float,2>{0.820454717f, 0.327826947f},
-std::array<float,2>{0.470075995f, 0.493739486f},
-std::array<float,2>{0.99192518f, 0.736967444f},
-std::array<float,2>{0.238398045f, 0.936853766f},
-std::array<float,2>{0.596433401f, 0.0520889759f},
-std::array<float,2>{0.171605051f, 0.260709792f},
-std::array<float,2>{0.51404798f, 0.568431616f},
-std::array<float,2>{0.405541599f, 0.82797122f},
-std::array<float,2>{0.908942521f, 0.238986f},
-std::array<float,2>{0.278932065f, 0.0661582276f},
-std::array<float,2>{0.758378148f, 0.966109216f},
-std::array<float,2>{0.119661584f, 0.668354392f},
-std::array<float,2>{0.720646441f, 0.424824744f},
-std::array<float,2>{0.193572849f, 0.00960443076f},
-std::array<float,2>{0.569001257f, 0.888105512f},
-std::array<float,2>{0.448494822f, 0.708883584f},
-std::array<float,2>{0.952481627f, 0.445896715f},
-std::array<float,2>{0.341457933f, 0.36718753f},
-std::array<float,2>{0.857726455f, 0.532474875f},
-std::array<float,2>{0.0216072779f, 0.808950067f},
-std::array<float,2>{0.649224937f, 0.136236042f},
-std::array<float,2>{0.0814323276f, 0.39776963f},
-std::array<float,2>{0.700028121f, 0.654183388f},
-std::array<float,2>{0.283522993f, 0.970731854f},
-std::array<float,2>{0.801445782f, 0.108965032f},
-std::array<float,2>{0.4182235f, 0.199098825f},
-std::array<float,2>{0.880545974f, 0.846704841f},
-std::array<float,2>{0.144552663f, 0.616251826f},
-std::array<float,2>{0.552842259f, 0.282791942f},
-std::array<float,2>{0.157911688f, 0.176564366f},
-std::array<float,2>{0.50194782f, 0.767363429f},
-std::array<float,2>{0.39139083f, 0.52121824f},
-std::array<float,2>{0.914352238f, 0.330261499f},
-std::array<float,2>{0.268123806f, 0.475011349f},
-std::array<float,2>{0.755046606f, 0.732787073f},
-std::array<float,2>{0.115548596f, 0.906409085f},
-std::array<float,2>{0.73298049f, 0.0383288562f},
-std::array<float,2>{0.053352356f, 0.274620205f},
-std::array<float,2>{0.664898992f, 0.588139653f},
-std::array<float,2>{0.369619042f, 0.838337839f},
-std::array<float,2>{0.820127845f, 0.230960116f},
-std::array<float,2>{0.482797682f, 0.0850436836f},
-std::array<float,2>{0.992774427f, 0.939621449f},
-std::array<float,2>{0.242964268f, 0.674447298f},
-std::array<float,2>{0.601698101f, 0.408082962f},
-std::array<float,2>{0.0886449739f, 0.0200403947f},
-std::array<float,2>{0.69149965f, 0.899660885f},
-std::array<float,2>{0.295734525f, 0.688922226f},
-std::array<float,2>{0.80570668f, 0.457578063f},
-std::array<float,2>{0.412164629f, 0.355621368f},
-std::array<float,2>{0.889183819f, 0.554296792f},
-std::array<float,2>{0.1559764f, 0.792586386f},
-std::array<float,2>{0.55663532f, 0.151078776f},
-std::array<float,2>{0.195644051f, 0.384179235f},
-std::array<float,2>{0.570798755f, 0.631519854f},
-std::array<float,2>{0.443819523f, 0.99133122f},
-std::array<float,2>{0.938691378f, 0.118825637f},
-std::array<float,2>{0.333042175f, 0.208375484f},
-std::array<float,2>{0.844126284f, 0.871428311f},
-std::array<float,2>{0.0241431016f, 0.608768225f},
-std::array<float,2>{0.645386577f, 0.309829324f},
-std::array<float,2>{0.00160403678f, 0.235790998f},
-std::array<float,2>{0.633951008f, 0.820644379f},
-std::array<float,2>{0.313051164f, 0.565398514f},
-std::array<float,2>{0.869925559f, 0.265004545f},
-std::array<float,2>{0.455973417f, 0.427493721f},
-std::array<float,2>{0.967960119f, 0.66749686f},
-std::array<float,2>{0.215730339f, 0.963535726f},
-std::array<float,2>{0.579709113f, 0.0689634383f},
-std::array<float,2>{0.13081041f, 0.320859611f},
-std::array<float,2>{0.545877874f, 0.507304132f},
-std::array<float,2>{0.425558239f, 0.753122151f},
-std::array<float,2>{0.896886706f, 0.16071701f},
-std::array<float,2>{0.312432081f, 0.0487980545f},
-std::array<float,2>{0.796679854f, 0.93295002f},
-std::array<float,2>{0.0715417862f, 0.738470554f},
-std::array<float,2>{0.715515971f, 0.498903245f},
-std::array<float,2>{0.220780462f, 0.104429536f},
-std::array<float,2>{0.617405474f, 0.97401464f},
-std::array<float,2>{0.485213697f, 0.65018487f},
-std::array<float,2>{0.981538177f, 0.39291513f},
-std::array<float,2>{0.350776583f, 0.285211742f},
-std::array<float,2>{0.833802164f, 0.609983921f},
-std::array<float,2>{0.0332818553f, 0.848062158f},
-std::array<float,2>{0.679477155f, 0.200675353f},
-std::array<float,2>{0.10145136f, 0.4528943f},
-std::array<float,2>{0.744962215f, 0.70679307f},
-std::array<float,2>{0.2591497f, 0.884241462f},
-std::array<float,2>{0.774559081f, 0.0151001969f},
-std::array<float,2>{0.377071261f, 0.140139088f},
-std::array<float,2>{0.935090125f, 0.80663377f},
-std::array<float,2>{0.176569104f, 0.536158741f},
-std::array<float,2>{0.528001785f, 0.372353196f},
-std::array<float,2>{0.203623712f, 0.188032106f},
-std::array<float,2>{0.586497605f, 0.855337322f},
-std::array<float,2>{0.466155827f, 0.617803156f},
-std::array<float,2>{0.953769565f, 0.293932647f},
-std::array<float,2>{0.321403146f, 0.404861331f},
-std::array<float,2>{0.859846354f, 0.646870255f},
-std::array<float,2>{0.011919979f, 0.977284849f},
-std::array<float,2>{0.628074586f, 0.0956610888f},
-std::array<float,2>{0.0631946847f, 0.366663396f},
-std::array<float,2>{0.704986513f, 0.544297755f},
-std::array<float,2>{0.302412271f, 0.798956752f},
-std::array<float,2>{0.788100481f, 0.127798796f},
-std::array<float,2>{0.434278697f, 0.004625984f},
-std::array<float,2>{0.900874376f, 0.875146806f},
-std::array<float,2>{0.133072972f, 0.714619577f},
-std::array<float,2>{0.532250047f, 0.437705874f},
-std::array<float,2>{0.0434283465f, 0.0729421601f},
-std::array<float,2>{0.68042469f, 0.955809057f},
-std::array<float,2>{0.355816782f, 0.65736872f},
-std::array<float,2>{0.841707766f, 0.433959723f},
-std::array<float,2>{0.498836428f, 0.25297451f},
-std::array<float,2>{0.970242083f, 0.574722648f},
-std::array<float,2>{0.231998295f, 0.814345181f},
-std::array<float,2>{0.610374093f, 0.245761409f},
-std::array<float,2>{0.18472892f, 0.492027462f},
-std::array<float,2>{0.522118509f, 0.749620795f},
-std::array<float,2>{0.384003222f, 0.923471034f},
-std::array<float,2>{0.925032675f, 0.0559865423f},
-std::array<float,2>{0.254593581f, 0.165937036f},
-std::array<float,2>{0.772060394f, 0.765122414f},
-std::array<float,2>{0.101696387f, 0.5132761f},
-std::array<float,2>{0.737417936f, 0.318016171f},
-std::array<float,2>{0.12398576f, 0.147461846f},
-std::array<float,2>{0.726023495f, 0.782844305f},
-std::array<float,2>{0.27381134f, 0.558393538f},
-std::array<float,2>{0.763790369f, 0.351450861f},
-std::array<float,2>{0.401468396f, 0.461981505f},
-std::array<float,2>{0.913702965f, 0.702721894f},
-std::array<float,2>{0.167374969f, 0.896942019f},
-std::array<float,2>{0.510854721f, 0.0301215351f},
-std::array<float,2>{0.238092661f, 0.301549911f},
-std::array<float,2>{0.600780666f, 0.601030052f},
-std::array<float,2>{0.47325772f, 0.860485315f},
-std::array<float,2>{0.986158371f, 0.213554561f},
-std::array<float,2>{0.361948878f, 0.113766544f},
-std::array<float,2>{0.82714802f, 0.998151898f},
-std::array<float,2>{0.0569439121f, 0.633614659f},
-std::array<float,2>{0.65635401f, 0.381001353f},
-std::array<float,2>{0.143824875f, 0.0408586264f},
-std::array<float,2>{0.548110545f, 0.919639707f},
-std::array<float,2>{0.417803526f, 0.722044349f},
-std::array<float,2>{0.877068162f, 0.483547479f},
-std::array<float,2>{0.287489682f, 0.337053657f},
-std::array<float,2>{0.799833953f, 0.530135512f},
-std::array<float,2>{0.0846349299f, 0.774463356f},
-std::array<float,2>{0.696065605f, 0.182204783f},
-std::array<float,2>{0.0177989043f, 0.419965684f},
-std::array<float,2>{0.655049384f, 0.682679474f},
-std::array<float,2>{0.339540154f, 0.946918488f},
-std::array<float,2>{0.853587866f, 0.0931111947f},
-std::array<float,2>{0.449538112f, 0.223636821f},
-std::array<float,2>{0.947254896f, 0.830159366f},
-std::array<float,2>{0.19095993f, 0.584059119f},
-std::array<float,2>{0.565747857f, 0.266043901f},
-std::array<float,2>{0.202282667f, 0.171854869f},
-std::array<float,2>{0.576649308f, 0.759877563f},
-std::array<float,2>{0.439542979f, 0.510388196f},
-std::array<float,2>{0.943095446f, 0.312601835f},
-std::array<float,2>{0.330216706f, 0.488175899f},
-std::array<float,2>{0.847897172f, 0.745351374f},
-std::array<float,2>{0.0282687955f, 0.929110289f},
-std::array<float,2>{0.640995324f, 0.0610813871f},
-std::array<float,2>{0.0926689431f, 0.254491657f},
-std::array<float,2>{0.689540505f, 0.571832061f},
-std::array<float,2>{0.289716721f, 0.819808006f},
-std::array<float,2>{0.811997831f, 0.246347189f},
-std::array<float,2>{0.408340216f, 0.0756577924f},
-std::array<float,2>{0.885059714f, 0.957390904f},
-std::array<float,2>{0.151512548f, 0.660628676f},
-std::array<float,2>{0.560286164f, 0.432581604f},
-std::array<float,2>{0.0477645174f, 0.00130443973f},
-std::array<float,2>{0.668438733f, 0.880951226f},
-std::array<float,2>{0.371206015f, 0.718541861f},
-std::array<float,2>{0.815494239f, 0.442055166f},
-std::array<float,2>{0.480130106f, 0.360708147f},
-std::array<float,2>{0.999037206f, 0.542076349f},
-std::array<float,2>{0.248070002f, 0.801108241f},
-std::array<float,2>{0.608304262f, 0.132472187f},
-std::array<float,2>{0.161195815f, 0.401445955f},
-std::array<float,2>{0.506353438f, 0.643962324f},
-std::array<float,2>{0.396611601f, 0.982804f},
-std::array<float,2>{0.920004964f, 0.101065993f},
-std::array<float,2>{0.271102816f, 0.194282904f},
-std::array<float,2>{0.753767014f, 0.856406748f},
-std::array<float,2>{0.111868337f, 0.621142268f},
-std::array<float,2>{0.728878379f, 0.292141885f},
-std::array<float,2>{0.095770821f, 0.219424754f},
-std::array<float,2>{0.746411681f, 0.835665584f},
-std::array<float,2>{0.262408465f, 0.579751253f},
-std::array<float,2>{0.777558923f, 0.270888627f},
-std::array<float,2>{0.381160498f, 0.415029377f},
-std::array<float,2>{0.930466354f, 0.685312748f},
-std::array<float,2>{0.174624115f, 0.951396704f},
-std::array<float,2>{0.524240196f, 0.0878729895f},
-std::array<float,2>{0.224825993f, 0.341871202f},
-std::array<float,2>{0.624248266f, 0.525802255f},
-std::array<float,2>{0.490494877f, 0.777719736f},
-std::array<float,2>{0.978595734f, 0.186290786f},
-std::array<float,2>{0.346170932f, 0.0466437005f},
-std::array<float,2>{0.83126992f, 0.916906357f},
-std::array<float,2>{0.0381124988f, 0.726052761f},
-std::array<float,2>{0.674449325f, 0.480436444f},
-std::array<float,2>{0.127105594f, 0.113254808f},
-std::array<float,2>{0.542334497f, 0.992401361f},
-std::array<float,2>{0.427695483f, 0.638855517f},
-std::array<float,2>{0.893215477f, 0.376504064f},
-std::array<float,2>{0.306408435f, 0.29797703f},
-std::array<float,2>{0.790366471f, 0.596562982f},
-std::array<float,2>{0.0772401467f, 0.865866721f},
-std::array<float,2>{0.712355375f, 0.216859654f},
-std::array<float,2>{0.00702840602f, 0.465284556f},
-std::array<float,2>{0.63849014f, 0.698079109f},
-std::array<float,2>{0.318950385f, 0.893914104f},
-std::array<float,2>{0.873771131f, 0.0263119619f},
-std::array<float,2>{0.457470626f, 0.141699404f},
-std::array<float,2>{0.962865174f, 0.785936296f},
-std::array<float,2>{0.211754486f, 0.561552465f},
-std::array<float,2>{0.584577739f, 0.343795776f},
-std::array<float,2>{0.181510165f, 0.204790562f},
-std::array<float,2>{0.517066717f, 0.868380249f},
-std::array<float,2>{0.386890441f, 0.605075181f},
-std::array<float,2>{0.929526031f, 0.305000305f},
-std::array<float,2>{0.250928491f, 0.390079826f},
-std::array<float,2>{0.768466115f, 0.626921415f},
-std::array<float,2>{0.107903227f, 0.984972f},
-std::array<float,2>{0.742032707f, 0.121577926f},
-std::array<float,2>{0.0409499034f, 0.353727669f},
-std::array<float,2>{0.685006022f, 0.547359109f},
-std::array<float,2>{0.35505715f, 0.796725869f},
-std::array<float,2>{0.836635232f, 0.153065711f},
-std::array<float,2>{0.494644731f, 0.016912261f},
-std::array<float,2>{0.976133585f, 0.903437257f},
-std::array<float,2>{0.229317978f, 0.691670895f},
-std::array<float,2>{0.615733802f, 0.456408262f},
-std::array<float,2>{0.0700928792f, 0.079463914f},
-std::array<float,2>{0.710458279f, 0.942264497f},
-std::array<float,2>{0.298400283f, 0.676313043f},
-std::array<float,2>{0.783706248f, 0.413487911f},
-std::array<float,2>{0.430839062f, 0.278979838f},
-std::array<float,2>{0.903793454f, 0.592182755f},
-std::array<float,2>{0.140531585f, 0.842734396f},
-std::array<float,2>{0.537486732f, 0.22708495f},
-std::array<float,2>{0.208021089f, 0.470722169f},
-std::array<float,2>{0.592896461f, 0.726923168f},
-std::array<float,2>{0.462740511f, 0.910642028f},
-std::array<float,2>{0.958738506f, 0.0322137438f},
-std::array<float,2>{0.327097386f, 0.173992604f},
-std::array<float,2>{0.865026414f, 0.773030579f},
-std::array<float,2>{0.0110265901f, 0.517055452f},
-std::array<float,2>{0.63200295f, 0.335164666f},
-std::array<float,2>{0.0209661666f, 0.13366656f},
-std::array<float,2>{0.651606619f, 0.811089158f},
-std::array<float,2>{0.342237949f, 0.533877552f},
-std::array<float,2>{0.857164621f, 0.370795131f},
-std::array<float,2>{0.446924686f, 0.448213279f},
-std::array<float,2>{0.950855911f, 0.710324645f},
-std::array<float,2>{0.19297865f, 0.890164196f},
-std::array<float,2>{0.568154812f, 0.0106147081f},
-std::array<float,2>{0.147223055f, 0.28438592f},
-std::array<float,2>{0.55088377f, 0.614976168f},
-std::array<float,2>{0.420164376f, 0.844362378f},
-std::array<float,2>{0.881584525f, 0.19637756f},
-std::array<float,2>{0.282034665f, 0.105493791f},
-std::array<float,2>{0.803583086f, 0.970222175f},
-std::array<float,2>{0.0795582458f, 0.65566653f},
-std::array<float,2>{0.702799559f, 0.396020055f},
-std::array<float,2>{0.240426183f, 0.0540229008f},
-std::array<float,2>{0.594346285f, 0.93360126f},
-std::array<float,2>{0.472607076f, 0.734725714f},
-std::array<float,2>{0.989596248f, 0.494857877f},
-std::array<float,2>{0.364433676f, 0.325227827f},
-std::array<float,2>{0.823861778f, 0.50328505f},
-std::array<float,2>{0.0590079986f, 0.757493973f},
-std::array<float,2>{0.661888957f, 0.157650203f},
-std::array<float,2>{0.118800886f, 0.422910869f},
-std::array<float,2>{0.721778035f, 0.670029104f},
-std::array<float,2>{0.279540181f, 0.968396127f},
-std::array<float,2>{0.760208666f, 0.0625407174f},
-std::array<float,2>{0.402969658f, 0.241954833f},
-std::array<float,2>{0.906695068f, 0.826098382f},
-std::array<float,2>{0.169873729f, 0.567493379f},
-std::array<float,2>{0.513402641f, 0.257953674f},
-std::array<float,2>{0.153159574f, 0.148778364f},
-std::array<float,2>{0.557272911f, 0.790336788f},
-std::array<float,2>{0.411411822f, 0.551562309f},
-std::array<float,2>{0.88702035f, 0.35793829f},
-std::array<float,2>{0.293396622f, 0.460808069f},
-std::array<float,2>{0.806990325f, 0.690451145f},
-std::array<float,2>{0.0876769125f, 0.901216149f},
-std::array<float,2>{0.694598973f, 0.0220677983f},
-std::array<float,2>{0.0268999822f, 0.312354445f},
-std::array<float,2>{0.64811337f, 0.606407046f},
-std::array<float,2>{0.335763514f, 0.873400867f},
-std::array<float,2>{0.847054303f, 0.210508168f},
-std::array<float,2>{0.442939907f, 0.120744653f},
-std::array<float,2>{0.941013813f, 0.990024984f},
-std::array<float,2>{0.197519153f, 0.629479587f},
-std::array<float,2>{0.573779285f, 0.385884792f},
-std::array<float,2>{0.113582328f, 0.0361538418f},
-std::array<float,2>{0.732296944f, 0.910081208f},
-std::array<float,2>{0.266409516f, 0.732396722f},
-std::array<float,2>{0.757602632f, 0.474601001f},
-std::array<float,2>{0.394341528f, 0.3298513f},
-std::array<float,2>{0.917843699f, 0.522239506f},
-std::array<float,2>{0.158609957f, 0.768706083f},
-std::array<float,2>{0.502434015f, 0.179133281f},
-std::array<float,2>{0.245858237f, 0.409053266f},
-std::array<float,2>{0.603849828f, 0.672906578f},
-std::array<float,2>{0.482154667f, 0.938460708f},
-std::array<float,2>{0.994177222f, 0.0826858655f},
-std::array<float,2>{0.367399096f, 0.232706264f},
-std::array<float,2>{0.816536188f, 0.836224854f},
-std::array<float,2>{0.052441027f, 0.586877823f},
-std::array<float,2>{0.666827738f, 0.276464194f},
-std::array<float,2>{0.0314422473f, 0.202949762f},
-std::array<float,2>{0.676752567f, 0.850977302f},
-std::array<float,2>{0.34906292f, 0.61309731f},
-std::array<float,2>{0.834564388f, 0.287361383f},
-std::array<float,2>{0.487217903f, 0.391193748f},
-std::array<float,2>{0.983382702f, 0.650489092f},
-std::array<float,2>{0.219655097f, 0.976353943f},
-std::array<float,2>{0.620262504f, 0.102843575f},
-std::array<float,2>{0.178850725f, 0.37331447f},
-std::array<float,2>{0.53072381f, 0.53823185f},
-std::array<float,2>{0.375666112f, 0.807743728f},
-std::array<float,2>{0.935613573f, 0.138372779f},
-std::array<float,2>{0.26094678f, 0.0123059638f},
-std::array<float,2>{0.775649726f, 0.885355711f},
-std::array<float,2>{0.0984930024f, 0.704941571f},
-std::array<float,2>{0.744018793f, 0.450315535f},
-std::array<float,2>{0.217338204f, 0.0677249655f},
-std::array<float,2>{0.580146134f, 0.962074995f},
-std::array<float,2>{0.454618901f, 0.664524496f},
-std::array<float,2>{0.965285659f, 0.429018229f},
-std::array<float,2>{0.314577401f, 0.261841387f},
-std::array<float,2>{0.867206097f, 0.563008964f},
-std::array<float,2>{0.00362165668f, 0.823165119f},
-std::array<float,2>{0.636205673f, 0.23760666f},
-std::array<float,2>{0.0727720857f, 0.497812808f},
-std::array<float,2>{0.71860075f, 0.741802156f},
-std::array<float,2>{0.309793681f, 0.930166721f},
-std::array<float,2>{0.793137193f, 0.0504708998f},
-std::array<float,2>{0.422641784f, 0.163737684f},
-std::array<float,2>{0.89559263f, 0.750302732f},
-std::array<float,2>{0.13120921f, 0.503910422f},
-std::array<float,2>{0.543082595f, 0.323645353f},
-std::array<float,2>{0.233787507f, 0.243022412f},
-std::array<float,2>{0.61213541f, 0.815282166f},
-std::array<float,2>{0.49619031f, 0.577128828f},
-std::array<float,2>{0.972340643f, 0.251881838f},
-std::array<float,2>{0.359181225f, 0.436739802f},
-std::array<float,2>{0.842230558f, 0.658709347f},
-std::array<float,2>{0.0452764183f, 0.953571677f},
-std::array<float,2>{0.682727337f, 0.071437858f},
-std::array<float,2>{0.104933783f, 0.318806887f},
-std::array<float,2>{0.734474599f, 0.515563786f},
-std::array<float,2>{0.256152064f, 0.763276756f},
-std::array<float,2>{0.770361483f, 0.166682214f},
-std::array<float,2>{0.385102242f, 0.0567567088f},
-std::array<float,2>{0.923088372f, 0.925350189f},
-std::array<float,2>{0.186520532f, 0.746643484f},
-std::array<float,2>{0.519582987f, 0.488828033f},
-std::array<float,2>{0.0151599087f, 0.0974357575f},
-std::array<float,2>{0.625218928f, 0.979780018f},
-std::array<float,2>{0.323151261f, 0.645369172f},
-std::array<float,2>{0.861677766f, 0.40328154f},
-std::array<float,2>{0.467398554f, 0.296503901f},
-std::array<float,2>{0.955999196f, 0.620756149f},
-std::array<float,2>{0.20544748f, 0.85262388f},
-std::array<float,2>{0.58818084f, 0.190450236f},
-std::array<float,2>{0.136715874f, 0.439547837f},
-std::array<float,2>{0.534812748f, 0.711477458f},
-std::array<float,2>{0.435941517f, 0.877294362f},
-std::array<float,2>{0.899804831f, 0.00695843855f},
-std::array<float,2>{0.303381711f, 0.125254914f},
-std::array<float,2>{0.785928488f, 0.798436105f},
-std::array<float,2>{0.0659971759f, 0.545309603f},
-std::array<float,2>{0.705993593f, 0.363565445f},
-std::array<float,2>{0.0821401104f, 0.180964813f},
-std::array<float,2>{0.69810921f, 0.776289523f},
-std::array<float,2>{0.285612047f, 0.528785229f},
-std::array<float,2>{0.798206449f, 0.338196754f},
-std::array<float,2>{0.414732784f, 0.480623066f},
-std::array<float,2>{0.876330495f, 0.720181227f},
-std::array<float,2>{0.141379505f, 0.921721101f},
-std::array<float,2>{0.549563885f, 0.0414447747f},
-std::array<float,2>{0.188417867f, 0.268059105f},
-std::array<float,2>{0.562541425f, 0.582932949f},
-std::array<float,2>{0.452071607f, 0.82943809f},
-std::array<float,2>{0.948578358f, 0.224723011f},
-std::array<float,2>{0.336455315f, 0.0898631066f},
-std::array<float,2>{0.853349745f, 0.947743058f},
-std::array<float,2>{0.0173670165f, 0.681468427f},
-std::array<float,2>{0.652536333f, 0.419064552f},
-std::array<float,2>{0.164063513f, 0.0280519854f},
-std::array<float,2>{0.509230971f, 0.896213591f},
-std::array<float,2>{0.400026977f, 0.700453162f},
-std::array<float,2>{0.911563516f, 0.463077694f},
-std::array<float,2>{0.275490016f, 0.349447191f},
-std::array<float,2>{0.761969805f, 0.555695951f},
-std::array<float,2>{0.122131534f, 0.783388734f},
-std::array<float,2>{0.72372061f, 0.146420017f},
-std::array<float,2>{0.0559928678f, 0.379820079f},
-std::array<float,2>{0.658357918f, 0.636438966f},
-std::array<float,2>{0.359513909f, 0.997649074f},
-std::array<float,2>{0.825927794f, 0.115760818f},
-std::array<float,2>{0.474748015f, 0.212249473f},
-std::array<float,2>{0.986871302f, 0.862574637f},
-std::array<float,2>{0.235305935f, 0.597771049f},
-std::array<float,2>{0.597659588f, 0.30443725f}}
\ No newline at end of file
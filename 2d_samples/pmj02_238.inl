@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.846639097f, 0.827560484f},
-std::array<float,2>{0.269322723f, 0.266349673f},
-std::array<float,2>{0.0809318274f, 0.535973251f},
-std::array<float,2>{0.739566386f, 0.0288554635f},
-std::array<float,2>{0.533801138f, 0.739544868f},
-std::array<float,2>{0.134929121f, 0.245479569f},
-std::array<float,2>{0.394914716f, 0.972554088f},
-std::array<float,2>{0.997401416f, 0.454739183f},
-std::array<float,2>{0.907845497f, 0.61822623f},
-std::array<float,2>{0.496277183f, 0.123281084f},
-std::array<float,2>{0.238744035f, 0.762892187f},
-std::array<float,2>{0.617082477f, 0.320954502f},
-std::array<float,2>{0.645521104f, 0.915754497f},
-std::array<float,2>{0.0197904799f, 0.391937345f},
-std::array<float,2>{0.359210998f, 0.669882238f},
-std::array<float,2>{0.756143749f, 0.158485115f},
-std::array<float,2>{0.961010158f, 0.940508366f},
-std::array<float,2>{0.420346469f, 0.492897362f},
-std::array<float,2>{0.160577923f, 0.700015306f},
-std::array<float,2>{0.506509185f, 0.205443472f},
-std::array<float,2>{0.691746294f, 0.529989064f},
-std::array<float,2>{0.116619803f, 0.0426887274f},
-std::array<float,2>{0.298565835f, 0.853024423f},
-std::array<float,2>{0.81633383f, 0.284787804f},
-std::array<float,2>{0.79712224f, 0.62778163f},
-std::array<float,2>{0.323992699f, 0.142105401f},
-std::array<float,2>{0.0333168842f, 0.87561059f},
-std::array<float,2>{0.659572959f, 0.40675956f},
-std::array<float,2>{0.565037251f, 0.785992861f},
-std::array<float,2>{0.204175323f, 0.361782193f},
-std::array<float,2>{0.45539102f, 0.569191813f},
-std::array<float,2>{0.901184916f, 0.0762282535f},
-std::array<float,2>{0.875005722f, 0.775692642f},
-std::array<float,2>{0.453022599f, 0.328313708f},
-std::array<float,2>{0.200470388f, 0.608668268f},
-std::array<float,2>{0.578282177f, 0.104010977f},
-std::array<float,2>{0.684803069f, 0.677969456f},
-std::array<float,2>{0.0504979454f, 0.183653817f},
-std::array<float,2>{0.341291904f, 0.931293547f},
-std::array<float,2>{0.787378609f, 0.376200557f},
-std::array<float,2>{0.839252412f, 0.549419284f},
-std::array<float,2>{0.283422858f, 0.0101843579f},
-std::array<float,2>{0.103115208f, 0.83645457f},
-std::array<float,2>{0.715130806f, 0.265045762f},
-std::array<float,2>{0.529398978f, 0.993046165f},
-std::array<float,2>{0.178155318f, 0.439879894f},
-std::array<float,2>{0.431331605f, 0.730092704f},
-std::array<float,2>{0.949023545f, 0.224121094f},
-std::array<float,2>{0.780643284f, 0.900301039f},
-std::array<float,2>{0.368605077f, 0.423088551f},
-std::array<float,2>{0.00334377843f, 0.649460018f},
-std::array<float,2>{0.639902294f, 0.136861756f},
-std::array<float,2>{0.596857429f, 0.587977111f},
-std::array<float,2>{0.234170467f, 0.0826234594f},
-std::array<float,2>{0.472218871f, 0.809503973f},
-std::array<float,2>{0.929784715f, 0.346504331f},
-std::array<float,2>{0.980999708f, 0.714975119f},
-std::array<float,2>{0.38111496f, 0.201249063f},
-std::array<float,2>{0.140672967f, 0.95344609f},
-std::array<float,2>{0.557066202f, 0.473895073f},
-std::array<float,2>{0.72050494f, 0.865775049f},
-std::array<float,2>{0.0680460408f, 0.307422966f},
-std::array<float,2>{0.265495777f, 0.510662615f},
-std::array<float,2>{0.871221542f, 0.0587493107f},
-std::array<float,2>{0.792438149f, 0.800885022f},
-std::array<float,2>{0.330889106f, 0.353947163f},
-std::array<float,2>{0.0612087287f, 0.581379116f},
-std::array<float,2>{0.674076915f, 0.0913807228f},
-std::array<float,2>{0.591306508f, 0.646935642f},
-std::array<float,2>{0.191129163f, 0.126020595f},
-std::array<float,2>{0.438456625f, 0.895258367f},
-std::array<float,2>{0.887298584f, 0.435646147f},
-std::array<float,2>{0.942030787f, 0.506714404f},
-std::array<float,2>{0.429230303f, 0.0542493761f},
-std::array<float,2>{0.181097507f, 0.867336392f},
-std::array<float,2>{0.522065878f, 0.304667115f},
-std::array<float,2>{0.706540287f, 0.968555093f},
-std::array<float,2>{0.099747397f, 0.47927317f},
-std::array<float,2>{0.294709951f, 0.705135524f},
-std::array<float,2>{0.832977116f, 0.188189f},
-std::array<float,2>{0.928682327f, 0.929218769f},
-std::array<float,2>{0.481905252f, 0.384566069f},
-std::array<float,2>{0.223581299f, 0.686230719f},
-std::array<float,2>{0.60610503f, 0.174582899f},
-std::array<float,2>{0.630882204f, 0.595032036f},
-std::array<float,2>{0.0110102883f, 0.100625068f},
-std::array<float,2>{0.361352563f, 0.768047512f},
-std::array<float,2>{0.768261731f, 0.343470901f},
-std::array<float,2>{0.860179245f, 0.720962524f},
-std::array<float,2>{0.25528726f, 0.234061003f},
-std::array<float,2>{0.0775693208f, 0.991403699f},
-std::array<float,2>{0.728105187f, 0.447899193f},
-std::array<float,2>{0.554338276f, 0.835895836f},
-std::array<float,2>{0.155556485f, 0.25365901f},
-std::array<float,2>{0.389457464f, 0.559499681f},
-std::array<float,2>{0.975925267f, 0.00471906271f},
-std::array<float,2>{0.991752982f, 0.84728086f},
-std::array<float,2>{0.400308758f, 0.295399308f},
-std::array<float,2>{0.128885359f, 0.519172072f},
-std::array<float,2>{0.546219766f, 0.0369456038f},
-std::array<float,2>{0.74944073f, 0.689797342f},
-std::array<float,2>{0.0921548083f, 0.214717522f},
-std::array<float,2>{0.277118742f, 0.946964979f},
-std::array<float,2>{0.858231068f, 0.488914847f},
-std::array<float,2>{0.759201944f, 0.574386179f},
-std::array<float,2>{0.349897057f, 0.0678420365f},
-std::array<float,2>{0.0251950789f, 0.790932417f},
-std::array<float,2>{0.655102253f, 0.370624006f},
-std::array<float,2>{0.622412145f, 0.887329876f},
-std::array<float,2>{0.24788487f, 0.415369689f},
-std::array<float,2>{0.486770302f, 0.633231401f},
-std::array<float,2>{0.918238223f, 0.153197631f},
-std::array<float,2>{0.828013599f, 0.979655445f},
-std::array<float,2>{0.308802962f, 0.467301011f},
-std::array<float,2>{0.123672873f, 0.742195964f},
-std::array<float,2>{0.697065592f, 0.235822648f},
-std::array<float,2>{0.508687437f, 0.545510173f},
-std::array<float,2>{0.16660887f, 0.0192963593f},
-std::array<float,2>{0.414046049f, 0.81787467f},
-std::array<float,2>{0.958988488f, 0.275559157f},
-std::array<float,2>{0.892977178f, 0.66282016f},
-std::array<float,2>{0.462770164f, 0.168156937f},
-std::array<float,2>{0.212412283f, 0.910759747f},
-std::array<float,2>{0.575844944f, 0.400930643f},
-std::array<float,2>{0.668370724f, 0.756314397f},
-std::array<float,2>{0.0397783592f, 0.320114434f},
-std::array<float,2>{0.319781512f, 0.613512874f},
-std::array<float,2>{0.805771172f, 0.109812476f},
-std::array<float,2>{0.831637502f, 0.761150301f},
-std::array<float,2>{0.291097462f, 0.328072637f},
-std::array<float,2>{0.0948971435f, 0.624001741f},
-std::array<float,2>{0.708688319f, 0.118699208f},
-std::array<float,2>{0.517968774f, 0.664739132f},
-std::array<float,2>{0.185458899f, 0.162159964f},
-std::array<float,2>{0.425022513f, 0.921144783f},
-std::array<float,2>{0.939353049f, 0.396829367f},
-std::array<float,2>{0.884458601f, 0.531613529f},
-std::array<float,2>{0.445143461f, 0.0268724933f},
-std::array<float,2>{0.192053244f, 0.823359489f},
-std::array<float,2>{0.586533606f, 0.271711916f},
-std::array<float,2>{0.678620219f, 0.974791944f},
-std::array<float,2>{0.0549602062f, 0.457796812f},
-std::array<float,2>{0.332741022f, 0.73700738f},
-std::array<float,2>{0.794841945f, 0.246358439f},
-std::array<float,2>{0.970222473f, 0.881576955f},
-std::array<float,2>{0.383646965f, 0.411587596f},
-std::array<float,2>{0.148875594f, 0.632541478f},
-std::array<float,2>{0.548276603f, 0.145043224f},
-std::array<float,2>{0.732662141f, 0.565511286f},
-std::array<float,2>{0.0720865726f, 0.0736471564f},
-std::array<float,2>{0.251264215f, 0.782316089f},
-std::array<float,2>{0.863363326f, 0.364967436f},
-std::array<float,2>{0.77169311f, 0.695316553f},
-std::array<float,2>{0.366459399f, 0.209334761f},
-std::array<float,2>{0.0150414202f, 0.942121446f},
-std::array<float,2>{0.628546417f, 0.498201132f},
-std::array<float,2>{0.602267921f, 0.858502626f},
-std::array<float,2>{0.220371231f, 0.285187125f},
-std::array<float,2>{0.480308145f, 0.527249515f},
-std::array<float,2>{0.922196746f, 0.044583451f},
-std::array<float,2>{0.914112866f, 0.841238678f},
-std::array<float,2>{0.490671903f, 0.259815991f},
-std::array<float,2>{0.242582381f, 0.554113328f},
-std::array<float,2>{0.619745314f, 0.011751893f},
-std::array<float,2>{0.649434865f, 0.731433809f},
-std::array<float,2>{0.0290027075f, 0.221243128f},
-std::array<float,2>{0.347138584f, 0.997845709f},
-std::array<float,2>{0.765212774f, 0.442612708f},
-std::array<float,2>{0.853053749f, 0.602055013f},
-std::array<float,2>{0.27796495f, 0.106597178f},
-std::array<float,2>{0.089603141f, 0.777438223f},
-std::array<float,2>{0.743108928f, 0.334185958f},
-std::array<float,2>{0.542006791f, 0.934280932f},
-std::array<float,2>{0.131922945f, 0.380537063f},
-std::array<float,2>{0.404309422f, 0.674542069f},
-std::array<float,2>{0.985233724f, 0.18076551f},
-std::array<float,2>{0.809246004f, 0.958719909f},
-std::array<float,2>{0.313893765f, 0.471271932f},
-std::array<float,2>{0.0439542569f, 0.713511527f},
-std::array<float,2>{0.666432381f, 0.195618898f},
-std::array<float,2>{0.572211862f, 0.514522672f},
-std::array<float,2>{0.216796279f, 0.0574537925f},
-std::array<float,2>{0.465244114f, 0.859770119f},
-std::array<float,2>{0.897841096f, 0.312034726f},
-std::array<float,2>{0.953924239f, 0.654361963f},
-std::array<float,2>{0.409370661f, 0.133049235f},
-std::array<float,2>{0.168257758f, 0.904217064f},
-std::array<float,2>{0.514752626f, 0.429620832f},
-std::array<float,2>{0.702590048f, 0.806176662f},
-std::array<float,2>{0.120431937f, 0.349700719f},
-std::array<float,2>{0.308513939f, 0.592531562f},
-std::array<float,2>{0.823159397f, 0.0786931366f},
-std::array<float,2>{0.752112091f, 0.872427762f},
-std::array<float,2>{0.353884608f, 0.299281478f},
-std::array<float,2>{0.0182482302f, 0.501032114f},
-std::array<float,2>{0.644346237f, 0.0489201732f},
-std::array<float,2>{0.611227751f, 0.709502995f},
-std::array<float,2>{0.235268995f, 0.194943309f},
-std::array<float,2>{0.492371231f, 0.963890612f},
-std::array<float,2>{0.913705945f, 0.481540889f},
-std::array<float,2>{0.995108187f, 0.582496941f},
-std::array<float,2>{0.394164145f, 0.0870217383f},
-std::array<float,2>{0.137162164f, 0.797542334f},
-std::array<float,2>{0.536375046f, 0.358901769f},
-std::array<float,2>{0.736619473f, 0.894259751f},
-std::array<float,2>{0.0844151676f, 0.433172941f},
-std::array<float,2>{0.269748211f, 0.643723428f},
-std::array<float,2>{0.850978076f, 0.132742226f},
-std::array<float,2>{0.903906107f, 0.986201644f},
-std::array<float,2>{0.460237682f, 0.450193256f},
-std::array<float,2>{0.207080901f, 0.723675728f},
-std::array<float,2>{0.566973507f, 0.228753999f},
-std::array<float,2>{0.660972297f, 0.555064201f},
-std::array<float,2>{0.0368142165f, 0.00052262441f},
-std::array<float,2>{0.327428877f, 0.829974413f},
-std::array<float,2>{0.802903891f, 0.255301982f},
-std::array<float,2>{0.818867385f, 0.68157661f},
-std::array<float,2>{0.301364809f, 0.176755086f},
-std::array<float,2>{0.112752154f, 0.923391342f},
-std::array<float,2>{0.689229429f, 0.387884885f},
-std::array<float,2>{0.501009524f, 0.771986485f},
-std::array<float,2>{0.156921819f, 0.336344153f},
-std::array<float,2>{0.415552109f, 0.598038316f},
-std::array<float,2>{0.96761781f, 0.0970992669f},
-std::array<float,2>{0.952352166f, 0.794778705f},
-std::array<float,2>{0.433989912f, 0.372139513f},
-std::array<float,2>{0.175647736f, 0.572449803f},
-std::array<float,2>{0.525119066f, 0.0644353554f},
-std::array<float,2>{0.712150753f, 0.637079179f},
-std::array<float,2>{0.106636725f, 0.150985911f},
-std::array<float,2>{0.28827098f, 0.883815765f},
-std::array<float,2>{0.843239725f, 0.420640498f},
-std::array<float,2>{0.781799376f, 0.522280335f},
-std::array<float,2>{0.337546259f, 0.032441102f},
-std::array<float,2>{0.0542735234f, 0.851254165f},
-std::array<float,2>{0.679952979f, 0.2894274f},
-std::array<float,2>{0.58238095f, 0.953074515f},
-std::array<float,2>{0.197523355f, 0.487156987f},
-std::array<float,2>{0.449112684f, 0.693829179f},
-std::array<float,2>{0.880241632f, 0.216094047f},
-std::array<float,2>{0.868950307f, 0.909318089f},
-std::array<float,2>{0.258942008f, 0.404715687f},
-std::array<float,2>{0.0662376732f, 0.659200251f},
-std::array<float,2>{0.724345803f, 0.167382389f},
-std::array<float,2>{0.558887959f, 0.610931873f},
-std::array<float,2>{0.145626664f, 0.117184632f},
-std::array<float,2>{0.376000643f, 0.753809094f},
-std::array<float,2>{0.979831934f, 0.314744145f},
-std::array<float,2>{0.935801089f, 0.747580588f},
-std::array<float,2>{0.473441601f, 0.240749419f},
-std::array<float,2>{0.227206513f, 0.981349647f},
-std::array<float,2>{0.597840965f, 0.462393492f},
-std::array<float,2>{0.635190308f, 0.815021813f},
-std::array<float,2>{0.00774459494f, 0.28009367f},
-std::array<float,2>{0.372792512f, 0.539785743f},
-std::array<float,2>{0.776099384f, 0.0217426047f},
-std::array<float,2>{0.812744677f, 0.854969382f},
-std::array<float,2>{0.299248278f, 0.281654537f},
-std::array<float,2>{0.113831781f, 0.527983844f},
-std::array<float,2>{0.694057405f, 0.0393784009f},
-std::array<float,2>{0.504437625f, 0.702516198f},
-std::array<float,2>{0.162972331f, 0.2043522f},
-std::array<float,2>{0.418223321f, 0.938579977f},
-std::array<float,2>{0.963131666f, 0.495695651f},
-std::array<float,2>{0.899542153f, 0.568099499f},
-std::array<float,2>{0.453702837f, 0.0761413276f},
-std::array<float,2>{0.20516476f, 0.788069487f},
-std::array<float,2>{0.564411819f, 0.359900743f},
-std::array<float,2>{0.657238841f, 0.877922475f},
-std::array<float,2>{0.0314290039f, 0.409267366f},
-std::array<float,2>{0.322082132f, 0.626907885f},
-std::array<float,2>{0.799793184f, 0.143263251f},
-std::array<float,2>{0.999313235f, 0.969513059f},
-std::array<float,2>{0.398218364f, 0.455620885f},
-std::array<float,2>{0.133104429f, 0.74054116f},
-std::array<float,2>{0.531655073f, 0.242459416f},
-std::array<float,2>{0.741185844f, 0.538701832f},
-std::array<float,2>{0.0800700337f, 0.0303751547f},
-std::array<float,2>{0.265976399f, 0.82573092f},
-std::array<float,2>{0.845225155f, 0.26890716f},
-std::array<float,2>{0.755019546f, 0.670667589f},
-std::array<float,2>{0.356479764f, 0.157976151f},
-std::array<float,2>{0.0218793545f, 0.917385101f},
-std::array<float,2>{0.647297502f, 0.393295318f},
-std::array<float,2>{0.614878535f, 0.764795482f},
-std::array<float,2>{0.240311801f, 0.322776049f},
-std::array<float,2>{0.499661386f, 0.619162142f},
-std::array<float,2>{0.909198463f, 0.122168317f},
-std::array<float,2>{0.931799829f, 0.811211407f},
-std::array<float,2>{0.470121413f, 0.345622659f},
-std::array<float,2>{0.232021615f, 0.586000741f},
-std::array<float,2>{0.595462799f, 0.0852186903f},
-std::array<float,2>{0.637669086f, 0.651851714f},
-std::array<float,2>{0.00117572921f, 0.139553815f},
-std::array<float,2>{0.37007311f, 0.901383519f},
-std::array<float,2>{0.779203296f, 0.42547524f},
-std::array<float,2>{0.873667538f, 0.50835371f},
-std::array<float,2>{0.263467818f, 0.061288029f},
-std::array<float,2>{0.0702942461f, 0.863926649f},
-std::array<float,2>{0.721429765f, 0.306597382f},
-std::array<float,2>{0.555929601f, 0.955778956f},
-std::array<float,2>{0.142763317f, 0.475818962f},
-std::array<float,2>{0.379557341f, 0.717493534f},
-std::array<float,2>{0.983831763f, 0.200889826f},
-std::array<float,2>{0.787016034f, 0.932208061f},
-std::array<float,2>{0.342682958f, 0.377456337f},
-std::array<float,2>{0.0479320437f, 0.677015901f},
-std::array<float,2>{0.686950862f, 0.187162831f},
-std::array<float,2>{0.581100702f, 0.606096804f},
-std::array<float,2>{0.2015104f, 0.101895392f},
-std::array<float,2>{0.450631887f, 0.77419281f},
-std::array<float,2>{0.877819359f, 0.331911057f},
-std::array<float,2>{0.946419656f, 0.727385104f},
-std::array<float,2>{0.431892723f, 0.225775406f},
-std::array<float,2>{0.17626822f, 0.995714366f},
-std::array<float,2>{0.528706074f, 0.439158171f},
-std::array<float,2>{0.718413055f, 0.838030457f},
-std::array<float,2>{0.103749059f, 0.262295425f},
-std::array<float,2>{0.282494277f, 0.548614621f},
-std::array<float,2>{0.836676538f, 0.00888997503f},
-std::array<float,2>{0.765801311f, 0.766085804f},
-std::array<float,2>{0.360785663f, 0.341194391f},
-std::array<float,2>{0.00824518874f, 0.595914543f},
-std::array<float,2>{0.629793823f, 0.0978146046f},
-std::array<float,2>{0.609100878f, 0.684291363f},
-std::array<float,2>{0.225888953f, 0.173149809f},
-std::array<float,2>{0.482821465f, 0.927663922f},
-std::array<float,2>{0.926900983f, 0.384918034f},
-std::array<float,2>{0.973819315f, 0.561545193f},
-std::array<float,2>{0.387344182f, 0.00665219035f},
-std::array<float,2>{0.153022259f, 0.832686007f},
-std::array<float,2>{0.552699506f, 0.250894278f},
-std::array<float,2>{0.729934037f, 0.9887321f},
-std::array<float,2>{0.0757453814f, 0.447183073f},
-std::array<float,2>{0.257257134f, 0.720254242f},
-std::array<float,2>{0.862839699f, 0.231176868f},
-std::array<float,2>{0.890401781f, 0.896583498f},
-std::array<float,2>{0.44102183f, 0.43370524f},
-std::array<float,2>{0.187693968f, 0.64525038f},
-std::array<float,2>{0.591923177f, 0.128809944f},
-std::array<float,2>{0.672726572f, 0.579407275f},
-std::array<float,2>{0.0600829534f, 0.0928801745f},
-std::array<float,2>{0.32989347f, 0.802857816f},
-std::array<float,2>{0.789183736f, 0.352945268f},
-std::array<float,2>{0.834857881f, 0.703182697f},
-std::array<float,2>{0.296631753f, 0.189859331f},
-std::array<float,2>{0.0980493948f, 0.966655076f},
-std::array<float,2>{0.704667866f, 0.478046328f},
-std::array<float,2>{0.519662917f, 0.870691895f},
-std::array<float,2>{0.181990415f, 0.301154256f},
-std::array<float,2>{0.427327901f, 0.505839527f},
-std::array<float,2>{0.943775117f, 0.0525010973f},
-std::array<float,2>{0.957193613f, 0.818595707f},
-std::array<float,2>{0.411284238f, 0.275069058f},
-std::array<float,2>{0.16587308f, 0.543513179f},
-std::array<float,2>{0.511601448f, 0.0175727811f},
-std::array<float,2>{0.69838357f, 0.745568097f},
-std::array<float,2>{0.122886844f, 0.23754859f},
-std::array<float,2>{0.311094224f, 0.97751224f},
-std::array<float,2>{0.825323522f, 0.466104478f},
-std::array<float,2>{0.807042062f, 0.615730584f},
-std::array<float,2>{0.318071395f, 0.112041228f},
-std::array<float,2>{0.0420410596f, 0.75505197f},
-std::array<float,2>{0.670144558f, 0.317675978f},
-std::array<float,2>{0.576792836f, 0.912883461f},
-std::array<float,2>{0.213321105f, 0.399036258f},
-std::array<float,2>{0.464286745f, 0.662108898f},
-std::array<float,2>{0.892122984f, 0.170820326f},
-std::array<float,2>{0.856194556f, 0.947731197f},
-std::array<float,2>{0.274436653f, 0.490644306f},
-std::array<float,2>{0.0906216577f, 0.689333975f},
-std::array<float,2>{0.746766627f, 0.212371007f},
-std::array<float,2>{0.543933928f, 0.517092288f},
-std::array<float,2>{0.125492901f, 0.0377291963f},
-std::array<float,2>{0.401512593f, 0.845318019f},
-std::array<float,2>{0.988947093f, 0.293924451f},
-std::array<float,2>{0.919989467f, 0.635034382f},
-std::array<float,2>{0.485540777f, 0.155255541f},
-std::array<float,2>{0.249828696f, 0.890176117f},
-std::array<float,2>{0.623093843f, 0.417349935f},
-std::array<float,2>{0.652548313f, 0.792035043f},
-std::array<float,2>{0.0255368613f, 0.369061619f},
-std::array<float,2>{0.348206758f, 0.577553511f},
-std::array<float,2>{0.761226296f, 0.0685165748f},
-std::array<float,2>{0.866734743f, 0.783975959f},
-std::array<float,2>{0.25333333f, 0.365418136f},
-std::array<float,2>{0.0739111155f, 0.562532246f},
-std::array<float,2>{0.731580377f, 0.0707330108f},
-std::array<float,2>{0.549865603f, 0.629080951f},
-std::array<float,2>{0.152044192f, 0.147290125f},
-std::array<float,2>{0.385899544f, 0.880158007f},
-std::array<float,2>{0.972441137f, 0.412153125f},
-std::array<float,2>{0.924739242f, 0.524061143f},
-std::array<float,2>{0.477345318f, 0.0450849757f},
-std::array<float,2>{0.222315684f, 0.855998397f},
-std::array<float,2>{0.604617476f, 0.288888961f},
-std::array<float,2>{0.626089871f, 0.944772005f},
-std::array<float,2>{0.0136317918f, 0.497654051f},
-std::array<float,2>{0.36489597f, 0.6975317f},
-std::array<float,2>{0.770868301f, 0.207875624f},
-std::array<float,2>{0.941355109f, 0.919237554f},
-std::array<float,2>{0.423767596f, 0.39540419f},
-std::array<float,2>{0.186767906f, 0.666373134f},
-std::array<float,2>{0.517351568f, 0.160504803f},
-std::array<float,2>{0.710149884f, 0.622603714f},
-std::array<float,2>{0.0973085016f, 0.119541302f},
-std::array<float,2>{0.289433926f, 0.758235157f},
-std::array<float,2>{0.829664826f, 0.326126397f},
-std::array<float,2>{0.795010149f, 0.735630453f},
-std::array<float,2>{0.33463487f, 0.248819828f},
-std::array<float,2>{0.0585778132f, 0.974096358f},
-std::array<float,2>{0.677168489f, 0.46064198f},
-std::array<float,2>{0.588877559f, 0.82081002f},
-std::array<float,2>{0.195255801f, 0.271240264f},
-std::array<float,2>{0.443201184f, 0.533299208f},
-std::array<float,2>{0.886582255f, 0.0238274336f},
-std::array<float,2>{0.89473772f, 0.862886906f},
-std::array<float,2>{0.467348367f, 0.309987396f},
-std::array<float,2>{0.217838451f, 0.511956096f},
-std::array<float,2>{0.573157191f, 0.0562085472f},
-std::array<float,2>{0.66474539f, 0.712811351f},
-std::array<float,2>{0.0449577048f, 0.197576582f},
-std::array<float,2>{0.314661592f, 0.960764825f},
-std::array<float,2>{0.81092006f, 0.46920985f},
-std::array<float,2>{0.822115958f, 0.590951264f},
-std::array<float,2>{0.306210071f, 0.0805915743f},
-std::array<float,2>{0.117976315f, 0.807937443f},
-std::array<float,2>{0.700697482f, 0.348290712f},
-std::array<float,2>{0.512765884f, 0.904300332f},
-std::array<float,2>{0.170286804f, 0.425930709f},
-std::array<float,2>{0.406861573f, 0.652621448f},
-std::array<float,2>{0.956226707f, 0.136629015f},
-std::array<float,2>{0.76331687f, 0.999487042f},
-std::array<float,2>{0.345143586f, 0.443949372f},
-std::array<float,2>{0.0297811385f, 0.734224021f},
-std::array<float,2>{0.650535882f, 0.220148072f},
-std::array<float,2>{0.618465066f, 0.551673353f},
-std::array<float,2>{0.244145378f, 0.0147918556f},
-std::array<float,2>{0.488426983f, 0.842237771f},
-std::array<float,2>{0.9168396f, 0.258039922f},
-std::array<float,2>{0.987543821f, 0.672905266f},
-std::array<float,2>{0.404004455f, 0.182391644f},
-std::array<float,2>{0.130430445f, 0.936531365f},
-std::array<float,2>{0.539586723f, 0.382352799f},
-std::array<float,2>{0.745086193f, 0.780273855f},
-std::array<float,2>{0.087266162f, 0.33299765f},
-std::array<float,2>{0.280002683f, 0.604756296f},
-std::array<float,2>{0.853817046f, 0.108185172f},
-std::array<float,2>{0.801162302f, 0.830284715f},
-std::array<float,2>{0.325684816f, 0.257443905f},
-std::array<float,2>{0.0379822515f, 0.557986259f},
-std::array<float,2>{0.662817955f, 0.00337857101f},
-std::array<float,2>{0.56959337f, 0.725169897f},
-std::array<float,2>{0.209727973f, 0.228167713f},
-std::array<float,2>{0.457455754f, 0.987442851f},
-std::array<float,2>{0.906045198f, 0.452741653f},
-std::array<float,2>{0.965417445f, 0.600443661f},
-std::array<float,2>{0.416720957f, 0.0948311314f},
-std::array<float,2>{0.159540445f, 0.769640923f},
-std::array<float,2>{0.503562629f, 0.339476228f},
-std::array<float,2>{0.691117287f, 0.924730241f},
-std::array<float,2>{0.109382585f, 0.389980614f},
-std::array<float,2>{0.303591937f, 0.683562279f},
-std::array<float,2>{0.816997826f, 0.179392144f},
-std::array<float,2>{0.911984801f, 0.961950183f},
-std::array<float,2>{0.495017558f, 0.482931674f},
-std::array<float,2>{0.237858564f, 0.708456159f},
-std::array<float,2>{0.612617552f, 0.191438287f},
-std::array<float,2>{0.640712619f, 0.5026263f},
-std::array<float,2>{0.0157904476f, 0.0474307723f},
-std::array<float,2>{0.352568746f, 0.873222053f},
-std::array<float,2>{0.750736058f, 0.297663718f},
-std::array<float,2>{0.848802865f, 0.642452478f},
-std::array<float,2>{0.272389263f, 0.129436508f},
-std::array<float,2>{0.0834540725f, 0.891295552f},
-std::array<float,2>{0.734591961f, 0.430213004f},
-std::array<float,2>{0.538844943f, 0.799495101f},
-std::array<float,2>{0.138816953f, 0.355494618f},
-std::array<float,2>{0.391808242f, 0.585053205f},
-std::array<float,2>{0.992766142f, 0.0893244967f},
-std::array<float,2>{0.976906717f, 0.75081265f},
-std::array<float,2>{0.377868205f, 0.31320709f},
-std::array<float,2>{0.147509471f, 0.611561894f},
-std::array<float,2>{0.560828567f, 0.115011916f},
-std::array<float,2>{0.725577533f, 0.657829404f},
-std::array<float,2>{0.0641312748f, 0.165621966f},
-std::array<float,2>{0.259965777f, 0.906488836f},
-std::array<float,2>{0.870249033f, 0.403873444f},
-std::array<float,2>{0.773733377f, 0.5414415f},
-std::array<float,2>{0.374021173f, 0.0208733119f},
-std::array<float,2>{0.00390840648f, 0.813008606f},
-std::array<float,2>{0.634538174f, 0.278422177f},
-std::array<float,2>{0.601552844f, 0.983857572f},
-std::array<float,2>{0.228753135f, 0.464549512f},
-std::array<float,2>{0.475540131f, 0.749338806f},
-std::array<float,2>{0.934573829f, 0.238334417f},
-std::array<float,2>{0.841529846f, 0.886129022f},
-std::array<float,2>{0.28637746f, 0.419194698f},
-std::array<float,2>{0.1088681f, 0.640622079f},
-std::array<float,2>{0.713835597f, 0.150257796f},
-std::array<float,2>{0.527279198f, 0.570376217f},
-std::array<float,2>{0.173281178f, 0.0656876937f},
-std::array<float,2>{0.436065167f, 0.79582274f},
-std::array<float,2>{0.950803578f, 0.373293757f},
-std::array<float,2>{0.881319404f, 0.693241417f},
-std::array<float,2>{0.445733577f, 0.217211142f},
-std::array<float,2>{0.196965009f, 0.949287832f},
-std::array<float,2>{0.58477819f, 0.48512426f},
-std::array<float,2>{0.683524847f, 0.848856568f},
-std::array<float,2>{0.0521599464f, 0.291294336f},
-std::array<float,2>{0.338646442f, 0.521321774f},
-std::array<float,2>{0.784032464f, 0.0345565155f},
-std::array<float,2>{0.872821629f, 0.864660084f},
-std::array<float,2>{0.264182657f, 0.305400044f},
-std::array<float,2>{0.0673587099f, 0.509764373f},
-std::array<float,2>{0.718786061f, 0.0616796799f},
-std::array<float,2>{0.558118224f, 0.718518674f},
-std::array<float,2>{0.14238672f, 0.19940263f},
-std::array<float,2>{0.38192904f, 0.956318676f},
-std::array<float,2>{0.981631875f, 0.475472748f},
-std::array<float,2>{0.93126899f, 0.587251186f},
-std::array<float,2>{0.471590757f, 0.0847346038f},
-std::array<float,2>{0.232969537f, 0.811634064f},
-std::array<float,2>{0.596293449f, 0.344138563f},
-std::array<float,2>{0.639346778f, 0.900583267f},
-std::array<float,2>{0.00274390494f, 0.424425781f},
-std::array<float,2>{0.367504478f, 0.651289165f},
-std::array<float,2>{0.780127466f, 0.139713123f},
-std::array<float,2>{0.94805187f, 0.994674087f},
-std::array<float,2>{0.429934114f, 0.43799296f},
-std::array<float,2>{0.179018214f, 0.72758764f},
-std::array<float,2>{0.530979216f, 0.225002676f},
-std::array<float,2>{0.71633184f, 0.547449648f},
-std::array<float,2>{0.102235764f, 0.00877793692f},
-std::array<float,2>{0.284487188f, 0.838879943f},
-std::array<float,2>{0.837938488f, 0.263148099f},
-std::array<float,2>{0.788353205f, 0.676529884f},
-std::array<float,2>{0.340683132f, 0.186028674f},
-std::array<float,2>{0.0497966409f, 0.933050454f},
-std::array<float,2>{0.683936775f, 0.378599793f},
-std::array<float,2>{0.579815447f, 0.774569571f},
-std::array<float,2>{0.199645609f, 0.330545843f},
-std::array<float,2>{0.45127672f, 0.606639922f},
-std::array<float,2>{0.876295686f, 0.102739833f},
-std::array<float,2>{0.901566625f, 0.788877428f},
-std::array<float,2>{0.456096083f, 0.361298829f},
-std::array<float,2>{0.203198433f, 0.566970885f},
-std::array<float,2>{0.565899611f, 0.0743305981f},
-std::array<float,2>{0.659171939f, 0.625095367f},
-std::array<float,2>{0.0351037867f, 0.143904418f},
-std::array<float,2>{0.322575003f, 0.878129065f},
-std::array<float,2>{0.798310637f, 0.408690959f},
-std::array<float,2>{0.815221906f, 0.529277444f},
-std::array<float,2>{0.297701776f, 0.0408078395f},
-std::array<float,2>{0.115572557f, 0.854167402f},
-std::array<float,2>{0.69268465f, 0.282319099f},
-std::array<float,2>{0.507367074f, 0.937854707f},
-std::array<float,2>{0.161727652f, 0.494637638f},
-std::array<float,2>{0.420961797f, 0.701299906f},
-std::array<float,2>{0.962730885f, 0.203962386f},
-std::array<float,2>{0.757539988f, 0.916389644f},
-std::array<float,2>{0.358349681f, 0.394507468f},
-std::array<float,2>{0.0212343f, 0.671346188f},
-std::array<float,2>{0.645415723f, 0.156714484f},
-std::array<float,2>{0.615730345f, 0.620762408f},
-std::array<float,2>{0.240044162f, 0.121283457f},
-std::array<float,2>{0.497708261f, 0.764569759f},
-std::array<float,2>{0.906583071f, 0.323494822f},
-std::array<float,2>{0.99652344f, 0.741738141f},
-std::array<float,2>{0.396329492f, 0.243790716f},
-std::array<float,2>{0.13600786f, 0.970525563f},
-std::array<float,2>{0.534789383f, 0.4567931f},
-std::array<float,2>{0.738680363f, 0.824792504f},
-std::array<float,2>{0.0812863484f, 0.268185169f},
-std::array<float,2>{0.268207848f, 0.538069665f},
-std::array<float,2>{0.846715808f, 0.0294065475f},
-std::array<float,2>{0.805486023f, 0.754383028f},
-std::array<float,2>{0.319200635f, 0.316464067f},
-std::array<float,2>{0.0401962437f, 0.617147923f},
-std::array<float,2>{0.669782937f, 0.113167286f},
-std::array<float,2>{0.574990988f, 0.660794079f},
-std::array<float,2>{0.211738288f, 0.171722278f},
-std::array<float,2>{0.461511642f, 0.913253605f},
-std::array<float,2>{0.894000232f, 0.400389075f},
-std::array<float,2>{0.960586846f, 0.544465244f},
-std::array<float,2>{0.4122895f, 0.0158553626f},
-std::array<float,2>{0.167005435f, 0.820218086f},
-std::array<float,2>{0.509233952f, 0.273979127f},
-std::array<float,2>{0.695780933f, 0.977599382f},
-std::array<float,2>{0.124981292f, 0.464855075f},
-std::array<float,2>{0.310531855f, 0.744942546f},
-std::array<float,2>{0.826878071f, 0.237140372f},
-std::array<float,2>{0.919349253f, 0.889101863f},
-std::array<float,2>{0.48827377f, 0.416841537f},
-std::array<float,2>{0.246409491f, 0.636152804f},
-std::array<float,2>{0.621545196f, 0.156017765f},
-std::array<float,2>{0.655491948f, 0.576197445f},
-std::array<float,2>{0.0235484913f, 0.0694211647f},
-std::array<float,2>{0.351059645f, 0.791513562f},
-std::array<float,2>{0.758029878f, 0.367800087f},
-std::array<float,2>{0.858563542f, 0.687990904f},
-std::array<float,2>{0.275854141f, 0.211134225f},
-std::array<float,2>{0.0929195657f, 0.948268056f},
-std::array<float,2>{0.748165727f, 0.49129793f},
-std::array<float,2>{0.545837224f, 0.844702661f},
-std::array<float,2>{0.12757659f, 0.294808239f},
-std::array<float,2>{0.398572862f, 0.516250908f},
-std::array<float,2>{0.990703344f, 0.0384536311f},
-std::array<float,2>{0.975021839f, 0.833799839f},
-std::array<float,2>{0.389859915f, 0.251920074f},
-std::array<float,2>{0.154950827f, 0.560764849f},
-std::array<float,2>{0.553106248f, 0.00699533615f},
-std::array<float,2>{0.726995826f, 0.719449639f},
-std::array<float,2>{0.077110298f, 0.232025847f},
-std::array<float,2>{0.254249901f, 0.989501119f},
-std::array<float,2>{0.861083686f, 0.445758641f},
-std::array<float,2>{0.768995523f, 0.596711695f},
-std::array<float,2>{0.36306414f, 0.0992750302f},
-std::array<float,2>{0.00990670454f, 0.767136574f},
-std::array<float,2>{0.631886899f, 0.340585858f},
-std::array<float,2>{0.606659174f, 0.926043451f},
-std::array<float,2>{0.223823011f, 0.386112899f},
-std::array<float,2>{0.480952293f, 0.68471849f},
-std::array<float,2>{0.928848147f, 0.172116607f},
-std::array<float,2>{0.833318114f, 0.965013623f},
-std::array<float,2>{0.293696761f, 0.477393448f},
-std::array<float,2>{0.101240702f, 0.704511642f},
-std::array<float,2>{0.705841124f, 0.191388875f},
-std::array<float,2>{0.522544026f, 0.503988266f},
-std::array<float,2>{0.179958761f, 0.0509528071f},
-std::array<float,2>{0.428357393f, 0.8691414f},
-std::array<float,2>{0.94277668f, 0.302090377f},
-std::array<float,2>{0.887773573f, 0.645774305f},
-std::array<float,2>{0.439051002f, 0.126957297f},
-std::array<float,2>{0.189664379f, 0.898415685f},
-std::array<float,2>{0.590475202f, 0.434911817f},
-std::array<float,2>{0.675036132f, 0.80411607f},
-std::array<float,2>{0.0617950782f, 0.352159977f},
-std::array<float,2>{0.331945151f, 0.578314304f},
-std::array<float,2>{0.791807711f, 0.0925759152f},
-std::array<float,2>{0.824038267f, 0.807434261f},
-std::array<float,2>{0.307435364f, 0.34896782f},
-std::array<float,2>{0.119508475f, 0.590408862f},
-std::array<float,2>{0.701477408f, 0.0817433149f},
-std::array<float,2>{0.514550567f, 0.653641701f},
-std::array<float,2>{0.16917704f, 0.135433316f},
-std::array<float,2>{0.409143835f, 0.906119764f},
-std::array<float,2>{0.954871893f, 0.427114338f},
-std::array<float,2>{0.896637321f, 0.513033748f},
-std::array<float,2>{0.466384888f, 0.0551246405f},
-std::array<float,2>{0.215139687f, 0.861824036f},
-std::array<float,2>{0.571028054f, 0.308864981f},
-std::array<float,2>{0.667851329f, 0.959097862f},
-std::array<float,2>{0.043488808f, 0.470371217f},
-std::array<float,2>{0.313081175f, 0.711785316f},
-std::array<float,2>{0.809963465f, 0.198991761f},
-std::array<float,2>{0.985412955f, 0.935939193f},
-std::array<float,2>{0.405868888f, 0.381225973f},
-std::array<float,2>{0.131629601f, 0.672290027f},
-std::array<float,2>{0.541060328f, 0.183100119f},
-std::array<float,2>{0.743488669f, 0.604061902f},
-std::array<float,2>{0.0886210501f, 0.10843686f},
-std::array<float,2>{0.278658599f, 0.780017734f},
-std::array<float,2>{0.851949215f, 0.333023638f},
-std::array<float,2>{0.764444888f, 0.73260963f},
-std::array<float,2>{0.346174419f, 0.219351768f},
-std::array<float,2>{0.027940562f, 0.998711109f},
-std::array<float,2>{0.649336934f, 0.444362134f},
-std::array<float,2>{0.620588481f, 0.842854738f},
-std::array<float,2>{0.2440795f, 0.259674191f},
-std::array<float,2>{0.49123916f, 0.552602291f},
-std::array<float,2>{0.915810764f, 0.0143802073f},
-std::array<float,2>{0.923805594f, 0.8572914f},
-std::array<float,2>{0.478667974f, 0.288011909f},
-std::array<float,2>{0.218922973f, 0.5248487f},
-std::array<float,2>{0.602808416f, 0.0465390868f},
-std::array<float,2>{0.627882481f, 0.698995233f},
-std::array<float,2>{0.0144504989f, 0.208850086f},
-std::array<float,2>{0.365953892f, 0.943445683f},
-std::array<float,2>{0.773208022f, 0.496652961f},
-std::array<float,2>{0.864420772f, 0.564168274f},
-std::array<float,2>{0.250092506f, 0.0721394569f},
-std::array<float,2>{0.0704334378f, 0.784585714f},
-std::array<float,2>{0.733634412f, 0.366634339f},
-std::array<float,2>{0.547377229f, 0.879165173f},
-std::array<float,2>{0.150184095f, 0.41351074f},
-std::array<float,2>{0.383969456f, 0.63039726f},
-std::array<float,2>{0.969288766f, 0.148245573f},
-std::array<float,2>{0.793511391f, 0.973201692f},
-std::array<float,2>{0.333897889f, 0.459949255f},
-std::array<float,2>{0.056425225f, 0.734833717f},
-std::array<float,2>{0.679032445f, 0.249802992f},
-std::array<float,2>{0.587432384f, 0.534439802f},
-std::array<float,2>{0.19316642f, 0.025086958f},
-std::array<float,2>{0.443382621f, 0.821992278f},
-std::array<float,2>{0.883688986f, 0.27004829f},
-std::array<float,2>{0.93788594f, 0.66707164f},
-std::array<float,2>{0.424499273f, 0.161900416f},
-std::array<float,2>{0.184350356f, 0.918797851f},
-std::array<float,2>{0.519190431f, 0.396069735f},
-std::array<float,2>{0.707368731f, 0.759338558f},
-std::array<float,2>{0.0943845138f, 0.324734658f},
-std::array<float,2>{0.292516947f, 0.621170461f},
-std::array<float,2>{0.830903053f, 0.120682158f},
-std::array<float,2>{0.777335763f, 0.813991427f},
-std::array<float,2>{0.37137568f, 0.27813217f},
-std::array<float,2>{0.00587648246f, 0.542469203f},
-std::array<float,2>{0.636177182f, 0.0197197571f},
-std::array<float,2>{0.598760664f, 0.748649836f},
-std::array<float,2>{0.227594763f, 0.240064412f},
-std::array<float,2>{0.473956555f, 0.982554018f},
-std::array<float,2>{0.937161565f, 0.463018298f},
-std::array<float,2>{0.978895962f, 0.613175511f},
-std::array<float,2>{0.375364006f, 0.113479845f},
-std::array<float,2>{0.145296827f, 0.751885474f},
-std::array<float,2>{0.559610128f, 0.314024389f},
-std::array<float,2>{0.723076582f, 0.908089995f},
-std::array<float,2>{0.0648859367f, 0.402498007f},
-std::array<float,2>{0.258073717f, 0.656343937f},
-std::array<float,2>{0.868026912f, 0.164248124f},
-std::array<float,2>{0.878997028f, 0.950647593f},
-std::array<float,2>{0.448172867f, 0.485453367f},
-std::array<float,2>{0.198692426f, 0.692223847f},
-std::array<float,2>{0.583354056f, 0.218570068f},
-std::array<float,2>{0.680858195f, 0.519744396f},
-std::array<float,2>{0.0528330877f, 0.0339405574f},
-std::array<float,2>{0.336516052f, 0.848493218f},
-std::array<float,2>{0.782988489f, 0.292386681f},
-std::array<float,2>{0.842555404f, 0.639529169f},
-std::array<float,2>{0.287120581f, 0.148941472f},
-std::array<float,2>{0.105603747f, 0.885163724f},
-std::array<float,2>{0.711330414f, 0.418725342f},
-std::array<float,2>{0.524191618f, 0.796720028f},
-std::array<float,2>{0.17441377f, 0.374894649f},
-std::array<float,2>{0.434728801f, 0.571922541f},
-std::array<float,2>{0.951761901f, 0.0650908053f},
-std::array<float,2>{0.967910349f, 0.771245658f},
-std::array<float,2>{0.414461702f, 0.338576883f},
-std::array<float,2>{0.157690823f, 0.601339877f},
-std::array<float,2>{0.500664771f, 0.0945521668f},
-std::array<float,2>{0.688313842f, 0.68256259f},
-std::array<float,2>{0.111763902f, 0.178421333f},
-std::array<float,2>{0.302533805f, 0.925332427f},
-std::array<float,2>{0.820207715f, 0.389161885f},
-std::array<float,2>{0.803842247f, 0.557442009f},
-std::array<float,2>{0.32622534f, 0.00216435455f},
-std::array<float,2>{0.0355925485f, 0.831262589f},
-std::array<float,2>{0.661832809f, 0.256240338f},
-std::array<float,2>{0.568258703f, 0.986728966f},
-std::array<float,2>{0.208221868f, 0.452079356f},
-std::array<float,2>{0.459330052f, 0.726132631f},
-std::array<float,2>{0.902772188f, 0.226611897f},
-std::array<float,2>{0.850545287f, 0.892388284f},
-std::array<float,2>{0.270909309f, 0.430914968f},
-std::array<float,2>{0.084976621f, 0.64081347f},
-std::array<float,2>{0.737474859f, 0.130670488f},
-std::array<float,2>{0.535387337f, 0.584047914f},
-std::array<float,2>{0.138500854f, 0.0884080604f},
-std::array<float,2>{0.392837673f, 0.800609946f},
-std::array<float,2>{0.995837271f, 0.356960148f},
-std::array<float,2>{0.913074553f, 0.707238853f},
-std::array<float,2>{0.493459851f, 0.192807913f},
-std::array<float,2>{0.236101389f, 0.96161747f},
-std::array<float,2>{0.61012274f, 0.483992606f},
-std::array<float,2>{0.642660558f, 0.874245763f},
-std::array<float,2>{0.0194727816f, 0.29812628f},
-std::array<float,2>{0.354569227f, 0.502951741f},
-std::array<float,2>{0.753659189f, 0.0482764952f},
-std::array<float,2>{0.837083578f, 0.837665081f},
-std::array<float,2>{0.281543255f, 0.264200479f},
-std::array<float,2>{0.104652934f, 0.55000788f},
-std::array<float,2>{0.717208624f, 0.0115432041f},
-std::array<float,2>{0.527891338f, 0.728905857f},
-std::array<float,2>{0.176841289f, 0.22301808f},
-std::array<float,2>{0.432804525f, 0.99406904f},
-std::array<float,2>{0.945885003f, 0.440448761f},
-std::array<float,2>{0.878370881f, 0.607872188f},
-std::array<float,2>{0.449276417f, 0.104694858f},
-std::array<float,2>{0.202493891f, 0.776607692f},
-std::array<float,2>{0.580520034f, 0.329121411f},
-std::array<float,2>{0.686050534f, 0.929741383f},
-std::array<float,2>{0.0474177264f, 0.375004888f},
-std::array<float,2>{0.343326658f, 0.678788722f},
-std::array<float,2>{0.786131799f, 0.185170799f},
-std::array<float,2>{0.98316133f, 0.954755008f},
-std::array<float,2>{0.380281001f, 0.473493963f},
-std::array<float,2>{0.144354656f, 0.716418266f},
-std::array<float,2>{0.555091202f, 0.202462226f},
-std::array<float,2>{0.722507715f, 0.511663198f},
-std::array<float,2>{0.0684412643f, 0.060147848f},
-std::array<float,2>{0.262368828f, 0.866849542f},
-std::array<float,2>{0.874992967f, 0.308175713f},
-std::array<float,2>{0.777526438f, 0.648949802f},
-std::array<float,2>{0.370732963f, 0.138453215f},
-std::array<float,2>{0.0003289046f, 0.899179995f},
-std::array<float,2>{0.637903214f, 0.422726363f},
-std::array<float,2>{0.594565034f, 0.810485363f},
-std::array<float,2>{0.231035694f, 0.347462386f},
-std::array<float,2>{0.469625413f, 0.588886678f},
-std::array<float,2>{0.933125019f, 0.0835928619f},
-std::array<float,2>{0.908922493f, 0.761763334f},
-std::array<float,2>{0.498939633f, 0.321325332f},
-std::array<float,2>{0.241299227f, 0.617261529f},
-std::array<float,2>{0.613954902f, 0.1246958f},
-std::array<float,2>{0.64827913f, 0.668019593f},
-std::array<float,2>{0.0230913013f, 0.160141557f},
-std::array<float,2>{0.355696857f, 0.914157629f},
-std::array<float,2>{0.754108012f, 0.390687078f},
-std::array<float,2>{0.843877673f, 0.536920547f},
-std::array<float,2>{0.267458051f, 0.0274879728f},
-std::array<float,2>{0.0783684999f, 0.826598346f},
-std::array<float,2>{0.741982937f, 0.266720831f},
-std::array<float,2>{0.532396138f, 0.971084476f},
-std::array<float,2>{0.134420261f, 0.453315377f},
-std::array<float,2>{0.397130251f, 0.738571167f},
-std::array<float,2>{0.998645365f, 0.245108575f},
-std::array<float,2>{0.800498664f, 0.87633878f},
-std::array<float,2>{0.32055369f, 0.408144861f},
-std::array<float,2>{0.032825686f, 0.628857672f},
-std::array<float,2>{0.657092869f, 0.141330034f},
-std::array<float,2>{0.562524915f, 0.569773316f},
-std::array<float,2>{0.206458092f, 0.0776942074f},
-std::array<float,2>{0.45505023f, 0.7870664f},
-std::array<float,2>{0.898774028f, 0.362418979f},
-std::array<float,2>{0.963946462f, 0.70064038f},
-std::array<float,2>{0.419381052f, 0.206281364f},
-std::array<float,2>{0.163282007f, 0.940065742f},
-std::array<float,2>{0.505779922f, 0.494071186f},
-std::array<float,2>{0.694693387f, 0.852057457f},
-std::array<float,2>{0.114865981f, 0.283999383f},
-std::array<float,2>{0.300457299f, 0.531055689f},
-std::array<float,2>{0.814380109f, 0.0419706032f},
-std::array<float,2>{0.760121703f, 0.789398849f},
-std::array<float,2>{0.348739564f, 0.370084405f},
-std::array<float,2>{0.0269601326f, 0.575914979f},
-std::array<float,2>{0.653411925f, 0.0665393546f},
-std::array<float,2>{0.624326408f, 0.634227633f},
-std::array<float,2>{0.248285845f, 0.153709963f},
-std::array<float,2>{0.484390974f, 0.888607979f},
-std::array<float,2>{0.92179364f, 0.414232641f},
-std::array<float,2>{0.989569724f, 0.517982721f},
-std::array<float,2>{0.401146889f, 0.035296265f},
-std::array<float,2>{0.126424685f, 0.846183181f},
-std::array<float,2>{0.544686496f, 0.296196312f},
-std::array<float,2>{0.747734725f, 0.945520341f},
-std::array<float,2>{0.0911926106f, 0.489271313f},
-std::array<float,2>{0.273714095f, 0.690920591f},
-std::array<float,2>{0.856926024f, 0.213159636f},
-std::array<float,2>{0.890684128f, 0.9120996f},
-std::array<float,2>{0.463407785f, 0.40216434f},
-std::array<float,2>{0.214156464f, 0.663714051f},
-std::array<float,2>{0.57724297f, 0.169885427f},
-std::array<float,2>{0.671326041f, 0.614541292f},
-std::array<float,2>{0.041147463f, 0.110465102f},
-std::array<float,2>{0.316885889f, 0.757096827f},
-std::array<float,2>{0.807693601f, 0.318463355f},
-std::array<float,2>{0.824434102f, 0.743429184f},
-std::array<float,2>{0.312347502f, 0.234435245f},
-std::array<float,2>{0.121387959f, 0.978972971f},
-std::array<float,2>{0.697811425f, 0.468194902f},
-std::array<float,2>{0.509975016f, 0.816817284f},
-std::array<float,2>{0.164397597f, 0.277016073f},
-std::array<float,2>{0.41056478f, 0.546056151f},
-std::array<float,2>{0.958583474f, 0.0180286374f},
-std::array<float,2>{0.944534719f, 0.868456721f},
-std::array<float,2>{0.426404983f, 0.303211212f},
-std::array<float,2>{0.183320045f, 0.507726729f},
-std::array<float,2>{0.52079314f, 0.0534801409f},
-std::array<float,2>{0.703841925f, 0.706530511f},
-std::array<float,2>{0.0994202048f, 0.189265564f},
-std::array<float,2>{0.295619339f, 0.967517853f},
-std::array<float,2>{0.835867107f, 0.479745895f},
-std::array<float,2>{0.790997148f, 0.581027925f},
-std::array<float,2>{0.328242093f, 0.0901484638f},
-std::array<float,2>{0.0586694069f, 0.802681744f},
-std::array<float,2>{0.673403025f, 0.354945064f},
-std::array<float,2>{0.593604326f, 0.896420181f},
-std::array<float,2>{0.188571841f, 0.436919272f},
-std::array<float,2>{0.439547151f, 0.648182213f},
-std::array<float,2>{0.889455497f, 0.125697449f},
-std::array<float,2>{0.862246871f, 0.990493655f},
-std::array<float,2>{0.256615102f, 0.448266178f},
-std::array<float,2>{0.0751921162f, 0.721714199f},
-std::array<float,2>{0.728890121f, 0.233111635f},
-std::array<float,2>{0.551481545f, 0.560524702f},
-std::array<float,2>{0.153422043f, 0.00499182567f},
-std::array<float,2>{0.388241619f, 0.834367692f},
-std::array<float,2>{0.973549008f, 0.252877802f},
-std::array<float,2>{0.92633903f, 0.68740207f},
-std::array<float,2>{0.484003246f, 0.175211549f},
-std::array<float,2>{0.224648282f, 0.928668499f},
-std::array<float,2>{0.607449651f, 0.383769721f},
-std::array<float,2>{0.629918039f, 0.768965364f},
-std::array<float,2>{0.00953316037f, 0.342628419f},
-std::array<float,2>{0.359797627f, 0.594453037f},
-std::array<float,2>{0.767095327f, 0.0999321789f},
-std::array<float,2>{0.854501247f, 0.778754294f},
-std::array<float,2>{0.280477107f, 0.335566878f},
-std::array<float,2>{0.0863574892f, 0.603283584f},
-std::array<float,2>{0.745355189f, 0.106012903f},
-std::array<float,2>{0.540238142f, 0.675724745f},
-std::array<float,2>{0.129707068f, 0.180089459f},
-std::array<float,2>{0.402581215f, 0.935191154f},
-std::array<float,2>{0.987059176f, 0.379080236f},
-std::array<float,2>{0.917688668f, 0.552755475f},
-std::array<float,2>{0.490121782f, 0.0135656018f},
-std::array<float,2>{0.246065527f, 0.840608656f},
-std::array<float,2>{0.618011534f, 0.261087507f},
-std::array<float,2>{0.652161062f, 0.996532142f},
-std::array<float,2>{0.0304433424f, 0.441521913f},
-std::array<float,2>{0.343930751f, 0.732311547f},
-std::array<float,2>{0.762643099f, 0.221767306f},
-std::array<float,2>{0.955503106f, 0.903215647f},
-std::array<float,2>{0.408197135f, 0.427906483f},
-std::array<float,2>{0.171065167f, 0.655395091f},
-std::array<float,2>{0.512347996f, 0.134433225f},
-std::array<float,2>{0.699837029f, 0.593196332f},
-std::array<float,2>{0.118780196f, 0.0797674656f},
-std::array<float,2>{0.305186987f, 0.805513799f},
-std::array<float,2>{0.820662379f, 0.35153389f},
-std::array<float,2>{0.811875045f, 0.713995934f},
-std::array<float,2>{0.315521061f, 0.197152957f},
-std::array<float,2>{0.0467449687f, 0.957777858f},
-std::array<float,2>{0.6655159f, 0.472334206f},
-std::array<float,2>{0.574062705f, 0.860879064f},
-std::array<float,2>{0.216979146f, 0.310551018f},
-std::array<float,2>{0.467864007f, 0.515365839f},
-std::array<float,2>{0.895643592f, 0.0579529963f},
-std::array<float,2>{0.885502338f, 0.822522402f},
-std::array<float,2>{0.441772044f, 0.272652358f},
-std::array<float,2>{0.19412832f, 0.532896638f},
-std::array<float,2>{0.588741422f, 0.0261226706f},
-std::array<float,2>{0.676042676f, 0.738075256f},
-std::array<float,2>{0.0575808957f, 0.24795799f},
-std::array<float,2>{0.334998816f, 0.975725949f},
-std::array<float,2>{0.796766222f, 0.458952576f},
-std::array<float,2>{0.82896024f, 0.624459863f},
-std::array<float,2>{0.290207505f, 0.117216684f},
-std::array<float,2>{0.0962305367f, 0.760155559f},
-std::array<float,2>{0.709475458f, 0.327075183f},
-std::array<float,2>{0.516440988f, 0.920210421f},
-std::array<float,2>{0.18599622f, 0.397507876f},
-std::array<float,2>{0.421985894f, 0.665124118f},
-std::array<float,2>{0.939457595f, 0.163553059f},
-std::array<float,2>{0.769558787f, 0.942486465f},
-std::array<float,2>{0.363680601f, 0.499849021f},
-std::array<float,2>{0.0118199959f, 0.696887374f},
-std::array<float,2>{0.625565231f, 0.210690543f},
-std::array<float,2>{0.603655696f, 0.525393784f},
-std::array<float,2>{0.221186668f, 0.0436608531f},
-std::array<float,2>{0.478402913f, 0.857546687f},
-std::array<float,2>{0.925636828f, 0.286203563f},
-std::array<float,2>{0.970976889f, 0.631688476f},
-std::array<float,2>{0.385549963f, 0.145966947f},
-std::array<float,2>{0.151013121f, 0.882434011f},
-std::array<float,2>{0.549586058f, 0.410656273f},
-std::array<float,2>{0.731238425f, 0.781760216f},
-std::array<float,2>{0.0727610216f, 0.364149153f},
-std::array<float,2>{0.252405256f, 0.564834774f},
-std::array<float,2>{0.865496278f, 0.0728678331f},
-std::array<float,2>{0.784947097f, 0.850418925f},
-std::array<float,2>{0.339222074f, 0.290615588f},
-std::array<float,2>{0.0508920029f, 0.522641242f},
-std::array<float,2>{0.6822173f, 0.0315699615f},
-std::array<float,2>{0.585703969f, 0.694601536f},
-std::array<float,2>{0.19534272f, 0.215423331f},
-std::array<float,2>{0.44655031f, 0.951719701f},
-std::array<float,2>{0.882682681f, 0.487727672f},
-std::array<float,2>{0.949353278f, 0.573423803f},
-std::array<float,2>{0.437411755f, 0.0632266626f},
-std::array<float,2>{0.172695443f, 0.793648064f},
-std::array<float,2>{0.52625519f, 0.371964574f},
-std::array<float,2>{0.714666724f, 0.882833958f},
-std::array<float,2>{0.108326197f, 0.421598166f},
-std::array<float,2>{0.285960972f, 0.638414323f},
-std::array<float,2>{0.839976847f, 0.152264401f},
-std::array<float,2>{0.933815777f, 0.981798947f},
-std::array<float,2>{0.476214856f, 0.461728215f},
-std::array<float,2>{0.230052754f, 0.746735275f},
-std::array<float,2>{0.600138903f, 0.241919681f},
-std::array<float,2>{0.632813334f, 0.540397763f},
-std::array<float,2>{0.00579937873f, 0.02263253f},
-std::array<float,2>{0.374452055f, 0.815865338f},
-std::array<float,2>{0.77531296f, 0.280448377f},
-std::array<float,2>{0.86942178f, 0.658321857f},
-std::array<float,2>{0.261014968f, 0.166901276f},
-std::array<float,2>{0.0625960156f, 0.909017146f},
-std::array<float,2>{0.725684583f, 0.405371517f},
-std::array<float,2>{0.562454462f, 0.752849877f},
-std::array<float,2>{0.147435978f, 0.315743387f},
-std::array<float,2>{0.378110915f, 0.610294878f},
-std::array<float,2>{0.978327155f, 0.115849704f},
-std::array<float,2>{0.993242204f, 0.798718214f},
-std::array<float,2>{0.391446143f, 0.35762471f},
-std::array<float,2>{0.139974758f, 0.583270669f},
-std::array<float,2>{0.537121654f, 0.0863663778f},
-std::array<float,2>{0.736075521f, 0.642818749f},
-std::array<float,2>{0.0821009353f, 0.131169677f},
-std::array<float,2>{0.272577852f, 0.893014371f},
-std::array<float,2>{0.847883046f, 0.431861699f},
-std::array<float,2>{0.751344264f, 0.500045002f},
-std::array<float,2>{0.352345675f, 0.0502043366f},
-std::array<float,2>{0.0166660678f, 0.87199074f},
-std::array<float,2>{0.641736746f, 0.300640434f},
-std::array<float,2>{0.611648023f, 0.963835478f},
-std::array<float,2>{0.237001508f, 0.480621457f},
-std::array<float,2>{0.495896816f, 0.710505247f},
-std::array<float,2>{0.910855174f, 0.193633586f},
-std::array<float,2>{0.818260193f, 0.922208786f},
-std::array<float,2>{0.303733498f, 0.38754046f},
-std::array<float,2>{0.110391922f, 0.679998636f},
-std::array<float,2>{0.690223217f, 0.176759601f},
-std::array<float,2>{0.502527416f, 0.59880805f},
-std::array<float,2>{0.158688992f, 0.0962421224f},
-std::array<float,2>{0.417642772f, 0.773157656f},
-std::array<float,2>{0.966600955f, 0.337306529f},
-std::array<float,2>{0.905081511f, 0.723344028f},
-std::array<float,2>{0.458302408f, 0.229838237f},
-std::array<float,2>{0.210887089f, 0.985004246f},
-std::array<float,2>{0.56836921f, 0.4507882f},
-std::array<float,2>{0.663566232f, 0.828842461f},
-std::array<float,2>{0.0384097695f, 0.254843533f},
-std::array<float,2>{0.325141221f, 0.555824935f},
-std::array<float,2>{0.802201331f, 0.00124315312f},
-std::array<float,2>{0.860383093f, 0.834516943f},
-std::array<float,2>{0.254603297f, 0.252003402f},
-std::array<float,2>{0.076284036f, 0.559574842f},
-std::array<float,2>{0.727139533f, 0.00538283866f},
-std::array<float,2>{0.553467214f, 0.722168028f},
-std::array<float,2>{0.154391527f, 0.232654765f},
-std::array<float,2>{0.390177518f, 0.990814209f},
-std::array<float,2>{0.975367188f, 0.448731959f},
-std::array<float,2>{0.929500878f, 0.594227195f},
-std::array<float,2>{0.481184423f, 0.100585386f},
-std::array<float,2>{0.224292502f, 0.769194126f},
-std::array<float,2>{0.607092142f, 0.342219979f},
-std::array<float,2>{0.632503331f, 0.928065479f},
-std::array<float,2>{0.0106456f, 0.382998437f},
-std::array<float,2>{0.362662643f, 0.686829031f},
-std::array<float,2>{0.769271731f, 0.175466478f},
-std::array<float,2>{0.943010986f, 0.967087686f},
-std::array<float,2>{0.427912533f, 0.479986489f},
-std::array<float,2>{0.180479407f, 0.706547737f},
-std::array<float,2>{0.523412287f, 0.18894811f},
-std::array<float,2>{0.705384195f, 0.5070467f},
-std::array<float,2>{0.100739986f, 0.0532027408f},
-std::array<float,2>{0.293004423f, 0.869028211f},
-std::array<float,2>{0.833923459f, 0.303266197f},
-std::array<float,2>{0.791194081f, 0.64763093f},
-std::array<float,2>{0.331248015f, 0.125432402f},
-std::array<float,2>{0.0622270629f, 0.895619273f},
-std::array<float,2>{0.675329864f, 0.437144995f},
-std::array<float,2>{0.589893281f, 0.801960945f},
-std::array<float,2>{0.190123737f, 0.3551265f},
-std::array<float,2>{0.438749969f, 0.580136716f},
-std::array<float,2>{0.888639271f, 0.0907290801f},
-std::array<float,2>{0.894442856f, 0.757630527f},
-std::array<float,2>{0.461260617f, 0.318850994f},
-std::array<float,2>{0.211323485f, 0.614837527f},
-std::array<float,2>{0.574498653f, 0.11124748f},
-std::array<float,2>{0.669328272f, 0.663152039f},
-std::array<float,2>{0.0406525731f, 0.169398531f},
-std::array<float,2>{0.318549544f, 0.911332965f},
-std::array<float,2>{0.805165291f, 0.401521564f},
-std::array<float,2>{0.826278389f, 0.546723127f},
-std::array<float,2>{0.309981495f, 0.0180904884f},
-std::array<float,2>{0.124402866f, 0.81731832f},
-std::array<float,2>{0.696065724f, 0.276743263f},
-std::array<float,2>{0.509711206f, 0.979169726f},
-std::array<float,2>{0.167944059f, 0.468687385f},
-std::array<float,2>{0.412598491f, 0.743904948f},
-std::array<float,2>{0.960370243f, 0.23501201f},
-std::array<float,2>{0.758555532f, 0.887900174f},
-std::array<float,2>{0.351550788f, 0.414862484f},
-std::array<float,2>{0.0243802685f, 0.634517729f},
-std::array<float,2>{0.656169653f, 0.153897673f},
-std::array<float,2>{0.62203753f, 0.57535249f},
-std::array<float,2>{0.247056693f, 0.0673121363f},
-std::array<float,2>{0.48766169f, 0.789608419f},
-std::array<float,2>{0.919740081f, 0.369626671f},
-std::array<float,2>{0.990776598f, 0.690692186f},
-std::array<float,2>{0.398963869f, 0.213478833f},
-std::array<float,2>{0.126957715f, 0.945881069f},
-std::array<float,2>{0.545343995f, 0.490063548f},
-std::array<float,2>{0.748566747f, 0.846530974f},
-std::array<float,2>{0.0936378837f, 0.296488792f},
-std::array<float,2>{0.276093602f, 0.518222272f},
-std::array<float,2>{0.859188795f, 0.036061909f},
-std::array<float,2>{0.798733413f, 0.786257803f},
-std::array<float,2>{0.322822511f, 0.363076836f},
-std::array<float,2>{0.0345888548f, 0.570233405f},
-std::array<float,2>{0.658636093f, 0.0775594413f},
-std::array<float,2>{0.566191971f, 0.628109574f},
-std::array<float,2>{0.203969255f, 0.140932247f},
-std::array<float,2>{0.456929475f, 0.87670821f},
-std::array<float,2>{0.902266443f, 0.407552481f},
-std::array<float,2>{0.962387681f, 0.530400217f},
-std::array<float,2>{0.421697557f, 0.0410349704f},
-std::array<float,2>{0.161363408f, 0.851782739f},
-std::array<float,2>{0.506872177f, 0.283426553f},
-std::array<float,2>{0.692963123f, 0.939575911f},
-std::array<float,2>{0.115965396f, 0.493189484f},
-std::array<float,2>{0.297312796f, 0.701045692f},
-std::array<float,2>{0.814672947f, 0.206767246f},
-std::array<float,2>{0.906992674f, 0.915035367f},
-std::array<float,2>{0.49753207f, 0.391175985f},
-std::array<float,2>{0.239590541f, 0.668504953f},
-std::array<float,2>{0.615658581f, 0.159649149f},
-std::array<float,2>{0.644964457f, 0.617712021f},
-std::array<float,2>{0.0206002761f, 0.124240711f},
-std::array<float,2>{0.35759449f, 0.762609899f},
-std::array<float,2>{0.757023275f, 0.32226029f},
-std::array<float,2>{0.847536922f, 0.738991261f},
-std::array<float,2>{0.267849684f, 0.244340539f},
-std::array<float,2>{0.0818452537f, 0.97149992f},
-std::array<float,2>{0.738862932f, 0.453738123f},
-std::array<float,2>{0.534665942f, 0.826842368f},
-std::array<float,2>{0.136616141f, 0.267217517f},
-std::array<float,2>{0.395740211f, 0.536371768f},
-std::array<float,2>{0.996780336f, 0.0281289127f},
-std::array<float,2>{0.982053638f, 0.866643846f},
-std::array<float,2>{0.382730365f, 0.308035076f},
-std::array<float,2>{0.141667947f, 0.510938406f},
-std::array<float,2>{0.557987452f, 0.0599088706f},
-std::array<float,2>{0.719470978f, 0.716088593f},
-std::array<float,2>{0.0664888471f, 0.203069285f},
-std::array<float,2>{0.263723552f, 0.954199791f},
-std::array<float,2>{0.872082472f, 0.472879022f},
-std::array<float,2>{0.779311538f, 0.589603305f},
-std::array<float,2>{0.368123382f, 0.0833535716f},
-std::array<float,2>{0.00206839084f, 0.809959769f},
-std::array<float,2>{0.638761759f, 0.346874624f},
-std::array<float,2>{0.596113563f, 0.898572981f},
-std::array<float,2>{0.232661113f, 0.422296107f},
-std::array<float,2>{0.471022248f, 0.648850679f},
-std::array<float,2>{0.930811465f, 0.138094783f},
-std::array<float,2>{0.838423848f, 0.993548691f},
-std::array<float,2>{0.284710854f, 0.44118458f},
-std::array<float,2>{0.102037385f, 0.729425907f},
-std::array<float,2>{0.716204762f, 0.223620564f},
-std::array<float,2>{0.530506492f, 0.550645053f},
-std::array<float,2>{0.179494306f, 0.0108080013f},
-std::array<float,2>{0.430535853f, 0.837263107f},
-std::array<float,2>{0.94761914f, 0.264084131f},
-std::array<float,2>{0.876728237f, 0.679414749f},
-std::array<float,2>{0.451786518f, 0.18498759f},
-std::array<float,2>{0.199901775f, 0.930249155f},
-std::array<float,2>{0.579446554f, 0.375581652f},
-std::array<float,2>{0.684136212f, 0.777021766f},
-std::array<float,2>{0.0491344593f, 0.329633117f},
-std::array<float,2>{0.340190679f, 0.608100057f},
-std::array<float,2>{0.788985014f, 0.105029635f},
-std::array<float,2>{0.819726288f, 0.772649169f},
-std::array<float,2>{0.302129328f, 0.337565452f},
-std::array<float,2>{0.112163298f, 0.599391699f},
-std::array<float,2>{0.687719822f, 0.0961773992f},
-std::array<float,2>{0.50006181f, 0.680526316f},
-std::array<float,2>{0.158076674f, 0.177545354f},
-std::array<float,2>{0.41492182f, 0.92282933f},
-std::array<float,2>{0.968621135f, 0.386968136f},
-std::array<float,2>{0.903262198f, 0.556543112f},
-std::array<float,2>{0.459839284f, 0.00175139983f},
-std::array<float,2>{0.208561823f, 0.828150988f},
-std::array<float,2>{0.567791224f, 0.254239798f},
-std::array<float,2>{0.661429405f, 0.984745681f},
-std::array<float,2>{0.0358232148f, 0.450613797f},
-std::array<float,2>{0.326813161f, 0.722784519f},
-std::array<float,2>{0.804232538f, 0.23029457f},
-std::array<float,2>{0.995420873f, 0.893125176f},
-std::array<float,2>{0.393084854f, 0.432441533f},
-std::array<float,2>{0.138005391f, 0.643187702f},
-std::array<float,2>{0.535979688f, 0.131706014f},
-std::array<float,2>{0.737846375f, 0.583779156f},
-std::array<float,2>{0.0856407434f, 0.0864312723f},
-std::array<float,2>{0.271253884f, 0.798329532f},
-std::array<float,2>{0.84966141f, 0.357979804f},
-std::array<float,2>{0.752964914f, 0.710446656f},
-std::array<float,2>{0.355445713f, 0.194030792f},
-std::array<float,2>{0.0188413244f, 0.963193774f},
-std::array<float,2>{0.643208802f, 0.481390059f},
-std::array<float,2>{0.609468937f, 0.871422231f},
-std::array<float,2>{0.235634282f, 0.300006479f},
-std::array<float,2>{0.493978411f, 0.500742257f},
-std::array<float,2>{0.912465215f, 0.0504376628f},
-std::array<float,2>{0.936787128f, 0.816123486f},
-std::array<float,2>{0.474163383f, 0.280795723f},
-std::array<float,2>{0.228280142f, 0.540622294f},
-std::array<float,2>{0.599179626f, 0.0230547208f},
-std::array<float,2>{0.636260033f, 0.746361196f},
-std::array<float,2>{0.00642561913f, 0.241678804f},
-std::array<float,2>{0.371762276f, 0.982090652f},
-std::array<float,2>{0.776432872f, 0.461234093f},
-std::array<float,2>{0.867252588f, 0.609582126f},
-std::array<float,2>{0.258538187f, 0.115645267f},
-std::array<float,2>{0.0651669279f, 0.752302647f},
-std::array<float,2>{0.723271251f, 0.316375494f},
-std::array<float,2>{0.560367286f, 0.908554733f},
-std::array<float,2>{0.144765869f, 0.405882955f},
-std::array<float,2>{0.375845075f, 0.658888161f},
-std::array<float,2>{0.979400277f, 0.166059554f},
-std::array<float,2>{0.782322586f, 0.951266468f},
-std::array<float,2>{0.335977852f, 0.487982869f},
-std::array<float,2>{0.0533991382f, 0.695053041f},
-std::array<float,2>{0.681405246f, 0.214927286f},
-std::array<float,2>{0.583718657f, 0.52300334f},
-std::array<float,2>{0.198803231f, 0.0318346284f},
-std::array<float,2>{0.447552741f, 0.849903405f},
-std::array<float,2>{0.879858375f, 0.290287465f},
-std::array<float,2>{0.95138222f, 0.637775242f},
-std::array<float,2>{0.435097098f, 0.151767135f},
-std::array<float,2>{0.17392914f, 0.883579075f},
-std::array<float,2>{0.523674965f, 0.421173245f},
-std::array<float,2>{0.711651444f, 0.793396831f},
-std::array<float,2>{0.105984166f, 0.371179253f},
-std::array<float,2>{0.28780216f, 0.573993862f},
-std::array<float,2>{0.84180212f, 0.0625280589f},
-std::array<float,2>{0.77250886f, 0.858225167f},
-std::array<float,2>{0.36563611f, 0.286981434f},
-std::array<float,2>{0.0137611711f, 0.525977075f},
-std::array<float,2>{0.627390802f, 0.0430170633f},
-std::array<float,2>{0.603367329f, 0.696323395f},
-std::array<float,2>{0.219571054f, 0.210418656f},
-std::array<float,2>{0.479343206f, 0.943296313f},
-std::array<float,2>{0.923159182f, 0.499089658f},
-std::array<float,2>{0.968877852f, 0.565263867f},
-std::array<float,2>{0.384512097f, 0.072735548f},
-std::array<float,2>{0.14956215f, 0.781647086f},
-std::array<float,2>{0.547126412f, 0.363416284f},
-std::array<float,2>{0.734003305f, 0.882292032f},
-std::array<float,2>{0.0708884075f, 0.41026175f},
-std::array<float,2>{0.250942349f, 0.630878747f},
-std::array<float,2>{0.86521399f, 0.146204934f},
-std::array<float,2>{0.883212328f, 0.976427734f},
-std::array<float,2>{0.443925321f, 0.45820722f},
-std::array<float,2>{0.192836121f, 0.737664461f},
-std::array<float,2>{0.586958528f, 0.247278363f},
-std::array<float,2>{0.679317057f, 0.53238982f},
-std::array<float,2>{0.0556945689f, 0.0258377921f},
-std::array<float,2>{0.333048761f, 0.823068798f},
-std::array<float,2>{0.793196619f, 0.273295879f},
-std::array<float,2>{0.830292225f, 0.665743887f},
-std::array<float,2>{0.292289585f, 0.164005563f},
-std::array<float,2>{0.0941124186f, 0.920687139f},
-std::array<float,2>{0.70795536f, 0.398388624f},
-std::array<float,2>{0.518669069f, 0.760370493f},
-std::array<float,2>{0.18376714f, 0.326569885f},
-std::array<float,2>{0.424048185f, 0.624623537f},
-std::array<float,2>{0.938056052f, 0.117946476f},
-std::array<float,2>{0.954327166f, 0.804970741f},
-std::array<float,2>{0.40841943f, 0.35100469f},
-std::array<float,2>{0.169539139f, 0.593323529f},
-std::array<float,2>{0.513850927f, 0.079163067f},
-std::array<float,2>{0.701758921f, 0.655938029f},
-std::array<float,2>{0.119668573f, 0.134199873f},
-std::array<float,2>{0.306816846f, 0.902403176f},
-std::array<float,2>{0.823382139f, 0.428708315f},
-std::array<float,2>{0.810129106f, 0.514971614f},
-std::array<float,2>{0.312815368f, 0.0584824421f},
-std::array<float,2>{0.0431561023f, 0.860410452f},
-std::array<float,2>{0.667270184f, 0.311406463f},
-std::array<float,2>{0.570782781f, 0.957407951f},
-std::array<float,2>{0.215539128f, 0.472010821f},
-std::array<float,2>{0.466227293f, 0.714575768f},
-std::array<float,2>{0.897325516f, 0.19674249f},
-std::array<float,2>{0.85208863f, 0.934650123f},
-std::array<float,2>{0.279271185f, 0.379847199f},
-std::array<float,2>{0.0883324221f, 0.675068021f},
-std::array<float,2>{0.743721843f, 0.18034929f},
-std::array<float,2>{0.541615546f, 0.602829456f},
-std::array<float,2>{0.130954549f, 0.105921187f},
-std::array<float,2>{0.405337393f, 0.779041946f},
-std::array<float,2>{0.985919356f, 0.335044861f},
-std::array<float,2>{0.91506654f, 0.731468797f},
-std::array<float,2>{0.491803527f, 0.222297043f},
-std::array<float,2>{0.243552595f, 0.997026086f},
-std::array<float,2>{0.621089756f, 0.442284137f},
-std::array<float,2>{0.648790658f, 0.840106249f},
-std::array<float,2>{0.0276888777f, 0.2613087f},
-std::array<float,2>{0.346450031f, 0.553345323f},
-std::array<float,2>{0.763964534f, 0.0130996108f},
-std::array<float,2>{0.835137546f, 0.869819462f},
-std::array<float,2>{0.295203149f, 0.302730948f},
-std::array<float,2>{0.0990687236f, 0.504413486f},
-std::array<float,2>{0.703149021f, 0.0515296757f},
-std::array<float,2>{0.521268487f, 0.704925358f},
-std::array<float,2>{0.182774812f, 0.190670073f},
-std::array<float,2>{0.426195353f, 0.965753198f},
-std::array<float,2>{0.945249736f, 0.476784557f},
-std::array<float,2>{0.888756335f, 0.579016447f},
-std::array<float,2>{0.44022572f, 0.0918673202f},
-std::array<float,2>{0.18924655f, 0.804397225f},
-std::array<float,2>{0.593152404f, 0.351750553f},
-std::array<float,2>{0.673339844f, 0.897897542f},
-std::array<float,2>{0.0593778379f, 0.435255915f},
-std::array<float,2>{0.328991085f, 0.646080613f},
-std::array<float,2>{0.790447116f, 0.127452478f},
-std::array<float,2>{0.972747684f, 0.989924908f},
-std::array<float,2>{0.387966603f, 0.446201891f},
-std::array<float,2>{0.153981179f, 0.718786716f},
-std::array<float,2>{0.550913215f, 0.231632173f},
-std::array<float,2>{0.729042351f, 0.561316907f},
-std::array<float,2>{0.0742531344f, 0.00777579891f},
-std::array<float,2>{0.256009609f, 0.833143413f},
-std::array<float,2>{0.861656964f, 0.251049906f},
-std::array<float,2>{0.766763866f, 0.685493588f},
-std::array<float,2>{0.360124648f, 0.172434404f},
-std::array<float,2>{0.00902498793f, 0.926564395f},
-std::array<float,2>{0.630607724f, 0.386247844f},
-std::array<float,2>{0.608275831f, 0.766934693f},
-std::array<float,2>{0.225481033f, 0.340277314f},
-std::array<float,2>{0.483525038f, 0.597501278f},
-std::array<float,2>{0.92600584f, 0.0987339839f},
-std::array<float,2>{0.920982242f, 0.791131973f},
-std::array<float,2>{0.485100925f, 0.367541283f},
-std::array<float,2>{0.248911217f, 0.576839626f},
-std::array<float,2>{0.624838352f, 0.0700368881f},
-std::array<float,2>{0.654064775f, 0.636238933f},
-std::array<float,2>{0.0265301634f, 0.15528135f},
-std::array<float,2>{0.349589825f, 0.889506578f},
-std::array<float,2>{0.760725677f, 0.416361839f},
-std::array<float,2>{0.857169449f, 0.515703201f},
-std::array<float,2>{0.274213403f, 0.0386964045f},
-std::array<float,2>{0.0916939154f, 0.843793154f},
-std::array<float,2>{0.747283459f, 0.294285327f},
-std::array<float,2>{0.544235528f, 0.948855817f},
-std::array<float,2>{0.126658618f, 0.492028952f},
-std::array<float,2>{0.400762558f, 0.687599003f},
-std::array<float,2>{0.989763439f, 0.211568162f},
-std::array<float,2>{0.808108449f, 0.913728297f},
-std::array<float,2>{0.317002952f, 0.399578184f},
-std::array<float,2>{0.0419363081f, 0.660477161f},
-std::array<float,2>{0.671544373f, 0.170982882f},
-std::array<float,2>{0.57803005f, 0.616624594f},
-std::array<float,2>{0.21457316f, 0.112523302f},
-std::array<float,2>{0.463073373f, 0.754423738f},
-std::array<float,2>{0.891599596f, 0.317305058f},
-std::array<float,2>{0.958202541f, 0.744533956f},
-std::array<float,2>{0.4106929f, 0.236575127f},
-std::array<float,2>{0.164751351f, 0.978348792f},
-std::array<float,2>{0.510681272f, 0.465766102f},
-std::array<float,2>{0.697398841f, 0.819570124f},
-std::array<float,2>{0.121873021f, 0.273477435f},
-std::array<float,2>{0.311807603f, 0.544273376f},
-std::array<float,2>{0.824734688f, 0.0164938476f},
-std::array<float,2>{0.754560888f, 0.763817191f},
-std::array<float,2>{0.356404632f, 0.323895156f},
-std::array<float,2>{0.0225134864f, 0.620546877f},
-std::array<float,2>{0.647782803f, 0.122055948f},
-std::array<float,2>{0.61370945f, 0.671518266f},
-std::array<float,2>{0.242040485f, 0.156971157f},
-std::array<float,2>{0.498367816f, 0.916671991f},
-std::array<float,2>{0.908350885f, 0.393859118f},
-std::array<float,2>{0.998124719f, 0.537540615f},
-std::array<float,2>{0.396895885f, 0.0297875963f},
-std::array<float,2>{0.134117022f, 0.824451745f},
-std::array<float,2>{0.532816887f, 0.267837018f},
-std::array<float,2>{0.741359293f, 0.970116675f},
-std::array<float,2>{0.0788042992f, 0.456495851f},
-std::array<float,2>{0.266665041f, 0.74150914f},
-std::array<float,2>{0.844400346f, 0.243218824f},
-std::array<float,2>{0.899140298f, 0.878700733f},
-std::array<float,2>{0.454572827f, 0.40907827f},
-std::array<float,2>{0.206811428f, 0.625541687f},
-std::array<float,2>{0.563396096f, 0.144088611f},
-std::array<float,2>{0.656374633f, 0.566447198f},
-std::array<float,2>{0.0323716626f, 0.0748883188f},
-std::array<float,2>{0.321010768f, 0.788279414f},
-std::array<float,2>{0.799948573f, 0.36064136f},
-std::array<float,2>{0.813678682f, 0.702053189f},
-std::array<float,2>{0.299947917f, 0.203542873f},
-std::array<float,2>{0.11471916f, 0.938119411f},
-std::array<float,2>{0.69522512f, 0.49440828f},
-std::array<float,2>{0.50504899f, 0.853873134f},
-std::array<float,2>{0.16391325f, 0.282921821f},
-std::array<float,2>{0.419487298f, 0.528390825f},
-std::array<float,2>{0.964466393f, 0.0401010886f},
-std::array<float,2>{0.945459425f, 0.839652181f},
-std::array<float,2>{0.433137029f, 0.263421983f},
-std::array<float,2>{0.177449688f, 0.547264278f},
-std::array<float,2>{0.527371585f, 0.00784146227f},
-std::array<float,2>{0.717452466f, 0.728219926f},
-std::array<float,2>{0.105154939f, 0.225354448f},
-std::array<float,2>{0.28196156f, 0.994427681f},
-std::array<float,2>{0.837430894f, 0.437936157f},
-std::array<float,2>{0.785214663f, 0.606985211f},
-std::array<float,2>{0.34309268f, 0.103127606f},
-std::array<float,2>{0.0472211055f, 0.775114894f},
-std::array<float,2>{0.685593605f, 0.330599159f},
-std::array<float,2>{0.58097297f, 0.933447599f},
-std::array<float,2>{0.202879235f, 0.378012568f},
-std::array<float,2>{0.449932247f, 0.67598629f},
-std::array<float,2>{0.878563643f, 0.186308324f},
-std::array<float,2>{0.874084353f, 0.956928909f},
-std::array<float,2>{0.262175083f, 0.474665791f},
-std::array<float,2>{0.068853125f, 0.71819824f},
-std::array<float,2>{0.722115517f, 0.200061917f},
-std::array<float,2>{0.555661082f, 0.509180844f},
-std::array<float,2>{0.143681809f, 0.0624421611f},
-std::array<float,2>{0.380398661f, 0.864793539f},
-std::array<float,2>{0.982444882f, 0.305000246f},
-std::array<float,2>{0.932658613f, 0.65074563f},
-std::array<float,2>{0.468805999f, 0.140511915f},
-std::array<float,2>{0.23061946f, 0.900904f},
-std::array<float,2>{0.594087839f, 0.423925221f},
-std::array<float,2>{0.638630033f, 0.812091291f},
-std::array<float,2>{0.000777270412f, 0.344572842f},
-std::array<float,2>{0.370159f, 0.58770895f},
-std::array<float,2>{0.778232276f, 0.0844214484f},
-std::array<float,2>{0.848479688f, 0.79986316f},
-std::array<float,2>{0.273019105f, 0.356707931f},
-std::array<float,2>{0.0827872828f, 0.584803998f},
-std::array<float,2>{0.735512316f, 0.0880348012f},
-std::array<float,2>{0.537641704f, 0.641409636f},
-std::array<float,2>{0.14014554f, 0.130225688f},
-std::array<float,2>{0.391088933f, 0.891697109f},
-std::array<float,2>{0.993657112f, 0.431597531f},
-std::array<float,2>{0.910368621f, 0.50382787f},
-std::array<float,2>{0.495217562f, 0.0484208353f},
-std::array<float,2>{0.236480847f, 0.874692798f},
-std::array<float,2>{0.612287581f, 0.298439831f},
-std::array<float,2>{0.64231509f, 0.961239874f},
-std::array<float,2>{0.0172526725f, 0.483566344f},
-std::array<float,2>{0.351919174f, 0.707671583f},
-std::array<float,2>{0.751936018f, 0.193143457f},
-std::array<float,2>{0.965822458f, 0.925087154f},
-std::array<float,2>{0.417237014f, 0.389001369f},
-std::array<float,2>{0.158724979f, 0.681940317f},
-std::array<float,2>{0.5020082f, 0.178008303f},
-std::array<float,2>{0.689842105f, 0.600888968f},
-std::array<float,2>{0.111061379f, 0.0941534936f},
-std::array<float,2>{0.304400802f, 0.770975113f},
-std::array<float,2>{0.817516327f, 0.33822003f},
-std::array<float,2>{0.802249908f, 0.725824535f},
-std::array<float,2>{0.324425012f, 0.227214217f},
-std::array<float,2>{0.0386873595f, 0.987163484f},
-std::array<float,2>{0.663611054f, 0.451262265f},
-std::array<float,2>{0.568994999f, 0.832021773f},
-std::array<float,2>{0.210123584f, 0.256790727f},
-std::array<float,2>{0.458639324f, 0.557009161f},
-std::array<float,2>{0.904690146f, 0.00258085551f},
-std::array<float,2>{0.882036984f, 0.848076761f},
-std::array<float,2>{0.446860522f, 0.292892575f},
-std::array<float,2>{0.196024001f, 0.520051658f},
-std::array<float,2>{0.585122466f, 0.0336477198f},
-std::array<float,2>{0.681711257f, 0.691571712f},
-std::array<float,2>{0.051388856f, 0.217958421f},
-std::array<float,2>{0.339792579f, 0.950790107f},
-std::array<float,2>{0.78421855f, 0.486207694f},
-std::array<float,2>{0.840804219f, 0.571632028f},
-std::array<float,2>{0.285285354f, 0.0647516325f},
-std::array<float,2>{0.107764825f, 0.796280622f},
-std::array<float,2>{0.713984489f, 0.374204427f},
-std::array<float,2>{0.525699496f, 0.885695457f},
-std::array<float,2>{0.171984121f, 0.418426663f},
-std::array<float,2>{0.436721504f, 0.638783455f},
-std::array<float,2>{0.949870467f, 0.148604572f},
-std::array<float,2>{0.774633884f, 0.983144045f},
-std::array<float,2>{0.374921471f, 0.463696808f},
-std::array<float,2>{0.00491958437f, 0.748420358f},
-std::array<float,2>{0.633578479f, 0.239630997f},
-std::array<float,2>{0.599901736f, 0.542645216f},
-std::array<float,2>{0.229758456f, 0.020052664f},
-std::array<float,2>{0.476021111f, 0.813914597f},
-std::array<float,2>{0.934090555f, 0.277618915f},
-std::array<float,2>{0.977836847f, 0.657060981f},
-std::array<float,2>{0.378796995f, 0.164776862f},
-std::array<float,2>{0.14674446f, 0.907714188f},
-std::array<float,2>{0.561555684f, 0.403045386f},
-std::array<float,2>{0.726396799f, 0.751392007f},
-std::array<float,2>{0.0633671284f, 0.313569069f},
-std::array<float,2>{0.261457533f, 0.612655163f},
-std::array<float,2>{0.869973004f, 0.11380592f},
-std::array<float,2>{0.795904756f, 0.821626902f},
-std::array<float,2>{0.33573997f, 0.269784778f},
-std::array<float,2>{0.0567589216f, 0.535089195f},
-std::array<float,2>{0.676680148f, 0.0247749519f},
-std::array<float,2>{0.588035941f, 0.735039949f},
-std::array<float,2>{0.193816066f, 0.249338329f},
-std::array<float,2>{0.442243576f, 0.973021984f},
-std::array<float,2>{0.885003865f, 0.459359318f},
-std::array<float,2>{0.940422475f, 0.621600568f},
-std::array<float,2>{0.422490805f, 0.120242469f},
-std::array<float,2>{0.186151594f, 0.758851051f},
-std::array<float,2>{0.516051829f, 0.324238509f},
-std::array<float,2>{0.709451914f, 0.918425262f},
-std::array<float,2>{0.0959746167f, 0.395510465f},
-std::array<float,2>{0.290890455f, 0.667551875f},
-std::array<float,2>{0.828329206f, 0.161493301f},
-std::array<float,2>{0.924877644f, 0.944185972f},
-std::array<float,2>{0.477927208f, 0.496279776f},
-std::array<float,2>{0.221465692f, 0.698245227f},
-std::array<float,2>{0.604176104f, 0.208427951f},
-std::array<float,2>{0.625203192f, 0.525267482f},
-std::array<float,2>{0.0123046348f, 0.0459017493f},
-std::array<float,2>{0.36385268f, 0.856837869f},
-std::array<float,2>{0.770458579f, 0.28735739f},
-std::array<float,2>{0.866204679f, 0.630183876f},
-std::array<float,2>{0.252731264f, 0.147473037f},
-std::array<float,2>{0.0723052844f, 0.879698753f},
-std::array<float,2>{0.730943918f, 0.413734615f},
-std::array<float,2>{0.549132764f, 0.784819126f},
-std::array<float,2>{0.150401011f, 0.366934538f},
-std::array<float,2>{0.384886265f, 0.563785732f},
-std::array<float,2>{0.971343338f, 0.0714896843f},
-std::array<float,2>{0.986329734f, 0.779622138f},
-std::array<float,2>{0.403085202f, 0.333810091f},
-std::array<float,2>{0.129266843f, 0.603752851f},
-std::array<float,2>{0.540594399f, 0.109252095f},
-std::array<float,2>{0.745988429f, 0.67267561f},
-std::array<float,2>{0.086826764f, 0.183586895f},
-std::array<float,2>{0.281178147f, 0.93641448f},
-std::array<float,2>{0.855325282f, 0.381666929f},
-std::array<float,2>{0.761756003f, 0.552142799f},
-std::array<float,2>{0.344564199f, 0.0137650473f},
-std::array<float,2>{0.0311186071f, 0.84337461f},
-std::array<float,2>{0.651584506f, 0.259143919f},
-std::array<float,2>{0.617326438f, 0.998295248f},
-std::array<float,2>{0.245599985f, 0.445297122f},
-std::array<float,2>{0.489646524f, 0.733312726f},
-std::array<float,2>{0.917151988f, 0.218857631f},
-std::array<float,2>{0.821009636f, 0.905415237f},
-std::array<float,2>{0.304933041f, 0.427266538f},
-std::array<float,2>{0.11833179f, 0.654131472f},
-std::array<float,2>{0.699463189f, 0.135250241f},
-std::array<float,2>{0.511922181f, 0.589875877f},
-std::array<float,2>{0.171644986f, 0.0812416598f},
-std::array<float,2>{0.407500595f, 0.806707919f},
-std::array<float,2>{0.955943823f, 0.349154472f},
-std::array<float,2>{0.89644134f, 0.711146533f},
-std::array<float,2>{0.468269944f, 0.198555455f},
-std::array<float,2>{0.217726097f, 0.959933043f},
-std::array<float,2>{0.573513031f, 0.469837934f},
-std::array<float,2>{0.665894806f, 0.861761928f},
-std::array<float,2>{0.0460839085f, 0.309552759f},
-std::array<float,2>{0.316312283f, 0.51325506f},
-std::array<float,2>{0.81227988f, 0.0554612279f},
-std::array<float,2>{0.857651293f, 0.845188022f},
-std::array<float,2>{0.276593238f, 0.293319792f},
-std::array<float,2>{0.0924443379f, 0.516675591f},
-std::array<float,2>{0.749729037f, 0.0374822207f},
-std::array<float,2>{0.54666996f, 0.688822985f},
-std::array<float,2>{0.127966315f, 0.212698981f},
-std::array<float,2>{0.399885058f, 0.94809413f},
-std::array<float,2>{0.991388917f, 0.491122127f},
-std::array<float,2>{0.918641806f, 0.577795386f},
-std::array<float,2>{0.487270474f, 0.0691772774f},
-std::array<float,2>{0.247124821f, 0.79276675f},
-std::array<float,2>{0.622963786f, 0.368180811f},
-std::array<float,2>{0.654564083f, 0.889734864f},
-std::array<float,2>{0.0247761998f, 0.417950332f},
-std::array<float,2>{0.350199819f, 0.63541764f},
-std::array<float,2>{0.759468615f, 0.154547483f},
-std::array<float,2>{0.959933877f, 0.976613522f},
-std::array<float,2>{0.413464814f, 0.466684669f},
-std::array<float,2>{0.166147709f, 0.74585104f},
-std::array<float,2>{0.507838011f, 0.237974524f},
-std::array<float,2>{0.696346581f, 0.543175757f},
-std::array<float,2>{0.123466097f, 0.0170194358f},
-std::array<float,2>{0.309203357f, 0.818959951f},
-std::array<float,2>{0.827393353f, 0.274705112f},
-std::array<float,2>{0.806547523f, 0.661577344f},
-std::array<float,2>{0.320251614f, 0.170017824f},
-std::array<float,2>{0.0391866229f, 0.912357152f},
-std::array<float,2>{0.668581247f, 0.398755431f},
-std::array<float,2>{0.575545073f, 0.755858958f},
-std::array<float,2>{0.21219115f, 0.318116337f},
-std::array<float,2>{0.462221682f, 0.615392506f},
-std::array<float,2>{0.893301964f, 0.111772679f},
-std::array<float,2>{0.887009501f, 0.803671777f},
-std::array<float,2>{0.437904596f, 0.353145838f},
-std::array<float,2>{0.190479144f, 0.579675436f},
-std::array<float,2>{0.591545045f, 0.0936768278f},
-std::array<float,2>{0.67460084f, 0.644706428f},
-std::array<float,2>{0.0605996326f, 0.127992406f},
-std::array<float,2>{0.330297232f, 0.897279561f},
-std::array<float,2>{0.792935133f, 0.43456009f},
-std::array<float,2>{0.832433879f, 0.505007446f},
-std::array<float,2>{0.294069767f, 0.0517850183f},
-std::array<float,2>{0.100524835f, 0.870453298f},
-std::array<float,2>{0.70681107f, 0.301397294f},
-std::array<float,2>{0.521697998f, 0.965849519f},
-std::array<float,2>{0.181566283f, 0.477629185f},
-std::array<float,2>{0.428955674f, 0.703702331f},
-std::array<float,2>{0.941804767f, 0.190309778f},
-std::array<float,2>{0.767874181f, 0.927161574f},
-std::array<float,2>{0.361987829f, 0.385483772f},
-std::array<float,2>{0.0116677657f, 0.68401897f},
-std::array<float,2>{0.63175416f, 0.17363359f},
-std::array<float,2>{0.605695307f, 0.596628845f},
-std::array<float,2>{0.222918227f, 0.0984427184f},
-std::array<float,2>{0.482088655f, 0.766410828f},
-std::array<float,2>{0.928018332f, 0.341695786f},
-std::array<float,2>{0.976198077f, 0.719772518f},
-std::array<float,2>{0.389016658f, 0.230736196f},
-std::array<float,2>{0.155808583f, 0.989213765f},
-std::array<float,2>{0.553784549f, 0.446673661f},
-std::array<float,2>{0.727783978f, 0.832134783f},
-std::array<float,2>{0.0776654333f, 0.25048092f},
-std::array<float,2>{0.255711913f, 0.562441587f},
-std::array<float,2>{0.859487414f, 0.00612147152f},
-std::array<float,2>{0.787923694f, 0.773708999f},
-std::array<float,2>{0.341788977f, 0.331090838f},
-std::array<float,2>{0.0498852134f, 0.605860531f},
-std::array<float,2>{0.685140193f, 0.102062613f},
-std::array<float,2>{0.579066634f, 0.677705288f},
-std::array<float,2>{0.201151088f, 0.186602116f},
-std::array<float,2>{0.452246249f, 0.931925893f},
-std::array<float,2>{0.875525177f, 0.377425075f},
-std::array<float,2>{0.948486388f, 0.548094928f},
-std::array<float,2>{0.430870205f, 0.00941198319f},
-std::array<float,2>{0.178691015f, 0.838523149f},
-std::array<float,2>{0.5302037f, 0.261934847f},
-std::array<float,2>{0.715434194f, 0.995218456f},
-std::array<float,2>{0.102693595f, 0.438955247f},
-std::array<float,2>{0.284103543f, 0.726567924f},
-std::array<float,2>{0.839411795f, 0.226333216f},
-std::array<float,2>{0.930500865f, 0.90190351f},
-std::array<float,2>{0.471722245f, 0.425132543f},
-std::array<float,2>{0.233878344f, 0.65219593f},
-std::array<float,2>{0.597356677f, 0.139063284f},
-std::array<float,2>{0.640317678f, 0.586626351f},
-std::array<float,2>{0.00347174914f, 0.085718669f},
-std::array<float,2>{0.368912309f, 0.810577512f},
-std::array<float,2>{0.781022966f, 0.344940841f},
-std::array<float,2>{0.872014284f, 0.717008173f},
-std::array<float,2>{0.264805675f, 0.200650707f},
-std::array<float,2>{0.0676253438f, 0.955277681f},
-std::array<float,2>{0.719987154f, 0.476154745f},
-std::array<float,2>{0.557531118f, 0.86337018f},
-std::array<float,2>{0.141307667f, 0.306123227f},
-std::array<float,2>{0.381834507f, 0.50796032f},
-std::array<float,2>{0.980863154f, 0.0610096455f},
-std::array<float,2>{0.997762978f, 0.825380743f},
-std::array<float,2>{0.395124793f, 0.269247949f},
-std::array<float,2>{0.135482579f, 0.538116217f},
-std::array<float,2>{0.533514023f, 0.0310125612f},
-std::array<float,2>{0.739942968f, 0.741033673f},
-std::array<float,2>{0.0803040266f, 0.243107438f},
-std::array<float,2>{0.268600017f, 0.968763471f},
-std::array<float,2>{0.845924616f, 0.455250889f},
-std::array<float,2>{0.756648123f, 0.619754434f},
-std::array<float,2>{0.358440578f, 0.122572891f},
-std::array<float,2>{0.0201630089f, 0.765175581f},
-std::array<float,2>{0.646122336f, 0.322553694f},
-std::array<float,2>{0.616644919f, 0.917608678f},
-std::array<float,2>{0.239199609f, 0.393008351f},
-std::array<float,2>{0.497035146f, 0.670229614f},
-std::array<float,2>{0.907604873f, 0.157570317f},
-std::array<float,2>{0.815545559f, 0.939171374f},
-std::array<float,2>{0.298270315f, 0.495268166f},
-std::array<float,2>{0.117083639f, 0.702956975f},
-std::array<float,2>{0.692255318f, 0.204791963f},
-std::array<float,2>{0.506288469f, 0.527429342f},
-std::array<float,2>{0.160698578f, 0.0396478213f},
-std::array<float,2>{0.420803577f, 0.855039597f},
-std::array<float,2>{0.961824715f, 0.282007247f},
-std::array<float,2>{0.9007532f, 0.626174986f},
-std::array<float,2>{0.455835819f, 0.142872036f},
-std::array<float,2>{0.204817697f, 0.877297282f},
-std::array<float,2>{0.564501882f, 0.410085648f},
-std::array<float,2>{0.659948409f, 0.787412524f},
-std::array<float,2>{0.0337802581f, 0.359659433f},
-std::array<float,2>{0.323717415f, 0.567868233f},
-std::array<float,2>{0.797762275f, 0.0754316449f},
-std::array<float,2>{0.843557656f, 0.795181751f},
-std::array<float,2>{0.288666576f, 0.373671323f},
-std::array<float,2>{0.107361034f, 0.571029305f},
-std::array<float,2>{0.712674618f, 0.066327326f},
-std::array<float,2>{0.524779975f, 0.639686346f},
-std::array<float,2>{0.17507942f, 0.149661884f},
-std::array<float,2>{0.434179395f, 0.886651993f},
-std::array<float,2>{0.952827513f, 0.419874102f},
-std::array<float,2>{0.88081646f, 0.520622671f},
-std::array<float,2>{0.448612303f, 0.0349940285f},
-std::array<float,2>{0.198093295f, 0.849604547f},
-std::array<float,2>{0.582602978f, 0.291536212f},
-std::array<float,2>{0.680183828f, 0.949907601f},
-std::array<float,2>{0.0540759973f, 0.484450012f},
-std::array<float,2>{0.337248147f, 0.692401588f},
-std::array<float,2>{0.781509995f, 0.217628106f},
-std::array<float,2>{0.980120301f, 0.907169759f},
-std::array<float,2>{0.376702189f, 0.403498739f},
-std::array<float,2>{0.146035299f, 0.657423913f},
-std::array<float,2>{0.559418201f, 0.165283427f},
-std::array<float,2>{0.723807991f, 0.612195194f},
-std::array<float,2>{0.0655970797f, 0.114492476f},
-std::array<float,2>{0.259396613f, 0.750045896f},
-std::array<float,2>{0.868394494f, 0.312591255f},
-std::array<float,2>{0.775393009f, 0.749947727f},
-std::array<float,2>{0.372343481f, 0.238953963f},
-std::array<float,2>{0.0068684225f, 0.983895898f},
-std::array<float,2>{0.635544777f, 0.464072675f},
-std::array<float,2>{0.598307788f, 0.812940061f},
-std::array<float,2>{0.226928726f, 0.279223949f},
-std::array<float,2>{0.473124355f, 0.541773081f},
-std::array<float,2>{0.936044931f, 0.0213224515f},
-std::array<float,2>{0.913234651f, 0.873754144f},
-std::array<float,2>{0.492732525f, 0.29722476f},
-std::array<float,2>{0.234478906f, 0.50217098f},
-std::array<float,2>{0.610657394f, 0.047127746f},
-std::array<float,2>{0.643708467f, 0.708779395f},
-std::array<float,2>{0.0175819304f, 0.192344278f},
-std::array<float,2>{0.354395837f, 0.962803364f},
-std::array<float,2>{0.75245297f, 0.48256588f},
-std::array<float,2>{0.851344168f, 0.585621297f},
-std::array<float,2>{0.27044186f, 0.0893836319f},
-std::array<float,2>{0.0848429725f, 0.798939764f},
-std::array<float,2>{0.736854136f, 0.356323719f},
-std::array<float,2>{0.53710264f, 0.890984058f},
-std::array<float,2>{0.137301371f, 0.430048615f},
-std::array<float,2>{0.393974006f, 0.642063618f},
-std::array<float,2>{0.994208276f, 0.129129305f},
-std::array<float,2>{0.803329408f, 0.988032222f},
-std::array<float,2>{0.327797085f, 0.452457845f},
-std::array<float,2>{0.036612235f, 0.724934638f},
-std::array<float,2>{0.660326302f, 0.22765094f},
-std::array<float,2>{0.566675007f, 0.558403671f},
-std::array<float,2>{0.207729578f, 0.00347357825f},
-std::array<float,2>{0.460768372f, 0.831013739f},
-std::array<float,2>{0.903742075f, 0.257107168f},
-std::array<float,2>{0.966910183f, 0.683102667f},
-std::array<float,2>{0.415224135f, 0.178922459f},
-std::array<float,2>{0.156661451f, 0.924007893f},
-std::array<float,2>{0.501506388f, 0.390483975f},
-std::array<float,2>{0.688955247f, 0.770420611f},
-std::array<float,2>{0.113197014f, 0.338880509f},
-std::array<float,2>{0.301122874f, 0.599760175f},
-std::array<float,2>{0.818473101f, 0.0955067798f},
-std::array<float,2>{0.765055239f, 0.842399359f},
-std::array<float,2>{0.347462624f, 0.258653283f},
-std::array<float,2>{0.0287113674f, 0.551206708f},
-std::array<float,2>{0.650030673f, 0.0154445441f},
-std::array<float,2>{0.61959815f, 0.733507812f},
-std::array<float,2>{0.242853761f, 0.220291406f},
-std::array<float,2>{0.490874946f, 0.999752402f},
-std::array<float,2>{0.91467911f, 0.443421483f},
-std::array<float,2>{0.984529257f, 0.60524416f},
-std::array<float,2>{0.404831767f, 0.107582882f},
-std::array<float,2>{0.132636651f, 0.781052053f},
-std::array<float,2>{0.54290545f, 0.332072318f},
-std::array<float,2>{0.742610097f, 0.937143624f},
-std::array<float,2>{0.0890641585f, 0.382256389f},
-std::array<float,2>{0.277559102f, 0.673391223f},
-std::array<float,2>{0.852831244f, 0.182072103f},
-std::array<float,2>{0.898350894f, 0.960220456f},
-std::array<float,2>{0.465636224f, 0.469595194f},
-std::array<float,2>{0.215936214f, 0.712277949f},
-std::array<float,2>{0.571594179f, 0.197960615f},
-std::array<float,2>{0.666656971f, 0.512256026f},
-std::array<float,2>{0.0448590443f, 0.056063842f},
-std::array<float,2>{0.314012647f, 0.862513006f},
-std::array<float,2>{0.808831513f, 0.31045559f},
-std::array<float,2>{0.82246691f, 0.653151929f},
-std::array<float,2>{0.307743967f, 0.135818228f},
-std::array<float,2>{0.120740287f, 0.904825449f},
-std::array<float,2>{0.702833652f, 0.426604331f},
-std::array<float,2>{0.515270352f, 0.808223188f},
-std::array<float,2>{0.168739617f, 0.347784519f},
-std::array<float,2>{0.4096843f, 0.591415644f},
-std::array<float,2>{0.953446209f, 0.0802573264f},
-std::array<float,2>{0.938781559f, 0.7587322f},
-std::array<float,2>{0.42558971f, 0.325601786f},
-std::array<float,2>{0.184577495f, 0.622265399f},
-std::array<float,2>{0.518360853f, 0.120008655f},
-std::array<float,2>{0.708340764f, 0.666923583f},
-std::array<float,2>{0.095447354f, 0.160877123f},
-std::array<float,2>{0.291770995f, 0.919478536f},
-std::array<float,2>{0.831089556f, 0.394586116f},
-std::array<float,2>{0.794281483f, 0.53417486f},
-std::array<float,2>{0.332225353f, 0.0240039472f},
-std::array<float,2>{0.0556431413f, 0.820559025f},
-std::array<float,2>{0.678156078f, 0.27051267f},
-std::array<float,2>{0.586371183f, 0.974143207f},
-std::array<float,2>{0.191861689f, 0.460259348f},
-std::array<float,2>{0.4446356f, 0.736219406f},
-std::array<float,2>{0.88386333f, 0.248157948f},
-std::array<float,2>{0.864234328f, 0.880594611f},
-std::array<float,2>{0.251493752f, 0.413071752f},
-std::array<float,2>{0.0713436007f, 0.629824102f},
-std::array<float,2>{0.733195841f, 0.146663755f},
-std::array<float,2>{0.548635185f, 0.563284874f},
-std::array<float,2>{0.14902623f, 0.0710315257f},
-std::array<float,2>{0.382943034f, 0.783590198f},
-std::array<float,2>{0.969793141f, 0.36609447f},
-std::array<float,2>{0.92274332f, 0.697865069f},
-std::array<float,2>{0.479843289f, 0.207468197f},
-std::array<float,2>{0.219980612f, 0.945058584f},
-std::array<float,2>{0.601662993f, 0.497546047f},
-std::array<float,2>{0.627963126f, 0.855866551f},
-std::array<float,2>{0.0155703379f, 0.288443953f},
-std::array<float,2>{0.367037326f, 0.523555219f},
-std::array<float,2>{0.772307754f, 0.0455196388f},
-std::array<float,2>{0.825824797f, 0.817463875f},
-std::array<float,2>{0.3106381f, 0.276296169f},
-std::array<float,2>{0.122071236f, 0.545378864f},
-std::array<float,2>{0.699213266f, 0.0186780859f},
-std::array<float,2>{0.511208117f, 0.742717028f},
-std::array<float,2>{0.165191904f, 0.236323714f},
-std::array<float,2>{0.41169095f, 0.980005145f},
-std::array<float,2>{0.957661569f, 0.467224896f},
-std::array<float,2>{0.892017961f, 0.614138126f},
-std::array<float,2>{0.464496583f, 0.110282809f},
-std::array<float,2>{0.213707387f, 0.756786346f},
-std::array<float,2>{0.576560199f, 0.319447815f},
-std::array<float,2>{0.670841813f, 0.910328388f},
-std::array<float,2>{0.0425862744f, 0.40060252f},
-std::array<float,2>{0.317837238f, 0.662412703f},
-std::array<float,2>{0.8075459f, 0.168556377f},
-std::array<float,2>{0.988542199f, 0.946724415f},
-std::array<float,2>{0.402062625f, 0.488714367f},
-std::array<float,2>{0.125010148f, 0.690052569f},
-std::array<float,2>{0.54311043f, 0.214039207f},
-std::array<float,2>{0.746409237f, 0.518728018f},
-std::array<float,2>{0.0898941159f, 0.0363290757f},
-std::array<float,2>{0.275176227f, 0.846954942f},
-std::array<float,2>{0.855691612f, 0.295474917f},
-std::array<float,2>{0.761640668f, 0.6333673f},
-std::array<float,2>{0.347724259f, 0.152739421f},
-std::array<float,2>{0.0263528861f, 0.887036681f},
-std::array<float,2>{0.653175175f, 0.415795207f},
-std::array<float,2>{0.623787045f, 0.790200114f},
-std::array<float,2>{0.249084845f, 0.37032342f},
-std::array<float,2>{0.486216217f, 0.574709475f},
-std::array<float,2>{0.920879841f, 0.0679736435f},
-std::array<float,2>{0.927340746f, 0.768453598f},
-std::array<float,2>{0.48302865f, 0.342947036f},
-std::array<float,2>{0.226206392f, 0.59553957f},
-std::array<float,2>{0.608507514f, 0.101181276f},
-std::array<float,2>{0.629283786f, 0.685946524f},
-std::array<float,2>{0.00862313155f, 0.173939317f},
-std::array<float,2>{0.361235738f, 0.928963482f},
-std::array<float,2>{0.766471684f, 0.38396284f},
-std::array<float,2>{0.862451553f, 0.559052348f},
-std::array<float,2>{0.257548511f, 0.00403694529f},
-std::array<float,2>{0.0752094835f, 0.835013807f},
-std::array<float,2>{0.730315268f, 0.253399432f},
-std::array<float,2>{0.55222249f, 0.991958141f},
-std::array<float,2>{0.152804613f, 0.447457284f},
-std::array<float,2>{0.386867762f, 0.721468806f},
-std::array<float,2>{0.974225342f, 0.233507395f},
-std::array<float,2>{0.790008366f, 0.89483875f},
-std::array<float,2>{0.329333425f, 0.43635273f},
-std::array<float,2>{0.0600245334f, 0.646973968f},
-std::array<float,2>{0.672299981f, 0.126911163f},
-std::array<float,2>{0.592591524f, 0.581978619f},
-std::array<float,2>{0.188405305f, 0.0913018882f},
-std::array<float,2>{0.440564126f, 0.801324189f},
-std::array<float,2>{0.889934421f, 0.354242861f},
-std::array<float,2>{0.944116116f, 0.705641389f},
-std::array<float,2>{0.426914543f, 0.187817961f},
-std::array<float,2>{0.182235926f, 0.968175828f},
-std::array<float,2>{0.520441115f, 0.478892595f},
-std::array<float,2>{0.704188108f, 0.867720902f},
-std::array<float,2>{0.0982918665f, 0.303866565f},
-std::array<float,2>{0.296065003f, 0.506343365f},
-std::array<float,2>{0.834366798f, 0.0539089665f},
-std::array<float,2>{0.778692901f, 0.808720648f},
-std::array<float,2>{0.369177729f, 0.346142262f},
-std::array<float,2>{0.00157813029f, 0.588628054f},
-std::array<float,2>{0.636914849f, 0.0822923705f},
-std::array<float,2>{0.594750941f, 0.650181353f},
-std::array<float,2>{0.231773064f, 0.13732864f},
-std::array<float,2>{0.470674247f, 0.899638832f},
-std::array<float,2>{0.932304919f, 0.423443288f},
-std::array<float,2>{0.984159291f, 0.510213733f},
-std::array<float,2>{0.378950477f, 0.0593044572f},
-std::array<float,2>{0.143082231f, 0.865463078f},
-std::array<float,2>{0.556588769f, 0.306867272f},
-std::array<float,2>{0.720780373f, 0.954032719f},
-std::array<float,2>{0.0696513057f, 0.474128217f},
-std::array<float,2>{0.26316449f, 0.715375423f},
-std::array<float,2>{0.873508096f, 0.20189549f},
-std::array<float,2>{0.877199292f, 0.930749536f},
-std::array<float,2>{0.45102486f, 0.376477718f},
-std::array<float,2>{0.201696455f, 0.678346038f},
-std::array<float,2>{0.58176899f, 0.184097603f},
-std::array<float,2>{0.687361479f, 0.609338641f},
-std::array<float,2>{0.0485262536f, 0.10374666f},
-std::array<float,2>{0.342075169f, 0.77622968f},
-std::array<float,2>{0.786302745f, 0.328704268f},
-std::array<float,2>{0.836332679f, 0.729519486f},
-std::array<float,2>{0.283155084f, 0.224306807f},
-std::array<float,2>{0.104144424f, 0.992560267f},
-std::array<float,2>{0.717997611f, 0.440095544f},
-std::array<float,2>{0.52895999f, 0.836318493f},
-std::array<float,2>{0.176379517f, 0.265431583f},
-std::array<float,2>{0.432464361f, 0.548943162f},
-std::array<float,2>{0.946811616f, 0.0103271976f},
-std::array<float,2>{0.963671148f, 0.853268921f},
-std::array<float,2>{0.418727249f, 0.284595102f},
-std::array<float,2>{0.162186518f, 0.529735565f},
-std::array<float,2>{0.504196703f, 0.0421800427f},
-std::array<float,2>{0.693612099f, 0.69929719f},
-std::array<float,2>{0.113585718f, 0.205567166f},
-std::array<float,2>{0.299692512f, 0.940951049f},
-std::array<float,2>{0.813161254f, 0.492220074f},
-std::array<float,2>{0.79906559f, 0.568470001f},
-std::array<float,2>{0.321593314f, 0.0767722502f},
-std::array<float,2>{0.0321539417f, 0.785190046f},
-std::array<float,2>{0.657813072f, 0.362103879f},
-std::array<float,2>{0.563673139f, 0.8751508f},
-std::array<float,2>{0.205954745f, 0.406370759f},
-std::array<float,2>{0.453365177f, 0.627114296f},
-std::array<float,2>{0.900086403f, 0.141657263f},
-std::array<float,2>{0.844774961f, 0.971890688f},
-std::array<float,2>{0.266132861f, 0.454584777f},
-std::array<float,2>{0.0791919976f, 0.740007818f},
-std::array<float,2>{0.74049896f, 0.245648995f},
-std::array<float,2>{0.532151163f, 0.53556478f},
-std::array<float,2>{0.133488402f, 0.028565539f},
-std::array<float,2>{0.397548079f, 0.828026235f},
-std::array<float,2>{0.999979615f, 0.265904844f},
-std::array<float,2>{0.90978384f, 0.669115722f},
-std::array<float,2>{0.49903518f, 0.158767343f},
-std::array<float,2>{0.240883365f, 0.915464103f},
-std::array<float,2>{0.614381135f, 0.392192394f},
-std::array<float,2>{0.646942139f, 0.763489187f},
-std::array<float,2>{0.0220013019f, 0.320334882f},
-std::array<float,2>{0.357375443f, 0.618853033f},
-std::array<float,2>{0.755806029f, 0.123792648f},
-std::array<float,2>{0.87065208f, 0.753176272f},
-std::array<float,2>{0.260581136f, 0.315409184f},
-std::array<float,2>{0.063818492f, 0.610475004f},
-std::array<float,2>{0.72500509f, 0.116458885f},
-std::array<float,2>{0.561378956f, 0.659858465f},
-std::array<float,2>{0.148180947f, 0.167506561f},
-std::array<float,2>{0.377296239f, 0.909888625f},
-std::array<float,2>{0.977386594f, 0.405001581f},
-std::array<float,2>{0.935337365f, 0.539512634f},
-std::array<float,2>{0.474648327f, 0.0223315656f},
-std::array<float,2>{0.22936441f, 0.814567626f},
-std::array<float,2>{0.600905538f, 0.279414564f},
-std::array<float,2>{0.63414228f, 0.980903149f},
-std::array<float,2>{0.00483462494f, 0.462528676f},
-std::array<float,2>{0.373087972f, 0.747281849f},
-std::array<float,2>{0.774386466f, 0.240389541f},
-std::array<float,2>{0.950457215f, 0.884451568f},
-std::array<float,2>{0.435887039f, 0.420005798f},
-std::array<float,2>{0.173536986f, 0.637326777f},
-std::array<float,2>{0.526527882f, 0.150594339f},
-std::array<float,2>{0.713212311f, 0.573103309f},
-std::array<float,2>{0.109353043f, 0.0635860935f},
-std::array<float,2>{0.286940724f, 0.793951213f},
-std::array<float,2>{0.840930998f, 0.372948736f},
-std::array<float,2>{0.783594429f, 0.69431144f},
-std::array<float,2>{0.338066727f, 0.216559142f},
-std::array<float,2>{0.052341789f, 0.952161849f},
-std::array<float,2>{0.682668746f, 0.486661255f},
-std::array<float,2>{0.584242225f, 0.850869656f},
-std::array<float,2>{0.196395844f, 0.290038347f},
-std::array<float,2>{0.445971817f, 0.521793544f},
-std::array<float,2>{0.881389976f, 0.0329213664f},
-std::array<float,2>{0.905337632f, 0.829198003f},
-std::array<float,2>{0.457629174f, 0.255609483f},
-std::array<float,2>{0.209452197f, 0.555270731f},
-std::array<float,2>{0.570278764f, 0.000128350686f},
-std::array<float,2>{0.662586629f, 0.724197805f},
-std::array<float,2>{0.037192516f, 0.229135275f},
-std::array<float,2>{0.325580031f, 0.985615194f},
-std::array<float,2>{0.801364005f, 0.449524313f},
-std::array<float,2>{0.816669345f, 0.59816891f},
-std::array<float,2>{0.303056687f, 0.0973856151f},
-std::array<float,2>{0.109994456f, 0.771782815f},
-std::array<float,2>{0.690629125f, 0.336588055f},
-std::array<float,2>{0.503017068f, 0.923265278f},
-std::array<float,2>{0.160057291f, 0.388277978f},
-std::array<float,2>{0.416157275f, 0.681048453f},
-std::array<float,2>{0.964947879f, 0.176114336f},
-std::array<float,2>{0.750409484f, 0.964456022f},
-std::array<float,2>{0.353185207f, 0.482210577f},
-std::array<float,2>{0.0161910225f, 0.709446847f},
-std::array<float,2>{0.641450405f, 0.194643974f},
-std::array<float,2>{0.613160849f, 0.501613975f},
-std::array<float,2>{0.237636983f, 0.0495818928f},
-std::array<float,2>{0.494336903f, 0.872955501f},
-std::array<float,2>{0.911447704f, 0.299781233f},
-std::array<float,2>{0.992635548f, 0.644472182f},
-std::array<float,2>{0.392548591f, 0.132298157f},
-std::array<float,2>{0.139257699f, 0.893852711f},
-std::array<float,2>{0.538389623f, 0.432758868f},
-std::array<float,2>{0.735107541f, 0.797109663f},
-std::array<float,2>{0.0835540891f, 0.358834028f},
-std::array<float,2>{0.271578342f, 0.582874179f},
-std::array<float,2>{0.849182069f, 0.0876606107f},
-std::array<float,2>{0.811265528f, 0.860035539f},
-std::array<float,2>{0.315331548f, 0.311650693f},
-std::array<float,2>{0.0457755476f, 0.513693392f},
-std::array<float,2>{0.664151967f, 0.0570960753f},
-std::array<float,2>{0.572516084f, 0.713069201f},
-std::array<float,2>{0.218672231f, 0.195975035f},
-std::array<float,2>{0.467202127f, 0.958292544f},
-std::array<float,2>{0.895040751f, 0.471004158f},
-std::array<float,2>{0.956642628f, 0.592029631f},
-std::array<float,2>{0.406502724f, 0.0784623101f},
-std::array<float,2>{0.170795262f, 0.80599606f},
-std::array<float,2>{0.513472795f, 0.350524217f},
-std::array<float,2>{0.700480938f, 0.90356189f},
-std::array<float,2>{0.117411748f, 0.429035336f},
-std::array<float,2>{0.306102872f, 0.655269086f},
-std::array<float,2>{0.821541846f, 0.13333112f},
-std::array<float,2>{0.916373432f, 0.997412622f},
-std::array<float,2>{0.488970876f, 0.442970961f},
-std::array<float,2>{0.244998112f, 0.730689764f},
-std::array<float,2>{0.619126141f, 0.220792651f},
-std::array<float,2>{0.651001811f, 0.554204047f},
-std::array<float,2>{0.0300655141f, 0.0124859363f},
-std::array<float,2>{0.345300943f, 0.841621459f},
-std::array<float,2>{0.762745798f, 0.260265648f},
-std::array<float,2>{0.854279399f, 0.674037933f},
-std::array<float,2>{0.279723406f, 0.181544185f},
-std::array<float,2>{0.0878513604f, 0.933760107f},
-std::array<float,2>{0.744270861f, 0.380147636f},
-std::array<float,2>{0.539437473f, 0.778163612f},
-std::array<float,2>{0.129971161f, 0.334664643f},
-std::array<float,2>{0.403638929f, 0.601943254f},
-std::array<float,2>{0.987851024f, 0.107027218f},
-std::array<float,2>{0.971738219f, 0.782790482f},
-std::array<float,2>{0.386313677f, 0.364648104f},
-std::array<float,2>{0.151488572f, 0.566215932f},
-std::array<float,2>{0.55057621f, 0.0738306567f},
-std::array<float,2>{0.732389212f, 0.632064879f},
-std::array<float,2>{0.0732616559f, 0.144575715f},
-std::array<float,2>{0.253830254f, 0.881027758f},
-std::array<float,2>{0.866693616f, 0.412031889f},
-std::array<float,2>{0.771384537f, 0.52638495f},
-std::array<float,2>{0.364333034f, 0.0441577099f},
-std::array<float,2>{0.012859676f, 0.859063089f},
-std::array<float,2>{0.626622677f, 0.285818219f},
-std::array<float,2>{0.605258465f, 0.941509902f},
-std::array<float,2>{0.222090885f, 0.499008566f},
-std::array<float,2>{0.476705015f, 0.695906281f},
-std::array<float,2>{0.924082279f, 0.209637269f},
-std::array<float,2>{0.829295695f, 0.921872497f},
-std::array<float,2>{0.289735824f, 0.397027522f},
-std::array<float,2>{0.0967986956f, 0.664525211f},
-std::array<float,2>{0.710898161f, 0.162676618f},
-std::array<float,2>{0.516984284f, 0.623449206f},
-std::array<float,2>{0.187490419f, 0.118432984f},
-std::array<float,2>{0.42307359f, 0.761298239f},
-std::array<float,2>{0.940487385f, 0.327266008f},
-std::array<float,2>{0.885954857f, 0.736805499f},
-std::array<float,2>{0.442844838f, 0.24687539f},
-std::array<float,2>{0.194473445f, 0.975585163f},
-std::array<float,2>{0.589614987f, 0.457424253f},
-std::array<float,2>{0.67750299f, 0.824004054f},
-std::array<float,2>{0.0577293448f, 0.272061706f},
-std::array<float,2>{0.334396988f, 0.531923652f},
-std::array<float,2>{0.795475721f, 0.0267065596f},
-std::array<float,2>{0.867791295f, 0.81472671f},
-std::array<float,2>{0.257987648f, 0.279764354f},
-std::array<float,2>{0.0645407513f, 0.539210975f},
-std::array<float,2>{0.722724259f, 0.0219755322f},
-std::array<float,2>{0.559901774f, 0.747377396f},
-std::array<float,2>{0.14516224f, 0.240595341f},
-std::array<float,2>{0.375100404f, 0.9806903f},
-std::array<float,2>{0.978704989f, 0.462684691f},
-std::array<float,2>{0.937376261f, 0.610791445f},
-std::array<float,2>{0.47383514f, 0.116248399f},
-std::array<float,2>{0.227911562f, 0.753020763f},
-std::array<float,2>{0.599025428f, 0.314970255f},
-std::array<float,2>{0.635947287f, 0.910083652f},
-std::array<float,2>{0.00633705268f, 0.405073285f},
-std::array<float,2>{0.371246636f, 0.660113096f},
-std::array<float,2>{0.777038157f, 0.167886138f},
-std::array<float,2>{0.952107012f, 0.952547789f},
-std::array<float,2>{0.434816301f, 0.4863787f},
-std::array<float,2>{0.174714655f, 0.693860888f},
-std::array<float,2>{0.524165273f, 0.216537356f},
-std::array<float,2>{0.711176574f, 0.521725476f},
-std::array<float,2>{0.105805054f, 0.0331927016f},
-std::array<float,2>{0.287368506f, 0.850781262f},
-std::array<float,2>{0.842452228f, 0.289656132f},
-std::array<float,2>{0.782877088f, 0.637593567f},
-std::array<float,2>{0.33671838f, 0.150840372f},
-std::array<float,2>{0.0531374104f, 0.884527504f},
-std::array<float,2>{0.680925906f, 0.420197159f},
-std::array<float,2>{0.583186805f, 0.794423878f},
-std::array<float,2>{0.198409423f, 0.372599751f},
-std::array<float,2>{0.447988123f, 0.572784483f},
-std::array<float,2>{0.879302621f, 0.0638866499f},
-std::array<float,2>{0.902540326f, 0.771542966f},
-std::array<float,2>{0.459020734f, 0.336738199f},
-std::array<float,2>{0.208322942f, 0.598528504f},
-std::array<float,2>{0.568023145f, 0.0975175425f},
-std::array<float,2>{0.661918461f, 0.680844724f},
-std::array<float,2>{0.0353245698f, 0.176008061f},
-std::array<float,2>{0.326426387f, 0.923004389f},
-std::array<float,2>{0.804026484f, 0.388476133f},
-std::array<float,2>{0.820045233f, 0.555584013f},
-std::array<float,2>{0.302421868f, 0.00042824613f},
-std::array<float,2>{0.111394122f, 0.829420447f},
-std::array<float,2>{0.688052058f, 0.255775064f},
-std::array<float,2>{0.500834525f, 0.985551596f},
-std::array<float,2>{0.157324657f, 0.44931525f},
-std::array<float,2>{0.414188772f, 0.724580169f},
-std::array<float,2>{0.968144596f, 0.229341537f},
-std::array<float,2>{0.753829479f, 0.893717766f},
-std::array<float,2>{0.354842275f, 0.433012515f},
-std::array<float,2>{0.019180445f, 0.644138038f},
-std::array<float,2>{0.643044889f, 0.131906018f},
-std::array<float,2>{0.610047817f, 0.582723916f},
-std::array<float,2>{0.236001715f, 0.087638706f},
-std::array<float,2>{0.493240178f, 0.797140896f},
-std::array<float,2>{0.912676156f, 0.358415604f},
-std::array<float,2>{0.996089637f, 0.709124804f},
-std::array<float,2>{0.392633796f, 0.194474235f},
-std::array<float,2>{0.138277486f, 0.964729488f},
-std::array<float,2>{0.535612941f, 0.482103497f},
-std::array<float,2>{0.737754822f, 0.872757316f},
-std::array<float,2>{0.0853518471f, 0.299323648f},
-std::array<float,2>{0.270626485f, 0.501822531f},
-std::array<float,2>{0.850273669f, 0.0493394285f},
-std::array<float,2>{0.80957365f, 0.805762887f},
-std::array<float,2>{0.313399315f, 0.350152642f},
-std::array<float,2>{0.0437553637f, 0.592196941f},
-std::array<float,2>{0.667684674f, 0.078255482f},
-std::array<float,2>{0.571069062f, 0.654875755f},
-std::array<float,2>{0.214913532f, 0.133565605f},
-std::array<float,2>{0.466646492f, 0.903674245f},
-std::array<float,2>{0.896925032f, 0.428736567f},
-std::array<float,2>{0.954825878f, 0.51403302f},
-std::array<float,2>{0.408895791f, 0.0567473583f},
-std::array<float,2>{0.16940099f, 0.860330045f},
-std::array<float,2>{0.514274061f, 0.311893523f},
-std::array<float,2>{0.701353133f, 0.958040237f},
-std::array<float,2>{0.119319186f, 0.47087118f},
-std::array<float,2>{0.307259828f, 0.7133196f},
-std::array<float,2>{0.823876798f, 0.196154386f},
-std::array<float,2>{0.915703177f, 0.933901489f},
-std::array<float,2>{0.491672426f, 0.379904926f},
-std::array<float,2>{0.243654877f, 0.674273372f},
-std::array<float,2>{0.620144665f, 0.181275845f},
-std::array<float,2>{0.649110317f, 0.60157609f},
-std::array<float,2>{0.0281553213f, 0.107419789f},
-std::array<float,2>{0.345939338f, 0.777966738f},
-std::array<float,2>{0.764307916f, 0.334742367f},
-std::array<float,2>{0.851598978f, 0.730879188f},
-std::array<float,2>{0.278345644f, 0.221111536f},
-std::array<float,2>{0.0886363387f, 0.997085869f},
-std::array<float,2>{0.743379235f, 0.443299502f},
-std::array<float,2>{0.54132545f, 0.841535568f},
-std::array<float,2>{0.131555766f, 0.26050964f},
-std::array<float,2>{0.406051785f, 0.554598987f},
-std::array<float,2>{0.985720813f, 0.0123759815f},
-std::array<float,2>{0.969541013f, 0.859178007f},
-std::array<float,2>{0.384208649f, 0.28604418f},
-std::array<float,2>{0.150088757f, 0.526726007f},
-std::array<float,2>{0.547807574f, 0.0442161933f},
-std::array<float,2>{0.733642817f, 0.696277678f},
-std::array<float,2>{0.0705790967f, 0.209872216f},
-std::array<float,2>{0.250328004f, 0.941749752f},
-std::array<float,2>{0.864531755f, 0.498644918f},
-std::array<float,2>{0.773020685f, 0.566025198f},
-std::array<float,2>{0.366018921f, 0.074022606f},
-std::array<float,2>{0.0142766815f, 0.783080161f},
-std::array<float,2>{0.627644718f, 0.364467233f},
-std::array<float,2>{0.602588236f, 0.88110739f},
-std::array<float,2>{0.21909532f, 0.411743313f},
-std::array<float,2>{0.47881636f, 0.632184029f},
-std::array<float,2>{0.923565865f, 0.144876063f},
-std::array<float,2>{0.830732763f, 0.975189149f},
-std::array<float,2>{0.292922378f, 0.457059592f},
-std::array<float,2>{0.0946630836f, 0.736405551f},
-std::array<float,2>{0.707087338f, 0.246808246f},
-std::array<float,2>{0.51933831f, 0.532117367f},
-std::array<float,2>{0.184152082f, 0.0264021941f},
-std::array<float,2>{0.42479983f, 0.823899269f},
-std::array<float,2>{0.937593818f, 0.272391379f},
-std::array<float,2>{0.883304715f, 0.664212525f},
-std::array<float,2>{0.44377467f, 0.163042441f},
-std::array<float,2>{0.193097264f, 0.921417892f},
-std::array<float,2>{0.58772403f, 0.397460669f},
-std::array<float,2>{0.678751051f, 0.761540413f},
-std::array<float,2>{0.0563821197f, 0.32748419f},
-std::array<float,2>{0.333510041f, 0.623220623f},
-std::array<float,2>{0.793870509f, 0.118366219f},
-std::array<float,2>{0.827101409f, 0.7565341f},
-std::array<float,2>{0.310237497f, 0.319803923f},
-std::array<float,2>{0.124634542f, 0.61384052f},
-std::array<float,2>{0.695369661f, 0.110096499f},
-std::array<float,2>{0.508912444f, 0.662316918f},
-std::array<float,2>{0.167443588f, 0.168929741f},
-std::array<float,2>{0.412565857f, 0.910560966f},
-std::array<float,2>{0.960919023f, 0.400657654f},
-std::array<float,2>{0.893662632f, 0.544957697f},
-std::array<float,2>{0.461875618f, 0.0189669225f},
-std::array<float,2>{0.211435601f, 0.81780678f},
-std::array<float,2>{0.574755788f, 0.2758874f},
-std::array<float,2>{0.669532776f, 0.980270982f},
-std::array<float,2>{0.0403003879f, 0.466968864f},
-std::array<float,2>{0.318958908f, 0.743052125f},
-std::array<float,2>{0.805384219f, 0.235891148f},
-std::array<float,2>{0.990373492f, 0.886802673f},
-std::array<float,2>{0.398792505f, 0.415737569f},
-std::array<float,2>{0.127692699f, 0.633757055f},
-std::array<float,2>{0.545471728f, 0.152384773f},
-std::array<float,2>{0.748402536f, 0.575006604f},
-std::array<float,2>{0.0931332633f, 0.0682360232f},
-std::array<float,2>{0.275447547f, 0.790412664f},
-std::array<float,2>{0.858749151f, 0.370383173f},
-std::array<float,2>{0.758298457f, 0.690253854f},
-std::array<float,2>{0.350776255f, 0.214113802f},
-std::array<float,2>{0.0238160696f, 0.946328759f},
-std::array<float,2>{0.655755043f, 0.488502681f},
-std::array<float,2>{0.621177495f, 0.84668076f},
-std::array<float,2>{0.246260419f, 0.295811415f},
-std::array<float,2>{0.487819731f, 0.519036531f},
-std::array<float,2>{0.919042289f, 0.0364311896f},
-std::array<float,2>{0.929125369f, 0.83533591f},
-std::array<float,2>{0.480656147f, 0.253148675f},
-std::array<float,2>{0.224098265f, 0.558709264f},
-std::array<float,2>{0.606825292f, 0.00437330641f},
-std::array<float,2>{0.63210243f, 0.721288621f},
-std::array<float,2>{0.010083301f, 0.233697742f},
-std::array<float,2>{0.362829357f, 0.991835058f},
-std::array<float,2>{0.768565178f, 0.447597235f},
-std::array<float,2>{0.861180127f, 0.595235229f},
-std::array<float,2>{0.254132748f, 0.101540536f},
-std::array<float,2>{0.0768805593f, 0.7682302f},
-std::array<float,2>{0.726702213f, 0.343117386f},
-std::array<float,2>{0.552846432f, 0.928942442f},
-std::array<float,2>{0.155250534f, 0.384261042f},
-std::array<float,2>{0.389975429f, 0.685579956f},
-std::array<float,2>{0.974690735f, 0.174118087f},
-std::array<float,2>{0.79151243f, 0.967901468f},
-std::array<float,2>{0.331560671f, 0.478613496f},
-std::array<float,2>{0.0617391132f, 0.705953896f},
-std::array<float,2>{0.675206482f, 0.187729552f},
-std::array<float,2>{0.590601742f, 0.506083012f},
-std::array<float,2>{0.189864054f, 0.0539829396f},
-std::array<float,2>{0.439324915f, 0.86813134f},
-std::array<float,2>{0.887991846f, 0.30397293f},
-std::array<float,2>{0.942523301f, 0.647440314f},
-std::array<float,2>{0.428586751f, 0.126504585f},
-std::array<float,2>{0.179822654f, 0.894739807f},
-std::array<float,2>{0.522882044f, 0.436242521f},
-std::array<float,2>{0.705626428f, 0.801550448f},
-std::array<float,2>{0.101400428f, 0.354369998f},
-std::array<float,2>{0.293749511f, 0.581565261f},
-std::array<float,2>{0.833221436f, 0.09102723f},
-std::array<float,2>{0.779883981f, 0.865505934f},
-std::array<float,2>{0.367323428f, 0.307014942f},
-std::array<float,2>{0.00250303652f, 0.50990802f},
-std::array<float,2>{0.639501393f, 0.0594380014f},
-std::array<float,2>{0.596661985f, 0.715764403f},
-std::array<float,2>{0.233203635f, 0.202141777f},
-std::array<float,2>{0.471206725f, 0.953697085f},
-std::array<float,2>{0.931548834f, 0.474366993f},
-std::array<float,2>{0.981820762f, 0.588550985f},
-std::array<float,2>{0.382173955f, 0.0822203904f},
-std::array<float,2>{0.142232522f, 0.808906078f},
-std::array<float,2>{0.558524311f, 0.345928788f},
-std::array<float,2>{0.71917057f, 0.899868309f},
-std::array<float,2>{0.067051895f, 0.423656493f},
-std::array<float,2>{0.264615089f, 0.650047421f},
-std::array<float,2>{0.872755289f, 0.137628615f},
-std::array<float,2>{0.876124382f, 0.992298007f},
-std::array<float,2>{0.451544493f, 0.44034332f},
-std::array<float,2>{0.199286908f, 0.729826868f},
-std::array<float,2>{0.580001533f, 0.224400327f},
-std::array<float,2>{0.683626473f, 0.549134791f},
-std::array<float,2>{0.0494767055f, 0.0106744617f},
-std::array<float,2>{0.340546876f, 0.836097062f},
-std::array<float,2>{0.788208187f, 0.265321106f},
-std::array<float,2>{0.838208497f, 0.678529024f},
-std::array<float,2>{0.28420341f, 0.184373736f},
-std::array<float,2>{0.10239701f, 0.930967331f},
-std::array<float,2>{0.716640949f, 0.37674123f},
-std::array<float,2>{0.531184435f, 0.775946796f},
-std::array<float,2>{0.178915292f, 0.328908116f},
-std::array<float,2>{0.429853946f, 0.608918667f},
-std::array<float,2>{0.94793433f, 0.103846617f},
-std::array<float,2>{0.962431431f, 0.785591781f},
-std::array<float,2>{0.421168417f, 0.361822337f},
-std::array<float,2>{0.162064686f, 0.568679571f},
-std::array<float,2>{0.507645845f, 0.07691475f},
-std::array<float,2>{0.692504764f, 0.627321601f},
-std::array<float,2>{0.115415283f, 0.141947851f},
-std::array<float,2>{0.297487408f, 0.875449002f},
-std::array<float,2>{0.81500864f, 0.406496465f},
-std::array<float,2>{0.798003256f, 0.529380739f},
-std::array<float,2>{0.322457194f, 0.0423926897f},
-std::array<float,2>{0.0346999355f, 0.853500485f},
-std::array<float,2>{0.658768713f, 0.284288377f},
-std::array<float,2>{0.565660298f, 0.941274345f},
-std::array<float,2>{0.203532323f, 0.492478162f},
-std::array<float,2>{0.45634979f, 0.699516356f},
-std::array<float,2>{0.901789308f, 0.205828056f},
-std::array<float,2>{0.847125649f, 0.915073693f},
-std::array<float,2>{0.26853022f, 0.3923814f},
-std::array<float,2>{0.0813048854f, 0.669260502f},
-std::array<float,2>{0.738402247f, 0.159063593f},
-std::array<float,2>{0.534981668f, 0.618920207f},
-std::array<float,2>{0.13581185f, 0.123745255f},
-std::array<float,2>{0.396156281f, 0.763318777f},
-std::array<float,2>{0.996288061f, 0.320649534f},
-std::array<float,2>{0.90648222f, 0.73984462f},
-std::array<float,2>{0.497869492f, 0.245892435f},
-std::array<float,2>{0.239842311f, 0.971970916f},
-std::array<float,2>{0.616041899f, 0.454259396f},
-std::array<float,2>{0.645231128f, 0.827680945f},
-std::array<float,2>{0.0212471783f, 0.265855581f},
-std::array<float,2>{0.358065337f, 0.535323024f},
-std::array<float,2>{0.757578909f, 0.0284008887f},
-std::array<float,2>{0.840097547f, 0.849218845f},
-std::array<float,2>{0.285662353f, 0.291880012f},
-std::array<float,2>{0.10800457f, 0.520863652f},
-std::array<float,2>{0.714396834f, 0.0348454118f},
-std::array<float,2>{0.525913239f, 0.692689359f},
-std::array<float,2>{0.172375754f, 0.217321113f},
-std::array<float,2>{0.437219322f, 0.950128615f},
-std::array<float,2>{0.949687362f, 0.484780222f},
-std::array<float,2>{0.882355452f, 0.571230888f},
-std::array<float,2>{0.44636777f, 0.066093497f},
-std::array<float,2>{0.195764959f, 0.795041561f},
-std::array<float,2>{0.585491419f, 0.374012589f},
-std::array<float,2>{0.682483315f, 0.886311889f},
-std::array<float,2>{0.0512364618f, 0.419574648f},
-std::array<float,2>{0.339043349f, 0.63998431f},
-std::array<float,2>{0.784788191f, 0.149540648f},
-std::array<float,2>{0.978107989f, 0.984195292f},
-std::array<float,2>{0.378339291f, 0.464183658f},
-std::array<float,2>{0.147152156f, 0.749699235f},
-std::array<float,2>{0.562184811f, 0.239170074f},
-std::array<float,2>{0.726012588f, 0.541538656f},
-std::array<float,2>{0.0629499778f, 0.0211805329f},
-std::array<float,2>{0.260934114f, 0.812673926f},
-std::array<float,2>{0.869263709f, 0.278838068f},
-std::array<float,2>{0.775111735f, 0.657604277f},
-std::array<float,2>{0.374064296f, 0.165069252f},
-std::array<float,2>{0.00560373161f, 0.906922698f},
-std::array<float,2>{0.633295476f, 0.403633475f},
-std::array<float,2>{0.600515842f, 0.750303745f},
-std::array<float,2>{0.230288401f, 0.312928379f},
-std::array<float,2>{0.47655648f, 0.611911952f},
-std::array<float,2>{0.934018791f, 0.114688322f},
-std::array<float,2>{0.91108793f, 0.799170673f},
-std::array<float,2>{0.495839596f, 0.355975181f},
-std::array<float,2>{0.237176701f, 0.58591485f},
-std::array<float,2>{0.611361504f, 0.089779675f},
-std::array<float,2>{0.642083347f, 0.641826332f},
-std::array<float,2>{0.0169988666f, 0.129327506f},
-std::array<float,2>{0.352073759f, 0.890645266f},
-std::array<float,2>{0.751054823f, 0.429909587f},
-std::array<float,2>{0.848000586f, 0.502441287f},
-std::array<float,2>{0.272833914f, 0.0470976047f},
-std::array<float,2>{0.0825055316f, 0.873962045f},
-std::array<float,2>{0.736100495f, 0.296903908f},
-std::array<float,2>{0.537489295f, 0.962425113f},
-std::array<float,2>{0.139712363f, 0.48288399f},
-std::array<float,2>{0.391250402f, 0.708658397f},
-std::array<float,2>{0.993600368f, 0.192117542f},
-std::array<float,2>{0.801952541f, 0.92425102f},
-std::array<float,2>{0.324941427f, 0.390197098f},
-std::array<float,2>{0.0382699929f, 0.682800591f},
-std::array<float,2>{0.663145423f, 0.179011136f},
-std::array<float,2>{0.568838239f, 0.600006104f},
-std::array<float,2>{0.210635409f, 0.0952919424f},
-std::array<float,2>{0.458244652f, 0.770219505f},
-std::array<float,2>{0.90496248f, 0.339242548f},
-std::array<float,2>{0.966313064f, 0.72484237f},
-std::array<float,2>{0.417841136f, 0.227992088f},
-std::array<float,2>{0.158443332f, 0.988223433f},
-std::array<float,2>{0.50272876f, 0.452180028f},
-std::array<float,2>{0.690009654f, 0.830802202f},
-std::array<float,2>{0.110666841f, 0.257046044f},
-std::array<float,2>{0.304146767f, 0.558142245f},
-std::array<float,2>{0.818055212f, 0.003762112f},
-std::array<float,2>{0.76226306f, 0.780856013f},
-std::array<float,2>{0.344222546f, 0.332409322f},
-std::array<float,2>{0.0306558106f, 0.605038226f},
-std::array<float,2>{0.65195924f, 0.107872173f},
-std::array<float,2>{0.617721081f, 0.673812985f},
-std::array<float,2>{0.245765224f, 0.181709513f},
-std::array<float,2>{0.489949226f, 0.937404454f},
-std::array<float,2>{0.917778611f, 0.381951749f},
-std::array<float,2>{0.987296522f, 0.550884426f},
-std::array<float,2>{0.402696133f, 0.0152404299f},
-std::array<float,2>{0.129501894f, 0.842650831f},
-std::array<float,2>{0.540467024f, 0.258467793f},
-std::array<float,2>{0.745487928f, 0.999940991f},
-std::array<float,2>{0.0859737843f, 0.443687618f},
-std::array<float,2>{0.280645072f, 0.733679831f},
-std::array<float,2>{0.854777992f, 0.22060217f},
-std::array<float,2>{0.89592123f, 0.905091226f},
-std::array<float,2>{0.468047023f, 0.426403463f},
-std::array<float,2>{0.217138931f, 0.652863741f},
-std::array<float,2>{0.573836088f, 0.136017248f},
-std::array<float,2>{0.665130258f, 0.591772735f},
-std::array<float,2>{0.0464140996f, 0.0804580003f},
-std::array<float,2>{0.315791726f, 0.808407724f},
-std::array<float,2>{0.811743438f, 0.348080099f},
-std::array<float,2>{0.820330501f, 0.711946487f},
-std::array<float,2>{0.305530578f, 0.198088959f},
-std::array<float,2>{0.119001433f, 0.95999074f},
-std::array<float,2>{0.700022757f, 0.469461024f},
-std::array<float,2>{0.512469172f, 0.862638474f},
-std::array<float,2>{0.171237916f, 0.310170561f},
-std::array<float,2>{0.407935023f, 0.512687564f},
-std::array<float,2>{0.955178618f, 0.0557138957f},
-std::array<float,2>{0.939708292f, 0.820514917f},
-std::array<float,2>{0.422213048f, 0.270803034f},
-std::array<float,2>{0.185747311f, 0.533728004f},
-std::array<float,2>{0.516234279f, 0.0242320541f},
-std::array<float,2>{0.709725499f, 0.736050785f},
-std::array<float,2>{0.0965473056f, 0.248418644f},
-std::array<float,2>{0.290456176f, 0.974397182f},
-std::array<float,2>{0.828660905f, 0.4601354f},
-std::array<float,2>{0.796598375f, 0.62249893f},
-std::array<float,2>{0.335291594f, 0.119865201f},
-std::array<float,2>{0.0571849905f, 0.758392632f},
-std::array<float,2>{0.675892889f, 0.325369865f},
-std::array<float,2>{0.5885728f, 0.919865072f},
-std::array<float,2>{0.193954021f, 0.394870043f},
-std::array<float,2>{0.44155094f, 0.666635454f},
-std::array<float,2>{0.885347188f, 0.161017329f},
-std::array<float,2>{0.865288615f, 0.945277512f},
-std::array<float,2>{0.252108037f, 0.497119427f},
-std::array<float,2>{0.073172003f, 0.698168874f},
-std::array<float,2>{0.731170356f, 0.20708622f},
-std::array<float,2>{0.549392343f, 0.523737133f},
-std::array<float,2>{0.15119876f, 0.0457802564f},
-std::array<float,2>{0.385324389f, 0.855701447f},
-std::array<float,2>{0.970840812f, 0.288179666f},
-std::array<float,2>{0.925344169f, 0.629535556f},
-std::array<float,2>{0.478119999f, 0.146787301f},
-std::array<float,2>{0.220938489f, 0.880745351f},
-std::array<float,2>{0.603770971f, 0.41278851f},
-std::array<float,2>{0.625940979f, 0.783408403f},
-std::array<float,2>{0.012061351f, 0.365744561f},
-std::array<float,2>{0.363397181f, 0.56316185f},
-std::array<float,2>{0.770002484f, 0.0712305233f},
-std::array<float,2>{0.856638372f, 0.792636275f},
-std::array<float,2>{0.273481309f, 0.368583232f},
-std::array<float,2>{0.0910190269f, 0.577987432f},
-std::array<float,2>{0.747990906f, 0.0689174309f},
-std::array<float,2>{0.544666648f, 0.635509789f},
-std::array<float,2>{0.126191989f, 0.154465258f},
-std::array<float,2>{0.401091784f, 0.890087843f},
-std::array<float,2>{0.989471257f, 0.417599618f},
-std::array<float,2>{0.921429992f, 0.517063141f},
-std::array<float,2>{0.484721541f, 0.0372023173f},
-std::array<float,2>{0.248300239f, 0.84485811f},
-std::array<float,2>{0.624246478f, 0.293142587f},
-std::array<float,2>{0.653671563f, 0.947830677f},
-std::array<float,2>{0.0272481833f, 0.490794599f},
-std::array<float,2>{0.348940492f, 0.6885131f},
-std::array<float,2>{0.759938776f, 0.212490097f},
-std::array<float,2>{0.958961248f, 0.912296116f},
-std::array<float,2>{0.410177439f, 0.39867419f},
-std::array<float,2>{0.16424115f, 0.661272705f},
-std::array<float,2>{0.510049462f, 0.170324445f},
-std::array<float,2>{0.698033929f, 0.615579128f},
-std::array<float,2>{0.121126868f, 0.111558564f},
-std::array<float,2>{0.312187463f, 0.755479872f},
-std::array<float,2>{0.824513793f, 0.317941785f},
-std::array<float,2>{0.808084011f, 0.745643735f},
-std::array<float,2>{0.316564441f, 0.238189727f},
-std::array<float,2>{0.0413920097f, 0.976838946f},
-std::array<float,2>{0.671130717f, 0.466377974f},
-std::array<float,2>{0.57754904f, 0.819261849f},
-std::array<float,2>{0.213918716f, 0.274583936f},
-std::array<float,2>{0.463689089f, 0.543436766f},
-std::array<float,2>{0.891007006f, 0.0167158041f},
-std::array<float,2>{0.889338553f, 0.87031132f},
-std::array<float,2>{0.439765036f, 0.301649541f},
-std::array<float,2>{0.188808426f, 0.505183995f},
-std::array<float,2>{0.593282878f, 0.0520283543f},
-std::array<float,2>{0.673665583f, 0.704030097f},
-std::array<float,2>{0.0588607341f, 0.189995125f},
-std::array<float,2>{0.328519821f, 0.966299772f},
-std::array<float,2>{0.790551245f, 0.477822214f},
-std::array<float,2>{0.835682034f, 0.579915524f},
-std::array<float,2>{0.295675755f, 0.093262583f},
-std::array<float,2>{0.0993440822f, 0.803328633f},
-std::array<float,2>{0.703898907f, 0.353467733f},
-std::array<float,2>{0.520662606f, 0.897145569f},
-std::array<float,2>{0.183456197f, 0.434094161f},
-std::array<float,2>{0.426556975f, 0.644966245f},
-std::array<float,2>{0.944773972f, 0.128339186f},
-std::array<float,2>{0.767492175f, 0.988880396f},
-std::array<float,2>{0.359596252f, 0.44652909f},
-std::array<float,2>{0.0095121609f, 0.720175326f},
-std::array<float,2>{0.630175948f, 0.230469763f},
-std::array<float,2>{0.607754946f, 0.562015593f},
-std::array<float,2>{0.224921674f, 0.00606733235f},
-std::array<float,2>{0.484362245f, 0.832345724f},
-std::array<float,2>{0.926617086f, 0.250089496f},
-std::array<float,2>{0.973259032f, 0.683711767f},
-std::array<float,2>{0.388531446f, 0.173493043f},
-std::array<float,2>{0.153723866f, 0.926977515f},
-std::array<float,2>{0.551601887f, 0.385651827f},
-std::array<float,2>{0.728631973f, 0.766113639f},
-std::array<float,2>{0.0748553947f, 0.341459513f},
-std::array<float,2>{0.256349772f, 0.596408486f},
-std::array<float,2>{0.861938417f, 0.0982992947f},
-std::array<float,2>{0.785658419f, 0.838787436f},
-std::array<float,2>{0.343703777f, 0.262172401f},
-std::array<float,2>{0.0477491543f, 0.54815644f},
-std::array<float,2>{0.686496854f, 0.00970953982f},
-std::array<float,2>{0.580206037f, 0.726942301f},
-std::array<float,2>{0.202364817f, 0.226275086f},
-std::array<float,2>{0.449639291f, 0.995591164f},
-std::array<float,2>{0.878160596f, 0.438698649f},
-std::array<float,2>{0.946145594f, 0.605594695f},
-std::array<float,2>{0.432872176f, 0.102536626f},
-std::array<float,2>{0.177197143f, 0.773561716f},
-std::array<float,2>{0.528220415f, 0.331382275f},
-std::array<float,2>{0.716922879f, 0.931862473f},
-std::array<float,2>{0.104895733f, 0.377118111f},
-std::array<float,2>{0.281488806f, 0.677471161f},
-std::array<float,2>{0.83729291f, 0.1868985f},
-std::array<float,2>{0.933422863f, 0.955338717f},
-std::array<float,2>{0.469358772f, 0.476424545f},
-std::array<float,2>{0.231213838f, 0.717267156f},
-std::array<float,2>{0.594371676f, 0.20026347f},
-std::array<float,2>{0.638035953f, 0.508143544f},
-std::array<float,2>{0.000161738877f, 0.0606874935f},
-std::array<float,2>{0.370871931f, 0.863634467f},
-std::array<float,2>{0.777787268f, 0.305710703f},
-std::array<float,2>{0.874528944f, 0.65185982f},
-std::array<float,2>{0.262563258f, 0.138728693f},
-std::array<float,2>{0.0686107129f, 0.902340293f},
-std::array<float,2>{0.72220844f, 0.424998075f},
-std::array<float,2>{0.554761469f, 0.811012626f},
-std::array<float,2>{0.144102424f, 0.345005244f},
-std::array<float,2>{0.380084574f, 0.586698592f},
-std::array<float,2>{0.98306191f, 0.0855817869f},
-std::array<float,2>{0.998841822f, 0.765420258f},
-std::array<float,2>{0.397277743f, 0.322379231f},
-std::array<float,2>{0.134722918f, 0.620105147f},
-std::array<float,2>{0.532692134f, 0.12291605f},
-std::array<float,2>{0.741841257f, 0.670135081f},
-std::array<float,2>{0.0784282908f, 0.157393172f},
-std::array<float,2>{0.267192185f, 0.91776073f},
-std::array<float,2>{0.844031811f, 0.392740339f},
-std::array<float,2>{0.754251897f, 0.538547575f},
-std::array<float,2>{0.355946004f, 0.0308741778f},
-std::array<float,2>{0.0234100875f, 0.825482547f},
-std::array<float,2>{0.648013949f, 0.269315034f},
-std::array<float,2>{0.61412102f, 0.969114065f},
-std::array<float,2>{0.24161838f, 0.455400765f},
-std::array<float,2>{0.498696774f, 0.74081105f},
-std::array<float,2>{0.909145474f, 0.242875203f},
-std::array<float,2>{0.814135492f, 0.876974583f},
-std::array<float,2>{0.300613552f, 0.409885317f},
-std::array<float,2>{0.115099832f, 0.626222134f},
-std::array<float,2>{0.694390535f, 0.142708331f},
-std::array<float,2>{0.505476892f, 0.567586958f},
-std::array<float,2>{0.163345441f, 0.0755666047f},
-std::array<float,2>{0.418952942f, 0.787195265f},
-std::array<float,2>{0.964301705f, 0.359573215f},
-std::array<float,2>{0.898553014f, 0.702747762f},
-std::array<float,2>{0.454645753f, 0.20489116f},
-std::array<float,2>{0.20627512f, 0.939415932f},
-std::array<float,2>{0.562850773f, 0.495366871f},
-std::array<float,2>{0.656779051f, 0.855308652f},
-std::array<float,2>{0.033058513f, 0.281872392f},
-std::array<float,2>{0.320587844f, 0.527773619f},
-std::array<float,2>{0.800541341f, 0.0398881845f},
-std::array<float,2>{0.850716472f, 0.874933898f},
-std::array<float,2>{0.27000308f, 0.298691928f},
-std::array<float,2>{0.0840622187f, 0.503634632f},
-std::array<float,2>{0.736353457f, 0.0487863868f},
-std::array<float,2>{0.536517978f, 0.707826316f},
-std::array<float,2>{0.136897326f, 0.192939922f},
-std::array<float,2>{0.394418001f, 0.960976183f},
-std::array<float,2>{0.994795859f, 0.483734906f},
-std::array<float,2>{0.913852513f, 0.584675133f},
-std::array<float,2>{0.49246043f, 0.0882327557f},
-std::array<float,2>{0.234944209f, 0.800103307f},
-std::array<float,2>{0.610855758f, 0.356653959f},
-std::array<float,2>{0.644055247f, 0.892000973f},
-std::array<float,2>{0.0183538664f, 0.431334108f},
-std::array<float,2>{0.353521198f, 0.641127944f},
-std::array<float,2>{0.752322376f, 0.129931957f},
-std::array<float,2>{0.967523396f, 0.986998558f},
-std::array<float,2>{0.415774673f, 0.451564342f},
-std::array<float,2>{0.157094643f, 0.726066768f},
-std::array<float,2>{0.501419187f, 0.227299348f},
-std::array<float,2>{0.689133167f, 0.556845367f},
-std::array<float,2>{0.112472124f, 0.00270273816f},
-std::array<float,2>{0.301525533f, 0.83156532f},
-std::array<float,2>{0.819131017f, 0.256381333f},
-std::array<float,2>{0.803106487f, 0.681818068f},
-std::array<float,2>{0.327367336f, 0.177918002f},
-std::array<float,2>{0.0370631255f, 0.925013006f},
-std::array<float,2>{0.660849869f, 0.388885468f},
-std::array<float,2>{0.567243099f, 0.770572603f},
-std::array<float,2>{0.207284003f, 0.337930709f},
-std::array<float,2>{0.460024685f, 0.600672245f},
-std::array<float,2>{0.904146433f, 0.0939094573f},
-std::array<float,2>{0.879982948f, 0.796086431f},
-std::array<float,2>{0.448932439f, 0.374269038f},
-std::array<float,2>{0.197306678f, 0.571506321f},
-std::array<float,2>{0.582195938f, 0.0645567328f},
-std::array<float,2>{0.679736316f, 0.638982296f},
-std::array<float,2>{0.054574877f, 0.148822188f},
-std::array<float,2>{0.337741673f, 0.885365844f},
-std::array<float,2>{0.782062411f, 0.418203056f},
-std::array<float,2>{0.842852175f, 0.52041471f},
-std::array<float,2>{0.288377613f, 0.0332998447f},
-std::array<float,2>{0.106735773f, 0.847748041f},
-std::array<float,2>{0.712300241f, 0.292497903f},
-std::array<float,2>{0.525366664f, 0.95116502f},
-std::array<float,2>{0.175405994f, 0.485847235f},
-std::array<float,2>{0.433752239f, 0.691869259f},
-std::array<float,2>{0.952498376f, 0.218067154f},
-std::array<float,2>{0.776285291f, 0.90724653f},
-std::array<float,2>{0.372948319f, 0.403115898f},
-std::array<float,2>{0.00737223076f, 0.656764865f},
-std::array<float,2>{0.634836316f, 0.164947972f},
-std::array<float,2>{0.597903252f, 0.612315178f},
-std::array<float,2>{0.227411643f, 0.114071518f},
-std::array<float,2>{0.473356068f, 0.750990927f},
-std::array<float,2>{0.935699821f, 0.313766062f},
-std::array<float,2>{0.979730785f, 0.74808836f},
-std::array<float,2>{0.376251578f, 0.239433601f},
-std::array<float,2>{0.145977214f, 0.983177543f},
-std::array<float,2>{0.558748364f, 0.463529587f},
-std::array<float,2>{0.72441864f, 0.813583553f},
-std::array<float,2>{0.0661321059f, 0.277360141f},
-std::array<float,2>{0.259220719f, 0.542885005f},
-std::array<float,2>{0.868893683f, 0.0204947665f},
-std::array<float,2>{0.794647634f, 0.759209514f},
-std::array<float,2>{0.332971454f, 0.324676931f},
-std::array<float,2>{0.0547012836f, 0.621870697f},
-std::array<float,2>{0.678326726f, 0.120528638f},
-std::array<float,2>{0.586846888f, 0.667902529f},
-std::array<float,2>{0.192192271f, 0.161314562f},
-std::array<float,2>{0.444939345f, 0.918020368f},
-std::array<float,2>{0.884608567f, 0.395913124f},
-std::array<float,2>{0.939120352f, 0.534692883f},
-std::array<float,2>{0.42524755f, 0.0244445633f},
-std::array<float,2>{0.185062468f, 0.821391523f},
-std::array<float,2>{0.517724276f, 0.269655704f},
-std::array<float,2>{0.70881784f, 0.972789764f},
-std::array<float,2>{0.0951759666f, 0.45920521f},
-std::array<float,2>{0.291288584f, 0.735258937f},
-std::array<float,2>{0.83182317f, 0.249060333f},
-std::array<float,2>{0.922013879f, 0.879503071f},
-std::array<float,2>{0.480157048f, 0.413954556f},
-std::array<float,2>{0.220481336f, 0.629915357f},
-std::array<float,2>{0.602330089f, 0.147945568f},
-std::array<float,2>{0.628738225f, 0.563523769f},
-std::array<float,2>{0.0146572664f, 0.0716462433f},
-std::array<float,2>{0.366442204f, 0.78508687f},
-std::array<float,2>{0.771895707f, 0.366963804f},
-std::array<float,2>{0.863660634f, 0.698532522f},
-std::array<float,2>{0.251210988f, 0.20821242f},
-std::array<float,2>{0.0720124915f, 0.943965435f},
-std::array<float,2>{0.732829094f, 0.496404916f},
-std::array<float,2>{0.54785794f, 0.856560528f},
-std::array<float,2>{0.148461208f, 0.287230641f},
-std::array<float,2>{0.383302599f, 0.524975359f},
-std::array<float,2>{0.970649719f, 0.0462702438f},
-std::array<float,2>{0.984982133f, 0.843621314f},
-std::array<float,2>{0.404590935f, 0.258949339f},
-std::array<float,2>{0.132269755f, 0.551926255f},
-std::array<float,2>{0.54237473f, 0.0140843205f},
-std::array<float,2>{0.742866814f, 0.73309201f},
-std::array<float,2>{0.0895509496f, 0.219236717f},
-std::array<float,2>{0.278311402f, 0.998227298f},
-std::array<float,2>{0.85332644f, 0.44487977f},
-std::array<float,2>{0.765539825f, 0.603786111f},
-std::array<float,2>{0.346912384f, 0.109108366f},
-std::array<float,2>{0.0292359367f, 0.779457152f},
-std::array<float,2>{0.64982146f, 0.333590031f},
-std::array<float,2>{0.620029628f, 0.936101794f},
-std::array<float,2>{0.242389962f, 0.381580502f},
-std::array<float,2>{0.490398556f, 0.672436237f},
-std::array<float,2>{0.914313614f, 0.183131099f},
-std::array<float,2>{0.82297951f, 0.959535003f},
-std::array<float,2>{0.308273196f, 0.470004529f},
-std::array<float,2>{0.1201827f, 0.71121943f},
-std::array<float,2>{0.702164829f, 0.198445842f},
-std::array<float,2>{0.515038967f, 0.513516188f},
-std::array<float,2>{0.168030381f, 0.0553632788f},
-std::array<float,2>{0.409583867f, 0.86144346f},
-std::array<float,2>{0.953808904f, 0.309250683f},
-std::array<float,2>{0.897520185f, 0.653954208f},
-std::array<float,2>{0.464992374f, 0.134984359f},
-std::array<float,2>{0.216382176f, 0.905543089f},
-std::array<float,2>{0.571977317f, 0.427605063f},
-std::array<float,2>{0.666245043f, 0.807006776f},
-std::array<float,2>{0.0442149304f, 0.349385083f},
-std::array<float,2>{0.313696057f, 0.59027642f},
-std::array<float,2>{0.809468746f, 0.0814404711f},
-std::array<float,2>{0.832634449f, 0.804586887f},
-std::array<float,2>{0.29455471f, 0.351955652f},
-std::array<float,2>{0.0999471694f, 0.578633308f},
-std::array<float,2>{0.70621258f, 0.0920680016f},
-std::array<float,2>{0.522265673f, 0.646398664f},
-std::array<float,2>{0.180736944f, 0.127741709f},
-std::array<float,2>{0.429666042f, 0.897553504f},
-std::array<float,2>{0.942355752f, 0.435432315f},
-std::array<float,2>{0.887482762f, 0.504771054f},
-std::array<float,2>{0.438002974f, 0.0513205603f},
-std::array<float,2>{0.191187054f, 0.869926989f},
-std::array<float,2>{0.590851426f, 0.302392244f},
-std::array<float,2>{0.673850715f, 0.96536386f},
-std::array<float,2>{0.0615048334f, 0.476958632f},
-std::array<float,2>{0.330749601f, 0.70471853f},
-std::array<float,2>{0.792119563f, 0.190724492f},
-std::array<float,2>{0.975695133f, 0.926270068f},
-std::array<float,2>{0.389224887f, 0.386666209f},
-std::array<float,2>{0.155482605f, 0.685281932f},
-std::array<float,2>{0.554606974f, 0.172650918f},
-std::array<float,2>{0.728350341f, 0.597181141f},
-std::array<float,2>{0.0772261992f, 0.0989222005f},
-std::array<float,2>{0.25502643f, 0.766766787f},
-std::array<float,2>{0.859909654f, 0.340005815f},
-std::array<float,2>{0.768461823f, 0.719075918f},
-std::array<float,2>{0.361776352f, 0.231764451f},
-std::array<float,2>{0.0109622162f, 0.990067542f},
-std::array<float,2>{0.631303191f, 0.446035564f},
-std::array<float,2>{0.606295526f, 0.833283544f},
-std::array<float,2>{0.223269522f, 0.2512362f},
-std::array<float,2>{0.481629729f, 0.561040699f},
-std::array<float,2>{0.928411841f, 0.00735077541f},
-std::array<float,2>{0.918197513f, 0.844074309f},
-std::array<float,2>{0.486343145f, 0.293946028f},
-std::array<float,2>{0.247766048f, 0.516002119f},
-std::array<float,2>{0.622244835f, 0.0390138216f},
-std::array<float,2>{0.654859662f, 0.687966943f},
-std::array<float,2>{0.02501674f, 0.211712822f},
-std::array<float,2>{0.349805593f, 0.949195683f},
-std::array<float,2>{0.75879854f, 0.491787374f},
-std::array<float,2>{0.858061433f, 0.577010274f},
-std::array<float,2>{0.276926517f, 0.0702183843f},
-std::array<float,2>{0.0919607654f, 0.791460872f},
-std::array<float,2>{0.749204576f, 0.367218912f},
-std::array<float,2>{0.546049118f, 0.889255762f},
-std::array<float,2>{0.12846829f, 0.416106611f},
-std::array<float,2>{0.399950117f, 0.63665843f},
-std::array<float,2>{0.992146075f, 0.155733719f},
-std::array<float,2>{0.806030691f, 0.978101134f},
-std::array<float,2>{0.319553524f, 0.46535632f},
-std::array<float,2>{0.03998027f, 0.744144142f},
-std::array<float,2>{0.668016732f, 0.236442164f},
-std::array<float,2>{0.576140523f, 0.543958247f},
-std::array<float,2>{0.212694839f, 0.0161179546f},
-std::array<float,2>{0.462519258f, 0.81979686f},
-std::array<float,2>{0.892785192f, 0.273719609f},
-std::array<float,2>{0.959334195f, 0.660387278f},
-std::array<float,2>{0.413762629f, 0.171184346f},
-std::array<float,2>{0.16679135f, 0.913838327f},
-std::array<float,2>{0.508454382f, 0.399843186f},
-std::array<float,2>{0.696879148f, 0.754729867f},
-std::array<float,2>{0.123940654f, 0.317072421f},
-std::array<float,2>{0.308931559f, 0.616309643f},
-std::array<float,2>{0.827642143f, 0.112712219f},
-std::array<float,2>{0.756003022f, 0.824625432f},
-std::array<float,2>{0.359008551f, 0.267776638f},
-std::array<float,2>{0.0196152646f, 0.53734833f},
-std::array<float,2>{0.645972788f, 0.0300708599f},
-std::array<float,2>{0.616859794f, 0.741372526f},
-std::array<float,2>{0.238383815f, 0.243557468f},
-std::array<float,2>{0.496500283f, 0.969737113f},
-std::array<float,2>{0.90816474f, 0.456091017f},
-std::array<float,2>{0.997170568f, 0.620336652f},
-std::array<float,2>{0.394729435f, 0.121726334f},
-std::array<float,2>{0.135253191f, 0.76403141f},
-std::array<float,2>{0.534157515f, 0.324148148f},
-std::array<float,2>{0.739372909f, 0.916959405f},
-std::array<float,2>{0.0807619616f, 0.393795371f},
-std::array<float,2>{0.269188792f, 0.671868324f},
-std::array<float,2>{0.846193373f, 0.157029614f},
-std::array<float,2>{0.901038408f, 0.938354015f},
-std::array<float,2>{0.455126405f, 0.494223624f},
-std::array<float,2>{0.204586044f, 0.701713204f},
-std::array<float,2>{0.565383852f, 0.203296944f},
-std::array<float,2>{0.659375727f, 0.528763533f},
-std::array<float,2>{0.0335877724f, 0.0404674001f},
-std::array<float,2>{0.32383585f, 0.853678703f},
-std::array<float,2>{0.797116578f, 0.283135265f},
-std::array<float,2>{0.816121757f, 0.625826836f},
-std::array<float,2>{0.298758239f, 0.144376904f},
-std::array<float,2>{0.116384402f, 0.878622472f},
-std::array<float,2>{0.69163537f, 0.40892905f},
-std::array<float,2>{0.506739318f, 0.78852284f},
-std::array<float,2>{0.160357773f, 0.360457897f},
-std::array<float,2>{0.420075774f, 0.566662848f},
-std::array<float,2>{0.961267412f, 0.0750352815f},
-std::array<float,2>{0.948821425f, 0.775149822f},
-std::array<float,2>{0.431401402f, 0.330861032f},
-std::array<float,2>{0.177848414f, 0.607236981f},
-std::array<float,2>{0.529666483f, 0.103460588f},
-std::array<float,2>{0.714920998f, 0.676126659f},
-std::array<float,2>{0.103489041f, 0.186188176f},
-std::array<float,2>{0.283476621f, 0.933155715f},
-std::array<float,2>{0.838961005f, 0.378208756f},
-std::array<float,2>{0.787225783f, 0.547011733f},
-std::array<float,2>{0.341009945f, 0.00821463484f},
-std::array<float,2>{0.050746318f, 0.839477122f},
-std::array<float,2>{0.684974194f, 0.263511956f},
-std::array<float,2>{0.578542531f, 0.994356334f},
-std::array<float,2>{0.200253904f, 0.437613159f},
-std::array<float,2>{0.452791363f, 0.728403687f},
-std::array<float,2>{0.875345588f, 0.225116253f},
-std::array<float,2>{0.87136817f, 0.90133208f},
-std::array<float,2>{0.265365452f, 0.424216181f},
-std::array<float,2>{0.0681195483f, 0.650603354f},
-std::array<float,2>{0.720289409f, 0.140202701f},
-std::array<float,2>{0.556661606f, 0.587578952f},
-std::array<float,2>{0.140943334f, 0.0841152892f},
-std::array<float,2>{0.381048113f, 0.812348306f},
-std::array<float,2>{0.981405795f, 0.344308525f},
-std::array<float,2>{0.929994702f, 0.717913389f},
-std::array<float,2>{0.472650677f, 0.199771315f},
-std::array<float,2>{0.233892187f, 0.956750214f},
-std::array<float,2>{0.59715426f, 0.475055754f},
-std::array<float,2>{0.63985616f, 0.865106583f},
-std::array<float,2>{0.00300355558f, 0.304853737f},
-std::array<float,2>{0.368286282f, 0.508816659f},
-std::array<float,2>{0.780327797f, 0.062192183f},
-std::array<float,2>{0.817361116f, 0.828551292f},
-std::array<float,2>{0.303417087f, 0.253958672f},
-std::array<float,2>{0.109786808f, 0.556363165f},
-std::array<float,2>{0.691357195f, 0.00159083493f},
-std::array<float,2>{0.503804147f, 0.723015249f},
-std::array<float,2>{0.159278095f, 0.230197877f},
-std::array<float,2>{0.416908056f, 0.984385788f},
-std::array<float,2>{0.9657377f, 0.450258017f},
-std::array<float,2>{0.905851662f, 0.599183977f},
-std::array<float,2>{0.457043707f, 0.095703803f},
-std::array<float,2>{0.209503993f, 0.772731602f},
-std::array<float,2>{0.569535553f, 0.337655693f},
-std::array<float,2>{0.662996948f, 0.92244035f},
-std::array<float,2>{0.0376709253f, 0.386885166f},
-std::array<float,2>{0.326074451f, 0.680348396f},
-std::array<float,2>{0.800912499f, 0.17738162f},
-std::array<float,2>{0.992998898f, 0.96305728f},
-std::array<float,2>{0.392029971f, 0.481037915f},
-std::array<float,2>{0.139013335f, 0.710167527f},
-std::array<float,2>{0.538574278f, 0.194230005f},
-std::array<float,2>{0.734691799f, 0.50062108f},
-std::array<float,2>{0.0831587166f, 0.0505632199f},
-std::array<float,2>{0.272037476f, 0.871289432f},
-std::array<float,2>{0.849067807f, 0.300227344f},
-std::array<float,2>{0.750611067f, 0.64342171f},
-std::array<float,2>{0.352924287f, 0.131361008f},
-std::array<float,2>{0.0160506796f, 0.893333137f},
-std::array<float,2>{0.640902519f, 0.432287782f},
-std::array<float,2>{0.612429023f, 0.797924817f},
-std::array<float,2>{0.238186717f, 0.358243376f},
-std::array<float,2>{0.494648218f, 0.58364898f},
-std::array<float,2>{0.911676288f, 0.086777702f},
-std::array<float,2>{0.934916139f, 0.752025127f},
-std::array<float,2>{0.475155562f, 0.316128373f},
-std::array<float,2>{0.228893146f, 0.609770656f},
-std::array<float,2>{0.601164639f, 0.115333259f},
-std::array<float,2>{0.634483695f, 0.658961952f},
-std::array<float,2>{0.00421583559f, 0.166472644f},
-std::array<float,2>{0.373584002f, 0.908247054f},
-std::array<float,2>{0.773633599f, 0.406144321f},
-std::array<float,2>{0.870487928f, 0.541014671f},
-std::array<float,2>{0.260215193f, 0.0234045535f},
-std::array<float,2>{0.0642172024f, 0.816233575f},
-std::array<float,2>{0.725140214f, 0.281221002f},
-std::array<float,2>{0.560571671f, 0.982285142f},
-std::array<float,2>{0.147928551f, 0.460994929f},
-std::array<float,2>{0.377579957f, 0.746103525f},
-std::array<float,2>{0.976626813f, 0.241260827f},
-std::array<float,2>{0.783769608f, 0.883423448f},
-std::array<float,2>{0.338472337f, 0.42090413f},
-std::array<float,2>{0.0519380979f, 0.638110816f},
-std::array<float,2>{0.683109581f, 0.151441291f},
-std::array<float,2>{0.58462131f, 0.57386595f},
-std::array<float,2>{0.197027013f, 0.062794134f},
-std::array<float,2>{0.445353448f, 0.793085217f},
-std::array<float,2>{0.880891383f, 0.371531636f},
-std::array<float,2>{0.951161265f, 0.695233345f},
-std::array<float,2>{0.436440527f, 0.215117767f},
-std::array<float,2>{0.173004016f, 0.951529801f},
-std::array<float,2>{0.527010322f, 0.488262326f},
-std::array<float,2>{0.713510752f, 0.849702358f},
-std::array<float,2>{0.108626544f, 0.290227085f},
-std::array<float,2>{0.286372006f, 0.523348749f},
-std::array<float,2>{0.841561377f, 0.0321215838f},
-std::array<float,2>{0.770743728f, 0.781365871f},
-std::array<float,2>{0.365207434f, 0.363645107f},
-std::array<float,2>{0.0133825745f, 0.565072358f},
-std::array<float,2>{0.626428306f, 0.0722721368f},
-std::array<float,2>{0.604968846f, 0.631186426f},
-std::array<float,2>{0.222477913f, 0.146261528f},
-std::array<float,2>{0.477149427f, 0.881924033f},
-std::array<float,2>{0.924520731f, 0.410633296f},
-std::array<float,2>{0.972394764f, 0.526257515f},
-std::array<float,2>{0.386094213f, 0.0434357896f},
-std::array<float,2>{0.152136832f, 0.858139932f},
-std::array<float,2>{0.550180137f, 0.286823213f},
-std::array<float,2>{0.731812656f, 0.943070352f},
-std::array<float,2>{0.0741905048f, 0.499475121f},
-std::array<float,2>{0.252997935f, 0.696706772f},
-std::array<float,2>{0.867147803f, 0.210156605f},
-std::array<float,2>{0.886315346f, 0.920431912f},
-std::array<float,2>{0.442954361f, 0.398100048f},
-std::array<float,2>{0.194863111f, 0.66585058f},
-std::array<float,2>{0.589221001f, 0.163734466f},
-std::array<float,2>{0.676918268f, 0.624881029f},
-std::array<float,2>{0.0581479371f, 0.117883578f},
-std::array<float,2>{0.334898442f, 0.760710537f},
-std::array<float,2>{0.795216203f, 0.32634902f},
-std::array<float,2>{0.830040812f, 0.73731339f},
-std::array<float,2>{0.289176315f, 0.247540206f},
-std::array<float,2>{0.0974333361f, 0.976243138f},
-std::array<float,2>{0.710346401f, 0.458294153f},
-std::array<float,2>{0.517136931f, 0.822911561f},
-std::array<float,2>{0.186692566f, 0.273082316f},
-std::array<float,2>{0.423386216f, 0.532632589f},
-std::array<float,2>{0.940929294f, 0.0254214555f},
-std::array<float,2>{0.956444025f, 0.860675275f},
-std::array<float,2>{0.407056332f, 0.311244518f},
-std::array<float,2>{0.169936806f, 0.514653027f},
-std::array<float,2>{0.51299572f, 0.058126837f},
-std::array<float,2>{0.700986445f, 0.714627087f},
-std::array<float,2>{0.117899641f, 0.196352437f},
-std::array<float,2>{0.306619883f, 0.957116306f},
-std::array<float,2>{0.82181108f, 0.471750438f},
-std::array<float,2>{0.810717702f, 0.593707085f},
-std::array<float,2>{0.314782172f, 0.0793852359f},
-std::array<float,2>{0.0453182571f, 0.804864407f},
-std::array<float,2>{0.665026307f, 0.350616276f},
-std::array<float,2>{0.572836876f, 0.90271908f},
-std::array<float,2>{0.218135089f, 0.428310484f},
-std::array<float,2>{0.467667729f, 0.656137109f},
-std::array<float,2>{0.894820154f, 0.133961961f},
-std::array<float,2>{0.85371387f, 0.996614397f},
-std::array<float,2>{0.280088276f, 0.442040831f},
-std::array<float,2>{0.0869335011f, 0.731831968f},
-std::array<float,2>{0.744716585f, 0.222632393f},
-std::array<float,2>{0.539962649f, 0.553668916f},
-std::array<float,2>{0.130830973f, 0.0127991764f},
-std::array<float,2>{0.404102236f, 0.839935899f},
-std::array<float,2>{0.987736344f, 0.261601776f},
-std::array<float,2>{0.9165169f, 0.674999714f},
-std::array<float,2>{0.488620728f, 0.18062222f},
-std::array<float,2>{0.244424284f, 0.934856176f},
-std::array<float,2>{0.618365288f, 0.379624367f},
-std::array<float,2>{0.650759459f, 0.779061139f},
-std::array<float,2>{0.0294904467f, 0.3353993f},
-std::array<float,2>{0.34473601f, 0.602747262f},
-std::array<float,2>{0.763469398f, 0.105660617f},
-std::array<float,2>{0.863084853f, 0.7693488f},
-std::array<float,2>{0.257067025f, 0.341881335f},
-std::array<float,2>{0.0761525631f, 0.593757451f},
-std::array<float,2>{0.729564309f, 0.100279324f},
-std::array<float,2>{0.552475452f, 0.686742306f},
-std::array<float,2>{0.153125674f, 0.175540313f},
-std::array<float,2>{0.387536436f, 0.92775178f},
-std::array<float,2>{0.974116147f, 0.383145511f},
-std::array<float,2>{0.927129984f, 0.559990942f},
-std::array<float,2>{0.482618719f, 0.00564740552f},
-std::array<float,2>{0.225674719f, 0.834775805f},
-std::array<float,2>{0.609319448f, 0.252252638f},
-std::array<float,2>{0.629497647f, 0.991051674f},
-std::array<float,2>{0.00784337893f, 0.449024856f},
-std::array<float,2>{0.360545844f, 0.722460985f},
-std::array<float,2>{0.766044557f, 0.232710302f},
-std::array<float,2>{0.943411112f, 0.89576894f},
-std::array<float,2>{0.427540332f, 0.437439084f},
-std::array<float,2>{0.181687161f, 0.647789061f},
-std::array<float,2>{0.519931614f, 0.125234723f},
-std::array<float,2>{0.704923332f, 0.580446303f},
-std::array<float,2>{0.0978128314f, 0.0905670077f},
-std::array<float,2>{0.296448082f, 0.802032709f},
-std::array<float,2>{0.834539592f, 0.355323911f},
-std::array<float,2>{0.789338946f, 0.706862092f},
-std::array<float,2>{0.329688251f, 0.188646391f},
-std::array<float,2>{0.0605335906f, 0.96681124f},
-std::array<float,2>{0.672504365f, 0.480280906f},
-std::array<float,2>{0.592126906f, 0.868720651f},
-std::array<float,2>{0.187830344f, 0.30363965f},
-std::array<float,2>{0.441174537f, 0.507150769f},
-std::array<float,2>{0.890168369f, 0.0529279113f},
-std::array<float,2>{0.892345965f, 0.81711328f},
-std::array<float,2>{0.463978499f, 0.276533693f},
-std::array<float,2>{0.213071421f, 0.546422958f},
-std::array<float,2>{0.577115715f, 0.0184065327f},
-std::array<float,2>{0.670222104f, 0.743665397f},
-std::array<float,2>{0.0424681753f, 0.235145614f},
-std::array<float,2>{0.318128645f, 0.979313791f},
-std::array<float,2>{0.806800067f, 0.468425244f},
-std::array<float,2>{0.825619221f, 0.615090668f},
-std::array<float,2>{0.311339229f, 0.110954225f},
-std::array<float,2>{0.122679718f, 0.757382751f},
-std::array<float,2>{0.698635757f, 0.319216877f},
-std::array<float,2>{0.511255085f, 0.911620021f},
-std::array<float,2>{0.165630624f, 0.401714385f},
-std::array<float,2>{0.411551565f, 0.663398027f},
-std::array<float,2>{0.957402647f, 0.169061229f},
-std::array<float,2>{0.760966241f, 0.946249902f},
-std::array<float,2>{0.348543376f, 0.489801884f},
-std::array<float,2>{0.0257969107f, 0.690484583f},
-std::array<float,2>{0.652772605f, 0.213864535f},
-std::array<float,2>{0.623297453f, 0.518348157f},
-std::array<float,2>{0.249721214f, 0.0357065313f},
-std::array<float,2>{0.485779464f, 0.846252203f},
-std::array<float,2>{0.920294881f, 0.29681164f},
-std::array<float,2>{0.989132762f, 0.634680688f},
-std::array<float,2>{0.401617259f, 0.154294372f},
-std::array<float,2>{0.125839442f, 0.888050139f},
-std::array<float,2>{0.543651581f, 0.414752454f},
-std::array<float,2>{0.747018635f, 0.789851964f},
-std::array<float,2>{0.0905714333f, 0.36921525f},
-std::array<float,2>{0.274819434f, 0.575619519f},
-std::array<float,2>{0.85639292f, 0.0669171587f},
-std::array<float,2>{0.79952687f, 0.852048337f},
-std::array<float,2>{0.321877897f, 0.283509105f},
-std::array<float,2>{0.0316505767f, 0.530743599f},
-std::array<float,2>{0.657657504f, 0.041262947f},
-std::array<float,2>{0.564046144f, 0.70090878f},
-std::array<float,2>{0.205463126f, 0.206917346f},
-std::array<float,2>{0.454004019f, 0.939869881f},
-std::array<float,2>{0.899880588f, 0.49360165f},
-std::array<float,2>{0.963293195f, 0.57004261f},
-std::array<float,2>{0.418006331f, 0.0771519095f},
-std::array<float,2>{0.162706181f, 0.786501646f},
-std::array<float,2>{0.504709244f, 0.36299184f},
-std::array<float,2>{0.694262207f, 0.876951396f},
-std::array<float,2>{0.114136063f, 0.407395929f},
-std::array<float,2>{0.298962206f, 0.62818253f},
-std::array<float,2>{0.812704444f, 0.140814513f},
-std::array<float,2>{0.909471989f, 0.971406043f},
-std::array<float,2>{0.499927074f, 0.453861386f},
-std::array<float,2>{0.24070923f, 0.7391271f},
-std::array<float,2>{0.615163147f, 0.24449639f},
-std::array<float,2>{0.646991014f, 0.536491275f},
-std::array<float,2>{0.0216414593f, 0.0279282313f},
-std::array<float,2>{0.356713533f, 0.826934993f},
-std::array<float,2>{0.755370378f, 0.267565668f},
-std::array<float,2>{0.845505178f, 0.668816447f},
-std::array<float,2>{0.265853733f, 0.159329563f},
-std::array<float,2>{0.0797801986f, 0.914675772f},
-std::array<float,2>{0.740804195f, 0.391513199f},
-std::array<float,2>{0.531322777f, 0.762399912f},
-std::array<float,2>{0.132874101f, 0.321819752f},
-std::array<float,2>{0.398063958f, 0.618088007f},
-std::array<float,2>{0.999062955f, 0.124356322f},
-std::array<float,2>{0.983501613f, 0.809752166f},
-std::array<float,2>{0.379817575f, 0.347092092f},
-std::array<float,2>{0.142842337f, 0.58949554f},
-std::array<float,2>{0.555830002f, 0.083170794f},
-std::array<float,2>{0.721538007f, 0.648560584f},
-std::array<float,2>{0.0700662211f, 0.137751505f},
-std::array<float,2>{0.26341185f, 0.898748517f},
-std::array<float,2>{0.873831809f, 0.422093481f},
-std::array<float,2>{0.778960764f, 0.51114589f},
-std::array<float,2>{0.369637847f, 0.0597545728f},
-std::array<float,2>{0.00126951316f, 0.866224349f},
-std::array<float,2>{0.63737011f, 0.307706326f},
-std::array<float,2>{0.59525454f, 0.954417586f},
-std::array<float,2>{0.232387319f, 0.473066032f},
-std::array<float,2>{0.469762146f, 0.715937316f},
-std::array<float,2>{0.932044208f, 0.202783212f},
-std::array<float,2>{0.836464047f, 0.930451035f},
-std::array<float,2>{0.282392412f, 0.375774711f},
-std::array<float,2>{0.103808619f, 0.679567516f},
-std::array<float,2>{0.718643069f, 0.184747055f},
-std::array<float,2>{0.528341413f, 0.608389497f},
-std::array<float,2>{0.176016703f, 0.105460048f},
-std::array<float,2>{0.431785613f, 0.777201653f},
-std::array<float,2>{0.946721852f, 0.329843283f},
-std::array<float,2>{0.877666116f, 0.729110599f},
-std::array<float,2>{0.450336039f, 0.2232081f},
-std::array<float,2>{0.201261073f, 0.993238509f},
-std::array<float,2>{0.581514657f, 0.440989763f},
-std::array<float,2>{0.686690807f, 0.836971283f},
-std::array<float,2>{0.0481719188f, 0.263686389f},
-std::array<float,2>{0.342514575f, 0.550302327f},
-std::array<float,2>{0.786795974f, 0.0111189354f},
-std::array<float,2>{0.852561176f, 0.840336382f},
-std::array<float,2>{0.277629972f, 0.260782093f},
-std::array<float,2>{0.0892151743f, 0.553057015f},
-std::array<float,2>{0.742319822f, 0.0134246312f},
-std::array<float,2>{0.542680681f, 0.732078195f},
-std::array<float,2>{0.132430762f, 0.221932441f},
-std::array<float,2>{0.405152738f, 0.996157944f},
-std::array<float,2>{0.984657764f, 0.441682458f},
-std::array<float,2>{0.915030062f, 0.603032231f},
-std::array<float,2>{0.491128385f, 0.10628581f},
-std::array<float,2>{0.243066818f, 0.778358877f},
-std::array<float,2>{0.619272649f, 0.335785955f},
-std::array<float,2>{0.650152147f, 0.935411513f},
-std::array<float,2>{0.0284978841f, 0.379174322f},
-std::array<float,2>{0.34735629f, 0.675486863f},
-std::array<float,2>{0.764746249f, 0.179839849f},
-std::array<float,2>{0.953272879f, 0.957616746f},
-std::array<float,2>{0.410071939f, 0.472552449f},
-std::array<float,2>{0.168544516f, 0.714119971f},
-std::array<float,2>{0.515485585f, 0.196806505f},
-std::array<float,2>{0.702948272f, 0.51546663f},
-std::array<float,2>{0.120852701f, 0.0577138215f},
-std::array<float,2>{0.30795297f, 0.861206114f},
-std::array<float,2>{0.822534859f, 0.310919762f},
-std::array<float,2>{0.8090657f, 0.65557754f},
-std::array<float,2>{0.314422131f, 0.134581044f},
-std::array<float,2>{0.0444780178f, 0.902965605f},
-std::array<float,2>{0.666770756f, 0.428214937f},
-std::array<float,2>{0.57149148f, 0.805198073f},
-std::array<float,2>{0.216127172f, 0.351116121f},
-std::array<float,2>{0.465349048f, 0.592874706f},
-std::array<float,2>{0.898024797f, 0.0798403025f},
-std::array<float,2>{0.884194851f, 0.759947062f},
-std::array<float,2>{0.444552273f, 0.326789379f},
-std::array<float,2>{0.19152078f, 0.624030769f},
-std::array<float,2>{0.586002767f, 0.117643893f},
-std::array<float,2>{0.677779138f, 0.665406346f},
-std::array<float,2>{0.0552820861f, 0.163246915f},
-std::array<float,2>{0.332462758f, 0.920089185f},
-std::array<float,2>{0.79414624f, 0.397894353f},
-std::array<float,2>{0.831355631f, 0.533093095f},
-std::array<float,2>{0.291714668f, 0.0261474773f},
-std::array<float,2>{0.095471099f, 0.82229054f},
-std::array<float,2>{0.7081635f, 0.272813052f},
-std::array<float,2>{0.518236637f, 0.976024568f},
-std::array<float,2>{0.184814468f, 0.458519518f},
-std::array<float,2>{0.425339073f, 0.737819016f},
-std::array<float,2>{0.938660622f, 0.247576103f},
-std::array<float,2>{0.77199012f, 0.882745981f},
-std::array<float,2>{0.366749674f, 0.411096334f},
-std::array<float,2>{0.0152093871f, 0.631495357f},
-std::array<float,2>{0.628242075f, 0.145704657f},
-std::array<float,2>{0.601943016f, 0.564685166f},
-std::array<float,2>{0.219960049f, 0.0730553344f},
-std::array<float,2>{0.479521245f, 0.782048523f},
-std::array<float,2>{0.922561526f, 0.363952875f},
-std::array<float,2>{0.970010281f, 0.697116613f},
-std::array<float,2>{0.383251727f, 0.210885987f},
-std::array<float,2>{0.149377555f, 0.942730188f},
-std::array<float,2>{0.548464119f, 0.499587953f},
-std::array<float,2>{0.73304987f, 0.857861876f},
-std::array<float,2>{0.0717140585f, 0.286468655f},
-std::array<float,2>{0.25185442f, 0.525747478f},
-std::array<float,2>{0.863791764f, 0.0438899621f},
-std::array<float,2>{0.781476974f, 0.79387778f},
-std::array<float,2>{0.337137938f, 0.371752769f},
-std::array<float,2>{0.0538457111f, 0.573644698f},
-std::array<float,2>{0.680434763f, 0.0633511245f},
-std::array<float,2>{0.582973599f, 0.638488829f},
-std::array<float,2>{0.197915509f, 0.152068108f},
-std::array<float,2>{0.448454231f, 0.883265793f},
-std::array<float,2>{0.880386055f, 0.421676308f},
-std::array<float,2>{0.952970147f, 0.5228585f},
-std::array<float,2>{0.434454441f, 0.0313396081f},
-std::array<float,2>{0.174826071f, 0.850339592f},
-std::array<float,2>{0.524416268f, 0.290972441f},
-std::array<float,2>{0.712516069f, 0.952126563f},
-std::array<float,2>{0.107167147f, 0.487371832f},
-std::array<float,2>{0.2890279f, 0.694488406f},
-std::array<float,2>{0.843268275f, 0.215579122f},
-std::array<float,2>{0.936484277f, 0.908782363f},
-std::array<float,2>{0.472663134f, 0.405681789f},
-std::array<float,2>{0.226713359f, 0.658635378f},
-std::array<float,2>{0.598607719f, 0.166555792f},
-std::array<float,2>{0.635389745f, 0.610029757f},
-std::array<float,2>{0.00713985553f, 0.116201326f},
-std::array<float,2>{0.372250408f, 0.752555728f},
-std::array<float,2>{0.775835752f, 0.31557405f},
-std::array<float,2>{0.868641078f, 0.746826649f},
-std::array<float,2>{0.259530365f, 0.242162481f},
-std::array<float,2>{0.065691933f, 0.981593132f},
-std::array<float,2>{0.724100828f, 0.461551517f},
-std::array<float,2>{0.559284151f, 0.815469503f},
-std::array<float,2>{0.146457985f, 0.280747056f},
-std::array<float,2>{0.376741678f, 0.540230572f},
-std::array<float,2>{0.980451703f, 0.0229306314f},
-std::array<float,2>{0.994595051f, 0.871712863f},
-std::array<float,2>{0.393771052f, 0.300453901f},
-std::array<float,2>{0.13761355f, 0.500482202f},
-std::array<float,2>{0.536748052f, 0.049841024f},
-std::array<float,2>{0.737199187f, 0.710822463f},
-std::array<float,2>{0.0844765157f, 0.193470612f},
-std::array<float,2>{0.270049393f, 0.963389874f},
-std::array<float,2>{0.851210654f, 0.480764657f},
-std::array<float,2>{0.752818286f, 0.58311826f},
-std::array<float,2>{0.354231775f, 0.0859898627f},
-std::array<float,2>{0.0178364422f, 0.798487425f},
-std::array<float,2>{0.643969059f, 0.357694507f},
-std::array<float,2>{0.610563278f, 0.89267987f},
-std::array<float,2>{0.234799489f, 0.431971073f},
-std::array<float,2>{0.492927909f, 0.642991602f},
-std::array<float,2>{0.913432539f, 0.131076321f},
-std::array<float,2>{0.818743825f, 0.985332012f},
-std::array<float,2>{0.300815493f, 0.451054096f},
-std::array<float,2>{0.112838753f, 0.723391533f},
-std::array<float,2>{0.688556969f, 0.229691252f},
-std::array<float,2>{0.501749218f, 0.555975974f},
-std::array<float,2>{0.156434163f, 0.00112859241f},
-std::array<float,2>{0.415378243f, 0.828941345f},
-std::array<float,2>{0.967162609f, 0.254637986f},
-std::array<float,2>{0.903490245f, 0.679872155f},
-std::array<float,2>{0.460533947f, 0.177222624f},
-std::array<float,2>{0.207976207f, 0.922011197f},
-std::array<float,2>{0.566484511f, 0.387216747f},
-std::array<float,2>{0.660581708f, 0.773357868f},
-std::array<float,2>{0.0362752602f, 0.337040156f},
-std::array<float,2>{0.328037918f, 0.599011838f},
-std::array<float,2>{0.8036502f, 0.0964470208f},
-std::array<float,2>{0.839632571f, 0.776839912f},
-std::array<float,2>{0.283737421f, 0.329527408f},
-std::array<float,2>{0.10278444f, 0.607595026f},
-std::array<float,2>{0.715643704f, 0.104760975f},
-std::array<float,2>{0.529977441f, 0.679192483f},
-std::array<float,2>{0.178438976f, 0.185370937f},
-std::array<float,2>{0.431136459f, 0.930021822f},
-std::array<float,2>{0.948432088f, 0.375281483f},
-std::array<float,2>{0.875941753f, 0.550165534f},
-std::array<float,2>{0.452513486f, 0.0113504622f},
-std::array<float,2>{0.20071049f, 0.837428987f},
-std::array<float,2>{0.578774393f, 0.264413983f},
-std::array<float,2>{0.685376883f, 0.993671238f},
-std::array<float,2>{0.0502646007f, 0.440908819f},
-std::array<float,2>{0.341524452f, 0.728619456f},
-std::array<float,2>{0.787721634f, 0.222872391f},
-std::array<float,2>{0.980545998f, 0.898967922f},
-std::array<float,2>{0.381464154f, 0.422368675f},
-std::array<float,2>{0.141478688f, 0.649242938f},
-std::array<float,2>{0.557299972f, 0.138407454f},
-std::array<float,2>{0.719801605f, 0.589283228f},
-std::array<float,2>{0.0678679496f, 0.0839337185f},
-std::array<float,2>{0.264949322f, 0.810227096f},
-std::array<float,2>{0.871583223f, 0.34740001f},
-std::array<float,2>{0.780890167f, 0.71672684f},
-std::array<float,2>{0.368662387f, 0.202234015f},
-std::array<float,2>{0.0038192994f, 0.95484972f},
-std::array<float,2>{0.640511274f, 0.473356307f},
-std::array<float,2>{0.597610116f, 0.866948545f},
-std::array<float,2>{0.233491972f, 0.308423579f},
-std::array<float,2>{0.471957207f, 0.511467159f},
-std::array<float,2>{0.930356622f, 0.0605046786f},
-std::array<float,2>{0.907443523f, 0.826263905f},
-std::array<float,2>{0.496745229f, 0.267025113f},
-std::array<float,2>{0.238904208f, 0.536759615f},
-std::array<float,2>{0.616215408f, 0.0277484208f},
-std::array<float,2>{0.646413863f, 0.73831737f},
-std::array<float,2>{0.0203235056f, 0.244873002f},
-std::array<float,2>{0.358758777f, 0.970757246f},
-std::array<float,2>{0.756562769f, 0.453519583f},
-std::array<float,2>{0.846017361f, 0.617529273f},
-std::array<float,2>{0.268964291f, 0.12478102f},
-std::array<float,2>{0.0803868175f, 0.762089908f},
-std::array<float,2>{0.74021548f, 0.321643233f},
-std::array<float,2>{0.533258319f, 0.914530337f},
-std::array<float,2>{0.135532364f, 0.391000211f},
-std::array<float,2>{0.39542383f, 0.668244898f},
-std::array<float,2>{0.997898281f, 0.159805328f},
-std::array<float,2>{0.797516346f, 0.940246224f},
-std::array<float,2>{0.323424369f, 0.493737787f},
-std::array<float,2>{0.0340064652f, 0.700408638f},
-std::array<float,2>{0.65986681f, 0.206501901f},
-std::array<float,2>{0.564820468f, 0.530882776f},
-std::array<float,2>{0.205055311f, 0.0416936651f},
-std::array<float,2>{0.455760539f, 0.852401853f},
-std::array<float,2>{0.900632679f, 0.283900142f},
-std::array<float,2>{0.961561739f, 0.628442824f},
-std::array<float,2>{0.420640528f, 0.141573116f},
-std::array<float,2>{0.161002845f, 0.876090109f},
-std::array<float,2>{0.506057978f, 0.40785256f},
-std::array<float,2>{0.692125559f, 0.786794841f},
-std::array<float,2>{0.116718933f, 0.362704933f},
-std::array<float,2>{0.297862679f, 0.569434881f},
-std::array<float,2>{0.815804601f, 0.07794258f},
-std::array<float,2>{0.75952214f, 0.845765471f},
-std::array<float,2>{0.350456476f, 0.296004146f},
-std::array<float,2>{0.0245017633f, 0.517679513f},
-std::array<float,2>{0.654519022f, 0.0354143754f},
-std::array<float,2>{0.62270546f, 0.691261292f},
-std::array<float,2>{0.247353941f, 0.212960675f},
-std::array<float,2>{0.487010211f, 0.945631325f},
-std::array<float,2>{0.918815732f, 0.489529192f},
-std::array<float,2>{0.991514385f, 0.576014459f},
-std::array<float,2>{0.399508238f, 0.0666582957f},
-std::array<float,2>{0.128247857f, 0.789099753f},
-std::array<float,2>{0.546469331f, 0.369735211f},
-std::array<float,2>{0.749893129f, 0.888186038f},
-std::array<float,2>{0.092680864f, 0.414419293f},
-std::array<float,2>{0.27671808f, 0.633794785f},
-std::array<float,2>{0.857824385f, 0.153321445f},
-std::array<float,2>{0.89336437f, 0.978707016f},
-std::array<float,2>{0.462147474f, 0.467939854f},
-std::array<float,2>{0.212122306f, 0.743368328f},
-std::array<float,2>{0.575295568f, 0.234630838f},
-std::array<float,2>{0.668919384f, 0.546195388f},
-std::array<float,2>{0.0394970439f, 0.017749859f},
-std::array<float,2>{0.319863528f, 0.816567779f},
-std::array<float,2>{0.806242228f, 0.277230144f},
-std::array<float,2>{0.827231467f, 0.663885474f},
-std::array<float,2>{0.309489638f, 0.169641241f},
-std::array<float,2>{0.123058625f, 0.911795855f},
-std::array<float,2>{0.696723819f, 0.401993513f},
-std::array<float,2>{0.508117139f, 0.757049561f},
-std::array<float,2>{0.166295126f, 0.318604767f},
-std::array<float,2>{0.413223028f, 0.61428082f},
-std::array<float,2>{0.959699035f, 0.110610873f},
-std::array<float,2>{0.941439331f, 0.802305579f},
-std::array<float,2>{0.428856969f, 0.354511201f},
-std::array<float,2>{0.18133156f, 0.580584466f},
-std::array<float,2>{0.521763802f, 0.0900586247f},
-std::array<float,2>{0.706735194f, 0.648430049f},
-std::array<float,2>{0.100098163f, 0.125858873f},
-std::array<float,2>{0.294207305f, 0.896114111f},
-std::array<float,2>{0.832176983f, 0.436597377f},
-std::array<float,2>{0.792705297f, 0.507435322f},
-std::array<float,2>{0.330376178f, 0.0534639433f},
-std::array<float,2>{0.060902819f, 0.868250251f},
-std::array<float,2>{0.674524963f, 0.302913815f},
-std::array<float,2>{0.591692686f, 0.967686355f},
-std::array<float,2>{0.190778568f, 0.479722023f},
-std::array<float,2>{0.437634706f, 0.706144333f},
-std::array<float,2>{0.886911511f, 0.188979432f},
-std::array<float,2>{0.859645545f, 0.928227246f},
-std::array<float,2>{0.255388111f, 0.383462787f},
-std::array<float,2>{0.0779672712f, 0.687157154f},
-std::array<float,2>{0.727757931f, 0.174808249f},
-std::array<float,2>{0.554111183f, 0.594488144f},
-std::array<float,2>{0.156028569f, 0.0997855961f},
-std::array<float,2>{0.38881126f, 0.768702328f},
-std::array<float,2>{0.976562262f, 0.342371821f},
-std::array<float,2>{0.927831233f, 0.721930861f},
-std::array<float,2>{0.482420981f, 0.23332423f},
-std::array<float,2>{0.22280024f, 0.990296364f},
-std::array<float,2>{0.605887294f, 0.448497176f},
-std::array<float,2>{0.631383359f, 0.83422035f},
-std::array<float,2>{0.0113260383f, 0.252519369f},
-std::array<float,2>{0.362187743f, 0.560120225f},
-std::array<float,2>{0.767701328f, 0.00518204318f},
-std::array<float,2>{0.821459234f, 0.862122178f},
-std::array<float,2>{0.305899739f, 0.30863893f},
-std::array<float,2>{0.117444232f, 0.512795925f},
-std::array<float,2>{0.700384617f, 0.0549220368f},
-std::array<float,2>{0.513201416f, 0.711451888f},
-std::array<float,2>{0.170486838f, 0.198899835f},
-std::array<float,2>{0.406266153f, 0.95943886f},
-std::array<float,2>{0.956906557f, 0.47047013f},
-std::array<float,2>{0.895270407f, 0.590802789f},
-std::array<float,2>{0.466817409f, 0.0820218325f},
-std::array<float,2>{0.218449146f, 0.807336748f},
-std::array<float,2>{0.572442353f, 0.348645389f},
-std::array<float,2>{0.664452493f, 0.905874312f},
-std::array<float,2>{0.0454289503f, 0.42684105f},
-std::array<float,2>{0.315066218f, 0.653471649f},
-std::array<float,2>{0.811461985f, 0.135672286f},
-std::array<float,2>{0.98815769f, 0.998867691f},
-std::array<float,2>{0.403440714f, 0.44470638f},
-std::array<float,2>{0.130222842f, 0.732677758f},
-std::array<float,2>{0.539160609f, 0.219706476f},
-std::array<float,2>{0.744563937f, 0.552297592f},
-std::array<float,2>{0.0876038298f, 0.0146350004f},
-std::array<float,2>{0.279507726f, 0.843117774f},
-std::array<float,2>{0.854218662f, 0.259472162f},
-std::array<float,2>{0.763014019f, 0.672050774f},
-std::array<float,2>{0.345459729f, 0.182687059f},
-std::array<float,2>{0.0298065245f, 0.935613453f},
-std::array<float,2>{0.651201069f, 0.380870074f},
-std::array<float,2>{0.618667126f, 0.780196786f},
-std::array<float,2>{0.24476774f, 0.333285302f},
-std::array<float,2>{0.489144146f, 0.604460716f},
-std::array<float,2>{0.916259706f, 0.108699694f},
-std::array<float,2>{0.924040556f, 0.784396052f},
-std::array<float,2>{0.476878375f, 0.366378278f},
-std::array<float,2>{0.221686855f, 0.564439714f},
-std::array<float,2>{0.60504061f, 0.0718783736f},
-std::array<float,2>{0.626856327f, 0.630812049f},
-std::array<float,2>{0.0131757306f, 0.148140803f},
-std::array<float,2>{0.364524543f, 0.879103661f},
-std::array<float,2>{0.771084964f, 0.413126767f},
-std::array<float,2>{0.866371453f, 0.524514794f},
-std::array<float,2>{0.253547072f, 0.0467710495f},
-std::array<float,2>{0.0736658275f, 0.857064426f},
-std::array<float,2>{0.732081652f, 0.287759334f},
-std::array<float,2>{0.550387084f, 0.943630278f},
-std::array<float,2>{0.151811838f, 0.497024179f},
-std::array<float,2>{0.386524916f, 0.698854983f},
-std::array<float,2>{0.971950769f, 0.208551064f},
-std::array<float,2>{0.795799553f, 0.918477178f},
-std::array<float,2>{0.334178746f, 0.396265626f},
-std::array<float,2>{0.0580694303f, 0.667267919f},
-std::array<float,2>{0.677351713f, 0.161801323f},
-std::array<float,2>{0.589492798f, 0.621359885f},
-std::array<float,2>{0.194646016f, 0.120910279f},
-std::array<float,2>{0.442528725f, 0.759618759f},
-std::array<float,2>{0.886114597f, 0.325151771f},
-std::array<float,2>{0.940785527f, 0.734555125f},
-std::array<float,2>{0.42322281f, 0.249665171f},
-std::array<float,2>{0.187160581f, 0.973604143f},
-std::array<float,2>{0.516708791f, 0.459633529f},
-std::array<float,2>{0.710459113f, 0.822132945f},
-std::array<float,2>{0.0970005542f, 0.270498663f},
-std::array<float,2>{0.289825529f, 0.534210265f},
-std::array<float,2>{0.829364777f, 0.0252822042f},
-std::array<float,2>{0.773999095f, 0.751575887f},
-std::array<float,2>{0.37340188f, 0.314444184f},
-std::array<float,2>{0.00461453805f, 0.612962604f},
-std::array<float,2>{0.633838475f, 0.113722503f},
-std::array<float,2>{0.600671053f, 0.656520247f},
-std::array<float,2>{0.229222238f, 0.164473414f},
-std::array<float,2>{0.474979669f, 0.907883048f},
-std::array<float,2>{0.935281515f, 0.402638286f},
-std::array<float,2>{0.977149606f, 0.542183757f},
-std::array<float,2>{0.37712118f, 0.0198302753f},
-std::array<float,2>{0.148414776f, 0.814410686f},
-std::array<float,2>{0.561047852f, 0.277983189f},
-std::array<float,2>{0.724734485f, 0.98278743f},
-std::array<float,2>{0.0635135099f, 0.46327737f},
-std::array<float,2>{0.260443777f, 0.748868287f},
-std::array<float,2>{0.871050119f, 0.239800215f},
-std::array<float,2>{0.881605327f, 0.884885669f},
-std::array<float,2>{0.446166694f, 0.418500096f},
-std::array<float,2>{0.196637496f, 0.639309883f},
-std::array<float,2>{0.584216893f, 0.149310052f},
-std::array<float,2>{0.682927787f, 0.572231174f},
-std::array<float,2>{0.0526715033f, 0.0653299019f},
-std::array<float,2>{0.338308722f, 0.796553075f},
-std::array<float,2>{0.783295929f, 0.374717653f},
-std::array<float,2>{0.841270506f, 0.691980779f},
-std::array<float,2>{0.286664784f, 0.21826835f},
-std::array<float,2>{0.108994976f, 0.950255573f},
-std::array<float,2>{0.712980449f, 0.485657573f},
-std::array<float,2>{0.52662921f, 0.848250806f},
-std::array<float,2>{0.173730835f, 0.292004228f},
-std::array<float,2>{0.435725123f, 0.519805193f},
-std::array<float,2>{0.950402498f, 0.033709161f},
-std::array<float,2>{0.965120971f, 0.831390738f},
-std::array<float,2>{0.416423976f, 0.255956441f},
-std::array<float,2>{0.159745261f, 0.557178915f},
-std::array<float,2>{0.50321871f, 0.00223804847f},
-std::array<float,2>{0.690743029f, 0.726350188f},
-std::array<float,2>{0.110228404f, 0.226970538f},
-std::array<float,2>{0.302950382f, 0.986412883f},
-std::array<float,2>{0.816599548f, 0.451827198f},
-std::array<float,2>{0.801757634f, 0.601231992f},
-std::array<float,2>{0.325207472f, 0.0943036824f},
-std::array<float,2>{0.0375280119f, 0.771034241f},
-std::array<float,2>{0.662320018f, 0.338651985f},
-std::array<float,2>{0.569955528f, 0.925560772f},
-std::array<float,2>{0.209124252f, 0.389473081f},
-std::array<float,2>{0.457837433f, 0.682299316f},
-std::array<float,2>{0.905718923f, 0.178501949f},
-std::array<float,2>{0.849426091f, 0.961798668f},
-std::array<float,2>{0.271805227f, 0.484346926f},
-std::array<float,2>{0.0839667693f, 0.707297981f},
-std::array<float,2>{0.735038698f, 0.192603588f},
-std::array<float,2>{0.538296103f, 0.503190875f},
-std::array<float,2>{0.139614984f, 0.0479348861f},
-std::array<float,2>{0.392189771f, 0.874409318f},
-std::array<float,2>{0.992219806f, 0.298042715f},
-std::array<float,2>{0.911317885f, 0.640932262f},
-std::array<float,2>{0.494448543f, 0.130388007f},
-std::array<float,2>{0.237444818f, 0.892193556f},
-std::array<float,2>{0.612858295f, 0.430673599f},
-std::array<float,2>{0.641184032f, 0.800480545f},
-std::array<float,2>{0.016437212f, 0.357206106f},
-std::array<float,2>{0.353421658f, 0.584275186f},
-std::array<float,2>{0.750046849f, 0.0888655111f},
-std::array<float,2>{0.873062074f, 0.811944187f},
-std::array<float,2>{0.262897611f, 0.343868762f},
-std::array<float,2>{0.0694716424f, 0.586928844f},
-std::array<float,2>{0.721142769f, 0.0846192613f},
-std::array<float,2>{0.556370616f, 0.650994003f},
-std::array<float,2>{0.143507674f, 0.140136659f},
-std::array<float,2>{0.379223943f, 0.900679111f},
-std::array<float,2>{0.983912051f, 0.424673945f},
-std::array<float,2>{0.932383776f, 0.509391546f},
-std::array<float,2>{0.470224559f, 0.0618630238f},
-std::array<float,2>{0.231647626f, 0.864285707f},
-std::array<float,2>{0.595044732f, 0.305601686f},
-std::array<float,2>{0.637108624f, 0.956247985f},
-std::array<float,2>{0.00177652494f, 0.475256324f},
-std::array<float,2>{0.369396001f, 0.718294024f},
-std::array<float,2>{0.77842772f, 0.199653342f},
-std::array<float,2>{0.94717586f, 0.932745755f},
-std::array<float,2>{0.43229267f, 0.378682852f},
-std::array<float,2>{0.176534399f, 0.676282108f},
-std::array<float,2>{0.529143691f, 0.185686991f},
-std::array<float,2>{0.718077838f, 0.606732666f},
-std::array<float,2>{0.104429029f, 0.102959208f},
-std::array<float,2>{0.282723963f, 0.774797022f},
-std::array<float,2>{0.836157024f, 0.330218136f},
-std::array<float,2>{0.786480069f, 0.727786005f},
-std::array<float,2>{0.341996074f, 0.224787354f},
-std::array<float,2>{0.0486391634f, 0.995095432f},
-std::array<float,2>{0.687014937f, 0.438349545f},
-std::array<float,2>{0.581854165f, 0.83922267f},
-std::array<float,2>{0.2019445f, 0.262701601f},
-std::array<float,2>{0.450925231f, 0.54774636f},
-std::array<float,2>{0.877001882f, 0.00843313243f},
-std::array<float,2>{0.900246382f, 0.854286253f},
-std::array<float,2>{0.453588575f, 0.282488465f},
-std::array<float,2>{0.205719203f, 0.528914452f},
-std::array<float,2>{0.563959897f, 0.0407162756f},
-std::array<float,2>{0.6579898f, 0.701533198f},
-std::array<float,2>{0.0318681598f, 0.203633264f},
-std::array<float,2>{0.321413159f, 0.937512755f},
-std::array<float,2>{0.799242854f, 0.494927615f},
-std::array<float,2>{0.813467145f, 0.567164302f},
-std::array<float,2>{0.299383461f, 0.0746615157f},
-std::array<float,2>{0.113334343f, 0.788705647f},
-std::array<float,2>{0.693509817f, 0.360859096f},
-std::array<float,2>{0.504122078f, 0.878253937f},
-std::array<float,2>{0.162362292f, 0.408350468f},
-std::array<float,2>{0.418656111f, 0.625326157f},
-std::array<float,2>{0.963420033f, 0.143778667f},
-std::array<float,2>{0.755565584f, 0.97027415f},
-std::array<float,2>{0.356967598f, 0.456576824f},
-std::array<float,2>{0.0223862361f, 0.742152631f},
-std::array<float,2>{0.646529853f, 0.244080037f},
-std::array<float,2>{0.614523709f, 0.537786305f},
-std::array<float,2>{0.241069943f, 0.0297400448f},
-std::array<float,2>{0.499508411f, 0.825185716f},
-std::array<float,2>{0.910060644f, 0.2684111f},
-std::array<float,2>{0.999594927f, 0.671137989f},
-std::array<float,2>{0.397721171f, 0.156405091f},
-std::array<float,2>{0.133545548f, 0.916158855f},
-std::array<float,2>{0.531905174f, 0.394116759f},
-std::array<float,2>{0.74042803f, 0.764360964f},
-std::array<float,2>{0.0795107931f, 0.323471367f},
-std::array<float,2>{0.266583353f, 0.62103647f},
-std::array<float,2>{0.845112443f, 0.121560179f},
-std::array<float,2>{0.807268143f, 0.819978952f},
-std::array<float,2>{0.31756267f, 0.27419582f},
-std::array<float,2>{0.0427305251f, 0.544839144f},
-std::array<float,2>{0.670471728f, 0.0160552692f},
-std::array<float,2>{0.576304913f, 0.744675398f},
-std::array<float,2>{0.213491142f, 0.237055019f},
-std::array<float,2>{0.464719951f, 0.977931798f},
-std::array<float,2>{0.891745687f, 0.465282828f},
-std::array<float,2>{0.957792044f, 0.616738915f},
-std::array<float,2>{0.411907047f, 0.112915717f},
-std::array<float,2>{0.165434808f, 0.753921032f},
-std::array<float,2>{0.510769248f, 0.316671073f},
-std::array<float,2>{0.698942542f, 0.913471222f},
-std::array<float,2>{0.122472584f, 0.400056124f},
-std::array<float,2>{0.310901403f, 0.660996795f},
-std::array<float,2>{0.826019824f, 0.171442449f},
-std::array<float,2>{0.920456886f, 0.948708057f},
-std::array<float,2>{0.485966474f, 0.491580814f},
-std::array<float,2>{0.249411315f, 0.688248396f},
-std::array<float,2>{0.623618484f, 0.211409524f},
-std::array<float,2>{0.652855039f, 0.516371608f},
-std::array<float,2>{0.0260485783f, 0.0380924456f},
-std::array<float,2>{0.348058254f, 0.844344258f},
-std::array<float,2>{0.761317313f, 0.294507742f},
-std::array<float,2>{0.855950773f, 0.635847449f},
-std::array<float,2>{0.274981111f, 0.15598096f},
-std::array<float,2>{0.0900936425f, 0.888709903f},
-std::array<float,2>{0.746255636f, 0.416573524f},
-std::array<float,2>{0.543279648f, 0.791845858f},
-std::array<float,2>{0.125388876f, 0.368158221f},
-std::array<float,2>{0.402115703f, 0.576547086f},
-std::array<float,2>{0.988441885f, 0.0695808306f},
-std::array<float,2>{0.974459589f, 0.767417967f},
-std::array<float,2>{0.387136787f, 0.340405613f},
-std::array<float,2>{0.152346432f, 0.597000778f},
-std::array<float,2>{0.551887929f, 0.0994909778f},
-std::array<float,2>{0.730075479f, 0.684912801f},
-std::array<float,2>{0.0756370649f, 0.172197565f},
-std::array<float,2>{0.257583976f, 0.926020384f},
-std::array<float,2>{0.862596512f, 0.385909081f},
-std::array<float,2>{0.766178727f, 0.560820222f},
-std::array<float,2>{0.361059606f, 0.00723107997f},
-std::array<float,2>{0.00851466227f, 0.83362633f},
-std::array<float,2>{0.628909171f, 0.251543671f},
-std::array<float,2>{0.608684301f, 0.989532411f},
-std::array<float,2>{0.22650595f, 0.445368409f},
-std::array<float,2>{0.483286589f, 0.719654262f},
-std::array<float,2>{0.927604675f, 0.232227832f},
-std::array<float,2>{0.834095538f, 0.898035228f},
-std::array<float,2>{0.296142936f, 0.434782088f},
-std::array<float,2>{0.0984305441f, 0.645634353f},
-std::array<float,2>{0.704406619f, 0.127413228f},
-std::array<float,2>{0.520073771f, 0.578455031f},
-std::array<float,2>{0.182523325f, 0.0922859088f},
-std::array<float,2>{0.427021056f, 0.803870022f},
-std::array<float,2>{0.943877757f, 0.352297753f},
-std::array<float,2>{0.88974613f, 0.704195261f},
-std::array<float,2>{0.440799266f, 0.191097334f},
-std::array<float,2>{0.188027248f, 0.965210021f},
-std::array<float,2>{0.592335939f, 0.47709024f},
-std::array<float,2>{0.671884179f, 0.869449973f},
-std::array<float,2>{0.0597730651f, 0.301785648f},
-std::array<float,2>{0.329449773f, 0.504348874f},
-std::array<float,2>{0.789640725f, 0.0510596968f},
-std::array<float,2>{0.864978611f, 0.856381595f},
-std::array<float,2>{0.250647545f, 0.288740337f},
-std::array<float,2>{0.0711551458f, 0.524346828f},
-std::array<float,2>{0.734149933f, 0.0452507697f},
-std::array<float,2>{0.547081172f, 0.697490454f},
-std::array<float,2>{0.14972429f, 0.207582012f},
-std::array<float,2>{0.384694874f, 0.944558084f},
-std::array<float,2>{0.969150901f, 0.49792105f},
-std::array<float,2>{0.923002839f, 0.562884331f},
-std::array<float,2>{0.479148328f, 0.0703784227f},
-std::array<float,2>{0.219403625f, 0.783763885f},
-std::array<float,2>{0.603137851f, 0.365546703f},
-std::array<float,2>{0.627188504f, 0.880022287f},
-std::array<float,2>{0.0141275842f, 0.412359387f},
-std::array<float,2>{0.365302682f, 0.629318535f},
-std::array<float,2>{0.772874534f, 0.147009507f},
-std::array<float,2>{0.938254833f, 0.973759055f},
-std::array<float,2>{0.424223036f, 0.460897654f},
-std::array<float,2>{0.184017941f, 0.735583901f},
-std::array<float,2>{0.518903673f, 0.248677135f},
-std::array<float,2>{0.707731545f, 0.53359139f},
-std::array<float,2>{0.0937961414f, 0.0236238278f},
-std::array<float,2>{0.292168081f, 0.821127534f},
-std::array<float,2>{0.830453515f, 0.271161288f},
-std::array<float,2>{0.793422163f, 0.666192949f},
-std::array<float,2>{0.333325386f, 0.160193622f},
-std::array<float,2>{0.0561077707f, 0.919104874f},
-std::array<float,2>{0.67962265f, 0.395037144f},
-std::array<float,2>{0.587392271f, 0.757975638f},
-std::array<float,2>{0.192495614f, 0.325796604f},
-std::array<float,2>{0.444283515f, 0.623033524f},
-std::array<float,2>{0.882909715f, 0.119290046f},
-std::array<float,2>{0.897089064f, 0.807658374f},
-std::array<float,2>{0.465838313f, 0.348545969f},
-std::array<float,2>{0.215749666f, 0.59108758f},
-std::array<float,2>{0.570518434f, 0.0808212683f},
-std::array<float,2>{0.667216182f, 0.652569532f},
-std::array<float,2>{0.043425668f, 0.136241004f},
-std::array<float,2>{0.312661707f, 0.904768169f},
-std::array<float,2>{0.810371816f, 0.426085293f},
-std::array<float,2>{0.823692918f, 0.512176454f},
-std::array<float,2>{0.307090044f, 0.0565765612f},
-std::array<float,2>{0.120012052f, 0.863097727f},
-std::array<float,2>{0.702110946f, 0.309701264f},
-std::array<float,2>{0.514093518f, 0.960547507f},
-std::array<float,2>{0.169917852f, 0.468882412f},
-std::array<float,2>{0.40858978f, 0.712445676f},
-std::array<float,2>{0.95455575f, 0.197471946f},
-std::array<float,2>{0.763757467f, 0.936939836f},
-std::array<float,2>{0.346314818f, 0.382638514f},
-std::array<float,2>{0.0273888446f, 0.673291028f},
-std::array<float,2>{0.648475468f, 0.182331011f},
-std::array<float,2>{0.620791614f, 0.604580462f},
-std::array<float,2>{0.243231401f, 0.107919574f},
-std::array<float,2>{0.491994053f, 0.780550122f},
-std::array<float,2>{0.915366769f, 0.332578093f},
-std::array<float,2>{0.986242652f, 0.733951509f},
-std::array<float,2>{0.405681759f, 0.219744191f},
-std::array<float,2>{0.13130255f, 0.999244213f},
-std::array<float,2>{0.54175657f, 0.444307625f},
-std::array<float,2>{0.74396503f, 0.841926992f},
-std::array<float,2>{0.0880911425f, 0.258153588f},
-std::array<float,2>{0.279003799f, 0.551404059f},
-std::array<float,2>{0.852364898f, 0.0151300151f},
-std::array<float,2>{0.804625213f, 0.76987642f},
-std::array<float,2>{0.327067524f, 0.339836597f},
-std::array<float,2>{0.0360147357f, 0.600098312f},
-std::array<float,2>{0.661353111f, 0.0950113088f},
-std::array<float,2>{0.567492962f, 0.683294594f},
-std::array<float,2>{0.208746552f, 0.179479539f},
-std::array<float,2>{0.459618419f, 0.924476027f},
-std::array<float,2>{0.902892351f, 0.389853179f},
-std::array<float,2>{0.968423545f, 0.557734132f},
-std::array<float,2>{0.414624989f, 0.00293946848f},
-std::array<float,2>{0.157872602f, 0.830542564f},
-std::array<float,2>{0.500467598f, 0.257574022f},
-std::array<float,2>{0.687894523f, 0.987667143f},
-std::array<float,2>{0.111830831f, 0.453060448f},
-std::array<float,2>{0.301790565f, 0.725432217f},
-std::array<float,2>{0.819495082f, 0.228335828f},
-std::array<float,2>{0.91220665f, 0.891454577f},
-std::array<float,2>{0.493800759f, 0.430458724f},
-std::array<float,2>{0.235390633f, 0.642322421f},
-std::array<float,2>{0.609846175f, 0.129878715f},
-std::array<float,2>{0.643516183f, 0.585268676f},
-std::array<float,2>{0.0186841711f, 0.0891100764f},
-std::array<float,2>{0.35512796f, 0.799737215f},
-std::array<float,2>{0.753401279f, 0.355782509f},
-std::array<float,2>{0.849875987f, 0.708192945f},
-std::array<float,2>{0.271041334f, 0.191867277f},
-std::array<float,2>{0.0858936012f, 0.962197959f},
-std::array<float,2>{0.738187969f, 0.483188808f},
-std::array<float,2>{0.535716355f, 0.873507738f},
-std::array<float,2>{0.137865499f, 0.297459543f},
-std::array<float,2>{0.393513381f, 0.502822757f},
-std::array<float,2>{0.995345056f, 0.047778748f},
-std::array<float,2>{0.979221761f, 0.813379288f},
-std::array<float,2>{0.375718206f, 0.278767645f},
-std::array<float,2>{0.144823477f, 0.541174948f},
-std::array<float,2>{0.560262501f, 0.0205542147f},
-std::array<float,2>{0.723588645f, 0.749253511f},
-std::array<float,2>{0.0653535351f, 0.238630816f},
-std::array<float,2>{0.258601785f, 0.983573735f},
-std::array<float,2>{0.867625177f, 0.464679152f},
-std::array<float,2>{0.776851356f, 0.611795068f},
-std::array<float,2>{0.372025669f, 0.114893362f},
-std::array<float,2>{0.00672754785f, 0.750654042f},
-std::array<float,2>{0.63667357f, 0.313350141f},
-std::array<float,2>{0.599564254f, 0.906659544f},
-std::array<float,2>{0.228057846f, 0.404211015f},
-std::array<float,2>{0.474405915f, 0.658095539f},
-std::array<float,2>{0.93671459f, 0.165875256f},
-std::array<float,2>{0.842123091f, 0.94967258f},
-std::array<float,2>{0.288048655f, 0.485003591f},
-std::array<float,2>{0.106316157f, 0.693010449f},
-std::array<float,2>{0.711678445f, 0.216816097f},
-std::array<float,2>{0.52372247f, 0.521201551f},
-std::array<float,2>{0.174169749f, 0.0343986452f},
-std::array<float,2>{0.435401469f, 0.849105537f},
-std::array<float,2>{0.951583862f, 0.291082978f},
-std::array<float,2>{0.879623413f, 0.640332699f},
-std::array<float,2>{0.447308153f, 0.150114909f},
-std::array<float,2>{0.199170589f, 0.885742664f},
-std::array<float,2>{0.583742619f, 0.419163316f},
-std::array<float,2>{0.681178808f, 0.795579493f},
-std::array<float,2>{0.0536402538f, 0.373135895f},
-std::array<float,2>{0.336238593f, 0.570736289f},
-std::array<float,2>{0.782470763f, 0.065535076f},
-std::array<float,2>{0.814909577f, 0.787815213f},
-std::array<float,2>{0.296885997f, 0.360188842f},
-std::array<float,2>{0.116136201f, 0.56822288f},
-std::array<float,2>{0.693347037f, 0.0757847428f},
-std::array<float,2>{0.507228374f, 0.626599193f},
-std::array<float,2>{0.161428168f, 0.143419027f},
-std::array<float,2>{0.421422452f, 0.877483547f},
-std::array<float,2>{0.962103307f, 0.409544528f},
-std::array<float,2>{0.90189141f, 0.528225064f},
-std::array<float,2>{0.456716776f, 0.0390976146f},
-std::array<float,2>{0.203671649f, 0.854557812f},
-std::array<float,2>{0.566016018f, 0.281316757f},
-std::array<float,2>{0.658292592f, 0.938767076f},
-std::array<float,2>{0.034248855f, 0.496008605f},
-std::array<float,2>{0.323224217f, 0.702337861f},
-std::array<float,2>{0.798448563f, 0.204111531f},
-std::array<float,2>{0.996931016f, 0.917062342f},
-std::array<float,2>{0.395761192f, 0.393463522f},
-std::array<float,2>{0.136355177f, 0.67064482f},
-std::array<float,2>{0.534282923f, 0.157927215f},
-std::array<float,2>{0.739080548f, 0.619421303f},
-std::array<float,2>{0.0816025212f, 0.122317284f},
-std::array<float,2>{0.267609715f, 0.765020072f},
-std::array<float,2>{0.84725982f, 0.322998136f},
-std::array<float,2>{0.757120252f, 0.740462184f},
-std::array<float,2>{0.35785675f, 0.242247269f},
-std::array<float,2>{0.0207795296f, 0.969383955f},
-std::array<float,2>{0.644733191f, 0.45582974f},
-std::array<float,2>{0.615457118f, 0.826135933f},
-std::array<float,2>{0.239407465f, 0.268785059f},
-std::array<float,2>{0.497260213f, 0.538989782f},
-std::array<float,2>{0.906760037f, 0.0307277963f},
-std::array<float,2>{0.930989325f, 0.864035368f},
-std::array<float,2>{0.470899999f, 0.306356847f},
-std::array<float,2>{0.232776895f, 0.508734226f},
-std::array<float,2>{0.595765054f, 0.0612295046f},
-std::array<float,2>{0.638939738f, 0.71758908f},
-std::array<float,2>{0.00241253199f, 0.200968772f},
-std::array<float,2>{0.367715061f, 0.955948174f},
-std::array<float,2>{0.779657543f, 0.475880295f},
-std::array<float,2>{0.87244153f, 0.586409807f},
-std::array<float,2>{0.264000863f, 0.0850971118f},
-std::array<float,2>{0.0668103322f, 0.811397612f},
-std::array<float,2>{0.719648778f, 0.345395416f},
-std::array<float,2>{0.557707608f, 0.90177083f},
-std::array<float,2>{0.142013401f, 0.425691992f},
-std::array<float,2>{0.382376552f, 0.65154314f},
-std::array<float,2>{0.982375979f, 0.139207751f},
-std::array<float,2>{0.788666844f, 0.995954514f},
-std::array<float,2>{0.340059876f, 0.439335734f},
-std::array<float,2>{0.048919905f, 0.727223635f},
-std::array<float,2>{0.684331477f, 0.225977302f},
-std::array<float,2>{0.579298735f, 0.548422754f},
-std::array<float,2>{0.200016409f, 0.00908193924f},
-std::array<float,2>{0.452072114f, 0.838268995f},
-std::array<float,2>{0.87649703f, 0.262621254f},
-std::array<float,2>{0.94735229f, 0.676923871f},
-std::array<float,2>{0.430299401f, 0.187428758f},
-std::array<float,2>{0.179344207f, 0.932478666f},
-std::array<float,2>{0.530594826f, 0.377748549f},
-std::array<float,2>{0.715868056f, 0.774137735f},
-std::array<float,2>{0.101730794f, 0.331671387f},
-std::array<float,2>{0.285153121f, 0.606403947f},
-std::array<float,2>{0.8387447f, 0.101565771f},
-std::array<float,2>{0.769419074f, 0.832899272f},
-std::array<float,2>{0.362311393f, 0.250677526f},
-std::array<float,2>{0.0104408087f, 0.561770797f},
-std::array<float,2>{0.632695138f, 0.00640116446f},
-std::array<float,2>{0.60724777f, 0.720574081f},
-std::array<float,2>{0.224606723f, 0.231278285f},
-std::array<float,2>{0.481254101f, 0.988336742f},
-std::array<float,2>{0.929431736f, 0.446984172f},
-std::array<float,2>{0.975293338f, 0.596190393f},
-std::array<float,2>{0.390442789f, 0.0980646312f},
-std::array<float,2>{0.154552594f, 0.765720189f},
-std::array<float,2>{0.553292692f, 0.341052771f},
-std::array<float,2>{0.727445304f, 0.927283347f},
-std::array<float,2>{0.0764361322f, 0.385108113f},
-std::array<float,2>{0.254805595f, 0.684405982f},
-std::array<float,2>{0.860764742f, 0.173086926f},
-std::array<float,2>{0.888401985f, 0.966493845f},
-std::array<float,2>{0.438716322f, 0.478492886f},
-std::array<float,2>{0.190232724f, 0.703462601f},
-std::array<float,2>{0.59029448f, 0.189662337f},
-std::array<float,2>{0.675774753f, 0.505421042f},
-std::array<float,2>{0.0624077655f, 0.052397918f},
-std::array<float,2>{0.331378937f, 0.870859027f},
-std::array<float,2>{0.791303337f, 0.300901473f},
-std::array<float,2>{0.833518803f, 0.645347178f},
-std::array<float,2>{0.293355882f, 0.128432244f},
-std::array<float,2>{0.100980304f, 0.896806657f},
-std::array<float,2>{0.705159783f, 0.433980346f},
-std::array<float,2>{0.523088992f, 0.803116202f},
-std::array<float,2>{0.18020469f, 0.352549195f},
-std::array<float,2>{0.428171217f, 0.579266667f},
-std::array<float,2>{0.943141222f, 0.0932260975f},
-std::array<float,2>{0.960019827f, 0.75529182f},
-std::array<float,2>{0.413083136f, 0.317430913f},
-std::array<float,2>{0.167531282f, 0.616007864f},
-std::array<float,2>{0.509478271f, 0.112128854f},
-std::array<float,2>{0.695814788f, 0.661625981f},
-std::array<float,2>{0.124107741f, 0.170654207f},
-std::array<float,2>{0.309733182f, 0.912620962f},
-std::array<float,2>{0.826602101f, 0.399372339f},
-std::array<float,2>{0.804861367f, 0.543726265f},
-std::array<float,2>{0.318626761f, 0.0172012802f},
-std::array<float,2>{0.0408274196f, 0.81881845f},
-std::array<float,2>{0.669061124f, 0.275271684f},
-std::array<float,2>{0.574322164f, 0.977288842f},
-std::array<float,2>{0.211081535f, 0.465830743f},
-std::array<float,2>{0.461054116f, 0.74531585f},
-std::array<float,2>{0.89416945f, 0.237753585f},
-std::array<float,2>{0.859044492f, 0.890384197f},
-std::array<float,2>{0.276286751f, 0.417047441f},
-std::array<float,2>{0.0934277922f, 0.634803832f},
-std::array<float,2>{0.748859048f, 0.154981151f},
-std::array<float,2>{0.545021772f, 0.577225029f},
-std::array<float,2>{0.127431676f, 0.0686965957f},
-std::array<float,2>{0.399381012f, 0.79242301f},
-std::array<float,2>{0.991170824f, 0.36884132f},
-std::array<float,2>{0.91952014f, 0.689009905f},
-std::array<float,2>{0.487355113f, 0.212090775f},
-std::array<float,2>{0.246697709f, 0.94750917f},
-std::array<float,2>{0.621785223f, 0.490254074f},
-std::array<float,2>{0.655907154f, 0.84555608f},
-std::array<float,2>{0.0240193717f, 0.293632925f},
-std::array<float,2>{0.351174265f, 0.517334163f},
-std::array<float,2>{0.758357406f, 0.0379548818f},
-std::array<float,2>{0.828480244f, 0.823491335f},
-std::array<float,2>{0.290638715f, 0.271916509f},
-std::array<float,2>{0.0957996547f, 0.531374514f},
-std::array<float,2>{0.709107876f, 0.0272725504f},
-std::array<float,2>{0.515734315f, 0.737231791f},
-std::array<float,2>{0.186483428f, 0.24633573f},
-std::array<float,2>{0.422694057f, 0.974904418f},
-std::array<float,2>{0.939967334f, 0.457709819f},
-std::array<float,2>{0.885216534f, 0.623622656f},
-std::array<float,2>{0.442108601f, 0.119030334f},
-std::array<float,2>{0.193570793f, 0.760842085f},
-std::array<float,2>{0.58815062f, 0.32782346f},
-std::array<float,2>{0.676295817f, 0.921051443f},
-std::array<float,2>{0.0569857173f, 0.396526039f},
-std::array<float,2>{0.335456401f, 0.664983869f},
-std::array<float,2>{0.796330512f, 0.162363648f},
-std::array<float,2>{0.971602023f, 0.942320585f},
-std::array<float,2>{0.385036856f, 0.498451173f},
-std::array<float,2>{0.150822431f, 0.69576478f},
-std::array<float,2>{0.549016416f, 0.209076136f},
-std::array<float,2>{0.730688989f, 0.52698487f},
-std::array<float,2>{0.0725154728f, 0.0448625945f},
-std::array<float,2>{0.252539963f, 0.858727336f},
-std::array<float,2>{0.865961909f, 0.285587698f},
-std::array<float,2>{0.770068705f, 0.632758796f},
-std::array<float,2>{0.364120275f, 0.14529635f},
-std::array<float,2>{0.0124674877f, 0.881771386f},
-std::array<float,2>{0.62528789f, 0.411189973f},
-std::array<float,2>{0.604292035f, 0.782689869f},
-std::array<float,2>{0.221375227f, 0.365153104f},
-std::array<float,2>{0.477605641f, 0.565785766f},
-std::array<float,2>{0.925189495f, 0.0732563958f},
-std::array<float,2>{0.917387366f, 0.777674079f},
-std::array<float,2>{0.489369839f, 0.334354699f},
-std::array<float,2>{0.245197251f, 0.602466941f},
-std::array<float,2>{0.617530942f, 0.106868103f},
-std::array<float,2>{0.651628137f, 0.674583197f},
-std::array<float,2>{0.0309603158f, 0.181082308f},
-std::array<float,2>{0.344400018f, 0.934511364f},
-std::array<float,2>{0.762107909f, 0.380796313f},
-std::array<float,2>{0.855008423f, 0.553952575f},
-std::array<float,2>{0.280836433f, 0.012103538f},
-std::array<float,2>{0.0865174532f, 0.840915024f},
-std::array<float,2>{0.745802224f, 0.260098875f},
-std::array<float,2>{0.540947616f, 0.997800171f},
-std::array<float,2>{0.12903963f, 0.442726493f},
-std::array<float,2>{0.40298146f, 0.73119545f},
-std::array<float,2>{0.986727655f, 0.221570253f},
-std::array<float,2>{0.812224269f, 0.903900146f},
-std::array<float,2>{0.316081077f, 0.429247677f},
-std::array<float,2>{0.0463055298f, 0.654615462f},
-std::array<float,2>{0.665713131f, 0.133295819f},
-std::array<float,2>{0.573272169f, 0.592427969f},
-std::array<float,2>{0.217318669f, 0.0790900216f},
-std::array<float,2>{0.468609899f, 0.806612313f},
-std::array<float,2>{0.896089911f, 0.350095183f},
-std::array<float,2>{0.955762148f, 0.713659585f},
-std::array<float,2>{0.40728578f, 0.195499212f},
-std::array<float,2>{0.171508148f, 0.958931744f},
-std::array<float,2>{0.512113988f, 0.471464127f},
-std::array<float,2>{0.699443936f, 0.859469593f},
-std::array<float,2>{0.118533798f, 0.312497884f},
-std::array<float,2>{0.304785281f, 0.514296055f},
-std::array<float,2>{0.821234584f, 0.0571822785f},
-std::array<float,2>{0.751591563f, 0.797727883f},
-std::array<float,2>{0.351774693f, 0.359149724f},
-std::array<float,2>{0.0174680986f, 0.582219899f},
-std::array<float,2>{0.642427325f, 0.0873431787f},
-std::array<float,2>{0.611920297f, 0.643990457f},
-std::array<float,2>{0.236803025f, 0.132491738f},
-std::array<float,2>{0.495528519f, 0.894403636f},
-std::array<float,2>{0.910465598f, 0.4335576f},
-std::array<float,2>{0.99397558f, 0.501318812f},
-std::array<float,2>{0.390852213f, 0.0491317101f},
-std::array<float,2>{0.140623435f, 0.872265339f},
-std::array<float,2>{0.538026035f, 0.299044609f},
-std::array<float,2>{0.735795915f, 0.964324057f},
-std::array<float,2>{0.0825809017f, 0.481711924f},
-std::array<float,2>{0.273269385f, 0.709927619f},
-std::array<float,2>{0.848221481f, 0.19521834f},
-std::array<float,2>{0.904387772f, 0.923826456f},
-std::array<float,2>{0.458977908f, 0.388038635f},
-std::array<float,2>{0.210397214f, 0.681157291f},
-std::array<float,2>{0.569315195f, 0.176289842f},
-std::array<float,2>{0.663868427f, 0.597808957f},
-std::array<float,2>{0.0388436541f, 0.0967203304f},
-std::array<float,2>{0.324564785f, 0.772367775f},
-std::array<float,2>{0.802587748f, 0.336074352f},
-std::array<float,2>{0.817830563f, 0.723888338f},
-std::array<float,2>{0.304467559f, 0.228870541f},
-std::array<float,2>{0.111167535f, 0.985948563f},
-std::array<float,2>{0.689690053f, 0.449943811f},
-std::array<float,2>{0.502337098f, 0.829617321f},
-std::array<float,2>{0.159098521f, 0.254912317f},
-std::array<float,2>{0.417121708f, 0.55479908f},
-std::array<float,2>{0.966169238f, 0.000913383556f},
-std::array<float,2>{0.949994624f, 0.851488113f},
-std::array<float,2>{0.436959445f, 0.289271086f},
-std::array<float,2>{0.172334999f, 0.522208333f},
-std::array<float,2>{0.525563061f, 0.0325548723f},
-std::array<float,2>{0.714175284f, 0.693400264f},
-std::array<float,2>{0.107473306f, 0.215963081f},
-std::array<float,2>{0.285603523f, 0.952750862f},
-std::array<float,2>{0.840524495f, 0.487051159f},
-std::array<float,2>{0.784516037f, 0.572725058f},
-std::array<float,2>{0.33950451f, 0.0640065223f},
-std::array<float,2>{0.0517004654f, 0.794586658f},
-std::array<float,2>{0.68189007f, 0.372315586f},
-std::array<float,2>{0.585443318f, 0.884092987f},
-std::array<float,2>{0.196265742f, 0.420871854f},
-std::array<float,2>{0.447138876f, 0.636903405f},
-std::array<float,2>{0.882274628f, 0.151300326f},
-std::array<float,2>{0.86964345f, 0.981161833f},
-std::array<float,2>{0.261715293f, 0.462020218f},
-std::array<float,2>{0.0629969388f, 0.747985184f},
-std::array<float,2>{0.726289928f, 0.241137683f},
-std::array<float,2>{0.561868906f, 0.539959788f},
-std::array<float,2>{0.146632567f, 0.0214856975f},
-std::array<float,2>{0.37849161f, 0.815263093f},
-std::array<float,2>{0.977553248f, 0.279984385f},
-std::array<float,2>{0.934334993f, 0.659580231f},
-std::array<float,2>{0.475714326f, 0.167207733f},
-std::array<float,2>{0.229634434f, 0.909593165f},
-std::array<float,2>{0.599845767f, 0.404379129f},
-std::array<float,2>{0.633317292f, 0.753538668f},
-std::array<float,2>{0.0053241211f, 0.314570636f},
-std::array<float,2>{0.374629945f, 0.611222267f},
-std::array<float,2>{0.77477479f, 0.116844706f},
-std::array<float,2>{0.844636917f, 0.762990832f},
-std::array<float,2>{0.266915977f, 0.321134925f},
-std::array<float,2>{0.0790006295f, 0.618447602f},
-std::array<float,2>{0.741556346f, 0.123451889f},
-std::array<float,2>{0.533104062f, 0.66951704f},
-std::array<float,2>{0.133796647f, 0.15836437f},
-std::array<float,2>{0.396494955f, 0.91583091f},
-std::array<float,2>{0.998411119f, 0.39176321f},
-std::array<float,2>{0.908464968f, 0.535801649f},
-std::array<float,2>{0.498131335f, 0.0290707871f},
-std::array<float,2>{0.241854146f, 0.827341795f},
-std::array<float,2>{0.613365412f, 0.266442865f},
-std::array<float,2>{0.647665143f, 0.972175598f},
-std::array<float,2>{0.0228474885f, 0.455063105f},
-std::array<float,2>{0.355984569f, 0.739334166f},
-std::array<float,2>{0.754642785f, 0.245345727f},
-std::array<float,2>{0.964749753f, 0.875874341f},
-std::array<float,2>{0.419699132f, 0.407075167f},
-std::array<float,2>{0.163642287f, 0.627536535f},
-std::array<float,2>{0.505279303f, 0.142530888f},
-std::array<float,2>{0.695034921f, 0.568916738f},
-std::array<float,2>{0.114439987f, 0.0764742568f},
-std::array<float,2>{0.300145149f, 0.785724163f},
-std::array<float,2>{0.813916445f, 0.361554533f},
-std::array<float,2>{0.800274014f, 0.699794054f},
-std::array<float,2>{0.32106179f, 0.205260158f},
-std::array<float,2>{0.0325884782f, 0.940810025f},
-std::array<float,2>{0.656611383f, 0.493005931f},
-std::array<float,2>{0.563129008f, 0.852579772f},
-std::array<float,2>{0.20666717f, 0.285155922f},
-std::array<float,2>{0.454142451f, 0.530171454f},
-std::array<float,2>{0.899221539f, 0.0428974144f},
-std::array<float,2>{0.878727317f, 0.836911738f},
-std::array<float,2>{0.450159222f, 0.264806807f},
-std::array<float,2>{0.20292145f, 0.549583256f},
-std::array<float,2>{0.580672503f, 0.009767754f},
-std::array<float,2>{0.685838699f, 0.730358362f},
-std::array<float,2>{0.0470734276f, 0.223661512f},
-std::array<float,2>{0.342996836f, 0.992720366f},
-std::array<float,2>{0.785567105f, 0.439657658f},
-std::array<float,2>{0.837736845f, 0.6084764f},
-std::array<float,2>{0.282018691f, 0.104379401f},
-std::array<float,2>{0.105457425f, 0.77553165f},
-std::array<float,2>{0.71768862f, 0.328553498f},
-std::array<float,2>{0.527702928f, 0.931432366f},
-std::array<float,2>{0.177681774f, 0.376365602f},
-std::array<float,2>{0.433592618f, 0.677991867f},
-std::array<float,2>{0.945713162f, 0.183850706f},
-std::array<float,2>{0.777914524f, 0.953224957f},
-std::array<float,2>{0.370505512f, 0.473743349f},
-std::array<float,2>{0.000713456597f, 0.715170145f},
-std::array<float,2>{0.638415277f, 0.201576665f},
-std::array<float,2>{0.593814373f, 0.510461509f},
-std::array<float,2>{0.230760738f, 0.0590585731f},
-std::array<float,2>{0.469123811f, 0.866088986f},
-std::array<float,2>{0.932875335f, 0.307209224f},
-std::array<float,2>{0.982820213f, 0.649740219f},
-std::array<float,2>{0.380659819f, 0.137194455f},
-std::array<float,2>{0.14389959f, 0.900144339f},
-std::array<float,2>{0.555292606f, 0.423116237f},
-std::array<float,2>{0.721781611f, 0.809234679f},
-std::array<float,2>{0.0691744164f, 0.346398711f},
-std::array<float,2>{0.26178959f, 0.588224232f},
-std::array<float,2>{0.874350369f, 0.0828281343f},
-std::array<float,2>{0.790264666f, 0.867631137f},
-std::array<float,2>{0.328789234f, 0.30440411f},
-std::array<float,2>{0.0592721999f, 0.506422639f},
-std::array<float,2>{0.672935069f, 0.0546781458f},
-std::array<float,2>{0.592989981f, 0.705543458f},
-std::array<float,2>{0.189094037f, 0.188408166f},
-std::array<float,2>{0.44017598f, 0.968493164f},
-std::array<float,2>{0.889070034f, 0.479013085f},
-std::array<float,2>{0.945064783f, 0.581282735f},
-std::array<float,2>{0.425889075f, 0.0916395709f},
-std::array<float,2>{0.182886586f, 0.80116725f},
-std::array<float,2>{0.52121985f, 0.353699893f},
-std::array<float,2>{0.703435004f, 0.895330369f},
-std::array<float,2>{0.098760359f, 0.435917258f},
-std::array<float,2>{0.295071393f, 0.646714091f},
-std::array<float,2>{0.835269392f, 0.126302361f},
-std::array<float,2>{0.926219225f, 0.991554439f},
-std::array<float,2>{0.483662158f, 0.44822365f},
-std::array<float,2>{0.225101963f, 0.720758259f},
-std::array<float,2>{0.607920766f, 0.234294832f},
-std::array<float,2>{0.630827546f, 0.559173703f},
-std::array<float,2>{0.00924203079f, 0.00463774893f},
-std::array<float,2>{0.359988928f, 0.835489571f},
-std::array<float,2>{0.766921759f, 0.253667623f},
-std::array<float,2>{0.861515164f, 0.686518073f},
-std::array<float,2>{0.256121188f, 0.174525753f},
-std::array<float,2>{0.0745702162f, 0.92954874f},
-std::array<float,2>{0.729290962f, 0.384354442f},
-std::array<float,2>{0.551203549f, 0.76760453f},
-std::array<float,2>{0.154204398f, 0.343681842f},
-std::array<float,2>{0.387806356f, 0.594738066f},
-std::array<float,2>{0.97295171f, 0.1009859f},
-std::array<float,2>{0.990117669f, 0.790743589f},
-std::array<float,2>{0.400538623f, 0.371031165f},
-std::array<float,2>{0.126945451f, 0.574528456f},
-std::array<float,2>{0.544067144f, 0.067574285f},
-std::array<float,2>{0.747464299f, 0.633028984f},
-std::array<float,2>{0.0913898945f, 0.15298374f},
-std::array<float,2>{0.27407673f, 0.887673855f},
-std::array<float,2>{0.857271552f, 0.415281713f},
-std::array<float,2>{0.760264218f, 0.519336522f},
-std::array<float,2>{0.349160224f, 0.0366235301f},
-std::array<float,2>{0.0267131235f, 0.847426414f},
-std::array<float,2>{0.653810799f, 0.294970274f},
-std::array<float,2>{0.624596298f, 0.947088897f},
-std::array<float,2>{0.248777866f, 0.489209861f},
-std::array<float,2>{0.485297143f, 0.689601243f},
-std::array<float,2>{0.921206117f, 0.214363277f},
-std::array<float,2>{0.824990511f, 0.911027968f},
-std::array<float,2>{0.311621934f, 0.401260465f},
-std::array<float,2>{0.121751912f, 0.662859619f},
-std::array<float,2>{0.697651625f, 0.168412283f},
-std::array<float,2>{0.51037997f, 0.613654256f},
-std::array<float,2>{0.164915934f, 0.109519608f},
-std::array<float,2>{0.411004692f, 0.755911052f},
-std::array<float,2>{0.958272338f, 0.319991708f},
-std::array<float,2>{0.89126122f, 0.742653072f},
-std::array<float,2>{0.463248461f, 0.235578418f},
-std::array<float,2>{0.21472241f, 0.979801774f},
-std::array<float,2>{0.577671528f, 0.467599452f},
-std::array<float,2>{0.671740353f, 0.818201602f},
-std::array<float,2>{0.041588787f, 0.27581653f},
-std::array<float,2>{0.317296386f, 0.545675099f},
-std::array<float,2>{0.808354795f, 0.019106878f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.802370131f, 0.0774969831f},
-std::array<float,2>{0.0737312138f, 0.791895688f},
-std::array<float,2>{0.658921003f, 0.676377773f},
-std::array<float,2>{0.277076811f, 0.31233868f},
-std::array<float,2>{0.605151117f, 0.433808684f},
-std::array<float,2>{0.412116617f, 0.622748852f},
-std::array<float,2>{0.923602998f, 0.877694666f},
-std::array<float,2>{0.190357104f, 0.163769767f},
-std::array<float,2>{0.715074837f, 0.209295005f},
-std::array<float,2>{0.337585032f, 0.987532437f},
-std::array<float,2>{0.873905361f, 0.520097673f},
-std::array<float,2>{0.00703408057f, 0.460381806f},
-std::array<float,2>{0.992709279f, 0.354853004f},
-std::array<float,2>{0.182948783f, 0.739801168f},
-std::array<float,2>{0.516666889f, 0.823385775f},
-std::array<float,2>{0.491888911f, 0.000726944825f},
-std::array<float,2>{0.893371403f, 0.144875005f},
-std::array<float,2>{0.249746963f, 0.923579276f},
-std::array<float,2>{0.565267324f, 0.577666998f},
-std::array<float,2>{0.37929064f, 0.379874706f},
-std::array<float,2>{0.62999624f, 0.272920936f},
-std::array<float,2>{0.290588826f, 0.646712005f},
-std::array<float,2>{0.780274034f, 0.763068795f},
-std::array<float,2>{0.107935756f, 0.116857953f},
-std::array<float,2>{0.551693499f, 0.0536281802f},
-std::array<float,2>{0.440030754f, 0.86460948f},
-std::array<float,2>{0.948666394f, 0.698000371f},
-std::array<float,2>{0.140070096f, 0.323793799f},
-std::array<float,2>{0.821653247f, 0.483266443f},
-std::array<float,2>{0.0497925915f, 0.53834331f},
-std::array<float,2>{0.722556233f, 0.950743258f},
-std::array<float,2>{0.349678159f, 0.238286272f},
-std::array<float,2>{0.84750849f, 0.223424837f},
-std::array<float,2>{0.0251913797f, 0.960440934f},
-std::array<float,2>{0.698286533f, 0.548389316f},
-std::array<float,2>{0.320955753f, 0.492662042f},
-std::array<float,2>{0.511038363f, 0.336161077f},
-std::array<float,2>{0.482135653f, 0.70368731f},
-std::array<float,2>{0.976673722f, 0.846671462f},
-std::array<float,2>{0.166314453f, 0.0355241559f},
-std::array<float,2>{0.673519731f, 0.103535235f},
-std::array<float,2>{0.254783213f, 0.769508064f},
-std::array<float,2>{0.791866124f, 0.63552475f},
-std::array<float,2>{0.0859769732f, 0.253715217f},
-std::array<float,2>{0.909836471f, 0.404892176f},
-std::array<float,2>{0.205554709f, 0.586530745f},
-std::array<float,2>{0.618337154f, 0.907712162f},
-std::array<float,2>{0.424620926f, 0.129852757f},
-std::array<float,2>{0.957783043f, 0.0205371734f},
-std::array<float,2>{0.141846642f, 0.836265206f},
-std::array<float,2>{0.536441028f, 0.727841258f},
-std::array<float,2>{0.453565717f, 0.362353653f},
-std::array<float,2>{0.746749043f, 0.449410319f},
-std::array<float,2>{0.374435335f, 0.513623655f},
-std::array<float,2>{0.841839433f, 0.974991977f},
-std::array<float,2>{0.0325247012f, 0.196945637f},
-std::array<float,2>{0.583015203f, 0.181644812f},
-std::array<float,2>{0.395932853f, 0.904748857f},
-std::array<float,2>{0.887913465f, 0.601024926f},
-std::array<float,2>{0.221544012f, 0.41457209f},
-std::array<float,2>{0.764315724f, 0.292180687f},
-std::array<float,2>{0.11687275f, 0.670614481f},
-std::array<float,2>{0.649728179f, 0.810582936f},
-std::array<float,2>{0.309134692f, 0.0825788528f},
-std::array<float,2>{0.834529221f, 0.0416246839f},
-std::array<float,2>{0.0413419753f, 0.857903898f},
-std::array<float,2>{0.740582407f, 0.715160608f},
-std::array<float,2>{0.360704631f, 0.331728756f},
-std::array<float,2>{0.543589115f, 0.487827867f},
-std::array<float,2>{0.468355685f, 0.560280383f},
-std::array<float,2>{0.967914164f, 0.967067897f},
-std::array<float,2>{0.153303325f, 0.233211011f},
-std::array<float,2>{0.648389697f, 0.138790071f},
-std::array<float,2>{0.298868477f, 0.919642866f},
-std::array<float,2>{0.753627896f, 0.583394945f},
-std::array<float,2>{0.119061604f, 0.397268713f},
-std::array<float,2>{0.877428889f, 0.264580727f},
-std::array<float,2>{0.227001682f, 0.629707217f},
-std::array<float,2>{0.592336953f, 0.776005805f},
-std::array<float,2>{0.402499616f, 0.101146363f},
-std::array<float,2>{0.970764875f, 0.189054057f},
-std::array<float,2>{0.162474647f, 0.982407331f},
-std::array<float,2>{0.503960669f, 0.501764536f},
-std::array<float,2>{0.471900761f, 0.441651911f},
-std::array<float,2>{0.69261694f, 0.370755583f},
-std::array<float,2>{0.31914258f, 0.725316286f},
-std::array<float,2>{0.856393337f, 0.82863915f},
-std::array<float,2>{0.0168509334f, 0.024082277f},
-std::array<float,2>{0.61298269f, 0.0899657309f},
-std::array<float,2>{0.434534162f, 0.800513744f},
-std::array<float,2>{0.914672136f, 0.663653791f},
-std::array<float,2>{0.217502028f, 0.288683891f},
-std::array<float,2>{0.78187865f, 0.407332152f},
-std::array<float,2>{0.0812068731f, 0.607711971f},
-std::array<float,2>{0.685885191f, 0.894043505f},
-std::array<float,2>{0.259497613f, 0.173354343f},
-std::array<float,2>{0.76570648f, 0.164682105f},
-std::array<float,2>{0.0967011005f, 0.883229136f},
-std::array<float,2>{0.635493934f, 0.610251784f},
-std::array<float,2>{0.288645715f, 0.425317019f},
-std::array<float,2>{0.572643399f, 0.303058654f},
-std::array<float,2>{0.388030201f, 0.681519866f},
-std::array<float,2>{0.900480092f, 0.789048731f},
-std::array<float,2>{0.23629126f, 0.0665837079f},
-std::array<float,2>{0.727506757f, 0.0142942509f},
-std::array<float,2>{0.35777545f, 0.81638056f},
-std::array<float,2>{0.816209435f, 0.749340892f},
-std::array<float,2>{0.0604316443f, 0.346626639f},
-std::array<float,2>{0.938325822f, 0.464508206f},
-std::array<float,2>{0.132702768f, 0.525525093f},
-std::array<float,2>{0.558248341f, 0.992495418f},
-std::array<float,2>{0.450337112f, 0.212724432f},
-std::array<float,2>{0.929858625f, 0.119291499f},
-std::array<float,2>{0.195805669f, 0.751666725f},
-std::array<float,2>{0.595246375f, 0.651874483f},
-std::array<float,2>{0.417627722f, 0.278142035f},
-std::array<float,2>{0.665479004f, 0.38667804f},
-std::array<float,2>{0.272201717f, 0.564859748f},
-std::array<float,2>{0.812291622f, 0.929799736f},
-std::array<float,2>{0.0674864575f, 0.149948478f},
-std::array<float,2>{0.529167473f, 0.244314313f},
-std::array<float,2>{0.495153368f, 0.943026721f},
-std::array<float,2>{0.988431454f, 0.545598745f},
-std::array<float,2>{0.173698559f, 0.471060812f},
-std::array<float,2>{0.863282919f, 0.318552375f},
-std::array<float,2>{0.0148831131f, 0.691879451f},
-std::array<float,2>{0.70460248f, 0.867291331f},
-std::array<float,2>{0.329222322f, 0.0578377917f},
-std::array<float,2>{0.869479418f, 0.0948429704f},
-std::array<float,2>{0.00168236613f, 0.778927147f},
-std::array<float,2>{0.711879551f, 0.62683481f},
-std::array<float,2>{0.342639387f, 0.260279506f},
-std::array<float,2>{0.522453547f, 0.392278731f},
-std::array<float,2>{0.487198502f, 0.580683053f},
-std::array<float,2>{0.999458671f, 0.917942941f},
-std::array<float,2>{0.187063918f, 0.13353543f},
-std::array<float,2>{0.661961675f, 0.227906987f},
-std::array<float,2>{0.280075729f, 0.964557052f},
-std::array<float,2>{0.797660708f, 0.557303905f},
-std::array<float,2>{0.0771912038f, 0.488859951f},
-std::array<float,2>{0.926979601f, 0.335411519f},
-std::array<float,2>{0.191481352f, 0.713823438f},
-std::array<float,2>{0.608176351f, 0.8546561f},
-std::array<float,2>{0.407679141f, 0.0456605218f},
-std::array<float,2>{0.950773716f, 0.17811425f},
-std::array<float,2>{0.132945031f, 0.897372425f},
-std::array<float,2>{0.548895836f, 0.604587555f},
-std::array<float,2>{0.442829192f, 0.413876176f},
-std::array<float,2>{0.72289598f, 0.284836739f},
-std::array<float,2>{0.344314843f, 0.65815413f},
-std::array<float,2>{0.824355543f, 0.802115381f},
-std::array<float,2>{0.0529902168f, 0.0879655778f},
-std::array<float,2>{0.569929302f, 0.0287436508f},
-std::array<float,2>{0.375531048f, 0.835032403f},
-std::array<float,2>{0.896898925f, 0.722627342f},
-std::array<float,2>{0.245524198f, 0.37133494f},
-std::array<float,2>{0.776036203f, 0.440120846f},
-std::array<float,2>{0.104624532f, 0.507098317f},
-std::array<float,2>{0.626694679f, 0.978863537f},
-std::array<float,2>{0.295012534f, 0.192865446f},
-std::array<float,2>{0.794289291f, 0.216980726f},
-std::array<float,2>{0.0906324238f, 0.999843836f},
-std::array<float,2>{0.679343939f, 0.527876675f},
-std::array<float,2>{0.253420144f, 0.468070716f},
-std::array<float,2>{0.622035623f, 0.350838184f},
-std::array<float,2>{0.425941795f, 0.74508673f},
-std::array<float,2>{0.913508117f, 0.818659544f},
-std::array<float,2>{0.209304661f, 0.00805626065f},
-std::array<float,2>{0.700755775f, 0.063964799f},
-std::array<float,2>{0.325965881f, 0.783061385f},
-std::array<float,2>{0.850502133f, 0.687429428f},
-std::array<float,2>{0.0302625708f, 0.29889679f},
-std::array<float,2>{0.982966363f, 0.426686078f},
-std::array<float,2>{0.169730946f, 0.615538001f},
-std::array<float,2>{0.515113652f, 0.890160561f},
-std::array<float,2>{0.476911843f, 0.16952315f},
-std::array<float,2>{0.884106874f, 0.0612902083f},
-std::array<float,2>{0.225320578f, 0.874889433f},
-std::array<float,2>{0.581578553f, 0.688580632f},
-std::array<float,2>{0.392134458f, 0.314209163f},
-std::array<float,2>{0.653238952f, 0.476252377f},
-std::array<float,2>{0.30656898f, 0.541946888f},
-std::array<float,2>{0.760004401f, 0.939283729f},
-std::array<float,2>{0.111819245f, 0.249888301f},
-std::array<float,2>{0.532541513f, 0.153101489f},
-std::array<float,2>{0.459690481f, 0.93546778f},
-std::array<float,2>{0.953758478f, 0.569319606f},
-std::array<float,2>{0.147389874f, 0.389189601f},
-std::array<float,2>{0.836913884f, 0.274985701f},
-std::array<float,2>{0.0362252258f, 0.655976236f},
-std::array<float,2>{0.745732903f, 0.755359054f},
-std::array<float,2>{0.370684355f, 0.124232396f},
-std::array<float,2>{0.756481767f, 0.00437382888f},
-std::array<float,2>{0.124755032f, 0.826634645f},
-std::array<float,2>{0.642982423f, 0.737402856f},
-std::array<float,2>{0.301445454f, 0.358617932f},
-std::array<float,2>{0.587268531f, 0.454700083f},
-std::array<float,2>{0.401871502f, 0.518796921f},
-std::array<float,2>{0.882680655f, 0.990656376f},
-std::array<float,2>{0.231810927f, 0.20381707f},
-std::array<float,2>{0.735077202f, 0.158450395f},
-std::array<float,2>{0.365699947f, 0.879688084f},
-std::array<float,2>{0.828903556f, 0.618508577f},
-std::array<float,2>{0.0461527742f, 0.42977649f},
-std::array<float,2>{0.962165534f, 0.308152616f},
-std::array<float,2>{0.151192069f, 0.675679088f},
-std::array<float,2>{0.54244554f, 0.793052852f},
-std::array<float,2>{0.463550001f, 0.0713735744f},
-std::array<float,2>{0.918484569f, 0.238199845f},
-std::array<float,2>{0.214091182f, 0.948727131f},
-std::array<float,2>{0.615890384f, 0.532928646f},
-std::array<float,2>{0.431986451f, 0.479023397f},
-std::array<float,2>{0.679765284f, 0.326011062f},
-std::array<float,2>{0.263586193f, 0.702702761f},
-std::array<float,2>{0.788077414f, 0.862749577f},
-std::array<float,2>{0.0821277723f, 0.0496576689f},
-std::array<float,2>{0.501771688f, 0.112960175f},
-std::array<float,2>{0.474286169f, 0.760190606f},
-std::array<float,2>{0.974429131f, 0.642516255f},
-std::array<float,2>{0.157735541f, 0.26884383f},
-std::array<float,2>{0.855063796f, 0.378358543f},
-std::array<float,2>{0.019541055f, 0.574020803f},
-std::array<float,2>{0.687551677f, 0.927972615f},
-std::array<float,2>{0.313855082f, 0.144496828f},
-std::array<float,2>{0.818882704f, 0.126059905f},
-std::array<float,2>{0.0581638664f, 0.912268102f},
-std::array<float,2>{0.734107375f, 0.590186059f},
-std::array<float,2>{0.355025798f, 0.400816888f},
-std::array<float,2>{0.559814334f, 0.256590605f},
-std::array<float,2>{0.446672976f, 0.639869988f},
-std::array<float,2>{0.943956912f, 0.771769226f},
-std::array<float,2>{0.127169833f, 0.109009035f},
-std::array<float,2>{0.637358308f, 0.0331956111f},
-std::array<float,2>{0.282628149f, 0.850911736f},
-std::array<float,2>{0.772888362f, 0.709795415f},
-std::array<float,2>{0.0978871956f, 0.343399107f},
-std::array<float,2>{0.905738592f, 0.497539788f},
-std::array<float,2>{0.23976104f, 0.55131197f},
-std::array<float,2>{0.577748477f, 0.954388142f},
-std::array<float,2>{0.384292632f, 0.221360683f},
-std::array<float,2>{0.986801803f, 0.0802148357f},
-std::array<float,2>{0.17859681f, 0.807652473f},
-std::array<float,2>{0.523654819f, 0.666086853f},
-std::array<float,2>{0.496794403f, 0.296595901f},
-std::array<float,2>{0.707988143f, 0.419509888f},
-std::array<float,2>{0.33418417f, 0.595946431f},
-std::array<float,2>{0.862628162f, 0.900679171f},
-std::array<float,2>{0.00984143279f, 0.184266776f},
-std::array<float,2>{0.599522769f, 0.200562075f},
-std::array<float,2>{0.419056356f, 0.968868375f},
-std::array<float,2>{0.933786213f, 0.508634865f},
-std::array<float,2>{0.202978566f, 0.446411073f},
-std::array<float,2>{0.805256188f, 0.365679502f},
-std::array<float,2>{0.063693516f, 0.732705891f},
-std::array<float,2>{0.671468973f, 0.840844154f},
-std::array<float,2>{0.266138107f, 0.0175854061f},
-std::array<float,2>{0.779177547f, 0.114343435f},
-std::array<float,2>{0.105886556f, 0.764065385f},
-std::array<float,2>{0.632196426f, 0.646203101f},
-std::array<float,2>{0.292779148f, 0.271027118f},
-std::array<float,2>{0.563882351f, 0.381173462f},
-std::array<float,2>{0.381778657f, 0.57535392f},
-std::array<float,2>{0.892349958f, 0.924202561f},
-std::array<float,2>{0.246482581f, 0.148058027f},
-std::array<float,2>{0.719886124f, 0.241574973f},
-std::array<float,2>{0.349464059f, 0.951362908f},
-std::array<float,2>{0.823244274f, 0.536417067f},
-std::array<float,2>{0.0481965207f, 0.481824636f},
-std::array<float,2>{0.946241319f, 0.321335554f},
-std::array<float,2>{0.138419315f, 0.696376264f},
-std::array<float,2>{0.554650068f, 0.866195977f},
-std::array<float,2>{0.438229918f, 0.0515204407f},
-std::array<float,2>{0.925156415f, 0.162096664f},
-std::array<float,2>{0.188542917f, 0.876410067f},
-std::array<float,2>{0.602303088f, 0.624178112f},
-std::array<float,2>{0.411218464f, 0.436154187f},
-std::array<float,2>{0.657158792f, 0.309837639f},
-std::array<float,2>{0.273590118f, 0.678444088f},
-std::array<float,2>{0.803864837f, 0.790729642f},
-std::array<float,2>{0.0716987997f, 0.0745404586f},
-std::array<float,2>{0.518168271f, 0.00329710939f},
-std::array<float,2>{0.488630682f, 0.820681453f},
-std::array<float,2>{0.995726526f, 0.742035747f},
-std::array<float,2>{0.179705411f, 0.35337314f},
-std::array<float,2>{0.872409701f, 0.457829744f},
-std::array<float,2>{0.00422724942f, 0.522522986f},
-std::array<float,2>{0.717855036f, 0.985120773f},
-std::array<float,2>{0.338640839f, 0.207857832f},
-std::array<float,2>{0.840793669f, 0.197659567f},
-std::array<float,2>{0.0350906812f, 0.974575698f},
-std::array<float,2>{0.749388456f, 0.51400435f},
-std::array<float,2>{0.372565687f, 0.453003705f},
-std::array<float,2>{0.538580477f, 0.35942784f},
-std::array<float,2>{0.456484497f, 0.729490101f},
-std::array<float,2>{0.959064543f, 0.839052916f},
-std::array<float,2>{0.143459857f, 0.0223152824f},
-std::array<float,2>{0.651580811f, 0.0853008926f},
-std::array<float,2>{0.310771585f, 0.809060574f},
-std::array<float,2>{0.762724638f, 0.668294728f},
-std::array<float,2>{0.114143357f, 0.290361404f},
-std::array<float,2>{0.889079809f, 0.417927474f},
-std::array<float,2>{0.220298052f, 0.598099649f},
-std::array<float,2>{0.584636867f, 0.903779864f},
-std::array<float,2>{0.396731585f, 0.180730417f},
-std::array<float,2>{0.978591681f, 0.0376184136f},
-std::array<float,2>{0.165431768f, 0.84556073f},
-std::array<float,2>{0.508377314f, 0.706059396f},
-std::array<float,2>{0.484202325f, 0.33965978f},
-std::array<float,2>{0.696314454f, 0.494600475f},
-std::array<float,2>{0.322596073f, 0.550549388f},
-std::array<float,2>{0.844182611f, 0.95850271f},
-std::array<float,2>{0.0257053468f, 0.226318195f},
-std::array<float,2>{0.620103061f, 0.131638229f},
-std::array<float,2>{0.421972841f, 0.909269691f},
-std::array<float,2>{0.907792747f, 0.589223742f},
-std::array<float,2>{0.204316974f, 0.402746379f},
-std::array<float,2>{0.789126217f, 0.251158357f},
-std::array<float,2>{0.0878955275f, 0.634604871f},
-std::array<float,2>{0.67433393f, 0.765887797f},
-std::array<float,2>{0.25654611f, 0.102443337f},
-std::array<float,2>{0.858646572f, 0.0271366891f},
-std::array<float,2>{0.0193676911f, 0.83108294f},
-std::array<float,2>{0.694111466f, 0.723459363f},
-std::array<float,2>{0.316853166f, 0.367550939f},
-std::array<float,2>{0.505979419f, 0.445058793f},
-std::array<float,2>{0.4696787f, 0.50215584f},
-std::array<float,2>{0.968976438f, 0.982524157f},
-std::array<float,2>{0.160875544f, 0.191386268f},
-std::array<float,2>{0.685325623f, 0.17422387f},
-std::array<float,2>{0.261537403f, 0.892023146f},
-std::array<float,2>{0.783828616f, 0.605593741f},
-std::array<float,2>{0.079823941f, 0.408439994f},
-std::array<float,2>{0.916982234f, 0.286886126f},
-std::array<float,2>{0.215840712f, 0.661505342f},
-std::array<float,2>{0.609892488f, 0.797514915f},
-std::array<float,2>{0.436802447f, 0.0936958417f},
-std::array<float,2>{0.965871871f, 0.230777562f},
-std::array<float,2>{0.155363083f, 0.965197086f},
-std::array<float,2>{0.546137393f, 0.561458468f},
-std::array<float,2>{0.465419799f, 0.485980898f},
-std::array<float,2>{0.738821685f, 0.329050362f},
-std::array<float,2>{0.36262244f, 0.717369497f},
-std::array<float,2>{0.833693743f, 0.856553018f},
-std::array<float,2>{0.0404201709f, 0.0394219309f},
-std::array<float,2>{0.591674864f, 0.0987562239f},
-std::array<float,2>{0.405467063f, 0.775313854f},
-std::array<float,2>{0.876900136f, 0.631522f},
-std::array<float,2>{0.229877248f, 0.262945235f},
-std::array<float,2>{0.751782477f, 0.396220475f},
-std::array<float,2>{0.120261423f, 0.584058881f},
-std::array<float,2>{0.645545602f, 0.921175897f},
-std::array<float,2>{0.29736498f, 0.13832745f},
-std::array<float,2>{0.809274554f, 0.151603162f},
-std::array<float,2>{0.0693980008f, 0.932313561f},
-std::array<float,2>{0.66681242f, 0.563019514f},
-std::array<float,2>{0.271264195f, 0.382835269f},
-std::array<float,2>{0.596999824f, 0.280837059f},
-std::array<float,2>{0.415745616f, 0.649034798f},
-std::array<float,2>{0.931970894f, 0.751966178f},
-std::array<float,2>{0.197875917f, 0.118421726f},
-std::array<float,2>{0.705808938f, 0.0558292083f},
-std::array<float,2>{0.330995619f, 0.869751155f},
-std::array<float,2>{0.866522014f, 0.69507587f},
-std::array<float,2>{0.0123381615f, 0.31799379f},
-std::array<float,2>{0.992061198f, 0.46945551f},
-std::array<float,2>{0.174279749f, 0.543676198f},
-std::array<float,2>{0.529600799f, 0.944538176f},
-std::array<float,2>{0.493943423f, 0.243179247f},
-std::array<float,2>{0.900097728f, 0.0685856268f},
-std::array<float,2>{0.237116948f, 0.786274433f},
-std::array<float,2>{0.570775151f, 0.682711542f},
-std::array<float,2>{0.389275014f, 0.301745474f},
-std::array<float,2>{0.632899702f, 0.422648579f},
-std::array<float,2>{0.285367906f, 0.612225235f},
-std::array<float,2>{0.769166708f, 0.88641417f},
-std::array<float,2>{0.0956852064f, 0.167110786f},
-std::array<float,2>{0.555526733f, 0.213064313f},
-std::array<float,2>{0.452384979f, 0.994370162f},
-std::array<float,2>{0.939871728f, 0.523561478f},
-std::array<float,2>{0.130470946f, 0.462452829f},
-std::array<float,2>{0.812500238f, 0.344491094f},
-std::array<float,2>{0.0613528229f, 0.746251047f},
-std::array<float,2>{0.728647709f, 0.813873947f},
-std::array<float,2>{0.35599187f, 0.012894812f},
-std::array<float,2>{0.826858342f, 0.0873124227f},
-std::array<float,2>{0.0526226126f, 0.80467689f},
-std::array<float,2>{0.726123929f, 0.658791423f},
-std::array<float,2>{0.345838845f, 0.282372355f},
-std::array<float,2>{0.547155082f, 0.411273539f},
-std::array<float,2>{0.444221944f, 0.603138328f},
-std::array<float,2>{0.952788889f, 0.896015942f},
-std::array<float,2>{0.13599582f, 0.176228151f},
-std::array<float,2>{0.628577292f, 0.195155054f},
-std::array<float,2>{0.293418288f, 0.977835655f},
-std::array<float,2>{0.774113238f, 0.504465878f},
-std::array<float,2>{0.102131531f, 0.43886441f},
-std::array<float,2>{0.896307707f, 0.374404371f},
-std::array<float,2>{0.243482903f, 0.720290363f},
-std::array<float,2>{0.567561567f, 0.832041621f},
-std::array<float,2>{0.37847662f, 0.0302126165f},
-std::array<float,2>{0.997332036f, 0.13564229f},
-std::array<float,2>{0.185248569f, 0.914710402f},
-std::array<float,2>{0.520871758f, 0.579968154f},
-std::array<float,2>{0.484817237f, 0.392631352f},
-std::array<float,2>{0.713840902f, 0.259114057f},
-std::array<float,2>{0.341049671f, 0.628444552f},
-std::array<float,2>{0.868058741f, 0.780552506f},
-std::array<float,2>{0.00353879994f, 0.0965698436f},
-std::array<float,2>{0.606845975f, 0.0445368402f},
-std::array<float,2>{0.408834279f, 0.851938009f},
-std::array<float,2>{0.928699672f, 0.71230346f},
-std::array<float,2>{0.195293292f, 0.332265556f},
-std::array<float,2>{0.799692452f, 0.490986139f},
-std::array<float,2>{0.0748279467f, 0.555699587f},
-std::array<float,2>{0.662116826f, 0.961396337f},
-std::array<float,2>{0.27810812f, 0.229736641f},
-std::array<float,2>{0.758540928f, 0.247116491f},
-std::array<float,2>{0.110183045f, 0.941128314f},
-std::array<float,2>{0.655029655f, 0.540737689f},
-std::array<float,2>{0.307348281f, 0.474522471f},
-std::array<float,2>{0.578257501f, 0.315303534f},
-std::array<float,2>{0.394321978f, 0.689814806f},
-std::array<float,2>{0.885999262f, 0.871610343f},
-std::array<float,2>{0.222850829f, 0.0603498071f},
-std::array<float,2>{0.742939889f, 0.121913321f},
-std::array<float,2>{0.368748426f, 0.757135034f},
-std::array<float,2>{0.839153051f, 0.653354406f},
-std::array<float,2>{0.0379040539f, 0.275654227f},
-std::array<float,2>{0.955587506f, 0.387701482f},
-std::array<float,2>{0.144734621f, 0.566966355f},
-std::array<float,2>{0.534389257f, 0.936137617f},
-std::array<float,2>{0.457364023f, 0.154695883f},
-std::array<float,2>{0.911173463f, 0.0116820578f},
-std::array<float,2>{0.207226604f, 0.816855967f},
-std::array<float,2>{0.624589622f, 0.742579877f},
-std::array<float,2>{0.42790699f, 0.349425614f},
-std::array<float,2>{0.677342534f, 0.465429842f},
-std::array<float,2>{0.250968665f, 0.531025589f},
-std::array<float,2>{0.796413362f, 0.996794403f},
-std::array<float,2>{0.0925441161f, 0.215463698f},
-std::array<float,2>{0.512313426f, 0.171167225f},
-std::array<float,2>{0.479552746f, 0.888018548f},
-std::array<float,2>{0.980504394f, 0.613427699f},
-std::array<float,2>{0.171017081f, 0.428688437f},
-std::array<float,2>{0.849240124f, 0.298335046f},
-std::array<float,2>{0.0279433131f, 0.684972584f},
-std::array<float,2>{0.70242095f, 0.783853412f},
-std::array<float,2>{0.326337039f, 0.0652528256f},
-std::array<float,2>{0.786029398f, 0.0475274287f},
-std::array<float,2>{0.0845510811f, 0.859652936f},
-std::array<float,2>{0.682501316f, 0.699838042f},
-std::array<float,2>{0.264933258f, 0.327571958f},
-std::array<float,2>{0.615053356f, 0.477716506f},
-std::array<float,2>{0.430299848f, 0.533293784f},
-std::array<float,2>{0.921030939f, 0.946479976f},
-std::array<float,2>{0.211616889f, 0.235380799f},
-std::array<float,2>{0.689503491f, 0.14128764f},
-std::array<float,2>{0.314779878f, 0.926216006f},
-std::array<float,2>{0.852272987f, 0.571811497f},
-std::array<float,2>{0.0216147602f, 0.375536472f},
-std::array<float,2>{0.975302577f, 0.267220736f},
-std::array<float,2>{0.158379808f, 0.643991709f},
-std::array<float,2>{0.502740741f, 0.758116901f},
-std::array<float,2>{0.474925101f, 0.109491795f},
-std::array<float,2>{0.879428029f, 0.205682456f},
-std::array<float,2>{0.233119771f, 0.988850653f},
-std::array<float,2>{0.588141263f, 0.517473042f},
-std::array<float,2>{0.39931339f, 0.456287593f},
-std::array<float,2>{0.640760005f, 0.357406676f},
-std::array<float,2>{0.304483145f, 0.73455447f},
-std::array<float,2>{0.754597604f, 0.825605392f},
-std::array<float,2>{0.121285997f, 0.00677981507f},
-std::array<float,2>{0.540363491f, 0.0731402189f},
-std::array<float,2>{0.461983621f, 0.795470476f},
-std::array<float,2>{0.963382602f, 0.67299366f},
-std::array<float,2>{0.150238171f, 0.306271344f},
-std::array<float,2>{0.831707895f, 0.433381975f},
-std::array<float,2>{0.0447085425f, 0.620256364f},
-std::array<float,2>{0.736379325f, 0.881139874f},
-std::array<float,2>{0.364734739f, 0.157139972f},
-std::array<float,2>{0.860306621f, 0.186825007f},
-std::array<float,2>{0.00911152922f, 0.898555338f},
-std::array<float,2>{0.710740507f, 0.594128191f},
-std::array<float,2>{0.332437217f, 0.420957953f},
-std::array<float,2>{0.525626302f, 0.293811828f},
-std::array<float,2>{0.498604029f, 0.664463103f},
-std::array<float,2>{0.984811544f, 0.806002736f},
-std::array<float,2>{0.176301658f, 0.0788897723f},
-std::array<float,2>{0.668272376f, 0.0169027448f},
-std::array<float,2>{0.269508511f, 0.842571139f},
-std::array<float,2>{0.807570577f, 0.731897175f},
-std::array<float,2>{0.0654272735f, 0.36492911f},
-std::array<float,2>{0.936399043f, 0.448672444f},
-std::array<float,2>{0.20039545f, 0.511007309f},
-std::array<float,2>{0.600074291f, 0.972157121f},
-std::array<float,2>{0.420025945f, 0.202651441f},
-std::array<float,2>{0.943057597f, 0.106197596f},
-std::array<float,2>{0.125642508f, 0.771385312f},
-std::array<float,2>{0.561452568f, 0.638454556f},
-std::array<float,2>{0.447346807f, 0.255139828f},
-std::array<float,2>{0.731611192f, 0.400234073f},
-std::array<float,2>{0.351608902f, 0.593141735f},
-std::array<float,2>{0.816832244f, 0.911867619f},
-std::array<float,2>{0.0562277697f, 0.127590299f},
-std::array<float,2>{0.576120675f, 0.219527334f},
-std::array<float,2>{0.384967208f, 0.956501722f},
-std::array<float,2>{0.902389467f, 0.554211915f},
-std::array<float,2>{0.241727442f, 0.499154449f},
-std::array<float,2>{0.769881129f, 0.340504676f},
-std::array<float,2>{0.100746073f, 0.707495689f},
-std::array<float,2>{0.639491439f, 0.847673655f},
-std::array<float,2>{0.284814894f, 0.0347432978f},
-std::array<float,2>{0.792553186f, 0.102938004f},
-std::array<float,2>{0.0873457566f, 0.767034948f},
-std::array<float,2>{0.671987951f, 0.632984698f},
-std::array<float,2>{0.255106151f, 0.250436723f},
-std::array<float,2>{0.618103683f, 0.403662115f},
-std::array<float,2>{0.425192684f, 0.588024259f},
-std::array<float,2>{0.9083938f, 0.908880115f},
-std::array<float,2>{0.206645846f, 0.132569656f},
-std::array<float,2>{0.697746038f, 0.224871755f},
-std::array<float,2>{0.321299642f, 0.957958281f},
-std::array<float,2>{0.845838726f, 0.549287498f},
-std::array<float,2>{0.0239150431f, 0.495613605f},
-std::array<float,2>{0.977609634f, 0.338637322f},
-std::array<float,2>{0.167634889f, 0.705816388f},
-std::array<float,2>{0.509843528f, 0.844702542f},
-std::array<float,2>{0.480555862f, 0.0386128165f},
-std::array<float,2>{0.887482226f, 0.180391878f},
-std::array<float,2>{0.22190991f, 0.902464986f},
-std::array<float,2>{0.583005667f, 0.599312365f},
-std::array<float,2>{0.394886672f, 0.416411132f},
-std::array<float,2>{0.649364412f, 0.289345622f},
-std::array<float,2>{0.309941262f, 0.669810236f},
-std::array<float,2>{0.764912605f, 0.810014784f},
-std::array<float,2>{0.115630053f, 0.0841031149f},
-std::array<float,2>{0.535457671f, 0.0230992958f},
-std::array<float,2>{0.455019921f, 0.838656306f},
-std::array<float,2>{0.958980083f, 0.729615986f},
-std::array<float,2>{0.140666008f, 0.36085245f},
-std::array<float,2>{0.843489408f, 0.451500893f},
-std::array<float,2>{0.0322037525f, 0.515605211f},
-std::array<float,2>{0.747698307f, 0.972711086f},
-std::array<float,2>{0.3736597f, 0.198758438f},
-std::array<float,2>{0.874294341f, 0.208387345f},
-std::array<float,2>{0.00659400644f, 0.985357165f},
-std::array<float,2>{0.716020048f, 0.521566033f},
-std::array<float,2>{0.33607021f, 0.458258063f},
-std::array<float,2>{0.516373813f, 0.352262706f},
-std::array<float,2>{0.490822405f, 0.740632236f},
-std::array<float,2>{0.993857443f, 0.821544647f},
-std::array<float,2>{0.181729808f, 0.00257599819f},
-std::array<float,2>{0.659299374f, 0.0759098232f},
-std::array<float,2>{0.275413364f, 0.789557457f},
-std::array<float,2>{0.801733196f, 0.678789198f},
-std::array<float,2>{0.0726120248f, 0.309101075f},
-std::array<float,2>{0.922500193f, 0.43668884f},
-std::array<float,2>{0.19120653f, 0.623361111f},
-std::array<float,2>{0.603545964f, 0.875703931f},
-std::array<float,2>{0.413954079f, 0.160975873f},
-std::array<float,2>{0.947744012f, 0.0526452772f},
-std::array<float,2>{0.138710365f, 0.866403639f},
-std::array<float,2>{0.551994264f, 0.696050823f},
-std::array<float,2>{0.440929651f, 0.321261078f},
-std::array<float,2>{0.721392572f, 0.480793536f},
-std::array<float,2>{0.351550668f, 0.535287499f},
-std::array<float,2>{0.820779681f, 0.952912807f},
-std::array<float,2>{0.0502947085f, 0.240888894f},
-std::array<float,2>{0.565610588f, 0.147399902f},
-std::array<float,2>{0.380503535f, 0.924908876f},
-std::array<float,2>{0.894323647f, 0.575006485f},
-std::array<float,2>{0.248191744f, 0.382194161f},
-std::array<float,2>{0.77961129f, 0.269797146f},
-std::array<float,2>{0.108810283f, 0.64461863f},
-std::array<float,2>{0.629395664f, 0.765089989f},
-std::array<float,2>{0.289878756f, 0.11344438f},
-std::array<float,2>{0.814872265f, 0.0125378044f},
-std::array<float,2>{0.0587462001f, 0.813462794f},
-std::array<float,2>{0.727880836f, 0.74756968f},
-std::array<float,2>{0.359084159f, 0.34490481f},
-std::array<float,2>{0.557068229f, 0.461226463f},
-std::array<float,2>{0.449793488f, 0.524456382f},
-std::array<float,2>{0.938617349f, 0.996079922f},
-std::array<float,2>{0.131328002f, 0.213896006f},
-std::array<float,2>{0.635903239f, 0.166769236f},
-std::array<float,2>{0.287444443f, 0.884916484f},
-std::array<float,2>{0.766751289f, 0.612983584f},
-std::array<float,2>{0.0964213088f, 0.422875434f},
-std::array<float,2>{0.90155375f, 0.302670538f},
-std::array<float,2>{0.234658673f, 0.682548642f},
-std::array<float,2>{0.57338053f, 0.785673678f},
-std::array<float,2>{0.387154728f, 0.0701294541f},
-std::array<float,2>{0.990034282f, 0.243075982f},
-std::array<float,2>{0.171947584f, 0.943472564f},
-std::array<float,2>{0.528184712f, 0.54440403f},
-std::array<float,2>{0.494609982f, 0.469837397f},
-std::array<float,2>{0.703644276f, 0.3172144f},
-std::array<float,2>{0.328435987f, 0.694328785f},
-std::array<float,2>{0.865198672f, 0.87023896f},
-std::array<float,2>{0.0143676838f, 0.0552566126f},
-std::array<float,2>{0.593801856f, 0.117975242f},
-std::array<float,2>{0.416966051f, 0.753402293f},
-std::array<float,2>{0.930764377f, 0.649755716f},
-std::array<float,2>{0.197224751f, 0.280183405f},
-std::array<float,2>{0.811222553f, 0.384081215f},
-std::array<float,2>{0.0672239512f, 0.563755095f},
-std::array<float,2>{0.664784074f, 0.933305323f},
-std::array<float,2>{0.273284674f, 0.15120928f},
-std::array<float,2>{0.752449334f, 0.137445569f},
-std::array<float,2>{0.118081085f, 0.920809984f},
-std::array<float,2>{0.647443354f, 0.585818708f},
-std::array<float,2>{0.30000326f, 0.395249277f},
-std::array<float,2>{0.593249798f, 0.262072057f},
-std::array<float,2>{0.40389055f, 0.632585645f},
-std::array<float,2>{0.878148019f, 0.774297416f},
-std::array<float,2>{0.227993727f, 0.0982828811f},
-std::array<float,2>{0.741811872f, 0.0404655151f},
-std::array<float,2>{0.36003834f, 0.856040716f},
-std::array<float,2>{0.835801899f, 0.718450546f},
-std::array<float,2>{0.042542886f, 0.329924583f},
-std::array<float,2>{0.967000186f, 0.484461844f},
-std::array<float,2>{0.153504133f, 0.562440217f},
-std::array<float,2>{0.544423342f, 0.966409326f},
-std::array<float,2>{0.467585444f, 0.232075185f},
-std::array<float,2>{0.915425777f, 0.0924679488f},
-std::array<float,2>{0.217887014f, 0.798001349f},
-std::array<float,2>{0.612207711f, 0.660337269f},
-std::array<float,2>{0.435072243f, 0.285652101f},
-std::array<float,2>{0.687305868f, 0.409539223f},
-std::array<float,2>{0.258482754f, 0.606569767f},
-std::array<float,2>{0.782268345f, 0.891577542f},
-std::array<float,2>{0.0803111121f, 0.175293043f},
-std::array<float,2>{0.504982054f, 0.189544976f},
-std::array<float,2>{0.471441716f, 0.9840011f},
-std::array<float,2>{0.97217232f, 0.503231585f},
-std::array<float,2>{0.163722351f, 0.443392992f},
-std::array<float,2>{0.857407033f, 0.368690878f},
-std::array<float,2>{0.0164069105f, 0.723948002f},
-std::array<float,2>{0.691599905f, 0.830382824f},
-std::array<float,2>{0.320158362f, 0.0261800047f},
-std::array<float,2>{0.851109385f, 0.0659883246f},
-std::array<float,2>{0.0306883287f, 0.784830153f},
-std::array<float,2>{0.699354649f, 0.684388101f},
-std::array<float,2>{0.32481584f, 0.297603816f},
-std::array<float,2>{0.513792992f, 0.429088145f},
-std::array<float,2>{0.478085697f, 0.614643037f},
-std::array<float,2>{0.983923435f, 0.887258053f},
-std::array<float,2>{0.168446481f, 0.170510754f},
-std::array<float,2>{0.677838206f, 0.216791809f},
-std::array<float,2>{0.251978368f, 0.997243702f},
-std::array<float,2>{0.793443382f, 0.529779732f},
-std::array<float,2>{0.0912354365f, 0.466108531f},
-std::array<float,2>{0.912657976f, 0.347767383f},
-std::array<float,2>{0.210923776f, 0.743353188f},
-std::array<float,2>{0.622988045f, 0.817784131f},
-std::array<float,2>{0.427597106f, 0.0104841646f},
-std::array<float,2>{0.955056965f, 0.155775368f},
-std::array<float,2>{0.147744983f, 0.937425852f},
-std::array<float,2>{0.531453967f, 0.567605853f},
-std::array<float,2>{0.46062392f, 0.387464106f},
-std::array<float,2>{0.744556129f, 0.276632637f},
-std::array<float,2>{0.369239062f, 0.652422488f},
-std::array<float,2>{0.837718666f, 0.756584942f},
-std::array<float,2>{0.0353842154f, 0.122277983f},
-std::array<float,2>{0.580434501f, 0.0595115311f},
-std::array<float,2>{0.391542375f, 0.872938275f},
-std::array<float,2>{0.882927477f, 0.690478683f},
-std::array<float,2>{0.225913838f, 0.315858126f},
-std::array<float,2>{0.761080801f, 0.472901702f},
-std::array<float,2>{0.1124155f, 0.540019691f},
-std::array<float,2>{0.653683186f, 0.939455509f},
-std::array<float,2>{0.30540663f, 0.246122435f},
-std::array<float,2>{0.798134267f, 0.228598759f},
-std::array<float,2>{0.0763664469f, 0.961978495f},
-std::array<float,2>{0.660289943f, 0.555605412f},
-std::array<float,2>{0.280451685f, 0.491671592f},
-std::array<float,2>{0.608522952f, 0.333858877f},
-std::array<float,2>{0.407170743f, 0.711698055f},
-std::array<float,2>{0.926402748f, 0.852725029f},
-std::array<float,2>{0.19283013f, 0.0436652526f},
-std::array<float,2>{0.712492287f, 0.0973303393f},
-std::array<float,2>{0.343519568f, 0.780256689f},
-std::array<float,2>{0.87027657f, 0.627016306f},
-std::array<float,2>{0.000848764554f, 0.258227259f},
-std::array<float,2>{0.998455644f, 0.393624902f},
-std::array<float,2>{0.185951918f, 0.578559458f},
-std::array<float,2>{0.52319926f, 0.915830135f},
-std::array<float,2>{0.488110036f, 0.135975555f},
-std::array<float,2>{0.897728622f, 0.0307883397f},
-std::array<float,2>{0.24452281f, 0.833488166f},
-std::array<float,2>{0.568689227f, 0.718775988f},
-std::array<float,2>{0.376109034f, 0.373777449f},
-std::array<float,2>{0.625077844f, 0.438382417f},
-std::array<float,2>{0.296781987f, 0.505828381f},
-std::array<float,2>{0.776474953f, 0.977478921f},
-std::array<float,2>{0.104478166f, 0.194290712f},
-std::array<float,2>{0.550491154f, 0.17741552f},
-std::array<float,2>{0.442347586f, 0.895102262f},
-std::array<float,2>{0.949979722f, 0.602463782f},
-std::array<float,2>{0.134431809f, 0.410526246f},
-std::array<float,2>{0.825835884f, 0.281410575f},
-std::array<float,2>{0.0537639223f, 0.659303844f},
-std::array<float,2>{0.723823965f, 0.803454697f},
-std::array<float,2>{0.345057815f, 0.0863747448f},
-std::array<float,2>{0.771751344f, 0.0337409936f},
-std::array<float,2>{0.0988794714f, 0.849020243f},
-std::array<float,2>{0.638450801f, 0.708182573f},
-std::array<float,2>{0.282014042f, 0.340846688f},
-std::array<float,2>{0.576779664f, 0.498753786f},
-std::array<float,2>{0.383261651f, 0.553032935f},
-std::array<float,2>{0.904891372f, 0.955216408f},
-std::array<float,2>{0.238865957f, 0.220269978f},
-std::array<float,2>{0.732567847f, 0.128634706f},
-std::array<float,2>{0.354312748f, 0.910400093f},
-std::array<float,2>{0.819875538f, 0.592208326f},
-std::array<float,2>{0.0571851134f, 0.39873895f},
-std::array<float,2>{0.94472605f, 0.254508734f},
-std::array<float,2>{0.128264025f, 0.637246609f},
-std::array<float,2>{0.559484661f, 0.770251513f},
-std::array<float,2>{0.445661306f, 0.10668616f},
-std::array<float,2>{0.934878528f, 0.201929167f},
-std::array<float,2>{0.201452956f, 0.970884204f},
-std::array<float,2>{0.598167717f, 0.510340929f},
-std::array<float,2>{0.418121785f, 0.447324574f},
-std::array<float,2>{0.670670688f, 0.364136398f},
-std::array<float,2>{0.266678333f, 0.731338739f},
-std::array<float,2>{0.805710018f, 0.843592763f},
-std::array<float,2>{0.06324853f, 0.0157713313f},
-std::array<float,2>{0.524676204f, 0.0792672783f},
-std::array<float,2>{0.497150987f, 0.80541122f},
-std::array<float,2>{0.987765551f, 0.665589392f},
-std::array<float,2>{0.179094896f, 0.294681013f},
-std::array<float,2>{0.861826301f, 0.419947594f},
-std::array<float,2>{0.0108426381f, 0.595064402f},
-std::array<float,2>{0.70823127f, 0.899770319f},
-std::array<float,2>{0.335620999f, 0.18637225f},
-std::array<float,2>{0.829774678f, 0.15728876f},
-std::array<float,2>{0.0455274992f, 0.882641971f},
-std::array<float,2>{0.735979378f, 0.619669795f},
-std::array<float,2>{0.366273224f, 0.43165195f},
-std::array<float,2>{0.541168571f, 0.305550009f},
-std::array<float,2>{0.463870496f, 0.6727795f},
-std::array<float,2>{0.96170187f, 0.796015561f},
-std::array<float,2>{0.1519299f, 0.0742124543f},
-std::array<float,2>{0.644138992f, 0.00710529555f},
-std::array<float,2>{0.301858515f, 0.824680269f},
-std::array<float,2>{0.757287502f, 0.736288846f},
-std::array<float,2>{0.123418748f, 0.355615854f},
-std::array<float,2>{0.88169235f, 0.455985963f},
-std::array<float,2>{0.231387496f, 0.516237259f},
-std::array<float,2>{0.586042047f, 0.989548862f},
-std::array<float,2>{0.400916725f, 0.206909284f},
-std::array<float,2>{0.973628163f, 0.111080639f},
-std::array<float,2>{0.156790391f, 0.758818626f},
-std::array<float,2>{0.500643015f, 0.64270997f},
-std::array<float,2>{0.472995311f, 0.265746713f},
-std::array<float,2>{0.688988924f, 0.376543164f},
-std::array<float,2>{0.312950075f, 0.570934892f},
-std::array<float,2>{0.853947639f, 0.927706838f},
-std::array<float,2>{0.0213705823f, 0.141850293f},
-std::array<float,2>{0.617031574f, 0.234934166f},
-std::array<float,2>{0.43269363f, 0.94608289f},
-std::array<float,2>{0.919442952f, 0.534485757f},
-std::array<float,2>{0.213408619f, 0.477309257f},
-std::array<float,2>{0.78837502f, 0.326452523f},
-std::array<float,2>{0.0834472552f, 0.700580955f},
-std::array<float,2>{0.681268513f, 0.860558689f},
-std::array<float,2>{0.261985898f, 0.0481026396f},
-std::array<float,2>{0.762561798f, 0.083634682f},
-std::array<float,2>{0.1152201f, 0.812379777f},
-std::array<float,2>{0.650879979f, 0.671760857f},
-std::array<float,2>{0.312198102f, 0.29161337f},
-std::array<float,2>{0.585821927f, 0.415248007f},
-std::array<float,2>{0.397960156f, 0.600551069f},
-std::array<float,2>{0.889974058f, 0.905644417f},
-std::array<float,2>{0.219131693f, 0.183068067f},
-std::array<float,2>{0.748732686f, 0.195910007f},
-std::array<float,2>{0.371374577f, 0.976126611f},
-std::array<float,2>{0.841015995f, 0.512453318f},
-std::array<float,2>{0.0340632387f, 0.450942904f},
-std::array<float,2>{0.960247278f, 0.361769438f},
-std::array<float,2>{0.143773183f, 0.727484941f},
-std::array<float,2>{0.538057327f, 0.83741039f},
-std::array<float,2>{0.455155313f, 0.0198467802f},
-std::array<float,2>{0.906995237f, 0.13018702f},
-std::array<float,2>{0.203919843f, 0.906890333f},
-std::array<float,2>{0.620294213f, 0.587847233f},
-std::array<float,2>{0.423488766f, 0.406154245f},
-std::array<float,2>{0.674891293f, 0.252874523f},
-std::array<float,2>{0.257536441f, 0.636236131f},
-std::array<float,2>{0.790374398f, 0.768546045f},
-std::array<float,2>{0.0889403597f, 0.104711249f},
-std::array<float,2>{0.509587944f, 0.0365800932f},
-std::array<float,2>{0.482554257f, 0.847415328f},
-std::array<float,2>{0.980433941f, 0.70430541f},
-std::array<float,2>{0.164062828f, 0.337046832f},
-std::array<float,2>{0.844909847f, 0.493179649f},
-std::array<float,2>{0.0271052476f, 0.547147572f},
-std::array<float,2>{0.69540906f, 0.95937252f},
-std::array<float,2>{0.324022025f, 0.224470779f},
-std::array<float,2>{0.822563291f, 0.239754453f},
-std::array<float,2>{0.0474102758f, 0.949827552f},
-std::array<float,2>{0.719689965f, 0.537838101f},
-std::array<float,2>{0.348029554f, 0.484171748f},
-std::array<float,2>{0.553380668f, 0.32281065f},
-std::array<float,2>{0.43921411f, 0.698394954f},
-std::array<float,2>{0.947144806f, 0.863314867f},
-std::array<float,2>{0.136725157f, 0.0541716665f},
-std::array<float,2>{0.631755948f, 0.115242951f},
-std::array<float,2>{0.291475832f, 0.762575746f},
-std::array<float,2>{0.778035045f, 0.6482535f},
-std::array<float,2>{0.106876731f, 0.272395521f},
-std::array<float,2>{0.890710354f, 0.380234987f},
-std::array<float,2>{0.24771969f, 0.576475263f},
-std::array<float,2>{0.562957466f, 0.922772765f},
-std::array<float,2>{0.381922185f, 0.146432847f},
-std::array<float,2>{0.994855881f, 0.00143281289f},
-std::array<float,2>{0.18135576f, 0.8230021f},
-std::array<float,2>{0.519127071f, 0.738511264f},
-std::array<float,2>{0.489981055f, 0.353631258f},
-std::array<float,2>{0.717234313f, 0.459608495f},
-std::array<float,2>{0.339347631f, 0.520635486f},
-std::array<float,2>{0.871810913f, 0.986969233f},
-std::array<float,2>{0.0049004294f, 0.210415766f},
-std::array<float,2>{0.602997839f, 0.162757784f},
-std::array<float,2>{0.41068393f, 0.878106952f},
-std::array<float,2>{0.92446208f, 0.621627152f},
-std::array<float,2>{0.188057572f, 0.434616685f},
-std::array<float,2>{0.803628623f, 0.311204344f},
-std::array<float,2>{0.0706149414f, 0.677641809f},
-std::array<float,2>{0.657499909f, 0.792734742f},
-std::array<float,2>{0.274833232f, 0.0762249976f},
-std::array<float,2>{0.866181016f, 0.0567505062f},
-std::array<float,2>{0.0130693223f, 0.868547499f},
-std::array<float,2>{0.706389129f, 0.692724228f},
-std::array<float,2>{0.331629694f, 0.319971085f},
-std::array<float,2>{0.531228602f, 0.472333014f},
-std::array<float,2>{0.492964029f, 0.545980632f},
-std::array<float,2>{0.990998685f, 0.941764832f},
-std::array<float,2>{0.175129756f, 0.246011481f},
-std::array<float,2>{0.667684138f, 0.14871943f},
-std::array<float,2>{0.269610375f, 0.930984795f},
-std::array<float,2>{0.809794843f, 0.565748394f},
-std::array<float,2>{0.0690335408f, 0.385570526f},
-std::array<float,2>{0.932831645f, 0.279236406f},
-std::array<float,2>{0.198556393f, 0.651197612f},
-std::array<float,2>{0.596606791f, 0.750728786f},
-std::array<float,2>{0.414929807f, 0.120326795f},
-std::array<float,2>{0.940690696f, 0.211114377f},
-std::array<float,2>{0.129099831f, 0.993929088f},
-std::array<float,2>{0.556455195f, 0.527080297f},
-std::array<float,2>{0.451388627f, 0.463363141f},
-std::array<float,2>{0.729609907f, 0.347614974f},
-std::array<float,2>{0.356619418f, 0.748614669f},
-std::array<float,2>{0.813509881f, 0.815270424f},
-std::array<float,2>{0.0615605563f, 0.0154837547f},
-std::array<float,2>{0.571559131f, 0.068061702f},
-std::array<float,2>{0.390460938f, 0.787623227f},
-std::array<float,2>{0.899300456f, 0.679990709f},
-std::array<float,2>{0.237477124f, 0.304200172f},
-std::array<float,2>{0.767881572f, 0.424726695f},
-std::array<float,2>{0.094135277f, 0.610381842f},
-std::array<float,2>{0.634500384f, 0.884135067f},
-std::array<float,2>{0.286842495f, 0.165489092f},
-std::array<float,2>{0.784259856f, 0.172704309f},
-std::array<float,2>{0.0785625651f, 0.893079519f},
-std::array<float,2>{0.684342384f, 0.609320998f},
-std::array<float,2>{0.259860843f, 0.406261504f},
-std::array<float,2>{0.611288905f, 0.28737396f},
-std::array<float,2>{0.435748637f, 0.662427306f},
-std::array<float,2>{0.917482197f, 0.799797475f},
-std::array<float,2>{0.215038404f, 0.0913409069f},
-std::array<float,2>{0.695214391f, 0.0252953917f},
-std::array<float,2>{0.318167269f, 0.829409957f},
-std::array<float,2>{0.85831362f, 0.726149261f},
-std::array<float,2>{0.018507475f, 0.369174451f},
-std::array<float,2>{0.969793081f, 0.443344265f},
-std::array<float,2>{0.161917657f, 0.500083029f},
-std::array<float,2>{0.507547617f, 0.981301308f},
-std::array<float,2>{0.469870239f, 0.188309476f},
-std::array<float,2>{0.875871837f, 0.100579105f},
-std::array<float,2>{0.229425967f, 0.777145088f},
-std::array<float,2>{0.590298116f, 0.630487621f},
-std::array<float,2>{0.404360652f, 0.265498668f},
-std::array<float,2>{0.645056605f, 0.397546142f},
-std::array<float,2>{0.29870981f, 0.582326174f},
-std::array<float,2>{0.750714302f, 0.918685496f},
-std::array<float,2>{0.119632296f, 0.140573099f},
-std::array<float,2>{0.545815051f, 0.234322295f},
-std::array<float,2>{0.466202021f, 0.968655825f},
-std::array<float,2>{0.965425968f, 0.558646083f},
-std::array<float,2>{0.154458448f, 0.486583382f},
-std::array<float,2>{0.832422614f, 0.330803394f},
-std::array<float,2>{0.0393298343f, 0.716795623f},
-std::array<float,2>{0.73940599f, 0.859108031f},
-std::array<float,2>{0.36145407f, 0.0421204045f},
-std::array<float,2>{0.838835716f, 0.123622581f},
-std::array<float,2>{0.038803421f, 0.754588604f},
-std::array<float,2>{0.744025469f, 0.65523541f},
-std::array<float,2>{0.367469519f, 0.274370164f},
-std::array<float,2>{0.533863068f, 0.39022845f},
-std::array<float,2>{0.458528072f, 0.569752276f},
-std::array<float,2>{0.956866205f, 0.933709919f},
-std::array<float,2>{0.146384761f, 0.153516412f},
-std::array<float,2>{0.655861676f, 0.24852404f},
-std::array<float,2>{0.307955831f, 0.938312531f},
-std::array<float,2>{0.75921315f, 0.5419963f},
-std::array<float,2>{0.110422634f, 0.47552228f},
-std::array<float,2>{0.885104477f, 0.312948257f},
-std::array<float,2>{0.224123865f, 0.687722921f},
-std::array<float,2>{0.579620838f, 0.873134494f},
-std::array<float,2>{0.393384904f, 0.0622985549f},
-std::array<float,2>{0.982209206f, 0.168846548f},
-std::array<float,2>{0.170842767f, 0.889136493f},
-std::array<float,2>{0.513622642f, 0.616683483f},
-std::array<float,2>{0.479115546f, 0.427117795f},
-std::array<float,2>{0.701620996f, 0.300203383f},
-std::array<float,2>{0.32778123f, 0.685606062f},
-std::array<float,2>{0.848391235f, 0.782084584f},
-std::array<float,2>{0.0289385039f, 0.0629143864f},
-std::array<float,2>{0.623067319f, 0.00931132305f},
-std::array<float,2>{0.429092079f, 0.819913268f},
-std::array<float,2>{0.910295963f, 0.745740175f},
-std::array<float,2>{0.208274335f, 0.349945247f},
-std::array<float,2>{0.795773447f, 0.467111588f},
-std::array<float,2>{0.0937313586f, 0.529250085f},
-std::array<float,2>{0.676016748f, 0.99852562f},
-std::array<float,2>{0.251264036f, 0.218209252f},
-std::array<float,2>{0.775216281f, 0.19164288f},
-std::array<float,2>{0.102836117f, 0.980071187f},
-std::array<float,2>{0.627482295f, 0.506026685f},
-std::array<float,2>{0.294300199f, 0.440593392f},
-std::array<float,2>{0.566823483f, 0.372732222f},
-std::array<float,2>{0.377313733f, 0.721394062f},
-std::array<float,2>{0.895121753f, 0.83427912f},
-std::array<float,2>{0.242971003f, 0.0274391733f},
-std::array<float,2>{0.725356936f, 0.0890831724f},
-std::array<float,2>{0.34708479f, 0.801245987f},
-std::array<float,2>{0.827646554f, 0.656620264f},
-std::array<float,2>{0.0513556451f, 0.283391416f},
-std::array<float,2>{0.951895475f, 0.413023323f},
-std::array<float,2>{0.135216296f, 0.603861988f},
-std::array<float,2>{0.54876405f, 0.897552788f},
-std::array<float,2>{0.444856018f, 0.178799659f},
-std::array<float,2>{0.929309666f, 0.0466986857f},
-std::array<float,2>{0.193725616f, 0.853878379f},
-std::array<float,2>{0.606186926f, 0.714442253f},
-std::array<float,2>{0.409956127f, 0.334543526f},
-std::array<float,2>{0.664041877f, 0.48929897f},
-std::array<float,2>{0.278481513f, 0.557641804f},
-std::array<float,2>{0.800100625f, 0.963414013f},
-std::array<float,2>{0.0758319646f, 0.227423385f},
-std::array<float,2>{0.519825757f, 0.134443462f},
-std::array<float,2>{0.485705674f, 0.916750669f},
-std::array<float,2>{0.996455491f, 0.581355512f},
-std::array<float,2>{0.184032395f, 0.390987337f},
-std::array<float,2>{0.868693709f, 0.261667341f},
-std::array<float,2>{0.00264931982f, 0.625350952f},
-std::array<float,2>{0.714811027f, 0.777460337f},
-std::array<float,2>{0.340069681f, 0.0942439213f},
-std::array<float,2>{0.807643354f, 0.018607052f},
-std::array<float,2>{0.0657368824f, 0.840358615f},
-std::array<float,2>{0.669774771f, 0.733987331f},
-std::array<float,2>{0.267796218f, 0.366303951f},
-std::array<float,2>{0.60100317f, 0.446121633f},
-std::array<float,2>{0.421460688f, 0.509363651f},
-std::array<float,2>{0.936814725f, 0.97021389f},
-std::array<float,2>{0.199460939f, 0.200029999f},
-std::array<float,2>{0.709508061f, 0.18509306f},
-std::array<float,2>{0.333758563f, 0.901634395f},
-std::array<float,2>{0.86065954f, 0.596758187f},
-std::array<float,2>{0.00858040992f, 0.418061465f},
-std::array<float,2>{0.986309409f, 0.295020849f},
-std::array<float,2>{0.177322745f, 0.667883873f},
-std::array<float,2>{0.52729553f, 0.806935847f},
-std::array<float,2>{0.499965817f, 0.0815980509f},
-std::array<float,2>{0.903328061f, 0.22225897f},
-std::array<float,2>{0.240712732f, 0.953462839f},
-std::array<float,2>{0.574924588f, 0.552071691f},
-std::array<float,2>{0.38670364f, 0.496912897f},
-std::array<float,2>{0.640625f, 0.342252761f},
-std::array<float,2>{0.284106612f, 0.710530341f},
-std::array<float,2>{0.770944774f, 0.849618375f},
-std::array<float,2>{0.10042882f, 0.0315103531f},
-std::array<float,2>{0.561943412f, 0.107649654f},
-std::array<float,2>{0.448491782f, 0.773356378f},
-std::array<float,2>{0.941737831f, 0.639436126f},
-std::array<float,2>{0.126228198f, 0.257156819f},
-std::array<float,2>{0.818144858f, 0.401888043f},
-std::array<float,2>{0.055163838f, 0.591019988f},
-std::array<float,2>{0.73084563f, 0.913910389f},
-std::array<float,2>{0.3530159f, 0.125157043f},
-std::array<float,2>{0.852567792f, 0.142787263f},
-std::array<float,2>{0.0229526479f, 0.928953707f},
-std::array<float,2>{0.690530419f, 0.572505295f},
-std::array<float,2>{0.316253603f, 0.377469897f},
-std::array<float,2>{0.503073514f, 0.268086284f},
-std::array<float,2>{0.476273537f, 0.640951872f},
-std::array<float,2>{0.975880861f, 0.761107862f},
-std::array<float,2>{0.160073489f, 0.1115226f},
-std::array<float,2>{0.6835199f, 0.0503423512f},
-std::array<float,2>{0.263924807f, 0.861499548f},
-std::array<float,2>{0.786892533f, 0.701878607f},
-std::array<float,2>{0.0850419924f, 0.325077325f},
-std::array<float,2>{0.920864582f, 0.480108619f},
-std::array<float,2>{0.212823272f, 0.532193542f},
-std::array<float,2>{0.61418885f, 0.948119819f},
-std::array<float,2>{0.431485623f, 0.237282306f},
-std::array<float,2>{0.964056611f, 0.0711328909f},
-std::array<float,2>{0.149306178f, 0.794676185f},
-std::array<float,2>{0.539890647f, 0.674657166f},
-std::array<float,2>{0.461524904f, 0.306955338f},
-std::array<float,2>{0.737424254f, 0.431404501f},
-std::array<float,2>{0.363447279f, 0.617872953f},
-std::array<float,2>{0.830689549f, 0.879893064f},
-std::array<float,2>{0.0438623168f, 0.159835353f},
-std::array<float,2>{0.589364648f, 0.20419015f},
-std::array<float,2>{0.399584293f, 0.991718769f},
-std::array<float,2>{0.879970849f, 0.517989457f},
-std::array<float,2>{0.23388648f, 0.453644305f},
-std::array<float,2>{0.755012333f, 0.35751307f},
-std::array<float,2>{0.122338891f, 0.73634392f},
-std::array<float,2>{0.642517924f, 0.827621698f},
-std::array<float,2>{0.303429097f, 0.00496057887f},
-std::array<float,2>{0.783090055f, 0.0911737755f},
-std::array<float,2>{0.0807635933f, 0.799041688f},
-std::array<float,2>{0.686896563f, 0.66301614f},
-std::array<float,2>{0.257875592f, 0.287868828f},
-std::array<float,2>{0.611517012f, 0.407141149f},
-std::array<float,2>{0.434663177f, 0.608561933f},
-std::array<float,2>{0.915539145f, 0.892856598f},
-std::array<float,2>{0.218496725f, 0.172183737f},
-std::array<float,2>{0.692070186f, 0.187535927f},
-std::array<float,2>{0.31945315f, 0.980720818f},
-std::array<float,2>{0.85691756f, 0.500744998f},
-std::array<float,2>{0.0158248078f, 0.442424417f},
-std::array<float,2>{0.971931934f, 0.370013595f},
-std::array<float,2>{0.163220331f, 0.725736439f},
-std::array<float,2>{0.505696535f, 0.829762876f},
-std::array<float,2>{0.470727652f, 0.0248589665f},
-std::array<float,2>{0.878845215f, 0.139915302f},
-std::array<float,2>{0.228238836f, 0.918241918f},
-std::array<float,2>{0.593290746f, 0.582831383f},
-std::array<float,2>{0.40350461f, 0.398164868f},
-std::array<float,2>{0.646576464f, 0.264768034f},
-std::array<float,2>{0.300417304f, 0.630272686f},
-std::array<float,2>{0.75227797f, 0.77637887f},
-std::array<float,2>{0.117598742f, 0.0996169001f},
-std::array<float,2>{0.54490006f, 0.0427514836f},
-std::array<float,2>{0.466976166f, 0.858580828f},
-std::array<float,2>{0.967498183f, 0.715994537f},
-std::array<float,2>{0.153965086f, 0.330399662f},
-std::array<float,2>{0.835396945f, 0.486955464f},
-std::array<float,2>{0.0421423875f, 0.559105396f},
-std::array<float,2>{0.7413463f, 0.96825242f},
-std::array<float,2>{0.359726399f, 0.233670384f},
-std::array<float,2>{0.864276469f, 0.245302811f},
-std::array<float,2>{0.013999871f, 0.94216311f},
-std::array<float,2>{0.703586459f, 0.546403408f},
-std::array<float,2>{0.328778416f, 0.471987575f},
-std::array<float,2>{0.527588308f, 0.319357574f},
-std::array<float,2>{0.494786471f, 0.693206429f},
-std::array<float,2>{0.989291251f, 0.868952215f},
-std::array<float,2>{0.172818273f, 0.0574328117f},
-std::array<float,2>{0.664139271f, 0.12072251f},
-std::array<float,2>{0.272884488f, 0.750061691f},
-std::array<float,2>{0.810669124f, 0.65087533f},
-std::array<float,2>{0.066590704f, 0.278723359f},
-std::array<float,2>{0.931316495f, 0.384820551f},
-std::array<float,2>{0.196338832f, 0.566199541f},
-std::array<float,2>{0.594310284f, 0.931349516f},
-std::array<float,2>{0.416131169f, 0.149131075f},
-std::array<float,2>{0.939054847f, 0.0147288265f},
-std::array<float,2>{0.131554753f, 0.814851999f},
-std::array<float,2>{0.55757004f, 0.748381615f},
-std::array<float,2>{0.449495614f, 0.347089589f},
-std::array<float,2>{0.728174448f, 0.463779867f},
-std::array<float,2>{0.358671844f, 0.526564062f},
-std::array<float,2>{0.815319121f, 0.993501246f},
-std::array<float,2>{0.0595207401f, 0.211679205f},
-std::array<float,2>{0.573922992f, 0.165698096f},
-std::array<float,2>{0.387454003f, 0.884569526f},
-std::array<float,2>{0.901886404f, 0.611024439f},
-std::array<float,2>{0.234955356f, 0.423852861f},
-std::array<float,2>{0.767394781f, 0.303739786f},
-std::array<float,2>{0.0958726928f, 0.680310786f},
-std::array<float,2>{0.63655138f, 0.787250161f},
-std::array<float,2>{0.288048148f, 0.0675222948f},
-std::array<float,2>{0.821259201f, 0.0543458983f},
-std::array<float,2>{0.0502635837f, 0.863935947f},
-std::array<float,2>{0.721119463f, 0.699192286f},
-std::array<float,2>{0.350678563f, 0.322278887f},
-std::array<float,2>{0.552496672f, 0.483747482f},
-std::array<float,2>{0.440482587f, 0.537136734f},
-std::array<float,2>{0.948203623f, 0.949489713f},
-std::array<float,2>{0.13951005f, 0.239552975f},
-std::array<float,2>{0.629093051f, 0.145596176f},
-std::array<float,2>{0.289126188f, 0.922103107f},
-std::array<float,2>{0.779888213f, 0.576713085f},
-std::array<float,2>{0.109332994f, 0.380642116f},
-std::array<float,2>{0.893623233f, 0.271727562f},
-std::array<float,2>{0.248949051f, 0.647498548f},
-std::array<float,2>{0.566074967f, 0.761839032f},
-std::array<float,2>{0.380145729f, 0.115782537f},
-std::array<float,2>{0.993244946f, 0.210623831f},
-std::array<float,2>{0.182574078f, 0.986811399f},
-std::array<float,2>{0.516038775f, 0.521128058f},
-std::array<float,2>{0.490558654f, 0.459079772f},
-std::array<float,2>{0.716779351f, 0.354100525f},
-std::array<float,2>{0.336482078f, 0.738972247f},
-std::array<float,2>{0.874995947f, 0.82231319f},
-std::array<float,2>{0.00597245945f, 0.00189979211f},
-std::array<float,2>{0.604478717f, 0.0768797174f},
-std::array<float,2>{0.413363874f, 0.792305589f},
-std::array<float,2>{0.922270715f, 0.676958025f},
-std::array<float,2>{0.190566763f, 0.310625672f},
-std::array<float,2>{0.801058888f, 0.435084343f},
-std::array<float,2>{0.072819382f, 0.621223211f},
-std::array<float,2>{0.660129488f, 0.878648579f},
-std::array<float,2>{0.275930911f, 0.162284508f},
-std::array<float,2>{0.765175462f, 0.18357569f},
-std::array<float,2>{0.115939841f, 0.905928433f},
-std::array<float,2>{0.648484528f, 0.599785447f},
-std::array<float,2>{0.310277551f, 0.415696532f},
-std::array<float,2>{0.582366109f, 0.291288167f},
-std::array<float,2>{0.395216256f, 0.671289206f},
-std::array<float,2>{0.88678503f, 0.812003076f},
-std::array<float,2>{0.222606361f, 0.0834577382f},
-std::array<float,2>{0.74721998f, 0.0202707853f},
-std::array<float,2>{0.373365879f, 0.837229848f},
-std::array<float,2>{0.842897117f, 0.726668179f},
-std::array<float,2>{0.0315000042f, 0.361827016f},
-std::array<float,2>{0.958392024f, 0.450637192f},
-std::array<float,2>{0.141346812f, 0.511951149f},
-std::array<float,2>{0.535920322f, 0.975974143f},
-std::array<float,2>{0.454316437f, 0.195541739f},
-std::array<float,2>{0.908849299f, 0.105147541f},
-std::array<float,2>{0.206338763f, 0.767841876f},
-std::array<float,2>{0.617224157f, 0.635983527f},
-std::array<float,2>{0.42531088f, 0.252057254f},
-std::array<float,2>{0.672488213f, 0.405674338f},
-std::array<float,2>{0.255810827f, 0.587029576f},
-std::array<float,2>{0.792334259f, 0.906342149f},
-std::array<float,2>{0.0877047405f, 0.130542561f},
-std::array<float,2>{0.510555565f, 0.223873571f},
-std::array<float,2>{0.480999619f, 0.959695935f},
-std::array<float,2>{0.978465736f, 0.547697306f},
-std::array<float,2>{0.167208195f, 0.49366644f},
-std::array<float,2>{0.846542001f, 0.337690532f},
-std::array<float,2>{0.0241521914f, 0.704796314f},
-std::array<float,2>{0.698019683f, 0.846825004f},
-std::array<float,2>{0.321916461f, 0.0369882621f},
-std::array<float,2>{0.854233623f, 0.112068549f},
-std::array<float,2>{0.0207630564f, 0.761494935f},
-std::array<float,2>{0.688917994f, 0.641313195f},
-std::array<float,2>{0.31299141f, 0.267924428f},
-std::array<float,2>{0.500151634f, 0.377277792f},
-std::array<float,2>{0.473164648f, 0.573120356f},
-std::array<float,2>{0.972661018f, 0.929616272f},
-std::array<float,2>{0.15628919f, 0.143453285f},
-std::array<float,2>{0.681079865f, 0.236419335f},
-std::array<float,2>{0.262598991f, 0.94770664f},
-std::array<float,2>{0.78900212f, 0.531660318f},
-std::array<float,2>{0.0837230235f, 0.479649812f},
-std::array<float,2>{0.919415593f, 0.324360967f},
-std::array<float,2>{0.213305816f, 0.701337218f},
-std::array<float,2>{0.616444528f, 0.861878991f},
-std::array<float,2>{0.433371991f, 0.0502682105f},
-std::array<float,2>{0.961245179f, 0.15928328f},
-std::array<float,2>{0.151565403f, 0.880536318f},
-std::array<float,2>{0.541551769f, 0.617273033f},
-std::array<float,2>{0.464671969f, 0.43102017f},
-std::array<float,2>{0.735722184f, 0.30747965f},
-std::array<float,2>{0.367031932f, 0.674288094f},
-std::array<float,2>{0.829521894f, 0.793949008f},
-std::array<float,2>{0.0451126248f, 0.0704014078f},
-std::array<float,2>{0.586634815f, 0.0058173039f},
-std::array<float,2>{0.400621265f, 0.827783644f},
-std::array<float,2>{0.881229639f, 0.737037778f},
-std::array<float,2>{0.230556011f, 0.358272284f},
-std::array<float,2>{0.757593989f, 0.453251034f},
-std::array<float,2>{0.123607419f, 0.518294454f},
-std::array<float,2>{0.643736243f, 0.991228521f},
-std::array<float,2>{0.302660972f, 0.204605997f},
-std::array<float,2>{0.806171298f, 0.199652657f},
-std::array<float,2>{0.0628930479f, 0.970250666f},
-std::array<float,2>{0.670102954f, 0.509249985f},
-std::array<float,2>{0.267195553f, 0.445419073f},
-std::array<float,2>{0.597743571f, 0.366919279f},
-std::array<float,2>{0.418572009f, 0.733819544f},
-std::array<float,2>{0.935506284f, 0.840095282f},
-std::array<float,2>{0.201696441f, 0.0194134694f},
-std::array<float,2>{0.708953261f, 0.0811658651f},
-std::array<float,2>{0.335328758f, 0.807246745f},
-std::array<float,2>{0.861667633f, 0.667251647f},
-std::array<float,2>{0.0114439521f, 0.295639068f},
-std::array<float,2>{0.987824738f, 0.418562651f},
-std::array<float,2>{0.179382041f, 0.597499549f},
-std::array<float,2>{0.525111794f, 0.902231216f},
-std::array<float,2>{0.497870237f, 0.184821948f},
-std::array<float,2>{0.904506803f, 0.0319055393f},
-std::array<float,2>{0.238754436f, 0.850200534f},
-std::array<float,2>{0.576216996f, 0.710399032f},
-std::array<float,2>{0.383705646f, 0.342405081f},
-std::array<float,2>{0.637724876f, 0.496384621f},
-std::array<float,2>{0.281459033f, 0.552531481f},
-std::array<float,2>{0.772129476f, 0.954026163f},
-std::array<float,2>{0.099183239f, 0.221879289f},
-std::array<float,2>{0.558749795f, 0.125588089f},
-std::array<float,2>{0.446055204f, 0.913557887f},
-std::array<float,2>{0.945098341f, 0.591558218f},
-std::array<float,2>{0.12859042f, 0.401728719f},
-std::array<float,2>{0.819451988f, 0.257607549f},
-std::array<float,2>{0.0568445064f, 0.638711691f},
-std::array<float,2>{0.733076215f, 0.772783279f},
-std::array<float,2>{0.353820175f, 0.108184971f},
-std::array<float,2>{0.777069569f, 0.0278829876f},
-std::array<float,2>{0.103881955f, 0.834780872f},
-std::array<float,2>{0.625764787f, 0.720856369f},
-std::array<float,2>{0.296114087f, 0.372542351f},
-std::array<float,2>{0.569026947f, 0.441252917f},
-std::array<float,2>{0.376577884f, 0.506663084f},
-std::array<float,2>{0.898016512f, 0.979713976f},
-std::array<float,2>{0.244895175f, 0.192063212f},
-std::array<float,2>{0.724592388f, 0.179587245f},
-std::array<float,2>{0.345286369f, 0.898407102f},
-std::array<float,2>{0.825213134f, 0.604440093f},
-std::array<float,2>{0.0545610711f, 0.41222319f},
-std::array<float,2>{0.949308813f, 0.283884764f},
-std::array<float,2>{0.134086937f, 0.656765521f},
-std::array<float,2>{0.549814284f, 0.801595807f},
-std::array<float,2>{0.441442668f, 0.0897178203f},
-std::array<float,2>{0.925985456f, 0.226722062f},
-std::array<float,2>{0.193264738f, 0.96332562f},
-std::array<float,2>{0.609228194f, 0.558174312f},
-std::array<float,2>{0.406456441f, 0.489891589f},
-std::array<float,2>{0.660742939f, 0.334135562f},
-std::array<float,2>{0.281025231f, 0.713922441f},
-std::array<float,2>{0.798608124f, 0.854175448f},
-std::array<float,2>{0.0769447312f, 0.0460231602f},
-std::array<float,2>{0.522787035f, 0.0940403491f},
-std::array<float,2>{0.487351537f, 0.778309941f},
-std::array<float,2>{0.998878479f, 0.625771463f},
-std::array<float,2>{0.186468512f, 0.260952771f},
-std::array<float,2>{0.870738983f, 0.391283959f},
-std::array<float,2>{0.000411194836f, 0.581614077f},
-std::array<float,2>{0.711946964f, 0.916258037f},
-std::array<float,2>{0.343232691f, 0.133815065f},
-std::array<float,2>{0.837173223f, 0.154202521f},
-std::array<float,2>{0.035976544f, 0.934392989f},
-std::array<float,2>{0.745003819f, 0.569935739f},
-std::array<float,2>{0.36975503f, 0.389948547f},
-std::array<float,2>{0.532015026f, 0.273876786f},
-std::array<float,2>{0.460073292f, 0.654613853f},
-std::array<float,2>{0.954516828f, 0.753966093f},
-std::array<float,2>{0.148194477f, 0.123302564f},
-std::array<float,2>{0.654030442f, 0.0616779849f},
-std::array<float,2>{0.304880977f, 0.873786688f},
-std::array<float,2>{0.761684656f, 0.688399911f},
-std::array<float,2>{0.113249421f, 0.313387543f},
-std::array<float,2>{0.883663297f, 0.474677712f},
-std::array<float,2>{0.226375803f, 0.542645097f},
-std::array<float,2>{0.580914855f, 0.937895954f},
-std::array<float,2>{0.391027927f, 0.248890162f},
-std::array<float,2>{0.983770669f, 0.063368544f},
-std::array<float,2>{0.168696716f, 0.781284988f},
-std::array<float,2>{0.514330864f, 0.686497033f},
-std::array<float,2>{0.477584094f, 0.300509363f},
-std::array<float,2>{0.700075269f, 0.427722901f},
-std::array<float,2>{0.324686855f, 0.616710544f},
-std::array<float,2>{0.850810468f, 0.889295518f},
-std::array<float,2>{0.0310486853f, 0.168032318f},
-std::array<float,2>{0.622480333f, 0.218617052f},
-std::array<float,2>{0.426994473f, 0.998653531f},
-std::array<float,2>{0.91246897f, 0.52858597f},
-std::array<float,2>{0.210136652f, 0.467527628f},
-std::array<float,2>{0.793494344f, 0.350319982f},
-std::array<float,2>{0.091630429f, 0.745497823f},
-std::array<float,2>{0.678425968f, 0.819668651f},
-std::array<float,2>{0.252504915f, 0.00900734868f},
-std::array<float,2>{0.750142813f, 0.0979385823f},
-std::array<float,2>{0.119205624f, 0.773911357f},
-std::array<float,2>{0.644721389f, 0.631980658f},
-std::array<float,2>{0.298086792f, 0.262309909f},
-std::array<float,2>{0.590601683f, 0.394600004f},
-std::array<float,2>{0.404804707f, 0.585017323f},
-std::array<float,2>{0.87518239f, 0.920022905f},
-std::array<float,2>{0.228978008f, 0.136799932f},
-std::array<float,2>{0.740067959f, 0.231857881f},
-std::array<float,2>{0.362225801f, 0.965891063f},
-std::array<float,2>{0.83255434f, 0.561997056f},
-std::array<float,2>{0.0397610627f, 0.485016912f},
-std::array<float,2>{0.965064764f, 0.329488784f},
-std::array<float,2>{0.154836029f, 0.717981458f},
-std::array<float,2>{0.545177579f, 0.855526507f},
-std::array<float,2>{0.466316968f, 0.0406677537f},
-std::array<float,2>{0.917462707f, 0.175285161f},
-std::array<float,2>{0.215494677f, 0.890846193f},
-std::array<float,2>{0.610677719f, 0.607022345f},
-std::array<float,2>{0.436503381f, 0.409852415f},
-std::array<float,2>{0.683912158f, 0.285569966f},
-std::array<float,2>{0.260255814f, 0.661103904f},
-std::array<float,2>{0.784735382f, 0.7987023f},
-std::array<float,2>{0.078689523f, 0.0922658592f},
-std::array<float,2>{0.507279634f, 0.0256469175f},
-std::array<float,2>{0.470528901f, 0.830915451f},
-std::array<float,2>{0.970243275f, 0.724481404f},
-std::array<float,2>{0.161572397f, 0.368453383f},
-std::array<float,2>{0.857442558f, 0.443969041f},
-std::array<float,2>{0.0180126503f, 0.50379765f},
-std::array<float,2>{0.694362879f, 0.98346132f},
-std::array<float,2>{0.31768012f, 0.190240189f},
-std::array<float,2>{0.8141855f, 0.214437366f},
-std::array<float,2>{0.0623431131f, 0.995436847f},
-std::array<float,2>{0.730173111f, 0.525039911f},
-std::array<float,2>{0.357150257f, 0.461807996f},
-std::array<float,2>{0.555969715f, 0.345540702f},
-std::array<float,2>{0.452055961f, 0.747493029f},
-std::array<float,2>{0.94119978f, 0.812803328f},
-std::array<float,2>{0.129658952f, 0.0119008105f},
-std::array<float,2>{0.634078503f, 0.0695703775f},
-std::array<float,2>{0.286374003f, 0.785634518f},
-std::array<float,2>{0.768371463f, 0.682119727f},
-std::array<float,2>{0.0944989324f, 0.301882118f},
-std::array<float,2>{0.898772776f, 0.423787773f},
-std::array<float,2>{0.238249406f, 0.612674952f},
-std::array<float,2>{0.571989655f, 0.88557601f},
-std::array<float,2>{0.38965258f, 0.166452304f},
-std::array<float,2>{0.990398228f, 0.0547015034f},
-std::array<float,2>{0.175452024f, 0.870809913f},
-std::array<float,2>{0.530570209f, 0.693383396f},
-std::array<float,2>{0.492426574f, 0.316565067f},
-std::array<float,2>{0.706660271f, 0.470542073f},
-std::array<float,2>{0.331291407f, 0.544762671f},
-std::array<float,2>{0.865325689f, 0.944023252f},
-std::array<float,2>{0.0134887714f, 0.242602125f},
-std::array<float,2>{0.595719218f, 0.15040496f},
-std::array<float,2>{0.414081305f, 0.933023095f},
-std::array<float,2>{0.933475614f, 0.564247072f},
-std::array<float,2>{0.198962763f, 0.384664446f},
-std::array<float,2>{0.810228825f, 0.279784203f},
-std::array<float,2>{0.0686798543f, 0.650351524f},
-std::array<float,2>{0.66705066f, 0.753478765f},
-std::array<float,2>{0.270429462f, 0.117190823f},
-std::array<float,2>{0.871218503f, 0.00195507868f},
-std::array<float,2>{0.00579137076f, 0.822084844f},
-std::array<float,2>{0.717399776f, 0.740910888f},
-std::array<float,2>{0.339396477f, 0.351628602f},
-std::array<float,2>{0.518898726f, 0.458639801f},
-std::array<float,2>{0.489542037f, 0.522026479f},
-std::array<float,2>{0.994579971f, 0.985976934f},
-std::array<float,2>{0.1808144f, 0.208496779f},
-std::array<float,2>{0.657877088f, 0.160635427f},
-std::array<float,2>{0.275115997f, 0.875259995f},
-std::array<float,2>{0.802780569f, 0.623804808f},
-std::array<float,2>{0.0710362419f, 0.437019169f},
-std::array<float,2>{0.923835397f, 0.30897364f},
-std::array<float,2>{0.187724635f, 0.679294944f},
-std::array<float,2>{0.603483677f, 0.789389849f},
-std::array<float,2>{0.410229653f, 0.0754214451f},
-std::array<float,2>{0.94644618f, 0.240301624f},
-std::array<float,2>{0.13748765f, 0.952324748f},
-std::array<float,2>{0.552806735f, 0.535985231f},
-std::array<float,2>{0.438733816f, 0.481415749f},
-std::array<float,2>{0.718763113f, 0.320390254f},
-std::array<float,2>{0.348630339f, 0.695521116f},
-std::array<float,2>{0.822811425f, 0.867091f},
-std::array<float,2>{0.0468822122f, 0.0520067103f},
-std::array<float,2>{0.563390791f, 0.114059933f},
-std::array<float,2>{0.382719487f, 0.765415728f},
-std::array<float,2>{0.891547441f, 0.6452232f},
-std::array<float,2>{0.247121111f, 0.270149589f},
-std::array<float,2>{0.77771467f, 0.382736564f},
-std::array<float,2>{0.10731826f, 0.574237347f},
-std::array<float,2>{0.630885303f, 0.92568481f},
-std::array<float,2>{0.291618407f, 0.146900997f},
-std::array<float,2>{0.790802896f, 0.13207756f},
-std::array<float,2>{0.0894890651f, 0.908267856f},
-std::array<float,2>{0.675659597f, 0.58854723f},
-std::array<float,2>{0.25689742f, 0.404209524f},
-std::array<float,2>{0.620764315f, 0.250707567f},
-std::array<float,2>{0.422913343f, 0.633571088f},
-std::array<float,2>{0.90648669f, 0.767252147f},
-std::array<float,2>{0.203368247f, 0.10332752f},
-std::array<float,2>{0.696037292f, 0.0384226106f},
-std::array<float,2>{0.323478281f, 0.843770206f},
-std::array<float,2>{0.845331788f, 0.705554128f},
-std::array<float,2>{0.0267649721f, 0.338297457f},
-std::array<float,2>{0.97966826f, 0.495128185f},
-std::array<float,2>{0.164874494f, 0.549773932f},
-std::array<float,2>{0.508833349f, 0.95718044f},
-std::array<float,2>{0.483075142f, 0.2255079f},
-std::array<float,2>{0.890149832f, 0.0848183855f},
-std::array<float,2>{0.219378963f, 0.81044668f},
-std::array<float,2>{0.585366607f, 0.669148922f},
-std::array<float,2>{0.397684485f, 0.28989625f},
-std::array<float,2>{0.650535464f, 0.416867435f},
-std::array<float,2>{0.311910391f, 0.598887682f},
-std::array<float,2>{0.762117565f, 0.903032422f},
-std::array<float,2>{0.114690728f, 0.180149421f},
-std::array<float,2>{0.537579417f, 0.198643863f},
-std::array<float,2>{0.455909401f, 0.973587692f},
-std::array<float,2>{0.960488319f, 0.514736772f},
-std::array<float,2>{0.14425011f, 0.45206666f},
-std::array<float,2>{0.841329515f, 0.36041674f},
-std::array<float,2>{0.0336360931f, 0.730387926f},
-std::array<float,2>{0.748318255f, 0.838208556f},
-std::array<float,2>{0.371817052f, 0.022595441f},
-std::array<float,2>{0.830561697f, 0.0735528916f},
-std::array<float,2>{0.0430155583f, 0.796850681f},
-std::array<float,2>{0.737882972f, 0.672302783f},
-std::array<float,2>{0.3638677f, 0.304714948f},
-std::array<float,2>{0.539115131f, 0.432136863f},
-std::array<float,2>{0.461421907f, 0.619588792f},
-std::array<float,2>{0.96448487f, 0.881939113f},
-std::array<float,2>{0.148626223f, 0.157988533f},
-std::array<float,2>{0.641894877f, 0.206083313f},
-std::array<float,2>{0.303058863f, 0.990023315f},
-std::array<float,2>{0.755374372f, 0.515937567f},
-std::array<float,2>{0.122922689f, 0.455481917f},
-std::array<float,2>{0.880404115f, 0.356158882f},
-std::array<float,2>{0.233912349f, 0.735637486f},
-std::array<float,2>{0.589353561f, 0.824975431f},
-std::array<float,2>{0.400271475f, 0.00753201032f},
-std::array<float,2>{0.976215601f, 0.142370015f},
-std::array<float,2>{0.159278423f, 0.927071512f},
-std::array<float,2>{0.503630459f, 0.570612371f},
-std::array<float,2>{0.475933671f, 0.376348853f},
-std::array<float,2>{0.691101849f, 0.26652053f},
-std::array<float,2>{0.315692395f, 0.643401802f},
-std::array<float,2>{0.853153169f, 0.75962621f},
-std::array<float,2>{0.0226132143f, 0.11044132f},
-std::array<float,2>{0.6135602f, 0.0485440381f},
-std::array<float,2>{0.431000024f, 0.860846877f},
-std::array<float,2>{0.920040131f, 0.700755417f},
-std::array<float,2>{0.212199762f, 0.326797843f},
-std::array<float,2>{0.786412954f, 0.476908505f},
-std::array<float,2>{0.0857986584f, 0.534886241f},
-std::array<float,2>{0.6826545f, 0.94565028f},
-std::array<float,2>{0.264228255f, 0.234526977f},
-std::array<float,2>{0.771428585f, 0.219927549f},
-std::array<float,2>{0.100056566f, 0.955927849f},
-std::array<float,2>{0.640101135f, 0.55356282f},
-std::array<float,2>{0.283462018f, 0.498373061f},
-std::array<float,2>{0.574240565f, 0.341599554f},
-std::array<float,2>{0.38606602f, 0.708530068f},
-std::array<float,2>{0.904031456f, 0.8493312f},
-std::array<float,2>{0.241113827f, 0.0333566442f},
-std::array<float,2>{0.731423557f, 0.107115276f},
-std::array<float,2>{0.353324622f, 0.76972419f},
-std::array<float,2>{0.817662001f, 0.637143254f},
-std::array<float,2>{0.0556294434f, 0.253950059f},
-std::array<float,2>{0.942084491f, 0.399143934f},
-std::array<float,2>{0.126681969f, 0.592562497f},
-std::array<float,2>{0.562291741f, 0.910988092f},
-std::array<float,2>{0.449125201f, 0.127975747f},
-std::array<float,2>{0.93736136f, 0.0163400993f},
-std::array<float,2>{0.200095236f, 0.842993081f},
-std::array<float,2>{0.601413906f, 0.730710208f},
-std::array<float,2>{0.421066999f, 0.363391459f},
-std::array<float,2>{0.669151187f, 0.448017865f},
-std::array<float,2>{0.26823011f, 0.510064423f},
-std::array<float,2>{0.808152854f, 0.971455097f},
-std::array<float,2>{0.0659326166f, 0.201423064f},
-std::array<float,2>{0.526731074f, 0.185666263f},
-std::array<float,2>{0.499393433f, 0.899946988f},
-std::array<float,2>{0.985770047f, 0.595646977f},
-std::array<float,2>{0.177236244f, 0.420811951f},
-std::array<float,2>{0.860942721f, 0.293978065f},
-std::array<float,2>{0.00781777501f, 0.665085196f},
-std::array<float,2>{0.70910579f, 0.805064499f},
-std::array<float,2>{0.333256125f, 0.0797365978f},
-std::array<float,2>{0.800440788f, 0.0431425795f},
-std::array<float,2>{0.0755333379f, 0.853029191f},
-std::array<float,2>{0.66334945f, 0.711073279f},
-std::array<float,2>{0.278842926f, 0.333260387f},
-std::array<float,2>{0.605586052f, 0.492002636f},
-std::array<float,2>{0.409349591f, 0.554849982f},
-std::array<float,2>{0.92877084f, 0.962472796f},
-std::array<float,2>{0.193913177f, 0.229123548f},
-std::array<float,2>{0.714093685f, 0.136450201f},
-std::array<float,2>{0.340441942f, 0.915482044f},
-std::array<float,2>{0.868327379f, 0.578671634f},
-std::array<float,2>{0.00225068978f, 0.394274145f},
-std::array<float,2>{0.997063935f, 0.258505851f},
-std::array<float,2>{0.184390023f, 0.627734065f},
-std::array<float,2>{0.520035446f, 0.779517651f},
-std::array<float,2>{0.486292213f, 0.0970473066f},
-std::array<float,2>{0.894848108f, 0.193802446f},
-std::array<float,2>{0.242531851f, 0.977040172f},
-std::array<float,2>{0.566972733f, 0.505105972f},
-std::array<float,2>{0.377827287f, 0.437711358f},
-std::array<float,2>{0.627378047f, 0.373242706f},
-std::array<float,2>{0.294639409f, 0.719396234f},
-std::array<float,2>{0.774838388f, 0.833511114f},
-std::array<float,2>{0.103055216f, 0.0304681621f},
-std::array<float,2>{0.548320055f, 0.0867370963f},
-std::array<float,2>{0.444420218f, 0.80318445f},
-std::array<float,2>{0.951446831f, 0.659999013f},
-std::array<float,2>{0.13561663f, 0.282034487f},
-std::array<float,2>{0.827500045f, 0.410651892f},
-std::array<float,2>{0.0508017242f, 0.601767898f},
-std::array<float,2>{0.724990487f, 0.894871116f},
-std::array<float,2>{0.34739092f, 0.177110836f},
-std::array<float,2>{0.847762167f, 0.170404688f},
-std::array<float,2>{0.0284319669f, 0.88720274f},
-std::array<float,2>{0.701831639f, 0.615233958f},
-std::array<float,2>{0.327489495f, 0.429206073f},
-std::array<float,2>{0.513103127f, 0.297083616f},
-std::array<float,2>{0.478950083f, 0.683761597f},
-std::array<float,2>{0.981509566f, 0.784261942f},
-std::array<float,2>{0.170096666f, 0.0657553002f},
-std::array<float,2>{0.676554322f, 0.00992202107f},
-std::array<float,2>{0.251745701f, 0.818229079f},
-std::array<float,2>{0.79533124f, 0.743851185f},
-std::array<float,2>{0.0929314196f, 0.348605901f},
-std::array<float,2>{0.91109103f, 0.466790199f},
-std::array<float,2>{0.208529025f, 0.53009969f},
-std::array<float,2>{0.62368983f, 0.997843742f},
-std::array<float,2>{0.429212868f, 0.216069996f},
-std::array<float,2>{0.95629251f, 0.122727707f},
-std::array<float,2>{0.145851165f, 0.755896211f},
-std::array<float,2>{0.533614576f, 0.652943194f},
-std::array<float,2>{0.458158672f, 0.277111828f},
-std::array<float,2>{0.743466079f, 0.387108415f},
-std::array<float,2>{0.367978007f, 0.567948878f},
-std::array<float,2>{0.837998986f, 0.936937273f},
-std::array<float,2>{0.0383104272f, 0.155352339f},
-std::array<float,2>{0.579338849f, 0.246942118f},
-std::array<float,2>{0.392611563f, 0.940279305f},
-std::array<float,2>{0.885609627f, 0.539486885f},
-std::array<float,2>{0.223675832f, 0.473461419f},
-std::array<float,2>{0.759462178f, 0.31596911f},
-std::array<float,2>{0.110906102f, 0.690943062f},
-std::array<float,2>{0.655736268f, 0.872268617f},
-std::array<float,2>{0.308408082f, 0.0587305278f},
-std::array<float,2>{0.811703563f, 0.119074792f},
-std::array<float,2>{0.0679529756f, 0.752443254f},
-std::array<float,2>{0.665995598f, 0.648604333f},
-std::array<float,2>{0.271549076f, 0.280293703f},
-std::array<float,2>{0.594831526f, 0.383359045f},
-std::array<float,2>{0.417074859f, 0.562909901f},
-std::array<float,2>{0.930185378f, 0.932114899f},
-std::array<float,2>{0.195361868f, 0.151921719f},
-std::array<float,2>{0.704349577f, 0.24412106f},
-std::array<float,2>{0.32977736f, 0.945182502f},
-std::array<float,2>{0.864074111f, 0.543244004f},
-std::array<float,2>{0.0153319268f, 0.46876213f},
-std::array<float,2>{0.98895061f, 0.317509711f},
-std::array<float,2>{0.173157528f, 0.694627523f},
-std::array<float,2>{0.52836287f, 0.869290888f},
-std::array<float,2>{0.495829403f, 0.0565691777f},
-std::array<float,2>{0.901098073f, 0.167918965f},
-std::array<float,2>{0.235712767f, 0.886176348f},
-std::array<float,2>{0.572976291f, 0.611404657f},
-std::array<float,2>{0.388403416f, 0.422266454f},
-std::array<float,2>{0.635216773f, 0.300923079f},
-std::array<float,2>{0.288220674f, 0.683350503f},
-std::array<float,2>{0.766183496f, 0.786922693f},
-std::array<float,2>{0.0976498574f, 0.0692621395f},
-std::array<float,2>{0.558101058f, 0.0134880645f},
-std::array<float,2>{0.450986862f, 0.814112425f},
-std::array<float,2>{0.937807858f, 0.747055173f},
-std::array<float,2>{0.131860137f, 0.343758315f},
-std::array<float,2>{0.815605462f, 0.462362945f},
-std::array<float,2>{0.0599127002f, 0.523928761f},
-std::array<float,2>{0.726790011f, 0.995048523f},
-std::array<float,2>{0.358178586f, 0.213799357f},
-std::array<float,2>{0.855741084f, 0.190779582f},
-std::array<float,2>{0.0173287783f, 0.983052909f},
-std::array<float,2>{0.693101108f, 0.502900541f},
-std::array<float,2>{0.318684131f, 0.444623619f},
-std::array<float,2>{0.504541576f, 0.367944866f},
-std::array<float,2>{0.472549707f, 0.722711802f},
-std::array<float,2>{0.971493185f, 0.831773818f},
-std::array<float,2>{0.162682846f, 0.0264646187f},
-std::array<float,2>{0.686202228f, 0.0928697884f},
-std::array<float,2>{0.259024262f, 0.796905279f},
-std::array<float,2>{0.781324863f, 0.661979258f},
-std::array<float,2>{0.0817909241f, 0.286251038f},
-std::array<float,2>{0.914298475f, 0.408898264f},
-std::array<float,2>{0.21707283f, 0.606324136f},
-std::array<float,2>{0.612635791f, 0.892303944f},
-std::array<float,2>{0.433967143f, 0.174453229f},
-std::array<float,2>{0.968617678f, 0.0399766378f},
-std::array<float,2>{0.152465805f, 0.857058406f},
-std::array<float,2>{0.543153584f, 0.717126608f},
-std::array<float,2>{0.468005657f, 0.328148693f},
-std::array<float,2>{0.740776956f, 0.485523522f},
-std::array<float,2>{0.361073166f, 0.560771167f},
-std::array<float,2>{0.834462464f, 0.965712845f},
-std::array<float,2>{0.0415820628f, 0.231160879f},
-std::array<float,2>{0.591919065f, 0.137831539f},
-std::array<float,2>{0.402922153f, 0.921768665f},
-std::array<float,2>{0.877644241f, 0.584874034f},
-std::array<float,2>{0.22743623f, 0.395860761f},
-std::array<float,2>{0.753320992f, 0.263385862f},
-std::array<float,2>{0.118515737f, 0.631167769f},
-std::array<float,2>{0.647872388f, 0.774692595f},
-std::array<float,2>{0.299674958f, 0.0995323658f},
-std::array<float,2>{0.84265238f, 0.0218524896f},
-std::array<float,2>{0.0330197588f, 0.83973825f},
-std::array<float,2>{0.74652487f, 0.728583395f},
-std::array<float,2>{0.374516785f, 0.360300452f},
-std::array<float,2>{0.537103713f, 0.452516496f},
-std::array<float,2>{0.453897357f, 0.514591634f},
-std::array<float,2>{0.957228541f, 0.973935366f},
-std::array<float,2>{0.142155781f, 0.197772384f},
-std::array<float,2>{0.650277853f, 0.181609467f},
-std::array<float,2>{0.308742344f, 0.904246032f},
-std::array<float,2>{0.763897836f, 0.598297715f},
-std::array<float,2>{0.116385318f, 0.417356253f},
-std::array<float,2>{0.888525486f, 0.290593863f},
-std::array<float,2>{0.220747635f, 0.668755412f},
-std::array<float,2>{0.583501101f, 0.809501112f},
-std::array<float,2>{0.39640522f, 0.0857553184f},
-std::array<float,2>{0.977488279f, 0.225742713f},
-std::array<float,2>{0.166642666f, 0.958234727f},
-std::array<float,2>{0.51139605f, 0.549869657f},
-std::array<float,2>{0.481897295f, 0.494984567f},
-std::array<float,2>{0.699177504f, 0.339021504f},
-std::array<float,2>{0.320760459f, 0.706817925f},
-std::array<float,2>{0.846991777f, 0.844994366f},
-std::array<float,2>{0.0248238835f, 0.0374278501f},
-std::array<float,2>{0.618866086f, 0.101722881f},
-std::array<float,2>{0.424243033f, 0.766221464f},
-std::array<float,2>{0.909241974f, 0.634275496f},
-std::array<float,2>{0.205957144f, 0.251531094f},
-std::array<float,2>{0.791432738f, 0.40293327f},
-std::array<float,2>{0.0865635872f, 0.589723051f},
-std::array<float,2>{0.672975123f, 0.909939826f},
-std::array<float,2>{0.254248887f, 0.131146461f},
-std::array<float,2>{0.780834973f, 0.14756766f},
-std::array<float,2>{0.1078704f, 0.924500883f},
-std::array<float,2>{0.630481064f, 0.57573241f},
-std::array<float,2>{0.290292412f, 0.38144812f},
-std::array<float,2>{0.56451267f, 0.270851821f},
-std::array<float,2>{0.379561156f, 0.645624995f},
-std::array<float,2>{0.892990887f, 0.764415085f},
-std::array<float,2>{0.24923031f, 0.11504887f},
-std::array<float,2>{0.722087026f, 0.0508971512f},
-std::array<float,2>{0.35011518f, 0.8654719f},
-std::array<float,2>{0.821983278f, 0.69705373f},
-std::array<float,2>{0.0492290892f, 0.32215789f},
-std::array<float,2>{0.94898963f, 0.482219875f},
-std::array<float,2>{0.140603408f, 0.536774337f},
-std::array<float,2>{0.551081896f, 0.951825917f},
-std::array<float,2>{0.439845443f, 0.241986588f},
-std::array<float,2>{0.923011541f, 0.0748899803f},
-std::array<float,2>{0.189865544f, 0.790361285f},
-std::array<float,2>{0.604766488f, 0.67810297f},
-std::array<float,2>{0.412932307f, 0.310351193f},
-std::array<float,2>{0.658407509f, 0.435700059f},
-std::array<float,2>{0.276829839f, 0.624638975f},
-std::array<float,2>{0.801864266f, 0.87667495f},
-std::array<float,2>{0.073507607f, 0.161171749f},
-std::array<float,2>{0.517208815f, 0.207235873f},
-std::array<float,2>{0.49141416f, 0.984443247f},
-std::array<float,2>{0.992576957f, 0.523249865f},
-std::array<float,2>{0.183326364f, 0.457392007f},
-std::array<float,2>{0.873508394f, 0.352731049f},
-std::array<float,2>{0.00755897211f, 0.741318166f},
-std::array<float,2>{0.715498328f, 0.821232319f},
-std::array<float,2>{0.337001652f, 0.00385407405f},
-std::array<float,2>{0.863216281f, 0.0784552395f},
-std::array<float,2>{0.0105643487f, 0.806456685f},
-std::array<float,2>{0.707511067f, 0.664726377f},
-std::array<float,2>{0.334780097f, 0.293352574f},
-std::array<float,2>{0.524073303f, 0.421651065f},
-std::array<float,2>{0.496245146f, 0.594382644f},
-std::array<float,2>{0.98730284f, 0.899292707f},
-std::array<float,2>{0.17811501f, 0.187301666f},
-std::array<float,2>{0.671012998f, 0.202305853f},
-std::array<float,2>{0.265942544f, 0.972195148f},
-std::array<float,2>{0.804737628f, 0.511718273f},
-std::array<float,2>{0.064385578f, 0.448898822f},
-std::array<float,2>{0.934206307f, 0.364323467f},
-std::array<float,2>{0.202213809f, 0.732180655f},
-std::array<float,2>{0.59867841f, 0.842071652f},
-std::array<float,2>{0.419783175f, 0.0173464362f},
-std::array<float,2>{0.943489432f, 0.126957297f},
-std::array<float,2>{0.127695367f, 0.911584496f},
-std::array<float,2>{0.560381353f, 0.593321681f},
-std::array<float,2>{0.447184384f, 0.39974013f},
-std::array<float,2>{0.733808875f, 0.255618393f},
-std::array<float,2>{0.354851454f, 0.638057709f},
-std::array<float,2>{0.818634689f, 0.770976603f},
-std::array<float,2>{0.0578163266f, 0.105951563f},
-std::array<float,2>{0.577448726f, 0.0344309658f},
-std::array<float,2>{0.383868337f, 0.848148584f},
-std::array<float,2>{0.905814469f, 0.707605898f},
-std::array<float,2>{0.239571556f, 0.340009242f},
-std::array<float,2>{0.773303807f, 0.499660343f},
-std::array<float,2>{0.0981757566f, 0.55372858f},
-std::array<float,2>{0.636739552f, 0.956588507f},
-std::array<float,2>{0.283174187f, 0.219025835f},
-std::array<float,2>{0.787515998f, 0.236186489f},
-std::array<float,2>{0.0827482492f, 0.946844399f},
-std::array<float,2>{0.680633962f, 0.533926904f},
-std::array<float,2>{0.262811661f, 0.478483796f},
-std::array<float,2>{0.6156165f, 0.327700883f},
-std::array<float,2>{0.432369024f, 0.699298799f},
-std::array<float,2>{0.9179883f, 0.860345364f},
-std::array<float,2>{0.214802116f, 0.0471569747f},
-std::array<float,2>{0.688287258f, 0.110025838f},
-std::array<float,2>{0.314226002f, 0.758336723f},
-std::array<float,2>{0.854884923f, 0.644188583f},
-std::array<float,2>{0.0204839725f, 0.266808182f},
-std::array<float,2>{0.973732412f, 0.375003994f},
-std::array<float,2>{0.15763554f, 0.571408987f},
-std::array<float,2>{0.501463413f, 0.926335931f},
-std::array<float,2>{0.473871231f, 0.140874133f},
-std::array<float,2>{0.882045269f, 0.00587277347f},
-std::array<float,2>{0.232056886f, 0.825995266f},
-std::array<float,2>{0.587448418f, 0.735215187f},
-std::array<float,2>{0.401692331f, 0.356645465f},
-std::array<float,2>{0.643165767f, 0.456787407f},
-std::array<float,2>{0.30100736f, 0.516824484f},
-std::array<float,2>{0.755925596f, 0.98829025f},
-std::array<float,2>{0.124057129f, 0.205417752f},
-std::array<float,2>{0.542603552f, 0.15639469f},
-std::array<float,2>{0.463107437f, 0.881360829f},
-std::array<float,2>{0.962618709f, 0.620676041f},
-std::array<float,2>{0.150815323f, 0.432886034f},
-std::array<float,2>{0.828194082f, 0.305698931f},
-std::array<float,2>{0.0465687737f, 0.673583865f},
-std::array<float,2>{0.734441519f, 0.79538554f},
-std::array<float,2>{0.365982175f, 0.0724500418f},
-std::array<float,2>{0.760703325f, 0.0598205626f},
-std::array<float,2>{0.111470774f, 0.871486068f},
-std::array<float,2>{0.652413011f, 0.690240681f},
-std::array<float,2>{0.305995703f, 0.314681739f},
-std::array<float,2>{0.581256986f, 0.473840922f},
-std::array<float,2>{0.391946375f, 0.540455163f},
-std::array<float,2>{0.884466767f, 0.940884769f},
-std::array<float,2>{0.224883437f, 0.24760595f},
-std::array<float,2>{0.745269418f, 0.155072346f},
-std::array<float,2>{0.370262086f, 0.93570751f},
-std::array<float,2>{0.83604598f, 0.566642821f},
-std::array<float,2>{0.0370008759f, 0.388266623f},
-std::array<float,2>{0.95317322f, 0.27595824f},
-std::array<float,2>{0.146934807f, 0.654233634f},
-std::array<float,2>{0.532722414f, 0.757625043f},
-std::array<float,2>{0.45942983f, 0.121168651f},
-std::array<float,2>{0.914008081f, 0.215013281f},
-std::array<float,2>{0.209835678f, 0.996122122f},
-std::array<float,2>{0.62138474f, 0.530411899f},
-std::array<float,2>{0.426418841f, 0.465194732f},
-std::array<float,2>{0.679192066f, 0.349077433f},
-std::array<float,2>{0.253364772f, 0.742712379f},
-std::array<float,2>{0.794677079f, 0.817338824f},
-std::array<float,2>{0.0902607888f, 0.0109501798f},
-std::array<float,2>{0.515444458f, 0.0648621246f},
-std::array<float,2>{0.477499098f, 0.783279836f},
-std::array<float,2>{0.982820809f, 0.685443223f},
-std::array<float,2>{0.16930154f, 0.298746318f},
-std::array<float,2>{0.849989057f, 0.427839816f},
-std::array<float,2>{0.0293094534f, 0.614139676f},
-std::array<float,2>{0.700462162f, 0.888290942f},
-std::array<float,2>{0.325397611f, 0.171695009f},
-std::array<float,2>{0.824715972f, 0.176386863f},
-std::array<float,2>{0.0532970726f, 0.895848751f},
-std::array<float,2>{0.723342359f, 0.602565765f},
-std::array<float,2>{0.344016761f, 0.41200605f},
-std::array<float,2>{0.549457848f, 0.283105433f},
-std::array<float,2>{0.44303301f, 0.658626914f},
-std::array<float,2>{0.950247467f, 0.804132283f},
-std::array<float,2>{0.133570507f, 0.0876330286f},
-std::array<float,2>{0.626210809f, 0.0297664143f},
-std::array<float,2>{0.295436352f, 0.832597673f},
-std::array<float,2>{0.775578916f, 0.72019428f},
-std::array<float,2>{0.105093293f, 0.374988407f},
-std::array<float,2>{0.896995366f, 0.439446539f},
-std::array<float,2>{0.245928168f, 0.504390538f},
-std::array<float,2>{0.569575846f, 0.978106797f},
-std::array<float,2>{0.375164777f, 0.194751412f},
-std::array<float,2>{0.99985081f, 0.0960782021f},
-std::array<float,2>{0.186705947f, 0.780977368f},
-std::array<float,2>{0.521821737f, 0.628004849f},
-std::array<float,2>{0.486619711f, 0.259402364f},
-std::array<float,2>{0.711373091f, 0.393300861f},
-std::array<float,2>{0.3421489f, 0.579512358f},
-std::array<float,2>{0.870091975f, 0.914369822f},
-std::array<float,2>{0.00113321072f, 0.135043994f},
-std::array<float,2>{0.607856989f, 0.23026225f},
-std::array<float,2>{0.407893509f, 0.961601853f},
-std::array<float,2>{0.927440047f, 0.556363046f},
-std::array<float,2>{0.191946f, 0.490675151f},
-std::array<float,2>{0.79689908f, 0.332925767f},
-std::array<float,2>{0.0779400915f, 0.712884605f},
-std::array<float,2>{0.661591709f, 0.852295697f},
-std::array<float,2>{0.279492736f, 0.0443999022f},
-std::array<float,2>{0.768970728f, 0.0670743436f},
-std::array<float,2>{0.0950351208f, 0.788146853f},
-std::array<float,2>{0.633480847f, 0.68097508f},
-std::array<float,2>{0.285802364f, 0.303527623f},
-std::array<float,2>{0.571260214f, 0.425118595f},
-std::array<float,2>{0.388689011f, 0.609480023f},
-std::array<float,2>{0.899514139f, 0.883438766f},
-std::array<float,2>{0.236775443f, 0.164125353f},
-std::array<float,2>{0.729097843f, 0.212244287f},
-std::array<float,2>{0.355471045f, 0.992741168f},
-std::array<float,2>{0.813318789f, 0.5263623f},
-std::array<float,2>{0.0610199086f, 0.464314222f},
-std::array<float,2>{0.940318048f, 0.345737845f},
-std::array<float,2>{0.130131438f, 0.749937356f},
-std::array<float,2>{0.555010855f, 0.815576196f},
-std::array<float,2>{0.45277676f, 0.0141010229f},
-std::array<float,2>{0.932616651f, 0.149833858f},
-std::array<float,2>{0.197698459f, 0.930314898f},
-std::array<float,2>{0.597465575f, 0.565332413f},
-std::array<float,2>{0.415185511f, 0.386193186f},
-std::array<float,2>{0.666207612f, 0.277368188f},
-std::array<float,2>{0.27066645f, 0.65168184f},
-std::array<float,2>{0.808920145f, 0.751236141f},
-std::array<float,2>{0.0699267685f, 0.119706608f},
-std::array<float,2>{0.530241787f, 0.0583221465f},
-std::array<float,2>{0.493525565f, 0.867845953f},
-std::array<float,2>{0.99150455f, 0.691908181f},
-std::array<float,2>{0.174490973f, 0.319082052f},
-std::array<float,2>{0.866874158f, 0.471330076f},
-std::array<float,2>{0.0117604863f, 0.545399249f},
-std::array<float,2>{0.705142081f, 0.942859054f},
-std::array<float,2>{0.33022666f, 0.244661048f},
-std::array<float,2>{0.833061695f, 0.232809439f},
-std::array<float,2>{0.0407572351f, 0.967351973f},
-std::array<float,2>{0.73867321f, 0.559958518f},
-std::array<float,2>{0.362827569f, 0.487764388f},
-std::array<float,2>{0.546562731f, 0.331302315f},
-std::array<float,2>{0.464928508f, 0.715565681f},
-std::array<float,2>{0.966745675f, 0.85811156f},
-std::array<float,2>{0.156153455f, 0.0414123759f},
-std::array<float,2>{0.64604497f, 0.100743949f},
-std::array<float,2>{0.297240078f, 0.775474429f},
-std::array<float,2>{0.751082659f, 0.629024744f},
-std::array<float,2>{0.120753884f, 0.26396358f},
-std::array<float,2>{0.87605536f, 0.396828741f},
-std::array<float,2>{0.230161116f, 0.583615959f},
-std::array<float,2>{0.591216981f, 0.919038594f},
-std::array<float,2>{0.406117946f, 0.139294475f},
-std::array<float,2>{0.969435155f, 0.0238073897f},
-std::array<float,2>{0.160409912f, 0.828500152f},
-std::array<float,2>{0.506672204f, 0.724895418f},
-std::array<float,2>{0.468899608f, 0.370205134f},
-std::array<float,2>{0.693727434f, 0.442195147f},
-std::array<float,2>{0.317055553f, 0.501137435f},
-std::array<float,2>{0.85932219f, 0.981536508f},
-std::array<float,2>{0.0185978506f, 0.188681796f},
-std::array<float,2>{0.609726369f, 0.172987953f},
-std::array<float,2>{0.437452346f, 0.893867552f},
-std::array<float,2>{0.916227996f, 0.608189523f},
-std::array<float,2>{0.216421664f, 0.407892436f},
-std::array<float,2>{0.78358978f, 0.288224101f},
-std::array<float,2>{0.0795245543f, 0.663479507f},
-std::array<float,2>{0.68496263f, 0.799939752f},
-std::array<float,2>{0.260843188f, 0.0908001587f},
-std::array<float,2>{0.844570637f, 0.0358741879f},
-std::array<float,2>{0.0261418f, 0.846154392f},
-std::array<float,2>{0.696974933f, 0.70339179f},
-std::array<float,2>{0.322863281f, 0.336863309f},
-std::array<float,2>{0.508194268f, 0.492821664f},
-std::array<float,2>{0.48345831f, 0.548324525f},
-std::array<float,2>{0.979387641f, 0.960679054f},
-std::array<float,2>{0.165657297f, 0.223108068f},
-std::array<float,2>{0.674108207f, 0.129186302f},
-std::array<float,2>{0.255900413f, 0.908192813f},
-std::array<float,2>{0.789955497f, 0.586117506f},
-std::array<float,2>{0.0888175219f, 0.404383093f},
-std::array<float,2>{0.907443583f, 0.253204644f},
-std::array<float,2>{0.204945371f, 0.634859741f},
-std::array<float,2>{0.619412005f, 0.768784583f},
-std::array<float,2>{0.422684819f, 0.104023956f},
-std::array<float,2>{0.959563732f, 0.196342885f},
-std::array<float,2>{0.142630786f, 0.975498438f},
-std::array<float,2>{0.538483858f, 0.513115704f},
-std::array<float,2>{0.456899077f, 0.449864477f},
-std::array<float,2>{0.749677837f, 0.362868965f},
-std::array<float,2>{0.372133523f, 0.728365004f},
-std::array<float,2>{0.840175807f, 0.836470842f},
-std::array<float,2>{0.0342001431f, 0.0213227924f},
-std::array<float,2>{0.584193349f, 0.0822032839f},
-std::array<float,2>{0.397208244f, 0.811039865f},
-std::array<float,2>{0.889275372f, 0.670289338f},
-std::array<float,2>{0.220176727f, 0.292754263f},
-std::array<float,2>{0.763616264f, 0.414382875f},
-std::array<float,2>{0.113505796f, 0.601486683f},
-std::array<float,2>{0.65196538f, 0.90487808f},
-std::array<float,2>{0.311266601f, 0.182242379f},
-std::array<float,2>{0.80420512f, 0.163534686f},
-std::array<float,2>{0.0719498321f, 0.877319992f},
-std::array<float,2>{0.656567931f, 0.622300506f},
-std::array<float,2>{0.274046957f, 0.434480727f},
-std::array<float,2>{0.60174638f, 0.311668724f},
-std::array<float,2>{0.41182664f, 0.676096559f},
-std::array<float,2>{0.925747156f, 0.791500866f},
-std::array<float,2>{0.189147741f, 0.0778138936f},
-std::array<float,2>{0.718359113f, 0.000216560555f},
-std::array<float,2>{0.338220745f, 0.824206889f},
-std::array<float,2>{0.87281692f, 0.739454985f},
-std::array<float,2>{0.00479438202f, 0.355195761f},
-std::array<float,2>{0.995432138f, 0.46064496f},
-std::array<float,2>{0.180234656f, 0.519965172f},
-std::array<float,2>{0.517838657f, 0.988022149f},
-std::array<float,2>{0.489176393f, 0.209835887f},
-std::array<float,2>{0.891857982f, 0.116531983f},
-std::array<float,2>{0.24689956f, 0.763300478f},
-std::array<float,2>{0.564140379f, 0.647174299f},
-std::array<float,2>{0.381141871f, 0.272963107f},
-std::array<float,2>{0.632788539f, 0.378990829f},
-std::array<float,2>{0.292037219f, 0.577334344f},
-std::array<float,2>{0.778414786f, 0.922962368f},
-std::array<float,2>{0.106257036f, 0.145178929f},
-std::array<float,2>{0.553825974f, 0.23906596f},
-std::array<float,2>{0.437883139f, 0.950556159f},
-std::array<float,2>{0.945422232f, 0.538725913f},
-std::array<float,2>{0.137902364f, 0.482523561f},
-std::array<float,2>{0.823929667f, 0.323355258f},
-std::array<float,2>{0.0483930968f, 0.697388113f},
-std::array<float,2>{0.72033447f, 0.864871621f},
-std::array<float,2>{0.349066079f, 0.0528813191f},
-std::array<float,2>{0.817020357f, 0.108677611f},
-std::array<float,2>{0.0560754165f, 0.772031248f},
-std::array<float,2>{0.732295513f, 0.640565097f},
-std::array<float,2>{0.352520198f, 0.256112725f},
-std::array<float,2>{0.560896695f, 0.401301682f},
-std::array<float,2>{0.448190302f, 0.590804875f},
-std::array<float,2>{0.942615271f, 0.912810206f},
-std::array<float,2>{0.125181422f, 0.126479626f},
-std::array<float,2>{0.639064968f, 0.220860481f},
-std::array<float,2>{0.284305155f, 0.954893947f},
-std::array<float,2>{0.770056725f, 0.550863504f},
-std::array<float,2>{0.101373494f, 0.497572571f},
-std::array<float,2>{0.902889132f, 0.34286195f},
-std::array<float,2>{0.241454825f, 0.709077954f},
-std::array<float,2>{0.575629473f, 0.851130784f},
-std::array<float,2>{0.385374278f, 0.0323776416f},
-std::array<float,2>{0.985329866f, 0.183963016f},
-std::array<float,2>{0.176245123f, 0.900985658f},
-std::array<float,2>{0.525969088f, 0.596518099f},
-std::array<float,2>{0.498054832f, 0.419138074f},
-std::array<float,2>{0.709965169f, 0.296194196f},
-std::array<float,2>{0.332568288f, 0.666612446f},
-std::array<float,2>{0.859835088f, 0.808413923f},
-std::array<float,2>{0.00941909291f, 0.0806755796f},
-std::array<float,2>{0.600348294f, 0.0184267759f},
-std::array<float,2>{0.420804888f, 0.84132123f},
-std::array<float,2>{0.935581803f, 0.733012617f},
-std::array<float,2>{0.201086864f, 0.366183192f},
-std::array<float,2>{0.806993604f, 0.446906924f},
-std::array<float,2>{0.0647571012f, 0.508268237f},
-std::array<float,2>{0.6688959f, 0.969255984f},
-std::array<float,2>{0.268696785f, 0.20088388f},
-std::array<float,2>{0.754193842f, 0.203180462f},
-std::array<float,2>{0.121686511f, 0.990856826f},
-std::array<float,2>{0.641335964f, 0.519194603f},
-std::array<float,2>{0.303721488f, 0.454277962f},
-std::array<float,2>{0.588558137f, 0.359354526f},
-std::array<float,2>{0.398890078f, 0.737983227f},
-std::array<float,2>{0.878907561f, 0.827097118f},
-std::array<float,2>{0.232843637f, 0.00470910873f},
-std::array<float,2>{0.736956954f, 0.072251305f},
-std::array<float,2>{0.364852458f, 0.793505847f},
-std::array<float,2>{0.83144784f, 0.675152719f},
-std::array<float,2>{0.0442890301f, 0.307658613f},
-std::array<float,2>{0.963097632f, 0.430320829f},
-std::array<float,2>{0.14976944f, 0.618823409f},
-std::array<float,2>{0.540731668f, 0.879049838f},
-std::array<float,2>{0.462808371f, 0.159132063f},
-std::array<float,2>{0.921607077f, 0.0491047651f},
-std::array<float,2>{0.211422652f, 0.862927914f},
-std::array<float,2>{0.614686131f, 0.70232302f},
-std::array<float,2>{0.429720521f, 0.325456232f},
-std::array<float,2>{0.681765139f, 0.478655726f},
-std::array<float,2>{0.265572965f, 0.532633901f},
-std::array<float,2>{0.785381615f, 0.949016333f},
-std::array<float,2>{0.0841569081f, 0.237372994f},
-std::array<float,2>{0.502041221f, 0.14384447f},
-std::array<float,2>{0.47519204f, 0.928544343f},
-std::array<float,2>{0.974918425f, 0.573726833f},
-std::array<float,2>{0.159019336f, 0.378605306f},
-std::array<float,2>{0.85182488f, 0.269464642f},
-std::array<float,2>{0.022078678f, 0.642009139f},
-std::array<float,2>{0.690192282f, 0.760275066f},
-std::array<float,2>{0.314965338f, 0.112755306f},
-std::array<float,2>{0.79614985f, 0.00831535365f},
-std::array<float,2>{0.0922626555f, 0.819188833f},
-std::array<float,2>{0.677083194f, 0.744615793f},
-std::array<float,2>{0.250478417f, 0.351515412f},
-std::array<float,2>{0.624230206f, 0.468305349f},
-std::array<float,2>{0.428318739f, 0.527825356f},
-std::array<float,2>{0.912071943f, 0.999437094f},
-std::array<float,2>{0.207958639f, 0.21766156f},
-std::array<float,2>{0.703044355f, 0.169415087f},
-std::array<float,2>{0.327094793f, 0.889977455f},
-std::array<float,2>{0.848778069f, 0.615756691f},
-std::array<float,2>{0.0276277475f, 0.426108241f},
-std::array<float,2>{0.981338441f, 0.29947266f},
-std::array<float,2>{0.171666279f, 0.68680203f},
-std::array<float,2>{0.511886597f, 0.782536268f},
-std::array<float,2>{0.480120927f, 0.0641449168f},
-std::array<float,2>{0.886705935f, 0.249073029f},
-std::array<float,2>{0.223343521f, 0.938564062f},
-std::array<float,2>{0.578871131f, 0.541440904f},
-std::array<float,2>{0.393729836f, 0.475759834f},
-std::array<float,2>{0.654601336f, 0.313935012f},
-std::array<float,2>{0.306990206f, 0.689138293f},
-std::array<float,2>{0.758073568f, 0.874349356f},
-std::array<float,2>{0.109616898f, 0.0607166849f},
-std::array<float,2>{0.535023749f, 0.124961391f},
-std::array<float,2>{0.457875669f, 0.75554496f},
-std::array<float,2>{0.955107808f, 0.655679941f},
-std::array<float,2>{0.145192444f, 0.274873197f},
-std::array<float,2>{0.839758635f, 0.389151841f},
-std::array<float,2>{0.0375623107f, 0.568515122f},
-std::array<float,2>{0.742551744f, 0.934909105f},
-std::array<float,2>{0.368522257f, 0.15262039f},
-std::array<float,2>{0.867258072f, 0.133293763f},
-std::array<float,2>{0.00309129083f, 0.917116463f},
-std::array<float,2>{0.713268578f, 0.580238581f},
-std::array<float,2>{0.341447383f, 0.391831398f},
-std::array<float,2>{0.521049917f, 0.260051489f},
-std::array<float,2>{0.484986871f, 0.626337707f},
-std::array<float,2>{0.997929573f, 0.778656065f},
-std::array<float,2>{0.184585407f, 0.0953727663f},
-std::array<float,2>{0.662699103f, 0.0452063307f},
-std::array<float,2>{0.277741551f, 0.855346799f},
-std::array<float,2>{0.799211323f, 0.713243067f},
-std::array<float,2>{0.0745763779f, 0.335651994f},
-std::array<float,2>{0.928128481f, 0.488590896f},
-std::array<float,2>{0.194768101f, 0.557116807f},
-std::array<float,2>{0.607242286f, 0.964147329f},
-std::array<float,2>{0.408351421f, 0.228405699f},
-std::array<float,2>{0.952634096f, 0.0888315514f},
-std::array<float,2>{0.136335969f, 0.802651703f},
-std::array<float,2>{0.547516823f, 0.657268465f},
-std::array<float,2>{0.443828046f, 0.284544975f},
-std::array<float,2>{0.725600183f, 0.413485199f},
-std::array<float,2>{0.346436113f, 0.605201125f},
-std::array<float,2>{0.826545477f, 0.896544576f},
-std::array<float,2>{0.0519982576f, 0.178660884f},
-std::array<float,2>{0.568162501f, 0.193184391f},
-std::array<float,2>{0.378284484f, 0.979106367f},
-std::array<float,2>{0.895940542f, 0.507514238f},
-std::array<float,2>{0.243825391f, 0.4398368f},
-std::array<float,2>{0.77357322f, 0.371714264f},
-std::array<float,2>{0.101854198f, 0.721833587f},
-std::array<float,2>{0.628229499f, 0.835724294f},
-std::array<float,2>{0.293814957f, 0.0291852225f},
-std::array<float,2>{0.804935813f, 0.0819754153f},
-std::array<float,2>{0.0639945343f, 0.80686897f},
-std::array<float,2>{0.671160161f, 0.66761893f},
-std::array<float,2>{0.265723646f, 0.295336068f},
-std::array<float,2>{0.598969758f, 0.418298811f},
-std::array<float,2>{0.419515878f, 0.596996307f},
-std::array<float,2>{0.934559524f, 0.901587903f},
-std::array<float,2>{0.202502504f, 0.185380563f},
-std::array<float,2>{0.707175434f, 0.199864402f},
-std::array<float,2>{0.334634066f, 0.969879746f},
-std::array<float,2>{0.863009691f, 0.509755611f},
-std::array<float,2>{0.0103338398f, 0.445979506f},
-std::array<float,2>{0.986937463f, 0.366612166f},
-std::array<float,2>{0.177938133f, 0.734221756f},
-std::array<float,2>{0.52432549f, 0.840664625f},
-std::array<float,2>{0.496497899f, 0.0189654827f},
-std::array<float,2>{0.906082749f, 0.125284716f},
-std::array<float,2>{0.239465863f, 0.913616419f},
-std::array<float,2>{0.577189624f, 0.591250896f},
-std::array<float,2>{0.384226322f, 0.402191311f},
-std::array<float,2>{0.637121499f, 0.25702697f},
-std::array<float,2>{0.28293094f, 0.639195144f},
-std::array<float,2>{0.773012996f, 0.773177505f},
-std::array<float,2>{0.0984609053f, 0.107743725f},
-std::array<float,2>{0.560173869f, 0.0314540453f},
-std::array<float,2>{0.44685182f, 0.84994781f},
-std::array<float,2>{0.943627596f, 0.710842669f},
-std::array<float,2>{0.127577469f, 0.341797203f},
-std::array<float,2>{0.818597972f, 0.496640056f},
-std::array<float,2>{0.0578676052f, 0.551771879f},
-std::array<float,2>{0.733472109f, 0.953138292f},
-std::array<float,2>{0.354594141f, 0.222478539f},
-std::array<float,2>{0.854721963f, 0.236995906f},
-std::array<float,2>{0.0202415064f, 0.947812259f},
-std::array<float,2>{0.688129306f, 0.531976044f},
-std::array<float,2>{0.314106137f, 0.480275661f},
-std::array<float,2>{0.50107199f, 0.324720263f},
-std::array<float,2>{0.474020243f, 0.702103674f},
-std::array<float,2>{0.974004388f, 0.861679912f},
-std::array<float,2>{0.157284796f, 0.0506381914f},
-std::array<float,2>{0.68021971f, 0.111650027f},
-std::array<float,2>{0.26308164f, 0.760962963f},
-std::array<float,2>{0.787307739f, 0.640690684f},
-std::array<float,2>{0.0829181224f, 0.268443525f},
-std::array<float,2>{0.918412268f, 0.377770752f},
-std::array<float,2>{0.21456629f, 0.572613835f},
-std::array<float,2>{0.615310967f, 0.929166555f},
-std::array<float,2>{0.432569116f, 0.14291051f},
-std::array<float,2>{0.962864518f, 0.00532525359f},
-std::array<float,2>{0.150599241f, 0.827307165f},
-std::array<float,2>{0.54284209f, 0.736702025f},
-std::array<float,2>{0.463244498f, 0.357672244f},
-std::array<float,2>{0.73465389f, 0.453879833f},
-std::array<float,2>{0.365887642f, 0.517797351f},
-std::array<float,2>{0.82850045f, 0.992041349f},
-std::array<float,2>{0.0466978066f, 0.204444796f},
-std::array<float,2>{0.587714076f, 0.160039932f},
-std::array<float,2>{0.401506782f, 0.880172312f},
-std::array<float,2>{0.882190943f, 0.618117094f},
-std::array<float,2>{0.232401282f, 0.431337893f},
-std::array<float,2>{0.756227851f, 0.306762129f},
-std::array<float,2>{0.124299437f, 0.674482644f},
-std::array<float,2>{0.643446326f, 0.794815123f},
-std::array<float,2>{0.301107973f, 0.0708831921f},
-std::array<float,2>{0.836281002f, 0.0621711388f},
-std::array<float,2>{0.0367767215f, 0.873457313f},
-std::array<float,2>{0.745416701f, 0.687935174f},
-std::array<float,2>{0.37049073f, 0.312629491f},
-std::array<float,2>{0.53299588f, 0.475223124f},
-std::array<float,2>{0.4590047f, 0.542417347f},
-std::array<float,2>{0.953524649f, 0.93810308f},
-std::array<float,2>{0.146708518f, 0.248247653f},
-std::array<float,2>{0.652691364f, 0.153758198f},
-std::array<float,2>{0.305744797f, 0.933897197f},
-std::array<float,2>{0.760349274f, 0.569378018f},
-std::array<float,2>{0.111629844f, 0.390467763f},
-std::array<float,2>{0.884590089f, 0.274103314f},
-std::array<float,2>{0.224773481f, 0.654969513f},
-std::array<float,2>{0.581370413f, 0.754708707f},
-std::array<float,2>{0.391685009f, 0.123950496f},
-std::array<float,2>{0.982637286f, 0.218013838f},
-std::array<float,2>{0.169062093f, 0.998085558f},
-std::array<float,2>{0.515344203f, 0.52883482f},
-std::array<float,2>{0.477215499f, 0.466877103f},
-std::array<float,2>{0.700337887f, 0.349735379f},
-std::array<float,2>{0.325633317f, 0.746069074f},
-std::array<float,2>{0.849701345f, 0.820122361f},
-std::array<float,2>{0.0297787841f, 0.00973841641f},
-std::array<float,2>{0.621150136f, 0.0626090765f},
-std::array<float,2>{0.426739693f, 0.781850755f},
-std::array<float,2>{0.913757801f, 0.68586117f},
-std::array<float,2>{0.209492862f, 0.299877316f},
-std::array<float,2>{0.79484123f, 0.426970094f},
-std::array<float,2>{0.0899987668f, 0.616250098f},
-std::array<float,2>{0.678952098f, 0.888906956f},
-std::array<float,2>{0.253047168f, 0.168655545f},
-std::array<float,2>{0.775672913f, 0.179056823f},
-std::array<float,2>{0.105229594f, 0.89775449f},
-std::array<float,2>{0.62627393f, 0.60372895f},
-std::array<float,2>{0.295766711f, 0.412660003f},
-std::array<float,2>{0.569674909f, 0.283662587f},
-std::array<float,2>{0.375302672f, 0.6562922f},
-std::array<float,2>{0.897348762f, 0.800922751f},
-std::array<float,2>{0.245765939f, 0.0892128795f},
-std::array<float,2>{0.723496795f, 0.0278075039f},
-std::array<float,2>{0.343786478f, 0.83402127f},
-std::array<float,2>{0.825149119f, 0.721577466f},
-std::array<float,2>{0.0536047034f, 0.37285319f},
-std::array<float,2>{0.950523138f, 0.440870553f},
-std::array<float,2>{0.133411661f, 0.50628227f},
-std::array<float,2>{0.549684703f, 0.980356514f},
-std::array<float,2>{0.443256378f, 0.191685706f},
-std::array<float,2>{0.927613676f, 0.0944944024f},
-std::array<float,2>{0.192371711f, 0.777809381f},
-std::array<float,2>{0.607465923f, 0.625130296f},
-std::array<float,2>{0.408196747f, 0.261453003f},
-std::array<float,2>{0.661170661f, 0.390867501f},
-std::array<float,2>{0.279618531f, 0.581255078f},
-std::array<float,2>{0.797348082f, 0.916742623f},
-std::array<float,2>{0.0777942687f, 0.134664431f},
-std::array<float,2>{0.521555364f, 0.22707133f},
-std::array<float,2>{0.486433297f, 0.963741779f},
-std::array<float,2>{0.999716282f, 0.55797714f},
-std::array<float,2>{0.186969995f, 0.489581734f},
-std::array<float,2>{0.869665623f, 0.3348822f},
-std::array<float,2>{0.00129971793f, 0.714823902f},
-std::array<float,2>{0.710992694f, 0.853677034f},
-std::array<float,2>{0.341806382f, 0.0464450233f},
-std::array<float,2>{0.863894939f, 0.120593995f},
-std::array<float,2>{0.0155982403f, 0.750961542f},
-std::array<float,2>{0.704146028f, 0.651086926f},
-std::array<float,2>{0.330032349f, 0.278901905f},
-std::array<float,2>{0.528602362f, 0.385413975f},
-std::array<float,2>{0.496048063f, 0.565594137f},
-std::array<float,2>{0.989047527f, 0.930784702f},
-std::array<float,2>{0.17291379f, 0.148442641f},
-std::array<float,2>{0.665605724f, 0.245700657f},
-std::array<float,2>{0.271744281f, 0.941528082f},
-std::array<float,2>{0.811963737f, 0.54615581f},
-std::array<float,2>{0.0683445111f, 0.472486466f},
-std::array<float,2>{0.930624485f, 0.320223182f},
-std::array<float,2>{0.195593819f, 0.692443669f},
-std::array<float,2>{0.595146894f, 0.868167341f},
-std::array<float,2>{0.417421371f, 0.0570665337f},
-std::array<float,2>{0.937718749f, 0.165041268f},
-std::array<float,2>{0.1320941f, 0.884011686f},
-std::array<float,2>{0.557711422f, 0.610797107f},
-std::array<float,2>{0.450764984f, 0.424527764f},
-std::array<float,2>{0.726965666f, 0.304539233f},
-std::array<float,2>{0.358025819f, 0.679873049f},
-std::array<float,2>{0.815790713f, 0.787930071f},
-std::array<float,2>{0.0597257838f, 0.0682330281f},
-std::array<float,2>{0.573135078f, 0.0152254002f},
-std::array<float,2>{0.388434917f, 0.815176725f},
-std::array<float,2>{0.901202619f, 0.74879843f},
-std::array<float,2>{0.235439658f, 0.347230554f},
-std::array<float,2>{0.766397476f, 0.462967604f},
-std::array<float,2>{0.0972927958f, 0.527251661f},
-std::array<float,2>{0.634937048f, 0.993834794f},
-std::array<float,2>{0.288551241f, 0.21119675f},
-std::array<float,2>{0.781666398f, 0.188090026f},
-std::array<float,2>{0.081638515f, 0.981120646f},
-std::array<float,2>{0.686312735f, 0.500435531f},
-std::array<float,2>{0.259215713f, 0.443083316f},
-std::array<float,2>{0.61246103f, 0.36947614f},
-std::array<float,2>{0.433652341f, 0.726498604f},
-std::array<float,2>{0.914455175f, 0.829210341f},
-std::array<float,2>{0.216806367f, 0.0250513945f},
-std::array<float,2>{0.693121552f, 0.0917540267f},
-std::array<float,2>{0.318574518f, 0.799485683f},
-std::array<float,2>{0.855505228f, 0.662197411f},
-std::array<float,2>{0.0175626501f, 0.28720057f},
-std::array<float,2>{0.971253991f, 0.406643778f},
-std::array<float,2>{0.162882f, 0.609015644f},
-std::array<float,2>{0.504866183f, 0.893504143f},
-std::array<float,2>{0.472200096f, 0.172444522f},
-std::array<float,2>{0.877728939f, 0.0422878452f},
-std::array<float,2>{0.227131858f, 0.859290481f},
-std::array<float,2>{0.592126191f, 0.716428518f},
-std::array<float,2>{0.40314126f, 0.331023037f},
-std::array<float,2>{0.647590399f, 0.486528844f},
-std::array<float,2>{0.29938373f, 0.558973193f},
-std::array<float,2>{0.753101945f, 0.968483388f},
-std::array<float,2>{0.118328549f, 0.233986095f},
-std::array<float,2>{0.543260217f, 0.14027147f},
-std::array<float,2>{0.468227625f, 0.918903649f},
-std::array<float,2>{0.968386531f, 0.582095921f},
-std::array<float,2>{0.152806535f, 0.397942692f},
-std::array<float,2>{0.834006846f, 0.265198618f},
-std::array<float,2>{0.0417725518f, 0.630644321f},
-std::array<float,2>{0.741119683f, 0.777018368f},
-std::array<float,2>{0.361290604f, 0.100303888f},
-std::array<float,2>{0.763946056f, 0.0197417513f},
-std::array<float,2>{0.116654091f, 0.837819338f},
-std::array<float,2>{0.650081396f, 0.727148533f},
-std::array<float,2>{0.308985502f, 0.361520231f},
-std::array<float,2>{0.583837211f, 0.450805694f},
-std::array<float,2>{0.396113515f, 0.512332559f},
-std::array<float,2>{0.888356745f, 0.976560414f},
-std::array<float,2>{0.221120059f, 0.196283206f},
-std::array<float,2>{0.746210277f, 0.182762429f},
-std::array<float,2>{0.374798179f, 0.905447245f},
-std::array<float,2>{0.842296541f, 0.600129485f},
-std::array<float,2>{0.0329007059f, 0.415375203f},
-std::array<float,2>{0.957328677f, 0.291856587f},
-std::array<float,2>{0.142386571f, 0.671532869f},
-std::array<float,2>{0.536835849f, 0.812247336f},
-std::array<float,2>{0.453637958f, 0.0838803351f},
-std::array<float,2>{0.90943408f, 0.22418268f},
-std::array<float,2>{0.205764771f, 0.959086716f},
-std::array<float,2>{0.619044185f, 0.546879411f},
-std::array<float,2>{0.424028754f, 0.493601054f},
-std::array<float,2>{0.673313558f, 0.337313861f},
-std::array<float,2>{0.253993094f, 0.704440176f},
-std::array<float,2>{0.791232884f, 0.84727025f},
-std::array<float,2>{0.0867917761f, 0.0363057368f},
-std::array<float,2>{0.51165843f, 0.104836978f},
-std::array<float,2>{0.481670976f, 0.768225253f},
-std::array<float,2>{0.977108002f, 0.636487246f},
-std::array<float,2>{0.166872665f, 0.252672315f},
-std::array<float,2>{0.84682405f, 0.405999452f},
-std::array<float,2>{0.0245148819f, 0.587642252f},
-std::array<float,2>{0.698884666f, 0.907087147f},
-std::array<float,2>{0.320501506f, 0.130000874f},
-std::array<float,2>{0.822031319f, 0.146145806f},
-std::array<float,2>{0.0488916636f, 0.922374606f},
-std::array<float,2>{0.721692562f, 0.576400518f},
-std::array<float,2>{0.350544095f, 0.380119711f},
-std::array<float,2>{0.55095768f, 0.27202484f},
-std::array<float,2>{0.439543188f, 0.647961974f},
-std::array<float,2>{0.948950827f, 0.762424886f},
-std::array<float,2>{0.140202746f, 0.11564891f},
-std::array<float,2>{0.630815268f, 0.0538534261f},
-std::array<float,2>{0.290079087f, 0.863561153f},
-std::array<float,2>{0.781045914f, 0.698725343f},
-std::array<float,2>{0.107438609f, 0.32303378f},
-std::array<float,2>{0.89276886f, 0.484125137f},
-std::array<float,2>{0.249418572f, 0.537896812f},
-std::array<float,2>{0.564781189f, 0.950018466f},
-std::array<float,2>{0.37969476f, 0.240118757f},
-std::array<float,2>{0.992367744f, 0.076540947f},
-std::array<float,2>{0.18350704f, 0.792520344f},
-std::array<float,2>{0.517488956f, 0.677280605f},
-std::array<float,2>{0.491641104f, 0.311424702f},
-std::array<float,2>{0.71574831f, 0.434954405f},
-std::array<float,2>{0.337364107f, 0.622047126f},
-std::array<float,2>{0.873265505f, 0.878376305f},
-std::array<float,2>{0.00768245198f, 0.16294618f},
-std::array<float,2>{0.604538739f, 0.210171983f},
-std::array<float,2>{0.412834495f, 0.987137616f},
-std::array<float,2>{0.92325902f, 0.520780563f},
-std::array<float,2>{0.189510807f, 0.459746361f},
-std::array<float,2>{0.802081823f, 0.353978038f},
-std::array<float,2>{0.0733940601f, 0.738628983f},
-std::array<float,2>{0.658550262f, 0.822784424f},
-std::array<float,2>{0.276520669f, 0.00118290493f},
-std::array<float,2>{0.770325899f, 0.106927365f},
-std::array<float,2>{0.101300247f, 0.770495892f},
-std::array<float,2>{0.63881886f, 0.637490213f},
-std::array<float,2>{0.284630597f, 0.254716009f},
-std::array<float,2>{0.575317025f, 0.398545593f},
-std::array<float,2>{0.385574162f, 0.591844797f},
-std::array<float,2>{0.903196275f, 0.910624623f},
-std::array<float,2>{0.241635397f, 0.128858864f},
-std::array<float,2>{0.731965899f, 0.220576674f},
-std::array<float,2>{0.352051169f, 0.955551207f},
-std::array<float,2>{0.817238271f, 0.552765846f},
-std::array<float,2>{0.0556745268f, 0.498949558f},
-std::array<float,2>{0.942661762f, 0.341178983f},
-std::array<float,2>{0.125454724f, 0.708301008f},
-std::array<float,2>{0.560559273f, 0.848859131f},
-std::array<float,2>{0.447943687f, 0.0340543054f},
-std::array<float,2>{0.935847342f, 0.186198175f},
-std::array<float,2>{0.200740024f, 0.899552107f},
-std::array<float,2>{0.60018456f, 0.594917417f},
-std::array<float,2>{0.420493275f, 0.420269877f},
-std::array<float,2>{0.668516219f, 0.294481307f},
-std::array<float,2>{0.268970817f, 0.665797114f},
-std::array<float,2>{0.806805015f, 0.805496156f},
-std::array<float,2>{0.0646791086f, 0.0795619935f},
-std::array<float,2>{0.526206732f, 0.0159117244f},
-std::array<float,2>{0.498526394f, 0.843394876f},
-std::array<float,2>{0.985096157f, 0.731014729f},
-std::array<float,2>{0.175858632f, 0.363895148f},
-std::array<float,2>{0.859509468f, 0.447636902f},
-std::array<float,2>{0.00975375902f, 0.510593116f},
-std::array<float,2>{0.710328579f, 0.971039772f},
-std::array<float,2>{0.332977951f, 0.20167391f},
-std::array<float,2>{0.831083596f, 0.206550077f},
-std::array<float,2>{0.0439508073f, 0.989368141f},
-std::array<float,2>{0.737130225f, 0.51647377f},
-std::array<float,2>{0.365154356f, 0.455801755f},
-std::array<float,2>{0.54098022f, 0.355946779f},
-std::array<float,2>{0.462479115f, 0.73596859f},
-std::array<float,2>{0.963291526f, 0.824414432f},
-std::array<float,2>{0.149419397f, 0.00692178728f},
-std::array<float,2>{0.641559482f, 0.073736757f},
-std::array<float,2>{0.304192424f, 0.796378613f},
-std::array<float,2>{0.754035771f, 0.672513723f},
-std::array<float,2>{0.12191736f, 0.305220276f},
-std::array<float,2>{0.879311562f, 0.431933314f},
-std::array<float,2>{0.232606113f, 0.619980752f},
-std::array<float,2>{0.588765621f, 0.8825261f},
-std::array<float,2>{0.398523033f, 0.157580718f},
-std::array<float,2>{0.974828303f, 0.047895696f},
-std::array<float,2>{0.158723414f, 0.860643923f},
-std::array<float,2>{0.502415359f, 0.700223982f},
-std::array<float,2>{0.475548804f, 0.326215804f},
-std::array<float,2>{0.690061927f, 0.477279484f},
-std::array<float,2>{0.31529057f, 0.53418684f},
-std::array<float,2>{0.85174787f, 0.945920348f},
-std::array<float,2>{0.02224168f, 0.235230714f},
-std::array<float,2>{0.614297271f, 0.141672209f},
-std::array<float,2>{0.429973006f, 0.927399874f},
-std::array<float,2>{0.921826541f, 0.57125473f},
-std::array<float,2>{0.211082667f, 0.376917869f},
-std::array<float,2>{0.785495043f, 0.265967876f},
-std::array<float,2>{0.0843320787f, 0.642940044f},
-std::array<float,2>{0.681973934f, 0.759183943f},
-std::array<float,2>{0.265324146f, 0.111126363f},
-std::array<float,2>{0.849088311f, 0.0105127227f},
-std::array<float,2>{0.0274728313f, 0.817458093f},
-std::array<float,2>{0.70273453f, 0.743498802f},
-std::array<float,2>{0.326688975f, 0.348044306f},
-std::array<float,2>{0.512071908f, 0.465874493f},
-std::array<float,2>{0.480245113f, 0.529481649f},
-std::array<float,2>{0.981023133f, 0.99748069f},
-std::array<float,2>{0.17152375f, 0.216338873f},
-std::array<float,2>{0.676927984f, 0.170851037f},
-std::array<float,2>{0.250190884f, 0.887676477f},
-std::array<float,2>{0.795946658f, 0.614367843f},
-std::array<float,2>{0.092000775f, 0.428916216f},
-std::array<float,2>{0.911749303f, 0.297700286f},
-std::array<float,2>{0.207528085f, 0.684105754f},
-std::array<float,2>{0.624401033f, 0.785065234f},
-std::array<float,2>{0.428509057f, 0.0663975403f},
-std::array<float,2>{0.955443919f, 0.246362984f},
-std::array<float,2>{0.145310521f, 0.939917564f},
-std::array<float,2>{0.534833729f, 0.539653122f},
-std::array<float,2>{0.457599968f, 0.472889006f},
-std::array<float,2>{0.742317855f, 0.315619141f},
-std::array<float,2>{0.368257672f, 0.690811694f},
-std::array<float,2>{0.839592457f, 0.872721851f},
-std::array<float,2>{0.0371808447f, 0.0591118447f},
-std::array<float,2>{0.578617692f, 0.122396216f},
-std::array<float,2>{0.393981755f, 0.756694496f},
-std::array<float,2>{0.886443675f, 0.652671695f},
-std::array<float,2>{0.223619744f, 0.27659896f},
-std::array<float,2>{0.757835686f, 0.387343079f},
-std::array<float,2>{0.109729409f, 0.567650259f},
-std::array<float,2>{0.65433991f, 0.93717587f},
-std::array<float,2>{0.30672738f, 0.156040743f},
-std::array<float,2>{0.798946977f, 0.136112377f},
-std::array<float,2>{0.0743118599f, 0.915535569f},
-std::array<float,2>{0.663003802f, 0.578342021f},
-std::array<float,2>{0.277446985f, 0.39394021f},
-std::array<float,2>{0.607055366f, 0.257993549f},
-std::array<float,2>{0.408599049f, 0.62722677f},
-std::array<float,2>{0.927884459f, 0.779954255f},
-std::array<float,2>{0.194490939f, 0.0974145532f},
-std::array<float,2>{0.713074982f, 0.0437477455f},
-std::array<float,2>{0.341739297f, 0.852972627f},
-std::array<float,2>{0.867669284f, 0.71164608f},
-std::array<float,2>{0.00340125151f, 0.333506674f},
-std::array<float,2>{0.997623086f, 0.491317481f},
-std::array<float,2>{0.185022488f, 0.555312037f},
-std::array<float,2>{0.521289468f, 0.962397158f},
-std::array<float,2>{0.485112816f, 0.228855759f},
-std::array<float,2>{0.895665765f, 0.0860553607f},
-std::array<float,2>{0.24394156f, 0.803489506f},
-std::array<float,2>{0.568012655f, 0.659623623f},
-std::array<float,2>{0.3779715f, 0.281556308f},
-std::array<float,2>{0.627936184f, 0.41037634f},
-std::array<float,2>{0.293602407f, 0.602209628f},
-std::array<float,2>{0.773780286f, 0.895340562f},
-std::array<float,2>{0.101659626f, 0.177509114f},
-std::array<float,2>{0.547611475f, 0.193916798f},
-std::array<float,2>{0.443540901f, 0.97718513f},
-std::array<float,2>{0.952200651f, 0.505602956f},
-std::array<float,2>{0.136644334f, 0.438099205f},
-std::array<float,2>{0.826192796f, 0.373811513f},
-std::array<float,2>{0.0520054959f, 0.71915859f},
-std::array<float,2>{0.726047337f, 0.833249867f},
-std::array<float,2>{0.346356839f, 0.0311383698f},
-std::array<float,2>{0.813104987f, 0.0698280632f},
-std::array<float,2>{0.060696587f, 0.78608942f},
-std::array<float,2>{0.729471385f, 0.682331681f},
-std::array<float,2>{0.355763167f, 0.302314132f},
-std::array<float,2>{0.554817438f, 0.4232288f},
-std::array<float,2>{0.453038931f, 0.613185704f},
-std::array<float,2>{0.939963996f, 0.88518852f},
-std::array<float,2>{0.129923791f, 0.166655496f},
-std::array<float,2>{0.633581042f, 0.214126125f},
-std::array<float,2>{0.286058992f, 0.995708346f},
-std::array<float,2>{0.768679798f, 0.524888456f},
-std::array<float,2>{0.0948167443f, 0.460985422f},
-std::array<float,2>{0.899794757f, 0.345179111f},
-std::array<float,2>{0.236564249f, 0.747903585f},
-std::array<float,2>{0.57086885f, 0.81305486f},
-std::array<float,2>{0.389058471f, 0.0123390742f},
-std::array<float,2>{0.991390646f, 0.151044503f},
-std::array<float,2>{0.174608573f, 0.933438897f},
-std::array<float,2>{0.529912233f, 0.563642979f},
-std::array<float,2>{0.493384659f, 0.383827746f},
-std::array<float,2>{0.705428481f, 0.279927552f},
-std::array<float,2>{0.330426067f, 0.649513602f},
-std::array<float,2>{0.86714679f, 0.752967894f},
-std::array<float,2>{0.0120997764f, 0.117855646f},
-std::array<float,2>{0.597181976f, 0.0556056276f},
-std::array<float,2>{0.415447354f, 0.870401323f},
-std::array<float,2>{0.932175338f, 0.694023728f},
-std::array<float,2>{0.197306737f, 0.316956103f},
-std::array<float,2>{0.808620691f, 0.470177859f},
-std::array<float,2>{0.0700693801f, 0.543954074f},
-std::array<float,2>{0.666452467f, 0.943754673f},
-std::array<float,2>{0.270804375f, 0.242747054f},
-std::array<float,2>{0.751380682f, 0.232209101f},
-std::array<float,2>{0.120906681f, 0.966685236f},
-std::array<float,2>{0.646316051f, 0.562038124f},
-std::array<float,2>{0.297041178f, 0.484855145f},
-std::array<float,2>{0.590993524f, 0.329759687f},
-std::array<float,2>{0.405763924f, 0.718585372f},
-std::array<float,2>{0.876256943f, 0.856342494f},
-std::array<float,2>{0.23024942f, 0.0400682166f},
-std::array<float,2>{0.738348901f, 0.0986308679f},
-std::array<float,2>{0.363060892f, 0.774040341f},
-std::array<float,2>{0.83333081f, 0.632537663f},
-std::array<float,2>{0.0408775844f, 0.26192683f},
-std::array<float,2>{0.966455519f, 0.395311743f},
-std::array<float,2>{0.155937299f, 0.585623205f},
-std::array<float,2>{0.546716988f, 0.92047292f},
-std::array<float,2>{0.465090036f, 0.1375871f},
-std::array<float,2>{0.916328192f, 0.0260129496f},
-std::array<float,2>{0.21663104f, 0.830108047f},
-std::array<float,2>{0.609546423f, 0.723657072f},
-std::array<float,2>{0.437062919f, 0.368958831f},
-std::array<float,2>{0.684598267f, 0.443709552f},
-std::array<float,2>{0.261110961f, 0.50306201f},
-std::array<float,2>{0.783303857f, 0.984258592f},
-std::array<float,2>{0.0793126896f, 0.189713761f},
-std::array<float,2>{0.506449521f, 0.175565213f},
-std::array<float,2>{0.469188333f, 0.891244471f},
-std::array<float,2>{0.96955514f, 0.606749177f},
-std::array<float,2>{0.160197243f, 0.40936327f},
-std::array<float,2>{0.858971953f, 0.285970569f},
-std::array<float,2>{0.0189352967f, 0.660591066f},
-std::array<float,2>{0.693597496f, 0.798143864f},
-std::array<float,2>{0.317191482f, 0.0925965011f},
-std::array<float,2>{0.789695859f, 0.0389918797f},
-std::array<float,2>{0.0883981586f, 0.844416916f},
-std::array<float,2>{0.67398572f, 0.705604732f},
-std::array<float,2>{0.256171793f, 0.338582695f},
-std::array<float,2>{0.619289696f, 0.495929122f},
-std::array<float,2>{0.422391593f, 0.548925042f},
-std::array<float,2>{0.907485187f, 0.957713127f},
-std::array<float,2>{0.204729691f, 0.224712163f},
-std::array<float,2>{0.697188735f, 0.132529885f},
-std::array<float,2>{0.323046446f, 0.909042954f},
-std::array<float,2>{0.844462276f, 0.588218093f},
-std::array<float,2>{0.0260342974f, 0.403482765f},
-std::array<float,2>{0.979024768f, 0.250221163f},
-std::array<float,2>{0.1659531f, 0.633109808f},
-std::array<float,2>{0.507953286f, 0.766710639f},
-std::array<float,2>{0.483705789f, 0.102566652f},
-std::array<float,2>{0.889412045f, 0.199084148f},
-std::array<float,2>{0.21982801f, 0.972991049f},
-std::array<float,2>{0.58444351f, 0.515294731f},
-std::array<float,2>{0.397310346f, 0.451377571f},
-std::array<float,2>{0.652188957f, 0.3613123f},
-std::array<float,2>{0.311488032f, 0.729875267f},
-std::array<float,2>{0.763270855f, 0.838382244f},
-std::array<float,2>{0.113716148f, 0.023365302f},
-std::array<float,2>{0.538090765f, 0.0843581632f},
-std::array<float,2>{0.456725091f, 0.809705257f},
-std::array<float,2>{0.959947169f, 0.669605911f},
-std::array<float,2>{0.142963067f, 0.289094478f},
-std::array<float,2>{0.839919865f, 0.41606909f},
-std::array<float,2>{0.034641508f, 0.599371076f},
-std::array<float,2>{0.749987245f, 0.902635157f},
-std::array<float,2>{0.372446209f, 0.180558726f},
-std::array<float,2>{0.872698247f, 0.1608143f},
-std::array<float,2>{0.00460681552f, 0.875911772f},
-std::array<float,2>{0.718677223f, 0.623121977f},
-std::array<float,2>{0.337914228f, 0.436808467f},
-std::array<float,2>{0.517758965f, 0.309470385f},
-std::array<float,2>{0.48886162f, 0.679072618f},
-std::array<float,2>{0.995312154f, 0.789958775f},
-std::array<float,2>{0.180539653f, 0.0759842545f},
-std::array<float,2>{0.656421542f, 0.00282587111f},
-std::array<float,2>{0.274410158f, 0.821514249f},
-std::array<float,2>{0.804607332f, 0.740454733f},
-std::array<float,2>{0.0722577721f, 0.352363706f},
-std::array<float,2>{0.925482273f, 0.458211124f},
-std::array<float,2>{0.189403102f, 0.521823168f},
-std::array<float,2>{0.601845086f, 0.985782266f},
-std::array<float,2>{0.412061572f, 0.208035022f},
-std::array<float,2>{0.945737422f, 0.113763556f},
-std::array<float,2>{0.137957796f, 0.764800906f},
-std::array<float,2>{0.554181874f, 0.644850433f},
-std::array<float,2>{0.437509775f, 0.269687325f},
-std::array<float,2>{0.720618427f, 0.382075131f},
-std::array<float,2>{0.348758936f, 0.574845731f},
-std::array<float,2>{0.824088931f, 0.92519784f},
-std::array<float,2>{0.0486947112f, 0.147114053f},
-std::array<float,2>{0.564300239f, 0.241107017f},
-std::array<float,2>{0.381074131f, 0.952653706f},
-std::array<float,2>{0.891814649f, 0.535447538f},
-std::array<float,2>{0.246818513f, 0.480490535f},
-std::array<float,2>{0.778700709f, 0.320820779f},
-std::array<float,2>{0.106175922f, 0.69587326f},
-std::array<float,2>{0.632351995f, 0.866575539f},
-std::array<float,2>{0.292268753f, 0.0523378626f},
-std::array<float,2>{0.788648605f, 0.109690197f},
-std::array<float,2>{0.0838772655f, 0.7579211f},
-std::array<float,2>{0.680785775f, 0.643655419f},
-std::array<float,2>{0.262207925f, 0.267409354f},
-std::array<float,2>{0.616698086f, 0.37596637f},
-std::array<float,2>{0.43330723f, 0.572261453f},
-std::array<float,2>{0.919130206f, 0.925818801f},
-std::array<float,2>{0.212932155f, 0.141450599f},
-std::array<float,2>{0.688525319f, 0.235605791f},
-std::array<float,2>{0.313238144f, 0.946615696f},
-std::array<float,2>{0.854420602f, 0.533648551f},
-std::array<float,2>{0.0205700677f, 0.477932334f},
-std::array<float,2>{0.973097503f, 0.327237755f},
-std::array<float,2>{0.156608894f, 0.700193465f},
-std::array<float,2>{0.500410855f, 0.85948807f},
-std::array<float,2>{0.473611504f, 0.0477857478f},
-std::array<float,2>{0.881074607f, 0.156825468f},
-std::array<float,2>{0.230903909f, 0.880964041f},
-std::array<float,2>{0.586863041f, 0.620486975f},
-std::array<float,2>{0.400827765f, 0.433120281f},
-std::array<float,2>{0.643961489f, 0.306639522f},
-std::array<float,2>{0.302256942f, 0.673324466f},
-std::array<float,2>{0.757454038f, 0.795677722f},
-std::array<float,2>{0.123817563f, 0.0729444101f},
-std::array<float,2>{0.541783392f, 0.00636232225f},
-std::array<float,2>{0.464495867f, 0.825229287f},
-std::array<float,2>{0.961038828f, 0.734703064f},
-std::array<float,2>{0.151800647f, 0.357081026f},
-std::array<float,2>{0.82921958f, 0.456527561f},
-std::array<float,2>{0.0453338549f, 0.517139316f},
-std::array<float,2>{0.735516906f, 0.989223063f},
-std::array<float,2>{0.366932899f, 0.205826774f},
-std::array<float,2>{0.861551523f, 0.202943683f},
-std::array<float,2>{0.0116760144f, 0.971749604f},
-std::array<float,2>{0.70854795f, 0.510884404f},
-std::array<float,2>{0.334980756f, 0.448390037f},
-std::array<float,2>{0.525181949f, 0.365106314f},
-std::array<float,2>{0.497610599f, 0.731516302f},
-std::array<float,2>{0.988229215f, 0.842354894f},
-std::array<float,2>{0.179599732f, 0.0166162774f},
-std::array<float,2>{0.670387268f, 0.0787295103f},
-std::array<float,2>{0.267375618f, 0.805727482f},
-std::array<float,2>{0.806459367f, 0.664260149f},
-std::array<float,2>{0.0625165626f, 0.293588966f},
-std::array<float,2>{0.935141385f, 0.421308041f},
-std::array<float,2>{0.201955944f, 0.593922794f},
-std::array<float,2>{0.598016143f, 0.898874998f},
-std::array<float,2>{0.418714255f, 0.186619222f},
-std::array<float,2>{0.945011199f, 0.0351308212f},
-std::array<float,2>{0.128671378f, 0.84805429f},
-std::array<float,2>{0.559073031f, 0.707136333f},
-std::array<float,2>{0.445968568f, 0.340763211f},
-std::array<float,2>{0.733347416f, 0.499394298f},
-std::array<float,2>{0.353685796f, 0.554606974f},
-std::array<float,2>{0.819604874f, 0.95619452f},
-std::array<float,2>{0.0570275076f, 0.219282791f},
-std::array<float,2>{0.576425195f, 0.1278072f},
-std::array<float,2>{0.383325189f, 0.911736012f},
-std::array<float,2>{0.90467f, 0.59285444f},
-std::array<float,2>{0.2385014f, 0.400139153f},
-std::array<float,2>{0.772341192f, 0.255056471f},
-std::array<float,2>{0.0995363072f, 0.638273716f},
-std::array<float,2>{0.638013005f, 0.771054983f},
-std::array<float,2>{0.281609654f, 0.106393203f},
-std::array<float,2>{0.825625181f, 0.0299107451f},
-std::array<float,2>{0.0543712787f, 0.832424581f},
-std::array<float,2>{0.724343181f, 0.720458984f},
-std::array<float,2>{0.345566541f, 0.374100327f},
-std::array<float,2>{0.550188839f, 0.438556999f},
-std::array<float,2>{0.441867352f, 0.504825056f},
-std::array<float,2>{0.949610829f, 0.977661371f},
-std::array<float,2>{0.133953273f, 0.194849491f},
-std::array<float,2>{0.625568211f, 0.175894633f},
-std::array<float,2>{0.296249419f, 0.896479547f},
-std::array<float,2>{0.777197897f, 0.603295505f},
-std::array<float,2>{0.103688635f, 0.411479592f},
-std::array<float,2>{0.898406506f, 0.282558292f},
-std::array<float,2>{0.244814143f, 0.659120083f},
-std::array<float,2>{0.569276452f, 0.804292381f},
-std::array<float,2>{0.376709729f, 0.0869737342f},
-std::array<float,2>{0.998591065f, 0.229497448f},
-std::array<float,2>{0.186099648f, 0.961028695f},
-std::array<float,2>{0.522702992f, 0.556110799f},
-std::array<float,2>{0.487697572f, 0.49074176f},
-std::array<float,2>{0.71224612f, 0.332304269f},
-std::array<float,2>{0.342982113f, 0.711942375f},
-std::array<float,2>{0.870902538f, 0.85157001f},
-std::array<float,2>{8.58128842e-05f, 0.0447437875f},
-std::array<float,2>{0.609026015f, 0.0962181464f},
-std::array<float,2>{0.406654239f, 0.780473292f},
-std::array<float,2>{0.926152408f, 0.628840029f},
-std::array<float,2>{0.192879438f, 0.258921087f},
-std::array<float,2>{0.798406303f, 0.392823488f},
-std::array<float,2>{0.0768480226f, 0.579716384f},
-std::array<float,2>{0.661052525f, 0.914938271f},
-std::array<float,2>{0.280856669f, 0.13528423f},
-std::array<float,2>{0.761260271f, 0.154455364f},
-std::array<float,2>{0.112906292f, 0.936511934f},
-std::array<float,2>{0.654204667f, 0.567149162f},
-std::array<float,2>{0.305132776f, 0.38811484f},
-std::array<float,2>{0.580793262f, 0.275561184f},
-std::array<float,2>{0.390633345f, 0.653673649f},
-std::array<float,2>{0.88346684f, 0.757013381f},
-std::array<float,2>{0.226127148f, 0.12164218f},
-std::array<float,2>{0.744649768f, 0.0600607395f},
-std::array<float,2>{0.369890034f, 0.871899009f},
-std::array<float,2>{0.836915135f, 0.689624906f},
-std::array<float,2>{0.0358666182f, 0.314995438f},
-std::array<float,2>{0.954278469f, 0.474128306f},
-std::array<float,2>{0.148191512f, 0.541004539f},
-std::array<float,2>{0.531902194f, 0.941174328f},
-std::array<float,2>{0.460229635f, 0.24738501f},
-std::array<float,2>{0.912255943f, 0.0651618466f},
-std::array<float,2>{0.210430905f, 0.784019291f},
-std::array<float,2>{0.622232556f, 0.684705734f},
-std::array<float,2>{0.427217484f, 0.297902942f},
-std::array<float,2>{0.678641081f, 0.428356767f},
-std::array<float,2>{0.252874047f, 0.613757849f},
-std::array<float,2>{0.793898404f, 0.887878239f},
-std::array<float,2>{0.0914422348f, 0.171069831f},
-std::array<float,2>{0.514474273f, 0.215664953f},
-std::array<float,2>{0.477807552f, 0.996927083f},
-std::array<float,2>{0.983504176f, 0.530959964f},
-std::array<float,2>{0.168914333f, 0.465688497f},
-std::array<float,2>{0.850982785f, 0.349182576f},
-std::array<float,2>{0.0307855997f, 0.742417216f},
-std::array<float,2>{0.699906409f, 0.816624582f},
-std::array<float,2>{0.32431227f, 0.0114568286f},
-std::array<float,2>{0.856657147f, 0.0932702124f},
-std::array<float,2>{0.0158916228f, 0.797623277f},
-std::array<float,2>{0.692375004f, 0.661279798f},
-std::array<float,2>{0.319736987f, 0.286658555f},
-std::array<float,2>{0.505455315f, 0.408602238f},
-std::array<float,2>{0.471053779f, 0.605807126f},
-std::array<float,2>{0.971716881f, 0.891668081f},
-std::array<float,2>{0.163356572f, 0.173839107f},
-std::array<float,2>{0.686747491f, 0.191049114f},
-std::array<float,2>{0.258260965f, 0.982791245f},
-std::array<float,2>{0.78291285f, 0.502320349f},
-std::array<float,2>{0.081020847f, 0.445073932f},
-std::array<float,2>{0.915808558f, 0.36741215f},
-std::array<float,2>{0.218516961f, 0.723194122f},
-std::array<float,2>{0.611765027f, 0.831344426f},
-std::array<float,2>{0.434880555f, 0.0269877259f},
-std::array<float,2>{0.967621207f, 0.138562158f},
-std::array<float,2>{0.15410997f, 0.921005547f},
-std::array<float,2>{0.544608593f, 0.584308326f},
-std::array<float,2>{0.467177719f, 0.396333009f},
-std::array<float,2>{0.741670966f, 0.262781143f},
-std::array<float,2>{0.359537601f, 0.631658375f},
-std::array<float,2>{0.835193932f, 0.775073111f},
-std::array<float,2>{0.0423639081f, 0.099005878f},
-std::array<float,2>{0.593554139f, 0.0391944535f},
-std::array<float,2>{0.403672606f, 0.856844664f},
-std::array<float,2>{0.878520548f, 0.717568159f},
-std::array<float,2>{0.228301033f, 0.328627855f},
-std::array<float,2>{0.752159178f, 0.486183047f},
-std::array<float,2>{0.117341548f, 0.561117411f},
-std::array<float,2>{0.646870673f, 0.965064943f},
-std::array<float,2>{0.300666928f, 0.230505913f},
-std::array<float,2>{0.810896277f, 0.243612915f},
-std::array<float,2>{0.0668476522f, 0.944607079f},
-std::array<float,2>{0.664416313f, 0.543881834f},
-std::array<float,2>{0.272498608f, 0.46952346f},
-std::array<float,2>{0.594603419f, 0.318195879f},
-std::array<float,2>{0.416391641f, 0.69503814f},
-std::array<float,2>{0.931538284f, 0.869932413f},
-std::array<float,2>{0.196574673f, 0.0561174639f},
-std::array<float,2>{0.703281641f, 0.118330114f},
-std::array<float,2>{0.32895273f, 0.752344072f},
-std::array<float,2>{0.864730179f, 0.649242163f},
-std::array<float,2>{0.0138498237f, 0.281186253f},
-std::array<float,2>{0.989573658f, 0.383120418f},
-std::array<float,2>{0.172593042f, 0.563279927f},
-std::array<float,2>{0.527394474f, 0.932550967f},
-std::array<float,2>{0.495027959f, 0.151825115f},
-std::array<float,2>{0.902231932f, 0.0131552899f},
-std::array<float,2>{0.235142022f, 0.813694596f},
-std::array<float,2>{0.574092209f, 0.746413171f},
-std::array<float,2>{0.387305319f, 0.344242722f},
-std::array<float,2>{0.636459112f, 0.462822586f},
-std::array<float,2>{0.287813395f, 0.523902178f},
-std::array<float,2>{0.767294049f, 0.994472086f},
-std::array<float,2>{0.0961712301f, 0.213372827f},
-std::array<float,2>{0.557331145f, 0.167247608f},
-std::array<float,2>{0.449278325f, 0.886474907f},
-std::array<float,2>{0.939338803f, 0.611995697f},
-std::array<float,2>{0.13179706f, 0.42240423f},
-std::array<float,2>{0.815023363f, 0.301329464f},
-std::array<float,2>{0.0592539161f, 0.68293339f},
-std::array<float,2>{0.728510261f, 0.78643167f},
-std::array<float,2>{0.358461946f, 0.068765007f},
-std::array<float,2>{0.780222237f, 0.0514546447f},
-std::array<float,2>{0.109088041f, 0.865774691f},
-std::array<float,2>{0.629180431f, 0.696673453f},
-std::array<float,2>{0.289508432f, 0.321591944f},
-std::array<float,2>{0.566240072f, 0.48157981f},
-std::array<float,2>{0.380056292f, 0.536141217f},
-std::array<float,2>{0.894011259f, 0.951424539f},
-std::array<float,2>{0.248596758f, 0.241364002f},
-std::array<float,2>{0.720848799f, 0.148429811f},
-std::array<float,2>{0.351055712f, 0.923947453f},
-std::array<float,2>{0.820883095f, 0.575517595f},
-std::array<float,2>{0.0499368384f, 0.38095516f},
-std::array<float,2>{0.947806239f, 0.271265596f},
-std::array<float,2>{0.139257491f, 0.646243572f},
-std::array<float,2>{0.552460909f, 0.76374048f},
-std::array<float,2>{0.440734267f, 0.114671908f},
-std::array<float,2>{0.92191726f, 0.207713962f},
-std::array<float,2>{0.190838769f, 0.985048115f},
-std::array<float,2>{0.604241371f, 0.522915125f},
-std::array<float,2>{0.413298965f, 0.457740843f},
-std::array<float,2>{0.659701705f, 0.353138685f},
-std::array<float,2>{0.276268482f, 0.741845548f},
-std::array<float,2>{0.800994635f, 0.820337653f},
-std::array<float,2>{0.0731384456f, 0.00293590454f},
-std::array<float,2>{0.515666366f, 0.0743005276f},
-std::array<float,2>{0.490476668f, 0.790848255f},
-std::array<float,2>{0.993545592f, 0.678564429f},
-std::array<float,2>{0.182199478f, 0.309681684f},
-std::array<float,2>{0.874539912f, 0.436445624f},
-std::array<float,2>{0.00625531655f, 0.624427259f},
-std::array<float,2>{0.716378033f, 0.876156509f},
-std::array<float,2>{0.33668825f, 0.161701232f},
-std::array<float,2>{0.843191743f, 0.181128815f},
-std::array<float,2>{0.0312611945f, 0.903371871f},
-std::array<float,2>{0.747495949f, 0.597846329f},
-std::array<float,2>{0.373181492f, 0.417579651f},
-std::array<float,2>{0.535765469f, 0.29023245f},
-std::array<float,2>{0.454513133f, 0.668095648f},
-std::array<float,2>{0.958089709f, 0.808612406f},
-std::array<float,2>{0.141594827f, 0.0851521641f},
-std::array<float,2>{0.648858309f, 0.0221572071f},
-std::array<float,2>{0.310337842f, 0.839294314f},
-std::array<float,2>{0.765554845f, 0.729106963f},
-std::array<float,2>{0.116031922f, 0.359751463f},
-std::array<float,2>{0.887061059f, 0.45266825f},
-std::array<float,2>{0.22225903f, 0.513853014f},
-std::array<float,2>{0.582078516f, 0.974143565f},
-std::array<float,2>{0.395475924f, 0.19727391f},
-std::array<float,2>{0.9781937f, 0.1021984f},
-std::array<float,2>{0.167244717f, 0.765765905f},
-std::array<float,2>{0.51025486f, 0.634298086f},
-std::array<float,2>{0.48123458f, 0.251361579f},
-std::array<float,2>{0.697943747f, 0.402478993f},
-std::array<float,2>{0.322141588f, 0.589075744f},
-std::array<float,2>{0.846295774f, 0.909621418f},
-std::array<float,2>{0.0243137386f, 0.131386191f},
-std::array<float,2>{0.617556334f, 0.226431489f},
-std::array<float,2>{0.425619632f, 0.95885241f},
-std::array<float,2>{0.908998311f, 0.550402999f},
-std::array<float,2>{0.206169754f, 0.494303793f},
-std::array<float,2>{0.79212898f, 0.339536965f},
-std::array<float,2>{0.0876152366f, 0.706443906f},
-std::array<float,2>{0.672735989f, 0.845251322f},
-std::array<float,2>{0.255451292f, 0.037929859f},
-std::array<float,2>{0.755621552f, 0.0717203245f},
-std::array<float,2>{0.122690372f, 0.793360889f},
-std::array<float,2>{0.641732872f, 0.675302744f},
-std::array<float,2>{0.302772731f, 0.308382779f},
-std::array<float,2>{0.589054048f, 0.430118412f},
-std::array<float,2>{0.400105447f, 0.618372679f},
-std::array<float,2>{0.880679488f, 0.879418969f},
-std::array<float,2>{0.234365776f, 0.158342749f},
-std::array<float,2>{0.738209009f, 0.203889877f},
-std::array<float,2>{0.364063472f, 0.990312159f},
-std::array<float,2>{0.83014518f, 0.518976808f},
-std::array<float,2>{0.0433219858f, 0.455028176f},
-std::array<float,2>{0.964616716f, 0.358700156f},
-std::array<float,2>{0.148776188f, 0.73767066f},
-std::array<float,2>{0.539548218f, 0.826405108f},
-std::array<float,2>{0.461118102f, 0.00403047958f},
-std::array<float,2>{0.920319438f, 0.14420028f},
-std::array<float,2>{0.211965188f, 0.928101003f},
-std::array<float,2>{0.613437712f, 0.573924005f},
-std::array<float,2>{0.430832744f, 0.37807107f},
-std::array<float,2>{0.68296963f, 0.268763423f},
-std::array<float,2>{0.264600039f, 0.642308116f},
-std::array<float,2>{0.78634882f, 0.759984732f},
-std::array<float,2>{0.0854723975f, 0.113245644f},
-std::array<float,2>{0.503832579f, 0.0495201945f},
-std::array<float,2>{0.47561267f, 0.862538278f},
-std::array<float,2>{0.976517677f, 0.703053713f},
-std::array<float,2>{0.159486368f, 0.325794607f},
-std::array<float,2>{0.853505015f, 0.479436964f},
-std::array<float,2>{0.0228880066f, 0.532964468f},
-std::array<float,2>{0.691248715f, 0.948421717f},
-std::array<float,2>{0.315566272f, 0.237898692f},
-std::array<float,2>{0.817533612f, 0.221514106f},
-std::array<float,2>{0.0552344397f, 0.954326153f},
-std::array<float,2>{0.730962694f, 0.551529348f},
-std::array<float,2>{0.353058696f, 0.497294903f},
-std::array<float,2>{0.562179029f, 0.343632996f},
-std::array<float,2>{0.448889643f, 0.709668398f},
-std::array<float,2>{0.942333698f, 0.850701094f},
-std::array<float,2>{0.126932189f, 0.0327712186f},
-std::array<float,2>{0.639861941f, 0.109160013f},
-std::array<float,2>{0.283373713f, 0.771564245f},
-std::array<float,2>{0.771012664f, 0.639912486f},
-std::array<float,2>{0.0998140574f, 0.256801516f},
-std::array<float,2>{0.904133379f, 0.400526375f},
-std::array<float,2>{0.240832448f, 0.589984238f},
-std::array<float,2>{0.57447809f, 0.912365973f},
-std::array<float,2>{0.385945708f, 0.126320764f},
-std::array<float,2>{0.985448718f, 0.0178725813f},
-std::array<float,2>{0.176935315f, 0.84127605f},
-std::array<float,2>{0.526414275f, 0.732477665f},
-std::array<float,2>{0.499208927f, 0.365255564f},
-std::array<float,2>{0.709384322f, 0.446625739f},
-std::array<float,2>{0.333054096f, 0.508475363f},
-std::array<float,2>{0.861180663f, 0.96902895f},
-std::array<float,2>{0.00822828896f, 0.20035322f},
-std::array<float,2>{0.601163983f, 0.184502408f},
-std::array<float,2>{0.421224117f, 0.900587142f},
-std::array<float,2>{0.937161446f, 0.596096754f},
-std::array<float,2>{0.199730694f, 0.419828773f},
-std::array<float,2>{0.808455765f, 0.296674192f},
-std::array<float,2>{0.0661807954f, 0.666442633f},
-std::array<float,2>{0.669339061f, 0.808000326f},
-std::array<float,2>{0.26832965f, 0.0803477466f},
-std::array<float,2>{0.868520796f, 0.0456109829f},
-std::array<float,2>{0.00215232f, 0.854759932f},
-std::array<float,2>{0.714297354f, 0.713563919f},
-std::array<float,2>{0.340637296f, 0.335065782f},
-std::array<float,2>{0.520315111f, 0.489169568f},
-std::array<float,2>{0.485992253f, 0.557416737f},
-std::array<float,2>{0.99673748f, 0.964619637f},
-std::array<float,2>{0.184098467f, 0.227613047f},
-std::array<float,2>{0.663228512f, 0.133642897f},
-std::array<float,2>{0.279159576f, 0.917583764f},
-std::array<float,2>{0.800584853f, 0.58098954f},
-std::array<float,2>{0.0752944648f, 0.392355859f},
-std::array<float,2>{0.929097354f, 0.260631621f},
-std::array<float,2>{0.194198012f, 0.626562834f},
-std::array<float,2>{0.605724096f, 0.779240251f},
-std::array<float,2>{0.409494489f, 0.0949921757f},
-std::array<float,2>{0.951214552f, 0.192474544f},
-std::array<float,2>{0.13535817f, 0.978655398f},
-std::array<float,2>{0.547884226f, 0.507045925f},
-std::array<float,2>{0.444820523f, 0.440278947f},
-std::array<float,2>{0.72473079f, 0.371339202f},
-std::array<float,2>{0.34755832f, 0.722198129f},
-std::array<float,2>{0.827304959f, 0.835440695f},
-std::array<float,2>{0.0510559306f, 0.0283271782f},
-std::array<float,2>{0.567194164f, 0.0883213878f},
-std::array<float,2>{0.377502143f, 0.801833153f},
-std::array<float,2>{0.894764662f, 0.65794456f},
-std::array<float,2>{0.242273912f, 0.285147518f},
-std::array<float,2>{0.77454561f, 0.413783193f},
-std::array<float,2>{0.103490636f, 0.60490191f},
-std::array<float,2>{0.626986802f, 0.89719367f},
-std::array<float,2>{0.294901699f, 0.177927673f},
-std::array<float,2>{0.795128167f, 0.169888273f},
-std::array<float,2>{0.0931445435f, 0.890404046f},
-std::array<float,2>{0.676512659f, 0.615368664f},
-std::array<float,2>{0.251623511f, 0.42633304f},
-std::array<float,2>{0.623788774f, 0.299311042f},
-std::array<float,2>{0.429665357f, 0.68723917f},
-std::array<float,2>{0.9107849f, 0.782850564f},
-std::array<float,2>{0.208919749f, 0.0636647418f},
-std::array<float,2>{0.702095151f, 0.00827279594f},
-std::array<float,2>{0.327392071f, 0.818495095f},
-std::array<float,2>{0.847922564f, 0.74469471f},
-std::array<float,2>{0.028707277f, 0.350676298f},
-std::array<float,2>{0.981805325f, 0.467963904f},
-std::array<float,2>{0.170338541f, 0.528316975f},
-std::array<float,2>{0.51285392f, 0.999548137f},
-std::array<float,2>{0.478518188f, 0.217139199f},
-std::array<float,2>{0.88527441f, 0.124284357f},
-std::array<float,2>{0.224044621f, 0.755030036f},
-std::array<float,2>{0.579491317f, 0.656011641f},
-std::array<float,2>{0.392973632f, 0.275385737f},
-std::array<float,2>{0.655441582f, 0.389607459f},
-std::array<float,2>{0.308109045f, 0.569000304f},
-std::array<float,2>{0.759534538f, 0.9351843f},
-std::array<float,2>{0.111219458f, 0.152977228f},
-std::array<float,2>{0.533371389f, 0.249673784f},
-std::array<float,2>{0.458450645f, 0.939103961f},
-std::array<float,2>{0.956331015f, 0.541691184f},
-std::array<float,2>{0.145705834f, 0.476352006f},
-std::array<float,2>{0.838156462f, 0.314058244f},
-std::array<float,2>{0.0385391265f, 0.688783288f},
-std::array<float,2>{0.743190169f, 0.87452513f},
-std::array<float,2>{0.367723197f, 0.0612373054f},
-std::array<float,2>{0.83287555f, 0.10143593f},
-std::array<float,2>{0.0399953388f, 0.776346684f},
-std::array<float,2>{0.739927769f, 0.629529059f},
-std::array<float,2>{0.361845374f, 0.264261514f},
-std::array<float,2>{0.545102537f, 0.397098035f},
-std::array<float,2>{0.46664682f, 0.583145678f},
-std::array<float,2>{0.96511209f, 0.91970104f},
-std::array<float,2>{0.155062109f, 0.13892287f},
-std::array<float,2>{0.644896507f, 0.232991382f},
-std::array<float,2>{0.298217565f, 0.966904104f},
-std::array<float,2>{0.750315666f, 0.560398221f},
-std::array<float,2>{0.119474687f, 0.488128722f},
-std::array<float,2>{0.875429034f, 0.331981689f},
-std::array<float,2>{0.228591681f, 0.71498245f},
-std::array<float,2>{0.590396464f, 0.857471406f},
-std::array<float,2>{0.405211926f, 0.0417708755f},
-std::array<float,2>{0.970700562f, 0.173741758f},
-std::array<float,2>{0.161228508f, 0.894339919f},
-std::array<float,2>{0.507006466f, 0.607483149f},
-std::array<float,2>{0.470345706f, 0.407604814f},
-std::array<float,2>{0.694598019f, 0.288961232f},
-std::array<float,2>{0.31739834f, 0.664009929f},
-std::array<float,2>{0.857719779f, 0.800756574f},
-std::array<float,2>{0.0177328866f, 0.0902163908f},
-std::array<float,2>{0.610465646f, 0.0242670216f},
-std::array<float,2>{0.436252743f, 0.828928947f},
-std::array<float,2>{0.917140961f, 0.725495458f},
-std::array<float,2>{0.215763003f, 0.370984674f},
-std::array<float,2>{0.784942031f, 0.441446632f},
-std::array<float,2>{0.0790164322f, 0.501483262f},
-std::array<float,2>{0.683755159f, 0.981995046f},
-std::array<float,2>{0.26051262f, 0.18930079f},
-std::array<float,2>{0.768148661f, 0.212617993f},
-std::array<float,2>{0.0942508429f, 0.992242217f},
-std::array<float,2>{0.633847058f, 0.525645196f},
-std::array<float,2>{0.286502838f, 0.464707881f},
-std::array<float,2>{0.572237849f, 0.346382916f},
-std::array<float,2>{0.389944851f, 0.749234855f},
-std::array<float,2>{0.898467839f, 0.816112578f},
-std::array<float,2>{0.23797898f, 0.0146471411f},
-std::array<float,2>{0.730335236f, 0.0668880194f},
-std::array<float,2>{0.357366592f, 0.788640201f},
-std::array<float,2>{0.814402163f, 0.681224108f},
-std::array<float,2>{0.0622431897f, 0.302841991f},
-std::array<float,2>{0.941120744f, 0.425765038f},
-std::array<float,2>{0.129526868f, 0.610015273f},
-std::array<float,2>{0.555700719f, 0.88283062f},
-std::array<float,2>{0.451890022f, 0.164994881f},
-std::array<float,2>{0.933223128f, 0.0579685122f},
-std::array<float,2>{0.199139297f, 0.867520809f},
-std::array<float,2>{0.595995188f, 0.691528141f},
-std::array<float,2>{0.414460391f, 0.318647563f},
-std::array<float,2>{0.66728121f, 0.470929205f},
-std::array<float,2>{0.270140618f, 0.545710862f},
-std::array<float,2>{0.810455024f, 0.943261385f},
-std::array<float,2>{0.0684458762f, 0.24440448f},
-std::array<float,2>{0.530474246f, 0.150338814f},
-std::array<float,2>{0.492545217f, 0.930012405f},
-std::array<float,2>{0.99067986f, 0.564590633f},
-std::array<float,2>{0.175614253f, 0.386310875f},
-std::array<float,2>{0.865551531f, 0.277963012f},
-std::array<float,2>{0.0133093623f, 0.65230459f},
-std::array<float,2>{0.706936896f, 0.751906276f},
-std::array<float,2>{0.331490755f, 0.119618326f},
-std::array<float,2>{0.803041637f, 0.000972787035f},
-std::array<float,2>{0.0711480677f, 0.823608696f},
-std::array<float,2>{0.6581828f, 0.740195572f},
-std::array<float,2>{0.275303066f, 0.354639232f},
-std::array<float,2>{0.603072166f, 0.460078388f},
-std::array<float,2>{0.410413325f, 0.520323038f},
-std::array<float,2>{0.924256086f, 0.987744093f},
-std::array<float,2>{0.18795906f, 0.209122047f},
-std::array<float,2>{0.717758417f, 0.164041206f},
-std::array<float,2>{0.339640707f, 0.877485693f},
-std::array<float,2>{0.871358693f, 0.622990429f},
-std::array<float,2>{0.00558209186f, 0.434035748f},
-std::array<float,2>{0.994190097f, 0.312243581f},
-std::array<float,2>{0.180969253f, 0.676591873f},
-std::array<float,2>{0.518689811f, 0.791699231f},
-std::array<float,2>{0.489367038f, 0.0773031712f},
-std::array<float,2>{0.891314924f, 0.238529176f},
-std::array<float,2>{0.247399434f, 0.950966775f},
-std::array<float,2>{0.563108087f, 0.53812319f},
-std::array<float,2>{0.382544249f, 0.483125925f},
-std::array<float,2>{0.631137073f, 0.324095815f},
-std::array<float,2>{0.291832596f, 0.697837353f},
-std::array<float,2>{0.777489424f, 0.86432898f},
-std::array<float,2>{0.106983148f, 0.0534594432f},
-std::array<float,2>{0.553221881f, 0.116978087f},
-std::array<float,2>{0.438717127f, 0.762895107f},
-std::array<float,2>{0.946681738f, 0.646904409f},
-std::array<float,2>{0.137438521f, 0.272663385f},
-std::array<float,2>{0.823189139f, 0.379632533f},
-std::array<float,2>{0.0471254587f, 0.577936053f},
-std::array<float,2>{0.719144046f, 0.923738658f},
-std::array<float,2>{0.348305762f, 0.14457345f},
-std::array<float,2>{0.845649421f, 0.129592672f},
-std::array<float,2>{0.0264925156f, 0.907238543f},
-std::array<float,2>{0.696269512f, 0.586763322f},
-std::array<float,2>{0.323528975f, 0.405145377f},
-std::array<float,2>{0.509042144f, 0.253637403f},
-std::array<float,2>{0.483168542f, 0.635359108f},
-std::array<float,2>{0.979744673f, 0.76923573f},
-std::array<float,2>{0.16472055f, 0.103808343f},
-std::array<float,2>{0.675503135f, 0.0351650417f},
-std::array<float,2>{0.257165492f, 0.846277237f},
-std::array<float,2>{0.790546715f, 0.703891337f},
-std::array<float,2>{0.0898072049f, 0.336265236f},
-std::array<float,2>{0.906556726f, 0.492329478f},
-std::array<float,2>{0.203464031f, 0.548785567f},
-std::array<float,2>{0.620863855f, 0.960039139f},
-std::array<float,2>{0.423189878f, 0.223258421f},
-std::array<float,2>{0.9607777f, 0.0828358606f},
-std::array<float,2>{0.14452301f, 0.810941637f},
-std::array<float,2>{0.537290633f, 0.670848012f},
-std::array<float,2>{0.455724478f, 0.292292684f},
-std::array<float,2>{0.748169124f, 0.414815694f},
-std::array<float,2>{0.371827185f, 0.60080564f},
-std::array<float,2>{0.841593266f, 0.904452682f},
-std::array<float,2>{0.0332843326f, 0.181917399f},
-std::array<float,2>{0.585108995f, 0.19725652f},
-std::array<float,2>{0.397711694f, 0.974631667f},
-std::array<float,2>{0.890394628f, 0.513255656f},
-std::array<float,2>{0.219701141f, 0.449535906f},
-std::array<float,2>{0.761770129f, 0.362597853f},
-std::array<float,2>{0.114487372f, 0.727615237f},
-std::array<float,2>{0.650871396f, 0.836022794f},
-std::array<float,2>{0.311712712f, 0.0207986739f},
-std::array<float,2>{0.793134928f, 0.0643642992f},
-std::array<float,2>{0.0909058973f, 0.78240335f},
-std::array<float,2>{0.678152621f, 0.686612546f},
-std::array<float,2>{0.252346098f, 0.299634129f},
-std::array<float,2>{0.622719646f, 0.425995946f},
-std::array<float,2>{0.427251756f, 0.616195202f},
-std::array<float,2>{0.913008451f, 0.889737427f},
-std::array<float,2>{0.210546821f, 0.169014245f},
-std::array<float,2>{0.699705601f, 0.217434838f},
-std::array<float,2>{0.32509315f, 0.999216318f},
-std::array<float,2>{0.851508856f, 0.527366161f},
-std::array<float,2>{0.030392712f, 0.468595922f},
-std::array<float,2>{0.984288037f, 0.351237237f},
-std::array<float,2>{0.168096483f, 0.744324803f},
-std::array<float,2>{0.513998389f, 0.819000304f},
-std::array<float,2>{0.478277206f, 0.0086456174f},
-std::array<float,2>{0.883135974f, 0.152519017f},
-std::array<float,2>{0.225734323f, 0.93480587f},
-std::array<float,2>{0.5801332f, 0.568719923f},
-std::array<float,2>{0.391223222f, 0.388845444f},
-std::array<float,2>{0.653506219f, 0.274561763f},
-std::array<float,2>{0.305652499f, 0.655507147f},
-std::array<float,2>{0.760984421f, 0.755696952f},
-std::array<float,2>{0.112713404f, 0.124539666f},
-std::array<float,2>{0.531603754f, 0.0610193945f},
-std::array<float,2>{0.460923672f, 0.874148726f},
-std::array<float,2>{0.954748988f, 0.689348578f},
-std::array<float,2>{0.147491351f, 0.313588142f},
-std::array<float,2>{0.837442219f, 0.475881875f},
-std::array<float,2>{0.0354538001f, 0.54106611f},
-std::array<float,2>{0.744301856f, 0.938806236f},
-std::array<float,2>{0.369615376f, 0.249366254f},
-std::array<float,2>{0.870476007f, 0.228185728f},
-std::array<float,2>{0.000698079821f, 0.964014471f},
-std::array<float,2>{0.712879002f, 0.556659222f},
-std::array<float,2>{0.34327969f, 0.488461524f},
-std::array<float,2>{0.523126423f, 0.335729837f},
-std::array<float,2>{0.487833649f, 0.713052571f},
-std::array<float,2>{0.998108149f, 0.855062604f},
-std::array<float,2>{0.185684249f, 0.0450801589f},
-std::array<float,2>{0.660503089f, 0.0957001299f},
-std::array<float,2>{0.280540645f, 0.778386056f},
-std::array<float,2>{0.798064232f, 0.625994325f},
-std::array<float,2>{0.0764762685f, 0.259801954f},
-std::array<float,2>{0.926661611f, 0.391873449f},
-std::array<float,2>{0.192525655f, 0.580550194f},
-std::array<float,2>{0.608690679f, 0.917424738f},
-std::array<float,2>{0.406738698f, 0.132867694f},
-std::array<float,2>{0.949748158f, 0.0288794748f},
-std::array<float,2>{0.134707943f, 0.835692823f},
-std::array<float,2>{0.550592303f, 0.721978724f},
-std::array<float,2>{0.4420138f, 0.372035593f},
-std::array<float,2>{0.723888516f, 0.439453483f},
-std::array<float,2>{0.344919086f, 0.507615685f},
-std::array<float,2>{0.825945139f, 0.979405284f},
-std::array<float,2>{0.0539798401f, 0.193054333f},
-std::array<float,2>{0.56838727f, 0.17835775f},
-std::array<float,2>{0.37632212f, 0.896880448f},
-std::array<float,2>{0.897697806f, 0.605245233f},
-std::array<float,2>{0.24438338f, 0.413180649f},
-std::array<float,2>{0.776616633f, 0.284406662f},
-std::array<float,2>{0.104148246f, 0.657481432f},
-std::array<float,2>{0.625433743f, 0.802275538f},
-std::array<float,2>{0.296484172f, 0.0884349421f},
-std::array<float,2>{0.820248604f, 0.0325864963f},
-std::array<float,2>{0.0574581698f, 0.851371944f},
-std::array<float,2>{0.732818246f, 0.709436595f},
-std::array<float,2>{0.354196608f, 0.343043715f},
-std::array<float,2>{0.559322178f, 0.497915268f},
-std::array<float,2>{0.445377231f, 0.551036716f},
-std::array<float,2>{0.944420516f, 0.954665959f},
-std::array<float,2>{0.128132552f, 0.221014962f},
-std::array<float,2>{0.63818568f, 0.126741797f},
-std::array<float,2>{0.281770378f, 0.912943006f},
-std::array<float,2>{0.771621823f, 0.590492249f},
-std::array<float,2>{0.0987135246f, 0.400948375f},
-std::array<float,2>{0.905198634f, 0.256010443f},
-std::array<float,2>{0.23918654f, 0.640312552f},
-std::array<float,2>{0.576976717f, 0.7724455f},
-std::array<float,2>{0.383046508f, 0.108476199f},
-std::array<float,2>{0.987543464f, 0.201148182f},
-std::array<float,2>{0.178816408f, 0.969557166f},
-std::array<float,2>{0.524490476f, 0.508043528f},
-std::array<float,2>{0.497497439f, 0.447254717f},
-std::array<float,2>{0.708474159f, 0.3658261f},
-std::array<float,2>{0.335704267f, 0.733207643f},
-std::array<float,2>{0.862089932f, 0.841599166f},
-std::array<float,2>{0.0110720852f, 0.0182416737f},
-std::array<float,2>{0.598544836f, 0.0809930041f},
-std::array<float,2>{0.418299586f, 0.808226705f},
-std::array<float,2>{0.93474108f, 0.666955054f},
-std::array<float,2>{0.201260775f, 0.296142548f},
-std::array<float,2>{0.805998206f, 0.419306993f},
-std::array<float,2>{0.0631610602f, 0.596428037f},
-std::array<float,2>{0.670534074f, 0.901325285f},
-std::array<float,2>{0.266848117f, 0.183623493f},
-std::array<float,2>{0.75703007f, 0.158917159f},
-std::array<float,2>{0.123114966f, 0.879246056f},
-std::array<float,2>{0.644486189f, 0.618960559f},
-std::array<float,2>{0.302234381f, 0.430520087f},
-std::array<float,2>{0.586188793f, 0.307951003f},
-std::array<float,2>{0.401365608f, 0.674809396f},
-std::array<float,2>{0.881349444f, 0.793793976f},
-std::array<float,2>{0.231105164f, 0.0719181299f},
-std::array<float,2>{0.736137331f, 0.00448416313f},
-std::array<float,2>{0.36650911f, 0.826788008f},
-std::array<float,2>{0.830069065f, 0.738104701f},
-std::array<float,2>{0.0458473936f, 0.359129369f},
-std::array<float,2>{0.961463928f, 0.454589427f},
-std::array<float,2>{0.15226151f, 0.519369781f},
-std::array<float,2>{0.541327477f, 0.991095901f},
-std::array<float,2>{0.464303702f, 0.203551605f},
-std::array<float,2>{0.919763982f, 0.112317696f},
-std::array<float,2>{0.213792548f, 0.760696113f},
-std::array<float,2>{0.616847456f, 0.641675353f},
-std::array<float,2>{0.433011472f, 0.269140512f},
-std::array<float,2>{0.681625426f, 0.378826916f},
-std::array<float,2>{0.261730075f, 0.573384702f},
-std::array<float,2>{0.788114429f, 0.928395033f},
-std::array<float,2>{0.0831539854f, 0.143742427f},
-std::array<float,2>{0.500914156f, 0.237740904f},
-std::array<float,2>{0.472723007f, 0.948972404f},
-std::array<float,2>{0.973167121f, 0.532407403f},
-std::array<float,2>{0.157222688f, 0.478954583f},
-std::array<float,2>{0.853536129f, 0.325422913f},
-std::array<float,2>{0.0212363917f, 0.702456534f},
-std::array<float,2>{0.689365685f, 0.863195837f},
-std::array<float,2>{0.312500834f, 0.0488796532f},
-std::array<float,2>{0.846093178f, 0.10442055f},
-std::array<float,2>{0.0236301422f, 0.768867552f},
-std::array<float,2>{0.697494626f, 0.635112822f},
-std::array<float,2>{0.321554691f, 0.253104687f},
-std::array<float,2>{0.51023674f, 0.404613405f},
-std::array<float,2>{0.48080194f, 0.586190045f},
-std::array<float,2>{0.977982998f, 0.907760203f},
-std::array<float,2>{0.167767614f, 0.129117981f},
-std::array<float,2>{0.672272682f, 0.222751886f},
-std::array<float,2>{0.25514105f, 0.960824311f},
-std::array<float,2>{0.792949259f, 0.548083007f},
-std::array<float,2>{0.0870098025f, 0.493136704f},
-std::array<float,2>{0.908495069f, 0.336587757f},
-std::array<float,2>{0.206842795f, 0.703206658f},
-std::array<float,2>{0.617766201f, 0.845738292f},
-std::array<float,2>{0.425017476f, 0.0360579081f},
-std::array<float,2>{0.958590329f, 0.182387143f},
-std::array<float,2>{0.141070396f, 0.905130208f},
-std::array<float,2>{0.535308778f, 0.601235151f},
-std::array<float,2>{0.454711318f, 0.414183885f},
-std::array<float,2>{0.748010576f, 0.292511106f},
-std::array<float,2>{0.374002904f, 0.669949412f},
-std::array<float,2>{0.84351331f, 0.811330378f},
-std::array<float,2>{0.0319535471f, 0.0824112594f},
-std::array<float,2>{0.582734227f, 0.0210094992f},
-std::array<float,2>{0.394654423f, 0.836826026f},
-std::array<float,2>{0.887233317f, 0.72825706f},
-std::array<float,2>{0.221982688f, 0.363105834f},
-std::array<float,2>{0.764803708f, 0.450128406f},
-std::array<float,2>{0.115376428f, 0.512865841f},
-std::array<float,2>{0.649050772f, 0.975170374f},
-std::array<float,2>{0.309774786f, 0.196577847f},
-std::array<float,2>{0.801427543f, 0.209480345f},
-std::array<float,2>{0.0722910538f, 0.988119483f},
-std::array<float,2>{0.659490764f, 0.519569755f},
-std::array<float,2>{0.275866985f, 0.460723162f},
-std::array<float,2>{0.603923917f, 0.355233252f},
-std::array<float,2>{0.413723618f, 0.739535511f},
-std::array<float,2>{0.922624588f, 0.823743999f},
-std::array<float,2>{0.190953746f, 0.000450760155f},
-std::array<float,2>{0.716183007f, 0.0780368075f},
-std::array<float,2>{0.336378545f, 0.791126668f},
-std::array<float,2>{0.874030948f, 0.675859451f},
-std::array<float,2>{0.00647089863f, 0.311953068f},
-std::array<float,2>{0.994041085f, 0.434141934f},
-std::array<float,2>{0.181931168f, 0.622454047f},
-std::array<float,2>{0.516347229f, 0.877040207f},
-std::array<float,2>{0.491071373f, 0.163325235f},
-std::array<float,2>{0.894263804f, 0.0531238317f},
-std::array<float,2>{0.248326883f, 0.86499685f},
-std::array<float,2>{0.565834343f, 0.697667956f},
-std::array<float,2>{0.380707651f, 0.323650062f},
-std::array<float,2>{0.62963891f, 0.482809693f},
-std::array<float,2>{0.289674073f, 0.538904011f},
-std::array<float,2>{0.779331386f, 0.950357318f},
-std::array<float,2>{0.108608432f, 0.23899053f},
-std::array<float,2>{0.552116394f, 0.14545618f},
-std::array<float,2>{0.441301584f, 0.923257232f},
-std::array<float,2>{0.947389722f, 0.577537119f},
-std::array<float,2>{0.138948977f, 0.379385352f},
-std::array<float,2>{0.82051158f, 0.273221076f},
-std::array<float,2>{0.0506882481f, 0.647356987f},
-std::array<float,2>{0.721449435f, 0.76365757f},
-std::array<float,2>{0.351104558f, 0.116288833f},
-std::array<float,2>{0.767062008f, 0.0137080019f},
-std::array<float,2>{0.0966092274f, 0.815692186f},
-std::array<float,2>{0.636013985f, 0.749563217f},
-std::array<float,2>{0.287317246f, 0.345976233f},
-std::array<float,2>{0.573512077f, 0.463869303f},
-std::array<float,2>{0.386872172f, 0.525895417f},
-std::array<float,2>{0.901727915f, 0.993057132f},
-std::array<float,2>{0.23454605f, 0.211949527f},
-std::array<float,2>{0.727582514f, 0.164537609f},
-std::array<float,2>{0.359269321f, 0.883753419f},
-std::array<float,2>{0.81453687f, 0.609770358f},
-std::array<float,2>{0.0589491911f, 0.424913168f},
-std::array<float,2>{0.938879728f, 0.303334326f},
-std::array<float,2>{0.130876765f, 0.680888176f},
-std::array<float,2>{0.556712806f, 0.788487434f},
-std::array<float,2>{0.450023174f, 0.0672272444f},
-std::array<float,2>{0.93093729f, 0.24495323f},
-std::array<float,2>{0.196912661f, 0.942535162f},
-std::array<float,2>{0.594043553f, 0.545154452f},
-std::array<float,2>{0.416627645f, 0.471541345f},
-std::array<float,2>{0.664806485f, 0.319295436f},
-std::array<float,2>{0.273135632f, 0.692265451f},
-std::array<float,2>{0.811286032f, 0.868005812f},
-std::array<float,2>{0.0669516176f, 0.0585196093f},
-std::array<float,2>{0.527998567f, 0.120008223f},
-std::array<float,2>{0.494247943f, 0.751086712f},
-std::array<float,2>{0.989917278f, 0.651556611f},
-std::array<float,2>{0.172133967f, 0.27770707f},
-std::array<float,2>{0.864772439f, 0.3857885f},
-std::array<float,2>{0.0145967407f, 0.564952314f},
-std::array<float,2>{0.704012752f, 0.930545568f},
-std::array<float,2>{0.328149021f, 0.14965488f},
-std::array<float,2>{0.835484922f, 0.139604166f},
-std::array<float,2>{0.042775616f, 0.919378161f},
-std::array<float,2>{0.742004633f, 0.583751619f},
-std::array<float,2>{0.360113859f, 0.3965137f},
-std::array<float,2>{0.544156253f, 0.263756603f},
-std::array<float,2>{0.46741578f, 0.62920481f},
-std::array<float,2>{0.967095077f, 0.775877714f},
-std::array<float,2>{0.153768227f, 0.100838654f},
-std::array<float,2>{0.647193193f, 0.0410770401f},
-std::array<float,2>{0.300069213f, 0.858266413f},
-std::array<float,2>{0.752764165f, 0.715737939f},
-std::array<float,2>{0.117831923f, 0.331205219f},
-std::array<float,2>{0.878305078f, 0.487382382f},
-std::array<float,2>{0.227556676f, 0.559626043f},
-std::array<float,2>{0.592862546f, 0.967597008f},
-std::array<float,2>{0.404284984f, 0.232628092f},
-std::array<float,2>{0.972614229f, 0.0905660316f},
-std::array<float,2>{0.16393739f, 0.800070643f},
-std::array<float,2>{0.50531888f, 0.663264334f},
-std::array<float,2>{0.471271545f, 0.288354903f},
-std::array<float,2>{0.691662192f, 0.408034295f},
-std::array<float,2>{0.319874942f, 0.608067274f},
-std::array<float,2>{0.857125044f, 0.893771231f},
-std::array<float,2>{0.0161694065f, 0.173281789f},
-std::array<float,2>{0.612014949f, 0.188919321f},
-std::array<float,2>{0.435490727f, 0.981844366f},
-std::array<float,2>{0.915204525f, 0.501329422f},
-std::array<float,2>{0.218067586f, 0.441948026f},
-std::array<float,2>{0.782514155f, 0.370472461f},
-std::array<float,2>{0.0803703889f, 0.724675238f},
-std::array<float,2>{0.687218785f, 0.828240037f},
-std::array<float,2>{0.258687288f, 0.023660209f},
-std::array<float,2>{0.758950531f, 0.121458866f},
-std::array<float,2>{0.110720351f, 0.757426143f},
-std::array<float,2>{0.65622431f, 0.654016912f},
-std::array<float,2>{0.307835191f, 0.276205838f},
-std::array<float,2>{0.579843462f, 0.388588995f},
-std::array<float,2>{0.393296599f, 0.566686392f},
-std::array<float,2>{0.884991825f, 0.935829222f},
-std::array<float,2>{0.224393144f, 0.154918924f},
-std::array<float,2>{0.743893743f, 0.247883171f},
-std::array<float,2>{0.36725235f, 0.940638542f},
-std::array<float,2>{0.838411629f, 0.540249646f},
-std::array<float,2>{0.0388378128f, 0.474069625f},
-std::array<float,2>{0.956620932f, 0.314798594f},
-std::array<float,2>{0.146203503f, 0.690130353f},
-std::array<float,2>{0.533954918f, 0.871304452f},
-std::array<float,2>{0.458884895f, 0.0596345402f},
-std::array<float,2>{0.910616696f, 0.171455652f},
-std::array<float,2>{0.208068803f, 0.888545036f},
-std::array<float,2>{0.62344259f, 0.613772094f},
-std::array<float,2>{0.428952694f, 0.428174764f},
-std::array<float,2>{0.676118255f, 0.298376948f},
-std::array<float,2>{0.251111686f, 0.685214221f},
-std::array<float,2>{0.795579731f, 0.783476233f},
-std::array<float,2>{0.0932679176f, 0.0646855608f},
-std::array<float,2>{0.513300717f, 0.0109957252f},
-std::array<float,2>{0.479446799f, 0.817068636f},
-std::array<float,2>{0.982008576f, 0.743152738f},
-std::array<float,2>{0.170504972f, 0.348799318f},
-std::array<float,2>{0.848384798f, 0.465038627f},
-std::array<float,2>{0.0291066132f, 0.530651152f},
-std::array<float,2>{0.701289237f, 0.996496797f},
-std::array<float,2>{0.3279351f, 0.215106785f},
-std::array<float,2>{0.828097463f, 0.194505528f},
-std::array<float,2>{0.0516355559f, 0.978370368f},
-std::array<float,2>{0.725302994f, 0.50402838f},
-std::array<float,2>{0.34673366f, 0.439181477f},
-std::array<float,2>{0.548573732f, 0.37455526f},
-std::array<float,2>{0.445241064f, 0.719959497f},
-std::array<float,2>{0.952086568f, 0.833001971f},
-std::array<float,2>{0.134786576f, 0.0295156222f},
-std::array<float,2>{0.627866685f, 0.0878140554f},
-std::array<float,2>{0.294078857f, 0.803870797f},
-std::array<float,2>{0.774974465f, 0.658366323f},
-std::array<float,2>{0.102571078f, 0.282723039f},
-std::array<float,2>{0.895412922f, 0.411824077f},
-std::array<float,2>{0.242738262f, 0.60279882f},
-std::array<float,2>{0.566593945f, 0.895747423f},
-std::array<float,2>{0.377074003f, 0.176703244f},
-std::array<float,2>{0.996173263f, 0.0440559424f},
-std::array<float,2>{0.18379882f, 0.852073491f},
-std::array<float,2>{0.519738197f, 0.712634683f},
-std::array<float,2>{0.485521853f, 0.332661659f},
-std::array<float,2>{0.714488626f, 0.490402639f},
-std::array<float,2>{0.340253472f, 0.556616783f},
-std::array<float,2>{0.868938565f, 0.961808085f},
-std::array<float,2>{0.00275326543f, 0.23002626f},
-std::array<float,2>{0.606287837f, 0.134933114f},
-std::array<float,2>{0.409858227f, 0.914204717f},
-std::array<float,2>{0.929516733f, 0.579305172f},
-std::array<float,2>{0.193455994f, 0.393341929f},
-std::array<float,2>{0.79998982f, 0.259705871f},
-std::array<float,2>{0.0761646926f, 0.628414214f},
-std::array<float,2>{0.663581192f, 0.781124294f},
-std::array<float,2>{0.278687716f, 0.0957451463f},
-std::array<float,2>{0.860567272f, 0.0171266254f},
-std::array<float,2>{0.00852832384f, 0.841844618f},
-std::array<float,2>{0.709933341f, 0.731970072f},
-std::array<float,2>{0.333672822f, 0.364548862f},
-std::array<float,2>{0.52691865f, 0.449015081f},
-std::array<float,2>{0.499524504f, 0.511351228f},
-std::array<float,2>{0.985942006f, 0.97253859f},
-std::array<float,2>{0.17751579f, 0.202574208f},
-std::array<float,2>{0.669466496f, 0.187028617f},
-std::array<float,2>{0.268065959f, 0.898962438f},
-std::array<float,2>{0.808039665f, 0.594564557f},
-std::array<float,2>{0.0654696152f, 0.421580136f},
-std::array<float,2>{0.936713278f, 0.293100297f},
-std::array<float,2>{0.19964157f, 0.664983749f},
-std::array<float,2>{0.600803256f, 0.806325793f},
-std::array<float,2>{0.421646506f, 0.0781773478f},
-std::array<float,2>{0.94148922f, 0.218854681f},
-std::array<float,2>{0.126018882f, 0.95685935f},
-std::array<float,2>{0.561562121f, 0.554121554f},
-std::array<float,2>{0.448328733f, 0.499946415f},
-std::array<float,2>{0.730645418f, 0.340225846f},
-std::array<float,2>{0.352594107f, 0.707772195f},
-std::array<float,2>{0.817979932f, 0.848514915f},
-std::array<float,2>{0.0549191795f, 0.0343923904f},
-std::array<float,2>{0.574996352f, 0.105625585f},
-std::array<float,2>{0.386268705f, 0.770575047f},
-std::array<float,2>{0.90375638f, 0.637737989f},
-std::array<float,2>{0.240403995f, 0.255567014f},
-std::array<float,2>{0.770561218f, 0.39954716f},
-std::array<float,2>{0.100111358f, 0.593569338f},
-std::array<float,2>{0.640166163f, 0.911288738f},
-std::array<float,2>{0.283844054f, 0.127392501f},
-std::array<float,2>{0.786775351f, 0.140793085f},
-std::array<float,2>{0.0852714479f, 0.926673114f},
-std::array<float,2>{0.683130622f, 0.571705163f},
-std::array<float,2>{0.263686031f, 0.375282735f},
-std::array<float,2>{0.613841116f, 0.266903311f},
-std::array<float,2>{0.431356788f, 0.644401014f},
-std::array<float,2>{0.920636773f, 0.758601606f},
-std::array<float,2>{0.212495193f, 0.110269904f},
-std::array<float,2>{0.690859139f, 0.0469183624f},
-std::array<float,2>{0.315971226f, 0.860009074f},
-std::array<float,2>{0.852910101f, 0.699703753f},
-std::array<float,2>{0.0232492425f, 0.328052372f},
-std::array<float,2>{0.975699067f, 0.478110045f},
-std::array<float,2>{0.159781486f, 0.533985138f},
-std::array<float,2>{0.503279209f, 0.947137892f},
-std::array<float,2>{0.476337761f, 0.235953689f},
-std::array<float,2>{0.880242169f, 0.0725511312f},
-std::array<float,2>{0.233609453f, 0.795162916f},
-std::array<float,2>{0.589807391f, 0.673720777f},
-std::array<float,2>{0.399884701f, 0.306063265f},
-std::array<float,2>{0.642134547f, 0.432789803f},
-std::array<float,2>{0.303610951f, 0.62107259f},
-std::array<float,2>{0.755348861f, 0.88168323f},
-std::array<float,2>{0.122281559f, 0.156737596f},
-std::array<float,2>{0.539713562f, 0.205303401f},
-std::array<float,2>{0.461847752f, 0.988593757f},
-std::array<float,2>{0.964273453f, 0.5169366f},
-std::array<float,2>{0.149002075f, 0.456738591f},
-std::array<float,2>{0.830830872f, 0.356701434f},
-std::array<float,2>{0.0435691923f, 0.735039353f},
-std::array<float,2>{0.737672985f, 0.825685263f},
-std::array<float,2>{0.363763392f, 0.00623956742f},
-std::array<float,2>{0.841142237f, 0.0855082646f},
-std::array<float,2>{0.033760082f, 0.809307814f},
-std::array<float,2>{0.749008715f, 0.668611288f},
-std::array<float,2>{0.371329844f, 0.290809393f},
-std::array<float,2>{0.537686646f, 0.417027056f},
-std::array<float,2>{0.455373377f, 0.598506272f},
-std::array<float,2>{0.960175157f, 0.903856397f},
-std::array<float,2>{0.143852383f, 0.181298569f},
-std::array<float,2>{0.651319802f, 0.198051572f},
-std::array<float,2>{0.312270671f, 0.973754466f},
-std::array<float,2>{0.762228727f, 0.514213026f},
-std::array<float,2>{0.114825718f, 0.452156007f},
-std::array<float,2>{0.889743328f, 0.360050052f},
-std::array<float,2>{0.218921274f, 0.728812218f},
-std::array<float,2>{0.585567951f, 0.839460135f},
-std::array<float,2>{0.398341537f, 0.0216526948f},
-std::array<float,2>{0.980175436f, 0.131038353f},
-std::array<float,2>{0.164463252f, 0.909673274f},
-std::array<float,2>{0.509338558f, 0.589396656f},
-std::array<float,2>{0.482844532f, 0.40331009f},
-std::array<float,2>{0.695704162f, 0.25175643f},
-std::array<float,2>{0.323866159f, 0.633988976f},
-std::array<float,2>{0.845102906f, 0.766361058f},
-std::array<float,2>{0.0269592479f, 0.10196013f},
-std::array<float,2>{0.620422125f, 0.0371126793f},
-std::array<float,2>{0.423608184f, 0.844789326f},
-std::array<float,2>{0.906953633f, 0.706595004f},
-std::array<float,2>{0.203781202f, 0.339188486f},
-std::array<float,2>{0.790109634f, 0.494709611f},
-std::array<float,2>{0.0892829299f, 0.550182581f},
-std::array<float,2>{0.675117731f, 0.958449244f},
-std::array<float,2>{0.257600248f, 0.226008207f},
-std::array<float,2>{0.778227031f, 0.241731122f},
-std::array<float,2>{0.10644868f, 0.952091753f},
-std::array<float,2>{0.631495178f, 0.536930621f},
-std::array<float,2>{0.29123643f, 0.48202011f},
-std::array<float,2>{0.562529683f, 0.321984619f},
-std::array<float,2>{0.382294178f, 0.696914434f},
-std::array<float,2>{0.890927017f, 0.865528822f},
-std::array<float,2>{0.247931555f, 0.0511370488f},
-std::array<float,2>{0.71937269f, 0.114951126f},
-std::array<float,2>{0.347896636f, 0.764237523f},
-std::array<float,2>{0.822365582f, 0.645992398f},
-std::array<float,2>{0.0476415902f, 0.270573348f},
-std::array<float,2>{0.946992755f, 0.38165465f},
-std::array<float,2>{0.137131304f, 0.576143622f},
-std::array<float,2>{0.553709269f, 0.924763918f},
-std::array<float,2>{0.439038813f, 0.147934869f},
-std::array<float,2>{0.924692631f, 0.0034212342f},
-std::array<float,2>{0.18843241f, 0.820932984f},
-std::array<float,2>{0.602611303f, 0.741680145f},
-std::array<float,2>{0.411106706f, 0.352989256f},
-std::array<float,2>{0.65727514f, 0.457052946f},
-std::array<float,2>{0.274467528f, 0.523069263f},
-std::array<float,2>{0.803285062f, 0.984641075f},
-std::array<float,2>{0.0704024211f, 0.207478195f},
-std::array<float,2>{0.519401193f, 0.16139853f},
-std::array<float,2>{0.490063667f, 0.876769662f},
-std::array<float,2>{0.99496913f, 0.624933779f},
-std::array<float,2>{0.181626618f, 0.435825527f},
-std::array<float,2>{0.871994138f, 0.310206026f},
-std::array<float,2>{0.00534018828f, 0.677782476f},
-std::array<float,2>{0.716892362f, 0.790247023f},
-std::array<float,2>{0.338989675f, 0.0751550272f},
-std::array<float,2>{0.810041606f, 0.0562904775f},
-std::array<float,2>{0.0691473335f, 0.869443715f},
-std::array<float,2>{0.667921841f, 0.694468737f},
-std::array<float,2>{0.269818842f, 0.317648262f},
-std::array<float,2>{0.59632802f, 0.469214112f},
-std::array<float,2>{0.414786905f, 0.543044508f},
-std::array<float,2>{0.932879984f, 0.945065916f},
-std::array<float,2>{0.198407695f, 0.243756756f},
-std::array<float,2>{0.706151128f, 0.152294546f},
-std::array<float,2>{0.332003564f, 0.931784332f},
-std::array<float,2>{0.865779161f, 0.562637925f},
-std::array<float,2>{0.0127446949f, 0.383675307f},
-std::array<float,2>{0.990862429f, 0.280636877f},
-std::array<float,2>{0.174962237f, 0.648742795f},
-std::array<float,2>{0.530834556f, 0.752899349f},
-std::array<float,2>{0.492788255f, 0.118686318f},
-std::array<float,2>{0.899018407f, 0.21358335f},
-std::array<float,2>{0.237730727f, 0.994748056f},
-std::array<float,2>{0.571485996f, 0.524345279f},
-std::array<float,2>{0.390226573f, 0.462133616f},
-std::array<float,2>{0.634722829f, 0.344059438f},
-std::array<float,2>{0.287070602f, 0.746644437f},
-std::array<float,2>{0.767629683f, 0.814264119f},
-std::array<float,2>{0.0938768685f, 0.01332983f},
-std::array<float,2>{0.556168497f, 0.0690609068f},
-std::array<float,2>{0.451477349f, 0.786815822f},
-std::array<float,2>{0.940544784f, 0.683303714f},
-std::array<float,2>{0.12917839f, 0.301125824f},
-std::array<float,2>{0.813852072f, 0.422112048f},
-std::array<float,2>{0.0619842112f, 0.611768603f},
-std::array<float,2>{0.729898214f, 0.885775864f},
-std::array<float,2>{0.356878489f, 0.167707369f},
-std::array<float,2>{0.858106732f, 0.174734846f},
-std::array<float,2>{0.0181858409f, 0.892472565f},
-std::array<float,2>{0.694883704f, 0.606082916f},
-std::array<float,2>{0.317984402f, 0.409148812f},
-std::array<float,2>{0.50760293f, 0.28661567f},
-std::array<float,2>{0.470089257f, 0.661795795f},
-std::array<float,2>{0.970144629f, 0.797355413f},
-std::array<float,2>{0.161632359f, 0.0931288674f},
-std::array<float,2>{0.684320033f, 0.026814051f},
-std::array<float,2>{0.260144532f, 0.831811786f},
-std::array<float,2>{0.784554362f, 0.722941697f},
-std::array<float,2>{0.0783318132f, 0.367847174f},
-std::array<float,2>{0.917892158f, 0.444508076f},
-std::array<float,2>{0.215126663f, 0.502625704f},
-std::array<float,2>{0.610922396f, 0.983285487f},
-std::array<float,2>{0.436006427f, 0.190643281f},
-std::array<float,2>{0.965758443f, 0.0992614627f},
-std::array<float,2>{0.154723033f, 0.774476171f},
-std::array<float,2>{0.54548198f, 0.631091654f},
-std::array<float,2>{0.465927631f, 0.263587564f},
-std::array<float,2>{0.739626408f, 0.395605147f},
-std::array<float,2>{0.361661136f, 0.584711492f},
-std::array<float,2>{0.83217001f, 0.921495974f},
-std::array<float,2>{0.0391361751f, 0.138165414f},
-std::array<float,2>{0.590017498f, 0.231275335f},
-std::array<float,2>{0.404696554f, 0.96556747f},
-std::array<float,2>{0.875576556f, 0.560887337f},
-std::array<float,2>{0.229026884f, 0.485596955f},
-std::array<float,2>{0.750794768f, 0.328590184f},
-std::array<float,2>{0.120083891f, 0.716871679f},
-std::array<float,2>{0.645359933f, 0.857260764f},
-std::array<float,2>{0.298499227f, 0.0397563092f},
-std::array<float,2>{0.797466993f, 0.096686855f},
-std::array<float,2>{0.0774619281f, 0.779611766f},
-std::array<float,2>{0.661808312f, 0.627625406f},
-std::array<float,2>{0.279791355f, 0.258550107f},
-std::array<float,2>{0.608023345f, 0.394519508f},
-std::array<float,2>{0.407365173f, 0.578864992f},
-std::array<float,2>{0.92700237f, 0.915060759f},
-std::array<float,2>{0.191660747f, 0.136544719f},
-std::array<float,2>{0.711510122f, 0.229300082f},
-std::array<float,2>{0.342431158f, 0.962884605f},
-std::array<float,2>{0.869200468f, 0.555078506f},
-std::array<float,2>{0.00183190487f, 0.491780013f},
-std::array<float,2>{0.999158919f, 0.333009064f},
-std::array<float,2>{0.187335685f, 0.711244464f},
-std::array<float,2>{0.522050083f, 0.853356242f},
-std::array<float,2>{0.4868384f, 0.0434280559f},
-std::array<float,2>{0.89667511f, 0.176811069f},
-std::array<float,2>{0.245285243f, 0.894667029f},
-std::array<float,2>{0.570077538f, 0.60191977f},
-std::array<float,2>{0.375779629f, 0.411023855f},
-std::array<float,2>{0.626835167f, 0.281762511f},
-std::array<float,2>{0.295365065f, 0.659870088f},
-std::array<float,2>{0.77614063f, 0.802734852f},
-std::array<float,2>{0.104866907f, 0.0864959359f},
-std::array<float,2>{0.549219429f, 0.0305541512f},
-std::array<float,2>{0.442534506f, 0.83379811f},
-std::array<float,2>{0.951096058f, 0.719585657f},
-std::array<float,2>{0.133299813f, 0.373310238f},
-std::array<float,2>{0.824522972f, 0.437863201f},
-std::array<float,2>{0.0528645553f, 0.505157113f},
-std::array<float,2>{0.723144412f, 0.976617277f},
-std::array<float,2>{0.34456718f, 0.193565249f},
-std::array<float,2>{0.850265026f, 0.215859532f},
-std::array<float,2>{0.0299731437f, 0.997697294f},
-std::array<float,2>{0.701072752f, 0.529829741f},
-std::array<float,2>{0.325844586f, 0.466475844f},
-std::array<float,2>{0.514862597f, 0.348161966f},
-std::array<float,2>{0.476640046f, 0.744120717f},
-std::array<float,2>{0.983262956f, 0.817922413f},
-std::array<float,2>{0.16948989f, 0.0100551611f},
-std::array<float,2>{0.679479778f, 0.0656360686f},
-std::array<float,2>{0.253758401f, 0.784491003f},
-std::array<float,2>{0.794136226f, 0.683948636f},
-std::array<float,2>{0.0904821008f, 0.297355682f},
-std::array<float,2>{0.913199544f, 0.429578871f},
-std::array<float,2>{0.209092185f, 0.614946604f},
-std::array<float,2>{0.621752262f, 0.886954188f},
-std::array<float,2>{0.426143438f, 0.170078188f},
-std::array<float,2>{0.954066277f, 0.0590634122f},
-std::array<float,2>{0.147065118f, 0.872472405f},
-std::array<float,2>{0.532283962f, 0.691180587f},
-std::array<float,2>{0.459779352f, 0.316339225f},
-std::array<float,2>{0.746029019f, 0.473369271f},
-std::array<float,2>{0.370882928f, 0.539264262f},
-std::array<float,2>{0.836576879f, 0.939947128f},
-std::array<float,2>{0.0365027338f, 0.246764854f},
-std::array<float,2>{0.581931591f, 0.155631602f},
-std::array<float,2>{0.392434388f, 0.936680853f},
-std::array<float,2>{0.88389194f, 0.568304181f},
-std::array<float,2>{0.225505903f, 0.386927515f},
-std::array<float,2>{0.760102391f, 0.277078956f},
-std::array<float,2>{0.112062685f, 0.653307915f},
-std::array<float,2>{0.65306586f, 0.756202102f},
-std::array<float,2>{0.306242317f, 0.122884817f},
-std::array<float,2>{0.828754842f, 0.00762577122f},
-std::array<float,2>{0.0459883884f, 0.8249228f},
-std::array<float,2>{0.735232055f, 0.735361099f},
-std::array<float,2>{0.365429789f, 0.356211245f},
-std::array<float,2>{0.5420959f, 0.455219239f},
-std::array<float,2>{0.463627368f, 0.5156551f},
-std::array<float,2>{0.962022603f, 0.98979938f},
-std::array<float,2>{0.151045069f, 0.206525236f},
-std::array<float,2>{0.642720699f, 0.157715365f},
-std::array<float,2>{0.30174759f, 0.882270634f},
-std::array<float,2>{0.75680697f, 0.61929971f},
-std::array<float,2>{0.124788225f, 0.432426304f},
-std::array<float,2>{0.882447898f, 0.305024862f},
-std::array<float,2>{0.231657237f, 0.672080219f},
-std::array<float,2>{0.587027013f, 0.796410382f},
-std::array<float,2>{0.40210852f, 0.0734818056f},
-std::array<float,2>{0.974361777f, 0.234795213f},
-std::array<float,2>{0.158172205f, 0.94532907f},
-std::array<float,2>{0.501553476f, 0.535093546f},
-std::array<float,2>{0.474457502f, 0.4767735f},
-std::array<float,2>{0.687974095f, 0.32714361f},
-std::array<float,2>{0.313504755f, 0.700941563f},
-std::array<float,2>{0.855379522f, 0.861088753f},
-std::array<float,2>{0.0199397132f, 0.0487663709f},
-std::array<float,2>{0.616107404f, 0.1107044f},
-std::array<float,2>{0.431731194f, 0.759387493f},
-std::array<float,2>{0.918820381f, 0.643268645f},
-std::array<float,2>{0.214188576f, 0.266153902f},
-std::array<float,2>{0.787668943f, 0.376219541f},
-std::array<float,2>{0.0823310092f, 0.57038033f},
-std::array<float,2>{0.680024743f, 0.926908791f},
-std::array<float,2>{0.263394505f, 0.1423067f},
-std::array<float,2>{0.772610068f, 0.128320098f},
-std::array<float,2>{0.0979268178f, 0.910649121f},
-std::array<float,2>{0.637533844f, 0.592360079f},
-std::array<float,2>{0.282388449f, 0.399400175f},
-std::array<float,2>{0.578071952f, 0.254212707f},
-std::array<float,2>{0.384722799f, 0.63677305f},
-std::array<float,2>{0.905479372f, 0.769884109f},
-std::array<float,2>{0.240092933f, 0.107188568f},
-std::array<float,2>{0.734223068f, 0.0335765295f},
-std::array<float,2>{0.355313301f, 0.849477708f},
-std::array<float,2>{0.81918782f, 0.708900392f},
-std::array<float,2>{0.0584441125f, 0.341470212f},
-std::array<float,2>{0.944125593f, 0.498196423f},
-std::array<float,2>{0.127285674f, 0.55332768f},
-std::array<float,2>{0.559986115f, 0.95561552f},
-std::array<float,2>{0.446351409f, 0.220058829f},
-std::array<float,2>{0.933996201f, 0.0799245611f},
-std::array<float,2>{0.202825263f, 0.804884136f},
-std::array<float,2>{0.599139631f, 0.665370345f},
-std::array<float,2>{0.419414401f, 0.294429541f},
-std::array<float,2>{0.67185092f, 0.420435816f},
-std::array<float,2>{0.266436756f, 0.595254362f},
-std::array<float,2>{0.805541575f, 0.900207341f},
-std::array<float,2>{0.0638054013f, 0.185815379f},
-std::array<float,2>{0.523812711f, 0.201406881f},
-std::array<float,2>{0.49687165f, 0.971368134f},
-std::array<float,2>{0.986464262f, 0.510008514f},
-std::array<float,2>{0.178390339f, 0.447960228f},
-std::array<float,2>{0.862391174f, 0.363536328f},
-std::array<float,2>{0.010239617f, 0.73071748f},
-std::array<float,2>{0.707654357f, 0.843087971f},
-std::array<float,2>{0.334392399f, 0.0165006388f},
-std::array<float,2>{0.873660207f, 0.0756715015f},
-std::array<float,2>{0.00710589485f, 0.789128482f},
-std::array<float,2>{0.715209424f, 0.679653347f},
-std::array<float,2>{0.337861806f, 0.308602154f},
-std::array<float,2>{0.517050683f, 0.437448949f},
-std::array<float,2>{0.492094398f, 0.623584151f},
-std::array<float,2>{0.99299854f, 0.875054181f},
-std::array<float,2>{0.182661742f, 0.160309076f},
-std::array<float,2>{0.659090817f, 0.208932951f},
-std::array<float,2>{0.277204603f, 0.986142218f},
-std::array<float,2>{0.802672982f, 0.522379577f},
-std::array<float,2>{0.0740471184f, 0.458867818f},
-std::array<float,2>{0.923438251f, 0.351949334f},
-std::array<float,2>{0.19012779f, 0.741017401f},
-std::array<float,2>{0.605352283f, 0.822010159f},
-std::array<float,2>{0.412388295f, 0.00236895867f},
-std::array<float,2>{0.94846952f, 0.146617174f},
-std::array<float,2>{0.139880076f, 0.925440609f},
-std::array<float,2>{0.55143404f, 0.57453537f},
-std::array<float,2>{0.440415591f, 0.382359028f},
-std::array<float,2>{0.722343445f, 0.270486087f},
-std::array<float,2>{0.349939197f, 0.645404339f},
-std::array<float,2>{0.821342409f, 0.765267849f},
-std::array<float,2>{0.0494210869f, 0.113872983f},
-std::array<float,2>{0.565137923f, 0.0519730113f},
-std::array<float,2>{0.379137039f, 0.8668437f},
-std::array<float,2>{0.893131912f, 0.695746958f},
-std::array<float,2>{0.249825075f, 0.320655197f},
-std::array<float,2>{0.780645072f, 0.481107146f},
-std::array<float,2>{0.108308136f, 0.535867035f},
-std::array<float,2>{0.630215764f, 0.952538848f},
-std::array<float,2>{0.290990174f, 0.240704522f},
-std::array<float,2>{0.791687965f, 0.225149482f},
-std::array<float,2>{0.086384289f, 0.957365036f},
-std::array<float,2>{0.673618734f, 0.549508095f},
-std::array<float,2>{0.254516929f, 0.495514899f},
-std::array<float,2>{0.618549109f, 0.338130623f},
-std::array<float,2>{0.42446658f, 0.705100298f},
-std::array<float,2>{0.909997046f, 0.844085336f},
-std::array<float,2>{0.205262646f, 0.0381671824f},
-std::array<float,2>{0.698510349f, 0.103249602f},
-std::array<float,2>{0.321252048f, 0.767510295f},
-std::array<float,2>{0.847312987f, 0.633479655f},
-std::array<float,2>{0.0249328874f, 0.250848532f},
-std::array<float,2>{0.976904929f, 0.403912336f},
-std::array<float,2>{0.166120782f, 0.588664234f},
-std::array<float,2>{0.51097852f, 0.908627808f},
-std::array<float,2>{0.482287049f, 0.132237554f},
-std::array<float,2>{0.888076603f, 0.0229328405f},
-std::array<float,2>{0.221360281f, 0.837929189f},
-std::array<float,2>{0.583308578f, 0.73002404f},
-std::array<float,2>{0.395534098f, 0.360726088f},
-std::array<float,2>{0.649452329f, 0.451860785f},
-std::array<float,2>{0.309523731f, 0.515007257f},
-std::array<float,2>{0.764446139f, 0.973321378f},
-std::array<float,2>{0.117093518f, 0.198395342f},
-std::array<float,2>{0.536310792f, 0.179823488f},
-std::array<float,2>{0.453260243f, 0.903181136f},
-std::array<float,2>{0.957680583f, 0.59864068f},
-std::array<float,2>{0.14164193f, 0.416647643f},
-std::array<float,2>{0.842260301f, 0.289550841f},
-std::array<float,2>{0.0324640647f, 0.669222057f},
-std::array<float,2>{0.747015715f, 0.810287535f},
-std::array<float,2>{0.374036729f, 0.0847021341f},
-std::array<float,2>{0.753691852f, 0.0409993604f},
-std::array<float,2>{0.118693441f, 0.855939925f},
-std::array<float,2>{0.648112535f, 0.718192995f},
-std::array<float,2>{0.299086034f, 0.329241067f},
-std::array<float,2>{0.592667937f, 0.485340089f},
-std::array<float,2>{0.402715415f, 0.561647952f},
-std::array<float,2>{0.877088428f, 0.966207027f},
-std::array<float,2>{0.226742417f, 0.23161976f},
-std::array<float,2>{0.740473211f, 0.136966109f},
-std::array<float,2>{0.360545546f, 0.920252264f},
-std::array<float,2>{0.834736943f, 0.585438013f},
-std::array<float,2>{0.0411965251f, 0.394925743f},
-std::array<float,2>{0.968215406f, 0.262460321f},
-std::array<float,2>{0.152933359f, 0.632306695f},
-std::array<float,2>{0.543731868f, 0.773480952f},
-std::array<float,2>{0.468728125f, 0.0976572484f},
-std::array<float,2>{0.914943337f, 0.189974919f},
-std::array<float,2>{0.217743054f, 0.983653247f},
-std::array<float,2>{0.613176525f, 0.503573775f},
-std::array<float,2>{0.434281349f, 0.444111586f},
-std::array<float,2>{0.685763776f, 0.368407041f},
-std::array<float,2>{0.259564072f, 0.724136949f},
-std::array<float,2>{0.782137752f, 0.830737114f},
-std::array<float,2>{0.0814869255f, 0.0255380198f},
-std::array<float,2>{0.504253626f, 0.0918519944f},
-std::array<float,2>{0.472033352f, 0.79834038f},
-std::array<float,2>{0.970948279f, 0.660850286f},
-std::array<float,2>{0.162167743f, 0.285396218f},
-std::array<float,2>{0.856175363f, 0.410012096f},
-std::array<float,2>{0.0168071706f, 0.607329249f},
-std::array<float,2>{0.692814887f, 0.890981972f},
-std::array<float,2>{0.318965107f, 0.174899876f},
-std::array<float,2>{0.816073418f, 0.166079074f},
-std::array<float,2>{0.0600775853f, 0.885398269f},
-std::array<float,2>{0.727258146f, 0.61233151f},
-std::array<float,2>{0.357502908f, 0.42342326f},
-std::array<float,2>{0.558548152f, 0.302179992f},
-std::array<float,2>{0.450628579f, 0.681773365f},
-std::array<float,2>{0.938111246f, 0.785344183f},
-std::array<float,2>{0.132349551f, 0.0697615817f},
-std::array<float,2>{0.635583043f, 0.0121828197f},
-std::array<float,2>{0.288973927f, 0.812564433f},
-std::array<float,2>{0.765985847f, 0.747117221f},
-std::array<float,2>{0.0969779268f, 0.3454265f},
-std::array<float,2>{0.900723338f, 0.461541563f},
-std::array<float,2>{0.235910058f, 0.525204301f},
-std::array<float,2>{0.572498202f, 0.995150506f},
-std::array<float,2>{0.387833804f, 0.214718565f},
-std::array<float,2>{0.988667846f, 0.117444605f},
-std::array<float,2>{0.17339097f, 0.753753841f},
-std::array<float,2>{0.528852344f, 0.65012002f},
-std::array<float,2>{0.495432854f, 0.279473752f},
-std::array<float,2>{0.704948604f, 0.384519577f},
-std::array<float,2>{0.329487324f, 0.564034224f},
-std::array<float,2>{0.863571465f, 0.932697415f},
-std::array<float,2>{0.015019225f, 0.150799632f},
-std::array<float,2>{0.5956828f, 0.242299885f},
-std::array<float,2>{0.4177953f, 0.944278121f},
-std::array<float,2>{0.929947972f, 0.544468999f},
-std::array<float,2>{0.196222618f, 0.470335454f},
-std::array<float,2>{0.812108219f, 0.316893399f},
-std::array<float,2>{0.0677107126f, 0.693842053f},
-std::array<float,2>{0.665223539f, 0.8709566f},
-std::array<float,2>{0.272220612f, 0.0550093725f},
-std::array<float,2>{0.774325907f, 0.0895527825f},
-std::array<float,2>{0.102409251f, 0.80128181f},
-std::array<float,2>{0.628775656f, 0.657171428f},
-std::array<float,2>{0.293139994f, 0.283977836f},
-std::array<float,2>{0.567683399f, 0.41238308f},
-std::array<float,2>{0.378802449f, 0.604155421f},
-std::array<float,2>{0.896126807f, 0.897977352f},
-std::array<float,2>{0.243323967f, 0.179200366f},
-std::array<float,2>{0.726381183f, 0.192369759f},
-std::array<float,2>{0.346140802f, 0.97995615f},
-std::array<float,2>{0.82692802f, 0.50650239f},
-std::array<float,2>{0.0523367338f, 0.441060007f},
-std::array<float,2>{0.952907324f, 0.372148752f},
-std::array<float,2>{0.135919437f, 0.721171975f},
-std::array<float,2>{0.547107399f, 0.834508657f},
-std::array<float,2>{0.444028616f, 0.0282119215f},
-std::array<float,2>{0.928401411f, 0.134160236f},
-std::array<float,2>{0.194965541f, 0.916314721f},
-std::array<float,2>{0.606530786f, 0.581868887f},
-std::array<float,2>{0.409095138f, 0.391493618f},
-std::array<float,2>{0.662528872f, 0.261197686f},
-std::array<float,2>{0.277968436f, 0.625494242f},
-std::array<float,2>{0.79952544f, 0.778038442f},
-std::array<float,2>{0.0751538649f, 0.0938884765f},
-std::array<float,2>{0.520650208f, 0.0463099033f},
-std::array<float,2>{0.484410286f, 0.854363382f},
-std::array<float,2>{0.997220278f, 0.714126468f},
-std::array<float,2>{0.185444489f, 0.334386081f},
-std::array<float,2>{0.867812157f, 0.490076274f},
-std::array<float,2>{0.00390456803f, 0.558565199f},
-std::array<float,2>{0.713459492f, 0.962922513f},
-std::array<float,2>{0.341266483f, 0.22691378f},
-std::array<float,2>{0.838888466f, 0.248634294f},
-std::array<float,2>{0.0376001112f, 0.937586129f},
-std::array<float,2>{0.74273783f, 0.542855561f},
-std::array<float,2>{0.368934631f, 0.47499162f},
-std::array<float,2>{0.5346542f, 0.313000679f},
-std::array<float,2>{0.457258999f, 0.688163996f},
-std::array<float,2>{0.955842018f, 0.873692036f},
-std::array<float,2>{0.144961476f, 0.0619694367f},
-std::array<float,2>{0.654877961f, 0.123092838f},
-std::array<float,2>{0.30755645f, 0.754189491f},
-std::array<float,2>{0.758763552f, 0.654376626f},
-std::array<float,2>{0.109886073f, 0.273457646f},
-std::array<float,2>{0.885959744f, 0.389886469f},
-std::array<float,2>{0.223076567f, 0.570188105f},
-std::array<float,2>{0.578546345f, 0.934129953f},
-std::array<float,2>{0.394284457f, 0.153957084f},
-std::array<float,2>{0.980941355f, 0.00924481079f},
-std::array<float,2>{0.171142772f, 0.819546878f},
-std::array<float,2>{0.512673795f, 0.74517417f},
-std::array<float,2>{0.479825258f, 0.350557387f},
-std::array<float,2>{0.702339292f, 0.467678934f},
-std::array<float,2>{0.326617807f, 0.528416932f},
-std::array<float,2>{0.849408388f, 0.998831868f},
-std::array<float,2>{0.028199371f, 0.2184342f},
-std::array<float,2>{0.62481457f, 0.168450028f},
-std::array<float,2>{0.428184807f, 0.889605522f},
-std::array<float,2>{0.911561787f, 0.617178977f},
-std::array<float,2>{0.207330555f, 0.427358925f},
-std::array<float,2>{0.796853423f, 0.300779283f},
-std::array<float,2>{0.0923644155f, 0.686070442f},
-std::array<float,2>{0.67751509f, 0.781648338f},
-std::array<float,2>{0.250637293f, 0.0630166829f},
-std::array<float,2>{0.852421403f, 0.0500218682f},
-std::array<float,2>{0.0218039658f, 0.862094641f},
-std::array<float,2>{0.689941227f, 0.701489329f},
-std::array<float,2>{0.314476937f, 0.324600965f},
-std::array<float,2>{0.502480447f, 0.479762048f},
-std::array<float,2>{0.474752605f, 0.531275392f},
-std::array<float,2>{0.975347936f, 0.94736433f},
-std::array<float,2>{0.158467039f, 0.236632988f},
-std::array<float,2>{0.682318211f, 0.143103629f},
-std::array<float,2>{0.264740109f, 0.929360628f},
-std::array<float,2>{0.785825193f, 0.572995245f},
-std::array<float,2>{0.0848759264f, 0.377119154f},
-std::array<float,2>{0.921342731f, 0.267697632f},
-std::array<float,2>{0.211676359f, 0.641373396f},
-std::array<float,2>{0.614918292f, 0.761314094f},
-std::array<float,2>{0.430652738f, 0.112012021f},
-std::array<float,2>{0.963688672f, 0.204899922f},
-std::array<float,2>{0.150128782f, 0.991487324f},
-std::array<float,2>{0.540079296f, 0.518330336f},
-std::array<float,2>{0.462317258f, 0.45352155f},
-std::array<float,2>{0.736762404f, 0.357926548f},
-std::array<float,2>{0.364420176f, 0.737217784f},
-std::array<float,2>{0.831962883f, 0.828117311f},
-std::array<float,2>{0.0445268266f, 0.00538767967f},
-std::array<float,2>{0.588003099f, 0.0707650483f},
-std::array<float,2>{0.399010748f, 0.794284642f},
-std::array<float,2>{0.879704595f, 0.673958182f},
-std::array<float,2>{0.233167708f, 0.307347208f},
-std::array<float,2>{0.754842341f, 0.430699736f},
-std::array<float,2>{0.121534824f, 0.617550433f},
-std::array<float,2>{0.641018927f, 0.880840898f},
-std::array<float,2>{0.304405361f, 0.159618482f},
-std::array<float,2>{0.807195663f, 0.184608176f},
-std::array<float,2>{0.0651124865f, 0.902074397f},
-std::array<float,2>{0.668175697f, 0.597401798f},
-std::array<float,2>{0.269283205f, 0.418767959f},
-std::array<float,2>{0.599664688f, 0.295736194f},
-std::array<float,2>{0.4201729f, 0.667229354f},
-std::array<float,2>{0.936092794f, 0.807405472f},
-std::array<float,2>{0.200481519f, 0.0815132111f},
-std::array<float,2>{0.710536838f, 0.0192335993f},
-std::array<float,2>{0.332083583f, 0.840052307f},
-std::array<float,2>{0.859877646f, 0.733418047f},
-std::array<float,2>{0.00892156642f, 0.367117465f},
-std::array<float,2>{0.984388292f, 0.44577387f},
-std::array<float,2>{0.176518396f, 0.508809805f},
-std::array<float,2>{0.52583003f, 0.970619142f},
-std::array<float,2>{0.498985231f, 0.199271798f},
-std::array<float,2>{0.902651191f, 0.108125731f},
-std::array<float,2>{0.242092356f, 0.772506833f},
-std::array<float,2>{0.575836778f, 0.639111757f},
-std::array<float,2>{0.385229111f, 0.257342249f},
-std::array<float,2>{0.639329076f, 0.401570797f},
-std::array<float,2>{0.284987718f, 0.591389298f},
-std::array<float,2>{0.76976645f, 0.913294196f},
-std::array<float,2>{0.10103f, 0.125790924f},
-std::array<float,2>{0.561234355f, 0.222158208f},
-std::array<float,2>{0.447589785f, 0.953683734f},
-std::array<float,2>{0.943168581f, 0.552313507f},
-std::array<float,2>{0.12596491f, 0.49629283f},
-std::array<float,2>{0.816444576f, 0.342663586f},
-std::array<float,2>{0.0565933511f, 0.709968626f},
-std::array<float,2>{0.731708884f, 0.850352108f},
-std::array<float,2>{0.351854146f, 0.0319945887f},
-std::array<float,2>{0.823667943f, 0.116140321f},
-std::array<float,2>{0.0479862168f, 0.762040555f},
-std::array<float,2>{0.720180392f, 0.647887826f},
-std::array<float,2>{0.349330753f, 0.271831095f},
-std::array<float,2>{0.554358006f, 0.380509615f},
-std::array<float,2>{0.438434333f, 0.577132702f},
-std::array<float,2>{0.945921719f, 0.922251701f},
-std::array<float,2>{0.138517678f, 0.145899758f},
-std::array<float,2>{0.63203162f, 0.239280015f},
-std::array<float,2>{0.292559177f, 0.949238777f},
-std::array<float,2>{0.778836131f, 0.53746295f},
-std::array<float,2>{0.105643243f, 0.483601749f},
-std::array<float,2>{0.892249584f, 0.322738826f},
-std::array<float,2>{0.246311024f, 0.698868692f},
-std::array<float,2>{0.563692391f, 0.864156187f},
-std::array<float,2>{0.381554484f, 0.0546552837f},
-std::array<float,2>{0.995962799f, 0.162426189f},
-std::array<float,2>{0.180006832f, 0.878774285f},
-std::array<float,2>{0.518549383f, 0.621558189f},
-std::array<float,2>{0.488325387f, 0.435360789f},
-std::array<float,2>{0.718235254f, 0.310831249f},
-std::array<float,2>{0.338523418f, 0.677059889f},
-std::array<float,2>{0.872261226f, 0.792162359f},
-std::array<float,2>{0.00408656988f, 0.0770012885f},
-std::array<float,2>{0.602252543f, 0.00166785985f},
-std::array<float,2>{0.411451131f, 0.822737813f},
-std::array<float,2>{0.924928486f, 0.739073932f},
-std::array<float,2>{0.188801423f, 0.354305476f},
-std::array<float,2>{0.804151177f, 0.459448665f},
-std::array<float,2>{0.071325615f, 0.521306098f},
-std::array<float,2>{0.65677464f, 0.986442447f},
-std::array<float,2>{0.27368933f, 0.210823834f},
-std::array<float,2>{0.763053775f, 0.195683107f},
-std::array<float,2>{0.113961779f, 0.97561723f},
-std::array<float,2>{0.651755154f, 0.51214689f},
-std::array<float,2>{0.310875148f, 0.450216502f},
-std::array<float,2>{0.584921658f, 0.362094581f},
-std::array<float,2>{0.39660874f, 0.726982236f},
-std::array<float,2>{0.888747454f, 0.837130725f},
-std::array<float,2>{0.220655307f, 0.02021062f},
-std::array<float,2>{0.749174833f, 0.0832167193f},
-std::array<float,2>{0.372896254f, 0.811629951f},
-std::array<float,2>{0.840483725f, 0.67093122f},
-std::array<float,2>{0.0348663926f, 0.291045964f},
-std::array<float,2>{0.959391773f, 0.416002363f},
-std::array<float,2>{0.14326559f, 0.599938095f},
-std::array<float,2>{0.539001405f, 0.906205058f},
-std::array<float,2>{0.456295341f, 0.183148757f},
-std::array<float,2>{0.908143461f, 0.0368468612f},
-std::array<float,2>{0.204573527f, 0.847064435f},
-std::array<float,2>{0.619784594f, 0.704949617f},
-std::array<float,2>{0.422188401f, 0.337461948f},
-std::array<float,2>{0.674584568f, 0.494119585f},
-std::array<float,2>{0.256674826f, 0.547366679f},
-std::array<float,2>{0.789346397f, 0.959875464f},
-std::array<float,2>{0.0882290527f, 0.22392036f},
-std::array<float,2>{0.508763313f, 0.130678058f},
-std::array<float,2>{0.484115958f, 0.906707942f},
-std::array<float,2>{0.978779495f, 0.587293327f},
-std::array<float,2>{0.165182412f, 0.405273557f},
-std::array<float,2>{0.843950987f, 0.252205998f},
-std::array<float,2>{0.0254712421f, 0.636151433f},
-std::array<float,2>{0.696636319f, 0.767724335f},
-std::array<float,2>{0.322442144f, 0.105327919f},
-std::array<float,2>{0.78414464f, 0.0245832857f},
-std::array<float,2>{0.0799344927f, 0.82997638f},
-std::array<float,2>{0.685190678f, 0.725864649f},
-std::array<float,2>{0.261412323f, 0.369722992f},
-std::array<float,2>{0.610315084f, 0.442634612f},
-std::array<float,2>{0.436647177f, 0.500506341f},
-std::array<float,2>{0.916529059f, 0.980674922f},
-std::array<float,2>{0.216136783f, 0.187765136f},
-std::array<float,2>{0.69396925f, 0.171885237f},
-std::array<float,2>{0.316649705f, 0.892707944f},
-std::array<float,2>{0.858621299f, 0.608760476f},
-std::array<float,2>{0.0191358309f, 0.406801999f},
-std::array<float,2>{0.968995869f, 0.287724167f},
-std::array<float,2>{0.160993367f, 0.662768722f},
-std::array<float,2>{0.506276071f, 0.79912436f},
-std::array<float,2>{0.469358802f, 0.0910189226f},
-std::array<float,2>{0.876602769f, 0.233625054f},
-std::array<float,2>{0.229516879f, 0.968007267f},
-std::array<float,2>{0.591525793f, 0.559353709f},
-std::array<float,2>{0.40574953f, 0.487186611f},
-std::array<float,2>{0.645977914f, 0.33010605f},
-std::array<float,2>{0.297692865f, 0.716072142f},
-std::array<float,2>{0.751474798f, 0.858885646f},
-std::array<float,2>{0.120518751f, 0.0426252112f},
-std::array<float,2>{0.546301723f, 0.0999736488f},
-std::array<float,2>{0.465717196f, 0.776846528f},
-std::array<float,2>{0.966072619f, 0.629925668f},
-std::array<float,2>{0.155625224f, 0.264996141f},
-std::array<float,2>{0.833864391f, 0.398196608f},
-std::array<float,2>{0.0400888324f, 0.582762122f},
-std::array<float,2>{0.73915422f, 0.918143213f},
-std::array<float,2>{0.362455726f, 0.139689893f},
-std::array<float,2>{0.866211951f, 0.149264947f},
-std::array<float,2>{0.0126786865f, 0.931562066f},
-std::array<float,2>{0.705968559f, 0.56602639f},
-std::array<float,2>{0.330646813f, 0.385173708f},
-std::array<float,2>{0.529408336f, 0.278401822f},
-std::array<float,2>{0.493862003f, 0.650593758f},
-std::array<float,2>{0.991871953f, 0.750260055f},
-std::array<float,2>{0.174043104f, 0.121045679f},
-std::array<float,2>{0.666505694f, 0.0573276617f},
-std::array<float,2>{0.27122438f, 0.868658185f},
-std::array<float,2>{0.809543073f, 0.693095982f},
-std::array<float,2>{0.0695870519f, 0.319761783f},
-std::array<float,2>{0.931780756f, 0.471723258f},
-std::array<float,2>{0.198155239f, 0.546840787f},
-std::array<float,2>{0.596790969f, 0.942111015f},
-std::array<float,2>{0.415950954f, 0.245364085f},
-std::array<float,2>{0.939686537f, 0.0678386092f},
-std::array<float,2>{0.130769268f, 0.787490904f},
-std::array<float,2>{0.555179477f, 0.680443466f},
-std::array<float,2>{0.452631474f, 0.304150075f},
-std::array<float,2>{0.728915811f, 0.424116731f},
-std::array<float,2>{0.356419653f, 0.611158133f},
-std::array<float,2>{0.812937796f, 0.884301424f},
-std::array<float,2>{0.0611135736f, 0.166005433f},
-std::array<float,2>{0.570382953f, 0.211568594f},
-std::array<float,2>{0.389563769f, 0.993355691f},
-std::array<float,2>{0.900228441f, 0.526767373f},
-std::array<float,2>{0.236990318f, 0.463492215f},
-std::array<float,2>{0.769339144f, 0.346801251f},
-std::array<float,2>{0.0952459052f, 0.748233855f},
-std::array<float,2>{0.633237839f, 0.81448704f},
-std::array<float,2>{0.285443306f, 0.0149866026f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.0567082018f, 0.553194106f},
-std::array<float,2>{0.958303034f, 0.225873366f},
-std::array<float,2>{0.360497832f, 0.29331097f},
-std::array<float,2>{0.618487358f, 0.911145091f},
-std::array<float,2>{0.417241335f, 0.753982484f},
-std::array<float,2>{0.656802475f, 0.436131746f},
-std::array<float,2>{0.165662929f, 0.0380788147f},
-std::array<float,2>{0.765365541f, 0.655784607f},
-std::array<float,2>{0.265323043f, 0.730813622f},
-std::array<float,2>{0.501507342f, 0.124574549f},
-std::array<float,2>{0.0922280997f, 0.47354272f},
-std::array<float,2>{0.920823395f, 0.849070251f},
-std::array<float,2>{0.206403941f, 0.961328864f},
-std::array<float,2>{0.846405745f, 0.325403869f},
-std::array<float,2>{0.466861039f, 0.137418956f},
-std::array<float,2>{0.695174754f, 0.568335652f},
-std::array<float,2>{0.128590941f, 0.676783681f},
-std::array<float,2>{0.807793796f, 0.00393248396f},
-std::array<float,2>{0.402669102f, 0.38637796f},
-std::array<float,2>{0.62732017f, 0.804195166f},
-std::array<float,2>{0.328257948f, 0.884393454f},
-std::array<float,2>{0.586096883f, 0.271795392f},
-std::array<float,2>{0.00400586892f, 0.214014202f},
-std::array<float,2>{0.99044615f, 0.528293252f},
-std::array<float,2>{0.492067844f, 0.595017254f},
-std::array<float,2>{0.723549306f, 0.163324282f},
-std::array<float,2>{0.245146573f, 0.373826861f},
-std::array<float,2>{0.84064877f, 0.979494035f},
-std::array<float,2>{0.120022252f, 0.826399505f},
-std::array<float,2>{0.886274219f, 0.44922933f},
-std::array<float,2>{0.305455953f, 0.0831511989f},
-std::array<float,2>{0.549510002f, 0.70628798f},
-std::array<float,2>{0.0628009886f, 0.700243175f},
-std::array<float,2>{0.933165491f, 0.0779427141f},
-std::array<float,2>{0.274947822f, 0.453625351f},
-std::array<float,2>{0.52252686f, 0.836620629f},
-std::array<float,2>{0.439948171f, 0.995907843f},
-std::array<float,2>{0.716056287f, 0.344582886f},
-std::array<float,2>{0.190678939f, 0.185627833f},
-std::array<float,2>{0.864448249f, 0.614361644f},
-std::array<float,2>{0.348497093f, 0.513217866f},
-std::array<float,2>{0.602460861f, 0.191638499f},
-std::array<float,2>{0.039263621f, 0.254273087f},
-std::array<float,2>{0.952341199f, 0.899341345f},
-std::array<float,2>{0.178400755f, 0.795781791f},
-std::array<float,2>{0.779752135f, 0.406048238f},
-std::array<float,2>{0.427919567f, 0.0236990172f},
-std::array<float,2>{0.680845439f, 0.658471227f},
-std::array<float,2>{0.229845643f, 0.585617781f},
-std::array<float,2>{0.823838055f, 0.14148736f},
-std::array<float,2>{0.473301709f, 0.330963314f},
-std::array<float,2>{0.742026031f, 0.950349927f},
-std::array<float,2>{0.281496644f, 0.859597445f},
-std::array<float,2>{0.542670727f, 0.496379405f},
-std::array<float,2>{0.109145097f, 0.10225559f},
-std::array<float,2>{0.896601677f, 0.743390381f},
-std::array<float,2>{0.385524839f, 0.634728789f},
-std::array<float,2>{0.649056673f, 0.0559134744f},
-std::array<float,2>{0.155937761f, 0.412045568f},
-std::array<float,2>{0.787469029f, 0.77071774f},
-std::array<float,2>{0.021813307f, 0.922931969f},
-std::array<float,2>{0.981980801f, 0.306508511f},
-std::array<float,2>{0.326165169f, 0.246369854f},
-std::array<float,2>{0.57444644f, 0.539487839f},
-std::array<float,2>{0.0955105275f, 0.621060193f},
-std::array<float,2>{0.903502047f, 0.177127972f},
-std::array<float,2>{0.290643871f, 0.353344172f},
-std::array<float,2>{0.532782912f, 0.990441382f},
-std::array<float,2>{0.480887532f, 0.833170414f},
-std::array<float,2>{0.748766661f, 0.466145486f},
-std::array<float,2>{0.219310015f, 0.0690480098f},
-std::array<float,2>{0.81409061f, 0.689103484f},
-std::array<float,2>{0.316334665f, 0.668343127f},
-std::array<float,2>{0.565250933f, 0.0214669518f},
-std::array<float,2>{0.0243180022f, 0.395077616f},
-std::array<float,2>{0.975297272f, 0.781274199f},
-std::array<float,2>{0.142572016f, 0.891536117f},
-std::array<float,2>{0.795655549f, 0.261039317f},
-std::array<float,2>{0.375701845f, 0.198837459f},
-std::array<float,2>{0.641217947f, 0.50227493f},
-std::array<float,2>{0.199623451f, 0.736515403f},
-std::array<float,2>{0.871449411f, 0.0998818874f},
-std::array<float,2>{0.452633649f, 0.486793578f},
-std::array<float,2>{0.710453272f, 0.874445438f},
-std::array<float,2>{0.266438305f, 0.942525506f},
-std::array<float,2>{0.527349472f, 0.338463813f},
-std::array<float,2>{0.0723862052f, 0.149660602f},
-std::array<float,2>{0.92610693f, 0.588015616f},
-std::array<float,2>{0.432785839f, 0.536143422f},
-std::array<float,2>{0.675065279f, 0.241971612f},
-std::array<float,2>{0.181620866f, 0.304153651f},
-std::array<float,2>{0.768588305f, 0.932460487f},
-std::array<float,2>{0.0330234282f, 0.773905993f},
-std::array<float,2>{0.943700254f, 0.419396758f},
-std::array<float,2>{0.351996273f, 0.0511174165f},
-std::array<float,2>{0.594567299f, 0.632288158f},
-std::array<float,2>{0.00800978672f, 0.645135403f},
-std::array<float,2>{0.997039199f, 0.0453625098f},
-std::array<float,2>{0.342864484f, 0.427370667f},
-std::array<float,2>{0.58333981f, 0.761164188f},
-std::array<float,2>{0.397791773f, 0.919646323f},
-std::array<float,2>{0.636187017f, 0.285698801f},
-std::array<float,2>{0.133242741f, 0.226656735f},
-std::array<float,2>{0.800691545f, 0.555250645f},
-std::array<float,2>{0.297637641f, 0.576618254f},
-std::array<float,2>{0.559167981f, 0.131661624f},
-std::array<float,2>{0.11701905f, 0.315813363f},
-std::array<float,2>{0.876317084f, 0.958294749f},
-std::array<float,2>{0.237084568f, 0.858917415f},
-std::array<float,2>{0.832931638f, 0.479672849f},
-std::array<float,2>{0.497961551f, 0.112415463f},
-std::array<float,2>{0.731812179f, 0.722515643f},
-std::array<float,2>{0.159636647f, 0.519927859f},
-std::array<float,2>{0.750835001f, 0.208846211f},
-std::array<float,2>{0.411235869f, 0.275350034f},
-std::array<float,2>{0.668637455f, 0.879878819f},
-std::array<float,2>{0.367360264f, 0.812180459f},
-std::array<float,2>{0.615682125f, 0.379109085f},
-std::array<float,2>{0.0516641103f, 0.0136539154f},
-std::array<float,2>{0.960945547f, 0.6839481f},
-std::array<float,2>{0.455380708f, 0.712117672f},
-std::array<float,2>{0.702736318f, 0.0894002244f},
-std::array<float,2>{0.21297206f, 0.442833096f},
-std::array<float,2>{0.857139468f, 0.81733048f},
-std::array<float,2>{0.0797991231f, 0.975608408f},
-std::array<float,2>{0.913691044f, 0.359422445f},
-std::array<float,2>{0.253585696f, 0.167106181f},
-std::array<float,2>{0.513818264f, 0.602763593f},
-std::array<float,2>{0.0309504718f, 0.5659917f},
-std::array<float,2>{0.96940136f, 0.135924518f},
-std::array<float,2>{0.318866938f, 0.321288526f},
-std::array<float,2>{0.568510532f, 0.968321443f},
-std::array<float,2>{0.382406533f, 0.844421387f},
-std::array<float,2>{0.644684851f, 0.470162809f},
-std::array<float,2>{0.146476239f, 0.11777655f},
-std::array<float,2>{0.789376557f, 0.727529347f},
-std::array<float,2>{0.295678943f, 0.650415421f},
-std::array<float,2>{0.53751868f, 0.0333675593f},
-std::array<float,2>{0.0988752618f, 0.430388808f},
-std::array<float,2>{0.902190208f, 0.750336885f},
-std::array<float,2>{0.224650353f, 0.907320559f},
-std::array<float,2>{0.816912472f, 0.291172981f},
-std::array<float,2>{0.477603912f, 0.220462322f},
-std::array<float,2>{0.744563818f, 0.547677398f},
-std::array<float,2>{0.184010535f, 0.708965838f},
-std::array<float,2>{0.773379862f, 0.0791471675f},
-std::array<float,2>{0.43688339f, 0.447961986f},
-std::array<float,2>{0.679071486f, 0.823963583f},
-std::array<float,2>{0.356425345f, 0.983751178f},
-std::array<float,2>{0.598647833f, 0.370841563f},
-std::array<float,2>{0.0361747406f, 0.157921851f},
-std::array<float,2>{0.938122869f, 0.600258231f},
-std::array<float,2>{0.448246419f, 0.524681091f},
-std::array<float,2>{0.703268945f, 0.217727989f},
-std::array<float,2>{0.196600378f, 0.266713321f},
-std::array<float,2>{0.867652059f, 0.887478709f},
-std::array<float,2>{0.0762437209f, 0.798374593f},
-std::array<float,2>{0.925778329f, 0.387473106f},
-std::array<float,2>{0.271122217f, 0.00337124499f},
-std::array<float,2>{0.526974797f, 0.673172891f},
-std::array<float,2>{0.110072523f, 0.660930634f},
-std::array<float,2>{0.882806838f, 0.0282660257f},
-std::array<float,2>{0.30248782f, 0.401875347f},
-std::array<float,2>{0.55739677f, 0.791214824f},
-std::array<float,2>{0.492678285f, 0.902986884f},
-std::array<float,2>{0.72916764f, 0.252422452f},
-std::array<float,2>{0.241455525f, 0.189437762f},
-std::array<float,2>{0.831017673f, 0.509185314f},
-std::array<float,2>{0.339225888f, 0.610357583f},
-std::array<float,2>{0.580097318f, 0.182093784f},
-std::array<float,2>{0.013522381f, 0.348703414f},
-std::array<float,2>{0.993941903f, 0.996418953f},
-std::array<float,2>{0.138019875f, 0.843207896f},
-std::array<float,2>{0.801262558f, 0.459067822f},
-std::array<float,2>{0.391415328f, 0.0717394724f},
-std::array<float,2>{0.639061391f, 0.698199987f},
-std::array<float,2>{0.21647191f, 0.543171108f},
-std::array<float,2>{0.852988601f, 0.243811548f},
-std::array<float,2>{0.460005492f, 0.31119597f},
-std::array<float,2>{0.697865546f, 0.927096546f},
-std::array<float,2>{0.257114738f, 0.765982032f},
-std::array<float,2>{0.508330226f, 0.409841806f},
-std::array<float,2>{0.0820602551f, 0.0589377433f},
-std::array<float,2>{0.908840895f, 0.638573945f},
-std::array<float,2>{0.407170981f, 0.748365104f},
-std::array<float,2>{0.667073309f, 0.106589317f},
-std::array<float,2>{0.163475037f, 0.494185835f},
-std::array<float,2>{0.754882753f, 0.866434574f},
-std::array<float,2>{0.049403552f, 0.946689904f},
-std::array<float,2>{0.966713786f, 0.333186269f},
-std::array<float,2>{0.373068154f, 0.148196578f},
-std::array<float,2>{0.61252892f, 0.578594625f},
-std::array<float,2>{0.0879552886f, 0.507644653f},
-std::array<float,2>{0.914258659f, 0.200562268f},
-std::array<float,2>{0.258655965f, 0.262540758f},
-std::array<float,2>{0.507502258f, 0.895008683f},
-std::array<float,2>{0.46403569f, 0.787004411f},
-std::array<float,2>{0.691023171f, 0.391973078f},
-std::array<float,2>{0.207335696f, 0.0191787817f},
-std::array<float,2>{0.848179936f, 0.664697111f},
-std::array<float,2>{0.365545899f, 0.694075823f},
-std::array<float,2>{0.623753548f, 0.0625657514f},
-std::array<float,2>{0.0602373071f, 0.464353412f},
-std::array<float,2>{0.95676893f, 0.829045653f},
-std::array<float,2>{0.169163391f, 0.98791337f},
-std::array<float,2>{0.761297584f, 0.357451141f},
-std::array<float,2>{0.420122981f, 0.1757707f},
-std::array<float,2>{0.66318506f, 0.623308837f},
-std::array<float,2>{0.246276125f, 0.626975715f},
-std::array<float,2>{0.839685559f, 0.0479202196f},
-std::array<float,2>{0.488008618f, 0.415100187f},
-std::array<float,2>{0.721003175f, 0.77745831f},
-std::array<float,2>{0.30969584f, 0.934551179f},
-std::array<float,2>{0.552702367f, 0.29966104f},
-std::array<float,2>{0.123205736f, 0.234428361f},
-std::array<float,2>{0.886956871f, 0.533289552f},
-std::array<float,2>{0.399198979f, 0.59102422f},
-std::array<float,2>{0.630914688f, 0.152376488f},
-std::array<float,2>{0.130877778f, 0.342736095f},
-std::array<float,2>{0.808649361f, 0.938067734f},
-std::array<float,2>{0.00226647337f, 0.870802999f},
-std::array<float,2>{0.986160815f, 0.489672214f},
-std::array<float,2>{0.334199399f, 0.0942542255f},
-std::array<float,2>{0.591129005f, 0.741525888f},
-std::array<float,2>{0.0457171574f, 0.725992799f},
-std::array<float,2>{0.946964264f, 0.115896553f},
-std::array<float,2>{0.346797138f, 0.482961267f},
-std::array<float,2>{0.608529389f, 0.853043437f},
-std::array<float,2>{0.425007075f, 0.955430627f},
-std::array<float,2>{0.686515272f, 0.319453329f},
-std::array<float,2>{0.173954159f, 0.127625629f},
-std::array<float,2>{0.774520338f, 0.571663737f},
-std::array<float,2>{0.279763222f, 0.562091887f},
-std::array<float,2>{0.517725885f, 0.234071866f},
-std::array<float,2>{0.0696798041f, 0.282351017f},
-std::array<float,2>{0.935840368f, 0.917287469f},
-std::array<float,2>{0.192654282f, 0.762572467f},
-std::array<float,2>{0.86124289f, 0.421945423f},
-std::array<float,2>{0.444738239f, 0.0402449928f},
-std::array<float,2>{0.711472988f, 0.641862273f},
-std::array<float,2>{0.150411323f, 0.607994556f},
-std::array<float,2>{0.782077193f, 0.168500319f},
-std::array<float,2>{0.387586653f, 0.36590004f},
-std::array<float,2>{0.655428588f, 0.969935477f},
-std::array<float,2>{0.321842134f, 0.816278517f},
-std::array<float,2>{0.571968496f, 0.441307485f},
-std::array<float,2>{0.0179829746f, 0.0933135375f},
-std::array<float,2>{0.980130434f, 0.716936529f},
-std::array<float,2>{0.470752597f, 0.682485282f},
-std::array<float,2>{0.734470606f, 0.0112556387f},
-std::array<float,2>{0.230515644f, 0.375251323f},
-std::array<float,2>{0.825167537f, 0.805938244f},
-std::array<float,2>{0.102297589f, 0.876322985f},
-std::array<float,2>{0.894033372f, 0.277553827f},
-std::array<float,2>{0.285494596f, 0.205449507f},
-std::array<float,2>{0.543660879f, 0.515816689f},
-std::array<float,2>{0.00768611114f, 0.530638397f},
-std::array<float,2>{0.98960793f, 0.211205706f},
-std::array<float,2>{0.330727696f, 0.270618945f},
-std::array<float,2>{0.589107931f, 0.886574686f},
-std::array<float,2>{0.404694945f, 0.801143289f},
-std::array<float,2>{0.626292825f, 0.383330822f},
-std::array<float,2>{0.125027612f, 0.00660858816f},
-std::array<float,2>{0.806089699f, 0.678708375f},
-std::array<float,2>{0.307846189f, 0.704641521f},
-std::array<float,2>{0.546963453f, 0.0854412317f},
-std::array<float,2>{0.119077593f, 0.452510417f},
-std::array<float,2>{0.884684384f, 0.824243784f},
-std::array<float,2>{0.243740767f, 0.976849079f},
-std::array<float,2>{0.842003763f, 0.372505873f},
-std::array<float,2>{0.489183038f, 0.161449701f},
-std::array<float,2>{0.725753605f, 0.596500516f},
-std::array<float,2>{0.166329473f, 0.653976917f},
-std::array<float,2>{0.761918604f, 0.0366465226f},
-std::array<float,2>{0.415391445f, 0.433633238f},
-std::array<float,2>{0.659466267f, 0.756798923f},
-std::array<float,2>{0.361831814f, 0.913130164f},
-std::array<float,2>{0.620872378f, 0.29632315f},
-std::array<float,2>{0.055305507f, 0.222740054f},
-std::array<float,2>{0.959095299f, 0.551982105f},
-std::array<float,2>{0.465448558f, 0.568849444f},
-std::array<float,2>{0.693312466f, 0.140416965f},
-std::array<float,2>{0.204539359f, 0.326861054f},
-std::array<float,2>{0.845362723f, 0.963806689f},
-std::array<float,2>{0.0908741206f, 0.84970963f},
-std::array<float,2>{0.918105781f, 0.474739999f},
-std::array<float,2>{0.261926383f, 0.121703044f},
-std::array<float,2>{0.503142238f, 0.734111726f},
-std::array<float,2>{0.107226953f, 0.744441211f},
-std::array<float,2>{0.895668745f, 0.105442159f},
-std::array<float,2>{0.28500995f, 0.498491079f},
-std::array<float,2>{0.540162563f, 0.861421227f},
-std::array<float,2>{0.476181328f, 0.951637149f},
-std::array<float,2>{0.738714337f, 0.329733402f},
-std::array<float,2>{0.228328764f, 0.143375486f},
-std::array<float,2>{0.82129693f, 0.583149672f},
-std::array<float,2>{0.327085346f, 0.541214883f},
-std::array<float,2>{0.57758975f, 0.248660594f},
-std::array<float,2>{0.0210029203f, 0.307423085f},
-std::array<float,2>{0.983336031f, 0.924120724f},
-std::array<float,2>{0.152858943f, 0.772401392f},
-std::array<float,2>{0.786538899f, 0.41276446f},
-std::array<float,2>{0.384006292f, 0.0582800284f},
-std::array<float,2>{0.651202798f, 0.63632822f},
-std::array<float,2>{0.18783389f, 0.616013885f},
-std::array<float,2>{0.866057634f, 0.18530947f},
-std::array<float,2>{0.437575877f, 0.345902234f},
-std::array<float,2>{0.717174768f, 0.992343366f},
-std::array<float,2>{0.276468039f, 0.839045942f},
-std::array<float,2>{0.521408141f, 0.455763847f},
-std::array<float,2>{0.0657930896f, 0.0758458003f},
-std::array<float,2>{0.931210279f, 0.701404393f},
-std::array<float,2>{0.427355826f, 0.657172561f},
-std::array<float,2>{0.683195353f, 0.0264844764f},
-std::array<float,2>{0.176604256f, 0.40243718f},
-std::array<float,2>{0.777366996f, 0.794353068f},
-std::array<float,2>{0.0422925465f, 0.902079642f},
-std::array<float,2>{0.949267745f, 0.255899131f},
-std::array<float,2>{0.350710511f, 0.195288107f},
-std::array<float,2>{0.604221821f, 0.515513062f},
-std::array<float,2>{0.0721957386f, 0.587101758f},
-std::array<float,2>{0.928120911f, 0.150727361f},
-std::array<float,2>{0.268670112f, 0.337248147f},
-std::array<float,2>{0.530263186f, 0.944747031f},
-std::array<float,2>{0.451162279f, 0.872423172f},
-std::array<float,2>{0.707217455f, 0.485801727f},
-std::array<float,2>{0.203007132f, 0.0991891399f},
-std::array<float,2>{0.873818934f, 0.734539628f},
-std::array<float,2>{0.353830129f, 0.630222559f},
-std::array<float,2>{0.597042203f, 0.0529127643f},
-std::array<float,2>{0.0339203328f, 0.420830071f},
-std::array<float,2>{0.942878544f, 0.777240455f},
-std::array<float,2>{0.182600856f, 0.930332661f},
-std::array<float,2>{0.766472161f, 0.301669836f},
-std::array<float,2>{0.430406779f, 0.238408118f},
-std::array<float,2>{0.672001362f, 0.538061678f},
-std::array<float,2>{0.22173202f, 0.691027999f},
-std::array<float,2>{0.814583004f, 0.0672567561f},
-std::array<float,2>{0.482628077f, 0.466997504f},
-std::array<float,2>{0.74631989f, 0.835620344f},
-std::array<float,2>{0.292694002f, 0.989118397f},
-std::array<float,2>{0.534737587f, 0.355381399f},
-std::array<float,2>{0.0976151302f, 0.179233029f},
-std::array<float,2>{0.905743837f, 0.618072689f},
-std::array<float,2>{0.37868309f, 0.501590073f},
-std::array<float,2>{0.643096864f, 0.195895895f},
-std::array<float,2>{0.143881664f, 0.259651721f},
-std::array<float,2>{0.794902802f, 0.893578172f},
-std::array<float,2>{0.0267171729f, 0.784993172f},
-std::array<float,2>{0.972974837f, 0.397061646f},
-std::array<float,2>{0.312752426f, 0.0228392631f},
-std::array<float,2>{0.564450026f, 0.670292377f},
-std::array<float,2>{0.0535384044f, 0.686954319f},
-std::array<float,2>{0.963849425f, 0.0150529817f},
-std::array<float,2>{0.369848162f, 0.382343769f},
-std::array<float,2>{0.613583326f, 0.809611022f},
-std::array<float,2>{0.41372627f, 0.882173419f},
-std::array<float,2>{0.670330882f, 0.275703877f},
-std::array<float,2>{0.157370046f, 0.209812343f},
-std::array<float,2>{0.753306866f, 0.521822512f},
-std::array<float,2>{0.251892298f, 0.604680836f},
-std::array<float,2>{0.513547361f, 0.165458336f},
-std::array<float,2>{0.0810873881f, 0.361708194f},
-std::array<float,2>{0.91016227f, 0.973253429f},
-std::array<float,2>{0.211342931f, 0.819063306f},
-std::array<float,2>{0.858473182f, 0.444826901f},
-std::array<float,2>{0.453798264f, 0.0862000883f},
-std::array<float,2>{0.700417817f, 0.714458346f},
-std::array<float,2>{0.136691228f, 0.557696939f},
-std::array<float,2>{0.797921121f, 0.22945337f},
-std::array<float,2>{0.396287054f, 0.288370103f},
-std::array<float,2>{0.633102f, 0.921259046f},
-std::array<float,2>{0.340630651f, 0.758808017f},
-std::array<float,2>{0.585927844f, 0.429456264f},
-std::array<float,2>{0.011131769f, 0.0448552705f},
-std::array<float,2>{0.999752045f, 0.648371398f},
-std::array<float,2>{0.499152362f, 0.720043004f},
-std::array<float,2>{0.733115137f, 0.110415645f},
-std::array<float,2>{0.235585213f, 0.477365196f},
-std::array<float,2>{0.834219038f, 0.856614351f},
-std::array<float,2>{0.114339665f, 0.959203601f},
-std::array<float,2>{0.878267586f, 0.313152105f},
-std::array<float,2>{0.299822211f, 0.129189149f},
-std::array<float,2>{0.561194539f, 0.574238122f},
-std::array<float,2>{0.0378122665f, 0.597784996f},
-std::array<float,2>{0.939687908f, 0.15887855f},
-std::array<float,2>{0.358973533f, 0.368709534f},
-std::array<float,2>{0.599669278f, 0.982289553f},
-std::array<float,2>{0.434621751f, 0.821928442f},
-std::array<float,2>{0.675947428f, 0.446878642f},
-std::array<float,2>{0.187478587f, 0.0805292875f},
-std::array<float,2>{0.771330893f, 0.709292531f},
-std::array<float,2>{0.272519976f, 0.675718665f},
-std::array<float,2>{0.523950517f, 0.00178792595f},
-std::array<float,2>{0.0750676915f, 0.388950616f},
-std::array<float,2>{0.922138035f, 0.800270915f},
-std::array<float,2>{0.198728412f, 0.88898319f},
-std::array<float,2>{0.87105912f, 0.268114448f},
-std::array<float,2>{0.446608961f, 0.215906918f},
-std::array<float,2>{0.705501914f, 0.526216149f},
-std::array<float,2>{0.146781698f, 0.730374157f},
-std::array<float,2>{0.792191565f, 0.120984867f},
-std::array<float,2>{0.380013853f, 0.472385675f},
-std::array<float,2>{0.648317695f, 0.846384287f},
-std::array<float,2>{0.317277223f, 0.965269923f},
-std::array<float,2>{0.566897988f, 0.322278053f},
-std::array<float,2>{0.0274793804f, 0.133491963f},
-std::array<float,2>{0.971340775f, 0.563558459f},
-std::array<float,2>{0.480147779f, 0.550332963f},
-std::array<float,2>{0.742874861f, 0.221228078f},
-std::array<float,2>{0.223494723f, 0.289216131f},
-std::array<float,2>{0.819736779f, 0.909942091f},
-std::array<float,2>{0.101268716f, 0.752729833f},
-std::array<float,2>{0.899495304f, 0.432252944f},
-std::array<float,2>{0.293156475f, 0.0324818157f},
-std::array<float,2>{0.536724389f, 0.650283754f},
-std::array<float,2>{0.0857734606f, 0.640405476f},
-std::array<float,2>{0.907014489f, 0.0624226555f},
-std::array<float,2>{0.254215986f, 0.407844245f},
-std::array<float,2>{0.51147604f, 0.768602967f},
-std::array<float,2>{0.458004415f, 0.928397f},
-std::array<float,2>{0.696530282f, 0.309616834f},
-std::array<float,2>{0.217424855f, 0.245560646f},
-std::array<float,2>{0.855146527f, 0.545625091f},
-std::array<float,2>{0.371694595f, 0.581339002f},
-std::array<float,2>{0.610808134f, 0.145387143f},
-std::array<float,2>{0.0483440831f, 0.335572541f},
-std::array<float,2>{0.967283845f, 0.949086368f},
-std::array<float,2>{0.161982059f, 0.863843143f},
-std::array<float,2>{0.756427884f, 0.492494881f},
-std::array<float,2>{0.409674555f, 0.107732065f},
-std::array<float,2>{0.665734172f, 0.747940779f},
-std::array<float,2>{0.238804281f, 0.510072112f},
-std::array<float,2>{0.829487026f, 0.189868793f},
-std::array<float,2>{0.495859593f, 0.250167161f},
-std::array<float,2>{0.727913499f, 0.904326677f},
-std::array<float,2>{0.304258287f, 0.790353954f},
-std::array<float,2>{0.556062222f, 0.398597449f},
-std::array<float,2>{0.112177387f, 0.029629197f},
-std::array<float,2>{0.879811227f, 0.663033009f},
-std::array<float,2>{0.392962128f, 0.696693003f},
-std::array<float,2>{0.637642741f, 0.0736552328f},
-std::array<float,2>{0.139224887f, 0.457242459f},
-std::array<float,2>{0.802868485f, 0.841607809f},
-std::array<float,2>{0.014190807f, 0.999985635f},
-std::array<float,2>{0.994373441f, 0.350627482f},
-std::array<float,2>{0.337010741f, 0.180353954f},
-std::array<float,2>{0.57936126f, 0.612484872f},
-std::array<float,2>{0.122129917f, 0.533089757f},
-std::array<float,2>{0.889880657f, 0.237834066f},
-std::array<float,2>{0.312072277f, 0.297491968f},
-std::array<float,2>{0.554448426f, 0.936228991f},
-std::array<float,2>{0.485925049f, 0.779747367f},
-std::array<float,2>{0.719963133f, 0.417070597f},
-std::array<float,2>{0.249323666f, 0.0490016192f},
-std::array<float,2>{0.836493552f, 0.625087321f},
-std::array<float,2>{0.332564384f, 0.738760293f},
-std::array<float,2>{0.591983438f, 0.0969093889f},
-std::array<float,2>{0.000617575191f, 0.491982788f},
-std::array<float,2>{0.987656593f, 0.867574871f},
-std::array<float,2>{0.12913911f, 0.94039607f},
-std::array<float,2>{0.812314153f, 0.340891778f},
-std::array<float,2>{0.400406718f, 0.154598624f},
-std::array<float,2>{0.630007267f, 0.593048513f},
-std::array<float,2>{0.210789815f, 0.667230487f},
-std::array<float,2>{0.850646794f, 0.0167852361f},
-std::array<float,2>{0.462670594f, 0.394309938f},
-std::array<float,2>{0.687681794f, 0.788323402f},
-std::array<float,2>{0.260506541f, 0.897900224f},
-std::array<float,2>{0.504367411f, 0.263772964f},
-std::array<float,2>{0.0859697536f, 0.2016114f},
-std::array<float,2>{0.91778034f, 0.505857468f},
-std::array<float,2>{0.418531895f, 0.622960746f},
-std::array<float,2>{0.661888182f, 0.172007993f},
-std::array<float,2>{0.170435846f, 0.35558489f},
-std::array<float,2>{0.759212434f, 0.984783947f},
-std::array<float,2>{0.0613793097f, 0.830178559f},
-std::array<float,2>{0.953158677f, 0.461373478f},
-std::array<float,2>{0.363308787f, 0.0663097203f},
-std::array<float,2>{0.622879148f, 0.692089558f},
-std::array<float,2>{0.0163313095f, 0.716369748f},
-std::array<float,2>{0.977649033f, 0.0900352299f},
-std::array<float,2>{0.322758198f, 0.438432753f},
-std::array<float,2>{0.572684944f, 0.813212335f},
-std::array<float,2>{0.390416473f, 0.970809221f},
-std::array<float,2>{0.653608382f, 0.364774525f},
-std::array<float,2>{0.149717331f, 0.171382368f},
-std::array<float,2>{0.783832908f, 0.605799556f},
-std::array<float,2>{0.287419409f, 0.518793344f},
-std::array<float,2>{0.546030581f, 0.204933211f},
-std::array<float,2>{0.105468728f, 0.28084296f},
-std::array<float,2>{0.892342448f, 0.878003538f},
-std::array<float,2>{0.234213382f, 0.807956457f},
-std::array<float,2>{0.826672912f, 0.377944618f},
-std::array<float,2>{0.470290571f, 0.00824596919f},
-std::array<float,2>{0.736439347f, 0.68106389f},
-std::array<float,2>{0.173391044f, 0.57385844f},
-std::array<float,2>{0.775838435f, 0.125735074f},
-std::array<float,2>{0.422327489f, 0.317569286f},
-std::array<float,2>{0.685117066f, 0.954703331f},
-std::array<float,2>{0.344342381f, 0.854386985f},
-std::array<float,2>{0.605953217f, 0.482285589f},
-std::array<float,2>{0.0440285057f, 0.115074098f},
-std::array<float,2>{0.948574185f, 0.723130703f},
-std::array<float,2>{0.442498028f, 0.64306432f},
-std::array<float,2>{0.712913036f, 0.041498635f},
-std::array<float,2>{0.193480089f, 0.424771816f},
-std::array<float,2>{0.861485422f, 0.764139295f},
-std::array<float,2>{0.0678880736f, 0.914293349f},
-std::array<float,2>{0.935215414f, 0.285071969f},
-std::array<float,2>{0.279277265f, 0.231883317f},
-std::array<float,2>{0.515685678f, 0.559264779f},
-std::array<float,2>{0.040494144f, 0.514125884f},
-std::array<float,2>{0.952057004f, 0.193986014f},
-std::array<float,2>{0.349583745f, 0.257673591f},
-std::array<float,2>{0.603258669f, 0.900674462f},
-std::array<float,2>{0.428887665f, 0.793007255f},
-std::array<float,2>{0.679858625f, 0.403842241f},
-std::array<float,2>{0.178983361f, 0.0260956958f},
-std::array<float,2>{0.780529857f, 0.65817076f},
-std::array<float,2>{0.273807913f, 0.70294416f},
-std::array<float,2>{0.5220626f, 0.0750626698f},
-std::array<float,2>{0.0638039932f, 0.45672062f},
-std::array<float,2>{0.932464778f, 0.838786244f},
-std::array<float,2>{0.190234303f, 0.993621707f},
-std::array<float,2>{0.86389941f, 0.347459018f},
-std::array<float,2>{0.441007823f, 0.18454738f},
-std::array<float,2>{0.715259314f, 0.617117703f},
-std::array<float,2>{0.154831454f, 0.635247052f},
-std::array<float,2>{0.788858533f, 0.0567866527f},
-std::array<float,2>{0.386113256f, 0.413181931f},
-std::array<float,2>{0.650349975f, 0.773169458f},
-std::array<float,2>{0.32458064f, 0.925586164f},
-std::array<float,2>{0.575596511f, 0.308060288f},
-std::array<float,2>{0.0230758674f, 0.249819562f},
-std::array<float,2>{0.981438577f, 0.542783976f},
-std::array<float,2>{0.474196523f, 0.582835197f},
-std::array<float,2>{0.740519524f, 0.143719167f},
-std::array<float,2>{0.229274184f, 0.328161716f},
-std::array<float,2>{0.822579622f, 0.952643573f},
-std::array<float,2>{0.107840233f, 0.862853825f},
-std::array<float,2>{0.898271501f, 0.499071479f},
-std::array<float,2>{0.282931238f, 0.10435617f},
-std::array<float,2>{0.541681707f, 0.745652616f},
-std::array<float,2>{0.0936848074f, 0.733285487f},
-std::array<float,2>{0.921649873f, 0.122842886f},
-std::array<float,2>{0.264301449f, 0.475618631f},
-std::array<float,2>{0.500609159f, 0.851402342f},
-std::array<float,2>{0.467909545f, 0.963929415f},
-std::array<float,2>{0.694255054f, 0.327358782f},
-std::array<float,2>{0.205299914f, 0.13915047f},
-std::array<float,2>{0.847472012f, 0.570094466f},
-std::array<float,2>{0.360152513f, 0.551328659f},
-std::array<float,2>{0.617419004f, 0.223780543f},
-std::array<float,2>{0.0579169989f, 0.295518637f},
-std::array<float,2>{0.95787245f, 0.912904859f},
-std::array<float,2>{0.164790124f, 0.756986141f},
-std::array<float,2>{0.764570832f, 0.435062855f},
-std::array<float,2>{0.416424632f, 0.0354073942f},
-std::array<float,2>{0.657690585f, 0.652960241f},
-std::array<float,2>{0.244769454f, 0.597119987f},
-std::array<float,2>{0.840885043f, 0.160411179f},
-std::array<float,2>{0.491034836f, 0.371957898f},
-std::array<float,2>{0.724110723f, 0.977626324f},
-std::array<float,2>{0.306225389f, 0.825654685f},
-std::array<float,2>{0.550706923f, 0.451874107f},
-std::array<float,2>{0.120196044f, 0.0846887603f},
-std::array<float,2>{0.884911299f, 0.703282893f},
-std::array<float,2>{0.403942734f, 0.679119468f},
-std::array<float,2>{0.628631353f, 0.00706864567f},
-std::array<float,2>{0.127720937f, 0.383892924f},
-std::array<float,2>{0.806754529f, 0.801762402f},
-std::array<float,2>{0.00537367817f, 0.885302305f},
-std::array<float,2>{0.991570652f, 0.270274788f},
-std::array<float,2>{0.329530269f, 0.212773189f},
-std::array<float,2>{0.587759495f, 0.529702723f},
-std::array<float,2>{0.115641661f, 0.5761711f},
-std::array<float,2>{0.875866115f, 0.130120397f},
-std::array<float,2>{0.29791069f, 0.314105719f},
-std::array<float,2>{0.560035706f, 0.960288286f},
-std::array<float,2>{0.496115595f, 0.85549897f},
-std::array<float,2>{0.7305215f, 0.47834447f},
-std::array<float,2>{0.237388179f, 0.109568149f},
-std::array<float,2>{0.833791018f, 0.71953243f},
-std::array<float,2>{0.342720509f, 0.646584153f},
-std::array<float,2>{0.582041681f, 0.0432807058f},
-std::array<float,2>{0.00904940721f, 0.428364128f},
-std::array<float,2>{0.997157037f, 0.75809288f},
-std::array<float,2>{0.134015366f, 0.920074761f},
-std::array<float,2>{0.79957521f, 0.287721545f},
-std::array<float,2>{0.396922499f, 0.230130166f},
-std::array<float,2>{0.635709524f, 0.55747056f},
-std::array<float,2>{0.214693427f, 0.71328187f},
-std::array<float,2>{0.856081843f, 0.0878680795f},
-std::array<float,2>{0.456631571f, 0.443645597f},
-std::array<float,2>{0.701219738f, 0.820281386f},
-std::array<float,2>{0.252797842f, 0.974192381f},
-std::array<float,2>{0.515213072f, 0.362584531f},
-std::array<float,2>{0.0790982023f, 0.164581612f},
-std::array<float,2>{0.912530303f, 0.604291201f},
-std::array<float,2>{0.410259843f, 0.522997439f},
-std::array<float,2>{0.669389486f, 0.210857943f},
-std::array<float,2>{0.158902362f, 0.276424021f},
-std::array<float,2>{0.751077235f, 0.881141245f},
-std::array<float,2>{0.052668184f, 0.808902144f},
-std::array<float,2>{0.962569296f, 0.381532669f},
-std::array<float,2>{0.369136661f, 0.0137073779f},
-std::array<float,2>{0.616420865f, 0.68631351f},
-std::array<float,2>{0.0246130861f, 0.671130002f},
-std::array<float,2>{0.976109862f, 0.0221062507f},
-std::array<float,2>{0.314902246f, 0.397673517f},
-std::array<float,2>{0.565965891f, 0.783489406f},
-std::array<float,2>{0.376503676f, 0.89319551f},
-std::array<float,2>{0.642571211f, 0.258497059f},
-std::array<float,2>{0.141037256f, 0.196713716f},
-std::array<float,2>{0.796831906f, 0.500478983f},
-std::array<float,2>{0.289965749f, 0.6183092f},
-std::array<float,2>{0.532156646f, 0.178396761f},
-std::array<float,2>{0.0945073515f, 0.353851795f},
-std::array<float,2>{0.903281212f, 0.990029454f},
-std::array<float,2>{0.220464975f, 0.834777534f},
-std::array<float,2>{0.812627316f, 0.468057305f},
-std::array<float,2>{0.481500179f, 0.0678329319f},
-std::array<float,2>{0.749718487f, 0.690373778f},
-std::array<float,2>{0.179958612f, 0.538866818f},
-std::array<float,2>{0.768355429f, 0.239955887f},
-std::array<float,2>{0.432368398f, 0.301936924f},
-std::array<float,2>{0.673926711f, 0.930671215f},
-std::array<float,2>{0.353231847f, 0.776018977f},
-std::array<float,2>{0.595511138f, 0.421496034f},
-std::array<float,2>{0.0313026123f, 0.0539134815f},
-std::array<float,2>{0.944880009f, 0.629567921f},
-std::array<float,2>{0.451840132f, 0.735543251f},
-std::array<float,2>{0.709440172f, 0.0979891494f},
-std::array<float,2>{0.200959772f, 0.485169291f},
-std::array<float,2>{0.872888863f, 0.871543884f},
-std::array<float,2>{0.0733892843f, 0.9442029f},
-std::array<float,2>{0.92765826f, 0.33615303f},
-std::array<float,2>{0.267092437f, 0.151470363f},
-std::array<float,2>{0.52916944f, 0.58596915f},
-std::array<float,2>{0.0121639296f, 0.611996531f},
-std::array<float,2>{0.992882133f, 0.181626633f},
-std::array<float,2>{0.338651568f, 0.350128889f},
-std::array<float,2>{0.581682324f, 0.998223305f},
-std::array<float,2>{0.392035186f, 0.840379179f},
-std::array<float,2>{0.640506983f, 0.458600998f},
-std::array<float,2>{0.137207493f, 0.0730482116f},
-std::array<float,2>{0.802325606f, 0.695882142f},
-std::array<float,2>{0.301323175f, 0.66401422f},
-std::array<float,2>{0.557622254f, 0.031002434f},
-std::array<float,2>{0.110562243f, 0.400094688f},
-std::array<float,2>{0.881660163f, 0.789987803f},
-std::array<float,2>{0.24089089f, 0.906236768f},
-std::array<float,2>{0.831492662f, 0.251023233f},
-std::array<float,2>{0.4938972f, 0.190833762f},
-std::array<float,2>{0.729861796f, 0.511222661f},
-std::array<float,2>{0.16278784f, 0.74614352f},
-std::array<float,2>{0.75531584f, 0.108674094f},
-std::array<float,2>{0.407757193f, 0.493931055f},
-std::array<float,2>{0.666926086f, 0.864783287f},
-std::array<float,2>{0.37485382f, 0.948001266f},
-std::array<float,2>{0.611792803f, 0.334807277f},
-std::array<float,2>{0.0498408377f, 0.145773336f},
-std::array<float,2>{0.964925349f, 0.580257773f},
-std::array<float,2>{0.45944348f, 0.54658097f},
-std::array<float,2>{0.698541582f, 0.244765446f},
-std::array<float,2>{0.215239704f, 0.3091892f},
-std::array<float,2>{0.852155149f, 0.929457605f},
-std::array<float,2>{0.0835658163f, 0.768208444f},
-std::array<float,2>{0.909324944f, 0.406679362f},
-std::array<float,2>{0.256635129f, 0.0610543154f},
-std::array<float,2>{0.509451926f, 0.639265716f},
-std::array<float,2>{0.0979010537f, 0.649355054f},
-std::array<float,2>{0.901234448f, 0.0319359116f},
-std::array<float,2>{0.296436608f, 0.432936341f},
-std::array<float,2>{0.538452327f, 0.753826797f},
-std::array<float,2>{0.476645559f, 0.908799708f},
-std::array<float,2>{0.745874226f, 0.290160686f},
-std::array<float,2>{0.225674093f, 0.222147599f},
-std::array<float,2>{0.817430437f, 0.549127221f},
-std::array<float,2>{0.319959879f, 0.562715888f},
-std::array<float,2>{0.570232451f, 0.134476542f},
-std::array<float,2>{0.0300912671f, 0.323540479f},
-std::array<float,2>{0.970204532f, 0.96665138f},
-std::array<float,2>{0.144699872f, 0.847528458f},
-std::array<float,2>{0.790624857f, 0.471541733f},
-std::array<float,2>{0.381545246f, 0.119293205f},
-std::array<float,2>{0.646274209f, 0.728577912f},
-std::array<float,2>{0.195715398f, 0.527163565f},
-std::array<float,2>{0.868506432f, 0.214885354f},
-std::array<float,2>{0.447951347f, 0.268579692f},
-std::array<float,2>{0.704387665f, 0.890497625f},
-std::array<float,2>{0.269886464f, 0.799000144f},
-std::array<float,2>{0.525646925f, 0.389705777f},
-std::array<float,2>{0.077940844f, 0.000838217617f},
-std::array<float,2>{0.924500227f, 0.67473501f},
-std::array<float,2>{0.435989708f, 0.710100532f},
-std::array<float,2>{0.67787987f, 0.0812279806f},
-std::array<float,2>{0.185539037f, 0.445408404f},
-std::array<float,2>{0.772150517f, 0.820495486f},
-std::array<float,2>{0.0355318822f, 0.980811059f},
-std::array<float,2>{0.938595712f, 0.367695361f},
-std::array<float,2>{0.357387781f, 0.160058901f},
-std::array<float,2>{0.598463297f, 0.599562585f},
-std::array<float,2>{0.068956688f, 0.559598863f},
-std::array<float,2>{0.936785638f, 0.230468884f},
-std::array<float,2>{0.281055629f, 0.283995092f},
-std::array<float,2>{0.518716991f, 0.915843368f},
-std::array<float,2>{0.44409132f, 0.765412331f},
-std::array<float,2>{0.71267575f, 0.425638407f},
-std::array<float,2>{0.191592917f, 0.0422338359f},
-std::array<float,2>{0.859403491f, 0.644272923f},
-std::array<float,2>{0.346603066f, 0.723905385f},
-std::array<float,2>{0.608021855f, 0.113617167f},
-std::array<float,2>{0.0459128432f, 0.481005609f},
-std::array<float,2>{0.945672631f, 0.854819715f},
-std::array<float,2>{0.174979359f, 0.953730822f},
-std::array<float,2>{0.773603082f, 0.316926062f},
-std::array<float,2>{0.424576223f, 0.126310855f},
-std::array<float,2>{0.686589837f, 0.572756112f},
-std::array<float,2>{0.231719807f, 0.67972821f},
-std::array<float,2>{0.825752437f, 0.00967741199f},
-std::array<float,2>{0.472496539f, 0.377129018f},
-std::array<float,2>{0.736048102f, 0.807326674f},
-std::array<float,2>{0.286460698f, 0.877772331f},
-std::array<float,2>{0.543965638f, 0.279764354f},
-std::array<float,2>{0.103331842f, 0.203902811f},
-std::array<float,2>{0.892888844f, 0.517639399f},
-std::array<float,2>{0.388186306f, 0.607240736f},
-std::array<float,2>{0.654870808f, 0.170634598f},
-std::array<float,2>{0.151442647f, 0.364169896f},
-std::array<float,2>{0.78263998f, 0.972066581f},
-std::array<float,2>{0.0187751837f, 0.813765228f},
-std::array<float,2>{0.979287326f, 0.43859908f},
-std::array<float,2>{0.320552468f, 0.091524601f},
-std::array<float,2>{0.571037054f, 0.71491009f},
-std::array<float,2>{0.0594932698f, 0.692856312f},
-std::array<float,2>{0.955814481f, 0.0645603016f},
-std::array<float,2>{0.366479963f, 0.462118298f},
-std::array<float,2>{0.624643326f, 0.831886709f},
-std::array<float,2>{0.42139855f, 0.98557514f},
-std::array<float,2>{0.66252178f, 0.357315838f},
-std::array<float,2>{0.168409258f, 0.173109904f},
-std::array<float,2>{0.760482311f, 0.621140122f},
-std::array<float,2>{0.259564817f, 0.504616499f},
-std::array<float,2>{0.506536305f, 0.202222556f},
-std::array<float,2>{0.0891722739f, 0.265196174f},
-std::array<float,2>{0.915525973f, 0.896673799f},
-std::array<float,2>{0.208862811f, 0.787178695f},
-std::array<float,2>{0.848749459f, 0.392792404f},
-std::array<float,2>{0.46294257f, 0.0161035489f},
-std::array<float,2>{0.690157533f, 0.666151166f},
-std::array<float,2>{0.132165283f, 0.59201932f},
-std::array<float,2>{0.810072422f, 0.156117156f},
-std::array<float,2>{0.400389493f, 0.339966357f},
-std::array<float,2>{0.632756889f, 0.941019952f},
-std::array<float,2>{0.335898042f, 0.8683483f},
-std::array<float,2>{0.589922011f, 0.490883082f},
-std::array<float,2>{0.0038121189f, 0.0958800688f},
-std::array<float,2>{0.985035598f, 0.740036666f},
-std::array<float,2>{0.486581594f, 0.626439571f},
-std::array<float,2>{0.722579539f, 0.0501237921f},
-std::array<float,2>{0.247449949f, 0.416134328f},
-std::array<float,2>{0.838669956f, 0.780573964f},
-std::array<float,2>{0.12434648f, 0.9367975f},
-std::array<float,2>{0.888176858f, 0.297980428f},
-std::array<float,2>{0.308613211f, 0.236470819f},
-std::array<float,2>{0.55168438f, 0.531847358f},
-std::array<float,2>{0.0198155958f, 0.540943027f},
-std::array<float,2>{0.984098971f, 0.247553498f},
-std::array<float,2>{0.328104198f, 0.304697603f},
-std::array<float,2>{0.576241314f, 0.922765315f},
-std::array<float,2>{0.38287285f, 0.770221889f},
-std::array<float,2>{0.651561856f, 0.411053926f},
-std::array<float,2>{0.153827548f, 0.0548275076f},
-std::array<float,2>{0.785400152f, 0.633358836f},
-std::array<float,2>{0.283964276f, 0.743100703f},
-std::array<float,2>{0.539559484f, 0.103131779f},
-std::array<float,2>{0.10562139f, 0.497208744f},
-std::array<float,2>{0.895422876f, 0.86075455f},
-std::array<float,2>{0.227099687f, 0.949994624f},
-std::array<float,2>{0.821008503f, 0.331547767f},
-std::array<float,2>{0.474842966f, 0.142479479f},
-std::array<float,2>{0.739559889f, 0.584032714f},
-std::array<float,2>{0.177588716f, 0.659350634f},
-std::array<float,2>{0.77897805f, 0.0253083892f},
-std::array<float,2>{0.425862253f, 0.404919475f},
-std::array<float,2>{0.682089031f, 0.796449304f},
-std::array<float,2>{0.350316703f, 0.90016818f},
-std::array<float,2>{0.604968429f, 0.255648553f},
-std::array<float,2>{0.0411068127f, 0.192474365f},
-std::array<float,2>{0.950897276f, 0.512149215f},
-std::array<float,2>{0.438958585f, 0.613511264f},
-std::array<float,2>{0.7180053f, 0.187266156f},
-std::array<float,2>{0.188590169f, 0.345455706f},
-std::array<float,2>{0.866440535f, 0.995034575f},
-std::array<float,2>{0.0652089715f, 0.837079048f},
-std::array<float,2>{0.930531323f, 0.454700559f},
-std::array<float,2>{0.275955915f, 0.0766291842f},
-std::array<float,2>{0.520041347f, 0.699988365f},
-std::array<float,2>{0.117332414f, 0.705266714f},
-std::array<float,2>{0.883395195f, 0.082243681f},
-std::array<float,2>{0.307078928f, 0.450395107f},
-std::array<float,2>{0.547922373f, 0.827196538f},
-std::array<float,2>{0.49003008f, 0.979390919f},
-std::array<float,2>{0.725027919f, 0.374055713f},
-std::array<float,2>{0.242769018f, 0.162903503f},
-std::array<float,2>{0.843567252f, 0.594153702f},
-std::array<float,2>{0.331543356f, 0.528328478f},
-std::array<float,2>{0.588579357f, 0.213060975f},
-std::array<float,2>{0.00677032443f, 0.273324698f},
-std::array<float,2>{0.988416612f, 0.883104503f},
-std::array<float,2>{0.126482427f, 0.803126574f},
-std::array<float,2>{0.80496949f, 0.385619015f},
-std::array<float,2>{0.405768067f, 0.005003592f},
-std::array<float,2>{0.625100791f, 0.676171541f},
-std::array<float,2>{0.203744426f, 0.566427469f},
-std::array<float,2>{0.843969464f, 0.138192162f},
-std::array<float,2>{0.466512829f, 0.324807733f},
-std::array<float,2>{0.691451728f, 0.962608874f},
-std::array<float,2>{0.263098359f, 0.848493695f},
-std::array<float,2>{0.502807558f, 0.474463701f},
-std::array<float,2>{0.0901125148f, 0.123074353f},
-std::array<float,2>{0.919905007f, 0.732125938f},
-std::array<float,2>{0.414491117f, 0.654839516f},
-std::array<float,2>{0.659136772f, 0.0386849418f},
-std::array<float,2>{0.167832538f, 0.436949253f},
-std::array<float,2>{0.762980103f, 0.755434632f},
-std::array<float,2>{0.0556709468f, 0.910265565f},
-std::array<float,2>{0.960831225f, 0.294630021f},
-std::array<float,2>{0.363150507f, 0.225109503f},
-std::array<float,2>{0.619535565f, 0.554246485f},
-std::array<float,2>{0.0802764148f, 0.601750135f},
-std::array<float,2>{0.911717713f, 0.166137949f},
-std::array<float,2>{0.250003815f, 0.360728472f},
-std::array<float,2>{0.512341678f, 0.97467947f},
-std::array<float,2>{0.454390734f, 0.817765594f},
-std::array<float,2>{0.699616492f, 0.441933304f},
-std::array<float,2>{0.21276249f, 0.0887306035f},
-std::array<float,2>{0.858280897f, 0.711165726f},
-std::array<float,2>{0.370995641f, 0.685208082f},
-std::array<float,2>{0.614478111f, 0.0118191801f},
-std::array<float,2>{0.0543625318f, 0.380854726f},
-std::array<float,2>{0.964011371f, 0.810576439f},
-std::array<float,2>{0.156650841f, 0.879920244f},
-std::array<float,2>{0.752448738f, 0.274207354f},
-std::array<float,2>{0.412761807f, 0.207585379f},
-std::array<float,2>{0.671369076f, 0.521203101f},
-std::array<float,2>{0.23496078f, 0.721471667f},
-std::array<float,2>{0.83525157f, 0.112160258f},
-std::array<float,2>{0.498662949f, 0.47886318f},
-std::array<float,2>{0.733941734f, 0.857705951f},
-std::array<float,2>{0.299542636f, 0.957099617f},
-std::array<float,2>{0.562107801f, 0.314751834f},
-std::array<float,2>{0.113424927f, 0.132048681f},
-std::array<float,2>{0.877429962f, 0.577679336f},
-std::array<float,2>{0.395184427f, 0.556321025f},
-std::array<float,2>{0.634065211f, 0.227896467f},
-std::array<float,2>{0.135234267f, 0.287064523f},
-std::array<float,2>{0.79705137f, 0.918428719f},
-std::array<float,2>{0.0106939934f, 0.76031518f},
-std::array<float,2>{0.998765528f, 0.426687181f},
-std::array<float,2>{0.341408253f, 0.0468600951f},
-std::array<float,2>{0.584691584f, 0.646126509f},
-std::array<float,2>{0.0350133106f, 0.631250322f},
-std::array<float,2>{0.941473246f, 0.0518803857f},
-std::array<float,2>{0.355184644f, 0.418162912f},
-std::array<float,2>{0.595771194f, 0.775101602f},
-std::array<float,2>{0.431636423f, 0.932743013f},
-std::array<float,2>{0.673298657f, 0.303155333f},
-std::array<float,2>{0.183355927f, 0.240461975f},
-std::array<float,2>{0.767187536f, 0.535261393f},
-std::array<float,2>{0.267817318f, 0.589164376f},
-std::array<float,2>{0.530898154f, 0.149360433f},
-std::array<float,2>{0.0712215826f, 0.339659005f},
-std::array<float,2>{0.929224014f, 0.941999614f},
-std::array<float,2>{0.201458126f, 0.873375297f},
-std::array<float,2>{0.874064982f, 0.487464279f},
-std::array<float,2>{0.449868619f, 0.101347826f},
-std::array<float,2>{0.70803827f, 0.73795706f},
-std::array<float,2>{0.142922997f, 0.503471136f},
-std::array<float,2>{0.793098867f, 0.197389632f},
-std::array<float,2>{0.377255559f, 0.260159135f},
-std::array<float,2>{0.644082367f, 0.892307401f},
-std::array<float,2>{0.314017117f, 0.782324255f},
-std::array<float,2>{0.563283265f, 0.396062851f},
-std::array<float,2>{0.0254822373f, 0.0199974068f},
-std::array<float,2>{0.974225223f, 0.669819772f},
-std::array<float,2>{0.48371309f, 0.687969804f},
-std::array<float,2>{0.747880578f, 0.0698092133f},
-std::array<float,2>{0.220941812f, 0.465687841f},
-std::array<float,2>{0.815697849f, 0.832382977f},
-std::array<float,2>{0.0963765904f, 0.991811574f},
-std::array<float,2>{0.904485941f, 0.351684421f},
-std::array<float,2>{0.29150489f, 0.176149696f},
-std::array<float,2>{0.533806741f, 0.61931026f},
-std::array<float,2>{0.0476677567f, 0.579749465f},
-std::array<float,2>{0.968166053f, 0.147103667f},
-std::array<float,2>{0.372358322f, 0.332036138f},
-std::array<float,2>{0.610222399f, 0.945663214f},
-std::array<float,2>{0.40851903f, 0.865353346f},
-std::array<float,2>{0.664698124f, 0.495411545f},
-std::array<float,2>{0.160561323f, 0.106372386f},
-std::array<float,2>{0.757076502f, 0.749054492f},
-std::array<float,2>{0.255072087f, 0.636743844f},
-std::array<float,2>{0.510180712f, 0.0601364225f},
-std::array<float,2>{0.0843734816f, 0.40915674f},
-std::array<float,2>{0.907301784f, 0.767006099f},
-std::array<float,2>{0.217791364f, 0.92582643f},
-std::array<float,2>{0.854202271f, 0.312372178f},
-std::array<float,2>{0.458266735f, 0.242393523f},
-std::array<float,2>{0.695530951f, 0.544026017f},
-std::array<float,2>{0.14017798f, 0.698542118f},
-std::array<float,2>{0.803780258f, 0.0703494027f},
-std::array<float,2>{0.394220591f, 0.460448563f},
-std::array<float,2>{0.638644576f, 0.841889739f},
-std::array<float,2>{0.336731285f, 0.997971058f},
-std::array<float,2>{0.578333914f, 0.348185569f},
-std::array<float,2>{0.0148402378f, 0.183166653f},
-std::array<float,2>{0.995200992f, 0.609647751f},
-std::array<float,2>{0.49471575f, 0.508597434f},
-std::array<float,2>{0.72730422f, 0.187599838f},
-std::array<float,2>{0.240050614f, 0.253074884f},
-std::array<float,2>{0.829077303f, 0.904062986f},
-std::array<float,2>{0.112433724f, 0.7923491f},
-std::array<float,2>{0.880295992f, 0.400767177f},
-std::array<float,2>{0.303381294f, 0.0291304085f},
-std::array<float,2>{0.555391252f, 0.661467969f},
-std::array<float,2>{0.0760726333f, 0.672291458f},
-std::array<float,2>{0.923304081f, 0.00291496469f},
-std::array<float,2>{0.272328109f, 0.387963057f},
-std::array<float,2>{0.524781406f, 0.79765588f},
-std::array<float,2>{0.44594577f, 0.888088226f},
-std::array<float,2>{0.706560194f, 0.265654236f},
-std::array<float,2>{0.197502255f, 0.218319863f},
-std::array<float,2>{0.869781196f, 0.523881257f},
-std::array<float,2>{0.358235598f, 0.600983739f},
-std::array<float,2>{0.60062319f, 0.157114953f},
-std::array<float,2>{0.0381327048f, 0.370071769f},
-std::array<float,2>{0.94120115f, 0.983381212f},
-std::array<float,2>{0.186343029f, 0.822845995f},
-std::array<float,2>{0.770042062f, 0.448715627f},
-std::array<float,2>{0.434252083f, 0.078783907f},
-std::array<float,2>{0.677232683f, 0.707666874f},
-std::array<float,2>{0.224064842f, 0.548180401f},
-std::array<float,2>{0.818926334f, 0.219147444f},
-std::array<float,2>{0.478792697f, 0.292264223f},
-std::array<float,2>{0.743792236f, 0.906260073f},
-std::array<float,2>{0.294917554f, 0.751405418f},
-std::array<float,2>{0.535668492f, 0.431395829f},
-std::array<float,2>{0.0998565108f, 0.0345057584f},
-std::array<float,2>{0.899145246f, 0.652200222f},
-std::array<float,2>{0.379389226f, 0.728185713f},
-std::array<float,2>{0.646638453f, 0.118586361f},
-std::array<float,2>{0.148033202f, 0.469390094f},
-std::array<float,2>{0.791623712f, 0.844861329f},
-std::array<float,2>{0.0283541828f, 0.966923177f},
-std::array<float,2>{0.97170198f, 0.321464896f},
-std::array<float,2>{0.317938179f, 0.135100111f},
-std::array<float,2>{0.56799078f, 0.565092146f},
-std::array<float,2>{0.103575878f, 0.517400146f},
-std::array<float,2>{0.891517401f, 0.206849083f},
-std::array<float,2>{0.288504988f, 0.278802931f},
-std::array<float,2>{0.545083463f, 0.875059962f},
-std::array<float,2>{0.469382226f, 0.805347204f},
-std::array<float,2>{0.737330496f, 0.376386732f},
-std::array<float,2>{0.232885018f, 0.00987081975f},
-std::array<float,2>{0.827283084f, 0.683385789f},
-std::array<float,2>{0.323335677f, 0.718528092f},
-std::array<float,2>{0.573584139f, 0.0926591083f},
-std::array<float,2>{0.0175472833f, 0.439789087f},
-std::array<float,2>{0.976638258f, 0.81526041f},
-std::array<float,2>{0.148633376f, 0.969474971f},
-std::array<float,2>{0.78445673f, 0.366914898f},
-std::array<float,2>{0.389338672f, 0.169208094f},
-std::array<float,2>{0.652538061f, 0.609251142f},
-std::array<float,2>{0.194899991f, 0.640696645f},
-std::array<float,2>{0.862862825f, 0.0398189947f},
-std::array<float,2>{0.441716701f, 0.423611969f},
-std::array<float,2>{0.714414001f, 0.763463318f},
-std::array<float,2>{0.277583838f, 0.916907668f},
-std::array<float,2>{0.517290831f, 0.281800747f},
-std::array<float,2>{0.0671088025f, 0.23262167f},
-std::array<float,2>{0.934533298f, 0.561139584f},
-std::array<float,2>{0.423107833f, 0.570330322f},
-std::array<float,2>{0.683957279f, 0.128429249f},
-std::array<float,2>{0.172053754f, 0.318699658f},
-std::array<float,2>{0.777283072f, 0.956487834f},
-std::array<float,2>{0.0437363759f, 0.852009058f},
-std::array<float,2>{0.947563648f, 0.483400226f},
-std::array<float,2>{0.344786853f, 0.11672318f},
-std::array<float,2>{0.606548905f, 0.72531867f},
-std::array<float,2>{0.00174414692f, 0.741075277f},
-std::array<float,2>{0.987256825f, 0.0953778028f},
-std::array<float,2>{0.333818406f, 0.488980353f},
-std::array<float,2>{0.593564332f, 0.869627595f},
-std::array<float,2>{0.401986808f, 0.939175904f},
-std::array<float,2>{0.629541636f, 0.342854381f},
-std::array<float,2>{0.13079904f, 0.153960869f},
-std::array<float,2>{0.81106174f, 0.59009105f},
-std::array<float,2>{0.310783803f, 0.534189582f},
-std::array<float,2>{0.55316633f, 0.23584342f},
-std::array<float,2>{0.12120682f, 0.300744385f},
-std::array<float,2>{0.889268279f, 0.935203612f},
-std::array<float,2>{0.248256087f, 0.779153824f},
-std::array<float,2>{0.837142766f, 0.414819181f},
-std::array<float,2>{0.484783798f, 0.0473371632f},
-std::array<float,2>{0.719310939f, 0.627962589f},
-std::array<float,2>{0.171149999f, 0.624245644f},
-std::array<float,2>{0.75840801f, 0.174010321f},
-std::array<float,2>{0.419607401f, 0.358578086f},
-std::array<float,2>{0.661074698f, 0.987219989f},
-std::array<float,2>{0.36481446f, 0.829920232f},
-std::array<float,2>{0.621992111f, 0.463332325f},
-std::array<float,2>{0.0620145611f, 0.0641238019f},
-std::array<float,2>{0.954804659f, 0.695249557f},
-std::array<float,2>{0.461399198f, 0.665786207f},
-std::array<float,2>{0.68855381f, 0.0182258394f},
-std::array<float,2>{0.209644288f, 0.391410083f},
-std::array<float,2>{0.850024879f, 0.785558105f},
-std::array<float,2>{0.0878817067f, 0.895512998f},
-std::array<float,2>{0.916647673f, 0.263658553f},
-std::array<float,2>{0.261659265f, 0.199642584f},
-std::array<float,2>{0.505156159f, 0.506169379f},
-std::array<float,2>{0.0318444818f, 0.535756826f},
-std::array<float,2>{0.944426417f, 0.240979463f},
-std::array<float,2>{0.352636665f, 0.303703517f},
-std::array<float,2>{0.595154703f, 0.933443785f},
-std::array<float,2>{0.431987882f, 0.77481705f},
-std::array<float,2>{0.674652696f, 0.418716222f},
-std::array<float,2>{0.180620074f, 0.0523931235f},
-std::array<float,2>{0.767977715f, 0.631353438f},
-std::array<float,2>{0.266879737f, 0.737316191f},
-std::array<float,2>{0.528561711f, 0.100693606f},
-std::array<float,2>{0.0740549415f, 0.488158256f},
-std::array<float,2>{0.927087486f, 0.873883247f},
-std::array<float,2>{0.200501353f, 0.941833794f},
-std::array<float,2>{0.872300029f, 0.338999867f},
-std::array<float,2>{0.451346785f, 0.148844093f},
-std::array<float,2>{0.709887624f, 0.589496613f},
-std::array<float,2>{0.14136526f, 0.669292033f},
-std::array<float,2>{0.796372473f, 0.0201988127f},
-std::array<float,2>{0.376040608f, 0.395731002f},
-std::array<float,2>{0.641852438f, 0.782812059f},
-std::array<float,2>{0.315302461f, 0.891773164f},
-std::array<float,2>{0.565594256f, 0.260561287f},
-std::array<float,2>{0.0250354242f, 0.198135391f},
-std::array<float,2>{0.975770712f, 0.503045499f},
-std::array<float,2>{0.482195199f, 0.619871974f},
-std::array<float,2>{0.749451637f, 0.176724002f},
-std::array<float,2>{0.219741151f, 0.35221535f},
-std::array<float,2>{0.8132267f, 0.991373122f},
-std::array<float,2>{0.0942316726f, 0.83282131f},
-std::array<float,2>{0.902646244f, 0.465249479f},
-std::array<float,2>{0.289414138f, 0.0698395744f},
-std::array<float,2>{0.531512916f, 0.688024342f},
-std::array<float,2>{0.0782767981f, 0.711714447f},
-std::array<float,2>{0.912811339f, 0.0880386457f},
-std::array<float,2>{0.252074987f, 0.441630036f},
-std::array<float,2>{0.514648736f, 0.817941308f},
-std::array<float,2>{0.456463486f, 0.975104511f},
-std::array<float,2>{0.701974094f, 0.360855728f},
-std::array<float,2>{0.214248925f, 0.166866079f},
-std::array<float,2>{0.855860054f, 0.602054417f},
-std::array<float,2>{0.368549883f, 0.520670652f},
-std::array<float,2>{0.617157578f, 0.207417786f},
-std::array<float,2>{0.0522016771f, 0.273505509f},
-std::array<float,2>{0.962362707f, 0.880786896f},
-std::array<float,2>{0.158268601f, 0.811109662f},
-std::array<float,2>{0.751854122f, 0.379938155f},
-std::array<float,2>{0.411009401f, 0.012218249f},
-std::array<float,2>{0.66969502f, 0.684809208f},
-std::array<float,2>{0.238181144f, 0.577181816f},
-std::array<float,2>{0.833422899f, 0.132731915f},
-std::array<float,2>{0.496836573f, 0.31523481f},
-std::array<float,2>{0.731342554f, 0.957819343f},
-std::array<float,2>{0.298819602f, 0.858264923f},
-std::array<float,2>{0.56010896f, 0.47902742f},
-std::array<float,2>{0.115969941f, 0.111444123f},
-std::array<float,2>{0.875075698f, 0.720910251f},
-std::array<float,2>{0.39706549f, 0.645904541f},
-std::array<float,2>{0.635164261f, 0.0461141504f},
-std::array<float,2>{0.134279877f, 0.425980359f},
-std::array<float,2>{0.799049914f, 0.759881437f},
-std::array<float,2>{0.00968557224f, 0.918487072f},
-std::array<float,2>{0.997586846f, 0.286204934f},
-std::array<float,2>{0.342005074f, 0.228420377f},
-std::array<float,2>{0.583004296f, 0.555804014f},
-std::array<float,2>{0.120709471f, 0.594386578f},
-std::array<float,2>{0.885311484f, 0.162361756f},
-std::array<float,2>{0.306090713f, 0.374551535f},
-std::array<float,2>{0.550195992f, 0.978877068f},
-std::array<float,2>{0.490243554f, 0.827987075f},
-std::array<float,2>{0.724352539f, 0.450947285f},
-std::array<float,2>{0.244341671f, 0.0826420188f},
-std::array<float,2>{0.841506422f, 0.7056517f},
-std::array<float,2>{0.330075532f, 0.676450551f},
-std::array<float,2>{0.587288976f, 0.00546848821f},
-std::array<float,2>{0.00516419625f, 0.385032833f},
-std::array<float,2>{0.991762042f, 0.803569138f},
-std::array<float,2>{0.127054125f, 0.883368373f},
-std::array<float,2>{0.807565928f, 0.272657603f},
-std::array<float,2>{0.403441697f, 0.213521287f},
-std::array<float,2>{0.628312767f, 0.529066801f},
-std::array<float,2>{0.205799267f, 0.731640339f},
-std::array<float,2>{0.847004175f, 0.123729654f},
-std::array<float,2>{0.468607157f, 0.473712593f},
-std::array<float,2>{0.693366051f, 0.848143697f},
-std::array<float,2>{0.263876528f, 0.962206244f},
-std::array<float,2>{0.500069499f, 0.324281484f},
-std::array<float,2>{0.0929530784f, 0.137771055f},
-std::array<float,2>{0.921191752f, 0.56710875f},
-std::array<float,2>{0.416814923f, 0.553730428f},
-std::array<float,2>{0.657881439f, 0.224648431f},
-std::array<float,2>{0.164229169f, 0.294281989f},
-std::array<float,2>{0.76400125f, 0.910830259f},
-std::array<float,2>{0.0583679564f, 0.755073369f},
-std::array<float,2>{0.957070589f, 0.437188387f},
-std::array<float,2>{0.359490007f, 0.0384033769f},
-std::array<float,2>{0.61810416f, 0.654421389f},
-std::array<float,2>{0.0225587487f, 0.632970512f},
-std::array<float,2>{0.980688512f, 0.0554467365f},
-std::array<float,2>{0.325195193f, 0.410276771f},
-std::array<float,2>{0.575927973f, 0.769703627f},
-std::array<float,2>{0.386645645f, 0.922002256f},
-std::array<float,2>{0.649686575f, 0.305272341f},
-std::array<float,2>{0.154491916f, 0.247721016f},
-std::array<float,2>{0.788352191f, 0.540213823f},
-std::array<float,2>{0.282401115f, 0.584533513f},
-std::array<float,2>{0.541290224f, 0.142047316f},
-std::array<float,2>{0.108112402f, 0.331532836f},
-std::array<float,2>{0.897698581f, 0.949586809f},
-std::array<float,2>{0.228884891f, 0.8609097f},
-std::array<float,2>{0.823148072f, 0.497887284f},
-std::array<float,2>{0.473984361f, 0.102918856f},
-std::array<float,2>{0.741190016f, 0.742341936f},
-std::array<float,2>{0.179526061f, 0.512524903f},
-std::array<float,2>{0.781150818f, 0.193324134f},
-std::array<float,2>{0.429269791f, 0.255353123f},
-std::array<float,2>{0.680344462f, 0.899767399f},
-std::array<float,2>{0.348880082f, 0.796362817f},
-std::array<float,2>{0.602710903f, 0.404448748f},
-std::array<float,2>{0.0409519896f, 0.0248453636f},
-std::array<float,2>{0.951464355f, 0.65981108f},
-std::array<float,2>{0.440551519f, 0.699536502f},
-std::array<float,2>{0.715525329f, 0.0770874992f},
-std::array<float,2>{0.189604446f, 0.454477102f},
-std::array<float,2>{0.863313913f, 0.837721229f},
-std::array<float,2>{0.0642080456f, 0.994404078f},
-std::array<float,2>{0.931828797f, 0.345169544f},
-std::array<float,2>{0.274269819f, 0.186806545f},
-std::array<float,2>{0.521738708f, 0.613885641f},
-std::array<float,2>{0.00320306001f, 0.590509057f},
-std::array<float,2>{0.984746754f, 0.153804868f},
-std::array<float,2>{0.335148394f, 0.343527287f},
-std::array<float,2>{0.590732574f, 0.938554585f},
-std::array<float,2>{0.399555594f, 0.869677126f},
-std::array<float,2>{0.631919146f, 0.488695651f},
-std::array<float,2>{0.132596493f, 0.0949790105f},
-std::array<float,2>{0.809680223f, 0.740514159f},
-std::array<float,2>{0.309352517f, 0.628494501f},
-std::array<float,2>{0.551150501f, 0.047796119f},
-std::array<float,2>{0.124971785f, 0.414144695f},
-std::array<float,2>{0.888494194f, 0.778473496f},
-std::array<float,2>{0.247782722f, 0.934891462f},
-std::array<float,2>{0.838066518f, 0.300029248f},
-std::array<float,2>{0.486830384f, 0.235599339f},
-std::array<float,2>{0.72202009f, 0.534970105f},
-std::array<float,2>{0.168778941f, 0.694437683f},
-std::array<float,2>{0.759863198f, 0.0637258589f},
-std::array<float,2>{0.421362519f, 0.463438481f},
-std::array<float,2>{0.66282618f, 0.829251051f},
-std::array<float,2>{0.367081314f, 0.986351192f},
-std::array<float,2>{0.62422502f, 0.359353155f},
-std::array<float,2>{0.0590234548f, 0.174695134f},
-std::array<float,2>{0.955462813f, 0.624597132f},
-std::array<float,2>{0.463545948f, 0.506499946f},
-std::array<float,2>{0.689537466f, 0.200130135f},
-std::array<float,2>{0.208256841f, 0.263160706f},
-std::array<float,2>{0.849472165f, 0.89634639f},
-std::array<float,2>{0.0897442773f, 0.785817027f},
-std::array<float,2>{0.91563201f, 0.390734673f},
-std::array<float,2>{0.258955717f, 0.0177256502f},
-std::array<float,2>{0.506229758f, 0.665055096f},
-std::array<float,2>{0.102569871f, 0.682714999f},
-std::array<float,2>{0.893540323f, 0.0102905994f},
-std::array<float,2>{0.28684783f, 0.376730174f},
-std::array<float,2>{0.544721365f, 0.80513072f},
-std::array<float,2>{0.471999794f, 0.875644207f},
-std::array<float,2>{0.73540467f, 0.279166847f},
-std::array<float,2>{0.232071459f, 0.206360012f},
-std::array<float,2>{0.825314641f, 0.516766727f},
-std::array<float,2>{0.320842803f, 0.60868752f},
-std::array<float,2>{0.570466101f, 0.169764638f},
-std::array<float,2>{0.0191691555f, 0.366538167f},
-std::array<float,2>{0.978990793f, 0.968812883f},
-std::array<float,2>{0.152087033f, 0.814488173f},
-std::array<float,2>{0.782954395f, 0.440218866f},
-std::array<float,2>{0.388007522f, 0.0922363624f},
-std::array<float,2>{0.654332817f, 0.717997611f},
-std::array<float,2>{0.19237791f, 0.560837507f},
-std::array<float,2>{0.859961748f, 0.233247876f},
-std::array<float,2>{0.443418771f, 0.281488121f},
-std::array<float,2>{0.711979687f, 0.916106462f},
-std::array<float,2>{0.280337304f, 0.76311034f},
-std::array<float,2>{0.519521058f, 0.423218489f},
-std::array<float,2>{0.0687242597f, 0.0394778848f},
-std::array<float,2>{0.937184095f, 0.641124308f},
-std::array<float,2>{0.424115121f, 0.724844217f},
-std::array<float,2>{0.687279582f, 0.116437882f},
-std::array<float,2>{0.175408185f, 0.484288722f},
-std::array<float,2>{0.774044037f, 0.852122307f},
-std::array<float,2>{0.0468247794f, 0.956831813f},
-std::array<float,2>{0.946262717f, 0.319266349f},
-std::array<float,2>{0.346101522f, 0.127938554f},
-std::array<float,2>{0.607518733f, 0.570956051f},
-std::array<float,2>{0.0775640085f, 0.524189532f},
-std::array<float,2>{0.924205124f, 0.218064919f},
-std::array<float,2>{0.270449251f, 0.266228378f},
-std::array<float,2>{0.526248395f, 0.888578355f},
-std::array<float,2>{0.447558761f, 0.797351539f},
-std::array<float,2>{0.704604983f, 0.388245314f},
-std::array<float,2>{0.196268976f, 0.00238348031f},
-std::array<float,2>{0.868742883f, 0.672697246f},
-std::array<float,2>{0.356853008f, 0.707220614f},
-std::array<float,2>{0.597680688f, 0.0781584755f},
-std::array<float,2>{0.0358542725f, 0.449185669f},
-std::array<float,2>{0.939186513f, 0.82252413f},
-std::array<float,2>{0.184774444f, 0.982519627f},
-std::array<float,2>{0.771931827f, 0.369488448f},
-std::array<float,2>{0.436373204f, 0.15672259f},
-std::array<float,2>{0.678436935f, 0.601397514f},
-std::array<float,2>{0.226253957f, 0.651666641f},
-std::array<float,2>{0.818234742f, 0.0351259634f},
-std::array<float,2>{0.477051198f, 0.430837393f},
-std::array<float,2>{0.745558202f, 0.751559436f},
-std::array<float,2>{0.295899361f, 0.90712148f},
-std::array<float,2>{0.538930237f, 0.292907566f},
-std::array<float,2>{0.0985107645f, 0.219255254f},
-std::array<float,2>{0.900543392f, 0.54870975f},
-std::array<float,2>{0.381312937f, 0.564804435f},
-std::array<float,2>{0.64591676f, 0.135537907f},
-std::array<float,2>{0.145468578f, 0.322217286f},
-std::array<float,2>{0.790370405f, 0.967359543f},
-std::array<float,2>{0.0296250843f, 0.845656753f},
-std::array<float,2>{0.970361769f, 0.469166785f},
-std::array<float,2>{0.319433302f, 0.118808426f},
-std::array<float,2>{0.569785535f, 0.7279706f},
-std::array<float,2>{0.0507227592f, 0.749632835f},
-std::array<float,2>{0.965512455f, 0.105838411f},
-std::array<float,2>{0.374117196f, 0.496064246f},
-std::array<float,2>{0.611952543f, 0.865827084f},
-std::array<float,2>{0.407621682f, 0.946144283f},
-std::array<float,2>{0.666083336f, 0.332785934f},
-std::array<float,2>{0.162533775f, 0.146530196f},
-std::array<float,2>{0.755397856f, 0.579408109f},
-std::array<float,2>{0.256221533f, 0.544917107f},
-std::array<float,2>{0.509120584f, 0.242808267f},
-std::array<float,2>{0.0830174088f, 0.311952949f},
-std::array<float,2>{0.90980953f, 0.926553905f},
-std::array<float,2>{0.215752617f, 0.767375827f},
-std::array<float,2>{0.851599813f, 0.408376426f},
-std::array<float,2>{0.459702939f, 0.0598775484f},
-std::array<float,2>{0.698781908f, 0.637315452f},
-std::array<float,2>{0.136955082f, 0.610004127f},
-std::array<float,2>{0.802186728f, 0.182854429f},
-std::array<float,2>{0.392546177f, 0.348015904f},
-std::array<float,2>{0.63991946f, 0.997186184f},
-std::array<float,2>{0.337924093f, 0.842362404f},
-std::array<float,2>{0.581175864f, 0.460557759f},
-std::array<float,2>{0.0123004755f, 0.0709957406f},
-std::array<float,2>{0.992419362f, 0.698917031f},
-std::array<float,2>{0.493346661f, 0.662006736f},
-std::array<float,2>{0.730116785f, 0.0285680573f},
-std::array<float,2>{0.240555584f, 0.400941372f},
-std::array<float,2>{0.83173722f, 0.792957485f},
-std::array<float,2>{0.110917754f, 0.903677881f},
-std::array<float,2>{0.880935669f, 0.25389567f},
-std::array<float,2>{0.301014125f, 0.188389838f},
-std::array<float,2>{0.558235943f, 0.50819695f},
-std::array<float,2>{0.0263392199f, 0.50060904f},
-std::array<float,2>{0.973703146f, 0.196797654f},
-std::array<float,2>{0.313577861f, 0.258118927f},
-std::array<float,2>{0.562911212f, 0.8927086f},
-std::array<float,2>{0.377878934f, 0.783713996f},
-std::array<float,2>{0.643729329f, 0.398234934f},
-std::array<float,2>{0.143481076f, 0.021951925f},
-std::array<float,2>{0.793476641f, 0.671874642f},
-std::array<float,2>{0.291040838f, 0.68950665f},
-std::array<float,2>{0.533278704f, 0.0682044625f},
-std::array<float,2>{0.0957132727f, 0.46865052f},
-std::array<float,2>{0.90514797f, 0.834222376f},
-std::array<float,2>{0.221247092f, 0.98939687f},
-std::array<float,2>{0.815973699f, 0.354174644f},
-std::array<float,2>{0.483896792f, 0.178084344f},
-std::array<float,2>{0.747254133f, 0.618661225f},
-std::array<float,2>{0.182846129f, 0.628949344f},
-std::array<float,2>{0.767057955f, 0.0546586215f},
-std::array<float,2>{0.430846363f, 0.42129156f},
-std::array<float,2>{0.673401296f, 0.775700986f},
-std::array<float,2>{0.354875594f, 0.931153655f},
-std::array<float,2>{0.596401751f, 0.302499354f},
-std::array<float,2>{0.0341851078f, 0.239720643f},
-std::array<float,2>{0.941964269f, 0.538267016f},
-std::array<float,2>{0.449302107f, 0.586544394f},
-std::array<float,2>{0.708979607f, 0.151913881f},
-std::array<float,2>{0.201811716f, 0.336613774f},
-std::array<float,2>{0.874980807f, 0.943377316f},
-std::array<float,2>{0.0705184117f, 0.871630967f},
-std::array<float,2>{0.929183125f, 0.484422594f},
-std::array<float,2>{0.2681894f, 0.0981956273f},
-std::array<float,2>{0.530378938f, 0.736015737f},
-std::array<float,2>{0.114117481f, 0.71902889f},
-std::array<float,2>{0.877594531f, 0.109899364f},
-std::array<float,2>{0.298990458f, 0.477628171f},
-std::array<float,2>{0.561823785f, 0.855959475f},
-std::array<float,2>{0.498403639f, 0.960542917f},
-std::array<float,2>{0.733874679f, 0.313833475f},
-std::array<float,2>{0.234786347f, 0.130745873f},
-std::array<float,2>{0.835584879f, 0.575275302f},
-std::array<float,2>{0.341093332f, 0.556868494f},
-std::array<float,2>{0.584086835f, 0.229889676f},
-std::array<float,2>{0.00996626448f, 0.287593037f},
-std::array<float,2>{0.998209417f, 0.920478106f},
-std::array<float,2>{0.135552242f, 0.758353412f},
-std::array<float,2>{0.797646224f, 0.428069383f},
-std::array<float,2>{0.394647151f, 0.0435796417f},
-std::array<float,2>{0.634731948f, 0.647229493f},
-std::array<float,2>{0.211985737f, 0.603885412f},
-std::array<float,2>{0.857711494f, 0.164089069f},
-std::array<float,2>{0.454678208f, 0.362832189f},
-std::array<float,2>{0.700024366f, 0.974038959f},
-std::array<float,2>{0.250912309f, 0.819368184f},
-std::array<float,2>{0.511878848f, 0.444005251f},
-std::array<float,2>{0.0805691928f, 0.0870446414f},
-std::array<float,2>{0.911455929f, 0.713457882f},
-std::array<float,2>{0.412171811f, 0.685615242f},
-std::array<float,2>{0.671697557f, 0.0143448478f},
-std::array<float,2>{0.156792268f, 0.380914479f},
-std::array<float,2>{0.752214849f, 0.809179485f},
-std::array<float,2>{0.0539517775f, 0.881768405f},
-std::array<float,2>{0.964422166f, 0.277095288f},
-std::array<float,2>{0.37029621f, 0.210157365f},
-std::array<float,2>{0.615003109f, 0.522885263f},
-std::array<float,2>{0.0904507563f, 0.569421113f},
-std::array<float,2>{0.918975055f, 0.139413461f},
-std::array<float,2>{0.263617307f, 0.327954113f},
-std::array<float,2>{0.502233982f, 0.964764893f},
-std::array<float,2>{0.466230541f, 0.850929976f},
-std::array<float,2>{0.692132175f, 0.47641319f},
-std::array<float,2>{0.203292325f, 0.12232703f},
-std::array<float,2>{0.844437957f, 0.732476413f},
-std::array<float,2>{0.362682104f, 0.652814269f},
-std::array<float,2>{0.61986059f, 0.0357116982f},
-std::array<float,2>{0.0562821664f, 0.434832007f},
-std::array<float,2>{0.960352004f, 0.757791221f},
-std::array<float,2>{0.167445347f, 0.912587583f},
-std::array<float,2>{0.763485909f, 0.295213997f},
-std::array<float,2>{0.414597899f, 0.224399418f},
-std::array<float,2>{0.658232033f, 0.551164687f},
-std::array<float,2>{0.242537588f, 0.703805149f},
-std::array<float,2>{0.843253434f, 0.0842150375f},
-std::array<float,2>{0.489474565f, 0.451458871f},
-std::array<float,2>{0.725523591f, 0.825816751f},
-std::array<float,2>{0.307489574f, 0.978216827f},
-std::array<float,2>{0.548604667f, 0.371434063f},
-std::array<float,2>{0.117784478f, 0.160711095f},
-std::array<float,2>{0.883265018f, 0.597329855f},
-std::array<float,2>{0.405589491f, 0.529836237f},
-std::array<float,2>{0.625773787f, 0.211921543f},
-std::array<float,2>{0.126451984f, 0.269964278f},
-std::array<float,2>{0.8053931f, 0.884873509f},
-std::array<float,2>{0.00594779942f, 0.802535236f},
-std::array<float,2>{0.988872886f, 0.384349555f},
-std::array<float,2>{0.33138454f, 0.00737257255f},
-std::array<float,2>{0.588080227f, 0.679312706f},
-std::array<float,2>{0.04162696f, 0.657653809f},
-std::array<float,2>{0.950228035f, 0.0256631896f},
-std::array<float,2>{0.349868566f, 0.403638691f},
-std::array<float,2>{0.605451167f, 0.793486416f},
-std::array<float,2>{0.426683277f, 0.901093125f},
-std::array<float,2>{0.682132125f, 0.257015049f},
-std::array<float,2>{0.176865622f, 0.193508431f},
-std::array<float,2>{0.77866292f, 0.514276981f},
-std::array<float,2>{0.275740087f, 0.616293669f},
-std::array<float,2>{0.519799232f, 0.183787584f},
-std::array<float,2>{0.064826414f, 0.347121894f},
-std::array<float,2>{0.929804862f, 0.994101286f},
-std::array<float,2>{0.189249218f, 0.838252485f},
-std::array<float,2>{0.867154181f, 0.456290811f},
-std::array<float,2>{0.439420372f, 0.0746306852f},
-std::array<float,2>{0.718310654f, 0.702508748f},
-std::array<float,2>{0.153535888f, 0.542023301f},
-std::array<float,2>{0.785987079f, 0.249307245f},
-std::array<float,2>{0.38371554f, 0.308577567f},
-std::array<float,2>{0.652020574f, 0.925213277f},
-std::array<float,2>{0.327539295f, 0.772566259f},
-std::array<float,2>{0.576791883f, 0.41379118f},
-std::array<float,2>{0.0205009356f, 0.0575966649f},
-std::array<float,2>{0.983521938f, 0.635654688f},
-std::array<float,2>{0.475153118f, 0.745562434f},
-std::array<float,2>{0.739939988f, 0.103532299f},
-std::array<float,2>{0.226922318f, 0.499852896f},
-std::array<float,2>{0.820640385f, 0.862535238f},
-std::array<float,2>{0.106089406f, 0.952489972f},
-std::array<float,2>{0.894646585f, 0.328760564f},
-std::array<float,2>{0.28322041f, 0.144358829f},
-std::array<float,2>{0.539081752f, 0.582070529f},
-std::array<float,2>{0.061576508f, 0.621721089f},
-std::array<float,2>{0.954529643f, 0.173549503f},
-std::array<float,2>{0.364547968f, 0.356923431f},
-std::array<float,2>{0.621509373f, 0.986302793f},
-std::array<float,2>{0.419075787f, 0.831369579f},
-std::array<float,2>{0.660215437f, 0.462552786f},
-std::array<float,2>{0.171734437f, 0.0652737617f},
-std::array<float,2>{0.758219004f, 0.693169892f},
-std::array<float,2>{0.26097244f, 0.666831732f},
-std::array<float,2>{0.505532086f, 0.0161246248f},
-std::array<float,2>{0.0870836452f, 0.39336428f},
-std::array<float,2>{0.916214049f, 0.7876122f},
-std::array<float,2>{0.209054455f, 0.897437811f},
-std::array<float,2>{0.850179672f, 0.264912397f},
-std::array<float,2>{0.461596578f, 0.202880174f},
-std::array<float,2>{0.68903625f, 0.504200816f},
-std::array<float,2>{0.130164519f, 0.73947376f},
-std::array<float,2>{0.810590446f, 0.0962561369f},
-std::array<float,2>{0.401617408f, 0.490538031f},
-std::array<float,2>{0.629286706f, 0.868711114f},
-std::array<float,2>{0.333491623f, 0.940456688f},
-std::array<float,2>{0.593019009f, 0.340504527f},
-std::array<float,2>{0.00125488802f, 0.155447662f},
-std::array<float,2>{0.986436486f, 0.592633963f},
-std::array<float,2>{0.485092163f, 0.531718612f},
-std::array<float,2>{0.719184279f, 0.236886159f},
-std::array<float,2>{0.248562038f, 0.298501968f},
-std::array<float,2>{0.837730765f, 0.937097132f},
-std::array<float,2>{0.121775791f, 0.781101882f},
-std::array<float,2>{0.888911545f, 0.416653812f},
-std::array<float,2>{0.311431348f, 0.0504543632f},
-std::array<float,2>{0.553700447f, 0.626879096f},
-std::array<float,2>{0.0664994642f, 0.643965304f},
-std::array<float,2>{0.933996856f, 0.0425678417f},
-std::array<float,2>{0.278106987f, 0.424924642f},
-std::array<float,2>{0.517043233f, 0.764701009f},
-std::array<float,2>{0.442156762f, 0.915279448f},
-std::array<float,2>{0.714036822f, 0.283545494f},
-std::array<float,2>{0.194525987f, 0.231168926f},
-std::array<float,2>{0.862747669f, 0.56020838f},
-std::array<float,2>{0.345471382f, 0.572297692f},
-std::array<float,2>{0.607344747f, 0.12662223f},
-std::array<float,2>{0.0433718413f, 0.316448987f},
-std::array<float,2>{0.947835028f, 0.953255355f},
-std::array<float,2>{0.172460631f, 0.855343521f},
-std::array<float,2>{0.776711226f, 0.480488449f},
-std::array<float,2>{0.423596323f, 0.114170909f},
-std::array<float,2>{0.684522629f, 0.724507034f},
-std::array<float,2>{0.232992798f, 0.518510103f},
-std::array<float,2>{0.827683687f, 0.203224897f},
-std::array<float,2>{0.469076991f, 0.279945076f},
-std::array<float,2>{0.738037467f, 0.877406538f},
-std::array<float,2>{0.288828224f, 0.80689919f},
-std::array<float,2>{0.545713127f, 0.377506018f},
-std::array<float,2>{0.104399115f, 0.00890512671f},
-std::array<float,2>{0.891022325f, 0.680569172f},
-std::array<float,2>{0.388970435f, 0.715603352f},
-std::array<float,2>{0.6530056f, 0.090926826f},
-std::array<float,2>{0.148960218f, 0.438993931f},
-std::array<float,2>{0.785061896f, 0.814384818f},
-std::array<float,2>{0.0170295481f, 0.972621322f},
-std::array<float,2>{0.977405965f, 0.363400042f},
-std::array<float,2>{0.32410723f, 0.169978157f},
-std::array<float,2>{0.574156344f, 0.606697917f},
-std::array<float,2>{0.100486912f, 0.549785197f},
-std::array<float,2>{0.898831725f, 0.222509116f},
-std::array<float,2>{0.294015646f, 0.290577829f},
-std::array<float,2>{0.535294533f, 0.908573627f},
-std::array<float,2>{0.479154438f, 0.752935827f},
-std::array<float,2>{0.743205965f, 0.433322936f},
-std::array<float,2>{0.224222377f, 0.0315524936f},
-std::array<float,2>{0.818769872f, 0.648643553f},
-std::array<float,2>{0.3178069f, 0.729467809f},
-std::array<float,2>{0.567749262f, 0.119823925f},
-std::array<float,2>{0.0292376131f, 0.471035898f},
-std::array<float,2>{0.972367048f, 0.846714437f},
-std::array<float,2>{0.147631094f, 0.966290653f},
-std::array<float,2>{0.791280568f, 0.323828846f},
-std::array<float,2>{0.379837334f, 0.133861467f},
-std::array<float,2>{0.647047698f, 0.56301856f},
-std::array<float,2>{0.197858572f, 0.674156845f},
-std::array<float,2>{0.869593322f, 0.000324801746f},
-std::array<float,2>{0.445635587f, 0.390451998f},
-std::array<float,2>{0.706228614f, 0.799438179f},
-std::array<float,2>{0.27178666f, 0.889829159f},
-std::array<float,2>{0.524971664f, 0.269201368f},
-std::array<float,2>{0.0755859241f, 0.21539259f},
-std::array<float,2>{0.923494399f, 0.526801467f},
-std::array<float,2>{0.433745623f, 0.598711193f},
-std::array<float,2>{0.677655637f, 0.159388334f},
-std::array<float,2>{0.185574755f, 0.367595375f},
-std::array<float,2>{0.769563198f, 0.981359065f},
-std::array<float,2>{0.0386825651f, 0.8208884f},
-std::array<float,2>{0.94078052f, 0.445834517f},
-std::array<float,2>{0.357679009f, 0.0816941559f},
-std::array<float,2>{0.601523876f, 0.710831881f},
-std::array<float,2>{0.0152041158f, 0.695330143f},
-std::array<float,2>{0.995801032f, 0.0725787878f},
-std::array<float,2>{0.33608225f, 0.458374292f},
-std::array<float,2>{0.579040945f, 0.839912772f},
-std::array<float,2>{0.393920124f, 0.998611748f},
-std::array<float,2>{0.63787657f, 0.350028098f},
-std::array<float,2>{0.139698073f, 0.180845976f},
-std::array<float,2>{0.804654539f, 0.61170882f},
-std::array<float,2>{0.302833289f, 0.511496365f},
-std::array<float,2>{0.554908752f, 0.191221982f},
-std::array<float,2>{0.112869926f, 0.251825571f},
-std::array<float,2>{0.880638838f, 0.905591011f},
-std::array<float,2>{0.239260137f, 0.789218187f},
-std::array<float,2>{0.828396499f, 0.39959982f},
-std::array<float,2>{0.494621754f, 0.0305610821f},
-std::array<float,2>{0.726995409f, 0.663293183f},
-std::array<float,2>{0.161127329f, 0.580615997f},
-std::array<float,2>{0.757770896f, 0.146210596f},
-std::array<float,2>{0.408980131f, 0.334407359f},
-std::array<float,2>{0.664428234f, 0.94734931f},
-std::array<float,2>{0.372754276f, 0.864499867f},
-std::array<float,2>{0.609425366f, 0.493339539f},
-std::array<float,2>{0.0470370278f, 0.109028324f},
-std::array<float,2>{0.968367219f, 0.746736944f},
-std::array<float,2>{0.458873928f, 0.638833463f},
-std::array<float,2>{0.696077824f, 0.0607787669f},
-std::array<float,2>{0.218568116f, 0.406962663f},
-std::array<float,2>{0.853665233f, 0.767776668f},
-std::array<float,2>{0.0846092179f, 0.929135263f},
-std::array<float,2>{0.907967091f, 0.308837682f},
-std::array<float,2>{0.255469888f, 0.244619012f},
-std::array<float,2>{0.51042068f, 0.546054125f},
-std::array<float,2>{0.0509405658f, 0.522273242f},
-std::array<float,2>{0.961534917f, 0.209033266f},
-std::array<float,2>{0.368054152f, 0.276194811f},
-std::array<float,2>{0.616162598f, 0.882649243f},
-std::array<float,2>{0.412038535f, 0.810092151f},
-std::array<float,2>{0.668010831f, 0.382152468f},
-std::array<float,2>{0.159919128f, 0.0155511238f},
-std::array<float,2>{0.750110447f, 0.687499523f},
-std::array<float,2>{0.253329039f, 0.714056551f},
-std::array<float,2>{0.514498055f, 0.0865924284f},
-std::array<float,2>{0.0795749575f, 0.444654435f},
-std::array<float,2>{0.913320541f, 0.818464816f},
-std::array<float,2>{0.213543579f, 0.972752213f},
-std::array<float,2>{0.856452942f, 0.361875474f},
-std::array<float,2>{0.455844849f, 0.165661201f},
-std::array<float,2>{0.70219332f, 0.605096579f},
-std::array<float,2>{0.133580774f, 0.64787358f},
-std::array<float,2>{0.800107598f, 0.0439884923f},
-std::array<float,2>{0.398141563f, 0.429120153f},
-std::array<float,2>{0.636276066f, 0.75973779f},
-std::array<float,2>{0.343427956f, 0.92180258f},
-std::array<float,2>{0.583716333f, 0.28880477f},
-std::array<float,2>{0.00839932077f, 0.2289612f},
-std::array<float,2>{0.99614352f, 0.558290958f},
-std::array<float,2>{0.497337162f, 0.575110912f},
-std::array<float,2>{0.731936276f, 0.129655331f},
-std::array<float,2>{0.236614436f, 0.312651545f},
-std::array<float,2>{0.832469225f, 0.959548712f},
-std::array<float,2>{0.116528749f, 0.857067466f},
-std::array<float,2>{0.876573861f, 0.476900369f},
-std::array<float,2>{0.297357619f, 0.111297168f},
-std::array<float,2>{0.558861017f, 0.720538795f},
-std::array<float,2>{0.0729834139f, 0.735278666f},
-std::array<float,2>{0.926331043f, 0.0988327339f},
-std::array<float,2>{0.266052961f, 0.486033112f},
-std::array<float,2>{0.528288543f, 0.872684777f},
-std::array<float,2>{0.452656746f, 0.944941163f},
-std::array<float,2>{0.71003145f, 0.337668329f},
-std::array<float,2>{0.199724838f, 0.151310742f},
-std::array<float,2>{0.871923447f, 0.587873459f},
-std::array<float,2>{0.352390438f, 0.537129998f},
-std::array<float,2>{0.594196737f, 0.239234522f},
-std::array<float,2>{0.0324329324f, 0.30104509f},
-std::array<float,2>{0.944008231f, 0.930041194f},
-std::array<float,2>{0.180872932f, 0.776652157f},
-std::array<float,2>{0.769209862f, 0.420162499f},
-std::array<float,2>{0.433294505f, 0.0535292812f},
-std::array<float,2>{0.675776601f, 0.630580902f},
-std::array<float,2>{0.219196796f, 0.617670834f},
-std::array<float,2>{0.813513517f, 0.179117307f},
-std::array<float,2>{0.481112838f, 0.354651868f},
-std::array<float,2>{0.748333395f, 0.988698006f},
-std::array<float,2>{0.290171325f, 0.834979951f},
-std::array<float,2>{0.532505155f, 0.467326373f},
-std::array<float,2>{0.0950035229f, 0.0666262358f},
-std::array<float,2>{0.904291153f, 0.6907866f},
-std::array<float,2>{0.375052124f, 0.67046839f},
-std::array<float,2>{0.640680194f, 0.0231364295f},
-std::array<float,2>{0.141684636f, 0.396637976f},
-std::array<float,2>{0.79497844f, 0.784629524f},
-std::array<float,2>{0.0235577188f, 0.894149184f},
-std::array<float,2>{0.97503221f, 0.259019554f},
-std::array<float,2>{0.315660149f, 0.195359379f},
-std::array<float,2>{0.564674914f, 0.501218617f},
-std::array<float,2>{0.108816728f, 0.583586872f},
-std::array<float,2>{0.897193849f, 0.143023342f},
-std::array<float,2>{0.281930655f, 0.329242319f},
-std::array<float,2>{0.542410553f, 0.951702833f},
-std::array<float,2>{0.472717971f, 0.862187803f},
-std::array<float,2>{0.741316617f, 0.498770684f},
-std::array<float,2>{0.230002269f, 0.104520261f},
-std::array<float,2>{0.823448122f, 0.745006263f},
-std::array<float,2>{0.325301826f, 0.636105061f},
-std::array<float,2>{0.575034142f, 0.0579645187f},
-std::array<float,2>{0.0223192088f, 0.412476659f},
-std::array<float,2>{0.98182714f, 0.771898389f},
-std::array<float,2>{0.155334711f, 0.924464166f},
-std::array<float,2>{0.787599981f, 0.307064921f},
-std::array<float,2>{0.384935498f, 0.248066843f},
-std::array<float,2>{0.648819625f, 0.541985512f},
-std::array<float,2>{0.191003293f, 0.701689839f},
-std::array<float,2>{0.865146041f, 0.0754157528f},
-std::array<float,2>{0.439494491f, 0.455167621f},
-std::array<float,2>{0.716784477f, 0.839581788f},
-std::array<float,2>{0.274564058f, 0.993109465f},
-std::array<float,2>{0.523412406f, 0.3465195f},
-std::array<float,2>{0.063289389f, 0.184661403f},
-std::array<float,2>{0.932655156f, 0.615706503f},
-std::array<float,2>{0.428701758f, 0.514913917f},
-std::array<float,2>{0.681538463f, 0.194654107f},
-std::array<float,2>{0.178168714f, 0.256557405f},
-std::array<float,2>{0.779851615f, 0.901508987f},
-std::array<float,2>{0.0396148749f, 0.794818878f},
-std::array<float,2>{0.953014135f, 0.403316557f},
-std::array<float,2>{0.347887397f, 0.0273374747f},
-std::array<float,2>{0.601783872f, 0.656430006f},
-std::array<float,2>{0.00462044589f, 0.677880585f},
-std::array<float,2>{0.990902603f, 0.0060764947f},
-std::array<float,2>{0.328766972f, 0.383275181f},
-std::array<float,2>{0.586800694f, 0.801437795f},
-std::array<float,2>{0.402969182f, 0.885974765f},
-std::array<float,2>{0.62745887f, 0.271401018f},
-std::array<float,2>{0.128044292f, 0.211772129f},
-std::array<float,2>{0.808418393f, 0.530917525f},
-std::array<float,2>{0.305045962f, 0.59589237f},
-std::array<float,2>{0.549182177f, 0.161939472f},
-std::array<float,2>{0.119347781f, 0.373039007f},
-std::array<float,2>{0.885933042f, 0.977100551f},
-std::array<float,2>{0.245827079f, 0.825153351f},
-std::array<float,2>{0.839902401f, 0.452672213f},
-std::array<float,2>{0.491454482f, 0.0855432078f},
-std::array<float,2>{0.723132908f, 0.704111636f},
-std::array<float,2>{0.165072322f, 0.552574039f},
-std::array<float,2>{0.764650226f, 0.223302409f},
-std::array<float,2>{0.417741418f, 0.296661645f},
-std::array<float,2>{0.656717002f, 0.913821757f},
-std::array<float,2>{0.361265689f, 0.755921304f},
-std::array<float,2>{0.618814766f, 0.43454659f},
-std::array<float,2>{0.0571451895f, 0.0363678448f},
-std::array<float,2>{0.958508015f, 0.653778255f},
-std::array<float,2>{0.46767658f, 0.733574986f},
-std::array<float,2>{0.694462717f, 0.121096522f},
-std::array<float,2>{0.206820339f, 0.475408792f},
-std::array<float,2>{0.845977604f, 0.850431979f},
-std::array<float,2>{0.0923500955f, 0.963368118f},
-std::array<float,2>{0.920050025f, 0.326652974f},
-std::array<float,2>{0.265096039f, 0.1399443f},
-std::array<float,2>{0.500999689f, 0.568451881f},
-std::array<float,2>{0.0183029659f, 0.606014311f},
-std::array<float,2>{0.979643643f, 0.171662703f},
-std::array<float,2>{0.321574509f, 0.364711225f},
-std::array<float,2>{0.571742177f, 0.971469879f},
-std::array<float,2>{0.387121022f, 0.812848747f},
-std::array<float,2>{0.655945003f, 0.437845469f},
-std::array<float,2>{0.150940359f, 0.0904979184f},
-std::array<float,2>{0.781539083f, 0.716122031f},
-std::array<float,2>{0.285761654f, 0.681481004f},
-std::array<float,2>{0.543283463f, 0.00871676113f},
-std::array<float,2>{0.101914331f, 0.378717124f},
-std::array<float,2>{0.8943578f, 0.808402836f},
-std::array<float,2>{0.231100231f, 0.878525019f},
-std::array<float,2>{0.824467003f, 0.28072989f},
-std::array<float,2>{0.471222192f, 0.204332516f},
-std::array<float,2>{0.735212386f, 0.519329369f},
-std::array<float,2>{0.174505711f, 0.723629236f},
-std::array<float,2>{0.775257885f, 0.114288017f},
-std::array<float,2>{0.425655633f, 0.481888473f},
-std::array<float,2>{0.685633063f, 0.8536762f},
-std::array<float,2>{0.347258598f, 0.95443368f},
-std::array<float,2>{0.608959854f, 0.31793943f},
-std::array<float,2>{0.0452712663f, 0.125063255f},
-std::array<float,2>{0.946564198f, 0.57339102f},
-std::array<float,2>{0.445184052f, 0.559054255f},
-std::array<float,2>{0.711173654f, 0.232152551f},
-std::array<float,2>{0.193111166f, 0.284381568f},
-std::array<float,2>{0.860614419f, 0.914947152f},
-std::array<float,2>{0.0701302215f, 0.764388025f},
-std::array<float,2>{0.936096013f, 0.423855215f},
-std::array<float,2>{0.27999559f, 0.0415809304f},
-std::array<float,2>{0.518262267f, 0.643290043f},
-std::array<float,2>{0.123574696f, 0.625761509f},
-std::array<float,2>{0.887435675f, 0.0494723134f},
-std::array<float,2>{0.310249984f, 0.417485088f},
-std::array<float,2>{0.551990986f, 0.780139089f},
-std::array<float,2>{0.487401307f, 0.935954213f},
-std::array<float,2>{0.721505642f, 0.297317892f},
-std::array<float,2>{0.246982351f, 0.237760469f},
-std::array<float,2>{0.8390311f, 0.532490015f},
-std::array<float,2>{0.334918529f, 0.593692839f},
-std::array<float,2>{0.591559231f, 0.154918075f},
-std::array<float,2>{0.00267730188f, 0.341504008f},
-std::array<float,2>{0.985410452f, 0.939750075f},
-std::array<float,2>{0.131768808f, 0.868108392f},
-std::array<float,2>{0.809214413f, 0.491691142f},
-std::array<float,2>{0.398472965f, 0.0973178521f},
-std::array<float,2>{0.631784499f, 0.738906801f},
-std::array<float,2>{0.207801729f, 0.505247593f},
-std::array<float,2>{0.847680092f, 0.201784506f},
-std::array<float,2>{0.464459836f, 0.264412791f},
-std::array<float,2>{0.690559685f, 0.897977233f},
-std::array<float,2>{0.258040518f, 0.788635552f},
-std::array<float,2>{0.506961346f, 0.39385727f},
-std::array<float,2>{0.0886062905f, 0.0174148008f},
-std::array<float,2>{0.914651155f, 0.667674541f},
-std::array<float,2>{0.420810729f, 0.69182837f},
-std::array<float,2>{0.663675547f, 0.0655877367f},
-std::array<float,2>{0.169504762f, 0.461726338f},
-std::array<float,2>{0.760887802f, 0.830915213f},
-std::array<float,2>{0.0596430376f, 0.985256195f},
-std::array<float,2>{0.956058204f, 0.356346011f},
-std::array<float,2>{0.365805209f, 0.17236945f},
-std::array<float,2>{0.623332739f, 0.622317433f},
-std::array<float,2>{0.0825590715f, 0.545403302f},
-std::array<float,2>{0.908471227f, 0.245694831f},
-std::array<float,2>{0.25743255f, 0.310432583f},
-std::array<float,2>{0.508104682f, 0.927866936f},
-std::array<float,2>{0.460926145f, 0.769050717f},
-std::array<float,2>{0.697381794f, 0.407480925f},
-std::array<float,2>{0.216063678f, 0.0616204552f},
-std::array<float,2>{0.853419721f, 0.640101671f},
-std::array<float,2>{0.37400952f, 0.747193456f},
-std::array<float,2>{0.613090098f, 0.108176515f},
-std::array<float,2>{0.0489301234f, 0.492794216f},
-std::array<float,2>{0.966001987f, 0.863609552f},
-std::array<float,2>{0.163694546f, 0.948577583f},
-std::array<float,2>{0.754033506f, 0.335134834f},
-std::array<float,2>{0.406321526f, 0.144979194f},
-std::array<float,2>{0.667839527f, 0.581561565f},
-std::array<float,2>{0.241754204f, 0.66212672f},
-std::array<float,2>{0.830321193f, 0.0302527212f},
-std::array<float,2>{0.492371023f, 0.399145335f},
-std::array<float,2>{0.728735685f, 0.790598869f},
-std::array<float,2>{0.301858634f, 0.905157804f},
-std::array<float,2>{0.557023585f, 0.25064984f},
-std::array<float,2>{0.109625518f, 0.190123782f},
-std::array<float,2>{0.882060111f, 0.510737896f},
-std::array<float,2>{0.390779585f, 0.612794399f},
-std::array<float,2>{0.639380336f, 0.180135787f},
-std::array<float,2>{0.138440356f, 0.351397306f},
-std::array<float,2>{0.801598012f, 0.999505758f},
-std::array<float,2>{0.0128228394f, 0.840845048f},
-std::array<float,2>{0.993267655f, 0.45761016f},
-std::array<float,2>{0.339804739f, 0.0737599507f},
-std::array<float,2>{0.580664396f, 0.69699496f},
-std::array<float,2>{0.0366222411f, 0.709850669f},
-std::array<float,2>{0.937788248f, 0.0809915811f},
-std::array<float,2>{0.355953246f, 0.446419835f},
-std::array<float,2>{0.599232912f, 0.821736872f},
-std::array<float,2>{0.437129349f, 0.981766343f},
-std::array<float,2>{0.67928803f, 0.368522614f},
-std::array<float,2>{0.18456161f, 0.158212215f},
-std::array<float,2>{0.772491872f, 0.598596156f},
-std::array<float,2>{0.27076605f, 0.525871575f},
-std::array<float,2>{0.526407361f, 0.216411129f},
-std::array<float,2>{0.0771104544f, 0.267656118f},
-std::array<float,2>{0.92515552f, 0.889401436f},
-std::array<float,2>{0.197142407f, 0.800685108f},
-std::array<float,2>{0.867790818f, 0.389453113f},
-std::array<float,2>{0.448971272f, 0.00132697658f},
-std::array<float,2>{0.704069734f, 0.675090015f},
-std::array<float,2>{0.145993993f, 0.56440872f},
-std::array<float,2>{0.789588749f, 0.132998988f},
-std::array<float,2>{0.382096708f, 0.322784632f},
-std::array<float,2>{0.645441949f, 0.965468943f},
-std::array<float,2>{0.318553001f, 0.84572655f},
-std::array<float,2>{0.569274068f, 0.471750885f},
-std::array<float,2>{0.0306784417f, 0.1203079f},
-std::array<float,2>{0.969035745f, 0.729680657f},
-std::array<float,2>{0.478292882f, 0.649866939f},
-std::array<float,2>{0.744636059f, 0.0330517776f},
-std::array<float,2>{0.225170419f, 0.431763172f},
-std::array<float,2>{0.816890955f, 0.752191246f},
-std::array<float,2>{0.0991758928f, 0.909201801f},
-std::array<float,2>{0.90181762f, 0.289750129f},
-std::array<float,2>{0.295382828f, 0.220704466f},
-std::array<float,2>{0.537901103f, 0.550027072f},
-std::array<float,2>{0.011511391f, 0.555075288f},
-std::array<float,2>{0.999159932f, 0.227233261f},
-std::array<float,2>{0.339909196f, 0.285238683f},
-std::array<float,2>{0.585196733f, 0.919011533f},
-std::array<float,2>{0.395683378f, 0.761479199f},
-std::array<float,2>{0.633714437f, 0.426943779f},
-std::array<float,2>{0.135972008f, 0.0456658863f},
-std::array<float,2>{0.79882592f, 0.644706547f},
-std::array<float,2>{0.300324798f, 0.721729934f},
-std::array<float,2>{0.560820878f, 0.113123648f},
-std::array<float,2>{0.115091227f, 0.480294108f},
-std::array<float,2>{0.878643394f, 0.858592093f},
-std::array<float,2>{0.235997096f, 0.958636343f},
-std::array<float,2>{0.834770083f, 0.316262037f},
-std::array<float,2>{0.499864548f, 0.130966589f},
-std::array<float,2>{0.7326985f, 0.57679075f},
-std::array<float,2>{0.157972381f, 0.684299409f},
-std::array<float,2>{0.753804803f, 0.0131501937f},
-std::array<float,2>{0.413232028f, 0.37949869f},
-std::array<float,2>{0.670824587f, 0.811783493f},
-std::array<float,2>{0.369271338f, 0.879102647f},
-std::array<float,2>{0.613839924f, 0.274586856f},
-std::array<float,2>{0.053103663f, 0.208164528f},
-std::array<float,2>{0.963190973f, 0.520398021f},
-std::array<float,2>{0.453578681f, 0.603344798f},
-std::array<float,2>{0.700805783f, 0.167834252f},
-std::array<float,2>{0.211495489f, 0.360342503f},
-std::array<float,2>{0.858973742f, 0.976454437f},
-std::array<float,2>{0.0815650225f, 0.816532493f},
-std::array<float,2>{0.911014915f, 0.443314433f},
-std::array<float,2>{0.251277089f, 0.0892730579f},
-std::array<float,2>{0.512700379f, 0.712713897f},
-std::array<float,2>{0.0970903337f, 0.688875437f},
-std::array<float,2>{0.906091809f, 0.068508096f},
-std::array<float,2>{0.292223066f, 0.466406375f},
-std::array<float,2>{0.534187853f, 0.83357203f},
-std::array<float,2>{0.483088136f, 0.990804017f},
-std::array<float,2>{0.746896923f, 0.352732033f},
-std::array<float,2>{0.222364575f, 0.177701905f},
-std::array<float,2>{0.815291286f, 0.620268881f},
-std::array<float,2>{0.313253641f, 0.50286752f},
-std::array<float,2>{0.563894033f, 0.198688522f},
-std::array<float,2>{0.0269438755f, 0.261573464f},
-std::array<float,2>{0.973394513f, 0.890853345f},
-std::array<float,2>{0.144357339f, 0.781953037f},
-std::array<float,2>{0.794350028f, 0.394925535f},
-std::array<float,2>{0.378315449f, 0.0207812339f},
-std::array<float,2>{0.642957509f, 0.668560565f},
-std::array<float,2>{0.202490211f, 0.588400722f},
-std::array<float,2>{0.873471558f, 0.149992377f},
-std::array<float,2>{0.450396866f, 0.338301092f},
-std::array<float,2>{0.707551479f, 0.943011463f},
-std::array<float,2>{0.26914826f, 0.874876916f},
-std::array<float,2>{0.52956897f, 0.487285525f},
-std::array<float,2>{0.0716291517f, 0.100479454f},
-std::array<float,2>{0.928659797f, 0.737206459f},
-std::array<float,2>{0.429738939f, 0.63245666f},
-std::array<float,2>{0.6727525f, 0.0517210141f},
-std::array<float,2>{0.182116896f, 0.419774175f},
-std::array<float,2>{0.765766382f, 0.773959696f},
-std::array<float,2>{0.0336670876f, 0.931951821f},
-std::array<float,2>{0.9425143f, 0.30422166f},
-std::array<float,2>{0.354437977f, 0.24150981f},
-std::array<float,2>{0.597326517f, 0.537048519f},
-std::array<float,2>{0.0659432337f, 0.615038276f},
-std::array<float,2>{0.930816472f, 0.186240628f},
-std::array<float,2>{0.276973546f, 0.34421286f},
-std::array<float,2>{0.520926654f, 0.995141268f},
-std::array<float,2>{0.438196719f, 0.83594507f},
-std::array<float,2>{0.717445076f, 0.453248113f},
-std::array<float,2>{0.188305378f, 0.0775473341f},
-std::array<float,2>{0.865435362f, 0.701133728f},
-std::array<float,2>{0.351124972f, 0.658761978f},
-std::array<float,2>{0.603576481f, 0.0240619425f},
-std::array<float,2>{0.042772375f, 0.405275822f},
-std::array<float,2>{0.949738085f, 0.795046687f},
-std::array<float,2>{0.176258102f, 0.898648739f},
-std::array<float,2>{0.778044283f, 0.254523605f},
-std::array<float,2>{0.426898986f, 0.192027733f},
-std::array<float,2>{0.682980716f, 0.513023138f},
-std::array<float,2>{0.227642417f, 0.743732452f},
-std::array<float,2>{0.82204628f, 0.101746202f},
-std::array<float,2>{0.475964785f, 0.496764541f},
-std::array<float,2>{0.738846898f, 0.860217512f},
-std::array<float,2>{0.284260869f, 0.950854838f},
-std::array<float,2>{0.540882528f, 0.330450505f},
-std::array<float,2>{0.106653653f, 0.141041592f},
-std::array<float,2>{0.896287501f, 0.585385978f},
-std::array<float,2>{0.384745568f, 0.539683819f},
-std::array<float,2>{0.650792122f, 0.24670811f},
-std::array<float,2>{0.152436405f, 0.306033999f},
-std::array<float,2>{0.786767483f, 0.923495054f},
-std::array<float,2>{0.0205362812f, 0.771262467f},
-std::array<float,2>{0.982806206f, 0.411345601f},
-std::array<float,2>{0.326249927f, 0.0561631918f},
-std::array<float,2>{0.577811956f, 0.634252548f},
-std::array<float,2>{0.0548069105f, 0.655692756f},
-std::array<float,2>{0.959820032f, 0.0373302698f},
-std::array<float,2>{0.361566752f, 0.436033845f},
-std::array<float,2>{0.620484829f, 0.754478633f},
-std::array<float,2>{0.415857047f, 0.911988854f},
-std::array<float,2>{0.659885049f, 0.29387027f},
-std::array<float,2>{0.166910559f, 0.226122186f},
-std::array<float,2>{0.762597263f, 0.553614497f},
-std::array<float,2>{0.262343407f, 0.567544997f},
-std::array<float,2>{0.503724396f, 0.137092069f},
-std::array<float,2>{0.0915859044f, 0.326078206f},
-std::array<float,2>{0.918561876f, 0.961667299f},
-std::array<float,2>{0.205007568f, 0.849340439f},
-std::array<float,2>{0.844943047f, 0.473083079f},
-std::array<float,2>{0.464923322f, 0.124130391f},
-std::array<float,2>{0.692420721f, 0.731120884f},
-std::array<float,2>{0.125584036f, 0.527759135f},
-std::array<float,2>{0.806330562f, 0.214666873f},
-std::array<float,2>{0.405141026f, 0.272195309f},
-std::array<float,2>{0.626735806f, 0.884231269f},
-std::array<float,2>{0.330325007f, 0.804450333f},
-std::array<float,2>{0.58937782f, 0.385803431f},
-std::array<float,2>{0.00705225952f, 0.00457966095f},
-std::array<float,2>{0.990000188f, 0.677464366f},
-std::array<float,2>{0.488709986f, 0.706778169f},
-std::array<float,2>{0.726367295f, 0.0838412791f},
-std::array<float,2>{0.243526638f, 0.450160086f},
-std::array<float,2>{0.842313766f, 0.826713204f},
-std::array<float,2>{0.118180715f, 0.980418384f},
-std::array<float,2>{0.883837461f, 0.37339434f},
-std::array<float,2>{0.308290899f, 0.1637564f},
-std::array<float,2>{0.547786534f, 0.595299184f},
-std::array<float,2>{0.0447953939f, 0.572179437f},
-std::array<float,2>{0.94874388f, 0.12729077f},
-std::array<float,2>{0.344010234f, 0.320012629f},
-std::array<float,2>{0.60613358f, 0.955654263f},
-std::array<float,2>{0.422548294f, 0.852741182f},
-std::array<float,2>{0.684736013f, 0.482442081f},
-std::array<float,2>{0.173273414f, 0.115649417f},
-std::array<float,2>{0.776256144f, 0.726469815f},
-std::array<float,2>{0.278445482f, 0.642130017f},
-std::array<float,2>{0.516134262f, 0.0407235101f},
-std::array<float,2>{0.0678057894f, 0.422779441f},
-std::array<float,2>{0.934755325f, 0.762149692f},
-std::array<float,2>{0.194298029f, 0.917749763f},
-std::array<float,2>{0.862155914f, 0.283014119f},
-std::array<float,2>{0.443154395f, 0.233421788f},
-std::array<float,2>{0.713608921f, 0.561720252f},
-std::array<float,2>{0.150309533f, 0.717770934f},
-std::array<float,2>{0.783585966f, 0.0930744782f},
-std::array<float,2>{0.39010331f, 0.440801382f},
-std::array<float,2>{0.654261291f, 0.815657735f},
-std::array<float,2>{0.322266638f, 0.97038883f},
-std::array<float,2>{0.572906435f, 0.365413547f},
-std::array<float,2>{0.0156856254f, 0.168036178f},
-std::array<float,2>{0.978088021f, 0.607427835f},
-std::array<float,2>{0.46977064f, 0.516358852f},
-std::array<float,2>{0.737113237f, 0.206007481f},
-std::array<float,2>{0.233583733f, 0.277913183f},
-std::array<float,2>{0.826654792f, 0.876607239f},
-std::array<float,2>{0.104840912f, 0.806207955f},
-std::array<float,2>{0.891723275f, 0.37595138f},
-std::array<float,2>{0.287702769f, 0.011199926f},
-std::array<float,2>{0.546772957f, 0.682114899f},
-std::array<float,2>{0.086846903f, 0.664077103f},
-std::array<float,2>{0.917111039f, 0.0185886715f},
-std::array<float,2>{0.259979904f, 0.392321408f},
-std::array<float,2>{0.504492521f, 0.786552906f},
-std::array<float,2>{0.461982727f, 0.895426333f},
-std::array<float,2>{0.688002944f, 0.26192674f},
-std::array<float,2>{0.210332125f, 0.200835899f},
-std::array<float,2>{0.851492047f, 0.507014573f},
-std::array<float,2>{0.363991171f, 0.623967111f},
-std::array<float,2>{0.622550905f, 0.175171226f},
-std::array<float,2>{0.0608315282f, 0.358098f},
-std::array<float,2>{0.953707993f, 0.987442195f},
-std::array<float,2>{0.170332238f, 0.828398108f},
-std::array<float,2>{0.759500325f, 0.464681f},
-std::array<float,2>{0.418237507f, 0.0632272661f},
-std::array<float,2>{0.661491215f, 0.693578899f},
-std::array<float,2>{0.249648914f, 0.534145057f},
-std::array<float,2>{0.836128652f, 0.234954521f},
-std::array<float,2>{0.485388994f, 0.299077541f},
-std::array<float,2>{0.720651329f, 0.933684587f},
-std::array<float,2>{0.311525792f, 0.778125703f},
-std::array<float,2>{0.553927898f, 0.415734917f},
-std::array<float,2>{0.123030551f, 0.0484635122f},
-std::array<float,2>{0.89018327f, 0.627459824f},
-std::array<float,2>{0.401309073f, 0.741819739f},
-std::array<float,2>{0.630773544f, 0.094229728f},
-std::array<float,2>{0.12975952f, 0.489771634f},
-std::array<float,2>{0.811754704f, 0.87017864f},
-std::array<float,2>{0.000240791778f, 0.937505245f},
-std::array<float,2>{0.98793608f, 0.341798723f},
-std::array<float,2>{0.332443804f, 0.153005183f},
-std::array<float,2>{0.592679441f, 0.59138763f},
-std::array<float,2>{0.111651145f, 0.509471774f},
-std::array<float,2>{0.879316926f, 0.188696444f},
-std::array<float,2>{0.303796977f, 0.252515286f},
-std::array<float,2>{0.55627203f, 0.902668059f},
-std::array<float,2>{0.49532938f, 0.791623831f},
-std::array<float,2>{0.728443563f, 0.401494324f},
-std::array<float,2>{0.238285244f, 0.0277869217f},
-std::array<float,2>{0.829994678f, 0.66057229f},
-std::array<float,2>{0.337853581f, 0.69732815f},
-std::array<float,2>{0.579996228f, 0.071872972f},
-std::array<float,2>{0.0141025828f, 0.459752291f},
-std::array<float,2>{0.994898796f, 0.843709588f},
-std::array<float,2>{0.138780475f, 0.99661696f},
-std::array<float,2>{0.803682089f, 0.349402368f},
-std::array<float,2>{0.393436253f, 0.182182968f},
-std::array<float,2>{0.63681674f, 0.611163795f},
-std::array<float,2>{0.217161313f, 0.637779415f},
-std::array<float,2>{0.854642093f, 0.0591893233f},
-std::array<float,2>{0.457274258f, 0.409479022f},
-std::array<float,2>{0.696851313f, 0.766589403f},
-std::array<float,2>{0.254536808f, 0.927314878f},
-std::array<float,2>{0.51106149f, 0.310765445f},
-std::array<float,2>{0.0854469985f, 0.243414372f},
-std::array<float,2>{0.906613767f, 0.543938398f},
-std::array<float,2>{0.409410328f, 0.578639269f},
-std::array<float,2>{0.665334344f, 0.147762433f},
-std::array<float,2>{0.161552742f, 0.333859324f},
-std::array<float,2>{0.756269634f, 0.947105408f},
-std::array<float,2>{0.048071187f, 0.86717689f},
-std::array<float,2>{0.967428565f, 0.494767666f},
-std::array<float,2>{0.371303141f, 0.106935926f},
-std::array<float,2>{0.610882103f, 0.748575628f},
-std::array<float,2>{0.0279990286f, 0.726808071f},
-std::array<float,2>{0.970769167f, 0.117615394f},
-std::array<float,2>{0.316629976f, 0.470397055f},
-std::array<float,2>{0.566561937f, 0.844229579f},
-std::array<float,2>{0.38057369f, 0.967838407f},
-std::array<float,2>{0.64780128f, 0.320427716f},
-std::array<float,2>{0.147347882f, 0.136549369f},
-std::array<float,2>{0.792742968f, 0.565495372f},
-std::array<float,2>{0.293795019f, 0.546883047f},
-std::array<float,2>{0.536194265f, 0.219946146f},
-std::array<float,2>{0.101047464f, 0.291785896f},
-std::array<float,2>{0.900140107f, 0.907851577f},
-std::array<float,2>{0.222704858f, 0.750956357f},
-std::array<float,2>{0.820214033f, 0.42976135f},
-std::array<float,2>{0.479738414f, 0.0337651968f},
-std::array<float,2>{0.742348313f, 0.65121299f},
-std::array<float,2>{0.186576635f, 0.600079358f},
-std::array<float,2>{0.770989597f, 0.157423407f},
-std::array<float,2>{0.435175359f, 0.370339006f},
-std::array<float,2>{0.676598191f, 0.984356582f},
-std::array<float,2>{0.358616292f, 0.823701739f},
-std::array<float,2>{0.6001634f, 0.447481662f},
-std::array<float,2>{0.0375377014f, 0.0796738565f},
-std::array<float,2>{0.940276325f, 0.708485842f},
-std::array<float,2>{0.447233379f, 0.673619807f},
-std::array<float,2>{0.705927253f, 0.00359663437f},
-std::array<float,2>{0.19914487f, 0.387067497f},
-std::array<float,2>{0.870488644f, 0.798218727f},
-std::array<float,2>{0.0745546296f, 0.886799395f},
-std::array<float,2>{0.922810197f, 0.267263979f},
-std::array<float,2>{0.27334258f, 0.217134714f},
-std::array<float,2>{0.523557067f, 0.525025725f},
-std::array<float,2>{0.0462204143f, 0.561831117f},
-std::array<float,2>{0.945391059f, 0.233836651f},
-std::array<float,2>{0.346399963f, 0.282846123f},
-std::array<float,2>{0.608189344f, 0.917488217f},
-std::array<float,2>{0.424468189f, 0.761955917f},
-std::array<float,2>{0.686948121f, 0.422366142f},
-std::array<float,2>{0.175249457f, 0.0410001241f},
-std::array<float,2>{0.773819029f, 0.642352045f},
-std::array<float,2>{0.28090021f, 0.726212204f},
-std::array<float,2>{0.518860459f, 0.115450896f},
-std::array<float,2>{0.0692072511f, 0.482845128f},
-std::array<float,2>{0.936616838f, 0.852868438f},
-std::array<float,2>{0.191732481f, 0.955816329f},
-std::array<float,2>{0.859856248f, 0.32027027f},
-std::array<float,2>{0.444316387f, 0.127185538f},
-std::array<float,2>{0.712641776f, 0.571798444f},
-std::array<float,2>{0.151675627f, 0.681856632f},
-std::array<float,2>{0.782241642f, 0.0108602755f},
-std::array<float,2>{0.388653934f, 0.375716567f},
-std::array<float,2>{0.655045807f, 0.806451917f},
-std::array<float,2>{0.320748359f, 0.876868784f},
-std::array<float,2>{0.571247518f, 0.278105378f},
-std::array<float,2>{0.0188873913f, 0.205800325f},
-std::array<float,2>{0.979222298f, 0.51635015f},
-std::array<float,2>{0.472361356f, 0.607757449f},
-std::array<float,2>{0.736211896f, 0.168449506f},
-std::array<float,2>{0.231668428f, 0.365551889f},
-std::array<float,2>{0.826039433f, 0.970547199f},
-std::array<float,2>{0.103108004f, 0.815756679f},
-std::array<float,2>{0.892717302f, 0.440469444f},
-std::array<float,2>{0.286134273f, 0.0929076001f},
-std::array<float,2>{0.544211984f, 0.717339456f},
-std::array<float,2>{0.0889109969f, 0.693687141f},
-std::array<float,2>{0.915125072f, 0.0632612407f},
-std::array<float,2>{0.25928998f, 0.464419186f},
-std::array<float,2>{0.506603837f, 0.828186989f},
-std::array<float,2>{0.463218272f, 0.987755001f},
-std::array<float,2>{0.690207124f, 0.358312815f},
-std::array<float,2>{0.208682328f, 0.175042167f},
-std::array<float,2>{0.849061608f, 0.623759389f},
-std::array<float,2>{0.366440326f, 0.507136881f},
-std::array<float,2>{0.624904871f, 0.201031461f},
-std::array<float,2>{0.059296675f, 0.261997521f},
-std::array<float,2>{0.955806017f, 0.895066261f},
-std::array<float,2>{0.168067187f, 0.78625071f},
-std::array<float,2>{0.760562181f, 0.392404646f},
-std::array<float,2>{0.421740979f, 0.0189264584f},
-std::array<float,2>{0.662234306f, 0.664409101f},
-std::array<float,2>{0.247290969f, 0.591792941f},
-std::array<float,2>{0.838503778f, 0.15310058f},
-std::array<float,2>{0.486403704f, 0.342042863f},
-std::array<float,2>{0.722231805f, 0.937882602f},
-std::array<float,2>{0.309064299f, 0.870506048f},
-std::array<float,2>{0.551489294f, 0.489995599f},
-std::array<float,2>{0.124190636f, 0.0939220861f},
-std::array<float,2>{0.887768626f, 0.742124736f},
-std::array<float,2>{0.399949282f, 0.627711356f},
-std::array<float,2>{0.632524133f, 0.0486847349f},
-std::array<float,2>{0.132017329f, 0.415883273f},
-std::array<float,2>{0.810408115f, 0.777919948f},
-std::array<float,2>{0.00352642522f, 0.933977842f},
-std::array<float,2>{0.985219061f, 0.298886061f},
-std::array<float,2>{0.335575551f, 0.235140383f},
-std::array<float,2>{0.590152681f, 0.533751786f},
-std::array<float,2>{0.110596664f, 0.610857606f},
-std::array<float,2>{0.881527424f, 0.18256548f},
-std::array<float,2>{0.301625431f, 0.349338681f},
-std::array<float,2>{0.558018982f, 0.996942937f},
-std::array<float,2>{0.493731529f, 0.84328109f},
-std::array<float,2>{0.729690313f, 0.459541589f},
-std::array<float,2>{0.241046637f, 0.072024256f},
-std::array<float,2>{0.831225097f, 0.697666109f},
-std::array<float,2>{0.338533491f, 0.660276711f},
-std::array<float,2>{0.58196485f, 0.0274351649f},
-std::array<float,2>{0.0118145095f, 0.401697099f},
-std::array<float,2>{0.992970407f, 0.791972935f},
-std::array<float,2>{0.137514979f, 0.90252161f},
-std::array<float,2>{0.802491426f, 0.252805531f},
-std::array<float,2>{0.391631424f, 0.188923195f},
-std::array<float,2>{0.640166044f, 0.509760737f},
-std::array<float,2>{0.215067327f, 0.749017f},
-std::array<float,2>{0.852413118f, 0.107341968f},
-std::array<float,2>{0.459056377f, 0.495109469f},
-std::array<float,2>{0.698395908f, 0.866793215f},
-std::array<float,2>{0.256396413f, 0.946821094f},
-std::array<float,2>{0.509709716f, 0.333636373f},
-std::array<float,2>{0.0838622525f, 0.14769268f},
-std::array<float,2>{0.909545362f, 0.578993857f},
-std::array<float,2>{0.408175737f, 0.543569922f},
-std::array<float,2>{0.666635513f, 0.243240714f},
-std::array<float,2>{0.162890762f, 0.311023951f},
-std::array<float,2>{0.75502193f, 0.927637935f},
-std::array<float,2>{0.0500641428f, 0.766227841f},
-std::array<float,2>{0.965094864f, 0.409346074f},
-std::array<float,2>{0.374749333f, 0.0595368892f},
-std::array<float,2>{0.611345232f, 0.638059616f},
-std::array<float,2>{0.0299521163f, 0.650944233f},
-std::array<float,2>{0.969777644f, 0.034163028f},
-std::array<float,2>{0.320111752f, 0.430168301f},
-std::array<float,2>{0.569957018f, 0.750491202f},
-std::array<float,2>{0.381726563f, 0.90814662f},
-std::array<float,2>{0.646223605f, 0.291745037f},
-std::array<float,2>{0.144989431f, 0.220071077f},
-std::array<float,2>{0.79079932f, 0.547220409f},
-std::array<float,2>{0.296718389f, 0.565751791f},
-std::array<float,2>{0.538185239f, 0.136317134f},
-std::array<float,2>{0.097845979f, 0.320625395f},
-std::array<float,2>{0.900910556f, 0.968208551f},
-std::array<float,2>{0.225990847f, 0.843972087f},
-std::array<float,2>{0.817656696f, 0.470603764f},
-std::array<float,2>{0.476931423f, 0.117251873f},
-std::array<float,2>{0.745701253f, 0.726578414f},
-std::array<float,2>{0.185269177f, 0.525284111f},
-std::array<float,2>{0.772279561f, 0.216891572f},
-std::array<float,2>{0.435744315f, 0.267458797f},
-std::array<float,2>{0.678193092f, 0.887151361f},
-std::array<float,2>{0.357132107f, 0.797982693f},
-std::array<float,2>{0.598246872f, 0.386838943f},
-std::array<float,2>{0.03529476f, 0.00381404976f},
-std::array<float,2>{0.938955963f, 0.673443496f},
-std::array<float,2>{0.448138207f, 0.70811528f},
-std::array<float,2>{0.70423311f, 0.079987675f},
-std::array<float,2>{0.195490494f, 0.447670519f},
-std::array<float,2>{0.868316233f, 0.823269606f},
-std::array<float,2>{0.0776507109f, 0.983991146f},
-std::array<float,2>{0.924702168f, 0.370544165f},
-std::array<float,2>{0.269579172f, 0.157610267f},
-std::array<float,2>{0.525528193f, 0.59970659f},
-std::array<float,2>{0.0090081431f, 0.576928735f},
-std::array<float,2>{0.99747771f, 0.131255254f},
-std::array<float,2>{0.342431039f, 0.315971941f},
-std::array<float,2>{0.582360327f, 0.958812892f},
-std::array<float,2>{0.396538138f, 0.858876169f},
-std::array<float,2>{0.635394216f, 0.480189532f},
-std::array<float,2>{0.134060442f, 0.11302565f},
-std::array<float,2>{0.799430251f, 0.722119808f},
-std::array<float,2>{0.298161983f, 0.644800246f},
-std::array<float,2>{0.559791028f, 0.0454832651f},
-std::array<float,2>{0.115382068f, 0.427178979f},
-std::array<float,2>{0.875715375f, 0.761401176f},
-std::array<float,2>{0.23768799f, 0.919288218f},
-std::array<float,2>{0.833703995f, 0.285502434f},
-std::array<float,2>{0.496545792f, 0.227451488f},
-std::array<float,2>{0.730908871f, 0.55477798f},
-std::array<float,2>{0.158966795f, 0.71243912f},
-std::array<float,2>{0.75132221f, 0.0891020522f},
-std::array<float,2>{0.410526693f, 0.443093926f},
-std::array<float,2>{0.669065237f, 0.81678611f},
-std::array<float,2>{0.368807733f, 0.976303458f},
-std::array<float,2>{0.616483629f, 0.35994187f},
-std::array<float,2>{0.0524575785f, 0.167547807f},
-std::array<float,2>{0.962814152f, 0.603179395f},
-std::array<float,2>{0.45691362f, 0.520144463f},
-std::array<float,2>{0.70152986f, 0.208320662f},
-std::array<float,2>{0.214513153f, 0.274751961f},
-std::array<float,2>{0.856322765f, 0.879246533f},
-std::array<float,2>{0.0787525252f, 0.811585486f},
-std::array<float,2>{0.91218859f, 0.379861146f},
-std::array<float,2>{0.252600074f, 0.0127004767f},
-std::array<float,2>{0.515441477f, 0.684523344f},
-std::array<float,2>{0.0944761038f, 0.668905675f},
-std::array<float,2>{0.902879536f, 0.0205561426f},
-std::array<float,2>{0.289692014f, 0.39455843f},
-std::array<float,2>{0.531902254f, 0.782116175f},
-std::array<float,2>{0.481792778f, 0.891108155f},
-std::array<float,2>{0.749884188f, 0.261380792f},
-std::array<float,2>{0.220290169f, 0.19845809f},
-std::array<float,2>{0.812924206f, 0.502580106f},
-std::array<float,2>{0.314650208f, 0.620559633f},
-std::array<float,2>{0.56623131f, 0.177484185f},
-std::array<float,2>{0.0247258283f, 0.353010178f},
-std::array<float,2>{0.976479471f, 0.991093159f},
-std::array<float,2>{0.140747309f, 0.833818674f},
-std::array<float,2>{0.796513677f, 0.46665296f},
-std::array<float,2>{0.376753241f, 0.0687522888f},
-std::array<float,2>{0.642185569f, 0.688662589f},
-std::array<float,2>{0.200776756f, 0.536621392f},
-std::array<float,2>{0.872689188f, 0.241356522f},
-std::array<float,2>{0.452022463f, 0.304471105f},
-std::array<float,2>{0.708990335f, 0.931742549f},
-std::array<float,2>{0.267367512f, 0.774307668f},
-std::array<float,2>{0.528924406f, 0.419611454f},
-std::array<float,2>{0.0736312941f, 0.0513793416f},
-std::array<float,2>{0.927393079f, 0.632626414f},
-std::array<float,2>{0.432447344f, 0.737002492f},
-std::array<float,2>{0.674286306f, 0.100250736f},
-std::array<float,2>{0.179844037f, 0.486874312f},
-std::array<float,2>{0.7681517f, 0.874713898f},
-std::array<float,2>{0.0315966494f, 0.943135977f},
-std::array<float,2>{0.945152223f, 0.338013589f},
-std::array<float,2>{0.353449702f, 0.150293782f},
-std::array<float,2>{0.595304012f, 0.588626623f},
-std::array<float,2>{0.0635494068f, 0.512722731f},
-std::array<float,2>{0.932220936f, 0.192266002f},
-std::array<float,2>{0.273600668f, 0.254763246f},
-std::array<float,2>{0.522398651f, 0.898729801f},
-std::array<float,2>{0.441315919f, 0.79535675f},
-std::array<float,2>{0.714939475f, 0.40554601f},
-std::array<float,2>{0.190082416f, 0.0242712684f},
-std::array<float,2>{0.864186943f, 0.658981264f},
-std::array<float,2>{0.349182725f, 0.70071429f},
-std::array<float,2>{0.603416502f, 0.0772434175f},
-std::array<float,2>{0.0402184352f, 0.453465372f},
-std::array<float,2>{0.951877415f, 0.836196303f},
-std::array<float,2>{0.178929389f, 0.995425582f},
-std::array<float,2>{0.780459821f, 0.343958437f},
-std::array<float,2>{0.429047942f, 0.186497658f},
-std::array<float,2>{0.680104971f, 0.614880681f},
-std::array<float,2>{0.2290667f, 0.633789301f},
-std::array<float,2>{0.822442889f, 0.0565951504f},
-std::array<float,2>{0.474395931f, 0.411516875f},
-std::array<float,2>{0.740457892f, 0.771006823f},
-std::array<float,2>{0.283092737f, 0.923780143f},
-std::array<float,2>{0.541834176f, 0.30568555f},
-std::array<float,2>{0.107527308f, 0.246848673f},
-std::array<float,2>{0.898105919f, 0.539946735f},
-std::array<float,2>{0.385755241f, 0.584992468f},
-std::array<float,2>{0.650016785f, 0.140840471f},
-std::array<float,2>{0.155260637f, 0.33027193f},
-std::array<float,2>{0.788638234f, 0.951017857f},
-std::array<float,2>{0.0232883096f, 0.860058725f},
-std::array<float,2>{0.981052995f, 0.497011036f},
-std::array<float,2>{0.324239641f, 0.101878278f},
-std::array<float,2>{0.575412452f, 0.743990719f},
-std::array<float,2>{0.0576308072f, 0.731436193f},
-std::array<float,2>{0.957644403f, 0.124342673f},
-std::array<float,2>{0.360095084f, 0.472798049f},
-std::array<float,2>{0.617655754f, 0.849557102f},
-std::array<float,2>{0.416106105f, 0.961781979f},
-std::array<float,2>{0.657430887f, 0.325695276f},
-std::array<float,2>{0.164821103f, 0.136746049f},
-std::array<float,2>{0.764229715f, 0.5678128f},
-std::array<float,2>{0.264600396f, 0.553359687f},
-std::array<float,2>{0.500837564f, 0.226504311f},
-std::array<float,2>{0.093448393f, 0.293508619f},
-std::array<float,2>{0.921521187f, 0.91164273f},
-std::array<float,2>{0.205462873f, 0.754730284f},
-std::array<float,2>{0.847190201f, 0.435617328f},
-std::array<float,2>{0.468246698f, 0.0373902209f},
-std::array<float,2>{0.694071829f, 0.655290842f},
-std::array<float,2>{0.127521351f, 0.595463634f},
-std::array<float,2>{0.807035267f, 0.163887173f},
-std::array<float,2>{0.404255271f, 0.373191923f},
-std::array<float,2>{0.628734648f, 0.980214715f},
-std::array<float,2>{0.329243213f, 0.827075124f},
-std::array<float,2>{0.587510407f, 0.449821681f},
-std::array<float,2>{0.00573771447f, 0.0835782513f},
-std::array<float,2>{0.991291523f, 0.706801474f},
-std::array<float,2>{0.490875363f, 0.677568614f},
-std::array<float,2>{0.72387439f, 0.00476915017f},
-std::array<float,2>{0.245057404f, 0.38606897f},
-std::array<float,2>{0.841254711f, 0.804255247f},
-std::array<float,2>{0.120371021f, 0.883898735f},
-std::array<float,2>{0.885209501f, 0.272296458f},
-std::array<float,2>{0.306472868f, 0.214415297f},
-std::array<float,2>{0.550470769f, 0.527468085f},
-std::array<float,2>{0.0173151437f, 0.519087732f},
-std::array<float,2>{0.976929605f, 0.204369262f},
-std::array<float,2>{0.323534131f, 0.280461699f},
-std::array<float,2>{0.573413789f, 0.878851712f},
-std::array<float,2>{0.389531046f, 0.808224082f},
-std::array<float,2>{0.652639627f, 0.378541499f},
-std::array<float,2>{0.148791879f, 0.00839723833f},
-std::array<float,2>{0.784300566f, 0.681340516f},
-std::array<float,2>{0.288292408f, 0.716010094f},
-std::array<float,2>{0.545393467f, 0.0908076093f},
-std::array<float,2>{0.103800997f, 0.437567979f},
-std::array<float,2>{0.891243041f, 0.812517941f},
-std::array<float,2>{0.232543111f, 0.971276343f},
-std::array<float,2>{0.827578664f, 0.364404082f},
-std::array<float,2>{0.469553143f, 0.171403989f},
-std::array<float,2>{0.737773538f, 0.606386662f},
-std::array<float,2>{0.172294647f, 0.643313527f},
-std::array<float,2>{0.77690959f, 0.0419437885f},
-std::array<float,2>{0.422854483f, 0.424301833f},
-std::array<float,2>{0.683832109f, 0.764579773f},
-std::array<float,2>{0.34512639f, 0.914646447f},
-std::array<float,2>{0.606848538f, 0.284501314f},
-std::array<float,2>{0.0435454547f, 0.232405245f},
-std::array<float,2>{0.947292984f, 0.558784664f},
-std::array<float,2>{0.441449106f, 0.573691785f},
-std::array<float,2>{0.714689076f, 0.125467569f},
-std::array<float,2>{0.195110306f, 0.318147451f},
-std::array<float,2>{0.863233984f, 0.954309762f},
-std::array<float,2>{0.067373842f, 0.853917301f},
-std::array<float,2>{0.934228837f, 0.481616169f},
-std::array<float,2>{0.277589023f, 0.114609115f},
-std::array<float,2>{0.517536104f, 0.723300636f},
-std::array<float,2>{0.121574529f, 0.739139438f},
-std::array<float,2>{0.889536917f, 0.0975820795f},
-std::array<float,2>{0.310866117f, 0.491440386f},
-std::array<float,2>{0.55284524f, 0.867806494f},
-std::array<float,2>{0.484421164f, 0.939612448f},
-std::array<float,2>{0.719541967f, 0.341729373f},
-std::array<float,2>{0.248422027f, 0.155112177f},
-std::array<float,2>{0.837293088f, 0.593364835f},
-std::array<float,2>{0.333724797f, 0.532384634f},
-std::array<float,2>{0.593437552f, 0.237313464f},
-std::array<float,2>{0.00154979038f, 0.297057718f},
-std::array<float,2>{0.987008274f, 0.935641468f},
-std::array<float,2>{0.130537465f, 0.779888332f},
-std::array<float,2>{0.811478019f, 0.417898983f},
-std::array<float,2>{0.402228504f, 0.0496584959f},
-std::array<float,2>{0.629720271f, 0.625678658f},
-std::array<float,2>{0.209880486f, 0.622092247f},
-std::array<float,2>{0.849695265f, 0.172808677f},
-std::array<float,2>{0.460958034f, 0.356144577f},
-std::array<float,2>{0.688896418f, 0.984990895f},
-std::array<float,2>{0.261346728f, 0.830718458f},
-std::array<float,2>{0.504951954f, 0.46145013f},
-std::array<float,2>{0.0876080468f, 0.0658540949f},
-std::array<float,2>{0.91676563f, 0.691538393f},
-std::array<float,2>{0.419831961f, 0.667814374f},
-std::array<float,2>{0.660808742f, 0.0171745289f},
-std::array<float,2>{0.170958012f, 0.393577009f},
-std::array<float,2>{0.758690774f, 0.788943648f},
-std::array<float,2>{0.0624183118f, 0.898293018f},
-std::array<float,2>{0.955057323f, 0.264180034f},
-std::array<float,2>{0.365222752f, 0.201921627f},
-std::array<float,2>{0.621785164f, 0.504903615f},
-std::array<float,2>{0.0841434151f, 0.581950188f},
-std::array<float,2>{0.907691121f, 0.144727647f},
-std::array<float,2>{0.255193591f, 0.335345954f},
-std::array<float,2>{0.509902716f, 0.948321939f},
-std::array<float,2>{0.458144128f, 0.863332748f},
-std::array<float,2>{0.695588887f, 0.492942572f},
-std::array<float,2>{0.218049869f, 0.107976407f},
-std::array<float,2>{0.854488492f, 0.747414947f},
-std::array<float,2>{0.372265786f, 0.639757991f},
-std::array<float,2>{0.60990721f, 0.0617839992f},
-std::array<float,2>{0.0475437157f, 0.40727669f},
-std::array<float,2>{0.967776895f, 0.769390881f},
-std::array<float,2>{0.160169959f, 0.927987874f},
-std::array<float,2>{0.757310033f, 0.310136259f},
-std::array<float,2>{0.408220321f, 0.246006668f},
-std::array<float,2>{0.664944828f, 0.545121551f},
-std::array<float,2>{0.23976472f, 0.697075427f},
-std::array<float,2>{0.828807831f, 0.074088484f},
-std::array<float,2>{0.494954377f, 0.457915097f},
-std::array<float,2>{0.727125227f, 0.841099739f},
-std::array<float,2>{0.303618938f, 0.999028921f},
-std::array<float,2>{0.555434048f, 0.351093113f},
-std::array<float,2>{0.112682365f, 0.179819897f},
-std::array<float,2>{0.879926324f, 0.613229394f},
-std::array<float,2>{0.394404083f, 0.510490239f},
-std::array<float,2>{0.638202846f, 0.190369353f},
-std::array<float,2>{0.140504539f, 0.250831038f},
-std::array<float,2>{0.803997815f, 0.904972851f},
-std::array<float,2>{0.0150451846f, 0.790777504f},
-std::array<float,2>{0.995509148f, 0.399234891f},
-std::array<float,2>{0.336467445f, 0.0298156105f},
-std::array<float,2>{0.578552246f, 0.662575901f},
-std::array<float,2>{0.0385080688f, 0.674923897f},
-std::array<float,2>{0.941146433f, 0.000992786838f},
-std::array<float,2>{0.3580845f, 0.389249355f},
-std::array<float,2>{0.601057053f, 0.80032742f},
-std::array<float,2>{0.434446722f, 0.889539301f},
-std::array<float,2>{0.676770031f, 0.26788789f},
-std::array<float,2>{0.186165839f, 0.216731474f},
-std::array<float,2>{0.770394266f, 0.525516272f},
-std::array<float,2>{0.272041917f, 0.598219693f},
-std::array<float,2>{0.52457422f, 0.158577755f},
-std::array<float,2>{0.0757786036f, 0.368189216f},
-std::array<float,2>{0.923094988f, 0.981508791f},
-std::array<float,2>{0.197533742f, 0.821445942f},
-std::array<float,2>{0.870113254f, 0.446543753f},
-std::array<float,2>{0.446139932f, 0.0808001161f},
-std::array<float,2>{0.706915379f, 0.709506333f},
-std::array<float,2>{0.148369804f, 0.550059259f},
-std::array<float,2>{0.791755021f, 0.221047163f},
-std::array<float,2>{0.37909773f, 0.289833099f},
-std::array<float,2>{0.646906674f, 0.909509063f},
-std::array<float,2>{0.318261385f, 0.752382815f},
-std::array<float,2>{0.568309367f, 0.432089448f},
-std::array<float,2>{0.0287108291f, 0.0328396223f},
-std::array<float,2>{0.972093642f, 0.649528921f},
-std::array<float,2>{0.478727847f, 0.729946494f},
-std::array<float,2>{0.744134188f, 0.120377965f},
-std::array<float,2>{0.22363919f, 0.471997976f},
-std::array<float,2>{0.819300771f, 0.846154094f},
-std::array<float,2>{0.0997057408f, 0.965674579f},
-std::array<float,2>{0.899356842f, 0.323105037f},
-std::array<float,2>{0.294503599f, 0.133133635f},
-std::array<float,2>{0.535975516f, 0.564027488f},
-std::array<float,2>{0.0544739738f, 0.605404735f},
-std::array<float,2>{0.964204669f, 0.16600129f},
-std::array<float,2>{0.37068072f, 0.362106919f},
-std::array<float,2>{0.614733934f, 0.97290796f},
-std::array<float,2>{0.412952632f, 0.818734944f},
-std::array<float,2>{0.671049356f, 0.444423705f},
-std::array<float,2>{0.156440407f, 0.0867644995f},
-std::array<float,2>{0.752858102f, 0.714352429f},
-std::array<float,2>{0.25043419f, 0.687051415f},
-std::array<float,2>{0.51265496f, 0.0153050693f},
-std::array<float,2>{0.0805019438f, 0.381878555f},
-std::array<float,2>{0.911893666f, 0.810312629f},
-std::array<float,2>{0.212461427f, 0.882373691f},
-std::array<float,2>{0.858141184f, 0.275987387f},
-std::array<float,2>{0.454284608f, 0.209347963f},
-std::array<float,2>{0.699351966f, 0.52197355f},
-std::array<float,2>{0.134826839f, 0.720232606f},
-std::array<float,2>{0.797152638f, 0.110956766f},
-std::array<float,2>{0.395443827f, 0.476672381f},
-std::array<float,2>{0.633857787f, 0.85719502f},
-std::array<float,2>{0.341564119f, 0.959920108f},
-std::array<float,2>{0.584754169f, 0.312943608f},
-std::array<float,2>{0.0104807336f, 0.12948066f},
-std::array<float,2>{0.998786509f, 0.574948907f},
-std::array<float,2>{0.498911053f, 0.558465183f},
-std::array<float,2>{0.734177291f, 0.228600487f},
-std::array<float,2>{0.23530601f, 0.289017081f},
-std::array<float,2>{0.834986746f, 0.92153132f},
-std::array<float,2>{0.113640577f, 0.759494603f},
-std::array<float,2>{0.877176821f, 0.42874977f},
-std::array<float,2>{0.299635649f, 0.0442751721f},
-std::array<float,2>{0.56241715f, 0.647637308f},
-std::array<float,2>{0.0709932297f, 0.630738258f},
-std::array<float,2>{0.92963928f, 0.0532237701f},
-std::array<float,2>{0.268018574f, 0.420265317f},
-std::array<float,2>{0.531134605f, 0.776454806f},
-std::array<float,2>{0.450081885f, 0.929708064f},
-std::array<float,2>{0.708257973f, 0.300810367f},
-std::array<float,2>{0.201345071f, 0.238818377f},
-std::array<float,2>{0.874487221f, 0.53744328f},
-std::array<float,2>{0.355271041f, 0.587628424f},
-std::array<float,2>{0.596127987f, 0.150926724f},
-std::array<float,2>{0.034829542f, 0.337539315f},
-std::array<float,2>{0.94169873f, 0.945234478f},
-std::array<float,2>{0.183199853f, 0.873032987f},
-std::array<float,2>{0.76744318f, 0.486161798f},
-std::array<float,2>{0.431309879f, 0.0989816487f},
-std::array<float,2>{0.673091531f, 0.734900296f},
-std::array<float,2>{0.22111477f, 0.501316011f},
-std::array<float,2>{0.815585613f, 0.195639268f},
-std::array<float,2>{0.483632535f, 0.259235114f},
-std::array<float,2>{0.747600615f, 0.894408345f},
-std::array<float,2>{0.291889429f, 0.784348786f},
-std::array<float,2>{0.534167528f, 0.396893799f},
-std::array<float,2>{0.0965448841f, 0.0232511573f},
-std::array<float,2>{0.904650986f, 0.670656681f},
-std::array<float,2>{0.376988828f, 0.690503597f},
-std::array<float,2>{0.644400418f, 0.0667765215f},
-std::array<float,2>{0.142622545f, 0.467658281f},
-std::array<float,2>{0.79335916f, 0.835383117f},
-std::array<float,2>{0.0256665964f, 0.988435328f},
-std::array<float,2>{0.974508226f, 0.354910702f},
-std::array<float,2>{0.314287335f, 0.178843975f},
-std::array<float,2>{0.563028216f, 0.617257416f},
-std::array<float,2>{0.105777532f, 0.541630924f},
-std::array<float,2>{0.895114839f, 0.248397574f},
-std::array<float,2>{0.283894718f, 0.306718647f},
-std::array<float,2>{0.539833546f, 0.924631417f},
-std::array<float,2>{0.474874765f, 0.771665633f},
-std::array<float,2>{0.739429593f, 0.41211924f},
-std::array<float,2>{0.227383956f, 0.0577398054f},
-std::array<float,2>{0.821059883f, 0.635779202f},
-std::array<float,2>{0.327766061f, 0.744813323f},
-std::array<float,2>{0.576526046f, 0.104754798f},
-std::array<float,2>{0.0196680855f, 0.498826474f},
-std::array<float,2>{0.984178424f, 0.861917794f},
-std::array<float,2>{0.154081017f, 0.95205617f},
-std::array<float,2>{0.785483778f, 0.3295151f},
-std::array<float,2>{0.383134037f, 0.142785043f},
-std::array<float,2>{0.651733935f, 0.583884537f},
-std::array<float,2>{0.188964054f, 0.656568944f},
-std::array<float,2>{0.866649508f, 0.02689467f},
-std::array<float,2>{0.438605517f, 0.403006941f},
-std::array<float,2>{0.71812731f, 0.794599831f},
-std::array<float,2>{0.276164353f, 0.901785612f},
-std::array<float,2>{0.520361185f, 0.256628633f},
-std::array<float,2>{0.0651530474f, 0.194453761f},
-std::array<float,2>{0.930295527f, 0.514771044f},
-std::array<float,2>{0.426157922f, 0.615371943f},
-std::array<float,2>{0.681757569f, 0.184895039f},
-std::array<float,2>{0.177300453f, 0.346344918f},
-std::array<float,2>{0.779176056f, 0.992718518f},
-std::array<float,2>{0.0414385162f, 0.839799523f},
-std::array<float,2>{0.95115757f, 0.455542952f},
-std::array<float,2>{0.350356072f, 0.0755155832f},
-std::array<float,2>{0.604565561f, 0.70206207f},
-std::array<float,2>{0.00637211185f, 0.704364479f},
-std::array<float,2>{0.988719046f, 0.0858241469f},
-std::array<float,2>{0.331891567f, 0.453097463f},
-std::array<float,2>{0.588687241f, 0.824827254f},
-std::array<float,2>{0.406155437f, 0.977488339f},
-std::array<float,2>{0.6254403f, 0.372767776f},
-std::array<float,2>{0.126840934f, 0.161634967f},
-std::array<float,2>{0.804792762f, 0.59619087f},
-std::array<float,2>{0.306790888f, 0.531234503f},
-std::array<float,2>{0.548201919f, 0.211634442f},
-std::array<float,2>{0.117564142f, 0.271076053f},
-std::array<float,2>{0.883621037f, 0.886159301f},
-std::array<float,2>{0.242988884f, 0.801582932f},
-std::array<float,2>{0.843301713f, 0.382821769f},
-std::array<float,2>{0.489943177f, 0.00610466348f},
-std::array<float,2>{0.724812746f, 0.678190529f},
-std::array<float,2>{0.16764462f, 0.568643093f},
-std::array<float,2>{0.762858629f, 0.13974832f},
-std::array<float,2>{0.414131075f, 0.326388478f},
-std::array<float,2>{0.658867717f, 0.962965012f},
-std::array<float,2>{0.362818182f, 0.850203097f},
-std::array<float,2>{0.619178593f, 0.475254208f},
-std::array<float,2>{0.0560762584f, 0.121467032f},
-std::array<float,2>{0.960606277f, 0.733653247f},
-std::array<float,2>{0.466767401f, 0.653472245f},
-std::array<float,2>{0.691716075f, 0.0364323258f},
-std::array<float,2>{0.204032272f, 0.434187829f},
-std::array<float,2>{0.844192445f, 0.756306529f},
-std::array<float,2>{0.0899204165f, 0.913657606f},
-std::array<float,2>{0.919498026f, 0.296436548f},
-std::array<float,2>{0.262882382f, 0.223475307f},
-std::array<float,2>{0.502656102f, 0.552467704f},
-std::array<float,2>{0.0604191795f, 0.504149854f},
-std::array<float,2>{0.956954479f, 0.203091398f},
-std::array<float,2>{0.365271509f, 0.264663905f},
-std::array<float,2>{0.623913765f, 0.896997869f},
-std::array<float,2>{0.420262963f, 0.787977278f},
-std::array<float,2>{0.663528144f, 0.393149704f},
-std::array<float,2>{0.169420481f, 0.0165809486f},
-std::array<float,2>{0.761715412f, 0.666545093f},
-std::array<float,2>{0.258507699f, 0.692919731f},
-std::array<float,2>{0.507707179f, 0.0651752055f},
-std::array<float,2>{0.0882765502f, 0.462669641f},
-std::array<float,2>{0.914363623f, 0.831066668f},
-std::array<float,2>{0.207076252f, 0.985882699f},
-std::array<float,2>{0.848630726f, 0.356685549f},
-std::array<float,2>{0.464346558f, 0.173787713f},
-std::array<float,2>{0.691387832f, 0.621850729f},
-std::array<float,2>{0.131196693f, 0.626543224f},
-std::array<float,2>{0.809080124f, 0.0505546667f},
-std::array<float,2>{0.39905867f, 0.416795492f},
-std::array<float,2>{0.631240785f, 0.780946732f},
-std::array<float,2>{0.334432185f, 0.937322855f},
-std::array<float,2>{0.59085393f, 0.298755616f},
-std::array<float,2>{0.00202167244f, 0.237232998f},
-std::array<float,2>{0.986001194f, 0.531261623f},
-std::array<float,2>{0.488150805f, 0.592344284f},
-std::array<float,2>{0.720886827f, 0.155687883f},
-std::array<float,2>{0.246369824f, 0.340762794f},
-std::array<float,2>{0.839385748f, 0.940744698f},
-std::array<float,2>{0.123305209f, 0.868953884f},
-std::array<float,2>{0.887081623f, 0.490400821f},
-std::array<float,2>{0.309939772f, 0.0966035128f},
-std::array<float,2>{0.552268922f, 0.739502788f},
-std::array<float,2>{0.0694309324f, 0.724247932f},
-std::array<float,2>{0.935595274f, 0.113920555f},
-std::array<float,2>{0.27930522f, 0.48086521f},
-std::array<float,2>{0.518047571f, 0.854999721f},
-std::array<float,2>{0.444357604f, 0.953570604f},
-std::array<float,2>{0.71173054f, 0.316710919f},
-std::array<float,2>{0.192417935f, 0.12692757f},
-std::array<float,2>{0.860946178f, 0.572666228f},
-std::array<float,2>{0.347052068f, 0.560400426f},
-std::array<float,2>{0.608700931f, 0.231240258f},
-std::array<float,2>{0.0456501581f, 0.283314794f},
-std::array<float,2>{0.947027147f, 0.915358484f},
-std::array<float,2>{0.174288943f, 0.764989972f},
-std::array<float,2>{0.774754703f, 0.425142109f},
-std::array<float,2>{0.425146371f, 0.0429227687f},
-std::array<float,2>{0.686266303f, 0.643621683f},
-std::array<float,2>{0.230932638f, 0.606618345f},
-std::array<float,2>{0.824723899f, 0.170371026f},
-std::array<float,2>{0.471145242f, 0.363659918f},
-std::array<float,2>{0.734812975f, 0.972371578f},
-std::array<float,2>{0.285175323f, 0.814065695f},
-std::array<float,2>{0.543893218f, 0.439232409f},
-std::array<float,2>{0.1022809f, 0.0912860259f},
-std::array<float,2>{0.893772542f, 0.715479791f},
-std::array<float,2>{0.387274176f, 0.680232704f},
-std::array<float,2>{0.655613065f, 0.00909390766f},
-std::array<float,2>{0.150824487f, 0.377923846f},
-std::array<float,2>{0.781877041f, 0.806738734f},
-std::array<float,2>{0.0176941678f, 0.876972735f},
-std::array<float,2>{0.98030889f, 0.280038744f},
-std::array<float,2>{0.322090089f, 0.203465238f},
-std::array<float,2>{0.572074711f, 0.518193305f},
-std::array<float,2>{0.0991073027f, 0.563313007f},
-std::array<float,2>{0.901858449f, 0.13422963f},
-std::array<float,2>{0.295434207f, 0.324141413f},
-std::array<float,2>{0.537306488f, 0.965883315f},
-std::array<float,2>{0.477908969f, 0.847022593f},
-std::array<float,2>{0.744148612f, 0.47086516f},
-std::array<float,2>{0.224872142f, 0.120094664f},
-std::array<float,2>{0.817193747f, 0.72919488f},
-std::array<float,2>{0.319145143f, 0.64868331f},
-std::array<float,2>{0.568714023f, 0.031277936f},
-std::array<float,2>{0.0310216937f, 0.433512479f},
-std::array<float,2>{0.969493508f, 0.753289878f},
-std::array<float,2>{0.146225199f, 0.908283114f},
-std::array<float,2>{0.789155662f, 0.290774822f},
-std::array<float,2>{0.38279143f, 0.222194597f},
-std::array<float,2>{0.645001352f, 0.5495224f},
-std::array<float,2>{0.196321175f, 0.710523605f},
-std::array<float,2>{0.867280722f, 0.0818860084f},
-std::array<float,2>{0.448591918f, 0.446104437f},
-std::array<float,2>{0.703571439f, 0.821197987f},
-std::array<float,2>{0.271453589f, 0.981014192f},
-std::array<float,2>{0.52728796f, 0.36735478f},
-std::array<float,2>{0.076632224f, 0.159615993f},
-std::array<float,2>{0.925404549f, 0.598944366f},
-std::array<float,2>{0.436755478f, 0.526494861f},
-std::array<float,2>{0.678843617f, 0.215584472f},
-std::array<float,2>{0.183684826f, 0.269355118f},
-std::array<float,2>{0.773039043f, 0.889980435f},
-std::array<float,2>{0.0364158712f, 0.799670637f},
-std::array<float,2>{0.938453972f, 0.390276134f},
-std::array<float,2>{0.356086016f, 4.23194579e-05f},
-std::array<float,2>{0.59893018f, 0.673995376f},
-std::array<float,2>{0.0134206749f, 0.663425386f},
-std::array<float,2>{0.993756354f, 0.0302867144f},
-std::array<float,2>{0.339001954f, 0.399702489f},
-std::array<float,2>{0.58047998f, 0.789470136f},
-std::array<float,2>{0.391208261f, 0.905366838f},
-std::array<float,2>{0.638864815f, 0.251474798f},
-std::array<float,2>{0.137701586f, 0.190993801f},
-std::array<float,2>{0.8008793f, 0.511239588f},
-std::array<float,2>{0.302719623f, 0.611338198f},
-std::array<float,2>{0.557133198f, 0.181112573f},
-std::array<float,2>{0.110341586f, 0.349763334f},
-std::array<float,2>{0.882332683f, 0.998850226f},
-std::array<float,2>{0.241408542f, 0.840161622f},
-std::array<float,2>{0.830657125f, 0.458077073f},
-std::array<float,2>{0.493137777f, 0.0723220408f},
-std::array<float,2>{0.729426205f, 0.69575119f},
-std::array<float,2>{0.163253441f, 0.546310484f},
-std::array<float,2>{0.754601061f, 0.244202897f},
-std::array<float,2>{0.40688175f, 0.308859915f},
-std::array<float,2>{0.667453527f, 0.928888857f},
-std::array<float,2>{0.373366624f, 0.767933905f},
-std::array<float,2>{0.612790406f, 0.40716815f},
-std::array<float,2>{0.049714122f, 0.0609711744f},
-std::array<float,2>{0.966336906f, 0.639007747f},
-std::array<float,2>{0.4602696f, 0.746854842f},
-std::array<float,2>{0.698055983f, 0.109359026f},
-std::array<float,2>{0.216721609f, 0.493463516f},
-std::array<float,2>{0.852775633f, 0.864685774f},
-std::array<float,2>{0.082493104f, 0.947733045f},
-std::array<float,2>{0.909039974f, 0.334200203f},
-std::array<float,2>{0.256839365f, 0.146472827f},
-std::array<float,2>{0.508625388f, 0.580903888f},
-std::array<float,2>{0.0240946375f, 0.61904639f},
-std::array<float,2>{0.975565374f, 0.177875623f},
-std::array<float,2>{0.31593591f, 0.35433948f},
-std::array<float,2>{0.565075517f, 0.989640117f},
-std::array<float,2>{0.375899822f, 0.834392726f},
-std::array<float,2>{0.641423345f, 0.46827209f},
-std::array<float,2>{0.142161489f, 0.0680204853f},
-std::array<float,2>{0.795515895f, 0.689735532f},
-std::array<float,2>{0.290903777f, 0.671411514f},
-std::array<float,2>{0.533139646f, 0.0216001477f},
-std::array<float,2>{0.0954279229f, 0.398176521f},
-std::array<float,2>{0.903577924f, 0.783942819f},
-std::array<float,2>{0.21971035f, 0.89296186f},
-std::array<float,2>{0.814257681f, 0.257992119f},
-std::array<float,2>{0.48050496f, 0.197054088f},
-std::array<float,2>{0.748984277f, 0.50074935f},
-std::array<float,2>{0.18116352f, 0.736224174f},
-std::array<float,2>{0.768850029f, 0.0985479653f},
-std::array<float,2>{0.433008164f, 0.4848544f},
-std::array<float,2>{0.674812853f, 0.871960938f},
-std::array<float,2>{0.351692885f, 0.943793595f},
-std::array<float,2>{0.594381809f, 0.33690232f},
-std::array<float,2>{0.0327980034f, 0.152338222f},
-std::array<float,2>{0.943501592f, 0.586865783f},
-std::array<float,2>{0.452230871f, 0.538417161f},
-std::array<float,2>{0.710910857f, 0.239475131f},
-std::array<float,2>{0.199379668f, 0.302294791f},
-std::array<float,2>{0.871185005f, 0.931484401f},
-std::array<float,2>{0.072704792f, 0.775582492f},
-std::array<float,2>{0.925874233f, 0.42096296f},
-std::array<float,2>{0.26612553f, 0.0544223115f},
-std::array<float,2>{0.527732015f, 0.629286528f},
-std::array<float,2>{0.11670199f, 0.647118151f},
-std::array<float,2>{0.876185715f, 0.0438779108f},
-std::array<float,2>{0.297409147f, 0.427811086f},
-std::array<float,2>{0.559540033f, 0.758567274f},
-std::array<float,2>{0.497611016f, 0.92088145f},
-std::array<float,2>{0.731582046f, 0.287142217f},
-std::array<float,2>{0.236963004f, 0.229667172f},
-std::array<float,2>{0.83259517f, 0.556949675f},
-std::array<float,2>{0.343102634f, 0.575475693f},
-std::array<float,2>{0.583148301f, 0.130582973f},
-std::array<float,2>{0.00809396245f, 0.313534141f},
-std::array<float,2>{0.996726036f, 0.960702896f},
-std::array<float,2>{0.133051023f, 0.856279254f},
-std::array<float,2>{0.800322294f, 0.477925718f},
-std::array<float,2>{0.397488475f, 0.110206366f},
-std::array<float,2>{0.635775626f, 0.718913555f},
-std::array<float,2>{0.213217497f, 0.522582233f},
-std::array<float,2>{0.857203543f, 0.210270926f},
-std::array<float,2>{0.455190897f, 0.277105391f},
-std::array<float,2>{0.70290637f, 0.881398201f},
-std::array<float,2>{0.253668427f, 0.809445083f},
-std::array<float,2>{0.514056325f, 0.381132096f},
-std::array<float,2>{0.079897806f, 0.0146009959f},
-std::array<float,2>{0.913854837f, 0.685797572f},
-std::array<float,2>{0.41161409f, 0.713776469f},
-std::array<float,2>{0.668702424f, 0.0873693302f},
-std::array<float,2>{0.1591952f, 0.444233119f},
-std::array<float,2>{0.750702322f, 0.819650769f},
-std::array<float,2>{0.0513274185f, 0.973837912f},
-std::array<float,2>{0.961378872f, 0.363141745f},
-std::array<float,2>{0.367449224f, 0.164542258f},
-std::array<float,2>{0.61531651f, 0.60352087f},
-std::array<float,2>{0.0919132903f, 0.550852537f},
-std::array<float,2>{0.920593083f, 0.224240825f},
-std::array<float,2>{0.265525788f, 0.295159072f},
-std::array<float,2>{0.501821578f, 0.912225902f},
-std::array<float,2>{0.467213243f, 0.757412255f},
-std::array<float,2>{0.694839895f, 0.434807628f},
-std::array<float,2>{0.206102297f, 0.0360027775f},
-std::array<float,2>{0.846645296f, 0.652523577f},
-std::array<float,2>{0.360683888f, 0.732836008f},
-std::array<float,2>{0.618254423f, 0.122100443f},
-std::array<float,2>{0.0570519008f, 0.476180136f},
-std::array<float,2>{0.958117843f, 0.850748658f},
-std::array<float,2>{0.165814206f, 0.964427948f},
-std::array<float,2>{0.765559375f, 0.327669144f},
-std::array<float,2>{0.417085767f, 0.139279649f},
-std::array<float,2>{0.65721786f, 0.569630444f},
-std::array<float,2>{0.245441586f, 0.679573834f},
-std::array<float,2>{0.840477943f, 0.00767359184f},
-std::array<float,2>{0.491937637f, 0.384555787f},
-std::array<float,2>{0.723366559f, 0.802359998f},
-std::array<float,2>{0.305346608f, 0.885093033f},
-std::array<float,2>{0.549683392f, 0.26953283f},
-std::array<float,2>{0.119655058f, 0.212172613f},
-std::array<float,2>{0.886699259f, 0.530130148f},
-std::array<float,2>{0.402443588f, 0.597465515f},
-std::array<float,2>{0.62713939f, 0.161080912f},
-std::array<float,2>{0.128844053f, 0.371222675f},
-std::array<float,2>{0.808000922f, 0.978290439f},
-std::array<float,2>{0.00437331339f, 0.826156437f},
-std::array<float,2>{0.990716636f, 0.451265693f},
-std::array<float,2>{0.328517556f, 0.0843830854f},
-std::array<float,2>{0.586401641f, 0.704101086f},
-std::array<float,2>{0.039514143f, 0.702317178f},
-std::array<float,2>{0.95260936f, 0.0743238106f},
-std::array<float,2>{0.348213553f, 0.456447333f},
-std::array<float,2>{0.602195859f, 0.837997437f},
-std::array<float,2>{0.42817083f, 0.993837953f},
-std::array<float,2>{0.681087971f, 0.346717f},
-std::array<float,2>{0.178666919f, 0.184075102f},
-std::array<float,2>{0.779538214f, 0.616651118f},
-std::array<float,2>{0.275254369f, 0.514406323f},
-std::array<float,2>{0.522936642f, 0.193814322f},
-std::array<float,2>{0.0626306683f, 0.25726527f},
-std::array<float,2>{0.933490276f, 0.901234984f},
-std::array<float,2>{0.190634549f, 0.793745875f},
-std::array<float,2>{0.864724457f, 0.403394014f},
-std::array<float,2>{0.440199167f, 0.0255139545f},
-std::array<float,2>{0.71626085f, 0.657296836f},
-std::array<float,2>{0.156011596f, 0.582500458f},
-std::array<float,2>{0.787265182f, 0.144128799f},
-std::array<float,2>{0.385342658f, 0.32889998f},
-std::array<float,2>{0.649344325f, 0.952175856f},
-std::array<float,2>{0.325921714f, 0.862549722f},
-std::array<float,2>{0.574648142f, 0.49975276f},
-std::array<float,2>{0.0216187034f, 0.103803538f},
-std::array<float,2>{0.982248008f, 0.745296836f},
-std::array<float,2>{0.473520666f, 0.635365009f},
-std::array<float,2>{0.741897821f, 0.0573428348f},
-std::array<float,2>{0.229540855f, 0.413849473f},
-std::array<float,2>{0.824120104f, 0.772780836f},
-std::array<float,2>{0.109045655f, 0.924895227f},
-std::array<float,2>{0.896787345f, 0.308308929f},
-std::array<float,2>{0.281327754f, 0.249045908f},
-std::array<float,2>{0.54292798f, 0.542454183f},
-std::array<float,2>{0.00076104945f, 0.534707844f},
-std::array<float,2>{0.987479568f, 0.235485345f},
-std::array<float,2>{0.332840472f, 0.300086111f},
-std::array<float,2>{0.592109919f, 0.934578478f},
-std::array<float,2>{0.400734454f, 0.778568208f},
-std::array<float,2>{0.630179942f, 0.414465308f},
-std::array<float,2>{0.129353702f, 0.0474179722f},
-std::array<float,2>{0.812242031f, 0.628705621f},
-std::array<float,2>{0.312256545f, 0.740452707f},
-std::array<float,2>{0.554238021f, 0.0947702006f},
-std::array<float,2>{0.122465938f, 0.488319784f},
-std::array<float,2>{0.890097976f, 0.869902849f},
-std::array<float,2>{0.249098718f, 0.938905478f},
-std::array<float,2>{0.836683214f, 0.343371093f},
-std::array<float,2>{0.4861027f, 0.153499231f},
-std::array<float,2>{0.719993889f, 0.59070456f},
-std::array<float,2>{0.170742899f, 0.665366292f},
-std::array<float,2>{0.758790374f, 0.0179201495f},
-std::array<float,2>{0.41887331f, 0.390890926f},
-std::array<float,2>{0.66182822f, 0.786001027f},
-std::array<float,2>{0.363690555f, 0.896226525f},
-std::array<float,2>{0.622570455f, 0.262724996f},
-std::array<float,2>{0.0612723045f, 0.199760467f},
-std::array<float,2>{0.953561187f, 0.506641626f},
-std::array<float,2>{0.462541997f, 0.624845862f},
-std::array<float,2>{0.687791944f, 0.174319059f},
-std::array<float,2>{0.210629985f, 0.358956486f},
-std::array<float,2>{0.850933552f, 0.986698627f},
-std::array<float,2>{0.0861854628f, 0.829574466f},
-std::array<float,2>{0.917494535f, 0.463666201f},
-std::array<float,2>{0.260451257f, 0.0636878163f},
-std::array<float,2>{0.504082322f, 0.69477433f},
-std::array<float,2>{0.104998641f, 0.718147218f},
-std::array<float,2>{0.892140448f, 0.0918147564f},
-std::array<float,2>{0.287120789f, 0.439956576f},
-std::array<float,2>{0.546314299f, 0.814768195f},
-std::array<float,2>{0.470515817f, 0.969135225f},
-std::array<float,2>{0.7367118f, 0.366225272f},
-std::array<float,2>{0.234011531f, 0.169465795f},
-std::array<float,2>{0.827001512f, 0.608577728f},
-std::array<float,2>{0.323235065f, 0.516933918f},
-std::array<float,2>{0.572474062f, 0.206290931f},
-std::array<float,2>{0.016518984f, 0.279025972f},
-std::array<float,2>{0.977944791f, 0.875778437f},
-std::array<float,2>{0.149490982f, 0.804879546f},
-std::array<float,2>{0.783986986f, 0.376475394f},
-std::array<float,2>{0.390254587f, 0.0107083069f},
-std::array<float,2>{0.653542161f, 0.682900488f},
-std::array<float,2>{0.193777606f, 0.571229398f},
-std::array<float,2>{0.861592591f, 0.128298819f},
-std::array<float,2>{0.442691088f, 0.318953693f},
-std::array<float,2>{0.713236153f, 0.956544757f},
-std::array<float,2>{0.27885884f, 0.852413535f},
-std::array<float,2>{0.515937865f, 0.483945757f},
-std::array<float,2>{0.0682666525f, 0.116489291f},
-std::array<float,2>{0.935311258f, 0.725014508f},
-std::array<float,2>{0.421895117f, 0.641505659f},
-std::array<float,2>{0.685374737f, 0.0390852429f},
-std::array<float,2>{0.173717842f, 0.423021942f},
-std::array<float,2>{0.775593758f, 0.76287508f},
-std::array<float,2>{0.0443403274f, 0.916358531f},
-std::array<float,2>{0.94847697f, 0.281510264f},
-std::array<float,2>{0.344663262f, 0.233102903f},
-std::array<float,2>{0.605710149f, 0.560694218f},
-std::array<float,2>{0.0749366581f, 0.601264894f},
-std::array<float,2>{0.921999335f, 0.156297162f},
-std::array<float,2>{0.272837758f, 0.369177908f},
-std::array<float,2>{0.524236917f, 0.982798696f},
-std::array<float,2>{0.446442485f, 0.822416484f},
-std::array<float,2>{0.705210626f, 0.448840946f},
-std::array<float,2>{0.198361993f, 0.0784472674f},
-std::array<float,2>{0.870758474f, 0.707382083f},
-std::array<float,2>{0.359171122f, 0.672405064f},
-std::array<float,2>{0.599930704f, 0.0021386724f},
-std::array<float,2>{0.0380720235f, 0.388544679f},
-std::array<float,2>{0.93988663f, 0.796900511f},
-std::array<float,2>{0.187099323f, 0.888187826f},
-std::array<float,2>{0.771085024f, 0.266549498f},
-std::array<float,2>{0.43501088f, 0.217998773f},
-std::array<float,2>{0.676127791f, 0.524163842f},
-std::array<float,2>{0.223316163f, 0.727681339f},
-std::array<float,2>{0.819424033f, 0.119002298f},
-std::array<float,2>{0.480344474f, 0.468879014f},
-std::array<float,2>{0.742991745f, 0.845309496f},
-std::array<float,2>{0.293382585f, 0.967658579f},
-std::array<float,2>{0.536890805f, 0.321933627f},
-std::array<float,2>{0.101456583f, 0.135346487f},
-std::array<float,2>{0.899671137f, 0.564648271f},
-std::array<float,2>{0.380222231f, 0.548535228f},
-std::array<float,2>{0.648120224f, 0.219651818f},
-std::array<float,2>{0.146508873f, 0.292544603f},
-std::array<float,2>{0.792391002f, 0.90694499f},
-std::array<float,2>{0.0276037641f, 0.751755238f},
-std::array<float,2>{0.971542597f, 0.430939734f},
-std::array<float,2>{0.317074627f, 0.0347566269f},
-std::array<float,2>{0.567174733f, 0.651407182f},
-std::array<float,2>{0.0485992283f, 0.637523472f},
-std::array<float,2>{0.966988087f, 0.0597520173f},
-std::array<float,2>{0.371835917f, 0.408681303f},
-std::array<float,2>{0.610452533f, 0.767192483f},
-std::array<float,2>{0.409998089f, 0.926280916f},
-std::array<float,2>{0.665862799f, 0.311666071f},
-std::array<float,2>{0.161653847f, 0.243006587f},
-std::array<float,2>{0.756803036f, 0.544539571f},
-std::array<float,2>{0.254054099f, 0.579314649f},
-std::array<float,2>{0.511427164f, 0.146842122f},
-std::array<float,2>{0.0856366381f, 0.332741588f},
-std::array<float,2>{0.906790912f, 0.945940197f},
-std::array<float,2>{0.217695221f, 0.866068244f},
-std::array<float,2>{0.855397344f, 0.495655417f},
-std::array<float,2>{0.457614034f, 0.105622858f},
-std::array<float,2>{0.696678817f, 0.749833345f},
-std::array<float,2>{0.139447525f, 0.507986724f},
-std::array<float,2>{0.80306983f, 0.188197404f},
-std::array<float,2>{0.392615139f, 0.253476351f},
-std::array<float,2>{0.637341261f, 0.903338492f},
-std::array<float,2>{0.337247312f, 0.792703331f},
-std::array<float,2>{0.579286337f, 0.401332349f},
-std::array<float,2>{0.014572476f, 0.0283917282f},
-std::array<float,2>{0.994619548f, 0.661861062f},
-std::array<float,2>{0.495711297f, 0.69903475f},
-std::array<float,2>{0.727703631f, 0.0711341947f},
-std::array<float,2>{0.23908186f, 0.460864961f},
-std::array<float,2>{0.829214096f, 0.842572272f},
-std::array<float,2>{0.11187052f, 0.99744308f},
-std::array<float,2>{0.8794626f, 0.347695142f},
-std::array<float,2>{0.304448336f, 0.183100194f},
-std::array<float,2>{0.555863559f, 0.610258579f},
-std::array<float,2>{0.0339622945f, 0.589770854f},
-std::array<float,2>{0.943133771f, 0.148556456f},
-std::array<float,2>{0.353648603f, 0.339217365f},
-std::array<float,2>{0.596771538f, 0.941546857f},
-std::array<float,2>{0.430466563f, 0.87369734f},
-std::array<float,2>{0.672150731f, 0.487897843f},
-std::array<float,2>{0.182237625f, 0.100985259f},
-std::array<float,2>{0.766240895f, 0.737697482f},
-std::array<float,2>{0.268821806f, 0.631754518f},
-std::array<float,2>{0.529924989f, 0.0527217537f},
-std::array<float,2>{0.0719532073f, 0.418469101f},
-std::array<float,2>{0.927931488f, 0.774447203f},
-std::array<float,2>{0.202786058f, 0.933132291f},
-std::array<float,2>{0.873703241f, 0.303423822f},
-std::array<float,2>{0.450729579f, 0.240831628f},
-std::array<float,2>{0.707382858f, 0.536059916f},
-std::array<float,2>{0.143736273f, 0.688445866f},
-std::array<float,2>{0.794453084f, 0.0701519847f},
-std::array<float,2>{0.378482312f, 0.464981943f},
-std::array<float,2>{0.643472373f, 0.832730353f},
-std::array<float,2>{0.312609136f, 0.99151957f},
-std::array<float,2>{0.564181328f, 0.352367193f},
-std::array<float,2>{0.0265320763f, 0.176374942f},
-std::array<float,2>{0.972820759f, 0.620055139f},
-std::array<float,2>{0.482856363f, 0.503286064f},
-std::array<float,2>{0.746517777f, 0.197843939f},
-std::array<float,2>{0.221939847f, 0.260495812f},
-std::array<float,2>{0.814886689f, 0.892067909f},
-std::array<float,2>{0.0971899703f, 0.783017874f},
-std::array<float,2>{0.905315101f, 0.395815521f},
-std::array<float,2>{0.292920947f, 0.020329535f},
-std::array<float,2>{0.534925222f, 0.668968618f},
-std::array<float,2>{0.0814600736f, 0.684908867f},
-std::array<float,2>{0.910582662f, 0.0126079144f},
-std::array<float,2>{0.251484483f, 0.380269825f},
-std::array<float,2>{0.513247371f, 0.811344504f},
-std::array<float,2>{0.454076678f, 0.880555809f},
-std::array<float,2>{0.700565755f, 0.273798048f},
-std::array<float,2>{0.210955396f, 0.207046017f},
-std::array<float,2>{0.85869503f, 0.520881951f},
-std::array<float,2>{0.370083332f, 0.60238272f},
-std::array<float,2>{0.613515735f, 0.166735023f},
-std::array<float,2>{0.0534116924f, 0.361236662f},
-std::array<float,2>{0.963509738f, 0.975515366f},
-std::array<float,2>{0.15768604f, 0.818320513f},
-std::array<float,2>{0.753168106f, 0.441710114f},
-std::array<float,2>{0.414006114f, 0.0883626193f},
-std::array<float,2>{0.669937551f, 0.711562037f},
-std::array<float,2>{0.235597819f, 0.555967093f},
-std::array<float,2>{0.834354877f, 0.228127196f},
-std::array<float,2>{0.499296188f, 0.286470205f},
-std::array<float,2>{0.733292639f, 0.918930769f},
-std::array<float,2>{0.300061584f, 0.760060251f},
-std::array<float,2>{0.561498165f, 0.426117986f},
-std::array<float,2>{0.114555068f, 0.0461687557f},
-std::array<float,2>{0.878043473f, 0.645538986f},
-std::array<float,2>{0.396132916f, 0.721006513f},
-std::array<float,2>{0.633003235f, 0.111641027f},
-std::array<float,2>{0.136280715f, 0.479397237f},
-std::array<float,2>{0.798304975f, 0.858125329f},
-std::array<float,2>{0.0108592892f, 0.957571983f},
-std::array<float,2>{0.99987942f, 0.315155178f},
-std::array<float,2>{0.340513021f, 0.132356793f},
-std::array<float,2>{0.585570276f, 0.57753098f},
-std::array<float,2>{0.118858598f, 0.529017568f},
-std::array<float,2>{0.884507477f, 0.213776097f},
-std::array<float,2>{0.308079988f, 0.272714287f},
-std::array<float,2>{0.547151983f, 0.883665144f},
-std::array<float,2>{0.488776267f, 0.803261578f},
-std::array<float,2>{0.725950897f, 0.384899497f},
-std::array<float,2>{0.244021386f, 0.00577789312f},
-std::array<float,2>{0.842245102f, 0.676660359f},
-std::array<float,2>{0.330932051f, 0.706023693f},
-std::array<float,2>{0.589308441f, 0.0827654675f},
-std::array<float,2>{0.00738945603f, 0.45070219f},
-std::array<float,2>{0.989269257f, 0.827831268f},
-std::array<float,2>{0.125268877f, 0.97875905f},
-std::array<float,2>{0.805846393f, 0.374984026f},
-std::array<float,2>{0.404316008f, 0.162314788f},
-std::array<float,2>{0.626180232f, 0.594505787f},
-std::array<float,2>{0.204271272f, 0.65464747f},
-std::array<float,2>{0.845560551f, 0.038162265f},
-std::array<float,2>{0.465758443f, 0.437351018f},
-std::array<float,2>{0.69297719f, 0.75530827f},
-std::array<float,2>{0.262185067f, 0.910932422f},
-std::array<float,2>{0.503380001f, 0.294074863f},
-std::array<float,2>{0.0911914855f, 0.225055888f},
-std::array<float,2>{0.91835624f, 0.554048717f},
-std::array<float,2>{0.415077984f, 0.567267895f},
-std::array<float,2>{0.659261286f, 0.138036102f},
-std::array<float,2>{0.166120887f, 0.324627399f},
-std::array<float,2>{0.761981487f, 0.961987138f},
-std::array<float,2>{0.0556229502f, 0.847863793f},
-std::array<float,2>{0.959327281f, 0.474030644f},
-std::array<float,2>{0.362296641f, 0.123850048f},
-std::array<float,2>{0.620829105f, 0.731806517f},
-std::array<float,2>{0.0214838684f, 0.742544591f},
-std::array<float,2>{0.982915759f, 0.102644615f},
-std::array<float,2>{0.326712638f, 0.497575879f},
-std::array<float,2>{0.577311277f, 0.86128068f},
-std::array<float,2>{0.384125799f, 0.949387491f},
-std::array<float,2>{0.651047707f, 0.331253082f},
-std::array<float,2>{0.153220892f, 0.141695857f},
-std::array<float,2>{0.78615284f, 0.584928811f},
-std::array<float,2>{0.284747332f, 0.540518343f},
-std::array<float,2>{0.540284753f, 0.247822598f},
-std::array<float,2>{0.107170023f, 0.3055062f},
-std::array<float,2>{0.895839214f, 0.922175705f},
-std::array<float,2>{0.22822994f, 0.769945383f},
-std::array<float,2>{0.821564913f, 0.410642356f},
-std::array<float,2>{0.476486176f, 0.0553698875f},
-std::array<float,2>{0.73835808f, 0.633226395f},
-std::array<float,2>{0.1764552f, 0.614145279f},
-std::array<float,2>{0.777784586f, 0.186564296f},
-std::array<float,2>{0.427684993f, 0.344855815f},
-std::array<float,2>{0.683488905f, 0.994304597f},
-std::array<float,2>{0.351017833f, 0.837589145f},
-std::array<float,2>{0.604442537f, 0.454140604f},
-std::array<float,2>{0.0420265496f, 0.0768844858f},
-std::array<float,2>{0.949517787f, 0.69935894f},
-std::array<float,2>{0.437913895f, 0.659964859f},
-std::array<float,2>{0.716837943f, 0.0244852882f},
-std::array<float,2>{0.18758224f, 0.404584527f},
-std::array<float,2>{0.865724087f, 0.796076357f},
-std::array<float,2>{0.0655183122f, 0.899569869f},
-std::array<float,2>{0.931622803f, 0.255067497f},
-std::array<float,2>{0.276664227f, 0.193024844f},
-std::array<float,2>{0.521177411f, 0.51241976f},
-std::array<float,2>{0.0491960011f, 0.544211626f},
-std::array<float,2>{0.966290534f, 0.242486581f},
-std::array<float,2>{0.373615742f, 0.312160909f},
-std::array<float,2>{0.612840354f, 0.926263928f},
-std::array<float,2>{0.406552911f, 0.766842127f},
-std::array<float,2>{0.667623878f, 0.408820659f},
-std::array<float,2>{0.163842291f, 0.0605141409f},
-std::array<float,2>{0.754377425f, 0.637029231f},
-std::array<float,2>{0.257782191f, 0.749454677f},
-std::array<float,2>{0.507946968f, 0.105959274f},
-std::array<float,2>{0.0829063356f, 0.495284766f},
-std::array<float,2>{0.908336043f, 0.865614712f},
-std::array<float,2>{0.216116771f, 0.945316017f},
-std::array<float,2>{0.853134573f, 0.332331359f},
-std::array<float,2>{0.460467875f, 0.1473988f},
-std::array<float,2>{0.697699547f, 0.58004421f},
-std::array<float,2>{0.138381705f, 0.661146104f},
-std::array<float,2>{0.801274538f, 0.0290259626f},
-std::array<float,2>{0.391073465f, 0.400429487f},
-std::array<float,2>{0.63954699f, 0.792106867f},
-std::array<float,2>{0.339406997f, 0.903991222f},
-std::array<float,2>{0.58103323f, 0.253291368f},
-std::array<float,2>{0.0130563695f, 0.187935069f},
-std::array<float,2>{0.993527651f, 0.508460164f},
-std::array<float,2>{0.492446065f, 0.609447479f},
-std::array<float,2>{0.728910387f, 0.183564812f},
-std::array<float,2>{0.242120251f, 0.348392844f},
-std::array<float,2>{0.830473125f, 0.997600436f},
-std::array<float,2>{0.109541431f, 0.842080951f},
-std::array<float,2>{0.8822577f, 0.459972411f},
-std::array<float,2>{0.302010417f, 0.0707194209f},
-std::array<float,2>{0.556657612f, 0.698459983f},
-std::array<float,2>{0.0767634287f, 0.707835615f},
-std::array<float,2>{0.924824417f, 0.0788741633f},
-std::array<float,2>{0.270658523f, 0.448441833f},
-std::array<float,2>{0.526613653f, 0.823065639f},
-std::array<float,2>{0.449116349f, 0.983126938f},
-std::array<float,2>{0.70362705f, 0.369856536f},
-std::array<float,2>{0.196981058f, 0.156960964f},
-std::array<float,2>{0.868061423f, 0.600647569f},
-std::array<float,2>{0.355551958f, 0.523663342f},
-std::array<float,2>{0.599518716f, 0.21852313f},
-std::array<float,2>{0.0370652936f, 0.265944213f},
-std::array<float,2>{0.937620103f, 0.887815595f},
-std::array<float,2>{0.184290081f, 0.797526777f},
-std::array<float,2>{0.772816062f, 0.387908757f},
-std::array<float,2>{0.437259197f, 0.00259065325f},
-std::array<float,2>{0.679544806f, 0.671973526f},
-std::array<float,2>{0.225397944f, 0.565321922f},
-std::array<float,2>{0.816527784f, 0.134838f},
-std::array<float,2>{0.478200793f, 0.321596861f},
-std::array<float,2>{0.744981468f, 0.967145324f},
-std::array<float,2>{0.295136541f, 0.844993234f},
-std::array<float,2>{0.537758648f, 0.46956864f},
-std::array<float,2>{0.0994817466f, 0.118392013f},
-std::array<float,2>{0.901522279f, 0.728283763f},
-std::array<float,2>{0.381839395f, 0.651952803f},
-std::array<float,2>{0.645136237f, 0.0343211703f},
-std::array<float,2>{0.145545602f, 0.431610167f},
-std::array<float,2>{0.789934158f, 0.751144886f},
-std::array<float,2>{0.0303072277f, 0.906669915f},
-std::array<float,2>{0.968780041f, 0.292035252f},
-std::array<float,2>{0.318821788f, 0.218973517f},
-std::array<float,2>{0.568902016f, 0.548000693f},
-std::array<float,2>{0.101635352f, 0.609091938f},
-std::array<float,2>{0.894099712f, 0.169181496f},
-std::array<float,2>{0.285947621f, 0.367057741f},
-std::array<float,2>{0.54308641f, 0.969544053f},
-std::array<float,2>{0.471562773f, 0.814976633f},
-std::array<float,2>{0.734870613f, 0.43965134f},
-std::array<float,2>{0.231203541f, 0.0923798084f},
-std::array<float,2>{0.824303985f, 0.718274176f},
-std::array<float,2>{0.321499765f, 0.683169603f},
-std::array<float,2>{0.571492314f, 0.0100608664f},
-std::array<float,2>{0.0184209384f, 0.376150459f},
-std::array<float,2>{0.979812741f, 0.805582464f},
-std::array<float,2>{0.151317492f, 0.875438809f},
-std::array<float,2>{0.781435013f, 0.278353155f},
-std::array<float,2>{0.386889458f, 0.206561506f},
-std::array<float,2>{0.656117916f, 0.517261803f},
-std::array<float,2>{0.193330854f, 0.725417912f},
-std::array<float,2>{0.860390306f, 0.117162503f},
-std::array<float,2>{0.445058942f, 0.483856708f},
-std::array<float,2>{0.711411595f, 0.851765037f},
-std::array<float,2>{0.280223221f, 0.956224144f},
-std::array<float,2>{0.518445909f, 0.318591893f},
-std::array<float,2>{0.0700503215f, 0.128672957f},
-std::array<float,2>{0.936446249f, 0.570727587f},
-std::array<float,2>{0.425508946f, 0.56150496f},
-std::array<float,2>{0.685996294f, 0.232730344f},
-std::array<float,2>{0.174785376f, 0.282110035f},
-std::array<float,2>{0.775083363f, 0.916675329f},
-std::array<float,2>{0.0451610833f, 0.763199687f},
-std::array<float,2>{0.946463168f, 0.42336902f},
-std::array<float,2>{0.347468048f, 0.0397014879f},
-std::array<float,2>{0.60913974f, 0.64090699f},
-std::array<float,2>{0.00277948542f, 0.628395021f},
-std::array<float,2>{0.985736012f, 0.0470969342f},
-std::array<float,2>{0.334623218f, 0.414736301f},
-std::array<float,2>{0.591336846f, 0.778885305f},
-std::array<float,2>{0.398923278f, 0.935425043f},
-std::array<float,2>{0.631519854f, 0.300468653f},
-std::array<float,2>{0.131570026f, 0.236153215f},
-std::array<float,2>{0.809515834f, 0.534538507f},
-std::array<float,2>{0.310373068f, 0.589918137f},
-std::array<float,2>{0.552239299f, 0.154101506f},
-std::array<float,2>{0.123802826f, 0.343246341f},
-std::array<float,2>{0.887630701f, 0.939266026f},
-std::array<float,2>{0.246820673f, 0.869366527f},
-std::array<float,2>{0.839216173f, 0.489040822f},
-std::array<float,2>{0.487739712f, 0.0955357999f},
-std::array<float,2>{0.721410215f, 0.740899444f},
-std::array<float,2>{0.169807002f, 0.505957186f},
-std::array<float,2>{0.761133254f, 0.199227616f},
-std::array<float,2>{0.420446515f, 0.263293803f},
-std::array<float,2>{0.664016664f, 0.895992041f},
-std::array<float,2>{0.366003662f, 0.785316885f},
-std::array<float,2>{0.623086214f, 0.391132534f},
-std::array<float,2>{0.0598386414f, 0.0184796248f},
-std::array<float,2>{0.956427991f, 0.665719271f},
-std::array<float,2>{0.464645773f, 0.694921613f},
-std::array<float,2>{0.690889478f, 0.0643517151f},
-std::array<float,2>{0.207536831f, 0.462985337f},
-std::array<float,2>{0.848091245f, 0.829601705f},
-std::array<float,2>{0.088851653f, 0.986927211f},
-std::array<float,2>{0.914903879f, 0.358820885f},
-std::array<float,2>{0.258265167f, 0.174261212f},
-std::array<float,2>{0.507275224f, 0.624295771f},
-std::array<float,2>{0.0220211986f, 0.584240258f},
-std::array<float,2>{0.981588244f, 0.142191783f},
-std::array<float,2>{0.325585485f, 0.331875235f},
-std::array<float,2>{0.574882746f, 0.949929476f},
-std::array<float,2>{0.385087341f, 0.860574186f},
-std::array<float,2>{0.648640752f, 0.497479796f},
-std::array<float,2>{0.155698076f, 0.103509083f},
-std::array<float,2>{0.787926793f, 0.74269253f},
-std::array<float,2>{0.282202244f, 0.63356328f},
-std::array<float,2>{0.542153895f, 0.0549522303f},
-std::array<float,2>{0.108457081f, 0.410665989f},
-std::array<float,2>{0.897266209f, 0.77047658f},
-std::array<float,2>{0.230379254f, 0.922415137f},
-std::array<float,2>{0.823587418f, 0.3049725f},
-std::array<float,2>{0.472966433f, 0.247163519f},
-std::array<float,2>{0.741617382f, 0.540534854f},
-std::array<float,2>{0.177878544f, 0.699802697f},
-std::array<float,2>{0.780165136f, 0.0761790797f},
-std::array<float,2>{0.428276479f, 0.454902977f},
-std::array<float,2>{0.681214035f, 0.837240636f},
-std::array<float,2>{0.348141253f, 0.994701147f},
-std::array<float,2>{0.601952434f, 0.345648557f},
-std::array<float,2>{0.0399297625f, 0.187145516f},
-std::array<float,2>{0.952649951f, 0.613592446f},
-std::array<float,2>{0.43974328f, 0.511760712f},
-std::array<float,2>{0.716455638f, 0.192727625f},
-std::array<float,2>{0.191312701f, 0.255548984f},
-std::array<float,2>{0.864931226f, 0.900098026f},
-std::array<float,2>{0.0630378351f, 0.796861708f},
-std::array<float,2>{0.932967007f, 0.405047029f},
-std::array<float,2>{0.274870068f, 0.0249950029f},
-std::array<float,2>{0.523193181f, 0.659636617f},
-std::array<float,2>{0.119551875f, 0.67600137f},
-std::array<float,2>{0.886057794f, 0.00536842179f},
-std::array<float,2>{0.304899484f, 0.385340869f},
-std::array<float,2>{0.548848808f, 0.802842081f},
-std::array<float,2>{0.49152261f, 0.882914901f},
-std::array<float,2>{0.722745955f, 0.273078859f},
-std::array<float,2>{0.245850861f, 0.213215619f},
-std::array<float,2>{0.840259314f, 0.528564572f},
-std::array<float,2>{0.328869671f, 0.593833029f},
-std::array<float,2>{0.586647689f, 0.162768766f},
-std::array<float,2>{0.00482175266f, 0.374356925f},
-std::array<float,2>{0.991110444f, 0.979118288f},
-std::array<float,2>{0.128288761f, 0.827570915f},
-std::array<float,2>{0.808322906f, 0.450659424f},
-std::array<float,2>{0.403277576f, 0.082479924f},
-std::array<float,2>{0.627705097f, 0.705472827f},
-std::array<float,2>{0.206646457f, 0.554449201f},
-std::array<float,2>{0.84572047f, 0.225509316f},
-std::array<float,2>{0.467512965f, 0.29473263f},
-std::array<float,2>{0.694690645f, 0.910478592f},
-std::array<float,2>{0.264766425f, 0.755627334f},
-std::array<float,2>{0.501423538f, 0.436754525f},
-std::array<float,2>{0.0927468836f, 0.0388882086f},
-std::array<float,2>{0.920288801f, 0.655089796f},
-std::array<float,2>{0.417506188f, 0.732317984f},
-std::array<float,2>{0.656320989f, 0.123421051f},
-std::array<float,2>{0.165352836f, 0.474269271f},
-std::array<float,2>{0.76497972f, 0.84823513f},
-std::array<float,2>{0.057554815f, 0.962883115f},
-std::array<float,2>{0.958789885f, 0.325151443f},
-std::array<float,2>{0.360857934f, 0.138478532f},
-std::array<float,2>{0.619000316f, 0.56677568f},
-std::array<float,2>{0.0793281123f, 0.521401227f},
-std::array<float,2>{0.913386703f, 0.207867026f},
-std::array<float,2>{0.25294137f, 0.274116397f},
-std::array<float,2>{0.514227688f, 0.880169272f},
-std::array<float,2>{0.455800623f, 0.810905635f},
-std::array<float,2>{0.702516675f, 0.380485147f},
-std::array<float,2>{0.213798463f, 0.0121965539f},
-std::array<float,2>{0.856751919f, 0.685305178f},
-std::array<float,2>{0.367741972f, 0.711399019f},
-std::array<float,2>{0.615923941f, 0.0884527937f},
-std::array<float,2>{0.0510917194f, 0.442316383f},
-std::array<float,2>{0.961843789f, 0.817472517f},
-std::array<float,2>{0.159697309f, 0.975023806f},
-std::array<float,2>{0.750418723f, 0.360537589f},
-std::array<float,2>{0.411840558f, 0.166326478f},
-std::array<float,2>{0.668321729f, 0.602005661f},
-std::array<float,2>{0.236501902f, 0.646350086f},
-std::array<float,2>{0.832184792f, 0.0465815552f},
-std::array<float,2>{0.497184485f, 0.426299542f},
-std::array<float,2>{0.732200503f, 0.760644078f},
-std::array<float,2>{0.296917349f, 0.918123066f},
-std::array<float,2>{0.558768511f, 0.286777347f},
-std::array<float,2>{0.116372533f, 0.227641895f},
-std::array<float,2>{0.876785278f, 0.556487083f},
-std::array<float,2>{0.398366362f, 0.578029096f},
-std::array<float,2>{0.636655211f, 0.132175252f},
-std::array<float,2>{0.133347094f, 0.314454854f},
-std::array<float,2>{0.799923182f, 0.957297266f},
-std::array<float,2>{0.00866035931f, 0.857577145f},
-std::array<float,2>{0.996434331f, 0.478752673f},
-std::array<float,2>{0.343566865f, 0.112052135f},
-std::array<float,2>{0.583890796f, 0.721205056f},
-std::array<float,2>{0.032560084f, 0.738263071f},
-std::array<float,2>{0.944126785f, 0.101084679f},
-std::array<float,2>{0.352138817f, 0.487783432f},
-std::array<float,2>{0.593861163f, 0.873208821f},
-std::array<float,2>{0.433472961f, 0.942301035f},
-std::array<float,2>{0.675318837f, 0.339422643f},
-std::array<float,2>{0.18106845f, 0.149001315f},
-std::array<float,2>{0.769317687f, 0.588994205f},
-std::array<float,2>{0.265641034f, 0.535412431f},
-std::array<float,2>{0.528030753f, 0.240486443f},
-std::array<float,2>{0.0732242465f, 0.3027744f},
-std::array<float,2>{0.926655769f, 0.933072329f},
-std::array<float,2>{0.200027213f, 0.77515918f},
-std::array<float,2>{0.871718287f, 0.4184286f},
-std::array<float,2>{0.452951729f, 0.0521320552f},
-std::array<float,2>{0.71021533f, 0.631089032f},
-std::array<float,2>{0.142069429f, 0.619463623f},
-std::array<float,2>{0.795314312f, 0.175826102f},
-std::array<float,2>{0.375409871f, 0.352033019f},
-std::array<float,2>{0.640995622f, 0.992017329f},
-std::array<float,2>{0.315897822f, 0.832163513f},
-std::array<float,2>{0.564930201f, 0.465512514f},
-std::array<float,2>{0.0238635056f, 0.0693672523f},
-std::array<float,2>{0.974791825f, 0.687595129f},
-std::array<float,2>{0.481270134f, 0.669435978f},
-std::array<float,2>{0.74815768f, 0.0195359401f},
-std::array<float,2>{0.218891487f, 0.3963615f},
-std::array<float,2>{0.813808501f, 0.7826702f},
-std::array<float,2>{0.0948138088f, 0.892447472f},
-std::array<float,2>{0.903920174f, 0.260003179f},
-std::array<float,2>{0.290504456f, 0.197652042f},
-std::array<float,2>{0.532233298f, 0.503738344f},
-std::array<float,2>{0.0138648441f, 0.510886669f},
-std::array<float,2>{0.99469322f, 0.190588981f},
-std::array<float,2>{0.337516099f, 0.25132522f},
-std::array<float,2>{0.579780877f, 0.905826032f},
-std::array<float,2>{0.393199027f, 0.789726913f},
-std::array<float,2>{0.637181222f, 0.40036276f},
-std::array<float,2>{0.139064163f, 0.031040797f},
-std::array<float,2>{0.803437889f, 0.663714647f},
-std::array<float,2>{0.304188013f, 0.696098268f},
-std::array<float,2>{0.556499839f, 0.0727828667f},
-std::array<float,2>{0.111338288f, 0.458870023f},
-std::array<float,2>{0.87900877f, 0.840768754f},
-std::array<float,2>{0.23865138f, 0.998489141f},
-std::array<float,2>{0.829617977f, 0.350542665f},
-std::array<float,2>{0.495585322f, 0.181308031f},
-std::array<float,2>{0.728081584f, 0.612145662f},
-std::array<float,2>{0.161215723f, 0.639606655f},
-std::array<float,2>{0.756066024f, 0.0614628233f},
-std::array<float,2>{0.409538597f, 0.406340599f},
-std::array<float,2>{0.665227771f, 0.768443823f},
-std::array<float,2>{0.371564656f, 0.92935735f},
-std::array<float,2>{0.611125112f, 0.309387058f},
-std::array<float,2>{0.0482426286f, 0.245056912f},
-std::array<float,2>{0.967757344f, 0.546796739f},
-std::array<float,2>{0.45735535f, 0.58049053f},
-std::array<float,2>{0.697076976f, 0.145676196f},
-std::array<float,2>{0.216811046f, 0.334704459f},
-std::array<float,2>{0.854806423f, 0.947816253f},
-std::array<float,2>{0.0849954039f, 0.864992678f},
-std::array<float,2>{0.906368673f, 0.493825525f},
-std::array<float,2>{0.254709601f, 0.108476192f},
-std::array<float,2>{0.510973752f, 0.746487141f},
-std::array<float,2>{0.100790173f, 0.728827178f},
-std::array<float,2>{0.900377512f, 0.119410239f},
-std::array<float,2>{0.293645322f, 0.471295297f},
-std::array<float,2>{0.536468387f, 0.847363353f},
-std::array<float,2>{0.479594767f, 0.966538072f},
-std::array<float,2>{0.742646992f, 0.323294044f},
-std::array<float,2>{0.223096147f, 0.134534821f},
-std::array<float,2>{0.820007443f, 0.562878549f},
-std::array<float,2>{0.316699237f, 0.549048185f},
-std::array<float,2>{0.566826046f, 0.221856564f},
-std::array<float,2>{0.0282313265f, 0.290438145f},
-std::array<float,2>{0.971029878f, 0.908962429f},
-std::array<float,2>{0.147056386f, 0.753487289f},
-std::array<float,2>{0.792495608f, 0.432789832f},
-std::array<float,2>{0.380695194f, 0.0320356451f},
-std::array<float,2>{0.647675812f, 0.648988783f},
-std::array<float,2>{0.198931068f, 0.599298775f},
-std::array<float,2>{0.870215356f, 0.159679189f},
-std::array<float,2>{0.446839601f, 0.368058562f},
-std::array<float,2>{0.70580101f, 0.980577528f},
-std::array<float,2>{0.273080766f, 0.820621908f},
-std::array<float,2>{0.523749053f, 0.445696622f},
-std::array<float,2>{0.0742397606f, 0.0813775957f},
-std::array<float,2>{0.922379375f, 0.710250914f},
-std::array<float,2>{0.435389638f, 0.674556196f},
-std::array<float,2>{0.676472068f, 0.000566864386f},
-std::array<float,2>{0.186903715f, 0.390117317f},
-std::array<float,2>{0.770516098f, 0.799254f},
-std::array<float,2>{0.0373149961f, 0.890277505f},
-std::array<float,2>{0.940131247f, 0.269010633f},
-std::array<float,2>{0.358884901f, 0.215173841f},
-std::array<float,2>{0.600546181f, 0.526872039f},
-std::array<float,2>{0.0674858689f, 0.573196411f},
-std::array<float,2>{0.934899688f, 0.12614277f},
-std::array<float,2>{0.278682709f, 0.317352861f},
-std::array<float,2>{0.516367972f, 0.953914881f},
-std::array<float,2>{0.44303593f, 0.854631603f},
-std::array<float,2>{0.713862717f, 0.481257677f},
-std::array<float,2>{0.193865061f, 0.113502726f},
-std::array<float,2>{0.862023294f, 0.723766088f},
-std::array<float,2>{0.343824506f, 0.644412577f},
-std::array<float,2>{0.606283426f, 0.0423952006f},
-std::array<float,2>{0.0444769859f, 0.425371885f},
-std::array<float,2>{0.949207842f, 0.765304208f},
-std::array<float,2>{0.173054755f, 0.915720403f},
-std::array<float,2>{0.776066482f, 0.283714056f},
-std::array<float,2>{0.422706902f, 0.230765015f},
-std::array<float,2>{0.684981644f, 0.559876919f},
-std::array<float,2>{0.233797565f, 0.715120614f},
-std::array<float,2>{0.826299667f, 0.0916050076f},
-std::array<float,2>{0.470140129f, 0.43874833f},
-std::array<float,2>{0.736921251f, 0.81351012f},
-std::array<float,2>{0.287867457f, 0.971883118f},
-std::array<float,2>{0.546396971f, 0.363800764f},
-std::array<float,2>{0.104657687f, 0.170888707f},
-std::array<float,2>{0.891888201f, 0.607169449f},
-std::array<float,2>{0.389805406f, 0.51787585f},
-std::array<float,2>{0.653976738f, 0.203695953f},
-std::array<float,2>{0.150015101f, 0.279523879f},
-std::array<float,2>{0.783219457f, 0.877683282f},
-std::array<float,2>{0.0159012005f, 0.807585776f},
-std::array<float,2>{0.978329659f, 0.377336234f},
-std::array<float,2>{0.322737038f, 0.00951173902f},
-std::array<float,2>{0.573216259f, 0.680027902f},
-std::array<float,2>{0.0606322922f, 0.666388154f},
-std::array<float,2>{0.953970075f, 0.01575201f},
-std::array<float,2>{0.36402595f, 0.393004119f},
-std::array<float,2>{0.622145832f, 0.787443995f},
-std::array<float,2>{0.418122709f, 0.896852016f},
-std::array<float,2>{0.661136985f, 0.265470952f},
-std::array<float,2>{0.169956505f, 0.202552795f},
-std::array<float,2>{0.759665906f, 0.504838169f},
-std::array<float,2>{0.260043234f, 0.621383131f},
-std::array<float,2>{0.504803181f, 0.173045337f},
-std::array<float,2>{0.0865181834f, 0.357100904f},
-std::array<float,2>{0.917337f, 0.9857862f},
-std::array<float,2>{0.210197151f, 0.831744015f},
-std::array<float,2>{0.851305723f, 0.462186456f},
-std::array<float,2>{0.462202311f, 0.0648719072f},
-std::array<float,2>{0.688289523f, 0.692500651f},
-std::array<float,2>{0.129547998f, 0.532168388f},
-std::array<float,2>{0.811798811f, 0.236718386f},
-std::array<float,2>{0.401089877f, 0.298331767f},
-std::array<float,2>{0.630614996f, 0.936642349f},
-std::array<float,2>{0.332128882f, 0.780410528f},
-std::array<float,2>{0.592460215f, 0.416317344f},
-std::array<float,2>{0.00030898102f, 0.0499463975f},
-std::array<float,2>{0.988257587f, 0.626071572f},
-std::array<float,2>{0.485643625f, 0.73986876f},
-std::array<float,2>{0.720458448f, 0.0961398259f},
-std::array<float,2>{0.249887004f, 0.491122097f},
-std::array<float,2>{0.836226404f, 0.868422389f},
-std::array<float,2>{0.122791082f, 0.941229463f},
-std::array<float,2>{0.890599847f, 0.340113819f},
-std::array<float,2>{0.312008053f, 0.155766472f},
-std::array<float,2>{0.554101408f, 0.592043519f},
-std::array<float,2>{0.0425246954f, 0.616813302f},
-std::array<float,2>{0.950103343f, 0.184188068f},
-std::array<float,2>{0.351505578f, 0.347272813f},
-std::array<float,2>{0.603869736f, 0.99326992f},
-std::array<float,2>{0.427191436f, 0.838423729f},
-std::array<float,2>{0.682832003f, 0.456952304f},
-std::array<float,2>{0.175877377f, 0.0749360099f},
-std::array<float,2>{0.778147757f, 0.702705443f},
-std::array<float,2>{0.277101398f, 0.657920539f},
-std::array<float,2>{0.520580947f, 0.0262612291f},
-std::array<float,2>{0.0663213506f, 0.404252648f},
-std::array<float,2>{0.931056917f, 0.793409765f},
-std::array<float,2>{0.188076273f, 0.900546432f},
-std::array<float,2>{0.865680695f, 0.257360965f},
-std::array<float,2>{0.438233018f, 0.194287926f},
-std::array<float,2>{0.717647433f, 0.513751566f},
-std::array<float,2>{0.152664945f, 0.746003807f},
-std::array<float,2>{0.78689599f, 0.104210056f},
-std::array<float,2>{0.384370685f, 0.499454826f},
-std::array<float,2>{0.65045315f, 0.863164604f},
-std::array<float,2>{0.326606572f, 0.952991307f},
-std::array<float,2>{0.577892125f, 0.328401625f},
-std::array<float,2>{0.0208939835f, 0.143982768f},
-std::array<float,2>{0.982470512f, 0.582634926f},
-std::array<float,2>{0.475598991f, 0.542583227f},
-std::array<float,2>{0.73904109f, 0.24951309f},
-std::array<float,2>{0.227949739f, 0.307708919f},
-std::array<float,2>{0.821844459f, 0.925293267f},
-std::array<float,2>{0.10681472f, 0.773337364f},
-std::array<float,2>{0.896138012f, 0.413402945f},
-std::array<float,2>{0.284528047f, 0.0569886379f},
-std::array<float,2>{0.540723026f, 0.63491118f},
-std::array<float,2>{0.0914813653f, 0.653250933f},
-std::array<float,2>{0.91876179f, 0.0352078229f},
-std::array<float,2>{0.262497097f, 0.435395896f},
-std::array<float,2>{0.503563285f, 0.757151008f},
-std::array<float,2>{0.465283781f, 0.912625194f},
-std::array<float,2>{0.692629457f, 0.295669675f},
-std::array<float,2>{0.204736024f, 0.224106371f},
-std::array<float,2>{0.845099926f, 0.55166626f},
-std::array<float,2>{0.361769676f, 0.569926977f},
-std::array<float,2>{0.620258629f, 0.138780043f},
-std::array<float,2>{0.055061467f, 0.327423483f},
-std::array<float,2>{0.959707797f, 0.9641366f},
-std::array<float,2>{0.166624457f, 0.851127088f},
-std::array<float,2>{0.762400448f, 0.475935519f},
-std::array<float,2>{0.415586978f, 0.122731641f},
-std::array<float,2>{0.660118163f, 0.732994258f},
-std::array<float,2>{0.243380427f, 0.529430687f},
-std::array<float,2>{0.842716038f, 0.212572753f},
-std::array<float,2>{0.48829475f, 0.270117342f},
-std::array<float,2>{0.726135612f, 0.885679722f},
-std::array<float,2>{0.30847156f, 0.802201986f},
-std::array<float,2>{0.547535837f, 0.38405776f},
-std::array<float,2>{0.118421458f, 0.00727345236f},
-std::array<float,2>{0.884055972f, 0.678872764f},
-std::array<float,2>{0.404816359f, 0.703402877f},
-std::array<float,2>{0.626589775f, 0.0847746059f},
-std::array<float,2>{0.125856072f, 0.451924533f},
-std::array<float,2>{0.806415498f, 0.825383306f},
-std::array<float,2>{0.00728485268f, 0.977994442f},
-std::array<float,2>{0.989903331f, 0.371769398f},
-std::array<float,2>{0.330266744f, 0.16034545f},
-std::array<float,2>{0.589652717f, 0.59672004f},
-std::array<float,2>{0.11491219f, 0.557296813f},
-std::array<float,2>{0.878710389f, 0.230365127f},
-std::array<float,2>{0.300663322f, 0.287999451f},
-std::array<float,2>{0.560702026f, 0.920178413f},
-std::array<float,2>{0.499706835f, 0.757818401f},
-std::array<float,2>{0.732437968f, 0.428518474f},
-std::array<float,2>{0.236169666f, 0.043073684f},
-std::array<float,2>{0.834567845f, 0.646779716f},
-std::array<float,2>{0.340293616f, 0.719463885f},
-std::array<float,2>{0.585235178f, 0.10974054f},
-std::array<float,2>{0.0112863835f, 0.47807464f},
-std::array<float,2>{0.999491632f, 0.855904281f},
-std::array<float,2>{0.136198923f, 0.960092127f},
-std::array<float,2>{0.798372626f, 0.31434375f},
-std::array<float,2>{0.395799309f, 0.130226925f},
-std::array<float,2>{0.633413613f, 0.575853288f},
-std::array<float,2>{0.211745903f, 0.686213076f},
-std::array<float,2>{0.859373093f, 0.0140306456f},
-std::array<float,2>{0.453361839f, 0.381744355f},
-std::array<float,2>{0.701148093f, 0.808792472f},
-std::array<float,2>{0.251092046f, 0.881032228f},
-std::array<float,2>{0.513174653f, 0.276739389f},
-std::array<float,2>{0.0819943324f, 0.21058397f},
-std::array<float,2>{0.910789669f, 0.523292363f},
-std::array<float,2>{0.413542747f, 0.604184926f},
-std::array<float,2>{0.670501947f, 0.165020674f},
-std::array<float,2>{0.157832831f, 0.362478435f},
-std::array<float,2>{0.753532887f, 0.974606276f},
-std::array<float,2>{0.0529295504f, 0.820023239f},
-std::array<float,2>{0.963109612f, 0.443543285f},
-std::array<float,2>{0.36953035f, 0.0874565095f},
-std::array<float,2>{0.614100099f, 0.712928951f},
-std::array<float,2>{0.0272040963f, 0.69004786f},
-std::array<float,2>{0.973276138f, 0.0674314424f},
-std::array<float,2>{0.313132972f, 0.467866629f},
-std::array<float,2>{0.563600063f, 0.834682167f},
-std::array<float,2>{0.378079444f, 0.989812851f},
-std::array<float,2>{0.642669737f, 0.353727371f},
-std::array<float,2>{0.144152477f, 0.178558677f},
-std::array<float,2>{0.794060051f, 0.618625581f},
-std::array<float,2>{0.292336464f, 0.500207901f},
-std::array<float,2>{0.534554183f, 0.196496263f},
-std::array<float,2>{0.0966946632f, 0.258562118f},
-std::array<float,2>{0.905921876f, 0.893475831f},
-std::array<float,2>{0.222555086f, 0.783403933f},
-std::array<float,2>{0.815070152f, 0.397726297f},
-std::array<float,2>{0.483380944f, 0.0224440619f},
-std::array<float,2>{0.746709645f, 0.671315551f},
-std::array<float,2>{0.181873783f, 0.586203456f},
-std::array<float,2>{0.765962005f, 0.151801199f},
-std::array<float,2>{0.430090636f, 0.336389929f},
-std::array<float,2>{0.672365904f, 0.943907201f},
-std::array<float,2>{0.354225516f, 0.871203542f},
-std::array<float,2>{0.597483218f, 0.484934777f},
-std::array<float,2>{0.033355251f, 0.0978427157f},
-std::array<float,2>{0.942686498f, 0.735807836f},
-std::array<float,2>{0.450600564f, 0.62975055f},
-std::array<float,2>{0.707897007f, 0.0540672615f},
-std::array<float,2>{0.202255353f, 0.421737701f},
-std::array<float,2>{0.873109221f, 0.776358306f},
-std::array<float,2>{0.0713919848f, 0.930977285f},
-std::array<float,2>{0.928400755f, 0.302198559f},
-std::array<float,2>{0.269425869f, 0.240096673f},
-std::array<float,2>{0.529380262f, 0.538714409f},
-std::array<float,2>{0.0361072458f, 0.525882304f},
-std::array<float,2>{0.939277172f, 0.216215312f},
-std::array<float,2>{0.356452465f, 0.268402636f},
-std::array<float,2>{0.598143578f, 0.888750553f},
-std::array<float,2>{0.436138541f, 0.799877703f},
-std::array<float,2>{0.678490758f, 0.388749033f},
-std::array<float,2>{0.184980571f, 0.00158317678f},
-std::array<float,2>{0.771577358f, 0.675413549f},
-std::array<float,2>{0.27009514f, 0.709098637f},
-std::array<float,2>{0.526051402f, 0.0802008659f},
-std::array<float,2>{0.0773750171f, 0.447249532f},
-std::array<float,2>{0.924019635f, 0.822093308f},
-std::array<float,2>{0.196002409f, 0.982084274f},
-std::array<float,2>{0.868953824f, 0.369122207f},
-std::array<float,2>{0.447318375f, 0.159010947f},
-std::array<float,2>{0.704986989f, 0.598063707f},
-std::array<float,2>{0.145071864f, 0.650061607f},
-std::array<float,2>{0.790080011f, 0.0324561112f},
-std::array<float,2>{0.38095957f, 0.432598412f},
-std::array<float,2>{0.645730555f, 0.752512217f},
-std::array<float,2>{0.31973955f, 0.909769416f},
-std::array<float,2>{0.569457769f, 0.289330751f},
-std::array<float,2>{0.0294832718f, 0.221469223f},
-std::array<float,2>{0.970644295f, 0.550725877f},
-std::array<float,2>{0.477507651f, 0.563796461f},
-std::array<float,2>{0.745322943f, 0.133731127f},
-std::array<float,2>{0.226469427f, 0.322741687f},
-std::array<float,2>{0.817875087f, 0.965034485f},
-std::array<float,2>{0.0982765928f, 0.846679509f},
-std::array<float,2>{0.90066123f, 0.47243306f},
-std::array<float,2>{0.296154439f, 0.120707527f},
-std::array<float,2>{0.538752079f, 0.730157375f},
-std::array<float,2>{0.0834219903f, 0.747712374f},
-std::array<float,2>{0.909912229f, 0.107512251f},
-std::array<float,2>{0.255994201f, 0.492342919f},
-std::array<float,2>{0.509011626f, 0.864207566f},
-std::array<float,2>{0.459820092f, 0.948937058f},
-std::array<float,2>{0.6991449f, 0.335911065f},
-std::array<float,2>{0.215520114f, 0.14502959f},
-std::array<float,2>{0.851884186f, 0.581234872f},
-std::array<float,2>{0.374286175f, 0.545717478f},
-std::array<float,2>{0.612149894f, 0.24530144f},
-std::array<float,2>{0.0504502207f, 0.309966564f},
-std::array<float,2>{0.96561873f, 0.928671896f},
-std::array<float,2>{0.162190288f, 0.768982112f},
-std::array<float,2>{0.755801141f, 0.407987714f},
-std::array<float,2>{0.407309234f, 0.0621809438f},
-std::array<float,2>{0.666315973f, 0.640269578f},
-std::array<float,2>{0.240466446f, 0.612605631f},
-std::array<float,2>{0.831952274f, 0.180431917f},
-std::array<float,2>{0.493618399f, 0.350870132f},
-std::array<float,2>{0.730312288f, 0.999588192f},
-std::array<float,2>{0.301176786f, 0.841500163f},
-std::array<float,2>{0.558469236f, 0.457397282f},
-std::array<float,2>{0.111230664f, 0.0734384432f},
-std::array<float,2>{0.881168962f, 0.696440637f},
-std::array<float,2>{0.39214474f, 0.662680268f},
-std::array<float,2>{0.639864564f, 0.029499026f},
-std::array<float,2>{0.137182668f, 0.398760736f},
-std::array<float,2>{0.80186671f, 0.790153801f},
-std::array<float,2>{0.0124680782f, 0.904711843f},
-std::array<float,2>{0.99256295f, 0.250345618f},
-std::array<float,2>{0.3382397f, 0.189676315f},
-std::array<float,2>{0.581341028f, 0.509840727f},
-std::array<float,2>{0.124566115f, 0.592926562f},
-std::array<float,2>{0.888229251f, 0.154525161f},
-std::array<float,2>{0.309227079f, 0.34115079f},
-std::array<float,2>{0.550883412f, 0.940067828f},
-std::array<float,2>{0.487080634f, 0.867364466f},
-std::array<float,2>{0.721760631f, 0.49181807f},
-std::array<float,2>{0.247913852f, 0.0969348177f},
-std::array<float,2>{0.838180542f, 0.73850894f},
-std::array<float,2>{0.335380048f, 0.625392497f},
-std::array<float,2>{0.590504587f, 0.0491649844f},
-std::array<float,2>{0.00305067748f, 0.417413533f},
-std::array<float,2>{0.984589934f, 0.779538095f},
-std::array<float,2>{0.132475957f, 0.936350286f},
-std::array<float,2>{0.80983752f, 0.297654778f},
-std::array<float,2>{0.399866104f, 0.23820284f},
-std::array<float,2>{0.632080555f, 0.532807529f},
-std::array<float,2>{0.208051518f, 0.692299426f},
-std::array<float,2>{0.849143505f, 0.0659972727f},
-std::array<float,2>{0.463695616f, 0.461151987f},
-std::array<float,2>{0.689856827f, 0.830561936f},
-std::array<float,2>{0.259106189f, 0.984607041f},
-std::array<float,2>{0.50597024f, 0.355883449f},
-std::array<float,2>{0.0894833505f, 0.172295168f},
-std::array<float,2>{0.915987015f, 0.622685373f},
-std::array<float,2>{0.421078086f, 0.505580485f},
-std::array<float,2>{0.662872016f, 0.201261044f},
-std::array<float,2>{0.168596238f, 0.264151156f},
-std::array<float,2>{0.760153353f, 0.897568345f},
-std::array<float,2>{0.0587497167f, 0.788351655f},
-std::array<float,2>{0.955130219f, 0.394205004f},
-std::array<float,2>{0.366819054f, 0.017009208f},
-std::array<float,2>{0.624424636f, 0.667455316f},
-std::array<float,2>{0.0194347519f, 0.68077898f},
-std::array<float,2>{0.978673756f, 0.00789059233f},
-std::array<float,2>{0.32104978f, 0.378279328f},
-std::array<float,2>{0.570630968f, 0.807632446f},
-std::array<float,2>{0.387731433f, 0.878282189f},
-std::array<float,2>{0.654766381f, 0.281045616f},
-std::array<float,2>{0.152241707f, 0.204745308f},
-std::array<float,2>{0.783156991f, 0.519029975f},
-std::array<float,2>{0.286979944f, 0.605689347f},
-std::array<float,2>{0.544656456f, 0.171119437f},
-std::array<float,2>{0.102886416f, 0.365081221f},
-std::array<float,2>{0.893135309f, 0.971143126f},
-std::array<float,2>{0.232413903f, 0.813436568f},
-std::array<float,2>{0.825551569f, 0.438141674f},
-std::array<float,2>{0.471917361f, 0.090314202f},
-std::array<float,2>{0.735821068f, 0.716675937f},
-std::array<float,2>{0.175609723f, 0.559357941f},
-std::array<float,2>{0.774220467f, 0.23157537f},
-std::array<float,2>{0.423900515f, 0.28482461f},
-std::array<float,2>{0.687239587f, 0.914494634f},
-std::array<float,2>{0.345926732f, 0.763761282f},
-std::array<float,2>{0.607778609f, 0.424474806f},
-std::array<float,2>{0.0464744121f, 0.0412108041f},
-std::array<float,2>{0.945899665f, 0.642616391f},
-std::array<float,2>{0.443711936f, 0.722807586f},
-std::array<float,2>{0.71229738f, 0.114798754f},
-std::array<float,2>{0.192064583f, 0.482148856f},
-std::array<float,2>{0.860123217f, 0.854137003f},
-std::array<float,2>{0.0685444996f, 0.954847574f},
-std::array<float,2>{0.937475204f, 0.317693025f},
-std::array<float,2>{0.280592263f, 0.125571758f},
-std::array<float,2>{0.519243598f, 0.574071825f},
-std::array<float,2>{0.00502149342f, 0.596254528f},
-std::array<float,2>{0.991959631f, 0.161188826f},
-std::array<float,2>{0.329590917f, 0.372165084f},
-std::array<float,2>{0.587102771f, 0.976580203f},
-std::array<float,2>{0.403761983f, 0.824694812f},
-std::array<float,2>{0.628156722f, 0.452348113f},
-std::array<float,2>{0.127418667f, 0.0851157978f},
-std::array<float,2>{0.80718708f, 0.704969585f},
-std::array<float,2>{0.305709213f, 0.67832303f},
-std::array<float,2>{0.549998581f, 0.00652172416f},
-std::array<float,2>{0.120892502f, 0.383720398f},
-std::array<float,2>{0.885644317f, 0.800901473f},
-std::array<float,2>{0.244482145f, 0.886238039f},
-std::array<float,2>{0.841722369f, 0.270801425f},
-std::array<float,2>{0.490570664f, 0.211067751f},
-std::array<float,2>{0.724463105f, 0.530381203f},
-std::array<float,2>{0.164443746f, 0.734131217f},
-std::array<float,2>{0.76377964f, 0.122016191f},
-std::array<float,2>{0.416651338f, 0.47501874f},
-std::array<float,2>{0.657988608f, 0.849975646f},
-std::array<float,2>{0.359692723f, 0.963447809f},
-std::array<float,2>{0.617730856f, 0.327131152f},
-std::array<float,2>{0.0582247153f, 0.140269354f},
-std::array<float,2>{0.957502186f, 0.569119632f},
-std::array<float,2>{0.468447983f, 0.552093685f},
-std::array<float,2>{0.693626404f, 0.222970828f},
-std::array<float,2>{0.205889642f, 0.296129435f},
-std::array<float,2>{0.846891582f, 0.913411558f},
-std::array<float,2>{0.0931341276f, 0.756505966f},
-std::array<float,2>{0.920940638f, 0.433892757f},
-std::array<float,2>{0.263939559f, 0.0371079855f},
-std::array<float,2>{0.500256479f, 0.654199421f},
-std::array<float,2>{0.108348452f, 0.636547089f},
-std::array<float,2>{0.897865117f, 0.0584172979f},
-std::array<float,2>{0.28269732f, 0.412925273f},
-std::array<float,2>{0.541115046f, 0.772157013f},
-std::array<float,2>{0.473812133f, 0.924009025f},
-std::array<float,2>{0.74084425f, 0.307206452f},
-std::array<float,2>{0.22858648f, 0.248951256f},
-std::array<float,2>{0.822787046f, 0.541494071f},
-std::array<float,2>{0.324836135f, 0.583323717f},
-std::array<float,2>{0.575880051f, 0.143163323f},
-std::array<float,2>{0.0227679033f, 0.330067247f},
-std::array<float,2>{0.980855286f, 0.951189458f},
-std::array<float,2>{0.154712632f, 0.861750245f},
-std::array<float,2>{0.788131058f, 0.498117268f},
-std::array<float,2>{0.386401415f, 0.105110958f},
-std::array<float,2>{0.649520934f, 0.744265318f},
-std::array<float,2>{0.189709052f, 0.51533407f},
-std::array<float,2>{0.863702416f, 0.195006683f},
-std::array<float,2>{0.440884709f, 0.256211936f},
-std::array<float,2>{0.715601265f, 0.902290642f},
-std::array<float,2>{0.274072945f, 0.794048429f},
-std::array<float,2>{0.521642506f, 0.402666777f},
-std::array<float,2>{0.0642585307f, 0.0267091505f},
-std::array<float,2>{0.931891561f, 0.656744361f},
-std::array<float,2>{0.429501653f, 0.701563418f},
-std::array<float,2>{0.680490136f, 0.0760397911f},
-std::array<float,2>{0.179407731f, 0.455897212f},
-std::array<float,2>{0.780983627f, 0.839259923f},
-std::array<float,2>{0.0405875519f, 0.992527604f},
-std::array<float,2>{0.951382399f, 0.346044779f},
-std::array<float,2>{0.348762035f, 0.185126409f},
-std::array<float,2>{0.602827549f, 0.615963876f},
-std::array<float,2>{0.0737644807f, 0.537646413f},
-std::array<float,2>{0.926778913f, 0.238748357f},
-std::array<float,2>{0.266643077f, 0.301404655f},
-std::array<float,2>{0.528656602f, 0.930428565f},
-std::array<float,2>{0.451624393f, 0.77696085f},
-std::array<float,2>{0.709587395f, 0.420638055f},
-std::array<float,2>{0.20023863f, 0.0530442186f},
-std::array<float,2>{0.872466862f, 0.630113542f},
-std::array<float,2>{0.35289073f, 0.734698713f},
-std::array<float,2>{0.59484905f, 0.0995053574f},
-std::array<float,2>{0.0320750996f, 0.485368669f},
-std::array<float,2>{0.944795907f, 0.872116387f},
-std::array<float,2>{0.180331901f, 0.944492638f},
-std::array<float,2>{0.767692268f, 0.337108195f},
-std::array<float,2>{0.431696653f, 0.15061152f},
-std::array<float,2>{0.67455399f, 0.587349296f},
-std::array<float,2>{0.220060572f, 0.669944704f},
-std::array<float,2>{0.813404858f, 0.022486208f},
-std::array<float,2>{0.481943876f, 0.397280693f},
-std::array<float,2>{0.749091268f, 0.784753323f},
-std::array<float,2>{0.289198637f, 0.89398998f},
-std::array<float,2>{0.531379044f, 0.259368658f},
-std::array<float,2>{0.0939066708f, 0.196263656f},
-std::array<float,2>{0.90244621f, 0.50188756f},
-std::array<float,2>{0.376464456f, 0.617738843f},
-std::array<float,2>{0.641660452f, 0.179593503f},
-std::array<float,2>{0.141135246f, 0.355215162f},
-std::array<float,2>{0.796125889f, 0.98892957f},
-std::array<float,2>{0.0253519285f, 0.835740864f},
-std::array<float,2>{0.975981772f, 0.467159271f},
-std::array<float,2>{0.315019131f, 0.0671220496f},
-std::array<float,2>{0.565780938f, 0.691172004f},
-std::array<float,2>{0.0519814603f, 0.714800417f},
-std::array<float,2>{0.96202606f, 0.0861158371f},
-std::array<float,2>{0.368222833f, 0.445105463f},
-std::array<float,2>{0.616887212f, 0.819177747f},
-std::array<float,2>{0.410788924f, 0.973591149f},
-std::array<float,2>{0.669509947f, 0.361480981f},
-std::array<float,2>{0.158536643f, 0.165191442f},
-std::array<float,2>{0.75161624f, 0.604837596f},
-std::array<float,2>{0.25237602f, 0.521631837f},
-std::array<float,2>{0.514956295f, 0.209599659f},
-std::array<float,2>{0.0784427971f, 0.275527775f},
-std::array<float,2>{0.912853122f, 0.881892085f},
-std::array<float,2>{0.213881284f, 0.810001135f},
-std::array<float,2>{0.855505884f, 0.382605761f},
-std::array<float,2>{0.456078202f, 0.0146900872f},
-std::array<float,2>{0.701780021f, 0.686686218f},
-std::array<float,2>{0.134606048f, 0.574516177f},
-std::array<float,2>{0.799287438f, 0.129093111f},
-std::array<float,2>{0.397408128f, 0.313350886f},
-std::array<float,2>{0.634788871f, 0.959327996f},
-std::array<float,2>{0.342103332f, 0.85670054f},
-std::array<float,2>{0.582746565f, 0.477179229f},
-std::array<float,2>{0.00933843758f, 0.110737264f},
-std::array<float,2>{0.997857094f, 0.71991992f},
-std::array<float,2>{0.496622473f, 0.64800483f},
-std::array<float,2>{0.731188834f, 0.0445788205f},
-std::array<float,2>{0.23780556f, 0.429238468f},
-std::array<float,2>{0.833046019f, 0.759209991f},
-std::array<float,2>{0.11577367f, 0.920906186f},
-std::array<float,2>{0.875263155f, 0.288131505f},
-std::array<float,2>{0.298387289f, 0.229098022f},
-std::array<float,2>{0.56042546f, 0.557916582f},
-std::array<float,2>{0.0288810506f, 0.547383249f},
-std::array<float,2>{0.972651541f, 0.220410466f},
-std::array<float,2>{0.317387968f, 0.291453183f},
-std::array<float,2>{0.567535758f, 0.907471716f},
-std::array<float,2>{0.379420191f, 0.750075817f},
-std::array<float,2>{0.647224665f, 0.430566132f},
-std::array<float,2>{0.147845268f, 0.0334818736f},
-std::array<float,2>{0.79116106f, 0.650641203f},
-std::array<float,2>{0.294384927f, 0.727212548f},
-std::array<float,2>{0.535574734f, 0.118137397f},
-std::array<float,2>{0.100157537f, 0.469867975f},
-std::array<float,2>{0.89858675f, 0.844700038f},
-std::array<float,2>{0.224484593f, 0.968659282f},
-std::array<float,2>{0.818413317f, 0.320855856f},
-std::array<float,2>{0.479277313f, 0.136117697f},
-std::array<float,2>{0.743512392f, 0.566166699f},
-std::array<float,2>{0.185797229f, 0.672991693f},
-std::array<float,2>{0.769783497f, 0.0030153757f},
-std::array<float,2>{0.434019566f, 0.387239248f},
-std::array<float,2>{0.677401841f, 0.798802733f},
-std::array<float,2>{0.357432932f, 0.887314081f},
-std::array<float,2>{0.601284981f, 0.267055571f},
-std::array<float,2>{0.03900823f, 0.217358306f},
-std::array<float,2>{0.940515459f, 0.524558306f},
-std::array<float,2>{0.445364386f, 0.600389779f},
-std::array<float,2>{0.706514776f, 0.15800038f},
-std::array<float,2>{0.198225275f, 0.370863438f},
-std::array<float,2>{0.86934036f, 0.983506918f},
-std::array<float,2>{0.0753121004f, 0.824140787f},
-std::array<float,2>{0.923808813f, 0.448149651f},
-std::array<float,2>{0.271644115f, 0.079385832f},
-std::array<float,2>{0.525368452f, 0.708721995f},
-std::array<float,2>{0.113113865f, 0.697966278f},
-std::array<float,2>{0.880464971f, 0.0715090185f},
-std::array<float,2>{0.30319941f, 0.459460467f},
-std::array<float,2>{0.555046797f, 0.842891335f},
-std::array<float,2>{0.494169474f, 0.996094584f},
-std::array<float,2>{0.726690233f, 0.348991066f},
-std::array<float,2>{0.239716157f, 0.181685895f},
-std::array<float,2>{0.828241169f, 0.610831499f},
-std::array<float,2>{0.336299658f, 0.508833766f},
-std::array<float,2>{0.578773201f, 0.189159766f},
-std::array<float,2>{0.015431921f, 0.252165943f},
-std::array<float,2>{0.996027529f, 0.903174162f},
-std::array<float,2>{0.139907524f, 0.791427433f},
-std::array<float,2>{0.804212689f, 0.402172327f},
-std::array<float,2>{0.393600047f, 0.0278507173f},
-std::array<float,2>{0.637961507f, 0.660667717f},
-std::array<float,2>{0.218492642f, 0.578283191f},
-std::array<float,2>{0.853913069f, 0.148070931f},
-std::array<float,2>{0.458668411f, 0.333311617f},
-std::array<float,2>{0.695917547f, 0.946467876f},
-std::array<float,2>{0.255842835f, 0.866603374f},
-std::array<float,2>{0.510643661f, 0.494479299f},
-std::array<float,2>{0.0847950876f, 0.106725328f},
-std::array<float,2>{0.907744288f, 0.748097956f},
-std::array<float,2>{0.408748448f, 0.638318956f},
-std::array<float,2>{0.664162874f, 0.0588179529f},
-std::array<float,2>{0.160828188f, 0.41001603f},
-std::array<float,2>{0.757352948f, 0.765739024f},
-std::array<float,2>{0.0471492074f, 0.926777363f},
-std::array<float,2>{0.968645751f, 0.311476827f},
-std::array<float,2>{0.372831434f, 0.243910581f},
-std::array<float,2>{0.609776556f, 0.543451726f},
-std::array<float,2>{0.0873050168f, 0.623190701f},
-std::array<float,2>{0.916460633f, 0.175401509f},
-std::array<float,2>{0.26098749f, 0.357897669f},
-std::array<float,2>{0.505688488f, 0.9882586f},
-std::array<float,2>{0.461675972f, 0.828783095f},
-std::array<float,2>{0.689246893f, 0.464078128f},
-std::array<float,2>{0.209291831f, 0.0627733916f},
-std::array<float,2>{0.850537062f, 0.694287241f},
-std::array<float,2>{0.36447981f, 0.664856493f},
-std::array<float,2>{0.621108115f, 0.0194427259f},
-std::array<float,2>{0.0618365929f, 0.391812503f},
-std::array<float,2>{0.954135001f, 0.786851645f},
-std::array<float,2>{0.171586931f, 0.894638181f},
-std::array<float,2>{0.757874429f, 0.262231827f},
-std::array<float,2>{0.419335157f, 0.200386539f},
-std::array<float,2>{0.6606341f, 0.507420361f},
-std::array<float,2>{0.248938173f, 0.741376996f},
-std::array<float,2>{0.8374331f, 0.094604075f},
-std::array<float,2>{0.485281259f, 0.489413887f},
-std::array<float,2>{0.718821108f, 0.870849669f},
-std::array<float,2>{0.311132163f, 0.938288569f},
-std::array<float,2>{0.553329885f, 0.342521518f},
-std::array<float,2>{0.122015715f, 0.15270035f},
-std::array<float,2>{0.889068246f, 0.591065228f},
-std::array<float,2>{0.401430815f, 0.533667445f},
-std::array<float,2>{0.629036784f, 0.234658584f},
-std::array<float,2>{0.13009353f, 0.299407989f},
-std::array<float,2>{0.810943246f, 0.934135854f},
-std::array<float,2>{0.00117980852f, 0.777767122f},
-std::array<float,2>{0.98673594f, 0.415370613f},
-std::array<float,2>{0.333066046f, 0.0482511185f},
-std::array<float,2>{0.592870831f, 0.627212465f},
-std::array<float,2>{0.0431148708f, 0.641679227f},
-std::array<float,2>{0.94822228f, 0.04029724f},
-std::array<float,2>{0.345325828f, 0.422321439f},
-std::array<float,2>{0.606991231f, 0.762372196f},
-std::array<float,2>{0.423553616f, 0.917129099f},
-std::array<float,2>{0.684119642f, 0.282684177f},
-std::array<float,2>{0.172660053f, 0.234294564f},
-std::array<float,2>{0.776515245f, 0.562355876f},
-std::array<float,2>{0.27785024f, 0.571406603f},
-std::array<float,2>{0.516684353f, 0.127811998f},
-std::array<float,2>{0.0666650236f, 0.319728464f},
-std::array<float,2>{0.933730185f, 0.955312133f},
-std::array<float,2>{0.194810838f, 0.853279829f},
-std::array<float,2>{0.862441123f, 0.483215123f},
-std::array<float,2>{0.442059696f, 0.115974799f},
-std::array<float,2>{0.714158416f, 0.725753963f},
-std::array<float,2>{0.149212196f, 0.516092658f},
-std::array<float,2>{0.784744442f, 0.205258057f},
-std::array<float,2>{0.388914585f, 0.277668059f},
-std::array<float,2>{0.653118134f, 0.87611717f},
-std::array<float,2>{0.323896468f, 0.805780351f},
-std::array<float,2>{0.573816299f, 0.375059336f},
-std::array<float,2>{0.0168327894f, 0.0116589256f},
-std::array<float,2>{0.977058172f, 0.682281375f},
-std::array<float,2>{0.468846172f, 0.717186511f},
-std::array<float,2>{0.737931967f, 0.0936210677f},
-std::array<float,2>{0.233270422f, 0.441157877f},
-std::array<float,2>{0.827994227f, 0.816056907f},
-std::array<float,2>{0.104094341f, 0.970112622f},
-std::array<float,2>{0.890859485f, 0.365985245f},
-std::array<float,2>{0.288802266f, 0.168915182f},
-std::array<float,2>{0.545600355f, 0.608295083f},
-std::array<float,2>{0.0566192977f, 0.568015695f},
-std::array<float,2>{0.960109651f, 0.137644961f},
-std::array<float,2>{0.362332404f, 0.325504839f},
-std::array<float,2>{0.619996548f, 0.961014509f},
-std::array<float,2>{0.415023774f, 0.848652899f},
-std::array<float,2>{0.658632874f, 0.473352015f},
-std::array<float,2>{0.167121276f, 0.124982052f},
-std::array<float,2>{0.763385773f, 0.730489314f},
-std::array<float,2>{0.263197094f, 0.656043887f},
-std::array<float,2>{0.50205934f, 0.0376418754f},
-std::array<float,2>{0.0907214805f, 0.436444134f},
-std::array<float,2>{0.919221282f, 0.754388809f},
-std::array<float,2>{0.203584135f, 0.911426783f},
-std::array<float,2>{0.844715655f, 0.292972326f},
-std::array<float,2>{0.465954959f, 0.225651249f},
-std::array<float,2>{0.692333937f, 0.552844763f},
-std::array<float,2>{0.126036763f, 0.70630157f},
-std::array<float,2>{0.805493832f, 0.083262682f},
-std::array<float,2>{0.405455947f, 0.449469119f},
-std::array<float,2>{0.625531435f, 0.826537728f},
-std::array<float,2>{0.331145287f, 0.979845405f},
-std::array<float,2>{0.588350058f, 0.373590291f},
-std::array<float,2>{0.00624776259f, 0.163395956f},
-std::array<float,2>{0.989236653f, 0.594734728f},
-std::array<float,2>{0.489645541f, 0.527841568f},
-std::array<float,2>{0.725224316f, 0.214155152f},
-std::array<float,2>{0.242248088f, 0.271692812f},
-std::array<float,2>{0.843015015f, 0.884527266f},
-std::array<float,2>{0.117964268f, 0.803851902f},
-std::array<float,2>{0.882944643f, 0.38655144f},
-std::array<float,2>{0.307270736f, 0.00420426764f},
-std::array<float,2>{0.548393428f, 0.677104354f},
-std::array<float,2>{0.0645084083f, 0.658320308f},
-std::array<float,2>{0.930045843f, 0.0234691035f},
-std::array<float,2>{0.275403857f, 0.405801445f},
-std::array<float,2>{0.519655228f, 0.795626104f},
-std::array<float,2>{0.439134479f, 0.89915508f},
-std::array<float,2>{0.718530893f, 0.254072756f},
-std::array<float,2>{0.189180166f, 0.191797078f},
-std::array<float,2>{0.8669101f, 0.513446391f},
-std::array<float,2>{0.349800378f, 0.614514887f},
-std::array<float,2>{0.605152071f, 0.185910732f},
-std::array<float,2>{0.0418261178f, 0.344287634f},
-std::array<float,2>{0.950587869f, 0.995664477f},
-std::array<float,2>{0.177076176f, 0.836702228f},
-std::array<float,2>{0.778440654f, 0.453956574f},
-std::array<float,2>{0.426427275f, 0.0776760876f},
-std::array<float,2>{0.682488561f, 0.700566411f},
-std::array<float,2>{0.226678401f, 0.539160788f},
-std::array<float,2>{0.820510626f, 0.246185124f},
-std::array<float,2>{0.475515336f, 0.306159735f},
-std::array<float,2>{0.740151525f, 0.923180223f},
-std::array<float,2>{0.283626735f, 0.770926595f},
-std::array<float,2>{0.539539218f, 0.41180107f},
-std::array<float,2>{0.106253706f, 0.0557548851f},
-std::array<float,2>{0.894834757f, 0.63451159f},
-std::array<float,2>{0.383539975f, 0.743500412f},
-std::array<float,2>{0.652139723f, 0.102327824f},
-std::array<float,2>{0.153592944f, 0.496263266f},
-std::array<float,2>{0.785881102f, 0.859623253f},
-std::array<float,2>{0.0201786179f, 0.950533271f},
-std::array<float,2>{0.983843982f, 0.330731422f},
-std::array<float,2>{0.327330649f, 0.141149595f},
-std::array<float,2>{0.577134252f, 0.585806727f},
-std::array<float,2>{0.0960000083f, 0.502136946f},
-std::array<float,2>{0.905016959f, 0.19920902f},
-std::array<float,2>{0.291356593f, 0.260849029f},
-std::array<float,2>{0.533690929f, 0.891262233f},
-std::array<float,2>{0.484161556f, 0.781673074f},
-std::array<float,2>{0.747490048f, 0.395507306f},
-std::array<float,2>{0.221512064f, 0.021157397f},
-std::array<float,2>{0.816295683f, 0.668108165f},
-std::array<float,2>{0.313836128f, 0.689216077f},
-std::array<float,2>{0.562556446f, 0.069231987f},
-std::array<float,2>{0.0260996558f, 0.465841532f},
-std::array<float,2>{0.97396332f, 0.833270669f},
-std::array<float,2>{0.14310813f, 0.99050051f},
-std::array<float,2>{0.793752432f, 0.353104323f},
-std::array<float,2>{0.377664089f, 0.176766083f},
-std::array<float,2>{0.644003034f, 0.6208269f},
-std::array<float,2>{0.201925591f, 0.631962001f},
-std::array<float,2>{0.874647856f, 0.0507909693f},
-std::array<float,2>{0.449622422f, 0.41901654f},
-std::array<float,2>{0.708677769f, 0.773655415f},
-std::array<float,2>{0.268507808f, 0.932140052f},
-std::array<float,2>{0.530657649f, 0.303890795f},
-std::array<float,2>{0.0706052035f, 0.241748095f},
-std::array<float,2>{0.928876638f, 0.536450922f},
-std::array<float,2>{0.43109265f, 0.588375986f},
-std::array<float,2>{0.673699319f, 0.149635479f},
-std::array<float,2>{0.182943225f, 0.338824272f},
-std::array<float,2>{0.766677022f, 0.942723155f},
-std::array<float,2>{0.0346548446f, 0.874164879f},
-std::array<float,2>{0.942159534f, 0.486494064f},
-std::array<float,2>{0.35462293f, 0.0997289345f},
-std::array<float,2>{0.596451223f, 0.736711204f},
-std::array<float,2>{0.0101052281f, 0.722355604f},
-std::array<float,2>{0.998522401f, 0.112746671f},
-std::array<float,2>{0.34103471f, 0.479974747f},
-std::array<float,2>{0.58439523f, 0.859145284f},
-std::array<float,2>{0.394827574f, 0.958146513f},
-std::array<float,2>{0.634424508f, 0.31550616f},
-std::array<float,2>{0.135381863f, 0.131385714f},
-std::array<float,2>{0.797485113f, 0.576328754f},
-std::array<float,2>{0.29931432f, 0.555455923f},
-std::array<float,2>{0.56162852f, 0.227027044f},
-std::array<float,2>{0.11399284f, 0.28598091f},
-std::array<float,2>{0.877725363f, 0.919915497f},
-std::array<float,2>{0.234616145f, 0.760874629f},
-std::array<float,2>{0.835766315f, 0.42771706f},
-std::array<float,2>{0.498200208f, 0.0450828224f},
-std::array<float,2>{0.733590722f, 0.645483613f},
-std::array<float,2>{0.157132298f, 0.602993369f},
-std::array<float,2>{0.752154648f, 0.167286694f},
-std::array<float,2>{0.412540972f, 0.359719366f},
-std::array<float,2>{0.671494961f, 0.975923896f},
-std::array<float,2>{0.37040776f, 0.816993654f},
-std::array<float,2>{0.614751697f, 0.442568064f},
-std::array<float,2>{0.0541010089f, 0.0896039456f},
-std::array<float,2>{0.964650691f, 0.712392926f},
-std::array<float,2>{0.455050439f, 0.683750689f},
-std::array<float,2>{0.699821532f, 0.0132359974f},
-std::array<float,2>{0.212254047f, 0.379394084f},
-std::array<float,2>{0.857424974f, 0.812470555f},
-std::array<float,2>{0.0809643343f, 0.87951678f},
-std::array<float,2>{0.911159337f, 0.274990022f},
-std::array<float,2>{0.250659585f, 0.208554313f},
-std::array<float,2>{0.512073994f, 0.519534528f}}
\ No newline at end of file
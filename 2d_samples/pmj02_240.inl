@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.400652826f, 0.372269988f},
-std::array<float,2>{0.629909754f, 0.767201841f},
-std::array<float,2>{0.922666907f, 0.178719491f},
-std::array<float,2>{0.103510343f, 0.552555442f},
-std::array<float,2>{0.18089816f, 0.112682909f},
-std::array<float,2>{0.789957643f, 0.705438912f},
-std::array<float,2>{0.613301337f, 0.414116085f},
-std::array<float,2>{0.296153247f, 0.982830524f},
-std::array<float,2>{0.362564296f, 0.217421919f},
-std::array<float,2>{0.513202786f, 0.610428274f},
-std::array<float,2>{0.823578298f, 0.291956842f},
-std::array<float,2>{0.22247085f, 0.815195918f},
-std::array<float,2>{0.034125559f, 0.46858573f},
-std::array<float,2>{0.951417744f, 0.927726209f},
-std::array<float,2>{0.743974209f, 0.0615025684f},
-std::array<float,2>{0.493671477f, 0.627511621f},
-std::array<float,2>{0.259450525f, 0.391497016f},
-std::array<float,2>{0.568600833f, 0.940507829f},
-std::array<float,2>{0.75796932f, 0.0715135783f},
-std::array<float,2>{0.140014663f, 0.741171837f},
-std::array<float,2>{0.0908978879f, 0.13743563f},
-std::array<float,2>{0.898830116f, 0.523958743f},
-std::array<float,2>{0.666929245f, 0.324361801f},
-std::array<float,2>{0.434773237f, 0.798177302f},
-std::array<float,2>{0.441491693f, 0.0145001691f},
-std::array<float,2>{0.708001137f, 0.661285639f},
-std::array<float,2>{0.975470304f, 0.486719698f},
-std::array<float,2>{0.00532106077f, 0.903358579f},
-std::array<float,2>{0.200879976f, 0.266183972f},
-std::array<float,2>{0.856131852f, 0.854994237f},
-std::array<float,2>{0.551557958f, 0.226860151f},
-std::array<float,2>{0.331317782f, 0.57450819f},
-std::array<float,2>{0.317800015f, 0.296944648f},
-std::array<float,2>{0.539435625f, 0.835440993f},
-std::array<float,2>{0.86424315f, 0.196760803f},
-std::array<float,2>{0.211589471f, 0.608881593f},
-std::array<float,2>{0.0284930356f, 0.0337477401f},
-std::array<float,2>{0.999557137f, 0.641530454f},
-std::array<float,2>{0.688613117f, 0.437682807f},
-std::array<float,2>{0.459362149f, 0.913005173f},
-std::array<float,2>{0.417957574f, 0.162904263f},
-std::array<float,2>{0.679317892f, 0.546239793f},
-std::array<float,2>{0.877267957f, 0.353934109f},
-std::array<float,2>{0.0709911659f, 0.757659137f},
-std::array<float,2>{0.142136917f, 0.425694615f},
-std::array<float,2>{0.774427116f, 0.997989535f},
-std::array<float,2>{0.579684794f, 0.0960044637f},
-std::array<float,2>{0.273541719f, 0.694722652f},
-std::array<float,2>{0.481098086f, 0.483935803f},
-std::array<float,2>{0.733169198f, 0.877907813f},
-std::array<float,2>{0.965776682f, 0.0157127064f},
-std::array<float,2>{0.0501512624f, 0.676423788f},
-std::array<float,2>{0.243178114f, 0.237441674f},
-std::array<float,2>{0.8337906f, 0.584724069f},
-std::array<float,2>{0.528467596f, 0.251276433f},
-std::array<float,2>{0.349654853f, 0.871175289f},
-std::array<float,2>{0.303263813f, 0.0892340243f},
-std::array<float,2>{0.606988907f, 0.73097235f},
-std::array<float,2>{0.807209969f, 0.382442564f},
-std::array<float,2>{0.170274958f, 0.954844356f},
-std::array<float,2>{0.111340269f, 0.329580843f},
-std::array<float,2>{0.916345716f, 0.785910666f},
-std::array<float,2>{0.649784088f, 0.149870127f},
-std::array<float,2>{0.384562582f, 0.50009191f},
-std::array<float,2>{0.464320272f, 0.258378446f},
-std::array<float,2>{0.697138906f, 0.866857946f},
-std::array<float,2>{0.986473858f, 0.24218756f},
-std::array<float,2>{0.0224008318f, 0.588030815f},
-std::array<float,2>{0.206400007f, 0.026051987f},
-std::array<float,2>{0.867457449f, 0.683692992f},
-std::array<float,2>{0.537663758f, 0.47177425f},
-std::array<float,2>{0.327768922f, 0.885684311f},
-std::array<float,2>{0.272332877f, 0.14256236f},
-std::array<float,2>{0.586286545f, 0.510123134f},
-std::array<float,2>{0.768655658f, 0.340026855f},
-std::array<float,2>{0.154082179f, 0.794225693f},
-std::array<float,2>{0.0690175518f, 0.389535815f},
-std::array<float,2>{0.889729917f, 0.968011916f},
-std::array<float,2>{0.682654142f, 0.0853999257f},
-std::array<float,2>{0.409341961f, 0.723829687f},
-std::array<float,2>{0.354700804f, 0.452164412f},
-std::array<float,2>{0.515894771f, 0.918480098f},
-std::array<float,2>{0.840688646f, 0.0450672507f},
-std::array<float,2>{0.235890761f, 0.65162462f},
-std::array<float,2>{0.058358483f, 0.190931365f},
-std::array<float,2>{0.958997071f, 0.595653355f},
-std::array<float,2>{0.721721172f, 0.311110765f},
-std::array<float,2>{0.472816885f, 0.839901447f},
-std::array<float,2>{0.376630783f, 0.107221149f},
-std::array<float,2>{0.647950768f, 0.698297203f},
-std::array<float,2>{0.909905195f, 0.433057457f},
-std::array<float,2>{0.123321354f, 0.98699528f},
-std::array<float,2>{0.158303529f, 0.348710477f},
-std::array<float,2>{0.799163461f, 0.761728883f},
-std::array<float,2>{0.598388374f, 0.171263263f},
-std::array<float,2>{0.307319164f, 0.534005761f},
-std::array<float,2>{0.284833163f, 0.313703239f},
-std::array<float,2>{0.62109226f, 0.812358499f},
-std::array<float,2>{0.785462856f, 0.131951541f},
-std::array<float,2>{0.172516137f, 0.520401537f},
-std::array<float,2>{0.0977919251f, 0.0680734888f},
-std::array<float,2>{0.932394087f, 0.748365581f},
-std::array<float,2>{0.636584461f, 0.402492404f},
-std::array<float,2>{0.390996963f, 0.951953292f},
-std::array<float,2>{0.492122293f, 0.222214252f},
-std::array<float,2>{0.737528682f, 0.565939605f},
-std::array<float,2>{0.939972401f, 0.276264787f},
-std::array<float,2>{0.0405271128f, 0.846587002f},
-std::array<float,2>{0.233332664f, 0.497668564f},
-std::array<float,2>{0.818740129f, 0.897489965f},
-std::array<float,2>{0.50164175f, 0.000616567268f},
-std::array<float,2>{0.371769398f, 0.668355465f},
-std::array<float,2>{0.429554194f, 0.41185832f},
-std::array<float,2>{0.657426417f, 0.969857514f},
-std::array<float,2>{0.896618843f, 0.117505841f},
-std::array<float,2>{0.0824379921f, 0.717216432f},
-std::array<float,2>{0.132481441f, 0.187290356f},
-std::array<float,2>{0.757487655f, 0.562060773f},
-std::array<float,2>{0.576374829f, 0.36046946f},
-std::array<float,2>{0.253905177f, 0.775215209f},
-std::array<float,2>{0.341856122f, 0.0534303226f},
-std::array<float,2>{0.559155285f, 0.634641469f},
-std::array<float,2>{0.846611977f, 0.459602028f},
-std::array<float,2>{0.193857133f, 0.934532225f},
-std::array<float,2>{0.00874748826f, 0.282295436f},
-std::array<float,2>{0.982759655f, 0.824547112f},
-std::array<float,2>{0.715726972f, 0.210267067f},
-std::array<float,2>{0.44946751f, 0.621201575f},
-std::array<float,2>{0.410510898f, 0.294848174f},
-std::array<float,2>{0.686221182f, 0.81952107f},
-std::array<float,2>{0.883790016f, 0.21479623f},
-std::array<float,2>{0.0651134476f, 0.616912544f},
-std::array<float,2>{0.150703371f, 0.0581160784f},
-std::array<float,2>{0.771971345f, 0.631173491f},
-std::array<float,2>{0.591495037f, 0.463077128f},
-std::array<float,2>{0.267774671f, 0.923613429f},
-std::array<float,2>{0.323070109f, 0.171947345f},
-std::array<float,2>{0.531308293f, 0.547124863f},
-std::array<float,2>{0.874133706f, 0.369886041f},
-std::array<float,2>{0.208503664f, 0.772063971f},
-std::array<float,2>{0.0169269368f, 0.419299364f},
-std::array<float,2>{0.988766253f, 0.978663743f},
-std::array<float,2>{0.699256182f, 0.116291076f},
-std::array<float,2>{0.466570407f, 0.710573137f},
-std::array<float,2>{0.312063366f, 0.489888549f},
-std::array<float,2>{0.595422566f, 0.899131477f},
-std::array<float,2>{0.801397502f, 0.0112626003f},
-std::array<float,2>{0.161952749f, 0.658295393f},
-std::array<float,2>{0.120631285f, 0.232796222f},
-std::array<float,2>{0.912669122f, 0.573380291f},
-std::array<float,2>{0.642309487f, 0.273295254f},
-std::array<float,2>{0.379648805f, 0.858570814f},
-std::array<float,2>{0.470870942f, 0.0773165226f},
-std::array<float,2>{0.722736716f, 0.736168027f},
-std::array<float,2>{0.956754565f, 0.394932181f},
-std::array<float,2>{0.0598237365f, 0.942599356f},
-std::array<float,2>{0.240490332f, 0.323893607f},
-std::array<float,2>{0.836975992f, 0.804481208f},
-std::array<float,2>{0.520970583f, 0.133674741f},
-std::array<float,2>{0.359211475f, 0.531204045f},
-std::array<float,2>{0.367571712f, 0.356663257f},
-std::array<float,2>{0.504884779f, 0.752639532f},
-std::array<float,2>{0.815399826f, 0.157748833f},
-std::array<float,2>{0.227877334f, 0.540040672f},
-std::array<float,2>{0.0437274426f, 0.0976608321f},
-std::array<float,2>{0.941503584f, 0.690577567f},
-std::array<float,2>{0.739013135f, 0.429270685f},
-std::array<float,2>{0.485599011f, 0.992456913f},
-std::array<float,2>{0.396553665f, 0.199803472f},
-std::array<float,2>{0.636991143f, 0.604107797f},
-std::array<float,2>{0.936267495f, 0.301420838f},
-std::array<float,2>{0.0947943926f, 0.828142464f},
-std::array<float,2>{0.179324701f, 0.442994654f},
-std::array<float,2>{0.784393251f, 0.909346581f},
-std::array<float,2>{0.621261358f, 0.0351782106f},
-std::array<float,2>{0.288928688f, 0.646340609f},
-std::array<float,2>{0.446789414f, 0.375137866f},
-std::array<float,2>{0.712522805f, 0.95822984f},
-std::array<float,2>{0.978317738f, 0.0937499329f},
-std::array<float,2>{0.0146439029f, 0.72751677f},
-std::array<float,2>{0.187722459f, 0.155177936f},
-std::array<float,2>{0.851212144f, 0.505605519f},
-std::array<float,2>{0.558147609f, 0.333990157f},
-std::array<float,2>{0.339322776f, 0.781953573f},
-std::array<float,2>{0.254427642f, 0.0214098915f},
-std::array<float,2>{0.571359277f, 0.674084365f},
-std::array<float,2>{0.751046896f, 0.479598194f},
-std::array<float,2>{0.126699403f, 0.881222129f},
-std::array<float,2>{0.0810341164f, 0.255831659f},
-std::array<float,2>{0.894526422f, 0.869991779f},
-std::array<float,2>{0.662854195f, 0.239486486f},
-std::array<float,2>{0.421891272f, 0.58056134f},
-std::array<float,2>{0.497163653f, 0.336919576f},
-std::array<float,2>{0.748196721f, 0.792575598f},
-std::array<float,2>{0.946821988f, 0.145845413f},
-std::array<float,2>{0.0388102941f, 0.514749825f},
-std::array<float,2>{0.223240882f, 0.0803671628f},
-std::array<float,2>{0.827367485f, 0.719911158f},
-std::array<float,2>{0.509081483f, 0.386113971f},
-std::array<float,2>{0.366926849f, 0.96470958f},
-std::array<float,2>{0.291370124f, 0.246544585f},
-std::array<float,2>{0.612985671f, 0.590171695f},
-std::array<float,2>{0.796509504f, 0.261945695f},
-std::array<float,2>{0.186119571f, 0.859554291f},
-std::array<float,2>{0.105618179f, 0.474436134f},
-std::array<float,2>{0.928155184f, 0.889945805f},
-std::array<float,2>{0.625796854f, 0.0283870287f},
-std::array<float,2>{0.405231982f, 0.680308223f},
-std::array<float,2>{0.334194392f, 0.434321672f},
-std::array<float,2>{0.548517406f, 0.989761353f},
-std::array<float,2>{0.853486776f, 0.104658388f},
-std::array<float,2>{0.198947832f, 0.700398028f},
-std::array<float,2>{0.00139648584f, 0.16759862f},
-std::array<float,2>{0.969412327f, 0.538241088f},
-std::array<float,2>{0.703682005f, 0.344586283f},
-std::array<float,2>{0.438614339f, 0.759155571f},
-std::array<float,2>{0.430042565f, 0.0418809354f},
-std::array<float,2>{0.668182254f, 0.654164732f},
-std::array<float,2>{0.905382574f, 0.448444098f},
-std::array<float,2>{0.0877220035f, 0.914870381f},
-std::array<float,2>{0.134209529f, 0.305778235f},
-std::array<float,2>{0.762635469f, 0.836250603f},
-std::array<float,2>{0.563853443f, 0.192646414f},
-std::array<float,2>{0.264532745f, 0.597870946f},
-std::array<float,2>{0.279223561f, 0.280452162f},
-std::array<float,2>{0.584949851f, 0.850599468f},
-std::array<float,2>{0.780063152f, 0.22305122f},
-std::array<float,2>{0.146315768f, 0.569909334f},
-std::array<float,2>{0.0767316818f, 0.00661609601f},
-std::array<float,2>{0.881139576f, 0.665569186f},
-std::array<float,2>{0.673476875f, 0.492425889f},
-std::array<float,2>{0.418824792f, 0.891308725f},
-std::array<float,2>{0.456203103f, 0.127448589f},
-std::array<float,2>{0.692444086f, 0.518323958f},
-std::array<float,2>{0.9938097f, 0.320245624f},
-std::array<float,2>{0.0263401307f, 0.805002332f},
-std::array<float,2>{0.217094377f, 0.400108814f},
-std::array<float,2>{0.859537661f, 0.945554793f},
-std::array<float,2>{0.54449755f, 0.0643862113f},
-std::array<float,2>{0.312933475f, 0.742651045f},
-std::array<float,2>{0.386784762f, 0.455651492f},
-std::array<float,2>{0.655422151f, 0.930209816f},
-std::array<float,2>{0.919310749f, 0.048669003f},
-std::array<float,2>{0.11364831f, 0.639115036f},
-std::array<float,2>{0.167697594f, 0.205627799f},
-std::array<float,2>{0.812035799f, 0.617521405f},
-std::array<float,2>{0.602518857f, 0.28774187f},
-std::array<float,2>{0.297445655f, 0.823651433f},
-std::array<float,2>{0.346888095f, 0.122468576f},
-std::array<float,2>{0.525111735f, 0.713488936f},
-std::array<float,2>{0.829252124f, 0.406297982f},
-std::array<float,2>{0.247276112f, 0.973602593f},
-std::array<float,2>{0.0518022291f, 0.365115315f},
-std::array<float,2>{0.962630689f, 0.77803719f},
-std::array<float,2>{0.727692366f, 0.182290927f},
-std::array<float,2>{0.476941645f, 0.555244207f},
-std::array<float,2>{0.437183529f, 0.327409923f},
-std::array<float,2>{0.665745497f, 0.799527824f},
-std::array<float,2>{0.902335286f, 0.139083669f},
-std::array<float,2>{0.0934697911f, 0.52674526f},
-std::array<float,2>{0.138143033f, 0.0724777505f},
-std::array<float,2>{0.760186315f, 0.739129126f},
-std::array<float,2>{0.56677264f, 0.394206971f},
-std::array<float,2>{0.25980404f, 0.938069403f},
-std::array<float,2>{0.329250306f, 0.228545412f},
-std::array<float,2>{0.553176343f, 0.577569664f},
-std::array<float,2>{0.858333588f, 0.26930967f},
-std::array<float,2>{0.201961279f, 0.852972388f},
-std::array<float,2>{0.00728398981f, 0.486141175f},
-std::array<float,2>{0.973192036f, 0.906160533f},
-std::array<float,2>{0.709572911f, 0.0122582195f},
-std::array<float,2>{0.444212914f, 0.663926184f},
-std::array<float,2>{0.294403762f, 0.416881561f},
-std::array<float,2>{0.615390241f, 0.98222369f},
-std::array<float,2>{0.791932702f, 0.110021301f},
-std::array<float,2>{0.183219984f, 0.704996586f},
-std::array<float,2>{0.104283102f, 0.176739708f},
-std::array<float,2>{0.925044239f, 0.554633737f},
-std::array<float,2>{0.632438719f, 0.374242455f},
-std::array<float,2>{0.398446798f, 0.769409716f},
-std::array<float,2>{0.494625211f, 0.0605060123f},
-std::array<float,2>{0.74476248f, 0.625354946f},
-std::array<float,2>{0.94981128f, 0.465430915f},
-std::array<float,2>{0.0315023921f, 0.928567469f},
-std::array<float,2>{0.220105559f, 0.290601909f},
-std::array<float,2>{0.820638716f, 0.813955486f},
-std::array<float,2>{0.514615417f, 0.215385184f},
-std::array<float,2>{0.360778004f, 0.613265753f},
-std::array<float,2>{0.349555552f, 0.253489316f},
-std::array<float,2>{0.530887008f, 0.873837233f},
-std::array<float,2>{0.834086359f, 0.236012295f},
-std::array<float,2>{0.245127216f, 0.583493829f},
-std::array<float,2>{0.0471662208f, 0.0188428611f},
-std::array<float,2>{0.966872692f, 0.679089427f},
-std::array<float,2>{0.731325209f, 0.481677562f},
-std::array<float,2>{0.482991785f, 0.876926839f},
-std::array<float,2>{0.384991288f, 0.15199849f},
-std::array<float,2>{0.650756955f, 0.503730118f},
-std::array<float,2>{0.914354682f, 0.330877453f},
-std::array<float,2>{0.109949417f, 0.787760317f},
-std::array<float,2>{0.168938339f, 0.380501419f},
-std::array<float,2>{0.80571413f, 0.955339432f},
-std::array<float,2>{0.608604968f, 0.0872535706f},
-std::array<float,2>{0.301418751f, 0.733147204f},
-std::array<float,2>{0.457887471f, 0.440934062f},
-std::array<float,2>{0.69043529f, 0.910982072f},
-std::array<float,2>{0.996367514f, 0.0323301591f},
-std::array<float,2>{0.0298162401f, 0.64376688f},
-std::array<float,2>{0.213336483f, 0.19753325f},
-std::array<float,2>{0.865462959f, 0.60714066f},
-std::array<float,2>{0.542106509f, 0.299212366f},
-std::array<float,2>{0.318675578f, 0.832245886f},
-std::array<float,2>{0.276483715f, 0.0943329111f},
-std::array<float,2>{0.580457866f, 0.691960931f},
-std::array<float,2>{0.776977539f, 0.421980083f},
-std::array<float,2>{0.143456325f, 0.999992251f},
-std::array<float,2>{0.0737411827f, 0.352654129f},
-std::array<float,2>{0.876113832f, 0.755654514f},
-std::array<float,2>{0.676050961f, 0.161938921f},
-std::array<float,2>{0.415667892f, 0.54439503f},
-std::array<float,2>{0.475339174f, 0.309872359f},
-std::array<float,2>{0.719833374f, 0.843425214f},
-std::array<float,2>{0.958792984f, 0.189194396f},
-std::array<float,2>{0.0558484495f, 0.596409321f},
-std::array<float,2>{0.237217978f, 0.0436364897f},
-std::array<float,2>{0.843077183f, 0.648558676f},
-std::array<float,2>{0.517992675f, 0.4492338f},
-std::array<float,2>{0.352668375f, 0.920393229f},
-std::array<float,2>{0.306505322f, 0.169273868f},
-std::array<float,2>{0.599984825f, 0.531783342f},
-std::array<float,2>{0.797395051f, 0.349845022f},
-std::array<float,2>{0.157484546f, 0.764546394f},
-std::array<float,2>{0.121567883f, 0.430920392f},
-std::array<float,2>{0.907351077f, 0.986010969f},
-std::array<float,2>{0.645403028f, 0.10878107f},
-std::array<float,2>{0.378753066f, 0.696975529f},
-std::array<float,2>{0.32511273f, 0.46895811f},
-std::array<float,2>{0.536404908f, 0.884320378f},
-std::array<float,2>{0.870332599f, 0.0238565113f},
-std::array<float,2>{0.204121217f, 0.687215984f},
-std::array<float,2>{0.0196858663f, 0.245366722f},
-std::array<float,2>{0.985601664f, 0.587275565f},
-std::array<float,2>{0.697722197f, 0.260468632f},
-std::array<float,2>{0.461034983f, 0.864887178f},
-std::array<float,2>{0.407702148f, 0.0820809826f},
-std::array<float,2>{0.681287169f, 0.726524651f},
-std::array<float,2>{0.887256801f, 0.386737972f},
-std::array<float,2>{0.0681546554f, 0.965740979f},
-std::array<float,2>{0.155216515f, 0.342737228f},
-std::array<float,2>{0.766710103f, 0.795781374f},
-std::array<float,2>{0.589579523f, 0.144069523f},
-std::array<float,2>{0.270361841f, 0.507952332f},
-std::array<float,2>{0.251236707f, 0.36217168f},
-std::array<float,2>{0.57602638f, 0.776314974f},
-std::array<float,2>{0.755701363f, 0.184342727f},
-std::array<float,2>{0.129253328f, 0.55932951f},
-std::array<float,2>{0.0843341351f, 0.120432258f},
-std::array<float,2>{0.896126091f, 0.715671182f},
-std::array<float,2>{0.658979952f, 0.412726611f},
-std::array<float,2>{0.42770952f, 0.971915245f},
-std::array<float,2>{0.452991575f, 0.208785415f},
-std::array<float,2>{0.718071163f, 0.62443912f},
-std::array<float,2>{0.981353939f, 0.283936977f},
-std::array<float,2>{0.011203371f, 0.827907145f},
-std::array<float,2>{0.19245863f, 0.457067817f},
-std::array<float,2>{0.844676375f, 0.937022448f},
-std::array<float,2>{0.560815394f, 0.0518721901f},
-std::array<float,2>{0.340745568f, 0.635064423f},
-std::array<float,2>{0.393747985f, 0.405555755f},
-std::array<float,2>{0.634133995f, 0.950528324f},
-std::array<float,2>{0.931227922f, 0.0693627223f},
-std::array<float,2>{0.100512952f, 0.747164547f},
-std::array<float,2>{0.17500405f, 0.129655704f},
-std::array<float,2>{0.78834182f, 0.523067296f},
-std::array<float,2>{0.618851244f, 0.314746588f},
-std::array<float,2>{0.282319874f, 0.808894277f},
-std::array<float,2>{0.374439269f, 0.00378123904f},
-std::array<float,2>{0.502164364f, 0.670013547f},
-std::array<float,2>{0.817244887f, 0.499478757f},
-std::array<float,2>{0.231915236f, 0.896483779f},
-std::array<float,2>{0.0428491123f, 0.275030136f},
-std::array<float,2>{0.937622905f, 0.844460368f},
-std::array<float,2>{0.735443473f, 0.218992472f},
-std::array<float,2>{0.488285869f, 0.563905537f},
-std::array<float,2>{0.381659776f, 0.270684063f},
-std::array<float,2>{0.643618464f, 0.857253313f},
-std::array<float,2>{0.911205947f, 0.231841862f},
-std::array<float,2>{0.118115239f, 0.572002411f},
-std::array<float,2>{0.163328484f, 0.00821000431f},
-std::array<float,2>{0.803908944f, 0.658025324f},
-std::array<float,2>{0.596000195f, 0.491224796f},
-std::array<float,2>{0.309370369f, 0.902301311f},
-std::array<float,2>{0.356504083f, 0.136184305f},
-std::array<float,2>{0.523202479f, 0.528605759f},
-std::array<float,2>{0.839355707f, 0.32049346f},
-std::array<float,2>{0.238286451f, 0.802493334f},
-std::array<float,2>{0.0612961538f, 0.396640211f},
-std::array<float,2>{0.95467782f, 0.944026887f},
-std::array<float,2>{0.725307167f, 0.0758008659f},
-std::array<float,2>{0.469650477f, 0.737668514f},
-std::array<float,2>{0.265862346f, 0.461301386f},
-std::array<float,2>{0.592284977f, 0.92498982f},
-std::array<float,2>{0.770269811f, 0.055218637f},
-std::array<float,2>{0.149609372f, 0.629950166f},
-std::array<float,2>{0.0642120913f, 0.211636022f},
-std::array<float,2>{0.886538029f, 0.61347723f},
-std::array<float,2>{0.683803022f, 0.296311677f},
-std::array<float,2>{0.413121134f, 0.817047298f},
-std::array<float,2>{0.467962176f, 0.114858888f},
-std::array<float,2>{0.702972293f, 0.707462311f},
-std::array<float,2>{0.991670966f, 0.42164889f},
-std::array<float,2>{0.0194133483f, 0.976709425f},
-std::array<float,2>{0.210555792f, 0.369028389f},
-std::array<float,2>{0.872998655f, 0.771314979f},
-std::array<float,2>{0.534651101f, 0.174283281f},
-std::array<float,2>{0.321990341f, 0.54940933f},
-std::array<float,2>{0.337353408f, 0.332302988f},
-std::array<float,2>{0.555415452f, 0.784329832f},
-std::array<float,2>{0.848297834f, 0.153562263f},
-std::array<float,2>{0.191056117f, 0.506781459f},
-std::array<float,2>{0.0128076579f, 0.0917753577f},
-std::array<float,2>{0.979960382f, 0.730381012f},
-std::array<float,2>{0.71333164f, 0.378171057f},
-std::array<float,2>{0.448775619f, 0.960717082f},
-std::array<float,2>{0.424836397f, 0.241935015f},
-std::array<float,2>{0.661455333f, 0.578511178f},
-std::array<float,2>{0.891758919f, 0.255862474f},
-std::array<float,2>{0.0785337463f, 0.868400991f},
-std::array<float,2>{0.128520384f, 0.477202803f},
-std::array<float,2>{0.75234735f, 0.880773842f},
-std::array<float,2>{0.572767854f, 0.022423638f},
-std::array<float,2>{0.256943285f, 0.672057927f},
-std::array<float,2>{0.486567318f, 0.427607298f},
-std::array<float,2>{0.741101384f, 0.994956613f},
-std::array<float,2>{0.945114434f, 0.101411715f},
-std::array<float,2>{0.0456119031f, 0.689361751f},
-std::array<float,2>{0.229032889f, 0.159476519f},
-std::array<float,2>{0.814327359f, 0.542939901f},
-std::array<float,2>{0.507077754f, 0.358198792f},
-std::array<float,2>{0.36980629f, 0.75145179f},
-std::array<float,2>{0.285790473f, 0.0372852944f},
-std::array<float,2>{0.623745441f, 0.646655381f},
-std::array<float,2>{0.782546222f, 0.444860131f},
-std::array<float,2>{0.176376283f, 0.907692909f},
-std::array<float,2>{0.0967039764f, 0.303990513f},
-std::array<float,2>{0.935051024f, 0.831062794f},
-std::array<float,2>{0.639991105f, 0.201382726f},
-std::array<float,2>{0.394699752f, 0.60172689f},
-std::array<float,2>{0.43953687f, 0.345891327f},
-std::array<float,2>{0.706215441f, 0.760608673f},
-std::array<float,2>{0.971954286f, 0.16538015f},
-std::array<float,2>{0.00203194679f, 0.536126614f},
-std::array<float,2>{0.197092593f, 0.102177106f},
-std::array<float,2>{0.854124963f, 0.703053057f},
-std::array<float,2>{0.550095677f, 0.436570466f},
-std::array<float,2>{0.333252013f, 0.990618348f},
-std::array<float,2>{0.262078643f, 0.195123613f},
-std::array<float,2>{0.565744579f, 0.599701405f},
-std::array<float,2>{0.765588999f, 0.307412714f},
-std::array<float,2>{0.135275155f, 0.839596272f},
-std::array<float,2>{0.0891102776f, 0.44685182f},
-std::array<float,2>{0.903773129f, 0.917257667f},
-std::array<float,2>{0.671464682f, 0.0404548049f},
-std::array<float,2>{0.433546871f, 0.654699504f},
-std::array<float,2>{0.363642424f, 0.383424282f},
-std::array<float,2>{0.51067853f, 0.961979449f},
-std::array<float,2>{0.825266898f, 0.0789759755f},
-std::array<float,2>{0.22473231f, 0.722233891f},
-std::array<float,2>{0.0367522426f, 0.148155168f},
-std::array<float,2>{0.949157298f, 0.513393104f},
-std::array<float,2>{0.746879935f, 0.338796318f},
-std::array<float,2>{0.498546571f, 0.791011512f},
-std::array<float,2>{0.402494997f, 0.0293308608f},
-std::array<float,2>{0.626978219f, 0.68226558f},
-std::array<float,2>{0.927267849f, 0.475600153f},
-std::array<float,2>{0.108265087f, 0.888491869f},
-std::array<float,2>{0.18443884f, 0.264627993f},
-std::array<float,2>{0.794033229f, 0.861629903f},
-std::array<float,2>{0.611297488f, 0.248958588f},
-std::array<float,2>{0.289815426f, 0.592386782f},
-std::array<float,2>{0.300593317f, 0.286112785f},
-std::array<float,2>{0.604260385f, 0.821223319f},
-std::array<float,2>{0.809824109f, 0.204410762f},
-std::array<float,2>{0.165049225f, 0.620584846f},
-std::array<float,2>{0.115314662f, 0.0506848954f},
-std::array<float,2>{0.921403348f, 0.637316644f},
-std::array<float,2>{0.652699828f, 0.454030663f},
-std::array<float,2>{0.389708638f, 0.932642937f},
-std::array<float,2>{0.479168832f, 0.180256933f},
-std::array<float,2>{0.730405986f, 0.557378471f},
-std::array<float,2>{0.964834094f, 0.366049558f},
-std::array<float,2>{0.0532350056f, 0.780721903f},
-std::array<float,2>{0.248516411f, 0.409935504f},
-std::array<float,2>{0.831858218f, 0.975732684f},
-std::array<float,2>{0.526739717f, 0.12479157f},
-std::array<float,2>{0.344554067f, 0.711766481f},
-std::array<float,2>{0.421217471f, 0.494169921f},
-std::array<float,2>{0.675288022f, 0.894490957f},
-std::array<float,2>{0.880286932f, 0.00418726867f},
-std::array<float,2>{0.0756865665f, 0.667791069f},
-std::array<float,2>{0.1468205f, 0.225522995f},
-std::array<float,2>{0.778811872f, 0.567705929f},
-std::array<float,2>{0.58284831f, 0.278021544f},
-std::array<float,2>{0.279515475f, 0.848361731f},
-std::array<float,2>{0.315376997f, 0.0649334118f},
-std::array<float,2>{0.545131981f, 0.744197071f},
-std::array<float,2>{0.863076389f, 0.402092993f},
-std::array<float,2>{0.216580525f, 0.949051023f},
-std::array<float,2>{0.0239681974f, 0.316506892f},
-std::array<float,2>{0.995775759f, 0.807480395f},
-std::array<float,2>{0.694886982f, 0.126351476f},
-std::array<float,2>{0.4538638f, 0.516666293f},
-std::array<float,2>{0.414684057f, 0.355101198f},
-std::array<float,2>{0.677207351f, 0.756170809f},
-std::array<float,2>{0.875441313f, 0.163724482f},
-std::array<float,2>{0.0723830089f, 0.545406222f},
-std::array<float,2>{0.143890679f, 0.0970053971f},
-std::array<float,2>{0.775876164f, 0.693956971f},
-std::array<float,2>{0.581394255f, 0.423998266f},
-std::array<float,2>{0.276034087f, 0.996783733f},
-std::array<float,2>{0.319711745f, 0.196079701f},
-std::array<float,2>{0.541534364f, 0.608244061f},
-std::array<float,2>{0.866229713f, 0.29828763f},
-std::array<float,2>{0.214388251f, 0.834655046f},
-std::array<float,2>{0.0306178071f, 0.439279556f},
-std::array<float,2>{0.997144103f, 0.913721979f},
-std::array<float,2>{0.689722002f, 0.0347818322f},
-std::array<float,2>{0.45837453f, 0.642336488f},
-std::array<float,2>{0.30260998f, 0.381776571f},
-std::array<float,2>{0.607610345f, 0.953715146f},
-std::array<float,2>{0.805433869f, 0.0888605863f},
-std::array<float,2>{0.169065267f, 0.73213017f},
-std::array<float,2>{0.110568449f, 0.148966759f},
-std::array<float,2>{0.915718853f, 0.501446128f},
-std::array<float,2>{0.65228498f, 0.328257203f},
-std::array<float,2>{0.386674225f, 0.786401272f},
-std::array<float,2>{0.483530104f, 0.0172701776f},
-std::array<float,2>{0.732035458f, 0.67745626f},
-std::array<float,2>{0.968066633f, 0.483152121f},
-std::array<float,2>{0.0486190468f, 0.878549039f},
-std::array<float,2>{0.244624138f, 0.250697404f},
-std::array<float,2>{0.835600555f, 0.87288779f},
-std::array<float,2>{0.529545426f, 0.23675172f},
-std::array<float,2>{0.347969264f, 0.585551202f},
-std::array<float,2>{0.359602034f, 0.292691261f},
-std::array<float,2>{0.515213549f, 0.81623286f},
-std::array<float,2>{0.821903884f, 0.218482167f},
-std::array<float,2>{0.219010696f, 0.610049427f},
-std::array<float,2>{0.03275102f, 0.0619083233f},
-std::array<float,2>{0.950619698f, 0.62816292f},
-std::array<float,2>{0.745566189f, 0.467358023f},
-std::array<float,2>{0.495416105f, 0.926324546f},
-std::array<float,2>{0.399775475f, 0.178498119f},
-std::array<float,2>{0.631810129f, 0.551296115f},
-std::array<float,2>{0.924549341f, 0.371592551f},
-std::array<float,2>{0.105100125f, 0.765793502f},
-std::array<float,2>{0.181926742f, 0.415074229f},
-std::array<float,2>{0.79291296f, 0.983563662f},
-std::array<float,2>{0.616249204f, 0.111676998f},
-std::array<float,2>{0.293090194f, 0.70637387f},
-std::array<float,2>{0.444750905f, 0.487689346f},
-std::array<float,2>{0.710609376f, 0.903127551f},
-std::array<float,2>{0.973856509f, 0.0148737691f},
-std::array<float,2>{0.00626139995f, 0.66058749f},
-std::array<float,2>{0.202696547f, 0.22770384f},
-std::array<float,2>{0.858564496f, 0.575478017f},
-std::array<float,2>{0.554391146f, 0.26666823f},
-std::array<float,2>{0.328415275f, 0.853778064f},
-std::array<float,2>{0.26148963f, 0.0706755593f},
-std::array<float,2>{0.567916036f, 0.741892397f},
-std::array<float,2>{0.76086098f, 0.392312288f},
-std::array<float,2>{0.137183979f, 0.939735413f},
-std::array<float,2>{0.0922157764f, 0.326164693f},
-std::array<float,2>{0.900604486f, 0.796952844f},
-std::array<float,2>{0.664845705f, 0.138245985f},
-std::array<float,2>{0.436327815f, 0.524454892f},
-std::array<float,2>{0.48973158f, 0.277084231f},
-std::array<float,2>{0.734945357f, 0.846737504f},
-std::array<float,2>{0.938687027f, 0.220737576f},
-std::array<float,2>{0.0410579443f, 0.564710259f},
-std::array<float,2>{0.231255919f, 0.00155408727f},
-std::array<float,2>{0.818115294f, 0.669371367f},
-std::array<float,2>{0.503417015f, 0.496186525f},
-std::array<float,2>{0.373716533f, 0.897034407f},
-std::array<float,2>{0.282128841f, 0.131132245f},
-std::array<float,2>{0.617719948f, 0.521060705f},
-std::array<float,2>{0.787868559f, 0.313303083f},
-std::array<float,2>{0.174773753f, 0.811321378f},
-std::array<float,2>{0.101358816f, 0.403769672f},
-std::array<float,2>{0.929690361f, 0.953117967f},
-std::array<float,2>{0.633227289f, 0.0666597337f},
-std::array<float,2>{0.392653197f, 0.749499142f},
-std::array<float,2>{0.341694087f, 0.459969699f},
-std::array<float,2>{0.562492847f, 0.935419679f},
-std::array<float,2>{0.845141768f, 0.0544693433f},
-std::array<float,2>{0.191599935f, 0.633687198f},
-std::array<float,2>{0.0103570819f, 0.209332541f},
-std::array<float,2>{0.98217535f, 0.622473776f},
-std::array<float,2>{0.71726191f, 0.282170504f},
-std::array<float,2>{0.451249719f, 0.825563073f},
-std::array<float,2>{0.426226199f, 0.118207097f},
-std::array<float,2>{0.659952641f, 0.718573093f},
-std::array<float,2>{0.894879282f, 0.410378009f},
-std::array<float,2>{0.0851802379f, 0.969358385f},
-std::array<float,2>{0.129885927f, 0.359857351f},
-std::array<float,2>{0.754096508f, 0.774361491f},
-std::array<float,2>{0.575087428f, 0.186135143f},
-std::array<float,2>{0.250251323f, 0.561189771f},
-std::array<float,2>{0.270659953f, 0.341232985f},
-std::array<float,2>{0.588468492f, 0.793496847f},
-std::array<float,2>{0.766466141f, 0.141310498f},
-std::array<float,2>{0.155903816f, 0.51154238f},
-std::array<float,2>{0.0670847371f, 0.0844994858f},
-std::array<float,2>{0.8885656f, 0.722678244f},
-std::array<float,2>{0.680572033f, 0.38989827f},
-std::array<float,2>{0.406998783f, 0.967318535f},
-std::array<float,2>{0.462062448f, 0.244010299f},
-std::array<float,2>{0.699216485f, 0.589517236f},
-std::array<float,2>{0.984966934f, 0.259730309f},
-std::array<float,2>{0.0214506164f, 0.865311146f},
-std::array<float,2>{0.203827083f, 0.471485108f},
-std::array<float,2>{0.869555831f, 0.885889769f},
-std::array<float,2>{0.535796344f, 0.0269520395f},
-std::array<float,2>{0.32537055f, 0.685033143f},
-std::array<float,2>{0.377592534f, 0.43253395f},
-std::array<float,2>{0.646051884f, 0.988117039f},
-std::array<float,2>{0.906330824f, 0.105710655f},
-std::array<float,2>{0.122766405f, 0.698084116f},
-std::array<float,2>{0.156827942f, 0.170520082f},
-std::array<float,2>{0.797866344f, 0.534956217f},
-std::array<float,2>{0.601181388f, 0.347980678f},
-std::array<float,2>{0.305599093f, 0.762990892f},
-std::array<float,2>{0.351841331f, 0.0463200994f},
-std::array<float,2>{0.519192636f, 0.651136041f},
-std::array<float,2>{0.842655838f, 0.452058196f},
-std::array<float,2>{0.237985954f, 0.9195472f},
-std::array<float,2>{0.0555285551f, 0.312354356f},
-std::array<float,2>{0.957052946f, 0.840883732f},
-std::array<float,2>{0.719390094f, 0.189848423f},
-std::array<float,2>{0.476346135f, 0.594403744f},
-std::array<float,2>{0.396140844f, 0.302177548f},
-std::array<float,2>{0.638916671f, 0.829458237f},
-std::array<float,2>{0.933999777f, 0.200832546f},
-std::array<float,2>{0.0965051875f, 0.605094671f},
-std::array<float,2>{0.176933214f, 0.0367188454f},
-std::array<float,2>{0.781747043f, 0.644670606f},
-std::array<float,2>{0.624492049f, 0.441641748f},
-std::array<float,2>{0.286637664f, 0.908424914f},
-std::array<float,2>{0.370393306f, 0.157033265f},
-std::array<float,2>{0.50586313f, 0.539635301f},
-std::array<float,2>{0.812882304f, 0.356441677f},
-std::array<float,2>{0.230249196f, 0.753473699f},
-std::array<float,2>{0.0465086363f, 0.42785871f},
-std::array<float,2>{0.94410491f, 0.99352324f},
-std::array<float,2>{0.741895974f, 0.0992768034f},
-std::array<float,2>{0.487836838f, 0.689989448f},
-std::array<float,2>{0.256696165f, 0.479122162f},
-std::array<float,2>{0.573516548f, 0.882249415f},
-std::array<float,2>{0.753451943f, 0.0202655494f},
-std::array<float,2>{0.126989529f, 0.674845159f},
-std::array<float,2>{0.0797429234f, 0.23883301f},
-std::array<float,2>{0.891222298f, 0.581613362f},
-std::array<float,2>{0.660666108f, 0.254060298f},
-std::array<float,2>{0.424385309f, 0.870244741f},
-std::array<float,2>{0.447404891f, 0.0918520465f},
-std::array<float,2>{0.714554429f, 0.727855265f},
-std::array<float,2>{0.978634238f, 0.376232207f},
-std::array<float,2>{0.0118699064f, 0.957526386f},
-std::array<float,2>{0.189684182f, 0.335128218f},
-std::array<float,2>{0.849341512f, 0.782246232f},
-std::array<float,2>{0.555906653f, 0.15579623f},
-std::array<float,2>{0.336596698f, 0.504164577f},
-std::array<float,2>{0.320911258f, 0.370207429f},
-std::array<float,2>{0.533388853f, 0.773365915f},
-std::array<float,2>{0.871675313f, 0.173807919f},
-std::array<float,2>{0.209465966f, 0.547920883f},
-std::array<float,2>{0.0182513315f, 0.116144419f},
-std::array<float,2>{0.990282059f, 0.709388435f},
-std::array<float,2>{0.701454878f, 0.418067276f},
-std::array<float,2>{0.467644393f, 0.979937315f},
-std::array<float,2>{0.41257599f, 0.213748381f},
-std::array<float,2>{0.68503654f, 0.616060138f},
-std::array<float,2>{0.885039926f, 0.293536514f},
-std::array<float,2>{0.0632590652f, 0.819167972f},
-std::array<float,2>{0.149107262f, 0.464709491f},
-std::array<float,2>{0.771401465f, 0.922417283f},
-std::array<float,2>{0.592801452f, 0.0568521693f},
-std::array<float,2>{0.266908377f, 0.632472396f},
-std::array<float,2>{0.470574677f, 0.396297753f},
-std::array<float,2>{0.726446569f, 0.941553056f},
-std::array<float,2>{0.953883529f, 0.0763031915f},
-std::array<float,2>{0.0616179444f, 0.735111117f},
-std::array<float,2>{0.239945814f, 0.134567097f},
-std::array<float,2>{0.838385403f, 0.530065894f},
-std::array<float,2>{0.521880269f, 0.32322529f},
-std::array<float,2>{0.355538815f, 0.802941322f},
-std::array<float,2>{0.310142159f, 0.0100369649f},
-std::array<float,2>{0.597113371f, 0.659466743f},
-std::array<float,2>{0.803150177f, 0.488565743f},
-std::array<float,2>{0.16307418f, 0.899794579f},
-std::array<float,2>{0.119113773f, 0.271882474f},
-std::array<float,2>{0.910321176f, 0.857815385f},
-std::array<float,2>{0.642720878f, 0.234060869f},
-std::array<float,2>{0.382254571f, 0.573102891f},
-std::array<float,2>{0.454528511f, 0.318534583f},
-std::array<float,2>{0.693441093f, 0.80625701f},
-std::array<float,2>{0.994831622f, 0.128204182f},
-std::array<float,2>{0.025057612f, 0.519260049f},
-std::array<float,2>{0.215704188f, 0.0630678311f},
-std::array<float,2>{0.86213851f, 0.743311167f},
-std::array<float,2>{0.546347797f, 0.398494095f},
-std::array<float,2>{0.316076875f, 0.947258651f},
-std::array<float,2>{0.280444145f, 0.223990068f},
-std::array<float,2>{0.583301544f, 0.56893152f},
-std::array<float,2>{0.777834177f, 0.280013561f},
-std::array<float,2>{0.148359075f, 0.850358725f},
-std::array<float,2>{0.07507056f, 0.493879706f},
-std::array<float,2>{0.879368901f, 0.892062128f},
-std::array<float,2>{0.674164057f, 0.00702267f},
-std::array<float,2>{0.420121163f, 0.664885938f},
-std::array<float,2>{0.345264047f, 0.407841533f},
-std::array<float,2>{0.526168287f, 0.974550664f},
-std::array<float,2>{0.830747008f, 0.121411145f},
-std::array<float,2>{0.249245256f, 0.714347661f},
-std::array<float,2>{0.0538465045f, 0.182719216f},
-std::array<float,2>{0.963336408f, 0.556080818f},
-std::array<float,2>{0.728805065f, 0.36337021f},
-std::array<float,2>{0.479595304f, 0.778587222f},
-std::array<float,2>{0.389005005f, 0.0470132716f},
-std::array<float,2>{0.653671324f, 0.640340269f},
-std::array<float,2>{0.920395374f, 0.456411988f},
-std::array<float,2>{0.116381504f, 0.931637108f},
-std::array<float,2>{0.164089367f, 0.288499385f},
-std::array<float,2>{0.808932722f, 0.822595716f},
-std::array<float,2>{0.60519886f, 0.206378743f},
-std::array<float,2>{0.299674213f, 0.618779302f},
-std::array<float,2>{0.290617287f, 0.262837589f},
-std::array<float,2>{0.610319495f, 0.860644519f},
-std::array<float,2>{0.793294311f, 0.247307286f},
-std::array<float,2>{0.184617892f, 0.591264725f},
-std::array<float,2>{0.10864599f, 0.0280723087f},
-std::array<float,2>{0.92655021f, 0.681245089f},
-std::array<float,2>{0.628234029f, 0.472803146f},
-std::array<float,2>{0.404038966f, 0.888925493f},
-std::array<float,2>{0.49909851f, 0.145405963f},
-std::array<float,2>{0.747847021f, 0.513952017f},
-std::array<float,2>{0.947830021f, 0.336133808f},
-std::array<float,2>{0.0352767333f, 0.791638732f},
-std::array<float,2>{0.226193696f, 0.384791434f},
-std::array<float,2>{0.825166464f, 0.96359098f},
-std::array<float,2>{0.511152148f, 0.0815330148f},
-std::array<float,2>{0.365104258f, 0.718833625f},
-std::array<float,2>{0.432069898f, 0.448069841f},
-std::array<float,2>{0.670741737f, 0.915523469f},
-std::array<float,2>{0.902901769f, 0.0424712226f},
-std::array<float,2>{0.0885627195f, 0.653016627f},
-std::array<float,2>{0.13594611f, 0.192219079f},
-std::array<float,2>{0.763713717f, 0.599025607f},
-std::array<float,2>{0.565027952f, 0.305531681f},
-std::array<float,2>{0.263156682f, 0.837679803f},
-std::array<float,2>{0.332327753f, 0.103880145f},
-std::array<float,2>{0.549191475f, 0.700052023f},
-std::array<float,2>{0.855416358f, 0.4355281f},
-std::array<float,2>{0.196068317f, 0.988598406f},
-std::array<float,2>{0.00328607089f, 0.345495224f},
-std::array<float,2>{0.971314132f, 0.758215845f},
-std::array<float,2>{0.70531863f, 0.166905999f},
-std::array<float,2>{0.440856338f, 0.537226617f},
-std::array<float,2>{0.382911593f, 0.331274658f},
-std::array<float,2>{0.649397969f, 0.788823128f},
-std::array<float,2>{0.917898297f, 0.150421247f},
-std::array<float,2>{0.11242941f, 0.50233537f},
-std::array<float,2>{0.171164855f, 0.0862067193f},
-std::array<float,2>{0.808308184f, 0.733606815f},
-std::array<float,2>{0.605969667f, 0.37978816f},
-std::array<float,2>{0.304457426f, 0.956319332f},
-std::array<float,2>{0.350744188f, 0.234757245f},
-std::array<float,2>{0.527531207f, 0.582814693f},
-std::array<float,2>{0.832399547f, 0.252610385f},
-std::array<float,2>{0.242505208f, 0.874695003f},
-std::array<float,2>{0.0496589392f, 0.480757087f},
-std::array<float,2>{0.966434121f, 0.875383317f},
-std::array<float,2>{0.733708441f, 0.0184774604f},
-std::array<float,2>{0.481911361f, 0.677737772f},
-std::array<float,2>{0.274959147f, 0.42369625f},
-std::array<float,2>{0.578696311f, 0.998791993f},
-std::array<float,2>{0.774111092f, 0.0955987796f},
-std::array<float,2>{0.141515061f, 0.692790627f},
-std::array<float,2>{0.0718517974f, 0.160241827f},
-std::array<float,2>{0.878576517f, 0.543204069f},
-std::array<float,2>{0.677981436f, 0.352064818f},
-std::array<float,2>{0.416089773f, 0.754158139f},
-std::array<float,2>{0.460872054f, 0.0312545896f},
-std::array<float,2>{0.688142657f, 0.643369973f},
-std::array<float,2>{0.998658359f, 0.440240085f},
-std::array<float,2>{0.0276921373f, 0.911664963f},
-std::array<float,2>{0.212824479f, 0.300413162f},
-std::array<float,2>{0.864503145f, 0.833080232f},
-std::array<float,2>{0.541009784f, 0.19900094f},
-std::array<float,2>{0.317266464f, 0.606188357f},
-std::array<float,2>{0.330180883f, 0.267805845f},
-std::array<float,2>{0.552689731f, 0.852070808f},
-std::array<float,2>{0.857400596f, 0.230325848f},
-std::array<float,2>{0.200191081f, 0.577023387f},
-std::array<float,2>{0.004583898f, 0.0132721635f},
-std::array<float,2>{0.975668788f, 0.662494123f},
-std::array<float,2>{0.708137214f, 0.484589756f},
-std::array<float,2>{0.44292587f, 0.905140936f},
-std::array<float,2>{0.433974743f, 0.139669806f},
-std::array<float,2>{0.667346954f, 0.526259601f},
-std::array<float,2>{0.900008023f, 0.326875597f},
-std::array<float,2>{0.0907049105f, 0.800168157f},
-std::array<float,2>{0.139189199f, 0.393031031f},
-std::array<float,2>{0.759512544f, 0.938960552f},
-std::array<float,2>{0.569895446f, 0.0733400807f},
-std::array<float,2>{0.258688539f, 0.739309311f},
-std::array<float,2>{0.493115932f, 0.466112375f},
-std::array<float,2>{0.742568552f, 0.928742588f},
-std::array<float,2>{0.952291429f, 0.0587920099f},
-std::array<float,2>{0.0346357152f, 0.626332343f},
-std::array<float,2>{0.22126101f, 0.216185182f},
-std::array<float,2>{0.822609127f, 0.611470461f},
-std::array<float,2>{0.512523472f, 0.28944394f},
-std::array<float,2>{0.36139226f, 0.813370168f},
-std::array<float,2>{0.29543677f, 0.110997267f},
-std::array<float,2>{0.614840269f, 0.703933477f},
-std::array<float,2>{0.790079832f, 0.417265564f},
-std::array<float,2>{0.180168673f, 0.980580688f},
-std::array<float,2>{0.102050617f, 0.373871952f},
-std::array<float,2>{0.923801541f, 0.767989099f},
-std::array<float,2>{0.629588783f, 0.177711681f},
-std::array<float,2>{0.402028263f, 0.553472221f},
-std::array<float,2>{0.450639516f, 0.28479895f},
-std::array<float,2>{0.716339231f, 0.826220274f},
-std::array<float,2>{0.984240353f, 0.207120925f},
-std::array<float,2>{0.00970665831f, 0.623833418f},
-std::array<float,2>{0.194981679f, 0.0516077094f},
-std::array<float,2>{0.847594678f, 0.636420012f},
-std::array<float,2>{0.559924424f, 0.458830088f},
-std::array<float,2>{0.343009293f, 0.936037183f},
-std::array<float,2>{0.252822042f, 0.185426369f},
-std::array<float,2>{0.577586353f, 0.560150743f},
-std::array<float,2>{0.756124198f, 0.36280781f},
-std::array<float,2>{0.130946547f, 0.777242959f},
-std::array<float,2>{0.0833280459f, 0.413417339f},
-std::array<float,2>{0.897564411f, 0.971435606f},
-std::array<float,2>{0.657137513f, 0.11984545f},
-std::array<float,2>{0.427908868f, 0.716412008f},
-std::array<float,2>{0.372483283f, 0.498281509f},
-std::array<float,2>{0.500723898f, 0.894542217f},
-std::array<float,2>{0.819423556f, 0.00203016447f},
-std::array<float,2>{0.234115735f, 0.671385825f},
-std::array<float,2>{0.0393472575f, 0.220089659f},
-std::array<float,2>{0.94052726f, 0.562624812f},
-std::array<float,2>{0.736906111f, 0.273930699f},
-std::array<float,2>{0.491080552f, 0.844944239f},
-std::array<float,2>{0.392316937f, 0.068392612f},
-std::array<float,2>{0.635515869f, 0.746949255f},
-std::array<float,2>{0.933132112f, 0.405190557f},
-std::array<float,2>{0.099546209f, 0.949893296f},
-std::array<float,2>{0.173466086f, 0.315721661f},
-std::array<float,2>{0.786644876f, 0.810546279f},
-std::array<float,2>{0.61976707f, 0.130028665f},
-std::array<float,2>{0.283620298f, 0.521841884f},
-std::array<float,2>{0.307855397f, 0.351246476f},
-std::array<float,2>{0.598921299f, 0.76484853f},
-std::array<float,2>{0.80056715f, 0.168920457f},
-std::array<float,2>{0.159204438f, 0.532433987f},
-std::array<float,2>{0.124452822f, 0.108182497f},
-std::array<float,2>{0.90868181f, 0.695992231f},
-std::array<float,2>{0.647336185f, 0.43022716f},
-std::array<float,2>{0.37515837f, 0.985104322f},
-std::array<float,2>{0.474064231f, 0.187945634f},
-std::array<float,2>{0.721667588f, 0.597428083f},
-std::array<float,2>{0.960402787f, 0.309391052f},
-std::array<float,2>{0.0571757518f, 0.842576504f},
-std::array<float,2>{0.235305399f, 0.45072639f},
-std::array<float,2>{0.841779947f, 0.921181083f},
-std::array<float,2>{0.516658962f, 0.0447721854f},
-std::array<float,2>{0.353840947f, 0.650387883f},
-std::array<float,2>{0.40893203f, 0.38818574f},
-std::array<float,2>{0.681723058f, 0.966331601f},
-std::array<float,2>{0.889305294f, 0.0838916078f},
-std::array<float,2>{0.069944784f, 0.725100815f},
-std::array<float,2>{0.152948469f, 0.142801479f},
-std::array<float,2>{0.768111467f, 0.509114981f},
-std::array<float,2>{0.587063074f, 0.34358561f},
-std::array<float,2>{0.273330241f, 0.796001256f},
-std::array<float,2>{0.326476187f, 0.0245595668f},
-std::array<float,2>{0.538411975f, 0.685562611f},
-std::array<float,2>{0.868417621f, 0.470537871f},
-std::array<float,2>{0.20603773f, 0.883131325f},
-std::array<float,2>{0.0228328127f, 0.26151967f},
-std::array<float,2>{0.987963498f, 0.863342226f},
-std::array<float,2>{0.695500195f, 0.244262412f},
-std::array<float,2>{0.463225901f, 0.58606416f},
-std::array<float,2>{0.422997117f, 0.257019699f},
-std::array<float,2>{0.663197696f, 0.867395222f},
-std::array<float,2>{0.892669439f, 0.240289196f},
-std::array<float,2>{0.0813044086f, 0.579384267f},
-std::array<float,2>{0.125949129f, 0.0228040684f},
-std::array<float,2>{0.75091511f, 0.672946274f},
-std::array<float,2>{0.570694685f, 0.478407055f},
-std::array<float,2>{0.255644977f, 0.879160881f},
-std::array<float,2>{0.338844806f, 0.15258114f},
-std::array<float,2>{0.557538331f, 0.507387578f},
-std::array<float,2>{0.849830329f, 0.333554357f},
-std::array<float,2>{0.189226016f, 0.783453107f},
-std::array<float,2>{0.0153838806f, 0.377719402f},
-std::array<float,2>{0.976697564f, 0.959878385f},
-std::array<float,2>{0.711445808f, 0.0907873288f},
-std::array<float,2>{0.446203321f, 0.729227901f},
-std::array<float,2>{0.287964046f, 0.443720669f},
-std::array<float,2>{0.622161806f, 0.906404376f},
-std::array<float,2>{0.784102082f, 0.0384202749f},
-std::array<float,2>{0.17791225f, 0.648168206f},
-std::array<float,2>{0.0946809947f, 0.202981234f},
-std::array<float,2>{0.936606765f, 0.603167355f},
-std::array<float,2>{0.637718916f, 0.30287385f},
-std::array<float,2>{0.397636026f, 0.830503106f},
-std::array<float,2>{0.485244751f, 0.0997616723f},
-std::array<float,2>{0.739422739f, 0.687529802f},
-std::array<float,2>{0.942652762f, 0.426480263f},
-std::array<float,2>{0.0444666855f, 0.995252728f},
-std::array<float,2>{0.227030545f, 0.358665377f},
-std::array<float,2>{0.815495729f, 0.750651777f},
-std::array<float,2>{0.504271209f, 0.159083799f},
-std::array<float,2>{0.368317813f, 0.541484416f},
-std::array<float,2>{0.358186334f, 0.321744591f},
-std::array<float,2>{0.519776642f, 0.801361084f},
-std::array<float,2>{0.83685559f, 0.135050386f},
-std::array<float,2>{0.241234958f, 0.528277695f},
-std::array<float,2>{0.0590160005f, 0.0744570196f},
-std::array<float,2>{0.955973148f, 0.736652076f},
-std::array<float,2>{0.724163651f, 0.397656918f},
-std::array<float,2>{0.471749663f, 0.944556534f},
-std::array<float,2>{0.380769789f, 0.230490074f},
-std::array<float,2>{0.64092958f, 0.570459366f},
-std::array<float,2>{0.913211405f, 0.27010411f},
-std::array<float,2>{0.119728111f, 0.855908573f},
-std::array<float,2>{0.160405666f, 0.490628421f},
-std::array<float,2>{0.802662373f, 0.900932729f},
-std::array<float,2>{0.594569743f, 0.00883118249f},
-std::array<float,2>{0.310959488f, 0.656297505f},
-std::array<float,2>{0.465189874f, 0.420476228f},
-std::array<float,2>{0.700479746f, 0.97765696f},
-std::array<float,2>{0.989838898f, 0.113729261f},
-std::array<float,2>{0.0165619515f, 0.708748937f},
-std::array<float,2>{0.207952738f, 0.175155565f},
-std::array<float,2>{0.873363793f, 0.550244093f},
-std::array<float,2>{0.532723248f, 0.368129432f},
-std::array<float,2>{0.323415607f, 0.769926488f},
-std::array<float,2>{0.26899004f, 0.0561770722f},
-std::array<float,2>{0.590522408f, 0.629775643f},
-std::array<float,2>{0.773318112f, 0.462535381f},
-std::array<float,2>{0.151511714f, 0.92423743f},
-std::array<float,2>{0.0655007362f, 0.29583174f},
-std::array<float,2>{0.882998526f, 0.817616224f},
-std::array<float,2>{0.686557293f, 0.212589845f},
-std::array<float,2>{0.411834091f, 0.614921868f},
-std::array<float,2>{0.478206486f, 0.36670512f},
-std::array<float,2>{0.726621032f, 0.779716074f},
-std::array<float,2>{0.961825252f, 0.181533426f},
-std::array<float,2>{0.0516395867f, 0.558492899f},
-std::array<float,2>{0.246137753f, 0.123816818f},
-std::array<float,2>{0.828166127f, 0.712804377f},
-std::array<float,2>{0.524006546f, 0.408483595f},
-std::array<float,2>{0.345715225f, 0.974641919f},
-std::array<float,2>{0.298665613f, 0.204042077f},
-std::array<float,2>{0.603036284f, 0.619769752f},
-std::array<float,2>{0.810657799f, 0.286298931f},
-std::array<float,2>{0.166079044f, 0.821816385f},
-std::array<float,2>{0.114848748f, 0.455071181f},
-std::array<float,2>{0.9181512f, 0.932440639f},
-std::array<float,2>{0.654888868f, 0.0494834743f},
-std::array<float,2>{0.388327301f, 0.637915015f},
-std::array<float,2>{0.31357348f, 0.400416285f},
-std::array<float,2>{0.543206334f, 0.947578371f},
-std::array<float,2>{0.860596538f, 0.0663593486f},
-std::array<float,2>{0.218131706f, 0.745883286f},
-std::array<float,2>{0.0272475909f, 0.125320226f},
-std::array<float,2>{0.992500007f, 0.515946329f},
-std::array<float,2>{0.69167316f, 0.318318278f},
-std::array<float,2>{0.455445856f, 0.808141053f},
-std::array<float,2>{0.419078618f, 0.00492467266f},
-std::array<float,2>{0.672340453f, 0.666311264f},
-std::array<float,2>{0.882286608f, 0.49583149f},
-std::array<float,2>{0.0772012994f, 0.892770469f},
-std::array<float,2>{0.145378277f, 0.278765291f},
-std::array<float,2>{0.780299902f, 0.849173188f},
-std::array<float,2>{0.585550427f, 0.226042539f},
-std::array<float,2>{0.277347744f, 0.566430151f},
-std::array<float,2>{0.265376568f, 0.307763517f},
-std::array<float,2>{0.562902629f, 0.838345408f},
-std::array<float,2>{0.762960792f, 0.194194525f},
-std::array<float,2>{0.133262962f, 0.600643396f},
-std::array<float,2>{0.0863383487f, 0.0392815694f},
-std::array<float,2>{0.905199885f, 0.655560851f},
-std::array<float,2>{0.669016957f, 0.44535628f},
-std::array<float,2>{0.430845737f, 0.916832745f},
-std::array<float,2>{0.437964976f, 0.16444397f},
-std::array<float,2>{0.704368293f, 0.536563635f},
-std::array<float,2>{0.970015168f, 0.347245514f},
-std::array<float,2>{0.000340260885f, 0.761162043f},
-std::array<float,2>{0.197786763f, 0.43589434f},
-std::array<float,2>{0.85245508f, 0.991801739f},
-std::array<float,2>{0.546888411f, 0.102941036f},
-std::array<float,2>{0.335844547f, 0.701258361f},
-std::array<float,2>{0.405535519f, 0.475085109f},
-std::array<float,2>{0.626923442f, 0.886852384f},
-std::array<float,2>{0.9292835f, 0.0305376835f},
-std::array<float,2>{0.107150897f, 0.68329531f},
-std::array<float,2>{0.187052175f, 0.249726817f},
-std::array<float,2>{0.795054555f, 0.593661606f},
-std::array<float,2>{0.611576915f, 0.265256912f},
-std::array<float,2>{0.292754233f, 0.86291039f},
-std::array<float,2>{0.365337908f, 0.0800650939f},
-std::array<float,2>{0.508128107f, 0.721369386f},
-std::array<float,2>{0.826258183f, 0.384656787f},
-std::array<float,2>{0.223816067f, 0.961377442f},
-std::array<float,2>{0.0372221917f, 0.33979246f},
-std::array<float,2>{0.945704281f, 0.789913595f},
-std::array<float,2>{0.749434888f, 0.146572322f},
-std::array<float,2>{0.496582597f, 0.512244225f},
-std::array<float,2>{0.375820816f, 0.348450392f},
-std::array<float,2>{0.646699786f, 0.763433874f},
-std::array<float,2>{0.908934772f, 0.170140043f},
-std::array<float,2>{0.12497288f, 0.534516633f},
-std::array<float,2>{0.159785628f, 0.106276825f},
-std::array<float,2>{0.800221801f, 0.697533786f},
-std::array<float,2>{0.599165082f, 0.431917012f},
-std::array<float,2>{0.308332026f, 0.987312734f},
-std::array<float,2>{0.354407579f, 0.19001919f},
-std::array<float,2>{0.517408609f, 0.593883812f},
-std::array<float,2>{0.84084326f, 0.311779708f},
-std::array<float,2>{0.234588206f, 0.841665745f},
-std::array<float,2>{0.0569283925f, 0.45154497f},
-std::array<float,2>{0.960825861f, 0.919403255f},
-std::array<float,2>{0.72090441f, 0.0466469042f},
-std::array<float,2>{0.474256068f, 0.650677145f},
-std::array<float,2>{0.272804916f, 0.390374422f},
-std::array<float,2>{0.587870955f, 0.966940939f},
-std::array<float,2>{0.768040121f, 0.0844468251f},
-std::array<float,2>{0.152698755f, 0.723524392f},
-std::array<float,2>{0.0697600394f, 0.140866518f},
-std::array<float,2>{0.888820827f, 0.510808706f},
-std::array<float,2>{0.682154894f, 0.341523975f},
-std::array<float,2>{0.408284247f, 0.793209791f},
-std::array<float,2>{0.463808417f, 0.0264446102f},
-std::array<float,2>{0.696198285f, 0.685394526f},
-std::array<float,2>{0.987510204f, 0.471135795f},
-std::array<float,2>{0.023056265f, 0.886453629f},
-std::array<float,2>{0.205270514f, 0.258905977f},
-std::array<float,2>{0.868859828f, 0.865839899f},
-std::array<float,2>{0.53866744f, 0.243571937f},
-std::array<float,2>{0.327063501f, 0.589128315f},
-std::array<float,2>{0.343676418f, 0.281553626f},
-std::array<float,2>{0.560539901f, 0.825728416f},
-std::array<float,2>{0.847041965f, 0.209752187f},
-std::array<float,2>{0.194760412f, 0.622870684f},
-std::array<float,2>{0.00900954567f, 0.053816732f},
-std::array<float,2>{0.983626306f, 0.632850826f},
-std::array<float,2>{0.716270685f, 0.460641503f},
-std::array<float,2>{0.450924069f, 0.93467617f},
-std::array<float,2>{0.428451121f, 0.185954288f},
-std::array<float,2>{0.656492472f, 0.560895681f},
-std::array<float,2>{0.898124576f, 0.360198945f},
-std::array<float,2>{0.0837293267f, 0.773626924f},
-std::array<float,2>{0.131737798f, 0.411032945f},
-std::array<float,2>{0.756431818f, 0.96878165f},
-std::array<float,2>{0.57777071f, 0.119005047f},
-std::array<float,2>{0.252183616f, 0.718031228f},
-std::array<float,2>{0.490267575f, 0.496911615f},
-std::array<float,2>{0.736754656f, 0.89665693f},
-std::array<float,2>{0.941048384f, 0.00130043773f},
-std::array<float,2>{0.0399799049f, 0.669839859f},
-std::array<float,2>{0.233715728f, 0.221645951f},
-std::array<float,2>{0.820111275f, 0.565137386f},
-std::array<float,2>{0.500127852f, 0.276498884f},
-std::array<float,2>{0.372958034f, 0.847354829f},
-std::array<float,2>{0.283993304f, 0.0672202259f},
-std::array<float,2>{0.61952734f, 0.749947846f},
-std::array<float,2>{0.786168158f, 0.404212385f},
-std::array<float,2>{0.173302799f, 0.95258069f},
-std::array<float,2>{0.0987529904f, 0.312512487f},
-std::array<float,2>{0.932948172f, 0.810797691f},
-std::array<float,2>{0.635126591f, 0.131644249f},
-std::array<float,2>{0.392043889f, 0.520995796f},
-std::array<float,2>{0.442806095f, 0.267491162f},
-std::array<float,2>{0.70893991f, 0.854144812f},
-std::array<float,2>{0.976442337f, 0.228499413f},
-std::array<float,2>{0.0042566848f, 0.575954556f},
-std::array<float,2>{0.199434429f, 0.0152740059f},
-std::array<float,2>{0.856553376f, 0.660910785f},
-std::array<float,2>{0.551803291f, 0.48780477f},
-std::array<float,2>{0.33067736f, 0.90276438f},
-std::array<float,2>{0.258104056f, 0.138138011f},
-std::array<float,2>{0.569453835f, 0.525180757f},
-std::array<float,2>{0.758832514f, 0.325289547f},
-std::array<float,2>{0.1387088f, 0.797733068f},
-std::array<float,2>{0.0900847018f, 0.391979873f},
-std::array<float,2>{0.899805129f, 0.940024137f},
-std::array<float,2>{0.66782856f, 0.0708771646f},
-std::array<float,2>{0.434122682f, 0.741494536f},
-std::array<float,2>{0.362192959f, 0.467195839f},
-std::array<float,2>{0.512115717f, 0.926159739f},
-std::array<float,2>{0.822950423f, 0.0624530166f},
-std::array<float,2>{0.221096039f, 0.628693998f},
-std::array<float,2>{0.0350921862f, 0.218149513f},
-std::array<float,2>{0.952709496f, 0.609632194f},
-std::array<float,2>{0.742761552f, 0.292379767f},
-std::array<float,2>{0.492233366f, 0.815702856f},
-std::array<float,2>{0.401742131f, 0.112189546f},
-std::array<float,2>{0.628945112f, 0.706741452f},
-std::array<float,2>{0.922899485f, 0.41565454f},
-std::array<float,2>{0.102277182f, 0.984135985f},
-std::array<float,2>{0.180621043f, 0.371448368f},
-std::array<float,2>{0.790656388f, 0.766592443f},
-std::array<float,2>{0.614742696f, 0.177960664f},
-std::array<float,2>{0.295097649f, 0.550965846f},
-std::array<float,2>{0.303764433f, 0.328859866f},
-std::array<float,2>{0.605728626f, 0.786688149f},
-std::array<float,2>{0.807751954f, 0.148556814f},
-std::array<float,2>{0.171419412f, 0.501888275f},
-std::array<float,2>{0.1131768f, 0.0881956369f},
-std::array<float,2>{0.917030752f, 0.731728375f},
-std::array<float,2>{0.648546159f, 0.381131858f},
-std::array<float,2>{0.383345753f, 0.953312337f},
-std::array<float,2>{0.482037514f, 0.237278387f},
-std::array<float,2>{0.734322667f, 0.585161328f},
-std::array<float,2>{0.965920389f, 0.250459999f},
-std::array<float,2>{0.0489565656f, 0.872163951f},
-std::array<float,2>{0.242855355f, 0.482845128f},
-std::array<float,2>{0.832785666f, 0.87830621f},
-std::array<float,2>{0.527853966f, 0.016615985f},
-std::array<float,2>{0.351249039f, 0.677236736f},
-std::array<float,2>{0.416547447f, 0.424402535f},
-std::array<float,2>{0.678249598f, 0.996361732f},
-std::array<float,2>{0.878161013f, 0.0976419151f},
-std::array<float,2>{0.0714383349f, 0.693668365f},
-std::array<float,2>{0.140853882f, 0.163333803f},
-std::array<float,2>{0.773842514f, 0.545427024f},
-std::array<float,2>{0.57812953f, 0.354926974f},
-std::array<float,2>{0.274474233f, 0.75647831f},
-std::array<float,2>{0.316619366f, 0.0345966071f},
-std::array<float,2>{0.540049613f, 0.64165777f},
-std::array<float,2>{0.864962697f, 0.438797623f},
-std::array<float,2>{0.211951405f, 0.913520873f},
-std::array<float,2>{0.028082598f, 0.298415005f},
-std::array<float,2>{0.998105049f, 0.83423233f},
-std::array<float,2>{0.687658072f, 0.195558533f},
-std::array<float,2>{0.460089803f, 0.607441306f},
-std::array<float,2>{0.431347817f, 0.304733217f},
-std::array<float,2>{0.669467628f, 0.837240696f},
-std::array<float,2>{0.904387772f, 0.191477969f},
-std::array<float,2>{0.086624302f, 0.599599421f},
-std::array<float,2>{0.133772716f, 0.042586308f},
-std::array<float,2>{0.763234317f, 0.652609825f},
-std::array<float,2>{0.563229918f, 0.447585672f},
-std::array<float,2>{0.265052617f, 0.915703118f},
-std::array<float,2>{0.335145622f, 0.166032672f},
-std::array<float,2>{0.547841132f, 0.537988722f},
-std::array<float,2>{0.851673305f, 0.345121354f},
-std::array<float,2>{0.19739607f, 0.75867486f},
-std::array<float,2>{0.000491419632f, 0.434737086f},
-std::array<float,2>{0.970296264f, 0.988896012f},
-std::array<float,2>{0.704900146f, 0.104146451f},
-std::array<float,2>{0.438120037f, 0.699287474f},
-std::array<float,2>{0.292084128f, 0.473457932f},
-std::array<float,2>{0.611935019f, 0.889581978f},
-std::array<float,2>{0.795837045f, 0.0275198147f},
-std::array<float,2>{0.186979905f, 0.680723667f},
-std::array<float,2>{0.106614769f, 0.247663513f},
-std::array<float,2>{0.928869903f, 0.591525972f},
-std::array<float,2>{0.626185715f, 0.263366371f},
-std::array<float,2>{0.406186163f, 0.860943377f},
-std::array<float,2>{0.496399194f, 0.0817558318f},
-std::array<float,2>{0.749534547f, 0.719616532f},
-std::array<float,2>{0.946100116f, 0.385387152f},
-std::array<float,2>{0.0379459709f, 0.962910056f},
-std::array<float,2>{0.224308059f, 0.336859375f},
-std::array<float,2>{0.826945007f, 0.791291237f},
-std::array<float,2>{0.508775949f, 0.144597098f},
-std::array<float,2>{0.365780056f, 0.514214456f},
-std::array<float,2>{0.346264929f, 0.364027441f},
-std::array<float,2>{0.523523331f, 0.779175162f},
-std::array<float,2>{0.828781784f, 0.183330029f},
-std::array<float,2>{0.246821389f, 0.556583822f},
-std::array<float,2>{0.0508952029f, 0.12172354f},
-std::array<float,2>{0.961422622f, 0.714526594f},
-std::array<float,2>{0.727412879f, 0.407709628f},
-std::array<float,2>{0.477652848f, 0.973920822f},
-std::array<float,2>{0.388062835f, 0.206975639f},
-std::array<float,2>{0.654655874f, 0.618650734f},
-std::array<float,2>{0.918538153f, 0.288599223f},
-std::array<float,2>{0.114409775f, 0.823165834f},
-std::array<float,2>{0.16664198f, 0.456725597f},
-std::array<float,2>{0.811323941f, 0.930989087f},
-std::array<float,2>{0.602758467f, 0.0476219766f},
-std::array<float,2>{0.298271894f, 0.639856219f},
-std::array<float,2>{0.455746353f, 0.399257243f},
-std::array<float,2>{0.692180872f, 0.946466148f},
-std::array<float,2>{0.992878616f, 0.0629503429f},
-std::array<float,2>{0.0263880808f, 0.743869305f},
-std::array<float,2>{0.218589872f, 0.128574774f},
-std::array<float,2>{0.861028969f, 0.51898104f},
-std::array<float,2>{0.543709517f, 0.31926021f},
-std::array<float,2>{0.313973874f, 0.806143105f},
-std::array<float,2>{0.278102934f, 0.0075788321f},
-std::array<float,2>{0.584965885f, 0.664320827f},
-std::array<float,2>{0.781010807f, 0.493578225f},
-std::array<float,2>{0.144907594f, 0.892481923f},
-std::array<float,2>{0.0780454054f, 0.279550761f},
-std::array<float,2>{0.8826195f, 0.850016117f},
-std::array<float,2>{0.672472596f, 0.224220082f},
-std::array<float,2>{0.419472367f, 0.568537891f},
-std::array<float,2>{0.472463578f, 0.322524786f},
-std::array<float,2>{0.724001288f, 0.80322963f},
-std::array<float,2>{0.955360234f, 0.134218276f},
-std::array<float,2>{0.0594127811f, 0.529732883f},
-std::array<float,2>{0.24195765f, 0.0769798383f},
-std::array<float,2>{0.836304069f, 0.734745383f},
-std::array<float,2>{0.520150363f, 0.395875037f},
-std::array<float,2>{0.357902884f, 0.942022383f},
-std::array<float,2>{0.31107837f, 0.233532235f},
-std::array<float,2>{0.594182968f, 0.572374225f},
-std::array<float,2>{0.802179813f, 0.272117764f},
-std::array<float,2>{0.1606538f, 0.858175218f},
-std::array<float,2>{0.119549088f, 0.488945752f},
-std::array<float,2>{0.913739383f, 0.900011301f},
-std::array<float,2>{0.64133811f, 0.0102648353f},
-std::array<float,2>{0.380344629f, 0.659843326f},
-std::array<float,2>{0.323925823f, 0.418586552f},
-std::array<float,2>{0.532486856f, 0.980020285f},
-std::array<float,2>{0.873713434f, 0.115502723f},
-std::array<float,2>{0.207291439f, 0.709901512f},
-std::array<float,2>{0.0159632638f, 0.173171967f},
-std::array<float,2>{0.989273846f, 0.548688233f},
-std::array<float,2>{0.700951457f, 0.370692462f},
-std::array<float,2>{0.465635926f, 0.772932172f},
-std::array<float,2>{0.411473095f, 0.0575547852f},
-std::array<float,2>{0.68714577f, 0.632032156f},
-std::array<float,2>{0.883600593f, 0.46408084f},
-std::array<float,2>{0.0663128495f, 0.921993554f},
-std::array<float,2>{0.152144104f, 0.293123305f},
-std::array<float,2>{0.772870064f, 0.818561614f},
-std::array<float,2>{0.589878857f, 0.213047534f},
-std::array<float,2>{0.269294739f, 0.615459383f},
-std::array<float,2>{0.25533241f, 0.25466466f},
-std::array<float,2>{0.57086581f, 0.870881319f},
-std::array<float,2>{0.750338912f, 0.238353908f},
-std::array<float,2>{0.12509343f, 0.581463873f},
-std::array<float,2>{0.0820058063f, 0.0198123474f},
-std::array<float,2>{0.893369019f, 0.675547481f},
-std::array<float,2>{0.66395396f, 0.478583932f},
-std::array<float,2>{0.423428923f, 0.88272959f},
-std::array<float,2>{0.445587903f, 0.155438408f},
-std::array<float,2>{0.710954785f, 0.50469476f},
-std::array<float,2>{0.97720921f, 0.335681975f},
-std::array<float,2>{0.0148524754f, 0.783088803f},
-std::array<float,2>{0.188776135f, 0.376652747f},
-std::array<float,2>{0.850419521f, 0.95709312f},
-std::array<float,2>{0.557051122f, 0.0927383229f},
-std::array<float,2>{0.338141561f, 0.728444397f},
-std::array<float,2>{0.398015887f, 0.44203189f},
-std::array<float,2>{0.638565481f, 0.909108758f},
-std::array<float,2>{0.937264919f, 0.0365596488f},
-std::array<float,2>{0.0939453766f, 0.645158052f},
-std::array<float,2>{0.178257257f, 0.200565591f},
-std::array<float,2>{0.783453941f, 0.604950368f},
-std::array<float,2>{0.62302053f, 0.302715361f},
-std::array<float,2>{0.287568182f, 0.829909921f},
-std::array<float,2>{0.3688941f, 0.098822549f},
-std::array<float,2>{0.504738629f, 0.689821482f},
-std::array<float,2>{0.815920353f, 0.42823571f},
-std::array<float,2>{0.227098227f, 0.993671715f},
-std::array<float,2>{0.044262208f, 0.355550975f},
-std::array<float,2>{0.943325341f, 0.753168881f},
-std::array<float,2>{0.740197837f, 0.156508699f},
-std::array<float,2>{0.484398246f, 0.539353669f},
-std::array<float,2>{0.406276315f, 0.342882663f},
-std::array<float,2>{0.679920197f, 0.796508789f},
-std::array<float,2>{0.888063133f, 0.143482715f},
-std::array<float,2>{0.0667261928f, 0.5096609f},
-std::array<float,2>{0.155411959f, 0.083446689f},
-std::array<float,2>{0.765772045f, 0.724666119f},
-std::array<float,2>{0.588199675f, 0.387739539f},
-std::array<float,2>{0.2711308f, 0.96607554f},
-std::array<float,2>{0.325986981f, 0.245003894f},
-std::array<float,2>{0.535472691f, 0.586446702f},
-std::array<float,2>{0.869893432f, 0.261128336f},
-std::array<float,2>{0.203457639f, 0.86412555f},
-std::array<float,2>{0.0207943562f, 0.469948411f},
-std::array<float,2>{0.984440863f, 0.883753479f},
-std::array<float,2>{0.698369622f, 0.0249374565f},
-std::array<float,2>{0.462504625f, 0.686114132f},
-std::array<float,2>{0.304989547f, 0.429843545f},
-std::array<float,2>{0.600845456f, 0.984826326f},
-std::array<float,2>{0.798630416f, 0.107800581f},
-std::array<float,2>{0.156701967f, 0.695647359f},
-std::array<float,2>{0.122246183f, 0.168052927f},
-std::array<float,2>{0.906936228f, 0.533058643f},
-std::array<float,2>{0.645702064f, 0.350760251f},
-std::array<float,2>{0.377421916f, 0.765378952f},
-std::array<float,2>{0.475655168f, 0.0443613194f},
-std::array<float,2>{0.718985677f, 0.649692357f},
-std::array<float,2>{0.957827389f, 0.45053792f},
-std::array<float,2>{0.0547329895f, 0.921758533f},
-std::array<float,2>{0.237434223f, 0.30904302f},
-std::array<float,2>{0.842093468f, 0.842017233f},
-std::array<float,2>{0.519037127f, 0.188379556f},
-std::array<float,2>{0.352118999f, 0.597056627f},
-std::array<float,2>{0.373273224f, 0.273551255f},
-std::array<float,2>{0.503887236f, 0.845520794f},
-std::array<float,2>{0.817703843f, 0.220581502f},
-std::array<float,2>{0.230896562f, 0.563212574f},
-std::array<float,2>{0.0418836847f, 0.00264243851f},
-std::array<float,2>{0.939328969f, 0.671667039f},
-std::array<float,2>{0.734412909f, 0.498680174f},
-std::array<float,2>{0.490122885f, 0.895399868f},
-std::array<float,2>{0.393175155f, 0.130432114f},
-std::array<float,2>{0.633480549f, 0.522221208f},
-std::array<float,2>{0.930265844f, 0.316263139f},
-std::array<float,2>{0.101054437f, 0.809908152f},
-std::array<float,2>{0.173843518f, 0.404759556f},
-std::array<float,2>{0.787546992f, 0.949656129f},
-std::array<float,2>{0.617313325f, 0.0692026541f},
-std::array<float,2>{0.281561613f, 0.746553957f},
-std::array<float,2>{0.451868862f, 0.458469629f},
-std::array<float,2>{0.717307031f, 0.935555279f},
-std::array<float,2>{0.981800556f, 0.051018402f},
-std::array<float,2>{0.00980043691f, 0.635802746f},
-std::array<float,2>{0.192286402f, 0.207821026f},
-std::array<float,2>{0.845431387f, 0.623468757f},
-std::array<float,2>{0.561833978f, 0.284411639f},
-std::array<float,2>{0.341054142f, 0.826876998f},
-std::array<float,2>{0.250940681f, 0.119388379f},
-std::array<float,2>{0.574663639f, 0.716303527f},
-std::array<float,2>{0.754594624f, 0.414002299f},
-std::array<float,2>{0.130405933f, 0.971190751f},
-std::array<float,2>{0.0857880637f, 0.362398595f},
-std::array<float,2>{0.895412207f, 0.776399255f},
-std::array<float,2>{0.659499109f, 0.184920594f},
-std::array<float,2>{0.426606327f, 0.559974074f},
-std::array<float,2>{0.495938838f, 0.289590359f},
-std::array<float,2>{0.745913267f, 0.812732995f},
-std::array<float,2>{0.95083642f, 0.216376841f},
-std::array<float,2>{0.0322911069f, 0.612045944f},
-std::array<float,2>{0.21951437f, 0.059165068f},
-std::array<float,2>{0.821553826f, 0.626574755f},
-std::array<float,2>{0.515099227f, 0.46679014f},
-std::array<float,2>{0.36030215f, 0.929599047f},
-std::array<float,2>{0.293932736f, 0.17701079f},
-std::array<float,2>{0.616745472f, 0.553201199f},
-std::array<float,2>{0.792085111f, 0.373246014f},
-std::array<float,2>{0.182414159f, 0.768377244f},
-std::array<float,2>{0.10484118f, 0.417506754f},
-std::array<float,2>{0.923899055f, 0.98117882f},
-std::array<float,2>{0.631108582f, 0.110808134f},
-std::array<float,2>{0.400032341f, 0.7034536f},
-std::array<float,2>{0.329074889f, 0.484998822f},
-std::array<float,2>{0.553788662f, 0.904775262f},
-std::array<float,2>{0.859267652f, 0.0131770382f},
-std::array<float,2>{0.20218806f, 0.662994742f},
-std::array<float,2>{0.00667726761f, 0.229581192f},
-std::array<float,2>{0.974427879f, 0.576439023f},
-std::array<float,2>{0.710413575f, 0.268298298f},
-std::array<float,2>{0.445271075f, 0.851860821f},
-std::array<float,2>{0.436023891f, 0.0739420429f},
-std::array<float,2>{0.664144158f, 0.739812315f},
-std::array<float,2>{0.901021242f, 0.393409342f},
-std::array<float,2>{0.0923780873f, 0.939131737f},
-std::array<float,2>{0.13733983f, 0.326260805f},
-std::array<float,2>{0.761612773f, 0.800735891f},
-std::array<float,2>{0.567758858f, 0.140344813f},
-std::array<float,2>{0.261205703f, 0.525597751f},
-std::array<float,2>{0.275856197f, 0.351750016f},
-std::array<float,2>{0.581850827f, 0.754605472f},
-std::array<float,2>{0.776149213f, 0.160886049f},
-std::array<float,2>{0.144503698f, 0.543635726f},
-std::array<float,2>{0.0728996322f, 0.0951884836f},
-std::array<float,2>{0.87554884f, 0.693065584f},
-std::array<float,2>{0.677325785f, 0.422976226f},
-std::array<float,2>{0.414358884f, 0.998102963f},
-std::array<float,2>{0.458594024f, 0.19830896f},
-std::array<float,2>{0.690006971f, 0.605830908f},
-std::array<float,2>{0.997787237f, 0.300230235f},
-std::array<float,2>{0.0310307294f, 0.833827019f},
-std::array<float,2>{0.214097291f, 0.439744115f},
-std::array<float,2>{0.867104053f, 0.911480486f},
-std::array<float,2>{0.54112041f, 0.0318634026f},
-std::array<float,2>{0.320290625f, 0.642709911f},
-std::array<float,2>{0.385985702f, 0.379103482f},
-std::array<float,2>{0.651376724f, 0.956617594f},
-std::array<float,2>{0.915118337f, 0.0866036788f},
-std::array<float,2>{0.111173801f, 0.734215081f},
-std::array<float,2>{0.169464439f, 0.151366577f},
-std::array<float,2>{0.804836094f, 0.502510011f},
-std::array<float,2>{0.608003616f, 0.331626981f},
-std::array<float,2>{0.302046746f, 0.788536787f},
-std::array<float,2>{0.348621339f, 0.0179294571f},
-std::array<float,2>{0.529903412f, 0.678693473f},
-std::array<float,2>{0.835104167f, 0.481265724f},
-std::array<float,2>{0.244744182f, 0.875700116f},
-std::array<float,2>{0.0481199808f, 0.252289653f},
-std::array<float,2>{0.968584836f, 0.874224365f},
-std::array<float,2>{0.731716812f, 0.235187411f},
-std::array<float,2>{0.484051198f, 0.582507849f},
-std::array<float,2>{0.403744012f, 0.26470086f},
-std::array<float,2>{0.628658652f, 0.862547338f},
-std::array<float,2>{0.92622149f, 0.249048993f},
-std::array<float,2>{0.109035574f, 0.592774272f},
-std::array<float,2>{0.185150698f, 0.0308428239f},
-std::array<float,2>{0.793645978f, 0.682934821f},
-std::array<float,2>{0.609651268f, 0.475140184f},
-std::array<float,2>{0.290152222f, 0.887560546f},
-std::array<float,2>{0.364523053f, 0.14698799f},
-std::array<float,2>{0.511245787f, 0.511909425f},
-std::array<float,2>{0.824613452f, 0.339159578f},
-std::array<float,2>{0.225598305f, 0.789402425f},
-std::array<float,2>{0.0360954441f, 0.384137869f},
-std::array<float,2>{0.94765991f, 0.961811662f},
-std::array<float,2>{0.747323871f, 0.079495132f},
-std::array<float,2>{0.499565482f, 0.720796108f},
-std::array<float,2>{0.263379812f, 0.446277142f},
-std::array<float,2>{0.564477205f, 0.916228175f},
-std::array<float,2>{0.764587343f, 0.0399915799f},
-std::array<float,2>{0.136538044f, 0.656028032f},
-std::array<float,2>{0.0883445442f, 0.193842128f},
-std::array<float,2>{0.902717888f, 0.601249993f},
-std::array<float,2>{0.670150816f, 0.30845052f},
-std::array<float,2>{0.432471365f, 0.838601232f},
-std::array<float,2>{0.441339523f, 0.103318594f},
-std::array<float,2>{0.705710948f, 0.701920152f},
-std::array<float,2>{0.970861435f, 0.436069489f},
-std::array<float,2>{0.00350540574f, 0.991267622f},
-std::array<float,2>{0.195509091f, 0.346764624f},
-std::array<float,2>{0.854951084f, 0.761329412f},
-std::array<float,2>{0.549317956f, 0.164698094f},
-std::array<float,2>{0.332548589f, 0.536927581f},
-std::array<float,2>{0.315642357f, 0.317568332f},
-std::array<float,2>{0.546739936f, 0.807955861f},
-std::array<float,2>{0.861672759f, 0.125933647f},
-std::array<float,2>{0.214940041f, 0.516506732f},
-std::array<float,2>{0.0244571548f, 0.0656507984f},
-std::array<float,2>{0.994238794f, 0.745210171f},
-std::array<float,2>{0.694027483f, 0.40116024f},
-std::array<float,2>{0.454766303f, 0.947769761f},
-std::array<float,2>{0.420529753f, 0.226440206f},
-std::array<float,2>{0.674528658f, 0.567275763f},
-std::array<float,2>{0.8798545f, 0.279273629f},
-std::array<float,2>{0.0746697336f, 0.849104404f},
-std::array<float,2>{0.147531688f, 0.495282203f},
-std::array<float,2>{0.777581275f, 0.893269598f},
-std::array<float,2>{0.58384639f, 0.00564103667f},
-std::array<float,2>{0.280834287f, 0.666638255f},
-std::array<float,2>{0.479993612f, 0.409047633f},
-std::array<float,2>{0.729255557f, 0.975330651f},
-std::array<float,2>{0.96348989f, 0.123079009f},
-std::array<float,2>{0.0542945005f, 0.712276161f},
-std::array<float,2>{0.249910325f, 0.180723935f},
-std::array<float,2>{0.830087841f, 0.557919502f},
-std::array<float,2>{0.525874496f, 0.366663337f},
-std::array<float,2>{0.344885737f, 0.780000567f},
-std::array<float,2>{0.299118072f, 0.0490555651f},
-std::array<float,2>{0.604712188f, 0.638557792f},
-std::array<float,2>{0.809295237f, 0.454334617f},
-std::array<float,2>{0.164797828f, 0.931995749f},
-std::array<float,2>{0.116952494f, 0.286631465f},
-std::array<float,2>{0.920896649f, 0.821625948f},
-std::array<float,2>{0.654208362f, 0.203516394f},
-std::array<float,2>{0.389349043f, 0.619156837f},
-std::array<float,2>{0.466944277f, 0.367478013f},
-std::array<float,2>{0.701795876f, 0.770292521f},
-std::array<float,2>{0.991187632f, 0.175399572f},
-std::array<float,2>{0.0178365391f, 0.550355315f},
-std::array<float,2>{0.209643528f, 0.114188969f},
-std::array<float,2>{0.871134102f, 0.708491862f},
-std::array<float,2>{0.533873081f, 0.420299947f},
-std::array<float,2>{0.320649713f, 0.978086472f},
-std::array<float,2>{0.267233938f, 0.212275654f},
-std::array<float,2>{0.593404591f, 0.614585757f},
-std::array<float,2>{0.770666301f, 0.295161724f},
-std::array<float,2>{0.148913562f, 0.818263173f},
-std::array<float,2>{0.0629214197f, 0.461943865f},
-std::array<float,2>{0.885274827f, 0.924605012f},
-std::array<float,2>{0.685529172f, 0.0557292774f},
-std::array<float,2>{0.412959784f, 0.629299462f},
-std::array<float,2>{0.356422961f, 0.397969991f},
-std::array<float,2>{0.522424698f, 0.945157945f},
-std::array<float,2>{0.838261604f, 0.0749513209f},
-std::array<float,2>{0.23947531f, 0.736876905f},
-std::array<float,2>{0.0622275099f, 0.135356501f},
-std::array<float,2>{0.953210294f, 0.527450204f},
-std::array<float,2>{0.7258479f, 0.321945012f},
-std::array<float,2>{0.470032036f, 0.800967753f},
-std::array<float,2>{0.382641941f, 0.00939148106f},
-std::array<float,2>{0.64308989f, 0.656976342f},
-std::array<float,2>{0.911110282f, 0.491080493f},
-std::array<float,2>{0.118484318f, 0.900519967f},
-std::array<float,2>{0.162134856f, 0.269542247f},
-std::array<float,2>{0.803579867f, 0.856221735f},
-std::array<float,2>{0.597358644f, 0.231273174f},
-std::array<float,2>{0.309699178f, 0.57095021f},
-std::array<float,2>{0.286328107f, 0.303244114f},
-std::array<float,2>{0.624848187f, 0.831028759f},
-std::array<float,2>{0.781356335f, 0.202495515f},
-std::array<float,2>{0.177587107f, 0.602857709f},
-std::array<float,2>{0.0957351699f, 0.0387780555f},
-std::array<float,2>{0.934489667f, 0.647704005f},
-std::array<float,2>{0.639180541f, 0.443879366f},
-std::array<float,2>{0.395777553f, 0.906893551f},
-std::array<float,2>{0.487658381f, 0.158477664f},
-std::array<float,2>{0.741615593f, 0.541674316f},
-std::array<float,2>{0.943549871f, 0.359070957f},
-std::array<float,2>{0.0463117063f, 0.750101686f},
-std::array<float,2>{0.229971722f, 0.426230609f},
-std::array<float,2>{0.813291848f, 0.995803952f},
-std::array<float,2>{0.506480277f, 0.100217618f},
-std::array<float,2>{0.370949596f, 0.688263237f},
-std::array<float,2>{0.423982173f, 0.477729321f},
-std::array<float,2>{0.660600662f, 0.879790425f},
-std::array<float,2>{0.890951991f, 0.0233346429f},
-std::array<float,2>{0.0791873261f, 0.673590779f},
-std::array<float,2>{0.127585888f, 0.24087216f},
-std::array<float,2>{0.753155947f, 0.579883993f},
-std::array<float,2>{0.573790729f, 0.257398009f},
-std::array<float,2>{0.255949557f, 0.867703736f},
-std::array<float,2>{0.336055249f, 0.0902943909f},
-std::array<float,2>{0.556425989f, 0.728680134f},
-std::array<float,2>{0.849082112f, 0.3769629f},
-std::array<float,2>{0.190304875f, 0.959198236f},
-std::array<float,2>{0.0125801871f, 0.333090186f},
-std::array<float,2>{0.979166985f, 0.784167409f},
-std::array<float,2>{0.713979483f, 0.153132021f},
-std::array<float,2>{0.447999686f, 0.507197142f},
-std::array<float,2>{0.427014619f, 0.361055195f},
-std::array<float,2>{0.658279181f, 0.774641693f},
-std::array<float,2>{0.895659447f, 0.186965525f},
-std::array<float,2>{0.0846469104f, 0.561993301f},
-std::array<float,2>{0.12953341f, 0.11775244f},
-std::array<float,2>{0.755167484f, 0.717450738f},
-std::array<float,2>{0.575482488f, 0.411159635f},
-std::array<float,2>{0.25178197f, 0.970352948f},
-std::array<float,2>{0.340317696f, 0.210496873f},
-std::array<float,2>{0.561285019f, 0.622029364f},
-std::array<float,2>{0.844221115f, 0.283148915f},
-std::array<float,2>{0.193298236f, 0.825154722f},
-std::array<float,2>{0.0116849924f, 0.458990872f},
-std::array<float,2>{0.980917573f, 0.934039354f},
-std::array<float,2>{0.718618155f, 0.0528156012f},
-std::array<float,2>{0.452257693f, 0.634217918f},
-std::array<float,2>{0.28279534f, 0.402876407f},
-std::array<float,2>{0.618492126f, 0.95140326f},
-std::array<float,2>{0.788877487f, 0.0674193203f},
-std::array<float,2>{0.175371736f, 0.7486462f},
-std::array<float,2>{0.0997859985f, 0.132505134f},
-std::array<float,2>{0.930790007f, 0.519694507f},
-std::array<float,2>{0.634649932f, 0.314161301f},
-std::array<float,2>{0.394122034f, 0.81194663f},
-std::array<float,2>{0.48917377f, 0.000151917615f},
-std::array<float,2>{0.736164391f, 0.668700516f},
-std::array<float,2>{0.938059688f, 0.497270674f},
-std::array<float,2>{0.0420935526f, 0.898298979f},
-std::array<float,2>{0.232395872f, 0.275465786f},
-std::array<float,2>{0.816680491f, 0.845769227f},
-std::array<float,2>{0.502734601f, 0.222078294f},
-std::array<float,2>{0.374672443f, 0.565712929f},
-std::array<float,2>{0.353286415f, 0.310692877f},
-std::array<float,2>{0.518469632f, 0.840619028f},
-std::array<float,2>{0.84330982f, 0.190779686f},
-std::array<float,2>{0.236624494f, 0.594940186f},
-std::array<float,2>{0.0564357862f, 0.0455479771f},
-std::array<float,2>{0.958108425f, 0.651947677f},
-std::array<float,2>{0.72067529f, 0.452670127f},
-std::array<float,2>{0.474885404f, 0.917990923f},
-std::array<float,2>{0.37819308f, 0.171830371f},
-std::array<float,2>{0.644829929f, 0.533608079f},
-std::array<float,2>{0.908086896f, 0.349323481f},
-std::array<float,2>{0.121724285f, 0.762491941f},
-std::array<float,2>{0.157896534f, 0.433256388f},
-std::array<float,2>{0.797023535f, 0.98652184f},
-std::array<float,2>{0.600176454f, 0.106535658f},
-std::array<float,2>{0.306077391f, 0.699117482f},
-std::array<float,2>{0.461902082f, 0.472239494f},
-std::array<float,2>{0.697787941f, 0.884843767f},
-std::array<float,2>{0.985842586f, 0.0255853813f},
-std::array<float,2>{0.0203590374f, 0.68423593f},
-std::array<float,2>{0.204748049f, 0.242853269f},
-std::array<float,2>{0.87098819f, 0.588442981f},
-std::array<float,2>{0.536765754f, 0.258255541f},
-std::array<float,2>{0.324359804f, 0.866425514f},
-std::array<float,2>{0.269968659f, 0.0855685547f},
-std::array<float,2>{0.589165628f, 0.724477768f},
-std::array<float,2>{0.767282248f, 0.388691574f},
-std::array<float,2>{0.154689655f, 0.968708932f},
-std::array<float,2>{0.0674901903f, 0.340521425f},
-std::array<float,2>{0.886979878f, 0.794759214f},
-std::array<float,2>{0.681136072f, 0.141757786f},
-std::array<float,2>{0.408135831f, 0.510506928f},
-std::array<float,2>{0.482752442f, 0.251532406f},
-std::array<float,2>{0.730706275f, 0.871842682f},
-std::array<float,2>{0.967354536f, 0.238114342f},
-std::array<float,2>{0.0475756302f, 0.584116042f},
-std::array<float,2>{0.246017694f, 0.0164795332f},
-std::array<float,2>{0.834718287f, 0.675819635f},
-std::array<float,2>{0.530716777f, 0.483645201f},
-std::array<float,2>{0.349070311f, 0.877431035f},
-std::array<float,2>{0.301011473f, 0.149989679f},
-std::array<float,2>{0.609253526f, 0.500576019f},
-std::array<float,2>{0.806280494f, 0.330027252f},
-std::array<float,2>{0.167993039f, 0.785225213f},
-std::array<float,2>{0.109403677f, 0.382093608f},
-std::array<float,2>{0.914703429f, 0.954157889f},
-std::array<float,2>{0.651089191f, 0.0893623158f},
-std::array<float,2>{0.385529667f, 0.730573952f},
-std::array<float,2>{0.319250315f, 0.438307643f},
-std::array<float,2>{0.542585254f, 0.912535369f},
-std::array<float,2>{0.865796804f, 0.0335471258f},
-std::array<float,2>{0.213399723f, 0.641026199f},
-std::array<float,2>{0.0297759734f, 0.197094977f},
-std::array<float,2>{0.996599495f, 0.609089732f},
-std::array<float,2>{0.691309512f, 0.297782719f},
-std::array<float,2>{0.45741877f, 0.835559845f},
-std::array<float,2>{0.415110737f, 0.0966491699f},
-std::array<float,2>{0.676405907f, 0.695153177f},
-std::array<float,2>{0.876703262f, 0.424910963f},
-std::array<float,2>{0.0732702985f, 0.997331023f},
-std::array<float,2>{0.142751008f, 0.354295731f},
-std::array<float,2>{0.776805699f, 0.757010818f},
-std::array<float,2>{0.58091867f, 0.162553445f},
-std::array<float,2>{0.276973307f, 0.54683733f},
-std::array<float,2>{0.260665447f, 0.325096369f},
-std::array<float,2>{0.566994011f, 0.798638761f},
-std::array<float,2>{0.760694027f, 0.137147248f},
-std::array<float,2>{0.13840355f, 0.523460805f},
-std::array<float,2>{0.0931143165f, 0.0722315833f},
-std::array<float,2>{0.901387811f, 0.740475714f},
-std::array<float,2>{0.665190637f, 0.390638381f},
-std::array<float,2>{0.436966747f, 0.941173971f},
-std::array<float,2>{0.44374761f, 0.227339059f},
-std::array<float,2>{0.709122419f, 0.574859142f},
-std::array<float,2>{0.972961485f, 0.26594615f},
-std::array<float,2>{0.0074704173f, 0.854539573f},
-std::array<float,2>{0.201254904f, 0.486859083f},
-std::array<float,2>{0.857664406f, 0.904103994f},
-std::array<float,2>{0.553378582f, 0.0139276264f},
-std::array<float,2>{0.329811096f, 0.66173321f},
-std::array<float,2>{0.398951441f, 0.414791137f},
-std::array<float,2>{0.632121503f, 0.982998908f},
-std::array<float,2>{0.925479114f, 0.112820998f},
-std::array<float,2>{0.103792056f, 0.705574572f},
-std::array<float,2>{0.182699293f, 0.179488853f},
-std::array<float,2>{0.791252613f, 0.552203f},
-std::array<float,2>{0.615834534f, 0.372892231f},
-std::array<float,2>{0.294612408f, 0.766677737f},
-std::array<float,2>{0.361202538f, 0.0606159791f},
-std::array<float,2>{0.514137983f, 0.627334476f},
-std::array<float,2>{0.820975482f, 0.468044579f},
-std::array<float,2>{0.220285609f, 0.92719692f},
-std::array<float,2>{0.0318653807f, 0.291359365f},
-std::array<float,2>{0.949320912f, 0.814537406f},
-std::array<float,2>{0.744401097f, 0.217161596f},
-std::array<float,2>{0.49465239f, 0.61132127f},
-std::array<float,2>{0.390430987f, 0.287238419f},
-std::array<float,2>{0.653023124f, 0.823996186f},
-std::array<float,2>{0.921331465f, 0.205210567f},
-std::array<float,2>{0.115837298f, 0.617767751f},
-std::array<float,2>{0.165791005f, 0.0483047105f},
-std::array<float,2>{0.810158253f, 0.639413059f},
-std::array<float,2>{0.603873372f, 0.455289364f},
-std::array<float,2>{0.300093383f, 0.929725468f},
-std::array<float,2>{0.343900263f, 0.181905523f},
-std::array<float,2>{0.52726984f, 0.555089593f},
-std::array<float,2>{0.831195891f, 0.364456087f},
-std::array<float,2>{0.248931065f, 0.777603626f},
-std::array<float,2>{0.0531690717f, 0.407034814f},
-std::array<float,2>{0.963926613f, 0.972838402f},
-std::array<float,2>{0.729938745f, 0.122717462f},
-std::array<float,2>{0.47873348f, 0.713257074f},
-std::array<float,2>{0.280269325f, 0.492861211f},
-std::array<float,2>{0.582511127f, 0.890837252f},
-std::array<float,2>{0.778693259f, 0.00618241075f},
-std::array<float,2>{0.147428513f, 0.665127158f},
-std::array<float,2>{0.0752140209f, 0.223496333f},
-std::array<float,2>{0.880669415f, 0.569722235f},
-std::array<float,2>{0.67568934f, 0.280867249f},
-std::array<float,2>{0.421594262f, 0.851284385f},
-std::array<float,2>{0.453475207f, 0.0635435283f},
-std::array<float,2>{0.694688916f, 0.742883682f},
-std::array<float,2>{0.995456576f, 0.399659246f},
-std::array<float,2>{0.0236875471f, 0.946173608f},
-std::array<float,2>{0.216136649f, 0.319558263f},
-std::array<float,2>{0.86276269f, 0.805205882f},
-std::array<float,2>{0.545813441f, 0.127121314f},
-std::array<float,2>{0.314724773f, 0.518058777f},
-std::array<float,2>{0.333912313f, 0.343899965f},
-std::array<float,2>{0.550541461f, 0.759569228f},
-std::array<float,2>{0.85370487f, 0.167112395f},
-std::array<float,2>{0.196379602f, 0.538696289f},
-std::array<float,2>{0.00267357379f, 0.105262108f},
-std::array<float,2>{0.972646236f, 0.700771928f},
-std::array<float,2>{0.706712365f, 0.433920413f},
-std::array<float,2>{0.440020412f, 0.989581704f},
-std::array<float,2>{0.432731897f, 0.193264723f},
-std::array<float,2>{0.671239555f, 0.598157346f},
-std::array<float,2>{0.903952003f, 0.30625692f},
-std::array<float,2>{0.0896282867f, 0.836830974f},
-std::array<float,2>{0.135153487f, 0.449211329f},
-std::array<float,2>{0.764719069f, 0.914414525f},
-std::array<float,2>{0.566366374f, 0.0411071889f},
-std::array<float,2>{0.262500912f, 0.653741777f},
-std::array<float,2>{0.498370022f, 0.386491001f},
-std::array<float,2>{0.746572137f, 0.964208245f},
-std::array<float,2>{0.948668659f, 0.0807723403f},
-std::array<float,2>{0.0363884754f, 0.720315576f},
-std::array<float,2>{0.225326434f, 0.146333694f},
-std::array<float,2>{0.825762093f, 0.515300751f},
-std::array<float,2>{0.509971499f, 0.337546706f},
-std::array<float,2>{0.364184141f, 0.792308688f},
-std::array<float,2>{0.289509952f, 0.0289469901f},
-std::array<float,2>{0.610528708f, 0.679893434f},
-std::array<float,2>{0.794705868f, 0.473672837f},
-std::array<float,2>{0.183923572f, 0.890523612f},
-std::array<float,2>{0.107541338f, 0.262422591f},
-std::array<float,2>{0.927245438f, 0.860218167f},
-std::array<float,2>{0.627646148f, 0.246893719f},
-std::array<float,2>{0.403077275f, 0.590388298f},
-std::array<float,2>{0.448633105f, 0.334726602f},
-std::array<float,2>{0.71364677f, 0.781511247f},
-std::array<float,2>{0.980036795f, 0.154338822f},
-std::array<float,2>{0.013211214f, 0.505198061f},
-std::array<float,2>{0.190737799f, 0.0932262391f},
-std::array<float,2>{0.848137319f, 0.726865947f},
-std::array<float,2>{0.554776907f, 0.375828058f},
-std::array<float,2>{0.337805033f, 0.958637416f},
-std::array<float,2>{0.257443756f, 0.239859968f},
-std::array<float,2>{0.572578371f, 0.580991626f},
-std::array<float,2>{0.752500594f, 0.255059481f},
-std::array<float,2>{0.128130808f, 0.869175911f},
-std::array<float,2>{0.0790361241f, 0.480399668f},
-std::array<float,2>{0.892511189f, 0.881474316f},
-std::array<float,2>{0.662021995f, 0.0205386858f},
-std::array<float,2>{0.425480664f, 0.674439669f},
-std::array<float,2>{0.36940822f, 0.429186195f},
-std::array<float,2>{0.50776124f, 0.992774665f},
-std::array<float,2>{0.8135463f, 0.0983846188f},
-std::array<float,2>{0.228859171f, 0.691183448f},
-std::array<float,2>{0.0452203155f, 0.157368958f},
-std::array<float,2>{0.944787681f, 0.540808678f},
-std::array<float,2>{0.740239561f, 0.356947362f},
-std::array<float,2>{0.487038821f, 0.752148628f},
-std::array<float,2>{0.39535597f, 0.0359224528f},
-std::array<float,2>{0.640577853f, 0.645519137f},
-std::array<float,2>{0.935536921f, 0.442652732f},
-std::array<float,2>{0.0976457745f, 0.909909487f},
-std::array<float,2>{0.176228598f, 0.301163018f},
-std::array<float,2>{0.782735288f, 0.828879595f},
-std::array<float,2>{0.62319684f, 0.199496031f},
-std::array<float,2>{0.285281986f, 0.60390085f},
-std::array<float,2>{0.309017479f, 0.272631675f},
-std::array<float,2>{0.596251428f, 0.858938038f},
-std::array<float,2>{0.804470479f, 0.232929692f},
-std::array<float,2>{0.163994297f, 0.574187934f},
-std::array<float,2>{0.117189094f, 0.0109217912f},
-std::array<float,2>{0.912000656f, 0.658857584f},
-std::array<float,2>{0.644127488f, 0.489386111f},
-std::array<float,2>{0.381135374f, 0.898627758f},
-std::array<float,2>{0.468913943f, 0.132864103f},
-std::array<float,2>{0.72468847f, 0.530525684f},
-std::array<float,2>{0.954250336f, 0.323709399f},
-std::array<float,2>{0.0607756004f, 0.803864837f},
-std::array<float,2>{0.238789693f, 0.395063698f},
-std::array<float,2>{0.839022756f, 0.943123639f},
-std::array<float,2>{0.522937119f, 0.0780679137f},
-std::array<float,2>{0.357222319f, 0.735522807f},
-std::array<float,2>{0.413595676f, 0.463669479f},
-std::array<float,2>{0.68450588f, 0.923137188f},
-std::array<float,2>{0.886210799f, 0.0577490553f},
-std::array<float,2>{0.0637404248f, 0.631792605f},
-std::array<float,2>{0.150269702f, 0.213903353f},
-std::array<float,2>{0.769550085f, 0.616500556f},
-std::array<float,2>{0.592714965f, 0.294149309f},
-std::array<float,2>{0.266276538f, 0.820266128f},
-std::array<float,2>{0.321654469f, 0.116717242f},
-std::array<float,2>{0.534806609f, 0.710133076f},
-std::array<float,2>{0.872096896f, 0.419497371f},
-std::array<float,2>{0.210258007f, 0.97926116f},
-std::array<float,2>{0.0185875744f, 0.36950013f},
-std::array<float,2>{0.991946697f, 0.771786392f},
-std::array<float,2>{0.702521205f, 0.172714025f},
-std::array<float,2>{0.468388736f, 0.547834158f},
-std::array<float,2>{0.391516328f, 0.315183818f},
-std::array<float,2>{0.635991991f, 0.809373796f},
-std::array<float,2>{0.931852221f, 0.129079565f},
-std::array<float,2>{0.0985787287f, 0.522570252f},
-std::array<float,2>{0.171962753f, 0.0701275989f},
-std::array<float,2>{0.785999656f, 0.747862875f},
-std::array<float,2>{0.620140314f, 0.40603143f},
-std::array<float,2>{0.284659117f, 0.950856864f},
-std::array<float,2>{0.371465236f, 0.219461039f},
-std::array<float,2>{0.501170933f, 0.564321876f},
-std::array<float,2>{0.819070995f, 0.274801493f},
-std::array<float,2>{0.232620418f, 0.843807459f},
-std::array<float,2>{0.0408504456f, 0.499853164f},
-std::array<float,2>{0.939605176f, 0.89573586f},
-std::array<float,2>{0.738275111f, 0.00328085409f},
-std::array<float,2>{0.491283715f, 0.670876145f},
-std::array<float,2>{0.253405899f, 0.412443012f},
-std::array<float,2>{0.576899648f, 0.972179413f},
-std::array<float,2>{0.757001936f, 0.120656081f},
-std::array<float,2>{0.132099897f, 0.715204298f},
-std::array<float,2>{0.0828042924f, 0.183870718f},
-std::array<float,2>{0.897252858f, 0.558918118f},
-std::array<float,2>{0.657865882f, 0.361463726f},
-std::array<float,2>{0.429026634f, 0.77570498f},
-std::array<float,2>{0.4501293f, 0.052339986f},
-std::array<float,2>{0.715283275f, 0.635535836f},
-std::array<float,2>{0.983207107f, 0.457593709f},
-std::array<float,2>{0.00826698821f, 0.936845183f},
-std::array<float,2>{0.193574786f, 0.283654362f},
-std::array<float,2>{0.84617424f, 0.827171266f},
-std::array<float,2>{0.558868289f, 0.208043933f},
-std::array<float,2>{0.342621863f, 0.624800622f},
-std::array<float,2>{0.327337861f, 0.260206878f},
-std::array<float,2>{0.537233651f, 0.864583611f},
-std::array<float,2>{0.867775321f, 0.24582541f},
-std::array<float,2>{0.206674248f, 0.58743155f},
-std::array<float,2>{0.0216496903f, 0.024412917f},
-std::array<float,2>{0.987047553f, 0.686843753f},
-std::array<float,2>{0.696549952f, 0.469296783f},
-std::array<float,2>{0.46445629f, 0.884052098f},
-std::array<float,2>{0.409784108f, 0.143681303f},
-std::array<float,2>{0.683513999f, 0.508346379f},
-std::array<float,2>{0.890280247f, 0.341925263f},
-std::array<float,2>{0.0686992109f, 0.794949591f},
-std::array<float,2>{0.1535898f, 0.387335747f},
-std::array<float,2>{0.769482136f, 0.965318561f},
-std::array<float,2>{0.586556733f, 0.0825772062f},
-std::array<float,2>{0.271529734f, 0.72558707f},
-std::array<float,2>{0.473606646f, 0.450095743f},
-std::array<float,2>{0.722654641f, 0.920577109f},
-std::array<float,2>{0.959807396f, 0.0431583747f},
-std::array<float,2>{0.0577857457f, 0.649143875f},
-std::array<float,2>{0.235386297f, 0.188939318f},
-std::array<float,2>{0.8400051f, 0.595850646f},
-std::array<float,2>{0.516503215f, 0.310324997f},
-std::array<float,2>{0.355405569f, 0.842918336f},
-std::array<float,2>{0.306719571f, 0.109367773f},
-std::array<float,2>{0.597768903f, 0.69634378f},
-std::array<float,2>{0.799614847f, 0.431193113f},
-std::array<float,2>{0.15893586f, 0.98548013f},
-std::array<float,2>{0.123759486f, 0.350215197f},
-std::array<float,2>{0.909218788f, 0.763978004f},
-std::array<float,2>{0.647809327f, 0.169616327f},
-std::array<float,2>{0.376198441f, 0.531556308f},
-std::array<float,2>{0.459890515f, 0.299325019f},
-std::array<float,2>{0.68905431f, 0.832560956f},
-std::array<float,2>{0.999052525f, 0.198070511f},
-std::array<float,2>{0.0289276615f, 0.606452763f},
-std::array<float,2>{0.211328849f, 0.0331242904f},
-std::array<float,2>{0.863491118f, 0.644413114f},
-std::array<float,2>{0.539562523f, 0.440434158f},
-std::array<float,2>{0.318250895f, 0.910401583f},
-std::array<float,2>{0.273980141f, 0.161294714f},
-std::array<float,2>{0.579175055f, 0.544795513f},
-std::array<float,2>{0.775287449f, 0.353134543f},
-std::array<float,2>{0.141826302f, 0.755310714f},
-std::array<float,2>{0.0705932304f, 0.422370911f},
-std::array<float,2>{0.877804458f, 0.999134302f},
-std::array<float,2>{0.678879082f, 0.0940286815f},
-std::array<float,2>{0.417285115f, 0.691478789f},
-std::array<float,2>{0.350380063f, 0.482114971f},
-std::array<float,2>{0.529095411f, 0.876461446f},
-std::array<float,2>{0.83321178f, 0.0192612037f},
-std::array<float,2>{0.244047195f, 0.679502308f},
-std::array<float,2>{0.0506253429f, 0.235671937f},
-std::array<float,2>{0.965297341f, 0.583828866f},
-std::array<float,2>{0.732692659f, 0.253221422f},
-std::array<float,2>{0.480786562f, 0.873179018f},
-std::array<float,2>{0.384002179f, 0.0878388286f},
-std::array<float,2>{0.650170088f, 0.732572794f},
-std::array<float,2>{0.916692734f, 0.380184501f},
-std::array<float,2>{0.111988313f, 0.955645561f},
-std::array<float,2>{0.170896098f, 0.330539733f},
-std::array<float,2>{0.806987762f, 0.787533939f},
-std::array<float,2>{0.606865883f, 0.151440471f},
-std::array<float,2>{0.303165585f, 0.503017187f},
-std::array<float,2>{0.296492279f, 0.374793857f},
-std::array<float,2>{0.614126027f, 0.76866585f},
-std::array<float,2>{0.78929919f, 0.176112071f},
-std::array<float,2>{0.181505084f, 0.55374068f},
-std::array<float,2>{0.102627963f, 0.109481461f},
-std::array<float,2>{0.922027349f, 0.704432726f},
-std::array<float,2>{0.630445004f, 0.416311204f},
-std::array<float,2>{0.401296318f, 0.981745422f},
-std::array<float,2>{0.493528903f, 0.214959368f},
-std::array<float,2>{0.743623912f, 0.612743974f},
-std::array<float,2>{0.951969624f, 0.290230006f},
-std::array<float,2>{0.0332711823f, 0.814345896f},
-std::array<float,2>{0.221734419f, 0.465054303f},
-std::array<float,2>{0.823730528f, 0.928113163f},
-std::array<float,2>{0.512738466f, 0.0596296825f},
-std::array<float,2>{0.363008171f, 0.625839114f},
-std::array<float,2>{0.435146511f, 0.393652439f},
-std::array<float,2>{0.666413128f, 0.93770057f},
-std::array<float,2>{0.899067342f, 0.073056303f},
-std::array<float,2>{0.0914840996f, 0.738756239f},
-std::array<float,2>{0.140243575f, 0.139565527f},
-std::array<float,2>{0.758418679f, 0.52686125f},
-std::array<float,2>{0.568987668f, 0.327873766f},
-std::array<float,2>{0.258995086f, 0.799280405f},
-std::array<float,2>{0.331702024f, 0.0117413588f},
-std::array<float,2>{0.551249146f, 0.663486063f},
-std::array<float,2>{0.85550648f, 0.485611171f},
-std::array<float,2>{0.200629145f, 0.905331194f},
-std::array<float,2>{0.00575819286f, 0.268888921f},
-std::array<float,2>{0.974881291f, 0.853456914f},
-std::array<float,2>{0.707079768f, 0.229439244f},
-std::array<float,2>{0.441937745f, 0.577656269f},
-std::array<float,2>{0.418183088f, 0.277524233f},
-std::array<float,2>{0.673054516f, 0.847807407f},
-std::array<float,2>{0.881803215f, 0.225007206f},
-std::array<float,2>{0.0763075575f, 0.567974508f},
-std::array<float,2>{0.145873129f, 0.004738566f},
-std::array<float,2>{0.779603422f, 0.667307436f},
-std::array<float,2>{0.584039092f, 0.494877964f},
-std::array<float,2>{0.278690279f, 0.893582642f},
-std::array<float,2>{0.313450485f, 0.126511693f},
-std::array<float,2>{0.544310629f, 0.517252326f},
-std::array<float,2>{0.860317469f, 0.317015976f},
-std::array<float,2>{0.217674792f, 0.807101607f},
-std::array<float,2>{0.0258446131f, 0.401481926f},
-std::array<float,2>{0.993202031f, 0.948423922f},
-std::array<float,2>{0.693212271f, 0.0653579161f},
-std::array<float,2>{0.456861675f, 0.74463886f},
-std::array<float,2>{0.297117591f, 0.453189015f},
-std::array<float,2>{0.601658046f, 0.933166504f},
-std::array<float,2>{0.811632812f, 0.0500153676f},
-std::array<float,2>{0.167161807f, 0.636917531f},
-std::array<float,2>{0.113812104f, 0.204902694f},
-std::array<float,2>{0.919855297f, 0.620762348f},
-std::array<float,2>{0.656123102f, 0.285569519f},
-std::array<float,2>{0.387328595f, 0.820766866f},
-std::array<float,2>{0.477282554f, 0.124045879f},
-std::array<float,2>{0.72808826f, 0.711068869f},
-std::array<float,2>{0.961974621f, 0.409549832f},
-std::array<float,2>{0.0527223274f, 0.976180017f},
-std::array<float,2>{0.247686282f, 0.365522265f},
-std::array<float,2>{0.82979697f, 0.781070888f},
-std::array<float,2>{0.524448037f, 0.179780662f},
-std::array<float,2>{0.34735778f, 0.557088435f},
-std::array<float,2>{0.366607577f, 0.33820647f},
-std::array<float,2>{0.509311378f, 0.790109575f},
-std::array<float,2>{0.827814639f, 0.147719294f},
-std::array<float,2>{0.223142698f, 0.51314944f},
-std::array<float,2>{0.03849338f, 0.0781419352f},
-std::array<float,2>{0.946490884f, 0.721744299f},
-std::array<float,2>{0.748714268f, 0.383074701f},
-std::array<float,2>{0.497570992f, 0.962622821f},
-std::array<float,2>{0.40451476f, 0.24851203f},
-std::array<float,2>{0.625222564f, 0.592222273f},
-std::array<float,2>{0.928283513f, 0.263974398f},
-std::array<float,2>{0.106427878f, 0.862183571f},
-std::array<float,2>{0.185621455f, 0.476381391f},
-std::array<float,2>{0.796164632f, 0.888042331f},
-std::array<float,2>{0.612647235f, 0.0301470924f},
-std::array<float,2>{0.291715264f, 0.681732357f},
-std::array<float,2>{0.439268202f, 0.437387198f},
-std::array<float,2>{0.703314841f, 0.99089098f},
-std::array<float,2>{0.969231725f, 0.101772897f},
-std::array<float,2>{0.00189035246f, 0.702153742f},
-std::array<float,2>{0.198304534f, 0.165768489f},
-std::array<float,2>{0.852951646f, 0.535634935f},
-std::array<float,2>{0.548164725f, 0.346306294f},
-std::array<float,2>{0.334720194f, 0.759837389f},
-std::array<float,2>{0.263720334f, 0.0408433266f},
-std::array<float,2>{0.563985646f, 0.655035973f},
-std::array<float,2>{0.762090683f, 0.446526289f},
-std::array<float,2>{0.134392977f, 0.917600751f},
-std::array<float,2>{0.0871662721f, 0.306818783f},
-std::array<float,2>{0.906189084f, 0.838918686f},
-std::array<float,2>{0.668695033f, 0.194388077f},
-std::array<float,2>{0.430430263f, 0.600282311f},
-std::array<float,2>{0.485952556f, 0.357511282f},
-std::array<float,2>{0.738633037f, 0.751476645f},
-std::array<float,2>{0.942163885f, 0.159997419f},
-std::array<float,2>{0.0433964804f, 0.54221344f},
-std::array<float,2>{0.22811f, 0.100869074f},
-std::array<float,2>{0.814572692f, 0.688832045f},
-std::array<float,2>{0.505511165f, 0.426995426f},
-std::array<float,2>{0.367714584f, 0.994626939f},
-std::array<float,2>{0.28831929f, 0.201764479f},
-std::array<float,2>{0.621770799f, 0.60245204f},
-std::array<float,2>{0.785135925f, 0.304421782f},
-std::array<float,2>{0.178942412f, 0.831633508f},
-std::array<float,2>{0.0952686444f, 0.44462198f},
-std::array<float,2>{0.93561244f, 0.907972932f},
-std::array<float,2>{0.637656868f, 0.0380732343f},
-std::array<float,2>{0.397458732f, 0.647318721f},
-std::array<float,2>{0.339554459f, 0.378685027f},
-std::array<float,2>{0.557900131f, 0.960428178f},
-std::array<float,2>{0.851049542f, 0.0912797526f},
-std::array<float,2>{0.188020125f, 0.729892135f},
-std::array<float,2>{0.0137333144f, 0.153962418f},
-std::array<float,2>{0.977787077f, 0.506267965f},
-std::array<float,2>{0.712105274f, 0.332571059f},
-std::array<float,2>{0.446773142f, 0.784689546f},
-std::array<float,2>{0.422433406f, 0.0218550358f},
-std::array<float,2>{0.662157238f, 0.672401607f},
-std::array<float,2>{0.894039035f, 0.476831526f},
-std::array<float,2>{0.0803482085f, 0.880265653f},
-std::array<float,2>{0.126259878f, 0.256731987f},
-std::array<float,2>{0.751894891f, 0.868693709f},
-std::array<float,2>{0.571868181f, 0.241660491f},
-std::array<float,2>{0.254332006f, 0.578799605f},
-std::array<float,2>{0.268155515f, 0.296530992f},
-std::array<float,2>{0.590850115f, 0.816803932f},
-std::array<float,2>{0.772023261f, 0.211033419f},
-std::array<float,2>{0.151043802f, 0.614101648f},
-std::array<float,2>{0.0645555109f, 0.0551450141f},
-std::array<float,2>{0.884545088f, 0.63070935f},
-std::array<float,2>{0.685725451f, 0.46178472f},
-std::array<float,2>{0.411091685f, 0.925337315f},
-std::array<float,2>{0.465866029f, 0.174590006f},
-std::array<float,2>{0.70018518f, 0.548888743f},
-std::array<float,2>{0.989015281f, 0.368214399f},
-std::array<float,2>{0.0172109082f, 0.770995259f},
-std::array<float,2>{0.208385006f, 0.42124626f},
-std::array<float,2>{0.874513865f, 0.977380872f},
-std::array<float,2>{0.532125354f, 0.114699095f},
-std::array<float,2>{0.322570086f, 0.7075845f},
-std::array<float,2>{0.378954738f, 0.491998583f},
-std::array<float,2>{0.64165771f, 0.901398361f},
-std::array<float,2>{0.912498593f, 0.00877467263f},
-std::array<float,2>{0.120222457f, 0.657339633f},
-std::array<float,2>{0.161574379f, 0.232070878f},
-std::array<float,2>{0.801033854f, 0.571527064f},
-std::array<float,2>{0.595196307f, 0.27130124f},
-std::array<float,2>{0.311606228f, 0.856558263f},
-std::array<float,2>{0.358816236f, 0.0755593628f},
-std::array<float,2>{0.521477163f, 0.73786515f},
-std::array<float,2>{0.837611735f, 0.397309899f},
-std::array<float,2>{0.240801886f, 0.943809986f},
-std::array<float,2>{0.0602874123f, 0.321207702f},
-std::array<float,2>{0.956196606f, 0.802119672f},
-std::array<float,2>{0.723372698f, 0.136242747f},
-std::array<float,2>{0.47160843f, 0.528924525f},
-std::array<float,2>{0.388489246f, 0.364628285f},
-std::array<float,2>{0.655230641f, 0.777536809f},
-std::array<float,2>{0.918244362f, 0.181759611f},
-std::array<float,2>{0.11515744f, 0.554764509f},
-std::array<float,2>{0.16645436f, 0.122962557f},
-std::array<float,2>{0.810800493f, 0.713016868f},
-std::array<float,2>{0.603456855f, 0.406867802f},
-std::array<float,2>{0.298561275f, 0.97299844f},
-std::array<float,2>{0.346063137f, 0.205449432f},
-std::array<float,2>{0.524205029f, 0.617924094f},
-std::array<float,2>{0.82847017f, 0.287533522f},
-std::array<float,2>{0.246513635f, 0.823853076f},
-std::array<float,2>{0.0513047501f, 0.455392957f},
-std::array<float,2>{0.961657107f, 0.930085957f},
-std::array<float,2>{0.726841927f, 0.048072435f},
-std::array<float,2>{0.478500336f, 0.639238775f},
-std::array<float,2>{0.277687997f, 0.399544209f},
-std::array<float,2>{0.585875809f, 0.945892155f},
-std::array<float,2>{0.780623555f, 0.0638033524f},
-std::array<float,2>{0.145154595f, 0.7431373f},
-std::array<float,2>{0.0775123164f, 0.127286404f},
-std::array<float,2>{0.881930113f, 0.517626107f},
-std::array<float,2>{0.672036171f, 0.319631785f},
-std::array<float,2>{0.419267356f, 0.805502117f},
-std::array<float,2>{0.455219865f, 0.00609241147f},
-std::array<float,2>{0.691615701f, 0.665434659f},
-std::array<float,2>{0.992380261f, 0.493143916f},
-std::array<float,2>{0.0270965267f, 0.891075253f},
-std::array<float,2>{0.217850253f, 0.281188667f},
-std::array<float,2>{0.860435843f, 0.851462781f},
-std::array<float,2>{0.543266773f, 0.223378375f},
-std::array<float,2>{0.31380561f, 0.569379687f},
-std::array<float,2>{0.335458219f, 0.306425124f},
-std::array<float,2>{0.547295928f, 0.836442709f},
-std::array<float,2>{0.852254689f, 0.192910016f},
-std::array<float,2>{0.198236644f, 0.59851706f},
-std::array<float,2>{0.000118802127f, 0.0412836671f},
-std::array<float,2>{0.969728053f, 0.653500319f},
-std::array<float,2>{0.704248905f, 0.448826104f},
-std::array<float,2>{0.43761757f, 0.914204061f},
-std::array<float,2>{0.431030989f, 0.167303994f},
-std::array<float,2>{0.669355989f, 0.538878918f},
-std::array<float,2>{0.904996276f, 0.344056129f},
-std::array<float,2>{0.0860702395f, 0.759448647f},
-std::array<float,2>{0.132815748f, 0.43377319f},
-std::array<float,2>{0.762787282f, 0.989414036f},
-std::array<float,2>{0.56250006f, 0.105045736f},
-std::array<float,2>{0.265565097f, 0.701133013f},
-std::array<float,2>{0.496929944f, 0.473947734f},
-std::array<float,2>{0.749028444f, 0.890219569f},
-std::array<float,2>{0.945531011f, 0.0290758926f},
-std::array<float,2>{0.0375434943f, 0.680155277f},
-std::array<float,2>{0.224071264f, 0.246622145f},
-std::array<float,2>{0.826556146f, 0.590614259f},
-std::array<float,2>{0.507939816f, 0.262625486f},
-std::array<float,2>{0.365647405f, 0.859892666f},
-std::array<float,2>{0.292534769f, 0.0809141546f},
-std::array<float,2>{0.611531198f, 0.720625281f},
-std::array<float,2>{0.795184374f, 0.386332482f},
-std::array<float,2>{0.187366441f, 0.964072466f},
-std::array<float,2>{0.107192464f, 0.337862611f},
-std::array<float,2>{0.929656148f, 0.792213619f},
-std::array<float,2>{0.626555085f, 0.14613013f},
-std::array<float,2>{0.405303836f, 0.515618801f},
-std::array<float,2>{0.445973277f, 0.255307645f},
-std::array<float,2>{0.711821318f, 0.869558454f},
-std::array<float,2>{0.97689718f, 0.240181759f},
-std::array<float,2>{0.0151429465f, 0.580638647f},
-std::array<float,2>{0.189198941f, 0.0208974704f},
-std::array<float,2>{0.849947095f, 0.674602389f},
-std::array<float,2>{0.557292819f, 0.480150104f},
-std::array<float,2>{0.33842212f, 0.881715059f},
-std::array<float,2>{0.25543496f, 0.154749334f},
-std::array<float,2>{0.570550025f, 0.50502944f},
-std::array<float,2>{0.750555336f, 0.334685624f},
-std::array<float,2>{0.125613108f, 0.781333983f},
-std::array<float,2>{0.0810594261f, 0.375656873f},
-std::array<float,2>{0.892932475f, 0.958970368f},
-std::array<float,2>{0.663361967f, 0.0927901641f},
-std::array<float,2>{0.423194945f, 0.726617396f},
-std::array<float,2>{0.368639231f, 0.44241783f},
-std::array<float,2>{0.504091799f, 0.910035193f},
-std::array<float,2>{0.815900624f, 0.0358781479f},
-std::array<float,2>{0.226588592f, 0.645859361f},
-std::array<float,2>{0.0449139141f, 0.199372575f},
-std::array<float,2>{0.942546546f, 0.6037516f},
-std::array<float,2>{0.73972851f, 0.301015764f},
-std::array<float,2>{0.485053033f, 0.828665376f},
-std::array<float,2>{0.397765577f, 0.0984213054f},
-std::array<float,2>{0.638055205f, 0.691028476f},
-std::array<float,2>{0.936963439f, 0.42890951f},
-std::array<float,2>{0.0942541659f, 0.99294132f},
-std::array<float,2>{0.17800951f, 0.357319474f},
-std::array<float,2>{0.783873975f, 0.752325118f},
-std::array<float,2>{0.6225214f, 0.157517537f},
-std::array<float,2>{0.287763208f, 0.540703654f},
-std::array<float,2>{0.31072253f, 0.323391318f},
-std::array<float,2>{0.594417334f, 0.803993285f},
-std::array<float,2>{0.802382767f, 0.13327378f},
-std::array<float,2>{0.160238817f, 0.530353904f},
-std::array<float,2>{0.11996343f, 0.0778111964f},
-std::array<float,2>{0.913515031f, 0.735695183f},
-std::array<float,2>{0.640773952f, 0.39548558f},
-std::array<float,2>{0.380419821f, 0.943038404f},
-std::array<float,2>{0.47194472f, 0.233396858f},
-std::array<float,2>{0.724479675f, 0.573945343f},
-std::array<float,2>{0.955622077f, 0.272718072f},
-std::array<float,2>{0.058650393f, 0.859250247f},
-std::array<float,2>{0.241664425f, 0.489519089f},
-std::array<float,2>{0.836646497f, 0.898750007f},
-std::array<float,2>{0.519603372f, 0.0110797407f},
-std::array<float,2>{0.35813871f, 0.659017742f},
-std::array<float,2>{0.412033975f, 0.419921219f},
-std::array<float,2>{0.686860979f, 0.979105175f},
-std::array<float,2>{0.883141816f, 0.117037371f},
-std::array<float,2>{0.0657588169f, 0.710408568f},
-std::array<float,2>{0.151640952f, 0.172368824f},
-std::array<float,2>{0.773030579f, 0.547600806f},
-std::array<float,2>{0.590796113f, 0.369322181f},
-std::array<float,2>{0.268571764f, 0.771635652f},
-std::array<float,2>{0.323586553f, 0.0580838509f},
-std::array<float,2>{0.533016264f, 0.63144505f},
-std::array<float,2>{0.8730762f, 0.463554174f},
-std::array<float,2>{0.207592383f, 0.922898412f},
-std::array<float,2>{0.0161419809f, 0.294433475f},
-std::array<float,2>{0.989996433f, 0.819835365f},
-std::array<float,2>{0.700403214f, 0.214253858f},
-std::array<float,2>{0.465059668f, 0.6162256f},
-std::array<float,2>{0.428048551f, 0.282758236f},
-std::array<float,2>{0.65683198f, 0.824843168f},
-std::array<float,2>{0.897802234f, 0.210899442f},
-std::array<float,2>{0.0832029432f, 0.621824741f},
-std::array<float,2>{0.131158397f, 0.0531099774f},
-std::array<float,2>{0.755877554f, 0.633971155f},
-std::array<float,2>{0.577384531f, 0.459434897f},
-std::array<float,2>{0.25252381f, 0.933716953f},
-std::array<float,2>{0.343078375f, 0.186764792f},
-std::array<float,2>{0.559579313f, 0.56170702f},
-std::array<float,2>{0.847390652f, 0.361225128f},
-std::array<float,2>{0.195257232f, 0.774901688f},
-std::array<float,2>{0.00941674411f, 0.41146636f},
-std::array<float,2>{0.984124899f, 0.970551193f},
-std::array<float,2>{0.716779768f, 0.118021168f},
-std::array<float,2>{0.450327963f, 0.717627287f},
-std::array<float,2>{0.283274382f, 0.497431397f},
-std::array<float,2>{0.620096266f, 0.898046792f},
-std::array<float,2>{0.787049532f, 0.000378186756f},
-std::array<float,2>{0.173611417f, 0.668860316f},
-std::array<float,2>{0.0992927179f, 0.22185266f},
-std::array<float,2>{0.933363199f, 0.565464199f},
-std::array<float,2>{0.635356605f, 0.275855243f},
-std::array<float,2>{0.392417252f, 0.845992982f},
-std::array<float,2>{0.490736753f, 0.0676891804f},
-std::array<float,2>{0.737180352f, 0.748905301f},
-std::array<float,2>{0.940907955f, 0.403173506f},
-std::array<float,2>{0.0391963646f, 0.951461732f},
-std::array<float,2>{0.234314382f, 0.31422174f},
-std::array<float,2>{0.819619656f, 0.811554909f},
-std::array<float,2>{0.500733793f, 0.132665664f},
-std::array<float,2>{0.372180909f, 0.519884944f},
-std::array<float,2>{0.35369423f, 0.349589735f},
-std::array<float,2>{0.517065108f, 0.762284994f},
-std::array<float,2>{0.841359854f, 0.171607554f},
-std::array<float,2>{0.23506248f, 0.533342481f},
-std::array<float,2>{0.0575464293f, 0.106837071f},
-std::array<float,2>{0.960051715f, 0.698945582f},
-std::array<float,2>{0.721400321f, 0.4334988f},
-std::array<float,2>{0.473872095f, 0.986673355f},
-std::array<float,2>{0.375340462f, 0.190595329f},
-std::array<float,2>{0.647167504f, 0.595074832f},
-std::array<float,2>{0.908228636f, 0.310823351f},
-std::array<float,2>{0.124044456f, 0.840414762f},
-std::array<float,2>{0.159447119f, 0.453033864f},
-std::array<float,2>{0.80045563f, 0.918359637f},
-std::array<float,2>{0.598711193f, 0.0457625799f},
-std::array<float,2>{0.308037251f, 0.65221709f},
-std::array<float,2>{0.463097811f, 0.38912338f},
-std::array<float,2>{0.695632935f, 0.968492627f},
-std::array<float,2>{0.988210022f, 0.0858721584f},
-std::array<float,2>{0.0226076171f, 0.724258304f},
-std::array<float,2>{0.205738455f, 0.141925588f},
-std::array<float,2>{0.868177652f, 0.51036334f},
-std::array<float,2>{0.538123786f, 0.340720713f},
-std::array<float,2>{0.326179236f, 0.794633567f},
-std::array<float,2>{0.273136884f, 0.0257590692f},
-std::array<float,2>{0.587293029f, 0.684354722f},
-std::array<float,2>{0.768321514f, 0.472575158f},
-std::array<float,2>{0.15327473f, 0.885087669f},
-std::array<float,2>{0.0702299774f, 0.257852256f},
-std::array<float,2>{0.889543355f, 0.866477549f},
-std::array<float,2>{0.681995034f, 0.243048817f},
-std::array<float,2>{0.409162849f, 0.5886361f},
-std::array<float,2>{0.481580168f, 0.329621434f},
-std::array<float,2>{0.733436406f, 0.785475791f},
-std::array<float,2>{0.966633856f, 0.150348887f},
-std::array<float,2>{0.0494166873f, 0.500757813f},
-std::array<float,2>{0.242233962f, 0.0897061005f},
-std::array<float,2>{0.832034826f, 0.730895996f},
-std::array<float,2>{0.527597189f, 0.381933331f},
-std::array<float,2>{0.351012439f, 0.954492033f},
-std::array<float,2>{0.304335237f, 0.2379338f},
-std::array<float,2>{0.606332064f, 0.584440589f},
-std::array<float,2>{0.808461964f, 0.251929402f},
-std::array<float,2>{0.171113402f, 0.871823132f},
-std::array<float,2>{0.112661824f, 0.483530819f},
-std::array<float,2>{0.917599618f, 0.877023041f},
-std::array<float,2>{0.649168015f, 0.0163071081f},
-std::array<float,2>{0.383143514f, 0.676231325f},
-std::array<float,2>{0.317018628f, 0.425290734f},
-std::array<float,2>{0.540730059f, 0.997253656f},
-std::array<float,2>{0.864484489f, 0.0963597894f},
-std::array<float,2>{0.21245715f, 0.694869637f},
-std::array<float,2>{0.0275573321f, 0.162179917f},
-std::array<float,2>{0.998862863f, 0.546412647f},
-std::array<float,2>{0.688279092f, 0.354029804f},
-std::array<float,2>{0.460676432f, 0.757214725f},
-std::array<float,2>{0.416383833f, 0.0333177671f},
-std::array<float,2>{0.677838087f, 0.640812039f},
-std::array<float,2>{0.878663301f, 0.438161373f},
-std::array<float,2>{0.0722158179f, 0.912126303f},
-std::array<float,2>{0.141258121f, 0.29747346f},
-std::array<float,2>{0.774200678f, 0.835845232f},
-std::array<float,2>{0.578995109f, 0.196967885f},
-std::array<float,2>{0.275197029f, 0.609344125f},
-std::array<float,2>{0.258515418f, 0.265720725f},
-std::array<float,2>{0.570081294f, 0.854791164f},
-std::array<float,2>{0.759608507f, 0.227137029f},
-std::array<float,2>{0.139495477f, 0.575066209f},
-std::array<float,2>{0.0903573707f, 0.0138060963f},
-std::array<float,2>{0.900211096f, 0.662016988f},
-std::array<float,2>{0.667066693f, 0.487077981f},
-std::array<float,2>{0.433743715f, 0.903851092f},
-std::array<float,2>{0.443291932f, 0.136848599f},
-std::array<float,2>{0.708383977f, 0.523729146f},
-std::array<float,2>{0.976073921f, 0.324730366f},
-std::array<float,2>{0.00478931097f, 0.798409283f},
-std::array<float,2>{0.199790895f, 0.390887737f},
-std::array<float,2>{0.857153118f, 0.941003442f},
-std::array<float,2>{0.552384794f, 0.0718303546f},
-std::array<float,2>{0.330432326f, 0.740656793f},
-std::array<float,2>{0.402156919f, 0.467828423f},
-std::array<float,2>{0.629846931f, 0.926922739f},
-std::array<float,2>{0.923514783f, 0.060851004f},
-std::array<float,2>{0.101783685f, 0.626989484f},
-std::array<float,2>{0.179884851f, 0.217031226f},
-std::array<float,2>{0.790521264f, 0.61105299f},
-std::array<float,2>{0.61504668f, 0.291214377f},
-std::array<float,2>{0.295887589f, 0.814770281f},
-std::array<float,2>{0.361798376f, 0.113138855f},
-std::array<float,2>{0.512331367f, 0.705900252f},
-std::array<float,2>{0.822289526f, 0.414826185f},
-std::array<float,2>{0.2215617f, 0.983294785f},
-std::array<float,2>{0.0343103819f, 0.372599959f},
-std::array<float,2>{0.952590108f, 0.766976714f},
-std::array<float,2>{0.742300212f, 0.179412693f},
-std::array<float,2>{0.492726356f, 0.551846743f},
-std::array<float,2>{0.420322597f, 0.317240596f},
-std::array<float,2>{0.673920751f, 0.806851506f},
-std::array<float,2>{0.879010022f, 0.12679556f},
-std::array<float,2>{0.0749343634f, 0.517440438f},
-std::array<float,2>{0.148120806f, 0.0650000423f},
-std::array<float,2>{0.778223813f, 0.745027125f},
-std::array<float,2>{0.58323741f, 0.401763082f},
-std::array<float,2>{0.280545801f, 0.948506951f},
-std::array<float,2>{0.316227376f, 0.224722117f},
-std::array<float,2>{0.546098828f, 0.56819874f},
-std::array<float,2>{0.8618747f, 0.277620077f},
-std::array<float,2>{0.215492725f, 0.848045707f},
-std::array<float,2>{0.0253407527f, 0.494633377f},
-std::array<float,2>{0.99501729f, 0.893954694f},
-std::array<float,2>{0.693738103f, 0.00445790403f},
-std::array<float,2>{0.454272687f, 0.667184174f},
-std::array<float,2>{0.29945448f, 0.409196854f},
-std::array<float,2>{0.60525763f, 0.976339102f},
-std::array<float,2>{0.808607161f, 0.124329023f},
-std::array<float,2>{0.164416671f, 0.711406827f},
-std::array<float,2>{0.116679765f, 0.180173382f},
-std::array<float,2>{0.920122027f, 0.556798577f},
-std::array<float,2>{0.65344286f, 0.365465909f},
-std::array<float,2>{0.388888061f, 0.780928612f},
-std::array<float,2>{0.479805797f, 0.0502266437f},
-std::array<float,2>{0.728717506f, 0.636970222f},
-std::array<float,2>{0.962990642f, 0.453596979f},
-std::array<float,2>{0.0540232621f, 0.933496058f},
-std::array<float,2>{0.249293f, 0.285334885f},
-std::array<float,2>{0.83090657f, 0.820541024f},
-std::array<float,2>{0.525964975f, 0.20459187f},
-std::array<float,2>{0.345616847f, 0.620955348f},
-std::array<float,2>{0.36496827f, 0.263795882f},
-std::array<float,2>{0.510839999f, 0.861938715f},
-std::array<float,2>{0.824714839f, 0.248281181f},
-std::array<float,2>{0.226344958f, 0.59203434f},
-std::array<float,2>{0.0355408825f, 0.0300265979f},
-std::array<float,2>{0.948228896f, 0.682116568f},
-std::array<float,2>{0.747614622f, 0.476255774f},
-std::array<float,2>{0.499385178f, 0.887736022f},
-std::array<float,2>{0.404159278f, 0.147671506f},
-std::array<float,2>{0.628011703f, 0.512907803f},
-std::array<float,2>{0.926269591f, 0.33792454f},
-std::array<float,2>{0.108429708f, 0.790339947f},
-std::array<float,2>{0.18486169f, 0.382991761f},
-std::array<float,2>{0.792978644f, 0.962670445f},
-std::array<float,2>{0.609935522f, 0.0785645023f},
-std::array<float,2>{0.290875554f, 0.721958697f},
-std::array<float,2>{0.440575987f, 0.44673866f},
-std::array<float,2>{0.7054075f, 0.917739809f},
-std::array<float,2>{0.971519351f, 0.0406416692f},
-std::array<float,2>{0.00296581746f, 0.654795349f},
-std::array<float,2>{0.195877388f, 0.194591999f},
-std::array<float,2>{0.85499388f, 0.600450575f},
-std::array<float,2>{0.548828423f, 0.306986302f},
-std::array<float,2>{0.332146615f, 0.839223385f},
-std::array<float,2>{0.262737572f, 0.101836778f},
-std::array<float,2>{0.565397859f, 0.702439547f},
-std::array<float,2>{0.764078319f, 0.437014371f},
-std::array<float,2>{0.136130199f, 0.991092622f},
-std::array<float,2>{0.0886660814f, 0.346444249f},
-std::array<float,2>{0.903313398f, 0.760119379f},
-std::array<float,2>{0.670412064f, 0.165944159f},
-std::array<float,2>{0.431828707f, 0.53525871f},
-std::array<float,2>{0.488256037f, 0.304519325f},
-std::array<float,2>{0.741989911f, 0.831881046f},
-std::array<float,2>{0.944062829f, 0.202049434f},
-std::array<float,2>{0.0466777533f, 0.602232814f},
-std::array<float,2>{0.230003402f, 0.0376984477f},
-std::array<float,2>{0.812703371f, 0.647045851f},
-std::array<float,2>{0.506275415f, 0.444528341f},
-std::array<float,2>{0.370324075f, 0.907920957f},
-std::array<float,2>{0.287051797f, 0.159727022f},
-std::array<float,2>{0.624099672f, 0.542320609f},
-std::array<float,2>{0.782191634f, 0.357883275f},
-std::array<float,2>{0.177123576f, 0.751878023f},
-std::array<float,2>{0.0963879451f, 0.427128881f},
-std::array<float,2>{0.933682919f, 0.99434495f},
-std::array<float,2>{0.638913274f, 0.100729614f},
-std::array<float,2>{0.396432698f, 0.688539803f},
-std::array<float,2>{0.336704165f, 0.476709753f},
-std::array<float,2>{0.556109011f, 0.880063474f},
-std::array<float,2>{0.849496126f, 0.0216078963f},
-std::array<float,2>{0.189801112f, 0.672671974f},
-std::array<float,2>{0.0120861363f, 0.241324574f},
-std::array<float,2>{0.978794098f, 0.579078496f},
-std::array<float,2>{0.714689732f, 0.25635162f},
-std::array<float,2>{0.447652876f, 0.868935227f},
-std::array<float,2>{0.424616963f, 0.0910098255f},
-std::array<float,2>{0.661063492f, 0.729696929f},
-std::array<float,2>{0.89158988f, 0.378460526f},
-std::array<float,2>{0.0798391774f, 0.960060596f},
-std::array<float,2>{0.127396137f, 0.332793593f},
-std::array<float,2>{0.753787458f, 0.785022974f},
-std::array<float,2>{0.573482811f, 0.154257268f},
-std::array<float,2>{0.256393194f, 0.506059706f},
-std::array<float,2>{0.266737789f, 0.368524283f},
-std::array<float,2>{0.593086898f, 0.770745933f},
-std::array<float,2>{0.771215618f, 0.174335241f},
-std::array<float,2>{0.14921616f, 0.549169481f},
-std::array<float,2>{0.0630135909f, 0.114342257f},
-std::array<float,2>{0.884769261f, 0.707956553f},
-std::array<float,2>{0.684597611f, 0.420918345f},
-std::array<float,2>{0.412142932f, 0.977195263f},
-std::array<float,2>{0.467499495f, 0.211239249f},
-std::array<float,2>{0.701276898f, 0.613960505f},
-std::array<float,2>{0.99057281f, 0.296792954f},
-std::array<float,2>{0.0183656849f, 0.816462934f},
-std::array<float,2>{0.209142402f, 0.461661398f},
-std::array<float,2>{0.872029126f, 0.925709426f},
-std::array<float,2>{0.533605218f, 0.0546953641f},
-std::array<float,2>{0.321122974f, 0.630475283f},
-std::array<float,2>{0.381872535f, 0.397143096f},
-std::array<float,2>{0.643026173f, 0.943482637f},
-std::array<float,2>{0.910561502f, 0.0754008591f},
-std::array<float,2>{0.118849427f, 0.738074064f},
-std::array<float,2>{0.162742138f, 0.136693135f},
-std::array<float,2>{0.802794635f, 0.529143214f},
-std::array<float,2>{0.596825063f, 0.320816725f},
-std::array<float,2>{0.31031689f, 0.801879525f},
-std::array<float,2>{0.355928808f, 0.0083816098f},
-std::array<float,2>{0.521619737f, 0.657634854f},
-std::array<float,2>{0.838647723f, 0.491737515f},
-std::array<float,2>{0.240095377f, 0.901623189f},
-std::array<float,2>{0.0618620887f, 0.271062374f},
-std::array<float,2>{0.953839123f, 0.856860518f},
-std::array<float,2>{0.726189196f, 0.232292816f},
-std::array<float,2>{0.470328361f, 0.571638763f},
-std::array<float,2>{0.393012434f, 0.27462849f},
-std::array<float,2>{0.632967234f, 0.844187379f},
-std::array<float,2>{0.92996794f, 0.219501868f},
-std::array<float,2>{0.101296663f, 0.564118326f},
-std::array<float,2>{0.174412638f, 0.0029610768f},
-std::array<float,2>{0.787647426f, 0.670520365f},
-std::array<float,2>{0.618048072f, 0.499658346f},
-std::array<float,2>{0.281771749f, 0.895818532f},
-std::array<float,2>{0.373820633f, 0.129305512f},
-std::array<float,2>{0.502935886f, 0.522940874f},
-std::array<float,2>{0.8179304f, 0.315246165f},
-std::array<float,2>{0.231114939f, 0.809184432f},
-std::array<float,2>{0.0413140059f, 0.405995399f},
-std::array<float,2>{0.93887943f, 0.951084793f},
-std::array<float,2>{0.73527211f, 0.0699689612f},
-std::array<float,2>{0.489484847f, 0.747624218f},
-std::array<float,2>{0.25011757f, 0.45782885f},
-std::array<float,2>{0.574749529f, 0.936635554f},
-std::array<float,2>{0.754189432f, 0.0525094345f},
-std::array<float,2>{0.130346105f, 0.635262549f},
-std::array<float,2>{0.0852225795f, 0.208337203f},
-std::array<float,2>{0.894646883f, 0.624512076f},
-std::array<float,2>{0.659900784f, 0.28321895f},
-std::array<float,2>{0.425889403f, 0.827476263f},
-std::array<float,2>{0.451593608f, 0.120949976f},
-std::array<float,2>{0.716820359f, 0.71505928f},
-std::array<float,2>{0.982292712f, 0.412341207f},
-std::array<float,2>{0.010702787f, 0.972649276f},
-std::array<float,2>{0.19175975f, 0.361651063f},
-std::array<float,2>{0.844920635f, 0.775562644f},
-std::array<float,2>{0.562221408f, 0.183783457f},
-std::array<float,2>{0.341397375f, 0.558696568f},
-std::array<float,2>{0.325602829f, 0.342195809f},
-std::array<float,2>{0.53600049f, 0.795269191f},
-std::array<float,2>{0.869156182f, 0.1439794f},
-std::array<float,2>{0.204072148f, 0.508653224f},
-std::array<float,2>{0.0211259667f, 0.0828465819f},
-std::array<float,2>{0.985271871f, 0.725926042f},
-std::array<float,2>{0.698794544f, 0.387567788f},
-std::array<float,2>{0.462265015f, 0.964926064f},
-std::array<float,2>{0.4068546f, 0.245884717f},
-std::array<float,2>{0.680246174f, 0.58769846f},
-std::array<float,2>{0.888303757f, 0.259769857f},
-std::array<float,2>{0.0672754124f, 0.864398718f},
-std::array<float,2>{0.156217054f, 0.469526589f},
-std::array<float,2>{0.766204238f, 0.88381803f},
-std::array<float,2>{0.588756323f, 0.0239472147f},
-std::array<float,2>{0.270893812f, 0.686615765f},
-std::array<float,2>{0.476118207f, 0.431628227f},
-std::array<float,2>{0.719664633f, 0.985656619f},
-std::array<float,2>{0.957411349f, 0.108888276f},
-std::array<float,2>{0.0552838594f, 0.696647286f},
-std::array<float,2>{0.238120437f, 0.169737414f},
-std::array<float,2>{0.842441857f, 0.531314731f},
-std::array<float,2>{0.519437909f, 0.350399166f},
-std::array<float,2>{0.351579934f, 0.763868511f},
-std::array<float,2>{0.305390567f, 0.0433138981f},
-std::array<float,2>{0.601321578f, 0.649366915f},
-std::array<float,2>{0.798148632f, 0.44992891f},
-std::array<float,2>{0.157050923f, 0.920862854f},
-std::array<float,2>{0.122939669f, 0.310091257f},
-std::array<float,2>{0.906604528f, 0.843226552f},
-std::array<float,2>{0.646258235f, 0.188565314f},
-std::array<float,2>{0.377753288f, 0.596140325f},
-std::array<float,2>{0.458054215f, 0.353344023f},
-std::array<float,2>{0.689471662f, 0.755071342f},
-std::array<float,2>{0.997465789f, 0.161454991f},
-std::array<float,2>{0.0303469505f, 0.544545949f},
-std::array<float,2>{0.214766771f, 0.0937777758f},
-std::array<float,2>{0.866494417f, 0.691726625f},
-std::array<float,2>{0.541938424f, 0.422693431f},
-std::array<float,2>{0.319460243f, 0.999339342f},
-std::array<float,2>{0.276207924f, 0.197769478f},
-std::array<float,2>{0.581197023f, 0.606896758f},
-std::array<float,2>{0.775476277f, 0.299612731f},
-std::array<float,2>{0.14365989f, 0.832828641f},
-std::array<float,2>{0.0726279467f, 0.440751076f},
-std::array<float,2>{0.87515384f, 0.910399556f},
-std::array<float,2>{0.676795065f, 0.0328690559f},
-std::array<float,2>{0.414988637f, 0.644166827f},
-std::array<float,2>{0.347670823f, 0.38000524f},
-std::array<float,2>{0.529477715f, 0.956009448f},
-std::array<float,2>{0.835830569f, 0.0875811949f},
-std::array<float,2>{0.244169667f, 0.732701123f},
-std::array<float,2>{0.04856712f, 0.151835233f},
-std::array<float,2>{0.967957139f, 0.503410101f},
-std::array<float,2>{0.732311368f, 0.330100268f},
-std::array<float,2>{0.483680487f, 0.78717941f},
-std::array<float,2>{0.386376351f, 0.0194044728f},
-std::array<float,2>{0.652068198f, 0.679307699f},
-std::array<float,2>{0.915808499f, 0.482262492f},
-std::array<float,2>{0.110625379f, 0.876079917f},
-std::array<float,2>{0.169192508f, 0.253066063f},
-std::array<float,2>{0.805339217f, 0.873319626f},
-std::array<float,2>{0.60786593f, 0.235495254f},
-std::array<float,2>{0.302324325f, 0.583536923f},
-std::array<float,2>{0.293442607f, 0.290319145f},
-std::array<float,2>{0.61669296f, 0.814005673f},
-std::array<float,2>{0.79249841f, 0.215100586f},
-std::array<float,2>{0.181844458f, 0.612327099f},
-std::array<float,2>{0.1053316f, 0.0599350967f},
-std::array<float,2>{0.924597621f, 0.625529587f},
-std::array<float,2>{0.631497622f, 0.465140164f},
-std::array<float,2>{0.399464458f, 0.927839518f},
-std::array<float,2>{0.495313078f, 0.175937444f},
-std::array<float,2>{0.745359421f, 0.554143727f},
-std::array<float,2>{0.950365603f, 0.374702871f},
-std::array<float,2>{0.0331223458f, 0.769016862f},
-std::array<float,2>{0.218851849f, 0.416152954f},
-std::array<float,2>{0.82216382f, 0.981564045f},
-std::array<float,2>{0.515405357f, 0.109730862f},
-std::array<float,2>{0.359794438f, 0.704278886f},
-std::array<float,2>{0.436170399f, 0.485502481f},
-std::array<float,2>{0.664708614f, 0.905696332f},
-std::array<float,2>{0.900835752f, 0.0120547535f},
-std::array<float,2>{0.0919303969f, 0.663299978f},
-std::array<float,2>{0.136897966f, 0.229102075f},
-std::array<float,2>{0.761158347f, 0.578057289f},
-std::array<float,2>{0.568241954f, 0.268642038f},
-std::array<float,2>{0.261405706f, 0.853218615f},
-std::array<float,2>{0.328189552f, 0.0728477314f},
-std::array<float,2>{0.554531515f, 0.738357306f},
-std::array<float,2>{0.858752847f, 0.393887132f},
-std::array<float,2>{0.202973261f, 0.93794167f},
-std::array<float,2>{0.00586692384f, 0.327943623f},
-std::array<float,2>{0.973906219f, 0.798972309f},
-std::array<float,2>{0.710892916f, 0.139251053f},
-std::array<float,2>{0.444519013f, 0.527268827f},
-std::array<float,2>{0.433147997f, 0.344838679f},
-std::array<float,2>{0.671704352f, 0.758376181f},
-std::array<float,2>{0.903451979f, 0.166340724f},
-std::array<float,2>{0.0892700627f, 0.537614465f},
-std::array<float,2>{0.135697484f, 0.104355715f},
-std::array<float,2>{0.765291929f, 0.699473262f},
-std::array<float,2>{0.565514922f, 0.434883475f},
-std::array<float,2>{0.261872798f, 0.989027083f},
-std::array<float,2>{0.333200008f, 0.191876069f},
-std::array<float,2>{0.549875617f, 0.599123955f},
-std::array<float,2>{0.854327321f, 0.305096358f},
-std::array<float,2>{0.196797371f, 0.837077737f},
-std::array<float,2>{0.00239319284f, 0.447308242f},
-std::array<float,2>{0.971716881f, 0.91593045f},
-std::array<float,2>{0.706376433f, 0.0427724831f},
-std::array<float,2>{0.439698279f, 0.652527928f},
-std::array<float,2>{0.289721519f, 0.385739416f},
-std::array<float,2>{0.610921443f, 0.963141501f},
-std::array<float,2>{0.794235706f, 0.0819311216f},
-std::array<float,2>{0.184273735f, 0.719338357f},
-std::array<float,2>{0.108152136f, 0.144871771f},
-std::array<float,2>{0.927706778f, 0.514603972f},
-std::array<float,2>{0.627274215f, 0.336599082f},
-std::array<float,2>{0.402826935f, 0.79114902f},
-std::array<float,2>{0.498996347f, 0.0277699046f},
-std::array<float,2>{0.746710837f, 0.680993974f},
-std::array<float,2>{0.948785841f, 0.473249584f},
-std::array<float,2>{0.0369783454f, 0.889366448f},
-std::array<float,2>{0.224918023f, 0.263521254f},
-std::array<float,2>{0.825450957f, 0.861272633f},
-std::array<float,2>{0.510328174f, 0.247867003f},
-std::array<float,2>{0.363492638f, 0.591647804f},
-std::array<float,2>{0.344447374f, 0.288839579f},
-std::array<float,2>{0.526495576f, 0.822970986f},
-std::array<float,2>{0.831680954f, 0.206673384f},
-std::array<float,2>{0.248091057f, 0.618291497f},
-std::array<float,2>{0.0536586344f, 0.0474322438f},
-std::array<float,2>{0.964381576f, 0.640046716f},
-std::array<float,2>{0.730193675f, 0.456825286f},
-std::array<float,2>{0.479390025f, 0.930747092f},
-std::array<float,2>{0.389903188f, 0.183519572f},
-std::array<float,2>{0.652577579f, 0.556368709f},
-std::array<float,2>{0.921668828f, 0.363869071f},
-std::array<float,2>{0.11569874f, 0.778959453f},
-std::array<float,2>{0.165421695f, 0.407343954f},
-std::array<float,2>{0.809671819f, 0.973772645f},
-std::array<float,2>{0.604093492f, 0.121934339f},
-std::array<float,2>{0.300504088f, 0.714706302f},
-std::array<float,2>{0.453620464f, 0.49321124f},
-std::array<float,2>{0.695266068f, 0.89211297f},
-std::array<float,2>{0.995950103f, 0.00756109925f},
-std::array<float,2>{0.024272697f, 0.664221883f},
-std::array<float,2>{0.216416463f, 0.224547848f},
-std::array<float,2>{0.862828851f, 0.568606973f},
-std::array<float,2>{0.545223117f, 0.279320538f},
-std::array<float,2>{0.315022081f, 0.849798739f},
-std::array<float,2>{0.279738218f, 0.0626199096f},
-std::array<float,2>{0.582562208f, 0.744067967f},
-std::array<float,2>{0.779123425f, 0.399116099f},
-std::array<float,2>{0.146602526f, 0.946633279f},
-std::array<float,2>{0.0761045516f, 0.319017738f},
-std::array<float,2>{0.879903495f, 0.805735767f},
-std::array<float,2>{0.674954653f, 0.128804833f},
-std::array<float,2>{0.421100616f, 0.518665493f},
-std::array<float,2>{0.469377637f, 0.272261858f},
-std::array<float,2>{0.725386381f, 0.857915282f},
-std::array<float,2>{0.954999149f, 0.233867794f},
-std::array<float,2>{0.0610894822f, 0.572529852f},
-std::array<float,2>{0.23858282f, 0.0105954185f},
-std::array<float,2>{0.839726031f, 0.660045326f},
-std::array<float,2>{0.523110747f, 0.48918882f},
-std::array<float,2>{0.356894493f, 0.900160193f},
-std::array<float,2>{0.309231848f, 0.133961648f},
-std::array<float,2>{0.595709443f, 0.529414892f},
-std::array<float,2>{0.804052711f, 0.322413921f},
-std::array<float,2>{0.163437977f, 0.803596377f},
-std::array<float,2>{0.117804386f, 0.395546168f},
-std::array<float,2>{0.911612451f, 0.942270935f},
-std::array<float,2>{0.644028008f, 0.076727286f},
-std::array<float,2>{0.381580085f, 0.734558463f},
-std::array<float,2>{0.32203114f, 0.464235723f},
-std::array<float,2>{0.534186721f, 0.92229712f},
-std::array<float,2>{0.87260586f, 0.057249289f},
-std::array<float,2>{0.210778818f, 0.632112861f},
-std::array<float,2>{0.0191368088f, 0.213258922f},
-std::array<float,2>{0.991257846f, 0.615479052f},
-std::array<float,2>{0.702776194f, 0.293235272f},
-std::array<float,2>{0.468073934f, 0.818647444f},
-std::array<float,2>{0.413331181f, 0.115300268f},
-std::array<float,2>{0.683849692f, 0.709713995f},
-std::array<float,2>{0.886297524f, 0.418884695f},
-std::array<float,2>{0.0641295612f, 0.980271637f},
-std::array<float,2>{0.149885267f, 0.370863587f},
-std::array<float,2>{0.77006954f, 0.772575796f},
-std::array<float,2>{0.591874123f, 0.173012748f},
-std::array<float,2>{0.266080767f, 0.548541009f},
-std::array<float,2>{0.257159263f, 0.335771739f},
-std::array<float,2>{0.573018551f, 0.782909989f},
-std::array<float,2>{0.75197196f, 0.155526221f},
-std::array<float,2>{0.128726318f, 0.504437983f},
-std::array<float,2>{0.0782607123f, 0.0924674422f},
-std::array<float,2>{0.892061949f, 0.728184164f},
-std::array<float,2>{0.661340296f, 0.376743019f},
-std::array<float,2>{0.425106257f, 0.957463562f},
-std::array<float,2>{0.449060559f, 0.238661528f},
-std::array<float,2>{0.7130059f, 0.581218779f},
-std::array<float,2>{0.979552746f, 0.254469156f},
-std::array<float,2>{0.0130288741f, 0.870828688f},
-std::array<float,2>{0.191400573f, 0.478921264f},
-std::array<float,2>{0.848566711f, 0.882337511f},
-std::array<float,2>{0.5554263f, 0.0197287574f},
-std::array<float,2>{0.336945981f, 0.675470889f},
-std::array<float,2>{0.394920826f, 0.42850095f},
-std::array<float,2>{0.639812529f, 0.994058251f},
-std::array<float,2>{0.934762001f, 0.0990823582f},
-std::array<float,2>{0.0969820768f, 0.689486921f},
-std::array<float,2>{0.17661196f, 0.156316087f},
-std::array<float,2>{0.782325804f, 0.539093316f},
-std::array<float,2>{0.623885214f, 0.355854779f},
-std::array<float,2>{0.286026835f, 0.753374934f},
-std::array<float,2>{0.37011525f, 0.0363685898f},
-std::array<float,2>{0.507294118f, 0.645353615f},
-std::array<float,2>{0.814048588f, 0.442176104f},
-std::array<float,2>{0.229372382f, 0.908799469f},
-std::array<float,2>{0.0457904041f, 0.302270979f},
-std::array<float,2>{0.944832325f, 0.829621851f},
-std::array<float,2>{0.740944982f, 0.200362682f},
-std::array<float,2>{0.486613721f, 0.604661763f},
-std::array<float,2>{0.37844032f, 0.311609209f},
-std::array<float,2>{0.645177305f, 0.841399968f},
-std::array<float,2>{0.907633722f, 0.190352723f},
-std::array<float,2>{0.121141717f, 0.594229758f},
-std::array<float,2>{0.157394275f, 0.0466148369f},
-std::array<float,2>{0.797659218f, 0.650465667f},
-std::array<float,2>{0.599634051f, 0.45125562f},
-std::array<float,2>{0.306262583f, 0.919039071f},
-std::array<float,2>{0.352907479f, 0.17026706f},
-std::array<float,2>{0.517748773f, 0.534353316f},
-std::array<float,2>{0.842798054f, 0.348258674f},
-std::array<float,2>{0.236889452f, 0.763370931f},
-std::array<float,2>{0.0560330227f, 0.43187651f},
-std::array<float,2>{0.958672523f, 0.987682998f},
-std::array<float,2>{0.720009506f, 0.106184475f},
-std::array<float,2>{0.475353628f, 0.697507203f},
-std::array<float,2>{0.27018255f, 0.47089681f},
-std::array<float,2>{0.589761436f, 0.8866992f},
-std::array<float,2>{0.766960502f, 0.0266385209f},
-std::array<float,2>{0.154873088f, 0.685095549f},
-std::array<float,2>{0.0680986345f, 0.243233219f},
-std::array<float,2>{0.887497246f, 0.588868856f},
-std::array<float,2>{0.681431532f, 0.259270966f},
-std::array<float,2>{0.407412201f, 0.865974069f},
-std::array<float,2>{0.461335272f, 0.0840206966f},
-std::array<float,2>{0.697397053f, 0.723317564f},
-std::array<float,2>{0.98551321f, 0.390494019f},
-std::array<float,2>{0.0198065713f, 0.967274427f},
-std::array<float,2>{0.204516798f, 0.341668934f},
-std::array<float,2>{0.870506585f, 0.793436408f},
-std::array<float,2>{0.536184609f, 0.141024992f},
-std::array<float,2>{0.32487759f, 0.511068642f},
-std::array<float,2>{0.34047395f, 0.359865338f},
-std::array<float,2>{0.560659885f, 0.773805082f},
-std::array<float,2>{0.844318688f, 0.185717896f},
-std::array<float,2>{0.192725211f, 0.560679615f},
-std::array<float,2>{0.0109295864f, 0.118749619f},
-std::array<float,2>{0.981043637f, 0.717987478f},
-std::array<float,2>{0.717964113f, 0.410745829f},
-std::array<float,2>{0.452771813f, 0.969061315f},
-std::array<float,2>{0.427426606f, 0.209649935f},
-std::array<float,2>{0.658792853f, 0.622731626f},
-std::array<float,2>{0.896481752f, 0.281409293f},
-std::array<float,2>{0.0840723291f, 0.826042056f},
-std::array<float,2>{0.129040584f, 0.460709006f},
-std::array<float,2>{0.755482256f, 0.935020447f},
-std::array<float,2>{0.575759351f, 0.0540412478f},
-std::array<float,2>{0.251094639f, 0.633230567f},
-std::array<float,2>{0.488681525f, 0.40395385f},
-std::array<float,2>{0.735672534f, 0.952209711f},
-std::array<float,2>{0.937944531f, 0.0670133904f},
-std::array<float,2>{0.0426332653f, 0.749642491f},
-std::array<float,2>{0.231662825f, 0.131450802f},
-std::array<float,2>{0.816987514f, 0.520542145f},
-std::array<float,2>{0.502238154f, 0.312816054f},
-std::array<float,2>{0.374259621f, 0.810648024f},
-std::array<float,2>{0.282597214f, 0.000985961175f},
-std::array<float,2>{0.61898005f, 0.66964215f},
-std::array<float,2>{0.78831917f, 0.496608555f},
-std::array<float,2>{0.175065681f, 0.896882296f},
-std::array<float,2>{0.100145422f, 0.276739597f},
-std::array<float,2>{0.931415737f, 0.847551048f},
-std::array<float,2>{0.63384366f, 0.22122243f},
-std::array<float,2>{0.394017607f, 0.565361917f},
-std::array<float,2>{0.444071144f, 0.325655043f},
-std::array<float,2>{0.709767103f, 0.797542512f},
-std::array<float,2>{0.97343713f, 0.137799561f},
-std::array<float,2>{0.00699428003f, 0.525106847f},
-std::array<float,2>{0.20171003f, 0.0711209252f},
-std::array<float,2>{0.858091176f, 0.74138844f},
-std::array<float,2>{0.552797318f, 0.391769707f},
-std::array<float,2>{0.32935071f, 0.940374076f},
-std::array<float,2>{0.260193169f, 0.228270933f},
-std::array<float,2>{0.566557407f, 0.57571137f},
-std::array<float,2>{0.759774268f, 0.267259866f},
-std::array<float,2>{0.137707219f, 0.854459465f},
-std::array<float,2>{0.093685858f, 0.488045692f},
-std::array<float,2>{0.902001917f, 0.902461231f},
-std::array<float,2>{0.66582638f, 0.0156158032f},
-std::array<float,2>{0.437389165f, 0.66082406f},
-std::array<float,2>{0.360353529f, 0.415938467f},
-std::array<float,2>{0.514216304f, 0.984130383f},
-std::array<float,2>{0.820361495f, 0.111857444f},
-std::array<float,2>{0.21977362f, 0.707008004f},
-std::array<float,2>{0.0314026438f, 0.178207144f},
-std::array<float,2>{0.950061977f, 0.551265538f},
-std::array<float,2>{0.745114744f, 0.371189028f},
-std::array<float,2>{0.49427712f, 0.766285181f},
-std::array<float,2>{0.398836285f, 0.0622153208f},
-std::array<float,2>{0.632661462f, 0.62846607f},
-std::array<float,2>{0.925271034f, 0.466851652f},
-std::array<float,2>{0.104231097f, 0.926008642f},
-std::array<float,2>{0.183514148f, 0.292002022f},
-std::array<float,2>{0.791575491f, 0.815586269f},
-std::array<float,2>{0.615640998f, 0.217902362f},
-std::array<float,2>{0.294122219f, 0.609528065f},
-std::array<float,2>{0.301649094f, 0.25016883f},
-std::array<float,2>{0.608706415f, 0.872519195f},
-std::array<float,2>{0.805991292f, 0.237037197f},
-std::array<float,2>{0.168687284f, 0.585289955f},
-std::array<float,2>{0.110246636f, 0.0169049893f},
-std::array<float,2>{0.914261162f, 0.676813424f},
-std::array<float,2>{0.650543749f, 0.482646167f},
-std::array<float,2>{0.385101408f, 0.877948225f},
-std::array<float,2>{0.4832353f, 0.148790225f},
-std::array<float,2>{0.731039345f, 0.501529932f},
-std::array<float,2>{0.967237949f, 0.328806937f},
-std::array<float,2>{0.0468802936f, 0.787046671f},
-std::array<float,2>{0.245425224f, 0.380953461f},
-std::array<float,2>{0.834426105f, 0.953374803f},
-std::array<float,2>{0.531116962f, 0.0880558342f},
-std::array<float,2>{0.349360615f, 0.731675267f},
-std::array<float,2>{0.415839404f, 0.438695222f},
-std::array<float,2>{0.675995111f, 0.913235426f},
-std::array<float,2>{0.876303196f, 0.0342976525f},
-std::array<float,2>{0.0741361231f, 0.641845763f},
-std::array<float,2>{0.143211886f, 0.195330217f},
-std::array<float,2>{0.777290583f, 0.607766747f},
-std::array<float,2>{0.580304801f, 0.298653126f},
-std::array<float,2>{0.276853174f, 0.833993435f},
-std::array<float,2>{0.318482041f, 0.0971799046f},
-std::array<float,2>{0.542452395f, 0.693389177f},
-std::array<float,2>{0.865623415f, 0.424752653f},
-std::array<float,2>{0.213118762f, 0.996293843f},
-std::array<float,2>{0.0301568657f, 0.354514986f},
-std::array<float,2>{0.996127248f, 0.756618083f},
-std::array<float,2>{0.690787077f, 0.163260609f},
-std::array<float,2>{0.457624823f, 0.545877874f},
-std::array<float,2>{0.404841363f, 0.338987082f},
-std::array<float,2>{0.625594854f, 0.789117157f},
-std::array<float,2>{0.927782714f, 0.147265598f},
-std::array<float,2>{0.105925336f, 0.51217252f},
-std::array<float,2>{0.186405316f, 0.079142876f},
-std::array<float,2>{0.79674834f, 0.721014082f},
-std::array<float,2>{0.613167644f, 0.383791447f},
-std::array<float,2>{0.291033894f, 0.961662412f},
-std::array<float,2>{0.367078394f, 0.249455065f},
-std::array<float,2>{0.50897944f, 0.59308672f},
-std::array<float,2>{0.82760793f, 0.265070409f},
-std::array<float,2>{0.223528579f, 0.862563372f},
-std::array<float,2>{0.0388366356f, 0.475462675f},
-std::array<float,2>{0.94724232f, 0.887217402f},
-std::array<float,2>{0.748455822f, 0.0311154407f},
-std::array<float,2>{0.497347325f, 0.682712853f},
-std::array<float,2>{0.264234096f, 0.436434746f},
-std::array<float,2>{0.563652396f, 0.991683364f},
-std::array<float,2>{0.76222676f, 0.103113361f},
-std::array<float,2>{0.133962214f, 0.701818645f},
-std::array<float,2>{0.0874520615f, 0.164798215f},
-std::array<float,2>{0.905696988f, 0.536766708f},
-std::array<float,2>{0.668379009f, 0.347026736f},
-std::array<float,2>{0.429762751f, 0.761594653f},
-std::array<float,2>{0.438754588f, 0.0396314114f},
-std::array<float,2>{0.704078794f, 0.655801713f},
-std::array<float,2>{0.969523787f, 0.446002513f},
-std::array<float,2>{0.00105433946f, 0.91637224f},
-std::array<float,2>{0.19912304f, 0.308256656f},
-std::array<float,2>{0.853129864f, 0.838711679f},
-std::array<float,2>{0.548732281f, 0.193484738f},
-std::array<float,2>{0.334439933f, 0.601371765f},
-std::array<float,2>{0.312726229f, 0.278851271f},
-std::array<float,2>{0.544821858f, 0.848726332f},
-std::array<float,2>{0.859626353f, 0.226102173f},
-std::array<float,2>{0.216892585f, 0.567016721f},
-std::array<float,2>{0.0260740425f, 0.00544053782f},
-std::array<float,2>{0.994033039f, 0.666900277f},
-std::array<float,2>{0.692749083f, 0.495410174f},
-std::array<float,2>{0.456476897f, 0.893554151f},
-std::array<float,2>{0.418585747f, 0.125593528f},
-std::array<float,2>{0.673657537f, 0.516192138f},
-std::array<float,2>{0.881064713f, 0.317766368f},
-std::array<float,2>{0.0769107193f, 0.807646453f},
-std::array<float,2>{0.146071449f, 0.401011288f},
-std::array<float,2>{0.780017555f, 0.948221803f},
-std::array<float,2>{0.584513664f, 0.0657589287f},
-std::array<float,2>{0.278848052f, 0.745493233f},
-std::array<float,2>{0.47666347f, 0.454373688f},
-std::array<float,2>{0.727790177f, 0.931871533f},
-std::array<float,2>{0.962670743f, 0.0492599048f},
-std::array<float,2>{0.05223836f, 0.638427377f},
-std::array<float,2>{0.247348413f, 0.203320026f},
-std::array<float,2>{0.829553664f, 0.619512439f},
-std::array<float,2>{0.525346279f, 0.287078559f},
-std::array<float,2>{0.347064167f, 0.821391523f},
-std::array<float,2>{0.297673464f, 0.123457283f},
-std::array<float,2>{0.602117717f, 0.711925864f},
-std::array<float,2>{0.812321365f, 0.40876618f},
-std::array<float,2>{0.1678776f, 0.975388408f},
-std::array<float,2>{0.113293901f, 0.36636126f},
-std::array<float,2>{0.919113874f, 0.780177295f},
-std::array<float,2>{0.655727267f, 0.181098431f},
-std::array<float,2>{0.387111217f, 0.557771266f},
-std::array<float,2>{0.466392457f, 0.295401365f},
-std::array<float,2>{0.699582934f, 0.817977428f},
-std::array<float,2>{0.988384306f, 0.212142378f},
-std::array<float,2>{0.0167375691f, 0.614396811f},
-std::array<float,2>{0.20879449f, 0.056110397f},
-std::array<float,2>{0.874357224f, 0.629051268f},
-std::array<float,2>{0.531716108f, 0.462300599f},
-std::array<float,2>{0.322897851f, 0.924386919f},
-std::array<float,2>{0.267936081f, 0.175760254f},
-std::array<float,2>{0.591684997f, 0.550697803f},
-std::array<float,2>{0.771637857f, 0.367320031f},
-std::array<float,2>{0.150418535f, 0.770225167f},
-std::array<float,2>{0.0652770251f, 0.419945776f},
-std::array<float,2>{0.88416183f, 0.978506744f},
-std::array<float,2>{0.686397731f, 0.114008203f},
-std::array<float,2>{0.410160303f, 0.708205819f},
-std::array<float,2>{0.358989775f, 0.490787774f},
-std::array<float,2>{0.52052635f, 0.900858939f},
-std::array<float,2>{0.83733964f, 0.0096216118f},
-std::array<float,2>{0.240437835f, 0.656987309f},
-std::array<float,2>{0.0596830882f, 0.231012031f},
-std::array<float,2>{0.956987143f, 0.571057618f},
-std::array<float,2>{0.722931087f, 0.269843906f},
-std::array<float,2>{0.471155405f, 0.856198251f},
-std::array<float,2>{0.379590213f, 0.0748667791f},
-std::array<float,2>{0.642349243f, 0.737212002f},
-std::array<float,2>{0.913045466f, 0.398382962f},
-std::array<float,2>{0.120907776f, 0.945023894f},
-std::array<float,2>{0.161764503f, 0.322221279f},
-std::array<float,2>{0.801696479f, 0.801029861f},
-std::array<float,2>{0.595615566f, 0.13554588f},
-std::array<float,2>{0.312303841f, 0.527786553f},
-std::array<float,2>{0.288676351f, 0.359217376f},
-std::array<float,2>{0.621381581f, 0.750468791f},
-std::array<float,2>{0.784626067f, 0.158252776f},
-std::array<float,2>{0.179491132f, 0.541828334f},
-std::array<float,2>{0.0950250253f, 0.100382417f},
-std::array<float,2>{0.936439872f, 0.688022077f},
-std::array<float,2>{0.636885345f, 0.425982952f},
-std::array<float,2>{0.396900475f, 0.996021152f},
-std::array<float,2>{0.48555094f, 0.202351347f},
-std::array<float,2>{0.739249885f, 0.602607369f},
-std::array<float,2>{0.941744506f, 0.303684503f},
-std::array<float,2>{0.043613404f, 0.830759466f},
-std::array<float,2>{0.227608204f, 0.444114119f},
-std::array<float,2>{0.815152049f, 0.907023728f},
-std::array<float,2>{0.505352199f, 0.0389105119f},
-std::array<float,2>{0.367373914f, 0.647868872f},
-std::array<float,2>{0.422256023f, 0.377431631f},
-std::array<float,2>{0.662702858f, 0.959356308f},
-std::array<float,2>{0.894248784f, 0.0900003836f},
-std::array<float,2>{0.0806692392f, 0.728942752f},
-std::array<float,2>{0.126942784f, 0.152946189f},
-std::array<float,2>{0.751244545f, 0.507026196f},
-std::array<float,2>{0.571602702f, 0.333453834f},
-std::array<float,2>{0.254767716f, 0.783926129f},
-std::array<float,2>{0.339034557f, 0.022999296f},
-std::array<float,2>{0.558483124f, 0.673560202f},
-std::array<float,2>{0.851556897f, 0.477975845f},
-std::array<float,2>{0.187839627f, 0.879585981f},
-std::array<float,2>{0.0142997531f, 0.257573068f},
-std::array<float,2>{0.978233457f, 0.868002057f},
-std::array<float,2>{0.712751865f, 0.241013527f},
-std::array<float,2>{0.447066605f, 0.579744577f},
-std::array<float,2>{0.409544259f, 0.260889322f},
-std::array<float,2>{0.683030486f, 0.863913655f},
-std::array<float,2>{0.889941692f, 0.244699851f},
-std::array<float,2>{0.0692898482f, 0.586804807f},
-std::array<float,2>{0.153810382f, 0.0252915751f},
-std::array<float,2>{0.768922567f, 0.686511278f},
-std::array<float,2>{0.586067557f, 0.470066488f},
-std::array<float,2>{0.272040367f, 0.883466244f},
-std::array<float,2>{0.328038394f, 0.143072382f},
-std::array<float,2>{0.537965894f, 0.509387612f},
-std::array<float,2>{0.867270947f, 0.343045741f},
-std::array<float,2>{0.206230626f, 0.796646714f},
-std::array<float,2>{0.0221361741f, 0.388063937f},
-std::array<float,2>{0.986616135f, 0.965953827f},
-std::array<float,2>{0.696853578f, 0.0832035616f},
-std::array<float,2>{0.463975608f, 0.724877477f},
-std::array<float,2>{0.307477742f, 0.450293332f},
-std::array<float,2>{0.59856087f, 0.921570957f},
-std::array<float,2>{0.799068451f, 0.0440449007f},
-std::array<float,2>{0.158520222f, 0.649486721f},
-std::array<float,2>{0.123218291f, 0.188140079f},
-std::array<float,2>{0.91001302f, 0.596839488f},
-std::array<float,2>{0.648227215f, 0.30879271f},
-std::array<float,2>{0.37687546f, 0.842220068f},
-std::array<float,2>{0.472934008f, 0.107512981f},
-std::array<float,2>{0.722087681f, 0.695405602f},
-std::array<float,2>{0.959327877f, 0.430048347f},
-std::array<float,2>{0.0583128445f, 0.984419942f},
-std::array<float,2>{0.236325547f, 0.350844145f},
-std::array<float,2>{0.840446889f, 0.76540637f},
-std::array<float,2>{0.515853703f, 0.168454006f},
-std::array<float,2>{0.354863942f, 0.532876432f},
-std::array<float,2>{0.372001529f, 0.316050202f},
-std::array<float,2>{0.501780391f, 0.809755862f},
-std::array<float,2>{0.818362832f, 0.130623028f},
-std::array<float,2>{0.232986465f, 0.522156954f},
-std::array<float,2>{0.0400641188f, 0.0688648671f},
-std::array<float,2>{0.940339744f, 0.746205032f},
-std::array<float,2>{0.737619936f, 0.404502869f},
-std::array<float,2>{0.491856664f, 0.949243724f},
-std::array<float,2>{0.39069277f, 0.2202584f},
-std::array<float,2>{0.636384487f, 0.563469589f},
-std::array<float,2>{0.932233036f, 0.273925364f},
-std::array<float,2>{0.0980888978f, 0.845424235f},
-std::array<float,2>{0.172813699f, 0.49888882f},
-std::array<float,2>{0.785353959f, 0.895089149f},
-std::array<float,2>{0.620777249f, 0.00288971839f},
-std::array<float,2>{0.284953058f, 0.671462536f},
-std::array<float,2>{0.449254572f, 0.413678676f},
-std::array<float,2>{0.715348482f, 0.970875144f},
-std::array<float,2>{0.982457221f, 0.119295232f},
-std::array<float,2>{0.00844715256f, 0.715983689f},
-std::array<float,2>{0.194201484f, 0.184584022f},
-std::array<float,2>{0.846293807f, 0.559685826f},
-std::array<float,2>{0.559327006f, 0.362575918f},
-std::array<float,2>{0.342215508f, 0.776647985f},
-std::array<float,2>{0.253630757f, 0.0512532443f},
-std::array<float,2>{0.576593757f, 0.636025548f},
-std::array<float,2>{0.757598281f, 0.458143532f},
-std::array<float,2>{0.132779434f, 0.936032057f},
-std::array<float,2>{0.0821660906f, 0.284475178f},
-std::array<float,2>{0.896801233f, 0.826939642f},
-std::array<float,2>{0.657669246f, 0.207608879f},
-std::array<float,2>{0.429215372f, 0.623243093f},
-std::array<float,2>{0.49410677f, 0.373478651f},
-std::array<float,2>{0.743818462f, 0.768108308f},
-std::array<float,2>{0.951272786f, 0.176913872f},
-std::array<float,2>{0.0339139849f, 0.552861273f},
-std::array<float,2>{0.222393602f, 0.110439047f},
-std::array<float,2>{0.823272288f, 0.703362107f},
-std::array<float,2>{0.513581693f, 0.417831481f},
-std::array<float,2>{0.362374276f, 0.981266379f},
-std::array<float,2>{0.296077818f, 0.216740608f},
-std::array<float,2>{0.61373508f, 0.612064481f},
-std::array<float,2>{0.789622843f, 0.289995521f},
-std::array<float,2>{0.1809683f, 0.812750041f},
-std::array<float,2>{0.103129148f, 0.466430724f},
-std::array<float,2>{0.922500908f, 0.929403961f},
-std::array<float,2>{0.630290926f, 0.0595114082f},
-std::array<float,2>{0.400393754f, 0.626918077f},
-std::array<float,2>{0.331089407f, 0.393235028f},
-std::array<float,2>{0.551325679f, 0.939210176f},
-std::array<float,2>{0.856443882f, 0.0741238445f},
-std::array<float,2>{0.201138169f, 0.73999542f},
-std::array<float,2>{0.00495328428f, 0.14056018f},
-std::array<float,2>{0.975154579f, 0.525869131f},
-std::array<float,2>{0.707587302f, 0.326416671f},
-std::array<float,2>{0.441651613f, 0.800350964f},
-std::array<float,2>{0.435005814f, 0.0129033877f},
-std::array<float,2>{0.666559041f, 0.662603617f},
-std::array<float,2>{0.89847368f, 0.485287189f},
-std::array<float,2>{0.0910945311f, 0.90447253f},
-std::array<float,2>{0.139774919f, 0.268368721f},
-std::array<float,2>{0.758287489f, 0.851681948f},
-std::array<float,2>{0.56878221f, 0.229749456f},
-std::array<float,2>{0.259740114f, 0.576323867f},
-std::array<float,2>{0.273877412f, 0.299977094f},
-std::array<float,2>{0.579940379f, 0.833607316f},
-std::array<float,2>{0.774803162f, 0.198555693f},
-std::array<float,2>{0.142358005f, 0.605654538f},
-std::array<float,2>{0.0712503418f, 0.0322018042f},
-std::array<float,2>{0.877114594f, 0.643008769f},
-std::array<float,2>{0.679660857f, 0.439500183f},
-std::array<float,2>{0.417647719f, 0.911340356f},
-std::array<float,2>{0.459115803f, 0.160972476f},
-std::array<float,2>{0.688860476f, 0.543704271f},
-std::array<float,2>{0.999907494f, 0.351848751f},
-std::array<float,2>{0.0286620408f, 0.754838049f},
-std::array<float,2>{0.211825624f, 0.423247963f},
-std::array<float,2>{0.863825679f, 0.998499691f},
-std::array<float,2>{0.539194703f, 0.0949687585f},
-std::array<float,2>{0.317469656f, 0.693145156f},
-std::array<float,2>{0.384463787f, 0.48108235f},
-std::array<float,2>{0.64956075f, 0.875781655f},
-std::array<float,2>{0.916088283f, 0.0177932121f},
-std::array<float,2>{0.111641057f, 0.6782372f},
-std::array<float,2>{0.170066893f, 0.234899253f},
-std::array<float,2>{0.80749011f, 0.582162619f},
-std::array<float,2>{0.607390821f, 0.251968086f},
-std::array<float,2>{0.303484052f, 0.874492645f},
-std::array<float,2>{0.349912107f, 0.08680024f},
-std::array<float,2>{0.52862829f, 0.734059453f},
-std::array<float,2>{0.833580792f, 0.379227698f},
-std::array<float,2>{0.243646592f, 0.956981242f},
-std::array<float,2>{0.0500417426f, 0.331894249f},
-std::array<float,2>{0.965417683f, 0.788115621f},
-std::array<float,2>{0.732919395f, 0.150917828f},
-std::array<float,2>{0.481445104f, 0.502736747f},
-std::array<float,2>{0.3972148f, 0.356010973f},
-std::array<float,2>{0.63723284f, 0.753709435f},
-std::array<float,2>{0.935903251f, 0.156816185f},
-std::array<float,2>{0.095472157f, 0.540024519f},
-std::array<float,2>{0.17897062f, 0.0995866507f},
-std::array<float,2>{0.78475529f, 0.690339208f},
-std::array<float,2>{0.621857464f, 0.428124875f},
-std::array<float,2>{0.288451165f, 0.993178606f},
-std::array<float,2>{0.367988884f, 0.201014429f},
-std::array<float,2>{0.505634546f, 0.605251133f},
-std::array<float,2>{0.814926207f, 0.30196628f},
-std::array<float,2>{0.228431821f, 0.829304039f},
-std::array<float,2>{0.0431832485f, 0.441851079f},
-std::array<float,2>{0.941984594f, 0.908666253f},
-std::array<float,2>{0.738364339f, 0.0370444842f},
-std::array<float,2>{0.486168832f, 0.644955039f},
-std::array<float,2>{0.253991395f, 0.376218438f},
-std::array<float,2>{0.572069705f, 0.957960367f},
-std::array<float,2>{0.75161773f, 0.0922215283f},
-std::array<float,2>{0.126176625f, 0.727755129f},
-std::array<float,2>{0.0801125467f, 0.156019926f},
-std::array<float,2>{0.893733323f, 0.504011393f},
-std::array<float,2>{0.662535608f, 0.33525306f},
-std::array<float,2>{0.422640175f, 0.782631874f},
-std::array<float,2>{0.4464598f, 0.0200930964f},
-std::array<float,2>{0.712367356f, 0.675251424f},
-std::array<float,2>{0.977768302f, 0.479311049f},
-std::array<float,2>{0.0139358277f, 0.881892622f},
-std::array<float,2>{0.188370481f, 0.254318625f},
-std::array<float,2>{0.850727677f, 0.870410681f},
-std::array<float,2>{0.557775915f, 0.239134058f},
-std::array<float,2>{0.339839876f, 0.581956565f},
-std::array<float,2>{0.322391361f, 0.293788195f},
-std::array<float,2>{0.531822681f, 0.819054604f},
-std::array<float,2>{0.874765038f, 0.213492766f},
-std::array<float,2>{0.208193257f, 0.615908563f},
-std::array<float,2>{0.0173932519f, 0.0569373518f},
-std::array<float,2>{0.988972127f, 0.632702827f},
-std::array<float,2>{0.699941993f, 0.464496344f},
-std::array<float,2>{0.466067404f, 0.922666728f},
-std::array<float,2>{0.410774291f, 0.173415795f},
-std::array<float,2>{0.685992062f, 0.548173428f},
-std::array<float,2>{0.884391069f, 0.370382816f},
-std::array<float,2>{0.0649010092f, 0.773114681f},
-std::array<float,2>{0.151142374f, 0.418405324f},
-std::array<float,2>{0.772235096f, 0.979528427f},
-std::array<float,2>{0.591126025f, 0.115842216f},
-std::array<float,2>{0.268456548f, 0.709104657f},
-std::array<float,2>{0.471308619f, 0.48845017f},
-std::array<float,2>{0.723572433f, 0.899644554f},
-std::array<float,2>{0.956386507f, 0.0098985536f},
-std::array<float,2>{0.0603176542f, 0.659415007f},
-std::array<float,2>{0.241027266f, 0.234257996f},
-std::array<float,2>{0.83775878f, 0.572778523f},
-std::array<float,2>{0.521066487f, 0.271556288f},
-std::array<float,2>{0.358625561f, 0.857446909f},
-std::array<float,2>{0.311971992f, 0.0765317529f},
-std::array<float,2>{0.59478128f, 0.735068381f},
-std::array<float,2>{0.800867677f, 0.396196783f},
-std::array<float,2>{0.16124554f, 0.941672504f},
-std::array<float,2>{0.120393254f, 0.322806358f},
-std::array<float,2>{0.912145317f, 0.803185463f},
-std::array<float,2>{0.642056346f, 0.134442568f},
-std::array<float,2>{0.379184991f, 0.529870033f},
-std::array<float,2>{0.456694931f, 0.280058652f},
-std::array<float,2>{0.693018258f, 0.850234628f},
-std::array<float,2>{0.993457496f, 0.223738477f},
-std::array<float,2>{0.0253907312f, 0.569241464f},
-std::array<float,2>{0.217402801f, 0.00716251833f},
-std::array<float,2>{0.859892726f, 0.664775848f},
-std::array<float,2>{0.543982506f, 0.494076818f},
-std::array<float,2>{0.313164234f, 0.89177686f},
-std::array<float,2>{0.278524429f, 0.127969056f},
-std::array<float,2>{0.58428508f, 0.51943934f},
-std::array<float,2>{0.779426575f, 0.318709254f},
-std::array<float,2>{0.145709977f, 0.806464255f},
-std::array<float,2>{0.0764703006f, 0.398816615f},
-std::array<float,2>{0.881531537f, 0.94699949f},
-std::array<float,2>{0.673214078f, 0.0633838102f},
-std::array<float,2>{0.41822961f, 0.743598223f},
-std::array<float,2>{0.347535372f, 0.456221938f},
-std::array<float,2>{0.524699271f, 0.931206524f},
-std::array<float,2>{0.830018997f, 0.0473095551f},
-std::array<float,2>{0.247835174f, 0.640502214f},
-std::array<float,2>{0.0523269139f, 0.206190109f},
-std::array<float,2>{0.962318778f, 0.618974447f},
-std::array<float,2>{0.728486359f, 0.288284302f},
-std::array<float,2>{0.477330357f, 0.822318733f},
-std::array<float,2>{0.387582034f, 0.121229149f},
-std::array<float,2>{0.655915082f, 0.713910341f},
-std::array<float,2>{0.919465065f, 0.407990307f},
-std::array<float,2>{0.114172958f, 0.974265814f},
-std::array<float,2>{0.167284802f, 0.363715261f},
-std::array<float,2>{0.811886013f, 0.778561473f},
-std::array<float,2>{0.601958752f, 0.18309164f},
-std::array<float,2>{0.297254592f, 0.555871725f},
-std::array<float,2>{0.291903585f, 0.336314291f},
-std::array<float,2>{0.612538695f, 0.791972697f},
-std::array<float,2>{0.796106339f, 0.145199284f},
-std::array<float,2>{0.186004981f, 0.51374048f},
-std::array<float,2>{0.105964825f, 0.0810986087f},
-std::array<float,2>{0.928492606f, 0.719185233f},
-std::array<float,2>{0.625438333f, 0.385011107f},
-std::array<float,2>{0.40472582f, 0.963675261f},
-std::array<float,2>{0.4979375f, 0.24749051f},
-std::array<float,2>{0.748789787f, 0.590998173f},
-std::array<float,2>{0.946705818f, 0.263130695f},
-std::array<float,2>{0.0382936597f, 0.860473573f},
-std::array<float,2>{0.222881541f, 0.472992361f},
-std::array<float,2>{0.827984333f, 0.888674855f},
-std::array<float,2>{0.509710968f, 0.0281124525f},
-std::array<float,2>{0.366384089f, 0.681547165f},
-std::array<float,2>{0.430398345f, 0.435138881f},
-std::array<float,2>{0.668843448f, 0.988486052f},
-std::array<float,2>{0.905914187f, 0.103574559f},
-std::array<float,2>{0.0871194825f, 0.699769318f},
-std::array<float,2>{0.134721503f, 0.16670239f},
-std::array<float,2>{0.761755288f, 0.537496328f},
-std::array<float,2>{0.564354002f, 0.345235109f},
-std::array<float,2>{0.264052898f, 0.758052409f},
-std::array<float,2>{0.334511966f, 0.042047929f},
-std::array<float,2>{0.548040926f, 0.653299987f},
-std::array<float,2>{0.852719188f, 0.447965622f},
-std::array<float,2>{0.198611885f, 0.915197849f},
-std::array<float,2>{0.00161496026f, 0.305355042f},
-std::array<float,2>{0.96897161f, 0.837613344f},
-std::array<float,2>{0.703421235f, 0.191979587f},
-std::array<float,2>{0.438972712f, 0.598690867f},
-std::array<float,2>{0.417026341f, 0.297901332f},
-std::array<float,2>{0.67911166f, 0.834853888f},
-std::array<float,2>{0.87748003f, 0.196008667f},
-std::array<float,2>{0.070375368f, 0.607931316f},
-std::array<float,2>{0.141887769f, 0.0349264257f},
-std::array<float,2>{0.775132775f, 0.642269492f},
-std::array<float,2>{0.579372466f, 0.43905437f},
-std::array<float,2>{0.274276346f, 0.91382122f},
-std::array<float,2>{0.317970723f, 0.163938865f},
-std::array<float,2>{0.53982079f, 0.545026362f},
-std::array<float,2>{0.863734245f, 0.355298698f},
-std::array<float,2>{0.211086497f, 0.756051958f},
-std::array<float,2>{0.0292146653f, 0.424169511f},
-std::array<float,2>{0.99949652f, 0.996979356f},
-std::array<float,2>{0.689434588f, 0.096840851f},
-std::array<float,2>{0.459517479f, 0.694329083f},
-std::array<float,2>{0.302910835f, 0.483385891f},
-std::array<float,2>{0.606509805f, 0.878800154f},
-std::array<float,2>{0.806799531f, 0.0175126977f},
-std::array<float,2>{0.170413598f, 0.677657962f},
-std::array<float,2>{0.112092793f, 0.236503482f},
-std::array<float,2>{0.91684401f, 0.585935891f},
-std::array<float,2>{0.650102794f, 0.250919342f},
-std::array<float,2>{0.384033322f, 0.872596443f},
-std::array<float,2>{0.480515927f, 0.0885376707f},
-std::array<float,2>{0.732433975f, 0.732322752f},
-std::array<float,2>{0.965040445f, 0.381483138f},
-std::array<float,2>{0.0504393056f, 0.953926027f},
-std::array<float,2>{0.243738219f, 0.328382641f},
-std::array<float,2>{0.83345747f, 0.786310911f},
-std::array<float,2>{0.528864026f, 0.149215534f},
-std::array<float,2>{0.350335449f, 0.501160204f},
-std::array<float,2>{0.363229603f, 0.371952832f},
-std::array<float,2>{0.51318115f, 0.766020417f},
-std::array<float,2>{0.823980808f, 0.178265169f},
-std::array<float,2>{0.2219868f, 0.551625788f},
-std::array<float,2>{0.0336019509f, 0.111496739f},
-std::array<float,2>{0.951821506f, 0.706070542f},
-std::array<float,2>{0.743324876f, 0.415503442f},
-std::array<float,2>{0.493175358f, 0.983817816f},
-std::array<float,2>{0.400883794f, 0.218513712f},
-std::array<float,2>{0.630687475f, 0.610231042f},
-std::array<float,2>{0.922186017f, 0.292943388f},
-std::array<float,2>{0.102864541f, 0.816022038f},
-std::array<float,2>{0.181189165f, 0.467729896f},
-std::array<float,2>{0.789393187f, 0.926730633f},
-std::array<float,2>{0.613924503f, 0.0616980344f},
-std::array<float,2>{0.29673481f, 0.628394961f},
-std::array<float,2>{0.442270577f, 0.392508388f},
-std::array<float,2>{0.707301438f, 0.939530432f},
-std::array<float,2>{0.974714994f, 0.070343852f},
-std::array<float,2>{0.00555081433f, 0.742021978f},
-std::array<float,2>{0.200347885f, 0.138574123f},
-std::array<float,2>{0.855847657f, 0.524869561f},
-std::array<float,2>{0.550795794f, 0.325919747f},
-std::array<float,2>{0.332027942f, 0.797131836f},
-std::array<float,2>{0.259272218f, 0.0150492871f},
-std::array<float,2>{0.569284856f, 0.660380661f},
-std::array<float,2>{0.758696556f, 0.487386972f},
-std::array<float,2>{0.140528098f, 0.902943671f},
-std::array<float,2>{0.0917042866f, 0.267015904f},
-std::array<float,2>{0.899284065f, 0.853550851f},
-std::array<float,2>{0.666113079f, 0.22800231f},
-std::array<float,2>{0.435477883f, 0.575401902f},
-std::array<float,2>{0.491507977f, 0.313149661f},
-std::array<float,2>{0.73788625f, 0.811269224f},
-std::array<float,2>{0.939913034f, 0.130902082f},
-std::array<float,2>{0.0405496992f, 0.521402359f},
-std::array<float,2>{0.232734084f, 0.0664167106f},
-std::array<float,2>{0.819252551f, 0.749100447f},
-std::array<float,2>{0.501414895f, 0.40343371f},
-std::array<float,2>{0.371319175f, 0.952808559f},
-std::array<float,2>{0.2842426f, 0.220981792f},
-std::array<float,2>{0.620464861f, 0.56451875f},
-std::array<float,2>{0.785652697f, 0.277122706f},
-std::array<float,2>{0.172271594f, 0.847063601f},
-std::array<float,2>{0.0982924402f, 0.496449351f},
-std::array<float,2>{0.931996942f, 0.897224784f},
-std::array<float,2>{0.635847509f, 0.00191692729f},
-std::array<float,2>{0.391168922f, 0.669144988f},
-std::array<float,2>{0.34246552f, 0.410609066f},
-std::array<float,2>{0.558807969f, 0.969547808f},
-std::array<float,2>{0.845929623f, 0.118585311f},
-std::array<float,2>{0.19383952f, 0.718484163f},
-std::array<float,2>{0.00801390503f, 0.186431929f},
-std::array<float,2>{0.983055472f, 0.5613814f},
-std::array<float,2>{0.714894533f, 0.359434843f},
-std::array<float,2>{0.44991073f, 0.77393645f},
-std::array<float,2>{0.428752095f, 0.0542506501f},
-std::array<float,2>{0.65798831f, 0.633411825f},
-std::array<float,2>{0.897175133f, 0.460319906f},
-std::array<float,2>{0.0826851055f, 0.935204327f},
-std::array<float,2>{0.132015273f, 0.281950504f},
-std::array<float,2>{0.757155657f, 0.825333416f},
-std::array<float,2>{0.576941371f, 0.208986223f},
-std::array<float,2>{0.253103584f, 0.622282088f},
-std::array<float,2>{0.271750957f, 0.259514123f},
-std::array<float,2>{0.58677423f, 0.865595043f},
-std::array<float,2>{0.769169569f, 0.24385938f},
-std::array<float,2>{0.15336068f, 0.589686453f},
-std::array<float,2>{0.0684297606f, 0.0271934513f},
-std::array<float,2>{0.890607774f, 0.684708714f},
-std::array<float,2>{0.683148742f, 0.471342087f},
-std::array<float,2>{0.410150915f, 0.886224806f},
-std::array<float,2>{0.464760184f, 0.141577363f},
-std::array<float,2>{0.696436226f, 0.511284888f},
-std::array<float,2>{0.987165987f, 0.340973735f},
-std::array<float,2>{0.0218308661f, 0.793939412f},
-std::array<float,2>{0.206820086f, 0.389785498f},
-std::array<float,2>{0.868154347f, 0.967558265f},
-std::array<float,2>{0.537478268f, 0.0847822055f},
-std::array<float,2>{0.327565372f, 0.723117948f},
-std::array<float,2>{0.37626195f, 0.451805145f},
-std::array<float,2>{0.647575736f, 0.9198367f},
-std::array<float,2>{0.909546137f, 0.0460201353f},
-std::array<float,2>{0.123833418f, 0.651005387f},
-std::array<float,2>{0.158781603f, 0.189642742f},
-std::array<float,2>{0.799457073f, 0.594523787f},
-std::array<float,2>{0.598136783f, 0.312084436f},
-std::array<float,2>{0.307059944f, 0.84117496f},
-std::array<float,2>{0.35501197f, 0.1057382f},
-std::array<float,2>{0.516262949f, 0.697996199f},
-std::array<float,2>{0.840264916f, 0.432321429f},
-std::array<float,2>{0.235688016f, 0.987895846f},
-std::array<float,2>{0.0579170771f, 0.347835451f},
-std::array<float,2>{0.959705055f, 0.762714803f},
-std::array<float,2>{0.722220778f, 0.170681849f},
-std::array<float,2>{0.473329663f, 0.534903228f},
-std::array<float,2>{0.425777763f, 0.333787978f},
-std::array<float,2>{0.661624849f, 0.78338778f},
-std::array<float,2>{0.892320156f, 0.152656227f},
-std::array<float,2>{0.0788310617f, 0.507668316f},
-std::array<float,2>{0.128247976f, 0.0904102698f},
-std::array<float,2>{0.752924085f, 0.729470909f},
-std::array<float,2>{0.572396994f, 0.377546787f},
-std::array<float,2>{0.257655948f, 0.95961982f},
-std::array<float,2>{0.337457448f, 0.240684107f},
-std::array<float,2>{0.555095613f, 0.57917583f},
-std::array<float,2>{0.847750843f, 0.257149309f},
-std::array<float,2>{0.190501884f, 0.867622733f},
-std::array<float,2>{0.0135425376f, 0.478269309f},
-std::array<float,2>{0.980426669f, 0.879079103f},
-std::array<float,2>{0.713511467f, 0.0226312596f},
-std::array<float,2>{0.448270023f, 0.673287213f},
-std::array<float,2>{0.285643846f, 0.426549286f},
-std::array<float,2>{0.62345612f, 0.995444f},
-std::array<float,2>{0.782999992f, 0.100038417f},
-std::array<float,2>{0.175928831f, 0.687912941f},
-std::array<float,2>{0.0972414687f, 0.158830747f},
-std::array<float,2>{0.935247481f, 0.541235983f},
-std::array<float,2>{0.640252948f, 0.358414471f},
-std::array<float,2>{0.395236015f, 0.750849485f},
-std::array<float,2>{0.487247258f, 0.0382696763f},
-std::array<float,2>{0.740524173f, 0.648381531f},
-std::array<float,2>{0.944551885f, 0.44352439f},
-std::array<float,2>{0.0451442562f, 0.906529963f},
-std::array<float,2>{0.228664935f, 0.303135723f},
-std::array<float,2>{0.813858747f, 0.830199897f},
-std::array<float,2>{0.507470787f, 0.202787459f},
-std::array<float,2>{0.369339406f, 0.603395283f},
-std::array<float,2>{0.357093632f, 0.270485044f},
-std::array<float,2>{0.522665858f, 0.855494261f},
-std::array<float,2>{0.83921355f, 0.230940953f},
-std::array<float,2>{0.239027038f, 0.570564985f},
-std::array<float,2>{0.0609495342f, 0.0090989247f},
-std::array<float,2>{0.954536021f, 0.656608343f},
-std::array<float,2>{0.724927187f, 0.490350962f},
-std::array<float,2>{0.469135791f, 0.901142836f},
-std::array<float,2>{0.3810803f, 0.134773597f},
-std::array<float,2>{0.644309402f, 0.527886093f},
-std::array<float,2>{0.911742806f, 0.321399868f},
-std::array<float,2>{0.117565595f, 0.801700234f},
-std::array<float,2>{0.163776428f, 0.397749007f},
-std::array<float,2>{0.804244876f, 0.94458878f},
-std::array<float,2>{0.59649086f, 0.0745987594f},
-std::array<float,2>{0.308686048f, 0.736390948f},
-std::array<float,2>{0.468558311f, 0.462696671f},
-std::array<float,2>{0.702386737f, 0.923888564f},
-std::array<float,2>{0.991726995f, 0.0565798171f},
-std::array<float,2>{0.0188544337f, 0.629530907f},
-std::array<float,2>{0.21011351f, 0.212809443f},
-std::array<float,2>{0.872495651f, 0.615229487f},
-std::array<float,2>{0.5351215f, 0.295603693f},
-std::array<float,2>{0.321517646f, 0.817725897f},
-std::array<float,2>{0.266515821f, 0.113327771f},
-std::array<float,2>{0.592368782f, 0.708687425f},
-std::array<float,2>{0.769895077f, 0.42076391f},
-std::array<float,2>{0.150062874f, 0.977934062f},
-std::array<float,2>{0.0636378899f, 0.367869914f},
-std::array<float,2>{0.885802448f, 0.769543052f},
-std::array<float,2>{0.684177756f, 0.174857125f},
-std::array<float,2>{0.413822979f, 0.54981637f},
-std::array<float,2>{0.478826612f, 0.286587656f},
-std::array<float,2>{0.729581535f, 0.822052062f},
-std::array<float,2>{0.964213908f, 0.203810513f},
-std::array<float,2>{0.052945666f, 0.62008363f},
-std::array<float,2>{0.248561233f, 0.049626451f},
-std::array<float,2>{0.831495166f, 0.637945592f},
-std::array<float,2>{0.526980042f, 0.454803884f},
-std::array<float,2>{0.34400776f, 0.932362497f},
-std::array<float,2>{0.29982096f, 0.18132937f},
-std::array<float,2>{0.603733778f, 0.558255196f},
-std::array<float,2>{0.810363472f, 0.367138773f},
-std::array<float,2>{0.165665135f, 0.779423654f},
-std::array<float,2>{0.116020761f, 0.408276051f},
-std::array<float,2>{0.920923471f, 0.974981308f},
-std::array<float,2>{0.65312469f, 0.123584367f},
-std::array<float,2>{0.390141219f, 0.712602317f},
-std::array<float,2>{0.314641505f, 0.495943785f},
-std::array<float,2>{0.545589387f, 0.893013179f},
-std::array<float,2>{0.862346292f, 0.00520028593f},
-std::array<float,2>{0.215844065f, 0.666238725f},
-std::array<float,2>{0.0235693697f, 0.225802213f},
-std::array<float,2>{0.995131671f, 0.56667608f},
-std::array<float,2>{0.694434404f, 0.278516442f},
-std::array<float,2>{0.453211635f, 0.849564373f},
-std::array<float,2>{0.421840906f, 0.0659639612f},
-std::array<float,2>{0.675521255f, 0.745765924f},
-std::array<float,2>{0.880600333f, 0.400687128f},
-std::array<float,2>{0.0755160153f, 0.947499275f},
-std::array<float,2>{0.147032037f, 0.317872673f},
-std::array<float,2>{0.778481781f, 0.808588386f},
-std::array<float,2>{0.582251191f, 0.125105619f},
-std::array<float,2>{0.279843837f, 0.515829504f},
-std::array<float,2>{0.262426138f, 0.347454697f},
-std::array<float,2>{0.566141844f, 0.760799706f},
-std::array<float,2>{0.76506114f, 0.16408205f},
-std::array<float,2>{0.134905562f, 0.53615135f},
-std::array<float,2>{0.089421913f, 0.102761917f},
-std::array<float,2>{0.904080033f, 0.701509655f},
-std::array<float,2>{0.670903862f, 0.43555674f},
-std::array<float,2>{0.433071852f, 0.992041111f},
-std::array<float,2>{0.440270841f, 0.194083989f},
-std::array<float,2>{0.70682627f, 0.600908339f},
-std::array<float,2>{0.972319603f, 0.308047682f},
-std::array<float,2>{0.00278045866f, 0.838089526f},
-std::array<float,2>{0.196674675f, 0.445738167f},
-std::array<float,2>{0.85392791f, 0.916588724f},
-std::array<float,2>{0.550427735f, 0.0393610224f},
-std::array<float,2>{0.333664358f, 0.655445099f},
-std::array<float,2>{0.403037757f, 0.384329617f},
-std::array<float,2>{0.627909124f, 0.961082697f},
-std::array<float,2>{0.926768959f, 0.0797330812f},
-std::array<float,2>{0.107885025f, 0.721554816f},
-std::array<float,2>{0.183810681f, 0.1468869f},
-std::array<float,2>{0.79450947f, 0.512690783f},
-std::array<float,2>{0.610816896f, 0.339393437f},
-std::array<float,2>{0.289253503f, 0.789662123f},
-std::array<float,2>{0.363913685f, 0.0303483736f},
-std::array<float,2>{0.510062754f, 0.683511913f},
-std::array<float,2>{0.825956225f, 0.474826276f},
-std::array<float,2>{0.225447193f, 0.887124836f},
-std::array<float,2>{0.0363197997f, 0.265496314f},
-std::array<float,2>{0.94834429f, 0.863178849f},
-std::array<float,2>{0.746336639f, 0.249834344f},
-std::array<float,2>{0.498246104f, 0.593390226f},
-std::array<float,2>{0.385401249f, 0.252821445f},
-std::array<float,2>{0.651356995f, 0.87486589f},
-std::array<float,2>{0.914911866f, 0.234406278f},
-std::array<float,2>{0.109638691f, 0.582615256f},
-std::array<float,2>{0.168332472f, 0.0180972777f},
-std::array<float,2>{0.806569457f, 0.678179264f},
-std::array<float,2>{0.609025896f, 0.480546862f},
-std::array<float,2>{0.301202118f, 0.87507987f},
-std::array<float,2>{0.348712474f, 0.150753036f},
-std::array<float,2>{0.530302644f, 0.502138734f},
-std::array<float,2>{0.834685981f, 0.331315577f},
-std::array<float,2>{0.245784819f, 0.788705349f},
-std::array<float,2>{0.0478392281f, 0.379427791f},
-std::array<float,2>{0.967643321f, 0.956109405f},
-std::array<float,2>{0.730783522f, 0.0859463364f},
-std::array<float,2>{0.482460588f, 0.733859479f},
-std::array<float,2>{0.277257383f, 0.440033883f},
-std::array<float,2>{0.580678701f, 0.912035763f},
-std::array<float,2>{0.776596367f, 0.0316738635f},
-std::array<float,2>{0.142868653f, 0.643275738f},
-std::array<float,2>{0.0735784397f, 0.198884293f},
-std::array<float,2>{0.87685293f, 0.606328011f},
-std::array<float,2>{0.676722169f, 0.300682634f},
-std::array<float,2>{0.415475816f, 0.833453894f},
-std::array<float,2>{0.457259148f, 0.095297724f},
-std::array<float,2>{0.691086709f, 0.692504644f},
-std::array<float,2>{0.997065604f, 0.423428893f},
-std::array<float,2>{0.029382607f, 0.998646736f},
-std::array<float,2>{0.213719934f, 0.352463156f},
-std::array<float,2>{0.866006792f, 0.753988087f},
-std::array<float,2>{0.542831361f, 0.16060558f},
-std::array<float,2>{0.318847775f, 0.543430865f},
-std::array<float,2>{0.329979777f, 0.326967508f},
-std::array<float,2>{0.553678632f, 0.799997509f},
-std::array<float,2>{0.857668757f, 0.140008256f},
-std::array<float,2>{0.201635659f, 0.525883257f},
-std::array<float,2>{0.0076118554f, 0.0735061616f},
-std::array<float,2>{0.972765028f, 0.739698172f},
-std::array<float,2>{0.709308684f, 0.392649829f},
-std::array<float,2>{0.443501085f, 0.938643396f},
-std::array<float,2>{0.436679304f, 0.230045065f},
-std::array<float,2>{0.665408313f, 0.576809943f},
-std::array<float,2>{0.901783943f, 0.267878771f},
-std::array<float,2>{0.0927799344f, 0.852299273f},
-std::array<float,2>{0.138509884f, 0.484820157f},
-std::array<float,2>{0.760492206f, 0.904975414f},
-std::array<float,2>{0.567327499f, 0.0136701213f},
-std::array<float,2>{0.260420442f, 0.662183404f},
-std::array<float,2>{0.495109022f, 0.417209238f},
-std::array<float,2>{0.744236887f, 0.980716169f},
-std::array<float,2>{0.949515939f, 0.111153178f},
-std::array<float,2>{0.03199834f, 0.703633964f},
-std::array<float,2>{0.220577702f, 0.177364588f},
-std::array<float,2>{0.821124613f, 0.553390145f},
-std::array<float,2>{0.513868093f, 0.37356621f},
-std::array<float,2>{0.360904843f, 0.767722726f},
-std::array<float,2>{0.294678003f, 0.0588410199f},
-std::array<float,2>{0.616110623f, 0.62606734f},
-std::array<float,2>{0.791437507f, 0.465943545f},
-std::array<float,2>{0.182884499f, 0.929001629f},
-std::array<float,2>{0.103568316f, 0.289083153f},
-std::array<float,2>{0.925639451f, 0.813113451f},
-std::array<float,2>{0.631932974f, 0.215950623f},
-std::array<float,2>{0.399394542f, 0.611694813f},
-std::array<float,2>{0.452401608f, 0.363226324f},
-std::array<float,2>{0.718316495f, 0.777031779f},
-std::array<float,2>{0.980526865f, 0.185075283f},
-std::array<float,2>{0.0113482587f, 0.560431659f},
-std::array<float,2>{0.192921788f, 0.119974427f},
-std::array<float,2>{0.843790054f, 0.716789603f},
-std::array<float,2>{0.561070859f, 0.41328913f},
-std::array<float,2>{0.339857429f, 0.971432209f},
-std::array<float,2>{0.251651108f, 0.207361519f},
-std::array<float,2>{0.575251758f, 0.623705566f},
-std::array<float,2>{0.754967451f, 0.284942895f},
-std::array<float,2>{0.12981084f, 0.826521933f},
-std::array<float,2>{0.0848915577f, 0.458639324f},
-std::array<float,2>{0.895961165f, 0.936434507f},
-std::array<float,2>{0.658548534f, 0.0514295958f},
-std::array<float,2>{0.426892668f, 0.636621892f},
-std::array<float,2>{0.374987632f, 0.405027837f},
-std::array<float,2>{0.502571046f, 0.950147271f},
-std::array<float,2>{0.816521168f, 0.0688001588f},
-std::array<float,2>{0.232051387f, 0.746802509f},
-std::array<float,2>{0.0422739796f, 0.130212888f},
-std::array<float,2>{0.938418269f, 0.521715403f},
-std::array<float,2>{0.735860825f, 0.315648794f},
-std::array<float,2>{0.488903761f, 0.810104549f},
-std::array<float,2>{0.394328594f, 0.00230854866f},
-std::array<float,2>{0.634417713f, 0.670970917f},
-std::array<float,2>{0.93100518f, 0.498320609f},
-std::array<float,2>{0.10002736f, 0.894977748f},
-std::array<float,2>{0.175680593f, 0.274322271f},
-std::array<float,2>{0.788588285f, 0.845021665f},
-std::array<float,2>{0.618311107f, 0.219963819f},
-std::array<float,2>{0.283020675f, 0.562974513f},
-std::array<float,2>{0.305753231f, 0.309133291f},
-std::array<float,2>{0.600371897f, 0.842391729f},
-std::array<float,2>{0.797138393f, 0.187500969f},
-std::array<float,2>{0.158087507f, 0.597272038f},
-std::array<float,2>{0.121940374f, 0.0444546863f},
-std::array<float,2>{0.907907605f, 0.650131404f},
-std::array<float,2>{0.644576013f, 0.4510023f},
-std::array<float,2>{0.37794894f, 0.921015024f},
-std::array<float,2>{0.474674582f, 0.168606982f},
-std::array<float,2>{0.720252931f, 0.532521486f},
-std::array<float,2>{0.958324015f, 0.351352394f},
-std::array<float,2>{0.0561601669f, 0.765076995f},
-std::array<float,2>{0.236357212f, 0.430562109f},
-std::array<float,2>{0.843716443f, 0.985109568f},
-std::array<float,2>{0.518086612f, 0.108081423f},
-std::array<float,2>{0.35315603f, 0.696270227f},
-std::array<float,2>{0.407785267f, 0.470343143f},
-std::array<float,2>{0.680802107f, 0.882849574f},
-std::array<float,2>{0.886844635f, 0.0246723257f},
-std::array<float,2>{0.0677920654f, 0.685885906f},
-std::array<float,2>{0.154359654f, 0.244577304f},
-std::array<float,2>{0.767577827f, 0.586357594f},
-std::array<float,2>{0.589076161f, 0.261443645f},
-std::array<float,2>{0.269548237f, 0.863747835f},
-std::array<float,2>{0.324663043f, 0.0836422592f},
-std::array<float,2>{0.537065268f, 0.725524306f},
-std::array<float,2>{0.870847702f, 0.388464242f},
-std::array<float,2>{0.205033392f, 0.966552734f},
-std::array<float,2>{0.0200953633f, 0.343309194f},
-std::array<float,2>{0.986222446f, 0.796301007f},
-std::array<float,2>{0.698005617f, 0.142878711f},
-std::array<float,2>{0.461594582f, 0.508954585f},
-std::array<float,2>{0.412794799f, 0.369750887f},
-std::array<float,2>{0.685262859f, 0.772392035f},
-std::array<float,2>{0.885572016f, 0.172161534f},
-std::array<float,2>{0.0625452921f, 0.547114134f},
-std::array<float,2>{0.148630366f, 0.116610251f},
-std::array<float,2>{0.77077651f, 0.710770011f},
-std::array<float,2>{0.593663335f, 0.419155627f},
-std::array<float,2>{0.267448425f, 0.978976905f},
-std::array<float,2>{0.320452631f, 0.214362696f},
-std::array<float,2>{0.534038305f, 0.617160738f},
-std::array<float,2>{0.871514797f, 0.294536948f},
-std::array<float,2>{0.209758043f, 0.819821298f},
-std::array<float,2>{0.0176993981f, 0.463161588f},
-std::array<float,2>{0.990743995f, 0.923464596f},
-std::array<float,2>{0.702123463f, 0.0583698079f},
-std::array<float,2>{0.467086315f, 0.631092906f},
-std::array<float,2>{0.309880674f, 0.394643962f},
-std::array<float,2>{0.597612619f, 0.942779899f},
-std::array<float,2>{0.803384304f, 0.0774393305f},
-std::array<float,2>{0.162400991f, 0.736067593f},
-std::array<float,2>{0.118390456f, 0.133306071f},
-std::array<float,2>{0.910807073f, 0.530863941f},
-std::array<float,2>{0.643404722f, 0.324030191f},
-std::array<float,2>{0.382374763f, 0.804438353f},
-std::array<float,2>{0.469941676f, 0.0116081126f},
-std::array<float,2>{0.725695312f, 0.658584058f},
-std::array<float,2>{0.953448415f, 0.490200549f},
-std::array<float,2>{0.062406864f, 0.899194896f},
-std::array<float,2>{0.239626408f, 0.273080647f},
-std::array<float,2>{0.838127911f, 0.858722687f},
-std::array<float,2>{0.522168338f, 0.232461482f},
-std::array<float,2>{0.355984986f, 0.573572934f},
-std::array<float,2>{0.370781511f, 0.301551193f},
-std::array<float,2>{0.506647646f, 0.828507185f},
-std::array<float,2>{0.813104928f, 0.200145096f},
-std::array<float,2>{0.229565874f, 0.604391515f},
-std::array<float,2>{0.0461069122f, 0.0355595984f},
-std::array<float,2>{0.943754375f, 0.6462273f},
-std::array<float,2>{0.741273105f, 0.443126529f},
-std::array<float,2>{0.487503588f, 0.909455657f},
-std::array<float,2>{0.395680904f, 0.15800032f},
-std::array<float,2>{0.639632165f, 0.540404379f},
-std::array<float,2>{0.934176445f, 0.356752336f},
-std::array<float,2>{0.0960477516f, 0.752696395f},
-std::array<float,2>{0.177428752f, 0.429631233f},
-std::array<float,2>{0.781585813f, 0.992245078f},
-std::array<float,2>{0.624609351f, 0.0980045795f},
-std::array<float,2>{0.286442071f, 0.690811455f},
-std::array<float,2>{0.447971016f, 0.479791164f},
-std::array<float,2>{0.714303792f, 0.8810848f},
-std::array<float,2>{0.979448497f, 0.0211869702f},
-std::array<float,2>{0.0123670623f, 0.673998892f},
-std::array<float,2>{0.189965427f, 0.239713535f},
-std::array<float,2>{0.848718226f, 0.580100179f},
-std::array<float,2>{0.556294143f, 0.255468071f},
-std::array<float,2>{0.336204171f, 0.869749069f},
-std::array<float,2>{0.256308228f, 0.0933993161f},
-std::array<float,2>{0.574081421f, 0.727059484f},
-std::array<float,2>{0.753222704f, 0.375487596f},
-std::array<float,2>{0.127782628f, 0.958302557f},
-std::array<float,2>{0.0793899223f, 0.334467441f},
-std::array<float,2>{0.890845299f, 0.782088041f},
-std::array<float,2>{0.660170615f, 0.154854462f},
-std::array<float,2>{0.424270958f, 0.50584352f},
-std::array<float,2>{0.499861479f, 0.262145668f},
-std::array<float,2>{0.74730742f, 0.859743357f},
-std::array<float,2>{0.947442293f, 0.246213317f},
-std::array<float,2>{0.0356679261f, 0.590032876f},
-std::array<float,2>{0.226064369f, 0.0287561975f},
-std::array<float,2>{0.824272215f, 0.680600345f},
-std::array<float,2>{0.511481881f, 0.474257469f},
-std::array<float,2>{0.364478707f, 0.889876068f},
-std::array<float,2>{0.290393054f, 0.145700231f},
-std::array<float,2>{0.609435618f, 0.515112221f},
-std::array<float,2>{0.793803632f, 0.337328702f},
-std::array<float,2>{0.18536742f, 0.792848468f},
-std::array<float,2>{0.109367006f, 0.385930449f},
-std::array<float,2>{0.925897896f, 0.964474618f},
-std::array<float,2>{0.628718019f, 0.0802833065f},
-std::array<float,2>{0.403451473f, 0.720079422f},
-std::array<float,2>{0.332892954f, 0.448577017f},
-std::array<float,2>{0.549767971f, 0.914748728f},
-std::array<float,2>{0.854606271f, 0.0415975787f},
-std::array<float,2>{0.195677176f, 0.653998017f},
-std::array<float,2>{0.0037482481f, 0.192624003f},
-std::array<float,2>{0.97113502f, 0.597965956f},
-std::array<float,2>{0.705861032f, 0.305956692f},
-std::array<float,2>{0.441027731f, 0.835991681f},
-std::array<float,2>{0.432330847f, 0.104900397f},
-std::array<float,2>{0.670309126f, 0.700533211f},
-std::array<float,2>{0.902447701f, 0.434528768f},
-std::array<float,2>{0.0878960714f, 0.990206301f},
-std::array<float,2>{0.136232764f, 0.344324023f},
-std::array<float,2>{0.764331222f, 0.758838654f},
-std::array<float,2>{0.564889729f, 0.167889804f},
-std::array<float,2>{0.263546854f, 0.538457513f},
-std::array<float,2>{0.281008035f, 0.319848061f},
-std::array<float,2>{0.58352834f, 0.804807484f},
-std::array<float,2>{0.777767241f, 0.127894148f},
-std::array<float,2>{0.147849053f, 0.518078744f},
-std::array<float,2>{0.0744247586f, 0.0641064271f},
-std::array<float,2>{0.879574001f, 0.742400587f},
-std::array<float,2>{0.674717784f, 0.400298744f},
-std::array<float,2>{0.420758277f, 0.945750535f},
-std::array<float,2>{0.454942912f, 0.22280167f},
-std::array<float,2>{0.6941365f, 0.570186317f},
-std::array<float,2>{0.994445145f, 0.280705839f},
-std::array<float,2>{0.0247104261f, 0.850971818f},
-std::array<float,2>{0.21511364f, 0.49252817f},
-std::array<float,2>{0.861541629f, 0.891395748f},
-std::array<float,2>{0.54649508f, 0.006360617f},
-std::array<float,2>{0.315717697f, 0.665892184f},
-std::array<float,2>{0.389412045f, 0.406570971f},
-std::array<float,2>{0.654043198f, 0.973374426f},
-std::array<float,2>{0.920554399f, 0.122307219f},
-std::array<float,2>{0.116897054f, 0.713635921f},
-std::array<float,2>{0.164656967f, 0.182476088f},
-std::array<float,2>{0.809492648f, 0.555617511f},
-std::array<float,2>{0.604815781f, 0.364893377f},
-std::array<float,2>{0.298839092f, 0.778188288f},
-std::array<float,2>{0.345026791f, 0.0484306663f},
-std::array<float,2>{0.525588632f, 0.638770521f},
-std::array<float,2>{0.830339551f, 0.456002504f},
-std::array<float,2>{0.249523774f, 0.9305287f},
-std::array<float,2>{0.0544760004f, 0.288030982f},
-std::array<float,2>{0.963697731f, 0.823295057f},
-std::array<float,2>{0.729209185f, 0.205904827f},
-std::array<float,2>{0.480370164f, 0.617312372f},
-std::array<float,2>{0.400242358f, 0.291746259f},
-std::array<float,2>{0.630873382f, 0.815070927f},
-std::array<float,2>{0.924218178f, 0.217624977f},
-std::array<float,2>{0.104607426f, 0.610824525f},
-std::array<float,2>{0.182204127f, 0.0611844696f},
-std::array<float,2>{0.792295694f, 0.627806664f},
-std::array<float,2>{0.617111087f, 0.468366951f},
-std::array<float,2>{0.293514222f, 0.927313387f},
-std::array<float,2>{0.36007157f, 0.179004461f},
-std::array<float,2>{0.514793217f, 0.552418053f},
-std::array<float,2>{0.821510911f, 0.372543216f},
-std::array<float,2>{0.219395339f, 0.767539918f},
-std::array<float,2>{0.0325637087f, 0.414427608f},
-std::array<float,2>{0.95108974f, 0.982589602f},
-std::array<float,2>{0.745700777f, 0.112355679f},
-std::array<float,2>{0.495782346f, 0.705238104f},
-std::array<float,2>{0.260962188f, 0.486523777f},
-std::array<float,2>{0.567603886f, 0.903707027f},
-std::array<float,2>{0.761389673f, 0.0142761599f},
-std::array<float,2>{0.137638897f, 0.661418796f},
-std::array<float,2>{0.0926172808f, 0.226567939f},
-std::array<float,2>{0.901255727f, 0.574458718f},
-std::array<float,2>{0.664386511f, 0.266587406f},
-std::array<float,2>{0.435668528f, 0.855373383f},
-std::array<float,2>{0.44495666f, 0.0715717077f},
-std::array<float,2>{0.710064828f, 0.740765989f},
-std::array<float,2>{0.974334359f, 0.391296834f},
-std::array<float,2>{0.00657283654f, 0.940890193f},
-std::array<float,2>{0.202578694f, 0.324642837f},
-std::array<float,2>{0.859059393f, 0.797996521f},
-std::array<float,2>{0.554121852f, 0.137465954f},
-std::array<float,2>{0.328690559f, 0.524310589f},
-std::array<float,2>{0.319847852f, 0.35371688f},
-std::array<float,2>{0.541431427f, 0.757355392f},
-std::array<float,2>{0.866794765f, 0.162740856f},
-std::array<float,2>{0.214285836f, 0.546118617f},
-std::array<float,2>{0.0309606232f, 0.0957458541f},
-std::array<float,2>{0.997836351f, 0.694423258f},
-std::array<float,2>{0.690226257f, 0.425323874f},
-std::array<float,2>{0.458790123f, 0.997676194f},
-std::array<float,2>{0.414292037f, 0.196358025f},
-std::array<float,2>{0.67761296f, 0.608530819f},
-std::array<float,2>{0.875840425f, 0.29722476f},
-std::array<float,2>{0.0731751174f, 0.835014284f},
-std::array<float,2>{0.144129932f, 0.437948078f},
-std::array<float,2>{0.775984585f, 0.912632823f},
-std::array<float,2>{0.581738412f, 0.0341788903f},
-std::array<float,2>{0.275526345f, 0.64131093f},
-std::array<float,2>{0.484256089f, 0.382740825f},
-std::array<float,2>{0.731611013f, 0.954817712f},
-std::array<float,2>{0.968331158f, 0.0889014006f},
-std::array<float,2>{0.0478758998f, 0.731358826f},
-std::array<float,2>{0.245068416f, 0.149613872f},
-std::array<float,2>{0.835302472f, 0.50047183f},
-std::array<float,2>{0.53016001f, 0.329136848f},
-std::array<float,2>{0.348243088f, 0.785738885f},
-std::array<float,2>{0.301801831f, 0.0159262586f},
-std::array<float,2>{0.608310819f, 0.676540613f},
-std::array<float,2>{0.805175066f, 0.484143138f},
-std::array<float,2>{0.169760257f, 0.877573967f},
-std::array<float,2>{0.111051857f, 0.251147896f},
-std::array<float,2>{0.915401876f, 0.871570766f},
-std::array<float,2>{0.651707411f, 0.237566262f},
-std::array<float,2>{0.386129946f, 0.584519446f},
-std::array<float,2>{0.462720722f, 0.340206236f},
-std::array<float,2>{0.698604763f, 0.793988228f},
-std::array<float,2>{0.984710991f, 0.142112643f},
-std::array<float,2>{0.0206924137f, 0.509879947f},
-std::array<float,2>{0.203224838f, 0.0851725638f},
-std::array<float,2>{0.869847298f, 0.724013388f},
-std::array<float,2>{0.535269141f, 0.389255315f},
-std::array<float,2>{0.325781912f, 0.968255341f},
-std::array<float,2>{0.27125138f, 0.24262476f},
-std::array<float,2>{0.588087738f, 0.588254511f},
-std::array<float,2>{0.765885651f, 0.258773535f},
-std::array<float,2>{0.1557329f, 0.867174685f},
-std::array<float,2>{0.0666130111f, 0.471951723f},
-std::array<float,2>{0.887762725f, 0.885488331f},
-std::array<float,2>{0.680061162f, 0.0263351891f},
-std::array<float,2>{0.40664953f, 0.684001803f},
-std::array<float,2>{0.352466375f, 0.432665169f},
-std::array<float,2>{0.518590987f, 0.98724407f},
-std::array<float,2>{0.842000902f, 0.107067175f},
-std::array<float,2>{0.237624198f, 0.698512018f},
-std::array<float,2>{0.0551714785f, 0.171017677f},
-std::array<float,2>{0.957613111f, 0.5339095f},
-std::array<float,2>{0.719005466f, 0.349025279f},
-std::array<float,2>{0.475979f, 0.762141526f},
-std::array<float,2>{0.377143443f, 0.0452311113f},
-std::array<float,2>{0.645945907f, 0.651438355f},
-std::array<float,2>{0.907205522f, 0.452543288f},
-std::array<float,2>{0.122501612f, 0.918928981f},
-std::array<float,2>{0.156264246f, 0.311317801f},
-std::array<float,2>{0.798413754f, 0.840173841f},
-std::array<float,2>{0.600786448f, 0.191246286f},
-std::array<float,2>{0.304733574f, 0.595328271f},
-std::array<float,2>{0.281269461f, 0.276105613f},
-std::array<float,2>{0.617675245f, 0.846423686f},
-std::array<float,2>{0.78730166f, 0.222618058f},
-std::array<float,2>{0.17429474f, 0.566325128f},
-std::array<float,2>{0.100664452f, 0.000793706742f},
-std::array<float,2>{0.930503845f, 0.66798526f},
-std::array<float,2>{0.633590996f, 0.497878432f},
-std::array<float,2>{0.393413424f, 0.897818387f},
-std::array<float,2>{0.489925057f, 0.132305071f},
-std::array<float,2>{0.734640777f, 0.520114422f},
-std::array<float,2>{0.939079106f, 0.313731968f},
-std::array<float,2>{0.0416682176f, 0.812162519f},
-std::array<float,2>{0.230515406f, 0.40282923f},
-std::array<float,2>{0.817448258f, 0.951700866f},
-std::array<float,2>{0.503494442f, 0.0682278648f},
-std::array<float,2>{0.373534352f, 0.748180568f},
-std::array<float,2>{0.42639488f, 0.459929913f},
-std::array<float,2>{0.659349382f, 0.934188068f},
-std::array<float,2>{0.895254076f, 0.0536064059f},
-std::array<float,2>{0.0855514556f, 0.634392679f},
-std::array<float,2>{0.130631715f, 0.210029766f},
-std::array<float,2>{0.754704475f, 0.621522784f},
-std::array<float,2>{0.57429111f, 0.282582462f},
-std::array<float,2>{0.250723243f, 0.824407816f},
-std::array<float,2>{0.341198206f, 0.117429547f},
-std::array<float,2>{0.56155467f, 0.716894448f},
-std::array<float,2>{0.845508933f, 0.412037551f},
-std::array<float,2>{0.191996261f, 0.969990671f},
-std::array<float,2>{0.01016331f, 0.3605977f},
-std::array<float,2>{0.981586039f, 0.774929583f},
-std::array<float,2>{0.717598557f, 0.187149793f},
-std::array<float,2>{0.45209828f, 0.562286794f},
-std::array<float,2>{0.380053163f, 0.320783913f},
-std::array<float,2>{0.641405284f, 0.802427173f},
-std::array<float,2>{0.913837492f, 0.135977596f},
-std::array<float,2>{0.119263917f, 0.528434873f},
-std::array<float,2>{0.160937786f, 0.0761277899f},
-std::array<float,2>{0.80187875f, 0.737423003f},
-std::array<float,2>{0.593791842f, 0.396900952f},
-std::array<float,2>{0.311498314f, 0.944283068f},
-std::array<float,2>{0.357501835f, 0.231668562f},
-std::array<float,2>{0.520283818f, 0.572251439f},
-std::array<float,2>{0.836135685f, 0.270940155f},
-std::array<float,2>{0.24173893f, 0.857054353f},
-std::array<float,2>{0.0592755564f, 0.491615206f},
-std::array<float,2>{0.95521754f, 0.902090251f},
-std::array<float,2>{0.7236799f, 0.00787116494f},
-std::array<float,2>{0.472273767f, 0.657775462f},
-std::array<float,2>{0.269218534f, 0.421443611f},
-std::array<float,2>{0.590248048f, 0.977045178f},
-std::array<float,2>{0.772549629f, 0.115155347f},
-std::array<float,2>{0.151937008f, 0.707106948f},
-std::array<float,2>{0.0660142303f, 0.17395775f},
-std::array<float,2>{0.883501589f, 0.549719989f},
-std::array<float,2>{0.687396109f, 0.368699461f},
-std::array<float,2>{0.41125083f, 0.771083355f},
-std::array<float,2>{0.46557346f, 0.0554577932f},
-std::array<float,2>{0.700750887f, 0.630350411f},
-std::array<float,2>{0.989688814f, 0.461169779f},
-std::array<float,2>{0.0156793911f, 0.925163388f},
-std::array<float,2>{0.207188711f, 0.296078533f},
-std::array<float,2>{0.874006152f, 0.81736213f},
-std::array<float,2>{0.532290637f, 0.211887583f},
-std::array<float,2>{0.324116111f, 0.613590837f},
-std::array<float,2>{0.337923914f, 0.256337017f},
-std::array<float,2>{0.556701779f, 0.868636072f},
-std::array<float,2>{0.850315928f, 0.242164895f},
-std::array<float,2>{0.188702673f, 0.578188419f},
-std::array<float,2>{0.0149901668f, 0.0219810419f},
-std::array<float,2>{0.977472067f, 0.672226131f},
-std::array<float,2>{0.711338997f, 0.477376968f},
-std::array<float,2>{0.445367873f, 0.880509615f},
-std::array<float,2>{0.423770845f, 0.15363422f},
-std::array<float,2>{0.663692236f, 0.50648874f},
-std::array<float,2>{0.893310368f, 0.332222223f},
-std::array<float,2>{0.0816577077f, 0.784466982f},
-std::array<float,2>{0.125451013f, 0.378275067f},
-std::array<float,2>{0.750011325f, 0.960480154f},
-std::array<float,2>{0.571245074f, 0.0914383307f},
-std::array<float,2>{0.25492242f, 0.730047882f},
-std::array<float,2>{0.484669328f, 0.445223212f},
-std::array<float,2>{0.739970088f, 0.907264888f},
-std::array<float,2>{0.943035781f, 0.0375732966f},
-std::array<float,2>{0.0439472497f, 0.646812975f},
-std::array<float,2>{0.227394283f, 0.201551229f},
-std::array<float,2>{0.816245317f, 0.601871312f},
-std::array<float,2>{0.504597545f, 0.303856641f},
-std::array<float,2>{0.369122356f, 0.831367075f},
-std::array<float,2>{0.287271202f, 0.101226695f},
-std::array<float,2>{0.622585475f, 0.689084709f},
-std::array<float,2>{0.783251286f, 0.427303076f},
-std::array<float,2>{0.17859225f, 0.994710326f},
-std::array<float,2>{0.0942103788f, 0.357987165f},
-std::array<float,2>{0.937014937f, 0.751205504f},
-std::array<float,2>{0.638236165f, 0.159423187f},
-std::array<float,2>{0.39821431f, 0.542572677f},
-std::array<float,2>{0.438335538f, 0.307343185f},
-std::array<float,2>{0.704627693f, 0.839665294f},
-std::array<float,2>{0.970488608f, 0.194974929f},
-std::array<float,2>{0.000822491536f, 0.599897981f},
-std::array<float,2>{0.197583318f, 0.040044833f},
-std::array<float,2>{0.851948023f, 0.654495537f},
-std::array<float,2>{0.547559857f, 0.447050333f},
-std::array<float,2>{0.335422009f, 0.917140782f},
-std::array<float,2>{0.264771968f, 0.165269062f},
-std::array<float,2>{0.563433766f, 0.535769105f},
-std::array<float,2>{0.763512671f, 0.345956445f},
-std::array<float,2>{0.133515999f, 0.760398507f},
-std::array<float,2>{0.0866800547f, 0.436920673f},
-std::array<float,2>{0.90469265f, 0.990254819f},
-std::array<float,2>{0.669830561f, 0.102396205f},
-std::array<float,2>{0.431491494f, 0.702755272f},
-std::array<float,2>{0.366005987f, 0.475903869f},
-std::array<float,2>{0.50850302f, 0.888219237f},
-std::array<float,2>{0.826806307f, 0.0296355281f},
-std::array<float,2>{0.224564105f, 0.682438076f},
-std::array<float,2>{0.037729118f, 0.248579144f},
-std::array<float,2>{0.94595468f, 0.592595518f},
-std::array<float,2>{0.749879599f, 0.264387518f},
-std::array<float,2>{0.49625501f, 0.861429453f},
-std::array<float,2>{0.405862987f, 0.0786217973f},
-std::array<float,2>{0.626296997f, 0.722642601f},
-std::array<float,2>{0.929070711f, 0.383693904f},
-std::array<float,2>{0.106799014f, 0.962312758f},
-std::array<float,2>{0.186574146f, 0.338590831f},
-std::array<float,2>{0.795537055f, 0.790607393f},
-std::array<float,2>{0.612301826f, 0.148348078f},
-std::array<float,2>{0.292311788f, 0.513636053f},
-std::array<float,2>{0.297859758f, 0.365860999f},
-std::array<float,2>{0.603015244f, 0.780388474f},
-std::array<float,2>{0.811252236f, 0.180516481f},
-std::array<float,2>{0.166848078f, 0.557219088f},
-std::array<float,2>{0.114536852f, 0.124736197f},
-std::array<float,2>{0.918838143f, 0.711558938f},
-std::array<float,2>{0.65445888f, 0.409793794f},
-std::array<float,2>{0.387707502f, 0.976003051f},
-std::array<float,2>{0.477874607f, 0.204182878f},
-std::array<float,2>{0.727251112f, 0.620235264f},
-std::array<float,2>{0.961128235f, 0.285790265f},
-std::array<float,2>{0.0511068329f, 0.820936978f},
-std::array<float,2>{0.247056544f, 0.453765452f},
-std::array<float,2>{0.828923285f, 0.932970047f},
-std::array<float,2>{0.52373749f, 0.0504314937f},
-std::array<float,2>{0.346623629f, 0.637674451f},
-std::array<float,2>{0.419873744f, 0.402182579f},
-std::array<float,2>{0.67264837f, 0.948865116f},
-std::array<float,2>{0.882528603f, 0.0645487234f},
-std::array<float,2>{0.0778757408f, 0.744628012f},
-std::array<float,2>{0.144623742f, 0.126165539f},
-std::array<float,2>{0.780914903f, 0.516948044f},
-std::array<float,2>{0.585343659f, 0.316879541f},
-std::array<float,2>{0.278017104f, 0.807292819f},
-std::array<float,2>{0.314234167f, 0.00394633878f},
-std::array<float,2>{0.54364109f, 0.667589664f},
-std::array<float,2>{0.861145437f, 0.494430214f},
-std::array<float,2>{0.218456805f, 0.894169748f},
-std::array<float,2>{0.0267066061f, 0.27820909f},
-std::array<float,2>{0.993095994f, 0.848498642f},
-std::array<float,2>{0.692030072f, 0.225238949f},
-std::array<float,2>{0.455966383f, 0.567586601f},
-std::array<float,2>{0.434403956f, 0.269062966f},
-std::array<float,2>{0.667520821f, 0.852735341f},
-std::array<float,2>{0.899553239f, 0.228769362f},
-std::array<float,2>{0.0901201963f, 0.577180743f},
-std::array<float,2>{0.138988823f, 0.012552836f},
-std::array<float,2>{0.759267271f, 0.663743079f},
-std::array<float,2>{0.569794834f, 0.486077249f},
-std::array<float,2>{0.257971764f, 0.905763686f},
-std::array<float,2>{0.330896139f, 0.138796672f},
-std::array<float,2>{0.552033901f, 0.526458502f},
-std::array<float,2>{0.856738687f, 0.327186286f},
-std::array<float,2>{0.199606016f, 0.799595356f},
-std::array<float,2>{0.00400720676f, 0.394436389f},
-std::array<float,2>{0.976314485f, 0.938344002f},
-std::array<float,2>{0.708642185f, 0.0725382715f},
-std::array<float,2>{0.442584187f, 0.738913238f},
-std::array<float,2>{0.295287549f, 0.465768695f},
-std::array<float,2>{0.6142658f, 0.92835331f},
-std::array<float,2>{0.790837109f, 0.0601536259f},
-std::array<float,2>{0.18037501f, 0.625078797f},
-std::array<float,2>{0.102386743f, 0.215757877f},
-std::array<float,2>{0.923234463f, 0.612803519f},
-std::array<float,2>{0.629283488f, 0.29093039f},
-std::array<float,2>{0.401556939f, 0.813598633f},
-std::array<float,2>{0.492633313f, 0.110326827f},
-std::array<float,2>{0.742960632f, 0.704724014f},
-std::array<float,2>{0.952982247f, 0.416580886f},
-std::array<float,2>{0.0346770771f, 0.982162774f},
-std::array<float,2>{0.220874295f, 0.374454051f},
-std::array<float,2>{0.823106349f, 0.769240737f},
-std::array<float,2>{0.511734486f, 0.176362857f},
-std::array<float,2>{0.362013251f, 0.554275453f},
-std::array<float,2>{0.351344496f, 0.330587834f},
-std::array<float,2>{0.528086483f, 0.787856579f},
-std::array<float,2>{0.832548499f, 0.152147278f},
-std::array<float,2>{0.243099198f, 0.503505588f},
-std::array<float,2>{0.0492109843f, 0.0871086717f},
-std::array<float,2>{0.966200054f, 0.73337239f},
-std::array<float,2>{0.734051228f, 0.380734861f},
-std::array<float,2>{0.482190341f, 0.955182433f},
-std::array<float,2>{0.383637965f, 0.236298785f},
-std::array<float,2>{0.648849547f, 0.583185613f},
-std::array<float,2>{0.917298317f, 0.253751457f},
-std::array<float,2>{0.112835243f, 0.873566389f},
-std::array<float,2>{0.171639636f, 0.481741905f},
-std::array<float,2>{0.807890296f, 0.876494348f},
-std::array<float,2>{0.605473518f, 0.0186563283f},
-std::array<float,2>{0.304186642f, 0.678888023f},
-std::array<float,2>{0.460230589f, 0.422193378f},
-std::array<float,2>{0.687874198f, 0.999750078f},
-std::array<float,2>{0.998348355f, 0.0944989473f},
-std::array<float,2>{0.027909115f, 0.692370772f},
-std::array<float,2>{0.212262854f, 0.161694571f},
-std::array<float,2>{0.865060568f, 0.544136643f},
-std::array<float,2>{0.54044646f, 0.352935165f},
-std::array<float,2>{0.316774935f, 0.755427539f},
-std::array<float,2>{0.274692774f, 0.0325937495f},
-std::array<float,2>{0.5783692f, 0.643885136f},
-std::array<float,2>{0.773525178f, 0.441393644f},
-std::array<float,2>{0.140907302f, 0.910716951f},
-std::array<float,2>{0.0717309341f, 0.299047768f},
-std::array<float,2>{0.878332138f, 0.832394481f},
-std::array<float,2>{0.678668618f, 0.197454602f},
-std::array<float,2>{0.416960597f, 0.607243657f},
-std::array<float,2>{0.474366605f, 0.350024998f},
-std::array<float,2>{0.720961213f, 0.764350712f},
-std::array<float,2>{0.960574806f, 0.169037551f},
-std::array<float,2>{0.0568381585f, 0.53204751f},
-std::array<float,2>{0.234758258f, 0.108612008f},
-std::array<float,2>{0.841077089f, 0.69712007f},
-std::array<float,2>{0.51712501f, 0.430767387f},
-std::array<float,2>{0.354191154f, 0.986323953f},
-std::array<float,2>{0.308501929f, 0.189335808f},
-std::array<float,2>{0.599585176f, 0.596566319f},
-std::array<float,2>{0.799835443f, 0.309652865f},
-std::array<float,2>{0.159925222f, 0.843663335f},
-std::array<float,2>{0.124662951f, 0.449531972f},
-std::array<float,2>{0.909061432f, 0.919949174f},
-std::array<float,2>{0.646831095f, 0.0437195934f},
-std::array<float,2>{0.375725597f, 0.648815989f},
-std::array<float,2>{0.326824278f, 0.387183279f},
-std::array<float,2>{0.539001167f, 0.965382338f},
-std::array<float,2>{0.868987501f, 0.0822993815f},
-std::array<float,2>{0.205561787f, 0.726312518f},
-std::array<float,2>{0.023236135f, 0.144498914f},
-std::array<float,2>{0.987581372f, 0.508265972f},
-std::array<float,2>{0.695885658f, 0.34231022f},
-std::array<float,2>{0.463470042f, 0.795525074f},
-std::array<float,2>{0.408520788f, 0.023529727f},
-std::array<float,2>{0.682434201f, 0.687475741f},
-std::array<float,2>{0.888941407f, 0.469158441f},
-std::array<float,2>{0.0694860369f, 0.884611666f},
-std::array<float,2>{0.152417734f, 0.260505795f},
-std::array<float,2>{0.767720938f, 0.865116239f},
-std::array<float,2>{0.587589264f, 0.245324582f},
-std::array<float,2>{0.272494137f, 0.586979687f},
-std::array<float,2>{0.252266258f, 0.283869773f},
-std::array<float,2>{0.577937901f, 0.827780724f},
-std::array<float,2>{0.756753266f, 0.208550647f},
-std::array<float,2>{0.131347701f, 0.62409997f},
-std::array<float,2>{0.0839013532f, 0.0520410985f},
-std::array<float,2>{0.898235083f, 0.63493818f},
-std::array<float,2>{0.656660259f, 0.457486749f},
-std::array<float,2>{0.428501517f, 0.937327266f},
-std::array<float,2>{0.450982094f, 0.184303403f},
-std::array<float,2>{0.715944529f, 0.559298396f},
-std::array<float,2>{0.983680725f, 0.362021059f},
-std::array<float,2>{0.00911833625f, 0.776064694f},
-std::array<float,2>{0.194410026f, 0.413072228f},
-std::array<float,2>{0.846700668f, 0.972133577f},
-std::array<float,2>{0.560259163f, 0.120182082f},
-std::array<float,2>{0.343398243f, 0.715449631f},
-std::array<float,2>{0.39174372f, 0.499040276f},
-std::array<float,2>{0.63482964f, 0.896119535f},
-std::array<float,2>{0.932778299f, 0.00363913318f},
-std::array<float,2>{0.0990413576f, 0.670189321f},
-std::array<float,2>{0.17297031f, 0.21922341f},
-std::array<float,2>{0.786438286f, 0.563604236f},
-std::array<float,2>{0.619246781f, 0.275162637f},
-std::array<float,2>{0.283785045f, 0.844549179f},
-std::array<float,2>{0.372643948f, 0.069717966f},
-std::array<float,2>{0.500332415f, 0.747344375f},
-std::array<float,2>{0.81995815f, 0.405470669f},
-std::array<float,2>{0.233439445f, 0.950203836f},
-std::array<float,2>{0.0395830236f, 0.314693928f},
-std::array<float,2>{0.941327155f, 0.808832109f},
-std::array<float,2>{0.736430466f, 0.129490912f},
-std::array<float,2>{0.490676135f, 0.523209155f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.832361281f, 0.564036489f},
-std::array<float,2>{0.233564287f, 0.0937271044f},
-std::array<float,2>{0.718928039f, 0.379291385f},
-std::array<float,2>{0.277361244f, 0.881390214f},
-std::array<float,2>{0.517701626f, 0.803756654f},
-std::array<float,2>{0.382078588f, 0.291672826f},
-std::array<float,2>{0.957465649f, 0.150061429f},
-std::array<float,2>{0.0458765067f, 0.676966012f},
-std::array<float,2>{0.679692864f, 0.699919581f},
-std::array<float,2>{0.367830247f, 0.228598267f},
-std::array<float,2>{0.807601511f, 0.343839675f},
-std::array<float,2>{0.167725369f, 0.846334517f},
-std::array<float,2>{0.890837312f, 0.962095141f},
-std::array<float,2>{0.117986172f, 0.446575761f},
-std::array<float,2>{0.587286294f, 0.00575651089f},
-std::array<float,2>{0.484455019f, 0.509042203f},
-std::array<float,2>{0.988273203f, 0.644440234f},
-std::array<float,2>{0.0108590275f, 0.164249882f},
-std::array<float,2>{0.558084488f, 0.269576013f},
-std::array<float,2>{0.408127457f, 0.76891315f},
-std::array<float,2>{0.687979639f, 0.926739693f},
-std::array<float,2>{0.303623289f, 0.42387104f},
-std::array<float,2>{0.854735315f, 0.102467984f},
-std::array<float,2>{0.190929532f, 0.600400627f},
-std::array<float,2>{0.6200037f, 0.53538239f},
-std::array<float,2>{0.443007052f, 0.05366439f},
-std::array<float,2>{0.921811461f, 0.469600379f},
-std::array<float,2>{0.0836847946f, 0.992940247f},
-std::array<float,2>{0.767873287f, 0.838140607f},
-std::array<float,2>{0.14399077f, 0.343581051f},
-std::array<float,2>{0.637127101f, 0.204607636f},
-std::array<float,2>{0.331917554f, 0.748280883f},
-std::array<float,2>{0.923348248f, 0.529502332f},
-std::array<float,2>{0.0637212396f, 0.0160100814f},
-std::array<float,2>{0.597501874f, 0.45801574f},
-std::array<float,2>{0.457257092f, 0.938126028f},
-std::array<float,2>{0.654612422f, 0.870528758f},
-std::array<float,2>{0.322265536f, 0.368156254f},
-std::array<float,2>{0.761639774f, 0.23902975f},
-std::array<float,2>{0.138123542f, 0.717979789f},
-std::array<float,2>{0.539161325f, 0.658723056f},
-std::array<float,2>{0.433855325f, 0.135607377f},
-std::array<float,2>{0.979168117f, 0.307553619f},
-std::array<float,2>{0.0296542402f, 0.789750874f},
-std::array<float,2>{0.867174625f, 0.900110304f},
-std::array<float,2>{0.209128454f, 0.398349434f},
-std::array<float,2>{0.706305206f, 0.0734560788f},
-std::array<float,2>{0.284155756f, 0.592235327f},
-std::array<float,2>{0.795428574f, 0.733022869f},
-std::array<float,2>{0.176173955f, 0.201373935f},
-std::array<float,2>{0.660098135f, 0.315482259f},
-std::array<float,2>{0.353333145f, 0.814686358f},
-std::array<float,2>{0.562990129f, 0.96948427f},
-std::array<float,2>{0.473829031f, 0.489247262f},
-std::array<float,2>{0.875065923f, 0.0374079794f},
-std::array<float,2>{0.106643669f, 0.55200088f},
-std::array<float,2>{0.739689589f, 0.615044355f},
-std::array<float,2>{0.252172351f, 0.120104946f},
-std::array<float,2>{0.818199515f, 0.409685671f},
-std::array<float,2>{0.236532867f, 0.920303762f},
-std::array<float,2>{0.943584681f, 0.765268505f},
-std::array<float,2>{0.0546317622f, 0.256594718f},
-std::array<float,2>{0.501390636f, 0.184845179f},
-std::array<float,2>{0.398905039f, 0.632736027f},
-std::array<float,2>{0.757104933f, 0.558789074f},
-std::array<float,2>{0.132586926f, 0.0400599763f},
-std::array<float,2>{0.641429961f, 0.492466033f},
-std::array<float,2>{0.31352663f, 0.98100394f},
-std::array<float,2>{0.605250478f, 0.824017584f},
-std::array<float,2>{0.465259463f, 0.327523977f},
-std::array<float,2>{0.933359683f, 0.194174796f},
-std::array<float,2>{0.0740020648f, 0.724544346f},
-std::array<float,2>{0.713684499f, 0.634166479f},
-std::array<float,2>{0.295963705f, 0.176529348f},
-std::array<float,2>{0.871178448f, 0.258029014f},
-std::array<float,2>{0.217716068f, 0.751639903f},
-std::array<float,2>{0.9707039f, 0.912822902f},
-std::array<float,2>{0.0192601401f, 0.420483202f},
-std::array<float,2>{0.538245499f, 0.116499975f},
-std::array<float,2>{0.42568475f, 0.624402046f},
-std::array<float,2>{0.887016892f, 0.703750551f},
-std::array<float,2>{0.0953137204f, 0.244847432f},
-std::array<float,2>{0.573818207f, 0.363182455f},
-std::array<float,2>{0.477666438f, 0.860300064f},
-std::array<float,2>{0.666067779f, 0.948442876f},
-std::array<float,2>{0.34559083f, 0.461095512f},
-std::array<float,2>{0.789003372f, 0.0264362097f},
-std::array<float,2>{0.181347221f, 0.523316503f},
-std::array<float,2>{0.514585733f, 0.578460395f},
-std::array<float,2>{0.39192763f, 0.0635962859f},
-std::array<float,2>{0.950085759f, 0.40022859f},
-std::array<float,2>{0.0584935546f, 0.896396041f},
-std::array<float,2>{0.824181616f, 0.784467936f},
-std::array<float,2>{0.244351655f, 0.299306452f},
-std::array<float,2>{0.745999753f, 0.12992534f},
-std::array<float,2>{0.264833152f, 0.670761406f},
-std::array<float,2>{0.962088466f, 0.605415523f},
-std::array<float,2>{0.0340161808f, 0.0953925774f},
-std::array<float,2>{0.528667152f, 0.43717134f},
-std::array<float,2>{0.390230536f, 0.936881006f},
-std::array<float,2>{0.728335321f, 0.77694422f},
-std::array<float,2>{0.26769954f, 0.277732909f},
-std::array<float,2>{0.840442896f, 0.157904863f},
-std::array<float,2>{0.221472114f, 0.654716134f},
-std::array<float,2>{0.580286443f, 0.73832643f},
-std::array<float,2>{0.494516939f, 0.214910805f},
-std::array<float,2>{0.898500144f, 0.331106663f},
-std::array<float,2>{0.114583157f, 0.83552134f},
-std::array<float,2>{0.797742248f, 0.988700926f},
-std::array<float,2>{0.163361758f, 0.483155191f},
-std::array<float,2>{0.678088307f, 0.0623545758f},
-std::array<float,2>{0.361569941f, 0.545694709f},
-std::array<float,2>{0.844563305f, 0.681630313f},
-std::array<float,2>{0.201044828f, 0.143908799f},
-std::array<float,2>{0.698952854f, 0.281955808f},
-std::array<float,2>{0.306371331f, 0.807721853f},
-std::array<float,2>{0.554244161f, 0.887269199f},
-std::array<float,2>{0.42150712f, 0.384656668f},
-std::array<float,2>{0.99433434f, 0.0821882039f},
-std::array<float,2>{0.00667778915f, 0.574469149f},
-std::array<float,2>{0.625651181f, 0.501586676f},
-std::array<float,2>{0.342812866f, 0.0151119232f},
-std::array<float,2>{0.77598536f, 0.44140783f},
-std::array<float,2>{0.154584885f, 0.956975579f},
-std::array<float,2>{0.907302856f, 0.857941389f},
-std::array<float,2>{0.0877925158f, 0.359129846f},
-std::array<float,2>{0.615320563f, 0.224940971f},
-std::array<float,2>{0.447411627f, 0.692405581f},
-std::array<float,2>{0.868345559f, 0.512031317f},
-std::array<float,2>{0.213900492f, 0.00327753881f},
-std::array<float,2>{0.717826307f, 0.452803373f},
-std::array<float,2>{0.291437477f, 0.967974603f},
-std::array<float,2>{0.534096003f, 0.8508448f},
-std::array<float,2>{0.427524507f, 0.348543465f},
-std::array<float,2>{0.973564863f, 0.231266797f},
-std::array<float,2>{0.0228010938f, 0.696191311f},
-std::array<float,2>{0.645557821f, 0.673837364f},
-std::array<float,2>{0.318016797f, 0.152434662f},
-std::array<float,2>{0.751836479f, 0.296390384f},
-std::array<float,2>{0.125650689f, 0.799369216f},
-std::array<float,2>{0.937376201f, 0.875384033f},
-std::array<float,2>{0.0746491626f, 0.375344843f},
-std::array<float,2>{0.60898608f, 0.0871669799f},
-std::array<float,2>{0.461141706f, 0.567791462f},
-std::array<float,2>{0.947031558f, 0.742199659f},
-std::array<float,2>{0.0621812791f, 0.2088698f},
-std::array<float,2>{0.511191428f, 0.338514477f},
-std::array<float,2>{0.395624816f, 0.840572476f},
-std::array<float,2>{0.749686718f, 0.999632239f},
-std::array<float,2>{0.258034796f, 0.474409521f},
-std::array<float,2>{0.826971352f, 0.0478606969f},
-std::array<float,2>{0.249488398f, 0.534447491f},
-std::array<float,2>{0.577883124f, 0.596680999f},
-std::array<float,2>{0.482622951f, 0.107460901f},
-std::array<float,2>{0.884354353f, 0.429559201f},
-std::array<float,2>{0.0978440344f, 0.925083995f},
-std::array<float,2>{0.78456521f, 0.77066952f},
-std::array<float,2>{0.184383914f, 0.268196076f},
-std::array<float,2>{0.668492556f, 0.170297951f},
-std::array<float,2>{0.347917855f, 0.648075938f},
-std::array<float,2>{0.903980136f, 0.589670837f},
-std::array<float,2>{0.112544127f, 0.076791659f},
-std::array<float,2>{0.582293034f, 0.393989831f},
-std::array<float,2>{0.498270929f, 0.902522027f},
-std::array<float,2>{0.67208457f, 0.795677006f},
-std::array<float,2>{0.364942282f, 0.309693992f},
-std::array<float,2>{0.804418504f, 0.139803261f},
-std::array<float,2>{0.15702261f, 0.660281777f},
-std::array<float,2>{0.526839614f, 0.711678028f},
-std::array<float,2>{0.385947824f, 0.236927852f},
-std::array<float,2>{0.965182185f, 0.372474223f},
-std::array<float,2>{0.0376575105f, 0.873062134f},
-std::array<float,2>{0.836020768f, 0.942276657f},
-std::array<float,2>{0.22353977f, 0.45566991f},
-std::array<float,2>{0.733141422f, 0.0197673924f},
-std::array<float,2>{0.271467119f, 0.524273872f},
-std::array<float,2>{0.780276537f, 0.62765187f},
-std::array<float,2>{0.151856706f, 0.181328073f},
-std::array<float,2>{0.631945133f, 0.252744168f},
-std::array<float,2>{0.33943665f, 0.760791004f},
-std::array<float,2>{0.612493515f, 0.916615605f},
-std::array<float,2>{0.452115536f, 0.41359818f},
-std::array<float,2>{0.910673559f, 0.121816039f},
-std::array<float,2>{0.0928796455f, 0.610782683f},
-std::array<float,2>{0.699398994f, 0.550158143f},
-std::array<float,2>{0.310877889f, 0.032299865f},
-std::array<float,2>{0.847705483f, 0.487386733f},
-std::array<float,2>{0.198376507f, 0.972797573f},
-std::array<float,2>{0.999120474f, 0.819813609f},
-std::array<float,2>{0.0014225652f, 0.318268448f},
-std::array<float,2>{0.549910665f, 0.196870998f},
-std::array<float,2>{0.417053431f, 0.72819674f},
-std::array<float,2>{0.81093049f, 0.619107783f},
-std::array<float,2>{0.16903463f, 0.109614879f},
-std::array<float,2>{0.686644733f, 0.414419204f},
-std::array<float,2>{0.374779344f, 0.908014357f},
-std::array<float,2>{0.591527641f, 0.755338728f},
-std::array<float,2>{0.489289314f, 0.264200121f},
-std::array<float,2>{0.898143947f, 0.172249109f},
-std::array<float,2>{0.121592723f, 0.638592243f},
-std::array<float,2>{0.724850237f, 0.718980432f},
-std::array<float,2>{0.273742378f, 0.189062983f},
-std::array<float,2>{0.830265701f, 0.32103321f},
-std::array<float,2>{0.22861062f, 0.827187777f},
-std::array<float,2>{0.954279959f, 0.977243304f},
-std::array<float,2>{0.042612575f, 0.499866754f},
-std::array<float,2>{0.522695124f, 0.0455932654f},
-std::array<float,2>{0.376818329f, 0.554884791f},
-std::array<float,2>{0.91476965f, 0.666015923f},
-std::array<float,2>{0.0796705484f, 0.125477031f},
-std::array<float,2>{0.623640478f, 0.301683724f},
-std::array<float,2>{0.439618886f, 0.787469923f},
-std::array<float,2>{0.635690987f, 0.893832386f},
-std::array<float,2>{0.332196623f, 0.405730903f},
-std::array<float,2>{0.771597266f, 0.0698399171f},
-std::array<float,2>{0.14795962f, 0.585425675f},
-std::array<float,2>{0.560434163f, 0.519483447f},
-std::array<float,2>{0.410738111f, 0.0292022973f},
-std::array<float,2>{0.98968178f, 0.4668217f},
-std::array<float,2>{0.015009461f, 0.949250221f},
-std::array<float,2>{0.858458936f, 0.863609016f},
-std::array<float,2>{0.192120433f, 0.364592671f},
-std::array<float,2>{0.692587972f, 0.247952491f},
-std::array<float,2>{0.298402786f, 0.710590839f},
-std::array<float,2>{0.982477486f, 0.542223513f},
-std::array<float,2>{0.026048867f, 0.0558537841f},
-std::array<float,2>{0.545726597f, 0.479219645f},
-std::array<float,2>{0.432347924f, 0.988265514f},
-std::array<float,2>{0.709804416f, 0.828358889f},
-std::array<float,2>{0.287141621f, 0.335684896f},
-std::array<float,2>{0.859931052f, 0.214191571f},
-std::array<float,2>{0.206200853f, 0.737507224f},
-std::array<float,2>{0.601388276f, 0.650764644f},
-std::array<float,2>{0.455518246f, 0.163031369f},
-std::array<float,2>{0.928571165f, 0.275149763f},
-std::array<float,2>{0.0683876872f, 0.780288875f},
-std::array<float,2>{0.762318254f, 0.929934323f},
-std::array<float,2>{0.136095122f, 0.431614727f},
-std::array<float,2>{0.652287245f, 0.0993571877f},
-std::array<float,2>{0.326369673f, 0.609210551f},
-std::array<float,2>{0.815529466f, 0.690851033f},
-std::array<float,2>{0.239049926f, 0.221461803f},
-std::array<float,2>{0.737031937f, 0.354000628f},
-std::array<float,2>{0.257422209f, 0.85299927f},
-std::array<float,2>{0.505806684f, 0.957379937f},
-std::array<float,2>{0.405043811f, 0.437876672f},
-std::array<float,2>{0.938880742f, 0.0111204563f},
-std::array<float,2>{0.047523126f, 0.506213248f},
-std::array<float,2>{0.660320461f, 0.571662426f},
-std::array<float,2>{0.355793059f, 0.079854086f},
-std::array<float,2>{0.789184988f, 0.38731885f},
-std::array<float,2>{0.172776297f, 0.883885384f},
-std::array<float,2>{0.880327761f, 0.810931802f},
-std::array<float,2>{0.102738842f, 0.286432296f},
-std::array<float,2>{0.567686915f, 0.145945325f},
-std::array<float,2>{0.471705556f, 0.683853328f},
-std::array<float,2>{0.852163136f, 0.598250926f},
-std::array<float,2>{0.187897727f, 0.104378559f},
-std::array<float,2>{0.689878821f, 0.42297104f},
-std::array<float,2>{0.301873505f, 0.929353893f},
-std::array<float,2>{0.556214571f, 0.767514646f},
-std::array<float,2>{0.408239126f, 0.271641016f},
-std::array<float,2>{0.986132324f, 0.167895138f},
-std::array<float,2>{0.00886517111f, 0.640768707f},
-std::array<float,2>{0.638928294f, 0.74675411f},
-std::array<float,2>{0.328788131f, 0.206230372f},
-std::array<float,2>{0.765975237f, 0.340584576f},
-std::array<float,2>{0.140736461f, 0.836759567f},
-std::array<float,2>{0.919340551f, 0.99495393f},
-std::array<float,2>{0.0842862725f, 0.472249836f},
-std::array<float,2>{0.617863774f, 0.0515201725f},
-std::array<float,2>{0.443586826f, 0.538974047f},
-std::array<float,2>{0.959421158f, 0.678472102f},
-std::array<float,2>{0.0439560935f, 0.150417581f},
-std::array<float,2>{0.51567471f, 0.290958911f},
-std::array<float,2>{0.379620582f, 0.80218488f},
-std::array<float,2>{0.721375704f, 0.880203903f},
-std::array<float,2>{0.279637724f, 0.382578522f},
-std::array<float,2>{0.835360944f, 0.0909270123f},
-std::array<float,2>{0.230797663f, 0.56587404f},
-std::array<float,2>{0.588978887f, 0.511695802f},
-std::array<float,2>{0.486737818f, 0.00638679741f},
-std::array<float,2>{0.893124163f, 0.447324783f},
-std::array<float,2>{0.120954342f, 0.964310706f},
-std::array<float,2>{0.805859447f, 0.844762504f},
-std::array<float,2>{0.164883018f, 0.346230835f},
-std::array<float,2>{0.682825387f, 0.228274256f},
-std::array<float,2>{0.370457023f, 0.701328993f},
-std::array<float,2>{0.877359688f, 0.553802788f},
-std::array<float,2>{0.109351665f, 0.0354213193f},
-std::array<float,2>{0.565355718f, 0.491645128f},
-std::array<float,2>{0.476417303f, 0.972424269f},
-std::array<float,2>{0.657790422f, 0.813136697f},
-std::array<float,2>{0.35512504f, 0.314163148f},
-std::array<float,2>{0.79360497f, 0.199528843f},
-std::array<float,2>{0.178586885f, 0.731988013f},
-std::array<float,2>{0.50226599f, 0.63038063f},
-std::array<float,2>{0.40105772f, 0.18676427f},
-std::array<float,2>{0.942243457f, 0.254654139f},
-std::array<float,2>{0.0524585843f, 0.763192475f},
-std::array<float,2>{0.820293784f, 0.918094218f},
-std::array<float,2>{0.235772252f, 0.407563657f},
-std::array<float,2>{0.740874827f, 0.11735595f},
-std::array<float,2>{0.251396328f, 0.617168963f},
-std::array<float,2>{0.759702265f, 0.71501255f},
-std::array<float,2>{0.140501514f, 0.241807938f},
-std::array<float,2>{0.653174937f, 0.370306551f},
-std::array<float,2>{0.323759109f, 0.867191076f},
-std::array<float,2>{0.595311761f, 0.939826429f},
-std::array<float,2>{0.459549904f, 0.459709913f},
-std::array<float,2>{0.92472744f, 0.0179521106f},
-std::array<float,2>{0.0661103651f, 0.528921604f},
-std::array<float,2>{0.704329908f, 0.590180755f},
-std::array<float,2>{0.282639146f, 0.0719013736f},
-std::array<float,2>{0.863525867f, 0.394991755f},
-std::array<float,2>{0.207168132f, 0.901190817f},
-std::array<float,2>{0.977841556f, 0.791849732f},
-std::array<float,2>{0.0278605148f, 0.306572199f},
-std::array<float,2>{0.541436255f, 0.132826209f},
-std::array<float,2>{0.436769545f, 0.656408906f},
-std::array<float,2>{0.786647677f, 0.52036649f},
-std::array<float,2>{0.181943536f, 0.0250831097f},
-std::array<float,2>{0.664400101f, 0.464417636f},
-std::array<float,2>{0.346390188f, 0.946063101f},
-std::array<float,2>{0.571262658f, 0.861895442f},
-std::array<float,2>{0.478714198f, 0.360053807f},
-std::array<float,2>{0.888788462f, 0.243221506f},
-std::array<float,2>{0.0957182795f, 0.706180394f},
-std::array<float,2>{0.742448449f, 0.668481827f},
-std::array<float,2>{0.26340428f, 0.131077096f},
-std::array<float,2>{0.82201612f, 0.297005534f},
-std::array<float,2>{0.24330309f, 0.781672776f},
-std::array<float,2>{0.953020632f, 0.897306263f},
-std::array<float,2>{0.0564205237f, 0.402201623f},
-std::array<float,2>{0.511777282f, 0.065743722f},
-std::array<float,2>{0.394163847f, 0.581741154f},
-std::array<float,2>{0.930180967f, 0.725790858f},
-std::array<float,2>{0.07060498f, 0.192318872f},
-std::array<float,2>{0.601953208f, 0.325108856f},
-std::array<float,2>{0.468714088f, 0.820816696f},
-std::array<float,2>{0.643271685f, 0.983599663f},
-std::array<float,2>{0.315798104f, 0.495954037f},
-std::array<float,2>{0.755292535f, 0.042461995f},
-std::array<float,2>{0.130606443f, 0.561341584f},
-std::array<float,2>{0.535421431f, 0.621943355f},
-std::array<float,2>{0.423686087f, 0.114080325f},
-std::array<float,2>{0.970462382f, 0.418500811f},
-std::array<float,2>{0.0170534421f, 0.910405397f},
-std::array<float,2>{0.873470008f, 0.753143728f},
-std::array<float,2>{0.215387702f, 0.26076147f},
-std::array<float,2>{0.711637497f, 0.17903249f},
-std::array<float,2>{0.294769406f, 0.635894299f},
-std::array<float,2>{0.993933737f, 0.577492833f},
-std::array<float,2>{0.00414783321f, 0.0842135251f},
-std::array<float,2>{0.551792443f, 0.386311948f},
-std::array<float,2>{0.419300288f, 0.888803184f},
-std::array<float,2>{0.697182059f, 0.805220246f},
-std::array<float,2>{0.306905359f, 0.285011888f},
-std::array<float,2>{0.84752208f, 0.141435638f},
-std::array<float,2>{0.201371357f, 0.682210982f},
-std::array<float,2>{0.614104152f, 0.693932116f},
-std::array<float,2>{0.445468873f, 0.223097369f},
-std::array<float,2>{0.909517288f, 0.357136458f},
-std::array<float,2>{0.0879357457f, 0.856464744f},
-std::array<float,2>{0.774699569f, 0.954401195f},
-std::array<float,2>{0.1532875f, 0.444584519f},
-std::array<float,2>{0.628311515f, 0.0129478117f},
-std::array<float,2>{0.340054393f, 0.502079725f},
-std::array<float,2>{0.842582047f, 0.653577566f},
-std::array<float,2>{0.218926579f, 0.159409627f},
-std::array<float,2>{0.729488015f, 0.279395312f},
-std::array<float,2>{0.265690893f, 0.774300218f},
-std::array<float,2>{0.529943883f, 0.934139729f},
-std::array<float,2>{0.387252301f, 0.434483975f},
-std::array<float,2>{0.963790059f, 0.0960457698f},
-std::array<float,2>{0.0327471942f, 0.602763593f},
-std::array<float,2>{0.677189827f, 0.543654442f},
-std::array<float,2>{0.36029166f, 0.0601711981f},
-std::array<float,2>{0.799224794f, 0.4808065f},
-std::array<float,2>{0.161686227f, 0.991467834f},
-std::array<float,2>{0.90073961f, 0.833573282f},
-std::array<float,2>{0.116776951f, 0.329141855f},
-std::array<float,2>{0.579491019f, 0.218080848f},
-std::array<float,2>{0.492361724f, 0.74178654f},
-std::array<float,2>{0.824911952f, 0.532908082f},
-std::array<float,2>{0.247546017f, 0.0497768633f},
-std::array<float,2>{0.748020232f, 0.474748254f},
-std::array<float,2>{0.260035098f, 0.997395277f},
-std::array<float,2>{0.50902456f, 0.842938364f},
-std::array<float,2>{0.397236377f, 0.336857021f},
-std::array<float,2>{0.949035943f, 0.210831583f},
-std::array<float,2>{0.0604111403f, 0.745718837f},
-std::array<float,2>{0.670013011f, 0.644958496f},
-std::array<float,2>{0.350671351f, 0.168209136f},
-std::array<float,2>{0.781375229f, 0.266277164f},
-std::array<float,2>{0.185580507f, 0.771657467f},
-std::array<float,2>{0.886193633f, 0.922600687f},
-std::array<float,2>{0.101057634f, 0.427056313f},
-std::array<float,2>{0.575856566f, 0.10573817f},
-std::array<float,2>{0.482353956f, 0.594675839f},
-std::array<float,2>{0.975515664f, 0.698045671f},
-std::array<float,2>{0.0212595239f, 0.233999282f},
-std::array<float,2>{0.5322631f, 0.350212574f},
-std::array<float,2>{0.429486305f, 0.848540723f},
-std::array<float,2>{0.715943277f, 0.966180921f},
-std::array<float,2>{0.290978134f, 0.449697286f},
-std::array<float,2>{0.870715201f, 0.00161206524f},
-std::array<float,2>{0.212210461f, 0.514789104f},
-std::array<float,2>{0.607200623f, 0.568706155f},
-std::array<float,2>{0.463387817f, 0.088278316f},
-std::array<float,2>{0.934780955f, 0.376970381f},
-std::array<float,2>{0.0764774904f, 0.877178729f},
-std::array<float,2>{0.752977252f, 0.797282457f},
-std::array<float,2>{0.128004044f, 0.292981595f},
-std::array<float,2>{0.648061156f, 0.155292779f},
-std::array<float,2>{0.31872502f, 0.672145069f},
-std::array<float,2>{0.912905037f, 0.612483442f},
-std::array<float,2>{0.0915370956f, 0.124834307f},
-std::array<float,2>{0.610431373f, 0.410693705f},
-std::array<float,2>{0.449813277f, 0.91469419f},
-std::array<float,2>{0.629514217f, 0.758034289f},
-std::array<float,2>{0.337071121f, 0.251234174f},
-std::array<float,2>{0.778422892f, 0.182348192f},
-std::array<float,2>{0.149244562f, 0.625374973f},
-std::array<float,2>{0.547933757f, 0.730447471f},
-std::array<float,2>{0.415667593f, 0.199093357f},
-std::array<float,2>{0.997106016f, 0.320158869f},
-std::array<float,2>{0.00323037733f, 0.817312479f},
-std::array<float,2>{0.850449562f, 0.975242317f},
-std::array<float,2>{0.195639998f, 0.484916538f},
-std::array<float,2>{0.701497078f, 0.0335849337f},
-std::array<float,2>{0.308702737f, 0.5478701f},
-std::array<float,2>{0.80204922f, 0.662217975f},
-std::array<float,2>{0.158888832f, 0.138467714f},
-std::array<float,2>{0.675569534f, 0.310857087f},
-std::array<float,2>{0.365796596f, 0.794920325f},
-std::array<float,2>{0.585302293f, 0.906175673f},
-std::array<float,2>{0.496843368f, 0.391570628f},
-std::array<float,2>{0.905435145f, 0.0761330873f},
-std::array<float,2>{0.110727325f, 0.587787747f},
-std::array<float,2>{0.731538057f, 0.526942611f},
-std::array<float,2>{0.273432255f, 0.0234287418f},
-std::array<float,2>{0.838396609f, 0.454712093f},
-std::array<float,2>{0.225613862f, 0.943430066f},
-std::array<float,2>{0.96697098f, 0.871402502f},
-std::array<float,2>{0.0352121219f, 0.373792112f},
-std::array<float,2>{0.523880541f, 0.235103711f},
-std::array<float,2>{0.384109437f, 0.714067459f},
-std::array<float,2>{0.770494819f, 0.583418369f},
-std::array<float,2>{0.145684779f, 0.0682648569f},
-std::array<float,2>{0.634548068f, 0.403112739f},
-std::array<float,2>{0.334685385f, 0.891073763f},
-std::array<float,2>{0.622150421f, 0.786225736f},
-std::array<float,2>{0.43919602f, 0.304317147f},
-std::array<float,2>{0.91748035f, 0.128364384f},
-std::array<float,2>{0.0803141817f, 0.664867401f},
-std::array<float,2>{0.693622887f, 0.708057106f},
-std::array<float,2>{0.300763428f, 0.249529839f},
-std::array<float,2>{0.855927587f, 0.365616024f},
-std::array<float,2>{0.195293605f, 0.866652727f},
-std::array<float,2>{0.991331995f, 0.952400565f},
-std::array<float,2>{0.0131724682f, 0.465420902f},
-std::array<float,2>{0.561415136f, 0.0305690803f},
-std::array<float,2>{0.41265893f, 0.515633106f},
-std::array<float,2>{0.894707382f, 0.638862312f},
-std::array<float,2>{0.124183185f, 0.174356848f},
-std::array<float,2>{0.593109667f, 0.263364285f},
-std::array<float,2>{0.490647316f, 0.755952716f},
-std::array<float,2>{0.684623539f, 0.909654379f},
-std::array<float,2>{0.372891188f, 0.416635036f},
-std::array<float,2>{0.809815943f, 0.112051621f},
-std::array<float,2>{0.171512872f, 0.620022893f},
-std::array<float,2>{0.519805372f, 0.557555556f},
-std::array<float,2>{0.377800584f, 0.0447456129f},
-std::array<float,2>{0.95560056f, 0.497565925f},
-std::array<float,2>{0.0402293578f, 0.978977501f},
-std::array<float,2>{0.829513907f, 0.824848115f},
-std::array<float,2>{0.228088021f, 0.323548943f},
-std::array<float,2>{0.72442466f, 0.189527422f},
-std::array<float,2>{0.275889069f, 0.72075969f},
-std::array<float,2>{0.941039324f, 0.504876792f},
-std::array<float,2>{0.0499550253f, 0.00963099487f},
-std::array<float,2>{0.506185651f, 0.440394968f},
-std::array<float,2>{0.402733356f, 0.959142864f},
-std::array<float,2>{0.735551238f, 0.854297638f},
-std::array<float,2>{0.254965127f, 0.35336715f},
-std::array<float,2>{0.812533081f, 0.218982249f},
-std::array<float,2>{0.240757674f, 0.688102186f},
-std::array<float,2>{0.570031643f, 0.687133133f},
-std::array<float,2>{0.469463497f, 0.147605151f},
-std::array<float,2>{0.882666647f, 0.287354112f},
-std::array<float,2>{0.103817806f, 0.809750795f},
-std::array<float,2>{0.79163301f, 0.884950757f},
-std::array<float,2>{0.174510315f, 0.389461935f},
-std::array<float,2>{0.662999034f, 0.081787914f},
-std::array<float,2>{0.358891338f, 0.573461711f},
-std::array<float,2>{0.863036752f, 0.735385597f},
-std::array<float,2>{0.203137025f, 0.211782038f},
-std::array<float,2>{0.707544804f, 0.332983524f},
-std::array<float,2>{0.286534876f, 0.83071363f},
-std::array<float,2>{0.543235183f, 0.9857288f},
-std::array<float,2>{0.430586129f, 0.47820875f},
-std::array<float,2>{0.98051101f, 0.0574841164f},
-std::array<float,2>{0.02484864f, 0.540306807f},
-std::array<float,2>{0.64998138f, 0.606450319f},
-std::array<float,2>{0.325192273f, 0.100772254f},
-std::array<float,2>{0.765262723f, 0.431721032f},
-std::array<float,2>{0.133682191f, 0.932906985f},
-std::array<float,2>{0.927672148f, 0.778195381f},
-std::array<float,2>{0.0664462894f, 0.276355475f},
-std::array<float,2>{0.598642647f, 0.16120033f},
-std::array<float,2>{0.454901159f, 0.649584055f},
-std::array<float,2>{0.864628971f, 0.593083143f},
-std::array<float,2>{0.208867028f, 0.0723120347f},
-std::array<float,2>{0.703845978f, 0.397323191f},
-std::array<float,2>{0.282078654f, 0.899210334f},
-std::array<float,2>{0.542815328f, 0.790585756f},
-std::array<float,2>{0.436265528f, 0.307907343f},
-std::array<float,2>{0.976806104f, 0.135894567f},
-std::array<float,2>{0.0288975816f, 0.659539402f},
-std::array<float,2>{0.654274344f, 0.717591465f},
-std::array<float,2>{0.32293123f, 0.239839271f},
-std::array<float,2>{0.758041918f, 0.368362784f},
-std::array<float,2>{0.139227495f, 0.869777501f},
-std::array<float,2>{0.924854338f, 0.939418077f},
-std::array<float,2>{0.0645937547f, 0.457633615f},
-std::array<float,2>{0.594674826f, 0.0169057287f},
-std::array<float,2>{0.460178673f, 0.530692935f},
-std::array<float,2>{0.943161249f, 0.630890608f},
-std::array<float,2>{0.0515475646f, 0.184051231f},
-std::array<float,2>{0.50352937f, 0.256975263f},
-std::array<float,2>{0.402279109f, 0.763795376f},
-std::array<float,2>{0.742187202f, 0.92130208f},
-std::array<float,2>{0.250701308f, 0.408577114f},
-std::array<float,2>{0.818850398f, 0.120447308f},
-std::array<float,2>{0.235045314f, 0.613859713f},
-std::array<float,2>{0.56588769f, 0.551179886f},
-std::array<float,2>{0.474970758f, 0.0382230394f},
-std::array<float,2>{0.878472149f, 0.490188718f},
-std::array<float,2>{0.108324997f, 0.970201969f},
-std::array<float,2>{0.794553995f, 0.816234052f},
-std::array<float,2>{0.178979218f, 0.314582795f},
-std::array<float,2>{0.656981707f, 0.203056335f},
-std::array<float,2>{0.354329735f, 0.733748317f},
-std::array<float,2>{0.893725872f, 0.508485079f},
-std::array<float,2>{0.119268924f, 0.00396130607f},
-std::array<float,2>{0.588327885f, 0.445858359f},
-std::array<float,2>{0.48796016f, 0.961446464f},
-std::array<float,2>{0.682537377f, 0.847440183f},
-std::array<float,2>{0.369937062f, 0.344903439f},
-std::array<float,2>{0.805439174f, 0.229500622f},
-std::array<float,2>{0.165350392f, 0.700350821f},
-std::array<float,2>{0.517373264f, 0.676143348f},
-std::array<float,2>{0.380481988f, 0.148788646f},
-std::array<float,2>{0.960720181f, 0.292650789f},
-std::array<float,2>{0.0437665023f, 0.803330481f},
-std::array<float,2>{0.834884763f, 0.88240999f},
-std::array<float,2>{0.232226714f, 0.380791038f},
-std::array<float,2>{0.72194612f, 0.0921079665f},
-std::array<float,2>{0.281227291f, 0.562551618f},
-std::array<float,2>{0.767561316f, 0.749403834f},
-std::array<float,2>{0.141971231f, 0.203149632f},
-std::array<float,2>{0.640094578f, 0.342202306f},
-std::array<float,2>{0.329783738f, 0.839330375f},
-std::array<float,2>{0.618945181f, 0.993487716f},
-std::array<float,2>{0.445015699f, 0.46988672f},
-std::array<float,2>{0.918218434f, 0.0544758402f},
-std::array<float,2>{0.0850859582f, 0.537100077f},
-std::array<float,2>{0.691354394f, 0.600803375f},
-std::array<float,2>{0.301387399f, 0.103369549f},
-std::array<float,2>{0.8527385f, 0.425191998f},
-std::array<float,2>{0.188516691f, 0.927132308f},
-std::array<float,2>{0.984730303f, 0.76855284f},
-std::array<float,2>{0.00862665568f, 0.270963311f},
-std::array<float,2>{0.554836571f, 0.165327981f},
-std::array<float,2>{0.40975064f, 0.643006086f},
-std::array<float,2>{0.800612509f, 0.546373785f},
-std::array<float,2>{0.16100587f, 0.0610350184f},
-std::array<float,2>{0.676688492f, 0.483774304f},
-std::array<float,2>{0.360570818f, 0.989980876f},
-std::array<float,2>{0.578839481f, 0.83442384f},
-std::array<float,2>{0.494091302f, 0.330470681f},
-std::array<float,2>{0.901698053f, 0.216703102f},
-std::array<float,2>{0.115243495f, 0.73991853f},
-std::array<float,2>{0.72982651f, 0.656213522f},
-std::array<float,2>{0.266789615f, 0.156375706f},
-std::array<float,2>{0.843301773f, 0.278851897f},
-std::array<float,2>{0.220180735f, 0.77549696f},
-std::array<float,2>{0.964398503f, 0.936362386f},
-std::array<float,2>{0.0316639431f, 0.436423898f},
-std::array<float,2>{0.530709445f, 0.0940223113f},
-std::array<float,2>{0.387710094f, 0.603653908f},
-std::array<float,2>{0.908360481f, 0.691649199f},
-std::array<float,2>{0.0889255255f, 0.225694403f},
-std::array<float,2>{0.61487627f, 0.357460588f},
-std::array<float,2>{0.446738362f, 0.859270036f},
-std::array<float,2>{0.627392292f, 0.955475688f},
-std::array<float,2>{0.341247797f, 0.442680597f},
-std::array<float,2>{0.774401188f, 0.0144275483f},
-std::array<float,2>{0.154217348f, 0.500576019f},
-std::array<float,2>{0.550876379f, 0.575456023f},
-std::array<float,2>{0.418153435f, 0.0839668736f},
-std::array<float,2>{0.992203593f, 0.383354306f},
-std::array<float,2>{0.00518604508f, 0.88782984f},
-std::array<float,2>{0.846177816f, 0.80731374f},
-std::array<float,2>{0.203028947f, 0.282828093f},
-std::array<float,2>{0.696173906f, 0.142611027f},
-std::array<float,2>{0.307998031f, 0.679947078f},
-std::array<float,2>{0.969329119f, 0.623463809f},
-std::array<float,2>{0.0159151778f, 0.115858026f},
-std::array<float,2>{0.536708057f, 0.421716928f},
-std::array<float,2>{0.422310203f, 0.913504839f},
-std::array<float,2>{0.712020576f, 0.750849545f},
-std::array<float,2>{0.293862641f, 0.259355098f},
-std::array<float,2>{0.874357522f, 0.177696317f},
-std::array<float,2>{0.216733828f, 0.633749068f},
-std::array<float,2>{0.602660298f, 0.723199069f},
-std::array<float,2>{0.467481464f, 0.195181534f},
-std::array<float,2>{0.931238472f, 0.326292068f},
-std::array<float,2>{0.0713695586f, 0.822411358f},
-std::array<float,2>{0.753959537f, 0.981865644f},
-std::array<float,2>{0.129502684f, 0.493875623f},
-std::array<float,2>{0.644044578f, 0.0398356728f},
-std::array<float,2>{0.315016747f, 0.560415387f},
-std::array<float,2>{0.821139216f, 0.671454072f},
-std::array<float,2>{0.242542714f, 0.129147187f},
-std::array<float,2>{0.743904948f, 0.299884945f},
-std::array<float,2>{0.262327582f, 0.783402145f},
-std::array<float,2>{0.513182163f, 0.895216346f},
-std::array<float,2>{0.393522203f, 0.399050891f},
-std::array<float,2>{0.951475501f, 0.0631032288f},
-std::array<float,2>{0.0554564297f, 0.579658449f},
-std::array<float,2>{0.66567421f, 0.521766067f},
-std::array<float,2>{0.347095966f, 0.0258333795f},
-std::array<float,2>{0.785772622f, 0.462844104f},
-std::array<float,2>{0.18328768f, 0.947313726f},
-std::array<float,2>{0.890353739f, 0.86052084f},
-std::array<float,2>{0.0974788368f, 0.361505598f},
-std::array<float,2>{0.571363688f, 0.245272607f},
-std::array<float,2>{0.480136365f, 0.704471767f},
-std::array<float,2>{0.839309156f, 0.524740815f},
-std::array<float,2>{0.224699616f, 0.0214404911f},
-std::array<float,2>{0.73141849f, 0.456798673f},
-std::array<float,2>{0.272227675f, 0.943346977f},
-std::array<float,2>{0.525004327f, 0.874613583f},
-std::array<float,2>{0.382936925f, 0.372054458f},
-std::array<float,2>{0.968020797f, 0.23804526f},
-std::array<float,2>{0.0369358473f, 0.712589085f},
-std::array<float,2>{0.673882186f, 0.661863565f},
-std::array<float,2>{0.366858542f, 0.139567137f},
-std::array<float,2>{0.801595867f, 0.309210271f},
-std::array<float,2>{0.159261927f, 0.796114326f},
-std::array<float,2>{0.905162454f, 0.903819442f},
-std::array<float,2>{0.109605655f, 0.39339149f},
-std::array<float,2>{0.584185183f, 0.0777883083f},
-std::array<float,2>{0.497529596f, 0.588834286f},
-std::array<float,2>{0.996501684f, 0.727483213f},
-std::array<float,2>{0.00206658477f, 0.195458874f},
-std::array<float,2>{0.547411978f, 0.316638649f},
-std::array<float,2>{0.414935142f, 0.819162965f},
-std::array<float,2>{0.702982962f, 0.97435379f},
-std::array<float,2>{0.310309649f, 0.486702472f},
-std::array<float,2>{0.851112306f, 0.0312801376f},
-std::array<float,2>{0.196455806f, 0.549630761f},
-std::array<float,2>{0.610073328f, 0.609432042f},
-std::array<float,2>{0.450913489f, 0.122233763f},
-std::array<float,2>{0.913954675f, 0.413020849f},
-std::array<float,2>{0.0902656168f, 0.917708218f},
-std::array<float,2>{0.778073192f, 0.760044694f},
-std::array<float,2>{0.149744228f, 0.253679723f},
-std::array<float,2>{0.629905641f, 0.179761142f},
-std::array<float,2>{0.336187661f, 0.628313243f},
-std::array<float,2>{0.933756769f, 0.567330718f},
-std::array<float,2>{0.0774661526f, 0.0865717828f},
-std::array<float,2>{0.606242359f, 0.376731873f},
-std::array<float,2>{0.464154452f, 0.876495123f},
-std::array<float,2>{0.646890283f, 0.800450861f},
-std::array<float,2>{0.31968388f, 0.295861751f},
-std::array<float,2>{0.752393067f, 0.153899267f},
-std::array<float,2>{0.127643391f, 0.675593138f},
-std::array<float,2>{0.531628668f, 0.697202265f},
-std::array<float,2>{0.42782411f, 0.231763467f},
-std::array<float,2>{0.976066232f, 0.349085301f},
-std::array<float,2>{0.0195679441f, 0.850309134f},
-std::array<float,2>{0.870089829f, 0.966932833f},
-std::array<float,2>{0.211078435f, 0.451482832f},
-std::array<float,2>{0.715092838f, 0.00273915147f},
-std::array<float,2>{0.28923589f, 0.513371348f},
-std::array<float,2>{0.782977879f, 0.646686852f},
-std::array<float,2>{0.187478364f, 0.171420485f},
-std::array<float,2>{0.671561658f, 0.269250482f},
-std::array<float,2>{0.349727005f, 0.769790471f},
-std::array<float,2>{0.574353039f, 0.924265087f},
-std::array<float,2>{0.480587035f, 0.428134918f},
-std::array<float,2>{0.884931028f, 0.108443677f},
-std::array<float,2>{0.099753961f, 0.595876634f},
-std::array<float,2>{0.746703386f, 0.534157157f},
-std::array<float,2>{0.261366725f, 0.0476610735f},
-std::array<float,2>{0.825337589f, 0.473041326f},
-std::array<float,2>{0.24694632f, 0.998798311f},
-std::array<float,2>{0.947351754f, 0.841682911f},
-std::array<float,2>{0.0592246391f, 0.339639038f},
-std::array<float,2>{0.508136034f, 0.207798034f},
-std::array<float,2>{0.398413628f, 0.74387604f},
-std::array<float,2>{0.764235556f, 0.607585251f},
-std::array<float,2>{0.134197876f, 0.0985984877f},
-std::array<float,2>{0.648487031f, 0.430285454f},
-std::array<float,2>{0.325950652f, 0.930742741f},
-std::array<float,2>{0.598233938f, 0.779999435f},
-std::array<float,2>{0.453666776f, 0.273613006f},
-std::array<float,2>{0.926464796f, 0.163484588f},
-std::array<float,2>{0.0676041022f, 0.652280152f},
-std::array<float,2>{0.708151042f, 0.736411452f},
-std::array<float,2>{0.285258323f, 0.21385406f},
-std::array<float,2>{0.861412168f, 0.334029585f},
-std::array<float,2>{0.204184905f, 0.829307258f},
-std::array<float,2>{0.981639266f, 0.987029254f},
-std::array<float,2>{0.023481898f, 0.47998777f},
-std::array<float,2>{0.54459244f, 0.0547061861f},
-std::array<float,2>{0.431244731f, 0.541927338f},
-std::array<float,2>{0.881555974f, 0.68526113f},
-std::array<float,2>{0.105159178f, 0.145284757f},
-std::array<float,2>{0.568996847f, 0.28563711f},
-std::array<float,2>{0.469828546f, 0.812225342f},
-std::array<float,2>{0.663452923f, 0.883329153f},
-std::array<float,2>{0.358206302f, 0.38858673f},
-std::array<float,2>{0.792171955f, 0.0787610337f},
-std::array<float,2>{0.175223768f, 0.571184993f},
-std::array<float,2>{0.507693946f, 0.507084012f},
-std::array<float,2>{0.403728932f, 0.0106706554f},
-std::array<float,2>{0.93962574f, 0.439301163f},
-std::array<float,2>{0.0491950735f, 0.958889782f},
-std::array<float,2>{0.813498318f, 0.852030456f},
-std::array<float,2>{0.241813853f, 0.354656875f},
-std::array<float,2>{0.734556019f, 0.221902594f},
-std::array<float,2>{0.254445314f, 0.690180719f},
-std::array<float,2>{0.956104875f, 0.556634128f},
-std::array<float,2>{0.0392983072f, 0.0467929803f},
-std::array<float,2>{0.52090472f, 0.498732537f},
-std::array<float,2>{0.378431052f, 0.978329599f},
-std::array<float,2>{0.723070741f, 0.827012658f},
-std::array<float,2>{0.277225494f, 0.32178238f},
-std::array<float,2>{0.828140438f, 0.188394174f},
-std::array<float,2>{0.227171987f, 0.720179975f},
-std::array<float,2>{0.592379808f, 0.637304604f},
-std::array<float,2>{0.492101938f, 0.173099443f},
-std::array<float,2>{0.896008193f, 0.264876753f},
-std::array<float,2>{0.123600945f, 0.754417539f},
-std::array<float,2>{0.809297025f, 0.906743646f},
-std::array<float,2>{0.170594916f, 0.41514352f},
-std::array<float,2>{0.684070766f, 0.111210056f},
-std::array<float,2>{0.371761799f, 0.617955029f},
-std::array<float,2>{0.857177258f, 0.709335029f},
-std::array<float,2>{0.194087461f, 0.246429265f},
-std::array<float,2>{0.694910347f, 0.363344491f},
-std::array<float,2>{0.299237192f, 0.865157664f},
-std::array<float,2>{0.56213212f, 0.951084077f},
-std::array<float,2>{0.413467199f, 0.46850583f},
-std::array<float,2>{0.99060756f, 0.0280544087f},
-std::array<float,2>{0.0121040568f, 0.518526375f},
-std::array<float,2>{0.633008063f, 0.584261417f},
-std::array<float,2>{0.335354835f, 0.0688541532f},
-std::array<float,2>{0.771052539f, 0.405023575f},
-std::array<float,2>{0.145235345f, 0.892667472f},
-std::array<float,2>{0.916951716f, 0.78877604f},
-std::array<float,2>{0.0818940029f, 0.30263707f},
-std::array<float,2>{0.622049868f, 0.126922235f},
-std::array<float,2>{0.43771255f, 0.667149723f},
-std::array<float,2>{0.817231417f, 0.615241885f},
-std::array<float,2>{0.23768796f, 0.118166909f},
-std::array<float,2>{0.739062488f, 0.40663299f},
-std::array<float,2>{0.253450662f, 0.919239283f},
-std::array<float,2>{0.500341356f, 0.762052953f},
-std::array<float,2>{0.400026053f, 0.255130887f},
-std::array<float,2>{0.944810033f, 0.18622601f},
-std::array<float,2>{0.0530198812f, 0.629786551f},
-std::array<float,2>{0.658768773f, 0.731000543f},
-std::array<float,2>{0.351809323f, 0.200954378f},
-std::array<float,2>{0.796403885f, 0.312948555f},
-std::array<float,2>{0.177471206f, 0.81431073f},
-std::array<float,2>{0.876116812f, 0.971623182f},
-std::array<float,2>{0.105844967f, 0.490344822f},
-std::array<float,2>{0.563656628f, 0.0370296687f},
-std::array<float,2>{0.47336024f, 0.5529778f},
-std::array<float,2>{0.980015159f, 0.65733546f},
-std::array<float,2>{0.0309410673f, 0.134231195f},
-std::array<float,2>{0.540899158f, 0.305307597f},
-std::array<float,2>{0.434862882f, 0.792808414f},
-std::array<float,2>{0.705855072f, 0.90226078f},
-std::array<float,2>{0.284811974f, 0.395532757f},
-std::array<float,2>{0.865956247f, 0.0703409612f},
-std::array<float,2>{0.210396215f, 0.591744184f},
-std::array<float,2>{0.59652108f, 0.527408063f},
-std::array<float,2>{0.458406478f, 0.0188564342f},
-std::array<float,2>{0.922239184f, 0.460683942f},
-std::array<float,2>{0.0633374378f, 0.940839589f},
-std::array<float,2>{0.760363162f, 0.868570864f},
-std::array<float,2>{0.137587667f, 0.369850844f},
-std::array<float,2>{0.655368686f, 0.240580395f},
-std::array<float,2>{0.32093817f, 0.716224909f},
-std::array<float,2>{0.920581162f, 0.537484229f},
-std::array<float,2>{0.0821513683f, 0.0524015464f},
-std::array<float,2>{0.620648742f, 0.47103864f},
-std::array<float,2>{0.441979438f, 0.995242059f},
-std::array<float,2>{0.637883782f, 0.837238014f},
-std::array<float,2>{0.330446064f, 0.341630578f},
-std::array<float,2>{0.768728912f, 0.20563069f},
-std::array<float,2>{0.142841548f, 0.747235596f},
-std::array<float,2>{0.557438254f, 0.641920269f},
-std::array<float,2>{0.406716108f, 0.166150331f},
-std::array<float,2>{0.986405253f, 0.273167461f},
-std::array<float,2>{0.0104163345f, 0.766087651f},
-std::array<float,2>{0.854320049f, 0.928451717f},
-std::array<float,2>{0.189459458f, 0.42214486f},
-std::array<float,2>{0.68924284f, 0.104845047f},
-std::array<float,2>{0.304613084f, 0.599062681f},
-std::array<float,2>{0.808280766f, 0.702493489f},
-std::array<float,2>{0.166593328f, 0.227058217f},
-std::array<float,2>{0.681339383f, 0.346889377f},
-std::array<float,2>{0.36900264f, 0.844696701f},
-std::array<float,2>{0.586527824f, 0.963858306f},
-std::array<float,2>{0.485565573f, 0.449132413f},
-std::array<float,2>{0.891891539f, 0.00758976303f},
-std::array<float,2>{0.118863612f, 0.510516882f},
-std::array<float,2>{0.720552146f, 0.564793766f},
-std::array<float,2>{0.27874884f, 0.089853324f},
-std::array<float,2>{0.833080471f, 0.381256074f},
-std::array<float,2>{0.232673183f, 0.879293501f},
-std::array<float,2>{0.958021402f, 0.800948679f},
-std::array<float,2>{0.0464657061f, 0.289470583f},
-std::array<float,2>{0.518642306f, 0.151852205f},
-std::array<float,2>{0.381834537f, 0.679003894f},
-std::array<float,2>{0.77684778f, 0.503118336f},
-std::array<float,2>{0.155927777f, 0.0119007621f},
-std::array<float,2>{0.626426518f, 0.443973064f},
-std::array<float,2>{0.341942608f, 0.953717649f},
-std::array<float,2>{0.616710663f, 0.856096029f},
-std::array<float,2>{0.44849965f, 0.355539322f},
-std::array<float,2>{0.906714976f, 0.224361777f},
-std::array<float,2>{0.0866503194f, 0.695183933f},
-std::array<float,2>{0.697896421f, 0.683534384f},
-std::array<float,2>{0.305030406f, 0.142268315f},
-std::array<float,2>{0.845661461f, 0.283488929f},
-std::array<float,2>{0.199490279f, 0.80569613f},
-std::array<float,2>{0.996048152f, 0.890336931f},
-std::array<float,2>{0.00774351694f, 0.385591328f},
-std::array<float,2>{0.552743614f, 0.0853156149f},
-std::array<float,2>{0.420877278f, 0.576249897f},
-std::array<float,2>{0.899686873f, 0.740487337f},
-std::array<float,2>{0.113562755f, 0.217106372f},
-std::array<float,2>{0.581552923f, 0.32849133f},
-std::array<float,2>{0.495409459f, 0.832144141f},
-std::array<float,2>{0.679384589f, 0.990558445f},
-std::array<float,2>{0.362818033f, 0.482267052f},
-std::array<float,2>{0.798304439f, 0.0587063096f},
-std::array<float,2>{0.16283147f, 0.54452467f},
-std::array<float,2>{0.527461588f, 0.60220331f},
-std::array<float,2>{0.389574438f, 0.0972622707f},
-std::array<float,2>{0.961635649f, 0.435378224f},
-std::array<float,2>{0.0348925032f, 0.935500979f},
-std::array<float,2>{0.841072381f, 0.775186479f},
-std::array<float,2>{0.222190201f, 0.280473173f},
-std::array<float,2>{0.726694167f, 0.158403814f},
-std::array<float,2>{0.269123077f, 0.652644873f},
-std::array<float,2>{0.950496137f, 0.580540538f},
-std::array<float,2>{0.0570983104f, 0.0650636628f},
-std::array<float,2>{0.515571833f, 0.401188016f},
-std::array<float,2>{0.391064554f, 0.898369193f},
-std::array<float,2>{0.744892895f, 0.782954991f},
-std::array<float,2>{0.263961673f, 0.298749059f},
-std::array<float,2>{0.822720647f, 0.132388413f},
-std::array<float,2>{0.24524352f, 0.669670463f},
-std::array<float,2>{0.572625935f, 0.705157161f},
-std::array<float,2>{0.477473289f, 0.24229078f},
-std::array<float,2>{0.888533711f, 0.361195505f},
-std::array<float,2>{0.094488889f, 0.863251388f},
-std::array<float,2>{0.787388146f, 0.94685173f},
-std::array<float,2>{0.179872885f, 0.463726759f},
-std::array<float,2>{0.667634726f, 0.0241392199f},
-std::array<float,2>{0.344071925f, 0.521238804f},
-std::array<float,2>{0.872205853f, 0.634917796f},
-std::array<float,2>{0.218092039f, 0.178052396f},
-std::array<float,2>{0.714223742f, 0.260187f},
-std::array<float,2>{0.295311034f, 0.752740741f},
-std::array<float,2>{0.537988901f, 0.911990225f},
-std::array<float,2>{0.424391389f, 0.419702291f},
-std::array<float,2>{0.972484589f, 0.114564277f},
-std::array<float,2>{0.0183926038f, 0.622455239f},
-std::array<float,2>{0.642513216f, 0.562056184f},
-std::array<float,2>{0.312710464f, 0.0410337709f},
-std::array<float,2>{0.756401837f, 0.495072961f},
-std::array<float,2>{0.131711811f, 0.982858896f},
-std::array<float,2>{0.932130277f, 0.822064161f},
-std::array<float,2>{0.0728559792f, 0.325376987f},
-std::array<float,2>{0.604294121f, 0.193119392f},
-std::array<float,2>{0.46607545f, 0.725491345f},
-std::array<float,2>{0.849307716f, 0.547442317f},
-std::array<float,2>{0.197287604f, 0.0344524868f},
-std::array<float,2>{0.700532258f, 0.485369921f},
-std::array<float,2>{0.312329799f, 0.975814581f},
-std::array<float,2>{0.549705744f, 0.817803681f},
-std::array<float,2>{0.416222543f, 0.318934709f},
-std::array<float,2>{0.998650312f, 0.197845459f},
-std::array<float,2>{0.000841028756f, 0.729273558f},
-std::array<float,2>{0.631047368f, 0.626741469f},
-std::array<float,2>{0.338298321f, 0.183473498f},
-std::array<float,2>{0.779771745f, 0.250138521f},
-std::array<float,2>{0.150861427f, 0.759103179f},
-std::array<float,2>{0.911476314f, 0.915690958f},
-std::array<float,2>{0.0920384079f, 0.411893994f},
-std::array<float,2>{0.611960113f, 0.123580918f},
-std::array<float,2>{0.452637345f, 0.61190474f},
-std::array<float,2>{0.966759324f, 0.71300143f},
-std::array<float,2>{0.038988702f, 0.236004934f},
-std::array<float,2>{0.525719106f, 0.37488085f},
-std::array<float,2>{0.385585308f, 0.872453034f},
-std::array<float,2>{0.734170377f, 0.944961727f},
-std::array<float,2>{0.269991338f, 0.453161538f},
-std::array<float,2>{0.837370038f, 0.0220552385f},
-std::array<float,2>{0.22444585f, 0.525597394f},
-std::array<float,2>{0.583726287f, 0.586525619f},
-std::array<float,2>{0.499534756f, 0.07480786f},
-std::array<float,2>{0.902454913f, 0.391710758f},
-std::array<float,2>{0.111385152f, 0.904948413f},
-std::array<float,2>{0.803576708f, 0.793424964f},
-std::array<float,2>{0.157533914f, 0.312407583f},
-std::array<float,2>{0.67339915f, 0.136918306f},
-std::array<float,2>{0.363428265f, 0.663261652f},
-std::array<float,2>{0.88305527f, 0.595197022f},
-std::array<float,2>{0.0990479216f, 0.106861793f},
-std::array<float,2>{0.576237202f, 0.425875783f},
-std::array<float,2>{0.483933121f, 0.923438251f},
-std::array<float,2>{0.669506431f, 0.773354471f},
-std::array<float,2>{0.348998338f, 0.266987383f},
-std::array<float,2>{0.783661008f, 0.169024035f},
-std::array<float,2>{0.185120553f, 0.646165788f},
-std::array<float,2>{0.510075867f, 0.744921982f},
-std::array<float,2>{0.395376742f, 0.209068224f},
-std::array<float,2>{0.946083844f, 0.337038666f},
-std::array<float,2>{0.0607487671f, 0.842368066f},
-std::array<float,2>{0.827577651f, 0.996818542f},
-std::array<float,2>{0.248567939f, 0.475987077f},
-std::array<float,2>{0.748677135f, 0.0498780385f},
-std::array<float,2>{0.25967896f, 0.531410694f},
-std::array<float,2>{0.750636518f, 0.673492908f},
-std::array<float,2>{0.126218751f, 0.155096054f},
-std::array<float,2>{0.644762218f, 0.29445821f},
-std::array<float,2>{0.316570133f, 0.798019826f},
-std::array<float,2>{0.607652247f, 0.878737926f},
-std::array<float,2>{0.462424576f, 0.378676653f},
-std::array<float,2>{0.935590208f, 0.089363195f},
-std::array<float,2>{0.075599201f, 0.569414616f},
-std::array<float,2>{0.717704058f, 0.514441073f},
-std::array<float,2>{0.292759597f, 0.000670989102f},
-std::array<float,2>{0.867536306f, 0.451043814f},
-std::array<float,2>{0.21316728f, 0.965490758f},
-std::array<float,2>{0.973788321f, 0.849232733f},
-std::array<float,2>{0.021806255f, 0.351033598f},
-std::array<float,2>{0.534319997f, 0.233273551f},
-std::array<float,2>{0.426223963f, 0.698336303f},
-std::array<float,2>{0.790805161f, 0.572477221f},
-std::array<float,2>{0.17308265f, 0.0801067501f},
-std::array<float,2>{0.661852658f, 0.390473843f},
-std::array<float,2>{0.357270062f, 0.885841727f},
-std::array<float,2>{0.56664896f, 0.808979571f},
-std::array<float,2>{0.471056461f, 0.288636088f},
-std::array<float,2>{0.878925264f, 0.146974042f},
-std::array<float,2>{0.102282219f, 0.686398625f},
-std::array<float,2>{0.737606287f, 0.689279616f},
-std::array<float,2>{0.256420225f, 0.220330015f},
-std::array<float,2>{0.814809322f, 0.351722509f},
-std::array<float,2>{0.239314213f, 0.855159104f},
-std::array<float,2>{0.93768084f, 0.959972501f},
-std::array<float,2>{0.0483312793f, 0.440814316f},
-std::array<float,2>{0.504253507f, 0.00792084727f},
-std::array<float,2>{0.406165689f, 0.504910588f},
-std::array<float,2>{0.928735912f, 0.649291277f},
-std::array<float,2>{0.0695731863f, 0.160362944f},
-std::array<float,2>{0.600206673f, 0.276872396f},
-std::array<float,2>{0.456882715f, 0.77921313f},
-std::array<float,2>{0.651011288f, 0.931712925f},
-std::array<float,2>{0.327816635f, 0.433236092f},
-std::array<float,2>{0.763521791f, 0.100209177f},
-std::array<float,2>{0.134821087f, 0.605893433f},
-std::array<float,2>{0.54657644f, 0.539722025f},
-std::array<float,2>{0.433208376f, 0.0582982153f},
-std::array<float,2>{0.984253645f, 0.477534115f},
-std::array<float,2>{0.0273079965f, 0.984608233f},
-std::array<float,2>{0.861106694f, 0.831844985f},
-std::array<float,2>{0.205505788f, 0.333920866f},
-std::array<float,2>{0.710778594f, 0.212229773f},
-std::array<float,2>{0.288516134f, 0.735232949f},
-std::array<float,2>{0.988475561f, 0.516978562f},
-std::array<float,2>{0.0138901342f, 0.029513726f},
-std::array<float,2>{0.559402525f, 0.466324836f},
-std::array<float,2>{0.411605805f, 0.951711595f},
-std::array<float,2>{0.691458702f, 0.86541748f},
-std::array<float,2>{0.297219574f, 0.366922855f},
-std::array<float,2>{0.857963443f, 0.24834241f},
-std::array<float,2>{0.192727223f, 0.707372487f},
-std::array<float,2>{0.624622166f, 0.665201068f},
-std::array<float,2>{0.441364408f, 0.127701238f},
-std::array<float,2>{0.915594637f, 0.303386062f},
-std::array<float,2>{0.0782756582f, 0.785718441f},
-std::array<float,2>{0.773131013f, 0.892367661f},
-std::array<float,2>{0.146863073f, 0.404138207f},
-std::array<float,2>{0.635840118f, 0.0666192994f},
-std::array<float,2>{0.333938956f, 0.582579553f},
-std::array<float,2>{0.831981361f, 0.721973121f},
-std::array<float,2>{0.230214179f, 0.19092603f},
-std::array<float,2>{0.725785136f, 0.322471261f},
-std::array<float,2>{0.274764746f, 0.82613641f},
-std::array<float,2>{0.521583319f, 0.979508996f},
-std::array<float,2>{0.375954479f, 0.496822238f},
-std::array<float,2>{0.953877032f, 0.043064218f},
-std::array<float,2>{0.0419546403f, 0.557802618f},
-std::array<float,2>{0.685845673f, 0.620840609f},
-std::array<float,2>{0.37321198f, 0.112344705f},
-std::array<float,2>{0.812042117f, 0.417830616f},
-std::array<float,2>{0.168708995f, 0.909146547f},
-std::array<float,2>{0.897125423f, 0.756861091f},
-std::array<float,2>{0.122284025f, 0.261927992f},
-std::array<float,2>{0.590033829f, 0.174925402f},
-std::array<float,2>{0.48878926f, 0.640271306f},
-std::array<float,2>{0.822776973f, 0.579300404f},
-std::array<float,2>{0.245633081f, 0.0628940836f},
-std::array<float,2>{0.74447161f, 0.398607433f},
-std::array<float,2>{0.264404356f, 0.894608796f},
-std::array<float,2>{0.514944732f, 0.783972502f},
-std::array<float,2>{0.391376793f, 0.300735891f},
-std::array<float,2>{0.95111531f, 0.129632488f},
-std::array<float,2>{0.0571580045f, 0.671109855f},
-std::array<float,2>{0.667398274f, 0.704849541f},
-std::array<float,2>{0.344447672f, 0.245989248f},
-std::array<float,2>{0.787723601f, 0.362288296f},
-std::array<float,2>{0.180411398f, 0.861026108f},
-std::array<float,2>{0.887822151f, 0.947763324f},
-std::array<float,2>{0.0939978957f, 0.461997271f},
-std::array<float,2>{0.573188007f, 0.0263010897f},
-std::array<float,2>{0.47687307f, 0.522162616f},
-std::array<float,2>{0.971790612f, 0.633278787f},
-std::array<float,2>{0.0179307796f, 0.177231684f},
-std::array<float,2>{0.537389636f, 0.25906536f},
-std::array<float,2>{0.423918605f, 0.750152767f},
-std::array<float,2>{0.714611948f, 0.913903415f},
-std::array<float,2>{0.295729458f, 0.421226919f},
-std::array<float,2>{0.872724414f, 0.115359053f},
-std::array<float,2>{0.218553215f, 0.623543024f},
-std::array<float,2>{0.603797019f, 0.559687495f},
-std::array<float,2>{0.466789424f, 0.039092429f},
-std::array<float,2>{0.931993008f, 0.493361324f},
-std::array<float,2>{0.0726109296f, 0.982184649f},
-std::array<float,2>{0.75601387f, 0.823042631f},
-std::array<float,2>{0.131187215f, 0.326845556f},
-std::array<float,2>{0.642049491f, 0.194538832f},
-std::array<float,2>{0.313015491f, 0.72276181f},
-std::array<float,2>{0.906807005f, 0.500099599f},
-std::array<float,2>{0.0859526917f, 0.0140704233f},
-std::array<float,2>{0.616362751f, 0.443238705f},
-std::array<float,2>{0.449109137f, 0.955810785f},
-std::array<float,2>{0.626554489f, 0.858819246f},
-std::array<float,2>{0.342573166f, 0.358262688f},
-std::array<float,2>{0.777099431f, 0.226505592f},
-std::array<float,2>{0.15566504f, 0.692372739f},
-std::array<float,2>{0.553349733f, 0.680223942f},
-std::array<float,2>{0.420398563f, 0.143103316f},
-std::array<float,2>{0.995279729f, 0.282623619f},
-std::array<float,2>{0.00701867975f, 0.807062268f},
-std::array<float,2>{0.844753921f, 0.888339937f},
-std::array<float,2>{0.200120524f, 0.382949471f},
-std::array<float,2>{0.697685301f, 0.0833412185f},
-std::array<float,2>{0.305546552f, 0.575689137f},
-std::array<float,2>{0.79867363f, 0.73964107f},
-std::array<float,2>{0.162166849f, 0.215950415f},
-std::array<float,2>{0.678936541f, 0.330798566f},
-std::array<float,2>{0.362748533f, 0.83472544f},
-std::array<float,2>{0.581151485f, 0.98940593f},
-std::array<float,2>{0.495718837f, 0.484209597f},
-std::array<float,2>{0.90010488f, 0.0611899756f},
-std::array<float,2>{0.113871887f, 0.546549499f},
-std::array<float,2>{0.727076232f, 0.604016364f},
-std::array<float,2>{0.268745035f, 0.094328098f},
-std::array<float,2>{0.841424823f, 0.435827106f},
-std::array<float,2>{0.22183232f, 0.9356516f},
-std::array<float,2>{0.961421788f, 0.776102722f},
-std::array<float,2>{0.0342402533f, 0.278730989f},
-std::array<float,2>{0.527987182f, 0.157154828f},
-std::array<float,2>{0.388881147f, 0.655275881f},
-std::array<float,2>{0.769089341f, 0.53632772f},
-std::array<float,2>{0.143299669f, 0.0540903024f},
-std::array<float,2>{0.638253748f, 0.470280856f},
-std::array<float,2>{0.330917656f, 0.994016528f},
-std::array<float,2>{0.620348811f, 0.839706838f},
-std::array<float,2>{0.441729546f, 0.342308581f},
-std::array<float,2>{0.920094907f, 0.20402661f},
-std::array<float,2>{0.0829649866f, 0.749675691f},
-std::array<float,2>{0.688936412f, 0.643542171f},
-std::array<float,2>{0.303831726f, 0.165854111f},
-std::array<float,2>{0.853685021f, 0.271107018f},
-std::array<float,2>{0.190201327f, 0.767700076f},
-std::array<float,2>{0.987070799f, 0.92750895f},
-std::array<float,2>{0.00995431282f, 0.425773472f},
-std::array<float,2>{0.556946516f, 0.102648519f},
-std::array<float,2>{0.407065541f, 0.601562142f},
-std::array<float,2>{0.892521799f, 0.700935841f},
-std::array<float,2>{0.118606299f, 0.230290756f},
-std::array<float,2>{0.586136818f, 0.345539004f},
-std::array<float,2>{0.486248881f, 0.847055197f},
-std::array<float,2>{0.681093812f, 0.961367548f},
-std::array<float,2>{0.368429095f, 0.445796281f},
-std::array<float,2>{0.807991922f, 0.00474120723f},
-std::array<float,2>{0.166365996f, 0.507959783f},
-std::array<float,2>{0.519192219f, 0.563213885f},
-std::array<float,2>{0.38130945f, 0.0927485004f},
-std::array<float,2>{0.958595216f, 0.38018477f},
-std::array<float,2>{0.0459635071f, 0.882024527f},
-std::array<float,2>{0.833534956f, 0.802819192f},
-std::array<float,2>{0.233387485f, 0.292420954f},
-std::array<float,2>{0.719943225f, 0.149317712f},
-std::array<float,2>{0.278977156f, 0.676742792f},
-std::array<float,2>{0.945117533f, 0.613442838f},
-std::array<float,2>{0.0536781959f, 0.120929144f},
-std::array<float,2>{0.500918388f, 0.408923626f},
-std::array<float,2>{0.399473876f, 0.921687603f},
-std::array<float,2>{0.738399982f, 0.764340222f},
-std::array<float,2>{0.253090799f, 0.257412493f},
-std::array<float,2>{0.816784859f, 0.184199169f},
-std::array<float,2>{0.238202974f, 0.631415606f},
-std::array<float,2>{0.564446449f, 0.734343529f},
-std::array<float,2>{0.47275725f, 0.202199891f},
-std::array<float,2>{0.876864314f, 0.315000534f},
-std::array<float,2>{0.10643068f, 0.8156147f},
-std::array<float,2>{0.796023726f, 0.970445693f},
-std::array<float,2>{0.176790804f, 0.489663243f},
-std::array<float,2>{0.658383191f, 0.0387124866f},
-std::array<float,2>{0.352319509f, 0.551751614f},
-std::array<float,2>{0.865496278f, 0.659863055f},
-std::array<float,2>{0.210456118f, 0.136248052f},
-std::array<float,2>{0.705081582f, 0.308149666f},
-std::array<float,2>{0.28464818f, 0.790239513f},
-std::array<float,2>{0.540055692f, 0.898748517f},
-std::array<float,2>{0.435464203f, 0.396731079f},
-std::array<float,2>{0.979536176f, 0.0727644488f},
-std::array<float,2>{0.0306014009f, 0.593261778f},
-std::array<float,2>{0.656124711f, 0.530950189f},
-std::array<float,2>{0.320450872f, 0.0174089111f},
-std::array<float,2>{0.759771407f, 0.457077533f},
-std::array<float,2>{0.137082443f, 0.938500702f},
-std::array<float,2>{0.922433436f, 0.869328141f},
-std::array<float,2>{0.0628191903f, 0.368871748f},
-std::array<float,2>{0.595931351f, 0.239271775f},
-std::array<float,2>{0.45855099f, 0.717219234f},
-std::array<float,2>{0.857576311f, 0.517608881f},
-std::array<float,2>{0.193292961f, 0.0276471321f},
-std::array<float,2>{0.692270219f, 0.468106687f},
-std::array<float,2>{0.297671765f, 0.950427651f},
-std::array<float,2>{0.558635831f, 0.864594877f},
-std::array<float,2>{0.411723733f, 0.364003628f},
-std::array<float,2>{0.988991618f, 0.246828243f},
-std::array<float,2>{0.0145671489f, 0.709806025f},
-std::array<float,2>{0.636342883f, 0.667686641f},
-std::array<float,2>{0.333164126f, 0.126114428f},
-std::array<float,2>{0.772769392f, 0.302208662f},
-std::array<float,2>{0.14739725f, 0.788530171f},
-std::array<float,2>{0.915312886f, 0.893480718f},
-std::array<float,2>{0.0787455514f, 0.404703885f},
-std::array<float,2>{0.624199033f, 0.0685355067f},
-std::array<float,2>{0.440534621f, 0.584623635f},
-std::array<float,2>{0.953210473f, 0.720480442f},
-std::array<float,2>{0.0412561148f, 0.187827215f},
-std::array<float,2>{0.522284567f, 0.321489096f},
-std::array<float,2>{0.375459194f, 0.826345026f},
-std::array<float,2>{0.726345539f, 0.977957428f},
-std::array<float,2>{0.275238156f, 0.498234361f},
-std::array<float,2>{0.831151068f, 0.0463233702f},
-std::array<float,2>{0.229936957f, 0.556076527f},
-std::array<float,2>{0.590497613f, 0.617367864f},
-std::array<float,2>{0.488718152f, 0.110718071f},
-std::array<float,2>{0.89672035f, 0.415651858f},
-std::array<float,2>{0.123013511f, 0.906642437f},
-std::array<float,2>{0.81152457f, 0.754133224f},
-std::array<float,2>{0.167975098f, 0.265506685f},
-std::array<float,2>{0.68606329f, 0.173607647f},
-std::array<float,2>{0.373736829f, 0.636746407f},
-std::array<float,2>{0.879651845f, 0.570519805f},
-std::array<float,2>{0.101728544f, 0.0785511211f},
-std::array<float,2>{0.567291737f, 0.387819856f},
-std::array<float,2>{0.47157383f, 0.882897079f},
-std::array<float,2>{0.661175489f, 0.811977625f},
-std::array<float,2>{0.35678938f, 0.285874873f},
-std::array<float,2>{0.790113151f, 0.144568011f},
-std::array<float,2>{0.173812732f, 0.684840322f},
-std::array<float,2>{0.504614174f, 0.689571738f},
-std::array<float,2>{0.405467808f, 0.222614065f},
-std::array<float,2>{0.938207448f, 0.355263084f},
-std::array<float,2>{0.0487318113f, 0.852111876f},
-std::array<float,2>{0.815002799f, 0.958107829f},
-std::array<float,2>{0.240213051f, 0.438681871f},
-std::array<float,2>{0.738056779f, 0.0100127803f},
-std::array<float,2>{0.256186157f, 0.507359505f},
-std::array<float,2>{0.762988508f, 0.651445091f},
-std::array<float,2>{0.135426819f, 0.164061174f},
-std::array<float,2>{0.650844157f, 0.273962915f},
-std::array<float,2>{0.327229917f, 0.779518127f},
-std::array<float,2>{0.600016773f, 0.931540966f},
-std::array<float,2>{0.456500709f, 0.430103958f},
-std::array<float,2>{0.929276109f, 0.0977762118f},
-std::array<float,2>{0.0700910166f, 0.607980788f},
-std::array<float,2>{0.71018368f, 0.541110158f},
-std::array<float,2>{0.28866592f, 0.0551812984f},
-std::array<float,2>{0.860716939f, 0.479508549f},
-std::array<float,2>{0.205914482f, 0.986656368f},
-std::array<float,2>{0.983863056f, 0.829844117f},
-std::array<float,2>{0.0263943709f, 0.334737688f},
-std::array<float,2>{0.546295941f, 0.212911099f},
-std::array<float,2>{0.432763338f, 0.737194657f},
-std::array<float,2>{0.784042776f, 0.596560299f},
-std::array<float,2>{0.184921801f, 0.109278813f},
-std::array<float,2>{0.669348359f, 0.428687185f},
-std::array<float,2>{0.349472135f, 0.924669862f},
-std::array<float,2>{0.576717854f, 0.770505488f},
-std::array<float,2>{0.483876824f, 0.268864572f},
-std::array<float,2>{0.883418441f, 0.170912042f},
-std::array<float,2>{0.099162966f, 0.64713484f},
-std::array<float,2>{0.748213291f, 0.743209004f},
-std::array<float,2>{0.258860648f, 0.207502514f},
-std::array<float,2>{0.8278386f, 0.339185625f},
-std::array<float,2>{0.248204201f, 0.840888381f},
-std::array<float,2>{0.945650101f, 0.998082042f},
-std::array<float,2>{0.0611864515f, 0.473397076f},
-std::array<float,2>{0.510371327f, 0.0472449288f},
-std::array<float,2>{0.39462927f, 0.53326869f},
-std::array<float,2>{0.936039805f, 0.675111651f},
-std::array<float,2>{0.0758426115f, 0.153475955f},
-std::array<float,2>{0.608309031f, 0.295374423f},
-std::array<float,2>{0.462252825f, 0.800189078f},
-std::array<float,2>{0.645051003f, 0.876266837f},
-std::array<float,2>{0.317002326f, 0.376148701f},
-std::array<float,2>{0.750038803f, 0.0864203721f},
-std::array<float,2>{0.126945227f, 0.56640923f},
-std::array<float,2>{0.534687757f, 0.512821913f},
-std::array<float,2>{0.426723003f, 0.00226870971f},
-std::array<float,2>{0.974609196f, 0.451987356f},
-std::array<float,2>{0.0222402234f, 0.967673123f},
-std::array<float,2>{0.868034244f, 0.849914372f},
-std::array<float,2>{0.21346435f, 0.34939608f},
-std::array<float,2>{0.717001081f, 0.231948406f},
-std::array<float,2>{0.292336553f, 0.696762025f},
-std::array<float,2>{0.998091578f, 0.549112678f},
-std::array<float,2>{0.000397673371f, 0.031770736f},
-std::array<float,2>{0.549002826f, 0.487098962f},
-std::array<float,2>{0.416845322f, 0.973644435f},
-std::array<float,2>{0.700988233f, 0.818435311f},
-std::array<float,2>{0.311885685f, 0.317138165f},
-std::array<float,2>{0.848667622f, 0.196013674f},
-std::array<float,2>{0.197791815f, 0.726657748f},
-std::array<float,2>{0.611586988f, 0.628677249f},
-std::array<float,2>{0.452267766f, 0.180457443f},
-std::array<float,2>{0.912023127f, 0.253059149f},
-std::array<float,2>{0.0926461294f, 0.760702908f},
-std::array<float,2>{0.779826343f, 0.917249858f},
-std::array<float,2>{0.151214153f, 0.412485987f},
-std::array<float,2>{0.631584466f, 0.123003967f},
-std::array<float,2>{0.33883667f, 0.610347927f},
-std::array<float,2>{0.837789178f, 0.712279856f},
-std::array<float,2>{0.223920614f, 0.237361804f},
-std::array<float,2>{0.733569145f, 0.371577263f},
-std::array<float,2>{0.27023077f, 0.874043584f},
-std::array<float,2>{0.526183724f, 0.942664504f},
-std::array<float,2>{0.384869277f, 0.456083536f},
-std::array<float,2>{0.965910673f, 0.0209615584f},
-std::array<float,2>{0.0384813361f, 0.525299549f},
-std::array<float,2>{0.673275173f, 0.587918401f},
-std::array<float,2>{0.364063114f, 0.0772918537f},
-std::array<float,2>{0.802975178f, 0.392725706f},
-std::array<float,2>{0.157982945f, 0.903467238f},
-std::array<float,2>{0.903268218f, 0.796558917f},
-std::array<float,2>{0.112120278f, 0.308895171f},
-std::array<float,2>{0.583338618f, 0.138740599f},
-std::array<float,2>{0.499400049f, 0.66117239f},
-std::array<float,2>{0.874722898f, 0.622942507f},
-std::array<float,2>{0.216086105f, 0.115003176f},
-std::array<float,2>{0.712639928f, 0.419109583f},
-std::array<float,2>{0.293310165f, 0.911189079f},
-std::array<float,2>{0.53630209f, 0.752010882f},
-std::array<float,2>{0.422375679f, 0.260665685f},
-std::array<float,2>{0.969147801f, 0.178528681f},
-std::array<float,2>{0.0163215417f, 0.635519326f},
-std::array<float,2>{0.643697321f, 0.724728703f},
-std::array<float,2>{0.314498097f, 0.192715198f},
-std::array<float,2>{0.754571617f, 0.325994194f},
-std::array<float,2>{0.129179239f, 0.821766198f},
-std::array<float,2>{0.93097347f, 0.982924283f},
-std::array<float,2>{0.0722028539f, 0.49430424f},
-std::array<float,2>{0.603127301f, 0.0416939072f},
-std::array<float,2>{0.467092395f, 0.561622262f},
-std::array<float,2>{0.952064633f, 0.669304729f},
-std::array<float,2>{0.0548558012f, 0.132214829f},
-std::array<float,2>{0.51330018f, 0.297994316f},
-std::array<float,2>{0.392728448f, 0.782346129f},
-std::array<float,2>{0.743589044f, 0.897941589f},
-std::array<float,2>{0.262080133f, 0.400790572f},
-std::array<float,2>{0.820523381f, 0.0647420511f},
-std::array<float,2>{0.242979452f, 0.580738902f},
-std::array<float,2>{0.572104275f, 0.520767689f},
-std::array<float,2>{0.479764014f, 0.023802463f},
-std::array<float,2>{0.889660478f, 0.463156015f},
-std::array<float,2>{0.0967013836f, 0.946500003f},
-std::array<float,2>{0.785486221f, 0.862501979f},
-std::array<float,2>{0.1826379f, 0.360820711f},
-std::array<float,2>{0.665386558f, 0.242702737f},
-std::array<float,2>{0.347590804f, 0.705871344f},
-std::array<float,2>{0.90191412f, 0.544385016f},
-std::array<float,2>{0.11596746f, 0.0592605025f},
-std::array<float,2>{0.578319788f, 0.481533617f},
-std::array<float,2>{0.493341386f, 0.991195261f},
-std::array<float,2>{0.67611444f, 0.832972109f},
-std::array<float,2>{0.360965669f, 0.328809977f},
-std::array<float,2>{0.800261497f, 0.217745006f},
-std::array<float,2>{0.160191581f, 0.740784287f},
-std::array<float,2>{0.53078562f, 0.652901292f},
-std::array<float,2>{0.388319105f, 0.158972174f},
-std::array<float,2>{0.963991046f, 0.280943692f},
-std::array<float,2>{0.0319925807f, 0.774778843f},
-std::array<float,2>{0.843100548f, 0.93502152f},
-std::array<float,2>{0.220589653f, 0.434717745f},
-std::array<float,2>{0.729983985f, 0.0966902599f},
-std::array<float,2>{0.267295241f, 0.60177511f},
-std::array<float,2>{0.773741424f, 0.694659472f},
-std::array<float,2>{0.153753266f, 0.223798543f},
-std::array<float,2>{0.627659678f, 0.356170028f},
-std::array<float,2>{0.341527432f, 0.855601728f},
-std::array<float,2>{0.61446923f, 0.953285635f},
-std::array<float,2>{0.44685781f, 0.443375915f},
-std::array<float,2>{0.909136832f, 0.0126521336f},
-std::array<float,2>{0.089544192f, 0.503422618f},
-std::array<float,2>{0.695795298f, 0.577005863f},
-std::array<float,2>{0.308539301f, 0.0858584493f},
-std::array<float,2>{0.84630698f, 0.38498053f},
-std::array<float,2>{0.202447772f, 0.889929473f},
-std::array<float,2>{0.9929142f, 0.806386411f},
-std::array<float,2>{0.00554582709f, 0.284021586f},
-std::array<float,2>{0.551630676f, 0.141621977f},
-std::array<float,2>{0.418939918f, 0.682851374f},
-std::array<float,2>{0.804741621f, 0.510157049f},
-std::array<float,2>{0.165607885f, 0.00699016405f},
-std::array<float,2>{0.681672215f, 0.448304176f},
-std::array<float,2>{0.369287044f, 0.963148057f},
-std::array<float,2>{0.588645279f, 0.843896806f},
-std::array<float,2>{0.487599045f, 0.347198844f},
-std::array<float,2>{0.89412421f, 0.226962149f},
-std::array<float,2>{0.119874924f, 0.702831924f},
-std::array<float,2>{0.722291768f, 0.679457247f},
-std::array<float,2>{0.280367762f, 0.152218446f},
-std::array<float,2>{0.834166229f, 0.289732218f},
-std::array<float,2>{0.23184444f, 0.801705658f},
-std::array<float,2>{0.96033138f, 0.879711866f},
-std::array<float,2>{0.0432531647f, 0.381600857f},
-std::array<float,2>{0.516728163f, 0.0904992893f},
-std::array<float,2>{0.3802104f, 0.565135956f},
-std::array<float,2>{0.9188357f, 0.74789542f},
-std::array<float,2>{0.0855716988f, 0.205347031f},
-std::array<float,2>{0.618622363f, 0.341034234f},
-std::array<float,2>{0.444718778f, 0.837708354f},
-std::array<float,2>{0.640582263f, 0.995990336f},
-std::array<float,2>{0.329328597f, 0.471412778f},
-std::array<float,2>{0.766969979f, 0.0520540662f},
-std::array<float,2>{0.142536908f, 0.537888348f},
-std::array<float,2>{0.555402458f, 0.599486351f},
-std::array<float,2>{0.409434676f, 0.105433971f},
-std::array<float,2>{0.985174775f, 0.422455758f},
-std::array<float,2>{0.00792141072f, 0.928127408f},
-std::array<float,2>{0.853401482f, 0.766595662f},
-std::array<float,2>{0.189055264f, 0.27247408f},
-std::array<float,2>{0.690477014f, 0.166656747f},
-std::array<float,2>{0.301255077f, 0.642447412f},
-std::array<float,2>{0.977467537f, 0.591162443f},
-std::array<float,2>{0.0283850562f, 0.0708695278f},
-std::array<float,2>{0.54237771f, 0.39618203f},
-std::array<float,2>{0.435890108f, 0.901713848f},
-std::array<float,2>{0.703507543f, 0.792172432f},
-std::array<float,2>{0.281648606f, 0.305150449f},
-std::array<float,2>{0.864777684f, 0.134710163f},
-std::array<float,2>{0.208389446f, 0.657777905f},
-std::array<float,2>{0.593854785f, 0.71638751f},
-std::array<float,2>{0.460692734f, 0.240725681f},
-std::array<float,2>{0.925432444f, 0.369279593f},
-std::array<float,2>{0.0652685091f, 0.868855834f},
-std::array<float,2>{0.758368611f, 0.941085935f},
-std::array<float,2>{0.139106765f, 0.460445434f},
-std::array<float,2>{0.653407097f, 0.0192974824f},
-std::array<float,2>{0.322316259f, 0.528059542f},
-std::array<float,2>{0.818835139f, 0.629336894f},
-std::array<float,2>{0.234615058f, 0.185679823f},
-std::array<float,2>{0.74128598f, 0.255529165f},
-std::array<float,2>{0.250083596f, 0.76234597f},
-std::array<float,2>{0.50308007f, 0.919453382f},
-std::array<float,2>{0.401775777f, 0.406828433f},
-std::array<float,2>{0.942401826f, 0.118841581f},
-std::array<float,2>{0.0510503016f, 0.61591661f},
-std::array<float,2>{0.656395733f, 0.553511083f},
-std::array<float,2>{0.35394907f, 0.0364069529f},
-std::array<float,2>{0.794202685f, 0.490921348f},
-std::array<float,2>{0.179565668f, 0.970793426f},
-std::array<float,2>{0.877931893f, 0.813629687f},
-std::array<float,2>{0.107628778f, 0.313389808f},
-std::array<float,2>{0.566291749f, 0.200655848f},
-std::array<float,2>{0.475291878f, 0.730931461f},
-std::array<float,2>{0.828667819f, 0.558161557f},
-std::array<float,2>{0.227006912f, 0.04352393f},
-std::array<float,2>{0.72363025f, 0.496398419f},
-std::array<float,2>{0.276397556f, 0.980424702f},
-std::array<float,2>{0.521118402f, 0.825422347f},
-std::array<float,2>{0.378094792f, 0.322769344f},
-std::array<float,2>{0.956564128f, 0.190911382f},
-std::array<float,2>{0.0396159105f, 0.722262859f},
-std::array<float,2>{0.684332609f, 0.639881432f},
-std::array<float,2>{0.371133298f, 0.175393909f},
-std::array<float,2>{0.808707952f, 0.262540698f},
-std::array<float,2>{0.169955805f, 0.757633507f},
-std::array<float,2>{0.89565891f, 0.90867424f},
-std::array<float,2>{0.123133436f, 0.417171478f},
-std::array<float,2>{0.591839552f, 0.113209873f},
-std::array<float,2>{0.491641909f, 0.620573342f},
-std::array<float,2>{0.990895629f, 0.707549989f},
-std::array<float,2>{0.0122384932f, 0.248719737f},
-std::array<float,2>{0.561930776f, 0.366219312f},
-std::array<float,2>{0.413967431f, 0.865784347f},
-std::array<float,2>{0.694699705f, 0.951357305f},
-std::array<float,2>{0.299381375f, 0.466289997f},
-std::array<float,2>{0.856632411f, 0.0302630253f},
-std::array<float,2>{0.193397075f, 0.517392933f},
-std::array<float,2>{0.621292353f, 0.582370043f},
-std::array<float,2>{0.438333213f, 0.0672461614f},
-std::array<float,2>{0.916020811f, 0.403510928f},
-std::array<float,2>{0.0811175257f, 0.891708136f},
-std::array<float,2>{0.770853877f, 0.785294831f},
-std::array<float,2>{0.144775823f, 0.303035736f},
-std::array<float,2>{0.633558512f, 0.127084851f},
-std::array<float,2>{0.33547315f, 0.665841699f},
-std::array<float,2>{0.926219761f, 0.606222749f},
-std::array<float,2>{0.0678999647f, 0.0996225625f},
-std::array<float,2>{0.597711265f, 0.432962835f},
-std::array<float,2>{0.453249663f, 0.932441592f},
-std::array<float,2>{0.64908129f, 0.778493106f},
-std::array<float,2>{0.325282037f, 0.27652818f},
-std::array<float,2>{0.763761878f, 0.160704345f},
-std::array<float,2>{0.134320959f, 0.648566186f},
-std::array<float,2>{0.54399693f, 0.734539986f},
-std::array<float,2>{0.430894494f, 0.212876469f},
-std::array<float,2>{0.98225081f, 0.333388031f},
-std::array<float,2>{0.0243737996f, 0.831267178f},
-std::array<float,2>{0.862130523f, 0.985060513f},
-std::array<float,2>{0.20472306f, 0.476685196f},
-std::array<float,2>{0.708529651f, 0.0577981099f},
-std::array<float,2>{0.28564772f, 0.53939414f},
-std::array<float,2>{0.792901218f, 0.685758173f},
-std::array<float,2>{0.175584093f, 0.146756649f},
-std::array<float,2>{0.663956583f, 0.288554192f},
-std::array<float,2>{0.357491612f, 0.809265494f},
-std::array<float,2>{0.568367064f, 0.886654317f},
-std::array<float,2>{0.470483214f, 0.389980316f},
-std::array<float,2>{0.880910099f, 0.0806450471f},
-std::array<float,2>{0.104877234f, 0.572766185f},
-std::array<float,2>{0.735025346f, 0.505643964f},
-std::array<float,2>{0.254216939f, 0.00862222072f},
-std::array<float,2>{0.814352334f, 0.441405654f},
-std::array<float,2>{0.241582379f, 0.960658252f},
-std::array<float,2>{0.940373123f, 0.854736328f},
-std::array<float,2>{0.0493886843f, 0.352496147f},
-std::array<float,2>{0.507216394f, 0.21974887f},
-std::array<float,2>{0.403893858f, 0.688765049f},
-std::array<float,2>{0.752558231f, 0.569858551f},
-std::array<float,2>{0.127220929f, 0.0888808742f},
-std::array<float,2>{0.647244632f, 0.378069371f},
-std::array<float,2>{0.319913805f, 0.878170848f},
-std::array<float,2>{0.605802417f, 0.798686504f},
-std::array<float,2>{0.464506507f, 0.294128478f},
-std::array<float,2>{0.934281766f, 0.1546956f},
-std::array<float,2>{0.0776815042f, 0.673257649f},
-std::array<float,2>{0.715385854f, 0.699088395f},
-std::array<float,2>{0.289782703f, 0.232474968f},
-std::array<float,2>{0.869303823f, 0.351520896f},
-std::array<float,2>{0.211549282f, 0.849004745f},
-std::array<float,2>{0.976112962f, 0.965166807f},
-std::array<float,2>{0.0204008482f, 0.450375408f},
-std::array<float,2>{0.531991899f, 0.000376505079f},
-std::array<float,2>{0.428681403f, 0.51373589f},
-std::array<float,2>{0.885702968f, 0.645686805f},
-std::array<float,2>{0.100263059f, 0.169918239f},
-std::array<float,2>{0.574947298f, 0.267237097f},
-std::array<float,2>{0.481040895f, 0.772575438f},
-std::array<float,2>{0.670945644f, 0.923331499f},
-std::array<float,2>{0.350247473f, 0.426337212f},
-std::array<float,2>{0.782569587f, 0.1070076f},
-std::array<float,2>{0.186735258f, 0.595355153f},
-std::array<float,2>{0.50831145f, 0.531748772f},
-std::array<float,2>{0.397747964f, 0.05035289f},
-std::array<float,2>{0.948118389f, 0.476223558f},
-std::array<float,2>{0.0588707365f, 0.996544063f},
-std::array<float,2>{0.825993776f, 0.841865838f},
-std::array<float,2>{0.246382505f, 0.33766827f},
-std::array<float,2>{0.746306598f, 0.209569126f},
-std::array<float,2>{0.26076442f, 0.744498253f},
-std::array<float,2>{0.968746901f, 0.526284397f},
-std::array<float,2>{0.0362136737f, 0.0218664277f},
-std::array<float,2>{0.524809897f, 0.453780621f},
-std::array<float,2>{0.383468032f, 0.944768965f},
-std::array<float,2>{0.730751157f, 0.872624874f},
-std::array<float,2>{0.271909148f, 0.374475032f},
-std::array<float,2>{0.839826524f, 0.23552388f},
-std::array<float,2>{0.225203156f, 0.713742971f},
-std::array<float,2>{0.584583104f, 0.663973451f},
-std::array<float,2>{0.49791944f, 0.137506112f},
-std::array<float,2>{0.904340684f, 0.311787128f},
-std::array<float,2>{0.110002726f, 0.793722391f},
-std::array<float,2>{0.801083982f, 0.904470086f},
-std::array<float,2>{0.160072789f, 0.392457634f},
-std::array<float,2>{0.674726129f, 0.0742676184f},
-std::array<float,2>{0.366368204f, 0.586027324f},
-std::array<float,2>{0.850659609f, 0.728876233f},
-std::array<float,2>{0.196899533f, 0.197469532f},
-std::array<float,2>{0.702182412f, 0.318543434f},
-std::array<float,2>{0.309877843f, 0.818352222f},
-std::array<float,2>{0.547078431f, 0.976422966f},
-std::array<float,2>{0.414282113f, 0.486088425f},
-std::array<float,2>{0.996737421f, 0.0349001437f},
-std::array<float,2>{0.00270226179f, 0.546955228f},
-std::array<float,2>{0.630636096f, 0.611527026f},
-std::array<float,2>{0.336746097f, 0.123054616f},
-std::array<float,2>{0.777517617f, 0.411369264f},
-std::array<float,2>{0.150068551f, 0.915190578f},
-std::array<float,2>{0.913483977f, 0.759607375f},
-std::array<float,2>{0.0906184688f, 0.250818074f},
-std::array<float,2>{0.609641671f, 0.182699755f},
-std::array<float,2>{0.450514704f, 0.626310945f},
-std::array<float,2>{0.846697271f, 0.574864149f},
-std::array<float,2>{0.201745421f, 0.0827714577f},
-std::array<float,2>{0.69670409f, 0.383913279f},
-std::array<float,2>{0.307263374f, 0.886889696f},
-std::array<float,2>{0.552479029f, 0.808333397f},
-std::array<float,2>{0.419758528f, 0.281389773f},
-std::array<float,2>{0.993257761f, 0.144439012f},
-std::array<float,2>{0.00443981076f, 0.680698931f},
-std::array<float,2>{0.628682852f, 0.693358302f},
-std::array<float,2>{0.34051311f, 0.225103796f},
-std::array<float,2>{0.77535069f, 0.358740062f},
-std::array<float,2>{0.152397648f, 0.857741058f},
-std::array<float,2>{0.909910619f, 0.95617038f},
-std::array<float,2>{0.0887508616f, 0.442104071f},
-std::array<float,2>{0.613671541f, 0.0155393183f},
-std::array<float,2>{0.445850402f, 0.501220405f},
-std::array<float,2>{0.96296072f, 0.654944897f},
-std::array<float,2>{0.0325403884f, 0.157612503f},
-std::array<float,2>{0.529467702f, 0.278176129f},
-std::array<float,2>{0.386747211f, 0.776830435f},
-std::array<float,2>{0.728924751f, 0.937312484f},
-std::array<float,2>{0.266508192f, 0.436669797f},
-std::array<float,2>{0.842151046f, 0.0951041952f},
-std::array<float,2>{0.219471529f, 0.604922771f},
-std::array<float,2>{0.579802573f, 0.545149505f},
-std::array<float,2>{0.492859662f, 0.0618708804f},
-std::array<float,2>{0.901007712f, 0.4825885f},
-std::array<float,2>{0.116341211f, 0.988892853f},
-std::array<float,2>{0.79965961f, 0.835007191f},
-std::array<float,2>{0.161277518f, 0.331969023f},
-std::array<float,2>{0.677400768f, 0.215740666f},
-std::array<float,2>{0.359383732f, 0.739076078f},
-std::array<float,2>{0.889535069f, 0.522535622f},
-std::array<float,2>{0.0964241251f, 0.0270997267f},
-std::array<float,2>{0.570425093f, 0.461496204f},
-std::array<float,2>{0.479206055f, 0.948921859f},
-std::array<float,2>{0.664971292f, 0.859740555f},
-std::array<float,2>{0.345714182f, 0.362707973f},
-std::array<float,2>{0.78615129f, 0.244489372f},
-std::array<float,2>{0.182411492f, 0.70325613f},
-std::array<float,2>{0.512395442f, 0.670157135f},
-std::array<float,2>{0.393993497f, 0.130596086f},
-std::array<float,2>{0.952634573f, 0.29933387f},
-std::array<float,2>{0.0561190546f, 0.784951866f},
-std::array<float,2>{0.821775019f, 0.89599371f},
-std::array<float,2>{0.24393329f, 0.399697781f},
-std::array<float,2>{0.742719471f, 0.0643672198f},
-std::array<float,2>{0.262967527f, 0.578864098f},
-std::array<float,2>{0.755666852f, 0.724056661f},
-std::array<float,2>{0.130037904f, 0.193451226f},
-std::array<float,2>{0.642669559f, 0.32796061f},
-std::array<float,2>{0.316215068f, 0.823523641f},
-std::array<float,2>{0.602079868f, 0.980889082f},
-std::array<float,2>{0.467969954f, 0.492843658f},
-std::array<float,2>{0.930051625f, 0.0408074968f},
-std::array<float,2>{0.0710408017f, 0.559088945f},
-std::array<float,2>{0.711172521f, 0.624610722f},
-std::array<float,2>{0.294022322f, 0.116739787f},
-std::array<float,2>{0.873923123f, 0.420117676f},
-std::array<float,2>{0.214864388f, 0.912234902f},
-std::array<float,2>{0.970140338f, 0.751066864f},
-std::array<float,2>{0.0173988976f, 0.258445561f},
-std::array<float,2>{0.535875976f, 0.175865382f},
-std::array<float,2>{0.423302948f, 0.634430766f},
-std::array<float,2>{0.793454468f, 0.552562118f},
-std::array<float,2>{0.177899912f, 0.0376341268f},
-std::array<float,2>{0.657309175f, 0.488425314f},
-std::array<float,2>{0.354968756f, 0.96916914f},
-std::array<float,2>{0.564518929f, 0.81499207f},
-std::array<float,2>{0.475711375f, 0.316378206f},
-std::array<float,2>{0.877609253f, 0.201850191f},
-std::array<float,2>{0.108836956f, 0.732643723f},
-std::array<float,2>{0.7402637f, 0.632110596f},
-std::array<float,2>{0.251842171f, 0.185334355f},
-std::array<float,2>{0.819580734f, 0.256105304f},
-std::array<float,2>{0.235846996f, 0.764782667f},
-std::array<float,2>{0.941424131f, 0.920506597f},
-std::array<float,2>{0.0521890856f, 0.409525782f},
-std::array<float,2>{0.502840519f, 0.119206637f},
-std::array<float,2>{0.400797546f, 0.614479125f},
-std::array<float,2>{0.924147129f, 0.718359411f},
-std::array<float,2>{0.0658013374f, 0.238589406f},
-std::array<float,2>{0.595123291f, 0.367238879f},
-std::array<float,2>{0.459314615f, 0.870724022f},
-std::array<float,2>{0.652735889f, 0.93760401f},
-std::array<float,2>{0.323266387f, 0.458598495f},
-std::array<float,2>{0.75923115f, 0.0161537938f},
-std::array<float,2>{0.139963195f, 0.529977918f},
-std::array<float,2>{0.541865647f, 0.592336893f},
-std::array<float,2>{0.437329531f, 0.0741319954f},
-std::array<float,2>{0.978348136f, 0.397727817f},
-std::array<float,2>{0.0275478885f, 0.899510503f},
-std::array<float,2>{0.864142954f, 0.789533615f},
-std::array<float,2>{0.207813084f, 0.307092428f},
-std::array<float,2>{0.704669714f, 0.135016397f},
-std::array<float,2>{0.283002138f, 0.658420324f},
-std::array<float,2>{0.985719144f, 0.59978354f},
-std::array<float,2>{0.00931739621f, 0.101841301f},
-std::array<float,2>{0.555747449f, 0.424651593f},
-std::array<float,2>{0.409011841f, 0.925822437f},
-std::array<float,2>{0.690071046f, 0.769361734f},
-std::array<float,2>{0.302327514f, 0.270175993f},
-std::array<float,2>{0.852021575f, 0.164795265f},
-std::array<float,2>{0.18838653f, 0.643829226f},
-std::array<float,2>{0.617537379f, 0.748697579f},
-std::array<float,2>{0.444118619f, 0.204301283f},
-std::array<float,2>{0.919654727f, 0.342806667f},
-std::array<float,2>{0.0847590491f, 0.83886528f},
-std::array<float,2>{0.766254902f, 0.992511511f},
-std::array<float,2>{0.141220793f, 0.468901724f},
-std::array<float,2>{0.639297426f, 0.0527522005f},
-std::array<float,2>{0.328253418f, 0.535979152f},
-std::array<float,2>{0.835547984f, 0.67736876f},
-std::array<float,2>{0.231166229f, 0.149785414f},
-std::array<float,2>{0.72075069f, 0.291453838f},
-std::array<float,2>{0.280241162f, 0.804322243f},
-std::array<float,2>{0.516592264f, 0.881011307f},
-std::array<float,2>{0.379093379f, 0.379489064f},
-std::array<float,2>{0.959687889f, 0.0928819403f},
-std::array<float,2>{0.0446358137f, 0.563867807f},
-std::array<float,2>{0.683262706f, 0.5094257f},
-std::array<float,2>{0.370882899f, 0.00535012735f},
-std::array<float,2>{0.806312442f, 0.447013438f},
-std::array<float,2>{0.164081454f, 0.96240896f},
-std::array<float,2>{0.893052042f, 0.846126795f},
-std::array<float,2>{0.120478958f, 0.344654441f},
-std::array<float,2>{0.589817822f, 0.229078457f},
-std::array<float,2>{0.486907482f, 0.699475646f},
-std::array<float,2>{0.813345551f, 0.506465435f},
-std::array<float,2>{0.240262568f, 0.0112389121f},
-std::array<float,2>{0.736003757f, 0.438112229f},
-std::array<float,2>{0.255666196f, 0.95775193f},
-std::array<float,2>{0.506637394f, 0.853366852f},
-std::array<float,2>{0.403240532f, 0.354041219f},
-std::array<float,2>{0.940498292f, 0.220841363f},
-std::array<float,2>{0.0507511944f, 0.691232502f},
-std::array<float,2>{0.662571549f, 0.684227228f},
-std::array<float,2>{0.358725488f, 0.146041736f},
-std::array<float,2>{0.791278362f, 0.286973864f},
-std::array<float,2>{0.174028978f, 0.811508954f},
-std::array<float,2>{0.881978929f, 0.884450197f},
-std::array<float,2>{0.104043506f, 0.387027979f},
-std::array<float,2>{0.569616675f, 0.0795145184f},
-std::array<float,2>{0.4690485f, 0.57225883f},
-std::array<float,2>{0.981242359f, 0.738190711f},
-std::array<float,2>{0.0249038562f, 0.214446977f},
-std::array<float,2>{0.543725073f, 0.335374832f},
-std::array<float,2>{0.429962665f, 0.828613579f},
-std::array<float,2>{0.707085252f, 0.98759383f},
-std::array<float,2>{0.287059337f, 0.478714734f},
-std::array<float,2>{0.862323284f, 0.056328617f},
-std::array<float,2>{0.203923583f, 0.542694211f},
-std::array<float,2>{0.599582076f, 0.608617783f},
-std::array<float,2>{0.454404294f, 0.098670803f},
-std::array<float,2>{0.927148163f, 0.430668086f},
-std::array<float,2>{0.0671988502f, 0.930579662f},
-std::array<float,2>{0.764998853f, 0.781012833f},
-std::array<float,2>{0.133052409f, 0.274621487f},
-std::array<float,2>{0.649811745f, 0.162194282f},
-std::array<float,2>{0.324612319f, 0.651011825f},
-std::array<float,2>{0.917769969f, 0.585907936f},
-std::array<float,2>{0.0809017941f, 0.0694424212f},
-std::array<float,2>{0.622844577f, 0.406165928f},
-std::array<float,2>{0.43857044f, 0.894309044f},
-std::array<float,2>{0.633903682f, 0.787713408f},
-std::array<float,2>{0.334110379f, 0.300820053f},
-std::array<float,2>{0.769620001f, 0.125886634f},
-std::array<float,2>{0.146362394f, 0.666903019f},
-std::array<float,2>{0.560728014f, 0.710276246f},
-std::array<float,2>{0.412369668f, 0.247083962f},
-std::array<float,2>{0.991830647f, 0.365228236f},
-std::array<float,2>{0.0132890921f, 0.863914371f},
-std::array<float,2>{0.856138289f, 0.950172842f},
-std::array<float,2>{0.194479942f, 0.467317373f},
-std::array<float,2>{0.694028437f, 0.0284578111f},
-std::array<float,2>{0.300072461f, 0.518987298f},
-std::array<float,2>{0.810176849f, 0.637813091f},
-std::array<float,2>{0.171146438f, 0.172371522f},
-std::array<float,2>{0.685098588f, 0.263893694f},
-std::array<float,2>{0.372436881f, 0.755383492f},
-std::array<float,2>{0.593401134f, 0.907278478f},
-std::array<float,2>{0.490850836f, 0.414655656f},
-std::array<float,2>{0.895344257f, 0.110180944f},
-std::array<float,2>{0.12463966f, 0.61833173f},
-std::array<float,2>{0.723940253f, 0.555372536f},
-std::array<float,2>{0.275862545f, 0.0453776978f},
-std::array<float,2>{0.830077767f, 0.499335676f},
-std::array<float,2>{0.227661863f, 0.976720572f},
-std::array<float,2>{0.955179214f, 0.827670336f},
-std::array<float,2>{0.0409849659f, 0.320498317f},
-std::array<float,2>{0.520272732f, 0.188873768f},
-std::array<float,2>{0.377357006f, 0.719323635f},
-std::array<float,2>{0.778877437f, 0.611151993f},
-std::array<float,2>{0.148878515f, 0.121397957f},
-std::array<float,2>{0.628971279f, 0.413443089f},
-std::array<float,2>{0.337518543f, 0.916039407f},
-std::array<float,2>{0.610896289f, 0.761698782f},
-std::array<float,2>{0.449341416f, 0.252127171f},
-std::array<float,2>{0.912595987f, 0.180867925f},
-std::array<float,2>{0.0910914242f, 0.627054393f},
-std::array<float,2>{0.701831639f, 0.727621377f},
-std::array<float,2>{0.309173465f, 0.196653128f},
-std::array<float,2>{0.849776566f, 0.317827523f},
-std::array<float,2>{0.195865721f, 0.819881678f},
-std::array<float,2>{0.997785807f, 0.973614573f},
-std::array<float,2>{0.003436225f, 0.48810941f},
-std::array<float,2>{0.548660815f, 0.0330068953f},
-std::array<float,2>{0.415139437f, 0.55060339f},
-std::array<float,2>{0.906214535f, 0.661113083f},
-std::array<float,2>{0.11116229f, 0.140368149f},
-std::array<float,2>{0.585754216f, 0.310467333f},
-std::array<float,2>{0.496111542f, 0.795388639f},
-std::array<float,2>{0.675171494f, 0.903149664f},
-std::array<float,2>{0.36539188f, 0.394179791f},
-std::array<float,2>{0.802401781f, 0.0763381571f},
-std::array<float,2>{0.158453405f, 0.589201093f},
-std::array<float,2>{0.524379969f, 0.523882091f},
-std::array<float,2>{0.384540528f, 0.0203365535f},
-std::array<float,2>{0.967407346f, 0.455268115f},
-std::array<float,2>{0.0358898826f, 0.941722929f},
-std::array<float,2>{0.838286102f, 0.873658001f},
-std::array<float,2>{0.226188853f, 0.372627854f},
-std::array<float,2>{0.732187152f, 0.236515507f},
-std::array<float,2>{0.272532582f, 0.711221397f},
-std::array<float,2>{0.948714554f, 0.534824491f},
-std::array<float,2>{0.0598331876f, 0.0487960577f},
-std::array<float,2>{0.509327888f, 0.474120408f},
-std::array<float,2>{0.396568209f, 0.999196112f},
-std::array<float,2>{0.747383475f, 0.840213418f},
-std::array<float,2>{0.26065436f, 0.338217467f},
-std::array<float,2>{0.824433386f, 0.208174035f},
-std::array<float,2>{0.247906715f, 0.743049741f},
-std::array<float,2>{0.575422227f, 0.647605598f},
-std::array<float,2>{0.481820136f, 0.17050086f},
-std::array<float,2>{0.886412203f, 0.268059522f},
-std::array<float,2>{0.10138566f, 0.771039903f},
-std::array<float,2>{0.7821365f, 0.925673366f},
-std::array<float,2>{0.186135024f, 0.428803653f},
-std::array<float,2>{0.670641124f, 0.108145937f},
-std::array<float,2>{0.351202339f, 0.597379804f},
-std::array<float,2>{0.870125949f, 0.695414066f},
-std::array<float,2>{0.212550834f, 0.230682299f},
-std::array<float,2>{0.716446877f, 0.348078072f},
-std::array<float,2>{0.290482908f, 0.851399779f},
-std::array<float,2>{0.533002198f, 0.968440413f},
-std::array<float,2>{0.428792536f, 0.45253098f},
-std::array<float,2>{0.97488904f, 0.00349746947f},
-std::array<float,2>{0.0207291115f, 0.512298405f},
-std::array<float,2>{0.647534013f, 0.567914248f},
-std::array<float,2>{0.319148511f, 0.0876025707f},
-std::array<float,2>{0.753657281f, 0.375799984f},
-std::array<float,2>{0.128565177f, 0.875733435f},
-std::array<float,2>{0.935438335f, 0.799163342f},
-std::array<float,2>{0.0766893551f, 0.296034962f},
-std::array<float,2>{0.606569231f, 0.152859554f},
-std::array<float,2>{0.463308096f, 0.674650729f},
-std::array<float,2>{0.839938879f, 0.603212059f},
-std::array<float,2>{0.220892876f, 0.0963378847f},
-std::array<float,2>{0.727972507f, 0.434060574f},
-std::array<float,2>{0.268392891f, 0.933693588f},
-std::array<float,2>{0.52927494f, 0.773756623f},
-std::array<float,2>{0.389903277f, 0.280183822f},
-std::array<float,2>{0.962531626f, 0.159959257f},
-std::array<float,2>{0.0334681645f, 0.654088557f},
-std::array<float,2>{0.67839545f, 0.741318345f},
-std::array<float,2>{0.36229068f, 0.218504146f},
-std::array<float,2>{0.797211289f, 0.329781979f},
-std::array<float,2>{0.163746148f, 0.83309412f},
-std::array<float,2>{0.898941636f, 0.991761863f},
-std::array<float,2>{0.114971496f, 0.480958641f},
-std::array<float,2>{0.580928206f, 0.0598751903f},
-std::array<float,2>{0.494920135f, 0.543272555f},
-std::array<float,2>{0.994793534f, 0.681930304f},
-std::array<float,2>{0.0061841053f, 0.140757248f},
-std::array<float,2>{0.554160118f, 0.284399033f},
-std::array<float,2>{0.421028793f, 0.804714024f},
-std::array<float,2>{0.698592722f, 0.889505327f},
-std::array<float,2>{0.305843502f, 0.385778099f},
-std::array<float,2>{0.843835354f, 0.0847234279f},
-std::array<float,2>{0.200319409f, 0.577733159f},
-std::array<float,2>{0.615947604f, 0.502772093f},
-std::array<float,2>{0.448007494f, 0.013482593f},
-std::array<float,2>{0.907880545f, 0.445294917f},
-std::array<float,2>{0.0870933607f, 0.954873979f},
-std::array<float,2>{0.775434494f, 0.857228816f},
-std::array<float,2>{0.154874563f, 0.356791288f},
-std::array<float,2>{0.625071704f, 0.223300114f},
-std::array<float,2>{0.343578637f, 0.693807125f},
-std::array<float,2>{0.932745636f, 0.560658574f},
-std::array<float,2>{0.0736951455f, 0.04252721f},
-std::array<float,2>{0.604880452f, 0.495532274f},
-std::array<float,2>{0.465381652f, 0.984301805f},
-std::array<float,2>{0.640684068f, 0.820713758f},
-std::array<float,2>{0.313969672f, 0.324538589f},
-std::array<float,2>{0.757557511f, 0.191845953f},
-std::array<float,2>{0.131835967f, 0.726509571f},
-std::array<float,2>{0.538955271f, 0.636487603f},
-std::array<float,2>{0.425270647f, 0.179284289f},
-std::array<float,2>{0.971550465f, 0.261357605f},
-std::array<float,2>{0.0189037304f, 0.753426969f},
-std::array<float,2>{0.871834159f, 0.91090095f},
-std::array<float,2>{0.216994807f, 0.418359846f},
-std::array<float,2>{0.713280559f, 0.113627575f},
-std::array<float,2>{0.296792507f, 0.621253908f},
-std::array<float,2>{0.788392186f, 0.707014143f},
-std::array<float,2>{0.181044325f, 0.244127735f},
-std::array<float,2>{0.666844904f, 0.359605193f},
-std::array<float,2>{0.345098644f, 0.861471772f},
-std::array<float,2>{0.573537529f, 0.945734501f},
-std::array<float,2>{0.478395283f, 0.464018315f},
-std::array<float,2>{0.887650609f, 0.0246829204f},
-std::array<float,2>{0.0950839743f, 0.519990325f},
-std::array<float,2>{0.745518565f, 0.581211984f},
-std::array<float,2>{0.265316308f, 0.0663978755f},
-std::array<float,2>{0.823293567f, 0.401383609f},
-std::array<float,2>{0.244843289f, 0.896772563f},
-std::array<float,2>{0.949644208f, 0.782165527f},
-std::array<float,2>{0.057846304f, 0.297568262f},
-std::array<float,2>{0.513725758f, 0.131662413f},
-std::array<float,2>{0.392374456f, 0.668155134f},
-std::array<float,2>{0.761201382f, 0.528382123f},
-std::array<float,2>{0.138384789f, 0.0181845725f},
-std::array<float,2>{0.654954374f, 0.45904845f},
-std::array<float,2>{0.321516722f, 0.939968407f},
-std::array<float,2>{0.596970677f, 0.86794287f},
-std::array<float,2>{0.457695574f, 0.371014357f},
-std::array<float,2>{0.922862172f, 0.241614312f},
-std::array<float,2>{0.0644447431f, 0.71564734f},
-std::array<float,2>{0.706950009f, 0.657072723f},
-std::array<float,2>{0.283228159f, 0.133648902f},
-std::array<float,2>{0.866433501f, 0.306079626f},
-std::array<float,2>{0.209696203f, 0.791050673f},
-std::array<float,2>{0.978886545f, 0.90062958f},
-std::array<float,2>{0.0300524216f, 0.395249844f},
-std::array<float,2>{0.540021956f, 0.0713428706f},
-std::array<float,2>{0.434396416f, 0.59046787f},
-std::array<float,2>{0.875824988f, 0.731478035f},
-std::array<float,2>{0.107158303f, 0.199779749f},
-std::array<float,2>{0.562526822f, 0.313720226f},
-std::array<float,2>{0.474366635f, 0.812615395f},
-std::array<float,2>{0.659470201f, 0.972058892f},
-std::array<float,2>{0.353008509f, 0.49194029f},
-std::array<float,2>{0.795252085f, 0.0358996801f},
-std::array<float,2>{0.176511317f, 0.554360032f},
-std::array<float,2>{0.501740634f, 0.616334438f},
-std::array<float,2>{0.399068713f, 0.117825322f},
-std::array<float,2>{0.944128335f, 0.408070058f},
-std::array<float,2>{0.0540597513f, 0.918607414f},
-std::array<float,2>{0.817386568f, 0.763177037f},
-std::array<float,2>{0.237252921f, 0.25429672f},
-std::array<float,2>{0.740013659f, 0.187434956f},
-std::array<float,2>{0.252694249f, 0.630083084f},
-std::array<float,2>{0.957723558f, 0.565968573f},
-std::array<float,2>{0.0452831723f, 0.0916962996f},
-std::array<float,2>{0.518210113f, 0.382044733f},
-std::array<float,2>{0.382602453f, 0.880795717f},
-std::array<float,2>{0.719334841f, 0.802527666f},
-std::array<float,2>{0.278201044f, 0.29029575f},
-std::array<float,2>{0.832861781f, 0.151025712f},
-std::array<float,2>{0.234255031f, 0.678128481f},
-std::array<float,2>{0.587479293f, 0.701720953f},
-std::array<float,2>{0.485033423f, 0.227567598f},
-std::array<float,2>{0.89145714f, 0.346101761f},
-std::array<float,2>{0.117422111f, 0.845285118f},
-std::array<float,2>{0.806710839f, 0.964562178f},
-std::array<float,2>{0.167243734f, 0.447754174f},
-std::array<float,2>{0.680199087f, 0.0059557464f},
-std::array<float,2>{0.367556304f, 0.510982156f},
-std::array<float,2>{0.855146587f, 0.641148567f},
-std::array<float,2>{0.190596759f, 0.166993409f},
-std::array<float,2>{0.688410342f, 0.272166371f},
-std::array<float,2>{0.30316627f, 0.766885281f},
-std::array<float,2>{0.558490872f, 0.928758621f},
-std::array<float,2>{0.407357156f, 0.423495829f},
-std::array<float,2>{0.987364769f, 0.103557862f},
-std::array<float,2>{0.0112413699f, 0.598133981f},
-std::array<float,2>{0.637625515f, 0.538308322f},
-std::array<float,2>{0.331341922f, 0.051063247f},
-std::array<float,2>{0.76854974f, 0.471824676f},
-std::array<float,2>{0.144282833f, 0.994563937f},
-std::array<float,2>{0.921027064f, 0.836198568f},
-std::array<float,2>{0.0832879692f, 0.339952469f},
-std::array<float,2>{0.619425178f, 0.20699662f},
-std::array<float,2>{0.442857593f, 0.746384263f},
-std::array<float,2>{0.85950011f, 0.540539205f},
-std::array<float,2>{0.20668523f, 0.0568559319f},
-std::array<float,2>{0.709132731f, 0.477972835f},
-std::array<float,2>{0.287663341f, 0.986174107f},
-std::array<float,2>{0.54536283f, 0.830109894f},
-std::array<float,2>{0.432094753f, 0.332147539f},
-std::array<float,2>{0.982986152f, 0.211413726f},
-std::array<float,2>{0.0254001413f, 0.736242115f},
-std::array<float,2>{0.651710331f, 0.650118709f},
-std::array<float,2>{0.326874614f, 0.161747679f},
-std::array<float,2>{0.761999011f, 0.275824189f},
-std::array<float,2>{0.136254475f, 0.777576268f},
-std::array<float,2>{0.927889824f, 0.93351382f},
-std::array<float,2>{0.0692474768f, 0.432400286f},
-std::array<float,2>{0.600937247f, 0.101221628f},
-std::array<float,2>{0.455913812f, 0.607347786f},
-std::array<float,2>{0.939066589f, 0.687732518f},
-std::array<float,2>{0.0471561477f, 0.219294831f},
-std::array<float,2>{0.505043626f, 0.353015929f},
-std::array<float,2>{0.404494733f, 0.853848994f},
-std::array<float,2>{0.736570477f, 0.959794283f},
-std::array<float,2>{0.256905228f, 0.439857185f},
-std::array<float,2>{0.816071987f, 0.00906087551f},
-std::array<float,2>{0.238520294f, 0.504229128f},
-std::array<float,2>{0.568202257f, 0.574059665f},
-std::array<float,2>{0.472181976f, 0.0815191194f},
-std::array<float,2>{0.880828202f, 0.389128327f},
-std::array<float,2>{0.103331894f, 0.885679185f},
-std::array<float,2>{0.789777517f, 0.810197651f},
-std::array<float,2>{0.172032222f, 0.287745088f},
-std::array<float,2>{0.660899758f, 0.148048833f},
-std::array<float,2>{0.356082886f, 0.686594725f},
-std::array<float,2>{0.897886932f, 0.619563401f},
-std::array<float,2>{0.121131644f, 0.111686155f},
-std::array<float,2>{0.591283023f, 0.416145265f},
-std::array<float,2>{0.489884615f, 0.909997106f},
-std::array<float,2>{0.687147796f, 0.756654441f},
-std::array<float,2>{0.374466509f, 0.262791336f},
-std::array<float,2>{0.811205447f, 0.174037918f},
-std::array<float,2>{0.16947715f, 0.639252424f},
-std::array<float,2>{0.523417294f, 0.721381009f},
-std::array<float,2>{0.37636295f, 0.190301254f},
-std::array<float,2>{0.95481199f, 0.324107051f},
-std::array<float,2>{0.0422294289f, 0.824331164f},
-std::array<float,2>{0.830871463f, 0.979186416f},
-std::array<float,2>{0.229122028f, 0.4973571f},
-std::array<float,2>{0.725313365f, 0.0441411771f},
-std::array<float,2>{0.274328113f, 0.556781888f},
-std::array<float,2>{0.772213876f, 0.664502501f},
-std::array<float,2>{0.147488788f, 0.128814429f},
-std::array<float,2>{0.635098934f, 0.303965569f},
-std::array<float,2>{0.332770526f, 0.786733687f},
-std::array<float,2>{0.623296738f, 0.89121598f},
-std::array<float,2>{0.440162033f, 0.402500957f},
-std::array<float,2>{0.914330244f, 0.0677001774f},
-std::array<float,2>{0.0792542398f, 0.583935082f},
-std::array<float,2>{0.693103671f, 0.516448021f},
-std::array<float,2>{0.298023194f, 0.031013282f},
-std::array<float,2>{0.859047771f, 0.465061486f},
-std::array<float,2>{0.19169803f, 0.952766716f},
-std::array<float,2>{0.990140617f, 0.867044568f},
-std::array<float,2>{0.0151785593f, 0.365970254f},
-std::array<float,2>{0.559671819f, 0.24906826f},
-std::array<float,2>{0.410266012f, 0.708651781f},
-std::array<float,2>{0.803955495f, 0.587261856f},
-std::array<float,2>{0.156502694f, 0.0752814636f},
-std::array<float,2>{0.672496915f, 0.390660793f},
-std::array<float,2>{0.364403456f, 0.905659378f},
-std::array<float,2>{0.582576334f, 0.794092715f},
-std::array<float,2>{0.498973876f, 0.311498791f},
-std::array<float,2>{0.903508663f, 0.137965038f},
-std::array<float,2>{0.112901852f, 0.662976563f},
-std::array<float,2>{0.732645869f, 0.714753449f},
-std::array<float,2>{0.270582139f, 0.23449187f},
-std::array<float,2>{0.836555123f, 0.37325567f},
-std::array<float,2>{0.222852856f, 0.871938884f},
-std::array<float,2>{0.965782106f, 0.944024682f},
-std::array<float,2>{0.0373272672f, 0.45420599f},
-std::array<float,2>{0.526955724f, 0.0228631869f},
-std::array<float,2>{0.386265755f, 0.526691854f},
-std::array<float,2>{0.910644412f, 0.625741839f},
-std::array<float,2>{0.0934220925f, 0.182120264f},
-std::array<float,2>{0.613163829f, 0.251585007f},
-std::array<float,2>{0.451524734f, 0.758436918f},
-std::array<float,2>{0.632776797f, 0.914251745f},
-std::array<float,2>{0.339069963f, 0.410231531f},
-std::array<float,2>{0.78085196f, 0.124143273f},
-std::array<float,2>{0.151532471f, 0.612976134f},
-std::array<float,2>{0.550367653f, 0.548413277f},
-std::array<float,2>{0.417546839f, 0.0337993018f},
-std::array<float,2>{0.999974728f, 0.484635264f},
-std::array<float,2>{0.00181733025f, 0.974911332f},
-std::array<float,2>{0.848460793f, 0.816571832f},
-std::array<float,2>{0.199000701f, 0.31950739f},
-std::array<float,2>{0.699970424f, 0.198305786f},
-std::array<float,2>{0.311085463f, 0.729591191f},
-std::array<float,2>{0.972956121f, 0.515317202f},
-std::array<float,2>{0.0230535343f, 0.00128980493f},
-std::array<float,2>{0.533385634f, 0.450137734f},
-std::array<float,2>{0.427221417f, 0.966644406f},
-std::array<float,2>{0.718698442f, 0.848043203f},
-std::array<float,2>{0.291829616f, 0.349904627f},
-std::array<float,2>{0.869078219f, 0.233589232f},
-std::array<float,2>{0.214706212f, 0.697466969f},
-std::array<float,2>{0.60874927f, 0.672819436f},
-std::array<float,2>{0.461830795f, 0.155837923f},
-std::array<float,2>{0.936917424f, 0.293494433f},
-std::array<float,2>{0.0747753382f, 0.797590792f},
-std::array<float,2>{0.75121069f, 0.877911091f},
-std::array<float,2>{0.125342146f, 0.377691954f},
-std::array<float,2>{0.646190047f, 0.0883842185f},
-std::array<float,2>{0.317409605f, 0.568926394f},
-std::array<float,2>{0.826484621f, 0.745590568f},
-std::array<float,2>{0.249721974f, 0.210377008f},
-std::array<float,2>{0.749441624f, 0.336353987f},
-std::array<float,2>{0.258758515f, 0.843599617f},
-std::array<float,2>{0.511312664f, 0.997711897f},
-std::array<float,2>{0.396377206f, 0.47544992f},
-std::array<float,2>{0.94661355f, 0.0488501638f},
-std::array<float,2>{0.0617736354f, 0.532397509f},
-std::array<float,2>{0.668454885f, 0.594064236f},
-std::array<float,2>{0.348630279f, 0.106040604f},
-std::array<float,2>{0.784746349f, 0.427653849f},
-std::array<float,2>{0.183763549f, 0.922245264f},
-std::array<float,2>{0.884066403f, 0.772007704f},
-std::array<float,2>{0.0985946506f, 0.265797377f},
-std::array<float,2>{0.577360988f, 0.168677747f},
-std::array<float,2>{0.483342409f, 0.645125628f},
-std::array<float,2>{0.814608276f, 0.571948469f},
-std::array<float,2>{0.239548936f, 0.0792363435f},
-std::array<float,2>{0.737520397f, 0.386838883f},
-std::array<float,2>{0.25664556f, 0.884566188f},
-std::array<float,2>{0.503921032f, 0.811167955f},
-std::array<float,2>{0.405778527f, 0.286731452f},
-std::array<float,2>{0.93780005f, 0.146398097f},
-std::array<float,2>{0.0480473153f, 0.684402347f},
-std::array<float,2>{0.661950052f, 0.690955877f},
-std::array<float,2>{0.357153267f, 0.221110329f},
-std::array<float,2>{0.790560424f, 0.354433239f},
-std::array<float,2>{0.173204035f, 0.853061855f},
-std::array<float,2>{0.879390478f, 0.95791775f},
-std::array<float,2>{0.102310166f, 0.438250244f},
-std::array<float,2>{0.566708446f, 0.0115412949f},
-std::array<float,2>{0.470830172f, 0.506815135f},
-std::array<float,2>{0.984031379f, 0.651190639f},
-std::array<float,2>{0.0269334167f, 0.162543595f},
-std::array<float,2>{0.546643555f, 0.274746776f},
-std::array<float,2>{0.433567017f, 0.780915618f},
-std::array<float,2>{0.710460603f, 0.930344462f},
-std::array<float,2>{0.288255095f, 0.431106597f},
-std::array<float,2>{0.860878885f, 0.0990565941f},
-std::array<float,2>{0.205106288f, 0.608732998f},
-std::array<float,2>{0.600575984f, 0.54274404f},
-std::array<float,2>{0.456611782f, 0.0565418564f},
-std::array<float,2>{0.928975821f, 0.478842735f},
-std::array<float,2>{0.0696501732f, 0.987307429f},
-std::array<float,2>{0.763231754f, 0.829075038f},
-std::array<float,2>{0.135045409f, 0.334985435f},
-std::array<float,2>{0.651354074f, 0.214756414f},
-std::array<float,2>{0.328085065f, 0.737897277f},
-std::array<float,2>{0.915913105f, 0.518674612f},
-std::array<float,2>{0.0785369202f, 0.0287632439f},
-std::array<float,2>{0.624829531f, 0.467532128f},
-std::array<float,2>{0.440976888f, 0.949862838f},
-std::array<float,2>{0.636225462f, 0.864059091f},
-std::array<float,2>{0.333705425f, 0.364981771f},
-std::array<float,2>{0.773326576f, 0.247434586f},
-std::array<float,2>{0.146578401f, 0.71018213f},
-std::array<float,2>{0.559292376f, 0.666744292f},
-std::array<float,2>{0.411143929f, 0.125551611f},
-std::array<float,2>{0.988591552f, 0.301036716f},
-std::array<float,2>{0.013949086f, 0.787923753f},
-std::array<float,2>{0.85836184f, 0.894275963f},
-std::array<float,2>{0.192523733f, 0.405977726f},
-std::array<float,2>{0.691700339f, 0.0698086023f},
-std::array<float,2>{0.296994895f, 0.585685551f},
-std::array<float,2>{0.812415481f, 0.719660282f},
-std::array<float,2>{0.168499202f, 0.188502118f},
-std::array<float,2>{0.685637236f, 0.320694983f},
-std::array<float,2>{0.373396993f, 0.828006923f},
-std::array<float,2>{0.590183556f, 0.976921499f},
-std::array<float,2>{0.489113003f, 0.499147326f},
-std::array<float,2>{0.897385299f, 0.0451659933f},
-std::array<float,2>{0.122322768f, 0.55545783f},
-std::array<float,2>{0.725916266f, 0.618530333f},
-std::array<float,2>{0.274545491f, 0.109922744f},
-std::array<float,2>{0.831652164f, 0.414932042f},
-std::array<float,2>{0.230383217f, 0.907691181f},
-std::array<float,2>{0.953755021f, 0.75563103f},
-std::array<float,2>{0.0416769683f, 0.263982475f},
-std::array<float,2>{0.521963894f, 0.172624677f},
-std::array<float,2>{0.375718564f, 0.63813591f},
-std::array<float,2>{0.779336631f, 0.550490558f},
-std::array<float,2>{0.150589511f, 0.0328354612f},
-std::array<float,2>{0.631184042f, 0.487808138f},
-std::array<float,2>{0.337924331f, 0.973173201f},
-std::array<float,2>{0.612072706f, 0.820131183f},
-std::array<float,2>{0.452936321f, 0.317440122f},
-std::array<float,2>{0.911271632f, 0.19634971f},
-std::array<float,2>{0.0920439512f, 0.727804303f},
-std::array<float,2>{0.700233817f, 0.627394378f},
-std::array<float,2>{0.312138438f, 0.181097418f},
-std::array<float,2>{0.849425197f, 0.252409458f},
-std::array<float,2>{0.197681606f, 0.761473596f},
-std::array<float,2>{0.998783052f, 0.916431189f},
-std::array<float,2>{0.000576678489f, 0.413138092f},
-std::array<float,2>{0.5493173f, 0.121292248f},
-std::array<float,2>{0.416426688f, 0.611010671f},
-std::array<float,2>{0.902711272f, 0.711073577f},
-std::array<float,2>{0.111586578f, 0.236661941f},
-std::array<float,2>{0.583786964f, 0.372958064f},
-std::array<float,2>{0.499997735f, 0.873990357f},
-std::array<float,2>{0.673810482f, 0.941475511f},
-std::array<float,2>{0.363675475f, 0.455433875f},
-std::array<float,2>{0.803358376f, 0.0202584863f},
-std::array<float,2>{0.15726997f, 0.523651302f},
-std::array<float,2>{0.525631547f, 0.589069068f},
-std::array<float,2>{0.385461867f, 0.076580599f},
-std::array<float,2>{0.966395438f, 0.394310832f},
-std::array<float,2>{0.0387981422f, 0.902869701f},
-std::array<float,2>{0.837018907f, 0.794936895f},
-std::array<float,2>{0.22429572f, 0.310132444f},
-std::array<float,2>{0.733961284f, 0.140448555f},
-std::array<float,2>{0.269657671f, 0.660694182f},
-std::array<float,2>{0.946008027f, 0.59751749f},
-std::array<float,2>{0.0608525164f, 0.10817939f},
-std::array<float,2>{0.509997666f, 0.429168522f},
-std::array<float,2>{0.395058602f, 0.925368309f},
-std::array<float,2>{0.748911381f, 0.771379888f},
-std::array<float,2>{0.259305537f, 0.267601997f},
-std::array<float,2>{0.827177286f, 0.170780972f},
-std::array<float,2>{0.248801634f, 0.647809744f},
-std::array<float,2>{0.576639116f, 0.742848516f},
-std::array<float,2>{0.484140396f, 0.208405212f},
-std::array<float,2>{0.883152127f, 0.337909758f},
-std::array<float,2>{0.0986858532f, 0.839927554f},
-std::array<float,2>{0.78342104f, 0.999363005f},
-std::array<float,2>{0.185335144f, 0.473875344f},
-std::array<float,2>{0.66979605f, 0.0485301726f},
-std::array<float,2>{0.348836869f, 0.534914553f},
-std::array<float,2>{0.867382705f, 0.674475431f},
-std::array<float,2>{0.212960199f, 0.153260171f},
-std::array<float,2>{0.717522919f, 0.296211392f},
-std::array<float,2>{0.292720705f, 0.799027801f},
-std::array<float,2>{0.534493983f, 0.875514984f},
-std::array<float,2>{0.425958842f, 0.375495285f},
-std::array<float,2>{0.973932564f, 0.0877311155f},
-std::array<float,2>{0.0216337703f, 0.568153322f},
-std::array<float,2>{0.644805551f, 0.512688279f},
-std::array<float,2>{0.31680876f, 0.00387454033f},
-std::array<float,2>{0.750831187f, 0.452250779f},
-std::array<float,2>{0.126221582f, 0.968569517f},
-std::array<float,2>{0.935991049f, 0.851233363f},
-std::array<float,2>{0.0753636286f, 0.347737521f},
-std::array<float,2>{0.607681394f, 0.23075819f},
-std::array<float,2>{0.46276021f, 0.695749998f},
-std::array<float,2>{0.845410228f, 0.50123775f},
-std::array<float,2>{0.199452192f, 0.0152166719f},
-std::array<float,2>{0.698069274f, 0.442289084f},
-std::array<float,2>{0.304773659f, 0.95641005f},
-std::array<float,2>{0.553093433f, 0.85745424f},
-std::array<float,2>{0.420567602f, 0.358420134f},
-std::array<float,2>{0.99578923f, 0.225367561f},
-std::array<float,2>{0.00755336741f, 0.693082273f},
-std::array<float,2>{0.62613833f, 0.680947602f},
-std::array<float,2>{0.342265129f, 0.144114912f},
-std::array<float,2>{0.776495278f, 0.281606078f},
-std::array<float,2>{0.15607737f, 0.808419466f},
-std::array<float,2>{0.906365335f, 0.887015343f},
-std::array<float,2>{0.086763531f, 0.384073824f},
-std::array<float,2>{0.617053747f, 0.0825343877f},
-std::array<float,2>{0.448463321f, 0.575099111f},
-std::array<float,2>{0.961801946f, 0.73879379f},
-std::array<float,2>{0.0350434221f, 0.215391859f},
-std::array<float,2>{0.527763724f, 0.331722409f},
-std::array<float,2>{0.389335841f, 0.835382402f},
-std::array<float,2>{0.726878226f, 0.989150822f},
-std::array<float,2>{0.26946345f, 0.482876897f},
-std::array<float,2>{0.840896368f, 0.0615857095f},
-std::array<float,2>{0.222618818f, 0.545360029f},
-std::array<float,2>{0.581997752f, 0.604710519f},
-std::array<float,2>{0.495229125f, 0.0947850868f},
-std::array<float,2>{0.899442554f, 0.436835408f},
-std::array<float,2>{0.113434181f, 0.937116265f},
-std::array<float,2>{0.797869623f, 0.776393235f},
-std::array<float,2>{0.162916809f, 0.278056741f},
-std::array<float,2>{0.67961514f, 0.157432005f},
-std::array<float,2>{0.36316821f, 0.655121267f},
-std::array<float,2>{0.888400555f, 0.578847766f},
-std::array<float,2>{0.0943943113f, 0.0639854819f},
-std::array<float,2>{0.572501123f, 0.399451226f},
-std::array<float,2>{0.477214158f, 0.895687699f},
-std::array<float,2>{0.667786956f, 0.78474921f},
-std::array<float,2>{0.343959212f, 0.299604535f},
-std::array<float,2>{0.787113786f, 0.130689159f},
-std::array<float,2>{0.180066854f, 0.670357764f},
-std::array<float,2>{0.515377939f, 0.70344317f},
-std::array<float,2>{0.390850395f, 0.244201034f},
-std::array<float,2>{0.950387955f, 0.362333f},
-std::array<float,2>{0.0568531118f, 0.859569371f},
-std::array<float,2>{0.822374165f, 0.949168861f},
-std::array<float,2>{0.245588005f, 0.461877257f},
-std::array<float,2>{0.744824946f, 0.0270836167f},
-std::array<float,2>{0.26386252f, 0.52288264f},
-std::array<float,2>{0.756687582f, 0.634759247f},
-std::array<float,2>{0.131480694f, 0.176263034f},
-std::array<float,2>{0.642110825f, 0.258719742f},
-std::array<float,2>{0.312809527f, 0.751303971f},
-std::array<float,2>{0.604203641f, 0.912537813f},
-std::array<float,2>{0.465826571f, 0.420173436f},
-std::array<float,2>{0.932522476f, 0.117002666f},
-std::array<float,2>{0.0731296539f, 0.624894321f},
-std::array<float,2>{0.71399653f, 0.55953902f},
-std::array<float,2>{0.295020342f, 0.0406827815f},
-std::array<float,2>{0.872318804f, 0.493122905f},
-std::array<float,2>{0.217881888f, 0.9806512f},
-std::array<float,2>{0.972404063f, 0.823249936f},
-std::array<float,2>{0.0181603879f, 0.327780426f},
-std::array<float,2>{0.537750542f, 0.193739548f},
-std::array<float,2>{0.424582005f, 0.723757982f},
-std::array<float,2>{0.796817243f, 0.614644229f},
-std::array<float,2>{0.177528694f, 0.119526558f},
-std::array<float,2>{0.659025192f, 0.409309179f},
-std::array<float,2>{0.351750642f, 0.920663595f},
-std::array<float,2>{0.563798964f, 0.764936686f},
-std::array<float,2>{0.473478824f, 0.255901068f},
-std::array<float,2>{0.876318276f, 0.185194358f},
-std::array<float,2>{0.105665296f, 0.631936193f},
-std::array<float,2>{0.738898456f, 0.732875884f},
-std::array<float,2>{0.253667086f, 0.20196937f},
-std::array<float,2>{0.817051589f, 0.316031784f},
-std::array<float,2>{0.237474814f, 0.815279722f},
-std::array<float,2>{0.944559693f, 0.968915641f},
-std::array<float,2>{0.0528931655f, 0.488750488f},
-std::array<float,2>{0.500190675f, 0.0379249081f},
-std::array<float,2>{0.400222093f, 0.552313566f},
-std::array<float,2>{0.922068298f, 0.658636332f},
-std::array<float,2>{0.0630342513f, 0.134820074f},
-std::array<float,2>{0.596288264f, 0.306799859f},
-std::array<float,2>{0.458155155f, 0.789116323f},
-std::array<float,2>{0.655638158f, 0.899828613f},
-std::array<float,2>{0.321210891f, 0.39756462f},
-std::array<float,2>{0.76051116f, 0.0737467632f},
-std::array<float,2>{0.137272805f, 0.592552781f},
-std::array<float,2>{0.540704966f, 0.530106962f},
-std::array<float,2>{0.434624672f, 0.0165461283f},
-std::array<float,2>{0.98028636f, 0.458935291f},
-std::array<float,2>{0.0310458951f, 0.937797189f},
-std::array<float,2>{0.866188228f, 0.870967746f},
-std::array<float,2>{0.210111886f, 0.367637455f},
-std::array<float,2>{0.705682397f, 0.238489687f},
-std::array<float,2>{0.285077512f, 0.718669236f},
-std::array<float,2>{0.986757576f, 0.535855472f},
-std::array<float,2>{0.0105139203f, 0.0530662835f},
-std::array<float,2>{0.557267249f, 0.469150573f},
-std::array<float,2>{0.406261176f, 0.992254734f},
-std::array<float,2>{0.688967347f, 0.838496089f},
-std::array<float,2>{0.30430007f, 0.343070179f},
-std::array<float,2>{0.854175866f, 0.204509869f},
-std::array<float,2>{0.189783677f, 0.748998046f},
-std::array<float,2>{0.621058345f, 0.643744767f},
-std::array<float,2>{0.442291021f, 0.164587453f},
-std::array<float,2>{0.920757174f, 0.270347476f},
-std::array<float,2>{0.0823134854f, 0.769122481f},
-std::array<float,2>{0.768990755f, 0.926196694f},
-std::array<float,2>{0.1427176f, 0.424380124f},
-std::array<float,2>{0.637993515f, 0.101643883f},
-std::array<float,2>{0.330295652f, 0.599888563f},
-std::array<float,2>{0.83338052f, 0.699282527f},
-std::array<float,2>{0.232435882f, 0.229412258f},
-std::array<float,2>{0.720231116f, 0.344384372f},
-std::array<float,2>{0.278337479f, 0.845920861f},
-std::array<float,2>{0.518919647f, 0.96268028f},
-std::array<float,2>{0.381558985f, 0.44717136f},
-std::array<float,2>{0.958356619f, 0.00491593406f},
-std::array<float,2>{0.0466482006f, 0.509635866f},
-std::array<float,2>{0.681513608f, 0.5636518f},
-std::array<float,2>{0.368765146f, 0.0932065472f},
-std::array<float,2>{0.808564246f, 0.379823089f},
-std::array<float,2>{0.166766405f, 0.881296158f},
-std::array<float,2>{0.891768277f, 0.804511786f},
-std::array<float,2>{0.118952438f, 0.291143864f},
-std::array<float,2>{0.586768985f, 0.149573892f},
-std::array<float,2>{0.485762805f, 0.677697539f},
-std::array<float,2>{0.861716151f, 0.60707587f},
-std::array<float,2>{0.204552338f, 0.101425409f},
-std::array<float,2>{0.708261549f, 0.43216446f},
-std::array<float,2>{0.285623431f, 0.933130264f},
-std::array<float,2>{0.544708729f, 0.777598262f},
-std::array<float,2>{0.43149218f, 0.275544673f},
-std::array<float,2>{0.98191309f, 0.162035733f},
-std::array<float,2>{0.0238060523f, 0.650341034f},
-std::array<float,2>{0.648714125f, 0.736062288f},
-std::array<float,2>{0.325793892f, 0.210960791f},
-std::array<float,2>{0.764436662f, 0.332339585f},
-std::array<float,2>{0.133878693f, 0.830491066f},
-std::array<float,2>{0.926628172f, 0.985978901f},
-std::array<float,2>{0.0678125843f, 0.477561474f},
-std::array<float,2>{0.598406971f, 0.0570213348f},
-std::array<float,2>{0.453921974f, 0.541003227f},
-std::array<float,2>{0.939708233f, 0.686815262f},
-std::array<float,2>{0.0490492582f, 0.14837715f},
-std::array<float,2>{0.50738126f, 0.287977278f},
-std::array<float,2>{0.403455228f, 0.810304165f},
-std::array<float,2>{0.734771907f, 0.885329127f},
-std::array<float,2>{0.254696369f, 0.388709843f},
-std::array<float,2>{0.813811004f, 0.0812214389f},
-std::array<float,2>{0.241993397f, 0.573827088f},
-std::array<float,2>{0.569161236f, 0.503925323f},
-std::array<float,2>{0.470035613f, 0.00891682785f},
-std::array<float,2>{0.881761432f, 0.439680308f},
-std::array<float,2>{0.105359942f, 0.959564626f},
-std::array<float,2>{0.792448401f, 0.853747427f},
-std::array<float,2>{0.175033033f, 0.352583438f},
-std::array<float,2>{0.663153529f, 0.219688162f},
-std::array<float,2>{0.358023465f, 0.687931836f},
-std::array<float,2>{0.896340132f, 0.556928992f},
-std::array<float,2>{0.123990096f, 0.044409126f},
-std::array<float,2>{0.592702806f, 0.497226f},
-std::array<float,2>{0.491892904f, 0.979333699f},
-std::array<float,2>{0.683647156f, 0.824654102f},
-std::array<float,2>{0.371878922f, 0.323973387f},
-std::array<float,2>{0.809534252f, 0.189954892f},
-std::array<float,2>{0.17068322f, 0.721570551f},
-std::array<float,2>{0.520729959f, 0.639595628f},
-std::array<float,2>{0.378667891f, 0.174166813f},
-std::array<float,2>{0.956368506f, 0.263003021f},
-std::array<float,2>{0.0395269804f, 0.756442726f},
-std::array<float,2>{0.828510344f, 0.909897923f},
-std::array<float,2>{0.227332056f, 0.416342348f},
-std::array<float,2>{0.722707212f, 0.11138314f},
-std::array<float,2>{0.27692166f, 0.619249642f},
-std::array<float,2>{0.771258414f, 0.708856702f},
-std::array<float,2>{0.14536269f, 0.249334484f},
-std::array<float,2>{0.633221686f, 0.365854651f},
-std::array<float,2>{0.335077435f, 0.866776288f},
-std::array<float,2>{0.621688724f, 0.952947259f},
-std::array<float,2>{0.437838942f, 0.465111077f},
-std::array<float,2>{0.91659373f, 0.0309767369f},
-std::array<float,2>{0.0815452635f, 0.516267359f},
-std::array<float,2>{0.695128858f, 0.583556056f},
-std::array<float,2>{0.299048662f, 0.0675398856f},
-std::array<float,2>{0.857379556f, 0.402594686f},
-std::array<float,2>{0.194262162f, 0.891537488f},
-std::array<float,2>{0.990478098f, 0.787076831f},
-std::array<float,2>{0.0117317075f, 0.303946644f},
-std::array<float,2>{0.562403321f, 0.1284495f},
-std::array<float,2>{0.413174421f, 0.664161265f},
-std::array<float,2>{0.801322877f, 0.526535869f},
-std::array<float,2>{0.159643903f, 0.0225842986f},
-std::array<float,2>{0.674197912f, 0.454471171f},
-std::array<float,2>{0.367002845f, 0.944278359f},
-std::array<float,2>{0.584243953f, 0.871705353f},
-std::array<float,2>{0.497078598f, 0.373512089f},
-std::array<float,2>{0.904904425f, 0.234677747f},
-std::array<float,2>{0.109698534f, 0.714511633f},
-std::array<float,2>{0.731008768f, 0.66272068f},
-std::array<float,2>{0.272149265f, 0.137770981f},
-std::array<float,2>{0.839079022f, 0.311069161f},
-std::array<float,2>{0.224995583f, 0.794216216f},
-std::array<float,2>{0.967847705f, 0.905495644f},
-std::array<float,2>{0.036741998f, 0.390875012f},
-std::array<float,2>{0.525324881f, 0.075533621f},
-std::array<float,2>{0.383066803f, 0.586999357f},
-std::array<float,2>{0.913682044f, 0.729964554f},
-std::array<float,2>{0.0899416283f, 0.198726922f},
-std::array<float,2>{0.610267997f, 0.319792122f},
-std::array<float,2>{0.451170176f, 0.81665355f},
-std::array<float,2>{0.630274713f, 0.974750578f},
-std::array<float,2>{0.336162299f, 0.484459758f},
-std::array<float,2>{0.778198004f, 0.0339513347f},
-std::array<float,2>{0.149553552f, 0.548745096f},
-std::array<float,2>{0.547761381f, 0.613236785f},
-std::array<float,2>{0.414785624f, 0.124352351f},
-std::array<float,2>{0.996217012f, 0.410506785f},
-std::array<float,2>{0.0022682948f, 0.914523363f},
-std::array<float,2>{0.851439297f, 0.758686781f},
-std::array<float,2>{0.19663845f, 0.251918137f},
-std::array<float,2>{0.702780247f, 0.18183504f},
-std::array<float,2>{0.310292572f, 0.625729084f},
-std::array<float,2>{0.97580874f, 0.569114745f},
-std::array<float,2>{0.0200012773f, 0.0886643305f},
-std::array<float,2>{0.531378329f, 0.377639443f},
-std::array<float,2>{0.428140074f, 0.877533913f},
-std::array<float,2>{0.71486187f, 0.797819078f},
-std::array<float,2>{0.289350033f, 0.293939739f},
-std::array<float,2>{0.86979425f, 0.156249896f},
-std::array<float,2>{0.211352289f, 0.672548831f},
-std::array<float,2>{0.60609889f, 0.697592616f},
-std::array<float,2>{0.463957042f, 0.23365514f},
-std::array<float,2>{0.934062004f, 0.349646717f},
-std::array<float,2>{0.0773921981f, 0.84787178f},
-std::array<float,2>{0.752188444f, 0.966362655f},
-std::array<float,2>{0.127816737f, 0.449831903f},
-std::array<float,2>{0.646616817f, 0.00112069037f},
-std::array<float,2>{0.319447786f, 0.515479445f},
-std::array<float,2>{0.825490415f, 0.645366967f},
-std::array<float,2>{0.246765092f, 0.16890277f},
-std::array<float,2>{0.747055709f, 0.265980393f},
-std::array<float,2>{0.261483938f, 0.772335172f},
-std::array<float,2>{0.507912219f, 0.921893597f},
-std::array<float,2>{0.397953868f, 0.427415431f},
-std::array<float,2>{0.947527885f, 0.106349014f},
-std::array<float,2>{0.0594317429f, 0.593934059f},
-std::array<float,2>{0.671675205f, 0.532665551f},
-std::array<float,2>{0.349950582f, 0.0492279232f},
-std::array<float,2>{0.782735407f, 0.475241929f},
-std::array<float,2>{0.187074333f, 0.997944415f},
-std::array<float,2>{0.885227025f, 0.843391776f},
-std::array<float,2>{0.100091361f, 0.336068779f},
-std::array<float,2>{0.574594855f, 0.209967732f},
-std::array<float,2>{0.480953962f, 0.745140493f},
-std::array<float,2>{0.843696117f, 0.543169856f},
-std::array<float,2>{0.219796553f, 0.059616562f},
-std::array<float,2>{0.729705036f, 0.481248468f},
-std::array<float,2>{0.266883761f, 0.992159903f},
-std::array<float,2>{0.530372381f, 0.833481967f},
-std::array<float,2>{0.388048619f, 0.329916924f},
-std::array<float,2>{0.964784443f, 0.218722299f},
-std::array<float,2>{0.0312665887f, 0.741523623f},
-std::array<float,2>{0.676347196f, 0.654013336f},
-std::array<float,2>{0.360681862f, 0.15985617f},
-std::array<float,2>{0.800397098f, 0.279875755f},
-std::array<float,2>{0.160737872f, 0.773502111f},
-std::array<float,2>{0.901599824f, 0.933891833f},
-std::array<float,2>{0.115580507f, 0.433716863f},
-std::array<float,2>{0.578944564f, 0.0965947509f},
-std::array<float,2>{0.49371627f, 0.603304207f},
-std::array<float,2>{0.992619097f, 0.693543255f},
-std::array<float,2>{0.00506483531f, 0.223609284f},
-std::array<float,2>{0.551221073f, 0.35649851f},
-std::array<float,2>{0.418388397f, 0.856971443f},
-std::array<float,2>{0.696014702f, 0.954713225f},
-std::array<float,2>{0.307732403f, 0.444880068f},
-std::array<float,2>{0.84577626f, 0.0133985775f},
-std::array<float,2>{0.202667907f, 0.502454638f},
-std::array<float,2>{0.61514008f, 0.57810992f},
-std::array<float,2>{0.446417093f, 0.0846618563f},
-std::array<float,2>{0.908645868f, 0.386081249f},
-std::array<float,2>{0.0893198028f, 0.889311731f},
-std::array<float,2>{0.774035573f, 0.8051278f},
-std::array<float,2>{0.153942823f, 0.284443915f},
-std::array<float,2>{0.627166212f, 0.141063228f},
-std::array<float,2>{0.340895712f, 0.681701958f},
-std::array<float,2>{0.931525707f, 0.621403694f},
-std::array<float,2>{0.071738489f, 0.113364622f},
-std::array<float,2>{0.602919698f, 0.418183208f},
-std::array<float,2>{0.467601955f, 0.910837412f},
-std::array<float,2>{0.644329011f, 0.753693402f},
-std::array<float,2>{0.315394551f, 0.261671275f},
-std::array<float,2>{0.754169464f, 0.179477379f},
-std::array<float,2>{0.129716605f, 0.636432886f},
-std::array<float,2>{0.536865413f, 0.72629565f},
-std::array<float,2>{0.42201373f, 0.191409469f},
-std::array<float,2>{0.969684303f, 0.324435979f},
-std::array<float,2>{0.0157054961f, 0.820531309f},
-std::array<float,2>{0.87413305f, 0.983914852f},
-std::array<float,2>{0.216372967f, 0.495259464f},
-std::array<float,2>{0.712195098f, 0.0427387543f},
-std::array<float,2>{0.293474942f, 0.560906112f},
-std::array<float,2>{0.785986185f, 0.668355942f},
-std::array<float,2>{0.183435187f, 0.131516591f},
-std::array<float,2>{0.665830076f, 0.297795415f},
-std::array<float,2>{0.346747905f, 0.781894505f},
-std::array<float,2>{0.571714222f, 0.896649897f},
-std::array<float,2>{0.480290741f, 0.401836514f},
-std::array<float,2>{0.890428483f, 0.0660654753f},
-std::array<float,2>{0.0973074436f, 0.581311285f},
-std::array<float,2>{0.743782103f, 0.519661725f},
-std::array<float,2>{0.262643397f, 0.0244369041f},
-std::array<float,2>{0.820893228f, 0.464352012f},
-std::array<float,2>{0.242398635f, 0.945408463f},
-std::array<float,2>{0.951201379f, 0.861747146f},
-std::array<float,2>{0.0552508235f, 0.35976398f},
-std::array<float,2>{0.512851059f, 0.243824482f},
-std::array<float,2>{0.393116593f, 0.706626117f},
-std::array<float,2>{0.758238256f, 0.59070313f},
-std::array<float,2>{0.139458865f, 0.0716835484f},
-std::array<float,2>{0.653890312f, 0.395328045f},
-std::array<float,2>{0.323081076f, 0.900741339f},
-std::array<float,2>{0.594405711f, 0.791453421f},
-std::array<float,2>{0.460413992f, 0.305904031f},
-std::array<float,2>{0.925095975f, 0.133313f},
-std::array<float,2>{0.0647124425f, 0.656953037f},
-std::array<float,2>{0.703889549f, 0.715563059f},
-std::array<float,2>{0.281963766f, 0.241372719f},
-std::array<float,2>{0.864370525f, 0.370721459f},
-std::array<float,2>{0.208594114f, 0.867883742f},
-std::array<float,2>{0.976820171f, 0.940256953f},
-std::array<float,2>{0.0292799715f, 0.459376544f},
-std::array<float,2>{0.542490602f, 0.0184005313f},
-std::array<float,2>{0.436379731f, 0.528708518f},
-std::array<float,2>{0.878698468f, 0.630141437f},
-std::array<float,2>{0.107932344f, 0.18718037f},
-std::array<float,2>{0.565589249f, 0.254032135f},
-std::array<float,2>{0.474741548f, 0.762772858f},
-std::array<float,2>{0.657090366f, 0.918929338f},
-std::array<float,2>{0.354203254f, 0.407774806f},
-std::array<float,2>{0.794712007f, 0.11805328f},
-std::array<float,2>{0.178951219f, 0.61659199f},
-std::array<float,2>{0.50369972f, 0.554657042f},
-std::array<float,2>{0.401974887f, 0.0358295888f},
-std::array<float,2>{0.943074048f, 0.492132217f},
-std::array<float,2>{0.0514588244f, 0.971754074f},
-std::array<float,2>{0.8190943f, 0.81290251f},
-std::array<float,2>{0.235305876f, 0.31387049f},
-std::array<float,2>{0.741924644f, 0.200067431f},
-std::array<float,2>{0.250788301f, 0.731900811f},
-std::array<float,2>{0.960620403f, 0.511101604f},
-std::array<float,2>{0.0434920862f, 0.00615670858f},
-std::array<float,2>{0.517171502f, 0.448210239f},
-std::array<float,2>{0.380788416f, 0.964663744f},
-std::array<float,2>{0.721848011f, 0.84547174f},
-std::array<float,2>{0.280968219f, 0.345919222f},
-std::array<float,2>{0.834678411f, 0.227814078f},
-std::array<float,2>{0.232136384f, 0.702057242f},
-std::array<float,2>{0.587976038f, 0.677966177f},
-std::array<float,2>{0.488166839f, 0.151362538f},
-std::array<float,2>{0.893978894f, 0.290207833f},
-std::array<float,2>{0.119499356f, 0.802451432f},
-std::array<float,2>{0.80522275f, 0.88051939f},
-std::array<float,2>{0.165191397f, 0.382120162f},
-std::array<float,2>{0.682360053f, 0.0913753584f},
-std::array<float,2>{0.369648427f, 0.56616658f},
-std::array<float,2>{0.852805257f, 0.746217608f},
-std::array<float,2>{0.188801035f, 0.206784055f},
-std::array<float,2>{0.691038013f, 0.340315551f},
-std::array<float,2>{0.301676929f, 0.835991919f},
-std::array<float,2>{0.555047691f, 0.994331956f},
-std::array<float,2>{0.409971714f, 0.47195226f},
-std::array<float,2>{0.98453933f, 0.0509852283f},
-std::array<float,2>{0.00844964199f, 0.538400412f},
-std::array<float,2>{0.639672756f, 0.59780252f},
-std::array<float,2>{0.329875916f, 0.103934385f},
-std::array<float,2>{0.767132103f, 0.423702985f},
-std::array<float,2>{0.141837493f, 0.929077506f},
-std::array<float,2>{0.918192983f, 0.766661584f},
-std::array<float,2>{0.0852086172f, 0.272431642f},
-std::array<float,2>{0.618872881f, 0.167446002f},
-std::array<float,2>{0.445210576f, 0.64158392f},
-std::array<float,2>{0.855656326f, 0.584941983f},
-std::array<float,2>{0.194909647f, 0.0688203946f},
-std::array<float,2>{0.693379343f, 0.404467374f},
-std::array<float,2>{0.300486177f, 0.893113613f},
-std::array<float,2>{0.561253071f, 0.788191617f},
-std::array<float,2>{0.412997812f, 0.301847965f},
-std::array<float,2>{0.991684079f, 0.126374483f},
-std::array<float,2>{0.0127579952f, 0.667809129f},
-std::array<float,2>{0.634500563f, 0.709569156f},
-std::array<float,2>{0.334859461f, 0.24677664f},
-std::array<float,2>{0.770069897f, 0.364184111f},
-std::array<float,2>{0.145883426f, 0.864297509f},
-std::array<float,2>{0.917139769f, 0.950646222f},
-std::array<float,2>{0.0803674608f, 0.468013585f},
-std::array<float,2>{0.62251538f, 0.0273439866f},
-std::array<float,2>{0.439239144f, 0.518005908f},
-std::array<float,2>{0.955981731f, 0.637130201f},
-std::array<float,2>{0.0403991304f, 0.173583433f},
-std::array<float,2>{0.519666195f, 0.26533702f},
-std::array<float,2>{0.377481729f, 0.754211426f},
-std::array<float,2>{0.724139273f, 0.906448483f},
-std::array<float,2>{0.276168883f, 0.415913165f},
-std::array<float,2>{0.829250753f, 0.110354923f},
-std::array<float,2>{0.228435114f, 0.617619216f},
-std::array<float,2>{0.592945218f, 0.555847228f},
-std::array<float,2>{0.490275055f, 0.0459342152f},
-std::array<float,2>{0.89488256f, 0.498296529f},
-std::array<float,2>{0.124288045f, 0.977632523f},
-std::array<float,2>{0.809659243f, 0.82648474f},
-std::array<float,2>{0.171809584f, 0.321616679f},
-std::array<float,2>{0.684956372f, 0.187502667f},
-std::array<float,2>{0.372591317f, 0.720268905f},
-std::array<float,2>{0.882379353f, 0.50762254f},
-std::array<float,2>{0.103739664f, 0.00977412704f},
-std::array<float,2>{0.570111394f, 0.438959479f},
-std::array<float,2>{0.469671875f, 0.958295584f},
-std::array<float,2>{0.662773848f, 0.852322519f},
-std::array<float,2>{0.359336823f, 0.355106354f},
-std::array<float,2>{0.79182893f, 0.222331733f},
-std::array<float,2>{0.174705252f, 0.689785659f},
-std::array<float,2>{0.505950332f, 0.684775174f},
-std::array<float,2>{0.402371496f, 0.144869253f},
-std::array<float,2>{0.941182733f, 0.286100477f},
-std::array<float,2>{0.0502155237f, 0.8116166f},
-std::array<float,2>{0.812764287f, 0.88310647f},
-std::array<float,2>{0.24115549f, 0.388176054f},
-std::array<float,2>{0.735651195f, 0.0781982988f},
-std::array<float,2>{0.255186051f, 0.570754051f},
-std::array<float,2>{0.765585005f, 0.737028301f},
-std::array<float,2>{0.133344099f, 0.213364393f},
-std::array<float,2>{0.650352478f, 0.334597707f},
-std::array<float,2>{0.324949771f, 0.829693913f},
-std::array<float,2>{0.599033177f, 0.986568749f},
-std::array<float,2>{0.454824388f, 0.479749888f},
-std::array<float,2>{0.927359939f, 0.0555838421f},
-std::array<float,2>{0.0668632686f, 0.541350126f},
-std::array<float,2>{0.707870722f, 0.608385623f},
-std::array<float,2>{0.286199957f, 0.0980482474f},
-std::array<float,2>{0.863187969f, 0.429823995f},
-std::array<float,2>{0.203528032f, 0.93115437f},
-std::array<float,2>{0.980886877f, 0.779562831f},
-std::array<float,2>{0.0245847572f, 0.274280727f},
-std::array<float,2>{0.54303813f, 0.163578063f},
-std::array<float,2>{0.430373609f, 0.651645303f},
-std::array<float,2>{0.781678021f, 0.53350234f},
-std::array<float,2>{0.1858816f, 0.0469833352f},
-std::array<float,2>{0.670285046f, 0.473321855f},
-std::array<float,2>{0.350882322f, 0.99846679f},
-std::array<float,2>{0.576047063f, 0.841168344f},
-std::array<float,2>{0.482163429f, 0.338993281f},
-std::array<float,2>{0.885834038f, 0.207156837f},
-std::array<float,2>{0.100654945f, 0.743561029f},
-std::array<float,2>{0.74777025f, 0.647300541f},
-std::array<float,2>{0.259972483f, 0.171157002f},
-std::array<float,2>{0.825062811f, 0.26871857f},
-std::array<float,2>{0.247230634f, 0.770071566f},
-std::array<float,2>{0.948938847f, 0.924367666f},
-std::array<float,2>{0.0601759069f, 0.428462386f},
-std::array<float,2>{0.509205222f, 0.109058619f},
-std::array<float,2>{0.397201449f, 0.596285582f},
-std::array<float,2>{0.935031176f, 0.696503818f},
-std::array<float,2>{0.0763108209f, 0.232350454f},
-std::array<float,2>{0.60710758f, 0.349125803f},
-std::array<float,2>{0.463799596f, 0.849644005f},
-std::array<float,2>{0.648242891f, 0.967480242f},
-std::array<float,2>{0.318370134f, 0.45173955f},
-std::array<float,2>{0.753308892f, 0.00211578514f},
-std::array<float,2>{0.128238693f, 0.513073325f},
-std::array<float,2>{0.53267473f, 0.566663265f},
-std::array<float,2>{0.429363221f, 0.0860784277f},
-std::array<float,2>{0.975231051f, 0.37628302f},
-std::array<float,2>{0.0212045331f, 0.876051188f},
-std::array<float,2>{0.870934606f, 0.799980342f},
-std::array<float,2>{0.211920246f, 0.295093507f},
-std::array<float,2>{0.716087878f, 0.153727353f},
-std::array<float,2>{0.29053399f, 0.674857557f},
-std::array<float,2>{0.997405291f, 0.609990716f},
-std::array<float,2>{0.00310952216f, 0.122763924f},
-std::array<float,2>{0.548289001f, 0.412295222f},
-std::array<float,2>{0.415852755f, 0.917126656f},
-std::array<float,2>{0.701411307f, 0.76041466f},
-std::array<float,2>{0.309065044f, 0.253259867f},
-std::array<float,2>{0.850257218f, 0.180349022f},
-std::array<float,2>{0.195386678f, 0.62843883f},
-std::array<float,2>{0.610735595f, 0.726963043f},
-std::array<float,2>{0.450026274f, 0.196236864f},
-std::array<float,2>{0.912713528f, 0.317268342f},
-std::array<float,2>{0.0916165784f, 0.818764448f},
-std::array<float,2>{0.778673887f, 0.973904371f},
-std::array<float,2>{0.148938626f, 0.486860335f},
-std::array<float,2>{0.62979275f, 0.0319827907f},
-std::array<float,2>{0.337204427f, 0.549057722f},
-std::array<float,2>{0.838768184f, 0.661386669f},
-std::array<float,2>{0.226017594f, 0.139031634f},
-std::array<float,2>{0.731907964f, 0.308812559f},
-std::array<float,2>{0.273171753f, 0.796839237f},
-std::array<float,2>{0.52344048f, 0.903568208f},
-std::array<float,2>{0.383838743f, 0.39301753f},
-std::array<float,2>{0.967230797f, 0.077628918f},
-std::array<float,2>{0.0356304161f, 0.588189185f},
-std::array<float,2>{0.675351441f, 0.525027692f},
-std::array<float,2>{0.366078436f, 0.0206965674f},
-std::array<float,2>{0.801821113f, 0.456430256f},
-std::array<float,2>{0.158999681f, 0.94260633f},
-std::array<float,2>{0.905748487f, 0.874426842f},
-std::array<float,2>{0.110360429f, 0.371223122f},
-std::array<float,2>{0.585088015f, 0.237600565f},
-std::array<float,2>{0.49664396f, 0.712030411f},
-std::array<float,2>{0.822238088f, 0.522250116f},
-std::array<float,2>{0.243469805f, 0.0260015056f},
-std::array<float,2>{0.742375612f, 0.462396353f},
-std::array<float,2>{0.263453841f, 0.948194683f},
-std::array<float,2>{0.512155354f, 0.861162901f},
-std::array<float,2>{0.39442417f, 0.361930221f},
-std::array<float,2>{0.952784896f, 0.245611995f},
-std::array<float,2>{0.0562329181f, 0.704750359f},
-std::array<float,2>{0.664100885f, 0.671242416f},
-std::array<float,2>{0.346592367f, 0.129678234f},
-std::array<float,2>{0.787060499f, 0.300500154f},
-std::array<float,2>{0.181701198f, 0.783700287f},
-std::array<float,2>{0.888978124f, 0.894784927f},
-std::array<float,2>{0.0960865989f, 0.398770094f},
-std::array<float,2>{0.570841312f, 0.0626647547f},
-std::array<float,2>{0.479002267f, 0.579380214f},
-std::array<float,2>{0.970355392f, 0.723047614f},
-std::array<float,2>{0.0168091822f, 0.194588691f},
-std::array<float,2>{0.535317123f, 0.327035159f},
-std::array<float,2>{0.423500389f, 0.822768509f},
-std::array<float,2>{0.711829066f, 0.981975555f},
-std::array<float,2>{0.294454336f, 0.493539333f},
-std::array<float,2>{0.873263836f, 0.0393874496f},
-std::array<float,2>{0.215662435f, 0.559918821f},
-std::array<float,2>{0.601696312f, 0.623918653f},
-std::array<float,2>{0.468300223f, 0.115678251f},
-std::array<float,2>{0.930594802f, 0.421060264f},
-std::array<float,2>{0.070323661f, 0.913701892f},
-std::array<float,2>{0.755094826f, 0.750469744f},
-std::array<float,2>{0.130656093f, 0.258896381f},
-std::array<float,2>{0.643372297f, 0.176823199f},
-std::array<float,2>{0.315587252f, 0.632855773f},
-std::array<float,2>{0.909334183f, 0.57606405f},
-std::array<float,2>{0.0881668106f, 0.0831695423f},
-std::array<float,2>{0.613840044f, 0.383074254f},
-std::array<float,2>{0.44562307f, 0.888562024f},
-std::array<float,2>{0.628158271f, 0.806738436f},
-std::array<float,2>{0.34025833f, 0.28229633f},
-std::array<float,2>{0.774469137f, 0.143479332f},
-std::array<float,2>{0.15299508f, 0.680568755f},
-std::array<float,2>{0.552185059f, 0.692119777f},
-std::array<float,2>{0.419055492f, 0.226210952f},
-std::array<float,2>{0.993858278f, 0.357993811f},
-std::array<float,2>{0.00426291209f, 0.858523846f},
-std::array<float,2>{0.847352982f, 0.955791891f},
-std::array<float,2>{0.201457873f, 0.442880899f},
-std::array<float,2>{0.697009325f, 0.0137287546f},
-std::array<float,2>{0.306701332f, 0.500397742f},
-std::array<float,2>{0.798946202f, 0.655623019f},
-std::array<float,2>{0.162082419f, 0.156862542f},
-std::array<float,2>{0.676980436f, 0.278530657f},
-std::array<float,2>{0.359946489f, 0.776245594f},
-std::array<float,2>{0.579318702f, 0.935807288f},
-std::array<float,2>{0.492453039f, 0.435750693f},
-std::array<float,2>{0.90058136f, 0.0944878086f},
-std::array<float,2>{0.116987333f, 0.604286373f},
-std::array<float,2>{0.729212224f, 0.546639919f},
-std::array<float,2>{0.265975028f, 0.0614017136f},
-std::array<float,2>{0.842376828f, 0.484080106f},
-std::array<float,2>{0.219030231f, 0.989545703f},
-std::array<float,2>{0.963384092f, 0.834648371f},
-std::array<float,2>{0.0331099182f, 0.331030041f},
-std::array<float,2>{0.53019923f, 0.216165721f},
-std::array<float,2>{0.387653857f, 0.739469528f},
-std::array<float,2>{0.765644252f, 0.601309657f},
-std::array<float,2>{0.140957251f, 0.102823943f},
-std::array<float,2>{0.638717592f, 0.42550537f},
-std::array<float,2>{0.329095393f, 0.927261293f},
-std::array<float,2>{0.618039906f, 0.767997026f},
-std::array<float,2>{0.443638921f, 0.271334678f},
-std::array<float,2>{0.918948114f, 0.165641844f},
-std::array<float,2>{0.0840236992f, 0.643167853f},
-std::array<float,2>{0.689477861f, 0.74992758f},
-std::array<float,2>{0.302120358f, 0.203785911f},
-std::array<float,2>{0.852359474f, 0.342657954f},
-std::array<float,2>{0.187645718f, 0.839556992f},
-std::array<float,2>{0.986041248f, 0.993831217f},
-std::array<float,2>{0.00908898003f, 0.470642477f},
-std::array<float,2>{0.55657506f, 0.0539326929f},
-std::array<float,2>{0.408567846f, 0.536565602f},
-std::array<float,2>{0.893548965f, 0.6764943f},
-std::array<float,2>{0.120730415f, 0.149138406f},
-std::array<float,2>{0.589123785f, 0.292012244f},
-std::array<float,2>{0.486514509f, 0.803060353f},
-std::array<float,2>{0.68288058f, 0.882206559f},
-std::array<float,2>{0.370223939f, 0.379960388f},
-std::array<float,2>{0.805994093f, 0.092392832f},
-std::array<float,2>{0.164776474f, 0.563378453f},
-std::array<float,2>{0.515920401f, 0.508124173f},
-std::array<float,2>{0.379652202f, 0.00462774001f},
-std::array<float,2>{0.95913893f, 0.445369124f},
-std::array<float,2>{0.0444293506f, 0.960974455f},
-std::array<float,2>{0.835179806f, 0.846716285f},
-std::array<float,2>{0.230689824f, 0.3454099f},
-std::array<float,2>{0.721622169f, 0.230219722f},
-std::array<float,2>{0.279514968f, 0.700688541f},
-std::array<float,2>{0.941917598f, 0.551320612f},
-std::array<float,2>{0.0525136255f, 0.0389733724f},
-std::array<float,2>{0.502073348f, 0.48944822f},
-std::array<float,2>{0.401351154f, 0.970521688f},
-std::array<float,2>{0.741096616f, 0.815723062f},
-std::array<float,2>{0.251088381f, 0.315227211f},
-std::array<float,2>{0.820034862f, 0.202624425f},
-std::array<float,2>{0.235394791f, 0.734041929f},
-std::array<float,2>{0.565176964f, 0.631698191f},
-std::array<float,2>{0.47629562f, 0.184427172f},
-std::array<float,2>{0.877010882f, 0.257634968f},
-std::array<float,2>{0.109030254f, 0.764624238f},
-std::array<float,2>{0.793809712f, 0.921432436f},
-std::array<float,2>{0.178342342f, 0.40908739f},
-std::array<float,2>{0.658034086f, 0.120615758f},
-std::array<float,2>{0.355227828f, 0.613600731f},
-std::array<float,2>{0.863486767f, 0.716917276f},
-std::array<float,2>{0.207331866f, 0.239603519f},
-std::array<float,2>{0.704382539f, 0.368990958f},
-std::array<float,2>{0.282347888f, 0.86951369f},
-std::array<float,2>{0.541114509f, 0.938890338f},
-std::array<float,2>{0.436597198f, 0.457475603f},
-std::array<float,2>{0.977679253f, 0.0171295982f},
-std::array<float,2>{0.0281650648f, 0.531238556f},
-std::array<float,2>{0.653047144f, 0.593682289f},
-std::array<float,2>{0.324079633f, 0.0731827244f},
-std::array<float,2>{0.759339094f, 0.396547288f},
-std::array<float,2>{0.140158027f, 0.898454487f},
-std::array<float,2>{0.92447108f, 0.790364563f},
-std::array<float,2>{0.0663052276f, 0.308417112f},
-std::array<float,2>{0.595496535f, 0.136586845f},
-std::array<float,2>{0.459868878f, 0.660020232f},
-std::array<float,2>{0.83045274f, 0.62028712f},
-std::array<float,2>{0.228896439f, 0.113008514f},
-std::array<float,2>{0.725044549f, 0.417269915f},
-std::array<float,2>{0.27347368f, 0.908236027f},
-std::array<float,2>{0.52294457f, 0.75735563f},
-std::array<float,2>{0.376576602f, 0.262446165f},
-std::array<float,2>{0.954493225f, 0.175698787f},
-std::array<float,2>{0.042961698f, 0.639985025f},
-std::array<float,2>{0.68699646f, 0.722542107f},
-std::array<float,2>{0.374536335f, 0.190448016f},
-std::array<float,2>{0.810736358f, 0.323016167f},
-std::array<float,2>{0.169283718f, 0.825495601f},
-std::array<float,2>{0.898298323f, 0.98014766f},
-std::array<float,2>{0.121841751f, 0.496111155f},
-std::array<float,2>{0.591618776f, 0.0437937565f},
-std::array<float,2>{0.489596039f, 0.5585621f},
-std::array<float,2>{0.989460945f, 0.665600121f},
-std::array<float,2>{0.0148860635f, 0.127285182f},
-std::array<float,2>{0.560204804f, 0.302820951f},
-std::array<float,2>{0.410935611f, 0.785403013f},
-std::array<float,2>{0.692657232f, 0.891848683f},
-std::array<float,2>{0.298679084f, 0.403744757f},
-std::array<float,2>{0.85886991f, 0.0670061558f},
-std::array<float,2>{0.192141905f, 0.582069039f},
-std::array<float,2>{0.623851061f, 0.517273605f},
-std::array<float,2>{0.439804584f, 0.0300134346f},
-std::array<float,2>{0.914866984f, 0.465961397f},
-std::array<float,2>{0.079985179f, 0.951549053f},
-std::array<float,2>{0.771742702f, 0.865996122f},
-std::array<float,2>{0.148290575f, 0.366690308f},
-std::array<float,2>{0.635485351f, 0.248897359f},
-std::array<float,2>{0.332311541f, 0.70795846f},
-std::array<float,2>{0.928258181f, 0.539176702f},
-std::array<float,2>{0.0687940419f, 0.0578778312f},
-std::array<float,2>{0.601151526f, 0.476987422f},
-std::array<float,2>{0.455165416f, 0.985283196f},
-std::array<float,2>{0.65188235f, 0.831390321f},
-std::array<float,2>{0.326572597f, 0.333178788f},
-std::array<float,2>{0.762590766f, 0.21255289f},
-std::array<float,2>{0.135768205f, 0.734635353f},
-std::array<float,2>{0.545486331f, 0.648754656f},
-std::array<float,2>{0.432437241f, 0.161124468f},
-std::array<float,2>{0.982902765f, 0.276827097f},
-std::array<float,2>{0.026185913f, 0.778622687f},
-std::array<float,2>{0.860249579f, 0.93230623f},
-std::array<float,2>{0.206506446f, 0.432618499f},
-std::array<float,2>{0.709594905f, 0.099901095f},
-std::array<float,2>{0.287582666f, 0.606120527f},
-std::array<float,2>{0.789386332f, 0.688556552f},
-std::array<float,2>{0.172440022f, 0.219975829f},
-std::array<float,2>{0.660618901f, 0.352170378f},
-std::array<float,2>{0.355541646f, 0.854539752f},
-std::array<float,2>{0.567404628f, 0.960807025f},
-std::array<float,2>{0.472059786f, 0.441137195f},
-std::array<float,2>{0.879964054f, 0.00853871368f},
-std::array<float,2>{0.102989152f, 0.505448639f},
-std::array<float,2>{0.737162173f, 0.573133588f},
-std::array<float,2>{0.257620603f, 0.0809026659f},
-std::array<float,2>{0.815737784f, 0.389786422f},
-std::array<float,2>{0.238870129f, 0.886365473f},
-std::array<float,2>{0.938534617f, 0.809510469f},
-std::array<float,2>{0.0476286486f, 0.288182586f},
-std::array<float,2>{0.505420089f, 0.146520615f},
-std::array<float,2>{0.404875964f, 0.68580389f},
-std::array<float,2>{0.751643002f, 0.514107168f},
-std::array<float,2>{0.125928581f, 0.000127855426f},
-std::array<float,2>{0.645812929f, 0.450484633f},
-std::array<float,2>{0.318318635f, 0.965052664f},
-std::array<float,2>{0.609165907f, 0.848685861f},
-std::array<float,2>{0.461366355f, 0.351085275f},
-std::array<float,2>{0.937090576f, 0.232757345f},
-std::array<float,2>{0.0742414072f, 0.698803842f},
-std::array<float,2>{0.718171358f, 0.673092365f},
-std::array<float,2>{0.291236907f, 0.154493436f},
-std::array<float,2>{0.868580341f, 0.294422388f},
-std::array<float,2>{0.21432884f, 0.798341751f},
-std::array<float,2>{0.973352194f, 0.878330231f},
-std::array<float,2>{0.0226798207f, 0.378234416f},
-std::array<float,2>{0.533692241f, 0.0893312767f},
-std::array<float,2>{0.427325159f, 0.570211649f},
-std::array<float,2>{0.884543717f, 0.744247317f},
-std::array<float,2>{0.0979525968f, 0.209930182f},
-std::array<float,2>{0.577694058f, 0.33758235f},
-std::array<float,2>{0.482823253f, 0.842267215f},
-std::array<float,2>{0.668905079f, 0.996225893f},
-std::array<float,2>{0.347862542f, 0.476396233f},
-std::array<float,2>{0.784282327f, 0.0505961031f},
-std::array<float,2>{0.184305951f, 0.532012105f},
-std::array<float,2>{0.510917604f, 0.59553951f},
-std::array<float,2>{0.395811677f, 0.107187763f},
-std::array<float,2>{0.946835041f, 0.42673561f},
-std::array<float,2>{0.0623432584f, 0.92304492f},
-std::array<float,2>{0.826902211f, 0.772916675f},
-std::array<float,2>{0.249079823f, 0.267370343f},
-std::array<float,2>{0.749931157f, 0.169629142f},
-std::array<float,2>{0.25810504f, 0.645843327f},
-std::array<float,2>{0.964980781f, 0.586291254f},
-std::array<float,2>{0.0379040428f, 0.0746069402f},
-std::array<float,2>{0.52660358f, 0.392151475f},
-std::array<float,2>{0.386153489f, 0.904681981f},
-std::array<float,2>{0.733385623f, 0.793511212f},
-std::array<float,2>{0.271041334f, 0.311746567f},
-std::array<float,2>{0.836313307f, 0.137449861f},
-std::array<float,2>{0.223343506f, 0.663645983f},
-std::array<float,2>{0.582234561f, 0.713523567f},
-std::array<float,2>{0.498440474f, 0.235783249f},
-std::array<float,2>{0.904178739f, 0.374261558f},
-std::array<float,2>{0.112666309f, 0.872830153f},
-std::array<float,2>{0.804489434f, 0.944422245f},
-std::array<float,2>{0.156796098f, 0.45407182f},
-std::array<float,2>{0.672240138f, 0.0217039865f},
-std::array<float,2>{0.365175784f, 0.525928795f},
-std::array<float,2>{0.848026633f, 0.626136005f},
-std::array<float,2>{0.198512748f, 0.183073252f},
-std::array<float,2>{0.699697316f, 0.250663489f},
-std::array<float,2>{0.31069839f, 0.759321213f},
-std::array<float,2>{0.550231278f, 0.915382624f},
-std::array<float,2>{0.417434156f, 0.411585867f},
-std::array<float,2>{0.999305427f, 0.123378187f},
-std::array<float,2>{0.00113578408f, 0.611672282f},
-std::array<float,2>{0.632104516f, 0.547174454f},
-std::array<float,2>{0.339765966f, 0.0349482819f},
-std::array<float,2>{0.780645013f, 0.485874534f},
-std::array<float,2>{0.152212381f, 0.976113439f},
-std::array<float,2>{0.911018074f, 0.817952037f},
-std::array<float,2>{0.0931300446f, 0.318820566f},
-std::array<float,2>{0.612573385f, 0.197510406f},
-std::array<float,2>{0.45180431f, 0.72872901f},
-std::array<float,2>{0.871361434f, 0.56194669f},
-std::array<float,2>{0.21731244f, 0.0418092534f},
-std::array<float,2>{0.713453174f, 0.494429439f},
-std::array<float,2>{0.296280622f, 0.983281195f},
-std::array<float,2>{0.538386822f, 0.821488082f},
-std::array<float,2>{0.425315291f, 0.325742722f},
-std::array<float,2>{0.970960796f, 0.192625135f},
-std::array<float,2>{0.0194687117f, 0.725012302f},
-std::array<float,2>{0.641277015f, 0.635407507f},
-std::array<float,2>{0.313722819f, 0.178301886f},
-std::array<float,2>{0.757051289f, 0.260297567f},
-std::array<float,2>{0.13242048f, 0.752274454f},
-std::array<float,2>{0.933231592f, 0.911417007f},
-std::array<float,2>{0.073784858f, 0.419395864f},
-std::array<float,2>{0.605083168f, 0.114884436f},
-std::array<float,2>{0.464925349f, 0.622695625f},
-std::array<float,2>{0.949940562f, 0.705670536f},
-std::array<float,2>{0.0582073703f, 0.242943257f},
-std::array<float,2>{0.514352024f, 0.360400885f},
-std::array<float,2>{0.3916049f, 0.862686336f},
-std::array<float,2>{0.745715559f, 0.946686566f},
-std::array<float,2>{0.265074819f, 0.463011652f},
-std::array<float,2>{0.823763907f, 0.0236269869f},
-std::array<float,2>{0.244455189f, 0.520726919f},
-std::array<float,2>{0.574198008f, 0.580908895f},
-std::array<float,2>{0.477949172f, 0.0646112487f},
-std::array<float,2>{0.886862874f, 0.400472611f},
-std::array<float,2>{0.0956933498f, 0.897656858f},
-std::array<float,2>{0.788641632f, 0.782606244f},
-std::array<float,2>{0.181448668f, 0.2981731f},
-std::array<float,2>{0.666440845f, 0.131852478f},
-std::array<float,2>{0.345287919f, 0.668999791f},
-std::array<float,2>{0.898905754f, 0.601878047f},
-std::array<float,2>{0.11448653f, 0.0971269682f},
-std::array<float,2>{0.580547035f, 0.435015559f},
-std::array<float,2>{0.494203895f, 0.934807599f},
-std::array<float,2>{0.677865684f, 0.774625421f},
-std::array<float,2>{0.361597985f, 0.281092256f},
-std::array<float,2>{0.797433853f, 0.158752471f},
-std::array<float,2>{0.163253948f, 0.653099775f},
-std::array<float,2>{0.528322101f, 0.741173148f},
-std::array<float,2>{0.390395284f, 0.217498124f},
-std::array<float,2>{0.962380826f, 0.328947812f},
-std::array<float,2>{0.0338594839f, 0.832638085f},
-std::array<float,2>{0.840715945f, 0.990918875f},
-std::array<float,2>{0.221382275f, 0.481821746f},
-std::array<float,2>{0.728267133f, 0.0594162755f},
-std::array<float,2>{0.268062294f, 0.544020295f},
-std::array<float,2>{0.776181698f, 0.682883263f},
-std::array<float,2>{0.15445742f, 0.141995341f},
-std::array<float,2>{0.625967085f, 0.283723086f},
-std::array<float,2>{0.343208283f, 0.806549847f},
-std::array<float,2>{0.61570096f, 0.889844656f},
-std::array<float,2>{0.447561741f, 0.385035068f},
-std::array<float,2>{0.907506943f, 0.085558176f},
-std::array<float,2>{0.0875478461f, 0.576763093f},
-std::array<float,2>{0.699036121f, 0.503762722f},
-std::array<float,2>{0.306489855f, 0.0122138057f},
-std::array<float,2>{0.84423852f, 0.443820328f},
-std::array<float,2>{0.200694442f, 0.953385651f},
-std::array<float,2>{0.994581878f, 0.855782866f},
-std::array<float,2>{0.00639040628f, 0.356283814f},
-std::array<float,2>{0.554531515f, 0.223958716f},
-std::array<float,2>{0.421831191f, 0.694570482f},
-std::array<float,2>{0.807231188f, 0.565295279f},
-std::array<float,2>{0.1676521f, 0.0906420127f},
-std::array<float,2>{0.680154502f, 0.38148123f},
-std::array<float,2>{0.368139297f, 0.879408956f},
-std::array<float,2>{0.587097585f, 0.801412582f},
-std::array<float,2>{0.48474592f, 0.290033668f},
-std::array<float,2>{0.890961945f, 0.151978612f},
-std::array<float,2>{0.117687263f, 0.679429471f},
-std::array<float,2>{0.719021201f, 0.702973008f},
-std::array<float,2>{0.277656078f, 0.226746023f},
-std::array<float,2>{0.832051337f, 0.347480029f},
-std::array<float,2>{0.233870193f, 0.844020247f},
-std::array<float,2>{0.957095683f, 0.962906659f},
-std::array<float,2>{0.0455662273f, 0.448669732f},
-std::array<float,2>{0.517896533f, 0.0072965757f},
-std::array<float,2>{0.382203281f, 0.509805501f},
-std::array<float,2>{0.921595275f, 0.642316401f},
-std::array<float,2>{0.0837477818f, 0.166982338f},
-std::array<float,2>{0.619857073f, 0.272937f},
-std::array<float,2>{0.443131536f, 0.766123474f},
-std::array<float,2>{0.636907101f, 0.927966237f},
-std::array<float,2>{0.331616759f, 0.422749907f},
-std::array<float,2>{0.767597973f, 0.105123386f},
-std::array<float,2>{0.14362964f, 0.599146783f},
-std::array<float,2>{0.557703316f, 0.537725985f},
-std::array<float,2>{0.407923728f, 0.0519191064f},
-std::array<float,2>{0.987938821f, 0.471620709f},
-std::array<float,2>{0.0110331178f, 0.99583441f},
-std::array<float,2>{0.854815662f, 0.837404609f},
-std::array<float,2>{0.191202998f, 0.34109199f},
-std::array<float,2>{0.687681258f, 0.205306679f},
-std::array<float,2>{0.303441674f, 0.747667849f},
-std::array<float,2>{0.97938031f, 0.528262794f},
-std::array<float,2>{0.0293917842f, 0.0192110855f},
-std::array<float,2>{0.53934288f, 0.460039198f},
-std::array<float,2>{0.433837384f, 0.941348374f},
-std::array<float,2>{0.706198514f, 0.869080842f},
-std::array<float,2>{0.28378126f, 0.369557232f},
-std::array<float,2>{0.866894364f, 0.241200686f},
-std::array<float,2>{0.209325358f, 0.716652691f},
-std::array<float,2>{0.597275436f, 0.658195615f},
-std::array<float,2>{0.45747757f, 0.134375051f},
-std::array<float,2>{0.923601985f, 0.304926574f},
-std::array<float,2>{0.0635266826f, 0.792385399f},
-std::array<float,2>{0.761446893f, 0.90157342f},
-std::array<float,2>{0.137908995f, 0.396413088f},
-std::array<float,2>{0.654342115f, 0.0711327568f},
-std::array<float,2>{0.321874112f, 0.590949535f},
-std::array<float,2>{0.817911565f, 0.730621457f},
-std::array<float,2>{0.236586407f, 0.200282604f},
-std::array<float,2>{0.739489555f, 0.313112974f},
-std::array<float,2>{0.25241521f, 0.813886166f},
-std::array<float,2>{0.501164317f, 0.97113198f},
-std::array<float,2>{0.398566008f, 0.491137654f},
-std::array<float,2>{0.943668365f, 0.0363653377f},
-std::array<float,2>{0.0543103702f, 0.553424418f},
-std::array<float,2>{0.659769714f, 0.616193533f},
-std::array<float,2>{0.353152603f, 0.118956588f},
-std::array<float,2>{0.795748055f, 0.407059491f},
-std::array<float,2>{0.175890595f, 0.919798791f},
-std::array<float,2>{0.875324845f, 0.762609124f},
-std::array<float,2>{0.106890798f, 0.255717933f},
-std::array<float,2>{0.563392937f, 0.186009854f},
-std::array<float,2>{0.473971456f, 0.629004955f},
-std::array<float,2>{0.836781681f, 0.588386893f},
-std::array<float,2>{0.22300896f, 0.0780129284f},
-std::array<float,2>{0.732842088f, 0.393132687f},
-std::array<float,2>{0.270777136f, 0.904107451f},
-std::array<float,2>{0.527160943f, 0.796152294f},
-std::array<float,2>{0.386686474f, 0.309538633f},
-std::array<float,2>{0.965408206f, 0.13921611f},
-std::array<float,2>{0.0374064557f, 0.661951482f},
-std::array<float,2>{0.672821462f, 0.712738216f},
-std::array<float,2>{0.364681661f, 0.237963021f},
-std::array<float,2>{0.80381912f, 0.371674865f},
-std::array<float,2>{0.156385884f, 0.874790192f},
-std::array<float,2>{0.903781116f, 0.943089664f},
-std::array<float,2>{0.113270022f, 0.456782132f},
-std::array<float,2>{0.582932174f, 0.0210388098f},
-std::array<float,2>{0.498551965f, 0.524446726f},
-std::array<float,2>{0.999591827f, 0.628070354f},
-std::array<float,2>{0.00158237421f, 0.180120528f},
-std::array<float,2>{0.550587714f, 0.253429353f},
-std::array<float,2>{0.417837828f, 0.759797513f},
-std::array<float,2>{0.699838638f, 0.917811036f},
-std::array<float,2>{0.311326772f, 0.412686169f},
-std::array<float,2>{0.848323524f, 0.122519918f},
-std::array<float,2>{0.198932573f, 0.609667718f},
-std::array<float,2>{0.612885833f, 0.549409688f},
-std::array<float,2>{0.451299399f, 0.031560611f},
-std::array<float,2>{0.91030848f, 0.486519516f},
-std::array<float,2>{0.0935832039f, 0.974502087f},
-std::array<float,2>{0.781094611f, 0.818974733f},
-std::array<float,2>{0.151826724f, 0.316878021f},
-std::array<float,2>{0.632535994f, 0.195574224f},
-std::array<float,2>{0.339268267f, 0.727066278f},
-std::array<float,2>{0.936749876f, 0.513639212f},
-std::array<float,2>{0.0751228034f, 0.00253636693f},
-std::array<float,2>{0.608444571f, 0.451309532f},
-std::array<float,2>{0.461620092f, 0.9671157f},
-std::array<float,2>{0.646451771f, 0.850386143f},
-std::array<float,2>{0.317723125f, 0.348781407f},
-std::array<float,2>{0.751403868f, 0.231511459f},
-std::array<float,2>{0.125058144f, 0.696867764f},
-std::array<float,2>{0.533571422f, 0.675343513f},
-std::array<float,2>{0.426961362f, 0.154266521f},
-std::array<float,2>{0.972817838f, 0.295623958f},
-std::array<float,2>{0.0232577194f, 0.800763726f},
-std::array<float,2>{0.868684947f, 0.876829863f},
-std::array<float,2>{0.214455694f, 0.376499623f},
-std::array<float,2>{0.718477249f, 0.0867626294f},
-std::array<float,2>{0.291523308f, 0.567012429f},
-std::array<float,2>{0.785096943f, 0.743967712f},
-std::array<float,2>{0.184018865f, 0.207591504f},
-std::array<float,2>{0.668090463f, 0.339524537f},
-std::array<float,2>{0.348310083f, 0.841523051f},
-std::array<float,2>{0.577413201f, 0.998757958f},
-std::array<float,2>{0.482961148f, 0.472744733f},
-std::array<float,2>{0.883912981f, 0.0474125817f},
-std::array<float,2>{0.098248817f, 0.533761621f},
-std::array<float,2>{0.749170125f, 0.596154332f},
-std::array<float,2>{0.258389205f, 0.108794741f},
-std::array<float,2>{0.826184273f, 0.427893341f},
-std::array<float,2>{0.249882713f, 0.923927486f},
-std::array<float,2>{0.946499109f, 0.769621193f},
-std::array<float,2>{0.0615459681f, 0.269340903f},
-std::array<float,2>{0.511698782f, 0.17174606f},
-std::array<float,2>{0.396226794f, 0.64691478f},
-std::array<float,2>{0.76178652f, 0.541516542f},
-std::array<float,2>{0.136545807f, 0.0549621955f},
-std::array<float,2>{0.651519895f, 0.480380297f},
-std::array<float,2>{0.326978415f, 0.987208784f},
-std::array<float,2>{0.600664437f, 0.829376936f},
-std::array<float,2>{0.455755413f, 0.334316075f},
-std::array<float,2>{0.928001702f, 0.213513598f},
-std::array<float,2>{0.0689386427f, 0.736587644f},
-std::array<float,2>{0.709455192f, 0.651942432f},
-std::array<float,2>{0.287877172f, 0.163292274f},
-std::array<float,2>{0.859846234f, 0.273860931f},
-std::array<float,2>{0.206836909f, 0.780233085f},
-std::array<float,2>{0.98334837f, 0.931035876f},
-std::array<float,2>{0.0257767253f, 0.430552959f},
-std::array<float,2>{0.544960201f, 0.0982977152f},
-std::array<float,2>{0.431669474f, 0.607827127f},
-std::array<float,2>{0.880403399f, 0.690307677f},
-std::array<float,2>{0.103191219f, 0.222108677f},
-std::array<float,2>{0.568036079f, 0.35483706f},
-std::array<float,2>{0.472533733f, 0.851793528f},
-std::array<float,2>{0.660866737f, 0.958699405f},
-std::array<float,2>{0.356322289f, 0.439132333f},
-std::array<float,2>{0.789829969f, 0.0104785897f},
-std::array<float,2>{0.172144741f, 0.507063806f},
-std::array<float,2>{0.505194664f, 0.570902586f},
-std::array<float,2>{0.404645771f, 0.0790319443f},
-std::array<float,2>{0.939348698f, 0.388358504f},
-std::array<float,2>{0.0469621159f, 0.883754432f},
-std::array<float,2>{0.816303372f, 0.812491775f},
-std::array<float,2>{0.23863475f, 0.285287112f},
-std::array<float,2>{0.736670852f, 0.145127907f},
-std::array<float,2>{0.257207513f, 0.685388088f},
-std::array<float,2>{0.955008328f, 0.617897451f},
-std::array<float,2>{0.0423585288f, 0.111075833f},
-std::array<float,2>{0.523121595f, 0.415424496f},
-std::array<float,2>{0.376203358f, 0.907222033f},
-std::array<float,2>{0.725526154f, 0.754729092f},
-std::array<float,2>{0.274168968f, 0.264954835f},
-std::array<float,2>{0.830593228f, 0.172939062f},
-std::array<float,2>{0.229325265f, 0.637663484f},
-std::array<float,2>{0.590990484f, 0.719781339f},
-std::array<float,2>{0.490100443f, 0.188221142f},
-std::array<float,2>{0.897642136f, 0.322151095f},
-std::array<float,2>{0.121374033f, 0.826877117f},
-std::array<float,2>{0.811422348f, 0.978271127f},
-std::array<float,2>{0.169736803f, 0.498851776f},
-std::array<float,2>{0.687408984f, 0.0464283042f},
-std::array<float,2>{0.374242485f, 0.556244493f},
-std::array<float,2>{0.859188378f, 0.667416751f},
-std::array<float,2>{0.191473871f, 0.12662302f},
-std::array<float,2>{0.693295181f, 0.302276045f},
-std::array<float,2>{0.298240334f, 0.788850009f},
-std::array<float,2>{0.559840322f, 0.892999411f},
-std::array<float,2>{0.410550147f, 0.405129313f},
-std::array<float,2>{0.989911377f, 0.0692018643f},
-std::array<float,2>{0.0154873105f, 0.584224761f},
-std::array<float,2>{0.634980977f, 0.518293798f},
-std::array<float,2>{0.332683712f, 0.028223021f},
-std::array<float,2>{0.772354901f, 0.46857056f},
-std::array<float,2>{0.147946879f, 0.950690866f},
-std::array<float,2>{0.914119244f, 0.864848137f},
-std::array<float,2>{0.0795361698f, 0.363590032f},
-std::array<float,2>{0.623203158f, 0.246174097f},
-std::array<float,2>{0.440352112f, 0.709108353f},
-std::array<float,2>{0.866476893f, 0.530285835f},
-std::array<float,2>{0.209923133f, 0.0167484973f},
-std::array<float,2>{0.70658946f, 0.457998276f},
-std::array<float,2>{0.283631146f, 0.938997924f},
-std::array<float,2>{0.539588809f, 0.870111287f},
-std::array<float,2>{0.434110641f, 0.36853075f},
-std::array<float,2>{0.978659213f, 0.240203649f},
-std::array<float,2>{0.0299169458f, 0.717285454f},
-std::array<float,2>{0.655078053f, 0.659313738f},
-std::array<float,2>{0.321555763f, 0.136165366f},
-std::array<float,2>{0.760821998f, 0.30767256f},
-std::array<float,2>{0.138668507f, 0.790906906f},
-std::array<float,2>{0.923119366f, 0.898992956f},
-std::array<float,2>{0.0639799833f, 0.397129565f},
-std::array<float,2>{0.596921384f, 0.0726252124f},
-std::array<float,2>{0.457783639f, 0.592897356f},
-std::array<float,2>{0.94386071f, 0.733521283f},
-std::array<float,2>{0.0537379161f, 0.202726588f},
-std::array<float,2>{0.501689315f, 0.314714938f},
-std::array<float,2>{0.399225056f, 0.816056728f},
-std::array<float,2>{0.739875615f, 0.969948113f},
-std::array<float,2>{0.252616465f, 0.489825815f},
-std::array<float,2>{0.817662716f, 0.0384709425f},
-std::array<float,2>{0.236896843f, 0.550895631f},
-std::array<float,2>{0.562919676f, 0.614170134f},
-std::array<float,2>{0.474166393f, 0.120201811f},
-std::array<float,2>{0.875505447f, 0.408398211f},
-std::array<float,2>{0.107365958f, 0.921038806f},
-std::array<float,2>{0.795025706f, 0.763924181f},
-std::array<float,2>{0.176596895f, 0.257167965f},
-std::array<float,2>{0.65921253f, 0.183701634f},
-std::array<float,2>{0.352573365f, 0.63124299f},
-std::array<float,2>{0.891169786f, 0.562916398f},
-std::array<float,2>{0.117615722f, 0.0918598399f},
-std::array<float,2>{0.587890625f, 0.38055253f},
-std::array<float,2>{0.4852328f, 0.882597446f},
-std::array<float,2>{0.68060869f, 0.80365777f},
-std::array<float,2>{0.367291808f, 0.292873979f},
-std::array<float,2>{0.807069659f, 0.148469687f},
-std::array<float,2>{0.167152449f, 0.675912499f},
-std::array<float,2>{0.51843977f, 0.700545311f},
-std::array<float,2>{0.382353216f, 0.229955584f},
-std::array<float,2>{0.95793432f, 0.345007479f},
-std::array<float,2>{0.044992283f, 0.847192407f},
-std::array<float,2>{0.832624018f, 0.961859405f},
-std::array<float,2>{0.233932316f, 0.446234822f},
-std::array<float,2>{0.71956712f, 0.00430518854f},
-std::array<float,2>{0.277871847f, 0.508621156f},
-std::array<float,2>{0.768091261f, 0.642764449f},
-std::array<float,2>{0.144428223f, 0.165209606f},
-std::array<float,2>{0.637244761f, 0.270670295f},
-std::array<float,2>{0.331160933f, 0.768264055f},
-std::array<float,2>{0.619366348f, 0.926980615f},
-std::array<float,2>{0.442569524f, 0.42502448f},
-std::array<float,2>{0.921287596f, 0.103217654f},
-std::array<float,2>{0.0830294862f, 0.600988925f},
-std::array<float,2>{0.68816638f, 0.536682487f},
-std::array<float,2>{0.302843601f, 0.0542246513f},
-std::array<float,2>{0.85542047f, 0.470074385f},
-std::array<float,2>{0.190771356f, 0.99322176f},
-std::array<float,2>{0.987641275f, 0.838968039f},
-std::array<float,2>{0.0115173385f, 0.341808826f},
-std::array<float,2>{0.558226049f, 0.20344767f},
-std::array<float,2>{0.407677472f, 0.74911356f},
-std::array<float,2>{0.797042489f, 0.603936613f},
-std::array<float,2>{0.16388835f, 0.0938514471f},
-std::array<float,2>{0.678654194f, 0.436247349f},
-std::array<float,2>{0.361906916f, 0.936270952f},
-std::array<float,2>{0.580656409f, 0.775658965f},
-std::array<float,2>{0.494805932f, 0.279257149f},
-std::array<float,2>{0.899403155f, 0.156549901f},
-std::array<float,2>{0.115053102f, 0.655956864f},
-std::array<float,2>{0.727698982f, 0.740086019f},
-std::array<float,2>{0.268172294f, 0.216453284f},
-std::array<float,2>{0.840326965f, 0.330245733f},
-std::array<float,2>{0.221035436f, 0.834038973f},
-std::array<float,2>{0.962692738f, 0.990070045f},
-std::array<float,2>{0.0332674086f, 0.483410269f},
-std::array<float,2>{0.528875232f, 0.0607240908f},
-std::array<float,2>{0.389790446f, 0.54592526f},
-std::array<float,2>{0.908015966f, 0.679892123f},
-std::array<float,2>{0.0871818736f, 0.142970145f},
-std::array<float,2>{0.616076052f, 0.283047557f},
-std::array<float,2>{0.44788605f, 0.807583034f},
-std::array<float,2>{0.625463307f, 0.888070166f},
-std::array<float,2>{0.343436837f, 0.383728445f},
-std::array<float,2>{0.775857925f, 0.0836604536f},
-std::array<float,2>{0.155126557f, 0.575257182f},
-std::array<float,2>{0.553919733f, 0.500747681f},
-std::array<float,2>{0.421228319f, 0.0141749457f},
-std::array<float,2>{0.994977057f, 0.442417473f},
-std::array<float,2>{0.00608387869f, 0.955227077f},
-std::array<float,2>{0.844146848f, 0.859106183f},
-std::array<float,2>{0.200662047f, 0.357746482f},
-std::array<float,2>{0.698395371f, 0.226044223f},
-std::array<float,2>{0.305964649f, 0.691749573f},
-std::array<float,2>{0.971417844f, 0.5601722f},
-std::array<float,2>{0.0187756531f, 0.0397023f},
-std::array<float,2>{0.538584828f, 0.49412933f},
-std::array<float,2>{0.424984246f, 0.981543243f},
-std::array<float,2>{0.712898731f, 0.82252878f},
-std::array<float,2>{0.296430737f, 0.326580405f},
-std::array<float,2>{0.871743381f, 0.195010781f},
-std::array<float,2>{0.21709688f, 0.723470926f},
-std::array<float,2>{0.604530692f, 0.633516729f},
-std::array<float,2>{0.465802699f, 0.177328736f},
-std::array<float,2>{0.932924449f, 0.259547919f},
-std::array<float,2>{0.0733586401f, 0.750690639f},
-std::array<float,2>{0.75778532f, 0.913220346f},
-std::array<float,2>{0.132256955f, 0.421453804f},
-std::array<float,2>{0.641098976f, 0.116065264f},
-std::array<float,2>{0.31436041f, 0.623227298f},
-std::array<float,2>{0.823614001f, 0.704149246f},
-std::array<float,2>{0.245112047f, 0.245451599f},
-std::array<float,2>{0.745327532f, 0.361724943f},
-std::array<float,2>{0.265453994f, 0.860773087f},
-std::array<float,2>{0.514015615f, 0.947657585f},
-std::array<float,2>{0.392205328f, 0.462619901f},
-std::array<float,2>{0.949237943f, 0.0255983453f},
-std::array<float,2>{0.0580303147f, 0.521570623f},
-std::array<float,2>{0.666545987f, 0.580018461f},
-std::array<float,2>{0.344868839f, 0.0632356852f},
-std::array<float,2>{0.78829205f, 0.399170458f},
-std::array<float,2>{0.1807165f, 0.895383894f},
-std::array<float,2>{0.887406945f, 0.78345722f},
-std::array<float,2>{0.0949635059f, 0.300119072f},
-std::array<float,2>{0.573420167f, 0.129152566f},
-std::array<float,2>{0.478106171f, 0.671816826f},
-std::array<float,2>{0.849923432f, 0.612208843f},
-std::array<float,2>{0.196179017f, 0.12397404f},
-std::array<float,2>{0.702126741f, 0.411765486f},
-std::array<float,2>{0.309551358f, 0.91592592f},
-std::array<float,2>{0.548360586f, 0.758988321f},
-std::array<float,2>{0.415403366f, 0.250488162f},
-std::array<float,2>{0.997869611f, 0.18331407f},
-std::array<float,2>{0.00386505155f, 0.626620412f},
-std::array<float,2>{0.629243433f, 0.729101896f},
-std::array<float,2>{0.337697208f, 0.198038682f},
-std::array<float,2>{0.779077768f, 0.31927231f},
-std::array<float,2>{0.14848119f, 0.817513585f},
-std::array<float,2>{0.912246585f, 0.975902259f},
-std::array<float,2>{0.0910008922f, 0.485773414f},
-std::array<float,2>{0.611300945f, 0.0343949981f},
-std::array<float,2>{0.449569464f, 0.547783732f},
-std::array<float,2>{0.967772543f, 0.663432717f},
-std::array<float,2>{0.0356814824f, 0.136992604f},
-std::array<float,2>{0.524022877f, 0.312116176f},
-std::array<float,2>{0.384444594f, 0.793107629f},
-std::array<float,2>{0.732073247f, 0.905126095f},
-std::array<float,2>{0.272926629f, 0.392079055f},
-std::array<float,2>{0.838068604f, 0.0750756189f},
-std::array<float,2>{0.226346269f, 0.586874664f},
-std::array<float,2>{0.585518539f, 0.525779247f},
-std::array<float,2>{0.496432304f, 0.0222872403f},
-std::array<float,2>{0.905798972f, 0.453535676f},
-std::array<float,2>{0.110896163f, 0.945200682f},
-std::array<float,2>{0.802694261f, 0.872093081f},
-std::array<float,2>{0.158386096f, 0.374746323f},
-std::array<float,2>{0.675031126f, 0.236233994f},
-std::array<float,2>{0.365523636f, 0.713362098f},
-std::array<float,2>{0.886485338f, 0.53150636f},
-std::array<float,2>{0.101153888f, 0.0502739958f},
-std::array<float,2>{0.575643122f, 0.475611687f},
-std::array<float,2>{0.48150596f, 0.996843576f},
-std::array<float,2>{0.670663595f, 0.842540026f},
-std::array<float,2>{0.35150227f, 0.33728382f},
-std::array<float,2>{0.781788766f, 0.209286094f},
-std::array<float,2>{0.18648167f, 0.744726062f},
-std::array<float,2>{0.509553492f, 0.646346092f},
-std::array<float,2>{0.396806777f, 0.169226557f},
-std::array<float,2>{0.948439121f, 0.266615629f},
-std::array<float,2>{0.0597473085f, 0.773127317f},
-std::array<float,2>{0.824614584f, 0.923615873f},
-std::array<float,2>{0.247572526f, 0.426193863f},
-std::array<float,2>{0.747223973f, 0.106604449f},
-std::array<float,2>{0.260481119f, 0.594810426f},
-std::array<float,2>{0.753738523f, 0.69850868f},
-std::array<float,2>{0.128707319f, 0.232969046f},
-std::array<float,2>{0.647829115f, 0.3506338f},
-std::array<float,2>{0.318893105f, 0.849499166f},
-std::array<float,2>{0.60685575f, 0.965797722f},
-std::array<float,2>{0.462911695f, 0.450705677f},
-std::array<float,2>{0.935236931f, 0.000837618194f},
-std::array<float,2>{0.0771298334f, 0.514381468f},
-std::array<float,2>{0.716664791f, 0.569609225f},
-std::array<float,2>{0.290213257f, 0.0897926092f},
-std::array<float,2>{0.87052685f, 0.37845403f},
-std::array<float,2>{0.212735176f, 0.878660917f},
-std::array<float,2>{0.974639952f, 0.798158467f},
-std::array<float,2>{0.0208492521f, 0.294862449f},
-std::array<float,2>{0.532828033f, 0.154956251f},
-std::array<float,2>{0.428963035f, 0.673771918f},
-std::array<float,2>{0.791102409f, 0.505160213f},
-std::array<float,2>{0.174163118f, 0.00822161883f},
-std::array<float,2>{0.662308991f, 0.440519333f},
-std::array<float,2>{0.358487159f, 0.960440934f},
-std::array<float,2>{0.569506645f, 0.85544467f},
-std::array<float,2>{0.468991369f, 0.351985455f},
-std::array<float,2>{0.88215822f, 0.220673695f},
-std::array<float,2>{0.10438028f, 0.689189553f},
-std::array<float,2>{0.736307681f, 0.686184287f},
-std::array<float,2>{0.255481094f, 0.147385627f},
-std::array<float,2>{0.813232183f, 0.288973838f},
-std::array<float,2>{0.24050279f, 0.808762372f},
-std::array<float,2>{0.940777004f, 0.886221409f},
-std::array<float,2>{0.0503900982f, 0.390279442f},
-std::array<float,2>{0.506581604f, 0.0803940073f},
-std::array<float,2>{0.402870476f, 0.572602153f},
-std::array<float,2>{0.926845968f, 0.734875798f},
-std::array<float,2>{0.0668994188f, 0.21210736f},
-std::array<float,2>{0.599203408f, 0.333652943f},
-std::array<float,2>{0.454340369f, 0.8317644f},
-std::array<float,2>{0.649418175f, 0.98478049f},
-std::array<float,2>{0.324370593f, 0.477145344f},
-std::array<float,2>{0.764676034f, 0.0583757125f},
-std::array<float,2>{0.13319537f, 0.540029585f},
-std::array<float,2>{0.54365617f, 0.605689287f},
-std::array<float,2>{0.429782093f, 0.100506231f},
-std::array<float,2>{0.98096621f, 0.433567762f},
-std::array<float,2>{0.0252581649f, 0.931944191f},
-std::array<float,2>{0.862622559f, 0.778907359f},
-std::array<float,2>{0.203751743f, 0.277222484f},
-std::array<float,2>{0.707304418f, 0.160557434f},
-std::array<float,2>{0.286706805f, 0.648981571f},
-std::array<float,2>{0.992099643f, 0.582802057f},
-std::array<float,2>{0.0135702416f, 0.0666543916f},
-std::array<float,2>{0.560815394f, 0.403951645f},
-std::array<float,2>{0.412136137f, 0.892120898f},
-std::array<float,2>{0.694152594f, 0.786087275f},
-std::array<float,2>{0.300038517f, 0.303583533f},
-std::array<float,2>{0.856263518f, 0.127682403f},
-std::array<float,2>{0.19471398f, 0.665496349f},
-std::array<float,2>{0.622658491f, 0.707174838f},
-std::array<float,2>{0.438939303f, 0.24819468f},
-std::array<float,2>{0.917712867f, 0.36711216f},
-std::array<float,2>{0.0806770921f, 0.865586102f},
-std::array<float,2>{0.769862413f, 0.952136576f},
-std::array<float,2>{0.146204233f, 0.46678409f},
-std::array<float,2>{0.634262562f, 0.0296358336f},
-std::array<float,2>{0.334233105f, 0.516669631f},
-std::array<float,2>{0.829616964f, 0.640432835f},
-std::array<float,2>{0.227882609f, 0.175166458f},
-std::array<float,2>{0.723684013f, 0.262016386f},
-std::array<float,2>{0.275422871f, 0.757115126f},
-std::array<float,2>{0.520252287f, 0.90876174f},
-std::array<float,2>{0.37712121f, 0.417677462f},
-std::array<float,2>{0.955453455f, 0.11273782f},
-std::array<float,2>{0.040711768f, 0.621030927f},
-std::array<float,2>{0.685458362f, 0.55787456f},
-std::array<float,2>{0.372089803f, 0.0434427485f},
-std::array<float,2>{0.810528219f, 0.49702394f},
-std::array<float,2>{0.171120226f, 0.979783297f},
-std::array<float,2>{0.895166874f, 0.825906098f},
-std::array<float,2>{0.124971099f, 0.322601914f},
-std::array<float,2>{0.593648911f, 0.191306502f},
-std::array<float,2>{0.49108693f, 0.721720219f},
-std::array<float,2>{0.819574237f, 0.55313611f},
-std::array<float,2>{0.236115769f, 0.0366405137f},
-std::array<float,2>{0.74047941f, 0.490502536f},
-std::array<float,2>{0.251544684f, 0.971297741f},
-std::array<float,2>{0.502588093f, 0.814176142f},
-std::array<float,2>{0.400475711f, 0.312589705f},
-std::array<float,2>{0.941854537f, 0.200925574f},
-std::array<float,2>{0.0517757013f, 0.731328011f},
-std::array<float,2>{0.657521784f, 0.629471242f},
-std::array<float,2>{0.354545414f, 0.186331481f},
-std::array<float,2>{0.793152273f, 0.254973561f},
-std::array<float,2>{0.178187773f, 0.761934578f},
-std::array<float,2>{0.877923548f, 0.919065654f},
-std::array<float,2>{0.108545378f, 0.406490982f},
-std::array<float,2>{0.564924896f, 0.118619263f},
-std::array<float,2>{0.476069868f, 0.615597963f},
-std::array<float,2>{0.978229582f, 0.716016412f},
-std::array<float,2>{0.0278141685f, 0.240350127f},
-std::array<float,2>{0.541659296f, 0.36987856f},
-std::array<float,2>{0.437234759f, 0.868188143f},
-std::array<float,2>{0.704883873f, 0.940520644f},
-std::array<float,2>{0.282807738f, 0.460757971f},
-std::array<float,2>{0.864008605f, 0.0187601615f},
-std::array<float,2>{0.207566425f, 0.527621865f},
-std::array<float,2>{0.594904304f, 0.591448486f},
-std::array<float,2>{0.459071368f, 0.0706139281f},
-std::array<float,2>{0.923985362f, 0.395975262f},
-std::array<float,2>{0.0654766336f, 0.90206486f},
-std::array<float,2>{0.758904099f, 0.792659938f},
-std::array<float,2>{0.139884114f, 0.305511504f},
-std::array<float,2>{0.652551413f, 0.133838132f},
-std::array<float,2>{0.32366702f, 0.657709777f},
-std::array<float,2>{0.919744909f, 0.598687887f},
-std::array<float,2>{0.0846981704f, 0.104691893f},
-std::array<float,2>{0.617223561f, 0.421952367f},
-std::array<float,2>{0.443979442f, 0.928471982f},
-std::array<float,2>{0.639428616f, 0.765810847f},
-std::array<float,2>{0.328383893f, 0.273218304f},
-std::array<float,2>{0.766490459f, 0.166330487f},
-std::array<float,2>{0.141506582f, 0.64170748f},
-std::array<float,2>{0.556102157f, 0.747474194f},
-std::array<float,2>{0.408906907f, 0.205977648f},
-std::array<float,2>{0.985493779f, 0.341310471f},
-std::array<float,2>{0.00960926153f, 0.83708775f},
-std::array<float,2>{0.851601839f, 0.995468736f},
-std::array<float,2>{0.188022882f, 0.470721453f},
-std::array<float,2>{0.690269768f, 0.0526912175f},
-std::array<float,2>{0.302709848f, 0.537204146f},
-std::array<float,2>{0.806531429f, 0.678890944f},
-std::array<float,2>{0.164497823f, 0.151595131f},
-std::array<float,2>{0.683440208f, 0.289255351f},
-std::array<float,2>{0.370662361f, 0.80115062f},
-std::array<float,2>{0.589419127f, 0.878928363f},
-std::array<float,2>{0.487165421f, 0.380928934f},
-std::array<float,2>{0.892732203f, 0.0903170779f},
-std::array<float,2>{0.12030714f, 0.56466794f},
-std::array<float,2>{0.721141577f, 0.510333717f},
-std::array<float,2>{0.27992937f, 0.00752277905f},
-std::array<float,2>{0.835886896f, 0.44876802f},
-std::array<float,2>{0.231246173f, 0.963511348f},
-std::array<float,2>{0.95992285f, 0.844422817f},
-std::array<float,2>{0.0448530875f, 0.347129017f},
-std::array<float,2>{0.516347408f, 0.227330774f},
-std::array<float,2>{0.379253566f, 0.702162206f},
-std::array<float,2>{0.774934411f, 0.576438725f},
-std::array<float,2>{0.152625144f, 0.0851713419f},
-std::array<float,2>{0.628496528f, 0.385419071f},
-std::array<float,2>{0.340581954f, 0.890458167f},
-std::array<float,2>{0.613481402f, 0.806082726f},
-std::array<float,2>{0.44623968f, 0.283279806f},
-std::array<float,2>{0.910102427f, 0.142471731f},
-std::array<float,2>{0.0885105729f, 0.683219254f},
-std::array<float,2>{0.69645983f, 0.69484812f},
-std::array<float,2>{0.307503104f, 0.224601611f},
-std::array<float,2>{0.846992671f, 0.355745345f},
-std::array<float,2>{0.201932371f, 0.856268704f},
-std::array<float,2>{0.993433058f, 0.953857839f},
-std::array<float,2>{0.0046822736f, 0.444276512f},
-std::array<float,2>{0.5525105f, 0.0120894378f},
-std::array<float,2>{0.419599801f, 0.50323236f},
-std::array<float,2>{0.901307166f, 0.652361214f},
-std::array<float,2>{0.116668433f, 0.158457592f},
-std::array<float,2>{0.580075443f, 0.280758083f},
-std::array<float,2>{0.49315393f, 0.774910808f},
-std::array<float,2>{0.677581847f, 0.935167909f},
-std::array<float,2>{0.359626323f, 0.435264081f},
-std::array<float,2>{0.799475431f, 0.097615391f},
-std::array<float,2>{0.161531895f, 0.602445185f},
-std::array<float,2>{0.529758453f, 0.544791758f},
-std::array<float,2>{0.387038857f, 0.0590491071f},
-std::array<float,2>{0.963155985f, 0.481995016f},
-std::array<float,2>{0.0324111581f, 0.990353942f},
-std::array<float,2>{0.841971517f, 0.832288086f},
-std::array<float,2>{0.219514623f, 0.328329206f},
-std::array<float,2>{0.728571117f, 0.216811076f},
-std::array<float,2>{0.266333818f, 0.740445018f},
-std::array<float,2>{0.95222038f, 0.521438003f},
-std::array<float,2>{0.0556766205f, 0.0242556632f},
-std::array<float,2>{0.512636006f, 0.463601917f},
-std::array<float,2>{0.39375028f, 0.947178781f},
-std::array<float,2>{0.743152618f, 0.862892807f},
-std::array<float,2>{0.26275444f, 0.360989302f},
-std::array<float,2>{0.82144773f, 0.242615148f},
-std::array<float,2>{0.243794188f, 0.705353498f},
-std::array<float,2>{0.570797086f, 0.669734418f},
-std::array<float,2>{0.479389101f, 0.132610291f},
-std::array<float,2>{0.889373183f, 0.298571467f},
-std::array<float,2>{0.0965885669f, 0.783028662f},
-std::array<float,2>{0.786529064f, 0.898037374f},
-std::array<float,2>{0.182199717f, 0.401024222f},
-std::array<float,2>{0.664675236f, 0.0653038993f},
-std::array<float,2>{0.346130937f, 0.580098212f},
-std::array<float,2>{0.8736009f, 0.725188792f},
-std::array<float,2>{0.215141401f, 0.193060696f},
-std::array<float,2>{0.711381853f, 0.325525194f},
-std::array<float,2>{0.294210166f, 0.822018325f},
-std::array<float,2>{0.535999358f, 0.9824543f},
-std::array<float,2>{0.423057079f, 0.494697422f},
-std::array<float,2>{0.969771087f, 0.0412764288f},
-std::array<float,2>{0.017274078f, 0.562390327f},
-std::array<float,2>{0.642938018f, 0.622143924f},
-std::array<float,2>{0.316120416f, 0.11441043f},
-std::array<float,2>{0.755516708f, 0.419549346f},
-std::array<float,2>{0.130131334f, 0.911726534f},
-std::array<float,2>{0.929906905f, 0.752606511f},
-std::array<float,2>{0.0712552071f, 0.259989381f},
-std::array<float,2>{0.602429271f, 0.177896827f},
-std::array<float,2>{0.468111813f, 0.635021091f},
-std::array<float,2>{0.869503319f, 0.567489684f},
-std::array<float,2>{0.211902112f, 0.0869440585f},
-std::array<float,2>{0.715628505f, 0.375214934f},
-std::array<float,2>{0.289905399f, 0.875191689f},
-std::array<float,2>{0.531834304f, 0.799675763f},
-std::array<float,2>{0.428276867f, 0.296832234f},
-std::array<float,2>{0.976394355f, 0.152625188f},
-std::array<float,2>{0.0200585518f, 0.6742208f},
-std::array<float,2>{0.647105157f, 0.695801377f},
-std::array<float,2>{0.320108175f, 0.230963439f},
-std::array<float,2>{0.752846777f, 0.348259449f},
-std::array<float,2>{0.127102897f, 0.850726724f},
-std::array<float,2>{0.93448782f, 0.968154192f},
-std::array<float,2>{0.0779419541f, 0.453028709f},
-std::array<float,2>{0.605517983f, 0.00293863541f},
-std::array<float,2>{0.464692771f, 0.511941612f},
-std::array<float,2>{0.947846174f, 0.648426652f},
-std::array<float,2>{0.0586506277f, 0.170122534f},
-std::array<float,2>{0.508552551f, 0.268384308f},
-std::array<float,2>{0.397680223f, 0.770859241f},
-std::array<float,2>{0.746462882f, 0.924989164f},
-std::array<float,2>{0.26118499f, 0.42937091f},
-std::array<float,2>{0.825711429f, 0.107818417f},
-std::array<float,2>{0.246291608f, 0.597163379f},
-std::array<float,2>{0.575041473f, 0.534376204f},
-std::array<float,2>{0.481390148f, 0.0481909402f},
-std::array<float,2>{0.885477245f, 0.474283129f},
-std::array<float,2>{0.100399025f, 0.999996841f},
-std::array<float,2>{0.782395601f, 0.840617478f},
-std::array<float,2>{0.186913684f, 0.3387945f},
-std::array<float,2>{0.671358585f, 0.208520681f},
-std::array<float,2>{0.350578398f, 0.742471278f},
-std::array<float,2>{0.90475291f, 0.524098814f},
-std::array<float,2>{0.11018724f, 0.0199341495f},
-std::array<float,2>{0.584914505f, 0.455913007f},
-std::array<float,2>{0.497739226f, 0.942122519f},
-std::array<float,2>{0.674463511f, 0.873451233f},
-std::array<float,2>{0.366647094f, 0.372306377f},
-std::array<float,2>{0.800808787f, 0.237150863f},
-std::array<float,2>{0.159833863f, 0.711563349f},
-std::array<float,2>{0.524631202f, 0.660611629f},
-std::array<float,2>{0.383780241f, 0.140081435f},
-std::array<float,2>{0.968459606f, 0.310003787f},
-std::array<float,2>{0.0364329703f, 0.795475543f},
-std::array<float,2>{0.839386404f, 0.902735293f},
-std::array<float,2>{0.225371271f, 0.393762738f},
-std::array<float,2>{0.73055172f, 0.077069357f},
-std::array<float,2>{0.271504968f, 0.589448154f},
-std::array<float,2>{0.777634621f, 0.728313506f},
-std::array<float,2>{0.150370494f, 0.197243035f},
-std::array<float,2>{0.630506575f, 0.318041921f},
-std::array<float,2>{0.336463153f, 0.819507539f},
-std::array<float,2>{0.609575212f, 0.972925186f},
-std::array<float,2>{0.450320125f, 0.487671793f},
-std::array<float,2>{0.91324693f, 0.0325671434f},
-std::array<float,2>{0.0905205011f, 0.550029635f},
-std::array<float,2>{0.702442288f, 0.610529006f},
-std::array<float,2>{0.309707344f, 0.121903874f},
-std::array<float,2>{0.850929379f, 0.414046288f},
-std::array<float,2>{0.197176233f, 0.916836619f},
-std::array<float,2>{0.99699074f, 0.761098504f},
-std::array<float,2>{0.00259508751f, 0.252678752f},
-std::array<float,2>{0.547278523f, 0.181540608f},
-std::array<float,2>{0.414419502f, 0.627749503f},
-std::array<float,2>{0.808939278f, 0.554967225f},
-std::array<float,2>{0.17031613f, 0.045816429f},
-std::array<float,2>{0.684191108f, 0.499704897f},
-std::array<float,2>{0.371456444f, 0.97748208f},
-std::array<float,2>{0.592229426f, 0.827422202f},
-std::array<float,2>{0.491428256f, 0.321155071f},
-std::array<float,2>{0.895962477f, 0.189287707f},
-std::array<float,2>{0.123421647f, 0.719036758f},
-std::array<float,2>{0.723340631f, 0.638384402f},
-std::array<float,2>{0.276637048f, 0.172104746f},
-std::array<float,2>{0.828936398f, 0.264519423f},
-std::array<float,2>{0.226633996f, 0.755094409f},
-std::array<float,2>{0.956896842f, 0.907915652f},
-std::array<float,2>{0.0398893356f, 0.414298415f},
-std::array<float,2>{0.521455824f, 0.109682724f},
-std::array<float,2>{0.378328085f, 0.618809521f},
-std::array<float,2>{0.916309595f, 0.710825682f},
-std::array<float,2>{0.0813722461f, 0.247615144f},
-std::array<float,2>{0.62137717f, 0.364345819f},
-std::array<float,2>{0.438147247f, 0.863290131f},
-std::array<float,2>{0.6334939f, 0.949549735f},
-std::array<float,2>{0.335908741f, 0.467152357f},
-std::array<float,2>{0.770742595f, 0.0288865697f},
-std::array<float,2>{0.14474836f, 0.519202709f},
-std::array<float,2>{0.561737299f, 0.585038543f},
-std::array<float,2>{0.4137142f, 0.07009051f},
-std::array<float,2>{0.991099417f, 0.405431122f},
-std::array<float,2>{0.0125291226f, 0.893722475f},
-std::array<float,2>{0.856879592f, 0.787125885f},
-std::array<float,2>{0.193701386f, 0.301385105f},
-std::array<float,2>{0.694528222f, 0.125028044f},
-std::array<float,2>{0.299568802f, 0.666281343f},
-std::array<float,2>{0.98208946f, 0.609075665f},
-std::array<float,2>{0.0240058061f, 0.099500671f},
-std::array<float,2>{0.544320166f, 0.431370705f},
-std::array<float,2>{0.43091172f, 0.929882705f},
-std::array<float,2>{0.708762527f, 0.780662596f},
-std::array<float,2>{0.285977453f, 0.275097966f},
-std::array<float,2>{0.861889243f, 0.162738129f},
-std::array<float,2>{0.205026358f, 0.65058434f},
-std::array<float,2>{0.598081946f, 0.737553596f},
-std::array<float,2>{0.453559518f, 0.214027449f},
-std::array<float,2>{0.925787449f, 0.335883379f},
-std::array<float,2>{0.0682843253f, 0.828403771f},
-std::array<float,2>{0.764095068f, 0.987847805f},
-std::array<float,2>{0.134665951f, 0.479275554f},
-std::array<float,2>{0.649355888f, 0.0561117604f},
-std::array<float,2>{0.325439632f, 0.542273343f},
-std::array<float,2>{0.814132035f, 0.683736145f},
-std::array<float,2>{0.241318598f, 0.145682335f},
-std::array<float,2>{0.735123992f, 0.28620699f},
-std::array<float,2>{0.254025608f, 0.810758471f},
-std::array<float,2>{0.506953657f, 0.884150982f},
-std::array<float,2>{0.404173672f, 0.387491673f},
-std::array<float,2>{0.940061212f, 0.0797147155f},
-std::array<float,2>{0.0497625321f, 0.571431577f},
-std::array<float,2>{0.663636088f, 0.505906045f},
-std::array<float,2>{0.357682377f, 0.0107889641f},
-std::array<float,2>{0.792717099f, 0.437660396f},
-std::array<float,2>{0.175446391f, 0.95725596f},
-std::array<float,2>{0.881342411f, 0.852561235f},
-std::array<float,2>{0.104715094f, 0.353731245f},
-std::array<float,2>{0.568750322f, 0.221429899f},
-std::array<float,2>{0.470252156f, 0.690519214f},
-std::array<float,2>{0.834331214f, 0.508825362f},
-std::array<float,2>{0.231661424f, 0.00540056918f},
-std::array<float,2>{0.722442865f, 0.446498483f},
-std::array<float,2>{0.280578792f, 0.962248683f},
-std::array<float,2>{0.51707834f, 0.846605837f},
-std::array<float,2>{0.379995197f, 0.344207019f},
-std::array<float,2>{0.960109115f, 0.228869632f},
-std::array<float,2>{0.0431869403f, 0.699977934f},
-std::array<float,2>{0.6820755f, 0.677132547f},
-std::array<float,2>{0.369456321f, 0.150273427f},
-std::array<float,2>{0.805012226f, 0.291761577f},
-std::array<float,2>{0.165793359f, 0.80413425f},
-std::array<float,2>{0.894467533f, 0.881616712f},
-std::array<float,2>{0.119680665f, 0.378916591f},
-std::array<float,2>{0.588595212f, 0.0932871178f},
-std::array<float,2>{0.487369448f, 0.564257205f},
-std::array<float,2>{0.985030651f, 0.748310149f},
-std::array<float,2>{0.00819557346f, 0.204838723f},
-std::array<float,2>{0.555493295f, 0.343420297f},
-std::array<float,2>{0.409205854f, 0.838038981f},
-std::array<float,2>{0.690848589f, 0.992697299f},
-std::array<float,2>{0.300828755f, 0.469308376f},
-std::array<float,2>{0.853199482f, 0.0532547459f},
-std::array<float,2>{0.18931815f, 0.535438418f},
-std::array<float,2>{0.618394792f, 0.600260735f},
-std::array<float,2>{0.444523424f, 0.102121785f},
-std::array<float,2>{0.918595731f, 0.424109697f},
-std::array<float,2>{0.0858694836f, 0.926367521f},
-std::array<float,2>{0.766805828f, 0.768693805f},
-std::array<float,2>{0.142194569f, 0.270007432f},
-std::array<float,2>{0.640322506f, 0.164484486f},
-std::array<float,2>{0.329463363f, 0.644060612f},
-std::array<float,2>{0.92563355f, 0.592027545f},
-std::array<float,2>{0.0650515035f, 0.07370314f},
-std::array<float,2>{0.594153762f, 0.398101717f},
-std::array<float,2>{0.460936487f, 0.900383294f},
-std::array<float,2>{0.653701901f, 0.78995204f},
-std::array<float,2>{0.322516114f, 0.307324678f},
-std::array<float,2>{0.758719623f, 0.135259703f},
-std::array<float,2>{0.138693929f, 0.658985913f},
-std::array<float,2>{0.542155743f, 0.718136549f},
-std::array<float,2>{0.435618103f, 0.238973811f},
-std::array<float,2>{0.977221191f, 0.367741406f},
-std::array<float,2>{0.0285820961f, 0.870290875f},
-std::array<float,2>{0.8652125f, 0.938280523f},
-std::array<float,2>{0.208043128f, 0.458485425f},
-std::array<float,2>{0.703179121f, 0.0157912876f},
-std::array<float,2>{0.281277716f, 0.529772222f},
-std::array<float,2>{0.794135571f, 0.632441819f},
-std::array<float,2>{0.17922467f, 0.184687898f},
-std::array<float,2>{0.656556606f, 0.256428599f},
-std::array<float,2>{0.353720635f, 0.765549421f},
-std::array<float,2>{0.566043615f, 0.919963002f},
-std::array<float,2>{0.475585192f, 0.409985065f},
-std::array<float,2>{0.878311098f, 0.11972516f},
-std::array<float,2>{0.107827716f, 0.614786029f},
-std::array<float,2>{0.741463304f, 0.5520522f},
-std::array<float,2>{0.250448763f, 0.0372738577f},
-std::array<float,2>{0.818543613f, 0.48880142f},
-std::array<float,2>{0.234669968f, 0.969311416f},
-std::array<float,2>{0.942703843f, 0.814778149f},
-std::array<float,2>{0.0508637354f, 0.31573382f},
-std::array<float,2>{0.503411531f, 0.201648504f},
-std::array<float,2>{0.40147984f, 0.733258307f},
-std::array<float,2>{0.754715979f, 0.624116004f},
-std::array<float,2>{0.12912187f, 0.116263747f},
-std::array<float,2>{0.644024968f, 0.42071262f},
-std::array<float,2>{0.314807385f, 0.913071334f},
-std::array<float,2>{0.603367269f, 0.751739323f},
-std::array<float,2>{0.467009336f, 0.258072585f},
-std::array<float,2>{0.930814922f, 0.176422596f},
-std::array<float,2>{0.0719602033f, 0.633957207f},
-std::array<float,2>{0.712741494f, 0.724146605f},
-std::array<float,2>{0.293118834f, 0.19399935f},
-std::array<float,2>{0.87481755f, 0.327325463f},
-std::array<float,2>{0.215919048f, 0.823746383f},
-std::array<float,2>{0.96886009f, 0.981288195f},
-std::array<float,2>{0.0165765192f, 0.49226892f},
-std::array<float,2>{0.536444008f, 0.040407218f},
-std::array<float,2>{0.422653556f, 0.559068263f},
-std::array<float,2>{0.889944553f, 0.6706478f},
-std::array<float,2>{0.0970746577f, 0.130203903f},
-std::array<float,2>{0.572005868f, 0.29902944f},
-std::array<float,2>{0.4796592f, 0.784361064f},
-std::array<float,2>{0.665096104f, 0.896005392f},
-std::array<float,2>{0.347299308f, 0.400025845f},
-std::array<float,2>{0.785178423f, 0.0637710467f},
-std::array<float,2>{0.183002517f, 0.578354239f},
-std::array<float,2>{0.513638496f, 0.522971213f},
-std::array<float,2>{0.393048793f, 0.0267896838f},
-std::array<float,2>{0.951697111f, 0.461236179f},
-std::array<float,2>{0.0550855137f, 0.948602021f},
-std::array<float,2>{0.820760369f, 0.860053539f},
-std::array<float,2>{0.242881909f, 0.36297217f},
-std::array<float,2>{0.743239999f, 0.244877741f},
-std::array<float,2>{0.261906981f, 0.704033554f},
-std::array<float,2>{0.96419704f, 0.545482397f},
-std::array<float,2>{0.0319549143f, 0.0621681847f},
-std::array<float,2>{0.531033337f, 0.483142525f},
-std::array<float,2>{0.388622612f, 0.988309562f},
-std::array<float,2>{0.730468273f, 0.835726082f},
-std::array<float,2>{0.267346978f, 0.331452757f},
-std::array<float,2>{0.842941165f, 0.215229437f},
-std::array<float,2>{0.220330641f, 0.738746583f},
-std::array<float,2>{0.578446627f, 0.654465556f},
-std::array<float,2>{0.493627965f, 0.158184558f},
-std::array<float,2>{0.902286947f, 0.277496904f},
-std::array<float,2>{0.115777746f, 0.777337909f},
-std::array<float,2>{0.799949467f, 0.936538756f},
-std::array<float,2>{0.160450205f, 0.437298119f},
-std::array<float,2>{0.675804198f, 0.0955526158f},
-std::array<float,2>{0.36120376f, 0.604995608f},
-std::array<float,2>{0.846503973f, 0.692700207f},
-std::array<float,2>{0.202326611f, 0.224841252f},
-std::array<float,2>{0.695486724f, 0.359340638f},
-std::array<float,2>{0.308270305f, 0.858159423f},
-std::array<float,2>{0.55147934f, 0.956780195f},
-std::array<float,2>{0.41859141f, 0.441802353f},
-std::array<float,2>{0.993078649f, 0.0148628382f},
-std::array<float,2>{0.00573457126f, 0.501889348f},
-std::array<float,2>{0.627712727f, 0.574354887f},
-std::array<float,2>{0.34175548f, 0.0823483765f},
-std::array<float,2>{0.773600221f, 0.384345889f},
-std::array<float,2>{0.153519496f, 0.887688398f},
-std::array<float,2>{0.908932686f, 0.807987988f},
-std::array<float,2>{0.089604117f, 0.282214046f},
-std::array<float,2>{0.614602625f, 0.143683091f},
-std::array<float,2>{0.447120041f, 0.681336701f},
-std::array<float,2>{0.828003228f, 0.594403803f},
-std::array<float,2>{0.248292133f, 0.105521277f},
-std::array<float,2>{0.748389959f, 0.426784366f},
-std::array<float,2>{0.259213895f, 0.922614455f},
-std::array<float,2>{0.510618091f, 0.77192688f},
-std::array<float,2>{0.39495942f, 0.266433597f},
-std::array<float,2>{0.945427358f, 0.168254778f},
-std::array<float,2>{0.0614682734f, 0.644684136f},
-std::array<float,2>{0.669082582f, 0.745954871f},
-std::array<float,2>{0.349286079f, 0.21064204f},
-std::array<float,2>{0.783820748f, 0.336502969f},
-std::array<float,2>{0.184598073f, 0.843201637f},
-std::array<float,2>{0.883761227f, 0.997119248f},
-std::array<float,2>{0.0994805768f, 0.474998504f},
-std::array<float,2>{0.577097356f, 0.0495333523f},
-std::array<float,2>{0.483508199f, 0.533009529f},
-std::array<float,2>{0.974211752f, 0.671948075f},
-std::array<float,2>{0.0221554656f, 0.155598834f},
-std::array<float,2>{0.534929872f, 0.29324612f},
-std::array<float,2>{0.42639637f, 0.796980143f},
-std::array<float,2>{0.717114329f, 0.877416313f},
-std::array<float,2>{0.292178392f, 0.377408564f},
-std::array<float,2>{0.867776811f, 0.0880068615f},
-std::array<float,2>{0.213657692f, 0.568450212f},
-std::array<float,2>{0.608118236f, 0.515074909f},
-std::array<float,2>{0.461972177f, 0.00179008907f},
-std::array<float,2>{0.936384737f, 0.449280471f},
-std::array<float,2>{0.0760204718f, 0.966030777f},
-std::array<float,2>{0.750364065f, 0.848175108f},
-std::array<float,2>{0.126509309f, 0.35040319f},
-std::array<float,2>{0.645417869f, 0.234304652f},
-std::array<float,2>{0.317313373f, 0.697760105f},
-std::array<float,2>{0.911750972f, 0.548127413f},
-std::array<float,2>{0.0922908857f, 0.0332421698f},
-std::array<float,2>{0.611422896f, 0.485131532f},
-std::array<float,2>{0.452597052f, 0.975344419f},
-std::array<float,2>{0.631593466f, 0.817029417f},
-std::array<float,2>{0.338502407f, 0.320022315f},
-std::array<float,2>{0.780213773f, 0.198787913f},
-std::array<float,2>{0.151083425f, 0.730019391f},
-std::array<float,2>{0.549072444f, 0.625115454f},
-std::array<float,2>{0.416655004f, 0.182391539f},
-std::array<float,2>{0.99846369f, 0.251134157f},
-std::array<float,2>{0.000173802691f, 0.758201599f},
-std::array<float,2>{0.849044204f, 0.915011644f},
-std::array<float,2>{0.198123321f, 0.411105931f},
-std::array<float,2>{0.700851858f, 0.124695219f},
-std::array<float,2>{0.311757088f, 0.61267972f},
-std::array<float,2>{0.803021669f, 0.71416688f},
-std::array<float,2>{0.15795739f, 0.235128343f},
-std::array<float,2>{0.673076987f, 0.373697281f},
-std::array<float,2>{0.363831818f, 0.871188581f},
-std::array<float,2>{0.583169818f, 0.943672121f},
-std::array<float,2>{0.499154299f, 0.454938263f},
-std::array<float,2>{0.902864814f, 0.0230252724f},
-std::array<float,2>{0.111858748f, 0.52727145f},
-std::array<float,2>{0.733656883f, 0.587427318f},
-std::array<float,2>{0.270436525f, 0.0758118629f},
-std::array<float,2>{0.837617636f, 0.39122504f},
-std::array<float,2>{0.22381492f, 0.905762255f},
-std::array<float,2>{0.966274619f, 0.794499218f},
-std::array<float,2>{0.0381739065f, 0.31075868f},
-std::array<float,2>{0.526088417f, 0.138399452f},
-std::array<float,2>{0.385037601f, 0.662456632f},
-std::array<float,2>{0.77252394f, 0.516053915f},
-std::array<float,2>{0.146996319f, 0.0303165168f},
-std::array<float,2>{0.636608779f, 0.465595782f},
-std::array<float,2>{0.333446264f, 0.952341914f},
-std::array<float,2>{0.624302983f, 0.866337061f},
-std::array<float,2>{0.440874875f, 0.365339786f},
-std::array<float,2>{0.915157735f, 0.249973491f},
-std::array<float,2>{0.0790425017f, 0.708385885f},
-std::array<float,2>{0.692103326f, 0.664724052f},
-std::array<float,2>{0.297555298f, 0.128131181f},
-std::array<float,2>{0.85775876f, 0.304657817f},
-std::array<float,2>{0.193076745f, 0.786576867f},
-std::array<float,2>{0.98916477f, 0.890626609f},
-std::array<float,2>{0.014233402f, 0.40305841f},
-std::array<float,2>{0.559015214f, 0.0679811612f},
-std::array<float,2>{0.411991954f, 0.583066523f},
-std::array<float,2>{0.896877527f, 0.721024811f},
-std::array<float,2>{0.122792803f, 0.189848319f},
-std::array<float,2>{0.590752542f, 0.323264688f},
-std::array<float,2>{0.488489389f, 0.825114548f},
-std::array<float,2>{0.686301172f, 0.97853899f},
-std::array<float,2>{0.373923928f, 0.497823983f},
-std::array<float,2>{0.811885893f, 0.0444362313f},
-std::array<float,2>{0.168345124f, 0.557154119f},
-std::array<float,2>{0.522073925f, 0.619672f},
-std::array<float,2>{0.37507236f, 0.112218365f},
-std::array<float,2>{0.95349133f, 0.416882306f},
-std::array<float,2>{0.0413420387f, 0.909238577f},
-std::array<float,2>{0.831322253f, 0.756171346f},
-std::array<float,2>{0.229726613f, 0.263638854f},
-std::array<float,2>{0.726252854f, 0.174789861f},
-std::array<float,2>{0.274940282f, 0.63892138f},
-std::array<float,2>{0.938458264f, 0.573486507f},
-std::array<float,2>{0.0485059507f, 0.0816519335f},
-std::array<float,2>{0.504794717f, 0.389344335f},
-std::array<float,2>{0.405694515f, 0.885070562f},
-std::array<float,2>{0.737901211f, 0.80983299f},
-std::array<float,2>{0.255930662f, 0.287265271f},
-std::array<float,2>{0.815214515f, 0.147739083f},
-std::array<float,2>{0.239977807f, 0.687414229f},
-std::array<float,2>{0.566951931f, 0.688364685f},
-std::array<float,2>{0.471301198f, 0.219045088f},
-std::array<float,2>{0.879532874f, 0.353180468f},
-std::array<float,2>{0.101820767f, 0.854179084f},
-std::array<float,2>{0.790417433f, 0.959458292f},
-std::array<float,2>{0.173558071f, 0.440079391f},
-std::array<float,2>{0.661537826f, 0.00947391056f},
-std::array<float,2>{0.356489092f, 0.504619777f},
-std::array<float,2>{0.860428572f, 0.64967066f},
-std::array<float,2>{0.205773681f, 0.161433056f},
-std::array<float,2>{0.710368454f, 0.275948733f},
-std::array<float,2>{0.288980335f, 0.777841628f},
-std::array<float,2>{0.545944393f, 0.932678461f},
-std::array<float,2>{0.432935148f, 0.431991905f},
-std::array<float,2>{0.983410895f, 0.100959346f},
-std::array<float,2>{0.0266243219f, 0.606833935f},
-std::array<float,2>{0.6506235f, 0.540084183f},
-std::array<float,2>{0.32751137f, 0.0572359227f},
-std::array<float,2>{0.762887299f, 0.478320688f},
-std::array<float,2>{0.13559626f, 0.985397696f},
-std::array<float,2>{0.929683864f, 0.831009805f},
-std::array<float,2>{0.0698721409f, 0.332677245f},
-std::array<float,2>{0.599776268f, 0.211599946f},
-std::array<float,2>{0.456208378f, 0.735801876f},
-std::array<float,2>{0.853838444f, 0.538630724f},
-std::array<float,2>{0.189947978f, 0.0512857065f},
-std::array<float,2>{0.688510478f, 0.47262305f},
-std::array<float,2>{0.30403471f, 0.994809687f},
-std::array<float,2>{0.556724846f, 0.836572111f},
-std::array<float,2>{0.406851411f, 0.340341896f},
-std::array<float,2>{0.9869017f, 0.206300274f},
-std::array<float,2>{0.0101223178f, 0.747034013f},
-std::array<float,2>{0.638504922f, 0.640986919f},
-std::array<float,2>{0.330721587f, 0.167704374f},
-std::array<float,2>{0.769502759f, 0.271880835f},
-std::array<float,2>{0.14338854f, 0.76730454f},
-std::array<float,2>{0.920252681f, 0.929623485f},
-std::array<float,2>{0.0826447904f, 0.423244476f},
-std::array<float,2>{0.620556116f, 0.104110196f},
-std::array<float,2>{0.441629022f, 0.598596334f},
-std::array<float,2>{0.958769083f, 0.701543629f},
-std::array<float,2>{0.0463656709f, 0.228070602f},
-std::array<float,2>{0.51939404f, 0.346459657f},
-std::array<float,2>{0.381042331f, 0.845051229f},
-std::array<float,2>{0.720159292f, 0.963989139f},
-std::array<float,2>{0.279231161f, 0.447511852f},
-std::array<float,2>{0.833796442f, 0.00676571066f},
-std::array<float,2>{0.23308605f, 0.511459589f},
-std::array<float,2>{0.586332262f, 0.565631151f},
-std::array<float,2>{0.485999227f, 0.0910998881f},
-std::array<float,2>{0.892092466f, 0.382557899f},
-std::array<float,2>{0.118263878f, 0.879900634f},
-std::array<float,2>{0.807649493f, 0.801974714f},
-std::array<float,2>{0.166089296f, 0.290660053f},
-std::array<float,2>{0.680672169f, 0.150849581f},
-std::array<float,2>{0.368355751f, 0.678323209f},
-std::array<float,2>{0.876655519f, 0.616777778f},
-std::array<float,2>{0.106108904f, 0.117444582f},
-std::array<float,2>{0.564176202f, 0.407425672f},
-std::array<float,2>{0.472946316f, 0.918252349f},
-std::array<float,2>{0.658580422f, 0.763633013f},
-std::array<float,2>{0.3521249f, 0.254597217f},
-std::array<float,2>{0.79618758f, 0.186832741f},
-std::array<float,2>{0.177181751f, 0.630641758f},
-std::array<float,2>{0.500688136f, 0.732220411f},
-std::array<float,2>{0.399822026f, 0.199323162f},
-std::array<float,2>{0.94491452f, 0.314431161f},
-std::array<float,2>{0.0532839485f, 0.813320458f},
-std::array<float,2>{0.816455543f, 0.972259998f},
-std::array<float,2>{0.237944439f, 0.491278112f},
-std::array<float,2>{0.738589168f, 0.035340555f},
-std::array<float,2>{0.253226936f, 0.554018021f},
-std::array<float,2>{0.760091126f, 0.656544745f},
-std::array<float,2>{0.136889979f, 0.133109108f},
-std::array<float,2>{0.655772805f, 0.306171179f},
-std::array<float,2>{0.320788264f, 0.79169333f},
-std::array<float,2>{0.596025944f, 0.900970995f},
-std::array<float,2>{0.45879218f, 0.394719243f},
-std::array<float,2>{0.922647834f, 0.0720592588f},
-std::array<float,2>{0.0627242029f, 0.589986503f},
-std::array<float,2>{0.705357909f, 0.529203892f},
-std::array<float,2>{0.284215629f, 0.0176366884f},
-std::array<float,2>{0.865329564f, 0.459741056f},
-std::array<float,2>{0.21086885f, 0.939679623f},
-std::array<float,2>{0.979894817f, 0.86758548f},
-std::array<float,2>{0.0303653702f, 0.370367706f},
-std::array<float,2>{0.540303409f, 0.241969585f},
-std::array<float,2>{0.435125977f, 0.715198576f},
-std::array<float,2>{0.788032889f, 0.581985891f},
-std::array<float,2>{0.180661187f, 0.0656408072f},
-std::array<float,2>{0.667031229f, 0.401860416f},
-std::array<float,2>{0.344494402f, 0.897013664f},
-std::array<float,2>{0.572756469f, 0.781269848f},
-std::array<float,2>{0.476722866f, 0.297206163f},
-std::array<float,2>{0.888151884f, 0.131254792f},
-std::array<float,2>{0.0939916372f, 0.668735683f},
-std::array<float,2>{0.744144678f, 0.706434608f},
-std::array<float,2>{0.264350206f, 0.24364078f},
-std::array<float,2>{0.823208749f, 0.360156685f},
-std::array<float,2>{0.246029139f, 0.862221539f},
-std::array<float,2>{0.950766504f, 0.945952296f},
-std::array<float,2>{0.0575987212f, 0.464781821f},
-std::array<float,2>{0.514890492f, 0.0251555685f},
-std::array<float,2>{0.391332209f, 0.520243824f},
-std::array<float,2>{0.931685269f, 0.636213541f},
-std::array<float,2>{0.0722924098f, 0.178831369f},
-std::array<float,2>{0.603614509f, 0.261127591f},
-std::array<float,2>{0.466540307f, 0.753261507f},
-std::array<float,2>{0.641694725f, 0.91024065f},
-std::array<float,2>{0.313342363f, 0.418911576f},
-std::array<float,2>{0.756129026f, 0.113794155f},
-std::array<float,2>{0.130894214f, 0.621714711f},
-std::array<float,2>{0.537113845f, 0.561156034f},
-std::array<float,2>{0.424152493f, 0.0422148891f},
-std::array<float,2>{0.972095847f, 0.49571082f},
-std::array<float,2>{0.0177735817f, 0.983748317f},
-std::array<float,2>{0.872835219f, 0.821274221f},
-std::array<float,2>{0.218318924f, 0.324727565f},
-std::array<float,2>{0.714369595f, 0.191999063f},
-std::array<float,2>{0.295560747f, 0.725917161f},
-std::array<float,2>{0.995449305f, 0.502325654f},
-std::array<float,2>{0.00730110658f, 0.0129387155f},
-std::array<float,2>{0.553589523f, 0.444552332f},
-std::array<float,2>{0.419942498f, 0.954215825f},
-std::array<float,2>{0.697351754f, 0.856794f},
-std::array<float,2>{0.305252403f, 0.357203752f},
-std::array<float,2>{0.845104039f, 0.222682521f},
-std::array<float,2>{0.199914962f, 0.694283128f},
-std::array<float,2>{0.616592467f, 0.682459414f},
-std::array<float,2>{0.448765993f, 0.141350448f},
-std::array<float,2>{0.907169878f, 0.284713656f},
-std::array<float,2>{0.0862028822f, 0.805488825f},
-std::array<float,2>{0.777283311f, 0.889148772f},
-std::array<float,2>{0.15540348f, 0.386700898f},
-std::array<float,2>{0.626759708f, 0.0844081044f},
-std::array<float,2>{0.342348844f, 0.577175677f},
-std::array<float,2>{0.8417238f, 0.742042303f},
-std::array<float,2>{0.2220404f, 0.217899442f},
-std::array<float,2>{0.727357745f, 0.32947734f},
-std::array<float,2>{0.26899749f, 0.833944023f},
-std::array<float,2>{0.528109014f, 0.991417527f},
-std::array<float,2>{0.389093161f, 0.480474472f},
-std::array<float,2>{0.961062133f, 0.0603043474f},
-std::array<float,2>{0.0344822071f, 0.543910146f},
-std::array<float,2>{0.679133713f, 0.602999687f},
-std::array<float,2>{0.36243543f, 0.0958822295f},
-std::array<float,2>{0.798556924f, 0.434233218f},
-std::array<float,2>{0.16251485f, 0.934345126f},
-std::array<float,2>{0.900321364f, 0.774146259f},
-std::array<float,2>{0.114083618f, 0.279775769f},
-std::array<float,2>{0.581483006f, 0.159531683f},
-std::array<float,2>{0.49594155f, 0.653563738f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.473474592f, 0.272001982f},
-std::array<float,2>{0.751050711f, 0.752655327f},
-std::array<float,2>{0.689346671f, 0.244580224f},
-std::array<float,2>{0.0359954797f, 0.686934829f},
-std::array<float,2>{0.227730811f, 0.0895567015f},
-std::array<float,2>{0.601584494f, 0.59317857f},
-std::array<float,2>{0.885616124f, 0.487507075f},
-std::array<float,2>{0.290542781f, 0.965844691f},
-std::array<float,2>{0.357178867f, 0.161426052f},
-std::array<float,2>{0.995962203f, 0.720212102f},
-std::array<float,2>{0.528986692f, 0.322856098f},
-std::array<float,2>{0.139090449f, 0.84613955f},
-std::array<float,2>{0.107716464f, 0.416888237f},
-std::array<float,2>{0.638333023f, 0.914339304f},
-std::array<float,2>{0.871336281f, 0.0598759986f},
-std::array<float,2>{0.427654773f, 0.535273373f},
-std::array<float,2>{0.257652283f, 0.439964563f},
-std::array<float,2>{0.916296661f, 0.975246251f},
-std::array<float,2>{0.575285137f, 0.111156464f},
-std::array<float,2>{0.21545434f, 0.611089647f},
-std::array<float,2>{0.0140815033f, 0.199571133f},
-std::array<float,2>{0.721973538f, 0.653994441f},
-std::array<float,2>{0.804391921f, 0.285310715f},
-std::array<float,2>{0.437576383f, 0.804129958f},
-std::array<float,2>{0.390712142f, 0.0213939864f},
-std::array<float,2>{0.832044959f, 0.510466337f},
-std::array<float,2>{0.665043414f, 0.400012374f},
-std::array<float,2>{0.0911150128f, 0.903903782f},
-std::array<float,2>{0.170956269f, 0.347794324f},
-std::array<float,2>{0.554775655f, 0.840529561f},
-std::array<float,2>{0.951511204f, 0.125288978f},
-std::array<float,2>{0.312910914f, 0.700111032f},
-std::array<float,2>{0.408077627f, 0.383295238f},
-std::array<float,2>{0.847956419f, 0.877657413f},
-std::array<float,2>{0.649865389f, 0.00100297853f},
-std::array<float,2>{0.120230868f, 0.527577102f},
-std::array<float,2>{0.14822945f, 0.152353838f},
-std::array<float,2>{0.503519177f, 0.7035712f},
-std::array<float,2>{0.983343184f, 0.370851278f},
-std::array<float,2>{0.370548785f, 0.824106216f},
-std::array<float,2>{0.303543001f, 0.0985983536f},
-std::array<float,2>{0.900394082f, 0.598243535f},
-std::array<float,2>{0.621554732f, 0.460647434f},
-std::array<float,2>{0.245918721f, 0.997147262f},
-std::array<float,2>{0.0490805842f, 0.308496892f},
-std::array<float,2>{0.71320039f, 0.791407526f},
-std::array<float,2>{0.76634115f, 0.208778709f},
-std::array<float,2>{0.488063812f, 0.640056908f},
-std::array<float,2>{0.332612485f, 0.343374044f},
-std::array<float,2>{0.962002933f, 0.87441057f},
-std::array<float,2>{0.531890273f, 0.186971501f},
-std::array<float,2>{0.179354981f, 0.744977534f},
-std::array<float,2>{0.0737821534f, 0.0387145169f},
-std::array<float,2>{0.672625482f, 0.554318368f},
-std::array<float,2>{0.823215961f, 0.434394836f},
-std::array<float,2>{0.389359266f, 0.932341337f},
-std::array<float,2>{0.458255619f, 0.23046875f},
-std::array<float,2>{0.796190083f, 0.664113104f},
-std::array<float,2>{0.745060027f, 0.262499154f},
-std::array<float,2>{0.0240444038f, 0.7723701f},
-std::array<float,2>{0.189690202f, 0.475199223f},
-std::array<float,2>{0.586193383f, 0.940173626f},
-std::array<float,2>{0.923776567f, 0.0709357634f},
-std::array<float,2>{0.268527389f, 0.574035347f},
-std::array<float,2>{0.377363622f, 0.365186751f},
-std::array<float,2>{0.81983155f, 0.819704711f},
-std::array<float,2>{0.681846559f, 0.147487178f},
-std::array<float,2>{0.0653563216f, 0.71216011f},
-std::array<float,2>{0.180628672f, 0.0153566962f},
-std::array<float,2>{0.546591043f, 0.518930614f},
-std::array<float,2>{0.953368604f, 0.381656468f},
-std::array<float,2>{0.341978073f, 0.885406315f},
-std::array<float,2>{0.278139681f, 0.215825453f},
-std::array<float,2>{0.936434925f, 0.629837096f},
-std::array<float,2>{0.582844615f, 0.29757458f},
-std::array<float,2>{0.1961319f, 0.786806285f},
-std::array<float,2>{0.0220023673f, 0.466127574f},
-std::array<float,2>{0.734783411f, 0.987839043f},
-std::array<float,2>{0.782198071f, 0.102226175f},
-std::array<float,2>{0.463687778f, 0.607304454f},
-std::array<float,2>{0.36434561f, 0.424836278f},
-std::array<float,2>{0.972742975f, 0.928452194f},
-std::array<float,2>{0.508137345f, 0.0428723209f},
-std::array<float,2>{0.156044915f, 0.561805129f},
-std::array<float,2>{0.110065728f, 0.17717889f},
-std::array<float,2>{0.647130609f, 0.740027308f},
-std::array<float,2>{0.852441549f, 0.330301791f},
-std::array<float,2>{0.419537187f, 0.866318107f},
-std::array<float,2>{0.496701211f, 0.065273881f},
-std::array<float,2>{0.776098013f, 0.569480479f},
-std::array<float,2>{0.71091491f, 0.480909735f},
-std::array<float,2>{0.059789557f, 0.951934576f},
-std::array<float,2>{0.238521174f, 0.25543946f},
-std::array<float,2>{0.613128304f, 0.77418679f},
-std::array<float,2>{0.894675672f, 0.222258508f},
-std::array<float,2>{0.309252352f, 0.657522321f},
-std::array<float,2>{0.452097565f, 0.496988803f},
-std::array<float,2>{0.807509363f, 0.955292046f},
-std::array<float,2>{0.732031226f, 0.0808552429f},
-std::array<float,2>{0.00167823152f, 0.583623111f},
-std::array<float,2>{0.205732524f, 0.234394014f},
-std::array<float,2>{0.565860212f, 0.673156381f},
-std::array<float,2>{0.913257599f, 0.274289072f},
-std::array<float,2>{0.259225041f, 0.758297622f},
-std::array<float,2>{0.323218018f, 0.0513116643f},
-std::array<float,2>{0.943269789f, 0.540702105f},
-std::array<float,2>{0.553161263f, 0.413247406f},
-std::array<float,2>{0.156446323f, 0.910589099f},
-std::array<float,2>{0.0811634734f, 0.317588985f},
-std::array<float,2>{0.657133281f, 0.85594517f},
-std::array<float,2>{0.838998973f, 0.165107369f},
-std::array<float,2>{0.398707807f, 0.728260279f},
-std::array<float,2>{0.284954756f, 0.293624252f},
-std::array<float,2>{0.880982876f, 0.810112715f},
-std::array<float,2>{0.599305332f, 0.191383332f},
-std::array<float,2>{0.220647424f, 0.642845333f},
-std::array<float,2>{0.0458690859f, 0.122806087f},
-std::array<float,2>{0.696405172f, 0.617723286f},
-std::array<float,2>{0.76343137f, 0.446894825f},
-std::array<float,2>{0.478006423f, 0.982231736f},
-std::array<float,2>{0.430585504f, 0.1398516f},
-std::array<float,2>{0.863783062f, 0.689919293f},
-std::array<float,2>{0.632140517f, 0.357113838f},
-std::array<float,2>{0.0979673117f, 0.829296827f},
-std::array<float,2>{0.126957208f, 0.396956772f},
-std::array<float,2>{0.51933372f, 0.895550728f},
-std::array<float,2>{0.986742914f, 0.0244919043f},
-std::array<float,2>{0.345327914f, 0.502024591f},
-std::array<float,2>{0.42201674f, 0.304672986f},
-std::array<float,2>{0.87001121f, 0.784754455f},
-std::array<float,2>{0.63638407f, 0.212971464f},
-std::array<float,2>{0.101878926f, 0.62864846f},
-std::array<float,2>{0.133691773f, 0.106030546f},
-std::array<float,2>{0.527274191f, 0.604469895f},
-std::array<float,2>{0.99719739f, 0.464306474f},
-std::array<float,2>{0.352985978f, 0.99037385f},
-std::array<float,2>{0.293162614f, 0.143806502f},
-std::array<float,2>{0.890561938f, 0.715472281f},
-std::array<float,2>{0.608166635f, 0.360409111f},
-std::array<float,2>{0.231599495f, 0.816361308f},
-std::array<float,2>{0.0321497284f, 0.378261358f},
-std::array<float,2>{0.693881273f, 0.887526691f},
-std::array<float,2>{0.754597664f, 0.00831829011f},
-std::array<float,2>{0.470083207f, 0.522686481f},
-std::array<float,2>{0.317965388f, 0.478376299f},
-std::array<float,2>{0.945593834f, 0.947611451f},
-std::array<float,2>{0.559905291f, 0.0702620968f},
-std::array<float,2>{0.16489172f, 0.563387215f},
-std::array<float,2>{0.0894952118f, 0.223983884f},
-std::array<float,2>{0.668237686f, 0.660447538f},
-std::array<float,2>{0.829599559f, 0.251733869f},
-std::array<float,2>{0.397856176f, 0.779861689f},
-std::array<float,2>{0.441467285f, 0.0431479104f},
-std::array<float,2>{0.797547042f, 0.5556885f},
-std::array<float,2>{0.726522923f, 0.426649511f},
-std::array<float,2>{0.00867589284f, 0.922341943f},
-std::array<float,2>{0.211173981f, 0.332643569f},
-std::array<float,2>{0.570583284f, 0.863229334f},
-std::array<float,2>{0.920970738f, 0.175470427f},
-std::array<float,2>{0.252601355f, 0.734759331f},
-std::array<float,2>{0.488812f, 0.408522874f},
-std::array<float,2>{0.772693813f, 0.906716943f},
-std::array<float,2>{0.717448115f, 0.0495632365f},
-std::array<float,2>{0.0516860746f, 0.54554534f},
-std::array<float,2>{0.246706575f, 0.169437081f},
-std::array<float,2>{0.618774235f, 0.731319606f},
-std::array<float,2>{0.905312359f, 0.314404845f},
-std::array<float,2>{0.300284296f, 0.854568243f},
-std::array<float,2>{0.373208314f, 0.0835734233f},
-std::array<float,2>{0.977338314f, 0.581086755f},
-std::array<float,2>{0.505023897f, 0.493739903f},
-std::array<float,2>{0.142826572f, 0.959402025f},
-std::array<float,2>{0.122043267f, 0.280342996f},
-std::array<float,2>{0.654730141f, 0.763150334f},
-std::array<float,2>{0.845646322f, 0.239565685f},
-std::array<float,2>{0.411117405f, 0.676348984f},
-std::array<float,2>{0.271864504f, 0.351718009f},
-std::array<float,2>{0.929255784f, 0.832527399f},
-std::array<float,2>{0.591305494f, 0.135868117f},
-std::array<float,2>{0.193114385f, 0.692117929f},
-std::array<float,2>{0.0297788363f, 0.0276027545f},
-std::array<float,2>{0.746789575f, 0.507699132f},
-std::array<float,2>{0.790610135f, 0.393339276f},
-std::array<float,2>{0.455272377f, 0.891203165f},
-std::array<float,2>{0.385771006f, 0.194756374f},
-std::array<float,2>{0.82548815f, 0.645089567f},
-std::array<float,2>{0.676401377f, 0.289734215f},
-std::array<float,2>{0.0764485523f, 0.805145025f},
-std::array<float,2>{0.17363517f, 0.452250987f},
-std::array<float,2>{0.537113845f, 0.978992581f},
-std::array<float,2>{0.964960217f, 0.118163623f},
-std::array<float,2>{0.329285175f, 0.621869326f},
-std::array<float,2>{0.464999229f, 0.325722843f},
-std::array<float,2>{0.788910151f, 0.850049436f},
-std::array<float,2>{0.741050184f, 0.156311437f},
-std::array<float,2>{0.0184385534f, 0.726335526f},
-std::array<float,2>{0.199227676f, 0.0550557561f},
-std::array<float,2>{0.581012428f, 0.534689128f},
-std::array<float,2>{0.931402266f, 0.421796501f},
-std::array<float,2>{0.273971796f, 0.920639396f},
-std::array<float,2>{0.33872655f, 0.249979883f},
-std::array<float,2>{0.959214151f, 0.68097192f},
-std::array<float,2>{0.542636454f, 0.266418844f},
-std::array<float,2>{0.185458139f, 0.756914675f},
-std::array<float,2>{0.0694562271f, 0.488890499f},
-std::array<float,2>{0.684913695f, 0.963037848f},
-std::array<float,2>{0.814448059f, 0.0927733183f},
-std::array<float,2>{0.379104882f, 0.587335229f},
-std::array<float,2>{0.306866974f, 0.40251556f},
-std::array<float,2>{0.894483447f, 0.899693072f},
-std::array<float,2>{0.615456104f, 0.0164144132f},
-std::array<float,2>{0.237570018f, 0.512091041f},
-std::array<float,2>{0.0577653237f, 0.129149288f},
-std::array<float,2>{0.704262614f, 0.698780835f},
-std::array<float,2>{0.780366123f, 0.344968587f},
-std::array<float,2>{0.493213207f, 0.838300884f},
-std::array<float,2>{0.414104015f, 0.115589f},
-std::array<float,2>{0.859241605f, 0.614299357f},
-std::array<float,2>{0.641304076f, 0.445254475f},
-std::array<float,2>{0.116188489f, 0.969264388f},
-std::array<float,2>{0.15180783f, 0.282203436f},
-std::array<float,2>{0.514347732f, 0.797932446f},
-std::array<float,2>{0.970576108f, 0.197290316f},
-std::array<float,2>{0.36156702f, 0.649241209f},
-std::array<float,2>{0.405607432f, 0.456131637f},
-std::array<float,2>{0.840010345f, 0.992978036f},
-std::array<float,2>{0.662729681f, 0.095601052f},
-std::array<float,2>{0.0848863423f, 0.596608937f},
-std::array<float,2>{0.160304949f, 0.204479828f},
-std::array<float,2>{0.549523294f, 0.634767771f},
-std::array<float,2>{0.941246629f, 0.310914695f},
-std::array<float,2>{0.326453209f, 0.796304941f},
-std::array<float,2>{0.264653236f, 0.00621332787f},
-std::array<float,2>{0.906841397f, 0.525615394f},
-std::array<float,2>{0.570212781f, 0.38945356f},
-std::array<float,2>{0.207713604f, 0.880313158f},
-std::array<float,2>{0.00551141892f, 0.374697f},
-std::array<float,2>{0.727876067f, 0.824253917f},
-std::array<float,2>{0.808749974f, 0.151488498f},
-std::array<float,2>{0.449056834f, 0.710690618f},
-std::array<float,2>{0.350273013f, 0.260328859f},
-std::array<float,2>{0.990364194f, 0.766844988f},
-std::array<float,2>{0.520272553f, 0.233803511f},
-std::array<float,2>{0.132759318f, 0.6684255f},
-std::array<float,2>{0.0966392234f, 0.0748576969f},
-std::array<float,2>{0.626404464f, 0.574285924f},
-std::array<float,2>{0.859909534f, 0.47029227f},
-std::array<float,2>{0.43463403f, 0.944978356f},
-std::array<float,2>{0.482800364f, 0.180876598f},
-std::array<float,2>{0.759607971f, 0.747318864f},
-std::array<float,2>{0.701306641f, 0.337664008f},
-std::array<float,2>{0.0423864909f, 0.870080709f},
-std::array<float,2>{0.226309031f, 0.432122916f},
-std::array<float,2>{0.597357452f, 0.937176526f},
-std::array<float,2>{0.878558695f, 0.0314912312f},
-std::array<float,2>{0.286960959f, 0.548514664f},
-std::array<float,2>{0.441269666f, 0.288716882f},
-std::array<float,2>{0.802027345f, 0.801854074f},
-std::array<float,2>{0.720307946f, 0.201899454f},
-std::array<float,2>{0.0121197263f, 0.655297875f},
-std::array<float,2>{0.216917679f, 0.113228157f},
-std::array<float,2>{0.576775014f, 0.613044083f},
-std::array<float,2>{0.914352059f, 0.439057529f},
-std::array<float,2>{0.253992975f, 0.974280715f},
-std::array<float,2>{0.316073626f, 0.128749609f},
-std::array<float,2>{0.949238479f, 0.702438235f},
-std::array<float,2>{0.557840586f, 0.349915326f},
-std::array<float,2>{0.16859211f, 0.842741668f},
-std::array<float,2>{0.0925034508f, 0.400391549f},
-std::array<float,2>{0.666476071f, 0.905099809f},
-std::array<float,2>{0.834490716f, 0.0228100382f},
-std::array<float,2>{0.393178403f, 0.509490788f},
-std::array<float,2>{0.292819589f, 0.486249f},
-std::array<float,2>{0.884506166f, 0.968732715f},
-std::array<float,2>{0.604302108f, 0.0869552568f},
-std::array<float,2>{0.228710398f, 0.590666354f},
-std::array<float,2>{0.0375451222f, 0.242712438f},
-std::array<float,2>{0.689483166f, 0.684340835f},
-std::array<float,2>{0.752654076f, 0.269572288f},
-std::array<float,2>{0.476333112f, 0.751615644f},
-std::array<float,2>{0.42896235f, 0.061067652f},
-std::array<float,2>{0.874917328f, 0.537944257f},
-std::array<float,2>{0.6394853f, 0.414889991f},
-std::array<float,2>{0.106286645f, 0.916775644f},
-std::array<float,2>{0.138023078f, 0.321130753f},
-std::array<float,2>{0.529570043f, 0.845010877f},
-std::array<float,2>{0.992845356f, 0.163176641f},
-std::array<float,2>{0.358265579f, 0.721810102f},
-std::array<float,2>{0.387872398f, 0.43596071f},
-std::array<float,2>{0.820507765f, 0.93013823f},
-std::array<float,2>{0.675620914f, 0.0360767916f},
-std::array<float,2>{0.072241433f, 0.551842749f},
-std::array<float,2>{0.177045599f, 0.185136259f},
-std::array<float,2>{0.533674777f, 0.743765891f},
-std::array<float,2>{0.964417636f, 0.341237307f},
-std::array<float,2>{0.33513099f, 0.872846723f},
-std::array<float,2>{0.266596138f, 0.0724013746f},
-std::array<float,2>{0.924236476f, 0.571007073f},
-std::array<float,2>{0.58888191f, 0.474302828f},
-std::array<float,2>{0.187987819f, 0.938459098f},
-std::array<float,2>{0.0265663322f, 0.265419483f},
-std::array<float,2>{0.743671715f, 0.770266652f},
-std::array<float,2>{0.794283152f, 0.227287322f},
-std::array<float,2>{0.459101915f, 0.666072547f},
-std::array<float,2>{0.369110405f, 0.367847055f},
-std::array<float,2>{0.981805146f, 0.822165787f},
-std::array<float,2>{0.501454949f, 0.155519843f},
-std::array<float,2>{0.146155789f, 0.706864059f},
-std::array<float,2>{0.118370779f, 0.00321358046f},
-std::array<float,2>{0.652270198f, 0.530693293f},
-std::array<float,2>{0.850328088f, 0.386570603f},
-std::array<float,2>{0.408567011f, 0.875015914f},
-std::array<float,2>{0.484637499f, 0.2098528f},
-std::array<float,2>{0.769060969f, 0.637759984f},
-std::array<float,2>{0.711997688f, 0.304735124f},
-std::array<float,2>{0.0478883535f, 0.790751696f},
-std::array<float,2>{0.243456021f, 0.45863384f},
-std::array<float,2>{0.623950779f, 0.999507666f},
-std::array<float,2>{0.899820209f, 0.100023396f},
-std::array<float,2>{0.301120132f, 0.600142062f},
-std::array<float,2>{0.420784146f, 0.329954624f},
-std::array<float,2>{0.853836477f, 0.863601267f},
-std::array<float,2>{0.644800007f, 0.179057315f},
-std::array<float,2>{0.111848548f, 0.740954161f},
-std::array<float,2>{0.153500915f, 0.0394240394f},
-std::array<float,2>{0.509819448f, 0.55897218f},
-std::array<float,2>{0.97502178f, 0.422787875f},
-std::array<float,2>{0.366841406f, 0.926941574f},
-std::array<float,2>{0.311569124f, 0.219077423f},
-std::array<float,2>{0.898100734f, 0.659629822f},
-std::array<float,2>{0.609950602f, 0.257184535f},
-std::array<float,2>{0.242040977f, 0.777328491f},
-std::array<float,2>{0.0606498942f, 0.483891845f},
-std::array<float,2>{0.707210422f, 0.95002085f},
-std::array<float,2>{0.774423301f, 0.0626416057f},
-std::array<float,2>{0.4983913f, 0.566413224f},
-std::array<float,2>{0.340535015f, 0.380429924f},
-std::array<float,2>{0.955619395f, 0.884705961f},
-std::array<float,2>{0.544538438f, 0.0126968212f},
-std::array<float,2>{0.183404744f, 0.51680696f},
-std::array<float,2>{0.063664183f, 0.14608933f},
-std::array<float,2>{0.679715812f, 0.713495672f},
-std::array<float,2>{0.817395508f, 0.366196245f},
-std::array<float,2>{0.37634477f, 0.818108916f},
-std::array<float,2>{0.461253345f, 0.104622088f},
-std::array<float,2>{0.784220815f, 0.608428597f},
-std::array<float,2>{0.737962782f, 0.467445523f},
-std::array<float,2>{0.02078107f, 0.984895289f},
-std::array<float,2>{0.198585689f, 0.300652593f},
-std::array<float,2>{0.585370779f, 0.788958669f},
-std::array<float,2>{0.934778214f, 0.217411488f},
-std::array<float,2>{0.280460417f, 0.63124752f},
-std::array<float,2>{0.479146063f, 0.448859811f},
-std::array<float,2>{0.763998389f, 0.983919322f},
-std::array<float,2>{0.699203908f, 0.124090575f},
-std::array<float,2>{0.044345852f, 0.619471669f},
-std::array<float,2>{0.221880376f, 0.188696593f},
-std::array<float,2>{0.600077271f, 0.641231418f},
-std::array<float,2>{0.880793273f, 0.296241701f},
-std::array<float,2>{0.282481432f, 0.811212599f},
-std::array<float,2>{0.346181452f, 0.0255983453f},
-std::array<float,2>{0.985549688f, 0.50006187f},
-std::array<float,2>{0.515683651f, 0.395863563f},
-std::array<float,2>{0.125205278f, 0.896689773f},
-std::array<float,2>{0.100017413f, 0.358791411f},
-std::array<float,2>{0.630679905f, 0.831219316f},
-std::array<float,2>{0.867148876f, 0.136749938f},
-std::array<float,2>{0.432216197f, 0.688008547f},
-std::array<float,2>{0.260737687f, 0.277007103f},
-std::array<float,2>{0.910352468f, 0.759992719f},
-std::array<float,2>{0.563796997f, 0.236669227f},
-std::array<float,2>{0.204160899f, 0.674720824f},
-std::array<float,2>{0.00281710271f, 0.0794387609f},
-std::array<float,2>{0.733318329f, 0.585696876f},
-std::array<float,2>{0.806235313f, 0.498839289f},
-std::array<float,2>{0.450399756f, 0.953698933f},
-std::array<float,2>{0.401645303f, 0.166721687f},
-std::array<float,2>{0.836647093f, 0.730085135f},
-std::array<float,2>{0.659157038f, 0.31908977f},
-std::array<float,2>{0.0796816051f, 0.858848333f},
-std::array<float,2>{0.15866147f, 0.410558522f},
-std::array<float,2>{0.55085361f, 0.91268754f},
-std::array<float,2>{0.943746269f, 0.0538784303f},
-std::array<float,2>{0.321862996f, 0.542871594f},
-std::array<float,2>{0.395373195f, 0.253660321f},
-std::array<float,2>{0.831990778f, 0.779126942f},
-std::array<float,2>{0.671594501f, 0.226560429f},
-std::array<float,2>{0.0872439519f, 0.662552834f},
-std::array<float,2>{0.167114168f, 0.0672777966f},
-std::array<float,2>{0.561769009f, 0.56447506f},
-std::array<float,2>{0.948312044f, 0.478776038f},
-std::array<float,2>{0.319330961f, 0.945905745f},
-std::array<float,2>{0.25050965f, 0.173678756f},
-std::array<float,2>{0.918683529f, 0.737420321f},
-std::array<float,2>{0.573573351f, 0.335453928f},
-std::array<float,2>{0.214247584f, 0.860913336f},
-std::array<float,2>{0.0114969173f, 0.429406464f},
-std::array<float,2>{0.723504484f, 0.924641013f},
-std::array<float,2>{0.799494922f, 0.0465254076f},
-std::array<float,2>{0.443917304f, 0.557617843f},
-std::array<float,2>{0.355250776f, 0.462726533f},
-std::array<float,2>{0.998602211f, 0.990034878f},
-std::array<float,2>{0.524870336f, 0.107773192f},
-std::array<float,2>{0.135970518f, 0.601967156f},
-std::array<float,2>{0.104429074f, 0.211520121f},
-std::array<float,2>{0.634113193f, 0.626630366f},
-std::array<float,2>{0.867784202f, 0.302589089f},
-std::array<float,2>{0.425210178f, 0.783150136f},
-std::array<float,2>{0.472490638f, 0.00999334175f},
-std::array<float,2>{0.757616282f, 0.520389616f},
-std::array<float,2>{0.692902982f, 0.375102669f},
-std::array<float,2>{0.0342768431f, 0.88946563f},
-std::array<float,2>{0.234070137f, 0.362408608f},
-std::array<float,2>{0.606015325f, 0.813192427f},
-std::array<float,2>{0.887006581f, 0.142067f},
-std::array<float,2>{0.296279937f, 0.716992259f},
-std::array<float,2>{0.454003185f, 0.39089486f},
-std::array<float,2>{0.792125106f, 0.893156528f},
-std::array<float,2>{0.748385131f, 0.0310908146f},
-std::array<float,2>{0.0278135184f, 0.503949404f},
-std::array<float,2>{0.193654045f, 0.13398841f},
-std::array<float,2>{0.59200561f, 0.69477582f},
-std::array<float,2>{0.926673472f, 0.35369128f},
-std::array<float,2>{0.270579964f, 0.835665405f},
-std::array<float,2>{0.331829727f, 0.119798735f},
-std::array<float,2>{0.967068493f, 0.623342633f},
-std::array<float,2>{0.535917759f, 0.449237376f},
-std::array<float,2>{0.175017878f, 0.977951229f},
-std::array<float,2>{0.0749508739f, 0.291915834f},
-std::array<float,2>{0.677842736f, 0.807744026f},
-std::array<float,2>{0.826828718f, 0.191801086f},
-std::array<float,2>{0.383018672f, 0.647766173f},
-std::array<float,2>{0.298110574f, 0.315340281f},
-std::array<float,2>{0.904275f, 0.853221893f},
-std::array<float,2>{0.620991409f, 0.170311376f},
-std::array<float,2>{0.248721823f, 0.732868016f},
-std::array<float,2>{0.0528491065f, 0.0484775044f},
-std::array<float,2>{0.715740979f, 0.543254793f},
-std::array<float,2>{0.770302236f, 0.406808257f},
-std::array<float,2>{0.491056085f, 0.909333467f},
-std::array<float,2>{0.413605988f, 0.241405502f},
-std::array<float,2>{0.84642601f, 0.678684592f},
-std::array<float,2>{0.653911889f, 0.277659625f},
-std::array<float,2>{0.123732194f, 0.764155567f},
-std::array<float,2>{0.142185688f, 0.4944956f},
-std::array<float,2>{0.506667197f, 0.958362699f},
-std::array<float,2>{0.980202556f, 0.0853899941f},
-std::array<float,2>{0.371900231f, 0.579327822f},
-std::array<float,2>{0.495231867f, 0.347508401f},
-std::array<float,2>{0.778392553f, 0.837016821f},
-std::array<float,2>{0.705859005f, 0.131274924f},
-std::array<float,2>{0.0564359352f, 0.696017027f},
-std::array<float,2>{0.234784633f, 0.0176090319f},
-std::array<float,2>{0.613758743f, 0.513707399f},
-std::array<float,2>{0.892206013f, 0.404627532f},
-std::array<float,2>{0.305078834f, 0.902177095f},
-std::array<float,2>{0.359458655f, 0.196059763f},
-std::array<float,2>{0.97198844f, 0.650452554f},
-std::array<float,2>{0.511775315f, 0.284631819f},
-std::array<float,2>{0.149637103f, 0.800554335f},
-std::array<float,2>{0.114746839f, 0.442430168f},
-std::array<float,2>{0.643644691f, 0.972456574f},
-std::array<float,2>{0.855775416f, 0.114003167f},
-std::array<float,2>{0.416628689f, 0.616008699f},
-std::array<float,2>{0.277342528f, 0.418757141f},
-std::array<float,2>{0.931866586f, 0.919827402f},
-std::array<float,2>{0.578829229f, 0.0568767339f},
-std::array<float,2>{0.201436281f, 0.533073425f},
-std::array<float,2>{0.0157329645f, 0.158818215f},
-std::array<float,2>{0.739700735f, 0.724379539f},
-std::array<float,2>{0.786199272f, 0.326350093f},
-std::array<float,2>{0.468259871f, 0.849201143f},
-std::array<float,2>{0.382745802f, 0.090672709f},
-std::array<float,2>{0.815808177f, 0.588966072f},
-std::array<float,2>{0.686025143f, 0.490745008f},
-std::array<float,2>{0.0667942762f, 0.961713552f},
-std::array<float,2>{0.185765743f, 0.269058913f},
-std::array<float,2>{0.539690137f, 0.755348325f},
-std::array<float,2>{0.958505332f, 0.246601447f},
-std::array<float,2>{0.336330712f, 0.682032943f},
-std::array<float,2>{0.436092913f, 0.471070677f},
-std::array<float,2>{0.86246264f, 0.942951024f},
-std::array<float,2>{0.627941906f, 0.0779675096f},
-std::array<float,2>{0.095467329f, 0.577292085f},
-std::array<float,2>{0.130412668f, 0.232047424f},
-std::array<float,2>{0.521916091f, 0.670039952f},
-std::array<float,2>{0.989064157f, 0.259377033f},
-std::array<float,2>{0.349332601f, 0.768991888f},
-std::array<float,2>{0.288559079f, 0.0344102941f},
-std::array<float,2>{0.875628293f, 0.549757004f},
-std::array<float,2>{0.593957722f, 0.42996639f},
-std::array<float,2>{0.224405542f, 0.934904873f},
-std::array<float,2>{0.039958138f, 0.339651465f},
-std::array<float,2>{0.701169789f, 0.867604017f},
-std::array<float,2>{0.76091516f, 0.183356121f},
-std::array<float,2>{0.48061952f, 0.748247683f},
-std::array<float,2>{0.325706214f, 0.310074985f},
-std::array<float,2>{0.939390123f, 0.794805944f},
-std::array<float,2>{0.547784388f, 0.206189901f},
-std::array<float,2>{0.163561255f, 0.632931232f},
-std::array<float,2>{0.0821747333f, 0.0957328379f},
-std::array<float,2>{0.662061214f, 0.595198274f},
-std::array<float,2>{0.842132032f, 0.454683185f},
-std::array<float,2>{0.402729422f, 0.995532691f},
-std::array<float,2>{0.44680807f, 0.149533227f},
-std::array<float,2>{0.812270761f, 0.708819807f},
-std::array<float,2>{0.729439378f, 0.372763157f},
-std::array<float,2>{0.00763916317f, 0.827969551f},
-std::array<float,2>{0.20997107f, 0.387405723f},
-std::array<float,2>{0.568069875f, 0.881588042f},
-std::array<float,2>{0.908771634f, 0.00456781732f},
-std::array<float,2>{0.26349929f, 0.524067342f},
-std::array<float,2>{0.460389942f, 0.262865514f},
-std::array<float,2>{0.793503463f, 0.772911787f},
-std::array<float,2>{0.743101656f, 0.229437858f},
-std::array<float,2>{0.0260407999f, 0.666012347f},
-std::array<float,2>{0.188657105f, 0.0715086535f},
-std::array<float,2>{0.588434756f, 0.572631001f},
-std::array<float,2>{0.924827456f, 0.47606954f},
-std::array<float,2>{0.267532438f, 0.941184223f},
-std::array<float,2>{0.334105223f, 0.186220065f},
-std::array<float,2>{0.963144183f, 0.745148897f},
-std::array<float,2>{0.534826517f, 0.341873258f},
-std::array<float,2>{0.176394522f, 0.873449564f},
-std::array<float,2>{0.0712333173f, 0.434810251f},
-std::array<float,2>{0.674191833f, 0.933012068f},
-std::array<float,2>{0.822093308f, 0.0372373275f},
-std::array<float,2>{0.386816919f, 0.55334121f},
-std::array<float,2>{0.302296042f, 0.459209234f},
-std::array<float,2>{0.898481667f, 0.996689618f},
-std::array<float,2>{0.62417078f, 0.0993361324f},
-std::array<float,2>{0.243016705f, 0.598980308f},
-std::array<float,2>{0.0472827218f, 0.207399353f},
-std::array<float,2>{0.711715758f, 0.638993979f},
-std::array<float,2>{0.767630398f, 0.306834459f},
-std::array<float,2>{0.486219764f, 0.792512059f},
-std::array<float,2>{0.409388751f, 0.000115186995f},
-std::array<float,2>{0.851010561f, 0.528874815f},
-std::array<float,2>{0.650402665f, 0.384474009f},
-std::array<float,2>{0.117245197f, 0.878815234f},
-std::array<float,2>{0.144942984f, 0.369505376f},
-std::array<float,2>{0.500479937f, 0.822981834f},
-std::array<float,2>{0.981371641f, 0.153530508f},
-std::array<float,2>{0.367469519f, 0.704227507f},
-std::array<float,2>{0.393925071f, 0.398801386f},
-std::array<float,2>{0.835573673f, 0.902713537f},
-std::array<float,2>{0.667500615f, 0.0195634142f},
-std::array<float,2>{0.0928557739f, 0.511310935f},
-std::array<float,2>{0.169710532f, 0.126888648f},
-std::array<float,2>{0.557576716f, 0.700908184f},
-std::array<float,2>{0.950784504f, 0.348905951f},
-std::array<float,2>{0.314568192f, 0.840893328f},
-std::array<float,2>{0.255219728f, 0.109811164f},
-std::array<float,2>{0.91582644f, 0.609408081f},
-std::array<float,2>{0.577610552f, 0.441209584f},
-std::array<float,2>{0.218404621f, 0.976513624f},
-std::array<float,2>{0.0130510731f, 0.286818683f},
-std::array<float,2>{0.71925205f, 0.803052664f},
-std::array<float,2>{0.801146626f, 0.200771093f},
-std::array<float,2>{0.440138996f, 0.653089523f},
-std::array<float,2>{0.359281987f, 0.32326439f},
-std::array<float,2>{0.993465364f, 0.847427249f},
-std::array<float,2>{0.531124532f, 0.160543472f},
-std::array<float,2>{0.137108728f, 0.719464302f},
-std::array<float,2>{0.107333787f, 0.0592396669f},
-std::array<float,2>{0.639700711f, 0.536864996f},
-std::array<float,2>{0.874018192f, 0.417818367f},
-std::array<float,2>{0.42818898f, 0.915576279f},
-std::array<float,2>{0.475558132f, 0.246070832f},
-std::array<float,2>{0.753160596f, 0.686396718f},
-std::array<float,2>{0.690571547f, 0.27259472f},
-std::array<float,2>{0.0382773094f, 0.752934515f},
-std::array<float,2>{0.229949176f, 0.486618459f},
-std::array<float,2>{0.604892969f, 0.965019166f},
-std::array<float,2>{0.883008122f, 0.0885878727f},
-std::array<float,2>{0.291284889f, 0.592422783f},
-std::array<float,2>{0.432817131f, 0.356075913f},
-std::array<float,2>{0.865762472f, 0.829047918f},
-std::array<float,2>{0.629119515f, 0.13935186f},
-std::array<float,2>{0.100893438f, 0.691276014f},
-std::array<float,2>{0.12689279f, 0.0239858255f},
-std::array<float,2>{0.516696632f, 0.503650606f},
-std::array<float,2>{0.984653115f, 0.397770554f},
-std::array<float,2>{0.347040892f, 0.895036936f},
-std::array<float,2>{0.281556696f, 0.190381244f},
-std::array<float,2>{0.879264832f, 0.643766522f},
-std::array<float,2>{0.600969493f, 0.294387072f},
-std::array<float,2>{0.221425503f, 0.808596253f},
-std::array<float,2>{0.0435370095f, 0.445407361f},
-std::array<float,2>{0.697424829f, 0.981241405f},
-std::array<float,2>{0.764911115f, 0.121332094f},
-std::array<float,2>{0.480440021f, 0.618212104f},
-std::array<float,2>{0.320820808f, 0.412492156f},
-std::array<float,2>{0.944556653f, 0.911523461f},
-std::array<float,2>{0.551988959f, 0.0523890629f},
-std::array<float,2>{0.159460142f, 0.539688945f},
-std::array<float,2>{0.0789458007f, 0.164686933f},
-std::array<float,2>{0.659635246f, 0.7271927f},
-std::array<float,2>{0.837351978f, 0.317342371f},
-std::array<float,2>{0.400651604f, 0.856489897f},
-std::array<float,2>{0.449828148f, 0.0816116259f},
-std::array<float,2>{0.805650949f, 0.582598269f},
-std::array<float,2>{0.734368563f, 0.497239619f},
-std::array<float,2>{0.00359227671f, 0.956951797f},
-std::array<float,2>{0.204024091f, 0.274610877f},
-std::array<float,2>{0.562875032f, 0.759184241f},
-std::array<float,2>{0.911603034f, 0.235654771f},
-std::array<float,2>{0.261325926f, 0.672185302f},
-std::array<float,2>{0.499789238f, 0.482059509f},
-std::array<float,2>{0.774059534f, 0.952177346f},
-std::array<float,2>{0.708333731f, 0.0657270029f},
-std::array<float,2>{0.0620587878f, 0.568629861f},
-std::array<float,2>{0.240864068f, 0.221073925f},
-std::array<float,2>{0.611047566f, 0.656399786f},
-std::array<float,2>{0.89667064f, 0.25439769f},
-std::array<float,2>{0.311302394f, 0.775055945f},
-std::array<float,2>{0.365843266f, 0.0416662656f},
-std::array<float,2>{0.975785971f, 0.561043024f},
-std::array<float,2>{0.5111081f, 0.424145192f},
-std::array<float,2>{0.153290391f, 0.928807795f},
-std::array<float,2>{0.112974629f, 0.331651837f},
-std::array<float,2>{0.645802081f, 0.865895569f},
-std::array<float,2>{0.854721606f, 0.176463425f},
-std::array<float,2>{0.421758145f, 0.738333404f},
-std::array<float,2>{0.279433787f, 0.298636198f},
-std::array<float,2>{0.933889329f, 0.785580516f},
-std::array<float,2>{0.584006011f, 0.215716332f},
-std::array<float,2>{0.197736606f, 0.630856931f},
-std::array<float,2>{0.0201484431f, 0.102544867f},
-std::array<float,2>{0.736483693f, 0.606381476f},
-std::array<float,2>{0.784092426f, 0.465307593f},
-std::array<float,2>{0.462550104f, 0.987057149f},
-std::array<float,2>{0.37510255f, 0.146758944f},
-std::array<float,2>{0.8169415f, 0.711176991f},
-std::array<float,2>{0.681460202f, 0.363568634f},
-std::array<float,2>{0.0631205067f, 0.819106042f},
-std::array<float,2>{0.182252288f, 0.382313579f},
-std::array<float,2>{0.543669164f, 0.886107147f},
-std::array<float,2>{0.956524074f, 0.0145675074f},
-std::array<float,2>{0.341415405f, 0.518411756f},
-std::array<float,2>{0.383977205f, 0.290582418f},
-std::array<float,2>{0.827860057f, 0.80580622f},
-std::array<float,2>{0.678946316f, 0.193574414f},
-std::array<float,2>{0.0757597908f, 0.646483064f},
-std::array<float,2>{0.174583763f, 0.118777581f},
-std::array<float,2>{0.536979556f, 0.622765005f},
-std::array<float,2>{0.967842996f, 0.451754332f},
-std::array<float,2>{0.330392629f, 0.979953229f},
-std::array<float,2>{0.270012051f, 0.135570809f},
-std::array<float,2>{0.926944494f, 0.693102539f},
-std::array<float,2>{0.593179584f, 0.352798641f},
-std::array<float,2>{0.19500567f, 0.833280921f},
-std::array<float,2>{0.0284645911f, 0.393686563f},
-std::array<float,2>{0.749606371f, 0.891716838f},
-std::array<float,2>{0.791082799f, 0.0290027987f},
-std::array<float,2>{0.454250693f, 0.506645024f},
-std::array<float,2>{0.372933596f, 0.492575526f},
-std::array<float,2>{0.978883743f, 0.960805535f},
-std::array<float,2>{0.507371008f, 0.0829763487f},
-std::array<float,2>{0.140673235f, 0.580892861f},
-std::array<float,2>{0.124666475f, 0.238556445f},
-std::array<float,2>{0.652447164f, 0.676905692f},
-std::array<float,2>{0.846776485f, 0.280066997f},
-std::array<float,2>{0.412487745f, 0.762005329f},
-std::array<float,2>{0.491425216f, 0.0503741428f},
-std::array<float,2>{0.770552397f, 0.546172917f},
-std::array<float,2>{0.716104925f, 0.409973741f},
-std::array<float,2>{0.0537342206f, 0.90752387f},
-std::array<float,2>{0.249269426f, 0.313313484f},
-std::array<float,2>{0.619408309f, 0.854484797f},
-std::array<float,2>{0.902677596f, 0.168325871f},
-std::array<float,2>{0.297511578f, 0.73206979f},
-std::array<float,2>{0.444695026f, 0.426964104f},
-std::array<float,2>{0.800039232f, 0.923148215f},
-std::array<float,2>{0.723811567f, 0.0440349467f},
-std::array<float,2>{0.0106153842f, 0.555422306f},
-std::array<float,2>{0.213521495f, 0.173981413f},
-std::array<float,2>{0.572466493f, 0.736165047f},
-std::array<float,2>{0.919539571f, 0.333659828f},
-std::array<float,2>{0.251318902f, 0.862014234f},
-std::array<float,2>{0.319646835f, 0.06893491f},
-std::array<float,2>{0.947274745f, 0.564447045f},
-std::array<float,2>{0.560869634f, 0.476584822f},
-std::array<float,2>{0.166717917f, 0.948692143f},
-std::array<float,2>{0.0868173316f, 0.250250131f},
-std::array<float,2>{0.670035779f, 0.780814409f},
-std::array<float,2>{0.830171645f, 0.223531038f},
-std::array<float,2>{0.395829648f, 0.661698997f},
-std::array<float,2>{0.295234233f, 0.360041261f},
-std::array<float,2>{0.888014793f, 0.814981401f},
-std::array<float,2>{0.607180536f, 0.14315927f},
-std::array<float,2>{0.233381152f, 0.716553092f},
-std::array<float,2>{0.0333158225f, 0.00894203223f},
-std::array<float,2>{0.69218713f, 0.52163142f},
-std::array<float,2>{0.756035924f, 0.377562523f},
-std::array<float,2>{0.471366137f, 0.888182342f},
-std::array<float,2>{0.424064517f, 0.214003608f},
-std::array<float,2>{0.868398488f, 0.62781024f},
-std::array<float,2>{0.632890701f, 0.302799106f},
-std::array<float,2>{0.104949974f, 0.784179628f},
-std::array<float,2>{0.135275573f, 0.463353455f},
-std::array<float,2>{0.52420646f, 0.991612315f},
-std::array<float,2>{0.999528408f, 0.106912427f},
-std::array<float,2>{0.354357511f, 0.604842365f},
-std::array<float,2>{0.481769204f, 0.335990429f},
-std::array<float,2>{0.760101378f, 0.87031424f},
-std::array<float,2>{0.699907005f, 0.180367172f},
-std::array<float,2>{0.0401617624f, 0.746759057f},
-std::array<float,2>{0.22297731f, 0.0327165239f},
-std::array<float,2>{0.595528066f, 0.547000051f},
-std::array<float,2>{0.876900613f, 0.433038652f},
-std::array<float,2>{0.287909538f, 0.935561955f},
-std::array<float,2>{0.347929269f, 0.233151957f},
-std::array<float,2>{0.989804864f, 0.669469357f},
-std::array<float,2>{0.522575915f, 0.261129528f},
-std::array<float,2>{0.129604772f, 0.766256869f},
-std::array<float,2>{0.0938711464f, 0.469231963f},
-std::array<float,2>{0.627804041f, 0.943821311f},
-std::array<float,2>{0.86224097f, 0.0752725452f},
-std::array<float,2>{0.437472552f, 0.575428069f},
-std::array<float,2>{0.2617836f, 0.390468836f},
-std::array<float,2>{0.909419179f, 0.8794806f},
-std::array<float,2>{0.56698364f, 0.00714626908f},
-std::array<float,2>{0.20983395f, 0.526736736f},
-std::array<float,2>{0.00647383789f, 0.151260912f},
-std::array<float,2>{0.729624271f, 0.709070742f},
-std::array<float,2>{0.810732007f, 0.373237938f},
-std::array<float,2>{0.445352197f, 0.825708926f},
-std::array<float,2>{0.404291958f, 0.0946396217f},
-std::array<float,2>{0.842874825f, 0.596724033f},
-std::array<float,2>{0.660551548f, 0.455134481f},
-std::array<float,2>{0.0839556009f, 0.994135201f},
-std::array<float,2>{0.163073391f, 0.312004864f},
-std::array<float,2>{0.548085451f, 0.795484364f},
-std::array<float,2>{0.937590659f, 0.203414038f},
-std::array<float,2>{0.325187773f, 0.635761857f},
-std::array<float,2>{0.417754203f, 0.44392097f},
-std::array<float,2>{0.856495202f, 0.970653951f},
-std::array<float,2>{0.643134892f, 0.116996609f},
-std::array<float,2>{0.113923624f, 0.613939047f},
-std::array<float,2>{0.148791641f, 0.198648587f},
-std::array<float,2>{0.512749434f, 0.649652839f},
-std::array<float,2>{0.970894277f, 0.282862663f},
-std::array<float,2>{0.360901177f, 0.797492087f},
-std::array<float,2>{0.305852741f, 0.0175564215f},
-std::array<float,2>{0.891477823f, 0.513399899f},
-std::array<float,2>{0.615016043f, 0.404036462f},
-std::array<float,2>{0.235741377f, 0.89929533f},
-std::array<float,2>{0.0552583449f, 0.344418585f},
-std::array<float,2>{0.706981242f, 0.839217186f},
-std::array<float,2>{0.7779603f, 0.130788863f},
-std::array<float,2>{0.494161755f, 0.69760114f},
-std::array<float,2>{0.337552637f, 0.267174453f},
-std::array<float,2>{0.957912564f, 0.756094515f},
-std::array<float,2>{0.540106893f, 0.248699337f},
-std::array<float,2>{0.186893225f, 0.680178046f},
-std::array<float,2>{0.0673978627f, 0.0935204625f},
-std::array<float,2>{0.686745346f, 0.586481512f},
-std::array<float,2>{0.815177262f, 0.489864081f},
-std::array<float,2>{0.381195217f, 0.964127958f},
-std::array<float,2>{0.467535973f, 0.158086032f},
-std::array<float,2>{0.785944343f, 0.725301802f},
-std::array<float,2>{0.738548756f, 0.325102866f},
-std::array<float,2>{0.0168085732f, 0.850769758f},
-std::array<float,2>{0.202265278f, 0.420846403f},
-std::array<float,2>{0.579816461f, 0.921663582f},
-std::array<float,2>{0.932646334f, 0.0561663248f},
-std::array<float,2>{0.276044875f, 0.533774912f},
-std::array<float,2>{0.486988038f, 0.305901259f},
-std::array<float,2>{0.766894102f, 0.789304912f},
-std::array<float,2>{0.714743257f, 0.210513219f},
-std::array<float,2>{0.0504045151f, 0.637689829f},
-std::array<float,2>{0.244212016f, 0.101428807f},
-std::array<float,2>{0.622380495f, 0.60138762f},
-std::array<float,2>{0.901504576f, 0.457079917f},
-std::array<float,2>{0.30409649f, 0.998520792f},
-std::array<float,2>{0.369293123f, 0.154533103f},
-std::array<float,2>{0.983745694f, 0.705569625f},
-std::array<float,2>{0.502444029f, 0.368449986f},
-std::array<float,2>{0.147178173f, 0.820369184f},
-std::array<float,2>{0.11968419f, 0.384921223f},
-std::array<float,2>{0.649381936f, 0.876523256f},
-std::array<float,2>{0.849327564f, 0.0023727247f},
-std::array<float,2>{0.407115579f, 0.529985905f},
-std::array<float,2>{0.269030958f, 0.473582298f},
-std::array<float,2>{0.922525823f, 0.938629329f},
-std::array<float,2>{0.587626874f, 0.0736553296f},
-std::array<float,2>{0.190804645f, 0.572157383f},
-std::array<float,2>{0.0245311111f, 0.227797806f},
-std::array<float,2>{0.745185137f, 0.667456925f},
-std::array<float,2>{0.795465291f, 0.263791263f},
-std::array<float,2>{0.457570434f, 0.770903111f},
-std::array<float,2>{0.390489936f, 0.0365499295f},
-std::array<float,2>{0.824099898f, 0.551369548f},
-std::array<float,2>{0.673795044f, 0.437304944f},
-std::array<float,2>{0.0730986893f, 0.931156754f},
-std::array<float,2>{0.178071901f, 0.339965522f},
-std::array<float,2>{0.532305062f, 0.871233165f},
-std::array<float,2>{0.961187899f, 0.183804452f},
-std::array<float,2>{0.333841622f, 0.742613733f},
-std::array<float,2>{0.42598623f, 0.415227622f},
-std::array<float,2>{0.872396588f, 0.917810082f},
-std::array<float,2>{0.637086987f, 0.0624842867f},
-std::array<float,2>{0.109224856f, 0.53822881f},
-std::array<float,2>{0.14015457f, 0.162184879f},
-std::array<float,2>{0.528101683f, 0.720716536f},
-std::array<float,2>{0.994746029f, 0.321311057f},
-std::array<float,2>{0.356412292f, 0.843877494f},
-std::array<float,2>{0.289441884f, 0.0867181793f},
-std::array<float,2>{0.885874927f, 0.591366351f},
-std::array<float,2>{0.60274148f, 0.485183388f},
-std::array<float,2>{0.22695455f, 0.967250228f},
-std::array<float,2>{0.0363504738f, 0.270569146f},
-std::array<float,2>{0.687931895f, 0.750930309f},
-std::array<float,2>{0.750934899f, 0.243172631f},
-std::array<float,2>{0.473711491f, 0.685498178f},
-std::array<float,2>{0.314124137f, 0.351477712f},
-std::array<float,2>{0.952607632f, 0.843508303f},
-std::array<float,2>{0.555842578f, 0.127299637f},
-std::array<float,2>{0.170833111f, 0.701494038f},
-std::array<float,2>{0.0904164016f, 0.0222267043f},
-std::array<float,2>{0.664810359f, 0.508490205f},
-std::array<float,2>{0.833301783f, 0.402003855f},
-std::array<float,2>{0.392337352f, 0.905388653f},
-std::array<float,2>{0.438603818f, 0.202575579f},
-std::array<float,2>{0.803211629f, 0.654900193f},
-std::array<float,2>{0.720717311f, 0.287214369f},
-std::array<float,2>{0.0146769229f, 0.800849259f},
-std::array<float,2>{0.216079831f, 0.437993616f},
-std::array<float,2>{0.575151026f, 0.97355938f},
-std::array<float,2>{0.917559922f, 0.112048924f},
-std::array<float,2>{0.256244272f, 0.611645699f},
-std::array<float,2>{0.399851412f, 0.320000052f},
-std::array<float,2>{0.838649511f, 0.857591033f},
-std::array<float,2>{0.657762289f, 0.167329699f},
-std::array<float,2>{0.0805553123f, 0.729358137f},
-std::array<float,2>{0.157883421f, 0.0534955747f},
-std::array<float,2>{0.554256618f, 0.541887164f},
-std::array<float,2>{0.941916823f, 0.411829323f},
-std::array<float,2>{0.323619008f, 0.913222611f},
-std::array<float,2>{0.258787394f, 0.23762466f},
-std::array<float,2>{0.913056374f, 0.675490558f},
-std::array<float,2>{0.564949811f, 0.275563419f},
-std::array<float,2>{0.20606485f, 0.761473656f},
-std::array<float,2>{0.000792607549f, 0.499297261f},
-std::array<float,2>{0.731294632f, 0.954499722f},
-std::array<float,2>{0.808406591f, 0.0784768611f},
-std::array<float,2>{0.45239532f, 0.584892452f},
-std::array<float,2>{0.344381094f, 0.394819707f},
-std::array<float,2>{0.988253951f, 0.89770025f},
-std::array<float,2>{0.518013656f, 0.0269476995f},
-std::array<float,2>{0.128580436f, 0.501716793f},
-std::array<float,2>{0.0986754075f, 0.13851212f},
-std::array<float,2>{0.630957007f, 0.689111888f},
-std::array<float,2>{0.865026236f, 0.357968241f},
-std::array<float,2>{0.430950552f, 0.830910504f},
-std::array<float,2>{0.476730049f, 0.123327881f},
-std::array<float,2>{0.762065649f, 0.620278835f},
-std::array<float,2>{0.695752263f, 0.44813025f},
-std::array<float,2>{0.0459741578f, 0.982827246f},
-std::array<float,2>{0.219329029f, 0.295812726f},
-std::array<float,2>{0.597679794f, 0.811563373f},
-std::array<float,2>{0.88247627f, 0.188098207f},
-std::array<float,2>{0.283517689f, 0.64167887f},
-std::array<float,2>{0.464581192f, 0.468744636f},
-std::array<float,2>{0.783130407f, 0.985742867f},
-std::array<float,2>{0.736301005f, 0.103744492f},
-std::array<float,2>{0.0226398148f, 0.607442558f},
-std::array<float,2>{0.197265431f, 0.218476728f},
-std::array<float,2>{0.583127081f, 0.632297456f},
-std::array<float,2>{0.936980665f, 0.298908472f},
-std::array<float,2>{0.278796971f, 0.787905693f},
-std::array<float,2>{0.343305111f, 0.0122886403f},
-std::array<float,2>{0.954492688f, 0.515684009f},
-std::array<float,2>{0.545758367f, 0.379548848f},
-std::array<float,2>{0.180765986f, 0.883700132f},
-std::array<float,2>{0.06597884f, 0.366351396f},
-std::array<float,2>{0.683060646f, 0.816909492f},
-std::array<float,2>{0.818929791f, 0.145455673f},
-std::array<float,2>{0.378073275f, 0.713930309f},
-std::array<float,2>{0.30978328f, 0.256464839f},
-std::array<float,2>{0.896048665f, 0.775780678f},
-std::array<float,2>{0.612169743f, 0.219751179f},
-std::array<float,2>{0.24018757f, 0.65889287f},
-std::array<float,2>{0.0592670925f, 0.0644202456f},
-std::array<float,2>{0.709379494f, 0.567520678f},
-std::array<float,2>{0.777210355f, 0.483334631f},
-std::array<float,2>{0.49794811f, 0.950433314f},
-std::array<float,2>{0.418654025f, 0.177781805f},
-std::array<float,2>{0.853451312f, 0.741279185f},
-std::array<float,2>{0.648221374f, 0.328985035f},
-std::array<float,2>{0.110377915f, 0.864904463f},
-std::array<float,2>{0.155182719f, 0.423746288f},
-std::array<float,2>{0.50905031f, 0.926731288f},
-std::array<float,2>{0.974195421f, 0.0408057533f},
-std::array<float,2>{0.363321602f, 0.559645772f},
-std::array<float,2>{0.411628366f, 0.278457165f},
-std::array<float,2>{0.8439852f, 0.765043139f},
-std::array<float,2>{0.655469f, 0.240309328f},
-std::array<float,2>{0.122661442f, 0.67958951f},
-std::array<float,2>{0.144295216f, 0.0847562179f},
-std::array<float,2>{0.504393101f, 0.578396201f},
-std::array<float,2>{0.977717757f, 0.495577633f},
-std::array<float,2>{0.374673694f, 0.957073987f},
-std::array<float,2>{0.299076706f, 0.171422765f},
-std::array<float,2>{0.904954255f, 0.733710289f},
-std::array<float,2>{0.617782056f, 0.315881491f},
-std::array<float,2>{0.24782294f, 0.851883173f},
-std::array<float,2>{0.0520747378f, 0.407877266f},
-std::array<float,2>{0.717842937f, 0.908923447f},
-std::array<float,2>{0.771731138f, 0.0475363806f},
-std::array<float,2>{0.489266276f, 0.544835687f},
-std::array<float,2>{0.32863757f, 0.45102033f},
-std::array<float,2>{0.966660976f, 0.977205694f},
-std::array<float,2>{0.538112164f, 0.120429091f},
-std::array<float,2>{0.17262046f, 0.624304593f},
-std::array<float,2>{0.0771785751f, 0.192853615f},
-std::array<float,2>{0.67695272f, 0.646782339f},
-std::array<float,2>{0.824712217f, 0.292932183f},
-std::array<float,2>{0.38570869f, 0.807550311f},
-std::array<float,2>{0.456863761f, 0.0299412552f},
-std::array<float,2>{0.789250731f, 0.505395353f},
-std::array<float,2>{0.747471511f, 0.392046332f},
-std::array<float,2>{0.0310143083f, 0.894224763f},
-std::array<float,2>{0.191454276f, 0.355160683f},
-std::array<float,2>{0.590595126f, 0.834861219f},
-std::array<float,2>{0.928344965f, 0.13356401f},
-std::array<float,2>{0.272824377f, 0.694165528f},
-std::array<float,2>{0.469637483f, 0.376027018f},
-std::array<float,2>{0.755084991f, 0.889766276f},
-std::array<float,2>{0.695081532f, 0.0114524905f},
-std::array<float,2>{0.0330378786f, 0.520789802f},
-std::array<float,2>{0.231095821f, 0.141338021f},
-std::array<float,2>{0.60935843f, 0.718356848f},
-std::array<float,2>{0.889142334f, 0.362274557f},
-std::array<float,2>{0.294506699f, 0.813603401f},
-std::array<float,2>{0.351719886f, 0.109181136f},
-std::array<float,2>{0.996785343f, 0.602551579f},
-std::array<float,2>{0.526025832f, 0.461688817f},
-std::array<float,2>{0.13391012f, 0.988607347f},
-std::array<float,2>{0.102962449f, 0.300848663f},
-std::array<float,2>{0.635719836f, 0.782102764f},
-std::array<float,2>{0.870348036f, 0.212346658f},
-std::array<float,2>{0.423120201f, 0.625059605f},
-std::array<float,2>{0.253021926f, 0.334166139f},
-std::array<float,2>{0.920777977f, 0.859943688f},
-std::array<float,2>{0.571513236f, 0.172567993f},
-std::array<float,2>{0.212743282f, 0.736545801f},
-std::array<float,2>{0.00912397169f, 0.044977773f},
-std::array<float,2>{0.724818707f, 0.556834936f},
-std::array<float,2>{0.79786551f, 0.42862457f},
-std::array<float,2>{0.442766398f, 0.925167441f},
-std::array<float,2>{0.397188097f, 0.225551322f},
-std::array<float,2>{0.828733504f, 0.663773537f},
-std::array<float,2>{0.669743419f, 0.252265692f},
-std::array<float,2>{0.0888482332f, 0.778042436f},
-std::array<float,2>{0.165617749f, 0.479583919f},
-std::array<float,2>{0.55882293f, 0.947197497f},
-std::array<float,2>{0.947183549f, 0.0681949928f},
-std::array<float,2>{0.31672278f, 0.566089153f},
-std::array<float,2>{0.447495431f, 0.371125251f},
-std::array<float,2>{0.810426891f, 0.826218605f},
-std::array<float,2>{0.727036536f, 0.149364009f},
-std::array<float,2>{0.00482740533f, 0.707103372f},
-std::array<float,2>{0.2085343f, 0.00557861011f},
-std::array<float,2>{0.568735003f, 0.524641812f},
-std::array<float,2>{0.907989442f, 0.388076127f},
-std::array<float,2>{0.264547467f, 0.881863654f},
-std::array<float,2>{0.327710003f, 0.205885887f},
-std::array<float,2>{0.940398395f, 0.633845627f},
-std::array<float,2>{0.550136566f, 0.308955759f},
-std::array<float,2>{0.161411151f, 0.793671906f},
-std::array<float,2>{0.0850580111f, 0.453446358f},
-std::array<float,2>{0.663603365f, 0.99429208f},
-std::array<float,2>{0.841621816f, 0.0972606316f},
-std::array<float,2>{0.404842407f, 0.594689369f},
-std::array<float,2>{0.286102921f, 0.430884629f},
-std::array<float,2>{0.877162397f, 0.934401214f},
-std::array<float,2>{0.595882952f, 0.0338174179f},
-std::array<float,2>{0.224642798f, 0.55005908f},
-std::array<float,2>{0.0410610884f, 0.181992233f},
-std::array<float,2>{0.70268482f, 0.7491225f},
-std::array<float,2>{0.758758962f, 0.338091969f},
-std::array<float,2>{0.484027743f, 0.868345499f},
-std::array<float,2>{0.434060782f, 0.0768266246f},
-std::array<float,2>{0.860352874f, 0.576709092f},
-std::array<float,2>{0.625518382f, 0.472381115f},
-std::array<float,2>{0.0968550369f, 0.941860616f},
-std::array<float,2>{0.131359577f, 0.258659959f},
-std::array<float,2>{0.520849049f, 0.768473268f},
-std::array<float,2>{0.991817415f, 0.230489179f},
-std::array<float,2>{0.350855589f, 0.671201587f},
-std::array<float,2>{0.37988776f, 0.491516441f},
-std::array<float,2>{0.812505841f, 0.962336361f},
-std::array<float,2>{0.684108377f, 0.0914354548f},
-std::array<float,2>{0.0685317442f, 0.588576019f},
-std::array<float,2>{0.184336483f, 0.248040929f},
-std::array<float,2>{0.54141134f, 0.683334827f},
-std::array<float,2>{0.960267544f, 0.268223524f},
-std::array<float,2>{0.339704067f, 0.754444897f},
-std::array<float,2>{0.274802774f, 0.0577875189f},
-std::array<float,2>{0.929876387f, 0.531307459f},
-std::array<float,2>{0.581419289f, 0.419606268f},
-std::array<float,2>{0.200803667f, 0.918663085f},
-std::array<float,2>{0.0193057172f, 0.327787429f},
-std::array<float,2>{0.741234839f, 0.847805917f},
-std::array<float,2>{0.787671149f, 0.159968928f},
-std::array<float,2>{0.466559082f, 0.72292906f},
-std::array<float,2>{0.363207549f, 0.283694088f},
-std::array<float,2>{0.969502687f, 0.799513757f},
-std::array<float,2>{0.514684439f, 0.196619391f},
-std::array<float,2>{0.151121229f, 0.651729584f},
-std::array<float,2>{0.116440982f, 0.114503942f},
-std::array<float,2>{0.642451227f, 0.616364062f},
-std::array<float,2>{0.858120084f, 0.441990763f},
-std::array<float,2>{0.415766001f, 0.971066356f},
-std::array<float,2>{0.492245942f, 0.132102713f},
-std::array<float,2>{0.779854298f, 0.69661814f},
-std::array<float,2>{0.703768313f, 0.345817506f},
-std::array<float,2>{0.0570064187f, 0.836158276f},
-std::array<float,2>{0.236498877f, 0.406213075f},
-std::array<float,2>{0.617091596f, 0.900783539f},
-std::array<float,2>{0.89303863f, 0.0194275267f},
-std::array<float,2>{0.307714105f, 0.514745414f},
-std::array<float,2>{0.497348398f, 0.254314661f},
-std::array<float,2>{0.776380658f, 0.774513483f},
-std::array<float,2>{0.709607244f, 0.221490324f},
-std::array<float,2>{0.0587630197f, 0.656795204f},
-std::array<float,2>{0.23940511f, 0.0660864115f},
-std::array<float,2>{0.611753464f, 0.569055438f},
-std::array<float,2>{0.895721197f, 0.481684357f},
-std::array<float,2>{0.310179204f, 0.953112662f},
-std::array<float,2>{0.363999575f, 0.175829858f},
-std::array<float,2>{0.97403127f, 0.739231408f},
-std::array<float,2>{0.509419739f, 0.331413358f},
-std::array<float,2>{0.154338911f, 0.865652263f},
-std::array<float,2>{0.110908575f, 0.424611717f},
-std::array<float,2>{0.647904515f, 0.929674327f},
-std::array<float,2>{0.853022695f, 0.0410426147f},
-std::array<float,2>{0.418031037f, 0.560882449f},
-std::array<float,2>{0.279188603f, 0.465736002f},
-std::array<float,2>{0.937257171f, 0.986715913f},
-std::array<float,2>{0.58374989f, 0.103290498f},
-std::array<float,2>{0.1963927f, 0.605868518f},
-std::array<float,2>{0.0231198706f, 0.215265274f},
-std::array<float,2>{0.735369265f, 0.630355656f},
-std::array<float,2>{0.782646954f, 0.298105448f},
-std::array<float,2>{0.464089364f, 0.785968304f},
-std::array<float,2>{0.378681451f, 0.0141537525f},
-std::array<float,2>{0.818638682f, 0.517737091f},
-std::array<float,2>{0.683172822f, 0.382667124f},
-std::array<float,2>{0.0658808649f, 0.886419356f},
-std::array<float,2>{0.181222379f, 0.363872617f},
-std::array<float,2>{0.544923425f, 0.818427503f},
-std::array<float,2>{0.954795778f, 0.147193164f},
-std::array<float,2>{0.342897147f, 0.711803079f},
-std::array<float,2>{0.431492329f, 0.398198515f},
-std::array<float,2>{0.864284337f, 0.894563973f},
-std::array<float,2>{0.631682277f, 0.0235418025f},
-std::array<float,2>{0.0993369594f, 0.503214002f},
-std::array<float,2>{0.128297791f, 0.138813272f},
-std::array<float,2>{0.518410861f, 0.690556288f},
-std::array<float,2>{0.987637758f, 0.355584502f},
-std::array<float,2>{0.343994141f, 0.828258336f},
-std::array<float,2>{0.283955008f, 0.121772043f},
-std::array<float,2>{0.881961465f, 0.619132936f},
-std::array<float,2>{0.598359585f, 0.446194172f},
-std::array<float,2>{0.219021216f, 0.980567336f},
-std::array<float,2>{0.0463887118f, 0.294562608f},
-std::array<float,2>{0.695809007f, 0.809184134f},
-std::array<float,2>{0.762584805f, 0.189778909f},
-std::array<float,2>{0.477515846f, 0.644452691f},
-std::array<float,2>{0.324166328f, 0.316636026f},
-std::array<float,2>{0.941426337f, 0.857153416f},
-std::array<float,2>{0.554071546f, 0.164080784f},
-std::array<float,2>{0.157616347f, 0.726985693f},
-std::array<float,2>{0.0808685794f, 0.0519424044f},
-std::array<float,2>{0.65742749f, 0.539082646f},
-std::array<float,2>{0.838256896f, 0.412812799f},
-std::array<float,2>{0.40004003f, 0.911631346f},
-std::array<float,2>{0.453078896f, 0.236295521f},
-std::array<float,2>{0.808040321f, 0.67268008f},
-std::array<float,2>{0.730902314f, 0.275299609f},
-std::array<float,2>{0.000368680659f, 0.759683192f},
-std::array<float,2>{0.206739008f, 0.497794122f},
-std::array<float,2>{0.5645082f, 0.956354976f},
-std::array<float,2>{0.912203431f, 0.0811335072f},
-std::array<float,2>{0.257821649f, 0.582329988f},
-std::array<float,2>{0.391685665f, 0.349249989f},
-std::array<float,2>{0.833496332f, 0.841453969f},
-std::array<float,2>{0.664325714f, 0.125991464f},
-std::array<float,2>{0.0901680067f, 0.700648189f},
-std::array<float,2>{0.170389995f, 0.0201047603f},
-std::array<float,2>{0.556622088f, 0.510941088f},
-std::array<float,2>{0.952674568f, 0.399261385f},
-std::array<float,2>{0.313959509f, 0.90303731f},
-std::array<float,2>{0.256623924f, 0.200648218f},
-std::array<float,2>{0.917158425f, 0.652794361f},
-std::array<float,2>{0.57438463f, 0.2865206f},
-std::array<float,2>{0.216346204f, 0.80338645f},
-std::array<float,2>{0.0154533153f, 0.440718114f},
-std::array<float,2>{0.721450686f, 0.975819647f},
-std::array<float,2>{0.803298593f, 0.110240877f},
-std::array<float,2>{0.439248919f, 0.609902859f},
-std::array<float,2>{0.355867296f, 0.417326391f},
-std::array<float,2>{0.994392574f, 0.915487826f},
-std::array<float,2>{0.527625203f, 0.0588123575f},
-std::array<float,2>{0.139693394f, 0.536491513f},
-std::array<float,2>{0.108540855f, 0.161114529f},
-std::array<float,2>{0.637648404f, 0.718987525f},
-std::array<float,2>{0.872999787f, 0.324158877f},
-std::array<float,2>{0.426625311f, 0.846703768f},
-std::array<float,2>{0.474501371f, 0.0883220285f},
-std::array<float,2>{0.750405788f, 0.591869831f},
-std::array<float,2>{0.688252747f, 0.486838907f},
-std::array<float,2>{0.0370570831f, 0.965768397f},
-std::array<float,2>{0.227524638f, 0.273239672f},
-std::array<float,2>{0.603485763f, 0.753529549f},
-std::array<float,2>{0.886410058f, 0.245577931f},
-std::array<float,2>{0.289792508f, 0.685829639f},
-std::array<float,2>{0.457393438f, 0.476406276f},
-std::array<float,2>{0.794975579f, 0.940744877f},
-std::array<float,2>{0.74582541f, 0.0719361007f},
-std::array<float,2>{0.0252276249f, 0.573091209f},
-std::array<float,2>{0.191104516f, 0.228881747f},
-std::array<float,2>{0.586996138f, 0.665150344f},
-std::array<float,2>{0.922309279f, 0.263390601f},
-std::array<float,2>{0.269139588f, 0.773243308f},
-std::array<float,2>{0.333414018f, 0.0379420631f},
-std::array<float,2>{0.961854041f, 0.553108871f},
-std::array<float,2>{0.532948852f, 0.435201913f},
-std::array<float,2>{0.178359583f, 0.933560669f},
-std::array<float,2>{0.0725777298f, 0.342319071f},
-std::array<float,2>{0.672988236f, 0.873891771f},
-std::array<float,2>{0.823346555f, 0.185784474f},
-std::array<float,2>{0.389788985f, 0.745618165f},
-std::array<float,2>{0.304574728f, 0.307325661f},
-std::array<float,2>{0.902075052f, 0.792095661f},
-std::array<float,2>{0.622750342f, 0.207640558f},
-std::array<float,2>{0.245020688f, 0.63933903f},
-std::array<float,2>{0.0500265323f, 0.0987889171f},
-std::array<float,2>{0.713891804f, 0.599329829f},
-std::array<float,2>{0.767248869f, 0.459924608f},
-std::array<float,2>{0.486449867f, 0.996133387f},
-std::array<float,2>{0.406570017f, 0.154272318f},
-std::array<float,2>{0.849096537f, 0.704671443f},
-std::array<float,2>{0.648838103f, 0.36964637f},
-std::array<float,2>{0.119182415f, 0.822375417f},
-std::array<float,2>{0.146689951f, 0.38406688f},
-std::array<float,2>{0.50238651f, 0.878352523f},
-std::array<float,2>{0.984308004f, 0.000897729595f},
-std::array<float,2>{0.369701743f, 0.52878207f},
-std::array<float,2>{0.415445685f, 0.282537252f},
-std::array<float,2>{0.857559919f, 0.79692781f},
-std::array<float,2>{0.642030418f, 0.199158624f},
-std::array<float,2>{0.11674995f, 0.650005221f},
-std::array<float,2>{0.150877163f, 0.116341546f},
-std::array<float,2>{0.51541245f, 0.613428533f},
-std::array<float,2>{0.968860626f, 0.443640321f},
-std::array<float,2>{0.362739056f, 0.969747543f},
-std::array<float,2>{0.308271408f, 0.130251184f},
-std::array<float,2>{0.893384814f, 0.698021948f},
-std::array<float,2>{0.61623174f, 0.344191998f},
-std::array<float,2>{0.236860424f, 0.839645565f},
-std::array<float,2>{0.0576064214f, 0.40344125f},
-std::array<float,2>{0.703191459f, 0.898457348f},
-std::array<float,2>{0.779433668f, 0.0167705081f},
-std::array<float,2>{0.492936552f, 0.513004541f},
-std::array<float,2>{0.33911562f, 0.489320427f},
-std::array<float,2>{0.960463047f, 0.964577734f},
-std::array<float,2>{0.541681349f, 0.0930693746f},
-std::array<float,2>{0.183693379f, 0.586290121f},
-std::array<float,2>{0.0688884184f, 0.248486474f},
-std::array<float,2>{0.683952689f, 0.679792702f},
-std::array<float,2>{0.813032866f, 0.26670748f},
-std::array<float,2>{0.380584776f, 0.756681025f},
-std::array<float,2>{0.465913385f, 0.0560103878f},
-std::array<float,2>{0.787452579f, 0.533527136f},
-std::array<float,2>{0.742000699f, 0.420344353f},
-std::array<float,2>{0.0188794881f, 0.921324074f},
-std::array<float,2>{0.200677201f, 0.324418664f},
-std::array<float,2>{0.58188808f, 0.851534009f},
-std::array<float,2>{0.930285871f, 0.157507718f},
-std::array<float,2>{0.275352806f, 0.724941015f},
-std::array<float,2>{0.483527541f, 0.433172435f},
-std::array<float,2>{0.75811404f, 0.936191797f},
-std::array<float,2>{0.702452302f, 0.0324854553f},
-std::array<float,2>{0.041702725f, 0.547609627f},
-std::array<float,2>{0.225578085f, 0.17979452f},
-std::array<float,2>{0.596555829f, 0.746549666f},
-std::array<float,2>{0.877710998f, 0.336425781f},
-std::array<float,2>{0.285472035f, 0.870743513f},
-std::array<float,2>{0.35123086f, 0.0758172274f},
-std::array<float,2>{0.991405249f, 0.575787961f},
-std::array<float,2>{0.521448612f, 0.469390273f},
-std::array<float,2>{0.13114886f, 0.944204509f},
-std::array<float,2>{0.0975068063f, 0.261312962f},
-std::array<float,2>{0.625083208f, 0.76589489f},
-std::array<float,2>{0.861209273f, 0.232701898f},
-std::array<float,2>{0.434504628f, 0.669052064f},
-std::array<float,2>{0.263859093f, 0.37379393f},
-std::array<float,2>{0.907666802f, 0.825259328f},
-std::array<float,2>{0.569069624f, 0.150744319f},
-std::array<float,2>{0.208436653f, 0.709781051f},
-std::array<float,2>{0.00434100721f, 0.00768261962f},
-std::array<float,2>{0.727482259f, 0.52692306f},
-std::array<float,2>{0.80969435f, 0.389866799f},
-std::array<float,2>{0.44781357f, 0.879328787f},
-std::array<float,2>{0.404776871f, 0.203767836f},
-std::array<float,2>{0.841166675f, 0.63665235f},
-std::array<float,2>{0.663266003f, 0.312088937f},
-std::array<float,2>{0.0855165944f, 0.795269251f},
-std::array<float,2>{0.161830425f, 0.455634773f},
-std::array<float,2>{0.550488472f, 0.993651032f},
-std::array<float,2>{0.939674616f, 0.0937775373f},
-std::array<float,2>{0.327250868f, 0.597599447f},
-std::array<float,2>{0.44328776f, 0.333385587f},
-std::array<float,2>{0.798686206f, 0.861807704f},
-std::array<float,2>{0.725128233f, 0.174689487f},
-std::array<float,2>{0.00974863861f, 0.735663891f},
-std::array<float,2>{0.212242424f, 0.0446142592f},
-std::array<float,2>{0.5720101f, 0.555156827f},
-std::array<float,2>{0.920329332f, 0.427650571f},
-std::array<float,2>{0.25342831f, 0.923652828f},
-std::array<float,2>{0.317189813f, 0.223098457f},
-std::array<float,2>{0.94668442f, 0.661266863f},
-std::array<float,2>{0.559396029f, 0.250763446f},
-std::array<float,2>{0.165460989f, 0.78029561f},
-std::array<float,2>{0.088165313f, 0.477503359f},
-std::array<float,2>{0.669335485f, 0.948950589f},
-std::array<float,2>{0.828200936f, 0.068494834f},
-std::array<float,2>{0.396489173f, 0.563732326f},
-std::array<float,2>{0.294327676f, 0.377276689f},
-std::array<float,2>{0.889484048f, 0.888588667f},
-std::array<float,2>{0.608667374f, 0.0093084313f},
-std::array<float,2>{0.230476499f, 0.5220595f},
-std::array<float,2>{0.0323211066f, 0.142630443f},
-std::array<float,2>{0.694591522f, 0.716297746f},
-std::array<float,2>{0.755580902f, 0.359660536f},
-std::array<float,2>{0.469233602f, 0.814691663f},
-std::array<float,2>{0.423433214f, 0.107055187f},
-std::array<float,2>{0.870631158f, 0.605153859f},
-std::array<float,2>{0.635196149f, 0.46342665f},
-std::array<float,2>{0.103272289f, 0.991715848f},
-std::array<float,2>{0.134348348f, 0.30353108f},
-std::array<float,2>{0.525582433f, 0.783668399f},
-std::array<float,2>{0.996402502f, 0.214718744f},
-std::array<float,2>{0.352535009f, 0.627298057f},
-std::array<float,2>{0.384780824f, 0.451197684f},
-std::array<float,2>{0.824282467f, 0.98002243f},
-std::array<float,2>{0.67763555f, 0.118386582f},
-std::array<float,2>{0.0777104571f, 0.622115493f},
-std::array<float,2>{0.171998188f, 0.194330916f},
-std::array<float,2>{0.538957775f, 0.645938873f},
-std::array<float,2>{0.966078818f, 0.290246516f},
-std::array<float,2>{0.328603715f, 0.806435823f},
-std::array<float,2>{0.273409843f, 0.0283590127f},
-std::array<float,2>{0.928008199f, 0.506112516f},
-std::array<float,2>{0.59017086f, 0.394459546f},
-std::array<float,2>{0.19223775f, 0.892354608f},
-std::array<float,2>{0.030435089f, 0.353119463f},
-std::array<float,2>{0.747827232f, 0.833722949f},
-std::array<float,2>{0.789900124f, 0.134938434f},
-std::array<float,2>{0.456200749f, 0.692746818f},
-std::array<float,2>{0.374265283f, 0.279694676f},
-std::array<float,2>{0.978505611f, 0.76244539f},
-std::array<float,2>{0.504763305f, 0.238938197f},
-std::array<float,2>{0.143950656f, 0.67765516f},
-std::array<float,2>{0.122222111f, 0.0823452175f},
-std::array<float,2>{0.655935764f, 0.580551624f},
-std::array<float,2>{0.844422281f, 0.493070006f},
-std::array<float,2>{0.411188394f, 0.960220814f},
-std::array<float,2>{0.489824891f, 0.168536514f},
-std::array<float,2>{0.772391021f, 0.731705248f},
-std::array<float,2>{0.71838665f, 0.312951684f},
-std::array<float,2>{0.0524429828f, 0.853689075f},
-std::array<float,2>{0.247112408f, 0.409224659f},
-std::array<float,2>{0.617645681f, 0.908107638f},
-std::array<float,2>{0.904697537f, 0.0500045232f},
-std::array<float,2>{0.299647868f, 0.546791196f},
-std::array<float,2>{0.461927593f, 0.299757034f},
-std::array<float,2>{0.78334713f, 0.787528038f},
-std::array<float,2>{0.73682636f, 0.218205333f},
-std::array<float,2>{0.0196065474f, 0.632469296f},
-std::array<float,2>{0.198056698f, 0.104242392f},
-std::array<float,2>{0.584927201f, 0.608185828f},
-std::array<float,2>{0.934375942f, 0.467923373f},
-std::array<float,2>{0.280001312f, 0.986248672f},
-std::array<float,2>{0.341090351f, 0.144737557f},
-std::array<float,2>{0.956992567f, 0.714669824f},
-std::array<float,2>{0.543001533f, 0.366797477f},
-std::array<float,2>{0.181835577f, 0.816647589f},
-std::array<float,2>{0.0628556833f, 0.379154235f},
-std::array<float,2>{0.680993915f, 0.883294463f},
-std::array<float,2>{0.81655395f, 0.0119983256f},
-std::array<float,2>{0.375601709f, 0.516469359f},
-std::array<float,2>{0.310717821f, 0.482661664f},
-std::array<float,2>{0.89715147f, 0.950742126f},
-std::array<float,2>{0.610669076f, 0.0639571995f},
-std::array<float,2>{0.240310714f, 0.568146765f},
-std::array<float,2>{0.061684899f, 0.220293924f},
-std::array<float,2>{0.70857197f, 0.658267021f},
-std::array<float,2>{0.773557901f, 0.256289929f},
-std::array<float,2>{0.499054372f, 0.776145935f},
-std::array<float,2>{0.421259046f, 0.0404691994f},
-std::array<float,2>{0.855133951f, 0.560301006f},
-std::array<float,2>{0.646031857f, 0.423277408f},
-std::array<float,2>{0.112738423f, 0.925852239f},
-std::array<float,2>{0.152811214f, 0.328263462f},
-std::array<float,2>{0.511653423f, 0.864494741f},
-std::array<float,2>{0.976174116f, 0.178640679f},
-std::array<float,2>{0.365254492f, 0.741899073f},
-std::array<float,2>{0.401115298f, 0.411363751f},
-std::array<float,2>{0.837739885f, 0.913792789f},
-std::array<float,2>{0.659745932f, 0.0529181138f},
-std::array<float,2>{0.0781783164f, 0.54127878f},
-std::array<float,2>{0.159855559f, 0.167501226f},
-std::array<float,2>{0.552473307f, 0.72892946f},
-std::array<float,2>{0.944954395f, 0.319627821f},
-std::array<float,2>{0.320573688f, 0.857958913f},
-std::array<float,2>{0.26082164f, 0.0790575743f},
-std::array<float,2>{0.912084579f, 0.58398658f},
-std::array<float,2>{0.563165069f, 0.499636412f},
-std::array<float,2>{0.203500822f, 0.954953372f},
-std::array<float,2>{0.00338091212f, 0.276121199f},
-std::array<float,2>{0.733533263f, 0.761025548f},
-std::array<float,2>{0.804949224f, 0.237907723f},
-std::array<float,2>{0.449575424f, 0.674919665f},
-std::array<float,2>{0.347218513f, 0.357518375f},
-std::array<float,2>{0.985303879f, 0.830343902f},
-std::array<float,2>{0.517506659f, 0.137776881f},
-std::array<float,2>{0.126178905f, 0.688581228f},
-std::array<float,2>{0.101554759f, 0.0264245123f},
-std::array<float,2>{0.629486501f, 0.501361966f},
-std::array<float,2>{0.865487158f, 0.395445704f},
-std::array<float,2>{0.433460653f, 0.898366153f},
-std::array<float,2>{0.479575813f, 0.187544957f},
-std::array<float,2>{0.765507102f, 0.642161846f},
-std::array<float,2>{0.697969437f, 0.295386761f},
-std::array<float,2>{0.0429833233f, 0.812253892f},
-std::array<float,2>{0.221079633f, 0.447671533f},
-std::array<float,2>{0.601121247f, 0.98325026f},
-std::array<float,2>{0.879866123f, 0.123895973f},
-std::array<float,2>{0.282111138f, 0.62086314f},
-std::array<float,2>{0.428439319f, 0.322098285f},
-std::array<float,2>{0.873484373f, 0.844661236f},
-std::array<float,2>{0.640150607f, 0.16275084f},
-std::array<float,2>{0.106699608f, 0.721256793f},
-std::array<float,2>{0.137606904f, 0.0615617968f},
-std::array<float,2>{0.530651271f, 0.53858f},
-std::array<float,2>{0.993745089f, 0.41564703f},
-std::array<float,2>{0.358560979f, 0.917313278f},
-std::array<float,2>{0.291797012f, 0.243807167f},
-std::array<float,2>{0.883421838f, 0.684660316f},
-std::array<float,2>{0.605225742f, 0.271128446f},
-std::array<float,2>{0.230325744f, 0.750464916f},
-std::array<float,2>{0.0387701057f, 0.484480411f},
-std::array<float,2>{0.691067398f, 0.967713654f},
-std::array<float,2>{0.753620088f, 0.086062111f},
-std::array<float,2>{0.474994093f, 0.590994596f},
-std::array<float,2>{0.315147281f, 0.401772588f},
-std::array<float,2>{0.950537145f, 0.90591681f},
-std::array<float,2>{0.557127953f, 0.0218154825f},
-std::array<float,2>{0.169074029f, 0.507858098f},
-std::array<float,2>{0.0937167332f, 0.127744481f},
-std::array<float,2>{0.667242587f, 0.701723516f},
-std::array<float,2>{0.835184455f, 0.350887448f},
-std::array<float,2>{0.394312769f, 0.842881024f},
-std::array<float,2>{0.43949914f, 0.1115321f},
-std::array<float,2>{0.801471949f, 0.612142682f},
-std::array<float,2>{0.718987346f, 0.437517166f},
-std::array<float,2>{0.0133207468f, 0.973128378f},
-std::array<float,2>{0.217982233f, 0.287934333f},
-std::array<float,2>{0.57793349f, 0.801655233f},
-std::array<float,2>{0.915162444f, 0.202802792f},
-std::array<float,2>{0.255655706f, 0.654413402f},
-std::array<float,2>{0.485402912f, 0.45776993f},
-std::array<float,2>{0.768444359f, 0.998559475f},
-std::array<float,2>{0.711016119f, 0.101048842f},
-std::array<float,2>{0.0477006063f, 0.600886822f},
-std::array<float,2>{0.242415071f, 0.210294455f},
-std::array<float,2>{0.624573648f, 0.636885643f},
-std::array<float,2>{0.899137139f, 0.306584001f},
-std::array<float,2>{0.301888794f, 0.789867222f},
-std::array<float,2>{0.368064255f, 0.00248122239f},
-std::array<float,2>{0.980807424f, 0.52941066f},
-std::array<float,2>{0.500847697f, 0.3855488f},
-std::array<float,2>{0.145140707f, 0.876402855f},
-std::array<float,2>{0.117892623f, 0.368867218f},
-std::array<float,2>{0.651160121f, 0.820808649f},
-std::array<float,2>{0.851303101f, 0.154999688f},
-std::array<float,2>{0.409810066f, 0.705525756f},
-std::array<float,2>{0.267006576f, 0.264405489f},
-std::array<float,2>{0.925644219f, 0.771030545f},
-std::array<float,2>{0.588230968f, 0.228238225f},
-std::array<float,2>{0.189329997f, 0.667966962f},
-std::array<float,2>{0.0255830623f, 0.0740628988f},
-std::array<float,2>{0.742517352f, 0.571373224f},
-std::array<float,2>{0.793367207f, 0.472788304f},
-std::array<float,2>{0.4607777f, 0.939129889f},
-std::array<float,2>{0.387473881f, 0.184143275f},
-std::array<float,2>{0.821533084f, 0.74284929f},
-std::array<float,2>{0.674518645f, 0.340421021f},
-std::array<float,2>{0.0705984756f, 0.871782243f},
-std::array<float,2>{0.176051587f, 0.436938196f},
-std::array<float,2>{0.53448683f, 0.930670559f},
-std::array<float,2>{0.963621438f, 0.0368142575f},
-std::array<float,2>{0.33492437f, 0.551256895f},
-std::array<float,2>{0.381418765f, 0.267841578f},
-std::array<float,2>{0.814750195f, 0.753992498f},
-std::array<float,2>{0.687354803f, 0.247203663f},
-std::array<float,2>{0.0682057217f, 0.682986557f},
-std::array<float,2>{0.187489122f, 0.0909739286f},
-std::array<float,2>{0.540582836f, 0.587957978f},
-std::array<float,2>{0.957311928f, 0.491838008f},
-std::array<float,2>{0.337178707f, 0.962551892f},
-std::array<float,2>{0.275648415f, 0.159385413f},
-std::array<float,2>{0.933327496f, 0.723498404f},
-std::array<float,2>{0.579160631f, 0.327335775f},
-std::array<float,2>{0.202722713f, 0.848262429f},
-std::array<float,2>{0.0171058886f, 0.419237167f},
-std::array<float,2>{0.738828599f, 0.918359995f},
-std::array<float,2>{0.785289466f, 0.0585689619f},
-std::array<float,2>{0.466811389f, 0.532109499f},
-std::array<float,2>{0.36040011f, 0.441424489f},
-std::array<float,2>{0.971365929f, 0.971667945f},
-std::array<float,2>{0.513553858f, 0.114811055f},
-std::array<float,2>{0.149301574f, 0.616910815f},
-std::array<float,2>{0.113473542f, 0.197241172f},
-std::array<float,2>{0.642620265f, 0.652049422f},
-std::array<float,2>{0.857349575f, 0.28323245f},
-std::array<float,2>{0.417287916f, 0.798856735f},
-std::array<float,2>{0.49467957f, 0.0189955384f},
-std::array<float,2>{0.777393937f, 0.515179157f},
-std::array<float,2>{0.706222773f, 0.405328304f},
-std::array<float,2>{0.0551035851f, 0.901279271f},
-std::array<float,2>{0.236082941f, 0.346382529f},
-std::array<float,2>{0.614724398f, 0.836910903f},
-std::array<float,2>{0.890626788f, 0.132792577f},
-std::array<float,2>{0.306589484f, 0.696963131f},
-std::array<float,2>{0.445996374f, 0.388255477f},
-std::array<float,2>{0.811230421f, 0.882649899f},
-std::array<float,2>{0.730299294f, 0.00535249617f},
-std::array<float,2>{0.00628367066f, 0.525333107f},
-std::array<float,2>{0.209135845f, 0.148850366f},
-std::array<float,2>{0.566541672f, 0.707904279f},
-std::array<float,2>{0.909847856f, 0.371710598f},
-std::array<float,2>{0.262214512f, 0.826930523f},
-std::array<float,2>{0.324702024f, 0.0969506577f},
-std::array<float,2>{0.938343167f, 0.593928695f},
-std::array<float,2>{0.548374355f, 0.453938723f},
-std::array<float,2>{0.162277907f, 0.994702876f},
-std::array<float,2>{0.0833141357f, 0.309184313f},
-std::array<float,2>{0.660733163f, 0.793382704f},
-std::array<float,2>{0.843434811f, 0.205404773f},
-std::array<float,2>{0.40338248f, 0.634345055f},
-std::array<float,2>{0.287221283f, 0.338744134f},
-std::array<float,2>{0.876348376f, 0.86865896f},
-std::array<float,2>{0.594822764f, 0.182447165f},
-std::array<float,2>{0.223279029f, 0.749901593f},
-std::array<float,2>{0.0407969207f, 0.0333036967f},
-std::array<float,2>{0.699394643f, 0.550376654f},
-std::array<float,2>{0.760731161f, 0.43137452f},
-std::array<float,2>{0.482055873f, 0.93384558f},
-std::array<float,2>{0.436852664f, 0.231153175f},
-std::array<float,2>{0.861526906f, 0.671852171f},
-std::array<float,2>{0.627007663f, 0.258090734f},
-std::array<float,2>{0.0943644345f, 0.767874897f},
-std::array<float,2>{0.129212946f, 0.471922278f},
-std::array<float,2>{0.523177326f, 0.942086339f},
-std::array<float,2>{0.989684761f, 0.0766404793f},
-std::array<float,2>{0.348486811f, 0.576417565f},
-std::array<float,2>{0.470889568f, 0.36165145f},
-std::array<float,2>{0.756372571f, 0.81402564f},
-std::array<float,2>{0.691604733f, 0.140784279f},
-std::array<float,2>{0.0337054469f, 0.718143165f},
-std::array<float,2>{0.232636005f, 0.010781765f},
-std::array<float,2>{0.606616318f, 0.521322489f},
-std::array<float,2>{0.888244808f, 0.376630783f},
-std::array<float,2>{0.295651436f, 0.890581787f},
-std::array<float,2>{0.353951693f, 0.212775871f},
-std::array<float,2>{0.999423862f, 0.625698864f},
-std::array<float,2>{0.523543894f, 0.301642448f},
-std::array<float,2>{0.135192186f, 0.781614125f},
-std::array<float,2>{0.105314776f, 0.460988849f},
-std::array<float,2>{0.63374418f, 0.989020109f},
-std::array<float,2>{0.868963659f, 0.108599126f},
-std::array<float,2>{0.424550921f, 0.603389919f},
-std::array<float,2>{0.251693547f, 0.428080916f},
-std::array<float,2>{0.919417322f, 0.925724864f},
-std::array<float,2>{0.57299453f, 0.0458519049f},
-std::array<float,2>{0.213193655f, 0.557459414f},
-std::array<float,2>{0.0101499688f, 0.172255561f},
-std::array<float,2>{0.72422868f, 0.737006843f},
-std::array<float,2>{0.800703824f, 0.334711939f},
-std::array<float,2>{0.44489032f, 0.859560847f},
-std::array<float,2>{0.396343082f, 0.0675116852f},
-std::array<float,2>{0.830653369f, 0.565729439f},
-std::array<float,2>{0.67065531f, 0.480434984f},
-std::array<float,2>{0.0861961022f, 0.946555614f},
-std::array<float,2>{0.1664709f, 0.252908528f},
-std::array<float,2>{0.561203241f, 0.777457118f},
-std::array<float,2>{0.94819963f, 0.224890813f},
-std::array<float,2>{0.31996575f, 0.663187087f},
-std::array<float,2>{0.412598848f, 0.495847732f},
-std::array<float,2>{0.847615778f, 0.957890093f},
-std::array<float,2>{0.652974546f, 0.0840507522f},
-std::array<float,2>{0.124380291f, 0.578657866f},
-std::array<float,2>{0.141592771f, 0.240942731f},
-std::array<float,2>{0.507056594f, 0.679135919f},
-std::array<float,2>{0.979113638f, 0.278933913f},
-std::array<float,2>{0.372084022f, 0.765462577f},
-std::array<float,2>{0.29728663f, 0.0470928587f},
-std::array<float,2>{0.903002739f, 0.544406176f},
-std::array<float,2>{0.619881809f, 0.407536089f},
-std::array<float,2>{0.249685615f, 0.908573747f},
-std::array<float,2>{0.0542070195f, 0.316395968f},
-std::array<float,2>{0.71636498f, 0.852371275f},
-std::array<float,2>{0.771413326f, 0.171218321f},
-std::array<float,2>{0.491789788f, 0.734283268f},
-std::array<float,2>{0.330595911f, 0.292164505f},
-std::array<float,2>{0.968565106f, 0.807029068f},
-std::array<float,2>{0.536592305f, 0.193260774f},
-std::array<float,2>{0.174044728f, 0.647020161f},
-std::array<float,2>{0.0756339878f, 0.121011108f},
-std::array<float,2>{0.679231286f, 0.624559522f},
-std::array<float,2>{0.827576101f, 0.450488478f},
-std::array<float,2>{0.384571314f, 0.976852596f},
-std::array<float,2>{0.454970449f, 0.133046433f},
-std::array<float,2>{0.791786373f, 0.693713546f},
-std::array<float,2>{0.749244511f, 0.35495609f},
-std::array<float,2>{0.0291196946f, 0.834259808f},
-std::array<float,2>{0.194398388f, 0.392398894f},
-std::array<float,2>{0.59343785f, 0.893573642f},
-std::array<float,2>{0.927500486f, 0.029567074f},
-std::array<float,2>{0.270383477f, 0.505088747f},
-std::array<float,2>{0.450929463f, 0.273678839f},
-std::array<float,2>{0.806018889f, 0.758577764f},
-std::array<float,2>{0.732639611f, 0.235265836f},
-std::array<float,2>{0.00205023424f, 0.673660457f},
-std::array<float,2>{0.204814255f, 0.0803200752f},
-std::array<float,2>{0.564410746f, 0.583103478f},
-std::array<float,2>{0.91098702f, 0.496457815f},
-std::array<float,2>{0.259793401f, 0.955730975f},
-std::array<float,2>{0.321666569f, 0.165895581f},
-std::array<float,2>{0.944224596f, 0.727612495f},
-std::array<float,2>{0.55166322f, 0.318337083f},
-std::array<float,2>{0.158911377f, 0.856321216f},
-std::array<float,2>{0.0794429183f, 0.41400671f},
-std::array<float,2>{0.658381164f, 0.910900176f},
-std::array<float,2>{0.836110353f, 0.0510349311f},
-std::array<float,2>{0.402242571f, 0.54042387f},
-std::array<float,2>{0.283176303f, 0.446555287f},
-std::array<float,2>{0.880156279f, 0.98164171f},
-std::array<float,2>{0.600503027f, 0.122169152f},
-std::array<float,2>{0.222362027f, 0.617208302f},
-std::array<float,2>{0.0447279327f, 0.190701991f},
-std::array<float,2>{0.698643029f, 0.643502474f},
-std::array<float,2>{0.764338911f, 0.293321073f},
-std::array<float,2>{0.478900313f, 0.810039043f},
-std::array<float,2>{0.431675494f, 0.0253496021f},
-std::array<float,2>{0.866539836f, 0.502781451f},
-std::array<float,2>{0.630105853f, 0.397387713f},
-std::array<float,2>{0.100304767f, 0.896334291f},
-std::array<float,2>{0.125932664f, 0.356668323f},
-std::array<float,2>{0.516493022f, 0.829630733f},
-std::array<float,2>{0.986182094f, 0.14061062f},
-std::array<float,2>{0.346532911f, 0.690206945f},
-std::array<float,2>{0.376739115f, 0.380962521f},
-std::array<float,2>{0.818350434f, 0.884780645f},
-std::array<float,2>{0.680629909f, 0.0147249429f},
-std::array<float,2>{0.064297989f, 0.519432127f},
-std::array<float,2>{0.183051646f, 0.148315236f},
-std::array<float,2>{0.544108391f, 0.712449312f},
-std::array<float,2>{0.955125988f, 0.364739716f},
-std::array<float,2>{0.339953601f, 0.81996727f},
-std::array<float,2>{0.281048864f, 0.102013998f},
-std::array<float,2>{0.935329437f, 0.606446445f},
-std::array<float,2>{0.585512817f, 0.466524959f},
-std::array<float,2>{0.198807567f, 0.987628222f},
-std::array<float,2>{0.0209983829f, 0.297287047f},
-std::array<float,2>{0.737323582f, 0.786159337f},
-std::array<float,2>{0.784704506f, 0.216796875f},
-std::array<float,2>{0.46160993f, 0.629217625f},
-std::array<float,2>{0.36648199f, 0.330824375f},
-std::array<float,2>{0.975148439f, 0.867121577f},
-std::array<float,2>{0.51053828f, 0.177592307f},
-std::array<float,2>{0.154228508f, 0.73951751f},
-std::array<float,2>{0.111456618f, 0.0419975519f},
-std::array<float,2>{0.645337224f, 0.562457025f},
-std::array<float,2>{0.854149759f, 0.425672561f},
-std::array<float,2>{0.419963717f, 0.928204775f},
-std::array<float,2>{0.498568505f, 0.222008139f},
-std::array<float,2>{0.775349915f, 0.657821834f},
-std::array<float,2>{0.707530081f, 0.255289495f},
-std::array<float,2>{0.0610354207f, 0.773706675f},
-std::array<float,2>{0.241424412f, 0.481235445f},
-std::array<float,2>{0.609401822f, 0.951421022f},
-std::array<float,2>{0.897577167f, 0.0646397844f},
-std::array<float,2>{0.312281281f, 0.5701406f},
-std::array<float,2>{0.40877673f, 0.37022692f},
-std::array<float,2>{0.849766314f, 0.823471844f},
-std::array<float,2>{0.651444852f, 0.152941585f},
-std::array<float,2>{0.118801624f, 0.703990698f},
-std::array<float,2>{0.145784304f, 0.0015093406f},
-std::array<float,2>{0.501506805f, 0.528128862f},
-std::array<float,2>{0.982350886f, 0.38373208f},
-std::array<float,2>{0.368430316f, 0.877163231f},
-std::array<float,2>{0.301480502f, 0.208343148f},
-std::array<float,2>{0.900011957f, 0.640292823f},
-std::array<float,2>{0.623486996f, 0.307832688f},
-std::array<float,2>{0.243663639f, 0.791730702f},
-std::array<float,2>{0.048708111f, 0.46002081f},
-std::array<float,2>{0.712524474f, 0.998036206f},
-std::array<float,2>{0.768839061f, 0.0979604647f},
-std::array<float,2>{0.485099941f, 0.597831607f},
-std::array<float,2>{0.335861027f, 0.433723986f},
-std::array<float,2>{0.964228451f, 0.931939602f},
-std::array<float,2>{0.534136236f, 0.0381145142f},
-std::array<float,2>{0.177526399f, 0.554178357f},
-std::array<float,2>{0.0713270605f, 0.187290326f},
-std::array<float,2>{0.67502284f, 0.744498491f},
-std::array<float,2>{0.820829809f, 0.343228847f},
-std::array<float,2>{0.388455003f, 0.874780893f},
-std::array<float,2>{0.459480792f, 0.0703237578f},
-std::array<float,2>{0.794661224f, 0.573311508f},
-std::array<float,2>{0.743210495f, 0.474736691f},
-std::array<float,2>{0.0269665848f, 0.939636409f},
-std::array<float,2>{0.188010886f, 0.262192607f},
-std::array<float,2>{0.589568973f, 0.771817863f},
-std::array<float,2>{0.924443603f, 0.229971483f},
-std::array<float,2>{0.26574856f, 0.664784074f},
-std::array<float,2>{0.475902647f, 0.488239527f},
-std::array<float,2>{0.752308249f, 0.966538429f},
-std::array<float,2>{0.690159917f, 0.0892443955f},
-std::array<float,2>{0.0376309678f, 0.593673766f},
-std::array<float,2>{0.229118526f, 0.244970873f},
-std::array<float,2>{0.603793144f, 0.687291384f},
-std::array<float,2>{0.8840518f, 0.271857291f},
-std::array<float,2>{0.292001247f, 0.752027988f},
-std::array<float,2>{0.357874393f, 0.0601772256f},
-std::array<float,2>{0.992672145f, 0.536021173f},
-std::array<float,2>{0.52998358f, 0.416102171f},
-std::array<float,2>{0.13841781f, 0.914998889f},
-std::array<float,2>{0.105681442f, 0.322545916f},
-std::array<float,2>{0.638969243f, 0.846317887f},
-std::array<float,2>{0.874198616f, 0.161993176f},
-std::array<float,2>{0.429686487f, 0.720495522f},
-std::array<float,2>{0.254787594f, 0.285762429f},
-std::array<float,2>{0.91492492f, 0.804567993f},
-std::array<float,2>{0.57653904f, 0.199996009f},
-std::array<float,2>{0.217665777f, 0.653714061f},
-std::array<float,2>{0.0124508273f, 0.110736273f},
-std::array<float,2>{0.71991396f, 0.610795677f},
-std::array<float,2>{0.802604198f, 0.439593345f},
-std::array<float,2>{0.440577239f, 0.974808991f},
-std::array<float,2>{0.393009484f, 0.125537395f},
-std::array<float,2>{0.834380805f, 0.699609637f},
-std::array<float,2>{0.666548908f, 0.348528683f},
-std::array<float,2>{0.0922332034f, 0.840257347f},
-std::array<float,2>{0.168106362f, 0.399508238f},
-std::array<float,2>{0.558290184f, 0.903531969f},
-std::array<float,2>{0.949984312f, 0.0207287557f},
-std::array<float,2>{0.315698594f, 0.509895504f},
-std::array<float,2>{0.402980298f, 0.311204016f},
-std::array<float,2>{0.842695892f, 0.796786368f},
-std::array<float,2>{0.661199093f, 0.204912394f},
-std::array<float,2>{0.0829813778f, 0.635266125f},
-std::array<float,2>{0.163760781f, 0.0951703265f},
-std::array<float,2>{0.547101796f, 0.595968902f},
-std::array<float,2>{0.938951969f, 0.456907898f},
-std::array<float,2>{0.325593174f, 0.992533743f},
-std::array<float,2>{0.262879163f, 0.152285874f},
-std::array<float,2>{0.908396482f, 0.710245252f},
-std::array<float,2>{0.567395926f, 0.374027699f},
-std::array<float,2>{0.210595548f, 0.82473433f},
-std::array<float,2>{0.00699502509f, 0.388865411f},
-std::array<float,2>{0.728681922f, 0.880776048f},
-std::array<float,2>{0.811682165f, 0.00658326875f},
-std::array<float,2>{0.446620584f, 0.526057541f},
-std::array<float,2>{0.348691016f, 0.470114917f},
-std::array<float,2>{0.988537133f, 0.944525421f},
-std::array<float,2>{0.521984696f, 0.0744825378f},
-std::array<float,2>{0.130318403f, 0.575166702f},
-std::array<float,2>{0.0950486436f, 0.234234184f},
-std::array<float,2>{0.62888819f, 0.668552816f},
-std::array<float,2>{0.862913966f, 0.25994736f},
-std::array<float,2>{0.435667247f, 0.767196834f},
-std::array<float,2>{0.480995804f, 0.0318516903f},
-std::array<float,2>{0.761670232f, 0.548160672f},
-std::array<float,2>{0.700293124f, 0.432515711f},
-std::array<float,2>{0.0391559936f, 0.936990321f},
-std::array<float,2>{0.223733336f, 0.33707571f},
-std::array<float,2>{0.59454459f, 0.869388103f},
-std::array<float,2>{0.875394285f, 0.181618229f},
-std::array<float,2>{0.288608402f, 0.747973442f},
-std::array<float,2>{0.468416959f, 0.421186686f},
-std::array<float,2>{0.786986887f, 0.920177758f},
-std::array<float,2>{0.739935935f, 0.055437468f},
-std::array<float,2>{0.0162994508f, 0.534398258f},
-std::array<float,2>{0.202090114f, 0.15702793f},
-std::array<float,2>{0.578355193f, 0.725672305f},
-std::array<float,2>{0.932497144f, 0.325415671f},
-std::array<float,2>{0.276526242f, 0.850545466f},
-std::array<float,2>{0.336865038f, 0.0919104964f},
-std::array<float,2>{0.958128035f, 0.587544382f},
-std::array<float,2>{0.539496303f, 0.488348395f},
-std::array<float,2>{0.186416149f, 0.963811755f},
-std::array<float,2>{0.0672515184f, 0.265645713f},
-std::array<float,2>{0.686297536f, 0.757596552f},
-std::array<float,2>{0.8163715f, 0.249427348f},
-std::array<float,2>{0.38188073f, 0.681350172f},
-std::array<float,2>{0.3056117f, 0.34533903f},
-std::array<float,2>{0.891674161f, 0.838849366f},
-std::array<float,2>{0.614078641f, 0.129853949f},
-std::array<float,2>{0.2351515f, 0.698289335f},
-std::array<float,2>{0.0559489504f, 0.0157955885f},
-std::array<float,2>{0.705102801f, 0.512639105f},
-std::array<float,2>{0.779183745f, 0.403279901f},
-std::array<float,2>{0.495610982f, 0.900048971f},
-std::array<float,2>{0.416038603f, 0.197966695f},
-std::array<float,2>{0.856069863f, 0.648539364f},
-std::array<float,2>{0.644518137f, 0.281507432f},
-std::array<float,2>{0.114366181f, 0.798639894f},
-std::array<float,2>{0.149994656f, 0.444505364f},
-std::array<float,2>{0.512692988f, 0.968943357f},
-std::array<float,2>{0.972485721f, 0.115873501f},
-std::array<float,2>{0.360195309f, 0.614773154f},
-std::array<float,2>{0.490484715f, 0.313924909f},
-std::array<float,2>{0.769963384f, 0.855245829f},
-std::array<float,2>{0.715057194f, 0.16923061f},
-std::array<float,2>{0.0534050465f, 0.73072499f},
-std::array<float,2>{0.248366117f, 0.0490209423f},
-std::array<float,2>{0.620371401f, 0.54506743f},
-std::array<float,2>{0.903373778f, 0.409023821f},
-std::array<float,2>{0.29858467f, 0.906934559f},
-std::array<float,2>{0.37154457f, 0.239970312f},
-std::array<float,2>{0.979750514f, 0.675919473f},
-std::array<float,2>{0.505951881f, 0.280806154f},
-std::array<float,2>{0.141971245f, 0.763433218f},
-std::array<float,2>{0.123278052f, 0.493271142f},
-std::array<float,2>{0.653477907f, 0.959805965f},
-std::array<float,2>{0.845733047f, 0.0831180885f},
-std::array<float,2>{0.413465619f, 0.581779063f},
-std::array<float,2>{0.27141127f, 0.393003494f},
-std::array<float,2>{0.92603606f, 0.890783191f},
-std::array<float,2>{0.592512727f, 0.0278418679f},
-std::array<float,2>{0.194323957f, 0.507292032f},
-std::array<float,2>{0.0280230511f, 0.136707664f},
-std::array<float,2>{0.748809814f, 0.691465437f},
-std::array<float,2>{0.792543769f, 0.352084398f},
-std::array<float,2>{0.45334819f, 0.83223021f},
-std::array<float,2>{0.383445829f, 0.117487743f},
-std::array<float,2>{0.82652849f, 0.621152222f},
-std::array<float,2>{0.678558886f, 0.453059763f},
-std::array<float,2>{0.0742873102f, 0.979319513f},
-std::array<float,2>{0.17574659f, 0.289530784f},
-std::array<float,2>{0.53524375f, 0.805579722f},
-std::array<float,2>{0.967766643f, 0.195047528f},
-std::array<float,2>{0.331239432f, 0.644781172f},
-std::array<float,2>{0.425694972f, 0.464577526f},
-std::array<float,2>{0.867577076f, 0.990851462f},
-std::array<float,2>{0.634685516f, 0.105709285f},
-std::array<float,2>{0.103632174f, 0.603797317f},
-std::array<float,2>{0.136453748f, 0.213457182f},
-std::array<float,2>{0.525028706f, 0.627931535f},
-std::array<float,2>{0.998399973f, 0.304024279f},
-std::array<float,2>{0.354532093f, 0.784602463f},
-std::array<float,2>{0.296507716f, 0.00786293298f},
-std::array<float,2>{0.887505174f, 0.523320496f},
-std::array<float,2>{0.60582155f, 0.378684968f},
-std::array<float,2>{0.233446926f, 0.887020648f},
-std::array<float,2>{0.034706533f, 0.361209631f},
-std::array<float,2>{0.692591131f, 0.815835238f},
-std::array<float,2>{0.757121384f, 0.144331545f},
-std::array<float,2>{0.471892595f, 0.715072572f},
-std::array<float,2>{0.318658531f, 0.251146644f},
-std::array<float,2>{0.949085712f, 0.779319823f},
-std::array<float,2>{0.562058568f, 0.224425212f},
-std::array<float,2>{0.167716861f, 0.660855591f},
-std::array<float,2>{0.0876200348f, 0.0693775415f},
-std::array<float,2>{0.671328962f, 0.562643945f},
-std::array<float,2>{0.83150512f, 0.477755606f},
-std::array<float,2>{0.3945916f, 0.947882891f},
-std::array<float,2>{0.443814754f, 0.17500098f},
-std::array<float,2>{0.799100757f, 0.734933257f},
-std::array<float,2>{0.72299999f, 0.332372487f},
-std::array<float,2>{0.0109498892f, 0.862515748f},
-std::array<float,2>{0.214562595f, 0.426201344f},
-std::array<float,2>{0.574036539f, 0.922688186f},
-std::array<float,2>{0.918070197f, 0.0434605405f},
-std::array<float,2>{0.250458211f, 0.556372702f},
-std::array<float,2>{0.478470504f, 0.296470046f},
-std::array<float,2>{0.76281786f, 0.810548007f},
-std::array<float,2>{0.697019756f, 0.189095333f},
-std::array<float,2>{0.0450286567f, 0.640669763f},
-std::array<float,2>{0.220061868f, 0.124623016f},
-std::array<float,2>{0.598668277f, 0.619631886f},
-std::array<float,2>{0.881621778f, 0.448615819f},
-std::array<float,2>{0.28464672f, 0.983706713f},
-std::array<float,2>{0.345209539f, 0.137226179f},
-std::array<float,2>{0.986981094f, 0.687946558f},
-std::array<float,2>{0.518655956f, 0.358988225f},
-std::array<float,2>{0.12746489f, 0.832007945f},
-std::array<float,2>{0.0986225605f, 0.396251202f},
-std::array<float,2>{0.632386208f, 0.897009969f},
-std::array<float,2>{0.863299608f, 0.026126096f},
-std::array<float,2>{0.429829359f, 0.500822723f},
-std::array<float,2>{0.259588778f, 0.498056412f},
-std::array<float,2>{0.91398412f, 0.953353107f},
-std::array<float,2>{0.56597811f, 0.0800650269f},
-std::array<float,2>{0.205423236f, 0.585287511f},
-std::array<float,2>{0.00100699172f, 0.237243459f},
-std::array<float,2>{0.731890917f, 0.673980713f},
-std::array<float,2>{0.806959152f, 0.276740074f},
-std::array<float,2>{0.451533705f, 0.76060605f},
-std::array<float,2>{0.399397671f, 0.0544416122f},
-std::array<float,2>{0.839600027f, 0.542067945f},
-std::array<float,2>{0.65631789f, 0.411127239f},
-std::array<float,2>{0.0816970095f, 0.912226439f},
-std::array<float,2>{0.157071397f, 0.318609029f},
-std::array<float,2>{0.553383589f, 0.859006822f},
-std::array<float,2>{0.942642152f, 0.166142911f},
-std::array<float,2>{0.322543919f, 0.729622245f},
-std::array<float,2>{0.419062406f, 0.421901047f},
-std::array<float,2>{0.851870179f, 0.927370846f},
-std::array<float,2>{0.646648467f, 0.0396649837f},
-std::array<float,2>{0.10949561f, 0.559093237f},
-std::array<float,2>{0.155576542f, 0.179450557f},
-std::array<float,2>{0.508754671f, 0.740603626f},
-std::array<float,2>{0.973266065f, 0.329551429f},
-std::array<float,2>{0.364976674f, 0.864062667f},
-std::array<float,2>{0.309052944f, 0.0634456053f},
-std::array<float,2>{0.895103812f, 0.567376673f},
-std::array<float,2>{0.612508297f, 0.483526647f},
-std::array<float,2>{0.238794804f, 0.949330211f},
-std::array<float,2>{0.0602237284f, 0.257579207f},
-std::array<float,2>{0.710386455f, 0.776651919f},
-std::array<float,2>{0.775400102f, 0.219375521f},
-std::array<float,2>{0.496388197f, 0.659942091f},
-std::array<float,2>{0.342724144f, 0.36540702f},
-std::array<float,2>{0.954061806f, 0.81751895f},
-std::array<float,2>{0.546082973f, 0.145679459f},
-std::array<float,2>{0.180135429f, 0.712992013f},
-std::array<float,2>{0.064453952f, 0.0132169742f},
-std::array<float,2>{0.682393909f, 0.517565966f},
-std::array<float,2>{0.819391012f, 0.379894078f},
-std::array<float,2>{0.377463013f, 0.884117007f},
-std::array<float,2>{0.463156968f, 0.217253104f},
-std::array<float,2>{0.781274498f, 0.631479561f},
-std::array<float,2>{0.735185444f, 0.299812615f},
-std::array<float,2>{0.021927407f, 0.788553774f},
-std::array<float,2>{0.195410967f, 0.467172265f},
-std::array<float,2>{0.582229912f, 0.98455447f},
-std::array<float,2>{0.936001897f, 0.105086796f},
-std::array<float,2>{0.27750501f, 0.609280765f},
-std::array<float,2>{0.389008462f, 0.341525823f},
-std::array<float,2>{0.822336018f, 0.872182727f},
-std::array<float,2>{0.672041178f, 0.184585139f},
-std::array<float,2>{0.0734955966f, 0.743576407f},
-std::array<float,2>{0.179033905f, 0.0355975516f},
-std::array<float,2>{0.531652868f, 0.552447557f},
-std::array<float,2>{0.962495029f, 0.436332196f},
-std::array<float,2>{0.332288116f, 0.930253267f},
-std::array<float,2>{0.268012285f, 0.226896152f},
-std::array<float,2>{0.922932386f, 0.666532457f},
-std::array<float,2>{0.586663485f, 0.265002966f},
-std::array<float,2>{0.189993307f, 0.769550741f},
-std::array<float,2>{0.0238898844f, 0.473658651f},
-std::array<float,2>{0.74429512f, 0.937936902f},
-std::array<float,2>{0.796518803f, 0.0728705823f},
-std::array<float,2>{0.458653837f, 0.570498049f},
-std::array<float,2>{0.370814443f, 0.386182725f},
-std::array<float,2>{0.982489109f, 0.875515103f},
-std::array<float,2>{0.50319171f, 0.00378953316f},
-std::array<float,2>{0.147768438f, 0.531137645f},
-std::array<float,2>{0.121012002f, 0.156016842f},
-std::array<float,2>{0.650257885f, 0.706489444f},
-std::array<float,2>{0.848416269f, 0.367465287f},
-std::array<float,2>{0.407592356f, 0.821525395f},
-std::array<float,2>{0.487641633f, 0.100407034f},
-std::array<float,2>{0.765668571f, 0.600059152f},
-std::array<float,2>{0.713386238f, 0.458108783f},
-std::array<float,2>{0.0496805608f, 0.999674201f},
-std::array<float,2>{0.245521307f, 0.305565953f},
-std::array<float,2>{0.621984839f, 0.79020375f},
-std::array<float,2>{0.900977015f, 0.209322512f},
-std::array<float,2>{0.303216964f, 0.638505697f},
-std::array<float,2>{0.438219517f, 0.438780904f},
-std::array<float,2>{0.803990602f, 0.973663509f},
-std::array<float,2>{0.722284913f, 0.112375818f},
-std::array<float,2>{0.0145582184f, 0.612690032f},
-std::array<float,2>{0.214957491f, 0.201401353f},
-std::array<float,2>{0.576053619f, 0.656103969f},
-std::array<float,2>{0.916749537f, 0.288392842f},
-std::array<float,2>{0.256904423f, 0.802554488f},
-std::array<float,2>{0.31330961f, 0.0230595674f},
-std::array<float,2>{0.952134728f, 0.509044707f},
-std::array<float,2>{0.555287898f, 0.401088893f},
-std::array<float,2>{0.171796769f, 0.904511094f},
-std::array<float,2>{0.0914965719f, 0.350248039f},
-std::array<float,2>{0.66597873f, 0.842038989f},
-std::array<float,2>{0.83291924f, 0.128165081f},
-std::array<float,2>{0.391259611f, 0.703045428f},
-std::array<float,2>{0.290283889f, 0.270024121f},
-std::array<float,2>{0.885221243f, 0.751245975f},
-std::array<float,2>{0.602140546f, 0.242319629f},
-std::array<float,2>{0.228226215f, 0.683968663f},
-std::array<float,2>{0.0355430841f, 0.0877646506f},
-std::array<float,2>{0.688837111f, 0.590117872f},
-std::array<float,2>{0.751476824f, 0.485407203f},
-std::array<float,2>{0.472761959f, 0.967993319f},
-std::array<float,2>{0.427217841f, 0.163880736f},
-std::array<float,2>{0.871603906f, 0.722495139f},
-std::array<float,2>{0.638064981f, 0.320567369f},
-std::array<float,2>{0.108216107f, 0.845611274f},
-std::array<float,2>{0.139375672f, 0.414463609f},
-std::array<float,2>{0.528781116f, 0.916289091f},
-std::array<float,2>{0.995374978f, 0.060999997f},
-std::array<float,2>{0.356677175f, 0.537295222f},
-std::array<float,2>{0.435128838f, 0.258913279f},
-std::array<float,2>{0.859770954f, 0.769047201f},
-std::array<float,2>{0.626677275f, 0.231583267f},
-std::array<float,2>{0.095920071f, 0.670715153f},
-std::array<float,2>{0.131858125f, 0.0773667917f},
-std::array<float,2>{0.519867837f, 0.577641726f},
-std::array<float,2>{0.991176426f, 0.471501827f},
-std::array<float,2>{0.349823475f, 0.942691803f},
-std::array<float,2>{0.286594152f, 0.182778254f},
-std::array<float,2>{0.878274918f, 0.748812079f},
-std::array<float,2>{0.597070038f, 0.338982582f},
-std::array<float,2>{0.225951806f, 0.868112981f},
-std::array<float,2>{0.0427893586f, 0.430506974f},
-std::array<float,2>{0.701766431f, 0.935251951f},
-std::array<float,2>{0.759252727f, 0.0347593166f},
-std::array<float,2>{0.482943416f, 0.5490762f},
-std::array<float,2>{0.326909304f, 0.454348862f},
-std::array<float,2>{0.940570831f, 0.996025205f},
-std::array<float,2>{0.549266517f, 0.0962421447f},
-std::array<float,2>{0.160964251f, 0.595531166f},
-std::array<float,2>{0.0839982405f, 0.207015619f},
-std::array<float,2>{0.662550628f, 0.63354665f},
-std::array<float,2>{0.84051013f, 0.309770018f},
-std::array<float,2>{0.406223178f, 0.794086814f},
-std::array<float,2>{0.448255002f, 0.00395370694f},
-std::array<float,2>{0.809388101f, 0.523858428f},
-std::array<float,2>{0.72810185f, 0.386718869f},
-std::array<float,2>{0.00530639151f, 0.881088853f},
-std::array<float,2>{0.207365915f, 0.372194797f},
-std::array<float,2>{0.569465518f, 0.827523768f},
-std::array<float,2>{0.906454265f, 0.150029138f},
-std::array<float,2>{0.265375435f, 0.708059788f},
-std::array<float,2>{0.49372983f, 0.405231535f},
-std::array<float,2>{0.78123498f, 0.901386678f},
-std::array<float,2>{0.704772413f, 0.0183183439f},
-std::array<float,2>{0.0583725199f, 0.514319777f},
-std::array<float,2>{0.238212228f, 0.131652266f},
-std::array<float,2>{0.616172612f, 0.695697844f},
-std::array<float,2>{0.893654883f, 0.347067624f},
-std::array<float,2>{0.307347268f, 0.837874413f},
-std::array<float,2>{0.36195913f, 0.113495708f},
-std::array<float,2>{0.969752789f, 0.615550935f},
-std::array<float,2>{0.513682961f, 0.443351775f},
-std::array<float,2>{0.152207747f, 0.972167552f},
-std::array<float,2>{0.115291625f, 0.284955829f},
-std::array<float,2>{0.640947521f, 0.800193667f},
-std::array<float,2>{0.858714879f, 0.19556661f},
-std::array<float,2>{0.414952457f, 0.650953472f},
-std::array<float,2>{0.273585707f, 0.327008486f},
-std::array<float,2>{0.931108296f, 0.848908901f},
-std::array<float,2>{0.580302477f, 0.158335239f},
-std::array<float,2>{0.199769661f, 0.723682463f},
-std::array<float,2>{0.0176715348f, 0.0575204752f},
-std::array<float,2>{0.740467131f, 0.532614529f},
-std::array<float,2>{0.788556814f, 0.41799736f},
-std::array<float,2>{0.465734988f, 0.91917783f},
-std::array<float,2>{0.379456252f, 0.246454448f},
-std::array<float,2>{0.813537896f, 0.68240118f},
-std::array<float,2>{0.685504317f, 0.268657774f},
-std::array<float,2>{0.0701780245f, 0.755467415f},
-std::array<float,2>{0.18490161f, 0.490568966f},
-std::array<float,2>{0.542184651f, 0.961281002f},
-std::array<float,2>{0.959632099f, 0.0900266021f},
-std::array<float,2>{0.338333994f, 0.5898031f},
-std::array<float,2>{0.456036001f, 0.354404956f},
-std::array<float,2>{0.790098727f, 0.835350394f},
-std::array<float,2>{0.746579766f, 0.134467006f},
-std::array<float,2>{0.0302574746f, 0.695251405f},
-std::array<float,2>{0.192392692f, 0.0304273032f},
-std::array<float,2>{0.591607571f, 0.504799068f},
-std::array<float,2>{0.929132879f, 0.391542375f},
-std::array<float,2>{0.27224201f, 0.892974913f},
-std::array<float,2>{0.329909533f, 0.191920623f},
-std::array<float,2>{0.965509117f, 0.647967875f},
-std::array<float,2>{0.537970304f, 0.291366518f},
-std::array<float,2>{0.172875211f, 0.808372855f},
-std::array<float,2>{0.0768939033f, 0.450119853f},
-std::array<float,2>{0.67622745f, 0.978272557f},
-std::array<float,2>{0.825864434f, 0.119520232f},
-std::array<float,2>{0.386396974f, 0.623565376f},
-std::array<float,2>{0.300513178f, 0.406372845f},
-std::array<float,2>{0.905874431f, 0.909720719f},
-std::array<float,2>{0.618267655f, 0.0479198284f},
-std::array<float,2>{0.24619545f, 0.543797255f},
-std::array<float,2>{0.0508889407f, 0.170434773f},
-std::array<float,2>{0.717259526f, 0.732994676f},
-std::array<float,2>{0.773226798f, 0.314661592f},
-std::array<float,2>{0.488756835f, 0.85269618f},
-std::array<float,2>{0.410560578f, 0.0857811943f},
-std::array<float,2>{0.845055282f, 0.579968631f},
-std::array<float,2>{0.655227363f, 0.49500972f},
-std::array<float,2>{0.121570028f, 0.958610773f},
-std::array<float,2>{0.143224284f, 0.278247118f},
-std::array<float,2>{0.505626738f, 0.764359474f},
-std::array<float,2>{0.976914465f, 0.242142975f},
-std::array<float,2>{0.373888701f, 0.677872837f},
-std::array<float,2>{0.3981857f, 0.479161114f},
-std::array<float,2>{0.829151273f, 0.945486367f},
-std::array<float,2>{0.668908775f, 0.0666516647f},
-std::array<float,2>{0.0890936777f, 0.565391481f},
-std::array<float,2>{0.164533481f, 0.225897148f},
-std::array<float,2>{0.56036818f, 0.662802041f},
-std::array<float,2>{0.945913374f, 0.252988666f},
-std::array<float,2>{0.317550957f, 0.7783342f},
-std::array<float,2>{0.252023458f, 0.0462217219f},
-std::array<float,2>{0.921867371f, 0.558497012f},
-std::array<float,2>{0.571069241f, 0.428817689f},
-std::array<float,2>{0.211534634f, 0.92402494f},
-std::array<float,2>{0.00802234933f, 0.335067511f},
-std::array<float,2>{0.726053536f, 0.860619903f},
-std::array<float,2>{0.796964645f, 0.173334554f},
-std::array<float,2>{0.442363262f, 0.738234222f},
-std::array<float,2>{0.353144258f, 0.301806897f},
-std::array<float,2>{0.997960031f, 0.782516539f},
-std::array<float,2>{0.526654124f, 0.211033165f},
-std::array<float,2>{0.133112371f, 0.62642771f},
-std::array<float,2>{0.102177531f, 0.107993998f},
-std::array<float,2>{0.635772943f, 0.60242641f},
-std::array<float,2>{0.869349539f, 0.462303281f},
-std::array<float,2>{0.422664076f, 0.989698946f},
-std::array<float,2>{0.470641941f, 0.142318964f},
-std::array<float,2>{0.754246891f, 0.717402518f},
-std::array<float,2>{0.693399191f, 0.362935752f},
-std::array<float,2>{0.0313306637f, 0.812780738f},
-std::array<float,2>{0.232044533f, 0.375597954f},
-std::array<float,2>{0.607549727f, 0.888787746f},
-std::array<float,2>{0.890085816f, 0.0103125041f},
-std::array<float,2>{0.293698341f, 0.51993072f},
-std::array<float,2>{0.489520788f, 0.28109771f},
-std::array<float,2>{0.771530628f, 0.763267815f},
-std::array<float,2>{0.718108773f, 0.240071684f},
-std::array<float,2>{0.0518813282f, 0.676235259f},
-std::array<float,2>{0.24761942f, 0.0832683146f},
-std::array<float,2>{0.618078411f, 0.581812024f},
-std::array<float,2>{0.905062973f, 0.493625432f},
-std::array<float,2>{0.298948318f, 0.959698617f},
-std::array<float,2>{0.374798894f, 0.169081628f},
-std::array<float,2>{0.978003502f, 0.7305848f},
-std::array<float,2>{0.503972352f, 0.31369549f},
-std::array<float,2>{0.144121408f, 0.855157495f},
-std::array<float,2>{0.122987814f, 0.408778697f},
-std::array<float,2>{0.655552685f, 0.907204807f},
-std::array<float,2>{0.844000936f, 0.0492188334f},
-std::array<float,2>{0.411962271f, 0.545254648f},
-std::array<float,2>{0.272570372f, 0.452783763f},
-std::array<float,2>{0.928587019f, 0.97905457f},
-std::array<float,2>{0.590553224f, 0.117396131f},
-std::array<float,2>{0.191718057f, 0.621394455f},
-std::array<float,2>{0.0309130885f, 0.195220977f},
-std::array<float,2>{0.747208834f, 0.644612849f},
-std::array<float,2>{0.789550006f, 0.289119393f},
-std::array<float,2>{0.456552327f, 0.805303514f},
-std::array<float,2>{0.385347605f, 0.0281655192f},
-std::array<float,2>{0.824966013f, 0.506856084f},
-std::array<float,2>{0.677054226f, 0.392721027f},
-std::array<float,2>{0.0776107535f, 0.89103508f},
-std::array<float,2>{0.172403485f, 0.352315485f},
-std::array<float,2>{0.538382053f, 0.832356215f},
-std::array<float,2>{0.966471195f, 0.13628234f},
-std::array<float,2>{0.328959286f, 0.691754639f},
-std::array<float,2>{0.422941953f, 0.378475666f},
-std::array<float,2>{0.870459199f, 0.886847913f},
-std::array<float,2>{0.635418475f, 0.00817620102f},
-std::array<float,2>{0.102729268f, 0.52318573f},
-std::array<float,2>{0.134222358f, 0.144098967f},
-std::array<float,2>{0.526136518f, 0.715129077f},
-std::array<float,2>{0.996837854f, 0.36086458f},
-std::array<float,2>{0.351983726f, 0.815469146f},
-std::array<float,2>{0.294837445f, 0.105806984f},
-std::array<float,2>{0.888880372f, 0.603720367f},
-std::array<float,2>{0.608930826f, 0.464665562f},
-std::array<float,2>{0.231441766f, 0.991027832f},
-std::array<float,2>{0.0328055695f, 0.303854674f},
-std::array<float,2>{0.694948912f, 0.78441906f},
-std::array<float,2>{0.755284131f, 0.213802785f},
-std::array<float,2>{0.469289899f, 0.62827605f},
-std::array<float,2>{0.316478193f, 0.332173645f},
-std::array<float,2>{0.94678086f, 0.862692416f},
-std::array<float,2>{0.559001148f, 0.175281271f},
-std::array<float,2>{0.165947035f, 0.735302448f},
-std::array<float,2>{0.0884835124f, 0.0437764749f},
-std::array<float,2>{0.669534206f, 0.556563377f},
-std::array<float,2>{0.828929007f, 0.425833195f},
-std::array<float,2>{0.397368848f, 0.922370374f},
-std::array<float,2>{0.44258073f, 0.224137962f},
-std::array<float,2>{0.798167348f, 0.661114275f},
-std::array<float,2>{0.724860787f, 0.251462191f},
-std::array<float,2>{0.00897339266f, 0.77976191f},
-std::array<float,2>{0.212530613f, 0.477946699f},
-std::array<float,2>{0.571549118f, 0.948148608f},
-std::array<float,2>{0.920419991f, 0.0696893483f},
-std::array<float,2>{0.253228337f, 0.562963426f},
-std::array<float,2>{0.405057758f, 0.374337286f},
-std::array<float,2>{0.841513336f, 0.825175405f},
-std::array<float,2>{0.66383338f, 0.152032956f},
-std::array<float,2>{0.0854453295f, 0.71018225f},
-std::array<float,2>{0.161175758f, 0.00683412328f},
-std::array<float,2>{0.5498932f, 0.526131988f},
-std::array<float,2>{0.940087557f, 0.389128119f},
-std::array<float,2>{0.327989876f, 0.880476773f},
-std::array<float,2>{0.264163315f, 0.204696208f},
-std::array<float,2>{0.907822311f, 0.635737538f},
-std::array<float,2>{0.568521559f, 0.311323792f},
-std::array<float,2>{0.208979845f, 0.796630442f},
-std::array<float,2>{0.00457159989f, 0.456648827f},
-std::array<float,2>{0.726629555f, 0.992274404f},
-std::array<float,2>{0.810139179f, 0.0948471725f},
-std::array<float,2>{0.447559983f, 0.595844626f},
-std::array<float,2>{0.350587368f, 0.432255805f},
-std::array<float,2>{0.992071331f, 0.936741531f},
-std::array<float,2>{0.520557284f, 0.0320733711f},
-std::array<float,2>{0.131793484f, 0.548086107f},
-std::array<float,2>{0.0970540866f, 0.181264058f},
-std::array<float,2>{0.625805795f, 0.747784853f},
-std::array<float,2>{0.860691547f, 0.337167025f},
-std::array<float,2>{0.433715373f, 0.869152784f},
-std::array<float,2>{0.484363973f, 0.0744549334f},
-std::array<float,2>{0.758533239f, 0.574738204f},
-std::array<float,2>{0.703117549f, 0.469848663f},
-std::array<float,2>{0.0413468331f, 0.944788218f},
-std::array<float,2>{0.22496894f, 0.260082841f},
-std::array<float,2>{0.596008658f, 0.767512202f},
-std::array<float,2>{0.87735647f, 0.234069467f},
-std::array<float,2>{0.285879642f, 0.668751955f},
-std::array<float,2>{0.466384143f, 0.488585293f},
-std::array<float,2>{0.788014412f, 0.96355474f},
-std::array<float,2>{0.741456985f, 0.0921186954f},
-std::array<float,2>{0.0192276835f, 0.58778441f},
-std::array<float,2>{0.201114923f, 0.249165311f},
-std::array<float,2>{0.581094682f, 0.681412637f},
-std::array<float,2>{0.930043399f, 0.266076893f},
-std::array<float,2>{0.274570048f, 0.757358015f},
-std::array<float,2>{0.339570343f, 0.0553372726f},
-std::array<float,2>{0.959970653f, 0.534424126f},
-std::array<float,2>{0.541077793f, 0.421138257f},
-std::array<float,2>{0.184134036f, 0.919974267f},
-std::array<float,2>{0.0688423663f, 0.325577468f},
-std::array<float,2>{0.684525669f, 0.850169003f},
-std::array<float,2>{0.812810779f, 0.156860337f},
-std::array<float,2>{0.380140632f, 0.726004362f},
-std::array<float,2>{0.307929277f, 0.281312078f},
-std::array<float,2>{0.892657816f, 0.798530638f},
-std::array<float,2>{0.61672312f, 0.19815129f},
-std::array<float,2>{0.236788169f, 0.648714066f},
-std::array<float,2>{0.0568450838f, 0.116004959f},
-std::array<float,2>{0.703880608f, 0.615131378f},
-std::array<float,2>{0.780187309f, 0.444743901f},
-std::array<float,2>{0.49249199f, 0.969076574f},
-std::array<float,2>{0.415774673f, 0.129521012f},
-std::array<float,2>{0.858310878f, 0.698587716f},
-std::array<float,2>{0.642248809f, 0.345649093f},
-std::array<float,2>{0.116649836f, 0.838555455f},
-std::array<float,2>{0.151285976f, 0.403019547f},
-std::array<float,2>{0.514910996f, 0.900195897f},
-std::array<float,2>{0.969465613f, 0.0159611143f},
-std::array<float,2>{0.362827092f, 0.512435019f},
-std::array<float,2>{0.406899571f, 0.307882279f},
-std::array<float,2>{0.849596322f, 0.791942716f},
-std::array<float,2>{0.649153352f, 0.208070517f},
-std::array<float,2>{0.120111331f, 0.64043957f},
-std::array<float,2>{0.147444442f, 0.0978017673f},
-std::array<float,2>{0.502729297f, 0.598094463f},
-std::array<float,2>{0.983520448f, 0.460216135f},
-std::array<float,2>{0.369402826f, 0.997706413f},
-std::array<float,2>{0.30386588f, 0.153089494f},
-std::array<float,2>{0.901744246f, 0.703752637f},
-std::array<float,2>{0.622249722f, 0.370483488f},
-std::array<float,2>{0.244494066f, 0.823707402f},
-std::array<float,2>{0.0506753065f, 0.383537233f},
-std::array<float,2>{0.714367509f, 0.877357423f},
-std::array<float,2>{0.766620874f, 0.00179969973f},
-std::array<float,2>{0.487129658f, 0.528049767f},
-std::array<float,2>{0.333711088f, 0.474859536f},
-std::array<float,2>{0.961082935f, 0.939727187f},
-std::array<float,2>{0.532653213f, 0.0707422346f},
-std::array<float,2>{0.177760571f, 0.573511958f},
-std::array<float,2>{0.0729911476f, 0.229605407f},
-std::array<float,2>{0.673494935f, 0.66501528f},
-std::array<float,2>{0.823794782f, 0.261956424f},
-std::array<float,2>{0.390277237f, 0.77159971f},
-std::array<float,2>{0.457801849f, 0.0384620428f},
-std::array<float,2>{0.795714676f, 0.553741217f},
-std::array<float,2>{0.745418012f, 0.433889896f},
-std::array<float,2>{0.0247552488f, 0.931809127f},
-std::array<float,2>{0.190471336f, 0.342824221f},
-std::array<float,2>{0.587846518f, 0.874554336f},
-std::array<float,2>{0.922640383f, 0.18718566f},
-std::array<float,2>{0.268795431f, 0.744371712f},
-std::array<float,2>{0.473940045f, 0.416295826f},
-std::array<float,2>{0.750691235f, 0.914690316f},
-std::array<float,2>{0.687636197f, 0.0603747219f},
-std::array<float,2>{0.0365249142f, 0.535843492f},
-std::array<float,2>{0.226683542f, 0.161774293f},
-std::array<float,2>{0.602844238f, 0.720455587f},
-std::array<float,2>{0.886224508f, 0.322271377f},
-std::array<float,2>{0.289221257f, 0.846651137f},
-std::array<float,2>{0.356050432f, 0.0889341235f},
-std::array<float,2>{0.994994521f, 0.593393564f},
-std::array<float,2>{0.528052807f, 0.488027722f},
-std::array<float,2>{0.140467614f, 0.966679215f},
-std::array<float,2>{0.10907539f, 0.271546483f},
-std::array<float,2>{0.63684845f, 0.752254546f},
-std::array<float,2>{0.872261941f, 0.244846612f},
-std::array<float,2>{0.426255971f, 0.687238872f},
-std::array<float,2>{0.256053329f, 0.348180234f},
-std::array<float,2>{0.917733788f, 0.840055108f},
-std::array<float,2>{0.574756801f, 0.125808313f},
-std::array<float,2>{0.215992332f, 0.699247897f},
-std::array<float,2>{0.0149154561f, 0.0209312569f},
-std::array<float,2>{0.721112967f, 0.510052085f},
-std::array<float,2>{0.802770019f, 0.399709851f},
-std::array<float,2>{0.438770384f, 0.90362972f},
-std::array<float,2>{0.39215821f, 0.199826494f},
-std::array<float,2>{0.833028018f, 0.65333426f},
-std::array<float,2>{0.664651215f, 0.28610459f},
-std::array<float,2>{0.0906549618f, 0.804334462f},
-std::array<float,2>{0.170599043f, 0.439834356f},
-std::array<float,2>{0.556119859f, 0.974991858f},
-std::array<float,2>{0.952273369f, 0.110497713f},
-std::array<float,2>{0.314220488f, 0.610355258f},
-std::array<float,2>{0.452161431f, 0.318100542f},
-std::array<float,2>{0.808249533f, 0.856122315f},
-std::array<float,2>{0.731198072f, 0.165675178f},
-std::array<float,2>{0.000499115093f, 0.727854013f},
-std::array<float,2>{0.20633319f, 0.050934162f},
-std::array<float,2>{0.565401495f, 0.540175498f},
-std::array<float,2>{0.91272074f, 0.413682967f},
-std::array<float,2>{0.258540839f, 0.910723746f},
-std::array<float,2>{0.323313683f, 0.234934285f},
-std::array<float,2>{0.942308664f, 0.673453093f},
-std::array<float,2>{0.554638624f, 0.273919106f},
-std::array<float,2>{0.158000767f, 0.758326948f},
-std::array<float,2>{0.0802734718f, 0.496317685f},
-std::array<float,2>{0.658172786f, 0.955936551f},
-std::array<float,2>{0.838423789f, 0.0804648548f},
-std::array<float,2>{0.399430364f, 0.583262324f},
-std::array<float,2>{0.283269018f, 0.397066712f},
-std::array<float,2>{0.882606149f, 0.896186471f},
-std::array<float,2>{0.597994685f, 0.0249158461f},
-std::array<float,2>{0.219668329f, 0.502476037f},
-std::array<float,2>{0.0462865829f, 0.140310064f},
-std::array<float,2>{0.695324779f, 0.689986408f},
-std::array<float,2>{0.761878729f, 0.356907785f},
-std::array<float,2>{0.476839364f, 0.830038071f},
-std::array<float,2>{0.430666983f, 0.122338071f},
-std::array<float,2>{0.86487025f, 0.617459357f},
-std::array<float,2>{0.631180882f, 0.446351677f},
-std::array<float,2>{0.0989236087f, 0.981799901f},
-std::array<float,2>{0.128719568f, 0.293209612f},
-std::array<float,2>{0.517797053f, 0.809796572f},
-std::array<float,2>{0.988010108f, 0.190495536f},
-std::array<float,2>{0.344547361f, 0.643281102f},
-std::array<float,2>{0.378201336f, 0.466655463f},
-std::array<float,2>{0.819163442f, 0.987494826f},
-std::array<float,2>{0.682712793f, 0.101688713f},
-std::array<float,2>{0.066186741f, 0.606761754f},
-std::array<float,2>{0.181099266f, 0.216511056f},
-std::array<float,2>{0.545498073f, 0.628963351f},
-std::array<float,2>{0.954179168f, 0.296990156f},
-std::array<float,2>{0.343533248f, 0.786447108f},
-std::array<float,2>{0.278391659f, 0.0150678037f},
-std::array<float,2>{0.936739743f, 0.51913923f},
-std::array<float,2>{0.583257556f, 0.381124884f},
-std::array<float,2>{0.196861103f, 0.885097027f},
-std::array<float,2>{0.0229010805f, 0.364424706f},
-std::array<float,2>{0.736020267f, 0.82020098f},
-std::array<float,2>{0.782843769f, 0.148110375f},
-std::array<float,2>{0.464691728f, 0.71287185f},
-std::array<float,2>{0.363737524f, 0.254989326f},
-std::array<float,2>{0.974575818f, 0.773538291f},
-std::array<float,2>{0.508908927f, 0.221917182f},
-std::array<float,2>{0.154804692f, 0.657999039f},
-std::array<float,2>{0.110753268f, 0.0648797005f},
-std::array<float,2>{0.648117781f, 0.569854319f},
-std::array<float,2>{0.853142738f, 0.481077522f},
-std::array<float,2>{0.418875456f, 0.951291621f},
-std::array<float,2>{0.497576445f, 0.177434981f},
-std::array<float,2>{0.776926816f, 0.739371359f},
-std::array<float,2>{0.709174156f, 0.330582708f},
-std::array<float,2>{0.059546791f, 0.86683768f},
-std::array<float,2>{0.239876524f, 0.425370604f},
-std::array<float,2>{0.611966491f, 0.927912951f},
-std::array<float,2>{0.896337569f, 0.0424519256f},
-std::array<float,2>{0.309924304f, 0.562238395f},
-std::array<float,2>{0.454420537f, 0.291176885f},
-std::array<float,2>{0.791350543f, 0.808166623f},
-std::array<float,2>{0.749845326f, 0.192179531f},
-std::array<float,2>{0.0286500491f, 0.648378968f},
-std::array<float,2>{0.195297226f, 0.119302869f},
-std::array<float,2>{0.592902184f, 0.623880088f},
-std::array<float,2>{0.927179873f, 0.449814141f},
-std::array<float,2>{0.269661486f, 0.978044033f},
-std::array<float,2>{0.33028993f, 0.134764835f},
-std::array<float,2>{0.968135357f, 0.694903612f},
-std::array<float,2>{0.536800325f, 0.354214966f},
-std::array<float,2>{0.174551159f, 0.835171223f},
-std::array<float,2>{0.0759602636f, 0.391324908f},
-std::array<float,2>{0.679172754f, 0.892736852f},
-std::array<float,2>{0.827996373f, 0.0307131615f},
-std::array<float,2>{0.384221554f, 0.504626155f},
-std::array<float,2>{0.297656298f, 0.49470669f},
-std::array<float,2>{0.902468801f, 0.958917022f},
-std::array<float,2>{0.619368196f, 0.085632205f},
-std::array<float,2>{0.249058753f, 0.579613388f},
-std::array<float,2>{0.0541405454f, 0.241877541f},
-std::array<float,2>{0.71590209f, 0.678068936f},
-std::array<float,2>{0.770956278f, 0.277876705f},
-std::array<float,2>{0.491497636f, 0.764537275f},
-std::array<float,2>{0.412270248f, 0.0483308993f},
-std::array<float,2>{0.847166598f, 0.543570399f},
-std::array<float,2>{0.652656257f, 0.406543821f},
-std::array<float,2>{0.124975994f, 0.909927547f},
-std::array<float,2>{0.140907899f, 0.314784855f},
-std::array<float,2>{0.507808626f, 0.852966547f},
-std::array<float,2>{0.978670835f, 0.170897499f},
-std::array<float,2>{0.372561336f, 0.733171523f},
-std::array<float,2>{0.395539761f, 0.42905575f},
-std::array<float,2>{0.830351412f, 0.924153388f},
-std::array<float,2>{0.670403361f, 0.0460868068f},
-std::array<float,2>{0.0864259899f, 0.558300376f},
-std::array<float,2>{0.166880533f, 0.172951624f},
-std::array<float,2>{0.560718179f, 0.737945855f},
-std::array<float,2>{0.9476704f, 0.335304737f},
-std::array<float,2>{0.319347382f, 0.860455751f},
-std::array<float,2>{0.251125902f, 0.066643998f},
-std::array<float,2>{0.919758201f, 0.565154076f},
-std::array<float,2>{0.572624564f, 0.479425788f},
-std::array<float,2>{0.213691309f, 0.945674777f},
-std::array<float,2>{0.0103180688f, 0.25333643f},
-std::array<float,2>{0.724071205f, 0.778802156f},
-std::array<float,2>{0.80016464f, 0.225736558f},
-std::array<float,2>{0.444561064f, 0.662930787f},
-std::array<float,2>{0.354131728f, 0.363062054f},
-std::array<float,2>{0.999771118f, 0.812651873f},
-std::array<float,2>{0.523936033f, 0.142370671f},
-std::array<float,2>{0.135531008f, 0.717607558f},
-std::array<float,2>{0.104689248f, 0.0106267855f},
-std::array<float,2>{0.633072019f, 0.519563019f},
-std::array<float,2>{0.868471324f, 0.375953525f},
-std::array<float,2>{0.424280673f, 0.889087677f},
-std::array<float,2>{0.471544743f, 0.211277947f},
-std::array<float,2>{0.756201327f, 0.626135767f},
-std::array<float,2>{0.691966712f, 0.302018344f},
-std::array<float,2>{0.0336340368f, 0.78243804f},
-std::array<float,2>{0.232985795f, 0.462125838f},
-std::array<float,2>{0.607138336f, 0.989473879f},
-std::array<float,2>{0.88788712f, 0.108179383f},
-std::array<float,2>{0.295021474f, 0.602279782f},
-std::array<float,2>{0.437137872f, 0.339214832f},
-std::array<float,2>{0.861989081f, 0.867689252f},
-std::array<float,2>{0.627622247f, 0.183105305f},
-std::array<float,2>{0.0940921381f, 0.748643279f},
-std::array<float,2>{0.129784986f, 0.0349633209f},
-std::array<float,2>{0.522891164f, 0.549064636f},
-std::array<float,2>{0.990060985f, 0.430385858f},
-std::array<float,2>{0.347732991f, 0.935538232f},
-std::array<float,2>{0.287669539f, 0.231826618f},
-std::array<float,2>{0.876553655f, 0.670434773f},
-std::array<float,2>{0.595224679f, 0.259150028f},
-std::array<float,2>{0.222780824f, 0.76934886f},
-std::array<float,2>{0.0404443145f, 0.471426547f},
-std::array<float,2>{0.70015043f, 0.942594886f},
-std::array<float,2>{0.759829581f, 0.0775588006f},
-std::array<float,2>{0.481597543f, 0.578107059f},
-std::array<float,2>{0.324843019f, 0.387131244f},
-std::array<float,2>{0.937959492f, 0.881298542f},
-std::array<float,2>{0.54827404f, 0.00419125939f},
-std::array<float,2>{0.162604377f, 0.52360332f},
-std::array<float,2>{0.0836907551f, 0.150274694f},
-std::array<float,2>{0.660385966f, 0.708285153f},
-std::array<float,2>{0.84303844f, 0.372496456f},
-std::array<float,2>{0.404025167f, 0.827335656f},
-std::array<float,2>{0.445630014f, 0.0966154784f},
-std::array<float,2>{0.81091553f, 0.595246494f},
-std::array<float,2>{0.729870021f, 0.454222411f},
-std::array<float,2>{0.00676925061f, 0.995830536f},
-std::array<float,2>{0.20969291f, 0.309945524f},
-std::array<float,2>{0.567159593f, 0.794395387f},
-std::array<float,2>{0.909517109f, 0.206740931f},
-std::array<float,2>{0.262092233f, 0.633497536f},
-std::array<float,2>{0.494425267f, 0.443104357f},
-std::array<float,2>{0.778192043f, 0.971794367f},
-std::array<float,2>{0.706631482f, 0.113698401f},
-std::array<float,2>{0.0555928126f, 0.615338624f},
-std::array<float,2>{0.235593513f, 0.19535087f},
-std::array<float,2>{0.614840806f, 0.651157022f},
-std::array<float,2>{0.891177416f, 0.284827799f},
-std::array<float,2>{0.306114346f, 0.800005913f},
-std::array<float,2>{0.361202836f, 0.0182286464f},
-std::array<float,2>{0.97115159f, 0.51462996f},
-std::array<float,2>{0.512996376f, 0.404982626f},
-std::array<float,2>{0.148632258f, 0.901829004f},
-std::array<float,2>{0.114091426f, 0.346743852f},
-std::array<float,2>{0.643353879f, 0.837466955f},
-std::array<float,2>{0.8568573f, 0.131529093f},
-std::array<float,2>{0.417722434f, 0.695444822f},
-std::array<float,2>{0.27617532f, 0.268940657f},
-std::array<float,2>{0.933045387f, 0.755714297f},
-std::array<float,2>{0.58006978f, 0.246191517f},
-std::array<float,2>{0.202407181f, 0.682172954f},
-std::array<float,2>{0.016873911f, 0.0902175829f},
-std::array<float,2>{0.738484919f, 0.58955574f},
-std::array<float,2>{0.785866499f, 0.490245044f},
-std::array<float,2>{0.467442065f, 0.961128771f},
-std::array<float,2>{0.381014526f, 0.158633843f},
-std::array<float,2>{0.815241635f, 0.723989546f},
-std::array<float,2>{0.686816931f, 0.326770604f},
-std::array<float,2>{0.0676294863f, 0.848836482f},
-std::array<float,2>{0.186635584f, 0.418233097f},
-std::array<float,2>{0.540307999f, 0.91935873f},
-std::array<float,2>{0.957650304f, 0.0573558696f},
-std::array<float,2>{0.337846726f, 0.532455504f},
-std::array<float,2>{0.387056589f, 0.264713138f},
-std::array<float,2>{0.821944237f, 0.769975543f},
-std::array<float,2>{0.674046934f, 0.226778477f},
-std::array<float,2>{0.0708283111f, 0.666892886f},
-std::array<float,2>{0.176617056f, 0.0731180087f},
-std::array<float,2>{0.534915328f, 0.570776761f},
-std::array<float,2>{0.963049829f, 0.474067897f},
-std::array<float,2>{0.334303886f, 0.93752557f},
-std::array<float,2>{0.267196208f, 0.184821352f},
-std::array<float,2>{0.925145864f, 0.743246675f},
-std::array<float,2>{0.588800073f, 0.341772109f},
-std::array<float,2>{0.188739032f, 0.872509122f},
-std::array<float,2>{0.0261653643f, 0.4361507f},
-std::array<float,2>{0.742819071f, 0.930521667f},
-std::array<float,2>{0.793891966f, 0.0353409648f},
-std::array<float,2>{0.460031033f, 0.552511394f},
-std::array<float,2>{0.367418975f, 0.458380789f},
-std::array<float,2>{0.981146276f, 0.999898851f},
-std::array<float,2>{0.500183344f, 0.100220755f},
-std::array<float,2>{0.144757122f, 0.59965533f},
-std::array<float,2>{0.117531024f, 0.209198266f},
-std::array<float,2>{0.65064615f, 0.638286829f},
-std::array<float,2>{0.85081625f, 0.30529812f},
-std::array<float,2>{0.409432322f, 0.790501416f},
-std::array<float,2>{0.485859603f, 0.00357655971f},
-std::array<float,2>{0.767866492f, 0.530878842f},
-std::array<float,2>{0.711594164f, 0.385932624f},
-std::array<float,2>{0.0470225587f, 0.875836015f},
-std::array<float,2>{0.242899716f, 0.367378116f},
-std::array<float,2>{0.624510527f, 0.821590543f},
-std::array<float,2>{0.898724735f, 0.155848116f},
-std::array<float,2>{0.302607745f, 0.706262112f},
-std::array<float,2>{0.440401196f, 0.40133822f},
-std::array<float,2>{0.800840437f, 0.904627442f},
-std::array<float,2>{0.719562113f, 0.0233271606f},
-std::array<float,2>{0.0127207087f, 0.508796275f},
-std::array<float,2>{0.21872887f, 0.128360063f},
-std::array<float,2>{0.577273071f, 0.702796996f},
-std::array<float,2>{0.915724695f, 0.350542367f},
-std::array<float,2>{0.254968345f, 0.842181921f},
-std::array<float,2>{0.314875185f, 0.112609103f},
-std::array<float,2>{0.951045513f, 0.612453818f},
-std::array<float,2>{0.557208121f, 0.438711047f},
-std::array<float,2>{0.169623643f, 0.97409749f},
-std::array<float,2>{0.0931173563f, 0.288167804f},
-std::array<float,2>{0.667967916f, 0.802283108f},
-std::array<float,2>{0.835792482f, 0.201554686f},
-std::array<float,2>{0.393600136f, 0.65598315f},
-std::array<float,2>{0.291042179f, 0.320354432f},
-std::array<float,2>{0.883142054f, 0.84535867f},
-std::array<float,2>{0.604527831f, 0.163772181f},
-std::array<float,2>{0.229697719f, 0.722225428f},
-std::array<float,2>{0.0384881198f, 0.0607630424f},
-std::array<float,2>{0.690796018f, 0.537406087f},
-std::array<float,2>{0.753307521f, 0.414081216f},
-std::array<float,2>{0.475198686f, 0.916101873f},
-std::array<float,2>{0.427891374f, 0.242604211f},
-std::array<float,2>{0.87370491f, 0.683820724f},
-std::array<float,2>{0.640075326f, 0.270330846f},
-std::array<float,2>{0.10699477f, 0.751218021f},
-std::array<float,2>{0.136780307f, 0.485623002f},
-std::array<float,2>{0.530770719f, 0.968096554f},
-std::array<float,2>{0.993169844f, 0.0874611512f},
-std::array<float,2>{0.359077722f, 0.590067625f},
-std::array<float,2>{0.48019892f, 0.359343231f},
-std::array<float,2>{0.76484561f, 0.831615329f},
-std::array<float,2>{0.697744787f, 0.137551159f},
-std::array<float,2>{0.0437336862f, 0.687573135f},
-std::array<float,2>{0.221671894f, 0.0259487238f},
-std::array<float,2>{0.600780427f, 0.500713825f},
-std::array<float,2>{0.879056871f, 0.396199942f},
-std::array<float,2>{0.281493902f, 0.897455812f},
-std::array<float,2>{0.346785039f, 0.189439669f},
-std::array<float,2>{0.984574258f, 0.640965581f},
-std::array<float,2>{0.516919196f, 0.296816379f},
-std::array<float,2>{0.126575425f, 0.811005831f},
-std::array<float,2>{0.100694671f, 0.448275f},
-std::array<float,2>{0.629323542f, 0.983495772f},
-std::array<float,2>{0.866207659f, 0.12479569f},
-std::array<float,2>{0.432972729f, 0.620117128f},
-std::array<float,2>{0.261649609f, 0.410865754f},
-std::array<float,2>{0.91131103f, 0.912416279f},
-std::array<float,2>{0.562658966f, 0.0545599535f},
-std::array<float,2>{0.203697622f, 0.542270243f},
-std::array<float,2>{0.00390031189f, 0.166345805f},
-std::array<float,2>{0.733994186f, 0.729834855f},
-std::array<float,2>{0.805261433f, 0.318499714f},
-std::array<float,2>{0.450169921f, 0.859297335f},
-std::array<float,2>{0.400426149f, 0.0796023458f},
-std::array<float,2>{0.836983383f, 0.585010469f},
-std::array<float,2>{0.659304082f, 0.498302966f},
-std::array<float,2>{0.0787399784f, 0.953452349f},
-std::array<float,2>{0.159371153f, 0.276526034f},
-std::array<float,2>{0.552074254f, 0.760457337f},
-std::array<float,2>{0.94460398f, 0.236829102f},
-std::array<float,2>{0.321231782f, 0.674092233f},
-std::array<float,2>{0.421551406f, 0.48366645f},
-std::array<float,2>{0.854849696f, 0.949635208f},
-std::array<float,2>{0.645622432f, 0.0632202402f},
-std::array<float,2>{0.113142155f, 0.566984951f},
-std::array<float,2>{0.152837157f, 0.219660282f},
-std::array<float,2>{0.510747135f, 0.659783483f},
-std::array<float,2>{0.975886047f, 0.257519305f},
-std::array<float,2>{0.366190881f, 0.776392162f},
-std::array<float,2>{0.311035454f, 0.0398994684f},
-std::array<float,2>{0.896840692f, 0.559427798f},
-std::array<float,2>{0.611200333f, 0.422223151f},
-std::array<float,2>{0.24097769f, 0.927553177f},
-std::array<float,2>{0.0622856915f, 0.329150438f},
-std::array<float,2>{0.70805341f, 0.863783121f},
-std::array<float,2>{0.774251223f, 0.179394186f},
-std::array<float,2>{0.499551028f, 0.740293682f},
-std::array<float,2>{0.341675878f, 0.300238371f},
-std::array<float,2>{0.956211686f, 0.788097203f},
-std::array<float,2>{0.54375577f, 0.216939092f},
-std::array<float,2>{0.182422087f, 0.631748319f},
-std::array<float,2>{0.0634258613f, 0.105442099f},
-std::array<float,2>{0.681184828f, 0.608945131f},
-std::array<float,2>{0.817164242f, 0.466831893f},
-std::array<float,2>{0.375335127f, 0.984762847f},
-std::array<float,2>{0.46280399f, 0.14585875f},
-std::array<float,2>{0.783916712f, 0.713137746f},
-std::array<float,2>{0.736776769f, 0.365593106f},
-std::array<float,2>{0.0203855149f, 0.817640364f},
-std::array<float,2>{0.197327003f, 0.380295157f},
-std::array<float,2>{0.584416926f, 0.88383615f},
-std::array<float,2>{0.93373239f, 0.0134589812f},
-std::array<float,2>{0.279730827f, 0.517143905f},
-std::array<float,2>{0.444094688f, 0.250631124f},
-std::array<float,2>{0.799630404f, 0.780663788f},
-std::array<float,2>{0.72315979f, 0.222765729f},
-std::array<float,2>{0.0113067115f, 0.661494195f},
-std::array<float,2>{0.2138713f, 0.068732515f},
-std::array<float,2>{0.573335052f, 0.563679636f},
-std::array<float,2>{0.918837547f, 0.477271378f},
-std::array<float,2>{0.250848949f, 0.949174941f},
-std::array<float,2>{0.318954766f, 0.174513966f},
-std::array<float,2>{0.948557019f, 0.735380352f},
-std::array<float,2>{0.561615646f, 0.333227009f},
-std::array<float,2>{0.16736351f, 0.861460209f},
-std::array<float,2>{0.0869153142f, 0.427477032f},
-std::array<float,2>{0.671859801f, 0.923472404f},
-std::array<float,2>{0.831649184f, 0.0448257476f},
-std::array<float,2>{0.395149946f, 0.554832518f},
-std::array<float,2>{0.296107143f, 0.463687569f},
-std::array<float,2>{0.886802435f, 0.991966188f},
-std::array<float,2>{0.606343746f, 0.107282706f},
-std::array<float,2>{0.234268606f, 0.605392039f},
-std::array<float,2>{0.0344361961f, 0.21450609f},
-std::array<float,2>{0.693206966f, 0.627185941f},
-std::array<float,2>{0.757535458f, 0.303411156f},
-std::array<float,2>{0.472216576f, 0.783324301f},
-std::array<float,2>{0.424966037f, 0.00953186862f},
-std::array<float,2>{0.868160725f, 0.522292376f},
-std::array<float,2>{0.633976877f, 0.377002567f},
-std::array<float,2>{0.104066417f, 0.888356268f},
-std::array<float,2>{0.136143073f, 0.35944733f},
-std::array<float,2>{0.524569511f, 0.814872503f},
-std::array<float,2>{0.998948276f, 0.14288643f},
-std::array<float,2>{0.355102241f, 0.715922356f},
-std::array<float,2>{0.383200556f, 0.394107431f},
-std::array<float,2>{0.82701689f, 0.892244995f},
-std::array<float,2>{0.678108871f, 0.0287401155f},
-std::array<float,2>{0.0749519393f, 0.505949557f},
-std::array<float,2>{0.175175369f, 0.135131732f},
-std::array<float,2>{0.535851955f, 0.69250226f},
-std::array<float,2>{0.966869056f, 0.353427768f},
-std::array<float,2>{0.331733435f, 0.833815575f},
-std::array<float,2>{0.270952582f, 0.118451834f},
-std::array<float,2>{0.926500499f, 0.622363389f},
-std::array<float,2>{0.592159092f, 0.451465279f},
-std::array<float,2>{0.193585068f, 0.980399847f},
-std::array<float,2>{0.0275248457f, 0.290521652f},
-std::array<float,2>{0.748173714f, 0.806369841f},
-std::array<float,2>{0.792456925f, 0.194052294f},
-std::array<float,2>{0.453721881f, 0.64562124f},
-std::array<float,2>{0.371668249f, 0.312504143f},
-std::array<float,2>{0.980284393f, 0.85383451f},
-std::array<float,2>{0.506550312f, 0.168889672f},
-std::array<float,2>{0.142431989f, 0.731500208f},
-std::array<float,2>{0.123960055f, 0.0501642302f},
-std::array<float,2>{0.654157102f, 0.546426654f},
-std::array<float,2>{0.8466658f, 0.409564704f},
-std::array<float,2>{0.413907945f, 0.907791078f},
-std::array<float,2>{0.490762174f, 0.239194423f},
-std::array<float,2>{0.770212054f, 0.677354395f},
-std::array<float,2>{0.71535939f, 0.279380322f},
-std::array<float,2>{0.0530067198f, 0.762637854f},
-std::array<float,2>{0.248943716f, 0.49276638f},
-std::array<float,2>{0.620669961f, 0.960173965f},
-std::array<float,2>{0.903838038f, 0.0821202397f},
-std::array<float,2>{0.297870517f, 0.580176175f},
-std::array<float,2>{0.416804403f, 0.34383437f},
-std::array<float,2>{0.855676711f, 0.839395285f},
-std::array<float,2>{0.643849909f, 0.130123153f},
-std::array<float,2>{0.11515376f, 0.697960138f},
-std::array<float,2>{0.149880931f, 0.0169292707f},
-std::array<float,2>{0.512027264f, 0.512845755f},
-std::array<float,2>{0.971682787f, 0.403583795f},
-std::array<float,2>{0.359679341f, 0.898914278f},
-std::array<float,2>{0.304897338f, 0.19886452f},
-std::array<float,2>{0.892529011f, 0.650251508f},
-std::array<float,2>{0.613418579f, 0.282439947f},
-std::array<float,2>{0.234515533f, 0.797200441f},
-std::array<float,2>{0.0562507398f, 0.443415761f},
-std::array<float,2>{0.705791116f, 0.970036447f},
-std::array<float,2>{0.77859056f, 0.116557367f},
-std::array<float,2>{0.495450765f, 0.613719761f},
-std::array<float,2>{0.336131364f, 0.42005983f},
-std::array<float,2>{0.958936453f, 0.921122432f},
-std::array<float,2>{0.539930165f, 0.0558182485f},
-std::array<float,2>{0.185870588f, 0.533439159f},
-std::array<float,2>{0.0665132403f, 0.157460958f},
-std::array<float,2>{0.685765624f, 0.724849761f},
-std::array<float,2>{0.815588832f, 0.324641913f},
-std::array<float,2>{0.382481217f, 0.851246893f},
-std::array<float,2>{0.467784047f, 0.0930012316f},
-std::array<float,2>{0.786408782f, 0.586142004f},
-std::array<float,2>{0.739429832f, 0.489705265f},
-std::array<float,2>{0.0159476846f, 0.964840114f},
-std::array<float,2>{0.201357111f, 0.266986758f},
-std::array<float,2>{0.578907251f, 0.756373465f},
-std::array<float,2>{0.931916237f, 0.248162732f},
-std::array<float,2>{0.276990205f, 0.680091619f},
-std::array<float,2>{0.480828792f, 0.469619691f},
-std::array<float,2>{0.761168718f, 0.943962574f},
-std::array<float,2>{0.700829089f, 0.0761187598f},
-std::array<float,2>{0.0397698097f, 0.576170743f},
-std::array<float,2>{0.224193558f, 0.232425883f},
-std::array<float,2>{0.594168246f, 0.669311404f},
-std::array<float,2>{0.875733078f, 0.26165694f},
-std::array<float,2>{0.288103849f, 0.765756547f},
-std::array<float,2>{0.349572569f, 0.032289058f},
-std::array<float,2>{0.988997936f, 0.54747647f},
-std::array<float,2>{0.521616161f, 0.433547437f},
-std::array<float,2>{0.130691409f, 0.936355591f},
-std::array<float,2>{0.0953449607f, 0.336693943f},
-std::array<float,2>{0.628178835f, 0.871081829f},
-std::array<float,2>{0.862712324f, 0.180097893f},
-std::array<float,2>{0.436409473f, 0.746123374f},
-std::array<float,2>{0.263357311f, 0.312431425f},
-std::array<float,2>{0.909177542f, 0.795165598f},
-std::array<float,2>{0.568205595f, 0.20399259f},
-std::array<float,2>{0.210207537f, 0.6362499f},
-std::array<float,2>{0.00748297339f, 0.0941191241f},
-std::array<float,2>{0.729235768f, 0.597354174f},
-std::array<float,2>{0.812153101f, 0.455810606f},
-std::array<float,2>{0.447144687f, 0.993177772f},
-std::array<float,2>{0.402372003f, 0.150439695f},
-std::array<float,2>{0.841953874f, 0.709674716f},
-std::array<float,2>{0.661745667f, 0.373731703f},
-std::array<float,2>{0.082509689f, 0.825677693f},
-std::array<float,2>{0.163271055f, 0.390129924f},
-std::array<float,2>{0.547414005f, 0.879060328f},
-std::array<float,2>{0.939149678f, 0.00741307577f},
-std::array<float,2>{0.326097846f, 0.527292132f},
-std::array<float,2>{0.393332571f, 0.286327928f},
-std::array<float,2>{0.834860802f, 0.803651631f},
-std::array<float,2>{0.6662395f, 0.200298905f},
-std::array<float,2>{0.092534624f, 0.652573168f},
-std::array<float,2>{0.168909714f, 0.110020921f},
-std::array<float,2>{0.558082223f, 0.610262573f},
-std::array<float,2>{0.949473798f, 0.440496117f},
-std::array<float,2>{0.316222429f, 0.975886345f},
-std::array<float,2>{0.254242003f, 0.126359776f},
-std::array<float,2>{0.914299965f, 0.700401604f},
-std::array<float,2>{0.577146828f, 0.349550098f},
-std::array<float,2>{0.217170492f, 0.841566682f},
-std::array<float,2>{0.0118396506f, 0.398943514f},
-std::array<float,2>{0.720703006f, 0.903288424f},
-std::array<float,2>{0.801812828f, 0.0203758851f},
-std::array<float,2>{0.441155851f, 0.511158407f},
-std::array<float,2>{0.358029991f, 0.487287372f},
-std::array<float,2>{0.993076742f, 0.965479136f},
-std::array<float,2>{0.529383183f, 0.0881075636f},
-std::array<float,2>{0.137796998f, 0.592110097f},
-std::array<float,2>{0.106183797f, 0.245241001f},
-std::array<float,2>{0.639245152f, 0.685734391f},
-std::array<float,2>{0.874648035f, 0.273001641f},
-std::array<float,2>{0.428819239f, 0.753715217f},
-std::array<float,2>{0.476183653f, 0.0590661429f},
-std::array<float,2>{0.752731383f, 0.536305845f},
-std::array<float,2>{0.689866006f, 0.416996896f},
-std::array<float,2>{0.0371454358f, 0.915125847f},
-std::array<float,2>{0.228980079f, 0.323791832f},
-std::array<float,2>{0.604036689f, 0.847087502f},
-std::array<float,2>{0.884554267f, 0.160793751f},
-std::array<float,2>{0.292561948f, 0.719216585f},
-std::array<float,2>{0.459271073f, 0.435404181f},
-std::array<float,2>{0.794148803f, 0.933115423f},
-std::array<float,2>{0.744122744f, 0.0376781896f},
-std::array<float,2>{0.026829306f, 0.552765667f},
-std::array<float,2>{0.187727973f, 0.18592383f},
-std::array<float,2>{0.589348793f, 0.745956421f},
-std::array<float,2>{0.923950076f, 0.342611849f},
-std::array<float,2>{0.266334862f, 0.873705626f},
-std::array<float,2>{0.335353494f, 0.0721347854f},
-std::array<float,2>{0.964656234f, 0.572778165f},
-std::array<float,2>{0.53322506f, 0.476307094f},
-std::array<float,2>{0.176901013f, 0.940491021f},
-std::array<float,2>{0.0718622655f, 0.26356253f},
-std::array<float,2>{0.675384343f, 0.772958338f},
-std::array<float,2>{0.820743203f, 0.228689969f},
-std::array<float,2>{0.387960643f, 0.665317416f},
-std::array<float,2>{0.300914884f, 0.370090157f},
-std::array<float,2>{0.899512947f, 0.822594941f},
-std::array<float,2>{0.623692691f, 0.153933018f},
-std::array<float,2>{0.243306577f, 0.70505023f},
-std::array<float,2>{0.0481571145f, 0.00071522122f},
-std::array<float,2>{0.712347448f, 0.528378367f},
-std::array<float,2>{0.769345343f, 0.383958876f},
-std::array<float,2>{0.484531194f, 0.877985418f},
-std::array<float,2>{0.408379614f, 0.207925677f},
-std::array<float,2>{0.850456893f, 0.63943857f},
-std::array<float,2>{0.651857793f, 0.307480484f},
-std::array<float,2>{0.118573591f, 0.792401612f},
-std::array<float,2>{0.146432251f, 0.459647089f},
-std::array<float,2>{0.501079738f, 0.996394575f},
-std::array<float,2>{0.981603265f, 0.0991114601f},
-std::array<float,2>{0.368787587f, 0.599376321f},
-std::array<float,2>{0.49818483f, 0.331257999f},
-std::array<float,2>{0.774672449f, 0.865369618f},
-std::array<float,2>{0.707313061f, 0.176228225f},
-std::array<float,2>{0.0610340089f, 0.738957465f},
-std::array<float,2>{0.241802961f, 0.0414606147f},
-std::array<float,2>{0.61022085f, 0.560618341f},
-std::array<float,2>{0.898384392f, 0.424543679f},
-std::array<float,2>{0.311847657f, 0.929288566f},
-std::array<float,2>{0.367092282f, 0.221235067f},
-std::array<float,2>{0.974666119f, 0.656989574f},
-std::array<float,2>{0.510056019f, 0.253951818f},
-std::array<float,2>{0.153632924f, 0.77488929f},
-std::array<float,2>{0.112158947f, 0.481694907f},
-std::array<float,2>{0.644540429f, 0.952657878f},
-std::array<float,2>{0.853743374f, 0.0661880821f},
-std::array<float,2>{0.420467228f, 0.569214344f},
-std::array<float,2>{0.280538768f, 0.382329524f},
-std::array<float,2>{0.934882998f, 0.886674225f},
-std::array<float,2>{0.585024834f, 0.0136936521f},
-std::array<float,2>{0.198390439f, 0.517928839f},
-std::array<float,2>{0.0206140187f, 0.147337303f},
-std::array<float,2>{0.738120615f, 0.7116552f},
-std::array<float,2>{0.78462261f, 0.364114642f},
-std::array<float,2>{0.461063683f, 0.818609774f},
-std::array<float,2>{0.37610659f, 0.103238247f},
-std::array<float,2>{0.817639589f, 0.605619013f},
-std::array<float,2>{0.679957032f, 0.465438843f},
-std::array<float,2>{0.0639343634f, 0.986362159f},
-std::array<float,2>{0.183173448f, 0.298081458f},
-std::array<float,2>{0.544919252f, 0.785767734f},
-std::array<float,2>{0.955974519f, 0.215031892f},
-std::array<float,2>{0.340685785f, 0.630035222f},
-std::array<float,2>{0.432374954f, 0.445945889f},
-std::array<float,2>{0.866784573f, 0.980887771f},
-std::array<float,2>{0.630429149f, 0.121890016f},
-std::array<float,2>{0.0997925326f, 0.618824184f},
-std::array<float,2>{0.12530385f, 0.189625353f},
-std::array<float,2>{0.516069412f, 0.644052386f},
-std::array<float,2>{0.985821307f, 0.29468599f},
-std::array<float,2>{0.345830441f, 0.809509099f},
-std::array<float,2>{0.282469362f, 0.0237255022f},
-std::array<float,2>{0.880384743f, 0.503055394f},
-std::array<float,2>{0.599639773f, 0.3980124f},
-std::array<float,2>{0.222139239f, 0.894908845f},
-std::array<float,2>{0.0439531691f, 0.355852246f},
-std::array<float,2>{0.698752701f, 0.828464031f},
-std::array<float,2>{0.763914406f, 0.139017344f},
-std::array<float,2>{0.479293138f, 0.690914512f},
-std::array<float,2>{0.322052598f, 0.274998903f},
-std::array<float,2>{0.943560958f, 0.759398282f},
-std::array<float,2>{0.551081419f, 0.235887155f},
-std::array<float,2>{0.158220917f, 0.67253834f},
-std::array<float,2>{0.0798779577f, 0.0813334435f},
-std::array<float,2>{0.658751845f, 0.582060039f},
-std::array<float,2>{0.836869836f, 0.498017609f},
-std::array<float,2>{0.401473522f, 0.956083953f},
-std::array<float,2>{0.450449407f, 0.164529473f},
-std::array<float,2>{0.806512415f, 0.726696908f},
-std::array<float,2>{0.733038783f, 0.316822827f},
-std::array<float,2>{0.00262711686f, 0.8574121f},
-std::array<float,2>{0.204504251f, 0.413084269f},
-std::array<float,2>{0.563647032f, 0.912038982f},
-std::array<float,2>{0.910504282f, 0.0521611013f},
-std::array<float,2>{0.260261089f, 0.539341629f},
-std::array<float,2>{0.469768137f, 0.301448077f},
-std::array<float,2>{0.754836679f, 0.781281412f},
-std::array<float,2>{0.694177449f, 0.212637931f},
-std::array<float,2>{0.0319423489f, 0.625821233f},
-std::array<float,2>{0.231700107f, 0.108699329f},
-std::array<float,2>{0.607998431f, 0.603055954f},
-std::array<float,2>{0.890190065f, 0.461319447f},
-std::array<float,2>{0.293391228f, 0.988897383f},
-std::array<float,2>{0.35261333f, 0.141098425f},
-std::array<float,2>{0.997532904f, 0.717927516f},
-std::array<float,2>{0.527071655f, 0.361568242f},
-std::array<float,2>{0.133522421f, 0.814311624f},
-std::array<float,2>{0.101736031f, 0.376898348f},
-std::array<float,2>{0.636545539f, 0.890200734f},
-std::array<float,2>{0.869754732f, 0.0111758672f},
-std::array<float,2>{0.42214486f, 0.521201372f},
-std::array<float,2>{0.252804905f, 0.480209917f},
-std::array<float,2>{0.921266794f, 0.946503222f},
-std::array<float,2>{0.570374906f, 0.0678223073f},
-std::array<float,2>{0.211304113f, 0.565601349f},
-std::array<float,2>{0.00834640302f, 0.224746138f},
-std::array<float,2>{0.726277351f, 0.663371801f},
-std::array<float,2>{0.797792435f, 0.252496541f},
-std::array<float,2>{0.441766351f, 0.777753532f},
-std::array<float,2>{0.397466153f, 0.0454869978f},
-std::array<float,2>{0.829990506f, 0.557137251f},
-std::array<float,2>{0.667980313f, 0.427758723f},
-std::array<float,2>{0.0898127407f, 0.925409853f},
-std::array<float,2>{0.164711058f, 0.334718257f},
-std::array<float,2>{0.559577286f, 0.859855592f},
-std::array<float,2>{0.945491314f, 0.172006428f},
-std::array<float,2>{0.318344921f, 0.737180829f},
-std::array<float,2>{0.410683423f, 0.407419652f},
-std::array<float,2>{0.845328808f, 0.908339679f},
-std::array<float,2>{0.654521406f, 0.0472157449f},
-std::array<float,2>{0.121658042f, 0.544177473f},
-std::array<float,2>{0.142738327f, 0.170970291f},
-std::array<float,2>{0.505150497f, 0.734081089f},
-std::array<float,2>{0.977104247f, 0.316065222f},
-std::array<float,2>{0.373389304f, 0.852257907f},
-std::array<float,2>{0.299944013f, 0.0844556093f},
-std::array<float,2>{0.905680418f, 0.579096019f},
-std::array<float,2>{0.618985057f, 0.496055573f},
-std::array<float,2>{0.246841475f, 0.957720041f},
-std::array<float,2>{0.0513884239f, 0.279277951f},
-std::array<float,2>{0.71777308f, 0.765239656f},
-std::array<float,2>{0.772714436f, 0.241035804f},
-std::array<float,2>{0.48920989f, 0.678741693f},
-std::array<float,2>{0.329497606f, 0.354575098f},
-std::array<float,2>{0.965288877f, 0.834006429f},
-std::array<float,2>{0.537458837f, 0.133195385f},
-std::array<float,2>{0.173424795f, 0.693422973f},
-std::array<float,2>{0.0762019008f, 0.0293836426f},
-std::array<float,2>{0.676723838f, 0.505279124f},
-std::array<float,2>{0.825261235f, 0.392328411f},
-std::array<float,2>{0.386228234f, 0.893823862f},
-std::array<float,2>{0.455384612f, 0.193114609f},
-std::array<float,2>{0.790830851f, 0.647362292f},
-std::array<float,2>{0.747047126f, 0.292285621f},
-std::array<float,2>{0.0293019228f, 0.806742847f},
-std::array<float,2>{0.193352193f, 0.450387537f},
-std::array<float,2>{0.590821326f, 0.976622641f},
-std::array<float,2>{0.929641128f, 0.12081901f},
-std::array<float,2>{0.271551251f, 0.624955058f},
-std::array<float,2>{0.379212052f, 0.327491134f},
-std::array<float,2>{0.814041972f, 0.848489046f},
-std::array<float,2>{0.684634268f, 0.159655362f},
-std::array<float,2>{0.0697432384f, 0.72333312f},
-std::array<float,2>{0.1850622f, 0.0582809336f},
-std::array<float,2>{0.542856455f, 0.531870544f},
-std::array<float,2>{0.959231377f, 0.419143409f},
-std::array<float,2>{0.338615745f, 0.918178141f},
-std::array<float,2>{0.274397135f, 0.247528419f},
-std::array<float,2>{0.931317866f, 0.68274951f},
-std::array<float,2>{0.580623031f, 0.267687589f},
-std::array<float,2>{0.199470297f, 0.754153252f},
-std::array<float,2>{0.0180711281f, 0.491956145f},
-std::array<float,2>{0.740800261f, 0.962856233f},
-std::array<float,2>{0.788741291f, 0.0911177695f},
-std::array<float,2>{0.465104699f, 0.58832401f},
-std::array<float,2>{0.361771554f, 0.405627668f},
-std::array<float,2>{0.970289767f, 0.900900602f},
-std::array<float,2>{0.51463908f, 0.0185848661f},
-std::array<float,2>{0.151470006f, 0.51558125f},
-std::array<float,2>{0.115947552f, 0.132461637f},
-std::array<float,2>{0.641445696f, 0.697262526f},
-std::array<float,2>{0.858917117f, 0.346442133f},
-std::array<float,2>{0.414505661f, 0.836552501f},
-std::array<float,2>{0.493592411f, 0.115063928f},
-std::array<float,2>{0.780668676f, 0.616967916f},
-std::array<float,2>{0.704510927f, 0.44188112f},
-std::array<float,2>{0.0579037331f, 0.971262574f},
-std::array<float,2>{0.237313718f, 0.2836245f},
-std::array<float,2>{0.615714967f, 0.79914856f},
-std::array<float,2>{0.894068241f, 0.196912363f},
-std::array<float,2>{0.306986362f, 0.652182758f},
-std::array<float,2>{0.448958665f, 0.45376876f},
-std::array<float,2>{0.808878362f, 0.995030224f},
-std::array<float,2>{0.727692008f, 0.0968047902f},
-std::array<float,2>{0.0058117439f, 0.594035566f},
-std::array<float,2>{0.207841158f, 0.205116183f},
-std::array<float,2>{0.570047975f, 0.634611547f},
-std::array<float,2>{0.907138944f, 0.309494078f},
-std::array<float,2>{0.265009463f, 0.793096244f},
-std::array<float,2>{0.326175243f, 0.00504031731f},
-std::array<float,2>{0.941056609f, 0.524951577f},
-std::array<float,2>{0.549761295f, 0.388648957f},
-std::array<float,2>{0.160430521f, 0.882558107f},
-std::array<float,2>{0.084498547f, 0.371887356f},
-std::array<float,2>{0.662911654f, 0.826714873f},
-std::array<float,2>{0.84014523f, 0.148579136f},
-std::array<float,2>{0.405465156f, 0.707715869f},
-std::array<float,2>{0.286780417f, 0.257823855f},
-std::array<float,2>{0.878806233f, 0.767780483f},
-std::array<float,2>{0.597494245f, 0.231250688f},
-std::array<float,2>{0.226374477f, 0.671406984f},
-std::array<float,2>{0.042180948f, 0.0762479156f},
-std::array<float,2>{0.701505542f, 0.576255322f},
-std::array<float,2>{0.759471416f, 0.472135991f},
-std::array<float,2>{0.482650995f, 0.942317903f},
-std::array<float,2>{0.434846461f, 0.182199031f},
-std::array<float,2>{0.860188723f, 0.749523342f},
-std::array<float,2>{0.626013815f, 0.338421136f},
-std::array<float,2>{0.096303694f, 0.869087338f},
-std::array<float,2>{0.132417485f, 0.431398571f},
-std::array<float,2>{0.520094693f, 0.933696449f},
-std::array<float,2>{0.990565121f, 0.033566419f},
-std::array<float,2>{0.350522697f, 0.550700426f},
-std::array<float,2>{0.427343696f, 0.271412402f},
-std::array<float,2>{0.871576071f, 0.750152826f},
-std::array<float,2>{0.638592303f, 0.24392584f},
-std::array<float,2>{0.107626013f, 0.684913456f},
-std::array<float,2>{0.138755709f, 0.0863576606f},
-std::array<float,2>{0.52924031f, 0.591251075f},
-std::array<float,2>{0.995612323f, 0.484722614f},
-std::array<float,2>{0.357153147f, 0.967330277f},
-std::array<float,2>{0.290830404f, 0.1630667f},
-std::array<float,2>{0.88542819f, 0.721661747f},
-std::array<float,2>{0.601842701f, 0.321957618f},
-std::array<float,2>{0.227956355f, 0.844434321f},
-std::array<float,2>{0.0356731452f, 0.415880501f},
-std::array<float,2>{0.688989937f, 0.917026937f},
-std::array<float,2>{0.751331806f, 0.0619994141f},
-std::array<float,2>{0.47327438f, 0.53893286f},
-std::array<float,2>{0.312737882f, 0.43795073f},
-std::array<float,2>{0.951339364f, 0.972695887f},
-std::array<float,2>{0.555010438f, 0.111603938f},
-std::array<float,2>{0.171283051f, 0.612047017f},
-std::array<float,2>{0.0909636542f, 0.203105226f},
-std::array<float,2>{0.665341735f, 0.654782951f},
-std::array<float,2>{0.832509577f, 0.287753761f},
-std::array<float,2>{0.391052395f, 0.801409841f},
-std::array<float,2>{0.437919885f, 0.0216493476f},
-std::array<float,2>{0.804481387f, 0.508214951f},
-std::array<float,2>{0.721914709f, 0.401584327f},
-std::array<float,2>{0.0137207853f, 0.906187713f},
-std::array<float,2>{0.215714559f, 0.350762963f},
-std::array<float,2>{0.575488329f, 0.843052506f},
-std::array<float,2>{0.916077197f, 0.127573296f},
-std::array<float,2>{0.257348031f, 0.701966524f},
-std::array<float,2>{0.487806946f, 0.385486037f},
-std::array<float,2>{0.766433716f, 0.876019478f},
-std::array<float,2>{0.712911844f, 0.00277222786f},
-std::array<float,2>{0.0490203425f, 0.529738069f},
-std::array<float,2>{0.24565354f, 0.155090049f},
-std::array<float,2>{0.621261537f, 0.705131233f},
-std::array<float,2>{0.900873542f, 0.368969083f},
-std::array<float,2>{0.303341091f, 0.821170211f},
-std::array<float,2>{0.370154977f, 0.100679919f},
-std::array<float,2>{0.983081758f, 0.60065186f},
-std::array<float,2>{0.503893554f, 0.45766893f},
-std::array<float,2>{0.148019895f, 0.998964667f},
-std::array<float,2>{0.120370455f, 0.3062976f},
-std::array<float,2>{0.649414599f, 0.78963846f},
-std::array<float,2>{0.847677112f, 0.210080668f},
-std::array<float,2>{0.407802284f, 0.637190998f},
-std::array<float,2>{0.268182158f, 0.34079355f},
-std::array<float,2>{0.923536003f, 0.871911228f},
-std::array<float,2>{0.585980296f, 0.184454724f},
-std::array<float,2>{0.189775795f, 0.742961943f},
-std::array<float,2>{0.0243936908f, 0.0369593613f},
-std::array<float,2>{0.744642138f, 0.550835729f},
-std::array<float,2>{0.7959041f, 0.436738551f},
-std::array<float,2>{0.458244383f, 0.93098104f},
-std::array<float,2>{0.389443427f, 0.228321418f},
-std::array<float,2>{0.822947264f, 0.66768986f},
-std::array<float,2>{0.672530651f, 0.264381528f},
-std::array<float,2>{0.0740185007f, 0.771388829f},
-std::array<float,2>{0.179473519f, 0.473121315f},
-std::array<float,2>{0.532164633f, 0.939307511f},
-std::array<float,2>{0.96233654f, 0.0739385635f},
-std::array<float,2>{0.332966119f, 0.571666479f},
-std::array<float,2>{0.463380367f, 0.367047906f},
-std::array<float,2>{0.781770408f, 0.816779792f},
-std::array<float,2>{0.734531939f, 0.144998938f},
-std::array<float,2>{0.0224589389f, 0.714551091f},
-std::array<float,2>{0.19584246f, 0.0118492031f},
-std::array<float,2>{0.582664609f, 0.51625067f},
-std::array<float,2>{0.936159372f, 0.378993988f},
-std::array<float,2>{0.278000385f, 0.882902205f},
-std::array<float,2>{0.342188388f, 0.217908353f},
-std::array<float,2>{0.953532577f, 0.632659495f},
-std::array<float,2>{0.546735287f, 0.299444377f},
-std::array<float,2>{0.180211008f, 0.787323952f},
-std::array<float,2>{0.0649461001f, 0.468053609f},
-std::array<float,2>{0.682108223f, 0.985919118f},
-std::array<float,2>{0.820087314f, 0.104286298f},
-std::array<float,2>{0.377019793f, 0.608044982f},
-std::array<float,2>{0.309400827f, 0.423028052f},
-std::array<float,2>{0.894788682f, 0.926059723f},
-std::array<float,2>{0.612830341f, 0.0402386263f},
-std::array<float,2>{0.238547936f, 0.560477614f},
-std::array<float,2>{0.0600051917f, 0.178419381f},
-std::array<float,2>{0.710546196f, 0.742102265f},
-std::array<float,2>{0.776195228f, 0.328574121f},
-std::array<float,2>{0.496890783f, 0.864687741f},
-std::array<float,2>{0.419731796f, 0.0636931881f},
-std::array<float,2>{0.852163315f, 0.567933917f},
-std::array<float,2>{0.647257447f, 0.48279655f},
-std::array<float,2>{0.110296346f, 0.951029599f},
-std::array<float,2>{0.155975774f, 0.255878031f},
-std::array<float,2>{0.50793153f, 0.776063561f},
-std::array<float,2>{0.972948313f, 0.22061117f},
-std::array<float,2>{0.364601314f, 0.658546329f},
-std::array<float,2>{0.398667634f, 0.499902517f},
-std::array<float,2>{0.839166105f, 0.954680979f},
-std::array<float,2>{0.656943083f, 0.0786407292f},
-std::array<float,2>{0.0815344825f, 0.584405482f},
-std::array<float,2>{0.156678841f, 0.238258958f},
-std::array<float,2>{0.552794337f, 0.675110579f},
-std::array<float,2>{0.942880809f, 0.27623558f},
-std::array<float,2>{0.322890133f, 0.760972857f},
-std::array<float,2>{0.258947015f, 0.0531274416f},
-std::array<float,2>{0.913447261f, 0.541138053f},
-std::array<float,2>{0.56565696f, 0.411438107f},
-std::array<float,2>{0.206029773f, 0.914033175f},
-std::array<float,2>{0.00172162382f, 0.319358587f},
-std::array<float,2>{0.732254565f, 0.858310878f},
-std::array<float,2>{0.807190895f, 0.167784661f},
-std::array<float,2>{0.4517349f, 0.728602529f},
-std::array<float,2>{0.345574021f, 0.295141101f},
-std::array<float,2>{0.986425996f, 0.8123101f},
-std::array<float,2>{0.519093812f, 0.187880442f},
-std::array<float,2>{0.127369627f, 0.642485559f},
-std::array<float,2>{0.0978237838f, 0.123673916f},
-std::array<float,2>{0.631933153f, 0.620706975f},
-std::array<float,2>{0.864022076f, 0.447348744f},
-std::array<float,2>{0.430285394f, 0.983072639f},
-std::array<float,2>{0.477776378f, 0.137970045f},
-std::array<float,2>{0.763418555f, 0.688945055f},
-std::array<float,2>{0.69661516f, 0.357710212f},
-std::array<float,2>{0.0456028618f, 0.830192685f},
-std::array<float,2>{0.220390201f, 0.395076871f},
-std::array<float,2>{0.599536002f, 0.898022771f},
-std::array<float,2>{0.88133955f, 0.0267813262f},
-std::array<float,2>{0.284711957f, 0.501030385f},
-std::array<float,2>{0.483248085f, 0.260964155f},
-std::array<float,2>{0.758844614f, 0.766397536f},
-std::array<float,2>{0.702131927f, 0.233313456f},
-std::array<float,2>{0.0426362604f, 0.669832885f},
-std::array<float,2>{0.225722909f, 0.075502187f},
-std::array<float,2>{0.59668082f, 0.575660169f},
-std::array<float,2>{0.878035784f, 0.468773603f},
-std::array<float,2>{0.286275744f, 0.943602443f},
-std::array<float,2>{0.349998891f, 0.180646792f},
-std::array<float,2>{0.990962088f, 0.746883512f},
-std::array<float,2>{0.519546628f, 0.336200655f},
-std::array<float,2>{0.132085592f, 0.870507658f},
-std::array<float,2>{0.0961291939f, 0.432647735f},
-std::array<float,2>{0.626746893f, 0.935841024f},
-std::array<float,2>{0.859542966f, 0.0331040956f},
-std::array<float,2>{0.435471207f, 0.547324479f},
-std::array<float,2>{0.265387863f, 0.455472589f},
-std::array<float,2>{0.906662107f, 0.993662834f},
-std::array<float,2>{0.569601297f, 0.0944421589f},
-std::array<float,2>{0.207238749f, 0.597079396f},
-std::array<float,2>{0.00504160579f, 0.203315571f},
-std::array<float,2>{0.728294015f, 0.636021554f},
-std::array<float,2>{0.809119642f, 0.311534822f},
-std::array<float,2>{0.448682427f, 0.795778751f},
-std::array<float,2>{0.405987829f, 0.00699941488f},
-std::array<float,2>{0.840717494f, 0.526580155f},
-std::array<float,2>{0.662332177f, 0.390289813f},
-std::array<float,2>{0.084370546f, 0.879707515f},
-std::array<float,2>{0.160811707f, 0.37352246f},
-std::array<float,2>{0.548977852f, 0.826059639f},
-std::array<float,2>{0.940828919f, 0.15111661f},
-std::array<float,2>{0.326663017f, 0.709432781f},
-std::array<float,2>{0.414598554f, 0.404230058f},
-std::array<float,2>{0.858557701f, 0.899005473f},
-std::array<float,2>{0.640734851f, 0.0170991998f},
-std::array<float,2>{0.115492061f, 0.513648629f},
-std::array<float,2>{0.151906461f, 0.13040255f},
-std::array<float,2>{0.514035046f, 0.697446525f},
-std::array<float,2>{0.970189035f, 0.344617903f},
-std::array<float,2>{0.362124175f, 0.83892715f},
-std::array<float,2>{0.307527989f, 0.116750345f},
-std::array<float,2>{0.89401412f, 0.614141524f},
-std::array<float,2>{0.615917563f, 0.444102496f},
-std::array<float,2>{0.23798193f, 0.970430374f},
-std::array<float,2>{0.058311902f, 0.283017546f},
-std::array<float,2>{0.704871356f, 0.797633708f},
-std::array<float,2>{0.780819654f, 0.198375627f},
-std::array<float,2>{0.494001865f, 0.649805963f},
-std::array<float,2>{0.33802852f, 0.324913174f},
-std::array<float,2>{0.959731877f, 0.850934803f},
-std::array<float,2>{0.542301238f, 0.157839045f},
-std::array<float,2>{0.184596434f, 0.725443184f},
-std::array<float,2>{0.0699701011f, 0.0565015897f},
-std::array<float,2>{0.685174227f, 0.533957481f},
-std::array<float,2>{0.813943326f, 0.420498818f},
-std::array<float,2>{0.37973547f, 0.921527982f},
-std::array<float,2>{0.465475917f, 0.248782679f},
-std::array<float,2>{0.788107753f, 0.680565238f},
-std::array<float,2>{0.740691245f, 0.267375052f},
-std::array<float,2>{0.018000612f, 0.756324291f},
-std::array<float,2>{0.200195163f, 0.490065694f},
-std::array<float,2>{0.5803262f, 0.963875949f},
-std::array<float,2>{0.930694938f, 0.0933386981f},
-std::array<float,2>{0.273918986f, 0.586908937f},
-std::array<float,2>{0.386533111f, 0.352716893f},
-std::array<float,2>{0.826059282f, 0.833203137f},
-std::array<float,2>{0.675946414f, 0.135282502f},
-std::array<float,2>{0.0771448389f, 0.693287909f},
-std::array<float,2>{0.17324163f, 0.0292214938f},
-std::array<float,2>{0.537731707f, 0.506361067f},
-std::array<float,2>{0.965795755f, 0.394010186f},
-std::array<float,2>{0.329606175f, 0.892032087f},
-std::array<float,2>{0.272013873f, 0.193609446f},
-std::array<float,2>{0.928785861f, 0.646193027f},
-std::array<float,2>{0.591455638f, 0.290804476f},
-std::array<float,2>{0.19281441f, 0.805917144f},
-std::array<float,2>{0.0299044941f, 0.452110857f},
-std::array<float,2>{0.746318519f, 0.979572415f},
-std::array<float,2>{0.790321052f, 0.118987337f},
-std::array<float,2>{0.455725104f, 0.622990668f},
-std::array<float,2>{0.373668522f, 0.40975073f},
-std::array<float,2>{0.976762056f, 0.907297254f},
-std::array<float,2>{0.505419075f, 0.0506375693f},
-std::array<float,2>{0.143321991f, 0.546025336f},
-std::array<float,2>{0.121230602f, 0.168150038f},
-std::array<float,2>{0.654938817f, 0.732390225f},
-std::array<float,2>{0.844898045f, 0.313017368f},
-std::array<float,2>{0.410376757f, 0.854145527f},
-std::array<float,2>{0.488290042f, 0.0826660693f},
-std::array<float,2>{0.772977769f, 0.580597758f},
-std::array<float,2>{0.716819167f, 0.492265612f},
-std::array<float,2>{0.0510742292f, 0.960543275f},
-std::array<float,2>{0.24653922f, 0.279793948f},
-std::array<float,2>{0.618431568f, 0.761836588f},
-std::array<float,2>{0.906020522f, 0.238303989f},
-std::array<float,2>{0.300591886f, 0.677100778f},
-std::array<float,2>{0.442040384f, 0.476872146f},
-std::array<float,2>{0.797219872f, 0.948268771f},
-std::array<float,2>{0.725707412f, 0.0693191141f},
-std::array<float,2>{0.00827587117f, 0.564180613f},
-std::array<float,2>{0.211838141f, 0.223193765f},
-std::array<float,2>{0.570851803f, 0.661934853f},
-std::array<float,2>{0.921476483f, 0.250068784f},
-std::array<float,2>{0.252373874f, 0.781102479f},
-std::array<float,2>{0.317801297f, 0.0442519188f},
-std::array<float,2>{0.946209431f, 0.555413544f},
-std::array<float,2>{0.560165703f, 0.427078485f},
-std::array<float,2>{0.164167866f, 0.922914207f},
-std::array<float,2>{0.0891851708f, 0.333863169f},
-std::array<float,2>{0.668467045f, 0.862064064f},
-std::array<float,2>{0.829442143f, 0.17417711f},
-std::array<float,2>{0.398210973f, 0.73588419f},
-std::array<float,2>{0.293797046f, 0.303163469f},
-std::array<float,2>{0.889655113f, 0.783756614f},
-std::array<float,2>{0.607685268f, 0.21413219f},
-std::array<float,2>{0.2323035f, 0.62764734f},
-std::array<float,2>{0.0317263417f, 0.106639579f},
-std::array<float,2>{0.69376564f, 0.604732156f},
-std::array<float,2>{0.754022121f, 0.462984443f},
-std::array<float,2>{0.470398962f, 0.991388917f},
-std::array<float,2>{0.422548026f, 0.143350244f},
-std::array<float,2>{0.869386613f, 0.716533363f},
-std::array<float,2>{0.636196077f, 0.360181838f},
-std::array<float,2>{0.10230983f, 0.815268874f},
-std::array<float,2>{0.13282162f, 0.377900779f},
-std::array<float,2>{0.526441157f, 0.887735486f},
-std::array<float,2>{0.997639954f, 0.00926903728f},
-std::array<float,2>{0.353290141f, 0.521957219f},
-std::array<float,2>{0.42993167f, 0.293986678f},
-std::array<float,2>{0.863640547f, 0.808855176f},
-std::array<float,2>{0.632757366f, 0.190053299f},
-std::array<float,2>{0.0982671902f, 0.643939793f},
-std::array<float,2>{0.127913654f, 0.121548086f},
-std::array<float,2>{0.518955231f, 0.618627965f},
-std::array<float,2>{0.987299681f, 0.445733488f},
-std::array<float,2>{0.344942093f, 0.981020212f},
-std::array<float,2>{0.284363627f, 0.139428243f},
-std::array<float,2>{0.881504953f, 0.691113234f},
-std::array<float,2>{0.598989785f, 0.356264412f},
-std::array<float,2>{0.219792843f, 0.828850448f},
-std::array<float,2>{0.0453453101f, 0.39752093f},
-std::array<float,2>{0.697113216f, 0.89533335f},
-std::array<float,2>{0.763008475f, 0.0242813472f},
-std::array<float,2>{0.478102475f, 0.503772795f},
-std::array<float,2>{0.322289199f, 0.497484833f},
-std::array<float,2>{0.942607164f, 0.956591904f},
-std::array<float,2>{0.553584039f, 0.0819015205f},
-std::array<float,2>{0.156747013f, 0.582922459f},
-std::array<float,2>{0.081832014f, 0.235595182f},
-std::array<float,2>{0.65671736f, 0.671961188f},
-std::array<float,2>{0.839539051f, 0.27479282f},
-std::array<float,2>{0.399043262f, 0.7589854f},
-std::array<float,2>{0.451402009f, 0.0525977165f},
-std::array<float,2>{0.806685209f, 0.539863884f},
-std::array<float,2>{0.731673062f, 0.412269354f},
-std::array<float,2>{0.00137202977f, 0.911151111f},
-std::array<float,2>{0.205153346f, 0.317034602f},
-std::array<float,2>{0.566231966f, 0.85681057f},
-std::array<float,2>{0.913817525f, 0.164985552f},
-std::array<float,2>{0.259497851f, 0.727479458f},
-std::array<float,2>{0.496156275f, 0.423846632f},
-std::array<float,2>{0.775867641f, 0.929086506f},
-std::array<float,2>{0.71000272f, 0.0418664925f},
-std::array<float,2>{0.0605048612f, 0.561380625f},
-std::array<float,2>{0.239223421f, 0.176557571f},
-std::array<float,2>{0.612641513f, 0.738628447f},
-std::array<float,2>{0.895415127f, 0.331854194f},
-std::array<float,2>{0.30878976f, 0.866182923f},
-std::array<float,2>{0.365135401f, 0.0656085759f},
-std::array<float,2>{0.973529339f, 0.568526924f},
-std::array<float,2>{0.508537531f, 0.482389271f},
-std::array<float,2>{0.155510634f, 0.952483654f},
-std::array<float,2>{0.109809645f, 0.254826367f},
-std::array<float,2>{0.64682591f, 0.775209188f},
-std::array<float,2>{0.851578653f, 0.220809817f},
-std::array<float,2>{0.4192895f, 0.656650364f},
-std::array<float,2>{0.277731001f, 0.36352402f},
-std::array<float,2>{0.935753763f, 0.819084108f},
-std::array<float,2>{0.582392633f, 0.146609172f},
-std::array<float,2>{0.195716932f, 0.711298764f},
-std::array<float,2>{0.0216216799f, 0.0142189683f},
-std::array<float,2>{0.735086024f, 0.518305659f},
-std::array<float,2>{0.781521201f, 0.381967366f},
-std::array<float,2>{0.462935835f, 0.885979116f},
-std::array<float,2>{0.377787352f, 0.215575323f},
-std::array<float,2>{0.819702506f, 0.630602002f},
-std::array<float,2>{0.682254076f, 0.298445255f},
-std::array<float,2>{0.0647764802f, 0.785310984f},
-std::array<float,2>{0.179789409f, 0.464900523f},
-std::array<float,2>{0.546324372f, 0.987087905f},
-std::array<float,2>{0.953669012f, 0.102951407f},
-std::array<float,2>{0.342404127f, 0.605970502f},
-std::array<float,2>{0.458790451f, 0.342200994f},
-std::array<float,2>{0.796661854f, 0.87315321f},
-std::array<float,2>{0.744485617f, 0.186492652f},
-std::array<float,2>{0.0234864242f, 0.745499849f},
-std::array<float,2>{0.190391421f, 0.0374716856f},
-std::array<float,2>{0.586890101f, 0.553578377f},
-std::array<float,2>{0.923288405f, 0.43497926f},
-std::array<float,2>{0.267760903f, 0.932838321f},
-std::array<float,2>{0.332056999f, 0.229034483f},
-std::array<float,2>{0.962758243f, 0.665730178f},
-std::array<float,2>{0.531350732f, 0.262953222f},
-std::array<float,2>{0.17886728f, 0.772521734f},
-std::array<float,2>{0.0734000653f, 0.475720704f},
-std::array<float,2>{0.672197878f, 0.940986872f},
-std::array<float,2>{0.822647154f, 0.0716675892f},
-std::array<float,2>{0.388717502f, 0.572268963f},
-std::array<float,2>{0.302969664f, 0.384746939f},
-std::array<float,2>{0.901342094f, 0.878624201f},
-std::array<float,2>{0.621808529f, 0.000369882386f},
-std::array<float,2>{0.245164245f, 0.529086232f},
-std::array<float,2>{0.0494393334f, 0.153674945f},
-std::array<float,2>{0.71383822f, 0.704406083f},
-std::array<float,2>{0.766033053f, 0.369222522f},
-std::array<float,2>{0.487337977f, 0.823083937f},
-std::array<float,2>{0.407280445f, 0.0995521992f},
-std::array<float,2>{0.848309278f, 0.598745048f},
-std::array<float,2>{0.650062919f, 0.459292889f},
-std::array<float,2>{0.12077181f, 0.996892273f},
-std::array<float,2>{0.147655204f, 0.307031751f},
-std::array<float,2>{0.503115118f, 0.792861104f},
-std::array<float,2>{0.982879639f, 0.207220033f},
-std::array<float,2>{0.371082753f, 0.63869226f},
-std::array<float,2>{0.391551346f, 0.441153556f},
-std::array<float,2>{0.832752407f, 0.976218164f},
-std::array<float,2>{0.665713608f, 0.109506533f},
-std::array<float,2>{0.0917378962f, 0.609636366f},
-std::array<float,2>{0.171629205f, 0.201065913f},
-std::array<float,2>{0.555593848f, 0.65288955f},
-std::array<float,2>{0.951722205f, 0.287027717f},
-std::array<float,2>{0.313033253f, 0.802899063f},
-std::array<float,2>{0.257096529f, 0.0197806377f},
-std::array<float,2>{0.916728854f, 0.511549115f},
-std::array<float,2>{0.575742424f, 0.39863953f},
-std::array<float,2>{0.215316266f, 0.902429521f},
-std::array<float,2>{0.0143762473f, 0.348761827f},
-std::array<float,2>{0.722591519f, 0.841214776f},
-std::array<float,2>{0.803830981f, 0.126510203f},
-std::array<float,2>{0.438398808f, 0.700987399f},
-std::array<float,2>{0.356751144f, 0.272762775f},
-std::array<float,2>{0.995318532f, 0.753245533f},
-std::array<float,2>{0.52841419f, 0.245729268f},
-std::array<float,2>{0.139609203f, 0.686170578f},
-std::array<float,2>{0.1079771f, 0.0887481943f},
-std::array<float,2>{0.637930274f, 0.592713237f},
-std::array<float,2>{0.871935785f, 0.486441672f},
-std::array<float,2>{0.426836908f, 0.965198278f},
-std::array<float,2>{0.473041832f, 0.16035375f},
-std::array<float,2>{0.751812279f, 0.719721198f},
-std::array<float,2>{0.688500345f, 0.323603719f},
-std::array<float,2>{0.0352704525f, 0.847407103f},
-std::array<float,2>{0.22831732f, 0.417682201f},
-std::array<float,2>{0.602366209f, 0.915908754f},
-std::array<float,2>{0.884822965f, 0.05951171f},
-std::array<float,2>{0.290049762f, 0.536873043f},
-std::array<float,2>{0.446299851f, 0.308820546f},
-std::array<float,2>{0.811829209f, 0.793800175f},
-std::array<float,2>{0.729001701f, 0.205810353f},
-std::array<float,2>{0.00717256544f, 0.634210765f},
-std::array<float,2>{0.210785538f, 0.0976416022f},
-std::array<float,2>{0.567675471f, 0.594418824f},
-std::array<float,2>{0.908475161f, 0.453197956f},
-std::array<float,2>{0.263106585f, 0.994469404f},
-std::array<float,2>{0.325198412f, 0.148938343f},
-std::array<float,2>{0.938596368f, 0.707449377f},
-std::array<float,2>{0.547165394f, 0.371535689f},
-std::array<float,2>{0.164020076f, 0.826541722f},
-std::array<float,2>{0.0827374607f, 0.387921453f},
-std::array<float,2>{0.661616266f, 0.882245243f},
-std::array<float,2>{0.842294753f, 0.00585456239f},
-std::array<float,2>{0.403273076f, 0.524817586f},
-std::array<float,2>{0.288862109f, 0.472436547f},
-std::array<float,2>{0.875157952f, 0.941614032f},
-std::array<float,2>{0.59431535f, 0.077008009f},
-std::array<float,2>{0.224105537f, 0.577070832f},
-std::array<float,2>{0.0394151993f, 0.230807006f},
-std::array<float,2>{0.700464249f, 0.671114922f},
-std::array<float,2>{0.761283636f, 0.258438885f},
-std::array<float,2>{0.481321275f, 0.768140018f},
-std::array<float,2>{0.435981244f, 0.0341571346f},
-std::array<float,2>{0.863176763f, 0.549909234f},
-std::array<float,2>{0.628624678f, 0.430913568f},
-std::array<float,2>{0.0948130488f, 0.93427676f},
-std::array<float,2>{0.13005805f, 0.338350177f},
-std::array<float,2>{0.522270918f, 0.868652165f},
-std::array<float,2>{0.98833102f, 0.181707099f},
-std::array<float,2>{0.349090546f, 0.749432385f},
-std::array<float,2>{0.382284909f, 0.419811785f},
-std::array<float,2>{0.815946162f, 0.918751419f},
-std::array<float,2>{0.686154127f, 0.0580276735f},
-std::array<float,2>{0.0670612529f, 0.531552255f},
-std::array<float,2>{0.186090127f, 0.159779534f},
-std::array<float,2>{0.53906858f, 0.722719252f},
-std::array<float,2>{0.958438158f, 0.328041822f},
-std::array<float,2>{0.336597741f, 0.847977757f},
-std::array<float,2>{0.27684015f, 0.0915612057f},
-std::array<float,2>{0.932308137f, 0.588644981f},
-std::array<float,2>{0.578410447f, 0.491417587f},
-std::array<float,2>{0.201836064f, 0.961937189f},
-std::array<float,2>{0.0165906604f, 0.268402934f},
-std::array<float,2>{0.740203381f, 0.754864454f},
-std::array<float,2>{0.78678745f, 0.247685432f},
-std::array<float,2>{0.468573272f, 0.683355093f},
-std::array<float,2>{0.360061854f, 0.346136063f},
-std::array<float,2>{0.972373664f, 0.836348414f},
-std::array<float,2>{0.512394428f, 0.132011637f},
-std::array<float,2>{0.150323436f, 0.696342707f},
-std::array<float,2>{0.114713646f, 0.0191133246f},
-std::array<float,2>{0.644143403f, 0.51513201f},
-std::array<float,2>{0.856231511f, 0.405930638f},
-std::array<float,2>{0.416277647f, 0.900545835f},
-std::array<float,2>{0.495918125f, 0.196310133f},
-std::array<float,2>{0.778934002f, 0.651505291f},
-std::array<float,2>{0.705331206f, 0.284013301f},
-std::array<float,2>{0.0557882302f, 0.799640954f},
-std::array<float,2>{0.234925136f, 0.442182839f},
-std::array<float,2>{0.613951743f, 0.970819712f},
-std::array<float,2>{0.891890943f, 0.114351101f},
-std::array<float,2>{0.305280834f, 0.616475821f},
-std::array<float,2>{0.41322431f, 0.315518022f},
-std::array<float,2>{0.845948875f, 0.851747155f},
-std::array<float,2>{0.653630376f, 0.17165783f},
-std::array<float,2>{0.12351463f, 0.73357743f},
-std::array<float,2>{0.141672894f, 0.0476427078f},
-std::array<float,2>{0.506161034f, 0.54464668f},
-std::array<float,2>{0.979663193f, 0.408133298f},
-std::array<float,2>{0.371246666f, 0.909049332f},
-std::array<float,2>{0.298557073f, 0.240692511f},
-std::array<float,2>{0.903651357f, 0.679266214f},
-std::array<float,2>{0.620228589f, 0.278721064f},
-std::array<float,2>{0.248239994f, 0.764663935f},
-std::array<float,2>{0.0536733009f, 0.495153487f},
-std::array<float,2>{0.715202808f, 0.957421005f},
-std::array<float,2>{0.769745231f, 0.0847013816f},
-std::array<float,2>{0.490356445f, 0.578127682f},
-std::array<float,2>{0.331474453f, 0.391732275f},
-std::array<float,2>{0.967319548f, 0.894387543f},
-std::array<float,2>{0.535475016f, 0.030206373f},
-std::array<float,2>{0.175501183f, 0.505708933f},
-std::array<float,2>{0.0744687244f, 0.133380502f},
-std::array<float,2>{0.678381681f, 0.693867445f},
-std::array<float,2>{0.826233268f, 0.355418384f},
-std::array<float,2>{0.383596003f, 0.834590673f},
-std::array<float,2>{0.453446984f, 0.120174222f},
-std::array<float,2>{0.792939365f, 0.624074221f},
-std::array<float,2>{0.748691022f, 0.450887144f},
-std::array<float,2>{0.0281785969f, 0.977511942f},
-std::array<float,2>{0.193932071f, 0.292686135f},
-std::array<float,2>{0.592544079f, 0.807334304f},
-std::array<float,2>{0.925988555f, 0.192558601f},
-std::array<float,2>{0.27120778f, 0.646558762f},
-std::array<float,2>{0.472064823f, 0.461434245f},
-std::array<float,2>{0.75706321f, 0.988452017f},
-std::array<float,2>{0.692662418f, 0.108931817f},
-std::array<float,2>{0.0349920131f, 0.602815032f},
-std::array<float,2>{0.233698756f, 0.212004155f},
-std::array<float,2>{0.605605185f, 0.625465393f},
-std::array<float,2>{0.887383401f, 0.301186353f},
-std::array<float,2>{0.296809435f, 0.781946421f},
-std::array<float,2>{0.354831874f, 0.0115709202f},
-std::array<float,2>{0.99809587f, 0.520741999f},
-std::array<float,2>{0.525269449f, 0.376393139f},
-std::array<float,2>{0.136640221f, 0.8899225f},
-std::array<float,2>{0.1039185f, 0.361887991f},
-std::array<float,2>{0.63437134f, 0.813913226f},
-std::array<float,2>{0.867233992f, 0.141419739f},
-std::array<float,2>{0.425354809f, 0.71862793f},
-std::array<float,2>{0.250026941f, 0.252170473f},
-std::array<float,2>{0.918336332f, 0.778305471f},
-std::array<float,2>{0.573941827f, 0.225335866f},
-std::array<float,2>{0.214623392f, 0.663907886f},
-std::array<float,2>{0.0110856984f, 0.0680549368f},
-std::array<float,2>{0.72285229f, 0.566332519f},
-std::array<float,2>{0.798932612f, 0.479912817f},
-std::array<float,2>{0.443578392f, 0.946833789f},
-std::array<float,2>{0.39497143f, 0.17274259f},
-std::array<float,2>{0.831179857f, 0.736573756f},
-std::array<float,2>{0.670962274f, 0.334271014f},
-std::array<float,2>{0.0877064317f, 0.860144317f},
-std::array<float,2>{0.167765781f, 0.428314984f},
-std::array<float,2>{0.562385917f, 0.92503792f},
-std::array<float,2>{0.948867023f, 0.0452505611f},
-std::array<float,2>{0.318540931f, 0.557086825f},
-std::array<float,2>{0.401922554f, 0.275858372f},
-std::array<float,2>{0.836314261f, 0.761632621f},
-std::array<float,2>{0.658570707f, 0.237503201f},
-std::array<float,2>{0.079164736f, 0.675565183f},
-std::array<float,2>{0.159083411f, 0.0782158673f},
-std::array<float,2>{0.551298857f, 0.584600925f},
-std::array<float,2>{0.94398421f, 0.499034166f},
-std::array<float,2>{0.321520239f, 0.954128921f},
-std::array<float,2>{0.260112703f, 0.167039841f},
-std::array<float,2>{0.910802782f, 0.729170144f},
-std::array<float,2>{0.564118922f, 0.320209771f},
-std::array<float,2>{0.204942897f, 0.857681692f},
-std::array<float,2>{0.00235411269f, 0.411940873f},
-std::array<float,2>{0.732876778f, 0.913409829f},
-std::array<float,2>{0.805773377f, 0.053452719f},
-std::array<float,2>{0.450721949f, 0.541640937f},
-std::array<float,2>{0.346362293f, 0.447770655f},
-std::array<float,2>{0.985940278f, 0.982479215f},
-std::array<float,2>{0.516290784f, 0.123217061f},
-std::array<float,2>{0.125520378f, 0.620368958f},
-std::array<float,2>{0.10057041f, 0.188298792f},
-std::array<float,2>{0.630273581f, 0.642031789f},
-std::array<float,2>{0.866402209f, 0.295530468f},
-std::array<float,2>{0.431930691f, 0.81199795f},
-std::array<float,2>{0.478632659f, 0.0271733813f},
-std::array<float,2>{0.764591634f, 0.501533568f},
-std::array<float,2>{0.698300302f, 0.394575328f},
-std::array<float,2>{0.0444788821f, 0.897908866f},
-std::array<float,2>{0.222636282f, 0.358269215f},
-std::array<float,2>{0.600151718f, 0.830596149f},
-std::array<float,2>{0.880020916f, 0.138290226f},
-std::array<float,2>{0.28292045f, 0.6892187f},
-std::array<float,2>{0.461788118f, 0.379768401f},
-std::array<float,2>{0.785066485f, 0.883455813f},
-std::array<float,2>{0.73755759f, 0.0125776334f},
-std::array<float,2>{0.021294998f, 0.515873313f},
-std::array<float,2>{0.199206531f, 0.145185143f},
-std::array<float,2>{0.585828602f, 0.7141608f},
-std::array<float,2>{0.935061038f, 0.366513103f},
-std::array<float,2>{0.280891418f, 0.81729126f},
-std::array<float,2>{0.340203613f, 0.103848316f},
-std::array<float,2>{0.955481648f, 0.607889771f},
-std::array<float,2>{0.544251561f, 0.468337655f},
-std::array<float,2>{0.182744637f, 0.985551238f},
-std::array<float,2>{0.0639792532f, 0.29914096f},
-std::array<float,2>{0.680222511f, 0.787629247f},
-std::array<float,2>{0.817959607f, 0.218664452f},
-std::array<float,2>{0.376644582f, 0.632056713f},
-std::array<float,2>{0.312054664f, 0.328652114f},
-std::array<float,2>{0.89788121f, 0.865062714f},
-std::array<float,2>{0.609837115f, 0.178037673f},
-std::array<float,2>{0.241492525f, 0.741588712f},
-std::array<float,2>{0.0613831952f, 0.0407594368f},
-std::array<float,2>{0.707994819f, 0.559995353f},
-std::array<float,2>{0.77508992f, 0.423571974f},
-std::array<float,2>{0.498839676f, 0.926322281f},
-std::array<float,2>{0.420318693f, 0.220048741f},
-std::array<float,2>{0.854463458f, 0.659130096f},
-std::array<float,2>{0.645217061f, 0.256831944f},
-std::array<float,2>{0.111783743f, 0.775540173f},
-std::array<float,2>{0.15392302f, 0.483130068f},
-std::array<float,2>{0.51049602f, 0.950563371f},
-std::array<float,2>{0.975570142f, 0.0639783815f},
-std::array<float,2>{0.36621958f, 0.567791641f},
-std::array<float,2>{0.485241354f, 0.368368924f},
-std::array<float,2>{0.768564701f, 0.820720792f},
-std::array<float,2>{0.71288228f, 0.154599652f},
-std::array<float,2>{0.0485152192f, 0.706046939f},
-std::array<float,2>{0.243943617f, 0.00206459942f},
-std::array<float,2>{0.623191178f, 0.530159771f},
-std::array<float,2>{0.900238097f, 0.385228634f},
-std::array<float,2>{0.301582128f, 0.876950741f},
-std::array<float,2>{0.368331432f, 0.210852221f},
-std::array<float,2>{0.981938541f, 0.637290239f},
-std::array<float,2>{0.501731813f, 0.306001157f},
-std::array<float,2>{0.14554508f, 0.789310932f},
-std::array<float,2>{0.119013481f, 0.457353413f},
-std::array<float,2>{0.651627421f, 0.998093903f},
-std::array<float,2>{0.850006819f, 0.101136699f},
-std::array<float,2>{0.409028202f, 0.60119313f},
-std::array<float,2>{0.265940607f, 0.437062025f},
-std::array<float,2>{0.924562693f, 0.931629241f},
-std::array<float,2>{0.589732945f, 0.0362798721f},
-std::array<float,2>{0.188338906f, 0.551649809f},
-std::array<float,2>{0.0272005387f, 0.183931723f},
-std::array<float,2>{0.743633926f, 0.742352247f},
-std::array<float,2>{0.79485029f, 0.340227783f},
-std::array<float,2>{0.459765553f, 0.871493638f},
-std::array<float,2>{0.388288647f, 0.0733116195f},
-std::array<float,2>{0.821229458f, 0.5718804f},
-std::array<float,2>{0.675254285f, 0.473313332f},
-std::array<float,2>{0.0716849491f, 0.938763797f},
-std::array<float,2>{0.177293003f, 0.264125615f},
-std::array<float,2>{0.533896804f, 0.770720661f},
-std::array<float,2>{0.963978767f, 0.227650523f},
-std::array<float,2>{0.335591704f, 0.667114854f},
-std::array<float,2>{0.429338872f, 0.485084265f},
-std::array<float,2>{0.874454677f, 0.966906548f},
-std::array<float,2>{0.638748467f, 0.0864350274f},
-std::array<float,2>{0.105854496f, 0.591698766f},
-std::array<float,2>{0.138612345f, 0.24344255f},
-std::array<float,2>{0.530130208f, 0.685066164f},
-std::array<float,2>{0.992327869f, 0.270950735f},
-std::array<float,2>{0.357439637f, 0.750653625f},
-std::array<float,2>{0.292462468f, 0.0620830208f},
-std::array<float,2>{0.883936524f, 0.538542867f},
-std::array<float,2>{0.603623033f, 0.415482372f},
-std::array<float,2>{0.229477629f, 0.91771102f},
-std::array<float,2>{0.0379820541f, 0.321712047f},
-std::array<float,2>{0.690229475f, 0.84412539f},
-std::array<float,2>{0.752032042f, 0.162395835f},
-std::array<float,2>{0.475643069f, 0.720949829f},
-std::array<float,2>{0.315612316f, 0.287556082f},
-std::array<float,2>{0.949865222f, 0.801142693f},
-std::array<float,2>{0.55844444f, 0.202216431f},
-std::array<float,2>{0.168255702f, 0.655182362f},
-std::array<float,2>{0.0920245126f, 0.112091616f},
-std::array<float,2>{0.666860223f, 0.611491621f},
-std::array<float,2>{0.834026337f, 0.438450605f},
-std::array<float,2>{0.392745614f, 0.973374188f},
-std::array<float,2>{0.44080472f, 0.127014205f},
-std::array<float,2>{0.802454114f, 0.701240063f},
-std::array<float,2>{0.720157504f, 0.351200551f},
-std::array<float,2>{0.0126005737f, 0.843398869f},
-std::array<float,2>{0.217453972f, 0.402244002f},
-std::array<float,2>{0.576407433f, 0.905579865f},
-std::array<float,2>{0.914786398f, 0.0219997168f},
-std::array<float,2>{0.254483044f, 0.508653998f},
-std::array<float,2>{0.467046976f, 0.266159207f},
-std::array<float,2>{0.785491049f, 0.757317603f},
-std::array<float,2>{0.739217162f, 0.249630362f},
-std::array<float,2>{0.0174423363f, 0.680742264f},
-std::array<float,2>{0.203067809f, 0.092427969f},
-std::array<float,2>{0.579387963f, 0.58709842f},
-std::array<float,2>{0.933495522f, 0.489139676f},
-std::array<float,2>{0.275478482f, 0.963358104f},
-std::array<float,2>{0.33691442f, 0.156570375f},
-std::array<float,2>{0.957162797f, 0.726309121f},
-std::array<float,2>{0.540855706f, 0.326116025f},
-std::array<float,2>{0.187225267f, 0.849752069f},
-std::array<float,2>{0.068026416f, 0.421452492f},
-std::array<float,2>{0.687036395f, 0.920779586f},
-std::array<float,2>{0.814468682f, 0.0548756793f},
-std::array<float,2>{0.38177982f, 0.535065353f},
-std::array<float,2>{0.306345701f, 0.444990784f},
-std::array<float,2>{0.891045094f, 0.969538331f},
-std::array<float,2>{0.614310622f, 0.115435541f},
-std::array<float,2>{0.236312419f, 0.614527047f},
-std::array<float,2>{0.0549134053f, 0.197681934f},
-std::array<float,2>{0.706324458f, 0.649070799f},
-std::array<float,2>{0.777791083f, 0.281953663f},
-std::array<float,2>{0.495108068f, 0.79831183f},
-std::array<float,2>{0.417005956f, 0.0162942987f},
-std::array<float,2>{0.85715723f, 0.51176697f},
-std::array<float,2>{0.642898679f, 0.402672708f},
-std::array<float,2>{0.113531001f, 0.899476171f},
-std::array<float,2>{0.14902629f, 0.345113277f},
-std::array<float,2>{0.513330817f, 0.838095903f},
-std::array<float,2>{0.97145617f, 0.129290879f},
-std::array<float,2>{0.360761106f, 0.69908154f},
-std::array<float,2>{0.403806627f, 0.389359087f},
-std::array<float,2>{0.843514502f, 0.879954636f},
-std::array<float,2>{0.66101861f, 0.00609315513f},
-std::array<float,2>{0.0831831843f, 0.5258255f},
-std::array<float,2>{0.16243948f, 0.151716545f},
-std::array<float,2>{0.54870373f, 0.710707903f},
-std::array<float,2>{0.938017428f, 0.374834567f},
-std::array<float,2>{0.324303746f, 0.824485481f},
-std::array<float,2>{0.262559056f, 0.0952455401f},
-std::array<float,2>{0.910150528f, 0.596421123f},
-std::array<float,2>{0.566725194f, 0.456501871f},
-std::array<float,2>{0.209453896f, 0.99277246f},
-std::array<float,2>{0.00602458697f, 0.310550213f},
-std::array<float,2>{0.730102777f, 0.796112835f},
-std::array<float,2>{0.811416864f, 0.204230115f},
-std::array<float,2>{0.446054399f, 0.635024846f},
-std::array<float,2>{0.348281413f, 0.337585151f},
-std::array<float,2>{0.989457846f, 0.869754016f},
-std::array<float,2>{0.523221791f, 0.180919856f},
-std::array<float,2>{0.128960148f, 0.747112095f},
-std::array<float,2>{0.0947116315f, 0.0315849297f},
-std::array<float,2>{0.627264082f, 0.548730731f},
-std::array<float,2>{0.861589313f, 0.431814581f},
-std::array<float,2>{0.43664223f, 0.937306523f},
-std::array<float,2>{0.48230195f, 0.233492672f},
-std::array<float,2>{0.760350645f, 0.668208599f},
-std::array<float,2>{0.699702978f, 0.260668099f},
-std::array<float,2>{0.0405960679f, 0.766959071f},
-std::array<float,2>{0.223493516f, 0.470677793f},
-std::array<float,2>{0.595164359f, 0.94518882f},
-std::array<float,2>{0.876217663f, 0.0749713406f},
-std::array<float,2>{0.287443668f, 0.574484825f},
-std::array<float,2>{0.424612492f, 0.36072737f},
-std::array<float,2>{0.868884087f, 0.815990031f},
-std::array<float,2>{0.633380532f, 0.143778905f},
-std::array<float,2>{0.105021268f, 0.715646982f},
-std::array<float,2>{0.134773791f, 0.00861439388f},
-std::array<float,2>{0.523789287f, 0.522926748f},
-std::array<float,2>{0.999266803f, 0.378067374f},
-std::array<float,2>{0.353678346f, 0.887450039f},
-std::array<float,2>{0.295708209f, 0.213198379f},
-std::array<float,2>{0.888434112f, 0.628801107f},
-std::array<float,2>{0.606871307f, 0.304245085f},
-std::array<float,2>{0.232872993f, 0.784928858f},
-std::array<float,2>{0.0341040455f, 0.464040279f},
-std::array<float,2>{0.691707134f, 0.990722299f},
-std::array<float,2>{0.756707907f, 0.106245935f},
-std::array<float,2>{0.471129507f, 0.604166031f},
-std::array<float,2>{0.320186555f, 0.42640692f},
-std::array<float,2>{0.947922468f, 0.922097683f},
-std::array<float,2>{0.561401248f, 0.0433397032f},
-std::array<float,2>{0.166226357f, 0.556073129f},
-std::array<float,2>{0.0861054733f, 0.175566748f},
-std::array<float,2>{0.670558155f, 0.734614193f},
-std::array<float,2>{0.830949128f, 0.332766473f},
-std::array<float,2>{0.396193057f, 0.862848639f},
-std::array<float,2>{0.445174545f, 0.0700182021f},
-std::array<float,2>{0.800480425f, 0.563177586f},
-std::array<float,2>{0.724426389f, 0.478125721f},
-std::array<float,2>{0.00997918937f, 0.947283804f},
-std::array<float,2>{0.213108167f, 0.251625329f},
-std::array<float,2>{0.573180139f, 0.780180335f},
-std::array<float,2>{0.919080853f, 0.223729447f},
-std::array<float,2>{0.251912028f, 0.660359263f},
-std::array<float,2>{0.49202165f, 0.493954003f},
-std::array<float,2>{0.771181107f, 0.959227502f},
-std::array<float,2>{0.716793418f, 0.0838143751f},
-std::array<float,2>{0.0546631627f, 0.581309497f},
-std::array<float,2>{0.249897897f, 0.239450186f},
-std::array<float,2>{0.61986649f, 0.676636755f},
-std::array<float,2>{0.903081179f, 0.280544072f},
-std::array<float,2>{0.296961039f, 0.762784541f},
-std::array<float,2>{0.372537792f, 0.0493666977f},
-std::array<float,2>{0.979404807f, 0.54576391f},
-std::array<float,2>{0.507117391f, 0.40829587f},
-std::array<float,2>{0.141264617f, 0.906307995f},
-std::array<float,2>{0.12426734f, 0.314025134f},
-std::array<float,2>{0.653315187f, 0.85496968f},
-std::array<float,2>{0.847309113f, 0.169791058f},
-std::array<float,2>{0.413085461f, 0.731107891f},
-std::array<float,2>{0.270231307f, 0.289835274f},
-std::array<float,2>{0.927423835f, 0.804824591f},
-std::array<float,2>{0.59351331f, 0.194382504f},
-std::array<float,2>{0.194641456f, 0.645400345f},
-std::array<float,2>{0.0290321745f, 0.117869228f},
-std::array<float,2>{0.749461174f, 0.62175864f},
-std::array<float,2>{0.791596353f, 0.452575922f},
-std::array<float,2>{0.454624861f, 0.978626132f},
-std::array<float,2>{0.384386599f, 0.136075392f},
-std::array<float,2>{0.827275574f, 0.692148864f},
-std::array<float,2>{0.679543018f, 0.351910472f},
-std::array<float,2>{0.0754059032f, 0.83296299f},
-std::array<float,2>{0.174205735f, 0.393219143f},
-std::array<float,2>{0.536158681f, 0.891585767f},
-std::array<float,2>{0.968396008f, 0.027547041f},
-std::array<float,2>{0.330880523f, 0.507389128f},
-std::array<float,2>{0.3759588f, 0.297703981f},
-std::array<float,2>{0.81682539f, 0.786866784f},
-std::array<float,2>{0.680889189f, 0.216069967f},
-std::array<float,2>{0.0625262335f, 0.629600644f},
-std::array<float,2>{0.182126388f, 0.102438956f},
-std::array<float,2>{0.543420196f, 0.607031405f},
-std::array<float,2>{0.95664537f, 0.466044128f},
-std::array<float,2>{0.340829939f, 0.988123775f},
-std::array<float,2>{0.280256242f, 0.147927999f},
-std::array<float,2>{0.934148133f, 0.712048292f},
-std::array<float,2>{0.584515333f, 0.36482513f},
-std::array<float,2>{0.197879016f, 0.819491029f},
-std::array<float,2>{0.0198873263f, 0.381434292f},
-std::array<float,2>{0.737208426f, 0.885654092f},
-std::array<float,2>{0.783655286f, 0.0154934749f},
-std::array<float,2>{0.462277293f, 0.518722653f},
-std::array<float,2>{0.365517676f, 0.480639398f},
-std::array<float,2>{0.976560831f, 0.95179075f},
-std::array<float,2>{0.51130414f, 0.0649895668f},
-std::array<float,2>{0.152464673f, 0.569770634f},
-std::array<float,2>{0.112459265f, 0.22261925f},
-std::array<float,2>{0.646412075f, 0.657449365f},
-std::array<float,2>{0.855301857f, 0.255762607f},
-std::array<float,2>{0.421120435f, 0.774059594f},
-std::array<float,2>{0.499367803f, 0.0427034087f},
-std::array<float,2>{0.773888767f, 0.561531007f},
-std::array<float,2>{0.708941102f, 0.425282359f},
-std::array<float,2>{0.0620080158f, 0.928605676f},
-std::array<float,2>{0.240600735f, 0.33051616f},
-std::array<float,2>{0.610423446f, 0.866498351f},
-std::array<float,2>{0.897316992f, 0.176789954f},
-std::array<float,2>{0.310931385f, 0.739926696f},
-std::array<float,2>{0.449302942f, 0.413526177f},
-std::array<float,2>{0.804693758f, 0.910165787f},
-std::array<float,2>{0.733678401f, 0.0516921468f},
-std::array<float,2>{0.0030708462f, 0.541009128f},
-std::array<float,2>{0.203170791f, 0.165421844f},
-std::array<float,2>{0.563331962f, 0.728312314f},
-std::array<float,2>{0.911778033f, 0.317705363f},
-std::array<float,2>{0.261082143f, 0.855548918f},
-std::array<float,2>{0.320381641f, 0.0806300044f},
-std::array<float,2>{0.945205808f, 0.583845675f},
-std::array<float,2>{0.55251056f, 0.496691525f},
-std::array<float,2>{0.159995213f, 0.95554018f},
-std::array<float,2>{0.0784122571f, 0.274165154f},
-std::array<float,2>{0.660151601f, 0.757922769f},
-std::array<float,2>{0.837593973f, 0.234737605f},
-std::array<float,2>{0.401220083f, 0.673057437f},
-std::array<float,2>{0.281843603f, 0.357188463f},
-std::array<float,2>{0.879495084f, 0.829357147f},
-std::array<float,2>{0.601323128f, 0.140014529f},
-std::array<float,2>{0.22087197f, 0.689482212f},
-std::array<float,2>{0.0432711691f, 0.0247765537f},
-std::array<float,2>{0.698097646f, 0.502312064f},
-std::array<float,2>{0.765251935f, 0.396491557f},
-std::array<float,2>{0.47980091f, 0.895775437f},
-std::array<float,2>{0.433232903f, 0.19104813f},
-std::array<float,2>{0.86537677f, 0.642699242f},
-std::array<float,2>{0.629768372f, 0.293717384f},
-std::array<float,2>{0.101124182f, 0.810410321f},
-std::array<float,2>{0.126410902f, 0.447219074f},
-std::array<float,2>{0.517235637f, 0.981963873f},
-std::array<float,2>{0.98506093f, 0.122695059f},
-std::array<float,2>{0.347525924f, 0.618068635f},
-std::array<float,2>{0.474848837f, 0.323003203f},
-std::array<float,2>{0.753752589f, 0.845791817f},
-std::array<float,2>{0.69119668f, 0.161353573f},
-std::array<float,2>{0.0390206762f, 0.71990782f},
-std::array<float,2>{0.230219766f, 0.0596294329f},
-std::array<float,2>{0.605148435f, 0.535553753f},
-std::array<float,2>{0.883701146f, 0.416614473f},
-std::array<float,2>{0.291641802f, 0.914093494f},
-std::array<float,2>{0.358816475f, 0.244188026f},
-std::array<float,2>{0.993979096f, 0.6865623f},
-std::array<float,2>{0.530445516f, 0.272419572f},
-std::array<float,2>{0.137447685f, 0.752768815f},
-std::array<float,2>{0.106680356f, 0.48765564f},
-std::array<float,2>{0.640414119f, 0.966285884f},
-std::array<float,2>{0.873063743f, 0.0897069424f},
-std::array<float,2>{0.428690583f, 0.592917681f},
-std::array<float,2>{0.255520791f, 0.400169134f},
-std::array<float,2>{0.915411472f, 0.904296517f},
-std::array<float,2>{0.577806711f, 0.0210841056f},
-std::array<float,2>{0.21824722f, 0.510586798f},
-std::array<float,2>{0.0134371119f, 0.125116348f},
-std::array<float,2>{0.719197929f, 0.699865997f},
-std::array<float,2>{0.801603734f, 0.347980827f},
-std::array<float,2>{0.439925939f, 0.840630889f},
-std::array<float,2>{0.394084454f, 0.110937752f},
-std::array<float,2>{0.835375488f, 0.611051559f},
-std::array<float,2>{0.66709131f, 0.440241277f},
-std::array<float,2>{0.0934209898f, 0.975560486f},
-std::array<float,2>{0.169332564f, 0.285461098f},
-std::array<float,2>{0.556642056f, 0.803900957f},
-std::array<float,2>{0.950224936f, 0.19927071f},
-std::array<float,2>{0.315274894f, 0.65412885f},
-std::array<float,2>{0.409990788f, 0.46092096f},
-std::array<float,2>{0.851354718f, 0.997385561f},
-std::array<float,2>{0.651085258f, 0.098307088f},
-std::array<float,2>{0.118074648f, 0.598629355f},
-std::array<float,2>{0.145290315f, 0.208598226f},
-std::array<float,2>{0.500720918f, 0.639712811f},
-std::array<float,2>{0.980587959f, 0.308322012f},
-std::array<float,2>{0.367730141f, 0.791051328f},
-std::array<float,2>{0.302004129f, 0.00122630433f},
-std::array<float,2>{0.899315774f, 0.527762651f},
-std::array<float,2>{0.624845624f, 0.382821411f},
-std::array<float,2>{0.242479756f, 0.877897084f},
-std::array<float,2>{0.0474374704f, 0.370685577f},
-std::array<float,2>{0.711293638f, 0.823958039f},
-std::array<float,2>{0.768195391f, 0.152700841f},
-std::array<float,2>{0.485641092f, 0.703241467f},
-std::array<float,2>{0.334634691f, 0.262339711f},
-std::array<float,2>{0.963848948f, 0.772193074f},
-std::array<float,2>{0.534376919f, 0.230086789f},
-std::array<float,2>{0.175935686f, 0.664460361f},
-std::array<float,2>{0.0705408975f, 0.0710681453f},
-std::array<float,2>{0.674753785f, 0.573933542f},
-std::array<float,2>{0.821597815f, 0.475473434f},
-std::array<float,2>{0.387431443f, 0.940401137f},
-std::array<float,2>{0.46061784f, 0.186741605f},
-std::array<float,2>{0.793109119f, 0.74482131f},
-std::array<float,2>{0.742288828f, 0.343708485f},
-std::array<float,2>{0.0257824752f, 0.874061704f},
-std::array<float,2>{0.189163163f, 0.434237301f},
-std::array<float,2>{0.587940156f, 0.932582021f},
-std::array<float,2>{0.925363243f, 0.0390045866f},
-std::array<float,2>{0.266782463f, 0.554451406f},
-std::array<float,2>{0.492839009f, 0.284356117f},
-std::array<float,2>{0.779682159f, 0.800397277f},
-std::array<float,2>{0.703537405f, 0.19594723f},
-std::array<float,2>{0.0573258959f, 0.65070343f},
-std::array<float,2>{0.237131059f, 0.114133403f},
-std::array<float,2>{0.616575241f, 0.615945578f},
-std::array<float,2>{0.893234134f, 0.442698598f},
-std::array<float,2>{0.308478087f, 0.972343504f},
-std::array<float,2>{0.362450302f, 0.131026655f},
-std::array<float,2>{0.969148934f, 0.696059048f},
-std::array<float,2>{0.515324831f, 0.347211272f},
-std::array<float,2>{0.150405258f, 0.837350428f},
-std::array<float,2>{0.116950318f, 0.404471934f},
-std::array<float,2>{0.641843319f, 0.901978493f},
-std::array<float,2>{0.857801378f, 0.0178890433f},
-std::array<float,2>{0.415188819f, 0.513929546f},
-std::array<float,2>{0.2749542f, 0.491035044f},
-std::array<float,2>{0.930577457f, 0.961452603f},
-std::array<float,2>{0.581662893f, 0.0904116035f},
-std::array<float,2>{0.200365797f, 0.589302301f},
-std::array<float,2>{0.0187732745f, 0.247052431f},
-std::array<float,2>{0.74184233f, 0.681655884f},
-std::array<float,2>{0.787281096f, 0.269471198f},
-std::array<float,2>{0.466089517f, 0.755030572f},
-std::array<float,2>{0.380850345f, 0.0569230057f},
-std::array<float,2>{0.813370943f, 0.532900274f},
-std::array<float,2>{0.683668375f, 0.418562293f},
-std::array<float,2>{0.0690973625f, 0.919508278f},
-std::array<float,2>{0.183847412f, 0.326559603f},
-std::array<float,2>{0.541898847f, 0.849428773f},
-std::array<float,2>{0.960880935f, 0.159086451f},
-std::array<float,2>{0.338934004f, 0.7243613f},
-std::array<float,2>{0.434084117f, 0.429786772f},
-std::array<float,2>{0.86098367f, 0.934784889f},
-std::array<float,2>{0.62537092f, 0.0344441421f},
-std::array<float,2>{0.0971772745f, 0.549410462f},
-std::array<float,2>{0.130984411f, 0.183242202f},
-std::array<float,2>{0.521083772f, 0.748458683f},
-std::array<float,2>{0.991487682f, 0.339383304f},
-std::array<float,2>{0.351530582f, 0.867206216f},
-std::array<float,2>{0.285266697f, 0.0778481439f},
-std::array<float,2>{0.877657115f, 0.577503324f},
-std::array<float,2>{0.596399665f, 0.470785618f},
-std::array<float,2>{0.22531268f, 0.943292856f},
-std::array<float,2>{0.0419914089f, 0.259680301f},
-std::array<float,2>{0.702387869f, 0.768571615f},
-std::array<float,2>{0.757924318f, 0.232190192f},
-std::array<float,2>{0.483753443f, 0.670177579f},
-std::array<float,2>{0.327449977f, 0.373008758f},
-std::array<float,2>{0.939698279f, 0.827650845f},
-std::array<float,2>{0.55073911f, 0.149878919f},
-std::array<float,2>{0.161881804f, 0.708709002f},
-std::array<float,2>{0.0857758969f, 0.00468075322f},
-std::array<float,2>{0.66338712f, 0.524352372f},
-std::array<float,2>{0.840926886f, 0.387506783f},
-std::array<float,2>{0.404344916f, 0.881658196f},
-std::array<float,2>{0.448215008f, 0.206475452f},
-std::array<float,2>{0.810013354f, 0.633124709f},
-std::array<float,2>{0.727188826f, 0.310474426f},
-std::array<float,2>{0.00394616975f, 0.794493377f},
-std::array<float,2>{0.208063945f, 0.455064863f},
-std::array<float,2>{0.569297075f, 0.995188594f},
-std::array<float,2>{0.907269418f, 0.0959608853f},
-std::array<float,2>{0.264037013f, 0.594781101f},
-std::array<float,2>{0.396923184f, 0.33579582f},
-std::array<float,2>{0.8285501f, 0.861149251f},
-std::array<float,2>{0.668948114f, 0.17335625f},
-std::array<float,2>{0.0880995542f, 0.737551153f},
-std::array<float,2>{0.165106028f, 0.0467674807f},
-std::array<float,2>{0.559288859f, 0.557965279f},
-std::array<float,2>{0.946517348f, 0.429605156f},
-std::array<float,2>{0.316970944f, 0.924500287f},
-std::array<float,2>{0.253767729f, 0.226314321f},
-std::array<float,2>{0.920008123f, 0.662267506f},
-std::array<float,2>{0.572227597f, 0.253812551f},
-std::array<float,2>{0.212085173f, 0.778903425f},
-std::array<float,2>{0.00931677688f, 0.478739202f},
-std::array<float,2>{0.725506127f, 0.946279645f},
-std::array<float,2>{0.798377693f, 0.066969499f},
-std::array<float,2>{0.442989171f, 0.564938962f},
-std::array<float,2>{0.352092713f, 0.375367403f},
-std::array<float,2>{0.996297598f, 0.889297843f},
-std::array<float,2>{0.525748193f, 0.0100760637f},
-std::array<float,2>{0.134623706f, 0.520139337f},
-std::array<float,2>{0.103190109f, 0.141824916f},
-std::array<float,2>{0.634968877f, 0.717208564f},
-std::array<float,2>{0.871028423f, 0.362629652f},
-std::array<float,2>{0.423586488f, 0.813232422f},
-std::array<float,2>{0.468826979f, 0.107493214f},
-std::array<float,2>{0.75571245f, 0.6017977f},
-std::array<float,2>{0.694565237f, 0.462471098f},
-std::array<float,2>{0.0325485878f, 0.989858449f},
-std::array<float,2>{0.230926022f, 0.302383184f},
-std::array<float,2>{0.608578742f, 0.782798767f},
-std::array<float,2>{0.889278233f, 0.211862281f},
-std::array<float,2>{0.294006199f, 0.626709282f},
-std::array<float,2>{0.456372589f, 0.449570388f},
-std::array<float,2>{0.789562285f, 0.977692664f},
-std::array<float,2>{0.747649312f, 0.120082296f},
-std::array<float,2>{0.03052634f, 0.623249412f},
-std::array<float,2>{0.192098215f, 0.191603824f},
-std::array<float,2>{0.590064824f, 0.647495151f},
-std::array<float,2>{0.927751422f, 0.291657299f},
-std::array<float,2>{0.273144484f, 0.807968736f},
-std::array<float,2>{0.328168988f, 0.0309241954f},
-std::array<float,2>{0.965933919f, 0.504162371f},
-std::array<float,2>{0.538642764f, 0.390790612f},
-std::array<float,2>{0.17235297f, 0.893419743f},
-std::array<float,2>{0.077899009f, 0.35394761f},
-std::array<float,2>{0.677440047f, 0.835770071f},
-std::array<float,2>{0.824463069f, 0.134196788f},
-std::array<float,2>{0.385175347f, 0.694463372f},
-std::array<float,2>{0.299453467f, 0.277357638f},
-std::array<float,2>{0.904313266f, 0.763908386f},
-std::array<float,2>{0.617417932f, 0.24167417f},
-std::array<float,2>{0.247519419f, 0.678223908f},
-std::array<float,2>{0.0525394008f, 0.0851822048f},
-std::array<float,2>{0.718553066f, 0.579477787f},
-std::array<float,2>{0.772054672f, 0.494213909f},
-std::array<float,2>{0.490003139f, 0.958115339f},
-std::array<float,2>{0.411383778f, 0.170010731f},
-std::array<float,2>{0.844499886f, 0.732664287f},
-std::array<float,2>{0.656225979f, 0.31502676f},
-std::array<float,2>{0.122385696f, 0.853316724f},
-std::array<float,2>{0.143636465f, 0.407105535f},
-std::array<float,2>{0.504516125f, 0.909552872f},
-std::array<float,2>{0.978264749f, 0.0488041304f},
-std::array<float,2>{0.37440607f, 0.543190539f},
-std::array<float,2>{0.418395609f, 0.256896466f},
-std::array<float,2>{0.852671683f, 0.777009487f},
-std::array<float,2>{0.647692204f, 0.218827665f},
-std::array<float,2>{0.111235499f, 0.65933013f},
-std::array<float,2>{0.154623479f, 0.0628305897f},
-std::array<float,2>{0.509644985f, 0.566767216f},
-std::array<float,2>{0.973829269f, 0.484143227f},
-std::array<float,2>{0.364132255f, 0.949781716f},
-std::array<float,2>{0.310540646f, 0.178793624f},
-std::array<float,2>{0.89593482f, 0.741154015f},
-std::array<float,2>{0.611341298f, 0.329640836f},
-std::array<float,2>{0.239606023f, 0.863314331f},
-std::array<float,2>{0.059014082f, 0.422494501f},
-std::array<float,2>{0.709904552f, 0.927187443f},
-std::array<float,2>{0.776818812f, 0.0390935466f},
-std::array<float,2>{0.497129917f, 0.558614254f},
-std::array<float,2>{0.343163222f, 0.467629701f},
-std::array<float,2>{0.954971433f, 0.985342264f},
-std::array<float,2>{0.545193315f, 0.104861289f},
-std::array<float,2>{0.181559086f, 0.608718157f},
-std::array<float,2>{0.0656315759f, 0.217768848f},
-std::array<float,2>{0.683366716f, 0.630958438f},
-std::array<float,2>{0.818398178f, 0.300426841f},
-std::array<float,2>{0.378420889f, 0.788724959f},
-std::array<float,2>{0.464277357f, 0.0131081613f},
-std::array<float,2>{0.782361329f, 0.516963124f},
-std::array<float,2>{0.735645175f, 0.380626798f},
-std::array<float,2>{0.0233857781f, 0.884284854f},
-std::array<float,2>{0.196739748f, 0.365886331f},
-std::array<float,2>{0.58357352f, 0.818308175f},
-std::array<float,2>{0.937180161f, 0.146342143f},
-std::array<float,2>{0.279039264f, 0.713733375f},
-std::array<float,2>{0.477132142f, 0.395700246f},
-std::array<float,2>{0.762302756f, 0.896855056f},
-std::array<float,2>{0.696046531f, 0.0257579535f},
-std::array<float,2>{0.0468145311f, 0.500375569f},
-std::array<float,2>{0.218863294f, 0.137031958f},
-std::array<float,2>{0.598409832f, 0.688332081f},
-std::array<float,2>{0.882320344f, 0.358434588f},
-std::array<float,2>{0.283748209f, 0.831394494f},
-std::array<float,2>{0.344183445f, 0.124278083f},
-std::array<float,2>{0.987440348f, 0.619224787f},
-std::array<float,2>{0.518189609f, 0.449143529f},
-std::array<float,2>{0.127990082f, 0.984151244f},
-std::array<float,2>{0.0995546505f, 0.295948595f},
-std::array<float,2>{0.631386578f, 0.81129998f},
-std::array<float,2>{0.864725173f, 0.188796908f},
-std::array<float,2>{0.431166261f, 0.641484618f},
-std::array<float,2>{0.258156568f, 0.31922245f},
-std::array<float,2>{0.912419736f, 0.858576715f},
-std::array<float,2>{0.56475395f, 0.166962802f},
-std::array<float,2>{0.206826061f, 0.730336487f},
-std::array<float,2>{0.000207845849f, 0.0540361777f},
-std::array<float,2>{0.730557024f, 0.542721391f},
-std::array<float,2>{0.807860494f, 0.410340965f},
-std::array<float,2>{0.452860326f, 0.91305697f},
-std::array<float,2>{0.400367796f, 0.2365264f},
-std::array<float,2>{0.838103831f, 0.674359739f},
-std::array<float,2>{0.657631516f, 0.277243704f},
-std::array<float,2>{0.0808030292f, 0.760183394f},
-std::array<float,2>{0.157432675f, 0.49860695f},
-std::array<float,2>{0.553781867f, 0.954009354f},
-std::array<float,2>{0.941800356f, 0.0792932138f},
-std::array<float,2>{0.323908001f, 0.585531771f},
-std::array<float,2>{0.438999921f, 0.349728912f},
-std::array<float,2>{0.803640783f, 0.8425228f},
-std::array<float,2>{0.721336186f, 0.128533751f},
-std::array<float,2>{0.0153391836f, 0.702282667f},
-std::array<float,2>{0.216743141f, 0.022498101f},
-std::array<float,2>{0.574590445f, 0.509658813f},
-std::array<float,2>{0.917318583f, 0.400727212f},
-std::array<float,2>{0.256419122f, 0.90486443f},
-std::array<float,2>{0.313553542f, 0.202048495f},
-std::array<float,2>{0.953105271f, 0.655647695f},
-std::array<float,2>{0.556157768f, 0.288959891f},
-std::array<float,2>{0.169991449f, 0.80211544f},
-std::array<float,2>{0.0900872648f, 0.439244449f},
-std::array<float,2>{0.664231956f, 0.974588275f},
-std::array<float,2>{0.833753884f, 0.112871885f},
-std::array<float,2>{0.391927063f, 0.612845242f},
-std::array<float,2>{0.289882332f, 0.414561301f},
-std::array<float,2>{0.886527836f, 0.916700363f},
-std::array<float,2>{0.603035092f, 0.0613151155f},
-std::array<float,2>{0.227104008f, 0.537810087f},
-std::array<float,2>{0.0367672928f, 0.16349709f},
-std::array<float,2>{0.688124895f, 0.722038448f},
-std::array<float,2>{0.750191808f, 0.320834458f},
-std::array<float,2>{0.474150509f, 0.844967008f},
-std::array<float,2>{0.426417917f, 0.0871812329f},
-std::array<float,2>{0.872607589f, 0.59056294f},
-std::array<float,2>{0.637279153f, 0.485941291f},
-std::array<float,2>{0.108822159f, 0.968422592f},
-std::array<float,2>{0.140020698f, 0.269845873f},
-std::array<float,2>{0.527347624f, 0.751946092f},
-std::array<float,2>{0.9942168f, 0.243013263f},
-std::array<float,2>{0.355648905f, 0.684201121f},
-std::array<float,2>{0.389936894f, 0.474571317f},
-std::array<float,2>{0.823675394f, 0.938180327f},
-std::array<float,2>{0.673143446f, 0.0725564808f},
-std::array<float,2>{0.0723642558f, 0.571254313f},
-std::array<float,2>{0.178580672f, 0.227440253f},
-std::array<float,2>{0.532997131f, 0.666468561f},
-std::array<float,2>{0.961455941f, 0.26516521f},
-std::array<float,2>{0.333057582f, 0.770046413f},
-std::array<float,2>{0.269474119f, 0.0357800536f},
-std::array<float,2>{0.922115386f, 0.552202582f},
-std::array<float,2>{0.587369323f, 0.435771316f},
-std::array<float,2>{0.191232219f, 0.929766297f},
-std::array<float,2>{0.0249294285f, 0.340950757f},
-std::array<float,2>{0.745988786f, 0.872564316f},
-std::array<float,2>{0.795189023f, 0.185387909f},
-std::array<float,2>{0.457126647f, 0.743907809f},
-std::array<float,2>{0.370052457f, 0.305086017f},
-std::array<float,2>{0.984027982f, 0.790979326f},
-std::array<float,2>{0.50218612f, 0.209609255f},
-std::array<float,2>{0.146736547f, 0.638062358f},
-std::array<float,2>{0.11941158f, 0.0997255743f},
-std::array<float,2>{0.64853555f, 0.600384176f},
-std::array<float,2>{0.848737955f, 0.458982855f},
-std::array<float,2>{0.406271249f, 0.999032438f},
-std::array<float,2>{0.486743659f, 0.155513406f},
-std::array<float,2>{0.767563462f, 0.706549466f},
-std::array<float,2>{0.714163721f, 0.367941856f},
-std::array<float,2>{0.0501363426f, 0.821955621f},
-std::array<float,2>{0.244701102f, 0.386234552f},
-std::array<float,2>{0.622974098f, 0.8754493f},
-std::array<float,2>{0.902159572f, 0.00307973637f},
-std::array<float,2>{0.304383993f, 0.530448437f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.232795328f, 0.166494861f},
-std::array<float,2>{0.916034162f, 0.5430426f},
-std::array<float,2>{0.639218271f, 0.478205025f},
-std::array<float,2>{0.477970719f, 0.786287904f},
-std::array<float,2>{0.275386781f, 0.314094931f},
-std::array<float,2>{0.509848833f, 0.934670031f},
-std::array<float,2>{0.762416184f, 0.0794245005f},
-std::array<float,2>{0.0323657468f, 0.685720921f},
-std::array<float,2>{0.416837811f, 0.0088300705f},
-std::array<float,2>{0.70671761f, 0.749946475f},
-std::array<float,2>{0.95975256f, 0.297342896f},
-std::array<float,2>{0.187036186f, 0.959957898f},
-std::array<float,2>{0.0722079352f, 0.427356094f},
-std::array<float,2>{0.872952282f, 0.872817457f},
-std::array<float,2>{0.565927148f, 0.233137041f},
-std::array<float,2>{0.314773411f, 0.608462811f},
-std::array<float,2>{0.0052441163f, 0.114748634f},
-std::array<float,2>{0.78496623f, 0.644498289f},
-std::array<float,2>{0.536828697f, 0.35583663f},
-std::array<float,2>{0.307372391f, 0.88272047f},
-std::array<float,2>{0.454662293f, 0.458869696f},
-std::array<float,2>{0.6654796f, 0.763047814f},
-std::array<float,2>{0.880818605f, 0.149516314f},
-std::array<float,2>{0.209602162f, 0.509338677f},
-std::array<float,2>{0.355775803f, 0.19185552f},
-std::array<float,2>{0.609162629f, 0.589007676f},
-std::array<float,2>{0.82829988f, 0.383789122f},
-std::array<float,2>{0.121413223f, 0.818039536f},
-std::array<float,2>{0.131046906f, 0.250006676f},
-std::array<float,2>{0.981429815f, 0.991904199f},
-std::array<float,2>{0.734110594f, 0.0357203484f},
-std::array<float,2>{0.38677159f, 0.700808346f},
-std::array<float,2>{0.101701982f, 0.236746654f},
-std::array<float,2>{0.815693259f, 0.622523427f},
-std::array<float,2>{0.618173182f, 0.419918239f},
-std::array<float,2>{0.360551476f, 0.850401163f},
-std::array<float,2>{0.395864576f, 0.29090035f},
-std::array<float,2>{0.734649897f, 0.948149443f},
-std::array<float,2>{0.998486459f, 0.0235845018f},
-std::array<float,2>{0.150568143f, 0.72853142f},
-std::array<float,2>{0.290186942f, 0.0703214034f},
-std::array<float,2>{0.551773846f, 0.656645f},
-std::array<float,2>{0.81011951f, 0.338990897f},
-std::array<float,2>{0.021890007f, 0.918962061f},
-std::array<float,2>{0.192590907f, 0.495511621f},
-std::array<float,2>{0.894377887f, 0.803777277f},
-std::array<float,2>{0.675888538f, 0.174972698f},
-std::array<float,2>{0.452105582f, 0.561262548f},
-std::array<float,2>{0.157248452f, 0.0545477122f},
-std::array<float,2>{0.946773291f, 0.714849293f},
-std::array<float,2>{0.697348177f, 0.269907594f},
-std::array<float,2>{0.434985369f, 0.979738355f},
-std::array<float,2>{0.331817776f, 0.395278037f},
-std::array<float,2>{0.58263129f, 0.836832047f},
-std::array<float,2>{0.853080153f, 0.211527526f},
-std::array<float,2>{0.0930597484f, 0.565927863f},
-std::array<float,2>{0.493406564f, 0.129150122f},
-std::array<float,2>{0.65120393f, 0.521666169f},
-std::array<float,2>{0.928925753f, 0.450906515f},
-std::array<float,2>{0.2439152f, 0.775794923f},
-std::array<float,2>{0.0524459966f, 0.367394537f},
-std::array<float,2>{0.778172493f, 0.89713037f},
-std::array<float,2>{0.518085539f, 0.094812043f},
-std::array<float,2>{0.258309692f, 0.626982391f},
-std::array<float,2>{0.146397054f, 0.208133921f},
-std::array<float,2>{0.988744795f, 0.573810399f},
-std::array<float,2>{0.74571842f, 0.401817948f},
-std::array<float,2>{0.400323838f, 0.829327524f},
-std::array<float,2>{0.367480189f, 0.276412904f},
-std::array<float,2>{0.616539896f, 0.971453071f},
-std::array<float,2>{0.821416557f, 0.0602946132f},
-std::array<float,2>{0.0992620587f, 0.704014361f},
-std::array<float,2>{0.443966597f, 0.107511319f},
-std::array<float,2>{0.686057746f, 0.637369096f},
-std::array<float,2>{0.905664623f, 0.365934789f},
-std::array<float,2>{0.202397346f, 0.900435269f},
-std::array<float,2>{0.0243536085f, 0.445270181f},
-std::array<float,2>{0.800481141f, 0.767373383f},
-std::array<float,2>{0.558561623f, 0.136136159f},
-std::array<float,2>{0.284810752f, 0.529540181f},
-std::array<float,2>{0.0844016969f, 0.0157393664f},
-std::array<float,2>{0.85003686f, 0.721945047f},
-std::array<float,2>{0.593420982f, 0.287119776f},
-std::array<float,2>{0.340724915f, 0.940747917f},
-std::array<float,2>{0.427427799f, 0.409283876f},
-std::array<float,2>{0.688705146f, 0.8529827f},
-std::array<float,2>{0.941862464f, 0.247355074f},
-std::array<float,2>{0.167103127f, 0.610938132f},
-std::array<float,2>{0.253075063f, 0.186584502f},
-std::array<float,2>{0.527477801f, 0.551801085f},
-std::array<float,2>{0.77136755f, 0.488368481f},
-std::array<float,2>{0.0547382087f, 0.810596108f},
-std::array<float,2>{0.238205999f, 0.334713995f},
-std::array<float,2>{0.932799757f, 0.911392093f},
-std::array<float,2>{0.64764297f, 0.0663959607f},
-std::array<float,2>{0.488747984f, 0.670493245f},
-std::array<float,2>{0.0422204547f, 0.145417809f},
-std::array<float,2>{0.754705191f, 0.505864859f},
-std::array<float,2>{0.500340641f, 0.460954756f},
-std::array<float,2>{0.268241972f, 0.752888978f},
-std::array<float,2>{0.473702669f, 0.344838291f},
-std::array<float,2>{0.631925046f, 0.883766532f},
-std::array<float,2>{0.910292804f, 0.120971553f},
-std::array<float,2>{0.226146445f, 0.653399944f},
-std::array<float,2>{0.322993159f, 0.0468061343f},
-std::array<float,2>{0.575160444f, 0.687934577f},
-std::array<float,2>{0.860825002f, 0.260153472f},
-std::array<float,2>{0.0655362308f, 0.993740201f},
-std::array<float,2>{0.172144249f, 0.377165467f},
-std::array<float,2>{0.963293254f, 0.827266157f},
-std::array<float,2>{0.714158714f, 0.196894452f},
-std::array<float,2>{0.413040221f, 0.582739651f},
-std::array<float,2>{0.213085398f, 0.0872431174f},
-std::array<float,2>{0.88597405f, 0.677956283f},
-std::array<float,2>{0.659560025f, 0.326636374f},
-std::array<float,2>{0.461750418f, 0.922754705f},
-std::array<float,2>{0.300319403f, 0.469053358f},
-std::array<float,2>{0.541464984f, 0.795465291f},
-std::array<float,2>{0.789654851f, 0.158232898f},
-std::array<float,2>{0.013458468f, 0.535503089f},
-std::array<float,2>{0.380893558f, 0.224783257f},
-std::array<float,2>{0.722296536f, 0.595934093f},
-std::array<float,2>{0.96942544f, 0.435356319f},
-std::array<float,2>{0.136586994f, 0.8658759f},
-std::array<float,2>{0.116934247f, 0.308215976f},
-std::array<float,2>{0.840959489f, 0.962186992f},
-std::array<float,2>{0.599202871f, 0.00500361016f},
-std::array<float,2>{0.34845376f, 0.735387743f},
-std::array<float,2>{0.179847002f, 0.138870582f},
-std::array<float,2>{0.954330742f, 0.525440395f},
-std::array<float,2>{0.710768998f, 0.441168278f},
-std::array<float,2>{0.418752134f, 0.772552311f},
-std::array<float,2>{0.319116652f, 0.362786859f},
-std::array<float,2>{0.569329619f, 0.902697563f},
-std::array<float,2>{0.869085908f, 0.101764679f},
-std::array<float,2>{0.0748456493f, 0.636058331f},
-std::array<float,2>{0.482417554f, 0.0557073765f},
-std::array<float,2>{0.635892391f, 0.708024263f},
-std::array<float,2>{0.921618164f, 0.280862004f},
-std::array<float,2>{0.229813233f, 0.972743869f},
-std::array<float,2>{0.0383668914f, 0.403529078f},
-std::array<float,2>{0.760589421f, 0.832959235f},
-std::array<float,2>{0.515181303f, 0.204472139f},
-std::array<float,2>{0.279102832f, 0.577828407f},
-std::array<float,2>{0.120783925f, 0.0690491423f},
-std::array<float,2>{0.835241735f, 0.665400207f},
-std::array<float,2>{0.604914427f, 0.328934282f},
-std::array<float,2>{0.354748249f, 0.909463525f},
-std::array<float,2>{0.384594977f, 0.485703707f},
-std::array<float,2>{0.729486227f, 0.806511641f},
-std::array<float,2>{0.978171051f, 0.180909976f},
-std::array<float,2>{0.125141799f, 0.547307253f},
-std::array<float,2>{0.308765322f, 0.243837059f},
-std::array<float,2>{0.531293511f, 0.614238858f},
-std::array<float,2>{0.785543382f, 0.410454988f},
-std::array<float,2>{0.00238211663f, 0.856683671f},
-std::array<float,2>{0.203476951f, 0.28360343f},
-std::array<float,2>{0.878189206f, 0.943697333f},
-std::array<float,2>{0.670482934f, 0.0230793115f},
-std::array<float,2>{0.459257334f, 0.723918021f},
-std::array<float,2>{0.0168078896f, 0.20148699f},
-std::array<float,2>{0.807186842f, 0.580931544f},
-std::array<float,2>{0.550298989f, 0.380417794f},
-std::array<float,2>{0.295718819f, 0.822738349f},
-std::array<float,2>{0.447149485f, 0.262868464f},
-std::array<float,2>{0.672338188f, 0.996600747f},
-std::array<float,2>{0.897642553f, 0.0420732237f},
-std::array<float,2>{0.189765826f, 0.693655014f},
-std::array<float,2>{0.365810096f, 0.124265403f},
-std::array<float,2>{0.623528719f, 0.650428236f},
-std::array<float,2>{0.817706585f, 0.34932068f},
-std::array<float,2>{0.107225046f, 0.887388408f},
-std::array<float,2>{0.156188473f, 0.466324687f},
-std::array<float,2>{0.992204785f, 0.754125953f},
-std::array<float,2>{0.741992652f, 0.140685752f},
-std::array<float,2>{0.392921984f, 0.501251757f},
-std::array<float,2>{0.247232482f, 0.000554888102f},
-std::array<float,2>{0.924554825f, 0.739890337f},
-std::array<float,2>{0.654503167f, 0.308915824f},
-std::array<float,2>{0.497518241f, 0.967240274f},
-std::array<float,2>{0.264613897f, 0.432405204f},
-std::array<float,2>{0.521531641f, 0.86163491f},
-std::array<float,2>{0.774066091f, 0.220726684f},
-std::array<float,2>{0.0498153754f, 0.601090908f},
-std::array<float,2>{0.433229208f, 0.161954463f},
-std::array<float,2>{0.701735973f, 0.534208238f},
-std::array<float,2>{0.951711714f, 0.474054039f},
-std::array<float,2>{0.160716966f, 0.79229939f},
-std::array<float,2>{0.0893390253f, 0.322113454f},
-std::array<float,2>{0.855828583f, 0.926881015f},
-std::array<float,2>{0.581695318f, 0.0916857645f},
-std::array<float,2>{0.335750014f, 0.672523379f},
-std::array<float,2>{0.196763605f, 0.228721529f},
-std::array<float,2>{0.901154876f, 0.604620576f},
-std::array<float,2>{0.680821717f, 0.422426432f},
-std::array<float,2>{0.437808961f, 0.869238079f},
-std::array<float,2>{0.288091362f, 0.302291274f},
-std::array<float,2>{0.562134981f, 0.954011321f},
-std::array<float,2>{0.803202391f, 0.0143793132f},
-std::array<float,2>{0.031094091f, 0.744991362f},
-std::array<float,2>{0.405488759f, 0.0856783986f},
-std::array<float,2>{0.748765051f, 0.680044174f},
-std::array<float,2>{0.984932601f, 0.319823056f},
-std::array<float,2>{0.14194721f, 0.931199372f},
-std::array<float,2>{0.0947078168f, 0.482428491f},
-std::array<float,2>{0.825404823f, 0.785126269f},
-std::array<float,2>{0.612844229f, 0.168024182f},
-std::array<float,2>{0.372962475f, 0.539700747f},
-std::array<float,2>{0.0619791038f, 0.0329721421f},
-std::array<float,2>{0.767902255f, 0.697089255f},
-std::array<float,2>{0.527216494f, 0.25549686f},
-std::array<float,2>{0.257287592f, 0.98804611f},
-std::array<float,2>{0.486803114f, 0.390509427f},
-std::array<float,2>{0.642993629f, 0.813996077f},
-std::array<float,2>{0.936922669f, 0.190397426f},
-std::array<float,2>{0.241845578f, 0.592482567f},
-std::array<float,2>{0.33858639f, 0.153014466f},
-std::array<float,2>{0.589164853f, 0.513393044f},
-std::array<float,2>{0.844891727f, 0.45526582f},
-std::array<float,2>{0.0808635056f, 0.759818137f},
-std::array<float,2>{0.171812907f, 0.351817042f},
-std::array<float,2>{0.940358639f, 0.878376901f},
-std::array<float,2>{0.692318499f, 0.110571459f},
-std::array<float,2>{0.42408362f, 0.647119582f},
-std::array<float,2>{0.0677888915f, 0.178644404f},
-std::array<float,2>{0.86629504f, 0.557839096f},
-std::array<float,2>{0.573703647f, 0.498488069f},
-std::array<float,2>{0.324623644f, 0.79774195f},
-std::array<float,2>{0.408554226f, 0.341005713f},
-std::array<float,2>{0.715573132f, 0.917239428f},
-std::array<float,2>{0.967176974f, 0.0778874978f},
-std::array<float,2>{0.177386805f, 0.660937786f},
-std::array<float,2>{0.272047013f, 0.0291274581f},
-std::array<float,2>{0.506350756f, 0.731738865f},
-std::array<float,2>{0.751023114f, 0.295790166f},
-std::array<float,2>{0.0447652526f, 0.94939208f},
-std::array<float,2>{0.220712572f, 0.417347819f},
-std::array<float,2>{0.908875704f, 0.844520926f},
-std::array<float,2>{0.628623307f, 0.238957584f},
-std::array<float,2>{0.470440507f, 0.618995011f},
-std::array<float,2>{0.139581203f, 0.0987819955f},
-std::array<float,2>{0.974643052f, 0.629952192f},
-std::array<float,2>{0.72448653f, 0.374321848f},
-std::array<float,2>{0.377732217f, 0.892962575f},
-std::array<float,2>{0.344378769f, 0.447974473f},
-std::array<float,2>{0.595812321f, 0.778524458f},
-std::array<float,2>{0.83630842f, 0.12730512f},
-std::array<float,2>{0.110303059f, 0.517970502f},
-std::array<float,2>{0.464982837f, 0.217652172f},
-std::array<float,2>{0.662960529f, 0.568360984f},
-std::array<float,2>{0.890425086f, 0.3938815f},
-std::array<float,2>{0.215459257f, 0.841624856f},
-std::array<float,2>{0.0107859829f, 0.266680539f},
-std::array<float,2>{0.794671059f, 0.981561244f},
-std::array<float,2>{0.544444859f, 0.0489763729f},
-std::array<float,2>{0.303568155f, 0.71169889f},
-std::array<float,2>{0.207999766f, 0.151129708f},
-std::array<float,2>{0.882250667f, 0.510427713f},
-std::array<float,2>{0.667888999f, 0.45920527f},
-std::array<float,2>{0.455848098f, 0.765288472f},
-std::array<float,2>{0.30556193f, 0.357453763f},
-std::array<float,2>{0.53782177f, 0.880319774f},
-std::array<float,2>{0.78294909f, 0.115611158f},
-std::array<float,2>{0.00747016445f, 0.641438663f},
-std::array<float,2>{0.389210165f, 0.0383077227f},
-std::array<float,2>{0.732085407f, 0.702857256f},
-std::array<float,2>{0.984296143f, 0.252028912f},
-std::array<float,2>{0.130295664f, 0.988320887f},
-std::array<float,2>{0.124248229f, 0.385557026f},
-std::array<float,2>{0.831479311f, 0.81928134f},
-std::array<float,2>{0.607365489f, 0.194035187f},
-std::array<float,2>{0.358776242f, 0.585967183f},
-std::array<float,2>{0.034864068f, 0.0802536756f},
-std::array<float,2>{0.76405561f, 0.683915019f},
-std::array<float,2>{0.508000314f, 0.315874279f},
-std::array<float,2>{0.276425391f, 0.935873926f},
-std::array<float,2>{0.478630155f, 0.480006188f},
-std::array<float,2>{0.636819959f, 0.788006902f},
-std::array<float,2>{0.915550768f, 0.164141804f},
-std::array<float,2>{0.232219309f, 0.546053588f},
-std::array<float,2>{0.312769234f, 0.23121424f},
-std::array<float,2>{0.562937319f, 0.60605818f},
-std::array<float,2>{0.874151468f, 0.42780602f},
-std::array<float,2>{0.073781237f, 0.873772144f},
-std::array<float,2>{0.185457692f, 0.299265504f},
-std::array<float,2>{0.957987666f, 0.957237303f},
-std::array<float,2>{0.704495668f, 0.0111913728f},
-std::array<float,2>{0.41579628f, 0.746450245f},
-std::array<float,2>{0.0901030824f, 0.214093938f},
-std::array<float,2>{0.853582323f, 0.56292969f},
-std::array<float,2>{0.585049987f, 0.396819264f},
-std::array<float,2>{0.32995382f, 0.839682698f},
-std::array<float,2>{0.435872465f, 0.271618783f},
-std::array<float,2>{0.696679473f, 0.978297055f},
-std::array<float,2>{0.948845088f, 0.0522134826f},
-std::array<float,2>{0.158995613f, 0.716984332f},
-std::array<float,2>{0.261229694f, 0.0962031335f},
-std::array<float,2>{0.517365336f, 0.625404f},
-std::array<float,2>{0.78092283f, 0.370952696f},
-std::array<float,2>{0.0546714216f, 0.896321774f},
-std::array<float,2>{0.245076671f, 0.452817947f},
-std::array<float,2>{0.927487433f, 0.773981333f},
-std::array<float,2>{0.649610102f, 0.132593557f},
-std::array<float,2>{0.494454741f, 0.520571887f},
-std::array<float,2>{0.149756029f, 0.0265859831f},
-std::array<float,2>{0.997311711f, 0.727777064f},
-std::array<float,2>{0.738016427f, 0.292793006f},
-std::array<float,2>{0.397469819f, 0.946727097f},
-std::array<float,2>{0.362726092f, 0.420045376f},
-std::array<float,2>{0.621017098f, 0.84953016f},
-std::array<float,2>{0.812654793f, 0.236315832f},
-std::array<float,2>{0.103920005f, 0.623768389f},
-std::array<float,2>{0.450710505f, 0.171879083f},
-std::array<float,2>{0.678483605f, 0.558682144f},
-std::array<float,2>{0.89084661f, 0.493418366f},
-std::array<float,2>{0.193760306f, 0.802726805f},
-std::array<float,2>{0.0205450505f, 0.336249381f},
-std::array<float,2>{0.81127131f, 0.920989513f},
-std::array<float,2>{0.553746283f, 0.0728529245f},
-std::array<float,2>{0.292520791f, 0.658724427f},
-std::array<float,2>{0.164531395f, 0.248418838f},
-std::array<float,2>{0.943374753f, 0.611798942f},
-std::array<float,2>{0.690098822f, 0.406915307f},
-std::array<float,2>{0.427774936f, 0.854134381f},
-std::array<float,2>{0.343066394f, 0.285228103f},
-std::array<float,2>{0.590205252f, 0.937635362f},
-std::array<float,2>{0.848120391f, 0.019524144f},
-std::array<float,2>{0.083687f, 0.719761133f},
-std::array<float,2>{0.490929097f, 0.0631207302f},
-std::array<float,2>{0.646291494f, 0.669707537f},
-std::array<float,2>{0.930859923f, 0.332974464f},
-std::array<float,2>{0.234492376f, 0.914031923f},
-std::array<float,2>{0.05822419f, 0.490409404f},
-std::array<float,2>{0.771665394f, 0.809291899f},
-std::array<float,2>{0.529841661f, 0.185149491f},
-std::array<float,2>{0.250403404f, 0.554383576f},
-std::array<float,2>{0.100215778f, 0.0608380437f},
-std::array<float,2>{0.824065506f, 0.706472516f},
-std::array<float,2>{0.614926219f, 0.275136411f},
-std::array<float,2>{0.369526595f, 0.969001412f},
-std::array<float,2>{0.402245194f, 0.39922142f},
-std::array<float,2>{0.743855238f, 0.830635965f},
-std::array<float,2>{0.990490615f, 0.210400924f},
-std::array<float,2>{0.147085801f, 0.571663141f},
-std::array<float,2>{0.281717271f, 0.13432005f},
-std::array<float,2>{0.556479454f, 0.528499544f},
-std::array<float,2>{0.797329605f, 0.441455901f},
-std::array<float,2>{0.0271766931f, 0.769164741f},
-std::array<float,2>{0.200970486f, 0.364552796f},
-std::array<float,2>{0.902347445f, 0.899131715f},
-std::array<float,2>{0.685251594f, 0.105740041f},
-std::array<float,2>{0.442247927f, 0.638780892f},
-std::array<float,2>{0.0147749828f, 0.157387987f},
-std::array<float,2>{0.791435659f, 0.538445354f},
-std::array<float,2>{0.539308965f, 0.470890462f},
-std::array<float,2>{0.297333956f, 0.794049919f},
-std::array<float,2>{0.464017183f, 0.325717568f},
-std::array<float,2>{0.657995105f, 0.924829066f},
-std::array<float,2>{0.884264231f, 0.0883576274f},
-std::array<float,2>{0.212667376f, 0.67715627f},
-std::array<float,2>{0.351305187f, 0.00594527414f},
-std::array<float,2>{0.601052463f, 0.737929344f},
-std::array<float,2>{0.842291415f, 0.306271911f},
-std::array<float,2>{0.113671318f, 0.963056624f},
-std::array<float,2>{0.132885382f, 0.435954601f},
-std::array<float,2>{0.970846832f, 0.864833832f},
-std::array<float,2>{0.72029978f, 0.223226264f},
-std::array<float,2>{0.379534513f, 0.593815923f},
-std::array<float,2>{0.224198401f, 0.118714631f},
-std::array<float,2>{0.913045108f, 0.654691935f},
-std::array<float,2>{0.629005432f, 0.345794231f},
-std::array<float,2>{0.47487846f, 0.885476768f},
-std::array<float,2>{0.265701473f, 0.463087529f},
-std::array<float,2>{0.502296388f, 0.751375377f},
-std::array<float,2>{0.756552994f, 0.147253156f},
-std::array<float,2>{0.0393359773f, 0.504330456f},
-std::array<float,2>{0.411092967f, 0.198384643f},
-std::array<float,2>{0.712580502f, 0.58558619f},
-std::array<float,2>{0.9613083f, 0.376480967f},
-std::array<float,2>{0.175025791f, 0.824440897f},
-std::array<float,2>{0.0630484074f, 0.259754151f},
-std::array<float,2>{0.862296045f, 0.994608045f},
-std::array<float,2>{0.577441752f, 0.0442924239f},
-std::array<float,2>{0.320948094f, 0.691067159f},
-std::array<float,2>{0.127684966f, 0.183227763f},
-std::array<float,2>{0.979320526f, 0.549605966f},
-std::array<float,2>{0.726609647f, 0.487276971f},
-std::array<float,2>{0.385232568f, 0.806757629f},
-std::array<float,2>{0.352437556f, 0.330169737f},
-std::array<float,2>{0.602061689f, 0.908078551f},
-std::array<float,2>{0.833186448f, 0.0664309859f},
-std::array<float,2>{0.118351214f, 0.667834342f},
-std::array<float,2>{0.45723927f, 0.0198197719f},
-std::array<float,2>{0.668073773f, 0.725068152f},
-std::array<float,2>{0.875016809f, 0.281882554f},
-std::array<float,2>{0.206954822f, 0.943015814f},
-std::array<float,2>{6.261218e-06f, 0.412810087f},
-std::array<float,2>{0.787117422f, 0.859042287f},
-std::array<float,2>{0.533789337f, 0.244517148f},
-std::array<float,2>{0.311508715f, 0.616952002f},
-std::array<float,2>{0.0764516294f, 0.105128415f},
-std::array<float,2>{0.870095909f, 0.632826626f},
-std::array<float,2>{0.566998005f, 0.361034095f},
-std::array<float,2>{0.316859424f, 0.905796349f},
-std::array<float,2>{0.420400828f, 0.438712746f},
-std::array<float,2>{0.707982957f, 0.770877361f},
-std::array<float,2>{0.956973732f, 0.137475386f},
-std::array<float,2>{0.182216451f, 0.525245607f},
-std::array<float,2>{0.279803157f, 0.206798717f},
-std::array<float,2>{0.512339175f, 0.574351072f},
-std::array<float,2>{0.758059084f, 0.404393673f},
-std::array<float,2>{0.0362982973f, 0.834324896f},
-std::array<float,2>{0.227485508f, 0.278104484f},
-std::array<float,2>{0.919112027f, 0.975352764f},
-std::array<float,2>{0.633592486f, 0.0570495464f},
-std::array<float,2>{0.48418051f, 0.710917473f},
-std::array<float,2>{0.0472298115f, 0.219761148f},
-std::array<float,2>{0.777258277f, 0.599364936f},
-std::array<float,2>{0.520560205f, 0.429993212f},
-std::array<float,2>{0.263567626f, 0.859643877f},
-std::array<float,2>{0.498595208f, 0.311718553f},
-std::array<float,2>{0.653138995f, 0.966677606f},
-std::array<float,2>{0.923742294f, 0.0020733499f},
-std::array<float,2>{0.248754933f, 0.741843522f},
-std::array<float,2>{0.333939523f, 0.0919049457f},
-std::array<float,2>{0.579558969f, 0.674346387f},
-std::array<float,2>{0.857804358f, 0.322980583f},
-std::array<float,2>{0.0874839127f, 0.928677797f},
-std::array<float,2>{0.162949383f, 0.475817114f},
-std::array<float,2>{0.94975704f, 0.789454103f},
-std::array<float,2>{0.699784398f, 0.163317814f},
-std::array<float,2>{0.430172265f, 0.532182515f},
-std::array<float,2>{0.188201711f, 0.0393639617f},
-std::array<float,2>{0.896230996f, 0.691545129f},
-std::array<float,2>{0.674140394f, 0.263953954f},
-std::array<float,2>{0.448759735f, 0.99890101f},
-std::array<float,2>{0.293661803f, 0.38128075f},
-std::array<float,2>{0.547582924f, 0.821694314f},
-std::array<float,2>{0.805242896f, 0.200990692f},
-std::array<float,2>{0.018155437f, 0.578436911f},
-std::array<float,2>{0.392258495f, 0.143925205f},
-std::array<float,2>{0.738685131f, 0.502657533f},
-std::array<float,2>{0.99526602f, 0.468532115f},
-std::array<float,2>{0.152554274f, 0.756812572f},
-std::array<float,2>{0.109065726f, 0.35061416f},
-std::array<float,2>{0.819933057f, 0.889595628f},
-std::array<float,2>{0.621700764f, 0.122822195f},
-std::array<float,2>{0.364492536f, 0.648715258f},
-std::array<float,2>{0.239315674f, 0.18765673f},
-std::array<float,2>{0.93544215f, 0.590102136f},
-std::array<float,2>{0.642472386f, 0.388389647f},
-std::array<float,2>{0.484631091f, 0.815345168f},
-std::array<float,2>{0.255597472f, 0.25600481f},
-std::array<float,2>{0.524104118f, 0.984709978f},
-std::array<float,2>{0.767549157f, 0.0334954746f},
-std::array<float,2>{0.058822982f, 0.697452724f},
-std::array<float,2>{0.422370046f, 0.113176942f},
-std::array<float,2>{0.694235444f, 0.644921243f},
-std::array<float,2>{0.939405799f, 0.354378372f},
-std::array<float,2>{0.169248417f, 0.875027657f},
-std::array<float,2>{0.0790809542f, 0.453540534f},
-std::array<float,2>{0.847620785f, 0.758904278f},
-std::array<float,2>{0.586310625f, 0.15490678f},
-std::array<float,2>{0.336085975f, 0.514768183f},
-std::array<float,2>{0.0283839162f, 0.0131829819f},
-std::array<float,2>{0.802260101f, 0.743825972f},
-std::array<float,2>{0.55910629f, 0.30300653f},
-std::array<float,2>{0.28541857f, 0.956537306f},
-std::array<float,2>{0.43967858f, 0.425357312f},
-std::array<float,2>{0.68248266f, 0.868935823f},
-std::array<float,2>{0.898831546f, 0.226802558f},
-std::array<float,2>{0.198976368f, 0.601863325f},
-std::array<float,2>{0.374742121f, 0.171874672f},
-std::array<float,2>{0.610779822f, 0.542392612f},
-std::array<float,2>{0.826411843f, 0.480898649f},
-std::array<float,2>{0.0968649983f, 0.782905877f},
-std::array<float,2>{0.143747494f, 0.317810595f},
-std::array<float,2>{0.987633765f, 0.932982266f},
-std::array<float,2>{0.746406317f, 0.0823110864f},
-std::array<float,2>{0.40340668f, 0.683573604f},
-std::array<float,2>{0.112126671f, 0.125230566f},
-std::array<float,2>{0.839211226f, 0.516437232f},
-std::array<float,2>{0.594049156f, 0.446543276f},
-std::array<float,2>{0.347055227f, 0.779379487f},
-std::array<float,2>{0.375661522f, 0.371571094f},
-std::array<float,2>{0.725815952f, 0.891469777f},
-std::array<float,2>{0.974203467f, 0.0999875963f},
-std::array<float,2>{0.136926115f, 0.631347537f},
-std::array<float,2>{0.302716225f, 0.0485558882f},
-std::array<float,2>{0.545179605f, 0.713444769f},
-std::array<float,2>{0.795596957f, 0.26853922f},
-std::array<float,2>{0.00805237424f, 0.982474208f},
-std::array<float,2>{0.216832221f, 0.391529322f},
-std::array<float,2>{0.886763692f, 0.842598438f},
-std::array<float,2>{0.661285222f, 0.215681523f},
-std::array<float,2>{0.467723101f, 0.566512227f},
-std::array<float,2>{0.178056657f, 0.0742632151f},
-std::array<float,2>{0.965431869f, 0.662763655f},
-std::array<float,2>{0.717457533f, 0.342595935f},
-std::array<float,2>{0.407447517f, 0.915039599f},
-std::array<float,2>{0.326537341f, 0.496868223f},
-std::array<float,2>{0.570734382f, 0.799691081f},
-std::array<float,2>{0.864616513f, 0.17664437f},
-std::array<float,2>{0.0690833405f, 0.556043923f},
-std::array<float,2>{0.471097738f, 0.24098295f},
-std::array<float,2>{0.626419246f, 0.620702028f},
-std::array<float,2>{0.90759635f, 0.414350182f},
-std::array<float,2>{0.219744742f, 0.847503662f},
-std::array<float,2>{0.0464763381f, 0.293969274f},
-std::array<float,2>{0.752062321f, 0.952122152f},
-std::array<float,2>{0.504101038f, 0.0300853141f},
-std::array<float,2>{0.270243287f, 0.734253287f},
-std::array<float,2>{0.242278963f, 0.131715372f},
-std::array<float,2>{0.928153753f, 0.519598424f},
-std::array<float,2>{0.651993334f, 0.451788396f},
-std::array<float,2>{0.492206067f, 0.775330722f},
-std::array<float,2>{0.258815765f, 0.369905889f},
-std::array<float,2>{0.51936841f, 0.894811392f},
-std::array<float,2>{0.778650582f, 0.0970208347f},
-std::array<float,2>{0.0512256138f, 0.62666899f},
-std::array<float,2>{0.433714509f, 0.0516967438f},
-std::array<float,2>{0.699106157f, 0.7184273f},
-std::array<float,2>{0.946176648f, 0.273225009f},
-std::array<float,2>{0.156351551f, 0.97663182f},
-std::array<float,2>{0.0918879658f, 0.397862703f},
-std::array<float,2>{0.852012217f, 0.838746965f},
-std::array<float,2>{0.583509982f, 0.213674501f},
-std::array<float,2>{0.330326259f, 0.563805401f},
-std::array<float,2>{0.0225837007f, 0.0736293197f},
-std::array<float,2>{0.80906558f, 0.659606457f},
-std::array<float,2>{0.551660776f, 0.337470621f},
-std::array<float,2>{0.289643705f, 0.92079097f},
-std::array<float,2>{0.453060508f, 0.492341936f},
-std::array<float,2>{0.676913679f, 0.800877035f},
-std::array<float,2>{0.893085063f, 0.173495337f},
-std::array<float,2>{0.192359805f, 0.559944689f},
-std::array<float,2>{0.360086828f, 0.234669194f},
-std::array<float,2>{0.617839277f, 0.624518037f},
-std::array<float,2>{0.815360785f, 0.4211151f},
-std::array<float,2>{0.102996349f, 0.848056674f},
-std::array<float,2>{0.151986331f, 0.291097045f},
-std::array<float,2>{0.999350488f, 0.94625169f},
-std::array<float,2>{0.73597765f, 0.025780201f},
-std::array<float,2>{0.39523232f, 0.727054119f},
-std::array<float,2>{0.122130014f, 0.195076615f},
-std::array<float,2>{0.830023646f, 0.587380111f},
-std::array<float,2>{0.607707798f, 0.385826051f},
-std::array<float,2>{0.356618017f, 0.81960392f},
-std::array<float,2>{0.388509721f, 0.25338167f},
-std::array<float,2>{0.733132601f, 0.989596367f},
-std::array<float,2>{0.982384861f, 0.0372024924f},
-std::array<float,2>{0.131948441f, 0.701330543f},
-std::array<float,2>{0.307812333f, 0.116750121f},
-std::array<float,2>{0.535997808f, 0.641614377f},
-std::array<float,2>{0.783986449f, 0.358635426f},
-std::array<float,2>{0.00475196727f, 0.879331172f},
-std::array<float,2>{0.21085164f, 0.460807711f},
-std::array<float,2>{0.879105568f, 0.764078915f},
-std::array<float,2>{0.664843678f, 0.151723981f},
-std::array<float,2>{0.45379895f, 0.510811448f},
-std::array<float,2>{0.186009079f, 0.0105562452f},
-std::array<float,2>{0.960385084f, 0.747788787f},
-std::array<float,2>{0.705664098f, 0.300624758f},
-std::array<float,2>{0.417716622f, 0.95858258f},
-std::array<float,2>{0.315975696f, 0.429092675f},
-std::array<float,2>{0.564956903f, 0.874557555f},
-std::array<float,2>{0.87159431f, 0.232046023f},
-std::array<float,2>{0.0705827922f, 0.606888533f},
-std::array<float,2>{0.477285981f, 0.165825263f},
-std::array<float,2>{0.639653265f, 0.545169592f},
-std::array<float,2>{0.917712927f, 0.47913295f},
-std::array<float,2>{0.233841836f, 0.78886199f},
-std::array<float,2>{0.031330321f, 0.314669162f},
-std::array<float,2>{0.762893915f, 0.93654561f},
-std::array<float,2>{0.511461377f, 0.0813189447f},
-std::array<float,2>{0.273904383f, 0.685182571f},
-std::array<float,2>{0.135480002f, 0.224577606f},
-std::array<float,2>{0.969859302f, 0.595294833f},
-std::array<float,2>{0.721446574f, 0.436616123f},
-std::array<float,2>{0.382356673f, 0.863602936f},
-std::array<float,2>{0.348843187f, 0.305098116f},
-std::array<float,2>{0.597730875f, 0.964334249f},
-std::array<float,2>{0.83987999f, 0.00743056647f},
-std::array<float,2>{0.115964077f, 0.736461461f},
-std::array<float,2>{0.46269387f, 0.0889107734f},
-std::array<float,2>{0.658207297f, 0.676217377f},
-std::array<float,2>{0.885522783f, 0.324429512f},
-std::array<float,2>{0.213964537f, 0.924445152f},
-std::array<float,2>{0.0117849372f, 0.471764326f},
-std::array<float,2>{0.790306211f, 0.793453515f},
-std::array<float,2>{0.542609334f, 0.156773597f},
-std::array<float,2>{0.29886952f, 0.537146866f},
-std::array<float,2>{0.0645923316f, 0.0437032096f},
-std::array<float,2>{0.860340774f, 0.689826608f},
-std::array<float,2>{0.575363576f, 0.257999212f},
-std::array<float,2>{0.323376089f, 0.995377421f},
-std::array<float,2>{0.413603991f, 0.375206262f},
-std::array<float,2>{0.713389277f, 0.826087177f},
-std::array<float,2>{0.964555264f, 0.19793956f},
-std::array<float,2>{0.173666686f, 0.584350288f},
-std::array<float,2>{0.269045353f, 0.148386851f},
-std::array<float,2>{0.501438022f, 0.505631149f},
-std::array<float,2>{0.755295992f, 0.464754671f},
-std::array<float,2>{0.0411561914f, 0.750044465f},
-std::array<float,2>{0.225020945f, 0.347589403f},
-std::array<float,2>{0.911625624f, 0.88582629f},
-std::array<float,2>{0.631385148f, 0.117744349f},
-std::array<float,2>{0.473170102f, 0.655915856f},
-std::array<float,2>{0.0563706942f, 0.184177324f},
-std::array<float,2>{0.769976556f, 0.553452313f},
-std::array<float,2>{0.529025435f, 0.49146229f},
-std::array<float,2>{0.252204984f, 0.810138822f},
-std::array<float,2>{0.490208983f, 0.333461821f},
-std::array<float,2>{0.646917105f, 0.912656963f},
-std::array<float,2>{0.932449996f, 0.0635184199f},
-std::array<float,2>{0.236801818f, 0.668563426f},
-std::array<float,2>{0.341237038f, 0.0182848293f},
-std::array<float,2>{0.59252876f, 0.719545484f},
-std::array<float,2>{0.851348937f, 0.286737353f},
-std::array<float,2>{0.0851131901f, 0.939184785f},
-std::array<float,2>{0.166464418f, 0.407408118f},
-std::array<float,2>{0.942719281f, 0.854909599f},
-std::array<float,2>{0.687855482f, 0.249782681f},
-std::array<float,2>{0.426731706f, 0.612709105f},
-std::array<float,2>{0.201364636f, 0.106525153f},
-std::array<float,2>{0.905091345f, 0.640265942f},
-std::array<float,2>{0.686996996f, 0.364091218f},
-std::array<float,2>{0.444590449f, 0.899440825f},
-std::array<float,2>{0.283642054f, 0.44297114f},
-std::array<float,2>{0.556909382f, 0.768237054f},
-std::array<float,2>{0.799098134f, 0.133177847f},
-std::array<float,2>{0.0249211472f, 0.527743936f},
-std::array<float,2>{0.399179876f, 0.209114805f},
-std::array<float,2>{0.744733572f, 0.571231186f},
-std::array<float,2>{0.989304781f, 0.399976581f},
-std::array<float,2>{0.145448208f, 0.831704497f},
-std::array<float,2>{0.0982010886f, 0.274404705f},
-std::array<float,2>{0.82075721f, 0.969748914f},
-std::array<float,2>{0.615944386f, 0.0621233322f},
-std::array<float,2>{0.368181884f, 0.705400229f},
-std::array<float,2>{0.161211669f, 0.162225515f},
-std::array<float,2>{0.952937722f, 0.5324772f},
-std::array<float,2>{0.702872097f, 0.475176573f},
-std::array<float,2>{0.432588011f, 0.790602922f},
-std::array<float,2>{0.334625572f, 0.323444068f},
-std::array<float,2>{0.580394924f, 0.929459453f},
-std::array<float,2>{0.856947005f, 0.0935822651f},
-std::array<float,2>{0.0880911425f, 0.67497611f},
-std::array<float,2>{0.496100038f, 0.00338361319f},
-std::array<float,2>{0.656095982f, 0.740337074f},
-std::array<float,2>{0.925311089f, 0.310711831f},
-std::array<float,2>{0.246960387f, 0.965404332f},
-std::array<float,2>{0.0497814156f, 0.430739969f},
-std::array<float,2>{0.774839461f, 0.861125827f},
-std::array<float,2>{0.522858262f, 0.219626382f},
-std::array<float,2>{0.265147448f, 0.598255217f},
-std::array<float,2>{0.106310509f, 0.121129468f},
-std::array<float,2>{0.817241192f, 0.650225639f},
-std::array<float,2>{0.624554217f, 0.350156188f},
-std::array<float,2>{0.366673499f, 0.889982522f},
-std::array<float,2>{0.393626332f, 0.467119515f},
-std::array<float,2>{0.741010249f, 0.757192433f},
-std::array<float,2>{0.99356699f, 0.143149316f},
-std::array<float,2>{0.155095086f, 0.50332123f},
-std::array<float,2>{0.296251118f, 0.199918583f},
-std::array<float,2>{0.549487829f, 0.579793036f},
-std::array<float,2>{0.808364272f, 0.382300109f},
-std::array<float,2>{0.0164760686f, 0.821044862f},
-std::array<float,2>{0.190515578f, 0.265144229f},
-std::array<float,2>{0.896878123f, 0.999725223f},
-std::array<float,2>{0.673090398f, 0.0404157154f},
-std::array<float,2>{0.445378929f, 0.692438245f},
-std::array<float,2>{0.00389897078f, 0.245354578f},
-std::array<float,2>{0.786214828f, 0.61529845f},
-std::array<float,2>{0.532882333f, 0.413684726f},
-std::array<float,2>{0.310322255f, 0.85818696f},
-std::array<float,2>{0.460336804f, 0.282509804f},
-std::array<float,2>{0.671766818f, 0.942367136f},
-std::array<float,2>{0.877904713f, 0.0206380431f},
-std::array<float,2>{0.205005497f, 0.726434708f},
-std::array<float,2>{0.353894353f, 0.0680189878f},
-std::array<float,2>{0.604307473f, 0.666137934f},
-std::array<float,2>{0.834195018f, 0.331186831f},
-std::array<float,2>{0.119680308f, 0.906930327f},
-std::array<float,2>{0.126665011f, 0.487953365f},
-std::array<float,2>{0.976852477f, 0.807975888f},
-std::array<float,2>{0.730115294f, 0.181874976f},
-std::array<float,2>{0.383578479f, 0.550203919f},
-std::array<float,2>{0.228956029f, 0.0584477782f},
-std::array<float,2>{0.919952929f, 0.709664583f},
-std::array<float,2>{0.635162294f, 0.279004961f},
-std::array<float,2>{0.481132209f, 0.975992501f},
-std::array<float,2>{0.278103501f, 0.405488342f},
-std::array<float,2>{0.514514029f, 0.83505398f},
-std::array<float,2>{0.761163771f, 0.206038103f},
-std::array<float,2>{0.0380111262f, 0.576003134f},
-std::array<float,2>{0.419396579f, 0.137738034f},
-std::array<float,2>{0.709604442f, 0.523462474f},
-std::array<float,2>{0.953542352f, 0.437914371f},
-std::array<float,2>{0.181507543f, 0.770014346f},
-std::array<float,2>{0.0759164616f, 0.359642386f},
-std::array<float,2>{0.868147552f, 0.904303312f},
-std::array<float,2>{0.569847465f, 0.103842445f},
-std::array<float,2>{0.319368839f, 0.634124577f},
-std::array<float,2>{0.216775328f, 0.216163516f},
-std::array<float,2>{0.889041841f, 0.568111777f},
-std::array<float,2>{0.663717866f, 0.39230144f},
-std::array<float,2>{0.466760904f, 0.843194187f},
-std::array<float,2>{0.304145783f, 0.269294053f},
-std::array<float,2>{0.543389142f, 0.984044433f},
-std::array<float,2>{0.79331243f, 0.0476827845f},
-std::array<float,2>{0.0106629524f, 0.714583457f},
-std::array<float,2>{0.377989769f, 0.101486921f},
-std::array<float,2>{0.722766519f, 0.632752776f},
-std::array<float,2>{0.976150453f, 0.372580677f},
-std::array<float,2>{0.140031874f, 0.891799212f},
-std::array<float,2>{0.111317769f, 0.445642859f},
-std::array<float,2>{0.836974561f, 0.780565917f},
-std::array<float,2>{0.597622037f, 0.126030892f},
-std::array<float,2>{0.345394075f, 0.51731509f},
-std::array<float,2>{0.0436644182f, 0.0308963601f},
-std::array<float,2>{0.750365913f, 0.732704103f},
-std::array<float,2>{0.507434607f, 0.293610364f},
-std::array<float,2>{0.273094594f, 0.952739239f},
-std::array<float,2>{0.468935698f, 0.415968448f},
-std::array<float,2>{0.627152264f, 0.84589988f},
-std::array<float,2>{0.909691453f, 0.241807759f},
-std::array<float,2>{0.221797556f, 0.61947614f},
-std::array<float,2>{0.325798571f, 0.17753695f},
-std::array<float,2>{0.573238194f, 0.554922223f},
-std::array<float,2>{0.865533173f, 0.497890413f},
-std::array<float,2>{0.0667275637f, 0.800627112f},
-std::array<float,2>{0.176201195f, 0.343413562f},
-std::array<float,2>{0.968537748f, 0.914833605f},
-std::array<float,2>{0.716075242f, 0.0756167322f},
-std::array<float,2>{0.409463376f, 0.663834333f},
-std::array<float,2>{0.0816233754f, 0.155411825f},
-std::array<float,2>{0.844376326f, 0.51431787f},
-std::array<float,2>{0.58858937f, 0.454515368f},
-std::array<float,2>{0.339449793f, 0.758256614f},
-std::array<float,2>{0.425264955f, 0.355059892f},
-std::array<float,2>{0.692756414f, 0.876393616f},
-std::array<float,2>{0.9413082f, 0.111919992f},
-std::array<float,2>{0.170057341f, 0.645634711f},
-std::array<float,2>{0.256658524f, 0.0342039354f},
-std::array<float,2>{0.526192725f, 0.699088275f},
-std::array<float,2>{0.768743813f, 0.257372439f},
-std::array<float,2>{0.0608084425f, 0.986064851f},
-std::array<float,2>{0.24097845f, 0.38702029f},
-std::array<float,2>{0.935687423f, 0.815887809f},
-std::array<float,2>{0.644417524f, 0.189290464f},
-std::array<float,2>{0.487327367f, 0.59133178f},
-std::array<float,2>{0.141498461f, 0.0835057572f},
-std::array<float,2>{0.985991716f, 0.682384908f},
-std::array<float,2>{0.749383569f, 0.316975296f},
-std::array<float,2>{0.40449211f, 0.932197928f},
-std::array<float,2>{0.371527076f, 0.482407361f},
-std::array<float,2>{0.61194545f, 0.781392992f},
-std::array<float,2>{0.824766874f, 0.17003125f},
-std::array<float,2>{0.0952740237f, 0.541171312f},
-std::array<float,2>{0.439387321f, 0.228160754f},
-std::array<float,2>{0.680640221f, 0.602905631f},
-std::array<float,2>{0.902028322f, 0.423830837f},
-std::array<float,2>{0.195351571f, 0.867904127f},
-std::array<float,2>{0.0302596949f, 0.304257601f},
-std::array<float,2>{0.804213047f, 0.955546975f},
-std::array<float,2>{0.560785294f, 0.0121783139f},
-std::array<float,2>{0.287415802f, 0.742621601f},
-std::array<float,2>{0.194532663f, 0.174387634f},
-std::array<float,2>{0.892397106f, 0.562465429f},
-std::array<float,2>{0.678777635f, 0.494327933f},
-std::array<float,2>{0.449492902f, 0.802910566f},
-std::array<float,2>{0.291334867f, 0.338202983f},
-std::array<float,2>{0.553707838f, 0.9181301f},
-std::array<float,2>{0.812016249f, 0.07214652f},
-std::array<float,2>{0.0200986173f, 0.657687187f},
-std::array<float,2>{0.396674961f, 0.0245571863f},
-std::array<float,2>{0.737146139f, 0.729768217f},
-std::array<float,2>{0.996435761f, 0.289501131f},
-std::array<float,2>{0.148662373f, 0.949129939f},
-std::array<float,2>{0.104638599f, 0.418645173f},
-std::array<float,2>{0.813664556f, 0.850789845f},
-std::array<float,2>{0.620043933f, 0.237824038f},
-std::array<float,2>{0.36140132f, 0.62198925f},
-std::array<float,2>{0.0527387299f, 0.0941494405f},
-std::array<float,2>{0.779662192f, 0.628814816f},
-std::array<float,2>{0.516294658f, 0.368507177f},
-std::array<float,2>{0.259818643f, 0.89830178f},
-std::array<float,2>{0.495244324f, 0.44942975f},
-std::array<float,2>{0.648593843f, 0.777072549f},
-std::array<float,2>{0.92599678f, 0.130765453f},
-std::array<float,2>{0.245801166f, 0.52298981f},
-std::array<float,2>{0.328700066f, 0.211985618f},
-std::array<float,2>{0.584065437f, 0.564810157f},
-std::array<float,2>{0.85459286f, 0.396114945f},
-std::array<float,2>{0.0912228003f, 0.837457716f},
-std::array<float,2>{0.15952234f, 0.270920753f},
-std::array<float,2>{0.948045552f, 0.978581131f},
-std::array<float,2>{0.695836246f, 0.0533010699f},
-std::array<float,2>{0.437301904f, 0.716369152f},
-std::array<float,2>{0.0730597377f, 0.233917817f},
-std::array<float,2>{0.873964548f, 0.607968509f},
-std::array<float,2>{0.564047039f, 0.425905496f},
-std::array<float,2>{0.313563377f, 0.87145263f},
-std::array<float,2>{0.414152473f, 0.298287243f},
-std::array<float,2>{0.70323962f, 0.96007055f},
-std::array<float,2>{0.958920896f, 0.00804637838f},
-std::array<float,2>{0.184188366f, 0.748869419f},
-std::array<float,2>{0.275930971f, 0.0787971318f},
-std::array<float,2>{0.509425879f, 0.687368035f},
-std::array<float,2>{0.765168011f, 0.313156784f},
-std::array<float,2>{0.0337231718f, 0.933734059f},
-std::array<float,2>{0.230949998f, 0.477071077f},
-std::array<float,2>{0.914482057f, 0.78543514f},
-std::array<float,2>{0.638325155f, 0.167591095f},
-std::array<float,2>{0.480453223f, 0.544639707f},
-std::array<float,2>{0.129498601f, 0.0366157331f},
-std::array<float,2>{0.983393967f, 0.699859917f},
-std::array<float,2>{0.730816603f, 0.251947939f},
-std::array<float,2>{0.390046537f, 0.990295887f},
-std::array<float,2>{0.358388752f, 0.383564651f},
-std::array<float,2>{0.605992317f, 0.817179203f},
-std::array<float,2>{0.830188751f, 0.192559689f},
-std::array<float,2>{0.123999275f, 0.588234544f},
-std::array<float,2>{0.457008302f, 0.148581222f},
-std::array<float,2>{0.666207194f, 0.50782752f},
-std::array<float,2>{0.881457567f, 0.457591444f},
-std::array<float,2>{0.20839189f, 0.761762142f},
-std::array<float,2>{0.00593203586f, 0.35721615f},
-std::array<float,2>{0.781997025f, 0.881555319f},
-std::array<float,2>{0.538743913f, 0.113665842f},
-std::array<float,2>{0.306558162f, 0.643516123f},
-std::array<float,2>{0.174712807f, 0.195385009f},
-std::array<float,2>{0.962529957f, 0.583527684f},
-std::array<float,2>{0.711510897f, 0.378290027f},
-std::array<float,2>{0.41115734f, 0.82657361f},
-std::array<float,2>{0.321897894f, 0.261211872f},
-std::array<float,2>{0.576420903f, 0.992259622f},
-std::array<float,2>{0.862716198f, 0.0456151031f},
-std::array<float,2>{0.0637644827f, 0.688868761f},
-std::array<float,2>{0.47615537f, 0.119218938f},
-std::array<float,2>{0.630110145f, 0.653070748f},
-std::array<float,2>{0.913913012f, 0.343946338f},
-std::array<float,2>{0.223456651f, 0.884735584f},
-std::array<float,2>{0.0401163585f, 0.462814391f},
-std::array<float,2>{0.757757008f, 0.753329813f},
-std::array<float,2>{0.503474951f, 0.14602226f},
-std::array<float,2>{0.26742366f, 0.507414997f},
-std::array<float,2>{0.114313543f, 0.0046345857f},
-std::array<float,2>{0.842876911f, 0.734413028f},
-std::array<float,2>{0.600017846f, 0.307269484f},
-std::array<float,2>{0.349851906f, 0.961166024f},
-std::array<float,2>{0.380043983f, 0.434148252f},
-std::array<float,2>{0.719009399f, 0.867106318f},
-std::array<float,2>{0.971681952f, 0.225913078f},
-std::array<float,2>{0.133898959f, 0.596879482f},
-std::array<float,2>{0.298212349f, 0.159221277f},
-std::array<float,2>{0.540226758f, 0.536155581f},
-std::array<float,2>{0.792337298f, 0.470542789f},
-std::array<float,2>{0.0139506375f, 0.796372056f},
-std::array<float,2>{0.211905569f, 0.327474982f},
-std::array<float,2>{0.883356512f, 0.923190236f},
-std::array<float,2>{0.656605721f, 0.0860954151f},
-std::array<float,2>{0.46365419f, 0.67904079f},
-std::array<float,2>{0.0260974243f, 0.134981677f},
-std::array<float,2>{0.798490465f, 0.530315757f},
-std::array<float,2>{0.555424809f, 0.443602085f},
-std::array<float,2>{0.282764286f, 0.766547143f},
-std::array<float,2>{0.44306162f, 0.367168128f},
-std::array<float,2>{0.684493601f, 0.901642263f},
-std::array<float,2>{0.904162765f, 0.108535841f},
-std::array<float,2>{0.199582845f, 0.637997925f},
-std::array<float,2>{0.370777875f, 0.0595333464f},
-std::array<float,2>{0.613397956f, 0.704671919f},
-std::array<float,2>{0.823144317f, 0.275714278f},
-std::array<float,2>{0.101279661f, 0.972488761f},
-std::array<float,2>{0.148387745f, 0.400839001f},
-std::array<float,2>{0.991895378f, 0.828748524f},
-std::array<float,2>{0.743047595f, 0.207242489f},
-std::array<float,2>{0.401164651f, 0.572681189f},
-std::array<float,2>{0.235427275f, 0.0654296353f},
-std::array<float,2>{0.930066466f, 0.671424747f},
-std::array<float,2>{0.644628644f, 0.335340142f},
-std::array<float,2>{0.491272122f, 0.911005139f},
-std::array<float,2>{0.251709819f, 0.490169495f},
-std::array<float,2>{0.531059682f, 0.81156075f},
-std::array<float,2>{0.772493064f, 0.186319828f},
-std::array<float,2>{0.0571588725f, 0.551709354f},
-std::array<float,2>{0.42956695f, 0.246274784f},
-std::array<float,2>{0.690496624f, 0.609535635f},
-std::array<float,2>{0.945219338f, 0.408391654f},
-std::array<float,2>{0.1651683f, 0.852090478f},
-std::array<float,2>{0.0820487291f, 0.288851649f},
-std::array<float,2>{0.848990262f, 0.939569414f},
-std::array<float,2>{0.591518998f, 0.0173950009f},
-std::array<float,2>{0.342569351f, 0.721056938f},
-std::array<float,2>{0.153855041f, 0.14221561f},
-std::array<float,2>{0.994855106f, 0.500779569f},
-std::array<float,2>{0.739946067f, 0.465783894f},
-std::array<float,2>{0.391513526f, 0.755245328f},
-std::array<float,2>{0.364104241f, 0.347996444f},
-std::array<float,2>{0.622836471f, 0.888280332f},
-std::array<float,2>{0.818629801f, 0.123314112f},
-std::array<float,2>{0.108344749f, 0.6515674f},
-std::array<float,2>{0.447411776f, 0.0412278809f},
-std::array<float,2>{0.67508918f, 0.695215166f},
-std::array<float,2>{0.894616187f, 0.261854708f},
-std::array<float,2>{0.189294726f, 0.997999251f},
-std::array<float,2>{0.0189069398f, 0.378947556f},
-std::array<float,2>{0.80637753f, 0.823506415f},
-std::array<float,2>{0.548558593f, 0.202939928f},
-std::array<float,2>{0.294796526f, 0.581449568f},
-std::array<float,2>{0.0862430185f, 0.0906952098f},
-std::array<float,2>{0.858659744f, 0.673624277f},
-std::array<float,2>{0.578477144f, 0.320698053f},
-std::array<float,2>{0.332951695f, 0.926647782f},
-std::array<float,2>{0.430901557f, 0.473246157f},
-std::array<float,2>{0.700680315f, 0.791073561f},
-std::array<float,2>{0.950967312f, 0.161069438f},
-std::array<float,2>{0.163453966f, 0.533847749f},
-std::array<float,2>{0.261940539f, 0.22190921f},
-std::array<float,2>{0.520202816f, 0.599918783f},
-std::array<float,2>{0.775470972f, 0.432994604f},
-std::array<float,2>{0.0485675856f, 0.862686217f},
-std::array<float,2>{0.249241084f, 0.310521603f},
-std::array<float,2>{0.922295511f, 0.968038499f},
-std::array<float,2>{0.65410161f, 0.00181346189f},
-std::array<float,2>{0.499414206f, 0.738476157f},
-std::array<float,2>{0.0355916768f, 0.203938007f},
-std::array<float,2>{0.759075046f, 0.576974154f},
-std::array<float,2>{0.512990296f, 0.402798414f},
-std::array<float,2>{0.281072915f, 0.833217621f},
-std::array<float,2>{0.482572407f, 0.27950418f},
-std::array<float,2>{0.634106219f, 0.97404182f},
-std::array<float,2>{0.918465495f, 0.0553568788f},
-std::array<float,2>{0.22760053f, 0.707252562f},
-std::array<float,2>{0.317991853f, 0.10283912f},
-std::array<float,2>{0.568008065f, 0.635518789f},
-std::array<float,2>{0.870491147f, 0.362159163f},
-std::array<float,2>{0.0775715709f, 0.903635979f},
-std::array<float,2>{0.18357487f, 0.440074027f},
-std::array<float,2>{0.95533371f, 0.772073865f},
-std::array<float,2>{0.708139956f, 0.140600249f},
-std::array<float,2>{0.420908242f, 0.527107537f},
-std::array<float,2>{0.205876306f, 0.0221522991f},
-std::array<float,2>{0.876069784f, 0.72310257f},
-std::array<float,2>{0.669888496f, 0.284649551f},
-std::array<float,2>{0.458914757f, 0.945103705f},
-std::array<float,2>{0.312112868f, 0.41141662f},
-std::array<float,2>{0.534501076f, 0.85611856f},
-std::array<float,2>{0.788879573f, 0.242586747f},
-std::array<float,2>{0.00147021795f, 0.615047276f},
-std::array<float,2>{0.386627883f, 0.180241331f},
-std::array<float,2>{0.728348076f, 0.5482921f},
-std::array<float,2>{0.980302155f, 0.484678328f},
-std::array<float,2>{0.127971023f, 0.805294693f},
-std::array<float,2>{0.118033171f, 0.329818875f},
-std::array<float,2>{0.8329795f, 0.908742607f},
-std::array<float,2>{0.603199005f, 0.0698425099f},
-std::array<float,2>{0.352885514f, 0.664200544f},
-std::array<float,2>{0.218956366f, 0.239285618f},
-std::array<float,2>{0.906398177f, 0.617997408f},
-std::array<float,2>{0.625358045f, 0.41651091f},
-std::array<float,2>{0.472388566f, 0.845586061f},
-std::array<float,2>{0.270591229f, 0.296158552f},
-std::array<float,2>{0.505421937f, 0.950495303f},
-std::array<float,2>{0.752940297f, 0.027992174f},
-std::array<float,2>{0.0452034995f, 0.731380045f},
-std::array<float,2>{0.406437397f, 0.0766176805f},
-std::array<float,2>{0.717952073f, 0.662072003f},
-std::array<float,2>{0.966220438f, 0.340604872f},
-std::array<float,2>{0.178935036f, 0.916442931f},
-std::array<float,2>{0.0702471361f, 0.499863803f},
-std::array<float,2>{0.863576591f, 0.798465014f},
-std::array<float,2>{0.571314216f, 0.179588467f},
-std::array<float,2>{0.327721745f, 0.557064533f},
-std::array<float,2>{0.0097071398f, 0.0498971827f},
-std::array<float,2>{0.796010733f, 0.711969197f},
-std::array<float,2>{0.546245933f, 0.266018301f},
-std::array<float,2>{0.30092603f, 0.981382012f},
-std::array<float,2>{0.468641669f, 0.392581344f},
-std::array<float,2>{0.660725415f, 0.840650022f},
-std::array<float,2>{0.888231814f, 0.218478516f},
-std::array<float,2>{0.21839489f, 0.569726348f},
-std::array<float,2>{0.346488327f, 0.128162324f},
-std::array<float,2>{0.59547472f, 0.519528925f},
-std::array<float,2>{0.838078141f, 0.448300153f},
-std::array<float,2>{0.113247082f, 0.77741766f},
-std::array<float,2>{0.137886733f, 0.373160869f},
-std::array<float,2>{0.97362721f, 0.893967748f},
-std::array<float,2>{0.724995136f, 0.0978274271f},
-std::array<float,2>{0.376103044f, 0.62938416f},
-std::array<float,2>{0.0957895368f, 0.169017151f},
-std::array<float,2>{0.8280527f, 0.540523887f},
-std::array<float,2>{0.60955435f, 0.483777821f},
-std::array<float,2>{0.373244077f, 0.783352017f},
-std::array<float,2>{0.402674198f, 0.318585604f},
-std::array<float,2>{0.747801483f, 0.930580795f},
-std::array<float,2>{0.987246573f, 0.0844509304f},
-std::array<float,2>{0.14300631f, 0.681156576f},
-std::array<float,2>{0.28688699f, 0.0146528939f},
-std::array<float,2>{0.559975088f, 0.745221019f},
-std::array<float,2>{0.801076472f, 0.301662266f},
-std::array<float,2>{0.0276362877f, 0.95427829f},
-std::array<float,2>{0.1975604f, 0.42376557f},
-std::array<float,2>{0.900327563f, 0.870198011f},
-std::array<float,2>{0.683067083f, 0.229939476f},
-std::array<float,2>{0.440686673f, 0.60361737f},
-std::array<float,2>{0.168519795f, 0.109948806f},
-std::array<float,2>{0.938228548f, 0.648046076f},
-std::array<float,2>{0.694636941f, 0.353190094f},
-std::array<float,2>{0.423175812f, 0.87714833f},
-std::array<float,2>{0.33716476f, 0.456602722f},
-std::array<float,2>{0.587335646f, 0.761008441f},
-std::array<float,2>{0.846505046f, 0.153631359f},
-std::array<float,2>{0.0792411864f, 0.512603045f},
-std::array<float,2>{0.485721737f, 0.190572262f},
-std::array<float,2>{0.641351759f, 0.593644083f},
-std::array<float,2>{0.934239864f, 0.38914606f},
-std::array<float,2>{0.238596976f, 0.812852085f},
-std::array<float,2>{0.0600996539f, 0.254150838f},
-std::array<float,2>{0.765692353f, 0.986895323f},
-std::array<float,2>{0.524798155f, 0.0317509957f},
-std::array<float,2>{0.254092127f, 0.695395589f},
-std::array<float,2>{0.237000093f, 0.18564418f},
-std::array<float,2>{0.932124972f, 0.55086571f},
-std::array<float,2>{0.647099853f, 0.489439636f},
-std::array<float,2>{0.489618987f, 0.812314391f},
-std::array<float,2>{0.252701491f, 0.335767001f},
-std::array<float,2>{0.528381884f, 0.910202086f},
-std::array<float,2>{0.770357132f, 0.0645616874f},
-std::array<float,2>{0.0560966954f, 0.671298862f},
-std::array<float,2>{0.426251084f, 0.0170232318f},
-std::array<float,2>{0.688134491f, 0.721304357f},
-std::array<float,2>{0.943264186f, 0.288350463f},
-std::array<float,2>{0.166636303f, 0.940000951f},
-std::array<float,2>{0.0856887698f, 0.40902701f},
-std::array<float,2>{0.851020038f, 0.851644635f},
-std::array<float,2>{0.592146337f, 0.246718705f},
-std::array<float,2>{0.341712594f, 0.610078454f},
-std::array<float,2>{0.024831336f, 0.109039962f},
-std::array<float,2>{0.799776316f, 0.638186336f},
-std::array<float,2>{0.557256639f, 0.366473138f},
-std::array<float,2>{0.284092963f, 0.902234912f},
-std::array<float,2>{0.444899023f, 0.444317132f},
-std::array<float,2>{0.687323272f, 0.765644372f},
-std::array<float,2>{0.904712021f, 0.135464579f},
-std::array<float,2>{0.201672703f, 0.530941427f},
-std::array<float,2>{0.36889258f, 0.207547039f},
-std::array<float,2>{0.615297735f, 0.573037267f},
-std::array<float,2>{0.82111305f, 0.401052982f},
-std::array<float,2>{0.0978134871f, 0.828492045f},
-std::array<float,2>{0.144561142f, 0.275948673f},
-std::array<float,2>{0.989836037f, 0.971990347f},
-std::array<float,2>{0.744381607f, 0.0587210171f},
-std::array<float,2>{0.398551464f, 0.704496443f},
-std::array<float,2>{0.115641303f, 0.226499349f},
-std::array<float,2>{0.840754032f, 0.597413957f},
-std::array<float,2>{0.59836483f, 0.433886707f},
-std::array<float,2>{0.349525422f, 0.866534889f},
-std::array<float,2>{0.381885678f, 0.306811154f},
-std::array<float,2>{0.72118479f, 0.961474478f},
-std::array<float,2>{0.970557094f, 0.00423113629f},
-std::array<float,2>{0.135248289f, 0.735094965f},
-std::array<float,2>{0.299723029f, 0.0866201743f},
-std::array<float,2>{0.542069376f, 0.679427028f},
-std::array<float,2>{0.791015208f, 0.327948183f},
-std::array<float,2>{0.012509889f, 0.923410773f},
-std::array<float,2>{0.21439369f, 0.470088571f},
-std::array<float,2>{0.884885728f, 0.796464682f},
-std::array<float,2>{0.659157991f, 0.16002655f},
-std::array<float,2>{0.462324947f, 0.536985993f},
-std::array<float,2>{0.173157528f, 0.0452802852f},
-std::array<float,2>{0.964020669f, 0.689441085f},
-std::array<float,2>{0.713031828f, 0.261359036f},
-std::array<float,2>{0.413138509f, 0.993124187f},
-std::array<float,2>{0.324025154f, 0.378855735f},
-std::array<float,2>{0.575936615f, 0.826818645f},
-std::array<float,2>{0.859650135f, 0.19600293f},
-std::array<float,2>{0.0651549771f, 0.583157003f},
-std::array<float,2>{0.473122835f, 0.145694181f},
-std::array<float,2>{0.630886972f, 0.507216334f},
-std::array<float,2>{0.911180675f, 0.462180436f},
-std::array<float,2>{0.225405753f, 0.753823221f},
-std::array<float,2>{0.0419718809f, 0.344443679f},
-std::array<float,2>{0.755757928f, 0.884090126f},
-std::array<float,2>{0.501819551f, 0.119719505f},
-std::array<float,2>{0.268873155f, 0.652359962f},
-std::array<float,2>{0.132454664f, 0.192954525f},
-std::array<float,2>{0.981598556f, 0.588772297f},
-std::array<float,2>{0.732685149f, 0.383037865f},
-std::array<float,2>{0.387940377f, 0.816753745f},
-std::array<float,2>{0.357264757f, 0.251232713f},
-std::array<float,2>{0.608191609f, 0.990815103f},
-std::array<float,2>{0.82942462f, 0.0369250923f},
-std::array<float,2>{0.122870535f, 0.699520826f},
-std::array<float,2>{0.453484148f, 0.114106447f},
-std::array<float,2>{0.664205015f, 0.642963529f},
-std::array<float,2>{0.879423976f, 0.356497228f},
-std::array<float,2>{0.210344478f, 0.881026506f},
-std::array<float,2>{0.00416437024f, 0.45736286f},
-std::array<float,2>{0.783551812f, 0.762660325f},
-std::array<float,2>{0.535289466f, 0.149299622f},
-std::array<float,2>{0.308108717f, 0.508738458f},
-std::array<float,2>{0.0712105632f, 0.00855641719f},
-std::array<float,2>{0.871356368f, 0.748286188f},
-std::array<float,2>{0.56475836f, 0.298773646f},
-std::array<float,2>{0.315911591f, 0.960888863f},
-std::array<float,2>{0.417203993f, 0.426696181f},
-std::array<float,2>{0.70541954f, 0.871600389f},
-std::array<float,2>{0.960928619f, 0.233883142f},
-std::array<float,2>{0.186260819f, 0.607682049f},
-std::array<float,2>{0.274308383f, 0.167196795f},
-std::array<float,2>{0.510767162f, 0.544348061f},
-std::array<float,2>{0.763303757f, 0.476620615f},
-std::array<float,2>{0.032184124f, 0.785861313f},
-std::array<float,2>{0.23403956f, 0.312776148f},
-std::array<float,2>{0.917141199f, 0.934470832f},
-std::array<float,2>{0.64061451f, 0.0782294497f},
-std::array<float,2>{0.476768166f, 0.686834097f},
-std::array<float,2>{0.0514065623f, 0.129978046f},
-std::array<float,2>{0.778895855f, 0.522938192f},
-std::array<float,2>{0.518761873f, 0.449945271f},
-std::array<float,2>{0.259533077f, 0.776385963f},
-std::array<float,2>{0.492944121f, 0.368741333f},
-std::array<float,2>{0.651546776f, 0.897773266f},
-std::array<float,2>{0.928636193f, 0.0947031826f},
-std::array<float,2>{0.242811233f, 0.628274858f},
-std::array<float,2>{0.331014395f, 0.0527852178f},
-std::array<float,2>{0.583344162f, 0.715850532f},
-std::array<float,2>{0.85213089f, 0.27114895f},
-std::array<float,2>{0.092738539f, 0.979246795f},
-std::array<float,2>{0.15682058f, 0.395632774f},
-std::array<float,2>{0.945778728f, 0.837284625f},
-std::array<float,2>{0.698291004f, 0.212608963f},
-std::array<float,2>{0.434327483f, 0.565164864f},
-std::array<float,2>{0.191521242f, 0.0717546046f},
-std::array<float,2>{0.892903328f, 0.657895088f},
-std::array<float,2>{0.677432299f, 0.338839382f},
-std::array<float,2>{0.452352047f, 0.918554604f},
-std::array<float,2>{0.289267719f, 0.494841248f},
-std::array<float,2>{0.550809205f, 0.803654432f},
-std::array<float,2>{0.809125006f, 0.174105808f},
-std::array<float,2>{0.0232387539f, 0.561810732f},
-std::array<float,2>{0.394615293f, 0.237476096f},
-std::array<float,2>{0.735720158f, 0.621488869f},
-std::array<float,2>{0.999648213f, 0.418063372f},
-std::array<float,2>{0.151650608f, 0.85128665f},
-std::array<float,2>{0.103134811f, 0.289816022f},
-std::array<float,2>{0.814842761f, 0.948530018f},
-std::array<float,2>{0.617464066f, 0.0252578892f},
-std::array<float,2>{0.359716386f, 0.730040252f},
-std::array<float,2>{0.170575455f, 0.153817534f},
-std::array<float,2>{0.9405756f, 0.512183666f},
-std::array<float,2>{0.693039715f, 0.456196278f},
-std::array<float,2>{0.425620705f, 0.761514187f},
-std::array<float,2>{0.339093745f, 0.35273239f},
-std::array<float,2>{0.588166595f, 0.877550781f},
-std::array<float,2>{0.843895912f, 0.109842576f},
-std::array<float,2>{0.0811649486f, 0.647883654f},
-std::array<float,2>{0.487946689f, 0.0316918343f},
-std::array<float,2>{0.643948853f, 0.696205318f},
-std::array<float,2>{0.93635571f, 0.254855871f},
-std::array<float,2>{0.240523398f, 0.986629546f},
-std::array<float,2>{0.0610679984f, 0.389268428f},
-std::array<float,2>{0.769223869f, 0.813298762f},
-std::array<float,2>{0.525550067f, 0.191348374f},
-std::array<float,2>{0.256209433f, 0.592793822f},
-std::array<float,2>{0.0948882848f, 0.0845237225f},
-std::array<float,2>{0.824425459f, 0.680721164f},
-std::array<float,2>{0.611384392f, 0.319261223f},
-std::array<float,2>{0.371787131f, 0.930054307f},
-std::array<float,2>{0.40523693f, 0.484007448f},
-std::array<float,2>{0.74996382f, 0.784124672f},
-std::array<float,2>{0.985502601f, 0.169654876f},
-std::array<float,2>{0.140944868f, 0.540884376f},
-std::array<float,2>{0.287996352f, 0.230189666f},
-std::array<float,2>{0.561086953f, 0.60416311f},
-std::array<float,2>{0.803735435f, 0.423238248f},
-std::array<float,2>{0.0293676332f, 0.870725989f},
-std::array<float,2>{0.196092084f, 0.300887495f},
-std::array<float,2>{0.901592731f, 0.954656243f},
-std::array<float,2>{0.679860115f, 0.0152493278f},
-std::array<float,2>{0.43886593f, 0.745824039f},
-std::array<float,2>{0.00983843859f, 0.217950031f},
-std::array<float,2>{0.79371655f, 0.570229471f},
-std::array<float,2>{0.54390347f, 0.393090636f},
-std::array<float,2>{0.304579169f, 0.840233207f},
-std::array<float,2>{0.466147572f, 0.266326755f},
-std::array<float,2>{0.66327107f, 0.980531693f},
-std::array<float,2>{0.889549792f, 0.0506412126f},
-std::array<float,2>{0.215871856f, 0.712801099f},
-std::array<float,2>{0.344881594f, 0.0982407555f},
-std::array<float,2>{0.597126901f, 0.629879415f},
-std::array<float,2>{0.837454379f, 0.373568296f},
-std::array<float,2>{0.110637806f, 0.894106209f},
-std::array<float,2>{0.140338257f, 0.449208736f},
-std::array<float,2>{0.97581774f, 0.777989864f},
-std::array<float,2>{0.723443687f, 0.128849536f},
-std::array<float,2>{0.378888041f, 0.518826187f},
-std::array<float,2>{0.222332478f, 0.0275426488f},
-std::array<float,2>{0.909498394f, 0.730591655f},
-std::array<float,2>{0.627897322f, 0.296670347f},
-std::array<float,2>{0.469483167f, 0.950831413f},
-std::array<float,2>{0.272631407f, 0.416056365f},
-std::array<float,2>{0.507172287f, 0.844959021f},
-std::array<float,2>{0.750825047f, 0.239912391f},
-std::array<float,2>{0.0433703698f, 0.617211938f},
-std::array<float,2>{0.409958124f, 0.178958967f},
-std::array<float,2>{0.716692507f, 0.557173431f},
-std::array<float,2>{0.968076706f, 0.499488264f},
-std::array<float,2>{0.176332563f, 0.798286498f},
-std::array<float,2>{0.067251727f, 0.340217859f},
-std::array<float,2>{0.866208017f, 0.91654706f},
-std::array<float,2>{0.572593272f, 0.0770000592f},
-std::array<float,2>{0.325348496f, 0.661596119f},
-std::array<float,2>{0.204359531f, 0.242847279f},
-std::array<float,2>{0.877133429f, 0.614412963f},
-std::array<float,2>{0.670988739f, 0.41178295f},
-std::array<float,2>{0.460759193f, 0.855490804f},
-std::array<float,2>{0.309927732f, 0.284797758f},
-std::array<float,2>{0.532235861f, 0.944768727f},
-std::array<float,2>{0.786794484f, 0.0218462497f},
-std::array<float,2>{0.00303314626f, 0.723487675f},
-std::array<float,2>{0.383089989f, 0.0693830177f},
-std::array<float,2>{0.729869664f, 0.66472441f},
-std::array<float,2>{0.97715503f, 0.329578489f},
-std::array<float,2>{0.126069203f, 0.908577621f},
-std::array<float,2>{0.11934834f, 0.485137403f},
-std::array<float,2>{0.834846139f, 0.804698169f},
-std::array<float,2>{0.603539109f, 0.179899856f},
-std::array<float,2>{0.35405311f, 0.548720717f},
-std::array<float,2>{0.0375276171f, 0.0550668873f},
-std::array<float,2>{0.761435509f, 0.707884908f},
-std::array<float,2>{0.514045f, 0.279986382f},
-std::array<float,2>{0.277496368f, 0.974337757f},
-std::array<float,2>{0.480711639f, 0.403198719f},
-std::array<float,2>{0.635279775f, 0.833734155f},
-std::array<float,2>{0.92056334f, 0.203456774f},
-std::array<float,2>{0.229110301f, 0.576181293f},
-std::array<float,2>{0.319999546f, 0.139661208f},
-std::array<float,2>{0.569704354f, 0.526409507f},
-std::array<float,2>{0.867254198f, 0.43960765f},
-std::array<float,2>{0.0753381178f, 0.771777868f},
-std::array<float,2>{0.180784509f, 0.361704946f},
-std::array<float,2>{0.9538849f, 0.903960705f},
-std::array<float,2>{0.709112346f, 0.103447303f},
-std::array<float,2>{0.41969642f, 0.635139644f},
-std::array<float,2>{0.0887266994f, 0.160603881f},
-std::array<float,2>{0.856488407f, 0.533605456f},
-std::array<float,2>{0.580944717f, 0.4726789f},
-std::array<float,2>{0.334099144f, 0.791674078f},
-std::array<float,2>{0.43167749f, 0.320805728f},
-std::array<float,2>{0.702171445f, 0.925856888f},
-std::array<float,2>{0.952426136f, 0.0903173313f},
-std::array<float,2>{0.161625102f, 0.673104465f},
-std::array<float,2>{0.264893472f, 0.00107499084f},
-std::array<float,2>{0.523228347f, 0.739233077f},
-std::array<float,2>{0.774949729f, 0.309606314f},
-std::array<float,2>{0.0493009873f, 0.968346536f},
-std::array<float,2>{0.246109918f, 0.433316857f},
-std::array<float,2>{0.925233603f, 0.862971842f},
-std::array<float,2>{0.65549165f, 0.222329885f},
-std::array<float,2>{0.496959209f, 0.600496352f},
-std::array<float,2>{0.154335991f, 0.123606488f},
-std::array<float,2>{0.993743956f, 0.651954055f},
-std::array<float,2>{0.740234852f, 0.348182052f},
-std::array<float,2>{0.394118726f, 0.887846053f},
-std::array<float,2>{0.367144883f, 0.465267509f},
-std::array<float,2>{0.624481201f, 0.755400181f},
-std::array<float,2>{0.816498518f, 0.142051727f},
-std::array<float,2>{0.105792969f, 0.500017643f},
-std::array<float,2>{0.445847064f, 0.202407286f},
-std::array<float,2>{0.673350513f, 0.581883252f},
-std::array<float,2>{0.897127151f, 0.379638702f},
-std::array<float,2>{0.191325158f, 0.82418716f},
-std::array<float,2>{0.0157457441f, 0.262305349f},
-std::array<float,2>{0.807622552f, 0.997097611f},
-std::array<float,2>{0.549155474f, 0.0417111404f},
-std::array<float,2>{0.296453536f, 0.694518447f},
-std::array<float,2>{0.200010255f, 0.133684263f},
-std::array<float,2>{0.903339207f, 0.528021514f},
-std::array<float,2>{0.683619678f, 0.442713082f},
-std::array<float,2>{0.442826927f, 0.767855108f},
-std::array<float,2>{0.282550216f, 0.363295406f},
-std::array<float,2>{0.555117071f, 0.900242686f},
-std::array<float,2>{0.798053145f, 0.107040241f},
-std::array<float,2>{0.0255524665f, 0.640112579f},
-std::array<float,2>{0.400781721f, 0.0617621653f},
-std::array<float,2>{0.742494226f, 0.705881059f},
-std::array<float,2>{0.991472065f, 0.273730576f},
-std::array<float,2>{0.147717804f, 0.970561206f},
-std::array<float,2>{0.100750923f, 0.399741381f},
-std::array<float,2>{0.82235831f, 0.831529856f},
-std::array<float,2>{0.613964438f, 0.209838226f},
-std::array<float,2>{0.370182365f, 0.570702791f},
-std::array<float,2>{0.0566672496f, 0.0639843866f},
-std::array<float,2>{0.773386359f, 0.668217301f},
-std::array<float,2>{0.530536056f, 0.333681315f},
-std::array<float,2>{0.251386672f, 0.912573397f},
-std::array<float,2>{0.491767794f, 0.491996258f},
-std::array<float,2>{0.645487726f, 0.809583783f},
-std::array<float,2>{0.930277288f, 0.18407993f},
-std::array<float,2>{0.236156419f, 0.552922964f},
-std::array<float,2>{0.341826528f, 0.249051139f},
-std::array<float,2>{0.590941489f, 0.612925828f},
-std::array<float,2>{0.849589229f, 0.407800704f},
-std::array<float,2>{0.0828822181f, 0.855114698f},
-std::array<float,2>{0.165894508f, 0.286620378f},
-std::array<float,2>{0.944691002f, 0.938794494f},
-std::array<float,2>{0.691322982f, 0.0178981442f},
-std::array<float,2>{0.428815365f, 0.718972921f},
-std::array<float,2>{0.0643293411f, 0.197497085f},
-std::array<float,2>{0.86304152f, 0.584636867f},
-std::array<float,2>{0.577111721f, 0.375724345f},
-std::array<float,2>{0.321764261f, 0.825508177f},
-std::array<float,2>{0.411782801f, 0.258737326f},
-std::array<float,2>{0.711019993f, 0.995757461f},
-std::array<float,2>{0.962206781f, 0.0430435501f},
-std::array<float,2>{0.174290091f, 0.690392077f},
-std::array<float,2>{0.266610235f, 0.1175531f},
-std::array<float,2>{0.503250599f, 0.655720592f},
-std::array<float,2>{0.757023036f, 0.34713009f},
-std::array<float,2>{0.0409021825f, 0.886459649f},
-std::array<float,2>{0.223091349f, 0.464094698f},
-std::array<float,2>{0.913487613f, 0.750698984f},
-std::array<float,2>{0.630816162f, 0.147947788f},
-std::array<float,2>{0.476062268f, 0.505322099f},
-std::array<float,2>{0.13463904f, 0.00714331353f},
-std::array<float,2>{0.972563982f, 0.73712939f},
-std::array<float,2>{0.719464421f, 0.305461407f},
-std::array<float,2>{0.380560338f, 0.964712977f},
-std::array<float,2>{0.350534886f, 0.43742615f},
-std::array<float,2>{0.600117624f, 0.864215016f},
-std::array<float,2>{0.843581736f, 0.223927423f},
-std::array<float,2>{0.114977121f, 0.594738126f},
-std::array<float,2>{0.462931126f, 0.15625608f},
-std::array<float,2>{0.65675354f, 0.537893713f},
-std::array<float,2>{0.883259952f, 0.472336829f},
-std::array<float,2>{0.21105285f, 0.793566406f},
-std::array<float,2>{0.0142574869f, 0.324988991f},
-std::array<float,2>{0.792873085f, 0.92414546f},
-std::array<float,2>{0.540944278f, 0.0898308307f},
-std::array<float,2>{0.298805028f, 0.676365733f},
-std::array<float,2>{0.183832139f, 0.231807679f},
-std::array<float,2>{0.958331645f, 0.607006013f},
-std::array<float,2>{0.703971624f, 0.429475605f},
-std::array<float,2>{0.414628029f, 0.874429286f},
-std::array<float,2>{0.31433925f, 0.300281525f},
-std::array<float,2>{0.563851893f, 0.958108485f},
-std::array<float,2>{0.873370349f, 0.00993085839f},
-std::array<float,2>{0.0724862069f, 0.747277081f},
-std::array<float,2>{0.479890496f, 0.0819840804f},
-std::array<float,2>{0.637998641f, 0.684679508f},
-std::array<float,2>{0.91479212f, 0.314972401f},
-std::array<float,2>{0.231120214f, 0.937400579f},
-std::array<float,2>{0.0332652405f, 0.478532523f},
-std::array<float,2>{0.765080333f, 0.788395822f},
-std::array<float,2>{0.508817017f, 0.165218785f},
-std::array<float,2>{0.275846303f, 0.545638323f},
-std::array<float,2>{0.123063728f, 0.0380389541f},
-std::array<float,2>{0.830568254f, 0.701991439f},
-std::array<float,2>{0.605649471f, 0.253731728f},
-std::array<float,2>{0.357727259f, 0.990034282f},
-std::array<float,2>{0.390392661f, 0.386390984f},
-std::array<float,2>{0.731298745f, 0.820019066f},
-std::array<float,2>{0.982690394f, 0.194567084f},
-std::array<float,2>{0.129170284f, 0.58776027f},
-std::array<float,2>{0.305695385f, 0.152321592f},
-std::array<float,2>{0.538112521f, 0.51150471f},
-std::array<float,2>{0.781323612f, 0.460409731f},
-std::array<float,2>{0.00645624986f, 0.764312863f},
-std::array<float,2>{0.208963647f, 0.359086752f},
-std::array<float,2>{0.881318748f, 0.879612327f},
-std::array<float,2>{0.666801631f, 0.116303913f},
-std::array<float,2>{0.456094503f, 0.642452538f},
-std::array<float,2>{0.0197158884f, 0.173040584f},
-std::array<float,2>{0.811917543f, 0.560215354f},
-std::array<float,2>{0.552984357f, 0.493096739f},
-std::array<float,2>{0.291713119f, 0.801703811f},
-std::array<float,2>{0.449733704f, 0.337384015f},
-std::array<float,2>{0.679258287f, 0.920059323f},
-std::array<float,2>{0.891801894f, 0.0740002245f},
-std::array<float,2>{0.19524996f, 0.659705579f},
-std::array<float,2>{0.362206101f, 0.0263444427f},
-std::array<float,2>{0.619548619f, 0.726870775f},
-std::array<float,2>{0.814450741f, 0.291985899f},
-std::array<float,2>{0.105282068f, 0.945383489f},
-std::array<float,2>{0.148950279f, 0.421474248f},
-std::array<float,2>{0.997054875f, 0.848278582f},
-std::array<float,2>{0.736453176f, 0.235123903f},
-std::array<float,2>{0.39710629f, 0.624311268f},
-std::array<float,2>{0.245430961f, 0.0972396135f},
-std::array<float,2>{0.926489234f, 0.626289725f},
-std::array<float,2>{0.649248779f, 0.369424343f},
-std::array<float,2>{0.4957003f, 0.895046949f},
-std::array<float,2>{0.26070717f, 0.451643646f},
-std::array<float,2>{0.515836835f, 0.774517775f},
-std::array<float,2>{0.78010267f, 0.131226644f},
-std::array<float,2>{0.0535844639f, 0.520280004f},
-std::array<float,2>{0.436851203f, 0.213051975f},
-std::array<float,2>{0.695424438f, 0.564452648f},
-std::array<float,2>{0.947685719f, 0.398212194f},
-std::array<float,2>{0.159829319f, 0.838182807f},
-std::array<float,2>{0.0915369391f, 0.272630185f},
-std::array<float,2>{0.85503453f, 0.977419972f},
-std::array<float,2>{0.584614336f, 0.0509990044f},
-std::array<float,2>{0.328400642f, 0.718019068f},
-std::array<float,2>{0.143519297f, 0.170760483f},
-std::array<float,2>{0.986485243f, 0.541761875f},
-std::array<float,2>{0.747110903f, 0.481825769f},
-std::array<float,2>{0.403276592f, 0.781917274f},
-std::array<float,2>{0.373859644f, 0.316431493f},
-std::array<float,2>{0.609926462f, 0.931883931f},
-std::array<float,2>{0.82745707f, 0.0833806992f},
-std::array<float,2>{0.0965791419f, 0.681757987f},
-std::array<float,2>{0.44097358f, 0.0126908077f},
-std::array<float,2>{0.683226585f, 0.742874503f},
-std::array<float,2>{0.899803042f, 0.304039985f},
-std::array<float,2>{0.198147088f, 0.955671191f},
-std::array<float,2>{0.0278635565f, 0.42462945f},
-std::array<float,2>{0.801372409f, 0.867392004f},
-std::array<float,2>{0.560268402f, 0.227859065f},
-std::array<float,2>{0.286492974f, 0.603380322f},
-std::array<float,2>{0.0796840563f, 0.111713648f},
-std::array<float,2>{0.845937669f, 0.646424532f},
-std::array<float,2>{0.587704837f, 0.354563594f},
-std::array<float,2>{0.33741203f, 0.87680006f},
-std::array<float,2>{0.42381537f, 0.454776376f},
-std::array<float,2>{0.695161581f, 0.758758128f},
-std::array<float,2>{0.937697291f, 0.155784935f},
-std::array<float,2>{0.168268234f, 0.513930678f},
-std::array<float,2>{0.254526824f, 0.188891694f},
-std::array<float,2>{0.525019348f, 0.590874255f},
-std::array<float,2>{0.766591549f, 0.387668103f},
-std::array<float,2>{0.0598729216f, 0.816238165f},
-std::array<float,2>{0.239235699f, 0.257120073f},
-std::array<float,2>{0.933870018f, 0.985551059f},
-std::array<float,2>{0.640878022f, 0.0351314433f},
-std::array<float,2>{0.486153901f, 0.698422074f},
-std::array<float,2>{0.0458318703f, 0.241293609f},
-std::array<float,2>{0.75378561f, 0.619676709f},
-std::array<float,2>{0.505312979f, 0.415245205f},
-std::array<float,2>{0.271138132f, 0.84623152f},
-std::array<float,2>{0.471723795f, 0.293079644f},
-std::array<float,2>{0.625926077f, 0.952356815f},
-std::array<float,2>{0.907110929f, 0.0306814667f},
-std::array<float,2>{0.219546527f, 0.733245432f},
-std::array<float,2>{0.327591747f, 0.0759643391f},
-std::array<float,2>{0.572026551f, 0.663315535f},
-std::array<float,2>{0.863865674f, 0.343060613f},
-std::array<float,2>{0.0697230548f, 0.91452688f},
-std::array<float,2>{0.179634631f, 0.497510731f},
-std::array<float,2>{0.96670872f, 0.800073564f},
-std::array<float,2>{0.71853888f, 0.177195519f},
-std::array<float,2>{0.406777263f, 0.555462539f},
-std::array<float,2>{0.217920274f, 0.0472400896f},
-std::array<float,2>{0.888058126f, 0.714353621f},
-std::array<float,2>{0.660592496f, 0.268744975f},
-std::array<float,2>{0.467854023f, 0.983488977f},
-std::array<float,2>{0.301364571f, 0.391696543f},
-std::array<float,2>{0.546429276f, 0.843605995f},
-std::array<float,2>{0.796775401f, 0.216647416f},
-std::array<float,2>{0.00899714138f, 0.567834079f},
-std::array<float,2>{0.376862556f, 0.126530573f},
-std::array<float,2>{0.725331008f, 0.516793132f},
-std::array<float,2>{0.972893417f, 0.446073174f},
-std::array<float,2>{0.138583258f, 0.78114289f},
-std::array<float,2>{0.112535425f, 0.372197688f},
-std::array<float,2>{0.838591099f, 0.892251611f},
-std::array<float,2>{0.595207572f, 0.100918509f},
-std::array<float,2>{0.345772564f, 0.631906509f},
-std::array<float,2>{0.228315756f, 0.205416262f},
-std::array<float,2>{0.918186009f, 0.575435936f},
-std::array<float,2>{0.634371758f, 0.405819386f},
-std::array<float,2>{0.483313411f, 0.83556205f},
-std::array<float,2>{0.280582279f, 0.278432727f},
-std::array<float,2>{0.5132792f, 0.97614938f},
-std::array<float,2>{0.759651005f, 0.0576925837f},
-std::array<float,2>{0.0360532589f, 0.709162354f},
-std::array<float,2>{0.421775371f, 0.104042523f},
-std::array<float,2>{0.708621383f, 0.634742618f},
-std::array<float,2>{0.956049502f, 0.360017508f},
-std::array<float,2>{0.183043823f, 0.90506947f},
-std::array<float,2>{0.0779497623f, 0.438399315f},
-std::array<float,2>{0.870678663f, 0.770049155f},
-std::array<float,2>{0.567542791f, 0.138315439f},
-std::array<float,2>{0.317740947f, 0.524042606f},
-std::array<float,2>{0.00101684453f, 0.0213344097f},
-std::array<float,2>{0.788456142f, 0.726073682f},
-std::array<float,2>{0.534716487f, 0.283147305f},
-std::array<float,2>{0.311897874f, 0.941530943f},
-std::array<float,2>{0.45844993f, 0.413352519f},
-std::array<float,2>{0.668972731f, 0.857691646f},
-std::array<float,2>{0.876713574f, 0.24593693f},
-std::array<float,2>{0.205541939f, 0.616176307f},
-std::array<float,2>{0.353434056f, 0.182565853f},
-std::array<float,2>{0.602732539f, 0.55050689f},
-std::array<float,2>{0.832412958f, 0.487587005f},
-std::array<float,2>{0.117496967f, 0.808190763f},
-std::array<float,2>{0.12847814f, 0.331840873f},
-std::array<float,2>{0.979878485f, 0.906312168f},
-std::array<float,2>{0.727645695f, 0.0674461499f},
-std::array<float,2>{0.386176646f, 0.666961908f},
-std::array<float,2>{0.107477613f, 0.143008038f},
-std::array<float,2>{0.818968654f, 0.503464043f},
-std::array<float,2>{0.62233305f, 0.467292011f},
-std::array<float,2>{0.363538325f, 0.757774889f},
-std::array<float,2>{0.390816778f, 0.349667728f},
-std::array<float,2>{0.739541709f, 0.890144765f},
-std::array<float,2>{0.994154513f, 0.121826209f},
-std::array<float,2>{0.153582573f, 0.649831116f},
-std::array<float,2>{0.294333756f, 0.0406804681f},
-std::array<float,2>{0.548119843f, 0.69322747f},
-std::array<float,2>{0.805840015f, 0.264787793f},
-std::array<float,2>{0.0192317497f, 0.999371648f},
-std::array<float,2>{0.188710183f, 0.382658064f},
-std::array<float,2>{0.895369351f, 0.820685327f},
-std::array<float,2>{0.675630629f, 0.199483901f},
-std::array<float,2>{0.448145628f, 0.57954514f},
-std::array<float,2>{0.163852811f, 0.0928316265f},
-std::array<float,2>{0.950389922f, 0.675638974f},
-std::array<float,2>{0.701131701f, 0.323786616f},
-std::array<float,2>{0.431462735f, 0.929015875f},
-std::array<float,2>{0.332259715f, 0.47501722f},
-std::array<float,2>{0.578974366f, 0.790197134f},
-std::array<float,2>{0.85931474f, 0.162979111f},
-std::array<float,2>{0.0865073055f, 0.533113241f},
-std::array<float,2>{0.499789834f, 0.218902811f},
-std::array<float,2>{0.653453469f, 0.598026156f},
-std::array<float,2>{0.922647417f, 0.431272626f},
-std::array<float,2>{0.249794826f, 0.860645771f},
-std::array<float,2>{0.0480757803f, 0.31142211f},
-std::array<float,2>{0.776077032f, 0.965158761f},
-std::array<float,2>{0.520012617f, 0.00354212592f},
-std::array<float,2>{0.262633473f, 0.741070092f},
-std::array<float,2>{0.225843236f, 0.146947682f},
-std::array<float,2>{0.910764337f, 0.504691541f},
-std::array<float,2>{0.63242662f, 0.463789493f},
-std::array<float,2>{0.474580616f, 0.75160259f},
-std::array<float,2>{0.267684758f, 0.346586645f},
-std::array<float,2>{0.500798345f, 0.885151982f},
-std::array<float,2>{0.754335046f, 0.118188336f},
-std::array<float,2>{0.0428570397f, 0.654929578f},
-std::array<float,2>{0.41214931f, 0.0448272303f},
-std::array<float,2>{0.714795232f, 0.690890074f},
-std::array<float,2>{0.96360606f, 0.259135693f},
-std::array<float,2>{0.17239283f, 0.994855046f},
-std::array<float,2>{0.066239059f, 0.376451612f},
-std::array<float,2>{0.861054063f, 0.825079262f},
-std::array<float,2>{0.574345708f, 0.198911935f},
-std::array<float,2>{0.322505534f, 0.585265517f},
-std::array<float,2>{0.0129313096f, 0.0886341333f},
-std::array<float,2>{0.789507091f, 0.67728442f},
-std::array<float,2>{0.541943491f, 0.325218022f},
-std::array<float,2>{0.300122023f, 0.925496876f},
-std::array<float,2>{0.460975766f, 0.471196473f},
-std::array<float,2>{0.659799755f, 0.794594765f},
-std::array<float,2>{0.886568308f, 0.157747641f},
-std::array<float,2>{0.213430017f, 0.53886044f},
-std::array<float,2>{0.347967178f, 0.222737804f},
-std::array<float,2>{0.598640025f, 0.594348967f},
-std::array<float,2>{0.84172672f, 0.436183751f},
-std::array<float,2>{0.11624147f, 0.864564657f},
-std::array<float,2>{0.136156574f, 0.305934191f},
-std::array<float,2>{0.969016969f, 0.963425577f},
-std::array<float,2>{0.721777916f, 0.00661886064f},
-std::array<float,2>{0.381562442f, 0.73760891f},
-std::array<float,2>{0.0987353325f, 0.210518017f},
-std::array<float,2>{0.82177788f, 0.572068512f},
-std::array<float,2>{0.61684984f, 0.398742557f},
-std::array<float,2>{0.367801726f, 0.830483854f},
-std::array<float,2>{0.399836004f, 0.274840415f},
-std::array<float,2>{0.745485723f, 0.969411492f},
-std::array<float,2>{0.989256382f, 0.0611649677f},
-std::array<float,2>{0.145529926f, 0.706803024f},
-std::array<float,2>{0.284234464f, 0.106183827f},
-std::array<float,2>{0.557889402f, 0.639203608f},
-std::array<float,2>{0.80007875f, 0.365017295f},
-std::array<float,2>{0.0237933788f, 0.898648262f},
-std::array<float,2>{0.203105628f, 0.442069381f},
-std::array<float,2>{0.906094134f, 0.768947899f},
-std::array<float,2>{0.685754478f, 0.134219363f},
-std::array<float,2>{0.443495512f, 0.529217958f},
-std::array<float,2>{0.167664886f, 0.01862715f},
-std::array<float,2>{0.942218423f, 0.720516682f},
-std::array<float,2>{0.689401865f, 0.286014408f},
-std::array<float,2>{0.427054584f, 0.938021958f},
-std::array<float,2>{0.340190977f, 0.406706393f},
-std::array<float,2>{0.592823684f, 0.853803277f},
-std::array<float,2>{0.850263476f, 0.24895598f},
-std::array<float,2>{0.0848418325f, 0.612275541f},
-std::array<float,2>{0.489035606f, 0.184875458f},
-std::array<float,2>{0.648295581f, 0.554091454f},
-std::array<float,2>{0.933375955f, 0.490781277f},
-std::array<float,2>{0.2377491f, 0.808766305f},
-std::array<float,2>{0.0554931089f, 0.332381278f},
-std::array<float,2>{0.770972788f, 0.913113296f},
-std::array<float,2>{0.527886569f, 0.062834233f},
-std::array<float,2>{0.253735423f, 0.66903162f},
-std::array<float,2>{0.151201993f, 0.235430911f},
-std::array<float,2>{0.998556912f, 0.623476326f},
-std::array<float,2>{0.735294163f, 0.420619309f},
-std::array<float,2>{0.39630121f, 0.848708332f},
-std::array<float,2>{0.361327738f, 0.292429864f},
-std::array<float,2>{0.618965268f, 0.94690901f},
-std::array<float,2>{0.816149116f, 0.027102273f},
-std::array<float,2>{0.102155052f, 0.728341341f},
-std::array<float,2>{0.45157209f, 0.0725269318f},
-std::array<float,2>{0.676638126f, 0.658302784f},
-std::array<float,2>{0.893908739f, 0.336767346f},
-std::array<float,2>{0.193108037f, 0.921851218f},
-std::array<float,2>{0.0224167556f, 0.493796825f},
-std::array<float,2>{0.809720218f, 0.802218735f},
-std::array<float,2>{0.552636445f, 0.172396407f},
-std::array<float,2>{0.29092586f, 0.559485316f},
-std::array<float,2>{0.0937208533f, 0.0522886999f},
-std::array<float,2>{0.852816522f, 0.717401087f},
-std::array<float,2>{0.582125247f, 0.271997631f},
-std::array<float,2>{0.331459045f, 0.977672279f},
-std::array<float,2>{0.435425729f, 0.397374123f},
-std::array<float,2>{0.698046327f, 0.839234531f},
-std::array<float,2>{0.947208226f, 0.214584649f},
-std::array<float,2>{0.158021659f, 0.563236475f},
-std::array<float,2>{0.258260012f, 0.131894693f},
-std::array<float,2>{0.517813742f, 0.521250963f},
-std::array<float,2>{0.777612925f, 0.452365458f},
-std::array<float,2>{0.0518667698f, 0.773842216f},
-std::array<float,2>{0.243458599f, 0.370327234f},
-std::array<float,2>{0.929230452f, 0.895828605f},
-std::array<float,2>{0.650550127f, 0.095726423f},
-std::array<float,2>{0.493700176f, 0.625714719f},
-std::array<float,2>{0.0328110494f, 0.164782315f},
-std::array<float,2>{0.761783779f, 0.546566248f},
-std::array<float,2>{0.510335565f, 0.479786307f},
-std::array<float,2>{0.27462104f, 0.787151814f},
-std::array<float,2>{0.478437126f, 0.315964162f},
-std::array<float,2>{0.639018834f, 0.936158001f},
-std::array<float,2>{0.916902602f, 0.0809384659f},
-std::array<float,2>{0.233297557f, 0.6841923f},
-std::array<float,2>{0.315021157f, 0.0116480701f},
-std::array<float,2>{0.565472305f, 0.746605992f},
-std::array<float,2>{0.872277796f, 0.299706012f},
-std::array<float,2>{0.0716663748f, 0.957984686f},
-std::array<float,2>{0.186897233f, 0.428639889f},
-std::array<float,2>{0.959409595f, 0.873060286f},
-std::array<float,2>{0.706348062f, 0.230628952f},
-std::array<float,2>{0.41636914f, 0.605805099f},
-std::array<float,2>{0.209388331f, 0.116082385f},
-std::array<float,2>{0.880155504f, 0.640782416f},
-std::array<float,2>{0.665693939f, 0.358192801f},
-std::array<float,2>{0.454167813f, 0.88038969f},
-std::array<float,2>{0.306999773f, 0.459661096f},
-std::array<float,2>{0.536242664f, 0.765123308f},
-std::array<float,2>{0.784428418f, 0.150495946f},
-std::array<float,2>{0.00542952446f, 0.510049582f},
-std::array<float,2>{0.387684435f, 0.19355692f},
-std::array<float,2>{0.733703136f, 0.586480498f},
-std::array<float,2>{0.980867326f, 0.384872347f},
-std::array<float,2>{0.131380633f, 0.81860137f},
-std::array<float,2>{0.121632442f, 0.252784252f},
-std::array<float,2>{0.829013169f, 0.988988817f},
-std::array<float,2>{0.608621776f, 0.0390023775f},
-std::array<float,2>{0.355989337f, 0.702340603f},
-std::array<float,2>{0.177153319f, 0.175949037f},
-std::array<float,2>{0.967363715f, 0.556168973f},
-std::array<float,2>{0.715226591f, 0.496198356f},
-std::array<float,2>{0.408835769f, 0.799266934f},
-std::array<float,2>{0.324777633f, 0.342211664f},
-std::array<float,2>{0.574177206f, 0.91556406f},
-std::array<float,2>{0.866744816f, 0.0751532912f},
-std::array<float,2>{0.0682787523f, 0.662161946f},
-std::array<float,2>{0.46997416f, 0.0296658427f},
-std::array<float,2>{0.628304064f, 0.733793616f},
-std::array<float,2>{0.908617914f, 0.294760048f},
-std::array<float,2>{0.221390605f, 0.95125246f},
-std::array<float,2>{0.0440200493f, 0.414746702f},
-std::array<float,2>{0.751644075f, 0.8470577f},
-std::array<float,2>{0.506296098f, 0.240448296f},
-std::array<float,2>{0.271591872f, 0.620595694f},
-std::array<float,2>{0.109622873f, 0.10039293f},
-std::array<float,2>{0.836588025f, 0.631665468f},
-std::array<float,2>{0.596642733f, 0.371777058f},
-std::array<float,2>{0.344177634f, 0.890680611f},
-std::array<float,2>{0.377128094f, 0.447005183f},
-std::array<float,2>{0.723881423f, 0.780161083f},
-std::array<float,2>{0.975384772f, 0.125559181f},
-std::array<float,2>{0.138921961f, 0.516108215f},
-std::array<float,2>{0.302756727f, 0.215057775f},
-std::array<float,2>{0.544055402f, 0.567184687f},
-std::array<float,2>{0.794086158f, 0.390941262f},
-std::array<float,2>{0.0112616913f, 0.842265487f},
-std::array<float,2>{0.215059027f, 0.26771903f},
-std::array<float,2>{0.889953911f, 0.983143032f},
-std::array<float,2>{0.662370503f, 0.0482857078f},
-std::array<float,2>{0.465418339f, 0.713311434f},
-std::array<float,2>{0.0302975122f, 0.227341071f},
-std::array<float,2>{0.803471863f, 0.602060795f},
-std::array<float,2>{0.561653674f, 0.424850494f},
-std::array<float,2>{0.28892979f, 0.868180215f},
-std::array<float,2>{0.438153654f, 0.303557336f},
-std::array<float,2>{0.681580365f, 0.956945181f},
-std::array<float,2>{0.900547445f, 0.0133381123f},
-std::array<float,2>{0.196982995f, 0.743331671f},
-std::array<float,2>{0.372092515f, 0.0827995688f},
-std::array<float,2>{0.612720549f, 0.682947099f},
-std::array<float,2>{0.82568562f, 0.318328351f},
-std::array<float,2>{0.0941303f, 0.933353007f},
-std::array<float,2>{0.142510518f, 0.481190801f},
-std::array<float,2>{0.984705865f, 0.782380283f},
-std::array<float,2>{0.748207927f, 0.171282127f},
-std::array<float,2>{0.405823588f, 0.542803824f},
-std::array<float,2>{0.241301447f, 0.0340444744f},
-std::array<float,2>{0.937222421f, 0.697766185f},
-std::array<float,2>{0.643443882f, 0.256705999f},
-std::array<float,2>{0.487265736f, 0.985333443f},
-std::array<float,2>{0.257798672f, 0.388156384f},
-std::array<float,2>{0.526488602f, 0.814903378f},
-std::array<float,2>{0.768141985f, 0.188429728f},
-std::array<float,2>{0.062029399f, 0.590699852f},
-std::array<float,2>{0.424583048f, 0.154701591f},
-std::array<float,2>{0.691540241f, 0.515614271f},
-std::array<float,2>{0.939552903f, 0.453754753f},
-std::array<float,2>{0.171325952f, 0.759281099f},
-std::array<float,2>{0.0805593133f, 0.35364309f},
-std::array<float,2>{0.845443249f, 0.875884831f},
-std::array<float,2>{0.589794278f, 0.112309262f},
-std::array<float,2>{0.338270307f, 0.645455897f},
-std::array<float,2>{0.190304279f, 0.200393036f},
-std::array<float,2>{0.898274779f, 0.578681767f},
-std::array<float,2>{0.672742248f, 0.381605923f},
-std::array<float,2>{0.446703613f, 0.821866453f},
-std::array<float,2>{0.295141518f, 0.264368892f},
-std::array<float,2>{0.550180674f, 0.998302698f},
-std::array<float,2>{0.806648314f, 0.0396997184f},
-std::array<float,2>{0.0175198242f, 0.691929162f},
-std::array<float,2>{0.393072605f, 0.122479215f},
-std::array<float,2>{0.741254091f, 0.648941278f},
-std::array<float,2>{0.993067741f, 0.351236016f},
-std::array<float,2>{0.15540579f, 0.88877666f},
-std::array<float,2>{0.106924146f, 0.468115509f},
-std::array<float,2>{0.818297207f, 0.75614202f},
-std::array<float,2>{0.623987615f, 0.144288361f},
-std::array<float,2>{0.365692794f, 0.502361953f},
-std::array<float,2>{0.0507208481f, 0.00260204519f},
-std::array<float,2>{0.773551762f, 0.741381407f},
-std::array<float,2>{0.52236557f, 0.312400162f},
-std::array<float,2>{0.263917565f, 0.965857625f},
-std::array<float,2>{0.497999191f, 0.430400729f},
-std::array<float,2>{0.655187309f, 0.86021781f},
-std::array<float,2>{0.923980951f, 0.220220417f},
-std::array<float,2>{0.247889429f, 0.598911166f},
-std::array<float,2>{0.335294306f, 0.163662389f},
-std::array<float,2>{0.581128955f, 0.53129822f},
-std::array<float,2>{0.856234312f, 0.476437569f},
-std::array<float,2>{0.0897858962f, 0.789714992f},
-std::array<float,2>{0.160517961f, 0.322328597f},
-std::array<float,2>{0.95163548f, 0.927862942f},
-std::array<float,2>{0.701393485f, 0.0924361572f},
-std::array<float,2>{0.433005303f, 0.674078763f},
-std::array<float,2>{0.0745678842f, 0.137193009f},
-std::array<float,2>{0.86842978f, 0.524430573f},
-std::array<float,2>{0.568819821f, 0.439306825f},
-std::array<float,2>{0.31873706f, 0.771247566f},
-std::array<float,2>{0.418327957f, 0.360483438f},
-std::array<float,2>{0.710214794f, 0.905584037f},
-std::array<float,2>{0.954938889f, 0.104774684f},
-std::array<float,2>{0.1804481f, 0.6337744f},
-std::array<float,2>{0.278494298f, 0.0573575422f},
-std::array<float,2>{0.514873803f, 0.710053444f},
-std::array<float,2>{0.760092258f, 0.277712017f},
-std::array<float,2>{0.0386767909f, 0.975013316f},
-std::array<float,2>{0.230248421f, 0.404845297f},
-std::array<float,2>{0.920914173f, 0.834826708f},
-std::array<float,2>{0.63644588f, 0.206257492f},
-std::array<float,2>{0.481497079f, 0.574977279f},
-std::array<float,2>{0.125965551f, 0.067161046f},
-std::array<float,2>{0.977648377f, 0.667398453f},
-std::array<float,2>{0.728962719f, 0.330739647f},
-std::array<float,2>{0.383900404f, 0.907678068f},
-std::array<float,2>{0.355362058f, 0.486483574f},
-std::array<float,2>{0.605188847f, 0.807580292f},
-std::array<float,2>{0.835570335f, 0.183007196f},
-std::array<float,2>{0.120419309f, 0.549192011f},
-std::array<float,2>{0.459483266f, 0.245077342f},
-std::array<float,2>{0.670142055f, 0.616467535f},
-std::array<float,2>{0.878763318f, 0.412390977f},
-std::array<float,2>{0.204093337f, 0.85863179f},
-std::array<float,2>{0.0028344288f, 0.281345248f},
-std::array<float,2>{0.785991371f, 0.942440271f},
-std::array<float,2>{0.532149434f, 0.0202528723f},
-std::array<float,2>{0.309084326f, 0.725100875f},
-std::array<float,2>{0.211956322f, 0.158728257f},
-std::array<float,2>{0.884641826f, 0.536022186f},
-std::array<float,2>{0.657297432f, 0.469288319f},
-std::array<float,2>{0.464774311f, 0.795324266f},
-std::array<float,2>{0.297519833f, 0.326929808f},
-std::array<float,2>{0.539738357f, 0.921990037f},
-std::array<float,2>{0.79158026f, 0.0878067687f},
-std::array<float,2>{0.0153982192f, 0.678570688f},
-std::array<float,2>{0.379229784f, 0.00570309348f},
-std::array<float,2>{0.719819009f, 0.735878289f},
-std::array<float,2>{0.97157383f, 0.307854176f},
-std::array<float,2>{0.133520946f, 0.962450266f},
-std::array<float,2>{0.113844879f, 0.434652686f},
-std::array<float,2>{0.841955245f, 0.865412712f},
-std::array<float,2>{0.601130962f, 0.225566372f},
-std::array<float,2>{0.350974172f, 0.596554875f},
-std::array<float,2>{0.0398488268f, 0.120273039f},
-std::array<float,2>{0.756315649f, 0.653912961f},
-std::array<float,2>{0.502709508f, 0.345484376f},
-std::array<float,2>{0.266466588f, 0.882871151f},
-std::array<float,2>{0.475165933f, 0.461562514f},
-std::array<float,2>{0.62951529f, 0.751999795f},
-std::array<float,2>{0.912561238f, 0.144913718f},
-std::array<float,2>{0.22377421f, 0.506617427f},
-std::array<float,2>{0.320382178f, 0.196747452f},
-std::array<float,2>{0.578093588f, 0.582367063f},
-std::array<float,2>{0.861733675f, 0.377538264f},
-std::array<float,2>{0.0627059042f, 0.828078091f},
-std::array<float,2>{0.175557792f, 0.260652304f},
-std::array<float,2>{0.961451888f, 0.993268907f},
-std::array<float,2>{0.712149501f, 0.0460131094f},
-std::array<float,2>{0.410161823f, 0.688345015f},
-std::array<float,2>{0.0832266957f, 0.247864366f},
-std::array<float,2>{0.848245084f, 0.610823333f},
-std::array<float,2>{0.590609968f, 0.409803331f},
-std::array<float,2>{0.343717366f, 0.85307157f},
-std::array<float,2>{0.428508013f, 0.287696093f},
-std::array<float,2>{0.689914703f, 0.941126049f},
-std::array<float,2>{0.943870544f, 0.0165417287f},
-std::array<float,2>{0.164751336f, 0.722201526f},
-std::array<float,2>{0.250585884f, 0.0656952932f},
-std::array<float,2>{0.529680371f, 0.670114636f},
-std::array<float,2>{0.772161067f, 0.334160805f},
-std::array<float,2>{0.0580885783f, 0.911748111f},
-std::array<float,2>{0.235175461f, 0.489103973f},
-std::array<float,2>{0.93147105f, 0.811343312f},
-std::array<float,2>{0.645517647f, 0.187398195f},
-std::array<float,2>{0.490379602f, 0.552716076f},
-std::array<float,2>{0.146700174f, 0.0597165227f},
-std::array<float,2>{0.991080582f, 0.703300476f},
-std::array<float,2>{0.743495941f, 0.276879966f},
-std::array<float,2>{0.401673466f, 0.971114039f},
-std::array<float,2>{0.369825631f, 0.401976943f},
-std::array<float,2>{0.614663899f, 0.829693258f},
-std::array<float,2>{0.823262811f, 0.208738685f},
-std::array<float,2>{0.100050084f, 0.573359668f},
-std::array<float,2>{0.441876888f, 0.136434019f},
-std::array<float,2>{0.684708357f, 0.530003488f},
-std::array<float,2>{0.90317899f, 0.444521666f},
-std::array<float,2>{0.200207338f, 0.76662004f},
-std::array<float,2>{0.0264502615f, 0.365454316f},
-std::array<float,2>{0.79746592f, 0.901291966f},
-std::array<float,2>{0.55605489f, 0.1081523f},
-std::array<float,2>{0.281805933f, 0.637080729f},
-std::array<float,2>{0.158314064f, 0.210967287f},
-std::array<float,2>{0.948617399f, 0.565634966f},
-std::array<float,2>{0.697094917f, 0.394734621f},
-std::array<float,2>{0.436247855f, 0.836140156f},
-std::array<float,2>{0.329185486f, 0.270311624f},
-std::array<float,2>{0.585608482f, 0.980081081f},
-std::array<float,2>{0.854036391f, 0.0539041124f},
-std::array<float,2>{0.0906727612f, 0.715809107f},
-std::array<float,2>{0.49474749f, 0.0953014269f},
-std::array<float,2>{0.649980068f, 0.627803028f},
-std::array<float,2>{0.926761389f, 0.367852986f},
-std::array<float,2>{0.244419992f, 0.896878839f},
-std::array<float,2>{0.0538571589f, 0.450521618f},
-std::array<float,2>{0.780591488f, 0.775962949f},
-std::array<float,2>{0.516862035f, 0.129606172f},
-std::array<float,2>{0.26137504f, 0.522163808f},
-std::array<float,2>{0.104155265f, 0.0242906753f},
-std::array<float,2>{0.813318729f, 0.729244471f},
-std::array<float,2>{0.620138228f, 0.290107071f},
-std::array<float,2>{0.362819582f, 0.947433174f},
-std::array<float,2>{0.398369133f, 0.418975055f},
-std::array<float,2>{0.737558544f, 0.849808991f},
-std::array<float,2>{0.99762255f, 0.23698993f},
-std::array<float,2>{0.150138378f, 0.622780144f},
-std::array<float,2>{0.292457521f, 0.175739095f},
-std::array<float,2>{0.554395497f, 0.560622394f},
-std::array<float,2>{0.810660422f, 0.495621264f},
-std::array<float,2>{0.021311529f, 0.804401219f},
-std::array<float,2>{0.194071457f, 0.339435458f},
-std::array<float,2>{0.891298056f, 0.919782996f},
-std::array<float,2>{0.677757144f, 0.0710633621f},
-std::array<float,2>{0.450554579f, 0.657142282f},
-std::array<float,2>{0.00685326522f, 0.150060922f},
-std::array<float,2>{0.782647848f, 0.509211123f},
-std::array<float,2>{0.537118256f, 0.458165944f},
-std::array<float,2>{0.305081755f, 0.763358891f},
-std::array<float,2>{0.455277413f, 0.356343657f},
-std::array<float,2>{0.667186379f, 0.881866693f},
-std::array<float,2>{0.882630348f, 0.114423387f},
-std::array<float,2>{0.20737192f, 0.643814921f},
-std::array<float,2>{0.359092742f, 0.0353065729f},
-std::array<float,2>{0.606619358f, 0.700364053f},
-std::array<float,2>{0.831744194f, 0.25058198f},
-std::array<float,2>{0.124661036f, 0.991271794f},
-std::array<float,2>{0.130471364f, 0.384465277f},
-std::array<float,2>{0.983426452f, 0.817618966f},
-std::array<float,2>{0.731516182f, 0.192249238f},
-std::array<float,2>{0.388694793f, 0.589795887f},
-std::array<float,2>{0.231476098f, 0.0799456686f},
-std::array<float,2>{0.915371358f, 0.686041415f},
-std::array<float,2>{0.637675107f, 0.313687384f},
-std::array<float,2>{0.479225039f, 0.93548584f},
-std::array<float,2>{0.277337879f, 0.477702767f},
-std::array<float,2>{0.508709073f, 0.786827326f},
-std::array<float,2>{0.764350951f, 0.166779205f},
-std::array<float,2>{0.0345393755f, 0.543485522f},
-std::array<float,2>{0.415070504f, 0.23259674f},
-std::array<float,2>{0.704660952f, 0.608981133f},
-std::array<float,2>{0.95738399f, 0.427212536f},
-std::array<float,2>{0.184765965f, 0.872428417f},
-std::array<float,2>{0.0735811368f, 0.297593892f},
-std::array<float,2>{0.87475878f, 0.959060252f},
-std::array<float,2>{0.563176274f, 0.00938723981f},
-std::array<float,2>{0.313416809f, 0.749146163f},
-std::array<float,2>{0.137312457f, 0.12785168f},
-std::array<float,2>{0.974019706f, 0.518096685f},
-std::array<float,2>{0.726318359f, 0.447573662f},
-std::array<float,2>{0.37523362f, 0.778957844f},
-std::array<float,2>{0.347260952f, 0.374847502f},
-std::array<float,2>{0.594281018f, 0.893197954f},
-std::array<float,2>{0.839766324f, 0.0993989781f},
-std::array<float,2>{0.111555658f, 0.63037771f},
-std::array<float,2>{0.467079222f, 0.0496255718f},
-std::array<float,2>{0.661886632f, 0.711288452f},
-std::array<float,2>{0.88725847f, 0.267460346f},
-std::array<float,2>{0.217636585f, 0.982183695f},
-std::array<float,2>{0.00858538598f, 0.394259334f},
-std::array<float,2>{0.795011401f, 0.841061294f},
-std::array<float,2>{0.545825243f, 0.216826111f},
-std::array<float,2>{0.302044898f, 0.569035172f},
-std::array<float,2>{0.0684553683f, 0.0771596208f},
-std::array<float,2>{0.864839733f, 0.66035825f},
-std::array<float,2>{0.570818841f, 0.341757864f},
-std::array<float,2>{0.32688579f, 0.917693734f},
-std::array<float,2>{0.408166528f, 0.498980373f},
-std::array<float,2>{0.716807067f, 0.797187746f},
-std::array<float,2>{0.964884639f, 0.177940726f},
-std::array<float,2>{0.178560778f, 0.558114588f},
-std::array<float,2>{0.26956591f, 0.238432512f},
-std::array<float,2>{0.504877746f, 0.618367732f},
-std::array<float,2>{0.752515018f, 0.417945236f},
-std::array<float,2>{0.0463542193f, 0.843771696f},
-std::array<float,2>{0.220423922f, 0.295249552f},
-std::array<float,2>{0.907719672f, 0.950104594f},
-std::array<float,2>{0.626840591f, 0.0286141131f},
-std::array<float,2>{0.471649855f, 0.732083797f},
-std::array<float,2>{0.0592769124f, 0.189619601f},
-std::array<float,2>{0.766620874f, 0.591989458f},
-std::array<float,2>{0.523668826f, 0.390037298f},
-std::array<float,2>{0.25508216f, 0.813482642f},
-std::array<float,2>{0.485310107f, 0.25511241f},
-std::array<float,2>{0.641733825f, 0.987572193f},
-std::array<float,2>{0.934969246f, 0.0324236602f},
-std::array<float,2>{0.240155369f, 0.696563721f},
-std::array<float,2>{0.33674404f, 0.11116565f},
-std::array<float,2>{0.586761355f, 0.646833539f},
-std::array<float,2>{0.846873701f, 0.352068633f},
-std::array<float,2>{0.0784557834f, 0.878878713f},
-std::array<float,2>{0.16971226f, 0.455763906f},
-std::array<float,2>{0.938933909f, 0.760292411f},
-std::array<float,2>{0.693657577f, 0.152554482f},
-std::array<float,2>{0.422306955f, 0.513128638f},
-std::array<float,2>{0.19857946f, 0.0136827612f},
-std::array<float,2>{0.899379075f, 0.744152188f},
-std::array<float,2>{0.682072997f, 0.301852822f},
-std::array<float,2>{0.440412372f, 0.953375161f},
-std::array<float,2>{0.285911858f, 0.421936929f},
-std::array<float,2>{0.558936179f, 0.870039701f},
-std::array<float,2>{0.802071095f, 0.229359597f},
-std::array<float,2>{0.0288658217f, 0.605028033f},
-std::array<float,2>{0.404057503f, 0.168625399f},
-std::array<float,2>{0.746815801f, 0.539092362f},
-std::array<float,2>{0.987896383f, 0.483100504f},
-std::array<float,2>{0.144067302f, 0.784191251f},
-std::array<float,2>{0.0974002033f, 0.320083648f},
-std::array<float,2>{0.826978326f, 0.931054473f},
-std::array<float,2>{0.610983491f, 0.0849986672f},
-std::array<float,2>{0.374430984f, 0.68029362f},
-std::array<float,2>{0.24825345f, 0.221267521f},
-std::array<float,2>{0.923102021f, 0.600655138f},
-std::array<float,2>{0.652756631f, 0.431816697f},
-std::array<float,2>{0.498185903f, 0.862190068f},
-std::array<float,2>{0.262791842f, 0.309516519f},
-std::array<float,2>{0.521278262f, 0.967490613f},
-std::array<float,2>{0.77636975f, 5.32336853e-05f},
-std::array<float,2>{0.047472693f, 0.739544332f},
-std::array<float,2>{0.430634975f, 0.0908414572f},
-std::array<float,2>{0.699568987f, 0.672301233f},
-std::array<float,2>{0.94938761f, 0.32144016f},
-std::array<float,2>{0.162405819f, 0.927636921f},
-std::array<float,2>{0.0871285871f, 0.47435689f},
-std::array<float,2>{0.858291447f, 0.792627394f},
-std::array<float,2>{0.580049396f, 0.161594227f},
-std::array<float,2>{0.333379835f, 0.534989417f},
-std::array<float,2>{0.0178261809f, 0.0425728336f},
-std::array<float,2>{0.805068374f, 0.693869948f},
-std::array<float,2>{0.546877325f, 0.263335586f},
-std::array<float,2>{0.293142945f, 0.996494949f},
-std::array<float,2>{0.448378265f, 0.379956156f},
-std::array<float,2>{0.674422085f, 0.823237121f},
-std::array<float,2>{0.895623565f, 0.201796427f},
-std::array<float,2>{0.187512383f, 0.580466807f},
-std::array<float,2>{0.36522603f, 0.141403407f},
-std::array<float,2>{0.6212008f, 0.501763761f},
-std::array<float,2>{0.819490969f, 0.466052234f},
-std::array<float,2>{0.108778633f, 0.754570186f},
-std::array<float,2>{0.153116316f, 0.349050134f},
-std::array<float,2>{0.995937109f, 0.887165129f},
-std::array<float,2>{0.738816023f, 0.124767259f},
-std::array<float,2>{0.391726494f, 0.65125674f},
-std::array<float,2>{0.118793458f, 0.181609794f},
-std::array<float,2>{0.833972573f, 0.547452271f},
-std::array<float,2>{0.601684988f, 0.486296833f},
-std::array<float,2>{0.351869315f, 0.805723786f},
-std::array<float,2>{0.385259002f, 0.328405917f},
-std::array<float,2>{0.727536082f, 0.910110235f},
-std::array<float,2>{0.978543878f, 0.068676278f},
-std::array<float,2>{0.126992896f, 0.665587962f},
-std::array<float,2>{0.310901195f, 0.0226897094f},
-std::array<float,2>{0.533208132f, 0.724285185f},
-std::array<float,2>{0.787782729f, 0.283831775f},
-std::array<float,2>{0.000600706611f, 0.944287837f},
-std::array<float,2>{0.206426322f, 0.411073714f},
-std::array<float,2>{0.87583524f, 0.856989741f},
-std::array<float,2>{0.668779314f, 0.24323152f},
-std::array<float,2>{0.457958817f, 0.613651097f},
-std::array<float,2>{0.181671798f, 0.102138273f},
-std::array<float,2>{0.956468165f, 0.636398077f},
-std::array<float,2>{0.707118273f, 0.362999737f},
-std::array<float,2>{0.42077291f, 0.903247297f},
-std::array<float,2>{0.317169279f, 0.440728515f},
-std::array<float,2>{0.56676656f, 0.773348749f},
-std::array<float,2>{0.869411111f, 0.139469132f},
-std::array<float,2>{0.0766820535f, 0.526363492f},
-std::array<float,2>{0.483400822f, 0.204915836f},
-std::array<float,2>{0.632982016f, 0.577528059f},
-std::array<float,2>{0.919596672f, 0.404240042f},
-std::array<float,2>{0.226823121f, 0.832226634f},
-std::array<float,2>{0.0368530639f, 0.280674636f},
-std::array<float,2>{0.758329928f, 0.97314477f},
-std::array<float,2>{0.511732697f, 0.0562139116f},
-std::array<float,2>{0.279344887f, 0.708711267f},
-std::array<float,2>{0.221663758f, 0.179309726f},
-std::array<float,2>{0.90837121f, 0.556796789f},
-std::array<float,2>{0.627977371f, 0.499589205f},
-std::array<float,2>{0.469961494f, 0.798781216f},
-std::array<float,2>{0.271760583f, 0.34037292f},
-std::array<float,2>{0.505899131f, 0.916063547f},
-std::array<float,2>{0.751832485f, 0.0762992799f},
-std::array<float,2>{0.0443452336f, 0.661840081f},
-std::array<float,2>{0.409025311f, 0.0281826649f},
-std::array<float,2>{0.715067029f, 0.731114686f},
-std::array<float,2>{0.967714489f, 0.295900762f},
-std::array<float,2>{0.176973462f, 0.950432241f},
-std::array<float,2>{0.0678740591f, 0.416754425f},
-std::array<float,2>{0.8669734f, 0.84542048f},
-std::array<float,2>{0.573837757f, 0.239730716f},
-std::array<float,2>{0.325182587f, 0.617676795f},
-std::array<float,2>{0.0115148192f, 0.0979804173f},
-std::array<float,2>{0.794376075f, 0.628943205f},
-std::array<float,2>{0.544419646f, 0.373472631f},
-std::array<float,2>{0.302984685f, 0.89371711f},
-std::array<float,2>{0.465578854f, 0.448548377f},
-std::array<float,2>{0.662272811f, 0.777713656f},
-std::array<float,2>{0.88982743f, 0.128291309f},
-std::array<float,2>{0.215160534f, 0.519276083f},
-std::array<float,2>{0.343770564f, 0.218713254f},
-std::array<float,2>{0.596350491f, 0.569482207f},
-std::array<float,2>{0.836838424f, 0.392992973f},
-std::array<float,2>{0.109407477f, 0.840489805f},
-std::array<float,2>{0.138865337f, 0.265758514f},
-std::array<float,2>{0.975152016f, 0.981065989f},
-std::array<float,2>{0.723843098f, 0.0502075069f},
-std::array<float,2>{0.377390772f, 0.712334991f},
-std::array<float,2>{0.0937810615f, 0.229644999f},
-std::array<float,2>{0.82612282f, 0.603934824f},
-std::array<float,2>{0.612510264f, 0.423410475f},
-std::array<float,2>{0.372470349f, 0.870590687f},
-std::array<float,2>{0.406163663f, 0.301365197f},
-std::array<float,2>{0.748380959f, 0.954348266f},
-std::array<float,2>{0.984529614f, 0.0151357818f},
-std::array<float,2>{0.142304078f, 0.745424092f},
-std::array<float,2>{0.288759112f, 0.0840996057f},
-std::array<float,2>{0.561795652f, 0.681578875f},
-std::array<float,2>{0.80327189f, 0.318626612f},
-std::array<float,2>{0.0306263417f, 0.930185676f},
-std::array<float,2>{0.197154433f, 0.483558267f},
-std::array<float,2>{0.900663495f, 0.783583939f},
-std::array<float,2>{0.68117094f, 0.169330642f},
-std::array<float,2>{0.438311756f, 0.540198267f},
-std::array<float,2>{0.170918897f, 0.0320053399f},
-std::array<float,2>{0.939928532f, 0.695722461f},
-std::array<float,2>{0.691766918f, 0.254049718f},
-std::array<float,2>{0.424349934f, 0.98718667f},
-std::array<float,2>{0.337913007f, 0.388795525f},
-std::array<float,2>{0.589587092f, 0.812529147f},
-std::array<float,2>{0.845598638f, 0.190701723f},
-std::array<float,2>{0.0802678689f, 0.593482018f},
-std::array<float,2>{0.486910909f, 0.153561532f},
-std::array<float,2>{0.643203259f, 0.512300313f},
-std::array<float,2>{0.937306881f, 0.456935316f},
-std::array<float,2>{0.241688028f, 0.760860741f},
-std::array<float,2>{0.062273331f, 0.353500158f},
-std::array<float,2>{0.768550813f, 0.87735337f},
-std::array<float,2>{0.526759624f, 0.110216968f},
-std::array<float,2>{0.257482231f, 0.64836055f},
-std::array<float,2>{0.155753568f, 0.202670425f},
-std::array<float,2>{0.992885172f, 0.581243396f},
-std::array<float,2>{0.741586506f, 0.379265696f},
-std::array<float,2>{0.393381804f, 0.823437035f},
-std::array<float,2>{0.365453988f, 0.262008876f},
-std::array<float,2>{0.623588383f, 0.997768521f},
-std::array<float,2>{0.818023026f, 0.0413262583f},
-std::array<float,2>{0.10648609f, 0.694919527f},
-std::array<float,2>{0.446296722f, 0.123090811f},
-std::array<float,2>{0.672601759f, 0.651785254f},
-std::array<float,2>{0.897960961f, 0.347842693f},
-std::array<float,2>{0.190101802f, 0.888610959f},
-std::array<float,2>{0.0171797425f, 0.465553641f},
-std::array<float,2>{0.807114661f, 0.754965186f},
-std::array<float,2>{0.549848676f, 0.142546788f},
-std::array<float,2>{0.29539156f, 0.500731766f},
-std::array<float,2>{0.0894277021f, 0.00166521128f},
-std::array<float,2>{0.856068969f, 0.738612056f},
-std::array<float,2>{0.581523061f, 0.310227513f},
-std::array<float,2>{0.334997416f, 0.967836916f},
-std::array<float,2>{0.432712942f, 0.43283087f},
-std::array<float,2>{0.70165199f, 0.862509727f},
-std::array<float,2>{0.951252937f, 0.222067386f},
-std::array<float,2>{0.160231948f, 0.599674523f},
-std::array<float,2>{0.263751894f, 0.160766885f},
-std::array<float,2>{0.522049725f, 0.534093916f},
-std::array<float,2>{0.77379936f, 0.473391235f},
-std::array<float,2>{0.0503408201f, 0.79126364f},
-std::array<float,2>{0.247671545f, 0.320556343f},
-std::array<float,2>{0.924109936f, 0.926512957f},
-std::array<float,2>{0.65497154f, 0.090364255f},
-std::array<float,2>{0.497627825f, 0.67351383f},
-std::array<float,2>{0.0388448015f, 0.140154436f},
-std::array<float,2>{0.759805202f, 0.52694875f},
-std::array<float,2>{0.515115261f, 0.440282494f},
-std::array<float,2>{0.278747052f, 0.772392392f},
-std::array<float,2>{0.481806457f, 0.36191833f},
-std::array<float,2>{0.636681199f, 0.903508127f},
-std::array<float,2>{0.921267748f, 0.102678306f},
-std::array<float,2>{0.230013326f, 0.635365069f},
-std::array<float,2>{0.318418741f, 0.0555690341f},
-std::array<float,2>{0.568378508f, 0.707303286f},
-std::array<float,2>{0.868304312f, 0.279755324f},
-std::array<float,2>{0.0742594078f, 0.973642945f},
-std::array<float,2>{0.180376127f, 0.402544349f},
-std::array<float,2>{0.954627633f, 0.833343089f},
-std::array<float,2>{0.71005851f, 0.203680098f},
-std::array<float,2>{0.418168962f, 0.576737463f},
-std::array<float,2>{0.203681648f, 0.0701849908f},
-std::array<float,2>{0.878608227f, 0.664349377f},
-std::array<float,2>{0.67031008f, 0.329962283f},
-std::array<float,2>{0.459728807f, 0.909088075f},
-std::array<float,2>{0.309505582f, 0.48456794f},
-std::array<float,2>{0.531928062f, 0.805546343f},
-std::array<float,2>{0.785794556f, 0.180646747f},
-std::array<float,2>{0.00250810827f, 0.547985137f},
-std::array<float,2>{0.384254366f, 0.242231146f},
-std::array<float,2>{0.728663385f, 0.614828587f},
-std::array<float,2>{0.97792232f, 0.411143124f},
-std::array<float,2>{0.125579089f, 0.856343865f},
-std::array<float,2>{0.120131597f, 0.284283549f},
-std::array<float,2>{0.835823774f, 0.944917142f},
-std::array<float,2>{0.605391145f, 0.0223084632f},
-std::array<float,2>{0.35510236f, 0.722769439f},
-std::array<float,2>{0.172716677f, 0.146327823f},
-std::array<float,2>{0.963848054f, 0.507641017f},
-std::array<float,2>{0.714460373f, 0.462641686f},
-std::array<float,2>{0.412501991f, 0.753066361f},
-std::array<float,2>{0.32267499f, 0.344218224f},
-std::array<float,2>{0.574675798f, 0.884324133f},
-std::array<float,2>{0.861215293f, 0.119547926f},
-std::array<float,2>{0.0659226254f, 0.653142869f},
-std::array<float,2>{0.474239856f, 0.0457394905f},
-std::array<float,2>{0.632761657f, 0.688555658f},
-std::array<float,2>{0.911070824f, 0.260858417f},
-std::array<float,2>{0.225709319f, 0.992503226f},
-std::array<float,2>{0.0425963923f, 0.378011525f},
-std::array<float,2>{0.754051566f, 0.826233983f},
-std::array<float,2>{0.500630498f, 0.195661232f},
-std::array<float,2>{0.267880321f, 0.583949924f},
-std::array<float,2>{0.116583936f, 0.086345911f},
-std::array<float,2>{0.841425419f, 0.678820312f},
-std::array<float,2>{0.598975599f, 0.327165037f},
-std::array<float,2>{0.347741932f, 0.922881246f},
-std::array<float,2>{0.381692469f, 0.470228016f},
-std::array<float,2>{0.722022533f, 0.796047866f},
-std::array<float,2>{0.968794703f, 0.159630418f},
-std::array<float,2>{0.135862648f, 0.536599636f},
-std::array<float,2>{0.299995482f, 0.225637928f},
-std::array<float,2>{0.541513026f, 0.597119451f},
-std::array<float,2>{0.789159834f, 0.434439838f},
-std::array<float,2>{0.013181814f, 0.866706312f},
-std::array<float,2>{0.213762701f, 0.307471663f},
-std::array<float,2>{0.886410356f, 0.9612391f},
-std::array<float,2>{0.659955025f, 0.00474938704f},
-std::array<float,2>{0.461326033f, 0.734848738f},
-std::array<float,2>{0.0234636962f, 0.207434535f},
-std::array<float,2>{0.799984097f, 0.572343051f},
-std::array<float,2>{0.557771385f, 0.400589526f},
-std::array<float,2>{0.284435004f, 0.829033494f},
-std::array<float,2>{0.443629175f, 0.275462478f},
-std::array<float,2>{0.685955167f, 0.972304881f},
-std::array<float,2>{0.905893624f, 0.059237171f},
-std::array<float,2>{0.202684298f, 0.70504719f},
-std::array<float,2>{0.368079036f, 0.108807757f},
-std::array<float,2>{0.617149293f, 0.637801886f},
-std::array<float,2>{0.822219491f, 0.366890371f},
-std::array<float,2>{0.0991088524f, 0.90144968f},
-std::array<float,2>{0.145852566f, 0.44379282f},
-std::array<float,2>{0.988790751f, 0.766166866f},
-std::array<float,2>{0.745323062f, 0.135086596f},
-std::array<float,2>{0.399441749f, 0.53066504f},
-std::array<float,2>{0.237369522f, 0.0172300152f},
-std::array<float,2>{0.933253825f, 0.720824182f},
-std::array<float,2>{0.648116767f, 0.288700879f},
-std::array<float,2>{0.488861173f, 0.939895809f},
-std::array<float,2>{0.25352335f, 0.408531547f},
-std::array<float,2>{0.528187335f, 0.85239619f},
-std::array<float,2>{0.770712912f, 0.246450752f},
-std::array<float,2>{0.0553354397f, 0.609838843f},
-std::array<float,2>{0.426912218f, 0.18620649f},
-std::array<float,2>{0.689026415f, 0.551432192f},
-std::array<float,2>{0.942093313f, 0.489769578f},
-std::array<float,2>{0.167748258f, 0.811973691f},
-std::array<float,2>{0.0846285075f, 0.335066676f},
-std::array<float,2>{0.850393534f, 0.910676956f},
-std::array<float,2>{0.593247712f, 0.0651007146f},
-std::array<float,2>{0.340038896f, 0.67178303f},
-std::array<float,2>{0.19318074f, 0.238117456f},
-std::array<float,2>{0.893774092f, 0.621797681f},
-std::array<float,2>{0.67641443f, 0.41893363f},
-std::array<float,2>{0.451364756f, 0.85087198f},
-std::array<float,2>{0.290670753f, 0.289252222f},
-std::array<float,2>{0.552246273f, 0.948850334f},
-std::array<float,2>{0.809828877f, 0.0246763751f},
-std::array<float,2>{0.0222096145f, 0.729639471f},
-std::array<float,2>{0.396002084f, 0.0720055029f},
-std::array<float,2>{0.734938085f, 0.657281756f},
-std::array<float,2>{0.999006867f, 0.337965786f},
-std::array<float,2>{0.151083216f, 0.918441772f},
-std::array<float,2>{0.102336951f, 0.494530976f},
-std::array<float,2>{0.816210806f, 0.803081512f},
-std::array<float,2>{0.618656576f, 0.174574658f},
-std::array<float,2>{0.360951692f, 0.562187433f},
-std::array<float,2>{0.0522133037f, 0.0535360388f},
-std::array<float,2>{0.777440429f, 0.716561079f},
-std::array<float,2>{0.51783365f, 0.2706424f},
-std::array<float,2>{0.257840782f, 0.978961527f},
-std::array<float,2>{0.493976384f, 0.39632684f},
-std::array<float,2>{0.650775909f, 0.837886691f},
-std::array<float,2>{0.929597378f, 0.212205574f},
-std::array<float,2>{0.243169039f, 0.564580679f},
-std::array<float,2>{0.331271172f, 0.130551159f},
-std::array<float,2>{0.582374513f, 0.523317814f},
-std::array<float,2>{0.852734387f, 0.449618816f},
-std::array<float,2>{0.0932916254f, 0.777166188f},
-std::array<float,2>{0.157720774f, 0.368190885f},
-std::array<float,2>{0.946892798f, 0.898027003f},
-std::array<float,2>{0.697891891f, 0.093945764f},
-std::array<float,2>{0.435082525f, 0.628651083f},
-std::array<float,2>{0.0714296922f, 0.167788178f},
-std::array<float,2>{0.872426033f, 0.544886053f},
-std::array<float,2>{0.565750122f, 0.477304876f},
-std::array<float,2>{0.315296769f, 0.785344899f},
-std::array<float,2>{0.416072518f, 0.313366115f},
-std::array<float,2>{0.706108332f, 0.934023857f},
-std::array<float,2>{0.958990872f, 0.0790332407f},
-std::array<float,2>{0.186637685f, 0.687247276f},
-std::array<float,2>{0.274896204f, 0.00807893835f},
-std::array<float,2>{0.510603905f, 0.748555183f},
-std::array<float,2>{0.762034953f, 0.297893792f},
-std::array<float,2>{0.0330050364f, 0.96027416f},
-std::array<float,2>{0.232950062f, 0.426214308f},
-std::array<float,2>{0.916558146f, 0.871170759f},
-std::array<float,2>{0.63871026f, 0.23420313f},
-std::array<float,2>{0.478142589f, 0.608345687f},
-std::array<float,2>{0.13174738f, 0.113508441f},
-std::array<float,2>{0.980508089f, 0.643178105f},
-std::array<float,2>{0.733413458f, 0.357022017f},
-std::array<float,2>{0.38742128f, 0.88175106f},
-std::array<float,2>{0.35624221f, 0.457951725f},
-std::array<float,2>{0.608852744f, 0.761999369f},
-std::array<float,2>{0.828648806f, 0.148878649f},
-std::array<float,2>{0.121917777f, 0.508099973f},
-std::array<float,2>{0.454351097f, 0.192777678f},
-std::array<float,2>{0.665816486f, 0.587976635f},
-std::array<float,2>{0.879890621f, 0.383309484f},
-std::array<float,2>{0.209099755f, 0.817050874f},
-std::array<float,2>{0.00579837011f, 0.251581252f},
-std::array<float,2>{0.784202278f, 0.990625858f},
-std::array<float,2>{0.536404669f, 0.0362844057f},
-std::array<float,2>{0.306640774f, 0.700012207f},
-std::array<float,2>{0.217522413f, 0.126233995f},
-std::array<float,2>{0.887471259f, 0.517556906f},
-std::array<float,2>{0.661766648f, 0.445320338f},
-std::array<float,2>{0.466858238f, 0.78039974f},
-std::array<float,2>{0.302000701f, 0.373036176f},
-std::array<float,2>{0.545582235f, 0.892040908f},
-std::array<float,2>{0.795219421f, 0.101279445f},
-std::array<float,2>{0.00852495991f, 0.632398009f},
-std::array<float,2>{0.375405967f, 0.0475944802f},
-std::array<float,2>{0.726142168f, 0.714660227f},
-std::array<float,2>{0.973726571f, 0.269166648f},
-std::array<float,2>{0.137479201f, 0.984158635f},
-std::array<float,2>{0.111746632f, 0.392405659f},
-std::array<float,2>{0.839419186f, 0.842943013f},
-std::array<float,2>{0.594694614f, 0.215934709f},
-std::array<float,2>{0.347551167f, 0.568223476f},
-std::array<float,2>{0.046135556f, 0.0754071102f},
-std::array<float,2>{0.752719462f, 0.663712382f},
-std::array<float,2>{0.504395366f, 0.343686938f},
-std::array<float,2>{0.269817591f, 0.914606988f},
-std::array<float,2>{0.471215963f, 0.497620523f},
-std::array<float,2>{0.626686931f, 0.800325215f},
-std::array<float,2>{0.908132851f, 0.177393869f},
-std::array<float,2>{0.220681161f, 0.554969013f},
-std::array<float,2>{0.326949924f, 0.242110178f},
-std::array<float,2>{0.571093559f, 0.619309962f},
-std::array<float,2>{0.865184426f, 0.415563434f},
-std::array<float,2>{0.0688286871f, 0.846086323f},
-std::array<float,2>{0.178389132f, 0.293753505f},
-std::array<float,2>{0.965233803f, 0.953118742f},
-std::array<float,2>{0.717178941f, 0.0311240964f},
-std::array<float,2>{0.407735974f, 0.732447267f},
-std::array<float,2>{0.0783348605f, 0.189018294f},
-std::array<float,2>{0.846930146f, 0.591733754f},
-std::array<float,2>{0.586561739f, 0.386838228f},
-std::array<float,2>{0.336450636f, 0.81545347f},
-std::array<float,2>{0.422005504f, 0.257592499f},
-std::array<float,2>{0.693556845f, 0.986245751f},
-std::array<float,2>{0.938672841f, 0.0346243232f},
-std::array<float,2>{0.169639066f, 0.698939323f},
-std::array<float,2>{0.255316377f, 0.112072602f},
-std::array<float,2>{0.523710132f, 0.645977378f},
-std::array<float,2>{0.766908824f, 0.355299354f},
-std::array<float,2>{0.0594604723f, 0.876208425f},
-std::array<float,2>{0.239977747f, 0.454295218f},
-std::array<float,2>{0.934787691f, 0.758012056f},
-std::array<float,2>{0.641993403f, 0.155580118f},
-std::array<float,2>{0.484987825f, 0.514574051f},
-std::array<float,2>{0.144350231f, 0.0119312452f},
-std::array<float,2>{0.988125324f, 0.74228251f},
-std::array<float,2>{0.747030914f, 0.304601848f},
-std::array<float,2>{0.403933913f, 0.955106318f},
-std::array<float,2>{0.374039322f, 0.424219042f},
-std::array<float,2>{0.611116827f, 0.868054152f},
-std::array<float,2>{0.826748133f, 0.228289321f},
-std::array<float,2>{0.0975924805f, 0.602541149f},
-std::array<float,2>{0.440122694f, 0.170331106f},
-std::array<float,2>{0.681680202f, 0.541482568f},
-std::array<float,2>{0.899102807f, 0.48198247f},
-std::array<float,2>{0.19847855f, 0.781666279f},
-std::array<float,2>{0.0290677939f, 0.317218095f},
-std::array<float,2>{0.801995695f, 0.932590961f},
-std::array<float,2>{0.558816731f, 0.0838921815f},
-std::array<float,2>{0.285861373f, 0.682311118f},
-std::array<float,2>{0.16227442f, 0.219290063f},
-std::array<float,2>{0.949575901f, 0.598469913f},
-std::array<float,2>{0.699349165f, 0.430957645f},
-std::array<float,2>{0.430334389f, 0.861072719f},
-std::array<float,2>{0.333038062f, 0.310848683f},
-std::array<float,2>{0.57965678f, 0.965816081f},
-std::array<float,2>{0.858042419f, 0.00299047655f},
-std::array<float,2>{0.0872294754f, 0.740614474f},
-std::array<float,2>{0.498407602f, 0.0935014933f},
-std::array<float,2>{0.652568936f, 0.675256848f},
-std::array<float,2>{0.922854185f, 0.323663294f},
-std::array<float,2>{0.24842374f, 0.929318488f},
-std::array<float,2>{0.0478481054f, 0.475538552f},
-std::array<float,2>{0.776764333f, 0.790808022f},
-std::array<float,2>{0.521039188f, 0.162490472f},
-std::array<float,2>{0.262972146f, 0.532347858f},
-std::array<float,2>{0.108542249f, 0.0402087979f},
-std::array<float,2>{0.819617271f, 0.692822933f},
-std::array<float,2>{0.621357441f, 0.265561312f},
-std::array<float,2>{0.364871264f, 0.999961972f},
-std::array<float,2>{0.392026037f, 0.381918222f},
-std::array<float,2>{0.739180088f, 0.821044922f},
-std::array<float,2>{0.995845437f, 0.199983761f},
-std::array<float,2>{0.153053299f, 0.580006003f},
-std::array<float,2>{0.293244511f, 0.143333048f},
-std::array<float,2>{0.547168076f, 0.503149688f},
-std::array<float,2>{0.804868817f, 0.46695745f},
-std::array<float,2>{0.0177230462f, 0.757020891f},
-std::array<float,2>{0.187956378f, 0.35047397f},
-std::array<float,2>{0.895884633f, 0.88970381f},
-std::array<float,2>{0.674783766f, 0.121511921f},
-std::array<float,2>{0.448696166f, 0.650123179f},
-std::array<float,2>{0.000903359149f, 0.181897581f},
-std::array<float,2>{0.787922323f, 0.550031185f},
-std::array<float,2>{0.533575356f, 0.488266379f},
-std::array<float,2>{0.310584366f, 0.807781458f},
-std::array<float,2>{0.457713604f, 0.331435591f},
-std::array<float,2>{0.668699086f, 0.907031f},
-std::array<float,2>{0.875529349f, 0.068276152f},
-std::array<float,2>{0.206265613f, 0.666460752f},
-std::array<float,2>{0.35166356f, 0.0208352227f},
-std::array<float,2>{0.601813138f, 0.726297498f},
-std::array<float,2>{0.833580315f, 0.282271922f},
-std::array<float,2>{0.11890395f, 0.941940963f},
-std::array<float,2>{0.127319843f, 0.41404134f},
-std::array<float,2>{0.978973091f, 0.858008087f},
-std::array<float,2>{0.727263272f, 0.245484397f},
-std::array<float,2>{0.385668874f, 0.615515351f},
-std::array<float,2>{0.226696774f, 0.103529304f},
-std::array<float,2>{0.919731379f, 0.633926451f},
-std::array<float,2>{0.633089066f, 0.359380692f},
-std::array<float,2>{0.483822197f, 0.904620707f},
-std::array<float,2>{0.279556423f, 0.437582403f},
-std::array<float,2>{0.512130678f, 0.769769609f},
-std::array<float,2>{0.758622646f, 0.138137609f},
-std::array<float,2>{0.0369337797f, 0.523801684f},
-std::array<float,2>{0.420637727f, 0.205722511f},
-std::array<float,2>{0.707415879f, 0.575716138f},
-std::array<float,2>{0.956172407f, 0.40552792f},
-std::array<float,2>{0.181886703f, 0.8353405f},
-std::array<float,2>{0.0769320652f, 0.27912569f},
-std::array<float,2>{0.869314909f, 0.975626826f},
-std::array<float,2>{0.566562533f, 0.0581374541f},
-std::array<float,2>{0.317067862f, 0.709757209f},
-std::array<float,2>{0.13372758f, 0.157072648f},
-std::array<float,2>{0.971300244f, 0.53739804f},
-std::array<float,2>{0.720060229f, 0.472047865f},
-std::array<float,2>{0.379078239f, 0.793081403f},
-std::array<float,2>{0.350693107f, 0.324687541f},
-std::array<float,2>{0.601404607f, 0.924752653f},
-std::array<float,2>{0.842054605f, 0.0893403962f},
-std::array<float,2>{0.114115909f, 0.675825655f},
-std::array<float,2>{0.464478493f, 0.00763233518f},
-std::array<float,2>{0.657600701f, 0.73658216f},
-std::array<float,2>{0.884437382f, 0.304698467f},
-std::array<float,2>{0.212257534f, 0.963909626f},
-std::array<float,2>{0.0153707499f, 0.436964095f},
-std::array<float,2>{0.791806459f, 0.863422155f},
-std::array<float,2>{0.539826334f, 0.22414647f},
-std::array<float,2>{0.297682703f, 0.595549405f},
-std::array<float,2>{0.0629565641f, 0.117968827f},
-std::array<float,2>{0.861381352f, 0.65621227f},
-std::array<float,2>{0.577857137f, 0.347318023f},
-std::array<float,2>{0.320578814f, 0.886120379f},
-std::array<float,2>{0.410545498f, 0.464393139f},
-std::array<float,2>{0.712263823f, 0.750373423f},
-std::array<float,2>{0.961913228f, 0.148117572f},
-std::array<float,2>{0.175499365f, 0.505512357f},
-std::array<float,2>{0.266138583f, 0.198226705f},
-std::array<float,2>{0.502515376f, 0.583990216f},
-std::array<float,2>{0.755951345f, 0.375428557f},
-std::array<float,2>{0.0396069027f, 0.825701416f},
-std::array<float,2>{0.223924145f, 0.258283108f},
-std::array<float,2>{0.912228823f, 0.995162129f},
-std::array<float,2>{0.629763424f, 0.0436997302f},
-std::array<float,2>{0.475572467f, 0.689509869f},
-std::array<float,2>{0.0577789322f, 0.249711841f},
-std::array<float,2>{0.772456646f, 0.612321377f},
-std::array<float,2>{0.529454648f, 0.407702059f},
-std::array<float,2>{0.250942409f, 0.854539514f},
-std::array<float,2>{0.490509719f, 0.286962837f},
-std::array<float,2>{0.645797491f, 0.939275742f},
-std::array<float,2>{0.931224883f, 0.0185374897f},
-std::array<float,2>{0.234951198f, 0.719364464f},
-std::array<float,2>{0.343412071f, 0.0638368502f},
-std::array<float,2>{0.590549231f, 0.668714404f},
-std::array<float,2>{0.848627448f, 0.333243489f},
-std::array<float,2>{0.0834103674f, 0.912997842f},
-std::array<float,2>{0.165029153f, 0.491335571f},
-std::array<float,2>{0.944285631f, 0.810399294f},
-std::array<float,2>{0.689508319f, 0.184499443f},
-std::array<float,2>{0.428464442f, 0.553480089f},
-std::array<float,2>{0.200501606f, 0.0623430721f},
-std::array<float,2>{0.902959168f, 0.705133975f},
-std::array<float,2>{0.684816003f, 0.274096429f},
-std::array<float,2>{0.441571683f, 0.970162094f},
-std::array<float,2>{0.282141894f, 0.400327235f},
-std::array<float,2>{0.555705845f, 0.831903994f},
-std::array<float,2>{0.797764421f, 0.209295347f},
-std::array<float,2>{0.0266805645f, 0.570855021f},
-std::array<float,2>{0.401446372f, 0.133000776f},
-std::array<float,2>{0.743397832f, 0.527541578f},
-std::array<float,2>{0.990748107f, 0.443336636f},
-std::array<float,2>{0.146809444f, 0.768521786f},
-std::array<float,2>{0.0996242017f, 0.363859057f},
-std::array<float,2>{0.823622346f, 0.899776638f},
-std::array<float,2>{0.614382148f, 0.106737725f},
-std::array<float,2>{0.369989395f, 0.640505552f},
-std::array<float,2>{0.244376212f, 0.213512465f},
-std::array<float,2>{0.927110851f, 0.563626289f},
-std::array<float,2>{0.650212467f, 0.397671729f},
-std::array<float,2>{0.495113194f, 0.838442147f},
-std::array<float,2>{0.261492729f, 0.273140907f},
-std::array<float,2>{0.516649842f, 0.977027416f},
-std::array<float,2>{0.780466557f, 0.0512796566f},
-std::array<float,2>{0.0540910438f, 0.718665242f},
-std::array<float,2>{0.436383754f, 0.0968801603f},
-std::array<float,2>{0.696918011f, 0.626744032f},
-std::array<float,2>{0.948309481f, 0.369688272f},
-std::array<float,2>{0.158505142f, 0.89458096f},
-std::array<float,2>{0.0904764757f, 0.452106357f},
-std::array<float,2>{0.854442537f, 0.775101304f},
-std::array<float,2>{0.585770786f, 0.131403819f},
-std::array<float,2>{0.329466373f, 0.519973338f},
-std::array<float,2>{0.0210134704f, 0.0254656393f},
-std::array<float,2>{0.810811818f, 0.727303922f},
-std::array<float,2>{0.554563105f, 0.291338891f},
-std::array<float,2>{0.292188853f, 0.945958912f},
-std::array<float,2>{0.450433284f, 0.421340972f},
-std::array<float,2>{0.678210199f, 0.847801805f},
-std::array<float,2>{0.891540945f, 0.234614909f},
-std::array<float,2>{0.194144771f, 0.624793053f},
-std::array<float,2>{0.363247871f, 0.173593342f},
-std::array<float,2>{0.620419502f, 0.559814155f},
-std::array<float,2>{0.813070238f, 0.492465049f},
-std::array<float,2>{0.104344636f, 0.801109791f},
-std::array<float,2>{0.150360361f, 0.337720901f},
-std::array<float,2>{0.997843564f, 0.920431197f},
-std::array<float,2>{0.737529576f, 0.0734471455f},
-std::array<float,2>{0.397981167f, 0.659285605f},
-std::array<float,2>{0.124909252f, 0.151539013f},
-std::array<float,2>{0.831851959f, 0.511202514f},
-std::array<float,2>{0.606779099f, 0.460687727f},
-std::array<float,2>{0.359176636f, 0.763907313f},
-std::array<float,2>{0.389145017f, 0.358703285f},
-std::array<float,2>{0.731914639f, 0.878954172f},
-std::array<float,2>{0.983884752f, 0.117080472f},
-std::array<float,2>{0.130791962f, 0.642071068f},
-std::array<float,2>{0.304718047f, 0.0373570919f},
-std::array<float,2>{0.537541032f, 0.70148015f},
-std::array<float,2>{0.782254994f, 0.253088295f},
-std::array<float,2>{0.00713209249f, 0.98930347f},
-std::array<float,2>{0.207216844f, 0.386128724f},
-std::array<float,2>{0.882398427f, 0.819524109f},
-std::array<float,2>{0.667321622f, 0.194918841f},
-std::array<float,2>{0.455536932f, 0.587152421f},
-std::array<float,2>{0.184925824f, 0.0811617672f},
-std::array<float,2>{0.95704639f, 0.685470402f},
-std::array<float,2>{0.704909265f, 0.314926147f},
-std::array<float,2>{0.41548875f, 0.936911404f},
-std::array<float,2>{0.312995136f, 0.479267955f},
-std::array<float,2>{0.563250363f, 0.788810432f},
-std::array<float,2>{0.874602616f, 0.165719345f},
-std::array<float,2>{0.0732529387f, 0.545054317f},
-std::array<float,2>{0.479385108f, 0.232235119f},
-std::array<float,2>{0.63743031f, 0.606628597f},
-std::array<float,2>{0.915207326f, 0.428803056f},
-std::array<float,2>{0.231791109f, 0.874930441f},
-std::array<float,2>{0.0343303271f, 0.300433069f},
-std::array<float,2>{0.764419079f, 0.95890069f},
-std::array<float,2>{0.50839895f, 0.0103291366f},
-std::array<float,2>{0.27696532f, 0.747879922f},
-std::array<float,2>{0.240352124f, 0.155132055f},
-std::array<float,2>{0.936246336f, 0.515130103f},
-std::array<float,2>{0.643644154f, 0.453151792f},
-std::array<float,2>{0.488131851f, 0.759070873f},
-std::array<float,2>{0.255960673f, 0.35404703f},
-std::array<float,2>{0.52568686f, 0.87534529f},
-std::array<float,2>{0.769337833f, 0.112811811f},
-std::array<float,2>{0.0614197291f, 0.644766092f},
-std::array<float,2>{0.425399482f, 0.0332427658f},
-std::array<float,2>{0.693319261f, 0.697724342f},
-std::array<float,2>{0.940837085f, 0.256268859f},
-std::array<float,2>{0.170760557f, 0.98454237f},
-std::array<float,2>{0.0813638493f, 0.388612241f},
-std::array<float,2>{0.844012737f, 0.815069735f},
-std::array<float,2>{0.587998331f, 0.187798187f},
-std::array<float,2>{0.339252263f, 0.589925766f},
-std::array<float,2>{0.0296151023f, 0.0820336044f},
-std::array<float,2>{0.804103911f, 0.683311641f},
-std::array<float,2>{0.561378598f, 0.317626953f},
-std::array<float,2>{0.287663132f, 0.932851017f},
-std::array<float,2>{0.438580483f, 0.480665535f},
-std::array<float,2>{0.680040419f, 0.783140004f},
-std::array<float,2>{0.901817024f, 0.17146419f},
-std::array<float,2>{0.195953339f, 0.542180598f},
-std::array<float,2>{0.371998966f, 0.226949155f},
-std::array<float,2>{0.611575067f, 0.601593852f},
-std::array<float,2>{0.824465513f, 0.425701141f},
-std::array<float,2>{0.0949811116f, 0.868752718f},
-std::array<float,2>{0.140817478f, 0.302768081f},
-std::array<float,2>{0.985752583f, 0.956151307f},
-std::array<float,2>{0.749524891f, 0.0128773199f},
-std::array<float,2>{0.405012429f, 0.74389714f},
-std::array<float,2>{0.110531092f, 0.215537593f},
-std::array<float,2>{0.8378672f, 0.566835284f},
-std::array<float,2>{0.596760213f, 0.39114961f},
-std::array<float,2>{0.345096201f, 0.842293262f},
-std::array<float,2>{0.378514349f, 0.268225491f},
-std::array<float,2>{0.723374546f, 0.982702792f},
-std::array<float,2>{0.975986421f, 0.0487016402f},
-std::array<float,2>{0.140417755f, 0.713846862f},
-std::array<float,2>{0.304265141f, 0.0998031348f},
-std::array<float,2>{0.543666303f, 0.630978167f},
-std::array<float,2>{0.793471813f, 0.371205479f},
-std::array<float,2>{0.0102188773f, 0.891305089f},
-std::array<float,2>{0.216144815f, 0.44632104f},
-std::array<float,2>{0.889211059f, 0.779594958f},
-std::array<float,2>{0.663369536f, 0.125430912f},
-std::array<float,2>{0.466037482f, 0.516357362f},
-std::array<float,2>{0.176757798f, 0.0299978331f},
-std::array<float,2>{0.96783334f, 0.733916342f},
-std::array<float,2>{0.716520786f, 0.294386417f},
-std::array<float,2>{0.40970996f, 0.951725841f},
-std::array<float,2>{0.325599462f, 0.414253473f},
-std::array<float,2>{0.572419405f, 0.847380877f},
-std::array<float,2>{0.865868866f, 0.240746379f},
-std::array<float,2>{0.0670367256f, 0.620965481f},
-std::array<float,2>{0.469273299f, 0.176285207f},
-std::array<float,2>{0.6276775f, 0.555701435f},
-std::array<float,2>{0.909277916f, 0.496733844f},
-std::array<float,2>{0.22251758f, 0.799467027f},
-std::array<float,2>{0.0430842228f, 0.342365086f},
-std::array<float,2>{0.750729024f, 0.915424764f},
-std::array<float,2>{0.506869435f, 0.0746138692f},
-std::array<float,2>{0.272817522f, 0.662910581f},
-std::array<float,2>{0.126440704f, 0.244300604f},
-std::array<float,2>{0.977334142f, 0.616755784f},
-std::array<float,2>{0.729561448f, 0.412865728f},
-std::array<float,2>{0.382971942f, 0.859297574f},
-std::array<float,2>{0.354489267f, 0.2820445f},
-std::array<float,2>{0.603990436f, 0.943309903f},
-std::array<float,2>{0.834496915f, 0.0195854437f},
-std::array<float,2>{0.119555369f, 0.72463578f},
-std::array<float,2>{0.460600108f, 0.0667942315f},
-std::array<float,2>{0.671346664f, 0.667720675f},
-std::array<float,2>{0.87729007f, 0.330558926f},
-std::array<float,2>{0.204239681f, 0.907884717f},
-std::array<float,2>{0.00318778423f, 0.487034082f},
-std::array<float,2>{0.786872923f, 0.806993186f},
-std::array<float,2>{0.532649636f, 0.183432251f},
-std::array<float,2>{0.309737921f, 0.549505651f},
-std::array<float,2>{0.0756638572f, 0.0568723194f},
-std::array<float,2>{0.867451727f, 0.710628986f},
-std::array<float,2>{0.569345891f, 0.277985156f},
-std::array<float,2>{0.320088357f, 0.97513181f},
-std::array<float,2>{0.419660062f, 0.404670328f},
-std::array<float,2>{0.709429801f, 0.833999455f},
-std::array<float,2>{0.953722775f, 0.206750557f},
-std::array<float,2>{0.180980086f, 0.574476004f},
-std::array<float,2>{0.277665049f, 0.137230411f},
-std::array<float,2>{0.513819635f, 0.525133133f},
-std::array<float,2>{0.761536598f, 0.438757449f},
-std::array<float,2>{0.0372188166f, 0.770652294f},
-std::array<float,2>{0.229337379f, 0.361172736f},
-std::array<float,2>{0.920664668f, 0.906040549f},
-std::array<float,2>{0.635662079f, 0.105382755f},
-std::array<float,2>{0.480735183f, 0.633102834f},
-std::array<float,2>{0.0489483811f, 0.163347989f},
-std::array<float,2>{0.775253594f, 0.531830788f},
-std::array<float,2>{0.523046792f, 0.47593677f},
-std::array<float,2>{0.264722794f, 0.789289951f},
-std::array<float,2>{0.496752053f, 0.323204041f},
-std::array<float,2>{0.655655622f, 0.928386629f},
-std::array<float,2>{0.924991608f, 0.0921095163f},
-std::array<float,2>{0.246464908f, 0.674720645f},
-std::array<float,2>{0.334413171f, 0.00220927992f},
-std::array<float,2>{0.580719948f, 0.741970718f},
-std::array<float,2>{0.856903553f, 0.311994553f},
-std::array<float,2>{0.0884537175f, 0.966478527f},
-std::array<float,2>{0.162054777f, 0.429862589f},
-std::array<float,2>{0.952279568f, 0.859505057f},
-std::array<float,2>{0.702509284f, 0.220147625f},
-std::array<float,2>{0.431896716f, 0.599379718f},
-std::array<float,2>{0.19097966f, 0.122671857f},
-std::array<float,2>{0.897402585f, 0.648498476f},
-std::array<float,2>{0.673655391f, 0.350935012f},
-std::array<float,2>{0.446150094f, 0.889306188f},
-std::array<float,2>{0.296650916f, 0.468267888f},
-std::array<float,2>{0.548882723f, 0.756541431f},
-std::array<float,2>{0.807906866f, 0.143716022f},
-std::array<float,2>{0.0159254782f, 0.502886653f},
-std::array<float,2>{0.394350797f, 0.200877801f},
-std::array<float,2>{0.740656912f, 0.578272998f},
-std::array<float,2>{0.994101703f, 0.380968153f},
-std::array<float,2>{0.15478085f, 0.821437657f},
-std::array<float,2>{0.105505183f, 0.263672084f},
-std::array<float,2>{0.816698968f, 0.998608291f},
-std::array<float,2>{0.624096036f, 0.0392723903f},
-std::array<float,2>{0.366936177f, 0.691741586f},
-std::array<float,2>{0.166874558f, 0.185522169f},
-std::array<float,2>{0.942981541f, 0.554670334f},
-std::array<float,2>{0.688264668f, 0.490689784f},
-std::array<float,2>{0.425869972f, 0.80942589f},
-std::array<float,2>{0.341377109f, 0.332555622f},
-std::array<float,2>{0.591992378f, 0.91362983f},
-std::array<float,2>{0.850624084f, 0.0633914322f},
-std::array<float,2>{0.0857011825f, 0.669476628f},
-std::array<float,2>{0.489351898f, 0.0191507787f},
-std::array<float,2>{0.647365332f, 0.720187724f},
-std::array<float,2>{0.931855798f, 0.285619795f},
-std::array<float,2>{0.237176523f, 0.937882304f},
-std::array<float,2>{0.0558289513f, 0.407076329f},
-std::array<float,2>{0.770110071f, 0.854435921f},
-std::array<float,2>{0.528784275f, 0.248146534f},
-std::array<float,2>{0.252572864f, 0.611449182f},
-std::array<float,2>{0.0979500785f, 0.105506919f},
-std::array<float,2>{0.821029127f, 0.638920188f},
-std::array<float,2>{0.61552763f, 0.364407986f},
-std::array<float,2>{0.368932754f, 0.899352193f},
-std::array<float,2>{0.398798704f, 0.441751093f},
-std::array<float,2>{0.744591713f, 0.769471169f},
-std::array<float,2>{0.990092099f, 0.134682581f},
-std::array<float,2>{0.144844726f, 0.528736055f},
-std::array<float,2>{0.283914268f, 0.210096866f},
-std::array<float,2>{0.557594061f, 0.571311414f},
-std::array<float,2>{0.799467742f, 0.399010897f},
-std::array<float,2>{0.0245959107f, 0.830899f},
-std::array<float,2>{0.202031463f, 0.275201797f},
-std::array<float,2>{0.904372394f, 0.968988657f},
-std::array<float,2>{0.687121749f, 0.0606655441f},
-std::array<float,2>{0.445230693f, 0.706082821f},
-std::array<float,2>{0.0122619411f, 0.22348766f},
-std::array<float,2>{0.790600479f, 0.594127774f},
-std::array<float,2>{0.542334259f, 0.435627878f},
-std::array<float,2>{0.299364269f, 0.865198672f},
-std::array<float,2>{0.462118745f, 0.306552708f},
-std::array<float,2>{0.658922434f, 0.963289738f},
-std::array<float,2>{0.885011494f, 0.00613960391f},
-std::array<float,2>{0.214632139f, 0.738170743f},
-std::array<float,2>{0.349172384f, 0.0880645216f},
-std::array<float,2>{0.598505437f, 0.676990151f},
-std::array<float,2>{0.840550125f, 0.326076508f},
-std::array<float,2>{0.115356565f, 0.925061882f},
-std::array<float,2>{0.134775937f, 0.471139193f},
-std::array<float,2>{0.970282257f, 0.794260502f},
-std::array<float,2>{0.720815957f, 0.157545418f},
-std::array<float,2>{0.382140785f, 0.538321197f},
-std::array<float,2>{0.225106284f, 0.0440227352f},
-std::array<float,2>{0.911538839f, 0.69126457f},
-std::array<float,2>{0.631254435f, 0.259477913f},
-std::array<float,2>{0.472869426f, 0.994208217f},
-std::array<float,2>{0.268768519f, 0.376859874f},
-std::array<float,2>{0.501667619f, 0.824512839f},
-std::array<float,2>{0.755409539f, 0.198550552f},
-std::array<float,2>{0.0415081382f, 0.585851967f},
-std::array<float,2>{0.41354692f, 0.147192031f},
-std::array<float,2>{0.713192344f, 0.50401032f},
-std::array<float,2>{0.96414721f, 0.463176906f},
-std::array<float,2>{0.172976643f, 0.750978827f},
-std::array<float,2>{0.0653702393f, 0.346050769f},
-std::array<float,2>{0.859589815f, 0.885689795f},
-std::array<float,2>{0.575838804f, 0.119001582f},
-std::array<float,2>{0.323765188f, 0.654465258f},
-std::array<float,2>{0.210159928f, 0.194259599f},
-std::array<float,2>{0.879669845f, 0.58641392f},
-std::array<float,2>{0.664448917f, 0.385370642f},
-std::array<float,2>{0.453192025f, 0.81888783f},
-std::array<float,2>{0.308544487f, 0.252435684f},
-std::array<float,2>{0.53540206f, 0.988658428f},
-std::array<float,2>{0.783402801f, 0.0385161415f},
-std::array<float,2>{0.00413834397f, 0.703024328f},
-std::array<float,2>{0.387924582f, 0.115424134f},
-std::array<float,2>{0.732548952f, 0.641321361f},
-std::array<float,2>{0.98192209f, 0.357672036f},
-std::array<float,2>{0.132601157f, 0.879993379f},
-std::array<float,2>{0.122753985f, 0.459242731f},
-std::array<float,2>{0.82912755f, 0.76555866f},
-std::array<float,2>{0.608010232f, 0.150964886f},
-std::array<float,2>{0.357070893f, 0.510603905f},
-std::array<float,2>{0.0318801403f, 0.0109720463f},
-std::array<float,2>{0.763568461f, 0.746111035f},
-std::array<float,2>{0.511174262f, 0.298936903f},
-std::array<float,2>{0.274145693f, 0.957461298f},
-std::array<float,2>{0.477023602f, 0.428037643f},
-std::array<float,2>{0.640266299f, 0.87380749f},
-std::array<float,2>{0.917351723f, 0.23095955f},
-std::array<float,2>{0.234328121f, 0.606293678f},
-std::array<float,2>{0.315464377f, 0.164445311f},
-std::array<float,2>{0.564512193f, 0.546377838f},
-std::array<float,2>{0.871104836f, 0.480352014f},
-std::array<float,2>{0.0710156336f, 0.787687778f},
-std::array<float,2>{0.186425343f, 0.315508127f},
-std::array<float,2>{0.960608184f, 0.935690165f},
-std::array<float,2>{0.70532167f, 0.0804386064f},
-std::array<float,2>{0.41731301f, 0.683820009f},
-std::array<float,2>{0.0925265849f, 0.13245365f},
-std::array<float,2>{0.852497578f, 0.520852268f},
-std::array<float,2>{0.583137512f, 0.452987373f},
-std::array<float,2>{0.330802381f, 0.774185896f},
-std::array<float,2>{0.434221417f, 0.370834202f},
-std::array<float,2>{0.698559046f, 0.896198332f},
-std::array<float,2>{0.94547534f, 0.0965019614f},
-std::array<float,2>{0.157079265f, 0.625179827f},
-std::array<float,2>{0.259453654f, 0.0517844819f},
-std::array<float,2>{0.518845201f, 0.717167318f},
-std::array<float,2>{0.779074848f, 0.271759987f},
-std::array<float,2>{0.0515786484f, 0.978131056f},
-std::array<float,2>{0.242948547f, 0.396623164f},
-std::array<float,2>{0.928268313f, 0.8394472f},
-std::array<float,2>{0.651718438f, 0.214152902f},
-std::array<float,2>{0.492677271f, 0.562653959f},
-std::array<float,2>{0.151592314f, 0.0732156411f},
-std::array<float,2>{0.999769628f, 0.658970773f},
-std::array<float,2>{0.735441208f, 0.3360053f},
-std::array<float,2>{0.394945592f, 0.921338797f},
-std::array<float,2>{0.359388113f, 0.493368596f},
-std::array<float,2>{0.617326677f, 0.802446067f},
-std::array<float,2>{0.8145926f, 0.172161356f},
-std::array<float,2>{0.10349068f, 0.558921516f},
-std::array<float,2>{0.452480823f, 0.236045629f},
-std::array<float,2>{0.677672327f, 0.624008656f},
-std::array<float,2>{0.892753482f, 0.420401812f},
-std::array<float,2>{0.191693768f, 0.849228144f},
-std::array<float,2>{0.0230232347f, 0.292679995f},
-std::array<float,2>{0.809427738f, 0.946417928f},
-std::array<float,2>{0.551172793f, 0.0268442873f},
-std::array<float,2>{0.289530635f, 0.727918088f},
-std::array<float,2>{0.197825268f, 0.168450087f},
-std::array<float,2>{0.899534523f, 0.539798498f},
-std::array<float,2>{0.683404863f, 0.482761294f},
-std::array<float,2>{0.441405535f, 0.784871936f},
-std::array<float,2>{0.286218017f, 0.319540024f},
-std::array<float,2>{0.560367703f, 0.93163985f},
-std::array<float,2>{0.801528752f, 0.0859364048f},
-std::array<float,2>{0.0281308349f, 0.679741979f},
-std::array<float,2>{0.4030056f, 0.0146045284f},
-std::array<float,2>{0.747548223f, 0.744779289f},
-std::array<float,2>{0.986657858f, 0.302608371f},
-std::array<float,2>{0.143261239f, 0.953835547f},
-std::array<float,2>{0.0962651372f, 0.422793895f},
-std::array<float,2>{0.827236652f, 0.869399607f},
-std::array<float,2>{0.610135615f, 0.228867918f},
-std::array<float,2>{0.373542398f, 0.604959071f},
-std::array<float,2>{0.0596903898f, 0.110634364f},
-std::array<float,2>{0.766317844f, 0.647255123f},
-std::array<float,2>{0.52518183f, 0.35159114f},
-std::array<float,2>{0.254661202f, 0.878126621f},
-std::array<float,2>{0.485985249f, 0.455441386f},
-std::array<float,2>{0.640707731f, 0.760164261f},
-std::array<float,2>{0.933836222f, 0.153144196f},
-std::array<float,2>{0.238893539f, 0.513579607f},
-std::array<float,2>{0.337656617f, 0.190019816f},
-std::array<float,2>{0.587636292f, 0.592573643f},
-std::array<float,2>{0.846142292f, 0.390228093f},
-std::array<float,2>{0.0798441619f, 0.814255774f},
-std::array<float,2>{0.168067992f, 0.255741596f},
-std::array<float,2>{0.93778944f, 0.987913668f},
-std::array<float,2>{0.694955826f, 0.0328734592f},
-std::array<float,2>{0.423360139f, 0.696814775f},
-std::array<float,2>{0.0694654658f, 0.239154309f},
-std::array<float,2>{0.864198804f, 0.61874944f},
-std::array<float,2>{0.57186377f, 0.41704312f},
-std::array<float,2>{0.327371806f, 0.844477892f},
-std::array<float,2>{0.407055318f, 0.295519888f},
-std::array<float,2>{0.718316913f, 0.949706912f},
-std::array<float,2>{0.966386735f, 0.0289714374f},
-std::array<float,2>{0.179273233f, 0.731522918f},
-std::array<float,2>{0.271422029f, 0.0776659772f},
-std::array<float,2>{0.505086243f, 0.660768092f},
-std::array<float,2>{0.75366205f, 0.341120631f},
-std::array<float,2>{0.045493789f, 0.91717726f},
-std::array<float,2>{0.219469592f, 0.498276532f},
-std::array<float,2>{0.906971335f, 0.797592521f},
-std::array<float,2>{0.625661731f, 0.17834419f},
-std::array<float,2>{0.471932292f, 0.558028042f},
-std::array<float,2>{0.138384193f, 0.0491629392f},
-std::array<float,2>{0.972970784f, 0.711497128f},
-std::array<float,2>{0.7255072f, 0.267014325f},
-std::array<float,2>{0.376546383f, 0.981886387f},
-std::array<float,2>{0.346171439f, 0.393779516f},
-std::array<float,2>{0.594959438f, 0.841528952f},
-std::array<float,2>{0.838855207f, 0.217288122f},
-std::array<float,2>{0.112629935f, 0.568605304f},
-std::array<float,2>{0.468175262f, 0.127126962f},
-std::array<float,2>{0.660308063f, 0.517700195f},
-std::array<float,2>{0.887888014f, 0.448153406f},
-std::array<float,2>{0.218154803f, 0.778592169f},
-std::array<float,2>{0.00924605783f, 0.374176294f},
-std::array<float,2>{0.796559572f, 0.892598093f},
-std::array<float,2>{0.546764195f, 0.0988994986f},
-std::array<float,2>{0.301639289f, 0.630278826f},
-std::array<float,2>{0.182754874f, 0.204105541f},
-std::array<float,2>{0.955768526f, 0.578098714f},
-std::array<float,2>{0.708756149f, 0.403752089f},
-std::array<float,2>{0.421536446f, 0.832671285f},
-std::array<float,2>{0.31754148f, 0.281102657f},
-std::array<float,2>{0.567828417f, 0.972979128f},
-std::array<float,2>{0.87098223f, 0.0561291464f},
-std::array<float,2>{0.0777542442f, 0.708471477f},
-std::array<float,2>{0.48292172f, 0.101981021f},
-std::array<float,2>{0.634640396f, 0.635899723f},
-std::array<float,2>{0.918432236f, 0.362431288f},
-std::array<float,2>{0.228168711f, 0.902375996f},
-std::array<float,2>{0.0358652323f, 0.441103399f},
-std::array<float,2>{0.75930661f, 0.772723556f},
-std::array<float,2>{0.513488591f, 0.138981551f},
-std::array<float,2>{0.280504227f, 0.525819659f},
-std::array<float,2>{0.117224373f, 0.0233803596f},
-std::array<float,2>{0.832103729f, 0.723773718f},
-std::array<float,2>{0.603009522f, 0.283299744f},
-std::array<float,2>{0.353082925f, 0.943513215f},
-std::array<float,2>{0.385774016f, 0.410339445f},
-std::array<float,2>{0.727933347f, 0.856750369f},
-std::array<float,2>{0.979609489f, 0.244004056f},
-std::array<float,2>{0.12875852f, 0.613959372f},
-std::array<float,2>{0.311668366f, 0.180711016f},
-std::array<float,2>{0.535035908f, 0.546888411f},
-std::array<float,2>{0.788326144f, 0.485445738f},
-std::array<float,2>{0.00139060093f, 0.806174755f},
-std::array<float,2>{0.205146983f, 0.328822553f},
-std::array<float,2>{0.876566589f, 0.909358263f},
-std::array<float,2>{0.669376552f, 0.0692999512f},
-std::array<float,2>{0.458209842f, 0.665210724f},
-std::array<float,2>{0.0195305459f, 0.140944362f},
-std::array<float,2>{0.806122541f, 0.501166582f},
-std::array<float,2>{0.548056006f, 0.466640234f},
-std::array<float,2>{0.293982774f, 0.754348457f},
-std::array<float,2>{0.447993964f, 0.34939453f},
-std::array<float,2>{0.67553246f, 0.887636721f},
-std::array<float,2>{0.895059407f, 0.124336936f},
-std::array<float,2>{0.188841835f, 0.650874913f},
-std::array<float,2>{0.363486379f, 0.0422535203f},
-std::array<float,2>{0.622255147f, 0.693372846f},
-std::array<float,2>{0.819098473f, 0.262991458f},
-std::array<float,2>{0.107805751f, 0.997019649f},
-std::array<float,2>{0.153324112f, 0.380623102f},
-std::array<float,2>{0.994537234f, 0.822305739f},
-std::array<float,2>{0.739378512f, 0.201302126f},
-std::array<float,2>{0.3910923f, 0.580609739f},
-std::array<float,2>{0.249673694f, 0.0913549587f},
-std::array<float,2>{0.922437072f, 0.672805667f},
-std::array<float,2>{0.65360862f, 0.321963459f},
-std::array<float,2>{0.499560177f, 0.927106738f},
-std::array<float,2>{0.262290508f, 0.473807424f},
-std::array<float,2>{0.519695461f, 0.792194545f},
-std::array<float,2>{0.776186407f, 0.161707684f},
-std::array<float,2>{0.0481704026f, 0.534548044f},
-std::array<float,2>{0.431381524f, 0.221105844f},
-std::array<float,2>{0.700806081f, 0.601507485f},
-std::array<float,2>{0.950544f, 0.432251155f},
-std::array<float,2>{0.163631424f, 0.861343682f},
-std::array<float,2>{0.0868546367f, 0.308733642f},
-std::array<float,2>{0.859128058f, 0.966835737f},
-std::array<float,2>{0.57877779f, 0.000753786182f},
-std::array<float,2>{0.332439244f, 0.740085661f},
-std::array<float,2>{0.147688866f, 0.135831222f},
-std::array<float,2>{0.991263747f, 0.529660404f},
-std::array<float,2>{0.742363036f, 0.444929749f},
-std::array<float,2>{0.400395691f, 0.767233729f},
-std::array<float,2>{0.370436043f, 0.366200656f},
-std::array<float,2>{0.614195645f, 0.900754035f},
-std::array<float,2>{0.82270807f, 0.107900962f},
-std::array<float,2>{0.100862212f, 0.63757813f},
-std::array<float,2>{0.442600369f, 0.0605038106f},
-std::array<float,2>{0.684024751f, 0.703632176f},
-std::array<float,2>{0.903636932f, 0.276744217f},
-std::array<float,2>{0.199794143f, 0.971193492f},
-std::array<float,2>{0.0258070044f, 0.401513994f},
-std::array<float,2>{0.798187435f, 0.829456627f},
-std::array<float,2>{0.554691851f, 0.208478123f},
-std::array<float,2>{0.282379776f, 0.574130476f},
-std::array<float,2>{0.0826218277f, 0.0661523119f},
-std::array<float,2>{0.849148929f, 0.670761406f},
-std::array<float,2>{0.591256261f, 0.334905714f},
-std::array<float,2>{0.342047811f, 0.911231697f},
-std::array<float,2>{0.429151863f, 0.488697082f},
-std::array<float,2>{0.691042423f, 0.810846269f},
-std::array<float,2>{0.944396257f, 0.186815679f},
-std::array<float,2>{0.165582925f, 0.552061558f},
-std::array<float,2>{0.251161456f, 0.247312233f},
-std::array<float,2>{0.53049469f, 0.611171126f},
-std::array<float,2>{0.773070693f, 0.409469396f},
-std::array<float,2>{0.0569783747f, 0.852579117f},
-std::array<float,2>{0.236025125f, 0.287398219f},
-std::array<float,2>{0.930526733f, 0.940451264f},
-std::array<float,2>{0.645025074f, 0.0159843396f},
-std::array<float,2>{0.492062926f, 0.721783459f},
-std::array<float,2>{0.040723145f, 0.197230861f},
-std::array<float,2>{0.757316709f, 0.582995474f},
-std::array<float,2>{0.503047884f, 0.377239943f},
-std::array<float,2>{0.266973436f, 0.827513754f},
-std::array<float,2>{0.47573331f, 0.259899437f},
-std::array<float,2>{0.630516469f, 0.994060218f},
-std::array<float,2>{0.91327852f, 0.0464570113f},
-std::array<float,2>{0.222659245f, 0.687698066f},
-std::array<float,2>{0.321467072f, 0.120763794f},
-std::array<float,2>{0.576762199f, 0.653716564f},
-std::array<float,2>{0.862935781f, 0.345134914f},
-std::array<float,2>{0.0640838221f, 0.883422673f},
-std::array<float,2>{0.173972249f, 0.461374104f},
-std::array<float,2>{0.962015808f, 0.752642691f},
-std::array<float,2>{0.711311102f, 0.145259202f},
-std::array<float,2>{0.411986679f, 0.506336629f},
-std::array<float,2>{0.211336106f, 0.0051349448f},
-std::array<float,2>{0.88294369f, 0.735716164f},
-std::array<float,2>{0.657065392f, 0.308590174f},
-std::array<float,2>{0.463234931f, 0.962010801f},
-std::array<float,2>{0.29839918f, 0.435213119f},
-std::array<float,2>{0.540735364f, 0.866057396f},
-std::array<float,2>{0.792544842f, 0.224857911f},
-std::array<float,2>{0.0146389324f, 0.595980763f},
-std::array<float,2>{0.380638361f, 0.158638403f},
-std::array<float,2>{0.719558358f, 0.535168171f},
-std::array<float,2>{0.972392678f, 0.468960106f},
-std::array<float,2>{0.134336203f, 0.795739412f},
-std::array<float,2>{0.115219764f, 0.326313198f},
-std::array<float,2>{0.843467176f, 0.922544897f},
-std::array<float,2>{0.600575924f, 0.0869151503f},
-std::array<float,2>{0.350328267f, 0.678136706f},
-std::array<float,2>{0.231373042f, 0.23334986f},
-std::array<float,2>{0.914964259f, 0.608747244f},
-std::array<float,2>{0.637855887f, 0.427694023f},
-std::array<float,2>{0.479601771f, 0.872719586f},
-std::array<float,2>{0.275604188f, 0.29707104f},
-std::array<float,2>{0.509121895f, 0.959683597f},
-std::array<float,2>{0.764725685f, 0.00913653336f},
-std::array<float,2>{0.0335372426f, 0.74972856f},
-std::array<float,2>{0.414842993f, 0.0793251321f},
-std::array<float,2>{0.703797162f, 0.685960352f},
-std::array<float,2>{0.958095431f, 0.314323515f},
-std::array<float,2>{0.183886617f, 0.934954941f},
-std::array<float,2>{0.0726767927f, 0.478273779f},
-std::array<float,2>{0.873068452f, 0.786600232f},
-std::array<float,2>{0.563661337f, 0.166188329f},
-std::array<float,2>{0.313982844f, 0.543225765f},
-std::array<float,2>{0.00674531981f, 0.0361130685f},
-std::array<float,2>{0.781702936f, 0.701040983f},
-std::array<float,2>{0.538481593f, 0.25039798f},
-std::array<float,2>{0.306024283f, 0.992055297f},
-std::array<float,2>{0.456480414f, 0.384176582f},
-std::array<float,2>{0.666726291f, 0.818281114f},
-std::array<float,2>{0.880892336f, 0.191646859f},
-std::array<float,2>{0.208736986f, 0.589118004f},
-std::array<float,2>{0.35752973f, 0.149743468f},
-std::array<float,2>{0.605808079f, 0.509615183f},
-std::array<float,2>{0.830813766f, 0.458719999f},
-std::array<float,2>{0.123397976f, 0.762872517f},
-std::array<float,2>{0.129005909f, 0.355606973f},
-std::array<float,2>{0.982659638f, 0.882342398f},
-std::array<float,2>{0.730959296f, 0.114997596f},
-std::array<float,2>{0.390322745f, 0.644066334f},
-std::array<float,2>{0.105072454f, 0.17525357f},
-std::array<float,2>{0.814171314f, 0.561508656f},
-std::array<float,2>{0.619226873f, 0.495146632f},
-std::array<float,2>{0.361894697f, 0.804151475f},
-std::array<float,2>{0.397384435f, 0.339244962f},
-std::array<float,2>{0.736695051f, 0.919396341f},
-std::array<float,2>{0.996746421f, 0.0706435814f},
-std::array<float,2>{0.149402604f, 0.656390131f},
-std::array<float,2>{0.29191497f, 0.0237767808f},
-std::array<float,2>{0.552923143f, 0.728863597f},
-std::array<float,2>{0.811760128f, 0.290669948f},
-std::array<float,2>{0.0198364705f, 0.947884738f},
-std::array<float,2>{0.194899783f, 0.41960448f},
-std::array<float,2>{0.891972125f, 0.850297511f},
-std::array<float,2>{0.679486692f, 0.236337185f},
-std::array<float,2>{0.450043172f, 0.622288287f},
-std::array<float,2>{0.160077631f, 0.0950236171f},
-std::array<float,2>{0.947370946f, 0.627419949f},
-std::array<float,2>{0.695692897f, 0.367474318f},
-std::array<float,2>{0.436616927f, 0.897330642f},
-std::array<float,2>{0.328207672f, 0.450957954f},
-std::array<float,2>{0.584930062f, 0.775537312f},
-std::array<float,2>{0.855351031f, 0.129256397f},
-std::array<float,2>{0.0915912539f, 0.521877706f},
-std::array<float,2>{0.496010393f, 0.211826891f},
-std::array<float,2>{0.648981333f, 0.56617105f},
-std::array<float,2>{0.926698208f, 0.395130515f},
-std::array<float,2>{0.245147809f, 0.836649716f},
-std::array<float,2>{0.0534350052f, 0.269591421f},
-std::array<float,2>{0.779975474f, 0.979674935f},
-std::array<float,2>{0.516101241f, 0.0544187278f},
-std::array<float,2>{0.260393262f, 0.715294302f},
-std::array<float,2>{0.246668547f, 0.161193058f},
-std::array<float,2>{0.925587833f, 0.534897268f},
-std::array<float,2>{0.655952871f, 0.474498123f},
-std::array<float,2>{0.496403456f, 0.792836726f},
-std::array<float,2>{0.265392274f, 0.321701497f},
-std::array<float,2>{0.52256f, 0.927474678f},
-std::array<float,2>{0.774517179f, 0.0912119672f},
-std::array<float,2>{0.0495283045f, 0.671881557f},
-std::array<float,2>{0.432291031f, 0.000355695403f},
-std::array<float,2>{0.703037858f, 0.739493191f},
-std::array<float,2>{0.952724099f, 0.30910781f},
-std::array<float,2>{0.161378905f, 0.967648745f},
-std::array<float,2>{0.0883026198f, 0.431910634f},
-std::array<float,2>{0.857256055f, 0.862011909f},
-std::array<float,2>{0.580265522f, 0.221618533f},
-std::array<float,2>{0.334890515f, 0.601010382f},
-std::array<float,2>{0.0163404513f, 0.124554612f},
-std::array<float,2>{0.808205783f, 0.650966167f},
-std::array<float,2>{0.549665987f, 0.348756492f},
-std::array<float,2>{0.295998573f, 0.8868168f},
-std::array<float,2>{0.445613593f, 0.466110677f},
-std::array<float,2>{0.673106313f, 0.75478369f},
-std::array<float,2>{0.896642089f, 0.141230509f},
-std::array<float,2>{0.190901816f, 0.501704574f},
-std::array<float,2>{0.366226077f, 0.20206964f},
-std::array<float,2>{0.624824047f, 0.580259562f},
-std::array<float,2>{0.81699276f, 0.380329698f},
-std::array<float,2>{0.106152207f, 0.822890759f},
-std::array<float,2>{0.154856786f, 0.263428956f},
-std::array<float,2>{0.99331373f, 0.996136844f},
-std::array<float,2>{0.740940988f, 0.042811323f},
-std::array<float,2>{0.393959254f, 0.694268823f},
-std::array<float,2>{0.11991328f, 0.243457228f},
-std::array<float,2>{0.834421694f, 0.6134969f},
-std::array<float,2>{0.60410434f, 0.410769492f},
-std::array<float,2>{0.353696167f, 0.857368469f},
-std::array<float,2>{0.383450776f, 0.284003645f},
-std::array<float,2>{0.730419934f, 0.94402957f},
-std::array<float,2>{0.976772666f, 0.0227398705f},
-std::array<float,2>{0.126753002f, 0.724525273f},
-std::array<float,2>{0.310145766f, 0.0684801638f},
-std::array<float,2>{0.533146679f, 0.665943444f},
-std::array<float,2>{0.786416352f, 0.328203946f},
-std::array<float,2>{0.00351801631f, 0.909700334f},
-std::array<float,2>{0.204605341f, 0.485882193f},
-std::array<float,2>{0.877568424f, 0.80592227f},
-std::array<float,2>{0.671583533f, 0.1813059f},
-std::array<float,2>{0.459990501f, 0.547644913f},
-std::array<float,2>{0.181371838f, 0.0564377271f},
-std::array<float,2>{0.953357399f, 0.708750248f},
-std::array<float,2>{0.709942222f, 0.280346155f},
-std::array<float,2>{0.418955594f, 0.973457575f},
-std::array<float,2>{0.319678456f, 0.403995901f},
-std::array<float,2>{0.570162356f, 0.832414687f},
-std::array<float,2>{0.867893279f, 0.204602629f},
-std::array<float,2>{0.0761605278f, 0.57735467f},
-std::array<float,2>{0.481335759f, 0.139379486f},
-std::array<float,2>{0.634987831f, 0.525973201f},
-std::array<float,2>{0.920245528f, 0.440516442f},
-std::array<float,2>{0.228654891f, 0.772983432f},
-std::array<float,2>{0.0376394466f, 0.363126218f},
-std::array<float,2>{0.760852039f, 0.90283668f},
-std::array<float,2>{0.514181137f, 0.102327928f},
-std::array<float,2>{0.277869672f, 0.636503518f},
-std::array<float,2>{0.139726177f, 0.217179224f},
-std::array<float,2>{0.976321936f, 0.569190323f},
-std::array<float,2>{0.722900927f, 0.394463241f},
-std::array<float,2>{0.37841168f, 0.841168463f},
-std::array<float,2>{0.345633566f, 0.267252594f},
-std::array<float,2>{0.597333908f, 0.98206687f},
-std::array<float,2>{0.837211013f, 0.0493309796f},
-std::array<float,2>{0.110881083f, 0.711009741f},
-std::array<float,2>{0.466412425f, 0.0992426276f},
-std::array<float,2>{0.663932443f, 0.630814016f},
-std::array<float,2>{0.888676167f, 0.374726176f},
-std::array<float,2>{0.216346815f, 0.89351213f},
-std::array<float,2>{0.0103542162f, 0.447412014f},
-std::array<float,2>{0.793095708f, 0.779083788f},
-std::array<float,2>{0.543079913f, 0.127521455f},
-std::array<float,2>{0.303712338f, 0.518475771f},
-std::array<float,2>{0.0665737838f, 0.0285597164f},
-std::array<float,2>{0.865273535f, 0.732242405f},
-std::array<float,2>{0.5728634f, 0.294942468f},
-std::array<float,2>{0.326074541f, 0.949844241f},
-std::array<float,2>{0.409378916f, 0.417688191f},
-std::array<float,2>{0.715912282f, 0.844140887f},
-std::array<float,2>{0.968322814f, 0.238577008f},
-std::array<float,2>{0.175789535f, 0.61849314f},
-std::array<float,2>{0.273230821f, 0.178126037f},
-std::array<float,2>{0.50759846f, 0.558513463f},
-std::array<float,2>{0.750018001f, 0.498584628f},
-std::array<float,2>{0.0438608788f, 0.796882927f},
-std::array<float,2>{0.221957758f, 0.341350347f},
-std::array<float,2>{0.910074174f, 0.917815685f},
-std::array<float,2>{0.627211273f, 0.0775958374f},
-std::array<float,2>{0.469233423f, 0.660530508f},
-std::array<float,2>{0.0606405698f, 0.152746081f},
-std::array<float,2>{0.768976629f, 0.512854278f},
-std::array<float,2>{0.52607125f, 0.455975264f},
-std::array<float,2>{0.256516635f, 0.760576785f},
-std::array<float,2>{0.487560689f, 0.352481604f},
-std::array<float,2>{0.644236088f, 0.878454745f},
-std::array<float,2>{0.935967863f, 0.110895887f},
-std::array<float,2>{0.240751922f, 0.646491826f},
-std::array<float,2>{0.339753568f, 0.0327069685f},
-std::array<float,2>{0.588795185f, 0.696505308f},
-std::array<float,2>{0.84453088f, 0.255276918f},
-std::array<float,2>{0.0818948299f, 0.987509429f},
-std::array<float,2>{0.170207903f, 0.389752775f},
-std::array<float,2>{0.94115746f, 0.813735843f},
-std::array<float,2>{0.692409575f, 0.189865425f},
-std::array<float,2>{0.425023198f, 0.592209041f},
-std::array<float,2>{0.195747599f, 0.0852164701f},
-std::array<float,2>{0.902180731f, 0.680648923f},
-std::array<float,2>{0.680353463f, 0.31991452f},
-std::array<float,2>{0.439069331f, 0.930817723f},
-std::array<float,2>{0.287137628f, 0.483296871f},
-std::array<float,2>{0.560832143f, 0.78459239f},
-std::array<float,2>{0.804588914f, 0.168729544f},
-std::array<float,2>{0.029858198f, 0.539395094f},
-std::array<float,2>{0.404725194f, 0.229207575f},
-std::array<float,2>{0.749159276f, 0.605263531f},
-std::array<float,2>{0.986281216f, 0.422338188f},
-std::array<float,2>{0.141345248f, 0.869868517f},
-std::array<float,2>{0.0954685062f, 0.302122682f},
-std::array<float,2>{0.824996114f, 0.953338146f},
-std::array<float,2>{0.612204611f, 0.014078984f},
-std::array<float,2>{0.371095508f, 0.744463325f},
-std::array<float,2>{0.156599492f, 0.129871473f},
-std::array<float,2>{0.94584775f, 0.522458971f},
-std::array<float,2>{0.698966146f, 0.450401604f},
-std::array<float,2>{0.434031099f, 0.776284099f},
-std::array<float,2>{0.3302508f, 0.367991269f},
-std::array<float,2>{0.583890021f, 0.896686912f},
-std::array<float,2>{0.851790547f, 0.0955201909f},
-std::array<float,2>{0.0920706093f, 0.627671123f},
-std::array<float,2>{0.492643595f, 0.0540169664f},
-std::array<float,2>{0.652264416f, 0.715419233f},
-std::array<float,2>{0.927775741f, 0.27015689f},
-std::array<float,2>{0.242535844f, 0.980431736f},
-std::array<float,2>{0.0508035906f, 0.395003051f},
-std::array<float,2>{0.778477907f, 0.836181879f},
-std::array<float,2>{0.519158781f, 0.211198032f},
-std::array<float,2>{0.259074777f, 0.565739691f},
-std::array<float,2>{0.102772452f, 0.0708926097f},
-std::array<float,2>{0.815020084f, 0.656966448f},
-std::array<float,2>{0.618148088f, 0.339718908f},
-std::array<float,2>{0.360138804f, 0.919447541f},
-std::array<float,2>{0.395373583f, 0.495958626f},
-std::array<float,2>{0.736240089f, 0.804548085f},
-std::array<float,2>{0.999147058f, 0.175364897f},
-std::array<float,2>{0.152165815f, 0.560900569f},
-std::array<float,2>{0.289968371f, 0.23709181f},
-std::array<float,2>{0.551492035f, 0.62282598f},
-std::array<float,2>{0.808814824f, 0.419195026f},
-std::array<float,2>{0.0228034966f, 0.849979043f},
-std::array<float,2>{0.191931859f, 0.290426731f},
-std::array<float,2>{0.893314898f, 0.947705507f},
-std::array<float,2>{0.677073956f, 0.024074275f},
-std::array<float,2>{0.452655524f, 0.729487062f},
-std::array<float,2>{0.00447561406f, 0.192053378f},
-std::array<float,2>{0.783910453f, 0.58954227f},
-std::array<float,2>{0.53587091f, 0.384673864f},
-std::array<float,2>{0.308060795f, 0.817643821f},
-std::array<float,2>{0.453981161f, 0.250832558f},
-std::array<float,2>{0.664638817f, 0.991621435f},
-std::array<float,2>{0.87929374f, 0.0354270861f},
-std::array<float,2>{0.210495353f, 0.70049119f},
-std::array<float,2>{0.356785804f, 0.114573181f},
-std::array<float,2>{0.607618093f, 0.64363265f},
-std::array<float,2>{0.829764247f, 0.356192261f},
-std::array<float,2>{0.122498177f, 0.882088363f},
-std::array<float,2>{0.132086784f, 0.458379865f},
-std::array<float,2>{0.9821738f, 0.763465822f},
-std::array<float,2>{0.733356535f, 0.150385439f},
-std::array<float,2>{0.388427049f, 0.508887529f},
-std::array<float,2>{0.23356837f, 0.00973204523f},
-std::array<float,2>{0.917823851f, 0.749337196f},
-std::array<float,2>{0.639948189f, 0.297751456f},
-std::array<float,2>{0.477435887f, 0.959397793f},
-std::array<float,2>{0.273464322f, 0.426983982f},
-std::array<float,2>{0.511521399f, 0.872086585f},
-std::array<float,2>{0.763054609f, 0.232746333f},
-std::array<float,2>{0.0315258205f, 0.609325469f},
-std::array<float,2>{0.417911738f, 0.166537195f},
-std::array<float,2>{0.706008136f, 0.54386425f},
-std::array<float,2>{0.960192919f, 0.47780329f},
-std::array<float,2>{0.185724854f, 0.787062943f},
-std::array<float,2>{0.070507668f, 0.31381163f},
-std::array<float,2>{0.871893406f, 0.93528837f},
-std::array<float,2>{0.565320909f, 0.079603374f},
-std::array<float,2>{0.316398948f, 0.686385751f},
-std::array<float,2>{0.21416375f, 0.225217775f},
-std::array<float,2>{0.885475218f, 0.596408188f},
-std::array<float,2>{0.658546984f, 0.434977502f},
-std::array<float,2>{0.462521702f, 0.865620315f},
-std::array<float,2>{0.29918018f, 0.308064669f},
-std::array<float,2>{0.542771339f, 0.962859571f},
-std::array<float,2>{0.790152967f, 0.00556176528f},
-std::array<float,2>{0.0120243682f, 0.736109972f},
-std::array<float,2>{0.382666558f, 0.0875141174f},
-std::array<float,2>{0.721369922f, 0.678257167f},
-std::array<float,2>{0.970164657f, 0.32673192f},
-std::array<float,2>{0.135690406f, 0.922218084f},
-std::array<float,2>{0.116067581f, 0.469568938f},
-std::array<float,2>{0.84019506f, 0.795118809f},
-std::array<float,2>{0.59805572f, 0.159167141f},
-std::array<float,2>{0.349098444f, 0.535758078f},
-std::array<float,2>{0.0412623435f, 0.0463608019f},
-std::array<float,2>{0.755072355f, 0.688147187f},
-std::array<float,2>{0.501033485f, 0.260385036f},
-std::array<float,2>{0.26939702f, 0.993473053f},
-std::array<float,2>{0.473423362f, 0.377763987f},
-std::array<float,2>{0.631603777f, 0.827676356f},
-std::array<float,2>{0.912024915f, 0.196310833f},
-std::array<float,2>{0.224844754f, 0.582133532f},
-std::array<float,2>{0.323673069f, 0.144732013f},
-std::array<float,2>{0.575680375f, 0.506539941f},
-std::array<float,2>{0.86009109f, 0.461888731f},
-std::array<float,2>{0.0648957565f, 0.75225389f},
-std::array<float,2>{0.173580483f, 0.345308244f},
-std::array<float,2>{0.96466881f, 0.883161783f},
-std::array<float,2>{0.71363157f, 0.120449193f},
-std::array<float,2>{0.413840175f, 0.654173136f},
-std::array<float,2>{0.0852985531f, 0.187118828f},
-std::array<float,2>{0.851077735f, 0.552247286f},
-std::array<float,2>{0.592668772f, 0.489004105f},
-std::array<float,2>{0.340826452f, 0.811105907f},
-std::array<float,2>{0.426513135f, 0.334229261f},
-std::array<float,2>{0.687643409f, 0.911973059f},
-std::array<float,2>{0.942619205f, 0.0656046867f},
-std::array<float,2>{0.166225418f, 0.670179725f},
-std::array<float,2>{0.252188504f, 0.0161175225f},
-std::array<float,2>{0.529105842f, 0.72251159f},
-std::array<float,2>{0.769726336f, 0.288033754f},
-std::array<float,2>{0.056628447f, 0.941350579f},
-std::array<float,2>{0.236401573f, 0.410041094f},
-std::array<float,2>{0.932172537f, 0.853283823f},
-std::array<float,2>{0.64672029f, 0.247588336f},
-std::array<float,2>{0.489901781f, 0.610426724f},
-std::array<float,2>{0.145035714f, 0.108171776f},
-std::array<float,2>{0.989667356f, 0.636821926f},
-std::array<float,2>{0.745056629f, 0.365622103f},
-std::array<float,2>{0.399169147f, 0.901059031f},
-std::array<float,2>{0.368533015f, 0.444581121f},
-std::array<float,2>{0.616200507f, 0.766969979f},
-std::array<float,2>{0.820384324f, 0.1365242f},
-std::array<float,2>{0.0984556377f, 0.530031502f},
-std::array<float,2>{0.444509536f, 0.208860248f},
-std::array<float,2>{0.686574221f, 0.573619843f},
-std::array<float,2>{0.904859602f, 0.402323693f},
-std::array<float,2>{0.201467663f, 0.829923093f},
-std::array<float,2>{0.0252842288f, 0.277273834f},
-std::array<float,2>{0.798894942f, 0.970720589f},
-std::array<float,2>{0.556705534f, 0.0600509793f},
-std::array<float,2>{0.283282995f, 0.703404725f},
-std::array<float,2>{0.189145207f, 0.144129202f},
-std::array<float,2>{0.894827485f, 0.502135396f},
-std::array<float,2>{0.674893975f, 0.467823714f},
-std::array<float,2>{0.447728753f, 0.75609684f},
-std::array<float,2>{0.294561058f, 0.351350248f},
-std::array<float,2>{0.548682988f, 0.88907367f},
-std::array<float,2>{0.806430638f, 0.122164927f},
-std::array<float,2>{0.0186363608f, 0.649343729f},
-std::array<float,2>{0.391208023f, 0.0399270728f},
-std::array<float,2>{0.740095675f, 0.692184746f},
-std::array<float,2>{0.994897485f, 0.264460236f},
-std::array<float,2>{0.154137805f, 0.998079717f},
-std::array<float,2>{0.108146153f, 0.381547779f},
-std::array<float,2>{0.818418682f, 0.822023153f},
-std::array<float,2>{0.622622073f, 0.200514302f},
-std::array<float,2>{0.3639597f, 0.578888357f},
-std::array<float,2>{0.0485956892f, 0.0927205682f},
-std::array<float,2>{0.77573514f, 0.673891544f},
-std::array<float,2>{0.520341158f, 0.322628647f},
-std::array<float,2>{0.261973351f, 0.928080857f},
-std::array<float,2>{0.499047577f, 0.476121128f},
-std::array<float,2>{0.653859615f, 0.789919555f},
-std::array<float,2>{0.921898305f, 0.163847893f},
-std::array<float,2>{0.249465212f, 0.531534672f},
-std::array<float,2>{0.332588315f, 0.220696822f},
-std::array<float,2>{0.578243017f, 0.5988428f},
-std::array<float,2>{0.8585096f, 0.430620134f},
-std::array<float,2>{0.0860327706f, 0.860028923f},
-std::array<float,2>{0.163162157f, 0.312160581f},
-std::array<float,2>{0.950841784f, 0.966206253f},
-std::array<float,2>{0.700324118f, 0.00278420909f},
-std::array<float,2>{0.430994362f, 0.7416327f},
-std::array<float,2>{0.0772857144f, 0.206310242f},
-std::array<float,2>{0.870310783f, 0.574918091f},
-std::array<float,2>{0.568115532f, 0.405155897f},
-std::array<float,2>{0.318239152f, 0.834630966f},
-std::array<float,2>{0.421356201f, 0.277484804f},
-std::array<float,2>{0.708403051f, 0.974670351f},
-std::array<float,2>{0.955124676f, 0.0575418323f},
-std::array<float,2>{0.183184609f, 0.710356712f},
-std::array<float,2>{0.280949354f, 0.104601473f},
-std::array<float,2>{0.512786984f, 0.633379221f},
-std::array<float,2>{0.758829772f, 0.360668331f},
-std::array<float,2>{0.0353009999f, 0.905309916f},
-std::array<float,2>{0.227830082f, 0.439056963f},
-std::array<float,2>{0.918715715f, 0.771027923f},
-std::array<float,2>{0.633970618f, 0.136756286f},
-std::array<float,2>{0.482779086f, 0.524691284f},
-std::array<float,2>{0.128401697f, 0.0204234011f},
-std::array<float,2>{0.980195343f, 0.725474775f},
-std::array<float,2>{0.728088319f, 0.281508952f},
-std::array<float,2>{0.386382818f, 0.942751288f},
-std::array<float,2>{0.352543205f, 0.412217706f},
-std::array<float,2>{0.603405356f, 0.858675063f},
-std::array<float,2>{0.832665443f, 0.244755939f},
-std::array<float,2>{0.117909603f, 0.616259992f},
-std::array<float,2>{0.458640456f, 0.182845384f},
-std::array<float,2>{0.669655502f, 0.548990488f},
-std::array<float,2>{0.876397371f, 0.486727893f},
-std::array<float,2>{0.205708429f, 0.807198763f},
-std::array<float,2>{0.0017101448f, 0.330905527f},
-std::array<float,2>{0.788590074f, 0.907343268f},
-std::array<float,2>{0.534386396f, 0.0670238212f},
-std::array<float,2>{0.312295765f, 0.667182624f},
-std::array<float,2>{0.179032966f, 0.240662083f},
-std::array<float,2>{0.96583569f, 0.620187342f},
-std::array<float,2>{0.71807307f, 0.415013224f},
-std::array<float,2>{0.406561881f, 0.846718848f},
-std::array<float,2>{0.327882051f, 0.294570684f},
-std::array<float,2>{0.571569026f, 0.951456547f},
-std::array<float,2>{0.863363028f, 0.0294324923f},
-std::array<float,2>{0.0699947029f, 0.733404994f},
-std::array<float,2>{0.472598821f, 0.0747386739f},
-std::array<float,2>{0.625187814f, 0.66246897f},
-std::array<float,2>{0.906565905f, 0.341896892f},
-std::array<float,2>{0.219193399f, 0.915782869f},
-std::array<float,2>{0.0449830517f, 0.496507108f},
-std::array<float,2>{0.753176451f, 0.798999667f},
-std::array<float,2>{0.505789161f, 0.176054478f},
-std::array<float,2>{0.270908415f, 0.556617618f},
-std::array<float,2>{0.112861224f, 0.0479153432f},
-std::array<float,2>{0.838378787f, 0.71304369f},
-std::array<float,2>{0.595238745f, 0.267833203f},
-std::array<float,2>{0.346212476f, 0.983211517f},
-std::array<float,2>{0.376391232f, 0.390817285f},
-std::array<float,2>{0.724813998f, 0.841853023f},
-std::array<float,2>{0.973152101f, 0.215100959f},
-std::array<float,2>{0.138085306f, 0.566960931f},
-std::array<float,2>{0.30116117f, 0.125794634f},
-std::array<float,2>{0.546122193f, 0.515837967f},
-std::array<float,2>{0.796202421f, 0.447195023f},
-std::array<float,2>{0.00928095449f, 0.779864311f},
-std::array<float,2>{0.218736574f, 0.37191087f},
-std::array<float,2>{0.888564706f, 0.890945196f},
-std::array<float,2>{0.660945773f, 0.100120857f},
-std::array<float,2>{0.468437731f, 0.631560802f},
-std::array<float,2>{0.0274798032f, 0.170921937f},
-std::array<float,2>{0.80083555f, 0.542717397f},
-std::array<float,2>{0.559713185f, 0.481345117f},
-std::array<float,2>{0.286698639f, 0.782554328f},
-std::array<float,2>{0.440468431f, 0.317887247f},
-std::array<float,2>{0.682828128f, 0.93321985f},
-std::array<float,2>{0.900128663f, 0.0825562999f},
-std::array<float,2>{0.1973712f, 0.682728887f},
-std::array<float,2>{0.37339136f, 0.0135437539f},
-std::array<float,2>{0.609744489f, 0.743644297f},
-std::array<float,2>{0.827730715f, 0.303318024f},
-std::array<float,2>{0.0960446224f, 0.956610024f},
-std::array<float,2>{0.142603785f, 0.425242335f},
-std::array<float,2>{0.986819446f, 0.868595898f},
-std::array<float,2>{0.747907817f, 0.227285117f},
-std::array<float,2>{0.402553529f, 0.602436483f},
-std::array<float,2>{0.238287985f, 0.112740897f},
-std::array<float,2>{0.934510946f, 0.645197332f},
-std::array<float,2>{0.641537189f, 0.353965521f},
-std::array<float,2>{0.485576153f, 0.875698388f},
-std::array<float,2>{0.254150987f, 0.45393008f},
-std::array<float,2>{0.524571478f, 0.759628415f},
-std::array<float,2>{0.766040623f, 0.154358163f},
-std::array<float,2>{0.0605209209f, 0.51515311f},
-std::array<float,2>{0.422892809f, 0.187993675f},
-std::array<float,2>{0.694348216f, 0.590466559f},
-std::array<float,2>{0.938315451f, 0.3878631f},
-std::array<float,2>{0.168943301f, 0.814482331f},
-std::array<float,2>{0.079392232f, 0.256511986f},
-std::array<float,2>{0.846431851f, 0.984961152f},
-std::array<float,2>{0.586968839f, 0.0337039307f},
-std::array<float,2>{0.337116539f, 0.698023379f},
-std::array<float,2>{0.148775667f, 0.17269513f},
-std::array<float,2>{0.996097386f, 0.55908531f},
-std::array<float,2>{0.736831784f, 0.494094491f},
-std::array<float,2>{0.396841466f, 0.80184859f},
-std::array<float,2>{0.361612707f, 0.336437345f},
-std::array<float,2>{0.619758785f, 0.921565652f},
-std::array<float,2>{0.81380862f, 0.0723406225f},
-std::array<float,2>{0.10482692f, 0.658597469f},
-std::array<float,2>{0.449249953f, 0.0269404165f},
-std::array<float,2>{0.679096818f, 0.728188396f},
-std::array<float,2>{0.892203927f, 0.292084783f},
-std::array<float,2>{0.194617003f, 0.947098553f},
-std::array<float,2>{0.0202875696f, 0.420768529f},
-std::array<float,2>{0.812259436f, 0.849025309f},
-std::array<float,2>{0.553347707f, 0.235803619f},
-std::array<float,2>{0.291230321f, 0.623049796f},
-std::array<float,2>{0.0909047574f, 0.0960820541f},
-std::array<float,2>{0.854876041f, 0.625849724f},
-std::array<float,2>{0.584275901f, 0.370569289f},
-std::array<float,2>{0.329048783f, 0.895636857f},
-std::array<float,2>{0.437037289f, 0.452561378f},
-std::array<float,2>{0.696273983f, 0.773580492f},
-std::array<float,2>{0.947801352f, 0.132224947f},
-std::array<float,2>{0.159224197f, 0.521113217f},
-std::array<float,2>{0.260129303f, 0.214821339f},
-std::array<float,2>{0.516530275f, 0.563224912f},
-std::array<float,2>{0.779516637f, 0.397010535f},
-std::array<float,2>{0.0531090386f, 0.839032352f},
-std::array<float,2>{0.245911911f, 0.2722269f},
-std::array<float,2>{0.926178515f, 0.977965355f},
-std::array<float,2>{0.6488114f, 0.052653186f},
-std::array<float,2>{0.49554497f, 0.717634916f},
-std::array<float,2>{0.0340364501f, 0.230766058f},
-std::array<float,2>{0.765592039f, 0.605627477f},
-std::array<float,2>{0.509701073f, 0.428406566f},
-std::array<float,2>{0.276153952f, 0.873416007f},
-std::array<float,2>{0.480059236f, 0.299372643f},
-std::array<float,2>{0.638665617f, 0.957637489f},
-std::array<float,2>{0.914253712f, 0.011365287f},
-std::array<float,2>{0.230654225f, 0.746964395f},
-std::array<float,2>{0.313857228f, 0.0805960596f},
-std::array<float,2>{0.564396858f, 0.684415162f},
-std::array<float,2>{0.873701811f, 0.316255093f},
-std::array<float,2>{0.0729082897f, 0.936472952f},
-std::array<float,2>{0.184339345f, 0.479524344f},
-std::array<float,2>{0.958725214f, 0.787370443f},
-std::array<float,2>{0.703581035f, 0.164958358f},
-std::array<float,2>{0.414543003f, 0.546702266f},
-std::array<float,2>{0.208250836f, 0.0387617238f},
-std::array<float,2>{0.881801784f, 0.702417254f},
-std::array<float,2>{0.666403592f, 0.252557665f},
-std::array<float,2>{0.45663482f, 0.989121199f},
-std::array<float,2>{0.306349128f, 0.385210037f},
-std::array<float,2>{0.538913012f, 0.818816245f},
-std::array<float,2>{0.781871915f, 0.19375892f},
-std::array<float,2>{0.00628020521f, 0.586805582f},
-std::array<float,2>{0.389699697f, 0.1507954f},
-std::array<float,2>{0.730708122f, 0.5097664f},
-std::array<float,2>{0.983152092f, 0.459850878f},
-std::array<float,2>{0.129859939f, 0.764736235f},
-std::array<float,2>{0.123537794f, 0.358129203f},
-std::array<float,2>{0.830468416f, 0.880719662f},
-std::array<float,2>{0.606254637f, 0.115821667f},
-std::array<float,2>{0.358126074f, 0.641026974f},
-std::array<float,2>{0.223242313f, 0.199201718f},
-std::array<float,2>{0.913645148f, 0.585066795f},
-std::array<float,2>{0.630271435f, 0.376009375f},
-std::array<float,2>{0.476558805f, 0.824899137f},
-std::array<float,2>{0.267320633f, 0.259022623f},
-std::array<float,2>{0.503830075f, 0.995110393f},
-std::array<float,2>{0.757393062f, 0.0445528105f},
-std::array<float,2>{0.0403301865f, 0.690511882f},
-std::array<float,2>{0.411540508f, 0.118521824f},
-std::array<float,2>{0.71178019f, 0.655059278f},
-std::array<float,2>{0.96283102f, 0.346342176f},
-std::array<float,2>{0.174558759f, 0.884981811f},
-std::array<float,2>{0.0636218861f, 0.463550419f},
-std::array<float,2>{0.862359703f, 0.751748204f},
-std::array<float,2>{0.576384664f, 0.146626413f},
-std::array<float,2>{0.322160512f, 0.504613876f},
-std::array<float,2>{0.0137562491f, 0.00639678165f},
-std::array<float,2>{0.792073786f, 0.73750037f},
-std::array<float,2>{0.54038614f, 0.305744022f},
-std::array<float,2>{0.297909617f, 0.963716328f},
-std::array<float,2>{0.463460803f, 0.436464518f},
-std::array<float,2>{0.65636009f, 0.864277363f},
-std::array<float,2>{0.883590162f, 0.222928166f},
-std::array<float,2>{0.211604789f, 0.594611228f},
-std::array<float,2>{0.349860162f, 0.158135399f},
-std::array<float,2>{0.599785745f, 0.538798749f},
-std::array<float,2>{0.843078971f, 0.471438676f},
-std::array<float,2>{0.114696227f, 0.794822037f},
-std::array<float,2>{0.134232819f, 0.325560927f},
-std::array<float,2>{0.972023904f, 0.92559129f},
-std::array<float,2>{0.718849182f, 0.0884270221f},
-std::array<float,2>{0.380206585f, 0.677672565f},
-std::array<float,2>{0.101367146f, 0.133795634f},
-std::array<float,2>{0.822755992f, 0.528851092f},
-std::array<float,2>{0.613710821f, 0.442205369f},
-std::array<float,2>{0.371073812f, 0.768613696f},
-std::array<float,2>{0.401034385f, 0.364825845f},
-std::array<float,2>{0.742870092f, 0.898721039f},
-std::array<float,2>{0.992143214f, 0.106342539f},
-std::array<float,2>{0.148123503f, 0.639405847f},
-std::array<float,2>{0.283043623f, 0.061300341f},
-std::array<float,2>{0.555344045f, 0.70675379f},
-std::array<float,2>{0.798823476f, 0.274500519f},
-std::array<float,2>{0.0261447132f, 0.969670296f},
-std::array<float,2>{0.199322164f, 0.398612022f},
-std::array<float,2>{0.903932214f, 0.830229163f},
-std::array<float,2>{0.684225142f, 0.21084556f},
-std::array<float,2>{0.44320786f, 0.571866155f},
-std::array<float,2>{0.16545637f, 0.0626938492f},
-std::array<float,2>{0.944884598f, 0.669405878f},
-std::array<float,2>{0.690908909f, 0.332117885f},
-std::array<float,2>{0.429284602f, 0.913564742f},
-std::array<float,2>{0.342328727f, 0.491062969f},
-std::array<float,2>{0.591690242f, 0.808866918f},
-std::array<float,2>{0.848793626f, 0.184656441f},
-std::array<float,2>{0.0825043321f, 0.553743303f},
-std::array<float,2>{0.491627246f, 0.248676449f},
-std::array<float,2>{0.644997358f, 0.611817956f},
-std::array<float,2>{0.929898024f, 0.406485379f},
-std::array<float,2>{0.235759541f, 0.853558064f},
-std::array<float,2>{0.0573796108f, 0.285722107f},
-std::array<float,2>{0.772756696f, 0.938353956f},
-std::array<float,2>{0.530868173f, 0.0190056302f},
-std::array<float,2>{0.251660138f, 0.720304191f},
-std::array<float,2>{0.229664028f, 0.138609737f},
-std::array<float,2>{0.921796739f, 0.524326384f},
-std::array<float,2>{0.636046171f, 0.438208789f},
-std::array<float,2>{0.481934756f, 0.770430446f},
-std::array<float,2>{0.278883129f, 0.360212266f},
-std::array<float,2>{0.515571892f, 0.90500766f},
-std::array<float,2>{0.760415494f, 0.1043851f},
-std::array<float,2>{0.0381666161f, 0.634415567f},
-std::array<float,2>{0.418562263f, 0.0579804964f},
-std::array<float,2>{0.710520864f, 0.709253132f},
-std::array<float,2>{0.954553246f, 0.278639585f},
-std::array<float,2>{0.180122465f, 0.976510167f},
-std::array<float,2>{0.0751330107f, 0.406174749f},
-std::array<float,2>{0.868762672f, 0.835925043f},
-std::array<float,2>{0.568959475f, 0.205101848f},
-std::array<float,2>{0.319019437f, 0.575602829f},
-std::array<float,2>{0.00204400648f, 0.0677384213f},
-std::array<float,2>{0.785182536f, 0.666616678f},
-std::array<float,2>{0.531577766f, 0.331679255f},
-std::array<float,2>{0.309047669f, 0.906655014f},
-std::array<float,2>{0.459189057f, 0.487442732f},
-std::array<float,2>{0.670684934f, 0.80848515f},
-std::array<float,2>{0.878075719f, 0.182362646f},
-std::array<float,2>{0.203152716f, 0.55076319f},
-std::array<float,2>{0.354513109f, 0.245685562f},
-std::array<float,2>{0.604592919f, 0.615773082f},
-std::array<float,2>{0.835164309f, 0.41319707f},
-std::array<float,2>{0.120882384f, 0.857645988f},
-std::array<float,2>{0.125477925f, 0.282921821f},
-std::array<float,2>{0.97849822f, 0.941655576f},
-std::array<float,2>{0.729242504f, 0.0212330651f},
-std::array<float,2>{0.38441056f, 0.725611389f},
-std::array<float,2>{0.107165381f, 0.199397594f},
-std::array<float,2>{0.817468226f, 0.579279661f},
-std::array<float,2>{0.623084843f, 0.382485658f},
-std::array<float,2>{0.366202921f, 0.820401609f},
-std::array<float,2>{0.392692536f, 0.265053451f},
-std::array<float,2>{0.741704762f, 0.99925673f},
-std::array<float,2>{0.992666125f, 0.040876247f},
-std::array<float,2>{0.155966401f, 0.693059206f},
-std::array<float,2>{0.295558989f, 0.121741101f},
-std::array<float,2>{0.550710857f, 0.649484813f},
-std::array<float,2>{0.80750668f, 0.350097388f},
-std::array<float,2>{0.0169833582f, 0.890522659f},
-std::array<float,2>{0.189633816f, 0.467765599f},
-std::array<float,2>{0.897926211f, 0.757512748f},
-std::array<float,2>{0.672007501f, 0.142580971f},
-std::array<float,2>{0.446985662f, 0.503736556f},
-std::array<float,2>{0.160947412f, 0.00367868971f},
-std::array<float,2>{0.95213002f, 0.740919828f},
-std::array<float,2>{0.701951861f, 0.311211944f},
-std::array<float,2>{0.433544576f, 0.964875221f},
-std::array<float,2>{0.335483521f, 0.431611806f},
-std::array<float,2>{0.582006335f, 0.860381782f},
-std::array<float,2>{0.855594516f, 0.219038054f},
-std::array<float,2>{0.0889795423f, 0.597834289f},
-std::array<float,2>{0.497274905f, 0.162662327f},
-std::array<float,2>{0.654552519f, 0.532947063f},
-std::array<float,2>{0.924598813f, 0.474707901f},
-std::array<float,2>{0.247480869f, 0.790387332f},
-std::array<float,2>{0.0501063503f, 0.324146837f},
-std::array<float,2>{0.774190724f, 0.928717613f},
-std::array<float,2>{0.521933675f, 0.0932016149f},
-std::array<float,2>{0.264214605f, 0.67532599f},
-std::array<float,2>{0.14176552f, 0.227676317f},
-std::array<float,2>{0.985164881f, 0.603260875f},
-std::array<float,2>{0.748881042f, 0.424397171f},
-std::array<float,2>{0.405528277f, 0.867613077f},
-std::array<float,2>{0.372745097f, 0.303940833f},
-std::array<float,2>{0.613157749f, 0.955820262f},
-std::array<float,2>{0.825470567f, 0.0124345943f},
-std::array<float,2>{0.0942920595f, 0.743040979f},
-std::array<float,2>{0.437500447f, 0.0831386372f},
-std::array<float,2>{0.681129158f, 0.681893945f},
-std::array<float,2>{0.90112263f, 0.316818416f},
-std::array<float,2>{0.196329474f, 0.932035565f},
-std::array<float,2>{0.0309152994f, 0.481684089f},
-std::array<float,2>{0.80279243f, 0.782164514f},
-std::array<float,2>{0.56227541f, 0.170491979f},
-std::array<float,2>{0.288542718f, 0.541725755f},
-std::array<float,2>{0.0806695223f, 0.0349095464f},
-std::array<float,2>{0.84514451f, 0.698699415f},
-std::array<float,2>{0.589065731f, 0.257051528f},
-std::array<float,2>{0.338698626f, 0.985681832f},
-std::array<float,2>{0.423831671f, 0.387223989f},
-std::array<float,2>{0.692127168f, 0.815918267f},
-std::array<float,2>{0.940064728f, 0.188612118f},
-std::array<float,2>{0.171398446f, 0.591265082f},
-std::array<float,2>{0.256904423f, 0.156106576f},
-std::array<float,2>{0.526994586f, 0.513856709f},
-std::array<float,2>{0.767728031f, 0.4549236f},
-std::array<float,2>{0.0616642796f, 0.758361161f},
-std::array<float,2>{0.242173582f, 0.354836673f},
-std::array<float,2>{0.936747015f, 0.876608729f},
-std::array<float,2>{0.642647505f, 0.111347511f},
-std::array<float,2>{0.486407161f, 0.646109521f},
-std::array<float,2>{0.044463098f, 0.176953033f},
-std::array<float,2>{0.751446068f, 0.555288017f},
-std::array<float,2>{0.506786585f, 0.497289538f},
-std::array<float,2>{0.272225857f, 0.800039351f},
-std::array<float,2>{0.470683485f, 0.342791319f},
-std::array<float,2>{0.628852904f, 0.914118767f},
-std::array<float,2>{0.909019887f, 0.0758789033f},
-std::array<float,2>{0.221023142f, 0.663560033f},
-std::array<float,2>{0.324395329f, 0.0303308815f},
-std::array<float,2>{0.573429883f, 0.732962489f},
-std::array<float,2>{0.866463542f, 0.293270111f},
-std::array<float,2>{0.0674135089f, 0.952427208f},
-std::array<float,2>{0.177525386f, 0.415458202f},
-std::array<float,2>{0.966816723f, 0.846671045f},
-std::array<float,2>{0.715581894f, 0.241463974f},
-std::array<float,2>{0.408420086f, 0.620041549f},
-std::array<float,2>{0.215760589f, 0.100718714f},
-std::array<float,2>{0.890310824f, 0.632294714f},
-std::array<float,2>{0.662753999f, 0.37232247f},
-std::array<float,2>{0.46508801f, 0.892495394f},
-std::array<float,2>{0.303286493f, 0.445916384f},
-std::array<float,2>{0.544915557f, 0.780819595f},
-std::array<float,2>{0.79490155f, 0.12685366f},
-std::array<float,2>{0.011029901f, 0.51701659f},
-std::array<float,2>{0.377464443f, 0.216523081f},
-std::array<float,2>{0.72421056f, 0.567504466f},
-std::array<float,2>{0.974912882f, 0.391909271f},
-std::array<float,2>{0.139389262f, 0.843505621f},
-std::array<float,2>{0.10995622f, 0.269005835f},
-std::array<float,2>{0.836178005f, 0.983712018f},
-std::array<float,2>{0.596058965f, 0.047095079f},
-std::array<float,2>{0.344577283f, 0.713950217f},
-std::array<float,2>{0.187319398f, 0.165524527f},
-std::array<float,2>{0.959640861f, 0.545822084f},
-std::array<float,2>{0.706944704f, 0.478919387f},
-std::array<float,2>{0.416733474f, 0.788290977f},
-std::array<float,2>{0.314511359f, 0.315420866f},
-std::array<float,2>{0.566179931f, 0.937168777f},
-std::array<float,2>{0.872751892f, 0.0817691386f},
-std::array<float,2>{0.0718093961f, 0.684979558f},
-std::array<float,2>{0.477559358f, 0.0101674078f},
-std::array<float,2>{0.639527678f, 0.747458518f},
-std::array<float,2>{0.916290641f, 0.299913824f},
-std::array<float,2>{0.232578352f, 0.958303571f},
-std::array<float,2>{0.0325308181f, 0.429202646f},
-std::array<float,2>{0.762523234f, 0.874054909f},
-std::array<float,2>{0.51002866f, 0.231596604f},
-std::array<float,2>{0.275049984f, 0.607284188f},
-std::array<float,2>{0.121300571f, 0.116586879f},
-std::array<float,2>{0.828563869f, 0.642167509f},
-std::array<float,2>{0.609078825f, 0.359363407f},
-std::array<float,2>{0.355638087f, 0.879786372f},
-std::array<float,2>{0.386964411f, 0.460074812f},
-std::array<float,2>{0.734345317f, 0.764592409f},
-std::array<float,2>{0.980973244f, 0.151881203f},
-std::array<float,2>{0.131229803f, 0.511271477f},
-std::array<float,2>{0.307384461f, 0.194613531f},
-std::array<float,2>{0.537040532f, 0.587454081f},
-std::array<float,2>{0.784692585f, 0.386682928f},
-std::array<float,2>{0.00499518728f, 0.82013005f},
-std::array<float,2>{0.209873423f, 0.253569663f},
-std::array<float,2>{0.880509734f, 0.989926577f},
-std::array<float,2>{0.665088832f, 0.0377940126f},
-std::array<float,2>{0.454928011f, 0.701715767f},
-std::array<float,2>{0.0216669086f, 0.23493892f},
-std::array<float,2>{0.81040287f, 0.624125421f},
-std::array<float,2>{0.552109063f, 0.421646923f},
-std::array<float,2>{0.290320992f, 0.848540723f},
-std::array<float,2>{0.451772839f, 0.29159227f},
-std::array<float,2>{0.67603004f, 0.945605397f},
-std::array<float,2>{0.89411968f, 0.0259123594f},
-std::array<float,2>{0.192799315f, 0.7267977f},
-std::array<float,2>{0.360811144f, 0.0739625767f},
-std::array<float,2>{0.618461967f, 0.659938753f},
-std::array<float,2>{0.815469086f, 0.337086111f},
-std::array<float,2>{0.101988338f, 0.920235038f},
-std::array<float,2>{0.150875419f, 0.49267751f},
-std::array<float,2>{0.998139799f, 0.801496983f},
-std::array<float,2>{0.734591663f, 0.173171982f},
-std::array<float,2>{0.395725489f, 0.560315728f},
-std::array<float,2>{0.243746892f, 0.0511148199f},
-std::array<float,2>{0.929180622f, 0.717977941f},
-std::array<float,2>{0.651119709f, 0.272879779f},
-std::array<float,2>{0.493618548f, 0.977115154f},
-std::array<float,2>{0.258729219f, 0.397965074f},
-std::array<float,2>{0.518549979f, 0.838035107f},
-std::array<float,2>{0.778073132f, 0.213240772f},
-std::array<float,2>{0.0525040552f, 0.564064503f},
-std::array<float,2>{0.434647828f, 0.131048322f},
-std::array<float,2>{0.697572291f, 0.52011168f},
-std::array<float,2>{0.946510911f, 0.451242119f},
-std::array<float,2>{0.157511517f, 0.774887919f},
-std::array<float,2>{0.0928960592f, 0.369220883f},
-std::array<float,2>{0.853411257f, 0.895415783f},
-std::array<float,2>{0.582998931f, 0.0976373702f},
-std::array<float,2>{0.331621945f, 0.626159728f},
-std::array<float,2>{0.202390954f, 0.20958747f},
-std::array<float,2>{0.905354083f, 0.570319951f},
-std::array<float,2>{0.686515212f, 0.399452746f},
-std::array<float,2>{0.444103479f, 0.831296444f},
-std::array<float,2>{0.285043687f, 0.27357921f},
-std::array<float,2>{0.55814147f, 0.970279455f},
-std::array<float,2>{0.800759375f, 0.0619181693f},
-std::array<float,2>{0.0239453055f, 0.705688834f},
-std::array<float,2>{0.4000929f, 0.107300058f},
-std::array<float,2>{0.746074915f, 0.639691293f},
-std::array<float,2>{0.988509297f, 0.363616347f},
-std::array<float,2>{0.146126941f, 0.900091231f},
-std::array<float,2>{0.0995057896f, 0.442471117f},
-std::array<float,2>{0.821547508f, 0.767712355f},
-std::array<float,2>{0.61623615f, 0.133308858f},
-std::array<float,2>{0.367395729f, 0.528119981f},
-std::array<float,2>{0.0549560674f, 0.0177020263f},
-std::array<float,2>{0.771117687f, 0.719128072f},
-std::array<float,2>{0.527687848f, 0.286286354f},
-std::array<float,2>{0.253361106f, 0.938682854f},
-std::array<float,2>{0.488332808f, 0.408080429f},
-std::array<float,2>{0.647943616f, 0.855274856f},
-std::array<float,2>{0.933054328f, 0.249441892f},
-std::array<float,2>{0.237895191f, 0.613264084f},
-std::array<float,2>{0.340426385f, 0.183737785f},
-std::array<float,2>{0.593705058f, 0.55316627f},
-std::array<float,2>{0.84963727f, 0.491715819f},
-std::array<float,2>{0.0840040445f, 0.809975863f},
-std::array<float,2>{0.167415753f, 0.333935857f},
-std::array<float,2>{0.941482902f, 0.91215992f},
-std::array<float,2>{0.688956857f, 0.064406231f},
-std::array<float,2>{0.427641451f, 0.668069541f},
-std::array<float,2>{0.0656947494f, 0.147476926f},
-std::array<float,2>{0.860445499f, 0.505052209f},
-std::array<float,2>{0.574776292f, 0.464246184f},
-std::array<float,2>{0.323207945f, 0.750748575f},
-std::array<float,2>{0.412780255f, 0.346739411f},
-std::array<float,2>{0.713923633f, 0.886619091f},
-std::array<float,2>{0.963006973f, 0.117215298f},
-std::array<float,2>{0.171979934f, 0.655515909f},
-std::array<float,2>{0.268503308f, 0.043272607f},
-std::array<float,2>{0.500032365f, 0.690031469f},
-std::array<float,2>{0.75443846f, 0.258417249f},
-std::array<float,2>{0.0424272045f, 0.995926261f},
-std::array<float,2>{0.226415515f, 0.375802875f},
-std::array<float,2>{0.910565674f, 0.825245261f},
-std::array<float,2>{0.632152557f, 0.197648048f},
-std::array<float,2>{0.474046499f, 0.584818065f},
-std::array<float,2>{0.136370853f, 0.0895505175f},
-std::array<float,2>{0.969715893f, 0.676546454f},
-std::array<float,2>{0.722437263f, 0.324937254f},
-std::array<float,2>{0.381141782f, 0.924022019f},
-std::array<float,2>{0.348350108f, 0.472582668f},
-std::array<float,2>{0.599572241f, 0.793798327f},
-std::array<float,2>{0.841139853f, 0.156558678f},
-std::array<float,2>{0.117133014f, 0.537691176f},
-std::array<float,2>{0.461447299f, 0.223834604f},
-std::array<float,2>{0.659284234f, 0.595023334f},
-std::array<float,2>{0.886158586f, 0.437202454f},
-std::array<float,2>{0.213277817f, 0.863930047f},
-std::array<float,2>{0.0132509544f, 0.305285633f},
-std::array<float,2>{0.789861679f, 0.964593709f},
-std::array<float,2>{0.541258097f, 0.00704555865f},
-std::array<float,2>{0.300755352f, 0.736932158f},
-std::array<float,2>{0.206635103f, 0.179944143f},
-std::array<float,2>{0.875435948f, 0.548358917f},
-std::array<float,2>{0.668356538f, 0.484908402f},
-std::array<float,2>{0.457478613f, 0.805004001f},
-std::array<float,2>{0.3112652f, 0.329149336f},
-std::array<float,2>{0.534152746f, 0.908298075f},
-std::array<float,2>{0.78755486f, 0.0696671531f},
-std::array<float,2>{0.000315809739f, 0.664858401f},
-std::array<float,2>{0.38490361f, 0.0216830783f},
-std::array<float,2>{0.727039158f, 0.723151028f},
-std::array<float,2>{0.979207754f, 0.28491652f},
-std::array<float,2>{0.127877414f, 0.944369256f},
-std::array<float,2>{0.118546151f, 0.411950946f},
-std::array<float,2>{0.833314061f, 0.855878651f},
-std::array<float,2>{0.602375746f, 0.242922157f},
-std::array<float,2>{0.352196246f, 0.614732683f},
-std::array<float,2>{0.0363828056f, 0.103154086f},
-std::array<float,2>{0.75801003f, 0.634867847f},
-std::array<float,2>{0.512575388f, 0.361474276f},
-std::array<float,2>{0.280099183f, 0.904187858f},
-std::array<float,2>{0.483962804f, 0.439733386f},
-std::array<float,2>{0.633476794f, 0.771515489f},
-std::array<float,2>{0.919307172f, 0.139951631f},
-std::array<float,2>{0.227075264f, 0.526749432f},
-std::array<float,2>{0.316572726f, 0.203251034f},
-std::array<float,2>{0.567146719f, 0.576600373f},
-std::array<float,2>{0.869813323f, 0.402944624f},
-std::array<float,2>{0.0762990639f, 0.833905041f},
-std::array<float,2>{0.182603508f, 0.28009057f},
-std::array<float,2>{0.956587076f, 0.97449249f},
-std::array<float,2>{0.707577705f, 0.0546999127f},
-std::array<float,2>{0.420101196f, 0.707751274f},
-std::array<float,2>{0.087652348f, 0.222449318f},
-std::array<float,2>{0.857540369f, 0.600269318f},
-std::array<float,2>{0.57912153f, 0.433464974f},
-std::array<float,2>{0.333502978f, 0.863135636f},
-std::array<float,2>{0.429863781f, 0.310033917f},
-std::array<float,2>{0.700078547f, 0.968748629f},
-std::array<float,2>{0.950162351f, 0.001223478f},
-std::array<float,2>{0.162806943f, 0.738925397f},
-std::array<float,2>{0.263374865f, 0.0898872092f},
-std::array<float,2>{0.520766735f, 0.67306006f},
-std::array<float,2>{0.777007997f, 0.321080685f},
-std::array<float,2>{0.0470012724f, 0.926030219f},
-std::array<float,2>{0.248881578f, 0.473059624f},
-std::array<float,2>{0.923365772f, 0.791909754f},
-std::array<float,2>{0.653044939f, 0.16034624f},
-std::array<float,2>{0.498929739f, 0.533283114f},
-std::array<float,2>{0.152605817f, 0.0419853218f},
-std::array<float,2>{0.995525062f, 0.694812357f},
-std::array<float,2>{0.73843199f, 0.262584835f},
-std::array<float,2>{0.39234221f, 0.997388184f},
-std::array<float,2>{0.364552617f, 0.379591018f},
-std::array<float,2>{0.622068644f, 0.82374084f},
-std::array<float,2>{0.820282757f, 0.202246368f},
-std::array<float,2>{0.109137304f, 0.581691206f},
-std::array<float,2>{0.449005306f, 0.141816035f},
-std::array<float,2>{0.673941255f, 0.500392318f},
-std::array<float,2>{0.896425009f, 0.464938462f},
-std::array<float,2>{0.188442096f, 0.755723536f},
-std::array<float,2>{0.0183498263f, 0.348457605f},
-std::array<float,2>{0.805469334f, 0.888167858f},
-std::array<float,2>{0.547609866f, 0.124004573f},
-std::array<float,2>{0.29377079f, 0.652185738f},
-std::array<float,2>{0.169004485f, 0.191154897f},
-std::array<float,2>{0.938987136f, 0.593193114f},
-std::array<float,2>{0.693972707f, 0.389632523f},
-std::array<float,2>{0.422835767f, 0.813100219f},
-std::array<float,2>{0.336371481f, 0.254524291f},
-std::array<float,2>{0.58602345f, 0.986367583f},
-std::array<float,2>{0.847225904f, 0.0314829871f},
-std::array<float,2>{0.0786307678f, 0.695978284f},
-std::array<float,2>{0.484425396f, 0.109617472f},
-std::array<float,2>{0.642105937f, 0.647465467f},
-std::array<float,2>{0.935239077f, 0.352987677f},
-std::array<float,2>{0.239661843f, 0.877877712f},
-std::array<float,2>{0.0588394962f, 0.456451595f},
-std::array<float,2>{0.767299354f, 0.76127696f},
-std::array<float,2>{0.524192989f, 0.154260188f},
-std::array<float,2>{0.255800724f, 0.511740685f},
-std::array<float,2>{0.0971404016f, 0.0156051964f},
-std::array<float,2>{0.82653141f, 0.745880187f},
-std::array<float,2>{0.6104756f, 0.301119506f},
-std::array<float,2>{0.374835908f, 0.954864502f},
-std::array<float,2>{0.403741568f, 0.422935814f},
-std::array<float,2>{0.746191442f, 0.870892465f},
-std::array<float,2>{0.9873932f, 0.230418578f},
-std::array<float,2>{0.14388907f, 0.604468703f},
-std::array<float,2>{0.285266846f, 0.169744626f},
-std::array<float,2>{0.559552252f, 0.540741205f},
-std::array<float,2>{0.802547574f, 0.48425436f},
-std::array<float,2>{0.0285999496f, 0.783846378f},
-std::array<float,2>{0.198833391f, 0.319033176f},
-std::array<float,2>{0.898543239f, 0.929743409f},
-std::array<float,2>{0.682250381f, 0.0848621055f},
-std::array<float,2>{0.439778298f, 0.681050003f},
-std::array<float,2>{0.00824814942f, 0.128615662f},
-std::array<float,2>{0.795871079f, 0.518686891f},
-std::array<float,2>{0.545104146f, 0.448766857f},
-std::array<float,2>{0.3023794f, 0.778119981f},
-std::array<float,2>{0.467437983f, 0.373896837f},
-std::array<float,2>{0.661446154f, 0.89440757f},
-std::array<float,2>{0.887190104f, 0.0984329507f},
-std::array<float,2>{0.217171475f, 0.629533947f},
-std::array<float,2>{0.346692979f, 0.0503909625f},
-std::array<float,2>{0.59379065f, 0.712632f},
-std::array<float,2>{0.839104533f, 0.266507655f},
-std::array<float,2>{0.111856647f, 0.980847836f},
-std::array<float,2>{0.137059346f, 0.393331021f},
-std::array<float,2>{0.974494696f, 0.83989507f},
-std::array<float,2>{0.725835085f, 0.218246236f},
-std::array<float,2>{0.375917017f, 0.569868565f},
-std::array<float,2>{0.220214352f, 0.0767077357f},
-std::array<float,2>{0.907325566f, 0.661162257f},
-std::array<float,2>{0.626084268f, 0.34001717f},
-std::array<float,2>{0.470755517f, 0.916801691f},
-std::array<float,2>{0.27026993f, 0.499174535f},
-std::array<float,2>{0.504204214f, 0.797953188f},
-std::array<float,2>{0.752272904f, 0.178947315f},
-std::array<float,2>{0.0467223302f, 0.55759877f},
-std::array<float,2>{0.407512635f, 0.24003619f},
-std::array<float,2>{0.717717826f, 0.617575169f},
-std::array<float,2>{0.965766847f, 0.416440636f},
-std::array<float,2>{0.177808926f, 0.845155835f},
-std::array<float,2>{0.0692423284f, 0.296564221f},
-std::array<float,2>{0.864333928f, 0.951019764f},
-std::array<float,2>{0.570315182f, 0.0276616756f},
-std::array<float,2>{0.326189935f, 0.7309255f},
-std::array<float,2>{0.130002037f, 0.149006456f},
-std::array<float,2>{0.984034836f, 0.508431673f},
-std::array<float,2>{0.732268989f, 0.457217306f},
-std::array<float,2>{0.389626563f, 0.762257695f},
-std::array<float,2>{0.35863784f, 0.356911451f},
-std::array<float,2>{0.607021272f, 0.881247818f},
-std::array<float,2>{0.831254244f, 0.113886751f},
-std::array<float,2>{0.124302045f, 0.642582357f},
-std::array<float,2>{0.45564869f, 0.0366857499f},
-std::array<float,2>{0.667630732f, 0.699266315f},
-std::array<float,2>{0.881876111f, 0.251025945f},
-std::array<float,2>{0.207646161f, 0.991021812f},
-std::array<float,2>{0.00759615051f, 0.383177072f},
-std::array<float,2>{0.783007622f, 0.816609561f},
-std::array<float,2>{0.537977934f, 0.193311051f},
-std::array<float,2>{0.305382401f, 0.588421702f},
-std::array<float,2>{0.0741063505f, 0.0786001161f},
-std::array<float,2>{0.874454856f, 0.686628163f},
-std::array<float,2>{0.562701344f, 0.312614948f},
-std::array<float,2>{0.312731802f, 0.934326112f},
-std::array<float,2>{0.415656984f, 0.476887971f},
-std::array<float,2>{0.704315901f, 0.786009014f},
-std::array<float,2>{0.957681954f, 0.167374626f},
-std::array<float,2>{0.185236797f, 0.544097424f},
-std::array<float,2>{0.276835233f, 0.233452991f},
-std::array<float,2>{0.508272648f, 0.607646167f},
-std::array<float,2>{0.763706267f, 0.426450342f},
-std::array<float,2>{0.0349666737f, 0.871952236f},
-std::array<float,2>{0.232109487f, 0.298418492f},
-std::array<float,2>{0.915837467f, 0.960683167f},
-std::array<float,2>{0.637118697f, 0.00832368154f},
-std::array<float,2>{0.478808165f, 0.748494506f},
-std::array<float,2>{0.054235965f, 0.212855995f},
-std::array<float,2>{0.781127751f, 0.565373957f},
-std::array<float,2>{0.517225802f, 0.395912349f},
-std::array<float,2>{0.260859191f, 0.837037265f},
-std::array<float,2>{0.494241208f, 0.271434903f},
-std::array<float,2>{0.649869263f, 0.979298294f},
-std::array<float,2>{0.92773056f, 0.053051468f},
-std::array<float,2>{0.244785681f, 0.716148615f},
-std::array<float,2>{0.32964319f, 0.0942724645f},
-std::array<float,2>{0.585416675f, 0.627987146f},
-std::array<float,2>{0.853808582f, 0.368902087f},
-std::array<float,2>{0.089908734f, 0.897631764f},
-std::array<float,2>{0.158804312f, 0.450106889f},
-std::array<float,2>{0.949161053f, 0.776725769f},
-std::array<float,2>{0.696483791f, 0.130155936f},
-std::array<float,2>{0.435707837f, 0.522668004f},
-std::array<float,2>{0.193425983f, 0.024953654f},
-std::array<float,2>{0.891034603f, 0.73027122f},
-std::array<float,2>{0.678321064f, 0.28976351f},
-std::array<float,2>{0.451128483f, 0.948243082f},
-std::array<float,2>{0.292824745f, 0.418352455f},
-std::array<float,2>{0.554080963f, 0.851528943f},
-std::array<float,2>{0.811346292f, 0.23778899f},
-std::array<float,2>{0.0207748413f, 0.621110201f},
-std::array<float,2>{0.397790074f, 0.173991486f},
-std::array<float,2>{0.738183856f, 0.561669886f},
-std::array<float,2>{0.99746114f, 0.494935751f},
-std::array<float,2>{0.149420142f, 0.80337441f},
-std::array<float,2>{0.103693187f, 0.338615388f},
-std::array<float,2>{0.812892318f, 0.918718398f},
-std::array<float,2>{0.620795965f, 0.0713536516f},
-std::array<float,2>{0.362313688f, 0.6580531f},
-std::array<float,2>{0.234780014f, 0.247047439f},
-std::array<float,2>{0.930977404f, 0.610305786f},
-std::array<float,2>{0.646209061f, 0.408828259f},
-std::array<float,2>{0.490969092f, 0.851911664f},
-std::array<float,2>{0.250133425f, 0.288104296f},
-std::array<float,2>{0.530031621f, 0.940351784f},
-std::array<float,2>{0.771816254f, 0.0166807566f},
-std::array<float,2>{0.0584869124f, 0.721614301f},
-std::array<float,2>{0.428136796f, 0.0647251233f},
-std::array<float,2>{0.690286517f, 0.670980871f},
-std::array<float,2>{0.943729699f, 0.335495681f},
-std::array<float,2>{0.164222777f, 0.910428762f},
-std::array<float,2>{0.0838624686f, 0.489745259f},
-std::array<float,2>{0.847668409f, 0.812120438f},
-std::array<float,2>{0.590080857f, 0.185835645f},
-std::array<float,2>{0.343003154f, 0.551154435f},
-std::array<float,2>{0.0269803293f, 0.0589608438f},
-std::array<float,2>{0.796887696f, 0.704277813f},
-std::array<float,2>{0.556224763f, 0.276239246f},
-std::array<float,2>{0.281412005f, 0.971885562f},
-std::array<float,2>{0.442116588f, 0.401287198f},
-std::array<float,2>{0.685332716f, 0.828207672f},
-std::array<float,2>{0.902693868f, 0.207857683f},
-std::array<float,2>{0.20069778f, 0.572829604f},
-std::array<float,2>{0.369262934f, 0.135645285f},
-std::array<float,2>{0.615083277f, 0.531241059f},
-std::array<float,2>{0.823970258f, 0.443895847f},
-std::array<float,2>{0.100468606f, 0.765871346f},
-std::array<float,2>{0.147306621f, 0.366363168f},
-std::array<float,2>{0.990299642f, 0.9018718f},
-std::array<float,2>{0.744007409f, 0.109213643f},
-std::array<float,2>{0.401898116f, 0.638487458f},
-std::array<float,2>{0.113524519f, 0.159784421f},
-std::array<float,2>{0.842594624f, 0.536663711f},
-std::array<float,2>{0.600678563f, 0.469780385f},
-std::array<float,2>{0.351441413f, 0.796850801f},
-std::array<float,2>{0.379723996f, 0.327685356f},
-std::array<float,2>{0.720601618f, 0.923788786f},
-std::array<float,2>{0.97110498f, 0.0868553817f},
-std::array<float,2>{0.133180484f, 0.679666877f},
-std::array<float,2>{0.296923906f, 0.00402438547f},
-std::array<float,2>{0.539149225f, 0.735114872f},
-std::array<float,2>{0.791115582f, 0.306961745f},
-std::array<float,2>{0.0149574215f, 0.96181047f},
-std::array<float,2>{0.212503657f, 0.433621079f},
-std::array<float,2>{0.883939445f, 0.866273522f},
-std::array<float,2>{0.657810211f, 0.226268098f},
-std::array<float,2>{0.464335233f, 0.597187877f},
-std::array<float,2>{0.175263301f, 0.119921185f},
-std::array<float,2>{0.961013377f, 0.652641237f},
-std::array<float,2>{0.712839901f, 0.344678462f},
-std::array<float,2>{0.410715133f, 0.883913219f},
-std::array<float,2>{0.321138412f, 0.461971909f},
-std::array<float,2>{0.577349603f, 0.75357157f},
-std::array<float,2>{0.861844659f, 0.145902574f},
-std::array<float,2>{0.063293308f, 0.507007182f},
-std::array<float,2>{0.474689156f, 0.196257994f},
-std::array<float,2>{0.629287422f, 0.58326745f},
-std::array<float,2>{0.912803352f, 0.378419906f},
-std::array<float,2>{0.224598393f, 0.826987028f},
-std::array<float,2>{0.0392963961f, 0.261716455f},
-std::array<float,2>{0.756810844f, 0.992781937f},
-std::array<float,2>{0.502152026f, 0.0449825116f},
-std::array<float,2>{0.266007185f, 0.689061463f}}
\ No newline at end of file
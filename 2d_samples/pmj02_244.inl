@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.107748784f, 0.296976566f},
-std::array<float,2>{0.979094088f, 0.503658652f},
-std::array<float,2>{0.670453966f, 0.0796207339f},
-std::array<float,2>{0.313629657f, 0.813653409f},
-std::array<float,2>{0.484149158f, 0.233132735f},
-std::array<float,2>{0.623832166f, 0.978552997f},
-std::array<float,2>{0.765758157f, 0.48790437f},
-std::array<float,2>{0.154453307f, 0.638367176f},
-std::array<float,2>{0.205240577f, 0.00428763032f},
-std::array<float,2>{0.834925532f, 0.779361129f},
-std::array<float,2>{0.543597519f, 0.32032305f},
-std::array<float,2>{0.427706033f, 0.571377814f},
-std::array<float,2>{0.258080244f, 0.421058059f},
-std::array<float,2>{0.714425802f, 0.712052941f},
-std::array<float,2>{0.914579093f, 0.126379848f},
-std::array<float,2>{0.0601613447f, 0.91492486f},
-std::array<float,2>{0.180077568f, 0.446119249f},
-std::array<float,2>{0.784765601f, 0.660620272f},
-std::array<float,2>{0.573948562f, 0.207069293f},
-std::array<float,2>{0.455294013f, 0.937631845f},
-std::array<float,2>{0.350892723f, 0.102734908f},
-std::array<float,2>{0.6455881f, 0.869910181f},
-std::array<float,2>{0.962949455f, 0.25788337f},
-std::array<float,2>{0.086843878f, 0.556689858f},
-std::array<float,2>{0.0173901021f, 0.167032778f},
-std::array<float,2>{0.876941562f, 0.903916419f},
-std::array<float,2>{0.728030682f, 0.397101671f},
-std::array<float,2>{0.285924882f, 0.721539617f},
-std::array<float,2>{0.397984594f, 0.354245991f},
-std::array<float,2>{0.52475208f, 0.610148251f},
-std::array<float,2>{0.85678345f, 0.032942377f},
-std::array<float,2>{0.230782598f, 0.782783687f},
-std::array<float,2>{0.238919035f, 0.331970185f},
-std::array<float,2>{0.874966919f, 0.587790132f},
-std::array<float,2>{0.501301944f, 0.0178175569f},
-std::array<float,2>{0.379639208f, 0.752586901f},
-std::array<float,2>{0.299665451f, 0.144079655f},
-std::array<float,2>{0.734681666f, 0.933087289f},
-std::array<float,2>{0.902950168f, 0.422210097f},
-std::array<float,2>{0.00274378969f, 0.693236768f},
-std::array<float,2>{0.0723384172f, 0.0718627721f},
-std::array<float,2>{0.948497772f, 0.832308888f},
-std::array<float,2>{0.632735133f, 0.286378056f},
-std::array<float,2>{0.37327674f, 0.525571108f},
-std::array<float,2>{0.448660821f, 0.469534278f},
-std::array<float,2>{0.580337465f, 0.654395401f},
-std::array<float,2>{0.80708307f, 0.235928312f},
-std::array<float,2>{0.167273834f, 0.994114578f},
-std::array<float,2>{0.0409519784f, 0.383451194f},
-std::array<float,2>{0.923004389f, 0.738284409f},
-std::array<float,2>{0.701716125f, 0.179452971f},
-std::array<float,2>{0.265973449f, 0.887279868f},
-std::array<float,2>{0.406372815f, 0.0537670366f},
-std::array<float,2>{0.549631655f, 0.808243871f},
-std::array<float,2>{0.813797772f, 0.371395469f},
-std::array<float,2>{0.197276697f, 0.601388693f},
-std::array<float,2>{0.135285288f, 0.196939871f},
-std::array<float,2>{0.761640906f, 0.968230546f},
-std::array<float,2>{0.597884119f, 0.454975009f},
-std::array<float,2>{0.499188125f, 0.680153966f},
-std::array<float,2>{0.340873539f, 0.2769306f},
-std::array<float,2>{0.682435632f, 0.545850277f},
-std::array<float,2>{0.985832989f, 0.110052675f},
-std::array<float,2>{0.122509897f, 0.844604313f},
-std::array<float,2>{0.00827663019f, 0.365080744f},
-std::array<float,2>{0.896502078f, 0.603582084f},
-std::array<float,2>{0.744704545f, 0.059477251f},
-std::array<float,2>{0.305344939f, 0.797766268f},
-std::array<float,2>{0.389438301f, 0.184864819f},
-std::array<float,2>{0.514312506f, 0.875652611f},
-std::array<float,2>{0.866277456f, 0.381831348f},
-std::array<float,2>{0.244356692f, 0.742876649f},
-std::array<float,2>{0.156261086f, 0.124444664f},
-std::array<float,2>{0.797771275f, 0.857530594f},
-std::array<float,2>{0.591180444f, 0.266289681f},
-std::array<float,2>{0.441920638f, 0.538818538f},
-std::array<float,2>{0.361408979f, 0.462175965f},
-std::array<float,2>{0.634929955f, 0.675639629f},
-std::array<float,2>{0.944475591f, 0.192663714f},
-std::array<float,2>{0.0647332147f, 0.95361793f},
-std::array<float,2>{0.193269119f, 0.433307052f},
-std::array<float,2>{0.820430279f, 0.700018346f},
-std::array<float,2>{0.554844916f, 0.155260608f},
-std::array<float,2>{0.41647312f, 0.924992383f},
-std::array<float,2>{0.279129505f, 0.0280559026f},
-std::array<float,2>{0.688675582f, 0.76178962f},
-std::array<float,2>{0.933704019f, 0.340100795f},
-std::array<float,2>{0.0371039696f, 0.580292165f},
-std::array<float,2>{0.11689996f, 0.249657631f},
-std::array<float,2>{0.999373078f, 0.991969287f},
-std::array<float,2>{0.676687002f, 0.479568183f},
-std::array<float,2>{0.331048071f, 0.646486878f},
-std::array<float,2>{0.485372007f, 0.296491921f},
-std::array<float,2>{0.601913691f, 0.517343223f},
-std::array<float,2>{0.750918806f, 0.069898352f},
-std::array<float,2>{0.130854756f, 0.837295115f},
-std::array<float,2>{0.144638032f, 0.252614409f},
-std::array<float,2>{0.773786426f, 0.554072559f},
-std::array<float,2>{0.616026402f, 0.0971235111f},
-std::array<float,2>{0.473552704f, 0.866023958f},
-std::array<float,2>{0.325276434f, 0.211540267f},
-std::array<float,2>{0.656585336f, 0.946517885f},
-std::array<float,2>{0.974042058f, 0.444712579f},
-std::array<float,2>{0.0953727141f, 0.6695894f},
-std::array<float,2>{0.0484413728f, 0.0412305593f},
-std::array<float,2>{0.911228597f, 0.79339993f},
-std::array<float,2>{0.70366329f, 0.349248379f},
-std::array<float,2>{0.251085401f, 0.622342408f},
-std::array<float,2>{0.430352151f, 0.400417656f},
-std::array<float,2>{0.537101328f, 0.72938019f},
-std::array<float,2>{0.841554284f, 0.159340754f},
-std::array<float,2>{0.215950713f, 0.89273876f},
-std::array<float,2>{0.0799518451f, 0.498301506f},
-std::array<float,2>{0.957430482f, 0.630385816f},
-std::array<float,2>{0.651053071f, 0.225765809f},
-std::array<float,2>{0.354521215f, 0.970971823f},
-std::array<float,2>{0.46515584f, 0.0869094431f},
-std::array<float,2>{0.563488364f, 0.824155569f},
-std::array<float,2>{0.795768976f, 0.311475784f},
-std::array<float,2>{0.178327873f, 0.508257091f},
-std::array<float,2>{0.224837869f, 0.139883369f},
-std::array<float,2>{0.846278489f, 0.911183178f},
-std::array<float,2>{0.519442797f, 0.408295333f},
-std::array<float,2>{0.398800641f, 0.704459071f},
-std::array<float,2>{0.295134068f, 0.319676936f},
-std::array<float,2>{0.72258997f, 0.564063251f},
-std::array<float,2>{0.884839952f, 0.013953493f},
-std::array<float,2>{0.0312022865f, 0.77123487f},
-std::array<float,2>{0.0701261312f, 0.326326579f},
-std::array<float,2>{0.941012681f, 0.576057494f},
-std::array<float,2>{0.638421595f, 0.00286057987f},
-std::array<float,2>{0.366955906f, 0.776160121f},
-std::array<float,2>{0.440456569f, 0.131797031f},
-std::array<float,2>{0.587298572f, 0.918156862f},
-std::array<float,2>{0.803072393f, 0.414743811f},
-std::array<float,2>{0.161898911f, 0.717847109f},
-std::array<float,2>{0.249261871f, 0.0849436894f},
-std::array<float,2>{0.859485388f, 0.817533553f},
-std::array<float,2>{0.510960937f, 0.304254055f},
-std::array<float,2>{0.384005845f, 0.505297661f},
-std::array<float,2>{0.310583979f, 0.491877764f},
-std::array<float,2>{0.749442041f, 0.635309875f},
-std::array<float,2>{0.89335978f, 0.230146602f},
-std::array<float,2>{0.0129155982f, 0.984000623f},
-std::array<float,2>{0.125543043f, 0.39136067f},
-std::array<float,2>{0.757736146f, 0.725455046f},
-std::array<float,2>{0.607681811f, 0.168203488f},
-std::array<float,2>{0.490011543f, 0.901080847f},
-std::array<float,2>{0.334839284f, 0.0352303013f},
-std::array<float,2>{0.675427973f, 0.789037764f},
-std::array<float,2>{0.994473457f, 0.355475038f},
-std::array<float,2>{0.110683396f, 0.613797486f},
-std::array<float,2>{0.032087747f, 0.206440851f},
-std::array<float,2>{0.931124628f, 0.944372714f},
-std::array<float,2>{0.694040418f, 0.449391276f},
-std::array<float,2>{0.274632692f, 0.657875717f},
-std::array<float,2>{0.41934216f, 0.26445803f},
-std::array<float,2>{0.560772657f, 0.56087029f},
-std::array<float,2>{0.827816069f, 0.106063642f},
-std::array<float,2>{0.188208699f, 0.87312758f},
-std::array<float,2>{0.212183744f, 0.281737626f},
-std::array<float,2>{0.839100957f, 0.528552234f},
-std::array<float,2>{0.534498811f, 0.074434638f},
-std::array<float,2>{0.435413122f, 0.831276238f},
-std::array<float,2>{0.256023139f, 0.241644397f},
-std::array<float,2>{0.707587481f, 0.998780131f},
-std::array<float,2>{0.906280875f, 0.473044932f},
-std::array<float,2>{0.0533574969f, 0.651136756f},
-std::array<float,2>{0.0987943262f, 0.020218214f},
-std::array<float,2>{0.97135222f, 0.756312251f},
-std::array<float,2>{0.660558164f, 0.335157812f},
-std::array<float,2>{0.320844829f, 0.591845572f},
-std::array<float,2>{0.469189733f, 0.42688176f},
-std::array<float,2>{0.610710561f, 0.690897226f},
-std::array<float,2>{0.780048013f, 0.14553225f},
-std::array<float,2>{0.143158048f, 0.935959339f},
-std::array<float,2>{0.024178056f, 0.457178026f},
-std::array<float,2>{0.886910498f, 0.686175048f},
-std::array<float,2>{0.72475028f, 0.200332001f},
-std::array<float,2>{0.290871292f, 0.964080155f},
-std::array<float,2>{0.403172851f, 0.117095888f},
-std::array<float,2>{0.521620035f, 0.850440383f},
-std::array<float,2>{0.850477636f, 0.277707189f},
-std::array<float,2>{0.221994594f, 0.540487707f},
-std::array<float,2>{0.17480424f, 0.174554914f},
-std::array<float,2>{0.789568186f, 0.886403918f},
-std::array<float,2>{0.569331586f, 0.390366495f},
-std::array<float,2>{0.464821786f, 0.734909117f},
-std::array<float,2>{0.3588503f, 0.367882878f},
-std::array<float,2>{0.654278517f, 0.595317125f},
-std::array<float,2>{0.954280436f, 0.0485426188f},
-std::array<float,2>{0.0848371461f, 0.808819532f},
-std::array<float,2>{0.0570549741f, 0.272024512f},
-std::array<float,2>{0.920471072f, 0.531645954f},
-std::array<float,2>{0.715094388f, 0.121059693f},
-std::array<float,2>{0.261760056f, 0.855316877f},
-std::array<float,2>{0.424547851f, 0.188801184f},
-std::array<float,2>{0.539880037f, 0.957998157f},
-std::array<float,2>{0.831902027f, 0.468195349f},
-std::array<float,2>{0.20704174f, 0.676479876f},
-std::array<float,2>{0.152205557f, 0.0573346727f},
-std::array<float,2>{0.770746291f, 0.800956547f},
-std::array<float,2>{0.619705081f, 0.362166971f},
-std::array<float,2>{0.478402048f, 0.60908556f},
-std::array<float,2>{0.316449016f, 0.377410144f},
-std::array<float,2>{0.664419532f, 0.74646008f},
-std::array<float,2>{0.980866313f, 0.181732863f},
-std::array<float,2>{0.103724845f, 0.8793782f},
-std::array<float,2>{0.228636384f, 0.483653545f},
-std::array<float,2>{0.854054451f, 0.644257486f},
-std::array<float,2>{0.527495801f, 0.243982613f},
-std::array<float,2>{0.39213872f, 0.98758781f},
-std::array<float,2>{0.284452945f, 0.0640523806f},
-std::array<float,2>{0.731343031f, 0.843190551f},
-std::array<float,2>{0.881468594f, 0.291872859f},
-std::array<float,2>{0.0210093185f, 0.520937264f},
-std::array<float,2>{0.0908392966f, 0.151937798f},
-std::array<float,2>{0.966861248f, 0.928409576f},
-std::array<float,2>{0.641114891f, 0.436516434f},
-std::array<float,2>{0.347631395f, 0.697446287f},
-std::array<float,2>{0.460226387f, 0.336982548f},
-std::array<float,2>{0.574413061f, 0.585614383f},
-std::array<float,2>{0.78528291f, 0.0240924731f},
-std::array<float,2>{0.185026765f, 0.761577964f},
-std::array<float,2>{0.169177696f, 0.344705611f},
-std::array<float,2>{0.809599042f, 0.617949963f},
-std::array<float,2>{0.585867763f, 0.0450949706f},
-std::array<float,2>{0.452077389f, 0.792896867f},
-std::array<float,2>{0.3678644f, 0.163254902f},
-std::array<float,2>{0.628802717f, 0.897288442f},
-std::array<float,2>{0.949753404f, 0.404228121f},
-std::array<float,2>{0.0773664862f, 0.7306692f},
-std::array<float,2>{0.00752045261f, 0.0980465338f},
-std::array<float,2>{0.900672615f, 0.860842645f},
-std::array<float,2>{0.740685165f, 0.255199164f},
-std::array<float,2>{0.302308887f, 0.547370374f},
-std::array<float,2>{0.376656771f, 0.441348135f},
-std::array<float,2>{0.507689416f, 0.667568266f},
-std::array<float,2>{0.868667006f, 0.216115445f},
-std::array<float,2>{0.23825334f, 0.949787974f},
-std::array<float,2>{0.120459884f, 0.413685054f},
-std::array<float,2>{0.989003062f, 0.709905684f},
-std::array<float,2>{0.685912549f, 0.135235772f},
-std::array<float,2>{0.336052686f, 0.909540236f},
-std::array<float,2>{0.492841274f, 0.0109951608f},
-std::array<float,2>{0.597317517f, 0.769142389f},
-std::array<float,2>{0.762501538f, 0.31554994f},
-std::array<float,2>{0.14041236f, 0.567134261f},
-std::array<float,2>{0.199376956f, 0.221609682f},
-std::array<float,2>{0.819947422f, 0.974104345f},
-std::array<float,2>{0.553404152f, 0.492795616f},
-std::array<float,2>{0.413516849f, 0.627255678f},
-std::array<float,2>{0.271104574f, 0.307791829f},
-std::array<float,2>{0.695344031f, 0.51187259f},
-std::array<float,2>{0.92899704f, 0.0905580521f},
-std::array<float,2>{0.0461556017f, 0.825508833f},
-std::array<float,2>{0.0883508697f, 0.260968804f},
-std::array<float,2>{0.960994303f, 0.555065453f},
-std::array<float,2>{0.647987664f, 0.104493581f},
-std::array<float,2>{0.349063456f, 0.868792892f},
-std::array<float,2>{0.453416288f, 0.2090334f},
-std::array<float,2>{0.571956933f, 0.94115597f},
-std::array<float,2>{0.781749368f, 0.4490771f},
-std::array<float,2>{0.182826832f, 0.663782775f},
-std::array<float,2>{0.233911693f, 0.0338618532f},
-std::array<float,2>{0.859304845f, 0.78483814f},
-std::array<float,2>{0.526092887f, 0.351718605f},
-std::array<float,2>{0.39481023f, 0.611489773f},
-std::array<float,2>{0.288969696f, 0.39639613f},
-std::array<float,2>{0.72963196f, 0.720593989f},
-std::array<float,2>{0.877487838f, 0.165477797f},
-std::array<float,2>{0.018139245f, 0.905363739f},
-std::array<float,2>{0.154254973f, 0.484659791f},
-std::array<float,2>{0.769354105f, 0.639193594f},
-std::array<float,2>{0.621789098f, 0.230924398f},
-std::array<float,2>{0.480570376f, 0.977598608f},
-std::array<float,2>{0.316223711f, 0.0802235305f},
-std::array<float,2>{0.66953069f, 0.814781964f},
-std::array<float,2>{0.977664113f, 0.299378604f},
-std::array<float,2>{0.106783144f, 0.501608729f},
-std::array<float,2>{0.0615822002f, 0.12887232f},
-std::array<float,2>{0.917030632f, 0.917862356f},
-std::array<float,2>{0.712840796f, 0.418238282f},
-std::array<float,2>{0.260461807f, 0.71468699f},
-std::array<float,2>{0.42774561f, 0.322658986f},
-std::array<float,2>{0.54517442f, 0.574168742f},
-std::array<float,2>{0.833425045f, 0.00599268172f},
-std::array<float,2>{0.204404861f, 0.779289126f},
-std::array<float,2>{0.195752755f, 0.374319792f},
-std::array<float,2>{0.815467834f, 0.597678185f},
-std::array<float,2>{0.547270417f, 0.0522098355f},
-std::array<float,2>{0.408939868f, 0.806406975f},
-std::array<float,2>{0.268654346f, 0.177121848f},
-std::array<float,2>{0.700324059f, 0.889656246f},
-std::array<float,2>{0.924993575f, 0.385414034f},
-std::array<float,2>{0.0428206474f, 0.741975307f},
-std::array<float,2>{0.123226702f, 0.111818679f},
-std::array<float,2>{0.987097621f, 0.84630841f},
-std::array<float,2>{0.681400359f, 0.275328845f},
-std::array<float,2>{0.34242478f, 0.544269145f},
-std::array<float,2>{0.49678573f, 0.45647189f},
-std::array<float,2>{0.601486146f, 0.68323046f},
-std::array<float,2>{0.759534061f, 0.199194044f},
-std::array<float,2>{0.133823812f, 0.966036618f},
-std::array<float,2>{0.000455465313f, 0.425527364f},
-std::array<float,2>{0.904935122f, 0.694458604f},
-std::array<float,2>{0.737888038f, 0.141510174f},
-std::array<float,2>{0.296964973f, 0.931552231f},
-std::array<float,2>{0.380864084f, 0.0172718409f},
-std::array<float,2>{0.502688229f, 0.75041616f},
-std::array<float,2>{0.872724414f, 0.32940802f},
-std::array<float,2>{0.240860254f, 0.589520991f},
-std::array<float,2>{0.164473221f, 0.237407729f},
-std::array<float,2>{0.80534476f, 0.995752454f},
-std::array<float,2>{0.578502715f, 0.471173108f},
-std::array<float,2>{0.445688635f, 0.654094815f},
-std::array<float,2>{0.371949881f, 0.288214743f},
-std::array<float,2>{0.629107594f, 0.523586273f},
-std::array<float,2>{0.946332514f, 0.0740051642f},
-std::array<float,2>{0.0719604641f, 0.835343122f},
-std::array<float,2>{0.037212152f, 0.342545599f},
-std::array<float,2>{0.937016666f, 0.579447091f},
-std::array<float,2>{0.690995991f, 0.0297443736f},
-std::array<float,2>{0.281170398f, 0.764619291f},
-std::array<float,2>{0.414233804f, 0.15331088f},
-std::array<float,2>{0.557245731f, 0.923317432f},
-std::array<float,2>{0.823161125f, 0.431447208f},
-std::array<float,2>{0.193476647f, 0.701781154f},
-std::array<float,2>{0.132365748f, 0.0680315644f},
-std::array<float,2>{0.753046691f, 0.839696467f},
-std::array<float,2>{0.604802728f, 0.294572681f},
-std::array<float,2>{0.486959159f, 0.519447923f},
-std::array<float,2>{0.328747898f, 0.47749263f},
-std::array<float,2>{0.678472221f, 0.645846844f},
-std::array<float,2>{0.996431589f, 0.247903079f},
-std::array<float,2>{0.115103446f, 0.989566743f},
-std::array<float,2>{0.243436798f, 0.380234182f},
-std::array<float,2>{0.863827705f, 0.745549262f},
-std::array<float,2>{0.51273334f, 0.18648155f},
-std::array<float,2>{0.387218028f, 0.878095567f},
-std::array<float,2>{0.308054447f, 0.0615764447f},
-std::array<float,2>{0.742652535f, 0.79969275f},
-std::array<float,2>{0.895979524f, 0.366524011f},
-std::array<float,2>{0.0114657609f, 0.602741659f},
-std::array<float,2>{0.0634144396f, 0.193855569f},
-std::array<float,2>{0.942465782f, 0.955100894f},
-std::array<float,2>{0.634477377f, 0.463932395f},
-std::array<float,2>{0.361043006f, 0.673712671f},
-std::array<float,2>{0.44413361f, 0.268579304f},
-std::array<float,2>{0.593034387f, 0.53519851f},
-std::array<float,2>{0.799693882f, 0.122458413f},
-std::array<float,2>{0.159020334f, 0.856004059f},
-std::array<float,2>{0.176946431f, 0.309523195f},
-std::array<float,2>{0.794168651f, 0.510552406f},
-std::array<float,2>{0.566148639f, 0.0896284059f},
-std::array<float,2>{0.46837309f, 0.820501983f},
-std::array<float,2>{0.352605462f, 0.223684996f},
-std::array<float,2>{0.649640977f, 0.968939126f},
-std::array<float,2>{0.960839093f, 0.496937871f},
-std::array<float,2>{0.0818242803f, 0.631169617f},
-std::array<float,2>{0.0291735567f, 0.0118195945f},
-std::array<float,2>{0.883597493f, 0.772533774f},
-std::array<float,2>{0.720495701f, 0.317904294f},
-std::array<float,2>{0.293561518f, 0.565358758f},
-std::array<float,2>{0.401511788f, 0.406955898f},
-std::array<float,2>{0.516746402f, 0.706145585f},
-std::array<float,2>{0.845057309f, 0.138555512f},
-std::array<float,2>{0.224055529f, 0.913467109f},
-std::array<float,2>{0.097077392f, 0.442885846f},
-std::array<float,2>{0.976227462f, 0.670572221f},
-std::array<float,2>{0.65953505f, 0.213491097f},
-std::array<float,2>{0.328064919f, 0.948558927f},
-std::array<float,2>{0.47539717f, 0.0942281708f},
-std::array<float,2>{0.614308715f, 0.863983333f},
-std::array<float,2>{0.7772488f, 0.251818568f},
-std::array<float,2>{0.147441432f, 0.551129818f},
-std::array<float,2>{0.21850498f, 0.157921925f},
-std::array<float,2>{0.842047453f, 0.890788615f},
-std::array<float,2>{0.53903228f, 0.399350673f},
-std::array<float,2>{0.43354851f, 0.728404522f},
-std::array<float,2>{0.252469659f, 0.350826621f},
-std::array<float,2>{0.705563724f, 0.623861134f},
-std::array<float,2>{0.912787318f, 0.0395251438f},
-std::array<float,2>{0.0489362217f, 0.795493424f},
-std::array<float,2>{0.111580558f, 0.357545197f},
-std::array<float,2>{0.993448853f, 0.615939498f},
-std::array<float,2>{0.672419131f, 0.0379988626f},
-std::array<float,2>{0.333230823f, 0.785391569f},
-std::array<float,2>{0.492139131f, 0.170370921f},
-std::array<float,2>{0.606797934f, 0.899463892f},
-std::array<float,2>{0.754545093f, 0.393790871f},
-std::array<float,2>{0.127469882f, 0.724600792f},
-std::array<float,2>{0.189960271f, 0.108612634f},
-std::array<float,2>{0.825944662f, 0.871585071f},
-std::array<float,2>{0.559749544f, 0.263512671f},
-std::array<float,2>{0.420875877f, 0.55945766f},
-std::array<float,2>{0.276683033f, 0.452574134f},
-std::array<float,2>{0.69274658f, 0.659448445f},
-std::array<float,2>{0.932843745f, 0.204842374f},
-std::array<float,2>{0.0336812511f, 0.943024218f},
-std::array<float,2>{0.162149072f, 0.416706979f},
-std::array<float,2>{0.801662624f, 0.715547919f},
-std::array<float,2>{0.589142799f, 0.129814774f},
-std::array<float,2>{0.438772351f, 0.92057395f},
-std::array<float,2>{0.363546461f, 0.00128691376f},
-std::array<float,2>{0.63944149f, 0.773896396f},
-std::array<float,2>{0.939037859f, 0.324753493f},
-std::array<float,2>{0.0665328875f, 0.577354014f},
-std::array<float,2>{0.0140080703f, 0.227598235f},
-std::array<float,2>{0.891657174f, 0.981286108f},
-std::array<float,2>{0.747642636f, 0.488525152f},
-std::array<float,2>{0.309000075f, 0.634258687f},
-std::array<float,2>{0.386565089f, 0.302700609f},
-std::array<float,2>{0.508444309f, 0.506408572f},
-std::array<float,2>{0.863161147f, 0.0825648382f},
-std::array<float,2>{0.247854859f, 0.819331169f},
-std::array<float,2>{0.219005674f, 0.27968964f},
-std::array<float,2>{0.848828673f, 0.542268097f},
-std::array<float,2>{0.519649625f, 0.113381781f},
-std::array<float,2>{0.404489607f, 0.847760022f},
-std::array<float,2>{0.291027218f, 0.202157587f},
-std::array<float,2>{0.723658562f, 0.962112665f},
-std::array<float,2>{0.889600635f, 0.459137976f},
-std::array<float,2>{0.0267257858f, 0.68411696f},
-std::array<float,2>{0.0823014006f, 0.0505070202f},
-std::array<float,2>{0.956600547f, 0.811623037f},
-std::array<float,2>{0.654805958f, 0.371072292f},
-std::array<float,2>{0.355569571f, 0.596248627f},
-std::array<float,2>{0.461695611f, 0.387867659f},
-std::array<float,2>{0.566783309f, 0.736674547f},
-std::array<float,2>{0.791739225f, 0.172303572f},
-std::array<float,2>{0.17336674f, 0.883905828f},
-std::array<float,2>{0.0520640239f, 0.476248503f},
-std::array<float,2>{0.908608437f, 0.650380731f},
-std::array<float,2>{0.709094882f, 0.239959821f},
-std::array<float,2>{0.253919393f, 0.997772992f},
-std::array<float,2>{0.435774982f, 0.0774884596f},
-std::array<float,2>{0.532150328f, 0.828605473f},
-std::array<float,2>{0.836943328f, 0.284192532f},
-std::array<float,2>{0.21445854f, 0.529457271f},
-std::array<float,2>{0.141971171f, 0.147016183f},
-std::array<float,2>{0.777895987f, 0.934131145f},
-std::array<float,2>{0.611981392f, 0.429549694f},
-std::array<float,2>{0.471855909f, 0.68935889f},
-std::array<float,2>{0.323319882f, 0.3329615f},
-std::array<float,2>{0.663715661f, 0.59009093f},
-std::array<float,2>{0.968943298f, 0.022221826f},
-std::array<float,2>{0.0998850018f, 0.754683673f},
-std::array<float,2>{0.0227001999f, 0.290326297f},
-std::array<float,2>{0.879842222f, 0.52152288f},
-std::array<float,2>{0.732821703f, 0.064884685f},
-std::array<float,2>{0.282881528f, 0.840813577f},
-std::array<float,2>{0.394312054f, 0.246015728f},
-std::array<float,2>{0.530376434f, 0.985927522f},
-std::array<float,2>{0.852709293f, 0.481735408f},
-std::array<float,2>{0.22757639f, 0.642493248f},
-std::array<float,2>{0.185991779f, 0.026553072f},
-std::array<float,2>{0.787185907f, 0.757967532f},
-std::array<float,2>{0.577474296f, 0.338540554f},
-std::array<float,2>{0.457151711f, 0.582577527f},
-std::array<float,2>{0.345261216f, 0.433668941f},
-std::array<float,2>{0.64420855f, 0.695348382f},
-std::array<float,2>{0.966025174f, 0.148823842f},
-std::array<float,2>{0.0936045498f, 0.927676141f},
-std::array<float,2>{0.210289136f, 0.466755718f},
-std::array<float,2>{0.828454256f, 0.677821815f},
-std::array<float,2>{0.542383015f, 0.189640373f},
-std::array<float,2>{0.422563195f, 0.959263742f},
-std::array<float,2>{0.264626294f, 0.118477896f},
-std::array<float,2>{0.717625916f, 0.852131844f},
-std::array<float,2>{0.918842733f, 0.271071643f},
-std::array<float,2>{0.0550670959f, 0.533851564f},
-std::array<float,2>{0.103148364f, 0.179759368f},
-std::array<float,2>{0.982602298f, 0.881196678f},
-std::array<float,2>{0.667698979f, 0.375233531f},
-std::array<float,2>{0.319475621f, 0.748976946f},
-std::array<float,2>{0.479340851f, 0.359988898f},
-std::array<float,2>{0.617327631f, 0.605636477f},
-std::array<float,2>{0.771657586f, 0.055241432f},
-std::array<float,2>{0.148815647f, 0.803245842f},
-std::array<float,2>{0.137582108f, 0.313946843f},
-std::array<float,2>{0.76446563f, 0.568771064f},
-std::array<float,2>{0.595397294f, 0.00829412974f},
-std::array<float,2>{0.495471418f, 0.766619444f},
-std::array<float,2>{0.339000463f, 0.133531868f},
-std::array<float,2>{0.683665395f, 0.908160388f},
-std::array<float,2>{0.991622269f, 0.410778373f},
-std::array<float,2>{0.117242716f, 0.707607508f},
-std::array<float,2>{0.0434336551f, 0.0925731808f},
-std::array<float,2>{0.926390707f, 0.827595174f},
-std::array<float,2>{0.698656738f, 0.305319399f},
-std::array<float,2>{0.27313745f, 0.514480054f},
-std::array<float,2>{0.410800308f, 0.49464646f},
-std::array<float,2>{0.551700115f, 0.626829147f},
-std::array<float,2>{0.817705274f, 0.220429555f},
-std::array<float,2>{0.201567948f, 0.975577652f},
-std::array<float,2>{0.0755688548f, 0.404417455f},
-std::array<float,2>{0.95154649f, 0.734354436f},
-std::array<float,2>{0.626001596f, 0.160779417f},
-std::array<float,2>{0.370320231f, 0.896111548f},
-std::array<float,2>{0.450668097f, 0.0440730788f},
-std::array<float,2>{0.582824886f, 0.790615797f},
-std::array<float,2>{0.81153518f, 0.347632229f},
-std::array<float,2>{0.171313405f, 0.619749308f},
-std::array<float,2>{0.234627023f, 0.218443006f},
-std::array<float,2>{0.86964941f, 0.953034341f},
-std::array<float,2>{0.505831778f, 0.438922018f},
-std::array<float,2>{0.377103359f, 0.664813399f},
-std::array<float,2>{0.304654837f, 0.256841749f},
-std::array<float,2>{0.739269972f, 0.550044537f},
-std::array<float,2>{0.898924828f, 0.100771822f},
-std::array<float,2>{0.00553837605f, 0.862051189f},
-std::array<float,2>{0.122004412f, 0.273675054f},
-std::array<float,2>{0.984944999f, 0.543048441f},
-std::array<float,2>{0.683345973f, 0.112804435f},
-std::array<float,2>{0.340805918f, 0.847088873f},
-std::array<float,2>{0.498757273f, 0.197801799f},
-std::array<float,2>{0.598906398f, 0.965679348f},
-std::array<float,2>{0.760524094f, 0.455156684f},
-std::array<float,2>{0.136288628f, 0.682600319f},
-std::array<float,2>{0.198728278f, 0.0514796935f},
-std::array<float,2>{0.812664747f, 0.805430353f},
-std::array<float,2>{0.550132096f, 0.373945415f},
-std::array<float,2>{0.408064902f, 0.599308968f},
-std::array<float,2>{0.267029107f, 0.386469841f},
-std::array<float,2>{0.702942967f, 0.740416408f},
-std::array<float,2>{0.922703266f, 0.175808102f},
-std::array<float,2>{0.0394457206f, 0.889278114f},
-std::array<float,2>{0.166826606f, 0.471866816f},
-std::array<float,2>{0.807873368f, 0.653205514f},
-std::array<float,2>{0.581644237f, 0.236885801f},
-std::array<float,2>{0.447468013f, 0.99418968f},
-std::array<float,2>{0.374586225f, 0.0731571242f},
-std::array<float,2>{0.631403804f, 0.834923565f},
-std::array<float,2>{0.947525501f, 0.287252903f},
-std::array<float,2>{0.0736110359f, 0.525390327f},
-std::array<float,2>{0.00315788831f, 0.14231728f},
-std::array<float,2>{0.903960526f, 0.930287182f},
-std::array<float,2>{0.736041129f, 0.424697697f},
-std::array<float,2>{0.3002235f, 0.694245338f},
-std::array<float,2>{0.380341232f, 0.328974396f},
-std::array<float,2>{0.500203907f, 0.587894022f},
-std::array<float,2>{0.873279035f, 0.0157085285f},
-std::array<float,2>{0.239856705f, 0.75142628f},
-std::array<float,2>{0.232129246f, 0.353289276f},
-std::array<float,2>{0.855959415f, 0.612453759f},
-std::array<float,2>{0.524371028f, 0.0342964455f},
-std::array<float,2>{0.397081524f, 0.783780634f},
-std::array<float,2>{0.286888272f, 0.164552823f},
-std::array<float,2>{0.726772845f, 0.904950917f},
-std::array<float,2>{0.875199914f, 0.394554138f},
-std::array<float,2>{0.0161026884f, 0.718752921f},
-std::array<float,2>{0.0869790167f, 0.104029588f},
-std::array<float,2>{0.964615583f, 0.867545307f},
-std::array<float,2>{0.644589663f, 0.26073429f},
-std::array<float,2>{0.350367099f, 0.555871725f},
-std::array<float,2>{0.456688821f, 0.447815388f},
-std::array<float,2>{0.573054969f, 0.662139535f},
-std::array<float,2>{0.783547342f, 0.210630402f},
-std::array<float,2>{0.18086414f, 0.939888537f},
-std::array<float,2>{0.0593070984f, 0.419391811f},
-std::array<float,2>{0.915663242f, 0.713736594f},
-std::array<float,2>{0.713316441f, 0.126967221f},
-std::array<float,2>{0.258845657f, 0.916815579f},
-std::array<float,2>{0.426579833f, 0.00691444427f},
-std::array<float,2>{0.544819951f, 0.778274596f},
-std::array<float,2>{0.835879862f, 0.324053228f},
-std::array<float,2>{0.206975266f, 0.57280767f},
-std::array<float,2>{0.156045452f, 0.23228015f},
-std::array<float,2>{0.767575204f, 0.976955116f},
-std::array<float,2>{0.624091029f, 0.485615999f},
-std::array<float,2>{0.483360767f, 0.640027285f},
-std::array<float,2>{0.313291878f, 0.300764501f},
-std::array<float,2>{0.671481252f, 0.500373423f},
-std::array<float,2>{0.979664922f, 0.0812226608f},
-std::array<float,2>{0.109308034f, 0.815584838f},
-std::array<float,2>{0.0293656029f, 0.316833258f},
-std::array<float,2>{0.885799646f, 0.566230714f},
-std::array<float,2>{0.72147876f, 0.013047833f},
-std::array<float,2>{0.29615593f, 0.771563172f},
-std::array<float,2>{0.399734467f, 0.137600079f},
-std::array<float,2>{0.517784894f, 0.913067222f},
-std::array<float,2>{0.846881092f, 0.407338887f},
-std::array<float,2>{0.2261924f, 0.705380857f},
-std::array<float,2>{0.17939654f, 0.0880027041f},
-std::array<float,2>{0.795985103f, 0.821684241f},
-std::array<float,2>{0.563205421f, 0.310383886f},
-std::array<float,2>{0.466416985f, 0.510809481f},
-std::array<float,2>{0.353795856f, 0.49780941f},
-std::array<float,2>{0.651576698f, 0.632454455f},
-std::array<float,2>{0.958605766f, 0.223383933f},
-std::array<float,2>{0.0784151182f, 0.970627666f},
-std::array<float,2>{0.215056971f, 0.39945507f},
-std::array<float,2>{0.83994478f, 0.72687459f},
-std::array<float,2>{0.535203218f, 0.156966522f},
-std::array<float,2>{0.430910081f, 0.892507732f},
-std::array<float,2>{0.250890106f, 0.0402015075f},
-std::array<float,2>{0.704817295f, 0.796278059f},
-std::array<float,2>{0.910999894f, 0.349996924f},
-std::array<float,2>{0.0475356579f, 0.624031365f},
-std::array<float,2>{0.0939465538f, 0.214088887f},
-std::array<float,2>{0.972792804f, 0.947482169f},
-std::array<float,2>{0.658162415f, 0.442150772f},
-std::array<float,2>{0.325096995f, 0.671548247f},
-std::array<float,2>{0.473887175f, 0.25019443f},
-std::array<float,2>{0.616612256f, 0.552336991f},
-std::array<float,2>{0.774487197f, 0.0953977481f},
-std::array<float,2>{0.145671606f, 0.865013659f},
-std::array<float,2>{0.129683986f, 0.29367432f},
-std::array<float,2>{0.751930118f, 0.518435061f},
-std::array<float,2>{0.60311985f, 0.0672917813f},
-std::array<float,2>{0.484553814f, 0.838296652f},
-std::array<float,2>{0.331833482f, 0.246192619f},
-std::array<float,2>{0.67737186f, 0.98907119f},
-std::array<float,2>{0.998833716f, 0.477885872f},
-std::array<float,2>{0.116056576f, 0.645004332f},
-std::array<float,2>{0.0357933976f, 0.0308913216f},
-std::array<float,2>{0.934990525f, 0.765103161f},
-std::array<float,2>{0.688044071f, 0.343005806f},
-std::array<float,2>{0.278319359f, 0.578975856f},
-std::array<float,2>{0.417393267f, 0.430454761f},
-std::array<float,2>{0.556256235f, 0.702293038f},
-std::array<float,2>{0.821722269f, 0.154154554f},
-std::array<float,2>{0.191930309f, 0.921994925f},
-std::array<float,2>{0.0662068725f, 0.463679343f},
-std::array<float,2>{0.943752587f, 0.672157943f},
-std::array<float,2>{0.63602376f, 0.19441098f},
-std::array<float,2>{0.36280477f, 0.956727147f},
-std::array<float,2>{0.443065494f, 0.121196508f},
-std::array<float,2>{0.590458691f, 0.856673539f},
-std::array<float,2>{0.798787296f, 0.267806113f},
-std::array<float,2>{0.157896891f, 0.536794007f},
-std::array<float,2>{0.24586761f, 0.18672578f},
-std::array<float,2>{0.865472913f, 0.877796292f},
-std::array<float,2>{0.51545763f, 0.379569083f},
-std::array<float,2>{0.39006117f, 0.744747579f},
-std::array<float,2>{0.306288034f, 0.365760863f},
-std::array<float,2>{0.745904088f, 0.602385581f},
-std::array<float,2>{0.898293853f, 0.0611937195f},
-std::array<float,2>{0.00939738564f, 0.800203383f},
-std::array<float,2>{0.0858282521f, 0.369216561f},
-std::array<float,2>{0.953379214f, 0.596920311f},
-std::array<float,2>{0.653173983f, 0.049119886f},
-std::array<float,2>{0.358161569f, 0.81060946f},
-std::array<float,2>{0.463556886f, 0.173268303f},
-std::array<float,2>{0.570079684f, 0.883485734f},
-std::array<float,2>{0.790079057f, 0.386966676f},
-std::array<float,2>{0.175463393f, 0.73823005f},
-std::array<float,2>{0.221032694f, 0.114326991f},
-std::array<float,2>{0.85111481f, 0.848663747f},
-std::array<float,2>{0.52325815f, 0.281140625f},
-std::array<float,2>{0.404214174f, 0.541445136f},
-std::array<float,2>{0.289370477f, 0.460372388f},
-std::array<float,2>{0.726187229f, 0.684889555f},
-std::array<float,2>{0.888513863f, 0.202057838f},
-std::array<float,2>{0.0252952483f, 0.96094203f},
-std::array<float,2>{0.143953651f, 0.427815914f},
-std::array<float,2>{0.781213939f, 0.687944114f},
-std::array<float,2>{0.610261083f, 0.147870243f},
-std::array<float,2>{0.469932437f, 0.935376525f},
-std::array<float,2>{0.321412474f, 0.0227432773f},
-std::array<float,2>{0.661990345f, 0.755268872f},
-std::array<float,2>{0.972075701f, 0.33358112f},
-std::array<float,2>{0.0979189202f, 0.591309488f},
-std::array<float,2>{0.0541699938f, 0.239122555f},
-std::array<float,2>{0.9072541f, 0.996866286f},
-std::array<float,2>{0.708794355f, 0.474940985f},
-std::array<float,2>{0.257031143f, 0.649260938f},
-std::array<float,2>{0.434147269f, 0.283320874f},
-std::array<float,2>{0.533606112f, 0.531095624f},
-std::array<float,2>{0.838501394f, 0.0766957849f},
-std::array<float,2>{0.211635038f, 0.829170585f},
-std::array<float,2>{0.188891768f, 0.26190421f},
-std::array<float,2>{0.827007353f, 0.559773743f},
-std::array<float,2>{0.561901689f, 0.107634649f},
-std::array<float,2>{0.418628097f, 0.872912586f},
-std::array<float,2>{0.2743406f, 0.203589633f},
-std::array<float,2>{0.695138931f, 0.94151026f},
-std::array<float,2>{0.93042773f, 0.451966763f},
-std::array<float,2>{0.0327294096f, 0.658316076f},
-std::array<float,2>{0.110281363f, 0.0383089446f},
-std::array<float,2>{0.99553299f, 0.787000716f},
-std::array<float,2>{0.674240351f, 0.359206825f},
-std::array<float,2>{0.335157931f, 0.61629045f},
-std::array<float,2>{0.489098549f, 0.39340809f},
-std::array<float,2>{0.609244525f, 0.722668052f},
-std::array<float,2>{0.756179631f, 0.17167595f},
-std::array<float,2>{0.126739874f, 0.898973286f},
-std::array<float,2>{0.0119164269f, 0.489707857f},
-std::array<float,2>{0.894182563f, 0.632840574f},
-std::array<float,2>{0.74887234f, 0.226950452f},
-std::array<float,2>{0.312093645f, 0.982236147f},
-std::array<float,2>{0.382854104f, 0.0833097324f},
-std::array<float,2>{0.509977043f, 0.819619894f},
-std::array<float,2>{0.861270189f, 0.301718861f},
-std::array<float,2>{0.248632833f, 0.507295251f},
-std::array<float,2>{0.160644189f, 0.130654156f},
-std::array<float,2>{0.804496646f, 0.921219409f},
-std::array<float,2>{0.586518764f, 0.417142749f},
-std::array<float,2>{0.439636558f, 0.716285825f},
-std::array<float,2>{0.365942687f, 0.325835824f},
-std::array<float,2>{0.636994362f, 0.576866627f},
-std::array<float,2>{0.9399032f, 0.000716909417f},
-std::array<float,2>{0.0687869489f, 0.775343239f},
-std::array<float,2>{0.0455488563f, 0.30606842f},
-std::array<float,2>{0.927854598f, 0.51529783f},
-std::array<float,2>{0.696373224f, 0.0936143175f},
-std::array<float,2>{0.270120084f, 0.827027857f},
-std::array<float,2>{0.412264347f, 0.219182506f},
-std::array<float,2>{0.553832471f, 0.976480365f},
-std::array<float,2>{0.818564594f, 0.495847672f},
-std::array<float,2>{0.200352445f, 0.625257492f},
-std::array<float,2>{0.138869241f, 0.00943316519f},
-std::array<float,2>{0.763463557f, 0.765786231f},
-std::array<float,2>{0.59607482f, 0.312601507f},
-std::array<float,2>{0.493735462f, 0.56935364f},
-std::array<float,2>{0.337355852f, 0.411402017f},
-std::array<float,2>{0.686713338f, 0.70843178f},
-std::array<float,2>{0.989413559f, 0.134200931f},
-std::array<float,2>{0.119980402f, 0.907069802f},
-std::array<float,2>{0.237280831f, 0.437886238f},
-std::array<float,2>{0.868164003f, 0.665169954f},
-std::array<float,2>{0.506393254f, 0.217640623f},
-std::array<float,2>{0.375401825f, 0.95164758f},
-std::array<float,2>{0.301374137f, 0.100561917f},
-std::array<float,2>{0.74182868f, 0.862648964f},
-std::array<float,2>{0.901494861f, 0.256541222f},
-std::array<float,2>{0.00605805032f, 0.54921025f},
-std::array<float,2>{0.0764301494f, 0.161636814f},
-std::array<float,2>{0.950237334f, 0.894995511f},
-std::array<float,2>{0.627674997f, 0.40608272f},
-std::array<float,2>{0.368302286f, 0.73309505f},
-std::array<float,2>{0.45229724f, 0.345789373f},
-std::array<float,2>{0.58464396f, 0.620445311f},
-std::array<float,2>{0.808757961f, 0.0438057818f},
-std::array<float,2>{0.168238625f, 0.789790392f},
-std::array<float,2>{0.183619753f, 0.339656949f},
-std::array<float,2>{0.78649801f, 0.583393395f},
-std::array<float,2>{0.575230718f, 0.0255741924f},
-std::array<float,2>{0.459774643f, 0.759226501f},
-std::array<float,2>{0.346005619f, 0.150131315f},
-std::array<float,2>{0.642377615f, 0.925823689f},
-std::array<float,2>{0.96866256f, 0.434806645f},
-std::array<float,2>{0.0902150199f, 0.696334183f},
-std::array<float,2>{0.0204306375f, 0.0662853718f},
-std::array<float,2>{0.882681966f, 0.841029942f},
-std::array<float,2>{0.732408345f, 0.289188743f},
-std::array<float,2>{0.283576518f, 0.523260415f},
-std::array<float,2>{0.390890479f, 0.480589718f},
-std::array<float,2>{0.52916801f, 0.641193986f},
-std::array<float,2>{0.854937434f, 0.244772688f},
-std::array<float,2>{0.230319709f, 0.984422505f},
-std::array<float,2>{0.105301633f, 0.376372486f},
-std::array<float,2>{0.981849611f, 0.749131203f},
-std::array<float,2>{0.665051937f, 0.180788174f},
-std::array<float,2>{0.317873776f, 0.882245362f},
-std::array<float,2>{0.47745806f, 0.0556823127f},
-std::array<float,2>{0.62042284f, 0.804663122f},
-std::array<float,2>{0.770106971f, 0.36037901f},
-std::array<float,2>{0.150419682f, 0.607296407f},
-std::array<float,2>{0.208128095f, 0.191404298f},
-std::array<float,2>{0.830114901f, 0.960870624f},
-std::array<float,2>{0.540672183f, 0.46561861f},
-std::array<float,2>{0.425243258f, 0.678930283f},
-std::array<float,2>{0.263452142f, 0.270093709f},
-std::array<float,2>{0.716348827f, 0.534570098f},
-std::array<float,2>{0.921198845f, 0.117700867f},
-std::array<float,2>{0.0579258986f, 0.85286516f},
-std::array<float,2>{0.0712707713f, 0.285823941f},
-std::array<float,2>{0.945328176f, 0.527000129f},
-std::array<float,2>{0.630677223f, 0.0703653321f},
-std::array<float,2>{0.372352719f, 0.833793163f},
-std::array<float,2>{0.446675062f, 0.235069647f},
-std::array<float,2>{0.579918921f, 0.992745161f},
-std::array<float,2>{0.806269407f, 0.470401883f},
-std::array<float,2>{0.16541633f, 0.655940473f},
-std::array<float,2>{0.241879821f, 0.0188121554f},
-std::array<float,2>{0.871276259f, 0.753233731f},
-std::array<float,2>{0.503668964f, 0.330198139f},
-std::array<float,2>{0.382633179f, 0.586605668f},
-std::array<float,2>{0.298545033f, 0.423622221f},
-std::array<float,2>{0.736813426f, 0.691415966f},
-std::array<float,2>{0.90594238f, 0.143541098f},
-std::array<float,2>{0.00114710443f, 0.93189019f},
-std::array<float,2>{0.133530915f, 0.453469098f},
-std::array<float,2>{0.758473277f, 0.68153286f},
-std::array<float,2>{0.599928617f, 0.195895076f},
-std::array<float,2>{0.49787885f, 0.967239618f},
-std::array<float,2>{0.342886925f, 0.110506348f},
-std::array<float,2>{0.679998338f, 0.844996274f},
-std::array<float,2>{0.987684965f, 0.275780439f},
-std::array<float,2>{0.124403402f, 0.546862543f},
-std::array<float,2>{0.0415885299f, 0.178265601f},
-std::array<float,2>{0.924298346f, 0.88833189f},
-std::array<float,2>{0.699274778f, 0.383913815f},
-std::array<float,2>{0.268177152f, 0.739771545f},
-std::array<float,2>{0.409480304f, 0.372809678f},
-std::array<float,2>{0.548600495f, 0.600084603f},
-std::array<float,2>{0.815385461f, 0.0529002026f},
-std::array<float,2>{0.196949035f, 0.806783617f},
-std::array<float,2>{0.203551427f, 0.321439624f},
-std::array<float,2>{0.832210004f, 0.571241319f},
-std::array<float,2>{0.546071887f, 0.00555093074f},
-std::array<float,2>{0.428974748f, 0.780927539f},
-std::array<float,2>{0.260764599f, 0.125871062f},
-std::array<float,2>{0.711495221f, 0.915696263f},
-std::array<float,2>{0.916386306f, 0.420378268f},
-std::array<float,2>{0.0614211112f, 0.71109271f},
-std::array<float,2>{0.105805717f, 0.0787347481f},
-std::array<float,2>{0.976921201f, 0.813139081f},
-std::array<float,2>{0.668891311f, 0.298163742f},
-std::array<float,2>{0.314507782f, 0.502201021f},
-std::array<float,2>{0.481730402f, 0.486400425f},
-std::array<float,2>{0.622697234f, 0.636746764f},
-std::array<float,2>{0.767807543f, 0.233910128f},
-std::array<float,2>{0.152593315f, 0.980390608f},
-std::array<float,2>{0.0191937983f, 0.398333669f},
-std::array<float,2>{0.878027856f, 0.721861482f},
-std::array<float,2>{0.72940743f, 0.166854754f},
-std::array<float,2>{0.287473589f, 0.903188407f},
-std::array<float,2>{0.396317571f, 0.0316137262f},
-std::array<float,2>{0.52687782f, 0.781484187f},
-std::array<float,2>{0.858155429f, 0.354579031f},
-std::array<float,2>{0.232518911f, 0.61066854f},
-std::array<float,2>{0.181672961f, 0.208528623f},
-std::array<float,2>{0.782854557f, 0.939059973f},
-std::array<float,2>{0.57052654f, 0.44631809f},
-std::array<float,2>{0.454307705f, 0.661240995f},
-std::array<float,2>{0.347681642f, 0.25939694f},
-std::array<float,2>{0.647163391f, 0.558528304f},
-std::array<float,2>{0.962733507f, 0.102464773f},
-std::array<float,2>{0.0890224651f, 0.870193005f},
-std::array<float,2>{0.0498483665f, 0.348084509f},
-std::array<float,2>{0.913983524f, 0.621512771f},
-std::array<float,2>{0.70669955f, 0.0427787676f},
-std::array<float,2>{0.253757626f, 0.794720709f},
-std::array<float,2>{0.432610214f, 0.158949494f},
-std::array<float,2>{0.537162006f, 0.893638313f},
-std::array<float,2>{0.843231082f, 0.402065158f},
-std::array<float,2>{0.217039496f, 0.729620874f},
-std::array<float,2>{0.147713259f, 0.0962249935f},
-std::array<float,2>{0.775543213f, 0.866370738f},
-std::array<float,2>{0.613637626f, 0.253334761f},
-std::array<float,2>{0.475696117f, 0.553514123f},
-std::array<float,2>{0.326494545f, 0.443854392f},
-std::array<float,2>{0.658852935f, 0.668940842f},
-std::array<float,2>{0.974895716f, 0.212616548f},
-std::array<float,2>{0.0959521681f, 0.946263075f},
-std::array<float,2>{0.223099723f, 0.409465313f},
-std::array<float,2>{0.844205379f, 0.703971922f},
-std::array<float,2>{0.516155422f, 0.138941124f},
-std::array<float,2>{0.40053007f, 0.910744488f},
-std::array<float,2>{0.294289172f, 0.0154947806f},
-std::array<float,2>{0.719688654f, 0.769721627f},
-std::array<float,2>{0.884589612f, 0.319331169f},
-std::array<float,2>{0.0279474389f, 0.563072741f},
-std::array<float,2>{0.0809447467f, 0.224910587f},
-std::array<float,2>{0.959022105f, 0.972486913f},
-std::array<float,2>{0.648589611f, 0.499711871f},
-std::array<float,2>{0.351759881f, 0.629629076f},
-std::array<float,2>{0.467484683f, 0.312188745f},
-std::array<float,2>{0.56513226f, 0.509068012f},
-std::array<float,2>{0.793320417f, 0.0876462311f},
-std::array<float,2>{0.175993115f, 0.823134422f},
-std::array<float,2>{0.159281209f, 0.266878158f},
-std::array<float,2>{0.800102293f, 0.537480175f},
-std::array<float,2>{0.592464328f, 0.123904549f},
-std::array<float,2>{0.444912523f, 0.858975053f},
-std::array<float,2>{0.359620333f, 0.191781044f},
-std::array<float,2>{0.633452356f, 0.954946578f},
-std::array<float,2>{0.941438735f, 0.461502761f},
-std::array<float,2>{0.0639522895f, 0.674794197f},
-std::array<float,2>{0.00977744441f, 0.059944842f},
-std::array<float,2>{0.895089865f, 0.79836458f},
-std::array<float,2>{0.74350518f, 0.364044726f},
-std::array<float,2>{0.307189912f, 0.60537523f},
-std::array<float,2>{0.387732357f, 0.382209182f},
-std::array<float,2>{0.512521744f, 0.743817091f},
-std::array<float,2>{0.864665806f, 0.183948562f},
-std::array<float,2>{0.242720112f, 0.876479864f},
-std::array<float,2>{0.114077933f, 0.478854269f},
-std::array<float,2>{0.99707979f, 0.647684336f},
-std::array<float,2>{0.678715229f, 0.248740152f},
-std::array<float,2>{0.329731911f, 0.990801215f},
-std::array<float,2>{0.487499475f, 0.0692024454f},
-std::array<float,2>{0.604323328f, 0.836561084f},
-std::array<float,2>{0.752368152f, 0.295157611f},
-std::array<float,2>{0.131089941f, 0.516338885f},
-std::array<float,2>{0.194984764f, 0.155552715f},
-std::array<float,2>{0.823706627f, 0.924610138f},
-std::array<float,2>{0.558569491f, 0.431702018f},
-std::array<float,2>{0.415610731f, 0.700732708f},
-std::array<float,2>{0.279562145f, 0.34085691f},
-std::array<float,2>{0.690079868f, 0.581262946f},
-std::array<float,2>{0.936414599f, 0.0291242301f},
-std::array<float,2>{0.0387884676f, 0.762804091f},
-std::array<float,2>{0.100938715f, 0.33494544f},
-std::array<float,2>{0.969836414f, 0.593745291f},
-std::array<float,2>{0.662162244f, 0.0214800946f},
-std::array<float,2>{0.322974056f, 0.757775486f},
-std::array<float,2>{0.471617997f, 0.144682214f},
-std::array<float,2>{0.612679839f, 0.936608493f},
-std::array<float,2>{0.778629899f, 0.426714063f},
-std::array<float,2>{0.140662566f, 0.690419316f},
-std::array<float,2>{0.213437572f, 0.0753792077f},
-std::array<float,2>{0.836093187f, 0.830824077f},
-std::array<float,2>{0.532612026f, 0.282500029f},
-std::array<float,2>{0.436938763f, 0.527992249f},
-std::array<float,2>{0.255375385f, 0.474433213f},
-std::array<float,2>{0.710142136f, 0.651480138f},
-std::array<float,2>{0.909850121f, 0.241061032f},
-std::array<float,2>{0.0517340191f, 0.999267399f},
-std::array<float,2>{0.172709554f, 0.389532983f},
-std::array<float,2>{0.792424679f, 0.735652328f},
-std::array<float,2>{0.567999303f, 0.175038323f},
-std::array<float,2>{0.462216318f, 0.885737538f},
-std::array<float,2>{0.357216567f, 0.0477037989f},
-std::array<float,2>{0.656227946f, 0.810473859f},
-std::array<float,2>{0.955303609f, 0.368803024f},
-std::array<float,2>{0.0831812993f, 0.594064653f},
-std::array<float,2>{0.0254191421f, 0.200057462f},
-std::array<float,2>{0.889711082f, 0.963222325f},
-std::array<float,2>{0.723356962f, 0.458493352f},
-std::array<float,2>{0.292111188f, 0.686954618f},
-std::array<float,2>{0.405299306f, 0.278984576f},
-std::array<float,2>{0.520828843f, 0.539645374f},
-std::array<float,2>{0.848357379f, 0.11593248f},
-std::array<float,2>{0.220074132f, 0.851550043f},
-std::array<float,2>{0.246993542f, 0.303152829f},
-std::array<float,2>{0.862162769f, 0.504718542f},
-std::array<float,2>{0.509483159f, 0.0855709538f},
-std::array<float,2>{0.384976417f, 0.816917777f},
-std::array<float,2>{0.310489416f, 0.228978708f},
-std::array<float,2>{0.746779025f, 0.982689381f},
-std::array<float,2>{0.890858293f, 0.491201103f},
-std::array<float,2>{0.0149669647f, 0.636610925f},
-std::array<float,2>{0.0677609369f, 0.00343365688f},
-std::array<float,2>{0.937742651f, 0.77654916f},
-std::array<float,2>{0.640227795f, 0.328102112f},
-std::array<float,2>{0.364783764f, 0.575190604f},
-std::array<float,2>{0.438126624f, 0.415917993f},
-std::array<float,2>{0.588810921f, 0.717147231f},
-std::array<float,2>{0.802252233f, 0.13186729f},
-std::array<float,2>{0.163138419f, 0.9196105f},
-std::array<float,2>{0.0345564336f, 0.450752169f},
-std::array<float,2>{0.931681812f, 0.656527758f},
-std::array<float,2>{0.691672206f, 0.2051588f},
-std::array<float,2>{0.276029557f, 0.943845749f},
-std::array<float,2>{0.421614498f, 0.10687501f},
-std::array<float,2>{0.559496164f, 0.874337912f},
-std::array<float,2>{0.825104535f, 0.264775813f},
-std::array<float,2>{0.191032156f, 0.561537147f},
-std::array<float,2>{0.128597826f, 0.169919699f},
-std::array<float,2>{0.755451262f, 0.902193367f},
-std::array<float,2>{0.606327713f, 0.392101824f},
-std::array<float,2>{0.490428597f, 0.726185024f},
-std::array<float,2>{0.332466722f, 0.35691613f},
-std::array<float,2>{0.673611641f, 0.615050673f},
-std::array<float,2>{0.992874086f, 0.0361653566f},
-std::array<float,2>{0.112740286f, 0.787922382f},
-std::array<float,2>{0.00430018315f, 0.254466504f},
-std::array<float,2>{0.89964509f, 0.548331618f},
-std::array<float,2>{0.738657951f, 0.0991595387f},
-std::array<float,2>{0.303317159f, 0.85941273f},
-std::array<float,2>{0.378275663f, 0.214925483f},
-std::array<float,2>{0.504255533f, 0.950812221f},
-std::array<float,2>{0.870889127f, 0.4395639f},
-std::array<float,2>{0.235901982f, 0.666253328f},
-std::array<float,2>{0.170434758f, 0.0468163788f},
-std::array<float,2>{0.810982585f, 0.7919572f},
-std::array<float,2>{0.583521187f, 0.344925106f},
-std::array<float,2>{0.449696332f, 0.618953645f},
-std::array<float,2>{0.369493216f, 0.402468711f},
-std::array<float,2>{0.625357747f, 0.732197583f},
-std::array<float,2>{0.952458262f, 0.162722707f},
-std::array<float,2>{0.0748636499f, 0.898130834f},
-std::array<float,2>{0.202758327f, 0.493571401f},
-std::array<float,2>{0.816771686f, 0.628694773f},
-std::array<float,2>{0.552689075f, 0.221700877f},
-std::array<float,2>{0.411263496f, 0.973571837f},
-std::array<float,2>{0.271511763f, 0.0910678804f},
-std::array<float,2>{0.698177934f, 0.824394047f},
-std::array<float,2>{0.927200437f, 0.306872576f},
-std::array<float,2>{0.0441100411f, 0.513495147f},
-std::array<float,2>{0.11913947f, 0.135886595f},
-std::array<float,2>{0.990517259f, 0.908410847f},
-std::array<float,2>{0.685213029f, 0.412816226f},
-std::array<float,2>{0.338801831f, 0.710205495f},
-std::array<float,2>{0.494170636f, 0.315353304f},
-std::array<float,2>{0.593787789f, 0.568267584f},
-std::array<float,2>{0.765420735f, 0.0106754918f},
-std::array<float,2>{0.138147667f, 0.767793477f},
-std::array<float,2>{0.149908379f, 0.362972021f},
-std::array<float,2>{0.773190618f, 0.607465923f},
-std::array<float,2>{0.618831575f, 0.0582428314f},
-std::array<float,2>{0.480360657f, 0.802354574f},
-std::array<float,2>{0.319175601f, 0.183160067f},
-std::array<float,2>{0.666194499f, 0.880156696f},
-std::array<float,2>{0.983659625f, 0.37810874f},
-std::array<float,2>{0.102037832f, 0.747240484f},
-std::array<float,2>{0.0565031618f, 0.11976435f},
-std::array<float,2>{0.919728041f, 0.854236603f},
-std::array<float,2>{0.718419015f, 0.273239762f},
-std::array<float,2>{0.265429437f, 0.532682836f},
-std::array<float,2>{0.423442423f, 0.467346907f},
-std::array<float,2>{0.541490853f, 0.67700249f},
-std::array<float,2>{0.829628944f, 0.188423827f},
-std::array<float,2>{0.209919304f, 0.958452344f},
-std::array<float,2>{0.0927603394f, 0.436770201f},
-std::array<float,2>{0.964914322f, 0.698489726f},
-std::array<float,2>{0.643081784f, 0.150754645f},
-std::array<float,2>{0.344027698f, 0.929208696f},
-std::array<float,2>{0.458306819f, 0.0248685759f},
-std::array<float,2>{0.576180696f, 0.760390341f},
-std::array<float,2>{0.788130879f, 0.336904615f},
-std::array<float,2>{0.187226325f, 0.584338605f},
-std::array<float,2>{0.2273871f, 0.242555782f},
-std::array<float,2>{0.852408826f, 0.987117946f},
-std::array<float,2>{0.529529393f, 0.482783467f},
-std::array<float,2>{0.392846435f, 0.643219709f},
-std::array<float,2>{0.281618208f, 0.292681456f},
-std::array<float,2>{0.734165072f, 0.519846439f},
-std::array<float,2>{0.880310953f, 0.062791124f},
-std::array<float,2>{0.0222813133f, 0.842152238f},
-std::array<float,2>{0.115464889f, 0.295614064f},
-std::array<float,2>{0.998193681f, 0.515693784f},
-std::array<float,2>{0.677092314f, 0.0687189847f},
-std::array<float,2>{0.331219256f, 0.836245f},
-std::array<float,2>{0.485093266f, 0.248163149f},
-std::array<float,2>{0.60301888f, 0.990346491f},
-std::array<float,2>{0.751173317f, 0.4791812f},
-std::array<float,2>{0.129073396f, 0.648433506f},
-std::array<float,2>{0.191852644f, 0.0287481286f},
-std::array<float,2>{0.822028995f, 0.763350606f},
-std::array<float,2>{0.556041121f, 0.34175837f},
-std::array<float,2>{0.417696178f, 0.5819785f},
-std::array<float,2>{0.277423501f, 0.432322025f},
-std::array<float,2>{0.687637508f, 0.700575769f},
-std::array<float,2>{0.935507059f, 0.156225011f},
-std::array<float,2>{0.0355332419f, 0.924253047f},
-std::array<float,2>{0.157432675f, 0.461141735f},
-std::array<float,2>{0.798269331f, 0.67383194f},
-std::array<float,2>{0.590174735f, 0.192181915f},
-std::array<float,2>{0.44281131f, 0.954205275f},
-std::array<float,2>{0.362787724f, 0.123282328f},
-std::array<float,2>{0.636391222f, 0.858833909f},
-std::array<float,2>{0.943946481f, 0.267545372f},
-std::array<float,2>{0.0658638179f, 0.53791666f},
-std::array<float,2>{0.00922911428f, 0.184365362f},
-std::array<float,2>{0.897938728f, 0.876082659f},
-std::array<float,2>{0.74522078f, 0.382404149f},
-std::array<float,2>{0.305748373f, 0.743489444f},
-std::array<float,2>{0.390172631f, 0.363607496f},
-std::array<float,2>{0.514756382f, 0.604873657f},
-std::array<float,2>{0.866092443f, 0.0603353418f},
-std::array<float,2>{0.245463014f, 0.798157156f},
-std::array<float,2>{0.226030871f, 0.318653643f},
-std::array<float,2>{0.847351313f, 0.56259954f},
-std::array<float,2>{0.518286943f, 0.0147258919f},
-std::array<float,2>{0.400299072f, 0.770477712f},
-std::array<float,2>{0.296393245f, 0.139294192f},
-std::array<float,2>{0.721097946f, 0.910542905f},
-std::array<float,2>{0.886313856f, 0.41008085f},
-std::array<float,2>{0.0301878955f, 0.703607261f},
-std::array<float,2>{0.0789463446f, 0.087365739f},
-std::array<float,2>{0.958240151f, 0.822708189f},
-std::array<float,2>{0.652169347f, 0.311971277f},
-std::array<float,2>{0.354133844f, 0.509585857f},
-std::array<float,2>{0.465976834f, 0.499291033f},
-std::array<float,2>{0.562548339f, 0.628907263f},
-std::array<float,2>{0.796808541f, 0.225099891f},
-std::array<float,2>{0.178745046f, 0.971775949f},
-std::array<float,2>{0.0469190255f, 0.401833266f},
-std::array<float,2>{0.91055733f, 0.730190516f},
-std::array<float,2>{0.704308033f, 0.158415735f},
-std::array<float,2>{0.250155896f, 0.894459903f},
-std::array<float,2>{0.431178719f, 0.0420947708f},
-std::array<float,2>{0.535990834f, 0.794097066f},
-std::array<float,2>{0.840560913f, 0.348292142f},
-std::array<float,2>{0.215335026f, 0.621648848f},
-std::array<float,2>{0.146163657f, 0.212076649f},
-std::array<float,2>{0.775150299f, 0.945438147f},
-std::array<float,2>{0.617153585f, 0.443579942f},
-std::array<float,2>{0.474514276f, 0.667994082f},
-std::array<float,2>{0.324364632f, 0.253512979f},
-std::array<float,2>{0.657289684f, 0.552819312f},
-std::array<float,2>{0.973415375f, 0.0961829498f},
-std::array<float,2>{0.0944045633f, 0.867165446f},
-std::array<float,2>{0.0164369363f, 0.35539189f},
-std::array<float,2>{0.875795782f, 0.611048222f},
-std::array<float,2>{0.727529109f, 0.0321355015f},
-std::array<float,2>{0.286464334f, 0.7820701f},
-std::array<float,2>{0.396877587f, 0.166415304f},
-std::array<float,2>{0.523562968f, 0.902567148f},
-std::array<float,2>{0.855819404f, 0.39770934f},
-std::array<float,2>{0.231677458f, 0.722603142f},
-std::array<float,2>{0.181520641f, 0.101880781f},
-std::array<float,2>{0.784020782f, 0.87077868f},
-std::array<float,2>{0.572734177f, 0.259174198f},
-std::array<float,2>{0.456311107f, 0.557863951f},
-std::array<float,2>{0.349743903f, 0.44710201f},
-std::array<float,2>{0.645168602f, 0.661777675f},
-std::array<float,2>{0.96396333f, 0.208441406f},
-std::array<float,2>{0.0877969861f, 0.938517749f},
-std::array<float,2>{0.206351057f, 0.420477927f},
-std::array<float,2>{0.835398614f, 0.711596131f},
-std::array<float,2>{0.54412663f, 0.125036955f},
-std::array<float,2>{0.425839573f, 0.915471911f},
-std::array<float,2>{0.259441108f, 0.00535627361f},
-std::array<float,2>{0.713443696f, 0.780464709f},
-std::array<float,2>{0.915490031f, 0.322265148f},
-std::array<float,2>{0.0589300916f, 0.570719719f},
-std::array<float,2>{0.108879492f, 0.233693898f},
-std::array<float,2>{0.980339289f, 0.97952503f},
-std::array<float,2>{0.671107292f, 0.487184167f},
-std::array<float,2>{0.312636703f, 0.637642682f},
-std::array<float,2>{0.482757926f, 0.298485845f},
-std::array<float,2>{0.624862432f, 0.502840936f},
-std::array<float,2>{0.767059863f, 0.078324452f},
-std::array<float,2>{0.155759662f, 0.812775791f},
-std::array<float,2>{0.135963544f, 0.276314974f},
-std::array<float,2>{0.759928107f, 0.546358347f},
-std::array<float,2>{0.599566519f, 0.111256368f},
-std::array<float,2>{0.498272985f, 0.845394909f},
-std::array<float,2>{0.340106845f, 0.195632309f},
-std::array<float,2>{0.682997167f, 0.967384636f},
-std::array<float,2>{0.984790504f, 0.453656644f},
-std::array<float,2>{0.12121141f, 0.68091625f},
-std::array<float,2>{0.0398929119f, 0.0533188023f},
-std::array<float,2>{0.922001839f, 0.807186961f},
-std::array<float,2>{0.702253103f, 0.372281134f},
-std::array<float,2>{0.267467678f, 0.600203395f},
-std::array<float,2>{0.407705992f, 0.384727389f},
-std::array<float,2>{0.550472021f, 0.739401937f},
-std::array<float,2>{0.813183665f, 0.177888647f},
-std::array<float,2>{0.198813111f, 0.887919247f},
-std::array<float,2>{0.0739446729f, 0.469822884f},
-std::array<float,2>{0.948082507f, 0.655535758f},
-std::array<float,2>{0.63100785f, 0.234839037f},
-std::array<float,2>{0.374345988f, 0.992312014f},
-std::array<float,2>{0.448022306f, 0.0708617866f},
-std::array<float,2>{0.581119418f, 0.833274782f},
-std::array<float,2>{0.808230698f, 0.28532061f},
-std::array<float,2>{0.166311979f, 0.526596725f},
-std::array<float,2>{0.239410773f, 0.142719746f},
-std::array<float,2>{0.873806119f, 0.932315826f},
-std::array<float,2>{0.500854969f, 0.423303515f},
-std::array<float,2>{0.380656153f, 0.692063451f},
-std::array<float,2>{0.300398558f, 0.330973506f},
-std::array<float,2>{0.735635459f, 0.585965812f},
-std::array<float,2>{0.903497338f, 0.0191945005f},
-std::array<float,2>{0.00361810252f, 0.753687501f},
-std::array<float,2>{0.0903742611f, 0.336213827f},
-std::array<float,2>{0.968025863f, 0.584598482f},
-std::array<float,2>{0.641784847f, 0.0251119882f},
-std::array<float,2>{0.346384257f, 0.759822071f},
-std::array<float,2>{0.459099531f, 0.151233524f},
-std::array<float,2>{0.575775862f, 0.928737521f},
-std::array<float,2>{0.78685683f, 0.437340021f},
-std::array<float,2>{0.184136048f, 0.69920516f},
-std::array<float,2>{0.229934186f, 0.063463442f},
-std::array<float,2>{0.85509038f, 0.842762828f},
-std::array<float,2>{0.528437853f, 0.292474627f},
-std::array<float,2>{0.391558051f, 0.520500541f},
-std::array<float,2>{0.283954173f, 0.483141929f},
-std::array<float,2>{0.731833637f, 0.642839491f},
-std::array<float,2>{0.882275045f, 0.243157908f},
-std::array<float,2>{0.0199597403f, 0.986758292f},
-std::array<float,2>{0.151106641f, 0.37861523f},
-std::array<float,2>{0.769705296f, 0.747786164f},
-std::array<float,2>{0.620606422f, 0.183037996f},
-std::array<float,2>{0.476883531f, 0.880569637f},
-std::array<float,2>{0.317660451f, 0.0579847284f},
-std::array<float,2>{0.665686429f, 0.80221355f},
-std::array<float,2>{0.982144237f, 0.362782776f},
-std::array<float,2>{0.104799367f, 0.608087599f},
-std::array<float,2>{0.0585347228f, 0.187697947f},
-std::array<float,2>{0.921471119f, 0.958947718f},
-std::array<float,2>{0.716277421f, 0.467181206f},
-std::array<float,2>{0.263151735f, 0.677386463f},
-std::array<float,2>{0.42561999f, 0.272842467f},
-std::array<float,2>{0.540337145f, 0.532912672f},
-std::array<float,2>{0.830947876f, 0.11924611f},
-std::array<float,2>{0.208659336f, 0.853749931f},
-std::array<float,2>{0.200743198f, 0.307212353f},
-std::array<float,2>{0.819266021f, 0.513117075f},
-std::array<float,2>{0.55444175f, 0.0915178582f},
-std::array<float,2>{0.412981391f, 0.824830234f},
-std::array<float,2>{0.269723475f, 0.222349167f},
-std::array<float,2>{0.696906447f, 0.972911835f},
-std::array<float,2>{0.928450525f, 0.493894815f},
-std::array<float,2>{0.0451075658f, 0.62794745f},
-std::array<float,2>{0.119214848f, 0.00982582662f},
-std::array<float,2>{0.990188956f, 0.768293798f},
-std::array<float,2>{0.687193096f, 0.314913511f},
-std::array<float,2>{0.337766439f, 0.56754452f},
-std::array<float,2>{0.493373871f, 0.412248492f},
-std::array<float,2>{0.596415877f, 0.710505962f},
-std::array<float,2>{0.762755096f, 0.136414617f},
-std::array<float,2>{0.139389634f, 0.909111023f},
-std::array<float,2>{0.00641001156f, 0.439996064f},
-std::array<float,2>{0.901921749f, 0.666542232f},
-std::array<float,2>{0.741251051f, 0.215533629f},
-std::array<float,2>{0.301228106f, 0.950526834f},
-std::array<float,2>{0.375843108f, 0.0986728072f},
-std::array<float,2>{0.505859613f, 0.859917521f},
-std::array<float,2>{0.867201746f, 0.254075855f},
-std::array<float,2>{0.236431673f, 0.548823237f},
-std::array<float,2>{0.168660283f, 0.162230387f},
-std::array<float,2>{0.809423864f, 0.897680521f},
-std::array<float,2>{0.584236801f, 0.402995914f},
-std::array<float,2>{0.452651978f, 0.731607258f},
-std::array<float,2>{0.368836641f, 0.345357537f},
-std::array<float,2>{0.627164304f, 0.618472815f},
-std::array<float,2>{0.950933456f, 0.0459106416f},
-std::array<float,2>{0.0766838193f, 0.791255116f},
-std::array<float,2>{0.0323970169f, 0.265138566f},
-std::array<float,2>{0.929892242f, 0.562471628f},
-std::array<float,2>{0.694338262f, 0.107385337f},
-std::array<float,2>{0.273896217f, 0.874886215f},
-std::array<float,2>{0.418402553f, 0.20592913f},
-std::array<float,2>{0.562476337f, 0.943916798f},
-std::array<float,2>{0.826574147f, 0.450377196f},
-std::array<float,2>{0.189416215f, 0.656856537f},
-std::array<float,2>{0.126413018f, 0.0367157273f},
-std::array<float,2>{0.75666678f, 0.787513673f},
-std::array<float,2>{0.608859777f, 0.356958747f},
-std::array<float,2>{0.488340557f, 0.614405572f},
-std::array<float,2>{0.33571139f, 0.391838163f},
-std::array<float,2>{0.67432183f, 0.72589916f},
-std::array<float,2>{0.995846093f, 0.169210374f},
-std::array<float,2>{0.109566763f, 0.901756525f},
-std::array<float,2>{0.248100251f, 0.490433812f},
-std::array<float,2>{0.860533893f, 0.636116028f},
-std::array<float,2>{0.510402441f, 0.229391024f},
-std::array<float,2>{0.383399755f, 0.983358681f},
-std::array<float,2>{0.31191197f, 0.085386999f},
-std::array<float,2>{0.748440623f, 0.816632569f},
-std::array<float,2>{0.893983543f, 0.303643137f},
-std::array<float,2>{0.0126178497f, 0.504377425f},
-std::array<float,2>{0.0689231008f, 0.132387027f},
-std::array<float,2>{0.939941645f, 0.919064045f},
-std::array<float,2>{0.637657523f, 0.41547823f},
-std::array<float,2>{0.365422279f, 0.717593133f},
-std::array<float,2>{0.439967304f, 0.327414393f},
-std::array<float,2>{0.585941136f, 0.574546158f},
-std::array<float,2>{0.804146886f, 0.00324073131f},
-std::array<float,2>{0.160893857f, 0.77708137f},
-std::array<float,2>{0.175277039f, 0.368377417f},
-std::array<float,2>{0.79056257f, 0.594387531f},
-std::array<float,2>{0.569567442f, 0.0472262688f},
-std::array<float,2>{0.463353455f, 0.809798002f},
-std::array<float,2>{0.357765257f, 0.17536889f},
-std::array<float,2>{0.652478218f, 0.884826899f},
-std::array<float,2>{0.953977346f, 0.389040738f},
-std::array<float,2>{0.0851362795f, 0.735966086f},
-std::array<float,2>{0.0246241186f, 0.115437724f},
-std::array<float,2>{0.887943327f, 0.850949228f},
-std::array<float,2>{0.72576791f, 0.278337926f},
-std::array<float,2>{0.289882749f, 0.539430439f},
-std::array<float,2>{0.403396666f, 0.458808601f},
-std::array<float,2>{0.522722244f, 0.687107205f},
-std::array<float,2>{0.850600719f, 0.199534938f},
-std::array<float,2>{0.221323282f, 0.963380575f},
-std::array<float,2>{0.0983988196f, 0.426043361f},
-std::array<float,2>{0.972611845f, 0.689492881f},
-std::array<float,2>{0.661487877f, 0.145171225f},
-std::array<float,2>{0.321923852f, 0.937208056f},
-std::array<float,2>{0.470510125f, 0.0209249854f},
-std::array<float,2>{0.609795153f, 0.75731796f},
-std::array<float,2>{0.780293107f, 0.334243536f},
-std::array<float,2>{0.144179478f, 0.592885911f},
-std::array<float,2>{0.211055413f, 0.240394741f},
-std::array<float,2>{0.838321507f, 0.999632418f},
-std::array<float,2>{0.534123719f, 0.473721087f},
-std::array<float,2>{0.434057415f, 0.652011812f},
-std::array<float,2>{0.25739187f, 0.282762855f},
-std::array<float,2>{0.708320677f, 0.52773118f},
-std::array<float,2>{0.90800494f, 0.0759284273f},
-std::array<float,2>{0.0545484573f, 0.830400467f},
-std::array<float,2>{0.0639870018f, 0.268426269f},
-std::array<float,2>{0.942308068f, 0.536579311f},
-std::array<float,2>{0.633119583f, 0.121596754f},
-std::array<float,2>{0.359898686f, 0.85713321f},
-std::array<float,2>{0.444593728f, 0.19486545f},
-std::array<float,2>{0.592135906f, 0.956407607f},
-std::array<float,2>{0.800549567f, 0.463047028f},
-std::array<float,2>{0.159885734f, 0.672830224f},
-std::array<float,2>{0.242432654f, 0.0606427714f},
-std::array<float,2>{0.865180671f, 0.800642669f},
-std::array<float,2>{0.512085378f, 0.365627855f},
-std::array<float,2>{0.388552934f, 0.601686478f},
-std::array<float,2>{0.306732267f, 0.378966987f},
-std::array<float,2>{0.743724287f, 0.744365633f},
-std::array<float,2>{0.894772232f, 0.187397182f},
-std::array<float,2>{0.0105727958f, 0.877301157f},
-std::array<float,2>{0.131754681f, 0.478292316f},
-std::array<float,2>{0.752620339f, 0.645209372f},
-std::array<float,2>{0.60376972f, 0.24701117f},
-std::array<float,2>{0.488116831f, 0.988517284f},
-std::array<float,2>{0.329234749f, 0.0665904135f},
-std::array<float,2>{0.67963016f, 0.83845067f},
-std::array<float,2>{0.997561753f, 0.293141514f},
-std::array<float,2>{0.113517605f, 0.517976403f},
-std::array<float,2>{0.0384095237f, 0.153555661f},
-std::array<float,2>{0.935719788f, 0.922479153f},
-std::array<float,2>{0.689761639f, 0.429812729f},
-std::array<float,2>{0.280222625f, 0.703004599f},
-std::array<float,2>{0.415524811f, 0.343530536f},
-std::array<float,2>{0.558034539f, 0.578420222f},
-std::array<float,2>{0.823882937f, 0.0307260305f},
-std::array<float,2>{0.194562882f, 0.765536368f},
-std::array<float,2>{0.217479676f, 0.35021165f},
-std::array<float,2>{0.843450665f, 0.624986172f},
-std::array<float,2>{0.537964284f, 0.0409133174f},
-std::array<float,2>{0.431976467f, 0.796801627f},
-std::array<float,2>{0.253322631f, 0.156284511f},
-std::array<float,2>{0.706275463f, 0.892077684f},
-std::array<float,2>{0.913181424f, 0.400009096f},
-std::array<float,2>{0.0504160933f, 0.727324367f},
-std::array<float,2>{0.0965428129f, 0.0950300768f},
-std::array<float,2>{0.975530744f, 0.864567816f},
-std::array<float,2>{0.658384681f, 0.250533074f},
-std::array<float,2>{0.326896846f, 0.551909804f},
-std::array<float,2>{0.47651425f, 0.441655427f},
-std::array<float,2>{0.613798678f, 0.67096287f},
-std::array<float,2>{0.775924444f, 0.214669585f},
-std::array<float,2>{0.148288578f, 0.948241115f},
-std::array<float,2>{0.0278299171f, 0.408071518f},
-std::array<float,2>{0.883944333f, 0.705784738f},
-std::array<float,2>{0.718860626f, 0.137189016f},
-std::array<float,2>{0.294457138f, 0.912178993f},
-std::array<float,2>{0.400927752f, 0.0134041691f},
-std::array<float,2>{0.516070008f, 0.772116661f},
-std::array<float,2>{0.844570637f, 0.317073226f},
-std::array<float,2>{0.223402664f, 0.565442026f},
-std::array<float,2>{0.176547527f, 0.222995937f},
-std::array<float,2>{0.793880641f, 0.969743788f},
-std::array<float,2>{0.564934731f, 0.497453749f},
-std::array<float,2>{0.466997266f, 0.631869912f},
-std::array<float,2>{0.352350533f, 0.309614331f},
-std::array<float,2>{0.649055302f, 0.511683404f},
-std::array<float,2>{0.959539533f, 0.0886765048f},
-std::array<float,2>{0.0802823976f, 0.82183969f},
-std::array<float,2>{0.0608979762f, 0.323358417f},
-std::array<float,2>{0.916602254f, 0.572500348f},
-std::array<float,2>{0.711379945f, 0.00762644131f},
-std::array<float,2>{0.261342645f, 0.777563512f},
-std::array<float,2>{0.429265916f, 0.127786666f},
-std::array<float,2>{0.546547711f, 0.916052461f},
-std::array<float,2>{0.83268398f, 0.419590086f},
-std::array<float,2>{0.203842968f, 0.713046968f},
-std::array<float,2>{0.153230488f, 0.0818776712f},
-std::array<float,2>{0.768122792f, 0.81640172f},
-std::array<float,2>{0.622255683f, 0.300191253f},
-std::array<float,2>{0.482277215f, 0.500633121f},
-std::array<float,2>{0.315180361f, 0.486114562f},
-std::array<float,2>{0.668423831f, 0.640411079f},
-std::array<float,2>{0.977235317f, 0.231494531f},
-std::array<float,2>{0.106016897f, 0.977241576f},
-std::array<float,2>{0.23318772f, 0.395102262f},
-std::array<float,2>{0.857677042f, 0.719568729f},
-std::array<float,2>{0.526475608f, 0.164088488f},
-std::array<float,2>{0.395786136f, 0.90434891f},
-std::array<float,2>{0.28765592f, 0.0348228998f},
-std::array<float,2>{0.728571832f, 0.783572137f},
-std::array<float,2>{0.878663599f, 0.352987468f},
-std::array<float,2>{0.0189068411f, 0.612959325f},
-std::array<float,2>{0.0896433294f, 0.210178301f},
-std::array<float,2>{0.961951852f, 0.940337718f},
-std::array<float,2>{0.646514416f, 0.447339773f},
-std::array<float,2>{0.348240107f, 0.662750125f},
-std::array<float,2>{0.455062687f, 0.259964764f},
-std::array<float,2>{0.570889235f, 0.556232572f},
-std::array<float,2>{0.782378197f, 0.103875279f},
-std::array<float,2>{0.18243897f, 0.867882669f},
-std::array<float,2>{0.165647238f, 0.287672579f},
-std::array<float,2>{0.805794537f, 0.524720907f},
-std::array<float,2>{0.579156935f, 0.0723365694f},
-std::array<float,2>{0.446914107f, 0.834469914f},
-std::array<float,2>{0.372597635f, 0.236806244f},
-std::array<float,2>{0.62996453f, 0.995117188f},
-std::array<float,2>{0.945964038f, 0.472303957f},
-std::array<float,2>{0.0707157552f, 0.65259552f},
-std::array<float,2>{0.00187683117f, 0.016595453f},
-std::array<float,2>{0.905611336f, 0.751844227f},
-std::array<float,2>{0.736833572f, 0.328327626f},
-std::array<float,2>{0.297885001f, 0.588484466f},
-std::array<float,2>{0.382033527f, 0.424155235f},
-std::array<float,2>{0.503014147f, 0.693834126f},
-std::array<float,2>{0.871903241f, 0.142067015f},
-std::array<float,2>{0.24165079f, 0.929812729f},
-std::array<float,2>{0.124678351f, 0.455992997f},
-std::array<float,2>{0.98792088f, 0.681763172f},
-std::array<float,2>{0.680278301f, 0.197533086f},
-std::array<float,2>{0.343372196f, 0.965039313f},
-std::array<float,2>{0.497111112f, 0.112360157f},
-std::array<float,2>{0.600577533f, 0.847596407f},
-std::array<float,2>{0.757970452f, 0.274234325f},
-std::array<float,2>{0.13323614f, 0.543819904f},
-std::array<float,2>{0.196355164f, 0.1762712f},
-std::array<float,2>{0.814571619f, 0.888748884f},
-std::array<float,2>{0.548076928f, 0.386077374f},
-std::array<float,2>{0.409977555f, 0.740895092f},
-std::array<float,2>{0.267691135f, 0.373328388f},
-std::array<float,2>{0.700166881f, 0.598763108f},
-std::array<float,2>{0.924420536f, 0.0511670448f},
-std::array<float,2>{0.041080527f, 0.804978132f},
-std::array<float,2>{0.102307595f, 0.361128777f},
-std::array<float,2>{0.983973265f, 0.606790721f},
-std::array<float,2>{0.666686594f, 0.0563257076f},
-std::array<float,2>{0.318459988f, 0.803725064f},
-std::array<float,2>{0.479536623f, 0.181196243f},
-std::array<float,2>{0.618489385f, 0.882729232f},
-std::array<float,2>{0.772621512f, 0.37655583f},
-std::array<float,2>{0.149653479f, 0.749997497f},
-std::array<float,2>{0.209376752f, 0.117604129f},
-std::array<float,2>{0.829310477f, 0.853161454f},
-std::array<float,2>{0.54170543f, 0.269721717f},
-std::array<float,2>{0.423117101f, 0.534742236f},
-std::array<float,2>{0.265034348f, 0.465183854f},
-std::array<float,2>{0.717840254f, 0.679586768f},
-std::array<float,2>{0.918963134f, 0.190662265f},
-std::array<float,2>{0.0557122231f, 0.960285962f},
-std::array<float,2>{0.186698496f, 0.435505241f},
-std::array<float,2>{0.788893878f, 0.697116971f},
-std::array<float,2>{0.577142477f, 0.149602175f},
-std::array<float,2>{0.458650827f, 0.926273942f},
-std::array<float,2>{0.344689071f, 0.0258889887f},
-std::array<float,2>{0.642687201f, 0.759366453f},
-std::array<float,2>{0.965403974f, 0.338876098f},
-std::array<float,2>{0.0922120512f, 0.583838522f},
-std::array<float,2>{0.021842327f, 0.244440287f},
-std::array<float,2>{0.880718112f, 0.985025823f},
-std::array<float,2>{0.733542204f, 0.481228292f},
-std::array<float,2>{0.28177166f, 0.640726268f},
-std::array<float,2>{0.393325299f, 0.289792359f},
-std::array<float,2>{0.530218661f, 0.522596359f},
-std::array<float,2>{0.851833224f, 0.0657579452f},
-std::array<float,2>{0.226605475f, 0.841418684f},
-std::array<float,2>{0.235424668f, 0.256282806f},
-std::array<float,2>{0.870302975f, 0.549668014f},
-std::array<float,2>{0.504494429f, 0.0997909904f},
-std::array<float,2>{0.378679186f, 0.863014936f},
-std::array<float,2>{0.302911848f, 0.217185661f},
-std::array<float,2>{0.739014208f, 0.951703668f},
-std::array<float,2>{0.900228918f, 0.438246489f},
-std::array<float,2>{0.00473744376f, 0.665935159f},
-std::array<float,2>{0.074341692f, 0.0430734791f},
-std::array<float,2>{0.953030586f, 0.789410889f},
-std::array<float,2>{0.625573754f, 0.346254021f},
-std::array<float,2>{0.369685292f, 0.620962501f},
-std::array<float,2>{0.449772298f, 0.40556863f},
-std::array<float,2>{0.583113968f, 0.732679486f},
-std::array<float,2>{0.811443985f, 0.161374584f},
-std::array<float,2>{0.170154929f, 0.895277441f},
-std::array<float,2>{0.0444729887f, 0.495237887f},
-std::array<float,2>{0.927574337f, 0.625614583f},
-std::array<float,2>{0.697357476f, 0.219280615f},
-std::array<float,2>{0.272117704f, 0.975766242f},
-std::array<float,2>{0.412099123f, 0.0929613784f},
-std::array<float,2>{0.551962376f, 0.826425731f},
-std::array<float,2>{0.817275822f, 0.30663532f},
-std::array<float,2>{0.202310324f, 0.514667273f},
-std::array<float,2>{0.138427526f, 0.134404287f},
-std::array<float,2>{0.764773548f, 0.906450689f},
-std::array<float,2>{0.594614625f, 0.411716163f},
-std::array<float,2>{0.494645298f, 0.70873332f},
-std::array<float,2>{0.338001192f, 0.313446909f},
-std::array<float,2>{0.684961617f, 0.570172131f},
-std::array<float,2>{0.991193175f, 0.00890714303f},
-std::array<float,2>{0.118398808f, 0.766233981f},
-std::array<float,2>{0.0155300237f, 0.300950795f},
-std::array<float,2>{0.891323388f, 0.507698178f},
-std::array<float,2>{0.746422827f, 0.083932139f},
-std::array<float,2>{0.309745252f, 0.819980145f},
-std::array<float,2>{0.385282367f, 0.227208644f},
-std::array<float,2>{0.509245098f, 0.981563389f},
-std::array<float,2>{0.861792803f, 0.489872843f},
-std::array<float,2>{0.246441349f, 0.633715093f},
-std::array<float,2>{0.163902387f, 0.000357734447f},
-std::array<float,2>{0.802114546f, 0.774743795f},
-std::array<float,2>{0.58818984f, 0.325236797f},
-std::array<float,2>{0.43757689f, 0.576508522f},
-std::array<float,2>{0.364602506f, 0.417515755f},
-std::array<float,2>{0.640081346f, 0.716388583f},
-std::array<float,2>{0.938066721f, 0.130128741f},
-std::array<float,2>{0.068046011f, 0.921558321f},
-std::array<float,2>{0.190463036f, 0.451383412f},
-std::array<float,2>{0.824460924f, 0.658921301f},
-std::array<float,2>{0.558649659f, 0.203929484f},
-std::array<float,2>{0.421031773f, 0.942166686f},
-std::array<float,2>{0.275539607f, 0.108159028f},
-std::array<float,2>{0.692156434f, 0.872157335f},
-std::array<float,2>{0.932388484f, 0.262629181f},
-std::array<float,2>{0.0351483859f, 0.560289502f},
-std::array<float,2>{0.112944134f, 0.171024814f},
-std::array<float,2>{0.99222368f, 0.898822188f},
-std::array<float,2>{0.672860622f, 0.392659545f},
-std::array<float,2>{0.332746714f, 0.7232095f},
-std::array<float,2>{0.491044432f, 0.35845831f},
-std::array<float,2>{0.605684042f, 0.616803169f},
-std::array<float,2>{0.755290508f, 0.0386526249f},
-std::array<float,2>{0.128110141f, 0.786521554f},
-std::array<float,2>{0.14115639f, 0.333348781f},
-std::array<float,2>{0.778817534f, 0.591062784f},
-std::array<float,2>{0.612889469f, 0.0231299754f},
-std::array<float,2>{0.471065372f, 0.755748332f},
-std::array<float,2>{0.322315812f, 0.148365274f},
-std::array<float,2>{0.662695289f, 0.934693873f},
-std::array<float,2>{0.97052747f, 0.428567976f},
-std::array<float,2>{0.101320192f, 0.688464642f},
-std::array<float,2>{0.0509071052f, 0.0762196556f},
-std::array<float,2>{0.909653127f, 0.830044985f},
-std::array<float,2>{0.710791886f, 0.283825278f},
-std::array<float,2>{0.255309433f, 0.530362844f},
-std::array<float,2>{0.437228173f, 0.47553134f},
-std::array<float,2>{0.533072472f, 0.64865458f},
-std::array<float,2>{0.836759329f, 0.238546506f},
-std::array<float,2>{0.213272557f, 0.996215999f},
-std::array<float,2>{0.0837521479f, 0.387527913f},
-std::array<float,2>{0.955695868f, 0.737597585f},
-std::array<float,2>{0.655445397f, 0.173544377f},
-std::array<float,2>{0.356474012f, 0.883255422f},
-std::array<float,2>{0.462597191f, 0.0494755767f},
-std::array<float,2>{0.567493498f, 0.811364174f},
-std::array<float,2>{0.792801559f, 0.369839549f},
-std::array<float,2>{0.172299236f, 0.597430348f},
-std::array<float,2>{0.220314741f, 0.201456085f},
-std::array<float,2>{0.848123312f, 0.961667955f},
-std::array<float,2>{0.521411777f, 0.460723877f},
-std::array<float,2>{0.405774742f, 0.685435116f},
-std::array<float,2>{0.292703569f, 0.280742496f},
-std::array<float,2>{0.722937226f, 0.54160589f},
-std::array<float,2>{0.890149415f, 0.115174428f},
-std::array<float,2>{0.0260915607f, 0.849265814f},
-std::array<float,2>{0.0948822573f, 0.251151383f},
-std::array<float,2>{0.974218369f, 0.551419258f},
-std::array<float,2>{0.657079756f, 0.0945474729f},
-std::array<float,2>{0.325778753f, 0.863342643f},
-std::array<float,2>{0.472907037f, 0.213145792f},
-std::array<float,2>{0.615344346f, 0.949026167f},
-std::array<float,2>{0.774285436f, 0.442733437f},
-std::array<float,2>{0.145308703f, 0.670083702f},
-std::array<float,2>{0.216552243f, 0.0396911949f},
-std::array<float,2>{0.840881407f, 0.795209885f},
-std::array<float,2>{0.536159217f, 0.351342499f},
-std::array<float,2>{0.429810166f, 0.623428047f},
-std::array<float,2>{0.251901984f, 0.398883343f},
-std::array<float,2>{0.703524649f, 0.727655053f},
-std::array<float,2>{0.911975265f, 0.157295048f},
-std::array<float,2>{0.0479441024f, 0.89126426f},
-std::array<float,2>{0.177852511f, 0.496210724f},
-std::array<float,2>{0.794968963f, 0.631682396f},
-std::array<float,2>{0.5643273f, 0.224603683f},
-std::array<float,2>{0.465528101f, 0.969487906f},
-std::array<float,2>{0.355110347f, 0.0891729817f},
-std::array<float,2>{0.650538564f, 0.821031034f},
-std::array<float,2>{0.957649231f, 0.308704108f},
-std::array<float,2>{0.0794318095f, 0.510008454f},
-std::array<float,2>{0.0304268505f, 0.13800855f},
-std::array<float,2>{0.885360301f, 0.913760424f},
-std::array<float,2>{0.72171241f, 0.406275153f},
-std::array<float,2>{0.295865953f, 0.706989884f},
-std::array<float,2>{0.399159998f, 0.317847043f},
-std::array<float,2>{0.518759787f, 0.564714789f},
-std::array<float,2>{0.84573859f, 0.0123525299f},
-std::array<float,2>{0.225384995f, 0.773430049f},
-std::array<float,2>{0.24508065f, 0.367164701f},
-std::array<float,2>{0.866926491f, 0.603126466f},
-std::array<float,2>{0.514106929f, 0.0620831959f},
-std::array<float,2>{0.388940692f, 0.799118936f},
-std::array<float,2>{0.304922372f, 0.185871065f},
-std::array<float,2>{0.744157314f, 0.878528237f},
-std::array<float,2>{0.89697659f, 0.38051784f},
-std::array<float,2>{0.00850506127f, 0.746080935f},
-std::array<float,2>{0.0653519332f, 0.122997142f},
-std::array<float,2>{0.945159197f, 0.855523586f},
-std::array<float,2>{0.635322809f, 0.269423157f},
-std::array<float,2>{0.361995131f, 0.535664856f},
-std::array<float,2>{0.441764683f, 0.464737982f},
-std::array<float,2>{0.591534138f, 0.673238158f},
-std::array<float,2>{0.797353566f, 0.193824559f},
-std::array<float,2>{0.157121941f, 0.955821157f},
-std::array<float,2>{0.0365301855f, 0.430997908f},
-std::array<float,2>{0.934483647f, 0.701520562f},
-std::array<float,2>{0.689421892f, 0.152720228f},
-std::array<float,2>{0.278691351f, 0.923773944f},
-std::array<float,2>{0.416633666f, 0.0297961924f},
-std::array<float,2>{0.55556947f, 0.7641204f},
-std::array<float,2>{0.82109201f, 0.342095375f},
-std::array<float,2>{0.192741498f, 0.579752445f},
-std::array<float,2>{0.13025026f, 0.247531489f},
-std::array<float,2>{0.75026989f, 0.989990413f},
-std::array<float,2>{0.602454484f, 0.477043718f},
-std::array<float,2>{0.486256182f, 0.646213889f},
-std::array<float,2>{0.330412775f, 0.294362724f},
-std::array<float,2>{0.676130176f, 0.518720329f},
-std::array<float,2>{0.999629974f, 0.0676695481f},
-std::array<float,2>{0.116626911f, 0.839001298f},
-std::array<float,2>{0.00233149319f, 0.330045283f},
-std::array<float,2>{0.902811944f, 0.589287937f},
-std::array<float,2>{0.735149026f, 0.0168215502f},
-std::array<float,2>{0.298884332f, 0.750597f},
-std::array<float,2>{0.379038006f, 0.140923023f},
-std::array<float,2>{0.501852512f, 0.93067801f},
-std::array<float,2>{0.874076843f, 0.425193161f},
-std::array<float,2>{0.238654807f, 0.695152402f},
-std::array<float,2>{0.167771518f, 0.0732471496f},
-std::array<float,2>{0.807389915f, 0.835742891f},
-std::array<float,2>{0.580847144f, 0.288793355f},
-std::array<float,2>{0.449186981f, 0.524024367f},
-std::array<float,2>{0.373674899f, 0.471264511f},
-std::array<float,2>{0.631975949f, 0.653795481f},
-std::array<float,2>{0.948926866f, 0.238098726f},
-std::array<float,2>{0.0730415061f, 0.9953866f},
-std::array<float,2>{0.197951511f, 0.384783387f},
-std::array<float,2>{0.814394474f, 0.741663575f},
-std::array<float,2>{0.548870623f, 0.177359849f},
-std::array<float,2>{0.406778544f, 0.89060998f},
-std::array<float,2>{0.266336322f, 0.0524421223f},
-std::array<float,2>{0.701497257f, 0.805967391f},
-std::array<float,2>{0.923661113f, 0.374647319f},
-std::array<float,2>{0.0404759645f, 0.598593593f},
-std::array<float,2>{0.122953534f, 0.198546365f},
-std::array<float,2>{0.986175358f, 0.966539204f},
-std::array<float,2>{0.681830049f, 0.45657292f},
-std::array<float,2>{0.341426373f, 0.682646394f},
-std::array<float,2>{0.499651223f, 0.274698585f},
-std::array<float,2>{0.598325849f, 0.544452846f},
-std::array<float,2>{0.760824263f, 0.111796632f},
-std::array<float,2>{0.134852976f, 0.845727205f},
-std::array<float,2>{0.155119166f, 0.299178779f},
-std::array<float,2>{0.766248643f, 0.501303673f},
-std::array<float,2>{0.623221278f, 0.0810495391f},
-std::array<float,2>{0.483762413f, 0.815390348f},
-std::array<float,2>{0.314376652f, 0.231369659f},
-std::array<float,2>{0.670109868f, 0.978176415f},
-std::array<float,2>{0.978794038f, 0.485137761f},
-std::array<float,2>{0.108237907f, 0.638966441f},
-std::array<float,2>{0.0597768612f, 0.00643469021f},
-std::array<float,2>{0.91434449f, 0.778405905f},
-std::array<float,2>{0.714332938f, 0.322933137f},
-std::array<float,2>{0.258420259f, 0.573515296f},
-std::array<float,2>{0.426962495f, 0.418507189f},
-std::array<float,2>{0.543092549f, 0.714252472f},
-std::array<float,2>{0.834270239f, 0.128169283f},
-std::array<float,2>{0.205619827f, 0.917244554f},
-std::array<float,2>{0.0859992132f, 0.448686719f},
-std::array<float,2>{0.96378082f, 0.663284123f},
-std::array<float,2>{0.646114171f, 0.209886327f},
-std::array<float,2>{0.351558447f, 0.940574408f},
-std::array<float,2>{0.455571562f, 0.105032235f},
-std::array<float,2>{0.573397517f, 0.868270695f},
-std::array<float,2>{0.784267426f, 0.261438459f},
-std::array<float,2>{0.180388421f, 0.555217087f},
-std::array<float,2>{0.231018186f, 0.165914893f},
-std::array<float,2>{0.857243299f, 0.906240404f},
-std::array<float,2>{0.524984419f, 0.395829111f},
-std::array<float,2>{0.397598296f, 0.719983757f},
-std::array<float,2>{0.285473853f, 0.352518946f},
-std::array<float,2>{0.727974355f, 0.612256646f},
-std::array<float,2>{0.876350582f, 0.0332850479f},
-std::array<float,2>{0.0167792067f, 0.784658432f},
-std::array<float,2>{0.0777643174f, 0.346894294f},
-std::array<float,2>{0.949256182f, 0.619325936f},
-std::array<float,2>{0.628401339f, 0.0445721969f},
-std::array<float,2>{0.3676292f, 0.79025054f},
-std::array<float,2>{0.451465845f, 0.160183921f},
-std::array<float,2>{0.585441172f, 0.895985365f},
-std::array<float,2>{0.810504794f, 0.40525794f},
-std::array<float,2>{0.169732496f, 0.733537734f},
-std::array<float,2>{0.237454131f, 0.101136386f},
-std::array<float,2>{0.868353784f, 0.861514568f},
-std::array<float,2>{0.506954253f, 0.257775068f},
-std::array<float,2>{0.376445264f, 0.550568879f},
-std::array<float,2>{0.301898628f, 0.439153284f},
-std::array<float,2>{0.740753353f, 0.664088428f},
-std::array<float,2>{0.90106374f, 0.217967927f},
-std::array<float,2>{0.00691820681f, 0.952316403f},
-std::array<float,2>{0.139868379f, 0.410379857f},
-std::array<float,2>{0.7621966f, 0.707172871f},
-std::array<float,2>{0.597106099f, 0.133249208f},
-std::array<float,2>{0.49258706f, 0.907574654f},
-std::array<float,2>{0.33686021f, 0.00870096404f},
-std::array<float,2>{0.686089635f, 0.767554283f},
-std::array<float,2>{0.988562107f, 0.31406796f},
-std::array<float,2>{0.120666072f, 0.568965673f},
-std::array<float,2>{0.0465443581f, 0.219933048f},
-std::array<float,2>{0.929577947f, 0.974784493f},
-std::array<float,2>{0.696169376f, 0.494192779f},
-std::array<float,2>{0.270954281f, 0.626221716f},
-std::array<float,2>{0.413635194f, 0.305152923f},
-std::array<float,2>{0.553067982f, 0.514111876f},
-std::array<float,2>{0.819511592f, 0.0918406025f},
-std::array<float,2>{0.199720159f, 0.827735841f},
-std::array<float,2>{0.208003744f, 0.270818919f},
-std::array<float,2>{0.831421673f, 0.533568144f},
-std::array<float,2>{0.539459229f, 0.119137868f},
-std::array<float,2>{0.424286842f, 0.851723313f},
-std::array<float,2>{0.262251049f, 0.190078035f},
-std::array<float,2>{0.715620518f, 0.959766924f},
-std::array<float,2>{0.920163333f, 0.466278672f},
-std::array<float,2>{0.0574610643f, 0.678416669f},
-std::array<float,2>{0.104175851f, 0.0551664941f},
-std::array<float,2>{0.981049657f, 0.802929819f},
-std::array<float,2>{0.664600372f, 0.359787971f},
-std::array<float,2>{0.317059577f, 0.60639441f},
-std::array<float,2>{0.477924824f, 0.375627458f},
-std::array<float,2>{0.619390249f, 0.748306215f},
-std::array<float,2>{0.771317065f, 0.180490285f},
-std::array<float,2>{0.151759133f, 0.88160044f},
-std::array<float,2>{0.0207622591f, 0.482170373f},
-std::array<float,2>{0.881061494f, 0.641653061f},
-std::array<float,2>{0.730725169f, 0.24553217f},
-std::array<float,2>{0.285118341f, 0.985436022f},
-std::array<float,2>{0.391752899f, 0.0649531707f},
-std::array<float,2>{0.528170347f, 0.840049088f},
-std::array<float,2>{0.853654623f, 0.290609032f},
-std::array<float,2>{0.229193509f, 0.52237016f},
-std::array<float,2>{0.185067579f, 0.149265006f},
-std::array<float,2>{0.785811484f, 0.92696321f},
-std::array<float,2>{0.574917972f, 0.434091777f},
-std::array<float,2>{0.460494131f, 0.69598949f},
-std::array<float,2>{0.346810281f, 0.338261008f},
-std::array<float,2>{0.640636563f, 0.582359314f},
-std::array<float,2>{0.967374921f, 0.027326582f},
-std::array<float,2>{0.0913580656f, 0.758405149f},
-std::array<float,2>{0.0531952903f, 0.28467533f},
-std::array<float,2>{0.907020211f, 0.529809058f},
-std::array<float,2>{0.707264841f, 0.0780093446f},
-std::array<float,2>{0.256435096f, 0.828806818f},
-std::array<float,2>{0.435014814f, 0.239450037f},
-std::array<float,2>{0.535034239f, 0.997142613f},
-std::array<float,2>{0.839647532f, 0.47581777f},
-std::array<float,2>{0.212748885f, 0.649459898f},
-std::array<float,2>{0.142952085f, 0.0215326529f},
-std::array<float,2>{0.77936393f, 0.753990412f},
-std::array<float,2>{0.611061454f, 0.332129091f},
-std::array<float,2>{0.469615757f, 0.590699971f},
-std::array<float,2>{0.320482671f, 0.428949267f},
-std::array<float,2>{0.660811782f, 0.688741803f},
-std::array<float,2>{0.970917463f, 0.146613911f},
-std::array<float,2>{0.0993880704f, 0.933962464f},
-std::array<float,2>{0.222190544f, 0.459568709f},
-std::array<float,2>{0.849724591f, 0.683800459f},
-std::array<float,2>{0.522224247f, 0.202773124f},
-std::array<float,2>{0.40279299f, 0.962650955f},
-std::array<float,2>{0.290520042f, 0.113899201f},
-std::array<float,2>{0.725346506f, 0.848329842f},
-std::array<float,2>{0.88757354f, 0.280168444f},
-std::array<float,2>{0.0234893095f, 0.542785108f},
-std::array<float,2>{0.0843705982f, 0.172479108f},
-std::array<float,2>{0.954823554f, 0.884708822f},
-std::array<float,2>{0.653627217f, 0.388480246f},
-std::array<float,2>{0.358890057f, 0.737063766f},
-std::array<float,2>{0.463897943f, 0.370161623f},
-std::array<float,2>{0.568400741f, 0.595794618f},
-std::array<float,2>{0.789389253f, 0.0501948707f},
-std::array<float,2>{0.173908204f, 0.812123179f},
-std::array<float,2>{0.161304265f, 0.324635327f},
-std::array<float,2>{0.803298891f, 0.578050792f},
-std::array<float,2>{0.58765769f, 0.00189763855f},
-std::array<float,2>{0.441101193f, 0.774104178f},
-std::array<float,2>{0.366652042f, 0.128938541f},
-std::array<float,2>{0.638059795f, 0.919963241f},
-std::array<float,2>{0.940613151f, 0.416273177f},
-std::array<float,2>{0.0693511739f, 0.715034127f},
-std::array<float,2>{0.0132358f, 0.0820758119f},
-std::array<float,2>{0.892784894f, 0.818652451f},
-std::array<float,2>{0.74987942f, 0.301800132f},
-std::array<float,2>{0.311244309f, 0.506219089f},
-std::array<float,2>{0.384578764f, 0.48916167f},
-std::array<float,2>{0.511247098f, 0.634734213f},
-std::array<float,2>{0.860321105f, 0.228202105f},
-std::array<float,2>{0.249738023f, 0.980906248f},
-std::array<float,2>{0.111182921f, 0.394065708f},
-std::array<float,2>{0.994844437f, 0.723670781f},
-std::array<float,2>{0.674990773f, 0.170738846f},
-std::array<float,2>{0.33432427f, 0.89996928f},
-std::array<float,2>{0.489368796f, 0.0375554226f},
-std::array<float,2>{0.608213782f, 0.785991371f},
-std::array<float,2>{0.756913066f, 0.357928663f},
-std::array<float,2>{0.125376523f, 0.615533948f},
-std::array<float,2>{0.18768701f, 0.204480708f},
-std::array<float,2>{0.82761538f, 0.942705095f},
-std::array<float,2>{0.561166823f, 0.452918828f},
-std::array<float,2>{0.419639558f, 0.659771681f},
-std::array<float,2>{0.27514559f, 0.26303497f},
-std::array<float,2>{0.693658948f, 0.558883786f},
-std::array<float,2>{0.93148607f, 0.109080531f},
-std::array<float,2>{0.0316837505f, 0.871153831f},
-std::array<float,2>{0.0814282596f, 0.310955524f},
-std::array<float,2>{0.960005105f, 0.508509517f},
-std::array<float,2>{0.65035975f, 0.0862017125f},
-std::array<float,2>{0.353504747f, 0.823455453f},
-std::array<float,2>{0.468134761f, 0.226249486f},
-std::array<float,2>{0.565511525f, 0.971467912f},
-std::array<float,2>{0.794823825f, 0.498982221f},
-std::array<float,2>{0.177562341f, 0.630020261f},
-std::array<float,2>{0.224463388f, 0.0144587932f},
-std::array<float,2>{0.845340848f, 0.770803154f},
-std::array<float,2>{0.517134845f, 0.320254594f},
-std::array<float,2>{0.402224272f, 0.563712537f},
-std::array<float,2>{0.293265283f, 0.409172237f},
-std::array<float,2>{0.720180929f, 0.704682648f},
-std::array<float,2>{0.883241951f, 0.140529424f},
-std::array<float,2>{0.0284757875f, 0.911695719f},
-std::array<float,2>{0.146596491f, 0.445155174f},
-std::array<float,2>{0.776637197f, 0.669340253f},
-std::array<float,2>{0.615106821f, 0.211160034f},
-std::array<float,2>{0.47481665f, 0.946959853f},
-std::array<float,2>{0.327572584f, 0.0972023085f},
-std::array<float,2>{0.660141826f, 0.865620077f},
-std::array<float,2>{0.976059735f, 0.252181798f},
-std::array<float,2>{0.0974501595f, 0.554251075f},
-std::array<float,2>{0.0496526659f, 0.159985572f},
-std::array<float,2>{0.912249744f, 0.893476427f},
-std::array<float,2>{0.705742061f, 0.401108444f},
-std::array<float,2>{0.252077669f, 0.728690743f},
-std::array<float,2>{0.433053166f, 0.349006712f},
-std::array<float,2>{0.538331568f, 0.622861743f},
-std::array<float,2>{0.842288554f, 0.0418183282f},
-std::array<float,2>{0.218023002f, 0.793571591f},
-std::array<float,2>{0.194005221f, 0.340415955f},
-std::array<float,2>{0.822626114f, 0.580952048f},
-std::array<float,2>{0.556658208f, 0.0276857782f},
-std::array<float,2>{0.414914548f, 0.76257056f},
-std::array<float,2>{0.280452758f, 0.154604137f},
-std::array<float,2>{0.690458179f, 0.925416112f},
-std::array<float,2>{0.936956465f, 0.432631254f},
-std::array<float,2>{0.0379403196f, 0.699470341f},
-std::array<float,2>{0.114671007f, 0.0696882382f},
-std::array<float,2>{0.99704349f, 0.837748289f},
-std::array<float,2>{0.678154051f, 0.296082705f},
-std::array<float,2>{0.328426093f, 0.517002344f},
-std::array<float,2>{0.486614794f, 0.480406761f},
-std::array<float,2>{0.605378032f, 0.647427499f},
-std::array<float,2>{0.75342834f, 0.24932456f},
-std::array<float,2>{0.131993577f, 0.991411507f},
-std::array<float,2>{0.0108800186f, 0.381037265f},
-std::array<float,2>{0.896448612f, 0.742434919f},
-std::array<float,2>{0.742922902f, 0.185373753f},
-std::array<float,2>{0.308476061f, 0.875332713f},
-std::array<float,2>{0.387008131f, 0.0589144863f},
-std::array<float,2>{0.513321698f, 0.796898782f},
-std::array<float,2>{0.863553524f, 0.364484906f},
-std::array<float,2>{0.243756726f, 0.604290307f},
-std::array<float,2>{0.158501804f, 0.193327114f},
-std::array<float,2>{0.798996449f, 0.953449607f},
-std::array<float,2>{0.593328118f, 0.462807149f},
-std::array<float,2>{0.443743616f, 0.675127149f},
-std::array<float,2>{0.360816747f, 0.265961707f},
-std::array<float,2>{0.633827984f, 0.538338423f},
-std::array<float,2>{0.94288528f, 0.124533162f},
-std::array<float,2>{0.0625474304f, 0.857913077f},
-std::array<float,2>{0.0424626805f, 0.371867567f},
-std::array<float,2>{0.925565481f, 0.600790322f},
-std::array<float,2>{0.701068938f, 0.0543588288f},
-std::array<float,2>{0.269297749f, 0.807868838f},
-std::array<float,2>{0.408285648f, 0.178942576f},
-std::array<float,2>{0.547430038f, 0.886917949f},
-std::array<float,2>{0.816231072f, 0.383083582f},
-std::array<float,2>{0.196200356f, 0.739148974f},
-std::array<float,2>{0.134459287f, 0.109631039f},
-std::array<float,2>{0.75879091f, 0.844160914f},
-std::array<float,2>{0.600906253f, 0.276758134f},
-std::array<float,2>{0.496307403f, 0.545392454f},
-std::array<float,2>{0.34201327f, 0.454570442f},
-std::array<float,2>{0.680864275f, 0.6802212f},
-std::array<float,2>{0.986394823f, 0.196760312f},
-std::array<float,2>{0.123796396f, 0.968741238f},
-std::array<float,2>{0.240297943f, 0.422483265f},
-std::array<float,2>{0.872311711f, 0.69262749f},
-std::array<float,2>{0.502314806f, 0.143898442f},
-std::array<float,2>{0.381518424f, 0.933176696f},
-std::array<float,2>{0.297500908f, 0.018186843f},
-std::array<float,2>{0.737555861f, 0.752227247f},
-std::array<float,2>{0.904352665f, 0.331399053f},
-std::array<float,2>{0.000693451322f, 0.587361932f},
-std::array<float,2>{0.0716622919f, 0.235684395f},
-std::array<float,2>{0.946866632f, 0.993259609f},
-std::array<float,2>{0.629509807f, 0.468875051f},
-std::array<float,2>{0.371355057f, 0.655113041f},
-std::array<float,2>{0.446261913f, 0.287040561f},
-std::array<float,2>{0.579066217f, 0.525927842f},
-std::array<float,2>{0.804707348f, 0.0714723021f},
-std::array<float,2>{0.164744303f, 0.832807124f},
-std::array<float,2>{0.183388099f, 0.258475125f},
-std::array<float,2>{0.781622589f, 0.557546675f},
-std::array<float,2>{0.571597695f, 0.10335815f},
-std::array<float,2>{0.453903735f, 0.869387388f},
-std::array<float,2>{0.34936282f, 0.207840085f},
-std::array<float,2>{0.647783875f, 0.938411772f},
-std::array<float,2>{0.961587608f, 0.445611477f},
-std::array<float,2>{0.0887358785f, 0.660919547f},
-std::array<float,2>{0.0175930038f, 0.0324169435f},
-std::array<float,2>{0.877094805f, 0.782318354f},
-std::array<float,2>{0.730117261f, 0.353561401f},
-std::array<float,2>{0.288229227f, 0.609454751f},
-std::array<float,2>{0.395151407f, 0.396832466f},
-std::array<float,2>{0.52547729f, 0.720825136f},
-std::array<float,2>{0.858718038f, 0.167621896f},
-std::array<float,2>{0.233736545f, 0.903443336f},
-std::array<float,2>{0.106967084f, 0.487671703f},
-std::array<float,2>{0.978378534f, 0.637972355f},
-std::array<float,2>{0.669408143f, 0.232641205f},
-std::array<float,2>{0.315487325f, 0.97903049f},
-std::array<float,2>{0.481030375f, 0.0794014558f},
-std::array<float,2>{0.621416211f, 0.813973844f},
-std::array<float,2>{0.768857181f, 0.297382653f},
-std::array<float,2>{0.153406247f, 0.503205836f},
-std::array<float,2>{0.204942346f, 0.126846343f},
-std::array<float,2>{0.833741128f, 0.914246082f},
-std::array<float,2>{0.545897424f, 0.421692312f},
-std::array<float,2>{0.428700447f, 0.712886274f},
-std::array<float,2>{0.259913772f, 0.321072668f},
-std::array<float,2>{0.712244511f, 0.571975648f},
-std::array<float,2>{0.917530954f, 0.00486315973f},
-std::array<float,2>{0.0621203892f, 0.780251563f},
-std::array<float,2>{0.117980048f, 0.316019654f},
-std::array<float,2>{0.991902947f, 0.566636264f},
-std::array<float,2>{0.684226811f, 0.0113573447f},
-std::array<float,2>{0.339516461f, 0.768612981f},
-std::array<float,2>{0.495826483f, 0.135546297f},
-std::array<float,2>{0.594811678f, 0.909943998f},
-std::array<float,2>{0.763764262f, 0.413453847f},
-std::array<float,2>{0.137174964f, 0.709435761f},
-std::array<float,2>{0.202072889f, 0.0902843773f},
-std::array<float,2>{0.818116069f, 0.825851321f},
-std::array<float,2>{0.550910473f, 0.308463067f},
-std::array<float,2>{0.410613477f, 0.512565196f},
-std::array<float,2>{0.272573888f, 0.492213011f},
-std::array<float,2>{0.699158967f, 0.627809763f},
-std::array<float,2>{0.926146984f, 0.221103266f},
-std::array<float,2>{0.0436482988f, 0.974571586f},
-std::array<float,2>{0.171812475f, 0.403802931f},
-std::array<float,2>{0.812425911f, 0.731012702f},
-std::array<float,2>{0.582415044f, 0.163614854f},
-std::array<float,2>{0.450977296f, 0.89681375f},
-std::array<float,2>{0.371084988f, 0.0457237437f},
-std::array<float,2>{0.626882613f, 0.792035699f},
-std::array<float,2>{0.951690853f, 0.343836188f},
-std::array<float,2>{0.0759981945f, 0.617312849f},
-std::array<float,2>{0.00527044619f, 0.216621622f},
-std::array<float,2>{0.899349213f, 0.949501038f},
-std::array<float,2>{0.739755332f, 0.440643817f},
-std::array<float,2>{0.30386281f, 0.667156875f},
-std::array<float,2>{0.377664119f, 0.255700171f},
-std::array<float,2>{0.50504601f, 0.547273695f},
-std::array<float,2>{0.869345427f, 0.0984803885f},
-std::array<float,2>{0.235197246f, 0.860593081f},
-std::array<float,2>{0.228257537f, 0.291455179f},
-std::array<float,2>{0.853088677f, 0.521166682f},
-std::array<float,2>{0.531137884f, 0.0637074709f},
-std::array<float,2>{0.393927544f, 0.843719959f},
-std::array<float,2>{0.282322288f, 0.243507788f},
-std::array<float,2>{0.733068466f, 0.987810671f},
-std::array<float,2>{0.879181683f, 0.484237731f},
-std::array<float,2>{0.0233083013f, 0.643778026f},
-std::array<float,2>{0.0931752473f, 0.0236207061f},
-std::array<float,2>{0.966404855f, 0.760917366f},
-std::array<float,2>{0.643574595f, 0.337432951f},
-std::array<float,2>{0.345174998f, 0.585433483f},
-std::array<float,2>{0.45761922f, 0.435677439f},
-std::array<float,2>{0.577643156f, 0.697888076f},
-std::array<float,2>{0.787714839f, 0.151380539f},
-std::array<float,2>{0.186447799f, 0.928164482f},
-std::array<float,2>{0.0551956408f, 0.468315899f},
-std::array<float,2>{0.918169618f, 0.676227391f},
-std::array<float,2>{0.716954231f, 0.189036414f},
-std::array<float,2>{0.264104635f, 0.957052767f},
-std::array<float,2>{0.422037482f, 0.120373957f},
-std::array<float,2>{0.542791188f, 0.854774714f},
-std::array<float,2>{0.828794003f, 0.271576494f},
-std::array<float,2>{0.210862488f, 0.532030582f},
-std::array<float,2>{0.149257824f, 0.18241857f},
-std::array<float,2>{0.772050381f, 0.879751086f},
-std::array<float,2>{0.617677748f, 0.37759608f},
-std::array<float,2>{0.478628397f, 0.746698797f},
-std::array<float,2>{0.319826126f, 0.361480802f},
-std::array<float,2>{0.667238951f, 0.608662069f},
-std::array<float,2>{0.983274698f, 0.0569526516f},
-std::array<float,2>{0.102943063f, 0.801423788f},
-std::array<float,2>{0.0271123108f, 0.277838469f},
-std::array<float,2>{0.888697267f, 0.540951431f},
-std::array<float,2>{0.724225521f, 0.116403252f},
-std::array<float,2>{0.291803122f, 0.849791527f},
-std::array<float,2>{0.404861063f, 0.200803071f},
-std::array<float,2>{0.520333111f, 0.964513063f},
-std::array<float,2>{0.849275947f, 0.457749069f},
-std::array<float,2>{0.219487295f, 0.685568333f},
-std::array<float,2>{0.172899246f, 0.0480499677f},
-std::array<float,2>{0.791088939f, 0.809560001f},
-std::array<float,2>{0.56701076f, 0.367293239f},
-std::array<float,2>{0.46108371f, 0.594913125f},
-std::array<float,2>{0.356397182f, 0.389920026f},
-std::array<float,2>{0.654650152f, 0.734549165f},
-std::array<float,2>{0.956363857f, 0.174191028f},
-std::array<float,2>{0.0830066875f, 0.885745704f},
-std::array<float,2>{0.214217663f, 0.473451108f},
-std::array<float,2>{0.837717175f, 0.650878668f},
-std::array<float,2>{0.531482339f, 0.242018148f},
-std::array<float,2>{0.436373204f, 0.998351276f},
-std::array<float,2>{0.254536033f, 0.0751203522f},
-std::array<float,2>{0.709614694f, 0.831765711f},
-std::array<float,2>{0.909057498f, 0.281864882f},
-std::array<float,2>{0.0523900278f, 0.529196322f},
-std::array<float,2>{0.100454904f, 0.146425188f},
-std::array<float,2>{0.969703496f, 0.936073363f},
-std::array<float,2>{0.663549006f, 0.427461147f},
-std::array<float,2>{0.323987782f, 0.690972269f},
-std::array<float,2>{0.472429276f, 0.335760951f},
-std::array<float,2>{0.611446321f, 0.592515588f},
-std::array<float,2>{0.777370214f, 0.019819336f},
-std::array<float,2>{0.142433524f, 0.756808877f},
-std::array<float,2>{0.127136096f, 0.35631749f},
-std::array<float,2>{0.754201591f, 0.61334753f},
-std::array<float,2>{0.607221425f, 0.0359083451f},
-std::array<float,2>{0.491450191f, 0.788397193f},
-std::array<float,2>{0.333898842f, 0.168624297f},
-std::array<float,2>{0.672267318f, 0.900597155f},
-std::array<float,2>{0.993893445f, 0.390770793f},
-std::array<float,2>{0.112137698f, 0.725053132f},
-std::array<float,2>{0.033904884f, 0.105888963f},
-std::array<float,2>{0.933568776f, 0.873598337f},
-std::array<float,2>{0.693212271f, 0.2641536f},
-std::array<float,2>{0.276905298f, 0.561080039f},
-std::array<float,2>{0.420271635f, 0.449829459f},
-std::array<float,2>{0.560530365f, 0.657229483f},
-std::array<float,2>{0.825200975f, 0.206774458f},
-std::array<float,2>{0.189508036f, 0.944855154f},
-std::array<float,2>{0.0669644699f, 0.414280057f},
-std::array<float,2>{0.938530982f, 0.718341112f},
-std::array<float,2>{0.639089882f, 0.131219283f},
-std::array<float,2>{0.363981307f, 0.918888986f},
-std::array<float,2>{0.43913579f, 0.00211062515f},
-std::array<float,2>{0.589369059f, 0.77572161f},
-std::array<float,2>{0.801194131f, 0.327012122f},
-std::array<float,2>{0.162746191f, 0.575383544f},
-std::array<float,2>{0.247209698f, 0.229831353f},
-std::array<float,2>{0.86276418f, 0.983734787f},
-std::array<float,2>{0.50803107f, 0.491378456f},
-std::array<float,2>{0.386163116f, 0.634826124f},
-std::array<float,2>{0.309246689f, 0.304072887f},
-std::array<float,2>{0.747514367f, 0.505692899f},
-std::array<float,2>{0.89223516f, 0.0841107368f},
-std::array<float,2>{0.0141758164f, 0.818162978f},
-std::array<float,2>{0.119675234f, 0.308318466f},
-std::array<float,2>{0.989715934f, 0.512335598f},
-std::array<float,2>{0.686943829f, 0.0900778174f},
-std::array<float,2>{0.337148666f, 0.826071501f},
-std::array<float,2>{0.49392873f, 0.220916033f},
-std::array<float,2>{0.595838249f, 0.974342763f},
-std::array<float,2>{0.763409793f, 0.492593437f},
-std::array<float,2>{0.139076784f, 0.627633691f},
-std::array<float,2>{0.200674459f, 0.0116177713f},
-std::array<float,2>{0.818637311f, 0.76886183f},
-std::array<float,2>{0.554107606f, 0.316385359f},
-std::array<float,2>{0.412503093f, 0.566799939f},
-std::array<float,2>{0.270499974f, 0.413219839f},
-std::array<float,2>{0.69670105f, 0.70921284f},
-std::array<float,2>{0.928216934f, 0.135323644f},
-std::array<float,2>{0.0457590632f, 0.909852564f},
-std::array<float,2>{0.168207258f, 0.440847933f},
-std::array<float,2>{0.809066057f, 0.667458713f},
-std::array<float,2>{0.584933817f, 0.216453627f},
-std::array<float,2>{0.452425569f, 0.949268043f},
-std::array<float,2>{0.368477762f, 0.0983330607f},
-std::array<float,2>{0.627771735f, 0.860640109f},
-std::array<float,2>{0.950455189f, 0.255571753f},
-std::array<float,2>{0.0762005299f, 0.547028422f},
-std::array<float,2>{0.00621367618f, 0.163892582f},
-std::array<float,2>{0.901682496f, 0.896667004f},
-std::array<float,2>{0.742164612f, 0.403426468f},
-std::array<float,2>{0.301685572f, 0.73130399f},
-std::array<float,2>{0.375139654f, 0.344031572f},
-std::array<float,2>{0.506706774f, 0.617547512f},
-std::array<float,2>{0.867692947f, 0.0455162264f},
-std::array<float,2>{0.236901283f, 0.792367816f},
-std::array<float,2>{0.230143562f, 0.337687612f},
-std::array<float,2>{0.854541183f, 0.58511728f},
-std::array<float,2>{0.528856575f, 0.0238365643f},
-std::array<float,2>{0.390778124f, 0.761034787f},
-std::array<float,2>{0.283261538f, 0.15183115f},
-std::array<float,2>{0.731981456f, 0.927747607f},
-std::array<float,2>{0.88240099f, 0.435938686f},
-std::array<float,2>{0.0202589128f, 0.698041618f},
-std::array<float,2>{0.0899242833f, 0.0637782887f},
-std::array<float,2>{0.968403697f, 0.843379676f},
-std::array<float,2>{0.6421206f, 0.291180938f},
-std::array<float,2>{0.345709682f, 0.521360636f},
-std::array<float,2>{0.459591955f, 0.483970374f},
-std::array<float,2>{0.575440347f, 0.643888414f},
-std::array<float,2>{0.786286175f, 0.243336916f},
-std::array<float,2>{0.183972269f, 0.988094091f},
-std::array<float,2>{0.0578531027f, 0.377865523f},
-std::array<float,2>{0.920993447f, 0.747029424f},
-std::array<float,2>{0.716730893f, 0.182280943f},
-std::array<float,2>{0.263333142f, 0.879548252f},
-std::array<float,2>{0.424924612f, 0.0568377934f},
-std::array<float,2>{0.540943563f, 0.801719606f},
-std::array<float,2>{0.830511451f, 0.361715019f},
-std::array<float,2>{0.208395287f, 0.608495474f},
-std::array<float,2>{0.150695398f, 0.189385578f},
-std::array<float,2>{0.770445645f, 0.957295537f},
-std::array<float,2>{0.620179951f, 0.468607455f},
-std::array<float,2>{0.477261871f, 0.675959468f},
-std::array<float,2>{0.318309844f, 0.271902978f},
-std::array<float,2>{0.665337741f, 0.531752169f},
-std::array<float,2>{0.981464386f, 0.120218694f},
-std::array<float,2>{0.105106309f, 0.854717791f},
-std::array<float,2>{0.0250232089f, 0.367477745f},
-std::array<float,2>{0.888418019f, 0.595187783f},
-std::array<float,2>{0.726461589f, 0.0482874885f},
-std::array<float,2>{0.289231479f, 0.809161901f},
-std::array<float,2>{0.403979421f, 0.173961937f},
-std::array<float,2>{0.523166835f, 0.886139095f},
-std::array<float,2>{0.851476789f, 0.389754117f},
-std::array<float,2>{0.220933065f, 0.734842241f},
-std::array<float,2>{0.175643787f, 0.116495743f},
-std::array<float,2>{0.790332437f, 0.84989208f},
-std::array<float,2>{0.569964588f, 0.27816987f},
-std::array<float,2>{0.463863462f, 0.540631175f},
-std::array<float,2>{0.358140171f, 0.457860559f},
-std::array<float,2>{0.652875066f, 0.686024547f},
-std::array<float,2>{0.953202009f, 0.201130822f},
-std::array<float,2>{0.0855863541f, 0.96468699f},
-std::array<float,2>{0.211790428f, 0.427630872f},
-std::array<float,2>{0.838810265f, 0.691165507f},
-std::array<float,2>{0.53338027f, 0.146081239f},
-std::array<float,2>{0.434355736f, 0.936377525f},
-std::array<float,2>{0.257139355f, 0.0197691508f},
-std::array<float,2>{0.708620429f, 0.756559193f},
-std::array<float,2>{0.90754652f, 0.335639775f},
-std::array<float,2>{0.0539480112f, 0.592635512f},
-std::array<float,2>{0.097761713f, 0.24177824f},
-std::array<float,2>{0.971739888f, 0.998059213f},
-std::array<float,2>{0.661683679f, 0.473151684f},
-std::array<float,2>{0.321642935f, 0.650391757f},
-std::array<float,2>{0.47017917f, 0.282058269f},
-std::array<float,2>{0.609886825f, 0.528880715f},
-std::array<float,2>{0.780839324f, 0.0748402029f},
-std::array<float,2>{0.143763915f, 0.832022727f},
-std::array<float,2>{0.126634315f, 0.263771892f},
-std::array<float,2>{0.755992234f, 0.561465502f},
-std::array<float,2>{0.608979583f, 0.105639569f},
-std::array<float,2>{0.488814682f, 0.873829544f},
-std::array<float,2>{0.335401237f, 0.206963435f},
-std::array<float,2>{0.67390281f, 0.945191026f},
-std::array<float,2>{0.995212913f, 0.450112164f},
-std::array<float,2>{0.109889805f, 0.657600641f},
-std::array<float,2>{0.0331846513f, 0.0356758498f},
-std::array<float,2>{0.930206001f, 0.788295448f},
-std::array<float,2>{0.695067048f, 0.356079698f},
-std::array<float,2>{0.274165571f, 0.613589644f},
-std::array<float,2>{0.418933213f, 0.391033798f},
-std::array<float,2>{0.561557174f, 0.724727511f},
-std::array<float,2>{0.826825678f, 0.168874383f},
-std::array<float,2>{0.188675702f, 0.900851011f},
-std::array<float,2>{0.0685357898f, 0.491534859f},
-std::array<float,2>{0.939488947f, 0.635035038f},
-std::array<float,2>{0.636850715f, 0.229554638f},
-std::array<float,2>{0.366185874f, 0.983437538f},
-std::array<float,2>{0.439859331f, 0.0844498202f},
-std::array<float,2>{0.586704373f, 0.817981303f},
-std::array<float,2>{0.804287493f, 0.303921223f},
-std::array<float,2>{0.160355747f, 0.505441308f},
-std::array<float,2>{0.248862281f, 0.13089399f},
-std::array<float,2>{0.860929072f, 0.918630421f},
-std::array<float,2>{0.510122299f, 0.414369851f},
-std::array<float,2>{0.383202851f, 0.718596339f},
-std::array<float,2>{0.31240356f, 0.326828271f},
-std::array<float,2>{0.748641789f, 0.575631022f},
-std::array<float,2>{0.894483566f, 0.00230055139f},
-std::array<float,2>{0.0121142296f, 0.775463045f},
-std::array<float,2>{0.0781331137f, 0.319945604f},
-std::array<float,2>{0.958885491f, 0.563872337f},
-std::array<float,2>{0.65180558f, 0.014255818f},
-std::array<float,2>{0.353693873f, 0.77074194f},
-std::array<float,2>{0.46660614f, 0.140258342f},
-std::array<float,2>{0.563385129f, 0.912077785f},
-std::array<float,2>{0.796282649f, 0.408822268f},
-std::array<float,2>{0.179472432f, 0.704933047f},
-std::array<float,2>{0.226544887f, 0.0859605223f},
-std::array<float,2>{0.847012401f, 0.823489785f},
-std::array<float,2>{0.517888308f, 0.310688138f},
-std::array<float,2>{0.399551004f, 0.508572638f},
-std::array<float,2>{0.296067595f, 0.498776436f},
-std::array<float,2>{0.721204638f, 0.630182445f},
-std::array<float,2>{0.886077583f, 0.226513714f},
-std::array<float,2>{0.0295722354f, 0.971314967f},
-std::array<float,2>{0.145845458f, 0.401161045f},
-std::array<float,2>{0.774864316f, 0.728860795f},
-std::array<float,2>{0.61632359f, 0.159727812f},
-std::array<float,2>{0.473790884f, 0.893203914f},
-std::array<float,2>{0.324725837f, 0.0416303314f},
-std::array<float,2>{0.657890439f, 0.793887794f},
-std::array<float,2>{0.973012984f, 0.348676383f},
-std::array<float,2>{0.094216615f, 0.622695506f},
-std::array<float,2>{0.0478486903f, 0.211400509f},
-std::array<float,2>{0.910661221f, 0.947170019f},
-std::array<float,2>{0.705070078f, 0.444869548f},
-std::array<float,2>{0.250635386f, 0.669123471f},
-std::array<float,2>{0.430833548f, 0.252234071f},
-std::array<float,2>{0.535408854f, 0.554514289f},
-std::array<float,2>{0.84024781f, 0.0974463969f},
-std::array<float,2>{0.215197474f, 0.86543119f},
-std::array<float,2>{0.192213669f, 0.296376944f},
-std::array<float,2>{0.821451664f, 0.516608596f},
-std::array<float,2>{0.556413054f, 0.0695051774f},
-std::array<float,2>{0.41719684f, 0.837568104f},
-std::array<float,2>{0.277931213f, 0.249183878f},
-std::array<float,2>{0.688289464f, 0.991558671f},
-std::array<float,2>{0.934580982f, 0.480017304f},
-std::array<float,2>{0.0360947251f, 0.647129774f},
-std::array<float,2>{0.115822107f, 0.0275818296f},
-std::array<float,2>{0.998554647f, 0.762349248f},
-std::array<float,2>{0.677627265f, 0.340667456f},
-std::array<float,2>{0.331611216f, 0.58068639f},
-std::array<float,2>{0.484717965f, 0.433105022f},
-std::array<float,2>{0.60340327f, 0.69939363f},
-std::array<float,2>{0.751673758f, 0.154518127f},
-std::array<float,2>{0.129529223f, 0.925675154f},
-std::array<float,2>{0.00957295112f, 0.462447256f},
-std::array<float,2>{0.898083448f, 0.675005853f},
-std::array<float,2>{0.745773852f, 0.192883328f},
-std::array<float,2>{0.306417733f, 0.953203619f},
-std::array<float,2>{0.389772534f, 0.124810785f},
-std::array<float,2>{0.515272319f, 0.858291805f},
-std::array<float,2>{0.865679204f, 0.265697926f},
-std::array<float,2>{0.245655566f, 0.538186967f},
-std::array<float,2>{0.15817377f, 0.185060993f},
-std::array<float,2>{0.798544526f, 0.875020921f},
-std::array<float,2>{0.590605617f, 0.381307989f},
-std::array<float,2>{0.443310648f, 0.7422328f},
-std::array<float,2>{0.363100827f, 0.36469537f},
-std::array<float,2>{0.635940552f, 0.604138553f},
-std::array<float,2>{0.943597317f, 0.0588345975f},
-std::array<float,2>{0.0659286454f, 0.797129989f},
-std::array<float,2>{0.0391335711f, 0.276440233f},
-std::array<float,2>{0.922503591f, 0.544980645f},
-std::array<float,2>{0.702650428f, 0.109550841f},
-std::array<float,2>{0.266626596f, 0.84379977f},
-std::array<float,2>{0.407754987f, 0.196446583f},
-std::array<float,2>{0.549925983f, 0.968383729f},
-std::array<float,2>{0.812851846f, 0.454323739f},
-std::array<float,2>{0.198365599f, 0.680587828f},
-std::array<float,2>{0.136522964f, 0.0546456948f},
-std::array<float,2>{0.760353148f, 0.80782938f},
-std::array<float,2>{0.59885025f, 0.371669769f},
-std::array<float,2>{0.498796403f, 0.601067662f},
-std::array<float,2>{0.340428382f, 0.382831931f},
-std::array<float,2>{0.683421016f, 0.738825619f},
-std::array<float,2>{0.985223353f, 0.17903924f},
-std::array<float,2>{0.121772118f, 0.887111902f},
-std::array<float,2>{0.240220889f, 0.469156414f},
-std::array<float,2>{0.873303592f, 0.654944062f},
-std::array<float,2>{0.500334859f, 0.235450089f},
-std::array<float,2>{0.380091786f, 0.993421018f},
-std::array<float,2>{0.299941778f, 0.0717361942f},
-std::array<float,2>{0.736190557f, 0.832535326f},
-std::array<float,2>{0.90425241f, 0.286842853f},
-std::array<float,2>{0.0033125747f, 0.526223779f},
-std::array<float,2>{0.0733235702f, 0.143595383f},
-std::array<float,2>{0.947410285f, 0.933463752f},
-std::array<float,2>{0.631656229f, 0.422701269f},
-std::array<float,2>{0.374839425f, 0.692409098f},
-std::array<float,2>{0.447740614f, 0.331074834f},
-std::array<float,2>{0.581929088f, 0.586919606f},
-std::array<float,2>{0.807741523f, 0.0185348839f},
-std::array<float,2>{0.166594341f, 0.752111554f},
-std::array<float,2>{0.180976212f, 0.353906989f},
-std::array<float,2>{0.783300698f, 0.609803021f},
-std::array<float,2>{0.572762907f, 0.0325807855f},
-std::array<float,2>{0.456890732f, 0.782690585f},
-std::array<float,2>{0.350153655f, 0.167823285f},
-std::array<float,2>{0.645001531f, 0.903779209f},
-std::array<float,2>{0.964364171f, 0.396486044f},
-std::array<float,2>{0.0872199684f, 0.721086621f},
-std::array<float,2>{0.015653545f, 0.103186473f},
-std::array<float,2>{0.875447452f, 0.869372249f},
-std::array<float,2>{0.727031112f, 0.258668512f},
-std::array<float,2>{0.286699444f, 0.557214677f},
-std::array<float,2>{0.397323489f, 0.445399225f},
-std::array<float,2>{0.524148345f, 0.660801172f},
-std::array<float,2>{0.856375277f, 0.207568318f},
-std::array<float,2>{0.232310206f, 0.938090444f},
-std::array<float,2>{0.109116524f, 0.421535224f},
-std::array<float,2>{0.979937971f, 0.712427855f},
-std::array<float,2>{0.671827376f, 0.126655102f},
-std::array<float,2>{0.313229948f, 0.914464831f},
-std::array<float,2>{0.482991278f, 0.00454196986f},
-std::array<float,2>{0.624356925f, 0.77993089f},
-std::array<float,2>{0.767251313f, 0.321035117f},
-std::array<float,2>{0.155894622f, 0.572156191f},
-std::array<float,2>{0.206778094f, 0.232767612f},
-std::array<float,2>{0.83559829f, 0.979433715f},
-std::array<float,2>{0.544613302f, 0.487393558f},
-std::array<float,2>{0.426287502f, 0.637906015f},
-std::array<float,2>{0.259118557f, 0.297840863f},
-std::array<float,2>{0.713117123f, 0.503054321f},
-std::array<float,2>{0.915819883f, 0.07930246f},
-std::array<float,2>{0.0594234578f, 0.814430833f},
-std::array<float,2>{0.0749611929f, 0.257436901f},
-std::array<float,2>{0.952183306f, 0.550463438f},
-std::array<float,2>{0.625082612f, 0.101510495f},
-std::array<float,2>{0.369301498f, 0.861677349f},
-std::array<float,2>{0.44928956f, 0.218069464f},
-std::array<float,2>{0.583906412f, 0.952580869f},
-std::array<float,2>{0.810595155f, 0.439284682f},
-std::array<float,2>{0.170727f, 0.664478898f},
-std::array<float,2>{0.236195967f, 0.044799231f},
-std::array<float,2>{0.870841205f, 0.790459514f},
-std::array<float,2>{0.503938973f, 0.346949011f},
-std::array<float,2>{0.377972543f, 0.619422317f},
-std::array<float,2>{0.303663284f, 0.404994249f},
-std::array<float,2>{0.738283753f, 0.733792484f},
-std::array<float,2>{0.899724722f, 0.160432652f},
-std::array<float,2>{0.00400711037f, 0.895741761f},
-std::array<float,2>{0.137906611f, 0.49439913f},
-std::array<float,2>{0.765208423f, 0.626042962f},
-std::array<float,2>{0.594017029f, 0.220190793f},
-std::array<float,2>{0.49453932f, 0.975049853f},
-std::array<float,2>{0.338440657f, 0.0921783373f},
-std::array<float,2>{0.685427666f, 0.828119457f},
-std::array<float,2>{0.990256011f, 0.304733276f},
-std::array<float,2>{0.118711568f, 0.513778031f},
-std::array<float,2>{0.0443351455f, 0.132979184f},
-std::array<float,2>{0.926988721f, 0.907392859f},
-std::array<float,2>{0.697788298f, 0.410554379f},
-std::array<float,2>{0.271924794f, 0.707299769f},
-std::array<float,2>{0.411430746f, 0.314258844f},
-std::array<float,2>{0.552375555f, 0.569121361f},
-std::array<float,2>{0.816533029f, 0.00830612425f},
-std::array<float,2>{0.203021348f, 0.767131627f},
-std::array<float,2>{0.20954223f, 0.359590024f},
-std::array<float,2>{0.830023348f, 0.606134593f},
-std::array<float,2>{0.541225493f, 0.0548211448f},
-std::array<float,2>{0.423644364f, 0.803106904f},
-std::array<float,2>{0.265298128f, 0.180249631f},
-std::array<float,2>{0.718613267f, 0.881357729f},
-std::array<float,2>{0.919526875f, 0.375821561f},
-std::array<float,2>{0.0562284589f, 0.748094201f},
-std::array<float,2>{0.101656348f, 0.118766189f},
-std::array<float,2>{0.983478725f, 0.85187459f},
-std::array<float,2>{0.666293681f, 0.27073428f},
-std::array<float,2>{0.318999857f, 0.533218384f},
-std::array<float,2>{0.480147004f, 0.465842843f},
-std::array<float,2>{0.618931532f, 0.678551555f},
-std::array<float,2>{0.773196876f, 0.19038868f},
-std::array<float,2>{0.150313303f, 0.95953548f},
-std::array<float,2>{0.022159202f, 0.434512377f},
-std::array<float,2>{0.88007611f, 0.696132839f},
-std::array<float,2>{0.733946264f, 0.148927182f},
-std::array<float,2>{0.281351566f, 0.927046418f},
-std::array<float,2>{0.392750144f, 0.0270383414f},
-std::array<float,2>{0.529754162f, 0.758631408f},
-std::array<float,2>{0.852190077f, 0.338002264f},
-std::array<float,2>{0.227154344f, 0.582114041f},
-std::array<float,2>{0.187459439f, 0.245325819f},
-std::array<float,2>{0.78847611f, 0.985703766f},
-std::array<float,2>{0.57649219f, 0.482216299f},
-std::array<float,2>{0.458134204f, 0.64191556f},
-std::array<float,2>{0.343939632f, 0.29091984f},
-std::array<float,2>{0.643502057f, 0.522081196f},
-std::array<float,2>{0.965303242f, 0.0652016401f},
-std::array<float,2>{0.0923968926f, 0.84020704f},
-std::array<float,2>{0.0514674783f, 0.332376897f},
-std::array<float,2>{0.909915209f, 0.590532124f},
-std::array<float,2>{0.710218012f, 0.021855427f},
-std::array<float,2>{0.255849272f, 0.754390299f},
-std::array<float,2>{0.436742455f, 0.146788776f},
-std::array<float,2>{0.532438219f, 0.933677375f},
-std::array<float,2>{0.836364806f, 0.428992301f},
-std::array<float,2>{0.21385707f, 0.688566208f},
-std::array<float,2>{0.140889689f, 0.0778237507f},
-std::array<float,2>{0.778512955f, 0.828918755f},
-std::array<float,2>{0.612498164f, 0.284949958f},
-std::array<float,2>{0.471293509f, 0.530254304f},
-std::array<float,2>{0.323015392f, 0.475838602f},
-std::array<float,2>{0.66245389f, 0.649825037f},
-std::array<float,2>{0.97016865f, 0.239685684f},
-std::array<float,2>{0.100820802f, 0.997360945f},
-std::array<float,2>{0.21990487f, 0.388226211f},
-std::array<float,2>{0.848393381f, 0.736957788f},
-std::array<float,2>{0.520525098f, 0.172762215f},
-std::array<float,2>{0.405632704f, 0.88447243f},
-std::array<float,2>{0.292316914f, 0.0499958284f},
-std::array<float,2>{0.723403096f, 0.812480092f},
-std::array<float,2>{0.890081406f, 0.370429754f},
-std::array<float,2>{0.0257436745f, 0.596057355f},
-std::array<float,2>{0.0833042711f, 0.202974454f},
-std::array<float,2>{0.955421865f, 0.962597132f},
-std::array<float,2>{0.655966282f, 0.459724188f},
-std::array<float,2>{0.357064813f, 0.683935404f},
-std::array<float,2>{0.462004095f, 0.279840291f},
-std::array<float,2>{0.568302929f, 0.542551637f},
-std::array<float,2>{0.792039037f, 0.114212744f},
-std::array<float,2>{0.17250061f, 0.848403037f},
-std::array<float,2>{0.163518444f, 0.302125365f},
-std::array<float,2>{0.802531481f, 0.505992949f},
-std::array<float,2>{0.588543534f, 0.0823864788f},
-std::array<float,2>{0.438249856f, 0.818455637f},
-std::array<float,2>{0.365005076f, 0.228284344f},
-std::array<float,2>{0.640405297f, 0.980600417f},
-std::array<float,2>{0.937953115f, 0.488965929f},
-std::array<float,2>{0.0674124584f, 0.634480953f},
-std::array<float,2>{0.0148544572f, 0.00149120332f},
-std::array<float,2>{0.891098261f, 0.774393559f},
-std::array<float,2>{0.746919453f, 0.324372083f},
-std::array<float,2>{0.310184568f, 0.577637076f},
-std::array<float,2>{0.38524574f, 0.416104883f},
-std::array<float,2>{0.509635627f, 0.715297639f},
-std::array<float,2>{0.861859024f, 0.129236177f},
-std::array<float,2>{0.246754989f, 0.920277238f},
-std::array<float,2>{0.11240238f, 0.452851623f},
-std::array<float,2>{0.993048489f, 0.660062313f},
-std::array<float,2>{0.673434913f, 0.204335526f},
-std::array<float,2>{0.332229733f, 0.942609429f},
-std::array<float,2>{0.49062866f, 0.109305434f},
-std::array<float,2>{0.606021464f, 0.871357083f},
-std::array<float,2>{0.755795181f, 0.262772977f},
-std::array<float,2>{0.128851101f, 0.558789492f},
-std::array<float,2>{0.1913542f, 0.170537561f},
-std::array<float,2>{0.824867666f, 0.900172651f},
-std::array<float,2>{0.559230387f, 0.394476056f},
-std::array<float,2>{0.421679914f, 0.724057496f},
-std::array<float,2>{0.276294202f, 0.358306587f},
-std::array<float,2>{0.691555321f, 0.615296543f},
-std::array<float,2>{0.932122052f, 0.0371701345f},
-std::array<float,2>{0.0343869962f, 0.785709858f},
-std::array<float,2>{0.0958033949f, 0.351115316f},
-std::array<float,2>{0.974613428f, 0.623210847f},
-std::array<float,2>{0.659158051f, 0.0399680547f},
-std::array<float,2>{0.326180369f, 0.79506129f},
-std::array<float,2>{0.476017326f, 0.157489091f},
-std::array<float,2>{0.613444626f, 0.891474664f},
-std::array<float,2>{0.775692344f, 0.398600161f},
-std::array<float,2>{0.147668555f, 0.727841496f},
-std::array<float,2>{0.217269212f, 0.094329372f},
-std::array<float,2>{0.842817605f, 0.863727033f},
-std::array<float,2>{0.537500441f, 0.251437575f},
-std::array<float,2>{0.432243228f, 0.551593482f},
-std::array<float,2>{0.253642976f, 0.442423761f},
-std::array<float,2>{0.707008779f, 0.670178533f},
-std::array<float,2>{0.913764f, 0.212963924f},
-std::array<float,2>{0.0501419343f, 0.948768258f},
-std::array<float,2>{0.176212132f, 0.406720191f},
-std::array<float,2>{0.79319042f, 0.706601262f},
-std::array<float,2>{0.565227926f, 0.137727216f},
-std::array<float,2>{0.467545241f, 0.914046824f},
-std::array<float,2>{0.35182476f, 0.0124869645f},
-std::array<float,2>{0.64880693f, 0.773103356f},
-std::array<float,2>{0.959449947f, 0.317576289f},
-std::array<float,2>{0.0806064084f, 0.56466043f},
-std::array<float,2>{0.0280967094f, 0.224265054f},
-std::array<float,2>{0.884378433f, 0.969450891f},
-std::array<float,2>{0.719264627f, 0.49648872f},
-std::array<float,2>{0.294177055f, 0.631559789f},
-std::array<float,2>{0.40080452f, 0.309014261f},
-std::array<float,2>{0.51638943f, 0.510185838f},
-std::array<float,2>{0.843846977f, 0.0889532566f},
-std::array<float,2>{0.22274217f, 0.821130514f},
-std::array<float,2>{0.243076906f, 0.269214243f},
-std::array<float,2>{0.864269555f, 0.535893142f},
-std::array<float,2>{0.512419045f, 0.122572683f},
-std::array<float,2>{0.388066411f, 0.855825663f},
-std::array<float,2>{0.307423204f, 0.193522915f},
-std::array<float,2>{0.743257701f, 0.955707967f},
-std::array<float,2>{0.895327032f, 0.464552164f},
-std::array<float,2>{0.0100483736f, 0.672876179f},
-std::array<float,2>{0.0635545477f, 0.0622985363f},
-std::array<float,2>{0.941741049f, 0.79905802f},
-std::array<float,2>{0.633783698f, 0.366795659f},
-std::array<float,2>{0.359383851f, 0.603309333f},
-std::array<float,2>{0.44524613f, 0.380721897f},
-std::array<float,2>{0.592670739f, 0.745844245f},
-std::array<float,2>{0.799934685f, 0.185630485f},
-std::array<float,2>{0.159624591f, 0.878678799f},
-std::array<float,2>{0.03905797f, 0.476774126f},
-std::array<float,2>{0.936223328f, 0.646431327f},
-std::array<float,2>{0.690409958f, 0.24725616f},
-std::array<float,2>{0.279348254f, 0.989837766f},
-std::array<float,2>{0.415771723f, 0.0674550533f},
-std::array<float,2>{0.558172524f, 0.839160562f},
-std::array<float,2>{0.823288918f, 0.294154167f},
-std::array<float,2>{0.19530721f, 0.518948972f},
-std::array<float,2>{0.13112472f, 0.152435631f},
-std::array<float,2>{0.752102911f, 0.923546493f},
-std::array<float,2>{0.604231715f, 0.430680871f},
-std::array<float,2>{0.48778224f, 0.701385736f},
-std::array<float,2>{0.330050886f, 0.342028469f},
-std::array<float,2>{0.679160416f, 0.579948246f},
-std::array<float,2>{0.997383177f, 0.0302646104f},
-std::array<float,2>{0.113794163f, 0.763746142f},
-std::array<float,2>{0.00135834969f, 0.289048225f},
-std::array<float,2>{0.906226873f, 0.524268866f},
-std::array<float,2>{0.736405969f, 0.073560372f},
-std::array<float,2>{0.298769236f, 0.835598946f},
-std::array<float,2>{0.382378191f, 0.237975225f},
-std::array<float,2>{0.503567696f, 0.995179713f},
-std::array<float,2>{0.871455431f, 0.4715437f},
-std::array<float,2>{0.24206005f, 0.653542519f},
-std::array<float,2>{0.165091425f, 0.0169949196f},
-std::array<float,2>{0.806529105f, 0.750755966f},
-std::array<float,2>{0.579600453f, 0.329592019f},
-std::array<float,2>{0.446352571f, 0.58910048f},
-std::array<float,2>{0.372173488f, 0.424841493f},
-std::array<float,2>{0.630515575f, 0.694845259f},
-std::array<float,2>{0.945756257f, 0.140826404f},
-std::array<float,2>{0.0708998144f, 0.93092227f},
-std::array<float,2>{0.197198689f, 0.457017004f},
-std::array<float,2>{0.815116167f, 0.682973444f},
-std::array<float,2>{0.548504949f, 0.19841525f},
-std::array<float,2>{0.409289569f, 0.966575563f},
-std::array<float,2>{0.268341571f, 0.111559503f},
-std::array<float,2>{0.699474037f, 0.846004367f},
-std::array<float,2>{0.924058676f, 0.274546266f},
-std::array<float,2>{0.0418610759f, 0.544857919f},
-std::array<float,2>{0.124211818f, 0.177579582f},
-std::array<float,2>{0.98730725f, 0.890347898f},
-std::array<float,2>{0.679744899f, 0.385236293f},
-std::array<float,2>{0.343199074f, 0.741352439f},
-std::array<float,2>{0.497739583f, 0.3749578f},
-std::array<float,2>{0.599792242f, 0.598312914f},
-std::array<float,2>{0.758740187f, 0.0526593812f},
-std::array<float,2>{0.133552074f, 0.805770874f},
-std::array<float,2>{0.152538493f, 0.323150158f},
-std::array<float,2>{0.768002868f, 0.573249698f},
-std::array<float,2>{0.622993946f, 0.00665909331f},
-std::array<float,2>{0.481488019f, 0.778777778f},
-std::array<float,2>{0.314939469f, 0.128205255f},
-std::array<float,2>{0.668616116f, 0.9169963f},
-std::array<float,2>{0.976624429f, 0.41888079f},
-std::array<float,2>{0.105629086f, 0.713872433f},
-std::array<float,2>{0.0612783954f, 0.0807114244f},
-std::array<float,2>{0.916112423f, 0.814948916f},
-std::array<float,2>{0.711882174f, 0.29903689f},
-std::array<float,2>{0.261137098f, 0.501211405f},
-std::array<float,2>{0.428717464f, 0.484968185f},
-std::array<float,2>{0.546146214f, 0.638842106f},
-std::array<float,2>{0.832317472f, 0.231054813f},
-std::array<float,2>{0.203212872f, 0.978514075f},
-std::array<float,2>{0.0891558304f, 0.395605147f},
-std::array<float,2>{0.962555885f, 0.71991241f},
-std::array<float,2>{0.647247016f, 0.165746436f},
-std::array<float,2>{0.348113686f, 0.905908287f},
-std::array<float,2>{0.454587072f, 0.03357438f},
-std::array<float,2>{0.570702672f, 0.784215033f},
-std::array<float,2>{0.78304249f, 0.352240652f},
-std::array<float,2>{0.182097793f, 0.61191082f},
-std::array<float,2>{0.232877493f, 0.209706366f},
-std::array<float,2>{0.858123422f, 0.940771461f},
-std::array<float,2>{0.52725482f, 0.448328495f},
-std::array<float,2>{0.396017134f, 0.663511932f},
-std::array<float,2>{0.287189692f, 0.261698753f},
-std::array<float,2>{0.72920084f, 0.55548209f},
-std::array<float,2>{0.878232002f, 0.105336636f},
-std::array<float,2>{0.0193883162f, 0.868563712f},
-std::array<float,2>{0.103978299f, 0.270012766f},
-std::array<float,2>{0.98047787f, 0.534971118f},
-std::array<float,2>{0.664130449f, 0.117307045f},
-std::array<float,2>{0.316830933f, 0.85333395f},
-std::array<float,2>{0.478065789f, 0.190822914f},
-std::array<float,2>{0.619883001f, 0.959987938f},
-std::array<float,2>{0.770957828f, 0.464859188f},
-std::array<float,2>{0.151892453f, 0.679375589f},
-std::array<float,2>{0.2072974f, 0.0565169677f},
-std::array<float,2>{0.831718683f, 0.803968191f},
-std::array<float,2>{0.539767683f, 0.360996097f},
-std::array<float,2>{0.424578816f, 0.606651127f},
-std::array<float,2>{0.262084156f, 0.376767457f},
-std::array<float,2>{0.714964449f, 0.749536395f},
-std::array<float,2>{0.920681238f, 0.181612819f},
-std::array<float,2>{0.0567967817f, 0.882514894f},
-std::array<float,2>{0.18465656f, 0.480989486f},
-std::array<float,2>{0.785490453f, 0.641044438f},
-std::array<float,2>{0.574561656f, 0.244235873f},
-std::array<float,2>{0.460132003f, 0.985279083f},
-std::array<float,2>{0.34739542f, 0.0656180605f},
-std::array<float,2>{0.641566336f, 0.841733396f},
-std::array<float,2>{0.96727407f, 0.289829075f},
-std::array<float,2>{0.0911412388f, 0.522884071f},
-std::array<float,2>{0.0214765873f, 0.149869189f},
-std::array<float,2>{0.88183409f, 0.926745415f},
-std::array<float,2>{0.73107475f, 0.435095489f},
-std::array<float,2>{0.284328967f, 0.696779847f},
-std::array<float,2>{0.392355204f, 0.339337915f},
-std::array<float,2>{0.527760327f, 0.583517134f},
-std::array<float,2>{0.854281068f, 0.026344249f},
-std::array<float,2>{0.228766173f, 0.759692907f},
-std::array<float,2>{0.23786512f, 0.346668035f},
-std::array<float,2>{0.869126201f, 0.620676339f},
-std::array<float,2>{0.50737679f, 0.0432225093f},
-std::array<float,2>{0.376835257f, 0.789301813f},
-std::array<float,2>{0.302609175f, 0.161607161f},
-std::array<float,2>{0.740303338f, 0.895169914f},
-std::array<float,2>{0.900618613f, 0.405384541f},
-std::array<float,2>{0.00775135495f, 0.732511759f},
-std::array<float,2>{0.0775041506f, 0.0998565629f},
-std::array<float,2>{0.95003742f, 0.863166749f},
-std::array<float,2>{0.628467977f, 0.256101966f},
-std::array<float,2>{0.367977113f, 0.549465954f},
-std::array<float,2>{0.451679796f, 0.438090444f},
-std::array<float,2>{0.585548997f, 0.665538073f},
-std::array<float,2>{0.809845805f, 0.216963023f},
-std::array<float,2>{0.169200167f, 0.951941848f},
-std::array<float,2>{0.0460373834f, 0.412018567f},
-std::array<float,2>{0.928760052f, 0.708856463f},
-std::array<float,2>{0.695722044f, 0.134733632f},
-std::array<float,2>{0.271478206f, 0.906658411f},
-std::array<float,2>{0.413123876f, 0.00920917001f},
-std::array<float,2>{0.553514481f, 0.766469002f},
-std::array<float,2>{0.820201099f, 0.313088208f},
-std::array<float,2>{0.199489549f, 0.569935501f},
-std::array<float,2>{0.140307218f, 0.219696134f},
-std::array<float,2>{0.762278736f, 0.97591877f},
-std::array<float,2>{0.597578108f, 0.495422184f},
-std::array<float,2>{0.493022501f, 0.625917912f},
-std::array<float,2>{0.336283237f, 0.306231916f},
-std::array<float,2>{0.685785353f, 0.515098214f},
-std::array<float,2>{0.989245355f, 0.0930670276f},
-std::array<float,2>{0.120126568f, 0.826250017f},
-std::array<float,2>{0.0131477248f, 0.32558313f},
-std::array<float,2>{0.893285096f, 0.576239586f},
-std::array<float,2>{0.74924624f, 0.000115847506f},
-std::array<float,2>{0.310939193f, 0.774590313f},
-std::array<float,2>{0.384197414f, 0.13011989f},
-std::array<float,2>{0.511140645f, 0.921755791f},
-std::array<float,2>{0.859774709f, 0.417906642f},
-std::array<float,2>{0.249290258f, 0.716723144f},
-std::array<float,2>{0.161856219f, 0.0835198238f},
-std::array<float,2>{0.802839756f, 0.82030946f},
-std::array<float,2>{0.586925209f, 0.301160783f},
-std::array<float,2>{0.440731108f, 0.507480145f},
-std::array<float,2>{0.36689043f, 0.490071416f},
-std::array<float,2>{0.638622522f, 0.633501232f},
-std::array<float,2>{0.941340387f, 0.227491513f},
-std::array<float,2>{0.0698837414f, 0.981716096f},
-std::array<float,2>{0.188438252f, 0.393013805f},
-std::array<float,2>{0.828070402f, 0.72344178f},
-std::array<float,2>{0.560814083f, 0.171191931f},
-std::array<float,2>{0.419137478f, 0.898670077f},
-std::array<float,2>{0.274772853f, 0.0388252959f},
-std::array<float,2>{0.694278598f, 0.78631866f},
-std::array<float,2>{0.930859864f, 0.3587448f},
-std::array<float,2>{0.0319443643f, 0.617163539f},
-std::array<float,2>{0.110446371f, 0.203715697f},
-std::array<float,2>{0.994369805f, 0.942074955f},
-std::array<float,2>{0.675596952f, 0.451551676f},
-std::array<float,2>{0.33452183f, 0.65916872f},
-std::array<float,2>{0.489949346f, 0.262253374f},
-std::array<float,2>{0.607537329f, 0.560539365f},
-std::array<float,2>{0.75733465f, 0.107956715f},
-std::array<float,2>{0.125934273f, 0.872417331f},
-std::array<float,2>{0.143377721f, 0.284071445f},
-std::array<float,2>{0.779846728f, 0.530558765f},
-std::array<float,2>{0.610587955f, 0.0765610561f},
-std::array<float,2>{0.468898267f, 0.829802811f},
-std::array<float,2>{0.32117793f, 0.238415897f},
-std::array<float,2>{0.66030556f, 0.996448934f},
-std::array<float,2>{0.971475482f, 0.475215107f},
-std::array<float,2>{0.0988954604f, 0.648723125f},
-std::array<float,2>{0.0536832027f, 0.0232147686f},
-std::array<float,2>{0.906709015f, 0.755387723f},
-std::array<float,2>{0.707879961f, 0.333089918f},
-std::array<float,2>{0.256270319f, 0.591078758f},
-std::array<float,2>{0.435124904f, 0.428395718f},
-std::array<float,2>{0.534355462f, 0.68812263f},
-std::array<float,2>{0.839306831f, 0.148102418f},
-std::array<float,2>{0.211982161f, 0.935010552f},
-std::array<float,2>{0.0846189484f, 0.46057865f},
-std::array<float,2>{0.954348743f, 0.685180724f},
-std::array<float,2>{0.653901517f, 0.201363266f},
-std::array<float,2>{0.358591974f, 0.96178484f},
-std::array<float,2>{0.464426607f, 0.114944778f},
-std::array<float,2>{0.568898678f, 0.849560916f},
-std::array<float,2>{0.789822638f, 0.280314177f},
-std::array<float,2>{0.174416676f, 0.54190129f},
-std::array<float,2>{0.221730858f, 0.173806235f},
-std::array<float,2>{0.850310624f, 0.88294816f},
-std::array<float,2>{0.521897733f, 0.387417316f},
-std::array<float,2>{0.402908951f, 0.737401128f},
-std::array<float,2>{0.290769637f, 0.370068699f},
-std::array<float,2>{0.725093484f, 0.597368777f},
-std::array<float,2>{0.887107432f, 0.0496000461f},
-std::array<float,2>{0.0241626278f, 0.811276913f},
-std::array<float,2>{0.0645479485f, 0.36534062f},
-std::array<float,2>{0.944644272f, 0.602008462f},
-std::array<float,2>{0.635057271f, 0.0608638041f},
-std::array<float,2>{0.361585081f, 0.800403178f},
-std::array<float,2>{0.442313969f, 0.187119931f},
-std::array<float,2>{0.591054797f, 0.877007365f},
-std::array<float,2>{0.797437668f, 0.37919718f},
-std::array<float,2>{0.156731963f, 0.744418383f},
-std::array<float,2>{0.244476885f, 0.121929757f},
-std::array<float,2>{0.866576493f, 0.857179403f},
-std::array<float,2>{0.514487326f, 0.268107533f},
-std::array<float,2>{0.389162868f, 0.53619504f},
-std::array<float,2>{0.305449069f, 0.463360846f},
-std::array<float,2>{0.744983435f, 0.672441065f},
-std::array<float,2>{0.896871686f, 0.195113704f},
-std::array<float,2>{0.00792438909f, 0.956296027f},
-std::array<float,2>{0.130497977f, 0.429974288f},
-std::array<float,2>{0.750701249f, 0.702849567f},
-std::array<float,2>{0.601590991f, 0.153578475f},
-std::array<float,2>{0.485643983f, 0.922728777f},
-std::array<float,2>{0.330685139f, 0.0305154976f},
-std::array<float,2>{0.676273465f, 0.765352845f},
-std::array<float,2>{0.999236166f, 0.34338966f},
-std::array<float,2>{0.11705365f, 0.578212738f},
-std::array<float,2>{0.0367465056f, 0.2466086f},
-std::array<float,2>{0.934059322f, 0.988583267f},
-std::array<float,2>{0.688788056f, 0.478148282f},
-std::array<float,2>{0.278883338f, 0.645471454f},
-std::array<float,2>{0.416058272f, 0.293393612f},
-std::array<float,2>{0.55501014f, 0.51771307f},
-std::array<float,2>{0.820694089f, 0.066856727f},
-std::array<float,2>{0.192956254f, 0.838673234f},
-std::array<float,2>{0.21630466f, 0.250812083f},
-std::array<float,2>{0.841350615f, 0.552150428f},
-std::array<float,2>{0.536777914f, 0.0948079079f},
-std::array<float,2>{0.430460602f, 0.864316463f},
-std::array<float,2>{0.251372486f, 0.214403987f},
-std::array<float,2>{0.703875065f, 0.947787642f},
-std::array<float,2>{0.911380172f, 0.441453665f},
-std::array<float,2>{0.0486046113f, 0.671199143f},
-std::array<float,2>{0.0956107378f, 0.0406946875f},
-std::array<float,2>{0.973792672f, 0.796431005f},
-std::array<float,2>{0.656284869f, 0.350357652f},
-std::array<float,2>{0.325681776f, 0.624536574f},
-std::array<float,2>{0.47334215f, 0.400254875f},
-std::array<float,2>{0.615834296f, 0.727146864f},
-std::array<float,2>{0.773500085f, 0.156602934f},
-std::array<float,2>{0.144885913f, 0.89179492f},
-std::array<float,2>{0.0309762899f, 0.497158974f},
-std::array<float,2>{0.885115325f, 0.632107735f},
-std::array<float,2>{0.72224915f, 0.222827986f},
-std::array<float,2>{0.295257092f, 0.970154047f},
-std::array<float,2>{0.398669273f, 0.0883926302f},
-std::array<float,2>{0.519120157f, 0.82202518f},
-std::array<float,2>{0.846618533f, 0.309880614f},
-std::array<float,2>{0.224864975f, 0.511370242f},
-std::array<float,2>{0.178701192f, 0.136791527f},
-std::array<float,2>{0.7954548f, 0.912433326f},
-std::array<float,2>{0.563748956f, 0.407747477f},
-std::array<float,2>{0.464966267f, 0.705927968f},
-std::array<float,2>{0.35492444f, 0.317379981f},
-std::array<float,2>{0.651325703f, 0.565790474f},
-std::array<float,2>{0.957239509f, 0.0136317816f},
-std::array<float,2>{0.0797491223f, 0.772265494f},
-std::array<float,2>{0.0603082888f, 0.299923688f},
-std::array<float,2>{0.914937735f, 0.500873506f},
-std::array<float,2>{0.714707077f, 0.0816253945f},
-std::array<float,2>{0.258042395f, 0.815963209f},
-std::array<float,2>{0.427247047f, 0.231873557f},
-std::array<float,2>{0.543816864f, 0.977514029f},
-std::array<float,2>{0.834663451f, 0.48597303f},
-std::array<float,2>{0.205512956f, 0.640216529f},
-std::array<float,2>{0.154618546f, 0.00756568648f},
-std::array<float,2>{0.766083837f, 0.777683556f},
-std::array<float,2>{0.623763382f, 0.323712826f},
-std::array<float,2>{0.484050959f, 0.572553754f},
-std::array<float,2>{0.313800305f, 0.419722348f},
-std::array<float,2>{0.67088896f, 0.713147759f},
-std::array<float,2>{0.979354203f, 0.127600014f},
-std::array<float,2>{0.107649148f, 0.916459501f},
-std::array<float,2>{0.230598316f, 0.44758904f},
-std::array<float,2>{0.856577337f, 0.66301024f},
-std::array<float,2>{0.524620056f, 0.210211307f},
-std::array<float,2>{0.398293763f, 0.940062881f},
-std::array<float,2>{0.285843939f, 0.103528194f},
-std::array<float,2>{0.728464007f, 0.868051231f},
-std::array<float,2>{0.876586378f, 0.260146886f},
-std::array<float,2>{0.0171855018f, 0.556626618f},
-std::array<float,2>{0.0865390301f, 0.164492905f},
-std::array<float,2>{0.96329689f, 0.904685438f},
-std::array<float,2>{0.645775855f, 0.395325035f},
-std::array<float,2>{0.350800663f, 0.719328344f},
-std::array<float,2>{0.4553518f, 0.352599531f},
-std::array<float,2>{0.574102104f, 0.613228142f},
-std::array<float,2>{0.785020411f, 0.0349534601f},
-std::array<float,2>{0.179702327f, 0.783261776f},
-std::array<float,2>{0.167032629f, 0.328585118f},
-std::array<float,2>{0.806670666f, 0.588777959f},
-std::array<float,2>{0.580141008f, 0.0162051097f},
-std::array<float,2>{0.448408812f, 0.751641572f},
-std::array<float,2>{0.373520136f, 0.1416049f},
-std::array<float,2>{0.632484317f, 0.930007458f},
-std::array<float,2>{0.948399544f, 0.423933595f},
-std::array<float,2>{0.0727412552f, 0.693499446f},
-std::array<float,2>{0.00258933124f, 0.0725140944f},
-std::array<float,2>{0.903271854f, 0.834033072f},
-std::array<float,2>{0.73451066f, 0.287932783f},
-std::array<float,2>{0.299348831f, 0.524540782f},
-std::array<float,2>{0.379455566f, 0.4726004f},
-std::array<float,2>{0.501084089f, 0.652490139f},
-std::array<float,2>{0.87475276f, 0.236394763f},
-std::array<float,2>{0.239121363f, 0.994683325f},
-std::array<float,2>{0.12218678f, 0.385808587f},
-std::array<float,2>{0.985363305f, 0.741118371f},
-std::array<float,2>{0.682354271f, 0.17667447f},
-std::array<float,2>{0.341155827f, 0.889142334f},
-std::array<float,2>{0.499347329f, 0.0509994179f},
-std::array<float,2>{0.598127127f, 0.804772258f},
-std::array<float,2>{0.761294544f, 0.373105347f},
-std::array<float,2>{0.135547534f, 0.599079311f},
-std::array<float,2>{0.197596729f, 0.197495684f},
-std::array<float,2>{0.81359905f, 0.965202749f},
-std::array<float,2>{0.549539089f, 0.45557034f},
-std::array<float,2>{0.40671128f, 0.68212539f},
-std::array<float,2>{0.265772969f, 0.273974031f},
-std::array<float,2>{0.702086806f, 0.54352051f},
-std::array<float,2>{0.923179448f, 0.112675719f},
-std::array<float,2>{0.0405650511f, 0.847303629f},
-std::array<float,2>{0.0934763178f, 0.292182118f},
-std::array<float,2>{0.96629101f, 0.520118654f},
-std::array<float,2>{0.64439559f, 0.0631435215f},
-std::array<float,2>{0.345603377f, 0.842339873f},
-std::array<float,2>{0.457413167f, 0.242746606f},
-std::array<float,2>{0.577346683f, 0.986341655f},
-std::array<float,2>{0.787461102f, 0.483299494f},
-std::array<float,2>{0.185604304f, 0.642786503f},
-std::array<float,2>{0.227878422f, 0.0252929963f},
-std::array<float,2>{0.852843225f, 0.760248184f},
-std::array<float,2>{0.530635476f, 0.335980088f},
-std::array<float,2>{0.394122541f, 0.584855676f},
-std::array<float,2>{0.283105046f, 0.437244862f},
-std::array<float,2>{0.73257184f, 0.698954701f},
-std::array<float,2>{0.87952584f, 0.150969923f},
-std::array<float,2>{0.0228240509f, 0.929157794f},
-std::array<float,2>{0.148600563f, 0.467023492f},
-std::array<float,2>{0.771740139f, 0.677711546f},
-std::array<float,2>{0.617670953f, 0.187764466f},
-std::array<float,2>{0.479179204f, 0.95854044f},
-std::array<float,2>{0.319782108f, 0.119427025f},
-std::array<float,2>{0.66775465f, 0.853858948f},
-std::array<float,2>{0.982781947f, 0.272665709f},
-std::array<float,2>{0.103459999f, 0.533112526f},
-std::array<float,2>{0.0547187291f, 0.182769805f},
-std::array<float,2>{0.918512523f, 0.880627751f},
-std::array<float,2>{0.717376471f, 0.378799319f},
-std::array<float,2>{0.26418364f, 0.747819841f},
-std::array<float,2>{0.422610402f, 0.362513155f},
-std::array<float,2>{0.542217493f, 0.608356714f},
-std::array<float,2>{0.828321755f, 0.0576808825f},
-std::array<float,2>{0.210117593f, 0.801950693f},
-std::array<float,2>{0.201342627f, 0.314517975f},
-std::array<float,2>{0.817505002f, 0.567721605f},
-std::array<float,2>{0.551489711f, 0.0100711714f},
-std::array<float,2>{0.411125481f, 0.768434286f},
-std::array<float,2>{0.273323834f, 0.136521488f},
-std::array<float,2>{0.698296905f, 0.908876956f},
-std::array<float,2>{0.926667631f, 0.412361622f},
-std::array<float,2>{0.0430417918f, 0.710707426f},
-std::array<float,2>{0.117550962f, 0.0917244405f},
-std::array<float,2>{0.991252303f, 0.825119615f},
-std::array<float,2>{0.684017241f, 0.307446927f},
-std::array<float,2>{0.339118719f, 0.512813032f},
-std::array<float,2>{0.495145202f, 0.494025886f},
-std::array<float,2>{0.595566273f, 0.628231406f},
-std::array<float,2>{0.764196217f, 0.222427309f},
-std::array<float,2>{0.137218341f, 0.972690284f},
-std::array<float,2>{0.00570254913f, 0.403241783f},
-std::array<float,2>{0.898658097f, 0.73192811f},
-std::array<float,2>{0.739608407f, 0.162366629f},
-std::array<float,2>{0.304342926f, 0.897921205f},
-std::array<float,2>{0.377436787f, 0.0462153777f},
-std::array<float,2>{0.505460262f, 0.791479707f},
-std::array<float,2>{0.869921446f, 0.345474422f},
-std::array<float,2>{0.234542862f, 0.61825484f},
-std::array<float,2>{0.170913205f, 0.215658709f},
-std::array<float,2>{0.811857522f, 0.950316131f},
-std::array<float,2>{0.582727849f, 0.44034341f},
-std::array<float,2>{0.450428724f, 0.666885078f},
-std::array<float,2>{0.370439559f, 0.254246444f},
-std::array<float,2>{0.626225948f, 0.548452735f},
-std::array<float,2>{0.951371908f, 0.0991195813f},
-std::array<float,2>{0.075349994f, 0.860321164f},
-std::array<float,2>{0.0332219154f, 0.357414663f},
-std::array<float,2>{0.933082819f, 0.614536941f},
-std::array<float,2>{0.692481935f, 0.0369281359f},
-std::array<float,2>{0.276442528f, 0.787343204f},
-std::array<float,2>{0.420579612f, 0.16910702f},
-std::array<float,2>{0.559950173f, 0.901405036f},
-std::array<float,2>{0.82581526f, 0.391952842f},
-std::array<float,2>{0.190355808f, 0.725615084f},
-std::array<float,2>{0.127697766f, 0.107062474f},
-std::array<float,2>{0.754694879f, 0.874689877f},
-std::array<float,2>{0.606587768f, 0.265596896f},
-std::array<float,2>{0.491914183f, 0.562016904f},
-std::array<float,2>{0.333470911f, 0.450446576f},
-std::array<float,2>{0.672846019f, 0.657006621f},
-std::array<float,2>{0.993224263f, 0.205712885f},
-std::array<float,2>{0.111542106f, 0.944094181f},
-std::array<float,2>{0.247646287f, 0.415115416f},
-std::array<float,2>{0.862860382f, 0.717409849f},
-std::array<float,2>{0.508681655f, 0.132758915f},
-std::array<float,2>{0.386445522f, 0.919337153f},
-std::array<float,2>{0.308807939f, 0.00301570515f},
-std::array<float,2>{0.747950673f, 0.777135849f},
-std::array<float,2>{0.892016113f, 0.327363402f},
-std::array<float,2>{0.0136776064f, 0.574370384f},
-std::array<float,2>{0.0666893423f, 0.229217768f},
-std::array<float,2>{0.939367294f, 0.983134449f},
-std::array<float,2>{0.639243662f, 0.490608394f},
-std::array<float,2>{0.363300085f, 0.63582927f},
-std::array<float,2>{0.438699961f, 0.303246051f},
-std::array<float,2>{0.588923812f, 0.503942549f},
-std::array<float,2>{0.80142498f, 0.084995158f},
-std::array<float,2>{0.162387758f, 0.816804886f},
-std::array<float,2>{0.173725486f, 0.278671414f},
-std::array<float,2>{0.791893244f, 0.539078951f},
-std::array<float,2>{0.566475153f, 0.115657508f},
-std::array<float,2>{0.461588383f, 0.850648165f},
-std::array<float,2>{0.355777085f, 0.199366257f},
-std::array<float,2>{0.655121207f, 0.963699162f},
-std::array<float,2>{0.956787944f, 0.458692074f},
-std::array<float,2>{0.0822306052f, 0.687349319f},
-std::array<float,2>{0.0266033355f, 0.0469516255f},
-std::array<float,2>{0.889179528f, 0.810007691f},
-std::array<float,2>{0.723913193f, 0.368441492f},
-std::array<float,2>{0.291364193f, 0.594617486f},
-std::array<float,2>{0.404699653f, 0.388823956f},
-std::array<float,2>{0.520010531f, 0.736294985f},
-std::array<float,2>{0.848962545f, 0.175641552f},
-std::array<float,2>{0.218830585f, 0.88522166f},
-std::array<float,2>{0.0997098759f, 0.473929346f},
-std::array<float,2>{0.969032764f, 0.652308524f},
-std::array<float,2>{0.663885176f, 0.24064377f},
-std::array<float,2>{0.323524296f, 0.999886453f},
-std::array<float,2>{0.472051531f, 0.0756861791f},
-std::array<float,2>{0.612181842f, 0.830296159f},
-std::array<float,2>{0.778089225f, 0.283187658f},
-std::array<float,2>{0.141825855f, 0.527369082f},
-std::array<float,2>{0.214809313f, 0.145385191f},
-std::array<float,2>{0.837399662f, 0.937458515f},
-std::array<float,2>{0.53194052f, 0.4259969f},
-std::array<float,2>{0.435916364f, 0.689855456f},
-std::array<float,2>{0.254224271f, 0.334147215f},
-std::array<float,2>{0.709466636f, 0.593062222f},
-std::array<float,2>{0.908276021f, 0.020519156f},
-std::array<float,2>{0.0519060083f, 0.757065535f},
-std::array<float,2>{0.114755541f, 0.341427803f},
-std::array<float,2>{0.996195495f, 0.581607521f},
-std::array<float,2>{0.678227901f, 0.0284269191f},
-std::array<float,2>{0.329011947f, 0.76365912f},
-std::array<float,2>{0.487113327f, 0.155870765f},
-std::array<float,2>{0.604504168f, 0.924025118f},
-std::array<float,2>{0.75320363f, 0.432583123f},
-std::array<float,2>{0.132754758f, 0.700389862f},
-std::array<float,2>{0.193785354f, 0.0685794652f},
-std::array<float,2>{0.822847664f, 0.836122274f},
-std::array<float,2>{0.557598233f, 0.295655459f},
-std::array<float,2>{0.414354652f, 0.516061425f},
-std::array<float,2>{0.280944258f, 0.479388565f},
-std::array<float,2>{0.691302955f, 0.648096561f},
-std::array<float,2>{0.937263191f, 0.248392642f},
-std::array<float,2>{0.0374116264f, 0.99048841f},
-std::array<float,2>{0.1588462f, 0.382804722f},
-std::array<float,2>{0.799492836f, 0.743359983f},
-std::array<float,2>{0.592991531f, 0.184136212f},
-std::array<float,2>{0.444090396f, 0.8763901f},
-std::array<float,2>{0.361285508f, 0.0601015985f},
-std::array<float,2>{0.63461107f, 0.797929049f},
-std::array<float,2>{0.942734003f, 0.363400072f},
-std::array<float,2>{0.0631630048f, 0.604517162f},
-std::array<float,2>{0.0115687102f, 0.192111462f},
-std::array<float,2>{0.895618498f, 0.954368353f},
-std::array<float,2>{0.742213845f, 0.461251229f},
-std::array<float,2>{0.307626426f, 0.674161196f},
-std::array<float,2>{0.387665898f, 0.267206222f},
-std::array<float,2>{0.513034344f, 0.537814558f},
-std::array<float,2>{0.864128351f, 0.123383977f},
-std::array<float,2>{0.243209049f, 0.858442247f},
-std::array<float,2>{0.223760441f, 0.311756819f},
-std::array<float,2>{0.844743311f, 0.509365141f},
-std::array<float,2>{0.516960323f, 0.0869395286f},
-std::array<float,2>{0.401810467f, 0.822385371f},
-std::array<float,2>{0.293941915f, 0.22535263f},
-std::array<float,2>{0.720415652f, 0.972099841f},
-std::array<float,2>{0.883468151f, 0.499219894f},
-std::array<float,2>{0.0289162397f, 0.629285634f},
-std::array<float,2>{0.0817654207f, 0.0151059609f},
-std::array<float,2>{0.960684717f, 0.770252228f},
-std::array<float,2>{0.649730325f, 0.318577677f},
-std::array<float,2>{0.352788568f, 0.562801898f},
-std::array<float,2>{0.468615502f, 0.409769684f},
-std::array<float,2>{0.566328406f, 0.703359306f},
-std::array<float,2>{0.794356346f, 0.139492109f},
-std::array<float,2>{0.177237064f, 0.910212398f},
-std::array<float,2>{0.0491699874f, 0.44364506f},
-std::array<float,2>{0.913046598f, 0.668351233f},
-std::array<float,2>{0.705250204f, 0.212376386f},
-std::array<float,2>{0.252757877f, 0.945708692f},
-std::array<float,2>{0.43311581f, 0.0958469138f},
-std::array<float,2>{0.538707793f, 0.86680758f},
-std::array<float,2>{0.841877878f, 0.253853083f},
-std::array<float,2>{0.218701839f, 0.553129792f},
-std::array<float,2>{0.147158861f, 0.158626199f},
-std::array<float,2>{0.776951253f, 0.89420253f},
-std::array<float,2>{0.614519f, 0.401390105f},
-std::array<float,2>{0.475187391f, 0.730459034f},
-std::array<float,2>{0.327681929f, 0.348434627f},
-std::array<float,2>{0.659188926f, 0.621971846f},
-std::array<float,2>{0.976488292f, 0.0422731675f},
-std::array<float,2>{0.0968526453f, 0.794323385f},
-std::array<float,2>{0.0185215622f, 0.259005874f},
-std::array<float,2>{0.877729475f, 0.557678103f},
-std::array<float,2>{0.729767382f, 0.101573974f},
-std::array<float,2>{0.288668662f, 0.871052504f},
-std::array<float,2>{0.394705683f, 0.208082438f},
-std::array<float,2>{0.526272953f, 0.93877691f},
-std::array<float,2>{0.858994663f, 0.446996957f},
-std::array<float,2>{0.234357297f, 0.662078917f},
-std::array<float,2>{0.182996884f, 0.0318365134f},
-std::array<float,2>{0.78220278f, 0.781802416f},
-std::array<float,2>{0.572240293f, 0.355090469f},
-std::array<float,2>{0.453134745f, 0.61132133f},
-std::array<float,2>{0.348654389f, 0.397470623f},
-std::array<float,2>{0.648393989f, 0.722344518f},
-std::array<float,2>{0.961358607f, 0.166113198f},
-std::array<float,2>{0.0880353004f, 0.902766168f},
-std::array<float,2>{0.204107225f, 0.486850441f},
-std::array<float,2>{0.833075106f, 0.637384474f},
-std::array<float,2>{0.545067787f, 0.233481705f},
-std::array<float,2>{0.428072959f, 0.979926288f},
-std::array<float,2>{0.26053077f, 0.0785741955f},
-std::array<float,2>{0.712617815f, 0.812712371f},
-std::array<float,2>{0.917276978f, 0.298794836f},
-std::array<float,2>{0.0617781878f, 0.502489686f},
-std::array<float,2>{0.106604725f, 0.125432417f},
-std::array<float,2>{0.977812052f, 0.91510272f},
-std::array<float,2>{0.669738114f, 0.420800626f},
-std::array<float,2>{0.316052556f, 0.71189934f},
-std::array<float,2>{0.480941325f, 0.32199055f},
-std::array<float,2>{0.62191236f, 0.570336461f},
-std::array<float,2>{0.769211709f, 0.00509035494f},
-std::array<float,2>{0.153811336f, 0.780604601f},
-std::array<float,2>{0.134089068f, 0.372356981f},
-std::array<float,2>{0.759296715f, 0.600435853f},
-std::array<float,2>{0.60120827f, 0.0535387993f},
-std::array<float,2>{0.496943146f, 0.807433665f},
-std::array<float,2>{0.342596143f, 0.178203091f},
-std::array<float,2>{0.681157112f, 0.888073862f},
-std::array<float,2>{0.987027705f, 0.384461552f},
-std::array<float,2>{0.123405553f, 0.739587367f},
-std::array<float,2>{0.0426261723f, 0.111067362f},
-std::array<float,2>{0.925189555f, 0.84558934f},
-std::array<float,2>{0.700601935f, 0.275995731f},
-std::array<float,2>{0.26895079f, 0.546053648f},
-std::array<float,2>{0.40879342f, 0.453858376f},
-std::array<float,2>{0.547113299f, 0.680738807f},
-std::array<float,2>{0.815782964f, 0.195405126f},
-std::array<float,2>{0.195540845f, 0.967576087f},
-std::array<float,2>{0.0722500235f, 0.423001677f},
-std::array<float,2>{0.946746945f, 0.69228971f},
-std::array<float,2>{0.629390776f, 0.142904744f},
-std::array<float,2>{0.371733069f, 0.93243736f},
-std::array<float,2>{0.445526987f, 0.019346226f},
-std::array<float,2>{0.578143239f, 0.753534853f},
-std::array<float,2>{0.805450678f, 0.330765247f},
-std::array<float,2>{0.164197847f, 0.58618778f},
-std::array<float,2>{0.241030425f, 0.234379768f},
-std::array<float,2>{0.872891724f, 0.992587745f},
-std::array<float,2>{0.502505302f, 0.469981015f},
-std::array<float,2>{0.381260633f, 0.655337274f},
-std::array<float,2>{0.297145575f, 0.28556326f},
-std::array<float,2>{0.738116562f, 0.526612341f},
-std::array<float,2>{0.90526855f, 0.0712227374f},
-std::array<float,2>{0.000137957904f, 0.833113849f},
-std::array<float,2>{0.0992958546f, 0.282320261f},
-std::array<float,2>{0.971086025f, 0.528253078f},
-std::array<float,2>{0.661094248f, 0.0755113214f},
-std::array<float,2>{0.32058984f, 0.830640733f},
-std::array<float,2>{0.469421148f, 0.240732208f},
-std::array<float,2>{0.611208975f, 0.999404013f},
-std::array<float,2>{0.779559493f, 0.47427389f},
-std::array<float,2>{0.142747372f, 0.651681066f},
-std::array<float,2>{0.212492213f, 0.0210088603f},
-std::array<float,2>{0.83939904f, 0.757399619f},
-std::array<float,2>{0.534897983f, 0.334488571f},
-std::array<float,2>{0.434730977f, 0.59338218f},
-std::array<float,2>{0.256710887f, 0.426346034f},
-std::array<float,2>{0.707363129f, 0.690082848f},
-std::array<float,2>{0.906914413f, 0.144845024f},
-std::array<float,2>{0.0527868085f, 0.936881244f},
-std::array<float,2>{0.174298599f, 0.45819971f},
-std::array<float,2>{0.789297104f, 0.686620176f},
-std::array<float,2>{0.568730533f, 0.199768424f},
-std::array<float,2>{0.4641985f, 0.962892652f},
-std::array<float,2>{0.359220356f, 0.116134211f},
-std::array<float,2>{0.653446376f, 0.851145744f},
-std::array<float,2>{0.954858422f, 0.279208064f},
-std::array<float,2>{0.084077239f, 0.540000081f},
-std::array<float,2>{0.0237323903f, 0.175262049f},
-std::array<float,2>{0.887427509f, 0.885277569f},
-std::array<float,2>{0.725194752f, 0.389276057f},
-std::array<float,2>{0.29014048f, 0.735370994f},
-std::array<float,2>{0.402376771f, 0.368924946f},
-std::array<float,2>{0.522048652f, 0.593990684f},
-std::array<float,2>{0.849980116f, 0.0475869477f},
-std::array<float,2>{0.222516194f, 0.810184062f},
-std::array<float,2>{0.249761537f, 0.327673584f},
-std::array<float,2>{0.859970331f, 0.574771643f},
-std::array<float,2>{0.511589468f, 0.00377620035f},
-std::array<float,2>{0.384361774f, 0.7767663f},
-std::array<float,2>{0.311428279f, 0.132207751f},
-std::array<float,2>{0.749747992f, 0.919715822f},
-std::array<float,2>{0.892826796f, 0.415624321f},
-std::array<float,2>{0.0134434635f, 0.716881335f},
-std::array<float,2>{0.0697167441f, 0.0859079883f},
-std::array<float,2>{0.9406932f, 0.817250371f},
-std::array<float,2>{0.637864769f, 0.302744985f},
-std::array<float,2>{0.366417527f, 0.504396915f},
-std::array<float,2>{0.441352576f, 0.49090758f},
-std::array<float,2>{0.587469697f, 0.636327922f},
-std::array<float,2>{0.803644955f, 0.228739843f},
-std::array<float,2>{0.161556289f, 0.982442558f},
-std::array<float,2>{0.0312627368f, 0.392492294f},
-std::array<float,2>{0.931212902f, 0.726549745f},
-std::array<float,2>{0.69355303f, 0.169602096f},
-std::array<float,2>{0.275297731f, 0.901861072f},
-std::array<float,2>{0.419677943f, 0.0364525504f},
-std::array<float,2>{0.561300337f, 0.78770417f},
-std::array<float,2>{0.827186882f, 0.356670111f},
-std::array<float,2>{0.187966183f, 0.614955485f},
-std::array<float,2>{0.12510474f, 0.20537968f},
-std::array<float,2>{0.757244408f, 0.94342041f},
-std::array<float,2>{0.608070076f, 0.450962275f},
-std::array<float,2>{0.489509553f, 0.656302989f},
-std::array<float,2>{0.334076494f, 0.264960617f},
-std::array<float,2>{0.675179958f, 0.56186384f},
-std::array<float,2>{0.995084584f, 0.1065332f},
-std::array<float,2>{0.111041859f, 0.874187827f},
-std::array<float,2>{0.00727197016f, 0.345050573f},
-std::array<float,2>{0.901337922f, 0.618682146f},
-std::array<float,2>{0.741088331f, 0.0466266014f},
-std::array<float,2>{0.302207768f, 0.791611731f},
-std::array<float,2>{0.376181602f, 0.162937164f},
-std::array<float,2>{0.507094562f, 0.898304462f},
-std::array<float,2>{0.868410647f, 0.402655154f},
-std::array<float,2>{0.237679958f, 0.732064247f},
-std::array<float,2>{0.169675574f, 0.0994714797f},
-std::array<float,2>{0.810123086f, 0.859697998f},
-std::array<float,2>{0.585134923f, 0.254806221f},
-std::array<float,2>{0.451222628f, 0.548048794f},
-std::array<float,2>{0.367351174f, 0.439914107f},
-std::array<float,2>{0.627986252f, 0.666407883f},
-std::array<float,2>{0.949675798f, 0.215161622f},
-std::array<float,2>{0.0779392719f, 0.951081812f},
-std::array<float,2>{0.200109318f, 0.41294986f},
-std::array<float,2>{0.819676638f, 0.710034072f},
-std::array<float,2>{0.552963674f, 0.136165947f},
-std::array<float,2>{0.413898349f, 0.908513784f},
-std::array<float,2>{0.270684063f, 0.010406008f},
-std::array<float,2>{0.695903778f, 0.768046975f},
-std::array<float,2>{0.929242194f, 0.315178216f},
-std::array<float,2>{0.046819739f, 0.568008304f},
-std::array<float,2>{0.120924704f, 0.222141042f},
-std::array<float,2>{0.988454223f, 0.973153055f},
-std::array<float,2>{0.686474442f, 0.493333071f},
-std::array<float,2>{0.336573452f, 0.628418863f},
-std::array<float,2>{0.492418796f, 0.306905478f},
-std::array<float,2>{0.596728563f, 0.513245881f},
-std::array<float,2>{0.761735737f, 0.0909283534f},
-std::array<float,2>{0.140014976f, 0.824491382f},
-std::array<float,2>{0.151404247f, 0.273052901f},
-std::array<float,2>{0.771013856f, 0.53243655f},
-std::array<float,2>{0.619220614f, 0.12009827f},
-std::array<float,2>{0.4776586f, 0.854259133f},
-std::array<float,2>{0.317296118f, 0.188135549f},
-std::array<float,2>{0.664852679f, 0.958092868f},
-std::array<float,2>{0.981404305f, 0.467679352f},
-std::array<float,2>{0.104456954f, 0.676833928f},
-std::array<float,2>{0.0573236383f, 0.0583606288f},
-std::array<float,2>{0.92033869f, 0.802580357f},
-std::array<float,2>{0.715495467f, 0.363226205f},
-std::array<float,2>{0.262553722f, 0.607670844f},
-std::array<float,2>{0.423936069f, 0.378329486f},
-std::array<float,2>{0.539114416f, 0.747381032f},
-std::array<float,2>{0.831185341f, 0.183565572f},
-std::array<float,2>{0.207537264f, 0.880021214f},
-std::array<float,2>{0.0916494951f, 0.482458919f},
-std::array<float,2>{0.967683375f, 0.643360555f},
-std::array<float,2>{0.641078293f, 0.242268756f},
-std::array<float,2>{0.346986324f, 0.986873507f},
-std::array<float,2>{0.460852057f, 0.0625028387f},
-std::array<float,2>{0.574967146f, 0.841879308f},
-std::array<float,2>{0.785963178f, 0.292886943f},
-std::array<float,2>{0.18546018f, 0.519544303f},
-std::array<float,2>{0.229373857f, 0.15056929f},
-std::array<float,2>{0.853996992f, 0.929482102f},
-std::array<float,2>{0.527863026f, 0.436528206f},
-std::array<float,2>{0.391989917f, 0.698485494f},
-std::array<float,2>{0.284754217f, 0.336527944f},
-std::array<float,2>{0.730558991f, 0.584152222f},
-std::array<float,2>{0.881145597f, 0.0244325195f},
-std::array<float,2>{0.0206154753f, 0.760530293f},
-std::array<float,2>{0.0728918388f, 0.330544829f},
-std::array<float,2>{0.949028611f, 0.586720705f},
-std::array<float,2>{0.632110596f, 0.0186713226f},
-std::array<float,2>{0.373902678f, 0.753028452f},
-std::array<float,2>{0.448843598f, 0.143115878f},
-std::array<float,2>{0.580669701f, 0.931648552f},
-std::array<float,2>{0.807241917f, 0.423437774f},
-std::array<float,2>{0.167616531f, 0.691670179f},
-std::array<float,2>{0.238397434f, 0.0707291812f},
-std::array<float,2>{0.874272943f, 0.833675683f},
-std::array<float,2>{0.501480281f, 0.286034673f},
-std::array<float,2>{0.379269838f, 0.527273297f},
-std::array<float,2>{0.299148649f, 0.470590055f},
-std::array<float,2>{0.735056281f, 0.656206548f},
-std::array<float,2>{0.902525425f, 0.235274091f},
-std::array<float,2>{0.00219475012f, 0.993151367f},
-std::array<float,2>{0.135036469f, 0.384172827f},
-std::array<float,2>{0.761103332f, 0.740174949f},
-std::array<float,2>{0.598599494f, 0.178689584f},
-std::array<float,2>{0.499771357f, 0.88846314f},
-std::array<float,2>{0.341773629f, 0.0530528873f},
-std::array<float,2>{0.682092965f, 0.807015717f},
-std::array<float,2>{0.986065209f, 0.37264207f},
-std::array<float,2>{0.122775428f, 0.599645019f},
-std::array<float,2>{0.0401394516f, 0.196176305f},
-std::array<float,2>{0.923423827f, 0.966822028f},
-std::array<float,2>{0.701407135f, 0.453145623f},
-std::array<float,2>{0.266433954f, 0.681348085f},
-std::array<float,2>{0.407172233f, 0.275609761f},
-std::array<float,2>{0.549073577f, 0.546565831f},
-std::array<float,2>{0.814077795f, 0.110673346f},
-std::array<float,2>{0.198104188f, 0.84479785f},
-std::array<float,2>{0.205834448f, 0.297888875f},
-std::array<float,2>{0.834153652f, 0.502118289f},
-std::array<float,2>{0.543261349f, 0.0790065527f},
-std::array<float,2>{0.427187592f, 0.813275754f},
-std::array<float,2>{0.258672059f, 0.234355107f},
-std::array<float,2>{0.713962197f, 0.97999227f},
-std::array<float,2>{0.914300501f, 0.486784816f},
-std::array<float,2>{0.0598176941f, 0.637111723f},
-std::array<float,2>{0.108059436f, 0.00579721667f},
-std::array<float,2>{0.978604913f, 0.781137168f},
-std::array<float,2>{0.67033416f, 0.321695715f},
-std::array<float,2>{0.314048499f, 0.570904911f},
-std::array<float,2>{0.483586043f, 0.419989973f},
-std::array<float,2>{0.623456955f, 0.711339235f},
-std::array<float,2>{0.766525805f, 0.125648618f},
-std::array<float,2>{0.154856026f, 0.915903628f},
-std::array<float,2>{0.0168843679f, 0.446563691f},
-std::array<float,2>{0.876113772f, 0.661590695f},
-std::array<float,2>{0.727552712f, 0.208815366f},
-std::array<float,2>{0.285320908f, 0.939403713f},
-std::array<float,2>{0.397761881f, 0.102189742f},
-std::array<float,2>{0.525323153f, 0.870515645f},
-std::array<float,2>{0.857051134f, 0.259732246f},
-std::array<float,2>{0.231340826f, 0.558155179f},
-std::array<float,2>{0.180512622f, 0.166586623f},
-std::array<float,2>{0.784475565f, 0.902883232f},
-std::array<float,2>{0.573692441f, 0.398055643f},
-std::array<float,2>{0.45589909f, 0.722147226f},
-std::array<float,2>{0.351075202f, 0.354920566f},
-std::array<float,2>{0.646284044f, 0.610384405f},
-std::array<float,2>{0.963582814f, 0.0313684791f},
-std::array<float,2>{0.0863490328f, 0.781640589f},
-std::array<float,2>{0.0481873937f, 0.253087729f},
-std::array<float,2>{0.911836982f, 0.553334713f},
-std::array<float,2>{0.703126013f, 0.0964599177f},
-std::array<float,2>{0.251612961f, 0.866614401f},
-std::array<float,2>{0.430000603f, 0.212869525f},
-std::array<float,2>{0.536469638f, 0.945897043f},
-std::array<float,2>{0.84111625f, 0.444163769f},
-std::array<float,2>{0.216696635f, 0.668471396f},
-std::array<float,2>{0.145085961f, 0.0424915254f},
-std::array<float,2>{0.773997009f, 0.794457316f},
-std::array<float,2>{0.615593016f, 0.347812533f},
-std::array<float,2>{0.472818941f, 0.621118903f},
-std::array<float,2>{0.32596305f, 0.402217954f},
-std::array<float,2>{0.656805515f, 0.729744911f},
-std::array<float,2>{0.974439859f, 0.158927694f},
-std::array<float,2>{0.0951715335f, 0.893964648f},
-std::array<float,2>{0.225323215f, 0.499903023f},
-std::array<float,2>{0.846106589f, 0.629785478f},
-std::array<float,2>{0.519012332f, 0.224730477f},
-std::array<float,2>{0.399210453f, 0.972336471f},
-std::array<float,2>{0.295619935f, 0.0877341554f},
-std::array<float,2>{0.722144127f, 0.822954237f},
-std::array<float,2>{0.885728598f, 0.312258482f},
-std::array<float,2>{0.0307160411f, 0.508896768f},
-std::array<float,2>{0.079118982f, 0.138820529f},
-std::array<float,2>{0.957945645f, 0.910929143f},
-std::array<float,2>{0.650710166f, 0.409212202f},
-std::array<float,2>{0.355430752f, 0.70382458f},
-std::array<float,2>{0.465781897f, 0.31903097f},
-std::array<float,2>{0.564108372f, 0.563367844f},
-std::array<float,2>{0.795230269f, 0.0152710145f},
-std::array<float,2>{0.178130835f, 0.769850731f},
-std::array<float,2>{0.156775609f, 0.363956809f},
-std::array<float,2>{0.796907902f, 0.605210423f},
-std::array<float,2>{0.591751218f, 0.0597187877f},
-std::array<float,2>{0.441557735f, 0.79879564f},
-std::array<float,2>{0.362241209f, 0.183799833f},
-std::array<float,2>{0.635599256f, 0.876909852f},
-std::array<float,2>{0.944913268f, 0.381892681f},
-std::array<float,2>{0.0649482533f, 0.744121552f},
-std::array<float,2>{0.00872380566f, 0.123656891f},
-std::array<float,2>{0.89730835f, 0.859219193f},
-std::array<float,2>{0.744532466f, 0.266814649f},
-std::array<float,2>{0.305105358f, 0.537256479f},
-std::array<float,2>{0.388715714f, 0.461860776f},
-std::array<float,2>{0.513882101f, 0.674352527f},
-std::array<float,2>{0.866961718f, 0.191606417f},
-std::array<float,2>{0.244717166f, 0.954636335f},
-std::array<float,2>{0.11643327f, 0.432038695f},
-std::array<float,2>{0.999832809f, 0.701031864f},
-std::array<float,2>{0.675945282f, 0.155384421f},
-std::array<float,2>{0.33022204f, 0.924457431f},
-std::array<float,2>{0.485914439f, 0.0289428271f},
-std::array<float,2>{0.602207422f, 0.762966394f},
-std::array<float,2>{0.750003934f, 0.341126502f},
-std::array<float,2>{0.130088896f, 0.581499577f},
-std::array<float,2>{0.192545235f, 0.248898447f},
-std::array<float,2>{0.820802689f, 0.991038144f},
-std::array<float,2>{0.55521071f, 0.478518754f},
-std::array<float,2>{0.416779041f, 0.647939682f},
-std::array<float,2>{0.278480023f, 0.295269668f},
-std::array<float,2>{0.689116836f, 0.516402364f},
-std::array<float,2>{0.934143722f, 0.0689701289f},
-std::array<float,2>{0.0361489467f, 0.836766541f},
-std::array<float,2>{0.0825519785f, 0.280775458f},
-std::array<float,2>{0.956219733f, 0.541258037f},
-std::array<float,2>{0.654503226f, 0.11471229f},
-std::array<float,2>{0.356112033f, 0.849024653f},
-std::array<float,2>{0.461387664f, 0.201879188f},
-std::array<float,2>{0.567303479f, 0.96140343f},
-std::array<float,2>{0.791268885f, 0.460106641f},
-std::array<float,2>{0.173283592f, 0.68463546f},
-std::array<float,2>{0.219242498f, 0.0488630645f},
-std::array<float,2>{0.849454522f, 0.811019301f},
-std::array<float,2>{0.520053804f, 0.369409621f},
-std::array<float,2>{0.405032486f, 0.596987069f},
-std::array<float,2>{0.291718841f, 0.386925429f},
-std::array<float,2>{0.724375725f, 0.738027573f},
-std::array<float,2>{0.888959944f, 0.173077837f},
-std::array<float,2>{0.0268959962f, 0.883567214f},
-std::array<float,2>{0.142187923f, 0.474682957f},
-std::array<float,2>{0.777761936f, 0.64900589f},
-std::array<float,2>{0.611667216f, 0.238982856f},
-std::array<float,2>{0.472402841f, 0.99658823f},
-std::array<float,2>{0.323766619f, 0.0769171268f},
-std::array<float,2>{0.663317263f, 0.829509974f},
-std::array<float,2>{0.969328105f, 0.283472985f},
-std::array<float,2>{0.100254834f, 0.530861199f},
-std::array<float,2>{0.0526352152f, 0.147581086f},
-std::array<float,2>{0.908781409f, 0.935281336f},
-std::array<float,2>{0.709831476f, 0.428029448f},
-std::array<float,2>{0.25474894f, 0.687565029f},
-std::array<float,2>{0.436231136f, 0.333891511f},
-std::array<float,2>{0.531620085f, 0.591614127f},
-std::array<float,2>{0.837562144f, 0.0225347541f},
-std::array<float,2>{0.213912725f, 0.75512439f},
-std::array<float,2>{0.189897895f, 0.358887106f},
-std::array<float,2>{0.825666904f, 0.616464913f},
-std::array<float,2>{0.560302258f, 0.0383876152f},
-std::array<float,2>{0.420125991f, 0.786651075f},
-std::array<float,2>{0.277184814f, 0.171518385f},
-std::array<float,2>{0.693114698f, 0.899409592f},
-std::array<float,2>{0.933166564f, 0.393256485f},
-std::array<float,2>{0.0339413621f, 0.722941637f},
-std::array<float,2>{0.111836649f, 0.107908323f},
-std::array<float,2>{0.994033933f, 0.872684419f},
-std::array<float,2>{0.671952128f, 0.261981368f},
-std::array<float,2>{0.333617687f, 0.560041964f},
-std::array<float,2>{0.491475701f, 0.451669425f},
-std::array<float,2>{0.607087553f, 0.65862453f},
-std::array<float,2>{0.753939867f, 0.203335583f},
-std::array<float,2>{0.127338216f, 0.941865265f},
-std::array<float,2>{0.0146427546f, 0.417470098f},
-std::array<float,2>{0.892485976f, 0.715897918f},
-std::array<float,2>{0.747119308f, 0.130380169f},
-std::array<float,2>{0.309472531f, 0.920944512f},
-std::array<float,2>{0.385969818f, 0.000753372442f},
-std::array<float,2>{0.508250713f, 0.774965823f},
-std::array<float,2>{0.862445176f, 0.326003015f},
-std::array<float,2>{0.247433081f, 0.577064693f},
-std::array<float,2>{0.162984043f, 0.226635009f},
-std::array<float,2>{0.800971985f, 0.98212558f},
-std::array<float,2>{0.589793205f, 0.489425808f},
-std::array<float,2>{0.439239234f, 0.633259416f},
-std::array<float,2>{0.364196837f, 0.301430076f},
-std::array<float,2>{0.638893306f, 0.506928444f},
-std::array<float,2>{0.938723981f, 0.0831199586f},
-std::array<float,2>{0.0672657117f, 0.819357753f},
-std::array<float,2>{0.043941319f, 0.312954187f},
-std::array<float,2>{0.925866306f, 0.569706678f},
-std::array<float,2>{0.698822618f, 0.00953568332f},
-std::array<float,2>{0.272747636f, 0.765877545f},
-std::array<float,2>{0.410360932f, 0.133958071f},
-std::array<float,2>{0.551161408f, 0.906914353f},
-std::array<float,2>{0.817923367f, 0.411179632f},
-std::array<float,2>{0.201875091f, 0.708010197f},
-std::array<float,2>{0.136740983f, 0.0934666693f},
-std::array<float,2>{0.7639364f, 0.826730132f},
-std::array<float,2>{0.595086455f, 0.305792183f},
-std::array<float,2>{0.495998055f, 0.515566528f},
-std::array<float,2>{0.339814305f, 0.496002048f},
-std::array<float,2>{0.68443644f, 0.625117362f},
-std::array<float,2>{0.992181659f, 0.218804464f},
-std::array<float,2>{0.117876701f, 0.976087391f},
-std::array<float,2>{0.23507601f, 0.405837655f},
-std::array<float,2>{0.869540095f, 0.733326256f},
-std::array<float,2>{0.505210519f, 0.162074253f},
-std::array<float,2>{0.377739489f, 0.894676447f},
-std::array<float,2>{0.304106832f, 0.0436748974f},
-std::array<float,2>{0.740226567f, 0.789801598f},
-std::array<float,2>{0.898998022f, 0.346106887f},
-std::array<float,2>{0.00505875237f, 0.620266914f},
-std::array<float,2>{0.0758142769f, 0.21740374f},
-std::array<float,2>{0.952142835f, 0.951393187f},
-std::array<float,2>{0.626467168f, 0.437713355f},
-std::array<float,2>{0.370626271f, 0.665408313f},
-std::array<float,2>{0.45092541f, 0.256826401f},
-std::array<float,2>{0.582158625f, 0.549007475f},
-std::array<float,2>{0.812016487f, 0.100274473f},
-std::array<float,2>{0.171412647f, 0.862316489f},
-std::array<float,2>{0.186229408f, 0.289519012f},
-std::array<float,2>{0.787971497f, 0.522957146f},
-std::array<float,2>{0.578020394f, 0.0660671964f},
-std::array<float,2>{0.458005935f, 0.84129411f},
-std::array<float,2>{0.34477821f, 0.245069653f},
-std::array<float,2>{0.643809319f, 0.984858453f},
-std::array<float,2>{0.966565728f, 0.480843008f},
-std::array<float,2>{0.0929313973f, 0.641466677f},
-std::array<float,2>{0.0231451374f, 0.0257923268f},
-std::array<float,2>{0.878958106f, 0.758797765f},
-std::array<float,2>{0.733297586f, 0.339451998f},
-std::array<float,2>{0.282582521f, 0.583230138f},
-std::array<float,2>{0.393632054f, 0.435005814f},
-std::array<float,2>{0.530869722f, 0.69669503f},
-std::array<float,2>{0.853485107f, 0.150332898f},
-std::array<float,2>{0.228384525f, 0.926124096f},
-std::array<float,2>{0.102682255f, 0.465520948f},
-std::array<float,2>{0.983146966f, 0.679017425f},
-std::array<float,2>{0.667185485f, 0.190984339f},
-std::array<float,2>{0.320103675f, 0.960565746f},
-std::array<float,2>{0.478960156f, 0.118078679f},
-std::array<float,2>{0.617984414f, 0.852643192f},
-std::array<float,2>{0.772347808f, 0.270313084f},
-std::array<float,2>{0.149044961f, 0.534243405f},
-std::array<float,2>{0.210602105f, 0.181022078f},
-std::array<float,2>{0.828949928f, 0.881890714f},
-std::array<float,2>{0.542647958f, 0.37599358f},
-std::array<float,2>{0.422174007f, 0.749403715f},
-std::array<float,2>{0.26377517f, 0.360601842f},
-std::array<float,2>{0.717180729f, 0.606974006f},
-std::array<float,2>{0.918382823f, 0.056054011f},
-std::array<float,2>{0.055658184f, 0.804398f},
-std::array<float,2>{0.123632245f, 0.373644859f},
-std::array<float,2>{0.986672401f, 0.599595606f},
-std::array<float,2>{0.681126952f, 0.0516580902f},
-std::array<float,2>{0.3420766f, 0.805381715f},
-std::array<float,2>{0.49634254f, 0.176125467f},
-std::array<float,2>{0.600818217f, 0.889476597f},
-std::array<float,2>{0.759162843f, 0.386657029f},
-std::array<float,2>{0.134525359f, 0.740648031f},
-std::array<float,2>{0.196013942f, 0.1131678f},
-std::array<float,2>{0.816151798f, 0.846850216f},
-std::array<float,2>{0.547763705f, 0.273805857f},
-std::array<float,2>{0.408483386f, 0.543343961f},
-std::array<float,2>{0.269209564f, 0.45548749f},
-std::array<float,2>{0.700709641f, 0.682368457f},
-std::array<float,2>{0.925402462f, 0.198090568f},
-std::array<float,2>{0.0421557352f, 0.965493798f},
-std::array<float,2>{0.164949879f, 0.424378127f},
-std::array<float,2>{0.805133164f, 0.693905354f},
-std::array<float,2>{0.578838289f, 0.142367303f},
-std::array<float,2>{0.445804983f, 0.930631638f},
-std::array<float,2>{0.371220022f, 0.0161029398f},
-std::array<float,2>{0.629720271f, 0.751054466f},
-std::array<float,2>{0.947219491f, 0.328754753f},
-std::array<float,2>{0.0713891014f, 0.58825022f},
-std::array<float,2>{0.0009093681f, 0.237199515f},
-std::array<float,2>{0.904601753f, 0.994520247f},
-std::array<float,2>{0.737483919f, 0.471992642f},
-std::array<float,2>{0.297634453f, 0.652910948f},
-std::array<float,2>{0.381766498f, 0.28741017f},
-std::array<float,2>{0.50210458f, 0.525090456f},
-std::array<float,2>{0.87239188f, 0.0728344843f},
-std::array<float,2>{0.240715817f, 0.834715486f},
-std::array<float,2>{0.233612373f, 0.260493904f},
-std::array<float,2>{0.858421028f, 0.555976033f},
-std::array<float,2>{0.525675774f, 0.104285501f},
-std::array<float,2>{0.39548251f, 0.867370665f},
-std::array<float,2>{0.288512379f, 0.210884333f},
-std::array<float,2>{0.730458558f, 0.939531624f},
-std::array<float,2>{0.877375126f, 0.448237032f},
-std::array<float,2>{0.017920211f, 0.662363946f},
-std::array<float,2>{0.088475585f, 0.034433715f},
-std::array<float,2>{0.961680353f, 0.783986628f},
-std::array<float,2>{0.647534847f, 0.353089929f},
-std::array<float,2>{0.349442363f, 0.612632275f},
-std::array<float,2>{0.453705728f, 0.394974053f},
-std::array<float,2>{0.571443737f, 0.718998015f},
-std::array<float,2>{0.781271219f, 0.164967433f},
-std::array<float,2>{0.183282629f, 0.905111432f},
-std::array<float,2>{0.0623758323f, 0.485517234f},
-std::array<float,2>{0.917873859f, 0.639660418f},
-std::array<float,2>{0.712105632f, 0.231989726f},
-std::array<float,2>{0.260215223f, 0.97665441f},
-std::array<float,2>{0.428382963f, 0.0814715624f},
-std::array<float,2>{0.545450211f, 0.815885723f},
-std::array<float,2>{0.83365351f, 0.300334811f},
-std::array<float,2>{0.204604268f, 0.500221074f},
-std::array<float,2>{0.153644577f, 0.127307907f},
-std::array<float,2>{0.768681586f, 0.916656077f},
-std::array<float,2>{0.621162593f, 0.419139922f},
-std::array<float,2>{0.481254637f, 0.713442445f},
-std::array<float,2>{0.315714538f, 0.323922336f},
-std::array<float,2>{0.668997169f, 0.573151648f},
-std::array<float,2>{0.978089869f, 0.0071561248f},
-std::array<float,2>{0.107208356f, 0.778049171f},
-std::array<float,2>{0.0287019685f, 0.310223162f},
-std::array<float,2>{0.883033037f, 0.511034489f},
-std::array<float,2>{0.719839573f, 0.0882809162f},
-std::array<float,2>{0.293112993f, 0.821416497f},
-std::array<float,2>{0.40209955f, 0.223472089f},
-std::array<float,2>{0.5175547f, 0.970453322f},
-std::array<float,2>{0.845650554f, 0.49758637f},
-std::array<float,2>{0.224339202f, 0.632666528f},
-std::array<float,2>{0.177461684f, 0.0128172487f},
-std::array<float,2>{0.794479728f, 0.771765053f},
-std::array<float,2>{0.565765619f, 0.316535592f},
-std::array<float,2>{0.467790127f, 0.566084981f},
-std::array<float,2>{0.353094012f, 0.407651633f},
-std::array<float,2>{0.649931967f, 0.705189884f},
-std::array<float,2>{0.960275531f, 0.137209937f},
-std::array<float,2>{0.0810585544f, 0.91264528f},
-std::array<float,2>{0.217845246f, 0.442003697f},
-std::array<float,2>{0.842529833f, 0.671661198f},
-std::array<float,2>{0.538091004f, 0.214116082f},
-std::array<float,2>{0.432783276f, 0.947635233f},
-std::array<float,2>{0.252385676f, 0.095643647f},
-std::array<float,2>{0.706022263f, 0.864822924f},
-std::array<float,2>{0.912558734f, 0.2503995f},
-std::array<float,2>{0.0493308343f, 0.552542567f},
-std::array<float,2>{0.0973609835f, 0.157037914f},
-std::array<float,2>{0.975790083f, 0.892306268f},
-std::array<float,2>{0.659730673f, 0.399833798f},
-std::array<float,2>{0.327370107f, 0.726781905f},
-std::array<float,2>{0.475079685f, 0.349684924f},
-std::array<float,2>{0.614813983f, 0.624377131f},
-std::array<float,2>{0.776518881f, 0.0403858908f},
-std::array<float,2>{0.146936938f, 0.796024621f},
-std::array<float,2>{0.132299304f, 0.343234539f},
-std::array<float,2>{0.753819346f, 0.578782499f},
-std::array<float,2>{0.604982793f, 0.0312030371f},
-std::array<float,2>{0.486441493f, 0.764827847f},
-std::array<float,2>{0.328177065f, 0.154018387f},
-std::array<float,2>{0.677972674f, 0.922159255f},
-std::array<float,2>{0.996662855f, 0.430341095f},
-std::array<float,2>{0.114393868f, 0.70258069f},
-std::array<float,2>{0.037711367f, 0.0671074167f},
-std::array<float,2>{0.936660886f, 0.838056982f},
-std::array<float,2>{0.690777123f, 0.293794394f},
-std::array<float,2>{0.280683011f, 0.518178821f},
-std::array<float,2>{0.414641023f, 0.477731168f},
-std::array<float,2>{0.556917608f, 0.644571066f},
-std::array<float,2>{0.822426915f, 0.246481061f},
-std::array<float,2>{0.194220349f, 0.988888204f},
-std::array<float,2>{0.0627550259f, 0.379655123f},
-std::array<float,2>{0.943344653f, 0.744949937f},
-std::array<float,2>{0.634274364f, 0.186840102f},
-std::array<float,2>{0.360514402f, 0.877477646f},
-std::array<float,2>{0.443389148f, 0.0614444092f},
-std::array<float,2>{0.593571246f, 0.799920559f},
-std::array<float,2>{0.799194515f, 0.366086602f},
-std::array<float,2>{0.158205196f, 0.602113366f},
-std::array<float,2>{0.244139463f, 0.19458726f},
-std::array<float,2>{0.863371849f, 0.957004011f},
-std::array<float,2>{0.513655901f, 0.463487387f},
-std::array<float,2>{0.386849791f, 0.671963453f},
-std::array<float,2>{0.30827564f, 0.267965704f},
-std::array<float,2>{0.742798865f, 0.537108421f},
-std::array<float,2>{0.896185517f, 0.121515624f},
-std::array<float,2>{0.0109900236f, 0.856771946f},
-std::array<float,2>{0.109811626f, 0.263358533f},
-std::array<float,2>{0.99592638f, 0.559286475f},
-std::array<float,2>{0.674796999f, 0.108807452f},
-std::array<float,2>{0.335523784f, 0.871923506f},
-std::array<float,2>{0.488599181f, 0.204701692f},
-std::array<float,2>{0.608541131f, 0.943224728f},
-std::array<float,2>{0.756418049f, 0.452309459f},
-std::array<float,2>{0.126198485f, 0.659410119f},
-std::array<float,2>{0.189008206f, 0.0377551764f},
-std::array<float,2>{0.826273918f, 0.785450757f},
-std::array<float,2>{0.562247336f, 0.357696354f},
-std::array<float,2>{0.418082207f, 0.616113365f},
-std::array<float,2>{0.273480952f, 0.393929034f},
-std::array<float,2>{0.694806576f, 0.724351883f},
-std::array<float,2>{0.929985225f, 0.170027599f},
-std::array<float,2>{0.0324885659f, 0.899855375f},
-std::array<float,2>{0.160714433f, 0.488616228f},
-std::array<float,2>{0.803953886f, 0.633811831f},
-std::array<float,2>{0.586232901f, 0.227859467f},
-std::array<float,2>{0.440231293f, 0.981185317f},
-std::array<float,2>{0.365658164f, 0.0828783289f},
-std::array<float,2>{0.637390971f, 0.819061875f},
-std::array<float,2>{0.940411329f, 0.302268565f},
-std::array<float,2>{0.0692029297f, 0.506659567f},
-std::array<float,2>{0.0124059636f, 0.129452601f},
-std::array<float,2>{0.893787742f, 0.920819461f},
-std::array<float,2>{0.748235106f, 0.416888565f},
-std::array<float,2>{0.311730534f, 0.71577388f},
-std::array<float,2>{0.383572102f, 0.325123936f},
-std::array<float,2>{0.510713339f, 0.577459753f},
-std::array<float,2>{0.860720754f, 0.00106217572f},
-std::array<float,2>{0.248503983f, 0.773637056f},
-std::array<float,2>{0.221438259f, 0.370739788f},
-std::array<float,2>{0.850861073f, 0.596662104f},
-std::array<float,2>{0.522482455f, 0.0507242978f},
-std::array<float,2>{0.403699279f, 0.81201148f},
-std::array<float,2>{0.289607495f, 0.172082722f},
-std::array<float,2>{0.725866139f, 0.884198546f},
-std::array<float,2>{0.887788773f, 0.388017118f},
-std::array<float,2>{0.0248274412f, 0.736350715f},
-std::array<float,2>{0.0854090601f, 0.113760419f},
-std::array<float,2>{0.953682661f, 0.848026216f},
-std::array<float,2>{0.652620554f, 0.279394865f},
-std::array<float,2>{0.35751316f, 0.542162478f},
-std::array<float,2>{0.462982148f, 0.459446102f},
-std::array<float,2>{0.569646299f, 0.684382319f},
-std::array<float,2>{0.791012645f, 0.202428862f},
-std::array<float,2>{0.17501004f, 0.962180793f},
-std::array<float,2>{0.0543454774f, 0.429247499f},
-std::array<float,2>{0.907821238f, 0.689009249f},
-std::array<float,2>{0.708245158f, 0.147425726f},
-std::array<float,2>{0.257625401f, 0.934395254f},
-std::array<float,2>{0.433821321f, 0.021981312f},
-std::array<float,2>{0.533727944f, 0.754553854f},
-std::array<float,2>{0.837942183f, 0.332726091f},
-std::array<float,2>{0.21126695f, 0.589944601f},
-std::array<float,2>{0.144299909f, 0.240012467f},
-std::array<float,2>{0.780662239f, 0.997970223f},
-std::array<float,2>{0.609395385f, 0.476391315f},
-std::array<float,2>{0.47030583f, 0.65012002f},
-std::array<float,2>{0.322155386f, 0.284431934f},
-std::array<float,2>{0.661252499f, 0.529663444f},
-std::array<float,2>{0.972193778f, 0.0771689266f},
-std::array<float,2>{0.0981545448f, 0.828289568f},
-std::array<float,2>{0.0197608601f, 0.338854849f},
-std::array<float,2>{0.882043898f, 0.582852662f},
-std::array<float,2>{0.731640637f, 0.0266748201f},
-std::array<float,2>{0.283901542f, 0.758146346f},
-std::array<float,2>{0.391199321f, 0.148605943f},
-std::array<float,2>{0.52877444f, 0.927480161f},
-std::array<float,2>{0.855293632f, 0.434027344f},
-std::array<float,2>{0.229564905f, 0.695731103f},
-std::array<float,2>{0.18455489f, 0.0645757467f},
-std::array<float,2>{0.787101388f, 0.840352118f},
-std::array<float,2>{0.576002777f, 0.290104955f},
-std::array<float,2>{0.459409624f, 0.521869481f},
-std::array<float,2>{0.346644312f, 0.481593937f},
-std::array<float,2>{0.64207989f, 0.642092109f},
-std::array<float,2>{0.967913747f, 0.245831743f},
-std::array<float,2>{0.090652518f, 0.986198843f},
-std::array<float,2>{0.20883964f, 0.375351071f},
-std::array<float,2>{0.830610871f, 0.748664856f},
-std::array<float,2>{0.540232241f, 0.180158272f},
-std::array<float,2>{0.425328195f, 0.880959094f},
-std::array<float,2>{0.262859583f, 0.0555320121f},
-std::array<float,2>{0.715967774f, 0.803650618f},
-std::array<float,2>{0.921874166f, 0.36024496f},
-std::array<float,2>{0.05812281f, 0.605865419f},
-std::array<float,2>{0.104591839f, 0.189766407f},
-std::array<float,2>{0.982281387f, 0.959222078f},
-std::array<float,2>{0.665856659f, 0.466309726f},
-std::array<float,2>{0.317430377f, 0.678088665f},
-std::array<float,2>{0.476711154f, 0.271406054f},
-std::array<float,2>{0.621063292f, 0.533957303f},
-std::array<float,2>{0.769777477f, 0.1181641f},
-std::array<float,2>{0.151224852f, 0.852434516f},
-std::array<float,2>{0.13946645f, 0.305529028f},
-std::array<float,2>{0.763151288f, 0.514365017f},
-std::array<float,2>{0.596556664f, 0.0924849287f},
-std::array<float,2>{0.493492573f, 0.827342689f},
-std::array<float,2>{0.337432384f, 0.220588177f},
-std::array<float,2>{0.687276423f, 0.975160241f},
-std::array<float,2>{0.989956975f, 0.494988263f},
-std::array<float,2>{0.119429789f, 0.626466453f},
-std::array<float,2>{0.0453738533f, 0.00784704275f},
-std::array<float,2>{0.928596497f, 0.767084241f},
-std::array<float,2>{0.697118998f, 0.313676268f},
-std::array<float,2>{0.269994676f, 0.568542778f},
-std::array<float,2>{0.412771553f, 0.411025405f},
-std::array<float,2>{0.554568291f, 0.707906544f},
-std::array<float,2>{0.818952441f, 0.133724779f},
-std::array<float,2>{0.201135918f, 0.907933652f},
-std::array<float,2>{0.076968722f, 0.43856433f},
-std::array<float,2>{0.950896144f, 0.66467303f},
-std::array<float,2>{0.62729764f, 0.218733162f},
-std::array<float,2>{0.369074851f, 0.952646077f},
-std::array<float,2>{0.453082025f, 0.100834563f},
-std::array<float,2>{0.584122539f, 0.86211133f},
-std::array<float,2>{0.809299886f, 0.257186949f},
-std::array<float,2>{0.1689042f, 0.550110996f},
-std::array<float,2>{0.236805171f, 0.160913736f},
-std::array<float,2>{0.867602587f, 0.896325648f},
-std::array<float,2>{0.506134629f, 0.404722214f},
-std::array<float,2>{0.375632107f, 0.734054148f},
-std::array<float,2>{0.301009327f, 0.347226441f},
-std::array<float,2>{0.741591394f, 0.619967997f},
-std::array<float,2>{0.902332366f, 0.0441923626f},
-std::array<float,2>{0.00666887267f, 0.790866315f},
-std::array<float,2>{0.0875362828f, 0.3518112f},
-std::array<float,2>{0.964300573f, 0.611684322f},
-std::array<float,2>{0.645306349f, 0.0339721553f},
-std::array<float,2>{0.35000053f, 0.785141826f},
-std::array<float,2>{0.456263572f, 0.165215433f},
-std::array<float,2>{0.572407365f, 0.905656695f},
-std::array<float,2>{0.783897161f, 0.396193683f},
-std::array<float,2>{0.181205213f, 0.720355213f},
-std::array<float,2>{0.231820092f, 0.104969852f},
-std::array<float,2>{0.85549283f, 0.868956804f},
-std::array<float,2>{0.523850858f, 0.261136055f},
-std::array<float,2>{0.396621555f, 0.554799616f},
-std::array<float,2>{0.28623268f, 0.448970318f},
-std::array<float,2>{0.727279067f, 0.664061368f},
-std::array<float,2>{0.875688255f, 0.209444627f},
-std::array<float,2>{0.0161464904f, 0.941298008f},
-std::array<float,2>{0.155491471f, 0.418081015f},
-std::array<float,2>{0.766719639f, 0.714418113f},
-std::array<float,2>{0.624729991f, 0.128504172f},
-std::array<float,2>{0.482480764f, 0.917677462f},
-std::array<float,2>{0.312778682f, 0.00617789337f},
-std::array<float,2>{0.671183527f, 0.778993011f},
-std::array<float,2>{0.980178118f, 0.322329998f},
-std::array<float,2>{0.108576007f, 0.573819518f},
-std::array<float,2>{0.0588283353f, 0.230677933f},
-std::array<float,2>{0.915045619f, 0.977818191f},
-std::array<float,2>{0.713811576f, 0.484592259f},
-std::array<float,2>{0.259588301f, 0.639586985f},
-std::array<float,2>{0.426137298f, 0.299665898f},
-std::array<float,2>{0.544272363f, 0.501817286f},
-std::array<float,2>{0.835087478f, 0.080329746f},
-std::array<float,2>{0.206144497f, 0.814610243f},
-std::array<float,2>{0.19918856f, 0.275024951f},
-std::array<float,2>{0.813233197f, 0.544150829f},
-std::array<float,2>{0.550592601f, 0.112209246f},
-std::array<float,2>{0.407391071f, 0.846461058f},
-std::array<float,2>{0.267198592f, 0.198940665f},
-std::array<float,2>{0.70242691f, 0.966178596f},
-std::array<float,2>{0.922273517f, 0.456185937f},
-std::array<float,2>{0.0395755507f, 0.683505118f},
-std::array<float,2>{0.121496201f, 0.0519559719f},
-std::array<float,2>{0.984411597f, 0.806251884f},
-std::array<float,2>{0.68272543f, 0.374070644f},
-std::array<float,2>{0.33991012f, 0.598069191f},
-std::array<float,2>{0.498475671f, 0.385706455f},
-std::array<float,2>{0.59918946f, 0.741783917f},
-std::array<float,2>{0.760251999f, 0.176873699f},
-std::array<float,2>{0.136149943f, 0.889935553f},
-std::array<float,2>{0.00367712346f, 0.470775753f},
-std::array<float,2>{0.90361768f, 0.653995752f},
-std::array<float,2>{0.735485852f, 0.23774901f},
-std::array<float,2>{0.300696224f, 0.995894492f},
-std::array<float,2>{0.380426168f, 0.0739533752f},
-std::array<float,2>{0.500534654f, 0.835073531f},
-std::array<float,2>{0.873610675f, 0.288366169f},
-std::array<float,2>{0.239595965f, 0.523684919f},
-std::array<float,2>{0.166197702f, 0.141242385f},
-std::array<float,2>{0.808534861f, 0.931181073f},
-std::array<float,2>{0.581432581f, 0.42566523f},
-std::array<float,2>{0.447794914f, 0.694728792f},
-std::array<float,2>{0.374169439f, 0.329243839f},
-std::array<float,2>{0.631306648f, 0.589788795f},
-std::array<float,2>{0.947905183f, 0.0174700115f},
-std::array<float,2>{0.0741126537f, 0.750199556f},
-std::array<float,2>{0.0353744924f, 0.294890612f},
-std::array<float,2>{0.935276151f, 0.519088507f},
-std::array<float,2>{0.687938392f, 0.0681398138f},
-std::array<float,2>{0.277716607f, 0.839394331f},
-std::array<float,2>{0.417890817f, 0.247644678f},
-std::array<float,2>{0.555753171f, 0.98948133f},
-std::array<float,2>{0.821777642f, 0.477248639f},
-std::array<float,2>{0.191476628f, 0.645574331f},
-std::array<float,2>{0.129345551f, 0.0294462815f},
-std::array<float,2>{0.751336873f, 0.764393687f},
-std::array<float,2>{0.602778137f, 0.342362225f},
-std::array<float,2>{0.485129744f, 0.57912004f},
-std::array<float,2>{0.331304371f, 0.431299388f},
-std::array<float,2>{0.676933885f, 0.701982558f},
-std::array<float,2>{0.998324931f, 0.153051972f},
-std::array<float,2>{0.115699045f, 0.923005402f},
-std::array<float,2>{0.245197281f, 0.464283079f},
-std::array<float,2>{0.865786374f, 0.673353851f},
-std::array<float,2>{0.51501745f, 0.194282249f},
-std::array<float,2>{0.390483558f, 0.95542258f},
-std::array<float,2>{0.306111664f, 0.122164927f},
-std::array<float,2>{0.745583415f, 0.856318831f},
-std::array<float,2>{0.897630215f, 0.269036114f},
-std::array<float,2>{0.00891050883f, 0.535467565f},
-std::array<float,2>{0.0655539185f, 0.186170757f},
-std::array<float,2>{0.944315434f, 0.878192842f},
-std::array<float,2>{0.636692166f, 0.380008221f},
-std::array<float,2>{0.362500042f, 0.745185792f},
-std::array<float,2>{0.442491263f, 0.366370797f},
-std::array<float,2>{0.59003979f, 0.602783859f},
-std::array<float,2>{0.798090756f, 0.0618061572f},
-std::array<float,2>{0.15755035f, 0.799334288f},
-std::array<float,2>{0.179077923f, 0.318258166f},
-std::array<float,2>{0.796390831f, 0.565097034f},
-std::array<float,2>{0.562982202f, 0.0121931061f},
-std::array<float,2>{0.46629259f, 0.772895932f},
-std::array<float,2>{0.354428053f, 0.138379321f},
-std::array<float,2>{0.65204978f, 0.913091719f},
-std::array<float,2>{0.958428383f, 0.407058299f},
-std::array<float,2>{0.0786322653f, 0.706504405f},
-std::array<float,2>{0.0300111696f, 0.0895057917f},
-std::array<float,2>{0.886636257f, 0.820728958f},
-std::array<float,2>{0.720815957f, 0.309124082f},
-std::array<float,2>{0.296823829f, 0.510422349f},
-std::array<float,2>{0.400143296f, 0.496791959f},
-std::array<float,2>{0.518461943f, 0.631013811f},
-std::array<float,2>{0.847604692f, 0.223890349f},
-std::array<float,2>{0.225653067f, 0.969157219f},
-std::array<float,2>{0.0946561247f, 0.398948818f},
-std::array<float,2>{0.973333716f, 0.72813201f},
-std::array<float,2>{0.657579899f, 0.158032492f},
-std::array<float,2>{0.324617296f, 0.891097665f},
-std::array<float,2>{0.474351108f, 0.0391565636f},
-std::array<float,2>{0.616908014f, 0.795783162f},
-std::array<float,2>{0.774918914f, 0.350923896f},
-std::array<float,2>{0.14630942f, 0.623677969f},
-std::array<float,2>{0.215643272f, 0.213750064f},
-std::array<float,2>{0.840810716f, 0.948405504f},
-std::array<float,2>{0.535857558f, 0.443193793f},
-std::array<float,2>{0.431506097f, 0.670890212f},
-std::array<float,2>{0.25031966f, 0.251555324f},
-std::array<float,2>{0.704354465f, 0.550995708f},
-std::array<float,2>{0.9101879f, 0.0937601402f},
-std::array<float,2>{0.0472032465f, 0.864178896f},
-std::array<float,2>{0.0683300495f, 0.304479629f},
-std::array<float,2>{0.938259602f, 0.504978538f},
-std::array<float,2>{0.6398229f, 0.0846309066f},
-std::array<float,2>{0.364475012f, 0.817627192f},
-std::array<float,2>{0.437939048f, 0.230294272f},
-std::array<float,2>{0.587975144f, 0.984258115f},
-std::array<float,2>{0.801907241f, 0.492158532f},
-std::array<float,2>{0.163724527f, 0.635566711f},
-std::array<float,2>{0.246153682f, 0.00259082788f},
-std::array<float,2>{0.861570418f, 0.776100934f},
-std::array<float,2>{0.509015918f, 0.326432079f},
-std::array<float,2>{0.385655493f, 0.575734854f},
-std::array<float,2>{0.309832543f, 0.415008605f},
-std::array<float,2>{0.746314943f, 0.71812731f},
-std::array<float,2>{0.891587794f, 0.131568536f},
-std::array<float,2>{0.0153040932f, 0.918227494f},
-std::array<float,2>{0.128341749f, 0.449661076f},
-std::array<float,2>{0.754918754f, 0.658005834f},
-std::array<float,2>{0.605902851f, 0.206284732f},
-std::array<float,2>{0.490908742f, 0.944661856f},
-std::array<float,2>{0.332944483f, 0.106261238f},
-std::array<float,2>{0.67321378f, 0.873411119f},
-std::array<float,2>{0.99244535f, 0.264310658f},
-std::array<float,2>{0.113064244f, 0.560692072f},
-std::array<float,2>{0.0348341055f, 0.168343037f},
-std::array<float,2>{0.932360649f, 0.901147187f},
-std::array<float,2>{0.692018986f, 0.391161084f},
-std::array<float,2>{0.275668293f, 0.725319564f},
-std::array<float,2>{0.42116785f, 0.355881333f},
-std::array<float,2>{0.558879912f, 0.614029408f},
-std::array<float,2>{0.8244856f, 0.0356265493f},
-std::array<float,2>{0.1908205f, 0.788711131f},
-std::array<float,2>{0.213120505f, 0.335206598f},
-std::array<float,2>{0.836622953f, 0.59209609f},
-std::array<float,2>{0.532817781f, 0.0203137491f},
-std::array<float,2>{0.437486917f, 0.755951107f},
-std::array<float,2>{0.255032152f, 0.145818248f},
-std::array<float,2>{0.710473895f, 0.935740829f},
-std::array<float,2>{0.9093045f, 0.427156955f},
-std::array<float,2>{0.0511042401f, 0.690495372f},
-std::array<float,2>{0.101247132f, 0.074621506f},
-std::array<float,2>{0.970253348f, 0.83133471f},
-std::array<float,2>{0.663041651f, 0.281335533f},
-std::array<float,2>{0.322660685f, 0.528700888f},
-std::array<float,2>{0.470924586f, 0.472804189f},
-std::array<float,2>{0.613143086f, 0.65095675f},
-std::array<float,2>{0.779258549f, 0.241403967f},
-std::array<float,2>{0.141486675f, 0.998593152f},
-std::array<float,2>{0.0261968803f, 0.39039579f},
-std::array<float,2>{0.890469372f, 0.735310793f},
-std::array<float,2>{0.722808242f, 0.174597904f},
-std::array<float,2>{0.292953998f, 0.886543989f},
-std::array<float,2>{0.406240404f, 0.0486707278f},
-std::array<float,2>{0.521030843f, 0.808838725f},
-std::array<float,2>{0.847664654f, 0.368013144f},
-std::array<float,2>{0.220540464f, 0.595656276f},
-std::array<float,2>{0.171887413f, 0.200594619f},
-std::array<float,2>{0.792668104f, 0.964247227f},
-std::array<float,2>{0.56777668f, 0.457295984f},
-std::array<float,2>{0.462784111f, 0.686489701f},
-std::array<float,2>{0.356852174f, 0.277428955f},
-std::array<float,2>{0.655600905f, 0.540077627f},
-std::array<float,2>{0.95602715f, 0.116876319f},
-std::array<float,2>{0.0835976005f, 0.850242794f},
-std::array<float,2>{0.0560134612f, 0.361967593f},
-std::array<float,2>{0.919370413f, 0.609340131f},
-std::array<float,2>{0.718127251f, 0.0573775694f},
-std::array<float,2>{0.264679641f, 0.801060617f},
-std::array<float,2>{0.42288512f, 0.182062864f},
-std::array<float,2>{0.541928768f, 0.879139185f},
-std::array<float,2>{0.829494536f, 0.377142787f},
-std::array<float,2>{0.209211498f, 0.746235728f},
-std::array<float,2>{0.149762645f, 0.120790958f},
-std::array<float,2>{0.772912264f, 0.854984283f},
-std::array<float,2>{0.618210733f, 0.272231519f},
-std::array<float,2>{0.479858726f, 0.53140825f},
-std::array<float,2>{0.318801641f, 0.467936158f},
-std::array<float,2>{0.666876733f, 0.676661313f},
-std::array<float,2>{0.984294236f, 0.188511744f},
-std::array<float,2>{0.102085419f, 0.957538724f},
-std::array<float,2>{0.226807728f, 0.436058074f},
-std::array<float,2>{0.851651669f, 0.697516561f},
-std::array<float,2>{0.529948592f, 0.152321622f},
-std::array<float,2>{0.393271416f, 0.928519011f},
-std::array<float,2>{0.282009572f, 0.0243465193f},
-std::array<float,2>{0.733719707f, 0.761314273f},
-std::array<float,2>{0.880373478f, 0.337400436f},
-std::array<float,2>{0.021670498f, 0.585777164f},
-std::array<float,2>{0.0919868276f, 0.243878782f},
-std::array<float,2>{0.965646625f, 0.987406135f},
-std::array<float,2>{0.642938733f, 0.483424336f},
-std::array<float,2>{0.344269007f, 0.644520104f},
-std::array<float,2>{0.458831429f, 0.291718155f},
-std::array<float,2>{0.576827526f, 0.520713985f},
-std::array<float,2>{0.788766325f, 0.0644135401f},
-std::array<float,2>{0.186932683f, 0.84300065f},
-std::array<float,2>{0.170258269f, 0.254932433f},
-std::array<float,2>{0.811155319f, 0.54782939f},
-std::array<float,2>{0.583360851f, 0.0977429375f},
-std::array<float,2>{0.45017463f, 0.86118418f},
-std::array<float,2>{0.369973838f, 0.216006756f},
-std::array<float,2>{0.625845551f, 0.950103879f},
-std::array<float,2>{0.952799976f, 0.44093594f},
-std::array<float,2>{0.0746384859f, 0.667766392f},
-std::array<float,2>{0.00451692054f, 0.0452497602f},
-std::array<float,2>{0.899916112f, 0.7925542f},
-std::array<float,2>{0.738798022f, 0.344305813f},
-std::array<float,2>{0.303116113f, 0.617916465f},
-std::array<float,2>{0.378615558f, 0.403873742f},
-std::array<float,2>{0.504803777f, 0.730931997f},
-std::array<float,2>{0.870491743f, 0.163473129f},
-std::array<float,2>{0.235834241f, 0.89699775f},
-std::array<float,2>{0.118537784f, 0.4929699f},
-std::array<float,2>{0.990857065f, 0.62698245f},
-std::array<float,2>{0.684755087f, 0.221329272f},
-std::array<float,2>{0.338228434f, 0.973723233f},
-std::array<float,2>{0.495025158f, 0.0906713232f},
-std::array<float,2>{0.594301343f, 0.825431347f},
-std::array<float,2>{0.765134275f, 0.307872891f},
-std::array<float,2>{0.138526052f, 0.511970282f},
-std::array<float,2>{0.202590108f, 0.134820655f},
-std::array<float,2>{0.816958547f, 0.909378231f},
-std::array<float,2>{0.55210799f, 0.413850635f},
-std::array<float,2>{0.411652923f, 0.709697545f},
-std::array<float,2>{0.272221982f, 0.315787017f},
-std::array<float,2>{0.697548509f, 0.567291021f},
-std::array<float,2>{0.927479625f, 0.0107933674f},
-std::array<float,2>{0.0446959808f, 0.769335449f},
-std::array<float,2>{0.106435902f, 0.320622116f},
-std::array<float,2>{0.977421105f, 0.571670473f},
-std::array<float,2>{0.667978883f, 0.00401863549f},
-std::array<float,2>{0.315311849f, 0.779727519f},
-std::array<float,2>{0.482171208f, 0.125996158f},
-std::array<float,2>{0.622322738f, 0.914737701f},
-std::array<float,2>{0.768469512f, 0.421375781f},
-std::array<float,2>{0.153022617f, 0.712319911f},
-std::array<float,2>{0.203984544f, 0.0800327584f},
-std::array<float,2>{0.832848728f, 0.81391257f},
-std::array<float,2>{0.546811283f, 0.297286689f},
-std::array<float,2>{0.429536462f, 0.503834546f},
-std::array<float,2>{0.261507541f, 0.488102436f},
-std::array<float,2>{0.711016417f, 0.638454795f},
-std::array<float,2>{0.916894138f, 0.233273342f},
-std::array<float,2>{0.0605505593f, 0.978844702f},
-std::array<float,2>{0.18216075f, 0.397417217f},
-std::array<float,2>{0.782539845f, 0.721430957f},
-std::array<float,2>{0.571201563f, 0.167322323f},
-std::array<float,2>{0.454783976f, 0.904215217f},
-std::array<float,2>{0.348474264f, 0.0331372246f},
-std::array<float,2>{0.64672941f, 0.783150792f},
-std::array<float,2>{0.96233952f, 0.354441255f},
-std::array<float,2>{0.0895370394f, 0.61000824f},
-std::array<float,2>{0.018741617f, 0.207301542f},
-std::array<float,2>{0.878584087f, 0.937773287f},
-std::array<float,2>{0.728856683f, 0.445872664f},
-std::array<float,2>{0.288061321f, 0.660336852f},
-std::array<float,2>{0.395681262f, 0.258112282f},
-std::array<float,2>{0.526653647f, 0.556924164f},
-std::array<float,2>{0.85751307f, 0.10294944f},
-std::array<float,2>{0.233106092f, 0.869798183f},
-std::array<float,2>{0.241446674f, 0.286236048f},
-std::array<float,2>{0.871627271f, 0.525704145f},
-std::array<float,2>{0.503404558f, 0.0720249861f},
-std::array<float,2>{0.382215112f, 0.832216203f},
-std::array<float,2>{0.298132569f, 0.236116111f},
-std::array<float,2>{0.737291515f, 0.993789554f},
-std::array<float,2>{0.905387878f, 0.469318658f},
-std::array<float,2>{0.00154211686f, 0.654682934f},
-std::array<float,2>{0.0704198107f, 0.0178568941f},
-std::array<float,2>{0.946091235f, 0.752742708f},
-std::array<float,2>{0.630294383f, 0.331595778f},
-std::array<float,2>{0.372879148f, 0.587503016f},
-std::array<float,2>{0.447103202f, 0.42211768f},
-std::array<float,2>{0.579560518f, 0.69300735f},
-std::array<float,2>{0.806127429f, 0.144514501f},
-std::array<float,2>{0.165976182f, 0.932802618f},
-std::array<float,2>{0.0412818938f, 0.454714119f},
-std::array<float,2>{0.924752235f, 0.679809511f},
-std::array<float,2>{0.699757278f, 0.197260007f},
-std::array<float,2>{0.267959952f, 0.968012393f},
-std::array<float,2>{0.409833282f, 0.110329129f},
-std::array<float,2>{0.548131764f, 0.844389558f},
-std::array<float,2>{0.814930022f, 0.277221143f},
-std::array<float,2>{0.196765244f, 0.545490324f},
-std::array<float,2>{0.132820323f, 0.179322675f},
-std::array<float,2>{0.758274794f, 0.887510955f},
-std::array<float,2>{0.600151002f, 0.383605301f},
-std::array<float,2>{0.497540742f, 0.738578439f},
-std::array<float,2>{0.343680233f, 0.371164829f},
-std::array<float,2>{0.680631697f, 0.601303279f},
-std::array<float,2>{0.988139033f, 0.0540938675f},
-std::array<float,2>{0.124987595f, 0.808459938f},
-std::array<float,2>{0.0102560297f, 0.26656732f},
-std::array<float,2>{0.89492768f, 0.538751185f},
-std::array<float,2>{0.743935525f, 0.124120668f},
-std::array<float,2>{0.307108998f, 0.857855141f},
-std::array<float,2>{0.388334751f, 0.192486256f},
-std::array<float,2>{0.511848986f, 0.953925371f},
-std::array<float,2>{0.864912391f, 0.462031066f},
-std::array<float,2>{0.242383227f, 0.675435185f},
-std::array<float,2>{0.160023376f, 0.0590858459f},
-std::array<float,2>{0.800370455f, 0.797435522f},
-std::array<float,2>{0.591807783f, 0.364851207f},
-std::array<float,2>{0.444483638f, 0.603889465f},
-std::array<float,2>{0.360189319f, 0.381569922f},
-std::array<float,2>{0.632894576f, 0.74302268f},
-std::array<float,2>{0.941947281f, 0.18465513f},
-std::array<float,2>{0.0642290637f, 0.875757873f},
-std::array<float,2>{0.194764942f, 0.4798581f},
-std::array<float,2>{0.824170828f, 0.64695555f},
-std::array<float,2>{0.557729959f, 0.249776915f},
-std::array<float,2>{0.415231615f, 0.991855562f},
-std::array<float,2>{0.279928148f, 0.0701638386f},
-std::array<float,2>{0.689544082f, 0.837075949f},
-std::array<float,2>{0.935846567f, 0.296716779f},
-std::array<float,2>{0.0382641219f, 0.517120481f},
-std::array<float,2>{0.11376524f, 0.154845014f},
-std::array<float,2>{0.997885466f, 0.925257146f},
-std::array<float,2>{0.679252744f, 0.433355331f},
-std::array<float,2>{0.329355299f, 0.699926972f},
-std::array<float,2>{0.487971544f, 0.34005031f},
-std::array<float,2>{0.603673458f, 0.580525696f},
-std::array<float,2>{0.752904475f, 0.0282685608f},
-std::array<float,2>{0.131444454f, 0.761991262f},
-std::array<float,2>{0.148164794f, 0.349415869f},
-std::array<float,2>{0.776289403f, 0.622289717f},
-std::array<float,2>{0.614065588f, 0.0414274186f},
-std::array<float,2>{0.476277322f, 0.793179452f},
-std::array<float,2>{0.326989383f, 0.159648567f},
-std::array<float,2>{0.65849793f, 0.893015325f},
-std::array<float,2>{0.975311816f, 0.400687069f},
-std::array<float,2>{0.0963179916f, 0.729058802f},
-std::array<float,2>{0.0506980419f, 0.0967937708f},
-std::array<float,2>{0.913411856f, 0.865744174f},
-std::array<float,2>{0.70636487f, 0.252753615f},
-std::array<float,2>{0.252932847f, 0.553730547f},
-std::array<float,2>{0.431858152f, 0.4443582f},
-std::array<float,2>{0.537776053f, 0.669808388f},
-std::array<float,2>{0.843559682f, 0.21188502f},
-std::array<float,2>{0.217705831f, 0.946647823f},
-std::array<float,2>{0.080377236f, 0.408540875f},
-std::array<float,2>{0.959867895f, 0.704222679f},
-std::array<float,2>{0.649223685f, 0.139924049f},
-std::array<float,2>{0.352286071f, 0.911435187f},
-std::array<float,2>{0.467242926f, 0.0137257213f},
-std::array<float,2>{0.564478338f, 0.771320343f},
-std::array<float,2>{0.793549776f, 0.319372505f},
-std::array<float,2>{0.176401749f, 0.564315081f},
-std::array<float,2>{0.223316371f, 0.226002097f},
-std::array<float,2>{0.844436646f, 0.970923424f},
-std::array<float,2>{0.515826225f, 0.498063475f},
-std::array<float,2>{0.401304543f, 0.630824685f},
-std::array<float,2>{0.294704884f, 0.311272949f},
-std::array<float,2>{0.719158769f, 0.507915974f},
-std::array<float,2>{0.884260297f, 0.0866418406f},
-std::array<float,2>{0.0274180751f, 0.823871732f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.257698834f, 0.0810835436f},
-std::array<float,2>{0.57777369f, 0.876812577f},
-std::array<float,2>{0.0216652825f, 0.716640651f},
-std::array<float,2>{0.788590133f, 0.377525419f},
-std::array<float,2>{0.144815251f, 0.258717537f},
-std::array<float,2>{0.918824136f, 0.53243643f},
-std::array<float,2>{0.457152009f, 0.762149274f},
-std::array<float,2>{0.67891258f, 0.152458891f},
-std::array<float,2>{0.37502715f, 0.476332963f},
-std::array<float,2>{0.698721051f, 0.645753443f},
-std::array<float,2>{0.22997728f, 0.972314298f},
-std::array<float,2>{0.945471466f, 0.0402075462f},
-std::array<float,2>{0.120430626f, 0.223567978f},
-std::array<float,2>{0.872665405f, 0.874307275f},
-std::array<float,2>{0.314671844f, 0.588697672f},
-std::array<float,2>{0.507442415f, 0.320512235f},
-std::array<float,2>{0.495431155f, 0.162397847f},
-std::array<float,2>{0.632306218f, 0.801249504f},
-std::array<float,2>{0.18261987f, 0.510814607f},
-std::array<float,2>{0.89362663f, 0.291982293f},
-std::array<float,2>{0.0325334333f, 0.424714744f},
-std::array<float,2>{0.765940905f, 0.737762332f},
-std::array<float,2>{0.281714529f, 0.936961055f},
-std::array<float,2>{0.619662106f, 0.123546109f},
-std::array<float,2>{0.357182354f, 0.360834152f},
-std::array<float,2>{0.554461062f, 0.612423897f},
-std::array<float,2>{0.0867171213f, 0.8373788f},
-std::array<float,2>{0.838127315f, 0.212014094f},
-std::array<float,2>{0.191180378f, 0.00221440452f},
-std::array<float,2>{0.969389081f, 0.949701607f},
-std::array<float,2>{0.41279307f, 0.662154555f},
-std::array<float,2>{0.726991832f, 0.46719417f},
-std::array<float,2>{0.422669858f, 0.0528971888f},
-std::array<float,2>{0.74058491f, 0.990656257f},
-std::array<float,2>{0.213183969f, 0.634321392f},
-std::array<float,2>{0.993048131f, 0.485063851f},
-std::array<float,2>{0.0770019144f, 0.336090207f},
-std::array<float,2>{0.815396667f, 0.57687223f},
-std::array<float,2>{0.368422121f, 0.846945703f},
-std::array<float,2>{0.543099701f, 0.243575722f},
-std::array<float,2>{0.301552892f, 0.399335921f},
-std::array<float,2>{0.595784247f, 0.693381011f},
-std::array<float,2>{0.0493390113f, 0.898716271f},
-std::array<float,2>{0.756957114f, 0.0757197142f},
-std::array<float,2>{0.168183774f, 0.134334281f},
-std::array<float,2>{0.884932041f, 0.767426074f},
-std::array<float,2>{0.480876744f, 0.555901527f},
-std::array<float,2>{0.642603815f, 0.279188722f},
-std::array<float,2>{0.335352451f, 0.201177746f},
-std::array<float,2>{0.52461493f, 0.815630078f},
-std::array<float,2>{0.0960539356f, 0.608947039f},
-std::array<float,2>{0.854663193f, 0.355587006f},
-std::array<float,2>{0.241895288f, 0.444250017f},
-std::array<float,2>{0.964181244f, 0.682357788f},
-std::array<float,2>{0.39695245f, 0.961913943f},
-std::array<float,2>{0.708129346f, 0.0262126531f},
-std::array<float,2>{0.43810001f, 0.304564238f},
-std::array<float,2>{0.658800244f, 0.522941351f},
-std::array<float,2>{0.137037858f, 0.795560241f},
-std::array<float,2>{0.930028617f, 0.177588299f},
-std::array<float,2>{0.0114734983f, 0.0977993682f},
-std::array<float,2>{0.80138272f, 0.909130991f},
-std::array<float,2>{0.275955141f, 0.721040666f},
-std::array<float,2>{0.582336307f, 0.413545668f},
-std::array<float,2>{0.359835982f, 0.0180296451f},
-std::array<float,2>{0.535133064f, 0.953916848f},
-std::array<float,2>{0.0631405637f, 0.679412186f},
-std::array<float,2>{0.82718569f, 0.450154424f},
-std::array<float,2>{0.207563818f, 0.350034028f},
-std::array<float,2>{0.98827213f, 0.599756241f},
-std::array<float,2>{0.436044753f, 0.822188318f},
-std::array<float,2>{0.746609032f, 0.194151834f},
-std::array<float,2>{0.473010778f, 0.414215863f},
-std::array<float,2>{0.652270794f, 0.728679538f},
-std::array<float,2>{0.161830232f, 0.918423295f},
-std::array<float,2>{0.875273526f, 0.107224226f},
-std::array<float,2>{0.0559811592f, 0.180899367f},
-std::array<float,2>{0.76075542f, 0.784800947f},
-std::array<float,2>{0.310694516f, 0.524563551f},
-std::array<float,2>{0.608627975f, 0.310631216f},
-std::array<float,2>{0.399387747f, 0.237872735f},
-std::array<float,2>{0.717129588f, 0.856497288f},
-std::array<float,2>{0.248575106f, 0.567477942f},
-std::array<float,2>{0.955468714f, 0.329269677f},
-std::array<float,2>{0.103354625f, 0.495628566f},
-std::array<float,2>{0.843999028f, 0.632563889f},
-std::array<float,2>{0.336834252f, 0.995348215f},
-std::array<float,2>{0.517864943f, 0.0587141961f},
-std::array<float,2>{0.272085875f, 0.27147609f},
-std::array<float,2>{0.59205091f, 0.55302912f},
-std::array<float,2>{0.00130377733f, 0.779438257f},
-std::array<float,2>{0.807762742f, 0.125050917f},
-std::array<float,2>{0.126060531f, 0.0633391812f},
-std::array<float,2>{0.928807616f, 0.892798185f},
-std::array<float,2>{0.45215252f, 0.695413232f},
-std::array<float,2>{0.66452837f, 0.397039562f},
-std::array<float,2>{0.463582546f, 0.114333324f},
-std::array<float,2>{0.684146523f, 0.922233164f},
-std::array<float,2>{0.156025738f, 0.746533334f},
-std::array<float,2>{0.907736659f, 0.435277432f},
-std::array<float,2>{0.0267203897f, 0.286755472f},
-std::array<float,2>{0.791246176f, 0.503775299f},
-std::array<float,2>{0.26536724f, 0.807943463f},
-std::array<float,2>{0.570307374f, 0.168857798f},
-std::array<float,2>{0.326332539f, 0.458260149f},
-std::array<float,2>{0.512591958f, 0.671824276f},
-std::array<float,2>{0.111512922f, 0.941571057f},
-std::array<float,2>{0.866312444f, 0.00801226124f},
-std::array<float,2>{0.220622241f, 0.204470262f},
-std::array<float,2>{0.940512836f, 0.833397508f},
-std::array<float,2>{0.389136761f, 0.619442344f},
-std::array<float,2>{0.687919319f, 0.367282927f},
-std::array<float,2>{0.29219985f, 0.147408724f},
-std::array<float,2>{0.613791645f, 0.75595969f},
-std::array<float,2>{0.0424643494f, 0.544892371f},
-std::array<float,2>{0.775728583f, 0.251152664f},
-std::array<float,2>{0.179260164f, 0.388590366f},
-std::array<float,2>{0.902613163f, 0.706592262f},
-std::array<float,2>{0.488589346f, 0.883951485f},
-std::array<float,2>{0.633017957f, 0.0909942091f},
-std::array<float,2>{0.421120495f, 0.314714819f},
-std::array<float,2>{0.723407745f, 0.584081471f},
-std::array<float,2>{0.200390011f, 0.862568378f},
-std::array<float,2>{0.98097986f, 0.232799366f},
-std::array<float,2>{0.0789767578f, 0.0379397683f},
-std::array<float,2>{0.834164679f, 0.983282328f},
-std::array<float,2>{0.351242542f, 0.655818641f},
-std::array<float,2>{0.561180174f, 0.476856351f},
-std::array<float,2>{0.320001692f, 0.103528552f},
-std::array<float,2>{0.503507733f, 0.917197227f},
-std::array<float,2>{0.124294691f, 0.733799577f},
-std::array<float,2>{0.87029618f, 0.421389967f},
-std::array<float,2>{0.230737895f, 0.307892621f},
-std::array<float,2>{0.949748755f, 0.529359579f},
-std::array<float,2>{0.37978074f, 0.786744833f},
-std::array<float,2>{0.700314283f, 0.184714064f},
-std::array<float,2>{0.456921339f, 0.445696473f},
-std::array<float,2>{0.675590932f, 0.674648464f},
-std::array<float,2>{0.14282237f, 0.960648656f},
-std::array<float,2>{0.916957736f, 0.021410292f},
-std::array<float,2>{0.0166718569f, 0.191137582f},
-std::array<float,2>{0.784832299f, 0.827195942f},
-std::array<float,2>{0.253815383f, 0.595806181f},
-std::array<float,2>{0.573568702f, 0.345484406f},
-std::array<float,2>{0.407452792f, 0.129333705f},
-std::array<float,2>{0.731505632f, 0.774583042f},
-std::array<float,2>{0.192223996f, 0.548435211f},
-std::array<float,2>{0.973406136f, 0.269085795f},
-std::array<float,2>{0.0909350961f, 0.393363237f},
-std::array<float,2>{0.842809856f, 0.702497959f},
-std::array<float,2>{0.35488075f, 0.895787477f},
-std::array<float,2>{0.548016369f, 0.0673501119f},
-std::array<float,2>{0.287557214f, 0.335738748f},
-std::array<float,2>{0.623801589f, 0.564896047f},
-std::array<float,2>{0.0366123728f, 0.851914227f},
-std::array<float,2>{0.770809293f, 0.239808798f},
-std::array<float,2>{0.185954377f, 0.0573593155f},
-std::array<float,2>{0.895219624f, 0.999606848f},
-std::array<float,2>{0.499072194f, 0.62572366f},
-std::array<float,2>{0.628262639f, 0.499893457f},
-std::array<float,2>{0.47912702f, 0.012546476f},
-std::array<float,2>{0.644986391f, 0.940436602f},
-std::array<float,2>{0.167165354f, 0.664539576f},
-std::array<float,2>{0.890564263f, 0.454765409f},
-std::array<float,2>{0.0519316457f, 0.373436183f},
-std::array<float,2>{0.752355099f, 0.623732507f},
-std::array<float,2>{0.298128337f, 0.830693007f},
-std::array<float,2>{0.600524783f, 0.209237054f},
-std::array<float,2>{0.371729136f, 0.432098895f},
-std::array<float,2>{0.539616287f, 0.745213687f},
-std::array<float,2>{0.0740260929f, 0.926596105f},
-std::array<float,2>{0.8167786f, 0.110619858f},
-std::array<float,2>{0.214884102f, 0.166796803f},
-std::array<float,2>{0.99612999f, 0.809640646f},
-std::array<float,2>{0.429519892f, 0.507514596f},
-std::array<float,2>{0.738128364f, 0.282939464f},
-std::array<float,2>{0.27870512f, 0.228048936f},
-std::array<float,2>{0.581997335f, 0.866346478f},
-std::array<float,2>{0.0136935962f, 0.57863605f},
-std::array<float,2>{0.799922645f, 0.319602489f},
-std::array<float,2>{0.133374482f, 0.480524719f},
-std::array<float,2>{0.935667038f, 0.651357174f},
-std::array<float,2>{0.442361861f, 0.979466796f},
-std::array<float,2>{0.662075222f, 0.0341184847f},
-std::array<float,2>{0.392860621f, 0.255123019f},
-std::array<float,2>{0.70400542f, 0.542311609f},
-std::array<float,2>{0.234403059f, 0.750678718f},
-std::array<float,2>{0.968381226f, 0.144048184f},
-std::array<float,2>{0.101241261f, 0.088739574f},
-std::array<float,2>{0.857700706f, 0.887331784f},
-std::array<float,2>{0.329108566f, 0.707032204f},
-std::array<float,2>{0.528458238f, 0.386578441f},
-std::array<float,2>{0.307492346f, 0.0443335176f},
-std::array<float,2>{0.605409265f, 0.975966752f},
-std::array<float,2>{0.0606168173f, 0.641327381f},
-std::array<float,2>{0.765330613f, 0.468858421f},
-std::array<float,2>{0.158704847f, 0.324828863f},
-std::array<float,2>{0.879784107f, 0.590684056f},
-std::array<float,2>{0.47146076f, 0.870535612f},
-std::array<float,2>{0.656133711f, 0.221673429f},
-std::array<float,2>{0.429916739f, 0.381607533f},
-std::array<float,2>{0.744337916f, 0.71135205f},
-std::array<float,2>{0.204457566f, 0.881309032f},
-std::array<float,2>{0.988311052f, 0.0842835084f},
-std::array<float,2>{0.0678048655f, 0.150835186f},
-std::array<float,2>{0.821804404f, 0.759235263f},
-std::array<float,2>{0.364821106f, 0.53782326f},
-std::array<float,2>{0.538093805f, 0.262848407f},
-std::array<float,2>{0.446432114f, 0.218521833f},
-std::array<float,2>{0.668416083f, 0.84190768f},
-std::array<float,2>{0.129377201f, 0.614157319f},
-std::array<float,2>{0.924309433f, 0.36511749f},
-std::array<float,2>{0.00779471966f, 0.46272859f},
-std::array<float,2>{0.811797619f, 0.657769024f},
-std::array<float,2>{0.267888367f, 0.946827948f},
-std::array<float,2>{0.586206615f, 0.00552367186f},
-std::array<float,2>{0.342506289f, 0.295446604f},
-std::array<float,2>{0.520972967f, 0.512662709f},
-std::array<float,2>{0.106316835f, 0.800580323f},
-std::array<float,2>{0.847852468f, 0.159487575f},
-std::array<float,2>{0.24316895f, 0.117494546f},
-std::array<float,2>{0.959378421f, 0.930723548f},
-std::array<float,2>{0.403514594f, 0.741003394f},
-std::array<float,2>{0.713858426f, 0.429071993f},
-std::array<float,2>{0.384275705f, 0.0707450211f},
-std::array<float,2>{0.693431079f, 0.904327214f},
-std::array<float,2>{0.224501863f, 0.690274775f},
-std::array<float,2>{0.943226218f, 0.404258221f},
-std::array<float,2>{0.115085602f, 0.274312556f},
-std::array<float,2>{0.862210572f, 0.559108555f},
-std::array<float,2>{0.320913315f, 0.770197988f},
-std::array<float,2>{0.508633018f, 0.138945282f},
-std::array<float,2>{0.260670871f, 0.491350144f},
-std::array<float,2>{0.565820575f, 0.63684988f},
-std::array<float,2>{0.0289807115f, 0.984481275f},
-std::array<float,2>{0.79677242f, 0.0472519025f},
-std::array<float,2>{0.150892496f, 0.246583506f},
-std::array<float,2>{0.912220418f, 0.85061878f},
-std::array<float,2>{0.467133641f, 0.572902858f},
-std::array<float,2>{0.679906547f, 0.340361983f},
-std::array<float,2>{0.347231865f, 0.175006226f},
-std::array<float,2>{0.557944477f, 0.792247057f},
-std::array<float,2>{0.0856494382f, 0.516196489f},
-std::array<float,2>{0.830105603f, 0.299390823f},
-std::array<float,2>{0.197146669f, 0.408666432f},
-std::array<float,2>{0.97725141f, 0.726310492f},
-std::array<float,2>{0.415458351f, 0.912695408f},
-std::array<float,2>{0.721508265f, 0.0962608308f},
-std::array<float,2>{0.485088766f, 0.354497939f},
-std::array<float,2>{0.638030231f, 0.605461895f},
-std::array<float,2>{0.172649667f, 0.818687499f},
-std::array<float,2>{0.898661971f, 0.19689931f},
-std::array<float,2>{0.0464832187f, 0.0295116976f},
-std::array<float,2>{0.778309345f, 0.968574286f},
-std::array<float,2>{0.296372592f, 0.686530769f},
-std::array<float,2>{0.612459064f, 0.440797836f},
-std::array<float,2>{0.28471753f, 0.122898042f},
-std::array<float,2>{0.617638886f, 0.93418628f},
-std::array<float,2>{0.0341284126f, 0.734543085f},
-std::array<float,2>{0.767805636f, 0.422361016f},
-std::array<float,2>{0.181290567f, 0.290384948f},
-std::array<float,2>{0.891445816f, 0.50919795f},
-std::array<float,2>{0.493574858f, 0.803776979f},
-std::array<float,2>{0.630048752f, 0.162044376f},
-std::array<float,2>{0.410776913f, 0.465747982f},
-std::array<float,2>{0.729039967f, 0.661309063f},
-std::array<float,2>{0.18889536f, 0.951743901f},
-std::array<float,2>{0.972254097f, 0.000993327121f},
-std::array<float,2>{0.0881066471f, 0.214198232f},
-std::array<float,2>{0.837507963f, 0.839186847f},
-std::array<float,2>{0.359332949f, 0.609660983f},
-std::array<float,2>{0.552557707f, 0.361571252f},
-std::array<float,2>{0.46013242f, 0.155897737f},
-std::array<float,2>{0.676937759f, 0.764646888f},
-std::array<float,2>{0.148066625f, 0.533667743f},
-std::array<float,2>{0.921385765f, 0.261283845f},
-std::array<float,2>{0.0211423282f, 0.375707328f},
-std::array<float,2>{0.78591913f, 0.718212724f},
-std::array<float,2>{0.255727679f, 0.877504647f},
-std::array<float,2>{0.575061798f, 0.0797180608f},
-std::array<float,2>{0.313187987f, 0.323116511f},
-std::array<float,2>{0.504604518f, 0.587590873f},
-std::array<float,2>{0.117676295f, 0.87280947f},
-std::array<float,2>{0.873329401f, 0.224619046f},
-std::array<float,2>{0.228338107f, 0.0417080075f},
-std::array<float,2>{0.948015392f, 0.970654011f},
-std::array<float,2>{0.3784872f, 0.64740485f},
-std::array<float,2>{0.697233438f, 0.473508865f},
-std::array<float,2>{0.396149546f, 0.024422273f},
-std::array<float,2>{0.709381044f, 0.964571595f},
-std::array<float,2>{0.238799974f, 0.680277109f},
-std::array<float,2>{0.962512255f, 0.442607582f},
-std::array<float,2>{0.0938127711f, 0.359295994f},
-std::array<float,2>{0.852515638f, 0.606410861f},
-std::array<float,2>{0.332277119f, 0.81308347f},
-std::array<float,2>{0.525654316f, 0.200912535f},
-std::array<float,2>{0.273587257f, 0.410972297f},
-std::array<float,2>{0.585125089f, 0.719413877f},
-std::array<float,2>{0.0083478624f, 0.90711832f},
-std::array<float,2>{0.803303897f, 0.100796066f},
-std::array<float,2>{0.139563218f, 0.177965984f},
-std::array<float,2>{0.932839811f, 0.79383105f},
-std::array<float,2>{0.440504849f, 0.520842791f},
-std::array<float,2>{0.656836748f, 0.302410245f},
-std::array<float,2>{0.369628906f, 0.244693562f},
-std::array<float,2>{0.546818733f, 0.84482789f},
-std::array<float,2>{0.0749880597f, 0.576117992f},
-std::array<float,2>{0.812941611f, 0.338066071f},
-std::array<float,2>{0.211020082f, 0.4881154f},
-std::array<float,2>{0.99438113f, 0.635721564f},
-std::array<float,2>{0.424625009f, 0.989009917f},
-std::array<float,2>{0.739013493f, 0.0518122241f},
-std::array<float,2>{0.484105438f, 0.280713767f},
-std::array<float,2>{0.641930759f, 0.558010221f},
-std::array<float,2>{0.170022711f, 0.768572688f},
-std::array<float,2>{0.884705842f, 0.135541394f},
-std::array<float,2>{0.0477261543f, 0.0766773224f},
-std::array<float,2>{0.754812539f, 0.901662767f},
-std::array<float,2>{0.303787827f, 0.693349183f},
-std::array<float,2>{0.594662189f, 0.400679529f},
-std::array<float,2>{0.339224339f, 0.0617507622f},
-std::array<float,2>{0.516988695f, 0.99393177f},
-std::array<float,2>{0.104199588f, 0.629424751f},
-std::array<float,2>{0.847087979f, 0.493099719f},
-std::array<float,2>{0.246619284f, 0.331189483f},
-std::array<float,2>{0.954312325f, 0.568792582f},
-std::array<float,2>{0.400861174f, 0.858230233f},
-std::array<float,2>{0.714853287f, 0.235954359f},
-std::array<float,2>{0.449434549f, 0.396268755f},
-std::array<float,2>{0.667278588f, 0.697874963f},
-std::array<float,2>{0.127491683f, 0.89196378f},
-std::array<float,2>{0.926046491f, 0.0646831617f},
-std::array<float,2>{0.00360660371f, 0.127009884f},
-std::array<float,2>{0.805732787f, 0.777473867f},
-std::array<float,2>{0.269674122f, 0.551919103f},
-std::array<float,2>{0.590005875f, 0.273386538f},
-std::array<float,2>{0.433772415f, 0.191983476f},
-std::array<float,2>{0.748867989f, 0.82265234f},
-std::array<float,2>{0.209706753f, 0.598788023f},
-std::array<float,2>{0.986091018f, 0.348773539f},
-std::array<float,2>{0.0662726834f, 0.451506048f},
-std::array<float,2>{0.825802743f, 0.677341521f},
-std::array<float,2>{0.361949176f, 0.956709087f},
-std::array<float,2>{0.531933606f, 0.0175184198f},
-std::array<float,2>{0.310460865f, 0.309887558f},
-std::array<float,2>{0.60615176f, 0.526386619f},
-std::array<float,2>{0.0570108928f, 0.781614661f},
-std::array<float,2>{0.759152591f, 0.182040945f},
-std::array<float,2>{0.162517056f, 0.108903185f},
-std::array<float,2>{0.877938151f, 0.921395719f},
-std::array<float,2>{0.474612504f, 0.728103638f},
-std::array<float,2>{0.650167525f, 0.417819679f},
-std::array<float,2>{0.492164969f, 0.0931253806f},
-std::array<float,2>{0.636606634f, 0.88565886f},
-std::array<float,2>{0.175972968f, 0.705044568f},
-std::array<float,2>{0.905823827f, 0.388777465f},
-std::array<float,2>{0.040262185f, 0.253600001f},
-std::array<float,2>{0.773503423f, 0.545347571f},
-std::array<float,2>{0.290226519f, 0.755266011f},
-std::array<float,2>{0.616692603f, 0.1448645f},
-std::array<float,2>{0.348642021f, 0.478719652f},
-std::array<float,2>{0.559387863f, 0.653996885f},
-std::array<float,2>{0.0808561891f, 0.982293129f},
-std::array<float,2>{0.832121074f, 0.0365461335f},
-std::array<float,2>{0.20251748f, 0.230780974f},
-std::array<float,2>{0.982890606f, 0.859925091f},
-std::array<float,2>{0.418706834f, 0.583174586f},
-std::array<float,2>{0.724779665f, 0.312920094f},
-std::array<float,2>{0.262328118f, 0.170646846f},
-std::array<float,2>{0.567323983f, 0.805773854f},
-std::array<float,2>{0.0243058167f, 0.500486553f},
-std::array<float,2>{0.789161503f, 0.288113594f},
-std::array<float,2>{0.153164282f, 0.43584469f},
-std::array<float,2>{0.909564972f, 0.748066664f},
-std::array<float,2>{0.462385476f, 0.925236225f},
-std::array<float,2>{0.68729794f, 0.115672082f},
-std::array<float,2>{0.388575554f, 0.369806439f},
-std::array<float,2>{0.689663708f, 0.619021893f},
-std::array<float,2>{0.221197948f, 0.835235953f},
-std::array<float,2>{0.937932789f, 0.205367655f},
-std::array<float,2>{0.111265995f, 0.0104369484f},
-std::array<float,2>{0.864300311f, 0.943625212f},
-std::array<float,2>{0.326023698f, 0.668696642f},
-std::array<float,2>{0.515558779f, 0.459817946f},
-std::array<float,2>{0.352009952f, 0.0691854805f},
-std::array<float,2>{0.548889995f, 0.897502244f},
-std::array<float,2>{0.0930891111f, 0.700695574f},
-std::array<float,2>{0.840231121f, 0.391712189f},
-std::array<float,2>{0.193742633f, 0.267133117f},
-std::array<float,2>{0.9753232f, 0.549506426f},
-std::array<float,2>{0.409199059f, 0.77660954f},
-std::array<float,2>{0.734184444f, 0.131734878f},
-std::array<float,2>{0.497212201f, 0.497317076f},
-std::array<float,2>{0.62605226f, 0.627602339f},
-std::array<float,2>{0.185309291f, 0.996492207f},
-std::array<float,2>{0.897031665f, 0.054881569f},
-std::array<float,2>{0.0376217738f, 0.240877748f},
-std::array<float,2>{0.772024751f, 0.853645861f},
-std::array<float,2>{0.285321802f, 0.564200163f},
-std::array<float,2>{0.622166276f, 0.333196074f},
-std::array<float,2>{0.381871074f, 0.185549155f},
-std::array<float,2>{0.703025699f, 0.78901428f},
-std::array<float,2>{0.234343335f, 0.527419329f},
-std::array<float,2>{0.952734232f, 0.304718047f},
-std::array<float,2>{0.122134365f, 0.418489397f},
-std::array<float,2>{0.867353499f, 0.731010616f},
-std::array<float,2>{0.317945689f, 0.914264679f},
-std::array<float,2>{0.501876295f, 0.103121877f},
-std::array<float,2>{0.250407636f, 0.347398579f},
-std::array<float,2>{0.571728349f, 0.595368207f},
-std::array<float,2>{0.0179768503f, 0.825880945f},
-std::array<float,2>{0.782216012f, 0.187984794f},
-std::array<float,2>{0.142307341f, 0.0221480355f},
-std::array<float,2>{0.914069235f, 0.957744718f},
-std::array<float,2>{0.453272551f, 0.672160983f},
-std::array<float,2>{0.672986507f, 0.44818598f},
-std::array<float,2>{0.443434834f, 0.0322328396f},
-std::array<float,2>{0.662161112f, 0.978345692f},
-std::array<float,2>{0.134937897f, 0.650198877f},
-std::array<float,2>{0.934193432f, 0.482939601f},
-std::array<float,2>{0.0117227323f, 0.317026973f},
-std::array<float,2>{0.798239112f, 0.580156922f},
-std::array<float,2>{0.279700488f, 0.865176558f},
-std::array<float,2>{0.578454792f, 0.228723481f},
-std::array<float,2>{0.330656677f, 0.384701282f},
-std::array<float,2>{0.529317617f, 0.709949791f},
-std::array<float,2>{0.098528035f, 0.890033841f},
-std::array<float,2>{0.856375873f, 0.0867960155f},
-std::array<float,2>{0.236764506f, 0.14141418f},
-std::array<float,2>{0.96634078f, 0.753524959f},
-std::array<float,2>{0.391347617f, 0.540444613f},
-std::array<float,2>{0.706959486f, 0.256235749f},
-std::array<float,2>{0.299910903f, 0.208331019f},
-std::array<float,2>{0.597672045f, 0.829281986f},
-std::array<float,2>{0.0541895442f, 0.621708393f},
-std::array<float,2>{0.75161314f, 0.372729421f},
-std::array<float,2>{0.164179981f, 0.45685935f},
-std::array<float,2>{0.8882429f, 0.667622328f},
-std::array<float,2>{0.476781636f, 0.938409567f},
-std::array<float,2>{0.646628559f, 0.015485351f},
-std::array<float,2>{0.42592144f, 0.284036487f},
-std::array<float,2>{0.735505402f, 0.505301237f},
-std::array<float,2>{0.217770115f, 0.812192798f},
-std::array<float,2>{0.999188006f, 0.165810153f},
-std::array<float,2>{0.0719463155f, 0.112973899f},
-std::array<float,2>{0.820220113f, 0.929381371f},
-std::array<float,2>{0.374040246f, 0.742556989f},
-std::array<float,2>{0.542481661f, 0.430126756f},
-std::array<float,2>{0.26636222f, 0.00631191116f},
-std::array<float,2>{0.588159025f, 0.947985709f},
-std::array<float,2>{0.00531257084f, 0.659357071f},
-std::array<float,2>{0.809759319f, 0.463519931f},
-std::array<float,2>{0.1323497f, 0.366596282f},
-std::array<float,2>{0.922463417f, 0.615255892f},
-std::array<float,2>{0.448404849f, 0.841121733f},
-std::array<float,2>{0.671235561f, 0.215777457f},
-std::array<float,2>{0.405158162f, 0.427025139f},
-std::array<float,2>{0.710950732f, 0.738337696f},
-std::array<float,2>{0.24491024f, 0.9316746f},
-std::array<float,2>{0.957193375f, 0.120226048f},
-std::array<float,2>{0.109149255f, 0.157937303f},
-std::array<float,2>{0.851466f, 0.797825515f},
-std::array<float,2>{0.340914637f, 0.515034378f},
-std::array<float,2>{0.521930337f, 0.294739962f},
-std::array<float,2>{0.470510483f, 0.220194548f},
-std::array<float,2>{0.654085875f, 0.867539525f},
-std::array<float,2>{0.158178002f, 0.592572212f},
-std::array<float,2>{0.88111335f, 0.327847272f},
-std::array<float,2>{0.0602985583f, 0.47249344f},
-std::array<float,2>{0.762133539f, 0.643699825f},
-std::array<float,2>{0.305342108f, 0.973801792f},
-std::array<float,2>{0.602446735f, 0.0458625071f},
-std::array<float,2>{0.365667075f, 0.263958901f},
-std::array<float,2>{0.53613323f, 0.536189139f},
-std::array<float,2>{0.0686421767f, 0.760983706f},
-std::array<float,2>{0.822442234f, 0.149080619f},
-std::array<float,2>{0.206071362f, 0.0836714283f},
-std::array<float,2>{0.991591215f, 0.880746841f},
-std::array<float,2>{0.432877183f, 0.714669645f},
-std::array<float,2>{0.742308617f, 0.379835963f},
-std::array<float,2>{0.417196244f, 0.0946563855f},
-std::array<float,2>{0.719789386f, 0.91153878f},
-std::array<float,2>{0.19740124f, 0.723903656f},
-std::array<float,2>{0.979445577f, 0.407899678f},
-std::array<float,2>{0.0837168768f, 0.296999127f},
-std::array<float,2>{0.828237891f, 0.518991232f},
-std::array<float,2>{0.344840616f, 0.7906003f},
-std::array<float,2>{0.555540383f, 0.172903419f},
-std::array<float,2>{0.294629335f, 0.438920587f},
-std::array<float,2>{0.60940665f, 0.684700131f},
-std::array<float,2>{0.0441928543f, 0.9649719f},
-std::array<float,2>{0.781044781f, 0.0276678931f},
-std::array<float,2>{0.175620586f, 0.198142424f},
-std::array<float,2>{0.902071893f, 0.817934275f},
-std::array<float,2>{0.487769425f, 0.601789236f},
-std::array<float,2>{0.640098929f, 0.353376359f},
-std::array<float,2>{0.322652638f, 0.137835726f},
-std::array<float,2>{0.510255694f, 0.772408903f},
-std::array<float,2>{0.115392305f, 0.560727835f},
-std::array<float,2>{0.860684514f, 0.275905371f},
-std::array<float,2>{0.226403728f, 0.406226516f},
-std::array<float,2>{0.944691956f, 0.688148022f},
-std::array<float,2>{0.386385053f, 0.902362049f},
-std::array<float,2>{0.692927241f, 0.073282741f},
-std::array<float,2>{0.465943158f, 0.343450636f},
-std::array<float,2>{0.682426751f, 0.57112819f},
-std::array<float,2>{0.150308505f, 0.848342657f},
-std::array<float,2>{0.911732197f, 0.24813652f},
-std::array<float,2>{0.0310409777f, 0.0501503721f},
-std::array<float,2>{0.793292224f, 0.988194287f},
-std::array<float,2>{0.258342296f, 0.639671862f},
-std::array<float,2>{0.564296305f, 0.489737034f},
-std::array<float,2>{0.303341538f, 0.074369669f},
-std::array<float,2>{0.595497072f, 0.900162876f},
-std::array<float,2>{0.0479545295f, 0.694619358f},
-std::array<float,2>{0.754999578f, 0.399747223f},
-std::array<float,2>{0.170916513f, 0.277983397f},
-std::array<float,2>{0.883432567f, 0.554745495f},
-std::array<float,2>{0.482652307f, 0.766411901f},
-std::array<float,2>{0.641365349f, 0.133505851f},
-std::array<float,2>{0.424984545f, 0.486040235f},
-std::array<float,2>{0.740128398f, 0.633682847f},
-std::array<float,2>{0.212594345f, 0.991748452f},
-std::array<float,2>{0.995569289f, 0.0546525195f},
-std::array<float,2>{0.0761179104f, 0.242188379f},
-std::array<float,2>{0.814131081f, 0.846255064f},
-std::array<float,2>{0.370208353f, 0.577719212f},
-std::array<float,2>{0.545378447f, 0.337547809f},
-std::array<float,2>{0.440278888f, 0.176396385f},
-std::array<float,2>{0.657261312f, 0.79644829f},
-std::array<float,2>{0.139817238f, 0.521515131f},
-std::array<float,2>{0.931855917f, 0.303099543f},
-std::array<float,2>{0.00893711299f, 0.412830323f},
-std::array<float,2>{0.803780317f, 0.721728861f},
-std::array<float,2>{0.275063246f, 0.909889877f},
-std::array<float,2>{0.58478868f, 0.0991736725f},
-std::array<float,2>{0.333255589f, 0.356779903f},
-std::array<float,2>{0.527336478f, 0.607545495f},
-std::array<float,2>{0.0954013169f, 0.814491034f},
-std::array<float,2>{0.852782547f, 0.202270418f},
-std::array<float,2>{0.239558876f, 0.0270928666f},
-std::array<float,2>{0.961802244f, 0.962870955f},
-std::array<float,2>{0.39495936f, 0.682900727f},
-std::array<float,2>{0.710657656f, 0.445170224f},
-std::array<float,2>{0.376984745f, 0.0397425555f},
-std::array<float,2>{0.695959866f, 0.970883191f},
-std::array<float,2>{0.226654485f, 0.645223916f},
-std::array<float,2>{0.948423624f, 0.474808902f},
-std::array<float,2>{0.119031392f, 0.321941674f},
-std::array<float,2>{0.874610782f, 0.58898443f},
-std::array<float,2>{0.313861072f, 0.873279989f},
-std::array<float,2>{0.505726814f, 0.223708019f},
-std::array<float,2>{0.254431129f, 0.378878862f},
-std::array<float,2>{0.576142728f, 0.715800285f},
-std::array<float,2>{0.0195631143f, 0.875640988f},
-std::array<float,2>{0.786218941f, 0.0809096023f},
-std::array<float,2>{0.14717862f, 0.153763354f},
-std::array<float,2>{0.920076191f, 0.763028562f},
-std::array<float,2>{0.459088147f, 0.53157264f},
-std::array<float,2>{0.676091909f, 0.259145081f},
-std::array<float,2>{0.358109772f, 0.210981786f},
-std::array<float,2>{0.551095188f, 0.836461663f},
-std::array<float,2>{0.0894872844f, 0.612234533f},
-std::array<float,2>{0.836604059f, 0.36015445f},
-std::array<float,2>{0.187561586f, 0.468695402f},
-std::array<float,2>{0.971223772f, 0.664025426f},
-std::array<float,2>{0.411422044f, 0.950521827f},
-std::array<float,2>{0.730309486f, 0.00329577294f},
-std::array<float,2>{0.49236092f, 0.292835355f},
-std::array<float,2>{0.629650056f, 0.510453522f},
-std::array<float,2>{0.18061161f, 0.802045286f},
-std::array<float,2>{0.891900122f, 0.163267866f},
-std::array<float,2>{0.034350723f, 0.124393679f},
-std::array<float,2>{0.769271672f, 0.9356547f},
-std::array<float,2>{0.283951133f, 0.736419439f},
-std::array<float,2>{0.619056106f, 0.424869001f},
-std::array<float,2>{0.325005412f, 0.00957784522f},
-std::array<float,2>{0.514173865f, 0.943103969f},
-std::array<float,2>{0.109912612f, 0.669934869f},
-std::array<float,2>{0.863337696f, 0.457536697f},
-std::array<float,2>{0.222199365f, 0.368990242f},
-std::array<float,2>{0.938947856f, 0.620650828f},
-std::array<float,2>{0.386809975f, 0.832263708f},
-std::array<float,2>{0.690881431f, 0.203452319f},
-std::array<float,2>{0.461399853f, 0.434365392f},
-std::array<float,2>{0.686004877f, 0.747749507f},
-std::array<float,2>{0.154294312f, 0.923508942f},
-std::array<float,2>{0.908502758f, 0.113338687f},
-std::array<float,2>{0.0247638188f, 0.169769645f},
-std::array<float,2>{0.79039079f, 0.806725502f},
-std::array<float,2>{0.263520867f, 0.502684593f},
-std::array<float,2>{0.567949116f, 0.285597205f},
-std::array<float,2>{0.419914901f, 0.233885497f},
-std::array<float,2>{0.726263165f, 0.862222016f},
-std::array<float,2>{0.201806769f, 0.585806191f},
-std::array<float,2>{0.98421514f, 0.315537184f},
-std::array<float,2>{0.082015194f, 0.478502303f},
-std::array<float,2>{0.833299577f, 0.655185461f},
-std::array<float,2>{0.34850961f, 0.98351717f},
-std::array<float,2>{0.559938371f, 0.0389108025f},
-std::array<float,2>{0.289832652f, 0.250097841f},
-std::array<float,2>{0.615263462f, 0.543650329f},
-std::array<float,2>{0.0397996381f, 0.757120311f},
-std::array<float,2>{0.774456739f, 0.147812843f},
-std::array<float,2>{0.177154392f, 0.0900116861f},
-std::array<float,2>{0.904894352f, 0.883191049f},
-std::array<float,2>{0.490605146f, 0.705437601f},
-std::array<float,2>{0.634773791f, 0.387432069f},
-std::array<float,2>{0.475788414f, 0.105486915f},
-std::array<float,2>{0.649378181f, 0.91964519f},
-std::array<float,2>{0.163285092f, 0.730193019f},
-std::array<float,2>{0.877771139f, 0.415517002f},
-std::array<float,2>{0.0583468117f, 0.311926752f},
-std::array<float,2>{0.758173168f, 0.523470819f},
-std::array<float,2>{0.309476435f, 0.783330977f},
-std::array<float,2>{0.606795549f, 0.180387855f},
-std::array<float,2>{0.362545937f, 0.45043546f},
-std::array<float,2>{0.532961011f, 0.678136051f},
-std::array<float,2>{0.0649489239f, 0.954873085f},
-std::array<float,2>{0.824799657f, 0.0186892506f},
-std::array<float,2>{0.210131928f, 0.195129856f},
-std::array<float,2>{0.984819055f, 0.82128787f},
-std::array<float,2>{0.43483144f, 0.600721419f},
-std::array<float,2>{0.74991864f, 0.351323783f},
-std::array<float,2>{0.271469057f, 0.126672134f},
-std::array<float,2>{0.591216147f, 0.781049252f},
-std::array<float,2>{0.00272398535f, 0.55382818f},
-std::array<float,2>{0.805042088f, 0.270231217f},
-std::array<float,2>{0.128546774f, 0.397877514f},
-std::array<float,2>{0.927009523f, 0.697085023f},
-std::array<float,2>{0.450937152f, 0.894172609f},
-std::array<float,2>{0.666595876f, 0.063939169f},
-std::array<float,2>{0.401843905f, 0.328590006f},
-std::array<float,2>{0.716507077f, 0.567263722f},
-std::array<float,2>{0.247705832f, 0.856343508f},
-std::array<float,2>{0.953525782f, 0.236883551f},
-std::array<float,2>{0.1048996f, 0.0601959452f},
-std::array<float,2>{0.845854759f, 0.994405091f},
-std::array<float,2>{0.337985218f, 0.63095516f},
-std::array<float,2>{0.516493022f, 0.494829595f},
-std::array<float,2>{0.373473018f, 0.109494142f},
-std::array<float,2>{0.541416049f, 0.927098811f},
-std::array<float,2>{0.0704469904f, 0.744474471f},
-std::array<float,2>{0.818545163f, 0.432797819f},
-std::array<float,2>{0.218168497f, 0.281948596f},
-std::array<float,2>{0.998049915f, 0.506505072f},
-std::array<float,2>{0.427522659f, 0.809569001f},
-std::array<float,2>{0.73508507f, 0.16779767f},
-std::array<float,2>{0.477912903f, 0.453126848f},
-std::array<float,2>{0.64827913f, 0.665796101f},
-std::array<float,2>{0.165610567f, 0.940197229f},
-std::array<float,2>{0.887022018f, 0.0132367471f},
-std::array<float,2>{0.0533112697f, 0.210936129f},
-std::array<float,2>{0.750557303f, 0.831913888f},
-std::array<float,2>{0.299598366f, 0.624600708f},
-std::array<float,2>{0.599539757f, 0.374353856f},
-std::array<float,2>{0.392165571f, 0.142889798f},
-std::array<float,2>{0.705754697f, 0.751747012f},
-std::array<float,2>{0.238132313f, 0.541621327f},
-std::array<float,2>{0.964953542f, 0.254664451f},
-std::array<float,2>{0.0993863791f, 0.385347903f},
-std::array<float,2>{0.857350409f, 0.708736122f},
-std::array<float,2>{0.33161965f, 0.888076603f},
-std::array<float,2>{0.530551136f, 0.0891641155f},
-std::array<float,2>{0.281119138f, 0.319147348f},
-std::array<float,2>{0.579438746f, 0.579331934f},
-std::array<float,2>{0.0130412215f, 0.865764499f},
-std::array<float,2>{0.797597349f, 0.226796329f},
-std::array<float,2>{0.13655597f, 0.0347181708f},
-std::array<float,2>{0.935110092f, 0.980317593f},
-std::array<float,2>{0.445035428f, 0.651606977f},
-std::array<float,2>{0.663225591f, 0.482086778f},
-std::array<float,2>{0.454424292f, 0.0203580242f},
-std::array<float,2>{0.671931505f, 0.959742427f},
-std::array<float,2>{0.140795007f, 0.675142944f},
-std::array<float,2>{0.915059149f, 0.446351796f},
-std::array<float,2>{0.0186871253f, 0.344190419f},
-std::array<float,2>{0.782480597f, 0.597473621f},
-std::array<float,2>{0.25191614f, 0.826454103f},
-std::array<float,2>{0.570889473f, 0.190315247f},
-std::array<float,2>{0.316761047f, 0.420152158f},
-std::array<float,2>{0.500899971f, 0.732910454f},
-std::array<float,2>{0.121941052f, 0.916582584f},
-std::array<float,2>{0.868873537f, 0.105375849f},
-std::array<float,2>{0.232558683f, 0.183815122f},
-std::array<float,2>{0.951926768f, 0.785932839f},
-std::array<float,2>{0.381293684f, 0.530291855f},
-std::array<float,2>{0.701471329f, 0.306862593f},
-std::array<float,2>{0.286248982f, 0.238593325f},
-std::array<float,2>{0.621103704f, 0.85258615f},
-std::array<float,2>{0.0387118571f, 0.565571427f},
-std::array<float,2>{0.772766292f, 0.334163666f},
-std::array<float,2>{0.183809161f, 0.498269916f},
-std::array<float,2>{0.898073792f, 0.626818359f},
-std::array<float,2>{0.496201307f, 0.998289108f},
-std::array<float,2>{0.625936687f, 0.0578212887f},
-std::array<float,2>{0.408651829f, 0.267822951f},
-std::array<float,2>{0.733384967f, 0.547735035f},
-std::array<float,2>{0.19517833f, 0.773999512f},
-std::array<float,2>{0.976477981f, 0.130750477f},
-std::array<float,2>{0.0919500366f, 0.0677147582f},
-std::array<float,2>{0.841410756f, 0.895348966f},
-std::array<float,2>{0.352911055f, 0.701306105f},
-std::array<float,2>{0.549815536f, 0.393627495f},
-std::array<float,2>{0.259276569f, 0.0487089343f},
-std::array<float,2>{0.563188016f, 0.98596561f},
-std::array<float,2>{0.0294918381f, 0.638248622f},
-std::array<float,2>{0.794172883f, 0.490858495f},
-std::array<float,2>{0.148471802f, 0.340863556f},
-std::array<float,2>{0.91027832f, 0.57415849f},
-std::array<float,2>{0.465341508f, 0.850575089f},
-std::array<float,2>{0.683404148f, 0.247686058f},
-std::array<float,2>{0.385577083f, 0.403270423f},
-std::array<float,2>{0.691577315f, 0.690490007f},
-std::array<float,2>{0.225006521f, 0.905516446f},
-std::array<float,2>{0.944029987f, 0.0718129352f},
-std::array<float,2>{0.116574071f, 0.14005518f},
-std::array<float,2>{0.859498203f, 0.770716131f},
-std::array<float,2>{0.323314041f, 0.559937537f},
-std::array<float,2>{0.511301458f, 0.27459538f},
-std::array<float,2>{0.486958772f, 0.195792153f},
-std::array<float,2>{0.638825476f, 0.820051253f},
-std::array<float,2>{0.174242273f, 0.604193151f},
-std::array<float,2>{0.900837004f, 0.35427177f},
-std::array<float,2>{0.043940831f, 0.439672887f},
-std::array<float,2>{0.779846013f, 0.686179996f},
-std::array<float,2>{0.293103397f, 0.967423379f},
-std::array<float,2>{0.61046654f, 0.0308726206f},
-std::array<float,2>{0.344189525f, 0.300767332f},
-std::array<float,2>{0.556425691f, 0.517498672f},
-std::array<float,2>{0.0825822502f, 0.791936696f},
-std::array<float,2>{0.829992056f, 0.174071953f},
-std::array<float,2>{0.198475987f, 0.0968361497f},
-std::array<float,2>{0.979657531f, 0.913822532f},
-std::array<float,2>{0.416731447f, 0.724849999f},
-std::array<float,2>{0.719019651f, 0.409187198f},
-std::array<float,2>{0.432325482f, 0.0857588649f},
-std::array<float,2>{0.743850768f, 0.882582366f},
-std::array<float,2>{0.2056586f, 0.712164104f},
-std::array<float,2>{0.990927041f, 0.382686168f},
-std::array<float,2>{0.0701439083f, 0.262124151f},
-std::array<float,2>{0.823632598f, 0.538584173f},
-std::array<float,2>{0.367098331f, 0.758098602f},
-std::array<float,2>{0.53575325f, 0.152129129f},
-std::array<float,2>{0.306282192f, 0.470357865f},
-std::array<float,2>{0.602966547f, 0.642570674f},
-std::array<float,2>{0.058677312f, 0.974948883f},
-std::array<float,2>{0.763000011f, 0.0436283462f},
-std::array<float,2>{0.15710552f, 0.221849874f},
-std::array<float,2>{0.882371306f, 0.869496822f},
-std::array<float,2>{0.469627112f, 0.591027796f},
-std::array<float,2>{0.65331924f, 0.325758159f},
-std::array<float,2>{0.34050408f, 0.15832828f},
-std::array<float,2>{0.522724688f, 0.799232304f},
-std::array<float,2>{0.107787371f, 0.512937486f},
-std::array<float,2>{0.85034132f, 0.29675436f},
-std::array<float,2>{0.245403737f, 0.428209603f},
-std::array<float,2>{0.958139539f, 0.741676509f},
-std::array<float,2>{0.405397862f, 0.930320501f},
-std::array<float,2>{0.712073863f, 0.11890392f},
-std::array<float,2>{0.447910279f, 0.364234984f},
-std::array<float,2>{0.67066431f, 0.614274323f},
-std::array<float,2>{0.131576195f, 0.843523562f},
-std::array<float,2>{0.922973394f, 0.217412263f},
-std::array<float,2>{0.00486442307f, 0.00450699683f},
-std::array<float,2>{0.809050977f, 0.945744812f},
-std::array<float,2>{0.266710252f, 0.656508863f},
-std::array<float,2>{0.589207828f, 0.460989565f},
-std::array<float,2>{0.277181119f, 0.0998185128f},
-std::array<float,2>{0.583059072f, 0.907504499f},
-std::array<float,2>{0.0103526469f, 0.719914019f},
-std::array<float,2>{0.801783979f, 0.411822468f},
-std::array<float,2>{0.138616249f, 0.301680088f},
-std::array<float,2>{0.931390822f, 0.519982517f},
-std::array<float,2>{0.438861012f, 0.794847488f},
-std::array<float,2>{0.659490287f, 0.179490045f},
-std::array<float,2>{0.398043126f, 0.442284018f},
-std::array<float,2>{0.707272291f, 0.681150734f},
-std::array<float,2>{0.240648478f, 0.963004589f},
-std::array<float,2>{0.963301539f, 0.0236725155f},
-std::array<float,2>{0.097325772f, 0.199674308f},
-std::array<float,2>{0.854114532f, 0.813591897f},
-std::array<float,2>{0.3347781f, 0.607137859f},
-std::array<float,2>{0.523950934f, 0.357826412f},
-std::array<float,2>{0.48242113f, 0.136032864f},
-std::array<float,2>{0.643987894f, 0.768076658f},
-std::array<float,2>{0.169918031f, 0.557235539f},
-std::array<float,2>{0.886535406f, 0.280087143f},
-std::array<float,2>{0.0498200469f, 0.402107447f},
-std::array<float,2>{0.756541729f, 0.69143337f},
-std::array<float,2>{0.302665532f, 0.900398254f},
-std::array<float,2>{0.597492874f, 0.0772115886f},
-std::array<float,2>{0.367659956f, 0.33935371f},
-std::array<float,2>{0.544108391f, 0.574956894f},
-std::array<float,2>{0.0778169408f, 0.844623446f},
-std::array<float,2>{0.816377401f, 0.24559541f},
-std::array<float,2>{0.214717895f, 0.0511326753f},
-std::array<float,2>{0.993793905f, 0.989987016f},
-std::array<float,2>{0.422896355f, 0.63667649f},
-std::array<float,2>{0.741347551f, 0.486357749f},
-std::array<float,2>{0.413640767f, 0.000352413364f},
-std::array<float,2>{0.727573693f, 0.953115582f},
-std::array<float,2>{0.190346554f, 0.660945892f},
-std::array<float,2>{0.970665276f, 0.465896517f},
-std::array<float,2>{0.0870810524f, 0.362582862f},
-std::array<float,2>{0.839481711f, 0.61075145f},
-std::array<float,2>{0.355732352f, 0.838142037f},
-std::array<float,2>{0.55366379f, 0.213704854f},
-std::array<float,2>{0.282830387f, 0.423740953f},
-std::array<float,2>{0.620891631f, 0.735723794f},
-std::array<float,2>{0.0313898176f, 0.935103476f},
-std::array<float,2>{0.766618013f, 0.121814571f},
-std::array<float,2>{0.182203934f, 0.160808384f},
-std::array<float,2>{0.892760575f, 0.802979648f},
-std::array<float,2>{0.494978994f, 0.508678913f},
-std::array<float,2>{0.631386578f, 0.289229929f},
-std::array<float,2>{0.316141337f, 0.226273298f},
-std::array<float,2>{0.50591886f, 0.871556997f},
-std::array<float,2>{0.119783171f, 0.586834371f},
-std::array<float,2>{0.87201786f, 0.323438078f},
-std::array<float,2>{0.229384378f, 0.473970473f},
-std::array<float,2>{0.94670254f, 0.647966087f},
-std::array<float,2>{0.376437962f, 0.969035268f},
-std::array<float,2>{0.697625935f, 0.0428954251f},
-std::array<float,2>{0.458235651f, 0.260229647f},
-std::array<float,2>{0.677936912f, 0.535084963f},
-std::array<float,2>{0.145669475f, 0.765606046f},
-std::array<float,2>{0.919464529f, 0.154871315f},
-std::array<float,2>{0.0232428629f, 0.0784271061f},
-std::array<float,2>{0.787203252f, 0.878084302f},
-std::array<float,2>{0.256531864f, 0.717249215f},
-std::array<float,2>{0.57712841f, 0.376562148f},
-std::array<float,2>{0.349647313f, 0.0358583927f},
-std::array<float,2>{0.562021315f, 0.980787098f},
-std::array<float,2>{0.0791902989f, 0.653280437f},
-std::array<float,2>{0.83525604f, 0.479539424f},
-std::array<float,2>{0.200144023f, 0.314060748f},
-std::array<float,2>{0.982138753f, 0.582550764f},
-std::array<float,2>{0.420658976f, 0.860786736f},
-std::array<float,2>{0.724503458f, 0.231523007f},
-std::array<float,2>{0.489693403f, 0.390485078f},
-std::array<float,2>{0.634673357f, 0.703907728f},
-std::array<float,2>{0.177975059f, 0.886061311f},
-std::array<float,2>{0.904011846f, 0.0927249193f},
-std::array<float,2>{0.0412879698f, 0.145887554f},
-std::array<float,2>{0.777208626f, 0.754129529f},
-std::array<float,2>{0.291543037f, 0.546592116f},
-std::array<float,2>{0.61505568f, 0.252409995f},
-std::array<float,2>{0.390620023f, 0.206442758f},
-std::array<float,2>{0.688742459f, 0.834486306f},
-std::array<float,2>{0.219329208f, 0.618084311f},
-std::array<float,2>{0.939847112f, 0.371033043f},
-std::array<float,2>{0.113129914f, 0.460152417f},
-std::array<float,2>{0.865463257f, 0.669559598f},
-std::array<float,2>{0.327204645f, 0.944436789f},
-std::array<float,2>{0.512825608f, 0.011191451f},
-std::array<float,2>{0.264520973f, 0.288005859f},
-std::array<float,2>{0.568796456f, 0.501183629f},
-std::array<float,2>{0.0262811668f, 0.804746091f},
-std::array<float,2>{0.792642117f, 0.171461791f},
-std::array<float,2>{0.15435949f, 0.116361603f},
-std::array<float,2>{0.906909347f, 0.924553871f},
-std::array<float,2>{0.464212418f, 0.749954045f},
-std::array<float,2>{0.684622765f, 0.436669379f},
-std::array<float,2>{0.451898158f, 0.0662841201f},
-std::array<float,2>{0.665052831f, 0.891238928f},
-std::array<float,2>{0.125913635f, 0.698930502f},
-std::array<float,2>{0.927912116f, 0.395263016f},
-std::array<float,2>{8.80348671e-05f, 0.271724015f},
-std::array<float,2>{0.807373881f, 0.551757812f},
-std::array<float,2>{0.273406088f, 0.779105008f},
-std::array<float,2>{0.593182623f, 0.128861785f},
-std::array<float,2>{0.337752998f, 0.494109929f},
-std::array<float,2>{0.519274354f, 0.629929185f},
-std::array<float,2>{0.102044329f, 0.99252665f},
-std::array<float,2>{0.845045865f, 0.0608047806f},
-std::array<float,2>{0.249897212f, 0.235031858f},
-std::array<float,2>{0.956466973f, 0.859355569f},
-std::array<float,2>{0.400231272f, 0.570268095f},
-std::array<float,2>{0.718362331f, 0.330603778f},
-std::array<float,2>{0.311916023f, 0.183062211f},
-std::array<float,2>{0.607927263f, 0.78273797f},
-std::array<float,2>{0.0548183657f, 0.52555716f},
-std::array<float,2>{0.760255635f, 0.308730572f},
-std::array<float,2>{0.160326585f, 0.41642648f},
-std::array<float,2>{0.876695573f, 0.727322638f},
-std::array<float,2>{0.473771393f, 0.920556366f},
-std::array<float,2>{0.650624096f, 0.108102679f},
-std::array<float,2>{0.437172353f, 0.348149598f},
-std::array<float,2>{0.747815311f, 0.598313212f},
-std::array<float,2>{0.208155081f, 0.823996961f},
-std::array<float,2>{0.986798823f, 0.192944989f},
-std::array<float,2>{0.064193733f, 0.0165428072f},
-std::array<float,2>{0.826975644f, 0.955322206f},
-std::array<float,2>{0.361032039f, 0.67615062f},
-std::array<float,2>{0.533460259f, 0.452965498f},
-std::array<float,2>{0.32812947f, 0.0872932747f},
-std::array<float,2>{0.527957022f, 0.889647007f},
-std::array<float,2>{0.10000845f, 0.710813999f},
-std::array<float,2>{0.859259009f, 0.382910639f},
-std::array<float,2>{0.236001506f, 0.25775528f},
-std::array<float,2>{0.966924727f, 0.539774001f},
-std::array<float,2>{0.393697977f, 0.752302587f},
-std::array<float,2>{0.704659581f, 0.142127424f},
-std::array<float,2>{0.442934066f, 0.484252125f},
-std::array<float,2>{0.660477877f, 0.649282336f},
-std::array<float,2>{0.134608939f, 0.977279723f},
-std::array<float,2>{0.936725855f, 0.0318767615f},
-std::array<float,2>{0.0151064135f, 0.230194598f},
-std::array<float,2>{0.79928124f, 0.864209354f},
-std::array<float,2>{0.277570724f, 0.581181824f},
-std::array<float,2>{0.580205858f, 0.317967355f},
-std::array<float,2>{0.42849493f, 0.164750651f},
-std::array<float,2>{0.737275243f, 0.811223507f},
-std::array<float,2>{0.21639663f, 0.50462395f},
-std::array<float,2>{0.997563779f, 0.284195572f},
-std::array<float,2>{0.0724122301f, 0.430746168f},
-std::array<float,2>{0.8178792f, 0.743429124f},
-std::array<float,2>{0.372146904f, 0.928139865f},
-std::array<float,2>{0.540968716f, 0.112000853f},
-std::array<float,2>{0.297333479f, 0.371750146f},
-std::array<float,2>{0.600744426f, 0.622686744f},
-std::array<float,2>{0.0512040295f, 0.828387856f},
-std::array<float,2>{0.753637373f, 0.207683548f},
-std::array<float,2>{0.166268125f, 0.0145740546f},
-std::array<float,2>{0.888830304f, 0.938911259f},
-std::array<float,2>{0.479769856f, 0.666524172f},
-std::array<float,2>{0.646421194f, 0.455541372f},
-std::array<float,2>{0.49821952f, 0.0560471974f},
-std::array<float,2>{0.627627373f, 0.997743487f},
-std::array<float,2>{0.186896175f, 0.628359377f},
-std::array<float,2>{0.895761013f, 0.496959597f},
-std::array<float,2>{0.0357546248f, 0.332132578f},
-std::array<float,2>{0.76992631f, 0.562936485f},
-std::array<float,2>{0.288737386f, 0.854669094f},
-std::array<float,2>{0.624682128f, 0.241715774f},
-std::array<float,2>{0.353870749f, 0.391030014f},
-std::array<float,2>{0.547119796f, 0.700139403f},
-std::array<float,2>{0.0902595893f, 0.896772385f},
-std::array<float,2>{0.841925442f, 0.0698589832f},
-std::array<float,2>{0.192765087f, 0.132176653f},
-std::array<float,2>{0.97413671f, 0.775615275f},
-std::array<float,2>{0.406710893f, 0.55058676f},
-std::array<float,2>{0.730629623f, 0.266522646f},
-std::array<float,2>{0.252568871f, 0.188680738f},
-std::array<float,2>{0.572845876f, 0.824517906f},
-std::array<float,2>{0.0163226463f, 0.594627261f},
-std::array<float,2>{0.783732831f, 0.346527904f},
-std::array<float,2>{0.144203857f, 0.448474914f},
-std::array<float,2>{0.917952776f, 0.673323929f},
-std::array<float,2>{0.455542356f, 0.958883882f},
-std::array<float,2>{0.67459023f, 0.0225044787f},
-std::array<float,2>{0.380511403f, 0.30605945f},
-std::array<float,2>{0.699370682f, 0.528862119f},
-std::array<float,2>{0.231974572f, 0.787532926f},
-std::array<float,2>{0.950491548f, 0.187476143f},
-std::array<float,2>{0.123346604f, 0.102162376f},
-std::array<float,2>{0.869476259f, 0.915057361f},
-std::array<float,2>{0.319132477f, 0.732099831f},
-std::array<float,2>{0.502583146f, 0.419582814f},
-std::array<float,2>{0.295008034f, 0.0283342917f},
-std::array<float,2>{0.611789644f, 0.965987027f},
-std::array<float,2>{0.04569095f, 0.684318602f},
-std::array<float,2>{0.778561652f, 0.437849641f},
-std::array<float,2>{0.172887117f, 0.35207811f},
-std::array<float,2>{0.89954263f, 0.603445411f},
-std::array<float,2>{0.485526353f, 0.816474736f},
-std::array<float,2>{0.637504935f, 0.198638886f},
-std::array<float,2>{0.414699972f, 0.406849325f},
-std::array<float,2>{0.722642124f, 0.722678483f},
-std::array<float,2>{0.195682004f, 0.910413682f},
-std::array<float,2>{0.978390694f, 0.0956521481f},
-std::array<float,2>{0.0842808113f, 0.172378913f},
-std::array<float,2>{0.83123523f, 0.789499879f},
-std::array<float,2>{0.346465856f, 0.5181548f},
-std::array<float,2>{0.557047307f, 0.298244953f},
-std::array<float,2>{0.468356848f, 0.249826506f},
-std::array<float,2>{0.680965543f, 0.848723233f},
-std::array<float,2>{0.151766881f, 0.571531475f},
-std::array<float,2>{0.913856864f, 0.341810971f},
-std::array<float,2>{0.0281312242f, 0.488769889f},
-std::array<float,2>{0.795487285f, 0.63909626f},
-std::array<float,2>{0.260781229f, 0.986598134f},
-std::array<float,2>{0.5649665f, 0.0488491394f},
-std::array<float,2>{0.321607381f, 0.276535451f},
-std::array<float,2>{0.509616911f, 0.561660767f},
-std::array<float,2>{0.114113741f, 0.772576571f},
-std::array<float,2>{0.862629175f, 0.137485787f},
-std::array<float,2>{0.223361924f, 0.0724779516f},
-std::array<float,2>{0.941798806f, 0.903755784f},
-std::array<float,2>{0.383190513f, 0.689265251f},
-std::array<float,2>{0.694385171f, 0.404492676f},
-std::array<float,2>{0.40302977f, 0.119999781f},
-std::array<float,2>{0.714717329f, 0.933147967f},
-std::array<float,2>{0.242683887f, 0.739318609f},
-std::array<float,2>{0.960792482f, 0.42671746f},
-std::array<float,2>{0.107273623f, 0.293610901f},
-std::array<float,2>{0.849235356f, 0.513846695f},
-std::array<float,2>{0.342836201f, 0.798651636f},
-std::array<float,2>{0.519815505f, 0.157206446f},
-std::array<float,2>{0.268794149f, 0.464041144f},
-std::array<float,2>{0.587561667f, 0.65887773f},
-std::array<float,2>{0.00671149138f, 0.948617816f},
-std::array<float,2>{0.81084919f, 0.0075142812f},
-std::array<float,2>{0.130763501f, 0.216085061f},
-std::array<float,2>{0.925486207f, 0.839993417f},
-std::array<float,2>{0.446212649f, 0.616609752f},
-std::array<float,2>{0.669250309f, 0.365956217f},
-std::array<float,2>{0.363386929f, 0.150094241f},
-std::array<float,2>{0.537804902f, 0.760290205f},
-std::array<float,2>{0.0664896369f, 0.535870314f},
-std::array<float,2>{0.821254671f, 0.26554963f},
-std::array<float,2>{0.203289136f, 0.379940838f},
-std::array<float,2>{0.989718437f, 0.713470221f},
-std::array<float,2>{0.431503117f, 0.879537463f},
-std::array<float,2>{0.745789111f, 0.0822699517f},
-std::array<float,2>{0.471748352f, 0.326599211f},
-std::array<float,2>{0.654849172f, 0.593471289f},
-std::array<float,2>{0.159717426f, 0.868403196f},
-std::array<float,2>{0.879918933f, 0.219571009f},
-std::array<float,2>{0.0616603047f, 0.0460434593f},
-std::array<float,2>{0.764311194f, 0.972943068f},
-std::array<float,2>{0.307995498f, 0.643040299f},
-std::array<float,2>{0.604119837f, 0.470854729f},
-std::array<float,2>{0.272649288f, 0.0641582087f},
-std::array<float,2>{0.593392551f, 0.893780231f},
-std::array<float,2>{0.000605911191f, 0.69638139f},
-std::array<float,2>{0.806838512f, 0.398066342f},
-std::array<float,2>{0.125450969f, 0.269900858f},
-std::array<float,2>{0.928675234f, 0.554239929f},
-std::array<float,2>{0.451275259f, 0.780626178f},
-std::array<float,2>{0.665594399f, 0.126448259f},
-std::array<float,2>{0.399459183f, 0.494231999f},
-std::array<float,2>{0.718124151f, 0.631539226f},
-std::array<float,2>{0.24909386f, 0.994973779f},
-std::array<float,2>{0.956757724f, 0.0599449687f},
-std::array<float,2>{0.102294795f, 0.236695483f},
-std::array<float,2>{0.845235288f, 0.855496109f},
-std::array<float,2>{0.336941928f, 0.566724896f},
-std::array<float,2>{0.519037962f, 0.328699768f},
-std::array<float,2>{0.474567741f, 0.180168867f},
-std::array<float,2>{0.651086211f, 0.78370136f},
-std::array<float,2>{0.161014244f, 0.524108827f},
-std::array<float,2>{0.876434743f, 0.312486082f},
-std::array<float,2>{0.0554550216f, 0.415999979f},
-std::array<float,2>{0.759783387f, 0.729628623f},
-std::array<float,2>{0.312241524f, 0.91916734f},
-std::array<float,2>{0.607509196f, 0.106220037f},
-std::array<float,2>{0.360603184f, 0.350802571f},
-std::array<float,2>{0.533915222f, 0.601252139f},
-std::array<float,2>{0.0638852417f, 0.820377886f},
-std::array<float,2>{0.826491475f, 0.194820702f},
-std::array<float,2>{0.208522335f, 0.0190779325f},
-std::array<float,2>{0.986964822f, 0.954578161f},
-std::array<float,2>{0.436553746f, 0.67848295f},
-std::array<float,2>{0.747368634f, 0.450931579f},
-std::array<float,2>{0.420168221f, 0.0381466709f},
-std::array<float,2>{0.723694026f, 0.984014869f},
-std::array<float,2>{0.199460521f, 0.654460847f},
-std::array<float,2>{0.981512547f, 0.47759071f},
-std::array<float,2>{0.0797108039f, 0.316362977f},
-std::array<float,2>{0.835494161f, 0.585059881f},
-std::array<float,2>{0.350227594f, 0.861411512f},
-std::array<float,2>{0.561836779f, 0.23393096f},
-std::array<float,2>{0.291065961f, 0.387191415f},
-std::array<float,2>{0.614661574f, 0.705985487f},
-std::array<float,2>{0.0419827513f, 0.883712173f},
-std::array<float,2>{0.776643634f, 0.0904529616f},
-std::array<float,2>{0.178446963f, 0.148059532f},
-std::array<float,2>{0.903547704f, 0.757501543f},
-std::array<float,2>{0.48999092f, 0.542969584f},
-std::array<float,2>{0.634171009f, 0.250496805f},
-std::array<float,2>{0.327934861f, 0.203706309f},
-std::array<float,2>{0.513551414f, 0.832798898f},
-std::array<float,2>{0.112363733f, 0.620516181f},
-std::array<float,2>{0.86582911f, 0.368421435f},
-std::array<float,2>{0.218959436f, 0.457125485f},
-std::array<float,2>{0.940312982f, 0.670710921f},
-std::array<float,2>{0.389841735f, 0.942653894f},
-std::array<float,2>{0.689034879f, 0.00889300182f},
-std::array<float,2>{0.464450151f, 0.286060661f},
-std::array<float,2>{0.685344517f, 0.502406776f},
-std::array<float,2>{0.155142739f, 0.807268202f},
-std::array<float,2>{0.90654844f, 0.16928184f},
-std::array<float,2>{0.0256994553f, 0.114109255f},
-std::array<float,2>{0.792113185f, 0.923119903f},
-std::array<float,2>{0.264025062f, 0.747548163f},
-std::array<float,2>{0.569160104f, 0.433870703f},
-std::array<float,2>{0.356191546f, 0.00361028686f},
-std::array<float,2>{0.552736044f, 0.950772762f},
-std::array<float,2>{0.087836802f, 0.663395345f},
-std::array<float,2>{0.83887732f, 0.467927307f},
-std::array<float,2>{0.18966876f, 0.359754622f},
-std::array<float,2>{0.970017135f, 0.611573815f},
-std::array<float,2>{0.413454026f, 0.836249948f},
-std::array<float,2>{0.728394985f, 0.211452425f},
-std::array<float,2>{0.494170398f, 0.425484896f},
-std::array<float,2>{0.631046474f, 0.736912549f},
-std::array<float,2>{0.181846097f, 0.936093152f},
-std::array<float,2>{0.893255889f, 0.124933586f},
-std::array<float,2>{0.0320056118f, 0.163723648f},
-std::array<float,2>{0.767093658f, 0.802361429f},
-std::array<float,2>{0.282683104f, 0.509952784f},
-std::array<float,2>{0.62024188f, 0.292453259f},
-std::array<float,2>{0.376631439f, 0.224548534f},
-std::array<float,2>{0.697776914f, 0.873879552f},
-std::array<float,2>{0.228792995f, 0.589496672f},
-std::array<float,2>{0.946893871f, 0.321408749f},
-std::array<float,2>{0.119594514f, 0.475395292f},
-std::array<float,2>{0.871537566f, 0.644572377f},
-std::array<float,2>{0.315910339f, 0.971342444f},
-std::array<float,2>{0.506585538f, 0.0393065549f},
-std::array<float,2>{0.255949676f, 0.259466499f},
-std::array<float,2>{0.576583445f, 0.532067776f},
-std::array<float,2>{0.0227557048f, 0.763321519f},
-std::array<float,2>{0.78775984f, 0.154021233f},
-std::array<float,2>{0.146450415f, 0.0801854879f},
-std::array<float,2>{0.919383109f, 0.875446856f},
-std::array<float,2>{0.458689332f, 0.71496433f},
-std::array<float,2>{0.678699434f, 0.378321409f},
-std::array<float,2>{0.439443558f, 0.0990651697f},
-std::array<float,2>{0.659692645f, 0.909335494f},
-std::array<float,2>{0.137975171f, 0.72249341f},
-std::array<float,2>{0.93087095f, 0.412368953f},
-std::array<float,2>{0.0101954406f, 0.303549111f},
-std::array<float,2>{0.802506983f, 0.52201879f},
-std::array<float,2>{0.276510745f, 0.796195507f},
-std::array<float,2>{0.583743513f, 0.176109135f},
-std::array<float,2>{0.334098309f, 0.444546819f},
-std::array<float,2>{0.523465335f, 0.683251262f},
-std::array<float,2>{0.0969404951f, 0.96201551f},
-std::array<float,2>{0.853980958f, 0.0265862551f},
-std::array<float,2>{0.24087213f, 0.202793583f},
-std::array<float,2>{0.963781655f, 0.815077901f},
-std::array<float,2>{0.39751038f, 0.608196139f},
-std::array<float,2>{0.707654297f, 0.357284904f},
-std::array<float,2>{0.301911741f, 0.133081108f},
-std::array<float,2>{0.596868873f, 0.766048074f},
-std::array<float,2>{0.0506357513f, 0.555237174f},
-std::array<float,2>{0.756089389f, 0.277798891f},
-std::array<float,2>{0.169019744f, 0.400016844f},
-std::array<float,2>{0.885923862f, 0.69514823f},
-std::array<float,2>{0.481642157f, 0.899841547f},
-std::array<float,2>{0.644226551f, 0.0751927868f},
-std::array<float,2>{0.423495382f, 0.337245673f},
-std::array<float,2>{0.741993964f, 0.577622771f},
-std::array<float,2>{0.213989884f, 0.845975041f},
-std::array<float,2>{0.993425071f, 0.242785305f},
-std::array<float,2>{0.0774888396f, 0.053884197f},
-std::array<float,2>{0.815898836f, 0.991550088f},
-std::array<float,2>{0.367781878f, 0.632938921f},
-std::array<float,2>{0.544551253f, 0.485701382f},
-std::array<float,2>{0.343582332f, 0.118383951f},
-std::array<float,2>{0.520294547f, 0.929948211f},
-std::array<float,2>{0.106686108f, 0.741973102f},
-std::array<float,2>{0.849076629f, 0.428333253f},
-std::array<float,2>{0.242598221f, 0.296065331f},
-std::array<float,2>{0.960337698f, 0.51320225f},
-std::array<float,2>{0.402621776f, 0.799360752f},
-std::array<float,2>{0.71414721f, 0.159101367f},
-std::array<float,2>{0.445607007f, 0.461864114f},
-std::array<float,2>{0.669557571f, 0.656799555f},
-std::array<float,2>{0.129965723f, 0.945841432f},
-std::array<float,2>{0.924983084f, 0.00422231155f},
-std::array<float,2>{0.00598455267f, 0.216852576f},
-std::array<float,2>{0.811185777f, 0.842938364f},
-std::array<float,2>{0.269415617f, 0.614835799f},
-std::array<float,2>{0.586990893f, 0.363433868f},
-std::array<float,2>{0.43074584f, 0.151747882f},
-std::array<float,2>{0.745344341f, 0.758731246f},
-std::array<float,2>{0.203746751f, 0.538354695f},
-std::array<float,2>{0.989912212f, 0.262326181f},
-std::array<float,2>{0.0669978261f, 0.382108927f},
-std::array<float,2>{0.820577323f, 0.712694824f},
-std::array<float,2>{0.3641316f, 0.882224202f},
-std::array<float,2>{0.537287593f, 0.0852397531f},
-std::array<float,2>{0.308362305f, 0.325256288f},
-std::array<float,2>{0.603974283f, 0.591343522f},
-std::array<float,2>{0.0623190142f, 0.869896054f},
-std::array<float,2>{0.763897717f, 0.222448707f},
-std::array<float,2>{0.159597054f, 0.0433182679f},
-std::array<float,2>{0.880406082f, 0.975517333f},
-std::array<float,2>{0.472646981f, 0.64176476f},
-std::array<float,2>{0.654492319f, 0.47018832f},
-std::array<float,2>{0.48600623f, 0.0305272155f},
-std::array<float,2>{0.636797845f, 0.967271686f},
-std::array<float,2>{0.173411727f, 0.685612202f},
-std::array<float,2>{0.900147557f, 0.440205306f},
-std::array<float,2>{0.0449302308f, 0.353710145f},
-std::array<float,2>{0.779159248f, 0.603732467f},
-std::array<float,2>{0.295640796f, 0.8195678f},
-std::array<float,2>{0.6118806f, 0.196109742f},
-std::array<float,2>{0.345971555f, 0.410061747f},
-std::array<float,2>{0.557291508f, 0.72516644f},
-std::array<float,2>{0.0846426859f, 0.913292587f},
-std::array<float,2>{0.831785858f, 0.097232528f},
-std::array<float,2>{0.196043715f, 0.174562499f},
-std::array<float,2>{0.977772057f, 0.791247845f},
-std::array<float,2>{0.414248765f, 0.516880035f},
-std::array<float,2>{0.721729636f, 0.299894899f},
-std::array<float,2>{0.261658639f, 0.24728328f},
-std::array<float,2>{0.56475234f, 0.84992975f},
-std::array<float,2>{0.0277546067f, 0.573711157f},
-std::array<float,2>{0.795311987f, 0.341668487f},
-std::array<float,2>{0.152082339f, 0.49049893f},
-std::array<float,2>{0.913164854f, 0.638030767f},
-std::array<float,2>{0.468246907f, 0.985817969f},
-std::array<float,2>{0.681419373f, 0.0480068289f},
-std::array<float,2>{0.383508146f, 0.275348842f},
-std::array<float,2>{0.695117831f, 0.560519636f},
-std::array<float,2>{0.222809598f, 0.771104395f},
-std::array<float,2>{0.942032456f, 0.140544996f},
-std::array<float,2>{0.113529421f, 0.0714021325f},
-std::array<float,2>{0.862853587f, 0.906097054f},
-std::array<float,2>{0.321936011f, 0.690947235f},
-std::array<float,2>{0.509271622f, 0.40246281f},
-std::array<float,2>{0.28845346f, 0.0582362786f},
-std::array<float,2>{0.62420392f, 0.99859637f},
-std::array<float,2>{0.0353205912f, 0.626019835f},
-std::array<float,2>{0.770317197f, 0.498692542f},
-std::array<float,2>{0.187184185f, 0.334488839f},
-std::array<float,2>{0.896345079f, 0.566020846f},
-std::array<float,2>{0.498586535f, 0.853144944f},
-std::array<float,2>{0.627004504f, 0.238796264f},
-std::array<float,2>{0.407007515f, 0.394498885f},
-std::array<float,2>{0.731274247f, 0.701693177f},
-std::array<float,2>{0.193049431f, 0.89478296f},
-std::array<float,2>{0.973928332f, 0.0680802241f},
-std::array<float,2>{0.0906875655f, 0.129951611f},
-std::array<float,2>{0.842290819f, 0.773778677f},
-std::array<float,2>{0.354461133f, 0.546921134f},
-std::array<float,2>{0.547492445f, 0.268235862f},
-std::array<float,2>{0.455650121f, 0.189643741f},
-std::array<float,2>{0.674278736f, 0.82678467f},
-std::array<float,2>{0.143671289f, 0.597167969f},
-std::array<float,2>{0.91702801f, 0.344417214f},
-std::array<float,2>{0.0158536993f, 0.446939677f},
-std::array<float,2>{0.783263743f, 0.675724506f},
-std::array<float,2>{0.252134383f, 0.959265053f},
-std::array<float,2>{0.572539687f, 0.0197626241f},
-std::array<float,2>{0.318408787f, 0.307173669f},
-std::array<float,2>{0.502396405f, 0.531155467f},
-std::array<float,2>{0.123890117f, 0.785247624f},
-std::array<float,2>{0.869638801f, 0.184492603f},
-std::array<float,2>{0.231597543f, 0.104613714f},
-std::array<float,2>{0.95112747f, 0.916025758f},
-std::array<float,2>{0.380233526f, 0.732593358f},
-std::array<float,2>{0.699975848f, 0.420576394f},
-std::array<float,2>{0.394423902f, 0.0894156471f},
-std::array<float,2>{0.704520941f, 0.88858062f},
-std::array<float,2>{0.235699043f, 0.708205283f},
-std::array<float,2>{0.967676938f, 0.385230869f},
-std::array<float,2>{0.100146942f, 0.254325092f},
-std::array<float,2>{0.85875839f, 0.541028976f},
-std::array<float,2>{0.328627974f, 0.75134635f},
-std::array<float,2>{0.52761966f, 0.143537521f},
-std::array<float,2>{0.278036505f, 0.481601745f},
-std::array<float,2>{0.580833673f, 0.652220607f},
-std::array<float,2>{0.0151960887f, 0.979748607f},
-std::array<float,2>{0.799610376f, 0.0346447788f},
-std::array<float,2>{0.134178579f, 0.227364004f},
-std::array<float,2>{0.93714726f, 0.865579844f},
-std::array<float,2>{0.442837715f, 0.579914272f},
-std::array<float,2>{0.660931706f, 0.318826467f},
-std::array<float,2>{0.37267524f, 0.167054713f},
-std::array<float,2>{0.540094674f, 0.808931589f},
-std::array<float,2>{0.0729539245f, 0.506011665f},
-std::array<float,2>{0.817401946f, 0.28129068f},
-std::array<float,2>{0.216013968f, 0.433477312f},
-std::array<float,2>{0.997446775f, 0.745018125f},
-std::array<float,2>{0.427825123f, 0.927689195f},
-std::array<float,2>{0.736686587f, 0.1099848f},
-std::array<float,2>{0.480216384f, 0.374858111f},
-std::array<float,2>{0.645620525f, 0.624270916f},
-std::array<float,2>{0.166785687f, 0.831215382f},
-std::array<float,2>{0.889451981f, 0.210149124f},
-std::array<float,2>{0.051717177f, 0.0130033987f},
-std::array<float,2>{0.753310263f, 0.939499617f},
-std::array<float,2>{0.297720164f, 0.665461361f},
-std::array<float,2>{0.601228118f, 0.454029709f},
-std::array<float,2>{0.308748394f, 0.107650228f},
-std::array<float,2>{0.607226431f, 0.920112967f},
-std::array<float,2>{0.0577208921f, 0.726894855f},
-std::array<float,2>{0.75841403f, 0.416673511f},
-std::array<float,2>{0.164054394f, 0.309252203f},
-std::array<float,2>{0.877160668f, 0.525995731f},
-std::array<float,2>{0.476292074f, 0.782619178f},
-std::array<float,2>{0.648891211f, 0.183130309f},
-std::array<float,2>{0.435510218f, 0.452487797f},
-std::array<float,2>{0.749397516f, 0.676488101f},
-std::array<float,2>{0.210902825f, 0.955788612f},
-std::array<float,2>{0.985105336f, 0.0158976726f},
-std::array<float,2>{0.0647872165f, 0.192566767f},
-std::array<float,2>{0.824519217f, 0.823515356f},
-std::array<float,2>{0.362873554f, 0.597812295f},
-std::array<float,2>{0.532586515f, 0.347816944f},
-std::array<float,2>{0.450218111f, 0.128099814f},
-std::array<float,2>{0.666342258f, 0.778332174f},
-std::array<float,2>{0.128115207f, 0.551109433f},
-std::array<float,2>{0.927657425f, 0.272347957f},
-std::array<float,2>{0.00228916085f, 0.394954294f},
-std::array<float,2>{0.805312693f, 0.698349297f},
-std::array<float,2>{0.270747513f, 0.890656531f},
-std::array<float,2>{0.591780126f, 0.065724954f},
-std::array<float,2>{0.338861018f, 0.330489784f},
-std::array<float,2>{0.515638411f, 0.569748104f},
-std::array<float,2>{0.105051912f, 0.858878374f},
-std::array<float,2>{0.846313238f, 0.234831899f},
-std::array<float,2>{0.247156024f, 0.0612151586f},
-std::array<float,2>{0.95394057f, 0.993105352f},
-std::array<float,2>{0.402049273f, 0.630425572f},
-std::array<float,2>{0.715880454f, 0.493268877f},
-std::array<float,2>{0.387411952f, 0.0115486942f},
-std::array<float,2>{0.691297472f, 0.945189774f},
-std::array<float,2>{0.222016454f, 0.669217944f},
-std::array<float,2>{0.939073801f, 0.460897177f},
-std::array<float,2>{0.109524526f, 0.370501995f},
-std::array<float,2>{0.863953054f, 0.617604375f},
-std::array<float,2>{0.32462737f, 0.834109366f},
-std::array<float,2>{0.513763607f, 0.206546977f},
-std::array<float,2>{0.262762785f, 0.437214971f},
-std::array<float,2>{0.567870498f, 0.749074578f},
-std::array<float,2>{0.0253511257f, 0.924243867f},
-std::array<float,2>{0.790793121f, 0.116711929f},
-std::array<float,2>{0.153685659f, 0.171267927f},
-std::array<float,2>{0.908794999f, 0.805656016f},
-std::array<float,2>{0.461456865f, 0.50152725f},
-std::array<float,2>{0.686146259f, 0.287485123f},
-std::array<float,2>{0.347952068f, 0.232038409f},
-std::array<float,2>{0.560450971f, 0.861044526f},
-std::array<float,2>{0.081272997f, 0.582074046f},
-std::array<float,2>{0.833593428f, 0.313842148f},
-std::array<float,2>{0.201360628f, 0.480058223f},
-std::array<float,2>{0.983674109f, 0.652418673f},
-std::array<float,2>{0.419130117f, 0.981131673f},
-std::array<float,2>{0.725974262f, 0.0354338139f},
-std::array<float,2>{0.490969241f, 0.252600223f},
-std::array<float,2>{0.635490239f, 0.546227336f},
-std::array<float,2>{0.177622423f, 0.754568517f},
-std::array<float,2>{0.904402912f, 0.14625074f},
-std::array<float,2>{0.0391785763f, 0.0922193676f},
-std::array<float,2>{0.775295675f, 0.886240065f},
-std::array<float,2>{0.289337039f, 0.703292549f},
-std::array<float,2>{0.615733266f, 0.389745951f},
-std::array<float,2>{0.314099818f, 0.0420546457f},
-std::array<float,2>{0.50508976f, 0.969434083f},
-std::array<float,2>{0.118437901f, 0.647494316f},
-std::array<float,2>{0.874281168f, 0.474162519f},
-std::array<float,2>{0.227079988f, 0.323919415f},
-std::array<float,2>{0.949043095f, 0.586380899f},
-std::array<float,2>{0.377754301f, 0.872068644f},
-std::array<float,2>{0.695786655f, 0.225587368f},
-std::array<float,2>{0.459790468f, 0.376001656f},
-std::array<float,2>{0.676282227f, 0.71739459f},
-std::array<float,2>{0.14689967f, 0.878640234f},
-std::array<float,2>{0.920498252f, 0.0787910223f},
-std::array<float,2>{0.0202669762f, 0.154519513f},
-std::array<float,2>{0.78687793f, 0.764864385f},
-std::array<float,2>{0.254303366f, 0.534441352f},
-std::array<float,2>{0.575421274f, 0.260289431f},
-std::array<float,2>{0.41200453f, 0.213361621f},
-std::array<float,2>{0.729573011f, 0.838418543f},
-std::array<float,2>{0.18807058f, 0.611038208f},
-std::array<float,2>{0.971145272f, 0.363259882f},
-std::array<float,2>{0.0889779702f, 0.466763467f},
-std::array<float,2>{0.836324513f, 0.660244107f},
-std::array<float,2>{0.357626319f, 0.952434003f},
-std::array<float,2>{0.551725268f, 0.000520632311f},
-std::array<float,2>{0.28322193f, 0.289826334f},
-std::array<float,2>{0.618626595f, 0.507880628f},
-std::array<float,2>{0.0350129493f, 0.803476512f},
-std::array<float,2>{0.768607199f, 0.160535544f},
-std::array<float,2>{0.179738238f, 0.12112765f},
-std::array<float,2>{0.892306864f, 0.93490541f},
-std::array<float,2>{0.493117929f, 0.736064792f},
-std::array<float,2>{0.62930578f, 0.423211873f},
-std::array<float,2>{0.483159751f, 0.0781118944f},
-std::array<float,2>{0.640831769f, 0.901207387f},
-std::array<float,2>{0.171393126f, 0.691979647f},
-std::array<float,2>{0.883014441f, 0.401833236f},
-std::array<float,2>{0.0488110408f, 0.27957961f},
-std::array<float,2>{0.755524993f, 0.556825578f},
-std::array<float,2>{0.303165972f, 0.76799798f},
-std::array<float,2>{0.595132768f, 0.136511087f},
-std::array<float,2>{0.370641083f, 0.487014532f},
-std::array<float,2>{0.54581362f, 0.636190891f},
-std::array<float,2>{0.0754648149f, 0.98945725f},
-std::array<float,2>{0.813829541f, 0.0513245277f},
-std::array<float,2>{0.211920783f, 0.246070057f},
-std::array<float,2>{0.995681763f, 0.843841732f},
-std::array<float,2>{0.425533473f, 0.574584007f},
-std::array<float,2>{0.739608169f, 0.33946833f},
-std::array<float,2>{0.274639398f, 0.17885378f},
-std::array<float,2>{0.584453046f, 0.794251621f},
-std::array<float,2>{0.00951107964f, 0.520493388f},
-std::array<float,2>{0.804420888f, 0.300874591f},
-std::array<float,2>{0.140207797f, 0.411175907f},
-std::array<float,2>{0.932257116f, 0.720518351f},
-std::array<float,2>{0.439866424f, 0.907736957f},
-std::array<float,2>{0.657738745f, 0.100283556f},
-std::array<float,2>{0.395183831f, 0.358155668f},
-std::array<float,2>{0.710353911f, 0.606811762f},
-std::array<float,2>{0.240001723f, 0.814305842f},
-std::array<float,2>{0.961050451f, 0.199917719f},
-std::array<float,2>{0.0951906964f, 0.0239979737f},
-std::array<float,2>{0.853305995f, 0.963493347f},
-std::array<float,2>{0.333600521f, 0.68161124f},
-std::array<float,2>{0.526569843f, 0.441499919f},
-std::array<float,2>{0.36632061f, 0.0828084946f},
-std::array<float,2>{0.535463035f, 0.879118443f},
-std::array<float,2>{0.0698153153f, 0.713038146f},
-std::array<float,2>{0.824029386f, 0.380425572f},
-std::array<float,2>{0.205094889f, 0.264877826f},
-std::array<float,2>{0.990557373f, 0.535414219f},
-std::array<float,2>{0.43165648f, 0.760146558f},
-std::array<float,2>{0.743302524f, 0.149669632f},
-std::array<float,2>{0.469058245f, 0.471384704f},
-std::array<float,2>{0.652615011f, 0.643108368f},
-std::array<float,2>{0.156458378f, 0.973311007f},
-std::array<float,2>{0.882270396f, 0.0466909818f},
-std::array<float,2>{0.0593357421f, 0.219031557f},
-std::array<float,2>{0.763268113f, 0.868975818f},
-std::array<float,2>{0.306053996f, 0.592916906f},
-std::array<float,2>{0.603436232f, 0.326897293f},
-std::array<float,2>{0.405935645f, 0.156689376f},
-std::array<float,2>{0.712655962f, 0.798182666f},
-std::array<float,2>{0.245805368f, 0.514429748f},
-std::array<float,2>{0.958841085f, 0.293107778f},
-std::array<float,2>{0.108193316f, 0.426182061f},
-std::array<float,2>{0.849930584f, 0.739851892f},
-std::array<float,2>{0.340325505f, 0.932977974f},
-std::array<float,2>{0.523329198f, 0.11920058f},
-std::array<float,2>{0.267397076f, 0.365656495f},
-std::array<float,2>{0.589465797f, 0.616839409f},
-std::array<float,2>{0.00427424069f, 0.840437233f},
-std::array<float,2>{0.809485972f, 0.216760069f},
-std::array<float,2>{0.131274f, 0.00726227788f},
-std::array<float,2>{0.923568189f, 0.949134588f},
-std::array<float,2>{0.447468877f, 0.658298612f},
-std::array<float,2>{0.670049369f, 0.464390367f},
-std::array<float,2>{0.465165555f, 0.0497352742f},
-std::array<float,2>{0.683043957f, 0.987296999f},
-std::array<float,2>{0.149287149f, 0.639266431f},
-std::array<float,2>{0.910723627f, 0.488568276f},
-std::array<float,2>{0.0302217416f, 0.342306286f},
-std::array<float,2>{0.794443607f, 0.571867347f},
-std::array<float,2>{0.259743124f, 0.849273801f},
-std::array<float,2>{0.562987387f, 0.249368951f},
-std::array<float,2>{0.323925704f, 0.404932171f},
-std::array<float,2>{0.511006355f, 0.688716769f},
-std::array<float,2>{0.116972215f, 0.904060721f},
-std::array<float,2>{0.860090852f, 0.0727934763f},
-std::array<float,2>{0.225477144f, 0.136763766f},
-std::array<float,2>{0.943818033f, 0.773093402f},
-std::array<float,2>{0.385150135f, 0.562035918f},
-std::array<float,2>{0.692152202f, 0.277158886f},
-std::array<float,2>{0.293465823f, 0.199048445f},
-std::array<float,2>{0.61127919f, 0.817013681f},
-std::array<float,2>{0.0434544981f, 0.60266304f},
-std::array<float,2>{0.77969718f, 0.351686329f},
-std::array<float,2>{0.174445435f, 0.438386858f},
-std::array<float,2>{0.901307344f, 0.68392092f},
-std::array<float,2>{0.486726046f, 0.966642916f},
-std::array<float,2>{0.639468789f, 0.0291930586f},
-std::array<float,2>{0.416403174f, 0.298487872f},
-std::array<float,2>{0.719638348f, 0.51796186f},
-std::array<float,2>{0.198989853f, 0.789894044f},
-std::array<float,2>{0.980149209f, 0.172061875f},
-std::array<float,2>{0.0825061277f, 0.0947807282f},
-std::array<float,2>{0.829130411f, 0.910780668f},
-std::array<float,2>{0.344584703f, 0.723526716f},
-std::array<float,2>{0.555931568f, 0.40660134f},
-std::array<float,2>{0.251245916f, 0.0233029742f},
-std::array<float,2>{0.570512712f, 0.958283842f},
-std::array<float,2>{0.0193719547f, 0.673518717f},
-std::array<float,2>{0.782719791f, 0.448745728f},
-std::array<float,2>{0.141450286f, 0.345874786f},
-std::array<float,2>{0.915825844f, 0.594046533f},
-std::array<float,2>{0.454695582f, 0.82508415f},
-std::array<float,2>{0.672627926f, 0.189281628f},
-std::array<float,2>{0.381526977f, 0.419167846f},
-std::array<float,2>{0.701805592f, 0.731496215f},
-std::array<float,2>{0.232940152f, 0.915999234f},
-std::array<float,2>{0.951300561f, 0.101769842f},
-std::array<float,2>{0.121309213f, 0.186953977f},
-std::array<float,2>{0.868413806f, 0.78774935f},
-std::array<float,2>{0.317083746f, 0.528559446f},
-std::array<float,2>{0.500138223f, 0.306536764f},
-std::array<float,2>{0.496979088f, 0.241217494f},
-std::array<float,2>{0.625051141f, 0.85523051f},
-std::array<float,2>{0.184491426f, 0.563040257f},
-std::array<float,2>{0.897660673f, 0.332821637f},
-std::array<float,2>{0.0382713228f, 0.496478587f},
-std::array<float,2>{0.773184121f, 0.62873441f},
-std::array<float,2>{0.28673327f, 0.997554898f},
-std::array<float,2>{0.621854126f, 0.0562013723f},
-std::array<float,2>{0.353062123f, 0.265853286f},
-std::array<float,2>{0.550471127f, 0.550003469f},
-std::array<float,2>{0.09243422f, 0.776267052f},
-std::array<float,2>{0.841192305f, 0.132566258f},
-std::array<float,2>{0.194788679f, 0.0695226341f},
-std::array<float,2>{0.975746334f, 0.89724046f},
-std::array<float,2>{0.409046054f, 0.699367642f},
-std::array<float,2>{0.732872963f, 0.391325563f},
-std::array<float,2>{0.42676723f, 0.111577399f},
-std::array<float,2>{0.734585166f, 0.928275764f},
-std::array<float,2>{0.218727738f, 0.743718922f},
-std::array<float,2>{0.9985798f, 0.43124944f},
-std::array<float,2>{0.0708081871f, 0.284780562f},
-std::array<float,2>{0.819020331f, 0.504316509f},
-std::array<float,2>{0.373728037f, 0.810628235f},
-std::array<float,2>{0.541589916f, 0.164458767f},
-std::array<float,2>{0.299298197f, 0.455932498f},
-std::array<float,2>{0.599020958f, 0.666299343f},
-std::array<float,2>{0.0529247783f, 0.939378262f},
-std::array<float,2>{0.750482798f, 0.0137813557f},
-std::array<float,2>{0.165228069f, 0.207205102f},
-std::array<float,2>{0.887447834f, 0.828738809f},
-std::array<float,2>{0.478496671f, 0.622303784f},
-std::array<float,2>{0.64763689f, 0.371460557f},
-std::array<float,2>{0.331387311f, 0.142021894f},
-std::array<float,2>{0.531114399f, 0.752448916f},
-std::array<float,2>{0.0989591479f, 0.539270282f},
-std::array<float,2>{0.856563866f, 0.256939381f},
-std::array<float,2>{0.237646282f, 0.383409172f},
-std::array<float,2>{0.965584755f, 0.710390985f},
-std::array<float,2>{0.392058402f, 0.888972044f},
-std::array<float,2>{0.705423295f, 0.087826401f},
-std::array<float,2>{0.444678307f, 0.31762132f},
-std::array<float,2>{0.663688898f, 0.581786394f},
-std::array<float,2>{0.136109591f, 0.863326013f},
-std::array<float,2>{0.934808493f, 0.229893684f},
-std::array<float,2>{0.0133954976f, 0.0313429087f},
-std::array<float,2>{0.797189176f, 0.976968229f},
-std::array<float,2>{0.280414253f, 0.648577571f},
-std::array<float,2>{0.579718769f, 0.483559221f},
-std::array<float,2>{0.290971935f, 0.0916791856f},
-std::array<float,2>{0.61673069f, 0.884739697f},
-std::array<float,2>{0.0408849493f, 0.706098914f},
-std::array<float,2>{0.774226129f, 0.387890577f},
-std::array<float,2>{0.176516876f, 0.251609862f},
-std::array<float,2>{0.905568302f, 0.544011056f},
-std::array<float,2>{0.491426289f, 0.75661689f},
-std::array<float,2>{0.636119604f, 0.146945179f},
-std::array<float,2>{0.418382704f, 0.477126747f},
-std::array<float,2>{0.725239635f, 0.655734658f},
-std::array<float,2>{0.202999696f, 0.982787073f},
-std::array<float,2>{0.982944727f, 0.0371421985f},
-std::array<float,2>{0.0804320276f, 0.233210817f},
-std::array<float,2>{0.832704842f, 0.863264441f},
-std::array<float,2>{0.349137068f, 0.584560931f},
-std::array<float,2>{0.55868113f, 0.314996332f},
-std::array<float,2>{0.46261251f, 0.16838406f},
-std::array<float,2>{0.686609626f, 0.808478534f},
-std::array<float,2>{0.152823225f, 0.503389716f},
-std::array<float,2>{0.909764051f, 0.286233664f},
-std::array<float,2>{0.0236115716f, 0.434762448f},
-std::array<float,2>{0.789859474f, 0.746969521f},
-std::array<float,2>{0.261779428f, 0.922504783f},
-std::array<float,2>{0.566495061f, 0.115208566f},
-std::array<float,2>{0.325275034f, 0.367854625f},
-std::array<float,2>{0.515044391f, 0.619747341f},
-std::array<float,2>{0.110416844f, 0.833665133f},
-std::array<float,2>{0.864786386f, 0.204984054f},
-std::array<float,2>{0.221068814f, 0.00875230972f},
-std::array<float,2>{0.938219011f, 0.942247391f},
-std::array<float,2>{0.388122916f, 0.67107743f},
-std::array<float,2>{0.690089881f, 0.458636642f},
-std::array<float,2>{0.400931835f, 0.0591120906f},
-std::array<float,2>{0.715370834f, 0.996081948f},
-std::array<float,2>{0.246337116f, 0.632135332f},
-std::array<float,2>{0.955021799f, 0.495488524f},
-std::array<float,2>{0.10373468f, 0.329644054f},
-std::array<float,2>{0.847210824f, 0.568087995f},
-std::array<float,2>{0.339703798f, 0.856967628f},
-std::array<float,2>{0.517276704f, 0.237469763f},
-std::array<float,2>{0.270472556f, 0.396793604f},
-std::array<float,2>{0.59081012f, 0.695831478f},
-std::array<float,2>{0.00300083426f, 0.893190682f},
-std::array<float,2>{0.806359112f, 0.0626516789f},
-std::array<float,2>{0.127065346f, 0.125727504f},
-std::array<float,2>{0.926344037f, 0.779920578f},
-std::array<float,2>{0.449738503f, 0.553373039f},
-std::array<float,2>{0.667531729f, 0.270598978f},
-std::array<float,2>{0.36155352f, 0.19348678f},
-std::array<float,2>{0.531670928f, 0.821616232f},
-std::array<float,2>{0.0656634569f, 0.600274086f},
-std::array<float,2>{0.825454712f, 0.350210547f},
-std::array<float,2>{0.209211558f, 0.449369192f},
-std::array<float,2>{0.985705316f, 0.678993762f},
-std::array<float,2>{0.434142262f, 0.953397989f},
-std::array<float,2>{0.748432338f, 0.0181083698f},
-std::array<float,2>{0.475112408f, 0.31147182f},
-std::array<float,2>{0.649685025f, 0.52501893f},
-std::array<float,2>{0.162614182f, 0.784560442f},
-std::array<float,2>{0.878837526f, 0.181258589f},
-std::array<float,2>{0.0572568104f, 0.106762201f},
-std::array<float,2>{0.759727597f, 0.918525338f},
-std::array<float,2>{0.30998069f, 0.7292068f},
-std::array<float,2>{0.605903149f, 0.415016145f},
-std::array<float,2>{0.332664341f, 0.0258763339f},
-std::array<float,2>{0.526186883f, 0.961372495f},
-std::array<float,2>{0.0942414626f, 0.6817258f},
-std::array<float,2>{0.851750314f, 0.443467915f},
-std::array<float,2>{0.238559961f, 0.356235743f},
-std::array<float,2>{0.962312222f, 0.608492792f},
-std::array<float,2>{0.395705014f, 0.816087663f},
-std::array<float,2>{0.709519207f, 0.202144489f},
-std::array<float,2>{0.441168457f, 0.413720578f},
-std::array<float,2>{0.656514645f, 0.721542776f},
-std::array<float,2>{0.139097869f, 0.908535779f},
-std::array<float,2>{0.933563948f, 0.098528944f},
-std::array<float,2>{0.00788289309f, 0.177073076f},
-std::array<float,2>{0.803134084f, 0.795231342f},
-std::array<float,2>{0.274138838f, 0.52308327f},
-std::array<float,2>{0.585651934f, 0.303955853f},
-std::array<float,2>{0.423908085f, 0.243908867f},
-std::array<float,2>{0.738729954f, 0.847637355f},
-std::array<float,2>{0.211680904f, 0.57627213f},
-std::array<float,2>{0.995066822f, 0.336864084f},
-std::array<float,2>{0.074322179f, 0.484774143f},
-std::array<float,2>{0.813463449f, 0.63408047f},
-std::array<float,2>{0.369671702f, 0.9908216f},
-std::array<float,2>{0.546287835f, 0.0532299131f},
-std::array<float,2>{0.304647624f, 0.278595835f},
-std::array<float,2>{0.593889296f, 0.55626446f},
-std::array<float,2>{0.0471111685f, 0.767037213f},
-std::array<float,2>{0.754353344f, 0.133969337f},
-std::array<float,2>{0.170474961f, 0.0753037408f},
-std::array<float,2>{0.884027183f, 0.899368763f},
-std::array<float,2>{0.483623207f, 0.694148719f},
-std::array<float,2>{0.642459214f, 0.398614675f},
-std::array<float,2>{0.494111806f, 0.123108678f},
-std::array<float,2>{0.630809546f, 0.937334061f},
-std::array<float,2>{0.180699617f, 0.738128304f},
-std::array<float,2>{0.890992463f, 0.423974603f},
-std::array<float,2>{0.0336852968f, 0.291403413f},
-std::array<float,2>{0.768099189f, 0.511633992f},
-std::array<float,2>{0.284461081f, 0.80138725f},
-std::array<float,2>{0.617845058f, 0.162958577f},
-std::array<float,2>{0.358549505f, 0.467674702f},
-std::array<float,2>{0.552232444f, 0.662854254f},
-std::array<float,2>{0.0887650251f, 0.949857354f},
-std::array<float,2>{0.837381244f, 0.00267323595f},
-std::array<float,2>{0.189121619f, 0.21279335f},
-std::array<float,2>{0.971947432f, 0.837787151f},
-std::array<float,2>{0.410456896f, 0.613252163f},
-std::array<float,2>{0.728931844f, 0.360896677f},
-std::array<float,2>{0.255199194f, 0.152885616f},
-std::array<float,2>{0.57425946f, 0.76222533f},
-std::array<float,2>{0.0205841083f, 0.533068717f},
-std::array<float,2>{0.785342157f, 0.258159965f},
-std::array<float,2>{0.147932321f, 0.377087742f},
-std::array<float,2>{0.921416163f, 0.716221571f},
-std::array<float,2>{0.460873723f, 0.876021087f},
-std::array<float,2>{0.677687287f, 0.0819170699f},
-std::array<float,2>{0.378097594f, 0.320806265f},
-std::array<float,2>{0.6966151f, 0.58826673f},
-std::array<float,2>{0.227549076f, 0.874542236f},
-std::array<float,2>{0.947741985f, 0.222761869f},
-std::array<float,2>{0.117579862f, 0.0408230424f},
-std::array<float,2>{0.873776615f, 0.971763492f},
-std::array<float,2>{0.312781453f, 0.646151066f},
-std::array<float,2>{0.504119992f, 0.476035118f},
-std::array<float,2>{0.345418066f, 0.0957802981f},
-std::array<float,2>{0.555059791f, 0.912568986f},
-std::array<float,2>{0.0832966566f, 0.725943685f},
-std::array<float,2>{0.828759789f, 0.409172595f},
-std::array<float,2>{0.198180959f, 0.299042761f},
-std::array<float,2>{0.978806973f, 0.515686452f},
-std::array<float,2>{0.417639107f, 0.79277277f},
-std::array<float,2>{0.720277607f, 0.175720796f},
-std::array<float,2>{0.488075584f, 0.44107914f},
-std::array<float,2>{0.640366316f, 0.687479317f},
-std::array<float,2>{0.175274417f, 0.968240857f},
-std::array<float,2>{0.901815295f, 0.0299669839f},
-std::array<float,2>{0.0448826849f, 0.196375191f},
-std::array<float,2>{0.780698299f, 0.819239795f},
-std::array<float,2>{0.294067919f, 0.604575396f},
-std::array<float,2>{0.610292315f, 0.355052292f},
-std::array<float,2>{0.385973215f, 0.139298782f},
-std::array<float,2>{0.692519903f, 0.769547045f},
-std::array<float,2>{0.225886703f, 0.558888137f},
-std::array<float,2>{0.94486928f, 0.273507297f},
-std::array<float,2>{0.115973674f, 0.403575957f},
-std::array<float,2>{0.860877573f, 0.689663649f},
-std::array<float,2>{0.322999269f, 0.905034721f},
-std::array<float,2>{0.510194123f, 0.0709143803f},
-std::array<float,2>{0.257833838f, 0.340261698f},
-std::array<float,2>{0.56358397f, 0.572626054f},
-std::array<float,2>{0.03027617f, 0.851204634f},
-std::array<float,2>{0.793739021f, 0.246240586f},
-std::array<float,2>{0.149519935f, 0.0478290431f},
-std::array<float,2>{0.91152668f, 0.985271096f},
-std::array<float,2>{0.46679008f, 0.637271285f},
-std::array<float,2>{0.681692541f, 0.491784364f},
-std::array<float,2>{0.44894886f, 0.00532786036f},
-std::array<float,2>{0.671580911f, 0.946584702f},
-std::array<float,2>{0.132033467f, 0.657265782f},
-std::array<float,2>{0.922079206f, 0.462030649f},
-std::array<float,2>{0.00568183418f, 0.364343703f},
-std::array<float,2>{0.810253441f, 0.613405347f},
-std::array<float,2>{0.26609531f, 0.842578113f},
-std::array<float,2>{0.588449895f, 0.217783019f},
-std::array<float,2>{0.341597229f, 0.429556876f},
-std::array<float,2>{0.522426188f, 0.740258276f},
-std::array<float,2>{0.108659588f, 0.931520462f},
-std::array<float,2>{0.850884557f, 0.118091166f},
-std::array<float,2>{0.244167358f, 0.160050035f},
-std::array<float,2>{0.957790196f, 0.800105572f},
-std::array<float,2>{0.404719949f, 0.512098968f},
-std::array<float,2>{0.711574078f, 0.295217633f},
-std::array<float,2>{0.305076569f, 0.221177787f},
-std::array<float,2>{0.601625025f, 0.870709658f},
-std::array<float,2>{0.0596858636f, 0.589848757f},
-std::array<float,2>{0.762487113f, 0.324319124f},
-std::array<float,2>{0.157651082f, 0.469496727f},
-std::array<float,2>{0.881585181f, 0.641098082f},
-std::array<float,2>{0.470019102f, 0.976132274f},
-std::array<float,2>{0.653774023f, 0.0444878899f},
-std::array<float,2>{0.433253676f, 0.263220936f},
-std::array<float,2>{0.74294132f, 0.537313521f},
-std::array<float,2>{0.206741437f, 0.759546041f},
-std::array<float,2>{0.991954148f, 0.151040822f},
-std::array<float,2>{0.0691427886f, 0.0847210288f},
-std::array<float,2>{0.823223114f, 0.881785333f},
-std::array<float,2>{0.365870416f, 0.71155715f},
-std::array<float,2>{0.536764562f, 0.380892932f},
-std::array<float,2>{0.279976368f, 0.0333503671f},
-std::array<float,2>{0.57900995f, 0.978757918f},
-std::array<float,2>{0.0125124222f, 0.650871158f},
-std::array<float,2>{0.798711956f, 0.481112391f},
-std::array<float,2>{0.135712713f, 0.320311993f},
-std::array<float,2>{0.933867037f, 0.578362226f},
-std::array<float,2>{0.444159716f, 0.866767108f},
-std::array<float,2>{0.662905216f, 0.227633625f},
-std::array<float,2>{0.391003519f, 0.385964811f},
-std::array<float,2>{0.706270158f, 0.707934141f},
-std::array<float,2>{0.237144858f, 0.886799753f},
-std::array<float,2>{0.965942144f, 0.0879771188f},
-std::array<float,2>{0.0980986729f, 0.143993214f},
-std::array<float,2>{0.855864942f, 0.750411391f},
-std::array<float,2>{0.330165476f, 0.542578816f},
-std::array<float,2>{0.530211866f, 0.255689889f},
-std::array<float,2>{0.47739327f, 0.209479824f},
-std::array<float,2>{0.647042155f, 0.830304444f},
-std::array<float,2>{0.165001914f, 0.623353064f},
-std::array<float,2>{0.887723625f, 0.373915911f},
-std::array<float,2>{0.054500699f, 0.454401165f},
-std::array<float,2>{0.751199186f, 0.664854884f},
-std::array<float,2>{0.300478756f, 0.941364288f},
-std::array<float,2>{0.598472416f, 0.0120838312f},
-std::array<float,2>{0.374561161f, 0.282415599f},
-std::array<float,2>{0.54232955f, 0.507004857f},
-std::array<float,2>{0.0714982823f, 0.810481668f},
-std::array<float,2>{0.819651365f, 0.166335449f},
-std::array<float,2>{0.216837347f, 0.111111455f},
-std::array<float,2>{0.999868333f, 0.926054478f},
-std::array<float,2>{0.42639631f, 0.74589628f},
-std::array<float,2>{0.736085594f, 0.432321876f},
-std::array<float,2>{0.409701288f, 0.0665538013f},
-std::array<float,2>{0.733512223f, 0.896169007f},
-std::array<float,2>{0.193918601f, 0.702970922f},
-std::array<float,2>{0.97486496f, 0.393000573f},
-std::array<float,2>{0.0936897397f, 0.268971294f},
-std::array<float,2>{0.840585351f, 0.548086047f},
-std::array<float,2>{0.352267921f, 0.77527082f},
-std::array<float,2>{0.549372315f, 0.129761025f},
-std::array<float,2>{0.285967261f, 0.499201894f},
-std::array<float,2>{0.622819304f, 0.625211895f},
-std::array<float,2>{0.037469767f, 0.999204993f},
-std::array<float,2>{0.771770775f, 0.0568233207f},
-std::array<float,2>{0.184678316f, 0.239312515f},
-std::array<float,2>{0.896941662f, 0.852176189f},
-std::array<float,2>{0.497775733f, 0.565134943f},
-std::array<float,2>{0.62678504f, 0.335020721f},
-std::array<float,2>{0.317869604f, 0.185318977f},
-std::array<float,2>{0.501388133f, 0.786138356f},
-std::array<float,2>{0.122626431f, 0.529823661f},
-std::array<float,2>{0.867708981f, 0.308144599f},
-std::array<float,2>{0.233650476f, 0.421332777f},
-std::array<float,2>{0.95250994f, 0.734007299f},
-std::array<float,2>{0.382418305f, 0.917746246f},
-std::array<float,2>{0.702347279f, 0.104423545f},
-std::array<float,2>{0.453985274f, 0.344817549f},
-std::array<float,2>{0.673710763f, 0.596316934f},
-std::array<float,2>{0.141919658f, 0.827836454f},
-std::array<float,2>{0.914605021f, 0.190799609f},
-std::array<float,2>{0.0185339376f, 0.0207466558f},
-std::array<float,2>{0.781705201f, 0.96002686f},
-std::array<float,2>{0.250564665f, 0.674277842f},
-std::array<float,2>{0.572170794f, 0.446229905f},
-std::array<float,2>{0.265066922f, 0.115834542f},
-std::array<float,2>{0.569364369f, 0.925583363f},
-std::array<float,2>{0.027026929f, 0.74867332f},
-std::array<float,2>{0.79172194f, 0.436244607f},
-std::array<float,2>{0.155435279f, 0.288589627f},
-std::array<float,2>{0.907648563f, 0.500889719f},
-std::array<float,2>{0.463021696f, 0.806422055f},
-std::array<float,2>{0.683673084f, 0.17024681f},
-std::array<float,2>{0.389265686f, 0.459243625f},
-std::array<float,2>{0.68846786f, 0.668051898f},
-std::array<float,2>{0.219968349f, 0.944271803f},
-std::array<float,2>{0.941071153f, 0.00985702313f},
-std::array<float,2>{0.111920163f, 0.205823794f},
-std::array<float,2>{0.86683768f, 0.83579433f},
-std::array<float,2>{0.326882958f, 0.618500292f},
-std::array<float,2>{0.512160599f, 0.369468182f},
-std::array<float,2>{0.489083648f, 0.145316839f},
-std::array<float,2>{0.633465886f, 0.755448222f},
-std::array<float,2>{0.178757608f, 0.545793712f},
-std::array<float,2>{0.903304219f, 0.253189713f},
-std::array<float,2>{0.042749282f, 0.389489412f},
-std::array<float,2>{0.776042819f, 0.704531491f},
-std::array<float,2>{0.292896807f, 0.885244787f},
-std::array<float,2>{0.613580048f, 0.0932815298f},
-std::array<float,2>{0.350639671f, 0.313070714f},
-std::array<float,2>{0.560664296f, 0.583918154f},
-std::array<float,2>{0.078228727f, 0.859489322f},
-std::array<float,2>{0.834550023f, 0.231421754f},
-std::array<float,2>{0.200864509f, 0.0367916971f},
-std::array<float,2>{0.980853438f, 0.981834233f},
-std::array<float,2>{0.421660364f, 0.653590083f},
-std::array<float,2>{0.722657263f, 0.479445398f},
-std::array<float,2>{0.435738951f, 0.0168960411f},
-std::array<float,2>{0.746106863f, 0.956508338f},
-std::array<float,2>{0.207465515f, 0.676844358f},
-std::array<float,2>{0.987642765f, 0.452025592f},
-std::array<float,2>{0.0625698566f, 0.349352479f},
-std::array<float,2>{0.827664435f, 0.599428296f},
-std::array<float,2>{0.360273331f, 0.823073089f},
-std::array<float,2>{0.53431493f, 0.191445261f},
-std::array<float,2>{0.311311752f, 0.417197108f},
-std::array<float,2>{0.609348834f, 0.727692783f},
-std::array<float,2>{0.0564101264f, 0.921161532f},
-std::array<float,2>{0.76170063f, 0.108861253f},
-std::array<float,2>{0.161324784f, 0.18257542f},
-std::array<float,2>{0.875497699f, 0.78183049f},
-std::array<float,2>{0.473369539f, 0.527180552f},
-std::array<float,2>{0.651661992f, 0.310274363f},
-std::array<float,2>{0.336375833f, 0.235474855f},
-std::array<float,2>{0.518337667f, 0.85765475f},
-std::array<float,2>{0.102998018f, 0.568960726f},
-std::array<float,2>{0.844252467f, 0.331926584f},
-std::array<float,2>{0.248142377f, 0.492651403f},
-std::array<float,2>{0.955878258f, 0.628965199f},
-std::array<float,2>{0.398518592f, 0.993417263f},
-std::array<float,2>{0.71759218f, 0.0623658188f},
-std::array<float,2>{0.453024119f, 0.272685915f},
-std::array<float,2>{0.664632201f, 0.552426815f},
-std::array<float,2>{0.126636058f, 0.778285801f},
-std::array<float,2>{0.9292503f, 0.127510458f},
-std::array<float,2>{0.00190823618f, 0.0653125048f},
-std::array<float,2>{0.808493674f, 0.892147958f},
-std::array<float,2>{0.271493763f, 0.697752833f},
-std::array<float,2>{0.592468143f, 0.395982593f},
-std::array<float,2>{0.368867248f, 0.0526437946f},
-std::array<float,2>{0.543810606f, 0.988335848f},
-std::array<float,2>{0.0765496939f, 0.635030389f},
-std::array<float,2>{0.814693213f, 0.487567663f},
-std::array<float,2>{0.213697001f, 0.338795006f},
-std::array<float,2>{0.992388308f, 0.575279474f},
-std::array<float,2>{0.421926081f, 0.845266461f},
-std::array<float,2>{0.741054416f, 0.244497508f},
-std::array<float,2>{0.481164753f, 0.400958836f},
-std::array<float,2>{0.643171847f, 0.692770183f},
-std::array<float,2>{0.168547675f, 0.901970148f},
-std::array<float,2>{0.885328233f, 0.0762295276f},
-std::array<float,2>{0.049144648f, 0.134839699f},
-std::array<float,2>{0.757599592f, 0.769255996f},
-std::array<float,2>{0.30114311f, 0.558240116f},
-std::array<float,2>{0.596217036f, 0.28105095f},
-std::array<float,2>{0.397177488f, 0.200543717f},
-std::array<float,2>{0.708576798f, 0.812522888f},
-std::array<float,2>{0.241581991f, 0.605487823f},
-std::array<float,2>{0.964381456f, 0.358816564f},
-std::array<float,2>{0.0962800235f, 0.443169951f},
-std::array<float,2>{0.854994535f, 0.679763794f},
-std::array<float,2>{0.335845888f, 0.964097798f},
-std::array<float,2>{0.525179982f, 0.0252415184f},
-std::array<float,2>{0.27543658f, 0.302161455f},
-std::array<float,2>{0.58269912f, 0.521268368f},
-std::array<float,2>{0.0111761037f, 0.793044627f},
-std::array<float,2>{0.800912857f, 0.178555325f},
-std::array<float,2>{0.137458205f, 0.101311527f},
-std::array<float,2>{0.930368304f, 0.906461298f},
-std::array<float,2>{0.437593579f, 0.719123781f},
-std::array<float,2>{0.658317924f, 0.410577327f},
-std::array<float,2>{0.45789808f, 0.0792964548f},
-std::array<float,2>{0.679560184f, 0.877148032f},
-std::array<float,2>{0.145065337f, 0.718681872f},
-std::array<float,2>{0.918276131f, 0.375220001f},
-std::array<float,2>{0.0221365429f, 0.260907471f},
-std::array<float,2>{0.788413107f, 0.534045339f},
-std::array<float,2>{0.256841242f, 0.76379323f},
-std::array<float,2>{0.577262223f, 0.155395001f},
-std::array<float,2>{0.315338463f, 0.473040879f},
-std::array<float,2>{0.507146835f, 0.646595895f},
-std::array<float,2>{0.120868757f, 0.969864547f},
-std::array<float,2>{0.872163713f, 0.0413024127f},
-std::array<float,2>{0.230435982f, 0.225110307f},
-std::array<float,2>{0.946144581f, 0.872410834f},
-std::array<float,2>{0.375562251f, 0.587152064f},
-std::array<float,2>{0.699202955f, 0.322710037f},
-std::array<float,2>{0.281926781f, 0.161559269f},
-std::array<float,2>{0.619449794f, 0.804547429f},
-std::array<float,2>{0.0328299403f, 0.509685874f},
-std::array<float,2>{0.766251028f, 0.290806979f},
-std::array<float,2>{0.183227375f, 0.422494859f},
-std::array<float,2>{0.894507647f, 0.73522681f},
-std::array<float,2>{0.496015489f, 0.933611572f},
-std::array<float,2>{0.632405937f, 0.12243624f},
-std::array<float,2>{0.412370801f, 0.362173915f},
-std::array<float,2>{0.727510095f, 0.610240638f},
-std::array<float,2>{0.190473348f, 0.839376986f},
-std::array<float,2>{0.968809843f, 0.214454323f},
-std::array<float,2>{0.0861611292f, 0.00184851f},
-std::array<float,2>{0.838695824f, 0.951504827f},
-std::array<float,2>{0.356933504f, 0.661768019f},
-std::array<float,2>{0.554026127f, 0.465177208f},
-std::array<float,2>{0.320422649f, 0.0741459504f},
-std::array<float,2>{0.508154273f, 0.903200865f},
-std::array<float,2>{0.114698201f, 0.687691629f},
-std::array<float,2>{0.861679792f, 0.405609101f},
-std::array<float,2>{0.223909229f, 0.275604993f},
-std::array<float,2>{0.942851365f, 0.561276317f},
-std::array<float,2>{0.384556055f, 0.771484733f},
-std::array<float,2>{0.69392091f, 0.138217434f},
-std::array<float,2>{0.467721641f, 0.489749819f},
-std::array<float,2>{0.680598795f, 0.64015758f},
-std::array<float,2>{0.150527209f, 0.987343252f},
-std::array<float,2>{0.91270715f, 0.0507056005f},
-std::array<float,2>{0.0286778826f, 0.248593017f},
-std::array<float,2>{0.796139777f, 0.847870111f},
-std::array<float,2>{0.260106862f, 0.570400298f},
-std::array<float,2>{0.566350579f, 0.342909306f},
-std::array<float,2>{0.415768296f, 0.173487797f},
-std::array<float,2>{0.7210235f, 0.790071607f},
-std::array<float,2>{0.196435988f, 0.519133151f},
-std::array<float,2>{0.97668916f, 0.297809064f},
-std::array<float,2>{0.0850221962f, 0.407654852f},
-std::array<float,2>{0.830725253f, 0.724368036f},
-std::array<float,2>{0.346879989f, 0.911962628f},
-std::array<float,2>{0.558432758f, 0.0941327512f},
-std::array<float,2>{0.296830475f, 0.352914751f},
-std::array<float,2>{0.61281544f, 0.602338374f},
-std::array<float,2>{0.0462472662f, 0.817839622f},
-std::array<float,2>{0.77747345f, 0.197479069f},
-std::array<float,2>{0.172200516f, 0.0278966278f},
-std::array<float,2>{0.899364173f, 0.965567231f},
-std::array<float,2>{0.484542817f, 0.685170889f},
-std::array<float,2>{0.63825798f, 0.439194441f},
-std::array<float,2>{0.470791996f, 0.044947058f},
-std::array<float,2>{0.655601144f, 0.974532843f},
-std::array<float,2>{0.158333406f, 0.644386292f},
-std::array<float,2>{0.879030824f, 0.472025484f},
-std::array<float,2>{0.0612445734f, 0.327243209f},
-std::array<float,2>{0.765013933f, 0.591991842f},
-std::array<float,2>{0.306923062f, 0.867942631f},
-std::array<float,2>{0.604598165f, 0.220507309f},
-std::array<float,2>{0.364394784f, 0.379321516f},
-std::array<float,2>{0.53884232f, 0.713930786f},
-std::array<float,2>{0.0679456145f, 0.88027817f},
-std::array<float,2>{0.821664333f, 0.0833508149f},
-std::array<float,2>{0.204820573f, 0.148453385f},
-std::array<float,2>{0.989074886f, 0.761252642f},
-std::array<float,2>{0.430575937f, 0.536699057f},
-std::array<float,2>{0.74465549f, 0.264162987f},
-std::array<float,2>{0.26852566f, 0.215051174f},
-std::array<float,2>{0.586730838f, 0.841491342f},
-std::array<float,2>{0.00697139325f, 0.615985334f},
-std::array<float,2>{0.812268555f, 0.366779745f},
-std::array<float,2>{0.129576981f, 0.463352442f},
-std::array<float,2>{0.924686253f, 0.659977376f},
-std::array<float,2>{0.446992129f, 0.947272003f},
-std::array<float,2>{0.668874383f, 0.00650228048f},
-std::array<float,2>{0.403822303f, 0.293978274f},
-std::array<float,2>{0.71312809f, 0.515232146f},
-std::array<float,2>{0.243818715f, 0.797114253f},
-std::array<float,2>{0.959693909f, 0.157372549f},
-std::array<float,2>{0.105577156f, 0.121060111f},
-std::array<float,2>{0.848467588f, 0.93228066f},
-std::array<float,2>{0.342254102f, 0.73901695f},
-std::array<float,2>{0.521467268f, 0.427419126f},
-std::array<float,2>{0.298573107f, 0.0149074793f},
-std::array<float,2>{0.599994302f, 0.937848389f},
-std::array<float,2>{0.0524908639f, 0.667064488f},
-std::array<float,2>{0.752687991f, 0.456156224f},
-std::array<float,2>{0.167679459f, 0.372349441f},
-std::array<float,2>{0.890071332f, 0.621545076f},
-std::array<float,2>{0.478932589f, 0.829758227f},
-std::array<float,2>{0.645175636f, 0.208563074f},
-std::array<float,2>{0.429124445f, 0.430583179f},
-std::array<float,2>{0.737325132f, 0.743149757f},
-std::array<float,2>{0.215680256f, 0.929053187f},
-std::array<float,2>{0.996680796f, 0.112476945f},
-std::array<float,2>{0.0736423209f, 0.165379673f},
-std::array<float,2>{0.817197978f, 0.811733067f},
-std::array<float,2>{0.371350348f, 0.505618036f},
-std::array<float,2>{0.539124429f, 0.283568025f},
-std::array<float,2>{0.441477656f, 0.229230419f},
-std::array<float,2>{0.661463976f, 0.864342272f},
-std::array<float,2>{0.133139029f, 0.580633819f},
-std::array<float,2>{0.936071515f, 0.316632301f},
-std::array<float,2>{0.0145146446f, 0.482510805f},
-std::array<float,2>{0.800697923f, 0.649594963f},
-std::array<float,2>{0.279095739f, 0.977655709f},
-std::array<float,2>{0.581355274f, 0.0330944359f},
-std::array<float,2>{0.329834044f, 0.256592482f},
-std::array<float,2>{0.529093146f, 0.540637314f},
-std::array<float,2>{0.101015307f, 0.75325948f},
-std::array<float,2>{0.858107924f, 0.140867859f},
-std::array<float,2>{0.234878302f, 0.085986197f},
-std::array<float,2>{0.967842579f, 0.890387774f},
-std::array<float,2>{0.393491775f, 0.70923537f},
-std::array<float,2>{0.703445196f, 0.384263784f},
-std::array<float,2>{0.379202038f, 0.102963917f},
-std::array<float,2>{0.701050341f, 0.914869547f},
-std::array<float,2>{0.231267974f, 0.730785251f},
-std::array<float,2>{0.949334323f, 0.418236434f},
-std::array<float,2>{0.124922529f, 0.305367947f},
-std::array<float,2>{0.870669544f, 0.527859509f},
-std::array<float,2>{0.319509208f, 0.788258493f},
-std::array<float,2>{0.50300926f, 0.186320245f},
-std::array<float,2>{0.253103524f, 0.44741118f},
-std::array<float,2>{0.574000418f, 0.672675431f},
-std::array<float,2>{0.0173128508f, 0.957343698f},
-std::array<float,2>{0.78438741f, 0.0217628926f},
-std::array<float,2>{0.143535614f, 0.188208878f},
-std::array<float,2>{0.916240036f, 0.825325251f},
-std::array<float,2>{0.456240743f, 0.594802082f},
-std::array<float,2>{0.675057232f, 0.347008228f},
-std::array<float,2>{0.355363131f, 0.131230667f},
-std::array<float,2>{0.548712015f, 0.77721262f},
-std::array<float,2>{0.0917765051f, 0.548962295f},
-std::array<float,2>{0.843489051f, 0.266879052f},
-std::array<float,2>{0.191773117f, 0.392413229f},
-std::array<float,2>{0.973020315f, 0.700252235f},
-std::array<float,2>{0.408156037f, 0.897979915f},
-std::array<float,2>{0.732239068f, 0.0687713251f},
-std::array<float,2>{0.49973312f, 0.333609462f},
-std::array<float,2>{0.628657818f, 0.563630521f},
-std::array<float,2>{0.186086282f, 0.854357362f},
-std::array<float,2>{0.894927621f, 0.240692347f},
-std::array<float,2>{0.0368610956f, 0.0551855378f},
-std::array<float,2>{0.771144927f, 0.996781826f},
-std::array<float,2>{0.287632138f, 0.627098083f},
-std::array<float,2>{0.623236895f, 0.497879326f},
-std::array<float,2>{0.277714789f, 0.0881455615f},
-std::array<float,2>{0.580540061f, 0.886980653f},
-std::array<float,2>{0.0148102771f, 0.70758611f},
-std::array<float,2>{0.79886359f, 0.386038363f},
-std::array<float,2>{0.134435445f, 0.255463213f},
-std::array<float,2>{0.936843812f, 0.542908132f},
-std::array<float,2>{0.443324536f, 0.750091374f},
-std::array<float,2>{0.660182416f, 0.14375636f},
-std::array<float,2>{0.393957406f, 0.481347293f},
-std::array<float,2>{0.705058157f, 0.650604784f},
-std::array<float,2>{0.236168265f, 0.978858471f},
-std::array<float,2>{0.967211127f, 0.0336216614f},
-std::array<float,2>{0.099852629f, 0.227867872f},
-std::array<float,2>{0.858989179f, 0.867035031f},
-std::array<float,2>{0.328436702f, 0.578593075f},
-std::array<float,2>{0.528084338f, 0.320007741f},
-std::array<float,2>{0.479720473f, 0.166043177f},
-std::array<float,2>{0.645996511f, 0.810088933f},
-std::array<float,2>{0.166218221f, 0.507106304f},
-std::array<float,2>{0.889117479f, 0.28263393f},
-std::array<float,2>{0.0508752242f, 0.432581812f},
-std::array<float,2>{0.753686965f, 0.745831013f},
-std::array<float,2>{0.297059685f, 0.925879955f},
-std::array<float,2>{0.600966096f, 0.11096473f},
-std::array<float,2>{0.372402579f, 0.37375164f},
-std::array<float,2>{0.540589988f, 0.623225391f},
-std::array<float,2>{0.0726625249f, 0.83040905f},
-std::array<float,2>{0.818283439f, 0.209882408f},
-std::array<float,2>{0.216559246f, 0.0117931394f},
-std::array<float,2>{0.998044491f, 0.940978348f},
-std::array<float,2>{0.42840597f, 0.664727747f},
-std::array<float,2>{0.737046897f, 0.454133689f},
-std::array<float,2>{0.406429946f, 0.0569852255f},
-std::array<float,2>{0.730746388f, 0.999302983f},
-std::array<float,2>{0.192389667f, 0.62537384f},
-std::array<float,2>{0.974454403f, 0.49937135f},
-std::array<float,2>{0.0899807662f, 0.335431039f},
-std::array<float,2>{0.84223187f, 0.565388918f},
-std::array<float,2>{0.353557467f, 0.852380812f},
-std::array<float,2>{0.547008514f, 0.239552706f},
-std::array<float,2>{0.288874507f, 0.392784685f},
-std::array<float,2>{0.624933839f, 0.702797532f},
-std::array<float,2>{0.0359322131f, 0.896247864f},
-std::array<float,2>{0.769762516f, 0.0668140501f},
-std::array<float,2>{0.186613679f, 0.129577175f},
-std::array<float,2>{0.895529509f, 0.775076985f},
-std::array<float,2>{0.498382717f, 0.548173785f},
-std::array<float,2>{0.627707839f, 0.268752337f},
-std::array<float,2>{0.319028467f, 0.190476447f},
-std::array<float,2>{0.502885342f, 0.82799083f},
-std::array<float,2>{0.123278856f, 0.596654654f},
-std::array<float,2>{0.869366527f, 0.344989806f},
-std::array<float,2>{0.232388869f, 0.445934445f},
-std::array<float,2>{0.95037055f, 0.673882961f},
-std::array<float,2>{0.380653709f, 0.960225344f},
-std::array<float,2>{0.699539542f, 0.0208421573f},
-std::array<float,2>{0.455285132f, 0.308529288f},
-std::array<float,2>{0.674337745f, 0.530158103f},
-std::array<float,2>{0.144351065f, 0.786549747f},
-std::array<float,2>{0.917701006f, 0.185276598f},
-std::array<float,2>{0.0165884178f, 0.104059659f},
-std::array<float,2>{0.784070492f, 0.917573333f},
-std::array<float,2>{0.252828419f, 0.734208703f},
-std::array<float,2>{0.573213518f, 0.421075821f},
-std::array<float,2>{0.346380889f, 0.0301100798f},
-std::array<float,2>{0.55676651f, 0.967959702f},
-std::array<float,2>{0.0841498524f, 0.687155485f},
-std::array<float,2>{0.831408739f, 0.441327631f},
-std::array<float,2>{0.195387051f, 0.355423242f},
-std::array<float,2>{0.978057504f, 0.604915738f},
-std::array<float,2>{0.414862007f, 0.818935812f},
-std::array<float,2>{0.722269952f, 0.196745902f},
-std::array<float,2>{0.485608101f, 0.408849388f},
-std::array<float,2>{0.637438655f, 0.725770295f},
-std::array<float,2>{0.173149168f, 0.912166953f},
-std::array<float,2>{0.899722517f, 0.0961706489f},
-std::array<float,2>{0.0455424972f, 0.175528646f},
-std::array<float,2>{0.77867806f, 0.792608678f},
-std::array<float,2>{0.295369595f, 0.516067505f},
-std::array<float,2>{0.611373127f, 0.29916665f},
-std::array<float,2>{0.382976949f, 0.246382177f},
-std::array<float,2>{0.694676518f, 0.851509571f},
-std::array<float,2>{0.223423883f, 0.572278917f},
-std::array<float,2>{0.941435635f, 0.339979202f},
-std::array<float,2>{0.113936052f, 0.492049456f},
-std::array<float,2>{0.862446725f, 0.637631476f},
-std::array<float,2>{0.321337193f, 0.984956741f},
-std::array<float,2>{0.509315252f, 0.0474766865f},
-std::array<float,2>{0.261045426f, 0.273735136f},
-std::array<float,2>{0.565265775f, 0.558716238f},
-std::array<float,2>{0.0279753432f, 0.769916475f},
-std::array<float,2>{0.795773804f, 0.139468193f},
-std::array<float,2>{0.151597321f, 0.071157828f},
-std::array<float,2>{0.913685143f, 0.904813826f},
-std::array<float,2>{0.468565136f, 0.689796209f},
-std::array<float,2>{0.680707812f, 0.403484315f},
-std::array<float,2>{0.445833266f, 0.11777544f},
-std::array<float,2>{0.669123411f, 0.931334734f},
-std::array<float,2>{0.130481258f, 0.740676522f},
-std::array<float,2>{0.925699353f, 0.429204702f},
-std::array<float,2>{0.00645900704f, 0.295111179f},
-std::array<float,2>{0.810740054f, 0.511798024f},
-std::array<float,2>{0.268921673f, 0.799967587f},
-std::array<float,2>{0.587718904f, 0.159870967f},
-std::array<float,2>{0.343231857f, 0.462284774f},
-std::array<float,2>{0.519769132f, 0.657598794f},
-std::array<float,2>{0.107171923f, 0.946321368f},
-std::array<float,2>{0.84960711f, 0.00511911279f},
-std::array<float,2>{0.242986232f, 0.218177244f},
-std::array<float,2>{0.960545361f, 0.842395663f},
-std::array<float,2>{0.403079987f, 0.613658965f},
-std::array<float,2>{0.714534819f, 0.364564389f},
-std::array<float,2>{0.307838827f, 0.151252538f},
-std::array<float,2>{0.604423821f, 0.759355128f},
-std::array<float,2>{0.061972551f, 0.537533402f},
-std::array<float,2>{0.764597297f, 0.263587177f},
-std::array<float,2>{0.160082027f, 0.381170481f},
-std::array<float,2>{0.880292773f, 0.711889863f},
-std::array<float,2>{0.472074836f, 0.881463647f},
-std::array<float,2>{0.655199468f, 0.0844790488f},
-std::array<float,2>{0.431284487f, 0.324545681f},
-std::array<float,2>{0.745898962f, 0.590214074f},
-std::array<float,2>{0.20344229f, 0.870985031f},
-std::array<float,2>{0.989288151f, 0.220818937f},
-std::array<float,2>{0.0668587834f, 0.044843439f},
-std::array<float,2>{0.820983052f, 0.97649169f},
-std::array<float,2>{0.363717407f, 0.640826285f},
-std::array<float,2>{0.537867725f, 0.4694314f},
-std::array<float,2>{0.334623426f, 0.0982555896f},
-std::array<float,2>{0.524394095f, 0.908247888f},
-std::array<float,2>{0.0975656733f, 0.721385896f},
-std::array<float,2>{0.854485691f, 0.413927048f},
-std::array<float,2>{0.240272075f, 0.303887427f},
-std::array<float,2>{0.962970316f, 0.523311973f},
-std::array<float,2>{0.398392856f, 0.795018494f},
-std::array<float,2>{0.707337737f, 0.176979274f},
-std::array<float,2>{0.438650131f, 0.443722755f},
-std::array<float,2>{0.659314811f, 0.682067573f},
-std::array<float,2>{0.138236344f, 0.96112591f},
-std::array<float,2>{0.931551039f, 0.0255014673f},
-std::array<float,2>{0.0107105905f, 0.201795086f},
-std::array<float,2>{0.802066386f, 0.816168547f},
-std::array<float,2>{0.276928246f, 0.608872056f},
-std::array<float,2>{0.583475649f, 0.356036097f},
-std::array<float,2>{0.423249424f, 0.134075806f},
-std::array<float,2>{0.741460085f, 0.76660949f},
-std::array<float,2>{0.214437783f, 0.556574523f},
-std::array<float,2>{0.99403888f, 0.278505325f},
-std::array<float,2>{0.0780451968f, 0.398759156f},
-std::array<float,2>{0.8159706f, 0.693985283f},
-std::array<float,2>{0.367321938f, 0.898929358f},
-std::array<float,2>{0.544249058f, 0.0755965561f},
-std::array<float,2>{0.302249074f, 0.336643875f},
-std::array<float,2>{0.597335756f, 0.576524734f},
-std::array<float,2>{0.0501528159f, 0.847326338f},
-std::array<float,2>{0.756833017f, 0.243723303f},
-std::array<float,2>{0.169624478f, 0.0534981564f},
-std::array<float,2>{0.886367857f, 0.991048813f},
-std::array<float,2>{0.481960505f, 0.633901238f},
-std::array<float,2>{0.643780172f, 0.484579712f},
-std::array<float,2>{0.494802982f, 0.00276231742f},
-std::array<float,2>{0.631747782f, 0.950096548f},
-std::array<float,2>{0.182473242f, 0.662719846f},
-std::array<float,2>{0.892880797f, 0.467431724f},
-std::array<float,2>{0.0315933302f, 0.361093849f},
-std::array<float,2>{0.76699549f, 0.612872899f},
-std::array<float,2>{0.282967776f, 0.837480962f},
-std::array<float,2>{0.620818079f, 0.212564752f},
-std::array<float,2>{0.355561912f, 0.424265891f},
-std::array<float,2>{0.553379774f, 0.737809837f},
-std::array<float,2>{0.0873321965f, 0.937023878f},
-std::array<float,2>{0.839638531f, 0.123336352f},
-std::array<float,2>{0.190012679f, 0.162710056f},
-std::array<float,2>{0.970231473f, 0.80158329f},
-std::array<float,2>{0.413929254f, 0.511296093f},
-std::array<float,2>{0.727976799f, 0.291180253f},
-std::array<float,2>{0.2566185f, 0.223028377f},
-std::array<float,2>{0.57666862f, 0.874924958f},
-std::array<float,2>{0.0229762085f, 0.58812952f},
-std::array<float,2>{0.787535787f, 0.321187407f},
-std::array<float,2>{0.145946294f, 0.475797653f},
-std::array<float,2>{0.919770598f, 0.646254003f},
-std::array<float,2>{0.458463639f, 0.972093701f},
-std::array<float,2>{0.678038359f, 0.0405485854f},
-std::array<float,2>{0.376219004f, 0.25789535f},
-std::array<float,2>{0.697364807f, 0.532917321f},
-std::array<float,2>{0.229213014f, 0.762538314f},
-std::array<float,2>{0.946341753f, 0.153219774f},
-std::array<float,2>{0.119960383f, 0.081719242f},
-std::array<float,2>{0.871665239f, 0.876380205f},
-std::array<float,2>{0.316170573f, 0.716027558f},
-std::array<float,2>{0.506249666f, 0.377216369f},
-std::array<float,2>{0.291929752f, 0.037581373f},
-std::array<float,2>{0.614759147f, 0.982521534f},
-std::array<float,2>{0.0412235931f, 0.655473173f},
-std::array<float,2>{0.776949644f, 0.477367103f},
-std::array<float,2>{0.178207815f, 0.315205425f},
-std::array<float,2>{0.904123068f, 0.584822655f},
-std::array<float,2>{0.48930195f, 0.862881184f},
-std::array<float,2>{0.634317994f, 0.232965127f},
-std::array<float,2>{0.420421451f, 0.388152301f},
-std::array<float,2>{0.724236131f, 0.706475437f},
-std::array<float,2>{0.199907377f, 0.884343207f},
-std::array<float,2>{0.982201517f, 0.0913640112f},
-std::array<float,2>{0.0793578848f, 0.146634266f},
-std::array<float,2>{0.835146368f, 0.756391168f},
-std::array<float,2>{0.349910349f, 0.544199944f},
-std::array<float,2>{0.562283278f, 0.251939625f},
-std::array<float,2>{0.464005798f, 0.204630107f},
-std::array<float,2>{0.684919298f, 0.833956182f},
-std::array<float,2>{0.154634684f, 0.619988859f},
-std::array<float,2>{0.907074451f, 0.368067652f},
-std::array<float,2>{0.0260075182f, 0.458771646f},
-std::array<float,2>{0.792771161f, 0.671361685f},
-std::array<float,2>{0.264309257f, 0.942104757f},
-std::array<float,2>{0.568465471f, 0.00830659922f},
-std::array<float,2>{0.327462435f, 0.286404729f},
-std::array<float,2>{0.513126791f, 0.502970576f},
-std::array<float,2>{0.112942703f, 0.808301926f},
-std::array<float,2>{0.865629971f, 0.168127179f},
-std::array<float,2>{0.219547898f, 0.114757627f},
-std::array<float,2>{0.939470828f, 0.922738731f},
-std::array<float,2>{0.390369087f, 0.746698737f},
-std::array<float,2>{0.688576221f, 0.43505007f},
-std::array<float,2>{0.399946362f, 0.0628351271f},
-std::array<float,2>{0.718511701f, 0.893407583f},
-std::array<float,2>{0.249545634f, 0.696230471f},
-std::array<float,2>{0.956168532f, 0.396579117f},
-std::array<float,2>{0.101632603f, 0.270829797f},
-std::array<float,2>{0.844895959f, 0.553505421f},
-std::array<float,2>{0.337440938f, 0.780103683f},
-std::array<float,2>{0.51943028f, 0.125895321f},
-std::array<float,2>{0.273021847f, 0.495350778f},
-std::array<float,2>{0.592821181f, 0.631878376f},
-std::array<float,2>{0.000312855089f, 0.995699286f},
-std::array<float,2>{0.807343185f, 0.0595532134f},
-std::array<float,2>{0.125558197f, 0.237783924f},
-std::array<float,2>{0.928142428f, 0.857187152f},
-std::array<float,2>{0.452112854f, 0.568269908f},
-std::array<float,2>{0.665464282f, 0.329892695f},
-std::array<float,2>{0.361313492f, 0.181533083f},
-std::array<float,2>{0.533385754f, 0.784278572f},
-std::array<float,2>{0.0644520149f, 0.525323033f},
-std::array<float,2>{0.826889098f, 0.311267018f},
-std::array<float,2>{0.208466902f, 0.414585769f},
-std::array<float,2>{0.986521423f, 0.729249954f},
-std::array<float,2>{0.437301248f, 0.918863475f},
-std::array<float,2>{0.747589409f, 0.10664124f},
-std::array<float,2>{0.473974764f, 0.350517035f},
-std::array<float,2>{0.650800407f, 0.60051465f},
-std::array<float,2>{0.160498485f, 0.821378827f},
-std::array<float,2>{0.876880944f, 0.193669662f},
-std::array<float,2>{0.0549607947f, 0.0184409302f},
-std::array<float,2>{0.760733545f, 0.953265607f},
-std::array<float,2>{0.311656594f, 0.678763032f},
-std::array<float,2>{0.608328938f, 0.449653417f},
-std::array<float,2>{0.299484402f, 0.11256025f},
-std::array<float,2>{0.599237621f, 0.928823829f},
-std::array<float,2>{0.0534684025f, 0.742902756f},
-std::array<float,2>{0.750947475f, 0.430349618f},
-std::array<float,2>{0.166006804f, 0.28325814f},
-std::array<float,2>{0.886753798f, 0.505433738f},
-std::array<float,2>{0.477547944f, 0.8119874f},
-std::array<float,2>{0.648021638f, 0.165135935f},
-std::array<float,2>{0.427476794f, 0.4564206f},
-std::array<float,2>{0.735269189f, 0.667396426f},
-std::array<float,2>{0.21784547f, 0.937600017f},
-std::array<float,2>{0.99852097f, 0.0146872522f},
-std::array<float,2>{0.070784308f, 0.208793461f},
-std::array<float,2>{0.818824351f, 0.830033123f},
-std::array<float,2>{0.373236954f, 0.621101141f},
-std::array<float,2>{0.541258454f, 0.372232199f},
-std::array<float,2>{0.445199013f, 0.141079947f},
-std::array<float,2>{0.663515151f, 0.753154993f},
-std::array<float,2>{0.136292756f, 0.540816963f},
-std::array<float,2>{0.93539983f, 0.256407797f},
-std::array<float,2>{0.0129390629f, 0.383846343f},
-std::array<float,2>{0.797802985f, 0.709005475f},
-std::array<float,2>{0.280864149f, 0.890213907f},
-std::array<float,2>{0.579208076f, 0.0863406435f},
-std::array<float,2>{0.331944466f, 0.316793263f},
-std::array<float,2>{0.530284762f, 0.581003189f},
-std::array<float,2>{0.0992119014f, 0.864678919f},
-std::array<float,2>{0.857088029f, 0.229351863f},
-std::array<float,2>{0.237997979f, 0.032853473f},
-std::array<float,2>{0.965158522f, 0.977962196f},
-std::array<float,2>{0.392537326f, 0.649721503f},
-std::array<float,2>{0.705867529f, 0.482712835f},
-std::array<float,2>{0.380920053f, 0.0216960218f},
-std::array<float,2>{0.701345026f, 0.95723933f},
-std::array<float,2>{0.232785061f, 0.6724388f},
-std::array<float,2>{0.951699734f, 0.447522074f},
-std::array<float,2>{0.121606104f, 0.346784174f},
-std::array<float,2>{0.868908465f, 0.595090508f},
-std::array<float,2>{0.316498369f, 0.825511575f},
-std::array<float,2>{0.500597596f, 0.188384309f},
-std::array<float,2>{0.251547396f, 0.418033481f},
-std::array<float,2>{0.571114123f, 0.730512798f},
-std::array<float,2>{0.0188351274f, 0.914758801f},
-std::array<float,2>{0.782338738f, 0.102644958f},
-std::array<float,2>{0.140901521f, 0.186174512f},
-std::array<float,2>{0.915309191f, 0.788503468f},
-std::array<float,2>{0.454288751f, 0.528144896f},
-std::array<float,2>{0.672253311f, 0.305560559f},
-std::array<float,2>{0.35263747f, 0.240342498f},
-std::array<float,2>{0.550056279f, 0.854178667f},
-std::array<float,2>{0.0922084525f, 0.563771725f},
-std::array<float,2>{0.841765583f, 0.333946407f},
-std::array<float,2>{0.194889486f, 0.497728884f},
-std::array<float,2>{0.976285338f, 0.627265632f},
-std::array<float,2>{0.408438355f, 0.996891975f},
-std::array<float,2>{0.733014107f, 0.0556290299f},
-std::array<float,2>{0.496473998f, 0.266766965f},
-std::array<float,2>{0.625667334f, 0.549314559f},
-std::array<float,2>{0.184078813f, 0.77705729f},
-std::array<float,2>{0.89827323f, 0.130944178f},
-std::array<float,2>{0.0389355086f, 0.0683742762f},
-std::array<float,2>{0.772674561f, 0.898413777f},
-std::array<float,2>{0.286537319f, 0.700483322f},
-std::array<float,2>{0.621552289f, 0.392206639f},
-std::array<float,2>{0.3235614f, 0.0504779406f},
-std::array<float,2>{0.511589646f, 0.987565041f},
-std::array<float,2>{0.116437674f, 0.640605271f},
-std::array<float,2>{0.859811604f, 0.490106642f},
-std::array<float,2>{0.224646688f, 0.343202829f},
-std::array<float,2>{0.944129646f, 0.570647657f},
-std::array<float,2>{0.385415971f, 0.848008871f},
-std::array<float,2>{0.691834033f, 0.248820856f},
-std::array<float,2>{0.465729505f, 0.405385047f},
-std::array<float,2>{0.683252275f, 0.687806368f},
-std::array<float,2>{0.148830652f, 0.902920127f},
-std::array<float,2>{0.910591781f, 0.0737946779f},
-std::array<float,2>{0.0297303461f, 0.138643757f},
-std::array<float,2>{0.794316471f, 0.771745622f},
-std::array<float,2>{0.258803099f, 0.561429322f},
-std::array<float,2>{0.563376129f, 0.275853515f},
-std::array<float,2>{0.416982979f, 0.19755432f},
-std::array<float,2>{0.718782961f, 0.817498386f},
-std::array<float,2>{0.198606163f, 0.602119744f},
-std::array<float,2>{0.979783773f, 0.352725536f},
-std::array<float,2>{0.0828492194f, 0.439344972f},
-std::array<float,2>{0.82959646f, 0.685422778f},
-std::array<float,2>{0.343778938f, 0.965633392f},
-std::array<float,2>{0.556390047f, 0.0282623731f},
-std::array<float,2>{0.293364018f, 0.297384083f},
-std::array<float,2>{0.610741079f, 0.519408047f},
-std::array<float,2>{0.0435066f, 0.790312469f},
-std::array<float,2>{0.780175567f, 0.17366609f},
-std::array<float,2>{0.174006507f, 0.0939365923f},
-std::array<float,2>{0.900499046f, 0.911767304f},
-std::array<float,2>{0.487075627f, 0.724264503f},
-std::array<float,2>{0.638996124f, 0.407328546f},
-std::array<float,2>{0.469361007f, 0.0832476988f},
-std::array<float,2>{0.65302676f, 0.879886627f},
-std::array<float,2>{0.156808943f, 0.714226663f},
-std::array<float,2>{0.882608294f, 0.379013211f},
-std::array<float,2>{0.0590197444f, 0.264523596f},
-std::array<float,2>{0.762770712f, 0.537108779f},
-std::array<float,2>{0.306635529f, 0.761688411f},
-std::array<float,2>{0.602685511f, 0.14886108f},
-std::array<float,2>{0.366746545f, 0.471812934f},
-std::array<float,2>{0.536101997f, 0.644106269f},
-std::array<float,2>{0.0700309053f, 0.974178731f},
-std::array<float,2>{0.82335043f, 0.0452978648f},
-std::array<float,2>{0.205838338f, 0.220336631f},
-std::array<float,2>{0.991115332f, 0.867789268f},
-std::array<float,2>{0.43250221f, 0.592042446f},
-std::array<float,2>{0.74413228f, 0.327515692f},
-std::array<float,2>{0.26686582f, 0.15750812f},
-std::array<float,2>{0.588867188f, 0.797357619f},
-std::array<float,2>{0.00455499301f, 0.515445232f},
-std::array<float,2>{0.808721125f, 0.294365793f},
-std::array<float,2>{0.131675079f, 0.427512258f},
-std::array<float,2>{0.923253953f, 0.738940597f},
-std::array<float,2>{0.448191106f, 0.932457685f},
-std::array<float,2>{0.670459211f, 0.120698094f},
-std::array<float,2>{0.405568957f, 0.366957933f},
-std::array<float,2>{0.712365925f, 0.615803182f},
-std::array<float,2>{0.245211184f, 0.841766953f},
-std::array<float,2>{0.958461463f, 0.215214819f},
-std::array<float,2>{0.107595868f, 0.0067186011f},
-std::array<float,2>{0.850490928f, 0.947610021f},
-std::array<float,2>{0.34063369f, 0.659891248f},
-std::array<float,2>{0.522552192f, 0.462970138f},
-std::array<float,2>{0.370373964f, 0.0765109435f},
-std::array<float,2>{0.545010328f, 0.902115822f},
-std::array<float,2>{0.075769335f, 0.692615151f},
-std::array<float,2>{0.814296842f, 0.401144296f},
-std::array<float,2>{0.212859258f, 0.280911118f},
-std::array<float,2>{0.995151818f, 0.558548391f},
-std::array<float,2>{0.425050318f, 0.769433975f},
-std::array<float,2>{0.739778936f, 0.135149553f},
-std::array<float,2>{0.48279351f, 0.487524182f},
-std::array<float,2>{0.641122818f, 0.634859025f},
-std::array<float,2>{0.171274185f, 0.988663256f},
-std::array<float,2>{0.883600771f, 0.05235238f},
-std::array<float,2>{0.0482828319f, 0.244289637f},
-std::array<float,2>{0.755296767f, 0.845623314f},
-std::array<float,2>{0.303702086f, 0.575666547f},
-std::array<float,2>{0.595236182f, 0.338462979f},
-std::array<float,2>{0.394671291f, 0.178229988f},
-std::array<float,2>{0.710705698f, 0.793383002f},
-std::array<float,2>{0.239333481f, 0.521090746f},
-std::array<float,2>{0.961666942f, 0.30183816f},
-std::array<float,2>{0.0956813395f, 0.410353601f},
-std::array<float,2>{0.852817535f, 0.718768358f},
-std::array<float,2>{0.333082825f, 0.906595588f},
-std::array<float,2>{0.527072072f, 0.101520918f},
-std::array<float,2>{0.275380582f, 0.358438671f},
-std::array<float,2>{0.584653199f, 0.605775654f},
-std::array<float,2>{0.00924616586f, 0.812965572f},
-std::array<float,2>{0.803993046f, 0.20043318f},
-std::array<float,2>{0.140029401f, 0.0249538552f},
-std::array<float,2>{0.931922555f, 0.964176834f},
-std::array<float,2>{0.440155745f, 0.679961443f},
-std::array<float,2>{0.657509327f, 0.442877173f},
-std::array<float,2>{0.459313452f, 0.0412471145f},
-std::array<float,2>{0.675788105f, 0.970201373f},
-std::array<float,2>{0.147223428f, 0.646779835f},
-std::array<float,2>{0.92034179f, 0.472724736f},
-std::array<float,2>{0.0198358428f, 0.322398305f},
-std::array<float,2>{0.786616921f, 0.587159216f},
-std::array<float,2>{0.25464347f, 0.872272015f},
-std::array<float,2>{0.575841665f, 0.225443721f},
-std::array<float,2>{0.313669533f, 0.375252783f},
-std::array<float,2>{0.505608797f, 0.718484461f},
-std::array<float,2>{0.118677355f, 0.877248704f},
-std::array<float,2>{0.874821901f, 0.0793801472f},
-std::array<float,2>{0.226919755f, 0.155618876f},
-std::array<float,2>{0.948488533f, 0.764134645f},
-std::array<float,2>{0.377219468f, 0.533887923f},
-std::array<float,2>{0.696246266f, 0.261106998f},
-std::array<float,2>{0.283901542f, 0.214714855f},
-std::array<float,2>{0.618865609f, 0.83962363f},
-std::array<float,2>{0.0345695689f, 0.610009909f},
-std::array<float,2>{0.769387424f, 0.3619847f},
-std::array<float,2>{0.180264845f, 0.464948714f},
-std::array<float,2>{0.89181453f, 0.662107766f},
-std::array<float,2>{0.492474288f, 0.951304257f},
-std::array<float,2>{0.629620671f, 0.0015359869f},
-std::array<float,2>{0.411299616f, 0.290625662f},
-std::array<float,2>{0.730161667f, 0.509502411f},
-std::array<float,2>{0.18791306f, 0.804262042f},
-std::array<float,2>{0.971541107f, 0.161238074f},
-std::array<float,2>{0.0898265019f, 0.122086331f},
-std::array<float,2>{0.836912394f, 0.933896899f},
-std::array<float,2>{0.358378261f, 0.735086679f},
-std::array<float,2>{0.550801754f, 0.422844768f},
-std::array<float,2>{0.263400912f, 0.0102455635f},
-std::array<float,2>{0.568148255f, 0.944072306f},
-std::array<float,2>{0.0245284252f, 0.668310583f},
-std::array<float,2>{0.790265322f, 0.459026426f},
-std::array<float,2>{0.153926581f, 0.369339943f},
-std::array<float,2>{0.908279598f, 0.618322849f},
-std::array<float,2>{0.461099297f, 0.835594118f},
-std::array<float,2>{0.685596108f, 0.20575203f},
-std::array<float,2>{0.387087673f, 0.436475098f},
-std::array<float,2>{0.690542459f, 0.748938918f},
-std::array<float,2>{0.222595677f, 0.9254601f},
-std::array<float,2>{0.93867147f, 0.116180636f},
-std::array<float,2>{0.110305376f, 0.169941038f},
-std::array<float,2>{0.86361599f, 0.806159377f},
-std::array<float,2>{0.324779332f, 0.500529826f},
-std::array<float,2>{0.514468729f, 0.288894594f},
-std::array<float,2>{0.490275025f, 0.231172159f},
-std::array<float,2>{0.635222495f, 0.859631538f},
-std::array<float,2>{0.176773399f, 0.583688974f},
-std::array<float,2>{0.905115366f, 0.313344002f},
-std::array<float,2>{0.0397592187f, 0.479045957f},
-std::array<float,2>{0.774891615f, 0.653533816f},
-std::array<float,2>{0.289738357f, 0.981513619f},
-std::array<float,2>{0.615628421f, 0.0370927006f},
-std::array<float,2>{0.348232865f, 0.253123909f},
-std::array<float,2>{0.559767902f, 0.545514405f},
-std::array<float,2>{0.0817386582f, 0.755641162f},
-std::array<float,2>{0.833111882f, 0.145160988f},
-std::array<float,2>{0.201989323f, 0.093671754f},
-std::array<float,2>{0.98398912f, 0.884767175f},
-std::array<float,2>{0.419509798f, 0.704120636f},
-std::array<float,2>{0.726495087f, 0.389236033f},
-std::array<float,2>{0.43479228f, 0.108452067f},
-std::array<float,2>{0.749541759f, 0.921034575f},
-std::array<float,2>{0.210250095f, 0.727971256f},
-std::array<float,2>{0.98448813f, 0.417463273f},
-std::array<float,2>{0.065399617f, 0.310332179f},
-std::array<float,2>{0.825173795f, 0.526942849f},
-std::array<float,2>{0.362730861f, 0.782183468f},
-std::array<float,2>{0.532946885f, 0.182132825f},
-std::array<float,2>{0.309299022f, 0.451677382f},
-std::array<float,2>{0.606671453f, 0.677117407f},
-std::array<float,2>{0.0585087799f, 0.956130743f},
-std::array<float,2>{0.757837713f, 0.0167872515f},
-std::array<float,2>{0.16334784f, 0.191818625f},
-std::array<float,2>{0.877595425f, 0.822953463f},
-std::array<float,2>{0.475850999f, 0.599135578f},
-std::array<float,2>{0.648970187f, 0.349394619f},
-std::array<float,2>{0.338278472f, 0.127793536f},
-std::array<float,2>{0.516244054f, 0.778057575f},
-std::array<float,2>{0.104522578f, 0.55252552f},
-std::array<float,2>{0.845981061f, 0.272730082f},
-std::array<float,2>{0.247899592f, 0.395528585f},
-std::array<float,2>{0.953336298f, 0.697358787f},
-std::array<float,2>{0.40140149f, 0.892488241f},
-std::array<float,2>{0.71664691f, 0.0650939345f},
-std::array<float,2>{0.450829417f, 0.331655145f},
-std::array<float,2>{0.666781545f, 0.569296658f},
-std::array<float,2>{0.12879324f, 0.857748389f},
-std::array<float,2>{0.926974356f, 0.235827774f},
-std::array<float,2>{0.0026376117f, 0.0621940121f},
-std::array<float,2>{0.804753721f, 0.993188679f},
-std::array<float,2>{0.271206856f, 0.629392207f},
-std::array<float,2>{0.590930283f, 0.492286146f},
-std::array<float,2>{0.285541505f, 0.0681479499f},
-std::array<float,2>{0.622354269f, 0.894580483f},
-std::array<float,2>{0.0378566049f, 0.701931953f},
-std::array<float,2>{0.772388518f, 0.394101709f},
-std::array<float,2>{0.185253888f, 0.268342286f},
-std::array<float,2>{0.897333801f, 0.547338188f},
-std::array<float,2>{0.497504056f, 0.773583829f},
-std::array<float,2>{0.626370847f, 0.130278483f},
-std::array<float,2>{0.409657627f, 0.498839676f},
-std::array<float,2>{0.734129608f, 0.626423955f},
-std::array<float,2>{0.193426594f, 0.998948157f},
-std::array<float,2>{0.975377977f, 0.0585119613f},
-std::array<float,2>{0.0928661823f, 0.239100859f},
-std::array<float,2>{0.840023577f, 0.853504658f},
-std::array<float,2>{0.351736277f, 0.566319168f},
-std::array<float,2>{0.54926008f, 0.334825814f},
-std::array<float,2>{0.453498632f, 0.184185877f},
-std::array<float,2>{0.67326802f, 0.785593927f},
-std::array<float,2>{0.142551258f, 0.53086555f},
-std::array<float,2>{0.914499581f, 0.307585984f},
-std::array<float,2>{0.0177761056f, 0.420789093f},
-std::array<float,2>{0.781936646f, 0.732905567f},
-std::array<float,2>{0.250161409f, 0.91643995f},
-std::array<float,2>{0.571322203f, 0.104864426f},
-std::array<float,2>{0.318288624f, 0.344694853f},
-std::array<float,2>{0.501510262f, 0.596761346f},
-std::array<float,2>{0.12246421f, 0.827039838f},
-std::array<float,2>{0.867645323f, 0.18978098f},
-std::array<float,2>{0.234086558f, 0.0199723691f},
-std::array<float,2>{0.953046083f, 0.959157944f},
-std::array<float,2>{0.382204562f, 0.675399244f},
-std::array<float,2>{0.702772975f, 0.44718194f},
-std::array<float,2>{0.391360015f, 0.0343933664f},
-std::array<float,2>{0.706762612f, 0.979506433f},
-std::array<float,2>{0.236383095f, 0.652096391f},
-std::array<float,2>{0.966581881f, 0.481907398f},
-std::array<float,2>{0.098302722f, 0.318487287f},
-std::array<float,2>{0.856048763f, 0.579687655f},
-std::array<float,2>{0.330880582f, 0.865276098f},
-std::array<float,2>{0.529588282f, 0.227064967f},
-std::array<float,2>{0.279480517f, 0.384846002f},
-std::array<float,2>{0.578354895f, 0.70835799f},
-std::array<float,2>{0.0120650372f, 0.888330936f},
-std::array<float,2>{0.798087895f, 0.0897617266f},
-std::array<float,2>{0.135187462f, 0.143157333f},
-std::array<float,2>{0.934407532f, 0.751167297f},
-std::array<float,2>{0.443643183f, 0.541342497f},
-std::array<float,2>{0.662554801f, 0.253999501f},
-std::array<float,2>{0.374416709f, 0.210370392f},
-std::array<float,2>{0.542899251f, 0.831301451f},
-std::array<float,2>{0.0721421838f, 0.624038398f},
-std::array<float,2>{0.81996572f, 0.37474674f},
-std::array<float,2>{0.21734485f, 0.453851789f},
-std::array<float,2>{0.999351442f, 0.665091932f},
-std::array<float,2>{0.426076204f, 0.939775825f},
-std::array<float,2>{0.735769033f, 0.0129307294f},
-std::array<float,2>{0.476848125f, 0.281528234f},
-std::array<float,2>{0.646934271f, 0.506293356f},
-std::array<float,2>{0.164469987f, 0.808609426f},
-std::array<float,2>{0.888439476f, 0.167259872f},
-std::array<float,2>{0.0538152382f, 0.110113531f},
-std::array<float,2>{0.751841366f, 0.927455425f},
-std::array<float,2>{0.300074607f, 0.744738817f},
-std::array<float,2>{0.598087132f, 0.433204085f},
-std::array<float,2>{0.34116441f, 0.00395284127f},
-std::array<float,2>{0.521608889f, 0.946197808f},
-std::array<float,2>{0.109017178f, 0.657072723f},
-std::array<float,2>{0.851227164f, 0.461573154f},
-std::array<float,2>{0.244637236f, 0.363566756f},
-std::array<float,2>{0.957306027f, 0.615185022f},
-std::array<float,2>{0.40500325f, 0.84310329f},
-std::array<float,2>{0.711401045f, 0.217070058f},
-std::array<float,2>{0.44866547f, 0.428696185f},
-std::array<float,2>{0.671089292f, 0.741705775f},
-std::array<float,2>{0.132662937f, 0.929813623f},
-std::array<float,2>{0.922832847f, 0.118638992f},
-std::array<float,2>{0.0051122806f, 0.15884918f},
-std::array<float,2>{0.809919834f, 0.799773574f},
-std::array<float,2>{0.266308397f, 0.513658524f},
-std::array<float,2>{0.587962568f, 0.296170175f},
-std::array<float,2>{0.432743758f, 0.222219378f},
-std::array<float,2>{0.742629826f, 0.869725704f},
-std::array<float,2>{0.206443176f, 0.591600478f},
-std::array<float,2>{0.991339266f, 0.325618178f},
-std::array<float,2>{0.0685123727f, 0.469760239f},
-std::array<float,2>{0.822697997f, 0.641911924f},
-std::array<float,2>{0.365472525f, 0.975308418f},
-std::array<float,2>{0.536494315f, 0.0430613421f},
-std::array<float,2>{0.305617452f, 0.262638122f},
-std::array<float,2>{0.602256894f, 0.53817606f},
-std::array<float,2>{0.0604525991f, 0.758512437f},
-std::array<float,2>{0.761798739f, 0.151370943f},
-std::array<float,2>{0.157906756f, 0.084979102f},
-std::array<float,2>{0.880957365f, 0.881961703f},
-std::array<float,2>{0.470243782f, 0.712638438f},
-std::array<float,2>{0.654013932f, 0.381852895f},
-std::array<float,2>{0.487481296f, 0.0975771472f},
-std::array<float,2>{0.63969183f, 0.913374126f},
-std::array<float,2>{0.175488949f, 0.725440562f},
-std::array<float,2>{0.902283132f, 0.409885854f},
-std::array<float,2>{0.0441113561f, 0.300153732f},
-std::array<float,2>{0.780851185f, 0.516767025f},
-std::array<float,2>{0.294784039f, 0.79127425f},
-std::array<float,2>{0.609750628f, 0.174523339f},
-std::array<float,2>{0.345088273f, 0.440032393f},
-std::array<float,2>{0.555291951f, 0.685970545f},
-std::array<float,2>{0.083879672f, 0.966804624f},
-std::array<float,2>{0.828555584f, 0.0303172935f},
-std::array<float,2>{0.197607979f, 0.195994243f},
-std::array<float,2>{0.979072928f, 0.819586515f},
-std::array<float,2>{0.417374969f, 0.603809774f},
-std::array<float,2>{0.720091343f, 0.353848904f},
-std::array<float,2>{0.258775681f, 0.140168265f},
-std::array<float,2>{0.564068675f, 0.771327615f},
-std::array<float,2>{0.0308542587f, 0.560136318f},
-std::array<float,2>{0.793037951f, 0.27507475f},
-std::array<float,2>{0.150109321f, 0.402682304f},
-std::array<float,2>{0.912063301f, 0.69128716f},
-std::array<float,2>{0.466073036f, 0.905874491f},
-std::array<float,2>{0.682183027f, 0.0716909394f},
-std::array<float,2>{0.386598289f, 0.341345549f},
-std::array<float,2>{0.693306684f, 0.573453784f},
-std::array<float,2>{0.226297766f, 0.849847555f},
-std::array<float,2>{0.944556594f, 0.247420549f},
-std::array<float,2>{0.115497284f, 0.0482531339f},
-std::array<float,2>{0.860528111f, 0.985476196f},
-std::array<float,2>{0.322436482f, 0.63786149f},
-std::array<float,2>{0.510548949f, 0.490439475f},
-std::array<float,2>{0.358956397f, 0.124630071f},
-std::array<float,2>{0.552390158f, 0.936448038f},
-std::array<float,2>{0.0883536637f, 0.737187028f},
-std::array<float,2>{0.837865174f, 0.425729066f},
-std::array<float,2>{0.188518673f, 0.292141348f},
-std::array<float,2>{0.972620189f, 0.510029018f},
-std::array<float,2>{0.411036819f, 0.802516162f},
-std::array<float,2>{0.729422331f, 0.164010629f},
-std::array<float,2>{0.493294746f, 0.468171537f},
-std::array<float,2>{0.630264342f, 0.663273275f},
-std::array<float,2>{0.181603134f, 0.951097071f},
-std::array<float,2>{0.891244531f, 0.00378418225f},
-std::array<float,2>{0.0336993746f, 0.211835504f},
-std::array<float,2>{0.768022954f, 0.836042047f},
-std::array<float,2>{0.28512302f, 0.611568928f},
-std::array<float,2>{0.617350757f, 0.359408051f},
-std::array<float,2>{0.37876907f, 0.154285774f},
-std::array<float,2>{0.697018683f, 0.76361686f},
-std::array<float,2>{0.228041932f, 0.531962812f},
-std::array<float,2>{0.947939098f, 0.259735614f},
-std::array<float,2>{0.118151814f, 0.378137827f},
-std::array<float,2>{0.873195767f, 0.715262234f},
-std::array<float,2>{0.313461483f, 0.875145614f},
-std::array<float,2>{0.504738569f, 0.0803290457f},
-std::array<float,2>{0.255470872f, 0.321587443f},
-std::array<float,2>{0.574867904f, 0.589765728f},
-std::array<float,2>{0.0212499723f, 0.873777092f},
-std::array<float,2>{0.78576839f, 0.22424449f},
-std::array<float,2>{0.148225546f, 0.0394038446f},
-std::array<float,2>{0.920923471f, 0.971647441f},
-std::array<float,2>{0.460214674f, 0.644944787f},
-std::array<float,2>{0.677063048f, 0.475102842f},
-std::array<float,2>{0.440819442f, 0.0267388113f},
-std::array<float,2>{0.657058835f, 0.962355137f},
-std::array<float,2>{0.13918598f, 0.683502555f},
-std::array<float,2>{0.932893395f, 0.44469434f},
-std::array<float,2>{0.00877889711f, 0.357044458f},
-std::array<float,2>{0.803703725f, 0.608012676f},
-std::array<float,2>{0.27384007f, 0.815261126f},
-std::array<float,2>{0.585388422f, 0.203083158f},
-std::array<float,2>{0.332080156f, 0.412269175f},
-std::array<float,2>{0.525409758f, 0.722174585f},
-std::array<float,2>{0.094198443f, 0.909458339f},
-std::array<float,2>{0.852164507f, 0.0988378748f},
-std::array<float,2>{0.239106685f, 0.175991967f},
-std::array<float,2>{0.962771535f, 0.796041667f},
-std::array<float,2>{0.396466047f, 0.522450507f},
-std::array<float,2>{0.7091223f, 0.303228855f},
-std::array<float,2>{0.303995818f, 0.242943227f},
-std::array<float,2>{0.594455957f, 0.845739722f},
-std::array<float,2>{0.0474922098f, 0.577223063f},
-std::array<float,2>{0.754584014f, 0.336947471f},
-std::array<float,2>{0.170308024f, 0.485393733f},
-std::array<float,2>{0.88449496f, 0.633149445f},
-std::array<float,2>{0.484285444f, 0.991374493f},
-std::array<float,2>{0.641725659f, 0.0539861694f},
-std::array<float,2>{0.42436263f, 0.277480751f},
-std::array<float,2>{0.739228129f, 0.555662692f},
-std::array<float,2>{0.211407542f, 0.765715897f},
-std::array<float,2>{0.994448066f, 0.13297376f},
-std::array<float,2>{0.0748477206f, 0.0747275054f},
-std::array<float,2>{0.812558889f, 0.899447143f},
-std::array<float,2>{0.369235635f, 0.695056617f},
-std::array<float,2>{0.546590328f, 0.400373846f},
-std::array<float,2>{0.2698147f, 0.0596460886f},
-std::array<float,2>{0.590091825f, 0.99469924f},
-std::array<float,2>{0.00374411698f, 0.631694674f},
-std::array<float,2>{0.806106031f, 0.494399577f},
-std::array<float,2>{0.127884537f, 0.329074979f},
-std::array<float,2>{0.925919592f, 0.566443384f},
-std::array<float,2>{0.449672341f, 0.855727375f},
-std::array<float,2>{0.667012215f, 0.236342341f},
-std::array<float,2>{0.40046069f, 0.398256421f},
-std::array<float,2>{0.715207756f, 0.696613431f},
-std::array<float,2>{0.246945336f, 0.893965006f},
-std::array<float,2>{0.95438695f, 0.0643761456f},
-std::array<float,2>{0.104348861f, 0.126096085f},
-std::array<float,2>{0.846688271f, 0.780317724f},
-std::array<float,2>{0.338874817f, 0.554466367f},
-std::array<float,2>{0.516635478f, 0.269753903f},
-std::array<float,2>{0.474875957f, 0.194378257f},
-std::array<float,2>{0.650031984f, 0.820704639f},
-std::array<float,2>{0.162278578f, 0.601330101f},
-std::array<float,2>{0.878302097f, 0.351063699f},
-std::array<float,2>{0.0567451231f, 0.450713247f},
-std::array<float,2>{0.758942306f, 0.678250313f},
-std::array<float,2>{0.310246199f, 0.954176545f},
-std::array<float,2>{0.606232345f, 0.0193617083f},
-std::array<float,2>{0.362167835f, 0.312033832f},
-std::array<float,2>{0.53220135f, 0.524299383f},
-std::array<float,2>{0.0660119802f, 0.783948064f},
-std::array<float,2>{0.826061666f, 0.179777145f},
-std::array<float,2>{0.209845304f, 0.106027916f},
-std::array<float,2>{0.985911608f, 0.919378281f},
-std::array<float,2>{0.434009135f, 0.729972541f},
-std::array<float,2>{0.748686314f, 0.415711492f},
-std::array<float,2>{0.418594271f, 0.0907349959f},
-std::array<float,2>{0.724915445f, 0.883435726f},
-std::array<float,2>{0.202253744f, 0.705768764f},
-std::array<float,2>{0.982644439f, 0.386921465f},
-std::array<float,2>{0.0806922913f, 0.250733227f},
-std::array<float,2>{0.832396448f, 0.543239295f},
-std::array<float,2>{0.349071652f, 0.757674456f},
-std::array<float,2>{0.559157014f, 0.148317039f},
-std::array<float,2>{0.290305167f, 0.477802962f},
-std::array<float,2>{0.616335869f, 0.65463388f},
-std::array<float,2>{0.0403903984f, 0.984250247f},
-std::array<float,2>{0.77390331f, 0.0384105705f},
-std::array<float,2>{0.176235572f, 0.234165743f},
-std::array<float,2>{0.906070411f, 0.861698329f},
-std::array<float,2>{0.491764665f, 0.585371315f},
-std::array<float,2>{0.636376619f, 0.315978378f},
-std::array<float,2>{0.325753391f, 0.169019699f},
-std::array<float,2>{0.51534164f, 0.807411611f},
-std::array<float,2>{0.110866562f, 0.501983345f},
-std::array<float,2>{0.864565253f, 0.285874844f},
-std::array<float,2>{0.221623108f, 0.43382591f},
-std::array<float,2>{0.937555969f, 0.747261643f},
-std::array<float,2>{0.388307095f, 0.922892451f},
-std::array<float,2>{0.689847052f, 0.113844141f},
-std::array<float,2>{0.462121218f, 0.368248999f},
-std::array<float,2>{0.687126935f, 0.620141923f},
-std::array<float,2>{0.15299122f, 0.832700074f},
-std::array<float,2>{0.909409881f, 0.203910112f},
-std::array<float,2>{0.0240963921f, 0.00923441723f},
-std::array<float,2>{0.789489985f, 0.942408621f},
-std::array<float,2>{0.262516975f, 0.670429587f},
-std::array<float,2>{0.567097247f, 0.457496971f},
-std::array<float,2>{0.253594995f, 0.101834148f},
-std::array<float,2>{0.573258698f, 0.915647149f},
-std::array<float,2>{0.016919544f, 0.73178035f},
-std::array<float,2>{0.785141885f, 0.419288069f},
-std::array<float,2>{0.142809048f, 0.306322008f},
-std::array<float,2>{0.91666013f, 0.528734922f},
-std::array<float,2>{0.4565835f, 0.787946701f},
-std::array<float,2>{0.675417781f, 0.186744884f},
-std::array<float,2>{0.3796013f, 0.449021071f},
-std::array<float,2>{0.700663447f, 0.673727453f},
-std::array<float,2>{0.230505422f, 0.958246648f},
-std::array<float,2>{0.950116754f, 0.0231506228f},
-std::array<float,2>{0.12403138f, 0.189122498f},
-std::array<float,2>{0.870501339f, 0.824779212f},
-std::array<float,2>{0.320182651f, 0.593772888f},
-std::array<float,2>{0.503684282f, 0.346175075f},
-std::array<float,2>{0.499435723f, 0.132689521f},
-std::array<float,2>{0.628004849f, 0.776117682f},
-std::array<float,2>{0.185595796f, 0.550266206f},
-std::array<float,2>{0.895488143f, 0.266059279f},
-std::array<float,2>{0.0362561867f, 0.391465545f},
-std::array<float,2>{0.770662129f, 0.699607134f},
-std::array<float,2>{0.287353188f, 0.897181809f},
-std::array<float,2>{0.623698175f, 0.0696624443f},
-std::array<float,2>{0.354575276f, 0.332665354f},
-std::array<float,2>{0.548324049f, 0.563337028f},
-std::array<float,2>{0.0912813172f, 0.855183959f},
-std::array<float,2>{0.843247592f, 0.241484106f},
-std::array<float,2>{0.192089424f, 0.0564821288f},
-std::array<float,2>{0.973263204f, 0.997170389f},
-std::array<float,2>{0.407705814f, 0.628631711f},
-std::array<float,2>{0.731899619f, 0.496148825f},
-std::array<float,2>{0.429360211f, 0.0141374283f},
-std::array<float,2>{0.737798035f, 0.9390378f},
-std::array<float,2>{0.215092763f, 0.666234732f},
-std::array<float,2>{0.996448576f, 0.4556624f},
-std::array<float,2>{0.073746644f, 0.371105731f},
-std::array<float,2>{0.816411734f, 0.622434378f},
-std::array<float,2>{0.371876925f, 0.828881383f},
-std::array<float,2>{0.540032625f, 0.207424179f},
-std::array<float,2>{0.297914237f, 0.431574076f},
-std::array<float,2>{0.600185275f, 0.743996978f},
-std::array<float,2>{0.0521845333f, 0.928611636f},
-std::array<float,2>{0.752043426f, 0.111388959f},
-std::array<float,2>{0.167305127f, 0.164140895f},
-std::array<float,2>{0.890314162f, 0.810838997f},
-std::array<float,2>{0.479409486f, 0.503985167f},
-std::array<float,2>{0.644622028f, 0.285000086f},
-std::array<float,2>{0.329510689f, 0.229667336f},
-std::array<float,2>{0.528713226f, 0.863748908f},
-std::array<float,2>{0.101409771f, 0.581988454f},
-std::array<float,2>{0.857662141f, 0.317629308f},
-std::array<float,2>{0.234863207f, 0.483801574f},
-std::array<float,2>{0.968606174f, 0.648902237f},
-std::array<float,2>{0.392581612f, 0.976679265f},
-std::array<float,2>{0.703781784f, 0.0317107178f},
-std::array<float,2>{0.442108691f, 0.257225186f},
-std::array<float,2>{0.661661327f, 0.539508522f},
-std::array<float,2>{0.133721188f, 0.752896369f},
-std::array<float,2>{0.935975492f, 0.141739398f},
-std::array<float,2>{0.0140552353f, 0.0875061005f},
-std::array<float,2>{0.800181925f, 0.888818383f},
-std::array<float,2>{0.278321475f, 0.71005702f},
-std::array<float,2>{0.581774771f, 0.383770943f},
-std::array<float,2>{0.365163684f, 0.0464137867f},
-std::array<float,2>{0.538501143f, 0.973605633f},
-std::array<float,2>{0.0674281269f, 0.643533647f},
-std::array<float,2>{0.82214576f, 0.471533775f},
-std::array<float,2>{0.20429714f, 0.326925606f},
-std::array<float,2>{0.988546252f, 0.59322381f},
-std::array<float,2>{0.430051833f, 0.868775964f},
-std::array<float,2>{0.744516909f, 0.218964264f},
-std::array<float,2>{0.471261024f, 0.38084048f},
-std::array<float,2>{0.655801594f, 0.713359475f},
-std::array<float,2>{0.159164131f, 0.87918973f},
-std::array<float,2>{0.879481673f, 0.0827455819f},
-std::array<float,2>{0.060999155f, 0.149462521f},
-std::array<float,2>{0.765437543f, 0.759984791f},
-std::array<float,2>{0.307221532f, 0.535333037f},
-std::array<float,2>{0.605134785f, 0.264981687f},
-std::array<float,2>{0.403581083f, 0.216546312f},
-std::array<float,2>{0.713450611f, 0.840611458f},
-std::array<float,2>{0.243562311f, 0.617040992f},
-std::array<float,2>{0.959003448f, 0.36540851f},
-std::array<float,2>{0.106185205f, 0.464627624f},
-std::array<float,2>{0.848071873f, 0.65861553f},
-std::array<float,2>{0.342728376f, 0.948775768f},
-std::array<float,2>{0.520577073f, 0.00690705935f},
-std::array<float,2>{0.267634124f, 0.293257296f},
-std::array<float,2>{0.586149991f, 0.514282048f},
-std::array<float,2>{0.00751249399f, 0.797951162f},
-std::array<float,2>{0.81152457f, 0.156484321f},
-std::array<float,2>{0.129003987f, 0.119594708f},
-std::array<float,2>{0.924039245f, 0.932755947f},
-std::array<float,2>{0.446538895f, 0.740153015f},
-std::array<float,2>{0.668083429f, 0.425954759f},
-std::array<float,2>{0.46686396f, 0.073100999f},
-std::array<float,2>{0.680093825f, 0.903835475f},
-std::array<float,2>{0.151296139f, 0.688897073f},
-std::array<float,2>{0.912447274f, 0.405196369f},
-std::array<float,2>{0.0292296316f, 0.277012885f},
-std::array<float,2>{0.796389759f, 0.562313676f},
-std::array<float,2>{0.260486037f, 0.773409426f},
-std::array<float,2>{0.565590322f, 0.136984661f},
-std::array<float,2>{0.321226627f, 0.488518119f},
-std::array<float,2>{0.508473098f, 0.639637947f},
-std::array<float,2>{0.114969961f, 0.987004638f},
-std::array<float,2>{0.861997247f, 0.0495481901f},
-std::array<float,2>{0.224166051f, 0.249051005f},
-std::array<float,2>{0.943077207f, 0.849381328f},
-std::array<float,2>{0.383944243f, 0.572143078f},
-std::array<float,2>{0.693694174f, 0.342710227f},
-std::array<float,2>{0.295953214f, 0.172234014f},
-std::array<float,2>{0.612684846f, 0.789792478f},
-std::array<float,2>{0.0467555299f, 0.51778543f},
-std::array<float,2>{0.777999163f, 0.298698783f},
-std::array<float,2>{0.17253679f, 0.406473815f},
-std::array<float,2>{0.898724854f, 0.723186553f},
-std::array<float,2>{0.485192895f, 0.910973787f},
-std::array<float,2>{0.637733638f, 0.0950572938f},
-std::array<float,2>{0.415168971f, 0.351816297f},
-std::array<float,2>{0.721333921f, 0.6028741f},
-std::array<float,2>{0.196985289f, 0.817265451f},
-std::array<float,2>{0.977375746f, 0.198778585f},
-std::array<float,2>{0.0857302845f, 0.0289086159f},
-std::array<float,2>{0.830324113f, 0.966374815f},
-std::array<float,2>{0.347471178f, 0.683635712f},
-std::array<float,2>{0.557749152f, 0.438202769f},
-std::array<float,2>{0.31478709f, 0.0788813457f},
-std::array<float,2>{0.507698476f, 0.878769279f},
-std::array<float,2>{0.120178267f, 0.717549622f},
-std::array<float,2>{0.872866809f, 0.376383215f},
-std::array<float,2>{0.229619473f, 0.260735393f},
-std::array<float,2>{0.945579767f, 0.534353614f},
-std::array<float,2>{0.375301123f, 0.76494509f},
-std::array<float,2>{0.698289812f, 0.15464662f},
-std::array<float,2>{0.457496107f, 0.474559337f},
-std::array<float,2>{0.679007888f, 0.647730708f},
-std::array<float,2>{0.144596592f, 0.96966362f},
-std::array<float,2>{0.918497682f, 0.0424382351f},
-std::array<float,2>{0.0219520964f, 0.226068288f},
-std::array<float,2>{0.788931549f, 0.871790648f},
-std::array<float,2>{0.257520825f, 0.58614707f},
-std::array<float,2>{0.578070045f, 0.324084371f},
-std::array<float,2>{0.413044989f, 0.160188362f},
-std::array<float,2>{0.726679325f, 0.803285241f},
-std::array<float,2>{0.190965474f, 0.508232236f},
-std::array<float,2>{0.96958822f, 0.289737284f},
-std::array<float,2>{0.0865207464f, 0.423026383f},
-std::array<float,2>{0.838216901f, 0.736257374f},
-std::array<float,2>{0.357054949f, 0.934589326f},
-std::array<float,2>{0.554386139f, 0.121367134f},
-std::array<float,2>{0.281353742f, 0.362837404f},
-std::array<float,2>{0.62003088f, 0.61124903f},
-std::array<float,2>{0.0323401019f, 0.838699818f},
-std::array<float,2>{0.765674949f, 0.212945923f},
-std::array<float,2>{0.183000505f, 0.000787810539f},
-std::array<float,2>{0.893980563f, 0.952168047f},
-std::array<float,2>{0.495195121f, 0.660452902f},
-std::array<float,2>{0.632049799f, 0.466546386f},
-std::array<float,2>{0.480554104f, 0.0516013876f},
-std::array<float,2>{0.642897666f, 0.989572763f},
-std::array<float,2>{0.168352276f, 0.635983348f},
-std::array<float,2>{0.885174334f, 0.487247109f},
-std::array<float,2>{0.0496240929f, 0.339821756f},
-std::array<float,2>{0.757305384f, 0.574233711f},
-std::array<float,2>{0.301315963f, 0.844220757f},
-std::array<float,2>{0.596167147f, 0.245675758f},
-std::array<float,2>{0.368249565f, 0.401453793f},
-std::array<float,2>{0.543263078f, 0.69232583f},
-std::array<float,2>{0.0767344981f, 0.901042998f},
-std::array<float,2>{0.815020204f, 0.0776961669f},
-std::array<float,2>{0.212991089f, 0.136438325f},
-std::array<float,2>{0.992872536f, 0.767747104f},
-std::array<float,2>{0.422417849f, 0.557095289f},
-std::array<float,2>{0.740329742f, 0.279406667f},
-std::array<float,2>{0.276180416f, 0.200068444f},
-std::array<float,2>{0.582036495f, 0.814042091f},
-std::array<float,2>{0.0116712153f, 0.606689036f},
-std::array<float,2>{0.801747024f, 0.357947022f},
-std::array<float,2>{0.136737004f, 0.44170925f},
-std::array<float,2>{0.929772854f, 0.681195319f},
-std::array<float,2>{0.43824631f, 0.963708162f},
-std::array<float,2>{0.658991933f, 0.0243647303f},
-std::array<float,2>{0.39661032f, 0.301266283f},
-std::array<float,2>{0.708414257f, 0.520057261f},
-std::array<float,2>{0.242078364f, 0.79401499f},
-std::array<float,2>{0.963966489f, 0.179181859f},
-std::array<float,2>{0.0957688913f, 0.100529604f},
-std::array<float,2>{0.854811847f, 0.908061683f},
-std::array<float,2>{0.335106462f, 0.720423222f},
-std::array<float,2>{0.524706066f, 0.411423534f},
-std::array<float,2>{0.310821027f, 0.0156452134f},
-std::array<float,2>{0.608819425f, 0.955974281f},
-std::array<float,2>{0.0557898842f, 0.676522672f},
-std::array<float,2>{0.761146486f, 0.452265441f},
-std::array<float,2>{0.162011847f, 0.347999603f},
-std::array<float,2>{0.875033438f, 0.598098338f},
-std::array<float,2>{0.472671509f, 0.823468983f},
-std::array<float,2>{0.65207082f, 0.192649037f},
-std::array<float,2>{0.436503917f, 0.416749865f},
-std::array<float,2>{0.747027099f, 0.726603091f},
-std::array<float,2>{0.207843542f, 0.92022711f},
-std::array<float,2>{0.988016605f, 0.107750274f},
-std::array<float,2>{0.0632940233f, 0.18341212f},
-std::array<float,2>{0.82746923f, 0.782443643f},
-std::array<float,2>{0.359491378f, 0.526265323f},
-std::array<float,2>{0.534860432f, 0.309336156f},
-std::array<float,2>{0.452560186f, 0.234433264f},
-std::array<float,2>{0.664208949f, 0.858546734f},
-std::array<float,2>{0.126316398f, 0.569395244f},
-std::array<float,2>{0.929142118f, 0.330308467f},
-std::array<float,2>{0.00106118573f, 0.493615896f},
-std::array<float,2>{0.808009326f, 0.630640328f},
-std::array<float,2>{0.272449195f, 0.992723405f},
-std::array<float,2>{0.59193784f, 0.0613221191f},
-std::array<float,2>{0.336577922f, 0.272187978f},
-std::array<float,2>{0.517780185f, 0.550929785f},
-std::array<float,2>{0.103087395f, 0.778667986f},
-std::array<float,2>{0.843868852f, 0.128176868f},
-std::array<float,2>{0.248987347f, 0.0656558573f},
-std::array<float,2>{0.955147564f, 0.890938938f},
-std::array<float,2>{0.398985595f, 0.698705554f},
-std::array<float,2>{0.717017591f, 0.394622654f},
-std::array<float,2>{0.388715625f, 0.116987459f},
-std::array<float,2>{0.687703371f, 0.923858583f},
-std::array<float,2>{0.220275015f, 0.749484956f},
-std::array<float,2>{0.940755308f, 0.437257558f},
-std::array<float,2>{0.111722097f, 0.287316263f},
-std::array<float,2>{0.866475582f, 0.501768589f},
-std::array<float,2>{0.326501906f, 0.805214703f},
-std::array<float,2>{0.512339711f, 0.170945048f},
-std::array<float,2>{0.265603065f, 0.460484862f},
-std::array<float,2>{0.569927752f, 0.669120669f},
-std::array<float,2>{0.0264250822f, 0.945031106f},
-std::array<float,2>{0.791294813f, 0.0114123691f},
-std::array<float,2>{0.155772328f, 0.206837475f},
-std::array<float,2>{0.907970428f, 0.834451854f},
-std::array<float,2>{0.463674009f, 0.617293596f},
-std::array<float,2>{0.684470356f, 0.370171636f},
-std::array<float,2>{0.351560801f, 0.146089375f},
-std::array<float,2>{0.561415136f, 0.75478524f},
-std::array<float,2>{0.0786758214f, 0.546031058f},
-std::array<float,2>{0.834290624f, 0.252870858f},
-std::array<float,2>{0.200671077f, 0.390026033f},
-std::array<float,2>{0.981362879f, 0.703594506f},
-std::array<float,2>{0.421230733f, 0.886632323f},
-std::array<float,2>{0.723287225f, 0.0918108299f},
-std::array<float,2>{0.488297194f, 0.313672453f},
-std::array<float,2>{0.633121073f, 0.582518935f},
-std::array<float,2>{0.179654032f, 0.861170411f},
-std::array<float,2>{0.902396441f, 0.232296154f},
-std::array<float,2>{0.0421117507f, 0.0353437774f},
-std::array<float,2>{0.775539756f, 0.981267452f},
-std::array<float,2>{0.292318583f, 0.652745426f},
-std::array<float,2>{0.614246428f, 0.480305433f},
-std::array<float,2>{0.259915471f, 0.0720776096f},
-std::array<float,2>{0.565993488f, 0.905548871f},
-std::array<float,2>{0.0283666272f, 0.690738976f},
-std::array<float,2>{0.796251237f, 0.403069496f},
-std::array<float,2>{0.150858656f, 0.274666131f},
-std::array<float,2>{0.912944317f, 0.559717119f},
-std::array<float,2>{0.467314482f, 0.770963609f},
-std::array<float,2>{0.68020618f, 0.139674112f},
-std::array<float,2>{0.384490281f, 0.490982533f},
-std::array<float,2>{0.694188833f, 0.638502717f},
-std::array<float,2>{0.223702133f, 0.986177266f},
-std::array<float,2>{0.942531466f, 0.048496671f},
-std::array<float,2>{0.114406951f, 0.247864261f},
-std::array<float,2>{0.861406922f, 0.850267291f},
-std::array<float,2>{0.320684552f, 0.573911667f},
-std::array<float,2>{0.508031845f, 0.341263086f},
-std::array<float,2>{0.48467949f, 0.174153462f},
-std::array<float,2>{0.638668776f, 0.791743815f},
-std::array<float,2>{0.172095731f, 0.517322183f},
-std::array<float,2>{0.899168789f, 0.30053255f},
-std::array<float,2>{0.0460655466f, 0.409657776f},
-std::array<float,2>{0.777731776f, 0.724869728f},
-std::array<float,2>{0.296468437f, 0.913815677f},
-std::array<float,2>{0.613159657f, 0.0969597772f},
-std::array<float,2>{0.347060263f, 0.354162008f},
-std::array<float,2>{0.558235943f, 0.604355931f},
-std::array<float,2>{0.0852374434f, 0.820173264f},
-std::array<float,2>{0.83101368f, 0.195334136f},
-std::array<float,2>{0.196668074f, 0.031020958f},
-std::array<float,2>{0.976815462f, 0.967587471f},
-std::array<float,2>{0.415886432f, 0.686509967f},
-std::array<float,2>{0.720708072f, 0.439720452f},
-std::array<float,2>{0.430210888f, 0.0437473059f},
-std::array<float,2>{0.744941115f, 0.974775076f},
-std::array<float,2>{0.20489566f, 0.642284453f},
-std::array<float,2>{0.988770306f, 0.470510513f},
-std::array<float,2>{0.068130821f, 0.325964242f},
-std::array<float,2>{0.821441054f, 0.591169655f},
-std::array<float,2>{0.364721537f, 0.869283617f},
-std::array<float,2>{0.538671076f, 0.222149223f},
-std::array<float,2>{0.306770444f, 0.382547289f},
-std::array<float,2>{0.604897082f, 0.711931705f},
-std::array<float,2>{0.0614088774f, 0.882493079f},
-std::array<float,2>{0.764798284f, 0.0854967609f},
-std::array<float,2>{0.158467025f, 0.152088985f},
-std::array<float,2>{0.879163027f, 0.758031726f},
-std::array<float,2>{0.470991671f, 0.538998306f},
-std::array<float,2>{0.655427635f, 0.261830688f},
-std::array<float,2>{0.341816872f, 0.21765475f},
-std::array<float,2>{0.5210706f, 0.8435027f},
-std::array<float,2>{0.105867274f, 0.614721775f},
-std::array<float,2>{0.848272443f, 0.363794267f},
-std::array<float,2>{0.244069889f, 0.461405665f},
-std::array<float,2>{0.959880352f, 0.656303942f},
-std::array<float,2>{0.404216498f, 0.945437133f},
-std::array<float,2>{0.71336323f, 0.00469658291f},
-std::array<float,2>{0.44725734f, 0.296488762f},
-std::array<float,2>{0.668624282f, 0.513146281f},
-std::array<float,2>{0.12975347f, 0.799002349f},
-std::array<float,2>{0.924430549f, 0.158570901f},
-std::array<float,2>{0.00717080478f, 0.118884496f},
-std::array<float,2>{0.812026441f, 0.930447936f},
-std::array<float,2>{0.268175751f, 0.741270363f},
-std::array<float,2>{0.58648324f, 0.427767754f},
-std::array<float,2>{0.371259689f, 0.0134632029f},
-std::array<float,2>{0.539335728f, 0.939955056f},
-std::array<float,2>{0.0734131262f, 0.66555953f},
-std::array<float,2>{0.817073047f, 0.453516692f},
-std::array<float,2>{0.215412378f, 0.374084383f},
-std::array<float,2>{0.996845365f, 0.624785662f},
-std::array<float,2>{0.428716183f, 0.831711292f},
-std::array<float,2>{0.737792373f, 0.210683271f},
-std::array<float,2>{0.478735894f, 0.433021396f},
-std::array<float,2>{0.64526701f, 0.744349837f},
-std::array<float,2>{0.167943805f, 0.92687875f},
-std::array<float,2>{0.889694929f, 0.109755285f},
-std::array<float,2>{0.0524831489f, 0.167654514f},
-std::array<float,2>{0.752471387f, 0.809321821f},
-std::array<float,2>{0.29867509f, 0.506657958f},
-std::array<float,2>{0.599794745f, 0.28215304f},
-std::array<float,2>{0.393283308f, 0.226927683f},
-std::array<float,2>{0.703198314f, 0.866081715f},
-std::array<float,2>{0.235305071f, 0.579446971f},
-std::array<float,2>{0.968078911f, 0.319035858f},
-std::array<float,2>{0.100666247f, 0.482262313f},
-std::array<float,2>{0.858377755f, 0.651690662f},
-std::array<float,2>{0.329763681f, 0.980093777f},
-std::array<float,2>{0.528978765f, 0.03503111f},
-std::array<float,2>{0.278903097f, 0.254395485f},
-std::array<float,2>{0.58122766f, 0.54178375f},
-std::array<float,2>{0.0143223461f, 0.751678705f},
-std::array<float,2>{0.800345957f, 0.142718375f},
-std::array<float,2>{0.132874534f, 0.0889115334f},
-std::array<float,2>{0.936366379f, 0.88777405f},
-std::array<float,2>{0.441663116f, 0.708934307f},
-std::array<float,2>{0.661155879f, 0.385698676f},
-std::array<float,2>{0.456495523f, 0.105048493f},
-std::array<float,2>{0.674879432f, 0.91680932f},
-std::array<float,2>{0.143285409f, 0.73339653f},
-std::array<float,2>{0.916297197f, 0.420343727f},
-std::array<float,2>{0.0174623728f, 0.306920052f},
-std::array<float,2>{0.784471571f, 0.530734479f},
-std::array<float,2>{0.253332824f, 0.785786092f},
-std::array<float,2>{0.573745847f, 0.18403396f},
-std::array<float,2>{0.319580853f, 0.44665876f},
-std::array<float,2>{0.503356218f, 0.674807668f},
-std::array<float,2>{0.12468449f, 0.959715605f},
-std::array<float,2>{0.8709867f, 0.0202261135f},
-std::array<float,2>{0.231107056f, 0.190085948f},
-std::array<float,2>{0.949589133f, 0.82623893f},
-std::array<float,2>{0.379092395f, 0.597402155f},
-std::array<float,2>{0.700832307f, 0.34392041f},
-std::array<float,2>{0.288017064f, 0.130431026f},
-std::array<float,2>{0.623350561f, 0.774307489f},
-std::array<float,2>{0.0369947068f, 0.547411919f},
-std::array<float,2>{0.771418631f, 0.267756104f},
-std::array<float,2>{0.186313733f, 0.393958509f},
-std::array<float,2>{0.894661903f, 0.701521814f},
-std::array<float,2>{0.49994421f, 0.895066559f},
-std::array<float,2>{0.628885508f, 0.0675054789f},
-std::array<float,2>{0.407846868f, 0.334245771f},
-std::array<float,2>{0.73203069f, 0.56571418f},
-std::array<float,2>{0.191623762f, 0.852931201f},
-std::array<float,2>{0.972773254f, 0.238443226f},
-std::array<float,2>{0.0914330557f, 0.0580217093f},
-std::array<float,2>{0.843589962f, 0.998422027f},
-std::array<float,2>{0.35515967f, 0.626596808f},
-std::array<float,2>{0.548515975f, 0.498403281f},
-std::array<float,2>{0.327112556f, 0.113627002f},
-std::array<float,2>{0.511813283f, 0.923813641f},
-std::array<float,2>{0.112166405f, 0.748008668f},
-std::array<float,2>{0.866975188f, 0.434317768f},
-std::array<float,2>{0.219990239f, 0.285247266f},
-std::array<float,2>{0.941194296f, 0.502870917f},
-std::array<float,2>{0.389546186f, 0.806909382f},
-std::array<float,2>{0.688153088f, 0.169598043f},
-std::array<float,2>{0.463177413f, 0.457867771f},
-std::array<float,2>{0.683948874f, 0.670317233f},
-std::array<float,2>{0.155676797f, 0.943328083f},
-std::array<float,2>{0.907420158f, 0.00933003798f},
-std::array<float,2>{0.0271277279f, 0.203271449f},
-std::array<float,2>{0.791970134f, 0.832379103f},
-std::array<float,2>{0.264858246f, 0.620977104f},
-std::array<float,2>{0.569718599f, 0.368771553f},
-std::array<float,2>{0.421461642f, 0.147630394f},
-std::array<float,2>{0.723125339f, 0.757077754f},
-std::array<float,2>{0.201081231f, 0.54393971f},
-std::array<float,2>{0.980574787f, 0.250446945f},
-std::array<float,2>{0.0784035102f, 0.38768661f},
-std::array<float,2>{0.834928215f, 0.705296397f},
-std::array<float,2>{0.351010442f, 0.882976055f},
-std::array<float,2>{0.560953081f, 0.0902218223f},
-std::array<float,2>{0.292660028f, 0.315752089f},
-std::array<float,2>{0.613332033f, 0.585664451f},
-std::array<float,2>{0.0426466055f, 0.861905634f},
-std::array<float,2>{0.776167989f, 0.233609796f},
-std::array<float,2>{0.179186121f, 0.0387972258f},
-std::array<float,2>{0.90304774f, 0.983688712f},
-std::array<float,2>{0.488968492f, 0.654825568f},
-std::array<float,2>{0.633572698f, 0.478189588f},
-std::array<float,2>{0.473526746f, 0.0188815221f},
-std::array<float,2>{0.651425302f, 0.954809785f},
-std::array<float,2>{0.16147463f, 0.67788744f},
-std::array<float,2>{0.875781596f, 0.450543642f},
-std::array<float,2>{0.0561542623f, 0.351262331f},
-std::array<float,2>{0.76137501f, 0.600881577f},
-std::array<float,2>{0.311249524f, 0.82086277f},
-std::array<float,2>{0.608977795f, 0.195062086f},
-std::array<float,2>{0.359964699f, 0.415072978f},
-std::array<float,2>{0.53449744f, 0.730314136f},
-std::array<float,2>{0.0628122017f, 0.9197101f},
-std::array<float,2>{0.827958584f, 0.105951793f},
-std::array<float,2>{0.207173496f, 0.180513337f},
-std::array<float,2>{0.987425685f, 0.783667743f},
-std::array<float,2>{0.435921311f, 0.523698986f},
-std::array<float,2>{0.746502995f, 0.311547637f},
-std::array<float,2>{0.271792561f, 0.237149f},
-std::array<float,2>{0.592616618f, 0.855976045f},
-std::array<float,2>{0.00166388601f, 0.567047596f},
-std::array<float,2>{0.808303535f, 0.328197598f},
-std::array<float,2>{0.126856953f, 0.494915754f},
-std::array<float,2>{0.929528296f, 0.631141305f},
-std::array<float,2>{0.452669442f, 0.994172871f},
-std::array<float,2>{0.664977312f, 0.0604172423f},
-std::array<float,2>{0.398756951f, 0.270268649f},
-std::array<float,2>{0.717399001f, 0.554150462f},
-std::array<float,2>{0.248482749f, 0.780767977f},
-std::array<float,2>{0.955721974f, 0.126837298f},
-std::array<float,2>{0.102706611f, 0.0636963621f},
-std::array<float,2>{0.844600916f, 0.894409359f},
-std::array<float,2>{0.336039931f, 0.69687742f},
-std::array<float,2>{0.518304586f, 0.397531658f},
-std::array<float,2>{0.301005483f, 0.0543434806f},
-std::array<float,2>{0.596586406f, 0.992147446f},
-std::array<float,2>{0.0488651246f, 0.633471012f},
-std::array<float,2>{0.757470846f, 0.486201763f},
-std::array<float,2>{0.168829903f, 0.337701917f},
-std::array<float,2>{0.885618269f, 0.578086674f},
-std::array<float,2>{0.481275916f, 0.846556306f},
-std::array<float,2>{0.643316865f, 0.242649734f},
-std::array<float,2>{0.422336817f, 0.399535656f},
-std::array<float,2>{0.740948856f, 0.694462538f},
-std::array<float,2>{0.21346882f, 0.899973214f},
-std::array<float,2>{0.992487431f, 0.0744783133f},
-std::array<float,2>{0.0762026012f, 0.133687183f},
-std::array<float,2>{0.814724684f, 0.76616627f},
-std::array<float,2>{0.369112402f, 0.55500114f},
-std::array<float,2>{0.543563724f, 0.278095394f},
-std::array<float,2>{0.437933773f, 0.202515304f},
-std::array<float,2>{0.65860182f, 0.814809144f},
-std::array<float,2>{0.137249365f, 0.607747257f},
-std::array<float,2>{0.930659831f, 0.356674522f},
-std::array<float,2>{0.0109298388f, 0.444897324f},
-std::array<float,2>{0.801188588f, 0.682698667f},
-std::array<float,2>{0.275809109f, 0.962431431f},
-std::array<float,2>{0.582845807f, 0.0272070039f},
-std::array<float,2>{0.335538834f, 0.302964211f},
-std::array<float,2>{0.525017023f, 0.52186501f},
-std::array<float,2>{0.0966251716f, 0.796635985f},
-std::array<float,2>{0.855377555f, 0.176610574f},
-std::array<float,2>{0.241282657f, 0.0995299891f},
-std::array<float,2>{0.96483928f, 0.910059512f},
-std::array<float,2>{0.397271365f, 0.722004414f},
-std::array<float,2>{0.708746552f, 0.41305092f},
-std::array<float,2>{0.375834972f, 0.0807762519f},
-std::array<float,2>{0.698740065f, 0.875847042f},
-std::array<float,2>{0.230194271f, 0.715492666f},
-std::array<float,2>{0.945866466f, 0.37861529f},
-std::array<float,2>{0.120785549f, 0.258836299f},
-std::array<float,2>{0.872492373f, 0.531428933f},
-std::array<float,2>{0.315079808f, 0.762720704f},
-std::array<float,2>{0.506908f, 0.153490826f},
-std::array<float,2>{0.257237673f, 0.475085735f},
-std::array<float,2>{0.577617824f, 0.64536339f},
-std::array<float,2>{0.0222752895f, 0.971043587f},
-std::array<float,2>{0.788131356f, 0.0398508236f},
-std::array<float,2>{0.14544408f, 0.224068627f},
-std::array<float,2>{0.918136299f, 0.873432934f},
-std::array<float,2>{0.457625538f, 0.58914572f},
-std::array<float,2>{0.679296017f, 0.322180599f},
-std::array<float,2>{0.356553823f, 0.163473204f},
-std::array<float,2>{0.553758323f, 0.801935256f},
-std::array<float,2>{0.0863174722f, 0.510715902f},
-std::array<float,2>{0.838531971f, 0.292524248f},
-std::array<float,2>{0.190898687f, 0.425100923f},
-std::array<float,2>{0.969141841f, 0.736801863f},
-std::array<float,2>{0.412281066f, 0.935854495f},
-std::array<float,2>{0.727141976f, 0.124173537f},
-std::array<float,2>{0.4958359f, 0.360018581f},
-std::array<float,2>{0.632636607f, 0.611891448f},
-std::array<float,2>{0.183356673f, 0.836795866f},
-std::array<float,2>{0.89422673f, 0.211360484f},
-std::array<float,2>{0.0331015326f, 0.00299905986f},
-std::array<float,2>{0.766574621f, 0.950315297f},
-std::array<float,2>{0.282208413f, 0.663602889f},
-std::array<float,2>{0.619276166f, 0.468301237f},
-std::array<float,2>{0.29427138f, 0.0954478085f},
-std::array<float,2>{0.610043645f, 0.91037333f},
-std::array<float,2>{0.0445936397f, 0.722907364f},
-std::array<float,2>{0.780358076f, 0.407045156f},
-std::array<float,2>{0.175034449f, 0.298075199f},
-std::array<float,2>{0.901546955f, 0.51832521f},
-std::array<float,2>{0.487808883f, 0.789289594f},
-std::array<float,2>{0.640586197f, 0.17283994f},
-std::array<float,2>{0.417808294f, 0.437704474f},
-std::array<float,2>{0.720486164f, 0.68438077f},
-std::array<float,2>{0.197886601f, 0.966137528f},
-std::array<float,2>{0.978586078f, 0.0286612064f},
-std::array<float,2>{0.083139129f, 0.198468938f},
-std::array<float,2>{0.828878164f, 0.816687167f},
-std::array<float,2>{0.345691353f, 0.603137374f},
-std::array<float,2>{0.554913521f, 0.352528065f},
-std::array<float,2>{0.466431469f, 0.137307435f},
-std::array<float,2>{0.681936502f, 0.772787333f},
-std::array<float,2>{0.149715945f, 0.561957836f},
-std::array<float,2>{0.911297381f, 0.276642621f},
-std::array<float,2>{0.030524211f, 0.404664427f},
-std::array<float,2>{0.793492675f, 0.689080119f},
-std::array<float,2>{0.258293509f, 0.90354228f},
-std::array<float,2>{0.56382376f, 0.0725188032f},
-std::array<float,2>{0.322896242f, 0.342211843f},
-std::array<float,2>{0.509976387f, 0.571620762f},
-std::array<float,2>{0.115796864f, 0.849066496f},
-std::array<float,2>{0.861203492f, 0.24960357f},
-std::array<float,2>{0.225718156f, 0.0492755994f},
-std::array<float,2>{0.945236683f, 0.986456752f},
-std::array<float,2>{0.386088789f, 0.63884151f},
-std::array<float,2>{0.692820013f, 0.489199728f},
-std::array<float,2>{0.40449819f, 0.00779844634f},
-std::array<float,2>{0.711723983f, 0.948395908f},
-std::array<float,2>{0.24460867f, 0.659006953f},
-std::array<float,2>{0.957701564f, 0.464119673f},
-std::array<float,2>{0.108489327f, 0.366190135f},
-std::array<float,2>{0.850734472f, 0.616314232f},
-std::array<float,2>{0.341550767f, 0.840118051f},
-std::array<float,2>{0.52205658f, 0.216041684f},
-std::array<float,2>{0.26585108f, 0.426450998f},
-std::array<float,2>{0.588649392f, 0.739607453f},
-std::array<float,2>{0.00560971908f, 0.933423162f},
-std::array<float,2>{0.810457051f, 0.119772643f},
-std::array<float,2>{0.132123426f, 0.15687643f},
-std::array<float,2>{0.922249019f, 0.798527479f},
-std::array<float,2>{0.449100167f, 0.514025569f},
-std::array<float,2>{0.671641946f, 0.293908417f},
-std::array<float,2>{0.366186917f, 0.21928966f},
-std::array<float,2>{0.536925793f, 0.868613839f},
-std::array<float,2>{0.0689731538f, 0.593611658f},
-std::array<float,2>{0.822756708f, 0.326331109f},
-std::array<float,2>{0.206952602f, 0.471013337f},
-std::array<float,2>{0.991772056f, 0.642674983f},
-std::array<float,2>{0.433543772f, 0.97267586f},
-std::array<float,2>{0.742765129f, 0.0463566594f},
-std::array<float,2>{0.469876528f, 0.265200317f},
-std::array<float,2>{0.6534338f, 0.53595084f},
-std::array<float,2>{0.157414168f, 0.760642111f},
-std::array<float,2>{0.88168174f, 0.150166735f},
-std::array<float,2>{0.0598765351f, 0.0823147297f},
-std::array<float,2>{0.762278736f, 0.879793108f},
-std::array<float,2>{0.304693758f, 0.713787675f},
-std::array<float,2>{0.601875722f, 0.380182803f},
-std::array<float,2>{0.330531299f, 0.0320455283f},
-std::array<float,2>{0.529989004f, 0.977329135f},
-std::array<float,2>{0.0978568271f, 0.649037957f},
-std::array<float,2>{0.855645061f, 0.483923197f},
-std::array<float,2>{0.236925855f, 0.31834811f},
-std::array<float,2>{0.966166437f, 0.581495464f},
-std::array<float,2>{0.390849471f, 0.863794684f},
-std::array<float,2>{0.706346393f, 0.23034963f},
-std::array<float,2>{0.444020033f, 0.38311258f},
-std::array<float,2>{0.662838817f, 0.710493326f},
-std::array<float,2>{0.135350868f, 0.889384627f},
-std::array<float,2>{0.933647931f, 0.0869951025f},
-std::array<float,2>{0.0122352829f, 0.142495766f},
-std::array<float,2>{0.798433602f, 0.752193451f},
-std::array<float,2>{0.280235738f, 0.539802074f},
-std::array<float,2>{0.578814387f, 0.257453352f},
-std::array<float,2>{0.426594883f, 0.207780212f},
-std::array<float,2>{0.736002028f, 0.828317285f},
-std::array<float,2>{0.21712774f, 0.622910082f},
-std::array<float,2>{0.999725163f, 0.37197265f},
-std::array<float,2>{0.0715974271f, 0.455212533f},
-std::array<float,2>{0.819443166f, 0.666876554f},
-std::array<float,2>{0.374940127f, 0.938624501f},
-std::array<float,2>{0.542011321f, 0.014219787f},
-std::array<float,2>{0.300720811f, 0.284519136f},
-std::array<float,2>{0.598217666f, 0.504679859f},
-std::array<float,2>{0.0544277839f, 0.811365902f},
-std::array<float,2>{0.751409829f, 0.164925262f},
-std::array<float,2>{0.164638728f, 0.112090409f},
-std::array<float,2>{0.888119936f, 0.927878916f},
-std::array<float,2>{0.477183133f, 0.743185818f},
-std::array<float,2>{0.647366405f, 0.430922389f},
-std::array<float,2>{0.497879416f, 0.070180513f},
-std::array<float,2>{0.62666744f, 0.896616101f},
-std::array<float,2>{0.184983939f, 0.699864626f},
-std::array<float,2>{0.896551549f, 0.390783191f},
-std::array<float,2>{0.0373065658f, 0.266122699f},
-std::array<float,2>{0.771496117f, 0.550361216f},
-std::array<float,2>{0.285829842f, 0.775693476f},
-std::array<float,2>{0.622585297f, 0.132032081f},
-std::array<float,2>{0.352494955f, 0.496620357f},
-std::array<float,2>{0.549780846f, 0.628020644f},
-std::array<float,2>{0.0932998359f, 0.997880578f},
-std::array<float,2>{0.840352893f, 0.0558052585f},
-std::array<float,2>{0.194266856f, 0.24194783f},
-std::array<float,2>{0.974818408f, 0.854826272f},
-std::array<float,2>{0.410057068f, 0.56258738f},
-std::array<float,2>{0.733856022f, 0.332471281f},
-std::array<float,2>{0.250889599f, 0.187237337f},
-std::array<float,2>{0.5719226f, 0.787152112f},
-std::array<float,2>{0.0182932951f, 0.529240549f},
-std::array<float,2>{0.781459272f, 0.305719316f},
-std::array<float,2>{0.141713157f, 0.419721544f},
-std::array<float,2>{0.914908707f, 0.732190669f},
-std::array<float,2>{0.45378089f, 0.915445745f},
-std::array<float,2>{0.673550248f, 0.102353208f},
-std::array<float,2>{0.382722557f, 0.346310914f},
-std::array<float,2>{0.702463269f, 0.594355524f},
-std::array<float,2>{0.233475208f, 0.824456155f},
-std::array<float,2>{0.952226102f, 0.188859552f},
-std::array<float,2>{0.123037778f, 0.0227522384f},
-std::array<float,2>{0.868078709f, 0.958691537f},
-std::array<float,2>{0.317412168f, 0.673039377f},
-std::array<float,2>{0.501169324f, 0.448600292f},
-std::array<float,2>{0.349445581f, 0.0923080221f},
-std::array<float,2>{0.558933794f, 0.885817528f},
-std::array<float,2>{0.0801622644f, 0.703856766f},
-std::array<float,2>{0.832928956f, 0.390177876f},
-std::array<float,2>{0.202795297f, 0.252037972f},
-std::array<float,2>{0.983212411f, 0.546763182f},
-std::array<float,2>{0.418041617f, 0.754242003f},
-std::array<float,2>{0.725580513f, 0.145601928f},
-std::array<float,2>{0.49151054f, 0.47993359f},
-std::array<float,2>{0.635761142f, 0.652963758f},
-std::array<float,2>{0.176438659f, 0.980508745f},
-std::array<float,2>{0.905345678f, 0.0361276492f},
-std::array<float,2>{0.0405490696f, 0.231724277f},
-std::array<float,2>{0.774156868f, 0.860390723f},
-std::array<float,2>{0.290739655f, 0.582781851f},
-std::array<float,2>{0.617113829f, 0.314433098f},
-std::array<float,2>{0.387864798f, 0.17174305f},
-std::array<float,2>{0.690326154f, 0.805070162f},
-std::array<float,2>{0.22090143f, 0.501228631f},
-std::array<float,2>{0.938342571f, 0.287686199f},
-std::array<float,2>{0.110834248f, 0.436794221f},
-std::array<float,2>{0.86509949f, 0.749627471f},
-std::array<float,2>{0.325489134f, 0.924769938f},
-std::array<float,2>{0.514759243f, 0.116520964f},
-std::array<float,2>{0.262066066f, 0.370688051f},
-std::array<float,2>{0.56687659f, 0.61769402f},
-std::array<float,2>{0.023777768f, 0.834717393f},
-std::array<float,2>{0.789655328f, 0.206259876f},
-std::array<float,2>{0.152526751f, 0.0109269368f},
-std::array<float,2>{0.910025954f, 0.944648504f},
-std::array<float,2>{0.462841719f, 0.669880629f},
-std::array<float,2>{0.687001288f, 0.460375607f},
-std::array<float,2>{0.44996956f, 0.0606904142f},
-std::array<float,2>{0.667866468f, 0.992273569f},
-std::array<float,2>{0.127287209f, 0.630321681f},
-std::array<float,2>{0.926692903f, 0.493706852f},
-std::array<float,2>{0.00334965973f, 0.330924869f},
-std::array<float,2>{0.806407571f, 0.570044637f},
-std::array<float,2>{0.270024538f, 0.859052122f},
-std::array<float,2>{0.590347052f, 0.235124454f},
-std::array<float,2>{0.339512378f, 0.395480484f},
-std::array<float,2>{0.517351806f, 0.69898802f},
-std::array<float,2>{0.103999205f, 0.891495824f},
-std::array<float,2>{0.847486377f, 0.0660251081f},
-std::array<float,2>{0.246493399f, 0.128438205f},
-std::array<float,2>{0.954734564f, 0.77889961f},
-std::array<float,2>{0.401217043f, 0.55129081f},
-std::array<float,2>{0.715645492f, 0.271799475f},
-std::array<float,2>{0.309729606f, 0.19314684f},
-std::array<float,2>{0.6056813f, 0.823910594f},
-std::array<float,2>{0.0575445704f, 0.598620892f},
-std::array<float,2>{0.759362757f, 0.348575085f},
-std::array<float,2>{0.163041785f, 0.45287326f},
-std::array<float,2>{0.878530562f, 0.675904274f},
-std::array<float,2>{0.475553155f, 0.955413282f},
-std::array<float,2>{0.649582505f, 0.0161492489f},
-std::array<float,2>{0.43433249f, 0.309037626f},
-std::array<float,2>{0.748102844f, 0.525717258f},
-std::array<float,2>{0.209314868f, 0.78298986f},
-std::array<float,2>{0.985447228f, 0.182681635f},
-std::array<float,2>{0.0658505261f, 0.108212769f},
-std::array<float,2>{0.825319529f, 0.920776963f},
-std::array<float,2>{0.361731678f, 0.727119148f},
-std::array<float,2>{0.531397045f, 0.416225463f},
-std::array<float,2>{0.274274141f, 0.0238586441f},
-std::array<float,2>{0.585894942f, 0.963152826f},
-std::array<float,2>{0.00806156173f, 0.680835903f},
-std::array<float,2>{0.802748442f, 0.442125708f},
-std::array<float,2>{0.138703629f, 0.357451499f},
-std::array<float,2>{0.933232009f, 0.607405543f},
-std::array<float,2>{0.44108507f, 0.813958347f},
-std::array<float,2>{0.656369686f, 0.199338794f},
-std::array<float,2>{0.395952314f, 0.411943495f},
-std::array<float,2>{0.709800124f, 0.720010519f},
-std::array<float,2>{0.238352552f, 0.907414675f},
-std::array<float,2>{0.962085843f, 0.0999433845f},
-std::array<float,2>{0.0945499167f, 0.179280862f},
-std::array<float,2>{0.851977944f, 0.794505954f},
-std::array<float,2>{0.332917392f, 0.519749343f},
-std::array<float,2>{0.526051342f, 0.30149895f},
-std::array<float,2>{0.483770072f, 0.24528718f},
-std::array<float,2>{0.642279625f, 0.844291985f},
-std::array<float,2>{0.170708433f, 0.574860752f},
-std::array<float,2>{0.884055018f, 0.339083642f},
-std::array<float,2>{0.0473114885f, 0.48673436f},
-std::array<float,2>{0.753961504f, 0.636395812f},
-std::array<float,2>{0.304353654f, 0.990192175f},
-std::array<float,2>{0.593995154f, 0.0509348623f},
-std::array<float,2>{0.369914025f, 0.279942453f},
-std::array<float,2>{0.545936584f, 0.557487309f},
-std::array<float,2>{0.0744629651f, 0.76854682f},
-std::array<float,2>{0.813117146f, 0.135785311f},
-std::array<float,2>{0.21143955f, 0.0775062591f},
-std::array<float,2>{0.994777799f, 0.900657594f},
-std::array<float,2>{0.424269766f, 0.691818714f},
-std::array<float,2>{0.738493145f, 0.402019024f},
-std::array<float,2>{0.410374403f, 0.121918097f},
-std::array<float,2>{0.728720307f, 0.935441732f},
-std::array<float,2>{0.189235032f, 0.735371232f},
-std::array<float,2>{0.971726179f, 0.423518926f},
-std::array<float,2>{0.0884783119f, 0.28935349f},
-std::array<float,2>{0.837155819f, 0.508416295f},
-std::array<float,2>{0.358721882f, 0.802769899f},
-std::array<float,2>{0.55176574f, 0.160906777f},
-std::array<float,2>{0.284307539f, 0.466180384f},
-std::array<float,2>{0.618058383f, 0.660834372f},
-std::array<float,2>{0.03321632f, 0.952848494f},
-std::array<float,2>{0.768417537f, 3.78755976e-05f},
-std::array<float,2>{0.180971161f, 0.213580057f},
-std::array<float,2>{0.890767992f, 0.838081837f},
-std::array<float,2>{0.493834436f, 0.610549271f},
-std::array<float,2>{0.630511582f, 0.362431139f},
-std::array<float,2>{0.312606335f, 0.155032113f},
-std::array<float,2>{0.504265904f, 0.765208304f},
-std::array<float,2>{0.117255643f, 0.534850717f},
-std::array<float,2>{0.873864353f, 0.259788007f},
-std::array<float,2>{0.227858767f, 0.376774549f},
-std::array<float,2>{0.947361708f, 0.717010021f},
-std::array<float,2>{0.37821877f, 0.878351629f},
-std::array<float,2>{0.696434379f, 0.0782970786f},
-std::array<float,2>{0.460597128f, 0.323726982f},
-std::array<float,2>{0.677256465f, 0.586499155f},
-std::array<float,2>{0.147505671f, 0.871176481f},
-std::array<float,2>{0.921774328f, 0.226533294f},
-std::array<float,2>{0.0209749322f, 0.0426332355f},
-std::array<float,2>{0.785440385f, 0.968758464f},
-std::array<float,2>{0.254935145f, 0.648205161f},
-std::array<float,2>{0.574670911f, 0.473712385f},
-std::array<float,2>{0.305757016f, 0.0841526464f},
-std::array<float,2>{0.603163302f, 0.881060958f},
-std::array<float,2>{0.0591440462f, 0.711104214f},
-std::array<float,2>{0.763605833f, 0.381364048f},
-std::array<float,2>{0.156541705f, 0.263048857f},
-std::array<float,2>{0.88207978f, 0.537856936f},
-std::array<float,2>{0.468789339f, 0.758916378f},
-std::array<float,2>{0.652582049f, 0.150471374f},
-std::array<float,2>{0.432105869f, 0.469007581f},
-std::array<float,2>{0.743454278f, 0.64139688f},
-std::array<float,2>{0.205512822f, 0.97559768f},
-std::array<float,2>{0.990439534f, 0.0439918563f},
-std::array<float,2>{0.0695442557f, 0.221377492f},
-std::array<float,2>{0.823951066f, 0.870310664f},
-std::array<float,2>{0.366496325f, 0.59056437f},
-std::array<float,2>{0.535203278f, 0.325088948f},
-std::array<float,2>{0.447608382f, 0.159209177f},
-std::array<float,2>{0.670409381f, 0.800359607f},
-std::array<float,2>{0.130861849f, 0.512401938f},
-std::array<float,2>{0.923690677f, 0.295674711f},
-std::array<float,2>{0.00403975369f, 0.428797513f},
-std::array<float,2>{0.80927825f, 0.740779579f},
-std::array<float,2>{0.267254263f, 0.93093735f},
-std::array<float,2>{0.589723706f, 0.117192641f},
-std::array<float,2>{0.340029299f, 0.364965945f},
-std::array<float,2>{0.523012996f, 0.613883615f},
-std::array<float,2>{0.108026199f, 0.842135251f},
-std::array<float,2>{0.849844694f, 0.218419313f},
-std::array<float,2>{0.245953768f, 0.00583967334f},
-std::array<float,2>{0.958565295f, 0.947075069f},
-std::array<float,2>{0.4060781f, 0.658159554f},
-std::array<float,2>{0.712497234f, 0.462624878f},
-std::array<float,2>{0.384799451f, 0.0471159369f},
-std::array<float,2>{0.692122638f, 0.98474139f},
-std::array<float,2>{0.225184724f, 0.637024403f},
-std::array<float,2>{0.943537056f, 0.491572171f},
-std::array<float,2>{0.116853379f, 0.340586543f},
-std::array<float,2>{0.860250354f, 0.573149621f},
-std::array<float,2>{0.32398349f, 0.851029932f},
-std::array<float,2>{0.510759234f, 0.247031868f},
-std::array<float,2>{0.259355754f, 0.403854817f},
-std::array<float,2>{0.562655568f, 0.690049887f},
-std::array<float,2>{0.0299306642f, 0.904768705f},
-std::array<float,2>{0.794896603f, 0.0703376606f},
-std::array<float,2>{0.148986936f, 0.138903111f},
-std::array<float,2>{0.910957813f, 0.770290136f},
-std::array<float,2>{0.464855194f, 0.559479296f},
-std::array<float,2>{0.68271178f, 0.273940444f},
-std::array<float,2>{0.344331115f, 0.197029382f},
-std::array<float,2>{0.555832684f, 0.818469763f},
-std::array<float,2>{0.082229875f, 0.605037093f},
-std::array<float,2>{0.829487741f, 0.354899228f},
-std::array<float,2>{0.198791713f, 0.440661281f},
-std::array<float,2>{0.980377018f, 0.686836362f},
-std::array<float,2>{0.416050524f, 0.96831429f},
-std::array<float,2>{0.719346046f, 0.0297552366f},
-std::array<float,2>{0.486464113f, 0.299697816f},
-std::array<float,2>{0.639285147f, 0.516508102f},
-std::array<float,2>{0.174802378f, 0.792224228f},
-std::array<float,2>{0.900880694f, 0.175064594f},
-std::array<float,2>{0.0430834964f, 0.0965399966f},
-std::array<float,2>{0.779370904f, 0.912912011f},
-std::array<float,2>{0.293739915f, 0.726412833f},
-std::array<float,2>{0.610888302f, 0.408413321f},
-std::array<float,2>{0.317365378f, 0.0210596006f},
-std::array<float,2>{0.500424981f, 0.960817039f},
-std::array<float,2>{0.121467866f, 0.674489379f},
-std::array<float,2>{0.868356586f, 0.445481658f},
-std::array<float,2>{0.233277425f, 0.345221996f},
-std::array<float,2>{0.951425374f, 0.596077919f},
-std::array<float,2>{0.381742418f, 0.827407658f},
-std::array<float,2>{0.70194751f, 0.191183195f},
-std::array<float,2>{0.454948366f, 0.421664745f},
-std::array<float,2>{0.672415197f, 0.733474851f},
-std::array<float,2>{0.141208038f, 0.917467892f},
-std::array<float,2>{0.915597498f, 0.103899129f},
-std::array<float,2>{0.0192497466f, 0.185012028f},
-std::array<float,2>{0.783061624f, 0.787064731f},
-std::array<float,2>{0.251074523f, 0.529780149f},
-std::array<float,2>{0.570743263f, 0.307712346f},
-std::array<float,2>{0.408820808f, 0.24023068f},
-std::array<float,2>{0.732660949f, 0.851629198f},
-std::array<float,2>{0.194576651f, 0.564571679f},
-std::array<float,2>{0.976073682f, 0.335691959f},
-std::array<float,2>{0.0925851241f, 0.499607265f},
-std::array<float,2>{0.84099859f, 0.625908315f},
-std::array<float,2>{0.353399813f, 0.999785244f},
-std::array<float,2>{0.550752461f, 0.0574082211f},
-std::array<float,2>{0.286872566f, 0.269353658f},
-std::array<float,2>{0.621779144f, 0.548597693f},
-std::array<float,2>{0.0383748487f, 0.77485317f},
-std::array<float,2>{0.773421764f, 0.128912032f},
-std::array<float,2>{0.184258312f, 0.0670409277f},
-std::array<float,2>{0.897756696f, 0.895559669f},
-std::array<float,2>{0.496706635f, 0.702307343f},
-std::array<float,2>{0.625346899f, 0.393180102f},
-std::array<float,2>{0.478090107f, 0.110426232f},
-std::array<float,2>{0.647790074f, 0.926368892f},
-std::array<float,2>{0.16547811f, 0.745432794f},
-std::array<float,2>{0.887673557f, 0.431829274f},
-std::array<float,2>{0.0531969815f, 0.283053011f},
-std::array<float,2>{0.750049949f, 0.507674575f},
-std::array<float,2>{0.298911899f, 0.809919178f},
-std::array<float,2>{0.598723292f, 0.166624516f},
-std::array<float,2>{0.373880059f, 0.454951137f},
-std::array<float,2>{0.54191941f, 0.664158523f},
-std::array<float,2>{0.0710932985f, 0.940728605f},
-std::array<float,2>{0.819207549f, 0.0123276301f},
-std::array<float,2>{0.218472496f, 0.209052548f},
-std::array<float,2>{0.998935103f, 0.830828011f},
-std::array<float,2>{0.427129239f, 0.623932064f},
-std::array<float,2>{0.734796941f, 0.37315321f},
-std::array<float,2>{0.280697554f, 0.144324765f},
-std::array<float,2>{0.579942286f, 0.750852287f},
-std::array<float,2>{0.0134427305f, 0.542003691f},
-std::array<float,2>{0.797098815f, 0.255349785f},
-std::array<float,2>{0.135886759f, 0.386382699f},
-std::array<float,2>{0.934911668f, 0.707298338f},
-std::array<float,2>{0.444440037f, 0.887661278f},
-std::array<float,2>{0.663872719f, 0.0884258375f},
-std::array<float,2>{0.391836643f, 0.319397688f},
-std::array<float,2>{0.70511961f, 0.578992903f},
-std::array<float,2>{0.237379849f, 0.86656481f},
-std::array<float,2>{0.965406597f, 0.228347898f},
-std::array<float,2>{0.0988269225f, 0.0337262861f},
-std::array<float,2>{0.85670054f, 0.979201436f},
-std::array<float,2>{0.331136584f, 0.650926232f},
-std::array<float,2>{0.530761838f, 0.480922997f},
-std::array<float,2>{0.363157868f, 0.107136011f},
-std::array<float,2>{0.532346368f, 0.918136537f},
-std::array<float,2>{0.0645874292f, 0.728821456f},
-std::array<float,2>{0.824427843f, 0.414335549f},
-std::array<float,2>{0.210671335f, 0.310827762f},
-std::array<float,2>{0.985255718f, 0.524784148f},
-std::array<float,2>{0.43523702f, 0.785136461f},
-std::array<float,2>{0.749035776f, 0.180955812f},
-std::array<float,2>{0.476424396f, 0.449823767f},
-std::array<float,2>{0.648569524f, 0.679598629f},
-std::array<float,2>{0.163810357f, 0.953723907f},
-std::array<float,2>{0.87735641f, 0.0176247396f},
-std::array<float,2>{0.0579338931f, 0.19386895f},
-std::array<float,2>{0.758713543f, 0.821856916f},
-std::array<float,2>{0.30893448f, 0.600034297f},
-std::array<float,2>{0.606975555f, 0.349673837f},
-std::array<float,2>{0.402171552f, 0.125252053f},
-std::array<float,2>{0.716070235f, 0.779690802f},
-std::array<float,2>{0.247323141f, 0.552972674f},
-std::array<float,2>{0.953619063f, 0.271076262f},
-std::array<float,2>{0.105280593f, 0.397395998f},
-std::array<float,2>{0.846535206f, 0.695749879f},
-std::array<float,2>{0.338530779f, 0.892950475f},
-std::array<float,2>{0.516006172f, 0.063014634f},
-std::array<float,2>{0.270761222f, 0.329475611f},
-std::array<float,2>{0.591412306f, 0.567837596f},
-std::array<float,2>{0.00199292321f, 0.856764913f},
-std::array<float,2>{0.805512965f, 0.238133281f},
-std::array<float,2>{0.128400743f, 0.0588635094f},
-std::array<float,2>{0.927381635f, 0.995525301f},
-std::array<float,2>{0.450556934f, 0.632682204f},
-std::array<float,2>{0.666218042f, 0.496084601f},
-std::array<float,2>{0.46187219f, 0.00809640717f},
-std::array<float,2>{0.686330676f, 0.941715121f},
-std::array<float,2>{0.153480589f, 0.671552956f},
-std::array<float,2>{0.909088135f, 0.458092302f},
-std::array<float,2>{0.0250167884f, 0.367599189f},
-std::array<float,2>{0.790536821f, 0.619296134f},
-std::array<float,2>{0.262966484f, 0.833051205f},
-std::array<float,2>{0.567486525f, 0.204106465f},
-std::array<float,2>{0.324321985f, 0.435320914f},
-std::array<float,2>{0.513970733f, 0.746268868f},
-std::array<float,2>{0.109778441f, 0.922111928f},
-std::array<float,2>{0.864074349f, 0.114608705f},
-std::array<float,2>{0.221689463f, 0.168615103f},
-std::array<float,2>{0.939409673f, 0.807841301f},
-std::array<float,2>{0.387633741f, 0.503496885f},
-std::array<float,2>{0.691080809f, 0.287016302f},
-std::array<float,2>{0.289113373f, 0.232654274f},
-std::array<float,2>{0.61610359f, 0.862430096f},
-std::array<float,2>{0.039475549f, 0.584333062f},
-std::array<float,2>{0.775132895f, 0.314672023f},
-std::array<float,2>{0.17741783f, 0.476636797f},
-std::array<float,2>{0.904750884f, 0.656020105f},
-std::array<float,2>{0.490869403f, 0.983017564f},
-std::array<float,2>{0.635524869f, 0.0376844965f},
-std::array<float,2>{0.419325382f, 0.251358211f},
-std::array<float,2>{0.725692689f, 0.544597864f},
-std::array<float,2>{0.201506853f, 0.756170511f},
-std::array<float,2>{0.983527839f, 0.14706184f},
-std::array<float,2>{0.0813462883f, 0.0911858752f},
-std::array<float,2>{0.833888233f, 0.884138882f},
-std::array<float,2>{0.347837597f, 0.706864297f},
-std::array<float,2>{0.560230136f, 0.38835749f},
-std::array<float,2>{0.253995538f, 0.0404318683f},
-std::array<float,2>{0.57559979f, 0.97250396f},
-std::array<float,2>{0.0202030838f, 0.645640135f},
-std::array<float,2>{0.786769152f, 0.476262599f},
-std::array<float,2>{0.146588311f, 0.320595443f},
-std::array<float,2>{0.920785904f, 0.588386893f},
-std::array<float,2>{0.459525526f, 0.874135911f},
-std::array<float,2>{0.676630497f, 0.223256707f},
-std::array<float,2>{0.377481878f, 0.377920538f},
-std::array<float,2>{0.695450008f, 0.716410875f},
-std::array<float,2>{0.22751534f, 0.876595497f},
-std::array<float,2>{0.94879669f, 0.0814375952f},
-std::array<float,2>{0.11826089f, 0.152829558f},
-std::array<float,2>{0.874096215f, 0.761842906f},
-std::array<float,2>{0.314394832f, 0.532690465f},
-std::array<float,2>{0.505353749f, 0.258446157f},
-std::array<float,2>{0.492731363f, 0.21226792f},
-std::array<float,2>{0.62899524f, 0.837130189f},
-std::array<float,2>{0.180063933f, 0.612752259f},
-std::array<float,2>{0.892392874f, 0.360470682f},
-std::array<float,2>{0.0347275734f, 0.466850758f},
-std::array<float,2>{0.768890202f, 0.66245389f},
-std::array<float,2>{0.283593655f, 0.949263632f},
-std::array<float,2>{0.61823386f, 0.00217713253f},
-std::array<float,2>{0.357871056f, 0.291672975f},
-std::array<float,2>{0.55142796f, 0.511083364f},
-std::array<float,2>{0.0891414359f, 0.800959408f},
-std::array<float,2>{0.836073399f, 0.162201554f},
-std::array<float,2>{0.188266397f, 0.123836756f},
-std::array<float,2>{0.970712185f, 0.93654716f},
-std::array<float,2>{0.411719114f, 0.737505853f},
-std::array<float,2>{0.729741693f, 0.424339056f},
-std::array<float,2>{0.425736278f, 0.075987801f},
-std::array<float,2>{0.73930037f, 0.898670375f},
-std::array<float,2>{0.212230295f, 0.693620741f},
-std::array<float,2>{0.996007681f, 0.399155766f},
-std::array<float,2>{0.0753491744f, 0.278829455f},
-std::array<float,2>{0.813599527f, 0.555936098f},
-std::array<float,2>{0.370972514f, 0.767305732f},
-std::array<float,2>{0.545635164f, 0.134567752f},
-std::array<float,2>{0.302975029f, 0.4851183f},
-std::array<float,2>{0.594879925f, 0.634757161f},
-std::array<float,2>{0.0483573936f, 0.990278065f},
-std::array<float,2>{0.755757809f, 0.0531384684f},
-std::array<float,2>{0.171691313f, 0.243220165f},
-std::array<float,2>{0.883167803f, 0.846892595f},
-std::array<float,2>{0.483071625f, 0.576923311f},
-std::array<float,2>{0.640935838f, 0.336270809f},
-std::array<float,2>{0.333972037f, 0.177357972f},
-std::array<float,2>{0.526757836f, 0.795661807f},
-std::array<float,2>{0.0948221534f, 0.522594154f},
-std::array<float,2>{0.853078604f, 0.304202199f},
-std::array<float,2>{0.239797682f, 0.413238376f},
-std::array<float,2>{0.961260974f, 0.720765173f},
-std::array<float,2>{0.395366311f, 0.908792019f},
-std::array<float,2>{0.709999919f, 0.0979214981f},
-std::array<float,2>{0.439685434f, 0.355867863f},
-std::array<float,2>{0.658126116f, 0.60928911f},
-std::array<float,2>{0.140583798f, 0.815691292f},
-std::array<float,2>{0.93253994f, 0.201621875f},
-std::array<float,2>{0.00965515897f, 0.026109416f},
-std::array<float,2>{0.804549932f, 0.961627424f},
-std::array<float,2>{0.274719864f, 0.682603359f},
-std::array<float,2>{0.584104598f, 0.444027662f},
-std::array<float,2>{0.269066751f, 0.120464899f},
-std::array<float,2>{0.587188184f, 0.932098985f},
-std::array<float,2>{0.00624702359f, 0.738729119f},
-std::array<float,2>{0.811488926f, 0.426908463f},
-std::array<float,2>{0.130339906f, 0.294588417f},
-std::array<float,2>{0.925172806f, 0.514773488f},
-std::array<float,2>{0.445533216f, 0.797480345f},
-std::array<float,2>{0.669689536f, 0.158103615f},
-std::array<float,2>{0.402576089f, 0.463703394f},
-std::array<float,2>{0.714069486f, 0.6595819f},
-std::array<float,2>{0.242302284f, 0.948143423f},
-std::array<float,2>{0.960027158f, 0.00600411138f},
-std::array<float,2>{0.106804632f, 0.215470955f},
-std::array<float,2>{0.848710299f, 0.841000617f},
-std::array<float,2>{0.343296379f, 0.615674198f},
-std::array<float,2>{0.52013284f, 0.366387963f},
-std::array<float,2>{0.472397745f, 0.149176598f},
-std::array<float,2>{0.654677153f, 0.761190057f},
-std::array<float,2>{0.159347951f, 0.536389053f},
-std::array<float,2>{0.880646884f, 0.263696909f},
-std::array<float,2>{0.062226098f, 0.379629642f},
-std::array<float,2>{0.764039397f, 0.71441561f},
-std::array<float,2>{0.308344275f, 0.880462527f},
-std::array<float,2>{0.603634953f, 0.0839121342f},
-std::array<float,2>{0.363783032f, 0.328113168f},
-std::array<float,2>{0.537420213f, 0.592305303f},
-std::array<float,2>{0.0672688484f, 0.867218971f},
-std::array<float,2>{0.820477903f, 0.219876379f},
-std::array<float,2>{0.204085574f, 0.0454909243f},
-std::array<float,2>{0.990094602f, 0.973897219f},
-std::array<float,2>{0.431083322f, 0.643950999f},
-std::array<float,2>{0.745581031f, 0.472226322f},
-std::array<float,2>{0.414423972f, 0.0273715593f},
-std::array<float,2>{0.722089231f, 0.965245247f},
-std::array<float,2>{0.196202129f, 0.684989989f},
-std::array<float,2>{0.977982461f, 0.43858844f},
-std::array<float,2>{0.0848725587f, 0.353220284f},
-std::array<float,2>{0.831979454f, 0.60191834f},
-std::array<float,2>{0.345735699f, 0.818218172f},
-std::array<float,2>{0.557420313f, 0.197936907f},
-std::array<float,2>{0.295757383f, 0.408066571f},
-std::array<float,2>{0.612224042f, 0.723807693f},
-std::array<float,2>{0.045236785f, 0.911245942f},
-std::array<float,2>{0.77892679f, 0.0944591016f},
-std::array<float,2>{0.173771203f, 0.173213616f},
-std::array<float,2>{0.899982035f, 0.790835679f},
-std::array<float,2>{0.486233026f, 0.518759847f},
-std::array<float,2>{0.637108207f, 0.297125161f},
-std::array<float,2>{0.322218627f, 0.248446077f},
-std::array<float,2>{0.508976519f, 0.84845674f},
-std::array<float,2>{0.113306977f, 0.57095629f},
-std::array<float,2>{0.863183737f, 0.343523264f},
-std::array<float,2>{0.223007768f, 0.489284307f},
-std::array<float,2>{0.942373931f, 0.639963806f},
-std::array<float,2>{0.383623779f, 0.987987578f},
-std::array<float,2>{0.69493705f, 0.0498108231f},
-std::array<float,2>{0.467798263f, 0.276358396f},
-std::array<float,2>{0.681255877f, 0.561021209f},
-std::array<float,2>{0.152209148f, 0.772144616f},
-std::array<float,2>{0.913562238f, 0.13799569f},
-std::array<float,2>{0.027417304f, 0.0736354589f},
-std::array<float,2>{0.794976056f, 0.902705014f},
-std::array<float,2>{0.261296809f, 0.688344836f},
-std::array<float,2>{0.564550459f, 0.405948222f},
-std::array<float,2>{0.354015261f, 0.0550255254f},
-std::array<float,2>{0.547713578f, 0.996197701f},
-std::array<float,2>{0.0903840885f, 0.627876282f},
-std::array<float,2>{0.84263438f, 0.497101635f},
-std::array<float,2>{0.193259239f, 0.333364993f},
-std::array<float,2>{0.973794878f, 0.564341187f},
-std::array<float,2>{0.406934828f, 0.853851676f},
-std::array<float,2>{0.731042266f, 0.241043195f},
-std::array<float,2>{0.498821467f, 0.391965985f},
-std::array<float,2>{0.627378047f, 0.700941026f},
-std::array<float,2>{0.187275276f, 0.897799671f},
-std::array<float,2>{0.896124244f, 0.0690022111f},
-std::array<float,2>{0.0354567543f, 0.131435037f},
-std::array<float,2>{0.770251215f, 0.77685231f},
-std::array<float,2>{0.288270026f, 0.549621463f},
-std::array<float,2>{0.624303699f, 0.267477334f},
-std::array<float,2>{0.379890561f, 0.187501624f},
-std::array<float,2>{0.699759007f, 0.826075792f},
-std::array<float,2>{0.231727853f, 0.59569937f},
-std::array<float,2>{0.950686693f, 0.347487718f},
-std::array<float,2>{0.123741627f, 0.447794408f},
-std::array<float,2>{0.870058656f, 0.671949625f},
-std::array<float,2>{0.318710238f, 0.95792836f},
-std::array<float,2>{0.502056062f, 0.0224016085f},
-std::array<float,2>{0.252210021f, 0.305065095f},
-std::array<float,2>{0.572288811f, 0.527658701f},
-std::array<float,2>{0.0159125924f, 0.78861618f},
-std::array<float,2>{0.783603251f, 0.186027139f},
-std::array<float,2>{0.143886462f, 0.103297912f},
-std::array<float,2>{0.917417824f, 0.914394855f},
-std::array<float,2>{0.456018478f, 0.731350601f},
-std::array<float,2>{0.67400074f, 0.418851197f},
-std::array<float,2>{0.442490637f, 0.086429216f},
-std::array<float,2>{0.660688818f, 0.889690399f},
-std::array<float,2>{0.133792117f, 0.709591985f},
-std::array<float,2>{0.937282145f, 0.384370059f},
-std::array<float,2>{0.0155465947f, 0.255952626f},
-std::array<float,2>{0.799323559f, 0.540107429f},
-std::array<float,2>{0.278093457f, 0.753819168f},
-std::array<float,2>{0.580731571f, 0.141218528f},
-std::array<float,2>{0.328996718f, 0.483386636f},
-std::array<float,2>{0.527493119f, 0.649950981f},
-std::array<float,2>{0.100457996f, 0.978247106f},
-std::array<float,2>{0.858555436f, 0.0325721875f},
-std::array<float,2>{0.235429808f, 0.228862703f},
-std::array<float,2>{0.967495561f, 0.864883661f},
-std::array<float,2>{0.394140691f, 0.580546558f},
-std::array<float,2>{0.704208016f, 0.317220122f},
-std::array<float,2>{0.29757601f, 0.165746957f},
-std::array<float,2>{0.60154587f, 0.812457263f},
-std::array<float,2>{0.0514687039f, 0.50499475f},
-std::array<float,2>{0.752969086f, 0.283803672f},
-std::array<float,2>{0.166646451f, 0.429761499f},
-std::array<float,2>{0.889253795f, 0.742365837f},
-std::array<float,2>{0.480377078f, 0.929584384f},
-std::array<float,2>{0.645807266f, 0.113188319f},
-std::array<float,2>{0.427999109f, 0.3730039f},
-std::array<float,2>{0.736544073f, 0.621979594f},
-std::array<float,2>{0.216077372f, 0.829407096f},
-std::array<float,2>{0.997275949f, 0.208093196f},
-std::array<float,2>{0.0731390342f, 0.0152897052f},
-std::array<float,2>{0.817833424f, 0.938144326f},
-std::array<float,2>{0.372842193f, 0.667893589f},
-std::array<float,2>{0.540423036f, 0.456682444f},
-std::array<float,2>{0.337340206f, 0.064702265f},
-std::array<float,2>{0.518767834f, 0.89180845f},
-std::array<float,2>{0.10235507f, 0.698020816f},
-std::array<float,2>{0.845630169f, 0.396098822f},
-std::array<float,2>{0.249274179f, 0.273153692f},
-std::array<float,2>{0.956916034f, 0.552045286f},
-std::array<float,2>{0.39978835f, 0.777740479f},
-std::array<float,2>{0.717916071f, 0.127284452f},
-std::array<float,2>{0.451507568f, 0.492839426f},
-std::array<float,2>{0.665884674f, 0.629838228f},
-std::array<float,2>{0.125076011f, 0.993701339f},
-std::array<float,2>{0.928243279f, 0.0619673282f},
-std::array<float,2>{0.000926907698f, 0.236180171f},
-std::array<float,2>{0.807123065f, 0.858056068f},
-std::array<float,2>{0.272792846f, 0.568394959f},
-std::array<float,2>{0.593744874f, 0.331328332f},
-std::array<float,2>{0.436971456f, 0.181759715f},
-std::array<float,2>{0.747115433f, 0.781398296f},
-std::array<float,2>{0.208965644f, 0.526758432f},
-std::array<float,2>{0.987258196f, 0.30977422f},
-std::array<float,2>{0.0635178983f, 0.417633504f},
-std::array<float,2>{0.826341152f, 0.728433609f},
-std::array<float,2>{0.360415012f, 0.921796441f},
-std::array<float,2>{0.534079671f, 0.109187946f},
-std::array<float,2>{0.312344223f, 0.348899484f},
-std::array<float,2>{0.607668996f, 0.599061728f},
-std::array<float,2>{0.0553580523f, 0.822494924f},
-std::array<float,2>{0.760222018f, 0.192186967f},
-std::array<float,2>{0.160765752f, 0.0172549449f},
-std::array<float,2>{0.876075685f, 0.956888914f},
-std::array<float,2>{0.474179506f, 0.677632213f},
-std::array<float,2>{0.6511724f, 0.451396674f},
-std::array<float,2>{0.489808112f, 0.036265377f},
-std::array<float,2>{0.633969247f, 0.982085109f},
-std::array<float,2>{0.178644434f, 0.654295266f},
-std::array<float,2>{0.903740823f, 0.478784442f},
-std::array<float,2>{0.0416802727f, 0.312555969f},
-std::array<float,2>{0.776423216f, 0.583467603f},
-std::array<float,2>{0.291430086f, 0.86012584f},
-std::array<float,2>{0.614462435f, 0.230489746f},
-std::array<float,2>{0.350574374f, 0.389118731f},
-std::array<float,2>{0.561631322f, 0.704830587f},
-std::array<float,2>{0.0800003186f, 0.885411024f},
-std::array<float,2>{0.835783839f, 0.092997022f},
-std::array<float,2>{0.199466527f, 0.144568861f},
-std::array<float,2>{0.981805086f, 0.754957199f},
-std::array<float,2>{0.419982523f, 0.54500252f},
-std::array<float,2>{0.723988116f, 0.253710032f},
-std::array<float,2>{0.26383388f, 0.205126941f},
-std::array<float,2>{0.569005013f, 0.835156798f},
-std::array<float,2>{0.0255964492f, 0.618889093f},
-std::array<float,2>{0.792269409f, 0.370057046f},
-std::array<float,2>{0.15493463f, 0.459554046f},
-std::array<float,2>{0.906347275f, 0.6687783f},
-std::array<float,2>{0.464731336f, 0.943480432f},
-std::array<float,2>{0.685280979f, 0.0107335551f},
-std::array<float,2>{0.389947236f, 0.288498044f},
-std::array<float,2>{0.68942523f, 0.500038147f},
-std::array<float,2>{0.219044447f, 0.806151748f},
-std::array<float,2>{0.940166712f, 0.170885324f},
-std::array<float,2>{0.112783529f, 0.115445696f},
-std::array<float,2>{0.86606127f, 0.92501241f},
-std::array<float,2>{0.327658743f, 0.748309731f},
-std::array<float,2>{0.513281107f, 0.43569985f},
-std::array<float,2>{0.282441944f, 0.0013082464f},
-std::array<float,2>{0.620498121f, 0.951959014f},
-std::array<float,2>{0.0317610614f, 0.661419094f},
-std::array<float,2>{0.767477155f, 0.465475768f},
-std::array<float,2>{0.182029545f, 0.361614347f},
-std::array<float,2>{0.893517554f, 0.609387696f},
-std::array<float,2>{0.49451381f, 0.83893317f},
-std::array<float,2>{0.631242871f, 0.214086518f},
-std::array<float,2>{0.413184047f, 0.422101319f},
-std::array<float,2>{0.728066206f, 0.734759688f},
-std::array<float,2>{0.189831123f, 0.934335649f},
-std::array<float,2>{0.969732046f, 0.122569725f},
-std::array<float,2>{0.0876235887f, 0.161710948f},
-std::array<float,2>{0.839161694f, 0.804097652f},
-std::array<float,2>{0.356221974f, 0.508937776f},
-std::array<float,2>{0.55314821f, 0.290079087f},
-std::array<float,2>{0.45895043f, 0.224860281f},
-std::array<float,2>{0.678256094f, 0.872587442f},
-std::array<float,2>{0.146036789f, 0.587858617f},
-std::array<float,2>{0.919035494f, 0.322934598f},
-std::array<float,2>{0.0224853512f, 0.473368138f},
-std::array<float,2>{0.788070261f, 0.647056043f},
-std::array<float,2>{0.256158859f, 0.970343709f},
-std::array<float,2>{0.576345205f, 0.0419660322f},
-std::array<float,2>{0.315538138f, 0.261553675f},
-std::array<float,2>{0.506710827f, 0.53334552f},
-std::array<float,2>{0.11924807f, 0.764175355f},
-std::array<float,2>{0.87115854f, 0.156194746f},
-std::array<float,2>{0.228705719f, 0.0798642114f},
-std::array<float,2>{0.947119594f, 0.877759159f},
-std::array<float,2>{0.376820773f, 0.71786809f},
-std::array<float,2>{0.698180497f, 0.37593624f},
-std::array<float,2>{0.39785409f, 0.100984126f},
-std::array<float,2>{0.707823396f, 0.906954229f},
-std::array<float,2>{0.241086006f, 0.71957922f},
-std::array<float,2>{0.963462293f, 0.410866648f},
-std::array<float,2>{0.0968857855f, 0.302653819f},
-std::array<float,2>{0.853636026f, 0.520532191f},
-std::array<float,2>{0.33423093f, 0.793465853f},
-std::array<float,2>{0.523770213f, 0.178071946f},
-std::array<float,2>{0.27664268f, 0.442758232f},
-std::array<float,2>{0.583534241f, 0.680611789f},
-std::array<float,2>{0.00985002052f, 0.964656591f},
-std::array<float,2>{0.802310824f, 0.0247579869f},
-std::array<float,2>{0.137730196f, 0.201154202f},
-std::array<float,2>{0.930999219f, 0.813265562f},
-std::array<float,2>{0.439188421f, 0.606190622f},
-std::array<float,2>{0.659927309f, 0.359115064f},
-std::array<float,2>{0.36814487f, 0.135320306f},
-std::array<float,2>{0.544775844f, 0.769000351f},
-std::array<float,2>{0.0772865191f, 0.557727635f},
-std::array<float,2>{0.81566602f, 0.280437142f},
-std::array<float,2>{0.21431385f, 0.400459349f},
-std::array<float,2>{0.993314505f, 0.692936063f},
-std::array<float,2>{0.423695326f, 0.901540637f},
-std::array<float,2>{0.741901219f, 0.077082783f},
-std::array<float,2>{0.481734574f, 0.338298202f},
-std::array<float,2>{0.644510627f, 0.575833976f},
-std::array<float,2>{0.169260204f, 0.844981492f},
-std::array<float,2>{0.886067688f, 0.244897217f},
-std::array<float,2>{0.0503180288f, 0.0520585366f},
-std::array<float,2>{0.756213188f, 0.989243567f},
-std::array<float,2>{0.302122712f, 0.635282815f},
-std::array<float,2>{0.59697026f, 0.48796913f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.352602661f, 0.281701922f},
-std::array<float,2>{0.717938483f, 0.991477251f},
-std::array<float,2>{0.780502856f, 0.192729548f},
-std::array<float,2>{0.216358706f, 0.742117226f},
-std::array<float,2>{0.0444540158f, 0.113270916f},
-std::array<float,2>{0.992084742f, 0.589023113f},
-std::array<float,2>{0.545223832f, 0.436149478f},
-std::array<float,2>{0.480820358f, 0.818297148f},
-std::array<float,2>{0.428860217f, 0.163488582f},
-std::array<float,2>{0.605051637f, 0.650369346f},
-std::array<float,2>{0.932451427f, 0.343130797f},
-std::array<float,2>{0.106829181f, 0.89567101f},
-std::array<float,2>{0.176680461f, 0.470424652f},
-std::array<float,2>{0.835330665f, 0.777775824f},
-std::array<float,2>{0.673645616f, 0.0592563637f},
-std::array<float,2>{0.310041308f, 0.520100653f},
-std::array<float,2>{0.461000085f, 0.40393284f},
-std::array<float,2>{0.516671658f, 0.844391882f},
-std::array<float,2>{0.940539002f, 0.0921444669f},
-std::array<float,2>{0.00472590141f, 0.60659343f},
-std::array<float,2>{0.234571949f, 0.236383125f},
-std::array<float,2>{0.791440666f, 0.717327595f},
-std::array<float,2>{0.730804324f, 0.25991407f},
-std::array<float,2>{0.335187584f, 0.946816206f},
-std::array<float,2>{0.272495717f, 0.00726067461f},
-std::array<float,2>{0.647056997f, 0.552723587f},
-std::array<float,2>{0.844939828f, 0.459462285f},
-std::array<float,2>{0.152069792f, 0.786568284f},
-std::array<float,2>{0.0841747299f, 0.364691406f},
-std::array<float,2>{0.90476191f, 0.922299504f},
-std::array<float,2>{0.586575508f, 0.146237895f},
-std::array<float,2>{0.388831526f, 0.671156824f},
-std::array<float,2>{0.286838949f, 0.446051329f},
-std::array<float,2>{0.660416365f, 0.81018883f},
-std::array<float,2>{0.824296832f, 0.0273684934f},
-std::array<float,2>{0.170496553f, 0.53461355f},
-std::array<float,2>{0.124147519f, 0.129290879f},
-std::array<float,2>{0.917241633f, 0.680065513f},
-std::array<float,2>{0.624826014f, 0.357756853f},
-std::array<float,2>{0.416152745f, 0.912733614f},
-std::array<float,2>{0.487927258f, 0.0692750961f},
-std::array<float,2>{0.549696684f, 0.613379836f},
-std::array<float,2>{0.98198992f, 0.379060656f},
-std::array<float,2>{0.0537578985f, 0.865881026f},
-std::array<float,2>{0.189695626f, 0.276627839f},
-std::array<float,2>{0.75333786f, 0.964147627f},
-std::array<float,2>{0.695649564f, 0.226796508f},
-std::array<float,2>{0.370951563f, 0.690577149f},
-std::array<float,2>{0.398871362f, 0.313897371f},
-std::array<float,2>{0.572365999f, 0.887219191f},
-std::array<float,2>{0.878228188f, 0.182666302f},
-std::array<float,2>{0.066777356f, 0.639345765f},
-std::array<float,2>{0.125491306f, 0.03162691f},
-std::array<float,2>{0.871217966f, 0.501770139f},
-std::array<float,2>{0.634241402f, 0.489806473f},
-std::array<float,2>{0.262906998f, 0.756547093f},
-std::array<float,2>{0.327896565f, 0.211071581f},
-std::array<float,2>{0.736300766f, 0.719841361f},
-std::array<float,2>{0.806198299f, 0.303082615f},
-std::array<float,2>{0.23007676f, 0.984043956f},
-std::array<float,2>{0.0295382626f, 0.406567842f},
-std::array<float,2>{0.960274637f, 0.83307308f},
-std::array<float,2>{0.504110396f, 0.0955301151f},
-std::array<float,2>{0.444702834f, 0.574274242f},
-std::array<float,2>{0.252913326f, 0.346870244f},
-std::array<float,2>{0.626802981f, 0.916984677f},
-std::array<float,2>{0.865708649f, 0.136304498f},
-std::array<float,2>{0.134119183f, 0.673015416f},
-std::array<float,2>{0.076435335f, 0.0174912419f},
-std::array<float,2>{0.887733221f, 0.53999424f},
-std::array<float,2>{0.568718612f, 0.441290319f},
-std::array<float,2>{0.395762295f, 0.799511135f},
-std::array<float,2>{0.44791913f, 0.223659202f},
-std::array<float,2>{0.510801673f, 0.698595226f},
-std::array<float,2>{0.961869776f, 0.266361892f},
-std::array<float,2>{0.0214881934f, 0.954647183f},
-std::array<float,2>{0.220011845f, 0.388891935f},
-std::array<float,2>{0.802832484f, 0.868895769f},
-std::array<float,2>{0.748766184f, 0.0777632967f},
-std::array<float,2>{0.319713801f, 0.623697281f},
-std::array<float,2>{0.413197756f, 0.492809623f},
-std::array<float,2>{0.611441255f, 0.764878273f},
-std::array<float,2>{0.906967282f, 0.0434834138f},
-std::array<float,2>{0.113202922f, 0.508983314f},
-std::array<float,2>{0.161232919f, 0.177554205f},
-std::array<float,2>{0.812750459f, 0.626854658f},
-std::array<float,2>{0.669623435f, 0.327549905f},
-std::array<float,2>{0.28931585f, 0.876899183f},
-std::array<float,2>{0.360535473f, 0.102174677f},
-std::array<float,2>{0.692544997f, 0.562500894f},
-std::array<float,2>{0.758386075f, 0.417596847f},
-std::array<float,2>{0.202901676f, 0.843111575f},
-std::array<float,2>{0.05633929f, 0.309994876f},
-std::array<float,2>{0.973358274f, 0.971840203f},
-std::array<float,2>{0.56086719f, 0.210565075f},
-std::array<float,2>{0.497509956f, 0.733153105f},
-std::array<float,2>{0.34251532f, 0.425064296f},
-std::array<float,2>{0.723999918f, 0.821907043f},
-std::array<float,2>{0.78326571f, 0.11821384f},
-std::array<float,2>{0.244795442f, 0.579271674f},
-std::array<float,2>{0.0128193852f, 0.197443679f},
-std::array<float,2>{0.946069956f, 0.749529898f},
-std::array<float,2>{0.530483186f, 0.292621315f},
-std::array<float,2>{0.454083979f, 0.995338798f},
-std::array<float,2>{0.380995572f, 0.0500060767f},
-std::array<float,2>{0.581285954f, 0.525129616f},
-std::array<float,2>{0.894804418f, 0.477989107f},
-std::array<float,2>{0.0937023163f, 0.765911698f},
-std::array<float,2>{0.142302483f, 0.333036751f},
-std::array<float,2>{0.853604317f, 0.906005681f},
-std::array<float,2>{0.655518889f, 0.165067852f},
-std::array<float,2>{0.276996732f, 0.641579032f},
-std::array<float,2>{0.469903976f, 0.254686475f},
-std::array<float,2>{0.533768713f, 0.94364351f},
-std::array<float,2>{0.996276617f, 0.249164566f},
-std::array<float,2>{0.0331278965f, 0.708220482f},
-std::array<float,2>{0.205917493f, 0.0838124305f},
-std::array<float,2>{0.767352939f, 0.595317245f},
-std::array<float,2>{0.704818308f, 0.396059126f},
-std::array<float,2>{0.345452249f, 0.858062625f},
-std::array<float,2>{0.304363787f, 0.152080327f},
-std::array<float,2>{0.684520841f, 0.65985775f},
-std::array<float,2>{0.836664796f, 0.370707899f},
-std::array<float,2>{0.179752901f, 0.934405386f},
-std::array<float,2>{0.0969571844f, 0.461294413f},
-std::array<float,2>{0.925504208f, 0.792819262f},
-std::array<float,2>{0.59986192f, 0.0122061446f},
-std::array<float,2>{0.431772977f, 0.557303786f},
-std::array<float,2>{0.307057142f, 0.271113753f},
-std::array<float,2>{0.678229034f, 0.960039496f},
-std::array<float,2>{0.831985235f, 0.222432822f},
-std::array<float,2>{0.171877816f, 0.701415002f},
-std::array<float,2>{0.104146495f, 0.0706730485f},
-std::array<float,2>{0.936732948f, 0.619741261f},
-std::array<float,2>{0.609155536f, 0.385578841f},
-std::array<float,2>{0.424634188f, 0.874004006f},
-std::array<float,2>{0.477706432f, 0.139619783f},
-std::array<float,2>{0.542530894f, 0.678573489f},
-std::array<float,2>{0.988144934f, 0.348864675f},
-std::array<float,2>{0.0420410819f, 0.918674052f},
-std::array<float,2>{0.212036058f, 0.44189173f},
-std::array<float,2>{0.775454581f, 0.802804947f},
-std::array<float,2>{0.712845325f, 0.0221647043f},
-std::array<float,2>{0.359038442f, 0.544474423f},
-std::array<float,2>{0.385132432f, 0.420523852f},
-std::array<float,2>{0.59251821f, 0.839193881f},
-std::array<float,2>{0.900490761f, 0.108123355f},
-std::array<float,2>{0.0793045536f, 0.567795217f},
-std::array<float,2>{0.154712245f, 0.205468014f},
-std::array<float,2>{0.850998223f, 0.729835868f},
-std::array<float,2>{0.641344786f, 0.306189179f},
-std::array<float,2>{0.269505173f, 0.973574758f},
-std::array<float,2>{0.328936756f, 0.0408088677f},
-std::array<float,2>{0.729033709f, 0.515540123f},
-std::array<float,2>{0.796065032f, 0.496341497f},
-std::array<float,2>{0.241015211f, 0.76005441f},
-std::array<float,2>{0.00364364521f, 0.322647959f},
-std::array<float,2>{0.944007158f, 0.881973565f},
-std::array<float,2>{0.523129702f, 0.173280671f},
-std::array<float,2>{0.468674123f, 0.631861269f},
-std::array<float,2>{0.373972178f, 0.48356238f},
-std::array<float,2>{0.699611127f, 0.771042109f},
-std::array<float,2>{0.754187763f, 0.0513919741f},
-std::array<float,2>{0.195173562f, 0.530088127f},
-std::array<float,2>{0.0478491038f, 0.171799347f},
-std::array<float,2>{0.979319453f, 0.644839525f},
-std::array<float,2>{0.552919567f, 0.330942899f},
-std::array<float,2>{0.491348952f, 0.898731232f},
-std::array<float,2>{0.418654352f, 0.122528292f},
-std::array<float,2>{0.619698167f, 0.584104061f},
-std::array<float,2>{0.921815753f, 0.427535713f},
-std::array<float,2>{0.1191471f, 0.827654541f},
-std::array<float,2>{0.166446328f, 0.296738923f},
-std::array<float,2>{0.82285279f, 0.996355236f},
-std::array<float,2>{0.657199383f, 0.201240227f},
-std::array<float,2>{0.284887046f, 0.745658576f},
-std::array<float,2>{0.440119028f, 0.374554902f},
-std::array<float,2>{0.500262678f, 0.932754934f},
-std::array<float,2>{0.955982983f, 0.1549391f},
-std::array<float,2>{0.0253804438f, 0.66367197f},
-std::array<float,2>{0.230668172f, 0.00823864434f},
-std::array<float,2>{0.810223699f, 0.559806645f},
-std::array<float,2>{0.738983572f, 0.466390014f},
-std::array<float,2>{0.320449144f, 0.796395063f},
-std::array<float,2>{0.260991216f, 0.245936006f},
-std::array<float,2>{0.638374209f, 0.704391718f},
-std::array<float,2>{0.868402898f, 0.250543356f},
-std::array<float,2>{0.132088035f, 0.940690935f},
-std::array<float,2>{0.0641017184f, 0.390962332f},
-std::array<float,2>{0.879661739f, 0.85526216f},
-std::array<float,2>{0.576667309f, 0.0813215151f},
-std::array<float,2>{0.402952701f, 0.600743592f},
-std::array<float,2>{0.313413054f, 0.337987334f},
-std::array<float,2>{0.745655f, 0.8936342f},
-std::array<float,2>{0.797462225f, 0.156383008f},
-std::array<float,2>{0.223193914f, 0.654496908f},
-std::array<float,2>{0.0186999217f, 0.0582847036f},
-std::array<float,2>{0.967844605f, 0.516569436f},
-std::array<float,2>{0.511908591f, 0.474559009f},
-std::array<float,2>{0.452381015f, 0.775675893f},
-std::array<float,2>{0.39222759f, 0.190348089f},
-std::array<float,2>{0.566373169f, 0.736841023f},
-std::array<float,2>{0.883390009f, 0.28667292f},
-std::array<float,2>{0.0730029196f, 0.986882806f},
-std::array<float,2>{0.139401838f, 0.432735533f},
-std::array<float,2>{0.862347186f, 0.814906955f},
-std::array<float,2>{0.631157517f, 0.115545556f},
-std::array<float,2>{0.256359935f, 0.590051115f},
-std::array<float,2>{0.495282233f, 0.454008162f},
-std::array<float,2>{0.55504024f, 0.782634318f},
-std::array<float,2>{0.969619155f, 0.00122343656f},
-std::array<float,2>{0.0618030056f, 0.548975468f},
-std::array<float,2>{0.196755156f, 0.143387198f},
-std::array<float,2>{0.764974833f, 0.665544212f},
-std::array<float,2>{0.690945208f, 0.362397999f},
-std::array<float,2>{0.363687485f, 0.927784741f},
-std::array<float,2>{0.296394855f, 0.0897917151f},
-std::array<float,2>{0.664442062f, 0.60399276f},
-std::array<float,2>{0.818013728f, 0.398890942f},
-std::array<float,2>{0.160097912f, 0.848026693f},
-std::array<float,2>{0.115751252f, 0.262583733f},
-std::array<float,2>{0.911720216f, 0.951099157f},
-std::array<float,2>{0.614534616f, 0.238626465f},
-std::array<float,2>{0.409223795f, 0.713742077f},
-std::array<float,2>{0.28110972f, 0.377182603f},
-std::array<float,2>{0.648776412f, 0.862766147f},
-std::array<float,2>{0.856163085f, 0.0630068257f},
-std::array<float,2>{0.144994676f, 0.612845182f},
-std::array<float,2>{0.0868667439f, 0.234177873f},
-std::array<float,2>{0.893702567f, 0.692105889f},
-std::array<float,2>{0.583809912f, 0.280613989f},
-std::array<float,2>{0.375454009f, 0.965328217f},
-std::array<float,2>{0.458538264f, 0.0248190314f},
-std::array<float,2>{0.523624063f, 0.5366804f},
-std::array<float,2>{0.952459276f, 0.451997042f},
-std::array<float,2>{0.0102012036f, 0.806019247f},
-std::array<float,2>{0.247630492f, 0.35213092f},
-std::array<float,2>{0.786784649f, 0.909548283f},
-std::array<float,2>{0.722358167f, 0.126169309f},
-std::array<float,2>{0.338707298f, 0.685311675f},
-std::array<float,2>{0.433896393f, 0.298186034f},
-std::array<float,2>{0.595117152f, 0.977057099f},
-std::array<float,2>{0.928103328f, 0.215045735f},
-std::array<float,2>{0.0978510827f, 0.722967446f},
-std::array<float,2>{0.186867237f, 0.098916173f},
-std::array<float,2>{0.841586232f, 0.571459174f},
-std::array<float,2>{0.680438757f, 0.413662434f},
-std::array<float,2>{0.298725367f, 0.830031931f},
-std::array<float,2>{0.350491554f, 0.18501097f},
-std::array<float,2>{0.708390594f, 0.636204779f},
-std::array<float,2>{0.770430386f, 0.317344874f},
-std::array<float,2>{0.209795415f, 0.886634171f},
-std::array<float,2>{0.0364239551f, 0.487298787f},
-std::array<float,2>{0.995589912f, 0.752512693f},
-std::array<float,2>{0.538616776f, 0.0366465487f},
-std::array<float,2>{0.473017514f, 0.506303251f},
-std::array<float,2>{0.332181543f, 0.258010298f},
-std::array<float,2>{0.73264122f, 0.947553813f},
-std::array<float,2>{0.790467799f, 0.235275358f},
-std::array<float,2>{0.237315446f, 0.716517627f},
-std::array<float,2>{0.00628873333f, 0.0905194879f},
-std::array<float,2>{0.938854754f, 0.607571185f},
-std::array<float,2>{0.518836498f, 0.405614853f},
-std::array<float,2>{0.463933408f, 0.847379565f},
-std::array<float,2>{0.386947036f, 0.146510318f},
-std::array<float,2>{0.588576019f, 0.669652164f},
-std::array<float,2>{0.902522445f, 0.365417123f},
-std::array<float,2>{0.0830647871f, 0.923941374f},
-std::array<float,2>{0.148901299f, 0.458573103f},
-std::array<float,2>{0.847141683f, 0.78900826f},
-std::array<float,2>{0.645635724f, 0.00488626398f},
-std::array<float,2>{0.270528108f, 0.553206384f},
-std::array<float,2>{0.482886642f, 0.43506968f},
-std::array<float,2>{0.544628441f, 0.820038199f},
-std::array<float,2>{0.988705039f, 0.11090745f},
-std::array<float,2>{0.0460255928f, 0.586857021f},
-std::array<float,2>{0.218573913f, 0.193481967f},
-std::array<float,2>{0.777364433f, 0.738578677f},
-std::array<float,2>{0.71570307f, 0.284037471f},
-std::array<float,2>{0.354783803f, 0.990209877f},
-std::array<float,2>{0.310998648f, 0.0624365248f},
-std::array<float,2>{0.675387502f, 0.522828639f},
-std::array<float,2>{0.832728922f, 0.470745027f},
-std::array<float,2>{0.179149821f, 0.780373633f},
-std::array<float,2>{0.108785465f, 0.341413975f},
-std::array<float,2>{0.930735052f, 0.897066474f},
-std::array<float,2>{0.602013528f, 0.161441088f},
-std::array<float,2>{0.427054077f, 0.650522411f},
-std::array<float,2>{0.264007449f, 0.491577268f},
-std::array<float,2>{0.635391474f, 0.754292846f},
-std::array<float,2>{0.873104215f, 0.0332911089f},
-std::array<float,2>{0.12873736f, 0.503618181f},
-std::array<float,2>{0.0687182471f, 0.179954901f},
-std::array<float,2>{0.876113057f, 0.638641596f},
-std::array<float,2>{0.570690095f, 0.316357404f},
-std::array<float,2>{0.40137881f, 0.890344441f},
-std::array<float,2>{0.44208622f, 0.0970178396f},
-std::array<float,2>{0.506866992f, 0.577477157f},
-std::array<float,2>{0.958867431f, 0.409222484f},
-std::array<float,2>{0.0274092127f, 0.834291041f},
-std::array<float,2>{0.227716386f, 0.301914781f},
-std::array<float,2>{0.808116734f, 0.982205689f},
-std::array<float,2>{0.736621678f, 0.213615149f},
-std::array<float,2>{0.324810863f, 0.722511053f},
-std::array<float,2>{0.415029168f, 0.356751531f},
-std::array<float,2>{0.622462809f, 0.911225379f},
-std::array<float,2>{0.91575706f, 0.131288871f},
-std::array<float,2>{0.121122926f, 0.683329701f},
-std::array<float,2>{0.169868588f, 0.0307167768f},
-std::array<float,2>{0.827687383f, 0.532135427f},
-std::array<float,2>{0.662979603f, 0.44884041f},
-std::array<float,2>{0.287651211f, 0.812216461f},
-std::array<float,2>{0.368389368f, 0.23025313f},
-std::array<float,2>{0.697875857f, 0.689263284f},
-std::array<float,2>{0.750289142f, 0.273664415f},
-std::array<float,2>{0.1888901f, 0.961346388f},
-std::array<float,2>{0.0525881909f, 0.382567495f},
-std::array<float,2>{0.984010696f, 0.863618612f},
-std::array<float,2>{0.547126412f, 0.0668499768f},
-std::array<float,2>{0.485445261f, 0.615948796f},
-std::array<float,2>{0.292838871f, 0.324481755f},
-std::array<float,2>{0.671136022f, 0.878638625f},
-std::array<float,2>{0.815433443f, 0.177941293f},
-std::array<float,2>{0.163391635f, 0.628825247f},
-std::array<float,2>{0.109432168f, 0.0465683043f},
-std::array<float,2>{0.90883106f, 0.511617243f},
-std::array<float,2>{0.610106409f, 0.495899916f},
-std::array<float,2>{0.410276502f, 0.762447715f},
-std::array<float,2>{0.498305082f, 0.208528608f},
-std::array<float,2>{0.560411632f, 0.730703831f},
-std::array<float,2>{0.975222468f, 0.310982823f},
-std::array<float,2>{0.0574604347f, 0.96907407f},
-std::array<float,2>{0.200133353f, 0.415611386f},
-std::array<float,2>{0.76129818f, 0.839944422f},
-std::array<float,2>{0.69339025f, 0.105215594f},
-std::array<float,2>{0.362869918f, 0.56476593f},
-std::array<float,2>{0.397121638f, 0.438764036f},
-std::array<float,2>{0.566577971f, 0.797642589f},
-std::array<float,2>{0.888694167f, 0.017870497f},
-std::array<float,2>{0.0746308565f, 0.542421937f},
-std::array<float,2>{0.135723904f, 0.13392587f},
-std::array<float,2>{0.865204036f, 0.675340712f},
-std::array<float,2>{0.627265871f, 0.344558775f},
-std::array<float,2>{0.250105649f, 0.91480267f},
-std::array<float,2>{0.316758156f, 0.0754655302f},
-std::array<float,2>{0.746714652f, 0.621310174f},
-std::array<float,2>{0.802157104f, 0.386910349f},
-std::array<float,2>{0.221861973f, 0.870467305f},
-std::array<float,2>{0.0205487497f, 0.268229395f},
-std::array<float,2>{0.964429915f, 0.955648005f},
-std::array<float,2>{0.5094136f, 0.224776164f},
-std::array<float,2>{0.445701629f, 0.69649291f},
-std::array<float,2>{0.345831394f, 0.396843761f},
-std::array<float,2>{0.705319226f, 0.856172025f},
-std::array<float,2>{0.768270254f, 0.0845453218f},
-std::array<float,2>{0.203871891f, 0.596206784f},
-std::array<float,2>{0.0334457159f, 0.247430861f},
-std::array<float,2>{0.999796987f, 0.70939523f},
-std::array<float,2>{0.532585919f, 0.25618422f},
-std::array<float,2>{0.470942676f, 0.942555785f},
-std::array<float,2>{0.429779708f, 0.0147433626f},
-std::array<float,2>{0.598414719f, 0.555967569f},
-std::array<float,2>{0.923544228f, 0.463406146f},
-std::array<float,2>{0.0943404362f, 0.790316582f},
-std::array<float,2>{0.182932049f, 0.368545532f},
-std::array<float,2>{0.839359879f, 0.935721278f},
-std::array<float,2>{0.686615646f, 0.14956516f},
-std::array<float,2>{0.301825732f, 0.656753957f},
-std::array<float,2>{0.456987858f, 0.289944589f},
-std::array<float,2>{0.529128671f, 0.992494047f},
-std::array<float,2>{0.948075593f, 0.195485875f},
-std::array<float,2>{0.014178087f, 0.747689724f},
-std::array<float,2>{0.242665559f, 0.119547017f},
-std::array<float,2>{0.782663167f, 0.580713749f},
-std::array<float,2>{0.725087523f, 0.423567802f},
-std::array<float,2>{0.341426432f, 0.822496593f},
-std::array<float,2>{0.273768991f, 0.16784814f},
-std::array<float,2>{0.654141784f, 0.642834187f},
-std::array<float,2>{0.852281034f, 0.335013688f},
-std::array<float,2>{0.142911315f, 0.903169215f},
-std::array<float,2>{0.0903975889f, 0.479599118f},
-std::array<float,2>{0.898166537f, 0.768322945f},
-std::array<float,2>{0.578844249f, 0.0481515639f},
-std::array<float,2>{0.380186588f, 0.525613904f},
-std::array<float,2>{0.26732704f, 0.306872636f},
-std::array<float,2>{0.644348741f, 0.97586745f},
-std::array<float,2>{0.849011838f, 0.2038472f},
-std::array<float,2>{0.152643844f, 0.727144301f},
-std::array<float,2>{0.08054775f, 0.105594926f},
-std::array<float,2>{0.898878217f, 0.569754183f},
-std::array<float,2>{0.590672851f, 0.418091953f},
-std::array<float,2>{0.384644419f, 0.837156236f},
-std::array<float,2>{0.464932054f, 0.17466411f},
-std::array<float,2>{0.520745933f, 0.629949331f},
-std::array<float,2>{0.942437232f, 0.321713299f},
-std::array<float,2>{0.000868685078f, 0.878979146f},
-std::array<float,2>{0.239379689f, 0.498690337f},
-std::array<float,2>{0.794291615f, 0.758163393f},
-std::array<float,2>{0.727598548f, 0.0416775607f},
-std::array<float,2>{0.331996441f, 0.5129233f},
-std::array<float,2>{0.422047794f, 0.383043885f},
-std::array<float,2>{0.606299758f, 0.87251693f},
-std::array<float,2>{0.934284389f, 0.0741407275f},
-std::array<float,2>{0.10269323f, 0.618595362f},
-std::array<float,2>{0.174785718f, 0.22025606f},
-std::array<float,2>{0.828748465f, 0.700157881f},
-std::array<float,2>{0.675959051f, 0.271844894f},
-std::array<float,2>{0.304832816f, 0.957165062f},
-std::array<float,2>{0.356266439f, 0.0213806331f},
-std::array<float,2>{0.714499593f, 0.545882463f},
-std::array<float,2>{0.774895668f, 0.445265532f},
-std::array<float,2>{0.214554876f, 0.801456869f},
-std::array<float,2>{0.0396197699f, 0.350618124f},
-std::array<float,2>{0.985684097f, 0.920120835f},
-std::array<float,2>{0.539981067f, 0.136793777f},
-std::array<float,2>{0.480104953f, 0.677543521f},
-std::array<float,2>{0.323579758f, 0.467005044f},
-std::array<float,2>{0.741550267f, 0.794580102f},
-std::array<float,2>{0.811277926f, 0.0102245817f},
-std::array<float,2>{0.232568339f, 0.560770452f},
-std::array<float,2>{0.0254991073f, 0.153118148f},
-std::array<float,2>{0.953758121f, 0.661386788f},
-std::array<float,2>{0.503071368f, 0.371946067f},
-std::array<float,2>{0.439366192f, 0.930979133f},
-std::array<float,2>{0.404786825f, 0.0785214081f},
-std::array<float,2>{0.575558424f, 0.597738981f},
-std::array<float,2>{0.881869912f, 0.392967671f},
-std::array<float,2>{0.0646841824f, 0.852014363f},
-std::array<float,2>{0.129210949f, 0.252848178f},
-std::array<float,2>{0.869160652f, 0.938887596f},
-std::array<float,2>{0.640038133f, 0.242921144f},
-std::array<float,2>{0.258413196f, 0.706308901f},
-std::array<float,2>{0.48845315f, 0.32998687f},
-std::array<float,2>{0.552554369f, 0.90140754f},
-std::array<float,2>{0.978049934f, 0.168575972f},
-std::array<float,2>{0.0490331203f, 0.647134423f},
-std::array<float,2>{0.192541182f, 0.0537260175f},
-std::array<float,2>{0.757100999f, 0.528222024f},
-std::array<float,2>{0.702706695f, 0.481396973f},
-std::array<float,2>{0.371662706f, 0.772885919f},
-std::array<float,2>{0.282003552f, 0.199975476f},
-std::array<float,2>{0.660030901f, 0.742500186f},
-std::array<float,2>{0.820816338f, 0.294177562f},
-std::array<float,2>{0.164743915f, 0.998152614f},
-std::array<float,2>{0.117311209f, 0.429476857f},
-std::array<float,2>{0.918533146f, 0.824603558f},
-std::array<float,2>{0.617741823f, 0.123180911f},
-std::array<float,2>{0.42007181f, 0.583779454f},
-std::array<float,2>{0.365444094f, 0.360540003f},
-std::array<float,2>{0.689356089f, 0.926464736f},
-std::array<float,2>{0.762155533f, 0.14103362f},
-std::array<float,2>{0.198719338f, 0.66729027f},
-std::array<float,2>{0.0599259771f, 0.00380105409f},
-std::array<float,2>{0.971301079f, 0.548193634f},
-std::array<float,2>{0.5582636f, 0.456213057f},
-std::array<float,2>{0.492713183f, 0.785030127f},
-std::array<float,2>{0.408026695f, 0.241804689f},
-std::array<float,2>{0.616323769f, 0.710978627f},
-std::array<float,2>{0.914031029f, 0.264650017f},
-std::array<float,2>{0.115112878f, 0.951339722f},
-std::array<float,2>{0.156399727f, 0.401319474f},
-std::array<float,2>{0.819693863f, 0.850704908f},
-std::array<float,2>{0.666588247f, 0.086564891f},
-std::array<float,2>{0.293331861f, 0.601627588f},
-std::array<float,2>{0.450900406f, 0.47649169f},
-std::array<float,2>{0.514597237f, 0.773918629f},
-std::array<float,2>{0.96488595f, 0.0561026707f},
-std::array<float,2>{0.01607484f, 0.519034326f},
-std::array<float,2>{0.224971443f, 0.160023347f},
-std::array<float,2>{0.799365282f, 0.65309608f},
-std::array<float,2>{0.743442774f, 0.335986704f},
-std::array<float,2>{0.315056682f, 0.892430544f},
-std::array<float,2>{0.255156696f, 0.113894396f},
-std::array<float,2>{0.6293661f, 0.592510641f},
-std::array<float,2>{0.860434532f, 0.431277722f},
-std::array<float,2>{0.137673035f, 0.813463271f},
-std::array<float,2>{0.0714971125f, 0.287926614f},
-std::array<float,2>{0.885947704f, 0.984844148f},
-std::array<float,2>{0.56430912f, 0.187657282f},
-std::array<float,2>{0.394499063f, 0.735661626f},
-std::array<float,2>{0.300555319f, 0.411883622f},
-std::array<float,2>{0.682553649f, 0.830975711f},
-std::array<float,2>{0.842800617f, 0.101392306f},
-std::array<float,2>{0.184614927f, 0.573060393f},
-std::array<float,2>{0.0996097773f, 0.21746105f},
-std::array<float,2>{0.926531732f, 0.725238264f},
-std::array<float,2>{0.597611248f, 0.300662756f},
-std::array<float,2>{0.436127454f, 0.980079532f},
-std::array<float,2>{0.475242019f, 0.038963303f},
-std::array<float,2>{0.536304891f, 0.505502582f},
-std::array<float,2>{0.993032455f, 0.484723896f},
-std::array<float,2>{0.0381022058f, 0.751115561f},
-std::array<float,2>{0.207558364f, 0.320285529f},
-std::array<float,2>{0.77239871f, 0.883468211f},
-std::array<float,2>{0.710684478f, 0.185996771f},
-std::array<float,2>{0.349391431f, 0.633726001f},
-std::array<float,2>{0.378730565f, 0.279146612f},
-std::array<float,2>{0.585382223f, 0.968243778f},
-std::array<float,2>{0.891011f, 0.231591344f},
-std::array<float,2>{0.0879004598f, 0.694126964f},
-std::array<float,2>{0.148063928f, 0.0656438693f},
-std::array<float,2>{0.857858419f, 0.610069215f},
-std::array<float,2>{0.650605798f, 0.375967085f},
-std::array<float,2>{0.278320551f, 0.859401345f},
-std::array<float,2>{0.336391717f, 0.127433449f},
-std::array<float,2>{0.719445705f, 0.686865091f},
-std::array<float,2>{0.788604498f, 0.355366617f},
-std::array<float,2>{0.248632342f, 0.908089817f},
-std::array<float,2>{0.00859714206f, 0.450751841f},
-std::array<float,2>{0.950102031f, 0.806815863f},
-std::array<float,2>{0.52547127f, 0.0255282968f},
-std::array<float,2>{0.459423631f, 0.537735939f},
-std::array<float,2>{0.369155705f, 0.274768263f},
-std::array<float,2>{0.696956873f, 0.961928129f},
-std::array<float,2>{0.752708972f, 0.229372084f},
-std::array<float,2>{0.190971702f, 0.688299894f},
-std::array<float,2>{0.0527538359f, 0.067986019f},
-std::array<float,2>{0.980618179f, 0.617023706f},
-std::array<float,2>{0.550477624f, 0.381282836f},
-std::array<float,2>{0.486881882f, 0.864345312f},
-std::array<float,2>{0.417055368f, 0.132243067f},
-std::array<float,2>{0.623399317f, 0.682013869f},
-std::array<float,2>{0.916970849f, 0.356423348f},
-std::array<float,2>{0.123246565f, 0.910508871f},
-std::array<float,2>{0.171473235f, 0.448025197f},
-std::array<float,2>{0.825930715f, 0.810876489f},
-std::array<float,2>{0.662064612f, 0.0301857963f},
-std::array<float,2>{0.285880238f, 0.532572985f},
-std::array<float,2>{0.443523258f, 0.409173161f},
-std::array<float,2>{0.505510986f, 0.835086524f},
-std::array<float,2>{0.959167182f, 0.0964233801f},
-std::array<float,2>{0.0305459909f, 0.576390505f},
-std::array<float,2>{0.229489967f, 0.214275047f},
-std::array<float,2>{0.805245399f, 0.721034169f},
-std::array<float,2>{0.734848797f, 0.301557153f},
-std::array<float,2>{0.326213002f, 0.981278419f},
-std::array<float,2>{0.262233555f, 0.0348614082f},
-std::array<float,2>{0.633605957f, 0.502578437f},
-std::array<float,2>{0.872650325f, 0.490455598f},
-std::array<float,2>{0.126337498f, 0.755571425f},
-std::array<float,2>{0.0681401342f, 0.315020084f},
-std::array<float,2>{0.877172053f, 0.888982892f},
-std::array<float,2>{0.573432684f, 0.181114495f},
-std::array<float,2>{0.399457216f, 0.637573063f},
-std::array<float,2>{0.308638245f, 0.471907943f},
-std::array<float,2>{0.67237103f, 0.780083179f},
-std::array<float,2>{0.834912181f, 0.0612615049f},
-std::array<float,2>{0.177044451f, 0.521780014f},
-std::array<float,2>{0.105508879f, 0.160712019f},
-std::array<float,2>{0.93352586f, 0.651555836f},
-std::array<float,2>{0.604281902f, 0.340749592f},
-std::array<float,2>{0.428616792f, 0.897881389f},
-std::array<float,2>{0.481603205f, 0.110049479f},
-std::array<float,2>{0.546572745f, 0.587091684f},
-std::array<float,2>{0.990651488f, 0.434080034f},
-std::array<float,2>{0.0435198583f, 0.819215894f},
-std::array<float,2>{0.215291828f, 0.284619927f},
-std::array<float,2>{0.779647648f, 0.989043832f},
-std::array<float,2>{0.717265248f, 0.194974497f},
-std::array<float,2>{0.352157593f, 0.73988986f},
-std::array<float,2>{0.390584946f, 0.367144734f},
-std::array<float,2>{0.587247431f, 0.925620615f},
-std::array<float,2>{0.905609965f, 0.148397818f},
-std::array<float,2>{0.0854661018f, 0.668928087f},
-std::array<float,2>{0.151272431f, 0.00474717468f},
-std::array<float,2>{0.84404856f, 0.55421102f},
-std::array<float,2>{0.648005128f, 0.457600564f},
-std::array<float,2>{0.271827579f, 0.787711143f},
-std::array<float,2>{0.334442586f, 0.235770449f},
-std::array<float,2>{0.731451988f, 0.715774655f},
-std::array<float,2>{0.792947233f, 0.259370655f},
-std::array<float,2>{0.235666871f, 0.949087083f},
-std::array<float,2>{0.00584681844f, 0.404614925f},
-std::array<float,2>{0.939753234f, 0.845807672f},
-std::array<float,2>{0.51616931f, 0.0917394459f},
-std::array<float,2>{0.462584943f, 0.608834505f},
-std::array<float,2>{0.275987327f, 0.334098876f},
-std::array<float,2>{0.65467608f, 0.903464258f},
-std::array<float,2>{0.854682148f, 0.166098505f},
-std::array<float,2>{0.14116548f, 0.6442312f},
-std::array<float,2>{0.092385523f, 0.0476266034f},
-std::array<float,2>{0.896141469f, 0.527114153f},
-std::array<float,2>{0.580424666f, 0.479475528f},
-std::array<float,2>{0.382226914f, 0.768765807f},
-std::array<float,2>{0.454725623f, 0.196797594f},
-std::array<float,2>{0.529343903f, 0.746405125f},
-std::array<float,2>{0.947182775f, 0.290441543f},
-std::array<float,2>{0.0125660291f, 0.993768275f},
-std::array<float,2>{0.245212704f, 0.422343194f},
-std::array<float,2>{0.784933448f, 0.824108362f},
-std::array<float,2>{0.723221898f, 0.120353319f},
-std::array<float,2>{0.343136549f, 0.581250668f},
-std::array<float,2>{0.433352888f, 0.464406729f},
-std::array<float,2>{0.600591242f, 0.789399147f},
-std::array<float,2>{0.923969328f, 0.0143817477f},
-std::array<float,2>{0.0958427638f, 0.55472374f},
-std::array<float,2>{0.180835143f, 0.149321958f},
-std::array<float,2>{0.837622046f, 0.657387555f},
-std::array<float,2>{0.6850214f, 0.367859334f},
-std::array<float,2>{0.303501546f, 0.936788619f},
-std::array<float,2>{0.344289333f, 0.0854588449f},
-std::array<float,2>{0.703516543f, 0.596802056f},
-std::array<float,2>{0.76656884f, 0.398420781f},
-std::array<float,2>{0.206936523f, 0.856614947f},
-std::array<float,2>{0.0320157297f, 0.256854534f},
-std::array<float,2>{0.997680843f, 0.942125142f},
-std::array<float,2>{0.534536481f, 0.246918455f},
-std::array<float,2>{0.469376892f, 0.71038115f},
-std::array<float,2>{0.318783402f, 0.388469547f},
-std::array<float,2>{0.749309897f, 0.870063543f},
-std::array<float,2>{0.804417431f, 0.0743582174f},
-std::array<float,2>{0.219186187f, 0.622246027f},
-std::array<float,2>{0.0233868193f, 0.226119146f},
-std::array<float,2>{0.962666512f, 0.695692539f},
-std::array<float,2>{0.510349035f, 0.269304872f},
-std::array<float,2>{0.44852674f, 0.956226289f},
-std::array<float,2>{0.395216227f, 0.0192472171f},
-std::array<float,2>{0.570268929f, 0.541970551f},
-std::array<float,2>{0.886861205f, 0.437695533f},
-std::array<float,2>{0.0776098222f, 0.798682392f},
-std::array<float,2>{0.133569315f, 0.345177621f},
-std::array<float,2>{0.866800427f, 0.915987492f},
-std::array<float,2>{0.625434518f, 0.133341044f},
-std::array<float,2>{0.253673553f, 0.674534202f},
-std::array<float,2>{0.496119171f, 0.312459767f},
-std::array<float,2>{0.561585128f, 0.970348001f},
-std::array<float,2>{0.973995447f, 0.207919672f},
-std::array<float,2>{0.0548369139f, 0.732348442f},
-std::array<float,2>{0.201273695f, 0.104173474f},
-std::array<float,2>{0.758947253f, 0.566128135f},
-std::array<float,2>{0.692365408f, 0.414697528f},
-std::array<float,2>{0.359541208f, 0.84167254f},
-std::array<float,2>{0.290118217f, 0.178842872f},
-std::array<float,2>{0.66837877f, 0.627223849f},
-std::array<float,2>{0.813819528f, 0.325594932f},
-std::array<float,2>{0.160660595f, 0.877709568f},
-std::array<float,2>{0.111905605f, 0.494588375f},
-std::array<float,2>{0.908111691f, 0.763538301f},
-std::array<float,2>{0.612991214f, 0.0454205871f},
-std::array<float,2>{0.41259551f, 0.510019064f},
-std::array<float,2>{0.283900589f, 0.293257326f},
-std::array<float,2>{0.657891512f, 0.999357641f},
-std::array<float,2>{0.823578596f, 0.200398996f},
-std::array<float,2>{0.167897657f, 0.74337548f},
-std::array<float,2>{0.120363198f, 0.124726899f},
-std::array<float,2>{0.92016989f, 0.582076669f},
-std::array<float,2>{0.620752037f, 0.427813679f},
-std::array<float,2>{0.419351399f, 0.825865865f},
-std::array<float,2>{0.490781128f, 0.169626728f},
-std::array<float,2>{0.553771794f, 0.647972643f},
-std::array<float,2>{0.979687035f, 0.32895115f},
-std::array<float,2>{0.0482901186f, 0.900721669f},
-std::array<float,2>{0.193848893f, 0.481907874f},
-std::array<float,2>{0.755615592f, 0.772262454f},
-std::array<float,2>{0.70071125f, 0.0534069389f},
-std::array<float,2>{0.374989331f, 0.529133379f},
-std::array<float,2>{0.403382421f, 0.394285738f},
-std::array<float,2>{0.577725112f, 0.852760434f},
-std::array<float,2>{0.880472481f, 0.0798265338f},
-std::array<float,2>{0.0626908392f, 0.599431455f},
-std::array<float,2>{0.130949959f, 0.243973464f},
-std::array<float,2>{0.867626846f, 0.705850065f},
-std::array<float,2>{0.637345672f, 0.253570318f},
-std::array<float,2>{0.26061672f, 0.938084424f},
-std::array<float,2>{0.322153658f, 0.0112293959f},
-std::array<float,2>{0.74016583f, 0.562284112f},
-std::array<float,2>{0.809563458f, 0.468094736f},
-std::array<float,2>{0.231516123f, 0.793148339f},
-std::array<float,2>{0.0242106412f, 0.372949839f},
-std::array<float,2>{0.956065416f, 0.929884195f},
-std::array<float,2>{0.501196802f, 0.153969184f},
-std::array<float,2>{0.44091627f, 0.660654008f},
-std::array<float,2>{0.358009815f, 0.443697572f},
-std::array<float,2>{0.711019456f, 0.802398026f},
-std::array<float,2>{0.777002811f, 0.0201819465f},
-std::array<float,2>{0.211872652f, 0.546792924f},
-std::array<float,2>{0.041764643f, 0.137949511f},
-std::array<float,2>{0.98649776f, 0.676734388f},
-std::array<float,2>{0.541843176f, 0.350524753f},
-std::array<float,2>{0.477318764f, 0.921842515f},
-std::array<float,2>{0.424830616f, 0.0731295049f},
-std::array<float,2>{0.607531011f, 0.617257237f},
-std::array<float,2>{0.936448038f, 0.383803546f},
-std::array<float,2>{0.105354808f, 0.871171713f},
-std::array<float,2>{0.173633739f, 0.273416877f},
-std::array<float,2>{0.831013501f, 0.958794415f},
-std::array<float,2>{0.679265916f, 0.219229296f},
-std::array<float,2>{0.307920784f, 0.700511456f},
-std::array<float,2>{0.467481881f, 0.321074665f},
-std::array<float,2>{0.522106767f, 0.880257905f},
-std::array<float,2>{0.944836855f, 0.175725684f},
-std::array<float,2>{0.00262049539f, 0.6297912f},
-std::array<float,2>{0.242125571f, 0.0428153276f},
-std::array<float,2>{0.795569956f, 0.512248814f},
-std::array<float,2>{0.729909062f, 0.49947983f},
-std::array<float,2>{0.330034703f, 0.759022772f},
-std::array<float,2>{0.267897964f, 0.204257548f},
-std::array<float,2>{0.642071307f, 0.727596104f},
-std::array<float,2>{0.850150764f, 0.308249444f},
-std::array<float,2>{0.15534164f, 0.974624515f},
-std::array<float,2>{0.0789659694f, 0.419674873f},
-std::array<float,2>{0.902098f, 0.836909533f},
-std::array<float,2>{0.593640625f, 0.10712941f},
-std::array<float,2>{0.385814369f, 0.569169104f},
-std::array<float,2>{0.338897079f, 0.354332566f},
-std::array<float,2>{0.721209288f, 0.906866193f},
-std::array<float,2>{0.785653412f, 0.128548667f},
-std::array<float,2>{0.246855319f, 0.686059237f},
-std::array<float,2>{0.0107422927f, 0.0264490154f},
-std::array<float,2>{0.951562881f, 0.538677812f},
-std::array<float,2>{0.524467468f, 0.449962527f},
-std::array<float,2>{0.457776994f, 0.80813235f},
-std::array<float,2>{0.376186103f, 0.231174216f},
-std::array<float,2>{0.582602143f, 0.694925427f},
-std::array<float,2>{0.892724514f, 0.277395755f},
-std::array<float,2>{0.087065421f, 0.967245877f},
-std::array<float,2>{0.145783231f, 0.376197845f},
-std::array<float,2>{0.857118726f, 0.860359669f},
-std::array<float,2>{0.649636924f, 0.0646337271f},
-std::array<float,2>{0.280038655f, 0.610831141f},
-std::array<float,2>{0.473849952f, 0.485409826f},
-std::array<float,2>{0.537189305f, 0.750868261f},
-std::array<float,2>{0.994485497f, 0.037544664f},
-std::array<float,2>{0.0360093229f, 0.503992021f},
-std::array<float,2>{0.209994584f, 0.187408254f},
-std::array<float,2>{0.771218538f, 0.633822381f},
-std::array<float,2>{0.707563996f, 0.318779469f},
-std::array<float,2>{0.350737333f, 0.884387672f},
-std::array<float,2>{0.297336698f, 0.100353338f},
-std::array<float,2>{0.68092829f, 0.573817611f},
-std::array<float,2>{0.840192854f, 0.41039443f},
-std::array<float,2>{0.186060399f, 0.831911027f},
-std::array<float,2>{0.0986466557f, 0.299245566f},
-std::array<float,2>{0.929391623f, 0.978673816f},
-std::array<float,2>{0.594555438f, 0.218391538f},
-std::array<float,2>{0.435388893f, 0.725963533f},
-std::array<float,2>{0.257717639f, 0.429819822f},
-std::array<float,2>{0.632346213f, 0.813891768f},
-std::array<float,2>{0.861856759f, 0.115209825f},
-std::array<float,2>{0.140232593f, 0.593190968f},
-std::array<float,2>{0.0738244876f, 0.188840151f},
-std::array<float,2>{0.884435236f, 0.735060751f},
-std::array<float,2>{0.564974427f, 0.288338155f},
-std::array<float,2>{0.390639931f, 0.986038029f},
-std::array<float,2>{0.452132493f, 0.0551240593f},
-std::array<float,2>{0.513064861f, 0.517727613f},
-std::array<float,2>{0.967088282f, 0.474998057f},
-std::array<float,2>{0.0179124009f, 0.774802506f},
-std::array<float,2>{0.224202827f, 0.336931854f},
-std::array<float,2>{0.798316002f, 0.891541362f},
-std::array<float,2>{0.745022833f, 0.158547178f},
-std::array<float,2>{0.313793451f, 0.654289424f},
-std::array<float,2>{0.409020305f, 0.263708979f},
-std::array<float,2>{0.613382936f, 0.953049898f},
-std::array<float,2>{0.910327733f, 0.2409949f},
-std::array<float,2>{0.116257578f, 0.712084472f},
-std::array<float,2>{0.158386946f, 0.0872000605f},
-std::array<float,2>{0.817311943f, 0.602564275f},
-std::array<float,2>{0.665374041f, 0.401458472f},
-std::array<float,2>{0.295419514f, 0.850139141f},
-std::array<float,2>{0.365106195f, 0.142543167f},
-std::array<float,2>{0.689473867f, 0.666284263f},
-std::array<float,2>{0.764506102f, 0.359764457f},
-std::array<float,2>{0.195921913f, 0.926884413f},
-std::array<float,2>{0.0615072958f, 0.45593062f},
-std::array<float,2>{0.969756961f, 0.783925116f},
-std::array<float,2>{0.556171179f, 0.002769507f},
-std::array<float,2>{0.494583368f, 0.54704231f},
-std::array<float,2>{0.325928599f, 0.303821623f},
-std::array<float,2>{0.738252997f, 0.983345687f},
-std::array<float,2>{0.807235956f, 0.212695405f},
-std::array<float,2>{0.227435946f, 0.719427407f},
-std::array<float,2>{0.028368175f, 0.0945225805f},
-std::array<float,2>{0.957599759f, 0.575835049f},
-std::array<float,2>{0.506324887f, 0.407262415f},
-std::array<float,2>{0.442661941f, 0.832366645f},
-std::array<float,2>{0.401009589f, 0.182137668f},
-std::array<float,2>{0.571788669f, 0.639777005f},
-std::array<float,2>{0.875793874f, 0.312717885f},
-std::array<float,2>{0.0694013983f, 0.888586104f},
-std::array<float,2>{0.127262458f, 0.488496751f},
-std::array<float,2>{0.874657571f, 0.757309437f},
-std::array<float,2>{0.63659662f, 0.0323916525f},
-std::array<float,2>{0.265551835f, 0.500866711f},
-std::array<float,2>{0.484485835f, 0.379922062f},
-std::array<float,2>{0.548790455f, 0.867104352f},
-std::array<float,2>{0.98258543f, 0.0699094012f},
-std::array<float,2>{0.0508795381f, 0.614871264f},
-std::array<float,2>{0.187996f, 0.227602959f},
-std::array<float,2>{0.751882493f, 0.689471483f},
-std::array<float,2>{0.698628664f, 0.27575624f},
-std::array<float,2>{0.367784113f, 0.962902367f},
-std::array<float,2>{0.28894946f, 0.0288500711f},
-std::array<float,2>{0.664022267f, 0.534064293f},
-std::array<float,2>{0.826783359f, 0.446295977f},
-std::array<float,2>{0.167999625f, 0.809398532f},
-std::array<float,2>{0.122853927f, 0.359126568f},
-std::array<float,2>{0.915020704f, 0.914058685f},
-std::array<float,2>{0.621886015f, 0.130798131f},
-std::array<float,2>{0.415655077f, 0.681493998f},
-std::array<float,2>{0.27045083f, 0.460805535f},
-std::array<float,2>{0.644582927f, 0.785603702f},
-std::array<float,2>{0.84639287f, 0.00637492863f},
-std::array<float,2>{0.150328815f, 0.550808549f},
-std::array<float,2>{0.0821183249f, 0.145054698f},
-std::array<float,2>{0.903513312f, 0.670028865f},
-std::array<float,2>{0.589699149f, 0.363606393f},
-std::array<float,2>{0.388123482f, 0.923008323f},
-std::array<float,2>{0.463271618f, 0.0931465179f},
-std::array<float,2>{0.518364847f, 0.60588789f},
-std::array<float,2>{0.93772912f, 0.402623683f},
-std::array<float,2>{0.0072777709f, 0.845219374f},
-std::array<float,2>{0.236758068f, 0.261048645f},
-std::array<float,2>{0.789130628f, 0.94583559f},
-std::array<float,2>{0.734341741f, 0.237314612f},
-std::array<float,2>{0.333494693f, 0.717893004f},
-std::array<float,2>{0.425854027f, 0.342379153f},
-std::array<float,2>{0.603205264f, 0.894703627f},
-std::array<float,2>{0.929947972f, 0.162940621f},
-std::array<float,2>{0.108257718f, 0.648983061f},
-std::array<float,2>{0.177824438f, 0.059818238f},
-std::array<float,2>{0.833433568f, 0.520582676f},
-std::array<float,2>{0.674238443f, 0.468859285f},
-std::array<float,2>{0.312068164f, 0.77908659f},
-std::array<float,2>{0.353762329f, 0.192146599f},
-std::array<float,2>{0.716092467f, 0.740391314f},
-std::array<float,2>{0.778977871f, 0.282649368f},
-std::array<float,2>{0.217601627f, 0.99109292f},
-std::array<float,2>{0.0454490073f, 0.436925113f},
-std::array<float,2>{0.989743829f, 0.816851079f},
-std::array<float,2>{0.543310285f, 0.111545086f},
-std::array<float,2>{0.48421824f, 0.588629007f},
-std::array<float,2>{0.300925761f, 0.369271874f},
-std::array<float,2>{0.685673892f, 0.935480475f},
-std::array<float,2>{0.838193536f, 0.151269317f},
-std::array<float,2>{0.182018712f, 0.658227265f},
-std::array<float,2>{0.0955968946f, 0.0133556752f},
-std::array<float,2>{0.922019124f, 0.558030784f},
-std::array<float,2>{0.598762035f, 0.461958706f},
-std::array<float,2>{0.431121737f, 0.791116536f},
-std::array<float,2>{0.472039044f, 0.248306677f},
-std::array<float,2>{0.532173693f, 0.707809389f},
-std::array<float,2>{0.998253763f, 0.255415499f},
-std::array<float,2>{0.0350273214f, 0.945181012f},
-std::array<float,2>{0.205044106f, 0.39470917f},
-std::array<float,2>{0.768826306f, 0.858792007f},
-std::array<float,2>{0.706882954f, 0.0821297914f},
-std::array<float,2>{0.347127974f, 0.594317794f},
-std::array<float,2>{0.379707277f, 0.47704792f},
-std::array<float,2>{0.579903543f, 0.766624153f},
-std::array<float,2>{0.897154391f, 0.0490584858f},
-std::array<float,2>{0.0917473063f, 0.523935854f},
-std::array<float,2>{0.143841386f, 0.164515212f},
-std::array<float,2>{0.852732241f, 0.642577052f},
-std::array<float,2>{0.652787864f, 0.33213535f},
-std::array<float,2>{0.2753627f, 0.904800594f},
-std::array<float,2>{0.340211958f, 0.117539003f},
-std::array<float,2>{0.725784361f, 0.578892112f},
-std::array<float,2>{0.78206706f, 0.424615204f},
-std::array<float,2>{0.244137645f, 0.820634305f},
-std::array<float,2>{0.0153011167f, 0.291834682f},
-std::array<float,2>{0.948269248f, 0.995056212f},
-std::array<float,2>{0.527488947f, 0.198373601f},
-std::array<float,2>{0.455813587f, 0.748877943f},
-std::array<float,2>{0.36154902f, 0.416901857f},
-std::array<float,2>{0.694841683f, 0.842132926f},
-std::array<float,2>{0.76069057f, 0.103279494f},
-std::array<float,2>{0.20061861f, 0.563794911f},
-std::array<float,2>{0.0582029223f, 0.209456414f},
-std::array<float,2>{0.975845933f, 0.734361291f},
-std::array<float,2>{0.558754027f, 0.308817446f},
-std::array<float,2>{0.499453336f, 0.970885396f},
-std::array<float,2>{0.411566585f, 0.0444607995f},
-std::array<float,2>{0.61122179f, 0.508486986f},
-std::array<float,2>{0.910022199f, 0.493619174f},
-std::array<float,2>{0.110413343f, 0.764628589f},
-std::array<float,2>{0.162995592f, 0.326988816f},
-std::array<float,2>{0.814895332f, 0.875481486f},
-std::array<float,2>{0.67013371f, 0.176358938f},
-std::array<float,2>{0.291180849f, 0.625972867f},
-std::array<float,2>{0.446789175f, 0.267244011f},
-std::array<float,2>{0.508576691f, 0.954019189f},
-std::array<float,2>{0.962929249f, 0.222768292f},
-std::array<float,2>{0.0199588854f, 0.697523057f},
-std::array<float,2>{0.220893577f, 0.076989159f},
-std::array<float,2>{0.801121056f, 0.624039888f},
-std::array<float,2>{0.747903764f, 0.389755756f},
-std::array<float,2>{0.317552984f, 0.8677935f},
-std::array<float,2>{0.251518637f, 0.1352842f},
-std::array<float,2>{0.628179371f, 0.672473133f},
-std::array<float,2>{0.863938928f, 0.346437097f},
-std::array<float,2>{0.135874346f, 0.917656541f},
-std::array<float,2>{0.0752372146f, 0.439628273f},
-std::array<float,2>{0.890276074f, 0.800286412f},
-std::array<float,2>{0.567595243f, 0.0161732174f},
-std::array<float,2>{0.398260027f, 0.540498674f},
-std::array<float,2>{0.259193331f, 0.251340926f},
-std::array<float,2>{0.639043331f, 0.939883828f},
-std::array<float,2>{0.87070787f, 0.244674951f},
-std::array<float,2>{0.13024722f, 0.703914165f},
-std::array<float,2>{0.0659672841f, 0.0807885081f},
-std::array<float,2>{0.881031215f, 0.600350738f},
-std::array<float,2>{0.574807346f, 0.39245531f},
-std::array<float,2>{0.40603292f, 0.854230642f},
-std::array<float,2>{0.437754273f, 0.155403942f},
-std::array<float,2>{0.502277613f, 0.662754297f},
-std::array<float,2>{0.954236627f, 0.373274684f},
-std::array<float,2>{0.0272903666f, 0.932246268f},
-std::array<float,2>{0.233577594f, 0.465482295f},
-std::array<float,2>{0.811770797f, 0.795032978f},
-std::array<float,2>{0.740838051f, 0.00884997658f},
-std::array<float,2>{0.322975248f, 0.559322953f},
-std::array<float,2>{0.421198606f, 0.425916374f},
-std::array<float,2>{0.618537188f, 0.826712966f},
-std::array<float,2>{0.919323504f, 0.121427327f},
-std::array<float,2>{0.118786305f, 0.585810661f},
-std::array<float,2>{0.165118888f, 0.202452764f},
-std::array<float,2>{0.82188195f, 0.745064139f},
-std::array<float,2>{0.658236206f, 0.295454711f},
-std::array<float,2>{0.282662839f, 0.997517586f},
-std::array<float,2>{0.372720629f, 0.0525769107f},
-std::array<float,2>{0.701997817f, 0.530370593f},
-std::array<float,2>{0.756486058f, 0.483237743f},
-std::array<float,2>{0.19212167f, 0.769557297f},
-std::array<float,2>{0.0501711816f, 0.331379771f},
-std::array<float,2>{0.977142036f, 0.90036869f},
-std::array<float,2>{0.551695585f, 0.170558587f},
-std::array<float,2>{0.490014821f, 0.646030009f},
-std::array<float,2>{0.33054772f, 0.497759134f},
-std::array<float,2>{0.726680756f, 0.761395395f},
-std::array<float,2>{0.793408036f, 0.0396323949f},
-std::array<float,2>{0.238829985f, 0.514135122f},
-std::array<float,2>{0.00144710275f, 0.171988279f},
-std::array<float,2>{0.942158163f, 0.631731451f},
-std::array<float,2>{0.51977396f, 0.323257834f},
-std::array<float,2>{0.465930492f, 0.881574392f},
-std::array<float,2>{0.38320002f, 0.109059058f},
-std::array<float,2>{0.591397226f, 0.566498995f},
-std::array<float,2>{0.900237679f, 0.421837538f},
-std::array<float,2>{0.0817972943f, 0.838657677f},
-std::array<float,2>{0.15387319f, 0.305626601f},
-std::array<float,2>{0.84778136f, 0.974413812f},
-std::array<float,2>{0.643303156f, 0.206253812f},
-std::array<float,2>{0.26592955f, 0.729075015f},
-std::array<float,2>{0.478768826f, 0.34793815f},
-std::array<float,2>{0.54027313f, 0.919691741f},
-std::array<float,2>{0.984724641f, 0.140358418f},
-std::array<float,2>{0.0405095518f, 0.679253876f},
-std::array<float,2>{0.213722408f, 0.0227011722f},
-std::array<float,2>{0.77423805f, 0.543449819f},
-std::array<float,2>{0.713632405f, 0.44285202f},
-std::array<float,2>{0.357364714f, 0.803763688f},
-std::array<float,2>{0.305952907f, 0.221385807f},
-std::array<float,2>{0.676916778f, 0.702725172f},
-std::array<float,2>{0.829376161f, 0.270394295f},
-std::array<float,2>{0.17513819f, 0.95961988f},
-std::array<float,2>{0.101720862f, 0.386331946f},
-std::array<float,2>{0.935278893f, 0.874913096f},
-std::array<float,2>{0.606855333f, 0.0721427798f},
-std::array<float,2>{0.423674166f, 0.620328724f},
-std::array<float,2>{0.348121464f, 0.317928076f},
-std::array<float,2>{0.708992124f, 0.884845793f},
-std::array<float,2>{0.773286283f, 0.184233531f},
-std::array<float,2>{0.208842501f, 0.635158181f},
-std::array<float,2>{0.0377952866f, 0.035760209f},
-std::array<float,2>{0.994138181f, 0.507721961f},
-std::array<float,2>{0.535493314f, 0.488095284f},
-std::array<float,2>{0.475822568f, 0.753237665f},
-std::array<float,2>{0.437020808f, 0.215966225f},
-std::array<float,2>{0.596129894f, 0.724572301f},
-std::array<float,2>{0.926848352f, 0.297557831f},
-std::array<float,2>{0.101359084f, 0.977640331f},
-std::array<float,2>{0.184127226f, 0.412689477f},
-std::array<float,2>{0.842320204f, 0.828493118f},
-std::array<float,2>{0.683396578f, 0.0985478759f},
-std::array<float,2>{0.29916808f, 0.570566297f},
-std::array<float,2>{0.460309029f, 0.452195406f},
-std::array<float,2>{0.526450992f, 0.8048895f},
-std::array<float,2>{0.950787902f, 0.0239857864f},
-std::array<float,2>{0.00968016777f, 0.535712183f},
-std::array<float,2>{0.249631792f, 0.125507593f},
-std::array<float,2>{0.78800863f, 0.683828533f},
-std::array<float,2>{0.720478058f, 0.353065938f},
-std::array<float,2>{0.336926401f, 0.909048319f},
-std::array<float,2>{0.277811229f, 0.0640423149f},
-std::array<float,2>{0.65224278f, 0.611333311f},
-std::array<float,2>{0.858715594f, 0.378330827f},
-std::array<float,2>{0.146781787f, 0.861966848f},
-std::array<float,2>{0.089823477f, 0.27958405f},
-std::array<float,2>{0.892006993f, 0.966417253f},
-std::array<float,2>{0.584497631f, 0.233231932f},
-std::array<float,2>{0.377698451f, 0.692694724f},
-std::array<float,2>{0.294638515f, 0.399657786f},
-std::array<float,2>{0.667102396f, 0.849606156f},
-std::array<float,2>{0.81929177f, 0.0885772705f},
-std::array<float,2>{0.158063129f, 0.605176091f},
-std::array<float,2>{0.114041477f, 0.23951526f},
-std::array<float,2>{0.913000822f, 0.714566886f},
-std::array<float,2>{0.615948021f, 0.263009161f},
-std::array<float,2>{0.406507403f, 0.949353874f},
-std::array<float,2>{0.493826389f, 0.000326576701f},
-std::array<float,2>{0.557051241f, 0.549856007f},
-std::array<float,2>{0.972380936f, 0.454384923f},
-std::array<float,2>{0.0588380881f, 0.781951725f},
-std::array<float,2>{0.198162258f, 0.361456931f},
-std::array<float,2>{0.763286054f, 0.92942977f},
-std::array<float,2>{0.688459039f, 0.144167289f},
-std::array<float,2>{0.366480887f, 0.66495949f},
-std::array<float,2>{0.393264949f, 0.286114693f},
-std::array<float,2>{0.563458681f, 0.98763144f},
-std::array<float,2>{0.8856529f, 0.190803736f},
-std::array<float,2>{0.0711623803f, 0.737946928f},
-std::array<float,2>{0.13866356f, 0.116525598f},
-std::array<float,2>{0.859454751f, 0.591586649f},
-std::array<float,2>{0.630523145f, 0.432337761f},
-std::array<float,2>{0.254533589f, 0.816379309f},
-std::array<float,2>{0.315740615f, 0.157798007f},
-std::array<float,2>{0.743122935f, 0.655576468f},
-std::array<float,2>{0.800287843f, 0.339227587f},
-std::array<float,2>{0.225713104f, 0.893064559f},
-std::array<float,2>{0.0167516842f, 0.472813308f},
-std::array<float,2>{0.965884864f, 0.776403129f},
-std::array<float,2>{0.515306532f, 0.0571979433f},
-std::array<float,2>{0.449980587f, 0.517162502f},
-std::array<float,2>{0.360163093f, 0.309311599f},
-std::array<float,2>{0.691470742f, 0.971263945f},
-std::array<float,2>{0.759460747f, 0.209958076f},
-std::array<float,2>{0.202006415f, 0.733694196f},
-std::array<float,2>{0.0552360192f, 0.102873884f},
-std::array<float,2>{0.974177301f, 0.564020991f},
-std::array<float,2>{0.562430084f, 0.416020513f},
-std::array<float,2>{0.496949613f, 0.842426956f},
-std::array<float,2>{0.412624985f, 0.175986677f},
-std::array<float,2>{0.612441957f, 0.625445426f},
-std::array<float,2>{0.907670021f, 0.326412827f},
-std::array<float,2>{0.111469127f, 0.875622213f},
-std::array<float,2>{0.160470426f, 0.494060516f},
-std::array<float,2>{0.814243019f, 0.763988435f},
-std::array<float,2>{0.668621242f, 0.0443825573f},
-std::array<float,2>{0.290616274f, 0.508104622f},
-std::array<float,2>{0.449151218f, 0.39024958f},
-std::array<float,2>{0.510228157f, 0.86732614f},
-std::array<float,2>{0.962032735f, 0.0764711052f},
-std::array<float,2>{0.0228935368f, 0.624798715f},
-std::array<float,2>{0.219597638f, 0.223242953f},
-std::array<float,2>{0.804063439f, 0.698237896f},
-std::array<float,2>{0.74961406f, 0.266953826f},
-std::array<float,2>{0.319105387f, 0.953498363f},
-std::array<float,2>{0.252993762f, 0.0156788174f},
-std::array<float,2>{0.625818312f, 0.540586412f},
-std::array<float,2>{0.866376579f, 0.440226674f},
-std::array<float,2>{0.133213863f, 0.800593615f},
-std::array<float,2>{0.0781141222f, 0.345877081f},
-std::array<float,2>{0.887240767f, 0.917150497f},
-std::array<float,2>{0.569624245f, 0.135124877f},
-std::array<float,2>{0.394974381f, 0.672015727f},
-std::array<float,2>{0.302943796f, 0.462708086f},
-std::array<float,2>{0.685080528f, 0.791948497f},
-std::array<float,2>{0.836988568f, 0.0126991859f},
-std::array<float,2>{0.181215122f, 0.558530569f},
-std::array<float,2>{0.0964354575f, 0.150535896f},
-std::array<float,2>{0.924425006f, 0.659004569f},
-std::array<float,2>{0.601441205f, 0.36995098f},
-std::array<float,2>{0.432793498f, 0.93485862f},
-std::array<float,2>{0.469112456f, 0.0829968229f},
-std::array<float,2>{0.534668744f, 0.593963444f},
-std::array<float,2>{0.997270346f, 0.39508602f},
-std::array<float,2>{0.0315122455f, 0.858902812f},
-std::array<float,2>{0.206528082f, 0.255284607f},
-std::array<float,2>{0.766014814f, 0.944746017f},
-std::array<float,2>{0.703931808f, 0.248706102f},
-std::array<float,2>{0.343756407f, 0.707209349f},
-std::array<float,2>{0.382445335f, 0.332858324f},
-std::array<float,2>{0.580573201f, 0.904473424f},
-std::array<float,2>{0.895540595f, 0.164625943f},
-std::array<float,2>{0.0921664983f, 0.641951442f},
-std::array<float,2>{0.14076972f, 0.049429331f},
-std::array<float,2>{0.855124831f, 0.523523748f},
-std::array<float,2>{0.65498662f, 0.477338225f},
-std::array<float,2>{0.275636226f, 0.767350793f},
-std::array<float,2>{0.343451649f, 0.199081615f},
-std::array<float,2>{0.723049641f, 0.748526812f},
-std::array<float,2>{0.784307957f, 0.291217208f},
-std::array<float,2>{0.245841578f, 0.994490623f},
-std::array<float,2>{0.0119012445f, 0.424126238f},
-std::array<float,2>{0.94663471f, 0.820897758f},
-std::array<float,2>{0.530032814f, 0.118149228f},
-std::array<float,2>{0.454154074f, 0.57838589f},
-std::array<float,2>{0.272373945f, 0.364066035f},
-std::array<float,2>{0.647920072f, 0.923669338f},
-std::array<float,2>{0.844367206f, 0.144726872f},
-std::array<float,2>{0.150473431f, 0.670530319f},
-std::array<float,2>{0.0853969082f, 0.00631276239f},
-std::array<float,2>{0.906121016f, 0.551407039f},
-std::array<float,2>{0.587553024f, 0.460041493f},
-std::array<float,2>{0.390075982f, 0.785823166f},
-std::array<float,2>{0.462201923f, 0.238207459f},
-std::array<float,2>{0.51573509f, 0.718644619f},
-std::array<float,2>{0.940382063f, 0.261619568f},
-std::array<float,2>{0.00507747754f, 0.945425212f},
-std::array<float,2>{0.235862583f, 0.403193772f},
-std::array<float,2>{0.792124569f, 0.84483403f},
-std::array<float,2>{0.732102454f, 0.0932799131f},
-std::array<float,2>{0.334552079f, 0.606087744f},
-std::array<float,2>{0.42810753f, 0.469354242f},
-std::array<float,2>{0.603554666f, 0.778687239f},
-std::array<float,2>{0.933028877f, 0.0602208674f},
-std::array<float,2>{0.105979919f, 0.52134198f},
-std::array<float,2>{0.177623257f, 0.162425801f},
-std::array<float,2>{0.834056139f, 0.648474932f},
-std::array<float,2>{0.672116876f, 0.342095196f},
-std::array<float,2>{0.309253663f, 0.895467937f},
-std::array<float,2>{0.35175693f, 0.111900769f},
-std::array<float,2>{0.717613637f, 0.588199496f},
-std::array<float,2>{0.779872656f, 0.437195003f},
-std::array<float,2>{0.215575576f, 0.817292333f},
-std::array<float,2>{0.043285504f, 0.282910943f},
-std::array<float,2>{0.990756035f, 0.99042505f},
-std::array<float,2>{0.546342731f, 0.19182089f},
-std::array<float,2>{0.482370704f, 0.740975857f},
-std::array<float,2>{0.32667014f, 0.40818882f},
-std::array<float,2>{0.73511982f, 0.832881093f},
-std::array<float,2>{0.804974556f, 0.093939878f},
-std::array<float,2>{0.228568122f, 0.575302362f},
-std::array<float,2>{0.0309134964f, 0.212119758f},
-std::array<float,2>{0.959888458f, 0.719130456f},
-std::array<float,2>{0.50515151f, 0.304495752f},
-std::array<float,2>{0.444297314f, 0.982556343f},
-std::array<float,2>{0.400223881f, 0.0331591479f},
-std::array<float,2>{0.574022412f, 0.50000459f},
-std::array<float,2>{0.877714992f, 0.489197969f},
-std::array<float,2>{0.0674581379f, 0.757534206f},
-std::array<float,2>{0.126842827f, 0.313084245f},
-std::array<float,2>{0.872093439f, 0.887884736f},
-std::array<float,2>{0.633267939f, 0.182068259f},
-std::array<float,2>{0.262060791f, 0.640556693f},
-std::array<float,2>{0.486692309f, 0.276226968f},
-std::array<float,2>{0.550128639f, 0.963699281f},
-std::array<float,2>{0.981280744f, 0.228216991f},
-std::array<float,2>{0.0533282571f, 0.690003812f},
-std::array<float,2>{0.190777123f, 0.0694057345f},
-std::array<float,2>{0.75198102f, 0.614614069f},
-std::array<float,2>{0.696584582f, 0.380691558f},
-std::array<float,2>{0.369841754f, 0.866652846f},
-std::array<float,2>{0.285416573f, 0.129887089f},
-std::array<float,2>{0.661354244f, 0.680905104f},
-std::array<float,2>{0.825386167f, 0.3587403f},
-std::array<float,2>{0.171153858f, 0.913282633f},
-std::array<float,2>{0.123876095f, 0.44693917f},
-std::array<float,2>{0.916041076f, 0.808855772f},
-std::array<float,2>{0.623552024f, 0.0287474412f},
-std::array<float,2>{0.417532265f, 0.533443987f},
-std::array<float,2>{0.295212269f, 0.263395935f},
-std::array<float,2>{0.666012824f, 0.949715734f},
-std::array<float,2>{0.81674999f, 0.240046173f},
-std::array<float,2>{0.158946723f, 0.714134216f},
-std::array<float,2>{0.117069542f, 0.0879503042f},
-std::array<float,2>{0.910687506f, 0.604819477f},
-std::array<float,2>{0.614082336f, 0.400388032f},
-std::array<float,2>{0.408540756f, 0.849030316f},
-std::array<float,2>{0.494839221f, 0.143789276f},
-std::array<float,2>{0.556015015f, 0.664490223f},
-std::array<float,2>{0.970386624f, 0.361982137f},
-std::array<float,2>{0.0607383549f, 0.928921282f},
-std::array<float,2>{0.195334047f, 0.454808861f},
-std::array<float,2>{0.764104187f, 0.781729281f},
-std::array<float,2>{0.69001174f, 0.000662280945f},
-std::array<float,2>{0.364520282f, 0.550734043f},
-std::array<float,2>{0.391480982f, 0.431767136f},
-std::array<float,2>{0.564818084f, 0.815829277f},
-std::array<float,2>{0.883945823f, 0.117079705f},
-std::array<float,2>{0.073689349f, 0.591178298f},
-std::array<float,2>{0.139700562f, 0.191220269f},
-std::array<float,2>{0.86177367f, 0.737334907f},
-std::array<float,2>{0.632246077f, 0.285351664f},
-std::array<float,2>{0.257266372f, 0.988151133f},
-std::array<float,2>{0.314424545f, 0.056813553f},
-std::array<float,2>{0.744350731f, 0.517041385f},
-std::array<float,2>{0.798802853f, 0.473206758f},
-std::array<float,2>{0.224088684f, 0.77698499f},
-std::array<float,2>{0.0184809566f, 0.339369684f},
-std::array<float,2>{0.967474043f, 0.893215477f},
-std::array<float,2>{0.51360178f, 0.157712013f},
-std::array<float,2>{0.451266766f, 0.656136215f},
-std::array<float,2>{0.351541162f, 0.487521887f},
-std::array<float,2>{0.707172513f, 0.753523171f},
-std::array<float,2>{0.770711362f, 0.0352825373f},
-std::array<float,2>{0.210842878f, 0.507165432f},
-std::array<float,2>{0.0354404189f, 0.183743253f},
-std::array<float,2>{0.994965613f, 0.635434151f},
-std::array<float,2>{0.537787676f, 0.317818731f},
-std::array<float,2>{0.474473059f, 0.885340989f},
-std::array<float,2>{0.434914112f, 0.0976641327f},
-std::array<float,2>{0.594126403f, 0.57115531f},
-std::array<float,2>{0.9290151f, 0.41238752f},
-std::array<float,2>{0.0993346125f, 0.829006851f},
-std::array<float,2>{0.185960814f, 0.296990871f},
-std::array<float,2>{0.840709507f, 0.978185952f},
-std::array<float,2>{0.68149519f, 0.216386586f},
-std::array<float,2>{0.297710896f, 0.723789334f},
-std::array<float,2>{0.457083881f, 0.35283792f},
-std::array<float,2>{0.525176585f, 0.908453703f},
-std::array<float,2>{0.951954126f, 0.125220343f},
-std::array<float,2>{0.0115969405f, 0.684512258f},
-std::array<float,2>{0.246442035f, 0.0234543309f},
-std::array<float,2>{0.785614431f, 0.535235763f},
-std::array<float,2>{0.721073925f, 0.452726185f},
-std::array<float,2>{0.339767575f, 0.805233479f},
-std::array<float,2>{0.279401839f, 0.232585415f},
-std::array<float,2>{0.650138915f, 0.693060517f},
-std::array<float,2>{0.856656253f, 0.27990371f},
-std::array<float,2>{0.146472901f, 0.966211677f},
-std::array<float,2>{0.0874550268f, 0.37863338f},
-std::array<float,2>{0.893303812f, 0.861710906f},
-std::array<float,2>{0.582197726f, 0.0635833815f},
-std::array<float,2>{0.376641691f, 0.611878812f},
-std::array<float,2>{0.329589307f, 0.32412374f},
-std::array<float,2>{0.730086505f, 0.88111037f},
-std::array<float,2>{0.794947028f, 0.172479406f},
-std::array<float,2>{0.241396412f, 0.631231487f},
-std::array<float,2>{0.00239194534f, 0.0392869785f},
-std::array<float,2>{0.94481957f, 0.51450479f},
-std::array<float,2>{0.521642089f, 0.497315139f},
-std::array<float,2>{0.467244565f, 0.761115789f},
-std::array<float,2>{0.386381269f, 0.206688643f},
-std::array<float,2>{0.592973351f, 0.728675187f},
-std::array<float,2>{0.90145582f, 0.304995984f},
-std::array<float,2>{0.0783935338f, 0.9740659f},
-std::array<float,2>{0.156099379f, 0.42090264f},
-std::array<float,2>{0.849766195f, 0.838143766f},
-std::array<float,2>{0.642455459f, 0.108505666f},
-std::array<float,2>{0.268403709f, 0.567075074f},
-std::array<float,2>{0.476792902f, 0.443036497f},
-std::array<float,2>{0.541181445f, 0.804639459f},
-std::array<float,2>{0.987003922f, 0.0233392771f},
-std::array<float,2>{0.0414552093f, 0.54355967f},
-std::array<float,2>{0.210945085f, 0.140049517f},
-std::array<float,2>{0.776687622f, 0.679034531f},
-std::array<float,2>{0.711435914f, 0.348248154f},
-std::array<float,2>{0.357454687f, 0.919329345f},
-std::array<float,2>{0.308271706f, 0.0716912895f},
-std::array<float,2>{0.679112732f, 0.62092042f},
-std::array<float,2>{0.8301754f, 0.385851979f},
-std::array<float,2>{0.173065111f, 0.874504745f},
-std::array<float,2>{0.104843073f, 0.269843251f},
-std::array<float,2>{0.935780585f, 0.959288776f},
-std::array<float,2>{0.607991338f, 0.220976353f},
-std::array<float,2>{0.425419033f, 0.702182591f},
-std::array<float,2>{0.26025334f, 0.391770363f},
-std::array<float,2>{0.636758387f, 0.853830397f},
-std::array<float,2>{0.868076801f, 0.0803228766f},
-std::array<float,2>{0.131577149f, 0.599926054f},
-std::array<float,2>{0.0632662103f, 0.244432703f},
-std::array<float,2>{0.880331874f, 0.703289568f},
-std::array<float,2>{0.577361465f, 0.251628369f},
-std::array<float,2>{0.403974503f, 0.940234482f},
-std::array<float,2>{0.440919071f, 0.00947309751f},
-std::array<float,2>{0.501910925f, 0.558666706f},
-std::array<float,2>{0.956738055f, 0.465038151f},
-std::array<float,2>{0.0238261148f, 0.795897841f},
-std::array<float,2>{0.232247576f, 0.373605877f},
-std::array<float,2>{0.808776736f, 0.931729376f},
-std::array<float,2>{0.739390016f, 0.155810773f},
-std::array<float,2>{0.321554929f, 0.662503958f},
-std::array<float,2>{0.419773459f, 0.295371622f},
-std::array<float,2>{0.620284796f, 0.997921407f},
-std::array<float,2>{0.920728564f, 0.203070208f},
-std::array<float,2>{0.121073425f, 0.744397759f},
-std::array<float,2>{0.167478934f, 0.122049585f},
-std::array<float,2>{0.823817134f, 0.58513552f},
-std::array<float,2>{0.657334864f, 0.426294744f},
-std::array<float,2>{0.283523589f, 0.82640022f},
-std::array<float,2>{0.374368697f, 0.170116052f},
-std::array<float,2>{0.700325608f, 0.645554364f},
-std::array<float,2>{0.75500679f, 0.332011878f},
-std::array<float,2>{0.193540722f, 0.899881721f},
-std::array<float,2>{0.0484682582f, 0.482744128f},
-std::array<float,2>{0.980313241f, 0.770447433f},
-std::array<float,2>{0.554607153f, 0.0520509779f},
-std::array<float,2>{0.490442425f, 0.530789912f},
-std::array<float,2>{0.318107486f, 0.269013256f},
-std::array<float,2>{0.74715811f, 0.956756353f},
-std::array<float,2>{0.801690638f, 0.225973144f},
-std::array<float,2>{0.221645579f, 0.696178496f},
-std::array<float,2>{0.0204791911f, 0.0751057267f},
-std::array<float,2>{0.963606715f, 0.622764111f},
-std::array<float,2>{0.508001268f, 0.388011694f},
-std::array<float,2>{0.446404904f, 0.869204342f},
-std::array<float,2>{0.397926331f, 0.132883012f},
-std::array<float,2>{0.568074107f, 0.674232423f},
-std::array<float,2>{0.89002347f, 0.345635951f},
-std::array<float,2>{0.0756951049f, 0.915152609f},
-std::array<float,2>{0.136439472f, 0.438209653f},
-std::array<float,2>{0.863447428f, 0.797999799f},
-std::array<float,2>{0.628783345f, 0.0190304071f},
-std::array<float,2>{0.251202613f, 0.541164219f},
-std::array<float,2>{0.499999136f, 0.414471596f},
-std::array<float,2>{0.559194446f, 0.84109056f},
-std::array<float,2>{0.976180375f, 0.103860587f},
-std::array<float,2>{0.0576292723f, 0.565830886f},
-std::array<float,2>{0.201025605f, 0.20746237f},
-std::array<float,2>{0.760079741f, 0.731694639f},
-std::array<float,2>{0.694726467f, 0.311811596f},
-std::array<float,2>{0.362095386f, 0.969887018f},
-std::array<float,2>{0.291775942f, 0.0451208018f},
-std::array<float,2>{0.67079246f, 0.510307133f},
-std::array<float,2>{0.815326691f, 0.495107055f},
-std::array<float,2>{0.162475169f, 0.762824893f},
-std::array<float,2>{0.111036837f, 0.325930089f},
-std::array<float,2>{0.909589171f, 0.877373517f},
-std::array<float,2>{0.610802054f, 0.179588675f},
-std::array<float,2>{0.412093371f, 0.627902865f},
-std::array<float,2>{0.274547756f, 0.478802025f},
-std::array<float,2>{0.652899683f, 0.76936841f},
-std::array<float,2>{0.853283823f, 0.0469689444f},
-std::array<float,2>{0.144139618f, 0.526827991f},
-std::array<float,2>{0.0911455378f, 0.166704029f},
-std::array<float,2>{0.896538794f, 0.643587172f},
-std::array<float,2>{0.579268217f, 0.334788233f},
-std::array<float,2>{0.378955722f, 0.904215217f},
-std::array<float,2>{0.455257595f, 0.121023528f},
-std::array<float,2>{0.527975798f, 0.58171767f},
-std::array<float,2>{0.948863685f, 0.422385782f},
-std::array<float,2>{0.0150952442f, 0.823668718f},
-std::array<float,2>{0.243465215f, 0.290641695f},
-std::array<float,2>{0.781414628f, 0.993355095f},
-std::array<float,2>{0.726125062f, 0.196645573f},
-std::array<float,2>{0.340581596f, 0.746848941f},
-std::array<float,2>{0.431169003f, 0.367424697f},
-std::array<float,2>{0.59928602f, 0.93723774f},
-std::array<float,2>{0.922423124f, 0.148860112f},
-std::array<float,2>{0.0947552472f, 0.658135355f},
-std::array<float,2>{0.182365537f, 0.0140508097f},
-std::array<float,2>{0.83847183f, 0.555391788f},
-std::array<float,2>{0.686035812f, 0.464023441f},
-std::array<float,2>{0.301612705f, 0.789759696f},
-std::array<float,2>{0.347265214f, 0.246109679f},
-std::array<float,2>{0.706316054f, 0.710611105f},
-std::array<float,2>{0.769056678f, 0.257579535f},
-std::array<float,2>{0.204373702f, 0.941681743f},
-std::array<float,2>{0.0345512219f, 0.397621065f},
-std::array<float,2>{0.998780966f, 0.85705626f},
-std::array<float,2>{0.531397998f, 0.0849694759f},
-std::array<float,2>{0.472201318f, 0.597622335f},
-std::array<float,2>{0.311737716f, 0.340287089f},
-std::array<float,2>{0.674591959f, 0.898144901f},
-std::array<float,2>{0.833819866f, 0.160431951f},
-std::array<float,2>{0.178636149f, 0.652018666f},
-std::array<float,2>{0.107778899f, 0.0609290302f},
-std::array<float,2>{0.930244982f, 0.522375047f},
-std::array<float,2>{0.602863729f, 0.472406238f},
-std::array<float,2>{0.426685899f, 0.779472172f},
-std::array<float,2>{0.483805567f, 0.194535345f},
-std::array<float,2>{0.543463767f, 0.739450574f},
-std::array<float,2>{0.989760399f, 0.285133779f},
-std::array<float,2>{0.0452387966f, 0.98865205f},
-std::array<float,2>{0.217052296f, 0.434237123f},
-std::array<float,2>{0.778605223f, 0.818513036f},
-std::array<float,2>{0.716589868f, 0.109850973f},
-std::array<float,2>{0.354403228f, 0.587815881f},
-std::array<float,2>{0.388510168f, 0.457312703f},
-std::array<float,2>{0.589306593f, 0.787313342f},
-std::array<float,2>{0.903938949f, 0.00429552561f},
-std::array<float,2>{0.0826367736f, 0.553794265f},
-std::array<float,2>{0.149774432f, 0.147757322f},
-std::array<float,2>{0.845866442f, 0.667999506f},
-std::array<float,2>{0.645092607f, 0.366645426f},
-std::array<float,2>{0.269531488f, 0.925077379f},
-std::array<float,2>{0.333933622f, 0.0911545902f},
-std::array<float,2>{0.733666301f, 0.609323859f},
-std::array<float,2>{0.789676785f, 0.405031264f},
-std::array<float,2>{0.237141863f, 0.846481562f},
-std::array<float,2>{0.00747258496f, 0.25899598f},
-std::array<float,2>{0.938383877f, 0.948564112f},
-std::array<float,2>{0.517631292f, 0.236181408f},
-std::array<float,2>{0.463530719f, 0.71521771f},
-std::array<float,2>{0.367329866f, 0.381529033f},
-std::array<float,2>{0.698753297f, 0.865054011f},
-std::array<float,2>{0.751016259f, 0.0677014291f},
-std::array<float,2>{0.187652349f, 0.616563737f},
-std::array<float,2>{0.051410716f, 0.22852397f},
-std::array<float,2>{0.98323673f, 0.687684953f},
-std::array<float,2>{0.548046589f, 0.275274634f},
-std::array<float,2>{0.485118657f, 0.962834954f},
-std::array<float,2>{0.415463179f, 0.0295268614f},
-std::array<float,2>{0.621165514f, 0.532803833f},
-std::array<float,2>{0.914537668f, 0.447424144f},
-std::array<float,2>{0.122345574f, 0.811172605f},
-std::array<float,2>{0.168744296f, 0.355506331f},
-std::array<float,2>{0.826623917f, 0.911002457f},
-std::array<float,2>{0.663293839f, 0.132692873f},
-std::array<float,2>{0.288119823f, 0.682522178f},
-std::array<float,2>{0.442992777f, 0.30111298f},
-std::array<float,2>{0.506395876f, 0.980687082f},
-std::array<float,2>{0.957148314f, 0.214728877f},
-std::array<float,2>{0.0289555825f, 0.721366107f},
-std::array<float,2>{0.226929232f, 0.095920898f},
-std::array<float,2>{0.806690991f, 0.576694012f},
-std::array<float,2>{0.73759824f, 0.408219934f},
-std::array<float,2>{0.32544291f, 0.835707009f},
-std::array<float,2>{0.264688164f, 0.18118377f},
-std::array<float,2>{0.635806262f, 0.637178183f},
-std::array<float,2>{0.874235332f, 0.314878374f},
-std::array<float,2>{0.127719581f, 0.889380813f},
-std::array<float,2>{0.0700498968f, 0.491184652f},
-std::array<float,2>{0.875092685f, 0.755137086f},
-std::array<float,2>{0.571603119f, 0.0344194695f},
-std::array<float,2>{0.400662184f, 0.502353013f},
-std::array<float,2>{0.253973216f, 0.288776249f},
-std::array<float,2>{0.630224228f, 0.985392153f},
-std::array<float,2>{0.86014384f, 0.189105406f},
-std::array<float,2>{0.137877002f, 0.734681666f},
-std::array<float,2>{0.070440881f, 0.114471078f},
-std::array<float,2>{0.884945929f, 0.593295634f},
-std::array<float,2>{0.562538743f, 0.430499434f},
-std::array<float,2>{0.392684489f, 0.814365208f},
-std::array<float,2>{0.449460864f, 0.159155235f},
-std::array<float,2>{0.514891505f, 0.653384686f},
-std::array<float,2>{0.966648519f, 0.33788535f},
-std::array<float,2>{0.0173549466f, 0.891086519f},
-std::array<float,2>{0.226549089f, 0.475153446f},
-std::array<float,2>{0.800510108f, 0.775114059f},
-std::array<float,2>{0.742426276f, 0.0554596856f},
-std::array<float,2>{0.316035181f, 0.518256724f},
-std::array<float,2>{0.406767666f, 0.402190626f},
-std::array<float,2>{0.615561187f, 0.850042403f},
-std::array<float,2>{0.91249603f, 0.0878688991f},
-std::array<float,2>{0.113302f, 0.603358686f},
-std::array<float,2>{0.157633185f, 0.240282372f},
-std::array<float,2>{0.818558156f, 0.712578773f},
-std::array<float,2>{0.667699158f, 0.264570802f},
-std::array<float,2>{0.294156015f, 0.952292681f},
-std::array<float,2>{0.366699338f, 0.00234636036f},
-std::array<float,2>{0.687586069f, 0.547512054f},
-std::array<float,2>{0.763142765f, 0.455190867f},
-std::array<float,2>{0.19736819f, 0.783372879f},
-std::array<float,2>{0.0594442934f, 0.360340178f},
-std::array<float,2>{0.971750677f, 0.927676857f},
-std::array<float,2>{0.557222545f, 0.141845331f},
-std::array<float,2>{0.493416786f, 0.66674161f},
-std::array<float,2>{0.337766618f, 0.449536085f},
-std::array<float,2>{0.720019817f, 0.807923496f},
-std::array<float,2>{0.787454903f, 0.0272046812f},
-std::array<float,2>{0.249129385f, 0.538569391f},
-std::array<float,2>{0.00906047411f, 0.128155068f},
-std::array<float,2>{0.950576007f, 0.685683131f},
-std::array<float,2>{0.526961744f, 0.353996634f},
-std::array<float,2>{0.460805744f, 0.906702161f},
-std::array<float,2>{0.377158076f, 0.0649715662f},
-std::array<float,2>{0.584221244f, 0.611153662f},
-std::array<float,2>{0.892189801f, 0.376771063f},
-std::array<float,2>{0.089324519f, 0.861210823f},
-std::array<float,2>{0.147077933f, 0.278151929f},
-std::array<float,2>{0.858966708f, 0.967771828f},
-std::array<float,2>{0.651845634f, 0.230512127f},
-std::array<float,2>{0.27818197f, 0.694362462f},
-std::array<float,2>{0.476149797f, 0.319174767f},
-std::array<float,2>{0.535895348f, 0.88385123f},
-std::array<float,2>{0.993510187f, 0.186550856f},
-std::array<float,2>{0.0375463851f, 0.6344046f},
-std::array<float,2>{0.20817554f, 0.0377121754f},
-std::array<float,2>{0.77263999f, 0.504702926f},
-std::array<float,2>{0.70950985f, 0.486062914f},
-std::array<float,2>{0.348561317f, 0.750164032f},
-std::array<float,2>{0.299481869f, 0.218232051f},
-std::array<float,2>{0.682655871f, 0.726541638f},
-std::array<float,2>{0.841848373f, 0.299321413f},
-std::array<float,2>{0.183660403f, 0.979222775f},
-std::array<float,2>{0.100626968f, 0.411008596f},
-std::array<float,2>{0.927286208f, 0.831121922f},
-std::array<float,2>{0.596366405f, 0.0997174755f},
-std::array<float,2>{0.43665278f, 0.573640227f},
-std::array<float,2>{0.356820315f, 0.349973679f},
-std::array<float,2>{0.712983429f, 0.921259761f},
-std::array<float,2>{0.773457527f, 0.138239831f},
-std::array<float,2>{0.213215992f, 0.676052213f},
-std::array<float,2>{0.0408207141f, 0.0199041255f},
-std::array<float,2>{0.985158503f, 0.546294868f},
-std::array<float,2>{0.54091078f, 0.444330752f},
-std::array<float,2>{0.479018271f, 0.801820993f},
-std::array<float,2>{0.423112512f, 0.219262153f},
-std::array<float,2>{0.607398748f, 0.700883746f},
-std::array<float,2>{0.934804559f, 0.272868603f},
-std::array<float,2>{0.102361083f, 0.958403826f},
-std::array<float,2>{0.175656274f, 0.384750217f},
-std::array<float,2>{0.829948664f, 0.871626675f},
-std::array<float,2>{0.677510917f, 0.0723412856f},
-std::array<float,2>{0.306447119f, 0.617745876f},
-std::array<float,2>{0.466705441f, 0.499772131f},
-std::array<float,2>{0.520162165f, 0.75933665f},
-std::array<float,2>{0.941498101f, 0.0423060656f},
-std::array<float,2>{0.00151039683f, 0.511790276f},
-std::array<float,2>{0.238704607f, 0.175243974f},
-std::array<float,2>{0.79353714f, 0.629117906f},
-std::array<float,2>{0.72742641f, 0.320497185f},
-std::array<float,2>{0.330913007f, 0.88072896f},
-std::array<float,2>{0.266570151f, 0.10687311f},
-std::array<float,2>{0.642867684f, 0.568572342f},
-std::array<float,2>{0.848215461f, 0.419395804f},
-std::array<float,2>{0.153735682f, 0.836275935f},
-std::array<float,2>{0.081451118f, 0.30807054f},
-std::array<float,2>{0.899708867f, 0.975125015f},
-std::array<float,2>{0.591067851f, 0.205052003f},
-std::array<float,2>{0.383506119f, 0.728269458f},
-std::array<float,2>{0.28317982f, 0.428287953f},
-std::array<float,2>{0.659100413f, 0.825628698f},
-std::array<float,2>{0.821603656f, 0.124338292f},
-std::array<float,2>{0.165826902f, 0.582908511f},
-std::array<float,2>{0.118313722f, 0.200994536f},
-std::array<float,2>{0.919744432f, 0.743757665f},
-std::array<float,2>{0.619055092f, 0.293853611f},
-std::array<float,2>{0.421853334f, 0.999713123f},
-std::array<float,2>{0.489313632f, 0.0528315008f},
-std::array<float,2>{0.550942361f, 0.528789341f},
-std::array<float,2>{0.976918817f, 0.482187271f},
-std::array<float,2>{0.0506801382f, 0.771826327f},
-std::array<float,2>{0.191843137f, 0.328508079f},
-std::array<float,2>{0.755870759f, 0.901308119f},
-std::array<float,2>{0.701274514f, 0.169304311f},
-std::array<float,2>{0.372473478f, 0.647608876f},
-std::array<float,2>{0.405525833f, 0.253317595f},
-std::array<float,2>{0.57429564f, 0.937624931f},
-std::array<float,2>{0.881764412f, 0.243184298f},
-std::array<float,2>{0.0655594468f, 0.705187261f},
-std::array<float,2>{0.130427405f, 0.0794179291f},
-std::array<float,2>{0.870438814f, 0.598673165f},
-std::array<float,2>{0.639162958f, 0.39383164f},
-std::array<float,2>{0.259433717f, 0.853489757f},
-std::array<float,2>{0.322687596f, 0.153351113f},
-std::array<float,2>{0.740491748f, 0.660349071f},
-std::array<float,2>{0.81235671f, 0.372489393f},
-std::array<float,2>{0.234360486f, 0.930615723f},
-std::array<float,2>{0.0266113784f, 0.468545079f},
-std::array<float,2>{0.954633534f, 0.793601453f},
-std::array<float,2>{0.502708912f, 0.0114525072f},
-std::array<float,2>{0.438034624f, 0.561700344f},
-std::array<float,2>{0.34499824f, 0.256633252f},
-std::array<float,2>{0.704477191f, 0.943278849f},
-std::array<float,2>{0.766834974f, 0.247974306f},
-std::array<float,2>{0.205099732f, 0.709711432f},
-std::array<float,2>{0.0324001908f, 0.0843223482f},
-std::array<float,2>{0.99660635f, 0.59583503f},
-std::array<float,2>{0.533363581f, 0.397287786f},
-std::array<float,2>{0.470604032f, 0.855929494f},
-std::array<float,2>{0.432502151f, 0.150118485f},
-std::array<float,2>{0.600517333f, 0.656367064f},
-std::array<float,2>{0.92505908f, 0.368866384f},
-std::array<float,2>{0.0974825397f, 0.936412156f},
-std::array<float,2>{0.180496767f, 0.462943584f},
-std::array<float,2>{0.836315751f, 0.79092294f},
-std::array<float,2>{0.68382895f, 0.0153535297f},
-std::array<float,2>{0.304123491f, 0.556195736f},
-std::array<float,2>{0.453437865f, 0.423328042f},
-std::array<float,2>{0.530795991f, 0.822777212f},
-std::array<float,2>{0.945682526f, 0.119644821f},
-std::array<float,2>{0.0131854098f, 0.58034426f},
-std::array<float,2>{0.244405076f, 0.195830703f},
-std::array<float,2>{0.784109116f, 0.747148812f},
-std::array<float,2>{0.724396586f, 0.289321274f},
-std::array<float,2>{0.341828674f, 0.993008912f},
-std::array<float,2>{0.276700467f, 0.0486542732f},
-std::array<float,2>{0.656077623f, 0.526047885f},
-std::array<float,2>{0.854424238f, 0.480164111f},
-std::array<float,2>{0.14183709f, 0.767915666f},
-std::array<float,2>{0.0930078551f, 0.33581841f},
-std::array<float,2>{0.895020485f, 0.90239203f},
-std::array<float,2>{0.581930935f, 0.167121559f},
-std::array<float,2>{0.381477147f, 0.643066585f},
-std::array<float,2>{0.289910108f, 0.495416343f},
-std::array<float,2>{0.669073701f, 0.761966288f},
-std::array<float,2>{0.813468933f, 0.0460469015f},
-std::array<float,2>{0.161977455f, 0.511094689f},
-std::array<float,2>{0.112335704f, 0.178323954f},
-std::array<float,2>{0.906645179f, 0.628159523f},
-std::array<float,2>{0.612253368f, 0.324885428f},
-std::array<float,2>{0.41373387f, 0.878047943f},
-std::array<float,2>{0.497645706f, 0.104805842f},
-std::array<float,2>{0.561374724f, 0.565203249f},
-std::array<float,2>{0.972817838f, 0.415041178f},
-std::array<float,2>{0.0558843426f, 0.840429008f},
-std::array<float,2>{0.202367276f, 0.31120199f},
-std::array<float,2>{0.757870018f, 0.969241619f},
-std::array<float,2>{0.693161726f, 0.208397478f},
-std::array<float,2>{0.361314952f, 0.730985582f},
-std::array<float,2>{0.396355271f, 0.343825042f},
-std::array<float,2>{0.569152653f, 0.914209843f},
-std::array<float,2>{0.888291001f, 0.134588212f},
-std::array<float,2>{0.076951623f, 0.675187171f},
-std::array<float,2>{0.134583637f, 0.0183985047f},
-std::array<float,2>{0.866025567f, 0.542898536f},
-std::array<float,2>{0.626211345f, 0.439020753f},
-std::array<float,2>{0.252200484f, 0.79715097f},
-std::array<float,2>{0.320270181f, 0.225520581f},
-std::array<float,2>{0.748190641f, 0.697073698f},
-std::array<float,2>{0.803642154f, 0.26787287f},
-std::array<float,2>{0.220585078f, 0.955178857f},
-std::array<float,2>{0.0220474117f, 0.387293041f},
-std::array<float,2>{0.961002469f, 0.871043921f},
-std::array<float,2>{0.51136899f, 0.0758644566f},
-std::array<float,2>{0.447470307f, 0.621811688f},
-std::array<float,2>{0.263569146f, 0.315740258f},
-std::array<float,2>{0.63467896f, 0.889863491f},
-std::array<float,2>{0.871604145f, 0.180517301f},
-std::array<float,2>{0.125286147f, 0.637726426f},
-std::array<float,2>{0.0671240687f, 0.0341400057f},
-std::array<float,2>{0.878471434f, 0.503226638f},
-std::array<float,2>{0.572835207f, 0.491963446f},
-std::array<float,2>{0.399194002f, 0.754617333f},
-std::array<float,2>{0.445257783f, 0.213143453f},
-std::array<float,2>{0.504690468f, 0.722041845f},
-std::array<float,2>{0.960884809f, 0.302320212f},
-std::array<float,2>{0.0297989827f, 0.981500566f},
-std::array<float,2>{0.22957617f, 0.410007954f},
-std::array<float,2>{0.806034625f, 0.834727824f},
-std::array<float,2>{0.7355932f, 0.0975572914f},
-std::array<float,2>{0.327540457f, 0.577987134f},
-std::array<float,2>{0.41689837f, 0.448351294f},
-std::array<float,2>{0.624089062f, 0.811753631f},
-std::array<float,2>{0.917957544f, 0.0310828779f},
-std::array<float,2>{0.124914162f, 0.531718493f},
-std::array<float,2>{0.170362532f, 0.131351799f},
-std::array<float,2>{0.825157523f, 0.68280983f},
-std::array<float,2>{0.660808206f, 0.357399732f},
-std::array<float,2>{0.286480248f, 0.91173166f},
-std::array<float,2>{0.370237052f, 0.0669246688f},
-std::array<float,2>{0.695840538f, 0.61532259f},
-std::array<float,2>{0.753448129f, 0.382015884f},
-std::array<float,2>{0.190322876f, 0.864253044f},
-std::array<float,2>{0.0544629358f, 0.274085104f},
-std::array<float,2>{0.981714427f, 0.961573899f},
-std::array<float,2>{0.549054682f, 0.229710072f},
-std::array<float,2>{0.487667263f, 0.688889503f},
-std::array<float,2>{0.335476637f, 0.405769885f},
-std::array<float,2>{0.731125355f, 0.846853673f},
-std::array<float,2>{0.791706026f, 0.0900876001f},
-std::array<float,2>{0.235197052f, 0.608130336f},
-std::array<float,2>{0.00421296526f, 0.234414279f},
-std::array<float,2>{0.940931678f, 0.716188788f},
-std::array<float,2>{0.517104328f, 0.258771747f},
-std::array<float,2>{0.461499512f, 0.947885454f},
-std::array<float,2>{0.389247179f, 0.00564436708f},
-std::array<float,2>{0.586380899f, 0.553622484f},
-std::array<float,2>{0.904811382f, 0.458413839f},
-std::array<float,2>{0.0847508833f, 0.788296819f},
-std::array<float,2>{0.151822507f, 0.366161734f},
-std::array<float,2>{0.845300257f, 0.924663305f},
-std::array<float,2>{0.646915078f, 0.147172049f},
-std::array<float,2>{0.273261905f, 0.66897136f},
-std::array<float,2>{0.481278628f, 0.283625096f},
-std::array<float,2>{0.545834422f, 0.989738703f},
-std::array<float,2>{0.991624594f, 0.194070801f},
-std::array<float,2>{0.044120416f, 0.739078343f},
-std::array<float,2>{0.215992585f, 0.110751688f},
-std::array<float,2>{0.781245232f, 0.586113691f},
-std::array<float,2>{0.718475223f, 0.434611857f},
-std::array<float,2>{0.353215456f, 0.819499314f},
-std::array<float,2>{0.31012395f, 0.161769629f},
-std::array<float,2>{0.67332238f, 0.650948822f},
-std::array<float,2>{0.835778773f, 0.341172725f},
-std::array<float,2>{0.176031947f, 0.896587253f},
-std::array<float,2>{0.107250981f, 0.471201658f},
-std::array<float,2>{0.9320997f, 0.78094244f},
-std::array<float,2>{0.604893565f, 0.0619854704f},
-std::array<float,2>{0.429340035f, 0.523097217f},
-std::array<float,2>{0.297964692f, 0.300256997f},
-std::array<float,2>{0.679742694f, 0.979870141f},
-std::array<float,2>{0.840951741f, 0.217104807f},
-std::array<float,2>{0.187164888f, 0.724645376f},
-std::array<float,2>{0.0983628482f, 0.100910224f},
-std::array<float,2>{0.928223431f, 0.572692811f},
-std::array<float,2>{0.595230401f, 0.411211699f},
-std::array<float,2>{0.434129298f, 0.83015722f},
-std::array<float,2>{0.473620504f, 0.186277643f},
-std::array<float,2>{0.538144588f, 0.632825911f},
-std::array<float,2>{0.995974898f, 0.319437593f},
-std::array<float,2>{0.036875248f, 0.88327235f},
-std::array<float,2>{0.20924899f, 0.485177755f},
-std::array<float,2>{0.770012081f, 0.751674712f},
-std::array<float,2>{0.708893239f, 0.0385318063f},
-std::array<float,2>{0.349980086f, 0.505056858f},
-std::array<float,2>{0.375901401f, 0.375190079f},
-std::array<float,2>{0.5833534f, 0.859956682f},
-std::array<float,2>{0.894044816f, 0.0662472099f},
-std::array<float,2>{0.0860542879f, 0.609653652f},
-std::array<float,2>{0.145144373f, 0.232052729f},
-std::array<float,2>{0.855782986f, 0.693400502f},
-std::array<float,2>{0.649019063f, 0.278535992f},
-std::array<float,2>{0.280664146f, 0.968661785f},
-std::array<float,2>{0.337982416f, 0.0260054711f},
-std::array<float,2>{0.721735299f, 0.53717941f},
-std::array<float,2>{0.786430717f, 0.450638354f},
-std::array<float,2>{0.247461736f, 0.807212472f},
-std::array<float,2>{0.0106056333f, 0.354869366f},
-std::array<float,2>{0.952827275f, 0.907502353f},
-std::array<float,2>{0.524272323f, 0.127564952f},
-std::array<float,2>{0.458440483f, 0.687489033f},
-std::array<float,2>{0.363974869f, 0.456584841f},
-std::array<float,2>{0.690794289f, 0.784446895f},
-std::array<float,2>{0.765329719f, 0.00306271808f},
-std::array<float,2>{0.196987256f, 0.548803091f},
-std::array<float,2>{0.0624676757f, 0.141312271f},
-std::array<float,2>{0.969193757f, 0.667545676f},
-std::array<float,2>{0.555381238f, 0.361202866f},
-std::array<float,2>{0.495657384f, 0.9261989f},
-std::array<float,2>{0.410082817f, 0.0864007697f},
-std::array<float,2>{0.615049124f, 0.602479756f},
-std::array<float,2>{0.911177874f, 0.400701463f},
-std::array<float,2>{0.115264826f, 0.851369023f},
-std::array<float,2>{0.159628153f, 0.265160143f},
-std::array<float,2>{0.817835867f, 0.952120066f},
-std::array<float,2>{0.664975107f, 0.24139227f},
-std::array<float,2>{0.295969754f, 0.711516738f},
-std::array<float,2>{0.452931494f, 0.336616069f},
-std::array<float,2>{0.51262027f, 0.891943514f},
-std::array<float,2>{0.968449116f, 0.159464359f},
-std::array<float,2>{0.0195217691f, 0.652373433f},
-std::array<float,2>{0.222900376f, 0.0565224439f},
-std::array<float,2>{0.796964347f, 0.519441485f},
-std::array<float,2>{0.745168924f, 0.475896508f},
-std::array<float,2>{0.312866688f, 0.774199307f},
-std::array<float,2>{0.256266385f, 0.188328341f},
-std::array<float,2>{0.631475747f, 0.735974252f},
-std::array<float,2>{0.863018572f, 0.287273467f},
-std::array<float,2>{0.138883337f, 0.984945118f},
-std::array<float,2>{0.0724201202f, 0.430698276f},
-std::array<float,2>{0.882813275f, 0.812679052f},
-std::array<float,2>{0.56583488f, 0.113767013f},
-std::array<float,2>{0.391962439f, 0.591870785f},
-std::array<float,2>{0.320865929f, 0.371153861f},
-std::array<float,2>{0.738693714f, 0.931585968f},
-std::array<float,2>{0.809906363f, 0.152689815f},
-std::array<float,2>{0.23110041f, 0.662024796f},
-std::array<float,2>{0.0246137846f, 0.0107091358f},
-std::array<float,2>{0.955499589f, 0.561340332f},
-std::array<float,2>{0.50056535f, 0.467715442f},
-std::array<float,2>{0.439610362f, 0.794165373f},
-std::array<float,2>{0.402830333f, 0.242375255f},
-std::array<float,2>{0.576259136f, 0.706935763f},
-std::array<float,2>{0.878933668f, 0.252264887f},
-std::array<float,2>{0.0638484061f, 0.93899107f},
-std::array<float,2>{0.132738024f, 0.393324941f},
-std::array<float,2>{0.868864298f, 0.852522552f},
-std::array<float,2>{0.637891293f, 0.0787857547f},
-std::array<float,2>{0.261233121f, 0.59820205f},
-std::array<float,2>{0.491960377f, 0.480712056f},
-std::array<float,2>{0.553583264f, 0.773312688f},
-std::array<float,2>{0.978661478f, 0.0543052219f},
-std::array<float,2>{0.0469374508f, 0.527654469f},
-std::array<float,2>{0.194386363f, 0.168233216f},
-std::array<float,2>{0.754531026f, 0.646809518f},
-std::array<float,2>{0.700011671f, 0.329528004f},
-std::array<float,2>{0.373154223f, 0.902290046f},
-std::array<float,2>{0.284468383f, 0.123772755f},
-std::array<float,2>{0.656538963f, 0.583455563f},
-std::array<float,2>{0.822591841f, 0.42914781f},
-std::array<float,2>{0.16672416f, 0.825097203f},
-std::array<float,2>{0.119953267f, 0.294485003f},
-std::array<float,2>{0.92109865f, 0.998932779f},
-std::array<float,2>{0.619573057f, 0.1992331f},
-std::array<float,2>{0.418187588f, 0.743145287f},
-std::array<float,2>{0.268571913f, 0.418783307f},
-std::array<float,2>{0.640634477f, 0.837595582f},
-std::array<float,2>{0.851110458f, 0.106210351f},
-std::array<float,2>{0.155012995f, 0.570171714f},
-std::array<float,2>{0.0799744353f, 0.203148112f},
-std::array<float,2>{0.900950968f, 0.726895571f},
-std::array<float,2>{0.592060804f, 0.307615221f},
-std::array<float,2>{0.385522455f, 0.976294577f},
-std::array<float,2>{0.46803391f, 0.041467797f},
-std::array<float,2>{0.522909343f, 0.513498306f},
-std::array<float,2>{0.943546414f, 0.498492658f},
-std::array<float,2>{0.00295478688f, 0.758460879f},
-std::array<float,2>{0.240600064f, 0.322024405f},
-std::array<float,2>{0.796630085f, 0.879442394f},
-std::array<float,2>{0.728973448f, 0.173913717f},
-std::array<float,2>{0.328396082f, 0.630538464f},
-std::array<float,2>{0.424120694f, 0.272222549f},
-std::array<float,2>{0.608759344f, 0.957935333f},
-std::array<float,2>{0.937205017f, 0.220134333f},
-std::array<float,2>{0.103646353f, 0.699382842f},
-std::array<float,2>{0.172739327f, 0.0732703432f},
-std::array<float,2>{0.831404686f, 0.618930936f},
-std::array<float,2>{0.678199708f, 0.38345176f},
-std::array<float,2>{0.307512909f, 0.872832894f},
-std::array<float,2>{0.358864605f, 0.137497455f},
-std::array<float,2>{0.712330401f, 0.676926076f},
-std::array<float,2>{0.77591306f, 0.351296633f},
-std::array<float,2>{0.212527409f, 0.920428991f},
-std::array<float,2>{0.0426319651f, 0.444499105f},
-std::array<float,2>{0.98764801f, 0.800919712f},
-std::array<float,2>{0.542092443f, 0.0208490212f},
-std::array<float,2>{0.478394717f, 0.545267999f},
-std::array<float,2>{0.341165543f, 0.292057365f},
-std::array<float,2>{0.725103974f, 0.995984733f},
-std::array<float,2>{0.783050835f, 0.197950453f},
-std::array<float,2>{0.242972806f, 0.749465585f},
-std::array<float,2>{0.0140520241f, 0.118803345f},
-std::array<float,2>{0.947740495f, 0.579700232f},
-std::array<float,2>{0.528740644f, 0.425631255f},
-std::array<float,2>{0.456168175f, 0.821589172f},
-std::array<float,2>{0.380794048f, 0.165765658f},
-std::array<float,2>{0.578227997f, 0.640939415f},
-std::array<float,2>{0.897479773f, 0.333648384f},
-std::array<float,2>{0.0900619179f, 0.905398726f},
-std::array<float,2>{0.143285707f, 0.478306621f},
-std::array<float,2>{0.851741552f, 0.766560376f},
-std::array<float,2>{0.653383195f, 0.0505203381f},
-std::array<float,2>{0.274288744f, 0.524439096f},
-std::array<float,2>{0.471557319f, 0.395661563f},
-std::array<float,2>{0.533039331f, 0.857555032f},
-std::array<float,2>{0.999044657f, 0.0834636167f},
-std::array<float,2>{0.0340777449f, 0.595162988f},
-std::array<float,2>{0.203312367f, 0.24960649f},
-std::array<float,2>{0.767910242f, 0.708504081f},
-std::array<float,2>{0.705876231f, 0.254195243f},
-std::array<float,2>{0.346320838f, 0.944049299f},
-std::array<float,2>{0.302401155f, 0.0124067096f},
-std::array<float,2>{0.687368572f, 0.557096422f},
-std::array<float,2>{0.83926481f, 0.461497992f},
-std::array<float,2>{0.183199272f, 0.792399585f},
-std::array<float,2>{0.0938768834f, 0.370242029f},
-std::array<float,2>{0.923297405f, 0.934047341f},
-std::array<float,2>{0.598129749f, 0.151762575f},
-std::array<float,2>{0.430238456f, 0.659518063f},
-std::array<float,2>{0.250761569f, 0.440511376f},
-std::array<float,2>{0.627539337f, 0.7992239f},
-std::array<float,2>{0.864332318f, 0.0168153867f},
-std::array<float,2>{0.135051921f, 0.539328396f},
-std::array<float,2>{0.0749570653f, 0.135791764f},
-std::array<float,2>{0.889308155f, 0.673789382f},
-std::array<float,2>{0.567334414f, 0.347286403f},
-std::array<float,2>{0.396646142f, 0.916104674f},
-std::array<float,2>{0.446138471f, 0.077242814f},
-std::array<float,2>{0.508990049f, 0.623261631f},
-std::array<float,2>{0.964071691f, 0.38939485f},
-std::array<float,2>{0.0210643131f, 0.868247509f},
-std::array<float,2>{0.222282082f, 0.266013086f},
-std::array<float,2>{0.802472055f, 0.954583883f},
-std::array<float,2>{0.746365368f, 0.224292979f},
-std::array<float,2>{0.317380995f, 0.699078619f},
-std::array<float,2>{0.411091149f, 0.327664196f},
-std::array<float,2>{0.609437227f, 0.876445115f},
-std::array<float,2>{0.908240914f, 0.176953346f},
-std::array<float,2>{0.109904356f, 0.626415849f},
-std::array<float,2>{0.164017603f, 0.0433220193f},
-std::array<float,2>{0.816058755f, 0.50946641f},
-std::array<float,2>{0.671523213f, 0.492564112f},
-std::array<float,2>{0.292418212f, 0.765455186f},
-std::array<float,2>{0.362363577f, 0.210444599f},
-std::array<float,2>{0.694288492f, 0.732485533f},
-std::array<float,2>{0.760976076f, 0.310226172f},
-std::array<float,2>{0.199403197f, 0.972374201f},
-std::array<float,2>{0.0570983775f, 0.417376131f},
-std::array<float,2>{0.974757373f, 0.843419373f},
-std::array<float,2>{0.559993744f, 0.101906486f},
-std::array<float,2>{0.498944074f, 0.563323975f},
-std::array<float,2>{0.287445277f, 0.358157068f},
-std::array<float,2>{0.662410498f, 0.912264705f},
-std::array<float,2>{0.827521324f, 0.12981455f},
-std::array<float,2>{0.169297248f, 0.680593014f},
-std::array<float,2>{0.121722654f, 0.0279184263f},
-std::array<float,2>{0.915375888f, 0.535090506f},
-std::array<float,2>{0.622946501f, 0.445361376f},
-std::array<float,2>{0.414294571f, 0.809663653f},
-std::array<float,2>{0.486215472f, 0.227489918f},
-std::array<float,2>{0.547703385f, 0.691175818f},
-std::array<float,2>{0.983775616f, 0.277314156f},
-std::array<float,2>{0.0520255119f, 0.964518249f},
-std::array<float,2>{0.189276114f, 0.379760236f},
-std::array<float,2>{0.75072217f, 0.865595043f},
-std::array<float,2>{0.697478533f, 0.068827875f},
-std::array<float,2>{0.368841767f, 0.613918543f},
-std::array<float,2>{0.402018905f, 0.489681453f},
-std::array<float,2>{0.570884466f, 0.755945086f},
-std::array<float,2>{0.876837075f, 0.0320925564f},
-std::array<float,2>{0.0693266094f, 0.501363456f},
-std::array<float,2>{0.128087506f, 0.183564693f},
-std::array<float,2>{0.87394315f, 0.63905412f},
-std::array<float,2>{0.635053635f, 0.314178258f},
-std::array<float,2>{0.264610589f, 0.887000144f},
-std::array<float,2>{0.324461848f, 0.0950708538f},
-std::array<float,2>{0.737075984f, 0.574780405f},
-std::array<float,2>{0.807859063f, 0.406770587f},
-std::array<float,2>{0.228166893f, 0.833824217f},
-std::array<float,2>{0.0279891975f, 0.303526342f},
-std::array<float,2>{0.95807749f, 0.983475327f},
-std::array<float,2>{0.507508099f, 0.211903408f},
-std::array<float,2>{0.441408128f, 0.7205742f},
-std::array<float,2>{0.355028927f, 0.435832143f},
-std::array<float,2>{0.715031564f, 0.817857265f},
-std::array<float,2>{0.777942121f, 0.112510577f},
-std::array<float,2>{0.217859447f, 0.589590728f},
-std::array<float,2>{0.0468107536f, 0.193195179f},
-std::array<float,2>{0.989206314f, 0.741526604f},
-std::array<float,2>{0.544081748f, 0.281975657f},
-std::array<float,2>{0.482996047f, 0.991890073f},
-std::array<float,2>{0.427271932f, 0.0587659627f},
-std::array<float,2>{0.602214158f, 0.519995689f},
-std::array<float,2>{0.93140316f, 0.470109105f},
-std::array<float,2>{0.109115198f, 0.778156161f},
-std::array<float,2>{0.179652259f, 0.3436912f},
-std::array<float,2>{0.832448423f, 0.896161497f},
-std::array<float,2>{0.675225914f, 0.163766965f},
-std::array<float,2>{0.311472982f, 0.649810731f},
-std::array<float,2>{0.464792013f, 0.260609746f},
-std::array<float,2>{0.519408047f, 0.946355045f},
-std::array<float,2>{0.938967586f, 0.236824751f},
-std::array<float,2>{0.0065602893f, 0.716836452f},
-std::array<float,2>{0.238065779f, 0.0926409066f},
-std::array<float,2>{0.790857732f, 0.607069254f},
-std::array<float,2>{0.733209729f, 0.403792262f},
-std::array<float,2>{0.332757533f, 0.844134867f},
-std::array<float,2>{0.27110517f, 0.145700276f},
-std::array<float,2>{0.64633888f, 0.671709001f},
-std::array<float,2>{0.847581089f, 0.364836484f},
-std::array<float,2>{0.149016097f, 0.922370791f},
-std::array<float,2>{0.0837455466f, 0.459946513f},
-std::array<float,2>{0.903254747f, 0.787002563f},
-std::array<float,2>{0.588097155f, 0.00748640811f},
-std::array<float,2>{0.387406021f, 0.551997364f},
-std::array<float,2>{0.278972566f, 0.280945688f},
-std::array<float,2>{0.651364028f, 0.965410411f},
-std::array<float,2>{0.858008981f, 0.233697981f},
-std::array<float,2>{0.147601083f, 0.691456974f},
-std::array<float,2>{0.0885939598f, 0.062706627f},
-std::array<float,2>{0.891304672f, 0.61238271f},
-std::array<float,2>{0.585582972f, 0.377812803f},
-std::array<float,2>{0.378125995f, 0.863215446f},
-std::array<float,2>{0.459642738f, 0.126639768f},
-std::array<float,2>{0.526337624f, 0.684959412f},
-std::array<float,2>{0.94969964f, 0.351680785f},
-std::array<float,2>{0.00808731187f, 0.910121143f},
-std::array<float,2>{0.248467937f, 0.451552153f},
-std::array<float,2>{0.78814131f, 0.806240618f},
-std::array<float,2>{0.719191849f, 0.0249971114f},
-std::array<float,2>{0.336783707f, 0.53626436f},
-std::array<float,2>{0.435986757f, 0.413241506f},
-std::array<float,2>{0.597055554f, 0.829405963f},
-std::array<float,2>{0.925905764f, 0.0993487537f},
-std::array<float,2>{0.100513652f, 0.571817935f},
-std::array<float,2>{0.185354009f, 0.215460971f},
-std::array<float,2>{0.843543708f, 0.723199069f},
-std::array<float,2>{0.682053626f, 0.298542082f},
-std::array<float,2>{0.300287813f, 0.976883709f},
-std::array<float,2>{0.348666847f, 0.0361852162f},
-std::array<float,2>{0.710073948f, 0.506810904f},
-std::array<float,2>{0.771844089f, 0.486550868f},
-std::array<float,2>{0.2073825f, 0.752306461f},
-std::array<float,2>{0.0389635637f, 0.316656262f},
-std::array<float,2>{0.992304623f, 0.886047542f},
-std::array<float,2>{0.536910295f, 0.185170457f},
-std::array<float,2>{0.474999547f, 0.636313438f},
-std::array<float,2>{0.314708948f, 0.473885119f},
-std::array<float,2>{0.744019628f, 0.776261985f},
-std::array<float,2>{0.798864484f, 0.0579320975f},
-std::array<float,2>{0.225559726f, 0.515646994f},
-std::array<float,2>{0.0162623022f, 0.156764731f},
-std::array<float,2>{0.965522766f, 0.654802859f},
-std::array<float,2>{0.514024794f, 0.338496864f},
-std::array<float,2>{0.450507879f, 0.894302428f},
-std::array<float,2>{0.394006997f, 0.115852706f},
-std::array<float,2>{0.563842118f, 0.590483725f},
-std::array<float,2>{0.886445045f, 0.433270514f},
-std::array<float,2>{0.0718191192f, 0.815165758f},
-std::array<float,2>{0.136990368f, 0.286243349f},
-std::array<float,2>{0.860971928f, 0.986641228f},
-std::array<float,2>{0.629679918f, 0.189623088f},
-std::array<float,2>{0.255764276f, 0.736385405f},
-std::array<float,2>{0.492203891f, 0.363140047f},
-std::array<float,2>{0.557796836f, 0.928464651f},
-std::array<float,2>{0.970994711f, 0.143020719f},
-std::array<float,2>{0.0602862574f, 0.665487409f},
-std::array<float,2>{0.199080423f, 0.00147720554f},
-std::array<float,2>{0.762539029f, 0.549513638f},
-std::array<float,2>{0.688611805f, 0.453457475f},
-std::array<float,2>{0.365861863f, 0.782884896f},
-std::array<float,2>{0.293722183f, 0.23884882f},
-std::array<float,2>{0.666434348f, 0.713322818f},
-std::array<float,2>{0.820103168f, 0.261959165f},
-std::array<float,2>{0.15675433f, 0.950526237f},
-std::array<float,2>{0.11455179f, 0.399279177f},
-std::array<float,2>{0.913497508f, 0.848407447f},
-std::array<float,2>{0.617083251f, 0.089091748f},
-std::array<float,2>{0.407710493f, 0.604097724f},
-std::array<float,2>{0.371099889f, 0.330313176f},
-std::array<float,2>{0.702482402f, 0.8991009f},
-std::array<float,2>{0.757342637f, 0.170983508f},
-std::array<float,2>{0.192880243f, 0.645432651f},
-std::array<float,2>{0.0494708009f, 0.0509111285f},
-std::array<float,2>{0.978017867f, 0.529699326f},
-std::array<float,2>{0.552242696f, 0.484119922f},
-std::array<float,2>{0.488993347f, 0.770829976f},
-std::array<float,2>{0.420431107f, 0.201949522f},
-std::array<float,2>{0.617624342f, 0.745328784f},
-std::array<float,2>{0.918401778f, 0.296264738f},
-std::array<float,2>{0.117941029f, 0.997021198f},
-std::array<float,2>{0.16434294f, 0.427038491f},
-std::array<float,2>{0.820384979f, 0.827619255f},
-std::array<float,2>{0.659602821f, 0.122784466f},
-std::array<float,2>{0.281535864f, 0.58485806f},
-std::array<float,2>{0.438836068f, 0.465929508f},
-std::array<float,2>{0.503905594f, 0.796058178f},
-std::array<float,2>{0.953299761f, 0.00851679221f},
-std::array<float,2>{0.026049586f, 0.560205758f},
-std::array<float,2>{0.233005971f, 0.154419854f},
-std::array<float,2>{0.810828865f, 0.663508952f},
-std::array<float,2>{0.74194777f, 0.374091595f},
-std::array<float,2>{0.323903561f, 0.933293402f},
-std::array<float,2>{0.258031905f, 0.081554912f},
-std::array<float,2>{0.640500307f, 0.60128665f},
-std::array<float,2>{0.86989367f, 0.391241819f},
-std::array<float,2>{0.129882514f, 0.85451889f},
-std::array<float,2>{0.0652633831f, 0.250375539f},
-std::array<float,2>{0.882754326f, 0.941221297f},
-std::array<float,2>{0.575876772f, 0.245254681f},
-std::array<float,2>{0.404303938f, 0.705066442f},
-std::array<float,2>{0.305379897f, 0.38522929f},
-std::array<float,2>{0.676716268f, 0.873525262f},
-std::array<float,2>{0.828491628f, 0.070990622f},
-std::array<float,2>{0.173868775f, 0.61924237f},
-std::array<float,2>{0.103346951f, 0.221861824f},
-std::array<float,2>{0.933681905f, 0.702004552f},
-std::array<float,2>{0.605742753f, 0.270944029f},
-std::array<float,2>{0.422481865f, 0.960774839f},
-std::array<float,2>{0.479629636f, 0.0216029678f},
-std::array<float,2>{0.539359212f, 0.544396222f},
-std::array<float,2>{0.985946f, 0.442212284f},
-std::array<float,2>{0.0391386487f, 0.803707659f},
-std::array<float,2>{0.214053422f, 0.349165708f},
-std::array<float,2>{0.775152266f, 0.918407738f},
-std::array<float,2>{0.71399039f, 0.138799161f},
-std::array<float,2>{0.355847389f, 0.677938402f},
-std::array<float,2>{0.384180576f, 0.305860728f},
-std::array<float,2>{0.589901507f, 0.972795546f},
-std::array<float,2>{0.898967266f, 0.205949575f},
-std::array<float,2>{0.0807398036f, 0.730087698f},
-std::array<float,2>{0.153305411f, 0.107531302f},
-std::array<float,2>{0.84920156f, 0.568039238f},
-std::array<float,2>{0.643877923f, 0.420140445f},
-std::array<float,2>{0.266666859f, 0.839583874f},
-std::array<float,2>{0.33128652f, 0.173643023f},
-std::array<float,2>{0.728346288f, 0.63254416f},
-std::array<float,2>{0.79458636f, 0.323149502f},
-std::array<float,2>{0.239876315f, 0.882535756f},
-std::array<float,2>{0.000138305666f, 0.496794194f},
-std::array<float,2>{0.942893684f, 0.76048708f},
-std::array<float,2>{0.521335781f, 0.0402713828f},
-std::array<float,2>{0.465539008f, 0.514869332f},
-std::array<float,2>{0.349709928f, 0.297712207f},
-std::array<float,2>{0.708739638f, 0.977787197f},
-std::array<float,2>{0.769555271f, 0.216262624f},
-std::array<float,2>{0.209226787f, 0.7242468f},
-std::array<float,2>{0.0366427153f, 0.0981559381f},
-std::array<float,2>{0.99573648f, 0.57044661f},
-std::array<float,2>{0.538390279f, 0.413073897f},
-std::array<float,2>{0.473264754f, 0.828257143f},
-std::array<float,2>{0.434473187f, 0.184559643f},
-std::array<float,2>{0.595512509f, 0.634920061f},
-std::array<float,2>{0.928670585f, 0.318196684f},
-std::array<float,2>{0.0984954983f, 0.885165632f},
-std::array<float,2>{0.187290221f, 0.487793505f},
-std::array<float,2>{0.841200829f, 0.753141105f},
-std::array<float,2>{0.679996371f, 0.0361035727f},
-std::array<float,2>{0.29812175f, 0.507353544f},
-std::array<float,2>{0.45815596f, 0.377979428f},
-std::array<float,2>{0.524139941f, 0.86220789f},
-std::array<float,2>{0.952984035f, 0.064233087f},
-std::array<float,2>{0.0103128133f, 0.611645103f},
-std::array<float,2>{0.247149095f, 0.233002231f},
-std::array<float,2>{0.786331177f, 0.692602158f},
-std::array<float,2>{0.722141564f, 0.279407471f},
-std::array<float,2>{0.338373512f, 0.966675818f},
-std::array<float,2>{0.280297309f, 0.02431513f},
-std::array<float,2>{0.64932394f, 0.536017478f},
-std::array<float,2>{0.855484545f, 0.452580571f},
-std::array<float,2>{0.145502627f, 0.804959655f},
-std::array<float,2>{0.0863122046f, 0.353294313f},
-std::array<float,2>{0.894491255f, 0.908850789f},
-std::array<float,2>{0.58301723f, 0.125900179f},
-std::array<float,2>{0.37560159f, 0.683895767f},
-std::array<float,2>{0.296382576f, 0.45422101f},
-std::array<float,2>{0.664762139f, 0.782061815f},
-std::array<float,2>{0.817442834f, 0.000236596825f},
-std::array<float,2>{0.159415603f, 0.550280154f},
-std::array<float,2>{0.115521617f, 0.144390583f},
-std::array<float,2>{0.911383212f, 0.664560616f},
-std::array<float,2>{0.614891827f, 0.361816227f},
-std::array<float,2>{0.409797102f, 0.929540336f},
-std::array<float,2>{0.495853633f, 0.0888103992f},
-std::array<float,2>{0.555587232f, 0.605339289f},
-std::array<float,2>{0.968862474f, 0.399781644f},
-std::array<float,2>{0.0622156672f, 0.849263012f},
-std::array<float,2>{0.19726187f, 0.262835145f},
-std::array<float,2>{0.765471399f, 0.949629307f},
-std::array<float,2>{0.690492928f, 0.239468694f},
-std::array<float,2>{0.364226758f, 0.7147035f},
-std::array<float,2>{0.391664118f, 0.339039862f},
-std::array<float,2>{0.565563977f, 0.892788649f},
-std::array<float,2>{0.883182347f, 0.158180565f},
-std::array<float,2>{0.0726704001f, 0.655292273f},
-std::array<float,2>{0.139110669f, 0.0575143173f},
-std::array<float,2>{0.863191366f, 0.517413437f},
-std::array<float,2>{0.631662548f, 0.473060191f},
-std::array<float,2>{0.255860835f, 0.776720822f},
-std::array<float,2>{0.312683135f, 0.190442637f},
-std::array<float,2>{0.745535612f, 0.738237143f},
-std::array<float,2>{0.797261f, 0.285820186f},
-std::array<float,2>{0.22306408f, 0.987362564f},
-std::array<float,2>{0.0191120096f, 0.432474792f},
-std::array<float,2>{0.968564272f, 0.8159495f},
-std::array<float,2>{0.512396574f, 0.116275042f},
-std::array<float,2>{0.45273447f, 0.591418505f},
-std::array<float,2>{0.261652797f, 0.373297244f},
-std::array<float,2>{0.638065875f, 0.932615399f},
-std::array<float,2>{0.869095385f, 0.155605182f},
-std::array<float,2>{0.132377565f, 0.662923336f},
-std::array<float,2>{0.0634967312f, 0.00913092215f},
-std::array<float,2>{0.879291177f, 0.559511781f},
-std::array<float,2>{0.576654315f, 0.465698242f},
-std::array<float,2>{0.402384102f, 0.795373976f},
-std::array<float,2>{0.439791143f, 0.244966462f},
-std::array<float,2>{0.500767827f, 0.703750372f},
-std::array<float,2>{0.955275416f, 0.251052409f},
-std::array<float,2>{0.0249013156f, 0.939670742f},
-std::array<float,2>{0.23141928f, 0.392106116f},
-std::array<float,2>{0.809774816f, 0.854441881f},
-std::array<float,2>{0.738454163f, 0.0810425058f},
-std::array<float,2>{0.321133524f, 0.600193441f},
-std::array<float,2>{0.418344945f, 0.483112395f},
-std::array<float,2>{0.619343221f, 0.76984489f},
-std::array<float,2>{0.921151876f, 0.0523158535f},
-std::array<float,2>{0.119744807f, 0.53071624f},
-std::array<float,2>{0.166762054f, 0.170748025f},
-std::array<float,2>{0.82241565f, 0.646460652f},
-std::array<float,2>{0.65648514f, 0.331289083f},
-std::array<float,2>{0.284189761f, 0.900135815f},
-std::array<float,2>{0.373404145f, 0.121174291f},
-std::array<float,2>{0.699882388f, 0.585556865f},
-std::array<float,2>{0.754837394f, 0.426228762f},
-std::array<float,2>{0.194649413f, 0.827076733f},
-std::array<float,2>{0.0472414717f, 0.295873523f},
-std::array<float,2>{0.978940725f, 0.997247696f},
-std::array<float,2>{0.553445637f, 0.202277616f},
-std::array<float,2>{0.491796255f, 0.744870603f},
-std::array<float,2>{0.328312337f, 0.421423703f},
-std::array<float,2>{0.72862494f, 0.838499486f},
-std::array<float,2>{0.796811163f, 0.10920196f},
-std::array<float,2>{0.240234494f, 0.566678345f},
-std::array<float,2>{0.00334715028f, 0.206300855f},
-std::array<float,2>{0.943814158f, 0.729369819f},
-std::array<float,2>{0.522462904f, 0.305239618f},
-std::array<float,2>{0.467977256f, 0.97418648f},
-std::array<float,2>{0.385351241f, 0.0398960449f},
-std::array<float,2>{0.591846168f, 0.51382643f},
-std::array<float,2>{0.90120703f, 0.497971773f},
-std::array<float,2>{0.0797049552f, 0.761556745f},
-std::array<float,2>{0.15517509f, 0.323541939f},
-std::array<float,2>{0.851414979f, 0.881785989f},
-std::array<float,2>{0.641073704f, 0.172131017f},
-std::array<float,2>{0.268878371f, 0.631445646f},
-std::array<float,2>{0.478030682f, 0.270201713f},
-std::array<float,2>{0.542367041f, 0.959833086f},
-std::array<float,2>{0.987520158f, 0.221442103f},
-std::array<float,2>{0.0428963527f, 0.703059375f},
-std::array<float,2>{0.212670803f, 0.0719131231f},
-std::array<float,2>{0.776301444f, 0.620402217f},
-std::array<float,2>{0.712000549f, 0.386580735f},
-std::array<float,2>{0.358584553f, 0.874666095f},
-std::array<float,2>{0.307221681f, 0.140422255f},
-std::array<float,2>{0.677776694f, 0.679667354f},
-std::array<float,2>{0.831181049f, 0.347721398f},
-std::array<float,2>{0.172395572f, 0.919445992f},
-std::array<float,2>{0.103984736f, 0.442452967f},
-std::array<float,2>{0.937279284f, 0.804036856f},
-std::array<float,2>{0.608531117f, 0.0227303784f},
-std::array<float,2>{0.423943371f, 0.54309839f},
-std::array<float,2>{0.303891569f, 0.255647957f},
-std::array<float,2>{0.684007645f, 0.944952309f},
-std::array<float,2>{0.83608067f, 0.248235017f},
-std::array<float,2>{0.180413038f, 0.707745671f},
-std::array<float,2>{0.0973384753f, 0.082289286f},
-std::array<float,2>{0.924963474f, 0.594722629f},
-std::array<float,2>{0.600200295f, 0.39495492f},
-std::array<float,2>{0.432193071f, 0.858402252f},
-std::array<float,2>{0.470337778f, 0.150905833f},
-std::array<float,2>{0.533464015f, 0.658682048f},
-std::array<float,2>{0.996846557f, 0.369478047f},
-std::array<float,2>{0.0325862207f, 0.935185313f},
-std::array<float,2>{0.205408931f, 0.462302506f},
-std::array<float,2>{0.767044961f, 0.791363358f},
-std::array<float,2>{0.704182446f, 0.0136305345f},
-std::array<float,2>{0.344793141f, 0.557771564f},
-std::array<float,2>{0.381817073f, 0.424435794f},
-std::array<float,2>{0.58172226f, 0.820554614f},
-std::array<float,2>{0.895498574f, 0.117346056f},
-std::array<float,2>{0.0930924118f, 0.578772545f},
-std::array<float,2>{0.142085612f, 0.19862777f},
-std::array<float,2>{0.854163289f, 0.748654127f},
-std::array<float,2>{0.655894935f, 0.291601002f},
-std::array<float,2>{0.276576817f, 0.994712293f},
-std::array<float,2>{0.342196494f, 0.0492123924f},
-std::array<float,2>{0.72435075f, 0.524364114f},
-std::array<float,2>{0.783766687f, 0.476620913f},
-std::array<float,2>{0.244178146f, 0.767013311f},
-std::array<float,2>{0.0134284841f, 0.332483143f},
-std::array<float,2>{0.945540607f, 0.905191123f},
-std::array<float,2>{0.531077564f, 0.164224491f},
-std::array<float,2>{0.453181922f, 0.642246246f},
-std::array<float,2>{0.360911191f, 0.493216306f},
-std::array<float,2>{0.693003356f, 0.764386415f},
-std::array<float,2>{0.758123457f, 0.0447343476f},
-std::array<float,2>{0.202578545f, 0.508628547f},
-std::array<float,2>{0.0559502877f, 0.176684022f},
-std::array<float,2>{0.973038852f, 0.625710487f},
-std::array<float,2>{0.561233163f, 0.326821744f},
-std::array<float,2>{0.497887284f, 0.875242531f},
-std::array<float,2>{0.414026976f, 0.103189021f},
-std::array<float,2>{0.612039268f, 0.563643575f},
-std::array<float,2>{0.906291485f, 0.416509241f},
-std::array<float,2>{0.112613209f, 0.841921508f},
-std::array<float,2>{0.161733419f, 0.308982491f},
-std::array<float,2>{0.813145876f, 0.971143723f},
-std::array<float,2>{0.669281244f, 0.209144413f},
-std::array<float,2>{0.289610237f, 0.733990133f},
-std::array<float,2>{0.447606713f, 0.346346885f},
-std::array<float,2>{0.511701286f, 0.917947948f},
-std::array<float,2>{0.961187065f, 0.135577619f},
-std::array<float,2>{0.0224542655f, 0.672693014f},
-std::array<float,2>{0.220377237f, 0.0164923035f},
-std::array<float,2>{0.803452075f, 0.540229261f},
-std::array<float,2>{0.748324215f, 0.439703912f},
-std::array<float,2>{0.319928825f, 0.799931049f},
-std::array<float,2>{0.252167225f, 0.223002866f},
-std::array<float,2>{0.626295328f, 0.697328568f},
-std::array<float,2>{0.865743697f, 0.267509848f},
-std::array<float,2>{0.134378091f, 0.953641534f},
-std::array<float,2>{0.0768690109f, 0.389992535f},
-std::array<float,2>{0.88853538f, 0.867949486f},
-std::array<float,2>{0.568945885f, 0.0767166317f},
-std::array<float,2>{0.396137744f, 0.624430716f},
-std::array<float,2>{0.327320814f, 0.312888116f},
-std::array<float,2>{0.735823393f, 0.888399661f},
-std::array<float,2>{0.805744112f, 0.182501346f},
-std::array<float,2>{0.229939386f, 0.64003402f},
-std::array<float,2>{0.0300682392f, 0.0325083174f},
-std::array<float,2>{0.960462153f, 0.500554919f},
-std::array<float,2>{0.504498661f, 0.488618195f},
-std::array<float,2>{0.445056885f, 0.756979764f},
-std::array<float,2>{0.399113655f, 0.212513342f},
-std::array<float,2>{0.573215127f, 0.719605505f},
-std::array<float,2>{0.878761113f, 0.304020107f},
-std::array<float,2>{0.067370005f, 0.982919931f},
-std::array<float,2>{0.125182942f, 0.407698572f},
-std::array<float,2>{0.872003496f, 0.832102835f},
-std::array<float,2>{0.634376109f, 0.094344452f},
-std::array<float,2>{0.26339379f, 0.575960457f},
-std::array<float,2>{0.487438709f, 0.446562052f},
-std::array<float,2>{0.549084723f, 0.809172511f},
-std::array<float,2>{0.981464505f, 0.0291821472f},
-std::array<float,2>{0.0544424318f, 0.533934951f},
-std::array<float,2>{0.189952746f, 0.13047488f},
-std::array<float,2>{0.753684044f, 0.681369722f},
-std::array<float,2>{0.696058512f, 0.359223455f},
-std::array<float,2>{0.370496571f, 0.913791358f},
-std::array<float,2>{0.286332369f, 0.0701116845f},
-std::array<float,2>{0.660955489f, 0.615053177f},
-std::array<float,2>{0.824840605f, 0.380274147f},
-std::array<float,2>{0.169961199f, 0.866915107f},
-std::array<float,2>{0.124674484f, 0.275553435f},
-std::array<float,2>{0.917697787f, 0.963227868f},
-std::array<float,2>{0.624283969f, 0.228008002f},
-std::array<float,2>{0.416658103f, 0.68990761f},
-std::array<float,2>{0.273168802f, 0.402351022f},
-std::array<float,2>{0.646530926f, 0.845497608f},
-std::array<float,2>{0.845553219f, 0.0929734036f},
-std::array<float,2>{0.151541144f, 0.605675161f},
-std::array<float,2>{0.0846666992f, 0.237552524f},
-std::array<float,2>{0.905146599f, 0.718021095f},
-std::array<float,2>{0.586120605f, 0.260928869f},
-std::array<float,2>{0.389546722f, 0.946137369f},
-std::array<float,2>{0.46181646f, 0.00681740558f},
-std::array<float,2>{0.517430127f, 0.55106169f},
-std::array<float,2>{0.94133997f, 0.460692734f},
-std::array<float,2>{0.00407743081f, 0.785263717f},
-std::array<float,2>{0.235018522f, 0.363382697f},
-std::array<float,2>{0.791954339f, 0.923118651f},
-std::array<float,2>{0.731212318f, 0.145268783f},
-std::array<float,2>{0.33578077f, 0.670366526f},
-std::array<float,2>{0.429590583f, 0.282409132f},
-std::array<float,2>{0.604727566f, 0.990962923f},
-std::array<float,2>{0.931816876f, 0.192123085f},
-std::array<float,2>{0.107039534f, 0.740711927f},
-std::array<float,2>{0.176012903f, 0.111693539f},
-std::array<float,2>{0.835474133f, 0.588610351f},
-std::array<float,2>{0.672923505f, 0.436644733f},
-std::array<float,2>{0.310499519f, 0.816565216f},
-std::array<float,2>{0.353325427f, 0.162666082f},
-std::array<float,2>{0.718715787f, 0.649256051f},
-std::array<float,2>{0.780986667f, 0.34265694f},
-std::array<float,2>{0.216187701f, 0.894794881f},
-std::array<float,2>{0.0442263149f, 0.469053388f},
-std::array<float,2>{0.991429329f, 0.779019475f},
-std::array<float,2>{0.545426488f, 0.059676826f},
-std::array<float,2>{0.48111549f, 0.520899653f},
-std::array<float,2>{0.336434633f, 0.277752876f},
-std::array<float,2>{0.718987882f, 0.96698916f},
-std::array<float,2>{0.78837961f, 0.231442243f},
-std::array<float,2>{0.248251379f, 0.695294619f},
-std::array<float,2>{0.00797785167f, 0.0647017881f},
-std::array<float,2>{0.949426115f, 0.610465884f},
-std::array<float,2>{0.52594614f, 0.3763991f},
-std::array<float,2>{0.459746957f, 0.860821843f},
-std::array<float,2>{0.378408223f, 0.128727719f},
-std::array<float,2>{0.585730612f, 0.686341882f},
-std::array<float,2>{0.891429663f, 0.354096949f},
-std::array<float,2>{0.0886290446f, 0.907013297f},
-std::array<float,2>{0.147887066f, 0.449803531f},
-std::array<float,2>{0.858362913f, 0.808591723f},
-std::array<float,2>{0.650879562f, 0.0266560614f},
-std::array<float,2>{0.279147089f, 0.538946867f},
-std::array<float,2>{0.474633783f, 0.410463214f},
-std::array<float,2>{0.536789656f, 0.831703544f},
-std::array<float,2>{0.992657959f, 0.100130588f},
-std::array<float,2>{0.0386426859f, 0.574209929f},
-std::array<float,2>{0.207154199f, 0.218594328f},
-std::array<float,2>{0.771610439f, 0.7256428f},
-std::array<float,2>{0.71033293f, 0.298960209f},
-std::array<float,2>{0.349102437f, 0.978888512f},
-std::array<float,2>{0.299967617f, 0.0372385532f},
-std::array<float,2>{0.68166393f, 0.504340172f},
-std::array<float,2>{0.843315601f, 0.485748976f},
-std::array<float,2>{0.185098797f, 0.750638902f},
-std::array<float,2>{0.100117244f, 0.31838116f},
-std::array<float,2>{0.926217139f, 0.88473469f},
-std::array<float,2>{0.596786737f, 0.187106654f},
-std::array<float,2>{0.435652614f, 0.63408643f},
-std::array<float,2>{0.255475551f, 0.47463879f},
-std::array<float,2>{0.629443169f, 0.774652898f},
-std::array<float,2>{0.861310482f, 0.0547857471f},
-std::array<float,2>{0.136859819f, 0.517959893f},
-std::array<float,2>{0.0722471029f, 0.158408359f},
-std::array<float,2>{0.886681676f, 0.653885543f},
-std::array<float,2>{0.563513637f, 0.337195665f},
-std::array<float,2>{0.393782467f, 0.89130336f},
-std::array<float,2>{0.450263143f, 0.11483752f},
-std::array<float,2>{0.513858616f, 0.592861831f},
-std::array<float,2>{0.965795636f, 0.429952532f},
-std::array<float,2>{0.0165050272f, 0.813704133f},
-std::array<float,2>{0.225190252f, 0.288180858f},
-std::array<float,2>{0.799275637f, 0.986146271f},
-std::array<float,2>{0.743806601f, 0.188491642f},
-std::array<float,2>{0.314672828f, 0.73522073f},
-std::array<float,2>{0.407438695f, 0.359412074f},
-std::array<float,2>{0.616750717f, 0.927048266f},
-std::array<float,2>{0.913093269f, 0.142211854f},
-std::array<float,2>{0.114403784f, 0.666063249f},
-std::array<float,2>{0.157169402f, 0.0026843641f},
-std::array<float,2>{0.819988847f, 0.547298253f},
-std::array<float,2>{0.666163206f, 0.455787301f},
-std::array<float,2>{0.293637186f, 0.784082472f},
-std::array<float,2>{0.365988255f, 0.240944579f},
-std::array<float,2>{0.68877846f, 0.712265015f},
-std::array<float,2>{0.762322843f, 0.264101446f},
-std::array<float,2>{0.198896036f, 0.952787638f},
-std::array<float,2>{0.0603244938f, 0.40163064f},
-std::array<float,2>{0.970869243f, 0.85039115f},
-std::array<float,2>{0.558089077f, 0.0871374831f},
-std::array<float,2>{0.492503285f, 0.602942824f},
-std::array<float,2>{0.28142339f, 0.328759223f},
-std::array<float,2>{0.6593467f, 0.900558889f},
-std::array<float,2>{0.820625603f, 0.169811964f},
-std::array<float,2>{0.164214253f, 0.648193538f},
-std::array<float,2>{0.117875427f, 0.0535208359f},
-std::array<float,2>{0.917988718f, 0.52904892f},
-std::array<float,2>{0.617380917f, 0.48145023f},
-std::array<float,2>{0.420872092f, 0.772144735f},
-std::array<float,2>{0.489238143f, 0.200626686f},
-std::array<float,2>{0.551873744f, 0.743636072f},
-std::array<float,2>{0.977678716f, 0.293072075f},
-std::array<float,2>{0.0496449247f, 0.999221981f},
-std::array<float,2>{0.193235546f, 0.428068817f},
-std::array<float,2>{0.757593751f, 0.82600987f},
-std::array<float,2>{0.702363551f, 0.124784194f},
-std::array<float,2>{0.371572971f, 0.582371771f},
-std::array<float,2>{0.404573262f, 0.468013018f},
-std::array<float,2>{0.576039195f, 0.793324351f},
-std::array<float,2>{0.882435203f, 0.0108477185f},
-std::array<float,2>{0.0651427433f, 0.562173724f},
-std::array<float,2>{0.129557222f, 0.154293418f},
-std::array<float,2>{0.869660676f, 0.660943508f},
-std::array<float,2>{0.640253603f, 0.372609109f},
-std::array<float,2>{0.258112639f, 0.92998755f},
-std::array<float,2>{0.324093312f, 0.0799630061f},
-std::array<float,2>{0.741930664f, 0.599184155f},
-std::array<float,2>{0.810573041f, 0.394291997f},
-std::array<float,2>{0.233171031f, 0.85298717f},
-std::array<float,2>{0.0261338651f, 0.253787726f},
-std::array<float,2>{0.95359385f, 0.938320875f},
-std::array<float,2>{0.503497124f, 0.243883118f},
-std::array<float,2>{0.438545406f, 0.705585778f},
-std::array<float,2>{0.35562709f, 0.384167343f},
-std::array<float,2>{0.714314401f, 0.871548235f},
-std::array<float,2>{0.774999976f, 0.0727719963f},
-std::array<float,2>{0.214266628f, 0.617616475f},
-std::array<float,2>{0.0393758304f, 0.218875378f},
-std::array<float,2>{0.986252427f, 0.700207293f},
-std::array<float,2>{0.539197743f, 0.273121893f},
-std::array<float,2>{0.479970247f, 0.958591819f},
-std::array<float,2>{0.422663301f, 0.0204423368f},
-std::array<float,2>{0.605631173f, 0.546443343f},
-std::array<float,2>{0.934067488f, 0.443471313f},
-std::array<float,2>{0.103084683f, 0.80256319f},
-std::array<float,2>{0.174210832f, 0.350283384f},
-std::array<float,2>{0.828150511f, 0.921565235f},
-std::array<float,2>{0.676468909f, 0.137883157f},
-std::array<float,2>{0.305431128f, 0.676345289f},
-std::array<float,2>{0.465781748f, 0.308501899f},
-std::array<float,2>{0.521004856f, 0.975015342f},
-std::array<float,2>{0.943236589f, 0.204547152f},
-std::array<float,2>{0.000363632629f, 0.727953911f},
-std::array<float,2>{0.240015119f, 0.107178435f},
-std::array<float,2>{0.794737756f, 0.569046378f},
-std::array<float,2>{0.728147626f, 0.419742584f},
-std::array<float,2>{0.331374526f, 0.836561322f},
-std::array<float,2>{0.266939223f, 0.175362065f},
-std::array<float,2>{0.64360702f, 0.629539907f},
-std::array<float,2>{0.849414349f, 0.320913613f},
-std::array<float,2>{0.152995005f, 0.879926205f},
-std::array<float,2>{0.0809092671f, 0.499173641f},
-std::array<float,2>{0.899257123f, 0.759182811f},
-std::array<float,2>{0.590182543f, 0.0426115803f},
-std::array<float,2>{0.383935541f, 0.512565076f},
-std::array<float,2>{0.274013698f, 0.290130198f},
-std::array<float,2>{0.653768957f, 0.99395293f},
-std::array<float,2>{0.85204643f, 0.19725883f},
-std::array<float,2>{0.143442601f, 0.746327817f},
-std::array<float,2>{0.0901103765f, 0.120522037f},
-std::array<float,2>{0.897725105f, 0.581445098f},
-std::array<float,2>{0.57847172f, 0.422092199f},
-std::array<float,2>{0.380566806f, 0.823858798f},
-std::array<float,2>{0.456299961f, 0.166449368f},
-std::array<float,2>{0.528546929f, 0.644332469f},
-std::array<float,2>{0.947275996f, 0.334339201f},
-std::array<float,2>{0.0137351202f, 0.903695047f},
-std::array<float,2>{0.242810145f, 0.479005158f},
-std::array<float,2>{0.782763958f, 0.76898104f},
-std::array<float,2>{0.725562751f, 0.0475649759f},
-std::array<float,2>{0.341045916f, 0.526874542f},
-std::array<float,2>{0.430508822f, 0.398109108f},
-std::array<float,2>{0.597885072f, 0.856746495f},
-std::array<float,2>{0.923048973f, 0.0858635381f},
-std::array<float,2>{0.0940135345f, 0.597018719f},
-std::array<float,2>{0.183470368f, 0.246794373f},
-std::array<float,2>{0.839108229f, 0.710024536f},
-std::array<float,2>{0.68701607f, 0.257209271f},
-std::array<float,2>{0.302651525f, 0.942373812f},
-std::array<float,2>{0.346531957f, 0.0145244906f},
-std::array<float,2>{0.705687582f, 0.55497402f},
-std::array<float,2>{0.7676934f, 0.464758754f},
-std::array<float,2>{0.203420728f, 0.789179325f},
-std::array<float,2>{0.0339115635f, 0.367958128f},
-std::array<float,2>{0.999311149f, 0.93656528f},
-std::array<float,2>{0.532768726f, 0.149094611f},
-std::array<float,2>{0.471295685f, 0.657649279f},
-std::array<float,2>{0.316957563f, 0.437858462f},
-std::array<float,2>{0.746269524f, 0.798373997f},
-std::array<float,2>{0.802618265f, 0.0195305627f},
-std::array<float,2>{0.222631797f, 0.541564226f},
-std::array<float,2>{0.0214417726f, 0.133664504f},
-std::array<float,2>{0.964284539f, 0.674758255f},
-std::array<float,2>{0.509073913f, 0.344845533f},
-std::array<float,2>{0.445921242f, 0.915646553f},
-std::array<float,2>{0.396792531f, 0.0744835064f},
-std::array<float,2>{0.56703037f, 0.622477353f},
-std::array<float,2>{0.889588416f, 0.388276488f},
-std::array<float,2>{0.0748879761f, 0.869702935f},
-std::array<float,2>{0.134942532f, 0.26925227f},
-std::array<float,2>{0.864714801f, 0.956379354f},
-std::array<float,2>{0.627825201f, 0.226334572f},
-std::array<float,2>{0.250509262f, 0.695399582f},
-std::array<float,2>{0.498754054f, 0.325366884f},
-std::array<float,2>{0.559658289f, 0.877616286f},
-std::array<float,2>{0.974988878f, 0.179006577f},
-std::array<float,2>{0.0566963702f, 0.627162516f},
-std::array<float,2>{0.19970113f, 0.0458811894f},
-std::array<float,2>{0.761103809f, 0.50990051f},
-std::array<float,2>{0.694050312f, 0.494199395f},
-std::array<float,2>{0.362754673f, 0.763306797f},
-std::array<float,2>{0.292219251f, 0.207748905f},
-std::array<float,2>{0.671791136f, 0.73210001f},
-std::array<float,2>{0.81636101f, 0.312123597f},
-std::array<float,2>{0.163690373f, 0.970685422f},
-std::array<float,2>{0.110149778f, 0.414932787f},
-std::array<float,2>{0.908554137f, 0.841474175f},
-std::array<float,2>{0.609723091f, 0.1043007f},
-std::array<float,2>{0.410791636f, 0.566270947f},
-std::array<float,2>{0.369121015f, 0.356198043f},
-std::array<float,2>{0.697578847f, 0.910219729f},
-std::array<float,2>{0.750830889f, 0.132058561f},
-std::array<float,2>{0.188986897f, 0.681741655f},
-std::array<float,2>{0.0519904643f, 0.0299591571f},
-std::array<float,2>{0.983635068f, 0.532407641f},
-std::array<float,2>{0.547596395f, 0.447840273f},
-std::array<float,2>{0.486035436f, 0.810620964f},
-std::array<float,2>{0.414484233f, 0.229005441f},
-std::array<float,2>{0.622583389f, 0.688103318f},
-std::array<float,2>{0.915135682f, 0.274547338f},
-std::array<float,2>{0.12204019f, 0.962338686f},
-std::array<float,2>{0.169151768f, 0.380878836f},
-std::array<float,2>{0.827330589f, 0.864553273f},
-std::array<float,2>{0.662218809f, 0.0681366995f},
-std::array<float,2>{0.287214696f, 0.616914988f},
-std::array<float,2>{0.441784918f, 0.490690023f},
-std::array<float,2>{0.507639527f, 0.755846202f},
-std::array<float,2>{0.958302855f, 0.0350318812f},
-std::array<float,2>{0.0280946419f, 0.502911687f},
-std::array<float,2>{0.228421986f, 0.180897579f},
-std::array<float,2>{0.807983458f, 0.637207448f},
-std::array<float,2>{0.736937761f, 0.315244764f},
-std::array<float,2>{0.32450375f, 0.888724923f},
-std::array<float,2>{0.264163107f, 0.0964960828f},
-std::array<float,2>{0.634948969f, 0.57661885f},
-std::array<float,2>{0.87372756f, 0.408759981f},
-std::array<float,2>{0.128283814f, 0.835324526f},
-std::array<float,2>{0.0688598976f, 0.301363379f},
-std::array<float,2>{0.87654084f, 0.980991364f},
-std::array<float,2>{0.571222603f, 0.214006364f},
-std::array<float,2>{0.402131081f, 0.720933199f},
-std::array<float,2>{0.311224997f, 0.433828145f},
-std::array<float,2>{0.674827993f, 0.818951428f},
-std::array<float,2>{0.832233429f, 0.110341348f},
-std::array<float,2>{0.179369941f, 0.587281764f},
-std::array<float,2>{0.109163322f, 0.195161536f},
-std::array<float,2>{0.931378365f, 0.740038335f},
-std::array<float,2>{0.602322102f, 0.284395993f},
-std::array<float,2>{0.4276748f, 0.988966227f},
-std::array<float,2>{0.483279526f, 0.061342001f},
-std::array<float,2>{0.544366777f, 0.521552086f},
-std::array<float,2>{0.988927841f, 0.471979022f},
-std::array<float,2>{0.0465194397f, 0.779856622f},
-std::array<float,2>{0.218070805f, 0.340539783f},
-std::array<float,2>{0.77823621f, 0.897650719f},
-std::array<float,2>{0.715104222f, 0.161089286f},
-std::array<float,2>{0.35537836f, 0.651627421f},
-std::array<float,2>{0.387617648f, 0.25964126f},
-std::array<float,2>{0.588188767f, 0.948877811f},
-std::array<float,2>{0.903013468f, 0.235457718f},
-std::array<float,2>{0.0836631358f, 0.715365469f},
-std::array<float,2>{0.149303406f, 0.091476202f},
-std::array<float,2>{0.847377896f, 0.608631432f},
-std::array<float,2>{0.646156728f, 0.4045057f},
-std::array<float,2>{0.271425635f, 0.84609437f},
-std::array<float,2>{0.332769901f, 0.148047283f},
-std::array<float,2>{0.733053327f, 0.668666065f},
-std::array<float,2>{0.79061842f, 0.366724759f},
-std::array<float,2>{0.237902433f, 0.925433993f},
-std::array<float,2>{0.00660015782f, 0.457865596f},
-std::array<float,2>{0.939293385f, 0.788073242f},
-std::array<float,2>{0.51921308f, 0.00450345967f},
-std::array<float,2>{0.464461923f, 0.554542124f},
-std::array<float,2>{0.364349723f, 0.264923096f},
-std::array<float,2>{0.690325439f, 0.951539993f},
-std::array<float,2>{0.76389122f, 0.241976991f},
-std::array<float,2>{0.19573155f, 0.711344957f},
-std::array<float,2>{0.0609323531f, 0.0868398175f},
-std::array<float,2>{0.970529079f, 0.602031648f},
-std::array<float,2>{0.555761874f, 0.401028603f},
-std::array<float,2>{0.49508357f, 0.851023793f},
-std::array<float,2>{0.4083969f, 0.140628874f},
-std::array<float,2>{0.613934755f, 0.666995645f},
-std::array<float,2>{0.910992742f, 0.360830665f},
-std::array<float,2>{0.116798453f, 0.926593721f},
-std::array<float,2>{0.158761099f, 0.456308872f},
-std::array<float,2>{0.816445827f, 0.784669459f},
-std::array<float,2>{0.665734947f, 0.00348242349f},
-std::array<float,2>{0.294995278f, 0.548022628f},
-std::array<float,2>{0.45145458f, 0.431505173f},
-std::array<float,2>{0.513287067f, 0.81318593f},
-std::array<float,2>{0.967547297f, 0.114140697f},
-std::array<float,2>{0.0181706417f, 0.592732489f},
-std::array<float,2>{0.22376956f, 0.187761664f},
-std::array<float,2>{0.798573256f, 0.735593736f},
-std::array<float,2>{0.744567335f, 0.287706703f},
-std::array<float,2>{0.31410116f, 0.984517217f},
-std::array<float,2>{0.256940573f, 0.0558707379f},
-std::array<float,2>{0.632027805f, 0.518556833f},
-std::array<float,2>{0.861412227f, 0.476283818f},
-std::array<float,2>{0.139907271f, 0.773546338f},
-std::array<float,2>{0.0733295232f, 0.336280406f},
-std::array<float,2>{0.884269834f, 0.89221108f},
-std::array<float,2>{0.564520001f, 0.159857646f},
-std::array<float,2>{0.391302496f, 0.65303582f},
-std::array<float,2>{0.297525197f, 0.484386206f},
-std::array<float,2>{0.681236982f, 0.751343012f},
-std::array<float,2>{0.840540648f, 0.0387101434f},
-std::array<float,2>{0.185637012f, 0.505712688f},
-std::array<float,2>{0.0994623899f, 0.185598433f},
-std::array<float,2>{0.928723752f, 0.633428574f},
-std::array<float,2>{0.593981147f, 0.319899827f},
-std::array<float,2>{0.434646815f, 0.88367188f},
-std::array<float,2>{0.474325418f, 0.101307668f},
-std::array<float,2>{0.538005531f, 0.572864532f},
-std::array<float,2>{0.994639575f, 0.411813796f},
-std::array<float,2>{0.0353239439f, 0.830763638f},
-std::array<float,2>{0.210611895f, 0.300426126f},
-std::array<float,2>{0.770945311f, 0.9802984f},
-std::array<float,2>{0.707433462f, 0.217768088f},
-std::array<float,2>{0.351113975f, 0.725542665f},
-std::array<float,2>{0.376848966f, 0.355009019f},
-std::array<float,2>{0.582392275f, 0.907797456f},
-std::array<float,2>{0.893500686f, 0.127076969f},
-std::array<float,2>{0.0878245234f, 0.686633408f},
-std::array<float,2>{0.146207243f, 0.0257217567f},
-std::array<float,2>{0.856695235f, 0.538079202f},
-std::array<float,2>{0.650348008f, 0.451158851f},
-std::array<float,2>{0.279623151f, 0.807055175f},
-std::array<float,2>{0.339510202f, 0.231885761f},
-std::array<float,2>{0.720868528f, 0.693853676f},
-std::array<float,2>{0.785357296f, 0.279050916f},
-std::array<float,2>{0.246179745f, 0.967930138f},
-std::array<float,2>{0.0114338826f, 0.375599533f},
-std::array<float,2>{0.95190388f, 0.859630406f},
-std::array<float,2>{0.524996638f, 0.0657004118f},
-std::array<float,2>{0.457312644f, 0.610158741f},
-std::array<float,2>{0.268256307f, 0.32128948f},
-std::array<float,2>{0.642156124f, 0.879206538f},
-std::array<float,2>{0.849858284f, 0.174413607f},
-std::array<float,2>{0.155989975f, 0.63024646f},
-std::array<float,2>{0.0781588256f, 0.0419648327f},
-std::array<float,2>{0.901830435f, 0.513060868f},
-std::array<float,2>{0.593256831f, 0.498925507f},
-std::array<float,2>{0.386477739f, 0.758028448f},
-std::array<float,2>{0.466896832f, 0.203964949f},
-std::array<float,2>{0.521924198f, 0.727425575f},
-std::array<float,2>{0.944516122f, 0.307026118f},
-std::array<float,2>{0.00214923639f, 0.975627661f},
-std::array<float,2>{0.241481289f, 0.418452948f},
-std::array<float,2>{0.795320392f, 0.837229013f},
-std::array<float,2>{0.730226934f, 0.105869845f},
-std::array<float,2>{0.329208374f, 0.569437861f},
-std::array<float,2>{0.425713986f, 0.444887549f},
-std::array<float,2>{0.608234107f, 0.801582575f},
-std::array<float,2>{0.93583411f, 0.0211865827f},
-std::array<float,2>{0.104568042f, 0.545560718f},
-std::array<float,2>{0.173298389f, 0.137055472f},
-std::array<float,2>{0.830439866f, 0.677369058f},
-std::array<float,2>{0.678735375f, 0.351029068f},
-std::array<float,2>{0.308511823f, 0.920218766f},
-std::array<float,2>{0.357836425f, 0.0739613622f},
-std::array<float,2>{0.711791515f, 0.618368804f},
-std::array<float,2>{0.776534736f, 0.383203477f},
-std::array<float,2>{0.211312726f, 0.872201979f},
-std::array<float,2>{0.0411183648f, 0.271693587f},
-std::array<float,2>{0.987124979f, 0.957314312f},
-std::array<float,2>{0.541494846f, 0.220525354f},
-std::array<float,2>{0.4768655f, 0.699920595f},
-std::array<float,2>{0.321403325f, 0.392614335f},
-std::array<float,2>{0.739689767f, 0.851783693f},
-std::array<float,2>{0.808856368f, 0.0782218501f},
-std::array<float,2>{0.232055739f, 0.597911537f},
-std::array<float,2>{0.0236173309f, 0.24272573f},
-std::array<float,2>{0.956808329f, 0.706218243f},
-std::array<float,2>{0.501698971f, 0.252488256f},
-std::array<float,2>{0.441341072f, 0.938701034f},
-std::array<float,2>{0.404106259f, 0.00978350639f},
-std::array<float,2>{0.577441156f, 0.560819983f},
-std::array<float,2>{0.880085647f, 0.467097193f},
-std::array<float,2>{0.0630421266f, 0.794802547f},
-std::array<float,2>{0.131814569f, 0.371810198f},
-std::array<float,2>{0.867823839f, 0.930867553f},
-std::array<float,2>{0.637118697f, 0.153053045f},
-std::array<float,2>{0.259888113f, 0.661173582f},
-std::array<float,2>{0.490719408f, 0.294259518f},
-std::array<float,2>{0.554250956f, 0.998529613f},
-std::array<float,2>{0.979994833f, 0.199737638f},
-std::array<float,2>{0.0486922339f, 0.742331147f},
-std::array<float,2>{0.193819538f, 0.123361833f},
-std::array<float,2>{0.755338073f, 0.583503127f},
-std::array<float,2>{0.700576425f, 0.429424375f},
-std::array<float,2>{0.374093145f, 0.824444771f},
-std::array<float,2>{0.283314764f, 0.168829829f},
-std::array<float,2>{0.657540917f, 0.647268832f},
-std::array<float,2>{0.824042678f, 0.32960394f},
-std::array<float,2>{0.167099655f, 0.901775479f},
-std::array<float,2>{0.120657034f, 0.481078088f},
-std::array<float,2>{0.920455873f, 0.772494197f},
-std::array<float,2>{0.620431423f, 0.0539710037f},
-std::array<float,2>{0.419533253f, 0.528025508f},
-std::array<float,2>{0.290791273f, 0.310580611f},
-std::array<float,2>{0.668727875f, 0.968819082f},
-std::array<float,2>{0.814111114f, 0.208903626f},
-std::array<float,2>{0.160361469f, 0.730890095f},
-std::array<float,2>{0.111783266f, 0.105429016f},
-std::array<float,2>{0.907390475f, 0.564522803f},
-std::array<float,2>{0.6127249f, 0.415881485f},
-std::array<float,2>{0.412977219f, 0.840257049f},
-std::array<float,2>{0.496812761f, 0.178166777f},
-std::array<float,2>{0.56202507f, 0.628524065f},
-std::array<float,2>{0.974459171f, 0.324329257f},
-std::array<float,2>{0.0556378029f, 0.878863335f},
-std::array<float,2>{0.201726392f, 0.495685637f},
-std::array<float,2>{0.759557486f, 0.762473762f},
-std::array<float,2>{0.691774487f, 0.0467048399f},
-std::array<float,2>{0.359883696f, 0.511243284f},
-std::array<float,2>{0.394564688f, 0.387066454f},
-std::array<float,2>{0.569358885f, 0.870312214f},
-std::array<float,2>{0.887539208f, 0.0752492025f},
-std::array<float,2>{0.0777186602f, 0.621376455f},
-std::array<float,2>{0.132913932f, 0.224943683f},
-std::array<float,2>{0.866659999f, 0.696685433f},
-std::array<float,2>{0.625675082f, 0.268395692f},
-std::array<float,2>{0.253401816f, 0.955916166f},
-std::array<float,2>{0.319004089f, 0.0175877213f},
-std::array<float,2>{0.749918759f, 0.542112052f},
-std::array<float,2>{0.803738117f, 0.438511461f},
-std::array<float,2>{0.219380289f, 0.797482371f},
-std::array<float,2>{0.0225322954f, 0.344409078f},
-std::array<float,2>{0.962275565f, 0.914698005f},
-std::array<float,2>{0.509989977f, 0.134092674f},
-std::array<float,2>{0.448919922f, 0.675550938f},
-std::array<float,2>{0.344179899f, 0.463760555f},
-std::array<float,2>{0.703631639f, 0.790161669f},
-std::array<float,2>{0.765730143f, 0.0149866296f},
-std::array<float,2>{0.206251979f, 0.555779278f},
-std::array<float,2>{0.0314862765f, 0.149789765f},
-std::array<float,2>{0.997319221f, 0.657182336f},
-std::array<float,2>{0.535148382f, 0.368331164f},
-std::array<float,2>{0.468779564f, 0.935952544f},
-std::array<float,2>{0.432881713f, 0.0849094242f},
-std::array<float,2>{0.601289868f, 0.596670628f},
-std::array<float,2>{0.924746096f, 0.396686405f},
-std::array<float,2>{0.0964691266f, 0.85623467f},
-std::array<float,2>{0.181580752f, 0.256096333f},
-std::array<float,2>{0.83731842f, 0.942707062f},
-std::array<float,2>{0.685333431f, 0.247264728f},
-std::array<float,2>{0.303049088f, 0.709181368f},
-std::array<float,2>{0.45452109f, 0.335273743f},
-std::array<float,2>{0.529927671f, 0.902860403f},
-std::array<float,2>{0.946343064f, 0.167555556f},
-std::array<float,2>{0.0121164769f, 0.64271307f},
-std::array<float,2>{0.245931134f, 0.0480762459f},
-std::array<float,2>{0.784474552f, 0.525689662f},
-std::array<float,2>{0.722758412f, 0.479908943f},
-std::array<float,2>{0.343543351f, 0.768101394f},
-std::array<float,2>{0.275422931f, 0.195568055f},
-std::array<float,2>{0.65514493f, 0.747908533f},
-std::array<float,2>{0.855463088f, 0.289635271f},
-std::array<float,2>{0.140875056f, 0.992194057f},
-std::array<float,2>{0.0919136629f, 0.423786193f},
-std::array<float,2>{0.895885766f, 0.822598279f},
-std::array<float,2>{0.580893815f, 0.119156264f},
-std::array<float,2>{0.382649869f, 0.580904305f},
-std::array<float,2>{0.334832579f, 0.365546972f},
-std::array<float,2>{0.732257128f, 0.924249589f},
-std::array<float,2>{0.792402327f, 0.146936968f},
-std::array<float,2>{0.236130357f, 0.669803321f},
-std::array<float,2>{0.00527752796f, 0.00518578058f},
-std::array<float,2>{0.940028131f, 0.5527789f},
-std::array<float,2>{0.515967071f, 0.458905995f},
-std::array<float,2>{0.462104231f, 0.788816273f},
-std::array<float,2>{0.389794171f, 0.23495318f},
-std::array<float,2>{0.587673247f, 0.716614783f},
-std::array<float,2>{0.905859053f, 0.258155465f},
-std::array<float,2>{0.085201025f, 0.947310507f},
-std::array<float,2>{0.150666311f, 0.405341476f},
-std::array<float,2>{0.844640672f, 0.847621262f},
-std::array<float,2>{0.64755702f, 0.0908027589f},
-std::array<float,2>{0.272115529f, 0.607812226f},
-std::array<float,2>{0.482121348f, 0.471086502f},
-std::array<float,2>{0.546006739f, 0.780645192f},
-std::array<float,2>{0.990975559f, 0.0620620959f},
-std::array<float,2>{0.0430650674f, 0.522553205f},
-std::array<float,2>{0.21562627f, 0.161219493f},
-std::array<float,2>{0.78019923f, 0.650651991f},
-std::array<float,2>{0.717450321f, 0.341659307f},
-std::array<float,2>{0.352015704f, 0.8974365f},
-std::array<float,2>{0.309415936f, 0.11113175f},
-std::array<float,2>{0.672124445f, 0.586512029f},
-std::array<float,2>{0.834234059f, 0.435416967f},
-std::array<float,2>{0.177389652f, 0.820138693f},
-std::array<float,2>{0.106382743f, 0.283880353f},
-std::array<float,2>{0.932853281f, 0.98998183f},
-std::array<float,2>{0.603843093f, 0.193821222f},
-std::array<float,2>{0.427810133f, 0.738450766f},
-std::array<float,2>{0.261800557f, 0.409442842f},
-std::array<float,2>{0.632960677f, 0.834208906f},
-std::array<float,2>{0.872538507f, 0.0968750492f},
-std::array<float,2>{0.126474887f, 0.577226698f},
-std::array<float,2>{0.0677229241f, 0.213721529f},
-std::array<float,2>{0.877441406f, 0.722315311f},
-std::array<float,2>{0.573776245f, 0.302085906f},
-std::array<float,2>{0.399934173f, 0.982079148f},
-std::array<float,2>{0.443971545f, 0.0336852223f},
-std::array<float,2>{0.505042434f, 0.503859758f},
-std::array<float,2>{0.95965606f, 0.491376191f},
-std::array<float,2>{0.0310947616f, 0.753933072f},
-std::array<float,2>{0.228898332f, 0.315986156f},
-std::array<float,2>{0.804695308f, 0.89040494f},
-std::array<float,2>{0.73495543f, 0.17984958f},
-std::array<float,2>{0.326910168f, 0.638401449f},
-std::array<float,2>{0.41773355f, 0.273796976f},
-std::array<float,2>{0.623854339f, 0.961006045f},
-std::array<float,2>{0.916317046f, 0.230189711f},
-std::array<float,2>{0.123588793f, 0.688973665f},
-std::array<float,2>{0.170968622f, 0.0666329339f},
-std::array<float,2>{0.825472057f, 0.616179645f},
-std::array<float,2>{0.661499918f, 0.382689625f},
-std::array<float,2>{0.285391212f, 0.863358974f},
-std::array<float,2>{0.369925857f, 0.130973324f},
-std::array<float,2>{0.696475625f, 0.683442235f},
-std::array<float,2>{0.75230962f, 0.356562942f},
-std::array<float,2>{0.190523699f, 0.91142416f},
-std::array<float,2>{0.0535657667f, 0.449072152f},
-std::array<float,2>{0.981154978f, 0.812458158f},
-std::array<float,2>{0.549970329f, 0.0303898323f},
-std::array<float,2>{0.486433595f, 0.531770587f},
-std::array<float,2>{0.316313118f, 0.286955446f},
-std::array<float,2>{0.742549777f, 0.987143695f},
-std::array<float,2>{0.800657451f, 0.190042973f},
-std::array<float,2>{0.226293981f, 0.737197459f},
-std::array<float,2>{0.0172783956f, 0.115404636f},
-std::array<float,2>{0.966515541f, 0.590219438f},
-std::array<float,2>{0.514960587f, 0.43296054f},
-std::array<float,2>{0.449683666f, 0.814557612f},
-std::array<float,2>{0.393042386f, 0.156645447f},
-std::array<float,2>{0.562776208f, 0.654646218f},
-std::array<float,2>{0.88523066f, 0.338198781f},
-std::array<float,2>{0.0706164539f, 0.893954754f},
-std::array<float,2>{0.138140991f, 0.47418955f},
-std::array<float,2>{0.86008215f, 0.775407791f},
-std::array<float,2>{0.630071461f, 0.0585643873f},
-std::array<float,2>{0.254290998f, 0.516346037f},
-std::array<float,2>{0.493308246f, 0.398477644f},
-std::array<float,2>{0.557439506f, 0.847882748f},
-std::array<float,2>{0.971963525f, 0.0894491374f},
-std::array<float,2>{0.0592644475f, 0.603617966f},
-std::array<float,2>{0.197512865f, 0.238299176f},
-std::array<float,2>{0.762832999f, 0.713401079f},
-std::array<float,2>{0.687962651f, 0.262345672f},
-std::array<float,2>{0.36706996f, 0.950743794f},
-std::array<float,2>{0.294251055f, 0.00114737824f},
-std::array<float,2>{0.667856336f, 0.549167037f},
-std::array<float,2>{0.81871748f, 0.4536134f},
-std::array<float,2>{0.157417536f, 0.782377005f},
-std::array<float,2>{0.113661364f, 0.362729192f},
-std::array<float,2>{0.912119389f, 0.928045273f},
-std::array<float,2>{0.61545527f, 0.143286526f},
-std::array<float,2>{0.407177091f, 0.665952384f},
-std::array<float,2>{0.277863473f, 0.451698512f},
-std::array<float,2>{0.651495039f, 0.805671215f},
-std::array<float,2>{0.859306335f, 0.024550572f},
-std::array<float,2>{0.147421658f, 0.537062943f},
-std::array<float,2>{0.0889212489f, 0.126379162f},
-std::array<float,2>{0.892378449f, 0.685169458f},
-std::array<float,2>{0.584317565f, 0.352494687f},
-std::array<float,2>{0.377369404f, 0.909199357f},
-std::array<float,2>{0.4606677f, 0.0634233952f},
-std::array<float,2>{0.527234077f, 0.613188446f},
-std::array<float,2>{0.950419366f, 0.377247602f},
-std::array<float,2>{0.00883243047f, 0.862469971f},
-std::array<float,2>{0.249407575f, 0.280340791f},
-std::array<float,2>{0.78726089f, 0.964964151f},
-std::array<float,2>{0.7199561f, 0.233972952f},
-std::array<float,2>{0.337588161f, 0.692208588f},
-std::array<float,2>{0.436852008f, 0.317081153f},
-std::array<float,2>{0.59666127f, 0.886424124f},
-std::array<float,2>{0.927579463f, 0.184591249f},
-std::array<float,2>{0.100872658f, 0.635837078f},
-std::array<float,2>{0.184000105f, 0.037067052f},
-std::array<float,2>{0.842156291f, 0.506058872f},
-std::array<float,2>{0.68305409f, 0.487029105f},
-std::array<float,2>{0.299687922f, 0.752738953f},
-std::array<float,2>{0.348180443f, 0.215101287f},
-std::array<float,2>{0.709807038f, 0.722773135f},
-std::array<float,2>{0.77271986f, 0.298085451f},
-std::array<float,2>{0.208485231f, 0.97743088f},
-std::array<float,2>{0.0372445919f, 0.413905472f},
-std::array<float,2>{0.993200243f, 0.82983166f},
-std::array<float,2>{0.535660505f, 0.0987612307f},
-std::array<float,2>{0.476349831f, 0.571742833f},
-std::array<float,2>{0.306343496f, 0.349026442f},
-std::array<float,2>{0.677452743f, 0.918798685f},
-std::array<float,2>{0.829719484f, 0.139184237f},
-std::array<float,2>{0.175428107f, 0.678336501f},
-std::array<float,2>{0.102099717f, 0.0222655851f},
-std::array<float,2>{0.934979856f, 0.544873595f},
-std::array<float,2>{0.607084453f, 0.441422343f},
-std::array<float,2>{0.42292735f, 0.80309391f},
-std::array<float,2>{0.479491681f, 0.222379416f},
-std::array<float,2>{0.540692747f, 0.7015239f},
-std::array<float,2>{0.985005021f, 0.271243483f},
-std::array<float,2>{0.0405525118f, 0.960330963f},
-std::array<float,2>{0.212979957f, 0.385279983f},
-std::array<float,2>{0.773748636f, 0.87367487f},
-std::array<float,2>{0.713268638f, 0.0705480576f},
-std::array<float,2>{0.356662512f, 0.620033264f},
-std::array<float,2>{0.38357541f, 0.496100754f},
-std::array<float,2>{0.590841353f, 0.759861231f},
-std::array<float,2>{0.899618864f, 0.0406735204f},
-std::array<float,2>{0.0812787041f, 0.515183091f},
-std::array<float,2>{0.153543562f, 0.173019573f},
-std::array<float,2>{0.848585546f, 0.632199049f},
-std::array<float,2>{0.642639756f, 0.32246545f},
-std::array<float,2>{0.26634571f, 0.882119775f},
-std::array<float,2>{0.330719948f, 0.108166479f},
-std::array<float,2>{0.727279544f, 0.567546487f},
-std::array<float,2>{0.793801665f, 0.42082265f},
-std::array<float,2>{0.238369823f, 0.838898718f},
-std::array<float,2>{0.00192550512f, 0.306510538f},
-std::array<float,2>{0.941836059f, 0.973177314f},
-std::array<float,2>{0.520300448f, 0.205186263f},
-std::array<float,2>{0.466545075f, 0.729593277f},
-std::array<float,2>{0.372083515f, 0.427252024f},
-std::array<float,2>{0.701654136f, 0.827886403f},
-std::array<float,2>{0.756180167f, 0.12211483f},
-std::array<float,2>{0.191568226f, 0.584272385f},
-std::array<float,2>{0.0505326986f, 0.201656207f},
-std::array<float,2>{0.976584554f, 0.745984137f},
-std::array<float,2>{0.551089942f, 0.296445638f},
-std::array<float,2>{0.489675492f, 0.996176183f},
-std::array<float,2>{0.42149502f, 0.0517375767f},
-std::array<float,2>{0.618845046f, 0.529856503f},
-std::array<float,2>{0.919487238f, 0.483691216f},
-std::array<float,2>{0.118471853f, 0.77124846f},
-std::array<float,2>{0.165685594f, 0.330675423f},
-std::array<float,2>{0.821415603f, 0.898667216f},
-std::array<float,2>{0.658902943f, 0.171599463f},
-std::array<float,2>{0.282828093f, 0.644752264f},
-std::array<float,2>{0.438415557f, 0.250868857f},
-std::array<float,2>{0.502610803f, 0.940442443f},
-std::array<float,2>{0.954868793f, 0.24568671f},
-std::array<float,2>{0.0264202412f, 0.704122722f},
-std::array<float,2>{0.233901024f, 0.0811156705f},
-std::array<float,2>{0.812121451f, 0.601040781f},
-std::array<float,2>{0.740298271f, 0.390664965f},
-std::array<float,2>{0.322316349f, 0.85517168f},
-std::array<float,2>{0.259609759f, 0.155214593f},
-std::array<float,2>{0.639588773f, 0.663868845f},
-std::array<float,2>{0.870267212f, 0.374962777f},
-std::array<float,2>{0.130829811f, 0.933074057f},
-std::array<float,2>{0.0658244193f, 0.466731787f},
-std::array<float,2>{0.881412148f, 0.796783507f},
-std::array<float,2>{0.574514091f, 0.00788101554f},
-std::array<float,2>{0.405284345f, 0.560036898f},
-std::array<float,2>{0.251383752f, 0.266166657f},
-std::array<float,2>{0.628423035f, 0.954840958f},
-std::array<float,2>{0.863594115f, 0.223954201f},
-std::array<float,2>{0.136546791f, 0.698305726f},
-std::array<float,2>{0.0760132f, 0.0780541673f},
-std::array<float,2>{0.889841199f, 0.623990178f},
-std::array<float,2>{0.568212211f, 0.389021784f},
-std::array<float,2>{0.397663355f, 0.868994415f},
-std::array<float,2>{0.446775615f, 0.136482716f},
-std::array<float,2>{0.508205771f, 0.673105896f},
-std::array<float,2>{0.963863492f, 0.347112119f},
-std::array<float,2>{0.0200249292f, 0.916628957f},
-std::array<float,2>{0.221288756f, 0.440932244f},
-std::array<float,2>{0.801489115f, 0.799650252f},
-std::array<float,2>{0.747538149f, 0.0172876213f},
-std::array<float,2>{0.318128407f, 0.539637387f},
-std::array<float,2>{0.411679f, 0.417739034f},
-std::array<float,2>{0.61051023f, 0.842861831f},
-std::array<float,2>{0.909400821f, 0.102375828f},
-std::array<float,2>{0.111201786f, 0.562763035f},
-std::array<float,2>{0.162336051f, 0.210735962f},
-std::array<float,2>{0.815134943f, 0.733359337f},
-std::array<float,2>{0.670491934f, 0.30960831f},
-std::array<float,2>{0.291591644f, 0.972136557f},
-std::array<float,2>{0.361857206f, 0.0438707285f},
-std::array<float,2>{0.69440192f, 0.509205341f},
-std::array<float,2>{0.759979665f, 0.492961228f},
-std::array<float,2>{0.200757772f, 0.765048683f},
-std::array<float,2>{0.0579715669f, 0.327167422f},
-std::array<float,2>{0.976511955f, 0.87646842f},
-std::array<float,2>{0.559414387f, 0.177445784f},
-std::array<float,2>{0.499560267f, 0.626629233f},
-std::array<float,2>{0.340356886f, 0.477774829f},
-std::array<float,2>{0.726506114f, 0.765824497f},
-std::array<float,2>{0.781624794f, 0.0502098016f},
-std::array<float,2>{0.243167743f, 0.525149941f},
-std::array<float,2>{0.0147167528f, 0.165419325f},
-std::array<float,2>{0.949076712f, 0.641138375f},
-std::array<float,2>{0.528281689f, 0.33334291f},
-std::array<float,2>{0.455532551f, 0.906150699f},
-std::array<float,2>{0.379294038f, 0.11864417f},
-std::array<float,2>{0.579461873f, 0.579557359f},
-std::array<float,2>{0.896894515f, 0.425010771f},
-std::array<float,2>{0.0908305347f, 0.822082937f},
-std::array<float,2>{0.144313216f, 0.292769074f},
-std::array<float,2>{0.853161931f, 0.995380461f},
-std::array<float,2>{0.653300107f, 0.197636038f},
-std::array<float,2>{0.274861902f, 0.749994934f},
-std::array<float,2>{0.472497761f, 0.370927662f},
-std::array<float,2>{0.531694472f, 0.934142292f},
-std::array<float,2>{0.998673141f, 0.152157217f},
-std::array<float,2>{0.0343741067f, 0.660078466f},
-std::array<float,2>{0.204225078f, 0.0117943352f},
-std::array<float,2>{0.769398749f, 0.557472289f},
-std::array<float,2>{0.706262708f, 0.461109608f},
-std::array<float,2>{0.347619593f, 0.792542279f},
-std::array<float,2>{0.301431149f, 0.249408096f},
-std::array<float,2>{0.686280847f, 0.708450794f},
-std::array<float,2>{0.838749766f, 0.25460887f},
-std::array<float,2>{0.182546988f, 0.943403304f},
-std::array<float,2>{0.0951595232f, 0.396374255f},
-std::array<float,2>{0.922667146f, 0.858283758f},
-std::array<float,2>{0.59946239f, 0.0835532174f},
-std::array<float,2>{0.431460649f, 0.595550299f},
-std::array<float,2>{0.3540968f, 0.342783809f},
-std::array<float,2>{0.716339409f, 0.895910084f},
-std::array<float,2>{0.778560519f, 0.163177893f},
-std::array<float,2>{0.216816664f, 0.650017619f},
-std::array<float,2>{0.0451132506f, 0.0593526661f},
-std::array<float,2>{0.990152121f, 0.520297229f},
-std::array<float,2>{0.543778419f, 0.470689803f},
-std::array<float,2>{0.48361221f, 0.777405381f},
-std::array<float,2>{0.426512718f, 0.192552283f},
-std::array<float,2>{0.602610469f, 0.741825819f},
-std::array<float,2>{0.930436492f, 0.281343937f},
-std::array<float,2>{0.107625544f, 0.991400063f},
-std::array<float,2>{0.178396672f, 0.436503679f},
-std::array<float,2>{0.833500028f, 0.817876756f},
-std::array<float,2>{0.674337447f, 0.113003112f},
-std::array<float,2>{0.311806172f, 0.589312494f},
-std::array<float,2>{0.463747591f, 0.459024101f},
-std::array<float,2>{0.517978013f, 0.786277771f},
-std::array<float,2>{0.938227475f, 0.006855343f},
-std::array<float,2>{0.00773944659f, 0.552439332f},
-std::array<float,2>{0.237059608f, 0.146262825f},
-std::array<float,2>{0.789866149f, 0.670937002f},
-std::array<float,2>{0.733556986f, 0.364360869f},
-std::array<float,2>{0.333513558f, 0.922037959f},
-std::array<float,2>{0.269847453f, 0.0919637233f},
-std::array<float,2>{0.645444393f, 0.606911778f},
-std::array<float,2>{0.846018434f, 0.40409413f},
-std::array<float,2>{0.149512187f, 0.844503522f},
-std::array<float,2>{0.0830061883f, 0.260046452f},
-std::array<float,2>{0.904245436f, 0.947162986f},
-std::array<float,2>{0.589035213f, 0.236805469f},
-std::array<float,2>{0.388414055f, 0.717713535f},
-std::array<float,2>{0.288451731f, 0.379209042f},
-std::array<float,2>{0.663508832f, 0.866084039f},
-std::array<float,2>{0.826181293f, 0.0688998848f},
-std::array<float,2>{0.16856268f, 0.6135571f},
-std::array<float,2>{0.122096561f, 0.226828039f},
-std::array<float,2>{0.91424191f, 0.690770149f},
-std::array<float,2>{0.621424139f, 0.27647236f},
-std::array<float,2>{0.415126026f, 0.964052498f},
-std::array<float,2>{0.485054374f, 0.0276647098f},
-std::array<float,2>{0.548181653f, 0.534313977f},
-std::array<float,2>{0.982969165f, 0.445983797f},
-std::array<float,2>{0.0515480675f, 0.810432911f},
-std::array<float,2>{0.187846839f, 0.357528508f},
-std::array<float,2>{0.751353502f, 0.91305536f},
-std::array<float,2>{0.699099004f, 0.129121885f},
-std::array<float,2>{0.367553622f, 0.679867983f},
-std::array<float,2>{0.400457621f, 0.302755982f},
-std::array<float,2>{0.571364999f, 0.984283507f},
-std::array<float,2>{0.875394702f, 0.211389095f},
-std::array<float,2>{0.070092082f, 0.720027387f},
-std::array<float,2>{0.127661973f, 0.0953504294f},
-std::array<float,2>{0.874378562f, 0.57446593f},
-std::array<float,2>{0.635994792f, 0.406269044f},
-std::array<float,2>{0.264941722f, 0.833326638f},
-std::array<float,2>{0.325349957f, 0.182949439f},
-std::array<float,2>{0.737389147f, 0.639492273f},
-std::array<float,2>{0.807026982f, 0.313715547f},
-std::array<float,2>{0.226578504f, 0.887538016f},
-std::array<float,2>{0.0290777646f, 0.490209311f},
-std::array<float,2>{0.957417071f, 0.756686628f},
-std::array<float,2>{0.506659746f, 0.0313724615f},
-std::array<float,2>{0.443257153f, 0.501533628f},
-std::array<float,2>{0.374714077f, 0.295959562f},
-std::array<float,2>{0.701080859f, 0.996701598f},
-std::array<float,2>{0.755409181f, 0.20175688f},
-std::array<float,2>{0.194260687f, 0.745563269f},
-std::array<float,2>{0.0480829328f, 0.122832723f},
-std::array<float,2>{0.97997278f, 0.584661067f},
-std::array<float,2>{0.554045737f, 0.426895708f},
-std::array<float,2>{0.491153747f, 0.827385843f},
-std::array<float,2>{0.419161767f, 0.171366319f},
-std::array<float,2>{0.620853484f, 0.645231843f},
-std::array<float,2>{0.920133948f, 0.330491006f},
-std::array<float,2>{0.120270632f, 0.899353802f},
-std::array<float,2>{0.167685419f, 0.484303236f},
-std::array<float,2>{0.82345444f, 0.770714879f},
-std::array<float,2>{0.658193469f, 0.0510859191f},
-std::array<float,2>{0.283974767f, 0.529452741f},
-std::array<float,2>{0.440592706f, 0.391523212f},
-std::array<float,2>{0.50134182f, 0.854872227f},
-std::array<float,2>{0.956371129f, 0.0819981471f},
-std::array<float,2>{0.0241521522f, 0.601386726f},
-std::array<float,2>{0.231838614f, 0.245577186f},
-std::array<float,2>{0.80925262f, 0.704624772f},
-std::array<float,2>{0.739896774f, 0.250201672f},
-std::array<float,2>{0.321939081f, 0.940940022f},
-std::array<float,2>{0.260440648f, 0.00877553038f},
-std::array<float,2>{0.637569666f, 0.56044811f},
-std::array<float,2>{0.86739707f, 0.466095477f},
-std::array<float,2>{0.131289631f, 0.796220779f},
-std::array<float,2>{0.0628084391f, 0.374385506f},
-std::array<float,2>{0.880727887f, 0.933489203f},
-std::array<float,2>{0.57793659f, 0.154560849f},
-std::array<float,2>{0.403693914f, 0.663233042f},
-std::array<float,2>{0.307819754f, 0.442122519f},
-std::array<float,2>{0.679668784f, 0.803293526f},
-std::array<float,2>{0.83079046f, 0.0218497831f},
-std::array<float,2>{0.173360616f, 0.543973029f},
-std::array<float,2>{0.104982518f, 0.138946563f},
-std::array<float,2>{0.936142921f, 0.678011715f},
-std::array<float,2>{0.607905984f, 0.349379659f},
-std::array<float,2>{0.425053596f, 0.917981863f},
-std::array<float,2>{0.477090031f, 0.0711558238f},
-std::array<float,2>{0.541542888f, 0.619432807f},
-std::array<float,2>{0.986659646f, 0.384787947f},
-std::array<float,2>{0.0416118614f, 0.873073101f},
-std::array<float,2>{0.211631045f, 0.270673484f},
-std::array<float,2>{0.777149618f, 0.960546553f},
-std::array<float,2>{0.71130532f, 0.222163945f},
-std::array<float,2>{0.358300894f, 0.701768458f},
-std::array<float,2>{0.386051118f, 0.32294333f},
-std::array<float,2>{0.593304873f, 0.882689297f},
-std::array<float,2>{0.902343452f, 0.173366457f},
-std::array<float,2>{0.0786319748f, 0.632732391f},
-std::array<float,2>{0.155558914f, 0.0404781476f},
-std::array<float,2>{0.85056299f, 0.515076041f},
-std::array<float,2>{0.641831696f, 0.497057915f},
-std::array<float,2>{0.267666787f, 0.760505497f},
-std::array<float,2>{0.329747111f, 0.205644444f},
-std::array<float,2>{0.729556262f, 0.730451226f},
-std::array<float,2>{0.79580766f, 0.306149274f},
-std::array<float,2>{0.241817594f, 0.972959995f},
-std::array<float,2>{0.00281629548f, 0.42033723f},
-std::array<float,2>{0.945162475f, 0.839733005f},
-std::array<float,2>{0.522369027f, 0.107701696f},
-std::array<float,2>{0.467721403f, 0.568190038f},
-std::array<float,2>{0.27993989f, 0.351888508f},
-std::array<float,2>{0.649808228f, 0.909757972f},
-std::array<float,2>{0.857297599f, 0.126897469f},
-std::array<float,2>{0.145519644f, 0.684666574f},
-std::array<float,2>{0.0871650577f, 0.0253655612f},
-std::array<float,2>{0.892898977f, 0.536471844f},
-std::array<float,2>{0.582849383f, 0.451187193f},
-std::array<float,2>{0.376296014f, 0.806491375f},
-std::array<float,2>{0.457634211f, 0.233573958f},
-std::array<float,2>{0.524774015f, 0.691854954f},
-std::array<float,2>{0.951319039f, 0.28103891f},
-std::array<float,2>{0.0112107629f, 0.965606928f},
-std::array<float,2>{0.246591657f, 0.377605021f},
-std::array<float,2>{0.786026299f, 0.863011956f},
-std::array<float,2>{0.721650779f, 0.0628880113f},
-std::array<float,2>{0.339159727f, 0.612633169f},
-std::array<float,2>{0.435093671f, 0.486672282f},
-std::array<float,2>{0.594477713f, 0.752158165f},
-std::array<float,2>{0.92964679f, 0.0365453996f},
-std::array<float,2>{0.0989880189f, 0.506372273f},
-std::array<float,2>{0.186441332f, 0.185408711f},
-std::array<float,2>{0.839968503f, 0.636680841f},
-std::array<float,2>{0.68075639f, 0.316619813f},
-std::array<float,2>{0.297044635f, 0.885913372f},
-std::array<float,2>{0.351064533f, 0.0994857848f},
-std::array<float,2>{0.707904458f, 0.572088182f},
-std::array<float,2>{0.771331847f, 0.413370878f},
-std::array<float,2>{0.21037212f, 0.82916075f},
-std::array<float,2>{0.0358075202f, 0.29859677f},
-std::array<float,2>{0.994163334f, 0.976563394f},
-std::array<float,2>{0.537515044f, 0.215814993f},
-std::array<float,2>{0.47407341f, 0.723454356f},
-std::array<float,2>{0.313639343f, 0.433394432f},
-std::array<float,2>{0.744660437f, 0.81526947f},
-std::array<float,2>{0.797982574f, 0.116160035f},
-std::array<float,2>{0.224519014f, 0.590595067f},
-std::array<float,2>{0.0176779144f, 0.189740658f},
-std::array<float,2>{0.966863871f, 0.736764431f},
-std::array<float,2>{0.512814522f, 0.286590755f},
-std::array<float,2>{0.451897413f, 0.986541867f},
-std::array<float,2>{0.390870333f, 0.0577278137f},
-std::array<float,2>{0.565335512f, 0.516025364f},
-std::array<float,2>{0.884763598f, 0.473860085f},
-std::array<float,2>{0.0741038322f, 0.775903285f},
-std::array<float,2>{0.140545279f, 0.338624805f},
-std::array<float,2>{0.862291634f, 0.894273639f},
-std::array<float,2>{0.6327371f, 0.157016858f},
-std::array<float,2>{0.257515192f, 0.65503794f},
-std::array<float,2>{0.494238049f, 0.262016833f},
-std::array<float,2>{0.556606352f, 0.95033437f},
-std::array<float,2>{0.970120013f, 0.23917985f},
-std::array<float,2>{0.0612270236f, 0.713116765f},
-std::array<float,2>{0.196117625f, 0.0892264098f},
-std::array<float,2>{0.76432842f, 0.604343295f},
-std::array<float,2>{0.689792633f, 0.399071842f},
-std::array<float,2>{0.364958823f, 0.848213196f},
-std::array<float,2>{0.295842052f, 0.142612278f},
-std::array<float,2>{0.665049434f, 0.665120184f},
-std::array<float,2>{0.816909432f, 0.362902552f},
-std::array<float,2>{0.158642188f, 0.9286201f},
-std::array<float,2>{0.116575673f, 0.453339607f},
-std::array<float,2>{0.910473764f, 0.783011675f},
-std::array<float,2>{0.613702714f, 0.00180820574f},
-std::array<float,2>{0.408803761f, 0.54964149f},
-std::array<float,2>{0.28604418f, 0.276899993f},
-std::array<float,2>{0.661702812f, 0.964777231f},
-std::array<float,2>{0.825713456f, 0.227201328f},
-std::array<float,2>{0.171786949f, 0.691042721f},
-std::array<float,2>{0.12332809f, 0.0683688074f},
-std::array<float,2>{0.916743577f, 0.614178598f},
-std::array<float,2>{0.623097897f, 0.379530966f},
-std::array<float,2>{0.417333931f, 0.86537683f},
-std::array<float,2>{0.487192124f, 0.129520833f},
-std::array<float,2>{0.550558627f, 0.680195212f},
-std::array<float,2>{0.980887175f, 0.358086914f},
-std::array<float,2>{0.0531129874f, 0.91244173f},
-std::array<float,2>{0.191289783f, 0.445574492f},
-std::array<float,2>{0.752458632f, 0.809954584f},
-std::array<float,2>{0.697187185f, 0.0282750819f},
-std::array<float,2>{0.369421244f, 0.534747362f},
-std::array<float,2>{0.399751604f, 0.407035559f},
-std::array<float,2>{0.573618174f, 0.833560526f},
-std::array<float,2>{0.877439082f, 0.0948617458f},
-std::array<float,2>{0.0679003224f, 0.575134158f},
-std::array<float,2>{0.126103133f, 0.211468637f},
-std::array<float,2>{0.872864544f, 0.720367551f},
-std::array<float,2>{0.63347894f, 0.303451955f},
-std::array<float,2>{0.26253742f, 0.983756125f},
-std::array<float,2>{0.326502711f, 0.0317720957f},
-std::array<float,2>{0.734467149f, 0.501180351f},
-std::array<float,2>{0.805467904f, 0.489393651f},
-std::array<float,2>{0.229066879f, 0.756222188f},
-std::array<float,2>{0.030515695f, 0.314247996f},
-std::array<float,2>{0.959445953f, 0.886775553f},
-std::array<float,2>{0.505702317f, 0.183134273f},
-std::array<float,2>{0.443818808f, 0.638764679f},
-std::array<float,2>{0.35251388f, 0.46972692f},
-std::array<float,2>{0.716880977f, 0.777992368f},
-std::array<float,2>{0.779321015f, 0.0588391013f},
-std::array<float,2>{0.214895904f, 0.519610167f},
-std::array<float,2>{0.0437187292f, 0.163859531f},
-std::array<float,2>{0.990470827f, 0.649492383f},
-std::array<float,2>{0.546700656f, 0.343336999f},
-std::array<float,2>{0.481841207f, 0.896323442f},
-std::array<float,2>{0.428321332f, 0.112754852f},
-std::array<float,2>{0.604106843f, 0.589769661f},
-std::array<float,2>{0.933209658f, 0.435713798f},
-std::array<float,2>{0.105854377f, 0.817619264f},
-std::array<float,2>{0.176957309f, 0.282219857f},
-std::array<float,2>{0.834488928f, 0.992000818f},
-std::array<float,2>{0.672652662f, 0.193073303f},
-std::array<float,2>{0.308925301f, 0.741372943f},
-std::array<float,2>{0.462855041f, 0.365145177f},
-std::array<float,2>{0.516550541f, 0.92281872f},
-std::array<float,2>{0.939509392f, 0.145789668f},
-std::array<float,2>{0.00539755542f, 0.671442628f},
-std::array<float,2>{0.235513583f, 0.0076413271f},
-std::array<float,2>{0.792696297f, 0.552244067f},
-std::array<float,2>{0.731756806f, 0.459584713f},
-std::array<float,2>{0.334094703f, 0.786830842f},
-std::array<float,2>{0.271723241f, 0.237207308f},
-std::array<float,2>{0.648234725f, 0.717042208f},
-std::array<float,2>{0.84395951f, 0.260415673f},
-std::array<float,2>{0.150984615f, 0.946727097f},
-std::array<float,2>{0.0858473256f, 0.403356135f},
-std::array<float,2>{0.905414999f, 0.843788922f},
-std::array<float,2>{0.586944401f, 0.092326723f},
-std::array<float,2>{0.390161008f, 0.607401073f},
-std::array<float,2>{0.342893809f, 0.333891124f},
-std::array<float,2>{0.723394811f, 0.905578852f},
-std::array<float,2>{0.784756184f, 0.165931955f},
-std::array<float,2>{0.24557288f, 0.64079386f},
-std::array<float,2>{0.012321732f, 0.0507094339f},
-std::array<float,2>{0.946904898f, 0.524686635f},
-std::array<float,2>{0.529765606f, 0.478130847f},
-std::array<float,2>{0.454886168f, 0.766303599f},
-std::array<float,2>{0.381845295f, 0.198214486f},
-std::array<float,2>{0.580187917f, 0.749106407f},
-std::array<float,2>{0.896331906f, 0.292348862f},
-std::array<float,2>{0.0925507471f, 0.99574852f},
-std::array<float,2>{0.141556799f, 0.425470293f},
-std::array<float,2>{0.854778588f, 0.821445644f},
-std::array<float,2>{0.654456913f, 0.119011797f},
-std::array<float,2>{0.276208967f, 0.579839587f},
-std::array<float,2>{0.469592005f, 0.46176976f},
-std::array<float,2>{0.534209967f, 0.792060852f},
-std::array<float,2>{0.997952044f, 0.012568376f},
-std::array<float,2>{0.0318794735f, 0.556816161f},
-std::array<float,2>{0.206757694f, 0.151418805f},
-std::array<float,2>{0.76635468f, 0.659398317f},
-std::array<float,2>{0.703209639f, 0.370485932f},
-std::array<float,2>{0.344489336f, 0.933795154f},
-std::array<float,2>{0.303273737f, 0.0830649957f},
-std::array<float,2>{0.684735179f, 0.594836295f},
-std::array<float,2>{0.837664545f, 0.395795614f},
-std::array<float,2>{0.181106791f, 0.857848227f},
-std::array<float,2>{0.096069701f, 0.254091978f},
-std::array<float,2>{0.924307585f, 0.944248199f},
-std::array<float,2>{0.600837767f, 0.249962807f},
-std::array<float,2>{0.433157086f, 0.7089625f},
-std::array<float,2>{0.253479272f, 0.389479399f},
-std::array<float,2>{0.625007629f, 0.868627667f},
-std::array<float,2>{0.866979182f, 0.0775133818f},
-std::array<float,2>{0.133346245f, 0.623298824f},
-std::array<float,2>{0.0771682486f, 0.224577054f},
-std::array<float,2>{0.887008309f, 0.698745608f},
-std::array<float,2>{0.570022345f, 0.265817553f},
-std::array<float,2>{0.395392537f, 0.954277396f},
-std::array<float,2>{0.448405087f, 0.0170479883f},
-std::array<float,2>{0.510642171f, 0.539138973f},
-std::array<float,2>{0.962527335f, 0.440837979f},
-std::array<float,2>{0.0231771357f, 0.799025595f},
-std::array<float,2>{0.218942896f, 0.347654134f},
-std::array<float,2>{0.804465532f, 0.916360497f},
-std::array<float,2>{0.749137819f, 0.135988399f},
-std::array<float,2>{0.318419427f, 0.673420668f},
-std::array<float,2>{0.412331164f, 0.310402542f},
-std::array<float,2>{0.613160551f, 0.972530723f},
-std::array<float,2>{0.907839239f, 0.210174561f},
-std::array<float,2>{0.112141199f, 0.732889473f},
-std::array<float,2>{0.160974085f, 0.101628385f},
-std::array<float,2>{0.813683629f, 0.563224971f},
-std::array<float,2>{0.667988598f, 0.417022884f},
-std::array<float,2>{0.290340066f, 0.843524814f},
-std::array<float,2>{0.359675348f, 0.177097812f},
-std::array<float,2>{0.691951334f, 0.626217008f},
-std::array<float,2>{0.759240568f, 0.327996671f},
-std::array<float,2>{0.201441303f, 0.876076579f},
-std::array<float,2>{0.0550325885f, 0.492342263f},
-std::array<float,2>{0.973655522f, 0.765328586f},
-std::array<float,2>{0.561862409f, 0.0431245565f},
-std::array<float,2>{0.496354222f, 0.509759903f},
-std::array<float,2>{0.323027581f, 0.252025008f},
-std::array<float,2>{0.741204739f, 0.939318359f},
-std::array<float,2>{0.811735511f, 0.242481619f},
-std::array<float,2>{0.233717233f, 0.706573009f},
-std::array<float,2>{0.0270333048f, 0.0789472759f},
-std::array<float,2>{0.954553545f, 0.598543406f},
-std::array<float,2>{0.501962662f, 0.393256038f},
-std::array<float,2>{0.437633693f, 0.852195084f},
-std::array<float,2>{0.405931503f, 0.152415916f},
-std::array<float,2>{0.574993551f, 0.661787987f},
-std::array<float,2>{0.881238043f, 0.371390909f},
-std::array<float,2>{0.0662267357f, 0.931325972f},
-std::array<float,2>{0.129913017f, 0.467409998f},
-std::array<float,2>{0.870964229f, 0.794305921f},
-std::array<float,2>{0.638886571f, 0.0103258453f},
-std::array<float,2>{0.258872032f, 0.561242223f},
-std::array<float,2>{0.489904672f, 0.428759724f},
-std::array<float,2>{0.551442266f, 0.824914455f},
-std::array<float,2>{0.977509439f, 0.123826437f},
-std::array<float,2>{0.049947653f, 0.583106697f},
-std::array<float,2>{0.192194372f, 0.199509963f},
-std::array<float,2>{0.75680548f, 0.742903352f},
-std::array<float,2>{0.701890409f, 0.294912666f},
-std::array<float,2>{0.372980028f, 0.998632073f},
-std::array<float,2>{0.282388806f, 0.0546390526f},
-std::array<float,2>{0.65868187f, 0.527473152f},
-std::array<float,2>{0.82219696f, 0.480740279f},
-std::array<float,2>{0.165377632f, 0.773176968f},
-std::array<float,2>{0.119023353f, 0.329301089f},
-std::array<float,2>{0.918964684f, 0.902043998f},
-std::array<float,2>{0.618288279f, 0.167988345f},
-std::array<float,2>{0.420996934f, 0.646573901f},
-std::array<float,2>{0.265655726f, 0.498249978f},
-std::array<float,2>{0.643381059f, 0.758737028f},
-std::array<float,2>{0.84801513f, 0.0410247855f},
-std::array<float,2>{0.154241353f, 0.513356388f},
-std::array<float,2>{0.0817443728f, 0.174248561f},
-std::array<float,2>{0.89991641f, 0.630764723f},
-std::array<float,2>{0.591598332f, 0.321943551f},
-std::array<float,2>{0.382960588f, 0.879783869f},
-std::array<float,2>{0.466075748f, 0.106003858f},
-std::array<float,2>{0.519817054f, 0.569840193f},
-std::array<float,2>{0.942010105f, 0.418650955f},
-std::array<float,2>{0.00110361818f, 0.837738991f},
-std::array<float,2>{0.239217073f, 0.307208747f},
-std::array<float,2>{0.793187439f, 0.976323605f},
-std::array<float,2>{0.72683239f, 0.203598499f},
-std::array<float,2>{0.33017838f, 0.726709962f},
-std::array<float,2>{0.423405081f, 0.351336449f},
-std::array<float,2>{0.606476903f, 0.920765877f},
-std::array<float,2>{0.935473323f, 0.13738057f},
-std::array<float,2>{0.102023549f, 0.677077115f},
-std::array<float,2>{0.174811378f, 0.0206217039f},
-std::array<float,2>{0.829128265f, 0.544984043f},
-std::array<float,2>{0.677240133f, 0.444691718f},
-std::array<float,2>{0.30590412f, 0.801256239f},
-std::array<float,2>{0.356981874f, 0.219906151f},
-std::array<float,2>{0.713452876f, 0.699475825f},
-std::array<float,2>{0.774163783f, 0.27217266f},
-std::array<float,2>{0.213620305f, 0.957681477f},
-std::array<float,2>{0.0402653143f, 0.383755863f},
-std::array<float,2>{0.984429598f, 0.872579575f},
-std::array<float,2>{0.540352762f, 0.0736840665f},
-std::array<float,2>{0.478718132f, 0.61868906f},
-std::array<float,2>{0.298964977f, 0.319812238f},
-std::array<float,2>{0.683273494f, 0.882932305f},
-std::array<float,2>{0.84269464f, 0.186484784f},
-std::array<float,2>{0.184414029f, 0.633211553f},
-std::array<float,2>{0.101236723f, 0.0382814445f},
-std::array<float,2>{0.927020848f, 0.505269289f},
-std::array<float,2>{0.595786095f, 0.485037386f},
-std::array<float,2>{0.437370151f, 0.751750708f},
-std::array<float,2>{0.475986451f, 0.217002213f},
-std::array<float,2>{0.535314977f, 0.725089848f},
-std::array<float,2>{0.993748903f, 0.300020337f},
-std::array<float,2>{0.0379971489f, 0.979694068f},
-std::array<float,2>{0.208565965f, 0.411524028f},
-std::array<float,2>{0.773068368f, 0.830363572f},
-std::array<float,2>{0.709307015f, 0.100817926f},
-std::array<float,2>{0.347718984f, 0.572301626f},
-std::array<float,2>{0.377590746f, 0.450313002f},
-std::array<float,2>{0.584956288f, 0.807545304f},
-std::array<float,2>{0.891753376f, 0.026349172f},
-std::array<float,2>{0.089503333f, 0.537468731f},
-std::array<float,2>{0.146540031f, 0.127790496f},
-std::array<float,2>{0.858423948f, 0.687066555f},
-std::array<float,2>{0.652041316f, 0.354497135f},
-std::array<float,2>{0.277385384f, 0.907290578f},
-std::array<float,2>{0.337206453f, 0.0659591779f},
-std::array<float,2>{0.720281661f, 0.609474897f},
-std::array<float,2>{0.787778497f, 0.375344157f},
-std::array<float,2>{0.24995251f, 0.860226154f},
-std::array<float,2>{0.00943502784f, 0.27876398f},
-std::array<float,2>{0.951133788f, 0.96839118f},
-std::array<float,2>{0.526717484f, 0.232253596f},
-std::array<float,2>{0.460106552f, 0.693605244f},
-std::array<float,2>{0.366342127f, 0.400401354f},
-std::array<float,2>{0.688200176f, 0.851162314f},
-std::array<float,2>{0.763664246f, 0.0859382898f},
-std::array<float,2>{0.197863072f, 0.602279603f},
-std::array<float,2>{0.0587501787f, 0.241697371f},
-std::array<float,2>{0.972434342f, 0.711704612f},
-std::array<float,2>{0.556755543f, 0.265600652f},
-std::array<float,2>{0.494082749f, 0.951838136f},
-std::array<float,2>{0.406388253f, 0.00318879401f},
-std::array<float,2>{0.616158903f, 0.54856497f},
-std::array<float,2>{0.912643313f, 0.456850708f},
-std::array<float,2>{0.113990605f, 0.784305096f},
-std::array<float,2>{0.157739013f, 0.36085996f},
-std::array<float,2>{0.81890285f, 0.92595607f},
-std::array<float,2>{0.66743201f, 0.141375169f},
-std::array<float,2>{0.29487586f, 0.667734265f},
-std::array<float,2>{0.449929893f, 0.287487626f},
-std::array<float,2>{0.515586615f, 0.985143483f},
-std::array<float,2>{0.96616447f, 0.188061178f},
-std::array<float,2>{0.0170056075f, 0.73617065f},
-std::array<float,2>{0.225989476f, 0.11349798f},
-std::array<float,2>{0.799883187f, 0.592049003f},
-std::array<float,2>{0.742894113f, 0.431013823f},
-std::array<float,2>{0.31553179f, 0.812749326f},
-std::array<float,2>{0.254641473f, 0.159386307f},
-std::array<float,2>{0.630798995f, 0.652638018f},
-std::array<float,2>{0.859627247f, 0.336874545f},
-std::array<float,2>{0.138409853f, 0.891640782f},
-std::array<float,2>{0.0709779561f, 0.475744963f},
-std::array<float,2>{0.885388911f, 0.773973823f},
-std::array<float,2>{0.563209593f, 0.0563372262f},
-std::array<float,2>{0.393313885f, 0.519142747f},
-std::array<float,2>{0.26523447f, 0.302666664f},
-std::array<float,2>{0.636389256f, 0.981927395f},
-std::array<float,2>{0.874814928f, 0.213098645f},
-std::array<float,2>{0.127020895f, 0.721746325f},
-std::array<float,2>{0.0696357563f, 0.0973094627f},
-std::array<float,2>{0.875631809f, 0.577722192f},
-std::array<float,2>{0.572127998f, 0.40983057f},
-std::array<float,2>{0.401228219f, 0.834608674f},
-std::array<float,2>{0.442531109f, 0.180353492f},
-std::array<float,2>{0.506014168f, 0.638049245f},
-std::array<float,2>{0.957793295f, 0.315504134f},
-std::array<float,2>{0.0287120044f, 0.889983177f},
-std::array<float,2>{0.227097452f, 0.491820782f},
-std::array<float,2>{0.807602108f, 0.754674852f},
-std::array<float,2>{0.737804711f, 0.0339317396f},
-std::array<float,2>{0.325847596f, 0.503165185f},
-std::array<float,2>{0.415831596f, 0.382226408f},
-std::array<float,2>{0.621654749f, 0.86387068f},
-std::array<float,2>{0.914693892f, 0.0672112107f},
-std::array<float,2>{0.122595526f, 0.615591824f},
-std::array<float,2>{0.168404043f, 0.229780108f},
-std::array<float,2>{0.827048123f, 0.68868494f},
-std::array<float,2>{0.663581431f, 0.274187535f},
-std::array<float,2>{0.288780689f, 0.961806357f},
-std::array<float,2>{0.367948294f, 0.0309479963f},
-std::array<float,2>{0.698386312f, 0.531332612f},
-std::array<float,2>{0.751626611f, 0.448673785f},
-std::array<float,2>{0.18829751f, 0.811883211f},
-std::array<float,2>{0.0510909259f, 0.357055247f},
-std::array<float,2>{0.982815504f, 0.912100315f},
-std::array<float,2>{0.548517644f, 0.131657243f},
-std::array<float,2>{0.484774798f, 0.683005929f},
-std::array<float,2>{0.333179802f, 0.458124369f},
-std::array<float,2>{0.733926833f, 0.788488984f},
-std::array<float,2>{0.789541841f, 0.00545854913f},
-std::array<float,2>{0.236419737f, 0.553420424f},
-std::array<float,2>{0.00705901394f, 0.147256374f},
-std::array<float,2>{0.937954843f, 0.669349968f},
-std::array<float,2>{0.518271923f, 0.365961581f},
-std::array<float,2>{0.463096708f, 0.924370706f},
-std::array<float,2>{0.387823313f, 0.0901745856f},
-std::array<float,2>{0.589437544f, 0.608363271f},
-std::array<float,2>{0.903732002f, 0.406186432f},
-std::array<float,2>{0.0824847519f, 0.846954882f},
-std::array<float,2>{0.149956822f, 0.258392692f},
-std::array<float,2>{0.846573532f, 0.948144019f},
-std::array<float,2>{0.644994259f, 0.234655246f},
-std::array<float,2>{0.270145565f, 0.715973973f},
-std::array<float,2>{0.484129965f, 0.340944856f},
-std::array<float,2>{0.543102324f, 0.896885395f},
-std::array<float,2>{0.989432156f, 0.162101924f},
-std::array<float,2>{0.0458089113f, 0.651237071f},
-std::array<float,2>{0.217505589f, 0.0616294108f},
-std::array<float,2>{0.77926451f, 0.523329437f},
-std::array<float,2>{0.716021359f, 0.471646219f},
-std::array<float,2>{0.353574216f, 0.781169891f},
-std::array<float,2>{0.312450767f, 0.194164753f},
-std::array<float,2>{0.673871994f, 0.738993526f},
-std::array<float,2>{0.83304435f, 0.283433288f},
-std::array<float,2>{0.178112745f, 0.989419043f},
-std::array<float,2>{0.107965566f, 0.434988111f},
-std::array<float,2>{0.929821491f, 0.819796979f},
-std::array<float,2>{0.603384018f, 0.110404573f},
-std::array<float,2>{0.426083654f, 0.586351931f},
-std::array<float,2>{0.346721262f, 0.369049847f},
-std::array<float,2>{0.706575334f, 0.93614006f},
-std::array<float,2>{0.768651366f, 0.150204599f},
-std::array<float,2>{0.204768762f, 0.656523228f},
-std::array<float,2>{0.0348686539f, 0.0155816488f},
-std::array<float,2>{0.998359919f, 0.556396544f},
-std::array<float,2>{0.531834304f, 0.463275254f},
-std::array<float,2>{0.471690953f, 0.790610552f},
-std::array<float,2>{0.430808514f, 0.247706547f},
-std::array<float,2>{0.598905206f, 0.709762335f},
-std::array<float,2>{0.922287524f, 0.256499022f},
-std::array<float,2>{0.0954534188f, 0.943064928f},
-std::array<float,2>{0.181798309f, 0.397069603f},
-std::array<float,2>{0.837985516f, 0.855507612f},
-std::array<float,2>{0.685995758f, 0.0840882733f},
-std::array<float,2>{0.301027149f, 0.596061289f},
-std::array<float,2>{0.45577392f, 0.480365843f},
-std::array<float,2>{0.527601898f, 0.767758608f},
-std::array<float,2>{0.948575735f, 0.0485787876f},
-std::array<float,2>{0.0156134926f, 0.526231349f},
-std::array<float,2>{0.24375084f, 0.167378858f},
-std::array<float,2>{0.781887114f, 0.643544853f},
-std::array<float,2>{0.726014435f, 0.335453331f},
-std::array<float,2>{0.339976877f, 0.902773023f},
-std::array<float,2>{0.275030553f, 0.119949929f},
-std::array<float,2>{0.652523458f, 0.580183506f},
-std::array<float,2>{0.852814376f, 0.422912151f},
-std::array<float,2>{0.143638819f, 0.823109448f},
-std::array<float,2>{0.0914456397f, 0.289082974f},
-std::array<float,2>{0.897403598f, 0.992734194f},
-std::array<float,2>{0.579767168f, 0.196115747f},
-std::array<float,2>{0.379570127f, 0.747353196f},
-std::array<float,2>{0.29127562f, 0.415458471f},
-std::array<float,2>{0.670400143f, 0.840774417f},
-std::array<float,2>{0.814564645f, 0.104637846f},
-std::array<float,2>{0.162699297f, 0.564983428f},
-std::array<float,2>{0.110832833f, 0.208245873f},
-std::array<float,2>{0.909780145f, 0.731407821f},
-std::array<float,2>{0.610895872f, 0.311427265f},
-std::array<float,2>{0.41135937f, 0.969670832f},
-std::array<float,2>{0.499048442f, 0.0463434756f},
-std::array<float,2>{0.559072793f, 0.510863066f},
-std::array<float,2>{0.975811958f, 0.495153189f},
-std::array<float,2>{0.0583893731f, 0.761760473f},
-std::array<float,2>{0.200402483f, 0.32508105f},
-std::array<float,2>{0.760387838f, 0.878258765f},
-std::array<float,2>{0.695096672f, 0.178508103f},
-std::array<float,2>{0.361714154f, 0.628381193f},
-std::array<float,2>{0.397962898f, 0.267684817f},
-std::array<float,2>{0.56770277f, 0.955407977f},
-std::array<float,2>{0.890434206f, 0.225125059f},
-std::array<float,2>{0.075629957f, 0.696874022f},
-std::array<float,2>{0.136183187f, 0.0760245472f},
-std::array<float,2>{0.864107549f, 0.622010112f},
-std::array<float,2>{0.628126621f, 0.387515783f},
-std::array<float,2>{0.251736522f, 0.870718539f},
-std::array<float,2>{0.317741662f, 0.13438502f},
-std::array<float,2>{0.747757494f, 0.674937308f},
-std::array<float,2>{0.80099529f, 0.344054788f},
-std::array<float,2>{0.22111614f, 0.914428473f},
-std::array<float,2>{0.0196000095f, 0.439243972f},
-std::array<float,2>{0.963244021f, 0.796939671f},
-std::array<float,2>{0.508321941f, 0.018131705f},
-std::array<float,2>{0.447165817f, 0.542529583f},
-std::array<float,2>{0.359344035f, 0.272588432f},
-std::array<float,2>{0.712522089f, 0.958187997f},
-std::array<float,2>{0.775782168f, 0.219522044f},
-std::array<float,2>{0.212386876f, 0.701048076f},
-std::array<float,2>{0.0424148105f, 0.072530888f},
-std::array<float,2>{0.98795563f, 0.618107319f},
-std::array<float,2>{0.54294771f, 0.384339303f},
-std::array<float,2>{0.477898329f, 0.871832132f},
-std::array<float,2>{0.424421906f, 0.138553873f},
-std::array<float,2>{0.609021068f, 0.675803483f},
-std::array<float,2>{0.936897576f, 0.349761695f},
-std::array<float,2>{0.104405113f, 0.920911968f},
-std::array<float,2>{0.1722541f, 0.444039017f},
-std::array<float,2>{0.831628442f, 0.802021682f},
-std::array<float,2>{0.678511441f, 0.0197009556f},
-std::array<float,2>{0.306830913f, 0.545987606f},
-std::array<float,2>{0.468492419f, 0.418946505f},
-std::array<float,2>{0.523264229f, 0.835940719f},
-std::array<float,2>{0.944153965f, 0.106494859f},
-std::array<float,2>{0.00386733236f, 0.568722725f},
-std::array<float,2>{0.240933463f, 0.204769656f},
-std::array<float,2>{0.79620111f, 0.728476584f},
-std::array<float,2>{0.729333818f, 0.307673275f},
-std::array<float,2>{0.328784972f, 0.975460291f},
-std::array<float,2>{0.269175202f, 0.042216748f},
-std::array<float,2>{0.641600311f, 0.512025476f},
-std::array<float,2>{0.850600481f, 0.49969095f},
-std::array<float,2>{0.154415667f, 0.759595335f},
-std::array<float,2>{0.0793888569f, 0.320565909f},
-std::array<float,2>{0.900755465f, 0.880438387f},
-std::array<float,2>{0.592579782f, 0.175011992f},
-std::array<float,2>{0.38488546f, 0.629363894f},
-std::array<float,2>{0.28492263f, 0.481965899f},
-std::array<float,2>{0.656935334f, 0.771634996f},
-std::array<float,2>{0.823059499f, 0.0531859286f},
-std::array<float,2>{0.16610682f, 0.528492093f},
-std::array<float,2>{0.119434156f, 0.169140309f},
-std::array<float,2>{0.921429336f, 0.647902966f},
-std::array<float,2>{0.620017767f, 0.32821551f},
-std::array<float,2>{0.418827057f, 0.901067376f},
-std::array<float,2>{0.491458654f, 0.124112099f},
-std::array<float,2>{0.553176284f, 0.58270067f},
-std::array<float,2>{0.979223669f, 0.428530395f},
-std::array<float,2>{0.0474479608f, 0.825370848f},
-std::array<float,2>{0.194981217f, 0.293490171f},
-std::array<float,2>{0.754018724f, 0.999835551f},
-std::array<float,2>{0.699328482f, 0.200878397f},
-std::array<float,2>{0.373573542f, 0.743951559f},
-std::array<float,2>{0.403305918f, 0.372205287f},
-std::array<float,2>{0.577066898f, 0.930290818f},
-std::array<float,2>{0.879542291f, 0.15372178f},
-std::array<float,2>{0.0644455701f, 0.660561323f},
-std::array<float,2>{0.132070377f, 0.0116784554f},
-std::array<float,2>{0.868486941f, 0.561862111f},
-std::array<float,2>{0.638487935f, 0.468368351f},
-std::array<float,2>{0.260982007f, 0.793800592f},
-std::array<float,2>{0.320723921f, 0.243497759f},
-std::array<float,2>{0.739084244f, 0.705493391f},
-std::array<float,2>{0.810458243f, 0.253109902f},
-std::array<float,2>{0.23087278f, 0.937765658f},
-std::array<float,2>{0.0251369998f, 0.393681049f},
-std::array<float,2>{0.955718398f, 0.853041947f},
-std::array<float,2>{0.50005579f, 0.0792956129f},
-std::array<float,2>{0.440324605f, 0.598967254f},
-std::array<float,2>{0.256719023f, 0.337600172f},
-std::array<float,2>{0.631082714f, 0.890752077f},
-std::array<float,2>{0.86278826f, 0.158708349f},
-std::array<float,2>{0.139565662f, 0.653594494f},
-std::array<float,2>{0.0728036091f, 0.0554070137f},
-std::array<float,2>{0.883569479f, 0.518310964f},
-std::array<float,2>{0.566144705f, 0.475360096f},
-std::array<float,2>{0.392454147f, 0.775322914f},
-std::array<float,2>{0.452624321f, 0.189356282f},
-std::array<float,2>{0.512144625f, 0.73453474f},
-std::array<float,2>{0.968231678f, 0.288913161f},
-std::array<float,2>{0.0190239083f, 0.98583895f},
-std::array<float,2>{0.223399445f, 0.430356145f},
-std::array<float,2>{0.797818065f, 0.81414032f},
-std::array<float,2>{0.745993853f, 0.114623263f},
-std::array<float,2>{0.313015968f, 0.593572795f},
-std::array<float,2>{0.409603268f, 0.455505818f},
-std::array<float,2>{0.614305258f, 0.783582747f},
-std::array<float,2>{0.911889076f, 0.00197631842f},
-std::array<float,2>{0.116111636f, 0.547774434f},
-std::array<float,2>{0.15986155f, 0.14199394f},
-std::array<float,2>{0.818197787f, 0.666859627f},
-std::array<float,2>{0.664197981f, 0.359953821f},
-std::array<float,2>{0.296673357f, 0.927444637f},
-std::array<float,2>{0.363469154f, 0.0874535143f},
-std::array<float,2>{0.691353083f, 0.603039622f},
-std::array<float,2>{0.764837682f, 0.401933461f},
-std::array<float,2>{0.196403757f, 0.849820554f},
-std::array<float,2>{0.0616232604f, 0.264268816f},
-std::array<float,2>{0.969420552f, 0.952433467f},
-std::array<float,2>{0.55484128f, 0.240618512f},
-std::array<float,2>{0.495565265f, 0.712835789f},
-std::array<float,2>{0.33843109f, 0.37662819f},
-std::array<float,2>{0.722419024f, 0.860986412f},
-std::array<float,2>{0.787103415f, 0.0652381256f},
-std::array<float,2>{0.24787505f, 0.611076176f},
-std::array<float,2>{0.00996413175f, 0.230868638f},
-std::array<float,2>{0.95239234f, 0.694809854f},
-std::array<float,2>{0.523911476f, 0.277870923f},
-std::array<float,2>{0.458824664f, 0.967290282f},
-std::array<float,2>{0.375112146f, 0.0270260554f},
-std::array<float,2>{0.583673239f, 0.538247645f},
-std::array<float,2>{0.893985212f, 0.449222654f},
-std::array<float,2>{0.0866668671f, 0.807761848f},
-std::array<float,2>{0.144576386f, 0.353732497f},
-std::array<float,2>{0.85626781f, 0.906442523f},
-std::array<float,2>{0.648553967f, 0.128184974f},
-std::array<float,2>{0.281002223f, 0.685999155f},
-std::array<float,2>{0.472779423f, 0.299785376f},
-std::array<float,2>{0.539018333f, 0.979479373f},
-std::array<float,2>{0.995181739f, 0.217846543f},
-std::array<float,2>{0.0361758694f, 0.726316929f},
-std::array<float,2>{0.209707975f, 0.0999776721f},
-std::array<float,2>{0.770118833f, 0.573255181f},
-std::array<float,2>{0.708167613f, 0.410779655f},
-std::array<float,2>{0.350155413f, 0.83144629f},
-std::array<float,2>{0.298371196f, 0.186895952f},
-std::array<float,2>{0.680381715f, 0.634692848f},
-std::array<float,2>{0.841478407f, 0.318978757f},
-std::array<float,2>{0.186699033f, 0.884173214f},
-std::array<float,2>{0.0979156122f, 0.486189544f},
-std::array<float,2>{0.927844286f, 0.750276983f},
-std::array<float,2>{0.594948828f, 0.0379805639f},
-std::array<float,2>{0.433711052f, 0.504524589f},
-std::array<float,2>{0.309614211f, 0.284775317f},
-std::array<float,2>{0.673392773f, 0.988458693f},
-std::array<float,2>{0.834979832f, 0.194739342f},
-std::array<float,2>{0.176469252f, 0.739618003f},
-std::array<float,2>{0.10654062f, 0.10943725f},
-std::array<float,2>{0.932218254f, 0.587605596f},
-std::array<float,2>{0.605267644f, 0.434531689f},
-std::array<float,2>{0.429184854f, 0.818801165f},
-std::array<float,2>{0.480701745f, 0.16034691f},
-std::array<float,2>{0.545146763f, 0.652327418f},
-std::array<float,2>{0.991928399f, 0.340046316f},
-std::array<float,2>{0.0448042452f, 0.898435891f},
-std::array<float,2>{0.216664881f, 0.472540408f},
-std::array<float,2>{0.780652165f, 0.779735625f},
-std::array<float,2>{0.718073308f, 0.0606762469f},
-std::array<float,2>{0.352933168f, 0.522105396f},
-std::array<float,2>{0.389002323f, 0.404823393f},
-std::array<float,2>{0.586909533f, 0.846396625f},
-std::array<float,2>{0.904325485f, 0.0909826607f},
-std::array<float,2>{0.0842407346f, 0.609001458f},
-std::array<float,2>{0.152136937f, 0.236031428f},
-std::array<float,2>{0.845078766f, 0.715073407f},
-std::array<float,2>{0.647393823f, 0.259053826f},
-std::array<float,2>{0.27279076f, 0.948260069f},
-std::array<float,2>{0.335433811f, 0.00406605937f},
-std::array<float,2>{0.730642676f, 0.554155707f},
-std::array<float,2>{0.791092455f, 0.457256049f},
-std::array<float,2>{0.23476088f, 0.787523925f},
-std::array<float,2>{0.00456707831f, 0.366409004f},
-std::array<float,2>{0.940835834f, 0.924824417f},
-std::array<float,2>{0.517056167f, 0.147643656f},
-std::array<float,2>{0.461284429f, 0.668316722f},
-std::array<float,2>{0.370797753f, 0.447599322f},
-std::array<float,2>{0.695514917f, 0.811430693f},
-std::array<float,2>{0.7530604f, 0.0297474377f},
-std::array<float,2>{0.189801782f, 0.533151984f},
-std::array<float,2>{0.0540119931f, 0.132370874f},
-std::array<float,2>{0.982272506f, 0.682271123f},
-std::array<float,2>{0.549326003f, 0.355803609f},
-std::array<float,2>{0.488216281f, 0.91067338f},
-std::array<float,2>{0.416323215f, 0.0674493983f},
-std::array<float,2>{0.624706566f, 0.616247892f},
-std::array<float,2>{0.917019367f, 0.381820917f},
-std::array<float,2>{0.124294765f, 0.864762187f},
-std::array<float,2>{0.170748264f, 0.274950773f},
-std::array<float,2>{0.824672282f, 0.962572694f},
-std::array<float,2>{0.660362661f, 0.22896339f},
-std::array<float,2>{0.286868155f, 0.6877774f},
-std::array<float,2>{0.444558501f, 0.314640313f},
-std::array<float,2>{0.504348814f, 0.889507592f},
-std::array<float,2>{0.960047126f, 0.181611121f},
-std::array<float,2>{0.029699862f, 0.636830986f},
-std::array<float,2>{0.230364576f, 0.034667436f},
-std::array<float,2>{0.806449115f, 0.502014935f},
-std::array<float,2>{0.735879481f, 0.490830481f},
-std::array<float,2>{0.327788383f, 0.754981995f},
-std::array<float,2>{0.263112962f, 0.214368716f},
-std::array<float,2>{0.633933067f, 0.721489906f},
-std::array<float,2>{0.871517479f, 0.300819248f},
-std::array<float,2>{0.125785276f, 0.980873406f},
-std::array<float,2>{0.0664170459f, 0.408677459f},
-std::array<float,2>{0.878062606f, 0.835613132f},
-std::array<float,2>{0.57254678f, 0.0960902199f},
-std::array<float,2>{0.398454607f, 0.577057481f},
-std::array<float,2>{0.319358081f, 0.345309466f},
-std::array<float,2>{0.748981714f, 0.915386379f},
-std::array<float,2>{0.803177416f, 0.13316831f},
-std::array<float,2>{0.219775811f, 0.67406112f},
-std::array<float,2>{0.0217908919f, 0.0185882077f},
-std::array<float,2>{0.961541295f, 0.54131043f},
-std::array<float,2>{0.511224151f, 0.438411593f},
-std::array<float,2>{0.448040038f, 0.798150659f},
-std::array<float,2>{0.395677239f, 0.225748435f},
-std::array<float,2>{0.568566561f, 0.695826292f},
-std::array<float,2>{0.8881374f, 0.268628001f},
-std::array<float,2>{0.0763738379f, 0.956862509f},
-std::array<float,2>{0.133861303f, 0.387926728f},
-std::array<float,2>{0.865277469f, 0.869551361f},
-std::array<float,2>{0.626662195f, 0.0749231279f},
-std::array<float,2>{0.252461791f, 0.62298578f},
-std::array<float,2>{0.497286528f, 0.494795531f},
-std::array<float,2>{0.560638785f, 0.763020873f},
-std::array<float,2>{0.973432243f, 0.0453445055f},
-std::array<float,2>{0.0565497279f, 0.510700405f},
-std::array<float,2>{0.202869684f, 0.179312423f},
-std::array<float,2>{0.758749962f, 0.627604365f},
-std::array<float,2>{0.69284761f, 0.325820416f},
-std::array<float,2>{0.360741198f, 0.877148628f},
-std::array<float,2>{0.289195567f, 0.103647113f},
-std::array<float,2>{0.669845343f, 0.565519452f},
-std::array<float,2>{0.812604845f, 0.41412583f},
-std::array<float,2>{0.161599502f, 0.840874314f},
-std::array<float,2>{0.113009661f, 0.311685503f},
-std::array<float,2>{0.907224953f, 0.970208645f},
-std::array<float,2>{0.611790776f, 0.207052782f},
-std::array<float,2>{0.413434982f, 0.731573582f},
-std::array<float,2>{0.277288914f, 0.422687501f},
-std::array<float,2>{0.655370355f, 0.823408186f},
-std::array<float,2>{0.853997231f, 0.120704621f},
-std::array<float,2>{0.142545f, 0.582026362f},
-std::array<float,2>{0.0935015827f, 0.196400881f},
-std::array<float,2>{0.894574344f, 0.746745646f},
-std::array<float,2>{0.58153373f, 0.290837944f},
-std::array<float,2>{0.381281346f, 0.993574142f},
-std::array<float,2>{0.453619391f, 0.0472874679f},
-std::array<float,2>{0.530635178f, 0.526423931f},
-std::array<float,2>{0.945943713f, 0.478748351f},
-std::array<float,2>{0.0130654527f, 0.769092262f},
-std::array<float,2>{0.244999498f, 0.334714234f},
-std::array<float,2>{0.78358978f, 0.903869987f},
-std::array<float,2>{0.723646224f, 0.166766658f},
-std::array<float,2>{0.342587799f, 0.643957198f},
-std::array<float,2>{0.432107508f, 0.257548302f},
-std::array<float,2>{0.599612474f, 0.941500962f},
-std::array<float,2>{0.925760686f, 0.2464948f},
-std::array<float,2>{0.0968467146f, 0.710813582f},
-std::array<float,2>{0.179958224f, 0.0853290036f},
-std::array<float,2>{0.836688101f, 0.597359121f},
-std::array<float,2>{0.684185863f, 0.397833019f},
-std::array<float,2>{0.304561079f, 0.857396245f},
-std::array<float,2>{0.345461696f, 0.148532942f},
-std::array<float,2>{0.704931319f, 0.657834589f},
-std::array<float,2>{0.767245173f, 0.367515743f},
-std::array<float,2>{0.205677584f, 0.937285542f},
-std::array<float,2>{0.0327582285f, 0.464193076f},
-std::array<float,2>{0.996363401f, 0.789894164f},
-std::array<float,2>{0.534113944f, 0.0138359703f},
-std::array<float,2>{0.470082194f, 0.555603206f},
-std::array<float,2>{0.331636369f, 0.304740399f},
-std::array<float,2>{0.72782141f, 0.97370851f},
-std::array<float,2>{0.794073343f, 0.206842616f},
-std::array<float,2>{0.239530265f, 0.728820622f},
-std::array<float,2>{0.000533535844f, 0.108781688f},
-std::array<float,2>{0.942663193f, 0.567180216f},
-std::array<float,2>{0.520844042f, 0.421210736f},
-std::array<float,2>{0.465208173f, 0.83790791f},
-std::array<float,2>{0.384453952f, 0.172697231f},
-std::array<float,2>{0.590532601f, 0.630957186f},
-std::array<float,2>{0.898561358f, 0.323937088f},
-std::array<float,2>{0.0802944154f, 0.881096482f},
-std::array<float,2>{0.152558088f, 0.497271746f},
-std::array<float,2>{0.848829508f, 0.760778487f},
-std::array<float,2>{0.644195676f, 0.0394397229f},
-std::array<float,2>{0.267577648f, 0.514245093f},
-std::array<float,2>{0.480291665f, 0.386084288f},
-std::array<float,2>{0.539769471f, 0.874061227f},
-std::array<float,2>{0.985392392f, 0.0713342428f},
-std::array<float,2>{0.0400253907f, 0.620639622f},
-std::array<float,2>{0.214804679f, 0.220893174f},
-std::array<float,2>{0.774611473f, 0.702503085f},
-std::array<float,2>{0.714649856f, 0.269642681f},
-std::array<float,2>{0.356166899f, 0.959134698f},
-std::array<float,2>{0.305093318f, 0.0231835619f},
-std::array<float,2>{0.676178098f, 0.543819129f},
-std::array<float,2>{0.828923404f, 0.443203747f},
-std::array<float,2>{0.174550399f, 0.804353535f},
-std::array<float,2>{0.102934562f, 0.34854272f},
-std::array<float,2>{0.934444189f, 0.919155419f},
-std::array<float,2>{0.606133938f, 0.139726728f},
-std::array<float,2>{0.422346503f, 0.678860426f},
-std::array<float,2>{0.258725256f, 0.465287894f},
-std::array<float,2>{0.639828324f, 0.795640469f},
-std::array<float,2>{0.869440377f, 0.00970131624f},
-std::array<float,2>{0.129019395f, 0.55889833f},
-std::array<float,2>{0.0648580492f, 0.156035751f},
-std::array<float,2>{0.882119656f, 0.66225493f},
-std::array<float,2>{0.57527107f, 0.373864442f},
-std::array<float,2>{0.405195981f, 0.931971252f},
-std::array<float,2>{0.439038128f, 0.0800958797f},
-std::array<float,2>{0.5031932f, 0.599704683f},
-std::array<float,2>{0.953983784f, 0.391993076f},
-std::array<float,2>{0.0256967805f, 0.85351944f},
-std::array<float,2>{0.232822523f, 0.251848578f},
-std::array<float,2>{0.811281919f, 0.940110803f},
-std::array<float,2>{0.741391957f, 0.244359061f},
-std::array<float,2>{0.323263884f, 0.703489542f},
-std::array<float,2>{0.420201123f, 0.331665546f},
-std::array<float,2>{0.61792624f, 0.899609506f},
-std::array<float,2>{0.918742239f, 0.170366332f},
-std::array<float,2>{0.117475435f, 0.645752311f},
-std::array<float,2>{0.164927885f, 0.0517973974f},
-std::array<float,2>{0.821062624f, 0.531100512f},
-std::array<float,2>{0.659781337f, 0.4825809f},
-std::array<float,2>{0.281919628f, 0.770252109f},
-std::array<float,2>{0.372048289f, 0.202663869f},
-std::array<float,2>{0.703079164f, 0.744243562f},
-std::array<float,2>{0.756934464f, 0.294985652f},
-std::array<float,2>{0.192796066f, 0.997631609f},
-std::array<float,2>{0.0491824746f, 0.426514208f},
-std::array<float,2>{0.978473127f, 0.826507509f},
-std::array<float,2>{0.552417457f, 0.121643417f},
-std::array<float,2>{0.488652885f, 0.585230052f},
-std::array<float,2>{0.293058515f, 0.362270355f},
-std::array<float,2>{0.666831374f, 0.929100871f},
-std::array<float,2>{0.819383085f, 0.143965662f},
-std::array<float,2>{0.156662509f, 0.664124429f},
-std::array<float,2>{0.114960462f, 0.000829593628f},
-std::array<float,2>{0.913668275f, 0.550445855f},
-std::array<float,2>{0.61645782f, 0.455072582f},
-std::array<float,2>{0.407752812f, 0.781468511f},
-std::array<float,2>{0.493057698f, 0.239967495f},
-std::array<float,2>{0.55846262f, 0.714021087f},
-std::array<float,2>{0.971473515f, 0.263597071f},
-std::array<float,2>{0.0596239753f, 0.950006604f},
-std::array<float,2>{0.198319405f, 0.399998844f},
-std::array<float,2>{0.761800468f, 0.848828793f},
-std::array<float,2>{0.689059734f, 0.0882548839f},
-std::array<float,2>{0.365630358f, 0.604646325f},
-std::array<float,2>{0.3941558f, 0.473534733f},
-std::array<float,2>{0.56396991f, 0.777158916f},
-std::array<float,2>{0.886074841f, 0.0570312776f},
-std::array<float,2>{0.0717255324f, 0.516647696f},
-std::array<float,2>{0.137272581f, 0.157442704f},
-std::array<float,2>{0.860780537f, 0.655856431f},
-std::array<float,2>{0.628975213f, 0.339632362f},
-std::array<float,2>{0.254903823f, 0.893352211f},
-std::array<float,2>{0.315414518f, 0.116722398f},
-std::array<float,2>{0.743173718f, 0.590879202f},
-std::array<float,2>{0.79964143f, 0.431954533f},
-std::array<float,2>{0.224843919f, 0.815622628f},
-std::array<float,2>{0.0158208013f, 0.285559177f},
-std::array<float,2>{0.965230703f, 0.987807512f},
-std::array<float,2>{0.514256418f, 0.191075385f},
-std::array<float,2>{0.450985312f, 0.737705231f},
-std::array<float,2>{0.349183202f, 0.412159383f},
-std::array<float,2>{0.710756779f, 0.828702271f},
-std::array<float,2>{0.772205114f, 0.0979857221f},
-std::array<float,2>{0.207780555f, 0.570878446f},
-std::array<float,2>{0.0383473486f, 0.216645509f},
-std::array<float,2>{0.992788851f, 0.724007726f},
-std::array<float,2>{0.536490738f, 0.297278166f},
-std::array<float,2>{0.47557047f, 0.97828728f},
-std::array<float,2>{0.436430156f, 0.0354983322f},
-std::array<float,2>{0.597179532f, 0.507044673f},
-std::array<float,2>{0.926424086f, 0.487575889f},
-std::array<float,2>{0.0999805257f, 0.753671169f},
-std::array<float,2>{0.185053855f, 0.317464054f},
-std::array<float,2>{0.843093276f, 0.885738134f},
-std::array<float,2>{0.682234943f, 0.183868796f},
-std::array<float,2>{0.300470144f, 0.635718882f},
-std::array<float,2>{0.459031969f, 0.280070126f},
-std::array<float,2>{0.525643885f, 0.965963781f},
-std::array<float,2>{0.949920177f, 0.232899979f},
-std::array<float,2>{0.00845268834f, 0.69334209f},
-std::array<float,2>{0.24901934f, 0.0637686476f},
-std::array<float,2>{0.788956344f, 0.612064958f},
-std::array<float,2>{0.719495177f, 0.378731281f},
-std::array<float,2>{0.336130202f, 0.861562669f},
-std::array<float,2>{0.278796852f, 0.125259131f},
-std::array<float,2>{0.650861681f, 0.684239984f},
-std::array<float,2>{0.85761708f, 0.352727026f},
-std::array<float,2>{0.148239747f, 0.908413649f},
-std::array<float,2>{0.0883772224f, 0.452959061f},
-std::array<float,2>{0.890829444f, 0.805619419f},
-std::array<float,2>{0.585148692f, 0.0237088911f},
-std::array<float,2>{0.378479242f, 0.535434902f},
-std::array<float,2>{0.270826846f, 0.261461467f},
-std::array<float,2>{0.645819366f, 0.945570409f},
-std::array<float,2>{0.84681654f, 0.237841487f},
-std::array<float,2>{0.148516238f, 0.718349159f},
-std::array<float,2>{0.0832984522f, 0.093593888f},
-std::array<float,2>{0.902791083f, 0.60641557f},
-std::array<float,2>{0.588802457f, 0.403046459f},
-std::array<float,2>{0.387140244f, 0.845120609f},
-std::array<float,2>{0.464291751f, 0.144977376f},
-std::array<float,2>{0.518765271f, 0.670713782f},
-std::array<float,2>{0.938685894f, 0.36381036f},
-std::array<float,2>{0.00590145681f, 0.923487306f},
-std::array<float,2>{0.237635151f, 0.460267574f},
-std::array<float,2>{0.790067255f, 0.786044002f},
-std::array<float,2>{0.732833445f, 0.00602673786f},
-std::array<float,2>{0.332422256f, 0.551552594f},
-std::array<float,2>{0.426811516f, 0.437425941f},
-std::array<float,2>{0.601707041f, 0.816911221f},
-std::array<float,2>{0.930949867f, 0.11228285f},
-std::array<float,2>{0.108553275f, 0.587993085f},
-std::array<float,2>{0.178729907f, 0.191514984f},
-std::array<float,2>{0.832830012f, 0.740930378f},
-std::array<float,2>{0.675577939f, 0.283111155f},
-std::array<float,2>{0.310617447f, 0.990493953f},
-std::array<float,2>{0.354537725f, 0.0605157241f},
-std::array<float,2>{0.715444148f, 0.521141469f},
-std::array<float,2>{0.777828336f, 0.46953997f},
-std::array<float,2>{0.218263566f, 0.778472126f},
-std::array<float,2>{0.0462240167f, 0.34186095f},
-std::array<float,2>{0.988427997f, 0.895153701f},
-std::array<float,2>{0.544807911f, 0.162259743f},
-std::array<float,2>{0.482620984f, 0.648794293f},
-std::array<float,2>{0.325109243f, 0.488893479f},
-std::array<float,2>{0.736423135f, 0.757714808f},
-std::array<float,2>{0.808490753f, 0.0329288654f},
-std::array<float,2>{0.227830097f, 0.500387728f},
-std::array<float,2>{0.0277463607f, 0.181642547f},
-std::array<float,2>{0.958584011f, 0.640192568f},
-std::array<float,2>{0.507173955f, 0.313294977f},
-std::array<float,2>{0.442185014f, 0.888109744f},
-std::array<float,2>{0.401839525f, 0.0941781178f},
-std::array<float,2>{0.570374727f, 0.575639665f},
-std::array<float,2>{0.876362383f, 0.40784654f},
-std::array<float,2>{0.0685143173f, 0.832746327f},
-std::array<float,2>{0.128430754f, 0.304211229f},
-std::array<float,2>{0.87350136f, 0.982900918f},
-std::array<float,2>{0.635498583f, 0.21230863f},
-std::array<float,2>{0.263756692f, 0.718971908f},
-std::array<float,2>{0.48575449f, 0.358492017f},
-std::array<float,2>{0.547047555f, 0.913398266f},
-std::array<float,2>{0.984141409f, 0.130288497f},
-std::array<float,2>{0.0524199679f, 0.680914342f},
-std::array<float,2>{0.188677549f, 0.0284512676f},
-std::array<float,2>{0.750042498f, 0.533571064f},
-std::array<float,2>{0.697999358f, 0.447213322f},
-std::array<float,2>{0.36848411f, 0.808788657f},
-std::array<float,2>{0.288051039f, 0.228341341f},
-std::array<float,2>{0.662644506f, 0.690226018f},
-std::array<float,2>{0.827953517f, 0.276046664f},
-std::array<float,2>{0.169566974f, 0.963605046f},
-std::array<float,2>{0.121438429f, 0.380598396f},
-std::array<float,2>{0.915900826f, 0.866307378f},
-std::array<float,2>{0.622202396f, 0.0696865544f},
-std::array<float,2>{0.414555818f, 0.614327967f},
-std::array<float,2>{0.36324966f, 0.326459229f},
-std::array<float,2>{0.693738997f, 0.875857353f},
-std::array<float,2>{0.761566877f, 0.176120907f},
-std::array<float,2>{0.199718565f, 0.62511915f},
-std::array<float,2>{0.0573086813f, 0.0439560041f},
-std::array<float,2>{0.975362301f, 0.507938504f},
-std::array<float,2>{0.560220778f, 0.493821383f},
-std::array<float,2>{0.49825865f, 0.763905048f},
-std::array<float,2>{0.410407454f, 0.209609538f},
-std::array<float,2>{0.610131323f, 0.733594537f},
-std::array<float,2>{0.909138441f, 0.309418529f},
-std::array<float,2>{0.109785505f, 0.971628129f},
-std::array<float,2>{0.163089335f, 0.416476756f},
-std::array<float,2>{0.815797746f, 0.842708409f},
-std::array<float,2>{0.671259403f, 0.102559797f},
-std::array<float,2>{0.292527676f, 0.564213932f},
-std::array<float,2>{0.44546771f, 0.440104157f},
-std::array<float,2>{0.509641111f, 0.800374985f},
-std::array<float,2>{0.964658201f, 0.0160821769f},
-std::array<float,2>{0.0207683798f, 0.540884376f},
-std::array<float,2>{0.221926868f, 0.134940818f},
-std::array<float,2>{0.801970899f, 0.672174811f},
-std::array<float,2>{0.746922553f, 0.346185237f},
-std::array<float,2>{0.316497833f, 0.917430043f},
-std::array<float,2>{0.25029853f, 0.076362662f},
-std::array<float,2>{0.626997173f, 0.624661624f},
-std::array<float,2>{0.864923775f, 0.390424401f},
-std::array<float,2>{0.135259971f, 0.867504001f},
-std::array<float,2>{0.0744557902f, 0.266779214f},
-std::array<float,2>{0.889115274f, 0.953307748f},
-std::array<float,2>{0.566754401f, 0.223455206f},
-std::array<float,2>{0.397328913f, 0.697984159f},
-std::array<float,2>{0.302029908f, 0.395467192f},
-std::array<float,2>{0.68695116f, 0.859351814f},
-std::array<float,2>{0.839799345f, 0.0826637596f},
-std::array<float,2>{0.182745948f, 0.594175041f},
-std::array<float,2>{0.0947240144f, 0.248790458f},
-std::array<float,2>{0.923813999f, 0.707495809f},
-std::array<float,2>{0.598376334f, 0.2549496f},
-std::array<float,2>{0.430021673f, 0.944522679f},
-std::array<float,2>{0.471136004f, 0.0129521554f},
-std::array<float,2>{0.532335579f, 0.558139324f},
-std::array<float,2>{0.999728262f, 0.462421894f},
-std::array<float,2>{0.0334954672f, 0.79160285f},
-std::array<float,2>{0.203662857f, 0.369805396f},
-std::array<float,2>{0.768386424f, 0.934634745f},
-std::array<float,2>{0.705520511f, 0.150817081f},
-std::array<float,2>{0.345993608f, 0.658742368f},
-std::array<float,2>{0.380079091f, 0.291446298f},
-std::array<float,2>{0.578927994f, 0.994163692f},
-std::array<float,2>{0.898374677f, 0.198908135f},
-std::array<float,2>{0.0907088742f, 0.74809736f},
-std::array<float,2>{0.14267303f, 0.117772289f},
-std::array<float,2>{0.852367342f, 0.578354061f},
-std::array<float,2>{0.653972983f, 0.423978239f},
-std::array<float,2>{0.27346015f, 0.82123208f},
-std::array<float,2>{0.341589123f, 0.164905712f},
-std::array<float,2>{0.724686623f, 0.641721666f},
-std::array<float,2>{0.782357752f, 0.332662106f},
-std::array<float,2>{0.242272615f, 0.904637456f},
-std::array<float,2>{0.0145274056f, 0.477179348f},
-std::array<float,2>{0.947771847f, 0.767161131f},
-std::array<float,2>{0.529023886f, 0.0497286655f},
-std::array<float,2>{0.456754208f, 0.5239079f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.31030646f, 0.87032491f},
-std::array<float,2>{0.898898721f, 0.152744353f},
-std::array<float,2>{0.209271953f, 0.316476107f},
-std::array<float,2>{0.606181622f, 0.686749637f},
-std::array<float,2>{0.0880403146f, 0.571064651f},
-std::array<float,2>{0.703883529f, 0.380560905f},
-std::array<float,2>{0.49835372f, 0.118785515f},
-std::array<float,2>{0.837359786f, 0.917845726f},
-std::array<float,2>{0.404798687f, 0.695318341f},
-std::array<float,2>{0.753450274f, 0.259894311f},
-std::array<float,2>{0.012416509f, 0.201054201f},
-std::array<float,2>{0.644178867f, 0.754397988f},
-std::array<float,2>{0.183985904f, 0.956310332f},
-std::array<float,2>{0.54821831f, 0.0608990155f},
-std::array<float,2>{0.31324178f, 0.466885924f},
-std::array<float,2>{0.970270753f, 0.546908498f},
-std::array<float,2>{0.461529553f, 0.883989453f},
-std::array<float,2>{0.860683084f, 0.0831502602f},
-std::array<float,2>{0.0962641239f, 0.415540338f},
-std::array<float,2>{0.747348368f, 0.611432552f},
-std::array<float,2>{0.244120136f, 0.641557157f},
-std::array<float,2>{0.567903817f, 0.35298264f},
-std::array<float,2>{0.267434597f, 0.181572437f},
-std::array<float,2>{0.928227663f, 0.83850944f},
-std::array<float,2>{0.370624214f, 0.50091964f},
-std::array<float,2>{0.955922604f, 0.48576957f},
-std::array<float,2>{0.135459095f, 0.0126615483f},
-std::array<float,2>{0.504761875f, 0.978632569f},
-std::array<float,2>{0.0330289453f, 0.788444519f},
-std::array<float,2>{0.669314146f, 0.222610533f},
-std::array<float,2>{0.425576329f, 0.304950595f},
-std::array<float,2>{0.807675302f, 0.72941041f},
-std::array<float,2>{0.330036074f, 0.989856541f},
-std::array<float,2>{0.996165931f, 0.0296832323f},
-std::array<float,2>{0.158605009f, 0.472138703f},
-std::array<float,2>{0.543614149f, 0.516403377f},
-std::array<float,2>{0.0303481724f, 0.74187851f},
-std::array<float,2>{0.630981326f, 0.292514354f},
-std::array<float,2>{0.389235646f, 0.242318317f},
-std::array<float,2>{0.77275598f, 0.801760912f},
-std::array<float,2>{0.479722619f, 0.596769512f},
-std::array<float,2>{0.816368759f, 0.427463979f},
-std::array<float,2>{0.0734765679f, 0.0642707646f},
-std::array<float,2>{0.689231634f, 0.902147651f},
-std::array<float,2>{0.195681214f, 0.823749602f},
-std::array<float,2>{0.621841252f, 0.170551345f},
-std::array<float,2>{0.295308977f, 0.359713137f},
-std::array<float,2>{0.882650614f, 0.628218412f},
-std::array<float,2>{0.418148488f, 0.77292496f},
-std::array<float,2>{0.789550126f, 0.212354898f},
-std::array<float,2>{0.0542341918f, 0.269590259f},
-std::array<float,2>{0.681347728f, 0.711761475f},
-std::array<float,2>{0.151183695f, 0.541554451f},
-std::array<float,2>{0.52854836f, 0.44494915f},
-std::array<float,2>{0.345386535f, 0.040478617f},
-std::array<float,2>{0.948879898f, 0.94400388f},
-std::array<float,2>{0.251249731f, 0.664868653f},
-std::array<float,2>{0.921767831f, 0.331498802f},
-std::array<float,2>{0.22707206f, 0.131438643f},
-std::array<float,2>{0.579102457f, 0.852357805f},
-std::array<float,2>{0.124922015f, 0.936518192f},
-std::array<float,2>{0.732579947f, 0.102755196f},
-std::array<float,2>{0.452210456f, 0.396879792f},
-std::array<float,2>{0.848999798f, 0.579782426f},
-std::array<float,2>{0.354589164f, 0.809435606f},
-std::array<float,2>{0.944198966f, 0.237805098f},
-std::array<float,2>{0.147475526f, 0.285766214f},
-std::array<float,2>{0.519600809f, 0.746181428f},
-std::array<float,2>{0.0580494665f, 0.52750057f},
-std::array<float,2>{0.679119051f, 0.482603908f},
-std::array<float,2>{0.408076972f, 0.0225020573f},
-std::array<float,2>{0.78669548f, 0.999677002f},
-std::array<float,2>{0.443717718f, 0.634979427f},
-std::array<float,2>{0.851972818f, 0.37477842f},
-std::array<float,2>{0.115908481f, 0.160339743f},
-std::array<float,2>{0.724101007f, 0.817142129f},
-std::array<float,2>{0.224702537f, 0.892861307f},
-std::array<float,2>{0.586589873f, 0.0716011971f},
-std::array<float,2>{0.25958699f, 0.434928209f},
-std::array<float,2>{0.912479997f, 0.60449028f},
-std::array<float,2>{0.377747893f, 0.952356696f},
-std::array<float,2>{0.774083197f, 0.0348293819f},
-std::array<float,2>{0.0217331052f, 0.446237117f},
-std::array<float,2>{0.638940871f, 0.535119295f},
-std::array<float,2>{0.168972522f, 0.70554322f},
-std::array<float,2>{0.537284493f, 0.274205267f},
-std::array<float,2>{0.337921172f, 0.208998218f},
-std::array<float,2>{0.986609161f, 0.77803731f},
-std::array<float,2>{0.281505764f, 0.589930713f},
-std::array<float,2>{0.890215874f, 0.398997754f},
-std::array<float,2>{0.195188537f, 0.0968074724f},
-std::array<float,2>{0.616532147f, 0.924645424f},
-std::array<float,2>{0.063840881f, 0.847418308f},
-std::array<float,2>{0.696918726f, 0.138664305f},
-std::array<float,2>{0.473954797f, 0.336515129f},
-std::array<float,2>{0.825679839f, 0.663122118f},
-std::array<float,2>{0.279466897f, 0.911046982f},
-std::array<float,2>{0.934553266f, 0.112940043f},
-std::array<float,2>{0.241171613f, 0.386829346f},
-std::array<float,2>{0.574037313f, 0.565111995f},
-std::array<float,2>{0.108998284f, 0.671996355f},
-std::array<float,2>{0.738896608f, 0.32313031f},
-std::array<float,2>{0.455079228f, 0.144783139f},
-std::array<float,2>{0.867622793f, 0.86474663f},
-std::array<float,2>{0.436388433f, 0.561835945f},
-std::array<float,2>{0.800995231f, 0.457288772f},
-std::array<float,2>{0.0421019085f, 0.0491804071f},
-std::array<float,2>{0.660859764f, 0.966446757f},
-std::array<float,2>{0.126953214f, 0.763594508f},
-std::array<float,2>{0.511490643f, 0.194630966f},
-std::array<float,2>{0.366301388f, 0.252355337f},
-std::array<float,2>{0.963799477f, 0.69337976f},
-std::array<float,2>{0.488611579f, 0.831365824f},
-std::array<float,2>{0.832251728f, 0.179166704f},
-std::array<float,2>{0.0812852085f, 0.349628627f},
-std::array<float,2>{0.713339865f, 0.648937821f},
-std::array<float,2>{0.216393933f, 0.624806046f},
-std::array<float,2>{0.595062912f, 0.410964429f},
-std::array<float,2>{0.300482601f, 0.0884651542f},
-std::array<float,2>{0.895482063f, 0.8809551f},
-std::array<float,2>{0.321254075f, 0.719640613f},
-std::array<float,2>{0.983488917f, 0.300109684f},
-std::array<float,2>{0.175892442f, 0.227434635f},
-std::array<float,2>{0.561730742f, 0.794925928f},
-std::array<float,2>{0.000563311449f, 0.971930683f},
-std::array<float,2>{0.648861825f, 0.000199673581f},
-std::array<float,2>{0.394951433f, 0.496794075f},
-std::array<float,2>{0.762699425f, 0.513443589f},
-std::array<float,2>{0.263857603f, 0.751914084f},
-std::array<float,2>{0.907801628f, 0.197405383f},
-std::array<float,2>{0.22147043f, 0.264108807f},
-std::array<float,2>{0.592960477f, 0.702207923f},
-std::array<float,2>{0.111345537f, 0.553238451f},
-std::array<float,2>{0.722444832f, 0.460952103f},
-std::array<float,2>{0.439551622f, 0.0562166981f},
-std::array<float,2>{0.855551064f, 0.958805263f},
-std::array<float,2>{0.412864476f, 0.682396829f},
-std::array<float,2>{0.781265616f, 0.314237267f},
-std::array<float,2>{0.0600314625f, 0.150835574f},
-std::array<float,2>{0.672703564f, 0.871131718f},
-std::array<float,2>{0.142393649f, 0.918818653f},
-std::array<float,2>{0.51926893f, 0.123519331f},
-std::array<float,2>{0.358497202f, 0.378348142f},
-std::array<float,2>{0.939984918f, 0.576293588f},
-std::array<float,2>{0.468854308f, 0.983440518f},
-std::array<float,2>{0.820485115f, 0.0109863235f},
-std::array<float,2>{0.0690228269f, 0.488764912f},
-std::array<float,2>{0.702318907f, 0.50725019f},
-std::array<float,2>{0.188759476f, 0.733312547f},
-std::array<float,2>{0.61115092f, 0.309737176f},
-std::array<float,2>{0.287877917f, 0.224450469f},
-std::array<float,2>{0.886462748f, 0.784096718f},
-std::array<float,2>{0.343021333f, 0.616426349f},
-std::array<float,2>{0.988514602f, 0.420291305f},
-std::array<float,2>{0.166136757f, 0.0808292478f},
-std::array<float,2>{0.53315264f, 0.888322413f},
-std::array<float,2>{0.0157492291f, 0.842260361f},
-std::array<float,2>{0.635984719f, 0.186095968f},
-std::array<float,2>{0.382049501f, 0.358763009f},
-std::array<float,2>{0.780735254f, 0.647468388f},
-std::array<float,2>{0.35984844f, 0.905086935f},
-std::array<float,2>{0.968159497f, 0.06642849f},
-std::array<float,2>{0.131485f, 0.424167454f},
-std::array<float,2>{0.513479173f, 0.601222813f},
-std::array<float,2>{0.046124056f, 0.631555259f},
-std::array<float,2>{0.657790244f, 0.364655882f},
-std::array<float,2>{0.430654079f, 0.166018307f},
-std::array<float,2>{0.799472988f, 0.825212419f},
-std::array<float,2>{0.459855407f, 0.523114502f},
-std::array<float,2>{0.874035239f, 0.475690246f},
-std::array<float,2>{0.104041331f, 0.0264169034f},
-std::array<float,2>{0.736017108f, 0.986001015f},
-std::array<float,2>{0.237523273f, 0.798427224f},
-std::array<float,2>{0.576855004f, 0.24849987f},
-std::array<float,2>{0.273714513f, 0.295274168f},
-std::array<float,2>{0.930821359f, 0.737637937f},
-std::array<float,2>{0.393592358f, 0.856069088f},
-std::array<float,2>{0.761440754f, 0.126620248f},
-std::array<float,2>{0.00576122105f, 0.334045529f},
-std::array<float,2>{0.654579759f, 0.670509517f},
-std::array<float,2>{0.173082083f, 0.583718598f},
-std::array<float,2>{0.55785495f, 0.391638577f},
-std::array<float,2>{0.327972114f, 0.107250586f},
-std::array<float,2>{0.978782594f, 0.930375934f},
-std::array<float,2>{0.301481426f, 0.716815829f},
-std::array<float,2>{0.89216733f, 0.268675536f},
-std::array<float,2>{0.213488668f, 0.216708243f},
-std::array<float,2>{0.597714543f, 0.768789291f},
-std::array<float,2>{0.0839889348f, 0.940116405f},
-std::array<float,2>{0.718348205f, 0.043879021f},
-std::array<float,2>{0.486673951f, 0.440991431f},
-std::array<float,2>{0.830328465f, 0.546136498f},
-std::array<float,2>{0.318507493f, 0.815101802f},
-std::array<float,2>{0.976063311f, 0.160149679f},
-std::array<float,2>{0.182704628f, 0.370312929f},
-std::array<float,2>{0.550994992f, 0.638424575f},
-std::array<float,2>{0.00909914542f, 0.607136548f},
-std::array<float,2>{0.645482898f, 0.432032317f},
-std::array<float,2>{0.401058823f, 0.0755966976f},
-std::array<float,2>{0.754690766f, 0.897761762f},
-std::array<float,2>{0.493985981f, 0.744561553f},
-std::array<float,2>{0.842687964f, 0.284811527f},
-std::array<float,2>{0.0915095732f, 0.238350302f},
-std::array<float,2>{0.708880782f, 0.807638884f},
-std::array<float,2>{0.206941143f, 0.993120253f},
-std::array<float,2>{0.603986681f, 0.0176334176f},
-std::array<float,2>{0.308435708f, 0.478480905f},
-std::array<float,2>{0.902465284f, 0.525552928f},
-std::array<float,2>{0.428435594f, 0.927263319f},
-std::array<float,2>{0.809206009f, 0.0977931991f},
-std::array<float,2>{0.0359287262f, 0.404203713f},
-std::array<float,2>{0.665438235f, 0.587390482f},
-std::array<float,2>{0.138123095f, 0.659219146f},
-std::array<float,2>{0.500922918f, 0.34351334f},
-std::array<float,2>{0.371477395f, 0.135494649f},
-std::array<float,2>{0.959175825f, 0.851520956f},
-std::array<float,2>{0.272996277f, 0.536679804f},
-std::array<float,2>{0.923372447f, 0.452423573f},
-std::array<float,2>{0.246997729f, 0.0375038013f},
-std::array<float,2>{0.565370679f, 0.94637233f},
-std::array<float,2>{0.100165434f, 0.775357425f},
-std::array<float,2>{0.744612038f, 0.205877364f},
-std::array<float,2>{0.465451032f, 0.278099984f},
-std::array<float,2>{0.864079058f, 0.709160566f},
-std::array<float,2>{0.291468948f, 0.96182996f},
-std::array<float,2>{0.877722561f, 0.0518808737f},
-std::array<float,2>{0.19940643f, 0.453163385f},
-std::array<float,2>{0.618972182f, 0.556122959f},
-std::array<float,2>{0.0742310286f, 0.688278913f},
-std::array<float,2>{0.694755137f, 0.254696697f},
-std::array<float,2>{0.483444184f, 0.190832496f},
-std::array<float,2>{0.820009172f, 0.760868967f},
-std::array<float,2>{0.383981675f, 0.567571878f},
-std::array<float,2>{0.76897645f, 0.383976609f},
-std::array<float,2>{0.0259679817f, 0.116831362f},
-std::array<float,2>{0.625218809f, 0.910145044f},
-std::array<float,2>{0.164027065f, 0.862182081f},
-std::array<float,2>{0.541947365f, 0.143054649f},
-std::array<float,2>{0.334072948f, 0.32597509f},
-std::array<float,2>{0.995147288f, 0.67884469f},
-std::array<float,2>{0.446324915f, 0.792788029f},
-std::array<float,2>{0.845919967f, 0.234349802f},
-std::array<float,2>{0.119296826f, 0.30184105f},
-std::array<float,2>{0.730193079f, 0.725835621f},
-std::array<float,2>{0.230915695f, 0.510125995f},
-std::array<float,2>{0.582166374f, 0.493387163f},
-std::array<float,2>{0.257648259f, 0.00706787687f},
-std::array<float,2>{0.917000175f, 0.973447263f},
-std::array<float,2>{0.351403773f, 0.656000435f},
-std::array<float,2>{0.951548636f, 0.34592399f},
-std::array<float,2>{0.155023023f, 0.172636479f},
-std::array<float,2>{0.525048256f, 0.833927453f},
-std::array<float,2>{0.0504027605f, 0.876767039f},
-std::array<float,2>{0.6858657f, 0.0920217931f},
-std::array<float,2>{0.415883422f, 0.409083009f},
-std::array<float,2>{0.793911576f, 0.617821634f},
-std::array<float,2>{0.269039482f, 0.836536467f},
-std::array<float,2>{0.92726016f, 0.181957841f},
-std::array<float,2>{0.24438113f, 0.353855014f},
-std::array<float,2>{0.569594383f, 0.643167257f},
-std::array<float,2>{0.0954890102f, 0.610558331f},
-std::array<float,2>{0.749453127f, 0.416045189f},
-std::array<float,2>{0.464434713f, 0.0846170709f},
-std::array<float,2>{0.863081098f, 0.885620117f},
-std::array<float,2>{0.42299813f, 0.727199495f},
-std::array<float,2>{0.805100977f, 0.306785554f},
-std::array<float,2>{0.0335834399f, 0.219851181f},
-std::array<float,2>{0.670814633f, 0.786947072f},
-std::array<float,2>{0.13323833f, 0.9781394f},
-std::array<float,2>{0.507138014f, 0.0153085496f},
-std::array<float,2>{0.369103968f, 0.486391991f},
-std::array<float,2>{0.953316033f, 0.503781497f},
-std::array<float,2>{0.497828156f, 0.914358079f},
-std::array<float,2>{0.839526772f, 0.120763451f},
-std::array<float,2>{0.0860319436f, 0.381507605f},
-std::array<float,2>{0.706687272f, 0.573456883f},
-std::array<float,2>{0.207530275f, 0.685434043f},
-std::array<float,2>{0.607518315f, 0.319387823f},
-std::array<float,2>{0.312368274f, 0.154453322f},
-std::array<float,2>{0.901918709f, 0.868524492f},
-std::array<float,2>{0.315586954f, 0.549810827f},
-std::array<float,2>{0.971797943f, 0.465019196f},
-std::array<float,2>{0.185677618f, 0.0586885177f},
-std::array<float,2>{0.549545288f, 0.954506874f},
-std::array<float,2>{0.0151442764f, 0.757489443f},
-std::array<float,2>{0.641417086f, 0.202759951f},
-std::array<float,2>{0.402699709f, 0.259224504f},
-std::array<float,2>{0.750217259f, 0.697322488f},
-std::array<float,2>{0.347649366f, 0.94295311f},
-std::array<float,2>{0.945826769f, 0.0412530154f},
-std::array<float,2>{0.148661405f, 0.442345887f},
-std::array<float,2>{0.530687511f, 0.541009009f},
-std::array<float,2>{0.0520466492f, 0.713600338f},
-std::array<float,2>{0.682602227f, 0.271876931f},
-std::array<float,2>{0.421397448f, 0.21295917f},
-std::array<float,2>{0.791342795f, 0.770164907f},
-std::array<float,2>{0.449308991f, 0.580794811f},
-std::array<float,2>{0.850982904f, 0.395969272f},
-std::array<float,2>{0.121828102f, 0.104329482f},
-std::array<float,2>{0.732352316f, 0.935083628f},
-std::array<float,2>{0.229225695f, 0.854168057f},
-std::array<float,2>{0.580702186f, 0.130096406f},
-std::array<float,2>{0.252220184f, 0.329820961f},
-std::array<float,2>{0.918136716f, 0.667197526f},
-std::array<float,2>{0.386964351f, 0.802841842f},
-std::array<float,2>{0.771470308f, 0.244431689f},
-std::array<float,2>{0.0280550886f, 0.289849073f},
-std::array<float,2>{0.630689144f, 0.739779711f},
-std::array<float,2>{0.157422408f, 0.518286824f},
-std::array<float,2>{0.545118213f, 0.470492989f},
-std::array<float,2>{0.330919951f, 0.0290993825f},
-std::array<float,2>{0.998196244f, 0.991456211f},
-std::array<float,2>{0.294893831f, 0.626460791f},
-std::array<float,2>{0.879548252f, 0.362473011f},
-std::array<float,2>{0.198945135f, 0.169196129f},
-std::array<float,2>{0.62325871f, 0.821403265f},
-std::array<float,2>{0.0721454769f, 0.899292469f},
-std::array<float,2>{0.690879881f, 0.0649291426f},
-std::array<float,2>{0.477946728f, 0.429437786f},
-std::array<float,2>{0.813762605f, 0.594346762f},
-std::array<float,2>{0.336973727f, 0.779762805f},
-std::array<float,2>{0.984645605f, 0.208755821f},
-std::array<float,2>{0.170850441f, 0.276936412f},
-std::array<float,2>{0.537029743f, 0.704687655f},
-std::array<float,2>{0.0203648023f, 0.533150196f},
-std::array<float,2>{0.636815727f, 0.447398484f},
-std::array<float,2>{0.376137346f, 0.0323814265f},
-std::array<float,2>{0.775517821f, 0.94966805f},
-std::array<float,2>{0.475919873f, 0.661250472f},
-std::array<float,2>{0.827606857f, 0.338404804f},
-std::array<float,2>{0.0650932118f, 0.140054509f},
-std::array<float,2>{0.69844234f, 0.845207095f},
-std::array<float,2>{0.192148253f, 0.922213018f},
-std::array<float,2>{0.61454469f, 0.0952675268f},
-std::array<float,2>{0.2850914f, 0.40045324f},
-std::array<float,2>{0.886961937f, 0.592307746f},
-std::array<float,2>{0.4090873f, 0.99703896f},
-std::array<float,2>{0.787519455f, 0.0205679014f},
-std::array<float,2>{0.0563273281f, 0.481946081f},
-std::array<float,2>{0.676880002f, 0.530458391f},
-std::array<float,2>{0.146024927f, 0.748057783f},
-std::array<float,2>{0.521580637f, 0.288035333f},
-std::array<float,2>{0.352534652f, 0.235217482f},
-std::array<float,2>{0.942141473f, 0.81064564f},
-std::array<float,2>{0.260073215f, 0.603126645f},
-std::array<float,2>{0.911332011f, 0.436757594f},
-std::array<float,2>{0.224412814f, 0.0723988563f},
-std::array<float,2>{0.589341342f, 0.891881108f},
-std::array<float,2>{0.113663591f, 0.819107533f},
-std::array<float,2>{0.725353658f, 0.162721619f},
-std::array<float,2>{0.441420376f, 0.372995228f},
-std::array<float,2>{0.853701174f, 0.633950353f},
-std::array<float,2>{0.298257738f, 0.879770041f},
-std::array<float,2>{0.897666574f, 0.0867043138f},
-std::array<float,2>{0.21706742f, 0.412176609f},
-std::array<float,2>{0.596115232f, 0.62223798f},
-std::array<float,2>{0.0785400569f, 0.65129602f},
-std::array<float,2>{0.711306453f, 0.348771662f},
-std::array<float,2>{0.490576893f, 0.175843716f},
-std::array<float,2>{0.835597634f, 0.829832554f},
-std::array<float,2>{0.396723241f, 0.514547884f},
-std::array<float,2>{0.763873339f, 0.498740792f},
-std::array<float,2>{0.00325779058f, 0.0027978369f},
-std::array<float,2>{0.650520384f, 0.969233096f},
-std::array<float,2>{0.178481892f, 0.794033289f},
-std::array<float,2>{0.560407102f, 0.229348719f},
-std::array<float,2>{0.323896229f, 0.29854092f},
-std::array<float,2>{0.98236227f, 0.721833169f},
-std::array<float,2>{0.453795165f, 0.865647495f},
-std::array<float,2>{0.869942665f, 0.148339599f},
-std::array<float,2>{0.107221529f, 0.32155472f},
-std::array<float,2>{0.741922855f, 0.674429417f},
-std::array<float,2>{0.239324272f, 0.564422488f},
-std::array<float,2>{0.57182157f, 0.390203804f},
-std::array<float,2>{0.278651208f, 0.109919474f},
-std::array<float,2>{0.936833084f, 0.912515163f},
-std::array<float,2>{0.364519149f, 0.693282843f},
-std::array<float,2>{0.962431967f, 0.250438035f},
-std::array<float,2>{0.125167623f, 0.191725463f},
-std::array<float,2>{0.509658694f, 0.764498889f},
-std::array<float,2>{0.0398035944f, 0.966807127f},
-std::array<float,2>{0.662642002f, 0.0475149304f},
-std::array<float,2>{0.433896095f, 0.459082842f},
-std::array<float,2>{0.803271055f, 0.558727682f},
-std::array<float,2>{0.285917848f, 0.78302443f},
-std::array<float,2>{0.883119106f, 0.225928336f},
-std::array<float,2>{0.190758124f, 0.312451571f},
-std::array<float,2>{0.613244414f, 0.73142451f},
-std::array<float,2>{0.0669784397f, 0.50527966f},
-std::array<float,2>{0.70114696f, 0.49095571f},
-std::array<float,2>{0.471761495f, 0.00897743832f},
-std::array<float,2>{0.822460532f, 0.982226729f},
-std::array<float,2>{0.379093021f, 0.644783497f},
-std::array<float,2>{0.777793169f, 0.355637997f},
-std::array<float,2>{0.0177523401f, 0.183694139f},
-std::array<float,2>{0.634429336f, 0.841626167f},
-std::array<float,2>{0.166007772f, 0.889567614f},
-std::array<float,2>{0.533766568f, 0.0786337182f},
-std::array<float,2>{0.341561377f, 0.419638097f},
-std::array<float,2>{0.990918875f, 0.614872813f},
-std::array<float,2>{0.439244628f, 0.960150361f},
-std::array<float,2>{0.858123422f, 0.0584659278f},
-std::array<float,2>{0.110968776f, 0.462902606f},
-std::array<float,2>{0.719757617f, 0.552645385f},
-std::array<float,2>{0.220587954f, 0.699899852f},
-std::array<float,2>{0.589908481f, 0.262556314f},
-std::array<float,2>{0.263420254f, 0.197222725f},
-std::array<float,2>{0.908774614f, 0.752329648f},
-std::array<float,2>{0.356378108f, 0.575093746f},
-std::array<float,2>{0.938934624f, 0.375671417f},
-std::array<float,2>{0.143365994f, 0.121541925f},
-std::array<float,2>{0.516794324f, 0.920284331f},
-std::array<float,2>{0.0609573461f, 0.873385668f},
-std::array<float,2>{0.674557209f, 0.149243131f},
-std::array<float,2>{0.411952436f, 0.315868527f},
-std::array<float,2>{0.784002841f, 0.681462884f},
-std::array<float,2>{0.325735778f, 0.932590663f},
-std::array<float,2>{0.977345645f, 0.109048881f},
-std::array<float,2>{0.175404146f, 0.394292384f},
-std::array<float,2>{0.556425333f, 0.5845837f},
-std::array<float,2>{0.00676094461f, 0.668111503f},
-std::array<float,2>{0.654036283f, 0.333252728f},
-std::array<float,2>{0.391061574f, 0.128559902f},
-std::array<float,2>{0.758105993f, 0.85823673f},
-std::array<float,2>{0.4854801f, 0.543904066f},
-std::array<float,2>{0.829908192f, 0.438380569f},
-std::array<float,2>{0.0836157203f, 0.0459035113f},
-std::array<float,2>{0.715045393f, 0.937895894f},
-std::array<float,2>{0.212387383f, 0.76693064f},
-std::array<float,2>{0.600731254f, 0.218273908f},
-std::array<float,2>{0.304581463f, 0.265723586f},
-std::array<float,2>{0.893695354f, 0.716403604f},
-std::array<float,2>{0.432891518f, 0.827643394f},
-std::array<float,2>{0.797796309f, 0.165836811f},
-std::array<float,2>{0.0439412929f, 0.365713626f},
-std::array<float,2>{0.659071028f, 0.629279912f},
-std::array<float,2>{0.129085705f, 0.599124789f},
-std::array<float,2>{0.514953494f, 0.422743976f},
-std::array<float,2>{0.362994939f, 0.0683774427f},
-std::array<float,2>{0.965075433f, 0.903540611f},
-std::array<float,2>{0.276100695f, 0.736263037f},
-std::array<float,2>{0.932913303f, 0.29417944f},
-std::array<float,2>{0.235898808f, 0.24613972f},
-std::array<float,2>{0.57442981f, 0.799329102f},
-std::array<float,2>{0.101846389f, 0.987377882f},
-std::array<float,2>{0.736668944f, 0.0250510629f},
-std::array<float,2>{0.458124518f, 0.473095119f},
-std::array<float,2>{0.872642696f, 0.519799173f},
-std::array<float,2>{0.373857945f, 0.84849745f},
-std::array<float,2>{0.958412707f, 0.133223191f},
-std::array<float,2>{0.138876274f, 0.341212273f},
-std::array<float,2>{0.503359377f, 0.657055974f},
-std::array<float,2>{0.0375055522f, 0.589721501f},
-std::array<float,2>{0.666530252f, 0.404782683f},
-std::array<float,2>{0.42762357f, 0.100704886f},
-std::array<float,2>{0.811594367f, 0.928156018f},
-std::array<float,2>{0.467088014f, 0.70737797f},
-std::array<float,2>{0.866070926f, 0.280926824f},
-std::array<float,2>{0.0980371833f, 0.203503028f},
-std::array<float,2>{0.743872523f, 0.776198804f},
-std::array<float,2>{0.248225302f, 0.948859096f},
-std::array<float,2>{0.563026786f, 0.036396455f},
-std::array<float,2>{0.271064728f, 0.450398713f},
-std::array<float,2>{0.924705863f, 0.537941217f},
-std::array<float,2>{0.400109231f, 0.896482825f},
-std::array<float,2>{0.757637322f, 0.0768005401f},
-std::array<float,2>{0.0112662204f, 0.431177974f},
-std::array<float,2>{0.648404002f, 0.608453453f},
-std::array<float,2>{0.179806471f, 0.639518857f},
-std::array<float,2>{0.553935766f, 0.368637115f},
-std::array<float,2>{0.317821324f, 0.158115998f},
-std::array<float,2>{0.973250329f, 0.813985586f},
-std::array<float,2>{0.305286944f, 0.524227738f},
-std::array<float,2>{0.906107306f, 0.479394406f},
-std::array<float,2>{0.204454884f, 0.0164016485f},
-std::array<float,2>{0.602847457f, 0.994593859f},
-std::array<float,2>{0.0930919573f, 0.806058288f},
-std::array<float,2>{0.709628463f, 0.241572946f},
-std::array<float,2>{0.494391382f, 0.282970786f},
-std::array<float,2>{0.841711581f, 0.743857622f},
-std::array<float,2>{0.254133165f, 0.974956989f},
-std::array<float,2>{0.914066434f, 0.00513166143f},
-std::array<float,2>{0.232607856f, 0.494337052f},
-std::array<float,2>{0.584365547f, 0.508539796f},
-std::array<float,2>{0.118481599f, 0.724441946f},
-std::array<float,2>{0.72778976f, 0.303880543f},
-std::array<float,2>{0.448504835f, 0.231878564f},
-std::array<float,2>{0.845321298f, 0.790798187f},
-std::array<float,2>{0.417138249f, 0.620619655f},
-std::array<float,2>{0.794982553f, 0.407305241f},
-std::array<float,2>{0.0470730513f, 0.0912072286f},
-std::array<float,2>{0.684645593f, 0.878047109f},
-std::array<float,2>{0.15246287f, 0.835460246f},
-std::array<float,2>{0.525844932f, 0.174433276f},
-std::array<float,2>{0.348580569f, 0.34537068f},
-std::array<float,2>{0.950878382f, 0.65270859f},
-std::array<float,2>{0.482268959f, 0.75946033f},
-std::array<float,2>{0.817315698f, 0.188181937f},
-std::array<float,2>{0.0764338151f, 0.25600937f},
-std::array<float,2>{0.692460179f, 0.690590918f},
-std::array<float,2>{0.201878563f, 0.557917416f},
-std::array<float,2>{0.621010602f, 0.45677191f},
-std::array<float,2>{0.290808916f, 0.0528544821f},
-std::array<float,2>{0.876132965f, 0.963158607f},
-std::array<float,2>{0.333946675f, 0.677019536f},
-std::array<float,2>{0.992481172f, 0.326717496f},
-std::array<float,2>{0.161143482f, 0.140995294f},
-std::array<float,2>{0.540669322f, 0.860405028f},
-std::array<float,2>{0.024734389f, 0.906967461f},
-std::array<float,2>{0.627376139f, 0.115166441f},
-std::array<float,2>{0.385418385f, 0.385339677f},
-std::array<float,2>{0.765719414f, 0.56874156f},
-std::array<float,2>{0.253374219f, 0.852983236f},
-std::array<float,2>{0.919810951f, 0.13244611f},
-std::array<float,2>{0.229885414f, 0.330409169f},
-std::array<float,2>{0.581199169f, 0.665347517f},
-std::array<float,2>{0.122425005f, 0.578973532f},
-std::array<float,2>{0.73128438f, 0.397635221f},
-std::array<float,2>{0.450836152f, 0.101957686f},
-std::array<float,2>{0.850405633f, 0.936821878f},
-std::array<float,2>{0.420189351f, 0.712755144f},
-std::array<float,2>{0.792301178f, 0.271135509f},
-std::array<float,2>{0.0516583025f, 0.211549312f},
-std::array<float,2>{0.683559537f, 0.771552384f},
-std::array<float,2>{0.149936587f, 0.944854319f},
-std::array<float,2>{0.530183613f, 0.0394279771f},
-std::array<float,2>{0.346536875f, 0.443828851f},
-std::array<float,2>{0.94695127f, 0.542191565f},
-std::array<float,2>{0.477413803f, 0.900868297f},
-std::array<float,2>{0.813416541f, 0.0630281344f},
-std::array<float,2>{0.0707163066f, 0.426326096f},
-std::array<float,2>{0.690242946f, 0.596197724f},
-std::array<float,2>{0.197995782f, 0.627776086f},
-std::array<float,2>{0.624230087f, 0.360941857f},
-std::array<float,2>{0.293943763f, 0.171171024f},
-std::array<float,2>{0.880034208f, 0.822755516f},
-std::array<float,2>{0.331312537f, 0.516759276f},
-std::array<float,2>{0.999961376f, 0.471568406f},
-std::array<float,2>{0.157100558f, 0.0311690215f},
-std::array<float,2>{0.546759963f, 0.988969147f},
-std::array<float,2>{0.0286741611f, 0.801263809f},
-std::array<float,2>{0.62907958f, 0.243739948f},
-std::array<float,2>{0.387706786f, 0.291970015f},
-std::array<float,2>{0.770235181f, 0.740919471f},
-std::array<float,2>{0.367992729f, 0.979643285f},
-std::array<float,2>{0.954141438f, 0.0128484946f},
-std::array<float,2>{0.134090453f, 0.48515895f},
-std::array<float,2>{0.506470442f, 0.501321137f},
-std::array<float,2>{0.0349626467f, 0.730428696f},
-std::array<float,2>{0.670995593f, 0.306349725f},
-std::array<float,2>{0.422463834f, 0.22074908f},
-std::array<float,2>{0.806344509f, 0.787890255f},
-std::array<float,2>{0.463791013f, 0.613275826f},
-std::array<float,2>{0.862122774f, 0.414400369f},
-std::array<float,2>{0.0939089432f, 0.0826499984f},
-std::array<float,2>{0.748855293f, 0.883479297f},
-std::array<float,2>{0.245367482f, 0.839607954f},
-std::array<float,2>{0.569014728f, 0.180525139f},
-std::array<float,2>{0.268033803f, 0.352057219f},
-std::array<float,2>{0.926594138f, 0.641608536f},
-std::array<float,2>{0.403673828f, 0.755107105f},
-std::array<float,2>{0.751838982f, 0.200019211f},
-std::array<float,2>{0.0141828302f, 0.261410981f},
-std::array<float,2>{0.641743958f, 0.69634074f},
-std::array<float,2>{0.187340483f, 0.548598111f},
-std::array<float,2>{0.550284088f, 0.468565434f},
-std::array<float,2>{0.314889282f, 0.0620847009f},
-std::array<float,2>{0.970846593f, 0.955634952f},
-std::array<float,2>{0.311462551f, 0.686088085f},
-std::array<float,2>{0.900784612f, 0.317789555f},
-std::array<float,2>{0.208256498f, 0.15387845f},
-std::array<float,2>{0.609063447f, 0.87002027f},
-std::array<float,2>{0.0869458392f, 0.916328371f},
-std::array<float,2>{0.705945015f, 0.117422998f},
-std::array<float,2>{0.496467203f, 0.379029959f},
-std::array<float,2>{0.83862865f, 0.571598291f},
-std::array<float,2>{0.323077083f, 0.796085954f},
-std::array<float,2>{0.981083453f, 0.227626547f},
-std::array<float,2>{0.179190934f, 0.299231321f},
-std::array<float,2>{0.559041202f, 0.720390916f},
-std::array<float,2>{0.00211683521f, 0.511840224f},
-std::array<float,2>{0.65139538f, 0.497224063f},
-std::array<float,2>{0.398423135f, 0.00173934549f},
-std::array<float,2>{0.764721096f, 0.971188486f},
-std::array<float,2>{0.491238475f, 0.649928331f},
-std::array<float,2>{0.834178865f, 0.35086745f},
-std::array<float,2>{0.0798833147f, 0.178592786f},
-std::array<float,2>{0.712515116f, 0.830644011f},
-std::array<float,2>{0.217949018f, 0.881848931f},
-std::array<float,2>{0.596769273f, 0.089421697f},
-std::array<float,2>{0.297427803f, 0.411504835f},
-std::array<float,2>{0.896889806f, 0.623373568f},
-std::array<float,2>{0.434775203f, 0.965605855f},
-std::array<float,2>{0.804204345f, 0.0504628904f},
-std::array<float,2>{0.0405060761f, 0.458147168f},
-std::array<float,2>{0.66393441f, 0.561084628f},
-std::array<float,2>{0.126689106f, 0.694975555f},
-std::array<float,2>{0.508446038f, 0.253517926f},
-std::array<float,2>{0.363882035f, 0.193749338f},
-std::array<float,2>{0.961797714f, 0.762045085f},
-std::array<float,2>{0.278102785f, 0.566358209f},
-std::array<float,2>{0.935636878f, 0.387898445f},
-std::array<float,2>{0.238532364f, 0.11181508f},
-std::array<float,2>{0.570527196f, 0.91156292f},
-std::array<float,2>{0.105481856f, 0.863989294f},
-std::array<float,2>{0.740586817f, 0.145903692f},
-std::array<float,2>{0.454397708f, 0.323405355f},
-std::array<float,2>{0.870367765f, 0.67338872f},
-std::array<float,2>{0.283440083f, 0.925628662f},
-std::array<float,2>{0.888598621f, 0.0960472524f},
-std::array<float,2>{0.192819118f, 0.39967519f},
-std::array<float,2>{0.613852203f, 0.59142375f},
-std::array<float,2>{0.065487422f, 0.663052559f},
-std::array<float,2>{0.697271883f, 0.33784765f},
-std::array<float,2>{0.474915773f, 0.136925012f},
-std::array<float,2>{0.826813817f, 0.846219003f},
-std::array<float,2>{0.375323176f, 0.534028947f},
-std::array<float,2>{0.776845694f, 0.447220862f},
-std::array<float,2>{0.0209616888f, 0.0335932225f},
-std::array<float,2>{0.638621449f, 0.951359749f},
-std::array<float,2>{0.171288684f, 0.778482974f},
-std::array<float,2>{0.535390615f, 0.210430264f},
-std::array<float,2>{0.336198211f, 0.275065511f},
-std::array<float,2>{0.986009896f, 0.706978858f},
-std::array<float,2>{0.442603081f, 0.818195701f},
-std::array<float,2>{0.855231404f, 0.1618222f},
-std::array<float,2>{0.114883773f, 0.37337023f},
-std::array<float,2>{0.725687861f, 0.636312604f},
-std::array<float,2>{0.222686529f, 0.604597926f},
-std::array<float,2>{0.588401258f, 0.434191495f},
-std::array<float,2>{0.261107594f, 0.0708691329f},
-std::array<float,2>{0.910406709f, 0.894230366f},
-std::array<float,2>{0.352644205f, 0.747397482f},
-std::array<float,2>{0.942493558f, 0.286697686f},
-std::array<float,2>{0.144823804f, 0.23658295f},
-std::array<float,2>{0.523117959f, 0.810539067f},
-std::array<float,2>{0.0549456216f, 0.998739719f},
-std::array<float,2>{0.676674306f, 0.0219537094f},
-std::array<float,2>{0.409660935f, 0.48416394f},
-std::array<float,2>{0.788933158f, 0.528948545f},
-std::array<float,2>{0.303402126f, 0.768244565f},
-std::array<float,2>{0.893554211f, 0.215668693f},
-std::array<float,2>{0.211393997f, 0.268113643f},
-std::array<float,2>{0.599997878f, 0.717950165f},
-std::array<float,2>{0.082043618f, 0.545417488f},
-std::array<float,2>{0.716184318f, 0.440009445f},
-std::array<float,2>{0.48511669f, 0.0445732735f},
-std::array<float,2>{0.828208923f, 0.940551281f},
-std::array<float,2>{0.391830444f, 0.671084166f},
-std::array<float,2>{0.759729683f, 0.335482031f},
-std::array<float,2>{0.00756327296f, 0.125951961f},
-std::array<float,2>{0.652633131f, 0.856988132f},
-std::array<float,2>{0.174794421f, 0.931477249f},
-std::array<float,2>{0.554853916f, 0.106110446f},
-std::array<float,2>{0.324967146f, 0.39108628f},
-std::array<float,2>{0.978223383f, 0.582098901f},
-std::array<float,2>{0.457753778f, 0.984756649f},
-std::array<float,2>{0.871774435f, 0.0260201246f},
-std::array<float,2>{0.102701917f, 0.475218177f},
-std::array<float,2>{0.737353802f, 0.521496236f},
-std::array<float,2>{0.235245377f, 0.737042665f},
-std::array<float,2>{0.575507998f, 0.295998573f},
-std::array<float,2>{0.27726537f, 0.249314934f},
-std::array<float,2>{0.931867242f, 0.797847688f},
-std::array<float,2>{0.361992091f, 0.599621475f},
-std::array<float,2>{0.966062188f, 0.425593883f},
-std::array<float,2>{0.130729616f, 0.0682625175f},
-std::array<float,2>{0.514216006f, 0.90573746f},
-std::array<float,2>{0.0446850918f, 0.824321926f},
-std::array<float,2>{0.659423947f, 0.167760804f},
-std::array<float,2>{0.431729555f, 0.363825232f},
-std::array<float,2>{0.798055291f, 0.631893694f},
-std::array<float,2>{0.340299964f, 0.886821687f},
-std::array<float,2>{0.991865098f, 0.0813926756f},
-std::array<float,2>{0.164539412f, 0.421053588f},
-std::array<float,2>{0.534331918f, 0.615399778f},
-std::array<float,2>{0.0193187259f, 0.646950424f},
-std::array<float,2>{0.633326888f, 0.357629597f},
-std::array<float,2>{0.380072594f, 0.186960235f},
-std::array<float,2>{0.778992832f, 0.842992306f},
-std::array<float,2>{0.470707119f, 0.50663054f},
-std::array<float,2>{0.823704779f, 0.490114659f},
-std::array<float,2>{0.0679032356f, 0.0100602778f},
-std::array<float,2>{0.700165868f, 0.983318746f},
-std::array<float,2>{0.190352976f, 0.784573793f},
-std::array<float,2>{0.611629009f, 0.223097131f},
-std::array<float,2>{0.286901951f, 0.309265763f},
-std::array<float,2>{0.88385874f, 0.733935595f},
-std::array<float,2>{0.411087722f, 0.872722268f},
-std::array<float,2>{0.78513509f, 0.152319625f},
-std::array<float,2>{0.0622812584f, 0.312887907f},
-std::array<float,2>{0.675759375f, 0.68336308f},
-std::array<float,2>{0.143932655f, 0.577446938f},
-std::array<float,2>{0.516027629f, 0.3776218f},
-std::array<float,2>{0.356905043f, 0.124156937f},
-std::array<float,2>{0.937767506f, 0.919666886f},
-std::array<float,2>{0.262444317f, 0.701232016f},
-std::array<float,2>{0.909750104f, 0.265244812f},
-std::array<float,2>{0.219455242f, 0.199210986f},
-std::array<float,2>{0.591753125f, 0.750511885f},
-std::array<float,2>{0.11016725f, 0.957397997f},
-std::array<float,2>{0.71931994f, 0.0550116524f},
-std::array<float,2>{0.437946081f, 0.462370753f},
-std::array<float,2>{0.858893991f, 0.553839684f},
-std::array<float,2>{0.349528968f, 0.832328498f},
-std::array<float,2>{0.94926399f, 0.173675939f},
-std::array<float,2>{0.154122412f, 0.34728545f},
-std::array<float,2>{0.52728498f, 0.654931188f},
-std::array<float,2>{0.0485290736f, 0.618499935f},
-std::array<float,2>{0.683948517f, 0.409703732f},
-std::array<float,2>{0.416419148f, 0.0936594903f},
-std::array<float,2>{0.796742022f, 0.875017107f},
-std::array<float,2>{0.447368592f, 0.724645019f},
-std::array<float,2>{0.844491124f, 0.30097878f},
-std::array<float,2>{0.117727295f, 0.233108789f},
-std::array<float,2>{0.727406561f, 0.791685224f},
-std::array<float,2>{0.233628497f, 0.974230647f},
-std::array<float,2>{0.5854339f, 0.00625433587f},
-std::array<float,2>{0.255556941f, 0.492901146f},
-std::array<float,2>{0.915922761f, 0.511347055f},
-std::array<float,2>{0.385951161f, 0.908374786f},
-std::array<float,2>{0.766830444f, 0.115886256f},
-std::array<float,2>{0.0234520976f, 0.383750618f},
-std::array<float,2>{0.627983987f, 0.567086518f},
-std::array<float,2>{0.160879552f, 0.678131282f},
-std::array<float,2>{0.539988458f, 0.324708909f},
-std::array<float,2>{0.332520366f, 0.144370034f},
-std::array<float,2>{0.993812501f, 0.862411141f},
-std::array<float,2>{0.289645582f, 0.555160165f},
-std::array<float,2>{0.875585437f, 0.45445171f},
-std::array<float,2>{0.202684805f, 0.0508670248f},
-std::array<float,2>{0.61933738f, 0.962286353f},
-std::array<float,2>{0.0777992979f, 0.76032418f},
-std::array<float,2>{0.69195807f, 0.18981871f},
-std::array<float,2>{0.480742425f, 0.255500972f},
-std::array<float,2>{0.817441344f, 0.68910569f},
-std::array<float,2>{0.270132899f, 0.945334435f},
-std::array<float,2>{0.925674736f, 0.0381572545f},
-std::array<float,2>{0.249586314f, 0.452104241f},
-std::array<float,2>{0.563775599f, 0.535383105f},
-std::array<float,2>{0.0993882194f, 0.710857749f},
-std::array<float,2>{0.742585719f, 0.27912727f},
-std::array<float,2>{0.468077838f, 0.20670639f},
-std::array<float,2>{0.866363049f, 0.773566782f},
-std::array<float,2>{0.426488608f, 0.586591899f},
-std::array<float,2>{0.811187387f, 0.402855366f},
-std::array<float,2>{0.038449917f, 0.0987554044f},
-std::array<float,2>{0.667358279f, 0.926279187f},
-std::array<float,2>{0.140425801f, 0.850327671f},
-std::array<float,2>{0.502067566f, 0.135822669f},
-std::array<float,2>{0.374674022f, 0.341939598f},
-std::array<float,2>{0.957964182f, 0.658619225f},
-std::array<float,2>{0.495762646f, 0.80714792f},
-std::array<float,2>{0.840272307f, 0.239767969f},
-std::array<float,2>{0.0922936797f, 0.283365846f},
-std::array<float,2>{0.710574985f, 0.746059299f},
-std::array<float,2>{0.203424424f, 0.526883662f},
-std::array<float,2>{0.602430463f, 0.47698164f},
-std::array<float,2>{0.306031585f, 0.0192933101f},
-std::array<float,2>{0.904998779f, 0.99354738f},
-std::array<float,2>{0.316466719f, 0.636958659f},
-std::array<float,2>{0.974154055f, 0.369552314f},
-std::array<float,2>{0.180923834f, 0.158952922f},
-std::array<float,2>{0.553655565f, 0.816057742f},
-std::array<float,2>{0.0100466991f, 0.896578968f},
-std::array<float,2>{0.647117913f, 0.0747294575f},
-std::array<float,2>{0.398921788f, 0.432907522f},
-std::array<float,2>{0.756510437f, 0.606008172f},
-std::array<float,2>{0.296626091f, 0.820599437f},
-std::array<float,2>{0.881612539f, 0.168560907f},
-std::array<float,2>{0.197204709f, 0.36179617f},
-std::array<float,2>{0.622497141f, 0.625507653f},
-std::array<float,2>{0.0727736354f, 0.595366061f},
-std::array<float,2>{0.688289523f, 0.428658128f},
-std::array<float,2>{0.47947529f, 0.0661410764f},
-std::array<float,2>{0.8145383f, 0.900239408f},
-std::array<float,2>{0.389806718f, 0.738315344f},
-std::array<float,2>{0.771775901f, 0.290802121f},
-std::array<float,2>{0.0295723733f, 0.245821059f},
-std::array<float,2>{0.632133245f, 0.804104388f},
-std::array<float,2>{0.159720883f, 0.991112471f},
-std::array<float,2>{0.543955147f, 0.0279502496f},
-std::array<float,2>{0.328279644f, 0.469624192f},
-std::array<float,2>{0.99794662f, 0.519481063f},
-std::array<float,2>{0.451979607f, 0.93426764f},
-std::array<float,2>{0.848198295f, 0.104920819f},
-std::array<float,2>{0.123063274f, 0.395183146f},
-std::array<float,2>{0.733507097f, 0.581174135f},
-std::array<float,2>{0.227619141f, 0.666187286f},
-std::array<float,2>{0.578183234f, 0.328622609f},
-std::array<float,2>{0.250905335f, 0.129198641f},
-std::array<float,2>{0.920136094f, 0.855055094f},
-std::array<float,2>{0.34406507f, 0.540035069f},
-std::array<float,2>{0.948110998f, 0.442943722f},
-std::array<float,2>{0.152007505f, 0.0421906486f},
-std::array<float,2>{0.527651668f, 0.942194223f},
-std::array<float,2>{0.0528562479f, 0.771443605f},
-std::array<float,2>{0.679803133f, 0.214393079f},
-std::array<float,2>{0.419591218f, 0.272529006f},
-std::array<float,2>{0.790644109f, 0.714517593f},
-std::array<float,2>{0.313546807f, 0.953455269f},
-std::array<float,2>{0.969635606f, 0.0602735728f},
-std::array<float,2>{0.18514353f, 0.466776818f},
-std::array<float,2>{0.547216296f, 0.549540222f},
-std::array<float,2>{0.0131130116f, 0.698498547f},
-std::array<float,2>{0.642911851f, 0.25823158f},
-std::array<float,2>{0.405821353f, 0.201415807f},
-std::array<float,2>{0.752270937f, 0.755914867f},
-std::array<float,2>{0.499471188f, 0.57303375f},
-std::array<float,2>{0.836874247f, 0.382343471f},
-std::array<float,2>{0.0890203938f, 0.119172566f},
-std::array<float,2>{0.704246044f, 0.91517216f},
-std::array<float,2>{0.210545242f, 0.867777586f},
-std::array<float,2>{0.60734266f, 0.156248614f},
-std::array<float,2>{0.309336871f, 0.318395376f},
-std::array<float,2>{0.899660468f, 0.684010386f},
-std::array<float,2>{0.424445093f, 0.785657346f},
-std::array<float,2>{0.807413816f, 0.219469026f},
-std::array<float,2>{0.0320174582f, 0.307895213f},
-std::array<float,2>{0.66832453f, 0.728182018f},
-std::array<float,2>{0.136251852f, 0.502667189f},
-std::array<float,2>{0.505747676f, 0.487843513f},
-std::array<float,2>{0.370022297f, 0.0142300529f},
-std::array<float,2>{0.956297934f, 0.97680074f},
-std::array<float,2>{0.266414434f, 0.643883228f},
-std::array<float,2>{0.928734422f, 0.355402529f},
-std::array<float,2>{0.242802069f, 0.182849303f},
-std::array<float,2>{0.567197561f, 0.837586522f},
-std::array<float,2>{0.0971985832f, 0.885948658f},
-std::array<float,2>{0.747033358f, 0.0849704221f},
-std::array<float,2>{0.462856412f, 0.417182773f},
-std::array<float,2>{0.859999537f, 0.609596193f},
-std::array<float,2>{0.365327477f, 0.764969528f},
-std::array<float,2>{0.963966191f, 0.192962274f},
-std::array<float,2>{0.128699601f, 0.251188278f},
-std::array<float,2>{0.509777963f, 0.692237556f},
-std::array<float,2>{0.0412363894f, 0.559703171f},
-std::array<float,2>{0.66117239f, 0.460390866f},
-std::array<float,2>{0.436891854f, 0.0486753471f},
-std::array<float,2>{0.802373171f, 0.968144596f},
-std::array<float,2>{0.456918806f, 0.675065875f},
-std::array<float,2>{0.86876893f, 0.32039547f},
-std::array<float,2>{0.107690141f, 0.146496102f},
-std::array<float,2>{0.739710152f, 0.866318822f},
-std::array<float,2>{0.242139086f, 0.913610876f},
-std::array<float,2>{0.572699189f, 0.110939398f},
-std::array<float,2>{0.280885994f, 0.388694972f},
-std::array<float,2>{0.93522203f, 0.562897265f},
-std::array<float,2>{0.396473676f, 0.970127404f},
-std::array<float,2>{0.761842549f, 0.00379708596f},
-std::array<float,2>{0.00137830724f, 0.499997884f},
-std::array<float,2>{0.649775565f, 0.515616715f},
-std::array<float,2>{0.177388474f, 0.721603632f},
-std::array<float,2>{0.560726821f, 0.297740012f},
-std::array<float,2>{0.321509302f, 0.230112538f},
-std::array<float,2>{0.98281455f, 0.793816149f},
-std::array<float,2>{0.299045414f, 0.621236503f},
-std::array<float,2>{0.896079659f, 0.413298845f},
-std::array<float,2>{0.215200618f, 0.0877842754f},
-std::array<float,2>{0.594625294f, 0.880395174f},
-std::array<float,2>{0.0810042322f, 0.829003096f},
-std::array<float,2>{0.714780569f, 0.177353665f},
-std::array<float,2>{0.489845216f, 0.348551095f},
-std::array<float,2>{0.83395344f, 0.652202308f},
-std::array<float,2>{0.25836271f, 0.891348302f},
-std::array<float,2>{0.913086534f, 0.0735126659f},
-std::array<float,2>{0.226545453f, 0.435915589f},
-std::array<float,2>{0.587072492f, 0.601664662f},
-std::array<float,2>{0.116582371f, 0.633176684f},
-std::array<float,2>{0.723555624f, 0.371552527f},
-std::array<float,2>{0.444433182f, 0.163359568f},
-std::array<float,2>{0.853353441f, 0.819497526f},
-std::array<float,2>{0.406654924f, 0.529583097f},
-std::array<float,2>{0.785687566f, 0.481165588f},
-std::array<float,2>{0.0574501455f, 0.020408405f},
-std::array<float,2>{0.678209007f, 0.997965634f},
-std::array<float,2>{0.14704442f, 0.812054515f},
-std::array<float,2>{0.521119237f, 0.235855922f},
-std::array<float,2>{0.35360679f, 0.288438559f},
-std::array<float,2>{0.944995344f, 0.749703467f},
-std::array<float,2>{0.473230779f, 0.843979239f},
-std::array<float,2>{0.824542224f, 0.138979837f},
-std::array<float,2>{0.0630803108f, 0.339653045f},
-std::array<float,2>{0.695942521f, 0.660160601f},
-std::array<float,2>{0.194207162f, 0.593410671f},
-std::array<float,2>{0.615617514f, 0.401639789f},
-std::array<float,2>{0.28260991f, 0.0943922922f},
-std::array<float,2>{0.888975918f, 0.923747957f},
-std::array<float,2>{0.339523226f, 0.703449726f},
-std::array<float,2>{0.987922668f, 0.27613011f},
-std::array<float,2>{0.168934762f, 0.207402706f},
-std::array<float,2>{0.538550138f, 0.780732274f},
-std::array<float,2>{0.0233498104f, 0.951141298f},
-std::array<float,2>{0.640177906f, 0.0318223238f},
-std::array<float,2>{0.378480762f, 0.449062347f},
-std::array<float,2>{0.774766743f, 0.532191098f},
-std::array<float,2>{0.275343865f, 0.800277829f},
-std::array<float,2>{0.930052876f, 0.247100189f},
-std::array<float,2>{0.236673176f, 0.29355076f},
-std::array<float,2>{0.57740736f, 0.734996796f},
-std::array<float,2>{0.105292529f, 0.520828068f},
-std::array<float,2>{0.73485738f, 0.473742425f},
-std::array<float,2>{0.460114717f, 0.0237434842f},
-std::array<float,2>{0.873542488f, 0.986644626f},
-std::array<float,2>{0.431584865f, 0.630621552f},
-std::array<float,2>{0.800057709f, 0.366312593f},
-std::array<float,2>{0.0449729189f, 0.164949194f},
-std::array<float,2>{0.656960666f, 0.826840699f},
-std::array<float,2>{0.132555097f, 0.902958155f},
-std::array<float,2>{0.511863649f, 0.0699642599f},
-std::array<float,2>{0.360625744f, 0.423802227f},
-std::array<float,2>{0.967481256f, 0.598067522f},
-std::array<float,2>{0.487838209f, 0.939235926f},
-std::array<float,2>{0.831906319f, 0.0450969562f},
-std::array<float,2>{0.0850088f, 0.43875888f},
-std::array<float,2>{0.717125177f, 0.544512212f},
-std::array<float,2>{0.213941753f, 0.715610147f},
-std::array<float,2>{0.599497318f, 0.266609371f},
-std::array<float,2>{0.302183717f, 0.217295989f},
-std::array<float,2>{0.89090097f, 0.766575754f},
-std::array<float,2>{0.32678321f, 0.585718632f},
-std::array<float,2>{0.980115771f, 0.393343538f},
-std::array<float,2>{0.172348425f, 0.107440792f},
-std::array<float,2>{0.557494283f, 0.932901144f},
-std::array<float,2>{0.00399503531f, 0.85918951f},
-std::array<float,2>{0.655875862f, 0.127421454f},
-std::array<float,2>{0.39271614f, 0.332779258f},
-std::array<float,2>{0.760402918f, 0.669280052f},
-std::array<float,2>{0.358286142f, 0.921616673f},
-std::array<float,2>{0.940597117f, 0.12232393f},
-std::array<float,2>{0.140788183f, 0.376873523f},
-std::array<float,2>{0.518280566f, 0.576156437f},
-std::array<float,2>{0.0589464009f, 0.67976737f},
-std::array<float,2>{0.673469245f, 0.314719975f},
-std::array<float,2>{0.413307697f, 0.150111243f},
-std::array<float,2>{0.782545388f, 0.874635935f},
-std::array<float,2>{0.441250265f, 0.551680386f},
-std::array<float,2>{0.857018292f, 0.464714944f},
-std::array<float,2>{0.112639584f, 0.0570599772f},
-std::array<float,2>{0.721172333f, 0.959308684f},
-std::array<float,2>{0.221867651f, 0.753872216f},
-std::array<float,2>{0.592071176f, 0.195695087f},
-std::array<float,2>{0.265608549f, 0.263195068f},
-std::array<float,2>{0.906345904f, 0.700524926f},
-std::array<float,2>{0.381104618f, 0.840525329f},
-std::array<float,2>{0.780060589f, 0.184776992f},
-std::array<float,2>{0.0175418649f, 0.356527984f},
-std::array<float,2>{0.635676801f, 0.64612776f},
-std::array<float,2>{0.167135879f, 0.613669157f},
-std::array<float,2>{0.531273425f, 0.418821692f},
-std::array<float,2>{0.342064142f, 0.0796778277f},
-std::array<float,2>{0.989550233f, 0.890110672f},
-std::array<float,2>{0.288747191f, 0.731600404f},
-std::array<float,2>{0.885044754f, 0.31149143f},
-std::array<float,2>{0.187881976f, 0.225064069f},
-std::array<float,2>{0.610240638f, 0.781454384f},
-std::array<float,2>{0.0699505061f, 0.980692863f},
-std::array<float,2>{0.701522887f, 0.00798411015f},
-std::array<float,2>{0.470419884f, 0.492116809f},
-std::array<float,2>{0.822138965f, 0.504110694f},
-std::array<float,2>{0.335258305f, 0.859662771f},
-std::array<float,2>{0.994889021f, 0.14213565f},
-std::array<float,2>{0.162433609f, 0.328021586f},
-std::array<float,2>{0.542357028f, 0.67668581f},
-std::array<float,2>{0.0264863987f, 0.569635749f},
-std::array<float,2>{0.626823783f, 0.386397004f},
-std::array<float,2>{0.38287589f, 0.113447934f},
-std::array<float,2>{0.767609954f, 0.907807469f},
-std::array<float,2>{0.483113885f, 0.690302193f},
-std::array<float,2>{0.819117546f, 0.257077187f},
-std::array<float,2>{0.0755237564f, 0.189122245f},
-std::array<float,2>{0.693839967f, 0.758671045f},
-std::array<float,2>{0.200996786f, 0.964648008f},
-std::array<float,2>{0.618140697f, 0.0544374213f},
-std::array<float,2>{0.292576253f, 0.455528229f},
-std::array<float,2>{0.878733337f, 0.556836367f},
-std::array<float,2>{0.414763391f, 0.877133846f},
-std::array<float,2>{0.794578791f, 0.0901297182f},
-std::array<float,2>{0.0488563441f, 0.406332254f},
-std::array<float,2>{0.686637819f, 0.619411409f},
-std::array<float,2>{0.155946076f, 0.653500021f},
-std::array<float,2>{0.5237661f, 0.343995243f},
-std::array<float,2>{0.350177824f, 0.175473154f},
-std::array<float,2>{0.95306921f, 0.83491993f},
-std::array<float,2>{0.256762981f, 0.508826852f},
-std::array<float,2>{0.916333199f, 0.495389968f},
-std::array<float,2>{0.232153714f, 0.0045598424f},
-std::array<float,2>{0.583413601f, 0.975809515f},
-std::array<float,2>{0.120131798f, 0.789465666f},
-std::array<float,2>{0.728779078f, 0.231412679f},
-std::array<float,2>{0.446005017f, 0.303052247f},
-std::array<float,2>{0.846760392f, 0.723320663f},
-std::array<float,2>{0.307153195f, 0.99555254f},
-std::array<float,2>{0.904054105f, 0.0168900453f},
-std::array<float,2>{0.206027776f, 0.480208158f},
-std::array<float,2>{0.605159044f, 0.525145769f},
-std::array<float,2>{0.090705961f, 0.742264867f},
-std::array<float,2>{0.707201123f, 0.281600416f},
-std::array<float,2>{0.492237657f, 0.240655333f},
-std::array<float,2>{0.843190789f, 0.804887712f},
-std::array<float,2>{0.401809782f, 0.608227491f},
-std::array<float,2>{0.75492245f, 0.43009761f},
-std::array<float,2>{0.00857111067f, 0.0778835788f},
-std::array<float,2>{0.646170437f, 0.895145118f},
-std::array<float,2>{0.182191923f, 0.813320816f},
-std::array<float,2>{0.551836193f, 0.156267434f},
-std::array<float,2>{0.320293218f, 0.367840976f},
-std::array<float,2>{0.975145817f, 0.640138805f},
-std::array<float,2>{0.466711372f, 0.777279437f},
-std::array<float,2>{0.865120828f, 0.205015346f},
-std::array<float,2>{0.101417296f, 0.280215085f},
-std::array<float,2>{0.7459535f, 0.708689213f},
-std::array<float,2>{0.247587249f, 0.538765073f},
-std::array<float,2>{0.565593898f, 0.450028628f},
-std::array<float,2>{0.272358358f, 0.0355466269f},
-std::array<float,2>{0.922618866f, 0.947726846f},
-std::array<float,2>{0.372649133f, 0.657329142f},
-std::array<float,2>{0.960697353f, 0.340779752f},
-std::array<float,2>{0.137241974f, 0.134458289f},
-std::array<float,2>{0.501884282f, 0.8489694f},
-std::array<float,2>{0.0361482762f, 0.929673553f},
-std::array<float,2>{0.664665818f, 0.0999246165f},
-std::array<float,2>{0.42881304f, 0.406157583f},
-std::array<float,2>{0.810237765f, 0.588780999f},
-std::array<float,2>{0.283150584f, 0.845741034f},
-std::array<float,2>{0.889350235f, 0.13755624f},
-std::array<float,2>{0.193519339f, 0.337176085f},
-std::array<float,2>{0.615785956f, 0.662215531f},
-std::array<float,2>{0.0626059771f, 0.591255963f},
-std::array<float,2>{0.695439517f, 0.400217712f},
-std::array<float,2>{0.472920477f, 0.0963523462f},
-std::array<float,2>{0.825174332f, 0.924960554f},
-std::array<float,2>{0.378334761f, 0.706403673f},
-std::array<float,2>{0.774913907f, 0.274533391f},
-std::array<float,2>{0.0226700548f, 0.210630149f},
-std::array<float,2>{0.639837086f, 0.778937876f},
-std::array<float,2>{0.168288052f, 0.951791823f},
-std::array<float,2>{0.538827121f, 0.0336962789f},
-std::array<float,2>{0.338993907f, 0.446289599f},
-std::array<float,2>{0.987347901f, 0.533533335f},
-std::array<float,2>{0.444881529f, 0.89390254f},
-std::array<float,2>{0.852799952f, 0.070430778f},
-std::array<float,2>{0.117140383f, 0.433986068f},
-std::array<float,2>{0.723030925f, 0.605216086f},
-std::array<float,2>{0.225904852f, 0.635765076f},
-std::array<float,2>{0.587420404f, 0.373742431f},
-std::array<float,2>{0.258182764f, 0.16149269f},
-std::array<float,2>{0.913951397f, 0.81786859f},
-std::array<float,2>{0.354065448f, 0.528508306f},
-std::array<float,2>{0.944598317f, 0.483727694f},
-std::array<float,2>{0.146701664f, 0.0222909506f},
-std::array<float,2>{0.520525455f, 0.998065054f},
-std::array<float,2>{0.0569649115f, 0.809825778f},
-std::array<float,2>{0.678237617f, 0.236854225f},
-std::array<float,2>{0.406919807f, 0.286182106f},
-std::array<float,2>{0.785615563f, 0.747633874f},
-std::array<float,2>{0.321939141f, 0.971618235f},
-std::array<float,2>{0.983022392f, 0.00105581433f},
-std::array<float,2>{0.176767692f, 0.497962177f},
-std::array<float,2>{0.561156392f, 0.512292325f},
-std::array<float,2>{0.00153072749f, 0.71974951f},
-std::array<float,2>{0.649951875f, 0.299362987f},
-std::array<float,2>{0.395761222f, 0.228052929f},
-std::array<float,2>{0.762235999f, 0.796615303f},
-std::array<float,2>{0.489316881f, 0.62391299f},
-std::array<float,2>{0.83314842f, 0.411929458f},
-std::array<float,2>{0.0802148283f, 0.0890357271f},
-std::array<float,2>{0.714252174f, 0.882729709f},
-std::array<float,2>{0.215442076f, 0.830330729f},
-std::array<float,2>{0.594031215f, 0.177848414f},
-std::array<float,2>{0.29960084f, 0.351200879f},
-std::array<float,2>{0.895525277f, 0.649499297f},
-std::array<float,2>{0.43749404f, 0.762310386f},
-std::array<float,2>{0.802083254f, 0.194202885f},
-std::array<float,2>{0.0416694544f, 0.253379315f},
-std::array<float,2>{0.661664188f, 0.694711387f},
-std::array<float,2>{0.128127158f, 0.560866058f},
-std::array<float,2>{0.510629117f, 0.458863825f},
-std::array<float,2>{0.36584428f, 0.0502287336f},
-std::array<float,2>{0.964821279f, 0.965264678f},
-std::array<float,2>{0.280278325f, 0.672970474f},
-std::array<float,2>{0.934788942f, 0.323748499f},
-std::array<float,2>{0.241648018f, 0.146246985f},
-std::array<float,2>{0.573149323f, 0.863600135f},
-std::array<float,2>{0.108100526f, 0.91167748f},
-std::array<float,2>{0.740173638f, 0.112252861f},
-std::array<float,2>{0.456510574f, 0.388299108f},
-std::array<float,2>{0.868609309f, 0.565440118f},
-std::array<float,2>{0.369290531f, 0.787146688f},
-std::array<float,2>{0.956778109f, 0.221234873f},
-std::array<float,2>{0.135906011f, 0.306093365f},
-std::array<float,2>{0.505001664f, 0.729949355f},
-std::array<float,2>{0.0315396562f, 0.501578152f},
-std::array<float,2>{0.668797731f, 0.484573066f},
-std::array<float,2>{0.424042881f, 0.0135927219f},
-std::array<float,2>{0.807126939f, 0.980359316f},
-std::array<float,2>{0.462330997f, 0.642285883f},
-std::array<float,2>{0.859798491f, 0.351770252f},
-std::array<float,2>{0.0969252884f, 0.18001087f},
-std::array<float,2>{0.746131182f, 0.839075267f},
-std::array<float,2>{0.242294893f, 0.883052945f},
-std::array<float,2>{0.56676048f, 0.0822636411f},
-std::array<float,2>{0.266103506f, 0.41458708f},
-std::array<float,2>{0.929238796f, 0.612500131f},
-std::array<float,2>{0.405643463f, 0.955287278f},
-std::array<float,2>{0.752620339f, 0.0618534982f},
-std::array<float,2>{0.0133718355f, 0.468110919f},
-std::array<float,2>{0.643224239f, 0.548145831f},
-std::array<float,2>{0.184725121f, 0.697232664f},
-std::array<float,2>{0.547423542f, 0.261057079f},
-std::array<float,2>{0.314451844f, 0.199299619f},
-std::array<float,2>{0.968870282f, 0.755849481f},
-std::array<float,2>{0.309020489f, 0.572126925f},
-std::array<float,2>{0.90021354f, 0.37959078f},
-std::array<float,2>{0.210359737f, 0.117779545f},
-std::array<float,2>{0.606515348f, 0.916766942f},
-std::array<float,2>{0.0898110047f, 0.869337916f},
-std::array<float,2>{0.704678595f, 0.153685853f},
-std::array<float,2>{0.499815434f, 0.318067461f},
-std::array<float,2>{0.836382985f, 0.685551941f},
-std::array<float,2>{0.250200301f, 0.937051475f},
-std::array<float,2>{0.920451403f, 0.102138497f},
-std::array<float,2>{0.228318766f, 0.398379803f},
-std::array<float,2>{0.578973711f, 0.578473449f},
-std::array<float,2>{0.123760134f, 0.665841997f},
-std::array<float,2>{0.73422128f, 0.330606818f},
-std::array<float,2>{0.451341093f, 0.132108733f},
-std::array<float,2>{0.848138869f, 0.853508413f},
-std::array<float,2>{0.419212639f, 0.542670727f},
-std::array<float,2>{0.79005754f, 0.444178343f},
-std::array<float,2>{0.0532404743f, 0.0398370512f},
-std::array<float,2>{0.680450141f, 0.944575965f},
-std::array<float,2>{0.15178065f, 0.772209048f},
-std::array<float,2>{0.528033555f, 0.211171567f},
-std::array<float,2>{0.344593585f, 0.270702571f},
-std::array<float,2>{0.947523594f, 0.71191448f},
-std::array<float,2>{0.478978157f, 0.822572231f},
-std::array<float,2>{0.815137148f, 0.171764165f},
-std::array<float,2>{0.0725392774f, 0.360593796f},
-std::array<float,2>{0.687726259f, 0.627352476f},
-std::array<float,2>{0.196565539f, 0.59575814f},
-std::array<float,2>{0.622687757f, 0.425966769f},
-std::array<float,2>{0.296105653f, 0.0625535846f},
-std::array<float,2>{0.880860507f, 0.901161015f},
-std::array<float,2>{0.328657627f, 0.740632832f},
-std::array<float,2>{0.99726814f, 0.291305095f},
-std::array<float,2>{0.159278199f, 0.243555844f},
-std::array<float,2>{0.544549644f, 0.801714242f},
-std::array<float,2>{0.0299794115f, 0.98849076f},
-std::array<float,2>{0.632704556f, 0.0304564536f},
-std::array<float,2>{0.390252471f, 0.470981419f},
-std::array<float,2>{0.7723701f, 0.517100275f},
-std::array<float,2>{0.271767288f, 0.774282098f},
-std::array<float,2>{0.921877205f, 0.206367373f},
-std::array<float,2>{0.247343749f, 0.278391212f},
-std::array<float,2>{0.566309512f, 0.710124016f},
-std::array<float,2>{0.100860283f, 0.536017418f},
-std::array<float,2>{0.745237827f, 0.451524258f},
-std::array<float,2>{0.466018707f, 0.0386767052f},
-std::array<float,2>{0.864329338f, 0.945973754f},
-std::array<float,2>{0.429308951f, 0.658847928f},
-std::array<float,2>{0.80976373f, 0.342301369f},
-std::array<float,2>{0.0366781689f, 0.136660323f},
-std::array<float,2>{0.664350152f, 0.849899888f},
-std::array<float,2>{0.137112483f, 0.926153064f},
-std::array<float,2>{0.501169086f, 0.0995890573f},
-std::array<float,2>{0.37233758f, 0.402719408f},
-std::array<float,2>{0.960245192f, 0.586363256f},
-std::array<float,2>{0.493047863f, 0.993997872f},
-std::array<float,2>{0.8433339f, 0.0188383907f},
-std::array<float,2>{0.090254873f, 0.477228761f},
-std::array<float,2>{0.707909584f, 0.526698172f},
-std::array<float,2>{0.20548816f, 0.745309353f},
-std::array<float,2>{0.604545772f, 0.283954144f},
-std::array<float,2>{0.306977034f, 0.239596248f},
-std::array<float,2>{0.90370208f, 0.807086408f},
-std::array<float,2>{0.31940946f, 0.605884969f},
-std::array<float,2>{0.974969506f, 0.433304191f},
-std::array<float,2>{0.182007685f, 0.0742416307f},
-std::array<float,2>{0.552329838f, 0.897307992f},
-std::array<float,2>{0.0078715058f, 0.815484524f},
-std::array<float,2>{0.64590174f, 0.158368766f},
-std::array<float,2>{0.402333111f, 0.369982272f},
-std::array<float,2>{0.755494952f, 0.637309551f},
-std::array<float,2>{0.349795163f, 0.875686586f},
-std::array<float,2>{0.952237964f, 0.0929086208f},
-std::array<float,2>{0.155615896f, 0.409181625f},
-std::array<float,2>{0.524034381f, 0.61891371f},
-std::array<float,2>{0.0495941043f, 0.654587209f},
-std::array<float,2>{0.687396586f, 0.34685111f},
-std::array<float,2>{0.414507657f, 0.173070326f},
-std::array<float,2>{0.794175386f, 0.832533956f},
-std::array<float,2>{0.445720643f, 0.511183858f},
-std::array<float,2>{0.847538173f, 0.492516607f},
-std::array<float,2>{0.120891415f, 0.00654136948f},
-std::array<float,2>{0.729131818f, 0.973848104f},
-std::array<float,2>{0.231787235f, 0.791022122f},
-std::array<float,2>{0.583664775f, 0.232648581f},
-std::array<float,2>{0.255915791f, 0.301606417f},
-std::array<float,2>{0.916731f, 0.725324988f},
-std::array<float,2>{0.383383274f, 0.86284101f},
-std::array<float,2>{0.768507302f, 0.143831313f},
-std::array<float,2>{0.0272680596f, 0.324692547f},
-std::array<float,2>{0.626419544f, 0.678559482f},
-std::array<float,2>{0.162942752f, 0.566656232f},
-std::array<float,2>{0.542592824f, 0.383057147f},
-std::array<float,2>{0.335930258f, 0.115353525f},
-std::array<float,2>{0.994470239f, 0.908703089f},
-std::array<float,2>{0.292421252f, 0.688813925f},
-std::array<float,2>{0.878334403f, 0.255227774f},
-std::array<float,2>{0.200497791f, 0.190045506f},
-std::array<float,2>{0.617659748f, 0.759859145f},
-std::array<float,2>{0.0758078843f, 0.962457895f},
-std::array<float,2>{0.694312215f, 0.0516903773f},
-std::array<float,2>{0.482569993f, 0.454628289f},
-std::array<float,2>{0.818391025f, 0.555518389f},
-std::array<float,2>{0.34269163f, 0.84347564f},
-std::array<float,2>{0.98983705f, 0.187107742f},
-std::array<float,2>{0.167787269f, 0.358361721f},
-std::array<float,2>{0.532161593f, 0.647103488f},
-std::array<float,2>{0.0167132858f, 0.615873218f},
-std::array<float,2>{0.635191798f, 0.421743542f},
-std::array<float,2>{0.381688565f, 0.0816080645f},
-std::array<float,2>{0.779770315f, 0.887367189f},
-std::array<float,2>{0.469947338f, 0.733511269f},
-std::array<float,2>{0.821486235f, 0.308787495f},
-std::array<float,2>{0.0693890974f, 0.22339201f},
-std::array<float,2>{0.701950014f, 0.785104513f},
-std::array<float,2>{0.188476175f, 0.982625306f},
-std::array<float,2>{0.609463871f, 0.0103852702f},
-std::array<float,2>{0.288445592f, 0.489569664f},
-std::array<float,2>{0.885682702f, 0.506153345f},
-std::array<float,2>{0.413768172f, 0.919032395f},
-std::array<float,2>{0.782859206f, 0.124977268f},
-std::array<float,2>{0.059092477f, 0.377089471f},
-std::array<float,2>{0.673294008f, 0.578109384f},
-std::array<float,2>{0.141188025f, 0.683030725f},
-std::array<float,2>{0.517986536f, 0.313224137f},
-std::array<float,2>{0.357694805f, 0.15145795f},
-std::array<float,2>{0.941038787f, 0.872347772f},
-std::array<float,2>{0.265007943f, 0.554345846f},
-std::array<float,2>{0.906958461f, 0.4626185f},
-std::array<float,2>{0.222230151f, 0.0554426685f},
-std::array<float,2>{0.592578411f, 0.957574368f},
-std::array<float,2>{0.113177314f, 0.750428975f},
-std::array<float,2>{0.721473992f, 0.198558629f},
-std::array<float,2>{0.440597892f, 0.264784873f},
-std::array<float,2>{0.856458545f, 0.701694012f},
-std::array<float,2>{0.302627236f, 0.941274822f},
-std::array<float,2>{0.891178727f, 0.0442896113f},
-std::array<float,2>{0.214803159f, 0.439921319f},
-std::array<float,2>{0.598845959f, 0.545348048f},
-std::array<float,2>{0.0856557488f, 0.718278408f},
-std::array<float,2>{0.717445016f, 0.267697215f},
-std::array<float,2>{0.487524152f, 0.215095207f},
-std::array<float,2>{0.831435502f, 0.767984927f},
-std::array<float,2>{0.393373847f, 0.582565248f},
-std::array<float,2>{0.760101914f, 0.391573101f},
-std::array<float,2>{0.00443405844f, 0.105731219f},
-std::array<float,2>{0.655436158f, 0.930712581f},
-std::array<float,2>{0.172645807f, 0.856761813f},
-std::array<float,2>{0.556883991f, 0.125271142f},
-std::array<float,2>{0.326297164f, 0.335196942f},
-std::array<float,2>{0.979541838f, 0.671559811f},
-std::array<float,2>{0.460652888f, 0.796934545f},
-std::array<float,2>{0.873465478f, 0.249872148f},
-std::array<float,2>{0.104776852f, 0.29670164f},
-std::array<float,2>{0.735084772f, 0.736398101f},
-std::array<float,2>{0.23707661f, 0.522050619f},
-std::array<float,2>{0.578085661f, 0.475049645f},
-std::array<float,2>{0.274614185f, 0.0255695563f},
-std::array<float,2>{0.930466175f, 0.984933615f},
-std::array<float,2>{0.361306012f, 0.632608175f},
-std::array<float,2>{0.967245042f, 0.36341992f},
-std::array<float,2>{0.131894574f, 0.167367786f},
-std::array<float,2>{0.512349308f, 0.825140953f},
-std::array<float,2>{0.0457560979f, 0.905997932f},
-std::array<float,2>{0.656556606f, 0.0677770302f},
-std::array<float,2>{0.431051612f, 0.424865216f},
-std::array<float,2>{0.800483227f, 0.600387275f},
-std::array<float,2>{0.261579901f, 0.82026577f},
-std::array<float,2>{0.911082864f, 0.163724303f},
-std::array<float,2>{0.223514929f, 0.371961236f},
-std::array<float,2>{0.587989688f, 0.633382857f},
-std::array<float,2>{0.114386596f, 0.602101982f},
-std::array<float,2>{0.726320505f, 0.436106503f},
-std::array<float,2>{0.44318518f, 0.074138619f},
-std::array<float,2>{0.854793727f, 0.89100939f},
-std::array<float,2>{0.410047084f, 0.7491166f},
-std::array<float,2>{0.788542151f, 0.288666964f},
-std::array<float,2>{0.0552546382f, 0.235731199f},
-std::array<float,2>{0.676093102f, 0.811854362f},
-std::array<float,2>{0.145212308f, 0.997148454f},
-std::array<float,2>{0.522856236f, 0.020013975f},
-std::array<float,2>{0.35342899f, 0.480840445f},
-std::array<float,2>{0.943041563f, 0.530084908f},
-std::array<float,2>{0.475527585f, 0.923292518f},
-std::array<float,2>{0.826546431f, 0.0940296054f},
-std::array<float,2>{0.0660792962f, 0.401966929f},
-std::array<float,2>{0.698139131f, 0.593239367f},
-std::array<float,2>{0.193169668f, 0.660694003f},
-std::array<float,2>{0.613452792f, 0.338877529f},
-std::array<float,2>{0.283870548f, 0.139602244f},
-std::array<float,2>{0.887754738f, 0.844519436f},
-std::array<float,2>{0.336739987f, 0.531592906f},
-std::array<float,2>{0.985831857f, 0.448711753f},
-std::array<float,2>{0.1716896f, 0.0314389952f},
-std::array<float,2>{0.536050439f, 0.950336933f},
-std::array<float,2>{0.0210890565f, 0.781105876f},
-std::array<float,2>{0.637832284f, 0.207973287f},
-std::array<float,2>{0.375554264f, 0.275678366f},
-std::array<float,2>{0.777028918f, 0.70375067f},
-std::array<float,2>{0.363647521f, 0.968676388f},
-std::array<float,2>{0.96130842f, 0.048036959f},
-std::array<float,2>{0.126441523f, 0.460694939f},
-std::array<float,2>{0.507986963f, 0.560373902f},
-std::array<float,2>{0.040939346f, 0.691566586f},
-std::array<float,2>{0.663295388f, 0.251801312f},
-std::array<float,2>{0.435096443f, 0.192552283f},
-std::array<float,2>{0.803756833f, 0.765368462f},
-std::array<float,2>{0.454775631f, 0.563115478f},
-std::array<float,2>{0.870867014f, 0.389510244f},
-std::array<float,2>{0.106213339f, 0.110837057f},
-std::array<float,2>{0.741183162f, 0.91315484f},
-std::array<float,2>{0.238789767f, 0.866765857f},
-std::array<float,2>{0.571071863f, 0.147073999f},
-std::array<float,2>{0.277749658f, 0.320954293f},
-std::array<float,2>{0.936371267f, 0.67539221f},
-std::array<float,2>{0.397870362f, 0.793418288f},
-std::array<float,2>{0.765489936f, 0.229665607f},
-std::array<float,2>{0.00261644693f, 0.296888143f},
-std::array<float,2>{0.651930988f, 0.721157193f},
-std::array<float,2>{0.17966257f, 0.514912605f},
-std::array<float,2>{0.559330523f, 0.499024898f},
-std::array<float,2>{0.322469652f, 0.00322668231f},
-std::array<float,2>{0.980637074f, 0.970418751f},
-std::array<float,2>{0.297357023f, 0.651594579f},
-std::array<float,2>{0.897385359f, 0.347732574f},
-std::array<float,2>{0.218641967f, 0.176935792f},
-std::array<float,2>{0.597531497f, 0.828197122f},
-std::array<float,2>{0.0794341639f, 0.879970908f},
-std::array<float,2>{0.712300479f, 0.0872945413f},
-std::array<float,2>{0.491869777f, 0.413993567f},
-std::array<float,2>{0.834628344f, 0.621937454f},
-std::array<float,2>{0.315189242f, 0.756608367f},
-std::array<float,2>{0.971311212f, 0.202016294f},
-std::array<float,2>{0.186853826f, 0.258579254f},
-std::array<float,2>{0.550294101f, 0.698733687f},
-std::array<float,2>{0.0140683958f, 0.549276173f},
-std::array<float,2>{0.642297089f, 0.466113567f},
-std::array<float,2>{0.404212087f, 0.0597875603f},
-std::array<float,2>{0.751232803f, 0.95364207f},
-std::array<float,2>{0.496953517f, 0.684097707f},
-std::array<float,2>{0.838057101f, 0.31901589f},
-std::array<float,2>{0.0878024548f, 0.155489266f},
-std::array<float,2>{0.705426335f, 0.867299736f},
-std::array<float,2>{0.208943844f, 0.915899873f},
-std::array<float,2>{0.60873574f, 0.119667783f},
-std::array<float,2>{0.3105582f, 0.382157147f},
-std::array<float,2>{0.900986731f, 0.572578609f},
-std::array<float,2>{0.422160447f, 0.977209151f},
-std::array<float,2>{0.805844605f, 0.0137714585f},
-std::array<float,2>{0.0344279669f, 0.487779796f},
-std::array<float,2>{0.671811879f, 0.502335906f},
-std::array<float,2>{0.134697095f, 0.727662623f},
-std::array<float,2>{0.506187499f, 0.308350801f},
-std::array<float,2>{0.367492467f, 0.219013438f},
-std::array<float,2>{0.954831123f, 0.785628617f},
-std::array<float,2>{0.268077016f, 0.609866261f},
-std::array<float,2>{0.925858259f, 0.417849362f},
-std::array<float,2>{0.245722294f, 0.0854643807f},
-std::array<float,2>{0.568695009f, 0.886407495f},
-std::array<float,2>{0.0945654437f, 0.837002337f},
-std::array<float,2>{0.748439729f, 0.183356941f},
-std::array<float,2>{0.46310547f, 0.354517519f},
-std::array<float,2>{0.861576557f, 0.644145012f},
-std::array<float,2>{0.293054253f, 0.899856627f},
-std::array<float,2>{0.880854309f, 0.065454267f},
-std::array<float,2>{0.197684377f, 0.428083152f},
-std::array<float,2>{0.624616146f, 0.594818592f},
-std::array<float,2>{0.0708894283f, 0.625447512f},
-std::array<float,2>{0.689609706f, 0.361903518f},
-std::array<float,2>{0.476671308f, 0.168350428f},
-std::array<float,2>{0.812684953f, 0.820835352f},
-std::array<float,2>{0.388345718f, 0.518638074f},
-std::array<float,2>{0.769966781f, 0.468828946f},
-std::array<float,2>{0.0290216021f, 0.0277288556f},
-std::array<float,2>{0.629736602f, 0.990374863f},
-std::array<float,2>{0.156471208f, 0.804337144f},
-std::array<float,2>{0.546018064f, 0.24523747f},
-std::array<float,2>{0.332000405f, 0.290475905f},
-std::array<float,2>{0.999118745f, 0.738900959f},
-std::array<float,2>{0.450469375f, 0.854636729f},
-std::array<float,2>{0.849675238f, 0.129442677f},
-std::array<float,2>{0.122716792f, 0.328424186f},
-std::array<float,2>{0.730524719f, 0.666925132f},
-std::array<float,2>{0.230373278f, 0.581610203f},
-std::array<float,2>{0.58164525f, 0.394697011f},
-std::array<float,2>{0.253421724f, 0.105093688f},
-std::array<float,2>{0.919264615f, 0.934023023f},
-std::array<float,2>{0.345905691f, 0.714338124f},
-std::array<float,2>{0.946586728f, 0.272951603f},
-std::array<float,2>{0.149488986f, 0.214152649f},
-std::array<float,2>{0.529444814f, 0.77085197f},
-std::array<float,2>{0.0512067899f, 0.941461205f},
-std::array<float,2>{0.68274796f, 0.04258788f},
-std::array<float,2>{0.420497715f, 0.442537665f},
-std::array<float,2>{0.792780995f, 0.539423704f},
-std::array<float,2>{0.306361496f, 0.805185437f},
-std::array<float,2>{0.904543936f, 0.241066962f},
-std::array<float,2>{0.203733876f, 0.281829178f},
-std::array<float,2>{0.601897717f, 0.743134737f},
-std::array<float,2>{0.0919234455f, 0.524514019f},
-std::array<float,2>{0.710235298f, 0.479589224f},
-std::array<float,2>{0.495536357f, 0.0172578469f},
-std::array<float,2>{0.840734065f, 0.995863736f},
-std::array<float,2>{0.399019003f, 0.640113175f},
-std::array<float,2>{0.756020129f, 0.367396504f},
-std::array<float,2>{0.0105042486f, 0.156773701f},
-std::array<float,2>{0.646850824f, 0.812895119f},
-std::array<float,2>{0.181593433f, 0.894705951f},
-std::array<float,2>{0.553062499f, 0.0775304958f},
-std::array<float,2>{0.317236573f, 0.430487335f},
-std::array<float,2>{0.974090278f, 0.607819378f},
-std::array<float,2>{0.468328476f, 0.947953343f},
-std::array<float,2>{0.866844714f, 0.036075078f},
-std::array<float,2>{0.0986550078f, 0.449362606f},
-std::array<float,2>{0.743162572f, 0.538530529f},
-std::array<float,2>{0.249121442f, 0.70813036f},
-std::array<float,2>{0.564264715f, 0.279318213f},
-std::array<float,2>{0.26984036f, 0.204580471f},
-std::array<float,2>{0.924879074f, 0.776554585f},
-std::array<float,2>{0.37420851f, 0.588128448f},
-std::array<float,2>{0.957195163f, 0.405685544f},
-std::array<float,2>{0.139946446f, 0.100233257f},
-std::array<float,2>{0.502459109f, 0.928834975f},
-std::array<float,2>{0.0388163999f, 0.849510193f},
-std::array<float,2>{0.667796254f, 0.133927569f},
-std::array<float,2>{0.425957561f, 0.340184003f},
-std::array<float,2>{0.810966432f, 0.657944918f},
-std::array<float,2>{0.332038432f, 0.907338381f},
-std::array<float,2>{0.993271112f, 0.114054024f},
-std::array<float,2>{0.160550341f, 0.385868371f},
-std::array<float,2>{0.539285958f, 0.569897234f},
-std::array<float,2>{0.0242230445f, 0.676020622f},
-std::array<float,2>{0.628449082f, 0.327189267f},
-std::array<float,2>{0.386341035f, 0.142076567f},
-std::array<float,2>{0.76723063f, 0.860273063f},
-std::array<float,2>{0.481314242f, 0.557285547f},
-std::array<float,2>{0.818237126f, 0.455852032f},
-std::array<float,2>{0.0775712878f, 0.0538901575f},
-std::array<float,2>{0.691616595f, 0.964343727f},
-std::array<float,2>{0.202630222f, 0.758166552f},
-std::array<float,2>{0.619963229f, 0.188629717f},
-std::array<float,2>{0.289098084f, 0.257456332f},
-std::array<float,2>{0.875196218f, 0.689576328f},
-std::array<float,2>{0.416750908f, 0.83438915f},
-std::array<float,2>{0.795938134f, 0.175185919f},
-std::array<float,2>{0.0479374938f, 0.344592065f},
-std::array<float,2>{0.684441507f, 0.65406394f},
-std::array<float,2>{0.153806522f, 0.619712293f},
-std::array<float,2>{0.526719689f, 0.407197565f},
-std::array<float,2>{0.348934352f, 0.0906442776f},
-std::array<float,2>{0.949773371f, 0.877749979f},
-std::array<float,2>{0.255016208f, 0.722678363f},
-std::array<float,2>{0.915266693f, 0.303281158f},
-std::array<float,2>{0.234364092f, 0.230755538f},
-std::array<float,2>{0.585859597f, 0.789600968f},
-std::array<float,2>{0.117222622f, 0.97638905f},
-std::array<float,2>{0.726892591f, 0.00420730002f},
-std::array<float,2>{0.447966397f, 0.49595952f},
-std::array<float,2>{0.84414351f, 0.509288967f},
-std::array<float,2>{0.356967062f, 0.874063015f},
-std::array<float,2>{0.938077748f, 0.149450853f},
-std::array<float,2>{0.144470856f, 0.315084249f},
-std::array<float,2>{0.516543746f, 0.680556178f},
-std::array<float,2>{0.0620057471f, 0.575218022f},
-std::array<float,2>{0.675090849f, 0.375989914f},
-std::array<float,2>{0.410471916f, 0.122756265f},
-std::array<float,2>{0.784482658f, 0.921259284f},
-std::array<float,2>{0.438000858f, 0.700873315f},
-std::array<float,2>{0.858762145f, 0.26312837f},
-std::array<float,2>{0.109680019f, 0.196005419f},
-std::array<float,2>{0.718901336f, 0.753201067f},
-std::array<float,2>{0.218982309f, 0.959697366f},
-std::array<float,2>{0.590947807f, 0.0571560822f},
-std::array<float,2>{0.261738062f, 0.463996142f},
-std::array<float,2>{0.909205675f, 0.551040888f},
-std::array<float,2>{0.380854219f, 0.890321195f},
-std::array<float,2>{0.778637826f, 0.0793349668f},
-std::array<float,2>{0.01893753f, 0.417984992f},
-std::array<float,2>{0.633157194f, 0.613999605f},
-std::array<float,2>{0.164976776f, 0.645919621f},
-std::array<float,2>{0.535156012f, 0.357364506f},
-std::array<float,2>{0.34075442f, 0.185065508f},
-std::array<float,2>{0.991236866f, 0.840176344f},
-std::array<float,2>{0.286404312f, 0.504753649f},
-std::array<float,2>{0.884579062f, 0.491502225f},
-std::array<float,2>{0.189846754f, 0.00859757885f},
-std::array<float,2>{0.612195075f, 0.981028199f},
-std::array<float,2>{0.0675572976f, 0.782163084f},
-std::array<float,2>{0.699435115f, 0.225117102f},
-std::array<float,2>{0.471378922f, 0.310661793f},
-std::array<float,2>{0.823855996f, 0.732229948f},
-std::array<float,2>{0.276491433f, 0.986950278f},
-std::array<float,2>{0.932338476f, 0.0243179966f},
-std::array<float,2>{0.234389156f, 0.474354774f},
-std::array<float,2>{0.575988412f, 0.521370828f},
-std::array<float,2>{0.103256628f, 0.734725416f},
-std::array<float,2>{0.738170266f, 0.293199718f},
-std::array<float,2>{0.457406819f, 0.247779831f},
-std::array<float,2>{0.871195734f, 0.800551534f},
-std::array<float,2>{0.432498366f, 0.598365724f},
-std::array<float,2>{0.798687518f, 0.422990739f},
-std::array<float,2>{0.0442112871f, 0.0694600418f},
-std::array<float,2>{0.659675956f, 0.902747333f},
-std::array<float,2>{0.129958689f, 0.826450467f},
-std::array<float,2>{0.514109671f, 0.164117977f},
-std::array<float,2>{0.361458451f, 0.367150724f},
-std::array<float,2>{0.966750681f, 0.630302012f},
-std::array<float,2>{0.484545469f, 0.76588577f},
-std::array<float,2>{0.828737378f, 0.216807097f},
-std::array<float,2>{0.0825699344f, 0.267501712f},
-std::array<float,2>{0.716435969f, 0.714923739f},
-std::array<float,2>{0.211853176f, 0.544314086f},
-std::array<float,2>{0.600181341f, 0.43923533f},
-std::array<float,2>{0.30299139f, 0.0458683372f},
-std::array<float,2>{0.892932296f, 0.938801765f},
-std::array<float,2>{0.324431181f, 0.669651687f},
-std::array<float,2>{0.977708876f, 0.332171202f},
-std::array<float,2>{0.174209103f, 0.12759617f},
-std::array<float,2>{0.555414438f, 0.858737826f},
-std::array<float,2>{0.00722551486f, 0.933381617f},
-std::array<float,2>{0.653050482f, 0.108257405f},
-std::array<float,2>{0.392202228f, 0.393048704f},
-std::array<float,2>{0.758894444f, 0.585200965f},
-std::array<float,2>{0.278938293f, 0.864596188f},
-std::array<float,2>{0.937165678f, 0.145398572f},
-std::array<float,2>{0.240097389f, 0.322401464f},
-std::array<float,2>{0.57149893f, 0.672466159f},
-std::array<float,2>{0.106890954f, 0.564527512f},
-std::array<float,2>{0.741406083f, 0.387220591f},
-std::array<float,2>{0.453552186f, 0.112666048f},
-std::array<float,2>{0.869409859f, 0.910178781f},
-std::array<float,2>{0.434350938f, 0.694309115f},
-std::array<float,2>{0.803216219f, 0.252685547f},
-std::array<float,2>{0.039192237f, 0.19521375f},
-std::array<float,2>{0.6625157f, 0.762917638f},
-std::array<float,2>{0.125490427f, 0.965857565f},
-std::array<float,2>{0.509191215f, 0.0495503061f},
-std::array<float,2>{0.36489296f, 0.457648009f},
-std::array<float,2>{0.96202755f, 0.562233806f},
-std::array<float,2>{0.490766168f, 0.881485701f},
-std::array<float,2>{0.835303009f, 0.0879946351f},
-std::array<float,2>{0.0786725804f, 0.410438955f},
-std::array<float,2>{0.711732268f, 0.624183714f},
-std::array<float,2>{0.217485145f, 0.648861468f},
-std::array<float,2>{0.596474588f, 0.350114405f},
-std::array<float,2>{0.298803598f, 0.179284111f},
-std::array<float,2>{0.898388863f, 0.831869543f},
-std::array<float,2>{0.32348156f, 0.513074875f},
-std::array<float,2>{0.981921673f, 0.496314257f},
-std::array<float,2>{0.177750006f, 0.000647433102f},
-std::array<float,2>{0.559871793f, 0.972397745f},
-std::array<float,2>{0.0036135125f, 0.795545042f},
-std::array<float,2>{0.651005864f, 0.226951614f},
-std::array<float,2>{0.397402227f, 0.300395668f},
-std::array<float,2>{0.76416105f, 0.719237208f},
-std::array<float,2>{0.351981133f, 0.999307871f},
-std::array<float,2>{0.941513062f, 0.0229913183f},
-std::array<float,2>{0.145948857f, 0.483196884f},
-std::array<float,2>{0.522162735f, 0.52805829f},
-std::array<float,2>{0.0559153669f, 0.746805847f},
-std::array<float,2>{0.677639961f, 0.285184115f},
-std::array<float,2>{0.408257753f, 0.237701386f},
-std::array<float,2>{0.787784398f, 0.80862534f},
-std::array<float,2>{0.442114651f, 0.603637934f},
-std::array<float,2>{0.854029953f, 0.435148478f},
-std::array<float,2>{0.114043511f, 0.0719873384f},
-std::array<float,2>{0.724744141f, 0.893410325f},
-std::array<float,2>{0.224086806f, 0.816583931f},
-std::array<float,2>{0.589480042f, 0.16072759f},
-std::array<float,2>{0.260433733f, 0.374417752f},
-std::array<float,2>{0.911957085f, 0.635554612f},
-std::array<float,2>{0.376616001f, 0.777814806f},
-std::array<float,2>{0.776004255f, 0.209841609f},
-std::array<float,2>{0.0198346786f, 0.273704201f},
-std::array<float,2>{0.637292147f, 0.705671906f},
-std::array<float,2>{0.169978395f, 0.534631014f},
-std::array<float,2>{0.536505759f, 0.445563912f},
-std::array<float,2>{0.337775916f, 0.0342606641f},
-std::array<float,2>{0.984963953f, 0.953091919f},
-std::array<float,2>{0.284415781f, 0.663975537f},
-std::array<float,2>{0.887347221f, 0.336092532f},
-std::array<float,2>{0.191654265f, 0.138143584f},
-std::array<float,2>{0.614927411f, 0.846836388f},
-std::array<float,2>{0.0647684112f, 0.924031198f},
-std::array<float,2>{0.699094534f, 0.0976061672f},
-std::array<float,2>{0.476244003f, 0.398649156f},
-std::array<float,2>{0.828043997f, 0.590746999f},
-std::array<float,2>{0.330534399f, 0.802545667f},
-std::array<float,2>{0.998839855f, 0.242951721f},
-std::array<float,2>{0.158130169f, 0.292079508f},
-std::array<float,2>{0.545417428f, 0.741575718f},
-std::array<float,2>{0.0276950896f, 0.515841901f},
-std::array<float,2>{0.629953802f, 0.472637445f},
-std::array<float,2>{0.387672901f, 0.0299088452f},
-std::array<float,2>{0.770875394f, 0.98972404f},
-std::array<float,2>{0.478316277f, 0.628674567f},
-std::array<float,2>{0.814313352f, 0.360251546f},
-std::array<float,2>{0.0714950413f, 0.169988662f},
-std::array<float,2>{0.691392541f, 0.823441088f},
-std::array<float,2>{0.19854112f, 0.90182662f},
-std::array<float,2>{0.623771071f, 0.0635652468f},
-std::array<float,2>{0.294229984f, 0.426888853f},
-std::array<float,2>{0.879112422f, 0.597475946f},
-std::array<float,2>{0.42117241f, 0.943762124f},
-std::array<float,2>{0.791537881f, 0.0407011397f},
-std::array<float,2>{0.0527268164f, 0.444754064f},
-std::array<float,2>{0.682059824f, 0.541405201f},
-std::array<float,2>{0.148946926f, 0.711363256f},
-std::array<float,2>{0.531100214f, 0.270312876f},
-std::array<float,2>{0.346848696f, 0.212623373f},
-std::array<float,2>{0.945550501f, 0.773184001f},
-std::array<float,2>{0.252512395f, 0.579256415f},
-std::array<float,2>{0.918836176f, 0.397154808f},
-std::array<float,2>{0.22884734f, 0.103212647f},
-std::array<float,2>{0.580328703f, 0.935789645f},
-std::array<float,2>{0.121329777f, 0.851917207f},
-std::array<float,2>{0.731579363f, 0.131106421f},
-std::array<float,2>{0.450091153f, 0.33195442f},
-std::array<float,2>{0.851154268f, 0.664219737f},
-std::array<float,2>{0.311652839f, 0.917180717f},
-std::array<float,2>{0.901775002f, 0.118289173f},
-std::array<float,2>{0.207170665f, 0.380155474f},
-std::array<float,2>{0.608175099f, 0.570339859f},
-std::array<float,2>{0.0865201429f, 0.687020123f},
-std::array<float,2>{0.706258535f, 0.317189842f},
-std::array<float,2>{0.497516632f, 0.152927741f},
-std::array<float,2>{0.838935316f, 0.870617628f},
-std::array<float,2>{0.40299949f, 0.547654867f},
-std::array<float,2>{0.750638366f, 0.467483968f},
-std::array<float,2>{0.0150701981f, 0.0614507534f},
-std::array<float,2>{0.64102608f, 0.956811309f},
-std::array<float,2>{0.186451837f, 0.754205942f},
-std::array<float,2>{0.548896194f, 0.200477704f},
-std::array<float,2>{0.316286057f, 0.260291398f},
-std::array<float,2>{0.972484171f, 0.696147203f},
-std::array<float,2>{0.464090228f, 0.8379215f},
-std::array<float,2>{0.862404704f, 0.180732518f},
-std::array<float,2>{0.0951768756f, 0.353318125f},
-std::array<float,2>{0.749862432f, 0.640959799f},
-std::array<float,2>{0.245007768f, 0.611990094f},
-std::array<float,2>{0.569961905f, 0.415522665f},
-std::array<float,2>{0.269233435f, 0.0836849436f},
-std::array<float,2>{0.927215219f, 0.884452403f},
-std::array<float,2>{0.368572325f, 0.728622675f},
-std::array<float,2>{0.954039574f, 0.305526286f},
-std::array<float,2>{0.133717075f, 0.221891865f},
-std::array<float,2>{0.507699907f, 0.788964212f},
-std::array<float,2>{0.033974383f, 0.979279399f},
-std::array<float,2>{0.670003176f, 0.0121264085f},
-std::array<float,2>{0.42378974f, 0.486108541f},
-std::array<float,2>{0.805636346f, 0.500388026f},
-std::array<float,2>{0.290110648f, 0.761566997f},
-std::array<float,2>{0.87667197f, 0.191079259f},
-std::array<float,2>{0.201449081f, 0.253966779f},
-std::array<float,2>{0.620202601f, 0.687656283f},
-std::array<float,2>{0.0767952502f, 0.556179345f},
-std::array<float,2>{0.693319261f, 0.453907907f},
-std::array<float,2>{0.481554925f, 0.052551914f},
-std::array<float,2>{0.816808999f, 0.961181343f},
-std::array<float,2>{0.385153353f, 0.679534972f},
-std::array<float,2>{0.766501844f, 0.325531423f},
-std::array<float,2>{0.0253684502f, 0.143342182f},
-std::array<float,2>{0.62746191f, 0.861456871f},
-std::array<float,2>{0.162015378f, 0.90965724f},
-std::array<float,2>{0.540322661f, 0.116416961f},
-std::array<float,2>{0.333459526f, 0.384363621f},
-std::array<float,2>{0.993068278f, 0.568297207f},
-std::array<float,2>{0.448832572f, 0.972874343f},
-std::array<float,2>{0.845103502f, 0.00778130488f},
-std::array<float,2>{0.119096868f, 0.493803889f},
-std::array<float,2>{0.728314638f, 0.510529578f},
-std::array<float,2>{0.23309432f, 0.726258159f},
-std::array<float,2>{0.584648967f, 0.302431911f},
-std::array<float,2>{0.254755616f, 0.233459905f},
-std::array<float,2>{0.914843976f, 0.792279422f},
-std::array<float,2>{0.347830772f, 0.617516398f},
-std::array<float,2>{0.950458169f, 0.408502191f},
-std::array<float,2>{0.153166264f, 0.0927186459f},
-std::array<float,2>{0.525892198f, 0.876206875f},
-std::array<float,2>{0.0478334688f, 0.833103597f},
-std::array<float,2>{0.685386062f, 0.172017261f},
-std::array<float,2>{0.417863876f, 0.346670091f},
-std::array<float,2>{0.795550227f, 0.655320644f},
-std::array<float,2>{0.31805113f, 0.898070812f},
-std::array<float,2>{0.973091424f, 0.075827606f},
-std::array<float,2>{0.180267438f, 0.432210982f},
-std::array<float,2>{0.554499626f, 0.606745362f},
-std::array<float,2>{0.0111325262f, 0.638112664f},
-std::array<float,2>{0.647790253f, 0.370752394f},
-std::array<float,2>{0.399656862f, 0.159565881f},
-std::array<float,2>{0.757181227f, 0.814555168f},
-std::array<float,2>{0.494741708f, 0.526185274f},
-std::array<float,2>{0.841082692f, 0.477619201f},
-std::array<float,2>{0.0937023759f, 0.0181767531f},
-std::array<float,2>{0.709344327f, 0.992665529f},
-std::array<float,2>{0.204959393f, 0.808426976f},
-std::array<float,2>{0.603142619f, 0.239232019f},
-std::array<float,2>{0.305120945f, 0.284305543f},
-std::array<float,2>{0.905760765f, 0.745043159f},
-std::array<float,2>{0.426931828f, 0.8508358f},
-std::array<float,2>{0.812200904f, 0.134939238f},
-std::array<float,2>{0.0377763435f, 0.343143642f},
-std::array<float,2>{0.666234612f, 0.660140455f},
-std::array<float,2>{0.13917993f, 0.587674022f},
-std::array<float,2>{0.503660619f, 0.403632939f},
-std::array<float,2>{0.373075843f, 0.0981888846f},
-std::array<float,2>{0.958586872f, 0.926979125f},
-std::array<float,2>{0.270679355f, 0.70968163f},
-std::array<float,2>{0.924278498f, 0.27749458f},
-std::array<float,2>{0.248838097f, 0.205543056f},
-std::array<float,2>{0.562635541f, 0.774794936f},
-std::array<float,2>{0.0983540639f, 0.946848512f},
-std::array<float,2>{0.743549228f, 0.0376585089f},
-std::array<float,2>{0.467740953f, 0.452858686f},
-std::array<float,2>{0.865292192f, 0.536141872f},
-std::array<float,2>{0.362352818f, 0.826071382f},
-std::array<float,2>{0.965565562f, 0.166796982f},
-std::array<float,2>{0.129720882f, 0.36518079f},
-std::array<float,2>{0.515366495f, 0.630951047f},
-std::array<float,2>{0.0430795029f, 0.60101068f},
-std::array<float,2>{0.658254087f, 0.424743503f},
-std::array<float,2>{0.43341738f, 0.0671012402f},
-std::array<float,2>{0.797334671f, 0.904708922f},
-std::array<float,2>{0.458641142f, 0.73807466f},
-std::array<float,2>{0.872174621f, 0.29569608f},
-std::array<float,2>{0.102521054f, 0.248567477f},
-std::array<float,2>{0.736826956f, 0.798259258f},
-std::array<float,2>{0.235830083f, 0.985709488f},
-std::array<float,2>{0.575169742f, 0.0270801801f},
-std::array<float,2>{0.275488436f, 0.476354927f},
-std::array<float,2>{0.933530569f, 0.522624314f},
-std::array<float,2>{0.39124006f, 0.929848492f},
-std::array<float,2>{0.758725345f, 0.106931061f},
-std::array<float,2>{0.00598474545f, 0.392419696f},
-std::array<float,2>{0.653642714f, 0.583241165f},
-std::array<float,2>{0.174854994f, 0.670004487f},
-std::array<float,2>{0.556085348f, 0.334577531f},
-std::array<float,2>{0.32533288f, 0.12603642f},
-std::array<float,2>{0.976668358f, 0.855759799f},
-std::array<float,2>{0.303790629f, 0.546594083f},
-std::array<float,2>{0.894494057f, 0.44049716f},
-std::array<float,2>{0.212577552f, 0.0429951623f},
-std::array<float,2>{0.601458728f, 0.939648747f},
-std::array<float,2>{0.0832804218f, 0.769342363f},
-std::array<float,2>{0.71576941f, 0.216000184f},
-std::array<float,2>{0.486124128f, 0.269502014f},
-std::array<float,2>{0.829287112f, 0.717389524f},
-std::array<float,2>{0.263116062f, 0.95833075f},
-std::array<float,2>{0.908465624f, 0.0560759082f},
-std::array<float,2>{0.219872966f, 0.461895376f},
-std::array<float,2>{0.590728879f, 0.553051353f},
-std::array<float,2>{0.110395581f, 0.70296067f},
-std::array<float,2>{0.720454514f, 0.264266253f},
-std::array<float,2>{0.438582778f, 0.197870418f},
-std::array<float,2>{0.857788622f, 0.751161039f},
-std::array<float,2>{0.411445081f, 0.577014089f},
-std::array<float,2>{0.783598661f, 0.378628671f},
-std::array<float,2>{0.0612288155f, 0.123691507f},
-std::array<float,2>{0.674142599f, 0.918236554f},
-std::array<float,2>{0.142957166f, 0.87191391f},
-std::array<float,2>{0.51731503f, 0.151035935f},
-std::array<float,2>{0.355932206f, 0.313652724f},
-std::array<float,2>{0.939298034f, 0.682092249f},
-std::array<float,2>{0.472585618f, 0.783350527f},
-std::array<float,2>{0.823186815f, 0.223774657f},
-std::array<float,2>{0.0667576119f, 0.310154825f},
-std::array<float,2>{0.700658321f, 0.732701898f},
-std::array<float,2>{0.191347167f, 0.507514894f},
-std::array<float,2>{0.612579405f, 0.488960266f},
-std::array<float,2>{0.28524223f, 0.0113566583f},
-std::array<float,2>{0.883787453f, 0.984044313f},
-std::array<float,2>{0.340870768f, 0.648222148f},
-std::array<float,2>{0.990372777f, 0.359353811f},
-std::array<float,2>{0.165447161f, 0.185694396f},
-std::array<float,2>{0.533583164f, 0.842698395f},
-std::array<float,2>{0.0181251001f, 0.888045311f},
-std::array<float,2>{0.634001017f, 0.0801789314f},
-std::array<float,2>{0.37961778f, 0.420484424f},
-std::array<float,2>{0.777959704f, 0.617132843f},
-std::array<float,2>{0.29987675f, 0.829291642f},
-std::array<float,2>{0.894633174f, 0.176428318f},
-std::array<float,2>{0.216287106f, 0.349331975f},
-std::array<float,2>{0.595254362f, 0.650828302f},
-std::array<float,2>{0.0815490708f, 0.622713745f},
-std::array<float,2>{0.713846147f, 0.413081884f},
-std::array<float,2>{0.488933444f, 0.0860843956f},
-std::array<float,2>{0.832560241f, 0.879340827f},
-std::array<float,2>{0.395153165f, 0.722244561f},
-std::array<float,2>{0.763358891f, 0.298197985f},
-std::array<float,2>{0.000451668951f, 0.22889401f},
-std::array<float,2>{0.64903152f, 0.794869184f},
-std::array<float,2>{0.176656187f, 0.969616354f},
-std::array<float,2>{0.562129438f, 0.00237443461f},
-std::array<float,2>{0.320642292f, 0.498495311f},
-std::array<float,2>{0.984188437f, 0.514039099f},
-std::array<float,2>{0.455582827f, 0.91286695f},
-std::array<float,2>{0.868080735f, 0.109527819f},
-std::array<float,2>{0.108847968f, 0.389716357f},
-std::array<float,2>{0.738752007f, 0.563964605f},
-std::array<float,2>{0.240276217f, 0.674241424f},
-std::array<float,2>{0.573578179f, 0.322128862f},
-std::array<float,2>{0.280050606f, 0.147620082f},
-std::array<float,2>{0.933606625f, 0.865905821f},
-std::array<float,2>{0.366854548f, 0.559280396f},
-std::array<float,2>{0.963365555f, 0.459611505f},
-std::array<float,2>{0.127751231f, 0.0472592898f},
-std::array<float,2>{0.511184037f, 0.967332721f},
-std::array<float,2>{0.0426707007f, 0.763742089f},
-std::array<float,2>{0.660640836f, 0.191983908f},
-std::array<float,2>{0.435826689f, 0.250808537f},
-std::array<float,2>{0.801309109f, 0.692716897f},
-std::array<float,2>{0.338860542f, 0.950134218f},
-std::array<float,2>{0.986844301f, 0.0331061408f},
-std::array<float,2>{0.16949223f, 0.448157668f},
-std::array<float,2>{0.538003445f, 0.532507539f},
-std::array<float,2>{0.0223107673f, 0.704204321f},
-std::array<float,2>{0.639518797f, 0.276826859f},
-std::array<float,2>{0.377366453f, 0.208432406f},
-std::array<float,2>{0.773758233f, 0.779881299f},
-std::array<float,2>{0.474194646f, 0.592054069f},
-std::array<float,2>{0.825749636f, 0.401108503f},
-std::array<float,2>{0.064283222f, 0.0950273648f},
-std::array<float,2>{0.69671005f, 0.922850192f},
-std::array<float,2>{0.194679394f, 0.845348954f},
-std::array<float,2>{0.617153645f, 0.140455052f},
-std::array<float,2>{0.281832725f, 0.338043094f},
-std::array<float,2>{0.88997227f, 0.661998034f},
-std::array<float,2>{0.40730077f, 0.81138736f},
-std::array<float,2>{0.786611497f, 0.234708875f},
-std::array<float,2>{0.0583015345f, 0.287131548f},
-std::array<float,2>{0.679215431f, 0.748691618f},
-std::array<float,2>{0.148030698f, 0.53112483f},
-std::array<float,2>{0.520312726f, 0.481446326f},
-std::array<float,2>{0.35532552f, 0.0211943444f},
-std::array<float,2>{0.943554521f, 0.996176183f},
-std::array<float,2>{0.258909196f, 0.634478033f},
-std::array<float,2>{0.912613571f, 0.372550458f},
-std::array<float,2>{0.225144878f, 0.162481084f},
-std::array<float,2>{0.585976481f, 0.818746686f},
-std::array<float,2>{0.115241326f, 0.892400563f},
-std::array<float,2>{0.724316239f, 0.0728406012f},
-std::array<float,2>{0.44421187f, 0.437349439f},
-std::array<float,2>{0.852496386f, 0.602673709f},
-std::array<float,2>{0.344730914f, 0.7697348f},
-std::array<float,2>{0.948488712f, 0.213430673f},
-std::array<float,2>{0.150822237f, 0.272338361f},
-std::array<float,2>{0.52895391f, 0.71330446f},
-std::array<float,2>{0.0539141446f, 0.540189862f},
-std::array<float,2>{0.681137145f, 0.441807657f},
-std::array<float,2>{0.418596268f, 0.0419579633f},
-std::array<float,2>{0.789914906f, 0.942733645f},
-std::array<float,2>{0.452951819f, 0.667848468f},
-std::array<float,2>{0.849585235f, 0.329552501f},
-std::array<float,2>{0.124087013f, 0.130517483f},
-std::array<float,2>{0.733069718f, 0.853895664f},
-std::array<float,2>{0.226962253f, 0.934812307f},
-std::array<float,2>{0.579876602f, 0.103767641f},
-std::array<float,2>{0.251942486f, 0.396076947f},
-std::array<float,2>{0.921069443f, 0.580487251f},
-std::array<float,2>{0.388825476f, 0.992163122f},
-std::array<float,2>{0.773430169f, 0.0287000071f},
-std::array<float,2>{0.0308781564f, 0.470167428f},
-std::array<float,2>{0.631380916f, 0.517779946f},
-std::array<float,2>{0.158932731f, 0.739603817f},
-std::array<float,2>{0.542988718f, 0.289350688f},
-std::array<float,2>{0.32947281f, 0.244666114f},
-std::array<float,2>{0.996718466f, 0.803480446f},
-std::array<float,2>{0.295723915f, 0.593792319f},
-std::array<float,2>{0.882309675f, 0.429001659f},
-std::array<float,2>{0.196031079f, 0.0654227138f},
-std::array<float,2>{0.621428728f, 0.898530364f},
-std::array<float,2>{0.0738679841f, 0.821993113f},
-std::array<float,2>{0.68896234f, 0.169718415f},
-std::array<float,2>{0.480187982f, 0.363277256f},
-std::array<float,2>{0.815837145f, 0.626931548f},
-std::array<float,2>{0.266708702f, 0.884821475f},
-std::array<float,2>{0.92822051f, 0.0842561126f},
-std::array<float,2>{0.243281201f, 0.41688183f},
-std::array<float,2>{0.567737639f, 0.611136854f},
-std::array<float,2>{0.0957848355f, 0.642872691f},
-std::array<float,2>{0.74781543f, 0.354175687f},
-std::array<float,2>{0.461136848f, 0.182595581f},
-std::array<float,2>{0.860881567f, 0.836233974f},
-std::array<float,2>{0.424816668f, 0.503023028f},
-std::array<float,2>{0.808539689f, 0.486892641f},
-std::array<float,2>{0.0324344672f, 0.0147672249f},
-std::array<float,2>{0.669649422f, 0.977931559f},
-std::array<float,2>{0.135046706f, 0.786260903f},
-std::array<float,2>{0.504043639f, 0.220264629f},
-std::array<float,2>{0.370367974f, 0.307288229f},
-std::array<float,2>{0.955316305f, 0.726695001f},
-std::array<float,2>{0.498652697f, 0.868666649f},
-std::array<float,2>{0.837868154f, 0.154794291f},
-std::array<float,2>{0.0888631269f, 0.319973737f},
-std::array<float,2>{0.703574598f, 0.684613824f},
-std::array<float,2>{0.209921524f, 0.573859155f},
-std::array<float,2>{0.605650842f, 0.381021559f},
-std::array<float,2>{0.309773117f, 0.120122835f},
-std::array<float,2>{0.899242878f, 0.914848804f},
-std::array<float,2>{0.312963247f, 0.697942734f},
-std::array<float,2>{0.96992439f, 0.259556621f},
-std::array<float,2>{0.184252784f, 0.202518344f},
-std::array<float,2>{0.548423469f, 0.756989419f},
-std::array<float,2>{0.0120389881f, 0.954900622f},
-std::array<float,2>{0.643716335f, 0.0591941923f},
-std::array<float,2>{0.404765099f, 0.465425164f},
-std::array<float,2>{0.753293574f, 0.550415218f},
-std::array<float,2>{0.257003635f, 0.790048063f},
-std::array<float,2>{0.917901039f, 0.231975168f},
-std::array<float,2>{0.231427521f, 0.304629236f},
-std::array<float,2>{0.582802415f, 0.723679185f},
-std::array<float,2>{0.119937077f, 0.508108497f},
-std::array<float,2>{0.729637861f, 0.494871259f},
-std::array<float,2>{0.446947098f, 0.00545895379f},
-std::array<float,2>{0.846351624f, 0.975464523f},
-std::array<float,2>{0.415222168f, 0.653086901f},
-std::array<float,2>{0.793232799f, 0.345130175f},
-std::array<float,2>{0.0502091162f, 0.174287632f},
-std::array<float,2>{0.68650198f, 0.835156083f},
-std::array<float,2>{0.154456243f, 0.878717065f},
-std::array<float,2>{0.524797559f, 0.0914019346f},
-std::array<float,2>{0.35078606f, 0.408030063f},
-std::array<float,2>{0.951884031f, 0.620171487f},
-std::array<float,2>{0.484173417f, 0.963674128f},
-std::array<float,2>{0.819509268f, 0.0535417795f},
-std::array<float,2>{0.0748976246f, 0.456538647f},
-std::array<float,2>{0.695141494f, 0.558482528f},
-std::array<float,2>{0.20008181f, 0.691162765f},
-std::array<float,2>{0.618274868f, 0.256621122f},
-std::array<float,2>{0.291974157f, 0.18781279f},
-std::array<float,2>{0.877434194f, 0.758849502f},
-std::array<float,2>{0.334503621f, 0.568885684f},
-std::array<float,2>{0.995922327f, 0.384998232f},
-std::array<float,2>{0.163440719f, 0.114672698f},
-std::array<float,2>{0.541255951f, 0.906676948f},
-std::array<float,2>{0.0258112717f, 0.86112231f},
-std::array<float,2>{0.625841558f, 0.141297624f},
-std::array<float,2>{0.384652019f, 0.32634899f},
-std::array<float,2>{0.76936239f, 0.677310705f},
-std::array<float,2>{0.371754259f, 0.928326428f},
-std::array<float,2>{0.959960103f, 0.101402506f},
-std::array<float,2>{0.138398692f, 0.405162424f},
-std::array<float,2>{0.500347793f, 0.589096844f},
-std::array<float,2>{0.0352452397f, 0.656504571f},
-std::array<float,2>{0.66570586f, 0.341653377f},
-std::array<float,2>{0.427826941f, 0.133656368f},
-std::array<float,2>{0.809069335f, 0.8480739f},
-std::array<float,2>{0.465172857f, 0.537118793f},
-std::array<float,2>{0.863352597f, 0.450727701f},
-std::array<float,2>{0.0999648422f, 0.0367292799f},
-std::array<float,2>{0.744669497f, 0.948481858f},
-std::array<float,2>{0.246328443f, 0.77572763f},
-std::array<float,2>{0.564629197f, 0.203956231f},
-std::array<float,2>{0.272567898f, 0.280479133f},
-std::array<float,2>{0.92322892f, 0.70795089f},
-std::array<float,2>{0.400649697f, 0.813833058f},
-std::array<float,2>{0.754359186f, 0.157477692f},
-std::array<float,2>{0.00941831246f, 0.368868798f},
-std::array<float,2>{0.644944072f, 0.63892591f},
-std::array<float,2>{0.183159038f, 0.608940184f},
-std::array<float,2>{0.551341891f, 0.430964857f},
-std::array<float,2>{0.318968356f, 0.0765358508f},
-std::array<float,2>{0.976134896f, 0.895792842f},
-std::array<float,2>{0.308083534f, 0.743498147f},
-std::array<float,2>{0.903261185f, 0.282456934f},
-std::array<float,2>{0.206455007f, 0.241975367f},
-std::array<float,2>{0.604138374f, 0.806275189f},
-std::array<float,2>{0.0910612494f, 0.995097935f},
-std::array<float,2>{0.708398104f, 0.0158621445f},
-std::array<float,2>{0.49317944f, 0.478865445f},
-std::array<float,2>{0.841950238f, 0.523674965f},
-std::array<float,2>{0.327567428f, 0.857621789f},
-std::array<float,2>{0.979101777f, 0.128381684f},
-std::array<float,2>{0.173371151f, 0.333902687f},
-std::array<float,2>{0.55842638f, 0.668591559f},
-std::array<float,2>{0.00530733122f, 0.584423661f},
-std::array<float,2>{0.655197144f, 0.394025385f},
-std::array<float,2>{0.394142419f, 0.10850767f},
-std::array<float,2>{0.760855138f, 0.931841314f},
-std::array<float,2>{0.487088293f, 0.716295302f},
-std::array<float,2>{0.830628514f, 0.266192883f},
-std::array<float,2>{0.0845844895f, 0.218099684f},
-std::array<float,2>{0.718114614f, 0.767282784f},
-std::array<float,2>{0.212900519f, 0.938435793f},
-std::array<float,2>{0.598499954f, 0.0467142239f},
-std::array<float,2>{0.301108003f, 0.437847286f},
-std::array<float,2>{0.891902149f, 0.543403029f},
-std::array<float,2>{0.429782122f, 0.904160202f},
-std::array<float,2>{0.799204648f, 0.0692771748f},
-std::array<float,2>{0.0465821549f, 0.422008485f},
-std::array<float,2>{0.657227516f, 0.598645866f},
-std::array<float,2>{0.131008834f, 0.629875779f},
-std::array<float,2>{0.513131618f, 0.365805626f},
-std::array<float,2>{0.360016495f, 0.165133014f},
-std::array<float,2>{0.968408287f, 0.827589989f},
-std::array<float,2>{0.273988575f, 0.520397604f},
-std::array<float,2>{0.931347191f, 0.473595679f},
-std::array<float,2>{0.238085791f, 0.0244205371f},
-std::array<float,2>{0.576515675f, 0.987866879f},
-std::array<float,2>{0.10354206f, 0.798907459f},
-std::array<float,2>{0.735364914f, 0.246998549f},
-std::array<float,2>{0.459228724f, 0.294637769f},
-std::array<float,2>{0.87467891f, 0.735363662f},
-std::array<float,2>{0.28735891f, 0.981451154f},
-std::array<float,2>{0.885885179f, 0.00966656674f},
-std::array<float,2>{0.189357445f, 0.490706652f},
-std::array<float,2>{0.610478878f, 0.50548023f},
-std::array<float,2>{0.068635717f, 0.730686724f},
-std::array<float,2>{0.702793658f, 0.311852187f},
-std::array<float,2>{0.469289124f, 0.226369485f},
-std::array<float,2>{0.821227372f, 0.782258451f},
-std::array<float,2>{0.382356912f, 0.614652097f},
-std::array<float,2>{0.781044781f, 0.419340223f},
-std::array<float,2>{0.0165439472f, 0.0784969851f},
-std::array<float,2>{0.636657715f, 0.888938785f},
-std::array<float,2>{0.166607857f, 0.841223896f},
-std::array<float,2>{0.532508314f, 0.184430525f},
-std::array<float,2>{0.343638331f, 0.355999738f},
-std::array<float,2>{0.989191651f, 0.645163417f},
-std::array<float,2>{0.440210402f, 0.752880394f},
-std::array<float,2>{0.856293619f, 0.196650028f},
-std::array<float,2>{0.112152554f, 0.262153208f},
-std::array<float,2>{0.722156405f, 0.699443221f},
-std::array<float,2>{0.220795631f, 0.552185357f},
-std::array<float,2>{0.593428135f, 0.46352458f},
-std::array<float,2>{0.264476985f, 0.0577748492f},
-std::array<float,2>{0.907430053f, 0.960569322f},
-std::array<float,2>{0.359297335f, 0.681149185f},
-std::array<float,2>{0.939529598f, 0.316375107f},
-std::array<float,2>{0.141725332f, 0.148824558f},
-std::array<float,2>{0.518940687f, 0.873824537f},
-std::array<float,2>{0.0605189577f, 0.920897543f},
-std::array<float,2>{0.672117352f, 0.121839829f},
-std::array<float,2>{0.412573159f, 0.375368446f},
-std::array<float,2>{0.781876504f, 0.574479818f},
-std::array<float,2>{0.292801112f, 0.861756206f},
-std::array<float,2>{0.878495872f, 0.143105239f},
-std::array<float,2>{0.200694963f, 0.325431734f},
-std::array<float,2>{0.617757559f, 0.679343045f},
-std::array<float,2>{0.0754202232f, 0.567873836f},
-std::array<float,2>{0.693374515f, 0.384724647f},
-std::array<float,2>{0.483255386f, 0.116579525f},
-std::array<float,2>{0.818947613f, 0.909310937f},
-std::array<float,2>{0.383184671f, 0.687750936f},
-std::array<float,2>{0.767926931f, 0.254299492f},
-std::array<float,2>{0.026789438f, 0.191168204f},
-std::array<float,2>{0.626472652f, 0.761377692f},
-std::array<float,2>{0.162243649f, 0.961250126f},
-std::array<float,2>{0.542152345f, 0.0524335951f},
-std::array<float,2>{0.335099638f, 0.453696519f},
-std::array<float,2>{0.994774878f, 0.556488633f},
-std::array<float,2>{0.446050227f, 0.876418114f},
-std::array<float,2>{0.846981049f, 0.092329368f},
-std::array<float,2>{0.120594889f, 0.408290654f},
-std::array<float,2>{0.728542089f, 0.617382467f},
-std::array<float,2>{0.23232685f, 0.655551791f},
-std::array<float,2>{0.583191514f, 0.346258283f},
-std::array<float,2>{0.256557077f, 0.172175676f},
-std::array<float,2>{0.916183412f, 0.833360374f},
-std::array<float,2>{0.350349814f, 0.510402083f},
-std::array<float,2>{0.9528808f, 0.494033992f},
-std::array<float,2>{0.156064853f, 0.00734237116f},
-std::array<float,2>{0.52353698f, 0.97306031f},
-std::array<float,2>{0.0491930135f, 0.792196393f},
-std::array<float,2>{0.686914444f, 0.233802631f},
-std::array<float,2>{0.415013134f, 0.302651733f},
-std::array<float,2>{0.794912696f, 0.726407468f},
-std::array<float,2>{0.320033759f, 0.992281973f},
-std::array<float,2>{0.975577235f, 0.0183275379f},
-std::array<float,2>{0.182446301f, 0.477862179f},
-std::array<float,2>{0.552092612f, 0.525882304f},
-std::array<float,2>{0.00834592711f, 0.744869471f},
-std::array<float,2>{0.646364987f, 0.284550875f},
-std::array<float,2>{0.401494473f, 0.238943458f},
-std::array<float,2>{0.755228758f, 0.808204114f},
-std::array<float,2>{0.492524266f, 0.60653007f},
-std::array<float,2>{0.842788815f, 0.432518154f},
-std::array<float,2>{0.0905613899f, 0.0760306045f},
-std::array<float,2>{0.707371831f, 0.89838773f},
-std::array<float,2>{0.205740422f, 0.814863145f},
-std::array<float,2>{0.605363488f, 0.159308165f},
-std::array<float,2>{0.307598621f, 0.370910466f},
-std::array<float,2>{0.903846025f, 0.637714803f},
-std::array<float,2>{0.428993225f, 0.774436951f},
-std::array<float,2>{0.810441852f, 0.205081329f},
-std::array<float,2>{0.036428079f, 0.277706414f},
-std::array<float,2>{0.664899051f, 0.70989114f},
-std::array<float,2>{0.137634456f, 0.536428869f},
-std::array<float,2>{0.501551688f, 0.452897191f},
-std::array<float,2>{0.372967452f, 0.0380742699f},
-std::array<float,2>{0.960644364f, 0.947139919f},
-std::array<float,2>{0.272109389f, 0.659891427f},
-std::array<float,2>{0.922463417f, 0.342963845f},
-std::array<float,2>{0.247825772f, 0.135092065f},
-std::array<float,2>{0.565856516f, 0.850646675f},
-std::array<float,2>{0.101087466f, 0.927029312f},
-std::array<float,2>{0.745700061f, 0.0985430032f},
-std::array<float,2>{0.466471732f, 0.403562039f},
-std::array<float,2>{0.864924848f, 0.587492228f},
-std::array<float,2>{0.36035192f, 0.797964931f},
-std::array<float,2>{0.967587829f, 0.248878539f},
-std::array<float,2>{0.132732123f, 0.295631617f},
-std::array<float,2>{0.512068212f, 0.737820089f},
-std::array<float,2>{0.0451870598f, 0.522748828f},
-std::array<float,2>{0.657114029f, 0.476083994f},
-std::array<float,2>{0.431233287f, 0.02713833f},
-std::array<float,2>{0.799871624f, 0.985525429f},
-std::array<float,2>{0.460206538f, 0.631312072f},
-std::array<float,2>{0.873825788f, 0.364809632f},
-std::array<float,2>{0.105069019f, 0.166541308f},
-std::array<float,2>{0.73457849f, 0.825900912f},
-std::array<float,2>{0.236373872f, 0.904458821f},
-std::array<float,2>{0.577250838f, 0.0671892762f},
-std::array<float,2>{0.275141001f, 0.42438221f},
-std::array<float,2>{0.929705024f, 0.600593805f},
-std::array<float,2>{0.392847359f, 0.939840794f},
-std::array<float,2>{0.760526836f, 0.0433698036f},
-std::array<float,2>{0.00425378699f, 0.440848529f},
-std::array<float,2>{0.656086564f, 0.546640217f},
-std::array<float,2>{0.171879128f, 0.717724562f},
-std::array<float,2>{0.557274282f, 0.269182712f},
-std::array<float,2>{0.327072859f, 0.216137737f},
-std::array<float,2>{0.980410039f, 0.769077361f},
-std::array<float,2>{0.30182308f, 0.583394587f},
-std::array<float,2>{0.890751481f, 0.392238021f},
-std::array<float,2>{0.214298889f, 0.106532f},
-std::array<float,2>{0.599236965f, 0.930065632f},
-std::array<float,2>{0.0853366181f, 0.855512679f},
-std::array<float,2>{0.716956317f, 0.126298502f},
-std::array<float,2>{0.48822552f, 0.334958702f},
-std::array<float,2>{0.831769407f, 0.670214593f},
-std::array<float,2>{0.265340507f, 0.918121696f},
-std::array<float,2>{0.906613111f, 0.123958647f},
-std::array<float,2>{0.221959114f, 0.378782421f},
-std::array<float,2>{0.591825724f, 0.576685429f},
-std::array<float,2>{0.112369455f, 0.681806445f},
-std::array<float,2>{0.720909774f, 0.313794225f},
-std::array<float,2>{0.441008657f, 0.151160836f},
-std::array<float,2>{0.857394159f, 0.871644437f},
-std::array<float,2>{0.413504869f, 0.552818596f},
-std::array<float,2>{0.782464981f, 0.461562455f},
-std::array<float,2>{0.0587148815f, 0.0556940287f},
-std::array<float,2>{0.673628807f, 0.958138406f},
-std::array<float,2>{0.141014248f, 0.751402259f},
-std::array<float,2>{0.51841104f, 0.198175117f},
-std::array<float,2>{0.358142674f, 0.264461845f},
-std::array<float,2>{0.940841675f, 0.702778339f},
-std::array<float,2>{0.47057727f, 0.842471957f},
-std::array<float,2>{0.821832597f, 0.185844451f},
-std::array<float,2>{0.0703038648f, 0.359075338f},
-std::array<float,2>{0.701208711f, 0.648048103f},
-std::array<float,2>{0.187522396f, 0.616839349f},
-std::array<float,2>{0.609932661f, 0.420701534f},
-std::array<float,2>{0.288931608f, 0.0803416967f},
-std::array<float,2>{0.884775341f, 0.887846768f},
-std::array<float,2>{0.341816127f, 0.732563674f},
-std::array<float,2>{0.98947686f, 0.310373187f},
-std::array<float,2>{0.167474911f, 0.22401765f},
-std::array<float,2>{0.531587422f, 0.783482611f},
-std::array<float,2>{0.0171321426f, 0.984196246f},
-std::array<float,2>{0.635456383f, 0.011496637f},
-std::array<float,2>{0.381024182f, 0.489171535f},
-std::array<float,2>{0.779954314f, 0.507607281f},
-std::array<float,2>{0.281177372f, 0.763014615f},
-std::array<float,2>{0.935460031f, 0.194928601f},
-std::array<float,2>{0.241839513f, 0.252868623f},
-std::array<float,2>{0.572497666f, 0.693887711f},
-std::array<float,2>{0.10761027f, 0.562376916f},
-std::array<float,2>{0.739301741f, 0.457778633f},
-std::array<float,2>{0.456599712f, 0.0497512296f},
-std::array<float,2>{0.869104147f, 0.966272891f},
-std::array<float,2>{0.436547875f, 0.672757566f},
-std::array<float,2>{0.802625537f, 0.322705299f},
-std::array<float,2>{0.0413749367f, 0.14503254f},
-std::array<float,2>{0.661531746f, 0.864364803f},
-std::array<float,2>{0.128536955f, 0.910601437f},
-std::array<float,2>{0.510024309f, 0.112335145f},
-std::array<float,2>{0.365480572f, 0.387582451f},
-std::array<float,2>{0.964334309f, 0.564929605f},
-std::array<float,2>{0.490210652f, 0.972555339f},
-std::array<float,2>{0.833693981f, 0.000944318657f},
-std::array<float,2>{0.0807474777f, 0.496445984f},
-std::array<float,2>{0.714521945f, 0.512697875f},
-std::array<float,2>{0.214925453f, 0.718801558f},
-std::array<float,2>{0.594260395f, 0.300613552f},
-std::array<float,2>{0.299219489f, 0.226799384f},
-std::array<float,2>{0.89631182f, 0.795799434f},
-std::array<float,2>{0.321772307f, 0.624343872f},
-std::array<float,2>{0.98262769f, 0.410259187f},
-std::array<float,2>{0.177595913f, 0.0881972089f},
-std::array<float,2>{0.561004221f, 0.881768823f},
-std::array<float,2>{0.00104850403f, 0.831731915f},
-std::array<float,2>{0.649468601f, 0.179497585f},
-std::array<float,2>{0.396026105f, 0.350375235f},
-std::array<float,2>{0.762124538f, 0.648486137f},
-std::array<float,2>{0.35392803f, 0.893282115f},
-std::array<float,2>{0.945116818f, 0.0720786378f},
-std::array<float,2>{0.147338733f, 0.435508907f},
-std::array<float,2>{0.521373093f, 0.603822649f},
-std::array<float,2>{0.0572257452f, 0.635399103f},
-std::array<float,2>{0.677832782f, 0.374105215f},
-std::array<float,2>{0.406265259f, 0.160936624f},
-std::array<float,2>{0.786072969f, 0.816706121f},
-std::array<float,2>{0.444587111f, 0.52819103f},
-std::array<float,2>{0.853244841f, 0.48310402f},
-std::array<float,2>{0.116299979f, 0.0233988389f},
-std::array<float,2>{0.723272383f, 0.99908036f},
-std::array<float,2>{0.22617735f, 0.80900234f},
-std::array<float,2>{0.58739537f, 0.237523094f},
-std::array<float,2>{0.258589149f, 0.285434216f},
-std::array<float,2>{0.913373351f, 0.746906817f},
-std::array<float,2>{0.378783315f, 0.846987605f},
-std::array<float,2>{0.774470687f, 0.137822658f},
-std::array<float,2>{0.0229546092f, 0.336230248f},
-std::array<float,2>{0.640532315f, 0.663714051f},
-std::array<float,2>{0.168599442f, 0.590334594f},
-std::array<float,2>{0.538199365f, 0.398920208f},
-std::array<float,2>{0.339817405f, 0.0972602144f},
-std::array<float,2>{0.988148689f, 0.924212456f},
-std::array<float,2>{0.282267272f, 0.705932379f},
-std::array<float,2>{0.888728738f, 0.273491472f},
-std::array<float,2>{0.194068104f, 0.209566861f},
-std::array<float,2>{0.615245104f, 0.777346671f},
-std::array<float,2>{0.0634720698f, 0.952660263f},
-std::array<float,2>{0.696156681f, 0.0346365795f},
-std::array<float,2>{0.473564327f, 0.445404053f},
-std::array<float,2>{0.824299991f, 0.534392238f},
-std::array<float,2>{0.328578174f, 0.823593259f},
-std::array<float,2>{0.997652411f, 0.170236081f},
-std::array<float,2>{0.160009935f, 0.360015064f},
-std::array<float,2>{0.544191778f, 0.628529191f},
-std::array<float,2>{0.0293326918f, 0.597372651f},
-std::array<float,2>{0.631869256f, 0.427132189f},
-std::array<float,2>{0.389971286f, 0.0638295785f},
-std::array<float,2>{0.771673262f, 0.901588619f},
-std::array<float,2>{0.479040235f, 0.741241455f},
-std::array<float,2>{0.814908504f, 0.292452872f},
-std::array<float,2>{0.0731026232f, 0.242784396f},
-std::array<float,2>{0.688200116f, 0.802378654f},
-std::array<float,2>{0.196901903f, 0.989315212f},
-std::array<float,2>{0.622157276f, 0.0301986672f},
-std::array<float,2>{0.296717793f, 0.472225577f},
-std::array<float,2>{0.881412506f, 0.515898347f},
-std::array<float,2>{0.419703484f, 0.935966969f},
-std::array<float,2>{0.790859818f, 0.103455752f},
-std::array<float,2>{0.0532044321f, 0.397223562f},
-std::array<float,2>{0.680089772f, 0.579405725f},
-std::array<float,2>{0.152203158f, 0.664442837f},
-std::array<float,2>{0.527528048f, 0.331613958f},
-std::array<float,2>{0.343816549f, 0.130966276f},
-std::array<float,2>{0.947872519f, 0.851769567f},
-std::array<float,2>{0.250720292f, 0.541181505f},
-std::array<float,2>{0.920371592f, 0.444550514f},
-std::array<float,2>{0.227928579f, 0.041009143f},
-std::array<float,2>{0.578376651f, 0.94358933f},
-std::array<float,2>{0.123341642f, 0.773407161f},
-std::array<float,2>{0.733734071f, 0.212789163f},
-std::array<float,2>{0.451734304f, 0.270233572f},
-std::array<float,2>{0.848519385f, 0.711037755f},
-std::array<float,2>{0.309208363f, 0.956770658f},
-std::array<float,2>{0.899534404f, 0.0611128509f},
-std::array<float,2>{0.210866705f, 0.467772573f},
-std::array<float,2>{0.607087314f, 0.547559321f},
-std::array<float,2>{0.0893290713f, 0.695863664f},
-std::array<float,2>{0.704487443f, 0.26067245f},
-std::array<float,2>{0.499042898f, 0.200385973f},
-std::array<float,2>{0.836664677f, 0.754093885f},
-std::array<float,2>{0.406071633f, 0.570667148f},
-std::array<float,2>{0.752024055f, 0.380063415f},
-std::array<float,2>{0.0128403446f, 0.118612722f},
-std::array<float,2>{0.642667174f, 0.917249143f},
-std::array<float,2>{0.185418576f, 0.870895505f},
-std::array<float,2>{0.546989739f, 0.153297409f},
-std::array<float,2>{0.313919306f, 0.317002386f},
-std::array<float,2>{0.969317436f, 0.687309623f},
-std::array<float,2>{0.462631822f, 0.788623333f},
-std::array<float,2>{0.860234976f, 0.222031534f},
-std::array<float,2>{0.0974352658f, 0.305419266f},
-std::array<float,2>{0.74679184f, 0.728865385f},
-std::array<float,2>{0.242999479f, 0.500031531f},
-std::array<float,2>{0.567117453f, 0.485993624f},
-std::array<float,2>{0.266249567f, 0.0118074408f},
-std::array<float,2>{0.929043353f, 0.979176641f},
-std::array<float,2>{0.369651526f, 0.640679598f},
-std::array<float,2>{0.956312001f, 0.353073061f},
-std::array<float,2>{0.136699587f, 0.181028709f},
-std::array<float,2>{0.505585968f, 0.838200033f},
-std::array<float,2>{0.0317716859f, 0.884576678f},
-std::array<float,2>{0.668184519f, 0.0837835073f},
-std::array<float,2>{0.424587578f, 0.415167451f},
-std::array<float,2>{0.807208359f, 0.612192512f},
-std::array<float,2>{0.255636632f, 0.835371494f},
-std::array<float,2>{0.915617764f, 0.174012199f},
-std::array<float,2>{0.233671054f, 0.344885498f},
-std::array<float,2>{0.584989727f, 0.652984381f},
-std::array<float,2>{0.118003748f, 0.62040174f},
-std::array<float,2>{0.727265596f, 0.407842994f},
-std::array<float,2>{0.447645694f, 0.0917045102f},
-std::array<float,2>{0.84433496f, 0.87851727f},
-std::array<float,2>{0.416180283f, 0.724000216f},
-std::array<float,2>{0.796545446f, 0.304367065f},
-std::array<float,2>{0.0488134958f, 0.232279703f},
-std::array<float,2>{0.683694184f, 0.790303767f},
-std::array<float,2>{0.153916419f, 0.975174189f},
-std::array<float,2>{0.527001262f, 0.00566532835f},
-std::array<float,2>{0.349234164f, 0.495093852f},
-std::array<float,2>{0.949670136f, 0.508041322f},
-std::array<float,2>{0.48056832f, 0.906438768f},
-std::array<float,2>{0.817703366f, 0.114476942f},
-std::array<float,2>{0.0778884217f, 0.385233939f},
-std::array<float,2>{0.692197084f, 0.569106996f},
-std::array<float,2>{0.203067169f, 0.677535713f},
-std::array<float,2>{0.619521499f, 0.326482147f},
-std::array<float,2>{0.289904356f, 0.141361639f},
-std::array<float,2>{0.875819862f, 0.861030161f},
-std::array<float,2>{0.332831442f, 0.558174372f},
-std::array<float,2>{0.994064569f, 0.456063867f},
-std::array<float,2>{0.160928562f, 0.053374365f},
-std::array<float,2>{0.539698422f, 0.963620305f},
-std::array<float,2>{0.0238811616f, 0.759203196f},
-std::array<float,2>{0.628403604f, 0.187544957f},
-std::array<float,2>{0.386139542f, 0.256466687f},
-std::array<float,2>{0.766973972f, 0.690950155f},
-std::array<float,2>{0.374931127f, 0.948496163f},
-std::array<float,2>{0.957579195f, 0.0369209312f},
-std::array<float,2>{0.140152156f, 0.450984329f},
-std::array<float,2>{0.502390444f, 0.537587523f},
-std::array<float,2>{0.0382599197f, 0.707664728f},
-std::array<float,2>{0.66720736f, 0.280521363f},
-std::array<float,2>{0.426677316f, 0.203827858f},
-std::array<float,2>{0.811381459f, 0.775520086f},
-std::array<float,2>{0.467961311f, 0.58924824f},
-std::array<float,2>{0.866606116f, 0.404827118f},
-std::array<float,2>{0.0992999002f, 0.101190038f},
-std::array<float,2>{0.742324054f, 0.928542435f},
-std::array<float,2>{0.249978289f, 0.847683549f},
-std::array<float,2>{0.563710153f, 0.133473963f},
-std::array<float,2>{0.270295441f, 0.341452211f},
-std::array<float,2>{0.925453961f, 0.656376898f},
-std::array<float,2>{0.398477137f, 0.806412041f},
-std::array<float,2>{0.756640911f, 0.241813332f},
-std::array<float,2>{0.00998437498f, 0.282690257f},
-std::array<float,2>{0.647265077f, 0.74338752f},
-std::array<float,2>{0.180814043f, 0.52390635f},
-std::array<float,2>{0.553380191f, 0.478751868f},
-std::array<float,2>{0.316812783f, 0.0160575081f},
-std::array<float,2>{0.974394798f, 0.994754374f},
-std::array<float,2>{0.305791557f, 0.638822913f},
-std::array<float,2>{0.905213892f, 0.369021207f},
-std::array<float,2>{0.203212008f, 0.157336816f},
-std::array<float,2>{0.602108896f, 0.813698471f},
-std::array<float,2>{0.0927489549f, 0.895520091f},
-std::array<float,2>{0.710900784f, 0.0762043297f},
-std::array<float,2>{0.495942384f, 0.430775732f},
-std::array<float,2>{0.839871466f, 0.609218836f},
-std::array<float,2>{0.324901849f, 0.767518938f},
-std::array<float,2>{0.978273928f, 0.217911154f},
-std::array<float,2>{0.17440626f, 0.266566128f},
-std::array<float,2>{0.555164933f, 0.715970039f},
-std::array<float,2>{0.0077253757f, 0.543158054f},
-std::array<float,2>{0.652388036f, 0.437571615f},
-std::array<float,2>{0.391929448f, 0.0464991517f},
-std::array<float,2>{0.75949806f, 0.938061953f},
-std::array<float,2>{0.484919995f, 0.668708861f},
-std::array<float,2>{0.828573883f, 0.333683878f},
-std::array<float,2>{0.0822917968f, 0.128161415f},
-std::array<float,2>{0.715976357f, 0.857679665f},
-std::array<float,2>{0.211104527f, 0.932034552f},
-std::array<float,2>{0.599752128f, 0.108749762f},
-std::array<float,2>{0.303702295f, 0.393760949f},
-std::array<float,2>{0.893137574f, 0.584115863f},
-std::array<float,2>{0.431961298f, 0.988141716f},
-std::array<float,2>{0.79828918f, 0.024838537f},
-std::array<float,2>{0.0444972292f, 0.473381937f},
-std::array<float,2>{0.659209788f, 0.520142794f},
-std::array<float,2>{0.13049075f, 0.73574084f},
-std::array<float,2>{0.514583051f, 0.294879526f},
-std::array<float,2>{0.362262666f, 0.246682122f},
-std::array<float,2>{0.966178656f, 0.799304664f},
-std::array<float,2>{0.276871622f, 0.599095106f},
-std::array<float,2>{0.931895971f, 0.422304302f},
-std::array<float,2>{0.234947175f, 0.0688783899f},
-std::array<float,2>{0.575202107f, 0.903830528f},
-std::array<float,2>{0.103017643f, 0.827229261f},
-std::array<float,2>{0.737552106f, 0.165286347f},
-std::array<float,2>{0.457849115f, 0.366152018f},
-std::array<float,2>{0.871926367f, 0.629414082f},
-std::array<float,2>{0.286722332f, 0.888903797f},
-std::array<float,2>{0.884167552f, 0.0782861561f},
-std::array<float,2>{0.190144345f, 0.419056356f},
-std::array<float,2>{0.611430764f, 0.61428082f},
-std::array<float,2>{0.0682418942f, 0.645368397f},
-std::array<float,2>{0.699865699f, 0.356354743f},
-std::array<float,2>{0.471053362f, 0.1841297f},
-std::array<float,2>{0.823403716f, 0.841020882f},
-std::array<float,2>{0.380194485f, 0.505762577f},
-std::array<float,2>{0.779160023f, 0.490274101f},
-std::array<float,2>{0.0191220287f, 0.00948575418f},
-std::array<float,2>{0.633628488f, 0.98177284f},
-std::array<float,2>{0.16429393f, 0.782714069f},
-std::array<float,2>{0.534591854f, 0.226237014f},
-std::array<float,2>{0.340049952f, 0.31168884f},
-std::array<float,2>{0.992167473f, 0.73090291f},
-std::array<float,2>{0.437678427f, 0.873641193f},
-std::array<float,2>{0.859171212f, 0.148622811f},
-std::array<float,2>{0.10991817f, 0.31615448f},
-std::array<float,2>{0.719698489f, 0.68067342f},
-std::array<float,2>{0.219606027f, 0.574247837f},
-std::array<float,2>{0.591521084f, 0.37522465f},
-std::array<float,2>{0.26267755f, 0.121679865f},
-std::array<float,2>{0.910036504f, 0.920624375f},
-std::array<float,2>{0.356664032f, 0.699555695f},
-std::array<float,2>{0.937536776f, 0.261898458f},
-std::array<float,2>{0.143568933f, 0.196307629f},
-std::array<float,2>{0.515695155f, 0.752486825f},
-std::array<float,2>{0.0620319024f, 0.960744441f},
-std::array<float,2>{0.675302029f, 0.0580248311f},
-std::array<float,2>{0.410782844f, 0.463828415f},
-std::array<float,2>{0.784856677f, 0.551868021f},
-std::array<float,2>{0.297664583f, 0.794487f},
-std::array<float,2>{0.896570683f, 0.228528529f},
-std::array<float,2>{0.218109667f, 0.297893465f},
-std::array<float,2>{0.597076654f, 0.722429991f},
-std::array<float,2>{0.0796963722f, 0.513817966f},
-std::array<float,2>{0.712780535f, 0.498233914f},
-std::array<float,2>{0.491614908f, 0.0021624465f},
-std::array<float,2>{0.834437132f, 0.969394267f},
-std::array<float,2>{0.398090541f, 0.650462031f},
-std::array<float,2>{0.76496309f, 0.349486172f},
-std::array<float,2>{0.00227959082f, 0.1766451f},
-std::array<float,2>{0.651671469f, 0.829554081f},
-std::array<float,2>{0.17878902f, 0.879027128f},
-std::array<float,2>{0.558697343f, 0.0863460749f},
-std::array<float,2>{0.322886795f, 0.41272375f},
-std::array<float,2>{0.98130852f, 0.622982979f},
-std::array<float,2>{0.454248428f, 0.967695653f},
-std::array<float,2>{0.870257139f, 0.047066614f},
-std::array<float,2>{0.105752409f, 0.459822446f},
-std::array<float,2>{0.740329325f, 0.559353471f},
-std::array<float,2>{0.238295943f, 0.692607045f},
-std::array<float,2>{0.570745111f, 0.25069952f},
-std::array<float,2>{0.277869582f, 0.192379937f},
-std::array<float,2>{0.935806692f, 0.764068127f},
-std::array<float,2>{0.364114463f, 0.563549995f},
-std::array<float,2>{0.961621344f, 0.389955282f},
-std::array<float,2>{0.126882434f, 0.109693773f},
-std::array<float,2>{0.508740902f, 0.912674606f},
-std::array<float,2>{0.0400636606f, 0.866072118f},
-std::array<float,2>{0.66375047f, 0.147912398f},
-std::array<float,2>{0.434830725f, 0.32187131f},
-std::array<float,2>{0.804492474f, 0.674036562f},
-std::array<float,2>{0.335966706f, 0.922600031f},
-std::array<float,2>{0.98617214f, 0.0949276984f},
-std::array<float,2>{0.171032801f, 0.40116322f},
-std::array<float,2>{0.535633802f, 0.592024565f},
-std::array<float,2>{0.0206572488f, 0.661785781f},
-std::array<float,2>{0.638256371f, 0.338307112f},
-std::array<float,2>{0.375156343f, 0.140180513f},
-std::array<float,2>{0.776496589f, 0.845642805f},
-std::array<float,2>{0.474737436f, 0.532328963f},
-std::array<float,2>{0.826909721f, 0.447908401f},
-std::array<float,2>{0.0657538772f, 0.0328441672f},
-std::array<float,2>{0.697705984f, 0.949920535f},
-std::array<float,2>{0.192495421f, 0.78005749f},
-std::array<float,2>{0.614099205f, 0.208240658f},
-std::array<float,2>{0.283547908f, 0.276516944f},
-std::array<float,2>{0.888257861f, 0.704582393f},
-std::array<float,2>{0.409243286f, 0.818513453f},
-std::array<float,2>{0.788583457f, 0.162281185f},
-std::array<float,2>{0.0547785014f, 0.372079164f},
-std::array<float,2>{0.67651087f, 0.63454026f},
-std::array<float,2>{0.144531682f, 0.60292846f},
-std::array<float,2>{0.523365557f, 0.437191844f},
-std::array<float,2>{0.352821708f, 0.0730428994f},
-std::array<float,2>{0.942750573f, 0.892332077f},
-std::array<float,2>{0.26087302f, 0.748947561f},
-std::array<float,2>{0.91022259f, 0.287584841f},
-std::array<float,2>{0.222909912f, 0.234599456f},
-std::array<float,2>{0.58882618f, 0.811038852f},
-std::array<float,2>{0.115208887f, 0.996359587f},
-std::array<float,2>{0.725904286f, 0.021365406f},
-std::array<float,2>{0.44265449f, 0.481718063f},
-std::array<float,2>{0.855147779f, 0.530936897f},
-std::array<float,2>{0.346229672f, 0.853568077f},
-std::array<float,2>{0.947132885f, 0.13078706f},
-std::array<float,2>{0.150328085f, 0.329163671f},
-std::array<float,2>{0.529790401f, 0.667562664f},
-std::array<float,2>{0.0514870137f, 0.580257773f},
-std::array<float,2>{0.683165789f, 0.396321028f},
-std::array<float,2>{0.419959337f, 0.103666477f},
-std::array<float,2>{0.792167783f, 0.935006797f},
-std::array<float,2>{0.451099306f, 0.71295172f},
-std::array<float,2>{0.850336254f, 0.272024781f},
-std::array<float,2>{0.122220822f, 0.213631719f},
-std::array<float,2>{0.731152356f, 0.769813597f},
-std::array<float,2>{0.229652718f, 0.942466259f},
-std::array<float,2>{0.581426203f, 0.041730199f},
-std::array<float,2>{0.25310421f, 0.441519231f},
-std::array<float,2>{0.919504046f, 0.540401399f},
-std::array<float,2>{0.388032585f, 0.898870528f},
-std::array<float,2>{0.770291388f, 0.0651840046f},
-std::array<float,2>{0.0283780079f, 0.428897083f},
-std::array<float,2>{0.629315078f, 0.594097733f},
-std::array<float,2>{0.156860128f, 0.626588583f},
-std::array<float,2>{0.546597123f, 0.362824619f},
-std::array<float,2>{0.331060469f, 0.169542715f},
-std::array<float,2>{0.999666154f, 0.822124183f},
-std::array<float,2>{0.293468714f, 0.517929673f},
-std::array<float,2>{0.880185664f, 0.469732821f},
-std::array<float,2>{0.19814302f, 0.028560441f},
-std::array<float,2>{0.624474823f, 0.991752982f},
-std::array<float,2>{0.0704193488f, 0.80344373f},
-std::array<float,2>{0.689982355f, 0.244981483f},
-std::array<float,2>{0.477138251f, 0.289116204f},
-std::array<float,2>{0.813080609f, 0.7394557f},
-std::array<float,2>{0.267652452f, 0.977616251f},
-std::array<float,2>{0.926485121f, 0.0150090791f},
-std::array<float,2>{0.245311052f, 0.48718673f},
-std::array<float,2>{0.569224596f, 0.503329039f},
-std::array<float,2>{0.094042778f, 0.72701627f},
-std::array<float,2>{0.74855113f, 0.30739817f},
-std::array<float,2>{0.463474154f, 0.220639765f},
-std::array<float,2>{0.861998141f, 0.786426544f},
-std::array<float,2>{0.422705024f, 0.61098057f},
-std::array<float,2>{0.806552649f, 0.416732699f},
-std::array<float,2>{0.0348217227f, 0.0841905251f},
-std::array<float,2>{0.671260118f, 0.885227978f},
-std::array<float,2>{0.133981496f, 0.836063147f},
-std::array<float,2>{0.5068326f, 0.18214725f},
-std::array<float,2>{0.367829561f, 0.354447186f},
-std::array<float,2>{0.954448521f, 0.642599642f},
-std::array<float,2>{0.496139199f, 0.757114708f},
-std::array<float,2>{0.838452578f, 0.202378303f},
-std::array<float,2>{0.087253049f, 0.259307653f},
-std::array<float,2>{0.705669045f, 0.698025703f},
-std::array<float,2>{0.208105654f, 0.550629854f},
-std::array<float,2>{0.6093086f, 0.465755999f},
-std::array<float,2>{0.311173737f, 0.0594425872f},
-std::array<float,2>{0.9004637f, 0.954611719f},
-std::array<float,2>{0.314540505f, 0.684928894f},
-std::array<float,2>{0.971138418f, 0.320235938f},
-std::array<float,2>{0.187154055f, 0.155180231f},
-std::array<float,2>{0.54981178f, 0.868921638f},
-std::array<float,2>{0.0145857744f, 0.9146837f},
-std::array<float,2>{0.641894639f, 0.120508485f},
-std::array<float,2>{0.403396934f, 0.38123098f},
-std::array<float,2>{0.75161922f, 0.574040473f},
-std::array<float,2>{0.271469146f, 0.849785805f},
-std::array<float,2>{0.924345851f, 0.136348262f},
-std::array<float,2>{0.248514771f, 0.342549175f},
-std::array<float,2>{0.563344359f, 0.65902108f},
-std::array<float,2>{0.0976914763f, 0.585964501f},
-std::array<float,2>{0.744025111f, 0.402500302f},
-std::array<float,2>{0.466835439f, 0.099229373f},
-std::array<float,2>{0.865908682f, 0.925818563f},
-std::array<float,2>{0.427304178f, 0.710430384f},
-std::array<float,2>{0.811944425f, 0.278617233f},
-std::array<float,2>{0.0371329784f, 0.206147358f},
-std::array<float,2>{0.666825593f, 0.773987174f},
-std::array<float,2>{0.138959065f, 0.946178675f},
-std::array<float,2>{0.503123403f, 0.0388617925f},
-std::array<float,2>{0.373738647f, 0.451238513f},
-std::array<float,2>{0.958183825f, 0.535884976f},
-std::array<float,2>{0.494240582f, 0.897022963f},
-std::array<float,2>{0.841500342f, 0.074693881f},
-std::array<float,2>{0.0928773209f, 0.433374941f},
-std::array<float,2>{0.709877253f, 0.605528474f},
-std::array<float,2>{0.204139411f, 0.637453794f},
-std::array<float,2>{0.602689564f, 0.369779736f},
-std::array<float,2>{0.305424958f, 0.158475742f},
-std::array<float,2>{0.905786991f, 0.815889955f},
-std::array<float,2>{0.31749168f, 0.526408851f},
-std::array<float,2>{0.973607361f, 0.477425009f},
-std::array<float,2>{0.18009755f, 0.018663045f},
-std::array<float,2>{0.554095149f, 0.993693531f},
-std::array<float,2>{0.0116040492f, 0.806864977f},
-std::array<float,2>{0.648049831f, 0.23947227f},
-std::array<float,2>{0.400247216f, 0.283764631f},
-std::array<float,2>{0.75739038f, 0.745500922f},
-std::array<float,2>{0.348331124f, 0.974050879f},
-std::array<float,2>{0.951161683f, 0.00662963931f},
-std::array<float,2>{0.152632952f, 0.492206782f},
-std::array<float,2>{0.525507033f, 0.510967195f},
-std::array<float,2>{0.0471417643f, 0.725405216f},
-std::array<float,2>{0.684977055f, 0.301345915f},
-std::array<float,2>{0.417364568f, 0.23271212f},
-std::array<float,2>{0.795201957f, 0.7912606f},
-std::array<float,2>{0.448426604f, 0.618751466f},
-std::array<float,2>{0.845538735f, 0.409599632f},
-std::array<float,2>{0.118232012f, 0.0930336118f},
-std::array<float,2>{0.727704644f, 0.875766516f},
-std::array<float,2>{0.232682511f, 0.832865059f},
-std::array<float,2>{0.584134102f, 0.173236728f},
-std::array<float,2>{0.254252911f, 0.347051352f},
-std::array<float,2>{0.914411128f, 0.654363036f},
-std::array<float,2>{0.385530442f, 0.760135472f},
-std::array<float,2>{0.7659477f, 0.190401763f},
-std::array<float,2>{0.0244450551f, 0.254904687f},
-std::array<float,2>{0.627125978f, 0.68860811f},
-std::array<float,2>{0.161395624f, 0.555403173f},
-std::array<float,2>{0.540945888f, 0.454887986f},
-std::array<float,2>{0.333670795f, 0.0512876846f},
-std::array<float,2>{0.99224329f, 0.962647796f},
-std::array<float,2>{0.290557325f, 0.678350866f},
-std::array<float,2>{0.876383483f, 0.32446155f},
-std::array<float,2>{0.202089489f, 0.143723071f},
-std::array<float,2>{0.620706201f, 0.863202572f},
-std::array<float,2>{0.0764105245f, 0.909106612f},
-std::array<float,2>{0.692703724f, 0.115552574f},
-std::array<float,2>{0.481992513f, 0.382946044f},
-std::array<float,2>{0.817058325f, 0.566601038f},
-std::array<float,2>{0.341434389f, 0.784822047f},
-std::array<float,2>{0.991034448f, 0.223200247f},
-std::array<float,2>{0.165616751f, 0.308987468f},
-std::array<float,2>{0.534157038f, 0.733747661f},
-std::array<float,2>{0.0179068856f, 0.506037354f},
-std::array<float,2>{0.634533823f, 0.489483774f},
-std::array<float,2>{0.379222631f, 0.0107066426f},
-std::array<float,2>{0.777558446f, 0.982888281f},
-std::array<float,2>{0.471954793f, 0.647295713f},
-std::array<float,2>{0.822606742f, 0.358035833f},
-std::array<float,2>{0.0671856329f, 0.187429935f},
-std::array<float,2>{0.700898767f, 0.843541265f},
-std::array<float,2>{0.190594837f, 0.887624919f},
-std::array<float,2>{0.612955093f, 0.0819258988f},
-std::array<float,2>{0.28564921f, 0.421547234f},
-std::array<float,2>{0.883025348f, 0.616080999f},
-std::array<float,2>{0.411642134f, 0.957919598f},
-std::array<float,2>{0.783719599f, 0.0552673675f},
-std::array<float,2>{0.0606754608f, 0.462828398f},
-std::array<float,2>{0.674657285f, 0.554573774f},
-std::array<float,2>{0.143306553f, 0.702054739f},
-std::array<float,2>{0.51700896f, 0.264997035f},
-std::array<float,2>{0.356006205f, 0.198459253f},
-std::array<float,2>{0.938651919f, 0.750074804f},
-std::array<float,2>{0.263538092f, 0.577820182f},
-std::array<float,2>{0.909001648f, 0.37729013f},
-std::array<float,2>{0.22044687f, 0.124663137f},
-std::array<float,2>{0.590129197f, 0.919333935f},
-std::array<float,2>{0.111109249f, 0.872199535f},
-std::array<float,2>{0.720214307f, 0.151632845f},
-std::array<float,2>{0.438999653f, 0.313458055f},
-std::array<float,2>{0.858254194f, 0.682648599f},
-std::array<float,2>{0.304269582f, 0.93110162f},
-std::array<float,2>{0.893810928f, 0.105672538f},
-std::array<float,2>{0.211992159f, 0.391167879f},
-std::array<float,2>{0.600946844f, 0.582904339f},
-std::array<float,2>{0.0839164108f, 0.671744943f},
-std::array<float,2>{0.71509856f, 0.335365921f},
-std::array<float,2>{0.485829622f, 0.125025764f},
-std::array<float,2>{0.829613149f, 0.856450021f},
-std::array<float,2>{0.390776634f, 0.545023263f},
-std::array<float,2>{0.758011222f, 0.439521134f},
-std::array<float,2>{0.00646803668f, 0.0439737588f},
-std::array<float,2>{0.65416348f, 0.940930068f},
-std::array<float,2>{0.175687134f, 0.767580986f},
-std::array<float,2>{0.55617553f, 0.214986861f},
-std::array<float,2>{0.326086193f, 0.267920405f},
-std::array<float,2>{0.977287114f, 0.718627334f},
-std::array<float,2>{0.458467841f, 0.824792802f},
-std::array<float,2>{0.872898579f, 0.167002603f},
-std::array<float,2>{0.101797208f, 0.363750517f},
-std::array<float,2>{0.736416519f, 0.632488668f},
-std::array<float,2>{0.236189038f, 0.600237608f},
-std::array<float,2>{0.574619114f, 0.425107151f},
-std::array<float,2>{0.276200324f, 0.0675590634f},
-std::array<float,2>{0.932752669f, 0.90603745f},
-std::array<float,2>{0.363062561f, 0.736690104f},
-std::array<float,2>{0.965106428f, 0.296392053f},
-std::array<float,2>{0.12935023f, 0.249517292f},
-std::array<float,2>{0.514891744f, 0.797297835f},
-std::array<float,2>{0.0435300991f, 0.985156357f},
-std::array<float,2>{0.658928633f, 0.0257774144f},
-std::array<float,2>{0.432854891f, 0.474725515f},
-std::array<float,2>{0.797542036f, 0.522460163f},
-std::array<float,2>{0.284681976f, 0.779160976f},
-std::array<float,2>{0.887065351f, 0.210711807f},
-std::array<float,2>{0.192016512f, 0.274889946f},
-std::array<float,2>{0.614482462f, 0.706199229f},
-std::array<float,2>{0.0653645322f, 0.533242226f},
-std::array<float,2>{0.698604107f, 0.446662843f},
-std::array<float,2>{0.475802779f, 0.0339889824f},
-std::array<float,2>{0.827290773f, 0.952122211f},
-std::array<float,2>{0.376269013f, 0.662567675f},
-std::array<float,2>{0.775704861f, 0.337070584f},
-std::array<float,2>{0.0201891791f, 0.137407809f},
-std::array<float,2>{0.636997342f, 0.846171618f},
-std::array<float,2>{0.170555592f, 0.925201416f},
-std::array<float,2>{0.53670454f, 0.0966401696f},
-std::array<float,2>{0.337375313f, 0.400126815f},
-std::array<float,2>{0.984576762f, 0.590977311f},
-std::array<float,2>{0.441870719f, 0.998479903f},
-std::array<float,2>{0.853812099f, 0.0220668335f},
-std::array<float,2>{0.113511458f, 0.483589977f},
-std::array<float,2>{0.725325048f, 0.528619707f},
-std::array<float,2>{0.224300861f, 0.747829735f},
-std::array<float,2>{0.589031816f, 0.286541283f},
-std::array<float,2>{0.260001451f, 0.237087473f},
-std::array<float,2>{0.911606789f, 0.809594452f},
-std::array<float,2>{0.352226675f, 0.605263233f},
-std::array<float,2>{0.942125022f, 0.433685809f},
-std::array<float,2>{0.146329284f, 0.0706696212f},
-std::array<float,2>{0.521775186f, 0.893624067f},
-std::array<float,2>{0.0565951727f, 0.817459106f},
-std::array<float,2>{0.677197099f, 0.161179304f},
-std::array<float,2>{0.40875864f, 0.373977333f},
-std::array<float,2>{0.787246346f, 0.636058748f},
-std::array<float,2>{0.324163526f, 0.882566631f},
-std::array<float,2>{0.982038975f, 0.0893501043f},
-std::array<float,2>{0.17833744f, 0.411806047f},
-std::array<float,2>{0.560068548f, 0.62375766f},
-std::array<float,2>{0.00311851548f, 0.649675608f},
-std::array<float,2>{0.65072912f, 0.351339728f},
-std::array<float,2>{0.396805227f, 0.177981183f},
-std::array<float,2>{0.763951957f, 0.830109179f},
-std::array<float,2>{0.490362346f, 0.512528062f},
-std::array<float,2>{0.835925221f, 0.497588068f},
-std::array<float,2>{0.0783687234f, 0.00145223143f},
-std::array<float,2>{0.711091876f, 0.971259952f},
-std::array<float,2>{0.216924548f, 0.796709478f},
-std::array<float,2>{0.595776379f, 0.2284628f},
-std::array<float,2>{0.297984093f, 0.299764097f},
-std::array<float,2>{0.89782697f, 0.720089316f},
-std::array<float,2>{0.433830708f, 0.86335218f},
-std::array<float,2>{0.803494692f, 0.146070898f},
-std::array<float,2>{0.0397633575f, 0.324212402f},
-std::array<float,2>{0.662948847f, 0.673171103f},
-std::array<float,2>{0.125281781f, 0.565819383f},
-std::array<float,2>{0.509331226f, 0.388501942f},
-std::array<float,2>{0.36444816f, 0.111850955f},
-std::array<float,2>{0.962744057f, 0.912002444f},
-std::array<float,2>{0.278377026f, 0.694444954f},
-std::array<float,2>{0.936561942f, 0.253109932f},
-std::array<float,2>{0.239669129f, 0.193947285f},
-std::array<float,2>{0.572087288f, 0.762480795f},
-std::array<float,2>{0.107079156f, 0.965048552f},
-std::array<float,2>{0.742179096f, 0.0500266738f},
-std::array<float,2>{0.454062104f, 0.458621532f},
-std::array<float,2>{0.869819283f, 0.560605466f},
-std::array<float,2>{0.368769586f, 0.839112103f},
-std::array<float,2>{0.953383446f, 0.179694369f},
-std::array<float,2>{0.13296254f, 0.352040708f},
-std::array<float,2>{0.506934822f, 0.642368078f},
-std::array<float,2>{0.0332933776f, 0.612583637f},
-std::array<float,2>{0.670569658f, 0.414900392f},
-std::array<float,2>{0.423124701f, 0.0824096352f},
-std::array<float,2>{0.804886758f, 0.883099794f},
-std::array<float,2>{0.464611769f, 0.729634225f},
-std::array<float,2>{0.862862945f, 0.305806518f},
-std::array<float,2>{0.0954352021f, 0.221528739f},
-std::array<float,2>{0.749070883f, 0.787535012f},
-std::array<float,2>{0.24458386f, 0.980017543f},
-std::array<float,2>{0.569565952f, 0.013213913f},
-std::array<float,2>{0.268690228f, 0.484678447f},
-std::array<float,2>{0.927713454f, 0.501837492f},
-std::array<float,2>{0.402522594f, 0.916609406f},
-std::array<float,2>{0.750436783f, 0.118113153f},
-std::array<float,2>{0.0156218093f, 0.379854769f},
-std::array<float,2>{0.641335845f, 0.571795046f},
-std::array<float,2>{0.185808197f, 0.686023533f},
-std::array<float,2>{0.549577057f, 0.318175614f},
-std::array<float,2>{0.31586802f, 0.153499261f},
-std::array<float,2>{0.971933365f, 0.869494855f},
-std::array<float,2>{0.312227517f, 0.548022032f},
-std::array<float,2>{0.902143896f, 0.467852682f},
-std::array<float,2>{0.207969114f, 0.0615731217f},
-std::array<float,2>{0.607747257f, 0.955359697f},
-std::array<float,2>{0.0862020105f, 0.755468309f},
-std::array<float,2>{0.706842005f, 0.199490398f},
-std::array<float,2>{0.49768725f, 0.260870367f},
-std::array<float,2>{0.839635968f, 0.696874738f},
-std::array<float,2>{0.252018392f, 0.9446944f},
-std::array<float,2>{0.918335915f, 0.0395657793f},
-std::array<float,2>{0.229354247f, 0.444018424f},
-std::array<float,2>{0.580927372f, 0.542907119f},
-std::array<float,2>{0.121584348f, 0.712245166f},
-std::array<float,2>{0.73207438f, 0.270798862f},
-std::array<float,2>{0.449645579f, 0.211320862f},
-std::array<float,2>{0.850721896f, 0.772299945f},
-std::array<float,2>{0.421757311f, 0.578137279f},
-std::array<float,2>{0.791106522f, 0.398065925f},
-std::array<float,2>{0.0518364236f, 0.10234689f},
-std::array<float,2>{0.682240725f, 0.937262118f},
-std::array<float,2>{0.148825675f, 0.853061914f},
-std::array<float,2>{0.530429065f, 0.131986067f},
-std::array<float,2>{0.347269773f, 0.330965728f},
-std::array<float,2>{0.946208715f, 0.665731788f},
-std::array<float,2>{0.477606237f, 0.801423848f},
-std::array<float,2>{0.813660145f, 0.243337035f},
-std::array<float,2>{0.0719517693f, 0.291216046f},
-std::array<float,2>{0.690559149f, 0.740316749f},
-std::array<float,2>{0.199128032f, 0.51743108f},
-std::array<float,2>{0.62338984f, 0.470803797f},
-std::array<float,2>{0.294587165f, 0.0305193868f},
-std::array<float,2>{0.879696488f, 0.988635957f},
-std::array<float,2>{0.330688298f, 0.627137244f},
-std::array<float,2>{0.998308837f, 0.360649526f},
-std::array<float,2>{0.157657802f, 0.171537653f},
-std::array<float,2>{0.545253277f, 0.822468519f},
-std::array<float,2>{0.0282581337f, 0.901059091f},
-std::array<float,2>{0.630431831f, 0.0629748702f},
-std::array<float,2>{0.386898398f, 0.426222056f},
-std::array<float,2>{0.771024525f, 0.59597367f},
-std::array<float,2>{0.308124989f, 0.812642634f},
-std::array<float,2>{0.902810276f, 0.157193214f},
-std::array<float,2>{0.206667826f, 0.367517978f},
-std::array<float,2>{0.603629649f, 0.639666617f},
-std::array<float,2>{0.0917914286f, 0.607572973f},
-std::array<float,2>{0.708699346f, 0.430373222f},
-std::array<float,2>{0.493890613f, 0.0771969408f},
-std::array<float,2>{0.84235692f, 0.89482224f},
-std::array<float,2>{0.401345909f, 0.742916524f},
-std::array<float,2>{0.75458318f, 0.282201111f},
-std::array<float,2>{0.00894968957f, 0.240758359f},
-std::array<float,2>{0.645138264f, 0.805660605f},
-std::array<float,2>{0.18298687f, 0.995833397f},
-std::array<float,2>{0.551046073f, 0.0174430013f},
-std::array<float,2>{0.318611801f, 0.479784489f},
-std::array<float,2>{0.975705266f, 0.524831772f},
-std::array<float,2>{0.465585619f, 0.929085732f},
-std::array<float,2>{0.863869905f, 0.100565784f},
-std::array<float,2>{0.100355312f, 0.405403644f},
-std::array<float,2>{0.744302034f, 0.588202715f},
-std::array<float,2>{0.246814206f, 0.658140838f},
-std::array<float,2>{0.565100908f, 0.340017408f},
-std::array<float,2>{0.273436517f, 0.134114787f},
-std::array<float,2>{0.92368722f, 0.849229693f},
-std::array<float,2>{0.371278733f, 0.538122594f},
-std::array<float,2>{0.959242702f, 0.449581355f},
-std::array<float,2>{0.137908846f, 0.0357659161f},
-std::array<float,2>{0.500540972f, 0.948047101f},
-std::array<float,2>{0.0358503051f, 0.77661562f},
-std::array<float,2>{0.665167689f, 0.204172865f},
-std::array<float,2>{0.42856276f, 0.279769957f},
-std::array<float,2>{0.809432805f, 0.708422422f},
-std::array<float,2>{0.334308565f, 0.964045048f},
-std::array<float,2>{0.995497108f, 0.0540383421f},
-std::array<float,2>{0.163708925f, 0.455678225f},
-std::array<float,2>{0.541670799f, 0.557614207f},
-std::array<float,2>{0.0263221581f, 0.689765513f},
-std::array<float,2>{0.62539041f, 0.257654577f},
-std::array<float,2>{0.384097219f, 0.188838467f},
-std::array<float,2>{0.768643916f, 0.757859945f},
-std::array<float,2>{0.483722776f, 0.570111454f},
-std::array<float,2>{0.820274353f, 0.386051863f},
-std::array<float,2>{0.0747021064f, 0.11379911f},
-std::array<float,2>{0.694481134f, 0.907476008f},
-std::array<float,2>{0.199608728f, 0.859864235f},
-std::array<float,2>{0.618807197f, 0.141686842f},
-std::array<float,2>{0.291198552f, 0.327490419f},
-std::array<float,2>{0.877528489f, 0.676080942f},
-std::array<float,2>{0.415579259f, 0.789873123f},
-std::array<float,2>{0.79354018f, 0.230475083f},
-std::array<float,2>{0.0505997054f, 0.303627551f},
-std::array<float,2>{0.685701609f, 0.722934484f},
-std::array<float,2>{0.155182227f, 0.509687722f},
-std::array<float,2>{0.525155604f, 0.49572134f},
-std::array<float,2>{0.35115549f, 0.00397967966f},
-std::array<float,2>{0.951220632f, 0.976200223f},
-std::array<float,2>{0.25749591f, 0.653878093f},
-std::array<float,2>{0.917344749f, 0.344379574f},
-std::array<float,2>{0.230668426f, 0.17503877f},
-std::array<float,2>{0.582437038f, 0.834208131f},
-std::array<float,2>{0.119410329f, 0.877609789f},
-std::array<float,2>{0.730391979f, 0.0903396383f},
-std::array<float,2>{0.446758479f, 0.406863332f},
-std::array<float,2>{0.846048951f, 0.62000227f},
-std::array<float,2>{0.35888505f, 0.752966821f},
-std::array<float,2>{0.940221429f, 0.196166918f},
-std::array<float,2>{0.142178327f, 0.262702167f},
-std::array<float,2>{0.519470394f, 0.701035678f},
-std::array<float,2>{0.0596720576f, 0.550821364f},
-std::array<float,2>{0.672408879f, 0.464332253f},
-std::array<float,2>{0.412804931f, 0.0576069877f},
-std::array<float,2>{0.781499624f, 0.95982039f},
-std::array<float,2>{0.43973729f, 0.680308521f},
-std::array<float,2>{0.855816901f, 0.315224648f},
-std::array<float,2>{0.11180757f, 0.149737284f},
-std::array<float,2>{0.722240865f, 0.87441045f},
-std::array<float,2>{0.221327692f, 0.920948148f},
-std::array<float,2>{0.59320873f, 0.123036884f},
-std::array<float,2>{0.263961583f, 0.376412392f},
-std::array<float,2>{0.907959938f, 0.575517476f},
-std::array<float,2>{0.382218659f, 0.981354058f},
-std::array<float,2>{0.780450404f, 0.00832587667f},
-std::array<float,2>{0.0159612242f, 0.491297543f},
-std::array<float,2>{0.636106074f, 0.504440606f},
-std::array<float,2>{0.16628176f, 0.731983542f},
-std::array<float,2>{0.532839239f, 0.310880601f},
-std::array<float,2>{0.342808068f, 0.225479946f},
-std::array<float,2>{0.988761306f, 0.781861365f},
-std::array<float,2>{0.287665367f, 0.614207685f},
-std::array<float,2>{0.886549592f, 0.418375522f},
-std::array<float,2>{0.188666552f, 0.0795434788f},
-std::array<float,2>{0.61107564f, 0.890556097f},
-std::array<float,2>{0.0692207292f, 0.839938104f},
-std::array<float,2>{0.702427566f, 0.18538107f},
-std::array<float,2>{0.469162673f, 0.357065916f},
-std::array<float,2>{0.820593536f, 0.645685136f},
-std::array<float,2>{0.273458898f, 0.902565479f},
-std::array<float,2>{0.931068957f, 0.0697577819f},
-std::array<float,2>{0.237645194f, 0.423292816f},
-std::array<float,2>{0.577103853f, 0.598442137f},
-std::array<float,2>{0.10427063f, 0.63008523f},
-std::array<float,2>{0.736100137f, 0.366861731f},
-std::array<float,2>{0.459703684f, 0.16441378f},
-std::array<float,2>{0.874434531f, 0.826266646f},
-std::array<float,2>{0.430317104f, 0.521208227f},
-std::array<float,2>{0.799571991f, 0.474444926f},
-std::array<float,2>{0.0462160744f, 0.0239320472f},
-std::array<float,2>{0.65808022f, 0.987125933f},
-std::array<float,2>{0.131717399f, 0.800376236f},
-std::array<float,2>{0.513301492f, 0.247946247f},
-std::array<float,2>{0.359564543f, 0.293448657f},
-std::array<float,2>{0.967986286f, 0.734408259f},
-std::array<float,2>{0.486378521f, 0.858450294f},
-std::array<float,2>{0.83011806f, 0.127840728f},
-std::array<float,2>{0.0842626467f, 0.332493305f},
-std::array<float,2>{0.71873945f, 0.669886112f},
-std::array<float,2>{0.213634223f, 0.585251689f},
-std::array<float,2>{0.59814167f, 0.392734498f},
-std::array<float,2>{0.301753849f, 0.107937925f},
-std::array<float,2>{0.892413557f, 0.933214486f},
-std::array<float,2>{0.327710539f, 0.715169251f},
-std::array<float,2>{0.978697538f, 0.267217785f},
-std::array<float,2>{0.173142076f, 0.217235059f},
-std::array<float,2>{0.557947695f, 0.76572156f},
-std::array<float,2>{0.0054875873f, 0.93857187f},
-std::array<float,2>{0.654510379f, 0.0454376154f},
-std::array<float,2>{0.393992901f, 0.438997f},
-std::array<float,2>{0.761587918f, 0.544174612f},
-std::array<float,2>{0.259425759f, 0.811703265f},
-std::array<float,2>{0.912135839f, 0.235535473f},
-std::array<float,2>{0.224885881f, 0.288891166f},
-std::array<float,2>{0.586857259f, 0.749407113f},
-std::array<float,2>{0.116200134f, 0.529908359f},
-std::array<float,2>{0.723782599f, 0.480576783f},
-std::array<float,2>{0.443506867f, 0.0195766632f},
-std::array<float,2>{0.851791263f, 0.997394323f},
-std::array<float,2>{0.407915801f, 0.633547068f},
-std::array<float,2>{0.786981821f, 0.371669531f},
-std::array<float,2>{0.0576230027f, 0.163980737f},
-std::array<float,2>{0.678953648f, 0.81990993f},
-std::array<float,2>{0.147741392f, 0.890811086f},
-std::array<float,2>{0.519860923f, 0.0737555698f},
-std::array<float,2>{0.354870975f, 0.436392874f},
-std::array<float,2>{0.943859756f, 0.60251379f},
-std::array<float,2>{0.473828346f, 0.950617015f},
-std::array<float,2>{0.8252092f, 0.0317368656f},
-std::array<float,2>{0.0635044053f, 0.448458701f},
-std::array<float,2>{0.69706583f, 0.53125602f},
-std::array<float,2>{0.195049807f, 0.704047084f},
-std::array<float,2>{0.616446376f, 0.27559194f},
-std::array<float,2>{0.281452894f, 0.207524583f},
-std::array<float,2>{0.890606403f, 0.780952752f},
-std::array<float,2>{0.338197887f, 0.592795193f},
-std::array<float,2>{0.986504614f, 0.402170688f},
-std::array<float,2>{0.169306159f, 0.0938706845f},
-std::array<float,2>{0.53757304f, 0.92297709f},
-std::array<float,2>{0.021519972f, 0.844456792f},
-std::array<float,2>{0.638820112f, 0.139311478f},
-std::array<float,2>{0.377471507f, 0.339153141f},
-std::array<float,2>{0.774217486f, 0.660921812f},
-std::array<float,2>{0.366565019f, 0.913392186f},
-std::array<float,2>{0.963398814f, 0.110370353f},
-std::array<float,2>{0.127247795f, 0.38925156f},
-std::array<float,2>{0.511424243f, 0.56329757f},
-std::array<float,2>{0.0423761941f, 0.675623238f},
-std::array<float,2>{0.661011577f, 0.321062654f},
-std::array<float,2>{0.436278641f, 0.147306085f},
-std::array<float,2>{0.801196277f, 0.867169321f},
-std::array<float,2>{0.455347866f, 0.560223937f},
-std::array<float,2>{0.867289305f, 0.460543185f},
-std::array<float,2>{0.109307185f, 0.0482774675f},
-std::array<float,2>{0.73916322f, 0.968339622f},
-std::array<float,2>{0.240822911f, 0.765572846f},
-std::array<float,2>{0.573862493f, 0.19273296f},
-std::array<float,2>{0.279569238f, 0.251707286f},
-std::array<float,2>{0.934095621f, 0.691652477f},
-std::array<float,2>{0.394638419f, 0.828561783f},
-std::array<float,2>{0.763004601f, 0.177244559f},
-std::array<float,2>{0.000874216494f, 0.348009914f},
-std::array<float,2>{0.648500323f, 0.651830375f},
-std::array<float,2>{0.17621544f, 0.621731937f},
-std::array<float,2>{0.561921358f, 0.413796991f},
-std::array<float,2>{0.320895016f, 0.0870580822f},
-std::array<float,2>{0.983700573f, 0.880134523f},
-std::array<float,2>{0.300677031f, 0.720859051f},
-std::array<float,2>{0.895140588f, 0.297261536f},
-std::array<float,2>{0.216763005f, 0.229825065f},
-std::array<float,2>{0.594963849f, 0.792984486f},
-std::array<float,2>{0.0813917294f, 0.9706074f},
-std::array<float,2>{0.713031471f, 0.00310656475f},
-std::array<float,2>{0.488502532f, 0.499328047f},
-std::array<float,2>{0.832486212f, 0.514717102f},
-std::array<float,2>{0.313028455f, 0.867612779f},
-std::array<float,2>{0.970575929f, 0.155651361f},
-std::array<float,2>{0.183818072f, 0.319308609f},
-std::array<float,2>{0.548042417f, 0.684382021f},
-std::array<float,2>{0.0125696771f, 0.572405338f},
-std::array<float,2>{0.644424796f, 0.381937385f},
-std::array<float,2>{0.405131221f, 0.119971052f},
-std::array<float,2>{0.753813684f, 0.915725648f},
-std::array<float,2>{0.498093218f, 0.699016094f},
-std::array<float,2>{0.837008834f, 0.258309811f},
-std::array<float,2>{0.0883164257f, 0.201741442f},
-std::array<float,2>{0.703641236f, 0.756523013f},
-std::array<float,2>{0.209060371f, 0.953996181f},
-std::array<float,2>{0.606378436f, 0.0600381903f},
-std::array<float,2>{0.310090244f, 0.465917706f},
-std::array<float,2>{0.898490429f, 0.548868358f},
-std::array<float,2>{0.425298274f, 0.886674345f},
-std::array<float,2>{0.807909548f, 0.0858896598f},
-std::array<float,2>{0.0329190753f, 0.417643994f},
-std::array<float,2>{0.669022501f, 0.610165119f},
-std::array<float,2>{0.135529906f, 0.644511878f},
-std::array<float,2>{0.504498601f, 0.354975313f},
-std::array<float,2>{0.370859206f, 0.183278888f},
-std::array<float,2>{0.955717564f, 0.83722204f},
-std::array<float,2>{0.26720199f, 0.502042472f},
-std::array<float,2>{0.92870754f, 0.487516075f},
-std::array<float,2>{0.243724748f, 0.0139981275f},
-std::array<float,2>{0.568319082f, 0.977508485f},
-std::array<float,2>{0.0965578109f, 0.78539288f},
-std::array<float,2>{0.74717772f, 0.218971655f},
-std::array<float,2>{0.461748064f, 0.30816251f},
-std::array<float,2>{0.860372365f, 0.72792834f},
-std::array<float,2>{0.295055568f, 0.99050647f},
-std::array<float,2>{0.882536411f, 0.0275711399f},
-std::array<float,2>{0.195545435f, 0.469230205f},
-std::array<float,2>{0.62177521f, 0.519030929f},
-std::array<float,2>{0.0737052187f, 0.739080787f},
-std::array<float,2>{0.689008057f, 0.29021737f},
-std::array<float,2>{0.479961842f, 0.245363027f},
-std::array<float,2>{0.815964997f, 0.804684222f},
-std::array<float,2>{0.389425129f, 0.595008552f},
-std::array<float,2>{0.772666276f, 0.427831858f},
-std::array<float,2>{0.0306709185f, 0.0657976419f},
-std::array<float,2>{0.631177425f, 0.899526358f},
-std::array<float,2>{0.158280894f, 0.821241736f},
-std::array<float,2>{0.543735564f, 0.16806367f},
-std::array<float,2>{0.329824954f, 0.362267196f},
-std::array<float,2>{0.996485889f, 0.625169098f},
-std::array<float,2>{0.452613562f, 0.770601928f},
-std::array<float,2>{0.848682404f, 0.214097932f},
-std::array<float,2>{0.124753915f, 0.273376346f},
-std::array<float,2>{0.732829869f, 0.71409744f},
-std::array<float,2>{0.227355197f, 0.539110005f},
-std::array<float,2>{0.579378128f, 0.442831457f},
-std::array<float,2>{0.251204908f, 0.0428665057f},
-std::array<float,2>{0.921546757f, 0.941822886f},
-std::array<float,2>{0.345473498f, 0.666574359f},
-std::array<float,2>{0.949198246f, 0.328351855f},
-std::array<float,2>{0.150903329f, 0.12980108f},
-std::array<float,2>{0.528671026f, 0.854960084f},
-std::array<float,2>{0.0545307398f, 0.933691978f},
-std::array<float,2>{0.681604862f, 0.105367526f},
-std::array<float,2>{0.418447345f, 0.394912511f},
-std::array<float,2>{0.789139032f, 0.582028866f},
-std::array<float,2>{0.301007688f, 0.857412398f},
-std::array<float,2>{0.89170295f, 0.125570327f},
-std::array<float,2>{0.213371292f, 0.335784167f},
-std::array<float,2>{0.598218143f, 0.671155453f},
-std::array<float,2>{0.0848333389f, 0.582491338f},
-std::array<float,2>{0.717840254f, 0.390720069f},
-std::array<float,2>{0.487007737f, 0.106403403f},
-std::array<float,2>{0.830836594f, 0.931154191f},
-std::array<float,2>{0.394452929f, 0.718158603f},
-std::array<float,2>{0.760986447f, 0.268357605f},
-std::array<float,2>{0.00500118639f, 0.215571061f},
-std::array<float,2>{0.655008674f, 0.768548727f},
-std::array<float,2>{0.173774451f, 0.940857172f},
-std::array<float,2>{0.558315754f, 0.0447845384f},
-std::array<float,2>{0.327184916f, 0.440340459f},
-std::array<float,2>{0.979379058f, 0.545782685f},
-std::array<float,2>{0.459043682f, 0.905312121f},
-std::array<float,2>{0.874837637f, 0.0680913776f},
-std::array<float,2>{0.103902563f, 0.425296694f},
-std::array<float,2>{0.735837817f, 0.599931419f},
-std::array<float,2>{0.237930804f, 0.632171154f},
-std::array<float,2>{0.576281726f, 0.364034057f},
-std::array<float,2>{0.274211973f, 0.167671785f},
-std::array<float,2>{0.931413472f, 0.824611902f},
-std::array<float,2>{0.36015746f, 0.521824658f},
-std::array<float,2>{0.968579292f, 0.475382507f},
-std::array<float,2>{0.131177619f, 0.0263157915f},
-std::array<float,2>{0.512894392f, 0.984428883f},
-std::array<float,2>{0.0466901772f, 0.797563434f},
-std::array<float,2>{0.657484889f, 0.249073133f},
-std::array<float,2>{0.42999202f, 0.296263248f},
-std::array<float,2>{0.799040914f, 0.737251699f},
-std::array<float,2>{0.34340632f, 0.982989192f},
-std::array<float,2>{0.988858819f, 0.00983885676f},
-std::array<float,2>{0.166986868f, 0.489892215f},
-std::array<float,2>{0.532325447f, 0.506395936f},
-std::array<float,2>{0.0162987951f, 0.734165132f},
-std::array<float,2>{0.63625282f, 0.309368879f},
-std::array<float,2>{0.38261196f, 0.222820804f},
-std::array<float,2>{0.780802786f, 0.784246504f},
-std::array<float,2>{0.469587237f, 0.615497887f},
-std::array<float,2>{0.821003199f, 0.4212479f},
-std::array<float,2>{0.0684318468f, 0.0811014175f},
-std::array<float,2>{0.703040838f, 0.887001514f},
-std::array<float,2>{0.1890046f, 0.843249261f},
-std::array<float,2>{0.61077106f, 0.186581016f},
-std::array<float,2>{0.287140459f, 0.357800394f},
-std::array<float,2>{0.886014223f, 0.646615624f},
-std::array<float,2>{0.41222313f, 0.750809312f},
-std::array<float,2>{0.782011449f, 0.198927715f},
-std::array<float,2>{0.0602047294f, 0.265420973f},
-std::array<float,2>{0.672193468f, 0.701598048f},
-std::array<float,2>{0.141870886f, 0.55417484f},
-std::array<float,2>{0.518642366f, 0.462105542f},
-std::array<float,2>{0.359066784f, 0.054784108f},
-std::array<float,2>{0.939873397f, 0.957127631f},
-std::array<float,2>{0.26424396f, 0.683131218f},
-std::array<float,2>{0.90747267f, 0.312509209f},
-std::array<float,2>{0.221077979f, 0.151986107f},
-std::array<float,2>{0.593674779f, 0.872820258f},
-std::array<float,2>{0.111928754f, 0.919916451f},
-std::array<float,2>{0.721721828f, 0.124479592f},
-std::array<float,2>{0.44013077f, 0.377792746f},
-std::array<float,2>{0.856023312f, 0.577387691f},
-std::array<float,2>{0.350968927f, 0.791956842f},
-std::array<float,2>{0.952009618f, 0.233229816f},
-std::array<float,2>{0.154745683f, 0.301217854f},
-std::array<float,2>{0.524511158f, 0.725047886f},
-std::array<float,2>{0.0498351455f, 0.511529267f},
-std::array<float,2>{0.686224103f, 0.492972404f},
-std::array<float,2>{0.415368915f, 0.00601292076f},
-std::array<float,2>{0.793196142f, 0.974372864f},
-std::array<float,2>{0.447259009f, 0.655210555f},
-std::array<float,2>{0.84653002f, 0.347590536f},
-std::array<float,2>{0.11966081f, 0.173580274f},
-std::array<float,2>{0.729741096f, 0.832137644f},
-std::array<float,2>{0.231168434f, 0.875397146f},
-std::array<float,2>{0.582584739f, 0.0933045447f},
-std::array<float,2>{0.257132679f, 0.410135329f},
-std::array<float,2>{0.917513669f, 0.618180692f},
-std::array<float,2>{0.384467751f, 0.961918175f},
-std::array<float,2>{0.76927346f, 0.0511767268f},
-std::array<float,2>{0.025405623f, 0.454195619f},
-std::array<float,2>{0.625568867f, 0.554777622f},
-std::array<float,2>{0.163133398f, 0.689440131f},
-std::array<float,2>{0.541396141f, 0.25563696f},
-std::array<float,2>{0.334809303f, 0.189509317f},
-std::array<float,2>{0.99566859f, 0.760513961f},
-std::array<float,2>{0.291735351f, 0.567279398f},
-std::array<float,2>{0.877050817f, 0.383430541f},
-std::array<float,2>{0.199760839f, 0.116177924f},
-std::array<float,2>{0.618501067f, 0.908469796f},
-std::array<float,2>{0.0751767978f, 0.862769127f},
-std::array<float,2>{0.695058346f, 0.14417471f},
-std::array<float,2>{0.484001577f, 0.324969769f},
-std::array<float,2>{0.819612384f, 0.677945673f},
-std::array<float,2>{0.272824079f, 0.926752388f},
-std::array<float,2>{0.922897816f, 0.0989791602f},
-std::array<float,2>{0.246493801f, 0.403259546f},
-std::array<float,2>{0.564721644f, 0.586708367f},
-std::array<float,2>{0.0997742265f, 0.658220947f},
-std::array<float,2>{0.744921088f, 0.342243165f},
-std::array<float,2>{0.465030372f, 0.136203364f},
-std::array<float,2>{0.863583207f, 0.85046047f},
-std::array<float,2>{0.42812556f, 0.535619795f},
-std::array<float,2>{0.808816731f, 0.451781243f},
-std::array<float,2>{0.0354754664f, 0.0385197476f},
-std::array<float,2>{0.665822208f, 0.945570648f},
-std::array<float,2>{0.138650686f, 0.773898125f},
-std::array<float,2>{0.500148594f, 0.206883177f},
-std::array<float,2>{0.372013807f, 0.279048502f},
-std::array<float,2>{0.959582865f, 0.710497081f},
-std::array<float,2>{0.493434519f, 0.81618917f},
-std::array<float,2>{0.842196822f, 0.158797935f},
-std::array<float,2>{0.091126278f, 0.369381249f},
-std::array<float,2>{0.708088577f, 0.637025237f},
-std::array<float,2>{0.206066325f, 0.606302738f},
-std::array<float,2>{0.604372323f, 0.432820946f},
-std::array<float,2>{0.307815164f, 0.0750509501f},
-std::array<float,2>{0.903057635f, 0.896940947f},
-std::array<float,2>{0.319216967f, 0.745774746f},
-std::array<float,2>{0.976414919f, 0.283652604f},
-std::array<float,2>{0.183469608f, 0.240091354f},
-std::array<float,2>{0.551747262f, 0.807610631f},
-std::array<float,2>{0.00958296843f, 0.993385494f},
-std::array<float,2>{0.644744635f, 0.0191885047f},
-std::array<float,2>{0.400474429f, 0.476802051f},
-std::array<float,2>{0.753970027f, 0.527170539f},
-std::array<float,2>{0.25158298f, 0.771760404f},
-std::array<float,2>{0.921380579f, 0.21174936f},
-std::array<float,2>{0.226597995f, 0.27125904f},
-std::array<float,2>{0.579642177f, 0.712533474f},
-std::array<float,2>{0.12448699f, 0.542312443f},
-std::array<float,2>{0.733317196f, 0.443558335f},
-std::array<float,2>{0.452662259f, 0.0390778743f},
-std::array<float,2>{0.849151433f, 0.945211709f},
-std::array<float,2>{0.418924153f, 0.665113449f},
-std::array<float,2>{0.789788723f, 0.33022508f},
-std::array<float,2>{0.0540298857f, 0.132587597f},
-std::array<float,2>{0.680873096f, 0.852695704f},
-std::array<float,2>{0.150459275f, 0.936645508f},
-std::array<float,2>{0.529069066f, 0.101597078f},
-std::array<float,2>{0.344979018f, 0.397925198f},
-std::array<float,2>{0.948355377f, 0.578687787f},
-std::array<float,2>{0.480406433f, 0.989114285f},
-std::array<float,2>{0.81564945f, 0.0308328737f},
-std::array<float,2>{0.0740229189f, 0.471245885f},
-std::array<float,2>{0.688566089f, 0.517058313f},
-std::array<float,2>{0.196099609f, 0.741176963f},
-std::array<float,2>{0.621206284f, 0.291700959f},
-std::array<float,2>{0.295451581f, 0.244073734f},
-std::array<float,2>{0.881890714f, 0.800879359f},
-std::array<float,2>{0.329223275f, 0.596474767f},
-std::array<float,2>{0.99697268f, 0.426594853f},
-std::array<float,2>{0.158993334f, 0.063309148f},
-std::array<float,2>{0.543373525f, 0.900529504f},
-std::array<float,2>{0.0312125608f, 0.823122203f},
-std::array<float,2>{0.631630123f, 0.171038449f},
-std::array<float,2>{0.388996571f, 0.361249506f},
-std::array<float,2>{0.773128867f, 0.627496004f},
-std::array<float,2>{0.370291948f, 0.883784413f},
-std::array<float,2>{0.955415308f, 0.0829557329f},
-std::array<float,2>{0.134992316f, 0.414114863f},
-std::array<float,2>{0.50432843f, 0.612798274f},
-std::array<float,2>{0.0326015055f, 0.642015576f},
-std::array<float,2>{0.669881821f, 0.352406174f},
-std::array<float,2>{0.425145686f, 0.180364579f},
-std::array<float,2>{0.80825609f, 0.839490414f},
-std::array<float,2>{0.46125713f, 0.501072049f},
-std::array<float,2>{0.861097336f, 0.484929979f},
-std::array<float,2>{0.0960631147f, 0.0130974026f},
-std::array<float,2>{0.747771978f, 0.979901314f},
-std::array<float,2>{0.243512645f, 0.787811458f},
-std::array<float,2>{0.56746006f, 0.221181229f},
-std::array<float,2>{0.267033786f, 0.306578904f},
-std::array<float,2>{0.927909255f, 0.73015362f},
-std::array<float,2>{0.404470086f, 0.869804561f},
-std::array<float,2>{0.753160834f, 0.154186234f},
-std::array<float,2>{0.0119009018f, 0.317570865f},
-std::array<float,2>{0.64382273f, 0.686517954f},
-std::array<float,2>{0.184385821f, 0.571319163f},
-std::array<float,2>{0.548652828f, 0.379278511f},
-std::array<float,2>{0.312583566f, 0.117607564f},
-std::array<float,2>{0.970075846f, 0.916107953f},
-std::array<float,2>{0.31000185f, 0.696694732f},
-std::array<float,2>{0.899137616f, 0.261476487f},
-std::array<float,2>{0.209523603f, 0.19977273f},
-std::array<float,2>{0.605923355f, 0.755224168f},
-std::array<float,2>{0.0885992199f, 0.955978036f},
-std::array<float,2>{0.703304827f, 0.0622779988f},
-std::array<float,2>{0.498955637f, 0.468406409f},
-std::array<float,2>{0.837428153f, 0.548486888f},
-std::array<float,2>{0.320370376f, 0.831005633f},
-std::array<float,2>{0.983915329f, 0.178253844f},
-std::array<float,2>{0.176379919f, 0.350717753f},
-std::array<float,2>{0.562353313f, 0.650380015f},
-std::array<float,2>{5.00910428e-05f, 0.623167396f},
-std::array<float,2>{0.649189174f, 0.411220133f},
-std::array<float,2>{0.395463467f, 0.0896352828f},
-std::array<float,2>{0.76366812f, 0.882261992f},
-std::array<float,2>{0.489205688f, 0.720657349f},
-std::array<float,2>{0.8328197f, 0.298964232f},
-std::array<float,2>{0.0819792598f, 0.227954388f},
-std::array<float,2>{0.713522017f, 0.796329021f},
-std::array<float,2>{0.216000274f, 0.970763147f},
-std::array<float,2>{0.595624447f, 0.00170006754f},
-std::array<float,2>{0.300109029f, 0.497359037f},
-std::array<float,2>{0.894880831f, 0.512000978f},
-std::array<float,2>{0.435598761f, 0.911175311f},
-std::array<float,2>{0.801607311f, 0.111425698f},
-std::array<float,2>{0.042800162f, 0.387950182f},
-std::array<float,2>{0.660249054f, 0.566061318f},
-std::array<float,2>{0.127511621f, 0.673625946f},
-std::array<float,2>{0.510971844f, 0.323612809f},
-std::array<float,2>{0.366971552f, 0.145539701f},
-std::array<float,2>{0.962936044f, 0.864159763f},
-std::array<float,2>{0.27991724f, 0.561280251f},
-std::array<float,2>{0.933879197f, 0.458461195f},
-std::array<float,2>{0.240577787f, 0.0506525561f},
-std::array<float,2>{0.573450625f, 0.965390861f},
-std::array<float,2>{0.108463392f, 0.761914194f},
-std::array<float,2>{0.7384184f, 0.193372816f},
-std::array<float,2>{0.456040889f, 0.253780395f},
-std::array<float,2>{0.867778242f, 0.695082486f},
-std::array<float,2>{0.282024801f, 0.951542497f},
-std::array<float,2>{0.889865398f, 0.0334383696f},
-std::array<float,2>{0.194515079f, 0.446890324f},
-std::array<float,2>{0.616778553f, 0.533712089f},
-std::array<float,2>{0.0640126914f, 0.706716001f},
-std::array<float,2>{0.69648838f, 0.275156945f},
-std::array<float,2>{0.474510878f, 0.210158452f},
-std::array<float,2>{0.82594645f, 0.778588176f},
-std::array<float,2>{0.376982868f, 0.591683209f},
-std::array<float,2>{0.7735852f, 0.399483353f},
-std::array<float,2>{0.0221375413f, 0.0957122743f},
-std::array<float,2>{0.639280498f, 0.925323665f},
-std::array<float,2>{0.169743806f, 0.846672297f},
-std::array<float,2>{0.537713766f, 0.137093022f},
-std::array<float,2>{0.338424295f, 0.337412834f},
-std::array<float,2>{0.987173498f, 0.662749887f},
-std::array<float,2>{0.443903685f, 0.810140729f},
-std::array<float,2>{0.852061689f, 0.236349717f},
-std::array<float,2>{0.115498729f, 0.286898524f},
-std::array<float,2>{0.724480808f, 0.747255802f},
-std::array<float,2>{0.225482032f, 0.529208839f},
-std::array<float,2>{0.586307883f, 0.48390457f},
-std::array<float,2>{0.259049207f, 0.0216178242f},
-std::array<float,2>{0.912995398f, 0.998793125f},
-std::array<float,2>{0.355153531f, 0.636686027f},
-std::array<float,2>{0.9437657f, 0.373132467f},
-std::array<float,2>{0.148196086f, 0.161893815f},
-std::array<float,2>{0.520186663f, 0.818052292f},
-std::array<float,2>{0.0585831739f, 0.894529462f},
-std::array<float,2>{0.679503858f, 0.0711487234f},
-std::array<float,2>{0.407515615f, 0.434334159f},
-std::array<float,2>{0.786325634f, 0.604957581f},
-std::array<float,2>{0.275723338f, 0.827014267f},
-std::array<float,2>{0.933176816f, 0.164771348f},
-std::array<float,2>{0.23552224f, 0.366500258f},
-std::array<float,2>{0.574711502f, 0.630575299f},
-std::array<float,2>{0.102224939f, 0.597887933f},
-std::array<float,2>{0.737095952f, 0.423472553f},
-std::array<float,2>{0.458783686f, 0.0701101944f},
-std::array<float,2>{0.872378945f, 0.903128743f},
-std::array<float,2>{0.433281749f, 0.735136569f},
-std::array<float,2>{0.79687798f, 0.293888539f},
-std::array<float,2>{0.0433497131f, 0.24749276f},
-std::array<float,2>{0.658553541f, 0.799831927f},
-std::array<float,2>{0.129442722f, 0.986345947f},
-std::array<float,2>{0.515412271f, 0.0236113295f},
-std::array<float,2>{0.362786859f, 0.474069685f},
-std::array<float,2>{0.965759754f, 0.52068001f},
-std::array<float,2>{0.485854536f, 0.932838976f},
-std::array<float,2>{0.829378605f, 0.107728235f},
-std::array<float,2>{0.0830844492f, 0.393099189f},
-std::array<float,2>{0.715452075f, 0.585596323f},
-std::array<float,2>{0.212718979f, 0.668988645f},
-std::array<float,2>{0.601105988f, 0.332575172f},
-std::array<float,2>{0.304013401f, 0.12701571f},
-std::array<float,2>{0.894144058f, 0.858991742f},
-std::array<float,2>{0.325529695f, 0.5448789f},
-std::array<float,2>{0.977012753f, 0.438705683f},
-std::array<float,2>{0.175216883f, 0.0452235118f},
-std::array<float,2>{0.555705607f, 0.939034522f},
-std::array<float,2>{0.00620404212f, 0.766289175f},
-std::array<float,2>{0.653490722f, 0.217653468f},
-std::array<float,2>{0.391495049f, 0.266968668f},
-std::array<float,2>{0.7584849f, 0.715411067f},
-std::array<float,2>{0.355574071f, 0.959056258f},
-std::array<float,2>{0.939203382f, 0.0566511415f},
-std::array<float,2>{0.1426875f, 0.464373142f},
-std::array<float,2>{0.517472923f, 0.551393926f},
-std::array<float,2>{0.0615192764f, 0.700300097f},
-std::array<float,2>{0.673991144f, 0.263664097f},
-std::array<float,2>{0.41136542f, 0.195517316f},
-std::array<float,2>{0.783224404f, 0.753473222f},
-std::array<float,2>{0.438880593f, 0.575702131f},
-std::array<float,2>{0.857567251f, 0.376693428f},
-std::array<float,2>{0.11070846f, 0.122195058f},
-std::array<float,2>{0.720490277f, 0.921742976f},
-std::array<float,2>{0.219981849f, 0.87496525f},
-std::array<float,2>{0.590453863f, 0.150222629f},
-std::array<float,2>{0.262886137f, 0.314692229f},
-std::array<float,2>{0.908444047f, 0.680142105f},
-std::array<float,2>{0.379677415f, 0.781607151f},
-std::array<float,2>{0.778232694f, 0.224617049f},
-std::array<float,2>{0.0185410138f, 0.311127186f},
-std::array<float,2>{0.634256661f, 0.731883526f},
-std::array<float,2>{0.165136084f, 0.504173994f},
-std::array<float,2>{0.533283472f, 0.491869599f},
-std::array<float,2>{0.341091216f, 0.00819482468f},
-std::array<float,2>{0.990486979f, 0.980727494f},
-std::array<float,2>{0.285522699f, 0.646242321f},
-std::array<float,2>{0.883461475f, 0.356886476f},
-std::array<float,2>{0.19113262f, 0.184989318f},
-std::array<float,2>{0.612527966f, 0.840576708f},
-std::array<float,2>{0.0665965304f, 0.889784575f},
-std::array<float,2>{0.70042789f, 0.0800562426f},
-std::array<float,2>{0.472186744f, 0.418502063f},
-std::array<float,2>{0.822871327f, 0.613439143f},
-std::array<float,2>{0.333117336f, 0.758359194f},
-std::array<float,2>{0.992722094f, 0.189386159f},
-std::array<float,2>{0.161637962f, 0.257223964f},
-std::array<float,2>{0.540117323f, 0.690021515f},
-std::array<float,2>{0.0250864681f, 0.556896031f},
-std::array<float,2>{0.627806127f, 0.455081016f},
-std::array<float,2>{0.384849727f, 0.0544574223f},
-std::array<float,2>{0.766260147f, 0.964420676f},
-std::array<float,2>{0.481808603f, 0.67632401f},
-std::array<float,2>{0.816463053f, 0.327814966f},
-std::array<float,2>{0.0769471601f, 0.142472655f},
-std::array<float,2>{0.693085194f, 0.859493852f},
-std::array<float,2>{0.201332599f, 0.907992005f},
-std::array<float,2>{0.620478332f, 0.113555789f},
-std::array<float,2>{0.290497035f, 0.38648966f},
-std::array<float,2>{0.876719475f, 0.569524407f},
-std::array<float,2>{0.417692065f, 0.975952029f},
-std::array<float,2>{0.795655429f, 0.00480314856f},
-std::array<float,2>{0.0473725572f, 0.495134264f},
-std::array<float,2>{0.685239494f, 0.509051621f},
-std::array<float,2>{0.152968332f, 0.723436296f},
-std::array<float,2>{0.526187956f, 0.302738667f},
-std::array<float,2>{0.348040462f, 0.231071174f},
-std::array<float,2>{0.950281024f, 0.789176643f},
-std::array<float,2>{0.254575968f, 0.619233489f},
-std::array<float,2>{0.914750099f, 0.406716108f},
-std::array<float,2>{0.233248189f, 0.08987578f},
-std::array<float,2>{0.584734499f, 0.877423763f},
-std::array<float,2>{0.118822791f, 0.834522486f},
-std::array<float,2>{0.728159368f, 0.175567552f},
-std::array<float,2>{0.449134022f, 0.343838274f},
-std::array<float,2>{0.844850481f, 0.653603256f},
-std::array<float,2>{0.304913163f, 0.895482898f},
-std::array<float,2>{0.905438066f, 0.0776835456f},
-std::array<float,2>{0.204802558f, 0.429764658f},
-std::array<float,2>{0.603498697f, 0.608153641f},
-std::array<float,2>{0.0934315398f, 0.640528262f},
-std::array<float,2>{0.709106266f, 0.368160456f},
-std::array<float,2>{0.494907051f, 0.156617478f},
-std::array<float,2>{0.84084934f, 0.813046217f},
-std::array<float,2>{0.399664402f, 0.52526927f},
-std::array<float,2>{0.756928146f, 0.480393857f},
-std::array<float,2>{0.0108965682f, 0.0168006085f},
-std::array<float,2>{0.647632897f, 0.995261431f},
-std::array<float,2>{0.180445656f, 0.804947734f},
-std::array<float,2>{0.554285347f, 0.240365386f},
-std::array<float,2>{0.318325102f, 0.281359822f},
-std::array<float,2>{0.972867072f, 0.742670178f},
-std::array<float,2>{0.467356294f, 0.84885484f},
-std::array<float,2>{0.865516424f, 0.134559587f},
-std::array<float,2>{0.0985307246f, 0.340510547f},
-std::array<float,2>{0.743245363f, 0.657689452f},
-std::array<float,2>{0.248669267f, 0.588478208f},
-std::array<float,2>{0.562748849f, 0.405780464f},
-std::array<float,2>{0.270978034f, 0.0996640325f},
-std::array<float,2>{0.923946142f, 0.92924124f},
-std::array<float,2>{0.373525411f, 0.708793521f},
-std::array<float,2>{0.958857834f, 0.279949129f},
-std::array<float,2>{0.139419734f, 0.204741076f},
-std::array<float,2>{0.503696024f, 0.776959777f},
-std::array<float,2>{0.0379772373f, 0.947481275f},
-std::array<float,2>{0.666374862f, 0.0351740643f},
-std::array<float,2>{0.427234232f, 0.449786514f},
-std::array<float,2>{0.812312126f, 0.53889966f},
-std::array<float,2>{0.294047564f, 0.803832054f},
-std::array<float,2>{0.879193664f, 0.245901167f},
-std::array<float,2>{0.198294967f, 0.29065308f},
-std::array<float,2>{0.623994768f, 0.738630593f},
-std::array<float,2>{0.0715754926f, 0.519276977f},
-std::array<float,2>{0.6909343f, 0.469320655f},
-std::array<float,2>{0.478054315f, 0.0281200614f},
-std::array<float,2>{0.81403327f, 0.990877092f},
-std::array<float,2>{0.387212992f, 0.625901759f},
-std::array<float,2>{0.770637631f, 0.361391276f},
-std::array<float,2>{0.0274270661f, 0.168802872f},
-std::array<float,2>{0.630203366f, 0.8203668f},
-std::array<float,2>{0.157940269f, 0.899909973f},
-std::array<float,2>{0.545801103f, 0.0661921725f},
-std::array<float,2>{0.330296308f, 0.428464234f},
-std::array<float,2>{0.99861747f, 0.59562552f},
-std::array<float,2>{0.449772179f, 0.94212997f},
-std::array<float,2>{0.851518452f, 0.0422414839f},
-std::array<float,2>{0.121520162f, 0.443235308f},
-std::array<float,2>{0.731735229f, 0.539672911f},
-std::array<float,2>{0.228708491f, 0.71472621f},
-std::array<float,2>{0.580117404f, 0.272907019f},
-std::array<float,2>{0.252743393f, 0.214799359f},
-std::array<float,2>{0.918624461f, 0.771030247f},
-std::array<float,2>{0.347055584f, 0.581490517f},
-std::array<float,2>{0.945645452f, 0.395362139f},
-std::array<float,2>{0.149232447f, 0.104558013f},
-std::array<float,2>{0.530796707f, 0.934559226f},
-std::array<float,2>{0.0523174778f, 0.85541904f},
-std::array<float,2>{0.681704223f, 0.129019782f},
-std::array<float,2>{0.420981497f, 0.328951508f},
-std::array<float,2>{0.791858137f, 0.666281104f},
-std::array<float,2>{0.316138715f, 0.915439725f},
-std::array<float,2>{0.972227871f, 0.119493477f},
-std::array<float,2>{0.186263978f, 0.38269043f},
-std::array<float,2>{0.549097478f, 0.572791398f},
-std::array<float,2>{0.0147875976f, 0.68368572f},
-std::array<float,2>{0.640728951f, 0.318793267f},
-std::array<float,2>{0.403297156f, 0.155954555f},
-std::array<float,2>{0.750912964f, 0.868038774f},
-std::array<float,2>{0.497178763f, 0.54971391f},
-std::array<float,2>{0.83932519f, 0.466468424f},
-std::array<float,2>{0.0866986141f, 0.0603245012f},
-std::array<float,2>{0.706325173f, 0.953278303f},
-std::array<float,2>{0.207318708f, 0.756167769f},
-std::array<float,2>{0.60807234f, 0.201446176f},
-std::array<float,2>{0.311775148f, 0.257989079f},
-std::array<float,2>{0.901446998f, 0.698459685f},
-std::array<float,2>{0.423491985f, 0.83772552f},
-std::array<float,2>{0.805405736f, 0.18305248f},
-std::array<float,2>{0.0338394307f, 0.354994327f},
-std::array<float,2>{0.67023766f, 0.643641889f},
-std::array<float,2>{0.133439749f, 0.609645963f},
-std::array<float,2>{0.507530928f, 0.417348623f},
-std::array<float,2>{0.368194878f, 0.0852952451f},
-std::array<float,2>{0.953626692f, 0.886128247f},
-std::array<float,2>{0.269485831f, 0.728430569f},
-std::array<float,2>{0.926789522f, 0.307683617f},
-std::array<float,2>{0.244828314f, 0.21954301f},
-std::array<float,2>{0.57019037f, 0.786128163f},
-std::array<float,2>{0.0949634016f, 0.976906836f},
-std::array<float,2>{0.749583244f, 0.0145200165f},
-std::array<float,2>{0.464270771f, 0.488256633f},
-std::array<float,2>{0.862614393f, 0.502796054f},
-std::array<float,2>{0.365095139f, 0.866587222f},
-std::array<float,2>{0.962346017f, 0.146927804f},
-std::array<float,2>{0.125884533f, 0.320687264f},
-std::array<float,2>{0.509012341f, 0.675017416f},
-std::array<float,2>{0.0394931026f, 0.562697291f},
-std::array<float,2>{0.662210524f, 0.38900438f},
-std::array<float,2>{0.434197903f, 0.111143567f},
-std::array<float,2>{0.802826822f, 0.913891673f},
-std::array<float,2>{0.453213394f, 0.692115307f},
-std::array<float,2>{0.869141519f, 0.251411319f},
-std::array<float,2>{0.106496669f, 0.193168715f},
-std::array<float,2>{0.741572678f, 0.764851689f},
-std::array<float,2>{0.239960089f, 0.967900038f},
-std::array<float,2>{0.571693957f, 0.0484061986f},
-std::array<float,2>{0.279254317f, 0.460177958f},
-std::array<float,2>{0.937313974f, 0.559875071f},
-std::array<float,2>{0.396972954f, 0.880628526f},
-std::array<float,2>{0.764480293f, 0.0876205415f},
-std::array<float,2>{0.00390139315f, 0.413537562f},
-std::array<float,2>{0.651329994f, 0.621403098f},
-std::array<float,2>{0.177996129f, 0.651858032f},
-std::array<float,2>{0.559660554f, 0.348335564f},
-std::array<float,2>{0.323572189f, 0.177548125f},
-std::array<float,2>{0.981552958f, 0.828666091f},
-std::array<float,2>{0.298476547f, 0.51516521f},
-std::array<float,2>{0.898120582f, 0.499711901f},
-std::array<float,2>{0.217764184f, 0.00349267549f},
-std::array<float,2>{0.596326828f, 0.969874978f},
-std::array<float,2>{0.0789418072f, 0.793699563f},
-std::array<float,2>{0.711653352f, 0.230348557f},
-std::array<float,2>{0.491131276f, 0.297393173f},
-std::array<float,2>{0.835059941f, 0.72136569f},
-std::array<float,2>{0.260718465f, 0.997794807f},
-std::array<float,2>{0.911730647f, 0.0202316027f},
-std::array<float,2>{0.223665118f, 0.481381267f},
-std::array<float,2>{0.589642167f, 0.529337287f},
-std::array<float,2>{0.113813549f, 0.749831915f},
-std::array<float,2>{0.724943101f, 0.28816244f},
-std::array<float,2>{0.442380667f, 0.23621054f},
-std::array<float,2>{0.854318798f, 0.812299073f},
-std::array<float,2>{0.408479095f, 0.601918757f},
-std::array<float,2>{0.787900448f, 0.435727865f},
-std::array<float,2>{0.0558090061f, 0.0734201297f},
-std::array<float,2>{0.677379072f, 0.891530156f},
-std::array<float,2>{0.145697638f, 0.819681168f},
-std::array<float,2>{0.522300184f, 0.163239986f},
-std::array<float,2>{0.351780355f, 0.371330529f},
-std::array<float,2>{0.941828489f, 0.632967114f},
-std::array<float,2>{0.476452351f, 0.780382633f},
-std::array<float,2>{0.827683806f, 0.207211494f},
-std::array<float,2>{0.0644988641f, 0.275921285f},
-std::array<float,2>{0.698808312f, 0.703364551f},
-std::array<float,2>{0.191468626f, 0.531894863f},
-std::array<float,2>{0.615030646f, 0.44889611f},
-std::array<float,2>{0.284449458f, 0.0320195258f},
-std::array<float,2>{0.887501836f, 0.950704038f},
-std::array<float,2>{0.337498546f, 0.660528481f},
-std::array<float,2>{0.98528868f, 0.339597583f},
-std::array<float,2>{0.170338914f, 0.138711765f},
-std::array<float,2>{0.536182821f, 0.844188511f},
-std::array<float,2>{0.0197674539f, 0.923463702f},
-std::array<float,2>{0.637644827f, 0.0946477428f},
-std::array<float,2>{0.376932114f, 0.401586235f},
-std::array<float,2>{0.77621156f, 0.593722165f},
-std::array<float,2>{0.262207031f, 0.871471405f},
-std::array<float,2>{0.909648836f, 0.150572404f},
-std::array<float,2>{0.219084755f, 0.314021856f},
-std::array<float,2>{0.591089249f, 0.682290971f},
-std::array<float,2>{0.1094414f, 0.576463521f},
-std::array<float,2>{0.719052017f, 0.37794894f},
-std::array<float,2>{0.438304156f, 0.123048089f},
-std::array<float,2>{0.858548284f, 0.918688476f},
-std::array<float,2>{0.410224795f, 0.702510297f},
-std::array<float,2>{0.784224868f, 0.263676733f},
-std::array<float,2>{0.0617006868f, 0.197730303f},
-std::array<float,2>{0.67484045f, 0.751541376f},
-std::array<float,2>{0.144075572f, 0.9585253f},
-std::array<float,2>{0.516123235f, 0.0565012582f},
-std::array<float,2>{0.35730353f, 0.46119532f},
-std::array<float,2>{0.938328147f, 0.55360955f},
-std::array<float,2>{0.471653253f, 0.888503492f},
-std::array<float,2>{0.824143946f, 0.0805859417f},
-std::array<float,2>{0.067846112f, 0.420117527f},
-std::array<float,2>{0.69958514f, 0.616625607f},
-std::array<float,2>{0.189575925f, 0.647917509f},
-std::array<float,2>{0.611952662f, 0.358424872f},
-std::array<float,2>{0.28625533f, 0.186374515f},
-std::array<float,2>{0.884484708f, 0.841900885f},
-std::array<float,2>{0.340374559f, 0.507013559f},
-std::array<float,2>{0.991646111f, 0.488463998f},
-std::array<float,2>{0.164731875f, 0.0112190507f},
-std::array<float,2>{0.534747601f, 0.983848631f},
-std::array<float,2>{0.0187917333f, 0.783824265f},
-std::array<float,2>{0.633015811f, 0.224258959f},
-std::array<float,2>{0.380542487f, 0.30990389f},
-std::array<float,2>{0.778545737f, 0.733095467f},
-std::array<float,2>{0.36179775f, 0.986310065f},
-std::array<float,2>{0.966419697f, 0.0267669931f},
-std::array<float,2>{0.130132675f, 0.47588554f},
-std::array<float,2>{0.513702214f, 0.523211122f},
-std::array<float,2>{0.0440587737f, 0.737342536f},
-std::array<float,2>{0.660140038f, 0.294929177f},
-std::array<float,2>{0.432158887f, 0.248197347f},
-std::array<float,2>{0.798421979f, 0.798696339f},
-std::array<float,2>{0.457161009f, 0.601362705f},
-std::array<float,2>{0.871484756f, 0.423917979f},
-std::array<float,2>{0.103487052f, 0.0666582584f},
-std::array<float,2>{0.738031507f, 0.904911995f},
-std::array<float,2>{0.234853819f, 0.825561047f},
-std::array<float,2>{0.575878441f, 0.166348651f},
-std::array<float,2>{0.276751548f, 0.364467978f},
-std::array<float,2>{0.93248266f, 0.631814539f},
-std::array<float,2>{0.392549485f, 0.768884718f},
-std::array<float,2>{0.759219646f, 0.216509491f},
-std::array<float,2>{0.0069235093f, 0.268881679f},
-std::array<float,2>{0.653251231f, 0.717148542f},
-std::array<float,2>{0.173998073f, 0.546214342f},
-std::array<float,2>{0.555618346f, 0.441358775f},
-std::array<float,2>{0.324661016f, 0.0435614027f},
-std::array<float,2>{0.977844715f, 0.940349936f},
-std::array<float,2>{0.302755773f, 0.670821548f},
-std::array<float,2>{0.892643332f, 0.334330678f},
-std::array<float,2>{0.211620584f, 0.126767814f},
-std::array<float,2>{0.600483775f, 0.85628587f},
-std::array<float,2>{0.0827937797f, 0.930500269f},
-std::array<float,2>{0.716641247f, 0.107040681f},
-std::array<float,2>{0.484792531f, 0.391916573f},
-std::array<float,2>{0.828868747f, 0.583759248f},
-std::array<float,2>{0.31697312f, 0.807888865f},
-std::array<float,2>{0.973795652f, 0.238745928f},
-std::array<float,2>{0.181346223f, 0.285059482f},
-std::array<float,2>{0.552847087f, 0.744272292f},
-std::array<float,2>{0.0102912439f, 0.525711477f},
-std::array<float,2>{0.646621943f, 0.478141248f},
-std::array<float,2>{0.399324685f, 0.0180148929f},
-std::array<float,2>{0.756288946f, 0.992904902f},
-std::array<float,2>{0.495264798f, 0.638583004f},
-std::array<float,2>{0.840520501f, 0.370466202f},
-std::array<float,2>{0.0922120735f, 0.159765512f},
-std::array<float,2>{0.710153878f, 0.815195084f},
-std::array<float,2>{0.203893468f, 0.897619784f},
-std::array<float,2>{0.601693213f, 0.0752828643f},
-std::array<float,2>{0.306485593f, 0.431815416f},
-std::array<float,2>{0.904518783f, 0.60737288f},
-std::array<float,2>{0.426201195f, 0.946546614f},
-std::array<float,2>{0.810664177f, 0.0371153019f},
-std::array<float,2>{0.0389063917f, 0.452301383f},
-std::array<float,2>{0.667521536f, 0.537062049f},
-std::array<float,2>{0.139867097f, 0.709275961f},
-std::array<float,2>{0.50275588f, 0.277896345f},
-std::array<float,2>{0.374475002f, 0.205756307f},
-std::array<float,2>{0.957301974f, 0.775003195f},
-std::array<float,2>{0.269608945f, 0.587011218f},
-std::array<float,2>{0.925096631f, 0.404000819f},
-std::array<float,2>{0.249324888f, 0.0980280936f},
-std::array<float,2>{0.564185083f, 0.92762655f},
-std::array<float,2>{0.0989263803f, 0.851263165f},
-std::array<float,2>{0.742881894f, 0.135603905f},
-std::array<float,2>{0.468676776f, 0.343387544f},
-std::array<float,2>{0.867002726f, 0.659547687f},
-std::array<float,2>{0.289470851f, 0.909888208f},
-std::array<float,2>{0.875412047f, 0.117011331f},
-std::array<float,2>{0.202250972f, 0.384041816f},
-std::array<float,2>{0.619795442f, 0.567837954f},
-std::array<float,2>{0.0772097781f, 0.679157495f},
-std::array<float,2>{0.69178617f, 0.325888157f},
-std::array<float,2>{0.481160551f, 0.142782971f},
-std::array<float,2>{0.817982018f, 0.861909091f},
-std::array<float,2>{0.386681437f, 0.555726469f},
-std::array<float,2>{0.767398715f, 0.453409076f},
-std::array<float,2>{0.02402246f, 0.0521922596f},
-std::array<float,2>{0.628854215f, 0.961479366f},
-std::array<float,2>{0.160359025f, 0.761209369f},
-std::array<float,2>{0.539318144f, 0.190620854f},
-std::array<float,2>{0.332347274f, 0.254486799f},
-std::array<float,2>{0.993634284f, 0.688177884f},
-std::array<float,2>{0.448033541f, 0.833713651f},
-std::array<float,2>{0.843982279f, 0.172410354f},
-std::array<float,2>{0.117533244f, 0.346023411f},
-std::array<float,2>{0.726696312f, 0.656240523f},
-std::array<float,2>{0.233958006f, 0.617975473f},
-std::array<float,2>{0.585636437f, 0.408933759f},
-std::array<float,2>{0.255189508f, 0.0922015011f},
-std::array<float,2>{0.915372014f, 0.876683593f},
-std::array<float,2>{0.348671973f, 0.72560972f},
-std::array<float,2>{0.950148106f, 0.302160382f},
-std::array<float,2>{0.153457031f, 0.233990133f},
-std::array<float,2>{0.526580095f, 0.792568207f},
-std::array<float,2>{0.0482106283f, 0.973359466f},
-std::array<float,2>{0.684199095f, 0.00714791566f},
-std::array<float,2>{0.416649401f, 0.493539721f},
-std::array<float,2>{0.796300113f, 0.509837985f},
-std::array<float,2>{0.310799897f, 0.754663646f},
-std::array<float,2>{0.901123762f, 0.200902626f},
-std::array<float,2>{0.208605319f, 0.260141909f},
-std::array<float,2>{0.608449221f, 0.695700467f},
-std::array<float,2>{0.0875725001f, 0.54728955f},
-std::array<float,2>{0.705315411f, 0.467140853f},
-std::array<float,2>{0.496813446f, 0.060724508f},
-std::array<float,2>{0.838146329f, 0.956234276f},
-std::array<float,2>{0.403835595f, 0.686889231f},
-std::array<float,2>{0.751117766f, 0.316773027f},
-std::array<float,2>{0.0137320776f, 0.152412176f},
-std::array<float,2>{0.642497599f, 0.870543242f},
-std::array<float,2>{0.186642706f, 0.917584717f},
-std::array<float,2>{0.550623953f, 0.119121119f},
-std::array<float,2>{0.314962864f, 0.380769938f},
-std::array<float,2>{0.971575677f, 0.571006596f},
-std::array<float,2>{0.463189304f, 0.97885108f},
-std::array<float,2>{0.861542165f, 0.0122610191f},
-std::array<float,2>{0.0943034217f, 0.485498369f},
-std::array<float,2>{0.748110414f, 0.500718176f},
-std::array<float,2>{0.245895579f, 0.729247391f},
-std::array<float,2>{0.568380654f, 0.30475089f},
-std::array<float,2>{0.268476307f, 0.222343221f},
-std::array<float,2>{0.926170707f, 0.788228214f},
-std::array<float,2>{0.36742565f, 0.611580849f},
-std::array<float,2>{0.955077529f, 0.415814131f},
-std::array<float,2>{0.134324193f, 0.0832725689f},
-std::array<float,2>{0.506052017f, 0.88413465f},
-std::array<float,2>{0.034317404f, 0.838787735f},
-std::array<float,2>{0.671394885f, 0.181371167f},
-std::array<float,2>{0.422077298f, 0.352674246f},
-std::array<float,2>{0.806093454f, 0.641174078f},
-std::array<float,2>{0.331701249f, 0.901860595f},
-std::array<float,2>{0.999343395f, 0.0640642792f},
-std::array<float,2>{0.156565979f, 0.427664459f},
-std::array<float,2>{0.546347499f, 0.597034633f},
-std::array<float,2>{0.0292513091f, 0.627961993f},
-std::array<float,2>{0.629555285f, 0.359501123f},
-std::array<float,2>{0.388584554f, 0.17076464f},
-std::array<float,2>{0.769566f, 0.824070454f},
-std::array<float,2>{0.476947665f, 0.516156852f},
-std::array<float,2>{0.812862515f, 0.471797258f},
-std::array<float,2>{0.0710737333f, 0.0294184703f},
-std::array<float,2>{0.689800799f, 0.990023851f},
-std::array<float,2>{0.197457045f, 0.802196085f},
-std::array<float,2>{0.62490958f, 0.242640167f},
-std::array<float,2>{0.293243855f, 0.29295978f},
-std::array<float,2>{0.880501032f, 0.741957068f},
-std::array<float,2>{0.420660973f, 0.852144957f},
-std::array<float,2>{0.792505741f, 0.131627962f},
-std::array<float,2>{0.050853949f, 0.33111465f},
-std::array<float,2>{0.683018565f, 0.66455704f},
-std::array<float,2>{0.149811998f, 0.579964757f},
-std::array<float,2>{0.529751241f, 0.39651233f},
-std::array<float,2>{0.346140236f, 0.103025787f},
-std::array<float,2>{0.946522593f, 0.936251044f},
-std::array<float,2>{0.253901154f, 0.711463809f},
-std::array<float,2>{0.919096231f, 0.269951463f},
-std::array<float,2>{0.23021993f, 0.212068513f},
-std::array<float,2>{0.581893563f, 0.772673011f},
-std::array<float,2>{0.122823261f, 0.944186866f},
-std::array<float,2>{0.730803132f, 0.0400456674f},
-std::array<float,2>{0.450303048f, 0.445110559f},
-std::array<float,2>{0.849879503f, 0.541882753f},
-std::array<float,2>{0.353212118f, 0.816925406f},
-std::array<float,2>{0.943295777f, 0.160452038f},
-std::array<float,2>{0.145496428f, 0.374692857f},
-std::array<float,2>{0.5226987f, 0.635213733f},
-std::array<float,2>{0.0556411259f, 0.604200959f},
-std::array<float,2>{0.675910473f, 0.434619844f},
-std::array<float,2>{0.40969044f, 0.0713606849f},
-std::array<float,2>{0.788301408f, 0.8926121f},
-std::array<float,2>{0.44309184f, 0.746516109f},
-std::array<float,2>{0.854672253f, 0.285927236f},
-std::array<float,2>{0.114572503f, 0.238079324f},
-std::array<float,2>{0.726206958f, 0.809219062f},
-std::array<float,2>{0.223183155f, 0.999767125f},
-std::array<float,2>{0.588177264f, 0.0229461677f},
-std::array<float,2>{0.261417031f, 0.482852787f},
-std::array<float,2>{0.910716772f, 0.527799964f},
-std::array<float,2>{0.375886291f, 0.924543917f},
-std::array<float,2>{0.777246952f, 0.0970454663f},
-std::array<float,2>{0.0212670304f, 0.399312288f},
-std::array<float,2>{0.638041437f, 0.590297937f},
-std::array<float,2>{0.171450987f, 0.663512468f},
-std::array<float,2>{0.535743713f, 0.336836249f},
-std::array<float,2>{0.336488098f, 0.138335109f},
-std::array<float,2>{0.985561311f, 0.847281456f},
-std::array<float,2>{0.284034729f, 0.534764946f},
-std::array<float,2>{0.88811487f, 0.445980608f},
-std::array<float,2>{0.192875057f, 0.0350215062f},
-std::array<float,2>{0.613712251f, 0.952482104f},
-std::array<float,2>{0.0663730502f, 0.778217494f},
-std::array<float,2>{0.697773993f, 0.209325299f},
-std::array<float,2>{0.475097746f, 0.274102002f},
-std::array<float,2>{0.826367915f, 0.705159426f},
-std::array<float,2>{0.277541548f, 0.966786861f},
-std::array<float,2>{0.936276257f, 0.0488812886f},
-std::array<float,2>{0.239142984f, 0.457181156f},
-std::array<float,2>{0.570993185f, 0.561704636f},
-std::array<float,2>{0.106193058f, 0.693683147f},
-std::array<float,2>{0.740776241f, 0.252014965f},
-std::array<float,2>{0.454905957f, 0.194513127f},
-std::array<float,2>{0.870702088f, 0.76341486f},
-std::array<float,2>{0.435505152f, 0.565314114f},
-std::array<float,2>{0.803990662f, 0.38714686f},
-std::array<float,2>{0.0407547913f, 0.113123782f},
-std::array<float,2>{0.663390815f, 0.910674572f},
-std::array<float,2>{0.126028538f, 0.86509335f},
-std::array<float,2>{0.508278489f, 0.144538447f},
-std::array<float,2>{0.363330007f, 0.322830498f},
-std::array<float,2>{0.9610883f, 0.672221005f},
-std::array<float,2>{0.491982281f, 0.795322299f},
-std::array<float,2>{0.834849298f, 0.227084681f},
-std::array<float,2>{0.0792259574f, 0.299997717f},
-std::array<float,2>{0.711919606f, 0.719398797f},
-std::array<float,2>{0.218401298f, 0.513393342f},
-std::array<float,2>{0.597194016f, 0.497059047f},
-std::array<float,2>{0.296930134f, 0.000435004797f},
-std::array<float,2>{0.896975458f, 0.971736789f},
-std::array<float,2>{0.322683781f, 0.649376929f},
-std::array<float,2>{0.980759084f, 0.349986076f},
-std::array<float,2>{0.179277062f, 0.178721055f},
-std::array<float,2>{0.559301376f, 0.831067145f},
-std::array<float,2>{0.00271170936f, 0.881125212f},
-std::array<float,2>{0.652214527f, 0.0886707455f},
-std::array<float,2>{0.397695184f, 0.410668969f},
-std::array<float,2>{0.765206099f, 0.624536335f},
-std::array<float,2>{0.288106322f, 0.841320097f},
-std::array<float,2>{0.885401368f, 0.183864415f},
-std::array<float,2>{0.188209713f, 0.355807573f},
-std::array<float,2>{0.60978204f, 0.644535124f},
-std::array<float,2>{0.0697338209f, 0.615184486f},
-std::array<float,2>{0.701713085f, 0.419711828f},
-std::array<float,2>{0.469984502f, 0.0789179876f},
-std::array<float,2>{0.821579039f, 0.889392138f},
-std::array<float,2>{0.381401062f, 0.73107338f},
-std::array<float,2>{0.779428542f, 0.312113851f},
-std::array<float,2>{0.0170456562f, 0.225630701f},
-std::array<float,2>{0.63500005f, 0.782737195f},
-std::array<float,2>{0.167663857f, 0.981971622f},
-std::array<float,2>{0.531937897f, 0.00925162993f},
-std::array<float,2>{0.342285722f, 0.490967393f},
-std::array<float,2>{0.989996374f, 0.504946828f},
-std::array<float,2>{0.440857589f, 0.920016289f},
-std::array<float,2>{0.85672015f, 0.121198855f},
-std::array<float,2>{0.112915844f, 0.375782907f},
-std::array<float,2>{0.721357465f, 0.574941158f},
-std::array<float,2>{0.222635403f, 0.681332529f},
-std::array<float,2>{0.59229207f, 0.315535277f},
-std::array<float,2>{0.26468572f, 0.149138123f},
-std::array<float,2>{0.907001197f, 0.873272955f},
-std::array<float,2>{0.357423514f, 0.552276671f},
-std::array<float,2>{0.941359282f, 0.463243097f},
-std::array<float,2>{0.141358197f, 0.0583453774f},
-std::array<float,2>{0.517782331f, 0.960341692f},
-std::array<float,2>{0.0593417175f, 0.751966655f},
-std::array<float,2>{0.672998607f, 0.196990997f},
-std::array<float,2>{0.413998485f, 0.262450069f},
-std::array<float,2>{0.783154547f, 0.700090766f},
-std::array<float,2>{0.326562643f, 0.937500358f},
-std::array<float,2>{0.979844213f, 0.0462696664f},
-std::array<float,2>{0.172364235f, 0.438023061f},
-std::array<float,2>{0.557084441f, 0.543577671f},
-std::array<float,2>{0.00473714247f, 0.716693521f},
-std::array<float,2>{0.655560791f, 0.266042024f},
-std::array<float,2>{0.393267453f, 0.218748644f},
-std::array<float,2>{0.759897053f, 0.766782045f},
-std::array<float,2>{0.487756759f, 0.584723115f},
-std::array<float,2>{0.831171632f, 0.394107938f},
-std::array<float,2>{0.0858988315f, 0.109211817f},
-std::array<float,2>{0.717761278f, 0.93226552f},
-std::array<float,2>{0.214474142f, 0.858060658f},
-std::array<float,2>{0.599104583f, 0.128771409f},
-std::array<float,2>{0.302266657f, 0.333031178f},
-std::array<float,2>{0.891520441f, 0.668266475f},
-std::array<float,2>{0.430750906f, 0.79957813f},
-std::array<float,2>{0.800761878f, 0.246391714f},
-std::array<float,2>{0.0454148352f, 0.294402808f},
-std::array<float,2>{0.656450689f, 0.735856116f},
-std::array<float,2>{0.132286996f, 0.519652128f},
-std::array<float,2>{0.512665093f, 0.472885311f},
-std::array<float,2>{0.360953331f, 0.0253287796f},
-std::array<float,2>{0.966952443f, 0.987662852f},
-std::array<float,2>{0.274889499f, 0.628909588f},
-std::array<float,2>{0.930413127f, 0.365266591f},
-std::array<float,2>{0.236973062f, 0.165721327f},
-std::array<float,2>{0.577825487f, 0.828117251f},
-std::array<float,2>{0.104526237f, 0.903716803f},
-std::array<float,2>{0.735115707f, 0.0686814636f},
-std::array<float,2>{0.460756868f, 0.422364742f},
-std::array<float,2>{0.873054624f, 0.599583387f},
-std::array<float,2>{0.372245312f, 0.775938511f},
-std::array<float,2>{0.960062623f, 0.20314607f},
-std::array<float,2>{0.136722341f, 0.281248063f},
-std::array<float,2>{0.501251519f, 0.707036018f},
-std::array<float,2>{0.0370586067f, 0.537725985f},
-std::array<float,2>{0.664142966f, 0.450455129f},
-std::array<float,2>{0.42948702f, 0.0361951552f},
-std::array<float,2>{0.810052395f, 0.949142456f},
-std::array<float,2>{0.466160953f, 0.656760275f},
-std::array<float,2>{0.86450249f, 0.340924561f},
-std::array<float,2>{0.10059198f, 0.132908672f},
-std::array<float,2>{0.745597303f, 0.848282397f},
-std::array<float,2>{0.247267216f, 0.927855015f},
-std::array<float,2>{0.565978706f, 0.10091155f},
-std::array<float,2>{0.271574885f, 0.404340535f},
-std::array<float,2>{0.922157645f, 0.58935684f},
-std::array<float,2>{0.40201202f, 0.99430263f},
-std::array<float,2>{0.755704165f, 0.0161426943f},
-std::array<float,2>{0.00822510477f, 0.479100049f},
-std::array<float,2>{0.645616055f, 0.524161935f},
-std::array<float,2>{0.181701288f, 0.744043648f},
-std::array<float,2>{0.552703619f, 0.282891482f},
-std::array<float,2>{0.319582164f, 0.241374269f},
-std::array<float,2>{0.974822342f, 0.80571717f},
-std::array<float,2>{0.306739151f, 0.608664215f},
-std::array<float,2>{0.903546929f, 0.431464612f},
-std::array<float,2>{0.205177203f, 0.0770708919f},
-std::array<float,2>{0.604783595f, 0.896144509f},
-std::array<float,2>{0.0899710953f, 0.814445913f},
-std::array<float,2>{0.707747936f, 0.157775685f},
-std::array<float,2>{0.492715687f, 0.368196964f},
-std::array<float,2>{0.843568206f, 0.639309108f},
-std::array<float,2>{0.256213605f, 0.878401339f},
-std::array<float,2>{0.916905761f, 0.0908738747f},
-std::array<float,2>{0.231563553f, 0.40747264f},
-std::array<float,2>{0.583828747f, 0.621053636f},
-std::array<float,2>{0.120771907f, 0.65248549f},
-std::array<float,2>{0.729300737f, 0.345569551f},
-std::array<float,2>{0.445541471f, 0.174724266f},
-std::array<float,2>{0.847275376f, 0.83593291f},
-std::array<float,2>{0.414158016f, 0.508742571f},
-std::array<float,2>{0.794243217f, 0.494581819f},
-std::array<float,2>{0.0493419804f, 0.00501655601f},
-std::array<float,2>{0.687112033f, 0.974744141f},
-std::array<float,2>{0.155389801f, 0.79069978f},
-std::array<float,2>{0.524258494f, 0.231499657f},
-std::array<float,2>{0.349891931f, 0.304074883f},
-std::array<float,2>{0.952438176f, 0.724187016f},
-std::array<float,2>{0.482802629f, 0.860822201f},
-std::array<float,2>{0.818710983f, 0.140716597f},
-std::array<float,2>{0.0761717558f, 0.327139676f},
-std::array<float,2>{0.693948567f, 0.676993608f},
-std::array<float,2>{0.200334847f, 0.56849134f},
-std::array<float,2>{0.617240787f, 0.3855156f},
-std::array<float,2>{0.292055994f, 0.114935301f},
-std::array<float,2>{0.877947748f, 0.906997144f},
-std::array<float,2>{0.335525692f, 0.690704286f},
-std::array<float,2>{0.994360685f, 0.256184369f},
-std::array<float,2>{0.162609637f, 0.188236013f},
-std::array<float,2>{0.542738676f, 0.759723008f},
-std::array<float,2>{0.0270958338f, 0.963083327f},
-std::array<float,2>{0.626062393f, 0.0531637482f},
-std::array<float,2>{0.383722544f, 0.457028866f},
-std::array<float,2>{0.768223882f, 0.557710886f},
-std::array<float,2>{0.265648186f, 0.786699712f},
-std::array<float,2>{0.929551601f, 0.219997078f},
-std::array<float,2>{0.242562443f, 0.306957662f},
-std::array<float,2>{0.566439807f, 0.727426291f},
-std::array<float,2>{0.0969210491f, 0.503561914f},
-std::array<float,2>{0.746489644f, 0.486787289f},
-std::array<float,2>{0.462011755f, 0.0154094333f},
-std::array<float,2>{0.859450877f, 0.97848022f},
-std::array<float,2>{0.42420873f, 0.643490255f},
-std::array<float,2>{0.806828797f, 0.353630662f},
-std::array<float,2>{0.0314740129f, 0.18174164f},
-std::array<float,2>{0.668485522f, 0.836788535f},
-std::array<float,2>{0.136121377f, 0.885265768f},
-std::array<float,2>{0.505297303f, 0.0848017484f},
-std::array<float,2>{0.369429141f, 0.416464865f},
-std::array<float,2>{0.957009017f, 0.61072129f},
-std::array<float,2>{0.49960357f, 0.954202175f},
-std::array<float,2>{0.836166918f, 0.0590469502f},
-std::array<float,2>{0.0894151852f, 0.465230376f},
-std::array<float,2>{0.705012619f, 0.550067306f},
-std::array<float,2>{0.210080147f, 0.697746396f},
-std::array<float,2>{0.606765866f, 0.259019226f},
-std::array<float,2>{0.308683574f, 0.203010231f},
-std::array<float,2>{0.90004456f, 0.7576828f},
-std::array<float,2>{0.313986003f, 0.573533535f},
-std::array<float,2>{0.96906507f, 0.381795168f},
-std::array<float,2>{0.184862047f, 0.120962046f},
-std::array<float,2>{0.547733068f, 0.914080918f},
-std::array<float,2>{0.0136212409f, 0.868335903f},
-std::array<float,2>{0.643536985f, 0.154612437f},
-std::array<float,2>{0.405472279f, 0.319758475f},
-std::array<float,2>{0.752862811f, 0.685202718f},
-std::array<float,2>{0.344464898f, 0.935363233f},
-std::array<float,2>{0.947398901f, 0.104242258f},
-std::array<float,2>{0.151523635f, 0.395638496f},
-std::array<float,2>{0.528194785f, 0.580939889f},
-std::array<float,2>{0.0536821634f, 0.667362332f},
-std::array<float,2>{0.680253386f, 0.33000043f},
-std::array<float,2>{0.419156164f, 0.130137295f},
-std::array<float,2>{0.790481091f, 0.854323208f},
-std::array<float,2>{0.451429874f, 0.540639639f},
-std::array<float,2>{0.847660303f, 0.4420394f},
-std::array<float,2>{0.123924345f, 0.0414709598f},
-std::array<float,2>{0.734052718f, 0.943351924f},
-std::array<float,2>{0.228258759f, 0.770383418f},
-std::array<float,2>{0.578781724f, 0.213169992f},
-std::array<float,2>{0.250471592f, 0.271563888f},
-std::array<float,2>{0.920791566f, 0.713737488f},
-std::array<float,2>{0.390403062f, 0.821729064f},
-std::array<float,2>{0.772121906f, 0.169166267f},
-std::array<float,2>{0.0301908832f, 0.362750441f},
-std::array<float,2>{0.632400215f, 0.626101553f},
-std::array<float,2>{0.159481347f, 0.594691098f},
-std::array<float,2>{0.544784188f, 0.429508626f},
-std::array<float,2>{0.32897234f, 0.0646618009f},
-std::array<float,2>{0.997470021f, 0.899084032f},
-std::array<float,2>{0.296356559f, 0.740049422f},
-std::array<float,2>{0.881298125f, 0.289639413f},
-std::array<float,2>{0.196469411f, 0.244366392f},
-std::array<float,2>{0.622809947f, 0.802982748f},
-std::array<float,2>{0.0724633858f, 0.991296887f},
-std::array<float,2>{0.687758088f, 0.0289270766f},
-std::array<float,2>{0.478746921f, 0.470420331f},
-std::array<float,2>{0.815219223f, 0.518473744f},
-std::array<float,2>{0.339310586f, 0.844914496f},
-std::array<float,2>{0.987774849f, 0.139756337f},
-std::array<float,2>{0.168194264f, 0.338798732f},
-std::array<float,2>{0.538625062f, 0.661402822f},
-std::array<float,2>{0.0227917768f, 0.592708945f},
-std::array<float,2>{0.63994658f, 0.400698364f},
-std::array<float,2>{0.378096551f, 0.09565676f},
-std::array<float,2>{0.775177419f, 0.921935081f},
-std::array<float,2>{0.472768575f, 0.7050246f},
-std::array<float,2>{0.824840009f, 0.277260125f},
-std::array<float,2>{0.062889643f, 0.208511472f},
-std::array<float,2>{0.695588946f, 0.779474616f},
-std::array<float,2>{0.193613112f, 0.949422419f},
-std::array<float,2>{0.616199076f, 0.0325767063f},
-std::array<float,2>{0.282853901f, 0.447695434f},
-std::array<float,2>{0.889459968f, 0.532882154f},
-std::array<float,2>{0.407051116f, 0.891645908f},
-std::array<float,2>{0.785396874f, 0.0725211948f},
-std::array<float,2>{0.0566965118f, 0.436895281f},
-std::array<float,2>{0.678643823f, 0.603472352f},
-std::array<float,2>{0.146924779f, 0.634142935f},
-std::array<float,2>{0.520950615f, 0.372768342f},
-std::array<float,2>{0.354428262f, 0.162987277f},
-std::array<float,2>{0.944428563f, 0.818864703f},
-std::array<float,2>{0.257911026f, 0.530555904f},
-std::array<float,2>{0.913682878f, 0.482207209f},
-std::array<float,2>{0.225758657f, 0.0207855999f},
-std::array<float,2>{0.587856114f, 0.99665916f},
-std::array<float,2>{0.11679744f, 0.810913861f},
-std::array<float,2>{0.722751439f, 0.234865159f},
-std::array<float,2>{0.445132822f, 0.287801921f},
-std::array<float,2>{0.852609456f, 0.748414516f},
-std::array<float,2>{0.299558431f, 0.968940735f},
-std::array<float,2>{0.895839274f, 0.0025037704f},
-std::array<float,2>{0.215798169f, 0.498787403f},
-std::array<float,2>{0.593765259f, 0.514292538f},
-std::array<float,2>{0.0804507434f, 0.721928775f},
-std::array<float,2>{0.71396625f, 0.298734725f},
-std::array<float,2>{0.48957634f, 0.229196131f},
-std::array<float,2>{0.833396494f, 0.794374406f},
-std::array<float,2>{0.395714819f, 0.622320056f},
-std::array<float,2>{0.762665451f, 0.412491858f},
-std::array<float,2>{0.00183916895f, 0.0864360183f},
-std::array<float,2>{0.650306165f, 0.879506588f},
-std::array<float,2>{0.17721799f, 0.830034256f},
-std::array<float,2>{0.561431825f, 0.176107094f},
-std::array<float,2>{0.322087586f, 0.348890483f},
-std::array<float,2>{0.983230829f, 0.650960267f},
-std::array<float,2>{0.456089377f, 0.764314771f},
-std::array<float,2>{0.868307769f, 0.191593751f},
-std::array<float,2>{0.108375154f, 0.250047892f},
-std::array<float,2>{0.739858568f, 0.692985535f},
-std::array<float,2>{0.2414148f, 0.559054315f},
-std::array<float,2>{0.57294178f, 0.459385693f},
-std::array<float,2>{0.280542433f, 0.0476447195f},
-std::array<float,2>{0.93502146f, 0.967070878f},
-std::array<float,2>{0.366099775f, 0.674596667f},
-std::array<float,2>{0.964570761f, 0.321481019f},
-std::array<float,2>{0.128348634f, 0.148117661f},
-std::array<float,2>{0.510273993f, 0.865435362f},
-std::array<float,2>{0.0419474989f, 0.912210643f},
-std::array<float,2>{0.6620363f, 0.110164978f},
-std::array<float,2>{0.437154055f, 0.390509337f},
-std::array<float,2>{0.801988363f, 0.564042866f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.279651672f, 0.881902575f},
-std::array<float,2>{0.870847523f, 0.296908408f},
-std::array<float,2>{0.220586732f, 0.177182019f},
-std::array<float,2>{0.637725234f, 0.669601858f},
-std::array<float,2>{0.025372494f, 0.58697015f},
-std::array<float,2>{0.555627048f, 0.00182631006f},
-std::array<float,2>{0.391549945f, 0.453962356f},
-std::array<float,2>{0.931785941f, 0.823175728f},
-std::array<float,2>{0.469036371f, 0.721061468f},
-std::array<float,2>{0.974832058f, 0.192379206f},
-std::array<float,2>{0.0884422511f, 0.366451621f},
-std::array<float,2>{0.620544791f, 0.994998693f},
-std::array<float,2>{0.176786751f, 0.806243837f},
-std::array<float,2>{0.725883007f, 0.376016408f},
-std::array<float,2>{0.327685803f, 0.0806603581f},
-std::array<float,2>{0.768138051f, 0.518511176f},
-std::array<float,2>{0.433294743f, 0.851866484f},
-std::array<float,2>{0.903604686f, 0.47043702f},
-std::array<float,2>{0.0454215854f, 0.0366096683f},
-std::array<float,2>{0.52526772f, 0.600803554f},
-std::array<float,2>{0.207088947f, 0.647057354f},
-std::array<float,2>{0.66132164f, 0.143530697f},
-std::array<float,2>{0.306162864f, 0.270828992f},
-std::array<float,2>{0.841528475f, 0.923991024f},
-std::array<float,2>{0.361381054f, 0.547782779f},
-std::array<float,2>{0.797170997f, 0.0943761989f},
-std::array<float,2>{0.152113095f, 0.429731786f},
-std::array<float,2>{0.68916589f, 0.772833943f},
-std::array<float,2>{0.102630712f, 0.959930837f},
-std::array<float,2>{0.563841701f, 0.342041731f},
-std::array<float,2>{0.442634046f, 0.22382848f},
-std::array<float,2>{0.939430535f, 0.696988165f},
-std::array<float,2>{0.458550662f, 0.976810157f},
-std::array<float,2>{0.962669849f, 0.356597543f},
-std::array<float,2>{0.118899614f, 0.206167012f},
-std::array<float,2>{0.580886781f, 0.747433603f},
-std::array<float,2>{0.128157735f, 0.50769347f},
-std::array<float,2>{0.709593952f, 0.0660991371f},
-std::array<float,2>{0.357503831f, 0.404674381f},
-std::array<float,2>{0.782305539f, 0.792752743f},
-std::array<float,2>{0.291172296f, 0.686209023f},
-std::array<float,2>{0.814440131f, 0.169266135f},
-std::array<float,2>{0.200500742f, 0.283323586f},
-std::array<float,2>{0.678875208f, 0.900114059f},
-std::array<float,2>{0.0508999862f, 0.836850822f},
-std::array<float,2>{0.503718436f, 0.447792023f},
-std::array<float,2>{0.414296955f, 0.0168520883f},
-std::array<float,2>{0.889152348f, 0.5687536f},
-std::array<float,2>{0.329698592f, 0.756888211f},
-std::array<float,2>{0.763658106f, 0.419394433f},
-std::array<float,2>{0.15669407f, 0.113867462f},
-std::array<float,2>{0.745930135f, 0.5406726f},
-std::array<float,2>{0.0669098347f, 0.714624584f},
-std::array<float,2>{0.600129783f, 0.248441055f},
-std::array<float,2>{0.496713161f, 0.314536661f},
-std::array<float,2>{0.995545328f, 0.949914992f},
-std::array<float,2>{0.387754202f, 0.609921694f},
-std::array<float,2>{0.917676687f, 0.0577065125f},
-std::array<float,2>{0.0133178588f, 0.489469737f},
-std::array<float,2>{0.544233382f, 0.861382544f},
-std::array<float,2>{0.245897502f, 0.908439875f},
-std::array<float,2>{0.644793153f, 0.259257376f},
-std::array<float,2>{0.265322775f, 0.131156102f},
-std::array<float,2>{0.856105804f, 0.634839654f},
-std::array<float,2>{0.349851876f, 0.944985509f},
-std::array<float,2>{0.793577909f, 0.323088169f},
-std::array<float,2>{0.136166722f, 0.2372628f},
-std::array<float,2>{0.711354733f, 0.708202302f},
-std::array<float,2>{0.11313431f, 0.536587536f},
-std::array<float,2>{0.586832881f, 0.122136317f},
-std::array<float,2>{0.466332287f, 0.409378588f},
-std::array<float,2>{0.956395745f, 0.758754849f},
-std::array<float,2>{0.413623065f, 0.626774907f},
-std::array<float,2>{0.880091667f, 0.136847869f},
-std::array<float,2>{0.0586838461f, 0.252439409f},
-std::array<float,2>{0.511022925f, 0.914917529f},
-std::array<float,2>{0.18939963f, 0.871921062f},
-std::array<float,2>{0.685159862f, 0.497683257f},
-std::array<float,2>{0.283088505f, 0.0515152104f},
-std::array<float,2>{0.827050686f, 0.622843802f},
-std::array<float,2>{0.491113424f, 0.787048995f},
-std::array<float,2>{0.98595196f, 0.398142666f},
-std::array<float,2>{0.0761419311f, 0.0731139407f},
-std::array<float,2>{0.603845537f, 0.512313902f},
-std::array<float,2>{0.164638922f, 0.738394141f},
-std::array<float,2>{0.739466846f, 0.21601896f},
-std::array<float,2>{0.342036873f, 0.345443159f},
-std::array<float,2>{0.752949178f, 0.976369083f},
-std::array<float,2>{0.257464677f, 0.570950806f},
-std::array<float,2>{0.850678205f, 0.0272202156f},
-std::array<float,2>{0.237969056f, 0.443994194f},
-std::array<float,2>{0.656007648f, 0.834067523f},
-std::array<float,2>{0.00071113446f, 0.894322991f},
-std::array<float,2>{0.532300651f, 0.291585535f},
-std::array<float,2>{0.380345225f, 0.159276992f},
-std::array<float,2>{0.906884849f, 0.67347461f},
-std::array<float,2>{0.402977228f, 0.931696773f},
-std::array<float,2>{0.925969362f, 0.28008303f},
-std::array<float,2>{0.0203375332f, 0.155731991f},
-std::array<float,2>{0.551817179f, 0.653021812f},
-std::array<float,2>{0.226642385f, 0.60681349f},
-std::array<float,2>{0.625153244f, 0.0427951179f},
-std::array<float,2>{0.272111893f, 0.476679415f},
-std::array<float,2>{0.860246897f, 0.851284564f},
-std::array<float,2>{0.319167435f, 0.693770468f},
-std::array<float,2>{0.774051726f, 0.234350577f},
-std::array<float,2>{0.181276634f, 0.329338759f},
-std::array<float,2>{0.727219403f, 0.968460977f},
-std::array<float,2>{0.0845454112f, 0.780851364f},
-std::array<float,2>{0.612432003f, 0.422970206f},
-std::array<float,2>{0.480437964f, 0.10583248f},
-std::array<float,2>{0.977407157f, 0.554968715f},
-std::array<float,2>{0.298342675f, 0.816798091f},
-std::array<float,2>{0.83014816f, 0.467429101f},
-std::array<float,2>{0.214782566f, 0.0101022469f},
-std::array<float,2>{0.668041229f, 0.580729127f},
-std::array<float,2>{0.0342971869f, 0.660353422f},
-std::array<float,2>{0.518290758f, 0.186887965f},
-std::array<float,2>{0.428563923f, 0.311417192f},
-std::array<float,2>{0.89640826f, 0.883217692f},
-std::array<float,2>{0.446328461f, 0.530786335f},
-std::array<float,2>{0.951535642f, 0.0887754858f},
-std::array<float,2>{0.0960377231f, 0.383377314f},
-std::array<float,2>{0.574474633f, 0.797914505f},
-std::array<float,2>{0.141183853f, 0.984815896f},
-std::array<float,2>{0.698346496f, 0.37442559f},
-std::array<float,2>{0.370344937f, 0.197915956f},
-std::array<float,2>{0.809452057f, 0.732578218f},
-std::array<float,2>{0.323014855f, 0.91970557f},
-std::array<float,2>{0.773024738f, 0.257605731f},
-std::array<float,2>{0.173748761f, 0.133713648f},
-std::array<float,2>{0.718982875f, 0.632414341f},
-std::array<float,2>{0.0898532048f, 0.617728472f},
-std::array<float,2>{0.62197423f, 0.0481400564f},
-std::array<float,2>{0.473031819f, 0.495249003f},
-std::array<float,2>{0.972527623f, 0.870046556f},
-std::array<float,2>{0.395475745f, 0.703290105f},
-std::array<float,2>{0.934544802f, 0.239332706f},
-std::array<float,2>{0.0300904587f, 0.324974865f},
-std::array<float,2>{0.559054136f, 0.940015256f},
-std::array<float,2>{0.222849652f, 0.763811767f},
-std::array<float,2>{0.634331882f, 0.413315088f},
-std::array<float,2>{0.276976049f, 0.11762464f},
-std::array<float,2>{0.871151388f, 0.531956792f},
-std::array<float,2>{0.438547432f, 0.830563605f},
-std::array<float,2>{0.942569673f, 0.439220995f},
-std::array<float,2>{0.106904276f, 0.0305781588f},
-std::array<float,2>{0.569093645f, 0.577370167f},
-std::array<float,2>{0.152923465f, 0.676917732f},
-std::array<float,2>{0.695271015f, 0.163938597f},
-std::array<float,2>{0.365810901f, 0.29662171f},
-std::array<float,2>{0.803241014f, 0.897815764f},
-std::array<float,2>{0.311065942f, 0.508804977f},
-std::array<float,2>{0.83687669f, 0.0753257796f},
-std::array<float,2>{0.205229789f, 0.392935753f},
-std::array<float,2>{0.659884155f, 0.783396363f},
-std::array<float,2>{0.0402643271f, 0.971810102f},
-std::array<float,2>{0.527521372f, 0.350875705f},
-std::array<float,2>{0.436427593f, 0.214825079f},
-std::array<float,2>{0.899523973f, 0.736188829f},
-std::array<float,2>{0.421197772f, 0.962655306f},
-std::array<float,2>{0.885676324f, 0.335778683f},
-std::array<float,2>{0.0475526974f, 0.229694009f},
-std::array<float,2>{0.507132411f, 0.69042033f},
-std::array<float,2>{0.196531191f, 0.56116575f},
-std::array<float,2>{0.674336612f, 0.104978912f},
-std::array<float,2>{0.296780229f, 0.426087588f},
-std::array<float,2>{0.820291221f, 0.775050581f},
-std::array<float,2>{0.35268417f, 0.650417089f},
-std::array<float,2>{0.786370158f, 0.150698856f},
-std::array<float,2>{0.131078929f, 0.27576977f},
-std::array<float,2>{0.703289092f, 0.934417546f},
-std::array<float,2>{0.121603228f, 0.845558465f},
-std::array<float,2>{0.584306359f, 0.481812805f},
-std::array<float,2>{0.455534637f, 0.0455567427f},
-std::array<float,2>{0.967808247f, 0.603124499f},
-std::array<float,2>{0.260033548f, 0.803115845f},
-std::array<float,2>{0.855320036f, 0.38762483f},
-std::array<float,2>{0.246534348f, 0.0898807496f},
-std::array<float,2>{0.640724957f, 0.525920749f},
-std::array<float,2>{0.0092887152f, 0.727052748f},
-std::array<float,2>{0.541091561f, 0.200096056f},
-std::array<float,2>{0.385602176f, 0.369280428f},
-std::array<float,2>{0.918281794f, 0.990905583f},
-std::array<float,2>{0.494551361f, 0.582217336f},
-std::array<float,2>{0.997874081f, 0.0144144613f},
-std::array<float,2>{0.0641751215f, 0.461152822f},
-std::array<float,2>{0.597276807f, 0.81494987f},
-std::array<float,2>{0.16276741f, 0.888298631f},
-std::array<float,2>{0.747396529f, 0.308361053f},
-std::array<float,2>{0.33465144f, 0.183317199f},
-std::array<float,2>{0.759714782f, 0.659932494f},
-std::array<float,2>{0.286584169f, 0.999406278f},
-std::array<float,2>{0.821197271f, 0.362999111f},
-std::array<float,2>{0.193403646f, 0.190029383f},
-std::array<float,2>{0.680143416f, 0.723155856f},
-std::array<float,2>{0.0565542392f, 0.521550834f},
-std::array<float,2>{0.51276499f, 0.083030358f},
-std::array<float,2>{0.409977943f, 0.382613391f},
-std::array<float,2>{0.877887607f, 0.811186075f},
-std::array<float,2>{0.460987419f, 0.66783005f},
-std::array<float,2>{0.958306015f, 0.172709063f},
-std::array<float,2>{0.1140287f, 0.301042885f},
-std::array<float,2>{0.592613459f, 0.877712488f},
-std::array<float,2>{0.1401705f, 0.825274289f},
-std::array<float,2>{0.716365039f, 0.457063466f},
-std::array<float,2>{0.346311152f, 0.00532699376f},
-std::array<float,2>{0.792831659f, 0.591626883f},
-std::array<float,2>{0.375778943f, 0.769235432f},
-std::array<float,2>{0.911202252f, 0.436403185f},
-std::array<float,2>{0.00602408731f, 0.0992259607f},
-std::array<float,2>{0.537267685f, 0.551690876f},
-std::array<float,2>{0.238968417f, 0.702343941f},
-std::array<float,2>{0.649720013f, 0.220244184f},
-std::array<float,2>{0.252175033f, 0.336997211f},
-std::array<float,2>{0.847434461f, 0.954058409f},
-std::array<float,2>{0.336653233f, 0.596391916f},
-std::array<float,2>{0.75611043f, 0.0341525972f},
-std::array<float,2>{0.170980185f, 0.474049151f},
-std::array<float,2>{0.735570073f, 0.85936588f},
-std::array<float,2>{0.071461007f, 0.92952621f},
-std::array<float,2>{0.607943952f, 0.268965662f},
-std::array<float,2>{0.484946012f, 0.145626262f},
-std::array<float,2>{0.989186883f, 0.642594635f},
-std::array<float,2>{0.481158614f, 0.905466616f},
-std::array<float,2>{0.983528495f, 0.286973864f},
-std::array<float,2>{0.0794690028f, 0.167852804f},
-std::array<float,2>{0.61593008f, 0.680154979f},
-std::array<float,2>{0.186604455f, 0.563074052f},
-std::array<float,2>{0.733080268f, 0.0226962268f},
-std::array<float,2>{0.312529415f, 0.451943994f},
-std::array<float,2>{0.780375898f, 0.841534615f},
-std::array<float,2>{0.2680327f, 0.744790494f},
-std::array<float,2>{0.866045535f, 0.210563689f},
-std::array<float,2>{0.233126879f, 0.354881346f},
-std::array<float,2>{0.629640877f, 0.982471645f},
-std::array<float,2>{0.0195091944f, 0.793501914f},
-std::array<float,2>{0.54911989f, 0.400005192f},
-std::array<float,2>{0.398734778f, 0.068495959f},
-std::array<float,2>{0.922384262f, 0.502845705f},
-std::array<float,2>{0.374105126f, 0.866430163f},
-std::array<float,2>{0.805024981f, 0.488068372f},
-std::array<float,2>{0.146801427f, 0.0597911961f},
-std::array<float,2>{0.701561689f, 0.613644898f},
-std::array<float,2>{0.0995499566f, 0.637481034f},
-std::array<float,2>{0.572815239f, 0.126441896f},
-std::array<float,2>{0.45188266f, 0.262455672f},
-std::array<float,2>{0.947178423f, 0.911660671f},
-std::array<float,2>{0.423439682f, 0.545181811f},
-std::array<float,2>{0.891966939f, 0.111996055f},
-std::array<float,2>{0.0356080048f, 0.415896535f},
-std::array<float,2>{0.520103753f, 0.751565695f},
-std::array<float,2>{0.218056768f, 0.949006438f},
-std::array<float,2>{0.667636037f, 0.31722042f},
-std::array<float,2>{0.30341652f, 0.242687643f},
-std::array<float,2>{0.832710147f, 0.715321898f},
-std::array<float,2>{0.307265013f, 0.923442602f},
-std::array<float,2>{0.841943324f, 0.271906763f},
-std::array<float,2>{0.210519299f, 0.140888393f},
-std::array<float,2>{0.662892222f, 0.645286977f},
-std::array<float,2>{0.0436440967f, 0.598882318f},
-std::array<float,2>{0.525643051f, 0.0375913568f},
-std::array<float,2>{0.431450397f, 0.472216666f},
-std::array<float,2>{0.906241238f, 0.853787303f},
-std::array<float,2>{0.443966031f, 0.697576582f},
-std::array<float,2>{0.94127655f, 0.224813744f},
-std::array<float,2>{0.105040327f, 0.340214312f},
-std::array<float,2>{0.564893603f, 0.957855225f},
-std::array<float,2>{0.148894161f, 0.770691693f},
-std::array<float,2>{0.690476954f, 0.432467908f},
-std::array<float,2>{0.360248566f, 0.0965612829f},
-std::array<float,2>{0.799184024f, 0.549724519f},
-std::array<float,2>{0.392687172f, 0.820639491f},
-std::array<float,2>{0.929755867f, 0.455520749f},
-std::array<float,2>{0.0261081364f, 0.00377841317f},
-std::array<float,2>{0.556827188f, 0.588264525f},
-std::array<float,2>{0.222436398f, 0.671651423f},
-std::array<float,2>{0.640039861f, 0.178643957f},
-std::array<float,2>{0.277508587f, 0.298947334f},
-std::array<float,2>{0.869062304f, 0.880166233f},
-std::array<float,2>{0.325472087f, 0.517373741f},
-std::array<float,2>{0.767510891f, 0.0792795345f},
-std::array<float,2>{0.17935054f, 0.3780801f},
-std::array<float,2>{0.723082364f, 0.808084249f},
-std::array<float,2>{0.0860100389f, 0.992612481f},
-std::array<float,2>{0.619063795f, 0.363312125f},
-std::array<float,2>{0.472004443f, 0.193563759f},
-std::array<float,2>{0.972983718f, 0.719177008f},
-std::array<float,2>{0.499106109f, 0.952715516f},
-std::array<float,2>{0.994002044f, 0.312520325f},
-std::array<float,2>{0.0686965585f, 0.246894047f},
-std::array<float,2>{0.598184109f, 0.710947514f},
-std::array<float,2>{0.158681512f, 0.542814255f},
-std::array<float,2>{0.743254006f, 0.115910515f},
-std::array<float,2>{0.33199358f, 0.419945657f},
-std::array<float,2>{0.763917387f, 0.753951252f},
-std::array<float,2>{0.263483107f, 0.63408339f},
-std::array<float,2>{0.85794574f, 0.129846379f},
-std::array<float,2>{0.243082881f, 0.259955853f},
-std::array<float,2>{0.64702642f, 0.907796919f},
-std::array<float,2>{0.0151723018f, 0.861286104f},
-std::array<float,2>{0.546277821f, 0.490717232f},
-std::array<float,2>{0.390149742f, 0.0547658615f},
-std::array<float,2>{0.91488415f, 0.612348258f},
-std::array<float,2>{0.356583953f, 0.789148569f},
-std::array<float,2>{0.78427273f, 0.402470648f},
-std::array<float,2>{0.126867846f, 0.0628812239f},
-std::array<float,2>{0.708188474f, 0.505730569f},
-std::array<float,2>{0.119337209f, 0.748783231f},
-std::array<float,2>{0.578958392f, 0.203294992f},
-std::array<float,2>{0.459415108f, 0.35773623f},
-std::array<float,2>{0.963297665f, 0.979824424f},
-std::array<float,2>{0.416469276f, 0.56786412f},
-std::array<float,2>{0.888028979f, 0.0186796989f},
-std::array<float,2>{0.0533738248f, 0.445686013f},
-std::array<float,2>{0.501654863f, 0.839400709f},
-std::array<float,2>{0.20150435f, 0.901445866f},
-std::array<float,2>{0.676982224f, 0.282360822f},
-std::array<float,2>{0.290910095f, 0.170654461f},
-std::array<float,2>{0.815154791f, 0.684660256f},
-std::array<float,2>{0.341015339f, 0.974262893f},
-std::array<float,2>{0.751096547f, 0.347606301f},
-std::array<float,2>{0.167681709f, 0.217751175f},
-std::array<float,2>{0.740955532f, 0.740591884f},
-std::array<float,2>{0.0767199621f, 0.514407098f},
-std::array<float,2>{0.602186203f, 0.0714735761f},
-std::array<float,2>{0.4885436f, 0.396275073f},
-std::array<float,2>{0.987294018f, 0.788252473f},
-std::array<float,2>{0.382796168f, 0.67504108f},
-std::array<float,2>{0.90988028f, 0.158054247f},
-std::array<float,2>{0.0039037175f, 0.290555239f},
-std::array<float,2>{0.5332582f, 0.891865253f},
-std::array<float,2>{0.235958919f, 0.832427382f},
-std::array<float,2>{0.653667271f, 0.441788971f},
-std::array<float,2>{0.254054964f, 0.0249770451f},
-std::array<float,2>{0.847719967f, 0.574214101f},
-std::array<float,2>{0.467995644f, 0.760219991f},
-std::array<float,2>{0.953320026f, 0.407809168f},
-std::array<float,2>{0.111035034f, 0.123343311f},
-std::array<float,2>{0.589452803f, 0.538466215f},
-std::array<float,2>{0.134395033f, 0.709301591f},
-std::array<float,2>{0.714265287f, 0.235391781f},
-std::array<float,2>{0.347691298f, 0.320762157f},
-std::array<float,2>{0.796778083f, 0.941732287f},
-std::array<float,2>{0.285152763f, 0.623079002f},
-std::array<float,2>{0.825507164f, 0.0544705018f},
-std::array<float,2>{0.191017985f, 0.499841452f},
-std::array<float,2>{0.687368035f, 0.87485975f},
-std::array<float,2>{0.0605681017f, 0.916120708f},
-std::array<float,2>{0.508886099f, 0.25002417f},
-std::array<float,2>{0.412079483f, 0.139038488f},
-std::array<float,2>{0.882611632f, 0.626954854f},
-std::array<float,2>{0.425904363f, 0.886711419f},
-std::array<float,2>{0.89778024f, 0.30862686f},
-std::array<float,2>{0.031852819f, 0.18526797f},
-std::array<float,2>{0.517234206f, 0.662460864f},
-std::array<float,2>{0.212280482f, 0.578909814f},
-std::array<float,2>{0.671476364f, 0.00929699186f},
-std::array<float,2>{0.299900055f, 0.465085506f},
-std::array<float,2>{0.830021679f, 0.819582939f},
-std::array<float,2>{0.367692262f, 0.731370151f},
-std::array<float,2>{0.81176424f, 0.196741551f},
-std::array<float,2>{0.142734453f, 0.372037113f},
-std::array<float,2>{0.697008848f, 0.987920702f},
-std::array<float,2>{0.093871817f, 0.799702764f},
-std::array<float,2>{0.577331305f, 0.385374814f},
-std::array<float,2>{0.44859761f, 0.0867328122f},
-std::array<float,2>{0.950135112f, 0.527359009f},
-std::array<float,2>{0.271054626f, 0.849446535f},
-std::array<float,2>{0.862375855f, 0.479954511f},
-std::array<float,2>{0.229039088f, 0.039064195f},
-std::array<float,2>{0.627105176f, 0.609094501f},
-std::array<float,2>{0.0223756004f, 0.65606308f},
-std::array<float,2>{0.554016232f, 0.154210314f},
-std::array<float,2>{0.405407369f, 0.279075176f},
-std::array<float,2>{0.929085255f, 0.931420028f},
-std::array<float,2>{0.477861136f, 0.557739377f},
-std::array<float,2>{0.979245842f, 0.108041823f},
-std::array<float,2>{0.0824733078f, 0.425744891f},
-std::array<float,2>{0.609640241f, 0.778086185f},
-std::array<float,2>{0.181773677f, 0.965871036f},
-std::array<float,2>{0.729124606f, 0.330992699f},
-std::array<float,2>{0.317727536f, 0.230543792f},
-std::array<float,2>{0.776162207f, 0.692419469f},
-std::array<float,2>{0.365123421f, 0.895265102f},
-std::array<float,2>{0.802408695f, 0.293482691f},
-std::array<float,2>{0.156119913f, 0.161941305f},
-std::array<float,2>{0.692650676f, 0.678205729f},
-std::array<float,2>{0.108667694f, 0.575431585f},
-std::array<float,2>{0.566499293f, 0.0285727922f},
-std::array<float,2>{0.440904647f, 0.440780103f},
-std::array<float,2>{0.943494022f, 0.829255521f},
-std::array<float,2>{0.433756769f, 0.737757564f},
-std::array<float,2>{0.902258396f, 0.2115383f},
-std::array<float,2>{0.0416439027f, 0.347858101f},
-std::array<float,2>{0.53002584f, 0.970303297f},
-std::array<float,2>{0.204096302f, 0.781916916f},
-std::array<float,2>{0.656408131f, 0.391450673f},
-std::array<float,2>{0.310286313f, 0.0776506513f},
-std::array<float,2>{0.83819592f, 0.510151148f},
-std::array<float,2>{0.475835025f, 0.867342293f},
-std::array<float,2>{0.9705984f, 0.492399544f},
-std::array<float,2>{0.0923027545f, 0.0504793152f},
-std::array<float,2>{0.624459088f, 0.620039761f},
-std::array<float,2>{0.174779564f, 0.630792677f},
-std::array<float,2>{0.72187227f, 0.135944366f},
-std::array<float,2>{0.320618987f, 0.25450477f},
-std::array<float,2>{0.769787431f, 0.920952559f},
-std::array<float,2>{0.274584383f, 0.533795714f},
-std::array<float,2>{0.873071909f, 0.120968074f},
-std::array<float,2>{0.226445034f, 0.411206961f},
-std::array<float,2>{0.63538605f, 0.762989223f},
-std::array<float,2>{0.0290027466f, 0.937841058f},
-std::array<float,2>{0.561201096f, 0.327652305f},
-std::array<float,2>{0.397335798f, 0.241695881f},
-std::array<float,2>{0.937303662f, 0.705257893f},
-std::array<float,2>{0.383067161f, 0.98909694f},
-std::array<float,2>{0.920470059f, 0.368799925f},
-std::array<float,2>{0.0100119114f, 0.202018633f},
-std::array<float,2>{0.539931536f, 0.728672981f},
-std::array<float,2>{0.248433262f, 0.524618387f},
-std::array<float,2>{0.643844485f, 0.0925408155f},
-std::array<float,2>{0.259506792f, 0.389508396f},
-std::array<float,2>{0.852162302f, 0.801073253f},
-std::array<float,2>{0.333420217f, 0.657335877f},
-std::array<float,2>{0.761416614f, 0.180494696f},
-std::array<float,2>{0.160390213f, 0.305245519f},
-std::array<float,2>{0.749760687f, 0.889112294f},
-std::array<float,2>{0.0662916005f, 0.812897921f},
-std::array<float,2>{0.593773603f, 0.46406889f},
-std::array<float,2>{0.493960768f, 0.0122641884f},
-std::array<float,2>{0.999785602f, 0.584837794f},
-std::array<float,2>{0.292998731f, 0.775659144f},
-std::array<float,2>{0.817352831f, 0.428409398f},
-std::array<float,2>{0.197895408f, 0.10336569f},
-std::array<float,2>{0.672850907f, 0.559276879f},
-std::array<float,2>{0.0505492054f, 0.689192891f},
-std::array<float,2>{0.504684925f, 0.228513479f},
-std::array<float,2>{0.419649184f, 0.333290249f},
-std::array<float,2>{0.884615481f, 0.96416223f},
-std::array<float,2>{0.453707308f, 0.603839755f},
-std::array<float,2>{0.965121448f, 0.0441379398f},
-std::array<float,2>{0.124156624f, 0.48269701f},
-std::array<float,2>{0.583775878f, 0.846134305f},
-std::array<float,2>{0.130080402f, 0.936820626f},
-std::array<float,2>{0.706713259f, 0.274313986f},
-std::array<float,2>{0.355130106f, 0.14895156f},
-std::array<float,2>{0.787662446f, 0.650011241f},
-std::array<float,2>{0.250195444f, 0.956014335f},
-std::array<float,2>{0.843874097f, 0.339268982f},
-std::array<float,2>{0.241472915f, 0.221562311f},
-std::array<float,2>{0.651233137f, 0.699325562f},
-std::array<float,2>{0.00485483557f, 0.553224564f},
-std::array<float,2>{0.536336124f, 0.101456888f},
-std::array<float,2>{0.377504706f, 0.433928728f},
-std::array<float,2>{0.912553787f, 0.765756249f},
-std::array<float,2>{0.486978918f, 0.642271101f},
-std::array<float,2>{0.990552664f, 0.148068517f},
-std::array<float,2>{0.0726727322f, 0.266169518f},
-std::array<float,2>{0.605943561f, 0.926639438f},
-std::array<float,2>{0.168910891f, 0.857007325f},
-std::array<float,2>{0.738065362f, 0.475494117f},
-std::array<float,2>{0.338808864f, 0.0325819589f},
-std::array<float,2>{0.753930449f, 0.594366193f},
-std::array<float,2>{0.407616168f, 0.810477734f},
-std::array<float,2>{0.876341999f, 0.380324185f},
-std::array<float,2>{0.0581625402f, 0.0853091031f},
-std::array<float,2>{0.514480889f, 0.520081043f},
-std::array<float,2>{0.191538528f, 0.725296259f},
-std::array<float,2>{0.682172358f, 0.189152718f},
-std::array<float,2>{0.287293971f, 0.360503703f},
-std::array<float,2>{0.82369113f, 0.996127784f},
-std::array<float,2>{0.345403552f, 0.593255877f},
-std::array<float,2>{0.790060282f, 0.00615243567f},
-std::array<float,2>{0.137735412f, 0.45933497f},
-std::array<float,2>{0.716988444f, 0.827245235f},
-std::array<float,2>{0.117186964f, 0.875354052f},
-std::array<float,2>{0.590306342f, 0.304258972f},
-std::array<float,2>{0.46344474f, 0.173943385f},
-std::array<float,2>{0.960428059f, 0.664799988f},
-std::array<float,2>{0.450824887f, 0.913833618f},
-std::array<float,2>{0.9483428f, 0.264232069f},
-std::array<float,2>{0.100227058f, 0.128340662f},
-std::array<float,2>{0.571774721f, 0.638777018f},
-std::array<float,2>{0.145541355f, 0.616419077f},
-std::array<float,2>{0.699295402f, 0.0611310378f},
-std::array<float,2>{0.372596532f, 0.485199958f},
-std::array<float,2>{0.808279574f, 0.864899337f},
-std::array<float,2>{0.301980287f, 0.717512131f},
-std::array<float,2>{0.834447086f, 0.245513499f},
-std::array<float,2>{0.215752512f, 0.319406599f},
-std::array<float,2>{0.665878952f, 0.945382357f},
-std::array<float,2>{0.0382271111f, 0.752764523f},
-std::array<float,2>{0.523061454f, 0.416677535f},
-std::array<float,2>{0.425638229f, 0.110877819f},
-std::array<float,2>{0.893586516f, 0.544162989f},
-std::array<float,2>{0.316175997f, 0.842764676f},
-std::array<float,2>{0.779027939f, 0.450517356f},
-std::array<float,2>{0.184204146f, 0.0202485565f},
-std::array<float,2>{0.73152101f, 0.565621853f},
-std::array<float,2>{0.081560418f, 0.681808293f},
-std::array<float,2>{0.614901125f, 0.164213419f},
-std::array<float,2>{0.483825177f, 0.287714779f},
-std::array<float,2>{0.982157648f, 0.903399587f},
-std::array<float,2>{0.402341455f, 0.501306534f},
-std::array<float,2>{0.924187243f, 0.0677500367f},
-std::array<float,2>{0.0169531181f, 0.402174443f},
-std::array<float,2>{0.548027396f, 0.79553616f},
-std::array<float,2>{0.230548576f, 0.981557727f},
-std::array<float,2>{0.630921245f, 0.353120834f},
-std::array<float,2>{0.266372293f, 0.207378551f},
-std::array<float,2>{0.864391983f, 0.74389571f},
-std::array<float,2>{0.264550358f, 0.907089591f},
-std::array<float,2>{0.856567204f, 0.261107683f},
-std::array<float,2>{0.244998962f, 0.13044332f},
-std::array<float,2>{0.645899117f, 0.633412898f},
-std::array<float,2>{0.0125061721f, 0.611352205f},
-std::array<float,2>{0.543183446f, 0.0558028221f},
-std::array<float,2>{0.386984676f, 0.491623402f},
-std::array<float,2>{0.916792393f, 0.859552979f},
-std::array<float,2>{0.497784376f, 0.712703526f},
-std::array<float,2>{0.994929731f, 0.247085974f},
-std::array<float,2>{0.0679525137f, 0.313842148f},
-std::array<float,2>{0.600953937f, 0.951691747f},
-std::array<float,2>{0.157430738f, 0.755789816f},
-std::array<float,2>{0.744677424f, 0.421796709f},
-std::array<float,2>{0.328818679f, 0.116496243f},
-std::array<float,2>{0.761963546f, 0.541609228f},
-std::array<float,2>{0.415488303f, 0.838706255f},
-std::array<float,2>{0.890055418f, 0.446889341f},
-std::array<float,2>{0.0519630425f, 0.0180294476f},
-std::array<float,2>{0.502591431f, 0.56679666f},
-std::array<float,2>{0.199880734f, 0.683681905f},
-std::array<float,2>{0.678000987f, 0.171851665f},
-std::array<float,2>{0.292905539f, 0.28195104f},
-std::array<float,2>{0.813258469f, 0.900622249f},
-std::array<float,2>{0.358496815f, 0.504472256f},
-std::array<float,2>{0.781255782f, 0.0643725172f},
-std::array<float,2>{0.127910718f, 0.404103607f},
-std::array<float,2>{0.710205257f, 0.790721416f},
-std::array<float,2>{0.117652744f, 0.979286671f},
-std::array<float,2>{0.581308365f, 0.359269768f},
-std::array<float,2>{0.457540095f, 0.204184845f},
-std::array<float,2>{0.961311817f, 0.749401927f},
-std::array<float,2>{0.441484004f, 0.958306849f},
-std::array<float,2>{0.937821627f, 0.34111321f},
-std::array<float,2>{0.101796255f, 0.226531759f},
-std::array<float,2>{0.563221812f, 0.69901073f},
-std::array<float,2>{0.151015252f, 0.550683856f},
-std::array<float,2>{0.687873662f, 0.0973322242f},
-std::array<float,2>{0.362821013f, 0.433216512f},
-std::array<float,2>{0.798472524f, 0.770391941f},
-std::array<float,2>{0.304716378f, 0.645874143f},
-std::array<float,2>{0.839890897f, 0.141982451f},
-std::array<float,2>{0.208014548f, 0.273248196f},
-std::array<float,2>{0.660637021f, 0.922794402f},
-std::array<float,2>{0.0463960692f, 0.855320275f},
-std::array<float,2>{0.524102628f, 0.471245438f},
-std::array<float,2>{0.432025522f, 0.0383783877f},
-std::array<float,2>{0.90258646f, 0.598342299f},
-std::array<float,2>{0.326248795f, 0.807190478f},
-std::array<float,2>{0.769056618f, 0.377569139f},
-std::array<float,2>{0.176741377f, 0.078370437f},
-std::array<float,2>{0.724701166f, 0.515919864f},
-std::array<float,2>{0.0897398591f, 0.719921887f},
-std::array<float,2>{0.620053649f, 0.194354028f},
-std::array<float,2>{0.470495492f, 0.364967674f},
-std::array<float,2>{0.975790262f, 0.993585885f},
-std::array<float,2>{0.391953766f, 0.589594066f},
-std::array<float,2>{0.933054507f, 0.00277111423f},
-std::array<float,2>{0.0242006257f, 0.456164479f},
-std::array<float,2>{0.555719435f, 0.821842372f},
-std::array<float,2>{0.21933198f, 0.879576445f},
-std::array<float,2>{0.637384892f, 0.2998299f},
-std::array<float,2>{0.281231314f, 0.179279223f},
-std::array<float,2>{0.869754195f, 0.670575261f},
-std::array<float,2>{0.369487166f, 0.986561596f},
-std::array<float,2>{0.810452819f, 0.372949749f},
-std::array<float,2>{0.141959891f, 0.195485681f},
-std::array<float,2>{0.698067963f, 0.732358158f},
-std::array<float,2>{0.0973179489f, 0.528369308f},
-std::array<float,2>{0.575488567f, 0.0874541104f},
-std::array<float,2>{0.445705324f, 0.386248976f},
-std::array<float,2>{0.952815473f, 0.800519049f},
-std::array<float,2>{0.42950511f, 0.663325787f},
-std::array<float,2>{0.895374894f, 0.184530929f},
-std::array<float,2>{0.0333943181f, 0.309639037f},
-std::array<float,2>{0.519057691f, 0.885723174f},
-std::array<float,2>{0.21313785f, 0.818590403f},
-std::array<float,2>{0.669807851f, 0.465993792f},
-std::array<float,2>{0.297291964f, 0.00819721632f},
-std::array<float,2>{0.831953168f, 0.579728901f},
-std::array<float,2>{0.479236543f, 0.778503835f},
-std::array<float,2>{0.977732003f, 0.424766004f},
-std::array<float,2>{0.0851104334f, 0.109323211f},
-std::array<float,2>{0.611970723f, 0.556722045f},
-std::array<float,2>{0.179748029f, 0.692376971f},
-std::array<float,2>{0.727963507f, 0.231483594f},
-std::array<float,2>{0.320215642f, 0.331284076f},
-std::array<float,2>{0.774620175f, 0.964967012f},
-std::array<float,2>{0.273267239f, 0.607796192f},
-std::array<float,2>{0.861102581f, 0.0406635031f},
-std::array<float,2>{0.228171855f, 0.478680611f},
-std::array<float,2>{0.626242101f, 0.848095059f},
-std::array<float,2>{0.0211866889f, 0.930534661f},
-std::array<float,2>{0.550960302f, 0.278232813f},
-std::array<float,2>{0.404063523f, 0.152719632f},
-std::array<float,2>{0.9267869f, 0.654442549f},
-std::array<float,2>{0.379662454f, 0.891578496f},
-std::array<float,2>{0.907839954f, 0.289594203f},
-std::array<float,2>{0.00182368665f, 0.156407759f},
-std::array<float,2>{0.532173574f, 0.674197972f},
-std::array<float,2>{0.237046689f, 0.572725177f},
-std::array<float,2>{0.654383719f, 0.0242252667f},
-std::array<float,2>{0.256110579f, 0.442440987f},
-std::array<float,2>{0.850041747f, 0.833533883f},
-std::array<float,2>{0.342839301f, 0.74213469f},
-std::array<float,2>{0.752627254f, 0.218284234f},
-std::array<float,2>{0.1651472f, 0.346566886f},
-std::array<float,2>{0.738901079f, 0.973124564f},
-std::array<float,2>{0.0744199082f, 0.787627041f},
-std::array<float,2>{0.604506433f, 0.39469403f},
-std::array<float,2>{0.49122566f, 0.0706008151f},
-std::array<float,2>{0.985105932f, 0.515441418f},
-std::array<float,2>{0.28140229f, 0.873645842f},
-std::array<float,2>{0.827375889f, 0.498224199f},
-std::array<float,2>{0.187867567f, 0.0527824163f},
-std::array<float,2>{0.683918536f, 0.624646544f},
-std::array<float,2>{0.059810631f, 0.628704786f},
-std::array<float,2>{0.51062423f, 0.139886111f},
-std::array<float,2>{0.412184983f, 0.251584262f},
-std::array<float,2>{0.878960967f, 0.917289734f},
-std::array<float,2>{0.465776056f, 0.537304521f},
-std::array<float,2>{0.956026137f, 0.124123625f},
-std::array<float,2>{0.11196506f, 0.407161236f},
-std::array<float,2>{0.587000608f, 0.760959566f},
-std::array<float,2>{0.135578066f, 0.943050623f},
-std::array<float,2>{0.71207571f, 0.321493387f},
-std::array<float,2>{0.350712478f, 0.234710261f},
-std::array<float,2>{0.794250786f, 0.710198522f},
-std::array<float,2>{0.33579126f, 0.890477717f},
-std::array<float,2>{0.757867634f, 0.306156874f},
-std::array<float,2>{0.163993269f, 0.181417301f},
-std::array<float,2>{0.746178806f, 0.65696615f},
-std::array<float,2>{0.0629529878f, 0.585157275f},
-std::array<float,2>{0.596645474f, 0.0129097085f},
-std::array<float,2>{0.495862305f, 0.463701487f},
-std::array<float,2>{0.996336043f, 0.814372718f},
-std::array<float,2>{0.386228859f, 0.730208933f},
-std::array<float,2>{0.919339836f, 0.202386737f},
-std::array<float,2>{0.00790553819f, 0.367224753f},
-std::array<float,2>{0.54241389f, 0.989684045f},
-std::array<float,2>{0.2473263f, 0.802130222f},
-std::array<float,2>{0.642385602f, 0.390045315f},
-std::array<float,2>{0.261413395f, 0.0934227258f},
-std::array<float,2>{0.853713155f, 0.524285436f},
-std::array<float,2>{0.456536978f, 0.847456872f},
-std::array<float,2>{0.967233419f, 0.483466804f},
-std::array<float,2>{0.122712508f, 0.0431638509f},
-std::array<float,2>{0.584978342f, 0.604993165f},
-std::array<float,2>{0.132770851f, 0.648822546f},
-std::array<float,2>{0.704449594f, 0.150309712f},
-std::array<float,2>{0.351738155f, 0.274841905f},
-std::array<float,2>{0.785758376f, 0.936437488f},
-std::array<float,2>{0.295262963f, 0.560213387f},
-std::array<float,2>{0.81875217f, 0.101852648f},
-std::array<float,2>{0.195809081f, 0.428847909f},
-std::array<float,2>{0.675498426f, 0.777278304f},
-std::array<float,2>{0.0484181084f, 0.96360743f},
-std::array<float,2>{0.506522477f, 0.332268417f},
-std::array<float,2>{0.420226336f, 0.227350339f},
-std::array<float,2>{0.886251509f, 0.68810159f},
-std::array<float,2>{0.436879873f, 0.969668865f},
-std::array<float,2>{0.899007261f, 0.348770827f},
-std::array<float,2>{0.0393512398f, 0.212863907f},
-std::array<float,2>{0.528802276f, 0.736564636f},
-std::array<float,2>{0.20676437f, 0.511226177f},
-std::array<float,2>{0.658286512f, 0.0769682601f},
-std::array<float,2>{0.312232882f, 0.392054349f},
-std::array<float,2>{0.837778687f, 0.782778263f},
-std::array<float,2>{0.366890609f, 0.679215133f},
-std::array<float,2>{0.804554582f, 0.160713494f},
-std::array<float,2>{0.154229119f, 0.294061571f},
-std::array<float,2>{0.693849683f, 0.896476388f},
-std::array<float,2>{0.105805501f, 0.828633904f},
-std::array<float,2>{0.569780052f, 0.43996051f},
-std::array<float,2>{0.43832022f, 0.0276946556f},
-std::array<float,2>{0.942199349f, 0.575008571f},
-std::array<float,2>{0.275844187f, 0.762385428f},
-std::array<float,2>{0.872624576f, 0.410708427f},
-std::array<float,2>{0.224228606f, 0.119146749f},
-std::array<float,2>{0.633631229f, 0.534350038f},
-std::array<float,2>{0.0303681847f, 0.706470191f},
-std::array<float,2>{0.559673071f, 0.240390509f},
-std::array<float,2>{0.396417797f, 0.327006906f},
-std::array<float,2>{0.935224473f, 0.938538313f},
-std::array<float,2>{0.474334776f, 0.62043488f},
-std::array<float,2>{0.970716f, 0.0490418449f},
-std::array<float,2>{0.0914151073f, 0.493631423f},
-std::array<float,2>{0.622494876f, 0.868264675f},
-std::array<float,2>{0.172382966f, 0.920602918f},
-std::array<float,2>{0.720085859f, 0.255682617f},
-std::array<float,2>{0.324166685f, 0.135186806f},
-std::array<float,2>{0.771545529f, 0.629571855f},
-std::array<float,2>{0.304414153f, 0.947066069f},
-std::array<float,2>{0.833688855f, 0.318673879f},
-std::array<float,2>{0.217424154f, 0.244423568f},
-std::array<float,2>{0.666280627f, 0.718312681f},
-std::array<float,2>{0.0367499404f, 0.543422699f},
-std::array<float,2>{0.521333158f, 0.109758891f},
-std::array<float,2>{0.422286987f, 0.417357594f},
-std::array<float,2>{0.890890956f, 0.753544271f},
-std::array<float,2>{0.452207506f, 0.639651954f},
-std::array<float,2>{0.946045756f, 0.126990661f},
-std::array<float,2>{0.0981640667f, 0.26492998f},
-std::array<float,2>{0.573465586f, 0.912615716f},
-std::array<float,2>{0.14797619f, 0.863707483f},
-std::array<float,2>{0.703075588f, 0.485357344f},
-std::array<float,2>{0.373152286f, 0.0624174923f},
-std::array<float,2>{0.805942237f, 0.616154075f},
-std::array<float,2>{0.400309205f, 0.796569049f},
-std::array<float,2>{0.923789501f, 0.400478959f},
-std::array<float,2>{0.0182168186f, 0.0667887181f},
-std::array<float,2>{0.549889684f, 0.500004232f},
-std::array<float,2>{0.234267339f, 0.742760479f},
-std::array<float,2>{0.629938483f, 0.20814462f},
-std::array<float,2>{0.268666893f, 0.35249114f},
-std::array<float,2>{0.866775811f, 0.981023133f},
-std::array<float,2>{0.314374596f, 0.565385461f},
-std::array<float,2>{0.780079246f, 0.0209600721f},
-std::array<float,2>{0.185785383f, 0.450110286f},
-std::array<float,2>{0.734277129f, 0.843072295f},
-std::array<float,2>{0.0782802403f, 0.903296471f},
-std::array<float,2>{0.616844594f, 0.28811422f},
-std::array<float,2>{0.481462985f, 0.165433094f},
-std::array<float,2>{0.982939899f, 0.682900786f},
-std::array<float,2>{0.485682547f, 0.926990807f},
-std::array<float,2>{0.989745677f, 0.267193049f},
-std::array<float,2>{0.0709974542f, 0.146809831f},
-std::array<float,2>{0.609253883f, 0.640916109f},
-std::array<float,2>{0.170187891f, 0.594817281f},
-std::array<float,2>{0.734517992f, 0.0312837772f},
-std::array<float,2>{0.337082803f, 0.475798339f},
-std::array<float,2>{0.757273495f, 0.856079161f},
-std::array<float,2>{0.253693014f, 0.7007429f},
-std::array<float,2>{0.845879376f, 0.221890837f},
-std::array<float,2>{0.239372551f, 0.338861138f},
-std::array<float,2>{0.649167895f, 0.956597924f},
-std::array<float,2>{0.00781207671f, 0.766870201f},
-std::array<float,2>{0.538873911f, 0.435446292f},
-std::array<float,2>{0.376235247f, 0.0999363512f},
-std::array<float,2>{0.910470665f, 0.554511309f},
-std::array<float,2>{0.347170323f, 0.826629102f},
-std::array<float,2>{0.79118371f, 0.460602343f},
-std::array<float,2>{0.138731346f, 0.00719074206f},
-std::array<float,2>{0.714968562f, 0.592696011f},
-std::array<float,2>{0.11498192f, 0.665964305f},
-std::array<float,2>{0.593521833f, 0.175677761f},
-std::array<float,2>{0.462729901f, 0.303362697f},
-std::array<float,2>{0.957615435f, 0.87691623f},
-std::array<float,2>{0.409173578f, 0.521137178f},
-std::array<float,2>{0.878415585f, 0.0840483829f},
-std::array<float,2>{0.0548981801f, 0.379560769f},
-std::array<float,2>{0.511739135f, 0.808606029f},
-std::array<float,2>{0.194802299f, 0.998016357f},
-std::array<float,2>{0.681189597f, 0.35949564f},
-std::array<float,2>{0.285416931f, 0.188331112f},
-std::array<float,2>{0.821381032f, 0.726292849f},
-std::array<float,2>{0.289740413f, 0.898760855f},
-std::array<float,2>{0.815733314f, 0.285080194f},
-std::array<float,2>{0.202836692f, 0.168650284f},
-std::array<float,2>{0.676421583f, 0.686714172f},
-std::array<float,2>{0.0537551381f, 0.569535375f},
-std::array<float,2>{0.500470102f, 0.0161895957f},
-std::array<float,2>{0.41786027f, 0.448983878f},
-std::array<float,2>{0.886998355f, 0.837837696f},
-std::array<float,2>{0.460853726f, 0.746317804f},
-std::array<float,2>{0.964238346f, 0.205621064f},
-std::array<float,2>{0.120182171f, 0.355848044f},
-std::array<float,2>{0.580036044f, 0.977820337f},
-std::array<float,2>{0.125155389f, 0.791272938f},
-std::array<float,2>{0.707271695f, 0.406080872f},
-std::array<float,2>{0.356432855f, 0.0653211102f},
-std::array<float,2>{0.783941925f, 0.506707609f},
-std::array<float,2>{0.389511198f, 0.862698555f},
-std::array<float,2>{0.91508311f, 0.48899731f},
-std::array<float,2>{0.0142547181f, 0.0573688596f},
-std::array<float,2>{0.545632243f, 0.611237049f},
-std::array<float,2>{0.244035646f, 0.636623383f},
-std::array<float,2>{0.647889078f, 0.132558838f},
-std::array<float,2>{0.261749655f, 0.257871419f},
-std::array<float,2>{0.858863711f, 0.909435213f},
-std::array<float,2>{0.330740064f, 0.539282262f},
-std::array<float,2>{0.7655527f, 0.115072735f},
-std::array<float,2>{0.15953885f, 0.418857455f},
-std::array<float,2>{0.742668748f, 0.756067693f},
-std::array<float,2>{0.0699415505f, 0.951138735f},
-std::array<float,2>{0.59896034f, 0.316025525f},
-std::array<float,2>{0.498476237f, 0.249510482f},
-std::array<float,2>{0.992518902f, 0.713695586f},
-std::array<float,2>{0.470742941f, 0.996016502f},
-std::array<float,2>{0.97436887f, 0.365581185f},
-std::array<float,2>{0.0878900066f, 0.192796841f},
-std::array<float,2>{0.617443919f, 0.722309768f},
-std::array<float,2>{0.177799106f, 0.51937604f},
-std::array<float,2>{0.723864138f, 0.0811531916f},
-std::array<float,2>{0.324439257f, 0.375149369f},
-std::array<float,2>{0.76628685f, 0.805087447f},
-std::array<float,2>{0.278705657f, 0.66845119f},
-std::array<float,2>{0.867384434f, 0.176126808f},
-std::array<float,2>{0.221292034f, 0.298474014f},
-std::array<float,2>{0.639324188f, 0.881244004f},
-std::array<float,2>{0.0265680272f, 0.823671103f},
-std::array<float,2>{0.558327675f, 0.454127043f},
-std::array<float,2>{0.393642247f, 0.000406604318f},
-std::array<float,2>{0.931147516f, 0.586287439f},
-std::array<float,2>{0.360467494f, 0.771505356f},
-std::array<float,2>{0.80016613f, 0.431036711f},
-std::array<float,2>{0.149439618f, 0.0947947353f},
-std::array<float,2>{0.689499259f, 0.548747063f},
-std::array<float,2>{0.104018837f, 0.69556421f},
-std::array<float,2>{0.56617105f, 0.222933263f},
-std::array<float,2>{0.445157737f, 0.342898279f},
-std::array<float,2>{0.939509213f, 0.960035086f},
-std::array<float,2>{0.429952919f, 0.600527585f},
-std::array<float,2>{0.904923797f, 0.0357878767f},
-std::array<float,2>{0.0443810858f, 0.468978196f},
-std::array<float,2>{0.526525736f, 0.852934718f},
-std::array<float,2>{0.209737301f, 0.924945176f},
-std::array<float,2>{0.664029717f, 0.270272404f},
-std::array<float,2>{0.307784975f, 0.143866986f},
-std::array<float,2>{0.843466341f, 0.648025095f},
-std::array<float,2>{0.316800326f, 0.967099845f},
-std::array<float,2>{0.777035296f, 0.328789651f},
-std::array<float,2>{0.183029264f, 0.232497603f},
-std::array<float,2>{0.729496181f, 0.69493562f},
-std::array<float,2>{0.0832509995f, 0.556432247f},
-std::array<float,2>{0.610889375f, 0.107406676f},
-std::array<float,2>{0.477433592f, 0.422324866f},
-std::array<float,2>{0.980306804f, 0.779705048f},
-std::array<float,2>{0.404778421f, 0.653347909f},
-std::array<float,2>{0.928368568f, 0.154323503f},
-std::array<float,2>{0.0233304817f, 0.280458778f},
-std::array<float,2>{0.553275645f, 0.933210075f},
-std::array<float,2>{0.230409056f, 0.849713147f},
-std::array<float,2>{0.628425896f, 0.477595985f},
-std::array<float,2>{0.26966691f, 0.0412019342f},
-std::array<float,2>{0.862179518f, 0.605630159f},
-std::array<float,2>{0.448189169f, 0.797369659f},
-std::array<float,2>{0.950746357f, 0.384298831f},
-std::array<float,2>{0.0951676816f, 0.0894031003f},
-std::array<float,2>{0.576205552f, 0.529487312f},
-std::array<float,2>{0.144044638f, 0.734359801f},
-std::array<float,2>{0.696073353f, 0.19872874f},
-std::array<float,2>{0.368930995f, 0.373914808f},
-std::array<float,2>{0.811252773f, 0.986240923f},
-std::array<float,2>{0.298977733f, 0.581337392f},
-std::array<float,2>{0.828838885f, 0.0113943936f},
-std::array<float,2>{0.211290911f, 0.468304187f},
-std::array<float,2>{0.670167863f, 0.817553639f},
-std::array<float,2>{0.033020962f, 0.88383615f},
-std::array<float,2>{0.516539872f, 0.31205231f},
-std::array<float,2>{0.426908672f, 0.186149955f},
-std::array<float,2>{0.896939456f, 0.66154182f},
-std::array<float,2>{0.410445064f, 0.915959477f},
-std::array<float,2>{0.881255627f, 0.253015101f},
-std::array<float,2>{0.0622193515f, 0.138144821f},
-std::array<float,2>{0.508573532f, 0.625338614f},
-std::array<float,2>{0.190112948f, 0.621177316f},
-std::array<float,2>{0.686286807f, 0.0526447743f},
-std::array<float,2>{0.28365612f, 0.496790469f},
-std::array<float,2>{0.825193584f, 0.872399211f},
-std::array<float,2>{0.349095732f, 0.707587659f},
-std::array<float,2>{0.794992447f, 0.2381832f},
-std::array<float,2>{0.13300471f, 0.323260248f},
-std::array<float,2>{0.713690519f, 0.943712115f},
-std::array<float,2>{0.11012508f, 0.758978069f},
-std::array<float,2>{0.588828444f, 0.408230424f},
-std::array<float,2>{0.466904789f, 0.12138956f},
-std::array<float,2>{0.954566121f, 0.535481334f},
-std::array<float,2>{0.25527966f, 0.835071266f},
-std::array<float,2>{0.849270821f, 0.445002079f},
-std::array<float,2>{0.23490116f, 0.0259910468f},
-std::array<float,2>{0.652941763f, 0.571374059f},
-std::array<float,2>{0.00228388235f, 0.672154367f},
-std::array<float,2>{0.535044909f, 0.158858925f},
-std::array<float,2>{0.380962104f, 0.292425692f},
-std::array<float,2>{0.908570409f, 0.892987549f},
-std::array<float,2>{0.489939213f, 0.512896776f},
-std::array<float,2>{0.987364531f, 0.0737526044f},
-std::array<float,2>{0.0775249898f, 0.396665931f},
-std::array<float,2>{0.603425503f, 0.78552407f},
-std::array<float,2>{0.16617927f, 0.975549757f},
-std::array<float,2>{0.742092371f, 0.344090194f},
-std::array<float,2>{0.340758264f, 0.215382248f},
-std::array<float,2>{0.750350535f, 0.73958528f},
-std::array<float,2>{0.354054421f, 0.934616148f},
-std::array<float,2>{0.788926244f, 0.277243435f},
-std::array<float,2>{0.129346266f, 0.151531518f},
-std::array<float,2>{0.7055704f, 0.651956677f},
-std::array<float,2>{0.123461239f, 0.602399766f},
-std::array<float,2>{0.582564116f, 0.0460003391f},
-std::array<float,2>{0.45490396f, 0.48078078f},
-std::array<float,2>{0.966486633f, 0.844412386f},
-std::array<float,2>{0.41879651f, 0.690566719f},
-std::array<float,2>{0.88293469f, 0.229106829f},
-std::array<float,2>{0.0492189303f, 0.33487606f},
-std::array<float,2>{0.50496006f, 0.961382568f},
-std::array<float,2>{0.198716104f, 0.77431488f},
-std::array<float,2>{0.673401177f, 0.42712909f},
-std::array<float,2>{0.293976843f, 0.104251564f},
-std::array<float,2>{0.817773819f, 0.562094629f},
-std::array<float,2>{0.492927074f, 0.816189945f},
-std::array<float,2>{0.998393953f, 0.462487698f},
-std::array<float,2>{0.0651582405f, 0.0155862225f},
-std::array<float,2>{0.594849229f, 0.58343631f},
-std::array<float,2>{0.161849573f, 0.659166813f},
-std::array<float,2>{0.74806565f, 0.181951001f},
-std::array<float,2>{0.332422227f, 0.306820452f},
-std::array<float,2>{0.760121703f, 0.887092471f},
-std::array<float,2>{0.258127153f, 0.527001858f},
-std::array<float,2>{0.853383064f, 0.0908944383f},
-std::array<float,2>{0.249590546f, 0.388346344f},
-std::array<float,2>{0.64306134f, 0.803963125f},
-std::array<float,2>{0.0116899107f, 0.991860867f},
-std::array<float,2>{0.540920019f, 0.370572597f},
-std::array<float,2>{0.384179622f, 0.200747341f},
-std::array<float,2>{0.921674669f, 0.728330553f},
-std::array<float,2>{0.397582829f, 0.940502107f},
-std::array<float,2>{0.935770631f, 0.325325429f},
-std::array<float,2>{0.0275992453f, 0.238713786f},
-std::array<float,2>{0.562156439f, 0.705024958f},
-std::array<float,2>{0.225353613f, 0.533161342f},
-std::array<float,2>{0.636446655f, 0.118227072f},
-std::array<float,2>{0.274058551f, 0.412209243f},
-std::array<float,2>{0.87487179f, 0.764684677f},
-std::array<float,2>{0.32208851f, 0.631577253f},
-std::array<float,2>{0.770803809f, 0.134541571f},
-std::array<float,2>{0.175543442f, 0.25591886f},
-std::array<float,2>{0.721657395f, 0.918139875f},
-std::array<float,2>{0.0928445756f, 0.870963812f},
-std::array<float,2>{0.623169959f, 0.494986922f},
-std::array<float,2>{0.475583434f, 0.0470046178f},
-std::array<float,2>{0.969307125f, 0.618497252f},
-std::array<float,2>{0.308843583f, 0.784796774f},
-std::array<float,2>{0.839431524f, 0.394259244f},
-std::array<float,2>{0.204118028f, 0.0745802969f},
-std::array<float,2>{0.657928824f, 0.508365333f},
-std::array<float,2>{0.0427961722f, 0.734536231f},
-std::array<float,2>{0.531001687f, 0.213487223f},
-std::array<float,2>{0.434797168f, 0.349759132f},
-std::array<float,2>{0.901278794f, 0.970884144f},
-std::array<float,2>{0.439528108f, 0.577075183f},
-std::array<float,2>{0.945158958f, 0.0293149147f},
-std::array<float,2>{0.107549571f, 0.438455909f},
-std::array<float,2>{0.5677163f, 0.831239283f},
-std::array<float,2>{0.154342517f, 0.897024214f},
-std::array<float,2>{0.69236815f, 0.295199633f},
-std::array<float,2>{0.363637358f, 0.162788928f},
-std::array<float,2>{0.801640928f, 0.676174521f},
-std::array<float,2>{0.267283171f, 0.983894348f},
-std::array<float,2>{0.863697588f, 0.353657693f},
-std::array<float,2>{0.231770158f, 0.209262714f},
-std::array<float,2>{0.631881773f, 0.745362282f},
-std::array<float,2>{0.016024638f, 0.502973437f},
-std::array<float,2>{0.547772408f, 0.0698730126f},
-std::array<float,2>{0.400776714f, 0.398834646f},
-std::array<float,2>{0.92561686f, 0.794666767f},
-std::array<float,2>{0.483344585f, 0.681463122f},
-std::array<float,2>{0.980925083f, 0.166397989f},
-std::array<float,2>{0.0808711126f, 0.285549939f},
-std::array<float,2>{0.61340791f, 0.905006647f},
-std::array<float,2>{0.184584752f, 0.840123832f},
-std::array<float,2>{0.73111558f, 0.452363431f},
-std::array<float,2>{0.31496495f, 0.0217455532f},
-std::array<float,2>{0.777863085f, 0.564262986f},
-std::array<float,2>{0.424317062f, 0.750430286f},
-std::array<float,2>{0.893157005f, 0.414520979f},
-std::array<float,2>{0.0377303883f, 0.113176823f},
-std::array<float,2>{0.521852911f, 0.546437979f},
-std::array<float,2>{0.216358319f, 0.716077924f},
-std::array<float,2>{0.664611757f, 0.243485585f},
-std::array<float,2>{0.301692158f, 0.317388415f},
-std::array<float,2>{0.835806012f, 0.947696626f},
-std::array<float,2>{0.371677637f, 0.614901006f},
-std::array<float,2>{0.807394922f, 0.059216518f},
-std::array<float,2>{0.145080373f, 0.486543268f},
-std::array<float,2>{0.700430512f, 0.866171539f},
-std::array<float,2>{0.10110274f, 0.910920024f},
-std::array<float,2>{0.570352972f, 0.263234228f},
-std::array<float,2>{0.44968152f, 0.125270233f},
-std::array<float,2>{0.947962403f, 0.638275862f},
-std::array<float,2>{0.464506179f, 0.878427088f},
-std::array<float,2>{0.959790289f, 0.302669823f},
-std::array<float,2>{0.116074212f, 0.173346728f},
-std::array<float,2>{0.591119885f, 0.666643441f},
-std::array<float,2>{0.137177601f, 0.590230107f},
-std::array<float,2>{0.718704462f, 0.0043853214f},
-std::array<float,2>{0.344092548f, 0.458856881f},
-std::array<float,2>{0.789638698f, 0.825085938f},
-std::array<float,2>{0.288631827f, 0.723682344f},
-std::array<float,2>{0.822794318f, 0.190637425f},
-std::array<float,2>{0.193157509f, 0.361577809f},
-std::array<float,2>{0.682793319f, 0.998990417f},
-std::array<float,2>{0.0568013303f, 0.81166327f},
-std::array<float,2>{0.514816165f, 0.38176015f},
-std::array<float,2>{0.406445533f, 0.0820598081f},
-std::array<float,2>{0.875075459f, 0.523161948f},
-std::array<float,2>{0.338886201f, 0.857734501f},
-std::array<float,2>{0.755035043f, 0.473427117f},
-std::array<float,2>{0.169564337f, 0.0347337946f},
-std::array<float,2>{0.73671025f, 0.597034037f},
-std::array<float,2>{0.0735103488f, 0.644360006f},
-std::array<float,2>{0.606600881f, 0.145117104f},
-std::array<float,2>{0.48738429f, 0.268193632f},
-std::array<float,2>{0.991633654f, 0.927943707f},
-std::array<float,2>{0.378421903f, 0.55256021f},
-std::array<float,2>{0.913641989f, 0.0985337794f},
-std::array<float,2>{0.00578393415f, 0.436798871f},
-std::array<float,2>{0.535933137f, 0.767617404f},
-std::array<float,2>{0.240443513f, 0.954553783f},
-std::array<float,2>{0.652118742f, 0.336685747f},
-std::array<float,2>{0.251606017f, 0.218999922f},
-std::array<float,2>{0.845170617f, 0.702019632f},
-std::array<float,2>{0.256726593f, 0.893471837f},
-std::array<float,2>{0.850371659f, 0.292568207f},
-std::array<float,2>{0.236406356f, 0.158386633f},
-std::array<float,2>{0.65492928f, 0.672841012f},
-std::array<float,2>{0.00139758014f, 0.571969867f},
-std::array<float,2>{0.531403244f, 0.0256286934f},
-std::array<float,2>{0.379232943f, 0.444760382f},
-std::array<float,2>{0.907660484f, 0.835665762f},
-std::array<float,2>{0.491967559f, 0.740142226f},
-std::array<float,2>{0.984394968f, 0.214973256f},
-std::array<float,2>{0.0750575215f, 0.344497591f},
-std::array<float,2>{0.605198562f, 0.975016356f},
-std::array<float,2>{0.165850148f, 0.785965562f},
-std::array<float,2>{0.738675892f, 0.396982789f},
-std::array<float,2>{0.343329012f, 0.0732951835f},
-std::array<float,2>{0.752055824f, 0.513325036f},
-std::array<float,2>{0.412647069f, 0.872877836f},
-std::array<float,2>{0.879497468f, 0.496097535f},
-std::array<float,2>{0.0604387261f, 0.0518911779f},
-std::array<float,2>{0.510117948f, 0.621668875f},
-std::array<float,2>{0.188324183f, 0.625564039f},
-std::array<float,2>{0.684514701f, 0.138332546f},
-std::array<float,2>{0.281803817f, 0.253587306f},
-std::array<float,2>{0.827869236f, 0.915411651f},
-std::array<float,2>{0.35150975f, 0.535738647f},
-std::array<float,2>{0.794433951f, 0.121632285f},
-std::array<float,2>{0.135101959f, 0.408977836f},
-std::array<float,2>{0.712561131f, 0.759634852f},
-std::array<float,2>{0.11176344f, 0.944224596f},
-std::array<float,2>{0.587637842f, 0.323913842f},
-std::array<float,2>{0.465172499f, 0.237461373f},
-std::array<float,2>{0.955135226f, 0.707442999f},
-std::array<float,2>{0.44598496f, 0.985601544f},
-std::array<float,2>{0.95249325f, 0.373368531f},
-std::array<float,2>{0.0968025401f, 0.198736802f},
-std::array<float,2>{0.576147676f, 0.73371011f},
-std::array<float,2>{0.142301574f, 0.529803932f},
-std::array<float,2>{0.697392106f, 0.0889357701f},
-std::array<float,2>{0.369751185f, 0.383943558f},
-std::array<float,2>{0.809873998f, 0.797342002f},
-std::array<float,2>{0.29739669f, 0.661819816f},
-std::array<float,2>{0.831220984f, 0.186001539f},
-std::array<float,2>{0.213801697f, 0.311995149f},
-std::array<float,2>{0.669424057f, 0.884505808f},
-std::array<float,2>{0.0338367745f, 0.817884684f},
-std::array<float,2>{0.518688619f, 0.468084186f},
-std::array<float,2>{0.429016203f, 0.0109988293f},
-std::array<float,2>{0.894669354f, 0.581907749f},
-std::array<float,2>{0.319567889f, 0.779932976f},
-std::array<float,2>{0.775170982f, 0.422402143f},
-std::array<float,2>{0.180483148f, 0.106689036f},
-std::array<float,2>{0.728412747f, 0.555889547f},
-std::array<float,2>{0.0856854171f, 0.69462049f},
-std::array<float,2>{0.611396611f, 0.233244628f},
-std::array<float,2>{0.478655785f, 0.328405172f},
-std::array<float,2>{0.978060782f, 0.967689931f},
-std::array<float,2>{0.403350443f, 0.606286049f},
-std::array<float,2>{0.927591741f, 0.0415904522f},
-std::array<float,2>{0.0208037961f, 0.478104025f},
-std::array<float,2>{0.551749349f, 0.850551367f},
-std::array<float,2>{0.227665782f, 0.93308562f},
-std::array<float,2>{0.626820207f, 0.280819058f},
-std::array<float,2>{0.272944033f, 0.155072436f},
-std::array<float,2>{0.860823333f, 0.653925657f},
-std::array<float,2>{0.362653494f, 0.960579693f},
-std::array<float,2>{0.797950506f, 0.343305618f},
-std::array<float,2>{0.150674254f, 0.223421946f},
-std::array<float,2>{0.688268244f, 0.696034968f},
-std::array<float,2>{0.102492839f, 0.548111439f},
-std::array<float,2>{0.562642813f, 0.0954379961f},
-std::array<float,2>{0.442374736f, 0.43159613f},
-std::array<float,2>{0.938364685f, 0.772108376f},
-std::array<float,2>{0.432514936f, 0.647745311f},
-std::array<float,2>{0.9028458f, 0.144252077f},
-std::array<float,2>{0.046001669f, 0.269556999f},
-std::array<float,2>{0.523673058f, 0.925407529f},
-std::array<float,2>{0.208848074f, 0.853437364f},
-std::array<float,2>{0.660997272f, 0.469640404f},
-std::array<float,2>{0.305324465f, 0.0356031246f},
-std::array<float,2>{0.840528548f, 0.599793315f},
-std::array<float,2>{0.469771057f, 0.805475056f},
-std::array<float,2>{0.976262689f, 0.375591159f},
-std::array<float,2>{0.0891756043f, 0.0819589421f},
-std::array<float,2>{0.619615018f, 0.518798828f},
-std::array<float,2>{0.175860956f, 0.721691668f},
-std::array<float,2>{0.725189447f, 0.192904785f},
-std::array<float,2>{0.326930046f, 0.366032273f},
-std::array<float,2>{0.768825233f, 0.995557785f},
-std::array<float,2>{0.280376136f, 0.58654809f},
-std::array<float,2>{0.869440794f, 0.000919369108f},
-std::array<float,2>{0.219105929f, 0.454738736f},
-std::array<float,2>{0.637007296f, 0.824179471f},
-std::array<float,2>{0.023860326f, 0.881463945f},
-std::array<float,2>{0.556254506f, 0.298282683f},
-std::array<float,2>{0.392400235f, 0.176394358f},
-std::array<float,2>{0.93328476f, 0.668517649f},
-std::array<float,2>{0.387626231f, 0.909738243f},
-std::array<float,2>{0.916052043f, 0.258338332f},
-std::array<float,2>{0.0117621571f, 0.131972849f},
-std::array<float,2>{0.543774366f, 0.635791838f},
-std::array<float,2>{0.244619638f, 0.610685647f},
-std::array<float,2>{0.64631784f, 0.0567733608f},
-std::array<float,2>{0.263854027f, 0.488409758f},
-std::array<float,2>{0.857118547f, 0.862960994f},
-std::array<float,2>{0.328276575f, 0.712934434f},
-std::array<float,2>{0.76245302f, 0.249690995f},
-std::array<float,2>{0.158199161f, 0.315656513f},
-std::array<float,2>{0.744392812f, 0.950522184f},
-std::array<float,2>{0.0677676052f, 0.756649375f},
-std::array<float,2>{0.601243913f, 0.418020636f},
-std::array<float,2>{0.497139633f, 0.114666253f},
-std::array<float,2>{0.994444191f, 0.539967299f},
-std::array<float,2>{0.292061687f, 0.837136269f},
-std::array<float,2>{0.812627673f, 0.448596656f},
-std::array<float,2>{0.199390322f, 0.0157823078f},
-std::array<float,2>{0.678540945f, 0.570017874f},
-std::array<float,2>{0.0525437742f, 0.687174141f},
-std::array<float,2>{0.50228852f, 0.168300077f},
-std::array<float,2>{0.415908009f, 0.284505308f},
-std::array<float,2>{0.890288055f, 0.899232268f},
-std::array<float,2>{0.457147151f, 0.505914211f},
-std::array<float,2>{0.961618125f, 0.0644908547f},
-std::array<float,2>{0.11771594f, 0.405551821f},
-std::array<float,2>{0.581972599f, 0.791961968f},
-std::array<float,2>{0.127294227f, 0.978366852f},
-std::array<float,2>{0.71085155f, 0.356266171f},
-std::array<float,2>{0.358933777f, 0.205203414f},
-std::array<float,2>{0.78181076f, 0.74678421f},
-std::array<float,2>{0.33757636f, 0.928462446f},
-std::array<float,2>{0.75765878f, 0.267996699f},
-std::array<float,2>{0.170447797f, 0.144888595f},
-std::array<float,2>{0.735006571f, 0.64362973f},
-std::array<float,2>{0.0704086423f, 0.597277105f},
-std::array<float,2>{0.608425975f, 0.0346563086f},
-std::array<float,2>{0.485910088f, 0.472741574f},
-std::array<float,2>{0.98999548f, 0.858396649f},
-std::array<float,2>{0.376485795f, 0.701463401f},
-std::array<float,2>{0.910912991f, 0.219700322f},
-std::array<float,2>{0.0070503694f, 0.335971177f},
-std::array<float,2>{0.538184524f, 0.954954982f},
-std::array<float,2>{0.239782766f, 0.768096983f},
-std::array<float,2>{0.648465693f, 0.437122643f},
-std::array<float,2>{0.253103614f, 0.0979746506f},
-std::array<float,2>{0.846402228f, 0.551959693f},
-std::array<float,2>{0.462231636f, 0.824219644f},
-std::array<float,2>{0.95703876f, 0.458389372f},
-std::array<float,2>{0.114327192f, 0.00464566145f},
-std::array<float,2>{0.593098283f, 0.590512574f},
-std::array<float,2>{0.139421001f, 0.666220248f},
-std::array<float,2>{0.715721846f, 0.172856286f},
-std::array<float,2>{0.346918643f, 0.301799327f},
-std::array<float,2>{0.791944325f, 0.878130317f},
-std::array<float,2>{0.28610611f, 0.522613049f},
-std::array<float,2>{0.821981072f, 0.0825337023f},
-std::array<float,2>{0.195052966f, 0.381049484f},
-std::array<float,2>{0.680669725f, 0.812431276f},
-std::array<float,2>{0.0553092323f, 0.998384416f},
-std::array<float,2>{0.512227416f, 0.362067521f},
-std::array<float,2>{0.408406466f, 0.191105336f},
-std::array<float,2>{0.878905058f, 0.724339008f},
-std::array<float,2>{0.422764003f, 0.948004782f},
-std::array<float,2>{0.891195834f, 0.318241596f},
-std::array<float,2>{0.0361608416f, 0.243786231f},
-std::array<float,2>{0.52070874f, 0.716491938f},
-std::array<float,2>{0.216888085f, 0.546380281f},
-std::array<float,2>{0.66671741f, 0.1125369f},
-std::array<float,2>{0.304087132f, 0.415016979f},
-std::array<float,2>{0.833190382f, 0.750893116f},
-std::array<float,2>{0.37392202f, 0.637708426f},
-std::array<float,2>{0.806345165f, 0.125613764f},
-std::array<float,2>{0.147882193f, 0.262734711f},
-std::array<float,2>{0.70226413f, 0.910488486f},
-std::array<float,2>{0.0977463871f, 0.865478098f},
-std::array<float,2>{0.574116766f, 0.487279356f},
-std::array<float,2>{0.452998221f, 0.0590392128f},
-std::array<float,2>{0.945771813f, 0.614638865f},
-std::array<float,2>{0.269360423f, 0.794221699f},
-std::array<float,2>{0.86667645f, 0.399346888f},
-std::array<float,2>{0.233551174f, 0.0694797039f},
-std::array<float,2>{0.630404294f, 0.503854513f},
-std::array<float,2>{0.0177124348f, 0.746006489f},
-std::array<float,2>{0.550359368f, 0.209560364f},
-std::array<float,2>{0.39981088f, 0.354091614f},
-std::array<float,2>{0.923072934f, 0.983844221f},
-std::array<float,2>{0.482042909f, 0.563941419f},
-std::array<float,2>{0.982446909f, 0.0224044956f},
-std::array<float,2>{0.0788128674f, 0.452893287f},
-std::array<float,2>{0.616270423f, 0.840727687f},
-std::array<float,2>{0.18634887f, 0.904604673f},
-std::array<float,2>{0.733673513f, 0.285845548f},
-std::array<float,2>{0.313489109f, 0.166560918f},
-std::array<float,2>{0.779484451f, 0.680824876f},
-std::array<float,2>{0.311605126f, 0.971336067f},
-std::array<float,2>{0.836999476f, 0.350538105f},
-std::array<float,2>{0.206407055f, 0.213123858f},
-std::array<float,2>{0.658836961f, 0.735310435f},
-std::array<float,2>{0.039789509f, 0.508237004f},
-std::array<float,2>{0.528812706f, 0.0747677535f},
-std::array<float,2>{0.437495947f, 0.393852979f},
-std::array<float,2>{0.89890486f, 0.784318984f},
-std::array<float,2>{0.437985748f, 0.676499188f},
-std::array<float,2>{0.941683292f, 0.162434757f},
-std::array<float,2>{0.106430337f, 0.295818567f},
-std::array<float,2>{0.569842219f, 0.896837354f},
-std::array<float,2>{0.15361771f, 0.831552923f},
-std::array<float,2>{0.693791926f, 0.437557131f},
-std::array<float,2>{0.36657089f, 0.0301627237f},
-std::array<float,2>{0.804134429f, 0.576334059f},
-std::array<float,2>{0.395887941f, 0.765310466f},
-std::array<float,2>{0.934917569f, 0.412693202f},
-std::array<float,2>{0.0309219193f, 0.118701488f},
-std::array<float,2>{0.560109675f, 0.532682896f},
-std::array<float,2>{0.223639354f, 0.704152226f},
-std::array<float,2>{0.63316828f, 0.238988087f},
-std::array<float,2>{0.276252121f, 0.326028198f},
-std::array<float,2>{0.872284293f, 0.941377878f},
-std::array<float,2>{0.323490381f, 0.619013727f},
-std::array<float,2>{0.772448301f, 0.0478408784f},
-std::array<float,2>{0.171914443f, 0.494262964f},
-std::array<float,2>{0.720303476f, 0.870164633f},
-std::array<float,2>{0.0909097567f, 0.91850239f},
-std::array<float,2>{0.62283349f, 0.256794631f},
-std::array<float,2>{0.473950535f, 0.134034052f},
-std::array<float,2>{0.971505702f, 0.631114781f},
-std::array<float,2>{0.495531976f, 0.887285531f},
-std::array<float,2>{0.996762276f, 0.307305634f},
-std::array<float,2>{0.0632554069f, 0.182229295f},
-std::array<float,2>{0.595890224f, 0.658485413f},
-std::array<float,2>{0.163439721f, 0.583882213f},
-std::array<float,2>{0.746876538f, 0.0148571832f},
-std::array<float,2>{0.335154563f, 0.462297231f},
-std::array<float,2>{0.75839287f, 0.815579414f},
-std::array<float,2>{0.260768026f, 0.7280128f},
-std::array<float,2>{0.854339063f, 0.200267583f},
-std::array<float,2>{0.247625589f, 0.371052176f},
-std::array<float,2>{0.6417768f, 0.991219521f},
-std::array<float,2>{0.00852182787f, 0.804383397f},
-std::array<float,2>{0.542562306f, 0.388160586f},
-std::array<float,2>{0.386710674f, 0.0913882926f},
-std::array<float,2>{0.919680834f, 0.526449621f},
-std::array<float,2>{0.352486968f, 0.844005287f},
-std::array<float,2>{0.785415113f, 0.481150389f},
-std::array<float,2>{0.132081598f, 0.0464492552f},
-std::array<float,2>{0.704603434f, 0.601583481f},
-std::array<float,2>{0.122294471f, 0.651735961f},
-std::array<float,2>{0.585821092f, 0.152126595f},
-std::array<float,2>{0.456945598f, 0.276850194f},
-std::array<float,2>{0.967766941f, 0.935228467f},
-std::array<float,2>{0.420722455f, 0.561585307f},
-std::array<float,2>{0.886179209f, 0.103566624f},
-std::array<float,2>{0.0482134819f, 0.427509248f},
-std::array<float,2>{0.506189346f, 0.77366966f},
-std::array<float,2>{0.195694134f, 0.961715698f},
-std::array<float,2>{0.674824834f, 0.334225804f},
-std::array<float,2>{0.295588672f, 0.228918627f},
-std::array<float,2>{0.819044888f, 0.691358924f},
-std::array<float,2>{0.284064263f, 0.917723954f},
-std::array<float,2>{0.824463785f, 0.251062959f},
-std::array<float,2>{0.189667568f, 0.140206799f},
-std::array<float,2>{0.685603142f, 0.62800163f},
-std::array<float,2>{0.0616694465f, 0.624085367f},
-std::array<float,2>{0.507995963f, 0.0535555147f},
-std::array<float,2>{0.411114573f, 0.498645931f},
-std::array<float,2>{0.881412506f, 0.873199344f},
-std::array<float,2>{0.46764791f, 0.710908651f},
-std::array<float,2>{0.954619229f, 0.235113278f},
-std::array<float,2>{0.109829225f, 0.321854293f},
-std::array<float,2>{0.5881899f, 0.942499697f},
-std::array<float,2>{0.133692935f, 0.761283278f},
-std::array<float,2>{0.713077605f, 0.406730592f},
-std::array<float,2>{0.349532723f, 0.124860749f},
-std::array<float,2>{0.795734346f, 0.537669837f},
-std::array<float,2>{0.381713092f, 0.833097219f},
-std::array<float,2>{0.90917021f, 0.443203211f},
-std::array<float,2>{0.00258271443f, 0.0235102419f},
-std::array<float,2>{0.534525394f, 0.573132932f},
-std::array<float,2>{0.234550416f, 0.674612641f},
-std::array<float,2>{0.652703345f, 0.156833574f},
-std::array<float,2>{0.255848855f, 0.289105117f},
-std::array<float,2>{0.849114001f, 0.890986681f},
-std::array<float,2>{0.339947671f, 0.514705479f},
-std::array<float,2>{0.750819206f, 0.0709221885f},
-std::array<float,2>{0.166865304f, 0.395201117f},
-std::array<float,2>{0.741577148f, 0.787545979f},
-std::array<float,2>{0.0780836791f, 0.973239958f},
-std::array<float,2>{0.602746189f, 0.346163303f},
-std::array<float,2>{0.489528537f, 0.218253925f},
-std::array<float,2>{0.988041222f, 0.741583347f},
-std::array<float,2>{0.476723671f, 0.965661168f},
-std::array<float,2>{0.979639471f, 0.331634164f},
-std::array<float,2>{0.0837748572f, 0.232049346f},
-std::array<float,2>{0.610416353f, 0.691849947f},
-std::array<float,2>{0.183318347f, 0.557222426f},
-std::array<float,2>{0.730054319f, 0.108633876f},
-std::array<float,2>{0.316964865f, 0.424157888f},
-std::array<float,2>{0.77637285f, 0.778897643f},
-std::array<float,2>{0.270173162f, 0.655165374f},
-std::array<float,2>{0.861565411f, 0.153020591f},
-std::array<float,2>{0.229742989f, 0.27747035f},
-std::array<float,2>{0.628255963f, 0.929775119f},
-std::array<float,2>{0.0227673352f, 0.848314881f},
-std::array<float,2>{0.552735031f, 0.479303896f},
-std::array<float,2>{0.40524137f, 0.0400559716f},
-std::array<float,2>{0.927996933f, 0.608233988f},
-std::array<float,2>{0.368311226f, 0.799890339f},
-std::array<float,2>{0.810986936f, 0.386121392f},
-std::array<float,2>{0.143575236f, 0.0871198252f},
-std::array<float,2>{0.695790827f, 0.529246092f},
-std::array<float,2>{0.0956962332f, 0.73162365f},
-std::array<float,2>{0.57709384f, 0.196030363f},
-std::array<float,2>{0.44745028f, 0.372347146f},
-std::array<float,2>{0.950616658f, 0.986993372f},
-std::array<float,2>{0.427659899f, 0.579545021f},
-std::array<float,2>{0.897211492f, 0.00876740087f},
-std::array<float,2>{0.0325024687f, 0.466354042f},
-std::array<float,2>{0.515763044f, 0.819005072f},
-std::array<float,2>{0.211911321f, 0.884889543f},
-std::array<float,2>{0.670629144f, 0.310213387f},
-std::array<float,2>{0.299767822f, 0.183657557f},
-std::array<float,2>{0.82856071f, 0.66376704f},
-std::array<float,2>{0.324973047f, 0.994076431f},
-std::array<float,2>{0.765653253f, 0.364515364f},
-std::array<float,2>{0.178262353f, 0.195191294f},
-std::array<float,2>{0.724439859f, 0.720426738f},
-std::array<float,2>{0.0870927796f, 0.516463757f},
-std::array<float,2>{0.617947161f, 0.0787224919f},
-std::array<float,2>{0.471332759f, 0.377414465f},
-std::array<float,2>{0.974005103f, 0.806973219f},
-std::array<float,2>{0.394203007f, 0.669991016f},
-std::array<float,2>{0.93122834f, 0.178975254f},
-std::array<float,2>{0.0271863416f, 0.300566167f},
-std::array<float,2>{0.557645738f, 0.879220784f},
-std::array<float,2>{0.22087957f, 0.821699142f},
-std::array<float,2>{0.6388973f, 0.456692576f},
-std::array<float,2>{0.279093057f, 0.00213784748f},
-std::array<float,2>{0.867703199f, 0.589115143f},
-std::array<float,2>{0.444491446f, 0.769907176f},
-std::array<float,2>{0.940246761f, 0.432769746f},
-std::array<float,2>{0.103821374f, 0.0971039236f},
-std::array<float,2>{0.565611184f, 0.550016999f},
-std::array<float,2>{0.150120825f, 0.698242664f},
-std::array<float,2>{0.690184712f, 0.225888744f},
-std::array<float,2>{0.361254841f, 0.34175387f},
-std::array<float,2>{0.800520897f, 0.958883643f},
-std::array<float,2>{0.308272004f, 0.597830653f},
-std::array<float,2>{0.843132973f, 0.0386224091f},
-std::array<float,2>{0.208986804f, 0.470820814f},
-std::array<float,2>{0.663250446f, 0.854541123f},
-std::array<float,2>{0.0445356965f, 0.922110379f},
-std::array<float,2>{0.527066469f, 0.272572756f},
-std::array<float,2>{0.430378884f, 0.142469764f},
-std::array<float,2>{0.904458702f, 0.646274865f},
-std::array<float,2>{0.417076468f, 0.901020825f},
-std::array<float,2>{0.887316048f, 0.28170082f},
-std::array<float,2>{0.0545209982f, 0.171355695f},
-std::array<float,2>{0.500639617f, 0.684087455f},
-std::array<float,2>{0.202378854f, 0.566921711f},
-std::array<float,2>{0.675924122f, 0.0181193855f},
-std::array<float,2>{0.289451361f, 0.446399897f},
-std::array<float,2>{0.816324294f, 0.838238299f},
-std::array<float,2>{0.355701804f, 0.749580026f},
-std::array<float,2>{0.783240259f, 0.2048105f},
-std::array<float,2>{0.125782698f, 0.358619362f},
-std::array<float,2>{0.707995057f, 0.978829682f},
-std::array<float,2>{0.121005371f, 0.79028964f},
-std::array<float,2>{0.579203546f, 0.403485924f},
-std::array<float,2>{0.460241318f, 0.0637537837f},
-std::array<float,2>{0.964606047f, 0.504163265f},
-std::array<float,2>{0.262636125f, 0.860158145f},
-std::array<float,2>{0.859363914f, 0.491826147f},
-std::array<float,2>{0.243612677f, 0.056283582f},
-std::array<float,2>{0.648317575f, 0.612088978f},
-std::array<float,2>{0.0136971148f, 0.633104742f},
-std::array<float,2>{0.545263529f, 0.130003318f},
-std::array<float,2>{0.38912499f, 0.261490107f},
-std::array<float,2>{0.915554464f, 0.906360328f},
-std::array<float,2>{0.498796463f, 0.541046083f},
-std::array<float,2>{0.992961586f, 0.116778687f},
-std::array<float,2>{0.0696945041f, 0.421051741f},
-std::array<float,2>{0.599133015f, 0.755014479f},
-std::array<float,2>{0.160011664f, 0.951565862f},
-std::array<float,2>{0.742682993f, 0.314124823f},
-std::array<float,2>{0.330321312f, 0.247849062f},
-std::array<float,2>{0.764914274f, 0.712289572f},
-std::array<float,2>{0.344491065f, 0.876263559f},
-std::array<float,2>{0.789069176f, 0.303189307f},
-std::array<float,2>{0.137388006f, 0.175014153f},
-std::array<float,2>{0.717992902f, 0.665415943f},
-std::array<float,2>{0.115271844f, 0.592021048f},
-std::array<float,2>{0.591348231f, 0.00764473854f},
-std::array<float,2>{0.464192778f, 0.460142106f},
-std::array<float,2>{0.95942384f, 0.826693654f},
-std::array<float,2>{0.407043785f, 0.726062f},
-std::array<float,2>{0.875551999f, 0.187950894f},
-std::array<float,2>{0.0573250875f, 0.360004216f},
-std::array<float,2>{0.515297592f, 0.997237742f},
-std::array<float,2>{0.192661285f, 0.809399307f},
-std::array<float,2>{0.683260143f, 0.379334539f},
-std::array<float,2>{0.288349897f, 0.084517777f},
-std::array<float,2>{0.822392106f, 0.52063936f},
-std::array<float,2>{0.48780179f, 0.85553056f},
-std::array<float,2>{0.991715729f, 0.476235837f},
-std::array<float,2>{0.0741713792f, 0.0320749097f},
-std::array<float,2>{0.60713166f, 0.595448017f},
-std::array<float,2>{0.169029295f, 0.641167283f},
-std::array<float,2>{0.737052262f, 0.146976024f},
-std::array<float,2>{0.339840353f, 0.266768783f},
-std::array<float,2>{0.755417824f, 0.92765379f},
-std::array<float,2>{0.251027614f, 0.55401212f},
-std::array<float,2>{0.845478475f, 0.100361057f},
-std::array<float,2>{0.241030574f, 0.434619516f},
-std::array<float,2>{0.651418924f, 0.76712662f},
-std::array<float,2>{0.00490857707f, 0.956439793f},
-std::array<float,2>{0.535476327f, 0.338140458f},
-std::array<float,2>{0.378405809f, 0.222367659f},
-std::array<float,2>{0.913294494f, 0.700439692f},
-std::array<float,2>{0.401314467f, 0.980499148f},
-std::array<float,2>{0.924976051f, 0.352003604f},
-std::array<float,2>{0.016581336f, 0.208832741f},
-std::array<float,2>{0.546963751f, 0.742421627f},
-std::array<float,2>{0.231952593f, 0.500773072f},
-std::array<float,2>{0.632731557f, 0.0671831593f},
-std::array<float,2>{0.266905904f, 0.401170999f},
-std::array<float,2>{0.864015102f, 0.796385884f},
-std::array<float,2>{0.314932436f, 0.683420181f},
-std::array<float,2>{0.777824163f, 0.165549755f},
-std::array<float,2>{0.185529351f, 0.288823068f},
-std::array<float,2>{0.730883062f, 0.902346253f},
-std::array<float,2>{0.0803073719f, 0.843605042f},
-std::array<float,2>{0.613797426f, 0.449484736f},
-std::array<float,2>{0.482492626f, 0.0212185606f},
-std::array<float,2>{0.981204093f, 0.564525843f},
-std::array<float,2>{0.301216394f, 0.753356874f},
-std::array<float,2>{0.835333645f, 0.417614818f},
-std::array<float,2>{0.21617496f, 0.110351302f},
-std::array<float,2>{0.664170682f, 0.543803751f},
-std::array<float,2>{0.0375427753f, 0.717992485f},
-std::array<float,2>{0.522138238f, 0.244864315f},
-std::array<float,2>{0.423907101f, 0.31893459f},
-std::array<float,2>{0.893023789f, 0.946723998f},
-std::array<float,2>{0.449731976f, 0.615654767f},
-std::array<float,2>{0.947439373f, 0.0619809926f},
-std::array<float,2>{0.100802884f, 0.486174554f},
-std::array<float,2>{0.570840299f, 0.863845348f},
-std::array<float,2>{0.144870147f, 0.912352562f},
-std::array<float,2>{0.700698793f, 0.26519388f},
-std::array<float,2>{0.371416867f, 0.127839535f},
-std::array<float,2>{0.807042599f, 0.640480876f},
-std::array<float,2>{0.273558617f, 0.93941462f},
-std::array<float,2>{0.874338925f, 0.326469392f},
-std::array<float,2>{0.224743605f, 0.240736857f},
-std::array<float,2>{0.635828376f, 0.706792116f},
-std::array<float,2>{0.0280450974f, 0.534747839f},
-std::array<float,2>{0.56157279f, 0.119876646f},
-std::array<float,2>{0.398432314f, 0.410328805f},
-std::array<float,2>{0.936361134f, 0.761825562f},
-std::array<float,2>{0.474892467f, 0.629236817f},
-std::array<float,2>{0.969054401f, 0.135450661f},
-std::array<float,2>{0.0936618f, 0.255324423f},
-std::array<float,2>{0.623985052f, 0.920145571f},
-std::array<float,2>{0.175148606f, 0.869067252f},
-std::array<float,2>{0.720988452f, 0.49368158f},
-std::array<float,2>{0.321470171f, 0.0497196168f},
-std::array<float,2>{0.771281421f, 0.620827198f},
-std::array<float,2>{0.435282886f, 0.782288134f},
-std::array<float,2>{0.900526643f, 0.392124176f},
-std::array<float,2>{0.0421983488f, 0.0762347132f},
-std::array<float,2>{0.530603588f, 0.511634588f},
-std::array<float,2>{0.20463872f, 0.736944139f},
-std::array<float,2>{0.657472908f, 0.212376624f},
-std::array<float,2>{0.309349328f, 0.349530518f},
-std::array<float,2>{0.839122295f, 0.968933523f},
-std::array<float,2>{0.364027053f, 0.57449913f},
-std::array<float,2>{0.80118376f, 0.028207913f},
-std::array<float,2>{0.155212417f, 0.439466774f},
-std::array<float,2>{0.691685319f, 0.828497648f},
-std::array<float,2>{0.107938729f, 0.895601392f},
-std::array<float,2>{0.568076313f, 0.294893861f},
-std::array<float,2>{0.440065622f, 0.160438702f},
-std::array<float,2>{0.944369435f, 0.67875278f},
-std::array<float,2>{0.45453909f, 0.935888946f},
-std::array<float,2>{0.965861559f, 0.275083601f},
-std::array<float,2>{0.123580545f, 0.149619311f},
-std::array<float,2>{0.582222342f, 0.649173439f},
-std::array<float,2>{0.129577756f, 0.604524851f},
-std::array<float,2>{0.705135763f, 0.0436856709f},
-std::array<float,2>{0.353759527f, 0.484055966f},
-std::array<float,2>{0.788340688f, 0.846960306f},
-std::array<float,2>{0.294521987f, 0.687774837f},
-std::array<float,2>{0.817959666f, 0.226600185f},
-std::array<float,2>{0.199148282f, 0.332688689f},
-std::array<float,2>{0.673296392f, 0.963319242f},
-std::array<float,2>{0.0494272225f, 0.776504815f},
-std::array<float,2>{0.505415738f, 0.429234326f},
-std::array<float,2>{0.418301046f, 0.102538809f},
-std::array<float,2>{0.883641601f, 0.559759259f},
-std::array<float,2>{0.332971007f, 0.813578427f},
-std::array<float,2>{0.760308683f, 0.463108718f},
-std::array<float,2>{0.161478356f, 0.0132336598f},
-std::array<float,2>{0.748554885f, 0.585457861f},
-std::array<float,2>{0.0645582825f, 0.656629741f},
-std::array<float,2>{0.595503628f, 0.18102175f},
-std::array<float,2>{0.492434949f, 0.306104124f},
-std::array<float,2>{0.998722076f, 0.88970691f},
-std::array<float,2>{0.384732485f, 0.523574769f},
-std::array<float,2>{0.920970619f, 0.0931977481f},
-std::array<float,2>{0.0108489506f, 0.390402228f},
-std::array<float,2>{0.540328264f, 0.802331388f},
-std::array<float,2>{0.249118984f, 0.990219831f},
-std::array<float,2>{0.643323064f, 0.367871761f},
-std::array<float,2>{0.258717358f, 0.202981487f},
-std::array<float,2>{0.852949381f, 0.729607821f},
-std::array<float,2>{0.271825016f, 0.930669665f},
-std::array<float,2>{0.859828234f, 0.27867803f},
-std::array<float,2>{0.22708492f, 0.153483838f},
-std::array<float,2>{0.625693083f, 0.655706584f},
-std::array<float,2>{0.0196391251f, 0.608740687f},
-std::array<float,2>{0.552469015f, 0.0399469808f},
-std::array<float,2>{0.402534693f, 0.480122298f},
-std::array<float,2>{0.926373363f, 0.848783255f},
-std::array<float,2>{0.479533702f, 0.693022966f},
-std::array<float,2>{0.976727009f, 0.230992228f},
-std::array<float,2>{0.0843927637f, 0.330313027f},
-std::array<float,2>{0.613166213f, 0.966622949f},
-std::array<float,2>{0.180843279f, 0.777551651f},
-std::array<float,2>{0.726654053f, 0.425245136f},
-std::array<float,2>{0.318741471f, 0.107847452f},
-std::array<float,2>{0.773774624f, 0.558189511f},
-std::array<float,2>{0.428208262f, 0.820269525f},
-std::array<float,2>{0.895609915f, 0.465753615f},
-std::array<float,2>{0.0349045433f, 0.00918178167f},
-std::array<float,2>{0.517943382f, 0.578165531f},
-std::array<float,2>{0.214013159f, 0.662916422f},
-std::array<float,2>{0.668627083f, 0.184788302f},
-std::array<float,2>{0.298001587f, 0.309122473f},
-std::array<float,2>{0.830662131f, 0.88577044f},
-std::array<float,2>{0.370910913f, 0.528244078f},
-std::array<float,2>{0.808888257f, 0.0863176957f},
-std::array<float,2>{0.14075619f, 0.385197967f},
-std::array<float,2>{0.699068189f, 0.79917115f},
-std::array<float,2>{0.0963945761f, 0.987670958f},
-std::array<float,2>{0.574867725f, 0.371452659f},
-std::array<float,2>{0.44700104f, 0.196906269f},
-std::array<float,2>{0.951968491f, 0.730737925f},
-std::array<float,2>{0.465929687f, 0.942080677f},
-std::array<float,2>{0.956610739f, 0.321006656f},
-std::array<float,2>{0.112758458f, 0.235960931f},
-std::array<float,2>{0.58616668f, 0.709857464f},
-std::array<float,2>{0.136699155f, 0.538714588f},
-std::array<float,2>{0.711446524f, 0.123916067f},
-std::array<float,2>{0.350383222f, 0.407281578f},
-std::array<float,2>{0.793145478f, 0.760278702f},
-std::array<float,2>{0.282695353f, 0.627695918f},
-std::array<float,2>{0.826398432f, 0.139536142f},
-std::array<float,2>{0.188706741f, 0.250848442f},
-std::array<float,2>{0.684782565f, 0.916834056f},
-std::array<float,2>{0.0591199398f, 0.874029875f},
-std::array<float,2>{0.511319339f, 0.499148011f},
-std::array<float,2>{0.41313532f, 0.0541220605f},
-std::array<float,2>{0.880719244f, 0.62399745f},
-std::array<float,2>{0.342670947f, 0.788913906f},
-std::array<float,2>{0.753845632f, 0.395874947f},
-std::array<float,2>{0.164257526f, 0.0718898177f},
-std::array<float,2>{0.739814699f, 0.514036238f},
-std::array<float,2>{0.0755016729f, 0.74109447f},
-std::array<float,2>{0.604082048f, 0.217036873f},
-std::array<float,2>{0.490656048f, 0.347021401f},
-std::array<float,2>{0.985429823f, 0.973946631f},
-std::array<float,2>{0.380515397f, 0.573570251f},
-std::array<float,2>{0.906448603f, 0.0245713089f},
-std::array<float,2>{7.30695829e-05f, 0.442220569f},
-std::array<float,2>{0.533029795f, 0.832547367f},
-std::array<float,2>{0.23760511f, 0.892318487f},
-std::array<float,2>{0.655469954f, 0.290355653f},
-std::array<float,2>{0.257058561f, 0.157665983f},
-std::array<float,2>{0.851218462f, 0.675379634f},
-std::array<float,2>{0.358154684f, 0.98005408f},
-std::array<float,2>{0.782912314f, 0.357952774f},
-std::array<float,2>{0.128529847f, 0.203724891f},
-std::array<float,2>{0.709341705f, 0.748232961f},
-std::array<float,2>{0.118196927f, 0.50532037f},
-std::array<float,2>{0.580528557f, 0.0634085834f},
-std::array<float,2>{0.458080828f, 0.403285205f},
-std::array<float,2>{0.962398767f, 0.789855123f},
-std::array<float,2>{0.415028036f, 0.6850757f},
-std::array<float,2>{0.889240861f, 0.170128942f},
-std::array<float,2>{0.051434584f, 0.282720536f},
-std::array<float,2>{0.502934992f, 0.902219832f},
-std::array<float,2>{0.200855777f, 0.83929044f},
-std::array<float,2>{0.679682136f, 0.446094096f},
-std::array<float,2>{0.291579545f, 0.0193417426f},
-std::array<float,2>{0.813812256f, 0.56800735f},
-std::array<float,2>{0.49631393f, 0.754575491f},
-std::array<float,2>{0.995908797f, 0.420762032f},
-std::array<float,2>{0.066798225f, 0.115328677f},
-std::array<float,2>{0.599785268f, 0.542292237f},
-std::array<float,2>{0.156951174f, 0.711797297f},
-std::array<float,2>{0.745494246f, 0.246315196f},
-std::array<float,2>{0.329463243f, 0.313434511f},
-std::array<float,2>{0.762899637f, 0.952426136f},
-std::array<float,2>{0.264766961f, 0.61305809f},
-std::array<float,2>{0.855755687f, 0.0552280433f},
-std::array<float,2>{0.245299473f, 0.490873009f},
-std::array<float,2>{0.64540571f, 0.860721409f},
-std::array<float,2>{0.012941381f, 0.907596827f},
-std::array<float,2>{0.544846058f, 0.260274529f},
-std::array<float,2>{0.388623893f, 0.12896508f},
-std::array<float,2>{0.917436361f, 0.634558797f},
-std::array<float,2>{0.390928477f, 0.880402923f},
-std::array<float,2>{0.93216598f, 0.299598664f},
-std::array<float,2>{0.0245831199f, 0.177755103f},
-std::array<float,2>{0.554818749f, 0.671368599f},
-std::array<float,2>{0.21993266f, 0.58863312f},
-std::array<float,2>{0.638454854f, 0.00299098156f},
-std::array<float,2>{0.279921442f, 0.455889523f},
-std::array<float,2>{0.870204806f, 0.821277916f},
-std::array<float,2>{0.32722953f, 0.71954f},
-std::array<float,2>{0.767713964f, 0.19421871f},
-std::array<float,2>{0.177595571f, 0.363826334f},
-std::array<float,2>{0.726183534f, 0.993045568f},
-std::array<float,2>{0.0880703107f, 0.808421791f},
-std::array<float,2>{0.62088877f, 0.378869832f},
-std::array<float,2>{0.469424933f, 0.079874441f},
-std::array<float,2>{0.975178838f, 0.516769528f},
-std::array<float,2>{0.305681437f, 0.854414701f},
-std::array<float,2>{0.841016352f, 0.472142607f},
-std::array<float,2>{0.207765654f, 0.0379941277f},
-std::array<float,2>{0.661964536f, 0.599223971f},
-std::array<float,2>{0.0449233949f, 0.644898415f},
-std::array<float,2>{0.524845898f, 0.141468778f},
-std::array<float,2>{0.432927728f, 0.272377491f},
-std::array<float,2>{0.904058397f, 0.923092902f},
-std::array<float,2>{0.443041831f, 0.548966467f},
-std::array<float,2>{0.93887794f, 0.0961056575f},
-std::array<float,2>{0.10345412f, 0.431814522f},
-std::array<float,2>{0.564071f, 0.771426618f},
-std::array<float,2>{0.151852369f, 0.957143009f},
-std::array<float,2>{0.688533187f, 0.340581775f},
-std::array<float,2>{0.362092435f, 0.225565329f},
-std::array<float,2>{0.797509551f, 0.698189974f},
-std::array<float,2>{0.31313464f, 0.904126585f},
-std::array<float,2>{0.781028867f, 0.287591994f},
-std::array<float,2>{0.18715626f, 0.1647982f},
-std::array<float,2>{0.732536614f, 0.68259728f},
-std::array<float,2>{0.0799423754f, 0.566146731f},
-std::array<float,2>{0.615562022f, 0.0195977669f},
-std::array<float,2>{0.480515778f, 0.450715959f},
-std::array<float,2>{0.984265804f, 0.841930628f},
-std::array<float,2>{0.399112433f, 0.743201911f},
-std::array<float,2>{0.922082305f, 0.207640663f},
-std::array<float,2>{0.0188547f, 0.35294342f},
-std::array<float,2>{0.549319148f, 0.982063174f},
-std::array<float,2>{0.2324882f, 0.795105994f},
-std::array<float,2>{0.629327774f, 0.401504546f},
-std::array<float,2>{0.268413156f, 0.0681509823f},
-std::array<float,2>{0.865647793f, 0.501655042f},
-std::array<float,2>{0.451255798f, 0.864420652f},
-std::array<float,2>{0.946704984f, 0.484520108f},
-std::array<float,2>{0.0990168974f, 0.0607062876f},
-std::array<float,2>{0.572650671f, 0.616993189f},
-std::array<float,2>{0.147231847f, 0.639508247f},
-std::array<float,2>{0.702049196f, 0.128702149f},
-std::array<float,2>{0.374900371f, 0.263715953f},
-std::array<float,2>{0.805423379f, 0.913250923f},
-std::array<float,2>{0.302880853f, 0.544835031f},
-std::array<float,2>{0.83232069f, 0.110356919f},
-std::array<float,2>{0.218377203f, 0.416306704f},
-std::array<float,2>{0.667060554f, 0.752252042f},
-std::array<float,2>{0.035691943f, 0.946184993f},
-std::array<float,2>{0.519577622f, 0.320264935f},
-std::array<float,2>{0.423080653f, 0.245911106f},
-std::array<float,2>{0.892268479f, 0.717051208f},
-std::array<float,2>{0.40959394f, 0.996886909f},
-std::array<float,2>{0.87723428f, 0.361267745f},
-std::array<float,2>{0.0558259301f, 0.18854858f},
-std::array<float,2>{0.513201535f, 0.724735677f},
-std::array<float,2>{0.194324404f, 0.519789696f},
-std::array<float,2>{0.680409193f, 0.085636206f},
-std::array<float,2>{0.286859304f, 0.380726308f},
-std::array<float,2>{0.820693076f, 0.809743881f},
-std::array<float,2>{0.345956743f, 0.664444685f},
-std::array<float,2>{0.792156041f, 0.174479052f},
-std::array<float,2>{0.139919847f, 0.304003477f},
-std::array<float,2>{0.716264904f, 0.875856817f},
-std::array<float,2>{0.113287605f, 0.827765346f},
-std::array<float,2>{0.592234671f, 0.459685951f},
-std::array<float,2>{0.461438566f, 0.00656117266f},
-std::array<float,2>{0.958866894f, 0.593360186f},
-std::array<float,2>{0.252711594f, 0.766414821f},
-std::array<float,2>{0.846689045f, 0.434192568f},
-std::array<float,2>{0.238390416f, 0.101044118f},
-std::array<float,2>{0.649971664f, 0.553195059f},
-std::array<float,2>{0.00639443519f, 0.699976563f},
-std::array<float,2>{0.537776411f, 0.220774904f},
-std::array<float,2>{0.375389457f, 0.339805931f},
-std::array<float,2>{0.9119789f, 0.955148816f},
-std::array<float,2>{0.484714389f, 0.594204128f},
-std::array<float,2>{0.988627315f, 0.0329915956f},
-std::array<float,2>{0.071900785f, 0.475050867f},
-std::array<float,2>{0.607541203f, 0.856509566f},
-std::array<float,2>{0.171492934f, 0.926171184f},
-std::array<float,2>{0.73623538f, 0.265805334f},
-std::array<float,2>{0.335945696f, 0.14769572f},
-std::array<float,2>{0.756580949f, 0.641970456f},
-std::array<float,2>{0.296100825f, 0.964370549f},
-std::array<float,2>{0.819796622f, 0.333841264f},
-std::array<float,2>{0.197022423f, 0.227630258f},
-std::array<float,2>{0.67416662f, 0.688741803f},
-std::array<float,2>{0.0470773019f, 0.558752298f},
-std::array<float,2>{0.507652342f, 0.102667511f},
-std::array<float,2>{0.421798259f, 0.428082943f},
-std::array<float,2>{0.884841859f, 0.776183903f},
-std::array<float,2>{0.455748856f, 0.649700105f},
-std::array<float,2>{0.968329608f, 0.148758069f},
-std::array<float,2>{0.121099882f, 0.27345559f},
-std::array<float,2>{0.584941447f, 0.937218845f},
-std::array<float,2>{0.131442949f, 0.846464932f},
-std::array<float,2>{0.70396477f, 0.483301163f},
-std::array<float,2>{0.353511393f, 0.044789657f},
-std::array<float,2>{0.786768675f, 0.604479373f},
-std::array<float,2>{0.38490504f, 0.801413774f},
-std::array<float,2>{0.918637276f, 0.389026552f},
-std::array<float,2>{0.00894451328f, 0.0919863209f},
-std::array<float,2>{0.541645646f, 0.525107086f},
-std::array<float,2>{0.246962339f, 0.729192078f},
-std::array<float,2>{0.641458511f, 0.20163314f},
-std::array<float,2>{0.260586917f, 0.368556082f},
-std::array<float,2>{0.854541242f, 0.988718867f},
-std::array<float,2>{0.334101468f, 0.584389806f},
-std::array<float,2>{0.759094954f, 0.0120956888f},
-std::array<float,2>{0.162317067f, 0.464478165f},
-std::array<float,2>{0.747660637f, 0.813148141f},
-std::array<float,2>{0.0638475865f, 0.889190316f},
-std::array<float,2>{0.596915841f, 0.304902256f},
-std::array<float,2>{0.49467665f, 0.179819241f},
-std::array<float,2>{0.997288883f, 0.658026397f},
-std::array<float,2>{0.473282933f, 0.921798348f},
-std::array<float,2>{0.972013116f, 0.254205644f},
-std::array<float,2>{0.0907276794f, 0.136440724f},
-std::array<float,2>{0.621336877f, 0.62988919f},
-std::array<float,2>{0.173104376f, 0.619458318f},
-std::array<float,2>{0.719497502f, 0.0498677678f},
-std::array<float,2>{0.322733611f, 0.492803007f},
-std::array<float,2>{0.772556484f, 0.867902398f},
-std::array<float,2>{0.276446432f, 0.705601573f},
-std::array<float,2>{0.871610045f, 0.241871521f},
-std::array<float,2>{0.223549709f, 0.327566236f},
-std::array<float,2>{0.634029448f, 0.938347697f},
-std::array<float,2>{0.0295717828f, 0.76325798f},
-std::array<float,2>{0.559322655f, 0.412038088f},
-std::array<float,2>{0.394760281f, 0.120146833f},
-std::array<float,2>{0.933769524f, 0.533445656f},
-std::array<float,2>{0.365514934f, 0.829606175f},
-std::array<float,2>{0.802870989f, 0.441108078f},
-std::array<float,2>{0.152432278f, 0.0288977679f},
-std::array<float,2>{0.694668472f, 0.575839996f},
-std::array<float,2>{0.107216723f, 0.678297698f},
-std::array<float,2>{0.568392098f, 0.161334842f},
-std::array<float,2>{0.43932119f, 0.29322803f},
-std::array<float,2>{0.942881644f, 0.894926369f},
-std::array<float,2>{0.435706615f, 0.510428846f},
-std::array<float,2>{0.899904013f, 0.077548191f},
-std::array<float,2>{0.0409896635f, 0.390918165f},
-std::array<float,2>{0.528318584f, 0.78149128f},
-std::array<float,2>{0.205731183f, 0.969744384f},
-std::array<float,2>{0.659253418f, 0.348191798f},
-std::array<float,2>{0.310587645f, 0.211396635f},
-std::array<float,2>{0.83600527f, 0.738091588f},
-std::array<float,2>{0.30054304f, 0.883317053f},
-std::array<float,2>{0.829298615f, 0.310901165f},
-std::array<float,2>{0.212544009f, 0.187352061f},
-std::array<float,2>{0.670901775f, 0.660917401f},
-std::array<float,2>{0.03128203f, 0.580435991f},
-std::array<float,2>{0.516811371f, 0.0105757052f},
-std::array<float,2>{0.426439613f, 0.466837525f},
-std::array<float,2>{0.898355484f, 0.816897929f},
-std::array<float,2>{0.448885232f, 0.732989728f},
-std::array<float,2>{0.94961673f, 0.19735238f},
-std::array<float,2>{0.0945864767f, 0.374900341f},
-std::array<float,2>{0.577726066f, 0.984891355f},
-std::array<float,2>{0.143171459f, 0.798725307f},
-std::array<float,2>{0.696654916f, 0.383188128f},
-std::array<float,2>{0.367451638f, 0.0879182592f},
-std::array<float,2>{0.812050581f, 0.530291259f},
-std::array<float,2>{0.405843943f, 0.850906789f},
-std::array<float,2>{0.929577529f, 0.477373362f},
-std::array<float,2>{0.0216579903f, 0.042261757f},
-std::array<float,2>{0.554610431f, 0.607334077f},
-std::array<float,2>{0.228921354f, 0.652397275f},
-std::array<float,2>{0.627758205f, 0.155895367f},
-std::array<float,2>{0.270840019f, 0.279689878f},
-std::array<float,2>{0.86304301f, 0.932596207f},
-std::array<float,2>{0.318032324f, 0.555220425f},
-std::array<float,2>{0.775688291f, 0.106164776f},
-std::array<float,2>{0.18223691f, 0.423821777f},
-std::array<float,2>{0.728732765f, 0.780562758f},
-std::array<float,2>{0.0829116106f, 0.967990458f},
-std::array<float,2>{0.610229731f, 0.329981387f},
-std::array<float,2>{0.478360295f, 0.233709529f},
-std::array<float,2>{0.97870791f, 0.694017351f},
-std::array<float,2>{0.488782883f, 0.975618601f},
-std::array<float,2>{0.986594617f, 0.345093369f},
-std::array<float,2>{0.0765382051f, 0.216401294f},
-std::array<float,2>{0.601992071f, 0.739028811f},
-std::array<float,2>{0.167479008f, 0.512006342f},
-std::array<float,2>{0.740383983f, 0.07249365f},
-std::array<float,2>{0.341477334f, 0.397557527f},
-std::array<float,2>{0.751951575f, 0.786460578f},
-std::array<float,2>{0.25477317f, 0.673284948f},
-std::array<float,2>{0.848418832f, 0.160132378f},
-std::array<float,2>{0.235794634f, 0.291354716f},
-std::array<float,2>{0.654082477f, 0.893734097f},
-std::array<float,2>{0.00296875997f, 0.83490026f},
-std::array<float,2>{0.534069896f, 0.443654805f},
-std::array<float,2>{0.382041842f, 0.0268183816f},
-std::array<float,2>{0.909350574f, 0.570658267f},
-std::array<float,2>{0.348245382f, 0.758159101f},
-std::array<float,2>{0.796094775f, 0.409894824f},
-std::array<float,2>{0.133864298f, 0.122763351f},
-std::array<float,2>{0.714604676f, 0.537037015f},
-std::array<float,2>{0.11083705f, 0.708604991f},
-std::array<float,2>{0.589103162f, 0.236434117f},
-std::array<float,2>{0.468509525f, 0.322553396f},
-std::array<float,2>{0.953658104f, 0.944598854f},
-std::array<float,2>{0.411226749f, 0.622450888f},
-std::array<float,2>{0.882124364f, 0.0510317795f},
-std::array<float,2>{0.0614339337f, 0.497482032f},
-std::array<float,2>{0.509655058f, 0.871253371f},
-std::array<float,2>{0.190679178f, 0.914204359f},
-std::array<float,2>{0.68698889f, 0.252849072f},
-std::array<float,2>{0.284401983f, 0.137453169f},
-std::array<float,2>{0.825826406f, 0.626204431f},
-std::array<float,2>{0.331058562f, 0.94945699f},
-std::array<float,2>{0.764191985f, 0.315004587f},
-std::array<float,2>{0.158701673f, 0.24893105f},
-std::array<float,2>{0.743822694f, 0.714079559f},
-std::array<float,2>{0.0689406022f, 0.540226221f},
-std::array<float,2>{0.59803611f, 0.113623373f},
-std::array<float,2>{0.499514014f, 0.41951713f},
-std::array<float,2>{0.993481934f, 0.757711709f},
-std::array<float,2>{0.389726728f, 0.635256112f},
-std::array<float,2>{0.914210498f, 0.13174732f},
-std::array<float,2>{0.0149424151f, 0.259652346f},
-std::array<float,2>{0.546577394f, 0.909149408f},
-std::array<float,2>{0.242606536f, 0.862208962f},
-std::array<float,2>{0.646896601f, 0.489761144f},
-std::array<float,2>{0.262861997f, 0.0584741309f},
-std::array<float,2>{0.857750833f, 0.609826505f},
-std::array<float,2>{0.459931731f, 0.792066336f},
-std::array<float,2>{0.963384449f, 0.404899329f},
-std::array<float,2>{0.119671352f, 0.0658480227f},
-std::array<float,2>{0.578565001f, 0.507266581f},
-std::array<float,2>{0.126096696f, 0.747568011f},
-std::array<float,2>{0.708742976f, 0.206747144f},
-std::array<float,2>{0.35730046f, 0.357308358f},
-std::array<float,2>{0.784957588f, 0.977173924f},
-std::array<float,2>{0.290109336f, 0.569011092f},
-std::array<float,2>{0.814682007f, 0.0171444975f},
-std::array<float,2>{0.202017188f, 0.447720528f},
-std::array<float,2>{0.677406907f, 0.836279571f},
-std::array<float,2>{0.0529998504f, 0.899791956f},
-std::array<float,2>{0.501176417f, 0.284030527f},
-std::array<float,2>{0.416959614f, 0.169724852f},
-std::array<float,2>{0.888244271f, 0.685964048f},
-std::array<float,2>{0.43077898f, 0.924439847f},
-std::array<float,2>{0.905588627f, 0.271321326f},
-std::array<float,2>{0.0431245193f, 0.142750278f},
-std::array<float,2>{0.526211023f, 0.646823287f},
-std::array<float,2>{0.21004881f, 0.601333261f},
-std::array<float,2>{0.662127078f, 0.0369957052f},
-std::array<float,2>{0.306684315f, 0.469820052f},
-std::array<float,2>{0.842440367f, 0.852452636f},
-std::array<float,2>{0.359754473f, 0.696575522f},
-std::array<float,2>{0.799606383f, 0.224301741f},
-std::array<float,2>{0.149243042f, 0.342466533f},
-std::array<float,2>{0.690948308f, 0.959010184f},
-std::array<float,2>{0.104929827f, 0.77335149f},
-std::array<float,2>{0.565039515f, 0.430453539f},
-std::array<float,2>{0.443669021f, 0.0938529447f},
-std::array<float,2>{0.940666616f, 0.54701966f},
-std::array<float,2>{0.278121024f, 0.822634041f},
-std::array<float,2>{0.86835736f, 0.453325778f},
-std::array<float,2>{0.222092286f, 0.00110195787f},
-std::array<float,2>{0.640408218f, 0.587715447f},
-std::array<float,2>{0.0254416596f, 0.669415832f},
-std::array<float,2>{0.557550013f, 0.177430913f},
-std::array<float,2>{0.393397063f, 0.297477037f},
-std::array<float,2>{0.930232048f, 0.882515371f},
-std::array<float,2>{0.472361982f, 0.517776966f},
-std::array<float,2>{0.973456323f, 0.0804532096f},
-std::array<float,2>{0.0868612751f, 0.376549929f},
-std::array<float,2>{0.618314743f, 0.805793166f},
-std::array<float,2>{0.179012477f, 0.994492352f},
-std::array<float,2>{0.723304093f, 0.366883904f},
-std::array<float,2>{0.325967282f, 0.191408485f},
-std::array<float,2>{0.766797781f, 0.7215361f},
-std::array<float,2>{0.372319162f, 0.911215127f},
-std::array<float,2>{0.807887256f, 0.261888951f},
-std::array<float,2>{0.146152809f, 0.126484424f},
-std::array<float,2>{0.699739099f, 0.637004733f},
-std::array<float,2>{0.0999950022f, 0.61418128f},
-std::array<float,2>{0.572076321f, 0.0603459589f},
-std::array<float,2>{0.450654715f, 0.48777613f},
-std::array<float,2>{0.948896527f, 0.866985977f},
-std::array<float,2>{0.425238341f, 0.715793252f},
-std::array<float,2>{0.894090533f, 0.242351696f},
-std::array<float,2>{0.0390159376f, 0.316473603f},
-std::array<float,2>{0.522536218f, 0.94852978f},
-std::array<float,2>{0.215030625f, 0.75130856f},
-std::array<float,2>{0.6653983f, 0.415257126f},
-std::array<float,2>{0.302338898f, 0.111583285f},
-std::array<float,2>{0.8346048f, 0.545813441f},
-std::array<float,2>{0.484338969f, 0.840999067f},
-std::array<float,2>{0.981620252f, 0.451482922f},
-std::array<float,2>{0.0812324509f, 0.0233929735f},
-std::array<float,2>{0.614323735f, 0.562923014f},
-std::array<float,2>{0.183962062f, 0.680380881f},
-std::array<float,2>{0.732193649f, 0.167262569f},
-std::array<float,2>{0.315572828f, 0.286491573f},
-std::array<float,2>{0.778691173f, 0.90587312f},
-std::array<float,2>{0.265945643f, 0.50209415f},
-std::array<float,2>{0.864929497f, 0.0692230314f},
-std::array<float,2>{0.230971619f, 0.39980033f},
-std::array<float,2>{0.631430984f, 0.793102682f},
-std::array<float,2>{0.0173650756f, 0.983220637f},
-std::array<float,2>{0.54840219f, 0.354990959f},
-std::array<float,2>{0.401418597f, 0.210152745f},
-std::array<float,2>{0.92437011f, 0.744311452f},
-std::array<float,2>{0.377121896f, 0.953384221f},
-std::array<float,2>{0.913006961f, 0.337829709f},
-std::array<float,2>{0.00418925472f, 0.2201377f},
-std::array<float,2>{0.536889195f, 0.702663958f},
-std::array<float,2>{0.242136672f, 0.551210642f},
-std::array<float,2>{0.650654316f, 0.0989108607f},
-std::array<float,2>{0.250604838f, 0.436032921f},
-std::array<float,2>{0.84439075f, 0.768904567f},
-std::array<float,2>{0.337952524f, 0.643503428f},
-std::array<float,2>{0.754832327f, 0.145997778f},
-std::array<float,2>{0.168401957f, 0.269148707f},
-std::array<float,2>{0.737501502f, 0.929113925f},
-std::array<float,2>{0.0730551109f, 0.858729064f},
-std::array<float,2>{0.60642314f, 0.474352509f},
-std::array<float,2>{0.486666977f, 0.0332288854f},
-std::array<float,2>{0.990801215f, 0.596007049f},
-std::array<float,2>{0.287875295f, 0.810949802f},
-std::array<float,2>{0.824154079f, 0.382182539f},
-std::array<float,2>{0.192047626f, 0.0838193893f},
-std::array<float,2>{0.681936383f, 0.522111297f},
-std::array<float,2>{0.0577565059f, 0.722668469f},
-std::array<float,2>{0.5137344f, 0.189917982f},
-std::array<float,2>{0.407907575f, 0.362664968f},
-std::array<float,2>{0.876860797f, 0.999651551f},
-std::array<float,2>{0.46315217f, 0.591273785f},
-std::array<float,2>{0.960853815f, 0.00557864504f},
-std::array<float,2>{0.116576806f, 0.457729429f},
-std::array<float,2>{0.590759635f, 0.826068759f},
-std::array<float,2>{0.13824746f, 0.877090693f},
-std::array<float,2>{0.717307806f, 0.301429659f},
-std::array<float,2>{0.34473145f, 0.171899229f},
-std::array<float,2>{0.790715814f, 0.667008698f},
-std::array<float,2>{0.259004533f, 0.990358353f},
-std::array<float,2>{0.851897001f, 0.369689435f},
-std::array<float,2>{0.24890174f, 0.199545711f},
-std::array<float,2>{0.644469202f, 0.727038264f},
-std::array<float,2>{0.010543758f, 0.525571287f},
-std::array<float,2>{0.539523661f, 0.0908163264f},
-std::array<float,2>{0.383417964f, 0.387060285f},
-std::array<float,2>{0.920181572f, 0.803476453f},
-std::array<float,2>{0.493186772f, 0.659215808f},
-std::array<float,2>{0.999306202f, 0.18298471f},
-std::array<float,2>{0.0657601431f, 0.307717025f},
-std::array<float,2>{0.594421625f, 0.887784839f},
-std::array<float,2>{0.16105561f, 0.814931691f},
-std::array<float,2>{0.749188781f, 0.461809516f},
-std::array<float,2>{0.333572537f, 0.0138153275f},
-std::array<float,2>{0.760960519f, 0.582836747f},
-std::array<float,2>{0.419123769f, 0.774577677f},
-std::array<float,2>{0.884248853f, 0.426687717f},
-std::array<float,2>{0.0501394458f, 0.105011292f},
-std::array<float,2>{0.50433147f, 0.560927927f},
-std::array<float,2>{0.19769077f, 0.689528525f},
-std::array<float,2>{0.672299325f, 0.230030358f},
-std::array<float,2>{0.293518841f, 0.335269064f},
-std::array<float,2>{0.816412449f, 0.96238488f},
-std::array<float,2>{0.354776084f, 0.602614224f},
-std::array<float,2>{0.787516117f, 0.0449735858f},
-std::array<float,2>{0.130400747f, 0.481976986f},
-std::array<float,2>{0.706438959f, 0.844940543f},
-std::array<float,2>{0.12492609f, 0.933732748f},
-std::array<float,2>{0.583340764f, 0.276152045f},
-std::array<float,2>{0.453498304f, 0.150973544f},
-std::array<float,2>{0.965478599f, 0.651033461f},
-std::array<float,2>{0.44122383f, 0.898239911f},
-std::array<float,2>{0.944164634f, 0.29600966f},
-std::array<float,2>{0.109308511f, 0.163555399f},
-std::array<float,2>{0.567296147f, 0.677555501f},
-std::array<float,2>{0.155516848f, 0.577832341f},
-std::array<float,2>{0.693333089f, 0.0308422446f},
-std::array<float,2>{0.364739656f, 0.438623458f},
-std::array<float,2>{0.802066445f, 0.83083111f},
-std::array<float,2>{0.309853584f, 0.735755086f},
-std::array<float,2>{0.838723898f, 0.21418795f},
-std::array<float,2>{0.203232676f, 0.35148856f},
-std::array<float,2>{0.65685606f, 0.97249645f},
-std::array<float,2>{0.0410478413f, 0.783879161f},
-std::array<float,2>{0.529506087f, 0.393256009f},
-std::array<float,2>{0.434290111f, 0.0758748949f},
-std::array<float,2>{0.901681304f, 0.509534061f},
-std::array<float,2>{0.321235448f, 0.86927259f},
-std::array<float,2>{0.770426035f, 0.495759249f},
-std::array<float,2>{0.174312159f, 0.04852641f},
-std::array<float,2>{0.722626805f, 0.617465317f},
-std::array<float,2>{0.091801472f, 0.632076204f},
-std::array<float,2>{0.624908149f, 0.133037731f},
-std::array<float,2>{0.476196736f, 0.256875604f},
-std::array<float,2>{0.969796836f, 0.919278502f},
-std::array<float,2>{0.396892428f, 0.531300604f},
-std::array<float,2>{0.936860859f, 0.117756441f},
-std::array<float,2>{0.0283988249f, 0.413857162f},
-std::array<float,2>{0.560641348f, 0.764574587f},
-std::array<float,2>{0.225882992f, 0.939504266f},
-std::array<float,2>{0.634829342f, 0.324646413f},
-std::array<float,2>{0.275062352f, 0.239936396f},
-std::array<float,2>{0.87379384f, 0.704085708f},
-std::array<float,2>{0.261491358f, 0.888068736f},
-std::array<float,2>{0.853894889f, 0.307939619f},
-std::array<float,2>{0.247178286f, 0.18283394f},
-std::array<float,2>{0.642228186f, 0.659610927f},
-std::array<float,2>{0.00824502576f, 0.582604289f},
-std::array<float,2>{0.542075276f, 0.0139619671f},
-std::array<float,2>{0.385921717f, 0.461439878f},
-std::array<float,2>{0.919127941f, 0.814541519f},
-std::array<float,2>{0.495622605f, 0.726635754f},
-std::array<float,2>{0.996378362f, 0.19936417f},
-std::array<float,2>{0.06260892f, 0.370024204f},
-std::array<float,2>{0.596431673f, 0.990500271f},
-std::array<float,2>{0.163659334f, 0.803362787f},
-std::array<float,2>{0.746491671f, 0.386721522f},
-std::array<float,2>{0.335495353f, 0.0903425664f},
-std::array<float,2>{0.758095086f, 0.525760293f},
-std::array<float,2>{0.420022279f, 0.84513694f},
-std::array<float,2>{0.886692584f, 0.482313275f},
-std::array<float,2>{0.0486639589f, 0.0452436097f},
-std::array<float,2>{0.5066728f, 0.602924585f},
-std::array<float,2>{0.196060747f, 0.651133001f},
-std::array<float,2>{0.675633848f, 0.151167989f},
-std::array<float,2>{0.29504177f, 0.276059568f},
-std::array<float,2>{0.818403244f, 0.933963478f},
-std::array<float,2>{0.351832956f, 0.560782313f},
-std::array<float,2>{0.78606689f, 0.105400503f},
-std::array<float,2>{0.132356703f, 0.426463217f},
-std::array<float,2>{0.704188824f, 0.774802089f},
-std::array<float,2>{0.122941874f, 0.96195215f},
-std::array<float,2>{0.585317135f, 0.33513236f},
-std::array<float,2>{0.456168801f, 0.230320707f},
-std::array<float,2>{0.966829896f, 0.689697623f},
-std::array<float,2>{0.438070804f, 0.972350895f},
-std::array<float,2>{0.941977501f, 0.351216197f},
-std::array<float,2>{0.105659701f, 0.213934988f},
-std::array<float,2>{0.569555879f, 0.735481024f},
-std::array<float,2>{0.153845936f, 0.509385407f},
-std::array<float,2>{0.694237113f, 0.0760369748f},
-std::array<float,2>{0.367182106f, 0.393314749f},
-std::array<float,2>{0.804429233f, 0.783984423f},
-std::array<float,2>{0.312375933f, 0.67731005f},
-std::array<float,2>{0.837426364f, 0.163185865f},
-std::array<float,2>{0.207016081f, 0.296283394f},
-std::array<float,2>{0.658575714f, 0.898058653f},
-std::array<float,2>{0.0392363481f, 0.830664396f},
-std::array<float,2>{0.528432012f, 0.438753694f},
-std::array<float,2>{0.43675229f, 0.0312151331f},
-std::array<float,2>{0.899199486f, 0.578027606f},
-std::array<float,2>{0.323927164f, 0.764205635f},
-std::array<float,2>{0.771929801f, 0.413709491f},
-std::array<float,2>{0.172619417f, 0.118128806f},
-std::array<float,2>{0.719958723f, 0.531680644f},
-std::array<float,2>{0.0917176828f, 0.703642726f},
-std::array<float,2>{0.622150719f, 0.240139335f},
-std::array<float,2>{0.474513292f, 0.324255675f},
-std::array<float,2>{0.970990539f, 0.939735115f},
-std::array<float,2>{0.396109909f, 0.617406666f},
-std::array<float,2>{0.935400903f, 0.0486701503f},
-std::array<float,2>{0.0305364281f, 0.496084332f},
-std::array<float,2>{0.559892476f, 0.869395435f},
-std::array<float,2>{0.224499449f, 0.918960512f},
-std::array<float,2>{0.633388758f, 0.257179886f},
-std::array<float,2>{0.275397211f, 0.133170426f},
-std::array<float,2>{0.87292701f, 0.632173657f},
-std::array<float,2>{0.3733702f, 0.948366463f},
-std::array<float,2>{0.805693269f, 0.316750467f},
-std::array<float,2>{0.148330525f, 0.242491513f},
-std::array<float,2>{0.702683568f, 0.715561807f},
-std::array<float,2>{0.0984321758f, 0.545474648f},
-std::array<float,2>{0.573696434f, 0.111389466f},
-std::array<float,2>{0.452438533f, 0.4154571f},
-std::array<float,2>{0.945814431f, 0.751139998f},
-std::array<float,2>{0.421981364f, 0.636803865f},
-std::array<float,2>{0.890718699f, 0.126886576f},
-std::array<float,2>{0.0369495191f, 0.262071669f},
-std::array<float,2>{0.521223009f, 0.911377609f},
-std::array<float,2>{0.217584267f, 0.866902649f},
-std::array<float,2>{0.666049778f, 0.487521559f},
-std::array<float,2>{0.304619223f, 0.060188096f},
-std::array<float,2>{0.833881855f, 0.613962293f},
-std::array<float,2>{0.481885463f, 0.793215692f},
-std::array<float,2>{0.983220816f, 0.399569631f},
-std::array<float,2>{0.078370288f, 0.0689995363f},
-std::array<float,2>{0.617142558f, 0.502304316f},
-std::array<float,2>{0.185995728f, 0.744464993f},
-std::array<float,2>{0.733905554f, 0.210247293f},
-std::array<float,2>{0.314198703f, 0.355420709f},
-std::array<float,2>{0.779914916f, 0.982930243f},
-std::array<float,2>{0.269003421f, 0.562680006f},
-std::array<float,2>{0.867008686f, 0.0230884533f},
-std::array<float,2>{0.23410219f, 0.451369673f},
-std::array<float,2>{0.630274177f, 0.84123534f},
-std::array<float,2>{0.0185223632f, 0.906022012f},
-std::array<float,2>{0.550077915f, 0.286371678f},
-std::array<float,2>{0.399909943f, 0.167058051f},
-std::array<float,2>{0.923341334f, 0.680607677f},
-std::array<float,2>{0.376074672f, 0.928738654f},
-std::array<float,2>{0.910194933f, 0.269442141f},
-std::array<float,2>{0.00751756132f, 0.146300912f},
-std::array<float,2>{0.538588226f, 0.643204868f},
-std::array<float,2>{0.239667326f, 0.595819116f},
-std::array<float,2>{0.649223864f, 0.0335836485f},
-std::array<float,2>{0.253630072f, 0.474468321f},
-std::array<float,2>{0.846048772f, 0.858422697f},
-std::array<float,2>{0.337332636f, 0.70308727f},
-std::array<float,2>{0.756967664f, 0.219810873f},
-std::array<float,2>{0.169943348f, 0.337446362f},
-std::array<float,2>{0.734805763f, 0.953181326f},
-std::array<float,2>{0.0712655708f, 0.768787801f},
-std::array<float,2>{0.609097838f, 0.435577571f},
-std::array<float,2>{0.48552829f, 0.0988757238f},
-std::array<float,2>{0.989318311f, 0.550962925f},
-std::array<float,2>{0.285237253f, 0.825791478f},
-std::array<float,2>{0.821552634f, 0.457856953f},
-std::array<float,2>{0.194562092f, 0.00576953823f},
-std::array<float,2>{0.681439817f, 0.590957701f},
-std::array<float,2>{0.0550534055f, 0.667320907f},
-std::array<float,2>{0.51210165f, 0.172132909f},
-std::array<float,2>{0.40882358f, 0.301676661f},
-std::array<float,2>{0.877964258f, 0.877374649f},
-std::array<float,2>{0.462601006f, 0.522421658f},
-std::array<float,2>{0.95790273f, 0.0836489871f},
-std::array<float,2>{0.115184464f, 0.381937772f},
-std::array<float,2>{0.593399167f, 0.810669124f},
-std::array<float,2>{0.139017537f, 0.999851942f},
-std::array<float,2>{0.715316653f, 0.362365782f},
-std::array<float,2>{0.34742412f, 0.189608991f},
-std::array<float,2>{0.791401744f, 0.72292918f},
-std::array<float,2>{0.329002917f, 0.908877075f},
-std::array<float,2>{0.761854351f, 0.259487212f},
-std::array<float,2>{0.157708809f, 0.131585687f},
-std::array<float,2>{0.744970322f, 0.635540664f},
-std::array<float,2>{0.0681734532f, 0.609405637f},
-std::array<float,2>{0.600693703f, 0.058183305f},
-std::array<float,2>{0.497908473f, 0.490136713f},
-std::array<float,2>{0.994807601f, 0.861975074f},
-std::array<float,2>{0.386876464f, 0.714142621f},
-std::array<float,2>{0.916581273f, 0.24874264f},
-std::array<float,2>{0.012368693f, 0.315380245f},
-std::array<float,2>{0.543455005f, 0.949471831f},
-std::array<float,2>{0.244760737f, 0.757470489f},
-std::array<float,2>{0.645670295f, 0.419700712f},
-std::array<float,2>{0.264318168f, 0.113376603f},
-std::array<float,2>{0.856707633f, 0.540364385f},
-std::array<float,2>{0.457781166f, 0.836027205f},
-std::array<float,2>{0.961170375f, 0.447403818f},
-std::array<float,2>{0.117296502f, 0.0175033621f},
-std::array<float,2>{0.581128776f, 0.569246292f},
-std::array<float,2>{0.12745887f, 0.685653746f},
-std::array<float,2>{0.710126638f, 0.169624329f},
-std::array<float,2>{0.358800024f, 0.283850551f},
-std::array<float,2>{0.781540096f, 0.899426222f},
-std::array<float,2>{0.292545527f, 0.506856024f},
-std::array<float,2>{0.813171387f, 0.0654905662f},
-std::array<float,2>{0.200049475f, 0.405088693f},
-std::array<float,2>{0.67779541f, 0.792477012f},
-std::array<float,2>{0.0520088971f, 0.977456868f},
-std::array<float,2>{0.502912343f, 0.356970012f},
-std::array<float,2>{0.41513598f, 0.206983835f},
-std::array<float,2>{0.889657557f, 0.747898817f},
-std::array<float,2>{0.431653768f, 0.959435999f},
-std::array<float,2>{0.90264219f, 0.342673421f},
-std::array<float,2>{0.0467449985f, 0.224403769f},
-std::array<float,2>{0.524387062f, 0.696475327f},
-std::array<float,2>{0.208313093f, 0.547323883f},
-std::array<float,2>{0.660213649f, 0.0941058248f},
-std::array<float,2>{0.305092007f, 0.430250019f},
-std::array<float,2>{0.840197444f, 0.773141623f},
-std::array<float,2>{0.363173366f, 0.646668017f},
-std::array<float,2>{0.798794925f, 0.142835096f},
-std::array<float,2>{0.151201442f, 0.27103579f},
-std::array<float,2>{0.687575459f, 0.924671233f},
-std::array<float,2>{0.101824559f, 0.852059364f},
-std::array<float,2>{0.563283682f, 0.470039636f},
-std::array<float,2>{0.44172737f, 0.0368403383f},
-std::array<float,2>{0.937514365f, 0.601184547f},
-std::array<float,2>{0.280775219f, 0.806023002f},
-std::array<float,2>{0.870053351f, 0.376881897f},
-std::array<float,2>{0.219543636f, 0.0801369324f},
-std::array<float,2>{0.637623131f, 0.518066049f},
-std::array<float,2>{0.0240776949f, 0.721286595f},
-std::array<float,2>{0.556023479f, 0.191782609f},
-std::array<float,2>{0.391736835f, 0.367141336f},
-std::array<float,2>{0.932850242f, 0.994263172f},
-std::array<float,2>{0.470349461f, 0.587601244f},
-std::array<float,2>{0.975946009f, 0.0013605213f},
-std::array<float,2>{0.0893827677f, 0.453486294f},
-std::array<float,2>{0.619643867f, 0.822405338f},
-std::array<float,2>{0.17636165f, 0.882672071f},
-std::array<float,2>{0.724880397f, 0.29761678f},
-std::array<float,2>{0.326632291f, 0.177531973f},
-std::array<float,2>{0.769373357f, 0.668956757f},
-std::array<float,2>{0.297098309f, 0.985117793f},
-std::array<float,2>{0.831578135f, 0.374515861f},
-std::array<float,2>{0.213076726f, 0.19769752f},
-std::array<float,2>{0.669571042f, 0.733286619f},
-std::array<float,2>{0.0335259438f, 0.530715823f},
-std::array<float,2>{0.519505441f, 0.0883039832f},
-std::array<float,2>{0.429344326f, 0.382999271f},
-std::array<float,2>{0.895194829f, 0.798562109f},
-std::array<float,2>{0.445358813f, 0.66076988f},
-std::array<float,2>{0.952991307f, 0.187072381f},
-std::array<float,2>{0.0976526439f, 0.310706556f},
-std::array<float,2>{0.575311363f, 0.883602977f},
-std::array<float,2>{0.14165251f, 0.817293286f},
-std::array<float,2>{0.697959125f, 0.467134297f},
-std::array<float,2>{0.369143307f, 0.0103200423f},
-std::array<float,2>{0.810153902f, 0.580197275f},
-std::array<float,2>{0.403913528f, 0.780452013f},
-std::array<float,2>{0.927040756f, 0.423462659f},
-std::array<float,2>{0.0212459434f, 0.106210276f},
-std::array<float,2>{0.551069319f, 0.555499077f},
-std::array<float,2>{0.228370681f, 0.694335043f},
-std::array<float,2>{0.626078784f, 0.233531833f},
-std::array<float,2>{0.273069173f, 0.329699188f},
-std::array<float,2>{0.860954583f, 0.968252659f},
-std::array<float,2>{0.319966257f, 0.607018709f},
-std::array<float,2>{0.77469629f, 0.042001117f},
-std::array<float,2>{0.180137917f, 0.477211505f},
-std::array<float,2>{0.727571785f, 0.850716352f},
-std::array<float,2>{0.0854490846f, 0.932186306f},
-std::array<float,2>{0.6122697f, 0.279516131f},
-std::array<float,2>{0.479269981f, 0.156140074f},
-std::array<float,2>{0.977923572f, 0.652596772f},
-std::array<float,2>{0.491643459f, 0.893972039f},
-std::array<float,2>{0.985159099f, 0.29115656f},
-std::array<float,2>{0.0746254921f, 0.159839168f},
-std::array<float,2>{0.604967952f, 0.672894001f},
-std::array<float,2>{0.165357202f, 0.570490003f},
-std::array<float,2>{0.739121795f, 0.0263839923f},
-std::array<float,2>{0.343162596f, 0.443502814f},
-std::array<float,2>{0.752840936f, 0.834606946f},
-std::array<float,2>{0.255987793f, 0.738863885f},
-std::array<float,2>{0.84967649f, 0.216627687f},
-std::array<float,2>{0.237272307f, 0.344767749f},
-std::array<float,2>{0.654678464f, 0.975923896f},
-std::array<float,2>{0.00161232322f, 0.786176026f},
-std::array<float,2>{0.531842828f, 0.39791128f},
-std::array<float,2>{0.379422396f, 0.0726022199f},
-std::array<float,2>{0.90803051f, 0.51191318f},
-std::array<float,2>{0.350966066f, 0.871491313f},
-std::array<float,2>{0.794016421f, 0.49714011f},
-std::array<float,2>{0.1352887f, 0.050872393f},
-std::array<float,2>{0.712371111f, 0.6222049f},
-std::array<float,2>{0.112280503f, 0.62642765f},
-std::array<float,2>{0.587298095f, 0.137359381f},
-std::array<float,2>{0.465451509f, 0.252655834f},
-std::array<float,2>{0.955766082f, 0.914428651f},
-std::array<float,2>{0.412378818f, 0.536861658f},
-std::array<float,2>{0.879288971f, 0.122992694f},
-std::array<float,2>{0.0598409288f, 0.409917444f},
-std::array<float,2>{0.51026088f, 0.757860899f},
-std::array<float,2>{0.187647566f, 0.944401026f},
-std::array<float,2>{0.683684289f, 0.322474122f},
-std::array<float,2>{0.281708539f, 0.236804798f},
-std::array<float,2>{0.827462494f, 0.708760381f},
-std::array<float,2>{0.294262648f, 0.937448263f},
-std::array<float,2>{0.817525685f, 0.273751676f},
-std::array<float,2>{0.19825308f, 0.148516834f},
-std::array<float,2>{0.673721492f, 0.649577141f},
-std::array<float,2>{0.0490582958f, 0.604123533f},
-std::array<float,2>{0.50521487f, 0.0446612611f},
-std::array<float,2>{0.418494105f, 0.482956916f},
-std::array<float,2>{0.883169591f, 0.846251011f},
-std::array<float,2>{0.454659253f, 0.688563466f},
-std::array<float,2>{0.966770113f, 0.22796014f},
-std::array<float,2>{0.123185664f, 0.333652377f},
-std::array<float,2>{0.582952201f, 0.964676738f},
-std::array<float,2>{0.128971308f, 0.776100457f},
-std::array<float,2>{0.705961585f, 0.427788466f},
-std::array<float,2>{0.354287237f, 0.102892973f},
-std::array<float,2>{0.788641274f, 0.559076548f},
-std::array<float,2>{0.383815289f, 0.813325942f},
-std::array<float,2>{0.921478689f, 0.46477142f},
-std::array<float,2>{0.0113312881f, 0.0119174952f},
-std::array<float,2>{0.540625811f, 0.584192753f},
-std::array<float,2>{0.249807298f, 0.657759428f},
-std::array<float,2>{0.64269805f, 0.179958791f},
-std::array<float,2>{0.25802663f, 0.304944843f},
-std::array<float,2>{0.853073776f, 0.889634788f},
-std::array<float,2>{0.332035571f, 0.525286615f},
-std::array<float,2>{0.759789646f, 0.0921273604f},
-std::array<float,2>{0.161976829f, 0.38878423f},
-std::array<float,2>{0.748434186f, 0.80158788f},
-std::array<float,2>{0.0651959255f, 0.988431096f},
-std::array<float,2>{0.595165789f, 0.368213832f},
-std::array<float,2>{0.492694587f, 0.201189488f},
-std::array<float,2>{0.998122931f, 0.729467154f},
-std::array<float,2>{0.475318462f, 0.937996686f},
-std::array<float,2>{0.969524145f, 0.327248633f},
-std::array<float,2>{0.0931008756f, 0.242133379f},
-std::array<float,2>{0.623518705f, 0.705971003f},
-std::array<float,2>{0.175473452f, 0.533649862f},
-std::array<float,2>{0.72128427f, 0.120500319f},
-std::array<float,2>{0.321830541f, 0.411703676f},
-std::array<float,2>{0.770661771f, 0.763456762f},
-std::array<float,2>{0.274233371f, 0.630314946f},
-std::array<float,2>{0.874578595f, 0.136565924f},
-std::array<float,2>{0.225180909f, 0.254007667f},
-std::array<float,2>{0.63647753f, 0.921536803f},
-std::array<float,2>{0.0273576118f, 0.867947757f},
-std::array<float,2>{0.562279165f, 0.492982119f},
-std::array<float,2>{0.397812426f, 0.0500849374f},
-std::array<float,2>{0.935956836f, 0.61938417f},
-std::array<float,2>{0.363309652f, 0.781680286f},
-std::array<float,2>{0.801398516f, 0.390781045f},
-std::array<float,2>{0.154619902f, 0.0772895142f},
-std::array<float,2>{0.692001879f, 0.510514438f},
-std::array<float,2>{0.107857242f, 0.737977862f},
-std::array<float,2>{0.567548752f, 0.211062789f},
-std::array<float,2>{0.439817458f, 0.34848547f},
-std::array<float,2>{0.944926083f, 0.970178962f},
-std::array<float,2>{0.434899807f, 0.576068878f},
-std::array<float,2>{0.901022196f, 0.0290708523f},
-std::array<float,2>{0.0425352193f, 0.441234589f},
-std::array<float,2>{0.531014204f, 0.829891562f},
-std::array<float,2>{0.204565585f, 0.894711196f},
-std::array<float,2>{0.658103824f, 0.293195844f},
-std::array<float,2>{0.308600873f, 0.161611438f},
-std::array<float,2>{0.839718223f, 0.678651035f},
-std::array<float,2>{0.315417171f, 0.98225075f},
-std::array<float,2>{0.778253138f, 0.352561176f},
-std::array<float,2>{0.184832245f, 0.207941771f},
-std::array<float,2>{0.731382847f, 0.743452132f},
-std::array<float,2>{0.0805694386f, 0.501869917f},
-std::array<float,2>{0.613717437f, 0.0678908676f},
-std::array<float,2>{0.483013868f, 0.401780546f},
-std::array<float,2>{0.980700016f, 0.795397997f},
-std::array<float,2>{0.400545686f, 0.682153702f},
-std::array<float,2>{0.925367892f, 0.164603725f},
-std::array<float,2>{0.0156458225f, 0.287275672f},
-std::array<float,2>{0.547523201f, 0.903875232f},
-std::array<float,2>{0.231591314f, 0.842051208f},
-std::array<float,2>{0.632091463f, 0.450998396f},
-std::array<float,2>{0.267445982f, 0.0198574942f},
-std::array<float,2>{0.863516331f, 0.566307783f},
-std::array<float,2>{0.449292183f, 0.751972854f},
-std::array<float,2>{0.948006272f, 0.416227549f},
-std::array<float,2>{0.101438351f, 0.1107255f},
-std::array<float,2>{0.570712149f, 0.544654429f},
-std::array<float,2>{0.145476818f, 0.716797829f},
-std::array<float,2>{0.700514436f, 0.245766252f},
-std::array<float,2>{0.371829808f, 0.319849074f},
-std::array<float,2>{0.807148159f, 0.945854902f},
-std::array<float,2>{0.301287115f, 0.616788924f},
-std::array<float,2>{0.835590839f, 0.0608991571f},
-std::array<float,2>{0.216657206f, 0.484721273f},
-std::array<float,2>{0.664951265f, 0.864575744f},
-std::array<float,2>{0.0379016139f, 0.913433075f},
-std::array<float,2>{0.521658242f, 0.263993561f},
-std::array<float,2>{0.424654186f, 0.128515378f},
-std::array<float,2>{0.893348277f, 0.639194131f},
-std::array<float,2>{0.406624109f, 0.875600517f},
-std::array<float,2>{0.875463486f, 0.303780407f},
-std::array<float,2>{0.056931816f, 0.174618006f},
-std::array<float,2>{0.515104949f, 0.664138675f},
-std::array<float,2>{0.192884937f, 0.593539596f},
-std::array<float,2>{0.682981312f, 0.00667616399f},
-std::array<float,2>{0.28897959f, 0.459927827f},
-std::array<float,2>{0.823103666f, 0.82797277f},
-std::array<float,2>{0.34394902f, 0.724912643f},
-std::array<float,2>{0.789986968f, 0.188818038f},
-std::array<float,2>{0.136843443f, 0.360945165f},
-std::array<float,2>{0.718349397f, 0.996756196f},
-std::array<float,2>{0.115746021f, 0.809949994f},
-std::array<float,2>{0.590962887f, 0.38044998f},
-std::array<float,2>{0.464765698f, 0.0859372467f},
-std::array<float,2>{0.959611595f, 0.519615471f},
-std::array<float,2>{0.25186494f, 0.856797874f},
-std::array<float,2>{0.84490633f, 0.474771023f},
-std::array<float,2>{0.240576401f, 0.0328313001f},
-std::array<float,2>{0.652018309f, 0.593806803f},
-std::array<float,2>{0.00544160232f, 0.641745508f},
-std::array<float,2>{0.535668314f, 0.147864431f},
-std::array<float,2>{0.378888637f, 0.265975118f},
-std::array<float,2>{0.913891971f, 0.925906301f},
-std::array<float,2>{0.487600625f, 0.552761436f},
-std::array<float,2>{0.991416872f, 0.100658506f},
-std::array<float,2>{0.0732971355f, 0.434464484f},
-std::array<float,2>{0.606891334f, 0.766148031f},
-std::array<float,2>{0.169892207f, 0.955518544f},
-std::array<float,2>{0.736533165f, 0.339458525f},
-std::array<float,2>{0.339116395f, 0.22111401f},
-std::array<float,2>{0.755177438f, 0.699843585f},
-std::array<float,2>{0.355992079f, 0.90203011f},
-std::array<float,2>{0.783830166f, 0.28297925f},
-std::array<float,2>{0.125385344f, 0.170381352f},
-std::array<float,2>{0.707335174f, 0.685487747f},
-std::array<float,2>{0.120443106f, 0.568349957f},
-std::array<float,2>{0.579725921f, 0.0191464107f},
-std::array<float,2>{0.460571319f, 0.445893764f},
-std::array<float,2>{0.963988066f, 0.83907783f},
-std::array<float,2>{0.417627037f, 0.748497844f},
-std::array<float,2>{0.886850774f, 0.20392476f},
-std::array<float,2>{0.0541972518f, 0.35818556f},
-std::array<float,2>{0.500059962f, 0.98044461f},
-std::array<float,2>{0.202933624f, 0.789651692f},
-std::array<float,2>{0.676672339f, 0.402925998f},
-std::array<float,2>{0.289800763f, 0.0631708726f},
-std::array<float,2>{0.815623701f, 0.505126894f},
-std::array<float,2>{0.49821946f, 0.860379994f},
-std::array<float,2>{0.992245674f, 0.491069555f},
-std::array<float,2>{0.0702606887f, 0.0554776043f},
-std::array<float,2>{0.598859489f, 0.612844169f},
-std::array<float,2>{0.159329936f, 0.634461224f},
-std::array<float,2>{0.742350399f, 0.129342899f},
-std::array<float,2>{0.330848634f, 0.260605216f},
-std::array<float,2>{0.765230417f, 0.907369614f},
-std::array<float,2>{0.262196332f, 0.542082667f},
-std::array<float,2>{0.858591318f, 0.115573853f},
-std::array<float,2>{0.243685126f, 0.420460105f},
-std::array<float,2>{0.647696137f, 0.754674613f},
-std::array<float,2>{0.01447888f, 0.952340543f},
-std::array<float,2>{0.545848668f, 0.313141972f},
-std::array<float,2>{0.389268935f, 0.246466562f},
-std::array<float,2>{0.915526092f, 0.711596191f},
-std::array<float,2>{0.394017637f, 0.992907524f},
-std::array<float,2>{0.930762231f, 0.364090294f},
-std::array<float,2>{0.0266329199f, 0.194063231f},
-std::array<float,2>{0.55853641f, 0.719454885f},
-std::array<float,2>{0.221646249f, 0.516982973f},
-std::array<float,2>{0.639471412f, 0.0798318312f},
-std::array<float,2>{0.278358907f, 0.378553271f},
-std::array<float,2>{0.867512584f, 0.808343053f},
-std::array<float,2>{0.324645311f, 0.670946598f},
-std::array<float,2>{0.766501784f, 0.17797868f},
-std::array<float,2>{0.178155109f, 0.299420685f},
-std::array<float,2>{0.724054694f, 0.880673289f},
-std::array<float,2>{0.0875136778f, 0.820913196f},
-std::array<float,2>{0.617381752f, 0.455658644f},
-std::array<float,2>{0.471134752f, 0.0032730978f},
-std::array<float,2>{0.97414273f, 0.588558555f},
-std::array<float,2>{0.30800274f, 0.77108264f},
-std::array<float,2>{0.843522012f, 0.431924433f},
-std::array<float,2>{0.209684268f, 0.0959123075f},
-std::array<float,2>{0.663654923f, 0.549208701f},
-std::array<float,2>{0.0440492555f, 0.697942138f},
-std::array<float,2>{0.526622474f, 0.225280046f},
-std::array<float,2>{0.429699451f, 0.34044084f},
-std::array<float,2>{0.905038059f, 0.95729208f},
-std::array<float,2>{0.445058405f, 0.599440515f},
-std::array<float,2>{0.939701259f, 0.0378333926f},
-std::array<float,2>{0.104270875f, 0.471841425f},
-std::array<float,2>{0.566069722f, 0.854035497f},
-std::array<float,2>{0.149767756f, 0.923197389f},
-std::array<float,2>{0.689940691f, 0.272209555f},
-std::array<float,2>{0.360607058f, 0.141326979f},
-std::array<float,2>{0.799822628f, 0.644718647f},
-std::array<float,2>{0.269854486f, 0.966360629f},
-std::array<float,2>{0.862042367f, 0.330384195f},
-std::array<float,2>{0.23022078f, 0.23126775f},
-std::array<float,2>{0.628734648f, 0.693249583f},
-std::array<float,2>{0.0229967423f, 0.558545768f},
-std::array<float,2>{0.553705871f, 0.10746754f},
-std::array<float,2>{0.404484659f, 0.424854487f},
-std::array<float,2>{0.928699434f, 0.777727365f},
-std::array<float,2>{0.477206349f, 0.655275345f},
-std::array<float,2>{0.980001211f, 0.153655842f},
-std::array<float,2>{0.0834313855f, 0.278362513f},
-std::array<float,2>{0.611301839f, 0.931038916f},
-std::array<float,2>{0.18266876f, 0.848895013f},
-std::array<float,2>{0.729949176f, 0.480383754f},
-std::array<float,2>{0.316467494f, 0.0396948457f},
-std::array<float,2>{0.777160406f, 0.608586788f},
-std::array<float,2>{0.42711547f, 0.799052596f},
-std::array<float,2>{0.896673858f, 0.384858817f},
-std::array<float,2>{0.0328120589f, 0.0861171409f},
-std::array<float,2>{0.516307533f, 0.527960002f},
-std::array<float,2>{0.210988671f, 0.730662584f},
-std::array<float,2>{0.670088351f, 0.197196096f},
-std::array<float,2>{0.299152166f, 0.371144861f},
-std::array<float,2>{0.828968465f, 0.987515867f},
-std::array<float,2>{0.368807912f, 0.578407466f},
-std::array<float,2>{0.811406076f, 0.00896781776f},
-std::array<float,2>{0.144372895f, 0.46552977f},
-std::array<float,2>{0.695881963f, 0.820062339f},
-std::array<float,2>{0.094935663f, 0.886040211f},
-std::array<float,2>{0.576473534f, 0.309389502f},
-std::array<float,2>{0.447875172f, 0.184875488f},
-std::array<float,2>{0.950953484f, 0.662770033f},
-std::array<float,2>{0.467192441f, 0.916739166f},
-std::array<float,2>{0.954282045f, 0.25065124f},
-std::array<float,2>{0.11009074f, 0.139346287f},
-std::array<float,2>{0.588407636f, 0.627520144f},
-std::array<float,2>{0.133284703f, 0.623595536f},
-std::array<float,2>{0.713440239f, 0.0539332964f},
-std::array<float,2>{0.348665893f, 0.49930501f},
-std::array<float,2>{0.795349777f, 0.874275386f},
-std::array<float,2>{0.28329879f, 0.709657848f},
-std::array<float,2>{0.824748933f, 0.236181259f},
-std::array<float,2>{0.190396234f, 0.321080089f},
-std::array<float,2>{0.686243117f, 0.942274451f},
-std::array<float,2>{0.0624164343f, 0.760684013f},
-std::array<float,2>{0.508456528f, 0.407564044f},
-std::array<float,2>{0.410266489f, 0.123580657f},
-std::array<float,2>{0.8810938f, 0.538997531f},
-std::array<float,2>{0.340532601f, 0.832871377f},
-std::array<float,2>{0.750174105f, 0.442023635f},
-std::array<float,2>{0.166413009f, 0.0247668438f},
-std::array<float,2>{0.741889834f, 0.573393285f},
-std::array<float,2>{0.0771786943f, 0.675681174f},
-std::array<float,2>{0.603191495f, 0.157403633f},
-std::array<float,2>{0.490122318f, 0.290060997f},
-std::array<float,2>{0.987578511f, 0.892360985f},
-std::array<float,2>{0.38117376f, 0.513783157f},
-std::array<float,2>{0.908339143f, 0.0721865892f},
-std::array<float,2>{0.00199843873f, 0.39572835f},
-std::array<float,2>{0.534761369f, 0.788710535f},
-std::array<float,2>{0.235336348f, 0.973724306f},
-std::array<float,2>{0.653193414f, 0.346743345f},
-std::array<float,2>{0.255118072f, 0.217058182f},
-std::array<float,2>{0.849479139f, 0.740873218f},
-std::array<float,2>{0.277277112f, 0.920182765f},
-std::array<float,2>{0.871465981f, 0.255086511f},
-std::array<float,2>{0.223109618f, 0.135675475f},
-std::array<float,2>{0.634763777f, 0.629074037f},
-std::array<float,2>{0.0298349001f, 0.620919168f},
-std::array<float,2>{0.558619201f, 0.049438145f},
-std::array<float,2>{0.395198971f, 0.493968636f},
-std::array<float,2>{0.934124887f, 0.868672609f},
-std::array<float,2>{0.47266385f, 0.706756175f},
-std::array<float,2>{0.972351849f, 0.241124809f},
-std::array<float,2>{0.0902264267f, 0.326381743f},
-std::array<float,2>{0.621692777f, 0.939184904f},
-std::array<float,2>{0.173534557f, 0.762001395f},
-std::array<float,2>{0.719092071f, 0.41050908f},
-std::array<float,2>{0.322775781f, 0.119632669f},
-std::array<float,2>{0.773310781f, 0.535055339f},
-std::array<float,2>{0.43626529f, 0.828205645f},
-std::array<float,2>{0.899765074f, 0.439884663f},
-std::array<float,2>{0.040416941f, 0.0279835593f},
-std::array<float,2>{0.527644753f, 0.574254513f},
-std::array<float,2>{0.205430463f, 0.679048717f},
-std::array<float,2>{0.659928203f, 0.160395309f},
-std::array<float,2>{0.311494738f, 0.294653684f},
-std::array<float,2>{0.836479485f, 0.895880282f},
-std::array<float,2>{0.366055161f, 0.511301696f},
-std::array<float,2>{0.803538501f, 0.0764494762f},
-std::array<float,2>{0.153173029f, 0.392516583f},
-std::array<float,2>{0.694950938f, 0.782494366f},
-std::array<float,2>{0.106507525f, 0.969236374f},
-std::array<float,2>{0.56899184f, 0.349193811f},
-std::array<float,2>{0.438841045f, 0.212146029f},
-std::array<float,2>{0.942813456f, 0.737134874f},
-std::array<float,2>{0.455298632f, 0.963058352f},
-std::array<float,2>{0.96807009f, 0.332957298f},
-std::array<float,2>{0.121940844f, 0.226833582f},
-std::array<float,2>{0.584162116f, 0.68754226f},
-std::array<float,2>{0.131336719f, 0.559900284f},
-std::array<float,2>{0.703429043f, 0.102249123f},
-std::array<float,2>{0.352817923f, 0.429444462f},
-std::array<float,2>{0.786545813f, 0.776749492f},
-std::array<float,2>{0.296580225f, 0.649148405f},
-std::array<float,2>{0.81987679f, 0.149900004f},
-std::array<float,2>{0.196745396f, 0.275178105f},
-std::array<float,2>{0.674687803f, 0.935775518f},
-std::array<float,2>{0.0476123169f, 0.846913874f},
-std::array<float,2>{0.506858706f, 0.484295368f},
-std::array<float,2>{0.421072453f, 0.0439091399f},
-std::array<float,2>{0.88549757f, 0.60485214f},
-std::array<float,2>{0.33492893f, 0.80253607f},
-std::array<float,2>{0.759359896f, 0.390272081f},
-std::array<float,2>{0.163082868f, 0.0929760858f},
-std::array<float,2>{0.747160792f, 0.523835123f},
-std::array<float,2>{0.0642906949f, 0.729975939f},
-std::array<float,2>{0.597520411f, 0.202864468f},
-std::array<float,2>{0.494336098f, 0.368027657f},
-std::array<float,2>{0.997602224f, 0.989765525f},
-std::array<float,2>{0.385484219f, 0.585863113f},
-std::array<float,2>{0.918199956f, 0.0134785045f},
-std::array<float,2>{0.0097629698f, 0.463360786f},
-std::array<float,2>{0.541323066f, 0.813964546f},
-std::array<float,2>{0.246247083f, 0.890033484f},
-std::array<float,2>{0.641044736f, 0.305722117f},
-std::array<float,2>{0.259854704f, 0.180877134f},
-std::array<float,2>{0.855009615f, 0.656472445f},
-std::array<float,2>{0.346633613f, 0.997389197f},
-std::array<float,2>{0.792509556f, 0.360201895f},
-std::array<float,2>{0.140505075f, 0.187653452f},
-std::array<float,2>{0.716565609f, 0.725668728f},
-std::array<float,2>{0.113987461f, 0.520778894f},
-std::array<float,2>{0.592313051f, 0.0847533792f},
-std::array<float,2>{0.461295366f, 0.378932238f},
-std::array<float,2>{0.958186865f, 0.809187472f},
-std::array<float,2>{0.409828752f, 0.665120721f},
-std::array<float,2>{0.877541244f, 0.175209403f},
-std::array<float,2>{0.056246493f, 0.302863151f},
-std::array<float,2>{0.513127089f, 0.876179159f},
-std::array<float,2>{0.193763971f, 0.827072442f},
-std::array<float,2>{0.679697752f, 0.460315257f},
-std::array<float,2>{0.286371827f, 0.00743661448f},
-std::array<float,2>{0.82095629f, 0.592131495f},
-std::array<float,2>{0.485261261f, 0.767517269f},
-std::array<float,2>{0.988922298f, 0.434902132f},
-std::array<float,2>{0.0716450587f, 0.100324646f},
-std::array<float,2>{0.608164191f, 0.553916872f},
-std::array<float,2>{0.171178222f, 0.700304925f},
-std::array<float,2>{0.735763907f, 0.222443596f},
-std::array<float,2>{0.336757392f, 0.33796376f},
-std::array<float,2>{0.756090581f, 0.956196368f},
-std::array<float,2>{0.25227356f, 0.595528662f},
-std::array<float,2>{0.847265601f, 0.0319210924f},
-std::array<float,2>{0.239210173f, 0.476499736f},
-std::array<float,2>{0.649439454f, 0.855812132f},
-std::array<float,2>{0.00611380767f, 0.927262604f},
-std::array<float,2>{0.537518144f, 0.266933322f},
-std::array<float,2>{0.3756091f, 0.147329524f},
-std::array<float,2>{0.911528468f, 0.641454399f},
-std::array<float,2>{0.398640305f, 0.902742922f},
-std::array<float,2>{0.922739506f, 0.28879562f},
-std::array<float,2>{0.0191811305f, 0.165849254f},
-std::array<float,2>{0.548945189f, 0.683301926f},
-std::array<float,2>{0.233341575f, 0.564848065f},
-std::array<float,2>{0.629596174f, 0.0214187242f},
-std::array<float,2>{0.267701864f, 0.449385226f},
-std::array<float,2>{0.865784764f, 0.843267739f},
-std::array<float,2>{0.312945426f, 0.742665052f},
-std::array<float,2>{0.780721307f, 0.208595529f},
-std::array<float,2>{0.186835691f, 0.351651698f},
-std::array<float,2>{0.733351946f, 0.980813444f},
-std::array<float,2>{0.079162389f, 0.796072423f},
-std::array<float,2>{0.616158068f, 0.40094915f},
-std::array<float,2>{0.48136887f, 0.0669400096f},
-std::array<float,2>{0.983797133f, 0.500718892f},
-std::array<float,2>{0.303611517f, 0.864016652f},
-std::array<float,2>{0.832851708f, 0.486082643f},
-std::array<float,2>{0.217973411f, 0.0617656782f},
-std::array<float,2>{0.667907953f, 0.615380943f},
-std::array<float,2>{0.0351721942f, 0.640230536f},
-std::array<float,2>{0.520345271f, 0.127569705f},
-std::array<float,2>{0.423788577f, 0.265445292f},
-std::array<float,2>{0.891672075f, 0.912378609f},
-std::array<float,2>{0.451974034f, 0.543621778f},
-std::array<float,2>{0.946896136f, 0.109936722f},
-std::array<float,2>{0.099246785f, 0.417817712f},
-std::array<float,2>{0.573158801f, 0.75309521f},
-std::array<float,2>{0.146607459f, 0.946345925f},
-std::array<float,2>{0.701178551f, 0.319136292f},
-std::array<float,2>{0.374366432f, 0.244968727f},
-std::array<float,2>{0.804745078f, 0.718192875f},
-std::array<float,2>{0.327999681f, 0.87901485f},
-std::array<float,2>{0.768500626f, 0.300324708f},
-std::array<float,2>{0.177035451f, 0.178900152f},
-std::array<float,2>{0.72564441f, 0.67020458f},
-std::array<float,2>{0.0887006819f, 0.589079916f},
-std::array<float,2>{0.620259643f, 0.00231227698f},
-std::array<float,2>{0.468921542f, 0.456814289f},
-std::array<float,2>{0.975022316f, 0.821527243f},
-std::array<float,2>{0.39129433f, 0.720469594f},
-std::array<float,2>{0.932056725f, 0.195017025f},
-std::array<float,2>{0.0249999277f, 0.36438477f},
-std::array<float,2>{0.555188537f, 0.993881941f},
-std::array<float,2>{0.220453098f, 0.806868076f},
-std::array<float,2>{0.638046622f, 0.377064973f},
-std::array<float,2>{0.279409707f, 0.0789058059f},
-std::array<float,2>{0.870910525f, 0.516132951f},
-std::array<float,2>{0.442554653f, 0.854736984f},
-std::array<float,2>{0.939097822f, 0.470948011f},
-std::array<float,2>{0.102920078f, 0.0390511788f},
-std::array<float,2>{0.563487053f, 0.597976148f},
-std::array<float,2>{0.15198192f, 0.646187484f},
-std::array<float,2>{0.689331174f, 0.142319515f},
-std::array<float,2>{0.361662626f, 0.272945821f},
-std::array<float,2>{0.797054231f, 0.922359049f},
-std::array<float,2>{0.306430697f, 0.550104558f},
-std::array<float,2>{0.841700912f, 0.0967187583f},
-std::array<float,2>{0.207429111f, 0.432905912f},
-std::array<float,2>{0.661523223f, 0.769765258f},
-std::array<float,2>{0.0458559655f, 0.958511829f},
-std::array<float,2>{0.525142372f, 0.341327906f},
-std::array<float,2>{0.433392465f, 0.225824624f},
-std::array<float,2>{0.903358638f, 0.698727787f},
-std::array<float,2>{0.414369524f, 0.978747368f},
-std::array<float,2>{0.888781011f, 0.358847946f},
-std::array<float,2>{0.051258333f, 0.204881206f},
-std::array<float,2>{0.503517985f, 0.749883771f},
-std::array<float,2>{0.200414628f, 0.503984094f},
-std::array<float,2>{0.679146945f, 0.0635635927f},
-std::array<float,2>{0.291420639f, 0.403587908f},
-std::array<float,2>{0.81407094f, 0.790155411f},
-std::array<float,2>{0.357773155f, 0.684423685f},
-std::array<float,2>{0.782680571f, 0.170915306f},
-std::array<float,2>{0.128174067f, 0.281375468f},
-std::array<float,2>{0.709952712f, 0.901329517f},
-std::array<float,2>{0.118731104f, 0.837891102f},
-std::array<float,2>{0.580745459f, 0.44655177f},
-std::array<float,2>{0.458801299f, 0.0185380951f},
-std::array<float,2>{0.962449193f, 0.567299008f},
-std::array<float,2>{0.265478313f, 0.755252421f},
-std::array<float,2>{0.856305003f, 0.421335578f},
-std::array<float,2>{0.245767161f, 0.117155731f},
-std::array<float,2>{0.644559383f, 0.541384041f},
-std::array<float,2>{0.0134347556f, 0.712018609f},
-std::array<float,2>{0.544050992f, 0.247666702f},
-std::array<float,2>{0.387950361f, 0.314294457f},
-std::array<float,2>{0.917753696f, 0.951205134f},
-std::array<float,2>{0.496920943f, 0.612018406f},
-std::array<float,2>{0.995127261f, 0.0565087982f},
-std::array<float,2>{0.0673734099f, 0.491961271f},
-std::array<float,2>{0.600511909f, 0.860036731f},
-std::array<float,2>{0.15642491f, 0.906609297f},
-std::array<float,2>{0.745653689f, 0.261257112f},
-std::array<float,2>{0.329983741f, 0.130202711f},
-std::array<float,2>{0.763331234f, 0.632933795f},
-std::array<float,2>{0.282952905f, 0.942765594f},
-std::array<float,2>{0.826810896f, 0.322187454f},
-std::array<float,2>{0.189010486f, 0.234928474f},
-std::array<float,2>{0.685400128f, 0.710688055f},
-std::array<float,2>{0.0589648373f, 0.538084745f},
-std::array<float,2>{0.510852456f, 0.124733724f},
-std::array<float,2>{0.413962841f, 0.406267911f},
-std::array<float,2>{0.880309165f, 0.761476219f},
-std::array<float,2>{0.466599375f, 0.628312707f},
-std::array<float,2>{0.9562307f, 0.14046222f},
-std::array<float,2>{0.112825677f, 0.251291186f},
-std::array<float,2>{0.58658427f, 0.917759597f},
-std::array<float,2>{0.135802612f, 0.87338388f},
-std::array<float,2>{0.710986078f, 0.498844743f},
-std::array<float,2>{0.349996775f, 0.0534284003f},
-std::array<float,2>{0.793936372f, 0.624337077f},
-std::array<float,2>{0.380012035f, 0.787223637f},
-std::array<float,2>{0.907006741f, 0.395470023f},
-std::array<float,2>{0.000774960266f, 0.0711714998f},
-std::array<float,2>{0.532681644f, 0.515042782f},
-std::array<float,2>{0.238155141f, 0.741425037f},
-std::array<float,2>{0.655918956f, 0.217991471f},
-std::array<float,2>{0.257568419f, 0.34576869f},
-std::array<float,2>{0.851056397f, 0.973453045f},
-std::array<float,2>{0.342099041f, 0.57276094f},
-std::array<float,2>{0.75334245f, 0.0237773228f},
-std::array<float,2>{0.165025815f, 0.442986906f},
-std::array<float,2>{0.739504993f, 0.833355606f},
-std::array<float,2>{0.0757521614f, 0.890688121f},
-std::array<float,2>{0.603537321f, 0.289394319f},
-std::array<float,2>{0.490910292f, 0.157094866f},
-std::array<float,2>{0.986149907f, 0.674515665f},
-std::array<float,2>{0.480197012f, 0.930007994f},
-std::array<float,2>{0.977053165f, 0.277673393f},
-std::array<float,2>{0.084734112f, 0.153207839f},
-std::array<float,2>{0.612785995f, 0.654815912f},
-std::array<float,2>{0.181427926f, 0.607961953f},
-std::array<float,2>{0.727463722f, 0.0403407477f},
-std::array<float,2>{0.318879157f, 0.479081601f},
-std::array<float,2>{0.774185598f, 0.848496377f},
-std::array<float,2>{0.272258401f, 0.691473663f},
-std::array<float,2>{0.860047281f, 0.232318625f},
-std::array<float,2>{0.22702758f, 0.331877917f},
-std::array<float,2>{0.62525785f, 0.965481043f},
-std::array<float,2>{0.0201327354f, 0.779254377f},
-std::array<float,2>{0.552140772f, 0.424006164f},
-std::array<float,2>{0.403241843f, 0.108789854f},
-std::array<float,2>{0.926162004f, 0.557517171f},
-std::array<float,2>{0.370491743f, 0.819227636f},
-std::array<float,2>{0.809101224f, 0.466595322f},
-std::array<float,2>{0.141560152f, 0.00838552695f},
-std::array<float,2>{0.698514462f, 0.579329014f},
-std::array<float,2>{0.0957647562f, 0.663900375f},
-std::array<float,2>{0.574360192f, 0.184007332f},
-std::array<float,2>{0.446706444f, 0.310340405f},
-std::array<float,2>{0.951400697f, 0.885175526f},
-std::array<float,2>{0.428396851f, 0.528906047f},
-std::array<float,2>{0.896077096f, 0.0872785151f},
-std::array<float,2>{0.0344716571f, 0.385963172f},
-std::array<float,2>{0.518432856f, 0.800228834f},
-std::array<float,2>{0.214554101f, 0.987117112f},
-std::array<float,2>{0.668383896f, 0.37228474f},
-std::array<float,2>{0.29860577f, 0.196206599f},
-std::array<float,2>{0.830483317f, 0.731908262f},
-std::array<float,2>{0.310533017f, 0.896545649f},
-std::array<float,2>{0.838055789f, 0.29557392f},
-std::array<float,2>{0.203709081f, 0.162193149f},
-std::array<float,2>{0.65653789f, 0.676565707f},
-std::array<float,2>{0.0419120789f, 0.576481819f},
-std::array<float,2>{0.530123174f, 0.0298347119f},
-std::array<float,2>{0.43401137f, 0.437962919f},
-std::array<float,2>{0.902005732f, 0.83179158f},
-std::array<float,2>{0.440432072f, 0.734998763f},
-std::array<float,2>{0.943680763f, 0.213284448f},
-std::array<float,2>{0.108459733f, 0.350291729f},
-std::array<float,2>{0.566686392f, 0.971550465f},
-std::array<float,2>{0.1560013f, 0.784604251f},
-std::array<float,2>{0.69248265f, 0.39356935f},
-std::array<float,2>{0.364766449f, 0.0750077814f},
-std::array<float,2>{0.802651048f, 0.507824957f},
-std::array<float,2>{0.396980286f, 0.870460927f},
-std::array<float,2>{0.937217414f, 0.494502395f},
-std::array<float,2>{0.0291140415f, 0.0474442281f},
-std::array<float,2>{0.561335266f, 0.618754506f},
-std::array<float,2>{0.226185635f, 0.630928338f},
-std::array<float,2>{0.635580242f, 0.13383624f},
-std::array<float,2>{0.274681479f, 0.256503314f},
-std::array<float,2>{0.873349011f, 0.918822646f},
-std::array<float,2>{0.320515901f, 0.532333076f},
-std::array<float,2>{0.769729555f, 0.118991025f},
-std::array<float,2>{0.174464777f, 0.413074672f},
-std::array<float,2>{0.722130716f, 0.76554662f},
-std::array<float,2>{0.0926445797f, 0.94095546f},
-std::array<float,2>{0.624202728f, 0.325843602f},
-std::array<float,2>{0.475711733f, 0.239121929f},
-std::array<float,2>{0.970442772f, 0.704354882f},
-std::array<float,2>{0.493886977f, 0.99147898f},
-std::array<float,2>{0.999661207f, 0.370786488f},
-std::array<float,2>{0.0659866035f, 0.200485796f},
-std::array<float,2>{0.594108105f, 0.727576196f},
-std::array<float,2>{0.160416082f, 0.526614606f},
-std::array<float,2>{0.749649525f, 0.0916432738f},
-std::array<float,2>{0.333150446f, 0.387844682f},
-std::array<float,2>{0.761636198f, 0.804598749f},
-std::array<float,2>{0.259691775f, 0.658256888f},
-std::array<float,2>{0.852327287f, 0.182414547f},
-std::array<float,2>{0.24813731f, 0.307564408f},
-std::array<float,2>{0.643732607f, 0.887518346f},
-std::array<float,2>{0.00995508861f, 0.815700471f},
-std::array<float,2>{0.539587796f, 0.462137878f},
-std::array<float,2>{0.383007765f, 0.0150442608f},
-std::array<float,2>{0.920793891f, 0.583616555f},
-std::array<float,2>{0.355313718f, 0.77384007f},
-std::array<float,2>{0.788053989f, 0.427484006f},
-std::array<float,2>{0.130279392f, 0.103869505f},
-std::array<float,2>{0.707012117f, 0.561832488f},
-std::array<float,2>{0.124506637f, 0.691016734f},
-std::array<float,2>{0.583515942f, 0.228633031f},
-std::array<float,2>{0.453931093f, 0.334429085f},
-std::array<float,2>{0.965005517f, 0.961567938f},
-std::array<float,2>{0.419799149f, 0.601829171f},
-std::array<float,2>{0.884341121f, 0.0466798991f},
-std::array<float,2>{0.0503564402f, 0.481278807f},
-std::array<float,2>{0.504396319f, 0.843835413f},
-std::array<float,2>{0.198190197f, 0.935374439f},
-std::array<float,2>{0.672394276f, 0.276501983f},
-std::array<float,2>{0.293279678f, 0.151855677f},
-std::array<float,2>{0.817025363f, 0.651463687f},
-std::array<float,2>{0.338393182f, 0.954743743f},
-std::array<float,2>{0.754163027f, 0.336188316f},
-std::array<float,2>{0.168670624f, 0.219392404f},
-std::array<float,2>{0.738009393f, 0.701326728f},
-std::array<float,2>{0.0723054484f, 0.552191317f},
-std::array<float,2>{0.605705976f, 0.0978493169f},
-std::array<float,2>{0.487297237f, 0.43745032f},
-std::array<float,2>{0.990285814f, 0.768382132f},
-std::array<float,2>{0.377769232f, 0.643922448f},
-std::array<float,2>{0.912347794f, 0.144740507f},
-std::array<float,2>{0.00462649576f, 0.267705262f},
-std::array<float,2>{0.536511242f, 0.928503275f},
-std::array<float,2>{0.241258577f, 0.857929766f},
-std::array<float,2>{0.651046872f, 0.473009974f},
-std::array<float,2>{0.250303984f, 0.0342938416f},
-std::array<float,2>{0.84421593f, 0.597520113f},
-std::array<float,2>{0.463625491f, 0.812050581f},
-std::array<float,2>{0.960132718f, 0.381113946f},
-std::array<float,2>{0.116846696f, 0.0827873498f},
-std::array<float,2>{0.589987874f, 0.522845268f},
-std::array<float,2>{0.138077423f, 0.724481404f},
-std::array<float,2>{0.717126369f, 0.191239089f},
-std::array<float,2>{0.345570683f, 0.361826122f},
-std::array<float,2>{0.790290713f, 0.998091459f},
-std::array<float,2>{0.28739965f, 0.590733469f},
-std::array<float,2>{0.823283017f, 0.0044480986f},
-std::array<float,2>{0.191754654f, 0.458104163f},
-std::array<float,2>{0.682467699f, 0.824609339f},
-std::array<float,2>{0.0585652851f, 0.878201663f},
-std::array<float,2>{0.514280081f, 0.302010506f},
-std::array<float,2>{0.407399178f, 0.173186168f},
-std::array<float,2>{0.87603581f, 0.666492939f},
-std::array<float,2>{0.425341725f, 0.910284162f},
-std::array<float,2>{0.893876135f, 0.263041526f},
-std::array<float,2>{0.0383525863f, 0.125739187f},
-std::array<float,2>{0.5234285f, 0.638017654f},
-std::array<float,2>{0.215513647f, 0.614451706f},
-std::array<float,2>{0.665723085f, 0.0587138794f},
-std::array<float,2>{0.302110076f, 0.487030417f},
-std::array<float,2>{0.834172726f, 0.865557075f},
-std::array<float,2>{0.372919917f, 0.71658355f},
-std::array<float,2>{0.808568478f, 0.244045168f},
-std::array<float,2>{0.145906001f, 0.318099946f},
-std::array<float,2>{0.699661136f, 0.947872758f},
-std::array<float,2>{0.100536674f, 0.75053823f},
-std::array<float,2>{0.571531296f, 0.414616376f},
-std::array<float,2>{0.451119214f, 0.112718143f},
-std::array<float,2>{0.948574841f, 0.54601723f},
-std::array<float,2>{0.266238183f, 0.840503454f},
-std::array<float,2>{0.864691973f, 0.452716231f},
-std::array<float,2>{0.230914354f, 0.0220839232f},
-std::array<float,2>{0.631343663f, 0.563665688f},
-std::array<float,2>{0.0168144163f, 0.6810745f},
-std::array<float,2>{0.54822886f, 0.166916236f},
-std::array<float,2>{0.401912332f, 0.286124021f},
-std::array<float,2>{0.92403084f, 0.904351115f},
-std::array<float,2>{0.483527064f, 0.503471196f},
-std::array<float,2>{0.982261658f, 0.0697427392f},
-std::array<float,2>{0.081943728f, 0.399144351f},
-std::array<float,2>{0.615047276f, 0.794058323f},
-std::array<float,2>{0.184509307f, 0.983593106f},
-std::array<float,2>{0.73183018f, 0.354415268f},
-std::array<float,2>{0.316079348f, 0.20989117f},
-std::array<float,2>{0.779139638f, 0.745680928f},
-std::array<float,2>{0.360057116f, 0.925765753f},
-std::array<float,2>{0.798887968f, 0.269957304f},
-std::array<float,2>{0.14858593f, 0.144395828f},
-std::array<float,2>{0.690853f, 0.647492886f},
-std::array<float,2>{0.105453856f, 0.600012183f},
-std::array<float,2>{0.564497352f, 0.0351925641f},
-std::array<float,2>{0.444316477f, 0.469257265f},
-std::array<float,2>{0.940948665f, 0.853084385f},
-std::array<float,2>{0.431243539f, 0.696185052f},
-std::array<float,2>{0.905791342f, 0.223191589f},
-std::array<float,2>{0.043833077f, 0.343746901f},
-std::array<float,2>{0.525402725f, 0.960762918f},
-std::array<float,2>{0.210927784f, 0.772355974f},
-std::array<float,2>{0.662778854f, 0.431235701f},
-std::array<float,2>{0.30741635f, 0.0955197737f},
-std::array<float,2>{0.842164099f, 0.547851562f},
-std::array<float,2>{0.471921355f, 0.823738277f},
-std::array<float,2>{0.972821653f, 0.45487228f},
-std::array<float,2>{0.086286813f, 0.000546995376f},
-std::array<float,2>{0.618770242f, 0.586892068f},
-std::array<float,2>{0.17964913f, 0.668778181f},
-std::array<float,2>{0.722832322f, 0.176546529f},
-std::array<float,2>{0.325432777f, 0.297999471f},
-std::array<float,2>{0.76725775f, 0.881676733f},
-std::array<float,2>{0.27764684f, 0.518634796f},
-std::array<float,2>{0.868801057f, 0.0815471336f},
-std::array<float,2>{0.222385824f, 0.375830889f},
-std::array<float,2>{0.63984108f, 0.805289447f},
-std::array<float,2>{0.0262136478f, 0.995149195f},
-std::array<float,2>{0.557089269f, 0.365819514f},
-std::array<float,2>{0.392941982f, 0.193130881f},
-std::array<float,2>{0.929968059f, 0.722101986f},
-std::array<float,2>{0.390455484f, 0.950393975f},
-std::array<float,2>{0.914622009f, 0.315820158f},
-std::array<float,2>{0.0155920647f, 0.249791741f},
-std::array<float,2>{0.546029627f, 0.713376105f},
-std::array<float,2>{0.24277252f, 0.539659739f},
-std::array<float,2>{0.647426307f, 0.114305802f},
-std::array<float,2>{0.263195813f, 0.41822657f},
-std::array<float,2>{0.858160138f, 0.756539345f},
-std::array<float,2>{0.331558555f, 0.636061907f},
-std::array<float,2>{0.763859808f, 0.132303581f},
-std::array<float,2>{0.158366606f, 0.258669883f},
-std::array<float,2>{0.743531942f, 0.910153568f},
-std::array<float,2>{0.0684275404f, 0.86318469f},
-std::array<float,2>{0.598447144f, 0.488620698f},
-std::array<float,2>{0.499376655f, 0.0570587143f},
-std::array<float,2>{0.993776202f, 0.610563099f},
-std::array<float,2>{0.290707439f, 0.79154259f},
-std::array<float,2>{0.815359473f, 0.405477345f},
-std::array<float,2>{0.201173708f, 0.0649346858f},
-std::array<float,2>{0.677043378f, 0.506232142f},
-std::array<float,2>{0.0535464957f, 0.746855021f},
-std::array<float,2>{0.501729131f, 0.205344707f},
-std::array<float,2>{0.416116744f, 0.356192619f},
-std::array<float,2>{0.887916982f, 0.97813493f},
-std::array<float,2>{0.459137827f, 0.570198834f},
-std::array<float,2>{0.963057816f, 0.0160448737f},
-std::array<float,2>{0.119564995f, 0.448408991f},
-std::array<float,2>{0.578835487f, 0.837159336f},
-std::array<float,2>{0.126685277f, 0.899075925f},
-std::array<float,2>{0.708321571f, 0.28424719f},
-std::array<float,2>{0.356871724f, 0.16804269f},
-std::array<float,2>{0.784561872f, 0.687438846f},
-std::array<float,2>{0.254341573f, 0.974645019f},
-std::array<float,2>{0.848053455f, 0.344251335f},
-std::array<float,2>{0.236117557f, 0.215095028f},
-std::array<float,2>{0.65347141f, 0.739861429f},
-std::array<float,2>{0.00362020452f, 0.513580322f},
-std::array<float,2>{0.533551514f, 0.0737188235f},
-std::array<float,2>{0.382409126f, 0.397327989f},
-std::array<float,2>{0.910153031f, 0.785795033f},
-std::array<float,2>{0.488323748f, 0.672378778f},
-std::array<float,2>{0.986964822f, 0.158588514f},
-std::array<float,2>{0.0771415532f, 0.292923391f},
-std::array<float,2>{0.602361619f, 0.893211842f},
-std::array<float,2>{0.167743638f, 0.835843027f},
-std::array<float,2>{0.741094232f, 0.444514334f},
-std::array<float,2>{0.341081619f, 0.0257163253f},
-std::array<float,2>{0.751294196f, 0.572200358f},
-std::array<float,2>{0.411695689f, 0.759507239f},
-std::array<float,2>{0.882536352f, 0.408826709f},
-std::array<float,2>{0.0608752221f, 0.121980093f},
-std::array<float,2>{0.509138942f, 0.536066175f},
-std::array<float,2>{0.191271976f, 0.707269847f},
-std::array<float,2>{0.687142551f, 0.237627313f},
-std::array<float,2>{0.284729242f, 0.32405749f},
-std::array<float,2>{0.825233281f, 0.943995297f},
-std::array<float,2>{0.3479985f, 0.621955574f},
-std::array<float,2>{0.796481013f, 0.0521831587f},
-std::array<float,2>{0.134761512f, 0.496498108f},
-std::array<float,2>{0.713934004f, 0.872644782f},
-std::array<float,2>{0.111230135f, 0.915124834f},
-std::array<float,2>{0.58972007f, 0.253886074f},
-std::array<float,2>{0.468103975f, 0.138513461f},
-std::array<float,2>{0.953498244f, 0.625789464f},
-std::array<float,2>{0.448446244f, 0.884522259f},
-std::array<float,2>{0.949887037f, 0.311661363f},
-std::array<float,2>{0.0940689817f, 0.185617656f},
-std::array<float,2>{0.577496111f, 0.661924601f},
-std::array<float,2>{0.142827034f, 0.581699848f},
-std::array<float,2>{0.697082341f, 0.0109309964f},
-std::array<float,2>{0.368025333f, 0.467786998f},
-std::array<float,2>{0.811938167f, 0.818152785f},
-std::array<float,2>{0.300244361f, 0.733617365f},
-std::array<float,2>{0.829709053f, 0.199096471f},
-std::array<float,2>{0.212074891f, 0.373211443f},
-std::array<float,2>{0.671664119f, 0.985511005f},
-std::array<float,2>{0.032015495f, 0.797106802f},
-std::array<float,2>{0.51744175f, 0.384092867f},
-std::array<float,2>{0.426216841f, 0.0891671255f},
-std::array<float,2>{0.897624969f, 0.530035555f},
-std::array<float,2>{0.317435592f, 0.850249469f},
-std::array<float,2>{0.77598536f, 0.478398025f},
-std::array<float,2>{0.182112068f, 0.0418317504f},
-std::array<float,2>{0.729466498f, 0.60615623f},
-std::array<float,2>{0.0820930973f, 0.654263794f},
-std::array<float,2>{0.609380603f, 0.154859096f},
-std::array<float,2>{0.477552354f, 0.281024516f},
-std::array<float,2>{0.97936976f, 0.932687998f},
-std::array<float,2>{0.405650526f, 0.555987179f},
-std::array<float,2>{0.928802371f, 0.106872261f},
-std::array<float,2>{0.0221242271f, 0.422662973f},
-std::array<float,2>{0.553837478f, 0.78008467f},
-std::array<float,2>{0.229376987f, 0.967504144f},
-std::array<float,2>{0.627419651f, 0.328357458f},
-std::array<float,2>{0.27144748f, 0.232914791f},
-std::array<float,2>{0.86259836f, 0.694386303f},
-std::array<float,2>{0.268205345f, 0.905055702f},
-std::array<float,2>{0.865375102f, 0.285243869f},
-std::array<float,2>{0.232770607f, 0.166064322f},
-std::array<float,2>{0.62897563f, 0.68134445f},
-std::array<float,2>{0.0185882654f, 0.564113975f},
-std::array<float,2>{0.549768627f, 0.0216080416f},
-std::array<float,2>{0.399248868f, 0.452578992f},
-std::array<float,2>{0.922318757f, 0.840033889f},
-std::array<float,2>{0.480797261f, 0.745285809f},
-std::array<float,2>{0.983975589f, 0.209224582f},
-std::array<float,2>{0.0796403661f, 0.353763252f},
-std::array<float,2>{0.615377128f, 0.984226525f},
-std::array<float,2>{0.187429175f, 0.794895768f},
-std::array<float,2>{0.732799232f, 0.39864397f},
-std::array<float,2>{0.313264519f, 0.0702623352f},
-std::array<float,2>{0.780764341f, 0.50336957f},
-std::array<float,2>{0.423288375f, 0.865890682f},
-std::array<float,2>{0.892394304f, 0.486628413f},
-std::array<float,2>{0.0360210948f, 0.059522789f},
-std::array<float,2>{0.520006001f, 0.615214169f},
-std::array<float,2>{0.218516871f, 0.638576925f},
-std::array<float,2>{0.667336643f, 0.125241816f},
-std::array<float,2>{0.303002834f, 0.263543636f},
-std::array<float,2>{0.832238197f, 0.910644889f},
-std::array<float,2>{0.374747753f, 0.546821415f},
-std::array<float,2>{0.805222869f, 0.113030337f},
-std::array<float,2>{0.14704375f, 0.414211392f},
-std::array<float,2>{0.701677084f, 0.750204206f},
-std::array<float,2>{0.0986722708f, 0.947299719f},
-std::array<float,2>{0.572323501f, 0.317803293f},
-std::array<float,2>{0.451422304f, 0.243185923f},
-std::array<float,2>{0.946316779f, 0.715965152f},
-std::array<float,2>{0.461686701f, 0.99867481f},
-std::array<float,2>{0.958618343f, 0.361549199f},
-std::array<float,2>{0.113717213f, 0.190731928f},
-std::array<float,2>{0.591797829f, 0.723981202f},
-std::array<float,2>{0.139701784f, 0.52331692f},
-std::array<float,2>{0.71598506f, 0.0824840441f},
-std::array<float,2>{0.345713258f, 0.381574124f},
-std::array<float,2>{0.792353153f, 0.811812282f},
-std::array<float,2>{0.286913633f, 0.666971862f},
-std::array<float,2>{0.820480168f, 0.17366606f},
-std::array<float,2>{0.193878248f, 0.302312523f},
-std::array<float,2>{0.680443525f, 0.878905177f},
-std::array<float,2>{0.0561263189f, 0.824754894f},
-std::array<float,2>{0.513493836f, 0.458563298f},
-std::array<float,2>{0.409410268f, 0.00405112561f},
-std::array<float,2>{0.877088428f, 0.590087533f},
-std::array<float,2>{0.336411417f, 0.767906427f},
-std::array<float,2>{0.756830454f, 0.436527312f},
-std::array<float,2>{0.1717733f, 0.0982618183f},
-std::array<float,2>{0.736076534f, 0.552388966f},
-std::array<float,2>{0.0720311478f, 0.701842785f},
-std::array<float,2>{0.607807875f, 0.21893613f},
-std::array<float,2>{0.48461628f, 0.336666763f},
-std::array<float,2>{0.988422692f, 0.954181015f},
-std::array<float,2>{0.375032634f, 0.596867681f},
-std::array<float,2>{0.911848664f, 0.0350427702f},
-std::array<float,2>{0.00682463171f, 0.473375529f},
-std::array<float,2>{0.537848234f, 0.857626736f},
-std::array<float,2>{0.238553077f, 0.928104937f},
-std::array<float,2>{0.650197029f, 0.26835537f},
-std::array<float,2>{0.252670228f, 0.145359889f},
-std::array<float,2>{0.847024918f, 0.644055545f},
-std::array<float,2>{0.353142709f, 0.96114254f},
-std::array<float,2>{0.786953628f, 0.334584087f},
-std::array<float,2>{0.131705642f, 0.229321226f},
-std::array<float,2>{0.703777432f, 0.690808415f},
-std::array<float,2>{0.121519789f, 0.562497854f},
-std::array<float,2>{0.584524393f, 0.104073368f},
-std::array<float,2>{0.455883741f, 0.426930845f},
-std::array<float,2>{0.96872282f, 0.773951173f},
-std::array<float,2>{0.421476811f, 0.652173936f},
-std::array<float,2>{0.88519007f, 0.151825085f},
-std::array<float,2>{0.0471411198f, 0.276978582f},
-std::array<float,2>{0.507502854f, 0.934916019f},
-std::array<float,2>{0.196866512f, 0.84460032f},
-std::array<float,2>{0.673920631f, 0.480580449f},
-std::array<float,2>{0.296363264f, 0.0462022498f},
-std::array<float,2>{0.81944257f, 0.602205276f},
-std::array<float,2>{0.495074809f, 0.803924978f},
-std::array<float,2>{0.997334182f, 0.388458431f},
-std::array<float,2>{0.0635063201f, 0.091171816f},
-std::array<float,2>{0.597070932f, 0.527173638f},
-std::array<float,2>{0.162451535f, 0.728030503f},
-std::array<float,2>{0.74795562f, 0.201000184f},
-std::array<float,2>{0.334325314f, 0.37024653f},
-std::array<float,2>{0.758960783f, 0.992159069f},
-std::array<float,2>{0.260306358f, 0.583148181f},
-std::array<float,2>{0.854979992f, 0.015213253f},
-std::array<float,2>{0.246676251f, 0.462863326f},
-std::array<float,2>{0.641245663f, 0.816063821f},
-std::array<float,2>{0.00918594468f, 0.886927664f},
-std::array<float,2>{0.541892052f, 0.307099283f},
-std::array<float,2>{0.385092884f, 0.181787521f},
-std::array<float,2>{0.918780923f, 0.658886492f},
-std::array<float,2>{0.3950122f, 0.918402314f},
-std::array<float,2>{0.934076369f, 0.256266236f},
-std::array<float,2>{0.0293832868f, 0.134508461f},
-std::array<float,2>{0.559351325f, 0.631700218f},
-std::array<float,2>{0.223222211f, 0.618200839f},
-std::array<float,2>{0.634057522f, 0.0471626073f},
-std::array<float,2>{0.276825815f, 0.494683027f},
-std::array<float,2>{0.871942997f, 0.870634139f},
-std::array<float,2>{0.322418571f, 0.704811215f},
-std::array<float,2>{0.77294147f, 0.238340631f},
-std::array<float,2>{0.172949269f, 0.325575471f},
-std::array<float,2>{0.719280481f, 0.940761924f},
-std::array<float,2>{0.0904152915f, 0.76497829f},
-std::array<float,2>{0.621356308f, 0.412478715f},
-std::array<float,2>{0.473612964f, 0.118455157f},
-std::array<float,2>{0.971873939f, 0.532813907f},
-std::array<float,2>{0.310975999f, 0.831346869f},
-std::array<float,2>{0.836234212f, 0.438145638f},
-std::array<float,2>{0.205915168f, 0.0297418106f},
-std::array<float,2>{0.659560859f, 0.576840937f},
-std::array<float,2>{0.0407176353f, 0.675938606f},
-std::array<float,2>{0.527986467f, 0.162972242f},
-std::array<float,2>{0.435820758f, 0.295074761f},
-std::array<float,2>{0.900236309f, 0.897415161f},
-std::array<float,2>{0.439010859f, 0.508557856f},
-std::array<float,2>{0.943306744f, 0.0742835477f},
-std::array<float,2>{0.107017174f, 0.394288749f},
-std::array<float,2>{0.568701386f, 0.785089552f},
-std::array<float,2>{0.152602524f, 0.971109211f},
-std::array<float,2>{0.694369256f, 0.349855989f},
-std::array<float,2>{0.365440667f, 0.213857278f},
-std::array<float,2>{0.803106666f, 0.734658778f},
-std::array<float,2>{0.318426937f, 0.93337661f},
-std::array<float,2>{0.773552001f, 0.28073886f},
-std::array<float,2>{0.181120366f, 0.154571638f},
-std::array<float,2>{0.726931989f, 0.653726161f},
-std::array<float,2>{0.0840264931f, 0.605897665f},
-std::array<float,2>{0.612920463f, 0.0414203554f},
-std::array<float,2>{0.479879528f, 0.477953672f},
-std::array<float,2>{0.976937532f, 0.849923551f},
-std::array<float,2>{0.40273571f, 0.695188642f},
-std::array<float,2>{0.926572919f, 0.232689261f},
-std::array<float,2>{0.0200189278f, 0.329098195f},
-std::array<float,2>{0.552626133f, 0.966888189f},
-std::array<float,2>{0.227304608f, 0.779390752f},
-std::array<float,2>{0.625805557f, 0.422038794f},
-std::array<float,2>{0.27156651f, 0.107077852f},
-std::array<float,2>{0.859398901f, 0.556216598f},
-std::array<float,2>{0.447105944f, 0.817804933f},
-std::array<float,2>{0.951660275f, 0.46859327f},
-std::array<float,2>{0.096530579f, 0.0115335872f},
-std::array<float,2>{0.575148225f, 0.581074595f},
-std::array<float,2>{0.1410947f, 0.661137879f},
-std::array<float,2>{0.698808014f, 0.186290354f},
-std::array<float,2>{0.370785028f, 0.312291533f},
-std::array<float,2>{0.808643699f, 0.884063542f},
-std::array<float,2>{0.298178136f, 0.529592097f},
-std::array<float,2>{0.830824375f, 0.0896843299f},
-std::array<float,2>{0.21429953f, 0.384657264f},
-std::array<float,2>{0.668786526f, 0.797631443f},
-std::array<float,2>{0.0349207707f, 0.986023903f},
-std::array<float,2>{0.517742276f, 0.373670965f},
-std::array<float,2>{0.427832156f, 0.198330462f},
-std::array<float,2>{0.89599514f, 0.733933032f},
-std::array<float,2>{0.413451821f, 0.943487763f},
-std::array<float,2>{0.880442679f, 0.323670745f},
-std::array<float,2>{0.059381865f, 0.237836033f},
-std::array<float,2>{0.511593938f, 0.707799137f},
-std::array<float,2>{0.188880339f, 0.535163522f},
-std::array<float,2>{0.684826255f, 0.121214338f},
-std::array<float,2>{0.282298297f, 0.408644319f},
-std::array<float,2>{0.82654804f, 0.759235144f},
-std::array<float,2>{0.350151539f, 0.625058472f},
-std::array<float,2>{0.793217599f, 0.13781181f},
-std::array<float,2>{0.136245728f, 0.253186136f},
-std::array<float,2>{0.711732566f, 0.915614605f},
-std::array<float,2>{0.112401858f, 0.872178853f},
-std::array<float,2>{0.586342394f, 0.496926218f},
-std::array<float,2>{0.466195822f, 0.0522539802f},
-std::array<float,2>{0.95683068f, 0.621385694f},
-std::array<float,2>{0.257137328f, 0.78523308f},
-std::array<float,2>{0.851326168f, 0.396831393f},
-std::array<float,2>{0.2374551f, 0.0741160139f},
-std::array<float,2>{0.655628443f, 0.512950003f},
-std::array<float,2>{0.000471870386f, 0.739489615f},
-std::array<float,2>{0.532953799f, 0.215627223f},
-std::array<float,2>{0.380766809f, 0.343796879f},
-std::array<float,2>{0.906517625f, 0.975149751f},
-std::array<float,2>{0.490461737f, 0.571641326f},
-std::array<float,2>{0.985785782f, 0.0261581521f},
-std::array<float,2>{0.0753313974f, 0.445151299f},
-std::array<float,2>{0.604433835f, 0.835414827f},
-std::array<float,2>{0.164448529f, 0.892807543f},
-std::array<float,2>{0.740214646f, 0.2919994f},
-std::array<float,2>{0.342304438f, 0.159119949f},
-std::array<float,2>{0.753465891f, 0.671981871f},
-std::array<float,2>{0.291963995f, 0.977662563f},
-std::array<float,2>{0.813640893f, 0.35562855f},
-std::array<float,2>{0.201112196f, 0.206013829f},
-std::array<float,2>{0.679361224f, 0.746375263f},
-std::array<float,2>{0.0516035631f, 0.506487906f},
-std::array<float,2>{0.503227293f, 0.0650254861f},
-std::array<float,2>{0.414603174f, 0.405915737f},
-std::array<float,2>{0.889641583f, 0.791139483f},
-std::array<float,2>{0.458278209f, 0.686931491f},
-std::array<float,2>{0.962088525f, 0.168932155f},
-std::array<float,2>{0.118553512f, 0.284754187f},
-std::array<float,2>{0.580146372f, 0.898619294f},
-std::array<float,2>{0.128752068f, 0.837456882f},
-std::array<float,2>{0.709178984f, 0.448897213f},
-std::array<float,2>{0.358127952f, 0.0164915938f},
-std::array<float,2>{0.783110678f, 0.569735527f},
-std::array<float,2>{0.388358384f, 0.75620389f},
-std::array<float,2>{0.917233765f, 0.41864711f},
-std::array<float,2>{0.0127208987f, 0.114920795f},
-std::array<float,2>{0.544659436f, 0.53944689f},
-std::array<float,2>{0.245568976f, 0.713572621f},
-std::array<float,2>{0.645263433f, 0.249070555f},
-std::array<float,2>{0.26494664f, 0.316272438f},
-std::array<float,2>{0.855685771f, 0.950795352f},
-std::array<float,2>{0.329114735f, 0.61089772f},
-std::array<float,2>{0.763054967f, 0.0574102551f},
-std::array<float,2>{0.157180399f, 0.489048481f},
-std::array<float,2>{0.745338619f, 0.862395823f},
-std::array<float,2>{0.0665202811f, 0.909259439f},
-std::array<float,2>{0.599941194f, 0.258162409f},
-std::array<float,2>{0.496342719f, 0.13267985f},
-std::array<float,2>{0.99563998f, 0.636346757f},
-std::array<float,2>{0.469620407f, 0.881005049f},
-std::array<float,2>{0.975446522f, 0.29863739f},
-std::array<float,2>{0.0883380398f, 0.175825298f},
-std::array<float,2>{0.620709658f, 0.667996585f},
-std::array<float,2>{0.177458555f, 0.586036801f},
-std::array<float,2>{0.726527691f, 0.000171875639f},
-std::array<float,2>{0.327415973f, 0.454507023f},
-std::array<float,2>{0.767933071f, 0.823358893f},
-std::array<float,2>{0.280206025f, 0.722620428f},
-std::array<float,2>{0.870594561f, 0.192558214f},
-std::array<float,2>{0.220082879f, 0.365367979f},
-std::array<float,2>{0.638188779f, 0.995662034f},
-std::array<float,2>{0.0248805266f, 0.804854989f},
-std::array<float,2>{0.55505389f, 0.375253171f},
-std::array<float,2>{0.390805721f, 0.0815158039f},
-std::array<float,2>{0.932460785f, 0.519048274f},
-std::array<float,2>{0.361898929f, 0.852691591f},
-std::array<float,2>{0.797822177f, 0.469027936f},
-std::array<float,2>{0.151555836f, 0.035948649f},
-std::array<float,2>{0.68891871f, 0.600151658f},
-std::array<float,2>{0.103130519f, 0.648357987f},
-std::array<float,2>{0.564312994f, 0.143779457f},
-std::array<float,2>{0.443126321f, 0.270235151f},
-std::array<float,2>{0.938589871f, 0.925257206f},
-std::array<float,2>{0.432697713f, 0.548426807f},
-std::array<float,2>{0.904023588f, 0.0950626209f},
-std::array<float,2>{0.0451802574f, 0.430686742f},
-std::array<float,2>{0.524468899f, 0.771768212f},
-std::array<float,2>{0.207717225f, 0.960337043f},
-std::array<float,2>{0.661809206f, 0.343243867f},
-std::array<float,2>{0.305945069f, 0.222747698f},
-std::array<float,2>{0.841284692f, 0.695315361f},
-std::array<float,2>{0.302717984f, 0.913057446f},
-std::array<float,2>{0.834795654f, 0.264703095f},
-std::array<float,2>{0.215254992f, 0.127435654f},
-std::array<float,2>{0.665235639f, 0.640039742f},
-std::array<float,2>{0.0387362093f, 0.615766108f},
-std::array<float,2>{0.52282089f, 0.062131092f},
-std::array<float,2>{0.42484796f, 0.485700905f},
-std::array<float,2>{0.894322932f, 0.863500059f},
-std::array<float,2>{0.450271249f, 0.71860677f},
-std::array<float,2>{0.949078023f, 0.244182408f},
-std::array<float,2>{0.0996644348f, 0.318596035f},
-std::array<float,2>{0.571932673f, 0.946832895f},
-std::array<float,2>{0.146318749f, 0.753848732f},
-std::array<float,2>{0.700158477f, 0.417170256f},
-std::array<float,2>{0.372248232f, 0.109474063f},
-std::array<float,2>{0.80781579f, 0.543001592f},
-std::array<float,2>{0.401749969f, 0.842870533f},
-std::array<float,2>{0.924594939f, 0.449719399f},
-std::array<float,2>{0.0172198713f, 0.0206858367f},
-std::array<float,2>{0.548650146f, 0.565025389f},
-std::array<float,2>{0.231202155f, 0.682664573f},
-std::array<float,2>{0.631799638f, 0.165195867f},
-std::array<float,2>{0.265848905f, 0.28852433f},
-std::array<float,2>{0.865134597f, 0.902848184f},
-std::array<float,2>{0.315739512f, 0.500384331f},
-std::array<float,2>{0.77853632f, 0.0666426048f},
-std::array<float,2>{0.183634743f, 0.400652528f},
-std::array<float,2>{0.732001543f, 0.796717644f},
-std::array<float,2>{0.0814082772f, 0.981254339f},
-std::array<float,2>{0.614521742f, 0.352105945f},
-std::array<float,2>{0.483898789f, 0.208295196f},
-std::array<float,2>{0.981907904f, 0.742976069f},
-std::array<float,2>{0.4863666f, 0.956913054f},
-std::array<float,2>{0.991155744f, 0.338403761f},
-std::array<float,2>{0.0728529096f, 0.222070023f},
-std::array<float,2>{0.606053829f, 0.701158524f},
-std::array<float,2>{0.168088451f, 0.554397047f},
-std::array<float,2>{0.737787485f, 0.0998437554f},
-std::array<float,2>{0.338359833f, 0.435169339f},
-std::array<float,2>{0.754602551f, 0.766732693f},
-std::array<float,2>{0.25085637f, 0.640854299f},
-std::array<float,2>{0.84463799f, 0.146497682f},
-std::array<float,2>{0.241933629f, 0.267568111f},
-std::array<float,2>{0.650561213f, 0.927238643f},
-std::array<float,2>{0.00399047229f, 0.856270194f},
-std::array<float,2>{0.536680222f, 0.475872368f},
-std::array<float,2>{0.377268344f, 0.0315317102f},
-std::array<float,2>{0.91260457f, 0.595020175f},
-std::array<float,2>{0.345098525f, 0.809062958f},
-std::array<float,2>{0.790867686f, 0.379772753f},
-std::array<float,2>{0.138467044f, 0.0842533261f},
-std::array<float,2>{0.717708051f, 0.521353126f},
-std::array<float,2>{0.116333358f, 0.726386786f},
-std::array<float,2>{0.590383112f, 0.188083723f},
-std::array<float,2>{0.463012308f, 0.359770745f},
-std::array<float,2>{0.9604913f, 0.997780681f},
-std::array<float,2>{0.408085525f, 0.592426717f},
-std::array<float,2>{0.876543462f, 0.00685231015f},
-std::array<float,2>{0.0579268634f, 0.460810095f},
-std::array<float,2>{0.514112473f, 0.82618916f},
-std::array<float,2>{0.19227913f, 0.876653552f},
-std::array<float,2>{0.681815863f, 0.30355528f},
-std::array<float,2>{0.287734836f, 0.175485522f},
-std::array<float,2>{0.823755443f, 0.665631175f},
-std::array<float,2>{0.333782941f, 0.989282548f},
-std::array<float,2>{0.761098921f, 0.367644101f},
-std::array<float,2>{0.160727382f, 0.202554524f},
-std::array<float,2>{0.749354422f, 0.73030293f},
-std::array<float,2>{0.0655749068f, 0.524078429f},
-std::array<float,2>{0.594555736f, 0.0936491117f},
-std::array<float,2>{0.493437111f, 0.389790177f},
-std::array<float,2>{0.999209583f, 0.801775634f},
-std::array<float,2>{0.383779466f, 0.657188416f},
-std::array<float,2>{0.919992745f, 0.181311935f},
-std::array<float,2>{0.0104329223f, 0.30642885f},
-std::array<float,2>{0.539285123f, 0.890335977f},
-std::array<float,2>{0.248667315f, 0.814035892f},
-std::array<float,2>{0.644158006f, 0.463450044f},
-std::array<float,2>{0.259099811f, 0.0131010208f},
-std::array<float,2>{0.851718783f, 0.585328877f},
-std::array<float,2>{0.453187704f, 0.777086318f},
-std::array<float,2>{0.965706825f, 0.429154456f},
-std::array<float,2>{0.124640003f, 0.101588026f},
-std::array<float,2>{0.58315897f, 0.560305774f},
-std::array<float,2>{0.130736023f, 0.688249588f},
-std::array<float,2>{0.706293702f, 0.227136299f},
-std::array<float,2>{0.354516327f, 0.332463741f},
-std::array<float,2>{0.787293255f, 0.963719785f},
-std::array<float,2>{0.293841362f, 0.605367661f},
-std::array<float,2>{0.816752017f, 0.0432153344f},
-std::array<float,2>{0.197487846f, 0.483885288f},
-std::array<float,2>{0.671886027f, 0.847269118f},
-std::array<float,2>{0.0499831587f, 0.936257601f},
-std::array<float,2>{0.503913045f, 0.274648339f},
-std::array<float,2>{0.419243634f, 0.150027528f},
-std::array<float,2>{0.88390106f, 0.648586094f},
-std::array<float,2>{0.434550405f, 0.896152139f},
-std::array<float,2>{0.901581466f, 0.294218153f},
-std::array<float,2>{0.0413833633f, 0.161003411f},
-std::array<float,2>{0.529751182f, 0.679527879f},
-std::array<float,2>{0.203509629f, 0.574816108f},
-std::array<float,2>{0.657139659f, 0.0274962224f},
-std::array<float,2>{0.309706599f, 0.440344602f},
-std::array<float,2>{0.838385999f, 0.829019368f},
-std::array<float,2>{0.364332348f, 0.736715496f},
-std::array<float,2>{0.801898241f, 0.212515205f},
-std::array<float,2>{0.155587092f, 0.349025518f},
-std::array<float,2>{0.69300878f, 0.969475865f},
-std::array<float,2>{0.108948901f, 0.783043146f},
-std::array<float,2>{0.567113101f, 0.391658813f},
-std::array<float,2>{0.441119879f, 0.0768109038f},
-std::array<float,2>{0.944015443f, 0.510935664f},
-std::array<float,2>{0.275357157f, 0.868637919f},
-std::array<float,2>{0.873769462f, 0.493363172f},
-std::array<float,2>{0.225675896f, 0.0492518209f},
-std::array<float,2>{0.63504678f, 0.620165408f},
-std::array<float,2>{0.0286859702f, 0.629843473f},
-std::array<float,2>{0.560811102f, 0.134947196f},
-std::array<float,2>{0.396571964f, 0.255468041f},
-std::array<float,2>{0.936676502f, 0.920725703f},
-std::array<float,2>{0.476472974f, 0.53456521f},
-std::array<float,2>{0.970062554f, 0.119609348f},
-std::array<float,2>{0.0921809524f, 0.410958678f},
-std::array<float,2>{0.624691963f, 0.762477219f},
-std::array<float,2>{0.173953354f, 0.938782036f},
-std::array<float,2>{0.72225827f, 0.326729804f},
-std::array<float,2>{0.321034104f, 0.240548953f},
-std::array<float,2>{0.770126581f, 0.706175625f},
-std::array<float,2>{0.367240012f, 0.885375321f},
-std::array<float,2>{0.812395513f, 0.309843153f},
-std::array<float,2>{0.143335313f, 0.184106708f},
-std::array<float,2>{0.696472704f, 0.663390279f},
-std::array<float,2>{0.0942944065f, 0.579897881f},
-std::array<float,2>{0.578104615f, 0.00789617375f},
-std::array<float,2>{0.449196339f, 0.466108769f},
-std::array<float,2>{0.949237168f, 0.818735003f},
-std::array<float,2>{0.426675916f, 0.732122242f},
-std::array<float,2>{0.898009777f, 0.195796996f},
-std::array<float,2>{0.0316341333f, 0.372717768f},
-std::array<float,2>{0.516931653f, 0.986578822f},
-std::array<float,2>{0.21280852f, 0.800655365f},
-std::array<float,2>{0.671184838f, 0.386530101f},
-std::array<float,2>{0.300483882f, 0.0877194479f},
-std::array<float,2>{0.829420924f, 0.528685093f},
-std::array<float,2>{0.478053987f, 0.847725034f},
-std::array<float,2>{0.9787907f, 0.478818148f},
-std::array<float,2>{0.0825972483f, 0.0408461913f},
-std::array<float,2>{0.609871149f, 0.607544243f},
-std::array<float,2>{0.18255727f, 0.654722273f},
-std::array<float,2>{0.728858948f, 0.152512357f},
-std::array<float,2>{0.318188936f, 0.277920276f},
-std::array<float,2>{0.775567591f, 0.930252075f},
-std::array<float,2>{0.270663977f, 0.557070792f},
-std::array<float,2>{0.86295861f, 0.109126881f},
-std::array<float,2>{0.228635803f, 0.424402863f},
-std::array<float,2>{0.627654016f, 0.778786957f},
-std::array<float,2>{0.0218912419f, 0.965101779f},
-std::array<float,2>{0.554350078f, 0.3314915f},
-std::array<float,2>{0.406100273f, 0.231900573f},
-std::array<float,2>{0.929338694f, 0.692068338f},
-std::array<float,2>{0.382236779f, 0.972852588f},
-std::array<float,2>{0.909644544f, 0.346330583f},
-std::array<float,2>{0.00339754252f, 0.218666375f},
-std::array<float,2>{0.533715129f, 0.741754651f},
-std::array<float,2>{0.235435694f, 0.515193939f},
-std::array<float,2>{0.654037476f, 0.0705138817f},
-std::array<float,2>{0.254606515f, 0.394955844f},
-std::array<float,2>{0.84837842f, 0.787951648f},
-std::array<float,2>{0.341677874f, 0.67400068f},
-std::array<float,2>{0.751616418f, 0.156687677f},
-std::array<float,2>{0.167033017f, 0.290015399f},
-std::array<float,2>{0.740679443f, 0.891155779f},
-std::array<float,2>{0.0761768594f, 0.833900809f},
-std::array<float,2>{0.601755679f, 0.442761242f},
-std::array<float,2>{0.489246398f, 0.0240593106f},
-std::array<float,2>{0.986557066f, 0.572504997f},
-std::array<float,2>{0.284558266f, 0.761166334f},
-std::array<float,2>{0.826010168f, 0.406943113f},
-std::array<float,2>{0.190450892f, 0.124311008f},
-std::array<float,2>{0.686731577f, 0.537362099f},
-std::array<float,2>{0.0610950552f, 0.710443139f},
-std::array<float,2>{0.509494722f, 0.234595805f},
-std::array<float,2>{0.411461622f, 0.321709454f},
-std::array<float,2>{0.881997764f, 0.943296075f},
-std::array<float,2>{0.468367279f, 0.624871612f},
-std::array<float,2>{0.954024076f, 0.0531690344f},
-std::array<float,2>{0.110453181f, 0.498298258f},
-std::array<float,2>{0.589297295f, 0.873858452f},
-std::array<float,2>{0.134191424f, 0.91719681f},
-std::array<float,2>{0.714451373f, 0.251896083f},
-std::array<float,2>{0.348551869f, 0.140082479f},
-std::array<float,2>{0.796289206f, 0.628582537f},
-std::array<float,2>{0.262940854f, 0.951957762f},
-std::array<float,2>{0.85759747f, 0.313610345f},
-std::array<float,2>{0.242240191f, 0.247332349f},
-std::array<float,2>{0.646552444f, 0.712645113f},
-std::array<float,2>{0.0147285033f, 0.541989744f},
-std::array<float,2>{0.546753883f, 0.116394162f},
-std::array<float,2>{0.38991788f, 0.421507746f},
-std::array<float,2>{0.914449751f, 0.755522549f},
-std::array<float,2>{0.49986732f, 0.633714318f},
-std::array<float,2>{0.993334413f, 0.130719632f},
-std::array<float,2>{0.0691675916f, 0.260749459f},
-std::array<float,2>{0.597813785f, 0.906908512f},
-std::array<float,2>{0.159166217f, 0.859771192f},
-std::array<float,2>{0.74391675f, 0.491341114f},
-std::array<float,2>{0.331317127f, 0.0560963601f},
-std::array<float,2>{0.764522433f, 0.611698985f},
-std::array<float,2>{0.416733414f, 0.790844262f},
-std::array<float,2>{0.88864994f, 0.404019028f},
-std::array<float,2>{0.0529015623f, 0.0641230121f},
-std::array<float,2>{0.501303256f, 0.504881382f},
-std::array<float,2>{0.201880231f, 0.749073267f},
-std::array<float,2>{0.677501202f, 0.204439193f},
-std::array<float,2>{0.29031387f, 0.358950138f},
-std::array<float,2>{0.81480062f, 0.979214489f},
-std::array<float,2>{0.35700047f, 0.566606224f},
-std::array<float,2>{0.784796894f, 0.0177471135f},
-std::array<float,2>{0.126429304f, 0.447081923f},
-std::array<float,2>{0.708655059f, 0.838608742f},
-std::array<float,2>{0.119998731f, 0.900698066f},
-std::array<float,2>{0.578350127f, 0.282126606f},
-std::array<float,2>{0.459636271f, 0.171628058f},
-std::array<float,2>{0.963737071f, 0.68405664f},
-std::array<float,2>{0.443511516f, 0.92237711f},
-std::array<float,2>{0.940829456f, 0.273042351f},
-std::array<float,2>{0.104580484f, 0.141621426f},
-std::array<float,2>{0.565255284f, 0.645734191f},
-std::array<float,2>{0.149151683f, 0.598472118f},
-std::array<float,2>{0.691324353f, 0.0382631011f},
-std::array<float,2>{0.359402478f, 0.471460253f},
-std::array<float,2>{0.799535573f, 0.855043769f},
-std::array<float,2>{0.307066798f, 0.698968887f},
-std::array<float,2>{0.842672348f, 0.226256475f},
-std::array<float,2>{0.210421562f, 0.340904623f},
-std::array<float,2>{0.662353992f, 0.958223939f},
-std::array<float,2>{0.0433948115f, 0.770068944f},
-std::array<float,2>{0.52597785f, 0.433591664f},
-std::array<float,2>{0.431062758f, 0.0975216478f},
-std::array<float,2>{0.905488253f, 0.55031997f},
-std::array<float,2>{0.32577616f, 0.822202146f},
-std::array<float,2>{0.767004848f, 0.456501544f},
-std::array<float,2>{0.178750679f, 0.00247264886f},
-std::array<float,2>{0.723629057f, 0.589615464f},
-std::array<float,2>{0.0864724517f, 0.670784712f},
-std::array<float,2>{0.618580222f, 0.179549679f},
-std::array<float,2>{0.472552389f, 0.300087184f},
-std::array<float,2>{0.973272443f, 0.879875898f},
-std::array<float,2>{0.393293083f, 0.515758574f},
-std::array<float,2>{0.930507541f, 0.0783573315f},
-std::array<float,2>{0.025820652f, 0.377786398f},
-std::array<float,2>{0.557296216f, 0.807494223f},
-std::array<float,2>{0.221781924f, 0.993217111f},
-std::array<float,2>{0.64016068f, 0.365230381f},
-std::array<float,2>{0.277948797f, 0.19459489f},
-std::array<float,2>{0.868500412f, 0.720207095f},
-std::array<float,2>{0.253403783f, 0.926490605f},
-std::array<float,2>{0.846615016f, 0.266465515f},
-std::array<float,2>{0.240036741f, 0.14835915f},
-std::array<float,2>{0.648892939f, 0.642537594f},
-std::array<float,2>{0.00710441172f, 0.594717145f},
-std::array<float,2>{0.538504064f, 0.0323498324f},
-std::array<float,2>{0.376801759f, 0.475157082f},
-std::array<float,2>{0.910707474f, 0.857246578f},
-std::array<float,2>{0.486124337f, 0.69952327f},
-std::array<float,2>{0.989803731f, 0.22119239f},
-std::array<float,2>{0.0705779716f, 0.33896488f},
-std::array<float,2>{0.608765662f, 0.955737352f},
-std::array<float,2>{0.170770794f, 0.765891612f},
-std::array<float,2>{0.735285223f, 0.433700502f},
-std::array<float,2>{0.337675065f, 0.101131856f},
-std::array<float,2>{0.757492542f, 0.55360347f},
-std::array<float,2>{0.408659935f, 0.827605247f},
-std::array<float,2>{0.87853384f, 0.45900324f},
-std::array<float,2>{0.0555526949f, 0.006011636f},
-std::array<float,2>{0.512455702f, 0.592997313f},
-std::array<float,2>{0.195198923f, 0.664624393f},
-std::array<float,2>{0.681124568f, 0.17408964f},
-std::array<float,2>{0.285689622f, 0.304460973f},
-std::array<float,2>{0.822179794f, 0.875094056f},
-std::array<float,2>{0.347063214f, 0.520499468f},
-std::array<float,2>{0.791746318f, 0.0851628706f},
-std::array<float,2>{0.139254421f, 0.380039901f},
-std::array<float,2>{0.715436161f, 0.81025362f},
-std::array<float,2>{0.114599161f, 0.996376395f},
-std::array<float,2>{0.592866182f, 0.360782743f},
-std::array<float,2>{0.462124467f, 0.189343944f},
-std::array<float,2>{0.95738852f, 0.725422263f},
-std::array<float,2>{0.452721655f, 0.945623994f},
-std::array<float,2>{0.945522666f, 0.319647074f},
-std::array<float,2>{0.0981022716f, 0.245294452f},
-std::array<float,2>{0.573923886f, 0.717720747f},
-std::array<float,2>{0.147588417f, 0.544408381f},
-std::array<float,2>{0.702617943f, 0.111226954f},
-std::array<float,2>{0.373665094f, 0.416817874f},
-std::array<float,2>{0.80651927f, 0.752671719f},
-std::array<float,2>{0.303772002f, 0.638958573f},
-std::array<float,2>{0.833273053f, 0.128001213f},
-std::array<float,2>{0.217094019f, 0.264634132f},
-std::array<float,2>{0.66696018f, 0.913738728f},
-std::array<float,2>{0.0364264175f, 0.865067065f},
-std::array<float,2>{0.520868063f, 0.48502028f},
-std::array<float,2>{0.422517449f, 0.0613579936f},
-std::array<float,2>{0.891485512f, 0.616480529f},
-std::array<float,2>{0.313960612f, 0.795721769f},
-std::array<float,2>{0.779688597f, 0.402055085f},
-std::array<float,2>{0.186176196f, 0.0675859526f},
-std::array<float,2>{0.7335307f, 0.500978887f},
-std::array<float,2>{0.0790658221f, 0.74396044f},
-std::array<float,2>{0.616490304f, 0.207204133f},
-std::array<float,2>{0.482224166f, 0.353274971f},
-std::array<float,2>{0.982836604f, 0.981782198f},
-std::array<float,2>{0.399489403f, 0.565883875f},
-std::array<float,2>{0.923174739f, 0.0204909015f},
-std::array<float,2>{0.0178614277f, 0.450197011f},
-std::array<float,2>{0.550665379f, 0.842468858f},
-std::array<float,2>{0.233739793f, 0.903604865f},
-std::array<float,2>{0.630782485f, 0.287954569f},
-std::array<float,2>{0.26913029f, 0.164333582f},
-std::array<float,2>{0.86638242f, 0.682079196f},
-std::array<float,2>{0.366231173f, 0.970695496f},
-std::array<float,2>{0.803954899f, 0.34797442f},
-std::array<float,2>{0.153425306f, 0.211724415f},
-std::array<float,2>{0.6934641f, 0.737317324f},
-std::array<float,2>{0.106133878f, 0.509832442f},
-std::array<float,2>{0.570090413f, 0.0779661387f},
-std::array<float,2>{0.4375588f, 0.391131103f},
-std::array<float,2>{0.94159323f, 0.782126188f},
-std::array<float,2>{0.437254757f, 0.677857399f},
-std::array<float,2>{0.898467243f, 0.161842614f},
-std::array<float,2>{0.0398120582f, 0.293851793f},
-std::array<float,2>{0.529146194f, 0.895198584f},
-std::array<float,2>{0.206067473f, 0.829498887f},
-std::array<float,2>{0.659102201f, 0.440452337f},
-std::array<float,2>{0.311880469f, 0.0284496415f},
-std::array<float,2>{0.837345898f, 0.575516343f},
-std::array<float,2>{0.473856926f, 0.762853563f},
-std::array<float,2>{0.971258521f, 0.411395639f},
-std::array<float,2>{0.0912827402f, 0.12083666f},
-std::array<float,2>{0.622790635f, 0.534006059f},
-std::array<float,2>{0.172128528f, 0.70555532f},
-std::array<float,2>{0.720693886f, 0.241356105f},
-std::array<float,2>{0.323484719f, 0.327999562f},
-std::array<float,2>{0.772089481f, 0.937666118f},
-std::array<float,2>{0.27590698f, 0.619748771f},
-std::array<float,2>{0.872454762f, 0.050714504f},
-std::array<float,2>{0.223999545f, 0.492474765f},
-std::array<float,2>{0.632860661f, 0.867471397f},
-std::array<float,2>{0.0310586169f, 0.921329796f},
-std::array<float,2>{0.560468256f, 0.254873633f},
-std::array<float,2>{0.395524919f, 0.135993689f},
-std::array<float,2>{0.934611142f, 0.630511045f},
-std::array<float,2>{0.38642779f, 0.888788223f},
-std::array<float,2>{0.919593275f, 0.305521369f},
-std::array<float,2>{0.00878231879f, 0.180290848f},
-std::array<float,2>{0.542944849f, 0.657611191f},
-std::array<float,2>{0.247876704f, 0.584500492f},
-std::array<float,2>{0.64192456f, 0.0125927748f},
-std::array<float,2>{0.261057377f, 0.46434328f},
-std::array<float,2>{0.854231656f, 0.812630057f},
-std::array<float,2>{0.335266888f, 0.728859723f},
-std::array<float,2>{0.758667529f, 0.201718271f},
-std::array<float,2>{0.163178429f, 0.369036585f},
-std::array<float,2>{0.746640563f, 0.988780439f},
-std::array<float,2>{0.0632071421f, 0.800884962f},
-std::array<float,2>{0.596191287f, 0.389348507f},
-std::array<float,2>{0.495229036f, 0.0924839675f},
-std::array<float,2>{0.996916592f, 0.524797797f},
-std::array<float,2>{0.295835555f, 0.845828176f},
-std::array<float,2>{0.819192529f, 0.482550412f},
-std::array<float,2>{0.195366144f, 0.0443711877f},
-std::array<float,2>{0.675168395f, 0.603672802f},
-std::array<float,2>{0.0479678288f, 0.650344849f},
-std::array<float,2>{0.506080568f, 0.149314806f},
-std::array<float,2>{0.420599252f, 0.27411148f},
-std::array<float,2>{0.885842323f, 0.93675071f},
-std::array<float,2>{0.456644356f, 0.559490025f},
-std::array<float,2>{0.967374682f, 0.103232071f},
-std::array<float,2>{0.122333318f, 0.428499967f},
-std::array<float,2>{0.585547507f, 0.775436878f},
-std::array<float,2>{0.131940097f, 0.964089513f},
-std::array<float,2>{0.705024302f, 0.333058923f},
-std::array<float,2>{0.35228613f, 0.228194654f},
-std::array<float,2>{0.785337508f, 0.689358115f},
-std::array<float,2>{0.343514323f, 0.89161849f},
-std::array<float,2>{0.752432048f, 0.29085055f},
-std::array<float,2>{0.16564098f, 0.157877088f},
-std::array<float,2>{0.738424718f, 0.675050735f},
-std::array<float,2>{0.0747569427f, 0.573804855f},
-std::array<float,2>{0.605239987f, 0.0252985656f},
-std::array<float,2>{0.491749734f, 0.441413194f},
-std::array<float,2>{0.984667599f, 0.832254052f},
-std::array<float,2>{0.379149646f, 0.740384698f},
-std::array<float,2>{0.907327592f, 0.217490092f},
-std::array<float,2>{0.00114561326f, 0.347194076f},
-std::array<float,2>{0.531692743f, 0.974484921f},
-std::array<float,2>{0.236720219f, 0.788485169f},
-std::array<float,2>{0.655128121f, 0.396116436f},
-std::array<float,2>{0.256362796f, 0.0717193931f},
-std::array<float,2>{0.85031867f, 0.51422596f},
-std::array<float,2>{0.465034187f, 0.874556482f},
-std::array<float,2>{0.95551455f, 0.499668211f},
-std::array<float,2>{0.111328647f, 0.0542294309f},
-std::array<float,2>{0.587776184f, 0.623482883f},
-std::array<float,2>{0.134925991f, 0.627357244f},
-std::array<float,2>{0.712826967f, 0.138718933f},
-std::array<float,2>{0.351185173f, 0.250244617f},
-std::array<float,2>{0.794784307f, 0.916358531f},
-std::array<float,2>{0.282219857f, 0.538185954f},
-std::array<float,2>{0.828012824f, 0.123053201f},
-std::array<float,2>{0.188107416f, 0.407973528f},
-std::array<float,2>{0.684270024f, 0.759861171f},
-std::array<float,2>{0.0602142178f, 0.941439092f},
-std::array<float,2>{0.509968162f, 0.320429415f},
-std::array<float,2>{0.412925154f, 0.235661492f},
-std::array<float,2>{0.879840732f, 0.70909518f},
-std::array<float,2>{0.428907067f, 0.988056004f},
-std::array<float,2>{0.894911945f, 0.371582091f},
-std::array<float,2>{0.0341213606f, 0.196419224f},
-std::array<float,2>{0.518971145f, 0.731117845f},
-std::array<float,2>{0.21350579f, 0.527803898f},
-std::array<float,2>{0.669158459f, 0.0866354108f},
-std::array<float,2>{0.29780075f, 0.385738373f},
-std::array<float,2>{0.831514418f, 0.799471915f},
-std::array<float,2>{0.370030671f, 0.662258208f},
-std::array<float,2>{0.809753299f, 0.185495168f},
-std::array<float,2>{0.142369583f, 0.309065819f},
-std::array<float,2>{0.697608948f, 0.88637358f},
-std::array<float,2>{0.0970875993f, 0.819357038f},
-std::array<float,2>{0.575865924f, 0.465260744f},
-std::array<float,2>{0.446095854f, 0.00956334081f},
-std::array<float,2>{0.95238024f, 0.578806937f},
-std::array<float,2>{0.272510916f, 0.777932882f},
-std::array<float,2>{0.860516489f, 0.425368398f},
-std::array<float,2>{0.227898091f, 0.108269639f},
-std::array<float,2>{0.626510501f, 0.557962954f},
-std::array<float,2>{0.0206081383f, 0.692700863f},
-std::array<float,2>{0.55134058f, 0.230941042f},
-std::array<float,2>{0.403795958f, 0.330598682f},
-std::array<float,2>{0.927380204f, 0.966297746f},
-std::array<float,2>{0.478783429f, 0.60921061f},
-std::array<float,2>{0.978345156f, 0.0395070538f},
-std::array<float,2>{0.085771136f, 0.479567468f},
-std::array<float,2>{0.611710846f, 0.849212289f},
-std::array<float,2>{0.180307955f, 0.93115288f},
-std::array<float,2>{0.728239536f, 0.278820634f},
-std::array<float,2>{0.31967485f, 0.153847635f},
-std::array<float,2>{0.775048792f, 0.655846238f},
-std::array<float,2>{0.305481046f, 0.957726836f},
-std::array<float,2>{0.840817153f, 0.339943081f},
-std::array<float,2>{0.208524197f, 0.225003466f},
-std::array<float,2>{0.660855174f, 0.697447956f},
-std::array<float,2>{0.0463132374f, 0.549431086f},
-std::array<float,2>{0.523832321f, 0.0962938443f},
-std::array<float,2>{0.432347596f, 0.432166934f},
-std::array<float,2>{0.90322578f, 0.770991385f},
-std::array<float,2>{0.442020923f, 0.645036578f},
-std::array<float,2>{0.93802017f, 0.140799984f},
-std::array<float,2>{0.102227353f, 0.271639615f},
-std::array<float,2>{0.562815785f, 0.923767745f},
-std::array<float,2>{0.150436372f, 0.853531957f},
-std::array<float,2>{0.68799454f, 0.472459048f},
-std::array<float,2>{0.362355888f, 0.0373176783f},
-std::array<float,2>{0.798215747f, 0.598755658f},
-std::array<float,2>{0.392092049f, 0.807643056f},
-std::array<float,2>{0.933430672f, 0.378367513f},
-std::array<float,2>{0.0235269349f, 0.0795759633f},
-std::array<float,2>{0.556412101f, 0.517114639f},
-std::array<float,2>{0.218818292f, 0.718973875f},
-std::array<float,2>{0.636780262f, 0.19368659f},
-std::array<float,2>{0.280608982f, 0.363715798f},
-std::array<float,2>{0.869341731f, 0.992328763f},
-std::array<float,2>{0.326753527f, 0.587965012f},
-std::array<float,2>{0.768607318f, 0.00348454481f},
-std::array<float,2>{0.176242724f, 0.455099642f},
-std::array<float,2>{0.725343883f, 0.820464551f},
-std::array<float,2>{0.0890622213f, 0.879890978f},
-std::array<float,2>{0.619157076f, 0.299288541f},
-std::array<float,2>{0.470007002f, 0.178377762f},
-std::array<float,2>{0.976516843f, 0.671554089f},
-std::array<float,2>{0.497519463f, 0.90800184f},
-std::array<float,2>{0.994379342f, 0.260114312f},
-std::array<float,2>{0.0675275624f, 0.129564643f},
-std::array<float,2>{0.6015172f, 0.633970618f},
-std::array<float,2>{0.157797679f, 0.612645566f},
-std::array<float,2>{0.744324148f, 0.0551264286f},
-std::array<float,2>{0.32845062f, 0.490242302f},
-std::array<float,2>{0.762303412f, 0.86096704f},
-std::array<float,2>{0.264010966f, 0.71118176f},
-std::array<float,2>{0.857221007f, 0.246655852f},
-std::array<float,2>{0.24415043f, 0.31277886f},
-std::array<float,2>{0.646137297f, 0.952978551f},
-std::array<float,2>{0.0121941781f, 0.754374981f},
-std::array<float,2>{0.543465853f, 0.420272738f},
-std::array<float,2>{0.387302488f, 0.11606209f},
-std::array<float,2>{0.916261613f, 0.54251951f},
-std::array<float,2>{0.359212101f, 0.839768767f},
-std::array<float,2>{0.782042682f, 0.445506066f},
-std::array<float,2>{0.127143368f, 0.0188982263f},
-std::array<float,2>{0.71068722f, 0.567402005f},
-std::array<float,2>{0.117920257f, 0.684859931f},
-std::array<float,2>{0.581701577f, 0.170538768f},
-std::array<float,2>{0.457339615f, 0.282531232f},
-std::array<float,2>{0.961839557f, 0.901749253f},
-std::array<float,2>{0.415646225f, 0.505392492f},
-std::array<float,2>{0.890608788f, 0.06253957f},
-std::array<float,2>{0.0524016544f, 0.402748704f},
-std::array<float,2>{0.502187252f, 0.78949976f},
-std::array<float,2>{0.199701875f, 0.97962904f},
-std::array<float,2>{0.678237736f, 0.357645184f},
-std::array<float,2>{0.292274535f, 0.203408301f},
-std::array<float,2>{0.812895179f, 0.748551846f},
-std::array<float,2>{0.288231343f, 0.87766248f},
-std::array<float,2>{0.822749436f, 0.300795346f},
-std::array<float,2>{0.19239524f, 0.17244783f},
-std::array<float,2>{0.683350444f, 0.667712629f},
-std::array<float,2>{0.0576115549f, 0.591495991f},
-std::array<float,2>{0.515543401f, 0.00501065981f},
-std::array<float,2>{0.406873673f, 0.457461089f},
-std::array<float,2>{0.875815928f, 0.825635076f},
-std::array<float,2>{0.463955313f, 0.72361815f},
-std::array<float,2>{0.95914799f, 0.190420225f},
-std::array<float,2>{0.115572557f, 0.363194138f},
-std::array<float,2>{0.591775656f, 0.999233484f},
-std::array<float,2>{0.137458518f, 0.811291218f},
-std::array<float,2>{0.718087912f, 0.382440507f},
-std::array<float,2>{0.344406068f, 0.0833971426f},
-std::array<float,2>{0.789514542f, 0.521890104f},
-std::array<float,2>{0.377931476f, 0.858929873f},
-std::array<float,2>{0.913449585f, 0.473786801f},
-std::array<float,2>{0.00514400005f, 0.0339165479f},
-std::array<float,2>{0.535300434f, 0.596612215f},
-std::array<float,2>{0.24080129f, 0.643032193f},
-std::array<float,2>{0.651728272f, 0.145804644f},
-std::array<float,2>{0.251367778f, 0.268766642f},
-std::array<float,2>{0.845235646f, 0.929418147f},
-std::array<float,2>{0.339375079f, 0.551437438f},
-std::array<float,2>{0.755676687f, 0.0994325429f},
-std::array<float,2>{0.169244424f, 0.436189562f},
-std::array<float,2>{0.7372365f, 0.769358575f},
-std::array<float,2>{0.0738322511f, 0.953636885f},
-std::array<float,2>{0.607179165f, 0.337372601f},
-std::array<float,2>{0.488177031f, 0.22058931f},
-std::array<float,2>{0.992092073f, 0.702545106f},
-std::array<float,2>{0.482743263f, 0.982683182f},
-std::array<float,2>{0.981051028f, 0.354605287f},
-std::array<float,2>{0.0803379044f, 0.210872769f},
-std::array<float,2>{0.614063144f, 0.745039761f},
-std::array<float,2>{0.185196027f, 0.502579451f},
-std::array<float,2>{0.730712831f, 0.0687828213f},
-std::array<float,2>{0.314643562f, 0.400216907f},
-std::array<float,2>{0.777450383f, 0.793779254f},
-std::array<float,2>{0.266757399f, 0.679785907f},
-std::array<float,2>{0.86389333f, 0.167526603f},
-std::array<float,2>{0.232292309f, 0.286692798f},
-std::array<float,2>{0.632493377f, 0.905527055f},
-std::array<float,2>{0.0163247921f, 0.841562986f},
-std::array<float,2>{0.547179759f, 0.451869577f},
-std::array<float,2>{0.401023448f, 0.0229309388f},
-std::array<float,2>{0.925272644f, 0.563258588f},
-std::array<float,2>{0.371315807f, 0.751784682f},
-std::array<float,2>{0.806742907f, 0.415537804f},
-std::array<float,2>{0.144703865f, 0.112158291f},
-std::array<float,2>{0.701037407f, 0.545000196f},
-std::array<float,2>{0.100842826f, 0.714910388f},
-std::array<float,2>{0.571205616f, 0.24304235f},
-std::array<float,2>{0.450181454f, 0.317002326f},
-std::array<float,2>{0.947589397f, 0.948918581f},
-std::array<float,2>{0.424270362f, 0.613373518f},
-std::array<float,2>{0.892659843f, 0.0598930642f},
-std::array<float,2>{0.037251167f, 0.487974852f},
-std::array<float,2>{0.522358f, 0.866589904f},
-std::array<float,2>{0.216032371f, 0.911888957f},
-std::array<float,2>{0.664512813f, 0.262328625f},
-std::array<float,2>{0.300916463f, 0.126042739f},
-std::array<float,2>{0.835151792f, 0.637211859f},
-std::array<float,2>{0.321649075f, 0.940214634f},
-std::array<float,2>{0.771115899f, 0.324820638f},
-std::array<float,2>{0.174911365f, 0.239652678f},
-std::array<float,2>{0.720744133f, 0.7034536f},
-std::array<float,2>{0.093420133f, 0.532157063f},
-std::array<float,2>{0.623752832f, 0.117410772f},
-std::array<float,2>{0.474812657f, 0.413420647f},
-std::array<float,2>{0.968855739f, 0.764053166f},
-std::array<float,2>{0.398014665f, 0.632752776f},
-std::array<float,2>{0.936083794f, 0.133445844f},
-std::array<float,2>{0.028128041f, 0.257463396f},
-std::array<float,2>{0.561829329f, 0.919537365f},
-std::array<float,2>{0.225075617f, 0.869765043f},
-std::array<float,2>{0.636137962f, 0.49555397f},
-std::array<float,2>{0.27388978f, 0.0480518602f},
-std::array<float,2>{0.874131262f, 0.618113697f},
-std::array<float,2>{0.440334827f, 0.783449829f},
-std::array<float,2>{0.94477129f, 0.39259702f},
-std::array<float,2>{0.108212367f, 0.0755920038f},
-std::array<float,2>{0.568238139f, 0.509185791f},
-std::array<float,2>{0.154849082f, 0.735909462f},
-std::array<float,2>{0.691599011f, 0.214563414f},
-std::array<float,2>{0.363779545f, 0.350815356f},
-std::array<float,2>{0.800827801f, 0.971985638f},
-std::array<float,2>{0.309186757f, 0.577453911f},
-std::array<float,2>{0.839089155f, 0.0304210652f},
-std::array<float,2>{0.204949588f, 0.439072371f},
-std::array<float,2>{0.657436073f, 0.830198705f},
-std::array<float,2>{0.0423249938f, 0.8974877f},
-std::array<float,2>{0.530381322f, 0.296671629f},
-std::array<float,2>{0.435388207f, 0.16371429f},
-std::array<float,2>{0.900752842f, 0.677136421f},
-std::array<float,2>{0.418202609f, 0.934321582f},
-std::array<float,2>{0.883467495f, 0.275565207f},
-std::array<float,2>{0.0495732054f, 0.150556281f},
-std::array<float,2>{0.505731523f, 0.650771737f},
-std::array<float,2>{0.198745742f, 0.603489876f},
-std::array<float,2>{0.673089862f, 0.0458780676f},
-std::array<float,2>{0.294881254f, 0.481549025f},
-std::array<float,2>{0.818247199f, 0.845371187f},
-std::array<float,2>{0.353899837f, 0.689954996f},
-std::array<float,2>{0.788178086f, 0.229757667f},
-std::array<float,2>{0.129803643f, 0.335461169f},
-std::array<float,2>{0.705402911f, 0.962540269f},
-std::array<float,2>{0.123842336f, 0.775190294f},
-std::array<float,2>{0.582467675f, 0.425854117f},
-std::array<float,2>{0.454325199f, 0.104640581f},
-std::array<float,2>{0.966296434f, 0.561292708f},
-std::array<float,2>{0.258504152f, 0.815421939f},
-std::array<float,2>{0.852564931f, 0.461194038f},
-std::array<float,2>{0.249461085f, 0.0142992903f},
-std::array<float,2>{0.643067956f, 0.582405746f},
-std::array<float,2>{0.0112299416f, 0.659873307f},
-std::array<float,2>{0.54026556f, 0.183591217f},
-std::array<float,2>{0.384498984f, 0.308148682f},
-std::array<float,2>{0.921165347f, 0.888521552f},
-std::array<float,2>{0.492298305f, 0.526192188f},
-std::array<float,2>{0.998995662f, 0.0901989862f},
-std::array<float,2>{0.06474711f, 0.387363523f},
-std::array<float,2>{0.595247746f, 0.802746236f},
-std::array<float,2>{0.161250323f, 0.99101007f},
-std::array<float,2>{0.748965979f, 0.369414359f},
-std::array<float,2>{0.332731694f, 0.199778348f},
-std::array<float,2>{0.760663748f, 0.727523983f},
-std::array<float,2>{0.349179596f, 0.914704978f},
-std::array<float,2>{0.795629919f, 0.251994193f},
-std::array<float,2>{0.133519739f, 0.137029171f},
-std::array<float,2>{0.713351786f, 0.626561582f},
-std::array<float,2>{0.109569728f, 0.622571468f},
-std::array<float,2>{0.587905467f, 0.0512914211f},
-std::array<float,2>{0.467358142f, 0.497971416f},
-std::array<float,2>{0.954998851f, 0.871759236f},
-std::array<float,2>{0.410707414f, 0.708307624f},
-std::array<float,2>{0.881767631f, 0.237038672f},
-std::array<float,2>{0.0618044361f, 0.32293281f},
-std::array<float,2>{0.508247972f, 0.945204854f},
-std::array<float,2>{0.189730361f, 0.758417189f},
-std::array<float,2>{0.685845137f, 0.409548581f},
-std::array<float,2>{0.283874929f, 0.122530624f},
-std::array<float,2>{0.824222267f, 0.536230385f},
-std::array<float,2>{0.489346862f, 0.834378064f},
-std::array<float,2>{0.987812459f, 0.4442828f},
-std::array<float,2>{0.0777835026f, 0.0270094853f},
-std::array<float,2>{0.602847278f, 0.571168482f},
-std::array<float,2>{0.166741565f, 0.673755288f},
-std::array<float,2>{0.741429687f, 0.159556657f},
-std::array<float,2>{0.340135455f, 0.291929364f},
-std::array<float,2>{0.75066936f, 0.89408654f},
-std::array<float,2>{0.255469084f, 0.512681484f},
-std::array<float,2>{0.848758221f, 0.0728093758f},
-std::array<float,2>{0.234631434f, 0.398318022f},
-std::array<float,2>{0.652562737f, 0.786770284f},
-std::array<float,2>{0.00269399653f, 0.976244032f},
-std::array<float,2>{0.534409404f, 0.345539212f},
-std::array<float,2>{0.381577909f, 0.21608305f},
-std::array<float,2>{0.908797503f, 0.738742828f},
-std::array<float,2>{0.404837817f, 0.968633652f},
-std::array<float,2>{0.927889824f, 0.329560637f},
-std::array<float,2>{0.0225361884f, 0.233926475f},
-std::array<float,2>{0.553174496f, 0.693382025f},
-std::array<float,2>{0.229706451f, 0.554921389f},
-std::array<float,2>{0.627991676f, 0.105613142f},
-std::array<float,2>{0.270318985f, 0.423327982f},
-std::array<float,2>{0.861743271f, 0.781241477f},
-std::array<float,2>{0.317284524f, 0.653217256f},
-std::array<float,2>{0.776698172f, 0.155461878f},
-std::array<float,2>{0.18340826f, 0.279858828f},
-std::array<float,2>{0.730266809f, 0.931990206f},
-std::array<float,2>{0.0836554021f, 0.85146296f},
-std::array<float,2>{0.610715151f, 0.476976812f},
-std::array<float,2>{0.476970851f, 0.042545788f},
-std::array<float,2>{0.979796946f, 0.606609643f},
-std::array<float,2>{0.299462557f, 0.798324883f},
-std::array<float,2>{0.828175545f, 0.383698046f},
-std::array<float,2>{0.21161063f, 0.0885338634f},
-std::array<float,2>{0.670800388f, 0.531184852f},
-std::array<float,2>{0.0324706286f, 0.732848406f},
-std::array<float,2>{0.515909076f, 0.198064879f},
-std::array<float,2>{0.42730844f, 0.374156207f},
-std::array<float,2>{0.897286057f, 0.984509647f},
-std::array<float,2>{0.44753775f, 0.580846965f},
-std::array<float,2>{0.950233817f, 0.00993585214f},
-std::array<float,2>{0.095225282f, 0.467533618f},
-std::array<float,2>{0.576776445f, 0.816435158f},
-std::array<float,2>{0.144028127f, 0.88297379f},
-std::array<float,2>{0.695447981f, 0.311123043f},
-std::array<float,2>{0.368460596f, 0.186573505f},
-std::array<float,2>{0.810761273f, 0.660539448f},
-std::array<float,2>{0.278864384f, 0.994706988f},
-std::array<float,2>{0.867950976f, 0.366654485f},
-std::array<float,2>{0.221191227f, 0.191896066f},
-std::array<float,2>{0.639086664f, 0.720879614f},
-std::array<float,2>{0.0270628184f, 0.518164635f},
-std::array<float,2>{0.558049083f, 0.0809097439f},
-std::array<float,2>{0.39435333f, 0.376273781f},
-std::array<float,2>{0.931638658f, 0.806638002f},
-std::array<float,2>{0.471608549f, 0.669788182f},
-std::array<float,2>{0.973669827f, 0.176813021f},
-std::array<float,2>{0.0873868763f, 0.297184706f},
-std::array<float,2>{0.617807984f, 0.882168651f},
-std::array<float,2>{0.178703323f, 0.822949469f},
-std::array<float,2>{0.72434938f, 0.453688234f},
-std::array<float,2>{0.324721366f, 0.00158989686f},
-std::array<float,2>{0.765902936f, 0.587270498f},
-std::array<float,2>{0.430652291f, 0.772681892f},
-std::array<float,2>{0.904678881f, 0.430015892f},
-std::array<float,2>{0.0447568372f, 0.0946201235f},
-std::array<float,2>{0.527158737f, 0.547497451f},
-std::array<float,2>{0.209449261f, 0.697109938f},
-std::array<float,2>{0.663478196f, 0.224043846f},
-std::array<float,2>{0.308389723f, 0.342015564f},
-std::array<float,2>{0.842971325f, 0.95957011f},
-std::array<float,2>{0.361080766f, 0.600884855f},
-std::array<float,2>{0.800659537f, 0.0362991542f},
-std::array<float,2>{0.150375277f, 0.470668584f},
-std::array<float,2>{0.690339923f, 0.851791918f},
-std::array<float,2>{0.103632204f, 0.924093425f},
-std::array<float,2>{0.5657745f, 0.270726711f},
-std::array<float,2>{0.444664806f, 0.143074498f},
-std::array<float,2>{0.940038145f, 0.647304475f},
-std::array<float,2>{0.460051686f, 0.900282443f},
-std::array<float,2>{0.964412153f, 0.283474863f},
-std::array<float,2>{0.12071918f, 0.168999866f},
-std::array<float,2>{0.579449773f, 0.686386108f},
-std::array<float,2>{0.125568599f, 0.568365872f},
-std::array<float,2>{0.707594812f, 0.0166754872f},
-std::array<float,2>{0.355926305f, 0.44819662f},
-std::array<float,2>{0.783586919f, 0.836466968f},
-std::array<float,2>{0.289083481f, 0.747187853f},
-std::array<float,2>{0.815968633f, 0.206410363f},
-std::array<float,2>{0.202593759f, 0.356876135f},
-std::array<float,2>{0.676171243f, 0.976687074f},
-std::array<float,2>{0.0542622022f, 0.792719066f},
-std::array<float,2>{0.500795186f, 0.404382348f},
-std::array<float,2>{0.417363584f, 0.0663847327f},
-std::array<float,2>{0.887564659f, 0.507381439f},
-std::array<float,2>{0.330462128f, 0.861813009f},
-std::array<float,2>{0.764852524f, 0.48973158f},
-std::array<float,2>{0.159880996f, 0.0578875132f},
-std::array<float,2>{0.742983937f, 0.610240638f},
-std::array<float,2>{0.0693427697f, 0.635088682f},
-std::array<float,2>{0.599499166f, 0.131023183f},
-std::array<float,2>{0.498578787f, 0.258946985f},
-std::array<float,2>{0.992727101f, 0.90859139f},
-std::array<float,2>{0.388825238f, 0.540809095f},
-std::array<float,2>{0.915785968f, 0.114165559f},
-std::array<float,2>{0.0139567973f, 0.418967903f},
-std::array<float,2>{0.545092821f, 0.757256448f},
-std::array<float,2>{0.243383974f, 0.95011121f},
-std::array<float,2>{0.648002207f, 0.314864933f},
-std::array<float,2>{0.262416899f, 0.248209789f},
-std::array<float,2>{0.858987689f, 0.714485705f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.0276711285f, 0.920016646f},
-std::array<float,2>{0.770546615f, 0.00721115479f},
-std::array<float,2>{0.439304501f, 0.34495315f},
-std::array<float,2>{0.516341925f, 0.542830169f},
-std::array<float,2>{0.340177655f, 0.632087231f},
-std::array<float,2>{0.715356171f, 0.480943263f},
-std::array<float,2>{0.150524393f, 0.246346921f},
-std::array<float,2>{0.971947074f, 0.842184961f},
-std::array<float,2>{0.192529723f, 0.596485853f},
-std::array<float,2>{0.888882399f, 0.31018135f},
-std::array<float,2>{0.306026757f, 0.110552266f},
-std::array<float,2>{0.632879555f, 0.972997963f},
-std::array<float,2>{0.420752227f, 0.774314284f},
-std::array<float,2>{0.613900125f, 0.134093359f},
-std::array<float,2>{0.119099863f, 0.416832596f},
-std::array<float,2>{0.821084142f, 0.728560269f},
-std::array<float,2>{0.162441954f, 0.852871537f},
-std::array<float,2>{0.93856734f, 0.188448459f},
-std::array<float,2>{0.365301967f, 0.43791908f},
-std::array<float,2>{0.726280272f, 0.680902481f},
-std::array<float,2>{0.475497156f, 0.524171174f},
-std::array<float,2>{0.558488786f, 0.322050989f},
-std::array<float,2>{0.0460806824f, 0.0414197147f},
-std::array<float,2>{0.79672277f, 0.879082799f},
-std::array<float,2>{0.0785258487f, 0.708279014f},
-std::array<float,2>{0.849556506f, 0.385823458f},
-std::array<float,2>{0.385743588f, 0.158048257f},
-std::array<float,2>{0.56954509f, 0.807177424f},
-std::array<float,2>{0.259679556f, 0.95520705f},
-std::array<float,2>{0.687043667f, 0.078593947f},
-std::array<float,2>{0.239543825f, 0.263897508f},
-std::array<float,2>{0.93263936f, 0.585384488f},
-std::array<float,2>{0.0946672857f, 0.79577589f},
-std::array<float,2>{0.832342446f, 0.177738354f},
-std::array<float,2>{0.423560113f, 0.393461913f},
-std::array<float,2>{0.598259866f, 0.697210729f},
-std::array<float,2>{0.296687186f, 0.575132132f},
-std::array<float,2>{0.651973307f, 0.270304173f},
-std::array<float,2>{0.212884709f, 0.0729576722f},
-std::array<float,2>{0.895140588f, 0.941707194f},
-std::array<float,2>{0.134592056f, 0.663389027f},
-std::array<float,2>{0.985526621f, 0.459441453f},
-std::array<float,2>{0.315784961f, 0.204695493f},
-std::array<float,2>{0.690166831f, 0.8684358f},
-std::array<float,2>{0.458725154f, 0.901255846f},
-std::array<float,2>{0.501161814f, 0.0618313737f},
-std::array<float,2>{0.00773084862f, 0.34144789f},
-std::array<float,2>{0.756012678f, 0.507792115f},
-std::array<float,2>{0.221244305f, 0.999884486f},
-std::array<float,2>{0.919291139f, 0.0942151025f},
-std::array<float,2>{0.269625425f, 0.286565036f},
-std::array<float,2>{0.65942657f, 0.61315167f},
-std::array<float,2>{0.399867386f, 0.736493886f},
-std::array<float,2>{0.587387621f, 0.424604148f},
-std::array<float,2>{0.0763156712f, 0.149604142f},
-std::array<float,2>{0.864189267f, 0.762392282f},
-std::array<float,2>{0.0584505089f, 0.554079533f},
-std::array<float,2>{0.802749991f, 0.361713409f},
-std::array<float,2>{0.490491539f, 0.0250589438f},
-std::array<float,2>{0.539109588f, 0.923044622f},
-std::array<float,2>{0.354521453f, 0.821658909f},
-std::array<float,2>{0.735754907f, 0.222695649f},
-std::array<float,2>{0.184858263f, 0.490038455f},
-std::array<float,2>{0.955052376f, 0.64298594f},
-std::array<float,2>{0.0672463775f, 0.952941f},
-std::array<float,2>{0.873279393f, 0.0678451508f},
-std::array<float,2>{0.39662376f, 0.275010616f},
-std::array<float,2>{0.581159234f, 0.567468405f},
-std::array<float,2>{0.27683863f, 0.694849908f},
-std::array<float,2>{0.670003533f, 0.401411384f},
-std::array<float,2>{0.232369721f, 0.181706339f},
-std::array<float,2>{0.909390926f, 0.788767159f},
-std::array<float,2>{0.174768344f, 0.508488595f},
-std::array<float,2>{0.968384445f, 0.331112713f},
-std::array<float,2>{0.348006994f, 0.0475377366f},
-std::array<float,2>{0.748378158f, 0.890693724f},
-std::array<float,2>{0.49613601f, 0.8639884f},
-std::array<float,2>{0.537543774f, 0.218245164f},
-std::array<float,2>{0.0503090397f, 0.466600835f},
-std::array<float,2>{0.811511874f, 0.668254256f},
-std::array<float,2>{0.204152405f, 0.756083548f},
-std::array<float,2>{0.902598202f, 0.144048631f},
-std::array<float,2>{0.286016434f, 0.433841735f},
-std::array<float,2>{0.641210914f, 0.743045926f},
-std::array<float,2>{0.432607859f, 0.618242204f},
-std::array<float,2>{0.605597913f, 0.295976579f},
-std::array<float,2>{0.106535695f, 0.108107954f},
-std::array<float,2>{0.837758005f, 0.985664189f},
-std::array<float,2>{0.0139991986f, 0.653838396f},
-std::array<float,2>{0.758847296f, 0.49825424f},
-std::array<float,2>{0.468476444f, 0.231819168f},
-std::array<float,2>{0.514248669f, 0.816712201f},
-std::array<float,2>{0.323833257f, 0.934339523f},
-std::array<float,2>{0.698374093f, 0.0173921194f},
-std::array<float,2>{0.13243793f, 0.373163521f},
-std::array<float,2>{0.993295014f, 0.559868813f},
-std::array<float,2>{0.0326750092f, 0.828703463f},
-std::array<float,2>{0.787109733f, 0.238011673f},
-std::array<float,2>{0.482312888f, 0.469386488f},
-std::array<float,2>{0.546982288f, 0.640593469f},
-std::array<float,2>{0.372755766f, 0.537416458f},
-std::array<float,2>{0.729634225f, 0.354918748f},
-std::array<float,2>{0.170649201f, 0.0154390316f},
-std::array<float,2>{0.951812863f, 0.908517003f},
-std::array<float,2>{0.248302549f, 0.719889343f},
-std::array<float,2>{0.925698102f, 0.411460489f},
-std::array<float,2>{0.251988083f, 0.129011437f},
-std::array<float,2>{0.675863922f, 0.771486223f},
-std::array<float,2>{0.377995431f, 0.979991019f},
-std::array<float,2>{0.571641147f, 0.123622686f},
-std::array<float,2>{0.0904205069f, 0.301787764f},
-std::array<float,2>{0.854706287f, 0.605494738f},
-std::array<float,2>{0.14377591f, 0.889256835f},
-std::array<float,2>{0.978424609f, 0.0318871289f},
-std::array<float,2>{0.332491785f, 0.318006158f},
-std::array<float,2>{0.706972659f, 0.519227386f},
-std::array<float,2>{0.452901691f, 0.675682187f},
-std::array<float,2>{0.530248046f, 0.449010313f},
-std::array<float,2>{0.0194610041f, 0.200432405f},
-std::array<float,2>{0.780793965f, 0.84899646f},
-std::array<float,2>{0.114437968f, 0.592043877f},
-std::array<float,2>{0.816246688f, 0.256136537f},
-std::array<float,2>{0.409657657f, 0.0928512663f},
-std::array<float,2>{0.622242033f, 0.964840651f},
-std::array<float,2>{0.298070729f, 0.800258994f},
-std::array<float,2>{0.630526483f, 0.167839512f},
-std::array<float,2>{0.196719527f, 0.379332662f},
-std::array<float,2>{0.877281785f, 0.714056492f},
-std::array<float,2>{0.123980187f, 0.895126641f},
-std::array<float,2>{0.827254057f, 0.0526950695f},
-std::array<float,2>{0.415349156f, 0.334949195f},
-std::array<float,2>{0.611648381f, 0.515096843f},
-std::array<float,2>{0.312081963f, 0.666874051f},
-std::array<float,2>{0.639465988f, 0.463095695f},
-std::array<float,2>{0.188894689f, 0.212040141f},
-std::array<float,2>{0.883422494f, 0.859737754f},
-std::array<float,2>{0.153429925f, 0.564427078f},
-std::array<float,2>{0.976035714f, 0.281130373f},
-std::array<float,2>{0.337722331f, 0.0640610605f},
-std::array<float,2>{0.711402893f, 0.947056055f},
-std::array<float,2>{0.442220896f, 0.78339839f},
-std::array<float,2>{0.521458447f, 0.184660673f},
-std::array<float,2>{0.0252609011f, 0.403756946f},
-std::array<float,2>{0.766333282f, 0.689300597f},
-std::array<float,2>{0.236947894f, 0.812601566f},
-std::array<float,2>{0.936225653f, 0.228111863f},
-std::array<float,2>{0.261723846f, 0.492721587f},
-std::array<float,2>{0.681395769f, 0.651051819f},
-std::array<float,2>{0.3901757f, 0.557022572f},
-std::array<float,2>{0.5629161f, 0.368575096f},
-std::array<float,2>{0.0856699422f, 0.0198736228f},
-std::array<float,2>{0.845991671f, 0.931860924f},
-std::array<float,2>{0.0391213f, 0.749564171f},
-std::array<float,2>{0.790796459f, 0.432106882f},
-std::array<float,2>{0.472057939f, 0.146219105f},
-std::array<float,2>{0.559439063f, 0.753332973f},
-std::array<float,2>{0.359982312f, 0.989955068f},
-std::array<float,2>{0.720782638f, 0.102002904f},
-std::array<float,2>{0.156941026f, 0.292607158f},
-std::array<float,2>{0.94250387f, 0.624267042f},
-std::array<float,2>{0.00386526319f, 0.769367516f},
-std::array<float,2>{0.753224552f, 0.127675951f},
-std::array<float,2>{0.45374921f, 0.407184958f},
-std::array<float,2>{0.505717576f, 0.724872231f},
-std::array<float,2>{0.317032516f, 0.604605377f},
-std::array<float,2>{0.693739474f, 0.297872394f},
-std::array<float,2>{0.138258368f, 0.120821729f},
-std::array<float,2>{0.990475774f, 0.98323667f},
-std::array<float,2>{0.2183882f, 0.635964751f},
-std::array<float,2>{0.893152118f, 0.476111799f},
-std::array<float,2>{0.2903575f, 0.240655348f},
-std::array<float,2>{0.652469337f, 0.834534764f},
-std::array<float,2>{0.427694917f, 0.912576795f},
-std::array<float,2>{0.596146405f, 0.00934759621f},
-std::array<float,2>{0.0982750356f, 0.358063221f},
-std::array<float,2>{0.831232905f, 0.533479273f},
-std::array<float,2>{0.182117119f, 0.968334258f},
-std::array<float,2>{0.960458696f, 0.0862476826f},
-std::array<float,2>{0.355564117f, 0.250559479f},
-std::array<float,2>{0.739432275f, 0.588515401f},
-std::array<float,2>{0.485164702f, 0.717482984f},
-std::array<float,2>{0.544040084f, 0.377407461f},
-std::array<float,2>{0.0589140616f, 0.170552582f},
-std::array<float,2>{0.798022211f, 0.803484142f},
-std::array<float,2>{0.07204438f, 0.519614041f},
-std::array<float,2>{0.859895408f, 0.31497702f},
-std::array<float,2>{0.404442668f, 0.0379599668f},
-std::array<float,2>{0.593736172f, 0.886419713f},
-std::array<float,2>{0.266906053f, 0.84624517f},
-std::array<float,2>{0.662934899f, 0.195461735f},
-std::array<float,2>{0.223182052f, 0.452313751f},
-std::array<float,2>{0.916072845f, 0.676258624f},
-std::array<float,2>{0.0530289598f, 0.972534239f},
-std::array<float,2>{0.804985106f, 0.114122525f},
-std::array<float,2>{0.49597168f, 0.307206213f},
-std::array<float,2>{0.532324195f, 0.599605441f},
-std::array<float,2>{0.346531808f, 0.73279798f},
-std::array<float,2>{0.743324637f, 0.42110914f},
-std::array<float,2>{0.176705763f, 0.137073487f},
-std::array<float,2>{0.963716567f, 0.77911973f},
-std::array<float,2>{0.229166657f, 0.545453131f},
-std::array<float,2>{0.913545191f, 0.347869724f},
-std::array<float,2>{0.280030072f, 0.00266853697f},
-std::array<float,2>{0.666181505f, 0.917420924f},
-std::array<float,2>{0.392284155f, 0.837184191f},
-std::array<float,2>{0.584066927f, 0.244462848f},
-std::array<float,2>{0.0625014752f, 0.479845852f},
-std::array<float,2>{0.870902598f, 0.625309408f},
-std::array<float,2>{0.128157735f, 0.810814381f},
-std::array<float,2>{0.997087538f, 0.16142042f},
-std::array<float,2>{0.326792061f, 0.387975127f},
-std::array<float,2>{0.699765623f, 0.70372659f},
-std::array<float,2>{0.464661896f, 0.578802466f},
-std::array<float,2>{0.509470224f, 0.260355532f},
-std::array<float,2>{0.00848115701f, 0.0826549456f},
-std::array<float,2>{0.763616681f, 0.960065901f},
-std::array<float,2>{0.103403993f, 0.684941947f},
-std::array<float,2>{0.840720177f, 0.441545993f},
-std::array<float,2>{0.434569955f, 0.191701964f},
-std::array<float,2>{0.604663253f, 0.857725799f},
-std::array<float,2>{0.284422666f, 0.875478387f},
-std::array<float,2>{0.645602167f, 0.0444902331f},
-std::array<float,2>{0.209046885f, 0.327508897f},
-std::array<float,2>{0.901864767f, 0.530666709f},
-std::array<float,2>{0.0882223696f, 0.872184515f},
-std::array<float,2>{0.856082857f, 0.207216084f},
-std::array<float,2>{0.381903499f, 0.456644475f},
-std::array<float,2>{0.576753557f, 0.659951627f},
-std::array<float,2>{0.257239789f, 0.502142251f},
-std::array<float,2>{0.672836542f, 0.336605698f},
-std::array<float,2>{0.242736205f, 0.0563821942f},
-std::array<float,2>{0.926897347f, 0.90574044f},
-std::array<float,2>{0.166361898f, 0.702059031f},
-std::array<float,2>{0.946992159f, 0.398042262f},
-std::array<float,2>{0.370591074f, 0.172362715f},
-std::array<float,2>{0.733475447f, 0.791135192f},
-std::array<float,2>{0.4771218f, 0.938246965f},
-std::array<float,2>{0.550906897f, 0.0775595605f},
-std::array<float,2>{0.0353726968f, 0.268219978f},
-std::array<float,2>{0.784187436f, 0.572995365f},
-std::array<float,2>{0.201449782f, 0.926335931f},
-std::array<float,2>{0.882082224f, 0.0284703467f},
-std::array<float,2>{0.301488012f, 0.366945565f},
-std::array<float,2>{0.625413418f, 0.550203681f},
-std::array<float,2>{0.413599133f, 0.645806313f},
-std::array<float,2>{0.620499194f, 0.487526149f},
-std::array<float,2>{0.109692544f, 0.219701052f},
-std::array<float,2>{0.816411674f, 0.826560557f},
-std::array<float,2>{0.0203687474f, 0.615310848f},
-std::array<float,2>{0.774334908f, 0.282170206f},
-std::array<float,2>{0.446579218f, 0.0983630717f},
-std::array<float,2>{0.52520889f, 0.99386847f},
-std::array<float,2>{0.328284085f, 0.76069659f},
-std::array<float,2>{0.710575044f, 0.154858261f},
-std::array<float,2>{0.144545525f, 0.427706659f},
-std::array<float,2>{0.983778119f, 0.741628826f},
-std::array<float,2>{0.0442630313f, 0.881993175f},
-std::array<float,2>{0.794514179f, 0.0393371917f},
-std::array<float,2>{0.474109083f, 0.32243821f},
-std::array<float,2>{0.555225134f, 0.525601208f},
-std::array<float,2>{0.363558829f, 0.68235302f},
-std::array<float,2>{0.724380136f, 0.439469934f},
-std::array<float,2>{0.16120322f, 0.189881593f},
-std::array<float,2>{0.94121933f, 0.854933619f},
-std::array<float,2>{0.241747141f, 0.582158029f},
-std::array<float,2>{0.931281686f, 0.262791157f},
-std::array<float,2>{0.260779262f, 0.0816149712f},
-std::array<float,2>{0.684012234f, 0.954173505f},
-std::array<float,2>{0.384093851f, 0.805780768f},
-std::array<float,2>{0.567151308f, 0.158803686f},
-std::array<float,2>{0.0819441378f, 0.383991599f},
-std::array<float,2>{0.850111783f, 0.709439874f},
-std::array<float,2>{0.149927348f, 0.840275168f},
-std::array<float,2>{0.970562398f, 0.248355985f},
-std::array<float,2>{0.343586504f, 0.484190285f},
-std::array<float,2>{0.718491375f, 0.630515218f},
-std::array<float,2>{0.440743923f, 0.539215803f},
-std::array<float,2>{0.518996179f, 0.347359955f},
-std::array<float,2>{0.0293761343f, 0.00575966807f},
-std::array<float,2>{0.773107231f, 0.919852138f},
-std::array<float,2>{0.119340926f, 0.727022827f},
-std::array<float,2>{0.822554469f, 0.414075226f},
-std::array<float,2>{0.419537991f, 0.135356277f},
-std::array<float,2>{0.615872562f, 0.776460648f},
-std::array<float,2>{0.308291018f, 0.975367367f},
-std::array<float,2>{0.63531518f, 0.112025753f},
-std::array<float,2>{0.193649486f, 0.311124533f},
-std::array<float,2>{0.886920571f, 0.594212234f},
-std::array<float,2>{0.0752268359f, 0.76531738f},
-std::array<float,2>{0.865839064f, 0.15206559f},
-std::array<float,2>{0.401652068f, 0.42273739f},
-std::array<float,2>{0.589650631f, 0.73528415f},
-std::array<float,2>{0.271597296f, 0.610531509f},
-std::array<float,2>{0.657911479f, 0.288316548f},
-std::array<float,2>{0.220349431f, 0.0962562189f},
-std::array<float,2>{0.92112124f, 0.997486472f},
-std::array<float,2>{0.186244592f, 0.641096592f},
-std::array<float,2>{0.955369055f, 0.491983652f},
-std::array<float,2>{0.35273838f, 0.225564569f},
-std::array<float,2>{0.737408876f, 0.823670745f},
-std::array<float,2>{0.489220589f, 0.924232781f},
-std::array<float,2>{0.5423522f, 0.026194239f},
-std::array<float,2>{0.0552594401f, 0.360432774f},
-std::array<float,2>{0.802470803f, 0.551347017f},
-std::array<float,2>{0.214736387f, 0.943770707f},
-std::array<float,2>{0.896715879f, 0.0710614473f},
-std::array<float,2>{0.293550611f, 0.271980673f},
-std::array<float,2>{0.650379419f, 0.577655971f},
-std::array<float,2>{0.425258666f, 0.697769523f},
-std::array<float,2>{0.599973142f, 0.392170876f},
-std::array<float,2>{0.09689679f, 0.176746473f},
-std::array<float,2>{0.835915148f, 0.793519199f},
-std::array<float,2>{0.00531976577f, 0.505802333f},
-std::array<float,2>{0.755327344f, 0.341960847f},
-std::array<float,2>{0.459379584f, 0.0594815202f},
-std::array<float,2>{0.502907097f, 0.899374723f},
-std::array<float,2>{0.313054055f, 0.870402515f},
-std::array<float,2>{0.688038886f, 0.20684886f},
-std::array<float,2>{0.135741472f, 0.45723933f},
-std::array<float,2>{0.98729074f, 0.660957396f},
-std::array<float,2>{0.10912808f, 0.986879766f},
-std::array<float,2>{0.838105321f, 0.10660892f},
-std::array<float,2>{0.430444747f, 0.293213487f},
-std::array<float,2>{0.608361423f, 0.619388342f},
-std::array<float,2>{0.287497789f, 0.745902658f},
-std::array<float,2>{0.64265424f, 0.43656671f},
-std::array<float,2>{0.206706971f, 0.142531648f},
-std::array<float,2>{0.905216813f, 0.754468262f},
-std::array<float,2>{0.129708499f, 0.560946882f},
-std::array<float,2>{0.994371474f, 0.37115413f},
-std::array<float,2>{0.321364552f, 0.0180919208f},
-std::array<float,2>{0.695965528f, 0.937247336f},
-std::array<float,2>{0.466402829f, 0.819468379f},
-std::array<float,2>{0.512726605f, 0.232919663f},
-std::array<float,2>{0.0126760006f, 0.496114731f},
-std::array<float,2>{0.760650992f, 0.654373586f},
-std::array<float,2>{0.232934937f, 0.786980152f},
-std::array<float,2>{0.908028662f, 0.181597173f},
-std::array<float,2>{0.273780167f, 0.399460524f},
-std::array<float,2>{0.66967833f, 0.692977011f},
-std::array<float,2>{0.395796001f, 0.569719613f},
-std::array<float,2>{0.578404963f, 0.276130199f},
-std::array<float,2>{0.0691363737f, 0.0687649176f},
-std::array<float,2>{0.871156394f, 0.949561119f},
-std::array<float,2>{0.0469725132f, 0.670922518f},
-std::array<float,2>{0.809132755f, 0.468596578f},
-std::array<float,2>{0.499792516f, 0.216088727f},
-std::array<float,2>{0.535590708f, 0.866909623f},
-std::array<float,2>{0.351444721f, 0.893629193f},
-std::array<float,2>{0.746154428f, 0.0497277565f},
-std::array<float,2>{0.172097564f, 0.329567552f},
-std::array<float,2>{0.96571058f, 0.511080801f},
-std::array<float,2>{0.015763456f, 0.850126326f},
-std::array<float,2>{0.778188407f, 0.201313406f},
-std::array<float,2>{0.449853539f, 0.446524292f},
-std::array<float,2>{0.527351081f, 0.673209488f},
-std::array<float,2>{0.334713817f, 0.515935183f},
-std::array<float,2>{0.704217672f, 0.319280356f},
-std::array<float,2>{0.141869083f, 0.0332440101f},
-std::array<float,2>{0.979043305f, 0.888203382f},
-std::array<float,2>{0.197619483f, 0.712872386f},
-std::array<float,2>{0.87541157f, 0.382397056f},
-std::array<float,2>{0.299329966f, 0.164328918f},
-std::array<float,2>{0.632081389f, 0.797119617f},
-std::array<float,2>{0.407879651f, 0.962186158f},
-std::array<float,2>{0.624591768f, 0.0907144174f},
-std::array<float,2>{0.116671786f, 0.255782962f},
-std::array<float,2>{0.812905848f, 0.590473771f},
-std::array<float,2>{0.168614507f, 0.907082379f},
-std::array<float,2>{0.949527264f, 0.0124075711f},
-std::array<float,2>{0.374861956f, 0.351916045f},
-std::array<float,2>{0.728407979f, 0.53555131f},
-std::array<float,2>{0.482847273f, 0.637337983f},
-std::array<float,2>{0.550760448f, 0.472107977f},
-std::array<float,2>{0.0335033312f, 0.235737205f},
-std::array<float,2>{0.786331058f, 0.830823898f},
-std::array<float,2>{0.0925679505f, 0.607705712f},
-std::array<float,2>{0.853372395f, 0.304623634f},
-std::array<float,2>{0.376942605f, 0.121298648f},
-std::array<float,2>{0.572372198f, 0.9773646f},
-std::array<float,2>{0.25045082f, 0.769976854f},
-std::array<float,2>{0.678250432f, 0.131936654f},
-std::array<float,2>{0.246880919f, 0.413596213f},
-std::array<float,2>{0.922919989f, 0.721905291f},
-std::array<float,2>{0.0834430307f, 0.930492759f},
-std::array<float,2>{0.843909383f, 0.0231226701f},
-std::array<float,2>{0.387611121f, 0.370365798f},
-std::array<float,2>{0.565077782f, 0.555528045f},
-std::array<float,2>{0.264219671f, 0.650220096f},
-std::array<float,2>{0.683541179f, 0.494657904f},
-std::array<float,2>{0.234375775f, 0.228745386f},
-std::array<float,2>{0.934399307f, 0.816299558f},
-std::array<float,2>{0.158968434f, 0.62293005f},
-std::array<float,2>{0.944021046f, 0.290554821f},
-std::array<float,2>{0.362945855f, 0.105420388f},
-std::array<float,2>{0.718945026f, 0.991900504f},
-std::array<float,2>{0.469377905f, 0.750408173f},
-std::array<float,2>{0.561872303f, 0.148271531f},
-std::array<float,2>{0.0423189215f, 0.42983374f},
-std::array<float,2>{0.791830361f, 0.747196257f},
-std::array<float,2>{0.189639419f, 0.862214386f},
-std::array<float,2>{0.885528505f, 0.21303007f},
-std::array<float,2>{0.309323996f, 0.461586952f},
-std::array<float,2>{0.637337267f, 0.66535455f},
-std::array<float,2>{0.416790992f, 0.512434423f},
-std::array<float,2>{0.610356092f, 0.333009094f},
-std::array<float,2>{0.122008875f, 0.0545473471f},
-std::array<float,2>{0.825970352f, 0.897560894f},
-std::array<float,2>{0.0262847319f, 0.690848827f},
-std::array<float,2>{0.769122422f, 0.40615648f},
-std::array<float,2>{0.44362992f, 0.18571192f},
-std::array<float,2>{0.523137689f, 0.781679511f},
-std::array<float,2>{0.338595659f, 0.948166788f},
-std::array<float,2>{0.713915706f, 0.065652065f},
-std::array<float,2>{0.154497176f, 0.278928667f},
-std::array<float,2>{0.974270225f, 0.565608859f},
-std::array<float,2>{0.0605498329f, 0.80177933f},
-std::array<float,2>{0.800283432f, 0.169358894f},
-std::array<float,2>{0.487059742f, 0.375407398f},
-std::array<float,2>{0.546271205f, 0.71587038f},
-std::array<float,2>{0.357790619f, 0.586945176f},
-std::array<float,2>{0.741048753f, 0.253764719f},
-std::array<float,2>{0.181601465f, 0.0891241506f},
-std::array<float,2>{0.958660185f, 0.965786517f},
-std::array<float,2>{0.224846125f, 0.679031968f},
-std::array<float,2>{0.914401829f, 0.450352341f},
-std::array<float,2>{0.268671811f, 0.198174521f},
-std::array<float,2>{0.660180748f, 0.844112158f},
-std::array<float,2>{0.402570903f, 0.882967591f},
-std::array<float,2>{0.590706348f, 0.0369652472f},
-std::array<float,2>{0.0731659681f, 0.312743723f},
-std::array<float,2>{0.862316728f, 0.523026466f},
-std::array<float,2>{0.138931051f, 0.98104763f},
-std::array<float,2>{0.98889178f, 0.118586615f},
-std::array<float,2>{0.318986893f, 0.300099254f},
-std::array<float,2>{0.692402959f, 0.602791429f},
-std::array<float,2>{0.456531554f, 0.722881675f},
-std::array<float,2>{0.505989432f, 0.409120232f},
-std::array<float,2>{0.0002464524f, 0.126480937f},
-std::array<float,2>{0.751149714f, 0.766191781f},
-std::array<float,2>{0.100474328f, 0.533054769f},
-std::array<float,2>{0.829415023f, 0.356603205f},
-std::array<float,2>{0.429003417f, 0.0112384753f},
-std::array<float,2>{0.594061852f, 0.911179423f},
-std::array<float,2>{0.291145831f, 0.83374989f},
-std::array<float,2>{0.65584898f, 0.239901751f},
-std::array<float,2>{0.216404617f, 0.473315746f},
-std::array<float,2>{0.891430855f, 0.633659363f},
-std::array<float,2>{0.0108031463f, 0.957566917f},
-std::array<float,2>{0.765433133f, 0.0844544247f},
-std::array<float,2>{0.461715072f, 0.259227544f},
-std::array<float,2>{0.510408521f, 0.580343306f},
-std::array<float,2>{0.325914979f, 0.705481231f},
-std::array<float,2>{0.701349437f, 0.389799774f},
-std::array<float,2>{0.125169054f, 0.162323132f},
-std::array<float,2>{0.999733746f, 0.809527874f},
-std::array<float,2>{0.20875977f, 0.527876258f},
-std::array<float,2>{0.899362803f, 0.325776964f},
-std::array<float,2>{0.281946003f, 0.0468224436f},
-std::array<float,2>{0.648033619f, 0.877813041f},
-std::array<float,2>{0.436720073f, 0.856642783f},
-std::array<float,2>{0.603251874f, 0.193805113f},
-std::array<float,2>{0.104034774f, 0.443568975f},
-std::array<float,2>{0.842124164f, 0.686639547f},
-std::array<float,2>{0.178864136f, 0.781129003f},
-std::array<float,2>{0.961512804f, 0.139641389f},
-std::array<float,2>{0.345374942f, 0.419251233f},
-std::array<float,2>{0.745217025f, 0.730579436f},
-std::array<float,2>{0.492837995f, 0.600560248f},
-std::array<float,2>{0.53409946f, 0.304720074f},
-std::array<float,2>{0.0516153947f, 0.116219282f},
-std::array<float,2>{0.80682224f, 0.969599247f},
-std::array<float,2>{0.0658834651f, 0.628009677f},
-std::array<float,2>{0.8683483f, 0.477855414f},
-std::array<float,2>{0.393808037f, 0.242624223f},
-std::array<float,2>{0.58393991f, 0.838294029f},
-std::array<float,2>{0.277633816f, 0.915411651f},
-std::array<float,2>{0.664093673f, 0.00186864904f},
-std::array<float,2>{0.227814645f, 0.350849628f},
-std::array<float,2>{0.911110342f, 0.543103039f},
-std::array<float,2>{0.111376338f, 0.825595677f},
-std::array<float,2>{0.818537712f, 0.222368523f},
-std::array<float,2>{0.4105286f, 0.486213446f},
-std::array<float,2>{0.618098021f, 0.648126304f},
-std::array<float,2>{0.303567767f, 0.548189282f},
-std::array<float,2>{0.627940238f, 0.364997208f},
-std::array<float,2>{0.200271845f, 0.0302002728f},
-std::array<float,2>{0.879320085f, 0.928780198f},
-std::array<float,2>{0.147296607f, 0.740028501f},
-std::array<float,2>{0.981943667f, 0.427882433f},
-std::array<float,2>{0.330668002f, 0.152439445f},
-std::array<float,2>{0.708391368f, 0.75851351f},
-std::array<float,2>{0.447380602f, 0.995819807f},
-std::array<float,2>{0.52619791f, 0.0996435806f},
-std::array<float,2>{0.0230273046f, 0.283844531f},
-std::array<float,2>{0.776097417f, 0.613356054f},
-std::array<float,2>{0.244672477f, 0.903905272f},
-std::array<float,2>{0.928678989f, 0.0566822998f},
-std::array<float,2>{0.255722851f, 0.339181244f},
-std::array<float,2>{0.674379408f, 0.501851439f},
-std::array<float,2>{0.379307866f, 0.656824172f},
-std::array<float,2>{0.574357808f, 0.453362554f},
-std::array<float,2>{0.0865546539f, 0.210264653f},
-std::array<float,2>{0.858366072f, 0.87309885f},
-std::array<float,2>{0.0379946232f, 0.570318043f},
-std::array<float,2>{0.781745434f, 0.267372102f},
-std::array<float,2>{0.47870779f, 0.0748000443f},
-std::array<float,2>{0.553074539f, 0.939565182f},
-std::array<float,2>{0.367824435f, 0.790043652f},
-std::array<float,2>{0.731320322f, 0.173975304f},
-std::array<float,2>{0.165862277f, 0.39613089f},
-std::array<float,2>{0.948190629f, 0.699222863f},
-std::array<float,2>{0.00617133873f, 0.900180995f},
-std::array<float,2>{0.757773936f, 0.059739586f},
-std::array<float,2>{0.457655787f, 0.343437582f},
-std::array<float,2>{0.500268757f, 0.504009783f},
-std::array<float,2>{0.314818561f, 0.661690652f},
-std::array<float,2>{0.6906811f, 0.458293378f},
-std::array<float,2>{0.133070782f, 0.20563598f},
-std::array<float,2>{0.984821856f, 0.869300127f},
-std::array<float,2>{0.211804017f, 0.577088892f},
-std::array<float,2>{0.895751953f, 0.272876054f},
-std::array<float,2>{0.295553774f, 0.0719473064f},
-std::array<float,2>{0.650879264f, 0.944928765f},
-std::array<float,2>{0.422605693f, 0.794699132f},
-std::array<float,2>{0.599108815f, 0.177054018f},
-std::array<float,2>{0.0956589654f, 0.391466469f},
-std::array<float,2>{0.83326f, 0.698643148f},
-std::array<float,2>{0.184303507f, 0.822320163f},
-std::array<float,2>{0.953412652f, 0.225819528f},
-std::array<float,2>{0.354076624f, 0.491067678f},
-std::array<float,2>{0.734769642f, 0.642104566f},
-std::array<float,2>{0.491307378f, 0.552139044f},
-std::array<float,2>{0.540701687f, 0.36001882f},
-std::array<float,2>{0.0572955273f, 0.0266454536f},
-std::array<float,2>{0.804146111f, 0.925577879f},
-std::array<float,2>{0.0772414654f, 0.735935509f},
-std::array<float,2>{0.864711165f, 0.423515022f},
-std::array<float,2>{0.398812592f, 0.151085049f},
-std::array<float,2>{0.586126328f, 0.764629185f},
-std::array<float,2>{0.270979971f, 0.996452212f},
-std::array<float,2>{0.659132838f, 0.097439535f},
-std::array<float,2>{0.22183162f, 0.287330598f},
-std::array<float,2>{0.918918908f, 0.609755099f},
-std::array<float,2>{0.117912546f, 0.775634527f},
-std::array<float,2>{0.821600378f, 0.136174411f},
-std::array<float,2>{0.421006471f, 0.415423781f},
-std::array<float,2>{0.614447415f, 0.72823137f},
-std::array<float,2>{0.30469352f, 0.594753087f},
-std::array<float,2>{0.633908749f, 0.311776429f},
-std::array<float,2>{0.191704407f, 0.112495452f},
-std::array<float,2>{0.889962554f, 0.975710154f},
-std::array<float,2>{0.152277693f, 0.629289389f},
-std::array<float,2>{0.970935464f, 0.482701778f},
-std::array<float,2>{0.340968639f, 0.249033585f},
-std::array<float,2>{0.716569662f, 0.84137255f},
-std::array<float,2>{0.438394666f, 0.9182567f},
-std::array<float,2>{0.517255962f, 0.00405033212f},
-std::array<float,2>{0.028454585f, 0.345919043f},
-std::array<float,2>{0.769940555f, 0.540741265f},
-std::array<float,2>{0.238458633f, 0.95358026f},
-std::array<float,2>{0.932142019f, 0.0806880891f},
-std::array<float,2>{0.258250684f, 0.262130111f},
-std::array<float,2>{0.686128259f, 0.583119094f},
-std::array<float,2>{0.385613441f, 0.710043013f},
-std::array<float,2>{0.569319963f, 0.383241385f},
-std::array<float,2>{0.0796934739f, 0.159416839f},
-std::array<float,2>{0.848224938f, 0.805238545f},
-std::array<float,2>{0.0455212109f, 0.526828587f},
-std::array<float,2>{0.795877814f, 0.32364881f},
-std::array<float,2>{0.475956976f, 0.0408809558f},
-std::array<float,2>{0.556918383f, 0.881063938f},
-std::array<float,2>{0.366869092f, 0.854073524f},
-std::array<float,2>{0.724898577f, 0.190973178f},
-std::array<float,2>{0.163957715f, 0.441167057f},
-std::array<float,2>{0.937931597f, 0.683068693f},
-std::array<float,2>{0.0908300802f, 0.97784704f},
-std::array<float,2>{0.854162931f, 0.122154497f},
-std::array<float,2>{0.377220511f, 0.303287894f},
-std::array<float,2>{0.570382178f, 0.608612061f},
-std::array<float,2>{0.253501207f, 0.72143656f},
-std::array<float,2>{0.67766428f, 0.41213572f},
-std::array<float,2>{0.249180332f, 0.131442621f},
-std::array<float,2>{0.924618781f, 0.770786285f},
-std::array<float,2>{0.171555236f, 0.536594272f},
-std::array<float,2>{0.952897668f, 0.353493065f},
-std::array<float,2>{0.371944666f, 0.013071456f},
-std::array<float,2>{0.728892863f, 0.907949448f},
-std::array<float,2>{0.481264204f, 0.831157506f},
-std::array<float,2>{0.548516989f, 0.235226259f},
-std::array<float,2>{0.0313697383f, 0.471655399f},
-std::array<float,2>{0.788298786f, 0.638651431f},
-std::array<float,2>{0.195578799f, 0.798142433f},
-std::array<float,2>{0.878687799f, 0.165992543f},
-std::array<float,2>{0.296946526f, 0.381595105f},
-std::array<float,2>{0.62935406f, 0.71163094f},
-std::array<float,2>{0.408264011f, 0.591024339f},
-std::array<float,2>{0.622041583f, 0.25413543f},
-std::array<float,2>{0.114209421f, 0.0917695388f},
-std::array<float,2>{0.815117657f, 0.96139884f},
-std::array<float,2>{0.0179759227f, 0.672220528f},
-std::array<float,2>{0.780254364f, 0.445713222f},
-std::array<float,2>{0.451955318f, 0.202769756f},
-std::array<float,2>{0.531222403f, 0.851000726f},
-std::array<float,2>{0.333789736f, 0.887681246f},
-std::array<float,2>{0.705695033f, 0.0344672501f},
-std::array<float,2>{0.143041015f, 0.319573939f},
-std::array<float,2>{0.976694107f, 0.517471611f},
-std::array<float,2>{0.0498011969f, 0.865436018f},
-std::array<float,2>{0.811584234f, 0.215214014f},
-std::array<float,2>{0.497071862f, 0.46758914f},
-std::array<float,2>{0.538377285f, 0.670022666f},
-std::array<float,2>{0.348873764f, 0.510412931f},
-std::array<float,2>{0.749820828f, 0.328248531f},
-std::array<float,2>{0.175278977f, 0.050689023f},
-std::array<float,2>{0.967021167f, 0.892644048f},
-std::array<float,2>{0.230580002f, 0.69141537f},
-std::array<float,2>{0.908738315f, 0.399223f},
-std::array<float,2>{0.275426298f, 0.179735288f},
-std::array<float,2>{0.671491742f, 0.785253346f},
-std::array<float,2>{0.398249447f, 0.950591505f},
-std::array<float,2>{0.580324948f, 0.0702132732f},
-std::array<float,2>{0.0680216104f, 0.27694279f},
-std::array<float,2>{0.874089897f, 0.569034338f},
-std::array<float,2>{0.131668106f, 0.935565472f},
-std::array<float,2>{0.992371738f, 0.0190400966f},
-std::array<float,2>{0.322340757f, 0.373012125f},
-std::array<float,2>{0.697764218f, 0.562095106f},
-std::array<float,2>{0.467269391f, 0.655907154f},
-std::array<float,2>{0.515288591f, 0.497276783f},
-std::array<float,2>{0.0155940959f, 0.2340042f},
-std::array<float,2>{0.758114338f, 0.818373859f},
-std::array<float,2>{0.106003433f, 0.620314181f},
-std::array<float,2>{0.836606801f, 0.294223309f},
-std::array<float,2>{0.43340072f, 0.106185392f},
-std::array<float,2>{0.607416511f, 0.988179803f},
-std::array<float,2>{0.286855012f, 0.755098701f},
-std::array<float,2>{0.642574072f, 0.141360611f},
-std::array<float,2>{0.203503668f, 0.43636626f},
-std::array<float,2>{0.903716087f, 0.744655073f},
-std::array<float,2>{0.0994243324f, 0.910981715f},
-std::array<float,2>{0.830532372f, 0.00989763904f},
-std::array<float,2>{0.426752925f, 0.356217414f},
-std::array<float,2>{0.596911073f, 0.531594872f},
-std::array<float,2>{0.289944053f, 0.634139895f},
-std::array<float,2>{0.653739572f, 0.474444389f},
-std::array<float,2>{0.217503458f, 0.239026085f},
-std::array<float,2>{0.894413948f, 0.832974732f},
-std::array<float,2>{0.137128189f, 0.602384984f},
-std::array<float,2>{0.991837442f, 0.299018145f},
-std::array<float,2>{0.317440718f, 0.117660098f},
-std::array<float,2>{0.694783568f, 0.982219636f},
-std::array<float,2>{0.454607993f, 0.767144024f},
-std::array<float,2>{0.504040658f, 0.12538372f},
-std::array<float,2>{0.00233839732f, 0.409582615f},
-std::array<float,2>{0.752586842f, 0.724401474f},
-std::array<float,2>{0.224550128f, 0.845576882f},
-std::array<float,2>{0.916999638f, 0.198989317f},
-std::array<float,2>{0.265725493f, 0.449516535f},
-std::array<float,2>{0.663749278f, 0.678021669f},
-std::array<float,2>{0.405954808f, 0.522183716f},
-std::array<float,2>{0.592119634f, 0.314178199f},
-std::array<float,2>{0.0709879249f, 0.035611961f},
-std::array<float,2>{0.860990644f, 0.884166777f},
-std::array<float,2>{0.0597603321f, 0.714966893f},
-std::array<float,2>{0.79744482f, 0.376752824f},
-std::array<float,2>{0.48610875f, 0.168378741f},
-std::array<float,2>{0.543718576f, 0.801530659f},
-std::array<float,2>{0.357084334f, 0.966728926f},
-std::array<float,2>{0.739218414f, 0.0885260105f},
-std::array<float,2>{0.183092326f, 0.252433717f},
-std::array<float,2>{0.959046304f, 0.586595714f},
-std::array<float,2>{0.0243135393f, 0.782885075f},
-std::array<float,2>{0.766766608f, 0.187050477f},
-std::array<float,2>{0.442597181f, 0.404365271f},
-std::array<float,2>{0.519560277f, 0.69028616f},
-std::array<float,2>{0.336694241f, 0.565015614f},
-std::array<float,2>{0.712562859f, 0.27753678f},
-std::array<float,2>{0.15315409f, 0.065106988f},
-std::array<float,2>{0.975220501f, 0.948791385f},
-std::array<float,2>{0.187855318f, 0.664538503f},
-std::array<float,2>{0.884085894f, 0.46202597f},
-std::array<float,2>{0.311428607f, 0.214680314f},
-std::array<float,2>{0.639788926f, 0.862457216f},
-std::array<float,2>{0.414892316f, 0.896993816f},
-std::array<float,2>{0.612668157f, 0.0527972691f},
-std::array<float,2>{0.124830998f, 0.332651377f},
-std::array<float,2>{0.82696259f, 0.51295501f},
-std::array<float,2>{0.157667711f, 0.990826368f},
-std::array<float,2>{0.942216396f, 0.104206927f},
-std::array<float,2>{0.361152947f, 0.289856911f},
-std::array<float,2>{0.72216934f, 0.621752143f},
-std::array<float,2>{0.471212924f, 0.746243775f},
-std::array<float,2>{0.55969429f, 0.430669934f},
-std::array<float,2>{0.0405033641f, 0.147374526f},
-std::array<float,2>{0.789959729f, 0.751847684f},
-std::array<float,2>{0.0847720206f, 0.555823863f},
-std::array<float,2>{0.846744001f, 0.369921774f},
-std::array<float,2>{0.389526963f, 0.0220975652f},
-std::array<float,2>{0.564397454f, 0.9311409f},
-std::array<float,2>{0.262814015f, 0.814532161f},
-std::array<float,2>{0.680222452f, 0.22990109f},
-std::array<float,2>{0.237530738f, 0.495253891f},
-std::array<float,2>{0.936591387f, 0.649053752f},
-std::array<float,2>{0.0367389843f, 0.941115499f},
-std::array<float,2>{0.784037411f, 0.0759346262f},
-std::array<float,2>{0.478093177f, 0.266131639f},
-std::array<float,2>{0.552044809f, 0.571357548f},
-std::array<float,2>{0.369352072f, 0.700648785f},
-std::array<float,2>{0.732586145f, 0.394846141f},
-std::array<float,2>{0.167622626f, 0.175594628f},
-std::array<float,2>{0.945729852f, 0.789393604f},
-std::array<float,2>{0.243241534f, 0.500075519f},
-std::array<float,2>{0.926744223f, 0.338476062f},
-std::array<float,2>{0.256519109f, 0.0576269627f},
-std::array<float,2>{0.672922492f, 0.903167129f},
-std::array<float,2>{0.381244659f, 0.874683201f},
-std::array<float,2>{0.577357948f, 0.209529161f},
-std::array<float,2>{0.0894976854f, 0.455069393f},
-std::array<float,2>{0.856768429f, 0.657636404f},
-std::array<float,2>{0.146294683f, 0.758904696f},
-std::array<float,2>{0.982568383f, 0.153871492f},
-std::array<float,2>{0.329392403f, 0.429422587f},
-std::array<float,2>{0.709737062f, 0.739019394f},
-std::array<float,2>{0.446031868f, 0.614970565f},
-std::array<float,2>{0.524200737f, 0.284782946f},
-std::array<float,2>{0.0211200695f, 0.101406299f},
-std::array<float,2>{0.774767041f, 0.99433279f},
-std::array<float,2>{0.111086011f, 0.646719694f},
-std::array<float,2>{0.818248093f, 0.484683067f},
-std::array<float,2>{0.412901729f, 0.221213862f},
-std::array<float,2>{0.619673491f, 0.824500144f},
-std::array<float,2>{0.301770061f, 0.927892745f},
-std::array<float,2>{0.626796365f, 0.0311664492f},
-std::array<float,2>{0.20265919f, 0.363375068f},
-std::array<float,2>{0.881663203f, 0.54716599f},
-std::array<float,2>{0.0638814867f, 0.839523733f},
-std::array<float,2>{0.869149566f, 0.243699372f},
-std::array<float,2>{0.391095728f, 0.47734797f},
-std::array<float,2>{0.585453331f, 0.627346814f},
-std::array<float,2>{0.280941606f, 0.544677794f},
-std::array<float,2>{0.667032063f, 0.349789202f},
-std::array<float,2>{0.230346441f, 0.000908882706f},
-std::array<float,2>{0.912391424f, 0.914893091f},
-std::array<float,2>{0.177382275f, 0.732369602f},
-std::array<float,2>{0.964299083f, 0.418114662f},
-std::array<float,2>{0.34687236f, 0.140144512f},
-std::array<float,2>{0.743047655f, 0.779959857f},
-std::array<float,2>{0.494473159f, 0.970059514f},
-std::array<float,2>{0.531358242f, 0.115600787f},
-std::array<float,2>{0.0544211343f, 0.305765837f},
-std::array<float,2>{0.805913985f, 0.60064137f},
-std::array<float,2>{0.210930273f, 0.878124237f},
-std::array<float,2>{0.900936365f, 0.0455910824f},
-std::array<float,2>{0.283596814f, 0.325050324f},
-std::array<float,2>{0.644980431f, 0.528369009f},
-std::array<float,2>{0.435155302f, 0.685957253f},
-std::array<float,2>{0.603853762f, 0.444924176f},
-std::array<float,2>{0.101701908f, 0.194643304f},
-std::array<float,2>{0.840985715f, 0.855985463f},
-std::array<float,2>{0.00940112211f, 0.581819534f},
-std::array<float,2>{0.762043774f, 0.258780479f},
-std::array<float,2>{0.463093966f, 0.0857699215f},
-std::array<float,2>{0.508620203f, 0.958550036f},
-std::array<float,2>{0.327297896f, 0.810343206f},
-std::array<float,2>{0.700951159f, 0.16374068f},
-std::array<float,2>{0.126965553f, 0.389546484f},
-std::array<float,2>{0.996862471f, 0.706399143f},
-std::array<float,2>{0.0557484515f, 0.921903431f},
-std::array<float,2>{0.801270545f, 0.0242979508f},
-std::array<float,2>{0.489707083f, 0.362630457f},
-std::array<float,2>{0.541492462f, 0.552798212f},
-std::array<float,2>{0.352035433f, 0.644045651f},
-std::array<float,2>{0.737007499f, 0.488782167f},
-std::array<float,2>{0.187157527f, 0.223977059f},
-std::array<float,2>{0.956165433f, 0.821054161f},
-std::array<float,2>{0.219601303f, 0.611466587f},
-std::array<float,2>{0.920428455f, 0.28604427f},
-std::array<float,2>{0.272631735f, 0.0947834402f},
-std::array<float,2>{0.657190323f, 0.998140514f},
-std::array<float,2>{0.40093559f, 0.76358819f},
-std::array<float,2>{0.588733315f, 0.148736328f},
-std::array<float,2>{0.0751310736f, 0.42571032f},
-std::array<float,2>{0.866461754f, 0.737365961f},
-std::array<float,2>{0.136339337f, 0.86808461f},
-std::array<float,2>{0.987724602f, 0.203648955f},
-std::array<float,2>{0.314435989f, 0.460145772f},
-std::array<float,2>{0.688879669f, 0.662889004f},
-std::array<float,2>{0.460876703f, 0.506382406f},
-std::array<float,2>{0.503534436f, 0.339984298f},
-std::array<float,2>{0.0039665089f, 0.0614209324f},
-std::array<float,2>{0.75453943f, 0.901719809f},
-std::array<float,2>{0.0957231596f, 0.696009219f},
-std::array<float,2>{0.834814072f, 0.394172966f},
-std::array<float,2>{0.423874527f, 0.179681048f},
-std::array<float,2>{0.601234317f, 0.796436429f},
-std::array<float,2>{0.294454783f, 0.942777097f},
-std::array<float,2>{0.648617804f, 0.073570691f},
-std::array<float,2>{0.213633776f, 0.270970285f},
-std::array<float,2>{0.897944272f, 0.575417519f},
-std::array<float,2>{0.0802514926f, 0.807772994f},
-std::array<float,2>{0.851100981f, 0.156791717f},
-std::array<float,2>{0.383255213f, 0.385225862f},
-std::array<float,2>{0.56783855f, 0.707153618f},
-std::array<float,2>{0.260419816f, 0.584536552f},
-std::array<float,2>{0.685340524f, 0.265588105f},
-std::array<float,2>{0.240832552f, 0.0791608617f},
-std::array<float,2>{0.930357039f, 0.956107378f},
-std::array<float,2>{0.160849631f, 0.680120766f},
-std::array<float,2>{0.939757466f, 0.438965499f},
-std::array<float,2>{0.364842176f, 0.188882157f},
-std::array<float,2>{0.723462701f, 0.85185951f},
-std::array<float,2>{0.472736269f, 0.880414367f},
-std::array<float,2>{0.556147218f, 0.0425287709f},
-std::array<float,2>{0.0439294204f, 0.320518106f},
-std::array<float,2>{0.793617964f, 0.525348663f},
-std::array<float,2>{0.194399953f, 0.974181116f},
-std::array<float,2>{0.888616979f, 0.109569363f},
-std::array<float,2>{0.307523906f, 0.309200168f},
-std::array<float,2>{0.636170626f, 0.596996605f},
-std::array<float,2>{0.418135524f, 0.729620993f},
-std::array<float,2>{0.616905749f, 0.417205691f},
-std::array<float,2>{0.121082559f, 0.133193851f},
-std::array<float,2>{0.82394433f, 0.775372922f},
-std::array<float,2>{0.0310926549f, 0.541153193f},
-std::array<float,2>{0.771608114f, 0.343940377f},
-std::array<float,2>{0.440205812f, 0.00674462132f},
-std::array<float,2>{0.518516302f, 0.921052039f},
-std::array<float,2>{0.342677176f, 0.843655944f},
-std::array<float,2>{0.716872513f, 0.247477472f},
-std::array<float,2>{0.148742288f, 0.48222208f},
-std::array<float,2>{0.969553292f, 0.631186306f},
-std::array<float,2>{0.115866236f, 0.963255942f},
-std::array<float,2>{0.814363062f, 0.0921806172f},
-std::array<float,2>{0.406808227f, 0.257125348f},
-std::array<float,2>{0.623650372f, 0.593134403f},
-std::array<float,2>{0.300409406f, 0.713182032f},
-std::array<float,2>{0.631747663f, 0.380482644f},
-std::array<float,2>{0.198914394f, 0.166060388f},
-std::array<float,2>{0.876283407f, 0.798952401f},
-std::array<float,2>{0.14132458f, 0.518156052f},
-std::array<float,2>{0.980221927f, 0.316614509f},
-std::array<float,2>{0.335679173f, 0.0331261344f},
-std::array<float,2>{0.703535259f, 0.890542746f},
-std::array<float,2>{0.450703859f, 0.847977638f},
-std::array<float,2>{0.529043317f, 0.199660152f},
-std::array<float,2>{0.0173268653f, 0.447472572f},
-std::array<float,2>{0.778398871f, 0.674452543f},
-std::array<float,2>{0.247281864f, 0.772795022f},
-std::array<float,2>{0.922361493f, 0.13055858f},
-std::array<float,2>{0.251039684f, 0.410229951f},
-std::array<float,2>{0.678859532f, 0.719514787f},
-std::array<float,2>{0.375330657f, 0.606714308f},
-std::array<float,2>{0.573389769f, 0.301155239f},
-std::array<float,2>{0.0931444839f, 0.124178708f},
-std::array<float,2>{0.852248907f, 0.979157209f},
-std::array<float,2>{0.0351134427f, 0.639083922f},
-std::array<float,2>{0.785495281f, 0.46995765f},
-std::array<float,2>{0.484282792f, 0.237056807f},
-std::array<float,2>{0.549171686f, 0.829583049f},
-std::array<float,2>{0.373104393f, 0.909553111f},
-std::array<float,2>{0.727221012f, 0.0143000148f},
-std::array<float,2>{0.169703692f, 0.353911519f},
-std::array<float,2>{0.950997949f, 0.538452208f},
-std::array<float,2>{0.0128122279f, 0.817647576f},
-std::array<float,2>{0.761222899f, 0.231344327f},
-std::array<float,2>{0.464883506f, 0.49911496f},
-std::array<float,2>{0.511932015f, 0.652591646f},
-std::array<float,2>{0.320340365f, 0.558717191f},
-std::array<float,2>{0.697262824f, 0.37478146f},
-std::array<float,2>{0.130039915f, 0.015927542f},
-std::array<float,2>{0.995527923f, 0.935466409f},
-std::array<float,2>{0.205589101f, 0.743597806f},
-std::array<float,2>{0.905477405f, 0.4350245f},
-std::array<float,2>{0.288495213f, 0.143269449f},
-std::array<float,2>{0.64444685f, 0.757358015f},
-std::array<float,2>{0.431422412f, 0.984403908f},
-std::array<float,2>{0.609106302f, 0.108543649f},
-std::array<float,2>{0.108222656f, 0.294995219f},
-std::array<float,2>{0.839024842f, 0.617418528f},
-std::array<float,2>{0.173104092f, 0.892153203f},
-std::array<float,2>{0.966158509f, 0.048448883f},
-std::array<float,2>{0.350009382f, 0.330848098f},
-std::array<float,2>{0.747575819f, 0.509083569f},
-std::array<float,2>{0.498502225f, 0.66943562f},
-std::array<float,2>{0.536735237f, 0.465027869f},
-std::array<float,2>{0.0482304208f, 0.217415869f},
-std::array<float,2>{0.810457587f, 0.864633501f},
-std::array<float,2>{0.0694427341f, 0.566791952f},
-std::array<float,2>{0.872352302f, 0.273592263f},
-std::array<float,2>{0.395094633f, 0.0669301152f},
-std::array<float,2>{0.579737306f, 0.951943457f},
-std::array<float,2>{0.274989933f, 0.787314475f},
-std::array<float,2>{0.668841422f, 0.182882994f},
-std::array<float,2>{0.233704448f, 0.40081194f},
-std::array<float,2>{0.907146275f, 0.693940282f},
-std::array<float,2>{0.073562786f, 0.884936631f},
-std::array<float,2>{0.861974061f, 0.0389374234f},
-std::array<float,2>{0.404249728f, 0.316325873f},
-std::array<float,2>{0.590941668f, 0.521257937f},
-std::array<float,2>{0.268499643f, 0.67695117f},
-std::array<float,2>{0.661339521f, 0.451619178f},
-std::array<float,2>{0.226009801f, 0.197245836f},
-std::array<float,2>{0.915754676f, 0.847111166f},
-std::array<float,2>{0.180146948f, 0.589575648f},
-std::array<float,2>{0.957978427f, 0.251690567f},
-std::array<float,2>{0.358877212f, 0.0872711465f},
-std::array<float,2>{0.741665065f, 0.967340291f},
-std::array<float,2>{0.488020182f, 0.804127991f},
-std::array<float,2>{0.545787871f, 0.171816126f},
-std::array<float,2>{0.0619776361f, 0.378543645f},
-std::array<float,2>{0.799638152f, 0.717920899f},
-std::array<float,2>{0.214961231f, 0.835295439f},
-std::array<float,2>{0.892534435f, 0.241432801f},
-std::array<float,2>{0.291997254f, 0.474709094f},
-std::array<float,2>{0.654897749f, 0.635642111f},
-std::array<float,2>{0.427937418f, 0.53477627f},
-std::array<float,2>{0.5951038f, 0.35849005f},
-std::array<float,2>{0.101318337f, 0.00816704798f},
-std::array<float,2>{0.829016149f, 0.913359523f},
-std::array<float,2>{0.00116896525f, 0.726284623f},
-std::array<float,2>{0.750817478f, 0.40737164f},
-std::array<float,2>{0.45513007f, 0.128065303f},
-std::array<float,2>{0.507742763f, 0.767994583f},
-std::array<float,2>{0.319695562f, 0.983910441f},
-std::array<float,2>{0.691838503f, 0.119497903f},
-std::array<float,2>{0.13976334f, 0.297266096f},
-std::array<float,2>{0.98957175f, 0.603898644f},
-std::array<float,2>{0.0416190214f, 0.752737939f},
-std::array<float,2>{0.79268527f, 0.144986406f},
-std::array<float,2>{0.470381737f, 0.432768196f},
-std::array<float,2>{0.561410785f, 0.748113632f},
-std::array<float,2>{0.361739576f, 0.62382251f},
-std::array<float,2>{0.719872057f, 0.291271776f},
-std::array<float,2>{0.15929237f, 0.102987818f},
-std::array<float,2>{0.945073664f, 0.988769889f},
-std::array<float,2>{0.235677436f, 0.651675701f},
-std::array<float,2>{0.935251415f, 0.494138151f},
-std::array<float,2>{0.265178949f, 0.226817429f},
-std::array<float,2>{0.682032347f, 0.814268768f},
-std::array<float,2>{0.387857318f, 0.933111727f},
-std::array<float,2>{0.56566906f, 0.0212026611f},
-std::array<float,2>{0.0825324282f, 0.367929339f},
-std::array<float,2>{0.845505297f, 0.558147609f},
-std::array<float,2>{0.156119287f, 0.946075559f},
-std::array<float,2>{0.973328412f, 0.0626286492f},
-std::array<float,2>{0.339802802f, 0.279353052f},
-std::array<float,2>{0.713625073f, 0.563105345f},
-std::array<float,2>{0.444609761f, 0.687603772f},
-std::array<float,2>{0.521999717f, 0.4028202f},
-std::array<float,2>{0.026371669f, 0.184013873f},
-std::array<float,2>{0.768066287f, 0.784245074f},
-std::array<float,2>{0.122498341f, 0.514442205f},
-std::array<float,2>{0.824434519f, 0.33511284f},
-std::array<float,2>{0.41711536f, 0.0514449142f},
-std::array<float,2>{0.610272467f, 0.896204412f},
-std::array<float,2>{0.309818685f, 0.861246228f},
-std::array<float,2>{0.638333142f, 0.211432815f},
-std::array<float,2>{0.191330343f, 0.464785457f},
-std::array<float,2>{0.885772049f, 0.667836785f},
-std::array<float,2>{0.0220750831f, 0.992507696f},
-std::array<float,2>{0.776498616f, 0.0994595513f},
-std::array<float,2>{0.448439091f, 0.282656014f},
-std::array<float,2>{0.526913702f, 0.616816759f},
-std::array<float,2>{0.331055731f, 0.740449965f},
-std::array<float,2>{0.707659364f, 0.426288664f},
-std::array<float,2>{0.147779182f, 0.1559899f},
-std::array<float,2>{0.980481684f, 0.761703014f},
-std::array<float,2>{0.19968994f, 0.548990071f},
-std::array<float,2>{0.880516708f, 0.365311503f},
-std::array<float,2>{0.304229349f, 0.0274662264f},
-std::array<float,2>{0.627783179f, 0.926960766f},
-std::array<float,2>{0.411747307f, 0.827832341f},
-std::array<float,2>{0.61896956f, 0.220637381f},
-std::array<float,2>{0.112394035f, 0.487108797f},
-std::array<float,2>{0.819850385f, 0.644908249f},
-std::array<float,2>{0.164267898f, 0.792403638f},
-std::array<float,2>{0.949071288f, 0.173231289f},
-std::array<float,2>{0.368220776f, 0.397385001f},
-std::array<float,2>{0.731994689f, 0.702379286f},
-std::array<float,2>{0.479593188f, 0.573428869f},
-std::array<float,2>{0.554032266f, 0.269341439f},
-std::array<float,2>{0.0382864401f, 0.0766586289f},
-std::array<float,2>{0.782844901f, 0.938566208f},
-std::array<float,2>{0.087550588f, 0.659085393f},
-std::array<float,2>{0.859254539f, 0.45553726f},
-std::array<float,2>{0.380319864f, 0.208887219f},
-std::array<float,2>{0.575486124f, 0.871619582f},
-std::array<float,2>{0.254158139f, 0.904561698f},
-std::array<float,2>{0.675599694f, 0.0547692142f},
-std::array<float,2>{0.24531883f, 0.337828398f},
-std::array<float,2>{0.929298639f, 0.503757954f},
-std::array<float,2>{0.104559749f, 0.858931482f},
-std::array<float,2>{0.843404233f, 0.192635328f},
-std::array<float,2>{0.436464995f, 0.442676574f},
-std::array<float,2>{0.601696432f, 0.683855832f},
-std::array<float,2>{0.283064395f, 0.529823244f},
-std::array<float,2>{0.646651268f, 0.326933056f},
-std::array<float,2>{0.207777277f, 0.0435839184f},
-std::array<float,2>{0.90003252f, 0.876012564f},
-std::array<float,2>{0.12693572f, 0.70437026f},
-std::array<float,2>{0.998131752f, 0.387032121f},
-std::array<float,2>{0.325183004f, 0.160908476f},
-std::array<float,2>{0.703027129f, 0.812289774f},
-std::array<float,2>{0.462865055f, 0.959691048f},
-std::array<float,2>{0.510945141f, 0.0839582384f},
-std::array<float,2>{0.00995677337f, 0.261368155f},
-std::array<float,2>{0.764231324f, 0.579495072f},
-std::array<float,2>{0.227369443f, 0.916654229f},
-std::array<float,2>{0.911961317f, 0.00348120299f},
-std::array<float,2>{0.278448761f, 0.349395484f},
-std::array<float,2>{0.665259659f, 0.546206951f},
-std::array<float,2>{0.392654628f, 0.626024663f},
-std::array<float,2>{0.582610548f, 0.479235768f},
-std::array<float,2>{0.0648651719f, 0.246049792f},
-std::array<float,2>{0.867612064f, 0.836681962f},
-std::array<float,2>{0.0521357432f, 0.598256528f},
-std::array<float,2>{0.807658315f, 0.308156133f},
-std::array<float,2>{0.494131744f, 0.11431513f},
-std::array<float,2>{0.535000265f, 0.971175313f},
-std::array<float,2>{0.34396109f, 0.778121829f},
-std::array<float,2>{0.745017529f, 0.137837306f},
-std::array<float,2>{0.178610191f, 0.4199453f},
-std::array<float,2>{0.962675273f, 0.734233916f},
-std::array<float,2>{0.0147267636f, 0.934848666f},
-std::array<float,2>{0.758608699f, 0.0161608532f},
-std::array<float,2>{0.467286289f, 0.374265224f},
-std::array<float,2>{0.515070021f, 0.559335291f},
-std::array<float,2>{0.323172003f, 0.653141379f},
-std::array<float,2>{0.69744736f, 0.499987692f},
-std::array<float,2>{0.131276563f, 0.230917528f},
-std::array<float,2>{0.993029833f, 0.818139195f},
-std::array<float,2>{0.204089358f, 0.61778307f},
-std::array<float,2>{0.904173553f, 0.295721412f},
-std::array<float,2>{0.28624481f, 0.109340787f},
-std::array<float,2>{0.641730607f, 0.98502779f},
-std::array<float,2>{0.43308413f, 0.757288873f},
-std::array<float,2>{0.606560051f, 0.142595381f},
-std::array<float,2>{0.105637461f, 0.435326725f},
-std::array<float,2>{0.83635956f, 0.743728876f},
-std::array<float,2>{0.175358012f, 0.864929736f},
-std::array<float,2>{0.967737675f, 0.217011005f},
-std::array<float,2>{0.34916538f, 0.465491027f},
-std::array<float,2>{0.749072909f, 0.669158816f},
-std::array<float,2>{0.49780196f, 0.509613395f},
-std::array<float,2>{0.53902632f, 0.330288291f},
-std::array<float,2>{0.0491073206f, 0.0482484289f},
-std::array<float,2>{0.812135577f, 0.891791165f},
-std::array<float,2>{0.0674147382f, 0.693636537f},
-std::array<float,2>{0.874561548f, 0.40116778f},
-std::array<float,2>{0.397570699f, 0.18317993f},
-std::array<float,2>{0.580672264f, 0.787707686f},
-std::array<float,2>{0.276177704f, 0.951458931f},
-std::array<float,2>{0.671318531f, 0.0668692663f},
-std::array<float,2>{0.231048733f, 0.274014413f},
-std::array<float,2>{0.908461094f, 0.567089438f},
-std::array<float,2>{0.113706566f, 0.799613476f},
-std::array<float,2>{0.814892709f, 0.166973546f},
-std::array<float,2>{0.408808738f, 0.380250067f},
-std::array<float,2>{0.621563911f, 0.713537514f},
-std::array<float,2>{0.297702044f, 0.593714654f},
-std::array<float,2>{0.629654288f, 0.257547557f},
-std::array<float,2>{0.196160719f, 0.0924907178f},
-std::array<float,2>{0.877987206f, 0.963532507f},
-std::array<float,2>{0.143229574f, 0.674282789f},
-std::array<float,2>{0.977332771f, 0.448098987f},
-std::array<float,2>{0.333135158f, 0.200190663f},
-std::array<float,2>{0.705162168f, 0.84855175f},
-std::array<float,2>{0.451322526f, 0.889740229f},
-std::array<float,2>{0.530457437f, 0.0327114835f},
-std::array<float,2>{0.0182825234f, 0.317113191f},
-std::array<float,2>{0.779396296f, 0.517876089f},
-std::array<float,2>{0.249998435f, 0.978744626f},
-std::array<float,2>{0.9239887f, 0.124972038f},
-std::array<float,2>{0.253342897f, 0.301686943f},
-std::array<float,2>{0.677105367f, 0.607152343f},
-std::array<float,2>{0.377696127f, 0.718849242f},
-std::array<float,2>{0.570942283f, 0.410733223f},
-std::array<float,2>{0.091621168f, 0.129888862f},
-std::array<float,2>{0.853856862f, 0.773398519f},
-std::array<float,2>{0.0321971476f, 0.538677931f},
-std::array<float,2>{0.788585722f, 0.354077786f},
-std::array<float,2>{0.480909109f, 0.0139820399f},
-std::array<float,2>{0.548306525f, 0.910138309f},
-std::array<float,2>{0.371272087f, 0.829636514f},
-std::array<float,2>{0.729288042f, 0.236415267f},
-std::array<float,2>{0.171142399f, 0.470387965f},
-std::array<float,2>{0.952588975f, 0.639614046f},
-std::array<float,2>{0.0794721544f, 0.95701611f},
-std::array<float,2>{0.848133802f, 0.079678081f},
-std::array<float,2>{0.385094434f, 0.264793307f},
-std::array<float,2>{0.568674743f, 0.584462523f},
-std::array<float,2>{0.258675694f, 0.707524598f},
-std::array<float,2>{0.68586874f, 0.385395736f},
-std::array<float,2>{0.238891885f, 0.156556204f},
-std::array<float,2>{0.93201822f, 0.8081159f},
-std::array<float,2>{0.163168609f, 0.524783909f},
-std::array<float,2>{0.938261271f, 0.321224153f},
-std::array<float,2>{0.366220981f, 0.0423127227f},
-std::array<float,2>{0.725393414f, 0.879978299f},
-std::array<float,2>{0.476494044f, 0.852356791f},
-std::array<float,2>{0.557256401f, 0.189148679f},
-std::array<float,2>{0.0453023985f, 0.438490808f},
-std::array<float,2>{0.795003533f, 0.680328965f},
-std::array<float,2>{0.19213891f, 0.774632573f},
-std::array<float,2>{0.890165985f, 0.133321658f},
-std::array<float,2>{0.305192113f, 0.417952091f},
-std::array<float,2>{0.63470006f, 0.730451345f},
-std::array<float,2>{0.421397954f, 0.59737277f},
-std::array<float,2>{0.615184247f, 0.308914423f},
-std::array<float,2>{0.117386699f, 0.109877624f},
-std::array<float,2>{0.822145939f, 0.973938406f},
-std::array<float,2>{0.0289767571f, 0.631364584f},
-std::array<float,2>{0.770502925f, 0.481878757f},
-std::array<float,2>{0.437842041f, 0.247850657f},
-std::array<float,2>{0.516937256f, 0.84305644f},
-std::array<float,2>{0.341620386f, 0.921420693f},
-std::array<float,2>{0.716268182f, 0.00591308065f},
-std::array<float,2>{0.151371896f, 0.344274908f},
-std::array<float,2>{0.971343338f, 0.541508675f},
-std::array<float,2>{0.0570117421f, 0.820780993f},
-std::array<float,2>{0.804214358f, 0.224457696f},
-std::array<float,2>{0.492152125f, 0.48857978f},
-std::array<float,2>{0.540182173f, 0.643859863f},
-std::array<float,2>{0.353727043f, 0.553231061f},
-std::array<float,2>{0.735187948f, 0.362845808f},
-std::array<float,2>{0.183690354f, 0.0236387737f},
-std::array<float,2>{0.953698099f, 0.922490716f},
-std::array<float,2>{0.222588301f, 0.738271892f},
-std::array<float,2>{0.918257594f, 0.424925387f},
-std::array<float,2>{0.271110028f, 0.149363369f},
-std::array<float,2>{0.658477545f, 0.762879193f},
-std::array<float,2>{0.399059832f, 0.998970032f},
-std::array<float,2>{0.586862504f, 0.0956901833f},
-std::array<float,2>{0.0779062212f, 0.285419077f},
-std::array<float,2>{0.864753664f, 0.61186856f},
-std::array<float,2>{0.133561179f, 0.902318597f},
-std::array<float,2>{0.985143125f, 0.060883943f},
-std::array<float,2>{0.315055579f, 0.340497851f},
-std::array<float,2>{0.691313744f, 0.506254315f},
-std::array<float,2>{0.457140028f, 0.662320077f},
-std::array<float,2>{0.500693023f, 0.460927814f},
-std::array<float,2>{0.00665179873f, 0.203604102f},
-std::array<float,2>{0.756986797f, 0.867567658f},
-std::array<float,2>{0.095008783f, 0.575827062f},
-std::array<float,2>{0.833703279f, 0.27113387f},
-std::array<float,2>{0.422130883f, 0.0741434246f},
-std::array<float,2>{0.599536479f, 0.943177938f},
-std::array<float,2>{0.295355588f, 0.796338141f},
-std::array<float,2>{0.650642097f, 0.179067045f},
-std::array<float,2>{0.211266503f, 0.393886715f},
-std::array<float,2>{0.896267295f, 0.695659161f},
-std::array<float,2>{0.102282546f, 0.876556873f},
-std::array<float,2>{0.841792226f, 0.0432146005f},
-std::array<float,2>{0.434686244f, 0.326481432f},
-std::array<float,2>{0.604312599f, 0.529700398f},
-std::array<float,2>{0.283707917f, 0.684315622f},
-std::array<float,2>{0.64514488f, 0.442969233f},
-std::array<float,2>{0.210009515f, 0.193163902f},
-std::array<float,2>{0.900603533f, 0.858747542f},
-std::array<float,2>{0.127868861f, 0.579809666f},
-std::array<float,2>{0.996157527f, 0.26111868f},
-std::array<float,2>{0.328011274f, 0.0831549168f},
-std::array<float,2>{0.700320601f, 0.95933497f},
-std::array<float,2>{0.463524759f, 0.811940253f},
-std::array<float,2>{0.50825572f, 0.160400838f},
-std::array<float,2>{0.0092118457f, 0.387541801f},
-std::array<float,2>{0.762607753f, 0.704782307f},
-std::array<float,2>{0.229803339f, 0.83596611f},
-std::array<float,2>{0.912887335f, 0.245282441f},
-std::array<float,2>{0.280342281f, 0.478891253f},
-std::array<float,2>{0.667834282f, 0.626793683f},
-std::array<float,2>{0.391592085f, 0.546683788f},
-std::array<float,2>{0.585171461f, 0.348851383f},
-std::array<float,2>{0.0641153678f, 0.00294777239f},
-std::array<float,2>{0.869767666f, 0.916417181f},
-std::array<float,2>{0.0540766083f, 0.7338835f},
-std::array<float,2>{0.806411684f, 0.420679659f},
-std::array<float,2>{0.49501282f, 0.138614923f},
-std::array<float,2>{0.532105446f, 0.777560472f},
-std::array<float,2>{0.347246617f, 0.97139132f},
-std::array<float,2>{0.742387533f, 0.115058288f},
-std::array<float,2>{0.177095458f, 0.30780679f},
-std::array<float,2>{0.964702964f, 0.597869754f},
-std::array<float,2>{0.0206273869f, 0.761194825f},
-std::array<float,2>{0.775368989f, 0.155681372f},
-std::array<float,2>{0.445402324f, 0.426173002f},
-std::array<float,2>{0.523820996f, 0.740879297f},
-std::array<float,2>{0.329760581f, 0.616221368f},
-std::array<float,2>{0.709204614f, 0.283026546f},
-std::array<float,2>{0.145777225f, 0.0991068035f},
-std::array<float,2>{0.983187139f, 0.992878854f},
-std::array<float,2>{0.202627391f, 0.645036757f},
-std::array<float,2>{0.881043136f, 0.486486882f},
-std::array<float,2>{0.302373052f, 0.219784215f},
-std::array<float,2>{0.626412511f, 0.827248752f},
-std::array<float,2>{0.412162542f, 0.927518249f},
-std::array<float,2>{0.619398952f, 0.0280794613f},
-std::array<float,2>{0.110544868f, 0.366024494f},
-std::array<float,2>{0.817849517f, 0.549763918f},
-std::array<float,2>{0.167310998f, 0.939157128f},
-std::array<float,2>{0.945913732f, 0.0771312565f},
-std::array<float,2>{0.369845748f, 0.268923104f},
-std::array<float,2>{0.733012617f, 0.573800087f},
-std::array<float,2>{0.477953166f, 0.703072548f},
-std::array<float,2>{0.552624166f, 0.396957934f},
-std::array<float,2>{0.0364048518f, 0.173395216f},
-std::array<float,2>{0.78334558f, 0.792942703f},
-std::array<float,2>{0.0891912058f, 0.503126144f},
-std::array<float,2>{0.857242763f, 0.337272733f},
-std::array<float,2>{0.381429434f, 0.055237893f},
-std::array<float,2>{0.577692449f, 0.905003846f},
-std::array<float,2>{0.256261408f, 0.871246397f},
-std::array<float,2>{0.673371434f, 0.208454609f},
-std::array<float,2>{0.24402684f, 0.455645323f},
-std::array<float,2>{0.925990164f, 0.658569038f},
-std::array<float,2>{0.0409618691f, 0.988354743f},
-std::array<float,2>{0.789172292f, 0.103061557f},
-std::array<float,2>{0.47107026f, 0.291764766f},
-std::array<float,2>{0.560472488f, 0.623378158f},
-std::array<float,2>{0.360685498f, 0.74881351f},
-std::array<float,2>{0.721719325f, 0.433255047f},
-std::array<float,2>{0.157769993f, 0.145282567f},
-std::array<float,2>{0.941892862f, 0.752253473f},
-std::array<float,2>{0.238041639f, 0.557744086f},
-std::array<float,2>{0.937178254f, 0.3672418f},
-std::array<float,2>{0.263563305f, 0.0208520275f},
-std::array<float,2>{0.679835021f, 0.932892859f},
-std::array<float,2>{0.389080971f, 0.813804448f},
-std::array<float,2>{0.563527644f, 0.227430001f},
-std::array<float,2>{0.0840014294f, 0.493247092f},
-std::array<float,2>{0.847436905f, 0.651856899f},
-std::array<float,2>{0.152407303f, 0.784675896f},
-std::array<float,2>{0.975081205f, 0.184174493f},
-std::array<float,2>{0.335941672f, 0.403064013f},
-std::array<float,2>{0.712309897f, 0.688092947f},
-std::array<float,2>{0.443334788f, 0.562904596f},
-std::array<float,2>{0.520411849f, 0.280151337f},
-std::array<float,2>{0.0238118526f, 0.0631037652f},
-std::array<float,2>{0.767183065f, 0.945648611f},
-std::array<float,2>{0.124112099f, 0.667042911f},
-std::array<float,2>{0.82664454f, 0.463974506f},
-std::array<float,2>{0.414109588f, 0.211307526f},
-std::array<float,2>{0.612942219f, 0.86037153f},
-std::array<float,2>{0.310625941f, 0.895569682f},
-std::array<float,2>{0.640616f, 0.0507987365f},
-std::array<float,2>{0.188265562f, 0.335927904f},
-std::array<float,2>{0.884296954f, 0.513971388f},
-std::array<float,2>{0.0703534111f, 0.847520947f},
-std::array<float,2>{0.860624254f, 0.196515083f},
-std::array<float,2>{0.405390888f, 0.451934993f},
-std::array<float,2>{0.592294812f, 0.677346349f},
-std::array<float,2>{0.26623717f, 0.52074331f},
-std::array<float,2>{0.663127542f, 0.315545678f},
-std::array<float,2>{0.22391133f, 0.0381437838f},
-std::array<float,2>{0.917752087f, 0.885672152f},
-std::array<float,2>{0.183284834f, 0.718645751f},
-std::array<float,2>{0.959546328f, 0.378381103f},
-std::array<float,2>{0.356702238f, 0.171237007f},
-std::array<float,2>{0.738688052f, 0.804471791f},
-std::array<float,2>{0.485720426f, 0.966987491f},
-std::array<float,2>{0.543432534f, 0.0878312513f},
-std::array<float,2>{0.0604214892f, 0.251035392f},
-std::array<float,2>{0.796912551f, 0.589237809f},
-std::array<float,2>{0.217003316f, 0.913896263f},
-std::array<float,2>{0.89387393f, 0.00861889124f},
-std::array<float,2>{0.289136678f, 0.35901019f},
-std::array<float,2>{0.654168308f, 0.53465575f},
-std::array<float,2>{0.425841212f, 0.635013461f},
-std::array<float,2>{0.59736681f, 0.475107551f},
-std::array<float,2>{0.0991113111f, 0.241978586f},
-std::array<float,2>{0.830907404f, 0.835796177f},
-std::array<float,2>{0.00286183693f, 0.604388535f},
-std::array<float,2>{0.752141356f, 0.297809184f},
-std::array<float,2>{0.454250067f, 0.119731285f},
-std::array<float,2>{0.504488587f, 0.98376286f},
-std::array<float,2>{0.3179093f, 0.768196583f},
-std::array<float,2>{0.695025325f, 0.128443047f},
-std::array<float,2>{0.137351349f, 0.407960296f},
-std::array<float,2>{0.991549551f, 0.725648522f},
-std::array<float,2>{0.0486855507f, 0.893269181f},
-std::array<float,2>{0.809600413f, 0.0499432757f},
-std::array<float,2>{0.498671263f, 0.328671485f},
-std::array<float,2>{0.536580265f, 0.510109127f},
-std::array<float,2>{0.35029915f, 0.670615315f},
-std::array<float,2>{0.747090518f, 0.466940701f},
-std::array<float,2>{0.173370153f, 0.215484247f},
-std::array<float,2>{0.966622949f, 0.866003633f},
-std::array<float,2>{0.234294385f, 0.568428576f},
-std::array<float,2>{0.906729102f, 0.276761889f},
-std::array<float,2>{0.27465108f, 0.0694791451f},
-std::array<float,2>{0.668287039f, 0.950890481f},
-std::array<float,2>{0.39484936f, 0.785654128f},
-std::array<float,2>{0.57918328f, 0.180275217f},
-std::array<float,2>{0.0702339634f, 0.398462117f},
-std::array<float,2>{0.872881234f, 0.692160368f},
-std::array<float,2>{0.130699351f, 0.819318473f},
-std::array<float,2>{0.99582088f, 0.233516037f},
-std::array<float,2>{0.321096122f, 0.497609198f},
-std::array<float,2>{0.696634352f, 0.655685246f},
-std::array<float,2>{0.465622783f, 0.561747849f},
-std::array<float,2>{0.51268065f, 0.372302502f},
-std::array<float,2>{0.0132247331f, 0.019274272f},
-std::array<float,2>{0.76168412f, 0.93616569f},
-std::array<float,2>{0.107810415f, 0.744582832f},
-std::array<float,2>{0.839840531f, 0.435845524f},
-std::array<float,2>{0.430858403f, 0.14098455f},
-std::array<float,2>{0.60872674f, 0.755711913f},
-std::array<float,2>{0.288684487f, 0.987389088f},
-std::array<float,2>{0.643871248f, 0.10586331f},
-std::array<float,2>{0.205111131f, 0.294539958f},
-std::array<float,2>{0.905976057f, 0.620992362f},
-std::array<float,2>{0.0937244073f, 0.771315753f},
-std::array<float,2>{0.85167557f, 0.131326869f},
-std::array<float,2>{0.375902832f, 0.413042396f},
-std::array<float,2>{0.574176311f, 0.720914185f},
-std::array<float,2>{0.251714706f, 0.609370589f},
-std::array<float,2>{0.679471016f, 0.303169519f},
-std::array<float,2>{0.247658238f, 0.122769117f},
-std::array<float,2>{0.922662199f, 0.978194773f},
-std::array<float,2>{0.169229165f, 0.638079107f},
-std::array<float,2>{0.950297177f, 0.47102955f},
-std::array<float,2>{0.373760074f, 0.234428316f},
-std::array<float,2>{0.726702631f, 0.83157593f},
-std::array<float,2>{0.483684421f, 0.907492936f},
-std::array<float,2>{0.549561739f, 0.0136509156f},
-std::array<float,2>{0.0345985219f, 0.352815092f},
-std::array<float,2>{0.786092043f, 0.53678292f},
-std::array<float,2>{0.198610768f, 0.961782992f},
-std::array<float,2>{0.876818895f, 0.0912174433f},
-std::array<float,2>{0.299922824f, 0.25462386f},
-std::array<float,2>{0.63114953f, 0.591492474f},
-std::array<float,2>{0.406737834f, 0.711198032f},
-std::array<float,2>{0.623275995f, 0.380867273f},
-std::array<float,2>{0.115527965f, 0.165329412f},
-std::array<float,2>{0.813628435f, 0.798622608f},
-std::array<float,2>{0.0170004517f, 0.516983151f},
-std::array<float,2>{0.779026985f, 0.320249289f},
-std::array<float,2>{0.450463116f, 0.0348699056f},
-std::array<float,2>{0.528520465f, 0.886881769f},
-std::array<float,2>{0.335039854f, 0.851199985f},
-std::array<float,2>{0.703917146f, 0.202150881f},
-std::array<float,2>{0.14062871f, 0.445831448f},
-std::array<float,2>{0.979583561f, 0.672500491f},
-std::array<float,2>{0.120125778f, 0.97656244f},
-std::array<float,2>{0.823557377f, 0.113129213f},
-std::array<float,2>{0.418741256f, 0.312423348f},
-std::array<float,2>{0.616402686f, 0.595553219f},
-std::array<float,2>{0.306644082f, 0.727631688f},
-std::array<float,2>{0.636583567f, 0.415547431f},
-std::array<float,2>{0.195141375f, 0.136278734f},
-std::array<float,2>{0.888147056f, 0.775983691f},
-std::array<float,2>{0.14914465f, 0.540439427f},
-std::array<float,2>{0.96904397f, 0.346336961f},
-std::array<float,2>{0.341893911f, 0.00452561909f},
-std::array<float,2>{0.717627585f, 0.918601573f},
-std::array<float,2>{0.439886928f, 0.841151118f},
-std::array<float,2>{0.51763016f, 0.249882311f},
-std::array<float,2>{0.0304414127f, 0.48295331f},
-std::array<float,2>{0.772255242f, 0.629707694f},
-std::array<float,2>{0.240286201f, 0.805056274f},
-std::array<float,2>{0.929808497f, 0.15976347f},
-std::array<float,2>{0.260208368f, 0.383755833f},
-std::array<float,2>{0.684691012f, 0.710875213f},
-std::array<float,2>{0.383516252f, 0.583627045f},
-std::array<float,2>{0.567961156f, 0.262230843f},
-std::array<float,2>{0.0807346329f, 0.0803642273f},
-std::array<float,2>{0.850929558f, 0.953928709f},
-std::array<float,2>{0.043366123f, 0.683399737f},
-std::array<float,2>{0.793111444f, 0.440510988f},
-std::array<float,2>{0.473181456f, 0.190716192f},
-std::array<float,2>{0.556466162f, 0.853694022f},
-std::array<float,2>{0.364602506f, 0.88149029f},
-std::array<float,2>{0.722756267f, 0.0402202792f},
-std::array<float,2>{0.160290658f, 0.323764682f},
-std::array<float,2>{0.940335095f, 0.52721715f},
-std::array<float,2>{0.00455815298f, 0.869683683f},
-std::array<float,2>{0.754042745f, 0.205287755f},
-std::array<float,2>{0.460078448f, 0.458631128f},
-std::array<float,2>{0.503276706f, 0.661592245f},
-std::array<float,2>{0.313526332f, 0.504550338f},
-std::array<float,2>{0.689403653f, 0.343234867f},
-std::array<float,2>{0.136077553f, 0.0603662394f},
-std::array<float,2>{0.988126159f, 0.899416864f},
-std::array<float,2>{0.213272437f, 0.698740244f},
-std::array<float,2>{0.89796406f, 0.391020387f},
-std::array<float,2>{0.294319838f, 0.177653819f},
-std::array<float,2>{0.649294198f, 0.79439038f},
-std::array<float,2>{0.424619973f, 0.944429755f},
-std::array<float,2>{0.600984454f, 0.071322009f},
-std::array<float,2>{0.0965856984f, 0.273062378f},
-std::array<float,2>{0.834084868f, 0.576459408f},
-std::array<float,2>{0.186794326f, 0.925082147f},
-std::array<float,2>{0.95676887f, 0.0269504711f},
-std::array<float,2>{0.352507412f, 0.359806389f},
-std::array<float,2>{0.736335874f, 0.552580953f},
-std::array<float,2>{0.489941299f, 0.641603172f},
-std::array<float,2>{0.541666567f, 0.490640759f},
-std::array<float,2>{0.0561549179f, 0.226368815f},
-std::array<float,2>{0.801242471f, 0.822867513f},
-std::array<float,2>{0.0743957087f, 0.610260129f},
-std::array<float,2>{0.866832316f, 0.287786841f},
-std::array<float,2>{0.400627136f, 0.0970039889f},
-std::array<float,2>{0.588375926f, 0.996596813f},
-std::array<float,2>{0.272972226f, 0.763744295f},
-std::array<float,2>{0.656454444f, 0.150408283f},
-std::array<float,2>{0.219038993f, 0.423180699f},
-std::array<float,2>{0.920015633f, 0.735640049f},
-std::array<float,2>{0.0651797056f, 0.914405525f},
-std::array<float,2>{0.867750883f, 0.000230709615f},
-std::array<float,2>{0.393435329f, 0.350203753f},
-std::array<float,2>{0.582111061f, 0.544299304f},
-std::array<float,2>{0.279095501f, 0.627578974f},
-std::array<float,2>{0.665608168f, 0.476823419f},
-std::array<float,2>{0.226797029f, 0.243323252f},
-std::array<float,2>{0.911278248f, 0.839272022f},
-std::array<float,2>{0.178094715f, 0.601158798f},
-std::array<float,2>{0.962190032f, 0.306281358f},
-std::array<float,2>{0.344639421f, 0.115928821f},
-std::array<float,2>{0.744490683f, 0.970694423f},
-std::array<float,2>{0.493582159f, 0.779556215f},
-std::array<float,2>{0.53447777f, 0.139655888f},
-std::array<float,2>{0.0523171127f, 0.418575317f},
-std::array<float,2>{0.808172047f, 0.731614351f},
-std::array<float,2>{0.207137004f, 0.85571605f},
-std::array<float,2>{0.8998124f, 0.195277616f},
-std::array<float,2>{0.282588273f, 0.444802403f},
-std::array<float,2>{0.647181094f, 0.686227977f},
-std::array<float,2>{0.435809135f, 0.52893585f},
-std::array<float,2>{0.602523208f, 0.32452178f},
-std::array<float,2>{0.105377972f, 0.0451007076f},
-std::array<float,2>{0.843032598f, 0.878823996f},
-std::array<float,2>{0.0104504889f, 0.706765115f},
-std::array<float,2>{0.763912082f, 0.388952583f},
-std::array<float,2>{0.462268978f, 0.163256094f},
-std::array<float,2>{0.511463165f, 0.809747815f},
-std::array<float,2>{0.324409664f, 0.958155513f},
-std::array<float,2>{0.702280104f, 0.0852373913f},
-std::array<float,2>{0.126171991f, 0.258254379f},
-std::array<float,2>{0.998665631f, 0.581477284f},
-std::array<float,2>{0.0386879891f, 0.789773941f},
-std::array<float,2>{0.78249532f, 0.174879566f},
-std::array<float,2>{0.480217427f, 0.395417303f},
-std::array<float,2>{0.554599106f, 0.700802386f},
-std::array<float,2>{0.369127452f, 0.572228074f},
-std::array<float,2>{0.731797338f, 0.265856832f},
-std::array<float,2>{0.164959058f, 0.075342834f},
-std::array<float,2>{0.948622644f, 0.940731347f},
-std::array<float,2>{0.245852917f, 0.658126891f},
-std::array<float,2>{0.929180741f, 0.454346359f},
-std::array<float,2>{0.254403532f, 0.209401652f},
-std::array<float,2>{0.67510581f, 0.874178886f},
-std::array<float,2>{0.380795747f, 0.90283066f},
-std::array<float,2>{0.575932622f, 0.0585806444f},
-std::array<float,2>{0.0873324722f, 0.337992638f},
-std::array<float,2>{0.858727038f, 0.500847578f},
-std::array<float,2>{0.147970438f, 0.994866014f},
-std::array<float,2>{0.981186569f, 0.100789152f},
-std::array<float,2>{0.33197087f, 0.28447634f},
-std::array<float,2>{0.707429409f, 0.614689589f},
-std::array<float,2>{0.449030876f, 0.738624752f},
-std::array<float,2>{0.526614845f, 0.429045469f},
-std::array<float,2>{0.0216617901f, 0.153804421f},
-std::array<float,2>{0.777121961f, 0.75940448f},
-std::array<float,2>{0.112871081f, 0.547789395f},
-std::array<float,2>{0.819776595f, 0.363993138f},
-std::array<float,2>{0.411385775f, 0.0306165535f},
-std::array<float,2>{0.618648648f, 0.928493619f},
-std::array<float,2>{0.303750575f, 0.825096667f},
-std::array<float,2>{0.627255797f, 0.220993817f},
-std::array<float,2>{0.19981426f, 0.48522374f},
-std::array<float,2>{0.880128145f, 0.647064447f},
-std::array<float,2>{0.0269132387f, 0.948593795f},
-std::array<float,2>{0.768159032f, 0.0647034794f},
-std::array<float,2>{0.444831938f, 0.278151721f},
-std::array<float,2>{0.521601856f, 0.564483225f},
-std::array<float,2>{0.339090437f, 0.689553618f},
-std::array<float,2>{0.713054597f, 0.404870212f},
-std::array<float,2>{0.155559674f, 0.186542183f},
-std::array<float,2>{0.973042667f, 0.782489538f},
-std::array<float,2>{0.190837458f, 0.513276458f},
-std::array<float,2>{0.886445284f, 0.332242489f},
-std::array<float,2>{0.310125798f, 0.0532822423f},
-std::array<float,2>{0.637716532f, 0.896875083f},
-std::array<float,2>{0.417942166f, 0.863111138f},
-std::array<float,2>{0.609805107f, 0.214228243f},
-std::array<float,2>{0.123036824f, 0.462412655f},
-std::array<float,2>{0.825000226f, 0.665010631f},
-std::array<float,2>{0.159843147f, 0.751221955f},
-std::array<float,2>{0.944496691f, 0.146713138f},
-std::array<float,2>{0.36219722f, 0.431499541f},
-std::array<float,2>{0.720657587f, 0.746984065f},
-std::array<float,2>{0.470131367f, 0.621553779f},
-std::array<float,2>{0.560933292f, 0.289282233f},
-std::array<float,2>{0.0410413444f, 0.103732385f},
-std::array<float,2>{0.792282224f, 0.990499675f},
-std::array<float,2>{0.0821952075f, 0.648746073f},
-std::array<float,2>{0.844820321f, 0.495797694f},
-std::array<float,2>{0.388332576f, 0.230260059f},
-std::array<float,2>{0.565959156f, 0.815358281f},
-std::array<float,2>{0.26505211f, 0.931624115f},
-std::array<float,2>{0.682491004f, 0.0217580087f},
-std::array<float,2>{0.235984206f, 0.369377375f},
-std::array<float,2>{0.934913516f, 0.556541562f},
-std::array<float,2>{0.100702472f, 0.832346201f},
-std::array<float,2>{0.828239083f, 0.238553479f},
-std::array<float,2>{0.428392261f, 0.473830789f},
-std::array<float,2>{0.595575213f, 0.634295344f},
-std::array<float,2>{0.292639256f, 0.531993449f},
-std::array<float,2>{0.654756725f, 0.355672657f},
-std::array<float,2>{0.21562092f, 0.010439069f},
-std::array<float,2>{0.891687274f, 0.910331368f},
-std::array<float,2>{0.140410915f, 0.723847508f},
-std::array<float,2>{0.989839613f, 0.409704149f},
-std::array<float,2>{0.319854856f, 0.125704721f},
-std::array<float,2>{0.692370415f, 0.766925633f},
-std::array<float,2>{0.455746442f, 0.98163712f},
-std::array<float,2>{0.50700593f, 0.117745154f},
-std::array<float,2>{0.00156265532f, 0.299658358f},
-std::array<float,2>{0.750202894f, 0.601804733f},
-std::array<float,2>{0.22627531f, 0.884342849f},
-std::array<float,2>{0.915199876f, 0.036042843f},
-std::array<float,2>{0.267585546f, 0.313763976f},
-std::array<float,2>{0.661722958f, 0.521796346f},
-std::array<float,2>{0.403487504f, 0.678385615f},
-std::array<float,2>{0.591697931f, 0.449877173f},
-std::array<float,2>{0.0741251484f, 0.198559687f},
-std::array<float,2>{0.861550093f, 0.844789684f},
-std::array<float,2>{0.0620250553f, 0.586037457f},
-std::array<float,2>{0.799261808f, 0.252741814f},
-std::array<float,2>{0.487515032f, 0.0882041007f},
-std::array<float,2>{0.545371115f, 0.966044128f},
-std::array<float,2>{0.359272122f, 0.800954163f},
-std::array<float,2>{0.74189502f, 0.168741107f},
-std::array<float,2>{0.180577517f, 0.37638396f},
-std::array<float,2>{0.957100987f, 0.715444446f},
-std::array<float,2>{0.0188333355f, 0.887936771f},
-std::array<float,2>{0.780483127f, 0.0339386128f},
-std::array<float,2>{0.452356428f, 0.318494707f},
-std::array<float,2>{0.529494822f, 0.516226947f},
-std::array<float,2>{0.332561553f, 0.673348904f},
-std::array<float,2>{0.706336021f, 0.44699803f},
-std::array<float,2>{0.144172996f, 0.201821432f},
-std::array<float,2>{0.978006005f, 0.849949598f},
-std::array<float,2>{0.197040305f, 0.589858413f},
-std::array<float,2>{0.877564847f, 0.255090415f},
-std::array<float,2>{0.298529983f, 0.0902430564f},
-std::array<float,2>{0.630092323f, 0.96249181f},
-std::array<float,2>{0.409709245f, 0.797452569f},
-std::array<float,2>{0.622681379f, 0.164882794f},
-std::array<float,2>{0.115149923f, 0.382255673f},
-std::array<float,2>{0.81544888f, 0.712185204f},
-std::array<float,2>{0.170106813f, 0.830197155f},
-std::array<float,2>{0.951345861f, 0.236134633f},
-std::array<float,2>{0.372537255f, 0.472174853f},
-std::array<float,2>{0.730448484f, 0.636821985f},
-std::array<float,2>{0.481517076f, 0.536062479f},
-std::array<float,2>{0.547475219f, 0.352197409f},
-std::array<float,2>{0.0330031812f, 0.0121914959f},
-std::array<float,2>{0.787675977f, 0.906591237f},
-std::array<float,2>{0.0899714977f, 0.722310781f},
-std::array<float,2>{0.855428576f, 0.413320839f},
-std::array<float,2>{0.378475398f, 0.132506728f},
-std::array<float,2>{0.571795702f, 0.770359516f},
-std::array<float,2>{0.2528207f, 0.976768076f},
-std::array<float,2>{0.676418483f, 0.121698953f},
-std::array<float,2>{0.248602226f, 0.303905517f},
-std::array<float,2>{0.925257146f, 0.608377278f},
-std::array<float,2>{0.107152991f, 0.753941f},
-std::array<float,2>{0.836965084f, 0.141982749f},
-std::array<float,2>{0.431714982f, 0.437219113f},
-std::array<float,2>{0.606419027f, 0.745168149f},
-std::array<float,2>{0.285517633f, 0.619659066f},
-std::array<float,2>{0.641100526f, 0.293684959f},
-std::array<float,2>{0.20466049f, 0.107371733f},
-std::array<float,2>{0.90293014f, 0.986449242f},
-std::array<float,2>{0.132066205f, 0.655042291f},
-std::array<float,2>{0.994058788f, 0.496949673f},
-std::array<float,2>{0.323668659f, 0.232822433f},
-std::array<float,2>{0.698983431f, 0.819936752f},
-std::array<float,2>{0.468215168f, 0.936924517f},
-std::array<float,2>{0.51386714f, 0.0180352721f},
-std::array<float,2>{0.014426087f, 0.371632874f},
-std::array<float,2>{0.759664357f, 0.561160386f},
-std::array<float,2>{0.231575832f, 0.95013231f},
-std::array<float,2>{0.910149515f, 0.0690944642f},
-std::array<float,2>{0.276962787f, 0.27562964f},
-std::array<float,2>{0.670793295f, 0.570006669f},
-std::array<float,2>{0.397387207f, 0.692654192f},
-std::array<float,2>{0.581970394f, 0.399927825f},
-std::array<float,2>{0.0666405112f, 0.180729985f},
-std::array<float,2>{0.873812199f, 0.786536336f},
-std::array<float,2>{0.0500358082f, 0.511557162f},
-std::array<float,2>{0.81093061f, 0.330059856f},
-std::array<float,2>{0.497024268f, 0.0492517389f},
-std::array<float,2>{0.538008392f, 0.894160926f},
-std::array<float,2>{0.348595411f, 0.866547465f},
-std::array<float,2>{0.748931229f, 0.216726795f},
-std::array<float,2>{0.173881352f, 0.468075454f},
-std::array<float,2>{0.967879355f, 0.671852827f},
-std::array<float,2>{0.0771211237f, 0.997653008f},
-std::array<float,2>{0.86348027f, 0.0957862064f},
-std::array<float,2>{0.400141984f, 0.288680583f},
-std::array<float,2>{0.587409735f, 0.611284018f},
-std::array<float,2>{0.27047199f, 0.734437466f},
-std::array<float,2>{0.659950376f, 0.421964496f},
-std::array<float,2>{0.220981181f, 0.151820898f},
-std::array<float,2>{0.91960901f, 0.764807522f},
-std::array<float,2>{0.185490534f, 0.551123798f},
-std::array<float,2>{0.954217911f, 0.361046433f},
-std::array<float,2>{0.355307937f, 0.0255707093f},
-std::array<float,2>{0.735923767f, 0.924502909f},
-std::array<float,2>{0.491078287f, 0.823896348f},
-std::array<float,2>{0.539618611f, 0.225071102f},
-std::array<float,2>{0.0576783903f, 0.491651833f},
-std::array<float,2>{0.803248584f, 0.641432464f},
-std::array<float,2>{0.212276906f, 0.793030322f},
-std::array<float,2>{0.894637287f, 0.176146328f},
-std::array<float,2>{0.295939982f, 0.391853541f},
-std::array<float,2>{0.651800275f, 0.697626829f},
-std::array<float,2>{0.423100382f, 0.577275872f},
-std::array<float,2>{0.5977633f, 0.271874785f},
-std::array<float,2>{0.0938015431f, 0.0707328171f},
-std::array<float,2>{0.832812846f, 0.944125235f},
-std::array<float,2>{0.0072380784f, 0.660594285f},
-std::array<float,2>{0.756382585f, 0.457987487f},
-std::array<float,2>{0.458100259f, 0.206132814f},
-std::array<float,2>{0.501676083f, 0.870655f},
-std::array<float,2>{0.316104293f, 0.898721874f},
-std::array<float,2>{0.689866722f, 0.0587284081f},
-std::array<float,2>{0.134076148f, 0.342429101f},
-std::array<float,2>{0.98628062f, 0.505326986f},
-std::array<float,2>{0.0464904867f, 0.855052173f},
-std::array<float,2>{0.796349347f, 0.190140978f},
-std::array<float,2>{0.474822074f, 0.440266103f},
-std::array<float,2>{0.557671547f, 0.681949019f},
-std::array<float,2>{0.366175801f, 0.526169479f},
-std::array<float,2>{0.72587657f, 0.322970062f},
-std::array<float,2>{0.163049921f, 0.0397833921f},
-std::array<float,2>{0.939391911f, 0.882793069f},
-std::array<float,2>{0.239923254f, 0.709634125f},
-std::array<float,2>{0.933323979f, 0.384350866f},
-std::array<float,2>{0.259246856f, 0.158423141f},
-std::array<float,2>{0.686935246f, 0.806173265f},
-std::array<float,2>{0.386447787f, 0.954831421f},
-std::array<float,2>{0.569994748f, 0.0813590512f},
-std::array<float,2>{0.0790188015f, 0.263473928f},
-std::array<float,2>{0.848811507f, 0.582862556f},
-std::array<float,2>{0.15113838f, 0.919001341f},
-std::array<float,2>{0.972455084f, 0.00508107757f},
-std::array<float,2>{0.34050256f, 0.347065181f},
-std::array<float,2>{0.715054393f, 0.539972544f},
-std::array<float,2>{0.438486785f, 0.630338669f},
-std::array<float,2>{0.515909791f, 0.483433694f},
-std::array<float,2>{0.0279216059f, 0.248906463f},
-std::array<float,2>{0.771181285f, 0.84072727f},
-std::array<float,2>{0.118388809f, 0.59433192f},
-std::array<float,2>{0.820707381f, 0.310595453f},
-std::array<float,2>{0.42022419f, 0.111370973f},
-std::array<float,2>{0.613624752f, 0.975016236f},
-std::array<float,2>{0.306301743f, 0.777202606f},
-std::array<float,2>{0.633718967f, 0.135028407f},
-std::array<float,2>{0.193305343f, 0.415034622f},
-std::array<float,2>{0.889574051f, 0.727466166f},
-std::array<float,2>{0.110264711f, 0.929561317f},
-std::array<float,2>{0.817190886f, 0.0294818096f},
-std::array<float,2>{0.413150579f, 0.364411533f},
-std::array<float,2>{0.621035278f, 0.548388541f},
-std::array<float,2>{0.30116722f, 0.647550106f},
-std::array<float,2>{0.625686944f, 0.485748231f},
-std::array<float,2>{0.201821432f, 0.2216921f},
-std::array<float,2>{0.882727623f, 0.825696886f},
-std::array<float,2>{0.145320937f, 0.614121199f},
-std::array<float,2>{0.984299779f, 0.283428192f},
-std::array<float,2>{0.328951806f, 0.100302704f},
-std::array<float,2>{0.710145354f, 0.995313108f},
-std::array<float,2>{0.446952194f, 0.75792408f},
-std::array<float,2>{0.524562836f, 0.153249055f},
-std::array<float,2>{0.0197664332f, 0.42829603f},
-std::array<float,2>{0.773668349f, 0.73974359f},
-std::array<float,2>{0.242473379f, 0.873876452f},
-std::array<float,2>{0.927504778f, 0.210498199f},
-std::array<float,2>{0.257434368f, 0.454030305f},
-std::array<float,2>{0.672101736f, 0.65651083f},
-std::array<float,2>{0.382587224f, 0.501190186f},
-std::array<float,2>{0.576336801f, 0.339662105f},
-std::array<float,2>{0.0884478241f, 0.057482373f},
-std::array<float,2>{0.855782986f, 0.903698027f},
-std::array<float,2>{0.0359695256f, 0.69988668f},
-std::array<float,2>{0.785150051f, 0.395571262f},
-std::array<float,2>{0.476583093f, 0.174485087f},
-std::array<float,2>{0.551441431f, 0.790569305f},
-std::array<float,2>{0.370771766f, 0.940186024f},
-std::array<float,2>{0.73394388f, 0.0744704008f},
-std::array<float,2>{0.166771978f, 0.266991049f},
-std::array<float,2>{0.946314275f, 0.570825279f},
-std::array<float,2>{0.00789920706f, 0.808985233f},
-std::array<float,2>{0.762761354f, 0.162715301f},
-std::array<float,2>{0.46400103f, 0.390496343f},
-std::array<float,2>{0.509082377f, 0.705762625f},
-std::array<float,2>{0.326179326f, 0.581039667f},
-std::array<float,2>{0.699698865f, 0.259471357f},
-std::array<float,2>{0.128905177f, 0.0846831203f},
-std::array<float,2>{0.997719765f, 0.957500935f},
-std::array<float,2>{0.209782273f, 0.687046289f},
-std::array<float,2>{0.901700616f, 0.443954557f},
-std::array<float,2>{0.28476882f, 0.194282815f},
-std::array<float,2>{0.646215916f, 0.857305586f},
-std::array<float,2>{0.433617771f, 0.877417207f},
-std::array<float,2>{0.605069816f, 0.0461744852f},
-std::array<float,2>{0.103005007f, 0.325425416f},
-std::array<float,2>{0.840009212f, 0.527513444f},
-std::array<float,2>{0.176087394f, 0.969051123f},
-std::array<float,2>{0.962970674f, 0.117124811f},
-std::array<float,2>{0.345889866f, 0.30526039f},
-std::array<float,2>{0.744130373f, 0.599632442f},
-std::array<float,2>{0.495578378f, 0.731428146f},
-std::array<float,2>{0.533201158f, 0.419781238f},
-std::array<float,2>{0.0535588264f, 0.138780266f},
-std::array<float,2>{0.805492997f, 0.780677497f},
-std::array<float,2>{0.0634105578f, 0.543711662f},
-std::array<float,2>{0.870572448f, 0.351545066f},
-std::array<float,2>{0.391684055f, 0.00141430192f},
-std::array<float,2>{0.584577322f, 0.915826559f},
-std::array<float,2>{0.279672265f, 0.838387012f},
-std::array<float,2>{0.666682839f, 0.242968902f},
-std::array<float,2>{0.22875233f, 0.478275537f},
-std::array<float,2>{0.91402185f, 0.628685176f},
-std::array<float,2>{0.0595339164f, 0.964888632f},
-std::array<float,2>{0.79854995f, 0.0893905535f},
-std::array<float,2>{0.484537482f, 0.252961725f},
-std::array<float,2>{0.544791758f, 0.587654412f},
-std::array<float,2>{0.356284976f, 0.716783226f},
-std::array<float,2>{0.739750564f, 0.375694275f},
-std::array<float,2>{0.182368919f, 0.16984722f},
-std::array<float,2>{0.960340977f, 0.802572548f},
-std::array<float,2>{0.223112166f, 0.522944748f},
-std::array<float,2>{0.916683495f, 0.313031197f},
-std::array<float,2>{0.26720646f, 0.0363640152f},
-std::array<float,2>{0.662461698f, 0.883415341f},
-std::array<float,2>{0.40495193f, 0.844521701f},
-std::array<float,2>{0.592935264f, 0.197388515f},
-std::array<float,2>{0.0716493651f, 0.451090932f},
-std::array<float,2>{0.859846771f, 0.679406762f},
-std::array<float,2>{0.138019636f, 0.765967488f},
-std::array<float,2>{0.990798831f, 0.12632066f},
-std::array<float,2>{0.316530973f, 0.408332855f},
-std::array<float,2>{0.694177926f, 0.723149896f},
-std::array<float,2>{0.453600526f, 0.603254259f},
-std::array<float,2>{0.505215108f, 0.300759047f},
-std::array<float,2>{0.00295126834f, 0.119137235f},
-std::array<float,2>{0.753824174f, 0.980546653f},
-std::array<float,2>{0.0977295563f, 0.633108974f},
-std::array<float,2>{0.831783235f, 0.473044425f},
-std::array<float,2>{0.427173764f, 0.239481077f},
-std::array<float,2>{0.596219361f, 0.83324939f},
-std::array<float,2>{0.290905386f, 0.911980152f},
-std::array<float,2>{0.652936876f, 0.0110617904f},
-std::array<float,2>{0.218118876f, 0.357142448f},
-std::array<float,2>{0.892745316f, 0.532270551f},
-std::array<float,2>{0.0851433426f, 0.815889299f},
-std::array<float,2>{0.846288562f, 0.229086906f},
-std::array<float,2>{0.389723867f, 0.494341761f},
-std::array<float,2>{0.563099802f, 0.649876237f},
-std::array<float,2>{0.262543082f, 0.554870605f},
-std::array<float,2>{0.680818021f, 0.370678872f},
-std::array<float,2>{0.236756176f, 0.0224622786f},
-std::array<float,2>{0.935915709f, 0.929748237f},
-std::array<float,2>{0.156436533f, 0.747582674f},
-std::array<float,2>{0.943111062f, 0.430635422f},
-std::array<float,2>{0.359631389f, 0.147932544f},
-std::array<float,2>{0.721504331f, 0.750647724f},
-std::array<float,2>{0.472206444f, 0.991653383f},
-std::array<float,2>{0.558850348f, 0.104604907f},
-std::array<float,2>{0.0397495665f, 0.290421635f},
-std::array<float,2>{0.79011935f, 0.622543216f},
-std::array<float,2>{0.189027458f, 0.898241818f},
-std::array<float,2>{0.883119047f, 0.0538095832f},
-std::array<float,2>{0.311719656f, 0.333618253f},
-std::array<float,2>{0.638731003f, 0.511852801f},
-std::array<float,2>{0.415751219f, 0.665633917f},
-std::array<float,2>{0.612220705f, 0.46124965f},
-std::array<float,2>{0.123445012f, 0.213495687f},
-std::array<float,2>{0.827789903f, 0.861465931f},
-std::array<float,2>{0.0248957574f, 0.566072285f},
-std::array<float,2>{0.765708506f, 0.278378218f},
-std::array<float,2>{0.441527665f, 0.0663443655f},
-std::array<float,2>{0.520555377f, 0.947730124f},
-std::array<float,2>{0.337161094f, 0.781850815f},
-std::array<float,2>{0.711595178f, 0.186282516f},
-std::array<float,2>{0.154036522f, 0.405400723f},
-std::array<float,2>{0.976118267f, 0.691163361f},
-std::array<float,2>{0.0338783525f, 0.909032166f},
-std::array<float,2>{0.78687501f, 0.0150134405f},
-std::array<float,2>{0.483322531f, 0.355310649f},
-std::array<float,2>{0.549817979f, 0.537619293f},
-std::array<float,2>{0.374421507f, 0.639726877f},
-std::array<float,2>{0.72759974f, 0.469165623f},
-std::array<float,2>{0.168114811f, 0.237678587f},
-std::array<float,2>{0.950029194f, 0.828151762f},
-std::array<float,2>{0.246148199f, 0.606102049f},
-std::array<float,2>{0.923760474f, 0.302420199f},
-std::array<float,2>{0.250567079f, 0.123515777f},
-std::array<float,2>{0.678212106f, 0.979719877f},
-std::array<float,2>{0.376060843f, 0.772329092f},
-std::array<float,2>{0.57310921f, 0.129559606f},
-std::array<float,2>{0.0920591205f, 0.41190818f},
-std::array<float,2>{0.852843761f, 0.720534682f},
-std::array<float,2>{0.142373592f, 0.849553585f},
-std::array<float,2>{0.978876352f, 0.200979695f},
-std::array<float,2>{0.334399998f, 0.448724389f},
-std::array<float,2>{0.704611659f, 0.674898684f},
-std::array<float,2>{0.449229598f, 0.518982947f},
-std::array<float,2>{0.52786386f, 0.31774056f},
-std::array<float,2>{0.0164236296f, 0.0316422321f},
-std::array<float,2>{0.777573228f, 0.888982594f},
-std::array<float,2>{0.117011458f, 0.714779019f},
-std::array<float,2>{0.813270807f, 0.379751414f},
-std::array<float,2>{0.407495022f, 0.167194813f},
-std::array<float,2>{0.624025643f, 0.800308824f},
-std::array<float,2>{0.299124569f, 0.964073241f},
-std::array<float,2>{0.632752895f, 0.093484588f},
-std::array<float,2>{0.197799101f, 0.256476313f},
-std::array<float,2>{0.875698507f, 0.592748582f},
-std::array<float,2>{0.0685516819f, 0.788486421f},
-std::array<float,2>{0.871730864f, 0.182574525f},
-std::array<float,2>{0.396110356f, 0.402272552f},
-std::array<float,2>{0.579082191f, 0.694633126f},
-std::array<float,2>{0.274235338f, 0.568121731f},
-std::array<float,2>{0.669059157f, 0.274463624f},
-std::array<float,2>{0.232723758f, 0.0678969398f},
-std::array<float,2>{0.907231867f, 0.952388167f},
-std::array<float,2>{0.172782466f, 0.668575168f},
-std::array<float,2>{0.965000927f, 0.466244161f},
-std::array<float,2>{0.350680649f, 0.218687043f},
-std::array<float,2>{0.747018754f, 0.863539279f},
-std::array<float,2>{0.499414653f, 0.891600549f},
-std::array<float,2>{0.53597945f, 0.0471095145f},
-std::array<float,2>{0.0475669503f, 0.331632972f},
-std::array<float,2>{0.808653772f, 0.508291841f},
-std::array<float,2>{0.206082061f, 0.986148238f},
-std::array<float,2>{0.904676855f, 0.107651338f},
-std::array<float,2>{0.287944198f, 0.296725899f},
-std::array<float,2>{0.643511653f, 0.618926644f},
-std::array<float,2>{0.429891527f, 0.74252367f},
-std::array<float,2>{0.607904792f, 0.434425622f},
-std::array<float,2>{0.108549334f, 0.14397946f},
-std::array<float,2>{0.838603377f, 0.756363988f},
-std::array<float,2>{0.0120975729f, 0.560064137f},
-std::array<float,2>{0.760181069f, 0.373828173f},
-std::array<float,2>{0.466173172f, 0.0169438366f},
-std::array<float,2>{0.513207376f, 0.934027195f},
-std::array<float,2>{0.321886927f, 0.816958308f},
-std::array<float,2>{0.695319831f, 0.232257158f},
-std::array<float,2>{0.12932241f, 0.498853564f},
-std::array<float,2>{0.99479109f, 0.653515995f},
-std::array<float,2>{0.0973754525f, 0.942356467f},
-std::array<float,2>{0.835227311f, 0.0725152865f},
-std::array<float,2>{0.42567277f, 0.269765854f},
-std::array<float,2>{0.600170016f, 0.574619055f},
-std::array<float,2>{0.293303758f, 0.696751058f},
-std::array<float,2>{0.649609089f, 0.392658681f},
-std::array<float,2>{0.214239553f, 0.178504884f},
-std::array<float,2>{0.897152185f, 0.795289814f},
-std::array<float,2>{0.134914041f, 0.507006407f},
-std::array<float,2>{0.986789882f, 0.340903431f},
-std::array<float,2>{0.312847525f, 0.0620398819f},
-std::array<float,2>{0.687633395f, 0.900487304f},
-std::array<float,2>{0.459739357f, 0.868674576f},
-std::array<float,2>{0.502144754f, 0.204373002f},
-std::array<float,2>{0.00579228066f, 0.459896713f},
-std::array<float,2>{0.75561136f, 0.663594127f},
-std::array<float,2>{0.219965085f, 0.762065709f},
-std::array<float,2>{0.921845913f, 0.150376648f},
-std::array<float,2>{0.27237913f, 0.424034655f},
-std::array<float,2>{0.657563865f, 0.73688668f},
-std::array<float,2>{0.401979864f, 0.612434566f},
-std::array<float,2>{0.588979542f, 0.28675428f},
-std::array<float,2>{0.0760663226f, 0.0944906697f},
-std::array<float,2>{0.865565419f, 0.999028981f},
-std::array<float,2>{0.0549779646f, 0.643106937f},
-std::array<float,2>{0.802056193f, 0.489470661f},
-std::array<float,2>{0.488652796f, 0.223586261f},
-std::array<float,2>{0.542535186f, 0.821969271f},
-std::array<float,2>{0.353379548f, 0.923594296f},
-std::array<float,2>{0.737925589f, 0.024577681f},
-std::array<float,2>{0.186002344f, 0.361867726f},
-std::array<float,2>{0.955925286f, 0.554301262f},
-std::array<float,2>{0.0297864489f, 0.842401981f},
-std::array<float,2>{0.772673666f, 0.246767104f},
-std::array<float,2>{0.441359222f, 0.481391132f},
-std::array<float,2>{0.519248188f, 0.632638216f},
-std::array<float,2>{0.343251646f, 0.542426586f},
-std::array<float,2>{0.718050063f, 0.345655531f},
-std::array<float,2>{0.149643213f, 0.0074294596f},
-std::array<float,2>{0.970174789f, 0.920443356f},
-std::array<float,2>{0.194244951f, 0.729279935f},
-std::array<float,2>{0.887439549f, 0.416195482f},
-std::array<float,2>{0.307893306f, 0.134646252f},
-std::array<float,2>{0.634846747f, 0.773870468f},
-std::array<float,2>{0.419226021f, 0.97334832f},
-std::array<float,2>{0.615488231f, 0.111121453f},
-std::array<float,2>{0.120040804f, 0.3099778f},
-std::array<float,2>{0.822979212f, 0.595963538f},
-std::array<float,2>{0.161843911f, 0.879760385f},
-std::array<float,2>{0.940884471f, 0.0415903181f},
-std::array<float,2>{0.364169478f, 0.321659803f},
-std::array<float,2>{0.72371465f, 0.523795366f},
-std::array<float,2>{0.474256426f, 0.681271553f},
-std::array<float,2>{0.55469346f, 0.438454598f},
-std::array<float,2>{0.0449137464f, 0.187651053f},
-std::array<float,2>{0.79412818f, 0.853183091f},
-std::array<float,2>{0.0814374834f, 0.585470617f},
-std::array<float,2>{0.85007602f, 0.26421535f},
-std::array<float,2>{0.384403318f, 0.0789550021f},
-std::array<float,2>{0.566852748f, 0.955905735f},
-std::array<float,2>{0.261609495f, 0.806764543f},
-std::array<float,2>{0.684285104f, 0.157426015f},
-std::array<float,2>{0.241310313f, 0.386410236f},
-std::array<float,2>{0.930718422f, 0.708513081f},
-std::array<float,2>{0.0861034542f, 0.906178057f},
-std::array<float,2>{0.857751489f, 0.0560926609f},
-std::array<float,2>{0.379498631f, 0.336292505f},
-std::array<float,2>{0.575192571f, 0.502452016f},
-std::array<float,2>{0.255271137f, 0.659182847f},
-std::array<float,2>{0.674002111f, 0.456194073f},
-std::array<float,2>{0.24431403f, 0.20755133f},
-std::array<float,2>{0.928053975f, 0.872700453f},
-std::array<float,2>{0.165480807f, 0.572452843f},
-std::array<float,2>{0.947694778f, 0.267859042f},
-std::array<float,2>{0.367381424f, 0.0779297501f},
-std::array<float,2>{0.730868101f, 0.937672615f},
-std::array<float,2>{0.479280204f, 0.791716039f},
-std::array<float,2>{0.553418279f, 0.172433868f},
-std::array<float,2>{0.0373984911f, 0.397624999f},
-std::array<float,2>{0.781376839f, 0.701197147f},
-std::array<float,2>{0.201061249f, 0.827130795f},
-std::array<float,2>{0.879403174f, 0.219132021f},
-std::array<float,2>{0.303200483f, 0.488177598f},
-std::array<float,2>{0.628601551f, 0.646165311f},
-std::array<float,2>{0.41086027f, 0.550707102f},
-std::array<float,2>{0.61744535f, 0.366283536f},
-std::array<float,2>{0.112193391f, 0.0288354624f},
-std::array<float,2>{0.818996727f, 0.926043987f},
-std::array<float,2>{0.0226192269f, 0.741955698f},
-std::array<float,2>{0.775648117f, 0.427044392f},
-std::array<float,2>{0.44777146f, 0.154319763f},
-std::array<float,2>{0.525558949f, 0.760100424f},
-std::array<float,2>{0.330384284f, 0.993552983f},
-std::array<float,2>{0.708702326f, 0.0977047086f},
-std::array<float,2>{0.146862358f, 0.28127718f},
-std::array<float,2>{0.981758296f, 0.616027236f},
-std::array<float,2>{0.0510737747f, 0.778692007f},
-std::array<float,2>{0.807199657f, 0.137380987f},
-std::array<float,2>{0.492330521f, 0.421802014f},
-std::array<float,2>{0.533438385f, 0.733020186f},
-std::array<float,2>{0.344816506f, 0.599097252f},
-std::array<float,2>{0.745936692f, 0.306922227f},
-std::array<float,2>{0.179223895f, 0.11360386f},
-std::array<float,2>{0.961119175f, 0.971815348f},
-std::array<float,2>{0.228420734f, 0.625807464f},
-std::array<float,2>{0.910514057f, 0.480143368f},
-std::array<float,2>{0.278318048f, 0.244836897f},
-std::array<float,2>{0.664838493f, 0.837794423f},
-std::array<float,2>{0.394340783f, 0.917765677f},
-std::array<float,2>{0.583249927f, 0.00198033359f},
-std::array<float,2>{0.0659727454f, 0.34836942f},
-std::array<float,2>{0.868850052f, 0.545283735f},
-std::array<float,2>{0.125641301f, 0.960584283f},
-std::array<float,2>{0.999076784f, 0.0823722184f},
-std::array<float,2>{0.325484782f, 0.260015428f},
-std::array<float,2>{0.701714635f, 0.578511178f},
-std::array<float,2>{0.46099785f, 0.70318979f},
-std::array<float,2>{0.510234594f, 0.388283521f},
-std::array<float,2>{0.0116096605f, 0.161845669f},
-std::array<float,2>{0.76493144f, 0.811394691f},
-std::array<float,2>{0.103535496f, 0.5311836f},
-std::array<float,2>{0.842761934f, 0.327756941f},
-std::array<float,2>{0.437177002f, 0.0440771431f},
-std::array<float,2>{0.602580667f, 0.875625908f},
-std::array<float,2>{0.281451702f, 0.857921898f},
-std::array<float,2>{0.647704601f, 0.192339167f},
-std::array<float,2>{0.208066434f, 0.442367494f},
-std::array<float,2>{0.898489177f, 0.685085177f},
-std::array<float,2>{0.000555901555f, 0.982429862f},
-std::array<float,2>{0.751849651f, 0.120238289f},
-std::array<float,2>{0.456876099f, 0.298599124f},
-std::array<float,2>{0.506648958f, 0.605188787f},
-std::array<float,2>{0.318824947f, 0.725403845f},
-std::array<float,2>{0.69308877f, 0.40651229f},
-std::array<float,2>{0.139193982f, 0.127351657f},
-std::array<float,2>{0.988591611f, 0.769011855f},
-std::array<float,2>{0.216299221f, 0.534029484f},
-std::array<float,2>{0.89098382f, 0.357424051f},
-std::array<float,2>{0.291550785f, 0.00882863533f},
-std::array<float,2>{0.655280948f, 0.913023293f},
-std::array<float,2>{0.429591089f, 0.834433854f},
-std::array<float,2>{0.594422638f, 0.241180554f},
-std::array<float,2>{0.100054041f, 0.475700408f},
-std::array<float,2>{0.829960227f, 0.636452079f},
-std::array<float,2>{0.180844218f, 0.80309552f},
-std::array<float,2>{0.958131254f, 0.170196727f},
-std::array<float,2>{0.358177155f, 0.37746197f},
-std::array<float,2>{0.740468562f, 0.71723038f},
-std::array<float,2>{0.486586064f, 0.588107347f},
-std::array<float,2>{0.546425581f, 0.250031233f},
-std::array<float,2>{0.0613530278f, 0.0867515504f},
-std::array<float,2>{0.800513625f, 0.968077183f},
-std::array<float,2>{0.0723473877f, 0.676568687f},
-std::array<float,2>{0.863156497f, 0.453027785f},
-std::array<float,2>{0.403136253f, 0.19598116f},
-std::array<float,2>{0.590287447f, 0.845745564f},
-std::array<float,2>{0.26915437f, 0.885981917f},
-std::array<float,2>{0.660986304f, 0.0372815616f},
-std::array<float,2>{0.2253391f, 0.314805478f},
-std::array<float,2>{0.914709032f, 0.520352781f},
-std::array<float,2>{0.12136396f, 0.860254943f},
-std::array<float,2>{0.825401485f, 0.2125002f},
-std::array<float,2>{0.416108906f, 0.463866293f},
-std::array<float,2>{0.61108166f, 0.666470706f},
-std::array<float,2>{0.30891788f, 0.515209496f},
-std::array<float,2>{0.637123227f, 0.334124118f},
-std::array<float,2>{0.190419003f, 0.0520240739f},
-std::array<float,2>{0.885088503f, 0.894711077f},
-std::array<float,2>{0.154920265f, 0.688947797f},
-std::array<float,2>{0.974100649f, 0.4042781f},
-std::array<float,2>{0.337982953f, 0.18530491f},
-std::array<float,2>{0.714753211f, 0.784031034f},
-std::array<float,2>{0.444105923f, 0.946671069f},
-std::array<float,2>{0.5225541f, 0.063580364f},
-std::array<float,2>{0.0256631058f, 0.280655921f},
-std::array<float,2>{0.76857245f, 0.563928545f},
-std::array<float,2>{0.235096678f, 0.932602704f},
-std::array<float,2>{0.934074819f, 0.0202313662f},
-std::array<float,2>{0.263746232f, 0.368924797f},
-std::array<float,2>{0.682967246f, 0.55740881f},
-std::array<float,2>{0.387135863f, 0.650747776f},
-std::array<float,2>{0.56463927f, 0.492418319f},
-std::array<float,2>{0.0839241073f, 0.22785221f},
-std::array<float,2>{0.844330311f, 0.813135207f},
-std::array<float,2>{0.0426676236f, 0.62453109f},
-std::array<float,2>{0.791017056f, 0.29216218f},
-std::array<float,2>{0.469171703f, 0.102188848f},
-std::array<float,2>{0.562387288f, 0.989341676f},
-std::array<float,2>{0.362476826f, 0.753637254f},
-std::array<float,2>{0.719400764f, 0.145682961f},
-std::array<float,2>{0.158263147f, 0.432275087f},
-std::array<float,2>{0.943809271f, 0.749390304f},
-std::array<float,2>{0.0198350679f, 0.927220285f},
-std::array<float,2>{0.773717463f, 0.0276848674f},
-std::array<float,2>{0.447110981f, 0.365632981f},
-std::array<float,2>{0.524875939f, 0.549202144f},
-std::array<float,2>{0.328781039f, 0.644717038f},
-std::array<float,2>{0.710405886f, 0.486867756f},
-std::array<float,2>{0.145244673f, 0.220435262f},
-std::array<float,2>{0.98406601f, 0.828105688f},
-std::array<float,2>{0.202049226f, 0.616952896f},
-std::array<float,2>{0.882363737f, 0.282313973f},
-std::array<float,2>{0.300898492f, 0.0992010236f},
-std::array<float,2>{0.625972033f, 0.992373466f},
-std::array<float,2>{0.413440466f, 0.76140219f},
-std::array<float,2>{0.620607138f, 0.156096026f},
-std::array<float,2>{0.109898366f, 0.426514536f},
-std::array<float,2>{0.816937149f, 0.740498722f},
-std::array<float,2>{0.166595832f, 0.87199825f},
-std::array<float,2>{0.946714699f, 0.208555281f},
-std::array<float,2>{0.371068656f, 0.455285668f},
-std::array<float,2>{0.734359384f, 0.65881443f},
-std::array<float,2>{0.476929665f, 0.503543019f},
-std::array<float,2>{0.551551402f, 0.337501466f},
-std::array<float,2>{0.0358434357f, 0.055109337f},
-std::array<float,2>{0.784676015f, 0.904477775f},
-std::array<float,2>{0.0888480172f, 0.702443242f},
-std::array<float,2>{0.855652213f, 0.396979362f},
-std::array<float,2>{0.382438898f, 0.173072055f},
-std::array<float,2>{0.576488137f, 0.792055309f},
-std::array<float,2>{0.257747054f, 0.938833714f},
-std::array<float,2>{0.672349036f, 0.0763470754f},
-std::array<float,2>{0.242361486f, 0.269229442f},
-std::array<float,2>{0.927487016f, 0.573645175f},
-std::array<float,2>{0.102769367f, 0.812163651f},
-std::array<float,2>{0.84013623f, 0.16083315f},
-std::array<float,2>{0.43400237f, 0.386941612f},
-std::array<float,2>{0.605259538f, 0.704176426f},
-std::array<float,2>{0.285086632f, 0.579143703f},
-std::array<float,2>{0.646251619f, 0.261650145f},
-std::array<float,2>{0.209660858f, 0.0835432708f},
-std::array<float,2>{0.901525795f, 0.959881485f},
-std::array<float,2>{0.128547043f, 0.683600247f},
-std::array<float,2>{0.997865617f, 0.442442238f},
-std::array<float,2>{0.326593488f, 0.192498222f},
-std::array<float,2>{0.69932282f, 0.859175503f},
-std::array<float,2>{0.464158207f, 0.87636888f},
-std::array<float,2>{0.508997083f, 0.043815963f},
-std::array<float,2>{0.0082128318f, 0.326860994f},
-std::array<float,2>{0.763156831f, 0.530032992f},
-std::array<float,2>{0.229001775f, 0.970780134f},
-std::array<float,2>{0.913711131f, 0.114697307f},
-std::array<float,2>{0.279441625f, 0.308410138f},
-std::array<float,2>{0.666897357f, 0.598567843f},
-std::array<float,2>{0.392027646f, 0.734099984f},
-std::array<float,2>{0.584745646f, 0.4203282f},
-std::array<float,2>{0.063093394f, 0.138101846f},
-std::array<float,2>{0.870176911f, 0.778018117f},
-std::array<float,2>{0.0532588251f, 0.546015501f},
-std::array<float,2>{0.8053689f, 0.349121153f},
-std::array<float,2>{0.495169461f, 0.00378368213f},
-std::array<float,2>{0.532948673f, 0.916838884f},
-std::array<float,2>{0.34608227f, 0.836658597f},
-std::array<float,2>{0.743693888f, 0.245643258f},
-std::array<float,2>{0.175863937f, 0.479422837f},
-std::array<float,2>{0.963314414f, 0.626412749f},
-std::array<float,2>{0.071520716f, 0.96770972f},
-std::array<float,2>{0.859534383f, 0.086954996f},
-std::array<float,2>{0.405130535f, 0.251902372f},
-std::array<float,2>{0.593034625f, 0.589673936f},
-std::array<float,2>{0.267400891f, 0.718168974f},
-std::array<float,2>{0.662243903f, 0.378883243f},
-std::array<float,2>{0.222802177f, 0.171520948f},
-std::array<float,2>{0.916854858f, 0.803940296f},
-std::array<float,2>{0.1824231f, 0.521209657f},
-std::array<float,2>{0.960173547f, 0.316072822f},
-std::array<float,2>{0.356064081f, 0.0387829468f},
-std::array<float,2>{0.740185082f, 0.885137618f},
-std::array<float,2>{0.484842569f, 0.846760213f},
-std::array<float,2>{0.544542611f, 0.196859628f},
-std::array<float,2>{0.0591605864f, 0.45117712f},
-std::array<float,2>{0.798733771f, 0.677113116f},
-std::array<float,2>{0.217796296f, 0.767653406f},
-std::array<float,2>{0.892955363f, 0.128337368f},
-std::array<float,2>{0.290536463f, 0.407516837f},
-std::array<float,2>{0.653092802f, 0.726364493f},
-std::array<float,2>{0.426992506f, 0.60362649f},
-std::array<float,2>{0.596518278f, 0.297010481f},
-std::array<float,2>{0.0981117561f, 0.119274117f},
-std::array<float,2>{0.83182621f, 0.984194756f},
-std::array<float,2>{0.00326103414f, 0.635416031f},
-std::array<float,2>{0.753492773f, 0.474938065f},
-std::array<float,2>{0.453245968f, 0.241511047f},
-std::array<float,2>{0.505110621f, 0.835154593f},
-std::array<float,2>{0.316713423f, 0.913138807f},
-std::array<float,2>{0.693907797f, 0.00802317914f},
-std::array<float,2>{0.137879401f, 0.358657688f},
-std::array<float,2>{0.991205156f, 0.53493768f},
-std::array<float,2>{0.0400331058f, 0.81397897f},
-std::array<float,2>{0.79040724f, 0.226570398f},
-std::array<float,2>{0.472494006f, 0.493773937f},
-std::array<float,2>{0.558780193f, 0.651569009f},
-std::array<float,2>{0.359515935f, 0.558412731f},
-std::array<float,2>{0.721319497f, 0.367716521f},
-std::array<float,2>{0.156576335f, 0.0212671608f},
-std::array<float,2>{0.943222821f, 0.933553278f},
-std::array<float,2>{0.236441985f, 0.748375714f},
-std::array<float,2>{0.93567431f, 0.432893187f},
-std::array<float,2>{0.262299448f, 0.144534051f},
-std::array<float,2>{0.680954933f, 0.752660573f},
-std::array<float,2>{0.390086234f, 0.989090383f},
-std::array<float,2>{0.563326597f, 0.102583393f},
-std::array<float,2>{0.0852550417f, 0.291192591f},
-std::array<float,2>{0.846478283f, 0.623620331f},
-std::array<float,2>{0.154172763f, 0.896461964f},
-std::array<float,2>{0.976351559f, 0.0516399406f},
-std::array<float,2>{0.337099165f, 0.335370749f},
-std::array<float,2>{0.711892188f, 0.514235914f},
-std::array<float,2>{0.441672504f, 0.667693377f},
-std::array<float,2>{0.520861745f, 0.464558214f},
-std::array<float,2>{0.0246240702f, 0.211798534f},
-std::array<float,2>{0.766105771f, 0.860987246f},
-std::array<float,2>{0.123288751f, 0.563288093f},
-std::array<float,2>{0.827950299f, 0.27954936f},
-std::array<float,2>{0.4158566f, 0.0629154891f},
-std::array<float,2>{0.611961663f, 0.945966244f},
-std::array<float,2>{0.31177935f, 0.784466326f},
-std::array<float,2>{0.639041781f, 0.183612511f},
-std::array<float,2>{0.189295396f, 0.402492702f},
-std::array<float,2>{0.88293606f, 0.687940896f},
-std::array<float,2>{0.114861943f, 0.890356958f},
-std::array<float,2>{0.81572926f, 0.0327320397f},
-std::array<float,2>{0.410022736f, 0.316726655f},
-std::array<float,2>{0.622973323f, 0.518549681f},
-std::array<float,2>{0.298637778f, 0.674574792f},
-std::array<float,2>{0.630293965f, 0.447535247f},
-std::array<float,2>{0.196957693f, 0.199223578f},
-std::array<float,2>{0.877790272f, 0.847878873f},
-std::array<float,2>{0.144358486f, 0.592861712f},
-std::array<float,2>{0.977699757f, 0.256846845f},
-std::array<float,2>{0.332947314f, 0.091895476f},
-std::array<float,2>{0.706220448f, 0.962987363f},
-std::array<float,2>{0.452598006f, 0.799135149f},
-std::array<float,2>{0.529775858f, 0.16634728f},
-std::array<float,2>{0.0186552461f, 0.380686015f},
-std::array<float,2>{0.780663311f, 0.712970018f},
-std::array<float,2>{0.248852208f, 0.829205811f},
-std::array<float,2>{0.92488277f, 0.237269789f},
-std::array<float,2>{0.252584547f, 0.470210403f},
-std::array<float,2>{0.676675379f, 0.638779283f},
-std::array<float,2>{0.378726959f, 0.538154244f},
-std::array<float,2>{0.572235942f, 0.353563607f},
-std::array<float,2>{0.0901904926f, 0.0144877527f},
-std::array<float,2>{0.855006933f, 0.90920788f},
-std::array<float,2>{0.0329072587f, 0.719377279f},
-std::array<float,2>{0.787929893f, 0.410448581f},
-std::array<float,2>{0.481823355f, 0.130677447f},
-std::array<float,2>{0.547847092f, 0.772674561f},
-std::array<float,2>{0.372304201f, 0.979257584f},
-std::array<float,2>{0.730215669f, 0.124446318f},
-std::array<float,2>{0.170396045f, 0.300908804f},
-std::array<float,2>{0.951537371f, 0.606605411f},
-std::array<float,2>{0.0142903244f, 0.757780135f},
-std::array<float,2>{0.7594437f, 0.143354386f},
-std::array<float,2>{0.467834264f, 0.43479839f},
-std::array<float,2>{0.514040172f, 0.743215621f},
-std::array<float,2>{0.323485285f, 0.617507637f},
-std::array<float,2>{0.698835969f, 0.295301646f},
-std::array<float,2>{0.132182524f, 0.108695149f},
-std::array<float,2>{0.99373126f, 0.984720886f},
-std::array<float,2>{0.204953745f, 0.652422965f},
-std::array<float,2>{0.903113723f, 0.499426544f},
-std::array<float,2>{0.285243273f, 0.231048629f},
-std::array<float,2>{0.640723407f, 0.81749022f},
-std::array<float,2>{0.432085246f, 0.935267568f},
-std::array<float,2>{0.606186271f, 0.0157242715f},
-std::array<float,2>{0.107188404f, 0.374732196f},
-std::array<float,2>{0.837300956f, 0.55897373f},
-std::array<float,2>{0.174314633f, 0.951885343f},
-std::array<float,2>{0.968032897f, 0.0672879964f},
-std::array<float,2>{0.348305792f, 0.273770988f},
-std::array<float,2>{0.748688996f, 0.566545188f},
-std::array<float,2>{0.496789604f, 0.694225788f},
-std::array<float,2>{0.537751675f, 0.400519103f},
-std::array<float,2>{0.05022569f, 0.182707086f},
-std::array<float,2>{0.810612619f, 0.787513018f},
-std::array<float,2>{0.0666525811f, 0.508928478f},
-std::array<float,2>{0.873589039f, 0.3307679f},
-std::array<float,2>{0.397112459f, 0.0488164872f},
-std::array<float,2>{0.581545234f, 0.892364919f},
-std::array<float,2>{0.277309239f, 0.864438415f},
-std::array<float,2>{0.670543849f, 0.217681378f},
-std::array<float,2>{0.231728286f, 0.465283871f},
-std::array<float,2>{0.909907579f, 0.669908166f},
-std::array<float,2>{0.0580890477f, 0.998502135f},
-std::array<float,2>{0.803514302f, 0.0951291695f},
-std::array<float,2>{0.490747124f, 0.285669953f},
-std::array<float,2>{0.53987515f, 0.611617565f},
-std::array<float,2>{0.355074137f, 0.737576842f},
-std::array<float,2>{0.7361058f, 0.425313652f},
-std::array<float,2>{0.18507199f, 0.148590446f},
-std::array<float,2>{0.954527676f, 0.763184786f},
-std::array<float,2>{0.220866069f, 0.55320859f},
-std::array<float,2>{0.919842184f, 0.362448066f},
-std::array<float,2>{0.27005899f, 0.0241358057f},
-std::array<float,2>{0.659683764f, 0.922224581f},
-std::array<float,2>{0.400280237f, 0.820828021f},
-std::array<float,2>{0.587770104f, 0.223799169f},
-std::array<float,2>{0.0768239945f, 0.489212394f},
-std::array<float,2>{0.863746643f, 0.644295156f},
-std::array<float,2>{0.13396278f, 0.796647489f},
-std::array<float,2>{0.985850215f, 0.179396555f},
-std::array<float,2>{0.316342115f, 0.394380093f},
-std::array<float,2>{0.689586699f, 0.696218491f},
-std::array<float,2>{0.458350301f, 0.575566232f},
-std::array<float,2>{0.501778305f, 0.270627141f},
-std::array<float,2>{0.00687444769f, 0.0733049959f},
-std::array<float,2>{0.756833911f, 0.942417681f},
-std::array<float,2>{0.0941436365f, 0.66282028f},
-std::array<float,2>{0.832593739f, 0.46028015f},
-std::array<float,2>{0.423073918f, 0.204002813f},
-std::array<float,2>{0.597939968f, 0.867898881f},
-std::array<float,2>{0.296292961f, 0.901595294f},
-std::array<float,2>{0.651582956f, 0.0612740889f},
-std::array<float,2>{0.211939171f, 0.340144813f},
-std::array<float,2>{0.894995153f, 0.506615102f},
-std::array<float,2>{0.0786471367f, 0.851710379f},
-std::array<float,2>{0.848946035f, 0.188615367f},
-std::array<float,2>{0.38664183f, 0.439398378f},
-std::array<float,2>{0.570124209f, 0.679876268f},
-std::array<float,2>{0.258804977f, 0.52505213f},
-std::array<float,2>{0.686614513f, 0.320704043f},
-std::array<float,2>{0.240123734f, 0.0428794511f},
-std::array<float,2>{0.933543801f, 0.880730152f},
-std::array<float,2>{0.162647754f, 0.707465827f},
-std::array<float,2>{0.939158559f, 0.384980559f},
-std::array<float,2>{0.36591208f, 0.156993508f},
-std::array<float,2>{0.725741625f, 0.808033586f},
-std::array<float,2>{0.475033909f, 0.956538975f},
-std::array<float,2>{0.558045805f, 0.0795483664f},
-std::array<float,2>{0.046697773f, 0.265167505f},
-std::array<float,2>{0.795988381f, 0.584843278f},
-std::array<float,2>{0.19295232f, 0.921386182f},
-std::array<float,2>{0.889387429f, 0.00640326459f},
-std::array<float,2>{0.306533098f, 0.344172478f},
-std::array<float,2>{0.633363545f, 0.541319668f},
-std::array<float,2>{0.420148909f, 0.630943716f},
-std::array<float,2>{0.613399506f, 0.482108086f},
-std::array<float,2>{0.118444726f, 0.247162089f},
-std::array<float,2>{0.82053864f, 0.843328834f},
-std::array<float,2>{0.0282711629f, 0.596688926f},
-std::array<float,2>{0.771443427f, 0.309418827f},
-std::array<float,2>{0.4387815f, 0.109827407f},
-std::array<float,2>{0.515749753f, 0.974502802f},
-std::array<float,2>{0.340630352f, 0.775094569f},
-std::array<float,2>{0.715224922f, 0.133038551f},
-std::array<float,2>{0.150930032f, 0.417291194f},
-std::array<float,2>{0.972189248f, 0.729884446f},
-std::array<float,2>{0.0371807851f, 0.902913451f},
-std::array<float,2>{0.781509042f, 0.0580032431f},
-std::array<float,2>{0.479040563f, 0.338635206f},
-std::array<float,2>{0.553537488f, 0.500255108f},
-std::array<float,2>{0.367601216f, 0.657234788f},
-std::array<float,2>{0.730655611f, 0.454828054f},
-std::array<float,2>{0.165261209f, 0.209799007f},
-std::array<float,2>{0.947335124f, 0.874834061f},
-std::array<float,2>{0.244591802f, 0.571775496f},
-std::array<float,2>{0.927956223f, 0.266509503f},
-std::array<float,2>{0.254970104f, 0.0758594498f},
-std::array<float,2>{0.674165845f, 0.94130981f},
-std::array<float,2>{0.379793525f, 0.789179146f},
-std::array<float,2>{0.574885845f, 0.175408006f},
-std::array<float,2>{0.0863950178f, 0.394539446f},
-std::array<float,2>{0.857449949f, 0.700365186f},
-std::array<float,2>{0.146573916f, 0.824317157f},
-std::array<float,2>{0.981576145f, 0.221634313f},
-std::array<float,2>{0.33032158f, 0.484414518f},
-std::array<float,2>{0.708773792f, 0.646738589f},
-std::array<float,2>{0.448148012f, 0.547091961f},
-std::array<float,2>{0.525643528f, 0.363675565f},
-std::array<float,2>{0.0227222405f, 0.0308368597f},
-std::array<float,2>{0.775430381f, 0.928187013f},
-std::array<float,2>{0.11200925f, 0.738839209f},
-std::array<float,2>{0.819169223f, 0.429604769f},
-std::array<float,2>{0.411068559f, 0.154072717f},
-std::array<float,2>{0.6172387f, 0.759098232f},
-std::array<float,2>{0.302890182f, 0.994431615f},
-std::array<float,2>{0.628804266f, 0.101132698f},
-std::array<float,2>{0.200867206f, 0.285116583f},
-std::array<float,2>{0.879717767f, 0.615143001f},
-std::array<float,2>{0.066225782f, 0.780140221f},
-std::array<float,2>{0.868996024f, 0.140481293f},
-std::array<float,2>{0.394166976f, 0.418441683f},
-std::array<float,2>{0.583469689f, 0.732008934f},
-std::array<float,2>{0.27797845f, 0.600903869f},
-std::array<float,2>{0.664720237f, 0.305933863f},
-std::array<float,2>{0.228105038f, 0.115310475f},
-std::array<float,2>{0.910285532f, 0.969931126f},
-std::array<float,2>{0.179539979f, 0.627175927f},
-std::array<float,2>{0.961383283f, 0.477187544f},
-std::array<float,2>{0.345182449f, 0.244092613f},
-std::array<float,2>{0.745803893f, 0.83977896f},
-std::array<float,2>{0.492590368f, 0.914701819f},
-std::array<float,2>{0.533522666f, 0.00051824993f},
-std::array<float,2>{0.0508263558f, 0.349911124f},
-std::array<float,2>{0.807421744f, 0.544510365f},
-std::array<float,2>{0.208367214f, 0.958845019f},
-std::array<float,2>{0.898829162f, 0.0854548439f},
-std::array<float,2>{0.281617731f, 0.258324057f},
-std::array<float,2>{0.647854149f, 0.581679404f},
-std::array<float,2>{0.437380344f, 0.706057012f},
-std::array<float,2>{0.602800846f, 0.389228106f},
-std::array<float,2>{0.10383305f, 0.163826317f},
-std::array<float,2>{0.842313528f, 0.810170889f},
-std::array<float,2>{0.0112455012f, 0.528720021f},
-std::array<float,2>{0.764770567f, 0.324873298f},
-std::array<float,2>{0.461227953f, 0.0457725823f},
-std::array<float,2>{0.50979352f, 0.87831974f},
-std::array<float,2>{0.325255126f, 0.856346786f},
-std::array<float,2>{0.702058554f, 0.194569632f},
-std::array<float,2>{0.125913188f, 0.445072949f},
-std::array<float,2>{0.999330103f, 0.685725331f},
-std::array<float,2>{0.0996746868f, 0.982019126f},
-std::array<float,2>{0.829743683f, 0.117230006f},
-std::array<float,2>{0.429210961f, 0.299214095f},
-std::array<float,2>{0.594589949f, 0.602236271f},
-std::array<float,2>{0.291775554f, 0.724238694f},
-std::array<float,2>{0.655598879f, 0.409232497f},
-std::array<float,2>{0.216027424f, 0.125207201f},
-std::array<float,2>{0.890853703f, 0.76743716f},
-std::array<float,2>{0.139571443f, 0.531400502f},
-std::array<float,2>{0.988364577f, 0.356121361f},
-std::array<float,2>{0.318567425f, 0.0101911528f},
-std::array<float,2>{0.6932199f, 0.910770297f},
-std::array<float,2>{0.456589013f, 0.832530022f},
-std::array<float,2>{0.506512702f, 0.23894316f},
-std::array<float,2>{0.000935125165f, 0.474129081f},
-std::array<float,2>{0.751612425f, 0.633936286f},
-std::array<float,2>{0.225438327f, 0.801276028f},
-std::array<float,2>{0.914893985f, 0.168181017f},
-std::array<float,2>{0.269376099f, 0.376549572f},
-std::array<float,2>{0.660803914f, 0.715153635f},
-std::array<float,2>{0.403036237f, 0.586720467f},
-std::array<float,2>{0.589917243f, 0.251979113f},
-std::array<float,2>{0.0727238879f, 0.0886887386f},
-std::array<float,2>{0.862938821f, 0.966541767f},
-std::array<float,2>{0.061038401f, 0.6777668f},
-std::array<float,2>{0.800715804f, 0.449434578f},
-std::array<float,2>{0.486483306f, 0.198966935f},
-std::array<float,2>{0.546722233f, 0.845434308f},
-std::array<float,2>{0.358039826f, 0.884026706f},
-std::array<float,2>{0.740654886f, 0.0351564102f},
-std::array<float,2>{0.180909693f, 0.314214557f},
-std::array<float,2>{0.958396137f, 0.522349596f},
-std::array<float,2>{0.0254578013f, 0.862553835f},
-std::array<float,2>{0.769036293f, 0.214479312f},
-std::array<float,2>{0.444046438f, 0.462331116f},
-std::array<float,2>{0.52285558f, 0.664182127f},
-std::array<float,2>{0.338318288f, 0.512841642f},
-std::array<float,2>{0.714544833f, 0.332835287f},
-std::array<float,2>{0.155140743f, 0.0530583411f},
-std::array<float,2>{0.973678887f, 0.897262335f},
-std::array<float,2>{0.190078214f, 0.689964056f},
-std::array<float,2>{0.884894252f, 0.404598027f},
-std::array<float,2>{0.308742791f, 0.187412471f},
-std::array<float,2>{0.636947095f, 0.783173323f},
-std::array<float,2>{0.416389644f, 0.94901526f},
-std::array<float,2>{0.611262918f, 0.0652045757f},
-std::array<float,2>{0.121138699f, 0.277627289f},
-std::array<float,2>{0.825669169f, 0.565390944f},
-std::array<float,2>{0.158562094f, 0.930674374f},
-std::array<float,2>{0.943436146f, 0.0223135184f},
-std::array<float,2>{0.362566084f, 0.369717181f},
-std::array<float,2>{0.719533026f, 0.556014061f},
-std::array<float,2>{0.46897164f, 0.649363101f},
-std::array<float,2>{0.562113345f, 0.495550305f},
-std::array<float,2>{0.0427921638f, 0.229719132f},
-std::array<float,2>{0.791326046f, 0.814921916f},
-std::array<float,2>{0.0836006552f, 0.621975243f},
-std::array<float,2>{0.844676316f, 0.289780021f},
-std::array<float,2>{0.386843711f, 0.104457997f},
-std::array<float,2>{0.564887404f, 0.991069615f},
-std::array<float,2>{0.264056295f, 0.751683712f},
-std::array<float,2>{0.682768762f, 0.147119269f},
-std::array<float,2>{0.23534745f, 0.431072801f},
-std::array<float,2>{0.933726132f, 0.746467113f},
-std::array<float,2>{0.0918472111f, 0.908155859f},
-std::array<float,2>{0.852656305f, 0.0128883431f},
-std::array<float,2>{0.376345724f, 0.353268534f},
-std::array<float,2>{0.572824955f, 0.536273479f},
-std::array<float,2>{0.250947565f, 0.638198078f},
-std::array<float,2>{0.677740097f, 0.471325934f},
-std::array<float,2>{0.246420354f, 0.235040456f},
-std::array<float,2>{0.923459411f, 0.831342638f},
-std::array<float,2>{0.168252155f, 0.608884096f},
-std::array<float,2>{0.949936688f, 0.303604841f},
-std::array<float,2>{0.374127895f, 0.122361995f},
-std::array<float,2>{0.727926731f, 0.97755152f},
-std::array<float,2>{0.48297748f, 0.770612895f},
-std::array<float,2>{0.550257266f, 0.131779015f},
-std::array<float,2>{0.0341206007f, 0.412483811f},
-std::array<float,2>{0.78679496f, 0.721286595f},
-std::array<float,2>{0.198058233f, 0.85072577f},
-std::array<float,2>{0.875959754f, 0.202971712f},
-std::array<float,2>{0.298863709f, 0.445435852f},
-std::array<float,2>{0.632384956f, 0.67202282f},
-std::array<float,2>{0.407316983f, 0.517250717f},
-std::array<float,2>{0.62431252f, 0.319817126f},
-std::array<float,2>{0.116908111f, 0.0343972072f},
-std::array<float,2>{0.813044846f, 0.887222826f},
-std::array<float,2>{0.0163439661f, 0.71188271f},
-std::array<float,2>{0.777825475f, 0.381577492f},
-std::array<float,2>{0.449557245f, 0.165665209f},
-std::array<float,2>{0.528235376f, 0.798032761f},
-std::array<float,2>{0.334106505f, 0.960991621f},
-std::array<float,2>{0.70497942f, 0.0914557576f},
-std::array<float,2>{0.142210171f, 0.254375547f},
-std::array<float,2>{0.978544474f, 0.591291666f},
-std::array<float,2>{0.0477232374f, 0.785622716f},
-std::array<float,2>{0.808971107f, 0.180067167f},
-std::array<float,2>{0.49913618f, 0.399081439f},
-std::array<float,2>{0.535762846f, 0.691886306f},
-std::array<float,2>{0.35097155f, 0.569151223f},
-std::array<float,2>{0.746754944f, 0.277284861f},
-std::array<float,2>{0.172535196f, 0.0698811933f},
-std::array<float,2>{0.965102792f, 0.950407624f},
-std::array<float,2>{0.232632324f, 0.670239449f},
-std::array<float,2>{0.907515585f, 0.467510462f},
-std::array<float,2>{0.274047345f, 0.215064168f},
-std::array<float,2>{0.669318914f, 0.865572155f},
-std::array<float,2>{0.396450192f, 0.892965615f},
-std::array<float,2>{0.578716338f, 0.0505060591f},
-std::array<float,2>{0.068716757f, 0.328593731f},
-std::array<float,2>{0.87201941f, 0.510613084f},
-std::array<float,2>{0.129125118f, 0.987800241f},
-std::array<float,2>{0.995057702f, 0.106311552f},
-std::array<float,2>{0.322170287f, 0.293978125f},
-std::array<float,2>{0.695625603f, 0.620441794f},
-std::array<float,2>{0.465912491f, 0.745074093f},
-std::array<float,2>{0.513468444f, 0.436228037f},
-std::array<float,2>{0.0117487852f, 0.141349658f},
-std::array<float,2>{0.759800613f, 0.755305827f},
-std::array<float,2>{0.108740203f, 0.562446237f},
-std::array<float,2>{0.838805676f, 0.372724891f},
-std::array<float,2>{0.430163443f, 0.0187870599f},
-std::array<float,2>{0.607626855f, 0.9359833f},
-std::array<float,2>{0.287692219f, 0.81865418f},
-std::array<float,2>{0.643179953f, 0.234350741f},
-std::array<float,2>{0.206317246f, 0.497369856f},
-std::array<float,2>{0.904343545f, 0.656151235f},
-std::array<float,2>{0.00556371827f, 0.945290864f},
-std::array<float,2>{0.755770981f, 0.0721810758f},
-std::array<float,2>{0.459581524f, 0.272536188f},
-std::array<float,2>{0.502421021f, 0.576694846f},
-std::array<float,2>{0.312557042f, 0.698427677f},
-std::array<float,2>{0.687850833f, 0.391113847f},
-std::array<float,2>{0.135125637f, 0.176957861f},
-std::array<float,2>{0.986409783f, 0.794674695f},
-std::array<float,2>{0.21405597f, 0.504186511f},
-std::array<float,2>{0.897406399f, 0.343621969f},
-std::array<float,2>{0.293037742f, 0.0599238127f},
-std::array<float,2>{0.649865091f, 0.900110543f},
-std::array<float,2>{0.425476789f, 0.869387925f},
-std::array<float,2>{0.600412726f, 0.206017196f},
-std::array<float,2>{0.0976556316f, 0.458128154f},
-std::array<float,2>{0.835120082f, 0.662061334f},
-std::array<float,2>{0.185657054f, 0.764169991f},
-std::array<float,2>{0.955622017f, 0.1512274f},
-std::array<float,2>{0.353037298f, 0.42362836f},
-std::array<float,2>{0.738120079f, 0.736314476f},
-std::array<float,2>{0.488328934f, 0.60953474f},
-std::array<float,2>{0.542832136f, 0.287410915f},
-std::array<float,2>{0.0547208413f, 0.0973393917f},
-std::array<float,2>{0.801757812f, 0.996262014f},
-std::array<float,2>{0.0757156014f, 0.642430544f},
-std::array<float,2>{0.865278959f, 0.490781665f},
-std::array<float,2>{0.4023287f, 0.225953043f},
-std::array<float,2>{0.589241087f, 0.82255578f},
-std::array<float,2>{0.27215305f, 0.92534858f},
-std::array<float,2>{0.657287598f, 0.0264357999f},
-std::array<float,2>{0.220170945f, 0.360241085f},
-std::array<float,2>{0.92144233f, 0.551899374f},
-std::array<float,2>{0.119813204f, 0.841688871f},
-std::array<float,2>{0.823229194f, 0.249331385f},
-std::array<float,2>{0.419130504f, 0.482600659f},
-std::array<float,2>{0.615383565f, 0.629021823f},
-std::array<float,2>{0.307741851f, 0.540831506f},
-std::array<float,2>{0.635099947f, 0.346121401f},
-std::array<float,2>{0.194070503f, 0.00421612756f},
-std::array<float,2>{0.887539446f, 0.918133914f},
-std::array<float,2>{0.149866819f, 0.728461742f},
-std::array<float,2>{0.969808936f, 0.415266603f},
-std::array<float,2>{0.342828214f, 0.135847181f},
-std::array<float,2>{0.717905521f, 0.775772035f},
-std::array<float,2>{0.441050798f, 0.975837469f},
-std::array<float,2>{0.51937902f, 0.112703927f},
-std::array<float,2>{0.0302284975f, 0.311721802f},
-std::array<float,2>{0.772749305f, 0.595111966f},
-std::array<float,2>{0.241632327f, 0.881322682f},
-std::array<float,2>{0.930978477f, 0.0405307449f},
-std::array<float,2>{0.261320353f, 0.323420018f},
-std::array<float,2>{0.684432745f, 0.526485741f},
-std::array<float,2>{0.384590477f, 0.682671964f},
-std::array<float,2>{0.566630483f, 0.440987587f},
-std::array<float,2>{0.0812986195f, 0.191218033f},
-std::array<float,2>{0.849610806f, 0.854289889f},
-std::array<float,2>{0.0445642397f, 0.583443046f},
-std::array<float,2>{0.79423213f, 0.261898309f},
-std::array<float,2>{0.474393547f, 0.0809902325f},
-std::array<float,2>{0.55499661f, 0.953171611f},
-std::array<float,2>{0.363988936f, 0.805578768f},
-std::array<float,2>{0.723889172f, 0.159582675f},
-std::array<float,2>{0.16192174f, 0.382984042f},
-std::array<float,2>{0.940628231f, 0.710243046f},
-std::array<float,2>{0.00900120568f, 0.877496243f},
-std::array<float,2>{0.762282193f, 0.0465749726f},
-std::array<float,2>{0.463743955f, 0.326047093f},
-std::array<float,2>{0.507965863f, 0.528262258f},
-std::array<float,2>{0.32784307f, 0.686794341f},
-std::array<float,2>{0.70046854f, 0.443822652f},
-std::array<float,2>{0.12747021f, 0.193449408f},
-std::array<float,2>{0.996542156f, 0.856810212f},
-std::array<float,2>{0.210357681f, 0.580242753f},
-std::array<float,2>{0.900843084f, 0.25902757f},
-std::array<float,2>{0.284097403f, 0.0841500908f},
-std::array<float,2>{0.645450771f, 0.957844377f},
-std::array<float,2>{0.434930235f, 0.809232175f},
-std::array<float,2>{0.604108214f, 0.162583902f},
-std::array<float,2>{0.102455959f, 0.390033484f},
-std::array<float,2>{0.841409028f, 0.705287993f},
-std::array<float,2>{0.176869944f, 0.837986171f},
-std::array<float,2>{0.964380145f, 0.242427349f},
-std::array<float,2>{0.347432584f, 0.477724701f},
-std::array<float,2>{0.742441297f, 0.628185213f},
-std::array<float,2>{0.494844168f, 0.54335922f},
-std::array<float,2>{0.531882048f, 0.350673884f},
-std::array<float,2>{0.0539402477f, 0.00170309516f},
-std::array<float,2>{0.806380391f, 0.915137589f},
-std::array<float,2>{0.0642539039f, 0.730763137f},
-std::array<float,2>{0.870007336f, 0.418993384f},
-std::array<float,2>{0.391346782f, 0.139386311f},
-std::array<float,2>{0.58525151f, 0.780767918f},
-std::array<float,2>{0.280566514f, 0.969448626f},
-std::array<float,2>{0.667603076f, 0.116607718f},
-std::array<float,2>{0.22971788f, 0.305116266f},
-std::array<float,2>{0.912783444f, 0.600262642f},
-std::array<float,2>{0.110729843f, 0.758723438f},
-std::array<float,2>{0.817397892f, 0.152774557f},
-std::array<float,2>{0.412482172f, 0.428059578f},
-std::array<float,2>{0.619366407f, 0.739900529f},
-std::array<float,2>{0.302543581f, 0.613679051f},
-std::array<float,2>{0.626187921f, 0.284164995f},
-std::array<float,2>{0.202216357f, 0.0999608487f},
-std::array<float,2>{0.881250441f, 0.995926321f},
-std::array<float,2>{0.145736426f, 0.648232222f},
-std::array<float,2>{0.982960403f, 0.486064851f},
-std::array<float,2>{0.330001593f, 0.222608835f},
-std::array<float,2>{0.709414244f, 0.825284541f},
-std::array<float,2>{0.445625931f, 0.928972244f},
-std::array<float,2>{0.523502827f, 0.0299335439f},
-std::array<float,2>{0.0208181608f, 0.364764154f},
-std::array<float,2>{0.775007188f, 0.548062146f},
-std::array<float,2>{0.243686154f, 0.939791977f},
-std::array<float,2>{0.926104128f, 0.0750198439f},
-std::array<float,2>{0.255919069f, 0.267158717f},
-std::array<float,2>{0.673727393f, 0.570574105f},
-std::array<float,2>{0.381766826f, 0.69967252f},
-std::array<float,2>{0.577891588f, 0.396257311f},
-std::array<float,2>{0.0889235809f, 0.174255252f},
-std::array<float,2>{0.857164919f, 0.790376365f},
-std::array<float,2>{0.0362462737f, 0.501569033f},
-std::array<float,2>{0.783477128f, 0.339081824f},
-std::array<float,2>{0.477595538f, 0.0569270104f},
-std::array<float,2>{0.552461326f, 0.904296577f},
-std::array<float,2>{0.369883299f, 0.873318255f},
-std::array<float,2>{0.733210444f, 0.210014001f},
-std::array<float,2>{0.167107046f, 0.453489602f},
-std::array<float,2>{0.946274936f, 0.65711081f},
-std::array<float,2>{0.0843547434f, 0.991972148f},
-std::array<float,2>{0.847347796f, 0.105127282f},
-std::array<float,2>{0.388782889f, 0.290803403f},
-std::array<float,2>{0.563821256f, 0.622778773f},
-std::array<float,2>{0.263251752f, 0.747458875f},
-std::array<float,2>{0.679989934f, 0.430116832f},
-std::array<float,2>{0.238021776f, 0.148090497f},
-std::array<float,2>{0.937383175f, 0.750154674f},
-std::array<float,2>{0.158172742f, 0.555206537f},
-std::array<float,2>{0.941540956f, 0.370228022f},
-std::array<float,2>{0.360504776f, 0.0233615935f},
-std::array<float,2>{0.722127557f, 0.930351198f},
-std::array<float,2>{0.470706016f, 0.81594187f},
-std::array<float,2>{0.560072184f, 0.228865027f},
-std::array<float,2>{0.0406578518f, 0.494970173f},
-std::array<float,2>{0.789319456f, 0.649934113f},
-std::array<float,2>{0.18815279f, 0.781270623f},
-std::array<float,2>{0.884632051f, 0.185871348f},
-std::array<float,2>{0.310878336f, 0.405816585f},
-std::array<float,2>{0.640165031f, 0.690586269f},
-std::array<float,2>{0.41454947f, 0.56581229f},
-std::array<float,2>{0.613114178f, 0.279120803f},
-std::array<float,2>{0.124340065f, 0.0658156797f},
-std::array<float,2>{0.826213896f, 0.947769403f},
-std::array<float,2>{0.0235084444f, 0.665230155f},
-std::array<float,2>{0.767345726f, 0.461747289f},
-std::array<float,2>{0.442984521f, 0.213204712f},
-std::array<float,2>{0.520186782f, 0.861965001f},
-std::array<float,2>{0.33635959f, 0.897781014f},
-std::array<float,2>{0.712058306f, 0.0543020107f},
-std::array<float,2>{0.152786031f, 0.333361417f},
-std::array<float,2>{0.974772453f, 0.512663007f},
-std::array<float,2>{0.0601402298f, 0.843832731f},
-std::array<float,2>{0.797313273f, 0.197948039f},
-std::array<float,2>{0.48536548f, 0.450547248f},
-std::array<float,2>{0.543025553f, 0.678761363f},
-std::array<float,2>{0.356468379f, 0.523254871f},
-std::array<float,2>{0.738503754f, 0.312763005f},
-std::array<float,2>{0.183524519f, 0.0366784707f},
-std::array<float,2>{0.959797263f, 0.883240104f},
-std::array<float,2>{0.223744586f, 0.7163077f},
-std::array<float,2>{0.917632103f, 0.375006586f},
-std::array<float,2>{0.266414106f, 0.169043571f},
-std::array<float,2>{0.66356504f, 0.802019417f},
-std::array<float,2>{0.405626655f, 0.965446889f},
-std::array<float,2>{0.592676878f, 0.0890555382f},
-std::array<float,2>{0.0705605f, 0.253428519f},
-std::array<float,2>{0.860547006f, 0.587319732f},
-std::array<float,2>{0.137477934f, 0.911454678f},
-std::array<float,2>{0.99135828f, 0.011539151f},
-std::array<float,2>{0.31829524f, 0.356784523f},
-std::array<float,2>{0.695080876f, 0.532890916f},
-std::array<float,2>{0.454525083f, 0.633460879f},
-std::array<float,2>{0.504865766f, 0.473581403f},
-std::array<float,2>{0.00250527496f, 0.240032881f},
-std::array<float,2>{0.752432644f, 0.833574116f},
-std::array<float,2>{0.0987557396f, 0.602660954f},
-std::array<float,2>{0.830674827f, 0.299994946f},
-std::array<float,2>{0.426107854f, 0.118245423f},
-std::array<float,2>{0.597579241f, 0.981423736f},
-std::array<float,2>{0.289415389f, 0.766534269f},
-std::array<float,2>{0.653992951f, 0.126930833f},
-std::array<float,2>{0.217145279f, 0.40888834f},
-std::array<float,2>{0.893584788f, 0.723071396f},
-std::array<float,2>{0.105723202f, 0.93736124f},
-std::array<float,2>{0.836026907f, 0.018354807f},
-std::array<float,2>{0.432697624f, 0.371359289f},
-std::array<float,2>{0.60671562f, 0.560641766f},
-std::array<float,2>{0.286389202f, 0.654657722f},
-std::array<float,2>{0.642054498f, 0.496434152f},
-std::array<float,2>{0.203649178f, 0.233272254f},
-std::array<float,2>{0.903979123f, 0.819648862f},
-std::array<float,2>{0.130863428f, 0.619357467f},
-std::array<float,2>{0.992881835f, 0.293154687f},
-std::array<float,2>{0.322844207f, 0.10677214f},
-std::array<float,2>{0.697637439f, 0.9872545f},
-std::array<float,2>{0.467633635f, 0.754686773f},
-std::array<float,2>{0.514834046f, 0.142163843f},
-std::array<float,2>{0.0151021834f, 0.436835587f},
-std::array<float,2>{0.758383751f, 0.745632172f},
-std::array<float,2>{0.231405094f, 0.86716032f},
-std::array<float,2>{0.908244193f, 0.216040313f},
-std::array<float,2>{0.275974631f, 0.4682675f},
-std::array<float,2>{0.671076834f, 0.671155751f},
-std::array<float,2>{0.397887498f, 0.510855198f},
-std::array<float,2>{0.581019282f, 0.329131275f},
-std::array<float,2>{0.067694068f, 0.0494527929f},
-std::array<float,2>{0.874782145f, 0.893989563f},
-std::array<float,2>{0.0489672795f, 0.693167269f},
-std::array<float,2>{0.812479198f, 0.399759203f},
-std::array<float,2>{0.497859776f, 0.181395903f},
-std::array<float,2>{0.538739264f, 0.786679685f},
-std::array<float,2>{0.349376678f, 0.94942987f},
-std::array<float,2>{0.749476373f, 0.0684509724f},
-std::array<float,2>{0.175544977f, 0.276062965f},
-std::array<float,2>{0.967419446f, 0.569368005f},
-std::array<float,2>{0.018441109f, 0.796960115f},
-std::array<float,2>{0.77977109f, 0.164200693f},
-std::array<float,2>{0.451495677f, 0.382756948f},
-std::array<float,2>{0.530752718f, 0.712439895f},
-std::array<float,2>{0.333468586f, 0.590781689f},
-std::array<float,2>{0.705463886f, 0.255510777f},
-std::array<float,2>{0.143367961f, 0.0905538276f},
-std::array<float,2>{0.977194428f, 0.961983562f},
-std::array<float,2>{0.195889518f, 0.672852933f},
-std::array<float,2>{0.878349483f, 0.446582288f},
-std::array<float,2>{0.297406077f, 0.201613501f},
-std::array<float,2>{0.629595339f, 0.850437224f},
-std::array<float,2>{0.408987224f, 0.88854146f},
-std::array<float,2>{0.621109664f, 0.0336083397f},
-std::array<float,2>{0.113478296f, 0.31908679f},
-std::array<float,2>{0.81460464f, 0.515852273f},
-std::array<float,2>{0.171199113f, 0.977268934f},
-std::array<float,2>{0.952369094f, 0.121451221f},
-std::array<float,2>{0.371381313f, 0.304384619f},
-std::array<float,2>{0.729121029f, 0.607471764f},
-std::array<float,2>{0.480648547f, 0.722016513f},
-std::array<float,2>{0.548060775f, 0.41399771f},
-std::array<float,2>{0.0317570791f, 0.1322667f},
-std::array<float,2>{0.788946271f, 0.769739747f},
-std::array<float,2>{0.0914241001f, 0.535391569f},
-std::array<float,2>{0.853604794f, 0.351730227f},
-std::array<float,2>{0.377669096f, 0.0126946364f},
-std::array<float,2>{0.571239591f, 0.906807065f},
-std::array<float,2>{0.252950579f, 0.830679953f},
-std::array<float,2>{0.676840842f, 0.235535353f},
-std::array<float,2>{0.249669716f, 0.471740097f},
-std::array<float,2>{0.924290836f, 0.637524962f},
-std::array<float,2>{0.0451014973f, 0.954356194f},
-std::array<float,2>{0.795309663f, 0.0818243995f},
-std::array<float,2>{0.476119101f, 0.262975961f},
-std::array<float,2>{0.55749619f, 0.582321227f},
-std::array<float,2>{0.366677582f, 0.709002674f},
-std::array<float,2>{0.725324869f, 0.384042352f},
-std::array<float,2>{0.163341403f, 0.159023464f},
-std::array<float,2>{0.938144863f, 0.806038976f},
-std::array<float,2>{0.23903586f, 0.525638759f},
-std::array<float,2>{0.931806326f, 0.322600454f},
-std::array<float,2>{0.25834465f, 0.0391869694f},
-std::array<float,2>{0.685781002f, 0.882199347f},
-std::array<float,2>{0.384937048f, 0.854662895f},
-std::array<float,2>{0.568532109f, 0.189632893f},
-std::array<float,2>{0.0792883858f, 0.439742237f},
-std::array<float,2>{0.847693801f, 0.68251878f},
-std::array<float,2>{0.151828542f, 0.776804328f},
-std::array<float,2>{0.971655548f, 0.135672212f},
-std::array<float,2>{0.34143126f, 0.414356619f},
-std::array<float,2>{0.715964019f, 0.72668016f},
-std::array<float,2>{0.437670052f, 0.59388864f},
-std::array<float,2>{0.516664982f, 0.311390013f},
-std::array<float,2>{0.0292859189f, 0.112228043f},
-std::array<float,2>{0.770173132f, 0.975273132f},
-std::array<float,2>{0.11743623f, 0.630662382f},
-std::array<float,2>{0.821909666f, 0.483900338f},
-std::array<float,2>{0.421816438f, 0.248105168f},
-std::array<float,2>{0.614982903f, 0.839920759f},
-std::array<float,2>{0.305576682f, 0.919551492f},
-std::array<float,2>{0.634347618f, 0.00552521786f},
-std::array<float,2>{0.192086414f, 0.347533315f},
-std::array<float,2>{0.890532196f, 0.539322376f},
-std::array<float,2>{0.0776842237f, 0.823403597f},
-std::array<float,2>{0.865162075f, 0.225333229f},
-std::array<float,2>{0.399267107f, 0.491881877f},
-std::array<float,2>{0.586448967f, 0.64078331f},
-std::array<float,2>{0.271268845f, 0.551716745f},
-std::array<float,2>{0.65832454f, 0.360673934f},
-std::array<float,2>{0.222365767f, 0.0259248521f},
-std::array<float,2>{0.918142974f, 0.923887491f},
-std::array<float,2>{0.184067637f, 0.734908581f},
-std::array<float,2>{0.95395273f, 0.422588587f},
-std::array<float,2>{0.353779316f, 0.152170599f},
-std::array<float,2>{0.734908998f, 0.765571237f},
-std::array<float,2>{0.491832882f, 0.997148514f},
-std::array<float,2>{0.540415645f, 0.0964976251f},
-std::array<float,2>{0.0567337126f, 0.288446546f},
-std::array<float,2>{0.804466724f, 0.610669851f},
-std::array<float,2>{0.211162418f, 0.899091065f},
-std::array<float,2>{0.896198213f, 0.0591973215f},
-std::array<float,2>{0.294998765f, 0.342258632f},
-std::array<float,2>{0.650426269f, 0.505377531f},
-std::array<float,2>{0.421914339f, 0.66076982f},
-std::array<float,2>{0.599246025f, 0.457275569f},
-std::array<float,2>{0.0947534144f, 0.206671476f},
-std::array<float,2>{0.833941936f, 0.870156884f},
-std::array<float,2>{0.00649874983f, 0.577995002f},
-std::array<float,2>{0.757166326f, 0.272284955f},
-std::array<float,2>{0.457306504f, 0.0710174292f},
-std::array<float,2>{0.500914872f, 0.943362355f},
-std::array<float,2>{0.315206826f, 0.793796539f},
-std::array<float,2>{0.691114545f, 0.176323116f},
-std::array<float,2>{0.133317381f, 0.3923724f},
-std::array<float,2>{0.984898627f, 0.698071301f},
-std::array<float,2>{0.0526226722f, 0.917077065f},
-std::array<float,2>{0.808424771f, 0.00270606065f},
-std::array<float,2>{0.493365258f, 0.347975284f},
-std::array<float,2>{0.534216404f, 0.545881748f},
-std::array<float,2>{0.344436586f, 0.625080109f},
-std::array<float,2>{0.744284928f, 0.479553252f},
-std::array<float,2>{0.177894905f, 0.244165584f},
-std::array<float,2>{0.961977422f, 0.83693105f},
-std::array<float,2>{0.22685118f, 0.599267304f},
-std::array<float,2>{0.911591887f, 0.307472318f},
-std::array<float,2>{0.279050738f, 0.11379052f},
-std::array<float,2>{0.665848672f, 0.972343802f},
-std::array<float,2>{0.393195957f, 0.778988838f},
-std::array<float,2>{0.582460344f, 0.136849836f},
-std::array<float,2>{0.0653468072f, 0.421151578f},
-std::array<float,2>{0.867950857f, 0.732480109f},
-std::array<float,2>{0.126371413f, 0.857588887f},
-std::array<float,2>{0.998809516f, 0.191520721f},
-std::array<float,2>{0.324669957f, 0.441836476f},
-std::array<float,2>{0.70258975f, 0.684811532f},
-std::array<float,2>{0.461932987f, 0.530413508f},
-std::array<float,2>{0.511599064f, 0.327358782f},
-std::array<float,2>{0.0105776489f, 0.0447920263f},
-std::array<float,2>{0.764048636f, 0.875203371f},
-std::array<float,2>{0.105008803f, 0.703959405f},
-std::array<float,2>{0.842821777f, 0.387702078f},
-std::array<float,2>{0.435638338f, 0.161243528f},
-std::array<float,2>{0.602128506f, 0.81072253f},
-std::array<float,2>{0.282229304f, 0.960221827f},
-std::array<float,2>{0.647378564f, 0.0829443485f},
-std::array<float,2>{0.207400069f, 0.260555059f},
-std::array<float,2>{0.899560153f, 0.579042852f},
-std::array<float,2>{0.087070249f, 0.791271448f},
-std::array<float,2>{0.858412743f, 0.171953186f},
-std::array<float,2>{0.380381405f, 0.398421794f},
-std::array<float,2>{0.575766802f, 0.701715529f},
-std::array<float,2>{0.25465101f, 0.573006451f},
-std::array<float,2>{0.67481339f, 0.268320173f},
-std::array<float,2>{0.245765582f, 0.0773596019f},
-std::array<float,2>{0.928817213f, 0.937993586f},
-std::array<float,2>{0.164793864f, 0.659771025f},
-std::array<float,2>{0.948421061f, 0.456965983f},
-std::array<float,2>{0.36880365f, 0.20731017f},
-std::array<float,2>{0.73151952f, 0.872548997f},
-std::array<float,2>{0.48045218f, 0.905315638f},
-std::array<float,2>{0.554397821f, 0.0566196144f},
-std::array<float,2>{0.0390103646f, 0.336876988f},
-std::array<float,2>{0.782233f, 0.502310872f},
-std::array<float,2>{0.200143814f, 0.994032621f},
-std::array<float,2>{0.880104899f, 0.0984368697f},
-std::array<float,2>{0.304056704f, 0.281895369f},
-std::array<float,2>{0.62706089f, 0.615528464f},
-std::array<float,2>{0.411186039f, 0.741262674f},
-std::array<float,2>{0.618267655f, 0.427256823f},
-std::array<float,2>{0.113085158f, 0.155033633f},
-std::array<float,2>{0.819559455f, 0.76038897f},
-std::array<float,2>{0.0219246242f, 0.549883962f},
-std::array<float,2>{0.776965976f, 0.366830438f},
-std::array<float,2>{0.448820263f, 0.0287926625f},
-std::array<float,2>{0.52643168f, 0.926743567f},
-std::array<float,2>{0.331584722f, 0.826351285f},
-std::array<float,2>{0.707051814f, 0.219294563f},
-std::array<float,2>{0.148244739f, 0.487600446f},
-std::array<float,2>{0.981334686f, 0.645581484f},
-std::array<float,2>{0.122640088f, 0.946904182f},
-std::array<float,2>{0.824921012f, 0.0644006953f},
-std::array<float,2>{0.417675704f, 0.280837327f},
-std::array<float,2>{0.609452784f, 0.563976884f},
-std::array<float,2>{0.310397536f, 0.689087152f},
-std::array<float,2>{0.638071239f, 0.403400958f},
-std::array<float,2>{0.190439999f, 0.184980735f},
-std::array<float,2>{0.886688948f, 0.783648193f},
-std::array<float,2>{0.155277267f, 0.514702559f},
-std::array<float,2>{0.972873628f, 0.334548354f},
-std::array<float,2>{0.339220554f, 0.0523051918f},
-std::array<float,2>{0.713150799f, 0.895455539f},
-std::array<float,2>{0.445126802f, 0.859389603f},
-std::array<float,2>{0.521824002f, 0.212330565f},
-std::array<float,2>{0.0273404289f, 0.463208824f},
-std::array<float,2>{0.768448949f, 0.666629553f},
-std::array<float,2>{0.236146048f, 0.753091037f},
-std::array<float,2>{0.93471235f, 0.146435887f},
-std::array<float,2>{0.264842242f, 0.431877166f},
-std::array<float,2>{0.682196558f, 0.749997199f},
-std::array<float,2>{0.388496101f, 0.624314725f},
-std::array<float,2>{0.566205025f, 0.292963028f},
-std::array<float,2>{0.0823394805f, 0.101662926f},
-std::array<float,2>{0.845113099f, 0.990208745f},
-std::array<float,2>{0.0414882414f, 0.651351511f},
-std::array<float,2>{0.792023957f, 0.493099868f},
-std::array<float,2>{0.469911903f, 0.2284403f},
-std::array<float,2>{0.560637534f, 0.81283772f},
-std::array<float,2>{0.361928165f, 0.931948781f},
-std::array<float,2>{0.720452368f, 0.0197394323f},
-std::array<float,2>{0.16002281f, 0.368286252f},
-std::array<float,2>{0.944736898f, 0.556678653f},
-std::array<float,2>{0.00185142481f, 0.834828615f},
-std::array<float,2>{0.750385404f, 0.240400791f},
-std::array<float,2>{0.455971569f, 0.476488739f},
-std::array<float,2>{0.507188976f, 0.636128426f},
-std::array<float,2>{0.320180565f, 0.533435881f},
-std::array<float,2>{0.692126691f, 0.358318448f},
-std::array<float,2>{0.14027901f, 0.0097359689f},
-std::array<float,2>{0.990182102f, 0.912297666f},
-std::array<float,2>{0.215495571f, 0.724762619f},
-std::array<float,2>{0.892065406f, 0.40674904f},
-std::array<float,2>{0.292764366f, 0.127824679f},
-std::array<float,2>{0.654400647f, 0.769069731f},
-std::array<float,2>{0.428667784f, 0.982961535f},
-std::array<float,2>{0.595382333f, 0.120890215f},
-std::array<float,2>{0.100976296f, 0.298135072f},
-std::array<float,2>{0.828378618f, 0.604841471f},
-std::array<float,2>{0.180366307f, 0.886603594f},
-std::array<float,2>{0.957463503f, 0.0378399454f},
-std::array<float,2>{0.359007329f, 0.315267444f},
-std::array<float,2>{0.741944015f, 0.519996524f},
-std::array<float,2>{0.487559438f, 0.676021814f},
-std::array<float,2>{0.545083404f, 0.452523381f},
-std::array<float,2>{0.0623480305f, 0.195601657f},
-std::array<float,2>{0.799017847f, 0.846476018f},
-std::array<float,2>{0.0739448667f, 0.588828862f},
-std::array<float,2>{0.861599088f, 0.2508066f},
-std::array<float,2>{0.403754592f, 0.0859963745f},
-std::array<float,2>{0.591371715f, 0.968641698f},
-std::array<float,2>{0.267962247f, 0.803456604f},
-std::array<float,2>{0.66205287f, 0.170728713f},
-std::array<float,2>{0.226558834f, 0.377138704f},
-std::array<float,2>{0.915326476f, 0.717623413f},
-std::array<float,2>{0.0700424314f, 0.890939474f},
-std::array<float,2>{0.872716546f, 0.0477555543f},
-std::array<float,2>{0.394626409f, 0.331479102f},
-std::array<float,2>{0.579520464f, 0.508599937f},
-std::array<float,2>{0.274748385f, 0.668017745f},
-std::array<float,2>{0.668200672f, 0.466391206f},
-std::array<float,2>{0.233973518f, 0.21784471f},
-std::array<float,2>{0.9062621f, 0.864055872f},
-std::array<float,2>{0.173671529f, 0.567818701f},
-std::array<float,2>{0.96647352f, 0.275267869f},
-std::array<float,2>{0.350510448f, 0.0675871074f},
-std::array<float,2>{0.747463048f, 0.952712417f},
-std::array<float,2>{0.498943418f, 0.788839042f},
-std::array<float,2>{0.536156476f, 0.18200244f},
-std::array<float,2>{0.0484658703f, 0.401814729f},
-std::array<float,2>{0.809836805f, 0.695140183f},
-std::array<float,2>{0.205352619f, 0.816428542f},
-std::array<float,2>{0.906089306f, 0.231599897f},
-std::array<float,2>{0.288973331f, 0.498448163f},
-std::array<float,2>{0.643729925f, 0.654208183f},
-std::array<float,2>{0.431057423f, 0.559718966f},
-std::array<float,2>{0.608613908f, 0.373329669f},
-std::array<float,2>{0.107624494f, 0.0171118528f},
-std::array<float,2>{0.839551747f, 0.93425709f},
-std::array<float,2>{0.0135351857f, 0.742773712f},
-std::array<float,2>{0.761426389f, 0.433781981f},
-std::array<float,2>{0.46553421f, 0.144345924f},
-std::array<float,2>{0.512372077f, 0.756137967f},
-std::array<float,2>{0.320917279f, 0.98537004f},
-std::array<float,2>{0.696459651f, 0.108398035f},
-std::array<float,2>{0.130568057f, 0.296293288f},
-std::array<float,2>{0.995897949f, 0.618515193f},
-std::array<float,2>{0.0343525894f, 0.771804333f},
-std::array<float,2>{0.785805643f, 0.129387736f},
-std::array<float,2>{0.483416408f, 0.41119495f},
-std::array<float,2>{0.549337864f, 0.719983459f},
-std::array<float,2>{0.374005497f, 0.605735242f},
-std::array<float,2>{0.72681123f, 0.302200139f},
-std::array<float,2>{0.169079855f, 0.123885885f},
-std::array<float,2>{0.950645149f, 0.980340362f},
-std::array<float,2>{0.247808903f, 0.64014262f},
-std::array<float,2>{0.922428548f, 0.469617546f},
-std::array<float,2>{0.25158909f, 0.238060907f},
-std::array<float,2>{0.679287851f, 0.828945875f},
-std::array<float,2>{0.375648469f, 0.908385158f},
-std::array<float,2>{0.573868513f, 0.0151731316f},
-std::array<float,2>{0.0934075341f, 0.354730159f},
-std::array<float,2>{0.851891756f, 0.537219822f},
-std::array<float,2>{0.141014278f, 0.964488685f},
-std::array<float,2>{0.979800701f, 0.0932204947f},
-std::array<float,2>{0.335328013f, 0.255910158f},
-std::array<float,2>{0.703668952f, 0.591808617f},
-std::array<float,2>{0.450322002f, 0.714112878f},
-std::array<float,2>{0.528666377f, 0.379005164f},
-std::array<float,2>{0.01663878f, 0.167644039f},
-std::array<float,2>{0.779294014f, 0.799989879f},
-std::array<float,2>{0.115282521f, 0.519455135f},
-std::array<float,2>{0.813954771f, 0.318323642f},
-std::array<float,2>{0.406441897f, 0.0322036035f},
-std::array<float,2>{0.623400986f, 0.889623821f},
-std::array<float,2>{0.300292969f, 0.848702967f},
-std::array<float,2>{0.630904973f, 0.200455815f},
-std::array<float,2>{0.198434189f, 0.448792875f},
-std::array<float,2>{0.876518846f, 0.675451398f},
-std::array<float,2>{0.0305392426f, 0.972744823f},
-std::array<float,2>{0.772012472f, 0.110795267f},
-std::array<float,2>{0.439667672f, 0.310535252f},
-std::array<float,2>{0.518030167f, 0.596408486f},
-std::array<float,2>{0.342177749f, 0.728768587f},
-std::array<float,2>{0.717325032f, 0.416702509f},
-std::array<float,2>{0.149218187f, 0.13389504f},
-std::array<float,2>{0.968986571f, 0.774119616f},
-std::array<float,2>{0.194928765f, 0.542493582f},
-std::array<float,2>{0.88772583f, 0.345173776f},
-std::array<float,2>{0.306974173f, 0.00701819872f},
-std::array<float,2>{0.636361718f, 0.920266688f},
-std::array<float,2>{0.418638676f, 0.841980517f},
-std::array<float,2>{0.616621912f, 0.246295869f},
-std::array<float,2>{0.120451368f, 0.480633199f},
-std::array<float,2>{0.823440492f, 0.632033646f},
-std::array<float,2>{0.160462469f, 0.807563663f},
-std::array<float,2>{0.940071404f, 0.157883629f},
-std::array<float,2>{0.364341944f, 0.386187017f},
-std::array<float,2>{0.722905457f, 0.708206534f},
-std::array<float,2>{0.473518431f, 0.585087359f},
-std::array<float,2>{0.556206167f, 0.263984919f},
-std::array<float,2>{0.0431164131f, 0.0781770274f},
-std::array<float,2>{0.793356538f, 0.955350578f},
-std::array<float,2>{0.0808704421f, 0.680980623f},
-std::array<float,2>{0.850682914f, 0.437710583f},
-std::array<float,2>{0.383771807f, 0.188228518f},
-std::array<float,2>{0.56813997f, 0.852752328f},
-std::array<float,2>{0.25993675f, 0.879375815f},
-std::array<float,2>{0.684873581f, 0.0411146879f},
-std::array<float,2>{0.240663961f, 0.321943909f},
-std::array<float,2>{0.92998004f, 0.524142265f},
-std::array<float,2>{0.0961924642f, 0.868299305f},
-std::array<float,2>{0.834283113f, 0.205055997f},
-std::array<float,2>{0.424558908f, 0.459118038f},
-std::array<float,2>{0.600617886f, 0.663122356f},
-std::array<float,2>{0.293973982f, 0.507525682f},
-std::array<float,2>{0.649109602f, 0.34171021f},
-std::array<float,2>{0.212939337f, 0.0615430698f},
-std::array<float,2>{0.89840591f, 0.90095228f},
-std::array<float,2>{0.135968328f, 0.696929038f},
-std::array<float,2>{0.987817168f, 0.393247902f},
-std::array<float,2>{0.313908398f, 0.178220883f},
-std::array<float,2>{0.689203918f, 0.795583844f},
-std::array<float,2>{0.460227817f, 0.94143784f},
-std::array<float,2>{0.503036082f, 0.0730162561f},
-std::array<float,2>{0.0047041853f, 0.270101577f},
-std::array<float,2>{0.754151642f, 0.574771702f},
-std::array<float,2>{0.218811855f, 0.923322976f},
-std::array<float,2>{0.920317829f, 0.0253428929f},
-std::array<float,2>{0.273426145f, 0.361388057f},
-std::array<float,2>{0.656568646f, 0.553801656f},
-std::array<float,2>{0.40072614f, 0.642695606f},
-std::array<float,2>{0.587916017f, 0.489908755f},
-std::array<float,2>{0.07446336f, 0.223132491f},
-std::array<float,2>{0.866972268f, 0.821473539f},
-std::array<float,2>{0.0565233938f, 0.61281544f},
-std::array<float,2>{0.800901115f, 0.286205679f},
-std::array<float,2>{0.490072876f, 0.0939170495f},
-std::array<float,2>{0.541759551f, 0.999522865f},
-std::array<float,2>{0.352250963f, 0.762593508f},
-std::array<float,2>{0.736670613f, 0.149713352f},
-std::array<float,2>{0.186748236f, 0.42446211f},
-std::array<float,2>{0.957014501f, 0.736649871f},
-std::array<float,2>{0.00212978525f, 0.912622452f},
-std::array<float,2>{0.75271529f, 0.00914487243f},
-std::array<float,2>{0.454979897f, 0.357726872f},
-std::array<float,2>{0.504154325f, 0.533860028f},
-std::array<float,2>{0.317737401f, 0.636551678f},
-std::array<float,2>{0.694528103f, 0.475878775f},
-std::array<float,2>{0.136880457f, 0.240925193f},
-std::array<float,2>{0.991981566f, 0.834031701f},
-std::array<float,2>{0.217704594f, 0.605314732f},
-std::array<float,2>{0.894208372f, 0.298437685f},
-std::array<float,2>{0.289563656f, 0.120414734f},
-std::array<float,2>{0.653321087f, 0.982743919f},
-std::array<float,2>{0.426451683f, 0.768615842f},
-std::array<float,2>{0.596973836f, 0.126978174f},
-std::array<float,2>{0.0992136896f, 0.406291515f},
-std::array<float,2>{0.830314755f, 0.725108802f},
-std::array<float,2>{0.182841778f, 0.84613353f},
-std::array<float,2>{0.959232152f, 0.196269378f},
-std::array<float,2>{0.35731408f, 0.452729523f},
-std::array<float,2>{0.738854468f, 0.676386714f},
-std::array<float,2>{0.485922813f, 0.520029545f},
-std::array<float,2>{0.543537974f, 0.31469202f},
-std::array<float,2>{0.0598504692f, 0.0375066102f},
-std::array<float,2>{0.797786593f, 0.886197984f},
-std::array<float,2>{0.0711841956f, 0.717004359f},
-std::array<float,2>{0.861139894f, 0.377861589f},
-std::array<float,2>{0.406214833f, 0.169935539f},
-std::array<float,2>{0.591923773f, 0.802844703f},
-std::array<float,2>{0.265999079f, 0.967821002f},
-std::array<float,2>{0.663892686f, 0.0865286961f},
-std::array<float,2>{0.224157542f, 0.250440091f},
-std::array<float,2>{0.917265892f, 0.588307142f},
-std::array<float,2>{0.124721736f, 0.783721507f},
-std::array<float,2>{0.826725185f, 0.185197636f},
-std::array<float,2>{0.414670825f, 0.404034823f},
-std::array<float,2>{0.61250782f, 0.688497365f},
-std::array<float,2>{0.31110388f, 0.563571453f},
-std::array<float,2>{0.640049517f, 0.280348957f},
-std::array<float,2>{0.187519521f, 0.0637803376f},
-std::array<float,2>{0.883943617f, 0.946426809f},
-std::array<float,2>{0.152836174f, 0.666161239f},
-std::array<float,2>{0.975342512f, 0.463611633f},
-std::array<float,2>{0.336527735f, 0.212864086f},
-std::array<float,2>{0.712688267f, 0.860007823f},
-std::array<float,2>{0.442724407f, 0.894787371f},
-std::array<float,2>{0.519785941f, 0.0519172214f},
-std::array<float,2>{0.0239776131f, 0.33441028f},
-std::array<float,2>{0.767076015f, 0.515440404f},
-std::array<float,2>{0.237612784f, 0.989709854f},
-std::array<float,2>{0.936909258f, 0.102410398f},
-std::array<float,2>{0.263047159f, 0.292403698f},
-std::array<float,2>{0.680654049f, 0.624906301f},
-std::array<float,2>{0.389287502f, 0.749157369f},
-std::array<float,2>{0.564023793f, 0.432407439f},
-std::array<float,2>{0.084538579f, 0.145852849f},
-std::array<float,2>{0.846965551f, 0.753739893f},
-std::array<float,2>{0.0402266271f, 0.557224214f},
-std::array<float,2>{0.789767563f, 0.36874029f},
-std::array<float,2>{0.47151041f, 0.0203360319f},
-std::array<float,2>{0.559939623f, 0.932182789f},
-std::array<float,2>{0.360845089f, 0.81346339f},
-std::array<float,2>{0.722543061f, 0.227683976f},
-std::array<float,2>{0.157400966f, 0.492450207f},
-std::array<float,2>{0.941976726f, 0.650422215f},
-std::array<float,2>{0.0898192525f, 0.937955499f},
-std::array<float,2>{0.856446743f, 0.0778059289f},
-std::array<float,2>{0.38096866f, 0.267711818f},
-std::array<float,2>{0.577526391f, 0.572671771f},
-std::array<float,2>{0.256733835f, 0.701479554f},
-std::array<float,2>{0.673129976f, 0.397857904f},
-std::array<float,2>{0.243465737f, 0.172769204f},
-std::array<float,2>{0.926445186f, 0.791781843f},
-std::array<float,2>{0.167749852f, 0.502819777f},
-std::array<float,2>{0.945453227f, 0.336157918f},
-std::array<float,2>{0.369437486f, 0.055845499f},
-std::array<float,2>{0.732907832f, 0.905777991f},
-std::array<float,2>{0.478507966f, 0.873039603f},
-std::array<float,2>{0.551885903f, 0.207963198f},
-std::array<float,2>{0.0369347893f, 0.456434876f},
-std::array<float,2>{0.783727586f, 0.65951103f},
-std::array<float,2>{0.202911407f, 0.759789884f},
-std::array<float,2>{0.881368458f, 0.15468955f},
-std::array<float,2>{0.302103698f, 0.426870435f},
-std::array<float,2>{0.626584709f, 0.741883934f},
-std::array<float,2>{0.412704587f, 0.615723252f},
-std::array<float,2>{0.619881868f, 0.281685144f},
-std::array<float,2>{0.111043938f, 0.0980115086f},
-std::array<float,2>{0.818086207f, 0.993329346f},
-std::array<float,2>{0.0212479327f, 0.646321118f},
-std::array<float,2>{0.774478376f, 0.487969905f},
-std::array<float,2>{0.446093947f, 0.218824014f},
-std::array<float,2>{0.52397424f, 0.826753318f},
-std::array<float,2>{0.329244316f, 0.925927401f},
-std::array<float,2>{0.709624588f, 0.0290761795f},
-std::array<float,2>{0.146005452f, 0.366602987f},
-std::array<float,2>{0.982761502f, 0.550520122f},
-std::array<float,2>{0.0544744171f, 0.837430835f},
-std::array<float,2>{0.805770874f, 0.244887382f},
-std::array<float,2>{0.494373232f, 0.480400652f},
-std::array<float,2>{0.531526744f, 0.625504136f},
-std::array<float,2>{0.346933782f, 0.544971049f},
-std::array<float,2>{0.742676258f, 0.348393381f},
-std::array<float,2>{0.177495807f, 0.00230057561f},
-std::array<float,2>{0.963991106f, 0.917512536f},
-std::array<float,2>{0.230066836f, 0.73319906f},
-std::array<float,2>{0.912189305f, 0.421451151f},
-std::array<float,2>{0.28119126f, 0.137625679f},
-std::array<float,2>{0.667237699f, 0.778511226f},
-std::array<float,2>{0.390636861f, 0.972038448f},
-std::array<float,2>{0.585708261f, 0.113307714f},
-std::array<float,2>{0.0636067763f, 0.306738943f},
-std::array<float,2>{0.869396687f, 0.598807812f},
-std::array<float,2>{0.127271205f, 0.875897765f},
-std::array<float,2>{0.996822119f, 0.0443955325f},
-std::array<float,2>{0.327584237f, 0.328008413f},
-std::array<float,2>{0.700903535f, 0.530905426f},
-std::array<float,2>{0.463292032f, 0.685321391f},
-std::array<float,2>{0.508541048f, 0.441977084f},
-std::array<float,2>{0.009605553f, 0.191951528f},
-std::array<float,2>{0.76172787f, 0.858364344f},
-std::array<float,2>{0.101968303f, 0.578283846f},
-std::array<float,2>{0.841289163f, 0.259999275f},
-std::array<float,2>{0.435465842f, 0.0821757838f},
-std::array<float,2>{0.603719354f, 0.960754573f},
-std::array<float,2>{0.283218771f, 0.811191022f},
-std::array<float,2>{0.644671202f, 0.161927044f},
-std::array<float,2>{0.210598707f, 0.388441741f},
-std::array<float,2>{0.901165962f, 0.703449667f},
-std::array<float,2>{0.0952201262f, 0.90072608f},
-std::array<float,2>{0.833198667f, 0.0623308457f},
-std::array<float,2>{0.422643095f, 0.341295719f},
-std::array<float,2>{0.598858237f, 0.507101059f},
-std::array<float,2>{0.29569149f, 0.663957238f},
-std::array<float,2>{0.651197851f, 0.459692925f},
-std::array<float,2>{0.21154438f, 0.204315528f},
-std::array<float,2>{0.895933032f, 0.869108915f},
-std::array<float,2>{0.132958069f, 0.574311912f},
-std::array<float,2>{0.984403729f, 0.269908458f},
-std::array<float,2>{0.314688474f, 0.0724175125f},
-std::array<float,2>{0.690474987f, 0.942073584f},
-std::array<float,2>{0.457985997f, 0.795075715f},
-std::array<float,2>{0.500227451f, 0.178303227f},
-std::array<float,2>{0.00596622378f, 0.392996728f},
-std::array<float,2>{0.757354915f, 0.696300268f},
-std::array<float,2>{0.222137719f, 0.82204771f},
-std::array<float,2>{0.918575823f, 0.223208964f},
-std::array<float,2>{0.270733476f, 0.489666611f},
-std::array<float,2>{0.658862591f, 0.643390834f},
-std::array<float,2>{0.398543954f, 0.554447532f},
-std::array<float,2>{0.586270511f, 0.362238348f},
-std::array<float,2>{0.0775956064f, 0.0248047858f},
-std::array<float,2>{0.864442408f, 0.92343086f},
-std::array<float,2>{0.0575645529f, 0.737247825f},
-std::array<float,2>{0.803845882f, 0.424104184f},
-std::array<float,2>{0.491630107f, 0.149954841f},
-std::array<float,2>{0.540993869f, 0.761802316f},
-std::array<float,2>{0.354265332f, 0.999334872f},
-std::array<float,2>{0.734543741f, 0.0944619849f},
-std::array<float,2>{0.184457913f, 0.287064075f},
-std::array<float,2>{0.95317167f, 0.612646997f},
-std::array<float,2>{0.0286441538f, 0.773467422f},
-std::array<float,2>{0.769715667f, 0.134314314f},
-std::array<float,2>{0.438084155f, 0.416350693f},
-std::array<float,2>{0.517473459f, 0.729036331f},
-std::array<float,2>{0.341139942f, 0.595777988f},
-std::array<float,2>{0.716384411f, 0.309638411f},
-std::array<float,2>{0.151900262f, 0.110896029f},
-std::array<float,2>{0.971107066f, 0.973534405f},
-std::array<float,2>{0.191553488f, 0.632381856f},
-std::array<float,2>{0.889841378f, 0.481049746f},
-std::array<float,2>{0.305003494f, 0.246960565f},
-std::array<float,2>{0.63423717f, 0.842741847f},
-std::array<float,2>{0.42128697f, 0.920724452f},
-std::array<float,2>{0.614656329f, 0.00773368962f},
-std::array<float,2>{0.118124425f, 0.345284611f},
-std::array<float,2>{0.82134819f, 0.542148709f},
-std::array<float,2>{0.163704708f, 0.955567718f},
-std::array<float,2>{0.937518418f, 0.0786509141f},
-std::array<float,2>{0.367092162f, 0.264466137f},
-std::array<float,2>{0.724774718f, 0.585829437f},
-std::array<float,2>{0.475613624f, 0.708931684f},
-std::array<float,2>{0.556717992f, 0.386474699f},
-std::array<float,2>{0.0458490923f, 0.157625616f},
-std::array<float,2>{0.795592964f, 0.806956172f},
-std::array<float,2>{0.0799380839f, 0.52367866f},
-std::array<float,2>{0.848587155f, 0.32131514f},
-std::array<float,2>{0.385299116f, 0.0418444648f},
-std::array<float,2>{0.569042027f, 0.879522383f},
-std::array<float,2>{0.258046687f, 0.853392839f},
-std::array<float,2>{0.686437249f, 0.187758982f},
-std::array<float,2>{0.238695711f, 0.438180208f},
-std::array<float,2>{0.932589829f, 0.681601703f},
-std::array<float,2>{0.0316617079f, 0.979923308f},
-std::array<float,2>{0.788561404f, 0.123286486f},
-std::array<float,2>{0.481104791f, 0.302654803f},
-std::array<float,2>{0.548608601f, 0.606262624f},
-std::array<float,2>{0.371685565f, 0.72040987f},
-std::array<float,2>{0.728606045f, 0.411738575f},
-std::array<float,2>{0.171825066f, 0.129869252f},
-std::array<float,2>{0.952740788f, 0.772216678f},
-std::array<float,2>{0.249432623f, 0.53796953f},
-std::array<float,2>{0.924326539f, 0.355201125f},
-std::array<float,2>{0.253871441f, 0.0148301683f},
-std::array<float,2>{0.677331507f, 0.90878123f},
-std::array<float,2>{0.377033472f, 0.828444958f},
-std::array<float,2>{0.570713639f, 0.237521067f},
-std::array<float,2>{0.0911509097f, 0.468764007f},
-std::array<float,2>{0.854461789f, 0.639974713f},
-std::array<float,2>{0.142718971f, 0.800616384f},
-std::array<float,2>{0.977009773f, 0.167265698f},
-std::array<float,2>{0.333601058f, 0.379464388f},
-std::array<float,2>{0.705945671f, 0.714580655f},
-std::array<float,2>{0.451852411f, 0.592419565f},
-std::array<float,2>{0.530853629f, 0.256817609f},
-std::array<float,2>{0.0178169273f, 0.0935868844f},
-std::array<float,2>{0.779791474f, 0.964326262f},
-std::array<float,2>{0.113857001f, 0.675284743f},
-std::array<float,2>{0.815266192f, 0.448419034f},
-std::array<float,2>{0.408480495f, 0.200723484f},
-std::array<float,2>{0.621586144f, 0.849192083f},
-std::array<float,2>{0.297265589f, 0.888785183f},
-std::array<float,2>{0.629054964f, 0.0313435793f},
-std::array<float,2>{0.195486724f, 0.317615718f},
-std::array<float,2>{0.878640473f, 0.518689394f},
-std::array<float,2>{0.068259269f, 0.863321781f},
-std::array<float,2>{0.874339342f, 0.218262777f},
-std::array<float,2>{0.398034573f, 0.466051817f},
-std::array<float,2>{0.580219328f, 0.668827951f},
-std::array<float,2>{0.275639862f, 0.507995725f},
-std::array<float,2>{0.671845078f, 0.331994116f},
-std::array<float,2>{0.230933696f, 0.0472352542f},
-std::array<float,2>{0.909115791f, 0.891143739f},
-std::array<float,2>{0.174979404f, 0.694544911f},
-std::array<float,2>{0.967142999f, 0.401926965f},
-std::array<float,2>{0.349101901f, 0.182148159f},
-std::array<float,2>{0.749593794f, 0.788317919f},
-std::array<float,2>{0.497532099f, 0.952620804f},
-std::array<float,2>{0.538244426f, 0.0682287961f},
-std::array<float,2>{0.0494177677f, 0.274754494f},
-std::array<float,2>{0.811879992f, 0.56808871f},
-std::array<float,2>{0.203218669f, 0.933595419f},
-std::array<float,2>{0.903346598f, 0.0167842265f},
-std::array<float,2>{0.286901772f, 0.373632997f},
-std::array<float,2>{0.642244041f, 0.560408235f},
-std::array<float,2>{0.43329829f, 0.653652132f},
-std::array<float,2>{0.607070327f, 0.498759001f},
-std::array<float,2>{0.106386572f, 0.232027262f},
-std::array<float,2>{0.836824417f, 0.817171872f},
-std::array<float,2>{0.0152701447f, 0.618817747f},
-std::array<float,2>{0.757986248f, 0.296548665f},
-std::array<float,2>{0.466964483f, 0.107744008f},
-std::array<float,2>{0.515437365f, 0.986039937f},
-std::array<float,2>{0.322672009f, 0.756604552f},
-std::array<float,2>{0.698221207f, 0.143612772f},
-std::array<float,2>{0.131476253f, 0.434163183f},
-std::array<float,2>{0.992608964f, 0.742223501f},
-std::array<float,2>{0.0615607351f, 0.883583963f},
-std::array<float,2>{0.799383461f, 0.0364736021f},
-std::array<float,2>{0.488265574f, 0.313279003f},
-std::array<float,2>{0.545651734f, 0.522502184f},
-std::array<float,2>{0.358473897f, 0.67954725f},
-std::array<float,2>{0.741451919f, 0.450731367f},
-std::array<float,2>{0.179886773f, 0.197669908f},
-std::array<float,2>{0.957625389f, 0.84447062f},
-std::array<float,2>{0.225684315f, 0.587421596f},
-std::array<float,2>{0.915870249f, 0.253287286f},
-std::array<float,2>{0.268166721f, 0.0896070823f},
-std::array<float,2>{0.661476135f, 0.965316415f},
-std::array<float,2>{0.403883845f, 0.802255034f},
-std::array<float,2>{0.591219783f, 0.169603959f},
-std::array<float,2>{0.0733278245f, 0.375931025f},
-std::array<float,2>{0.862104297f, 0.716326177f},
-std::array<float,2>{0.140046656f, 0.833300233f},
-std::array<float,2>{0.989410877f, 0.23953937f},
-std::array<float,2>{0.319353968f, 0.4726834f},
-std::array<float,2>{0.691530406f, 0.632849216f},
-std::array<float,2>{0.455399603f, 0.532486677f},
-std::array<float,2>{0.507498264f, 0.35725534f},
-std::array<float,2>{0.00127935712f, 0.0109541025f},
-std::array<float,2>{0.750616968f, 0.911698461f},
-std::array<float,2>{0.10145016f, 0.723469734f},
-std::array<float,2>{0.828803599f, 0.408690572f},
-std::array<float,2>{0.428172857f, 0.126042262f},
-std::array<float,2>{0.594793916f, 0.765740871f},
-std::array<float,2>{0.292342901f, 0.98077625f},
-std::array<float,2>{0.655195832f, 0.118665799f},
-std::array<float,2>{0.215228215f, 0.300516665f},
-std::array<float,2>{0.892318189f, 0.603372931f},
-std::array<float,2>{0.0828501284f, 0.750861883f},
-std::array<float,2>{0.84544909f, 0.147509232f},
-std::array<float,2>{0.387948722f, 0.430402577f},
-std::array<float,2>{0.565847933f, 0.74803108f},
-std::array<float,2>{0.265400827f, 0.622150064f},
-std::array<float,2>{0.681795835f, 0.290230483f},
-std::array<float,2>{0.235397294f, 0.104962945f},
-std::array<float,2>{0.935447752f, 0.991453826f},
-std::array<float,2>{0.159482688f, 0.649590135f},
-std::array<float,2>{0.944844544f, 0.494573116f},
-std::array<float,2>{0.361506164f, 0.229306653f},
-std::array<float,2>{0.719989598f, 0.815616488f},
-std::array<float,2>{0.470636725f, 0.930067062f},
-std::array<float,2>{0.561240435f, 0.0228459388f},
-std::array<float,2>{0.0418209992f, 0.370876074f},
-std::array<float,2>{0.792803288f, 0.555146515f},
-std::array<float,2>{0.191105276f, 0.947299719f},
-std::array<float,2>{0.88621825f, 0.0661338791f},
-std::array<float,2>{0.309757143f, 0.278755814f},
-std::array<float,2>{0.638572752f, 0.566397786f},
-std::array<float,2>{0.417452306f, 0.691108525f},
-std::array<float,2>{0.610105395f, 0.405755669f},
-std::array<float,2>{0.122089081f, 0.186157063f},
-std::array<float,2>{0.824644804f, 0.782068193f},
-std::array<float,2>{0.0268065687f, 0.512154222f},
-std::array<float,2>{0.767583013f, 0.333841473f},
-std::array<float,2>{0.444524437f, 0.0541018844f},
-std::array<float,2>{0.522290409f, 0.897997677f},
-std::array<float,2>{0.339563549f, 0.861806035f},
-std::array<float,2>{0.713472247f, 0.213689312f},
-std::array<float,2>{0.1559342f, 0.461177766f},
-std::array<float,2>{0.97352314f, 0.665774703f},
-std::array<float,2>{0.112728655f, 0.995397627f},
-std::array<float,2>{0.820092559f, 0.100530565f},
-std::array<float,2>{0.412004352f, 0.283471733f},
-std::array<float,2>{0.618658721f, 0.613946378f},
-std::array<float,2>{0.304679692f, 0.73939079f},
-std::array<float,2>{0.627494633f, 0.428663492f},
-std::array<float,2>{0.199457824f, 0.152920961f},
-std::array<float,2>{0.880657017f, 0.758103073f},
-std::array<float,2>{0.147491336f, 0.548613548f},
-std::array<float,2>{0.980938315f, 0.364692211f},
-std::array<float,2>{0.331441849f, 0.0297506396f},
-std::array<float,2>{0.707889259f, 0.929441571f},
-std::array<float,2>{0.448640287f, 0.825950205f},
-std::array<float,2>{0.527159452f, 0.222098961f},
-std::array<float,2>{0.0223979335f, 0.485434264f},
-std::array<float,2>{0.776812196f, 0.647809923f},
-std::array<float,2>{0.245523304f, 0.790785551f},
-std::array<float,2>{0.929650664f, 0.174737751f},
-std::array<float,2>{0.254143804f, 0.39598915f},
-std::array<float,2>{0.675481915f, 0.70015645f},
-std::array<float,2>{0.380049467f, 0.571141303f},
-std::array<float,2>{0.575367212f, 0.266681224f},
-std::array<float,2>{0.0878252089f, 0.0744123757f},
-std::array<float,2>{0.8588925f, 0.94009161f},
-std::array<float,2>{0.0383928344f, 0.65629071f},
-std::array<float,2>{0.783177435f, 0.453631818f},
-std::array<float,2>{0.479912043f, 0.21085006f},
-std::array<float,2>{0.553765476f, 0.873677552f},
-std::array<float,2>{0.368616402f, 0.903434277f},
-std::array<float,2>{0.732221901f, 0.057235714f},
-std::array<float,2>{0.164427549f, 0.339522809f},
-std::array<float,2>{0.948745549f, 0.501280725f},
-std::array<float,2>{0.0102228075f, 0.857015908f},
-std::array<float,2>{0.764434934f, 0.194074541f},
-std::array<float,2>{0.46261254f, 0.444319636f},
-std::array<float,2>{0.511116982f, 0.68747437f},
-std::array<float,2>{0.324916959f, 0.527736723f},
-std::array<float,2>{0.702809334f, 0.325595528f},
-std::array<float,2>{0.12647818f, 0.0461062975f},
-std::array<float,2>{0.998378277f, 0.877104342f},
-std::array<float,2>{0.207627445f, 0.705857635f},
-std::array<float,2>{0.900179684f, 0.390312433f},
-std::array<float,2>{0.282755256f, 0.163037285f},
-std::array<float,2>{0.646807015f, 0.808687806f},
-std::array<float,2>{0.436167598f, 0.957223117f},
-std::array<float,2>{0.601916611f, 0.0849172249f},
-std::array<float,2>{0.104764283f, 0.25965929f},
-std::array<float,2>{0.843554616f, 0.580704153f},
-std::array<float,2>{0.178331837f, 0.915635169f},
-std::array<float,2>{0.962585926f, 0.00113599107f},
-std::array<float,2>{0.344069481f, 0.351190805f},
-std::array<float,2>{0.74486804f, 0.543695867f},
-std::array<float,2>{0.493713945f, 0.628564358f},
-std::array<float,2>{0.534679711f, 0.478121877f},
-std::array<float,2>{0.0519256406f, 0.242695287f},
-std::array<float,2>{0.807984412f, 0.838666141f},
-std::array<float,2>{0.0645455271f, 0.599909544f},
-std::array<float,2>{0.867269635f, 0.305649161f},
-std::array<float,2>{0.39286384f, 0.116819307f},
-std::array<float,2>{0.58285147f, 0.968970299f},
-std::array<float,2>{0.27874428f, 0.780397832f},
-std::array<float,2>{0.665306866f, 0.139153987f},
-std::array<float,2>{0.227053493f, 0.419570029f},
-std::array<float,2>{0.911667585f, 0.731072307f},
-std::array<float,2>{0.0748181492f, 0.924573481f},
-std::array<float,2>{0.86645174f, 0.0257791858f},
-std::array<float,2>{0.401291013f, 0.361295849f},
-std::array<float,2>{0.588552892f, 0.550794721f},
-std::array<float,2>{0.272783697f, 0.641195357f},
-std::array<float,2>{0.65686661f, 0.491287321f},
-std::array<float,2>{0.219312593f, 0.224733859f},
-std::array<float,2>{0.920764446f, 0.824100912f},
-std::array<float,2>{0.187444463f, 0.610857964f},
-std::array<float,2>{0.956519008f, 0.289051801f},
-std::array<float,2>{0.351744831f, 0.0960417986f},
-std::array<float,2>{0.737197578f, 0.997980058f},
-std::array<float,2>{0.489416599f, 0.765108645f},
-std::array<float,2>{0.541257799f, 0.151410311f},
-std::array<float,2>{0.0560908318f, 0.422347367f},
-std::array<float,2>{0.801722765f, 0.734788418f},
-std::array<float,2>{0.21339345f, 0.871022463f},
-std::array<float,2>{0.897690177f, 0.206377342f},
-std::array<float,2>{0.294701368f, 0.45773077f},
-std::array<float,2>{0.648683071f, 0.660331249f},
-std::array<float,2>{0.424226493f, 0.504971802f},
-std::array<float,2>{0.601364791f, 0.342564136f},
-std::array<float,2>{0.0959954783f, 0.0589782819f},
-std::array<float,2>{0.834685743f, 0.898526549f},
-std::array<float,2>{0.00439355476f, 0.697424591f},
-std::array<float,2>{0.754862666f, 0.391733885f},
-std::array<float,2>{0.460646689f, 0.175971597f},
-std::array<float,2>{0.503821075f, 0.79345417f},
-std::array<float,2>{0.31407097f, 0.943853736f},
-std::array<float,2>{0.688540161f, 0.0705482513f},
-std::array<float,2>{0.136637896f, 0.271722972f},
-std::array<float,2>{0.987470746f, 0.577548683f},
-std::array<float,2>{0.0436978303f, 0.806474268f},
-std::array<float,2>{0.793773353f, 0.158503845f},
-std::array<float,2>{0.472995907f, 0.384625494f},
-std::array<float,2>{0.555867076f, 0.70988822f},
-std::array<float,2>{0.365059406f, 0.582529068f},
-std::array<float,2>{0.723171771f, 0.263335973f},
-std::array<float,2>{0.161001146f, 0.0810948238f},
-std::array<float,2>{0.939688981f, 0.955025256f},
-std::array<float,2>{0.241185978f, 0.68166399f},
-std::array<float,2>{0.930541754f, 0.440097928f},
-std::array<float,2>{0.26051712f, 0.190281793f},
-std::array<float,2>{0.685232282f, 0.855235994f},
-std::array<float,2>{0.382893175f, 0.882413268f},
-std::array<float,2>{0.567552328f, 0.0398845449f},
-std::array<float,2>{0.0803993046f, 0.32308951f},
-std::array<float,2>{0.85152179f, 0.526110291f},
-std::array<float,2>{0.148530945f, 0.974621058f},
-std::array<float,2>{0.969241261f, 0.11175245f},
-std::array<float,2>{0.342441469f, 0.310919434f},
-std::array<float,2>{0.717250168f, 0.594560921f},
-std::array<float,2>{0.439947039f, 0.727147341f},
-std::array<float,2>{0.518253326f, 0.414695799f},
-std::array<float,2>{0.0308474768f, 0.134949416f},
-std::array<float,2>{0.771945715f, 0.776903093f},
-std::array<float,2>{0.120696098f, 0.539745629f},
-std::array<float,2>{0.824145913f, 0.346819431f},
-std::array<float,2>{0.418337017f, 0.00524000358f},
-std::array<float,2>{0.617071807f, 0.919416308f},
-std::array<float,2>{0.307244033f, 0.840362251f},
-std::array<float,2>{0.635831952f, 0.248744026f},
-std::array<float,2>{0.194705769f, 0.483671665f},
-std::array<float,2>{0.888236523f, 0.629992247f},
-std::array<float,2>{0.0173938293f, 0.962867737f},
-std::array<float,2>{0.778764129f, 0.0899346322f},
-std::array<float,2>{0.451115429f, 0.255345911f},
-std::array<float,2>{0.529218793f, 0.590268195f},
-std::array<float,2>{0.335717261f, 0.711937249f},
-std::array<float,2>{0.703139901f, 0.381999463f},
-std::array<float,2>{0.141454995f, 0.164553329f},
-std::array<float,2>{0.980311453f, 0.797658741f},
-std::array<float,2>{0.199215323f, 0.516597271f},
-std::array<float,2>{0.876095355f, 0.318674594f},
-std::array<float,2>{0.300661027f, 0.0338044986f},
-std::array<float,2>{0.631371379f, 0.888147414f},
-std::array<float,2>{0.406985968f, 0.849658489f},
-std::array<float,2>{0.623805165f, 0.201930866f},
-std::array<float,2>{0.116080284f, 0.447056234f},
-std::array<float,2>{0.813973308f, 0.67378068f},
-std::array<float,2>{0.169665664f, 0.770204425f},
-std::array<float,2>{0.950728893f, 0.13271831f},
-std::array<float,2>{0.373528779f, 0.413431376f},
-std::array<float,2>{0.727438211f, 0.72248733f},
-std::array<float,2>{0.484009922f, 0.607923985f},
-std::array<float,2>{0.548896253f, 0.304092914f},
-std::array<float,2>{0.0347643755f, 0.121983081f},
-std::array<float,2>{0.785246015f, 0.977046549f},
-std::array<float,2>{0.092789337f, 0.637077093f},
-std::array<float,2>{0.852346063f, 0.472636491f},
-std::array<float,2>{0.375078976f, 0.236065924f},
-std::array<float,2>{0.57366854f, 0.830500841f},
-std::array<float,2>{0.25145191f, 0.906290054f},
-std::array<float,2>{0.679090917f, 0.0119299917f},
-std::array<float,2>{0.247511193f, 0.352322042f},
-std::array<float,2>{0.922025442f, 0.535809755f},
-std::array<float,2>{0.108011603f, 0.820204735f},
-std::array<float,2>{0.839222968f, 0.232579291f},
-std::array<float,2>{0.431230485f, 0.49679625f},
-std::array<float,2>{0.609309971f, 0.654922128f},
-std::array<float,2>{0.288100958f, 0.561333895f},
-std::array<float,2>{0.644197047f, 0.371849209f},
-std::array<float,2>{0.206013069f, 0.0176723152f},
-std::array<float,2>{0.905529499f, 0.936544001f},
-std::array<float,2>{0.130329579f, 0.745440006f},
-std::array<float,2>{0.995212734f, 0.43736726f},
-std::array<float,2>{0.320666134f, 0.141796589f},
-std::array<float,2>{0.696855128f, 0.754154742f},
-std::array<float,2>{0.465199709f, 0.986727715f},
-std::array<float,2>{0.512144387f, 0.107026398f},
-std::array<float,2>{0.0131130908f, 0.293833911f},
-std::array<float,2>{0.760981917f, 0.619907141f},
-std::array<float,2>{0.233406186f, 0.894333601f},
-std::array<float,2>{0.906805694f, 0.0488369241f},
-std::array<float,2>{0.275304466f, 0.329631209f},
-std::array<float,2>{0.668549836f, 0.511412203f},
-std::array<float,2>{0.395434976f, 0.671410859f},
-std::array<float,2>{0.580006421f, 0.467851311f},
-std::array<float,2>{0.0696834996f, 0.216373831f},
-std::array<float,2>{0.872300565f, 0.866243184f},
-std::array<float,2>{0.0480268598f, 0.570112109f},
-std::array<float,2>{0.810099959f, 0.275729656f},
-std::array<float,2>{0.498170704f, 0.0688638389f},
-std::array<float,2>{0.53710115f, 0.949926496f},
-std::array<float,2>{0.349629849f, 0.78622508f},
-std::array<float,2>{0.747959673f, 0.180991203f},
-std::array<float,2>{0.172946349f, 0.400388002f},
-std::array<float,2>{0.965908527f, 0.692409873f},
-std::array<float,2>{0.0250169113f, 0.896579146f},
-std::array<float,2>{0.766426086f, 0.0535754263f},
-std::array<float,2>{0.441943079f, 0.332289189f},
-std::array<float,2>{0.521152377f, 0.513613224f},
-std::array<float,2>{0.337435603f, 0.66462642f},
-std::array<float,2>{0.711152673f, 0.462792307f},
-std::array<float,2>{0.153743103f, 0.213917181f},
-std::array<float,2>{0.975723743f, 0.862818062f},
-std::array<float,2>{0.188615799f, 0.564763725f},
-std::array<float,2>{0.883635938f, 0.277918607f},
-std::array<float,2>{0.312445074f, 0.0645877123f},
-std::array<float,2>{0.639313698f, 0.948321998f},
-std::array<float,2>{0.415236384f, 0.782354534f},
-std::array<float,2>{0.611389875f, 0.186924115f},
-std::array<float,2>{0.123693354f, 0.405244797f},
-std::array<float,2>{0.827588856f, 0.689796925f},
-std::array<float,2>{0.157098487f, 0.815019369f},
-std::array<float,2>{0.942727864f, 0.229993716f},
-std::array<float,2>{0.360193938f, 0.49589172f},
-std::array<float,2>{0.721132159f, 0.64844352f},
-std::array<float,2>{0.471759558f, 0.556375146f},
-std::array<float,2>{0.559254348f, 0.369584501f},
-std::array<float,2>{0.0394607671f, 0.0215866268f},
-std::array<float,2>{0.790663838f, 0.93115741f},
-std::array<float,2>{0.0857794061f, 0.746678114f},
-std::array<float,2>{0.845792711f, 0.431297719f},
-std::array<float,2>{0.390586823f, 0.146905929f},
-std::array<float,2>{0.562620461f, 0.75097996f},
-std::array<float,2>{0.26209116f, 0.99042201f},
-std::array<float,2>{0.681418061f, 0.103955798f},
-std::array<float,2>{0.23716861f, 0.289515555f},
-std::array<float,2>{0.936442316f, 0.621165633f},
-std::array<float,2>{0.0985931233f, 0.766652286f},
-std::array<float,2>{0.831300974f, 0.125920951f},
-std::array<float,2>{0.4273431f, 0.410040617f},
-std::array<float,2>{0.595903873f, 0.7239905f},
-std::array<float,2>{0.290276915f, 0.601940274f},
-std::array<float,2>{0.652618408f, 0.299322933f},
-std::array<float,2>{0.218508333f, 0.117959097f},
-std::array<float,2>{0.893325567f, 0.981931448f},
-std::array<float,2>{0.138608351f, 0.634679437f},
-std::array<float,2>{0.99050802f, 0.47410658f},
-std::array<float,2>{0.317226708f, 0.238424703f},
-std::array<float,2>{0.693489313f, 0.832115769f},
-std::array<float,2>{0.454069376f, 0.910524368f},
-std::array<float,2>{0.505384147f, 0.010717758f},
-std::array<float,2>{0.00348957884f, 0.355759114f},
-std::array<float,2>{0.753110945f, 0.531746745f},
-std::array<float,2>{0.223431498f, 0.966204584f},
-std::array<float,2>{0.916402757f, 0.0879422724f},
-std::array<float,2>{0.266646653f, 0.25255844f},
-std::array<float,2>{0.662786305f, 0.586281896f},
-std::array<float,2>{0.40469414f, 0.715794265f},
-std::array<float,2>{0.593493938f, 0.376159728f},
-std::array<float,2>{0.0717787594f, 0.168457583f},
-std::array<float,2>{0.860277891f, 0.801246345f},
-std::array<float,2>{0.0587201603f, 0.521551669f},
-std::array<float,2>{0.798329771f, 0.313497812f},
-std::array<float,2>{0.48505038f, 0.0358122475f},
-std::array<float,2>{0.544298649f, 0.884527385f},
-std::array<float,2>{0.355726659f, 0.84511435f},
-std::array<float,2>{0.739739299f, 0.19827728f},
-std::array<float,2>{0.18175526f, 0.449979901f},
-std::array<float,2>{0.960883081f, 0.678539991f},
-std::array<float,2>{0.0627908036f, 0.97025317f},
-std::array<float,2>{0.870621264f, 0.116118431f},
-std::array<float,2>{0.39245829f, 0.30655849f},
-std::array<float,2>{0.584244609f, 0.601386428f},
-std::array<float,2>{0.27987954f, 0.731817663f},
-std::array<float,2>{0.666267931f, 0.418938309f},
-std::array<float,2>{0.229410946f, 0.139901698f},
-std::array<float,2>{0.91328758f, 0.77932483f},
-std::array<float,2>{0.176321521f, 0.544056356f},
-std::array<float,2>{0.963505447f, 0.350400239f},
-std::array<float,2>{0.346197844f, 0.000332969707f},
-std::array<float,2>{0.743436515f, 0.914073706f},
-std::array<float,2>{0.495799661f, 0.838900626f},
-std::array<float,2>{0.532698154f, 0.243554085f},
-std::array<float,2>{0.0528295748f, 0.47662127f},
-std::array<float,2>{0.804875135f, 0.627734721f},
-std::array<float,2>{0.209286079f, 0.809818685f},
-std::array<float,2>{0.902169406f, 0.163505211f},
-std::array<float,2>{0.284480333f, 0.388842613f},
-std::array<float,2>{0.645947754f, 0.70700568f},
-std::array<float,2>{0.43420276f, 0.581256926f},
-std::array<float,2>{0.604933321f, 0.257989794f},
-std::array<float,2>{0.103118762f, 0.0850208402f},
-std::array<float,2>{0.840500653f, 0.958333671f},
-std::array<float,2>{0.00871840026f, 0.686372399f},
-std::array<float,2>{0.763286591f, 0.444533437f},
-std::array<float,2>{0.46450448f, 0.194829509f},
-std::array<float,2>{0.5096398f, 0.855601847f},
-std::array<float,2>{0.327059239f, 0.878608763f},
-std::array<float,2>{0.700160384f, 0.0452706665f},
-std::array<float,2>{0.128306225f, 0.324258089f},
-std::array<float,2>{0.99732846f, 0.529279292f},
-std::array<float,2>{0.0355706848f, 0.87447226f},
-std::array<float,2>{0.784480929f, 0.208987609f},
-std::array<float,2>{0.477303714f, 0.454176366f},
-std::array<float,2>{0.551157773f, 0.65792191f},
-std::array<float,2>{0.370356441f, 0.500538766f},
-std::array<float,2>{0.733656824f, 0.338361233f},
-std::array<float,2>{0.16605185f, 0.0581522807f},
-std::array<float,2>{0.947160423f, 0.902555764f},
-std::array<float,2>{0.242928892f, 0.701060057f},
-std::array<float,2>{0.927112103f, 0.395193875f},
-std::array<float,2>{0.257075518f, 0.175100029f},
-std::array<float,2>{0.672436953f, 0.789880693f},
-std::array<float,2>{0.382116407f, 0.940618217f},
-std::array<float,2>{0.577031434f, 0.0755333528f},
-std::array<float,2>{0.0881017148f, 0.265895098f},
-std::array<float,2>{0.856298029f, 0.571803212f},
-std::array<float,2>{0.144977435f, 0.928294182f},
-std::array<float,2>{0.983507812f, 0.0303200185f},
-std::array<float,2>{0.328474343f, 0.364036709f},
-std::array<float,2>{0.710866034f, 0.547382712f},
-std::array<float,2>{0.44647637f, 0.647379935f},
-std::array<float,2>{0.525047362f, 0.484924495f},
-std::array<float,2>{0.0201903842f, 0.220757976f},
-std::array<float,2>{0.774032354f, 0.824914455f},
-std::array<float,2>{0.109608546f, 0.614407837f},
-std::array<float,2>{0.816805065f, 0.284364969f},
-std::array<float,2>{0.413871318f, 0.101008117f},
-std::array<float,2>{0.620181859f, 0.994965494f},
-std::array<float,2>{0.301624745f, 0.759706736f},
-std::array<float,2>{0.625229359f, 0.153500646f},
-std::array<float,2>{0.201241717f, 0.428935856f},
-std::array<float,2>{0.881904066f, 0.738337457f},
-std::array<float,2>{0.118806735f, 0.91872859f},
-std::array<float,2>{0.820955575f, 0.00477241306f},
-std::array<float,2>{0.420480788f, 0.346608311f},
-std::array<float,2>{0.614056528f, 0.540104806f},
-std::array<float,2>{0.305699229f, 0.62955147f},
-std::array<float,2>{0.633300006f, 0.483300745f},
-std::array<float,2>{0.192718655f, 0.249525383f},
-std::array<float,2>{0.889107645f, 0.841000199f},
-std::array<float,2>{0.150778681f, 0.595320106f},
-std::array<float,2>{0.971754134f, 0.312137216f},
-std::array<float,2>{0.340016246f, 0.112803802f},
-std::array<float,2>{0.715757906f, 0.976258516f},
-std::array<float,2>{0.439180732f, 0.776213706f},
-std::array<float,2>{0.516596675f, 0.136523917f},
-std::array<float,2>{0.0274980422f, 0.415891647f},
-std::array<float,2>{0.770916939f, 0.727917254f},
-std::array<float,2>{0.239318579f, 0.853835881f},
-std::array<float,2>{0.933105052f, 0.190567642f},
-std::array<float,2>{0.259308815f, 0.440843284f},
-std::array<float,2>{0.687332809f, 0.683335841f},
-std::array<float,2>{0.386157125f, 0.527071774f},
-std::array<float,2>{0.569679081f, 0.324184775f},
-std::array<float,2>{0.078361854f, 0.0403607637f},
-std::array<float,2>{0.849333167f, 0.881599605f},
-std::array<float,2>{0.0461985171f, 0.710677743f},
-std::array<float,2>{0.796405911f, 0.383377194f},
-std::array<float,2>{0.475238949f, 0.15999189f},
-std::array<float,2>{0.558308899f, 0.804859877f},
-std::array<float,2>{0.365551621f, 0.953832984f},
-std::array<float,2>{0.726402342f, 0.0801526755f},
-std::array<float,2>{0.162208512f, 0.262524396f},
-std::array<float,2>{0.938861549f, 0.583753467f},
-std::array<float,2>{0.00738254981f, 0.794067144f},
-std::array<float,2>{0.756192863f, 0.177317664f},
-std::array<float,2>{0.458776861f, 0.390856415f},
-std::array<float,2>{0.50136143f, 0.699210763f},
-std::array<float,2>{0.315515339f, 0.576245606f},
-std::array<float,2>{0.69036448f, 0.273432791f},
-std::array<float,2>{0.134310424f, 0.0717003271f},
-std::array<float,2>{0.985759735f, 0.944782555f},
-std::array<float,2>{0.212556913f, 0.661242545f},
-std::array<float,2>{0.895474374f, 0.458815187f},
-std::array<float,2>{0.296601057f, 0.205395803f},
-std::array<float,2>{0.652209759f, 0.870020151f},
-std::array<float,2>{0.423746824f, 0.899745643f},
-std::array<float,2>{0.598607302f, 0.0602033734f},
-std::array<float,2>{0.0943255424f, 0.342788309f},
-std::array<float,2>{0.832195938f, 0.50480783f},
-std::array<float,2>{0.184726909f, 0.996826828f},
-std::array<float,2>{0.95477134f, 0.0967071578f},
-std::array<float,2>{0.354750544f, 0.287903577f},
-std::array<float,2>{0.73551327f, 0.60999465f},
-std::array<float,2>{0.49030903f, 0.735417306f},
-std::array<float,2>{0.539497554f, 0.422862202f},
-std::array<float,2>{0.0581213944f, 0.150870562f},
-std::array<float,2>{0.803057849f, 0.764113188f},
-std::array<float,2>{0.0764275715f, 0.552464664f},
-std::array<float,2>{0.863899052f, 0.359489739f},
-std::array<float,2>{0.399515748f, 0.0272353385f},
-std::array<float,2>{0.587088227f, 0.924947321f},
-std::array<float,2>{0.269897699f, 0.823214948f},
-std::array<float,2>{0.659239531f, 0.226151824f},
-std::array<float,2>{0.221497461f, 0.490355015f},
-std::array<float,2>{0.919111192f, 0.641848326f},
-std::array<float,2>{0.0505657867f, 0.950996101f},
-std::array<float,2>{0.811213672f, 0.069784306f},
-std::array<float,2>{0.496477783f, 0.276479036f},
-std::array<float,2>{0.537129521f, 0.568713546f},
-std::array<float,2>{0.347808063f, 0.691980898f},
-std::array<float,2>{0.748271644f, 0.398828268f},
-std::array<float,2>{0.174555212f, 0.18054904f},
-std::array<float,2>{0.968550384f, 0.785952568f},
-std::array<float,2>{0.231975719f, 0.509804368f},
-std::array<float,2>{0.909663558f, 0.328912407f},
-std::array<float,2>{0.276449293f, 0.0501268245f},
-std::array<float,2>{0.670351326f, 0.893515408f},
-std::array<float,2>{0.396972299f, 0.865753174f},
-std::array<float,2>{0.581334114f, 0.21561569f},
-std::array<float,2>{0.0669915602f, 0.467117071f},
-std::array<float,2>{0.873440742f, 0.670876682f},
-std::array<float,2>{0.13271068f, 0.755610585f},
-std::array<float,2>{0.993495762f, 0.140713304f},
-std::array<float,2>{0.324047089f, 0.43572098f},
-std::array<float,2>{0.698524952f, 0.74436897f},
-std::array<float,2>{0.468573809f, 0.620678067f},
-std::array<float,2>{0.514644325f, 0.294786841f},
-std::array<float,2>{0.013733875f, 0.10563916f},
-std::array<float,2>{0.759203196f, 0.987564385f},
-std::array<float,2>{0.106748179f, 0.65532887f},
-std::array<float,2>{0.837612152f, 0.497841984f},
-std::array<float,2>{0.432166696f, 0.233844355f},
-std::array<float,2>{0.605769277f, 0.818887174f},
-std::array<float,2>{0.285648912f, 0.936442494f},
-std::array<float,2>{0.641364992f, 0.0193022564f},
-std::array<float,2>{0.204389855f, 0.372478127f},
-std::array<float,2>{0.902446806f, 0.561787963f},
-std::array<float,2>{0.090784803f, 0.831898153f},
-std::array<float,2>{0.854763269f, 0.234738827f},
-std::array<float,2>{0.378341466f, 0.470858872f},
-std::array<float,2>{0.57147634f, 0.637715578f},
-std::array<float,2>{0.25222221f, 0.53700906f},
-std::array<float,2>{0.676122904f, 0.352606177f},
-std::array<float,2>{0.248143896f, 0.0132388836f},
-std::array<float,2>{0.9254179f, 0.907428145f},
-std::array<float,2>{0.170748994f, 0.721093893f},
-std::array<float,2>{0.951940536f, 0.412813783f},
-std::array<float,2>{0.372944385f, 0.130889863f},
-std::array<float,2>{0.729833841f, 0.77122438f},
-std::array<float,2>{0.482092887f, 0.97844553f},
-std::array<float,2>{0.54731375f, 0.122996151f},
-std::array<float,2>{0.0323325358f, 0.302739471f},
-std::array<float,2>{0.787528992f, 0.608947456f},
-std::array<float,2>{0.196523815f, 0.887172997f},
-std::array<float,2>{0.877150059f, 0.0349461883f},
-std::array<float,2>{0.298190445f, 0.319829136f},
-std::array<float,2>{0.630800307f, 0.51671052f},
-std::array<float,2>{0.40931654f, 0.67284292f},
-std::array<float,2>{0.622387111f, 0.446148604f},
-std::array<float,2>{0.114570454f, 0.202425331f},
-std::array<float,2>{0.816150784f, 0.851321876f},
-std::array<float,2>{0.0192002617f, 0.591637015f},
-std::array<float,2>{0.7812078f, 0.254784733f},
-std::array<float,2>{0.452857107f, 0.0909820572f},
-std::array<float,2>{0.529892147f, 0.961591303f},
-std::array<float,2>{0.332125723f, 0.798414826f},
-std::array<float,2>{0.706653535f, 0.165274709f},
-std::array<float,2>{0.143838823f, 0.381342918f},
-std::array<float,2>{0.978247583f, 0.711090147f},
-std::array<float,2>{0.0420588292f, 0.932635903f},
-std::array<float,2>{0.791661859f, 0.0205832887f},
-std::array<float,2>{0.469548404f, 0.367595017f},
-std::array<float,2>{0.561651587f, 0.557944894f},
-std::array<float,2>{0.363137692f, 0.652231514f},
-std::array<float,2>{0.719076812f, 0.493565649f},
-std::array<float,2>{0.158745453f, 0.22716637f},
-std::array<float,2>{0.944283545f, 0.813636482f},
-std::array<float,2>{0.234627336f, 0.623275101f},
-std::array<float,2>{0.934091151f, 0.291627884f},
-std::array<float,2>{0.264542013f, 0.103453144f},
-std::array<float,2>{0.683203399f, 0.988746643f},
-std::array<float,2>{0.387406319f, 0.752102494f},
-std::array<float,2>{0.565409482f, 0.145243153f},
-std::array<float,2>{0.0831864849f, 0.433366299f},
-std::array<float,2>{0.844195962f, 0.748698413f},
-std::array<float,2>{0.154727355f, 0.860771835f},
-std::array<float,2>{0.974547505f, 0.211156711f},
-std::array<float,2>{0.338702142f, 0.464320481f},
-std::array<float,2>{0.714348197f, 0.667331815f},
-std::array<float,2>{0.443550169f, 0.513846874f},
-std::array<float,2>{0.523434937f, 0.335651249f},
-std::array<float,2>{0.0259561781f, 0.0512280241f},
-std::array<float,2>{0.769379377f, 0.895892262f},
-std::array<float,2>{0.121737011f, 0.688326895f},
-std::array<float,2>{0.825896025f, 0.403241813f},
-std::array<float,2>{0.416736722f, 0.184383169f},
-std::array<float,2>{0.610690713f, 0.784996033f},
-std::array<float,2>{0.309497237f, 0.945357323f},
-std::array<float,2>{0.637634814f, 0.0633771047f},
-std::array<float,2>{0.189928815f, 0.279886246f},
-std::array<float,2>{0.885257483f, 0.562554598f},
-std::array<float,2>{0.072829023f, 0.804356217f},
-std::array<float,2>{0.862735093f, 0.171045169f},
-std::array<float,2>{0.402792722f, 0.378094316f},
-std::array<float,2>{0.590536237f, 0.718458295f},
-std::array<float,2>{0.268906355f, 0.589085877f},
-std::array<float,2>{0.660514355f, 0.251420707f},
-std::array<float,2>{0.225074708f, 0.0874090046f},
-std::array<float,2>{0.914065123f, 0.967229903f},
-std::array<float,2>{0.181386322f, 0.677654982f},
-std::array<float,2>{0.95878619f, 0.451832533f},
-std::array<float,2>{0.357489377f, 0.196753159f},
-std::array<float,2>{0.740960062f, 0.847183466f},
-std::array<float,2>{0.487190187f, 0.885277569f},
-std::array<float,2>{0.546135426f, 0.0384063534f},
-std::array<float,2>{0.0608411171f, 0.315730274f},
-std::array<float,2>{0.799805284f, 0.520952225f},
-std::array<float,2>{0.216585815f, 0.983614385f},
-std::array<float,2>{0.891282678f, 0.120032728f},
-std::array<float,2>{0.291380942f, 0.297439426f},
-std::array<float,2>{0.656045616f, 0.604130685f},
-std::array<float,2>{0.428777695f, 0.725950539f},
-std::array<float,2>{0.593846679f, 0.407941341f},
-std::array<float,2>{0.100107484f, 0.128859803f},
-std::array<float,2>{0.829110682f, 0.768325329f},
-std::array<float,2>{2.068504e-05f, 0.534236491f},
-std::array<float,2>{0.751403987f, 0.359273612f},
-std::array<float,2>{0.456096768f, 0.00843071844f},
-std::array<float,2>{0.50611794f, 0.913774014f},
-std::array<float,2>{0.319141328f, 0.835666716f},
-std::array<float,2>{0.692659378f, 0.241903812f},
-std::array<float,2>{0.138829261f, 0.475503385f},
-std::array<float,2>{0.989127934f, 0.634869814f},
-std::array<float,2>{0.104354046f, 0.95912087f},
-std::array<float,2>{0.842009783f, 0.0834572539f},
-std::array<float,2>{0.43689701f, 0.260884136f},
-std::array<float,2>{0.603427231f, 0.579883277f},
-std::array<float,2>{0.282131612f, 0.704932928f},
-std::array<float,2>{0.648371637f, 0.387236118f},
-std::array<float,2>{0.208698422f, 0.160270452f},
-std::array<float,2>{0.898965776f, 0.811579347f},
-std::array<float,2>{0.125351399f, 0.529398263f},
-std::array<float,2>{0.999769926f, 0.326269746f},
-std::array<float,2>{0.326016366f, 0.0430653766f},
-std::array<float,2>{0.701489627f, 0.876895428f},
-std::array<float,2>{0.461598635f, 0.858532548f},
-std::array<float,2>{0.510543287f, 0.192926913f},
-std::array<float,2>{0.0110233342f, 0.443321556f},
-std::array<float,2>{0.765213907f, 0.684525013f},
-std::array<float,2>{0.227679953f, 0.777626157f},
-std::array<float,2>{0.910762012f, 0.13830322f},
-std::array<float,2>{0.277409494f, 0.420530051f},
-std::array<float,2>{0.664428473f, 0.733595729f},
-std::array<float,2>{0.393727034f, 0.597966135f},
-std::array<float,2>{0.583704472f, 0.307932198f},
-std::array<float,2>{0.0654784366f, 0.114756167f},
-std::array<float,2>{0.868509531f, 0.97165364f},
-std::array<float,2>{0.0514758304f, 0.626526415f},
-std::array<float,2>{0.806930423f, 0.478621215f},
-std::array<float,2>{0.493065029f, 0.245365575f},
-std::array<float,2>{0.533894241f, 0.836417794f},
-std::array<float,2>{0.345644742f, 0.916229844f},
-std::array<float,2>{0.745604336f, 0.00340159261f},
-std::array<float,2>{0.179163113f, 0.348928452f},
-std::array<float,2>{0.961894155f, 0.546621621f},
-std::array<float,2>{0.0232616998f, 0.827461481f},
-std::array<float,2>{0.776216149f, 0.220092639f},
-std::array<float,2>{0.447724313f, 0.486730516f},
-std::array<float,2>{0.525911331f, 0.645316958f},
-std::array<float,2>{0.330849349f, 0.549346089f},
-std::array<float,2>{0.708108246f, 0.365949184f},
-std::array<float,2>{0.147171095f, 0.0280442778f},
-std::array<float,2>{0.9823367f, 0.927398145f},
-std::array<float,2>{0.20065704f, 0.741037846f},
-std::array<float,2>{0.87910521f, 0.425802559f},
-std::array<float,2>{0.303438663f, 0.155373722f},
-std::array<float,2>{0.628313899f, 0.760929465f},
-std::array<float,2>{0.410396218f, 0.993043005f},
-std::array<float,2>{0.617730558f, 0.0988469496f},
-std::array<float,2>{0.111677147f, 0.282757729f},
-std::array<float,2>{0.818788767f, 0.616667032f},
-std::array<float,2>{0.165761039f, 0.905122161f},
-std::array<float,2>{0.947910428f, 0.0556265302f},
-std::array<float,2>{0.368112147f, 0.336920649f},
-std::array<float,2>{0.731067836f, 0.503295898f},
-std::array<float,2>{0.478854328f, 0.65826261f},
-std::array<float,2>{0.552832842f, 0.456029356f},
-std::array<float,2>{0.0378298275f, 0.208243623f},
-std::array<float,2>{0.782137036f, 0.871513128f},
-std::array<float,2>{0.0868444443f, 0.574197233f},
-std::array<float,2>{0.857918322f, 0.268672228f},
-std::array<float,2>{0.379048914f, 0.0767475069f},
-std::array<float,2>{0.574592292f, 0.939349413f},
-std::array<float,2>{0.255447149f, 0.792711139f},
-std::array<float,2>{0.674731553f, 0.173605472f},
-std::array<float,2>{0.245076239f, 0.396509022f},
-std::array<float,2>{0.928232968f, 0.702688634f},
-std::array<float,2>{0.0815687254f, 0.880141079f},
-std::array<float,2>{0.850441694f, 0.0421884507f},
-std::array<float,2>{0.383908182f, 0.320828468f},
-std::array<float,2>{0.567092061f, 0.524556696f},
-std::array<float,2>{0.261040896f, 0.68056792f},
-std::array<float,2>{0.683692038f, 0.438721776f},
-std::array<float,2>{0.242153496f, 0.189320996f},
-std::array<float,2>{0.931580484f, 0.852147937f},
-std::array<float,2>{0.16138114f, 0.584025085f},
-std::array<float,2>{0.941125393f, 0.265105724f},
-std::array<float,2>{0.363476276f, 0.0798824206f},
-std::array<float,2>{0.724249661f, 0.956594229f},
-std::array<float,2>{0.473803312f, 0.808446705f},
-std::array<float,2>{0.555470288f, 0.156490639f},
-std::array<float,2>{0.0440148711f, 0.38568449f},
-std::array<float,2>{0.794781744f, 0.707825363f},
-std::array<float,2>{0.193406731f, 0.842999101f},
-std::array<float,2>{0.887027264f, 0.247671694f},
-std::array<float,2>{0.308564246f, 0.481633455f},
-std::array<float,2>{0.63565135f, 0.631608486f},
-std::array<float,2>{0.419682354f, 0.541903198f},
-std::array<float,2>{0.616004586f, 0.344644994f},
-std::array<float,2>{0.119622305f, 0.00612004474f},
-std::array<float,2>{0.822285533f, 0.921662629f},
-std::array<float,2>{0.0297396444f, 0.73015213f},
-std::array<float,2>{0.773214638f, 0.417722136f},
-std::array<float,2>{0.440640122f, 0.133664906f},
-std::array<float,2>{0.518756986f, 0.774757624f},
-std::array<float,2>{0.343450129f, 0.973640203f},
-std::array<float,2>{0.718673706f, 0.110156223f},
-std::array<float,2>{0.150222033f, 0.308619827f},
-std::array<float,2>{0.970418811f, 0.597642303f},
-std::array<float,2>{0.0556073338f, 0.763037026f},
-std::array<float,2>{0.802587867f, 0.149114355f},
-std::array<float,2>{0.488920778f, 0.425089359f},
-std::array<float,2>{0.542035997f, 0.737903833f},
-std::array<float,2>{0.352961123f, 0.612230778f},
-std::array<float,2>{0.737612069f, 0.285323858f},
-std::array<float,2>{0.186374888f, 0.0952272341f},
-std::array<float,2>{0.955212533f, 0.998648703f},
-std::array<float,2>{0.2206963f, 0.643752158f},
-std::array<float,2>{0.921204209f, 0.488418281f},
-std::array<float,2>{0.271772265f, 0.224150449f},
-std::array<float,2>{0.657990277f, 0.820525706f},
-std::array<float,2>{0.401415318f, 0.922821343f},
-std::array<float,2>{0.589521766f, 0.0238099601f},
-std::array<float,2>{0.0755078197f, 0.363099009f},
-std::array<float,2>{0.866018295f, 0.553668797f},
-std::array<float,2>{0.135262579f, 0.942947507f},
-std::array<float,2>{0.986851811f, 0.0738299936f},
-std::array<float,2>{0.313294828f, 0.271473378f},
-std::array<float,2>{0.688246787f, 0.57605058f},
-std::array<float,2>{0.458994001f, 0.695548117f},
-std::array<float,2>{0.502563596f, 0.393763423f},
-std::array<float,2>{0.00502462639f, 0.178734422f},
-std::array<float,2>{0.755030453f, 0.796097338f},
-std::array<float,2>{0.0969956815f, 0.506096303f},
-std::array<float,2>{0.835642755f, 0.340710253f},
-std::array<float,2>{0.424868226f, 0.0606997609f},
-std::array<float,2>{0.599785328f, 0.90194416f},
-std::array<float,2>{0.29388544f, 0.867243409f},
-std::array<float,2>{0.650010526f, 0.203345299f},
-std::array<float,2>{0.214371115f, 0.460544556f},
-std::array<float,2>{0.89682126f, 0.662533522f},
-std::array<float,2>{0.0123919295f, 0.98521775f},
-std::array<float,2>{0.760297775f, 0.108994596f},
-std::array<float,2>{0.466645807f, 0.295543998f},
-std::array<float,2>{0.51299262f, 0.617990732f},
-std::array<float,2>{0.321669906f, 0.74394685f},
-std::array<float,2>{0.696285903f, 0.435202271f},
-std::array<float,2>{0.129478544f, 0.143022865f},
-std::array<float,2>{0.99461323f, 0.756880283f},
-std::array<float,2>{0.206844211f, 0.55913204f},
-std::array<float,2>{0.904995739f, 0.374376059f},
-std::array<float,2>{0.287333757f, 0.0164866522f},
-std::array<float,2>{0.643018484f, 0.934731603f},
-std::array<float,2>{0.430292308f, 0.818051398f},
-std::array<float,2>{0.607997298f, 0.230549037f},
-std::array<float,2>{0.109147042f, 0.499727786f},
-std::array<float,2>{0.838232636f, 0.652930617f},
-std::array<float,2>{0.172134578f, 0.788026631f},
-std::array<float,2>{0.965348423f, 0.183524579f},
-std::array<float,2>{0.351145983f, 0.400958359f},
-std::array<float,2>{0.746346772f, 0.693377316f},
-std::array<float,2>{0.499612719f, 0.567147315f},
-std::array<float,2>{0.535282612f, 0.274240345f},
-std::array<float,2>{0.0473015457f, 0.0665427521f},
-std::array<float,2>{0.809327185f, 0.951298833f},
-std::array<float,2>{0.0688552484f, 0.66932267f},
-std::array<float,2>{0.871379733f, 0.465705246f},
-std::array<float,2>{0.395741552f, 0.217172563f},
-std::array<float,2>{0.578368902f, 0.865026116f},
-std::array<float,2>{0.273620009f, 0.891935468f},
-std::array<float,2>{0.66963321f, 0.0478701591f},
-std::array<float,2>{0.233303234f, 0.330525845f},
-std::array<float,2>{0.907948077f, 0.509507656f},
-std::array<float,2>{0.116262928f, 0.848240256f},
-std::array<float,2>{0.812606812f, 0.199897036f},
-std::array<float,2>{0.408191264f, 0.447885364f},
-std::array<float,2>{0.624962866f, 0.67392993f},
-std::array<float,2>{0.299726367f, 0.517778277f},
-std::array<float,2>{0.631899476f, 0.317293882f},
-std::array<float,2>{0.197310954f, 0.0323262028f},
-std::array<float,2>{0.875003397f, 0.890119731f},
-std::array<float,2>{0.141817838f, 0.713827908f},
-std::array<float,2>{0.979256094f, 0.3799555f},
-std::array<float,2>{0.334903896f, 0.166715503f},
-std::array<float,2>{0.704346895f, 0.799435377f},
-std::array<float,2>{0.450139433f, 0.963629067f},
-std::array<float,2>{0.527653277f, 0.0927023366f},
-std::array<float,2>{0.0159738977f, 0.257659912f},
-std::array<float,2>{0.777991056f, 0.59344852f},
-std::array<float,2>{0.246787429f, 0.909769237f},
-std::array<float,2>{0.923169136f, 0.0138248084f},
-std::array<float,2>{0.250023335f, 0.354307204f},
-std::array<float,2>{0.678551674f, 0.539019763f},
-std::array<float,2>{0.376702398f, 0.639331877f},
-std::array<float,2>{0.572729588f, 0.47069332f},
-std::array<float,2>{0.0924435705f, 0.236641109f},
-std::array<float,2>{0.853230476f, 0.829854071f},
-std::array<float,2>{0.0332056396f, 0.607345462f},
-std::array<float,2>{0.786569417f, 0.301490039f},
-std::array<float,2>{0.482657492f, 0.124722891f},
-std::array<float,2>{0.550383031f, 0.978966177f},
-std::array<float,2>{0.374551356f, 0.773046315f},
-std::array<float,2>{0.728058279f, 0.130250007f},
-std::array<float,2>{0.16873771f, 0.411026061f},
-std::array<float,2>{0.949289858f, 0.719210029f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.750798523f, 0.689290285f},
-std::array<float,2>{0.221181706f, 0.364870191f},
-std::array<float,2>{0.566267788f, 0.238652244f},
-std::array<float,2>{0.263704956f, 0.931763351f},
-std::array<float,2>{0.748750508f, 0.797731817f},
-std::array<float,2>{0.492609203f, 0.0122759333f},
-std::array<float,2>{0.951045513f, 0.486413211f},
-std::array<float,2>{0.087228626f, 0.571774662f},
-std::array<float,2>{0.514198363f, 0.519039273f},
-std::array<float,2>{0.327538252f, 0.428262651f},
-std::array<float,2>{0.837077558f, 0.0784727931f},
-std::array<float,2>{0.171998322f, 0.835720241f},
-std::array<float,2>{0.878200114f, 0.984625578f},
-std::array<float,2>{0.0559510849f, 0.128449976f},
-std::array<float,2>{0.637172639f, 0.264900863f},
-std::array<float,2>{0.425962001f, 0.634844065f},
-std::array<float,2>{0.994183123f, 0.604852617f},
-std::array<float,2>{0.112547837f, 0.462985992f},
-std::array<float,2>{0.703909278f, 0.0319194235f},
-std::array<float,2>{0.4589293f, 0.768514574f},
-std::array<float,2>{0.599960387f, 0.878365159f},
-std::array<float,2>{0.311905324f, 0.206330091f},
-std::array<float,2>{0.808657765f, 0.336568356f},
-std::array<float,2>{0.199933618f, 0.726062953f},
-std::array<float,2>{0.682497144f, 0.670461714f},
-std::array<float,2>{0.401308894f, 0.290036559f},
-std::array<float,2>{0.93495816f, 0.180727214f},
-std::array<float,2>{0.0161168985f, 0.961271346f},
-std::array<float,2>{0.855941653f, 0.874044001f},
-std::array<float,2>{0.149613738f, 0.121768288f},
-std::array<float,2>{0.539182901f, 0.401689053f},
-std::array<float,2>{0.348260015f, 0.549923956f},
-std::array<float,2>{0.826649964f, 0.535051107f},
-std::array<float,2>{0.168012008f, 0.389726788f},
-std::array<float,2>{0.529685318f, 0.0949097946f},
-std::array<float,2>{0.332521439f, 0.846916556f},
-std::array<float,2>{0.642911911f, 0.943982959f},
-std::array<float,2>{0.40844813f, 0.157413363f},
-std::array<float,2>{0.900583327f, 0.299336463f},
-std::array<float,2>{0.0371741168f, 0.673919022f},
-std::array<float,2>{0.583250284f, 0.737925708f},
-std::array<float,2>{0.278469771f, 0.320611089f},
-std::array<float,2>{0.780908227f, 0.197611824f},
-std::array<float,2>{0.247790679f, 0.89564091f},
-std::array<float,2>{0.96208626f, 0.765597761f},
-std::array<float,2>{0.0659509152f, 0.0564281493f},
-std::array<float,2>{0.72238487f, 0.453107178f},
-std::array<float,2>{0.47536695f, 0.614297271f},
-std::array<float,2>{0.919598758f, 0.648825049f},
-std::array<float,2>{0.0155898528f, 0.270719022f},
-std::array<float,2>{0.667371392f, 0.152517751f},
-std::array<float,2>{0.386018574f, 0.969709694f},
-std::array<float,2>{0.558098257f, 0.815798759f},
-std::array<float,2>{0.363977522f, 0.0760298371f},
-std::array<float,2>{0.861703038f, 0.409821928f},
-std::array<float,2>{0.135849595f, 0.514124811f},
-std::array<float,2>{0.696049213f, 0.591702461f},
-std::array<float,2>{0.438840806f, 0.469706804f},
-std::array<float,2>{0.982771158f, 0.0181215145f},
-std::array<float,2>{0.103567354f, 0.796185791f},
-std::array<float,2>{0.782137573f, 0.916995049f},
-std::array<float,2>{0.2158117f, 0.221950024f},
-std::array<float,2>{0.618025899f, 0.352424979f},
-std::array<float,2>{0.296203464f, 0.717822552f},
-std::array<float,2>{0.868697286f, 0.686835945f},
-std::array<float,2>{0.13239646f, 0.307984203f},
-std::array<float,2>{0.55175209f, 0.16707316f},
-std::array<float,2>{0.37278235f, 0.949379265f},
-std::array<float,2>{0.660405934f, 0.852621973f},
-std::array<float,2>{0.381994426f, 0.104617387f},
-std::array<float,2>{0.909645498f, 0.380244881f},
-std::array<float,2>{0.00350262946f, 0.543013752f},
-std::array<float,2>{0.616874218f, 0.622755706f},
-std::array<float,2>{0.288402587f, 0.438496888f},
-std::array<float,2>{0.794919729f, 0.0543187261f},
-std::array<float,2>{0.209399492f, 0.756696641f},
-std::array<float,2>{0.971315205f, 0.904331744f},
-std::array<float,2>{0.0968054831f, 0.189712837f},
-std::array<float,2>{0.69338876f, 0.3140136f},
-std::array<float,2>{0.449933171f, 0.749421179f},
-std::array<float,2>{0.893100619f, 0.507424593f},
-std::array<float,2>{0.0447023511f, 0.418239832f},
-std::array<float,2>{0.653400898f, 0.0659741387f},
-std::array<float,2>{0.420923442f, 0.822162867f},
-std::array<float,2>{0.517481506f, 0.979897261f},
-std::array<float,2>{0.342010736f, 0.147488952f},
-std::array<float,2>{0.820039988f, 0.280404419f},
-std::array<float,2>{0.156325698f, 0.647572219f},
-std::array<float,2>{0.734236896f, 0.703860521f},
-std::array<float,2>{0.482170165f, 0.347750515f},
-std::array<float,2>{0.960085511f, 0.23244299f},
-std::array<float,2>{0.0769885778f, 0.910888195f},
-std::array<float,2>{0.772266448f, 0.782229006f},
-std::array<float,2>{0.240682885f, 0.0286036469f},
-std::array<float,2>{0.586575329f, 0.482105583f},
-std::array<float,2>{0.271317482f, 0.583123565f},
-std::array<float,2>{0.798534572f, 0.56310153f},
-std::array<float,2>{0.188981667f, 0.499711871f},
-std::array<float,2>{0.608958483f, 0.00697015598f},
-std::array<float,2>{0.29867354f, 0.809604883f},
-std::array<float,2>{0.7172997f, 0.922176361f},
-std::array<float,2>{0.468459666f, 0.24543643f},
-std::array<float,2>{0.987969339f, 0.37064445f},
-std::array<float,2>{0.121655859f, 0.700522244f},
-std::array<float,2>{0.538738966f, 0.629606307f},
-std::array<float,2>{0.353000998f, 0.253449053f},
-std::array<float,2>{0.849491537f, 0.13566488f},
-std::array<float,2>{0.143147737f, 0.995000839f},
-std::array<float,2>{0.926065445f, 0.835987628f},
-std::array<float,2>{0.0258229896f, 0.0934382752f},
-std::array<float,2>{0.674429297f, 0.437163144f},
-std::array<float,2>{0.392704368f, 0.525494635f},
-std::array<float,2>{0.93977052f, 0.733443022f},
-std::array<float,2>{0.0793338791f, 0.334089965f},
-std::array<float,2>{0.739227772f, 0.215973124f},
-std::array<float,2>{0.489180863f, 0.890336335f},
-std::array<float,2>{0.578019381f, 0.777629435f},
-std::array<float,2>{0.254790455f, 0.0458353236f},
-std::array<float,2>{0.764145076f, 0.454948694f},
-std::array<float,2>{0.231713042f, 0.595197797f},
-std::array<float,2>{0.631558359f, 0.556466758f},
-std::array<float,2>{0.430045784f, 0.396528333f},
-std::array<float,2>{0.88909626f, 0.113691099f},
-std::array<float,2>{0.0488333963f, 0.862995028f},
-std::array<float,2>{0.831930459f, 0.953171372f},
-std::array<float,2>{0.180667415f, 0.178106099f},
-std::array<float,2>{0.500781536f, 0.283334017f},
-std::array<float,2>{0.315677851f, 0.662492752f},
-std::array<float,2>{0.840214312f, 0.745169997f},
-std::array<float,2>{0.176942676f, 0.320249915f},
-std::array<float,2>{0.508531868f, 0.192715526f},
-std::array<float,2>{0.323397934f, 0.900701642f},
-std::array<float,2>{0.635385752f, 0.750525057f},
-std::array<float,2>{0.423111975f, 0.0495116301f},
-std::array<float,2>{0.879995883f, 0.444481522f},
-std::array<float,2>{0.0592711717f, 0.620784223f},
-std::array<float,2>{0.568042636f, 0.54119724f},
-std::array<float,2>{0.261557668f, 0.377140701f},
-std::array<float,2>{0.755403936f, 0.10665071f},
-std::array<float,2>{0.223966032f, 0.857244492f},
-std::array<float,2>{0.948462963f, 0.946471691f},
-std::array<float,2>{0.0917177349f, 0.171566129f},
-std::array<float,2>{0.7422297f, 0.31243664f},
-std::array<float,2>{0.496733725f, 0.682471573f},
-std::array<float,2>{0.932209551f, 0.579652727f},
-std::array<float,2>{0.0231641922f, 0.47997582f},
-std::array<float,2>{0.684044361f, 0.0240220055f},
-std::array<float,2>{0.405481339f, 0.787638247f},
-std::array<float,2>{0.545945525f, 0.908624172f},
-std::array<float,2>{0.34433654f, 0.228683546f},
-std::array<float,2>{0.853664041f, 0.344321787f},
-std::array<float,2>{0.153467178f, 0.708776593f},
-std::array<float,2>{0.709971964f, 0.643756866f},
-std::array<float,2>{0.456688285f, 0.27538988f},
-std::array<float,2>{0.99622786f, 0.140646338f},
-std::array<float,2>{0.11353153f, 0.980978072f},
-std::array<float,2>{0.806551218f, 0.82509172f},
-std::array<float,2>{0.195483625f, 0.0670521334f},
-std::array<float,2>{0.597278893f, 0.417922944f},
-std::array<float,2>{0.307537258f, 0.500410259f},
-std::array<float,2>{0.777197003f, 0.528098464f},
-std::array<float,2>{0.245757803f, 0.429911196f},
-std::array<float,2>{0.581631184f, 0.0862588882f},
-std::array<float,2>{0.274021894f, 0.840312958f},
-std::array<float,2>{0.72458452f, 0.998571813f},
-std::array<float,2>{0.468779504f, 0.137978226f},
-std::array<float,2>{0.967258096f, 0.254327476f},
-std::array<float,2>{0.0669295341f, 0.627017558f},
-std::array<float,2>{0.526930094f, 0.696962893f},
-std::array<float,2>{0.328128636f, 0.372101307f},
-std::array<float,2>{0.82406503f, 0.249429092f},
-std::array<float,2>{0.166101918f, 0.92926389f},
-std::array<float,2>{0.90414381f, 0.805913627f},
-std::array<float,2>{0.0323515311f, 0.00318772858f},
-std::array<float,2>{0.645972788f, 0.492510855f},
-std::array<float,2>{0.410810947f, 0.566850305f},
-std::array<float,2>{0.979311764f, 0.659596205f},
-std::array<float,2>{0.107490949f, 0.285453409f},
-std::array<float,2>{0.701570332f, 0.172061712f},
-std::array<float,2>{0.441540003f, 0.957146883f},
-std::array<float,2>{0.622031152f, 0.865188539f},
-std::array<float,2>{0.289903522f, 0.109433621f},
-std::array<float,2>{0.785902858f, 0.391367674f},
-std::array<float,2>{0.212024257f, 0.560616314f},
-std::array<float,2>{0.669078708f, 0.601425946f},
-std::array<float,2>{0.387398928f, 0.460008115f},
-std::array<float,2>{0.916717589f, 0.0413197279f},
-std::array<float,2>{0.00871462002f, 0.776503086f},
-std::array<float,2>{0.866703808f, 0.884500504f},
-std::array<float,2>{0.139008582f, 0.211634055f},
-std::array<float,2>{0.560499132f, 0.329995573f},
-std::array<float,2>{0.361059338f, 0.730214179f},
-std::array<float,2>{0.79225266f, 0.636914074f},
-std::array<float,2>{0.206836894f, 0.259991825f},
-std::array<float,2>{0.610029578f, 0.130822614f},
-std::array<float,2>{0.281644702f, 0.991871178f},
-std::array<float,2>{0.688661635f, 0.828368068f},
-std::array<float,2>{0.448870212f, 0.0831300318f},
-std::array<float,2>{0.975426137f, 0.424599737f},
-std::array<float,2>{0.0992760584f, 0.521034181f},
-std::array<float,2>{0.547901452f, 0.577917755f},
-std::array<float,2>{0.369767606f, 0.489838779f},
-std::array<float,2>{0.873028755f, 0.00961913541f},
-std::array<float,2>{0.125951439f, 0.801905215f},
-std::array<float,2>{0.911270201f, 0.934240639f},
-std::array<float,2>{0.00760894874f, 0.236514181f},
-std::array<float,2>{0.659159303f, 0.360205829f},
-std::array<float,2>{0.375146389f, 0.691800714f},
-std::array<float,2>{0.955603182f, 0.552077055f},
-std::array<float,2>{0.0710562542f, 0.403089643f},
-std::array<float,2>{0.727558732f, 0.119359985f},
-std::array<float,2>{0.47993961f, 0.868612528f},
-std::array<float,2>{0.593434095f, 0.967390954f},
-std::array<float,2>{0.267976969f, 0.185340434f},
-std::array<float,2>{0.768167078f, 0.293644309f},
-std::array<float,2>{0.237281486f, 0.664147913f},
-std::array<float,2>{0.649739027f, 0.722504437f},
-std::array<float,2>{0.417702138f, 0.34058702f},
-std::array<float,2>{0.896189034f, 0.210906431f},
-std::array<float,2>{0.0421105884f, 0.881479383f},
-std::array<float,2>{0.815862477f, 0.772100568f},
-std::array<float,2>{0.160895079f, 0.0354786515f},
-std::array<float,2>{0.520930648f, 0.468229353f},
-std::array<float,2>{0.3380633f, 0.605760276f},
-std::array<float,2>{0.846551836f, 0.609840095f},
-std::array<float,2>{0.146013215f, 0.447173476f},
-std::array<float,2>{0.533979416f, 0.0596169978f},
-std::array<float,2>{0.356374502f, 0.761331797f},
-std::array<float,2>{0.676513672f, 0.89418906f},
-std::array<float,2>{0.395535499f, 0.202583954f},
-std::array<float,2>{0.924623907f, 0.327581465f},
-std::array<float,2>{0.0292566884f, 0.739731014f},
-std::array<float,2>{0.605092764f, 0.675817132f},
-std::array<float,2>{0.302076221f, 0.303556234f},
-std::array<float,2>{0.801662743f, 0.162974939f},
-std::array<float,2>{0.193619192f, 0.939044178f},
-std::array<float,2>{0.990945816f, 0.849087954f},
-std::array<float,2>{0.118854463f, 0.100458398f},
-std::array<float,2>{0.711919844f, 0.385683328f},
-std::array<float,2>{0.461777478f, 0.538277328f},
-std::array<float,2>{0.886453688f, 0.711872697f},
-std::array<float,2>{0.0516014211f, 0.356364489f},
-std::array<float,2>{0.627458096f, 0.223363191f},
-std::array<float,2>{0.434498191f, 0.918111563f},
-std::array<float,2>{0.505760491f, 0.789257288f},
-std::array<float,2>{0.318952799f, 0.0215295628f},
-std::array<float,2>{0.835066736f, 0.474372268f},
-std::array<float,2>{0.186664462f, 0.588185191f},
-std::array<float,2>{0.734440267f, 0.508415639f},
-std::array<float,2>{0.485606283f, 0.412271291f},
-std::array<float,2>{0.942791462f, 0.0734382421f},
-std::array<float,2>{0.082196191f, 0.816833794f},
-std::array<float,2>{0.758001626f, 0.975527167f},
-std::array<float,2>{0.228895128f, 0.151682168f},
-std::array<float,2>{0.572107494f, 0.267962635f},
-std::array<float,2>{0.252034992f, 0.655668557f},
-std::array<float,2>{0.811952055f, 0.723694086f},
-std::array<float,2>{0.202345014f, 0.33835429f},
-std::array<float,2>{0.598381758f, 0.204809994f},
-std::array<float,2>{0.308662981f, 0.875925481f},
-std::array<float,2>{0.706148684f, 0.766470969f},
-std::array<float,2>{0.460594267f, 0.0335080288f},
-std::array<float,2>{0.993876755f, 0.462008148f},
-std::array<float,2>{0.109917857f, 0.602542877f},
-std::array<float,2>{0.541245699f, 0.548599184f},
-std::array<float,2>{0.351378649f, 0.398979217f},
-std::array<float,2>{0.859148264f, 0.123730898f},
-std::array<float,2>{0.150990754f, 0.872173488f},
-std::array<float,2>{0.936390579f, 0.962934732f},
-std::array<float,2>{0.0184841137f, 0.183333665f},
-std::array<float,2>{0.681330085f, 0.292433769f},
-std::array<float,2>{0.400205374f, 0.66830951f},
-std::array<float,2>{0.951733589f, 0.572428584f},
-std::array<float,2>{0.0894474164f, 0.485731304f},
-std::array<float,2>{0.747731864f, 0.0138355205f},
-std::array<float,2>{0.495046258f, 0.800159991f},
-std::array<float,2>{0.564068437f, 0.93077898f},
-std::array<float,2>{0.2633214f, 0.240461111f},
-std::array<float,2>{0.753103614f, 0.365559548f},
-std::array<float,2>{0.220301598f, 0.690899611f},
-std::array<float,2>{0.639038146f, 0.63412261f},
-std::array<float,2>{0.428315192f, 0.262494445f},
-std::array<float,2>{0.875490487f, 0.126241326f},
-std::array<float,2>{0.0582601354f, 0.986368895f},
-std::array<float,2>{0.839428127f, 0.833782792f},
-std::array<float,2>{0.174829841f, 0.081045866f},
-std::array<float,2>{0.513235211f, 0.425787449f},
-std::array<float,2>{0.324942529f, 0.516145349f},
-std::array<float,2>{0.859909952f, 0.512378156f},
-std::array<float,2>{0.134253144f, 0.407489061f},
-std::array<float,2>{0.554697812f, 0.0774818212f},
-std::array<float,2>{0.36625421f, 0.813116372f},
-std::array<float,2>{0.665263653f, 0.971944511f},
-std::array<float,2>{0.384531677f, 0.156149656f},
-std::array<float,2>{0.920622945f, 0.271672577f},
-std::array<float,2>{0.0133863064f, 0.65077436f},
-std::array<float,2>{0.620586336f, 0.716166019f},
-std::array<float,2>{0.293688357f, 0.354772598f},
-std::array<float,2>{0.784822881f, 0.219013184f},
-std::array<float,2>{0.218651488f, 0.915377855f},
-std::array<float,2>{0.980475068f, 0.793578684f},
-std::array<float,2>{0.103388973f, 0.0161341727f},
-std::array<float,2>{0.69747901f, 0.472455949f},
-std::array<float,2>{0.440841913f, 0.592828453f},
-std::array<float,2>{0.898456931f, 0.673407614f},
-std::array<float,2>{0.0369448103f, 0.298543751f},
-std::array<float,2>{0.641822875f, 0.158258915f},
-std::array<float,2>{0.407245874f, 0.942175627f},
-std::array<float,2>{0.528745055f, 0.845331788f},
-std::array<float,2>{0.33518225f, 0.0974217579f},
-std::array<float,2>{0.824951947f, 0.386747509f},
-std::array<float,2>{0.170603946f, 0.531985283f},
-std::array<float,2>{0.719943762f, 0.615321934f},
-std::array<float,2>{0.474061161f, 0.450866342f},
-std::array<float,2>{0.963551223f, 0.0574495643f},
-std::array<float,2>{0.0635410026f, 0.763473868f},
-std::array<float,2>{0.777607799f, 0.897932887f},
-std::array<float,2>{0.248638645f, 0.195717141f},
-std::array<float,2>{0.585573614f, 0.322922617f},
-std::array<float,2>{0.279686898f, 0.734395802f},
-std::array<float,2>{0.818257749f, 0.645256937f},
-std::array<float,2>{0.158298254f, 0.277970195f},
-std::array<float,2>{0.517873883f, 0.144682154f},
-std::array<float,2>{0.341392189f, 0.978128254f},
-std::array<float,2>{0.655568302f, 0.82329762f},
-std::array<float,2>{0.418808997f, 0.0633052364f},
-std::array<float,2>{0.891516626f, 0.42004022f},
-std::array<float,2>{0.0459706113f, 0.504652858f},
-std::array<float,2>{0.588068187f, 0.585529149f},
-std::array<float,2>{0.272283435f, 0.483485699f},
-std::array<float,2>{0.770477951f, 0.0306217559f},
-std::array<float,2>{0.239469603f, 0.783832908f},
-std::array<float,2>{0.958438754f, 0.914058685f},
-std::array<float,2>{0.075810425f, 0.231103048f},
-std::array<float,2>{0.731863439f, 0.350955039f},
-std::array<float,2>{0.483105272f, 0.706464291f},
-std::array<float,2>{0.906302512f, 0.5454247f},
-std::array<float,2>{0.00119666522f, 0.381608278f},
-std::array<float,2>{0.662453175f, 0.103421211f},
-std::array<float,2>{0.38030538f, 0.855306089f},
-std::array<float,2>{0.553424716f, 0.951214969f},
-std::array<float,2>{0.373155057f, 0.165252864f},
-std::array<float,2>{0.870944381f, 0.305237681f},
-std::array<float,2>{0.130299643f, 0.684781134f},
-std::array<float,2>{0.69290936f, 0.747254908f},
-std::array<float,2>{0.451679349f, 0.315352261f},
-std::array<float,2>{0.969576359f, 0.187560201f},
-std::array<float,2>{0.0945572853f, 0.90413785f},
-std::array<float,2>{0.794990718f, 0.755663633f},
-std::array<float,2>{0.208155036f, 0.0525662638f},
-std::array<float,2>{0.614160836f, 0.441399455f},
-std::array<float,2>{0.285482854f, 0.624896467f},
-std::array<float,2>{0.76334542f, 0.596319079f},
-std::array<float,2>{0.23424834f, 0.456609964f},
-std::array<float,2>{0.575381994f, 0.0441132225f},
-std::array<float,2>{0.257400215f, 0.78048867f},
-std::array<float,2>{0.740536094f, 0.888096809f},
-std::array<float,2>{0.490925252f, 0.217888668f},
-std::array<float,2>{0.937511325f, 0.332618266f},
-std::array<float,2>{0.0819773376f, 0.732409f},
-std::array<float,2>{0.503638864f, 0.660590947f},
-std::array<float,2>{0.312580794f, 0.283178031f},
-std::array<float,2>{0.828799069f, 0.176390663f},
-std::array<float,2>{0.181932107f, 0.955949366f},
-std::array<float,2>{0.887868583f, 0.86086452f},
-std::array<float,2>{0.0472579524f, 0.115876406f},
-std::array<float,2>{0.629230678f, 0.395920366f},
-std::array<float,2>{0.431800216f, 0.557752013f},
-std::array<float,2>{0.986175478f, 0.703077435f},
-std::array<float,2>{0.123326875f, 0.368717819f},
-std::array<float,2>{0.716737747f, 0.243554547f},
-std::array<float,2>{0.465954065f, 0.925425351f},
-std::array<float,2>{0.607039988f, 0.812266171f},
-std::array<float,2>{0.299629033f, 0.0049775308f},
-std::array<float,2>{0.799319983f, 0.497322261f},
-std::array<float,2>{0.190696687f, 0.565107226f},
-std::array<float,2>{0.672778308f, 0.52498436f},
-std::array<float,2>{0.392533571f, 0.435313463f},
-std::array<float,2>{0.928542256f, 0.0915398598f},
-std::array<float,2>{0.0251401458f, 0.839806676f},
-std::array<float,2>{0.850557804f, 0.992506266f},
-std::array<float,2>{0.142316625f, 0.133500412f},
-std::array<float,2>{0.535839558f, 0.250749171f},
-std::array<float,2>{0.353999645f, 0.631132603f},
-std::array<float,2>{0.853099585f, 0.71072799f},
-std::array<float,2>{0.155739233f, 0.34743318f},
-std::array<float,2>{0.544320941f, 0.228334367f},
-std::array<float,2>{0.346508563f, 0.90655458f},
-std::array<float,2>{0.685922503f, 0.786060333f},
-std::array<float,2>{0.40413174f, 0.0260995515f},
-std::array<float,2>{0.931287706f, 0.478313148f},
-std::array<float,2>{0.0212071501f, 0.581584454f},
-std::array<float,2>{0.594861507f, 0.502245545f},
-std::array<float,2>{0.306035876f, 0.414914489f},
-std::array<float,2>{0.808239698f, 0.0702582747f},
-std::array<float,2>{0.1991584f, 0.827509999f},
-std::array<float,2>{0.999572098f, 0.982790053f},
-std::array<float,2>{0.115553945f, 0.14404504f},
-std::array<float,2>{0.707726181f, 0.277111828f},
-std::array<float,2>{0.453947663f, 0.641983628f},
-std::array<float,2>{0.882498324f, 0.618918538f},
-std::array<float,2>{0.0624561012f, 0.442608058f},
-std::array<float,2>{0.63363266f, 0.0469131209f},
-std::array<float,2>{0.424312025f, 0.753730774f},
-std::array<float,2>{0.509883523f, 0.898679912f},
-std::array<float,2>{0.321097761f, 0.194657102f},
-std::array<float,2>{0.842355669f, 0.316621989f},
-std::array<float,2>{0.178935289f, 0.743509352f},
-std::array<float,2>{0.745306849f, 0.679906845f},
-std::array<float,2>{0.499103159f, 0.310320854f},
-std::array<float,2>{0.94688338f, 0.168680102f},
-std::array<float,2>{0.0926815346f, 0.947524309f},
-std::array<float,2>{0.757638693f, 0.859003544f},
-std::array<float,2>{0.226186529f, 0.107876167f},
-std::array<float,2>{0.570276856f, 0.376921803f},
-std::array<float,2>{0.25947684f, 0.539815903f},
-std::array<float,2>{0.788403094f, 0.558914244f},
-std::array<float,2>{0.214523271f, 0.39353916f},
-std::array<float,2>{0.623357415f, 0.111974888f},
-std::array<float,2>{0.292366236f, 0.866956174f},
-std::array<float,2>{0.700052857f, 0.960455418f},
-std::array<float,2>{0.443472743f, 0.1750319f},
-std::array<float,2>{0.977407515f, 0.28734377f},
-std::array<float,2>{0.105578266f, 0.657957554f},
-std::array<float,2>{0.561508f, 0.72666657f},
-std::array<float,2>{0.362463832f, 0.331650168f},
-std::array<float,2>{0.863346219f, 0.213657424f},
-std::array<float,2>{0.137844533f, 0.885781884f},
-std::array<float,2>{0.914319217f, 0.773835242f},
-std::array<float,2>{0.00996325165f, 0.0394372419f},
-std::array<float,2>{0.670666993f, 0.457540512f},
-std::array<float,2>{0.388828307f, 0.597693443f},
-std::array<float,2>{0.965417027f, 0.625852823f},
-std::array<float,2>{0.0689653829f, 0.25678435f},
-std::array<float,2>{0.726361394f, 0.138787076f},
-std::array<float,2>{0.471673787f, 0.996881664f},
-std::array<float,2>{0.578300714f, 0.842209518f},
-std::array<float,2>{0.276145279f, 0.0897030756f},
-std::array<float,2>{0.774994135f, 0.432067484f},
-std::array<float,2>{0.243468091f, 0.529744148f},
-std::array<float,2>{0.647455037f, 0.568823814f},
-std::array<float,2>{0.412884504f, 0.495077491f},
-std::array<float,2>{0.904586315f, 0.000799726928f},
-std::array<float,2>{0.0351307243f, 0.807415247f},
-std::array<float,2>{0.8212533f, 0.927436411f},
-std::array<float,2>{0.165588781f, 0.247408554f},
-std::array<float,2>{0.524602532f, 0.373919994f},
-std::array<float,2>{0.330858141f, 0.698339403f},
-std::array<float,2>{0.766894698f, 0.667921722f},
-std::array<float,2>{0.2349087f, 0.295009404f},
-std::array<float,2>{0.590719402f, 0.186945006f},
-std::array<float,2>{0.266249329f, 0.966625512f},
-std::array<float,2>{0.729092896f, 0.869707346f},
-std::array<float,2>{0.478493005f, 0.11757195f},
-std::array<float,2>{0.953143895f, 0.405686498f},
-std::array<float,2>{0.0726927221f, 0.553295612f},
-std::array<float,2>{0.521855652f, 0.60772413f},
-std::array<float,2>{0.33765623f, 0.466676831f},
-std::array<float,2>{0.814028919f, 0.0381957963f},
-std::array<float,2>{0.163544923f, 0.771131277f},
-std::array<float,2>{0.898293614f, 0.880468071f},
-std::array<float,2>{0.0395954698f, 0.207803473f},
-std::array<float,2>{0.651925683f, 0.342805326f},
-std::array<float,2>{0.415490508f, 0.720327139f},
-std::array<float,2>{0.974250078f, 0.522690475f},
-std::array<float,2>{0.100108497f, 0.422804058f},
-std::array<float,2>{0.690048993f, 0.0856518671f},
-std::array<float,2>{0.44660762f, 0.831981659f},
-std::array<float,2>{0.612901628f, 0.989139199f},
-std::array<float,2>{0.284054339f, 0.130950153f},
-std::array<float,2>{0.789985895f, 0.258624852f},
-std::array<float,2>{0.204685271f, 0.640465617f},
-std::array<float,2>{0.658197284f, 0.694754422f},
-std::array<float,2>{0.376972258f, 0.362342924f},
-std::array<float,2>{0.913813412f, 0.235007122f},
-std::array<float,2>{0.00542182848f, 0.936344445f},
-std::array<float,2>{0.873586655f, 0.803072989f},
-std::array<float,2>{0.128576472f, 0.0100991316f},
-std::array<float,2>{0.549116313f, 0.490922838f},
-std::array<float,2>{0.367473841f, 0.575759172f},
-std::array<float,2>{0.833267987f, 0.58769387f},
-std::array<float,2>{0.184619382f, 0.476424873f},
-std::array<float,2>{0.505898237f, 0.021482205f},
-std::array<float,2>{0.317667812f, 0.792721331f},
-std::array<float,2>{0.626925826f, 0.921071351f},
-std::array<float,2>{0.43700546f, 0.226327688f},
-std::array<float,2>{0.88454771f, 0.358345956f},
-std::array<float,2>{0.0543991216f, 0.713555813f},
-std::array<float,2>{0.573177874f, 0.653649032f},
-std::array<float,2>{0.251616567f, 0.266494602f},
-std::array<float,2>{0.761089802f, 0.149787694f},
-std::array<float,2>{0.226727709f, 0.972871542f},
-std::array<float,2>{0.943437815f, 0.819341302f},
-std::array<float,2>{0.0852901563f, 0.0704377964f},
-std::array<float,2>{0.738226295f, 0.411456972f},
-std::array<float,2>{0.488200426f, 0.509862185f},
-std::array<float,2>{0.922767103f, 0.742042661f},
-std::array<float,2>{0.0301984195f, 0.325176656f},
-std::array<float,2>{0.679322422f, 0.200978532f},
-std::array<float,2>{0.397948474f, 0.891311646f},
-std::array<float,2>{0.531792462f, 0.757865608f},
-std::array<float,2>{0.357940674f, 0.0612150542f},
-std::array<float,2>{0.843996823f, 0.449010581f},
-std::array<float,2>{0.147396639f, 0.611796379f},
-std::array<float,2>{0.713726819f, 0.536324978f},
-std::array<float,2>{0.464423895f, 0.384413749f},
-std::array<float,2>{0.989524961f, 0.0987525955f},
-std::array<float,2>{0.120314136f, 0.850037992f},
-std::array<float,2>{0.803667605f, 0.940364838f},
-std::array<float,2>{0.192434251f, 0.161102936f},
-std::array<float,2>{0.601594985f, 0.302407324f},
-std::array<float,2>{0.304364026f, 0.678884506f},
-std::array<float,2>{0.779604018f, 0.735607862f},
-std::array<float,2>{0.246201709f, 0.323892683f},
-std::array<float,2>{0.582792401f, 0.196861476f},
-std::array<float,2>{0.277958751f, 0.896977782f},
-std::array<float,2>{0.720837831f, 0.762578905f},
-std::array<float,2>{0.476529151f, 0.0584924072f},
-std::array<float,2>{0.960977614f, 0.450038701f},
-std::array<float,2>{0.065149419f, 0.616278708f},
-std::array<float,2>{0.530882657f, 0.532788575f},
-std::array<float,2>{0.333888531f, 0.388050616f},
-std::array<float,2>{0.82792598f, 0.0962999165f},
-std::array<float,2>{0.169694617f, 0.844132245f},
-std::array<float,2>{0.901944637f, 0.942519605f},
-std::array<float,2>{0.0385083482f, 0.159610838f},
-std::array<float,2>{0.64391917f, 0.297438979f},
-std::array<float,2>{0.409471989f, 0.672519982f},
-std::array<float,2>{0.983813643f, 0.592752814f},
-std::array<float,2>{0.105349898f, 0.471196115f},
-std::array<float,2>{0.696371675f, 0.0171475597f},
-std::array<float,2>{0.438042909f, 0.794497192f},
-std::array<float,2>{0.618710935f, 0.914439142f},
-std::array<float,2>{0.295419663f, 0.220690325f},
-std::array<float,2>{0.782878876f, 0.354060173f},
-std::array<float,2>{0.216743991f, 0.715564072f},
-std::array<float,2>{0.666709542f, 0.651446164f},
-std::array<float,2>{0.38479653f, 0.273363054f},
-std::array<float,2>{0.918220878f, 0.155074254f},
-std::array<float,2>{0.014332369f, 0.970852494f},
-std::array<float,2>{0.862831652f, 0.814180136f},
-std::array<float,2>{0.135298625f, 0.0767838284f},
-std::array<float,2>{0.5568977f, 0.407224685f},
-std::array<float,2>{0.364858508f, 0.512766242f},
-std::array<float,2>{0.83655268f, 0.517118812f},
-std::array<float,2>{0.173197612f, 0.427431792f},
-std::array<float,2>{0.515260577f, 0.0814671889f},
-std::array<float,2>{0.326172203f, 0.832481325f},
-std::array<float,2>{0.638272762f, 0.987928212f},
-std::array<float,2>{0.426776826f, 0.12512809f},
-std::array<float,2>{0.876954079f, 0.262942493f},
-std::array<float,2>{0.0555147603f, 0.633272648f},
-std::array<float,2>{0.564791799f, 0.689499736f},
-std::array<float,2>{0.264692336f, 0.367133379f},
-std::array<float,2>{0.751025021f, 0.242167816f},
-std::array<float,2>{0.222056612f, 0.92980063f},
-std::array<float,2>{0.949716449f, 0.799723685f},
-std::array<float,2>{0.0868497342f, 0.0147578288f},
-std::array<float,2>{0.749469638f, 0.4853172f},
-std::array<float,2>{0.49397406f, 0.573319018f},
-std::array<float,2>{0.934490204f, 0.669304013f},
-std::array<float,2>{0.017212661f, 0.291766822f},
-std::array<float,2>{0.682822466f, 0.181756899f},
-std::array<float,2>{0.401598543f, 0.96428436f},
-std::array<float,2>{0.540177286f, 0.871958554f},
-std::array<float,2>{0.349609256f, 0.12430568f},
-std::array<float,2>{0.856848061f, 0.400378108f},
-std::array<float,2>{0.148544371f, 0.547702134f},
-std::array<float,2>{0.704536796f, 0.601759613f},
-std::array<float,2>{0.457600474f, 0.461678863f},
-std::array<float,2>{0.99560231f, 0.0349835306f},
-std::array<float,2>{0.111808099f, 0.766796231f},
-std::array<float,2>{0.810330808f, 0.876852691f},
-std::array<float,2>{0.20074971f, 0.203721285f},
-std::array<float,2>{0.600702167f, 0.339185774f},
-std::array<float,2>{0.311065048f, 0.722799838f},
-std::array<float,2>{0.847666502f, 0.63237071f},
-std::array<float,2>{0.143632323f, 0.251732945f},
-std::array<float,2>{0.53712213f, 0.134364069f},
-std::array<float,2>{0.352333665f, 0.993450105f},
-std::array<float,2>{0.675110638f, 0.838035107f},
-std::array<float,2>{0.394232452f, 0.0904501453f},
-std::array<float,2>{0.926772118f, 0.43412438f},
-std::array<float,2>{0.0268214643f, 0.524411559f},
-std::array<float,2>{0.608209848f, 0.565492451f},
-std::array<float,2>{0.297342896f, 0.496463358f},
-std::array<float,2>{0.79731214f, 0.00459280284f},
-std::array<float,2>{0.188184261f, 0.811361253f},
-std::array<float,2>{0.986569345f, 0.924455404f},
-std::array<float,2>{0.122470886f, 0.243072033f},
-std::array<float,2>{0.718217313f, 0.36788702f},
-std::array<float,2>{0.467287362f, 0.702042937f},
-std::array<float,2>{0.890095413f, 0.556870401f},
-std::array<float,2>{0.0498879589f, 0.394850999f},
-std::array<float,2>{0.632710636f, 0.116653182f},
-std::array<float,2>{0.430827945f, 0.859417319f},
-std::array<float,2>{0.501266003f, 0.956356704f},
-std::array<float,2>{0.3151972f, 0.177562565f},
-std::array<float,2>{0.83068341f, 0.281357914f},
-std::array<float,2>{0.179789916f, 0.661603153f},
-std::array<float,2>{0.739539266f, 0.730813026f},
-std::array<float,2>{0.489570379f, 0.333217263f},
-std::array<float,2>{0.940998316f, 0.216946691f},
-std::array<float,2>{0.0781443715f, 0.887028217f},
-std::array<float,2>{0.765552104f, 0.779851198f},
-std::array<float,2>{0.23062849f, 0.0433331169f},
-std::array<float,2>{0.576965094f, 0.455330789f},
-std::array<float,2>{0.25526461f, 0.597005188f},
-std::array<float,2>{0.793821752f, 0.623733461f},
-std::array<float,2>{0.210637704f, 0.439673036f},
-std::array<float,2>{0.616096735f, 0.0514141023f},
-std::array<float,2>{0.288006097f, 0.754058957f},
-std::array<float,2>{0.694952905f, 0.902627528f},
-std::array<float,2>{0.451042801f, 0.188963458f},
-std::array<float,2>{0.972305596f, 0.315996915f},
-std::array<float,2>{0.0958574489f, 0.746302187f},
-std::array<float,2>{0.55207628f, 0.683890224f},
-std::array<float,2>{0.371180505f, 0.306622326f},
-std::array<float,2>{0.868108809f, 0.164208069f},
-std::array<float,2>{0.131194323f, 0.953113914f},
-std::array<float,2>{0.908488691f, 0.854477286f},
-std::array<float,2>{0.0025392985f, 0.102327704f},
-std::array<float,2>{0.66164571f, 0.382463604f},
-std::array<float,2>{0.381398141f, 0.545996368f},
-std::array<float,2>{0.959174216f, 0.705799758f},
-std::array<float,2>{0.0778086632f, 0.350355119f},
-std::array<float,2>{0.732848227f, 0.231937453f},
-std::array<float,2>{0.481119305f, 0.912831664f},
-std::array<float,2>{0.587055027f, 0.784371555f},
-std::array<float,2>{0.270339102f, 0.0293366555f},
-std::array<float,2>{0.772645533f, 0.482815176f},
-std::array<float,2>{0.241581365f, 0.584436834f},
-std::array<float,2>{0.652659595f, 0.505601108f},
-std::array<float,2>{0.420231581f, 0.421254575f},
-std::array<float,2>{0.893564939f, 0.0635294914f},
-std::array<float,2>{0.0429757833f, 0.822373688f},
-std::array<float,2>{0.818575203f, 0.977134526f},
-std::array<float,2>{0.157349855f, 0.145729408f},
-std::array<float,2>{0.515852988f, 0.278947413f},
-std::array<float,2>{0.343146473f, 0.64579165f},
-std::array<float,2>{0.823002875f, 0.697516084f},
-std::array<float,2>{0.167427823f, 0.374660522f},
-std::array<float,2>{0.526302099f, 0.247029111f},
-std::array<float,2>{0.330038756f, 0.92620641f},
-std::array<float,2>{0.645361364f, 0.808150649f},
-std::array<float,2>{0.411871433f, 0.00180917943f},
-std::array<float,2>{0.902719676f, 0.495979995f},
-std::array<float,2>{0.0318600535f, 0.569684684f},
-std::array<float,2>{0.580951989f, 0.530882061f},
-std::array<float,2>{0.274860352f, 0.433095545f},
-std::array<float,2>{0.776259542f, 0.0885928348f},
-std::array<float,2>{0.244298846f, 0.842851996f},
-std::array<float,2>{0.967942297f, 0.997817874f},
-std::array<float,2>{0.0674697012f, 0.139922991f},
-std::array<float,2>{0.723059356f, 0.257387966f},
-std::array<float,2>{0.470700592f, 0.626289427f},
-std::array<float,2>{0.917824388f, 0.599306643f},
-std::array<float,2>{0.00932931527f, 0.458538204f},
-std::array<float,2>{0.668540955f, 0.0409889221f},
-std::array<float,2>{0.388184309f, 0.774738073f},
-std::array<float,2>{0.558906257f, 0.885252774f},
-std::array<float,2>{0.359452844f, 0.214076951f},
-std::array<float,2>{0.865779519f, 0.330383271f},
-std::array<float,2>{0.140451521f, 0.727798223f},
-std::array<float,2>{0.703104913f, 0.656598747f},
-std::array<float,2>{0.44258818f, 0.288724631f},
-std::array<float,2>{0.979737878f, 0.174165934f},
-std::array<float,2>{0.109051026f, 0.959139407f},
-std::array<float,2>{0.786154568f, 0.866001546f},
-std::array<float,2>{0.211594418f, 0.112665236f},
-std::array<float,2>{0.622144282f, 0.393893003f},
-std::array<float,2>{0.290659755f, 0.560035944f},
-std::array<float,2>{0.754176438f, 0.540961146f},
-std::array<float,2>{0.223508164f, 0.375358075f},
-std::array<float,2>{0.567056656f, 0.109119289f},
-std::array<float,2>{0.259956837f, 0.857763708f},
-std::array<float,2>{0.743413925f, 0.948249161f},
-std::array<float,2>{0.497651577f, 0.169630885f},
-std::array<float,2>{0.947803557f, 0.308874518f},
-std::array<float,2>{0.0900568366f, 0.681616724f},
-std::array<float,2>{0.509707332f, 0.74284035f},
-std::array<float,2>{0.32321164f, 0.317878187f},
-std::array<float,2>{0.841464341f, 0.193615526f},
-std::array<float,2>{0.176045358f, 0.900344729f},
-std::array<float,2>{0.879521847f, 0.752920687f},
-std::array<float,2>{0.0601371862f, 0.0483611934f},
-std::array<float,2>{0.636487782f, 0.441945463f},
-std::array<float,2>{0.422213435f, 0.617814898f},
-std::array<float,2>{0.997922897f, 0.641080618f},
-std::array<float,2>{0.114800066f, 0.275832713f},
-std::array<float,2>{0.709015369f, 0.143417686f},
-std::array<float,2>{0.455586135f, 0.98354578f},
-std::array<float,2>{0.595842302f, 0.826390326f},
-std::array<float,2>{0.307721764f, 0.0690786839f},
-std::array<float,2>{0.805008829f, 0.415758461f},
-std::array<float,2>{0.196956769f, 0.503109574f},
-std::array<float,2>{0.68550241f, 0.580217481f},
-std::array<float,2>{0.404734939f, 0.47747466f},
-std::array<float,2>{0.933235347f, 0.0271660481f},
-std::array<float,2>{0.0217411444f, 0.786380589f},
-std::array<float,2>{0.854572356f, 0.907260656f},
-std::array<float,2>{0.153209925f, 0.226851031f},
-std::array<float,2>{0.544970751f, 0.346049458f},
-std::array<float,2>{0.345254451f, 0.709595203f},
-std::array<float,2>{0.802436411f, 0.678480208f},
-std::array<float,2>{0.194337398f, 0.301049709f},
-std::array<float,2>{0.603628218f, 0.161612198f},
-std::array<float,2>{0.301132321f, 0.940912724f},
-std::array<float,2>{0.711775601f, 0.850803256f},
-std::array<float,2>{0.462747514f, 0.09838745f},
-std::array<float,2>{0.991339862f, 0.382933408f},
-std::array<float,2>{0.117609657f, 0.535700679f},
-std::array<float,2>{0.534970045f, 0.612568974f},
-std::array<float,2>{0.35721159f, 0.44819364f},
-std::array<float,2>{0.846778035f, 0.0618649535f},
-std::array<float,2>{0.144838423f, 0.759025455f},
-std::array<float,2>{0.92528969f, 0.892341971f},
-std::array<float,2>{0.0281773191f, 0.199794695f},
-std::array<float,2>{0.676795661f, 0.326054156f},
-std::array<float,2>{0.394626617f, 0.740365088f},
-std::array<float,2>{0.941462636f, 0.511056125f},
-std::array<float,2>{0.0831686929f, 0.410928816f},
-std::array<float,2>{0.735592425f, 0.0716336593f},
-std::array<float,2>{0.485008031f, 0.818611383f},
-std::array<float,2>{0.571175337f, 0.973746359f},
-std::array<float,2>{0.253721088f, 0.14932026f},
-std::array<float,2>{0.759241641f, 0.267137796f},
-std::array<float,2>{0.230306283f, 0.652934253f},
-std::array<float,2>{0.628555357f, 0.71482116f},
-std::array<float,2>{0.435147136f, 0.359000683f},
-std::array<float,2>{0.8854689f, 0.225339547f},
-std::array<float,2>{0.0523318313f, 0.920383394f},
-std::array<float,2>{0.834724963f, 0.79116267f},
-std::array<float,2>{0.186388552f, 0.0198383294f},
-std::array<float,2>{0.504852235f, 0.475008428f},
-std::array<float,2>{0.319539875f, 0.58646661f},
-std::array<float,2>{0.871273577f, 0.575074434f},
-std::array<float,2>{0.126934007f, 0.491638243f},
-std::array<float,2>{0.547785163f, 0.0107693588f},
-std::array<float,2>{0.370236248f, 0.804605722f},
-std::array<float,2>{0.659336209f, 0.937411964f},
-std::array<float,2>{0.375981569f, 0.235787049f},
-std::array<float,2>{0.910902083f, 0.362275362f},
-std::array<float,2>{0.0062110275f, 0.69347477f},
-std::array<float,2>{0.610915244f, 0.638824582f},
-std::array<float,2>{0.282980353f, 0.259188771f},
-std::array<float,2>{0.791461647f, 0.132588834f},
-std::array<float,2>{0.20519945f, 0.989782929f},
-std::array<float,2>{0.976318061f, 0.830427349f},
-std::array<float,2>{0.0980696678f, 0.0843497068f},
-std::array<float,2>{0.688474834f, 0.423589617f},
-std::array<float,2>{0.447423697f, 0.522353828f},
-std::array<float,2>{0.895476878f, 0.719451606f},
-std::array<float,2>{0.041326765f, 0.342310935f},
-std::array<float,2>{0.649163961f, 0.208768204f},
-std::array<float,2>{0.416327119f, 0.879407585f},
-std::array<float,2>{0.519647002f, 0.770324945f},
-std::array<float,2>{0.339454234f, 0.0379971266f},
-std::array<float,2>{0.815285146f, 0.465332091f},
-std::array<float,2>{0.161804602f, 0.608688831f},
-std::array<float,2>{0.726922154f, 0.554143488f},
-std::array<float,2>{0.478528798f, 0.404768258f},
-std::array<float,2>{0.956708431f, 0.118985541f},
-std::array<float,2>{0.071518369f, 0.870741427f},
-std::array<float,2>{0.769217074f, 0.96564877f},
-std::array<float,2>{0.237917021f, 0.185952902f},
-std::array<float,2>{0.592020929f, 0.295934439f},
-std::array<float,2>{0.269263029f, 0.666117668f},
-std::array<float,2>{0.784081221f, 0.717224896f},
-std::array<float,2>{0.217543483f, 0.353203714f},
-std::array<float,2>{0.619146824f, 0.220745295f},
-std::array<float,2>{0.294894189f, 0.916673243f},
-std::array<float,2>{0.698370039f, 0.795872986f},
-std::array<float,2>{0.439662963f, 0.0194091275f},
-std::array<float,2>{0.982021987f, 0.470241755f},
-std::array<float,2>{0.102111824f, 0.590198994f},
-std::array<float,2>{0.556066155f, 0.515166998f},
-std::array<float,2>{0.366173029f, 0.408612281f},
-std::array<float,2>{0.861268103f, 0.0748779178f},
-std::array<float,2>{0.133182526f, 0.815050483f},
-std::array<float,2>{0.92119813f, 0.970616221f},
-std::array<float,2>{0.0125274109f, 0.153356895f},
-std::array<float,2>{0.664681196f, 0.270476878f},
-std::array<float,2>{0.383512884f, 0.649820209f},
-std::array<float,2>{0.964220226f, 0.613464415f},
-std::array<float,2>{0.0629570559f, 0.451275796f},
-std::array<float,2>{0.719535947f, 0.0551931411f},
-std::array<float,2>{0.472881913f, 0.764265299f},
-std::array<float,2>{0.584826469f, 0.89468509f},
-std::array<float,2>{0.281048745f, 0.198511496f},
-std::array<float,2>{0.778968215f, 0.3218081f},
-std::array<float,2>{0.249823332f, 0.737156928f},
-std::array<float,2>{0.641574919f, 0.675152123f},
-std::array<float,2>{0.406404316f, 0.30009982f},
-std::array<float,2>{0.90029031f, 0.156756833f},
-std::array<float,2>{0.0354309045f, 0.944612384f},
-std::array<float,2>{0.825597227f, 0.845889986f},
-std::array<float,2>{0.171789169f, 0.0939149261f},
-std::array<float,2>{0.527404606f, 0.388785958f},
-std::array<float,2>{0.334501088f, 0.533304155f},
-std::array<float,2>{0.857746124f, 0.549322724f},
-std::array<float,2>{0.151392445f, 0.400837511f},
-std::array<float,2>{0.542265594f, 0.122088172f},
-std::array<float,2>{0.349880517f, 0.873645604f},
-std::array<float,2>{0.680452943f, 0.962621152f},
-std::array<float,2>{0.398652911f, 0.180461138f},
-std::array<float,2>{0.936581492f, 0.29095149f},
-std::array<float,2>{0.0187673476f, 0.671101391f},
-std::array<float,2>{0.59946537f, 0.725215435f},
-std::array<float,2>{0.309735268f, 0.337654352f},
-std::array<float,2>{0.811092377f, 0.206008717f},
-std::array<float,2>{0.202017367f, 0.877066195f},
-std::array<float,2>{0.992790759f, 0.769403696f},
-std::array<float,2>{0.110548973f, 0.032312125f},
-std::array<float,2>{0.705913663f, 0.464409411f},
-std::array<float,2>{0.459295005f, 0.604005396f},
-std::array<float,2>{0.876546502f, 0.636295915f},
-std::array<float,2>{0.0566426553f, 0.264619321f},
-std::array<float,2>{0.640019298f, 0.12702474f},
-std::array<float,2>{0.429082274f, 0.985444963f},
-std::array<float,2>{0.51206404f, 0.834440053f},
-std::array<float,2>{0.325905144f, 0.0798728839f},
-std::array<float,2>{0.838067055f, 0.429387718f},
-std::array<float,2>{0.174083874f, 0.518329144f},
-std::array<float,2>{0.746421099f, 0.570926785f},
-std::array<float,2>{0.495572388f, 0.487927377f},
-std::array<float,2>{0.95227021f, 0.0136178192f},
-std::array<float,2>{0.0888266712f, 0.798117578f},
-std::array<float,2>{0.752785206f, 0.933559299f},
-std::array<float,2>{0.219248444f, 0.240137428f},
-std::array<float,2>{0.563264787f, 0.363689721f},
-std::array<float,2>{0.262107015f, 0.687945426f},
-std::array<float,2>{0.829183936f, 0.663396835f},
-std::array<float,2>{0.183100477f, 0.284578085f},
-std::array<float,2>{0.502181292f, 0.17876783f},
-std::array<float,2>{0.313569009f, 0.95428437f},
-std::array<float,2>{0.629935622f, 0.861822486f},
-std::array<float,2>{0.433477193f, 0.114667349f},
-std::array<float,2>{0.887481868f, 0.397671223f},
-std::array<float,2>{0.0484704114f, 0.555413902f},
-std::array<float,2>{0.575104237f, 0.593947232f},
-std::array<float,2>{0.256068796f, 0.453643531f},
-std::array<float,2>{0.762381494f, 0.0459740013f},
-std::array<float,2>{0.232655406f, 0.77898407f},
-std::array<float,2>{0.938515306f, 0.889379084f},
-std::array<float,2>{0.0801771954f, 0.215384513f},
-std::array<float,2>{0.741974354f, 0.335678011f},
-std::array<float,2>{0.491992354f, 0.732441127f},
-std::array<float,2>{0.929682076f, 0.527171433f},
-std::array<float,2>{0.02428874f, 0.436108053f},
-std::array<float,2>{0.673673809f, 0.0918228775f},
-std::array<float,2>{0.390855581f, 0.837433875f},
-std::array<float,2>{0.536808372f, 0.995201588f},
-std::array<float,2>{0.355373651f, 0.136262983f},
-std::array<float,2>{0.850620866f, 0.252612054f},
-std::array<float,2>{0.141462892f, 0.630794823f},
-std::array<float,2>{0.715110421f, 0.699955463f},
-std::array<float,2>{0.465492278f, 0.369216144f},
-std::array<float,2>{0.984772384f, 0.244342744f},
-std::array<float,2>{0.124789618f, 0.92370677f},
-std::array<float,2>{0.800125241f, 0.808881521f},
-std::array<float,2>{0.189491257f, 0.00626021903f},
-std::array<float,2>{0.605950296f, 0.498414069f},
-std::array<float,2>{0.300595343f, 0.563577354f},
-std::array<float,2>{0.770841897f, 0.582757056f},
-std::array<float,2>{0.238330275f, 0.480791718f},
-std::array<float,2>{0.589614987f, 0.0282331668f},
-std::array<float,2>{0.2730636f, 0.782032132f},
-std::array<float,2>{0.73078382f, 0.91174376f},
-std::array<float,2>{0.483740151f, 0.23407048f},
-std::array<float,2>{0.957691848f, 0.349391699f},
-std::array<float,2>{0.0748964176f, 0.704678535f},
-std::array<float,2>{0.518680692f, 0.647157431f},
-std::array<float,2>{0.340638667f, 0.280014545f},
-std::array<float,2>{0.817224741f, 0.146932021f},
-std::array<float,2>{0.159952924f, 0.978823125f},
-std::array<float,2>{0.892216325f, 0.820736825f},
-std::array<float,2>{0.0455349721f, 0.0646039024f},
-std::array<float,2>{0.654771745f, 0.419182032f},
-std::array<float,2>{0.419625133f, 0.506074667f},
-std::array<float,2>{0.970623016f, 0.748587072f},
-std::array<float,2>{0.0948932096f, 0.313172132f},
-std::array<float,2>{0.691682577f, 0.191062182f},
-std::array<float,2>{0.452391505f, 0.905344665f},
-std::array<float,2>{0.615097463f, 0.757078946f},
-std::array<float,2>{0.286175579f, 0.0533436276f},
-std::array<float,2>{0.795918703f, 0.438193858f},
-std::array<float,2>{0.207399085f, 0.621598303f},
-std::array<float,2>{0.663596928f, 0.544802785f},
-std::array<float,2>{0.379370928f, 0.379840076f},
-std::array<float,2>{0.907885432f, 0.104220547f},
-std::array<float,2>{0.000681628648f, 0.852504551f},
-std::array<float,2>{0.869713545f, 0.950883865f},
-std::array<float,2>{0.129172519f, 0.16639559f},
-std::array<float,2>{0.553716362f, 0.307593971f},
-std::array<float,2>{0.374884158f, 0.685932875f},
-std::array<float,2>{0.864682913f, 0.729191542f},
-std::array<float,2>{0.137030959f, 0.328750134f},
-std::array<float,2>{0.561743796f, 0.212550715f},
-std::array<float,2>{0.362029731f, 0.883158028f},
-std::array<float,2>{0.671386719f, 0.776159525f},
-std::array<float,2>{0.390144914f, 0.0423760042f},
-std::array<float,2>{0.91581732f, 0.459080756f},
-std::array<float,2>{0.0108670834f, 0.599861562f},
-std::array<float,2>{0.624496937f, 0.561665893f},
-std::array<float,2>{0.291855991f, 0.392107934f},
-std::array<float,2>{0.787465692f, 0.111035898f},
-std::array<float,2>{0.213508978f, 0.863861024f},
-std::array<float,2>{0.977671504f, 0.958259344f},
-std::array<float,2>{0.106626607f, 0.173570067f},
-std::array<float,2>{0.700643599f, 0.286556661f},
-std::array<float,2>{0.445311964f, 0.65895611f},
-std::array<float,2>{0.906159401f, 0.567992926f},
-std::array<float,2>{0.0341138616f, 0.493333071f},
-std::array<float,2>{0.648131847f, 0.00210752501f},
-std::array<float,2>{0.413280129f, 0.805651784f},
-std::array<float,2>{0.523936152f, 0.928600371f},
-std::array<float,2>{0.331336856f, 0.248878673f},
-std::array<float,2>{0.82214272f, 0.371188492f},
-std::array<float,2>{0.164116979f, 0.695854962f},
-std::array<float,2>{0.725017846f, 0.628560424f},
-std::array<float,2>{0.471966565f, 0.255846739f},
-std::array<float,2>{0.96604991f, 0.137602895f},
-std::array<float,2>{0.0697578043f, 0.999086499f},
-std::array<float,2>{0.774311781f, 0.841278791f},
-std::array<float,2>{0.243072033f, 0.0876868665f},
-std::array<float,2>{0.579133451f, 0.431173086f},
-std::array<float,2>{0.276464939f, 0.529219866f},
-std::array<float,2>{0.806814134f, 0.50183624f},
-std::array<float,2>{0.198236793f, 0.416086555f},
-std::array<float,2>{0.59398222f, 0.067772761f},
-std::array<float,2>{0.304885477f, 0.825619519f},
-std::array<float,2>{0.708170235f, 0.981562614f},
-std::array<float,2>{0.454261303f, 0.142229408f},
-std::array<float,2>{0.998416424f, 0.273705214f},
-std::array<float,2>{0.117156178f, 0.642884493f},
-std::array<float,2>{0.543417692f, 0.707967281f},
-std::array<float,2>{0.347440153f, 0.345348269f},
-std::array<float,2>{0.85196209f, 0.22989586f},
-std::array<float,2>{0.155115977f, 0.909522295f},
-std::array<float,2>{0.929783583f, 0.788752735f},
-std::array<float,2>{0.0202845149f, 0.0248258952f},
-std::array<float,2>{0.6872437f, 0.479079336f},
-std::array<float,2>{0.402557701f, 0.578476369f},
-std::array<float,2>{0.945344031f, 0.683421969f},
-std::array<float,2>{0.0929347202f, 0.310904235f},
-std::array<float,2>{0.744321585f, 0.170320049f},
-std::array<float,2>{0.498816431f, 0.946243703f},
-std::array<float,2>{0.568984151f, 0.85575515f},
-std::array<float,2>{0.258164436f, 0.105847061f},
-std::array<float,2>{0.756365299f, 0.378022134f},
-std::array<float,2>{0.224819869f, 0.542255223f},
-std::array<float,2>{0.634724677f, 0.619463325f},
-std::array<float,2>{0.425268292f, 0.444194615f},
-std::array<float,2>{0.881177247f, 0.05041302f},
-std::array<float,2>{0.0614526533f, 0.751126051f},
-std::array<float,2>{0.843001008f, 0.90149349f},
-std::array<float,2>{0.178465158f, 0.191701069f},
-std::array<float,2>{0.511125743f, 0.31891489f},
-std::array<float,2>{0.322029501f, 0.744272292f},
-std::array<float,2>{0.760350525f, 0.65447551f},
-std::array<float,2>{0.22796236f, 0.268756151f},
-std::array<float,2>{0.573613882f, 0.15120694f},
-std::array<float,2>{0.250097245f, 0.976414979f},
-std::array<float,2>{0.737107456f, 0.818174005f},
-std::array<float,2>{0.487093925f, 0.0722794309f},
-std::array<float,2>{0.944654942f, 0.413783014f},
-std::array<float,2>{0.0845313668f, 0.509036243f},
-std::array<float,2>{0.5074507f, 0.589252532f},
-std::array<float,2>{0.31663835f, 0.473218143f},
-std::array<float,2>{0.832069933f, 0.0231160466f},
-std::array<float,2>{0.18359457f, 0.790406644f},
-std::array<float,2>{0.88312465f, 0.919184864f},
-std::array<float,2>{0.0532035008f, 0.223657161f},
-std::array<float,2>{0.625778496f, 0.356660306f},
-std::array<float,2>{0.436438262f, 0.71230346f},
-std::array<float,2>{0.989173651f, 0.537330329f},
-std::array<float,2>{0.119297773f, 0.386447936f},
-std::array<float,2>{0.713968813f, 0.100704543f},
-std::array<float,2>{0.463211298f, 0.847798288f},
-std::array<float,2>{0.603392184f, 0.938179553f},
-std::array<float,2>{0.302915841f, 0.163170055f},
-std::array<float,2>{0.803960979f, 0.304593861f},
-std::array<float,2>{0.192267537f, 0.677534699f},
-std::array<float,2>{0.678160965f, 0.738717377f},
-std::array<float,2>{0.396845311f, 0.326846272f},
-std::array<float,2>{0.9229877f, 0.201211661f},
-std::array<float,2>{0.0304042306f, 0.892591238f},
-std::array<float,2>{0.845492065f, 0.760119557f},
-std::array<float,2>{0.148379162f, 0.058748614f},
-std::array<float,2>{0.533004045f, 0.445664763f},
-std::array<float,2>{0.359004319f, 0.611034334f},
-std::array<float,2>{0.813043118f, 0.606856525f},
-std::array<float,2>{0.1628557f, 0.4674052f},
-std::array<float,2>{0.523083746f, 0.0364191085f},
-std::array<float,2>{0.336865306f, 0.772837818f},
-std::array<float,2>{0.650474787f, 0.882480502f},
-std::array<float,2>{0.41488722f, 0.209452584f},
-std::array<float,2>{0.896779895f, 0.341586024f},
-std::array<float,2>{0.0403990597f, 0.720768571f},
-std::array<float,2>{0.591750503f, 0.665157259f},
-std::array<float,2>{0.267196089f, 0.294872642f},
-std::array<float,2>{0.766056299f, 0.184533074f},
-std::array<float,2>{0.236149684f, 0.968327105f},
-std::array<float,2>{0.954632163f, 0.867964864f},
-std::array<float,2>{0.0734803379f, 0.120138407f},
-std::array<float,2>{0.729827762f, 0.40352872f},
-std::array<float,2>{0.477224201f, 0.550872147f},
-std::array<float,2>{0.912626803f, 0.692469776f},
-std::array<float,2>{0.00432526553f, 0.361086011f},
-std::array<float,2>{0.656340659f, 0.237424567f},
-std::array<float,2>{0.378225118f, 0.935464799f},
-std::array<float,2>{0.550675452f, 0.801224589f},
-std::array<float,2>{0.368332148f, 0.00801094901f},
-std::array<float,2>{0.87479347f, 0.488541216f},
-std::array<float,2>{0.126992226f, 0.576239347f},
-std::array<float,2>{0.691381037f, 0.51956898f},
-std::array<float,2>{0.44534415f, 0.425765067f},
-std::array<float,2>{0.973602116f, 0.0824828669f},
-std::array<float,2>{0.101288155f, 0.829764187f},
-std::array<float,2>{0.790471017f, 0.990691364f},
-std::array<float,2>{0.203883886f, 0.128971368f},
-std::array<float,2>{0.612304568f, 0.261455774f},
-std::array<float,2>{0.284285039f, 0.638644576f},
-std::array<float,2>{0.773136258f, 0.704376101f},
-std::array<float,2>{0.242079526f, 0.348792523f},
-std::array<float,2>{0.58765167f, 0.233853161f},
-std::array<float,2>{0.269761205f, 0.911405623f},
-std::array<float,2>{0.733090639f, 0.781433642f},
-std::array<float,2>{0.480952203f, 0.0276734512f},
-std::array<float,2>{0.959668517f, 0.481408775f},
-std::array<float,2>{0.0775365531f, 0.582329929f},
-std::array<float,2>{0.516241372f, 0.506709516f},
-std::array<float,2>{0.343699902f, 0.419838011f},
-std::array<float,2>{0.819153011f, 0.0652987584f},
-std::array<float,2>{0.157999441f, 0.821193516f},
-std::array<float,2>{0.894099295f, 0.979064345f},
-std::array<float,2>{0.0438142829f, 0.147007287f},
-std::array<float,2>{0.653189063f, 0.279320717f},
-std::array<float,2>{0.420616895f, 0.646654844f},
-std::array<float,2>{0.972106695f, 0.621237576f},
-std::array<float,2>{0.0965709761f, 0.437849164f},
-std::array<float,2>{0.694351196f, 0.0530317873f},
-std::array<float,2>{0.450585663f, 0.757488132f},
-std::array<float,2>{0.615581751f, 0.906241596f},
-std::array<float,2>{0.287525564f, 0.190494433f},
-std::array<float,2>{0.793056309f, 0.312973857f},
-std::array<float,2>{0.210338384f, 0.748069584f},
-std::array<float,2>{0.661563873f, 0.686203718f},
-std::array<float,2>{0.38134411f, 0.306835383f},
-std::array<float,2>{0.90893203f, 0.166897103f},
-std::array<float,2>{0.00224445993f, 0.950560391f},
-std::array<float,2>{0.867411971f, 0.851914704f},
-std::array<float,2>{0.131822214f, 0.10369999f},
-std::array<float,2>{0.552459121f, 0.378932208f},
-std::array<float,2>{0.371747017f, 0.544288456f},
-std::array<float,2>{0.830201626f, 0.554970801f},
-std::array<float,2>{0.180406108f, 0.39835456f},
-std::array<float,2>{0.501880229f, 0.115081877f},
-std::array<float,2>{0.314482003f, 0.861702085f},
-std::array<float,2>{0.632142365f, 0.954972327f},
-std::array<float,2>{0.431382626f, 0.179216281f},
-std::array<float,2>{0.890220284f, 0.284929037f},
-std::array<float,2>{0.0506482311f, 0.663681507f},
-std::array<float,2>{0.576630771f, 0.732925415f},
-std::array<float,2>{0.255402207f, 0.335177958f},
-std::array<float,2>{0.76482898f, 0.214909196f},
-std::array<float,2>{0.231359079f, 0.888885617f},
-std::array<float,2>{0.940531492f, 0.778531909f},
-std::array<float,2>{0.0787396282f, 0.0464538187f},
-std::array<float,2>{0.739950836f, 0.453220129f},
-std::array<float,2>{0.489765078f, 0.59440273f},
-std::array<float,2>{0.927686393f, 0.629926085f},
-std::array<float,2>{0.0273163561f, 0.252325028f},
-std::array<float,2>{0.675654769f, 0.13591364f},
-std::array<float,2>{0.393649995f, 0.995988369f},
-std::array<float,2>{0.537688792f, 0.837220013f},
-std::array<float,2>{0.352002919f, 0.09264189f},
-std::array<float,2>{0.848454952f, 0.435767323f},
-std::array<float,2>{0.144160658f, 0.526472688f},
-std::array<float,2>{0.718563974f, 0.564274907f},
-std::array<float,2>{0.467164546f, 0.498949319f},
-std::array<float,2>{0.987097859f, 0.00663179625f},
-std::array<float,2>{0.1229522f, 0.809419811f},
-std::array<float,2>{0.797806084f, 0.922904551f},
-std::array<float,2>{0.187550187f, 0.244767725f},
-std::array<float,2>{0.607578337f, 0.369788378f},
-std::array<float,2>{0.297565192f, 0.699589193f},
-std::array<float,2>{0.856978118f, 0.671624601f},
-std::array<float,2>{0.14919661f, 0.290472507f},
-std::array<float,2>{0.540627658f, 0.179730728f},
-std::array<float,2>{0.348800987f, 0.962047458f},
-std::array<float,2>{0.6835531f, 0.873445153f},
-std::array<float,2>{0.402295142f, 0.122800082f},
-std::array<float,2>{0.93364656f, 0.401072234f},
-std::array<float,2>{0.0169802532f, 0.548852146f},
-std::array<float,2>{0.601552308f, 0.603777766f},
-std::array<float,2>{0.310730189f, 0.464253098f},
-std::array<float,2>{0.809786022f, 0.0328259245f},
-std::array<float,2>{0.20044136f, 0.768851161f},
-std::array<float,2>{0.995914817f, 0.877777755f},
-std::array<float,2>{0.112222195f, 0.205287889f},
-std::array<float,2>{0.705041885f, 0.337198317f},
-std::array<float,2>{0.45726943f, 0.724917829f},
-std::array<float,2>{0.877925634f, 0.518013716f},
-std::array<float,2>{0.0548954308f, 0.42897445f},
-std::array<float,2>{0.638053f, 0.0795805231f},
-std::array<float,2>{0.427714169f, 0.834704757f},
-std::array<float,2>{0.514884949f, 0.985982597f},
-std::array<float,2>{0.327041477f, 0.127633959f},
-std::array<float,2>{0.836122751f, 0.264134407f},
-std::array<float,2>{0.173381418f, 0.635994256f},
-std::array<float,2>{0.749889016f, 0.688058496f},
-std::array<float,2>{0.493562669f, 0.363991529f},
-std::array<float,2>{0.949307621f, 0.239490911f},
-std::array<float,2>{0.0863109082f, 0.932998538f},
-std::array<float,2>{0.751536071f, 0.798366487f},
-std::array<float,2>{0.222579315f, 0.0131042423f},
-std::array<float,2>{0.564953506f, 0.487568796f},
-std::array<float,2>{0.265297413f, 0.570518017f},
-std::array<float,2>{0.782274187f, 0.59051156f},
-std::array<float,2>{0.215940014f, 0.470154107f},
-std::array<float,2>{0.618604124f, 0.0186438709f},
-std::array<float,2>{0.295009077f, 0.795301676f},
-std::array<float,2>{0.696855485f, 0.916390896f},
-std::array<float,2>{0.437796175f, 0.221315876f},
-std::array<float,2>{0.984199524f, 0.35277319f},
-std::array<float,2>{0.104496494f, 0.717410624f},
-std::array<float,2>{0.557471335f, 0.649976611f},
-std::array<float,2>{0.364315629f, 0.269966722f},
-std::array<float,2>{0.862355113f, 0.153986558f},
-std::array<float,2>{0.134948879f, 0.969908178f},
-std::array<float,2>{0.918642402f, 0.814877808f},
-std::array<float,2>{0.0138840359f, 0.0746934637f},
-std::array<float,2>{0.666435838f, 0.408947438f},
-std::array<float,2>{0.385459989f, 0.514871716f},
-std::array<float,2>{0.961427152f, 0.736805379f},
-std::array<float,2>{0.0647495314f, 0.321321458f},
-std::array<float,2>{0.721622825f, 0.199037328f},
-std::array<float,2>{0.475984901f, 0.895152628f},
-std::array<float,2>{0.582480073f, 0.764092922f},
-std::array<float,2>{0.277529567f, 0.0550959148f},
-std::array<float,2>{0.779842496f, 0.451783657f},
-std::array<float,2>{0.246804714f, 0.61400646f},
-std::array<float,2>{0.644203663f, 0.534095109f},
-std::array<float,2>{0.40986824f, 0.389239132f},
-std::array<float,2>{0.901477754f, 0.094315514f},
-std::array<float,2>{0.0389873311f, 0.84659785f},
-std::array<float,2>{0.827565193f, 0.945041239f},
-std::array<float,2>{0.169056714f, 0.156647131f},
-std::array<float,2>{0.530469358f, 0.300730228f},
-std::array<float,2>{0.33323288f, 0.675643861f},
-std::array<float,2>{0.814665794f, 0.721193552f},
-std::array<float,2>{0.161382854f, 0.34124577f},
-std::array<float,2>{0.520367622f, 0.20991686f},
-std::array<float,2>{0.339272052f, 0.88223809f},
-std::array<float,2>{0.648908854f, 0.773361444f},
-std::array<float,2>{0.416930795f, 0.0366378501f},
-std::array<float,2>{0.894906342f, 0.466884077f},
-std::array<float,2>{0.0419117138f, 0.607002139f},
-std::array<float,2>{0.592622161f, 0.551368475f},
-std::array<float,2>{0.268699199f, 0.403963804f},
-std::array<float,2>{0.768881977f, 0.120817997f},
-std::array<float,2>{0.237635523f, 0.867574394f},
-std::array<float,2>{0.956262589f, 0.968021512f},
-std::array<float,2>{0.0718354732f, 0.184032694f},
-std::array<float,2>{0.727495968f, 0.294027239f},
-std::array<float,2>{0.479390591f, 0.666009426f},
-std::array<float,2>{0.910336792f, 0.576883018f},
-std::array<float,2>{0.00675656321f, 0.488785833f},
-std::array<float,2>{0.659898639f, 0.00841268618f},
-std::array<float,2>{0.376598924f, 0.801585257f},
-std::array<float,2>{0.546964884f, 0.934767962f},
-std::array<float,2>{0.370931953f, 0.237841383f},
-std::array<float,2>{0.871849656f, 0.360831857f},
-std::array<float,2>{0.126096889f, 0.693063736f},
-std::array<float,2>{0.687809527f, 0.637713194f},
-std::array<float,2>{0.448199779f, 0.26112029f},
-std::array<float,2>{0.976036787f, 0.129703954f},
-std::array<float,2>{0.098380968f, 0.990730405f},
-std::array<float,2>{0.791698635f, 0.829535306f},
-std::array<float,2>{0.205990449f, 0.0829056799f},
-std::array<float,2>{0.610629141f, 0.425136179f},
-std::array<float,2>{0.282464713f, 0.520099819f},
-std::array<float,2>{0.759681642f, 0.509417176f},
-std::array<float,2>{0.229562819f, 0.41350922f},
-std::array<float,2>{0.570546091f, 0.0731934085f},
-std::array<float,2>{0.253095865f, 0.817623436f},
-std::array<float,2>{0.735928297f, 0.975759625f},
-std::array<float,2>{0.484564424f, 0.150432318f},
-std::array<float,2>{0.941992879f, 0.269189447f},
-std::array<float,2>{0.083831422f, 0.654959261f},
-std::array<float,2>{0.50435096f, 0.712403595f},
-std::array<float,2>{0.320155412f, 0.357175142f},
-std::array<float,2>{0.834380031f, 0.224262342f},
-std::array<float,2>{0.185924813f, 0.91978693f},
-std::array<float,2>{0.885014474f, 0.790646255f},
-std::array<float,2>{0.052017875f, 0.0225472208f},
-std::array<float,2>{0.628093958f, 0.472723693f},
-std::array<float,2>{0.435031593f, 0.589400351f},
-std::array<float,2>{0.991972744f, 0.677130699f},
-std::array<float,2>{0.117846109f, 0.303711563f},
-std::array<float,2>{0.711065769f, 0.163912833f},
-std::array<float,2>{0.461950749f, 0.937945187f},
-std::array<float,2>{0.604200125f, 0.848475873f},
-std::array<float,2>{0.301693678f, 0.10120476f},
-std::array<float,2>{0.802002609f, 0.385774344f},
-std::array<float,2>{0.194916904f, 0.537628591f},
-std::array<float,2>{0.677451551f, 0.61046499f},
-std::array<float,2>{0.395154595f, 0.446057051f},
-std::array<float,2>{0.92546463f, 0.059219636f},
-std::array<float,2>{0.027706027f, 0.760738194f},
-std::array<float,2>{0.847229302f, 0.893406212f},
-std::array<float,2>{0.145122901f, 0.201915547f},
-std::array<float,2>{0.534496427f, 0.326554865f},
-std::array<float,2>{0.356562883f, 0.739079475f},
-std::array<float,2>{0.805404782f, 0.643403471f},
-std::array<float,2>{0.196671098f, 0.274301112f},
-std::array<float,2>{0.596429467f, 0.141603351f},
-std::array<float,2>{0.308286905f, 0.982292652f},
-std::array<float,2>{0.70976752f, 0.825847685f},
-std::array<float,2>{0.45527041f, 0.0682011321f},
-std::array<float,2>{0.997451842f, 0.416870654f},
-std::array<float,2>{0.114617482f, 0.501086235f},
-std::array<float,2>{0.545573711f, 0.578626931f},
-std::array<float,2>{0.344764143f, 0.478777796f},
-std::array<float,2>{0.855402887f, 0.0253210608f},
-std::array<float,2>{0.152348652f, 0.788409412f},
-std::array<float,2>{0.932943642f, 0.909737825f},
-std::array<float,2>{0.02225147f, 0.230008006f},
-std::array<float,2>{0.684786201f, 0.345069557f},
-std::array<float,2>{0.405002385f, 0.707335949f},
-std::array<float,2>{0.947494745f, 0.54256165f},
-std::array<float,2>{0.0903691426f, 0.378601372f},
-std::array<float,2>{0.743842185f, 0.106188372f},
-std::array<float,2>{0.497238696f, 0.856024921f},
-std::array<float,2>{0.566757262f, 0.945736885f},
-std::array<float,2>{0.260266334f, 0.170464188f},
-std::array<float,2>{0.754855037f, 0.311323524f},
-std::array<float,2>{0.223081157f, 0.682670414f},
-std::array<float,2>{0.636218667f, 0.745075285f},
-std::array<float,2>{0.422760576f, 0.318745822f},
-std::array<float,2>{0.878958702f, 0.19190219f},
-std::array<float,2>{0.0598713048f, 0.902048051f},
-std::array<float,2>{0.84093821f, 0.751511455f},
-std::array<float,2>{0.176331595f, 0.0501326099f},
-std::array<float,2>{0.509154379f, 0.443590999f},
-std::array<float,2>{0.322283983f, 0.619938791f},
-std::array<float,2>{0.865254045f, 0.600142121f},
-std::array<float,2>{0.139839694f, 0.459823787f},
-std::array<float,2>{0.559145153f, 0.0429379717f},
-std::array<float,2>{0.359914422f, 0.775425553f},
-std::array<float,2>{0.668137968f, 0.883744359f},
-std::array<float,2>{0.387865424f, 0.212390557f},
-std::array<float,2>{0.917476594f, 0.328495145f},
-std::array<float,2>{0.00892833993f, 0.72891587f},
-std::array<float,2>{0.622958958f, 0.658346355f},
-std::array<float,2>{0.290079206f, 0.287019253f},
-std::array<float,2>{0.786963522f, 0.173327014f},
-std::array<float,2>{0.211415976f, 0.958658755f},
-std::array<float,2>{0.980438769f, 0.863290191f},
-std::array<float,2>{0.10870754f, 0.110822156f},
-std::array<float,2>{0.702156544f, 0.392065704f},
-std::array<float,2>{0.442894429f, 0.56209147f},
-std::array<float,2>{0.90319097f, 0.695664823f},
-std::array<float,2>{0.0315237306f, 0.371915638f},
-std::array<float,2>{0.644542336f, 0.248122334f},
-std::array<float,2>{0.411508828f, 0.927794158f},
-std::array<float,2>{0.525825858f, 0.805082738f},
-std::array<float,2>{0.329214633f, 0.00284714391f},
-std::array<float,2>{0.822381437f, 0.493934363f},
-std::array<float,2>{0.167502135f, 0.567843735f},
-std::array<float,2>{0.723479807f, 0.528565466f},
-std::array<float,2>{0.470190495f, 0.430721611f},
-std::array<float,2>{0.968746483f, 0.0873691589f},
-std::array<float,2>{0.0678816214f, 0.841555238f},
-std::array<float,2>{0.775433779f, 0.99991858f},
-std::array<float,2>{0.244679421f, 0.136895448f},
-std::array<float,2>{0.580415547f, 0.255236655f},
-std::array<float,2>{0.27500093f, 0.628011227f},
-std::array<float,2>{0.796832383f, 0.74703598f},
-std::array<float,2>{0.207876578f, 0.315730542f},
-std::array<float,2>{0.614289463f, 0.18903254f},
-std::array<float,2>{0.287090242f, 0.903146029f},
-std::array<float,2>{0.691913545f, 0.754412472f},
-std::array<float,2>{0.45279628f, 0.0509868674f},
-std::array<float,2>{0.969821036f, 0.440124422f},
-std::array<float,2>{0.0956427604f, 0.623174489f},
-std::array<float,2>{0.554218531f, 0.546633482f},
-std::array<float,2>{0.374294221f, 0.381897599f},
-std::array<float,2>{0.869540632f, 0.101600602f},
-std::array<float,2>{0.129664883f, 0.853665709f},
-std::array<float,2>{0.907309055f, 0.952537715f},
-std::array<float,2>{0.000220075002f, 0.16503036f},
-std::array<float,2>{0.663160801f, 0.305934906f},
-std::array<float,2>{0.37952736f, 0.684517086f},
-std::array<float,2>{0.95709306f, 0.584819317f},
-std::array<float,2>{0.074700363f, 0.483031869f},
-std::array<float,2>{0.731186569f, 0.0298873968f},
-std::array<float,2>{0.483892769f, 0.784877598f},
-std::array<float,2>{0.58908993f, 0.912345171f},
-std::array<float,2>{0.272642463f, 0.23183921f},
-std::array<float,2>{0.771226227f, 0.349740148f},
-std::array<float,2>{0.238810599f, 0.705190361f},
-std::array<float,2>{0.655201554f, 0.646054864f},
-std::array<float,2>{0.41925925f, 0.278485388f},
-std::array<float,2>{0.891769171f, 0.146055639f},
-std::array<float,2>{0.0454026312f, 0.97697109f},
-std::array<float,2>{0.816683114f, 0.823187411f},
-std::array<float,2>{0.159262165f, 0.0642879382f},
-std::array<float,2>{0.519083619f, 0.421721101f},
-std::array<float,2>{0.340252876f, 0.504924417f},
-std::array<float,2>{0.851259291f, 0.523796797f},
-std::array<float,2>{0.140872791f, 0.434053361f},
-std::array<float,2>{0.53653264f, 0.0901058987f},
-std::array<float,2>{0.354899138f, 0.838682473f},
-std::array<float,2>{0.672940075f, 0.994090319f},
-std::array<float,2>{0.391279817f, 0.134057403f},
-std::array<float,2>{0.928837538f, 0.251095325f},
-std::array<float,2>{0.0235083569f, 0.631859004f},
-std::array<float,2>{0.605990589f, 0.701289892f},
-std::array<float,2>{0.300179362f, 0.367206782f},
-std::array<float,2>{0.800334215f, 0.242614537f},
-std::array<float,2>{0.190075159f, 0.924084067f},
-std::array<float,2>{0.985053122f, 0.810814381f},
-std::array<float,2>{0.124071792f, 0.00434780959f},
-std::array<float,2>{0.715646029f, 0.497051805f},
-std::array<float,2>{0.464951217f, 0.565933943f},
-std::array<float,2>{0.886778772f, 0.661756814f},
-std::array<float,2>{0.047960408f, 0.281799316f},
-std::array<float,2>{0.630832851f, 0.176990032f},
-std::array<float,2>{0.432782769f, 0.956547439f},
-std::array<float,2>{0.502449274f, 0.860095143f},
-std::array<float,2>{0.31413278f, 0.117032632f},
-std::array<float,2>{0.830020964f, 0.395316452f},
-std::array<float,2>{0.183165252f, 0.557284713f},
-std::array<float,2>{0.741396189f, 0.597647965f},
-std::array<float,2>{0.491555601f, 0.456048101f},
-std::array<float,2>{0.93944031f, 0.0437452495f},
-std::array<float,2>{0.0809647068f, 0.779359519f},
-std::array<float,2>{0.76217711f, 0.887313306f},
-std::array<float,2>{0.232954592f, 0.217611045f},
-std::array<float,2>{0.574297309f, 0.333609819f},
-std::array<float,2>{0.256487101f, 0.731186509f},
-std::array<float,2>{0.83847487f, 0.633323312f},
-std::array<float,2>{0.174736485f, 0.26324904f},
-std::array<float,2>{0.512252808f, 0.12557517f},
-std::array<float,2>{0.325210899f, 0.987346351f},
-std::array<float,2>{0.640529096f, 0.832851887f},
-std::array<float,2>{0.429445863f, 0.0817204937f},
-std::array<float,2>{0.876461148f, 0.427123517f},
-std::array<float,2>{0.0574180968f, 0.516830504f},
-std::array<float,2>{0.56292367f, 0.57375139f},
-std::array<float,2>{0.262611896f, 0.484805644f},
-std::array<float,2>{0.752359092f, 0.0152628254f},
-std::array<float,2>{0.218926594f, 0.799019039f},
-std::array<float,2>{0.952924728f, 0.930501759f},
-std::array<float,2>{0.0879388675f, 0.24163577f},
-std::array<float,2>{0.747001946f, 0.366552889f},
-std::array<float,2>{0.496075481f, 0.690200388f},
-std::array<float,2>{0.937444448f, 0.547037661f},
-std::array<float,2>{0.0190778505f, 0.399601042f},
-std::array<float,2>{0.679696023f, 0.124740817f},
-std::array<float,2>{0.399409622f, 0.871472955f},
-std::array<float,2>{0.542840123f, 0.96444267f},
-std::array<float,2>{0.350160897f, 0.182471335f},
-std::array<float,2>{0.858213544f, 0.291230083f},
-std::array<float,2>{0.151876733f, 0.669456899f},
-std::array<float,2>{0.705515921f, 0.723291636f},
-std::array<float,2>{0.459542662f, 0.339795351f},
-std::array<float,2>{0.992231607f, 0.20317243f},
-std::array<float,2>{0.110915303f, 0.876349986f},
-std::array<float,2>{0.810766459f, 0.767407715f},
-std::array<float,2>{0.201528192f, 0.034457799f},
-std::array<float,2>{0.598865569f, 0.461112797f},
-std::array<float,2>{0.310144871f, 0.602119684f},
-std::array<float,2>{0.778503656f, 0.616777778f},
-std::array<float,2>{0.249129787f, 0.449420094f},
-std::array<float,2>{0.584079683f, 0.0579245016f},
-std::array<float,2>{0.280473083f, 0.761820316f},
-std::array<float,2>{0.71917665f, 0.896649003f},
-std::array<float,2>{0.473192006f, 0.196662948f},
-std::array<float,2>{0.964508533f, 0.323263764f},
-std::array<float,2>{0.0630409345f, 0.736027539f},
-std::array<float,2>{0.528146029f, 0.671925724f},
-std::array<float,2>{0.334043115f, 0.297176391f},
-std::array<float,2>{0.825763583f, 0.160000712f},
-std::array<float,2>{0.170940101f, 0.943264782f},
-std::array<float,2>{0.899606287f, 0.844442725f},
-std::array<float,2>{0.0361217745f, 0.0958715752f},
-std::array<float,2>{0.641032934f, 0.3885324f},
-std::array<float,2>{0.406894267f, 0.532319903f},
-std::array<float,2>{0.981770158f, 0.715043247f},
-std::array<float,2>{0.101783313f, 0.353737205f},
-std::array<float,2>{0.698933601f, 0.219836399f},
-std::array<float,2>{0.440242589f, 0.914668262f},
-std::array<float,2>{0.619806647f, 0.794202685f},
-std::array<float,2>{0.294432759f, 0.0168115757f},
-std::array<float,2>{0.783452749f, 0.471156716f},
-std::array<float,2>{0.217155814f, 0.592250407f},
-std::array<float,2>{0.664547384f, 0.513475418f},
-std::array<float,2>{0.382932603f, 0.406271189f},
-std::array<float,2>{0.92142272f, 0.0762779117f},
-std::array<float,2>{0.0118754748f, 0.81350106f},
-std::array<float,2>{0.86080879f, 0.971555769f},
-std::array<float,2>{0.133342981f, 0.154720262f},
-std::array<float,2>{0.556182504f, 0.272540003f},
-std::array<float,2>{0.365665048f, 0.652206421f},
-std::array<float,2>{0.874183774f, 0.694212675f},
-std::array<float,2>{0.127586961f, 0.361679077f},
-std::array<float,2>{0.549837947f, 0.236064404f},
-std::array<float,2>{0.368667126f, 0.936763644f},
-std::array<float,2>{0.656958938f, 0.803789914f},
-std::array<float,2>{0.378433228f, 0.0116630634f},
-std::array<float,2>{0.91224736f, 0.491932601f},
-std::array<float,2>{0.00447906973f, 0.574358881f},
-std::array<float,2>{0.611658037f, 0.521514654f},
-std::array<float,2>{0.284769297f, 0.42310214f},
-std::array<float,2>{0.790796995f, 0.0845243111f},
-std::array<float,2>{0.203222528f, 0.830886483f},
-std::array<float,2>{0.972956538f, 0.989494801f},
-std::array<float,2>{0.100657031f, 0.132204443f},
-std::array<float,2>{0.690557837f, 0.259604037f},
-std::array<float,2>{0.4460136f, 0.639249623f},
-std::array<float,2>{0.897071421f, 0.609077692f},
-std::array<float,2>{0.0408701077f, 0.465225428f},
-std::array<float,2>{0.650954545f, 0.0375394709f},
-std::array<float,2>{0.414112926f, 0.769533634f},
-std::array<float,2>{0.522619843f, 0.878970265f},
-std::array<float,2>{0.336336136f, 0.208193973f},
-std::array<float,2>{0.812792957f, 0.341932476f},
-std::array<float,2>{0.162315086f, 0.719160438f},
-std::array<float,2>{0.730020165f, 0.666609466f},
-std::array<float,2>{0.476957917f, 0.296565473f},
-std::array<float,2>{0.954568624f, 0.186242372f},
-std::array<float,2>{0.0740152672f, 0.965270221f},
-std::array<float,2>{0.766293585f, 0.870337903f},
-std::array<float,2>{0.235439941f, 0.118585579f},
-std::array<float,2>{0.591230571f, 0.405136645f},
-std::array<float,2>{0.267003804f, 0.554617107f},
-std::array<float,2>{0.804365993f, 0.535577774f},
-std::array<float,2>{0.191760957f, 0.383393914f},
-std::array<float,2>{0.602771223f, 0.0978429168f},
-std::array<float,2>{0.303685695f, 0.851464033f},
-std::array<float,2>{0.714535356f, 0.940963268f},
-std::array<float,2>{0.4636271f, 0.161894903f},
-std::array<float,2>{0.98857069f, 0.301665038f},
-std::array<float,2>{0.119823568f, 0.678130209f},
-std::array<float,2>{0.532592714f, 0.740850091f},
-std::array<float,2>{0.358422667f, 0.325515717f},
-std::array<float,2>{0.844763577f, 0.199420705f},
-std::array<float,2>{0.147567257f, 0.891687036f},
-std::array<float,2>{0.923669159f, 0.759606659f},
-std::array<float,2>{0.0309951864f, 0.0621193275f},
-std::array<float,2>{0.678710938f, 0.447327256f},
-std::array<float,2>{0.397380948f, 0.613181412f},
-std::array<float,2>{0.945216417f, 0.652469277f},
-std::array<float,2>{0.0840651244f, 0.266839892f},
-std::array<float,2>{0.736625671f, 0.148597747f},
-std::array<float,2>{0.486336827f, 0.974347055f},
-std::array<float,2>{0.574003756f, 0.818867028f},
-std::array<float,2>{0.250545204f, 0.0722329244f},
-std::array<float,2>{0.759987712f, 0.410445988f},
-std::array<float,2>{0.228121772f, 0.51140976f},
-std::array<float,2>{0.625375569f, 0.586004198f},
-std::array<float,2>{0.435768843f, 0.475525767f},
-std::array<float,2>{0.883749306f, 0.0204478875f},
-std::array<float,2>{0.0535980947f, 0.791550279f},
-std::array<float,2>{0.832823217f, 0.920704424f},
-std::array<float,2>{0.184439391f, 0.224856526f},
-std::array<float,2>{0.507055163f, 0.35873729f},
-std::array<float,2>{0.317052245f, 0.714282334f},
-std::array<float,2>{0.75622648f, 0.680943191f},
-std::array<float,2>{0.225412935f, 0.309103668f},
-std::array<float,2>{0.568395793f, 0.169066951f},
-std::array<float,2>{0.258441865f, 0.948873878f},
-std::array<float,2>{0.744767308f, 0.858289897f},
-std::array<float,2>{0.498187155f, 0.108837046f},
-std::array<float,2>{0.945861459f, 0.37565136f},
-std::array<float,2>{0.0935727581f, 0.540052176f},
-std::array<float,2>{0.511435509f, 0.617595971f},
-std::array<float,2>{0.321467668f, 0.441527396f},
-std::array<float,2>{0.843740404f, 0.048061166f},
-std::array<float,2>{0.17794773f, 0.752060413f},
-std::array<float,2>{0.881649911f, 0.899471402f},
-std::array<float,2>{0.060930863f, 0.194099322f},
-std::array<float,2>{0.634249508f, 0.317506105f},
-std::array<float,2>{0.425597787f, 0.742551565f},
-std::array<float,2>{0.998816967f, 0.50353986f},
-std::array<float,2>{0.116330571f, 0.415341347f},
-std::array<float,2>{0.708954692f, 0.0687220767f},
-std::array<float,2>{0.454655528f, 0.826920271f},
-std::array<float,2>{0.594416678f, 0.984367371f},
-std::array<float,2>{0.305349588f, 0.143026009f},
-std::array<float,2>{0.807351828f, 0.276184648f},
-std::array<float,2>{0.197595179f, 0.641311705f},
-std::array<float,2>{0.686873019f, 0.709405839f},
-std::array<float,2>{0.402972281f, 0.346272677f},
-std::array<float,2>{0.93020469f, 0.227134228f},
-std::array<float,2>{0.0195728876f, 0.908046782f},
-std::array<float,2>{0.852204502f, 0.787046432f},
-std::array<float,2>{0.154730707f, 0.0266506374f},
-std::array<float,2>{0.543711364f, 0.476937026f},
-std::array<float,2>{0.347091377f, 0.580814898f},
-std::array<float,2>{0.821531653f, 0.570245087f},
-std::array<float,2>{0.164963797f, 0.495591015f},
-std::array<float,2>{0.523881495f, 0.00103444641f},
-std::array<float,2>{0.331627548f, 0.808022201f},
-std::array<float,2>{0.647729635f, 0.92663002f},
-std::array<float,2>{0.414007932f, 0.246093854f},
-std::array<float,2>{0.905304313f, 0.374072045f},
-std::array<float,2>{0.0332929231f, 0.698100924f},
-std::array<float,2>{0.579874039f, 0.626624227f},
-std::array<float,2>{0.277281106f, 0.256912053f},
-std::array<float,2>{0.773900092f, 0.140522629f},
-std::array<float,2>{0.242593706f, 0.997086585f},
-std::array<float,2>{0.966423094f, 0.843468368f},
-std::array<float,2>{0.069899857f, 0.0883034766f},
-std::array<float,2>{0.725290418f, 0.433441073f},
-std::array<float,2>{0.472503126f, 0.530422151f},
-std::array<float,2>{0.915066898f, 0.728093624f},
-std::array<float,2>{0.0115840603f, 0.330794007f},
-std::array<float,2>{0.671479464f, 0.214691833f},
-std::array<float,2>{0.389721215f, 0.88528055f},
-std::array<float,2>{0.562024474f, 0.775009036f},
-std::array<float,2>{0.361477017f, 0.0400849879f},
-std::array<float,2>{0.86494422f, 0.458415538f},
-std::array<float,2>{0.137241662f, 0.598802328f},
-std::array<float,2>{0.701113343f, 0.560108721f},
-std::array<float,2>{0.444509923f, 0.394289374f},
-std::array<float,2>{0.97824192f, 0.113215335f},
-std::array<float,2>{0.106973007f, 0.865283549f},
-std::array<float,2>{0.788054645f, 0.959595203f},
-std::array<float,2>{0.213094175f, 0.174541369f},
-std::array<float,2>{0.6249578f, 0.288485497f},
-std::array<float,2>{0.291379303f, 0.656824887f},
-std::array<float,2>{0.764503717f, 0.731776357f},
-std::array<float,2>{0.232129171f, 0.33247444f},
-std::array<float,2>{0.577452302f, 0.218540385f},
-std::array<float,2>{0.254280716f, 0.888409615f},
-std::array<float,2>{0.738747597f, 0.780813932f},
-std::array<float,2>{0.488755047f, 0.0446050949f},
-std::array<float,2>{0.940016389f, 0.456473738f},
-std::array<float,2>{0.0798995048f, 0.59582144f},
-std::array<float,2>{0.500005007f, 0.558490157f},
-std::array<float,2>{0.316052586f, 0.3960118f},
-std::array<float,2>{0.831310689f, 0.115492232f},
-std::array<float,2>{0.181373477f, 0.860648811f},
-std::array<float,2>{0.889436305f, 0.955305576f},
-std::array<float,2>{0.0496475101f, 0.175968334f},
-std::array<float,2>{0.630933464f, 0.282292694f},
-std::array<float,2>{0.430652678f, 0.661020219f},
-std::array<float,2>{0.987438679f, 0.564772785f},
-std::array<float,2>{0.121298082f, 0.497572541f},
-std::array<float,2>{0.717171013f, 0.0054874476f},
-std::array<float,2>{0.468019515f, 0.811732173f},
-std::array<float,2>{0.608633339f, 0.92509675f},
-std::array<float,2>{0.297963202f, 0.243977472f},
-std::array<float,2>{0.798258126f, 0.368182451f},
-std::array<float,2>{0.188875243f, 0.702493072f},
-std::array<float,2>{0.673872888f, 0.631656885f},
-std::array<float,2>{0.393464953f, 0.250066489f},
-std::array<float,2>{0.926273167f, 0.132954717f},
-std::array<float,2>{0.0262490679f, 0.99287194f},
-std::array<float,2>{0.84891659f, 0.83908397f},
-std::array<float,2>{0.14299725f, 0.0912997425f},
-std::array<float,2>{0.538548648f, 0.434826523f},
-std::array<float,2>{0.353083491f, 0.524609804f},
-std::array<float,2>{0.819399595f, 0.504064322f},
-std::array<float,2>{0.157138839f, 0.420746982f},
-std::array<float,2>{0.516939878f, 0.0625276938f},
-std::array<float,2>{0.342725188f, 0.824056745f},
-std::array<float,2>{0.654003501f, 0.977608919f},
-std::array<float,2>{0.421729505f, 0.145139396f},
-std::array<float,2>{0.892700076f, 0.277399302f},
-std::array<float,2>{0.0441182666f, 0.644785881f},
-std::array<float,2>{0.586194277f, 0.706725657f},
-std::array<float,2>{0.270708501f, 0.351146251f},
-std::array<float,2>{0.771526396f, 0.230473638f},
-std::array<float,2>{0.241063312f, 0.913353205f},
-std::array<float,2>{0.960707605f, 0.783589602f},
-std::array<float,2>{0.0762298703f, 0.0311380345f},
-std::array<float,2>{0.733421385f, 0.484079242f},
-std::array<float,2>{0.481913239f, 0.585134029f},
-std::array<float,2>{0.909919322f, 0.685239077f},
-std::array<float,2>{0.00339542306f, 0.304762065f},
-std::array<float,2>{0.660655558f, 0.165549546f},
-std::array<float,2>{0.382463545f, 0.952088773f},
-std::array<float,2>{0.55115068f, 0.854928613f},
-std::array<float,2>{0.372204393f, 0.102796353f},
-std::array<float,2>{0.868428767f, 0.38126865f},
-std::array<float,2>{0.132306308f, 0.545019984f},
-std::array<float,2>{0.69432354f, 0.624365389f},
-std::array<float,2>{0.449278444f, 0.440725625f},
-std::array<float,2>{0.971106172f, 0.0521092713f},
-std::array<float,2>{0.0974540487f, 0.754943728f},
-std::array<float,2>{0.794082403f, 0.90345645f},
-std::array<float,2>{0.20971024f, 0.188117027f},
-std::array<float,2>{0.616535127f, 0.314636618f},
-std::array<float,2>{0.289057195f, 0.7479164f},
-std::array<float,2>{0.861954093f, 0.651227534f},
-std::array<float,2>{0.136385262f, 0.272016466f},
-std::array<float,2>{0.558576405f, 0.155381083f},
-std::array<float,2>{0.363649279f, 0.972447097f},
-std::array<float,2>{0.667722702f, 0.812805593f},
-std::array<float,2>{0.386610359f, 0.0778663233f},
-std::array<float,2>{0.919242263f, 0.407785356f},
-std::array<float,2>{0.0150421886f, 0.512145162f},
-std::array<float,2>{0.617247641f, 0.593393683f},
-std::array<float,2>{0.296673894f, 0.4719733f},
-std::array<float,2>{0.781305015f, 0.0157019552f},
-std::array<float,2>{0.215194777f, 0.793362319f},
-std::array<float,2>{0.983328223f, 0.915556192f},
-std::array<float,2>{0.104250573f, 0.219597265f},
-std::array<float,2>{0.695331037f, 0.355122954f},
-std::array<float,2>{0.438992292f, 0.716314018f},
-std::array<float,2>{0.901176572f, 0.531611443f},
-std::array<float,2>{0.0380195528f, 0.387361079f},
-std::array<float,2>{0.643385291f, 0.0968668386f},
-std::array<float,2>{0.408964217f, 0.844923735f},
-std::array<float,2>{0.530039012f, 0.941473067f},
-std::array<float,2>{0.332073987f, 0.158918828f},
-std::array<float,2>{0.826888978f, 0.297869593f},
-std::array<float,2>{0.168808877f, 0.673212767f},
-std::array<float,2>{0.722125709f, 0.73499459f},
-std::array<float,2>{0.474799395f, 0.322375476f},
-std::array<float,2>{0.962870002f, 0.196196184f},
-std::array<float,2>{0.0658528134f, 0.898269415f},
-std::array<float,2>{0.780705214f, 0.762855887f},
-std::array<float,2>{0.24715516f, 0.0570544004f},
-std::array<float,2>{0.583950341f, 0.450409234f},
-std::array<float,2>{0.279207468f, 0.616019726f},
-std::array<float,2>{0.809152901f, 0.603316545f},
-std::array<float,2>{0.199387684f, 0.462830216f},
-std::array<float,2>{0.600453556f, 0.0340645127f},
-std::array<float,2>{0.312250137f, 0.765999138f},
-std::array<float,2>{0.70325315f, 0.875151932f},
-std::array<float,2>{0.458351582f, 0.204190597f},
-std::array<float,2>{0.99500829f, 0.338558495f},
-std::array<float,2>{0.11298357f, 0.724352181f},
-std::array<float,2>{0.539888561f, 0.668839872f},
-std::array<float,2>{0.348013401f, 0.292931229f},
-std::array<float,2>{0.856336653f, 0.182886481f},
-std::array<float,2>{0.150279105f, 0.963546038f},
-std::array<float,2>{0.935063899f, 0.872950256f},
-std::array<float,2>{0.0158835929f, 0.123111665f},
-std::array<float,2>{0.681865335f, 0.398576021f},
-std::array<float,2>{0.400484622f, 0.547909379f},
-std::array<float,2>{0.950479388f, 0.691305399f},
-std::array<float,2>{0.0877956077f, 0.365749598f},
-std::array<float,2>{0.748305917f, 0.240758583f},
-std::array<float,2>{0.493007541f, 0.931425214f},
-std::array<float,2>{0.565881729f, 0.800307214f},
-std::array<float,2>{0.264436513f, 0.0144042345f},
-std::array<float,2>{0.750479281f, 0.486027747f},
-std::array<float,2>{0.221485034f, 0.572872877f},
-std::array<float,2>{0.637686133f, 0.515796781f},
-std::array<float,2>{0.426570356f, 0.426518768f},
-std::array<float,2>{0.878481984f, 0.0801688656f},
-std::array<float,2>{0.0565714426f, 0.833492577f},
-std::array<float,2>{0.837716103f, 0.986867607f},
-std::array<float,2>{0.172774658f, 0.126758307f},
-std::array<float,2>{0.514060438f, 0.261770427f},
-std::array<float,2>{0.327999353f, 0.634740889f},
-std::array<float,2>{0.835543633f, 0.713120699f},
-std::array<float,2>{0.18731235f, 0.357749909f},
-std::array<float,2>{0.505145609f, 0.226031452f},
-std::array<float,2>{0.318563223f, 0.921660483f},
-std::array<float,2>{0.627177238f, 0.792048991f},
-std::array<float,2>{0.434024811f, 0.0207786597f},
-std::array<float,2>{0.886126995f, 0.475874811f},
-std::array<float,2>{0.0510061793f, 0.587072313f},
-std::array<float,2>{0.571537733f, 0.510468125f},
-std::array<float,2>{0.252905935f, 0.411795318f},
-std::array<float,2>{0.758564174f, 0.0712016672f},
-std::array<float,2>{0.229039133f, 0.820162356f},
-std::array<float,2>{0.943082809f, 0.973446786f},
-std::array<float,2>{0.0826068223f, 0.15015693f},
-std::array<float,2>{0.735005498f, 0.2658301f},
-std::array<float,2>{0.486212909f, 0.653813779f},
-std::array<float,2>{0.924156427f, 0.61221844f},
-std::array<float,2>{0.0287116654f, 0.448638856f},
-std::array<float,2>{0.676029146f, 0.0609778576f},
-std::array<float,2>{0.396259218f, 0.758512676f},
-std::array<float,2>{0.533250928f, 0.890780509f},
-std::array<float,2>{0.355541289f, 0.200258091f},
-std::array<float,2>{0.845960975f, 0.324275225f},
-std::array<float,2>{0.145976365f, 0.741602302f},
-std::array<float,2>{0.712495446f, 0.679231167f},
-std::array<float,2>{0.461271673f, 0.30196169f},
-std::array<float,2>{0.990646303f, 0.160283729f},
-std::array<float,2>{0.118510775f, 0.939636648f},
-std::array<float,2>{0.800870717f, 0.850208998f},
-std::array<float,2>{0.194290996f, 0.0992156118f},
-std::array<float,2>{0.6045717f, 0.383978933f},
-std::array<float,2>{0.302731305f, 0.536900938f},
-std::array<float,2>{0.768030167f, 0.552991092f},
-std::array<float,2>{0.236372024f, 0.406196237f},
-std::array<float,2>{0.592828631f, 0.117985457f},
-std::array<float,2>{0.268543929f, 0.869171321f},
-std::array<float,2>{0.728432596f, 0.965821087f},
-std::array<float,2>{0.480113745f, 0.187044591f},
-std::array<float,2>{0.955311179f, 0.295786351f},
-std::array<float,2>{0.0707432777f, 0.667323172f},
-std::array<float,2>{0.521475554f, 0.720092297f},
-std::array<float,2>{0.338412791f, 0.343500733f},
-std::array<float,2>{0.816198587f, 0.207164258f},
-std::array<float,2>{0.160169154f, 0.879956126f},
-std::array<float,2>{0.895570457f, 0.77091074f},
-std::array<float,2>{0.0425016358f, 0.0389314555f},
-std::array<float,2>{0.649958849f, 0.46624583f},
-std::array<float,2>{0.417279541f, 0.60811609f},
-std::array<float,2>{0.974680662f, 0.639881909f},
-std::array<float,2>{0.0986977667f, 0.25826019f},
-std::array<float,2>{0.689398289f, 0.13158001f},
-std::array<float,2>{0.448417604f, 0.988717258f},
-std::array<float,2>{0.609748006f, 0.831430972f},
-std::array<float,2>{0.281852216f, 0.085344404f},
-std::array<float,2>{0.79274565f, 0.422308862f},
-std::array<float,2>{0.206528977f, 0.52315855f},
-std::array<float,2>{0.658468127f, 0.575475752f},
-std::array<float,2>{0.375603229f, 0.490657389f},
-std::array<float,2>{0.911799133f, 0.0104341572f},
-std::array<float,2>{0.00693038758f, 0.803587675f},
-std::array<float,2>{0.872292697f, 0.935695589f},
-std::array<float,2>{0.125364736f, 0.234835967f},
-std::array<float,2>{0.548772991f, 0.362940758f},
-std::array<float,2>{0.369527042f, 0.695278049f},
-std::array<float,2>{0.785311341f, 0.65752089f},
-std::array<float,2>{0.212828115f, 0.287756354f},
-std::array<float,2>{0.621485472f, 0.175341904f},
-std::array<float,2>{0.289359659f, 0.960276008f},
-std::array<float,2>{0.701982677f, 0.866486073f},
-std::array<float,2>{0.442194909f, 0.111809246f},
-std::array<float,2>{0.978633106f, 0.392980963f},
-std::array<float,2>{0.108152717f, 0.55934f},
-std::array<float,2>{0.55974865f, 0.598626137f},
-std::array<float,2>{0.360500157f, 0.457390279f},
-std::array<float,2>{0.866487503f, 0.0396399237f},
-std::array<float,2>{0.139426187f, 0.774134934f},
-std::array<float,2>{0.916341543f, 0.886646092f},
-std::array<float,2>{0.00813703239f, 0.213046998f},
-std::array<float,2>{0.669841766f, 0.331124693f},
-std::array<float,2>{0.387057632f, 0.727443337f},
-std::array<float,2>{0.967585266f, 0.530093133f},
-std::array<float,2>{0.0668725371f, 0.432208806f},
-std::array<float,2>{0.724062026f, 0.0892172381f},
-std::array<float,2>{0.469355732f, 0.842697144f},
-std::array<float,2>{0.581342578f, 0.996154368f},
-std::array<float,2>{0.273634583f, 0.13946183f},
-std::array<float,2>{0.776614785f, 0.256258458f},
-std::array<float,2>{0.245461792f, 0.625158966f},
-std::array<float,2>{0.646396041f, 0.698742807f},
-std::array<float,2>{0.410164744f, 0.373113662f},
-std::array<float,2>{0.903378427f, 0.248023435f},
-std::array<float,2>{0.0329379737f, 0.927021623f},
-std::array<float,2>{0.823569775f, 0.806723714f},
-std::array<float,2>{0.166814446f, 0.000392845744f},
-std::array<float,2>{0.526543736f, 0.494209886f},
-std::array<float,2>{0.329073071f, 0.568978608f},
-std::array<float,2>{0.854076087f, 0.581510544f},
-std::array<float,2>{0.153826535f, 0.477695525f},
-std::array<float,2>{0.546672404f, 0.0256084818f},
-std::array<float,2>{0.344103485f, 0.78557229f},
-std::array<float,2>{0.684173882f, 0.907064438f},
-std::array<float,2>{0.406132489f, 0.227773905f},
-std::array<float,2>{0.931910992f, 0.346777201f},
-std::array<float,2>{0.0225332566f, 0.710272491f},
-std::array<float,2>{0.596797347f, 0.642448843f},
-std::array<float,2>{0.306785107f, 0.276684076f},
-std::array<float,2>{0.80583775f, 0.143620118f},
-std::array<float,2>{0.196033731f, 0.983097315f},
-std::array<float,2>{0.99691391f, 0.827705264f},
-std::array<float,2>{0.114146464f, 0.0693960339f},
-std::array<float,2>{0.710482538f, 0.414120197f},
-std::array<float,2>{0.456268787f, 0.502774417f},
-std::array<float,2>{0.880503654f, 0.744034827f},
-std::array<float,2>{0.0589737482f, 0.316906095f},
-std::array<float,2>{0.634973168f, 0.195199266f},
-std::array<float,2>{0.423655063f, 0.899401963f},
-std::array<float,2>{0.508030772f, 0.753319263f},
-std::array<float,2>{0.32413134f, 0.0474735647f},
-std::array<float,2>{0.840581656f, 0.443250149f},
-std::array<float,2>{0.177275583f, 0.618347526f},
-std::array<float,2>{0.743013024f, 0.539209783f},
-std::array<float,2>{0.496302009f, 0.376122177f},
-std::array<float,2>{0.949190378f, 0.10798467f},
-std::array<float,2>{0.0910560861f, 0.85847801f},
-std::array<float,2>{0.755113125f, 0.947926939f},
-std::array<float,2>{0.224399924f, 0.168351382f},
-std::array<float,2>{0.567785859f, 0.309865266f},
-std::array<float,2>{0.260834485f, 0.680286109f},
-std::array<float,2>{0.799139857f, 0.700943887f},
-std::array<float,2>{0.191323638f, 0.370384276f},
-std::array<float,2>{0.606635451f, 0.245910347f},
-std::array<float,2>{0.299016237f, 0.92264843f},
-std::array<float,2>{0.715961277f, 0.810350597f},
-std::array<float,2>{0.466636479f, 0.00779466424f},
-std::array<float,2>{0.985484064f, 0.499444187f},
-std::array<float,2>{0.123878375f, 0.562764108f},
-std::array<float,2>{0.535280883f, 0.526276827f},
-std::array<float,2>{0.354006171f, 0.436739892f},
-std::array<float,2>{0.849647343f, 0.0931541473f},
-std::array<float,2>{0.141801387f, 0.836504579f},
-std::array<float,2>{0.928222299f, 0.994396508f},
-std::array<float,2>{0.0246680304f, 0.134812564f},
-std::array<float,2>{0.6720649f, 0.253218651f},
-std::array<float,2>{0.391913146f, 0.629388452f},
-std::array<float,2>{0.938270986f, 0.59523052f},
-std::array<float,2>{0.0810863152f, 0.454400688f},
-std::array<float,2>{0.740815699f, 0.0450092331f},
-std::array<float,2>{0.4902623f, 0.778297663f},
-std::array<float,2>{0.575976968f, 0.889911294f},
-std::array<float,2>{0.257165253f, 0.216692552f},
-std::array<float,2>{0.76300925f, 0.334659606f},
-std::array<float,2>{0.233818561f, 0.734326541f},
-std::array<float,2>{0.62967813f, 0.662840366f},
-std::array<float,2>{0.432592154f, 0.283837885f},
-std::array<float,2>{0.888428092f, 0.178459793f},
-std::array<float,2>{0.0475440696f, 0.95388037f},
-std::array<float,2>{0.828585982f, 0.862377644f},
-std::array<float,2>{0.182574779f, 0.113900311f},
-std::array<float,2>{0.503383636f, 0.397327304f},
-std::array<float,2>{0.313338161f, 0.555943072f},
-std::array<float,2>{0.870137334f, 0.54388243f},
-std::array<float,2>{0.130706996f, 0.380427003f},
-std::array<float,2>{0.55312252f, 0.105031356f},
-std::array<float,2>{0.373915493f, 0.853390038f},
-std::array<float,2>{0.663024664f, 0.950165391f},
-std::array<float,2>{0.380710483f, 0.167569563f},
-std::array<float,2>{0.906780303f, 0.308423728f},
-std::array<float,2>{0.00194726163f, 0.687357545f},
-std::array<float,2>{0.613611102f, 0.749884903f},
-std::array<float,2>{0.286040097f, 0.313768864f},
-std::array<float,2>{0.795519173f, 0.190204054f},
-std::array<float,2>{0.208536893f, 0.905199289f},
-std::array<float,2>{0.969129264f, 0.756283581f},
-std::array<float,2>{0.0939588696f, 0.0538379885f},
-std::array<float,2>{0.692402601f, 0.439449519f},
-std::array<float,2>{0.451623172f, 0.622179449f},
-std::array<float,2>{0.890626609f, 0.648387909f},
-std::array<float,2>{0.0468642786f, 0.281235039f},
-std::array<float,2>{0.655800462f, 0.148355633f},
-std::array<float,2>{0.418137491f, 0.980211973f},
-std::array<float,2>{0.518345773f, 0.821423769f},
-std::array<float,2>{0.341220886f, 0.0656636879f},
-std::array<float,2>{0.817452788f, 0.418820769f},
-std::array<float,2>{0.158942476f, 0.506965041f},
-std::array<float,2>{0.731946111f, 0.583970428f},
-std::array<float,2>{0.48250407f, 0.481880188f},
-std::array<float,2>{0.958671153f, 0.0289967414f},
-std::array<float,2>{0.0753786638f, 0.782850921f},
-std::array<float,2>{0.769875109f, 0.910331786f},
-std::array<float,2>{0.240033761f, 0.233021289f},
-std::array<float,2>{0.588629425f, 0.348470002f},
-std::array<float,2>{0.27170065f, 0.703377008f},
-std::array<float,2>{0.824590147f, 0.674338877f},
-std::array<float,2>{0.17040503f, 0.29886362f},
-std::array<float,2>{0.528938293f, 0.157850891f},
-std::array<float,2>{0.33560881f, 0.943488181f},
-std::array<float,2>{0.642117798f, 0.84731108f},
-std::array<float,2>{0.407836348f, 0.0952857733f},
-std::array<float,2>{0.899360478f, 0.390388578f},
-std::array<float,2>{0.0361446664f, 0.534431458f},
-std::array<float,2>{0.585071206f, 0.61502856f},
-std::array<float,2>{0.28003487f, 0.452604681f},
-std::array<float,2>{0.777956545f, 0.0558168329f},
-std::array<float,2>{0.248485863f, 0.765052438f},
-std::array<float,2>{0.963346004f, 0.896336377f},
-std::array<float,2>{0.0639936998f, 0.197876334f},
-std::array<float,2>{0.720499754f, 0.320929259f},
-std::array<float,2>{0.474422812f, 0.737541735f},
-std::array<float,2>{0.920110404f, 0.514392853f},
-std::array<float,2>{0.01309173f, 0.409597218f},
-std::array<float,2>{0.665789604f, 0.0752418563f},
-std::array<float,2>{0.384041578f, 0.816231012f},
-std::array<float,2>{0.555596471f, 0.96892339f},
-std::array<float,2>{0.367123961f, 0.153060973f},
-std::array<float,2>{0.85942167f, 0.271204799f},
-std::array<float,2>{0.134729996f, 0.648971736f},
-std::array<float,2>{0.698229074f, 0.718632579f},
-std::array<float,2>{0.440975517f, 0.351893157f},
-std::array<float,2>{0.980977952f, 0.222509578f},
-std::array<float,2>{0.102871843f, 0.917570889f},
-std::array<float,2>{0.784378946f, 0.796504378f},
-std::array<float,2>{0.218253791f, 0.0177164879f},
-std::array<float,2>{0.620977461f, 0.469012856f},
-std::array<float,2>{0.293227941f, 0.591089189f},
-std::array<float,2>{0.753893554f, 0.572151482f},
-std::array<float,2>{0.220206931f, 0.487175524f},
-std::array<float,2>{0.563907981f, 0.0119572664f},
-std::array<float,2>{0.263029456f, 0.79716599f},
-std::array<float,2>{0.747465909f, 0.932183385f},
-std::array<float,2>{0.494397312f, 0.238845602f},
-std::array<float,2>{0.951335728f, 0.364512324f},
-std::array<float,2>{0.0888805464f, 0.688505948f},
-std::array<float,2>{0.512800276f, 0.635696888f},
-std::array<float,2>{0.324294865f, 0.265352666f},
-std::array<float,2>{0.839212716f, 0.128368616f},
-std::array<float,2>{0.17559965f, 0.985139489f},
-std::array<float,2>{0.875095427f, 0.835264981f},
-std::array<float,2>{0.0576470792f, 0.0789008513f},
-std::array<float,2>{0.63927722f, 0.428040981f},
-std::array<float,2>{0.427953303f, 0.519328475f},
-std::array<float,2>{0.993323088f, 0.726288497f},
-std::array<float,2>{0.109685369f, 0.336266726f},
-std::array<float,2>{0.706604064f, 0.20690693f},
-std::array<float,2>{0.460335076f, 0.878542066f},
-std::array<float,2>{0.598120868f, 0.767730892f},
-std::array<float,2>{0.309547305f, 0.0314866193f},
-std::array<float,2>{0.812201798f, 0.463569671f},
-std::array<float,2>{0.202685922f, 0.605026782f},
-std::array<float,2>{0.680953085f, 0.550500631f},
-std::array<float,2>{0.399630427f, 0.402057022f},
-std::array<float,2>{0.935946405f, 0.121193677f},
-std::array<float,2>{0.0178535525f, 0.87498498f},
-std::array<float,2>{0.858661354f, 0.961783767f},
-std::array<float,2>{0.150468796f, 0.181621984f},
-std::array<float,2>{0.541838706f, 0.289525062f},
-std::array<float,2>{0.350727051f, 0.670039952f},
-std::array<float,2>{0.844530463f, 0.740068913f},
-std::array<float,2>{0.146785513f, 0.32798782f},
-std::array<float,2>{0.531683505f, 0.202880099f},
-std::array<float,2>{0.357489288f, 0.893802822f},
-std::array<float,2>{0.678966522f, 0.760970712f},
-std::array<float,2>{0.39835459f, 0.0604441725f},
-std::array<float,2>{0.922344089f, 0.446445465f},
-std::array<float,2>{0.0295582805f, 0.609964669f},
-std::array<float,2>{0.602070034f, 0.538948596f},
-std::array<float,2>{0.303781778f, 0.384913117f},
-std::array<float,2>{0.803075612f, 0.0999700055f},
-std::array<float,2>{0.192873955f, 0.849370658f},
-std::array<float,2>{0.990147293f, 0.938684821f},
-std::array<float,2>{0.12073563f, 0.162228405f},
-std::array<float,2>{0.713043272f, 0.303122461f},
-std::array<float,2>{0.464338064f, 0.676503479f},
-std::array<float,2>{0.884005666f, 0.588481843f},
-std::array<float,2>{0.0539425053f, 0.473847121f},
-std::array<float,2>{0.626256049f, 0.0221068785f},
-std::array<float,2>{0.437356234f, 0.789633095f},
-std::array<float,2>{0.506829381f, 0.918830991f},
-std::array<float,2>{0.318064839f, 0.222658589f},
-std::array<float,2>{0.833924651f, 0.355744511f},
-std::array<float,2>{0.185456082f, 0.711015046f},
-std::array<float,2>{0.737722456f, 0.655842304f},
-std::array<float,2>{0.487740993f, 0.268095046f},
-std::array<float,2>{0.94386673f, 0.151865646f},
-std::array<float,2>{0.0856593102f, 0.974977374f},
-std::array<float,2>{0.761533737f, 0.817072451f},
-std::array<float,2>{0.227292478f, 0.0740084499f},
-std::array<float,2>{0.572686613f, 0.41268307f},
-std::array<float,2>{0.251082093f, 0.508237541f},
-std::array<float,2>{0.78919369f, 0.520905375f},
-std::array<float,2>{0.204388112f, 0.424012214f},
-std::array<float,2>{0.612553895f, 0.083616212f},
-std::array<float,2>{0.283647835f, 0.829011321f},
-std::array<float,2>{0.689857602f, 0.991341352f},
-std::array<float,2>{0.447207272f, 0.130115658f},
-std::array<float,2>{0.973752856f, 0.260372639f},
-std::array<float,2>{0.0998709202f, 0.637510657f},
-std::array<float,2>{0.54953897f, 0.692235947f},
-std::array<float,2>{0.367765844f, 0.359384388f},
-std::array<float,2>{0.873217523f, 0.237113491f},
-std::array<float,2>{0.128289282f, 0.933628321f},
-std::array<float,2>{0.913254917f, 0.802703083f},
-std::array<float,2>{0.00518900109f, 0.00885861646f},
-std::array<float,2>{0.657486856f, 0.489596039f},
-std::array<float,2>{0.377785027f, 0.577357292f},
-std::array<float,2>{0.953728735f, 0.664821565f},
-std::array<float,2>{0.0731710121f, 0.293372333f},
-std::array<float,2>{0.728690326f, 0.184789017f},
-std::array<float,2>{0.477939576f, 0.967231154f},
-std::array<float,2>{0.590128005f, 0.869138539f},
-std::array<float,2>{0.265976518f, 0.120110273f},
-std::array<float,2>{0.767506242f, 0.402623564f},
-std::array<float,2>{0.234810859f, 0.552518845f},
-std::array<float,2>{0.651560545f, 0.606350005f},
-std::array<float,2>{0.415853858f, 0.468589723f},
-std::array<float,2>{0.89787811f, 0.0357573964f},
-std::array<float,2>{0.0393745862f, 0.771508396f},
-std::array<float,2>{0.81378454f, 0.881215394f},
-std::array<float,2>{0.163786784f, 0.21011366f},
-std::array<float,2>{0.52230823f, 0.340191633f},
-std::array<float,2>{0.337094158f, 0.721722186f},
-std::array<float,2>{0.774467051f, 0.627463341f},
-std::array<float,2>{0.243947774f, 0.254631072f},
-std::array<float,2>{0.578876734f, 0.138532311f},
-std::array<float,2>{0.275833309f, 0.998201549f},
-std::array<float,2>{0.725612938f, 0.840762675f},
-std::array<float,2>{0.471100032f, 0.086849153f},
-std::array<float,2>{0.964861929f, 0.430241019f},
-std::array<float,2>{0.0688266605f, 0.527571321f},
-std::array<float,2>{0.525189579f, 0.567256629f},
-std::array<float,2>{0.330370218f, 0.492896885f},
-std::array<float,2>{0.820485771f, 0.00343099888f},
-std::array<float,2>{0.165118828f, 0.806580126f},
-std::array<float,2>{0.905183613f, 0.928855479f},
-std::array<float,2>{0.0346528776f, 0.249634027f},
-std::array<float,2>{0.646584511f, 0.3728109f},
-std::array<float,2>{0.412515074f, 0.696384668f},
-std::array<float,2>{0.976982951f, 0.561494231f},
-std::array<float,2>{0.106240317f, 0.390781492f},
-std::array<float,2>{0.699270189f, 0.109886751f},
-std::array<float,2>{0.444099635f, 0.864492953f},
-std::array<float,2>{0.623837769f, 0.957565248f},
-std::array<float,2>{0.292654634f, 0.172790229f},
-std::array<float,2>{0.788888216f, 0.285943627f},
-std::array<float,2>{0.214315116f, 0.659799218f},
-std::array<float,2>{0.670234799f, 0.729788005f},
-std::array<float,2>{0.389289141f, 0.329164058f},
-std::array<float,2>{0.91468966f, 0.211127996f},
-std::array<float,2>{0.0102641964f, 0.883909523f},
-std::array<float,2>{0.863907516f, 0.77688241f},
-std::array<float,2>{0.13850531f, 0.0417424068f},
-std::array<float,2>{0.560939133f, 0.460453153f},
-std::array<float,2>{0.363106072f, 0.600907266f},
-std::array<float,2>{0.842073858f, 0.620440722f},
-std::array<float,2>{0.179215029f, 0.445120215f},
-std::array<float,2>{0.510315418f, 0.0490535833f},
-std::array<float,2>{0.320604235f, 0.750170231f},
-std::array<float,2>{0.632999539f, 0.901008248f},
-std::array<float,2>{0.424360931f, 0.193056136f},
-std::array<float,2>{0.882171571f, 0.319407731f},
-std::array<float,2>{0.062008515f, 0.745932221f},
-std::array<float,2>{0.569466829f, 0.681651592f},
-std::array<float,2>{0.258974612f, 0.311675817f},
-std::array<float,2>{0.756953895f, 0.171063542f},
-std::array<float,2>{0.225921437f, 0.947255373f},
-std::array<float,2>{0.946479738f, 0.85652864f},
-std::array<float,2>{0.0922060013f, 0.107344635f},
-std::array<float,2>{0.746052623f, 0.377688497f},
-std::array<float,2>{0.499801576f, 0.541718602f},
-std::array<float,2>{0.931042433f, 0.708245456f},
-std::array<float,2>{0.0209940895f, 0.343842715f},
-std::array<float,2>{0.686252654f, 0.22900404f},
-std::array<float,2>{0.403477073f, 0.908899248f},
-std::array<float,2>{0.544897318f, 0.787596345f},
-std::array<float,2>{0.34578535f, 0.0238967594f},
-std::array<float,2>{0.852942705f, 0.480432779f},
-std::array<float,2>{0.155918106f, 0.579403102f},
-std::array<float,2>{0.707250237f, 0.500771344f},
-std::array<float,2>{0.453482479f, 0.417436719f},
-std::array<float,2>{0.999491811f, 0.0665882975f},
-std::array<float,2>{0.115826741f, 0.824397564f},
-std::array<float,2>{0.808077872f, 0.980556786f},
-std::array<float,2>{0.198278919f, 0.141250834f},
-std::array<float,2>{0.595301628f, 0.274417013f},
-std::array<float,2>{0.306312561f, 0.644386351f},
-std::array<float,2>{0.776029408f, 0.696627319f},
-std::array<float,2>{0.244581908f, 0.372652858f},
-std::array<float,2>{0.5807634f, 0.249957681f},
-std::array<float,2>{0.274623305f, 0.929175258f},
-std::array<float,2>{0.722869337f, 0.806275427f},
-std::array<float,2>{0.470277399f, 0.00387780229f},
-std::array<float,2>{0.96813041f, 0.493104875f},
-std::array<float,2>{0.0677322894f, 0.566897571f},
-std::array<float,2>{0.525969625f, 0.527665079f},
-std::array<float,2>{0.329829603f, 0.430563182f},
-std::array<float,2>{0.822767973f, 0.0865001529f},
-std::array<float,2>{0.16715835f, 0.840411663f},
-std::array<float,2>{0.902361393f, 0.998532534f},
-std::array<float,2>{0.0321947485f, 0.138333276f},
-std::array<float,2>{0.645236135f, 0.254751146f},
-std::array<float,2>{0.411705822f, 0.627916038f},
-std::array<float,2>{0.979725778f, 0.600655794f},
-std::array<float,2>{0.109203786f, 0.460730016f},
-std::array<float,2>{0.702833533f, 0.0418058671f},
-std::array<float,2>{0.442728847f, 0.77719909f},
-std::array<float,2>{0.622516513f, 0.884061337f},
-std::array<float,2>{0.290853739f, 0.21121186f},
-std::array<float,2>{0.78648597f, 0.329546958f},
-std::array<float,2>{0.211681217f, 0.729501426f},
-std::array<float,2>{0.66877687f, 0.659978509f},
-std::array<float,2>{0.388521552f, 0.285770148f},
-std::array<float,2>{0.917666078f, 0.172456667f},
-std::array<float,2>{0.00955794845f, 0.957813263f},
-std::array<float,2>{0.866017997f, 0.864598095f},
-std::array<float,2>{0.140183896f, 0.11011067f},
-std::array<float,2>{0.558826208f, 0.39091897f},
-std::array<float,2>{0.359709144f, 0.561064065f},
-std::array<float,2>{0.841702998f, 0.541773498f},
-std::array<float,2>{0.175822601f, 0.377590299f},
-std::array<float,2>{0.509374797f, 0.107016534f},
-std::array<float,2>{0.322889149f, 0.8566975f},
-std::array<float,2>{0.636394203f, 0.946825027f},
-std::array<float,2>{0.422014087f, 0.171173126f},
-std::array<float,2>{0.879706442f, 0.311913729f},
-std::array<float,2>{0.0603076033f, 0.682073057f},
-std::array<float,2>{0.567251682f, 0.745711923f},
-std::array<float,2>{0.260092854f, 0.319656879f},
-std::array<float,2>{0.75397265f, 0.193293929f},
-std::array<float,2>{0.223275095f, 0.901123464f},
-std::array<float,2>{0.94808048f, 0.750281334f},
-std::array<float,2>{0.0902562365f, 0.0490995124f},
-std::array<float,2>{0.743178964f, 0.444835365f},
-std::array<float,2>{0.497958273f, 0.620287001f},
-std::array<float,2>{0.933571875f, 0.644183457f},
-std::array<float,2>{0.0215740222f, 0.274674624f},
-std::array<float,2>{0.685070932f, 0.141493395f},
-std::array<float,2>{0.404469341f, 0.980872273f},
-std::array<float,2>{0.545385778f, 0.824590266f},
-std::array<float,2>{0.345482498f, 0.0668143556f},
-std::array<float,2>{0.854880512f, 0.417036414f},
-std::array<float,2>{0.152953163f, 0.500511229f},
-std::array<float,2>{0.709381163f, 0.579138458f},
-std::array<float,2>{0.455901295f, 0.480166256f},
-std::array<float,2>{0.997793496f, 0.0234595817f},
-std::array<float,2>{0.11502932f, 0.787273169f},
-std::array<float,2>{0.804784954f, 0.908942759f},
-std::array<float,2>{0.197208285f, 0.229384765f},
-std::array<float,2>{0.5960235f, 0.344184369f},
-std::array<float,2>{0.30800876f, 0.70838058f},
-std::array<float,2>{0.846986055f, 0.676553667f},
-std::array<float,2>{0.144552141f, 0.302968711f},
-std::array<float,2>{0.534854949f, 0.162536606f},
-std::array<float,2>{0.357038498f, 0.938938737f},
-std::array<float,2>{0.677024186f, 0.849229038f},
-std::array<float,2>{0.394812435f, 0.0997814313f},
-std::array<float,2>{0.924878538f, 0.385067046f},
-std::array<float,2>{0.0280761421f, 0.538618922f},
-std::array<float,2>{0.603985786f, 0.610124886f},
-std::array<float,2>{0.300797909f, 0.446568936f},
-std::array<float,2>{0.802730262f, 0.0601541325f},
-std::array<float,2>{0.194650412f, 0.761214554f},
-std::array<float,2>{0.991556883f, 0.893674552f},
-std::array<float,2>{0.117385902f, 0.203000396f},
-std::array<float,2>{0.711516201f, 0.32780391f},
-std::array<float,2>{0.462632567f, 0.739863932f},
-std::array<float,2>{0.885641873f, 0.507971466f},
-std::array<float,2>{0.0525034443f, 0.412859142f},
-std::array<float,2>{0.62885797f, 0.0738727003f},
-std::array<float,2>{0.435337961f, 0.817290068f},
-std::array<float,2>{0.50441891f, 0.974777281f},
-std::array<float,2>{0.319807738f, 0.152144894f},
-std::array<float,2>{0.834506989f, 0.268418968f},
-std::array<float,2>{0.186042294f, 0.656128585f},
-std::array<float,2>{0.735818148f, 0.711367965f},
-std::array<float,2>{0.485311419f, 0.355614901f},
-std::array<float,2>{0.941833735f, 0.223015085f},
-std::array<float,2>{0.0833415985f, 0.918496132f},
-std::array<float,2>{0.758903921f, 0.789860725f},
-std::array<float,2>{0.230146095f, 0.0224053171f},
-std::array<float,2>{0.570887685f, 0.473880947f},
-std::array<float,2>{0.253483534f, 0.588691771f},
-std::array<float,2>{0.791119099f, 0.57744801f},
-std::array<float,2>{0.205524072f, 0.489455968f},
-std::array<float,2>{0.611261189f, 0.00924374536f},
-std::array<float,2>{0.282802433f, 0.802265108f},
-std::array<float,2>{0.688123405f, 0.934060872f},
-std::array<float,2>{0.447706789f, 0.236874625f},
-std::array<float,2>{0.97639209f, 0.35964632f},
-std::array<float,2>{0.0977309123f, 0.691899121f},
-std::array<float,2>{0.547419429f, 0.637445986f},
-std::array<float,2>{0.370585382f, 0.260638237f},
-std::array<float,2>{0.871448755f, 0.130363405f},
-std::array<float,2>{0.12647061f, 0.991523266f},
-std::array<float,2>{0.910695016f, 0.82885468f},
-std::array<float,2>{0.00586841255f, 0.0838336423f},
-std::array<float,2>{0.659464955f, 0.424131662f},
-std::array<float,2>{0.376302004f, 0.520656347f},
-std::array<float,2>{0.956952929f, 0.72195363f},
-std::array<float,2>{0.0717730373f, 0.339956999f},
-std::array<float,2>{0.726646364f, 0.210304528f},
-std::array<float,2>{0.478974521f, 0.880994856f},
-std::array<float,2>{0.592099309f, 0.771854997f},
-std::array<float,2>{0.269434661f, 0.0360610485f},
-std::array<float,2>{0.769412577f, 0.468336344f},
-std::array<float,2>{0.238191411f, 0.606050491f},
-std::array<float,2>{0.649271429f, 0.552405417f},
-std::array<float,2>{0.416196764f, 0.40239954f},
-std::array<float,2>{0.895177126f, 0.119850509f},
-std::array<float,2>{0.041068688f, 0.86886251f},
-std::array<float,2>{0.815116763f, 0.966889441f},
-std::array<float,2>{0.16206485f, 0.184836477f},
-std::array<float,2>{0.519861281f, 0.293128252f},
-std::array<float,2>{0.339746803f, 0.664741397f},
-std::array<float,2>{0.827796161f, 0.737684131f},
-std::array<float,2>{0.169585228f, 0.321094126f},
-std::array<float,2>{0.53112793f, 0.198043928f},
-std::array<float,2>{0.333610684f, 0.896159112f},
-std::array<float,2>{0.643667579f, 0.76487726f},
-std::array<float,2>{0.409303159f, 0.0559990034f},
-std::array<float,2>{0.902226508f, 0.452289551f},
-std::array<float,2>{0.0382264517f, 0.614939392f},
-std::array<float,2>{0.582594991f, 0.534282804f},
-std::array<float,2>{0.278299361f, 0.390159547f},
-std::array<float,2>{0.779378414f, 0.0956191272f},
-std::array<float,2>{0.24649556f, 0.84752655f},
-std::array<float,2>{0.961352706f, 0.943666458f},
-std::array<float,2>{0.0653037876f, 0.158006877f},
-std::array<float,2>{0.721020758f, 0.299197048f},
-std::array<float,2>{0.476124585f, 0.674562812f},
-std::array<float,2>{0.918175817f, 0.590842307f},
-std::array<float,2>{0.0145553313f, 0.468760163f},
-std::array<float,2>{0.666991949f, 0.0178605951f},
-std::array<float,2>{0.38521561f, 0.79684478f},
-std::array<float,2>{0.556821764f, 0.91795224f},
-std::array<float,2>{0.365152299f, 0.222181126f},
-std::array<float,2>{0.863203108f, 0.351709664f},
-std::array<float,2>{0.135665402f, 0.718440175f},
-std::array<float,2>{0.696698666f, 0.649306238f},
-std::array<float,2>{0.438402444f, 0.27147615f},
-std::array<float,2>{0.983587325f, 0.153185084f},
-std::array<float,2>{0.105028532f, 0.969066143f},
-std::array<float,2>{0.782985389f, 0.816079557f},
-std::array<float,2>{0.216496781f, 0.0755402073f},
-std::array<float,2>{0.619119823f, 0.409273595f},
-std::array<float,2>{0.295686722f, 0.514585078f},
-std::array<float,2>{0.751257598f, 0.519075274f},
-std::array<float,2>{0.221814051f, 0.427767247f},
-std::array<float,2>{0.564480066f, 0.0787705258f},
-std::array<float,2>{0.26493907f, 0.834981263f},
-std::array<float,2>{0.749237597f, 0.984875262f},
-std::array<float,2>{0.493817359f, 0.128125995f},
-std::array<float,2>{0.950164855f, 0.265616447f},
-std::array<float,2>{0.0865424946f, 0.635316491f},
-std::array<float,2>{0.515477538f, 0.688781321f},
-std::array<float,2>{0.326516002f, 0.364357829f},
-std::array<float,2>{0.836718321f, 0.239083007f},
-std::array<float,2>{0.172885418f, 0.932451725f},
-std::array<float,2>{0.877307475f, 0.796883762f},
-std::array<float,2>{0.0552252755f, 0.0121179586f},
-std::array<float,2>{0.638483524f, 0.48690623f},
-std::array<float,2>{0.427121133f, 0.571963608f},
-std::array<float,2>{0.995304227f, 0.670264661f},
-std::array<float,2>{0.111569807f, 0.289149791f},
-std::array<float,2>{0.704227984f, 0.181243435f},
-std::array<float,2>{0.457870901f, 0.961593032f},
-std::array<float,2>{0.600928485f, 0.874706447f},
-std::array<float,2>{0.311465889f, 0.12143255f},
-std::array<float,2>{0.810062885f, 0.402103871f},
-std::array<float,2>{0.201095954f, 0.550698102f},
-std::array<float,2>{0.682941914f, 0.605439305f},
-std::array<float,2>{0.401668727f, 0.463855207f},
-std::array<float,2>{0.934198797f, 0.0316789597f},
-std::array<float,2>{0.017346466f, 0.767967761f},
-std::array<float,2>{0.856592774f, 0.878678918f},
-std::array<float,2>{0.148857281f, 0.206785902f},
-std::array<float,2>{0.540350795f, 0.336006016f},
-std::array<float,2>{0.349251896f, 0.726431131f},
-std::array<float,2>{0.797061205f, 0.629027724f},
-std::array<float,2>{0.1883187f, 0.252975613f},
-std::array<float,2>{0.608086467f, 0.135119587f},
-std::array<float,2>{0.296908736f, 0.99437505f},
-std::array<float,2>{0.717965424f, 0.836828232f},
-std::array<float,2>{0.467681974f, 0.0928054303f},
-std::array<float,2>{0.986663938f, 0.436861664f},
-std::array<float,2>{0.122172952f, 0.525895357f},
-std::array<float,2>{0.537395895f, 0.562689722f},
-std::array<float,2>{0.352147043f, 0.499195874f},
-std::array<float,2>{0.847902119f, 0.00736770313f},
-std::array<float,2>{0.143878669f, 0.810263455f},
-std::array<float,2>{0.927005231f, 0.922574759f},
-std::array<float,2>{0.026453454f, 0.245715901f},
-std::array<float,2>{0.675031066f, 0.370326668f},
-std::array<float,2>{0.394501269f, 0.700706959f},
-std::array<float,2>{0.941227853f, 0.555862784f},
-std::array<float,2>{0.0784298852f, 0.397029519f},
-std::array<float,2>{0.739266992f, 0.114065312f},
-std::array<float,2>{0.489385068f, 0.86274904f},
-std::array<float,2>{0.576694906f, 0.953655124f},
-std::array<float,2>{0.254888833f, 0.178667128f},
-std::array<float,2>{0.765321493f, 0.284059823f},
-std::array<float,2>{0.230822489f, 0.663078785f},
-std::array<float,2>{0.632505953f, 0.733923495f},
-std::array<float,2>{0.430934042f, 0.334783256f},
-std::array<float,2>{0.889692903f, 0.216439396f},
-std::array<float,2>{0.0501760766f, 0.88970077f},
-std::array<float,2>{0.830831409f, 0.777957082f},
-std::array<float,2>{0.180084243f, 0.04523848f},
-std::array<float,2>{0.501075923f, 0.454137385f},
-std::array<float,2>{0.315142751f, 0.595625937f},
-std::array<float,2>{0.867831349f, 0.622373462f},
-std::array<float,2>{0.130867884f, 0.439095378f},
-std::array<float,2>{0.551820338f, 0.0541050136f},
-std::array<float,2>{0.371454477f, 0.755959451f},
-std::array<float,2>{0.662109256f, 0.904956281f},
-std::array<float,2>{0.381799847f, 0.190139189f},
-std::array<float,2>{0.908205688f, 0.313556522f},
-std::array<float,2>{0.00290358975f, 0.749684989f},
-std::array<float,2>{0.615727007f, 0.687235713f},
-std::array<float,2>{0.287691325f, 0.308122456f},
-std::array<float,2>{0.793595552f, 0.167928055f},
-std::array<float,2>{0.210713297f, 0.949822366f},
-std::array<float,2>{0.972613573f, 0.853108287f},
-std::array<float,2>{0.0961847156f, 0.105468556f},
-std::array<float,2>{0.695228577f, 0.380819529f},
-std::array<float,2>{0.450913161f, 0.543699801f},
-std::array<float,2>{0.893845797f, 0.703325212f},
-std::array<float,2>{0.0434331223f, 0.348253608f},
-std::array<float,2>{0.65250349f, 0.233245179f},
-std::array<float,2>{0.420161456f, 0.910523772f},
-std::array<float,2>{0.515876949f, 0.783020258f},
-std::array<float,2>{0.342912972f, 0.0290980078f},
-std::array<float,2>{0.818635762f, 0.481608182f},
-std::array<float,2>{0.157494113f, 0.583632886f},
-std::array<float,2>{0.732438564f, 0.507264793f},
-std::array<float,2>{0.481323719f, 0.418570548f},
-std::array<float,2>{0.959400892f, 0.0657573342f},
-std::array<float,2>{0.0779689252f, 0.821715117f},
-std::array<float,2>{0.772855461f, 0.980389118f},
-std::array<float,2>{0.241433159f, 0.148052037f},
-std::array<float,2>{0.58726871f, 0.280763f},
-std::array<float,2>{0.270035237f, 0.648021877f},
-std::array<float,2>{0.787320256f, 0.727261007f},
-std::array<float,2>{0.213674739f, 0.331464469f},
-std::array<float,2>{0.62425673f, 0.213163197f},
-std::array<float,2>{0.291706234f, 0.886351168f},
-std::array<float,2>{0.700274408f, 0.774228811f},
-std::array<float,2>{0.444840074f, 0.0399390645f},
-std::array<float,2>{0.978000104f, 0.457214743f},
-std::array<float,2>{0.106868505f, 0.598387957f},
-std::array<float,2>{0.561839342f, 0.559129298f},
-std::array<float,2>{0.362238646f, 0.392746568f},
-std::array<float,2>{0.864312649f, 0.111336499f},
-std::array<float,2>{0.13676995f, 0.866377175f},
-std::array<float,2>{0.915721178f, 0.960155606f},
-std::array<float,2>{0.0110957446f, 0.175752789f},
-std::array<float,2>{0.671026528f, 0.288018942f},
-std::array<float,2>{0.390412778f, 0.657314181f},
-std::array<float,2>{0.966110885f, 0.569330454f},
-std::array<float,2>{0.0693764091f, 0.494576484f},
-std::array<float,2>{0.724611044f, 6.61880767e-05f},
-std::array<float,2>{0.471877068f, 0.807008743f},
-std::array<float,2>{0.579443336f, 0.926886201f},
-std::array<float,2>{0.276814431f, 0.24773863f},
-std::array<float,2>{0.774145663f, 0.373460472f},
-std::array<float,2>{0.242679566f, 0.699161947f},
-std::array<float,2>{0.648367643f, 0.62537086f},
-std::array<float,2>{0.413501352f, 0.255971253f},
-std::array<float,2>{0.905890286f, 0.139340639f},
-std::array<float,2>{0.0339311734f, 0.996442795f},
-std::array<float,2>{0.821932375f, 0.842509449f},
-std::array<float,2>{0.164309293f, 0.089071691f},
-std::array<float,2>{0.524242103f, 0.432510406f},
-std::array<float,2>{0.331239015f, 0.529997587f},
-std::array<float,2>{0.851685703f, 0.502479672f},
-std::array<float,2>{0.154873163f, 0.414447725f},
-std::array<float,2>{0.543192506f, 0.0698201731f},
-std::array<float,2>{0.347276568f, 0.827907503f},
-std::array<float,2>{0.687376916f, 0.98332268f},
-std::array<float,2>{0.402626723f, 0.143986195f},
-std::array<float,2>{0.929971457f, 0.276552737f},
-std::array<float,2>{0.0200323481f, 0.642108321f},
-std::array<float,2>{0.594026387f, 0.710138321f},
-std::array<float,2>{0.30506894f, 0.347123384f},
-std::array<float,2>{0.807066798f, 0.227925837f},
-std::array<float,2>{0.197867051f, 0.906936228f},
-std::array<float,2>{0.998224795f, 0.785247624f},
-std::array<float,2>{0.116922319f, 0.0258175079f},
-std::array<float,2>{0.708368897f, 0.477958411f},
-std::array<float,2>{0.454546243f, 0.581129968f},
-std::array<float,2>{0.880990446f, 0.680580795f},
-std::array<float,2>{0.0612645596f, 0.309723049f},
-std::array<float,2>{0.63438648f, 0.168191865f},
-std::array<float,2>{0.42486006f, 0.948077798f},
-std::array<float,2>{0.510982096f, 0.858852446f},
-std::array<float,2>{0.322018713f, 0.108398125f},
-std::array<float,2>{0.843019307f, 0.376410395f},
-std::array<float,2>{0.178677633f, 0.539404213f},
-std::array<float,2>{0.744395375f, 0.618649304f},
-std::array<float,2>{0.49876374f, 0.442925721f},
-std::array<float,2>{0.945741951f, 0.0477989316f},
-std::array<float,2>{0.0932182819f, 0.753069818f},
-std::array<float,2>{0.756625235f, 0.899084866f},
-std::array<float,2>{0.224960938f, 0.195005506f},
-std::array<float,2>{0.569220245f, 0.31731528f},
-std::array<float,2>{0.257843763f, 0.743777931f},
-std::array<float,2>{0.832512438f, 0.6540941f},
-std::array<float,2>{0.184046745f, 0.265905738f},
-std::array<float,2>{0.507665396f, 0.149931684f},
-std::array<float,2>{0.316887766f, 0.973217428f},
-std::array<float,2>{0.625617504f, 0.819851279f},
-std::array<float,2>{0.436131716f, 0.0708549246f},
-std::array<float,2>{0.882964492f, 0.412020206f},
-std::array<float,2>{0.0529535823f, 0.510576367f},
-std::array<float,2>{0.573414743f, 0.587318003f},
-std::array<float,2>{0.250275135f, 0.475610167f},
-std::array<float,2>{0.760619938f, 0.0206185337f},
-std::array<float,2>{0.227687344f, 0.792401433f},
-std::array<float,2>{0.944417f, 0.921519518f},
-std::array<float,2>{0.0849589035f, 0.225781798f},
-std::array<float,2>{0.736954987f, 0.357524335f},
-std::array<float,2>{0.486899674f, 0.713151932f},
-std::array<float,2>{0.923222423f, 0.536721468f},
-std::array<float,2>{0.0306990035f, 0.384106874f},
-std::array<float,2>{0.677891731f, 0.0993712768f},
-std::array<float,2>{0.396514505f, 0.850505292f},
-std::array<float,2>{0.532853067f, 0.939870059f},
-std::array<float,2>{0.359311759f, 0.160623118f},
-std::array<float,2>{0.845220089f, 0.302203625f},
-std::array<float,2>{0.148013681f, 0.679552972f},
-std::array<float,2>{0.714120388f, 0.741232097f},
-std::array<float,2>{0.462992221f, 0.32451421f},
-std::array<float,2>{0.988964915f, 0.200604558f},
-std::array<float,2>{0.119577408f, 0.890962362f},
-std::array<float,2>{0.803952336f, 0.758778691f},
-std::array<float,2>{0.192114875f, 0.0607391074f},
-std::array<float,2>{0.603270411f, 0.448248982f},
-std::array<float,2>{0.303197056f, 0.611973405f},
-std::array<float,2>{0.765653133f, 0.608330429f},
-std::array<float,2>{0.236073881f, 0.465993047f},
-std::array<float,2>{0.591493905f, 0.0388132334f},
-std::array<float,2>{0.267454088f, 0.770750284f},
-std::array<float,2>{0.729734182f, 0.880128622f},
-std::array<float,2>{0.4775168f, 0.207463682f},
-std::array<float,2>{0.954956353f, 0.343586385f},
-std::array<float,2>{0.0734966248f, 0.719934821f},
-std::array<float,2>{0.523347855f, 0.667211413f},
-std::array<float,2>{0.336500794f, 0.295545429f},
-std::array<float,2>{0.81334132f, 0.187391236f},
-std::array<float,2>{0.162817791f, 0.966133893f},
-std::array<float,2>{0.896531224f, 0.869595289f},
-std::array<float,2>{0.0400911719f, 0.117720015f},
-std::array<float,2>{0.650830269f, 0.405891925f},
-std::array<float,2>{0.414619446f, 0.552806437f},
-std::array<float,2>{0.973316014f, 0.69506824f},
-std::array<float,2>{0.101485364f, 0.363264799f},
-std::array<float,2>{0.691130221f, 0.234488085f},
-std::array<float,2>{0.445739985f, 0.935964227f},
-std::array<float,2>{0.611922681f, 0.803258657f},
-std::array<float,2>{0.284443974f, 0.0106375143f},
-std::array<float,2>{0.790159583f, 0.490380466f},
-std::array<float,2>{0.203823864f, 0.575295687f},
-std::array<float,2>{0.656551361f, 0.523361504f},
-std::array<float,2>{0.37801671f, 0.421933353f},
-std::array<float,2>{0.912877262f, 0.0849979743f},
-std::array<float,2>{0.00403203862f, 0.831240892f},
-std::array<float,2>{0.874709189f, 0.988515556f},
-std::array<float,2>{0.127241954f, 0.131700695f},
-std::array<float,2>{0.550493002f, 0.257979661f},
-std::array<float,2>{0.368428499f, 0.639989436f},
-std::array<float,2>{0.860862017f, 0.716733634f},
-std::array<float,2>{0.132966891f, 0.355390728f},
-std::array<float,2>{0.555833638f, 0.219332129f},
-std::array<float,2>{0.365892082f, 0.915908158f},
-std::array<float,2>{0.664904892f, 0.793158948f},
-std::array<float,2>{0.383577257f, 0.0160228554f},
-std::array<float,2>{0.921125174f, 0.471847296f},
-std::array<float,2>{0.0124034211f, 0.59367907f},
-std::array<float,2>{0.619538426f, 0.511826098f},
-std::array<float,2>{0.294474751f, 0.407969505f},
-std::array<float,2>{0.783907175f, 0.0779486522f},
-std::array<float,2>{0.2174301f, 0.81251663f},
-std::array<float,2>{0.982226789f, 0.972356796f},
-std::array<float,2>{0.102513991f, 0.155720502f},
-std::array<float,2>{0.698532999f, 0.27222994f},
-std::array<float,2>{0.439847499f, 0.651088119f},
-std::array<float,2>{0.900113702f, 0.615771294f},
-std::array<float,2>{0.0353616625f, 0.450511396f},
-std::array<float,2>{0.641242862f, 0.056833338f},
-std::array<float,2>{0.406614035f, 0.763111949f},
-std::array<float,2>{0.527813971f, 0.897961915f},
-std::array<float,2>{0.33474201f, 0.19604294f},
-std::array<float,2>{0.825213313f, 0.322580129f},
-std::array<float,2>{0.171415314f, 0.735120237f},
-std::array<float,2>{0.719481587f, 0.672923684f},
-std::array<float,2>{0.472982079f, 0.298155457f},
-std::array<float,2>{0.964004934f, 0.159087569f},
-std::array<float,2>{0.062596865f, 0.941846788f},
-std::array<float,2>{0.779123902f, 0.845149755f},
-std::array<float,2>{0.249643236f, 0.0970831364f},
-std::array<float,2>{0.584528744f, 0.387548804f},
-std::array<float,2>{0.280952901f, 0.531408131f},
-std::array<float,2>{0.811467648f, 0.548243701f},
-std::array<float,2>{0.201878384f, 0.398698688f},
-std::array<float,2>{0.599230647f, 0.123307705f},
-std::array<float,2>{0.30993706f, 0.872731507f},
-std::array<float,2>{0.705612183f, 0.96362406f},
-std::array<float,2>{0.459080577f, 0.182714567f},
-std::array<float,2>{0.993146658f, 0.29253304f},
-std::array<float,2>{0.110768631f, 0.66857636f},
-std::array<float,2>{0.542134404f, 0.724466085f},
-std::array<float,2>{0.349829346f, 0.338765383f},
-std::array<float,2>{0.857476115f, 0.204443067f},
-std::array<float,2>{0.15171507f, 0.875248194f},
-std::array<float,2>{0.936885297f, 0.765625119f},
-std::array<float,2>{0.0189342685f, 0.033856418f},
-std::array<float,2>{0.680217445f, 0.462475836f},
-std::array<float,2>{0.398888558f, 0.603108346f},
-std::array<float,2>{0.952629089f, 0.634375989f},
-std::array<float,2>{0.088503398f, 0.262114108f},
-std::array<float,2>{0.746250868f, 0.126490712f},
-std::array<float,2>{0.495191336f, 0.987217426f},
-std::array<float,2>{0.563186109f, 0.833153844f},
-std::array<float,2>{0.261871099f, 0.080401279f},
-std::array<float,2>{0.752566457f, 0.426291615f},
-std::array<float,2>{0.21965456f, 0.515936375f},
-std::array<float,2>{0.639681041f, 0.573199093f},
-std::array<float,2>{0.428945869f, 0.486212432f},
-std::array<float,2>{0.876882493f, 0.0144239087f},
-std::array<float,2>{0.0569645762f, 0.800648987f},
-std::array<float,2>{0.838279009f, 0.931392372f},
-std::array<float,2>{0.173901334f, 0.241009563f},
-std::array<float,2>{0.51172924f, 0.366153479f},
-std::array<float,2>{0.326146543f, 0.691159606f},
-std::array<float,2>{0.762674809f, 0.660750449f},
-std::array<float,2>{0.23290585f, 0.282531321f},
-std::array<float,2>{0.574847221f, 0.176165983f},
-std::array<float,2>{0.25623244f, 0.95536834f},
-std::array<float,2>{0.741914213f, 0.860582292f},
-std::array<float,2>{0.491907984f, 0.115391731f},
-std::array<float,2>{0.938816071f, 0.3962951f},
-std::array<float,2>{0.0803224072f, 0.558280826f},
-std::array<float,2>{0.502372384f, 0.595992446f},
-std::array<float,2>{0.313901454f, 0.456260055f},
-std::array<float,2>{0.829457343f, 0.0448806174f},
-std::array<float,2>{0.182833821f, 0.781204998f},
-std::array<float,2>{0.887355864f, 0.888591826f},
-std::array<float,2>{0.0487345047f, 0.218499631f},
-std::array<float,2>{0.630344808f, 0.332241565f},
-std::array<float,2>{0.43318364f, 0.731666267f},
-std::array<float,2>{0.984552681f, 0.524894178f},
-std::array<float,2>{0.124593139f, 0.434580028f},
-std::array<float,2>{0.714960575f, 0.0910290554f},
-std::array<float,2>{0.465767562f, 0.839335859f},
-std::array<float,2>{0.605649889f, 0.992956877f},
-std::array<float,2>{0.300533772f, 0.13306129f},
-std::array<float,2>{0.799977541f, 0.250363827f},
-std::array<float,2>{0.189841717f, 0.631456077f},
-std::array<float,2>{0.673461974f, 0.702155709f},
-std::array<float,2>{0.390945017f, 0.368553489f},
-std::array<float,2>{0.92931962f, 0.243827164f},
-std::array<float,2>{0.0240569562f, 0.925038099f},
-std::array<float,2>{0.850909114f, 0.811951041f},
-std::array<float,2>{0.14117755f, 0.00578956073f},
-std::array<float,2>{0.537059665f, 0.49795261f},
-std::array<float,2>{0.35502854f, 0.564693391f},
-std::array<float,2>{0.817094862f, 0.585416853f},
-std::array<float,2>{0.159879565f, 0.484310806f},
-std::array<float,2>{0.518891573f, 0.0309250336f},
-std::array<float,2>{0.340545654f, 0.783427179f},
-std::array<float,2>{0.654370606f, 0.913310945f},
-std::array<float,2>{0.419872433f, 0.23074244f},
-std::array<float,2>{0.892575979f, 0.351504594f},
-std::array<float,2>{0.0458049029f, 0.706910789f},
-std::array<float,2>{0.589358211f, 0.644713044f},
-std::array<float,2>{0.27338478f, 0.277661532f},
-std::array<float,2>{0.770594418f, 0.14526464f},
-std::array<float,2>{0.2385934f, 0.977813423f},
-std::array<float,2>{0.957828939f, 0.823847651f},
-std::array<float,2>{0.075147301f, 0.0627964213f},
-std::array<float,2>{0.730665088f, 0.420462519f},
-std::array<float,2>{0.483402789f, 0.50415808f},
-std::array<float,2>{0.908049166f, 0.747686207f},
-std::array<float,2>{0.000869975134f, 0.31474039f},
-std::array<float,2>{0.663977623f, 0.18831116f},
-std::array<float,2>{0.379116416f, 0.903797388f},
-std::array<float,2>{0.554027021f, 0.755278289f},
-std::array<float,2>{0.374538869f, 0.0518389121f},
-std::array<float,2>{0.869909883f, 0.440575838f},
-std::array<float,2>{0.128911242f, 0.624220192f},
-std::array<float,2>{0.69140631f, 0.545372307f},
-std::array<float,2>{0.452509403f, 0.380903095f},
-std::array<float,2>{0.970384121f, 0.102743179f},
-std::array<float,2>{0.0951184705f, 0.854651153f},
-std::array<float,2>{0.796220124f, 0.951672316f},
-std::array<float,2>{0.207270712f, 0.165935352f},
-std::array<float,2>{0.614867985f, 0.305142373f},
-std::array<float,2>{0.286571175f, 0.685484529f},
-std::array<float,2>{0.755812943f, 0.742321193f},
-std::array<float,2>{0.223858699f, 0.317708284f},
-std::array<float,2>{0.568345785f, 0.194021508f},
-std::array<float,2>{0.261413604f, 0.899873972f},
-std::array<float,2>{0.742524266f, 0.752258182f},
-std::array<float,2>{0.497069448f, 0.0482698902f},
-std::array<float,2>{0.948489368f, 0.441829681f},
-std::array<float,2>{0.0913117155f, 0.617282867f},
-std::array<float,2>{0.508588374f, 0.540317953f},
-std::array<float,2>{0.323659599f, 0.375869364f},
-std::array<float,2>{0.840076029f, 0.10863784f},
-std::array<float,2>{0.177074403f, 0.858099997f},
-std::array<float,2>{0.880236089f, 0.949162662f},
-std::array<float,2>{0.0593872145f, 0.16934213f},
-std::array<float,2>{0.635613084f, 0.309517801f},
-std::array<float,2>{0.423018664f, 0.680695057f},
-std::array<float,2>{0.996578336f, 0.580745876f},
-std::array<float,2>{0.11330612f, 0.476794183f},
-std::array<float,2>{0.710362017f, 0.0264823642f},
-std::array<float,2>{0.456964403f, 0.786800921f},
-std::array<float,2>{0.597644269f, 0.907823563f},
-std::array<float,2>{0.307141721f, 0.227304265f},
-std::array<float,2>{0.806375861f, 0.34647727f},
-std::array<float,2>{0.195577413f, 0.709038317f},
-std::array<float,2>{0.683609486f, 0.641449571f},
-std::array<float,2>{0.405640513f, 0.276015729f},
-std::array<float,2>{0.932580531f, 0.142737433f},
-std::array<float,2>{0.0232655648f, 0.983979464f},
-std::array<float,2>{0.853819191f, 0.826751292f},
-std::array<float,2>{0.153656676f, 0.0683643892f},
-std::array<float,2>{0.546350718f, 0.415066749f},
-std::array<float,2>{0.34471643f, 0.503687561f},
-std::array<float,2>{0.823934436f, 0.530707359f},
-std::array<float,2>{0.166462928f, 0.433294296f},
-std::array<float,2>{0.527125955f, 0.087971881f},
-std::array<float,2>{0.328418016f, 0.843714237f},
-std::array<float,2>{0.645518124f, 0.997529805f},
-std::array<float,2>{0.411087036f, 0.140297294f},
-std::array<float,2>{0.903972864f, 0.257151008f},
-std::array<float,2>{0.0327075608f, 0.626933336f},
-std::array<float,2>{0.581940293f, 0.697882414f},
-std::array<float,2>{0.274183422f, 0.374378622f},
-std::array<float,2>{0.777088881f, 0.246486396f},
-std::array<float,2>{0.246071771f, 0.926406145f},
-std::array<float,2>{0.966952205f, 0.807849109f},
-std::array<float,2>{0.0673605129f, 0.00145297125f},
-std::array<float,2>{0.7243312f, 0.495164454f},
-std::array<float,2>{0.469088018f, 0.570039809f},
-std::array<float,2>{0.916894853f, 0.657120705f},
-std::array<float,2>{0.00847289804f, 0.288309038f},
-std::array<float,2>{0.669283628f, 0.174582481f},
-std::array<float,2>{0.38764298f, 0.959866405f},
-std::array<float,2>{0.560146451f, 0.865592241f},
-std::array<float,2>{0.361176789f, 0.113036767f},
-std::array<float,2>{0.867077947f, 0.394185901f},
-std::array<float,2>{0.138794482f, 0.560318768f},
-std::array<float,2>{0.701406896f, 0.599012971f},
-std::array<float,2>{0.441790938f, 0.458077967f},
-std::array<float,2>{0.979179263f, 0.0404056683f},
-std::array<float,2>{0.107883014f, 0.775235295f},
-std::array<float,2>{0.785789371f, 0.885550678f},
-std::array<float,2>{0.212242827f, 0.214529321f},
-std::array<float,2>{0.621582806f, 0.330830753f},
-std::array<float,2>{0.289630771f, 0.728408337f},
-std::array<float,2>{0.872764409f, 0.639642596f},
-std::array<float,2>{0.125703216f, 0.259354204f},
-std::array<float,2>{0.548319399f, 0.13195914f},
-std::array<float,2>{0.369996488f, 0.989723146f},
-std::array<float,2>{0.658773184f, 0.83066678f},
-std::array<float,2>{0.375458896f, 0.0848044828f},
-std::array<float,2>{0.911473691f, 0.423044413f},
-std::array<float,2>{0.00738386624f, 0.521862447f},
-std::array<float,2>{0.610134482f, 0.574603796f},
-std::array<float,2>{0.281451583f, 0.491954535f},
-std::array<float,2>{0.792136192f, 0.0113746189f},
-std::array<float,2>{0.206722215f, 0.804102004f},
-std::array<float,2>{0.9752267f, 0.937005937f},
-std::array<float,2>{0.0994803384f, 0.236155137f},
-std::array<float,2>{0.688821912f, 0.361517996f},
-std::array<float,2>{0.4492127f, 0.694059193f},
-std::array<float,2>{0.896264493f, 0.554275572f},
-std::array<float,2>{0.0423971638f, 0.404933453f},
-std::array<float,2>{0.649630189f, 0.118236661f},
-std::array<float,2>{0.417818934f, 0.870545983f},
-std::array<float,2>{0.520641804f, 0.964853048f},
-std::array<float,2>{0.338164181f, 0.186469838f},
-std::array<float,2>{0.81560415f, 0.29681477f},
-std::array<float,2>{0.160828784f, 0.66691488f},
-std::array<float,2>{0.72789669f, 0.718907714f},
-std::array<float,2>{0.479539543f, 0.34219566f},
-std::array<float,2>{0.955827594f, 0.208463222f},
-std::array<float,2>{0.0708423555f, 0.879385412f},
-std::array<float,2>{0.76846683f, 0.769780159f},
-std::array<float,2>{0.236935571f, 0.0372641273f},
-std::array<float,2>{0.593544185f, 0.464962155f},
-std::array<float,2>{0.267810732f, 0.609205127f},
-std::array<float,2>{0.801270127f, 0.612794638f},
-std::array<float,2>{0.193387836f, 0.447634637f},
-std::array<float,2>{0.605424285f, 0.0624296069f},
-std::array<float,2>{0.301821887f, 0.75936085f},
-std::array<float,2>{0.712395847f, 0.892087519f},
-std::array<float,2>{0.461644083f, 0.199696451f},
-std::array<float,2>{0.991055369f, 0.325336784f},
-std::array<float,2>{0.119070359f, 0.741077483f},
-std::array<float,2>{0.533851147f, 0.677892327f},
-std::array<float,2>{0.356006563f, 0.301487088f},
-std::array<float,2>{0.84628737f, 0.161654457f},
-std::array<float,2>{0.146327302f, 0.941225111f},
-std::array<float,2>{0.924468279f, 0.851252377f},
-std::array<float,2>{0.0289260447f, 0.0979486182f},
-std::array<float,2>{0.676450014f, 0.383598834f},
-std::array<float,2>{0.395881951f, 0.53524965f},
-std::array<float,2>{0.942608953f, 0.713950992f},
-std::array<float,2>{0.0823696107f, 0.358414531f},
-std::array<float,2>{0.734823942f, 0.224655703f},
-std::array<float,2>{0.485579371f, 0.920638859f},
-std::array<float,2>{0.571804523f, 0.791805267f},
-std::array<float,2>{0.252329677f, 0.0201977957f},
-std::array<float,2>{0.758174956f, 0.475111723f},
-std::array<float,2>{0.228719547f, 0.586423755f},
-std::array<float,2>{0.627873957f, 0.51167649f},
-std::array<float,2>{0.43431595f, 0.410391986f},
-std::array<float,2>{0.886606514f, 0.0718528405f},
-std::array<float,2>{0.0514323078f, 0.819327831f},
-std::array<float,2>{0.835208893f, 0.974458218f},
-std::array<float,2>{0.186773345f, 0.148710966f},
-std::array<float,2>{0.505373955f, 0.266927928f},
-std::array<float,2>{0.319180936f, 0.652754903f},
-std::array<float,2>{0.837300301f, 0.690162897f},
-std::array<float,2>{0.172218904f, 0.366255701f},
-std::array<float,2>{0.514570117f, 0.241407186f},
-std::array<float,2>{0.327225208f, 0.930217803f},
-std::array<float,2>{0.636741519f, 0.799294889f},
-std::array<float,2>{0.426046938f, 0.0155528449f},
-std::array<float,2>{0.877946019f, 0.484596789f},
-std::array<float,2>{0.0559008867f, 0.573975265f},
-std::array<float,2>{0.56603539f, 0.517002881f},
-std::array<float,2>{0.264077753f, 0.426802784f},
-std::array<float,2>{0.750652969f, 0.081969738f},
-std::array<float,2>{0.220877096f, 0.832558572f},
-std::array<float,2>{0.950900078f, 0.987586439f},
-std::array<float,2>{0.0869753063f, 0.125831604f},
-std::array<float,2>{0.748889267f, 0.263518035f},
-std::array<float,2>{0.492221475f, 0.633587539f},
-std::array<float,2>{0.934642732f, 0.602513433f},
-std::array<float,2>{0.0164228231f, 0.461192876f},
-std::array<float,2>{0.682328999f, 0.0344128236f},
-std::array<float,2>{0.400932282f, 0.767314374f},
-std::array<float,2>{0.539530873f, 0.876058578f},
-std::array<float,2>{0.348585665f, 0.203473821f},
-std::array<float,2>{0.85564822f, 0.339434057f},
-std::array<float,2>{0.149658456f, 0.72361064f},
-std::array<float,2>{0.703674138f, 0.669856191f},
-std::array<float,2>{0.458593935f, 0.291345924f},
-std::array<float,2>{0.994474947f, 0.182194203f},
-std::array<float,2>{0.112631306f, 0.964675069f},
-std::array<float,2>{0.808984637f, 0.871307015f},
-std::array<float,2>{0.200078681f, 0.124952756f},
-std::array<float,2>{0.599830568f, 0.399833292f},
-std::array<float,2>{0.311653882f, 0.547233343f},
-std::array<float,2>{0.781055689f, 0.532713413f},
-std::array<float,2>{0.248013392f, 0.388341695f},
-std::array<float,2>{0.583320141f, 0.096009694f},
-std::array<float,2>{0.27873525f, 0.844504416f},
-std::array<float,2>{0.72265166f, 0.943036258f},
-std::array<float,2>{0.475278735f, 0.159738198f},
-std::array<float,2>{0.962220848f, 0.296961188f},
-std::array<float,2>{0.0663089901f, 0.672290385f},
-std::array<float,2>{0.529410243f, 0.736278057f},
-std::array<float,2>{0.332837135f, 0.323599637f},
-std::array<float,2>{0.826253593f, 0.196354583f},
-std::array<float,2>{0.168369904f, 0.896746576f},
-std::array<float,2>{0.900790095f, 0.762034178f},
-std::array<float,2>{0.0375650153f, 0.0576931462f},
-std::array<float,2>{0.64278543f, 0.449517429f},
-std::array<float,2>{0.408226669f, 0.617049098f},
-std::array<float,2>{0.982594848f, 0.651961446f},
-std::array<float,2>{0.103923589f, 0.272894531f},
-std::array<float,2>{0.695984006f, 0.154437542f},
-std::array<float,2>{0.438578367f, 0.971295297f},
-std::array<float,2>{0.617881835f, 0.813824058f},
-std::array<float,2>{0.296063215f, 0.0764632076f},
-std::array<float,2>{0.781744063f, 0.406495601f},
-std::array<float,2>{0.215487823f, 0.51319766f},
-std::array<float,2>{0.667158902f, 0.591981709f},
-std::array<float,2>{0.38594082f, 0.470918089f},
-std::array<float,2>{0.919742346f, 0.0169711616f},
-std::array<float,2>{0.0151609387f, 0.794011831f},
-std::array<float,2>{0.861517251f, 0.914838791f},
-std::array<float,2>{0.136052206f, 0.220205039f},
-std::array<float,2>{0.557778418f, 0.353773504f},
-std::array<float,2>{0.364032835f, 0.715200543f},
-std::array<float,2>{0.794493556f, 0.68422997f},
-std::array<float,2>{0.209054708f, 0.305859327f},
-std::array<float,2>{0.617077172f, 0.164704382f},
-std::array<float,2>{0.288171321f, 0.952201247f},
-std::array<float,2>{0.693794489f, 0.854003787f},
-std::array<float,2>{0.450141191f, 0.10198991f},
-std::array<float,2>{0.97159636f, 0.382110149f},
-std::array<float,2>{0.0970733017f, 0.546388447f},
-std::array<float,2>{0.551276624f, 0.623336434f},
-std::array<float,2>{0.373039931f, 0.44032836f},
-std::array<float,2>{0.869061112f, 0.0510771051f},
-std::array<float,2>{0.13279967f, 0.754874468f},
-std::array<float,2>{0.909350514f, 0.903021514f},
-std::array<float,2>{0.00372015871f, 0.189313173f},
-std::array<float,2>{0.660167575f, 0.315557092f},
-std::array<float,2>{0.382147044f, 0.746640384f},
-std::array<float,2>{0.960423827f, 0.505158663f},
-std::array<float,2>{0.0767010301f, 0.421458304f},
-std::array<float,2>{0.73400104f, 0.0640223548f},
-std::array<float,2>{0.482358575f, 0.822800875f},
-std::array<float,2>{0.586726844f, 0.976750016f},
-std::array<float,2>{0.271195471f, 0.146376297f},
-std::array<float,2>{0.772022545f, 0.278716147f},
-std::array<float,2>{0.240448967f, 0.646268904f},
-std::array<float,2>{0.653601766f, 0.705373049f},
-std::array<float,2>{0.421247154f, 0.34998548f},
-std::array<float,2>{0.893432915f, 0.231651589f},
-std::array<float,2>{0.0445998646f, 0.912353694f},
-std::array<float,2>{0.820159674f, 0.785101235f},
-std::array<float,2>{0.15671134f, 0.030173745f},
-std::array<float,2>{0.517107785f, 0.483297795f},
-std::array<float,2>{0.342121571f, 0.584475994f},
-std::array<float,2>{0.849291444f, 0.566360176f},
-std::array<float,2>{0.143361941f, 0.496739358f},
-std::array<float,2>{0.538908303f, 0.00414968422f},
-std::array<float,2>{0.352542877f, 0.810694218f},
-std::array<float,2>{0.674650967f, 0.923895776f},
-std::array<float,2>{0.39299199f, 0.242383286f},
-std::array<float,2>{0.925971389f, 0.367674202f},
-std::array<float,2>{0.0254506972f, 0.701648116f},
-std::array<float,2>{0.609349728f, 0.632142723f},
-std::array<float,2>{0.298494816f, 0.251327723f},
-std::array<float,2>{0.798737764f, 0.133962616f},
-std::array<float,2>{0.189399704f, 0.993801594f},
-std::array<float,2>{0.988129675f, 0.838427663f},
-std::array<float,2>{0.121972226f, 0.0899523422f},
-std::array<float,2>{0.717680097f, 0.433644921f},
-std::array<float,2>{0.468579054f, 0.523491144f},
-std::array<float,2>{0.888695598f, 0.731215477f},
-std::array<float,2>{0.0492490679f, 0.333793372f},
-std::array<float,2>{0.631724238f, 0.217293128f},
-std::array<float,2>{0.429717571f, 0.887638628f},
-std::array<float,2>{0.50049001f, 0.779652059f},
-std::array<float,2>{0.315579027f, 0.0435850881f},
-std::array<float,2>{0.831755579f, 0.455609888f},
-std::array<float,2>{0.180983767f, 0.597294092f},
-std::array<float,2>{0.738889217f, 0.557455957f},
-std::array<float,2>{0.488958031f, 0.395169914f},
-std::array<float,2>{0.93958956f, 0.116727151f},
-std::array<float,2>{0.0793665573f, 0.860111356f},
-std::array<float,2>{0.763883829f, 0.956811488f},
-std::array<float,2>{0.231626928f, 0.177094087f},
-std::array<float,2>{0.577728391f, 0.282208979f},
-std::array<float,2>{0.254552603f, 0.661981583f},
-std::array<float,2>{0.808517575f, 0.707194984f},
-std::array<float,2>{0.198753268f, 0.344772696f},
-std::array<float,2>{0.595151305f, 0.230398238f},
-std::array<float,2>{0.30569306f, 0.910155892f},
-std::array<float,2>{0.707986593f, 0.788098037f},
-std::array<float,2>{0.453821927f, 0.0251430199f},
-std::array<float,2>{0.999841571f, 0.478682876f},
-std::array<float,2>{0.115435198f, 0.579071939f},
-std::array<float,2>{0.543968558f, 0.501249135f},
-std::array<float,2>{0.346206397f, 0.416613191f},
-std::array<float,2>{0.853325486f, 0.0680464134f},
-std::array<float,2>{0.155337483f, 0.826057374f},
-std::array<float,2>{0.931565404f, 0.982126534f},
-std::array<float,2>{0.0212812517f, 0.141857117f},
-std::array<float,2>{0.68577373f, 0.274128765f},
-std::array<float,2>{0.404046029f, 0.643075585f},
-std::array<float,2>{0.94713366f, 0.619758904f},
-std::array<float,2>{0.0925145894f, 0.443787485f},
-std::array<float,2>{0.745478153f, 0.0498137996f},
-std::array<float,2>{0.499350369f, 0.751945436f},
-std::array<float,2>{0.569976866f, 0.902136922f},
-std::array<float,2>{0.25975886f, 0.192251325f},
-std::array<float,2>{0.757417858f, 0.318395466f},
-std::array<float,2>{0.226523429f, 0.744750142f},
-std::array<float,2>{0.633315861f, 0.682982326f},
-std::array<float,2>{0.423852116f, 0.311199874f},
-std::array<float,2>{0.882756233f, 0.170822963f},
-std::array<float,2>{0.0620158091f, 0.945414424f},
-std::array<float,2>{0.842614233f, 0.856329739f},
-std::array<float,2>{0.179023698f, 0.106249213f},
-std::array<float,2>{0.510218501f, 0.378716439f},
-std::array<float,2>{0.320952415f, 0.542836249f},
-std::array<float,2>{0.86353153f, 0.562292099f},
-std::array<float,2>{0.137957856f, 0.391664267f},
-std::array<float,2>{0.561273158f, 0.110361867f},
-std::array<float,2>{0.362573951f, 0.863744915f},
-std::array<float,2>{0.670598626f, 0.958953261f},
-std::array<float,2>{0.389118373f, 0.172877461f},
-std::array<float,2>{0.914206147f, 0.286642879f},
-std::array<float,2>{0.010084209f, 0.658479393f},
-std::array<float,2>{0.623183727f, 0.728649616f},
-std::array<float,2>{0.292099714f, 0.328207999f},
-std::array<float,2>{0.788152933f, 0.212126821f},
-std::array<float,2>{0.214778945f, 0.883344114f},
-std::array<float,2>{0.977132678f, 0.775816858f},
-std::array<float,2>{0.105889544f, 0.0426460542f},
-std::array<float,2>{0.699870288f, 0.45965758f},
-std::array<float,2>{0.443825215f, 0.600378215f},
-std::array<float,2>{0.904524565f, 0.628334284f},
-std::array<float,2>{0.0347570144f, 0.255111128f},
-std::array<float,2>{0.647210717f, 0.137003615f},
-std::array<float,2>{0.412604153f, 0.999685764f},
-std::array<float,2>{0.52471745f, 0.841406405f},
-std::array<float,2>{0.330795407f, 0.0871279463f},
-std::array<float,2>{0.820871651f, 0.431033492f},
-std::array<float,2>{0.165772915f, 0.528529465f},
-std::array<float,2>{0.726166248f, 0.567435324f},
-std::array<float,2>{0.471341074f, 0.493727952f},
-std::array<float,2>{0.965784788f, 0.00246069278f},
-std::array<float,2>{0.0692251921f, 0.8046996f},
-std::array<float,2>{0.775187194f, 0.928018928f},
-std::array<float,2>{0.243395194f, 0.248526484f},
-std::array<float,2>{0.578479052f, 0.371618956f},
-std::array<float,2>{0.276018083f, 0.695455372f},
-std::array<float,2>{0.814395189f, 0.66558665f},
-std::array<float,2>{0.163090438f, 0.294237614f},
-std::array<float,2>{0.521570981f, 0.18376179f},
-std::array<float,2>{0.337475747f, 0.96795702f},
-std::array<float,2>{0.652202129f, 0.867379189f},
-std::array<float,2>{0.415118188f, 0.121006109f},
-std::array<float,2>{0.898086607f, 0.404180348f},
-std::array<float,2>{0.0399302132f, 0.551653206f},
-std::array<float,2>{0.59053123f, 0.607257903f},
-std::array<float,2>{0.266414642f, 0.467079639f},
-std::array<float,2>{0.766757905f, 0.0369557999f},
-std::array<float,2>{0.235323578f, 0.773180425f},
-std::array<float,2>{0.953425109f, 0.88207531f},
-std::array<float,2>{0.0724175125f, 0.209712654f},
-std::array<float,2>{0.729296446f, 0.341022223f},
-std::array<float,2>{0.478259832f, 0.72165525f},
-std::array<float,2>{0.914050162f, 0.52040261f},
-std::array<float,2>{0.00567161012f, 0.42500174f},
-std::array<float,2>{0.657791793f, 0.0826074779f},
-std::array<float,2>{0.377221614f, 0.829244912f},
-std::array<float,2>{0.54898411f, 0.991186082f},
-std::array<float,2>{0.367197365f, 0.129605964f},
-std::array<float,2>{0.873978078f, 0.260818392f},
-std::array<float,2>{0.128787562f, 0.638134837f},
-std::array<float,2>{0.690280259f, 0.693354309f},
-std::array<float,2>{0.446514159f, 0.360396922f},
-std::array<float,2>{0.974572003f, 0.238134652f},
-std::array<float,2>{0.100353442f, 0.935057342f},
-std::array<float,2>{0.789791763f, 0.801340759f},
-std::array<float,2>{0.204955623f, 0.00874995161f},
-std::array<float,2>{0.613273859f, 0.489175379f},
-std::array<float,2>{0.283929974f, 0.576994061f},
-std::array<float,2>{0.760967314f, 0.589814782f},
-std::array<float,2>{0.22693795f, 0.47307533f},
-std::array<float,2>{0.572974682f, 0.0228662919f},
-std::array<float,2>{0.251815438f, 0.79094708f},
-std::array<float,2>{0.738003135f, 0.919570923f},
-std::array<float,2>{0.48789224f, 0.224603847f},
-std::array<float,2>{0.943685293f, 0.357221901f},
-std::array<float,2>{0.0851424411f, 0.712800562f},
-std::array<float,2>{0.506167889f, 0.655143023f},
-std::array<float,2>{0.317470998f, 0.269315779f},
-std::array<float,2>{0.833115935f, 0.150878504f},
-std::array<float,2>{0.184864104f, 0.976029098f},
-std::array<float,2>{0.884502053f, 0.817690372f},
-std::array<float,2>{0.0544483848f, 0.0729975924f},
-std::array<float,2>{0.626700222f, 0.413169205f},
-std::array<float,2>{0.436591029f, 0.509740949f},
-std::array<float,2>{0.989477873f, 0.738850892f},
-std::array<float,2>{0.120505914f, 0.32628423f},
-std::array<float,2>{0.713392377f, 0.201833352f},
-std::array<float,2>{0.464758724f, 0.893259466f},
-std::array<float,2>{0.601810277f, 0.760355294f},
-std::array<float,2>{0.304475218f, 0.0595550127f},
-std::array<float,2>{0.803315699f, 0.445923299f},
-std::array<float,2>{0.192673966f, 0.610627532f},
-std::array<float,2>{0.679530561f, 0.53793031f},
-std::array<float,2>{0.397515565f, 0.38603124f},
-std::array<float,2>{0.922566354f, 0.101494715f},
-std::array<float,2>{0.0300173387f, 0.848232031f},
-std::array<float,2>{0.843921602f, 0.937503338f},
-std::array<float,2>{0.147117704f, 0.16372478f},
-std::array<float,2>{0.532008648f, 0.303976178f},
-std::array<float,2>{0.358230174f, 0.676999271f},
-std::array<float,2>{0.859122157f, 0.724699676f},
-std::array<float,2>{0.151255012f, 0.33707574f},
-std::array<float,2>{0.541490734f, 0.205485687f},
-std::array<float,2>{0.351173401f, 0.8775388f},
-std::array<float,2>{0.681396902f, 0.768742442f},
-std::array<float,2>{0.400145262f, 0.0331541337f},
-std::array<float,2>{0.936167657f, 0.464041084f},
-std::array<float,2>{0.0181301143f, 0.603747129f},
-std::array<float,2>{0.598460853f, 0.549115896f},
-std::array<float,2>{0.308983177f, 0.401328743f},
-std::array<float,2>{0.811709702f, 0.122881897f},
-std::array<float,2>{0.202490151f, 0.87327677f},
-std::array<float,2>{0.993985057f, 0.962390721f},
-std::array<float,2>{0.110262483f, 0.180154562f},
-std::array<float,2>{0.706313372f, 0.290092319f},
-std::array<float,2>{0.460868001f, 0.671703517f},
-std::array<float,2>{0.875940561f, 0.57057941f},
-std::array<float,2>{0.0585424379f, 0.48733753f},
-std::array<float,2>{0.638733268f, 0.0127257705f},
-std::array<float,2>{0.428708911f, 0.798612595f},
-std::array<float,2>{0.513446927f, 0.932765067f},
-std::array<float,2>{0.325056136f, 0.239737809f},
-std::array<float,2>{0.839656472f, 0.364063561f},
-std::array<float,2>{0.175290972f, 0.688298941f},
-std::array<float,2>{0.748017311f, 0.635752797f},
-std::array<float,2>{0.494692743f, 0.26390183f},
-std::array<float,2>{0.951981068f, 0.127928525f},
-std::array<float,2>{0.0897124782f, 0.986291051f},
-std::array<float,2>{0.753378153f, 0.834833622f},
-std::array<float,2>{0.220566928f, 0.0793079287f},
-std::array<float,2>{0.564210653f, 0.428712815f},
-std::array<float,2>{0.263455659f, 0.517719924f},
-std::array<float,2>{0.784936786f, 0.515064538f},
-std::array<float,2>{0.218358576f, 0.408922285f},
-std::array<float,2>{0.62028116f, 0.0743667632f},
-std::array<float,2>{0.293908417f, 0.814679503f},
-std::array<float,2>{0.697521508f, 0.970000565f},
-std::array<float,2>{0.440653801f, 0.154215083f},
-std::array<float,2>{0.980799079f, 0.269628257f},
-std::array<float,2>{0.103166409f, 0.650271237f},
-std::array<float,2>{0.555175364f, 0.717680275f},
-std::array<float,2>{0.366500318f, 0.3529239f},
-std::array<float,2>{0.860130787f, 0.221659556f},
-std::array<float,2>{0.133969054f, 0.91608566f},
-std::array<float,2>{0.920703411f, 0.794963658f},
-std::array<float,2>{0.0135895507f, 0.0190304928f},
-std::array<float,2>{0.665472984f, 0.469823867f},
-std::array<float,2>{0.38444823f, 0.590789914f},
-std::array<float,2>{0.963745117f, 0.675420225f},
-std::array<float,2>{0.0639589354f, 0.300453395f},
-std::array<float,2>{0.720067799f, 0.156273678f},
-std::array<float,2>{0.473775804f, 0.945105672f},
-std::array<float,2>{0.585708678f, 0.846284628f},
-std::array<float,2>{0.279472321f, 0.0945716128f},
-std::array<float,2>{0.777502358f, 0.389500409f},
-std::array<float,2>{0.248803735f, 0.533773899f},
-std::array<float,2>{0.642028689f, 0.614112318f},
-std::array<float,2>{0.407686442f, 0.452053875f},
-std::array<float,2>{0.898836434f, 0.0547888801f},
-std::array<float,2>{0.0367703252f, 0.763773382f},
-std::array<float,2>{0.824733436f, 0.895278275f},
-std::array<float,2>{0.170794696f, 0.198837638f},
-std::array<float,2>{0.528479159f, 0.321584463f},
-std::array<float,2>{0.335442662f, 0.736515045f},
-std::array<float,2>{0.770060182f, 0.646750271f},
-std::array<float,2>{0.239700988f, 0.279622108f},
-std::array<float,2>{0.588237464f, 0.147230551f},
-std::array<float,2>{0.272208929f, 0.979387939f},
-std::array<float,2>{0.73155725f, 0.820990801f},
-std::array<float,2>{0.483357936f, 0.0651833415f},
-std::array<float,2>{0.958230913f, 0.419611573f},
-std::array<float,2>{0.0761638433f, 0.506365895f},
-std::array<float,2>{0.517691553f, 0.582073569f},
-std::array<float,2>{0.341631055f, 0.481051952f},
-std::array<float,2>{0.81789732f, 0.0274189338f},
-std::array<float,2>{0.158602238f, 0.781559944f},
-std::array<float,2>{0.891262949f, 0.911295474f},
-std::array<float,2>{0.0463552549f, 0.233617619f},
-std::array<float,2>{0.655313373f, 0.348912507f},
-std::array<float,2>{0.418578446f, 0.704267263f},
-std::array<float,2>{0.969391048f, 0.543985426f},
-std::array<float,2>{0.0943253264f, 0.3792454f},
-std::array<float,2>{0.693315089f, 0.103854872f},
-std::array<float,2>{0.451952457f, 0.851721108f},
-std::array<float,2>{0.613819301f, 0.950239897f},
-std::array<float,2>{0.28538087f, 0.166627362f},
-std::array<float,2>{0.795210123f, 0.307109594f},
-std::array<float,2>{0.208409041f, 0.686441243f},
-std::array<float,2>{0.662252247f, 0.748509645f},
-std::array<float,2>{0.380080134f, 0.312658846f},
-std::array<float,2>{0.906724513f, 0.190790296f},
-std::array<float,2>{0.00130796921f, 0.906005859f},
-std::array<float,2>{0.870765805f, 0.757698119f},
-std::array<float,2>{0.129898161f, 0.0528817177f},
-std::array<float,2>{0.55362457f, 0.437615991f},
-std::array<float,2>{0.373294622f, 0.621424556f},
-std::array<float,2>{0.828979611f, 0.594594538f},
-std::array<float,2>{0.181816503f, 0.453435749f},
-std::array<float,2>{0.5038656f, 0.0467867255f},
-std::array<float,2>{0.312823653f, 0.7787292f},
-std::array<float,2>{0.628972054f, 0.889068484f},
-std::array<float,2>{0.432029337f, 0.215161905f},
-std::array<float,2>{0.888020754f, 0.335254461f},
-std::array<float,2>{0.047110755f, 0.733321488f},
-std::array<float,2>{0.575522602f, 0.663904428f},
-std::array<float,2>{0.257795453f, 0.28476125f},
-std::array<float,2>{0.76357305f, 0.179482803f},
-std::array<float,2>{0.233959749f, 0.954670608f},
-std::array<float,2>{0.937930226f, 0.861359477f},
-std::array<float,2>{0.0817022249f, 0.114893921f},
-std::array<float,2>{0.740280747f, 0.398027807f},
-std::array<float,2>{0.491082132f, 0.554863393f},
-std::array<float,2>{0.928240299f, 0.699370742f},
-std::array<float,2>{0.0252916608f, 0.370070279f},
-std::array<float,2>{0.672433376f, 0.245057851f},
-std::array<float,2>{0.392179996f, 0.923261881f},
-std::array<float,2>{0.535944402f, 0.809151888f},
-std::array<float,2>{0.353551328f, 0.00655305665f},
-std::array<float,2>{0.850112915f, 0.498574555f},
-std::array<float,2>{0.142431453f, 0.564094007f},
-std::array<float,2>{0.716532409f, 0.526639104f},
-std::array<float,2>{0.466206998f, 0.435958236f},
-std::array<float,2>{0.985844195f, 0.0924949273f},
-std::array<float,2>{0.123240955f, 0.837064207f},
-std::array<float,2>{0.799688697f, 0.99562943f},
-std::array<float,2>{0.190467477f, 0.136104286f},
-std::array<float,2>{0.607179642f, 0.251995504f},
-std::array<float,2>{0.299489439f, 0.630361915f},
-std::array<float,2>{0.758321941f, 0.712153077f},
-std::array<float,2>{0.229433686f, 0.356904656f},
-std::array<float,2>{0.571510971f, 0.223960966f},
-std::array<float,2>{0.252468646f, 0.919259131f},
-std::array<float,2>{0.735140383f, 0.790174603f},
-std::array<float,2>{0.486035556f, 0.0233984943f},
-std::array<float,2>{0.943236649f, 0.473552942f},
-std::array<float,2>{0.0829261839f, 0.588950872f},
-std::array<float,2>{0.505114079f, 0.508981109f},
-std::array<float,2>{0.318760663f, 0.413990825f},
-std::array<float,2>{0.835800946f, 0.0727303401f},
-std::array<float,2>{0.187075615f, 0.818060756f},
-std::array<float,2>{0.885958731f, 0.976298988f},
-std::array<float,2>{0.0510269627f, 0.150996804f},
-std::array<float,2>{0.627437294f, 0.269010812f},
-std::array<float,2>{0.433705717f, 0.654680848f},
-std::array<float,2>{0.990372658f, 0.611310184f},
-std::array<float,2>{0.118235454f, 0.445545644f},
-std::array<float,2>{0.712678015f, 0.0589330271f},
-std::array<float,2>{0.461061686f, 0.75987643f},
-std::array<float,2>{0.604814947f, 0.892839015f},
-std::array<float,2>{0.302396894f, 0.201436028f},
-std::array<float,2>{0.801109195f, 0.327116579f},
-std::array<float,2>{0.193938866f, 0.738330483f},
-std::array<float,2>{0.675872803f, 0.677469194f},
-std::array<float,2>{0.39620629f, 0.304315448f},
-std::array<float,2>{0.923990607f, 0.163392261f},
-std::array<float,2>{0.0283465125f, 0.93842417f},
-std::array<float,2>{0.84579438f, 0.848057568f},
-std::array<float,2>{0.145660728f, 0.100973934f},
-std::array<float,2>{0.53354764f, 0.386611581f},
-std::array<float,2>{0.355790108f, 0.537518084f},
-std::array<float,2>{0.816037297f, 0.55122155f},
-std::array<float,2>{0.160526171f, 0.403742999f},
-std::array<float,2>{0.521098733f, 0.120381653f},
-std::array<float,2>{0.338866144f, 0.867811799f},
-std::array<float,2>{0.650212705f, 0.968748808f},
-std::array<float,2>{0.417079836f, 0.184211001f},
-std::array<float,2>{0.895991921f, 0.294583678f},
-std::array<float,2>{0.0427516289f, 0.665400267f},
-std::array<float,2>{0.593185604f, 0.720969915f},
-std::array<float,2>{0.268130958f, 0.341427028f},
-std::array<float,2>{0.767594934f, 0.209026724f},
-std::array<float,2>{0.236692697f, 0.882800281f},
-std::array<float,2>{0.955339015f, 0.772687137f},
-std::array<float,2>{0.0704976097f, 0.0362000316f},
-std::array<float,2>{0.728118896f, 0.467619389f},
-std::array<float,2>{0.480418772f, 0.6065014f},
-std::array<float,2>{0.91200906f, 0.638355434f},
-std::array<float,2>{0.00722101796f, 0.261550367f},
-std::array<float,2>{0.6583426f, 0.129210576f},
-std::array<float,2>{0.375764489f, 0.990359008f},
-std::array<float,2>{0.548550189f, 0.83001554f},
-std::array<float,2>{0.369295031f, 0.0820935592f},
-std::array<float,2>{0.872510791f, 0.42538479f},
-std::array<float,2>{0.125194371f, 0.519944966f},
-std::array<float,2>{0.689030349f, 0.576605558f},
-std::array<float,2>{0.448575407f, 0.48839432f},
-std::array<float,2>{0.975088596f, 0.00807918608f},
-std::array<float,2>{0.098981306f, 0.800952077f},
-std::array<float,2>{0.792657495f, 0.935191929f},
-std::array<float,2>{0.206199646f, 0.237707928f},
-std::array<float,2>{0.609534085f, 0.360905498f},
-std::array<float,2>{0.282180518f, 0.692840219f},
-std::array<float,2>{0.86629349f, 0.658726335f},
-std::array<float,2>{0.139343202f, 0.286201f},
-std::array<float,2>{0.559904993f, 0.173692346f},
-std::array<float,2>{0.360717922f, 0.958168387f},
-std::array<float,2>{0.669554412f, 0.864233732f},
-std::array<float,2>{0.386839718f, 0.111322507f},
-std::array<float,2>{0.916177213f, 0.392540306f},
-std::array<float,2>{0.00788873341f, 0.561897218f},
-std::array<float,2>{0.621187508f, 0.59967339f},
-std::array<float,2>{0.289097816f, 0.459260792f},
-std::array<float,2>{0.785598695f, 0.0420707501f},
-std::array<float,2>{0.212622955f, 0.776102424f},
-std::array<float,2>{0.978836954f, 0.882965624f},
-std::array<float,2>{0.108261973f, 0.212799057f},
-std::array<float,2>{0.701784492f, 0.328931898f},
-std::array<float,2>{0.441922337f, 0.729388058f},
-std::array<float,2>{0.90379405f, 0.528821766f},
-std::array<float,2>{0.0331639871f, 0.431637555f},
-std::array<float,2>{0.646180928f, 0.0874458402f},
-std::array<float,2>{0.410517126f, 0.841000855f},
-std::array<float,2>{0.52668196f, 0.999344289f},
-std::array<float,2>{0.328797072f, 0.137328491f},
-std::array<float,2>{0.823365748f, 0.255586356f},
-std::array<float,2>{0.166731119f, 0.628879368f},
-std::array<float,2>{0.723685682f, 0.696150422f},
-std::array<float,2>{0.469701737f, 0.371533096f},
-std::array<float,2>{0.967301011f, 0.248546705f},
-std::array<float,2>{0.0664977208f, 0.928294778f},
-std::array<float,2>{0.77642864f, 0.80519557f},
-std::array<float,2>{0.245157123f, 0.00235782121f},
-std::array<float,2>{0.581232488f, 0.493532687f},
-std::array<float,2>{0.273685545f, 0.568175375f},
-std::array<float,2>{0.805967689f, 0.578276396f},
-std::array<float,2>{0.196117729f, 0.47930187f},
-std::array<float,2>{0.597136021f, 0.0245317202f},
-std::array<float,2>{0.307075679f, 0.788931549f},
-std::array<float,2>{0.710782707f, 0.909222424f},
-std::array<float,2>{0.456542581f, 0.229544759f},
-std::array<float,2>{0.996594608f, 0.345499009f},
-std::array<float,2>{0.113807149f, 0.70756036f},
-std::array<float,2>{0.546535432f, 0.642622828f},
-std::array<float,2>{0.343825251f, 0.273445487f},
-std::array<float,2>{0.854446769f, 0.142565727f},
-std::array<float,2>{0.154254511f, 0.98179251f},
-std::array<float,2>{0.931755126f, 0.825285614f},
-std::array<float,2>{0.0227660351f, 0.0675724521f},
-std::array<float,2>{0.684353828f, 0.416378915f},
-std::array<float,2>{0.405941427f, 0.501657665f},
-std::array<float,2>{0.948955297f, 0.744434834f},
-std::array<float,2>{0.0911094472f, 0.319096655f},
-std::array<float,2>{0.742894471f, 0.191450894f},
-std::array<float,2>{0.496344984f, 0.901748598f},
-std::array<float,2>{0.567481279f, 0.751464248f},
-std::array<float,2>{0.261079431f, 0.0507142469f},
-std::array<float,2>{0.755239666f, 0.443913788f},
-std::array<float,2>{0.224133357f, 0.619262338f},
-std::array<float,2>{0.635062993f, 0.54201448f},
-std::array<float,2>{0.423555464f, 0.378243268f},
-std::array<float,2>{0.880779266f, 0.105507351f},
-std::array<float,2>{0.0587969683f, 0.855486274f},
-std::array<float,2>{0.84042865f, 0.94583106f},
-std::array<float,2>{0.177542269f, 0.169948444f},
-std::array<float,2>{0.508217633f, 0.310700297f},
-std::array<float,2>{0.323894769f, 0.68318212f},
-std::array<float,2>{0.831217289f, 0.732704937f},
-std::array<float,2>{0.181476086f, 0.335775733f},
-std::array<float,2>{0.500349224f, 0.215612397f},
-std::array<float,2>{0.316312909f, 0.889425814f},
-std::array<float,2>{0.631176591f, 0.779287517f},
-std::array<float,2>{0.430256575f, 0.0463770665f},
-std::array<float,2>{0.889359355f, 0.45408982f},
-std::array<float,2>{0.0495455638f, 0.59414494f},
-std::array<float,2>{0.57727164f, 0.555565476f},
-std::array<float,2>{0.253942221f, 0.397815704f},
-std::array<float,2>{0.76417923f, 0.11431326f},
-std::array<float,2>{0.232401356f, 0.862107575f},
-std::array<float,2>{0.940256715f, 0.954443097f},
-std::array<float,2>{0.0798265189f, 0.179008976f},
-std::array<float,2>{0.738288581f, 0.284277439f},
-std::array<float,2>{0.488298863f, 0.663291991f},
-std::array<float,2>{0.926528096f, 0.563854218f},
-std::array<float,2>{0.0259254966f, 0.498101175f},
-std::array<float,2>{0.674255431f, 0.00594266877f},
-std::array<float,2>{0.393122017f, 0.808715701f},
-std::array<float,2>{0.538223684f, 0.923503101f},
-std::array<float,2>{0.353484064f, 0.244601682f},
-std::array<float,2>{0.848721445f, 0.36941281f},
-std::array<float,2>{0.142818019f, 0.699720621f},
-std::array<float,2>{0.716979444f, 0.630519748f},
-std::array<float,2>{0.46786648f, 0.252782792f},
-std::array<float,2>{0.987607598f, 0.136523768f},
-std::array<float,2>{0.121437863f, 0.995570838f},
-std::array<float,2>{0.798085928f, 0.837667167f},
-std::array<float,2>{0.188682303f, 0.0921252742f},
-std::array<float,2>{0.608659327f, 0.436485559f},
-std::array<float,2>{0.29828459f, 0.526998878f},
-std::array<float,2>{0.771812439f, 0.50622648f},
-std::array<float,2>{0.240882576f, 0.419392109f},
-std::array<float,2>{0.586175919f, 0.0647533238f},
-std::array<float,2>{0.270753145f, 0.820342541f},
-std::array<float,2>{0.733660817f, 0.978665888f},
-std::array<float,2>{0.481628299f, 0.146643713f},
-std::array<float,2>{0.960612357f, 0.28021723f},
-std::array<float,2>{0.0766234323f, 0.647254407f},
-std::array<float,2>{0.516717434f, 0.704896092f},
-std::array<float,2>{0.342398852f, 0.349234402f},
-std::array<float,2>{0.819748342f, 0.234133139f},
-std::array<float,2>{0.156817615f, 0.911880672f},
-std::array<float,2>{0.893016815f, 0.781815886f},
-std::array<float,2>{0.0442067683f, 0.0280341636f},
-std::array<float,2>{0.654118478f, 0.480629891f},
-std::array<float,2>{0.421463192f, 0.582926393f},
-std::array<float,2>{0.970839798f, 0.685582697f},
-std::array<float,2>{0.0972821116f, 0.307332575f},
-std::array<float,2>{0.693885863f, 0.166050166f},
-std::array<float,2>{0.449565411f, 0.951009631f},
-std::array<float,2>{0.616398454f, 0.852088749f},
-std::array<float,2>{0.288625479f, 0.104478441f},
-std::array<float,2>{0.79441607f, 0.379475802f},
-std::array<float,2>{0.209834009f, 0.544670045f},
-std::array<float,2>{0.661042988f, 0.621888876f},
-std::array<float,2>{0.382593811f, 0.438277274f},
-std::array<float,2>{0.909866869f, 0.0534686409f},
-std::array<float,2>{0.00305723073f, 0.757243872f},
-std::array<float,2>{0.868256986f, 0.905618787f},
-std::array<float,2>{0.131967172f, 0.19134289f},
-std::array<float,2>{0.550843716f, 0.313371629f},
-std::array<float,2>{0.372383267f, 0.748988628f},
-std::array<float,2>{0.78151083f, 0.649584949f},
-std::array<float,2>{0.215069145f, 0.270217985f},
-std::array<float,2>{0.617590189f, 0.153608516f},
-std::array<float,2>{0.296399057f, 0.970275164f},
-std::array<float,2>{0.695661128f, 0.81540966f},
-std::array<float,2>{0.439222842f, 0.0751391575f},
-std::array<float,2>{0.983001471f, 0.408405989f},
-std::array<float,2>{0.104071818f, 0.515440881f},
-std::array<float,2>{0.558210433f, 0.58995229f},
-std::array<float,2>{0.363340169f, 0.470687658f},
-std::array<float,2>{0.862250447f, 0.0192176253f},
-std::array<float,2>{0.13656868f, 0.795626163f},
-std::array<float,2>{0.919044495f, 0.916991234f},
-std::array<float,2>{0.0148817925f, 0.220962271f},
-std::array<float,2>{0.667901158f, 0.353275269f},
-std::array<float,2>{0.386404932f, 0.716833353f},
-std::array<float,2>{0.962497771f, 0.533458114f},
-std::array<float,2>{0.0655033663f, 0.388929039f},
-std::array<float,2>{0.721880436f, 0.0942211673f},
-std::array<float,2>{0.47499758f, 0.846004665f},
-std::array<float,2>{0.583503842f, 0.944414556f},
-std::array<float,2>{0.278822929f, 0.157221332f},
-std::array<float,2>{0.780432999f, 0.299852997f},
-std::array<float,2>{0.24753657f, 0.674987316f},
-std::array<float,2>{0.643228233f, 0.736896932f},
-std::array<float,2>{0.40871653f, 0.322106093f},
-std::array<float,2>{0.901072562f, 0.198332906f},
-std::array<float,2>{0.0376191512f, 0.894894719f},
-std::array<float,2>{0.826908052f, 0.764554858f},
-std::array<float,2>{0.168538824f, 0.055430714f},
-std::array<float,2>{0.530020893f, 0.451570153f},
-std::array<float,2>{0.332330793f, 0.613584876f},
-std::array<float,2>{0.856002688f, 0.604421794f},
-std::array<float,2>{0.149967998f, 0.464749873f},
-std::array<float,2>{0.539643884f, 0.0325680897f},
-std::array<float,2>{0.347867996f, 0.769271374f},
-std::array<float,2>{0.682036817f, 0.877238512f},
-std::array<float,2>{0.40083912f, 0.20574294f},
-std::array<float,2>{0.935527265f, 0.337522626f},
-std::array<float,2>{0.0156376343f, 0.725583553f},
-std::array<float,2>{0.600286424f, 0.671243846f},
-std::array<float,2>{0.312262565f, 0.290647984f},
-std::array<float,2>{0.809405148f, 0.18029964f},
-std::array<float,2>{0.199471861f, 0.962679446f},
-std::array<float,2>{0.994671106f, 0.873880088f},
-std::array<float,2>{0.113206968f, 0.122526459f},
-std::array<float,2>{0.703374565f, 0.400587022f},
-std::array<float,2>{0.458067864f, 0.549803853f},
-std::array<float,2>{0.87873745f, 0.687621832f},
-std::array<float,2>{0.0562984608f, 0.36333403f},
-std::array<float,2>{0.637399197f, 0.239911139f},
-std::array<float,2>{0.426444709f, 0.933164775f},
-std::array<float,2>{0.513914645f, 0.797878325f},
-std::array<float,2>{0.327659279f, 0.0132442918f},
-std::array<float,2>{0.837556362f, 0.48807615f},
-std::array<float,2>{0.172572896f, 0.571200371f},
-std::array<float,2>{0.748235345f, 0.518307865f},
-std::array<float,2>{0.492735356f, 0.429515302f},
-std::array<float,2>{0.95033741f, 0.0797298774f},
-std::array<float,2>{0.0875902325f, 0.834059656f},
-std::array<float,2>{0.750170767f, 0.985619962f},
-std::array<float,2>{0.221286222f, 0.127345949f},
-std::array<float,2>{0.565513968f, 0.264216125f},
-std::array<float,2>{0.264195919f, 0.636595905f},
-std::array<float,2>{0.802897334f, 0.740633726f},
-std::array<float,2>{0.193352267f, 0.325719684f},
-std::array<float,2>{0.602433205f, 0.200103924f},
-std::array<float,2>{0.304173142f, 0.892301679f},
-std::array<float,2>{0.71336621f, 0.759234965f},
-std::array<float,2>{0.463971674f, 0.061561361f},
-std::array<float,2>{0.989791334f, 0.447823197f},
-std::array<float,2>{0.120965138f, 0.612384617f},
-std::array<float,2>{0.531483352f, 0.536129773f},
-std::array<float,2>{0.357696116f, 0.383157194f},
-std::array<float,2>{0.844412386f, 0.0985190123f},
-std::array<float,2>{0.14667511f, 0.850926101f},
-std::array<float,2>{0.9219203f, 0.94046241f},
-std::array<float,2>{0.0293182842f, 0.161354572f},
-std::array<float,2>{0.678864181f, 0.300842255f},
-std::array<float,2>{0.398117065f, 0.678353846f},
-std::array<float,2>{0.944288552f, 0.586871028f},
-std::array<float,2>{0.0857402384f, 0.474662125f},
-std::array<float,2>{0.737405717f, 0.0196173731f},
-std::array<float,2>{0.487521768f, 0.791368484f},
-std::array<float,2>{0.572389603f, 0.920075953f},
-std::array<float,2>{0.251422822f, 0.225528166f},
-std::array<float,2>{0.761257827f, 0.359236568f},
-std::array<float,2>{0.227509305f, 0.714461863f},
-std::array<float,2>{0.626209676f, 0.653271556f},
-std::array<float,2>{0.437015474f, 0.267344654f},
-std::array<float,2>{0.884103715f, 0.148983881f},
-std::array<float,2>{0.0539680533f, 0.974117756f},
-std::array<float,2>{0.833702147f, 0.818575621f},
-std::array<float,2>{0.185255915f, 0.071447365f},
-std::array<float,2>{0.506450772f, 0.410719633f},
-std::array<float,2>{0.318173379f, 0.510754049f},
-std::array<float,2>{0.873468876f, 0.521977246f},
-std::array<float,2>{0.127992764f, 0.42354399f},
-std::array<float,2>{0.549575865f, 0.084201239f},
-std::array<float,2>{0.367975473f, 0.830203056f},
-std::array<float,2>{0.657414794f, 0.990105748f},
-std::array<float,2>{0.377676606f, 0.132337049f},
-std::array<float,2>{0.913544953f, 0.259005606f},
-std::array<float,2>{0.00512292795f, 0.639122009f},
-std::array<float,2>{0.612395346f, 0.693807065f},
-std::array<float,2>{0.283362478f, 0.361973137f},
-std::array<float,2>{0.789412379f, 0.235546142f},
-std::array<float,2>{0.204207703f, 0.937166512f},
-std::array<float,2>{0.973929286f, 0.80426985f},
-std::array<float,2>{0.0997923911f, 0.0110085607f},
-std::array<float,2>{0.689573646f, 0.491387814f},
-std::array<float,2>{0.446872681f, 0.574894845f},
-std::array<float,2>{0.897677124f, 0.666273057f},
-std::array<float,2>{0.039212808f, 0.29634577f},
-std::array<float,2>{0.651710927f, 0.185618877f},
-std::array<float,2>{0.415765256f, 0.9654423f},
-std::array<float,2>{0.522024989f, 0.871008575f},
-std::array<float,2>{0.337179601f, 0.118856706f},
-std::array<float,2>{0.813577354f, 0.404311031f},
-std::array<float,2>{0.163950339f, 0.553728223f},
-std::array<float,2>{0.728780389f, 0.60845381f},
-std::array<float,2>{0.477758855f, 0.465757787f},
-std::array<float,2>{0.953933299f, 0.0377999581f},
-std::array<float,2>{0.0729792565f, 0.770059764f},
-std::array<float,2>{0.767169893f, 0.879704237f},
-std::array<float,2>{0.23458612f, 0.208658919f},
-std::array<float,2>{0.590023994f, 0.342630655f},
-std::array<float,2>{0.265800804f, 0.719537973f},
-std::array<float,2>{0.820755124f, 0.626201928f},
-std::array<float,2>{0.165292606f, 0.257775247f},
-std::array<float,2>{0.524980605f, 0.139844358f},
-std::array<float,2>{0.330216289f, 0.997591615f},
-std::array<float,2>{0.646814108f, 0.843178988f},
-std::array<float,2>{0.412341177f, 0.0887626037f},
-std::array<float,2>{0.905023754f, 0.432661623f},
-std::array<float,2>{0.0342514701f, 0.531184137f},
-std::array<float,2>{0.578655362f, 0.56951052f},
-std::array<float,2>{0.275422484f, 0.495784938f},
-std::array<float,2>{0.774672389f, 0.00152359018f},
-std::array<float,2>{0.243821412f, 0.808408618f},
-std::array<float,2>{0.96526742f, 0.926023424f},
-std::array<float,2>{0.0684442595f, 0.246624678f},
-std::array<float,2>{0.725831807f, 0.37492916f},
-std::array<float,2>{0.470890254f, 0.697350621f},
-std::array<float,2>{0.915035486f, 0.559737742f},
-std::array<float,2>{0.0105197318f, 0.39363277f},
-std::array<float,2>{0.669984281f, 0.112534426f},
-std::array<float,2>{0.389534444f, 0.865890384f},
-std::array<float,2>{0.560649931f, 0.959279478f},
-std::array<float,2>{0.363020629f, 0.173926264f},
-std::array<float,2>{0.864024043f, 0.288822889f},
-std::array<float,2>{0.138344005f, 0.65625006f},
-std::array<float,2>{0.699622929f, 0.727560341f},
-std::array<float,2>{0.444016933f, 0.330249637f},
-std::array<float,2>{0.976714611f, 0.214305133f},
-std::array<float,2>{0.106034718f, 0.884815991f},
-std::array<float,2>{0.788745046f, 0.7744748f},
-std::array<float,2>{0.214009181f, 0.0407054238f},
-std::array<float,2>{0.623776257f, 0.458773404f},
-std::array<float,2>{0.292912483f, 0.599460065f},
-std::array<float,2>{0.757248819f, 0.618077576f},
-std::array<float,2>{0.225626662f, 0.442364722f},
-std::array<float,2>{0.569728911f, 0.0486655273f},
-std::array<float,2>{0.259162366f, 0.752564013f},
-std::array<float,2>{0.745817482f, 0.900028884f},
-std::array<float,2>{0.499529034f, 0.193517804f},
-std::array<float,2>{0.946606934f, 0.318131447f},
-std::array<float,2>{0.0919366628f, 0.742977679f},
-std::array<float,2>{0.51064533f, 0.681210279f},
-std::array<float,2>{0.320474595f, 0.308704346f},
-std::array<float,2>{0.841913342f, 0.169872791f},
-std::array<float,2>{0.1794765f, 0.948628426f},
-std::array<float,2>{0.881864727f, 0.857557893f},
-std::array<float,2>{0.0617233589f, 0.109272368f},
-std::array<float,2>{0.633090317f, 0.375135362f},
-std::array<float,2>{0.424683511f, 0.540664256f},
-std::array<float,2>{0.999258995f, 0.709958851f},
-std::array<float,2>{0.116189942f, 0.345907211f},
-std::array<float,2>{0.707296073f, 0.226638556f},
-std::array<float,2>{0.453223318f, 0.907620847f},
-std::array<float,2>{0.595687151f, 0.786243021f},
-std::array<float,2>{0.306411505f, 0.0268671978f},
-std::array<float,2>{0.807800353f, 0.477153361f},
-std::array<float,2>{0.198619455f, 0.58037132f},
-std::array<float,2>{0.686316133f, 0.503382921f},
-std::array<float,2>{0.403620571f, 0.415879399f},
-std::array<float,2>{0.930724025f, 0.0692417398f},
-std::array<float,2>{0.0205655992f, 0.826417267f},
-std::array<float,2>{0.852611542f, 0.983754694f},
-std::array<float,2>{0.156235948f, 0.143278912f},
-std::array<float,2>{0.544485569f, 0.275493681f},
-std::array<float,2>{0.346011072f, 0.640818f},
-std::array<float,2>{0.849974334f, 0.701708317f},
-std::array<float,2>{0.141975045f, 0.368062705f},
-std::array<float,2>{0.53559202f, 0.242750466f},
-std::array<float,2>{0.354271352f, 0.924576044f},
-std::array<float,2>{0.672188282f, 0.811107516f},
-std::array<float,2>{0.391667992f, 0.00475889444f},
-std::array<float,2>{0.927892447f, 0.496319532f},
-std::array<float,2>{0.024634717f, 0.565857947f},
-std::array<float,2>{0.60686928f, 0.524000645f},
-std::array<float,2>{0.299277246f, 0.43443051f},
-std::array<float,2>{0.799032986f, 0.0907058492f},
-std::array<float,2>{0.190930024f, 0.838187516f},
-std::array<float,2>{0.985824227f, 0.993179321f},
-std::array<float,2>{0.123607777f, 0.134735122f},
-std::array<float,2>{0.716115952f, 0.251583457f},
-std::array<float,2>{0.466369659f, 0.632695019f},
-std::array<float,2>{0.8883636f, 0.596809149f},
-std::array<float,2>{0.0477718972f, 0.455197453f},
-std::array<float,2>{0.629418671f, 0.0431766286f},
-std::array<float,2>{0.432216257f, 0.780029893f},
-std::array<float,2>{0.503017545f, 0.88681215f},
-std::array<float,2>{0.313170582f, 0.217183977f},
-std::array<float,2>{0.828360617f, 0.333326131f},
-std::array<float,2>{0.182291478f, 0.730615556f},
-std::array<float,2>{0.741115034f, 0.661308408f},
-std::array<float,2>{0.490552038f, 0.281586051f},
-std::array<float,2>{0.938171804f, 0.17739448f},
-std::array<float,2>{0.0813036859f, 0.956272066f},
-std::array<float,2>{0.762883246f, 0.859846354f},
-std::array<float,2>{0.233629137f, 0.116413973f},
-std::array<float,2>{0.575780749f, 0.39470771f},
-std::array<float,2>{0.256911606f, 0.556944728f},
-std::array<float,2>{0.795742273f, 0.546199143f},
-std::array<float,2>{0.208969191f, 0.382698357f},
-std::array<float,2>{0.613436222f, 0.10220512f},
-std::array<float,2>{0.285874635f, 0.854229748f},
-std::array<float,2>{0.692730665f, 0.952652931f},
-std::array<float,2>{0.451201528f, 0.164423421f},
-std::array<float,2>{0.968862772f, 0.306263179f},
-std::array<float,2>{0.0942326188f, 0.683677077f},
-std::array<float,2>{0.552898645f, 0.74642688f},
-std::array<float,2>{0.373631448f, 0.316399097f},
-std::array<float,2>{0.870488584f, 0.188670725f},
-std::array<float,2>{0.130518734f, 0.902586222f},
-std::array<float,2>{0.907209575f, 0.754204512f},
-std::array<float,2>{0.00168083643f, 0.051621493f},
-std::array<float,2>{0.662720561f, 0.439914107f},
-std::array<float,2>{0.380579621f, 0.623975694f},
-std::array<float,2>{0.958923638f, 0.645605087f},
-std::array<float,2>{0.0755960718f, 0.279136837f},
-std::array<float,2>{0.732205868f, 0.145770311f},
-std::array<float,2>{0.482775748f, 0.977482915f},
-std::array<float,2>{0.588518858f, 0.822679102f},
-std::array<float,2>{0.271879852f, 0.0638135225f},
-std::array<float,2>{0.769600451f, 0.421062291f},
-std::array<float,2>{0.239789799f, 0.505798161f},
-std::array<float,2>{0.656178832f, 0.58405596f},
-std::array<float,2>{0.418349534f, 0.482548326f},
-std::array<float,2>{0.890939474f, 0.029582914f},
-std::array<float,2>{0.0465725027f, 0.784488559f},
-std::array<float,2>{0.817631185f, 0.912943721f},
-std::array<float,2>{0.158719689f, 0.232304573f},
-std::array<float,2>{0.518212259f, 0.350166231f},
-std::array<float,2>{0.340828687f, 0.705873907f},
-std::array<float,2>{0.778300345f, 0.672664106f},
-std::array<float,2>{0.248148993f, 0.297821671f},
-std::array<float,2>{0.585346937f, 0.159362242f},
-std::array<float,2>{0.280028135f, 0.942651212f},
-std::array<float,2>{0.720339417f, 0.843922555f},
-std::array<float,2>{0.474251956f, 0.0966527537f},
-std::array<float,2>{0.96304214f, 0.387789339f},
-std::array<float,2>{0.0642331541f, 0.533075035f},
-std::array<float,2>{0.529079854f, 0.616511166f},
-std::array<float,2>{0.335762352f, 0.449857503f},
-std::array<float,2>{0.824421108f, 0.0583366416f},
-std::array<float,2>{0.170063153f, 0.762442112f},
-std::array<float,2>{0.899159253f, 0.897276402f},
-std::array<float,2>{0.0365807861f, 0.197150022f},
-std::array<float,2>{0.642397702f, 0.324132681f},
-std::array<float,2>{0.408013284f, 0.73537004f},
-std::array<float,2>{0.981443465f, 0.513002813f},
-std::array<float,2>{0.102683879f, 0.406924933f},
-std::array<float,2>{0.697946668f, 0.0770571455f},
-std::array<float,2>{0.4412826f, 0.814274311f},
-std::array<float,2>{0.62069273f, 0.971127152f},
-std::array<float,2>{0.293193251f, 0.155014187f},
-std::array<float,2>{0.784594953f, 0.273188591f},
-std::array<float,2>{0.218016893f, 0.651697457f},
-std::array<float,2>{0.665734589f, 0.715781271f},
-std::array<float,2>{0.383880049f, 0.354275763f},
-std::array<float,2>{0.920170426f, 0.220246717f},
-std::array<float,2>{0.0128086805f, 0.914190471f},
-std::array<float,2>{0.859689713f, 0.794837177f},
-std::array<float,2>{0.134322256f, 0.0174213648f},
-std::array<float,2>{0.55536288f, 0.471650422f},
-std::array<float,2>{0.366854459f, 0.592455387f},
-std::array<float,2>{0.838928878f, 0.573547244f},
-std::array<float,2>{0.175439626f, 0.485004306f},
-std::array<float,2>{0.513004541f, 0.0150899757f},
-std::array<float,2>{0.324516773f, 0.799350798f},
-std::array<float,2>{0.639490426f, 0.930087626f},
-std::array<float,2>{0.428134531f, 0.241932616f},
-std::array<float,2>{0.875487983f, 0.366880506f},
-std::array<float,2>{0.0580773689f, 0.689930677f},
-std::array<float,2>{0.563499451f, 0.632850051f},
-std::array<float,2>{0.26275149f, 0.26287505f},
-std::array<float,2>{0.75360775f, 0.125299811f},
-std::array<float,2>{0.219796151f, 0.988114417f},
-std::array<float,2>{0.951470852f, 0.83217442f},
-std::array<float,2>{0.0892777964f, 0.0811249018f},
-std::array<float,2>{0.747260332f, 0.427619815f},
-std::array<float,2>{0.494201154f, 0.517479479f},
-std::array<float,2>{0.93571353f, 0.723038793f},
-std::array<float,2>{0.0176471658f, 0.339102417f},
-std::array<float,2>{0.680718422f, 0.204032108f},
-std::array<float,2>{0.39972052f, 0.876489222f},
-std::array<float,2>{0.541696489f, 0.766980469f},
-std::array<float,2>{0.350972503f, 0.0348627046f},
-std::array<float,2>{0.858578503f, 0.461648554f},
-std::array<float,2>{0.150655195f, 0.60184449f},
-std::array<float,2>{0.706868887f, 0.547392607f},
-std::array<float,2>{0.460038036f, 0.400020003f},
-std::array<float,2>{0.993512571f, 0.124142282f},
-std::array<float,2>{0.109390475f, 0.871622801f},
-std::array<float,2>{0.812415004f, 0.964065671f},
-std::array<float,2>{0.202950835f, 0.181945875f},
-std::array<float,2>{0.597763717f, 0.291671723f},
-std::array<float,2>{0.309311658f, 0.668969393f},
-std::array<float,2>{0.768558979f, 0.720694542f},
-std::array<float,2>{0.237500161f, 0.343167335f},
-std::array<float,2>{0.592450738f, 0.20757179f},
-std::array<float,2>{0.268943667f, 0.880856633f},
-std::array<float,2>{0.727087677f, 0.77125442f},
-std::array<float,2>{0.479135752f, 0.0385254174f},
-std::array<float,2>{0.956524968f, 0.46650362f},
-std::array<float,2>{0.0721621066f, 0.607544661f},
-std::array<float,2>{0.520099938f, 0.553546786f},
-std::array<float,2>{0.339003652f, 0.405388743f},
-std::array<float,2>{0.814916074f, 0.117314391f},
-std::array<float,2>{0.161165535f, 0.870056689f},
-std::array<float,2>{0.894551575f, 0.966386795f},
-std::array<float,2>{0.0417039506f, 0.18665418f},
-std::array<float,2>{0.648447514f, 0.295283198f},
-std::array<float,2>{0.416578561f, 0.667625725f},
-std::array<float,2>{0.975680768f, 0.576101005f},
-std::array<float,2>{0.0985392854f, 0.491025507f},
-std::array<float,2>{0.687590003f, 0.00980035961f},
-std::array<float,2>{0.447788954f, 0.802816749f},
-std::array<float,2>{0.610475957f, 0.936089218f},
-std::array<float,2>{0.282518178f, 0.235323414f},
-std::array<float,2>{0.791936874f, 0.362762928f},
-std::array<float,2>{0.205590874f, 0.694522619f},
-std::array<float,2>{0.660081565f, 0.640233338f},
-std::array<float,2>{0.376743674f, 0.258454651f},
-std::array<float,2>{0.910639286f, 0.131140336f},
-std::array<float,2>{0.00639419304f, 0.988923013f},
-std::array<float,2>{0.871686578f, 0.831738174f},
-std::array<float,2>{0.126299724f, 0.0857836306f},
-std::array<float,2>{0.547290981f, 0.42245084f},
-std::array<float,2>{0.370609015f, 0.522793353f},
-std::array<float,2>{0.834031224f, 0.510130584f},
-std::array<float,2>{0.18555966f, 0.411160767f},
-std::array<float,2>{0.504067898f, 0.0705687255f},
-std::array<float,2>{0.320019692f, 0.819674134f},
-std::array<float,2>{0.628274202f, 0.973123968f},
-std::array<float,2>{0.434579223f, 0.149543166f},
-std::array<float,2>{0.884972215f, 0.266202897f},
-std::array<float,2>{0.0517729186f, 0.65340513f},
-std::array<float,2>{0.570796371f, 0.713765919f},
-std::array<float,2>{0.25335753f, 0.358153313f},
-std::array<float,2>{0.75947839f, 0.226084575f},
-std::array<float,2>{0.229872048f, 0.921180308f},
-std::array<float,2>{0.942288578f, 0.792811215f},
-std::array<float,2>{0.0837046653f, 0.021073753f},
-std::array<float,2>{0.736280143f, 0.476208121f},
-std::array<float,2>{0.484772682f, 0.587517679f},
-std::array<float,2>{0.925671995f, 0.678987622f},
-std::array<float,2>{0.0275137294f, 0.302580178f},
-std::array<float,2>{0.67772454f, 0.160828903f},
-std::array<float,2>{0.395383835f, 0.940102935f},
-std::array<float,2>{0.534288764f, 0.849775612f},
-std::array<float,2>{0.356816232f, 0.0990942493f},
-std::array<float,2>{0.847481847f, 0.384630978f},
-std::array<float,2>{0.145466015f, 0.536597848f},
-std::array<float,2>{0.711232543f, 0.611405313f},
-std::array<float,2>{0.462232888f, 0.448906004f},
-std::array<float,2>{0.991877496f, 0.0615161732f},
-std::array<float,2>{0.117980808f, 0.758065403f},
-std::array<float,2>{0.801793694f, 0.891483247f},
-std::array<float,2>{0.195300475f, 0.200746581f},
-std::array<float,2>{0.60428983f, 0.324844033f},
-std::array<float,2>{0.301487297f, 0.741933942f},
-std::array<float,2>{0.854984701f, 0.641613841f},
-std::array<float,2>{0.152741417f, 0.276962966f},
-std::array<float,2>{0.545756578f, 0.144370079f},
-std::array<float,2>{0.345194995f, 0.982649446f},
-std::array<float,2>{0.684868932f, 0.827268362f},
-std::array<float,2>{0.405216753f, 0.0700189769f},
-std::array<float,2>{0.932824254f, 0.414605021f},
-std::array<float,2>{0.0221589319f, 0.502149582f},
-std::array<float,2>{0.596523821f, 0.582029521f},
-std::array<float,2>{0.308373392f, 0.47825259f},
-std::array<float,2>{0.805486739f, 0.0262979865f},
-std::array<float,2>{0.196385726f, 0.785783112f},
-std::array<float,2>{0.997117221f, 0.906252921f},
-std::array<float,2>{0.114405565f, 0.228212506f},
-std::array<float,2>{0.70948422f, 0.347273529f},
-std::array<float,2>{0.455510587f, 0.710461915f},
-std::array<float,2>{0.879197121f, 0.539567947f},
-std::array<float,2>{0.0597569235f, 0.376525879f},
-std::array<float,2>{0.635971606f, 0.107466184f},
-std::array<float,2>{0.422405392f, 0.859288871f},
-std::array<float,2>{0.508832574f, 0.947485387f},
-std::array<float,2>{0.322550893f, 0.168805882f},
-std::array<float,2>{0.841150761f, 0.310079694f},
-std::array<float,2>{0.176652685f, 0.680097163f},
-std::array<float,2>{0.743949234f, 0.743287504f},
-std::array<float,2>{0.49733147f, 0.316709012f},
-std::array<float,2>{0.947696328f, 0.194404513f},
-std::array<float,2>{0.090749599f, 0.898809969f},
-std::array<float,2>{0.754632711f, 0.753555357f},
-std::array<float,2>{0.222685963f, 0.0473285764f},
-std::array<float,2>{0.566615582f, 0.442840248f},
-std::array<float,2>{0.260574102f, 0.618657172f},
-std::array<float,2>{0.78666991f, 0.598088443f},
-std::array<float,2>{0.211022109f, 0.457944661f},
-std::array<float,2>{0.622662365f, 0.0392355733f},
-std::array<float,2>{0.290352911f, 0.77361834f},
-std::array<float,2>{0.702454209f, 0.886023521f},
-std::array<float,2>{0.443284303f, 0.213515505f},
-std::array<float,2>{0.98004216f, 0.332022876f},
-std::array<float,2>{0.108504377f, 0.727044165f},
-std::array<float,2>{0.559493065f, 0.65802902f},
-std::array<float,2>{0.36029616f, 0.287461698f},
-std::array<float,2>{0.865582705f, 0.175108328f},
-std::array<float,2>{0.139952734f, 0.960820019f},
-std::array<float,2>{0.91708082f, 0.866757154f},
-std::array<float,2>{0.00916466117f, 0.112082563f},
-std::array<float,2>{0.668368042f, 0.393197298f},
-std::array<float,2>{0.388090581f, 0.558748066f},
-std::array<float,2>{0.968418121f, 0.698711753f},
-std::array<float,2>{0.068308033f, 0.373672038f},
-std::array<float,2>{0.723211586f, 0.247284204f},
-std::array<float,2>{0.469767034f, 0.92751801f},
-std::array<float,2>{0.580236018f, 0.807216644f},
-std::array<float,2>{0.275221199f, 0.00053096906f},
-std::array<float,2>{0.775866032f, 0.494639099f},
-std::array<float,2>{0.245041102f, 0.56852138f},
-std::array<float,2>{0.644852042f, 0.529406428f},
-std::array<float,2>{0.411312997f, 0.431861132f},
-std::array<float,2>{0.903073728f, 0.0893669054f},
-std::array<float,2>{0.0313514508f, 0.841822326f},
-std::array<float,2>{0.822719336f, 0.996782303f},
-std::array<float,2>{0.167902529f, 0.139012635f},
-std::array<float,2>{0.525451958f, 0.256420255f},
-std::array<float,2>{0.329374194f, 0.625568569f},
-std::array<float,2>{0.819058061f, 0.706059456f},
-std::array<float,2>{0.157890335f, 0.350710958f},
-std::array<float,2>{0.516484141f, 0.231243312f},
-std::array<float,2>{0.343410432f, 0.913713932f},
-std::array<float,2>{0.652891397f, 0.784029484f},
-std::array<float,2>{0.42067951f, 0.0302857384f},
-std::array<float,2>{0.894488692f, 0.483668566f},
-std::array<float,2>{0.0436795354f, 0.585840523f},
-std::array<float,2>{0.587593079f, 0.504507363f},
-std::array<float,2>{0.269838214f, 0.420384437f},
-std::array<float,2>{0.773261547f, 0.0631363317f},
-std::array<float,2>{0.241719291f, 0.823720038f},
-std::array<float,2>{0.959829271f, 0.978323698f},
-std::array<float,2>{0.0771661028f, 0.144898444f},
-std::array<float,2>{0.733273089f, 0.278229326f},
-std::array<float,2>{0.48059535f, 0.645463526f},
-std::array<float,2>{0.909094334f, 0.62463963f},
-std::array<float,2>{0.00215382827f, 0.440983117f},
-std::array<float,2>{0.661366642f, 0.0524682812f},
-std::array<float,2>{0.380884349f, 0.755573869f},
-std::array<float,2>{0.552570522f, 0.903844476f},
-std::array<float,2>{0.372030288f, 0.187803999f},
-std::array<float,2>{0.867535353f, 0.315045923f},
-std::array<float,2>{0.131441534f, 0.747424603f},
-std::array<float,2>{0.694822311f, 0.684815049f},
-std::array<float,2>{0.450398773f, 0.305579484f},
-std::array<float,2>{0.971818805f, 0.165437222f},
-std::array<float,2>{0.0963770002f, 0.951422095f},
-std::array<float,2>{0.793297708f, 0.855200589f},
-std::array<float,2>{0.210149616f, 0.103046656f},
-std::array<float,2>{0.61526525f, 0.381586134f},
-std::array<float,2>{0.287243634f, 0.545732558f},
-std::array<float,2>{0.765089929f, 0.557877839f},
-std::array<float,2>{0.230982915f, 0.395727247f},
-std::array<float,2>{0.57633841f, 0.115972549f},
-std::array<float,2>{0.255643576f, 0.861299276f},
-std::array<float,2>{0.740113378f, 0.955724835f},
-std::array<float,2>{0.490114927f, 0.176548809f},
-std::array<float,2>{0.940769672f, 0.28280741f},
-std::array<float,2>{0.0790507123f, 0.660211086f},
-std::array<float,2>{0.501701415f, 0.731940508f},
-std::array<float,2>{0.314920783f, 0.332906842f},
-std::array<float,2>{0.830349088f, 0.218121842f},
-std::array<float,2>{0.1805996f, 0.887884796f},
-std::array<float,2>{0.890390217f, 0.780736983f},
-std::array<float,2>{0.050493136f, 0.0443203747f},
-std::array<float,2>{0.632002294f, 0.457011014f},
-std::array<float,2>{0.431442022f, 0.59648782f},
-std::array<float,2>{0.987011731f, 0.63090682f},
-std::array<float,2>{0.122796811f, 0.250590622f},
-std::array<float,2>{0.718418717f, 0.133724287f},
-std::array<float,2>{0.46703285f, 0.992287338f},
-std::array<float,2>{0.607854545f, 0.839513958f},
-std::array<float,2>{0.297785342f, 0.0916996226f},
-std::array<float,2>{0.797576249f, 0.435270071f},
-std::array<float,2>{0.187978119f, 0.525301874f},
-std::array<float,2>{0.675394535f, 0.565304756f},
-std::array<float,2>{0.394039124f, 0.497170866f},
-std::array<float,2>{0.927416444f, 0.00518588116f},
-std::array<float,2>{0.0270982664f, 0.812057674f},
-std::array<float,2>{0.848303795f, 0.925743341f},
-std::array<float,2>{0.14435336f, 0.243229702f},
-std::array<float,2>{0.538043678f, 0.369062662f},
-std::array<float,2>{0.351713419f, 0.70280242f},
-std::array<float,2>{0.809985101f, 0.668144286f},
-std::array<float,2>{0.200419173f, 0.292184383f},
-std::array<float,2>{0.601075053f, 0.183362439f},
-std::array<float,2>{0.310853958f, 0.963339388f},
-std::array<float,2>{0.704821408f, 0.872337162f},
-std::array<float,2>{0.457481235f, 0.12386167f},
-std::array<float,2>{0.995807111f, 0.399356037f},
-std::array<float,2>{0.112004898f, 0.548525512f},
-std::array<float,2>{0.540995955f, 0.602971137f},
-std::array<float,2>{0.348892301f, 0.462260038f},
-std::array<float,2>{0.857220709f, 0.0333183445f},
-std::array<float,2>{0.148949966f, 0.766119421f},
-std::array<float,2>{0.933896959f, 0.875691891f},
-std::array<float,2>{0.0166993923f, 0.204993218f},
-std::array<float,2>{0.68329066f, 0.338025421f},
-std::array<float,2>{0.401985645f, 0.72394985f},
-std::array<float,2>{0.949478805f, 0.516523659f},
-std::array<float,2>{0.0859447122f, 0.426071644f},
-std::array<float,2>{0.749668002f, 0.0805874094f},
-std::array<float,2>{0.493269205f, 0.833658755f},
-std::array<float,2>{0.565200329f, 0.986748755f},
-std::array<float,2>{0.265545666f, 0.126212955f},
-std::array<float,2>{0.751840532f, 0.262431353f},
-std::array<float,2>{0.222372487f, 0.633983135f},
-std::array<float,2>{0.637759864f, 0.690551281f},
-std::array<float,2>{0.427458763f, 0.365319461f},
-std::array<float,2>{0.877538741f, 0.240500778f},
-std::array<float,2>{0.0549773425f, 0.930980027f},
-std::array<float,2>{0.83621949f, 0.799864948f},
-std::array<float,2>{0.173743054f, 0.0139675718f},
-std::array<float,2>{0.514928758f, 0.485474408f},
-std::array<float,2>{0.326694012f, 0.572560787f},
-std::array<float,2>{0.862565815f, 0.593083322f},
-std::array<float,2>{0.1350476f, 0.472300589f},
-std::array<float,2>{0.557194293f, 0.0164483376f},
-std::array<float,2>{0.364528686f, 0.793871164f},
-std::array<float,2>{0.666077316f, 0.915072799f},
-std::array<float,2>{0.385708869f, 0.218946978f},
-std::array<float,2>{0.918779731f, 0.35456273f},
-std::array<float,2>{0.0139701916f, 0.715958238f},
-std::array<float,2>{0.61817348f, 0.650471509f},
-std::array<float,2>{0.295342982f, 0.27181384f},
-std::array<float,2>{0.782555997f, 0.155892894f},
-std::array<float,2>{0.216236845f, 0.971834183f},
-std::array<float,2>{0.983919859f, 0.813269854f},
-std::array<float,2>{0.104794465f, 0.077286236f},
-std::array<float,2>{0.697125196f, 0.407287717f},
-std::array<float,2>{0.437547356f, 0.51269424f},
-std::array<float,2>{0.901727021f, 0.734628916f},
-std::array<float,2>{0.0387892649f, 0.323078603f},
-std::array<float,2>{0.64437288f, 0.195403516f},
-std::array<float,2>{0.410119951f, 0.897498012f},
-std::array<float,2>{0.530634046f, 0.763405919f},
-std::array<float,2>{0.333272666f, 0.0572819375f},
-std::array<float,2>{0.827304959f, 0.451004386f},
-std::array<float,2>{0.169422731f, 0.6155321f},
-std::array<float,2>{0.721293628f, 0.531885505f},
-std::array<float,2>{0.475809515f, 0.387191981f},
-std::array<float,2>{0.961817384f, 0.0973259062f},
-std::array<float,2>{0.064528048f, 0.845599532f},
-std::array<float,2>{0.780097723f, 0.941900492f},
-std::array<float,2>{0.246845767f, 0.158524171f},
-std::array<float,2>{0.582081318f, 0.29861629f},
-std::array<float,2>{0.277735442f, 0.673792481f},
-std::array<float,2>{0.790682256f, 0.691408753f},
-std::array<float,2>{0.203563049f, 0.360103786f},
-std::array<float,2>{0.611476362f, 0.236650422f},
-std::array<float,2>{0.285154611f, 0.934462011f},
-std::array<float,2>{0.690696597f, 0.802009046f},
-std::array<float,2>{0.446062565f, 0.00939614605f},
-std::array<float,2>{0.972694457f, 0.490104169f},
-std::array<float,2>{0.100838624f, 0.577721238f},
-std::array<float,2>{0.550272703f, 0.521284521f},
-std::array<float,2>{0.369137168f, 0.424369127f},
-std::array<float,2>{0.874307334f, 0.0833338946f},
-std::array<float,2>{0.127769157f, 0.828384638f},
-std::array<float,2>{0.912416399f, 0.991998076f},
-std::array<float,2>{0.00470088329f, 0.130495533f},
-std::array<float,2>{0.657130301f, 0.260169744f},
-std::array<float,2>{0.378725529f, 0.637118757f},
-std::array<float,2>{0.954336405f, 0.605588257f},
-std::array<float,2>{0.0738069564f, 0.467881739f},
-std::array<float,2>{0.730332494f, 0.0351726748f},
-std::array<float,2>{0.476773351f, 0.772227824f},
-std::array<float,2>{0.590840161f, 0.881622016f},
-std::array<float,2>{0.266654819f, 0.210645184f},
-std::array<float,2>{0.766569197f, 0.340411425f},
-std::array<float,2>{0.235614657f, 0.722224712f},
-std::array<float,2>{0.651332259f, 0.664539337f},
-std::array<float,2>{0.414541721f, 0.293734342f},
-std::array<float,2>{0.897413909f, 0.185094938f},
-std::array<float,2>{0.0406155102f, 0.967686772f},
-std::array<float,2>{0.81257689f, 0.86833477f},
-std::array<float,2>{0.162424952f, 0.119453713f},
-std::array<float,2>{0.522777677f, 0.403032094f},
-std::array<float,2>{0.33615008f, 0.551959991f},
-std::array<float,2>{0.845108807f, 0.538462818f},
-std::array<float,2>{0.147733957f, 0.385294855f},
-std::array<float,2>{0.532421112f, 0.100169547f},
-std::array<float,2>{0.358780593f, 0.848782659f},
-std::array<float,2>{0.67840147f, 0.939363003f},
-std::array<float,2>{0.396987528f, 0.162652969f},
-std::array<float,2>{0.923555434f, 0.303395122f},
-std::array<float,2>{0.0311242044f, 0.676135063f},
-std::array<float,2>{0.602808297f, 0.739265084f},
-std::array<float,2>{0.303415954f, 0.327234268f},
-std::array<float,2>{0.804643273f, 0.202270105f},
-std::array<float,2>{0.191632032f, 0.894451857f},
-std::array<float,2>{0.988302231f, 0.761494815f},
-std::array<float,2>{0.120056175f, 0.0600458235f},
-std::array<float,2>{0.714750886f, 0.446826696f},
-std::array<float,2>{0.4635261f, 0.609398544f},
-std::array<float,2>{0.883531272f, 0.655484498f},
-std::array<float,2>{0.0533347763f, 0.267763317f},
-std::array<float,2>{0.625036061f, 0.151512668f},
-std::array<float,2>{0.435863644f, 0.975305557f},
-std::array<float,2>{0.507310271f, 0.816568732f},
-std::array<float,2>{0.317365408f, 0.0735936984f},
-std::array<float,2>{0.832722664f, 0.412510037f},
-std::array<float,2>{0.184257895f, 0.508772492f},
-std::array<float,2>{0.736537814f, 0.587999701f},
-std::array<float,2>{0.486663729f, 0.474299073f},
-std::array<float,2>{0.944978774f, 0.0217695776f},
-std::array<float,2>{0.0842559412f, 0.789423287f},
-std::array<float,2>{0.760144055f, 0.918276846f},
-std::array<float,2>{0.228312239f, 0.223389044f},
-std::array<float,2>{0.57379061f, 0.356048465f},
-std::array<float,2>{0.250845909f, 0.711470008f},
-std::array<float,2>{0.843416989f, 0.682143092f},
-std::array<float,2>{0.17817843f, 0.312092304f},
-std::array<float,2>{0.511639237f, 0.171859711f},
-std::array<float,2>{0.321765363f, 0.946725011f},
-std::array<float,2>{0.633837402f, 0.857009113f},
-std::array<float,2>{0.425438762f, 0.106926166f},
-std::array<float,2>{0.881407082f, 0.377326339f},
-std::array<float,2>{0.0606257804f, 0.541354835f},
-std::array<float,2>{0.568680704f, 0.621033192f},
-std::array<float,2>{0.258698434f, 0.444721967f},
-std::array<float,2>{0.755969405f, 0.0496116877f},
-std::array<float,2>{0.225304514f, 0.750889719f},
-std::array<float,2>{0.94618839f, 0.900480926f},
-std::array<float,2>{0.0934650898f, 0.192612708f},
-std::array<float,2>{0.7450459f, 0.32000953f},
-std::array<float,2>{0.498354077f, 0.745454311f},
-std::array<float,2>{0.930557728f, 0.500240564f},
-std::array<float,2>{0.0198055394f, 0.41748172f},
-std::array<float,2>{0.686649203f, 0.0672275349f},
-std::array<float,2>{0.403309256f, 0.824803293f},
-std::array<float,2>{0.543457508f, 0.981319606f},
-std::array<float,2>{0.346833646f, 0.140993476f},
-std::array<float,2>{0.85247612f, 0.274981737f},
-std::array<float,2>{0.154412627f, 0.643964827f},
-std::array<float,2>{0.70860976f, 0.708599806f},
-std::array<float,2>{0.454998374f, 0.344554812f},
-std::array<float,2>{0.998735845f, 0.22886157f},
-std::array<float,2>{0.116593935f, 0.908305764f},
-std::array<float,2>{0.807613134f, 0.787854135f},
-std::array<float,2>{0.197307855f, 0.0242393464f},
-std::array<float,2>{0.59453392f, 0.479584008f},
-std::array<float,2>{0.305450618f, 0.579982519f},
-std::array<float,2>{0.773464024f, 0.566436172f},
-std::array<float,2>{0.242390931f, 0.492430419f},
-std::array<float,2>{0.579737842f, 0.00308493385f},
-std::array<float,2>{0.27694273f, 0.805687785f},
-std::array<float,2>{0.725475311f, 0.92947197f},
-std::array<float,2>{0.472401679f, 0.249095231f},
-std::array<float,2>{0.966592848f, 0.372351497f},
-std::array<float,2>{0.0702450275f, 0.697038889f},
-std::array<float,2>{0.523674905f, 0.627309799f},
-std::array<float,2>{0.331903279f, 0.254055232f},
-std::array<float,2>{0.821636498f, 0.137886703f},
-std::array<float,2>{0.164750963f, 0.998867214f},
-std::array<float,2>{0.905682802f, 0.840015113f},
-std::array<float,2>{0.0335583501f, 0.0859949961f},
-std::array<float,2>{0.647653341f, 0.429961443f},
-std::array<float,2>{0.413649648f, 0.527885854f},
-std::array<float,2>{0.978413582f, 0.730371594f},
-std::array<float,2>{0.107310407f, 0.329822361f},
-std::array<float,2>{0.700690269f, 0.211795241f},
-std::array<float,2>{0.444801211f, 0.884603679f},
-std::array<float,2>{0.624535799f, 0.776763916f},
-std::array<float,2>{0.291115284f, 0.0410298742f},
-std::array<float,2>{0.787658155f, 0.460284203f},
-std::array<float,2>{0.213305816f, 0.601228833f},
-std::array<float,2>{0.671797514f, 0.560812235f},
-std::array<float,2>{0.389895767f, 0.391194344f},
-std::array<float,2>{0.915421784f, 0.109726593f},
-std::array<float,2>{0.0112916427f, 0.864836454f},
-std::array<float,2>{0.864992559f, 0.957319558f},
-std::array<float,2>{0.137572676f, 0.172343358f},
-std::array<float,2>{0.562278211f, 0.285395324f},
-std::array<float,2>{0.361653268f, 0.659232557f},
-std::array<float,2>{0.869227588f, 0.749089956f},
-std::array<float,2>{0.129465863f, 0.314381272f},
-std::array<float,2>{0.554527342f, 0.189572647f},
-std::array<float,2>{0.374113292f, 0.90455693f},
-std::array<float,2>{0.663489878f, 0.756497562f},
-std::array<float,2>{0.379779249f, 0.0544831418f},
-std::array<float,2>{0.907617569f, 0.438836664f},
-std::array<float,2>{0.00038509717f, 0.622916043f},
-std::array<float,2>{0.614668727f, 0.54324621f},
-std::array<float,2>{0.286646366f, 0.379894763f},
-std::array<float,2>{0.796509624f, 0.104769774f},
-std::array<float,2>{0.207598001f, 0.852854908f},
-std::array<float,2>{0.970098674f, 0.949568152f},
-std::array<float,2>{0.0953619033f, 0.16740796f},
-std::array<float,2>{0.692189276f, 0.307710648f},
-std::array<float,2>{0.45298925f, 0.686525404f},
-std::array<float,2>{0.8919397f, 0.583436549f},
-std::array<float,2>{0.0451637171f, 0.482185811f},
-std::array<float,2>{0.654952228f, 0.0283275712f},
-std::array<float,2>{0.419143736f, 0.782610953f},
-std::array<float,2>{0.51943785f, 0.91106683f},
-std::array<float,2>{0.339900345f, 0.232666761f},
-std::array<float,2>{0.816433549f, 0.348020613f},
-std::array<float,2>{0.159617364f, 0.703785002f},
-std::array<float,2>{0.731285632f, 0.647857666f},
-std::array<float,2>{0.484294295f, 0.280532658f},
-std::array<float,2>{0.957436383f, 0.147910386f},
-std::array<float,2>{0.0744174719f, 0.979515553f},
-std::array<float,2>{0.771285176f, 0.821974099f},
-std::array<float,2>{0.239107177f, 0.0663451254f},
-std::array<float,2>{0.589284122f, 0.417982757f},
-std::array<float,2>{0.272773683f, 0.507659316f},
-std::array<float,2>{0.800543666f, 0.525799215f},
-std::array<float,2>{0.190264776f, 0.437380016f},
-std::array<float,2>{0.606222808f, 0.0935240388f},
-std::array<float,2>{0.299956739f, 0.836276591f},
-std::array<float,2>{0.715488374f, 0.994769812f},
-std::array<float,2>{0.465179235f, 0.135372952f},
-std::array<float,2>{0.985170424f, 0.253742546f},
-std::array<float,2>{0.124480039f, 0.629794538f},
-std::array<float,2>{0.53617245f, 0.700198054f},
-std::array<float,2>{0.35456109f, 0.371079952f},
-std::array<float,2>{0.85144943f, 0.245352522f},
-std::array<float,2>{0.140757948f, 0.922011197f},
-std::array<float,2>{0.929049492f, 0.809962988f},
-std::array<float,2>{0.0237991959f, 0.00728977798f},
-std::array<float,2>{0.673322856f, 0.499879867f},
-std::array<float,2>{0.391553134f, 0.563297093f},
-std::array<float,2>{0.93916595f, 0.662246168f},
-std::array<float,2>{0.0807726085f, 0.283600569f},
-std::array<float,2>{0.741471469f, 0.177950174f},
-std::array<float,2>{0.491327405f, 0.953370452f},
-std::array<float,2>{0.574648798f, 0.86318928f},
-std::array<float,2>{0.256673962f, 0.113368727f},
-std::array<float,2>{0.761941254f, 0.396804124f},
-std::array<float,2>{0.233341366f, 0.556292355f},
-std::array<float,2>{0.630471885f, 0.594852984f},
-std::array<float,2>{0.432974905f, 0.454689711f},
-std::array<float,2>{0.88712436f, 0.0455019325f},
-std::array<float,2>{0.0482120104f, 0.777443767f},
-std::array<float,2>{0.829677284f, 0.890494108f},
-std::array<float,2>{0.18337971f, 0.216207683f},
-std::array<float,2>{0.502770245f, 0.334440738f},
-std::array<float,2>{0.314232439f, 0.733798981f},
-std::array<float,2>{0.752114296f, 0.635080218f},
-std::array<float,2>{0.219052345f, 0.264811158f},
-std::array<float,2>{0.562639177f, 0.128743887f},
-std::array<float,2>{0.262353182f, 0.984592199f},
-std::array<float,2>{0.746643126f, 0.835559845f},
-std::array<float,2>{0.495836377f, 0.0782893822f},
-std::array<float,2>{0.95267719f, 0.428597242f},
-std::array<float,2>{0.0881425142f, 0.518659592f},
-std::array<float,2>{0.51266855f, 0.571476698f},
-std::array<float,2>{0.325630218f, 0.486780643f},
-std::array<float,2>{0.83872962f, 0.0125347413f},
-std::array<float,2>{0.17454496f, 0.797387958f},
-std::array<float,2>{0.876069069f, 0.931958437f},
-std::array<float,2>{0.0571391582f, 0.238523751f},
-std::array<float,2>{0.640370846f, 0.365119755f},
-std::array<float,2>{0.429243624f, 0.689044535f},
-std::array<float,2>{0.992652774f, 0.550087988f},
-std::array<float,2>{0.111305885f, 0.401555181f},
-std::array<float,2>{0.705089509f, 0.121907264f},
-std::array<float,2>{0.459872901f, 0.87441051f},
-std::array<float,2>{0.59889394f, 0.960950494f},
-std::array<float,2>{0.310388386f, 0.181066155f},
-std::array<float,2>{0.810919285f, 0.289625436f},
-std::array<float,2>{0.201285541f, 0.670682192f},
-std::array<float,2>{0.679936647f, 0.725755751f},
-std::array<float,2>{0.398934305f, 0.336850554f},
-std::array<float,2>{0.937104285f, 0.206209272f},
-std::array<float,2>{0.0193261895f, 0.878072441f},
-std::array<float,2>{0.858035326f, 0.768151164f},
-std::array<float,2>{0.152207941f, 0.0319884047f},
-std::array<float,2>{0.542634249f, 0.463238984f},
-std::array<float,2>{0.350572437f, 0.604640126f},
-std::array<float,2>{0.826054633f, 0.614640057f},
-std::array<float,2>{0.171157151f, 0.452826709f},
-std::array<float,2>{0.527997494f, 0.0562108792f},
-std::array<float,2>{0.334463567f, 0.765168846f},
-std::array<float,2>{0.640728772f, 0.895991266f},
-std::array<float,2>{0.407008886f, 0.19727543f},
-std::array<float,2>{0.899793208f, 0.320326626f},
-std::array<float,2>{0.0358346477f, 0.738137305f},
-std::array<float,2>{0.584353864f, 0.67425245f},
-std::array<float,2>{0.280669898f, 0.299626946f},
-std::array<float,2>{0.778597414f, 0.157599062f},
-std::array<float,2>{0.249388039f, 0.94431746f},
-std::array<float,2>{0.964731276f, 0.846981287f},
-std::array<float,2>{0.0632396266f, 0.0951760709f},
-std::array<float,2>{0.718919754f, 0.38995862f},
-std::array<float,2>{0.473409265f, 0.534800828f},
-std::array<float,2>{0.921785295f, 0.718040109f},
-std::array<float,2>{0.0121604558f, 0.35229364f},
-std::array<float,2>{0.664160967f, 0.221725404f},
-std::array<float,2>{0.383182317f, 0.917442143f},
-std::array<float,2>{0.556543469f, 0.795903563f},
-std::array<float,2>{0.365453064f, 0.0183821768f},
-std::array<float,2>{0.860471845f, 0.469298244f},
-std::array<float,2>{0.133575037f, 0.591346025f},
-std::array<float,2>{0.699140489f, 0.513788581f},
-std::array<float,2>{0.439967066f, 0.410021484f},
-std::array<float,2>{0.98149693f, 0.0757078305f},
-std::array<float,2>{0.101929449f, 0.815619826f},
-std::array<float,2>{0.783393145f, 0.969427764f},
-std::array<float,2>{0.216915905f, 0.152816325f},
-std::array<float,2>{0.619960308f, 0.270766258f},
-std::array<float,2>{0.29409343f, 0.648662269f}}
\ No newline at end of file
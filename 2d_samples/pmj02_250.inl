@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.0213911384f, 0.290004998f},
-std::array<float,2>{0.818207502f, 0.820705354f},
-std::array<float,2>{0.306131333f, 0.718740165f},
-std::array<float,2>{0.738200247f, 0.0468005762f},
-std::array<float,2>{0.376794755f, 0.186914623f},
-std::array<float,2>{0.571874261f, 0.513674319f},
-std::array<float,2>{0.127352402f, 0.965387762f},
-std::array<float,2>{0.893464029f, 0.400000542f},
-std::array<float,2>{0.36841023f, 0.486671567f},
-std::array<float,2>{0.653238177f, 0.927677333f},
-std::array<float,2>{0.113821931f, 0.609327316f},
-std::array<float,2>{0.761979401f, 0.208429471f},
-std::array<float,2>{0.191170335f, 0.0637487546f},
-std::array<float,2>{0.964257896f, 0.654621422f},
-std::array<float,2>{0.484216094f, 0.768490613f},
-std::array<float,2>{0.510375738f, 0.330659181f},
-std::array<float,2>{0.178701103f, 0.430461377f},
-std::array<float,2>{0.912988186f, 0.978574812f},
-std::array<float,2>{0.407758564f, 0.545645952f},
-std::array<float,2>{0.596258759f, 0.153451875f},
-std::array<float,2>{0.273928702f, 0.0164267998f},
-std::array<float,2>{0.691012979f, 0.742387533f},
-std::array<float,2>{0.0539438128f, 0.857016325f},
-std::array<float,2>{0.870783865f, 0.257404327f},
-std::array<float,2>{0.438991636f, 0.373833328f},
-std::array<float,2>{0.551178277f, 0.793143809f},
-std::array<float,2>{0.230736896f, 0.668306231f},
-std::array<float,2>{0.98829037f, 0.10427735f},
-std::array<float,2>{0.0746307224f, 0.234672666f},
-std::array<float,2>{0.793757558f, 0.587582409f},
-std::array<float,2>{0.333117694f, 0.87711376f},
-std::array<float,2>{0.670211077f, 0.445552468f},
-std::array<float,2>{0.0972140431f, 0.463257104f},
-std::array<float,2>{0.779210985f, 0.897339404f},
-std::array<float,2>{0.352012992f, 0.570259154f},
-std::array<float,2>{0.633197427f, 0.227685958f},
-std::array<float,2>{0.499465913f, 0.122331344f},
-std::array<float,2>{0.530304134f, 0.674578428f},
-std::array<float,2>{0.211087346f, 0.810316861f},
-std::array<float,2>{0.949659526f, 0.349673897f},
-std::array<float,2>{0.295919895f, 0.274445683f},
-std::array<float,2>{0.730104208f, 0.866327524f},
-std::array<float,2>{0.00309750554f, 0.722303092f},
-std::array<float,2>{0.835363805f, 0.00970145687f},
-std::array<float,2>{0.14262183f, 0.127447218f},
-std::array<float,2>{0.888438642f, 0.557168126f},
-std::array<float,2>{0.404371917f, 0.99713707f},
-std::array<float,2>{0.59213239f, 0.420218199f},
-std::array<float,2>{0.244719833f, 0.320741892f},
-std::array<float,2>{0.969613016f, 0.763374984f},
-std::array<float,2>{0.453278571f, 0.62593931f},
-std::array<float,2>{0.540973008f, 0.0915381014f},
-std::array<float,2>{0.325821579f, 0.201022506f},
-std::array<float,2>{0.677020133f, 0.620900035f},
-std::array<float,2>{0.0806379691f, 0.909835041f},
-std::array<float,2>{0.806593359f, 0.476090997f},
-std::array<float,2>{0.42622894f, 0.383788705f},
-std::array<float,2>{0.609520733f, 0.942450523f},
-std::array<float,2>{0.161849022f, 0.520202994f},
-std::array<float,2>{0.924829364f, 0.157620966f},
-std::array<float,2>{0.0426174626f, 0.061450731f},
-std::array<float,2>{0.848221481f, 0.696988404f},
-std::array<float,2>{0.254514784f, 0.835922062f},
-std::array<float,2>{0.706238627f, 0.312426507f},
-std::array<float,2>{0.0919406787f, 0.354136795f},
-std::array<float,2>{0.797171474f, 0.798261583f},
-std::array<float,2>{0.317383379f, 0.684527755f},
-std::array<float,2>{0.681808889f, 0.109791137f},
-std::array<float,2>{0.465178818f, 0.222624689f},
-std::array<float,2>{0.535986423f, 0.576101243f},
-std::array<float,2>{0.235148013f, 0.899186552f},
-std::array<float,2>{0.984359443f, 0.455237538f},
-std::array<float,2>{0.259620547f, 0.410393089f},
-std::array<float,2>{0.7145226f, 0.992036819f},
-std::array<float,2>{0.0336934105f, 0.547430098f},
-std::array<float,2>{0.854816556f, 0.135045901f},
-std::array<float,2>{0.171611354f, 0.00514594186f},
-std::array<float,2>{0.935516179f, 0.726595938f},
-std::array<float,2>{0.435910761f, 0.86750865f},
-std::array<float,2>{0.624081969f, 0.268016577f},
-std::array<float,2>{0.210824013f, 0.476580232f},
-std::array<float,2>{0.938480377f, 0.91744566f},
-std::array<float,2>{0.48732084f, 0.610226512f},
-std::array<float,2>{0.520571709f, 0.189974293f},
-std::array<float,2>{0.343993396f, 0.083901301f},
-std::array<float,2>{0.629539907f, 0.638107657f},
-std::array<float,2>{0.105946325f, 0.75605458f},
-std::array<float,2>{0.765919805f, 0.316806972f},
-std::array<float,2>{0.394942671f, 0.300964624f},
-std::array<float,2>{0.582752943f, 0.840944529f},
-std::array<float,2>{0.155231521f, 0.69128859f},
-std::array<float,2>{0.879309833f, 0.0517900325f},
-std::array<float,2>{0.0119891446f, 0.166051283f},
-std::array<float,2>{0.837049007f, 0.529244125f},
-std::array<float,2>{0.286305457f, 0.946149588f},
-std::array<float,2>{0.726357818f, 0.376222879f},
-std::array<float,2>{0.0568764247f, 0.39749676f},
-std::array<float,2>{0.859900594f, 0.960312188f},
-std::array<float,2>{0.270970613f, 0.505032003f},
-std::array<float,2>{0.702705681f, 0.177418545f},
-std::array<float,2>{0.419257194f, 0.0368845575f},
-std::array<float,2>{0.601736426f, 0.707102895f},
-std::array<float,2>{0.186815172f, 0.81347543f},
-std::array<float,2>{0.917194486f, 0.281306118f},
-std::array<float,2>{0.339512318f, 0.33606714f},
-std::array<float,2>{0.661763549f, 0.7811957f},
-std::array<float,2>{0.0635692701f, 0.64418304f},
-std::array<float,2>{0.785258234f, 0.0715114698f},
-std::array<float,2>{0.220743135f, 0.213904381f},
-std::array<float,2>{0.999180555f, 0.595646679f},
-std::array<float,2>{0.445625871f, 0.936334908f},
-std::array<float,2>{0.559374094f, 0.492676347f},
-std::array<float,2>{0.135499015f, 0.262056381f},
-std::array<float,2>{0.899344504f, 0.847510219f},
-std::array<float,2>{0.389229655f, 0.736090243f},
-std::array<float,2>{0.570183218f, 0.0311725959f},
-std::array<float,2>{0.29823029f, 0.14384827f},
-std::array<float,2>{0.749871731f, 0.536839724f},
-std::array<float,2>{0.0299814548f, 0.972117305f},
-std::array<float,2>{0.827572525f, 0.422059208f},
-std::array<float,2>{0.468870223f, 0.437783599f},
-std::array<float,2>{0.500769019f, 0.88969624f},
-std::array<float,2>{0.196683466f, 0.585039437f},
-std::array<float,2>{0.956612051f, 0.244978011f},
-std::array<float,2>{0.117955036f, 0.0980462581f},
-std::array<float,2>{0.752859414f, 0.66106987f},
-std::array<float,2>{0.365141064f, 0.785120189f},
-std::array<float,2>{0.640676677f, 0.362454593f},
-std::array<float,2>{0.112838298f, 0.272649795f},
-std::array<float,2>{0.760344744f, 0.871615946f},
-std::array<float,2>{0.37231648f, 0.73361969f},
-std::array<float,2>{0.650624096f, 0.00355233601f},
-std::array<float,2>{0.476837903f, 0.13891761f},
-std::array<float,2>{0.513442397f, 0.552192211f},
-std::array<float,2>{0.191874251f, 0.984376311f},
-std::array<float,2>{0.967461348f, 0.407579392f},
-std::array<float,2>{0.311192453f, 0.460305363f},
-std::array<float,2>{0.741938651f, 0.902418017f},
-std::array<float,2>{0.0173896551f, 0.573706448f},
-std::array<float,2>{0.814197779f, 0.223833293f},
-std::array<float,2>{0.132153824f, 0.117012173f},
-std::array<float,2>{0.896751642f, 0.682272136f},
-std::array<float,2>{0.379935801f, 0.801331162f},
-std::array<float,2>{0.574740946f, 0.359111726f},
-std::array<float,2>{0.230390742f, 0.381079525f},
-std::array<float,2>{0.986817777f, 0.952030003f},
-std::array<float,2>{0.444509119f, 0.524624169f},
-std::array<float,2>{0.548500299f, 0.171147242f},
-std::array<float,2>{0.329780281f, 0.0502764955f},
-std::array<float,2>{0.66694957f, 0.695002735f},
-std::array<float,2>{0.0730872005f, 0.837296367f},
-std::array<float,2>{0.791972458f, 0.298990488f},
-std::array<float,2>{0.411616683f, 0.313376158f},
-std::array<float,2>{0.599050462f, 0.752347767f},
-std::array<float,2>{0.17332013f, 0.633098781f},
-std::array<float,2>{0.906748652f, 0.0797528923f},
-std::array<float,2>{0.0486315861f, 0.192320496f},
-std::array<float,2>{0.873447776f, 0.614223003f},
-std::array<float,2>{0.277361095f, 0.919971764f},
-std::array<float,2>{0.694245934f, 0.48233825f},
-std::array<float,2>{0.00505419634f, 0.498767644f},
-std::array<float,2>{0.831196964f, 0.930998802f},
-std::array<float,2>{0.291909069f, 0.598906457f},
-std::array<float,2>{0.734039545f, 0.216321275f},
-std::array<float,2>{0.399208069f, 0.0752627179f},
-std::array<float,2>{0.589812934f, 0.644983232f},
-std::array<float,2>{0.144751698f, 0.775950134f},
-std::array<float,2>{0.884959698f, 0.341163874f},
-std::array<float,2>{0.356006294f, 0.286940187f},
-std::array<float,2>{0.637511611f, 0.817360103f},
-std::array<float,2>{0.10112381f, 0.703403234f},
-std::array<float,2>{0.774965107f, 0.0321489461f},
-std::array<float,2>{0.218531787f, 0.174972966f},
-std::array<float,2>{0.947455347f, 0.501184106f},
-std::array<float,2>{0.492822319f, 0.955679655f},
-std::array<float,2>{0.525281429f, 0.391339868f},
-std::array<float,2>{0.157016039f, 0.367037266f},
-std::array<float,2>{0.925818086f, 0.786059856f},
-std::array<float,2>{0.424323469f, 0.658263385f},
-std::array<float,2>{0.616075933f, 0.0964045748f},
-std::array<float,2>{0.251696944f, 0.247921437f},
-std::array<float,2>{0.708495498f, 0.581911147f},
-std::array<float,2>{0.0460914187f, 0.885622084f},
-std::array<float,2>{0.844933093f, 0.442476928f},
-std::array<float,2>{0.459882379f, 0.427646786f},
-std::array<float,2>{0.54328078f, 0.97425276f},
-std::array<float,2>{0.249738604f, 0.532242596f},
-std::array<float,2>{0.973698914f, 0.146045223f},
-std::array<float,2>{0.0830962583f, 0.0262539927f},
-std::array<float,2>{0.810297608f, 0.740593672f},
-std::array<float,2>{0.321371198f, 0.849740624f},
-std::array<float,2>{0.675303042f, 0.261323512f},
-std::array<float,2>{0.0389563888f, 0.335389376f},
-std::array<float,2>{0.858877659f, 0.773182929f},
-std::array<float,2>{0.264060944f, 0.652082801f},
-std::array<float,2>{0.716092408f, 0.0674927458f},
-std::array<float,2>{0.432620913f, 0.204261273f},
-std::array<float,2>{0.618370831f, 0.604029775f},
-std::array<float,2>{0.167068884f, 0.922103941f},
-std::array<float,2>{0.931349516f, 0.491160631f},
-std::array<float,2>{0.314886034f, 0.404252559f},
-std::array<float,2>{0.684270084f, 0.962913632f},
-std::array<float,2>{0.0869267657f, 0.511591733f},
-std::array<float,2>{0.804208279f, 0.181404531f},
-std::array<float,2>{0.241445988f, 0.039896071f},
-std::array<float,2>{0.980178535f, 0.712089181f},
-std::array<float,2>{0.463627189f, 0.825744808f},
-std::array<float,2>{0.534732044f, 0.293829322f},
-std::array<float,2>{0.150010064f, 0.449481905f},
-std::array<float,2>{0.877937675f, 0.881504238f},
-std::array<float,2>{0.390833229f, 0.592064798f},
-std::array<float,2>{0.580822587f, 0.24155052f},
-std::array<float,2>{0.283367962f, 0.108801074f},
-std::array<float,2>{0.720387757f, 0.666303098f},
-std::array<float,2>{0.0109840091f, 0.791998327f},
-std::array<float,2>{0.841700077f, 0.368358433f},
-std::array<float,2>{0.489563286f, 0.250680149f},
-std::array<float,2>{0.516776979f, 0.853823781f},
-std::array<float,2>{0.203979403f, 0.748502195f},
-std::array<float,2>{0.944770515f, 0.0213445649f},
-std::array<float,2>{0.101601236f, 0.150490329f},
-std::array<float,2>{0.770100772f, 0.539389133f},
-std::array<float,2>{0.348343968f, 0.983879805f},
-std::array<float,2>{0.627420843f, 0.43629393f},
-std::array<float,2>{0.0670872778f, 0.415660352f},
-std::array<float,2>{0.781665742f, 0.992290378f},
-std::array<float,2>{0.340035439f, 0.559559703f},
-std::array<float,2>{0.659337938f, 0.130398259f},
-std::array<float,2>{0.450462431f, 0.0152859921f},
-std::array<float,2>{0.557502091f, 0.723980844f},
-std::array<float,2>{0.223761097f, 0.861693799f},
-std::array<float,2>{0.993934572f, 0.278413147f},
-std::array<float,2>{0.267535627f, 0.346591234f},
-std::array<float,2>{0.698506474f, 0.807222307f},
-std::array<float,2>{0.0594723187f, 0.677362084f},
-std::array<float,2>{0.864036739f, 0.11934755f},
-std::array<float,2>{0.181171849f, 0.232917324f},
-std::array<float,2>{0.918308854f, 0.565831602f},
-std::array<float,2>{0.417779565f, 0.892992318f},
-std::array<float,2>{0.608388901f, 0.467345059f},
-std::array<float,2>{0.20215413f, 0.307978421f},
-std::array<float,2>{0.958236694f, 0.831789136f},
-std::array<float,2>{0.475346565f, 0.69943893f},
-std::array<float,2>{0.506733119f, 0.0559273325f},
-std::array<float,2>{0.361548871f, 0.163906485f},
-std::array<float,2>{0.647552907f, 0.519079149f},
-std::array<float,2>{0.123949215f, 0.939794183f},
-std::array<float,2>{0.756002843f, 0.388074696f},
-std::array<float,2>{0.385750294f, 0.472136736f},
-std::array<float,2>{0.563815296f, 0.91074127f},
-std::array<float,2>{0.139274955f, 0.621555269f},
-std::array<float,2>{0.905782402f, 0.198914319f},
-std::array<float,2>{0.0248165894f, 0.0868974775f},
-std::array<float,2>{0.82090193f, 0.630854309f},
-std::array<float,2>{0.302712411f, 0.760146141f},
-std::array<float,2>{0.74242878f, 0.32738474f},
-std::array<float,2>{0.0516697727f, 0.255271614f},
-std::array<float,2>{0.86901474f, 0.857634902f},
-std::array<float,2>{0.275674522f, 0.745975852f},
-std::array<float,2>{0.688540876f, 0.0190023109f},
-std::array<float,2>{0.40995568f, 0.154728428f},
-std::array<float,2>{0.595674694f, 0.544763148f},
-std::array<float,2>{0.176148489f, 0.977171659f},
-std::array<float,2>{0.910333157f, 0.433163613f},
-std::array<float,2>{0.33520481f, 0.448442608f},
-std::array<float,2>{0.667983651f, 0.875627458f},
-std::array<float,2>{0.0778336897f, 0.588002741f},
-std::array<float,2>{0.795769215f, 0.237207323f},
-std::array<float,2>{0.233255193f, 0.102325298f},
-std::array<float,2>{0.990700006f, 0.670331895f},
-std::array<float,2>{0.440821975f, 0.796000123f},
-std::array<float,2>{0.552886248f, 0.372366875f},
-std::array<float,2>{0.125892878f, 0.401223183f},
-std::array<float,2>{0.891447306f, 0.967919052f},
-std::array<float,2>{0.377283573f, 0.511884451f},
-std::array<float,2>{0.572591484f, 0.18552947f},
-std::array<float,2>{0.308517337f, 0.0444407724f},
-std::array<float,2>{0.735417068f, 0.715007603f},
-std::array<float,2>{0.0223581046f, 0.82404381f},
-std::array<float,2>{0.819857657f, 0.291347802f},
-std::array<float,2>{0.480861127f, 0.328911632f},
-std::array<float,2>{0.50884968f, 0.766863525f},
-std::array<float,2>{0.18897967f, 0.653538108f},
-std::array<float,2>{0.961017311f, 0.0657241493f},
-std::array<float,2>{0.116349109f, 0.210114986f},
-std::array<float,2>{0.764501572f, 0.606635094f},
-std::array<float,2>{0.370312482f, 0.929594934f},
-std::array<float,2>{0.655286133f, 0.485758692f},
-std::array<float,2>{0.0799139813f, 0.473775327f},
-std::array<float,2>{0.806906521f, 0.907144308f},
-std::array<float,2>{0.327414989f, 0.618377626f},
-std::array<float,2>{0.678355157f, 0.202621147f},
-std::array<float,2>{0.456713051f, 0.0918970183f},
-std::array<float,2>{0.541944802f, 0.628136337f},
-std::array<float,2>{0.242835239f, 0.764716208f},
-std::array<float,2>{0.972177029f, 0.322334141f},
-std::array<float,2>{0.25691393f, 0.310137272f},
-std::array<float,2>{0.70504868f, 0.832913816f},
-std::array<float,2>{0.0401842296f, 0.697508454f},
-std::array<float,2>{0.851290405f, 0.0593336262f},
-std::array<float,2>{0.163863346f, 0.159337953f},
-std::array<float,2>{0.921956778f, 0.521826386f},
-std::array<float,2>{0.429494977f, 0.944429934f},
-std::array<float,2>{0.612342715f, 0.385400981f},
-std::array<float,2>{0.213963926f, 0.349239618f},
-std::array<float,2>{0.95271337f, 0.811154664f},
-std::array<float,2>{0.497271627f, 0.673215032f},
-std::array<float,2>{0.527392566f, 0.123960815f},
-std::array<float,2>{0.354985088f, 0.229647473f},
-std::array<float,2>{0.636375964f, 0.568328798f},
-std::array<float,2>{0.095669657f, 0.896378815f},
-std::array<float,2>{0.779320776f, 0.461292624f},
-std::array<float,2>{0.403355926f, 0.419462442f},
-std::array<float,2>{0.590605974f, 0.999661326f},
-std::array<float,2>{0.141341716f, 0.556138933f},
-std::array<float,2>{0.889161229f, 0.126436487f},
-std::array<float,2>{0.00136297243f, 0.0116965873f},
-std::array<float,2>{0.832702875f, 0.720455468f},
-std::array<float,2>{0.294773817f, 0.86379528f},
-std::array<float,2>{0.727889776f, 0.276917249f},
-std::array<float,2>{0.10833367f, 0.320143461f},
-std::array<float,2>{0.768362939f, 0.754128098f},
-std::array<float,2>{0.34673506f, 0.640457809f},
-std::array<float,2>{0.630960584f, 0.0854368508f},
-std::array<float,2>{0.484864146f, 0.189257801f},
-std::array<float,2>{0.522667348f, 0.611791909f},
-std::array<float,2>{0.208520278f, 0.914400637f},
-std::array<float,2>{0.941402316f, 0.479612976f},
-std::array<float,2>{0.287364155f, 0.377889574f},
-std::array<float,2>{0.723688245f, 0.948564589f},
-std::array<float,2>{0.0155100822f, 0.530752182f},
-std::array<float,2>{0.838329375f, 0.165223911f},
-std::array<float,2>{0.152912438f, 0.0540851355f},
-std::array<float,2>{0.88276273f, 0.687765419f},
-std::array<float,2>{0.397771478f, 0.842407465f},
-std::array<float,2>{0.584151447f, 0.304375142f},
-std::array<float,2>{0.238040909f, 0.454495698f},
-std::array<float,2>{0.982395887f, 0.901647687f},
-std::array<float,2>{0.468035579f, 0.576278269f},
-std::array<float,2>{0.538050413f, 0.220620245f},
-std::array<float,2>{0.318829268f, 0.112831444f},
-std::array<float,2>{0.680923402f, 0.685883939f},
-std::array<float,2>{0.0906704143f, 0.800172925f},
-std::array<float,2>{0.800217092f, 0.352314293f},
-std::array<float,2>{0.434339494f, 0.267524272f},
-std::array<float,2>{0.622029722f, 0.869933307f},
-std::array<float,2>{0.168021947f, 0.729781508f},
-std::array<float,2>{0.936207056f, 0.00698530115f},
-std::array<float,2>{0.0319440439f, 0.1344309f},
-std::array<float,2>{0.852058768f, 0.548892379f},
-std::array<float,2>{0.261059672f, 0.98908031f},
-std::array<float,2>{0.712204576f, 0.412522256f},
-std::array<float,2>{0.0279387496f, 0.425185472f},
-std::array<float,2>{0.825776815f, 0.968765497f},
-std::array<float,2>{0.300200313f, 0.53728056f},
-std::array<float,2>{0.747599065f, 0.141436413f},
-std::array<float,2>{0.38843134f, 0.0290570892f},
-std::array<float,2>{0.567282736f, 0.736578405f},
-std::array<float,2>{0.134437084f, 0.844378889f},
-std::array<float,2>{0.902161241f, 0.265558422f},
-std::array<float,2>{0.365334481f, 0.360622555f},
-std::array<float,2>{0.642950058f, 0.782375336f},
-std::array<float,2>{0.120374992f, 0.662475824f},
-std::array<float,2>{0.75154984f, 0.100614637f},
-std::array<float,2>{0.19745329f, 0.243324935f},
-std::array<float,2>{0.953884423f, 0.583011687f},
-std::array<float,2>{0.471950352f, 0.887963533f},
-std::array<float,2>{0.503019273f, 0.441065311f},
-std::array<float,2>{0.183685049f, 0.284821302f},
-std::array<float,2>{0.914269745f, 0.815915585f},
-std::array<float,2>{0.420387894f, 0.7101686f},
-std::array<float,2>{0.60437268f, 0.0377356932f},
-std::array<float,2>{0.271976352f, 0.178386778f},
-std::array<float,2>{0.701016068f, 0.506073713f},
-std::array<float,2>{0.0551675074f, 0.957441568f},
-std::array<float,2>{0.861673236f, 0.396026403f},
-std::array<float,2>{0.44841224f, 0.494644225f},
-std::array<float,2>{0.562038124f, 0.933928132f},
-std::array<float,2>{0.218817458f, 0.596702397f},
-std::array<float,2>{0.997566521f, 0.211358145f},
-std::array<float,2>{0.0649177134f, 0.0736012682f},
-std::array<float,2>{0.788073003f, 0.641757905f},
-std::array<float,2>{0.336321384f, 0.778194427f},
-std::array<float,2>{0.663525522f, 0.338252604f},
-std::array<float,2>{0.0710378066f, 0.298804253f},
-std::array<float,2>{0.789601386f, 0.837971628f},
-std::array<float,2>{0.33067748f, 0.69165343f},
-std::array<float,2>{0.665718913f, 0.0470308885f},
-std::array<float,2>{0.441747606f, 0.169003367f},
-std::array<float,2>{0.550181627f, 0.52683264f},
-std::array<float,2>{0.227217421f, 0.950805545f},
-std::array<float,2>{0.986225963f, 0.379686743f},
-std::array<float,2>{0.280213535f, 0.483321577f},
-std::array<float,2>{0.691912591f, 0.919839501f},
-std::array<float,2>{0.0499880761f, 0.616690636f},
-std::array<float,2>{0.871278822f, 0.19481197f},
-std::array<float,2>{0.17482762f, 0.0805178955f},
-std::array<float,2>{0.908478677f, 0.635466695f},
-std::array<float,2>{0.412400544f, 0.751577258f},
-std::array<float,2>{0.600153089f, 0.31542632f},
-std::array<float,2>{0.193405673f, 0.409020931f},
-std::array<float,2>{0.966211438f, 0.988057554f},
-std::array<float,2>{0.479189694f, 0.554110587f},
-std::array<float,2>{0.514460504f, 0.137464195f},
-std::array<float,2>{0.373238176f, 0.000420068012f},
-std::array<float,2>{0.650129676f, 0.731640816f},
-std::array<float,2>{0.111048214f, 0.87446034f},
-std::array<float,2>{0.759349108f, 0.270841897f},
-std::array<float,2>{0.381280363f, 0.355982125f},
-std::array<float,2>{0.577629447f, 0.803818166f},
-std::array<float,2>{0.13076292f, 0.680483878f},
-std::array<float,2>{0.895954907f, 0.114402875f},
-std::array<float,2>{0.018090535f, 0.2252516f},
-std::array<float,2>{0.815052927f, 0.571654916f},
-std::array<float,2>{0.309687912f, 0.905379355f},
-std::array<float,2>{0.738321185f, 0.457075983f},
-std::array<float,2>{0.0439744368f, 0.444239974f},
-std::array<float,2>{0.846976459f, 0.884139001f},
-std::array<float,2>{0.25347662f, 0.579984486f},
-std::array<float,2>{0.709488928f, 0.249748856f},
-std::array<float,2>{0.423596293f, 0.0938911512f},
-std::array<float,2>{0.613491833f, 0.656837344f},
-std::array<float,2>{0.159830719f, 0.787882268f},
-std::array<float,2>{0.928713441f, 0.363943815f},
-std::array<float,2>{0.323170543f, 0.258766234f},
-std::array<float,2>{0.673640132f, 0.847944975f},
-std::array<float,2>{0.0854137689f, 0.739344001f},
-std::array<float,2>{0.812097132f, 0.0244530234f},
-std::array<float,2>{0.247459978f, 0.146649018f},
-std::array<float,2>{0.975157797f, 0.533726513f},
-std::array<float,2>{0.457716912f, 0.975034595f},
-std::array<float,2>{0.546819508f, 0.428370416f},
-std::array<float,2>{0.146702081f, 0.342270523f},
-std::array<float,2>{0.884202421f, 0.774519742f},
-std::array<float,2>{0.401189446f, 0.648195922f},
-std::array<float,2>{0.586519837f, 0.0774365515f},
-std::array<float,2>{0.28966248f, 0.217872933f},
-std::array<float,2>{0.732075214f, 0.599844038f},
-std::array<float,2>{0.00627613766f, 0.932562351f},
-std::array<float,2>{0.829860747f, 0.498035491f},
-std::array<float,2>{0.494533032f, 0.39450109f},
-std::array<float,2>{0.525627613f, 0.95315665f},
-std::array<float,2>{0.215296015f, 0.502077937f},
-std::array<float,2>{0.946519494f, 0.17238012f},
-std::array<float,2>{0.0991725475f, 0.0336874053f},
-std::array<float,2>{0.776186228f, 0.70617646f},
-std::array<float,2>{0.358712256f, 0.819153786f},
-std::array<float,2>{0.640468955f, 0.287329167f},
-std::array<float,2>{0.00879492331f, 0.36954841f},
-std::array<float,2>{0.842507422f, 0.790748477f},
-std::array<float,2>{0.281576693f, 0.665607154f},
-std::array<float,2>{0.722159982f, 0.107146129f},
-std::array<float,2>{0.393745929f, 0.238795459f},
-std::array<float,2>{0.57970053f, 0.590664923f},
-std::array<float,2>{0.152200848f, 0.880029857f},
-std::array<float,2>{0.875991106f, 0.451656461f},
-std::array<float,2>{0.350990206f, 0.43457371f},
-std::array<float,2>{0.626468539f, 0.981772304f},
-std::array<float,2>{0.10393209f, 0.542529106f},
-std::array<float,2>{0.772823513f, 0.149545223f},
-std::array<float,2>{0.205636442f, 0.0220540445f},
-std::array<float,2>{0.942493379f, 0.747951686f},
-std::array<float,2>{0.49025324f, 0.852463424f},
-std::array<float,2>{0.518321097f, 0.253746837f},
-std::array<float,2>{0.164063334f, 0.489044309f},
-std::array<float,2>{0.932386518f, 0.925121605f},
-std::array<float,2>{0.430028647f, 0.603140831f},
-std::array<float,2>{0.620355368f, 0.206120282f},
-std::array<float,2>{0.262895435f, 0.069595851f},
-std::array<float,2>{0.7179721f, 0.648898482f},
-std::array<float,2>{0.0357729942f, 0.770214915f},
-std::array<float,2>{0.855616927f, 0.333832651f},
-std::array<float,2>{0.461913019f, 0.296069294f},
-std::array<float,2>{0.532808542f, 0.828054428f},
-std::array<float,2>{0.238576695f, 0.714539886f},
-std::array<float,2>{0.978399217f, 0.0415841751f},
-std::array<float,2>{0.0889718607f, 0.18172048f},
-std::array<float,2>{0.801214457f, 0.508986473f},
-std::array<float,2>{0.313314021f, 0.962708771f},
-std::array<float,2>{0.687250018f, 0.406005681f},
-std::array<float,2>{0.122538023f, 0.390078723f},
-std::array<float,2>{0.754881799f, 0.937856376f},
-std::array<float,2>{0.359885395f, 0.516728103f},
-std::array<float,2>{0.645444036f, 0.16089721f},
-std::array<float,2>{0.473037958f, 0.0578337796f},
-std::array<float,2>{0.505428493f, 0.703091502f},
-std::array<float,2>{0.199798435f, 0.828518867f},
-std::array<float,2>{0.960769176f, 0.304969937f},
-std::array<float,2>{0.303018898f, 0.325306088f},
-std::array<float,2>{0.744854391f, 0.759738088f},
-std::array<float,2>{0.0257358104f, 0.631544173f},
-std::array<float,2>{0.822969615f, 0.0890791118f},
-std::array<float,2>{0.138595507f, 0.196457207f},
-std::array<float,2>{0.903715849f, 0.623592556f},
-std::array<float,2>{0.383445472f, 0.912462115f},
-std::array<float,2>{0.565414906f, 0.469467252f},
-std::array<float,2>{0.22588262f, 0.280656427f},
-std::array<float,2>{0.994896352f, 0.860017776f},
-std::array<float,2>{0.451683074f, 0.72522527f},
-std::array<float,2>{0.55606544f, 0.0123012364f},
-std::array<float,2>{0.343176037f, 0.131657749f},
-std::array<float,2>{0.658021331f, 0.561732352f},
-std::array<float,2>{0.0688206777f, 0.995267153f},
-std::array<float,2>{0.784574747f, 0.417911887f},
-std::array<float,2>{0.415512562f, 0.465448678f},
-std::array<float,2>{0.606727004f, 0.891263485f},
-std::array<float,2>{0.182378501f, 0.563499689f},
-std::array<float,2>{0.920150697f, 0.231061906f},
-std::array<float,2>{0.0616975129f, 0.118717529f},
-std::array<float,2>{0.867076933f, 0.679479957f},
-std::array<float,2>{0.268599719f, 0.805428803f},
-std::array<float,2>{0.695404112f, 0.344281048f},
-std::array<float,2>{0.00225001178f, 0.276283503f},
-std::array<float,2>{0.834397137f, 0.864392757f},
-std::array<float,2>{0.295564175f, 0.719500601f},
-std::array<float,2>{0.72928983f, 0.0105357179f},
-std::array<float,2>{0.405512691f, 0.125511646f},
-std::array<float,2>{0.593562722f, 0.555279255f},
-std::array<float,2>{0.143816501f, 0.998835087f},
-std::array<float,2>{0.887096286f, 0.417986631f},
-std::array<float,2>{0.353472292f, 0.462112278f},
-std::array<float,2>{0.634754479f, 0.894928515f},
-std::array<float,2>{0.0963265449f, 0.56694752f},
-std::array<float,2>{0.778230369f, 0.229294166f},
-std::array<float,2>{0.212221846f, 0.124647968f},
-std::array<float,2>{0.950460553f, 0.672843695f},
-std::array<float,2>{0.498460561f, 0.812317014f},
-std::array<float,2>{0.529671609f, 0.347783655f},
-std::array<float,2>{0.160577387f, 0.386444271f},
-std::array<float,2>{0.924248815f, 0.94380635f},
-std::array<float,2>{0.427344829f, 0.522798061f},
-std::array<float,2>{0.611067295f, 0.158672333f},
-std::array<float,2>{0.255739927f, 0.0597034767f},
-std::array<float,2>{0.705448508f, 0.698455751f},
-std::array<float,2>{0.0411232375f, 0.83312124f},
-std::array<float,2>{0.849058747f, 0.309396505f},
-std::array<float,2>{0.454335839f, 0.323406756f},
-std::array<float,2>{0.539850056f, 0.764222741f},
-std::array<float,2>{0.245375216f, 0.627410412f},
-std::array<float,2>{0.970465362f, 0.0931804478f},
-std::array<float,2>{0.0817067772f, 0.201320797f},
-std::array<float,2>{0.80554682f, 0.617574811f},
-std::array<float,2>{0.324224085f, 0.907883167f},
-std::array<float,2>{0.676021814f, 0.473339528f},
-std::array<float,2>{0.11450386f, 0.485254228f},
-std::array<float,2>{0.762825966f, 0.928369284f},
-std::array<float,2>{0.367367804f, 0.606169224f},
-std::array<float,2>{0.653469145f, 0.209953904f},
-std::array<float,2>{0.482566327f, 0.0646202639f},
-std::array<float,2>{0.511510313f, 0.652549028f},
-std::array<float,2>{0.190261021f, 0.766305029f},
-std::array<float,2>{0.96335572f, 0.329417497f},
-std::array<float,2>{0.305483401f, 0.292297214f},
-std::array<float,2>{0.737115741f, 0.822382867f},
-std::array<float,2>{0.0200980175f, 0.715917528f},
-std::array<float,2>{0.816546381f, 0.0434315726f},
-std::array<float,2>{0.128824994f, 0.183648646f},
-std::array<float,2>{0.893826127f, 0.513230622f},
-std::array<float,2>{0.375479072f, 0.967092276f},
-std::array<float,2>{0.570864439f, 0.401400298f},
-std::array<float,2>{0.231735602f, 0.372053236f},
-std::array<float,2>{0.989457965f, 0.794932365f},
-std::array<float,2>{0.437999278f, 0.67116791f},
-std::array<float,2>{0.551810086f, 0.102576591f},
-std::array<float,2>{0.332605153f, 0.238169968f},
-std::array<float,2>{0.671407342f, 0.589564919f},
-std::array<float,2>{0.0759174824f, 0.876202106f},
-std::array<float,2>{0.79414171f, 0.447502464f},
-std::array<float,2>{0.407089919f, 0.432220876f},
-std::array<float,2>{0.597166061f, 0.978297293f},
-std::array<float,2>{0.179117709f, 0.543582559f},
-std::array<float,2>{0.913683474f, 0.155965641f},
-std::array<float,2>{0.0530879684f, 0.0184425358f},
-std::array<float,2>{0.869539261f, 0.744160056f},
-std::array<float,2>{0.275261313f, 0.85893321f},
-std::array<float,2>{0.689687312f, 0.254526824f},
-std::array<float,2>{0.0630897358f, 0.339584053f},
-std::array<float,2>{0.786175966f, 0.778736591f},
-std::array<float,2>{0.338171691f, 0.640783608f},
-std::array<float,2>{0.660406113f, 0.0728770718f},
-std::array<float,2>{0.446354598f, 0.212468505f},
-std::array<float,2>{0.559962273f, 0.596635878f},
-std::array<float,2>{0.221707866f, 0.935056269f},
-std::array<float,2>{0.998785853f, 0.495159477f},
-std::array<float,2>{0.269574404f, 0.395465523f},
-std::array<float,2>{0.701425076f, 0.958844304f},
-std::array<float,2>{0.058447998f, 0.507747233f},
-std::array<float,2>{0.861297727f, 0.17909357f},
-std::array<float,2>{0.185812488f, 0.0385265239f},
-std::array<float,2>{0.916162431f, 0.709578395f},
-std::array<float,2>{0.418467849f, 0.815261543f},
-std::array<float,2>{0.602664292f, 0.284028977f},
-std::array<float,2>{0.195967138f, 0.440010726f},
-std::array<float,2>{0.955393076f, 0.886766791f},
-std::array<float,2>{0.469908297f, 0.582616091f},
-std::array<float,2>{0.501862228f, 0.242728233f},
-std::array<float,2>{0.364235491f, 0.1001058f},
-std::array<float,2>{0.642446756f, 0.663242757f},
-std::array<float,2>{0.11826501f, 0.781639397f},
-std::array<float,2>{0.753617704f, 0.359717578f},
-std::array<float,2>{0.390330017f, 0.263942659f},
-std::array<float,2>{0.568543196f, 0.844736218f},
-std::array<float,2>{0.136584759f, 0.737974703f},
-std::array<float,2>{0.899735451f, 0.0277665295f},
-std::array<float,2>{0.0306998901f, 0.141797215f},
-std::array<float,2>{0.82631892f, 0.539060771f},
-std::array<float,2>{0.297582537f, 0.970476747f},
-std::array<float,2>{0.74851644f, 0.424103111f},
-std::array<float,2>{0.0347972848f, 0.413103938f},
-std::array<float,2>{0.854175746f, 0.989960611f},
-std::array<float,2>{0.258719355f, 0.550570786f},
-std::array<float,2>{0.713018358f, 0.132815629f},
-std::array<float,2>{0.437085032f, 0.00650320249f},
-std::array<float,2>{0.62347728f, 0.72861737f},
-std::array<float,2>{0.170590818f, 0.870216906f},
-std::array<float,2>{0.93422097f, 0.265818566f},
-std::array<float,2>{0.316713661f, 0.352577418f},
-std::array<float,2>{0.683488011f, 0.799756467f},
-std::array<float,2>{0.0929930285f, 0.687157631f},
-std::array<float,2>{0.798093557f, 0.111714363f},
-std::array<float,2>{0.235540047f, 0.219516292f},
-std::array<float,2>{0.982689798f, 0.577319264f},
-std::array<float,2>{0.466434807f, 0.900809228f},
-std::array<float,2>{0.536431372f, 0.453597695f},
-std::array<float,2>{0.155526757f, 0.303081274f},
-std::array<float,2>{0.879953623f, 0.843570352f},
-std::array<float,2>{0.396204829f, 0.688541055f},
-std::array<float,2>{0.583168983f, 0.0529202893f},
-std::array<float,2>{0.285651058f, 0.164095715f},
-std::array<float,2>{0.725455761f, 0.529825568f},
-std::array<float,2>{0.012772508f, 0.948172271f},
-std::array<float,2>{0.836058438f, 0.378731966f},
-std::array<float,2>{0.486994058f, 0.479141325f},
-std::array<float,2>{0.519690454f, 0.915623963f},
-std::array<float,2>{0.209024534f, 0.612896144f},
-std::array<float,2>{0.938185215f, 0.188430667f},
-std::array<float,2>{0.107117437f, 0.0845644623f},
-std::array<float,2>{0.766888678f, 0.639354408f},
-std::array<float,2>{0.344928592f, 0.755622864f},
-std::array<float,2>{0.630353332f, 0.31895262f},
-std::array<float,2>{0.100309961f, 0.288491637f},
-std::array<float,2>{0.773863792f, 0.82030189f},
-std::array<float,2>{0.356756121f, 0.705438077f},
-std::array<float,2>{0.638498247f, 0.0343611389f},
-std::array<float,2>{0.493564695f, 0.173536718f},
-std::array<float,2>{0.523934543f, 0.503536344f},
-std::array<float,2>{0.217256591f, 0.954518437f},
-std::array<float,2>{0.949098527f, 0.393145919f},
-std::array<float,2>{0.292758256f, 0.49687466f},
-std::array<float,2>{0.73336792f, 0.932965159f},
-std::array<float,2>{0.00421519578f, 0.601334393f},
-std::array<float,2>{0.830156565f, 0.217155308f},
-std::array<float,2>{0.146098018f, 0.0769829154f},
-std::array<float,2>{0.886646509f, 0.647191584f},
-std::array<float,2>{0.399910122f, 0.773492277f},
-std::array<float,2>{0.588368535f, 0.343479067f},
-std::array<float,2>{0.248429507f, 0.428807884f},
-std::array<float,2>{0.973091304f, 0.97639215f},
-std::array<float,2>{0.460094899f, 0.534808338f},
-std::array<float,2>{0.544064522f, 0.147461936f},
-std::array<float,2>{0.320744693f, 0.023484366f},
-std::array<float,2>{0.673971057f, 0.738421619f},
-std::array<float,2>{0.0823203772f, 0.84912014f},
-std::array<float,2>{0.809041619f, 0.259101123f},
-std::array<float,2>{0.425345659f, 0.36503014f},
-std::array<float,2>{0.616414368f, 0.788638592f},
-std::array<float,2>{0.158020243f, 0.658066213f},
-std::array<float,2>{0.927322149f, 0.0948568806f},
-std::array<float,2>{0.0456739552f, 0.248063862f},
-std::array<float,2>{0.84404707f, 0.579074562f},
-std::array<float,2>{0.250686646f, 0.882964075f},
-std::array<float,2>{0.7075665f, 0.44493407f},
-std::array<float,2>{0.0164194331f, 0.458870202f},
-std::array<float,2>{0.813198805f, 0.904782116f},
-std::array<float,2>{0.312024891f, 0.571161091f},
-std::array<float,2>{0.740902066f, 0.225895151f},
-std::array<float,2>{0.379252523f, 0.113856606f},
-std::array<float,2>{0.575564206f, 0.681111991f},
-std::array<float,2>{0.130901486f, 0.803588808f},
-std::array<float,2>{0.897834301f, 0.357149065f},
-std::array<float,2>{0.371973515f, 0.270165205f},
-std::array<float,2>{0.651901841f, 0.873813152f},
-std::array<float,2>{0.111950889f, 0.730805278f},
-std::array<float,2>{0.761585951f, 0.00154297554f},
-std::array<float,2>{0.193199635f, 0.138198629f},
-std::array<float,2>{0.968183041f, 0.553326845f},
-std::array<float,2>{0.477796644f, 0.987122536f},
-std::array<float,2>{0.51255101f, 0.409842223f},
-std::array<float,2>{0.172179148f, 0.315920681f},
-std::array<float,2>{0.908078671f, 0.750212431f},
-std::array<float,2>{0.41065827f, 0.636563182f},
-std::array<float,2>{0.598498821f, 0.081352599f},
-std::array<float,2>{0.279270411f, 0.193366125f},
-std::array<float,2>{0.694957256f, 0.615658402f},
-std::array<float,2>{0.0474132113f, 0.918589175f},
-std::array<float,2>{0.874789536f, 0.483589381f},
-std::array<float,2>{0.444229484f, 0.379903823f},
-std::array<float,2>{0.547065794f, 0.949752212f},
-std::array<float,2>{0.228843585f, 0.525488973f},
-std::array<float,2>{0.987997174f, 0.168293551f},
-std::array<float,2>{0.0738054365f, 0.048718743f},
-std::array<float,2>{0.792842686f, 0.692390978f},
-std::array<float,2>{0.328887761f, 0.838969648f},
-std::array<float,2>{0.667428553f, 0.29711771f},
-std::array<float,2>{0.0598096214f, 0.345254421f},
-std::array<float,2>{0.864534199f, 0.806624115f},
-std::array<float,2>{0.266523719f, 0.67848599f},
-std::array<float,2>{0.697879553f, 0.117294446f},
-std::array<float,2>{0.416142195f, 0.232210279f},
-std::array<float,2>{0.609317482f, 0.562694371f},
-std::array<float,2>{0.179858997f, 0.891889036f},
-std::array<float,2>{0.919418275f, 0.466790289f},
-std::array<float,2>{0.340922952f, 0.416913867f},
-std::array<float,2>{0.658641219f, 0.994650245f},
-std::array<float,2>{0.0680956617f, 0.561156631f},
-std::array<float,2>{0.78310585f, 0.132106751f},
-std::array<float,2>{0.223257139f, 0.0127599491f},
-std::array<float,2>{0.992656589f, 0.726056337f},
-std::array<float,2>{0.449835241f, 0.861240089f},
-std::array<float,2>{0.558184683f, 0.279745251f},
-std::array<float,2>{0.14032945f, 0.47027868f},
-std::array<float,2>{0.904615045f, 0.913332462f},
-std::array<float,2>{0.38541761f, 0.624979198f},
-std::array<float,2>{0.562775373f, 0.1961613f},
-std::array<float,2>{0.300787836f, 0.0886476487f},
-std::array<float,2>{0.744005382f, 0.632002234f},
-std::array<float,2>{0.0236994736f, 0.757849574f},
-std::array<float,2>{0.821800709f, 0.32458511f},
-std::array<float,2>{0.476275951f, 0.305898875f},
-std::array<float,2>{0.50775373f, 0.829200745f},
-std::array<float,2>{0.201925054f, 0.702147305f},
-std::array<float,2>{0.95784694f, 0.0567059927f},
-std::array<float,2>{0.124968119f, 0.161775902f},
-std::array<float,2>{0.756839931f, 0.515766442f},
-std::array<float,2>{0.362589121f, 0.938988864f},
-std::array<float,2>{0.646564841f, 0.388899148f},
-std::array<float,2>{0.0862822831f, 0.404911101f},
-std::array<float,2>{0.80305481f, 0.961147904f},
-std::array<float,2>{0.315850139f, 0.508722961f},
-std::array<float,2>{0.685046136f, 0.182931557f},
-std::array<float,2>{0.464145541f, 0.0428235456f},
-std::array<float,2>{0.533703148f, 0.713859618f},
-std::array<float,2>{0.240504354f, 0.826844156f},
-std::array<float,2>{0.978669226f, 0.295181334f},
-std::array<float,2>{0.265226007f, 0.332451731f},
-std::array<float,2>{0.715649068f, 0.771131694f},
-std::array<float,2>{0.0375532806f, 0.650187135f},
-std::array<float,2>{0.858021796f, 0.068950884f},
-std::array<float,2>{0.166521132f, 0.205935761f},
-std::array<float,2>{0.93047905f, 0.602163911f},
-std::array<float,2>{0.432491273f, 0.924074411f},
-std::array<float,2>{0.617874086f, 0.489345908f},
-std::array<float,2>{0.204762548f, 0.252283812f},
-std::array<float,2>{0.943662226f, 0.853280306f},
-std::array<float,2>{0.488899231f, 0.746205688f},
-std::array<float,2>{0.51602304f, 0.0230325963f},
-std::array<float,2>{0.34929496f, 0.148480982f},
-std::array<float,2>{0.628431022f, 0.541478097f},
-std::array<float,2>{0.103041895f, 0.980495453f},
-std::array<float,2>{0.771454692f, 0.433637083f},
-std::array<float,2>{0.392362267f, 0.45272404f},
-std::array<float,2>{0.581343949f, 0.879470289f},
-std::array<float,2>{0.148855373f, 0.590837598f},
-std::array<float,2>{0.877694249f, 0.239664227f},
-std::array<float,2>{0.00987640955f, 0.105737805f},
-std::array<float,2>{0.840454876f, 0.664536953f},
-std::array<float,2>{0.284287155f, 0.789871812f},
-std::array<float,2>{0.718885481f, 0.370119959f},
-std::array<float,2>{0.0395692997f, 0.31141305f},
-std::array<float,2>{0.849627197f, 0.83456111f},
-std::array<float,2>{0.256575048f, 0.695585072f},
-std::array<float,2>{0.703675628f, 0.0624360517f},
-std::array<float,2>{0.428652316f, 0.156497791f},
-std::array<float,2>{0.611621857f, 0.521113932f},
-std::array<float,2>{0.162602946f, 0.942089975f},
-std::array<float,2>{0.923045039f, 0.384489775f},
-std::array<float,2>{0.327139705f, 0.474954158f},
-std::array<float,2>{0.678781509f, 0.909156382f},
-std::array<float,2>{0.0783672109f, 0.619620025f},
-std::array<float,2>{0.808523536f, 0.199840546f},
-std::array<float,2>{0.243701845f, 0.0904579535f},
-std::array<float,2>{0.971622884f, 0.626882672f},
-std::array<float,2>{0.455312699f, 0.762638748f},
-std::array<float,2>{0.542249739f, 0.321812034f},
-std::array<float,2>{0.141638458f, 0.421226978f},
-std::array<float,2>{0.890594959f, 0.996166825f},
-std::array<float,2>{0.403120935f, 0.558273435f},
-std::array<float,2>{0.591710925f, 0.128119648f},
-std::array<float,2>{0.29340893f, 0.00826511532f},
-std::array<float,2>{0.726864576f, 0.721000969f},
-std::array<float,2>{0.000680999306f, 0.865754664f},
-std::array<float,2>{0.833177984f, 0.273491114f},
-std::array<float,2>{0.496320426f, 0.35143289f},
-std::array<float,2>{0.528320968f, 0.809367836f},
-std::array<float,2>{0.213084802f, 0.675257266f},
-std::array<float,2>{0.95175451f, 0.12188141f},
-std::array<float,2>{0.094038479f, 0.227065191f},
-std::array<float,2>{0.781234264f, 0.568408668f},
-std::array<float,2>{0.354283839f, 0.897573829f},
-std::array<float,2>{0.635356009f, 0.464826912f},
-std::array<float,2>{0.076874949f, 0.44665435f},
-std::array<float,2>{0.796232522f, 0.87805599f},
-std::array<float,2>{0.334578395f, 0.586650193f},
-std::array<float,2>{0.669047356f, 0.235889375f},
-std::array<float,2>{0.439645022f, 0.10519655f},
-std::array<float,2>{0.554002285f, 0.669551194f},
-std::array<float,2>{0.233843088f, 0.793949842f},
-std::array<float,2>{0.992002487f, 0.374329567f},
-std::array<float,2>{0.276379466f, 0.256537855f},
-std::array<float,2>{0.688224733f, 0.85621655f},
-std::array<float,2>{0.0522410534f, 0.74407649f},
-std::array<float,2>{0.868021488f, 0.0175269693f},
-std::array<float,2>{0.177575573f, 0.152561545f},
-std::array<float,2>{0.911590993f, 0.546612978f},
-std::array<float,2>{0.409100056f, 0.979499817f},
-std::array<float,2>{0.594188869f, 0.431418478f},
-std::array<float,2>{0.187557995f, 0.331806511f},
-std::array<float,2>{0.962779939f, 0.76870513f},
-std::array<float,2>{0.481642693f, 0.655757666f},
-std::array<float,2>{0.50842154f, 0.0634253249f},
-std::array<float,2>{0.369979411f, 0.20731242f},
-std::array<float,2>{0.654722333f, 0.608052969f},
-std::array<float,2>{0.115450338f, 0.925998032f},
-std::array<float,2>{0.765572131f, 0.488085806f},
-std::array<float,2>{0.37890017f, 0.399288028f},
-std::array<float,2>{0.574151337f, 0.966796041f},
-std::array<float,2>{0.126550332f, 0.515592396f},
-std::array<float,2>{0.891633928f, 0.186496451f},
-std::array<float,2>{0.0227037389f, 0.0455826558f},
-std::array<float,2>{0.818856895f, 0.717095852f},
-std::array<float,2>{0.307183385f, 0.821802258f},
-std::array<float,2>{0.735112786f, 0.290237993f},
-std::array<float,2>{0.119785331f, 0.362234473f},
-std::array<float,2>{0.750755489f, 0.783308566f},
-std::array<float,2>{0.366348147f, 0.661314964f},
-std::array<float,2>{0.644028187f, 0.0992696732f},
-std::array<float,2>{0.471481353f, 0.245311782f},
-std::array<float,2>{0.502119124f, 0.584422708f},
-std::array<float,2>{0.198927835f, 0.889126301f},
-std::array<float,2>{0.954290926f, 0.438781559f},
-std::array<float,2>{0.299567372f, 0.423582971f},
-std::array<float,2>{0.746139467f, 0.971470356f},
-std::array<float,2>{0.0283893514f, 0.535604835f},
-std::array<float,2>{0.82443893f, 0.142861068f},
-std::array<float,2>{0.133497491f, 0.0294135027f},
-std::array<float,2>{0.901154578f, 0.735293329f},
-std::array<float,2>{0.387432694f, 0.846258819f},
-std::array<float,2>{0.56812644f, 0.262965351f},
-std::array<float,2>{0.220105603f, 0.493679732f},
-std::array<float,2>{0.996656835f, 0.937027693f},
-std::array<float,2>{0.447933704f, 0.593979776f},
-std::array<float,2>{0.5612064f, 0.213150933f},
-std::array<float,2>{0.337037504f, 0.0711243525f},
-std::array<float,2>{0.662956059f, 0.643229961f},
-std::array<float,2>{0.0661908239f, 0.780156672f},
-std::array<float,2>{0.788883924f, 0.337711781f},
-std::array<float,2>{0.421674848f, 0.283199638f},
-std::array<float,2>{0.604931533f, 0.813619137f},
-std::array<float,2>{0.185070992f, 0.708789408f},
-std::array<float,2>{0.915948749f, 0.0355292447f},
-std::array<float,2>{0.0564678162f, 0.176474437f},
-std::array<float,2>{0.863066316f, 0.504499793f},
-std::array<float,2>{0.272670686f, 0.959284306f},
-std::array<float,2>{0.70009768f, 0.39743194f},
-std::array<float,2>{0.0140797589f, 0.375006407f},
-std::array<float,2>{0.839189351f, 0.946634829f},
-std::array<float,2>{0.288965851f, 0.527533889f},
-std::array<float,2>{0.723191381f, 0.167190298f},
-std::array<float,2>{0.396561861f, 0.0508767329f},
-std::array<float,2>{0.58513397f, 0.690027595f},
-std::array<float,2>{0.153381646f, 0.840083122f},
-std::array<float,2>{0.88130486f, 0.302348137f},
-std::array<float,2>{0.346647173f, 0.318170488f},
-std::array<float,2>{0.632257521f, 0.757450998f},
-std::array<float,2>{0.108911864f, 0.637526989f},
-std::array<float,2>{0.768933475f, 0.0828640237f},
-std::array<float,2>{0.207626313f, 0.190515682f},
-std::array<float,2>{0.939747393f, 0.610805869f},
-std::array<float,2>{0.486187845f, 0.916498542f},
-std::array<float,2>{0.522153735f, 0.478495628f},
-std::array<float,2>{0.168957442f, 0.268712759f},
-std::array<float,2>{0.936938345f, 0.868607581f},
-std::array<float,2>{0.435437828f, 0.727560997f},
-std::array<float,2>{0.622152328f, 0.00461296551f},
-std::array<float,2>{0.260062546f, 0.136001602f},
-std::array<float,2>{0.711449146f, 0.548021257f},
-std::array<float,2>{0.032687664f, 0.990651369f},
-std::array<float,2>{0.852572799f, 0.411942363f},
-std::array<float,2>{0.467044413f, 0.456821471f},
-std::array<float,2>{0.538736403f, 0.900202215f},
-std::array<float,2>{0.236938372f, 0.574555099f},
-std::array<float,2>{0.980585515f, 0.22078371f},
-std::array<float,2>{0.09130878f, 0.111170165f},
-std::array<float,2>{0.799133182f, 0.685301781f},
-std::array<float,2>{0.320085436f, 0.797332764f},
-std::array<float,2>{0.679808319f, 0.35487029f},
-std::array<float,2>{0.0846299231f, 0.260632783f},
-std::array<float,2>{0.811250091f, 0.850865662f},
-std::array<float,2>{0.323570281f, 0.741859198f},
-std::array<float,2>{0.672610462f, 0.0270718485f},
-std::array<float,2>{0.458756328f, 0.145192951f},
-std::array<float,2>{0.544947684f, 0.531518161f},
-std::array<float,2>{0.24656117f, 0.973048747f},
-std::array<float,2>{0.976378441f, 0.42656365f},
-std::array<float,2>{0.252834409f, 0.441897959f},
-std::array<float,2>{0.710602403f, 0.886440396f},
-std::array<float,2>{0.0439093597f, 0.580620348f},
-std::array<float,2>{0.845778942f, 0.246980995f},
-std::array<float,2>{0.15897347f, 0.0969333351f},
-std::array<float,2>{0.92776531f, 0.659425139f},
-std::array<float,2>{0.422746927f, 0.786674261f},
-std::array<float,2>{0.614809752f, 0.365956962f},
-std::array<float,2>{0.215828821f, 0.391607851f},
-std::array<float,2>{0.945444942f, 0.956318498f},
-std::array<float,2>{0.496090412f, 0.500249445f},
-std::array<float,2>{0.527306318f, 0.174147025f},
-std::array<float,2>{0.358252406f, 0.032301113f},
-std::array<float,2>{0.63910377f, 0.704254568f},
-std::array<float,2>{0.0977465808f, 0.817733109f},
-std::array<float,2>{0.77723372f, 0.285224766f},
-std::array<float,2>{0.402186215f, 0.340357363f},
-std::array<float,2>{0.587104142f, 0.776970088f},
-std::array<float,2>{0.14761816f, 0.645544887f},
-std::array<float,2>{0.883499444f, 0.0750955567f},
-std::array<float,2>{0.00759785157f, 0.214913145f},
-std::array<float,2>{0.828272879f, 0.598317742f},
-std::array<float,2>{0.290271312f, 0.930315197f},
-std::array<float,2>{0.730491102f, 0.499035269f},
-std::array<float,2>{0.0488858297f, 0.481382191f},
-std::array<float,2>{0.872455001f, 0.921361804f},
-std::array<float,2>{0.280687273f, 0.614394367f},
-std::array<float,2>{0.69268471f, 0.193172038f},
-std::array<float,2>{0.41358155f, 0.0786970556f},
-std::array<float,2>{0.601098835f, 0.634251297f},
-std::array<float,2>{0.174057424f, 0.753004849f},
-std::array<float,2>{0.909214973f, 0.314278901f},
-std::array<float,2>{0.33107695f, 0.299906999f},
-std::array<float,2>{0.664400935f, 0.836681962f},
-std::array<float,2>{0.0716029108f, 0.693407118f},
-std::array<float,2>{0.790071666f, 0.0496603698f},
-std::array<float,2>{0.227809012f, 0.170448273f},
-std::array<float,2>{0.984904289f, 0.524411678f},
-std::array<float,2>{0.44316113f, 0.953017294f},
-std::array<float,2>{0.549338162f, 0.382009506f},
-std::array<float,2>{0.129417911f, 0.358269781f},
-std::array<float,2>{0.894611955f, 0.802495182f},
-std::array<float,2>{0.38203153f, 0.683169782f},
-std::array<float,2>{0.576236963f, 0.115572132f},
-std::array<float,2>{0.309257329f, 0.22362268f},
-std::array<float,2>{0.740024686f, 0.572352886f},
-std::array<float,2>{0.0187145844f, 0.904084444f},
-std::array<float,2>{0.815756679f, 0.459624767f},
-std::array<float,2>{0.479535341f, 0.406316549f},
-std::array<float,2>{0.51508826f, 0.986240506f},
-std::array<float,2>{0.195053384f, 0.551316023f},
-std::array<float,2>{0.965283751f, 0.140502691f},
-std::array<float,2>{0.110093459f, 0.00228432403f},
-std::array<float,2>{0.757896125f, 0.732661664f},
-std::array<float,2>{0.374096662f, 0.872111976f},
-std::array<float,2>{0.648479521f, 0.272005379f},
-std::array<float,2>{0.0263688099f, 0.326575518f},
-std::array<float,2>{0.824133158f, 0.76111424f},
-std::array<float,2>{0.30459398f, 0.629581571f},
-std::array<float,2>{0.745298326f, 0.0875714794f},
-std::array<float,2>{0.384257048f, 0.197860286f},
-std::array<float,2>{0.566284418f, 0.622161567f},
-std::array<float,2>{0.137642339f, 0.911218524f},
-std::array<float,2>{0.902890205f, 0.471112579f},
-std::array<float,2>{0.36113897f, 0.386804044f},
-std::array<float,2>{0.645775497f, 0.941264331f},
-std::array<float,2>{0.121183559f, 0.518380404f},
-std::array<float,2>{0.755650699f, 0.162169054f},
-std::array<float,2>{0.200806394f, 0.0548018254f},
-std::array<float,2>{0.959892511f, 0.700907409f},
-std::array<float,2>{0.474339575f, 0.830205679f},
-std::array<float,2>{0.504321516f, 0.30752036f},
-std::array<float,2>{0.182791665f, 0.467961937f},
-std::array<float,2>{0.921009719f, 0.894463837f},
-std::array<float,2>{0.414395809f, 0.56514883f},
-std::array<float,2>{0.606070518f, 0.233860761f},
-std::array<float,2>{0.267925292f, 0.120936714f},
-std::array<float,2>{0.696553707f, 0.676656425f},
-std::array<float,2>{0.0615019463f, 0.807834685f},
-std::array<float,2>{0.865444303f, 0.347427517f},
-std::array<float,2>{0.453078002f, 0.277350634f},
-std::array<float,2>{0.554881215f, 0.862338066f},
-std::array<float,2>{0.224739969f, 0.723245442f},
-std::array<float,2>{0.99607724f, 0.0139284581f},
-std::array<float,2>{0.0702314749f, 0.129055232f},
-std::array<float,2>{0.783711314f, 0.559607148f},
-std::array<float,2>{0.342234701f, 0.993447483f},
-std::array<float,2>{0.656694591f, 0.414950579f},
-std::array<float,2>{0.105203062f, 0.436719954f},
-std::array<float,2>{0.771757424f, 0.98274219f},
-std::array<float,2>{0.350370675f, 0.540077031f},
-std::array<float,2>{0.625170887f, 0.15148209f},
-std::array<float,2>{0.491948396f, 0.0198605414f},
-std::array<float,2>{0.519349217f, 0.74972862f},
-std::array<float,2>{0.206772804f, 0.854873598f},
-std::array<float,2>{0.941878319f, 0.251395583f},
-std::array<float,2>{0.282309592f, 0.367320269f},
-std::array<float,2>{0.721273601f, 0.791668236f},
-std::array<float,2>{0.00825330336f, 0.667904019f},
-std::array<float,2>{0.84347105f, 0.108306378f},
-std::array<float,2>{0.15089114f, 0.24069193f},
-std::array<float,2>{0.875058532f, 0.593178391f},
-std::array<float,2>{0.393335193f, 0.882478476f},
-std::array<float,2>{0.578966141f, 0.450239599f},
-std::array<float,2>{0.239387646f, 0.294761568f},
-std::array<float,2>{0.976726413f, 0.824876368f},
-std::array<float,2>{0.462620705f, 0.710990071f},
-std::array<float,2>{0.531300724f, 0.0403202847f},
-std::array<float,2>{0.313720644f, 0.180388406f},
-std::array<float,2>{0.686416447f, 0.510502398f},
-std::array<float,2>{0.088604793f, 0.964449644f},
-std::array<float,2>{0.802379549f, 0.402942866f},
-std::array<float,2>{0.431240171f, 0.491254032f},
-std::array<float,2>{0.619969308f, 0.92352885f},
-std::array<float,2>{0.165951967f, 0.605048835f},
-std::array<float,2>{0.932796419f, 0.204034641f},
-std::array<float,2>{0.0363149904f, 0.0670574531f},
-std::array<float,2>{0.857225358f, 0.650589883f},
-std::array<float,2>{0.262537867f, 0.77237004f},
-std::array<float,2>{0.717489898f, 0.334785372f},
-std::array<float,2>{0.0131979715f, 0.301850051f},
-std::array<float,2>{0.836858511f, 0.840734601f},
-std::array<float,2>{0.285275042f, 0.689632654f},
-std::array<float,2>{0.724677682f, 0.0513726361f},
-std::array<float,2>{0.395769835f, 0.167681783f},
-std::array<float,2>{0.58357656f, 0.527950585f},
-std::array<float,2>{0.156130686f, 0.946909964f},
-std::array<float,2>{0.880496144f, 0.375635147f},
-std::array<float,2>{0.345399171f, 0.477865934f},
-std::array<float,2>{0.63064307f, 0.916605353f},
-std::array<float,2>{0.106554471f, 0.611271262f},
-std::array<float,2>{0.767090201f, 0.191155091f},
-std::array<float,2>{0.20993197f, 0.0821382925f},
-std::array<float,2>{0.937704265f, 0.636848509f},
-std::array<float,2>{0.486362487f, 0.756984353f},
-std::array<float,2>{0.520366669f, 0.317514867f},
-std::array<float,2>{0.170028701f, 0.411353827f},
-std::array<float,2>{0.933624923f, 0.991181254f},
-std::array<float,2>{0.436554879f, 0.548717976f},
-std::array<float,2>{0.623982012f, 0.136440814f},
-std::array<float,2>{0.257954478f, 0.00430368027f},
-std::array<float,2>{0.713798761f, 0.728514791f},
-std::array<float,2>{0.0346112475f, 0.868652463f},
-std::array<float,2>{0.853859663f, 0.269438535f},
-std::array<float,2>{0.46616295f, 0.355052114f},
-std::array<float,2>{0.536653936f, 0.797492743f},
-std::array<float,2>{0.235932872f, 0.684895039f},
-std::array<float,2>{0.983024538f, 0.110725969f},
-std::array<float,2>{0.0934504196f, 0.22126469f},
-std::array<float,2>{0.798749864f, 0.57503289f},
-std::array<float,2>{0.317206562f, 0.899729788f},
-std::array<float,2>{0.682977855f, 0.456199884f},
-std::array<float,2>{0.118844181f, 0.43942526f},
-std::array<float,2>{0.753017724f, 0.889537692f},
-std::array<float,2>{0.363662958f, 0.584765673f},
-std::array<float,2>{0.641628444f, 0.245946705f},
-std::array<float,2>{0.470692754f, 0.098800756f},
-std::array<float,2>{0.501170635f, 0.661979496f},
-std::array<float,2>{0.19567582f, 0.783990741f},
-std::array<float,2>{0.95567435f, 0.36147213f},
-std::array<float,2>{0.297100216f, 0.263518155f},
-std::array<float,2>{0.748951375f, 0.846051753f},
-std::array<float,2>{0.0308449436f, 0.734442532f},
-std::array<float,2>{0.826990068f, 0.0301470626f},
-std::array<float,2>{0.13593182f, 0.143242076f},
-std::array<float,2>{0.900343835f, 0.535952806f},
-std::array<float,2>{0.389842331f, 0.970851541f},
-std::array<float,2>{0.569064379f, 0.422880203f},
-std::array<float,2>{0.222264126f, 0.337248653f},
-std::array<float,2>{0.998130739f, 0.779310167f},
-std::array<float,2>{0.447209209f, 0.64296937f},
-std::array<float,2>{0.560334921f, 0.070397824f},
-std::array<float,2>{0.33838135f, 0.21357955f},
-std::array<float,2>{0.660804808f, 0.594725013f},
-std::array<float,2>{0.0625101253f, 0.936526179f},
-std::array<float,2>{0.78696996f, 0.493221641f},
-std::array<float,2>{0.418399841f, 0.396588713f},
-std::array<float,2>{0.603198707f, 0.959863663f},
-std::array<float,2>{0.186247423f, 0.50391084f},
-std::array<float,2>{0.916690171f, 0.176179871f},
-std::array<float,2>{0.0576470047f, 0.0359269902f},
-std::array<float,2>{0.860634625f, 0.708062768f},
-std::array<float,2>{0.270074159f, 0.814006269f},
-std::array<float,2>{0.702122033f, 0.282551706f},
-std::array<float,2>{0.0752911046f, 0.374900401f},
-std::array<float,2>{0.794594646f, 0.794588327f},
-std::array<float,2>{0.332208455f, 0.669063389f},
-std::array<float,2>{0.670984387f, 0.104519755f},
-std::array<float,2>{0.437871873f, 0.235725671f},
-std::array<float,2>{0.55237937f, 0.586248279f},
-std::array<float,2>{0.232403085f, 0.878479838f},
-std::array<float,2>{0.990225792f, 0.447034955f},
-std::array<float,2>{0.274808824f, 0.431009829f},
-std::array<float,2>{0.689996958f, 0.980356574f},
-std::array<float,2>{0.0536009744f, 0.546042442f},
-std::array<float,2>{0.870036244f, 0.153310597f},
-std::array<float,2>{0.179671824f, 0.0170595404f},
-std::array<float,2>{0.913110316f, 0.743495822f},
-std::array<float,2>{0.406338662f, 0.855782151f},
-std::array<float,2>{0.597252905f, 0.256135732f},
-std::array<float,2>{0.189575434f, 0.487637281f},
-std::array<float,2>{0.963812113f, 0.926751733f},
-std::array<float,2>{0.482980549f, 0.607428789f},
-std::array<float,2>{0.510950029f, 0.207706004f},
-std::array<float,2>{0.368086904f, 0.0628671199f},
-std::array<float,2>{0.654028535f, 0.656248629f},
-std::array<float,2>{0.114819482f, 0.769113064f},
-std::array<float,2>{0.76334554f, 0.331482679f},
-std::array<float,2>{0.375846893f, 0.290799141f},
-std::array<float,2>{0.570361257f, 0.821687579f},
-std::array<float,2>{0.128271386f, 0.717352629f},
-std::array<float,2>{0.89419955f, 0.0450353362f},
-std::array<float,2>{0.0196893252f, 0.185945496f},
-std::array<float,2>{0.816929996f, 0.514719784f},
-std::array<float,2>{0.304781199f, 0.965885878f},
-std::array<float,2>{0.73681289f, 0.398890853f},
-std::array<float,2>{0.0416723192f, 0.384069145f},
-std::array<float,2>{0.849555433f, 0.941488445f},
-std::array<float,2>{0.255002856f, 0.520992815f},
-std::array<float,2>{0.705681205f, 0.156987831f},
-std::array<float,2>{0.426964372f, 0.0615979657f},
-std::array<float,2>{0.610710502f, 0.696067274f},
-std::array<float,2>{0.160759047f, 0.834018886f},
-std::array<float,2>{0.924510002f, 0.310852528f},
-std::array<float,2>{0.324766368f, 0.321740776f},
-std::array<float,2>{0.676406384f, 0.762162745f},
-std::array<float,2>{0.0815175995f, 0.626123846f},
-std::array<float,2>{0.805155456f, 0.0900453776f},
-std::array<float,2>{0.245789468f, 0.199245229f},
-std::array<float,2>{0.970209599f, 0.619953871f},
-std::array<float,2>{0.454643607f, 0.908637404f},
-std::array<float,2>{0.539487362f, 0.475099027f},
-std::array<float,2>{0.144445106f, 0.274085581f},
-std::array<float,2>{0.887669921f, 0.865635812f},
-std::array<float,2>{0.405902445f, 0.721621811f},
-std::array<float,2>{0.593255162f, 0.00859375671f},
-std::array<float,2>{0.295078218f, 0.128504232f},
-std::array<float,2>{0.728713572f, 0.557766736f},
-std::array<float,2>{0.00270522223f, 0.996975183f},
-std::array<float,2>{0.834595799f, 0.421553314f},
-std::array<float,2>{0.498546392f, 0.46418342f},
-std::array<float,2>{0.52985692f, 0.898148656f},
-std::array<float,2>{0.212665245f, 0.569043338f},
-std::array<float,2>{0.950710416f, 0.226793393f},
-std::array<float,2>{0.0960169062f, 0.121192753f},
-std::array<float,2>{0.777450025f, 0.675686121f},
-std::array<float,2>{0.352816582f, 0.808958828f},
-std::array<float,2>{0.633933127f, 0.351023942f},
-std::array<float,2>{0.102956802f, 0.25173071f},
-std::array<float,2>{0.77085495f, 0.855286121f},
-std::array<float,2>{0.34888956f, 0.749186218f},
-std::array<float,2>{0.628240585f, 0.0203754157f},
-std::array<float,2>{0.488515705f, 0.151879191f},
-std::array<float,2>{0.516471922f, 0.540798545f},
-std::array<float,2>{0.204500601f, 0.98316735f},
-std::array<float,2>{0.944163144f, 0.437225014f},
-std::array<float,2>{0.284837663f, 0.450929105f},
-std::array<float,2>{0.719536602f, 0.882305562f},
-std::array<float,2>{0.010491495f, 0.59335345f},
-std::array<float,2>{0.840194821f, 0.241161004f},
-std::array<float,2>{0.149365798f, 0.107501149f},
-std::array<float,2>{0.877250195f, 0.667128623f},
-std::array<float,2>{0.391710132f, 0.791124821f},
-std::array<float,2>{0.58155936f, 0.367956907f},
-std::array<float,2>{0.240830749f, 0.402673006f},
-std::array<float,2>{0.979340494f, 0.963872969f},
-std::array<float,2>{0.464835644f, 0.51012373f},
-std::array<float,2>{0.533254802f, 0.180039778f},
-std::array<float,2>{0.316329867f, 0.0407300629f},
-std::array<float,2>{0.685419023f, 0.711553812f},
-std::array<float,2>{0.0866582245f, 0.82430017f},
-std::array<float,2>{0.803349555f, 0.293951452f},
-std::array<float,2>{0.431948632f, 0.334281951f},
-std::array<float,2>{0.617301643f, 0.771587849f},
-std::array<float,2>{0.166477934f, 0.651203215f},
-std::array<float,2>{0.929691195f, 0.0666562468f},
-std::array<float,2>{0.0379064679f, 0.203201637f},
-std::array<float,2>{0.857521534f, 0.604964077f},
-std::array<float,2>{0.264728606f, 0.923161149f},
-std::array<float,2>{0.715122879f, 0.491803288f},
-std::array<float,2>{0.0239334516f, 0.471347839f},
-std::array<float,2>{0.821500719f, 0.911792159f},
-std::array<float,2>{0.301439822f, 0.62265265f},
-std::array<float,2>{0.743170798f, 0.197349802f},
-std::array<float,2>{0.384946227f, 0.0872775167f},
-std::array<float,2>{0.563314497f, 0.629148245f},
-std::array<float,2>{0.139748514f, 0.76163131f},
-std::array<float,2>{0.904840529f, 0.326723784f},
-std::array<float,2>{0.363158822f, 0.307054907f},
-std::array<float,2>{0.647389591f, 0.830636203f},
-std::array<float,2>{0.124277815f, 0.700350106f},
-std::array<float,2>{0.757582724f, 0.0556240529f},
-std::array<float,2>{0.201268584f, 0.162697285f},
-std::array<float,2>{0.957436085f, 0.517686665f},
-std::array<float,2>{0.475848109f, 0.940893173f},
-std::array<float,2>{0.507212758f, 0.387403846f},
-std::array<float,2>{0.180566356f, 0.347126216f},
-std::array<float,2>{0.919672847f, 0.808268011f},
-std::array<float,2>{0.416964173f, 0.675931692f},
-std::array<float,2>{0.60871613f, 0.120455824f},
-std::array<float,2>{0.266056806f, 0.234001726f},
-std::array<float,2>{0.697347522f, 0.564869165f},
-std::array<float,2>{0.0603847429f, 0.893917263f},
-std::array<float,2>{0.864890695f, 0.468296796f},
-std::array<float,2>{0.449413717f, 0.414489508f},
-std::array<float,2>{0.557798088f, 0.993838191f},
-std::array<float,2>{0.222796068f, 0.560321987f},
-std::array<float,2>{0.993158698f, 0.129591748f},
-std::array<float,2>{0.0677993894f, 0.014292419f},
-std::array<float,2>{0.782607198f, 0.723118484f},
-std::array<float,2>{0.341546237f, 0.863039494f},
-std::array<float,2>{0.658886254f, 0.278086126f},
-std::array<float,2>{0.0470095538f, 0.31377098f},
-std::array<float,2>{0.874053776f, 0.753464997f},
-std::array<float,2>{0.278577715f, 0.634513557f},
-std::array<float,2>{0.694348991f, 0.0785462633f},
-std::array<float,2>{0.410631359f, 0.192386582f},
-std::array<float,2>{0.597827494f, 0.615172446f},
-std::array<float,2>{0.172575206f, 0.921832323f},
-std::array<float,2>{0.907696068f, 0.480651647f},
-std::array<float,2>{0.328608751f, 0.382521391f},
-std::array<float,2>{0.6674968f, 0.952424765f},
-std::array<float,2>{0.0734928623f, 0.523921728f},
-std::array<float,2>{0.792212427f, 0.170282945f},
-std::array<float,2>{0.229066178f, 0.0491650738f},
-std::array<float,2>{0.987543702f, 0.693900883f},
-std::array<float,2>{0.443666458f, 0.836419284f},
-std::array<float,2>{0.547647893f, 0.300771058f},
-std::array<float,2>{0.131515563f, 0.459026694f},
-std::array<float,2>{0.898405313f, 0.903635621f},
-std::array<float,2>{0.379396081f, 0.572843254f},
-std::array<float,2>{0.575823188f, 0.223035112f},
-std::array<float,2>{0.311934859f, 0.115807131f},
-std::array<float,2>{0.740550697f, 0.682721198f},
-std::array<float,2>{0.0160959251f, 0.802208424f},
-std::array<float,2>{0.812581658f, 0.357562482f},
-std::array<float,2>{0.478068888f, 0.271712154f},
-std::array<float,2>{0.511880457f, 0.872730196f},
-std::array<float,2>{0.192444757f, 0.733174801f},
-std::array<float,2>{0.968610823f, 0.00244498556f},
-std::array<float,2>{0.111739971f, 0.139700547f},
-std::array<float,2>{0.76086396f, 0.551072717f},
-std::array<float,2>{0.371160209f, 0.985382617f},
-std::array<float,2>{0.651634812f, 0.406889141f},
-std::array<float,2>{0.0828240737f, 0.425842702f},
-std::array<float,2>{0.80950886f, 0.973168314f},
-std::array<float,2>{0.320838898f, 0.532152593f},
-std::array<float,2>{0.674635589f, 0.144727424f},
-std::array<float,2>{0.460901529f, 0.0268141292f},
-std::array<float,2>{0.544478834f, 0.741315126f},
-std::array<float,2>{0.249007314f, 0.851085603f},
-std::array<float,2>{0.973434746f, 0.259955376f},
-std::array<float,2>{0.25027287f, 0.365715265f},
-std::array<float,2>{0.707300007f, 0.78619498f},
-std::array<float,2>{0.0450657383f, 0.65975672f},
-std::array<float,2>{0.844588816f, 0.097355634f},
-std::array<float,2>{0.157554075f, 0.246164978f},
-std::array<float,2>{0.926930487f, 0.580285132f},
-std::array<float,2>{0.424873471f, 0.885824323f},
-std::array<float,2>{0.617168665f, 0.441681623f},
-std::array<float,2>{0.217289656f, 0.285733581f},
-std::array<float,2>{0.948513448f, 0.818290889f},
-std::array<float,2>{0.493905067f, 0.705004036f},
-std::array<float,2>{0.523779571f, 0.032861013f},
-std::array<float,2>{0.357072979f, 0.174424216f},
-std::array<float,2>{0.637887716f, 0.50072515f},
-std::array<float,2>{0.100091152f, 0.956894577f},
-std::array<float,2>{0.774260461f, 0.392347127f},
-std::array<float,2>{0.399702549f, 0.499625504f},
-std::array<float,2>{0.588390231f, 0.929787636f},
-std::array<float,2>{0.145807758f, 0.597691655f},
-std::array<float,2>{0.886012197f, 0.215492055f},
-std::array<float,2>{0.00463827141f, 0.0745056495f},
-std::array<float,2>{0.830572844f, 0.6460917f},
-std::array<float,2>{0.292380452f, 0.776757121f},
-std::array<float,2>{0.732560694f, 0.340188146f},
-std::array<float,2>{0.0330261923f, 0.266447246f},
-std::array<float,2>{0.85325557f, 0.870608389f},
-std::array<float,2>{0.260584712f, 0.729329288f},
-std::array<float,2>{0.711061835f, 0.00610251678f},
-std::array<float,2>{0.434788555f, 0.133714378f},
-std::array<float,2>{0.622968256f, 0.549978495f},
-std::array<float,2>{0.169793501f, 0.989393532f},
-std::array<float,2>{0.937263608f, 0.413752526f},
-std::array<float,2>{0.319560349f, 0.454026043f},
-std::array<float,2>{0.680178046f, 0.901088417f},
-std::array<float,2>{0.0910791308f, 0.57804209f},
-std::array<float,2>{0.799649417f, 0.2191827f},
-std::array<float,2>{0.236402422f, 0.11211589f},
-std::array<float,2>{0.9810642f, 0.686995029f},
-std::array<float,2>{0.46761331f, 0.799222767f},
-std::array<float,2>{0.53847152f, 0.353393137f},
-std::array<float,2>{0.154000953f, 0.378155142f},
-std::array<float,2>{0.881771624f, 0.94748354f},
-std::array<float,2>{0.397041738f, 0.529305696f},
-std::array<float,2>{0.585582137f, 0.164708227f},
-std::array<float,2>{0.288415104f, 0.0534475669f},
-std::array<float,2>{0.722759604f, 0.689151824f},
-std::array<float,2>{0.0145132309f, 0.843217373f},
-std::array<float,2>{0.839518189f, 0.303529084f},
-std::array<float,2>{0.4854559f, 0.318756104f},
-std::array<float,2>{0.521779299f, 0.75520438f},
-std::array<float,2>{0.207434863f, 0.638897121f},
-std::array<float,2>{0.940005839f, 0.0842110887f},
-std::array<float,2>{0.108508654f, 0.187965378f},
-std::array<float,2>{0.769477129f, 0.6124264f},
-std::array<float,2>{0.34584707f, 0.915399373f},
-std::array<float,2>{0.632575512f, 0.478538662f},
-std::array<float,2>{0.0655527711f, 0.495959044f},
-std::array<float,2>{0.788263083f, 0.935539544f},
-std::array<float,2>{0.337846607f, 0.596146703f},
-std::array<float,2>{0.662117839f, 0.212145224f},
-std::array<float,2>{0.447415203f, 0.0725598112f},
-std::array<float,2>{0.560567856f, 0.641215205f},
-std::array<float,2>{0.220382124f, 0.779279649f},
-std::array<float,2>{0.996246934f, 0.339075446f},
-std::array<float,2>{0.273137897f, 0.283590794f},
-std::array<float,2>{0.699439883f, 0.814717233f},
-std::array<float,2>{0.0558107309f, 0.709266663f},
-std::array<float,2>{0.862544537f, 0.0389514938f},
-std::array<float,2>{0.18501386f, 0.179586351f},
-std::array<float,2>{0.915041327f, 0.506989539f},
-std::array<float,2>{0.421290904f, 0.958463132f},
-std::array<float,2>{0.605211318f, 0.394770116f},
-std::array<float,2>{0.198696986f, 0.360083163f},
-std::array<float,2>{0.954856694f, 0.781966388f},
-std::array<float,2>{0.470991075f, 0.663937151f},
-std::array<float,2>{0.502546489f, 0.0996926799f},
-std::array<float,2>{0.366993964f, 0.24256517f},
-std::array<float,2>{0.644512713f, 0.582242489f},
-std::array<float,2>{0.119357407f, 0.887646735f},
-std::array<float,2>{0.750321925f, 0.439503431f},
-std::array<float,2>{0.387037128f, 0.424558669f},
-std::array<float,2>{0.567737579f, 0.969954848f},
-std::array<float,2>{0.133067712f, 0.538414955f},
-std::array<float,2>{0.900678873f, 0.142167956f},
-std::array<float,2>{0.0292860046f, 0.0281281173f},
-std::array<float,2>{0.824876904f, 0.737382293f},
-std::array<float,2>{0.299191892f, 0.845385611f},
-std::array<float,2>{0.74688375f, 0.264293373f},
-std::array<float,2>{0.116057195f, 0.329724014f},
-std::array<float,2>{0.764924526f, 0.766110897f},
-std::array<float,2>{0.369349808f, 0.653195262f},
-std::array<float,2>{0.654837549f, 0.0650787503f},
-std::array<float,2>{0.482386768f, 0.209303886f},
-std::array<float,2>{0.507926345f, 0.605723798f},
-std::array<float,2>{0.188114762f, 0.928128302f},
-std::array<float,2>{0.961993158f, 0.484752715f},
-std::array<float,2>{0.307054877f, 0.40188688f},
-std::array<float,2>{0.73469609f, 0.967397153f},
-std::array<float,2>{0.0233900007f, 0.513000011f},
-std::array<float,2>{0.818693101f, 0.184085429f},
-std::array<float,2>{0.12623097f, 0.0438998342f},
-std::array<float,2>{0.892179191f, 0.716790557f},
-std::array<float,2>{0.378323853f, 0.822927952f},
-std::array<float,2>{0.573388815f, 0.292702049f},
-std::array<float,2>{0.234030634f, 0.447984308f},
-std::array<float,2>{0.99139142f, 0.876531839f},
-std::array<float,2>{0.440204591f, 0.589016736f},
-std::array<float,2>{0.554208279f, 0.237332106f},
-std::array<float,2>{0.334275454f, 0.103120789f},
-std::array<float,2>{0.669498682f, 0.671499431f},
-std::array<float,2>{0.0765019953f, 0.79579705f},
-std::array<float,2>{0.796446621f, 0.371240646f},
-std::array<float,2>{0.408474743f, 0.254283935f},
-std::array<float,2>{0.594678581f, 0.858570397f},
-std::array<float,2>{0.176983163f, 0.744807243f},
-std::array<float,2>{0.911887527f, 0.0179194454f},
-std::array<float,2>{0.0522667654f, 0.155355662f},
-std::array<float,2>{0.867535472f, 0.543313384f},
-std::array<float,2>{0.277321011f, 0.97753948f},
-std::array<float,2>{0.687736332f, 0.431735009f},
-std::array<float,2>{0.00015850873f, 0.418666899f},
-std::array<float,2>{0.833754659f, 0.998168826f},
-std::array<float,2>{0.293637127f, 0.554886162f},
-std::array<float,2>{0.727148473f, 0.125404298f},
-std::array<float,2>{0.402387351f, 0.0100098541f},
-std::array<float,2>{0.590897739f, 0.718913734f},
-std::array<float,2>{0.142215565f, 0.864762008f},
-std::array<float,2>{0.889760673f, 0.275837392f},
-std::array<float,2>{0.353820622f, 0.348623872f},
-std::array<float,2>{0.635043383f, 0.811679363f},
-std::array<float,2>{0.0942761675f, 0.6721766f},
-std::array<float,2>{0.780381083f, 0.124398097f},
-std::array<float,2>{0.213826969f, 0.228535548f},
-std::array<float,2>{0.951520383f, 0.566836119f},
-std::array<float,2>{0.496897787f, 0.895029247f},
-std::array<float,2>{0.529145122f, 0.462857246f},
-std::array<float,2>{0.162173808f, 0.308909118f},
-std::array<float,2>{0.923624277f, 0.833776176f},
-std::array<float,2>{0.428041816f, 0.699089468f},
-std::array<float,2>{0.611883581f, 0.0605438203f},
-std::array<float,2>{0.256153286f, 0.159097448f},
-std::array<float,2>{0.703292906f, 0.523361087f},
-std::array<float,2>{0.0393053591f, 0.943928003f},
-std::array<float,2>{0.85026592f, 0.385794759f},
-std::array<float,2>{0.455819935f, 0.472888649f},
-std::array<float,2>{0.542591155f, 0.907592595f},
-std::array<float,2>{0.243389487f, 0.617951632f},
-std::array<float,2>{0.970707238f, 0.202087507f},
-std::array<float,2>{0.078888543f, 0.0937228501f},
-std::array<float,2>{0.807855844f, 0.627575099f},
-std::array<float,2>{0.326551616f, 0.763889015f},
-std::array<float,2>{0.679450214f, 0.323990434f},
-std::array<float,2>{0.0881400183f, 0.295534551f},
-std::array<float,2>{0.801820993f, 0.826314747f},
-std::array<float,2>{0.314211279f, 0.712967694f},
-std::array<float,2>{0.68575573f, 0.0423024073f},
-std::array<float,2>{0.462073475f, 0.183462247f},
-std::array<float,2>{0.531774461f, 0.508019805f},
-std::array<float,2>{0.239806965f, 0.961865842f},
-std::array<float,2>{0.977294683f, 0.404453456f},
-std::array<float,2>{0.261901975f, 0.489861816f},
-std::array<float,2>{0.717168689f, 0.924423277f},
-std::array<float,2>{0.0366998091f, 0.601999044f},
-std::array<float,2>{0.85687989f, 0.205365479f},
-std::array<float,2>{0.165274397f, 0.0685002953f},
-std::array<float,2>{0.9333148f, 0.649737179f},
-std::array<float,2>{0.43076086f, 0.770644844f},
-std::array<float,2>{0.619355619f, 0.3325755f},
-std::array<float,2>{0.206237495f, 0.434296012f},
-std::array<float,2>{0.942190528f, 0.981336713f},
-std::array<float,2>{0.491657168f, 0.541633368f},
-std::array<float,2>{0.518989146f, 0.149115384f},
-std::array<float,2>{0.349921793f, 0.0228248686f},
-std::array<float,2>{0.625549376f, 0.747065246f},
-std::array<float,2>{0.104830384f, 0.852942467f},
-std::array<float,2>{0.772395194f, 0.252848238f},
-std::array<float,2>{0.392720819f, 0.370760202f},
-std::array<float,2>{0.578281939f, 0.78920424f},
-std::array<float,2>{0.15070349f, 0.66483587f},
-std::array<float,2>{0.875925481f, 0.106131807f},
-std::array<float,2>{0.00830776431f, 0.240165487f},
-std::array<float,2>{0.842854083f, 0.591564536f},
-std::array<float,2>{0.282966852f, 0.87894249f},
-std::array<float,2>{0.721093535f, 0.452541292f},
-std::array<float,2>{0.060772568f, 0.466050655f},
-std::array<float,2>{0.866006196f, 0.892391562f},
-std::array<float,2>{0.268477857f, 0.563319385f},
-std::array<float,2>{0.697047174f, 0.231843367f},
-std::array<float,2>{0.414992958f, 0.117756151f},
-std::array<float,2>{0.605898678f, 0.677821934f},
-std::array<float,2>{0.183425367f, 0.805776358f},
-std::array<float,2>{0.9217152f, 0.345028669f},
-std::array<float,2>{0.342419326f, 0.280241877f},
-std::array<float,2>{0.656750202f, 0.860748112f},
-std::array<float,2>{0.0694117472f, 0.726405382f},
-std::array<float,2>{0.783429444f, 0.013666926f},
-std::array<float,2>{0.225360096f, 0.13236171f},
-std::array<float,2>{0.995253801f, 0.560965359f},
-std::array<float,2>{0.452205122f, 0.994487703f},
-std::array<float,2>{0.555606663f, 0.416170388f},
-std::array<float,2>{0.136960715f, 0.325167358f},
-std::array<float,2>{0.902452648f, 0.758733213f},
-std::array<float,2>{0.384495109f, 0.632433891f},
-std::array<float,2>{0.565718412f, 0.0879858136f},
-std::array<float,2>{0.303838372f, 0.195725888f},
-std::array<float,2>{0.745718241f, 0.624077916f},
-std::array<float,2>{0.0270228479f, 0.913747251f},
-std::array<float,2>{0.823411286f, 0.469949514f},
-std::array<float,2>{0.473906755f, 0.38931939f},
-std::array<float,2>{0.504664361f, 0.938948691f},
-std::array<float,2>{0.200375229f, 0.516343772f},
-std::array<float,2>{0.959016562f, 0.161482036f},
-std::array<float,2>{0.121611714f, 0.0574169271f},
-std::array<float,2>{0.755231977f, 0.701235473f},
-std::array<float,2>{0.360518903f, 0.829911053f},
-std::array<float,2>{0.646044791f, 0.306385487f},
-std::array<float,2>{0.019477319f, 0.356820375f},
-std::array<float,2>{0.816166997f, 0.803185642f},
-std::array<float,2>{0.30880326f, 0.681196809f},
-std::array<float,2>{0.739350379f, 0.113600768f},
-std::array<float,2>{0.382513285f, 0.226163611f},
-std::array<float,2>{0.577125728f, 0.570598245f},
-std::array<float,2>{0.129171506f, 0.905268908f},
-std::array<float,2>{0.895181835f, 0.458315849f},
-std::array<float,2>{0.374650657f, 0.409416974f},
-std::array<float,2>{0.649228394f, 0.98649466f},
-std::array<float,2>{0.10951867f, 0.553079486f},
-std::array<float,2>{0.758755505f, 0.137953684f},
-std::array<float,2>{0.194705889f, 0.00104782649f},
-std::array<float,2>{0.965670824f, 0.731322765f},
-std::array<float,2>{0.480342537f, 0.87306869f},
-std::array<float,2>{0.515489459f, 0.269556195f},
-std::array<float,2>{0.174457759f, 0.484268308f},
-std::array<float,2>{0.909734964f, 0.918321192f},
-std::array<float,2>{0.413556129f, 0.615987778f},
-std::array<float,2>{0.60061276f, 0.194322377f},
-std::array<float,2>{0.281220466f, 0.0818926916f},
-std::array<float,2>{0.693155766f, 0.636157572f},
-std::array<float,2>{0.0494604036f, 0.75070554f},
-std::array<float,2>{0.872977078f, 0.315621227f},
-std::array<float,2>{0.442421734f, 0.297717094f},
-std::array<float,2>{0.549316108f, 0.839461207f},
-std::array<float,2>{0.228260428f, 0.69292593f},
-std::array<float,2>{0.984529316f, 0.048087053f},
-std::array<float,2>{0.0720121711f, 0.168881699f},
-std::array<float,2>{0.790657818f, 0.525919437f},
-std::array<float,2>{0.331772625f, 0.949687839f},
-std::array<float,2>{0.664800107f, 0.380673081f},
-std::array<float,2>{0.0982506424f, 0.39277333f},
-std::array<float,2>{0.776821017f, 0.954616845f},
-std::array<float,2>{0.357705325f, 0.502975404f},
-std::array<float,2>{0.639165938f, 0.1732568f},
-std::array<float,2>{0.495533079f, 0.0351322964f},
-std::array<float,2>{0.526746631f, 0.705760479f},
-std::array<float,2>{0.216440976f, 0.819753349f},
-std::array<float,2>{0.946272433f, 0.288844198f},
-std::array<float,2>{0.290606409f, 0.34290421f},
-std::array<float,2>{0.731006742f, 0.774167895f},
-std::array<float,2>{0.00725557981f, 0.646837115f},
-std::array<float,2>{0.829086244f, 0.0765039474f},
-std::array<float,2>{0.148414209f, 0.21750623f},
-std::array<float,2>{0.883276701f, 0.600629508f},
-std::array<float,2>{0.401745588f, 0.933108747f},
-std::array<float,2>{0.587612987f, 0.496551782f},
-std::array<float,2>{0.246881127f, 0.25931561f},
-std::array<float,2>{0.975918353f, 0.849121153f},
-std::array<float,2>{0.458166331f, 0.738828719f},
-std::array<float,2>{0.54547745f, 0.0241794344f},
-std::array<float,2>{0.324213445f, 0.147990704f},
-std::array<float,2>{0.672258139f, 0.534301817f},
-std::array<float,2>{0.0839959234f, 0.975665569f},
-std::array<float,2>{0.810651779f, 0.429494679f},
-std::array<float,2>{0.422009408f, 0.444689006f},
-std::array<float,2>{0.614343345f, 0.883583188f},
-std::array<float,2>{0.15841946f, 0.578137219f},
-std::array<float,2>{0.928271472f, 0.248813912f},
-std::array<float,2>{0.0433441177f, 0.0952743888f},
-std::array<float,2>{0.846431375f, 0.65756619f},
-std::array<float,2>{0.252036154f, 0.788281977f},
-std::array<float,2>{0.710280597f, 0.364411652f},
-std::array<float,2>{0.0296140108f, 0.264825791f},
-std::array<float,2>{0.827721894f, 0.844198227f},
-std::array<float,2>{0.29876399f, 0.737046063f},
-std::array<float,2>{0.749202609f, 0.0283485353f},
-std::array<float,2>{0.38878113f, 0.140948877f},
-std::array<float,2>{0.569643438f, 0.537923276f},
-std::array<float,2>{0.134769917f, 0.969660044f},
-std::array<float,2>{0.898769379f, 0.425304443f},
-std::array<float,2>{0.364326566f, 0.44089815f},
-std::array<float,2>{0.641360164f, 0.888198197f},
-std::array<float,2>{0.117590703f, 0.583728015f},
-std::array<float,2>{0.752131104f, 0.243688941f},
-std::array<float,2>{0.197244793f, 0.101330854f},
-std::array<float,2>{0.956529081f, 0.662971973f},
-std::array<float,2>{0.469718099f, 0.783109248f},
-std::array<float,2>{0.500270724f, 0.360885292f},
-std::array<float,2>{0.18726863f, 0.395894974f},
-std::array<float,2>{0.917599916f, 0.957672596f},
-std::array<float,2>{0.419809103f, 0.506363392f},
-std::array<float,2>{0.602244198f, 0.177767336f},
-std::array<float,2>{0.271121353f, 0.0374044403f},
-std::array<float,2>{0.702212989f, 0.710618913f},
-std::array<float,2>{0.057600297f, 0.816328287f},
-std::array<float,2>{0.859850109f, 0.284562021f},
-std::array<float,2>{0.445997655f, 0.338456273f},
-std::array<float,2>{0.558641195f, 0.777736247f},
-std::array<float,2>{0.22135146f, 0.642222047f},
-std::array<float,2>{0.999883175f, 0.074087359f},
-std::array<float,2>{0.0640931726f, 0.211801261f},
-std::array<float,2>{0.786054492f, 0.597346365f},
-std::array<float,2>{0.338869721f, 0.934281647f},
-std::array<float,2>{0.661593735f, 0.494300842f},
-std::array<float,2>{0.106001586f, 0.480227828f},
-std::array<float,2>{0.766421139f, 0.914882839f},
-std::array<float,2>{0.344600916f, 0.611953676f},
-std::array<float,2>{0.629075468f, 0.18853882f},
-std::array<float,2>{0.488066584f, 0.0855414122f},
-std::array<float,2>{0.521037936f, 0.639950931f},
-std::array<float,2>{0.2102658f, 0.754496276f},
-std::array<float,2>{0.939062476f, 0.319794118f},
-std::array<float,2>{0.286946803f, 0.304091513f},
-std::array<float,2>{0.725865126f, 0.841942072f},
-std::array<float,2>{0.0124964947f, 0.688040674f},
-std::array<float,2>{0.83750689f, 0.0542831235f},
-std::array<float,2>{0.154414341f, 0.165574417f},
-std::array<float,2>{0.879802227f, 0.530794263f},
-std::array<float,2>{0.395028979f, 0.948987722f},
-std::array<float,2>{0.582468867f, 0.377091765f},
-std::array<float,2>{0.234754682f, 0.351934254f},
-std::array<float,2>{0.98342824f, 0.800480366f},
-std::array<float,2>{0.465404004f, 0.686077595f},
-std::array<float,2>{0.535387218f, 0.112636678f},
-std::array<float,2>{0.318273425f, 0.219818264f},
-std::array<float,2>{0.682590127f, 0.5766958f},
-std::array<float,2>{0.0923624709f, 0.902323604f},
-std::array<float,2>{0.797740102f, 0.454761446f},
-std::array<float,2>{0.43634063f, 0.41280359f},
-std::array<float,2>{0.624525309f, 0.988711596f},
-std::array<float,2>{0.17100279f, 0.549744964f},
-std::array<float,2>{0.934884071f, 0.13380155f},
-std::array<float,2>{0.0334636979f, 0.00744342618f},
-std::array<float,2>{0.855374217f, 0.730307162f},
-std::array<float,2>{0.258845598f, 0.869303405f},
-std::array<float,2>{0.714086354f, 0.266861558f},
-std::array<float,2>{0.0801977441f, 0.322786033f},
-std::array<float,2>{0.806072533f, 0.765478849f},
-std::array<float,2>{0.325657457f, 0.628477454f},
-std::array<float,2>{0.677577376f, 0.0926108584f},
-std::array<float,2>{0.453769177f, 0.202886507f},
-std::array<float,2>{0.540501058f, 0.61885649f},
-std::array<float,2>{0.24426277f, 0.906566083f},
-std::array<float,2>{0.969192326f, 0.474182755f},
-std::array<float,2>{0.254157335f, 0.384817243f},
-std::array<float,2>{0.706963837f, 0.945088208f},
-std::array<float,2>{0.042055048f, 0.522027433f},
-std::array<float,2>{0.847943187f, 0.159697592f},
-std::array<float,2>{0.161150292f, 0.0590729676f},
-std::array<float,2>{0.925773442f, 0.697840929f},
-std::array<float,2>{0.426318467f, 0.832428575f},
-std::array<float,2>{0.610013187f, 0.309645176f},
-std::array<float,2>{0.211550534f, 0.461650044f},
-std::array<float,2>{0.949819982f, 0.895566285f},
-std::array<float,2>{0.499839514f, 0.567793369f},
-std::array<float,2>{0.530777335f, 0.23033376f},
-std::array<float,2>{0.352476209f, 0.123141073f},
-std::array<float,2>{0.633492053f, 0.673713923f},
-std::array<float,2>{0.0968305767f, 0.810603261f},
-std::array<float,2>{0.778545856f, 0.349110961f},
-std::array<float,2>{0.404899985f, 0.276637167f},
-std::array<float,2>{0.592689395f, 0.863284528f},
-std::array<float,2>{0.143332362f, 0.719816744f},
-std::array<float,2>{0.887736678f, 0.011067979f},
-std::array<float,2>{0.00390003878f, 0.126687109f},
-std::array<float,2>{0.835914254f, 0.556573451f},
-std::array<float,2>{0.296568394f, 0.999424696f},
-std::array<float,2>{0.729499996f, 0.419002265f},
-std::array<float,2>{0.0546766259f, 0.432800055f},
-std::array<float,2>{0.870133758f, 0.976879716f},
-std::array<float,2>{0.273793757f, 0.544301569f},
-std::array<float,2>{0.690557778f, 0.155215114f},
-std::array<float,2>{0.407628268f, 0.0194560997f},
-std::array<float,2>{0.59585011f, 0.745191753f},
-std::array<float,2>{0.17787993f, 0.858258486f},
-std::array<float,2>{0.912299931f, 0.255405486f},
-std::array<float,2>{0.33371231f, 0.37256071f},
-std::array<float,2>{0.670756876f, 0.796503663f},
-std::array<float,2>{0.0747480467f, 0.670815885f},
-std::array<float,2>{0.793445647f, 0.10176833f},
-std::array<float,2>{0.231128901f, 0.236747175f},
-std::array<float,2>{0.989197016f, 0.588617623f},
-std::array<float,2>{0.438906848f, 0.875348032f},
-std::array<float,2>{0.551357985f, 0.449149281f},
-std::array<float,2>{0.127828285f, 0.291528851f},
-std::array<float,2>{0.893054903f, 0.82366854f},
-std::array<float,2>{0.376175106f, 0.715629041f},
-std::array<float,2>{0.571704507f, 0.04412755f},
-std::array<float,2>{0.306459099f, 0.184917659f},
-std::array<float,2>{0.737791896f, 0.512319326f},
-std::array<float,2>{0.0209246408f, 0.968329906f},
-std::array<float,2>{0.81756258f, 0.400849938f},
-std::array<float,2>{0.483798802f, 0.485919029f},
-std::array<float,2>{0.510182917f, 0.929097652f},
-std::array<float,2>{0.190715134f, 0.607025385f},
-std::array<float,2>{0.964472592f, 0.210609719f},
-std::array<float,2>{0.113706052f, 0.0663724989f},
-std::array<float,2>{0.762230694f, 0.654227555f},
-std::array<float,2>{0.36906296f, 0.767361104f},
-std::array<float,2>{0.652819753f, 0.32830891f},
-std::array<float,2>{0.123368487f, 0.305426627f},
-std::array<float,2>{0.756834686f, 0.82891959f},
-std::array<float,2>{0.361947864f, 0.702495635f},
-std::array<float,2>{0.648339629f, 0.0583343469f},
-std::array<float,2>{0.474801898f, 0.16052103f},
-std::array<float,2>{0.506004274f, 0.517497957f},
-std::array<float,2>{0.202776626f, 0.93820101f},
-std::array<float,2>{0.958731532f, 0.390408069f},
-std::array<float,2>{0.301765412f, 0.469005734f},
-std::array<float,2>{0.743030429f, 0.913011849f},
-std::array<float,2>{0.0251977947f, 0.623527408f},
-std::array<float,2>{0.820656538f, 0.196818918f},
-std::array<float,2>{0.138746351f, 0.0895836502f},
-std::array<float,2>{0.905634642f, 0.631061137f},
-std::array<float,2>{0.386647522f, 0.75927639f},
-std::array<float,2>{0.564008832f, 0.325929523f},
-std::array<float,2>{0.224271744f, 0.417304397f},
-std::array<float,2>{0.993454516f, 0.995671451f},
-std::array<float,2>{0.450991839f, 0.562316597f},
-std::array<float,2>{0.556900501f, 0.131086439f},
-std::array<float,2>{0.340720713f, 0.0119731976f},
-std::array<float,2>{0.659945965f, 0.724894702f},
-std::array<float,2>{0.0668720379f, 0.859834492f},
-std::array<float,2>{0.782005548f, 0.281148523f},
-std::array<float,2>{0.41739428f, 0.34379214f},
-std::array<float,2>{0.607713103f, 0.805065453f},
-std::array<float,2>{0.180779278f, 0.679077804f},
-std::array<float,2>{0.918784201f, 0.118529946f},
-std::array<float,2>{0.0588572025f, 0.230578542f},
-std::array<float,2>{0.863524497f, 0.564214051f},
-std::array<float,2>{0.266803116f, 0.891088307f},
-std::array<float,2>{0.698994398f, 0.465130389f},
-std::array<float,2>{0.0115216132f, 0.451990306f},
-std::array<float,2>{0.841033995f, 0.88073355f},
-std::array<float,2>{0.284016401f, 0.589981794f},
-std::array<float,2>{0.719978392f, 0.238654926f},
-std::array<float,2>{0.391400009f, 0.106674761f},
-std::array<float,2>{0.580541432f, 0.665174127f},
-std::array<float,2>{0.149753675f, 0.790112436f},
-std::array<float,2>{0.878816903f, 0.37006858f},
-std::array<float,2>{0.348043889f, 0.252965659f},
-std::array<float,2>{0.627515078f, 0.85157001f},
-std::array<float,2>{0.102316327f, 0.747219205f},
-std::array<float,2>{0.769900382f, 0.0214972179f},
-std::array<float,2>{0.203544155f, 0.150369078f},
-std::array<float,2>{0.94483465f, 0.542441368f},
-std::array<float,2>{0.489832938f, 0.982412994f},
-std::array<float,2>{0.517439604f, 0.435300171f},
-std::array<float,2>{0.16756776f, 0.333438575f},
-std::array<float,2>{0.931136489f, 0.769710422f},
-std::array<float,2>{0.433144003f, 0.649088264f},
-std::array<float,2>{0.618974507f, 0.0700573623f},
-std::array<float,2>{0.264375389f, 0.206765592f},
-std::array<float,2>{0.716359317f, 0.602862775f},
-std::array<float,2>{0.0381499827f, 0.925365746f},
-std::array<float,2>{0.859374583f, 0.488539219f},
-std::array<float,2>{0.46292448f, 0.405503929f},
-std::array<float,2>{0.534253955f, 0.962300718f},
-std::array<float,2>{0.242054656f, 0.5096699f},
-std::array<float,2>{0.979539335f, 0.182446018f},
-std::array<float,2>{0.0877563655f, 0.0412549488f},
-std::array<float,2>{0.804045558f, 0.713937163f},
-std::array<float,2>{0.315330267f, 0.827573121f},
-std::array<float,2>{0.683787167f, 0.296855658f},
-std::array<float,2>{0.046800945f, 0.363513917f},
-std::array<float,2>{0.845443428f, 0.787159741f},
-std::array<float,2>{0.251196414f, 0.656604826f},
-std::array<float,2>{0.708912075f, 0.0943078697f},
-std::array<float,2>{0.424045682f, 0.249282241f},
-std::array<float,2>{0.615706265f, 0.579237401f},
-std::array<float,2>{0.156608596f, 0.884637654f},
-std::array<float,2>{0.926571846f, 0.4433873f},
-std::array<float,2>{0.321907699f, 0.428119838f},
-std::array<float,2>{0.674910605f, 0.975121856f},
-std::array<float,2>{0.0839025006f, 0.533485413f},
-std::array<float,2>{0.810052872f, 0.147162259f},
-std::array<float,2>{0.24917987f, 0.0252561513f},
-std::array<float,2>{0.974388957f, 0.73987788f},
-std::array<float,2>{0.459103525f, 0.848273158f},
-std::array<float,2>{0.543734491f, 0.258101374f},
-std::array<float,2>{0.145501658f, 0.497471601f},
-std::array<float,2>{0.885421157f, 0.931657732f},
-std::array<float,2>{0.398462862f, 0.60032171f},
-std::array<float,2>{0.589140177f, 0.21874851f},
-std::array<float,2>{0.291312665f, 0.0777132884f},
-std::array<float,2>{0.73388499f, 0.647901714f},
-std::array<float,2>{0.00545714749f, 0.775133133f},
-std::array<float,2>{0.831849873f, 0.342687666f},
-std::array<float,2>{0.492429137f, 0.287775278f},
-std::array<float,2>{0.524893165f, 0.818439901f},
-std::array<float,2>{0.218210056f, 0.706813097f},
-std::array<float,2>{0.94780302f, 0.0336967744f},
-std::array<float,2>{0.100672878f, 0.171875998f},
-std::array<float,2>{0.774616301f, 0.502639771f},
-std::array<float,2>{0.355851501f, 0.953846812f},
-std::array<float,2>{0.637133002f, 0.393831551f},
-std::array<float,2>{0.0724317282f, 0.379344553f},
-std::array<float,2>{0.79103893f, 0.950424016f},
-std::array<float,2>{0.329151481f, 0.527038276f},
-std::array<float,2>{0.666304469f, 0.16961132f},
-std::array<float,2>{0.44514963f, 0.0476019233f},
-std::array<float,2>{0.54795593f, 0.692156255f},
-std::array<float,2>{0.229630917f, 0.838808596f},
-std::array<float,2>{0.986385107f, 0.298326164f},
-std::array<float,2>{0.277913153f, 0.314800978f},
-std::array<float,2>{0.693507254f, 0.75141716f},
-std::array<float,2>{0.0481255464f, 0.634832442f},
-std::array<float,2>{0.873580933f, 0.0809192359f},
-std::array<float,2>{0.173770264f, 0.194984496f},
-std::array<float,2>{0.906664789f, 0.616772592f},
-std::array<float,2>{0.411700785f, 0.919008553f},
-std::array<float,2>{0.599194169f, 0.482812792f},
-std::array<float,2>{0.192131981f, 0.271343917f},
-std::array<float,2>{0.967008948f, 0.874752343f},
-std::array<float,2>{0.477455527f, 0.731948137f},
-std::array<float,2>{0.513138473f, 0.000870107033f},
-std::array<float,2>{0.372631401f, 0.136921212f},
-std::array<float,2>{0.650993705f, 0.554244936f},
-std::array<float,2>{0.112386674f, 0.987575054f},
-std::array<float,2>{0.759943187f, 0.408233345f},
-std::array<float,2>{0.38082853f, 0.457967967f},
-std::array<float,2>{0.574496746f, 0.905872345f},
-std::array<float,2>{0.132652313f, 0.572018385f},
-std::array<float,2>{0.897270203f, 0.224619076f},
-std::array<float,2>{0.0167287905f, 0.114765584f},
-std::array<float,2>{0.813771427f, 0.680006266f},
-std::array<float,2>{0.310928911f, 0.804509819f},
-std::array<float,2>{0.741232097f, 0.355596662f},
-std::array<float,2>{0.0555473231f, 0.282077968f},
-std::array<float,2>{0.862261593f, 0.812834501f},
-std::array<float,2>{0.271910548f, 0.707966805f},
-std::array<float,2>{0.700535297f, 0.0364219584f},
-std::array<float,2>{0.420437723f, 0.176905081f},
-std::array<float,2>{0.603585422f, 0.50545305f},
-std::array<float,2>{0.184368715f, 0.960852385f},
-std::array<float,2>{0.914817631f, 0.397972822f},
-std::array<float,2>{0.336911291f, 0.492550105f},
-std::array<float,2>{0.663639724f, 0.935657024f},
-std::array<float,2>{0.0653223097f, 0.594774783f},
-std::array<float,2>{0.787362933f, 0.214455962f},
-std::array<float,2>{0.21949631f, 0.0721359029f},
-std::array<float,2>{0.997330785f, 0.643605053f},
-std::array<float,2>{0.449140668f, 0.780510247f},
-std::array<float,2>{0.561549664f, 0.336428344f},
-std::array<float,2>{0.134199977f, 0.422406971f},
-std::array<float,2>{0.901689231f, 0.972535551f},
-std::array<float,2>{0.387883186f, 0.536549687f},
-std::array<float,2>{0.566678941f, 0.144262716f},
-std::array<float,2>{0.300438225f, 0.0302945934f},
-std::array<float,2>{0.747151315f, 0.73575747f},
-std::array<float,2>{0.0277444404f, 0.84670037f},
-std::array<float,2>{0.825256765f, 0.262293875f},
-std::array<float,2>{0.472309291f, 0.363043845f},
-std::array<float,2>{0.503495276f, 0.78439796f},
-std::array<float,2>{0.197785616f, 0.660625696f},
-std::array<float,2>{0.953329146f, 0.0982970223f},
-std::array<float,2>{0.121054061f, 0.244264796f},
-std::array<float,2>{0.751331091f, 0.585731089f},
-std::array<float,2>{0.365786135f, 0.89052844f},
-std::array<float,2>{0.643111527f, 0.438319713f},
-std::array<float,2>{0.0899689198f, 0.455963224f},
-std::array<float,2>{0.800667882f, 0.898517072f},
-std::array<float,2>{0.319193602f, 0.575555742f},
-std::array<float,2>{0.681620181f, 0.221838668f},
-std::array<float,2>{0.468644559f, 0.11005459f},
-std::array<float,2>{0.537445784f, 0.68385762f},
-std::array<float,2>{0.237655804f, 0.798656344f},
-std::array<float,2>{0.981674194f, 0.353959501f},
-std::array<float,2>{0.261453211f, 0.268475443f},
-std::array<float,2>{0.712759256f, 0.867960989f},
-std::array<float,2>{0.0314442702f, 0.727379739f},
-std::array<float,2>{0.85190928f, 0.00557591673f},
-std::array<float,2>{0.168714792f, 0.135539025f},
-std::array<float,2>{0.935884595f, 0.546931148f},
-std::array<float,2>{0.434020758f, 0.991576433f},
-std::array<float,2>{0.62122792f, 0.410653144f},
-std::array<float,2>{0.208485603f, 0.317323923f},
-std::array<float,2>{0.940776944f, 0.756767571f},
-std::array<float,2>{0.484439641f, 0.638653755f},
-std::array<float,2>{0.523024023f, 0.0830572844f},
-std::array<float,2>{0.347240925f, 0.189619333f},
-std::array<float,2>{0.631746233f, 0.609584212f},
-std::array<float,2>{0.107815407f, 0.917636275f},
-std::array<float,2>{0.767744362f, 0.477104992f},
-std::array<float,2>{0.398429245f, 0.376935273f},
-std::array<float,2>{0.584829271f, 0.945338964f},
-std::array<float,2>{0.15252988f, 0.528752208f},
-std::array<float,2>{0.882121921f, 0.166988909f},
-std::array<float,2>{0.0146933962f, 0.052339945f},
-std::array<float,2>{0.838857949f, 0.690642416f},
-std::array<float,2>{0.287794739f, 0.84133631f},
-std::array<float,2>{0.724208295f, 0.301497936f},
-std::array<float,2>{0.094997935f, 0.350121826f},
-std::array<float,2>{0.779875398f, 0.809825659f},
-std::array<float,2>{0.354495764f, 0.67426765f},
-std::array<float,2>{0.635824978f, 0.122974671f},
-std::array<float,2>{0.497734308f, 0.228238732f},
-std::array<float,2>{0.528137147f, 0.56981039f},
-std::array<float,2>{0.214550421f, 0.896879435f},
-std::array<float,2>{0.952222228f, 0.463429421f},
-std::array<float,2>{0.294141263f, 0.420826584f},
-std::array<float,2>{0.728248119f, 0.997645378f},
-std::array<float,2>{0.00179574557f, 0.556696296f},
-std::array<float,2>{0.832056642f, 0.127158344f},
-std::array<float,2>{0.140852064f, 0.00904518273f},
-std::array<float,2>{0.888764501f, 0.721939206f},
-std::array<float,2>{0.404074669f, 0.867181122f},
-std::array<float,2>{0.590230405f, 0.275243729f},
-std::array<float,2>{0.242254913f, 0.47575736f},
-std::array<float,2>{0.971896708f, 0.909479022f},
-std::array<float,2>{0.456135333f, 0.620297849f},
-std::array<float,2>{0.541064501f, 0.200427815f},
-std::array<float,2>{0.327698886f, 0.090927057f},
-std::array<float,2>{0.678050995f, 0.625404596f},
-std::array<float,2>{0.07921087f, 0.763183177f},
-std::array<float,2>{0.807454586f, 0.321246833f},
-std::array<float,2>{0.428996831f, 0.31170693f},
-std::array<float,2>{0.612902582f, 0.835386038f},
-std::array<float,2>{0.163237646f, 0.696584821f},
-std::array<float,2>{0.922726035f, 0.0607216321f},
-std::array<float,2>{0.040977966f, 0.158111513f},
-std::array<float,2>{0.850702465f, 0.519806564f},
-std::array<float,2>{0.257409424f, 0.943336785f},
-std::array<float,2>{0.704179227f, 0.382979125f},
-std::array<float,2>{0.0218966696f, 0.399715215f},
-std::array<float,2>{0.819489241f, 0.964993f},
-std::array<float,2>{0.307812721f, 0.514639556f},
-std::array<float,2>{0.735976279f, 0.18720752f},
-std::array<float,2>{0.377798259f, 0.0462767519f},
-std::array<float,2>{0.573170543f, 0.718214571f},
-std::array<float,2>{0.125101894f, 0.821236372f},
-std::array<float,2>{0.890669107f, 0.289277971f},
-std::array<float,2>{0.370955825f, 0.330223382f},
-std::array<float,2>{0.655877292f, 0.767691374f},
-std::array<float,2>{0.11702136f, 0.654885948f},
-std::array<float,2>{0.763969362f, 0.0643612891f},
-std::array<float,2>{0.18857719f, 0.208499193f},
-std::array<float,2>{0.961578429f, 0.60857445f},
-std::array<float,2>{0.481250018f, 0.926853299f},
-std::array<float,2>{0.509763658f, 0.48722142f},
-std::array<float,2>{0.176686168f, 0.257282436f},
-std::array<float,2>{0.911092401f, 0.856586695f},
-std::array<float,2>{0.409566492f, 0.743108511f},
-std::array<float,2>{0.595045745f, 0.0157609005f},
-std::array<float,2>{0.276201218f, 0.153892189f},
-std::array<float,2>{0.689342737f, 0.545338273f},
-std::array<float,2>{0.0509209894f, 0.979128718f},
-std::array<float,2>{0.868541718f, 0.430121511f},
-std::array<float,2>{0.441134483f, 0.445960373f},
-std::array<float,2>{0.553247869f, 0.877618313f},
-std::array<float,2>{0.23276341f, 0.587334394f},
-std::array<float,2>{0.991191268f, 0.234989837f},
-std::array<float,2>{0.0775224194f, 0.103975892f},
-std::array<float,2>{0.795161545f, 0.668545663f},
-std::array<float,2>{0.335489005f, 0.793715477f},
-std::array<float,2>{0.668552935f, 0.373191595f},
-std::array<float,2>{0.0689133331f, 0.278981268f},
-std::array<float,2>{0.784718275f, 0.862248361f},
-std::array<float,2>{0.343625039f, 0.724500716f},
-std::array<float,2>{0.657519758f, 0.0148307262f},
-std::array<float,2>{0.451291591f, 0.129965201f},
-std::array<float,2>{0.556354463f, 0.558966637f},
-std::array<float,2>{0.226538345f, 0.993018031f},
-std::array<float,2>{0.994372487f, 0.415439278f},
-std::array<float,2>{0.269432485f, 0.466971815f},
-std::array<float,2>{0.695915401f, 0.893380821f},
-std::array<float,2>{0.0624003746f, 0.566375196f},
-std::array<float,2>{0.866335094f, 0.23247239f},
-std::array<float,2>{0.181825906f, 0.119653918f},
-std::array<float,2>{0.920720935f, 0.677024066f},
-std::array<float,2>{0.416008353f, 0.806869864f},
-std::array<float,2>{0.607136548f, 0.346091092f},
-std::array<float,2>{0.199338794f, 0.388497293f},
-std::array<float,2>{0.960157752f, 0.940418065f},
-std::array<float,2>{0.473217547f, 0.518763602f},
-std::array<float,2>{0.505331993f, 0.163434952f},
-std::array<float,2>{0.359528661f, 0.0562362932f},
-std::array<float,2>{0.644647896f, 0.700076818f},
-std::array<float,2>{0.122985981f, 0.831497967f},
-std::array<float,2>{0.754220486f, 0.308555067f},
-std::array<float,2>{0.383189738f, 0.327831089f},
-std::array<float,2>{0.564913809f, 0.760693789f},
-std::array<float,2>{0.137901768f, 0.630295634f},
-std::array<float,2>{0.903905571f, 0.0862160698f},
-std::array<float,2>{0.0259886067f, 0.198623776f},
-std::array<float,2>{0.82263118f, 0.621885121f},
-std::array<float,2>{0.303633362f, 0.91058141f},
-std::array<float,2>{0.744360864f, 0.472341388f},
-std::array<float,2>{0.035443496f, 0.490378648f},
-std::array<float,2>{0.856428504f, 0.922549009f},
-std::array<float,2>{0.263641894f, 0.603742123f},
-std::array<float,2>{0.718397677f, 0.204643697f},
-std::array<float,2>{0.43041113f, 0.0679240078f},
-std::array<float,2>{0.620800376f, 0.651616991f},
-std::array<float,2>{0.164983511f, 0.772497296f},
-std::array<float,2>{0.931697667f, 0.335854411f},
-std::array<float,2>{0.3125889f, 0.293043286f},
-std::array<float,2>{0.686545074f, 0.825379074f},
-std::array<float,2>{0.0894203186f, 0.71267575f},
-std::array<float,2>{0.801416874f, 0.0391354561f},
-std::array<float,2>{0.23900941f, 0.180753082f},
-std::array<float,2>{0.977951705f, 0.511115432f},
-std::array<float,2>{0.461230129f, 0.963407993f},
-std::array<float,2>{0.532644391f, 0.403352857f},
-std::array<float,2>{0.151779488f, 0.369075716f},
-std::array<float,2>{0.876614511f, 0.79288882f},
-std::array<float,2>{0.394293368f, 0.666612983f},
-std::array<float,2>{0.579278648f, 0.109349817f},
-std::array<float,2>{0.281934887f, 0.241841316f},
-std::array<float,2>{0.722453296f, 0.592374742f},
-std::array<float,2>{0.00954106171f, 0.881169379f},
-std::array<float,2>{0.842257261f, 0.449723452f},
-std::array<float,2>{0.491134614f, 0.435921937f},
-std::array<float,2>{0.517655253f, 0.984093547f},
-std::array<float,2>{0.205137581f, 0.539723516f},
-std::array<float,2>{0.94301194f, 0.150921136f},
-std::array<float,2>{0.104197338f, 0.0209027827f},
-std::array<float,2>{0.773309708f, 0.748919725f},
-std::array<float,2>{0.351469576f, 0.854022026f},
-std::array<float,2>{0.626219213f, 0.25024569f},
-std::array<float,2>{0.00651296275f, 0.341533303f},
-std::array<float,2>{0.829531252f, 0.77555722f},
-std::array<float,2>{0.289514542f, 0.645116687f},
-std::array<float,2>{0.73191756f, 0.075871177f},
-std::array<float,2>{0.40041545f, 0.216058746f},
-std::array<float,2>{0.585978806f, 0.59933871f},
-std::array<float,2>{0.147068247f, 0.931188822f},
-std::array<float,2>{0.884468019f, 0.498157382f},
-std::array<float,2>{0.359027326f, 0.390859544f},
-std::array<float,2>{0.639720738f, 0.955263734f},
-std::array<float,2>{0.0987557545f, 0.501871109f},
-std::array<float,2>{0.775650918f, 0.175685972f},
-std::array<float,2>{0.215431497f, 0.0315732881f},
-std::array<float,2>{0.946873844f, 0.703960121f},
-std::array<float,2>{0.494651496f, 0.816806853f},
-std::array<float,2>{0.526295125f, 0.286150157f},
-std::array<float,2>{0.159639433f, 0.442931861f},
-std::array<float,2>{0.929405272f, 0.884982049f},
-std::array<float,2>{0.423200637f, 0.581269979f},
-std::array<float,2>{0.614208221f, 0.247228444f},
-std::array<float,2>{0.253382057f, 0.0958854854f},
-std::array<float,2>{0.70936656f, 0.658901215f},
-std::array<float,2>{0.0446248613f, 0.785275161f},
-std::array<float,2>{0.847496808f, 0.36650157f},
-std::array<float,2>{0.457065493f, 0.260986239f},
-std::array<float,2>{0.546183527f, 0.850386202f},
-std::array<float,2>{0.247848019f, 0.741121471f},
-std::array<float,2>{0.974713981f, 0.0255935621f},
-std::array<float,2>{0.0859329328f, 0.145690173f},
-std::array<float,2>{0.811873078f, 0.533003211f},
-std::array<float,2>{0.322507113f, 0.973940611f},
-std::array<float,2>{0.672852755f, 0.426934987f},
-std::array<float,2>{0.110805802f, 0.407854766f},
-std::array<float,2>{0.758860946f, 0.985051334f},
-std::array<float,2>{0.373755634f, 0.552429855f},
-std::array<float,2>{0.649709404f, 0.139336482f},
-std::array<float,2>{0.478937268f, 0.00340932584f},
-std::array<float,2>{0.513833106f, 0.73407042f},
-std::array<float,2>{0.193932429f, 0.871484935f},
-std::array<float,2>{0.966427922f, 0.27298826f},
-std::array<float,2>{0.310140073f, 0.358881593f},
-std::array<float,2>{0.739044607f, 0.800842404f},
-std::array<float,2>{0.0179987997f, 0.682092905f},
-std::array<float,2>{0.814762115f, 0.116329372f},
-std::array<float,2>{0.129897133f, 0.224473193f},
-std::array<float,2>{0.896256149f, 0.573782504f},
-std::array<float,2>{0.381814003f, 0.903053522f},
-std::array<float,2>{0.578003407f, 0.460548192f},
-std::array<float,2>{0.22685118f, 0.299770087f},
-std::array<float,2>{0.985771775f, 0.837456346f},
-std::array<float,2>{0.441983849f, 0.694624662f},
-std::array<float,2>{0.550479829f, 0.0504802875f},
-std::array<float,2>{0.330248326f, 0.17149426f},
-std::array<float,2>{0.665302813f, 0.525191367f},
-std::array<float,2>{0.0703296736f, 0.951248646f},
-std::array<float,2>{0.789305627f, 0.381593138f},
-std::array<float,2>{0.412953347f, 0.481808245f},
-std::array<float,2>{0.599850655f, 0.920761585f},
-std::array<float,2>{0.17537488f, 0.613423586f},
-std::array<float,2>{0.909109116f, 0.191589415f},
-std::array<float,2>{0.0505003892f, 0.0791409835f},
-std::array<float,2>{0.871618569f, 0.633635759f},
-std::array<float,2>{0.279782653f, 0.75266856f},
-std::array<float,2>{0.691548169f, 0.31294927f},
-std::array<float,2>{0.0249456987f, 0.307267308f},
-std::array<float,2>{0.820355475f, 0.830327451f},
-std::array<float,2>{0.302170932f, 0.701018393f},
-std::array<float,2>{0.742725372f, 0.0550909229f},
-std::array<float,2>{0.386299223f, 0.162464529f},
-std::array<float,2>{0.564262688f, 0.518231809f},
-std::array<float,2>{0.139128163f, 0.94113636f},
-std::array<float,2>{0.905312598f, 0.387008756f},
-std::array<float,2>{0.36208114f, 0.470874459f},
-std::array<float,2>{0.648184359f, 0.911597013f},
-std::array<float,2>{0.123190679f, 0.622377753f},
-std::array<float,2>{0.756515026f, 0.198094964f},
-std::array<float,2>{0.203083888f, 0.0878686979f},
-std::array<float,2>{0.958978713f, 0.62988168f},
-std::array<float,2>{0.475090802f, 0.760927498f},
-std::array<float,2>{0.506279886f, 0.326215446f},
-std::array<float,2>{0.180939123f, 0.414594114f},
-std::array<float,2>{0.918480754f, 0.993216574f},
-std::array<float,2>{0.417107552f, 0.559964836f},
-std::array<float,2>{0.607483447f, 0.129389286f},
-std::array<float,2>{0.266976207f, 0.0138213113f},
-std::array<float,2>{0.698858738f, 0.723597407f},
-std::array<float,2>{0.0588372424f, 0.862671971f},
-std::array<float,2>{0.863663912f, 0.277825594f},
-std::array<float,2>{0.450901628f, 0.347351521f},
-std::array<float,2>{0.556650281f, 0.807991266f},
-std::array<float,2>{0.224411801f, 0.676405013f},
-std::array<float,2>{0.993284643f, 0.120817147f},
-std::array<float,2>{0.0664420277f, 0.233404025f},
-std::array<float,2>{0.781848371f, 0.565193176f},
-std::array<float,2>{0.340389043f, 0.894143641f},
-std::array<float,2>{0.659740925f, 0.468032181f},
-std::array<float,2>{0.102083229f, 0.450631082f},
-std::array<float,2>{0.76955992f, 0.882744551f},
-std::array<float,2>{0.347829252f, 0.592870116f},
-std::array<float,2>{0.62779218f, 0.240405798f},
-std::array<float,2>{0.490065575f, 0.10800004f},
-std::array<float,2>{0.517200947f, 0.667493582f},
-std::array<float,2>{0.203266934f, 0.791766703f},
-std::array<float,2>{0.945265472f, 0.367622465f},
-std::array<float,2>{0.283703655f, 0.250977397f},
-std::array<float,2>{0.719955444f, 0.854533195f},
-std::array<float,2>{0.0113528073f, 0.749930441f},
-std::array<float,2>{0.841192544f, 0.0197108649f},
-std::array<float,2>{0.149574637f, 0.151636466f},
-std::array<float,2>{0.878610611f, 0.540495336f},
-std::array<float,2>{0.391219586f, 0.982453287f},
-std::array<float,2>{0.580190659f, 0.43699199f},
-std::array<float,2>{0.241730317f, 0.334493905f},
-std::array<float,2>{0.979951978f, 0.772078276f},
-std::array<float,2>{0.463291883f, 0.65064925f},
-std::array<float,2>{0.534458518f, 0.0673227012f},
-std::array<float,2>{0.315137774f, 0.203718051f},
-std::array<float,2>{0.683970809f, 0.605258584f},
-std::array<float,2>{0.087621294f, 0.923793674f},
-std::array<float,2>{0.803832114f, 0.491691649f},
-std::array<float,2>{0.433450103f, 0.403129339f},
-std::array<float,2>{0.618789434f, 0.964735687f},
-std::array<float,2>{0.167841688f, 0.510391712f},
-std::array<float,2>{0.930872202f, 0.180431902f},
-std::array<float,2>{0.0383817255f, 0.0401018038f},
-std::array<float,2>{0.859002113f, 0.711306334f},
-std::array<float,2>{0.264435351f, 0.825166821f},
-std::array<float,2>{0.716760099f, 0.2946091f},
-std::array<float,2>{0.0836883709f, 0.365988076f},
-std::array<float,2>{0.80963701f, 0.786922157f},
-std::array<float,2>{0.322222471f, 0.659210861f},
-std::array<float,2>{0.67513603f, 0.0967644379f},
-std::array<float,2>{0.459327638f, 0.246823907f},
-std::array<float,2>{0.543612957f, 0.581021428f},
-std::array<float,2>{0.249480799f, 0.886626482f},
-std::array<float,2>{0.974274755f, 0.442140192f},
-std::array<float,2>{0.251354843f, 0.426434696f},
-std::array<float,2>{0.708502531f, 0.972764611f},
-std::array<float,2>{0.0464260541f, 0.531278789f},
-std::array<float,2>{0.84559226f, 0.145454943f},
-std::array<float,2>{0.156365842f, 0.0273147877f},
-std::array<float,2>{0.926292181f, 0.742053449f},
-std::array<float,2>{0.424266756f, 0.850631654f},
-std::array<float,2>{0.615249932f, 0.260350287f},
-std::array<float,2>{0.217985064f, 0.499361724f},
-std::array<float,2>{0.948173702f, 0.930660367f},
-std::array<float,2>{0.492607117f, 0.598430872f},
-std::array<float,2>{0.524545074f, 0.215145722f},
-std::array<float,2>{0.355521888f, 0.0747342557f},
-std::array<float,2>{0.636772096f, 0.645892501f},
-std::array<float,2>{0.100847907f, 0.777183235f},
-std::array<float,2>{0.77483803f, 0.340638608f},
-std::array<float,2>{0.398839861f, 0.285460323f},
-std::array<float,2>{0.588911712f, 0.817523777f},
-std::array<float,2>{0.145228446f, 0.704567969f},
-std::array<float,2>{0.885657072f, 0.0325374715f},
-std::array<float,2>{0.00565918582f, 0.173876122f},
-std::array<float,2>{0.831580818f, 0.500006318f},
-std::array<float,2>{0.291141927f, 0.956065178f},
-std::array<float,2>{0.733522117f, 0.391955078f},
-std::array<float,2>{0.0480817556f, 0.382300079f},
-std::array<float,2>{0.873823047f, 0.952708364f},
-std::array<float,2>{0.278091997f, 0.524037838f},
-std::array<float,2>{0.693804562f, 0.170739412f},
-std::array<float,2>{0.411973506f, 0.0494082905f},
-std::array<float,2>{0.599513531f, 0.69378674f},
-std::array<float,2>{0.173359901f, 0.836567342f},
-std::array<float,2>{0.906363249f, 0.300061375f},
-std::array<float,2>{0.329352528f, 0.314134926f},
-std::array<float,2>{0.666221201f, 0.7532112f},
-std::array<float,2>{0.0726974905f, 0.633877635f},
-std::array<float,2>{0.79143548f, 0.0790883228f},
-std::array<float,2>{0.229907259f, 0.192965761f},
-std::array<float,2>{0.986733735f, 0.614730775f},
-std::array<float,2>{0.444835842f, 0.92102325f},
-std::array<float,2>{0.548289478f, 0.481017411f},
-std::array<float,2>{0.132545605f, 0.272350639f},
-std::array<float,2>{0.897027314f, 0.872426748f},
-std::array<float,2>{0.380418956f, 0.732867301f},
-std::array<float,2>{0.574415028f, 0.00215813937f},
-std::array<float,2>{0.310711563f, 0.140146092f},
-std::array<float,2>{0.74164933f, 0.551549852f},
-std::array<float,2>{0.0169505365f, 0.985925198f},
-std::array<float,2>{0.813508689f, 0.406533629f},
-std::array<float,2>{0.477205783f, 0.459809989f},
-std::array<float,2>{0.512733757f, 0.903828502f},
-std::array<float,2>{0.192189217f, 0.572664082f},
-std::array<float,2>{0.967261195f, 0.223237589f},
-std::array<float,2>{0.112591363f, 0.1154567f},
-std::array<float,2>{0.760178447f, 0.683388472f},
-std::array<float,2>{0.37282154f, 0.802264214f},
-std::array<float,2>{0.651261866f, 0.357919633f},
-std::array<float,2>{0.11739739f, 0.262828559f},
-std::array<float,2>{0.752248764f, 0.846673489f},
-std::array<float,2>{0.364604503f, 0.734937131f},
-std::array<float,2>{0.641246617f, 0.0297363102f},
-std::array<float,2>{0.469367921f, 0.142811164f},
-std::array<float,2>{0.50008589f, 0.535292864f},
-std::array<float,2>{0.196979851f, 0.971363902f},
-std::array<float,2>{0.956110597f, 0.423660904f},
-std::array<float,2>{0.298561752f, 0.438709557f},
-std::array<float,2>{0.749295592f, 0.888729095f},
-std::array<float,2>{0.0294204634f, 0.584048808f},
-std::array<float,2>{0.82811904f, 0.24554427f},
-std::array<float,2>{0.135148868f, 0.0995359495f},
-std::array<float,2>{0.898486733f, 0.661427617f},
-std::array<float,2>{0.389054477f, 0.783571422f},
-std::array<float,2>{0.569550872f, 0.361853153f},
-std::array<float,2>{0.221661225f, 0.397034228f},
-std::array<float,2>{0.999611259f, 0.958985925f},
-std::array<float,2>{0.446282059f, 0.504770041f},
-std::array<float,2>{0.558888614f, 0.176719591f},
-std::array<float,2>{0.339320034f, 0.0353081338f},
-std::array<float,2>{0.661357403f, 0.708507597f},
-std::array<float,2>{0.0643049851f, 0.813943446f},
-std::array<float,2>{0.785651028f, 0.282733291f},
-std::array<float,2>{0.41959703f, 0.337547451f},
-std::array<float,2>{0.60240525f, 0.779986799f},
-std::array<float,2>{0.187144667f, 0.643547714f},
-std::array<float,2>{0.917947233f, 0.0709908307f},
-std::array<float,2>{0.0571639948f, 0.213092104f},
-std::array<float,2>{0.859574199f, 0.594187319f},
-std::array<float,2>{0.271418333f, 0.937361777f},
-std::array<float,2>{0.702489018f, 0.494013697f},
-std::array<float,2>{0.0122583415f, 0.478266776f},
-std::array<float,2>{0.837852895f, 0.916209817f},
-std::array<float,2>{0.286719352f, 0.610455275f},
-std::array<float,2>{0.725619972f, 0.190797448f},
-std::array<float,2>{0.395472527f, 0.0827172101f},
-std::array<float,2>{0.58203572f, 0.637280047f},
-std::array<float,2>{0.154744595f, 0.757648945f},
-std::array<float,2>{0.879515231f, 0.317932159f},
-std::array<float,2>{0.344314337f, 0.302631766f},
-std::array<float,2>{0.629270673f, 0.840164006f},
-std::array<float,2>{0.106245242f, 0.690348446f},
-std::array<float,2>{0.766350031f, 0.051168438f},
-std::array<float,2>{0.209992349f, 0.167256236f},
-std::array<float,2>{0.939421177f, 0.527695835f},
-std::array<float,2>{0.487880021f, 0.946482241f},
-std::array<float,2>{0.521256566f, 0.375348181f},
-std::array<float,2>{0.171214238f, 0.354659051f},
-std::array<float,2>{0.934593081f, 0.796945095f},
-std::array<float,2>{0.436042666f, 0.685525358f},
-std::array<float,2>{0.624807656f, 0.110849783f},
-std::array<float,2>{0.259076089f, 0.221050501f},
-std::array<float,2>{0.714183569f, 0.574277639f},
-std::array<float,2>{0.0334391333f, 0.899956822f},
-std::array<float,2>{0.854986608f, 0.456647843f},
-std::array<float,2>{0.465647727f, 0.411694407f},
-std::array<float,2>{0.535528064f, 0.990321696f},
-std::array<float,2>{0.23458901f, 0.548329771f},
-std::array<float,2>{0.983657837f, 0.135929018f},
-std::array<float,2>{0.092582196f, 0.00477668969f},
-std::array<float,2>{0.797442794f, 0.727963328f},
-std::array<float,2>{0.317913681f, 0.868322253f},
-std::array<float,2>{0.682340384f, 0.268974274f},
-std::array<float,2>{0.0423039757f, 0.322038859f},
-std::array<float,2>{0.847695172f, 0.762291133f},
-std::array<float,2>{0.254046559f, 0.62669915f},
-std::array<float,2>{0.706586421f, 0.0906649902f},
-std::array<float,2>{0.426709116f, 0.19999437f},
-std::array<float,2>{0.610311627f, 0.619182289f},
-std::array<float,2>{0.161380515f, 0.908717692f},
-std::array<float,2>{0.925444305f, 0.474845618f},
-std::array<float,2>{0.325366557f, 0.384762943f},
-std::array<float,2>{0.677250445f, 0.942201972f},
-std::array<float,2>{0.0804722533f, 0.521436036f},
-std::array<float,2>{0.805741429f, 0.156263247f},
-std::array<float,2>{0.24448587f, 0.0622334667f},
-std::array<float,2>{0.968944371f, 0.695313215f},
-std::array<float,2>{0.454050779f, 0.834875226f},
-std::array<float,2>{0.540250003f, 0.311201215f},
-std::array<float,2>{0.143168986f, 0.464559644f},
-std::array<float,2>{0.887942851f, 0.897803009f},
-std::array<float,2>{0.405234396f, 0.568624616f},
-std::array<float,2>{0.592410326f, 0.227387279f},
-std::array<float,2>{0.296789855f, 0.121823922f},
-std::array<float,2>{0.729892373f, 0.6749053f},
-std::array<float,2>{0.00357188354f, 0.809149027f},
-std::array<float,2>{0.835683227f, 0.351234734f},
-std::array<float,2>{0.49975583f, 0.27384311f},
-std::array<float,2>{0.531037092f, 0.866159201f},
-std::array<float,2>{0.21168983f, 0.720724642f},
-std::array<float,2>{0.950151026f, 0.00801678933f},
-std::array<float,2>{0.0970545113f, 0.128401071f},
-std::array<float,2>{0.778616309f, 0.558400393f},
-std::array<float,2>{0.352291375f, 0.996549189f},
-std::array<float,2>{0.633714795f, 0.42103982f},
-std::array<float,2>{0.0750708953f, 0.431363076f},
-std::array<float,2>{0.793059826f, 0.979928255f},
-std::array<float,2>{0.333745927f, 0.546647072f},
-std::array<float,2>{0.670539856f, 0.152809247f},
-std::array<float,2>{0.43858093f, 0.0171473343f},
-std::array<float,2>{0.551579297f, 0.743744731f},
-std::array<float,2>{0.231367216f, 0.856052518f},
-std::array<float,2>{0.989011347f, 0.256745756f},
-std::array<float,2>{0.273541659f, 0.374244481f},
-std::array<float,2>{0.690721214f, 0.794223607f},
-std::array<float,2>{0.0542459786f, 0.669695199f},
-std::array<float,2>{0.870434284f, 0.105351999f},
-std::array<float,2>{0.178117573f, 0.236134022f},
-std::array<float,2>{0.912424624f, 0.58677274f},
-std::array<float,2>{0.407391757f, 0.878178895f},
-std::array<float,2>{0.596061051f, 0.446296304f},
-std::array<float,2>{0.190571681f, 0.290334255f},
-std::array<float,2>{0.964670956f, 0.822259486f},
-std::array<float,2>{0.483540922f, 0.716986716f},
-std::array<float,2>{0.50987339f, 0.0457557403f},
-std::array<float,2>{0.368780673f, 0.186160803f},
-std::array<float,2>{0.65245378f, 0.515280843f},
-std::array<float,2>{0.113336235f, 0.966393173f},
-std::array<float,2>{0.762516201f, 0.39894253f},
-std::array<float,2>{0.376262546f, 0.487986714f},
-std::array<float,2>{0.571412742f, 0.926079333f},
-std::array<float,2>{0.127604395f, 0.608154595f},
-std::array<float,2>{0.892810106f, 0.207210004f},
-std::array<float,2>{0.0207108688f, 0.0630973279f},
-std::array<float,2>{0.81784457f, 0.655480981f},
-std::array<float,2>{0.30621174f, 0.768955886f},
-std::array<float,2>{0.737318933f, 0.331662416f},
-std::array<float,2>{0.0620982312f, 0.279415637f},
-std::array<float,2>{0.86648488f, 0.860998631f},
-std::array<float,2>{0.269083381f, 0.725691438f},
-std::array<float,2>{0.696231127f, 0.0131010022f},
-std::array<float,2>{0.415593356f, 0.131998852f},
-std::array<float,2>{0.607282996f, 0.561417103f},
-std::array<float,2>{0.181935638f, 0.9950791f},
-std::array<float,2>{0.920448244f, 0.416566908f},
-std::array<float,2>{0.343322247f, 0.466416329f},
-std::array<float,2>{0.657378733f, 0.891713738f},
-std::array<float,2>{0.0691791177f, 0.562769771f},
-std::array<float,2>{0.78492558f, 0.232149675f},
-std::array<float,2>{0.226123691f, 0.117615081f},
-std::array<float,2>{0.99445039f, 0.678412139f},
-std::array<float,2>{0.451509595f, 0.806343079f},
-std::array<float,2>{0.556585848f, 0.345534205f},
-std::array<float,2>{0.138173908f, 0.389120758f},
-std::array<float,2>{0.90416652f, 0.939339161f},
-std::array<float,2>{0.382974982f, 0.515961409f},
-std::array<float,2>{0.564533532f, 0.161922425f},
-std::array<float,2>{0.303225338f, 0.0570042357f},
-std::array<float,2>{0.744390905f, 0.701846421f},
-std::array<float,2>{0.0263257604f, 0.82953316f},
-std::array<float,2>{0.822305977f, 0.306100428f},
-std::array<float,2>{0.473625004f, 0.324251682f},
-std::array<float,2>{0.505006313f, 0.758101106f},
-std::array<float,2>{0.199465886f, 0.632190347f},
-std::array<float,2>{0.960381687f, 0.0885504931f},
-std::array<float,2>{0.122689538f, 0.195959345f},
-std::array<float,2>{0.753914177f, 0.624651372f},
-std::array<float,2>{0.359728932f, 0.913112402f},
-std::array<float,2>{0.644901335f, 0.470481455f},
-std::array<float,2>{0.0896590278f, 0.489659905f},
-std::array<float,2>{0.801631868f, 0.923879385f},
-std::array<float,2>{0.312832892f, 0.602528393f},
-std::array<float,2>{0.686855972f, 0.20563224f},
-std::array<float,2>{0.461034387f, 0.0691118911f},
-std::array<float,2>{0.532271802f, 0.650015593f},
-std::array<float,2>{0.239114955f, 0.771428943f},
-std::array<float,2>{0.977685094f, 0.332086742f},
-std::array<float,2>{0.263219416f, 0.294959933f},
-std::array<float,2>{0.71872139f, 0.82704705f},
-std::array<float,2>{0.035275463f, 0.713603616f},
-std::array<float,2>{0.856149554f, 0.0426698253f},
-std::array<float,2>{0.164701551f, 0.182795599f},
-std::array<float,2>{0.932102978f, 0.508468747f},
-std::array<float,2>{0.430519819f, 0.961320102f},
-std::array<float,2>{0.620903134f, 0.40527302f},
-std::array<float,2>{0.205489859f, 0.370484591f},
-std::array<float,2>{0.943123877f, 0.78965044f},
-std::array<float,2>{0.490925521f, 0.664175689f},
-std::array<float,2>{0.517825186f, 0.105694138f},
-std::array<float,2>{0.351276159f, 0.239372149f},
-std::array<float,2>{0.626301825f, 0.59126538f},
-std::array<float,2>{0.104438595f, 0.879881859f},
-std::array<float,2>{0.773147285f, 0.453041404f},
-std::array<float,2>{0.394161314f, 0.433947921f},
-std::array<float,2>{0.579464674f, 0.980890334f},
-std::array<float,2>{0.151411802f, 0.541095614f},
-std::array<float,2>{0.876862049f, 0.148831755f},
-std::array<float,2>{0.00950732641f, 0.0233874787f},
-std::array<float,2>{0.84199661f, 0.746426344f},
-std::array<float,2>{0.282037258f, 0.853147447f},
-std::array<float,2>{0.722253084f, 0.252153754f},
-std::array<float,2>{0.0988983363f, 0.34364143f},
-std::array<float,2>{0.775441349f, 0.773703218f},
-std::array<float,2>{0.359141052f, 0.64730233f},
-std::array<float,2>{0.640082359f, 0.076843217f},
-std::array<float,2>{0.494977206f, 0.216800913f},
-std::array<float,2>{0.526100874f, 0.60126394f},
-std::array<float,2>{0.215582594f, 0.93263483f},
-std::array<float,2>{0.947026014f, 0.496738255f},
-std::array<float,2>{0.289092213f, 0.393422872f},
-std::array<float,2>{0.731551826f, 0.954115808f},
-std::array<float,2>{0.00662023854f, 0.503874719f},
-std::array<float,2>{0.829238117f, 0.173737615f},
-std::array<float,2>{0.14745611f, 0.0346376263f},
-std::array<float,2>{0.884677172f, 0.705112934f},
-std::array<float,2>{0.400685072f, 0.81984967f},
-std::array<float,2>{0.586295784f, 0.288288981f},
-std::array<float,2>{0.247775912f, 0.445291132f},
-std::array<float,2>{0.97508353f, 0.883159935f},
-std::array<float,2>{0.457322121f, 0.578622401f},
-std::array<float,2>{0.545973837f, 0.248375073f},
-std::array<float,2>{0.322706044f, 0.0949761942f},
-std::array<float,2>{0.673271239f, 0.657793164f},
-std::array<float,2>{0.0856206715f, 0.788820386f},
-std::array<float,2>{0.811632812f, 0.364832938f},
-std::array<float,2>{0.422905236f, 0.258821338f},
-std::array<float,2>{0.613839686f, 0.848795414f},
-std::array<float,2>{0.159376353f, 0.738611341f},
-std::array<float,2>{0.929503083f, 0.0239045229f},
-std::array<float,2>{0.0448061787f, 0.147749752f},
-std::array<float,2>{0.847202241f, 0.535083055f},
-std::array<float,2>{0.253170341f, 0.976244748f},
-std::array<float,2>{0.709031165f, 0.42904973f},
-std::array<float,2>{0.0177157875f, 0.410113961f},
-std::array<float,2>{0.814472079f, 0.98705703f},
-std::array<float,2>{0.31041646f, 0.553636491f},
-std::array<float,2>{0.739005685f, 0.138601243f},
-std::array<float,2>{0.381353587f, 0.00179034926f},
-std::array<float,2>{0.577651978f, 0.730489492f},
-std::array<float,2>{0.130314037f, 0.873623252f},
-std::array<float,2>{0.896045148f, 0.270432681f},
-std::array<float,2>{0.37378186f, 0.357378274f},
-std::array<float,2>{0.649425089f, 0.803373873f},
-std::array<float,2>{0.110492118f, 0.6807127f},
-std::array<float,2>{0.75924778f, 0.114107929f},
-std::array<float,2>{0.194168031f, 0.225674942f},
-std::array<float,2>{0.966563165f, 0.570934713f},
-std::array<float,2>{0.478583157f, 0.904503763f},
-std::array<float,2>{0.513942897f, 0.458508611f},
-std::array<float,2>{0.175700903f, 0.297286421f},
-std::array<float,2>{0.908819795f, 0.839151144f},
-std::array<float,2>{0.412669092f, 0.692679167f},
-std::array<float,2>{0.599888086f, 0.0483533032f},
-std::array<float,2>{0.279540986f, 0.168098196f},
-std::array<float,2>{0.691850901f, 0.525698721f},
-std::array<float,2>{0.0505674221f, 0.950115561f},
-std::array<float,2>{0.87183857f, 0.380175292f},
-std::array<float,2>{0.442257255f, 0.48372376f},
-std::array<float,2>{0.550685108f, 0.91874522f},
-std::array<float,2>{0.226743177f, 0.615265071f},
-std::array<float,2>{0.985442519f, 0.193679363f},
-std::array<float,2>{0.0705873594f, 0.0812015533f},
-std::array<float,2>{0.789416969f, 0.636302352f},
-std::array<float,2>{0.330483526f, 0.750309408f},
-std::array<float,2>{0.665166795f, 0.31622684f},
-std::array<float,2>{0.0650541633f, 0.283838958f},
-std::array<float,2>{0.787148654f, 0.814990997f},
-std::array<float,2>{0.336563289f, 0.709955931f},
-std::array<float,2>{0.663890898f, 0.0382320695f},
-std::array<float,2>{0.448913366f, 0.17888321f},
-std::array<float,2>{0.561892509f, 0.507472277f},
-std::array<float,2>{0.219400659f, 0.958682537f},
-std::array<float,2>{0.997276962f, 0.395091802f},
-std::array<float,2>{0.271663487f, 0.495442182f},
-std::array<float,2>{0.700324357f, 0.934677541f},
-std::array<float,2>{0.0553032011f, 0.596282184f},
-std::array<float,2>{0.862000048f, 0.212693617f},
-std::array<float,2>{0.184168369f, 0.0731315464f},
-std::array<float,2>{0.914645672f, 0.641021132f},
-std::array<float,2>{0.420881033f, 0.778365731f},
-std::array<float,2>{0.603974879f, 0.339719236f},
-std::array<float,2>{0.198123112f, 0.423964918f},
-std::array<float,2>{0.953439713f, 0.970309138f},
-std::array<float,2>{0.472441852f, 0.538775086f},
-std::array<float,2>{0.503690004f, 0.141930833f},
-std::array<float,2>{0.366092116f, 0.027363088f},
-std::array<float,2>{0.643480241f, 0.738155365f},
-std::array<float,2>{0.1208231f, 0.84514451f},
-std::array<float,2>{0.751083612f, 0.263715863f},
-std::array<float,2>{0.388013422f, 0.359538138f},
-std::array<float,2>{0.566607118f, 0.781345963f},
-std::array<float,2>{0.134013489f, 0.663557649f},
-std::array<float,2>{0.901585519f, 0.100475863f},
-std::array<float,2>{0.0273740198f, 0.242944524f},
-std::array<float,2>{0.825617909f, 0.582796216f},
-std::array<float,2>{0.300566107f, 0.88706857f},
-std::array<float,2>{0.747397184f, 0.440256119f},
-std::array<float,2>{0.0316691026f, 0.453346521f},
-std::array<float,2>{0.851805389f, 0.900390625f},
-std::array<float,2>{0.261542648f, 0.577414632f},
-std::array<float,2>{0.712478936f, 0.219244272f},
-std::array<float,2>{0.433717906f, 0.111553334f},
-std::array<float,2>{0.621413529f, 0.687271893f},
-std::array<float,2>{0.16866897f, 0.799427211f},
-std::array<float,2>{0.93556869f, 0.352900445f},
-std::array<float,2>{0.318871081f, 0.265991867f},
-std::array<float,2>{0.681265295f, 0.870483041f},
-std::array<float,2>{0.0903218538f, 0.728830755f},
-std::array<float,2>{0.800434232f, 0.00662230747f},
-std::array<float,2>{0.237316296f, 0.133256197f},
-std::array<float,2>{0.981753647f, 0.550333261f},
-std::array<float,2>{0.468385458f, 0.990012228f},
-std::array<float,2>{0.537168622f, 0.413366646f},
-std::array<float,2>{0.152794853f, 0.319254726f},
-std::array<float,2>{0.881907403f, 0.755576313f},
-std::array<float,2>{0.398149937f, 0.639542818f},
-std::array<float,2>{0.584492028f, 0.0847260058f},
-std::array<float,2>{0.288046539f, 0.188176885f},
-std::array<float,2>{0.724490881f, 0.613268018f},
-std::array<float,2>{0.0150211323f, 0.915883362f},
-std::array<float,2>{0.838540792f, 0.479424268f},
-std::array<float,2>{0.484783918f, 0.378656834f},
-std::array<float,2>{0.523243785f, 0.947755694f},
-std::array<float,2>{0.208101779f, 0.530253649f},
-std::array<float,2>{0.940636814f, 0.164529696f},
-std::array<float,2>{0.107638545f, 0.0529992208f},
-std::array<float,2>{0.767998517f, 0.688826442f},
-std::array<float,2>{0.34758687f, 0.843344033f},
-std::array<float,2>{0.631523311f, 0.302951306f},
-std::array<float,2>{0.00149748928f, 0.348125994f},
-std::array<float,2>{0.832509935f, 0.812086761f},
-std::array<float,2>{0.294418901f, 0.672594786f},
-std::array<float,2>{0.728428304f, 0.124830432f},
-std::array<float,2>{0.403896958f, 0.229025811f},
-std::array<float,2>{0.589874268f, 0.567147851f},
-std::array<float,2>{0.141069189f, 0.894613385f},
-std::array<float,2>{0.889033735f, 0.462401748f},
-std::array<float,2>{0.354844362f, 0.418396264f},
-std::array<float,2>{0.636080086f, 0.998603463f},
-std::array<float,2>{0.0948036909f, 0.555545926f},
-std::array<float,2>{0.780084908f, 0.125832379f},
-std::array<float,2>{0.214612752f, 0.010423474f},
-std::array<float,2>{0.952546179f, 0.719471216f},
-std::array<float,2>{0.498007178f, 0.864727914f},
-std::array<float,2>{0.527931511f, 0.276068062f},
-std::array<float,2>{0.163423687f, 0.473604649f},
-std::array<float,2>{0.922374189f, 0.908179939f},
-std::array<float,2>{0.42879656f, 0.617199481f},
-std::array<float,2>{0.613191485f, 0.201443404f},
-std::array<float,2>{0.257793009f, 0.0929814279f},
-std::array<float,2>{0.704426587f, 0.626972675f},
-std::array<float,2>{0.0407232828f, 0.764576793f},
-std::array<float,2>{0.851007938f, 0.323675603f},
-std::array<float,2>{0.456490785f, 0.309180737f},
-std::array<float,2>{0.541337848f, 0.833263993f},
-std::array<float,2>{0.2426541f, 0.698621869f},
-std::array<float,2>{0.972141504f, 0.0598919205f},
-std::array<float,2>{0.0794419795f, 0.158252776f},
-std::array<float,2>{0.807312489f, 0.522471726f},
-std::array<float,2>{0.328092277f, 0.943521321f},
-std::array<float,2>{0.677929759f, 0.386634707f},
-std::array<float,2>{0.116750576f, 0.40174976f},
-std::array<float,2>{0.763895333f, 0.966830671f},
-std::array<float,2>{0.370683879f, 0.513635099f},
-std::array<float,2>{0.656082809f, 0.184045389f},
-std::array<float,2>{0.481059581f, 0.0431300253f},
-std::array<float,2>{0.509314001f, 0.716159105f},
-std::array<float,2>{0.188791201f, 0.822736025f},
-std::array<float,2>{0.961756706f, 0.292076916f},
-std::array<float,2>{0.307971328f, 0.329112232f},
-std::array<float,2>{0.736213982f, 0.766516328f},
-std::array<float,2>{0.0216096826f, 0.652596235f},
-std::array<float,2>{0.81974715f, 0.064878583f},
-std::array<float,2>{0.125444293f, 0.209557921f},
-std::array<float,2>{0.890939891f, 0.606337726f},
-std::array<float,2>{0.377656162f, 0.928693056f},
-std::array<float,2>{0.572760999f, 0.484920621f},
-std::array<float,2>{0.232600927f, 0.254674286f},
-std::array<float,2>{0.99087894f, 0.859365523f},
-std::array<float,2>{0.441402107f, 0.744457304f},
-std::array<float,2>{0.553491294f, 0.0181362238f},
-std::array<float,2>{0.335705966f, 0.156064883f},
-std::array<float,2>{0.668853879f, 0.543778241f},
-std::array<float,2>{0.0773083344f, 0.978192329f},
-std::array<float,2>{0.795208097f, 0.432597637f},
-std::array<float,2>{0.409412414f, 0.447726995f},
-std::array<float,2>{0.594921649f, 0.876256883f},
-std::array<float,2>{0.176392525f, 0.58975482f},
-std::array<float,2>{0.910780549f, 0.23800768f},
-std::array<float,2>{0.0512540489f, 0.102884203f},
-std::array<float,2>{0.868171394f, 0.67096889f},
-std::array<float,2>{0.276085317f, 0.795370996f},
-std::array<float,2>{0.688987017f, 0.371623218f},
-std::array<float,2>{0.0105369668f, 0.253438205f},
-std::array<float,2>{0.839849412f, 0.852226734f},
-std::array<float,2>{0.285134166f, 0.747720003f},
-std::array<float,2>{0.71944046f, 0.0223775804f},
-std::array<float,2>{0.391953588f, 0.149747014f},
-std::array<float,2>{0.581801057f, 0.542794764f},
-std::array<float,2>{0.149048805f, 0.981580973f},
-std::array<float,2>{0.876983583f, 0.435026199f},
-std::array<float,2>{0.34867999f, 0.451232135f},
-std::array<float,2>{0.628064811f, 0.880243003f},
-std::array<float,2>{0.102738f, 0.590560019f},
-std::array<float,2>{0.770625591f, 0.239132643f},
-std::array<float,2>{0.204127803f, 0.107180767f},
-std::array<float,2>{0.94408685f, 0.665778458f},
-std::array<float,2>{0.48859185f, 0.79079628f},
-std::array<float,2>{0.516312838f, 0.369202137f},
-std::array<float,2>{0.16601932f, 0.406237572f},
-std::array<float,2>{0.930034697f, 0.96242696f},
-std::array<float,2>{0.431857705f, 0.509087801f},
-std::array<float,2>{0.617438853f, 0.181930929f},
-std::array<float,2>{0.264955223f, 0.0419896282f},
-std::array<float,2>{0.714891732f, 0.714825749f},
-std::array<float,2>{0.0377434008f, 0.827683449f},
-std::array<float,2>{0.857725978f, 0.296270996f},
-std::array<float,2>{0.464449167f, 0.333513767f},
-std::array<float,2>{0.533629358f, 0.770316184f},
-std::array<float,2>{0.24099642f, 0.648438692f},
-std::array<float,2>{0.979160607f, 0.0695501938f},
-std::array<float,2>{0.0868541673f, 0.206427559f},
-std::array<float,2>{0.803680599f, 0.603486776f},
-std::array<float,2>{0.316109389f, 0.924965501f},
-std::array<float,2>{0.685249448f, 0.488904685f},
-std::array<float,2>{0.124042608f, 0.469592214f},
-std::array<float,2>{0.757471383f, 0.912334561f},
-std::array<float,2>{0.363016188f, 0.623832047f},
-std::array<float,2>{0.646995306f, 0.196719378f},
-std::array<float,2>{0.475655049f, 0.0891835317f},
-std::array<float,2>{0.507032216f, 0.631750286f},
-std::array<float,2>{0.201613516f, 0.759505689f},
-std::array<float,2>{0.957115769f, 0.325447291f},
-std::array<float,2>{0.301611841f, 0.304817349f},
-std::array<float,2>{0.743549168f, 0.828208148f},
-std::array<float,2>{0.0243750643f, 0.702684879f},
-std::array<float,2>{0.821537316f, 0.0579865985f},
-std::array<float,2>{0.139964387f, 0.160859659f},
-std::array<float,2>{0.905212224f, 0.51703155f},
-std::array<float,2>{0.385199547f, 0.937619865f},
-std::array<float,2>{0.563222826f, 0.389881313f},
-std::array<float,2>{0.222942427f, 0.344645858f},
-std::array<float,2>{0.992751002f, 0.805326998f},
-std::array<float,2>{0.449497879f, 0.679399252f},
-std::array<float,2>{0.557878554f, 0.118973628f},
-std::array<float,2>{0.341618806f, 0.231377393f},
-std::array<float,2>{0.659008801f, 0.56385833f},
-std::array<float,2>{0.0675676689f, 0.891485929f},
-std::array<float,2>{0.782341599f, 0.465717673f},
-std::array<float,2>{0.416691631f, 0.417674601f},
-std::array<float,2>{0.608446598f, 0.995451033f},
-std::array<float,2>{0.180286199f, 0.561951399f},
-std::array<float,2>{0.919784009f, 0.131403878f},
-std::array<float,2>{0.0601934195f, 0.0126305986f},
-std::array<float,2>{0.865145266f, 0.725342155f},
-std::array<float,2>{0.265765935f, 0.86011976f},
-std::array<float,2>{0.697681606f, 0.280440271f},
-std::array<float,2>{0.0733647794f, 0.315182567f},
-std::array<float,2>{0.792269289f, 0.751940072f},
-std::array<float,2>{0.328184634f, 0.635630965f},
-std::array<float,2>{0.667952061f, 0.0801954344f},
-std::array<float,2>{0.443438083f, 0.194419116f},
-std::array<float,2>{0.547532439f, 0.616237044f},
-std::array<float,2>{0.229283437f, 0.919615924f},
-std::array<float,2>{0.987648785f, 0.483084291f},
-std::array<float,2>{0.278346181f, 0.379508436f},
-std::array<float,2>{0.694675267f, 0.950986743f},
-std::array<float,2>{0.0473617762f, 0.52643168f},
-std::array<float,2>{0.874347389f, 0.169194907f},
-std::array<float,2>{0.172844306f, 0.0471927449f},
-std::array<float,2>{0.907427251f, 0.69163388f},
-std::array<float,2>{0.410201639f, 0.838206053f},
-std::array<float,2>{0.59810704f, 0.298582733f},
-std::array<float,2>{0.192630962f, 0.457478762f},
-std::array<float,2>{0.968500853f, 0.905644596f},
-std::array<float,2>{0.478450805f, 0.57152766f},
-std::array<float,2>{0.512125432f, 0.225536302f},
-std::array<float,2>{0.371450752f, 0.114657164f},
-std::array<float,2>{0.65137136f, 0.680191755f},
-std::array<float,2>{0.111415356f, 0.804021358f},
-std::array<float,2>{0.761196911f, 0.356211334f},
-std::array<float,2>{0.379859447f, 0.270553082f},
-std::array<float,2>{0.576155305f, 0.874074757f},
-std::array<float,2>{0.131817535f, 0.73174274f},
-std::array<float,2>{0.897990167f, 9.50784815e-05f},
-std::array<float,2>{0.0157232694f, 0.137277231f},
-std::array<float,2>{0.812877536f, 0.55378145f},
-std::array<float,2>{0.311576456f, 0.987975776f},
-std::array<float,2>{0.740454257f, 0.408835709f},
-std::array<float,2>{0.0453419313f, 0.42850706f},
-std::array<float,2>{0.844480753f, 0.974739254f},
-std::array<float,2>{0.250015169f, 0.53411746f},
-std::array<float,2>{0.707210541f, 0.146916866f},
-std::array<float,2>{0.425062925f, 0.024697097f},
-std::array<float,2>{0.616919339f, 0.739626348f},
-std::array<float,2>{0.157341197f, 0.84769243f},
-std::array<float,2>{0.927200317f, 0.258471757f},
-std::array<float,2>{0.321196228f, 0.36425525f},
-std::array<float,2>{0.674467862f, 0.787647843f},
-std::array<float,2>{0.0827150196f, 0.657114089f},
-std::array<float,2>{0.809258223f, 0.0940582231f},
-std::array<float,2>{0.248684779f, 0.249770418f},
-std::array<float,2>{0.973231256f, 0.57974261f},
-std::array<float,2>{0.460501969f, 0.883898199f},
-std::array<float,2>{0.544820905f, 0.443891466f},
-std::array<float,2>{0.145650834f, 0.287357032f},
-std::array<float,2>{0.88587606f, 0.819080114f},
-std::array<float,2>{0.399525732f, 0.706484556f},
-std::array<float,2>{0.58874011f, 0.0332965069f},
-std::array<float,2>{0.292031407f, 0.172694489f},
-std::array<float,2>{0.732756436f, 0.502292395f},
-std::array<float,2>{0.00468319561f, 0.953604102f},
-std::array<float,2>{0.830979168f, 0.394178271f},
-std::array<float,2>{0.49388954f, 0.497646987f},
-std::array<float,2>{0.523577631f, 0.932294667f},
-std::array<float,2>{0.21771723f, 0.599918365f},
-std::array<float,2>{0.948395789f, 0.218164653f},
-std::array<float,2>{0.0996621102f, 0.0771920085f},
-std::array<float,2>{0.774136305f, 0.64819032f},
-std::array<float,2>{0.357201576f, 0.77487433f},
-std::array<float,2>{0.638115942f, 0.341972172f},
-std::array<float,2>{0.106795974f, 0.304517418f},
-std::array<float,2>{0.767366171f, 0.842718899f},
-std::array<float,2>{0.345644802f, 0.687702477f},
-std::array<float,2>{0.630539f, 0.0538360253f},
-std::array<float,2>{0.486586243f, 0.165318072f},
-std::array<float,2>{0.520240724f, 0.530397177f},
-std::array<float,2>{0.209700182f, 0.948368192f},
-std::array<float,2>{0.937875569f, 0.377520531f},
-std::array<float,2>{0.285516351f, 0.479966849f},
-std::array<float,2>{0.724903762f, 0.914074063f},
-std::array<float,2>{0.0135885393f, 0.611443698f},
-std::array<float,2>{0.836458862f, 0.189053059f},
-std::array<float,2>{0.155816749f, 0.0850511566f},
-std::array<float,2>{0.880633891f, 0.640357673f},
-std::array<float,2>{0.39564532f, 0.754250705f},
-std::array<float,2>{0.583964586f, 0.319882005f},
-std::array<float,2>{0.23624754f, 0.412246287f},
-std::array<float,2>{0.983348191f, 0.988927722f},
-std::array<float,2>{0.465944201f, 0.549198449f},
-std::array<float,2>{0.537071586f, 0.13458693f},
-std::array<float,2>{0.316938818f, 0.00727698486f},
-std::array<float,2>{0.682742596f, 0.729720712f},
-std::array<float,2>{0.093514815f, 0.869648397f},
-std::array<float,2>{0.79844749f, 0.267103732f},
-std::array<float,2>{0.436793208f, 0.352063447f},
-std::array<float,2>{0.623537898f, 0.799948454f},
-std::array<float,2>{0.170284614f, 0.685623586f},
-std::array<float,2>{0.933926761f, 0.113255739f},
-std::array<float,2>{0.03421776f, 0.220339477f},
-std::array<float,2>{0.853545666f, 0.576469421f},
-std::array<float,2>{0.258126408f, 0.901564896f},
-std::array<float,2>{0.713449657f, 0.454245955f},
-std::array<float,2>{0.0311079305f, 0.441212684f},
-std::array<float,2>{0.826715231f, 0.887763739f},
-std::array<float,2>{0.297218859f, 0.583443105f},
-std::array<float,2>{0.748748064f, 0.243604779f},
-std::array<float,2>{0.390107006f, 0.101012543f},
-std::array<float,2>{0.569100678f, 0.662212372f},
-std::array<float,2>{0.136068448f, 0.782638967f},
-std::array<float,2>{0.899973691f, 0.360452771f},
-std::array<float,2>{0.363323301f, 0.265149772f},
-std::array<float,2>{0.64190203f, 0.844544232f},
-std::array<float,2>{0.119059958f, 0.736499429f},
-std::array<float,2>{0.75334096f, 0.0289066564f},
-std::array<float,2>{0.195337161f, 0.141325563f},
-std::array<float,2>{0.955900133f, 0.537543774f},
-std::array<float,2>{0.470244855f, 0.969033122f},
-std::array<float,2>{0.501224041f, 0.424873054f},
-std::array<float,2>{0.186466023f, 0.338113368f},
-std::array<float,2>{0.916891992f, 0.777851939f},
-std::array<float,2>{0.418210328f, 0.642017663f},
-std::array<float,2>{0.603426933f, 0.073304303f},
-std::array<float,2>{0.270274162f, 0.211145982f},
-std::array<float,2>{0.701729238f, 0.596999168f},
-std::array<float,2>{0.0579598509f, 0.933749497f},
-std::array<float,2>{0.860512257f, 0.494931728f},
-std::array<float,2>{0.446988136f, 0.396457404f},
-std::array<float,2>{0.560218453f, 0.957235754f},
-std::array<float,2>{0.222623706f, 0.506244957f},
-std::array<float,2>{0.998333216f, 0.178599477f},
-std::array<float,2>{0.062819995f, 0.0380518697f},
-std::array<float,2>{0.786765933f, 0.710348547f},
-std::array<float,2>{0.338780224f, 0.815480709f},
-std::array<float,2>{0.66103071f, 0.285026848f},
-std::array<float,2>{0.0533425659f, 0.372222543f},
-std::array<float,2>{0.869820952f, 0.796261668f},
-std::array<float,2>{0.274581462f, 0.670038164f},
-std::array<float,2>{0.690251052f, 0.102216817f},
-std::array<float,2>{0.406648844f, 0.236934379f},
-std::array<float,2>{0.597633481f, 0.588353455f},
-std::array<float,2>{0.179274634f, 0.875946522f},
-std::array<float,2>{0.913468182f, 0.448615551f},
-std::array<float,2>{0.332456648f, 0.433575839f},
-std::array<float,2>{0.6712448f, 0.977437854f},
-std::array<float,2>{0.0755146891f, 0.544633329f},
-std::array<float,2>{0.79484266f, 0.154431924f},
-std::array<float,2>{0.232099265f, 0.0187337659f},
-std::array<float,2>{0.989989698f, 0.745703518f},
-std::array<float,2>{0.437592596f, 0.857734263f},
-std::array<float,2>{0.552575231f, 0.254885375f},
-std::array<float,2>{0.128051057f, 0.485387266f},
-std::array<float,2>{0.894517362f, 0.929238319f},
-std::array<float,2>{0.37553072f, 0.606790125f},
-std::array<float,2>{0.57058835f, 0.21031411f},
-std::array<float,2>{0.305009246f, 0.0656000897f},
-std::array<float,2>{0.736516118f, 0.653731287f},
-std::array<float,2>{0.0199215133f, 0.766792715f},
-std::array<float,2>{0.817196965f, 0.328699529f},
-std::array<float,2>{0.483348846f, 0.291101128f},
-std::array<float,2>{0.511015892f, 0.823853433f},
-std::array<float,2>{0.189712107f, 0.715224624f},
-std::array<float,2>{0.963384748f, 0.0446785688f},
-std::array<float,2>{0.115196235f, 0.185191363f},
-std::array<float,2>{0.763492167f, 0.511985302f},
-std::array<float,2>{0.36791718f, 0.968056858f},
-std::array<float,2>{0.654168308f, 0.400910795f},
-std::array<float,2>{0.0811499357f, 0.38562113f},
-std::array<float,2>{0.804869294f, 0.94475168f},
-std::array<float,2>{0.32498163f, 0.52157408f},
-std::array<float,2>{0.676663578f, 0.159497365f},
-std::array<float,2>{0.454923362f, 0.0591588803f},
-std::array<float,2>{0.539222479f, 0.697625875f},
-std::array<float,2>{0.245876774f, 0.832593024f},
-std::array<float,2>{0.969786882f, 0.310420662f},
-std::array<float,2>{0.255244017f, 0.322578609f},
-std::array<float,2>{0.706041634f, 0.765004337f},
-std::array<float,2>{0.0419443622f, 0.628296912f},
-std::array<float,2>{0.849184334f, 0.0920540765f},
-std::array<float,2>{0.160902098f, 0.202259138f},
-std::array<float,2>{0.924615085f, 0.618622959f},
-std::array<float,2>{0.427166939f, 0.906871021f},
-std::array<float,2>{0.610510349f, 0.47395283f},
-std::array<float,2>{0.212633014f, 0.277287573f},
-std::array<float,2>{0.951093435f, 0.864026785f},
-std::array<float,2>{0.498810887f, 0.720642209f},
-std::array<float,2>{0.530052006f, 0.011466438f},
-std::array<float,2>{0.352664858f, 0.126118332f},
-std::array<float,2>{0.634172559f, 0.555798411f},
-std::array<float,2>{0.0957717225f, 0.999920309f},
-std::array<float,2>{0.777590811f, 0.419688374f},
-std::array<float,2>{0.4062002f, 0.461095691f},
-std::array<float,2>{0.592830598f, 0.896097362f},
-std::array<float,2>{0.144124314f, 0.567939878f},
-std::array<float,2>{0.88743335f, 0.229927108f},
-std::array<float,2>{0.00265464629f, 0.123749152f},
-std::array<float,2>{0.834938228f, 0.673039615f},
-std::array<float,2>{0.29539901f, 0.811460376f},
-std::array<float,2>{0.728900254f, 0.349488944f},
-std::array<float,2>{0.0369642004f, 0.293544799f},
-std::array<float,2>{0.856602788f, 0.826101542f},
-std::array<float,2>{0.262003481f, 0.712322772f},
-std::array<float,2>{0.71681565f, 0.0396209732f},
-std::array<float,2>{0.430913836f, 0.18130286f},
-std::array<float,2>{0.619531274f, 0.511386931f},
-std::array<float,2>{0.165521577f, 0.963181257f},
-std::array<float,2>{0.933395445f, 0.40402028f},
-std::array<float,2>{0.314007819f, 0.490957439f},
-std::array<float,2>{0.685885906f, 0.922270596f},
-std::array<float,2>{0.0879018307f, 0.6042611f},
-std::array<float,2>{0.80215764f, 0.204423249f},
-std::array<float,2>{0.240087733f, 0.0678647235f},
-std::array<float,2>{0.977494478f, 0.652155519f},
-std::array<float,2>{0.462195426f, 0.773280919f},
-std::array<float,2>{0.532091022f, 0.335029483f},
-std::array<float,2>{0.150567964f, 0.436114192f},
-std::array<float,2>{0.875553727f, 0.983429492f},
-std::array<float,2>{0.393051922f, 0.539160311f},
-std::array<float,2>{0.578494787f, 0.150778234f},
-std::array<float,2>{0.282739013f, 0.0210434422f},
-std::array<float,2>{0.720800698f, 0.748101354f},
-std::array<float,2>{0.00860820431f, 0.853661716f},
-std::array<float,2>{0.843088031f, 0.250898093f},
-std::array<float,2>{0.491258949f, 0.368445516f},
-std::array<float,2>{0.518569708f, 0.792355657f},
-std::array<float,2>{0.206303194f, 0.666053712f},
-std::array<float,2>{0.942058444f, 0.108416714f},
-std::array<float,2>{0.104540557f, 0.241427571f},
-std::array<float,2>{0.772075891f, 0.591971517f},
-std::array<float,2>{0.349816591f, 0.881677151f},
-std::array<float,2>{0.625913739f, 0.449240267f},
-std::array<float,2>{0.0695906058f, 0.467766792f},
-std::array<float,2>{0.783685923f, 0.8927387f},
-std::array<float,2>{0.342567354f, 0.565482438f},
-std::array<float,2>{0.657154799f, 0.233175412f},
-std::array<float,2>{0.452544898f, 0.119474635f},
-std::array<float,2>{0.555337667f, 0.677596092f},
-std::array<float,2>{0.225292981f, 0.807426989f},
-std::array<float,2>{0.995554805f, 0.346411288f},
-std::array<float,2>{0.268130869f, 0.278769791f},
-std::array<float,2>{0.696992576f, 0.861371338f},
-std::array<float,2>{0.0608974509f, 0.723753989f},
-std::array<float,2>{0.865900815f, 0.0155434264f},
-std::array<float,2>{0.183307722f, 0.130845591f},
-std::array<float,2>{0.921628177f, 0.55931747f},
-std::array<float,2>{0.414560676f, 0.992533803f},
-std::array<float,2>{0.605651677f, 0.415870041f},
-std::array<float,2>{0.200504497f, 0.327628434f},
-std::array<float,2>{0.959458768f, 0.759889007f},
-std::array<float,2>{0.473698914f, 0.630451977f},
-std::array<float,2>{0.504602849f, 0.0866668522f},
-std::array<float,2>{0.360620767f, 0.199087217f},
-std::array<float,2>{0.64639169f, 0.621314764f},
-std::array<float,2>{0.121886708f, 0.910896897f},
-std::array<float,2>{0.755015314f, 0.471892506f},
-std::array<float,2>{0.384704888f, 0.387721241f},
-std::array<float,2>{0.565634489f, 0.939596474f},
-std::array<float,2>{0.136982664f, 0.519414604f},
-std::array<float,2>{0.902664423f, 0.163722068f},
-std::array<float,2>{0.0271050837f, 0.0556681417f},
-std::array<float,2>{0.823506713f, 0.699696302f},
-std::array<float,2>{0.304155171f, 0.831582367f},
-std::array<float,2>{0.746032119f, 0.307623565f},
-std::array<float,2>{0.109662354f, 0.359217763f},
-std::array<float,2>{0.758447945f, 0.801521719f},
-std::array<float,2>{0.374858886f, 0.682420552f},
-std::array<float,2>{0.649046481f, 0.116805002f},
-std::array<float,2>{0.480191201f, 0.224033773f},
-std::array<float,2>{0.515343964f, 0.573271275f},
-std::array<float,2>{0.19439365f, 0.90260762f},
-std::array<float,2>{0.965490878f, 0.459998429f},
-std::array<float,2>{0.309057981f, 0.407444775f},
-std::array<float,2>{0.739638507f, 0.984832764f},
-std::array<float,2>{0.0191753879f, 0.551816761f},
-std::array<float,2>{0.816119492f, 0.138891056f},
-std::array<float,2>{0.12896359f, 0.00377196982f},
-std::array<float,2>{0.895366669f, 0.733829677f},
-std::array<float,2>{0.382616282f, 0.871852577f},
-std::array<float,2>{0.576810122f, 0.272944868f},
-std::array<float,2>{0.228508756f, 0.482009232f},
-std::array<float,2>{0.984697521f, 0.920339823f},
-std::array<float,2>{0.44285363f, 0.613931239f},
-std::array<float,2>{0.548973739f, 0.191947341f},
-std::array<float,2>{0.331812501f, 0.0798797831f},
-std::array<float,2>{0.664603949f, 0.632978678f},
-std::array<float,2>{0.0720866099f, 0.751972973f},
-std::array<float,2>{0.790857792f, 0.313049257f},
-std::array<float,2>{0.413171142f, 0.299267352f},
-std::array<float,2>{0.600953043f, 0.8370561f},
-std::array<float,2>{0.174744979f, 0.695087969f},
-std::array<float,2>{0.910050273f, 0.0500225164f},
-std::array<float,2>{0.0497568175f, 0.170974985f},
-std::array<float,2>{0.872570693f, 0.524788558f},
-std::array<float,2>{0.280983299f, 0.951710224f},
-std::array<float,2>{0.692875028f, 0.381306589f},
-std::array<float,2>{0.00699081086f, 0.391508162f},
-std::array<float,2>{0.828658819f, 0.955943644f},
-std::array<float,2>{0.290985763f, 0.501302302f},
-std::array<float,2>{0.731349289f, 0.175171196f},
-std::array<float,2>{0.401389897f, 0.0319424383f},
-std::array<float,2>{0.587692142f, 0.70328027f},
-std::array<float,2>{0.148185313f, 0.817087293f},
-std::array<float,2>{0.882889271f, 0.28674674f},
-std::array<float,2>{0.357423663f, 0.340995997f},
-std::array<float,2>{0.639482498f, 0.776335239f},
-std::array<float,2>{0.0984621048f, 0.644648612f},
-std::array<float,2>{0.776454985f, 0.0754619241f},
-std::array<float,2>{0.216750041f, 0.216744483f},
-std::array<float,2>{0.945832431f, 0.598662376f},
-std::array<float,2>{0.495256305f, 0.93088764f},
-std::array<float,2>{0.526582837f, 0.498791277f},
-std::array<float,2>{0.158621207f, 0.261494398f},
-std::array<float,2>{0.928471386f, 0.849882901f},
-std::array<float,2>{0.422230989f, 0.740333498f},
-std::array<float,2>{0.61464256f, 0.0259841289f},
-std::array<float,2>{0.252428323f, 0.146313384f},
-std::array<float,2>{0.710030079f, 0.532640874f},
-std::array<float,2>{0.0431589335f, 0.97448343f},
-std::array<float,2>{0.846526802f, 0.427409321f},
-std::array<float,2>{0.45844698f, 0.442861527f},
-std::array<float,2>{0.545806229f, 0.885292649f},
-std::array<float,2>{0.246712282f, 0.581706524f},
-std::array<float,2>{0.97579807f, 0.247617945f},
-std::array<float,2>{0.0843736306f, 0.0965213031f},
-std::array<float,2>{0.810976744f, 0.658598423f},
-std::array<float,2>{0.32376948f, 0.785753965f},
-std::array<float,2>{0.671896219f, 0.366746694f},
-std::array<float,2>{0.0909539759f, 0.26761359f},
-std::array<float,2>{0.799409151f, 0.867398143f},
-std::array<float,2>{0.319760412f, 0.726892054f},
-std::array<float,2>{0.680626214f, 0.00494446512f},
-std::array<float,2>{0.46736306f, 0.134871185f},
-std::array<float,2>{0.538316786f, 0.547729194f},
-std::array<float,2>{0.236673072f, 0.991724133f},
-std::array<float,2>{0.981246412f, 0.410499334f},
-std::array<float,2>{0.260282338f, 0.455408186f},
-std::array<float,2>{0.7111938f, 0.899098694f},
-std::array<float,2>{0.0328567252f, 0.575744331f},
-std::array<float,2>{0.853351712f, 0.222207963f},
-std::array<float,2>{0.1694621f, 0.109558672f},
-std::array<float,2>{0.937049925f, 0.68428427f},
-std::array<float,2>{0.434822679f, 0.797922552f},
-std::array<float,2>{0.622627735f, 0.354318798f},
-std::array<float,2>{0.207264215f, 0.376118124f},
-std::array<float,2>{0.940267086f, 0.94588834f},
-std::array<float,2>{0.485775948f, 0.528973043f},
-std::array<float,2>{0.521505892f, 0.16640918f},
-std::array<float,2>{0.346109539f, 0.0521484129f},
-std::array<float,2>{0.632484376f, 0.691054285f},
-std::array<float,2>{0.108781755f, 0.841299295f},
-std::array<float,2>{0.76918304f, 0.301030844f},
-std::array<float,2>{0.397340745f, 0.316554487f},
-std::array<float,2>{0.58583951f, 0.756318331f},
-std::array<float,2>{0.154150859f, 0.637771428f},
-std::array<float,2>{0.881458104f, 0.0835527107f},
-std::array<float,2>{0.0142235132f, 0.19020167f},
-std::array<float,2>{0.839754283f, 0.609882891f},
-std::array<float,2>{0.288171172f, 0.917185724f},
-std::array<float,2>{0.723008335f, 0.476864845f},
-std::array<float,2>{0.0560796112f, 0.492984951f},
-std::array<float,2>{0.8627491f, 0.936149836f},
-std::array<float,2>{0.273321211f, 0.595374227f},
-std::array<float,2>{0.699618876f, 0.214116707f},
-std::array<float,2>{0.421077609f, 0.07156156f},
-std::array<float,2>{0.605311334f, 0.64449811f},
-std::array<float,2>{0.184735432f, 0.780773044f},
-std::array<float,2>{0.915346563f, 0.336392373f},
-std::array<float,2>{0.337592989f, 0.281498969f},
-std::array<float,2>{0.66249907f, 0.813079655f},
-std::array<float,2>{0.0657323375f, 0.707362115f},
-std::array<float,2>{0.78849864f, 0.0366836078f},
-std::array<float,2>{0.220563501f, 0.177672058f},
-std::array<float,2>{0.996393144f, 0.505205393f},
-std::array<float,2>{0.447640836f, 0.960077465f},
-std::array<float,2>{0.560811698f, 0.397809327f},
-std::array<float,2>{0.132833436f, 0.362748533f},
-std::array<float,2>{0.900541782f, 0.784807026f},
-std::array<float,2>{0.386802822f, 0.660693824f},
-std::array<float,2>{0.567531586f, 0.0977304503f},
-std::array<float,2>{0.299057275f, 0.244666547f},
-std::array<float,2>{0.746603608f, 0.585440874f},
-std::array<float,2>{0.0288090035f, 0.889986932f},
-std::array<float,2>{0.825010002f, 0.437709749f},
-std::array<float,2>{0.470795155f, 0.422296166f},
-std::array<float,2>{0.502827883f, 0.971745551f},
-std::array<float,2>{0.198446631f, 0.537061989f},
-std::array<float,2>{0.954750836f, 0.143572062f},
-std::array<float,2>{0.119601764f, 0.0309735611f},
-std::array<float,2>{0.750220299f, 0.735983849f},
-std::array<float,2>{0.366758615f, 0.847263217f},
-std::array<float,2>{0.644183338f, 0.261818796f},
-std::array<float,2>{0.0230952539f, 0.331049174f},
-std::array<float,2>{0.818501413f, 0.768070579f},
-std::array<float,2>{0.306808114f, 0.654442906f},
-std::array<float,2>{0.734411836f, 0.0635983124f},
-std::array<float,2>{0.378161103f, 0.208250642f},
-std::array<float,2>{0.57356143f, 0.609092236f},
-std::array<float,2>{0.126141056f, 0.927480161f},
-std::array<float,2>{0.892408252f, 0.486410677f},
-std::array<float,2>{0.369504124f, 0.400330871f},
-std::array<float,2>{0.655172408f, 0.965804398f},
-std::array<float,2>{0.115840495f, 0.513979852f},
-std::array<float,2>{0.764870226f, 0.18661426f},
-std::array<float,2>{0.188474074f, 0.0465214923f},
-std::array<float,2>{0.96238786f, 0.718337655f},
-std::array<float,2>{0.482069254f, 0.820480704f},
-std::array<float,2>{0.50829798f, 0.289727032f},
-std::array<float,2>{0.177049205f, 0.445565313f},
-std::array<float,2>{0.911786675f, 0.877247989f},
-std::array<float,2>{0.408279032f, 0.587653041f},
-std::array<float,2>{0.594463348f, 0.234437406f},
-std::array<float,2>{0.277081102f, 0.10409569f},
-std::array<float,2>{0.687876284f, 0.668172956f},
-std::array<float,2>{0.0526816212f, 0.793426931f},
-std::array<float,2>{0.867265284f, 0.373571843f},
-std::array<float,2>{0.440086365f, 0.2575818f},
-std::array<float,2>{0.554567575f, 0.857291222f},
-std::array<float,2>{0.234187797f, 0.742590904f},
-std::array<float,2>{0.99154675f, 0.0162019655f},
-std::array<float,2>{0.0763868541f, 0.153652489f},
-std::array<float,2>{0.796860635f, 0.545851231f},
-std::array<float,2>{0.334100693f, 0.978799701f},
-std::array<float,2>{0.669813991f, 0.43038258f},
-std::array<float,2>{0.0946016535f, 0.419993907f},
-std::array<float,2>{0.78062284f, 0.997315466f},
-std::array<float,2>{0.353641242f, 0.557533979f},
-std::array<float,2>{0.634927154f, 0.127808452f},
-std::array<float,2>{0.496639401f, 0.00932344515f},
-std::array<float,2>{0.528850257f, 0.722507775f},
-std::array<float,2>{0.213591129f, 0.866619349f},
-std::array<float,2>{0.951255798f, 0.274833024f},
-std::array<float,2>{0.2937859f, 0.350056142f},
-std::array<float,2>{0.727391064f, 0.810242236f},
-std::array<float,2>{0.000449517363f, 0.674455106f},
-std::array<float,2>{0.833604217f, 0.122131653f},
-std::array<float,2>{0.142541483f, 0.227881074f},
-std::array<float,2>{0.889940619f, 0.570067704f},
-std::array<float,2>{0.402802289f, 0.897177815f},
-std::array<float,2>{0.591222048f, 0.463013589f},
-std::array<float,2>{0.243503481f, 0.312109321f},
-std::array<float,2>{0.970966518f, 0.835503101f},
-std::array<float,2>{0.455807477f, 0.697179973f},
-std::array<float,2>{0.542831421f, 0.0611988492f},
-std::array<float,2>{0.326186001f, 0.157447875f},
-std::array<float,2>{0.679348707f, 0.520302176f},
-std::array<float,2>{0.078824617f, 0.942819238f},
-std::array<float,2>{0.807960272f, 0.383370876f},
-std::array<float,2>{0.427960664f, 0.476467788f},
-std::array<float,2>{0.612253368f, 0.910038471f},
-std::array<float,2>{0.162478566f, 0.620839715f},
-std::array<float,2>{0.923562944f, 0.200924903f},
-std::array<float,2>{0.0394360051f, 0.0915634707f},
-std::array<float,2>{0.850512803f, 0.625631094f},
-std::array<float,2>{0.256008655f, 0.763498187f},
-std::array<float,2>{0.703380585f, 0.320333779f},
-std::array<float,2>{0.00399754196f, 0.286435634f},
-std::array<float,2>{0.830338061f, 0.816597939f},
-std::array<float,2>{0.292615682f, 0.703749001f},
-std::array<float,2>{0.73301816f, 0.0313585773f},
-std::array<float,2>{0.400333166f, 0.175519973f},
-std::array<float,2>{0.587950468f, 0.501547992f},
-std::array<float,2>{0.146327689f, 0.955345094f},
-std::array<float,2>{0.886234701f, 0.391037166f},
-std::array<float,2>{0.35659799f, 0.498296648f},
-std::array<float,2>{0.63834852f, 0.93157661f},
-std::array<float,2>{0.100442395f, 0.599440157f},
-std::array<float,2>{0.773605704f, 0.216149643f},
-std::array<float,2>{0.216953546f, 0.0760008246f},
-std::array<float,2>{0.948950768f, 0.645271719f},
-std::array<float,2>{0.493167728f, 0.775789678f},
-std::array<float,2>{0.52419126f, 0.341603994f},
-std::array<float,2>{0.157918215f, 0.427081138f},
-std::array<float,2>{0.927534163f, 0.973663211f},
-std::array<float,2>{0.425740689f, 0.532919824f},
-std::array<float,2>{0.616540372f, 0.145964697f},
-std::array<float,2>{0.250897527f, 0.0258423667f},
-std::array<float,2>{0.707950234f, 0.740819156f},
-std::array<float,2>{0.0456243977f, 0.850286841f},
-std::array<float,2>{0.843955815f, 0.261199504f},
-std::array<float,2>{0.460404962f, 0.366302878f},
-std::array<float,2>{0.54442358f, 0.78555274f},
-std::array<float,2>{0.248163804f, 0.658959627f},
-std::array<float,2>{0.972799659f, 0.0961235836f},
-std::array<float,2>{0.0821765438f, 0.24731566f},
-std::array<float,2>{0.808774412f, 0.581372499f},
-std::array<float,2>{0.320345342f, 0.885198712f},
-std::array<float,2>{0.6742118f, 0.443132997f},
-std::array<float,2>{0.112137325f, 0.46091491f},
-std::array<float,2>{0.761342883f, 0.90310353f},
-std::array<float,2>{0.371687919f, 0.574051261f},
-std::array<float,2>{0.652304292f, 0.224271774f},
-std::array<float,2>{0.477664918f, 0.116495505f},
-std::array<float,2>{0.512304068f, 0.681744754f},
-std::array<float,2>{0.192981049f, 0.801127493f},
-std::array<float,2>{0.968007445f, 0.358640224f},
-std::array<float,2>{0.312423468f, 0.273393065f},
-std::array<float,2>{0.741043985f, 0.871142983f},
-std::array<float,2>{0.0161669217f, 0.734197795f},
-std::array<float,2>{0.813467443f, 0.00315000187f},
-std::array<float,2>{0.131156906f, 0.139629707f},
-std::array<float,2>{0.897583663f, 0.55272156f},
-std::array<float,2>{0.378952801f, 0.985161126f},
-std::array<float,2>{0.575267196f, 0.408168286f},
-std::array<float,2>{0.228753641f, 0.312727571f},
-std::array<float,2>{0.988133013f, 0.752829969f},
-std::array<float,2>{0.443980962f, 0.63353318f},
-std::array<float,2>{0.547164917f, 0.0793989077f},
-std::array<float,2>{0.328687191f, 0.191678941f},
-std::array<float,2>{0.667197287f, 0.613767505f},
-std::array<float,2>{0.0740958825f, 0.920551836f},
-std::array<float,2>{0.792578876f, 0.481621444f},
-std::array<float,2>{0.411011189f, 0.381441504f},
-std::array<float,2>{0.598206818f, 0.951453745f},
-std::array<float,2>{0.172014832f, 0.525091827f},
-std::array<float,2>{0.907731056f, 0.171814755f},
-std::array<float,2>{0.0476647615f, 0.0506261736f},
-std::array<float,2>{0.874712527f, 0.694577277f},
-std::array<float,2>{0.278826624f, 0.837690771f},
-std::array<float,2>{0.695288897f, 0.29947558f},
-std::array<float,2>{0.0682336092f, 0.345751852f},
-std::array<float,2>{0.782947361f, 0.806970537f},
-std::array<float,2>{0.341120541f, 0.676864862f},
-std::array<float,2>{0.658257008f, 0.12003196f},
-std::array<float,2>{0.449998707f, 0.232739359f},
-std::array<float,2>{0.558413386f, 0.566056669f},
-std::array<float,2>{0.223520473f, 0.893211842f},
-std::array<float,2>{0.992427826f, 0.467174649f},
-std::array<float,2>{0.26618728f, 0.415238827f},
-std::array<float,2>{0.698051393f, 0.992839694f},
-std::array<float,2>{0.0598526187f, 0.558642089f},
-std::array<float,2>{0.864354134f, 0.130193442f},
-std::array<float,2>{0.180032894f, 0.0150362682f},
-std::array<float,2>{0.918990791f, 0.724342942f},
-std::array<float,2>{0.416401863f, 0.861900628f},
-std::array<float,2>{0.609081328f, 0.279213548f},
-std::array<float,2>{0.2018511f, 0.472598374f},
-std::array<float,2>{0.957627654f, 0.910227716f},
-std::array<float,2>{0.476462305f, 0.621696651f},
-std::array<float,2>{0.507537842f, 0.198347464f},
-std::array<float,2>{0.362459928f, 0.0861231908f},
-std::array<float,2>{0.646894932f, 0.630057156f},
-std::array<float,2>{0.124525703f, 0.760489643f},
-std::array<float,2>{0.757321477f, 0.327949554f},
-std::array<float,2>{0.385597318f, 0.308186352f},
-std::array<float,2>{0.562682211f, 0.831263423f},
-std::array<float,2>{0.140386656f, 0.699866533f},
-std::array<float,2>{0.904321253f, 0.0565358773f},
-std::array<float,2>{0.0236552581f, 0.163310498f},
-std::array<float,2>{0.822024822f, 0.519003749f},
-std::array<float,2>{0.301142514f, 0.940095186f},
-std::array<float,2>{0.743661404f, 0.388212591f},
-std::array<float,2>{0.0373382308f, 0.40376702f},
-std::array<float,2>{0.858218729f, 0.963793099f},
-std::array<float,2>{0.265557468f, 0.510942936f},
-std::array<float,2>{0.715532601f, 0.181120157f},
-std::array<float,2>{0.432314187f, 0.0393448807f},
-std::array<float,2>{0.618124247f, 0.712551355f},
-std::array<float,2>{0.166853562f, 0.82554847f},
-std::array<float,2>{0.930284798f, 0.293302268f},
-std::array<float,2>{0.315620989f, 0.335536122f},
-std::array<float,2>{0.684709251f, 0.772880971f},
-std::array<float,2>{0.0860622004f, 0.651480675f},
-std::array<float,2>{0.802777469f, 0.0682225153f},
-std::array<float,2>{0.240377769f, 0.204961345f},
-std::array<float,2>{0.978945792f, 0.603928745f},
-std::array<float,2>{0.464044631f, 0.922715843f},
-std::array<float,2>{0.534088254f, 0.490699321f},
-std::array<float,2>{0.148660988f, 0.250171661f},
-std::array<float,2>{0.877635121f, 0.854332209f},
-std::array<float,2>{0.392305672f, 0.748551548f},
-std::array<float,2>{0.581152678f, 0.0207494926f},
-std::array<float,2>{0.284542501f, 0.151305377f},
-std::array<float,2>{0.719232023f, 0.539816499f},
-std::array<float,2>{0.0101674562f, 0.984249055f},
-std::array<float,2>{0.8405779f, 0.435776711f},
-std::array<float,2>{0.489203125f, 0.450015545f},
-std::array<float,2>{0.515773237f, 0.88090694f},
-std::array<float,2>{0.204836011f, 0.592728257f},
-std::array<float,2>{0.943522811f, 0.242050335f},
-std::array<float,2>{0.103433624f, 0.109034382f},
-std::array<float,2>{0.771125615f, 0.66674912f},
-std::array<float,2>{0.349549979f, 0.792627335f},
-std::array<float,2>{0.628805339f, 0.368713707f},
-std::array<float,2>{0.0966538787f, 0.274940163f},
-std::array<float,2>{0.777863383f, 0.866700649f},
-std::array<float,2>{0.353160441f, 0.721790612f},
-std::array<float,2>{0.634452641f, 0.00901149865f},
-std::array<float,2>{0.498096645f, 0.127215251f},
-std::array<float,2>{0.529382765f, 0.556919754f},
-std::array<float,2>{0.21192871f, 0.997917235f},
-std::array<float,2>{0.950356603f, 0.420515716f},
-std::array<float,2>{0.295764089f, 0.46379137f},
-std::array<float,2>{0.729229748f, 0.896656871f},
-std::array<float,2>{0.00202821987f, 0.569484711f},
-std::array<float,2>{0.834145188f, 0.228473544f},
-std::array<float,2>{0.143647507f, 0.122725949f},
-std::array<float,2>{0.886774182f, 0.673921585f},
-std::array<float,2>{0.405548155f, 0.809766531f},
-std::array<float,2>{0.593504369f, 0.350495905f},
-std::array<float,2>{0.245254666f, 0.383274078f},
-std::array<float,2>{0.97044903f, 0.942882657f},
-std::array<float,2>{0.454423845f, 0.519655824f},
-std::array<float,2>{0.539711058f, 0.157829508f},
-std::array<float,2>{0.324497193f, 0.061001569f},
-std::array<float,2>{0.676200271f, 0.696308613f},
-std::array<float,2>{0.082002461f, 0.835188508f},
-std::array<float,2>{0.805213213f, 0.311887294f},
-std::array<float,2>{0.427732348f, 0.320891738f},
-std::array<float,2>{0.611154914f, 0.76285547f},
-std::array<float,2>{0.160279989f, 0.625041544f},
-std::array<float,2>{0.923901558f, 0.0911018327f},
-std::array<float,2>{0.0414744206f, 0.200560376f},
-std::array<float,2>{0.848838389f, 0.620526314f},
-std::array<float,2>{0.255431056f, 0.909205616f},
-std::array<float,2>{0.705088794f, 0.475839943f},
-std::array<float,2>{0.02045119f, 0.487008333f},
-std::array<float,2>{0.816741586f, 0.92710042f},
-std::array<float,2>{0.305414915f, 0.608644187f},
-std::array<float,2>{0.736822784f, 0.208799735f},
-std::array<float,2>{0.375091851f, 0.0641604364f},
-std::array<float,2>{0.57109493f, 0.655226469f},
-std::array<float,2>{0.128480852f, 0.767961979f},
-std::array<float,2>{0.893710971f, 0.330515414f},
-std::array<float,2>{0.367655456f, 0.289459825f},
-std::array<float,2>{0.653784215f, 0.821039379f},
-std::array<float,2>{0.114373989f, 0.717862189f},
-std::array<float,2>{0.763148487f, 0.0461362191f},
-std::array<float,2>{0.190116376f, 0.187399507f},
-std::array<float,2>{0.963094115f, 0.514349043f},
-std::array<float,2>{0.482669562f, 0.965178072f},
-std::array<float,2>{0.511347592f, 0.3995713f},
-std::array<float,2>{0.178740725f, 0.373433411f},
-std::array<float,2>{0.914037228f, 0.793621182f},
-std::array<float,2>{0.406825095f, 0.668894947f},
-std::array<float,2>{0.596883059f, 0.103673913f},
-std::array<float,2>{0.275069356f, 0.235270619f},
-std::array<float,2>{0.689840019f, 0.587076843f},
-std::array<float,2>{0.0528510734f, 0.877900779f},
-std::array<float,2>{0.869301975f, 0.446215808f},
-std::array<float,2>{0.438402742f, 0.429835796f},
-std::array<float,2>{0.552034199f, 0.979403138f},
-std::array<float,2>{0.231648162f, 0.545046389f},
-std::array<float,2>{0.989713073f, 0.154172033f},
-std::array<float,2>{0.0761688352f, 0.0160357598f},
-std::array<float,2>{0.794248462f, 0.742789328f},
-std::array<float,2>{0.332829237f, 0.856858313f},
-std::array<float,2>{0.67182219f, 0.257074028f},
-std::array<float,2>{0.0581522621f, 0.336890668f},
-std::array<float,2>{0.860968113f, 0.780720115f},
-std::array<float,2>{0.269800305f, 0.643856227f},
-std::array<float,2>{0.701310813f, 0.0718777105f},
-std::array<float,2>{0.418708593f, 0.21466963f},
-std::array<float,2>{0.602832496f, 0.595093071f},
-std::array<float,2>{0.185563415f, 0.935983121f},
-std::array<float,2>{0.916501343f, 0.492335349f},
-std::array<float,2>{0.337964058f, 0.398197144f},
-std::array<float,2>{0.660240054f, 0.960607171f},
-std::array<float,2>{0.0634605363f, 0.50579226f},
-std::array<float,2>{0.786590934f, 0.177142322f},
-std::array<float,2>{0.221960187f, 0.036214225f},
-std::array<float,2>{0.998661935f, 0.707524538f},
-std::array<float,2>{0.446773499f, 0.812636316f},
-std::array<float,2>{0.559664488f, 0.281793058f},
-std::array<float,2>{0.136384815f, 0.438099474f},
-std::array<float,2>{0.899418831f, 0.890174985f},
-std::array<float,2>{0.390484631f, 0.585590482f},
-std::array<float,2>{0.568645775f, 0.244607836f},
-std::array<float,2>{0.297848076f, 0.0984885767f},
-std::array<float,2>{0.748128414f, 0.660269082f},
-std::array<float,2>{0.0303009059f, 0.784579158f},
-std::array<float,2>{0.826631188f, 0.36299175f},
-std::array<float,2>{0.470183551f, 0.262674809f},
-std::array<float,2>{0.501546085f, 0.846972764f},
-std::array<float,2>{0.196158648f, 0.735537827f},
-std::array<float,2>{0.955233932f, 0.0307267178f},
-std::array<float,2>{0.118412331f, 0.144453079f},
-std::array<float,2>{0.753850698f, 0.536156118f},
-std::array<float,2>{0.363966584f, 0.972289622f},
-std::array<float,2>{0.64216888f, 0.422811568f},
-std::array<float,2>{0.0932270065f, 0.410893351f},
-std::array<float,2>{0.798227966f, 0.991222441f},
-std::array<float,2>{0.316496491f, 0.547132134f},
-std::array<float,2>{0.683336079f, 0.135463491f},
-std::array<float,2>{0.466675997f, 0.00566636911f},
-std::array<float,2>{0.536368012f, 0.727073014f},
-std::array<float,2>{0.235818565f, 0.867774248f},
-std::array<float,2>{0.982663035f, 0.268293202f},
-std::array<float,2>{0.258496076f, 0.353749722f},
-std::array<float,2>{0.713192403f, 0.798386037f},
-std::array<float,2>{0.035063114f, 0.683751106f},
-std::array<float,2>{0.854338586f, 0.110204458f},
-std::array<float,2>{0.170819938f, 0.22206305f},
-std::array<float,2>{0.934336364f, 0.575429022f},
-std::array<float,2>{0.437401712f, 0.898859859f},
-std::array<float,2>{0.623065054f, 0.455752641f},
-std::array<float,2>{0.209470779f, 0.301642179f},
-std::array<float,2>{0.938411713f, 0.841748655f},
-std::array<float,2>{0.487129509f, 0.690865815f},
-std::array<float,2>{0.519932568f, 0.0526171885f},
-std::array<float,2>{0.345189452f, 0.166507035f},
-std::array<float,2>{0.630041659f, 0.528497398f},
-std::array<float,2>{0.10732393f, 0.945789456f},
-std::array<float,2>{0.766641915f, 0.376539916f},
-std::array<float,2>{0.396403104f, 0.477329016f},
-std::array<float,2>{0.583361924f, 0.917864561f},
-std::array<float,2>{0.155452177f, 0.60978502f},
-std::array<float,2>{0.880191088f, 0.189786986f},
-std::array<float,2>{0.0129688503f, 0.0833110958f},
-std::array<float,2>{0.836296022f, 0.638388991f},
-std::array<float,2>{0.285979271f, 0.756369352f},
-std::array<float,2>{0.725179553f, 0.317077726f},
-std::array<float,2>{0.0435763821f, 0.257826567f},
-std::array<float,2>{0.846060157f, 0.848398149f},
-std::array<float,2>{0.252653778f, 0.740154922f},
-std::array<float,2>{0.710716605f, 0.0250537544f},
-std::array<float,2>{0.422516078f, 0.147374988f},
-std::array<float,2>{0.615100741f, 0.533324897f},
-std::array<float,2>{0.158801228f, 0.9755615f},
-std::array<float,2>{0.928136349f, 0.427911729f},
-std::array<float,2>{0.323252827f, 0.443744928f},
-std::array<float,2>{0.672515213f, 0.884305239f},
-std::array<float,2>{0.0847552344f, 0.579368412f},
-std::array<float,2>{0.811389863f, 0.249121517f},
-std::array<float,2>{0.246110141f, 0.0947217047f},
-std::array<float,2>{0.976292729f, 0.656261444f},
-std::array<float,2>{0.458698004f, 0.787587285f},
-std::array<float,2>{0.545235991f, 0.36360997f},
-std::array<float,2>{0.1478232f, 0.393758386f},
-std::array<float,2>{0.883691609f, 0.953864872f},
-std::array<float,2>{0.402045041f, 0.502765596f},
-std::array<float,2>{0.587398767f, 0.172221646f},
-std::array<float,2>{0.290329844f, 0.0341252647f},
-std::array<float,2>{0.730950534f, 0.70677197f},
-std::array<float,2>{0.0074062855f, 0.81872803f},
-std::array<float,2>{0.828475296f, 0.288037509f},
-std::array<float,2>{0.495844603f, 0.34241274f},
-std::array<float,2>{0.526931942f, 0.77523762f},
-std::array<float,2>{0.216246933f, 0.647569418f},
-std::array<float,2>{0.945722461f, 0.0779525712f},
-std::array<float,2>{0.0981308147f, 0.218372673f},
-std::array<float,2>{0.776890397f, 0.600444317f},
-std::array<float,2>{0.358098358f, 0.932117879f},
-std::array<float,2>{0.638797879f, 0.497273147f},
-std::array<float,2>{0.0714894012f, 0.482531756f},
-std::array<float,2>{0.790405631f, 0.919255793f},
-std::array<float,2>{0.331486106f, 0.616997719f},
-std::array<float,2>{0.664129436f, 0.195089936f},
-std::array<float,2>{0.443069518f, 0.0805778801f},
-std::array<float,2>{0.549803734f, 0.635068357f},
-std::array<float,2>{0.22762017f, 0.751155019f},
-std::array<float,2>{0.985193491f, 0.314619631f},
-std::array<float,2>{0.280314267f, 0.297958225f},
-std::array<float,2>{0.692407429f, 0.838533878f},
-std::array<float,2>{0.0492824577f, 0.691911936f},
-std::array<float,2>{0.872093141f, 0.0477935523f},
-std::array<float,2>{0.174211651f, 0.169712603f},
-std::array<float,2>{0.909574986f, 0.527166903f},
-std::array<float,2>{0.413938522f, 0.950674355f},
-std::array<float,2>{0.601331294f, 0.379045278f},
-std::array<float,2>{0.195288569f, 0.355760962f},
-std::array<float,2>{0.965079546f, 0.804333448f},
-std::array<float,2>{0.479875267f, 0.679763556f},
-std::array<float,2>{0.514677942f, 0.115223005f},
-std::array<float,2>{0.374406189f, 0.224914432f},
-std::array<float,2>{0.648890793f, 0.572045088f},
-std::array<float,2>{0.110333338f, 0.906066537f},
-std::array<float,2>{0.758290529f, 0.457727432f},
-std::array<float,2>{0.382291645f, 0.408452868f},
-std::array<float,2>{0.576483071f, 0.987392247f},
-std::array<float,2>{0.129659519f, 0.554460645f},
-std::array<float,2>{0.894778669f, 0.137033001f},
-std::array<float,2>{0.0188845303f, 0.000623549917f},
-std::array<float,2>{0.815443695f, 0.732288659f},
-std::array<float,2>{0.309339225f, 0.874926686f},
-std::array<float,2>{0.739944518f, 0.271144807f},
-std::array<float,2>{0.121475317f, 0.325826079f},
-std::array<float,2>{0.75557971f, 0.758836269f},
-std::array<float,2>{0.361005336f, 0.631181598f},
-std::array<float,2>{0.645627081f, 0.0896570161f},
-std::array<float,2>{0.474455595f, 0.19705762f},
-std::array<float,2>{0.504006684f, 0.623286486f},
-std::array<float,2>{0.201080769f, 0.912806869f},
-std::array<float,2>{0.959564865f, 0.468914986f},
-std::array<float,2>{0.304277301f, 0.390185863f},
-std::array<float,2>{0.74551928f, 0.938282967f},
-std::array<float,2>{0.0267032944f, 0.517228305f},
-std::array<float,2>{0.823900521f, 0.160344303f},
-std::array<float,2>{0.137397751f, 0.0583914816f},
-std::array<float,2>{0.903090656f, 0.702286959f},
-std::array<float,2>{0.383817941f, 0.828846335f},
-std::array<float,2>{0.566005886f, 0.305240065f},
-std::array<float,2>{0.224914834f, 0.464992046f},
-std::array<float,2>{0.995842755f, 0.890688181f},
-std::array<float,2>{0.452752233f, 0.564195931f},
-std::array<float,2>{0.55516839f, 0.230918184f},
-std::array<float,2>{0.341939151f, 0.118198432f},
-std::array<float,2>{0.656324923f, 0.678833902f},
-std::array<float,2>{0.0700121075f, 0.804829895f},
-std::array<float,2>{0.783969045f, 0.34411338f},
-std::array<float,2>{0.414252907f, 0.280902267f},
-std::array<float,2>{0.606201708f, 0.859377682f},
-std::array<float,2>{0.182930142f, 0.724830329f},
-std::array<float,2>{0.92130214f, 0.0117451893f},
-std::array<float,2>{0.0611876361f, 0.131342635f},
-std::array<float,2>{0.865547061f, 0.5622105f},
-std::array<float,2>{0.267754346f, 0.996038258f},
-std::array<float,2>{0.696509957f, 0.417031318f},
-std::array<float,2>{0.00785100739f, 0.43543756f},
-std::array<float,2>{0.843693852f, 0.981984794f},
-std::array<float,2>{0.282699436f, 0.542016029f},
-std::array<float,2>{0.721531034f, 0.15011242f},
-std::array<float,2>{0.39314428f, 0.0219198149f},
-std::array<float,2>{0.578675091f, 0.747452259f},
-std::array<float,2>{0.151133358f, 0.85189867f},
-std::array<float,2>{0.875365853f, 0.253406614f},
-std::array<float,2>{0.350138485f, 0.369758874f},
-std::array<float,2>{0.625322282f, 0.790371537f},
-std::array<float,2>{0.105246671f, 0.665485024f},
-std::array<float,2>{0.771639764f, 0.106913224f},
-std::array<float,2>{0.20697619f, 0.238389418f},
-std::array<float,2>{0.941557527f, 0.590230584f},
-std::array<float,2>{0.491837859f, 0.88053757f},
-std::array<float,2>{0.519060016f, 0.451751888f},
-std::array<float,2>{0.165577844f, 0.296444625f},
-std::array<float,2>{0.932887614f, 0.827354431f},
-std::array<float,2>{0.431500524f, 0.714197934f},
-std::array<float,2>{0.619829953f, 0.0414755717f},
-std::array<float,2>{0.262358725f, 0.182289734f},
-std::array<float,2>{0.717745543f, 0.509482086f},
-std::array<float,2>{0.0366118401f, 0.961976051f},
-std::array<float,2>{0.85713613f, 0.40574351f},
-std::array<float,2>{0.462755263f, 0.488316178f},
-std::array<float,2>{0.531530261f, 0.925713658f},
-std::array<float,2>{0.239612296f, 0.60276258f},
-std::array<float,2>{0.976891041f, 0.206998274f},
-std::array<float,2>{0.0887062624f, 0.0703107044f},
-std::array<float,2>{0.802562177f, 0.649351597f},
-std::array<float,2>{0.313826919f, 0.769814551f},
-std::array<float,2>{0.686197221f, 0.333066881f},
-std::array<float,2>{0.0784985349f, 0.309982359f},
-std::array<float,2>{0.808312237f, 0.83206296f},
-std::array<float,2>{0.326842278f, 0.697999895f},
-std::array<float,2>{0.679095209f, 0.0587771945f},
-std::array<float,2>{0.45551762f, 0.160042137f},
-std::array<float,2>{0.54214102f, 0.522337437f},
-std::array<float,2>{0.243999287f, 0.944835603f},
-std::array<float,2>{0.971434832f, 0.385108739f},
-std::array<float,2>{0.256794274f, 0.474443406f},
-std::array<float,2>{0.703893125f, 0.906393826f},
-std::array<float,2>{0.0399644263f, 0.618964434f},
-std::array<float,2>{0.849973917f, 0.202652007f},
-std::array<float,2>{0.163026839f, 0.0923797488f},
-std::array<float,2>{0.92310375f, 0.628810763f},
-std::array<float,2>{0.428329557f, 0.765293777f},
-std::array<float,2>{0.611532331f, 0.323234022f},
-std::array<float,2>{0.213143006f, 0.419413894f},
-std::array<float,2>{0.952083945f, 0.999102771f},
-std::array<float,2>{0.496364981f, 0.556310415f},
-std::array<float,2>{0.528651655f, 0.126748636f},
-std::array<float,2>{0.354065984f, 0.0107698543f},
-std::array<float,2>{0.63563329f, 0.719985962f},
-std::array<float,2>{0.0938480496f, 0.863532782f},
-std::array<float,2>{0.780777931f, 0.276446253f},
-std::array<float,2>{0.402861625f, 0.34886834f},
-std::array<float,2>{0.591489255f, 0.811011553f},
-std::array<float,2>{0.142019793f, 0.67336452f},
-std::array<float,2>{0.890172064f, 0.123373449f},
-std::array<float,2>{0.000765068457f, 0.230175212f},
-std::array<float,2>{0.833298445f, 0.567403078f},
-std::array<float,2>{0.293138772f, 0.895785809f},
-std::array<float,2>{0.726684093f, 0.461889744f},
-std::array<float,2>{0.0517609753f, 0.448960841f},
-std::array<float,2>{0.867722809f, 0.875117123f},
-std::array<float,2>{0.276667029f, 0.588624358f},
-std::array<float,2>{0.688314974f, 0.236512989f},
-std::array<float,2>{0.408767253f, 0.102038242f},
-std::array<float,2>{0.593774974f, 0.670435548f},
-std::array<float,2>{0.177367359f, 0.79670918f},
-std::array<float,2>{0.911187291f, 0.372828513f},
-std::array<float,2>{0.334857196f, 0.255630583f},
-std::array<float,2>{0.669341803f, 0.857951641f},
-std::array<float,2>{0.0769966841f, 0.745587051f},
-std::array<float,2>{0.796107113f, 0.0192394014f},
-std::array<float,2>{0.233582243f, 0.155014977f},
-std::array<float,2>{0.991800427f, 0.544091403f},
-std::array<float,2>{0.439739108f, 0.976724863f},
-std::array<float,2>{0.553850532f, 0.432904065f},
-std::array<float,2>{0.126778275f, 0.328504443f},
-std::array<float,2>{0.89186132f, 0.767235339f},
-std::array<float,2>{0.378634274f, 0.654044688f},
-std::array<float,2>{0.573969901f, 0.0659920126f},
-std::array<float,2>{0.307590961f, 0.21093075f},
-std::array<float,2>{0.735015035f, 0.607386112f},
-std::array<float,2>{0.0227818619f, 0.928716004f},
-std::array<float,2>{0.819297433f, 0.486298442f},
-std::array<float,2>{0.481806993f, 0.400489718f},
-std::array<float,2>{0.508740008f, 0.968655467f},
-std::array<float,2>{0.187962428f, 0.512507856f},
-std::array<float,2>{0.962624729f, 0.184739366f},
-std::array<float,2>{0.115619324f, 0.0444260128f},
-std::array<float,2>{0.765174448f, 0.715350211f},
-std::array<float,2>{0.369849563f, 0.823471189f},
-std::array<float,2>{0.654463053f, 0.291911095f},
-std::array<float,2>{0.0286277197f, 0.361160249f},
-std::array<float,2>{0.824616969f, 0.782808244f},
-std::array<float,2>{0.29936564f, 0.662829578f},
-std::array<float,2>{0.746508062f, 0.10123869f},
-std::array<float,2>{0.387496978f, 0.244044542f},
-std::array<float,2>{0.56795603f, 0.583829045f},
-std::array<float,2>{0.133748069f, 0.888557732f},
-std::array<float,2>{0.901006579f, 0.440581143f},
-std::array<float,2>{0.366548955f, 0.42568776f},
-std::array<float,2>{0.643582284f, 0.969268978f},
-std::array<float,2>{0.120114073f, 0.537701905f},
-std::array<float,2>{0.750518978f, 0.140766218f},
-std::array<float,2>{0.19916144f, 0.0285990424f},
-std::array<float,2>{0.954463899f, 0.737269819f},
-std::array<float,2>{0.471358508f, 0.843780577f},
-std::array<float,2>{0.502349317f, 0.264941365f},
-std::array<float,2>{0.185371682f, 0.494621307f},
-std::array<float,2>{0.915731907f, 0.934446216f},
-std::array<float,2>{0.421471775f, 0.597621262f},
-std::array<float,2>{0.604666948f, 0.211606771f},
-std::array<float,2>{0.27279976f, 0.0738703012f},
-std::array<float,2>{0.699879229f, 0.642504334f},
-std::array<float,2>{0.0562030189f, 0.777388871f},
-std::array<float,2>{0.862873852f, 0.338673621f},
-std::array<float,2>{0.448190629f, 0.284400851f},
-std::array<float,2>{0.561411321f, 0.815964043f},
-std::array<float,2>{0.219745755f, 0.710898399f},
-std::array<float,2>{0.996932924f, 0.0371955633f},
-std::array<float,2>{0.066092886f, 0.178062022f},
-std::array<float,2>{0.788785517f, 0.506663144f},
-std::array<float,2>{0.337350905f, 0.957834959f},
-std::array<float,2>{0.662706077f, 0.395669341f},
-std::array<float,2>{0.109178498f, 0.377393216f},
-std::array<float,2>{0.768796027f, 0.948839307f},
-std::array<float,2>{0.346318632f, 0.531126916f},
-std::array<float,2>{0.632000268f, 0.165975362f},
-std::array<float,2>{0.485945553f, 0.0544695742f},
-std::array<float,2>{0.522308052f, 0.688364029f},
-std::array<float,2>{0.207774311f, 0.842123747f},
-std::array<float,2>{0.939591408f, 0.303787947f},
-std::array<float,2>{0.288794279f, 0.319414735f},
-std::array<float,2>{0.723593771f, 0.754763365f},
-std::array<float,2>{0.0138175925f, 0.639745891f},
-std::array<float,2>{0.838925242f, 0.0858964846f},
-std::array<float,2>{0.153777823f, 0.188891023f},
-std::array<float,2>{0.880951524f, 0.612199783f},
-std::array<float,2>{0.39692539f, 0.914674938f},
-std::array<float,2>{0.585422099f, 0.480127692f},
-std::array<float,2>{0.237283424f, 0.266681582f},
-std::array<float,2>{0.98078686f, 0.869567752f},
-std::array<float,2>{0.466900378f, 0.730220854f},
-std::array<float,2>{0.538993299f, 0.0075824447f},
-std::array<float,2>{0.319963545f, 0.134135038f},
-std::array<float,2>{0.680006623f, 0.549348831f},
-std::array<float,2>{0.0915889665f, 0.988397002f},
-std::array<float,2>{0.798955917f, 0.412960052f},
-std::array<float,2>{0.435199618f, 0.454993606f},
-std::array<float,2>{0.62248069f, 0.901955664f},
-std::array<float,2>{0.169222146f, 0.577035427f},
-std::array<float,2>{0.936595857f, 0.220165908f},
-std::array<float,2>{0.0322933011f, 0.112467498f},
-std::array<float,2>{0.85283643f, 0.686287045f},
-std::array<float,2>{0.259834021f, 0.800637782f},
-std::array<float,2>{0.711791575f, 0.351792425f},
-std::array<float,2>{0.0171608049f, 0.269848347f},
-std::array<float,2>{0.814328492f, 0.873439491f},
-std::array<float,2>{0.311464459f, 0.731056452f},
-std::array<float,2>{0.742125154f, 0.00131002883f},
-std::array<float,2>{0.380243838f, 0.137930021f},
-std::array<float,2>{0.575124979f, 0.552745163f},
-std::array<float,2>{0.132000297f, 0.986658156f},
-std::array<float,2>{0.896597981f, 0.409461439f},
-std::array<float,2>{0.37215212f, 0.458185971f},
-std::array<float,2>{0.650807202f, 0.904882669f},
-std::array<float,2>{0.113098852f, 0.570359647f},
-std::array<float,2>{0.760716558f, 0.226387694f},
-std::array<float,2>{0.191633046f, 0.11345771f},
-std::array<float,2>{0.967561185f, 0.68149823f},
-std::array<float,2>{0.476778388f, 0.802936018f},
-std::array<float,2>{0.513201296f, 0.35668686f},
-std::array<float,2>{0.173022121f, 0.380536199f},
-std::array<float,2>{0.907208204f, 0.949223995f},
-std::array<float,2>{0.411202431f, 0.526153326f},
-std::array<float,2>{0.598699808f, 0.168685555f},
-std::array<float,2>{0.277665854f, 0.0481664762f},
-std::array<float,2>{0.693985581f, 0.693337679f},
-std::array<float,2>{0.048495885f, 0.839759409f},
-std::array<float,2>{0.873116851f, 0.297545254f},
-std::array<float,2>{0.444622695f, 0.315675735f},
-std::array<float,2>{0.548722804f, 0.75090313f},
-std::array<float,2>{0.230074137f, 0.63590014f},
-std::array<float,2>{0.98714453f, 0.0817410722f},
-std::array<float,2>{0.0729073733f, 0.193917185f},
-std::array<float,2>{0.791607499f, 0.615765333f},
-std::array<float,2>{0.33006224f, 0.918165922f},
-std::array<float,2>{0.666505992f, 0.484003961f},
-std::array<float,2>{0.101443052f, 0.49628067f},
-std::array<float,2>{0.775173008f, 0.933425844f},
-std::array<float,2>{0.356335044f, 0.601027489f},
-std::array<float,2>{0.637293279f, 0.217659175f},
-std::array<float,2>{0.493162543f, 0.0762500465f},
-std::array<float,2>{0.525100708f, 0.646633625f},
-std::array<float,2>{0.218331769f, 0.774399281f},
-std::array<float,2>{0.947517037f, 0.343257099f},
-std::array<float,2>{0.29155457f, 0.288657874f},
-std::array<float,2>{0.734237552f, 0.819499075f},
-std::array<float,2>{0.00535665452f, 0.705893099f},
-std::array<float,2>{0.831352293f, 0.034851525f},
-std::array<float,2>{0.14492479f, 0.172851741f},
-std::array<float,2>{0.885089755f, 0.503210127f},
-std::array<float,2>{0.399160773f, 0.955029726f},
-std::array<float,2>{0.589433849f, 0.393047065f},
-std::array<float,2>{0.249998167f, 0.364658445f},
-std::array<float,2>{0.974033654f, 0.788451195f},
-std::array<float,2>{0.459561259f, 0.657263339f},
-std::array<float,2>{0.543210685f, 0.0955448747f},
-std::array<float,2>{0.321688235f, 0.248691231f},
-std::array<float,2>{0.675678313f, 0.578429818f},
-std::array<float,2>{0.0832777843f, 0.88354212f},
-std::array<float,2>{0.810545325f, 0.444495857f},
-std::array<float,2>{0.42457521f, 0.429384798f},
-std::array<float,2>{0.615942061f, 0.975909531f},
-std::array<float,2>{0.156943396f, 0.534426868f},
-std::array<float,2>{0.926072955f, 0.148278639f},
-std::array<float,2>{0.0462011658f, 0.0241464674f},
-std::array<float,2>{0.845195949f, 0.739148736f},
-std::array<float,2>{0.251811504f, 0.849580765f},
-std::array<float,2>{0.708230078f, 0.259613305f},
-std::array<float,2>{0.0873995721f, 0.332947254f},
-std::array<float,2>{0.804550827f, 0.770988047f},
-std::array<float,2>{0.314638764f, 0.649567366f},
-std::array<float,2>{0.684375048f, 0.0686179996f},
-std::array<float,2>{0.463499963f, 0.205165446f},
-std::array<float,2>{0.53502208f, 0.601637304f},
-std::array<float,2>{0.241610155f, 0.92478925f},
-std::array<float,2>{0.980334818f, 0.490166515f},
-std::array<float,2>{0.263733447f, 0.40468356f},
-std::array<float,2>{0.715901315f, 0.961635351f},
-std::array<float,2>{0.0387954935f, 0.50826323f},
-std::array<float,2>{0.858510017f, 0.183156982f},
-std::array<float,2>{0.16746223f, 0.0422297865f},
-std::array<float,2>{0.931594372f, 0.713255882f},
-std::array<float,2>{0.433097959f, 0.826482594f},
-std::array<float,2>{0.618647218f, 0.295815259f},
-std::array<float,2>{0.203665361f, 0.45224601f},
-std::array<float,2>{0.944560468f, 0.879317224f},
-std::array<float,2>{0.489412814f, 0.591463149f},
-std::array<float,2>{0.517074943f, 0.239975259f},
-std::array<float,2>{0.348607868f, 0.106414162f},
-std::array<float,2>{0.626999855f, 0.664660513f},
-std::array<float,2>{0.101920724f, 0.789395511f},
-std::array<float,2>{0.7703861f, 0.370874345f},
-std::array<float,2>{0.391064852f, 0.252522349f},
-std::array<float,2>{0.580759943f, 0.85262239f},
-std::array<float,2>{0.150147349f, 0.746653318f},
-std::array<float,2>{0.8781901f, 0.0225337241f},
-std::array<float,2>{0.0110437116f, 0.149395913f},
-std::array<float,2>{0.841316521f, 0.541785955f},
-std::array<float,2>{0.283654034f, 0.981010973f},
-std::array<float,2>{0.720514178f, 0.434379458f},
-std::array<float,2>{0.0592216291f, 0.416403413f},
-std::array<float,2>{0.863865852f, 0.994205058f},
-std::array<float,2>{0.267112195f, 0.560666203f},
-std::array<float,2>{0.698250115f, 0.132733405f},
-std::array<float,2>{0.417675316f, 0.0131995939f},
-std::array<float,2>{0.608149111f, 0.72620064f},
-std::array<float,2>{0.181635082f, 0.86055398f},
-std::array<float,2>{0.918120921f, 0.279872537f},
-std::array<float,2>{0.340170175f, 0.344807863f},
-std::array<float,2>{0.659542084f, 0.806130826f},
-std::array<float,2>{0.0671553016f, 0.678095162f},
-std::array<float,2>{0.781453073f, 0.11803069f},
-std::array<float,2>{0.224081874f, 0.231528476f},
-std::array<float,2>{0.993781388f, 0.563061714f},
-std::array<float,2>{0.450334698f, 0.89214009f},
-std::array<float,2>{0.557367682f, 0.46620658f},
-std::array<float,2>{0.139576495f, 0.306511819f},
-std::array<float,2>{0.906123042f, 0.829674184f},
-std::array<float,2>{0.386046171f, 0.701522708f},
-std::array<float,2>{0.563530564f, 0.0571746938f},
-std::array<float,2>{0.302424639f, 0.161206707f},
-std::array<float,2>{0.74244678f, 0.516438782f},
-std::array<float,2>{0.0245308802f, 0.938703835f},
-std::array<float,2>{0.821217477f, 0.389461875f},
-std::array<float,2>{0.475160778f, 0.470147908f},
-std::array<float,2>{0.506508052f, 0.913895845f},
-std::array<float,2>{0.202432454f, 0.624295831f},
-std::array<float,2>{0.958258152f, 0.195437849f},
-std::array<float,2>{0.123589545f, 0.0883418694f},
-std::array<float,2>{0.756249726f, 0.632583678f},
-std::array<float,2>{0.361738443f, 0.758308113f},
-std::array<float,2>{0.647829354f, 0.324786454f},
-std::array<float,2>{0.114115924f, 0.292791128f},
-std::array<float,2>{0.761798739f, 0.823005855f},
-std::array<float,2>{0.368407339f, 0.716412008f},
-std::array<float,2>{0.653049231f, 0.0434662364f},
-std::array<float,2>{0.484002054f, 0.184353068f},
-std::array<float,2>{0.510568738f, 0.512794554f},
-std::array<float,2>{0.191090316f, 0.967535198f},
-std::array<float,2>{0.964042842f, 0.402148932f},
-std::array<float,2>{0.305815637f, 0.484522611f},
-std::array<float,2>{0.737889647f, 0.927812696f},
-std::array<float,2>{0.021118708f, 0.605567455f},
-std::array<float,2>{0.818110287f, 0.209190175f},
-std::array<float,2>{0.127171546f, 0.065252848f},
-std::array<float,2>{0.89329797f, 0.652925372f},
-std::array<float,2>{0.37661007f, 0.765655756f},
-std::array<float,2>{0.572140634f, 0.330037653f},
-std::array<float,2>{0.230566248f, 0.432104468f},
-std::array<float,2>{0.988654852f, 0.977948785f},
-std::array<float,2>{0.439318448f, 0.543101072f},
-std::array<float,2>{0.550961852f, 0.15571709f},
-std::array<float,2>{0.333353609f, 0.0177112315f},
-std::array<float,2>{0.670134902f, 0.74491179f},
-std::array<float,2>{0.0744595975f, 0.858760953f},
-std::array<float,2>{0.793457747f, 0.254034072f},
-std::array<float,2>{0.408088058f, 0.371542811f},
-std::array<float,2>{0.596610427f, 0.795492947f},
-std::array<float,2>{0.178379565f, 0.671781063f},
-std::array<float,2>{0.912614286f, 0.103331231f},
-std::array<float,2>{0.0540394075f, 0.237676129f},
-std::array<float,2>{0.870852411f, 0.589350939f},
-std::array<float,2>{0.274292707f, 0.876917958f},
-std::array<float,2>{0.691322684f, 0.448095143f},
-std::array<float,2>{0.00329086208f, 0.462458819f},
-std::array<float,2>{0.834982932f, 0.895348549f},
-std::array<float,2>{0.296203166f, 0.566633642f},
-std::array<float,2>{0.730349839f, 0.22876963f},
-std::array<float,2>{0.404570222f, 0.124074474f},
-std::array<float,2>{0.592014611f, 0.67198205f},
-std::array<float,2>{0.142992854f, 0.811843812f},
-std::array<float,2>{0.888424397f, 0.348291844f},
-std::array<float,2>{0.351661682f, 0.275441945f},
-std::array<float,2>{0.632853627f, 0.865109265f},
-std::array<float,2>{0.0974938273f, 0.719199061f},
-std::array<float,2>{0.778973401f, 0.00988546293f},
-std::array<float,2>{0.211396292f, 0.125227764f},
-std::array<float,2>{0.94930625f, 0.555069387f},
-std::array<float,2>{0.499027371f, 0.998319447f},
-std::array<float,2>{0.530634761f, 0.418867707f},
-std::array<float,2>{0.161891252f, 0.323755711f},
-std::array<float,2>{0.925104678f, 0.764129877f},
-std::array<float,2>{0.425901383f, 0.627773046f},
-std::array<float,2>{0.609671116f, 0.0933803171f},
-std::array<float,2>{0.254694372f, 0.201785475f},
-std::array<float,2>{0.706325293f, 0.617871761f},
-std::array<float,2>{0.042798046f, 0.907436609f},
-std::array<float,2>{0.848501921f, 0.473072916f},
-std::array<float,2>{0.453433126f, 0.386015683f},
-std::array<float,2>{0.540714681f, 0.944128335f},
-std::array<float,2>{0.245043337f, 0.523009539f},
-std::array<float,2>{0.969370008f, 0.158853456f},
-std::array<float,2>{0.0809896737f, 0.0601343401f},
-std::array<float,2>{0.806260526f, 0.698908746f},
-std::array<float,2>{0.326096714f, 0.83365941f},
-std::array<float,2>{0.676854849f, 0.308714598f},
-std::array<float,2>{0.0341457911f, 0.353057325f},
-std::array<float,2>{0.854607165f, 0.798907995f},
-std::array<float,2>{0.259468406f, 0.686644077f},
-std::array<float,2>{0.714651763f, 0.112027317f},
-std::array<float,2>{0.435650647f, 0.218907982f},
-std::array<float,2>{0.624284327f, 0.577729344f},
-std::array<float,2>{0.171666145f, 0.901150107f},
-std::array<float,2>{0.935284257f, 0.453720868f},
-std::array<float,2>{0.317641526f, 0.413938463f},
-std::array<float,2>{0.682070374f, 0.989631534f},
-std::array<float,2>{0.0922727287f, 0.550145566f},
-std::array<float,2>{0.796916664f, 0.133425176f},
-std::array<float,2>{0.234866187f, 0.0061531635f},
-std::array<float,2>{0.983896434f, 0.729048312f},
-std::array<float,2>{0.464910001f, 0.870863855f},
-std::array<float,2>{0.535760701f, 0.266314894f},
-std::array<float,2>{0.154989094f, 0.478825063f},
-std::array<float,2>{0.878953278f, 0.915139794f},
-std::array<float,2>{0.394738436f, 0.612669289f},
-std::array<float,2>{0.583006978f, 0.187710747f},
-std::array<float,2>{0.286451727f, 0.0843762681f},
-std::array<float,2>{0.726297021f, 0.639009178f},
-std::array<float,2>{0.0119246924f, 0.754999638f},
-std::array<float,2>{0.837328136f, 0.318550497f},
-std::array<float,2>{0.487612426f, 0.303328753f},
-std::array<float,2>{0.520937145f, 0.842866659f},
-std::array<float,2>{0.210514665f, 0.689278841f},
-std::array<float,2>{0.938859224f, 0.0535440072f},
-std::array<float,2>{0.105547495f, 0.164989874f},
-std::array<float,2>{0.765777588f, 0.529622078f},
-std::array<float,2>{0.344221294f, 0.94771111f},
-std::array<float,2>{0.629842222f, 0.378360093f},
-std::array<float,2>{0.0639160275f, 0.394975781f},
-std::array<float,2>{0.785631478f, 0.95824343f},
-std::array<float,2>{0.339652508f, 0.507192016f},
-std::array<float,2>{0.661949515f, 0.179199636f},
-std::array<float,2>{0.44541651f, 0.0387350023f},
-std::array<float,2>{0.559105635f, 0.709162772f},
-std::array<float,2>{0.221188292f, 0.814493656f},
-std::array<float,2>{0.999419689f, 0.283229321f},
-std::array<float,2>{0.270643383f, 0.339220613f},
-std::array<float,2>{0.702961922f, 0.778856039f},
-std::array<float,2>{0.0568980873f, 0.641535819f},
-std::array<float,2>{0.86026895f, 0.0724639893f},
-std::array<float,2>{0.18659696f, 0.21235165f},
-std::array<float,2>{0.917286098f, 0.595781207f},
-std::array<float,2>{0.419168383f, 0.935175955f},
-std::array<float,2>{0.601998568f, 0.495787859f},
-std::array<float,2>{0.196524784f, 0.264428556f},
-std::array<float,2>{0.956915855f, 0.845565438f},
-std::array<float,2>{0.469117016f, 0.737621129f},
-std::array<float,2>{0.500580907f, 0.0279406291f},
-std::array<float,2>{0.364747614f, 0.142499343f},
-std::array<float,2>{0.640953183f, 0.538321376f},
-std::array<float,2>{0.117789894f, 0.970208228f},
-std::array<float,2>{0.752652586f, 0.424661338f},
-std::array<float,2>{0.38943851f, 0.439703405f},
-std::array<float,2>{0.570021272f, 0.887387514f},
-std::array<float,2>{0.135291845f, 0.582282722f},
-std::array<float,2>{0.899026155f, 0.242335677f},
-std::array<float,2>{0.0301157869f, 0.100075088f},
-std::array<float,2>{0.827329218f, 0.663633406f},
-std::array<float,2>{0.298033476f, 0.782157838f},
-std::array<float,2>{0.749694765f, 0.360192329f},
-std::array<float,2>{0.0502848327f, 0.300485402f},
-std::array<float,2>{0.871494889f, 0.836118639f},
-std::array<float,2>{0.279830933f, 0.694151342f},
-std::array<float,2>{0.692225873f, 0.0488331392f},
-std::array<float,2>{0.412143052f, 0.170050144f},
-std::array<float,2>{0.600459635f, 0.523578584f},
-std::array<float,2>{0.175211728f, 0.952304661f},
-std::array<float,2>{0.908440709f, 0.382576942f},
-std::array<float,2>{0.331025898f, 0.480906636f},
-std::array<float,2>{0.666000485f, 0.921459079f},
-std::array<float,2>{0.0710580125f, 0.614824653f},
-std::array<float,2>{0.789979041f, 0.192781582f},
-std::array<float,2>{0.227507889f, 0.0782836527f},
-std::array<float,2>{0.985997856f, 0.63475585f},
-std::array<float,2>{0.441460878f, 0.753777921f},
-std::array<float,2>{0.549878657f, 0.313579679f},
-std::array<float,2>{0.13058424f, 0.407031596f},
-std::array<float,2>{0.895518899f, 0.985740542f},
-std::array<float,2>{0.381022334f, 0.550787807f},
-std::array<float,2>{0.577163398f, 0.139921695f},
-std::array<float,2>{0.309855223f, 0.00269210595f},
-std::array<float,2>{0.738613725f, 0.733002126f},
-std::array<float,2>{0.0185413714f, 0.872966051f},
-std::array<float,2>{0.815211058f, 0.271942705f},
-std::array<float,2>{0.479487419f, 0.357742041f},
-std::array<float,2>{0.514282465f, 0.801905453f},
-std::array<float,2>{0.193708777f, 0.682942331f},
-std::array<float,2>{0.965868533f, 0.116074786f},
-std::array<float,2>{0.111250967f, 0.222765923f},
-std::array<float,2>{0.759697318f, 0.573172331f},
-std::array<float,2>{0.373496324f, 0.903548062f},
-std::array<float,2>{0.650383711f, 0.459360093f},
-std::array<float,2>{0.0851325691f, 0.44148463f},
-std::array<float,2>{0.81241256f, 0.886011124f},
-std::array<float,2>{0.322758496f, 0.580362976f},
-std::array<float,2>{0.673518121f, 0.246349335f},
-std::array<float,2>{0.457889706f, 0.0975649655f},
-std::array<float,2>{0.546531498f, 0.66010952f},
-std::array<float,2>{0.24715364f, 0.78656131f},
-std::array<float,2>{0.975345969f, 0.365345567f},
-std::array<float,2>{0.253892779f, 0.260063648f},
-std::array<float,2>{0.709943116f, 0.851517677f},
-std::array<float,2>{0.0443831906f, 0.741604149f},
-std::array<float,2>{0.846897662f, 0.0264276937f},
-std::array<float,2>{0.159988135f, 0.144795537f},
-std::array<float,2>{0.929080606f, 0.531956971f},
-std::array<float,2>{0.423384994f, 0.973553002f},
-std::array<float,2>{0.613600075f, 0.426084816f},
-std::array<float,2>{0.214952737f, 0.339925975f},
-std::array<float,2>{0.94667083f, 0.776374578f},
-std::array<float,2>{0.494378448f, 0.646316648f},
-std::array<float,2>{0.525741875f, 0.0742557198f},
-std::array<float,2>{0.358576119f, 0.215700492f},
-std::array<float,2>{0.640273571f, 0.598009944f},
-std::array<float,2>{0.0996076614f, 0.930114388f},
-std::array<float,2>{0.775996864f, 0.499854088f},
-std::array<float,2>{0.400994778f, 0.392256945f},
-std::array<float,2>{0.586859882f, 0.95658654f},
-std::array<float,2>{0.146876872f, 0.500896811f},
-std::array<float,2>{0.883811772f, 0.174799234f},
-std::array<float,2>{0.00608498836f, 0.033168152f},
-std::array<float,2>{0.829652369f, 0.704682112f},
-std::array<float,2>{0.289872885f, 0.817875624f},
-std::array<float,2>{0.732263148f, 0.285930336f},
-std::array<float,2>{0.103639454f, 0.367738783f},
-std::array<float,2>{0.77246201f, 0.791363537f},
-std::array<float,2>{0.350670397f, 0.667293191f},
-std::array<float,2>{0.626792073f, 0.107717365f},
-std::array<float,2>{0.490720987f, 0.240768999f},
-std::array<float,2>{0.518161714f, 0.593702078f},
-std::array<float,2>{0.205833733f, 0.881848335f},
-std::array<float,2>{0.942800045f, 0.450781018f},
-std::array<float,2>{0.281396061f, 0.437359154f},
-std::array<float,2>{0.721829891f, 0.983123839f},
-std::array<float,2>{0.00916282926f, 0.540625811f},
-std::array<float,2>{0.842764676f, 0.152263463f},
-std::array<float,2>{0.152096644f, 0.0202015806f},
-std::array<float,2>{0.876415849f, 0.749295473f},
-std::array<float,2>{0.393989056f, 0.855043411f},
-std::array<float,2>{0.57991749f, 0.251529276f},
-std::array<float,2>{0.238471851f, 0.492079258f},
-std::array<float,2>{0.978110969f, 0.922905684f},
-std::array<float,2>{0.461463004f, 0.604501963f},
-std::array<float,2>{0.533068061f, 0.203471214f},
-std::array<float,2>{0.313040525f, 0.0665082857f},
-std::array<float,2>{0.687326968f, 0.651104569f},
-std::array<float,2>{0.0892723575f, 0.771863639f},
-std::array<float,2>{0.800916195f, 0.334018856f},
-std::array<float,2>{0.429858953f, 0.294391781f},
-std::array<float,2>{0.620393693f, 0.824648142f},
-std::array<float,2>{0.164330438f, 0.711704075f},
-std::array<float,2>{0.932342947f, 0.0409943312f},
-std::array<float,2>{0.036116302f, 0.179711327f},
-std::array<float,2>{0.855918705f, 0.509842813f},
-std::array<float,2>{0.262954473f, 0.964249194f},
-std::array<float,2>{0.718052626f, 0.402476609f},
-std::array<float,2>{0.0256194994f, 0.387585223f},
-std::array<float,2>{0.823177278f, 0.940513492f},
-std::array<float,2>{0.302930415f, 0.517909646f},
-std::array<float,2>{0.745104373f, 0.162899762f},
-std::array<float,2>{0.383629501f, 0.0553315133f},
-std::array<float,2>{0.565121412f, 0.70066458f},
-std::array<float,2>{0.138380975f, 0.830960155f},
-std::array<float,2>{0.90346992f, 0.306727052f},
-std::array<float,2>{0.360265732f, 0.326922417f},
-std::array<float,2>{0.645181239f, 0.761396825f},
-std::array<float,2>{0.12222638f, 0.629262984f},
-std::array<float,2>{0.754404426f, 0.0871205032f},
-std::array<float,2>{0.199955016f, 0.197668508f},
-std::array<float,2>{0.960608244f, 0.622832f},
-std::array<float,2>{0.472769678f, 0.911946952f},
-std::array<float,2>{0.505785644f, 0.471535355f},
-std::array<float,2>{0.182213336f, 0.278010905f},
-std::array<float,2>{0.920402288f, 0.862837017f},
-std::array<float,2>{0.415115714f, 0.722829401f},
-std::array<float,2>{0.606583536f, 0.0145266205f},
-std::array<float,2>{0.268932283f, 0.129671559f},
-std::array<float,2>{0.695785761f, 0.560189784f},
-std::array<float,2>{0.0617947727f, 0.994023681f},
-std::array<float,2>{0.866702914f, 0.414122045f},
-std::array<float,2>{0.451924145f, 0.468530118f},
-std::array<float,2>{0.55569905f, 0.893581331f},
-std::array<float,2>{0.225718111f, 0.564491868f},
-std::array<float,2>{0.99486351f, 0.234369755f},
-std::array<float,2>{0.0683843791f, 0.120159827f},
-std::array<float,2>{0.784406006f, 0.676214099f},
-std::array<float,2>{0.342889518f, 0.808350444f},
-std::array<float,2>{0.657803833f, 0.346863449f},
-std::array<float,2>{0.0780949518f, 0.255974859f},
-std::array<float,2>{0.79552114f, 0.855580986f},
-std::array<float,2>{0.335371524f, 0.743302763f},
-std::array<float,2>{0.668395698f, 0.0166869387f},
-std::array<float,2>{0.440462202f, 0.153054297f},
-std::array<float,2>{0.553166211f, 0.546363771f},
-std::array<float,2>{0.23299399f, 0.980073929f},
-std::array<float,2>{0.990412533f, 0.430713505f},
-std::array<float,2>{0.27559346f, 0.446900129f},
-std::array<float,2>{0.688947797f, 0.878861129f},
-std::array<float,2>{0.0514347181f, 0.586003423f},
-std::array<float,2>{0.868896425f, 0.235582858f},
-std::array<float,2>{0.175816908f, 0.104803659f},
-std::array<float,2>{0.910599172f, 0.66928345f},
-std::array<float,2>{0.409872949f, 0.794782937f},
-std::array<float,2>{0.59532994f, 0.374552608f},
-std::array<float,2>{0.189347342f, 0.398526847f},
-std::array<float,2>{0.961306512f, 0.966268837f},
-std::array<float,2>{0.48055464f, 0.51508683f},
-std::array<float,2>{0.509209871f, 0.185780153f},
-std::array<float,2>{0.370460957f, 0.0452804975f},
-std::array<float,2>{0.655671299f, 0.717579544f},
-std::array<float,2>{0.116497971f, 0.821348786f},
-std::array<float,2>{0.764345944f, 0.290652335f},
-std::array<float,2>{0.377079755f, 0.33118698f},
-std::array<float,2>{0.572351754f, 0.7695086f},
-std::array<float,2>{0.125655189f, 0.655950606f},
-std::array<float,2>{0.89135623f, 0.062571913f},
-std::array<float,2>{0.0221725758f, 0.207768649f},
-std::array<float,2>{0.820189893f, 0.607814968f},
-std::array<float,2>{0.308214068f, 0.926344872f},
-std::array<float,2>{0.735671461f, 0.487513572f},
-std::array<float,2>{0.0404270217f, 0.475415051f},
-std::array<float,2>{0.851397276f, 0.90825212f},
-std::array<float,2>{0.257309824f, 0.619746804f},
-std::array<float,2>{0.704677641f, 0.199599594f},
-std::array<float,2>{0.429394573f, 0.0902197734f},
-std::array<float,2>{0.612620533f, 0.626419425f},
-std::array<float,2>{0.16376321f, 0.761926353f},
-std::array<float,2>{0.922158599f, 0.321323872f},
-std::array<float,2>{0.327302456f, 0.310628921f},
-std::array<float,2>{0.678640008f, 0.834369123f},
-std::array<float,2>{0.0796567723f, 0.695935905f},
-std::array<float,2>{0.806868851f, 0.0619490482f},
-std::array<float,2>{0.243155703f, 0.156825066f},
-std::array<float,2>{0.972629428f, 0.520669341f},
-std::array<float,2>{0.457025379f, 0.941841722f},
-std::array<float,2>{0.54152894f, 0.383944303f},
-std::array<float,2>{0.141592473f, 0.350727141f},
-std::array<float,2>{0.889514208f, 0.808679521f},
-std::array<float,2>{0.403707981f, 0.675459087f},
-std::array<float,2>{0.59037447f, 0.121401735f},
-std::array<float,2>{0.294576168f, 0.226993278f},
-std::array<float,2>{0.727556527f, 0.569159091f},
-std::array<float,2>{0.00101139839f, 0.898196459f},
-std::array<float,2>{0.832958996f, 0.46394518f},
-std::array<float,2>{0.49755761f, 0.421692848f},
-std::array<float,2>{0.527812362f, 0.996704876f},
-std::array<float,2>{0.214205131f, 0.558100224f},
-std::array<float,2>{0.953065932f, 0.128828228f},
-std::array<float,2>{0.0953222886f, 0.00852992851f},
-std::array<float,2>{0.779568791f, 0.721316218f},
-std::array<float,2>{0.355431259f, 0.86538893f},
-std::array<float,2>{0.636480033f, 0.274292827f},
-std::array<float,2>{0.0153218964f, 0.317704856f},
-std::array<float,2>{0.838077247f, 0.757301211f},
-std::array<float,2>{0.287342221f, 0.637140989f},
-std::array<float,2>{0.724083722f, 0.0823498741f},
-std::array<float,2>{0.397470862f, 0.191259518f},
-std::array<float,2>{0.584367156f, 0.610927761f},
-std::array<float,2>{0.153230771f, 0.916923463f},
-std::array<float,2>{0.882479489f, 0.477604121f},
-std::array<float,2>{0.347027481f, 0.375839591f},
-std::array<float,2>{0.631127119f, 0.947190464f},
-std::array<float,2>{0.108020678f, 0.528131783f},
-std::array<float,2>{0.768124878f, 0.167878911f},
-std::array<float,2>{0.208957896f, 0.051714737f},
-std::array<float,2>{0.940991104f, 0.689824283f},
-std::array<float,2>{0.485145658f, 0.840444028f},
-std::array<float,2>{0.52286607f, 0.302122146f},
-std::array<float,2>{0.168256223f, 0.45648098f},
-std::array<float,2>{0.936389506f, 0.899426818f},
-std::array<float,2>{0.434224844f, 0.57487607f},
-std::array<float,2>{0.621598065f, 0.221547022f},
-std::array<float,2>{0.260847628f, 0.110356674f},
-std::array<float,2>{0.712025881f, 0.684764087f},
-std::array<float,2>{0.0320574045f, 0.797850609f},
-std::array<float,2>{0.852300465f, 0.355304778f},
-std::array<float,2>{0.467855692f, 0.269112796f},
-std::array<float,2>{0.537717164f, 0.86898756f},
-std::array<float,2>{0.237876192f, 0.728104889f},
-std::array<float,2>{0.98206538f, 0.00402236357f},
-std::array<float,2>{0.0904111341f, 0.13664332f},
-std::array<float,2>{0.799864888f, 0.54838413f},
-std::array<float,2>{0.318563491f, 0.990949273f},
-std::array<float,2>{0.68070507f, 0.411525965f},
-std::array<float,2>{0.120176286f, 0.42329964f},
-std::array<float,2>{0.751711428f, 0.971117496f},
-std::array<float,2>{0.365668297f, 0.535732567f},
-std::array<float,2>{0.642808914f, 0.143325627f},
-std::array<float,2>{0.471891075f, 0.0299578402f},
-std::array<float,2>{0.50323391f, 0.734777272f},
-std::array<float,2>{0.197740406f, 0.845858455f},
-std::array<float,2>{0.953841269f, 0.263327688f},
-std::array<float,2>{0.299889028f, 0.361781538f},
-std::array<float,2>{0.747841477f, 0.783714533f},
-std::array<float,2>{0.028154511f, 0.661701798f},
-std::array<float,2>{0.826051176f, 0.0991020426f},
-std::array<float,2>{0.13459748f, 0.245691583f},
-std::array<float,2>{0.902021348f, 0.584503293f},
-std::array<float,2>{0.388264954f, 0.88926053f},
-std::array<float,2>{0.56712985f, 0.438987345f},
-std::array<float,2>{0.219195873f, 0.282271683f},
-std::array<float,2>{0.997843802f, 0.814273f},
-std::array<float,2>{0.448512733f, 0.7084108f},
-std::array<float,2>{0.562397897f, 0.0358847193f},
-std::array<float,2>{0.33594203f, 0.175883427f},
-std::array<float,2>{0.663192511f, 0.504175365f},
-std::array<float,2>{0.0645402223f, 0.959620178f},
-std::array<float,2>{0.787808895f, 0.396779507f},
-std::array<float,2>{0.420033008f, 0.493436158f},
-std::array<float,2>{0.604048073f, 0.936995566f},
-std::array<float,2>{0.184080213f, 0.594318092f},
-std::array<float,2>{0.914535642f, 0.21363987f},
-std::array<float,2>{0.0549248084f, 0.070655793f},
-std::array<float,2>{0.861511827f, 0.642717421f},
-std::array<float,2>{0.272453159f, 0.779599965f},
-std::array<float,2>{0.70088315f, 0.3370125f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.235545799f, 0.476714551f},
-std::array<float,2>{0.92413938f, 0.67477566f},
-std::array<float,2>{0.49437049f, 0.974143088f},
-std::array<float,2>{0.717739165f, 0.181835949f},
-std::array<float,2>{0.319901496f, 0.0414949991f},
-std::array<float,2>{0.555851102f, 0.76115489f},
-std::array<float,2>{0.0921483934f, 0.604484022f},
-std::array<float,2>{0.789213359f, 0.3107346f},
-std::array<float,2>{0.390386939f, 0.327173501f},
-std::array<float,2>{0.658981264f, 0.55580318f},
-std::array<float,2>{0.15075697f, 0.842571616f},
-std::array<float,2>{0.989858389f, 0.0666236505f},
-std::array<float,2>{0.00489427941f, 0.224711999f},
-std::array<float,2>{0.833909988f, 0.932272971f},
-std::array<float,2>{0.263273925f, 0.689745426f},
-std::array<float,2>{0.587899685f, 0.396403879f},
-std::array<float,2>{0.109743804f, 0.268538475f},
-std::array<float,2>{0.781083643f, 0.58535111f},
-std::array<float,2>{0.345644653f, 0.782805443f},
-std::array<float,2>{0.520530641f, 0.00404636748f},
-std::array<float,2>{0.457888871f, 0.15100421f},
-std::array<float,2>{0.731770277f, 0.948116064f},
-std::array<float,2>{0.198002994f, 0.635520995f},
-std::array<float,2>{0.898410082f, 0.450841814f},
-std::array<float,2>{0.298212945f, 0.413916886f},
-std::array<float,2>{0.599012852f, 0.727250457f},
-std::array<float,2>{0.0513945259f, 0.89095825f},
-std::array<float,2>{0.848883629f, 0.211044893f},
-std::array<float,2>{0.173391998f, 0.124821924f},
-std::array<float,2>{0.955936015f, 0.844170392f},
-std::array<float,2>{0.434824347f, 0.529917717f},
-std::array<float,2>{0.653699517f, 0.355072677f},
-std::array<float,2>{0.0330892354f, 0.387325227f},
-std::array<float,2>{0.86784631f, 0.706108034f},
-std::array<float,2>{0.292462587f, 0.917047143f},
-std::array<float,2>{0.621811569f, 0.244042635f},
-std::array<float,2>{0.418659478f, 0.0836922228f},
-std::array<float,2>{0.628995359f, 0.827332377f},
-std::array<float,2>{0.16013737f, 0.533028007f},
-std::array<float,2>{0.939074159f, 0.343689352f},
-std::array<float,2>{0.362132818f, 0.293719053f},
-std::array<float,2>{0.503270447f, 0.617397428f},
-std::array<float,2>{0.0965288356f, 0.770925164f},
-std::array<float,2>{0.754304767f, 0.0475663729f},
-std::array<float,2>{0.208280593f, 0.167022973f},
-std::array<float,2>{0.888830543f, 0.99912709f},
-std::array<float,2>{0.447096705f, 0.669724107f},
-std::array<float,2>{0.73546195f, 0.491321474f},
-std::array<float,2>{0.139119476f, 0.362775505f},
-std::array<float,2>{0.971888006f, 0.501186132f},
-std::array<float,2>{0.397272706f, 0.871707559f},
-std::array<float,2>{0.678569198f, 0.101418965f},
-std::array<float,2>{0.279503047f, 0.191093579f},
-std::array<float,2>{0.567747653f, 0.884144247f},
-std::array<float,2>{0.0247060694f, 0.74745512f},
-std::array<float,2>{0.820395887f, 0.425249785f},
-std::array<float,2>{0.476874679f, 0.453979343f},
-std::array<float,2>{0.695647717f, 0.642346382f},
-std::array<float,2>{0.223315507f, 0.960976899f},
-std::array<float,2>{0.914274275f, 0.134231463f},
-std::array<float,2>{0.0654145926f, 0.0256642699f},
-std::array<float,2>{0.803985596f, 0.810426891f},
-std::array<float,2>{0.3313061f, 0.568640888f},
-std::array<float,2>{0.542290568f, 0.255085558f},
-std::array<float,2>{0.164764076f, 0.431339502f},
-std::array<float,2>{0.946092129f, 0.740141392f},
-std::array<float,2>{0.40673089f, 0.88111347f},
-std::array<float,2>{0.638785124f, 0.196440667f},
-std::array<float,2>{0.282280654f, 0.107454509f},
-std::array<float,2>{0.616639376f, 0.862969518f},
-std::array<float,2>{0.0417407602f, 0.512595773f},
-std::array<float,2>{0.864921987f, 0.369174391f},
-std::array<float,2>{0.443195879f, 0.262286752f},
-std::array<float,2>{0.749187171f, 0.570813656f},
-std::array<float,2>{0.211215913f, 0.803619862f},
-std::array<float,2>{0.875165284f, 0.0228830427f},
-std::array<float,2>{0.109092064f, 0.129205242f},
-std::array<float,2>{0.759194314f, 0.958457768f},
-std::array<float,2>{0.374954194f, 0.650752306f},
-std::array<float,2>{0.508593917f, 0.465814233f},
-std::array<float,2>{0.0157044046f, 0.33315444f},
-std::array<float,2>{0.819546402f, 0.542321265f},
-std::array<float,2>{0.2719087f, 0.816161096f},
-std::array<float,2>{0.573549867f, 0.0859894902f},
-std::array<float,2>{0.403225094f, 0.236731797f},
-std::array<float,2>{0.680841625f, 0.912923932f},
-std::array<float,2>{0.130443543f, 0.715623379f},
-std::array<float,2>{0.978087604f, 0.380280346f},
-std::array<float,2>{0.34235689f, 0.493699163f},
-std::array<float,2>{0.537207425f, 0.662225723f},
-std::array<float,2>{0.0707692876f, 0.987086058f},
-std::array<float,2>{0.811984003f, 0.157737717f},
-std::array<float,2>{0.229300499f, 0.0556113347f},
-std::array<float,2>{0.908274114f, 0.779624343f},
-std::array<float,2>{0.46876207f, 0.615568101f},
-std::array<float,2>{0.691996038f, 0.287395865f},
-std::array<float,2>{0.0817832127f, 0.441613704f},
-std::array<float,2>{0.787553072f, 0.627947628f},
-std::array<float,2>{0.322458088f, 0.941601574f},
-std::array<float,2>{0.550755501f, 0.141290233f},
-std::array<float,2>{0.491353214f, 0.0145574491f},
-std::array<float,2>{0.709439278f, 0.793379903f},
-std::array<float,2>{0.243978858f, 0.589621842f},
-std::array<float,2>{0.929939449f, 0.274476558f},
-std::array<float,2>{0.257208675f, 0.348798096f},
-std::array<float,2>{0.581038237f, 0.518601f},
-std::array<float,2>{0.0129864523f, 0.853274763f},
-std::array<float,2>{0.843398035f, 0.115532234f},
-std::array<float,2>{0.146426782f, 0.208343089f},
-std::array<float,2>{0.997159004f, 0.903331339f},
-std::array<float,2>{0.379023254f, 0.719775915f},
-std::array<float,2>{0.668615758f, 0.42121321f},
-std::array<float,2>{0.188274086f, 0.30092746f},
-std::array<float,2>{0.899861991f, 0.596526563f},
-std::array<float,2>{0.461510479f, 0.755939603f},
-std::array<float,2>{0.721719027f, 0.0347818024f},
-std::array<float,2>{0.352283597f, 0.175313473f},
-std::array<float,2>{0.52504611f, 0.978133738f},
-std::array<float,2>{0.119940512f, 0.680150151f},
-std::array<float,2>{0.771204472f, 0.469107687f},
-std::array<float,2>{0.427015036f, 0.399929076f},
-std::array<float,2>{0.646536231f, 0.697525799f},
-std::array<float,2>{0.182599053f, 0.923769772f},
-std::array<float,2>{0.965493619f, 0.232456297f},
-std::array<float,2>{0.0610938855f, 0.0708012581f},
-std::array<float,2>{0.855643988f, 0.83144635f},
-std::array<float,2>{0.305507571f, 0.54873842f},
-std::array<float,2>{0.602228582f, 0.315792352f},
-std::array<float,2>{0.153551057f, 0.461492181f},
-std::array<float,2>{0.98596257f, 0.65575701f},
-std::array<float,2>{0.384857833f, 0.955900431f},
-std::array<float,2>{0.660355031f, 0.126155391f},
-std::array<float,2>{0.258009255f, 0.018717071f},
-std::array<float,2>{0.59044534f, 0.798739195f},
-std::array<float,2>{0.00346525898f, 0.574344933f},
-std::array<float,2>{0.829915166f, 0.260628998f},
-std::array<float,2>{0.497157454f, 0.37165001f},
-std::array<float,2>{0.712337554f, 0.507837296f},
-std::array<float,2>{0.241631076f, 0.866422653f},
-std::array<float,2>{0.928798616f, 0.10229376f},
-std::array<float,2>{0.0881114081f, 0.200037614f},
-std::array<float,2>{0.796337724f, 0.877370238f},
-std::array<float,2>{0.315931946f, 0.738125384f},
-std::array<float,2>{0.559032321f, 0.435172111f},
-std::array<float,2>{0.0495359227f, 0.281308919f},
-std::array<float,2>{0.847094893f, 0.609526157f},
-std::array<float,2>{0.303712666f, 0.775323331f},
-std::array<float,2>{0.59438926f, 0.0588392876f},
-std::array<float,2>{0.430276543f, 0.161379024f},
-std::array<float,2>{0.648463845f, 0.991816461f},
-std::array<float,2>{0.179498062f, 0.660071194f},
-std::array<float,2>{0.959889114f, 0.49687016f},
-std::array<float,2>{0.348982275f, 0.376435131f},
-std::array<float,2>{0.51681143f, 0.711586833f},
-std::array<float,2>{0.113459408f, 0.906546295f},
-std::array<float,2>{0.775438488f, 0.239103884f},
-std::array<float,2>{0.199371889f, 0.09086705f},
-std::array<float,2>{0.89421308f, 0.818034232f},
-std::array<float,2>{0.453788221f, 0.546419144f},
-std::array<float,2>{0.728092909f, 0.331434637f},
-std::array<float,2>{0.0997133031f, 0.416446686f},
-std::array<float,2>{0.750097334f, 0.72408098f},
-std::array<float,2>{0.365031451f, 0.901911199f},
-std::array<float,2>{0.506178081f, 0.205454454f},
-std::array<float,2>{0.45237121f, 0.112027928f},
-std::array<float,2>{0.739834726f, 0.856011212f},
-std::array<float,2>{0.203449577f, 0.520807445f},
-std::array<float,2>{0.885497391f, 0.347244442f},
-std::array<float,2>{0.296355814f, 0.280449569f},
-std::array<float,2>{0.620009959f, 0.591458917f},
-std::array<float,2>{0.0373686515f, 0.79073751f},
-std::array<float,2>{0.874505997f, 0.00820873585f},
-std::array<float,2>{0.16261819f, 0.144620135f},
-std::array<float,2>{0.942799807f, 0.937819242f},
-std::array<float,2>{0.417456031f, 0.631293952f},
-std::array<float,2>{0.627470851f, 0.439365149f},
-std::array<float,2>{0.22112903f, 0.31853649f},
-std::array<float,2>{0.921370566f, 0.55116576f},
-std::array<float,2>{0.483981311f, 0.834522784f},
-std::array<float,2>{0.702566028f, 0.076920636f},
-std::array<float,2>{0.334275573f, 0.227580398f},
-std::array<float,2>{0.54410404f, 0.926801145f},
-std::array<float,2>{0.0673681349f, 0.700406551f},
-std::array<float,2>{0.796976209f, 0.4038454f},
-std::array<float,2>{0.393696606f, 0.474253953f},
-std::array<float,2>{0.673035979f, 0.686338186f},
-std::array<float,2>{0.133919105f, 0.980757177f},
-std::array<float,2>{0.976528227f, 0.179323375f},
-std::array<float,2>{0.0293890741f, 0.0387001187f},
-std::array<float,2>{0.826215029f, 0.752062023f},
-std::array<float,2>{0.274738491f, 0.599395692f},
-std::array<float,2>{0.564209163f, 0.297887325f},
-std::array<float,2>{0.218170866f, 0.392989308f},
-std::array<float,2>{0.881665826f, 0.692850947f},
-std::array<float,2>{0.439730614f, 0.93419522f},
-std::array<float,2>{0.745775044f, 0.220980793f},
-std::array<float,2>{0.369646966f, 0.0659796745f},
-std::array<float,2>{0.511923015f, 0.839393318f},
-std::array<float,2>{0.102962613f, 0.559375226f},
-std::array<float,2>{0.761729717f, 0.323926657f},
-std::array<float,2>{0.41098547f, 0.30852887f},
-std::array<float,2>{0.635574818f, 0.608068824f},
-std::array<float,2>{0.171648115f, 0.763747275f},
-std::array<float,2>{0.951888561f, 0.0432839431f},
-std::array<float,2>{0.0444389284f, 0.184908688f},
-std::array<float,2>{0.861404002f, 0.971504033f},
-std::array<float,2>{0.285283208f, 0.675973713f},
-std::array<float,2>{0.60976696f, 0.483954519f},
-std::array<float,2>{0.0748678669f, 0.359316617f},
-std::array<float,2>{0.8055439f, 0.523914516f},
-std::array<float,2>{0.339193135f, 0.848251045f},
-std::array<float,2>{0.534462452f, 0.121061459f},
-std::array<float,2>{0.473485529f, 0.218629435f},
-std::array<float,2>{0.688484013f, 0.894671977f},
-std::array<float,2>{0.230584547f, 0.730929434f},
-std::array<float,2>{0.910682082f, 0.406262487f},
-std::array<float,2>{0.267803937f, 0.446863115f},
-std::array<float,2>{0.575929046f, 0.637012005f},
-std::array<float,2>{0.0203766935f, 0.951545835f},
-std::array<float,2>{0.814819992f, 0.155925915f},
-std::array<float,2>{0.127629533f, 0.00204527145f},
-std::array<float,2>{0.983478785f, 0.787348449f},
-std::array<float,2>{0.401690125f, 0.581541598f},
-std::array<float,2>{0.686630249f, 0.269645482f},
-std::array<float,2>{0.00787999667f, 0.4867616f},
-std::array<float,2>{0.838986635f, 0.666441321f},
-std::array<float,2>{0.25329262f, 0.994359374f},
-std::array<float,2>{0.583690822f, 0.168195665f},
-std::array<float,2>{0.37744832f, 0.0529530272f},
-std::array<float,2>{0.666610599f, 0.768432677f},
-std::array<float,2>{0.144011542f, 0.623415768f},
-std::array<float,2>{0.9937163f, 0.291103125f},
-std::array<float,2>{0.327861875f, 0.339693278f},
-std::array<float,2>{0.553122699f, 0.538010895f},
-std::array<float,2>{0.0836842507f, 0.823358655f},
-std::array<float,2>{0.783391535f, 0.0818110928f},
-std::array<float,2>{0.247494355f, 0.246574655f},
-std::array<float,2>{0.934609175f, 0.921557546f},
-std::array<float,2>{0.487175524f, 0.707329988f},
-std::array<float,2>{0.705291748f, 0.385952204f},
-std::array<float,2>{0.184313297f, 0.253875583f},
-std::array<float,2>{0.96421957f, 0.565708518f},
-std::array<float,2>{0.423213154f, 0.805491984f},
-std::array<float,2>{0.642707109f, 0.0290874448f},
-std::array<float,2>{0.311038733f, 0.140490279f},
-std::array<float,2>{0.607278705f, 0.967101812f},
-std::array<float,2>{0.0577330254f, 0.647712708f},
-std::array<float,2>{0.853708982f, 0.459153861f},
-std::array<float,2>{0.465773642f, 0.427453786f},
-std::array<float,2>{0.725081086f, 0.743591666f},
-std::array<float,2>{0.191929042f, 0.890365958f},
-std::array<float,2>{0.904541731f, 0.194737703f},
-std::array<float,2>{0.122612543f, 0.0941483304f},
-std::array<float,2>{0.769255042f, 0.868424952f},
-std::array<float,2>{0.359355688f, 0.50715512f},
-std::array<float,2>{0.527697325f, 0.363595456f},
-std::array<float,2>{0.197226241f, 0.451942563f},
-std::array<float,2>{0.895522058f, 0.633534074f},
-std::array<float,2>{0.460252851f, 0.946800351f},
-std::array<float,2>{0.732751846f, 0.1502776f},
-std::array<float,2>{0.346298516f, 0.00703199953f},
-std::array<float,2>{0.522668183f, 0.784488499f},
-std::array<float,2>{0.11200536f, 0.582952678f},
-std::array<float,2>{0.778463364f, 0.266162276f},
-std::array<float,2>{0.436249435f, 0.352444053f},
-std::array<float,2>{0.654888809f, 0.527553201f},
-std::array<float,2>{0.175396383f, 0.846419752f},
-std::array<float,2>{0.954325616f, 0.122287355f},
-std::array<float,2>{0.0535744093f, 0.214041382f},
-std::array<float,2>{0.85008055f, 0.893359959f},
-std::array<float,2>{0.298862875f, 0.728559136f},
-std::array<float,2>{0.599681079f, 0.41108954f},
-std::array<float,2>{0.0911238566f, 0.310462147f},
-std::array<float,2>{0.792562068f, 0.602579296f},
-std::array<float,2>{0.31702432f, 0.758934677f},
-std::array<float,2>{0.556697726f, 0.0408387817f},
-std::array<float,2>{0.492307454f, 0.181238621f},
-std::array<float,2>{0.715277255f, 0.975200117f},
-std::array<float,2>{0.236684576f, 0.672904193f},
-std::array<float,2>{0.922899306f, 0.478540659f},
-std::array<float,2>{0.264970094f, 0.398047656f},
-std::array<float,2>{0.587382913f, 0.687660754f},
-std::array<float,2>{0.00736876531f, 0.929715693f},
-std::array<float,2>{0.83535254f, 0.223908678f},
-std::array<float,2>{0.149196208f, 0.0694144666f},
-std::array<float,2>{0.991164207f, 0.841122687f},
-std::array<float,2>{0.386740685f, 0.557880759f},
-std::array<float,2>{0.65784055f, 0.325075507f},
-std::array<float,2>{0.026058156f, 0.422142744f},
-std::array<float,2>{0.822826624f, 0.749118626f},
-std::array<float,2>{0.278552711f, 0.885515034f},
-std::array<float,2>{0.568552315f, 0.188512594f},
-std::array<float,2>{0.396210581f, 0.0982992202f},
-std::array<float,2>{0.676875651f, 0.874017477f},
-std::array<float,2>{0.138037398f, 0.502077162f},
-std::array<float,2>{0.970084369f, 0.361079752f},
-std::array<float,2>{0.329449981f, 0.257354021f},
-std::array<float,2>{0.540066004f, 0.567700863f},
-std::array<float,2>{0.0640088394f, 0.811997294f},
-std::array<float,2>{0.801719189f, 0.0244969334f},
-std::array<float,2>{0.224973068f, 0.135910943f},
-std::array<float,2>{0.916780293f, 0.963722467f},
-std::array<float,2>{0.478591859f, 0.643338621f},
-std::array<float,2>{0.697613537f, 0.456730962f},
-std::array<float,2>{0.158154577f, 0.339988947f},
-std::array<float,2>{0.941103101f, 0.533471167f},
-std::array<float,2>{0.420725197f, 0.825940132f},
-std::array<float,2>{0.632096231f, 0.0850551575f},
-std::array<float,2>{0.29008922f, 0.244729549f},
-std::array<float,2>{0.624106884f, 0.915264308f},
-std::array<float,2>{0.0336697437f, 0.703554451f},
-std::array<float,2>{0.869691312f, 0.389830261f},
-std::array<float,2>{0.44733417f, 0.490234256f},
-std::array<float,2>{0.737369597f, 0.67039758f},
-std::array<float,2>{0.210462049f, 0.996347427f},
-std::array<float,2>{0.888028681f, 0.164448693f},
-std::array<float,2>{0.093946293f, 0.0495747812f},
-std::array<float,2>{0.757654607f, 0.773341894f},
-std::array<float,2>{0.360321671f, 0.620776236f},
-std::array<float,2>{0.500175297f, 0.295465827f},
-std::array<float,2>{0.131708443f, 0.380994201f},
-std::array<float,2>{0.978571057f, 0.716988325f},
-std::array<float,2>{0.404732198f, 0.910637379f},
-std::array<float,2>{0.681913078f, 0.236000627f},
-std::array<float,2>{0.27077958f, 0.0889500529f},
-std::array<float,2>{0.572244644f, 0.813861668f},
-std::array<float,2>{0.0181046519f, 0.540407002f},
-std::array<float,2>{0.818316042f, 0.334405452f},
-std::array<float,2>{0.470767885f, 0.286572576f},
-std::array<float,2>{0.693769395f, 0.613632321f},
-std::array<float,2>{0.228142649f, 0.778837144f},
-std::array<float,2>{0.907587647f, 0.058354564f},
-std::array<float,2>{0.0724264011f, 0.158807501f},
-std::array<float,2>{0.809890866f, 0.985379457f},
-std::array<float,2>{0.340734065f, 0.660202265f},
-std::array<float,2>{0.535357654f, 0.494186372f},
-std::array<float,2>{0.0404981598f, 0.368181914f},
-std::array<float,2>{0.866414368f, 0.514951766f},
-std::array<float,2>{0.284065127f, 0.859750211f},
-std::array<float,2>{0.613370299f, 0.106892675f},
-std::array<float,2>{0.409760892f, 0.199082777f},
-std::array<float,2>{0.637033582f, 0.880153477f},
-std::array<float,2>{0.167408615f, 0.741467655f},
-std::array<float,2>{0.947768629f, 0.432152361f},
-std::array<float,2>{0.371817142f, 0.467579693f},
-std::array<float,2>{0.511075556f, 0.64966166f},
-std::array<float,2>{0.107246317f, 0.959129393f},
-std::array<float,2>{0.760354519f, 0.132790521f},
-std::array<float,2>{0.214205921f, 0.0208361913f},
-std::array<float,2>{0.87730515f, 0.800805807f},
-std::array<float,2>{0.444004238f, 0.573752761f},
-std::array<float,2>{0.747323394f, 0.265498698f},
-std::array<float,2>{0.117214933f, 0.47238037f},
-std::array<float,2>{0.772209883f, 0.682722986f},
-std::array<float,2>{0.354162127f, 0.979864836f},
-std::array<float,2>{0.527091861f, 0.172485262f},
-std::array<float,2>{0.463876009f, 0.0320134386f},
-std::array<float,2>{0.720689774f, 0.754043519f},
-std::array<float,2>{0.191396639f, 0.59515363f},
-std::array<float,2>{0.900639355f, 0.303718209f},
-std::array<float,2>{0.306677282f, 0.312929869f},
-std::array<float,2>{0.603554428f, 0.549986959f},
-std::array<float,2>{0.0587114394f, 0.829504848f},
-std::array<float,2>{0.85789758f, 0.0724898726f},
-std::array<float,2>{0.180042014f, 0.231141135f},
-std::array<float,2>{0.967479706f, 0.923833609f},
-std::array<float,2>{0.429552406f, 0.696304977f},
-std::array<float,2>{0.646151304f, 0.401700556f},
-std::array<float,2>{0.244450912f, 0.275736302f},
-std::array<float,2>{0.933425725f, 0.586563289f},
-std::array<float,2>{0.489512891f, 0.796769798f},
-std::array<float,2>{0.707147658f, 0.0134752225f},
-std::array<float,2>{0.321110576f, 0.14279598f},
-std::array<float,2>{0.547841072f, 0.943813682f},
-std::array<float,2>{0.0793808624f, 0.625760198f},
-std::array<float,2>{0.786802828f, 0.4448075f},
-std::array<float,2>{0.382409006f, 0.419300884f},
-std::array<float,2>{0.671224236f, 0.720875382f},
-std::array<float,2>{0.148047104f, 0.90553844f},
-std::array<float,2>{0.999529779f, 0.209252015f},
-std::array<float,2>{0.0137655614f, 0.115026481f},
-std::array<float,2>{0.840475976f, 0.854987502f},
-std::array<float,2>{0.255077422f, 0.516101182f},
-std::array<float,2>{0.57868284f, 0.351206422f},
-std::array<float,2>{0.176813737f, 0.499668509f},
-std::array<float,2>{0.958322227f, 0.656745434f},
-std::array<float,2>{0.431991398f, 0.988313615f},
-std::array<float,2>{0.650590718f, 0.163950026f},
-std::array<float,2>{0.301264137f, 0.0619409531f},
-std::array<float,2>{0.596976697f, 0.776820302f},
-std::array<float,2>{0.0479492322f, 0.61264199f},
-std::array<float,2>{0.84524405f, 0.2849347f},
-std::array<float,2>{0.456546515f, 0.328255981f},
-std::array<float,2>{0.729327023f, 0.543584585f},
-std::array<float,2>{0.202708617f, 0.819557667f},
-std::array<float,2>{0.891024828f, 0.0930317119f},
-std::array<float,2>{0.115410551f, 0.241617575f},
-std::array<float,2>{0.774649262f, 0.908535421f},
-std::array<float,2>{0.349858522f, 0.713505983f},
-std::array<float,2>{0.519404352f, 0.378151149f},
-std::array<float,2>{0.0016858055f, 0.258792669f},
-std::array<float,2>{0.831717074f, 0.576920033f},
-std::array<float,2>{0.260581791f, 0.800561488f},
-std::array<float,2>{0.592901111f, 0.0170559417f},
-std::array<float,2>{0.383981586f, 0.12852034f},
-std::array<float,2>{0.663025081f, 0.953725219f},
-std::array<float,2>{0.154798359f, 0.652383268f},
-std::array<float,2>{0.98771131f, 0.464119256f},
-std::array<float,2>{0.31400013f, 0.436916679f},
-std::array<float,2>{0.562162519f, 0.734614789f},
-std::array<float,2>{0.0866553411f, 0.876821041f},
-std::array<float,2>{0.794667304f, 0.201980233f},
-std::array<float,2>{0.238930941f, 0.104898021f},
-std::array<float,2>{0.927608848f, 0.865125179f},
-std::array<float,2>{0.499388039f, 0.510744572f},
-std::array<float,2>{0.714211941f, 0.373106241f},
-std::array<float,2>{0.0698595941f, 0.405406594f},
-std::array<float,2>{0.799454808f, 0.702503681f},
-std::array<float,2>{0.332846373f, 0.929106832f},
-std::array<float,2>{0.545606494f, 0.22921136f},
-std::array<float,2>{0.481106371f, 0.0746230111f},
-std::array<float,2>{0.701012015f, 0.832686305f},
-std::array<float,2>{0.220254853f, 0.55411464f},
-std::array<float,2>{0.918484807f, 0.317248166f},
-std::array<float,2>{0.277193964f, 0.300698757f},
-std::array<float,2>{0.565282464f, 0.60018754f},
-std::array<float,2>{0.0286379196f, 0.751409233f},
-std::array<float,2>{0.825146735f, 0.036844369f},
-std::array<float,2>{0.135786086f, 0.177391246f},
-std::array<float,2>{0.97407347f, 0.982639253f},
-std::array<float,2>{0.390705675f, 0.685154021f},
-std::array<float,2>{0.675723135f, 0.476367712f},
-std::array<float,2>{0.205296487f, 0.343771905f},
-std::array<float,2>{0.883746564f, 0.521605611f},
-std::array<float,2>{0.450285017f, 0.85871464f},
-std::array<float,2>{0.740825057f, 0.110938847f},
-std::array<float,2>{0.366545081f, 0.204785496f},
-std::array<float,2>{0.505004764f, 0.89932394f},
-std::array<float,2>{0.0996033475f, 0.725152969f},
-std::array<float,2>{0.753108203f, 0.414332747f},
-std::array<float,2>{0.415542096f, 0.441120178f},
-std::array<float,2>{0.625500619f, 0.630465984f},
-std::array<float,2>{0.161308706f, 0.940415919f},
-std::array<float,2>{0.943830311f, 0.148355618f},
-std::array<float,2>{0.0357500874f, 0.0112259332f},
-std::array<float,2>{0.871897936f, 0.791062415f},
-std::array<float,2>{0.29397133f, 0.592522025f},
-std::array<float,2>{0.619140565f, 0.278416634f},
-std::array<float,2>{0.234371781f, 0.409606993f},
-std::array<float,2>{0.912253082f, 0.733380795f},
-std::array<float,2>{0.474772513f, 0.898091853f},
-std::array<float,2>{0.690917194f, 0.215736061f},
-std::array<float,2>{0.336543351f, 0.118755035f},
-std::array<float,2>{0.531515539f, 0.850315511f},
-std::array<float,2>{0.0772772729f, 0.527007937f},
-std::array<float,2>{0.808025479f, 0.356094629f},
-std::array<float,2>{0.399486154f, 0.272052377f},
-std::array<float,2>{0.68415755f, 0.578983724f},
-std::array<float,2>{0.126155466f, 0.78614831f},
-std::array<float,2>{0.981346726f, 0.000401912985f},
-std::array<float,2>{0.0224570855f, 0.152562261f},
-std::array<float,2>{0.813006699f, 0.949507415f},
-std::array<float,2>{0.265696019f, 0.6388129f},
-std::array<float,2>{0.57768321f, 0.44826597f},
-std::array<float,2>{0.105061643f, 0.320722312f},
-std::array<float,2>{0.764303744f, 0.561329484f},
-std::array<float,2>{0.367779344f, 0.837656856f},
-std::array<float,2>{0.513988435f, 0.0640126914f},
-std::array<float,2>{0.43908143f, 0.220673427f},
-std::array<float,2>{0.742730856f, 0.937222481f},
-std::array<float,2>{0.216724753f, 0.69513166f},
-std::array<float,2>{0.879548728f, 0.391304612f},
-std::array<float,2>{0.28830567f, 0.480614424f},
-std::array<float,2>{0.612110198f, 0.678201377f},
-std::array<float,2>{0.0457210913f, 0.970295489f},
-std::array<float,2>{0.859785914f, 0.18606472f},
-std::array<float,2>{0.169491574f, 0.0458572023f},
-std::array<float,2>{0.949506044f, 0.762675643f},
-std::array<float,2>{0.41362977f, 0.607255399f},
-std::array<float,2>{0.633635283f, 0.30554834f},
-std::array<float,2>{0.0554659739f, 0.458289534f},
-std::array<float,2>{0.852566838f, 0.646091044f},
-std::array<float,2>{0.309135765f, 0.965676785f},
-std::array<float,2>{0.608747423f, 0.137749389f},
-std::array<float,2>{0.424194664f, 0.0302025918f},
-std::array<float,2>{0.641514778f, 0.807384193f},
-std::array<float,2>{0.186452001f, 0.562949836f},
-std::array<float,2>{0.962087393f, 0.250508755f},
-std::array<float,2>{0.3562316f, 0.366640389f},
-std::array<float,2>{0.530723989f, 0.504510403f},
-std::array<float,2>{0.124791741f, 0.870980203f},
-std::array<float,2>{0.766352117f, 0.0974183902f},
-std::array<float,2>{0.19398798f, 0.192235082f},
-std::array<float,2>{0.903778732f, 0.88832438f},
-std::array<float,2>{0.467671037f, 0.745977998f},
-std::array<float,2>{0.724473834f, 0.42943269f},
-std::array<float,2>{0.142559171f, 0.289746374f},
-std::array<float,2>{0.995427012f, 0.621849716f},
-std::array<float,2>{0.376312047f, 0.76679337f},
-std::array<float,2>{0.664927006f, 0.0519439392f},
-std::array<float,2>{0.251174986f, 0.170736432f},
-std::array<float,2>{0.584711254f, 0.992394805f},
-std::array<float,2>{0.0114743859f, 0.664338112f},
-std::array<float,2>{0.837188065f, 0.485529631f},
-std::array<float,2>{0.484600663f, 0.383635461f},
-std::array<float,2>{0.703540266f, 0.709186196f},
-std::array<float,2>{0.248137176f, 0.918267548f},
-std::array<float,2>{0.93665117f, 0.24820964f},
-std::array<float,2>{0.0842835009f, 0.0788629502f},
-std::array<float,2>{0.781830788f, 0.821114659f},
-std::array<float,2>{0.324564964f, 0.535842955f},
-std::array<float,2>{0.551136315f, 0.337804645f},
-std::array<float,2>{0.223739356f, 0.455747068f},
-std::array<float,2>{0.915805995f, 0.644510031f},
-std::array<float,2>{0.477671742f, 0.963957369f},
-std::array<float,2>{0.69648701f, 0.135601878f},
-std::array<float,2>{0.330488294f, 0.0241822749f},
-std::array<float,2>{0.541105568f, 0.811049163f},
-std::array<float,2>{0.0656744465f, 0.567243516f},
-std::array<float,2>{0.802736819f, 0.256791919f},
-std::array<float,2>{0.39825213f, 0.359393418f},
-std::array<float,2>{0.678715348f, 0.503690183f},
-std::array<float,2>{0.140577525f, 0.874782205f},
-std::array<float,2>{0.971231401f, 0.0994089767f},
-std::array<float,2>{0.0238500014f, 0.188033506f},
-std::array<float,2>{0.822074175f, 0.886620283f},
-std::array<float,2>{0.280759245f, 0.748786867f},
-std::array<float,2>{0.567146838f, 0.423072338f},
-std::array<float,2>{0.0969855636f, 0.296708494f},
-std::array<float,2>{0.755450428f, 0.619410753f},
-std::array<float,2>{0.362417698f, 0.772234142f},
-std::array<float,2>{0.502136052f, 0.0506101772f},
-std::array<float,2>{0.44570744f, 0.1658068f},
-std::array<float,2>{0.734750628f, 0.997268617f},
-std::array<float,2>{0.207235098f, 0.671361566f},
-std::array<float,2>{0.889879048f, 0.488894641f},
-std::array<float,2>{0.291772127f, 0.388726592f},
-std::array<float,2>{0.622917354f, 0.704576552f},
-std::array<float,2>{0.031775821f, 0.914424181f},
-std::array<float,2>{0.868243575f, 0.246009767f},
-std::array<float,2>{0.158517301f, 0.0849353373f},
-std::array<float,2>{0.938426495f, 0.824861884f},
-std::array<float,2>{0.419783533f, 0.534618497f},
-std::array<float,2>{0.630490303f, 0.341556847f},
-std::array<float,2>{0.0523481965f, 0.411915362f},
-std::array<float,2>{0.848527372f, 0.730282903f},
-std::array<float,2>{0.29778266f, 0.894065619f},
-std::array<float,2>{0.59818542f, 0.213252336f},
-std::array<float,2>{0.434051335f, 0.121340595f},
-std::array<float,2>{0.652387381f, 0.847158432f},
-std::array<float,2>{0.172026157f, 0.529177606f},
-std::array<float,2>{0.956579089f, 0.353317499f},
-std::array<float,2>{0.344335526f, 0.266616166f},
-std::array<float,2>{0.520314395f, 0.583650887f},
-std::array<float,2>{0.111044616f, 0.783889353f},
-std::array<float,2>{0.78021884f, 0.00672356272f},
-std::array<float,2>{0.198391214f, 0.148491114f},
-std::array<float,2>{0.897077739f, 0.945590496f},
-std::array<float,2>{0.458183736f, 0.634530365f},
-std::array<float,2>{0.731196046f, 0.45241648f},
-std::array<float,2>{0.151890725f, 0.325343162f},
-std::array<float,2>{0.98890543f, 0.557459354f},
-std::array<float,2>{0.389245719f, 0.840287507f},
-std::array<float,2>{0.659739196f, 0.0685610175f},
-std::array<float,2>{0.262252927f, 0.222980559f},
-std::array<float,2>{0.58959341f, 0.931459725f},
-std::array<float,2>{0.00459995307f, 0.68849647f},
-std::array<float,2>{0.832565069f, 0.39699173f},
-std::array<float,2>{0.496091753f, 0.480120569f},
-std::array<float,2>{0.718130767f, 0.67224443f},
-std::array<float,2>{0.235106841f, 0.976294518f},
-std::array<float,2>{0.92548722f, 0.180560619f},
-std::array<float,2>{0.0928338468f, 0.039679911f},
-std::array<float,2>{0.790253758f, 0.75790143f},
-std::array<float,2>{0.31885156f, 0.601606727f},
-std::array<float,2>{0.555049479f, 0.308645695f},
-std::array<float,2>{0.182625994f, 0.40040502f},
-std::array<float,2>{0.966574609f, 0.695502102f},
-std::array<float,2>{0.426596224f, 0.925208747f},
-std::array<float,2>{0.647634804f, 0.231531426f},
-std::array<float,2>{0.305699497f, 0.0733012855f},
-std::array<float,2>{0.603458405f, 0.828685403f},
-std::array<float,2>{0.0621509068f, 0.549776435f},
-std::array<float,2>{0.85671258f, 0.314038306f},
-std::array<float,2>{0.462707818f, 0.303342372f},
-std::array<float,2>{0.720832586f, 0.594567895f},
-std::array<float,2>{0.189376399f, 0.755740523f},
-std::array<float,2>{0.899402261f, 0.0326153897f},
-std::array<float,2>{0.12062972f, 0.173283577f},
-std::array<float,2>{0.770150661f, 0.979392648f},
-std::array<float,2>{0.353328854f, 0.681853712f},
-std::array<float,2>{0.524036109f, 0.47135976f},
-std::array<float,2>{0.0124793621f, 0.350551933f},
-std::array<float,2>{0.842761278f, 0.517134368f},
-std::array<float,2>{0.256759703f, 0.853982151f},
-std::array<float,2>{0.581663132f, 0.113679893f},
-std::array<float,2>{0.380690187f, 0.210079774f},
-std::array<float,2>{0.669771314f, 0.904986501f},
-std::array<float,2>{0.145339221f, 0.722176015f},
-std::array<float,2>{0.997027814f, 0.418786943f},
-std::array<float,2>{0.323610485f, 0.444141686f},
-std::array<float,2>{0.549460351f, 0.626662195f},
-std::array<float,2>{0.0807508975f, 0.945058465f},
-std::array<float,2>{0.78825438f, 0.144274056f},
-std::array<float,2>{0.242644444f, 0.0119961454f},
-std::array<float,2>{0.931343555f, 0.795753777f},
-std::array<float,2>{0.490950137f, 0.587844431f},
-std::array<float,2>{0.710856497f, 0.277192563f},
-std::array<float,2>{0.0721943453f, 0.495821863f},
-std::array<float,2>{0.810712218f, 0.661492407f},
-std::array<float,2>{0.343537837f, 0.984771609f},
-std::array<float,2>{0.538189411f, 0.160035715f},
-std::array<float,2>{0.470630705f, 0.0570581555f},
-std::array<float,2>{0.692538917f, 0.778092444f},
-std::array<float,2>{0.229932249f, 0.614989936f},
-std::array<float,2>{0.909800828f, 0.285269499f},
-std::array<float,2>{0.272729844f, 0.335727245f},
-std::array<float,2>{0.572622716f, 0.539249301f},
-std::array<float,2>{0.0168902762f, 0.813125193f},
-std::array<float,2>{0.818936586f, 0.0888081267f},
-std::array<float,2>{0.129628807f, 0.234948546f},
-std::array<float,2>{0.977163374f, 0.912001073f},
-std::array<float,2>{0.404141188f, 0.717984259f},
-std::array<float,2>{0.680225492f, 0.382174075f},
-std::array<float,2>{0.212581992f, 0.264149994f},
-std::array<float,2>{0.876652718f, 0.573092103f},
-std::array<float,2>{0.441529304f, 0.801989138f},
-std::array<float,2>{0.749021351f, 0.0202928707f},
-std::array<float,2>{0.373238415f, 0.130988538f},
-std::array<float,2>{0.509151816f, 0.960107744f},
-std::array<float,2>{0.108030662f, 0.648617148f},
-std::array<float,2>{0.758784175f, 0.468278736f},
-std::array<float,2>{0.407728374f, 0.432793528f},
-std::array<float,2>{0.64019829f, 0.740857184f},
-std::array<float,2>{0.165344402f, 0.879357278f},
-std::array<float,2>{0.946331978f, 0.198019937f},
-std::array<float,2>{0.0427722149f, 0.106081545f},
-std::array<float,2>{0.863729775f, 0.861035049f},
-std::array<float,2>{0.281838834f, 0.514237463f},
-std::array<float,2>{0.61592257f, 0.36723125f},
-std::array<float,2>{0.13355273f, 0.474903792f},
-std::array<float,2>{0.975204527f, 0.683995545f},
-std::array<float,2>{0.393441945f, 0.983925879f},
-std::array<float,2>{0.672763109f, 0.176198944f},
-std::array<float,2>{0.273989856f, 0.0354520194f},
-std::array<float,2>{0.563335001f, 0.750693381f},
-std::array<float,2>{0.0303786304f, 0.600775659f},
-std::array<float,2>{0.827942371f, 0.299757093f},
-std::array<float,2>{0.483159304f, 0.317641586f},
-std::array<float,2>{0.701841891f, 0.553242326f},
-std::array<float,2>{0.22245568f, 0.833708644f},
-std::array<float,2>{0.920880735f, 0.0756204501f},
-std::array<float,2>{0.0673913956f, 0.230050534f},
-std::array<float,2>{0.798277915f, 0.92851609f},
-std::array<float,2>{0.33509925f, 0.701715171f},
-std::array<float,2>{0.543122292f, 0.404450238f},
-std::array<float,2>{0.0386980884f, 0.278220236f},
-std::array<float,2>{0.873457551f, 0.593605518f},
-std::array<float,2>{0.295450807f, 0.792428195f},
-std::array<float,2>{0.620344222f, 0.0105392495f},
-std::array<float,2>{0.416497231f, 0.147148266f},
-std::array<float,2>{0.628166139f, 0.94102782f},
-std::array<float,2>{0.163544193f, 0.629588664f},
-std::array<float,2>{0.942026198f, 0.440244585f},
-std::array<float,2>{0.363928378f, 0.415214539f},
-std::array<float,2>{0.507027268f, 0.726131439f},
-std::array<float,2>{0.101225041f, 0.899721324f},
-std::array<float,2>{0.751773596f, 0.20382145f},
-std::array<float,2>{0.204544052f, 0.110280186f},
-std::array<float,2>{0.886383057f, 0.858082712f},
-std::array<float,2>{0.45162794f, 0.523085773f},
-std::array<float,2>{0.738428235f, 0.345557004f},
-std::array<float,2>{0.114860199f, 0.37792474f},
-std::array<float,2>{0.776952744f, 0.714707792f},
-std::array<float,2>{0.34809342f, 0.910060823f},
-std::array<float,2>{0.51576674f, 0.240937904f},
-std::array<float,2>{0.454508901f, 0.0924607217f},
-std::array<float,2>{0.726930976f, 0.818372667f},
-std::array<float,2>{0.200600311f, 0.544297755f},
-std::array<float,2>{0.892762005f, 0.329209864f},
-std::array<float,2>{0.303287387f, 0.284002453f},
-std::array<float,2>{0.595623791f, 0.611501217f},
-std::array<float,2>{0.050188072f, 0.776047647f},
-std::array<float,2>{0.845897496f, 0.0609489903f},
-std::array<float,2>{0.178590596f, 0.162580594f},
-std::array<float,2>{0.960415661f, 0.989474237f},
-std::array<float,2>{0.43066588f, 0.657397091f},
-std::array<float,2>{0.650105894f, 0.498417199f},
-std::array<float,2>{0.241164699f, 0.374255151f},
-std::array<float,2>{0.927865326f, 0.509770155f},
-std::array<float,2>{0.496754467f, 0.863680303f},
-std::array<float,2>{0.711508811f, 0.103926554f},
-std::array<float,2>{0.314789116f, 0.20295088f},
-std::array<float,2>{0.560101211f, 0.875723124f},
-std::array<float,2>{0.0892602354f, 0.7360484f},
-std::array<float,2>{0.795572698f, 0.436499149f},
-std::array<float,2>{0.386085391f, 0.463404775f},
-std::array<float,2>{0.661880076f, 0.653779864f},
-std::array<float,2>{0.152869299f, 0.954609513f},
-std::array<float,2>{0.98449564f, 0.127736688f},
-std::array<float,2>{0.00258325739f, 0.0162525587f},
-std::array<float,2>{0.828582764f, 0.799756348f},
-std::array<float,2>{0.258846551f, 0.577544451f},
-std::array<float,2>{0.59103483f, 0.258364946f},
-std::array<float,2>{0.192686662f, 0.428241521f},
-std::array<float,2>{0.905353606f, 0.744917095f},
-std::array<float,2>{0.466421604f, 0.88694948f},
-std::array<float,2>{0.726258457f, 0.192532375f},
-std::array<float,2>{0.358261675f, 0.0963296518f},
-std::array<float,2>{0.528577626f, 0.869484365f},
-std::array<float,2>{0.121455841f, 0.504930675f},
-std::array<float,2>{0.767872453f, 0.365964621f},
-std::array<float,2>{0.42249468f, 0.251633555f},
-std::array<float,2>{0.643970132f, 0.56414181f},
-std::array<float,2>{0.185466871f, 0.807712972f},
-std::array<float,2>{0.963530362f, 0.030394882f},
-std::array<float,2>{0.057076063f, 0.136831969f},
-std::array<float,2>{0.854738474f, 0.966569662f},
-std::array<float,2>{0.311964631f, 0.645173192f},
-std::array<float,2>{0.605592549f, 0.457169056f},
-std::array<float,2>{0.0825910568f, 0.336740702f},
-std::array<float,2>{0.78515619f, 0.536488593f},
-std::array<float,2>{0.326180786f, 0.82174015f},
-std::array<float,2>{0.554507554f, 0.0799364075f},
-std::array<float,2>{0.487954319f, 0.249797523f},
-std::array<float,2>{0.706648409f, 0.919679582f},
-std::array<float,2>{0.246782944f, 0.710169554f},
-std::array<float,2>{0.934417427f, 0.384015471f},
-std::array<float,2>{0.252186447f, 0.485306263f},
-std::array<float,2>{0.582719922f, 0.665587842f},
-std::array<float,2>{0.00972104259f, 0.993636012f},
-std::array<float,2>{0.838583052f, 0.171429738f},
-std::array<float,2>{0.143489182f, 0.0508523844f},
-std::array<float,2>{0.992443919f, 0.766113102f},
-std::array<float,2>{0.378286898f, 0.622696638f},
-std::array<float,2>{0.667755544f, 0.290844768f},
-std::array<float,2>{0.0214180462f, 0.447487473f},
-std::array<float,2>{0.816025972f, 0.639744043f},
-std::array<float,2>{0.26856631f, 0.950646698f},
-std::array<float,2>{0.574467123f, 0.153464735f},
-std::array<float,2>{0.400513202f, 0.00186286774f},
-std::array<float,2>{0.685851932f, 0.786017358f},
-std::array<float,2>{0.128618509f, 0.579270899f},
-std::array<float,2>{0.982626736f, 0.27258718f},
-std::array<float,2>{0.338007778f, 0.35717541f},
-std::array<float,2>{0.53352797f, 0.526331723f},
-std::array<float,2>{0.0761014149f, 0.850701988f},
-std::array<float,2>{0.80616498f, 0.117545515f},
-std::array<float,2>{0.232107848f, 0.216400117f},
-std::array<float,2>{0.91136235f, 0.896488547f},
-std::array<float,2>{0.474150509f, 0.733421862f},
-std::array<float,2>{0.688170373f, 0.408850312f},
-std::array<float,2>{0.170550331f, 0.305836856f},
-std::array<float,2>{0.952202797f, 0.605810106f},
-std::array<float,2>{0.411317348f, 0.763312995f},
-std::array<float,2>{0.636318505f, 0.046003107f},
-std::array<float,2>{0.286731422f, 0.186775699f},
-std::array<float,2>{0.611282825f, 0.969547212f},
-std::array<float,2>{0.0430440903f, 0.679077685f},
-std::array<float,2>{0.862889171f, 0.482021183f},
-std::array<float,2>{0.441119194f, 0.391859055f},
-std::array<float,2>{0.745022118f, 0.69390285f},
-std::array<float,2>{0.217102155f, 0.936366916f},
-std::array<float,2>{0.882594347f, 0.219496146f},
-std::array<float,2>{0.10245207f, 0.0630675778f},
-std::array<float,2>{0.763433218f, 0.83612752f},
-std::array<float,2>{0.370635182f, 0.56245625f},
-std::array<float,2>{0.513296008f, 0.32205835f},
-std::array<float,2>{0.209126294f, 0.490763992f},
-std::array<float,2>{0.887563646f, 0.668251574f},
-std::array<float,2>{0.448433965f, 0.998346925f},
-std::array<float,2>{0.736329556f, 0.166642636f},
-std::array<float,2>{0.36052683f, 0.0484872647f},
-std::array<float,2>{0.501952529f, 0.770189881f},
-std::array<float,2>{0.0954749808f, 0.618833363f},
-std::array<float,2>{0.755937815f, 0.294798613f},
-std::array<float,2>{0.420987874f, 0.342481285f},
-std::array<float,2>{0.63102448f, 0.532100677f},
-std::array<float,2>{0.156867459f, 0.826447129f},
-std::array<float,2>{0.940196633f, 0.0823401287f},
-std::array<float,2>{0.0348362252f, 0.243134826f},
-std::array<float,2>{0.870345712f, 0.916962206f},
-std::array<float,2>{0.28985402f, 0.705124438f},
-std::array<float,2>{0.623330474f, 0.388382792f},
-std::array<float,2>{0.0630543679f, 0.254012853f},
-std::array<float,2>{0.802107394f, 0.570185542f},
-std::array<float,2>{0.328133255f, 0.809420347f},
-std::array<float,2>{0.539691687f, 0.0268390868f},
-std::array<float,2>{0.480307758f, 0.132942885f},
-std::array<float,2>{0.698640227f, 0.962288439f},
-std::array<float,2>{0.226401478f, 0.641532362f},
-std::array<float,2>{0.917494535f, 0.454142898f},
-std::array<float,2>{0.2777237f, 0.424479157f},
-std::array<float,2>{0.570003867f, 0.746360064f},
-std::array<float,2>{0.0271947887f, 0.883438647f},
-std::array<float,2>{0.823465765f, 0.190282539f},
-std::array<float,2>{0.136720628f, 0.100227214f},
-std::array<float,2>{0.969293952f, 0.872545481f},
-std::array<float,2>{0.395265698f, 0.500760496f},
-std::array<float,2>{0.676301301f, 0.361452579f},
-std::array<float,2>{0.00676789694f, 0.394820631f},
-std::array<float,2>{0.834315896f, 0.691350579f},
-std::array<float,2>{0.264299691f, 0.933545053f},
-std::array<float,2>{0.586612284f, 0.225643963f},
-std::array<float,2>{0.388426751f, 0.0678095371f},
-std::array<float,2>{0.656778276f, 0.843684733f},
-std::array<float,2>{0.149843022f, 0.554964364f},
-std::array<float,2>{0.991345584f, 0.327106982f},
-std::array<float,2>{0.317545682f, 0.31241709f},
-std::array<float,2>{0.558522999f, 0.605161369f},
-std::array<float,2>{0.0899243504f, 0.760237753f},
-std::array<float,2>{0.791220367f, 0.0422730893f},
-std::array<float,2>{0.238153443f, 0.183318451f},
-std::array<float,2>{0.922595263f, 0.973309219f},
-std::array<float,2>{0.494101107f, 0.675653517f},
-std::array<float,2>{0.716544986f, 0.477790177f},
-std::array<float,2>{0.174720183f, 0.35390678f},
-std::array<float,2>{0.953822374f, 0.530313313f},
-std::array<float,2>{0.436783671f, 0.845667005f},
-std::array<float,2>{0.655706227f, 0.123783812f},
-std::array<float,2>{0.300583988f, 0.212623239f},
-std::array<float,2>{0.600706995f, 0.892573357f},
-std::array<float,2>{0.0539583042f, 0.727948785f},
-std::array<float,2>{0.851471186f, 0.412177593f},
-std::array<float,2>{0.459129572f, 0.449594617f},
-std::array<float,2>{0.733851194f, 0.636530161f},
-std::array<float,2>{0.196043357f, 0.948848009f},
-std::array<float,2>{0.895222783f, 0.151464298f},
-std::array<float,2>{0.113001265f, 0.00561203575f},
-std::array<float,2>{0.777810633f, 0.782095492f},
-std::array<float,2>{0.347636759f, 0.584131002f},
-std::array<float,2>{0.521935821f, 0.269154936f},
-std::array<float,2>{0.146834716f, 0.419926733f},
-std::array<float,2>{0.998552859f, 0.718919814f},
-std::array<float,2>{0.381298363f, 0.903176725f},
-std::array<float,2>{0.670467496f, 0.207990304f},
-std::array<float,2>{0.254695415f, 0.116681509f},
-std::array<float,2>{0.579851449f, 0.852202713f},
-std::array<float,2>{0.0150189567f, 0.518458486f},
-std::array<float,2>{0.841658175f, 0.348548412f},
-std::array<float,2>{0.488709867f, 0.273548394f},
-std::array<float,2>{0.708257616f, 0.588042915f},
-std::array<float,2>{0.245322078f, 0.794167042f},
-std::array<float,2>{0.932050943f, 0.0148227904f},
-std::array<float,2>{0.078824617f, 0.142402843f},
-std::array<float,2>{0.78533864f, 0.942458272f},
-std::array<float,2>{0.322141528f, 0.627474368f},
-std::array<float,2>{0.548686504f, 0.44305706f},
-std::array<float,2>{0.0597129725f, 0.315427512f},
-std::array<float,2>{0.859344721f, 0.54742682f},
-std::array<float,2>{0.308388919f, 0.830793738f},
-std::array<float,2>{0.604866564f, 0.0715104789f},
-std::array<float,2>{0.427797019f, 0.233502597f},
-std::array<float,2>{0.644967616f, 0.922541618f},
-std::array<float,2>{0.181280375f, 0.698339939f},
-std::array<float,2>{0.968367994f, 0.398727596f},
-std::array<float,2>{0.354765832f, 0.47049129f},
-std::array<float,2>{0.525529802f, 0.681625068f},
-std::array<float,2>{0.119006291f, 0.976978481f},
-std::array<float,2>{0.772678554f, 0.174767002f},
-std::array<float,2>{0.189726934f, 0.0341313109f},
-std::array<float,2>{0.902094543f, 0.757558048f},
-std::array<float,2>{0.463249564f, 0.59761405f},
-std::array<float,2>{0.7196123f, 0.301905513f},
-std::array<float,2>{0.105707198f, 0.466146648f},
-std::array<float,2>{0.760771096f, 0.651765227f},
-std::array<float,2>{0.372695565f, 0.957083344f},
-std::array<float,2>{0.510163367f, 0.130632386f},
-std::array<float,2>{0.445298731f, 0.0221936461f},
-std::array<float,2>{0.747036695f, 0.803769708f},
-std::array<float,2>{0.213235795f, 0.571990132f},
-std::array<float,2>{0.878241062f, 0.263078183f},
-std::array<float,2>{0.284273624f, 0.370389193f},
-std::array<float,2>{0.615192175f, 0.513553143f},
-std::array<float,2>{0.0392624326f, 0.862055957f},
-std::array<float,2>{0.865454376f, 0.109368332f},
-std::array<float,2>{0.166924268f, 0.19620198f},
-std::array<float,2>{0.94844234f, 0.882037342f},
-std::array<float,2>{0.408952981f, 0.738985658f},
-std::array<float,2>{0.637815595f, 0.430292666f},
-std::array<float,2>{0.227466464f, 0.288645297f},
-std::array<float,2>{0.906986237f, 0.617132425f},
-std::array<float,2>{0.472093016f, 0.781096995f},
-std::array<float,2>{0.69443047f, 0.0560178757f},
-std::array<float,2>{0.341385394f, 0.157104135f},
-std::array<float,2>{0.53693527f, 0.987912536f},
-std::array<float,2>{0.0736202821f, 0.663883984f},
-std::array<float,2>{0.809385598f, 0.492809743f},
-std::array<float,2>{0.405787259f, 0.379252672f},
-std::array<float,2>{0.683082819f, 0.716280341f},
-std::array<float,2>{0.132699087f, 0.913258851f},
-std::array<float,2>{0.980017662f, 0.237363517f},
-std::array<float,2>{0.0185638145f, 0.0871182457f},
-std::array<float,2>{0.81669265f, 0.815272033f},
-std::array<float,2>{0.269822121f, 0.541333795f},
-std::array<float,2>{0.570886791f, 0.332454205f},
-std::array<float,2>{0.161101818f, 0.43804419f},
-std::array<float,2>{0.94470036f, 0.632448792f},
-std::array<float,2>{0.414915085f, 0.93891865f},
-std::array<float,2>{0.626431525f, 0.145872101f},
-std::array<float,2>{0.293874413f, 0.00889611803f},
-std::array<float,2>{0.617607653f, 0.78980577f},
-std::array<float,2>{0.0366928987f, 0.590275168f},
-std::array<float,2>{0.872523427f, 0.2799384f},
-std::array<float,2>{0.449852586f, 0.346196651f},
-std::array<float,2>{0.741623163f, 0.520248294f},
-std::array<float,2>{0.206938133f, 0.856747448f},
-std::array<float,2>{0.883940816f, 0.112585999f},
-std::array<float,2>{0.0978322029f, 0.206813678f},
-std::array<float,2>{0.752572954f, 0.90119791f},
-std::array<float,2>{0.365514189f, 0.723008037f},
-std::array<float,2>{0.504590333f, 0.417423189f},
-std::array<float,2>{0.0280071348f, 0.297625273f},
-std::array<float,2>{0.826084256f, 0.598233461f},
-std::array<float,2>{0.275992006f, 0.753525496f},
-std::array<float,2>{0.565649331f, 0.037487708f},
-std::array<float,2>{0.392320275f, 0.178579137f},
-std::array<float,2>{0.674728811f, 0.981608093f},
-std::array<float,2>{0.135068074f, 0.687145352f},
-std::array<float,2>{0.972708941f, 0.472799569f},
-std::array<float,2>{0.333556414f, 0.402866423f},
-std::array<float,2>{0.546786129f, 0.699589372f},
-std::array<float,2>{0.069250837f, 0.926570892f},
-std::array<float,2>{0.800080419f, 0.226874083f},
-std::array<float,2>{0.218870312f, 0.0777015686f},
-std::array<float,2>{0.919566333f, 0.834986627f},
-std::array<float,2>{0.481650323f, 0.552600801f},
-std::array<float,2>{0.699973404f, 0.319860458f},
-std::array<float,2>{0.0871646553f, 0.434348702f},
-std::array<float,2>{0.793209195f, 0.736647725f},
-std::array<float,2>{0.313316107f, 0.878256857f},
-std::array<float,2>{0.561020315f, 0.20113565f},
-std::array<float,2>{0.498481989f, 0.102608293f},
-std::array<float,2>{0.713383794f, 0.865509927f},
-std::array<float,2>{0.239411712f, 0.509382308f},
-std::array<float,2>{0.926111698f, 0.372239798f},
-std::array<float,2>{0.261049181f, 0.261349469f},
-std::array<float,2>{0.592598379f, 0.575410068f},
-std::array<float,2>{9.44274216e-05f, 0.797642708f},
-std::array<float,2>{0.830096245f, 0.0181784611f},
-std::array<float,2>{0.156024218f, 0.12506251f},
-std::array<float,2>{0.987050951f, 0.956660628f},
-std::array<float,2>{0.383106351f, 0.654786229f},
-std::array<float,2>{0.66374445f, 0.462660551f},
-std::array<float,2>{0.201573119f, 0.330300659f},
-std::array<float,2>{0.89168632f, 0.545662403f},
-std::array<float,2>{0.455376118f, 0.816603303f},
-std::array<float,2>{0.72955662f, 0.0906275362f},
-std::array<float,2>{0.35111624f, 0.239746198f},
-std::array<float,2>{0.51765722f, 0.907450557f},
-std::array<float,2>{0.116373651f, 0.712475061f},
-std::array<float,2>{0.773494542f, 0.375727445f},
-std::array<float,2>{0.432839274f, 0.497649252f},
-std::array<float,2>{0.6522246f, 0.658413887f},
-std::array<float,2>{0.176359281f, 0.990636766f},
-std::array<float,2>{0.957544863f, 0.161033928f},
-std::array<float,2>{0.0471626781f, 0.0601631887f},
-std::array<float,2>{0.844339967f, 0.774085224f},
-std::array<float,2>{0.301871657f, 0.610514998f},
-std::array<float,2>{0.596485734f, 0.282989919f},
-std::array<float,2>{0.249247745f, 0.385478467f},
-std::array<float,2>{0.936352074f, 0.708099544f},
-std::array<float,2>{0.485735357f, 0.920190156f},
-std::array<float,2>{0.70506835f, 0.247947946f},
-std::array<float,2>{0.325900167f, 0.0801252127f},
-std::array<float,2>{0.552428424f, 0.823069632f},
-std::array<float,2>{0.0854287148f, 0.538318098f},
-std::array<float,2>{0.782369912f, 0.338076323f},
-std::array<float,2>{0.375452071f, 0.292748511f},
-std::array<float,2>{0.666011989f, 0.62453419f},
-std::array<float,2>{0.140781134f, 0.769104183f},
-std::array<float,2>{0.994965136f, 0.0541561656f},
-std::array<float,2>{0.0099191498f, 0.169800669f},
-std::array<float,2>{0.836793125f, 0.995184004f},
-std::array<float,2>{0.25009051f, 0.667785943f},
-std::array<float,2>{0.58521235f, 0.488130271f},
-std::array<float,2>{0.123839602f, 0.365047395f},
-std::array<float,2>{0.766662598f, 0.506121159f},
-std::array<float,2>{0.356953681f, 0.867782891f},
-std::array<float,2>{0.529896021f, 0.0950545818f},
-std::array<float,2>{0.468425542f, 0.194087058f},
-std::array<float,2>{0.723506033f, 0.889504611f},
-std::array<float,2>{0.194663838f, 0.742787898f},
-std::array<float,2>{0.902919233f, 0.426509857f},
-std::array<float,2>{0.310306311f, 0.460910678f},
-std::array<float,2>{0.608392894f, 0.646750808f},
-std::array<float,2>{0.0565499775f, 0.96822542f},
-std::array<float,2>{0.852315247f, 0.139075562f},
-std::array<float,2>{0.187064394f, 0.0275045373f},
-std::array<float,2>{0.961849332f, 0.805829346f},
-std::array<float,2>{0.425557286f, 0.565111995f},
-std::array<float,2>{0.642155647f, 0.252206653f},
-std::array<float,2>{0.046242211f, 0.482999086f},
-std::array<float,2>{0.860771775f, 0.677483201f},
-std::array<float,2>{0.287781388f, 0.972172618f},
-std::array<float,2>{0.613143384f, 0.183940887f},
-std::array<float,2>{0.41268152f, 0.0441356413f},
-std::array<float,2>{0.634560347f, 0.76501596f},
-std::array<float,2>{0.168308422f, 0.608597815f},
-std::array<float,2>{0.951114058f, 0.307354778f},
-std::array<float,2>{0.368475974f, 0.322639823f},
-std::array<float,2>{0.515068531f, 0.560119212f},
-std::array<float,2>{0.104446299f, 0.838005483f},
-std::array<float,2>{0.765129805f, 0.0646576807f},
-std::array<float,2>{0.215193182f, 0.222302169f},
-std::array<float,2>{0.880409718f, 0.934992552f},
-std::array<float,2>{0.43826279f, 0.692124724f},
-std::array<float,2>{0.743252337f, 0.394388586f},
-std::array<float,2>{0.12577863f, 0.271164f},
-std::array<float,2>{0.981762886f, 0.580340028f},
-std::array<float,2>{0.39868623f, 0.788624465f},
-std::array<float,2>{0.685178161f, 0.00370861706f},
-std::array<float,2>{0.267275214f, 0.154912129f},
-std::array<float,2>{0.576514006f, 0.95240432f},
-std::array<float,2>{0.0224757846f, 0.638549447f},
-std::array<float,2>{0.813805938f, 0.446170717f},
-std::array<float,2>{0.475595236f, 0.407867968f},
-std::array<float,2>{0.689829767f, 0.731706083f},
-std::array<float,2>{0.232604608f, 0.896204412f},
-std::array<float,2>{0.913904607f, 0.217726693f},
-std::array<float,2>{0.0765647516f, 0.119260401f},
-std::array<float,2>{0.806905985f, 0.849334538f},
-std::array<float,2>{0.33750397f, 0.525068879f},
-std::array<float,2>{0.533046782f, 0.357724428f},
-std::array<float,2>{0.230204552f, 0.492483765f},
-std::array<float,2>{0.909247041f, 0.663476527f},
-std::array<float,2>{0.47005111f, 0.987443089f},
-std::array<float,2>{0.69311136f, 0.156698197f},
-std::array<float,2>{0.343005031f, 0.056545984f},
-std::array<float,2>{0.538784087f, 0.780526996f},
-std::array<float,2>{0.0716979131f, 0.616537273f},
-std::array<float,2>{0.811308205f, 0.28812179f},
-std::array<float,2>{0.403711289f, 0.332939178f},
-std::array<float,2>{0.68005234f, 0.54173547f},
-std::array<float,2>{0.12916863f, 0.814759672f},
-std::array<float,2>{0.977027893f, 0.0874823034f},
-std::array<float,2>{0.0172395483f, 0.238271818f},
-std::array<float,2>{0.818689108f, 0.913724363f},
-std::array<float,2>{0.273158759f, 0.716513872f},
-std::array<float,2>{0.572806358f, 0.379611969f},
-std::array<float,2>{0.107546292f, 0.263242811f},
-std::array<float,2>{0.757910132f, 0.57139498f},
-std::array<float,2>{0.37379396f, 0.804200888f},
-std::array<float,2>{0.509413719f, 0.0218117721f},
-std::array<float,2>{0.4420048f, 0.130303055f},
-std::array<float,2>{0.748437583f, 0.957948804f},
-std::array<float,2>{0.212388456f, 0.651931584f},
-std::array<float,2>{0.876353562f, 0.466406256f},
-std::array<float,2>{0.281616271f, 0.429714024f},
-std::array<float,2>{0.615338206f, 0.738336086f},
-std::array<float,2>{0.0423169807f, 0.882569373f},
-std::array<float,2>{0.864021301f, 0.195642501f},
-std::array<float,2>{0.165840253f, 0.10869965f},
-std::array<float,2>{0.946985483f, 0.861778557f},
-std::array<float,2>{0.407339841f, 0.513118386f},
-std::array<float,2>{0.639734387f, 0.370843381f},
-std::array<float,2>{0.061559923f, 0.399034947f},
-std::array<float,2>{0.856990516f, 0.699194551f},
-std::array<float,2>{0.306412905f, 0.922195971f},
-std::array<float,2>{0.602926731f, 0.234170452f},
-std::array<float,2>{0.426084548f, 0.0718175098f},
-std::array<float,2>{0.648088694f, 0.830084503f},
-std::array<float,2>{0.183437333f, 0.546886861f},
-std::array<float,2>{0.966130197f, 0.31483385f},
-std::array<float,2>{0.352642924f, 0.302401721f},
-std::array<float,2>{0.523502231f, 0.596998215f},
-std::array<float,2>{0.120292783f, 0.756911993f},
-std::array<float,2>{0.769733369f, 0.0334134214f},
-std::array<float,2>{0.188628986f, 0.174105927f},
-std::array<float,2>{0.898642659f, 0.977424264f},
-std::array<float,2>{0.462244004f, 0.68086493f},
-std::array<float,2>{0.721274853f, 0.469958931f},
-std::array<float,2>{0.14476642f, 0.347926199f},
-std::array<float,2>{0.996570766f, 0.517927229f},
-std::array<float,2>{0.380004168f, 0.851768315f},
-std::array<float,2>{0.669225991f, 0.116804399f},
-std::array<float,2>{0.256310463f, 0.207491606f},
-std::array<float,2>{0.581339061f, 0.902712166f},
-std::array<float,2>{0.0118256854f, 0.719373524f},
-std::array<float,2>{0.842146695f, 0.420867354f},
-std::array<float,2>{0.490358055f, 0.442566782f},
-std::array<float,2>{0.710347474f, 0.627144516f},
-std::array<float,2>{0.242969498f, 0.943054616f},
-std::array<float,2>{0.930876255f, 0.141759679f},
-std::array<float,2>{0.0803307071f, 0.0153148016f},
-std::array<float,2>{0.788974464f, 0.794639587f},
-std::array<float,2>{0.323876053f, 0.588703334f},
-std::array<float,2>{0.54896909f, 0.274327397f},
-std::array<float,2>{0.172476098f, 0.413069576f},
-std::array<float,2>{0.956166387f, 0.728185177f},
-std::array<float,2>{0.434509158f, 0.892002225f},
-std::array<float,2>{0.6531232f, 0.211957842f},
-std::array<float,2>{0.29728502f, 0.123102807f},
-std::array<float,2>{0.598049641f, 0.844777882f},
-std::array<float,2>{0.0518025458f, 0.531162202f},
-std::array<float,2>{0.847720921f, 0.354411662f},
-std::array<float,2>{0.458609492f, 0.268911153f},
-std::array<float,2>{0.730943203f, 0.58482641f},
-std::array<float,2>{0.19909218f, 0.78147459f},
-std::array<float,2>{0.896613717f, 0.00521617383f},
-std::array<float,2>{0.110836625f, 0.152053252f},
-std::array<float,2>{0.779714704f, 0.948639095f},
-std::array<float,2>{0.343964666f, 0.635953605f},
-std::array<float,2>{0.519608974f, 0.449887544f},
-std::array<float,2>{0.00413095765f, 0.326296657f},
-std::array<float,2>{0.832500279f, 0.555401266f},
-std::array<float,2>{0.262139946f, 0.84298867f},
-std::array<float,2>{0.588901818f, 0.0682496354f},
-std::array<float,2>{0.389135301f, 0.226314873f},
-std::array<float,2>{0.659323156f, 0.933057725f},
-std::array<float,2>{0.151581034f, 0.690631807f},
-std::array<float,2>{0.988589048f, 0.395407856f},
-std::array<float,2>{0.318418592f, 0.47846204f},
-std::array<float,2>{0.555487096f, 0.674870431f},
-std::array<float,2>{0.0934605598f, 0.972873747f},
-std::array<float,2>{0.790769577f, 0.182896346f},
-std::array<float,2>{0.234806791f, 0.0425961763f},
-std::array<float,2>{0.924861193f, 0.760650754f},
-std::array<float,2>{0.495383799f, 0.6048401f},
-std::array<float,2>{0.718567312f, 0.311584532f},
-std::array<float,2>{0.0661363229f, 0.4549312f},
-std::array<float,2>{0.803612351f, 0.641076863f},
-std::array<float,2>{0.330958068f, 0.962613106f},
-std::array<float,2>{0.541933656f, 0.133606881f},
-std::array<float,2>{0.478393734f, 0.0272122622f},
-std::array<float,2>{0.697233438f, 0.808915794f},
-std::array<float,2>{0.224349171f, 0.569412649f},
-std::array<float,2>{0.915427446f, 0.254847884f},
-std::array<float,2>{0.280822158f, 0.361908227f},
-std::array<float,2>{0.566701472f, 0.50034827f},
-std::array<float,2>{0.0243795998f, 0.872996271f},
-std::array<float,2>{0.821694672f, 0.0997949466f},
-std::array<float,2>{0.139981344f, 0.189685121f},
-std::array<float,2>{0.970710933f, 0.883097827f},
-std::array<float,2>{0.3978827f, 0.747066557f},
-std::array<float,2>{0.679398775f, 0.42393747f},
-std::array<float,2>{0.207697764f, 0.294253975f},
-std::array<float,2>{0.890408874f, 0.618214607f},
-std::array<float,2>{0.446041077f, 0.769880712f},
-std::array<float,2>{0.735350072f, 0.0480387323f},
-std::array<float,2>{0.362796426f, 0.166090295f},
-std::array<float,2>{0.502749145f, 0.99854815f},
-std::array<float,2>{0.0974704623f, 0.668601632f},
-std::array<float,2>{0.755057573f, 0.490650654f},
-std::array<float,2>{0.419216365f, 0.388128877f},
-std::array<float,2>{0.630194604f, 0.705989718f},
-std::array<float,2>{0.159078106f, 0.916290283f},
-std::array<float,2>{0.937592149f, 0.242445678f},
-std::array<float,2>{0.0316172801f, 0.0829532221f},
-std::array<float,2>{0.868977129f, 0.826902688f},
-std::array<float,2>{0.291241765f, 0.531441331f},
-std::array<float,2>{0.622386813f, 0.342151791f},
-std::array<float,2>{0.12817046f, 0.445495605f},
-std::array<float,2>{0.983348191f, 0.637740791f},
-std::array<float,2>{0.401146621f, 0.95289892f},
-std::array<float,2>{0.686167061f, 0.154752895f},
-std::array<float,2>{0.26952213f, 0.00332941115f},
-std::array<float,2>{0.574986517f, 0.788309216f},
-std::array<float,2>{0.0209858567f, 0.580824554f},
-std::array<float,2>{0.815904737f, 0.270655304f},
-std::array<float,2>{0.474000871f, 0.358057857f},
-std::array<float,2>{0.687709153f, 0.524436474f},
-std::array<float,2>{0.231471419f, 0.848967791f},
-std::array<float,2>{0.911780775f, 0.119804144f},
-std::array<float,2>{0.0752808452f, 0.217040315f},
-std::array<float,2>{0.806071401f, 0.89584446f},
-std::array<float,2>{0.338800013f, 0.7323879f},
-std::array<float,2>{0.534035206f, 0.407666653f},
-std::array<float,2>{0.043827042f, 0.307022035f},
-std::array<float,2>{0.862522721f, 0.608960092f},
-std::array<float,2>{0.286516249f, 0.765424669f},
-std::array<float,2>{0.610794067f, 0.0444783382f},
-std::array<float,2>{0.411754847f, 0.184390336f},
-std::array<float,2>{0.635772169f, 0.972023308f},
-std::array<float,2>{0.170374542f, 0.677045286f},
-std::array<float,2>{0.952659369f, 0.482433558f},
-std::array<float,2>{0.370149791f, 0.394002199f},
-std::array<float,2>{0.512719989f, 0.691577375f},
-std::array<float,2>{0.101732984f, 0.935238779f},
-std::array<float,2>{0.76284045f, 0.221681818f},
-std::array<float,2>{0.217590898f, 0.0652025715f},
-std::array<float,2>{0.882015049f, 0.838383734f},
-std::array<float,2>{0.440751851f, 0.559885323f},
-std::array<float,2>{0.744195998f, 0.32293424f},
-std::array<float,2>{0.121998243f, 0.425816149f},
-std::array<float,2>{0.768108666f, 0.742204905f},
-std::array<float,2>{0.357815295f, 0.889092863f},
-std::array<float,2>{0.529049039f, 0.193710163f},
-std::array<float,2>{0.466136336f, 0.0955052078f},
-std::array<float,2>{0.725787163f, 0.867611706f},
-std::array<float,2>{0.193327427f, 0.506505728f},
-std::array<float,2>{0.906118512f, 0.364594251f},
-std::array<float,2>{0.312165499f, 0.25255096f},
-std::array<float,2>{0.60608834f, 0.564901948f},
-std::array<float,2>{0.0575498641f, 0.806607842f},
-std::array<float,2>{0.855042934f, 0.0279541016f},
-std::array<float,2>{0.184679449f, 0.139593661f},
-std::array<float,2>{0.963288248f, 0.968696117f},
-std::array<float,2>{0.4222987f, 0.647392273f},
-std::array<float,2>{0.644236445f, 0.459975749f},
-std::array<float,2>{0.246246874f, 0.338459253f},
-std::array<float,2>{0.933760345f, 0.538863361f},
-std::array<float,2>{0.487650901f, 0.822331846f},
-std::array<float,2>{0.70632869f, 0.0809819922f},
-std::array<float,2>{0.32666266f, 0.24709399f},
-std::array<float,2>{0.55392772f, 0.920740426f},
-std::array<float,2>{0.0824263096f, 0.708584309f},
-std::array<float,2>{0.784427345f, 0.385134161f},
-std::array<float,2>{0.378871769f, 0.487528443f},
-std::array<float,2>{0.667059422f, 0.667144001f},
-std::array<float,2>{0.14266862f, 0.995803177f},
-std::array<float,2>{0.992896199f, 0.169221893f},
-std::array<float,2>{0.00923765823f, 0.0544449203f},
-std::array<float,2>{0.838129163f, 0.768834233f},
-std::array<float,2>{0.252819419f, 0.624289572f},
-std::array<float,2>{0.582496524f, 0.292178124f},
-std::array<float,2>{0.201159477f, 0.375476897f},
-std::array<float,2>{0.89325434f, 0.711991251f},
-std::array<float,2>{0.454869598f, 0.907965183f},
-std::array<float,2>{0.727179229f, 0.239614904f},
-std::array<float,2>{0.348184288f, 0.0901893973f},
-std::array<float,2>{0.516412258f, 0.817292273f},
-std::array<float,2>{0.114621118f, 0.545078635f},
-std::array<float,2>{0.77672857f, 0.33095333f},
-std::array<float,2>{0.431422532f, 0.282357633f},
-std::array<float,2>{0.64985019f, 0.611153901f},
-std::array<float,2>{0.177962661f, 0.773596764f},
-std::array<float,2>{0.96060127f, 0.0597278997f},
-std::array<float,2>{0.050313022f, 0.160468027f},
-std::array<float,2>{0.8462466f, 0.990997791f},
-std::array<float,2>{0.302803934f, 0.658807635f},
-std::array<float,2>{0.594953775f, 0.497280836f},
-std::array<float,2>{0.0894927084f, 0.372732848f},
-std::array<float,2>{0.795378983f, 0.508855462f},
-std::array<float,2>{0.315347433f, 0.866179645f},
-std::array<float,2>{0.559626102f, 0.103091322f},
-std::array<float,2>{0.496368408f, 0.200569049f},
-std::array<float,2>{0.711167097f, 0.878640354f},
-std::array<float,2>{0.240259036f, 0.736919641f},
-std::array<float,2>{0.928561091f, 0.434009671f},
-std::array<float,2>{0.259356678f, 0.462166607f},
-std::array<float,2>{0.591473341f, 0.65470469f},
-std::array<float,2>{0.00204130309f, 0.956262529f},
-std::array<float,2>{0.82893014f, 0.125509873f},
-std::array<float,2>{0.152463451f, 0.0179192834f},
-std::array<float,2>{0.985003948f, 0.797199905f},
-std::array<float,2>{0.386403054f, 0.575996339f},
-std::array<float,2>{0.661396503f, 0.261010379f},
-std::array<float,2>{0.0311637148f, 0.473410338f},
-std::array<float,2>{0.827632129f, 0.686871409f},
-std::array<float,2>{0.273634255f, 0.981999278f},
-std::array<float,2>{0.562656999f, 0.177889436f},
-std::array<float,2>{0.392999738f, 0.0376860239f},
-std::array<float,2>{0.672145426f, 0.753313839f},
-std::array<float,2>{0.133269638f, 0.597785056f},
-std::array<float,2>{0.97500062f, 0.296981215f},
-std::array<float,2>{0.335507244f, 0.319418579f},
-std::array<float,2>{0.543905377f, 0.552060843f},
-std::array<float,2>{0.0682970136f, 0.835615516f},
-std::array<float,2>{0.798556805f, 0.0775104836f},
-std::array<float,2>{0.222018659f, 0.227127671f},
-std::array<float,2>{0.920252979f, 0.925872684f},
-std::array<float,2>{0.482688874f, 0.700042367f},
-std::array<float,2>{0.701428413f, 0.402649224f},
-std::array<float,2>{0.163809717f, 0.279357463f},
-std::array<float,2>{0.941462934f, 0.590784252f},
-std::array<float,2>{0.416679978f, 0.789243996f},
-std::array<float,2>{0.628626883f, 0.0094935894f},
-std::array<float,2>{0.295124948f, 0.146367297f},
-std::array<float,2>{0.620726466f, 0.938981652f},
-std::array<float,2>{0.0381811522f, 0.632120669f},
-std::array<float,2>{0.873941898f, 0.43784979f},
-std::array<float,2>{0.45188719f, 0.417812914f},
-std::array<float,2>{0.73916924f, 0.723620951f},
-std::array<float,2>{0.204829603f, 0.900668621f},
-std::array<float,2>{0.885919809f, 0.20620729f},
-std::array<float,2>{0.100669965f, 0.112891138f},
-std::array<float,2>{0.751448929f, 0.857409894f},
-std::array<float,2>{0.363722831f, 0.519775569f},
-std::array<float,2>{0.507396519f, 0.346137762f},
-std::array<float,2>{0.21344839f, 0.46797061f},
-std::array<float,2>{0.878897429f, 0.649335623f},
-std::array<float,2>{0.444348156f, 0.960645437f},
-std::array<float,2>{0.746170938f, 0.131616414f},
-std::array<float,2>{0.372218013f, 0.0196820982f},
-std::array<float,2>{0.510602891f, 0.802307487f},
-std::array<float,2>{0.106223375f, 0.572335541f},
-std::array<float,2>{0.761483908f, 0.264519334f},
-std::array<float,2>{0.408263803f, 0.36811772f},
-std::array<float,2>{0.638234794f, 0.513815582f},
-std::array<float,2>{0.166251197f, 0.860556722f},
-std::array<float,2>{0.948765516f, 0.105916522f},
-std::array<float,2>{0.0397149101f, 0.19739601f},
-std::array<float,2>{0.865941167f, 0.87987709f},
-std::array<float,2>{0.284724027f, 0.740544379f},
-std::array<float,2>{0.614273071f, 0.433441401f},
-std::array<float,2>{0.0741315708f, 0.285959661f},
-std::array<float,2>{0.808951974f, 0.614451706f},
-std::array<float,2>{0.340843707f, 0.777683198f},
-std::array<float,2>{0.536452711f, 0.0572569147f},
-std::array<float,2>{0.472522914f, 0.15919134f},
-std::array<float,2>{0.6950773f, 0.985194981f},
-std::array<float,2>{0.22679159f, 0.662008882f},
-std::array<float,2>{0.906307697f, 0.495449245f},
-std::array<float,2>{0.270196646f, 0.382476389f},
-std::array<float,2>{0.570489705f, 0.718268335f},
-std::array<float,2>{0.0194351263f, 0.911380291f},
-std::array<float,2>{0.816947699f, 0.234497532f},
-std::array<float,2>{0.132159799f, 0.0881645754f},
-std::array<float,2>{0.979629278f, 0.812575638f},
-std::array<float,2>{0.405501425f, 0.539620936f},
-std::array<float,2>{0.683521092f, 0.335341841f},
-std::array<float,2>{0.0154548995f, 0.418017954f},
-std::array<float,2>{0.840870798f, 0.721684337f},
-std::array<float,2>{0.254152954f, 0.904770851f},
-std::array<float,2>{0.57922101f, 0.210808665f},
-std::array<float,2>{0.381494582f, 0.113953844f},
-std::array<float,2>{0.670261085f, 0.854106545f},
-std::array<float,2>{0.147376791f, 0.51674968f},
-std::array<float,2>{0.998192012f, 0.349646121f},
-std::array<float,2>{0.321703762f, 0.276457816f},
-std::array<float,2>{0.54805547f, 0.586994231f},
-std::array<float,2>{0.0785398334f, 0.795181751f},
-std::array<float,2>{0.786016941f, 0.0122318007f},
-std::array<float,2>{0.245684072f, 0.143908218f},
-std::array<float,2>{0.93214798f, 0.944409549f},
-std::array<float,2>{0.489221424f, 0.626432657f},
-std::array<float,2>{0.708592176f, 0.443455935f},
-std::array<float,2>{0.18091464f, 0.313760787f},
-std::array<float,2>{0.968138456f, 0.549039185f},
-std::array<float,2>{0.428367347f, 0.828150153f},
-std::array<float,2>{0.645044029f, 0.0741603523f},
-std::array<float,2>{0.30776459f, 0.232367054f},
-std::array<float,2>{0.605394304f, 0.925541639f},
-std::array<float,2>{0.0602807477f, 0.695923567f},
-std::array<float,2>{0.858687818f, 0.401052445f},
-std::array<float,2>{0.463749856f, 0.470908463f},
-std::array<float,2>{0.719203711f, 0.682181716f},
-std::array<float,2>{0.189950839f, 0.978732169f},
-std::array<float,2>{0.901566505f, 0.173745394f},
-std::array<float,2>{0.118303217f, 0.0330173932f},
-std::array<float,2>{0.773211598f, 0.755021632f},
-std::array<float,2>{0.355377793f, 0.59389317f},
-std::array<float,2>{0.526359081f, 0.303130358f},
-std::array<float,2>{0.150271893f, 0.396558225f},
-std::array<float,2>{0.991918445f, 0.689012766f},
-std::array<float,2>{0.387888908f, 0.931106925f},
-std::array<float,2>{0.656462789f, 0.223153278f},
-std::array<float,2>{0.263718367f, 0.0693077892f},
-std::array<float,2>{0.586305737f, 0.840741932f},
-std::array<float,2>{0.00605947338f, 0.556689858f},
-std::array<float,2>{0.834718227f, 0.326040685f},
-std::array<float,2>{0.493531287f, 0.309089959f},
-std::array<float,2>{0.715882838f, 0.60246855f},
-std::array<float,2>{0.237426639f, 0.758334517f},
-std::array<float,2>{0.922122419f, 0.0391324684f},
-std::array<float,2>{0.0904326513f, 0.180091009f},
-std::array<float,2>{0.791562498f, 0.975929737f},
-std::array<float,2>{0.318246126f, 0.672734737f},
-std::array<float,2>{0.557790518f, 0.479656249f},
-std::array<float,2>{0.0544233993f, 0.35268563f},
-std::array<float,2>{0.851002872f, 0.528588951f},
-std::array<float,2>{0.299880922f, 0.847639799f},
-std::array<float,2>{0.601461887f, 0.12186189f},
-std::array<float,2>{0.437335879f, 0.213638842f},
-std::array<float,2>{0.656220555f, 0.893765509f},
-std::array<float,2>{0.174001247f, 0.729703426f},
-std::array<float,2>{0.953157067f, 0.411521822f},
-std::array<float,2>{0.347092986f, 0.45309338f},
-std::array<float,2>{0.522191882f, 0.634247899f},
-std::array<float,2>{0.112476446f, 0.946066737f},
-std::array<float,2>{0.778059781f, 0.149189174f},
-std::array<float,2>{0.19575192f, 0.00595755409f},
-std::array<float,2>{0.894589007f, 0.783565104f},
-std::array<float,2>{0.459899694f, 0.58316499f},
-std::array<float,2>{0.733940542f, 0.267177105f},
-std::array<float,2>{0.0951811075f, 0.488281429f},
-std::array<float,2>{0.756359577f, 0.671590686f},
-std::array<float,2>{0.360844523f, 0.997632444f},
-std::array<float,2>{0.501370549f, 0.165369809f},
-std::array<float,2>{0.448870093f, 0.0502582155f},
-std::array<float,2>{0.737187505f, 0.771717846f},
-std::array<float,2>{0.209587857f, 0.619636893f},
-std::array<float,2>{0.887174368f, 0.295960546f},
-std::array<float,2>{0.289143562f, 0.341165304f},
-std::array<float,2>{0.623571157f, 0.534881651f},
-std::array<float,2>{0.0345910862f, 0.824310064f},
-std::array<float,2>{0.870621264f, 0.0843744054f},
-std::array<float,2>{0.156708971f, 0.245304167f},
-std::array<float,2>{0.939529657f, 0.914561093f},
-std::array<float,2>{0.421523571f, 0.704640985f},
-std::array<float,2>{0.631639063f, 0.389251977f},
-std::array<float,2>{0.226005584f, 0.256096363f},
-std::array<float,2>{0.917436957f, 0.56650883f},
-std::array<float,2>{0.4798778f, 0.810985088f},
-std::array<float,2>{0.699136853f, 0.0237752367f},
-std::array<float,2>{0.328957498f, 0.134932086f},
-std::array<float,2>{0.539441168f, 0.964420974f},
-std::array<float,2>{0.0628382415f, 0.643999279f},
-std::array<float,2>{0.802339375f, 0.45533371f},
-std::array<float,2>{0.394623995f, 0.423769444f},
-std::array<float,2>{0.675943255f, 0.748436153f},
-std::array<float,2>{0.137430042f, 0.886017323f},
-std::array<float,2>{0.968999505f, 0.187848166f},
-std::array<float,2>{0.0265373066f, 0.0989087075f},
-std::array<float,2>{0.823856115f, 0.874149382f},
-std::array<float,2>{0.277970344f, 0.503290236f},
-std::array<float,2>{0.569477141f, 0.36022073f},
-std::array<float,2>{0.168480247f, 0.481824428f},
-std::array<float,2>{0.950397372f, 0.679674387f},
-std::array<float,2>{0.412359476f, 0.968917787f},
-std::array<float,2>{0.634270549f, 0.187094048f},
-std::array<float,2>{0.287516415f, 0.046629101f},
-std::array<float,2>{0.612744689f, 0.76301235f},
-std::array<float,2>{0.0464092158f, 0.606078386f},
-std::array<float,2>{0.861304522f, 0.306161106f},
-std::array<float,2>{0.437936038f, 0.321644843f},
-std::array<float,2>{0.74373436f, 0.561884761f},
-std::array<float,2>{0.215519771f, 0.836619794f},
-std::array<float,2>{0.879911482f, 0.0625296757f},
-std::array<float,2>{0.103683226f, 0.218865767f},
-std::array<float,2>{0.765284061f, 0.935786068f},
-std::array<float,2>{0.368868947f, 0.693532586f},
-std::array<float,2>{0.515621543f, 0.39215225f},
-std::array<float,2>{0.023287477f, 0.273149788f},
-std::array<float,2>{0.814351916f, 0.579828203f},
-std::array<float,2>{0.266689718f, 0.785460413f},
-std::array<float,2>{0.576676965f, 0.00115256186f},
-std::array<float,2>{0.39910686f, 0.153883651f},
-std::array<float,2>{0.684969842f, 0.950891972f},
-std::array<float,2>{0.125448972f, 0.640366614f},
-std::array<float,2>{0.982333601f, 0.448217541f},
-std::array<float,2>{0.337063581f, 0.408305079f},
-std::array<float,2>{0.532464743f, 0.734155953f},
-std::array<float,2>{0.0769824758f, 0.897294283f},
-std::array<float,2>{0.807324886f, 0.216276467f},
-std::array<float,2>{0.232921138f, 0.117817953f},
-std::array<float,2>{0.913460791f, 0.851547539f},
-std::array<float,2>{0.476424366f, 0.525826633f},
-std::array<float,2>{0.690306485f, 0.356905937f},
-std::array<float,2>{0.0859152749f, 0.384550542f},
-std::array<float,2>{0.783150613f, 0.710471034f},
-std::array<float,2>{0.325612634f, 0.919095159f},
-std::array<float,2>{0.551929295f, 0.249389008f},
-std::array<float,2>{0.486156553f, 0.0792269483f},
-std::array<float,2>{0.70447278f, 0.822016299f},
-std::array<float,2>{0.249764621f, 0.536938906f},
-std::array<float,2>{0.935711741f, 0.335952461f},
-std::array<float,2>{0.250695586f, 0.29044205f},
-std::array<float,2>{0.585513115f, 0.622318149f},
-std::array<float,2>{0.0106643382f, 0.766348362f},
-std::array<float,2>{0.836221159f, 0.0517173819f},
-std::array<float,2>{0.141493559f, 0.171118781f},
-std::array<float,2>{0.994235992f, 0.994060934f},
-std::array<float,2>{0.375690788f, 0.665214658f},
-std::array<float,2>{0.665429533f, 0.484709203f},
-std::array<float,2>{0.195177406f, 0.365721911f},
-std::array<float,2>{0.90252769f, 0.505574048f},
-std::array<float,2>{0.468113571f, 0.870091677f},
-std::array<float,2>{0.722833991f, 0.0957363546f},
-std::array<float,2>{0.356645077f, 0.192881316f},
-std::array<float,2>{0.52942723f, 0.887571931f},
-std::array<float,2>{0.123118408f, 0.744396567f},
-std::array<float,2>{0.767186761f, 0.428061754f},
-std::array<float,2>{0.425186247f, 0.457748055f},
-std::array<float,2>{0.641794145f, 0.644983053f},
-std::array<float,2>{0.18695122f, 0.966184556f},
-std::array<float,2>{0.960990846f, 0.13754651f},
-std::array<float,2>{0.0560062267f, 0.0309178233f},
-std::array<float,2>{0.851956725f, 0.808444619f},
-std::array<float,2>{0.309667081f, 0.563804269f},
-std::array<float,2>{0.607687235f, 0.251054764f},
-std::array<float,2>{0.23975794f, 0.435759038f},
-std::array<float,2>{0.926533818f, 0.735776007f},
-std::array<float,2>{0.498890758f, 0.875133157f},
-std::array<float,2>{0.713160455f, 0.202401385f},
-std::array<float,2>{0.312634528f, 0.104164474f},
-std::array<float,2>{0.561383367f, 0.86384517f},
-std::array<float,2>{0.0877589583f, 0.510319054f},
-std::array<float,2>{0.793688476f, 0.374627918f},
-std::array<float,2>{0.383566678f, 0.25798282f},
-std::array<float,2>{0.663499475f, 0.577685058f},
-std::array<float,2>{0.155312657f, 0.798842192f},
-std::array<float,2>{0.986412823f, 0.016029045f},
-std::array<float,2>{0.000926500652f, 0.127105504f},
-std::array<float,2>{0.830733776f, 0.954207718f},
-std::array<float,2>{0.261404753f, 0.653842032f},
-std::array<float,2>{0.592109025f, 0.463344842f},
-std::array<float,2>{0.116945706f, 0.329660475f},
-std::array<float,2>{0.773930013f, 0.544775128f},
-std::array<float,2>{0.350792736f, 0.81921041f},
-std::array<float,2>{0.518495619f, 0.0920994878f},
-std::array<float,2>{0.455690295f, 0.240336269f},
-std::array<float,2>{0.730189562f, 0.909529269f},
-std::array<float,2>{0.202076763f, 0.714093268f},
-std::array<float,2>{0.892401099f, 0.377102345f},
-std::array<float,2>{0.302488148f, 0.498586923f},
-std::array<float,2>{0.595721781f, 0.658196092f},
-std::array<float,2>{0.0474996455f, 0.99001056f},
-std::array<float,2>{0.844018877f, 0.162778512f},
-std::array<float,2>{0.175880507f, 0.061219845f},
-std::array<float,2>{0.957243741f, 0.775735676f},
-std::array<float,2>{0.433197826f, 0.612228632f},
-std::array<float,2>{0.651405931f, 0.28323406f},
-std::array<float,2>{0.0364953056f, 0.439628005f},
-std::array<float,2>{0.872875273f, 0.629288316f},
-std::array<float,2>{0.293162882f, 0.940518677f},
-std::array<float,2>{0.618047774f, 0.146545693f},
-std::array<float,2>{0.414528012f, 0.0100018503f},
-std::array<float,2>{0.626932681f, 0.792570114f},
-std::array<float,2>{0.160589799f, 0.593035519f},
-std::array<float,2>{0.944873035f, 0.277822614f},
-std::array<float,2>{0.366011173f, 0.345025361f},
-std::array<float,2>{0.504247844f, 0.522739589f},
-std::array<float,2>{0.0985941365f, 0.857698262f},
-std::array<float,2>{0.752394915f, 0.109502882f},
-std::array<float,2>{0.206490323f, 0.203134805f},
-std::array<float,2>{0.884423137f, 0.900298059f},
-std::array<float,2>{0.449435651f, 0.726041973f},
-std::array<float,2>{0.741818249f, 0.41555202f},
-std::array<float,2>{0.135289818f, 0.299033076f},
-std::array<float,2>{0.973415971f, 0.601356626f},
-std::array<float,2>{0.391750634f, 0.75009346f},
-std::array<float,2>{0.674162269f, 0.0356534459f},
-std::array<float,2>{0.275409192f, 0.176635057f},
-std::array<float,2>{0.565978527f, 0.983520925f},
-std::array<float,2>{0.0277024545f, 0.684555888f},
-std::array<float,2>{0.825451374f, 0.475199014f},
-std::array<float,2>{0.482247621f, 0.405050337f},
-std::array<float,2>{0.699433446f, 0.701363444f},
-std::array<float,2>{0.219439402f, 0.928020179f},
-std::array<float,2>{0.919337332f, 0.229874954f},
-std::array<float,2>{0.068622455f, 0.0761072189f},
-std::array<float,2>{0.800367653f, 0.833269358f},
-std::array<float,2>{0.333410949f, 0.553176343f},
-std::array<float,2>{0.545983732f, 0.318106294f},
-std::array<float,2>{0.243556261f, 0.445183605f},
-std::array<float,2>{0.930293202f, 0.625261128f},
-std::array<float,2>{0.492129058f, 0.944271803f},
-std::array<float,2>{0.709643304f, 0.143068075f},
-std::array<float,2>{0.323070824f, 0.0130814593f},
-std::array<float,2>{0.550034702f, 0.796254098f},
-std::array<float,2>{0.0814482346f, 0.586110175f},
-std::array<float,2>{0.788042903f, 0.27634576f},
-std::array<float,2>{0.379830986f, 0.350983828f},
-std::array<float,2>{0.668149054f, 0.516554534f},
-std::array<float,2>{0.145737201f, 0.854516149f},
-std::array<float,2>{0.998030066f, 0.11466682f},
-std::array<float,2>{0.0135310544f, 0.209499463f},
-std::array<float,2>{0.843146563f, 0.905867636f},
-std::array<float,2>{0.257706463f, 0.72149694f},
-std::array<float,2>{0.580403626f, 0.419911414f},
-std::array<float,2>{0.119186744f, 0.304646015f},
-std::array<float,2>{0.77061379f, 0.59553057f},
-std::array<float,2>{0.351894915f, 0.754696846f},
-std::array<float,2>{0.524717033f, 0.0315182172f},
-std::array<float,2>{0.461029023f, 0.172254443f},
-std::array<float,2>{0.722400248f, 0.980394006f},
-std::array<float,2>{0.187831402f, 0.683577955f},
-std::array<float,2>{0.900225401f, 0.471805602f},
-std::array<float,2>{0.30510655f, 0.40202561f},
-std::array<float,2>{0.601711988f, 0.696995974f},
-std::array<float,2>{0.0608891845f, 0.924629331f},
-std::array<float,2>{0.856022477f, 0.2307197f},
-std::array<float,2>{0.182123646f, 0.0728303418f},
-std::array<float,2>{0.965159893f, 0.829866529f},
-std::array<float,2>{0.427523762f, 0.550688326f},
-std::array<float,2>{0.647113323f, 0.313321233f},
-std::array<float,2>{0.0413682796f, 0.432070643f},
-std::array<float,2>{0.864454567f, 0.741891146f},
-std::array<float,2>{0.282957256f, 0.880665779f},
-std::array<float,2>{0.616787732f, 0.198448494f},
-std::array<float,2>{0.406790286f, 0.107197851f},
-std::array<float,2>{0.639582038f, 0.860269845f},
-std::array<float,2>{0.164224982f, 0.515463293f},
-std::array<float,2>{0.945422292f, 0.368999422f},
-std::array<float,2>{0.374155492f, 0.264662862f},
-std::array<float,2>{0.507885039f, 0.573573053f},
-std::array<float,2>{0.108842596f, 0.801305473f},
-std::array<float,2>{0.759294689f, 0.0212138966f},
-std::array<float,2>{0.211522385f, 0.132056296f},
-std::array<float,2>{0.875956953f, 0.95954752f},
-std::array<float,2>{0.44255814f, 0.650049329f},
-std::array<float,2>{0.749842227f, 0.466912508f},
-std::array<float,2>{0.129968047f, 0.334789127f},
-std::array<float,2>{0.977755725f, 0.540861905f},
-std::array<float,2>{0.402554542f, 0.814147174f},
-std::array<float,2>{0.681257844f, 0.0894177854f},
-std::array<float,2>{0.272405863f, 0.235690877f},
-std::array<float,2>{0.573810935f, 0.910681725f},
-std::array<float,2>{0.0164381396f, 0.717660606f},
-std::array<float,2>{0.820106328f, 0.381450713f},
-std::array<float,2>{0.469381362f, 0.494701356f},
-std::array<float,2>{0.691674232f, 0.66090852f},
-std::array<float,2>{0.228901163f, 0.986148238f},
-std::array<float,2>{0.909123659f, 0.158375412f},
-std::array<float,2>{0.0712415949f, 0.0580331832f},
-std::array<float,2>{0.812028468f, 0.778526962f},
-std::array<float,2>{0.341827989f, 0.614210546f},
-std::array<float,2>{0.537848473f, 0.286916435f},
-std::array<float,2>{0.159534067f, 0.390271336f},
-std::array<float,2>{0.938499331f, 0.704037309f},
-std::array<float,2>{0.417989403f, 0.915549219f},
-std::array<float,2>{0.629758835f, 0.244181171f},
-std::array<float,2>{0.29279843f, 0.0855750218f},
-std::array<float,2>{0.621436f, 0.825225413f},
-std::array<float,2>{0.0325143263f, 0.534053862f},
-std::array<float,2>{0.867586493f, 0.340638697f},
-std::array<float,2>{0.446668357f, 0.294958621f},
-std::array<float,2>{0.735917747f, 0.620331347f},
-std::array<float,2>{0.208519801f, 0.772906482f},
-std::array<float,2>{0.88944608f, 0.0493093282f},
-std::array<float,2>{0.0960033685f, 0.164935589f},
-std::array<float,2>{0.75446105f, 0.996734381f},
-std::array<float,2>{0.361608714f, 0.670642078f},
-std::array<float,2>{0.503515601f, 0.489610493f},
-std::array<float,2>{0.0249427166f, 0.360708147f},
-std::array<float,2>{0.821102738f, 0.502486467f},
-std::array<float,2>{0.279927254f, 0.873160124f},
-std::array<float,2>{0.568127632f, 0.0978164598f},
-std::array<float,2>{0.396698296f, 0.189313352f},
-std::array<float,2>{0.677737951f, 0.885200977f},
-std::array<float,2>{0.139629245f, 0.749681711f},
-std::array<float,2>{0.972607017f, 0.42236653f},
-std::array<float,2>{0.331971735f, 0.456061721f},
-std::array<float,2>{0.542930484f, 0.642943382f},
-std::array<float,2>{0.0648442581f, 0.963224411f},
-std::array<float,2>{0.804473996f, 0.136707827f},
-std::array<float,2>{0.222776473f, 0.0251263827f},
-std::array<float,2>{0.914622605f, 0.812174678f},
-std::array<float,2>{0.477450788f, 0.568296492f},
-std::array<float,2>{0.696167707f, 0.257310033f},
-std::array<float,2>{0.0927331671f, 0.479492038f},
-std::array<float,2>{0.789792061f, 0.673595369f},
-std::array<float,2>{0.319677204f, 0.97495842f},
-std::array<float,2>{0.556628704f, 0.1811378f},
-std::array<float,2>{0.494828582f, 0.0402154513f},
-std::array<float,2>{0.717271507f, 0.759547174f},
-std::array<float,2>{0.236261383f, 0.603258252f},
-std::array<float,2>{0.924386978f, 0.309702128f},
-std::array<float,2>{0.262886733f, 0.324501723f},
-std::array<float,2>{0.588769317f, 0.558260739f},
-std::array<float,2>{0.00571443513f, 0.841359973f},
-std::array<float,2>{0.833474994f, 0.06995783f},
-std::array<float,2>{0.151048109f, 0.224316522f},
-std::array<float,2>{0.989580929f, 0.930199325f},
-std::array<float,2>{0.390130818f, 0.688175023f},
-std::array<float,2>{0.65866679f, 0.397531182f},
-std::array<float,2>{0.197507292f, 0.266093969f},
-std::array<float,2>{0.897627056f, 0.582506061f},
-std::array<float,2>{0.457276821f, 0.785085738f},
-std::array<float,2>{0.732390165f, 0.00756829884f},
-std::array<float,2>{0.3450647f, 0.14954409f},
-std::array<float,2>{0.521213293f, 0.946718037f},
-std::array<float,2>{0.110249422f, 0.632978439f},
-std::array<float,2>{0.780502498f, 0.451607585f},
-std::array<float,2>{0.435525239f, 0.410392284f},
-std::array<float,2>{0.653911233f, 0.729161322f},
-std::array<float,2>{0.173050106f, 0.892640233f},
-std::array<float,2>{0.955505729f, 0.214615792f},
-std::array<float,2>{0.0509672537f, 0.123033859f},
-std::array<float,2>{0.849517822f, 0.846145689f},
-std::array<float,2>{0.298776001f, 0.527977586f},
-std::array<float,2>{0.599123716f, 0.351855695f},
-std::array<float,2>{0.144387171f, 0.486220956f},
-std::array<float,2>{0.993457794f, 0.664943218f},
-std::array<float,2>{0.377293557f, 0.99301672f},
-std::array<float,2>{0.666348636f, 0.170049354f},
-std::array<float,2>{0.253489792f, 0.0525267236f},
-std::array<float,2>{0.583471775f, 0.76723671f},
-std::array<float,2>{0.0086074369f, 0.621148705f},
-std::array<float,2>{0.83953315f, 0.289476931f},
-std::array<float,2>{0.486411184f, 0.33699885f},
-std::array<float,2>{0.705676138f, 0.535349667f},
-std::array<float,2>{0.247688532f, 0.82067281f},
-std::array<float,2>{0.93545711f, 0.0784500763f},
-std::array<float,2>{0.0834810883f, 0.248554826f},
-std::array<float,2>{0.783983827f, 0.918809295f},
-std::array<float,2>{0.327346861f, 0.709836721f},
-std::array<float,2>{0.553224146f, 0.382929325f},
-std::array<float,2>{0.0584025867f, 0.250419319f},
-std::array<float,2>{0.854316056f, 0.563272595f},
-std::array<float,2>{0.310809702f, 0.806666493f},
-std::array<float,2>{0.606828213f, 0.0296116918f},
-std::array<float,2>{0.423465043f, 0.13848795f},
-std::array<float,2>{0.643141866f, 0.965213418f},
-std::array<float,2>{0.183739647f, 0.645564854f},
-std::array<float,2>{0.964431882f, 0.458735108f},
-std::array<float,2>{0.358800173f, 0.428790718f},
-std::array<float,2>{0.528078794f, 0.745222807f},
-std::array<float,2>{0.122487865f, 0.887757123f},
-std::array<float,2>{0.768858492f, 0.191646174f},
-std::array<float,2>{0.191767409f, 0.0970678702f},
-std::array<float,2>{0.905206323f, 0.870183349f},
-std::array<float,2>{0.465318561f, 0.50433594f},
-std::array<float,2>{0.725358427f, 0.366746068f},
-std::array<float,2>{0.103160337f, 0.390703797f},
-std::array<float,2>{0.76240176f, 0.694750071f},
-std::array<float,2>{0.369292229f, 0.936637223f},
-std::array<float,2>{0.512316823f, 0.219914556f},
-std::array<float,2>{0.440398753f, 0.0638917685f},
-std::array<float,2>{0.745441794f, 0.837173104f},
-std::array<float,2>{0.218370423f, 0.56102407f},
-std::array<float,2>{0.880870402f, 0.321023583f},
-std::array<float,2>{0.285837173f, 0.304820478f},
-std::array<float,2>{0.609943271f, 0.606629729f},
-std::array<float,2>{0.0444319807f, 0.762067139f},
-std::array<float,2>{0.862287343f, 0.04521266f},
-std::array<float,2>{0.171178028f, 0.185593411f},
-std::array<float,2>{0.951379776f, 0.969995439f},
-std::array<float,2>{0.410356402f, 0.678229749f},
-std::array<float,2>{0.634892523f, 0.481243551f},
-std::array<float,2>{0.231027856f, 0.355581313f},
-std::array<float,2>{0.910411775f, 0.526547492f},
-std::array<float,2>{0.472736031f, 0.849641442f},
-std::array<float,2>{0.68937695f, 0.118243337f},
-std::array<float,2>{0.339362025f, 0.215305343f},
-std::array<float,2>{0.535032094f, 0.897913575f},
-std::array<float,2>{0.0746595189f, 0.732827604f},
-std::array<float,2>{0.804946184f, 0.409979761f},
-std::array<float,2>{0.402077138f, 0.448837608f},
-std::array<float,2>{0.687217593f, 0.639179647f},
-std::array<float,2>{0.127277002f, 0.949945867f},
-std::array<float,2>{0.984308064f, 0.153280914f},
-std::array<float,2>{0.0195468813f, 0.000612505304f},
-std::array<float,2>{0.815424025f, 0.786964893f},
-std::array<float,2>{0.268218815f, 0.57851541f},
-std::array<float,2>{0.575226367f, 0.271617711f},
-std::array<float,2>{0.203739256f, 0.41488418f},
-std::array<float,2>{0.884810269f, 0.724762917f},
-std::array<float,2>{0.452999234f, 0.89879334f},
-std::array<float,2>{0.739609241f, 0.204332724f},
-std::array<float,2>{0.364726543f, 0.110798098f},
-std::array<float,2>{0.506560922f, 0.859369278f},
-std::array<float,2>{0.100401476f, 0.522093594f},
-std::array<float,2>{0.750855565f, 0.344298929f},
-std::array<float,2>{0.417854548f, 0.279131532f},
-std::array<float,2>{0.627026558f, 0.591907203f},
-std::array<float,2>{0.162453383f, 0.791569114f},
-std::array<float,2>{0.943055212f, 0.0115506686f},
-std::array<float,2>{0.0377158225f, 0.14746511f},
-std::array<float,2>{0.874562919f, 0.939538121f},
-std::array<float,2>{0.296766788f, 0.629958153f},
-std::array<float,2>{0.619153798f, 0.440834343f},
-std::array<float,2>{0.0668631047f, 0.316688031f},
-std::array<float,2>{0.797772527f, 0.554423273f},
-std::array<float,2>{0.334655166f, 0.832455218f},
-std::array<float,2>{0.544662058f, 0.0747885481f},
-std::array<float,2>{0.483866513f, 0.22878477f},
-std::array<float,2>{0.702822745f, 0.929563344f},
-std::array<float,2>{0.221550524f, 0.702932656f},
-std::array<float,2>{0.921404719f, 0.405831456f},
-std::array<float,2>{0.274950862f, 0.475822568f},
-std::array<float,2>{0.563639879f, 0.684657991f},
-std::array<float,2>{0.0299492143f, 0.982910573f},
-std::array<float,2>{0.827106714f, 0.176936805f},
-std::array<float,2>{0.134288222f, 0.0364109538f},
-std::array<float,2>{0.975695789f, 0.751921415f},
-std::array<float,2>{0.394345134f, 0.599868178f},
-std::array<float,2>{0.673786163f, 0.299818724f},
-std::array<float,2>{0.00316002104f, 0.464640647f},
-std::array<float,2>{0.829575896f, 0.653165221f},
-std::array<float,2>{0.258735448f, 0.953506708f},
-std::array<float,2>{0.590048909f, 0.128240496f},
-std::array<float,2>{0.3853167f, 0.0171833485f},
-std::array<float,2>{0.660875618f, 0.800103784f},
-std::array<float,2>{0.154195935f, 0.576461613f},
-std::array<float,2>{0.985419631f, 0.259415179f},
-std::array<float,2>{0.315720677f, 0.373918623f},
-std::array<float,2>{0.55923295f, 0.511250675f},
-std::array<float,2>{0.0884276778f, 0.864577651f},
-std::array<float,2>{0.796456277f, 0.105444863f},
-std::array<float,2>{0.242104158f, 0.201442271f},
-std::array<float,2>{0.929654539f, 0.876220763f},
-std::array<float,2>{0.497934788f, 0.735274017f},
-std::array<float,2>{0.712869406f, 0.437066436f},
-std::array<float,2>{0.179033339f, 0.284263283f},
-std::array<float,2>{0.95941627f, 0.613088369f},
-std::array<float,2>{0.429795265f, 0.776992977f},
-std::array<float,2>{0.649092078f, 0.0621159151f},
-std::array<float,2>{0.304631859f, 0.163160741f},
-std::array<float,2>{0.593789577f, 0.988782763f},
-std::array<float,2>{0.0490959324f, 0.656644106f},
-std::array<float,2>{0.847503483f, 0.499094725f},
-std::array<float,2>{0.453469664f, 0.378847063f},
-std::array<float,2>{0.727722526f, 0.713061631f},
-std::array<float,2>{0.199777663f, 0.909005165f},
-std::array<float,2>{0.893695712f, 0.241785362f},
-std::array<float,2>{0.114083439f, 0.0935187265f},
-std::array<float,2>{0.775977731f, 0.820023894f},
-std::array<float,2>{0.349597216f, 0.543248594f},
-std::array<float,2>{0.517533064f, 0.328732073f},
-std::array<float,2>{0.190472752f, 0.469321638f},
-std::array<float,2>{0.901339352f, 0.680529177f},
-std::array<float,2>{0.464530736f, 0.977540672f},
-std::array<float,2>{0.719970584f, 0.174831614f},
-std::array<float,2>{0.353675753f, 0.0341822281f},
-std::array<float,2>{0.526823103f, 0.756460905f},
-std::array<float,2>{0.118123762f, 0.596048355f},
-std::array<float,2>{0.771583021f, 0.301529557f},
-std::array<float,2>{0.429024011f, 0.316065967f},
-std::array<float,2>{0.645901799f, 0.547969759f},
-std::array<float,2>{0.180393249f, 0.831724405f},
-std::array<float,2>{0.966812253f, 0.0707503036f},
-std::array<float,2>{0.0592348427f, 0.232987493f},
-std::array<float,2>{0.858136177f, 0.923020244f},
-std::array<float,2>{0.307379156f, 0.698151946f},
-std::array<float,2>{0.604177713f, 0.399660707f},
-std::array<float,2>{0.0798664913f, 0.275080055f},
-std::array<float,2>{0.786422551f, 0.589165688f},
-std::array<float,2>{0.320437402f, 0.793674707f},
-std::array<float,2>{0.547168553f, 0.0140045332f},
-std::array<float,2>{0.490027577f, 0.140987694f},
-std::array<float,2>{0.707630515f, 0.941967607f},
-std::array<float,2>{0.244919479f, 0.628643513f},
-std::array<float,2>{0.932703972f, 0.442295283f},
-std::array<float,2>{0.255624771f, 0.421630472f},
-std::array<float,2>{0.578332484f, 0.72036016f},
-std::array<float,2>{0.0142738745f, 0.904213727f},
-std::array<float,2>{0.840274751f, 0.208845258f},
-std::array<float,2>{0.147683084f, 0.116163149f},
-std::array<float,2>{0.999154389f, 0.852693081f},
-std::array<float,2>{0.382030994f, 0.519441366f},
-std::array<float,2>{0.671499729f, 0.349424899f},
-std::array<float,2>{0.0178219061f, 0.380600005f},
-std::array<float,2>{0.817515016f, 0.715189397f},
-std::array<float,2>{0.271290392f, 0.912561119f},
-std::array<float,2>{0.571525514f, 0.236946985f},
-std::array<float,2>{0.405067086f, 0.0867475718f},
-std::array<float,2>{0.6825037f, 0.815437555f},
-std::array<float,2>{0.131148636f, 0.542713702f},
-std::array<float,2>{0.979351282f, 0.333857387f},
-std::array<float,2>{0.340042472f, 0.287747473f},
-std::array<float,2>{0.53609544f, 0.61579293f},
-std::array<float,2>{0.0728876889f, 0.780180156f},
-std::array<float,2>{0.810121477f, 0.054863885f},
-std::array<float,2>{0.227989823f, 0.157425433f},
-std::array<float,2>{0.908051431f, 0.986386299f},
-std::array<float,2>{0.471632242f, 0.662778735f},
-std::array<float,2>{0.694175541f, 0.49353376f},
-std::array<float,2>{0.167544052f, 0.369912773f},
-std::array<float,2>{0.947329402f, 0.511769831f},
-std::array<float,2>{0.409500539f, 0.862493813f},
-std::array<float,2>{0.637415051f, 0.108211718f},
-std::array<float,2>{0.283614427f, 0.196858495f},
-std::array<float,2>{0.61419934f, 0.881712377f},
-std::array<float,2>{0.0406073816f, 0.739309371f},
-std::array<float,2>{0.86682272f, 0.431125581f},
-std::array<float,2>{0.443831146f, 0.465232491f},
-std::array<float,2>{0.747674763f, 0.651151061f},
-std::array<float,2>{0.2143666f, 0.958729029f},
-std::array<float,2>{0.877914786f, 0.129513368f},
-std::array<float,2>{0.106678948f, 0.0231524669f},
-std::array<float,2>{0.759818316f, 0.803053677f},
-std::array<float,2>{0.371458381f, 0.570566416f},
-std::array<float,2>{0.511534393f, 0.261830449f},
-std::array<float,2>{0.138309896f, 0.425669402f},
-std::array<float,2>{0.97058624f, 0.747687876f},
-std::array<float,2>{0.395870686f, 0.884480417f},
-std::array<float,2>{0.677605629f, 0.190729976f},
-std::array<float,2>{0.27925235f, 0.100650154f},
-std::array<float,2>{0.569192231f, 0.8713817f},
-std::array<float,2>{0.0257616546f, 0.501662731f},
-std::array<float,2>{0.822554886f, 0.363199353f},
-std::array<float,2>{0.479352415f, 0.255453825f},
-std::array<float,2>{0.697927058f, 0.569042504f},
-std::array<float,2>{0.22527495f, 0.809839964f},
-std::array<float,2>{0.916377544f, 0.0262883846f},
-std::array<float,2>{0.0637559369f, 0.134541184f},
-std::array<float,2>{0.800989568f, 0.961684823f},
-std::array<float,2>{0.329854816f, 0.641947806f},
-std::array<float,2>{0.540754616f, 0.453518331f},
-std::array<float,2>{0.0338176265f, 0.343164086f},
-std::array<float,2>{0.869483411f, 0.532646179f},
-std::array<float,2>{0.290774763f, 0.827673376f},
-std::array<float,2>{0.62469995f, 0.0830732286f},
-std::array<float,2>{0.420092762f, 0.243548542f},
-std::array<float,2>{0.632554293f, 0.91785717f},
-std::array<float,2>{0.157573223f, 0.706731617f},
-std::array<float,2>{0.940673292f, 0.386934161f},
-std::array<float,2>{0.359791636f, 0.491942167f},
-std::array<float,2>{0.500536501f, 0.669084132f},
-std::array<float,2>{0.0943189934f, 0.999997556f},
-std::array<float,2>{0.757018626f, 0.167557642f},
-std::array<float,2>{0.210305572f, 0.046987813f},
-std::array<float,2>{0.888466179f, 0.771369636f},
-std::array<float,2>{0.448161542f, 0.617723942f},
-std::array<float,2>{0.738106132f, 0.293420434f},
-std::array<float,2>{0.1113666f, 0.450617969f},
-std::array<float,2>{0.779042244f, 0.634924412f},
-std::array<float,2>{0.3460612f, 0.947604716f},
-std::array<float,2>{0.523361742f, 0.150751099f},
-std::array<float,2>{0.46061182f, 0.00482514733f},
-std::array<float,2>{0.733388364f, 0.782370925f},
-std::array<float,2>{0.196640924f, 0.58584255f},
-std::array<float,2>{0.896033168f, 0.267664462f},
-std::array<float,2>{0.299581766f, 0.354883581f},
-std::array<float,2>{0.60046196f, 0.529716432f},
-std::array<float,2>{0.0531364232f, 0.844411373f},
-std::array<float,2>{0.850273132f, 0.124464184f},
-std::array<float,2>{0.174968392f, 0.211835027f},
-std::array<float,2>{0.955065966f, 0.891439915f},
-std::array<float,2>{0.435946614f, 0.726808906f},
-std::array<float,2>{0.654640615f, 0.413358212f},
-std::array<float,2>{0.23723425f, 0.31118381f},
-std::array<float,2>{0.923505247f, 0.60397011f},
-std::array<float,2>{0.492780149f, 0.761710942f},
-std::array<float,2>{0.715649128f, 0.0418226793f},
-std::array<float,2>{0.31655544f, 0.182164803f},
-std::array<float,2>{0.557281733f, 0.973846912f},
-std::array<float,2>{0.091662012f, 0.673869014f},
-std::array<float,2>{0.792277932f, 0.477250695f},
-std::array<float,2>{0.387239963f, 0.395788014f},
-std::array<float,2>{0.657554209f, 0.690366924f},
-std::array<float,2>{0.148764774f, 0.931729555f},
-std::array<float,2>{0.990541995f, 0.225372836f},
-std::array<float,2>{0.0070748073f, 0.0673542842f},
-std::array<float,2>{0.835836411f, 0.842129529f},
-std::array<float,2>{0.265439987f, 0.556288302f},
-std::array<float,2>{0.58779639f, 0.327804595f},
-std::array<float,2>{0.185617685f, 0.4597812f},
-std::array<float,2>{0.962598085f, 0.648136437f},
-std::array<float,2>{0.424352914f, 0.967751205f},
-std::array<float,2>{0.640984416f, 0.139803633f},
-std::array<float,2>{0.308843583f, 0.0283566099f},
-std::array<float,2>{0.609183788f, 0.80498445f},
-std::array<float,2>{0.0547772311f, 0.566194654f},
-std::array<float,2>{0.853348494f, 0.25311479f},
-std::array<float,2>{0.467258632f, 0.363908142f},
-std::array<float,2>{0.723824978f, 0.507716238f},
-std::array<float,2>{0.193637252f, 0.868893385f},
-std::array<float,2>{0.904269934f, 0.0945535675f},
-std::array<float,2>{0.124394611f, 0.195116282f},
-std::array<float,2>{0.765980899f, 0.890029132f},
-std::array<float,2>{0.355852574f, 0.743703723f},
-std::array<float,2>{0.5312289f, 0.427064151f},
-std::array<float,2>{0.0108778458f, 0.291957319f},
-std::array<float,2>{0.837617576f, 0.623834372f},
-std::array<float,2>{0.251625091f, 0.767811358f},
-std::array<float,2>{0.584418893f, 0.0535686985f},
-std::array<float,2>{0.376549095f, 0.168817014f},
-std::array<float,2>{0.664306283f, 0.99487561f},
-std::array<float,2>{0.14176175f, 0.666880786f},
-std::array<float,2>{0.995873272f, 0.487287194f},
-std::array<float,2>{0.324952036f, 0.386705548f},
-std::array<float,2>{0.551370621f, 0.707938731f},
-std::array<float,2>{0.0846427158f, 0.9210186f},
-std::array<float,2>{0.781653821f, 0.246771663f},
-std::array<float,2>{0.248881787f, 0.0813819841f},
-std::array<float,2>{0.937289357f, 0.82378459f},
-std::array<float,2>{0.48509568f, 0.537225664f},
-std::array<float,2>{0.703735352f, 0.339285344f},
-std::array<float,2>{0.077709958f, 0.406857282f},
-std::array<float,2>{0.808276832f, 0.731036246f},
-std::array<float,2>{0.336159736f, 0.895131886f},
-std::array<float,2>{0.532043993f, 0.218192071f},
-std::array<float,2>{0.475472867f, 0.120327823f},
-std::array<float,2>{0.691215754f, 0.84766835f},
-std::array<float,2>{0.233558133f, 0.523952723f},
-std::array<float,2>{0.912951887f, 0.358558804f},
-std::array<float,2>{0.266588956f, 0.270365566f},
-std::array<float,2>{0.577410638f, 0.581667125f},
-std::array<float,2>{0.0216834974f, 0.787939012f},
-std::array<float,2>{0.812568367f, 0.00290161627f},
-std::array<float,2>{0.126474679f, 0.155716673f},
-std::array<float,2>{0.980747759f, 0.952109814f},
-std::array<float,2>{0.400289983f, 0.637445152f},
-std::array<float,2>{0.683896065f, 0.446687639f},
-std::array<float,2>{0.216052413f, 0.323320925f},
-std::array<float,2>{0.879342318f, 0.558658659f},
-std::array<float,2>{0.438753724f, 0.839192688f},
-std::array<float,2>{0.742353618f, 0.0658629239f},
-std::array<float,2>{0.367521137f, 0.221359849f},
-std::array<float,2>{0.514321387f, 0.933910191f},
-std::array<float,2>{0.104675494f, 0.693155229f},
-std::array<float,2>{0.763981342f, 0.393465847f},
-std::array<float,2>{0.4134368f, 0.48343733f},
-std::array<float,2>{0.633200407f, 0.676456928f},
-std::array<float,2>{0.169153303f, 0.971090019f},
-std::array<float,2>{0.949864149f, 0.185224578f},
-std::array<float,2>{0.0450548232f, 0.0437093712f},
-std::array<float,2>{0.859889328f, 0.764643073f},
-std::array<float,2>{0.288740247f, 0.607878566f},
-std::array<float,2>{0.611469984f, 0.308050215f},
-std::array<float,2>{0.219795644f, 0.403483212f},
-std::array<float,2>{0.918108284f, 0.701012373f},
-std::array<float,2>{0.480501652f, 0.92743963f},
-std::array<float,2>{0.700666308f, 0.22816956f},
-std::array<float,2>{0.33208254f, 0.076426357f},
-std::array<float,2>{0.545365095f, 0.834421277f},
-std::array<float,2>{0.0695994496f, 0.551526248f},
-std::array<float,2>{0.799257874f, 0.319305032f},
-std::array<float,2>{0.391533703f, 0.298577547f},
-std::array<float,2>{0.675234556f, 0.598969281f},
-std::array<float,2>{0.136393398f, 0.752699137f},
-std::array<float,2>{0.974386275f, 0.0382889956f},
-std::array<float,2>{0.0292764977f, 0.179009348f},
-std::array<float,2>{0.82422775f, 0.98140204f},
-std::array<float,2>{0.276813209f, 0.685740054f},
-std::array<float,2>{0.564617276f, 0.473940462f},
-std::array<float,2>{0.0990855843f, 0.347011328f},
-std::array<float,2>{0.753485918f, 0.521209538f},
-std::array<float,2>{0.367109329f, 0.855784535f},
-std::array<float,2>{0.50545454f, 0.111613289f},
-std::array<float,2>{0.450976491f, 0.205812722f},
-std::array<float,2>{0.740419269f, 0.90152806f},
-std::array<float,2>{0.206026584f, 0.724326968f},
-std::array<float,2>{0.882976651f, 0.416641772f},
-std::array<float,2>{0.294892073f, 0.438628674f},
-std::array<float,2>{0.618181825f, 0.631567299f},
-std::array<float,2>{0.0356122442f, 0.938006938f},
-std::array<float,2>{0.871380687f, 0.145425841f},
-std::array<float,2>{0.16202417f, 0.00832632836f},
-std::array<float,2>{0.943924844f, 0.79044342f},
-std::array<float,2>{0.415304631f, 0.590966582f},
-std::array<float,2>{0.625023186f, 0.280839294f},
-std::array<float,2>{0.0486151353f, 0.496190548f},
-std::array<float,2>{0.844857454f, 0.659473836f},
-std::array<float,2>{0.301430732f, 0.991364062f},
-std::array<float,2>{0.597537994f, 0.161682382f},
-std::array<float,2>{0.432275653f, 0.0593064986f},
-std::array<float,2>{0.651362956f, 0.774432003f},
-std::array<float,2>{0.177246884f, 0.610071719f},
-std::array<float,2>{0.958668888f, 0.281902343f},
-std::array<float,2>{0.350395739f, 0.331670731f},
-std::array<float,2>{0.519005656f, 0.546183169f},
-std::array<float,2>{0.116158716f, 0.817727208f},
-std::array<float,2>{0.77509445f, 0.0917395279f},
-std::array<float,2>{0.202411368f, 0.238291427f},
-std::array<float,2>{0.891562462f, 0.90692395f},
-std::array<float,2>{0.456289768f, 0.711229384f},
-std::array<float,2>{0.728793204f, 0.376651019f},
-std::array<float,2>{0.154560611f, 0.260157883f},
-std::array<float,2>{0.988274455f, 0.575180411f},
-std::array<float,2>{0.384656817f, 0.798008621f},
-std::array<float,2>{0.662163317f, 0.0191695113f},
-std::array<float,2>{0.260029703f, 0.126935929f},
-std::array<float,2>{0.593691587f, 0.955454826f},
-std::array<float,2>{0.00104612077f, 0.656072021f},
-std::array<float,2>{0.83105725f, 0.461160958f},
-std::array<float,2>{0.49966529f, 0.434677422f},
-std::array<float,2>{0.714654386f, 0.737740099f},
-std::array<float,2>{0.238768622f, 0.877850175f},
-std::array<float,2>{0.926824749f, 0.199458271f},
-std::array<float,2>{0.086170584f, 0.10165178f},
-std::array<float,2>{0.794395685f, 0.866880953f},
-std::array<float,2>{0.313737392f, 0.508387506f},
-std::array<float,2>{0.561709225f, 0.371353984f},
-std::array<float,2>{0.222392827f, 0.473732412f},
-std::array<float,2>{0.920534313f, 0.686013162f},
-std::array<float,2>{0.482913613f, 0.98114872f},
-std::array<float,2>{0.702079892f, 0.178758889f},
-std::array<float,2>{0.335386753f, 0.03854312f},
-std::array<float,2>{0.543337703f, 0.752631187f},
-std::array<float,2>{0.0677805543f, 0.598869443f},
-std::array<float,2>{0.798043609f, 0.298675686f},
-std::array<float,2>{0.393072933f, 0.318961173f},
-std::array<float,2>{0.672421634f, 0.551303625f},
-std::array<float,2>{0.133510336f, 0.834210336f},
-std::array<float,2>{0.975558817f, 0.0763145015f},
-std::array<float,2>{0.0307102054f, 0.228361338f},
-std::array<float,2>{0.827847719f, 0.927681744f},
-std::array<float,2>{0.2744008f, 0.700893521f},
-std::array<float,2>{0.56320703f, 0.403796464f},
-std::array<float,2>{0.101554252f, 0.281077206f},
-std::array<float,2>{0.75147438f, 0.591076553f},
-std::array<float,2>{0.364103347f, 0.790224969f},
-std::array<float,2>{0.507251203f, 0.00868979562f},
-std::array<float,2>{0.451384276f, 0.145135373f},
-std::array<float,2>{0.738701403f, 0.93824774f},
-std::array<float,2>{0.204328373f, 0.631684363f},
-std::array<float,2>{0.886710107f, 0.438915431f},
-std::array<float,2>{0.295728981f, 0.416804194f},
-std::array<float,2>{0.620575368f, 0.7243855f},
-std::array<float,2>{0.0389396362f, 0.901695669f},
-std::array<float,2>{0.873209f, 0.205623686f},
-std::array<float,2>{0.163184166f, 0.111558639f},
-std::array<float,2>{0.942251861f, 0.85565412f},
-std::array<float,2>{0.416055441f, 0.521291971f},
-std::array<float,2>{0.628175497f, 0.346907437f},
-std::array<float,2>{0.0498247035f, 0.376736552f},
-std::array<float,2>{0.846144259f, 0.711020529f},
-std::array<float,2>{0.303589642f, 0.907204032f},
-std::array<float,2>{0.595303059f, 0.238728613f},
-std::array<float,2>{0.431143254f, 0.0914614797f},
-std::array<float,2>{0.650356293f, 0.817461431f},
-std::array<float,2>{0.178341851f, 0.54600513f},
-std::array<float,2>{0.960078418f, 0.33182013f},
-std::array<float,2>{0.347737521f, 0.282136947f},
-std::array<float,2>{0.515896261f, 0.610147297f},
-std::array<float,2>{0.115060367f, 0.774888694f},
-std::array<float,2>{0.777257442f, 0.0594342649f},
-std::array<float,2>{0.200400874f, 0.162052527f},
-std::array<float,2>{0.89303714f, 0.991571963f},
-std::array<float,2>{0.454336941f, 0.659266293f},
-std::array<float,2>{0.726793826f, 0.496530443f},
-std::array<float,2>{0.153300554f, 0.371134251f},
-std::array<float,2>{0.984670162f, 0.508698881f},
-std::array<float,2>{0.385945976f, 0.867060542f},
-std::array<float,2>{0.661793649f, 0.101912059f},
-std::array<float,2>{0.259202123f, 0.199548811f},
-std::array<float,2>{0.59117496f, 0.877675414f},
-std::array<float,2>{0.00283923512f, 0.737348318f},
-std::array<float,2>{0.828336179f, 0.435037732f},
-std::array<float,2>{0.497063339f, 0.461337775f},
-std::array<float,2>{0.711809754f, 0.655985773f},
-std::array<float,2>{0.240922078f, 0.955271304f},
-std::array<float,2>{0.928100169f, 0.126513213f},
-std::array<float,2>{0.0888911262f, 0.019455865f},
-std::array<float,2>{0.795878291f, 0.798171997f},
-std::array<float,2>{0.314624995f, 0.57477361f},
-std::array<float,2>{0.56033957f, 0.259908259f},
-std::array<float,2>{0.185148224f, 0.426905572f},
-std::array<float,2>{0.96366632f, 0.744022131f},
-std::array<float,2>{0.422687143f, 0.889864206f},
-std::array<float,2>{0.64360106f, 0.194869757f},
-std::array<float,2>{0.311600834f, 0.0944084674f},
-std::array<float,2>{0.605794787f, 0.868991792f},
-std::array<float,2>{0.0568455458f, 0.507499218f},
-std::array<float,2>{0.8546471f, 0.364191681f},
-std::array<float,2>{0.466723561f, 0.253354341f},
-std::array<float,2>{0.726460278f, 0.565954208f},
-std::array<float,2>{0.19251202f, 0.804864585f},
-std::array<float,2>{0.905562818f, 0.0287940092f},
-std::array<float,2>{0.121331125f, 0.140013143f},
-std::array<float,2>{0.767702281f, 0.96743083f},
-std::array<float,2>{0.357915103f, 0.648237705f},
-std::array<float,2>{0.528336406f, 0.459673315f},
-std::array<float,2>{0.00944443792f, 0.339105964f},
-std::array<float,2>{0.838741362f, 0.537550271f},
-std::array<float,2>{0.252423257f, 0.82418561f},
-std::array<float,2>{0.582808077f, 0.0812863633f},
-std::array<float,2>{0.378130049f, 0.246925682f},
-std::array<float,2>{0.667602897f, 0.921370327f},
-std::array<float,2>{0.143271044f, 0.707683086f},
-std::array<float,2>{0.99220866f, 0.386363208f},
-std::array<float,2>{0.326564133f, 0.486910582f},
-std::array<float,2>{0.554245532f, 0.666723728f},
-std::array<float,2>{0.0827685818f, 0.994773626f},
-std::array<float,2>{0.784687042f, 0.168525741f},
-std::array<float,2>{0.246858239f, 0.0533888377f},
-std::array<float,2>{0.934304237f, 0.768033922f},
-std::array<float,2>{0.488136381f, 0.623651147f},
-std::array<float,2>{0.706878722f, 0.291604102f},
-std::array<float,2>{0.0757776573f, 0.446472615f},
-std::array<float,2>{0.806516171f, 0.637589753f},
-std::array<float,2>{0.338317364f, 0.951721668f},
-std::array<float,2>{0.5332039f, 0.155430853f},
-std::array<float,2>{0.474599808f, 0.00252960506f},
-std::array<float,2>{0.688383341f, 0.787829518f},
-std::array<float,2>{0.232297555f, 0.581953883f},
-std::array<float,2>{0.911444902f, 0.270223677f},
-std::array<float,2>{0.268930227f, 0.358774304f},
-std::array<float,2>{0.574393272f, 0.524373472f},
-std::array<float,2>{0.0211269706f, 0.848015189f},
-std::array<float,2>{0.816400528f, 0.120483987f},
-std::array<float,2>{0.128821462f, 0.21791631f},
-std::array<float,2>{0.982844532f, 0.89534837f},
-std::array<float,2>{0.40084371f, 0.7312814f},
-std::array<float,2>{0.685692012f, 0.407119811f},
-std::array<float,2>{0.216840625f, 0.307746947f},
-std::array<float,2>{0.882410288f, 0.607570052f},
-std::array<float,2>{0.441216439f, 0.764359415f},
-std::array<float,2>{0.74468863f, 0.0436158516f},
-std::array<float,2>{0.371027201f, 0.185450494f},
-std::array<float,2>{0.513648033f, 0.970717728f},
-std::array<float,2>{0.102194771f, 0.676539838f},
-std::array<float,2>{0.763268471f, 0.483754575f},
-std::array<float,2>{0.41147536f, 0.393127292f},
-std::array<float,2>{0.636635959f, 0.692903399f},
-std::array<float,2>{0.170730367f, 0.933750987f},
-std::array<float,2>{0.952485561f, 0.221530586f},
-std::array<float,2>{0.0432580709f, 0.0654858798f},
-std::array<float,2>{0.863098919f, 0.83891499f},
-std::array<float,2>{0.287043512f, 0.558870852f},
-std::array<float,2>{0.611075163f, 0.323531806f},
-std::array<float,2>{0.140144423f, 0.453217804f},
-std::array<float,2>{0.971669853f, 0.641748071f},
-std::array<float,2>{0.398022503f, 0.961588979f},
-std::array<float,2>{0.679071546f, 0.134345055f},
-std::array<float,2>{0.280396909f, 0.0259466395f},
-std::array<float,2>{0.566901386f, 0.809624314f},
-std::array<float,2>{0.0235620122f, 0.569212675f},
-std::array<float,2>{0.822009206f, 0.255858988f},
-std::array<float,2>{0.477912813f, 0.362916052f},
-std::array<float,2>{0.696559489f, 0.501802623f},
-std::array<float,2>{0.224084258f, 0.871161222f},
-std::array<float,2>{0.915699065f, 0.100988157f},
-std::array<float,2>{0.0655993968f, 0.19048354f},
-std::array<float,2>{0.803033233f, 0.884658694f},
-std::array<float,2>{0.330287188f, 0.74786675f},
-std::array<float,2>{0.541471899f, 0.425367504f},
-std::array<float,2>{0.0321515128f, 0.293091238f},
-std::array<float,2>{0.868415594f, 0.618151069f},
-std::array<float,2>{0.291721851f, 0.771228611f},
-std::array<float,2>{0.622675657f, 0.0472735912f},
-std::array<float,2>{0.419674277f, 0.167918503f},
-std::array<float,2>{0.630683362f, 0.999749124f},
-std::array<float,2>{0.158367634f, 0.66935724f},
-std::array<float,2>{0.938129485f, 0.492181093f},
-std::array<float,2>{0.362585098f, 0.387116939f},
-std::array<float,2>{0.502391696f, 0.70683825f},
-std::array<float,2>{0.0967195258f, 0.917635679f},
-std::array<float,2>{0.755648017f, 0.243287593f},
-std::array<float,2>{0.207379133f, 0.083451964f},
-std::array<float,2>{0.890019417f, 0.828028202f},
-std::array<float,2>{0.445548743f, 0.532466352f},
-std::array<float,2>{0.734582007f, 0.342872113f},
-std::array<float,2>{0.111266993f, 0.413114607f},
-std::array<float,2>{0.77987808f, 0.72668618f},
-std::array<float,2>{0.344488084f, 0.891154051f},
-std::array<float,2>{0.520155191f, 0.21156022f},
-std::array<float,2>{0.458305299f, 0.12413726f},
-std::array<float,2>{0.731347024f, 0.84456259f},
-std::array<float,2>{0.198704168f, 0.529334664f},
-std::array<float,2>{0.897384644f, 0.354620725f},
-std::array<float,2>{0.297462434f, 0.268005282f},
-std::array<float,2>{0.598470628f, 0.585626423f},
-std::array<float,2>{0.0526484028f, 0.782693923f},
-std::array<float,2>{0.848289311f, 0.0044048056f},
-std::array<float,2>{0.172272921f, 0.150628313f},
-std::array<float,2>{0.956827641f, 0.947380841f},
-std::array<float,2>{0.433815271f, 0.635111451f},
-std::array<float,2>{0.652602315f, 0.450214386f},
-std::array<float,2>{0.235116035f, 0.32794106f},
-std::array<float,2>{0.925684273f, 0.556456745f},
-std::array<float,2>{0.495758235f, 0.841899097f},
-std::array<float,2>{0.717841029f, 0.0671190619f},
-std::array<float,2>{0.319226384f, 0.225116581f},
-std::array<float,2>{0.554759681f, 0.931954086f},
-std::array<float,2>{0.0931298286f, 0.690097451f},
-std::array<float,2>{0.790462911f, 0.395659506f},
-std::array<float,2>{0.389644414f, 0.477394104f},
-std::array<float,2>{0.659921885f, 0.674215078f},
-std::array<float,2>{0.152224645f, 0.973969519f},
-std::array<float,2>{0.989158511f, 0.182573661f},
-std::array<float,2>{0.00465342589f, 0.0416743085f},
-std::array<float,2>{0.832917452f, 0.761260748f},
-std::array<float,2>{0.262524813f, 0.603591025f},
-std::array<float,2>{0.589761794f, 0.311443478f},
-std::array<float,2>{0.189195693f, 0.399528056f},
-std::array<float,2>{0.898970366f, 0.697817206f},
-std::array<float,2>{0.462436706f, 0.923157036f},
-std::array<float,2>{0.721032143f, 0.233303159f},
-std::array<float,2>{0.353067517f, 0.0703245327f},
-std::array<float,2>{0.524229586f, 0.831926823f},
-std::array<float,2>{0.120983109f, 0.548187554f},
-std::array<float,2>{0.770274401f, 0.316368908f},
-std::array<float,2>{0.426355213f, 0.301501364f},
-std::array<float,2>{0.647766709f, 0.595851183f},
-std::array<float,2>{0.182861418f, 0.756740034f},
-std::array<float,2>{0.966412246f, 0.0345657133f},
-std::array<float,2>{0.0624391921f, 0.175180241f},
-std::array<float,2>{0.85661155f, 0.978010237f},
-std::array<float,2>{0.305913746f, 0.680377245f},
-std::array<float,2>{0.60314405f, 0.469561189f},
-std::array<float,2>{0.0808866844f, 0.349251032f},
-std::array<float,2>{0.788344204f, 0.51909703f},
-std::array<float,2>{0.323399216f, 0.852831483f},
-std::array<float,2>{0.549671233f, 0.115777746f},
-std::array<float,2>{0.491118848f, 0.208513319f},
-std::array<float,2>{0.710592091f, 0.903892875f},
-std::array<float,2>{0.242219478f, 0.7205742f},
-std::array<float,2>{0.931526601f, 0.421862721f},
-std::array<float,2>{0.256438136f, 0.441975832f},
-std::array<float,2>{0.582018495f, 0.628811657f},
-std::array<float,2>{0.0122132208f, 0.942282379f},
-std::array<float,2>{0.842310846f, 0.140806004f},
-std::array<float,2>{0.145179197f, 0.0137645565f},
-std::array<float,2>{0.996646285f, 0.793801427f},
-std::array<float,2>{0.380453616f, 0.588891387f},
-std::array<float,2>{0.669614136f, 0.275208056f},
-std::array<float,2>{0.0167878158f, 0.493226022f},
-std::array<float,2>{0.819197357f, 0.663079679f},
-std::array<float,2>{0.272675484f, 0.986691117f},
-std::array<float,2>{0.572412372f, 0.157479659f},
-std::array<float,2>{0.404052198f, 0.0549852066f},
-std::array<float,2>{0.680540383f, 0.779967189f},
-std::array<float,2>{0.129650414f, 0.615980983f},
-std::array<float,2>{0.977377415f, 0.287847936f},
-std::array<float,2>{0.343383968f, 0.333673328f},
-std::array<float,2>{0.538377047f, 0.542918921f},
-std::array<float,2>{0.071958825f, 0.815856874f},
-std::array<float,2>{0.810949504f, 0.0865737051f},
-std::array<float,2>{0.229632512f, 0.237225845f},
-std::array<float,2>{0.909925878f, 0.912269235f},
-std::array<float,2>{0.470228493f, 0.714942992f},
-std::array<float,2>{0.692630589f, 0.380774349f},
-std::array<float,2>{0.165058061f, 0.262129754f},
-std::array<float,2>{0.946550429f, 0.570436597f},
-std::array<float,2>{0.408073217f, 0.802949727f},
-std::array<float,2>{0.640591204f, 0.0232885387f},
-std::array<float,2>{0.282123536f, 0.129865482f},
-std::array<float,2>{0.616089582f, 0.958903193f},
-std::array<float,2>{0.0425161757f, 0.650969446f},
-std::array<float,2>{0.863512099f, 0.46494329f},
-std::array<float,2>{0.441747904f, 0.430717766f},
-std::array<float,2>{0.748709559f, 0.739692628f},
-std::array<float,2>{0.212829009f, 0.881452978f},
-std::array<float,2>{0.87686938f, 0.19708778f},
-std::array<float,2>{0.108215168f, 0.108020417f},
-std::array<float,2>{0.758467376f, 0.862633169f},
-std::array<float,2>{0.373493791f, 0.512056708f},
-std::array<float,2>{0.508841157f, 0.369703233f},
-std::array<float,2>{0.206629097f, 0.440599561f},
-std::array<float,2>{0.884264827f, 0.630362511f},
-std::array<float,2>{0.450133353f, 0.939833224f},
-std::array<float,2>{0.741286337f, 0.147757217f},
-std::array<float,2>{0.365257919f, 0.0114039499f},
-std::array<float,2>{0.504719973f, 0.791910112f},
-std::array<float,2>{0.0979019031f, 0.592276037f},
-std::array<float,2>{0.752854645f, 0.278855979f},
-std::array<float,2>{0.414719701f, 0.344621867f},
-std::array<float,2>{0.626038849f, 0.522233725f},
-std::array<float,2>{0.160683289f, 0.85901463f},
-std::array<float,2>{0.944401145f, 0.110507205f},
-std::array<float,2>{0.0369590893f, 0.204430774f},
-std::array<float,2>{0.872089922f, 0.898586571f},
-std::array<float,2>{0.293616623f, 0.72493726f},
-std::array<float,2>{0.617219269f, 0.414746583f},
-std::array<float,2>{0.0689982623f, 0.300085008f},
-std::array<float,2>{0.800024509f, 0.59967345f},
-std::array<float,2>{0.333806127f, 0.751573622f},
-std::array<float,2>{0.546527743f, 0.0362442508f},
-std::array<float,2>{0.481895864f, 0.177133963f},
-std::array<float,2>{0.699834228f, 0.983357191f},
-std::array<float,2>{0.218998507f, 0.685003936f},
-std::array<float,2>{0.919735551f, 0.476040274f},
-std::array<float,2>{0.276128054f, 0.406168222f},
-std::array<float,2>{0.56588769f, 0.702796757f},
-std::array<float,2>{0.0282556135f, 0.929343998f},
-std::array<float,2>{0.825691104f, 0.228545964f},
-std::array<float,2>{0.134779781f, 0.0750284418f},
-std::array<float,2>{0.973101199f, 0.832118988f},
-std::array<float,2>{0.39244464f, 0.554519057f},
-std::array<float,2>{0.674467266f, 0.316473573f},
-std::array<float,2>{0.00026025105f, 0.43748951f},
-std::array<float,2>{0.830558598f, 0.734936535f},
-std::array<float,2>{0.260884345f, 0.876013875f},
-std::array<float,2>{0.592346907f, 0.201202109f},
-std::array<float,2>{0.38292408f, 0.105001859f},
-std::array<float,2>{0.663876057f, 0.864333451f},
-std::array<float,2>{0.15599446f, 0.511565924f},
-std::array<float,2>{0.987080336f, 0.373691529f},
-std::array<float,2>{0.313156754f, 0.259654194f},
-std::array<float,2>{0.560646236f, 0.576230168f},
-std::array<float,2>{0.0870177224f, 0.799977124f},
-std::array<float,2>{0.79336679f, 0.0173409544f},
-std::array<float,2>{0.239504099f, 0.128043383f},
-std::array<float,2>{0.925812006f, 0.953203738f},
-std::array<float,2>{0.498266935f, 0.652896881f},
-std::array<float,2>{0.713627636f, 0.464381486f},
-std::array<float,2>{0.176575795f, 0.329035729f},
-std::array<float,2>{0.957953691f, 0.543182254f},
-std::array<float,2>{0.433061332f, 0.820211828f},
-std::array<float,2>{0.651946664f, 0.0934656635f},
-std::array<float,2>{0.30216825f, 0.242160767f},
-std::array<float,2>{0.596365392f, 0.908783615f},
-std::array<float,2>{0.0469947308f, 0.713157535f},
-std::array<float,2>{0.844656348f, 0.37856108f},
-std::array<float,2>{0.455299169f, 0.499338418f},
-std::array<float,2>{0.729804635f, 0.656370938f},
-std::array<float,2>{0.201176852f, 0.989216566f},
-std::array<float,2>{0.891981423f, 0.163434416f},
-std::array<float,2>{0.116511397f, 0.0623664781f},
-std::array<float,2>{0.773708522f, 0.77727443f},
-std::array<float,2>{0.351473242f, 0.612837315f},
-std::array<float,2>{0.51803565f, 0.284497321f},
-std::array<float,2>{0.141003892f, 0.383296579f},
-std::array<float,2>{0.994789004f, 0.709698141f},
-std::array<float,2>{0.375095189f, 0.918463469f},
-std::array<float,2>{0.665733933f, 0.248976737f},
-std::array<float,2>{0.250273019f, 0.078225024f},
-std::array<float,2>{0.585128546f, 0.820424318f},
-std::array<float,2>{0.0100112958f, 0.535534143f},
-std::array<float,2>{0.836581528f, 0.337219983f},
-std::array<float,2>{0.485409737f, 0.289197326f},
-std::array<float,2>{0.704715133f, 0.621570349f},
-std::array<float,2>{0.249504983f, 0.767466247f},
-std::array<float,2>{0.936244249f, 0.0523953661f},
-std::array<float,2>{0.0850845054f, 0.170263201f},
-std::array<float,2>{0.782556236f, 0.992896736f},
-std::array<float,2>{0.32608211f, 0.664702177f},
-std::array<float,2>{0.55254364f, 0.485856414f},
-std::array<float,2>{0.056385763f, 0.36714071f},
-std::array<float,2>{0.852215886f, 0.504042506f},
-std::array<float,2>{0.310098797f, 0.870534658f},
-std::array<float,2>{0.608054876f, 0.0967093855f},
-std::array<float,2>{0.425432682f, 0.191861913f},
-std::array<float,2>{0.642381012f, 0.888114393f},
-std::array<float,2>{0.187277198f, 0.745365858f},
-std::array<float,2>{0.96164465f, 0.42903322f},
-std::array<float,2>{0.357314944f, 0.458857656f},
-std::array<float,2>{0.530201912f, 0.645924985f},
-std::array<float,2>{0.123600662f, 0.964986682f},
-std::array<float,2>{0.766873956f, 0.138247922f},
-std::array<float,2>{0.194404095f, 0.0293545611f},
-std::array<float,2>{0.903304815f, 0.806970298f},
-std::array<float,2>{0.468686849f, 0.563057303f},
-std::array<float,2>{0.723301768f, 0.250151545f},
-std::array<float,2>{0.104106225f, 0.480986506f},
-std::array<float,2>{0.764832854f, 0.678620517f},
-std::array<float,2>{0.368397564f, 0.969739318f},
-std::array<float,2>{0.514821529f, 0.185863197f},
-std::array<float,2>{0.438068658f, 0.0451235473f},
-std::array<float,2>{0.743463099f, 0.761881053f},
-std::array<float,2>{0.214932799f, 0.606890678f},
-std::array<float,2>{0.880788445f, 0.304979801f},
-std::array<float,2>{0.28808248f, 0.321264595f},
-std::array<float,2>{0.612794876f, 0.560765862f},
-std::array<float,2>{0.0459169336f, 0.836973965f},
-std::array<float,2>{0.860445797f, 0.0636297315f},
-std::array<float,2>{0.168121621f, 0.220042676f},
-std::array<float,2>{0.950781107f, 0.936963201f},
-std::array<float,2>{0.413029015f, 0.694556832f},
-std::array<float,2>{0.634293139f, 0.391031832f},
-std::array<float,2>{0.232711285f, 0.271747231f},
-std::array<float,2>{0.913809001f, 0.578347266f},
-std::array<float,2>{0.476047814f, 0.786735773f},
-std::array<float,2>{0.689646482f, 0.000899088976f},
-std::array<float,2>{0.337720364f, 0.153023019f},
-std::array<float,2>{0.532728195f, 0.950087011f},
-std::array<float,2>{0.0762369409f, 0.639526308f},
-std::array<float,2>{0.806840837f, 0.449025542f},
-std::array<float,2>{0.398472697f, 0.409907103f},
-std::array<float,2>{0.685534954f, 0.732537091f},
-std::array<float,2>{0.125705913f, 0.897627354f},
-std::array<float,2>{0.981471658f, 0.214910492f},
-std::array<float,2>{0.0227058604f, 0.118438825f},
-std::array<float,2>{0.813566327f, 0.849967062f},
-std::array<float,2>{0.267334342f, 0.526660204f},
-std::array<float,2>{0.576322258f, 0.355910301f},
-std::array<float,2>{0.157188773f, 0.489466369f},
-std::array<float,2>{0.940057456f, 0.670831561f},
-std::array<float,2>{0.421306998f, 0.996842265f},
-std::array<float,2>{0.631174028f, 0.164740056f},
-std::array<float,2>{0.289606392f, 0.0488553308f},
-std::array<float,2>{0.623136222f, 0.772678018f},
-std::array<float,2>{0.0350523107f, 0.620503783f},
-std::array<float,2>{0.870561481f, 0.295182467f},
-std::array<float,2>{0.448584527f, 0.340394944f},
-std::array<float,2>{0.736773312f, 0.533914208f},
-std::array<float,2>{0.20938094f, 0.825497508f},
-std::array<float,2>{0.8873353f, 0.0858191401f},
-std::array<float,2>{0.0953022614f, 0.244443864f},
-std::array<float,2>{0.756335139f, 0.916014493f},
-std::array<float,2>{0.360655308f, 0.70374918f},
-std::array<float,2>{0.501663148f, 0.390482217f},
-std::array<float,2>{0.0268904865f, 0.256948501f},
-std::array<float,2>{0.823494911f, 0.567991376f},
-std::array<float,2>{0.277548492f, 0.812430263f},
-std::array<float,2>{0.570087969f, 0.0253058989f},
-std::array<float,2>{0.395118833f, 0.136279419f},
-std::array<float,2>{0.676592171f, 0.962891459f},
-std::array<float,2>{0.137187794f, 0.642721832f},
-std::array<float,2>{0.969619334f, 0.456534415f},
-std::array<float,2>{0.328570008f, 0.42276299f},
-std::array<float,2>{0.540002406f, 0.749812961f},
-std::array<float,2>{0.0632958785f, 0.884988606f},
-std::array<float,2>{0.801806033f, 0.189105988f},
-std::array<float,2>{0.22615771f, 0.0980560333f},
-std::array<float,2>{0.917910516f, 0.873531759f},
-std::array<float,2>{0.48013562f, 0.502719522f},
-std::array<float,2>{0.698427141f, 0.360402375f},
-std::array<float,2>{0.0902618617f, 0.397829831f},
-std::array<float,2>{0.791376173f, 0.688398421f},
-std::array<float,2>{0.317666918f, 0.930486679f},
-std::array<float,2>{0.558330238f, 0.224452555f},
-std::array<float,2>{0.493866265f, 0.0701254457f},
-std::array<float,2>{0.716780066f, 0.841675818f},
-std::array<float,2>{0.237936839f, 0.558472633f},
-std::array<float,2>{0.922835588f, 0.324461758f},
-std::array<float,2>{0.264467388f, 0.30998382f},
-std::array<float,2>{0.586675048f, 0.603324294f},
-std::array<float,2>{0.0064241197f, 0.759332478f},
-std::array<float,2>{0.834177256f, 0.0403084233f},
-std::array<float,2>{0.149479657f, 0.180787727f},
-std::array<float,2>{0.99160403f, 0.974844813f},
-std::array<float,2>{0.38867119f, 0.673482418f},
-std::array<float,2>{0.657171547f, 0.479194432f},
-std::array<float,2>{0.196234599f, 0.3516846f},
-std::array<float,2>{0.89535445f, 0.52825439f},
-std::array<float,2>{0.45935896f, 0.845798671f},
-std::array<float,2>{0.733561575f, 0.122744314f},
-std::array<float,2>{0.347194195f, 0.214357212f},
-std::array<float,2>{0.521484911f, 0.892948687f},
-std::array<float,2>{0.11320027f, 0.729491353f},
-std::array<float,2>{0.777387142f, 0.410569757f},
-std::array<float,2>{0.436763257f, 0.451191872f},
-std::array<float,2>{0.655447543f, 0.633058608f},
-std::array<float,2>{0.17435576f, 0.946377277f},
-std::array<float,2>{0.95402211f, 0.149825305f},
-std::array<float,2>{0.0537628718f, 0.00772743579f},
-std::array<float,2>{0.85119468f, 0.784869313f},
-std::array<float,2>{0.300529629f, 0.582175076f},
-std::array<float,2>{0.6009866f, 0.265839368f},
-std::array<float,2>{0.245588303f, 0.419473916f},
-std::array<float,2>{0.931842923f, 0.721359253f},
-std::array<float,2>{0.488490283f, 0.906114519f},
-std::array<float,2>{0.708072722f, 0.209795058f},
-std::array<float,2>{0.321883023f, 0.114445329f},
-std::array<float,2>{0.54839772f, 0.854844153f},
-std::array<float,2>{0.0790354833f, 0.516211092f},
-std::array<float,2>{0.785633922f, 0.350643367f},
-std::array<float,2>{0.381056517f, 0.276085675f},
-std::array<float,2>{0.670686722f, 0.586344123f},
-std::array<float,2>{0.146563962f, 0.796012163f},
-std::array<float,2>{0.998891056f, 0.0128208157f},
-std::array<float,2>{0.0148477592f, 0.1434104f},
-std::array<float,2>{0.841426671f, 0.944074929f},
-std::array<float,2>{0.254579782f, 0.625153959f},
-std::array<float,2>{0.579678118f, 0.444983453f},
-std::array<float,2>{0.118730865f, 0.313006222f},
-std::array<float,2>{0.772856474f, 0.55049479f},
-std::array<float,2>{0.354709625f, 0.829742134f},
-std::array<float,2>{0.525868714f, 0.0731442943f},
-std::array<float,2>{0.462984413f, 0.230608508f},
-std::array<float,2>{0.719271719f, 0.924453855f},
-std::array<float,2>{0.189602867f, 0.697192669f},
-std::array<float,2>{0.902343452f, 0.402177513f},
-std::array<float,2>{0.308116257f, 0.472028881f},
-std::array<float,2>{0.604667485f, 0.683220208f},
-std::array<float,2>{0.0600460768f, 0.980108917f},
-std::array<float,2>{0.859028637f, 0.172070488f},
-std::array<float,2>{0.181448996f, 0.0313411728f},
-std::array<float,2>{0.968628943f, 0.754632056f},
-std::array<float,2>{0.428016424f, 0.595250607f},
-std::array<float,2>{0.644628584f, 0.304290861f},
-std::array<float,2>{0.0395436436f, 0.467202097f},
-std::array<float,2>{0.865658104f, 0.650296569f},
-std::array<float,2>{0.284466714f, 0.959801316f},
-std::array<float,2>{0.614879966f, 0.132231325f},
-std::array<float,2>{0.408771008f, 0.0213400368f},
-std::array<float,2>{0.638152957f, 0.801580846f},
-std::array<float,2>{0.166522458f, 0.573441684f},
-std::array<float,2>{0.948705852f, 0.265092522f},
-std::array<float,2>{0.373044103f, 0.368678421f},
-std::array<float,2>{0.509876847f, 0.515216768f},
-std::array<float,2>{0.105954342f, 0.860083401f},
-std::array<float,2>{0.761144161f, 0.106938206f},
-std::array<float,2>{0.213057533f, 0.198661134f},
-std::array<float,2>{0.878132284f, 0.880493701f},
-std::array<float,2>{0.44488284f, 0.742113352f},
-std::array<float,2>{0.746724248f, 0.431665361f},
-std::array<float,2>{0.132514596f, 0.286689758f},
-std::array<float,2>{0.980313718f, 0.613805115f},
-std::array<float,2>{0.406039447f, 0.778695881f},
-std::array<float,2>{0.682719946f, 0.0577628016f},
-std::array<float,2>{0.269697875f, 0.158457786f},
-std::array<float,2>{0.571080089f, 0.985970497f},
-std::array<float,2>{0.0189456567f, 0.660777867f},
-std::array<float,2>{0.816591978f, 0.494972289f},
-std::array<float,2>{0.471859455f, 0.381642073f},
-std::array<float,2>{0.694649756f, 0.717518508f},
-std::array<float,2>{0.227132201f, 0.910960317f},
-std::array<float,2>{0.906839907f, 0.235369802f},
-std::array<float,2>{0.0734158009f, 0.0896264464f},
-std::array<float,2>{0.809156537f, 0.814370275f},
-std::array<float,2>{0.341679335f, 0.540673018f},
-std::array<float,2>{0.536692083f, 0.334544182f},
-std::array<float,2>{0.241232738f, 0.46294108f},
-std::array<float,2>{0.928973973f, 0.654057145f},
-std::array<float,2>{0.497466147f, 0.954497516f},
-std::array<float,2>{0.712122738f, 0.127359852f},
-std::array<float,2>{0.316171825f, 0.0156383887f},
-std::array<float,2>{0.558727801f, 0.799072623f},
-std::array<float,2>{0.088167496f, 0.578073382f},
-std::array<float,2>{0.795939207f, 0.258089066f},
-std::array<float,2>{0.385014743f, 0.374756038f},
-std::array<float,2>{0.660482347f, 0.510726511f},
-std::array<float,2>{0.153602809f, 0.864209652f},
-std::array<float,2>{0.986210644f, 0.104294047f},
-std::array<float,2>{0.00388560002f, 0.202203989f},
-std::array<float,2>{0.829607725f, 0.875482202f},
-std::array<float,2>{0.25822401f, 0.735365093f},
-std::array<float,2>{0.590759456f, 0.435967803f},
-std::array<float,2>{0.113526545f, 0.283531368f},
-std::array<float,2>{0.775690079f, 0.611890078f},
-std::array<float,2>{0.348719686f, 0.775468588f},
-std::array<float,2>{0.516881049f, 0.06133857f},
-std::array<float,2>{0.453867882f, 0.16289711f},
-std::array<float,2>{0.728406608f, 0.989753067f},
-std::array<float,2>{0.199527711f, 0.657744586f},
-std::array<float,2>{0.894487441f, 0.498992771f},
-std::array<float,2>{0.304128021f, 0.377247274f},
-std::array<float,2>{0.594527006f, 0.714146554f},
-std::array<float,2>{0.0496959537f, 0.909412801f},
-std::array<float,2>{0.846719205f, 0.240672722f},
-std::array<float,2>{0.179310098f, 0.0918804705f},
-std::array<float,2>{0.959582448f, 0.819005668f},
-std::array<float,2>{0.430625379f, 0.544494569f},
-std::array<float,2>{0.648777544f, 0.329961002f},
-std::array<float,2>{0.0372180976f, 0.415858388f},
-std::array<float,2>{0.874202549f, 0.725722075f},
-std::array<float,2>{0.296049446f, 0.90010792f},
-std::array<float,2>{0.619845986f, 0.203515455f},
-std::array<float,2>{0.417199373f, 0.109758347f},
-std::array<float,2>{0.62778759f, 0.857544124f},
-std::array<float,2>{0.162931755f, 0.522568166f},
-std::array<float,2>{0.942420006f, 0.344921201f},
-std::array<float,2>{0.364876449f, 0.277463913f},
-std::array<float,2>{0.505870283f, 0.59283489f},
-std::array<float,2>{0.0998629928f, 0.792866409f},
-std::array<float,2>{0.750306427f, 0.0100852801f},
-std::array<float,2>{0.203332096f, 0.146945089f},
-std::array<float,2>{0.885503411f, 0.940842986f},
-std::array<float,2>{0.452459544f, 0.629127026f},
-std::array<float,2>{0.740117311f, 0.43986389f},
-std::array<float,2>{0.134080768f, 0.318308711f},
-std::array<float,2>{0.976095259f, 0.552743077f},
-std::array<float,2>{0.393830746f, 0.833026111f},
-std::array<float,2>{0.673262775f, 0.0758231282f},
-std::array<float,2>{0.274421424f, 0.22950159f},
-std::array<float,2>{0.564057052f, 0.927889585f},
-std::array<float,2>{0.0297496077f, 0.701651216f},
-std::array<float,2>{0.826444924f, 0.404977262f},
-std::array<float,2>{0.484161109f, 0.475362867f},
-std::array<float,2>{0.702152193f, 0.684132099f},
-std::array<float,2>{0.220823854f, 0.983748913f},
-std::array<float,2>{0.921053708f, 0.17649132f},
-std::array<float,2>{0.0671023428f, 0.0359690301f},
-std::array<float,2>{0.797130466f, 0.750485837f},
-std::array<float,2>{0.33409676f, 0.601278186f},
-std::array<float,2>{0.544316173f, 0.299293935f},
-std::array<float,2>{0.171445489f, 0.392529428f},
-std::array<float,2>{0.952087998f, 0.693709552f},
-std::array<float,2>{0.410830796f, 0.93596369f},
-std::array<float,2>{0.63527751f, 0.219119266f},
-std::array<float,2>{0.285595208f, 0.0629466698f},
-std::array<float,2>{0.609512806f, 0.836771131f},
-std::array<float,2>{0.0447508283f, 0.561555862f},
-std::array<float,2>{0.8616696f, 0.321317494f},
-std::array<float,2>{0.439664632f, 0.306533247f},
-std::array<float,2>{0.745879591f, 0.606378973f},
-std::array<float,2>{0.217930213f, 0.762931406f},
-std::array<float,2>{0.881430745f, 0.0466769263f},
-std::array<float,2>{0.102700375f, 0.18729049f},
-std::array<float,2>{0.762107193f, 0.969034016f},
-std::array<float,2>{0.369950384f, 0.679267466f},
-std::array<float,2>{0.512150168f, 0.481653541f},
-std::array<float,2>{0.0201360136f, 0.356535792f},
-std::array<float,2>{0.814494252f, 0.525571764f},
-std::array<float,2>{0.267892033f, 0.851281226f},
-std::array<float,2>{0.575711668f, 0.11802952f},
-std::array<float,2>{0.401608646f, 0.216055259f},
-std::array<float,2>{0.686893225f, 0.89712745f},
-std::array<float,2>{0.127803907f, 0.734019816f},
-std::array<float,2>{0.983725548f, 0.408486605f},
-std::array<float,2>{0.339033008f, 0.44794485f},
-std::array<float,2>{0.534401059f, 0.640494406f},
-std::array<float,2>{0.0750029087f, 0.95103097f},
-std::array<float,2>{0.805359542f, 0.154125124f},
-std::array<float,2>{0.230723217f, 0.00124635454f},
-std::array<float,2>{0.910950303f, 0.785370529f},
-std::array<float,2>{0.473168045f, 0.579902172f},
-std::array<float,2>{0.688839436f, 0.273358822f},
-std::array<float,2>{0.0838519707f, 0.484442174f},
-std::array<float,2>{0.783643961f, 0.665406704f},
-std::array<float,2>{0.327896982f, 0.993874967f},
-std::array<float,2>{0.552922904f, 0.171366856f},
-std::array<float,2>{0.48703143f, 0.0512799099f},
-std::array<float,2>{0.705446243f, 0.766561687f},
-std::array<float,2>{0.247087285f, 0.62230593f},
-std::array<float,2>{0.934856355f, 0.290245205f},
-std::array<float,2>{0.253101259f, 0.336186051f},
-std::array<float,2>{0.583854854f, 0.536831677f},
-std::array<float,2>{0.00809133612f, 0.822102129f},
-std::array<float,2>{0.839251876f, 0.0793924779f},
-std::array<float,2>{0.143747374f, 0.249220684f},
-std::array<float,2>{0.993933976f, 0.919390798f},
-std::array<float,2>{0.37778604f, 0.710728407f},
-std::array<float,2>{0.666847229f, 0.384313673f},
-std::array<float,2>{0.192357168f, 0.251377612f},
-std::array<float,2>{0.904343128f, 0.563660026f},
-std::array<float,2>{0.465435117f, 0.808311224f},
-std::array<float,2>{0.724669993f, 0.0310918316f},
-std::array<float,2>{0.358913541f, 0.137300953f},
-std::array<float,2>{0.527412713f, 0.965830147f},
-std::array<float,2>{0.123013586f, 0.644608021f},
-std::array<float,2>{0.76938802f, 0.457942337f},
-std::array<float,2>{0.42287758f, 0.427740932f},
-std::array<float,2>{0.642831206f, 0.744155049f},
-std::array<float,2>{0.184432268f, 0.887414634f},
-std::array<float,2>{0.9638955f, 0.193354011f},
-std::array<float,2>{0.0580283627f, 0.0960754752f},
-std::array<float,2>{0.853997588f, 0.869726777f},
-std::array<float,2>{0.311393499f, 0.50574261f},
-std::array<float,2>{0.606953025f, 0.365274251f},
-std::array<float,2>{0.150562897f, 0.479754508f},
-std::array<float,2>{0.990109026f, 0.672595263f},
-std::array<float,2>{0.390241027f, 0.975590885f},
-std::array<float,2>{0.658703625f, 0.179895237f},
-std::array<float,2>{0.263445586f, 0.0393945612f},
-std::array<float,2>{0.58823818f, 0.758731544f},
-std::array<float,2>{0.00515392795f, 0.60205853f},
-std::array<float,2>{0.833521068f, 0.309497386f},
-std::array<float,2>{0.494604439f, 0.325780064f},
-std::array<float,2>{0.717297792f, 0.556993604f},
-std::array<float,2>{0.235831961f, 0.840446055f},
-std::array<float,2>{0.923990011f, 0.0689793453f},
-std::array<float,2>{0.0920281857f, 0.223470554f},
-std::array<float,2>{0.789375246f, 0.930755913f},
-std::array<float,2>{0.320201397f, 0.689383328f},
-std::array<float,2>{0.555944502f, 0.396936566f},
-std::array<float,2>{0.0516667254f, 0.267462611f},
-std::array<float,2>{0.848714888f, 0.583308041f},
-std::array<float,2>{0.298022032f, 0.783333182f},
-std::array<float,2>{0.59876734f, 0.00619583298f},
-std::array<float,2>{0.434595644f, 0.14906916f},
-std::array<float,2>{0.653445303f, 0.94596076f},
-std::array<float,2>{0.173703521f, 0.634018064f},
-std::array<float,2>{0.95564127f, 0.452826202f},
-std::array<float,2>{0.345357448f, 0.411229342f},
-std::array<float,2>{0.520769596f, 0.729792237f},
-std::array<float,2>{0.109539524f, 0.893910646f},
-std::array<float,2>{0.780768692f, 0.213473141f},
-std::array<float,2>{0.19788529f, 0.121696651f},
-std::array<float,2>{0.898075819f, 0.847360611f},
-std::array<float,2>{0.457756907f, 0.52840054f},
-std::array<float,2>{0.731592834f, 0.352864802f},
-std::array<float,2>{0.096222803f, 0.389422774f},
-std::array<float,2>{0.754131377f, 0.70496875f},
-std::array<float,2>{0.361872107f, 0.914885283f},
-std::array<float,2>{0.503149033f, 0.245433211f},
-std::array<float,2>{0.446840256f, 0.084049277f},
-std::array<float,2>{0.735616982f, 0.824682176f},
-std::array<float,2>{0.208031982f, 0.53514719f},
-std::array<float,2>{0.888993084f, 0.340915978f},
-std::array<float,2>{0.29210946f, 0.296360016f},
-std::array<float,2>{0.621976495f, 0.619912863f},
-std::array<float,2>{0.0328086354f, 0.771951437f},
-std::array<float,2>{0.868154645f, 0.0498834066f},
-std::array<float,2>{0.159690842f, 0.165042296f},
-std::array<float,2>{0.939400494f, 0.997839212f},
-std::array<float,2>{0.418735147f, 0.67165333f},
-std::array<float,2>{0.629391015f, 0.488642573f},
-std::array<float,2>{0.223567635f, 0.35999769f},
-std::array<float,2>{0.914542079f, 0.502978623f},
-std::array<float,2>{0.47665897f, 0.874380231f},
-std::array<float,2>{0.695420802f, 0.098694995f},
-std::array<float,2>{0.33107394f, 0.187550694f},
-std::array<float,2>{0.542083681f, 0.885920167f},
-std::array<float,2>{0.0650164187f, 0.748091817f},
-std::array<float,2>{0.803841293f, 0.423461348f},
-std::array<float,2>{0.397128671f, 0.455205888f},
-std::array<float,2>{0.678378999f, 0.643684566f},
-std::array<float,2>{0.138908982f, 0.964673996f},
-std::array<float,2>{0.972010553f, 0.135125861f},
-std::array<float,2>{0.0245424006f, 0.0235713534f},
-std::array<float,2>{0.820598483f, 0.810612082f},
-std::array<float,2>{0.279650867f, 0.566795707f},
-std::array<float,2>{0.567483366f, 0.256337702f},
-std::array<float,2>{0.210951447f, 0.433213741f},
-std::array<float,2>{0.875445485f, 0.740371644f},
-std::array<float,2>{0.443095386f, 0.879530847f},
-std::array<float,2>{0.749477267f, 0.197745427f},
-std::array<float,2>{0.374570489f, 0.105503038f},
-std::array<float,2>{0.508491039f, 0.860723257f},
-std::array<float,2>{0.109147377f, 0.51398176f},
-std::array<float,2>{0.759019434f, 0.367891699f},
-std::array<float,2>{0.406282574f, 0.264402747f},
-std::array<float,2>{0.639128327f, 0.572612107f},
-std::array<float,2>{0.165000767f, 0.802491248f},
-std::array<float,2>{0.945878744f, 0.0199640654f},
-std::array<float,2>{0.0419523604f, 0.131494373f},
-std::array<float,2>{0.865195215f, 0.960934758f},
-std::array<float,2>{0.282597631f, 0.649075568f},
-std::array<float,2>{0.616218984f, 0.468236923f},
-std::array<float,2>{0.0704976693f, 0.334974051f},
-std::array<float,2>{0.811537087f, 0.539938867f},
-std::array<float,2>{0.342769861f, 0.812964916f},
-std::array<float,2>{0.537480652f, 0.0879902989f},
-std::array<float,2>{0.469140589f, 0.234653592f},
-std::array<float,2>{0.692367733f, 0.911245406f},
-std::array<float,2>{0.229058251f, 0.718662262f},
-std::array<float,2>{0.908513486f, 0.382728606f},
-std::array<float,2>{0.271637738f, 0.495250612f},
-std::array<float,2>{0.573414564f, 0.661864936f},
-std::array<float,2>{0.0159930848f, 0.984872103f},
-std::array<float,2>{0.819718421f, 0.159536853f},
-std::array<float,2>{0.130654052f, 0.0575368144f},
-std::array<float,2>{0.978505969f, 0.777582705f},
-std::array<float,2>{0.402854621f, 0.614544153f},
-std::array<float,2>{0.680969238f, 0.285847485f},
-std::array<float,2>{0.01292748f, 0.443633676f},
-std::array<float,2>{0.843721747f, 0.626010358f},
-std::array<float,2>{0.257070452f, 0.944698274f},
-std::array<float,2>{0.580572307f, 0.14365463f},
-std::array<float,2>{0.379184455f, 0.0125885857f},
-std::array<float,2>{0.668751359f, 0.795022607f},
-std::array<float,2>{0.146107614f, 0.587222099f},
-std::array<float,2>{0.997443736f, 0.27666384f},
-std::array<float,2>{0.322533458f, 0.350020289f},
-std::array<float,2>{0.550367594f, 0.516990721f},
-std::array<float,2>{0.0818720981f, 0.854318023f},
-std::array<float,2>{0.787147343f, 0.114253655f},
-std::array<float,2>{0.243720844f, 0.21050404f},
-std::array<float,2>{0.929813743f, 0.904415429f},
-std::array<float,2>{0.491551816f, 0.721956074f},
-std::array<float,2>{0.709205866f, 0.418283194f},
-std::array<float,2>{0.182353854f, 0.30296883f},
-std::array<float,2>{0.965796411f, 0.594213784f},
-std::array<float,2>{0.426965624f, 0.75535959f},
-std::array<float,2>{0.646912932f, 0.0329399668f},
-std::array<float,2>{0.305347085f, 0.173475191f},
-std::array<float,2>{0.602372885f, 0.978924632f},
-std::array<float,2>{0.0613898113f, 0.682413697f},
-std::array<float,2>{0.855902433f, 0.471077204f},
-std::array<float,2>{0.461906999f, 0.401142746f},
-std::array<float,2>{0.722034216f, 0.696267903f},
-std::array<float,2>{0.188013211f, 0.925424993f},
-std::array<float,2>{0.89950192f, 0.232110888f},
-std::array<float,2>{0.119757108f, 0.0738229156f},
-std::array<float,2>{0.771449566f, 0.828446269f},
-std::array<float,2>{0.352456987f, 0.54915309f},
-std::array<float,2>{0.52531755f, 0.313477337f},
-std::array<float,2>{0.202955082f, 0.497376174f},
-std::array<float,2>{0.89075923f, 0.659006476f},
-std::array<float,2>{0.456840307f, 0.990898311f},
-std::array<float,2>{0.729083478f, 0.160240784f},
-std::array<float,2>{0.349759042f, 0.0600002781f},
-std::array<float,2>{0.51905638f, 0.773846328f},
-std::array<float,2>{0.115553908f, 0.610873401f},
-std::array<float,2>{0.774777949f, 0.282513797f},
-std::array<float,2>{0.431778818f, 0.330745131f},
-std::array<float,2>{0.650872588f, 0.545287311f},
-std::array<float,2>{0.177178249f, 0.816971183f},
-std::array<float,2>{0.958178699f, 0.0899949074f},
-std::array<float,2>{0.0482261181f, 0.239315838f},
-std::array<float,2>{0.845501244f, 0.907869041f},
-std::array<float,2>{0.300813705f, 0.712235153f},
-std::array<float,2>{0.59678638f, 0.37513715f},
-std::array<float,2>{0.0867806375f, 0.260908037f},
-std::array<float,2>{0.794739425f, 0.575781584f},
-std::array<float,2>{0.314293265f, 0.797015131f},
-std::array<float,2>{0.562341034f, 0.0177757703f},
-std::array<float,2>{0.499085784f, 0.125889987f},
-std::array<float,2>{0.713994205f, 0.956378639f},
-std::array<float,2>{0.239188433f, 0.654346585f},
-std::array<float,2>{0.927286208f, 0.462080061f},
-std::array<float,2>{0.260284424f, 0.43376115f},
-std::array<float,2>{0.593169212f, 0.737156808f},
-std::array<float,2>{0.00175025489f, 0.878670692f},
-std::array<float,2>{0.831940472f, 0.200259686f},
-std::array<float,2>{0.155105248f, 0.103286088f},
-std::array<float,2>{0.987492681f, 0.865841806f},
-std::array<float,2>{0.384175926f, 0.509055078f},
-std::array<float,2>{0.6627087f, 0.372870952f},
-std::array<float,2>{0.0284687616f, 0.402373731f},
-std::array<float,2>{0.824891388f, 0.699860454f},
-std::array<float,2>{0.276984274f, 0.92603308f},
-std::array<float,2>{0.564984083f, 0.227374837f},
-std::array<float,2>{0.390994936f, 0.0772550702f},
-std::array<float,2>{0.675519764f, 0.835708857f},
-std::array<float,2>{0.136142194f, 0.551853955f},
-std::array<float,2>{0.973783016f, 0.319701046f},
-std::array<float,2>{0.332573116f, 0.297360152f},
-std::array<float,2>{0.545729637f, 0.598045111f},
-std::array<float,2>{0.0702516213f, 0.753152907f},
-std::array<float,2>{0.799577177f, 0.0378811993f},
-std::array<float,2>{0.220545679f, 0.178164169f},
-std::array<float,2>{0.918810129f, 0.982272029f},
-std::array<float,2>{0.481318414f, 0.686672449f},
-std::array<float,2>{0.700706661f, 0.473175317f},
-std::array<float,2>{0.161523312f, 0.345879555f},
-std::array<float,2>{0.9433828f, 0.519763291f},
-std::array<float,2>{0.416001558f, 0.857145309f},
-std::array<float,2>{0.625937581f, 0.113085613f},
-std::array<float,2>{0.294375658f, 0.206341118f},
-std::array<float,2>{0.618849933f, 0.900409758f},
-std::array<float,2>{0.0360697769f, 0.72337687f},
-std::array<float,2>{0.871694744f, 0.417480737f},
-std::array<float,2>{0.450458705f, 0.437526971f},
-std::array<float,2>{0.741095901f, 0.631942928f},
-std::array<float,2>{0.205345318f, 0.939211071f},
-std::array<float,2>{0.883373559f, 0.146097466f},
-std::array<float,2>{0.0992021114f, 0.00954586454f},
-std::array<float,2>{0.753279984f, 0.789324999f},
-std::array<float,2>{0.366268396f, 0.590429962f},
-std::array<float,2>{0.505217254f, 0.279589891f},
-std::array<float,2>{0.126268998f, 0.407377869f},
-std::array<float,2>{0.981186867f, 0.731993973f},
-std::array<float,2>{0.399703324f, 0.895569086f},
-std::array<float,2>{0.684409797f, 0.217195913f},
-std::array<float,2>{0.265872061f, 0.120039463f},
-std::array<float,2>{0.577893734f, 0.848762035f},
-std::array<float,2>{0.0220221709f, 0.524757981f},
-std::array<float,2>{0.813471794f, 0.358388603f},
-std::array<float,2>{0.474960834f, 0.270819724f},
-std::array<float,2>{0.690579712f, 0.580751479f},
-std::array<float,2>{0.234121978f, 0.788423359f},
-std::array<float,2>{0.912474275f, 0.00310372538f},
-std::array<float,2>{0.0774111375f, 0.154390693f},
-std::array<float,2>{0.807678163f, 0.952839792f},
-std::array<float,2>{0.33682999f, 0.638083279f},
-std::array<float,2>{0.531384706f, 0.44578886f},
-std::array<float,2>{0.0454924591f, 0.323110819f},
-std::array<float,2>{0.859502196f, 0.559659481f},
-std::array<float,2>{0.28852275f, 0.838671803f},
-std::array<float,2>{0.611951351f, 0.0651798919f},
-std::array<float,2>{0.413840234f, 0.221944839f},
-std::array<float,2>{0.633443654f, 0.935343981f},
-std::array<float,2>{0.169903144f, 0.691695452f},
-std::array<float,2>{0.949231446f, 0.393572092f},
-std::array<float,2>{0.368040383f, 0.482691169f},
-std::array<float,2>{0.513758898f, 0.67685467f},
-std::array<float,2>{0.105297722f, 0.971835315f},
-std::array<float,2>{0.7645998f, 0.184217215f},
-std::array<float,2>{0.216431409f, 0.0448637605f},
-std::array<float,2>{0.879833221f, 0.765259922f},
-std::array<float,2>{0.439228266f, 0.609152675f},
-std::array<float,2>{0.743003428f, 0.306691259f},
-std::array<float,2>{0.124663249f, 0.460228115f},
-std::array<float,2>{0.766448379f, 0.647211313f},
-std::array<float,2>{0.35603407f, 0.968447566f},
-std::array<float,2>{0.530285239f, 0.139324591f},
-std::array<float,2>{0.46751675f, 0.0281263124f},
-std::array<float,2>{0.724173784f, 0.806163192f},
-std::array<float,2>{0.194290251f, 0.564680278f},
-std::array<float,2>{0.903544962f, 0.25290063f},
-std::array<float,2>{0.309412301f, 0.364489466f},
-std::array<float,2>{0.608592153f, 0.50662148f},
-std::array<float,2>{0.0554036461f, 0.867242038f},
-std::array<float,2>{0.852971077f, 0.0952816084f},
-std::array<float,2>{0.186148047f, 0.193501696f},
-std::array<float,2>{0.962317705f, 0.888791263f},
-std::array<float,2>{0.423913479f, 0.74244529f},
-std::array<float,2>{0.641289771f, 0.426113814f},
-std::array<float,2>{0.248399928f, 0.292286307f},
-std::array<float,2>{0.936842859f, 0.624177098f},
-std::array<float,2>{0.484859347f, 0.76864934f},
-std::array<float,2>{0.703211248f, 0.0542317368f},
-std::array<float,2>{0.324456245f, 0.169078946f},
-std::array<float,2>{0.550810814f, 0.99586308f},
-std::array<float,2>{0.0841724873f, 0.667380095f},
-std::array<float,2>{0.782149732f, 0.487588882f},
-std::array<float,2>{0.376150966f, 0.384884208f},
-std::array<float,2>{0.664556205f, 0.708741307f},
-std::array<float,2>{0.142239094f, 0.920496106f},
-std::array<float,2>{0.995160282f, 0.247419521f},
-std::array<float,2>{0.0116733592f, 0.0805690736f},
-std::array<float,2>{0.837131143f, 0.822661638f},
-std::array<float,2>{0.251380384f, 0.538802266f},
-std::array<float,2>{0.584822476f, 0.338775486f},
-std::array<float,2>{0.175596327f, 0.449998498f},
-std::array<float,2>{0.954538941f, 0.636044264f},
-std::array<float,2>{0.436437428f, 0.948369086f},
-std::array<float,2>{0.655177116f, 0.152226657f},
-std::array<float,2>{0.299232095f, 0.00510714576f},
-std::array<float,2>{0.600090265f, 0.781638861f},
-std::array<float,2>{0.0533079542f, 0.584487081f},
-std::array<float,2>{0.849663675f, 0.26861015f},
-std::array<float,2>{0.460016012f, 0.354186118f},
-std::array<float,2>{0.732610822f, 0.530999601f},
-std::array<float,2>{0.196790189f, 0.844989717f},
-std::array<float,2>{0.895847082f, 0.123474993f},
-std::array<float,2>{0.112112053f, 0.212253958f},
-std::array<float,2>{0.778576553f, 0.891795874f},
-std::array<float,2>{0.346514374f, 0.728439033f},
-std::array<float,2>{0.522709966f, 0.412776381f},
-std::array<float,2>{0.00770668592f, 0.311932921f},
-std::array<float,2>{0.835107625f, 0.604499936f},
-std::array<float,2>{0.264864117f, 0.760269821f},
-std::array<float,2>{0.587141514f, 0.0429137498f},
-std::array<float,2>{0.386988312f, 0.182713389f},
-std::array<float,2>{0.658091903f, 0.973019183f},
-std::array<float,2>{0.148965418f, 0.675129056f},
-std::array<float,2>{0.990920961f, 0.478269339f},
-std::array<float,2>{0.317302823f, 0.395106733f},
-std::array<float,2>{0.557052612f, 0.690849006f},
-std::array<float,2>{0.0908716097f, 0.932829201f},
-std::array<float,2>{0.792946577f, 0.226519704f},
-std::array<float,2>{0.236554801f, 0.0679352656f},
-std::array<float,2>{0.923210263f, 0.843127251f},
-std::array<float,2>{0.492527246f, 0.555646062f},
-std::array<float,2>{0.714988351f, 0.326496452f},
-std::array<float,2>{0.0642175972f, 0.424128532f},
-std::array<float,2>{0.80143106f, 0.746679306f},
-std::array<float,2>{0.329267204f, 0.883015096f},
-std::array<float,2>{0.540368557f, 0.189938024f},
-std::array<float,2>{0.478806555f, 0.0998786315f},
-std::array<float,2>{0.697268903f, 0.872624099f},
-std::array<float,2>{0.224616364f, 0.500033557f},
-std::array<float,2>{0.916507363f, 0.362181842f},
-std::array<float,2>{0.278737336f, 0.254567802f},
-std::array<float,2>{0.568732142f, 0.569687665f},
-std::array<float,2>{0.026141122f, 0.808818281f},
-std::array<float,2>{0.823134601f, 0.0268799681f},
-std::array<float,2>{0.137722448f, 0.133374974f},
-std::array<float,2>{0.969932497f, 0.962715626f},
-std::array<float,2>{0.396293759f, 0.640772641f},
-std::array<float,2>{0.677174926f, 0.45481649f},
-std::array<float,2>{0.210892171f, 0.341880113f},
-std::array<float,2>{0.887868941f, 0.531520247f},
-std::array<float,2>{0.447553664f, 0.827100694f},
-std::array<float,2>{0.737658918f, 0.0826157406f},
-std::array<float,2>{0.360047042f, 0.242413551f},
-std::array<float,2>{0.500397384f, 0.916231275f},
-std::array<float,2>{0.0941614732f, 0.705585063f},
-std::array<float,2>{0.75744766f, 0.387898922f},
-std::array<float,2>{0.420437217f, 0.490273386f},
-std::array<float,2>{0.631999969f, 0.668937683f},
-std::array<float,2>{0.157925338f, 0.998856902f},
-std::array<float,2>{0.941163838f, 0.166305915f},
-std::array<float,2>{0.0332580879f, 0.0482156686f},
-std::array<float,2>{0.869992793f, 0.769767106f},
-std::array<float,2>{0.290499061f, 0.618503928f},
-std::array<float,2>{0.624456644f, 0.293978125f},
-std::array<float,2>{0.22828187f, 0.37971893f},
-std::array<float,2>{0.907437742f, 0.716686726f},
-std::array<float,2>{0.4711411f, 0.913936555f},
-std::array<float,2>{0.693456173f, 0.237833917f},
-std::array<float,2>{0.340384692f, 0.0877908096f},
-std::array<float,2>{0.535526931f, 0.814617038f},
-std::array<float,2>{0.072573483f, 0.541756213f},
-std::array<float,2>{0.809712529f, 0.332740158f},
-std::array<float,2>{0.404399455f, 0.288567036f},
-std::array<float,2>{0.681779623f, 0.616324961f},
-std::array<float,2>{0.131367311f, 0.780495882f},
-std::array<float,2>{0.97885555f, 0.0562158152f},
-std::array<float,2>{0.018390039f, 0.156266436f},
-std::array<float,2>{0.818018317f, 0.987564147f},
-std::array<float,2>{0.270737827f, 0.663179815f},
-std::array<float,2>{0.571784914f, 0.492213875f},
-std::array<float,2>{0.107089147f, 0.370900393f},
-std::array<float,2>{0.760514498f, 0.512787163f},
-std::array<float,2>{0.371897876f, 0.861331582f},
-std::array<float,2>{0.510851681f, 0.108499706f},
-std::array<float,2>{0.444230497f, 0.195335045f},
-std::array<float,2>{0.747138858f, 0.88240248f},
-std::array<float,2>{0.214042857f, 0.738625348f},
-std::array<float,2>{0.876983523f, 0.430041164f},
-std::array<float,2>{0.283752322f, 0.466605067f},
-std::array<float,2>{0.613678992f, 0.652219415f},
-std::array<float,2>{0.0402376242f, 0.957699358f},
-std::array<float,2>{0.866477787f, 0.129931495f},
-std::array<float,2>{0.167173386f, 0.0217250548f},
-std::array<float,2>{0.948015988f, 0.804550827f},
-std::array<float,2>{0.410078287f, 0.571560085f},
-std::array<float,2>{0.636826038f, 0.263651252f},
-std::array<float,2>{0.0590290204f, 0.469982713f},
-std::array<float,2>{0.857560813f, 0.680992723f},
-std::array<float,2>{0.30702588f, 0.977100253f},
-std::array<float,2>{0.603951514f, 0.173900038f},
-std::array<float,2>{0.429311097f, 0.0335996039f},
-std::array<float,2>{0.646404564f, 0.757161438f},
-std::array<float,2>{0.179903135f, 0.596724153f},
-std::array<float,2>{0.967652559f, 0.302691907f},
-std::array<float,2>{0.354250729f, 0.314629495f},
-std::array<float,2>{0.52724719f, 0.547339022f},
-std::array<float,2>{0.117472291f, 0.830337942f},
-std::array<float,2>{0.772400737f, 0.0721955001f},
-std::array<float,2>{0.190953076f, 0.234005079f},
-std::array<float,2>{0.900468171f, 0.92209518f},
-std::array<float,2>{0.464238495f, 0.698770821f},
-std::array<float,2>{0.720406353f, 0.399178684f},
-std::array<float,2>{0.148296505f, 0.273959845f},
-std::array<float,2>{0.99988538f, 0.588396072f},
-std::array<float,2>{0.382712126f, 0.79489994f},
-std::array<float,2>{0.670902669f, 0.0156104583f},
-std::array<float,2>{0.255315781f, 0.141887978f},
-std::array<float,2>{0.578881681f, 0.943183422f},
-std::array<float,2>{0.0141515303f, 0.627363086f},
-std::array<float,2>{0.840799749f, 0.442742854f},
-std::array<float,2>{0.489384264f, 0.420560539f},
-std::array<float,2>{0.707491457f, 0.71957922f},
-std::array<float,2>{0.24422662f, 0.902511597f},
-std::array<float,2>{0.933234215f, 0.207097828f},
-std::array<float,2>{0.0792363808f, 0.117029436f},
-std::array<float,2>{0.786971748f, 0.852018118f},
-std::array<float,2>{0.321043611f, 0.517668307f},
-std::array<float,2>{0.547382712f, 0.347815365f},
-std::array<float,2>{0.247977749f, 0.487819761f},
-std::array<float,2>{0.935226738f, 0.667556643f},
-std::array<float,2>{0.486676097f, 0.995508134f},
-std::array<float,2>{0.705970883f, 0.169439152f},
-std::array<float,2>{0.327605963f, 0.053807769f},
-std::array<float,2>{0.553474426f, 0.76931715f},
-std::array<float,2>{0.0832285136f, 0.624807537f},
-std::array<float,2>{0.783892274f, 0.292684615f},
-std::array<float,2>{0.377030283f, 0.338231504f},
-std::array<float,2>{0.666090906f, 0.538545728f},
-std::array<float,2>{0.144263566f, 0.822796643f},
-std::array<float,2>{0.993203342f, 0.0803640857f},
-std::array<float,2>{0.00836597476f, 0.247696623f},
-std::array<float,2>{0.839768767f, 0.9201653f},
-std::array<float,2>{0.253896296f, 0.708466887f},
-std::array<float,2>{0.583097219f, 0.385684848f},
-std::array<float,2>{0.12212956f, 0.25199762f},
-std::array<float,2>{0.768578172f, 0.565380812f},
-std::array<float,2>{0.358566493f, 0.806087196f},
-std::array<float,2>{0.527929664f, 0.0277757961f},
-std::array<float,2>{0.465046108f, 0.138792962f},
-std::array<float,2>{0.725224435f, 0.967912376f},
-std::array<float,2>{0.191497579f, 0.646722436f},
-std::array<float,2>{0.904874444f, 0.460585117f},
-std::array<float,2>{0.310573161f, 0.426545769f},
-std::array<float,2>{0.606604636f, 0.742944777f},
-std::array<float,2>{0.0581411682f, 0.889342546f},
-std::array<float,2>{0.854034722f, 0.19424054f},
-std::array<float,2>{0.184061721f, 0.0948580429f},
-std::array<float,2>{0.9647488f, 0.868002117f},
-std::array<float,2>{0.42379728f, 0.506003499f},
-std::array<float,2>{0.643379152f, 0.364922792f},
-std::array<float,2>{0.0439582951f, 0.394271463f},
-std::array<float,2>{0.861999571f, 0.692231894f},
-std::array<float,2>{0.285897672f, 0.934600949f},
-std::array<float,2>{0.610187769f, 0.22259374f},
-std::array<float,2>{0.410541832f, 0.0649220496f},
-std::array<float,2>{0.635169506f, 0.838280618f},
-std::array<float,2>{0.170949891f, 0.560489833f},
-std::array<float,2>{0.95153743f, 0.322366059f},
-std::array<float,2>{0.36947614f, 0.307471335f},
-std::array<float,2>{0.512546539f, 0.608808577f},
-std::array<float,2>{0.103472948f, 0.764768362f},
-std::array<float,2>{0.762473881f, 0.04436896f},
-std::array<float,2>{0.218547672f, 0.1836759f},
-std::array<float,2>{0.881292284f, 0.972487748f},
-std::array<float,2>{0.440116733f, 0.677612901f},
-std::array<float,2>{0.745345056f, 0.483280361f},
-std::array<float,2>{0.12707679f, 0.357499212f},
-std::array<float,2>{0.983927906f, 0.525213599f},
-std::array<float,2>{0.40217489f, 0.849496841f},
-std::array<float,2>{0.687388599f, 0.119559132f},
-std::array<float,2>{0.268340707f, 0.217404842f},
-std::array<float,2>{0.575488865f, 0.896261275f},
-std::array<float,2>{0.0198938213f, 0.731582284f},
-std::array<float,2>{0.815086603f, 0.408162534f},
-std::array<float,2>{0.472976178f, 0.445873231f},
-std::array<float,2>{0.689029932f, 0.638398647f},
-std::array<float,2>{0.231430382f, 0.952207267f},
-std::array<float,2>{0.910334289f, 0.155223504f},
-std::array<float,2>{0.0742684975f, 0.00348733668f},
-std::array<float,2>{0.804713845f, 0.788908839f},
-std::array<float,2>{0.339832813f, 0.58021313f},
-std::array<float,2>{0.53475821f, 0.271425635f},
-std::array<float,2>{0.162306234f, 0.417068988f},
-std::array<float,2>{0.943336487f, 0.722681284f},
-std::array<float,2>{0.417553663f, 0.901049018f},
-std::array<float,2>{0.627247512f, 0.20675166f},
-std::array<float,2>{0.296573669f, 0.112316757f},
-std::array<float,2>{0.619564295f, 0.856459975f},
-std::array<float,2>{0.0379151702f, 0.520482242f},
-std::array<float,2>{0.874899864f, 0.346578389f},
-std::array<float,2>{0.45272693f, 0.280066133f},
-std::array<float,2>{0.739485264f, 0.589929402f},
-std::array<float,2>{0.204076648f, 0.789600551f},
-std::array<float,2>{0.885022938f, 0.009085631f},
-std::array<float,2>{0.10026516f, 0.145526946f},
-std::array<float,2>{0.750524282f, 0.938661456f},
-std::array<float,2>{0.3644633f, 0.632587612f},
-std::array<float,2>{0.506760716f, 0.438399792f},
-std::array<float,2>{0.0301731825f, 0.320196778f},
-std::array<float,2>{0.826791167f, 0.552350998f},
-std::array<float,2>{0.275217742f, 0.835285962f},
-std::array<float,2>{0.56384027f, 0.0780869797f},
-std::array<float,2>{0.394073308f, 0.226681069f},
-std::array<float,2>{0.673410416f, 0.926441252f},
-std::array<float,2>{0.134689257f, 0.69945401f},
-std::array<float,2>{0.975854993f, 0.403300643f},
-std::array<float,2>{0.334879339f, 0.47312662f},
-std::array<float,2>{0.544892192f, 0.687332451f},
-std::array<float,2>{0.0665898845f, 0.981755376f},
-std::array<float,2>{0.797448218f, 0.178381339f},
-std::array<float,2>{0.221378684f, 0.0373017713f},
-std::array<float,2>{0.92186594f, 0.753770649f},
-std::array<float,2>{0.483555645f, 0.598616123f},
-std::array<float,2>{0.702975929f, 0.297423601f},
-std::array<float,2>{0.0886759982f, 0.462548614f},
-std::array<float,2>{0.796774566f, 0.65509963f},
-std::array<float,2>{0.315600872f, 0.956792414f},
-std::array<float,2>{0.559340537f, 0.125416145f},
-std::array<float,2>{0.497586757f, 0.0185272023f},
-std::array<float,2>{0.712409914f, 0.797560096f},
-std::array<float,2>{0.241889492f, 0.575535595f},
-std::array<float,2>{0.929206908f, 0.261645943f},
-std::array<float,2>{0.258524358f, 0.372369617f},
-std::array<float,2>{0.590253055f, 0.509550273f},
-std::array<float,2>{0.00327151222f, 0.865240455f},
-std::array<float,2>{0.829214871f, 0.102868937f},
-std::array<float,2>{0.154010788f, 0.200829595f},
-std::array<float,2>{0.985818744f, 0.878036082f},
-std::array<float,2>{0.385620594f, 0.736510456f},
-std::array<float,2>{0.66099596f, 0.434199691f},
-std::array<float,2>{0.200071812f, 0.282783687f},
-std::array<float,2>{0.893905103f, 0.610693276f},
-std::array<float,2>{0.453138322f, 0.774239182f},
-std::array<float,2>{0.727811635f, 0.0604809448f},
-std::array<float,2>{0.349143326f, 0.160650223f},
-std::array<float,2>{0.517221391f, 0.99027282f},
-std::array<float,2>{0.113963678f, 0.65849632f},
-std::array<float,2>{0.776164949f, 0.497964978f},
-std::array<float,2>{0.43000564f, 0.375869185f},
-std::array<float,2>{0.649276376f, 0.712813497f},
-std::array<float,2>{0.178931057f, 0.907478988f},
-std::array<float,2>{0.959125459f, 0.240223572f},
-std::array<float,2>{0.0490620546f, 0.0903774276f},
-std::array<float,2>{0.847324967f, 0.816712976f},
-std::array<float,2>{0.304364264f, 0.545435011f},
-std::array<float,2>{0.594090819f, 0.330487639f},
-std::array<float,2>{0.145832345f, 0.443351597f},
-std::array<float,2>{0.997759223f, 0.627754927f},
-std::array<float,2>{0.37954846f, 0.942829609f},
-std::array<float,2>{0.668262661f, 0.142149642f},
-std::array<float,2>{0.2574341f, 0.0150823388f},
-std::array<float,2>{0.580277741f, 0.79427433f},
-std::array<float,2>{0.0133926198f, 0.588363826f},
-std::array<float,2>{0.842892468f, 0.27384609f},
-std::array<float,2>{0.491887361f, 0.348328829f},
-std::array<float,2>{0.709948063f, 0.518192768f},
-std::array<float,2>{0.243288562f, 0.852430522f},
-std::array<float,2>{0.930458128f, 0.116374932f},
-std::array<float,2>{0.0812889487f, 0.207741305f},
-std::array<float,2>{0.787840605f, 0.902920842f},
-std::array<float,2>{0.322908163f, 0.719237566f},
-std::array<float,2>{0.5501194f, 0.420285374f},
-std::array<float,2>{0.0605657995f, 0.302154273f},
-std::array<float,2>{0.856270015f, 0.59719497f},
-std::array<float,2>{0.304924548f, 0.757777035f},
-std::array<float,2>{0.601918817f, 0.0337653607f},
-std::array<float,2>{0.427472413f, 0.174482599f},
-std::array<float,2>{0.647241175f, 0.976670742f},
-std::array<float,2>{0.181715265f, 0.681331694f},
-std::array<float,2>{0.964903116f, 0.470346987f},
-std::array<float,2>{0.351705968f, 0.398512304f},
-std::array<float,2>{0.524429858f, 0.698651314f},
-std::array<float,2>{0.119555332f, 0.922643065f},
-std::array<float,2>{0.770838499f, 0.233879521f},
-std::array<float,2>{0.187585622f, 0.0716908127f},
-std::array<float,2>{0.900107741f, 0.830929577f},
-std::array<float,2>{0.461195827f, 0.547734559f},
-std::array<float,2>{0.722488999f, 0.315171629f},
-std::array<float,2>{0.108626015f, 0.430617005f},
-std::array<float,2>{0.759581029f, 0.739091158f},
-std::array<float,2>{0.374457717f, 0.882228255f},
-std::array<float,2>{0.508112609f, 0.195995152f},
-std::array<float,2>{0.442685902f, 0.108893588f},
-std::array<float,2>{0.749520063f, 0.862145901f},
-std::array<float,2>{0.211704597f, 0.513187587f},
-std::array<float,2>{0.875713944f, 0.370208949f},
-std::array<float,2>{0.283011585f, 0.262903422f},
-std::array<float,2>{0.616993546f, 0.572240353f},
-std::array<float,2>{0.0411151312f, 0.804055572f},
-std::array<float,2>{0.864518344f, 0.022359781f},
-std::array<float,2>{0.164363682f, 0.130467534f},
-std::array<float,2>{0.945586801f, 0.957506478f},
-std::array<float,2>{0.407047212f, 0.651575565f},
-std::array<float,2>{0.639217079f, 0.465893f},
-std::array<float,2>{0.228690594f, 0.332144678f},
-std::array<float,2>{0.908920288f, 0.541097939f},
-std::array<float,2>{0.469584316f, 0.815180957f},
-std::array<float,2>{0.691581011f, 0.0873749629f},
-std::array<float,2>{0.342067033f, 0.237557068f},
-std::array<float,2>{0.537609935f, 0.913387477f},
-std::array<float,2>{0.0709439069f, 0.716038048f},
-std::array<float,2>{0.812349975f, 0.378938049f},
-std::array<float,2>{0.402780175f, 0.49303019f},
-std::array<float,2>{0.681632221f, 0.663797081f},
-std::array<float,2>{0.130344138f, 0.988120079f},
-std::array<float,2>{0.977876902f, 0.156813323f},
-std::array<float,2>{0.0162424576f, 0.0559075065f},
-std::array<float,2>{0.820044518f, 0.780996084f},
-std::array<float,2>{0.272147298f, 0.616910875f},
-std::array<float,2>{0.574112773f, 0.288912237f},
-std::array<float,2>{0.208789423f, 0.388487995f},
-std::array<float,2>{0.889393687f, 0.705406308f},
-std::array<float,2>{0.446387172f, 0.916521549f},
-std::array<float,2>{0.736283123f, 0.242793009f},
-std::array<float,2>{0.361406714f, 0.0822264627f},
-std::array<float,2>{0.503670454f, 0.826264024f},
-std::array<float,2>{0.0958427042f, 0.531832695f},
-std::array<float,2>{0.754717469f, 0.342546672f},
-std::array<float,2>{0.41821605f, 0.294526696f},
-std::array<float,2>{0.629533231f, 0.618902266f},
-std::array<float,2>{0.159191921f, 0.770454824f},
-std::array<float,2>{0.938832998f, 0.0486637093f},
-std::array<float,2>{0.0322477296f, 0.166791409f},
-std::array<float,2>{0.867420197f, 0.998245597f},
-std::array<float,2>{0.292715877f, 0.668099761f},
-std::array<float,2>{0.621254146f, 0.490973562f},
-std::array<float,2>{0.0644986629f, 0.361602008f},
-std::array<float,2>{0.804322243f, 0.500493824f},
-std::array<float,2>{0.331653088f, 0.872093141f},
-std::array<float,2>{0.542553961f, 0.100362472f},
-std::array<float,2>{0.477261007f, 0.189970091f},
-std::array<float,2>{0.696009338f, 0.883763134f},
-std::array<float,2>{0.223049223f, 0.746227205f},
-std::array<float,2>{0.914915621f, 0.424739301f},
-std::array<float,2>{0.280097365f, 0.454545468f},
-std::array<float,2>{0.567887664f, 0.641344845f},
-std::array<float,2>{0.0252533183f, 0.962077498f},
-std::array<float,2>{0.82091701f, 0.133149788f},
-std::array<float,2>{0.13921763f, 0.0265874863f},
-std::array<float,2>{0.97223115f, 0.809099019f},
-std::array<float,2>{0.396823108f, 0.570061386f},
-std::array<float,2>{0.678128779f, 0.254353672f},
-std::array<float,2>{0.00543729868f, 0.477698117f},
-std::array<float,2>{0.833011866f, 0.67543596f},
-std::array<float,2>{0.263161659f, 0.973521769f},
-std::array<float,2>{0.588458717f, 0.183390051f},
-std::array<float,2>{0.389839679f, 0.0421761349f},
-std::array<float,2>{0.658420026f, 0.759796977f},
-std::array<float,2>{0.15121302f, 0.605307341f},
-std::array<float,2>{0.989497662f, 0.312058955f},
-std::array<float,2>{0.319494456f, 0.32668981f},
-std::array<float,2>{0.55625087f, 0.554916263f},
-std::array<float,2>{0.0924816206f, 0.843450427f},
-std::array<float,2>{0.78998369f, 0.0674735233f},
-std::array<float,2>{0.236076564f, 0.225875378f},
-std::array<float,2>{0.924684346f, 0.933254004f},
-std::array<float,2>{0.495057702f, 0.691120267f},
-std::array<float,2>{0.716836035f, 0.394681454f},
-std::array<float,2>{0.173110291f, 0.269322097f},
-std::array<float,2>{0.955192208f, 0.584402323f},
-std::array<float,2>{0.435112596f, 0.781911969f},
-std::array<float,2>{0.654123127f, 0.00562377973f},
-std::array<float,2>{0.29835853f, 0.151698366f},
-std::array<float,2>{0.599409759f, 0.949022472f},
-std::array<float,2>{0.0512129143f, 0.636289537f},
-std::array<float,2>{0.849235058f, 0.449411899f},
-std::array<float,2>{0.457080781f, 0.412457764f},
-std::array<float,2>{0.73208487f, 0.727612555f},
-std::array<float,2>{0.19750984f, 0.892160952f},
-std::array<float,2>{0.897719324f, 0.212795824f},
-std::array<float,2>{0.110066101f, 0.123567544f},
-std::array<float,2>{0.780633748f, 0.84543097f},
-std::array<float,2>{0.344753861f, 0.530611336f},
-std::array<float,2>{0.521338165f, 0.35364303f},
-std::array<float,2>{0.19359161f, 0.457332283f},
-std::array<float,2>{0.904007554f, 0.645314217f},
-std::array<float,2>{0.466828734f, 0.966505587f},
-std::array<float,2>{0.724120021f, 0.137043551f},
-std::array<float,2>{0.355621636f, 0.0306819454f},
-std::array<float,2>{0.530786633f, 0.807875514f},
-std::array<float,2>{0.124047071f, 0.564267159f},
-std::array<float,2>{0.765662551f, 0.251802266f},
-std::array<float,2>{0.424779445f, 0.366053253f},
-std::array<float,2>{0.640831769f, 0.505167127f},
-std::array<float,2>{0.185874999f, 0.869287431f},
-std::array<float,2>{0.962827146f, 0.0964426398f},
-std::array<float,2>{0.0551065393f, 0.192659244f},
-std::array<float,2>{0.853251934f, 0.88712579f},
-std::array<float,2>{0.308679372f, 0.744662941f},
-std::array<float,2>{0.609052837f, 0.428550869f},
-std::array<float,2>{0.0847945735f, 0.290528268f},
-std::array<float,2>{0.781471133f, 0.622820318f},
-std::array<float,2>{0.324919671f, 0.76567328f},
-std::array<float,2>{0.55172509f, 0.0511085093f},
-std::array<float,2>{0.485161602f, 0.171643898f},
-std::array<float,2>{0.703987896f, 0.993195236f},
-std::array<float,2>{0.248675168f, 0.665790141f},
-std::array<float,2>{0.937217176f, 0.48496595f},
-std::array<float,2>{0.251797497f, 0.384276867f},
-std::array<float,2>{0.584133446f, 0.710335314f},
-std::array<float,2>{0.0111858398f, 0.919659734f},
-std::array<float,2>{0.837678313f, 0.24964647f},
-std::array<float,2>{0.14185521f, 0.0796088502f},
-std::array<float,2>{0.995708704f, 0.821312129f},
-std::array<float,2>{0.376935005f, 0.536248207f},
-std::array<float,2>{0.664310634f, 0.33651045f},
-std::array<float,2>{0.0218748692f, 0.409090579f},
-std::array<float,2>{0.812792838f, 0.733756304f},
-std::array<float,2>{0.266268313f, 0.896913588f},
-std::array<float,2>{0.577280641f, 0.216639444f},
-std::array<float,2>{0.400018066f, 0.117395118f},
-std::array<float,2>{0.683755815f, 0.850853145f},
-std::array<float,2>{0.12676391f, 0.525900006f},
-std::array<float,2>{0.980708003f, 0.357282698f},
-std::array<float,2>{0.336367726f, 0.272775829f},
-std::array<float,2>{0.531748712f, 0.579481661f},
-std::array<float,2>{0.0780540556f, 0.785871089f},
-std::array<float,2>{0.808547854f, 0.00150949357f},
-std::array<float,2>{0.233763158f, 0.153807178f},
-std::array<float,2>{0.912652731f, 0.950299799f},
-std::array<float,2>{0.475286037f, 0.639985859f},
-std::array<float,2>{0.690939486f, 0.447589934f},
-std::array<float,2>{0.169355184f, 0.321998417f},
-std::array<float,2>{0.950012505f, 0.562241316f},
-std::array<float,2>{0.413326353f, 0.836251318f},
-std::array<float,2>{0.633040249f, 0.0633309856f},
-std::array<float,2>{0.288887411f, 0.219339132f},
-std::array<float,2>{0.61158061f, 0.936041772f},
-std::array<float,2>{0.0453962274f, 0.694282532f},
-std::array<float,2>{0.860114872f, 0.391804814f},
-std::array<float,2>{0.438623816f, 0.482342988f},
-std::array<float,2>{0.742547989f, 0.678785443f},
-std::array<float,2>{0.216188282f, 0.969321728f},
-std::array<float,2>{0.878993154f, 0.186552942f},
-std::array<float,2>{0.104876414f, 0.0462822579f},
-std::array<float,2>{0.763872981f, 0.763635576f},
-std::array<float,2>{0.367272139f, 0.605630696f},
-std::array<float,2>{0.514630914f, 0.306050628f},
-std::array<float,2>{0.136565208f, 0.404772699f},
-std::array<float,2>{0.974277139f, 0.702102065f},
-std::array<float,2>{0.391331255f, 0.928299069f},
-std::array<float,2>{0.674825549f, 0.230327487f},
-std::array<float,2>{0.276381165f, 0.0752535984f},
-std::array<float,2>{0.564934373f, 0.833967209f},
-std::array<float,2>{0.0289234389f, 0.553559721f},
-std::array<float,2>{0.824471712f, 0.317425758f},
-std::array<float,2>{0.480839461f, 0.29947263f},
-std::array<float,2>{0.700326622f, 0.601067066f},
-std::array<float,2>{0.220211834f, 0.750902593f},
-std::array<float,2>{0.918381035f, 0.0353114977f},
-std::array<float,2>{0.0694035292f, 0.175880194f},
-std::array<float,2>{0.799039125f, 0.984317005f},
-std::array<float,2>{0.332434714f, 0.683748662f},
-std::array<float,2>{0.545019805f, 0.474690229f},
-std::array<float,2>{0.0353837386f, 0.345423311f},
-std::array<float,2>{0.87112695f, 0.523358643f},
-std::array<float,2>{0.294624537f, 0.858243465f},
-std::array<float,2>{0.618446887f, 0.109885849f},
-std::array<float,2>{0.415256619f, 0.204030618f},
-std::array<float,2>{0.625443041f, 0.899589241f},
-std::array<float,2>{0.161658496f, 0.726410747f},
-std::array<float,2>{0.944286108f, 0.415489793f},
-std::array<float,2>{0.366706461f, 0.440075129f},
-std::array<float,2>{0.505734086f, 0.629742622f},
-std::array<float,2>{0.0987485573f, 0.941197693f},
-std::array<float,2>{0.753714263f, 0.147453547f},
-std::array<float,2>{0.205606222f, 0.0104149114f},
-std::array<float,2>{0.883298993f, 0.792074859f},
-std::array<float,2>{0.450802892f, 0.593339443f},
-std::array<float,2>{0.740533233f, 0.2778759f},
-std::array<float,2>{0.11576499f, 0.498108268f},
-std::array<float,2>{0.775227845f, 0.6575495f},
-std::array<float,2>{0.350302249f, 0.989700973f},
-std::array<float,2>{0.518792927f, 0.162164718f},
-std::array<float,2>{0.456408799f, 0.0605931394f},
-std::array<float,2>{0.728649914f, 0.776242733f},
-std::array<float,2>{0.20238027f, 0.611703813f},
-std::array<float,2>{0.891151547f, 0.283806056f},
-std::array<float,2>{0.301580936f, 0.32948482f},
-std::array<float,2>{0.597183645f, 0.544022799f},
-std::array<float,2>{0.0483616479f, 0.818652332f},
-std::array<float,2>{0.845099211f, 0.0926370099f},
-std::array<float,2>{0.177623197f, 0.241198584f},
-std::array<float,2>{0.95875895f, 0.909833908f},
-std::array<float,2>{0.432457715f, 0.714375317f},
-std::array<float,2>{0.651058257f, 0.377504319f},
-std::array<float,2>{0.238494575f, 0.258763433f},
-std::array<float,2>{0.927064478f, 0.577383757f},
-std::array<float,2>{0.499930233f, 0.799463511f},
-std::array<float,2>{0.714580536f, 0.0165833831f},
-std::array<float,2>{0.313669413f, 0.127618209f},
-std::array<float,2>{0.561868012f, 0.954890311f},
-std::array<float,2>{0.0862122849f, 0.653458774f},
-std::array<float,2>{0.794136465f, 0.463776499f},
-std::array<float,2>{0.384300828f, 0.436174631f},
-std::array<float,2>{0.662432551f, 0.736240804f},
-std::array<float,2>{0.154455855f, 0.875962436f},
-std::array<float,2>{0.987960815f, 0.202810213f},
-std::array<float,2>{0.00126858312f, 0.103712551f},
-std::array<float,2>{0.831314504f, 0.863456964f},
-std::array<float,2>{0.259862036f, 0.510122836f},
-std::array<float,2>{0.593404591f, 0.374309391f},
-std::array<float,2>{0.180596337f, 0.471484214f},
-std::array<float,2>{0.967116594f, 0.6820575f},
-std::array<float,2>{0.428852648f, 0.979190052f},
-std::array<float,2>{0.645602465f, 0.172872856f},
-std::array<float,2>{0.307242841f, 0.0324463397f},
-std::array<float,2>{0.604381323f, 0.755506754f},
-std::array<float,2>{0.0594285131f, 0.594447494f},
-std::array<float,2>{0.858182311f, 0.303522497f},
-std::array<float,2>{0.46475333f, 0.314345807f},
-std::array<float,2>{0.720105469f, 0.54948318f},
-std::array<float,2>{0.190776527f, 0.829087675f},
-std::array<float,2>{0.901095092f, 0.0737128779f},
-std::array<float,2>{0.117780052f, 0.231763646f},
-std::array<float,2>{0.771916807f, 0.924958825f},
-std::array<float,2>{0.35391134f, 0.695672512f},
-std::array<float,2>{0.52657634f, 0.400841087f},
-std::array<float,2>{0.0144641092f, 0.276869118f},
-std::array<float,2>{0.84000963f, 0.587459981f},
-std::array<float,2>{0.25551945f, 0.795587242f},
-std::array<float,2>{0.578516126f, 0.0118790315f},
-std::array<float,2>{0.382273853f, 0.144439921f},
-std::array<float,2>{0.671671987f, 0.945179045f},
-std::array<float,2>{0.147923782f, 0.6269238f},
-std::array<float,2>{0.999465048f, 0.443892658f},
-std::array<float,2>{0.320577741f, 0.41866836f},
-std::array<float,2>{0.546990871f, 0.722480118f},
-std::array<float,2>{0.0796959996f, 0.905250549f},
-std::array<float,2>{0.786357224f, 0.210234568f},
-std::array<float,2>{0.2446623f, 0.113508955f},
-std::array<float,2>{0.932946444f, 0.85365653f},
-std::array<float,2>{0.489876837f, 0.517338991f},
-std::array<float,2>{0.707877815f, 0.350191474f},
-std::array<float,2>{0.0730843693f, 0.381878525f},
-std::array<float,2>{0.810383141f, 0.718116522f},
-std::array<float,2>{0.340151072f, 0.911819458f},
-std::array<float,2>{0.535724699f, 0.235260025f},
-std::array<float,2>{0.471209139f, 0.0884481296f},
-std::array<float,2>{0.694068372f, 0.813335001f},
-std::array<float,2>{0.227710322f, 0.539377272f},
-std::array<float,2>{0.907724142f, 0.335660398f},
-std::array<float,2>{0.271168619f, 0.285530388f},
-std::array<float,2>{0.571760774f, 0.615017951f},
-std::array<float,2>{0.0179640576f, 0.777882516f},
-std::array<float,2>{0.817765176f, 0.0566871017f},
-std::array<float,2>{0.131089285f, 0.159832165f},
-std::array<float,2>{0.979148388f, 0.984412968f},
-std::array<float,2>{0.404949695f, 0.661212265f},
-std::array<float,2>{0.68224895f, 0.495928824f},
-std::array<float,2>{0.214627087f, 0.36756742f},
-std::array<float,2>{0.877570331f, 0.514478683f},
-std::array<float,2>{0.443595976f, 0.861176252f},
-std::array<float,2>{0.748018503f, 0.106206462f},
-std::array<float,2>{0.371195346f, 0.197843716f},
-std::array<float,2>{0.511243045f, 0.878929913f},
-std::array<float,2>{0.106697962f, 0.741199732f},
-std::array<float,2>{0.760248899f, 0.433077455f},
-std::array<float,2>{0.409291446f, 0.468748152f},
-std::array<float,2>{0.637615025f, 0.648892939f},
-std::array<float,2>{0.167734474f, 0.960439444f},
-std::array<float,2>{0.947740316f, 0.131310657f},
-std::array<float,2>{0.0408260338f, 0.0200902652f},
-std::array<float,2>{0.866948843f, 0.80208993f},
-std::array<float,2>{0.283382446f, 0.572808087f},
-std::array<float,2>{0.613949656f, 0.263717234f},
-std::array<float,2>{0.225513056f, 0.423311114f},
-std::array<float,2>{0.916066706f, 0.748591661f},
-std::array<float,2>{0.479056388f, 0.886322916f},
-std::array<float,2>{0.698031604f, 0.188276693f},
-std::array<float,2>{0.329679668f, 0.0991346687f},
-std::array<float,2>{0.540916622f, 0.874525428f},
-std::array<float,2>{0.0636561885f, 0.503435194f},
-std::array<float,2>{0.801049232f, 0.359841645f},
-std::array<float,2>{0.395536184f, 0.256478816f},
-std::array<float,2>{0.677390993f, 0.567138314f},
-std::array<float,2>{0.138436407f, 0.811294913f},
-std::array<float,2>{0.970281363f, 0.0240590703f},
-std::array<float,2>{0.0254810154f, 0.135314867f},
-std::array<float,2>{0.822484195f, 0.964141607f},
-std::array<float,2>{0.278969496f, 0.644122541f},
-std::array<float,2>{0.568977416f, 0.455910712f},
-std::array<float,2>{0.0946602598f, 0.341352373f},
-std::array<float,2>{0.757256567f, 0.534386218f},
-std::array<float,2>{0.359498888f, 0.824977219f},
-std::array<float,2>{0.500922978f, 0.0844790041f},
-std::array<float,2>{0.447921753f, 0.245709002f},
-std::array<float,2>{0.737942815f, 0.914138734f},
-std::array<float,2>{0.210185423f, 0.704291761f},
-std::array<float,2>{0.888195217f, 0.388993204f},
-std::array<float,2>{0.290755421f, 0.489188403f},
-std::array<float,2>{0.624767005f, 0.671130836f},
-std::array<float,2>{0.0340869874f, 0.997437418f},
-std::array<float,2>{0.869358897f, 0.165702507f},
-std::array<float,2>{0.157443583f, 0.0503675863f},
-std::array<float,2>{0.940877199f, 0.772201777f},
-std::array<float,2>{0.420324326f, 0.619256377f},
-std::array<float,2>{0.632751584f, 0.296539515f},
-std::array<float,2>{0.0527459048f, 0.452319652f},
-std::array<float,2>{0.850566983f, 0.634488285f},
-std::array<float,2>{0.299367309f, 0.94539243f},
-std::array<float,2>{0.600294769f, 0.148758531f},
-std::array<float,2>{0.435603172f, 0.00651162863f},
-std::array<float,2>{0.654439926f, 0.78398782f},
-std::array<float,2>{0.175284877f, 0.583943665f},
-std::array<float,2>{0.954662442f, 0.266851008f},
-std::array<float,2>{0.345940799f, 0.353114337f},
-std::array<float,2>{0.523091614f, 0.528932512f},
-std::array<float,2>{0.111605011f, 0.846724629f},
-std::array<float,2>{0.779137909f, 0.12118005f},
-std::array<float,2>{0.196456626f, 0.213068083f},
-std::array<float,2>{0.89647001f, 0.894374073f},
-std::array<float,2>{0.460845828f, 0.730085135f},
-std::array<float,2>{0.733010054f, 0.411842793f},
-std::array<float,2>{0.148476273f, 0.308861494f},
-std::array<float,2>{0.990426004f, 0.601873338f},
-std::array<float,2>{0.387612879f, 0.758099854f},
-std::array<float,2>{0.657458723f, 0.0399706624f},
-std::array<float,2>{0.265225053f, 0.180242002f},
-std::array<float,2>{0.587576807f, 0.976424932f},
-std::array<float,2>{0.00723390002f, 0.672086298f},
-std::array<float,2>{0.835613668f, 0.480349481f},
-std::array<float,2>{0.493113726f, 0.397329837f},
-std::array<float,2>{0.715438962f, 0.688745141f},
-std::array<float,2>{0.236979201f, 0.931350708f},
-std::array<float,2>{0.923814297f, 0.222704947f},
-std::array<float,2>{0.091320619f, 0.0687662438f},
-std::array<float,2>{0.792084396f, 0.840069294f},
-std::array<float,2>{0.316771358f, 0.55717057f},
-std::array<float,2>{0.557391524f, 0.325616121f},
-std::array<float,2>{0.231779292f, 0.448635519f},
-std::array<float,2>{0.91190356f, 0.638992071f},
-std::array<float,2>{0.473786265f, 0.949436665f},
-std::array<float,2>{0.687912583f, 0.152820006f},
-std::array<float,2>{0.338417083f, 0.000118165786f},
-std::array<float,2>{0.533784747f, 0.786417902f},
-std::array<float,2>{0.0754720122f, 0.578779042f},
-std::array<float,2>{0.805776417f, 0.272401094f},
-std::array<float,2>{0.400976151f, 0.356279254f},
-std::array<float,2>{0.686322391f, 0.527275145f},
-std::array<float,2>{0.128201172f, 0.850474834f},
-std::array<float,2>{0.982928157f, 0.118915118f},
-std::array<float,2>{0.020635359f, 0.215538308f},
-std::array<float,2>{0.815617979f, 0.898227632f},
-std::array<float,2>{0.269124717f, 0.733128428f},
-std::array<float,2>{0.574717045f, 0.409252137f},
-std::array<float,2>{0.101968274f, 0.305199742f},
-std::array<float,2>{0.763161719f, 0.606956065f},
-std::array<float,2>{0.370489925f, 0.762363553f},
-std::array<float,2>{0.513180196f, 0.0455896668f},
-std::array<float,2>{0.440530539f, 0.186422542f},
-std::array<float,2>{0.744542956f, 0.970656216f},
-std::array<float,2>{0.217402503f, 0.67777431f},
-std::array<float,2>{0.882266104f, 0.480734617f},
-std::array<float,2>{0.286219358f, 0.391435057f},
-std::array<float,2>{0.610375166f, 0.694860101f},
-std::array<float,2>{0.0435428433f, 0.93726337f},
-std::array<float,2>{0.86256814f, 0.220292345f},
-std::array<float,2>{0.170120075f, 0.0643779263f},
-std::array<float,2>{0.952937901f, 0.837497711f},
-std::array<float,2>{0.411933303f, 0.561078787f},
-std::array<float,2>{0.63621527f, 0.320527285f},
-std::array<float,2>{0.0573680811f, 0.429563075f},
-std::array<float,2>{0.855418086f, 0.745761633f},
-std::array<float,2>{0.312494397f, 0.888546765f},
-std::array<float,2>{0.606203318f, 0.192016751f},
-std::array<float,2>{0.422092706f, 0.0973864645f},
-std::array<float,2>{0.644522548f, 0.870670319f},
-std::array<float,2>{0.185007483f, 0.504681706f},
-std::array<float,2>{0.962922275f, 0.366296709f},
-std::array<float,2>{0.357651323f, 0.250779748f},
-std::array<float,2>{0.529168129f, 0.562632561f},
-std::array<float,2>{0.121697351f, 0.807144821f},
-std::array<float,2>{0.768435538f, 0.0298654884f},
-std::array<float,2>{0.192968205f, 0.13812688f},
-std::array<float,2>{0.905806541f, 0.965450823f},
-std::array<float,2>{0.46587944f, 0.646274924f},
-std::array<float,2>{0.725889146f, 0.458027035f},
-std::array<float,2>{0.142918393f, 0.337533861f},
-std::array<float,2>{0.992958307f, 0.535930097f},
-std::array<float,2>{0.378588289f, 0.821003437f},
-std::array<float,2>{0.667466283f, 0.0786809549f},
-std::array<float,2>{0.252510399f, 0.248390496f},
-std::array<float,2>{0.582039475f, 0.91811806f},
-std::array<float,2>{0.00899475906f, 0.709235907f},
-std::array<float,2>{0.83827728f, 0.383428156f},
-std::array<float,2>{0.487364948f, 0.485608995f},
-std::array<float,2>{0.706211686f, 0.664260983f},
-std::array<float,2>{0.246544793f, 0.992557764f},
-std::array<float,2>{0.933987856f, 0.17046985f},
-std::array<float,2>{0.0820482895f, 0.0520320199f},
-std::array<float,2>{0.784395039f, 0.767066956f},
-std::array<float,2>{0.327138186f, 0.621641219f},
-std::array<float,2>{0.554137051f, 0.28994292f},
-std::array<float,2>{0.178220257f, 0.378316939f},
-std::array<float,2>{0.960859418f, 0.713662922f},
-std::array<float,2>{0.431353748f, 0.908383727f},
-std::array<float,2>{0.649464667f, 0.241386756f},
-std::array<float,2>{0.303155273f, 0.092977494f},
-std::array<float,2>{0.594975054f, 0.819796085f},
-std::array<float,2>{0.0506593399f, 0.543854892f},
-std::array<float,2>{0.846618116f, 0.328370541f},
-std::array<float,2>{0.454693049f, 0.284909487f},
-std::array<float,2>{0.727397919f, 0.612516522f},
-std::array<float,2>{0.200874165f, 0.776402295f},
-std::array<float,2>{0.893474638f, 0.0617552064f},
-std::array<float,2>{0.114411213f, 0.163701221f},
-std::array<float,2>{0.776559711f, 0.988705754f},
-std::array<float,2>{0.34842965f, 0.657072365f},
-std::array<float,2>{0.516329348f, 0.499895394f},
-std::array<float,2>{0.00235732296f, 0.373394459f},
-std::array<float,2>{0.82864219f, 0.511140764f},
-std::array<float,2>{0.259550184f, 0.864862323f},
-std::array<float,2>{0.591699421f, 0.104540773f},
-std::array<float,2>{0.386689812f, 0.201685905f},
-std::array<float,2>{0.661139309f, 0.876605749f},
-std::array<float,2>{0.152692989f, 0.734631479f},
-std::array<float,2>{0.985345244f, 0.436554313f},
-std::array<float,2>{0.315163761f, 0.463875949f},
-std::array<float,2>{0.5598526f, 0.652690291f},
-std::array<float,2>{0.0897825286f, 0.953864932f},
-std::array<float,2>{0.795109987f, 0.128699958f},
-std::array<float,2>{0.240607515f, 0.0167332515f},
-std::array<float,2>{0.928393543f, 0.800399005f},
-std::array<float,2>{0.496225804f, 0.576721549f},
-std::array<float,2>{0.711294711f, 0.259070247f},
-std::array<float,2>{0.068110466f, 0.476230383f},
-std::array<float,2>{0.798734486f, 0.685364306f},
-std::array<float,2>{0.335875511f, 0.982672393f},
-std::array<float,2>{0.543693066f, 0.177576736f},
-std::array<float,2>{0.482555747f, 0.0370715074f},
-std::array<float,2>{0.701409757f, 0.75118643f},
-std::array<float,2>{0.221783847f, 0.600427985f},
-std::array<float,2>{0.920007825f, 0.300354928f},
-std::array<float,2>{0.273912907f, 0.317100376f},
-std::array<float,2>{0.562818825f, 0.553827226f},
-std::array<float,2>{0.0308797359f, 0.832910478f},
-std::array<float,2>{0.82729435f, 0.0742680579f},
-std::array<float,2>{0.132938236f, 0.22928299f},
-std::array<float,2>{0.974771023f, 0.928792775f},
-std::array<float,2>{0.392818809f, 0.702174962f},
-std::array<float,2>{0.671903193f, 0.405587196f},
-std::array<float,2>{0.204860672f, 0.278802902f},
-std::array<float,2>{0.886148214f, 0.592660427f},
-std::array<float,2>{0.451909274f, 0.791481376f},
-std::array<float,2>{0.738856494f, 0.0109103704f},
-std::array<float,2>{0.363317877f, 0.14807947f},
-std::array<float,2>{0.507635593f, 0.940039575f},
-std::array<float,2>{0.100925609f, 0.630741715f},
-std::array<float,2>{0.751134634f, 0.441339821f},
-std::array<float,2>{0.416823f, 0.414283961f},
-std::array<float,2>{0.628895879f, 0.725406289f},
-std::array<float,2>{0.164056599f, 0.898979068f},
-std::array<float,2>{0.941892266f, 0.204949856f},
-std::array<float,2>{0.0385497212f, 0.111296095f},
-std::array<float,2>{0.873678029f, 0.85860163f},
-std::array<float,2>{0.29527694f, 0.521934867f},
-std::array<float,2>{0.620988548f, 0.344223052f},
-std::array<float,2>{0.128953293f, 0.49442476f},
-std::array<float,2>{0.976697683f, 0.660546482f},
-std::array<float,2>{0.403385192f, 0.985708058f},
-std::array<float,2>{0.679736197f, 0.158937767f},
-std::array<float,2>{0.273399591f, 0.0582221076f},
-std::array<float,2>{0.573208332f, 0.779234886f},
-std::array<float,2>{0.0175069422f, 0.613393068f},
-std::array<float,2>{0.8183887f, 0.286256492f},
-std::array<float,2>{0.469787598f, 0.33412081f},
-std::array<float,2>{0.693160355f, 0.540121078f},
-std::array<float,2>{0.23024483f, 0.813661277f},
-std::array<float,2>{0.909444094f, 0.0893166512f},
-std::array<float,2>{0.0713081807f, 0.236311495f},
-std::array<float,2>{0.811096787f, 0.910304546f},
-std::array<float,2>{0.343103856f, 0.717061281f},
-std::array<float,2>{0.538863122f, 0.381259143f},
-std::array<float,2>{0.0421736538f, 0.265293777f},
-std::array<float,2>{0.863797247f, 0.574199796f},
-std::array<float,2>{0.281365961f, 0.801261663f},
-std::array<float,2>{0.615667343f, 0.0207492672f},
-std::array<float,2>{0.407713979f, 0.132365644f},
-std::array<float,2>{0.640121758f, 0.95944494f},
-std::array<float,2>{0.165591881f, 0.649594367f},
-std::array<float,2>{0.947197199f, 0.467369616f},
-std::array<float,2>{0.373645782f, 0.432401806f},
-std::array<float,2>{0.50957042f, 0.741304338f},
-std::array<float,2>{0.107671343f, 0.879933119f},
-std::array<float,2>{0.758188725f, 0.198863104f},
-std::array<float,2>{0.211969405f, 0.106473304f},
-std::array<float,2>{0.876018524f, 0.85953337f},
-std::array<float,2>{0.442317575f, 0.514834583f},
-std::array<float,2>{0.748079896f, 0.368583322f},
-std::array<float,2>{0.120531075f, 0.401544958f},
-std::array<float,2>{0.769948184f, 0.696642101f},
-std::array<float,2>{0.352922976f, 0.924124777f},
-std::array<float,2>{0.523697078f, 0.231323764f},
-std::array<float,2>{0.462150872f, 0.0725110844f},
-std::array<float,2>{0.721639454f, 0.829242587f},
-std::array<float,2>{0.188918412f, 0.550064206f},
-std::array<float,2>{0.898816228f, 0.312599331f},
-std::array<float,2>{0.306307733f, 0.304197758f},
-std::array<float,2>{0.60275048f, 0.594809234f},
-std::array<float,2>{0.061813958f, 0.75417906f},
-std::array<float,2>{0.857284784f, 0.0317468084f},
-std::array<float,2>{0.183270946f, 0.172638535f},
-std::array<float,2>{0.965930104f, 0.979727983f},
-std::array<float,2>{0.425825953f, 0.683018386f},
-std::array<float,2>{0.648415446f, 0.472532928f},
-std::array<float,2>{0.242758229f, 0.35135293f},
-std::array<float,2>{0.931084335f, 0.515663743f},
-std::array<float,2>{0.490618229f, 0.85538435f},
-std::array<float,2>{0.710046649f, 0.114752859f},
-std::array<float,2>{0.324004948f, 0.209109426f},
-std::array<float,2>{0.549075544f, 0.905484617f},
-std::array<float,2>{0.0801985338f, 0.720995188f},
-std::array<float,2>{0.788749754f, 0.419153899f},
-std::array<float,2>{0.380333841f, 0.444478333f},
-std::array<float,2>{0.669004858f, 0.625542998f},
-std::array<float,2>{0.144940436f, 0.943496644f},
-std::array<float,2>{0.996264637f, 0.142915756f},
-std::array<float,2>{0.0121309245f, 0.013186859f},
-std::array<float,2>{0.841827989f, 0.796590924f},
-std::array<float,2>{0.255963951f, 0.586743891f},
-std::array<float,2>{0.581166089f, 0.275500238f},
-std::array<float,2>{0.198869064f, 0.410654396f},
-std::array<float,2>{0.896904826f, 0.728994131f},
-std::array<float,2>{0.458895653f, 0.893088639f},
-std::array<float,2>{0.730567336f, 0.214158118f},
-std::array<float,2>{0.344055355f, 0.12241251f},
-std::array<float,2>{0.519962966f, 0.846489906f},
-std::array<float,2>{0.110507384f, 0.527677238f},
-std::array<float,2>{0.779320478f, 0.35220927f},
-std::array<float,2>{0.434268743f, 0.26640588f},
-std::array<float,2>{0.652998805f, 0.582575262f},
-std::array<float,2>{0.172803745f, 0.784387231f},
-std::array<float,2>{0.956351399f, 0.00719855214f},
-std::array<float,2>{0.0520170704f, 0.14998731f},
-std::array<float,2>{0.847957432f, 0.947153151f},
-std::array<float,2>{0.297086716f, 0.63375026f},
-std::array<float,2>{0.597716093f, 0.451759756f},
-std::array<float,2>{0.0936192945f, 0.324763834f},
-std::array<float,2>{0.790917397f, 0.557712674f},
-std::array<float,2>{0.318605781f, 0.840937674f},
-std::array<float,2>{0.555176139f, 0.0697403178f},
-std::array<float,2>{0.495168924f, 0.223721042f},
-std::array<float,2>{0.718352795f, 0.930008411f},
-std::array<float,2>{0.234401315f, 0.687963486f},
-std::array<float,2>{0.925153971f, 0.39824158f},
-std::array<float,2>{0.261836469f, 0.478961915f},
-std::array<float,2>{0.589352727f, 0.67312324f},
-std::array<float,2>{0.00432845484f, 0.9755795f},
-std::array<float,2>{0.832051337f, 0.181501448f},
-std::array<float,2>{0.151673332f, 0.0405723192f},
-std::array<float,2>{0.988478363f, 0.759107769f},
-std::array<float,2>{0.38878575f, 0.602878749f},
-std::array<float,2>{0.659424722f, 0.310292661f},
-std::array<float,2>{0.024143178f, 0.457008779f},
-std::array<float,2>{0.821294785f, 0.643225968f},
-std::array<float,2>{0.281216234f, 0.963477969f},
-std::array<float,2>{0.56647706f, 0.136192039f},
-std::array<float,2>{0.397494793f, 0.0249008629f},
-std::array<float,2>{0.679490983f, 0.811534166f},
-std::array<float,2>{0.139877751f, 0.567555666f},
-std::array<float,2>{0.970982611f, 0.257661998f},
-std::array<float,2>{0.330581337f, 0.361152112f},
-std::array<float,2>{0.541627884f, 0.502318323f},
-std::array<float,2>{0.0662498027f, 0.873730838f},
-std::array<float,2>{0.803316534f, 0.0984713137f},
-std::array<float,2>{0.224598259f, 0.188845173f},
-std::array<float,2>{0.915213704f, 0.885322392f},
-std::array<float,2>{0.478107691f, 0.749471247f},
-std::array<float,2>{0.696965933f, 0.421930373f},
-std::array<float,2>{0.158802018f, 0.29585588f},
-std::array<float,2>{0.93794769f, 0.620965779f},
-std::array<float,2>{0.419142365f, 0.773094594f},
-std::array<float,2>{0.63003397f, 0.0495103858f},
-std::array<float,2>{0.291470855f, 0.164155841f},
-std::array<float,2>{0.622134328f, 0.996275425f},
-std::array<float,2>{0.0313395076f, 0.669946551f},
-std::array<float,2>{0.868747771f, 0.489762425f},
-std::array<float,2>{0.446118385f, 0.389990568f},
-std::array<float,2>{0.734878957f, 0.703259826f},
-std::array<float,2>{0.207957283f, 0.915428102f},
-std::array<float,2>{0.890325546f, 0.245044917f},
-std::array<float,2>{0.0972476751f, 0.0853654593f},
-std::array<float,2>{0.755157769f, 0.825848401f},
-std::array<float,2>{0.363274723f, 0.533278704f},
-std::array<float,2>{0.502679706f, 0.340281904f},
-std::array<float,2>{0.215598881f, 0.484279275f},
-std::array<float,2>{0.880189121f, 0.676160157f},
-std::array<float,2>{0.437568188f, 0.971221745f},
-std::array<float,2>{0.744120359f, 0.184606329f},
-std::array<float,2>{0.369134426f, 0.0431269854f},
-std::array<float,2>{0.515188515f, 0.763985395f},
-std::array<float,2>{0.103831895f, 0.60818404f},
-std::array<float,2>{0.765430927f, 0.308269978f},
-std::array<float,2>{0.412132531f, 0.324143201f},
-std::array<float,2>{0.63382715f, 0.559108257f},
-std::array<float,2>{0.168710291f, 0.839802504f},
-std::array<float,2>{0.95055604f, 0.0662642419f},
-std::array<float,2>{0.0466742665f, 0.220880598f},
-std::array<float,2>{0.860987723f, 0.934562087f},
-std::array<float,2>{0.287291467f, 0.692599952f},
-std::array<float,2>{0.612419486f, 0.39261663f},
-std::array<float,2>{0.0768347979f, 0.269781351f},
-std::array<float,2>{0.80741334f, 0.581286907f},
-std::array<float,2>{0.337303996f, 0.787547648f},
-std::array<float,2>{0.532680988f, 0.00223323796f},
-std::array<float,2>{0.476104289f, 0.156246856f},
-std::array<float,2>{0.69000566f, 0.951406956f},
-std::array<float,2>{0.233248726f, 0.636938691f},
-std::array<float,2>{0.913206041f, 0.447060734f},
-std::array<float,2>{0.266867965f, 0.406605095f},
-std::array<float,2>{0.576987624f, 0.730675876f},
-std::array<float,2>{0.0231108982f, 0.894866586f},
-std::array<float,2>{0.814154387f, 0.218446955f},
-std::array<float,2>{0.125128731f, 0.120831646f},
-std::array<float,2>{0.982092977f, 0.848459482f},
-std::array<float,2>{0.399208993f, 0.523457408f},
-std::array<float,2>{0.684749246f, 0.359103143f},
-std::array<float,2>{0.0102799572f, 0.386184722f},
-std::array<float,2>{0.836028934f, 0.707266867f},
-std::array<float,2>{0.250739545f, 0.921835721f},
-std::array<float,2>{0.585857093f, 0.246099114f},
-std::array<float,2>{0.375855923f, 0.0815459415f},
-std::array<float,2>{0.665204346f, 0.823520184f},
-std::array<float,2>{0.14116548f, 0.5376091f},
-std::array<float,2>{0.994402885f, 0.33948499f},
-std::array<float,2>{0.325214446f, 0.291267425f},
-std::array<float,2>{0.552187741f, 0.623119533f},
-std::array<float,2>{0.0855291262f, 0.768189967f},
-std::array<float,2>{0.782940924f, 0.0532109961f},
-std::array<float,2>{0.249560088f, 0.168279707f},
-std::array<float,2>{0.935933769f, 0.994615197f},
-std::array<float,2>{0.48606059f, 0.666175425f},
-std::array<float,2>{0.704197228f, 0.486546427f},
-std::array<float,2>{0.186711997f, 0.363369167f},
-std::array<float,2>{0.961411595f, 0.507011712f},
-std::array<float,2>{0.424892008f, 0.868314624f},
-std::array<float,2>{0.641924202f, 0.0939475819f},
-std::array<float,2>{0.309923172f, 0.19433859f},
-std::array<float,2>{0.607462287f, 0.890550494f},
-std::array<float,2>{0.0557184704f, 0.743208289f},
-std::array<float,2>{0.851777494f, 0.427669048f},
-std::array<float,2>{0.467883199f, 0.459432274f},
-std::array<float,2>{0.723073363f, 0.647494674f},
-std::array<float,2>{0.194837749f, 0.966884255f},
-std::array<float,2>{0.902762294f, 0.14014475f},
-std::array<float,2>{0.123317137f, 0.0288360696f},
-std::array<float,2>{0.767513216f, 0.805273592f},
-std::array<float,2>{0.356722564f, 0.565496027f},
-std::array<float,2>{0.529587746f, 0.253588259f},
-std::array<float,2>{0.155658558f, 0.435460895f},
-std::array<float,2>{0.986587822f, 0.73785007f},
-std::array<float,2>{0.383309543f, 0.877182603f},
-std::array<float,2>{0.663274765f, 0.199719638f},
-std::array<float,2>{0.261582762f, 0.102373868f},
-std::array<float,2>{0.59194088f, 0.86664474f},
-std::array<float,2>{0.000598450075f, 0.508077741f},
-std::array<float,2>{0.830854952f, 0.371986657f},
-std::array<float,2>{0.498684913f, 0.260259002f},
-std::array<float,2>{0.712958992f, 0.574550033f},
-std::array<float,2>{0.240064353f, 0.79836446f},
-std::array<float,2>{0.926496983f, 0.0188110173f},
-std::array<float,2>{0.0875789002f, 0.1263621f},
-std::array<float,2>{0.793898225f, 0.955669045f},
-std::array<float,2>{0.312975019f, 0.655463636f},
-std::array<float,2>{0.561038494f, 0.461798668f},
-std::array<float,2>{0.0477304421f, 0.331124991f},
-std::array<float,2>{0.843816817f, 0.54663223f},
-std::array<float,2>{0.302725255f, 0.818290114f},
-std::array<float,2>{0.596002042f, 0.0911465958f},
-std::array<float,2>{0.433504879f, 0.238826036f},
-std::array<float,2>{0.651780784f, 0.906484306f},
-std::array<float,2>{0.176241755f, 0.711882234f},
-std::array<float,2>{0.957443953f, 0.376183063f},
-std::array<float,2>{0.351006925f, 0.496723652f},
-std::array<float,2>{0.518106282f, 0.659691513f},
-std::array<float,2>{0.116835319f, 0.992011726f},
-std::array<float,2>{0.774378479f, 0.161172986f},
-std::array<float,2>{0.201757982f, 0.0587742254f},
-std::array<float,2>{0.892204463f, 0.775062025f},
-std::array<float,2>{0.455880225f, 0.609621704f},
-std::array<float,2>{0.730459809f, 0.281553149f},
-std::array<float,2>{0.0983080789f, 0.439115316f},
-std::array<float,2>{0.752169788f, 0.631088555f},
-std::array<float,2>{0.365908444f, 0.937518895f},
-std::array<float,2>{0.503983617f, 0.144989967f},
-std::array<float,2>{0.449641556f, 0.00798116904f},
-std::array<float,2>{0.741971731f, 0.790969312f},
-std::array<float,2>{0.206240505f, 0.59162271f},
-std::array<float,2>{0.884699523f, 0.280727744f},
-std::array<float,2>{0.293251663f, 0.347542286f},
-std::array<float,2>{0.617878199f, 0.520658553f},
-std::array<float,2>{0.0362802446f, 0.856404066f},
-std::array<float,2>{0.872758627f, 0.112224862f},
-std::array<float,2>{0.160293922f, 0.205174997f},
-std::array<float,2>{0.94529599f, 0.902188599f},
-std::array<float,2>{0.414245844f, 0.723801196f},
-std::array<float,2>{0.626657963f, 0.416166693f},
-std::array<float,2>{0.219648734f, 0.29831326f},
-std::array<float,2>{0.919050634f, 0.599254429f},
-std::array<float,2>{0.482135087f, 0.752249658f},
-std::array<float,2>{0.699615121f, 0.0389185138f},
-std::array<float,2>{0.333174765f, 0.179511011f},
-std::array<float,2>{0.546196461f, 0.980610192f},
-std::array<float,2>{0.0684060305f, 0.686191261f},
-std::array<float,2>{0.800724506f, 0.474533439f},
-std::array<float,2>{0.391882837f, 0.404161781f},
-std::array<float,2>{0.674066126f, 0.700513065f},
-std::array<float,2>{0.135515362f, 0.927060783f},
-std::array<float,2>{0.973173857f, 0.228016824f},
-std::array<float,2>{0.0274223909f, 0.0766666308f},
-std::array<float,2>{0.825394571f, 0.834765613f},
-std::array<float,2>{0.275639266f, 0.550856709f},
-std::array<float,2>{0.566175044f, 0.31873101f},
-std::array<float,2>{0.166414618f, 0.465408623f},
-std::array<float,2>{0.949203849f, 0.650555551f},
-std::array<float,2>{0.408540159f, 0.958038628f},
-std::array<float,2>{0.638578773f, 0.129074201f},
-std::array<float,2>{0.28495124f, 0.0226925127f},
-std::array<float,2>{0.61471653f, 0.803267956f},
-std::array<float,2>{0.0399657972f, 0.571208537f},
-std::array<float,2>{0.866016984f, 0.262617111f},
-std::array<float,2>{0.444735736f, 0.369623929f},
-std::array<float,2>{0.746474266f, 0.512447059f},
-std::array<float,2>{0.213752717f, 0.863094985f},
-std::array<float,2>{0.878609955f, 0.107716545f},
-std::array<float,2>{0.106094927f, 0.196616054f},
-std::array<float,2>{0.761283934f, 0.881022632f},
-std::array<float,2>{0.372420043f, 0.739958644f},
-std::array<float,2>{0.510420084f, 0.431631327f},
-std::array<float,2>{0.0191916637f, 0.287169069f},
-std::array<float,2>{0.817166686f, 0.615396321f},
-std::array<float,2>{0.270444125f, 0.779482663f},
-std::array<float,2>{0.570700645f, 0.0553251505f},
-std::array<float,2>{0.405573726f, 0.157969192f},
-std::array<float,2>{0.683237553f, 0.987038255f},
-std::array<float,2>{0.132038847f, 0.662577808f},
-std::array<float,2>{0.979819f, 0.493897378f},
-std::array<float,2>{0.341131717f, 0.379998088f},
-std::array<float,2>{0.536196828f, 0.715445459f},
-std::array<float,2>{0.0738101006f, 0.912830353f},
-std::array<float,2>{0.808601677f, 0.236568362f},
-std::array<float,2>{0.226986215f, 0.0863416791f},
-std::array<float,2>{0.906539917f, 0.816200793f},
-std::array<float,2>{0.47225824f, 0.542121887f},
-std::array<float,2>{0.694979489f, 0.333484203f},
-std::array<float,2>{0.0782006532f, 0.421001822f},
-std::array<float,2>{0.78571564f, 0.72000283f},
-std::array<float,2>{0.321452439f, 0.903698385f},
-std::array<float,2>{0.548153639f, 0.208073452f},
-std::array<float,2>{0.488964468f, 0.115248807f},
-std::array<float,2>{0.708763182f, 0.853120983f},
-std::array<float,2>{0.245876819f, 0.518933654f},
-std::array<float,2>{0.932551205f, 0.349118739f},
-std::array<float,2>{0.254038185f, 0.274666011f},
-std::array<float,2>{0.57955724f, 0.589400649f},
-std::array<float,2>{0.0152765643f, 0.793175697f},
-std::array<float,2>{0.841069758f, 0.0142552685f},
-std::array<float,2>{0.147117883f, 0.141573533f},
-std::array<float,2>{0.998338401f, 0.941869736f},
-std::array<float,2>{0.381592512f, 0.62830317f},
-std::array<float,2>{0.670108974f, 0.441801846f},
-std::array<float,2>{0.190324843f, 0.315567136f},
-std::array<float,2>{0.901785254f, 0.548534632f},
-std::array<float,2>{0.463445038f, 0.831192076f},
-std::array<float,2>{0.718797266f, 0.0711396337f},
-std::array<float,2>{0.355015039f, 0.232890949f},
-std::array<float,2>{0.526053011f, 0.923359156f},
-std::array<float,2>{0.118512817f, 0.697340667f},
-std::array<float,2>{0.77304858f, 0.400232852f},
-std::array<float,2>{0.428633928f, 0.468782395f},
-std::array<float,2>{0.64539659f, 0.679882586f},
-std::array<float,2>{0.180796906f, 0.978463471f},
-std::array<float,2>{0.967923164f, 0.175641313f},
-std::array<float,2>{0.0604623705f, 0.034938287f},
-std::array<float,2>{0.858569145f, 0.756329f},
-std::array<float,2>{0.308080882f, 0.596311092f},
-std::array<float,2>{0.605029047f, 0.301140606f},
-std::array<float,2>{0.237592891f, 0.396018267f},
-std::array<float,2>{0.922083616f, 0.689552486f},
-std::array<float,2>{0.493209451f, 0.932441533f},
-std::array<float,2>{0.716170073f, 0.224913642f},
-std::array<float,2>{0.318104029f, 0.0667753071f},
-std::array<float,2>{0.557959735f, 0.842508316f},
-std::array<float,2>{0.0905844048f, 0.556086659f},
-std::array<float,2>{0.791802824f, 0.327465385f},
-std::array<float,2>{0.388080329f, 0.310992151f},
-std::array<float,2>{0.656656802f, 0.60401237f},
-std::array<float,2>{0.150078222f, 0.760977268f},
-std::array<float,2>{0.992135942f, 0.041126363f},
-std::array<float,2>{0.00633278536f, 0.18190743f},
-std::array<float,2>{0.83457619f, 0.974447489f},
-std::array<float,2>{0.263941616f, 0.67456001f},
-std::array<float,2>{0.586080134f, 0.476973683f},
-std::array<float,2>{0.112675846f, 0.355272263f},
-std::array<float,2>{0.778156519f, 0.530162573f},
-std::array<float,2>{0.346862257f, 0.843975365f},
-std::array<float,2>{0.522280633f, 0.12454807f},
-std::array<float,2>{0.459503412f, 0.211284041f},
-std::array<float,2>{0.734188497f, 0.890636384f},
-std::array<float,2>{0.195393056f, 0.727414787f},
-std::array<float,2>{0.894950867f, 0.413759828f},
-std::array<float,2>{0.30024758f, 0.450951189f},
-std::array<float,2>{0.601269841f, 0.635364354f},
-std::array<float,2>{0.054461401f, 0.947914898f},
-std::array<float,2>{0.85059768f, 0.151157707f},
-std::array<float,2>{0.174203053f, 0.00425902568f},
-std::array<float,2>{0.953491032f, 0.78311801f},
-std::array<float,2>{0.437098294f, 0.585159421f},
-std::array<float,2>{0.655960381f, 0.26826331f},
-std::array<float,2>{0.034239877f, 0.491603076f},
-std::array<float,2>{0.871021569f, 0.669629633f},
-std::array<float,2>{0.289539993f, 0.999501169f},
-std::array<float,2>{0.623814702f, 0.167329207f},
-std::array<float,2>{0.421634585f, 0.0478054658f},
-std::array<float,2>{0.631585479f, 0.770748436f},
-std::array<float,2>{0.156277508f, 0.617606521f},
-std::array<float,2>{0.939864397f, 0.293671191f},
-std::array<float,2>{0.361147851f, 0.343433857f},
-std::array<float,2>{0.501106083f, 0.532871366f},
-std::array<float,2>{0.0949672908f, 0.827425241f},
-std::array<float,2>{0.756626725f, 0.083882533f},
-std::array<float,2>{0.209941447f, 0.243773878f},
-std::array<float,2>{0.886921763f, 0.917435467f},
-std::array<float,2>{0.449013501f, 0.706458569f},
-std::array<float,2>{0.736896515f, 0.387568861f},
-std::array<float,2>{0.137561575f, 0.255130857f},
-std::array<float,2>{0.968802869f, 0.568388343f},
-std::array<float,2>{0.394920826f, 0.81027174f},
-std::array<float,2>{0.676163614f, 0.0255658738f},
-std::array<float,2>{0.278111517f, 0.133998632f},
-std::array<float,2>{0.56960398f, 0.961321712f},
-std::array<float,2>{0.0266660023f, 0.642227471f},
-std::array<float,2>{0.824001074f, 0.453840554f},
-std::array<float,2>{0.479601383f, 0.424883515f},
-std::array<float,2>{0.698777914f, 0.747266769f},
-std::array<float,2>{0.225768074f, 0.883874953f},
-std::array<float,2>{0.917181611f, 0.191212595f},
-std::array<float,2>{0.0625381395f, 0.101307578f},
-std::array<float,2>{0.802641392f, 0.871998191f},
-std::array<float,2>{0.328776121f, 0.501333237f},
-std::array<float,2>{0.539140224f, 0.362453282f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.323209941f, 0.872039318f},
-std::array<float,2>{0.99425f, 0.170896426f},
-std::array<float,2>{0.523532569f, 0.601308346f},
-std::array<float,2>{0.209224999f, 0.453217655f},
-std::array<float,2>{0.0933702439f, 0.656119525f},
-std::array<float,2>{0.63032937f, 0.320899636f},
-std::array<float,2>{0.867146611f, 0.929551423f},
-std::array<float,2>{0.385954112f, 0.0650532618f},
-std::array<float,2>{0.146810278f, 0.947769403f},
-std::array<float,2>{0.600935876f, 0.0192820057f},
-std::array<float,2>{0.883765221f, 0.737271488f},
-std::array<float,2>{0.287871391f, 0.252536088f},
-std::array<float,2>{0.476245016f, 0.530918002f},
-std::array<float,2>{0.803204894f, 0.417358071f},
-std::array<float,2>{0.688345134f, 0.801553309f},
-std::array<float,2>{0.0381176285f, 0.221255034f},
-std::array<float,2>{0.421569288f, 0.895119548f},
-std::array<float,2>{0.832794487f, 0.0993082747f},
-std::array<float,2>{0.666710436f, 0.667192101f},
-std::array<float,2>{0.098641865f, 0.369313747f},
-std::array<float,2>{0.249859244f, 0.563666344f},
-std::array<float,2>{0.555714786f, 0.487722844f},
-std::array<float,2>{0.966034889f, 0.818250179f},
-std::array<float,2>{0.362772942f, 0.140895084f},
-std::array<float,2>{0.00612178445f, 0.765691757f},
-std::array<float,2>{0.736539721f, 0.207047403f},
-std::array<float,2>{0.757340968f, 0.53919065f},
-std::array<float,2>{0.465925574f, 0.39492026f},
-std::array<float,2>{0.26749751f, 0.713694513f},
-std::array<float,2>{0.910014272f, 0.290151268f},
-std::array<float,2>{0.567236602f, 0.981189072f},
-std::array<float,2>{0.173455566f, 0.0624701418f},
-std::array<float,2>{0.304104298f, 0.990976274f},
-std::array<float,2>{0.905833006f, 0.0351093002f},
-std::array<float,2>{0.613454282f, 0.701302588f},
-std::array<float,2>{0.137907356f, 0.303651631f},
-std::array<float,2>{0.0538351908f, 0.556417584f},
-std::array<float,2>{0.709571183f, 0.390076667f},
-std::array<float,2>{0.791934729f, 0.761500418f},
-std::array<float,2>{0.498538017f, 0.188090548f},
-std::array<float,2>{0.19847393f, 0.836541057f},
-std::array<float,2>{0.506073773f, 0.133934036f},
-std::array<float,2>{0.970430791f, 0.580767512f},
-std::array<float,2>{0.330900013f, 0.470230937f},
-std::array<float,2>{0.4027448f, 0.675547123f},
-std::array<float,2>{0.854898453f, 0.354855984f},
-std::array<float,2>{0.644115508f, 0.89021647f},
-std::array<float,2>{0.0632563159f, 0.122377224f},
-std::array<float,2>{0.447589964f, 0.786054909f},
-std::array<float,2>{0.777008951f, 0.243910909f},
-std::array<float,2>{0.724347055f, 0.506936789f},
-std::array<float,2>{0.0182930939f, 0.431570709f},
-std::array<float,2>{0.168647334f, 0.723401785f},
-std::array<float,2>{0.580118001f, 0.276462466f},
-std::array<float,2>{0.926191151f, 0.967297018f},
-std::array<float,2>{0.251077414f, 0.00959712733f},
-std::array<float,2>{0.120993085f, 0.906636894f},
-std::array<float,2>{0.679091215f, 0.0902393907f},
-std::array<float,2>{0.813512266f, 0.626714885f},
-std::array<float,2>{0.42451036f, 0.339206815f},
-std::array<float,2>{0.349367291f, 0.623190999f},
-std::array<float,2>{0.93750751f, 0.441145629f},
-std::array<float,2>{0.54025048f, 0.846561134f},
-std::array<float,2>{0.222981215f, 0.180930272f},
-std::array<float,2>{0.260795265f, 0.754494131f},
-std::array<float,2>{0.93014282f, 0.198810831f},
-std::array<float,2>{0.586437583f, 0.547544539f},
-std::array<float,2>{0.158104971f, 0.378157377f},
-std::array<float,2>{0.0304106344f, 0.68848753f},
-std::array<float,2>{0.729815423f, 0.30527848f},
-std::array<float,2>{0.772218227f, 0.998850763f},
-std::array<float,2>{0.44204241f, 0.0452493876f},
-std::array<float,2>{0.233631045f, 0.877716005f},
-std::array<float,2>{0.534370005f, 0.111994594f},
-std::array<float,2>{0.951857686f, 0.683201373f},
-std::array<float,2>{0.354664475f, 0.346872956f},
-std::array<float,2>{0.430876791f, 0.586982012f},
-std::array<float,2>{0.826222479f, 0.478405118f},
-std::array<float,2>{0.683462381f, 0.828887522f},
-std::array<float,2>{0.115001179f, 0.125492811f},
-std::array<float,2>{0.486661971f, 0.957033396f},
-std::array<float,2>{0.783641875f, 0.0010260439f},
-std::array<float,2>{0.714410663f, 0.731878877f},
-std::array<float,2>{0.0564317964f, 0.269410074f},
-std::array<float,2>{0.129273683f, 0.514220238f},
-std::array<float,2>{0.621054828f, 0.425290048f},
-std::array<float,2>{0.897608817f, 0.795700252f},
-std::array<float,2>{0.309801519f, 0.237848952f},
-std::array<float,2>{0.0729561448f, 0.855687618f},
-std::array<float,2>{0.656073332f, 0.1738282f},
-std::array<float,2>{0.845435441f, 0.610055447f},
-std::array<float,2>{0.39339605f, 0.447318763f},
-std::array<float,2>{0.339515805f, 0.636680722f},
-std::array<float,2>{0.979088783f, 0.335480034f},
-std::array<float,2>{0.509152114f, 0.918732822f},
-std::array<float,2>{0.192309529f, 0.081782043f},
-std::array<float,2>{0.368547589f, 0.933476269f},
-std::array<float,2>{0.957273841f, 0.0762845725f},
-std::array<float,2>{0.554257035f, 0.642280161f},
-std::array<float,2>{0.239814118f, 0.313898712f},
-std::array<float,2>{0.103303313f, 0.606762111f},
-std::array<float,2>{0.663023412f, 0.467444539f},
-std::array<float,2>{0.83649534f, 0.866944373f},
-std::array<float,2>{0.409335017f, 0.160208285f},
-std::array<float,2>{0.180755064f, 0.80814743f},
-std::array<float,2>{0.570425153f, 0.232818723f},
-std::array<float,2>{0.916848898f, 0.517363191f},
-std::array<float,2>{0.27878499f, 0.40997988f},
-std::array<float,2>{0.457270354f, 0.743035078f},
-std::array<float,2>{0.758604765f, 0.263397217f},
-std::array<float,2>{0.74445951f, 0.944506288f},
-std::array<float,2>{0.00904765911f, 0.0260898527f},
-std::array<float,2>{0.377886355f, 0.827348709f},
-std::array<float,2>{0.867917776f, 0.156109124f},
-std::array<float,2>{0.638346016f, 0.573749304f},
-std::array<float,2>{0.0824678987f, 0.499519318f},
-std::array<float,2>{0.21154657f, 0.658829749f},
-std::array<float,2>{0.515893996f, 0.363060832f},
-std::array<float,2>{0.988420367f, 0.905564487f},
-std::array<float,2>{0.312661439f, 0.105673827f},
-std::array<float,2>{0.0399935432f, 0.971559823f},
-std::array<float,2>{0.702197611f, 0.0511290096f},
-std::array<float,2>{0.812306881f, 0.705478907f},
-std::array<float,2>{0.476813465f, 0.283847243f},
-std::array<float,2>{0.29664427f, 0.534971118f},
-std::array<float,2>{0.879424393f, 0.398592561f},
-std::array<float,2>{0.604962349f, 0.777854323f},
-std::array<float,2>{0.155375347f, 0.214640811f},
-std::array<float,2>{0.357099771f, 0.797007322f},
-std::array<float,2>{0.946367621f, 0.224573314f},
-std::array<float,2>{0.53623426f, 0.52355969f},
-std::array<float,2>{0.227784574f, 0.418625742f},
-std::array<float,2>{0.109489083f, 0.741844296f},
-std::array<float,2>{0.685217559f, 0.25674963f},
-std::array<float,2>{0.821754992f, 0.949926913f},
-std::array<float,2>{0.433824837f, 0.0202566255f},
-std::array<float,2>{0.16190742f, 0.925183237f},
-std::array<float,2>{0.592359006f, 0.0702540204f},
-std::array<float,2>{0.936246753f, 0.65153724f},
-std::array<float,2>{0.264691025f, 0.326873094f},
-std::array<float,2>{0.438434213f, 0.596071124f},
-std::array<float,2>{0.767740011f, 0.459417731f},
-std::array<float,2>{0.731997013f, 0.868171632f},
-std::array<float,2>{0.0238334313f, 0.164745539f},
-std::array<float,2>{0.398177475f, 0.979142725f},
-std::array<float,2>{0.848221421f, 0.0584373102f},
-std::array<float,2>{0.648643196f, 0.717868447f},
-std::array<float,2>{0.0751368701f, 0.29331851f},
-std::array<float,2>{0.188367292f, 0.543443441f},
-std::array<float,2>{0.514155626f, 0.392434627f},
-std::array<float,2>{0.983018696f, 0.770860672f},
-std::array<float,2>{0.339940399f, 0.205665842f},
-std::array<float,2>{0.05934681f, 0.813073754f},
-std::array<float,2>{0.716098487f, 0.144983813f},
-std::array<float,2>{0.787763894f, 0.568041861f},
-std::array<float,2>{0.490493774f, 0.489876688f},
-std::array<float,2>{0.307164639f, 0.668312609f},
-std::array<float,2>{0.891052961f, 0.372768849f},
-std::array<float,2>{0.624832094f, 0.890942395f},
-std::array<float,2>{0.125844344f, 0.0960258991f},
-std::array<float,2>{0.273618281f, 0.88592428f},
-std::array<float,2>{0.920766294f, 0.118584566f},
-std::array<float,2>{0.577107847f, 0.679455221f},
-std::array<float,2>{0.185775623f, 0.358281165f},
-std::array<float,2>{0.0128216753f, 0.583001852f},
-std::array<float,2>{0.749334276f, 0.475504726f},
-std::array<float,2>{0.765156627f, 0.841863811f},
-std::array<float,2>{0.453128755f, 0.139064908f},
-std::array<float,2>{0.235951692f, 0.764522254f},
-std::array<float,2>{0.547194958f, 0.195063144f},
-std::array<float,2>{0.954965293f, 0.561650097f},
-std::array<float,2>{0.371574074f, 0.384342968f},
-std::array<float,2>{0.412641376f, 0.695752442f},
-std::array<float,2>{0.842287958f, 0.29877919f},
-std::array<float,2>{0.65670073f, 0.984437704f},
-std::array<float,2>{0.109294213f, 0.0377704874f},
-std::array<float,2>{0.481005549f, 0.84799087f},
-std::array<float,2>{0.80542326f, 0.183737233f},
-std::array<float,2>{0.696729362f, 0.618693054f},
-std::array<float,2>{0.0437525958f, 0.444908977f},
-std::array<float,2>{0.151223764f, 0.629437804f},
-std::array<float,2>{0.606755316f, 0.340234101f},
-std::array<float,2>{0.876107097f, 0.912949622f},
-std::array<float,2>{0.290764093f, 0.0873905569f},
-std::array<float,2>{0.0795345604f, 0.963949502f},
-std::array<float,2>{0.633779049f, 0.0142900003f},
-std::array<float,2>{0.873708785f, 0.719506204f},
-std::array<float,2>{0.379808903f, 0.277884036f},
-std::array<float,2>{0.319766939f, 0.502344728f},
-std::array<float,2>{0.986890912f, 0.433629245f},
-std::array<float,2>{0.522822022f, 0.781663001f},
-std::array<float,2>{0.218403906f, 0.247473359f},
-std::array<float,2>{0.283765256f, 0.834824502f},
-std::array<float,2>{0.890532494f, 0.12954329f},
-std::array<float,2>{0.596435368f, 0.591055989f},
-std::array<float,2>{0.140908793f, 0.484029263f},
-std::array<float,2>{0.033484403f, 0.686390281f},
-std::array<float,2>{0.695170105f, 0.350735456f},
-std::array<float,2>{0.797378719f, 0.881881654f},
-std::array<float,2>{0.46946767f, 0.116418689f},
-std::array<float,2>{0.20457539f, 0.994434357f},
-std::array<float,2>{0.528041065f, 0.0395329669f},
-std::array<float,2>{0.999187887f, 0.69141233f},
-std::array<float,2>{0.325188696f, 0.312073916f},
-std::array<float,2>{0.390553296f, 0.551795006f},
-std::array<float,2>{0.861299753f, 0.382103711f},
-std::array<float,2>{0.62633568f, 0.75216186f},
-std::array<float,2>{0.0884152427f, 0.202159077f},
-std::array<float,2>{0.4622733f, 0.916283488f},
-std::array<float,2>{0.752400517f, 0.0842439011f},
-std::array<float,2>{0.739695013f, 0.639032662f},
-std::array<float,2>{0.00291272788f, 0.331500173f},
-std::array<float,2>{0.179127544f, 0.615536034f},
-std::array<float,2>{0.564898908f, 0.45284012f},
-std::array<float,2>{0.913794577f, 0.854026258f},
-std::array<float,2>{0.272987157f, 0.179455608f},
-std::array<float,2>{0.0966685489f, 0.792595446f},
-std::array<float,2>{0.670738101f, 0.242178395f},
-std::array<float,2>{0.831731498f, 0.510137677f},
-std::array<float,2>{0.417031765f, 0.428995132f},
-std::array<float,2>{0.364219189f, 0.729523718f},
-std::array<float,2>{0.963320196f, 0.270343393f},
-std::array<float,2>{0.559032917f, 0.955733895f},
-std::array<float,2>{0.244291127f, 0.00510024838f},
-std::array<float,2>{0.335573643f, 0.940137208f},
-std::array<float,2>{0.97282517f, 0.0291094184f},
-std::array<float,2>{0.501945555f, 0.748604238f},
-std::array<float,2>{0.202221408f, 0.258203566f},
-std::array<float,2>{0.0694850013f, 0.521862149f},
-std::array<float,2>{0.647360802f, 0.410699159f},
-std::array<float,2>{0.856075525f, 0.812172711f},
-std::array<float,2>{0.399289638f, 0.22793828f},
-std::array<float,2>{0.133424535f, 0.862580776f},
-std::array<float,2>{0.61160326f, 0.158553451f},
-std::array<float,2>{0.898851275f, 0.603415847f},
-std::array<float,2>{0.299452841f, 0.464235753f},
-std::array<float,2>{0.494676799f, 0.647047698f},
-std::array<float,2>{0.795142591f, 0.319536448f},
-std::array<float,2>{0.704474092f, 0.935255468f},
-std::array<float,2>{0.0489352867f, 0.0717532486f},
-std::array<float,2>{0.429210037f, 0.773727477f},
-std::array<float,2>{0.819088578f, 0.216119543f},
-std::array<float,2>{0.674400389f, 0.537204742f},
-std::array<float,2>{0.121757641f, 0.406194687f},
-std::array<float,2>{0.222328424f, 0.708644629f},
-std::array<float,2>{0.543047547f, 0.286472648f},
-std::array<float,2>{0.942448378f, 0.972722411f},
-std::array<float,2>{0.345636994f, 0.0496836528f},
-std::array<float,2>{0.0225417204f, 0.899706483f},
-std::array<float,2>{0.719629049f, 0.104748316f},
-std::array<float,2>{0.778647482f, 0.661372483f},
-std::array<float,2>{0.449951828f, 0.36501655f},
-std::array<float,2>{0.254236668f, 0.57453984f},
-std::array<float,2>{0.922090054f, 0.493467599f},
-std::array<float,2>{0.584715068f, 0.820557475f},
-std::array<float,2>{0.164534345f, 0.150353104f},
-std::array<float,2>{0.361177593f, 0.819194198f},
-std::array<float,2>{0.96743077f, 0.143393293f},
-std::array<float,2>{0.556667328f, 0.564914525f},
-std::array<float,2>{0.247534037f, 0.484813303f},
-std::array<float,2>{0.100095071f, 0.665754318f},
-std::array<float,2>{0.664414883f, 0.368797928f},
-std::array<float,2>{0.835197687f, 0.89825511f},
-std::array<float,2>{0.418183178f, 0.101235665f},
-std::array<float,2>{0.174852058f, 0.982674539f},
-std::array<float,2>{0.569994271f, 0.0590011179f},
-std::array<float,2>{0.90817678f, 0.71207428f},
-std::array<float,2>{0.268289715f, 0.291119546f},
-std::array<float,2>{0.466982871f, 0.542285025f},
-std::array<float,2>{0.754800618f, 0.39671725f},
-std::array<float,2>{0.736132979f, 0.769228935f},
-std::array<float,2>{0.00507824169f, 0.209683791f},
-std::array<float,2>{0.383026898f, 0.926605284f},
-std::array<float,2>{0.863446593f, 0.0627644658f},
-std::array<float,2>{0.632238746f, 0.653979063f},
-std::array<float,2>{0.0905375704f, 0.322976947f},
-std::array<float,2>{0.208898202f, 0.599356532f},
-std::array<float,2>{0.52623111f, 0.455871791f},
-std::array<float,2>{0.992271066f, 0.874691188f},
-std::array<float,2>{0.322034597f, 0.169430301f},
-std::array<float,2>{0.0365177765f, 0.804390967f},
-std::array<float,2>{0.690007865f, 0.219862089f},
-std::array<float,2>{0.801169932f, 0.528236508f},
-std::array<float,2>{0.473675668f, 0.415101171f},
-std::array<float,2>{0.287033319f, 0.73538965f},
-std::array<float,2>{0.885217965f, 0.250149459f},
-std::array<float,2>{0.59919107f, 0.945559025f},
-std::array<float,2>{0.145034865f, 0.0165121667f},
-std::array<float,2>{0.252821803f, 0.966111362f},
-std::array<float,2>{0.928522468f, 0.0104932254f},
-std::array<float,2>{0.579463482f, 0.726359308f},
-std::array<float,2>{0.171349809f, 0.274656653f},
-std::array<float,2>{0.0164852738f, 0.505844831f},
-std::array<float,2>{0.725976944f, 0.43179363f},
-std::array<float,2>{0.774557114f, 0.787500679f},
-std::array<float,2>{0.447079152f, 0.244266093f},
-std::array<float,2>{0.225527883f, 0.845667541f},
-std::array<float,2>{0.542386711f, 0.182548061f},
-std::array<float,2>{0.94108659f, 0.621525943f},
-std::array<float,2>{0.351275414f, 0.439033926f},
-std::array<float,2>{0.421984881f, 0.627711058f},
-std::array<float,2>{0.814802229f, 0.336935252f},
-std::array<float,2>{0.677720129f, 0.909898162f},
-std::array<float,2>{0.118265055f, 0.0932261646f},
-std::array<float,2>{0.497025788f, 0.758055329f},
-std::array<float,2>{0.789119542f, 0.19008559f},
-std::array<float,2>{0.707223058f, 0.557287633f},
-std::array<float,2>{0.0508156046f, 0.387981117f},
-std::array<float,2>{0.139413521f, 0.700842857f},
-std::array<float,2>{0.616459548f, 0.301849693f},
-std::array<float,2>{0.903142929f, 0.990080953f},
-std::array<float,2>{0.301566064f, 0.0324119516f},
-std::array<float,2>{0.0661855787f, 0.888380826f},
-std::array<float,2>{0.641666651f, 0.123479836f},
-std::array<float,2>{0.853319228f, 0.673349917f},
-std::array<float,2>{0.406241328f, 0.352580518f},
-std::array<float,2>{0.328672171f, 0.57882762f},
-std::array<float,2>{0.971103013f, 0.471724987f},
-std::array<float,2>{0.50493449f, 0.839767396f},
-std::array<float,2>{0.196572259f, 0.13598761f},
-std::array<float,2>{0.310826212f, 0.79370445f},
-std::array<float,2>{0.895037234f, 0.235084489f},
-std::array<float,2>{0.618672669f, 0.513353407f},
-std::array<float,2>{0.130971208f, 0.422336936f},
-std::array<float,2>{0.0573041365f, 0.734167695f},
-std::array<float,2>{0.711152196f, 0.266536623f},
-std::array<float,2>{0.782822013f, 0.960910678f},
-std::array<float,2>{0.484476358f, 0.00272917794f},
-std::array<float,2>{0.194535911f, 0.921746373f},
-std::array<float,2>{0.510180593f, 0.0795145854f},
-std::array<float,2>{0.977308929f, 0.632982433f},
-std::array<float,2>{0.335996658f, 0.333276093f},
-std::array<float,2>{0.39223063f, 0.612816632f},
-std::array<float,2>{0.847192883f, 0.445848227f},
-std::array<float,2>{0.653646708f, 0.858149409f},
-std::array<float,2>{0.0708089471f, 0.172213554f},
-std::array<float,2>{0.44336471f, 0.997548103f},
-std::array<float,2>{0.769904256f, 0.0435393304f},
-std::array<float,2>{0.727146685f, 0.689740419f},
-std::array<float,2>{0.0275131557f, 0.307665348f},
-std::array<float,2>{0.159860834f, 0.548836708f},
-std::array<float,2>{0.587930143f, 0.375124514f},
-std::array<float,2>{0.933056116f, 0.757489085f},
-std::array<float,2>{0.258562773f, 0.196327552f},
-std::array<float,2>{0.116588153f, 0.831469297f},
-std::array<float,2>{0.680426598f, 0.128378078f},
-std::array<float,2>{0.82481122f, 0.58927834f},
-std::array<float,2>{0.431726217f, 0.478977293f},
-std::array<float,2>{0.352963239f, 0.680736423f},
-std::array<float,2>{0.949640691f, 0.345201075f},
-std::array<float,2>{0.53167069f, 0.875809908f},
-std::array<float,2>{0.231633529f, 0.11094252f},
-std::array<float,2>{0.314704806f, 0.90324986f},
-std::array<float,2>{0.990367889f, 0.108326808f},
-std::array<float,2>{0.518813372f, 0.657296836f},
-std::array<float,2>{0.214756444f, 0.359580487f},
-std::array<float,2>{0.0856629238f, 0.572095037f},
-std::array<float,2>{0.639095664f, 0.49636066f},
-std::array<float,2>{0.870528996f, 0.825505793f},
-std::array<float,2>{0.37624523f, 0.153950125f},
-std::array<float,2>{0.152489185f, 0.780772448f},
-std::array<float,2>{0.603034556f, 0.211220384f},
-std::array<float,2>{0.882271826f, 0.531918526f},
-std::array<float,2>{0.294665098f, 0.40042749f},
-std::array<float,2>{0.480182439f, 0.704148233f},
-std::array<float,2>{0.809512973f, 0.282642961f},
-std::array<float,2>{0.699487567f, 0.970353842f},
-std::array<float,2>{0.0425835177f, 0.0539142042f},
-std::array<float,2>{0.406521648f, 0.864081502f},
-std::array<float,2>{0.838124037f, 0.162806988f},
-std::array<float,2>{0.66129905f, 0.608611107f},
-std::array<float,2>{0.103861377f, 0.465323895f},
-std::array<float,2>{0.24213317f, 0.642800868f},
-std::array<float,2>{0.552207053f, 0.316340387f},
-std::array<float,2>{0.959266841f, 0.931302607f},
-std::array<float,2>{0.369803011f, 0.075257808f},
-std::array<float,2>{0.00992850773f, 0.941633344f},
-std::array<float,2>{0.742389381f, 0.0239474159f},
-std::array<float,2>{0.759793282f, 0.744806349f},
-std::array<float,2>{0.460678726f, 0.265329927f},
-std::array<float,2>{0.279753983f, 0.517983258f},
-std::array<float,2>{0.915829003f, 0.406662226f},
-std::array<float,2>{0.573168576f, 0.806001723f},
-std::array<float,2>{0.181718573f, 0.231990948f},
-std::array<float,2>{0.342530519f, 0.773013532f},
-std::array<float,2>{0.98178643f, 0.204444423f},
-std::array<float,2>{0.513394892f, 0.545567572f},
-std::array<float,2>{0.190834448f, 0.393891126f},
-std::array<float,2>{0.0768941939f, 0.715426326f},
-std::array<float,2>{0.650855541f, 0.296112061f},
-std::array<float,2>{0.851259649f, 0.976746857f},
-std::array<float,2>{0.396152049f, 0.0563961715f},
-std::array<float,2>{0.12804547f, 0.893215835f},
-std::array<float,2>{0.621623456f, 0.0937644541f},
-std::array<float,2>{0.893012524f, 0.671488285f},
-std::array<float,2>{0.304825991f, 0.374433368f},
-std::array<float,2>{0.489671946f, 0.569666147f},
-std::array<float,2>{0.787075222f, 0.49048233f},
-std::array<float,2>{0.718547404f, 0.815124869f},
-std::array<float,2>{0.0610839762f, 0.147175565f},
-std::array<float,2>{0.436869442f, 0.951304376f},
-std::array<float,2>{0.823555291f, 0.0230405852f},
-std::array<float,2>{0.686132073f, 0.739235818f},
-std::array<float,2>{0.113241106f, 0.254126966f},
-std::array<float,2>{0.228760719f, 0.525763333f},
-std::array<float,2>{0.538990498f, 0.420906872f},
-std::array<float,2>{0.94728446f, 0.799629271f},
-std::array<float,2>{0.358100891f, 0.225611821f},
-std::array<float,2>{0.0261947978f, 0.870745361f},
-std::array<float,2>{0.7339288f, 0.167813182f},
-std::array<float,2>{0.766432166f, 0.595201254f},
-std::array<float,2>{0.441217035f, 0.457282931f},
-std::array<float,2>{0.262515962f, 0.649356306f},
-std::array<float,2>{0.9349038f, 0.324945241f},
-std::array<float,2>{0.590941489f, 0.92217201f},
-std::array<float,2>{0.163385153f, 0.0664957538f},
-std::array<float,2>{0.292635322f, 0.911930323f},
-std::array<float,2>{0.877135277f, 0.0894935727f},
-std::array<float,2>{0.607603073f, 0.631356716f},
-std::array<float,2>{0.149834812f, 0.34264943f},
-std::array<float,2>{0.0466211438f, 0.620261014f},
-std::array<float,2>{0.697360933f, 0.443052262f},
-std::array<float,2>{0.808056355f, 0.851363897f},
-std::array<float,2>{0.484072357f, 0.18572478f},
-std::array<float,2>{0.215772063f, 0.78336668f},
-std::array<float,2>{0.519883156f, 0.249729171f},
-std::array<float,2>{0.98604387f, 0.500742018f},
-std::array<float,2>{0.317177683f, 0.437118113f},
-std::array<float,2>{0.381136507f, 0.722492754f},
-std::array<float,2>{0.872093856f, 0.281010777f},
-std::array<float,2>{0.635306299f, 0.962032497f},
-std::array<float,2>{0.0819436237f, 0.011896871f},
-std::array<float,2>{0.455488414f, 0.840650439f},
-std::array<float,2>{0.762469172f, 0.137056723f},
-std::array<float,2>{0.747205257f, 0.584628999f},
-std::array<float,2>{0.0155000892f, 0.473808199f},
-std::array<float,2>{0.183908567f, 0.676288247f},
-std::array<float,2>{0.574540198f, 0.356794894f},
-std::array<float,2>{0.919176698f, 0.884413421f},
-std::array<float,2>{0.276028037f, 0.121069491f},
-std::array<float,2>{0.105702423f, 0.988191187f},
-std::array<float,2>{0.659557045f, 0.035557583f},
-std::array<float,2>{0.841007948f, 0.69795531f},
-std::array<float,2>{0.41052565f, 0.300495148f},
-std::array<float,2>{0.373085797f, 0.559896827f},
-std::array<float,2>{0.956677675f, 0.384935498f},
-std::array<float,2>{0.54943949f, 0.761943698f},
-std::array<float,2>{0.237059206f, 0.192497805f},
-std::array<float,2>{0.27146256f, 0.85282439f},
-std::array<float,2>{0.91028136f, 0.17735061f},
-std::array<float,2>{0.563776553f, 0.615143239f},
-std::array<float,2>{0.176376626f, 0.450338513f},
-std::array<float,2>{0.00125724124f, 0.637421072f},
-std::array<float,2>{0.741016209f, 0.32937324f},
-std::array<float,2>{0.751572907f, 0.914401114f},
-std::array<float,2>{0.464395523f, 0.0828058347f},
-std::array<float,2>{0.243295908f, 0.95389092f},
-std::array<float,2>{0.56188792f, 0.00654696254f},
-std::array<float,2>{0.961900413f, 0.728287995f},
-std::array<float,2>{0.365901023f, 0.271730661f},
-std::array<float,2>{0.415035993f, 0.509748995f},
-std::array<float,2>{0.830071568f, 0.426014155f},
-std::array<float,2>{0.668638647f, 0.790939271f},
-std::array<float,2>{0.0939718932f, 0.239893377f},
-std::array<float,2>{0.471467882f, 0.879459739f},
-std::array<float,2>{0.799502432f, 0.114967205f},
-std::array<float,2>{0.692214191f, 0.684641659f},
-std::array<float,2>{0.0330236964f, 0.348788351f},
-std::array<float,2>{0.14319551f, 0.592384934f},
-std::array<float,2>{0.595533848f, 0.481648535f},
-std::array<float,2>{0.887825251f, 0.832173765f},
-std::array<float,2>{0.282339752f, 0.132625937f},
-std::array<float,2>{0.0877375528f, 0.751873195f},
-std::array<float,2>{0.628774524f, 0.200290427f},
-std::array<float,2>{0.862867534f, 0.55295682f},
-std::array<float,2>{0.388575315f, 0.378959626f},
-std::array<float,2>{0.327296108f, 0.693734169f},
-std::array<float,2>{0.997558296f, 0.310518116f},
-std::array<float,2>{0.530955195f, 0.993756711f},
-std::array<float,2>{0.206382617f, 0.0425990969f},
-std::array<float,2>{0.346421033f, 0.976514041f},
-std::array<float,2>{0.944060624f, 0.0488013104f},
-std::array<float,2>{0.545478404f, 0.70921725f},
-std::array<float,2>{0.219054654f, 0.287211865f},
-std::array<float,2>{0.123643607f, 0.536084354f},
-std::array<float,2>{0.673607051f, 0.403519303f},
-std::array<float,2>{0.81673193f, 0.776389182f},
-std::array<float,2>{0.427432448f, 0.217351288f},
-std::array<float,2>{0.167580679f, 0.82282418f},
-std::array<float,2>{0.582085431f, 0.151273504f},
-std::array<float,2>{0.92392832f, 0.577279747f},
-std::array<float,2>{0.257291555f, 0.495152235f},
-std::array<float,2>{0.452915341f, 0.662650585f},
-std::array<float,2>{0.779661953f, 0.365441203f},
-std::array<float,2>{0.722105324f, 0.900600493f},
-std::array<float,2>{0.0211192835f, 0.101775639f},
-std::array<float,2>{0.401341408f, 0.809994519f},
-std::array<float,2>{0.857668579f, 0.229713827f},
-std::array<float,2>{0.645596564f, 0.520122766f},
-std::array<float,2>{0.0681798756f, 0.412557006f},
-std::array<float,2>{0.199717045f, 0.747438729f},
-std::array<float,2>{0.503047228f, 0.260162413f},
-std::array<float,2>{0.975415528f, 0.939356029f},
-std::array<float,2>{0.332374722f, 0.0302636344f},
-std::array<float,2>{0.0472205877f, 0.937202036f},
-std::array<float,2>{0.706763685f, 0.0734535232f},
-std::array<float,2>{0.794740975f, 0.64641875f},
-std::array<float,2>{0.493367642f, 0.3169083f},
-std::array<float,2>{0.297060043f, 0.604086995f},
-std::array<float,2>{0.900405347f, 0.462458938f},
-std::array<float,2>{0.611152887f, 0.860956848f},
-std::array<float,2>{0.135143399f, 0.157257035f},
-std::array<float,2>{0.331361115f, 0.838283718f},
-std::array<float,2>{0.96969986f, 0.134918526f},
-std::array<float,2>{0.507623076f, 0.579819918f},
-std::array<float,2>{0.197795048f, 0.471050143f},
-std::array<float,2>{0.0640745759f, 0.671883225f},
-std::array<float,2>{0.643489718f, 0.352282524f},
-std::array<float,2>{0.854356825f, 0.886819899f},
-std::array<float,2>{0.404283226f, 0.124334455f},
-std::array<float,2>{0.137084275f, 0.989109993f},
-std::array<float,2>{0.614783823f, 0.0322182029f},
-std::array<float,2>{0.904877961f, 0.699891686f},
-std::array<float,2>{0.303206742f, 0.300975233f},
-std::array<float,2>{0.499468386f, 0.557940185f},
-std::array<float,2>{0.792645991f, 0.387407392f},
-std::array<float,2>{0.710024953f, 0.759708345f},
-std::array<float,2>{0.0534525029f, 0.191172764f},
-std::array<float,2>{0.424864262f, 0.908356547f},
-std::array<float,2>{0.812668025f, 0.0919587538f},
-std::array<float,2>{0.678215206f, 0.6282444f},
-std::array<float,2>{0.119168699f, 0.336699426f},
-std::array<float,2>{0.223634303f, 0.622607589f},
-std::array<float,2>{0.539366245f, 0.438350677f},
-std::array<float,2>{0.938857794f, 0.844339669f},
-std::array<float,2>{0.347822398f, 0.182774499f},
-std::array<float,2>{0.0193417668f, 0.78839612f},
-std::array<float,2>{0.723237276f, 0.245445907f},
-std::array<float,2>{0.775548041f, 0.504716456f},
-std::array<float,2>{0.448244035f, 0.433116347f},
-std::array<float,2>{0.250466228f, 0.725318074f},
-std::array<float,2>{0.926899672f, 0.273488075f},
-std::array<float,2>{0.581637263f, 0.965065658f},
-std::array<float,2>{0.169282734f, 0.0111040538f},
-std::array<float,2>{0.288768947f, 0.94711858f},
-std::array<float,2>{0.884485662f, 0.017191086f},
-std::array<float,2>{0.600495338f, 0.734648585f},
-std::array<float,2>{0.147955075f, 0.251365185f},
-std::array<float,2>{0.0372703634f, 0.528691053f},
-std::array<float,2>{0.6887784f, 0.414852679f},
-std::array<float,2>{0.804060817f, 0.80347079f},
-std::array<float,2>{0.474815726f, 0.218824148f},
-std::array<float,2>{0.210671946f, 0.873081863f},
-std::array<float,2>{0.524647415f, 0.168297097f},
-std::array<float,2>{0.995199978f, 0.598249674f},
-std::array<float,2>{0.323940367f, 0.456121176f},
-std::array<float,2>{0.384956807f, 0.652926743f},
-std::array<float,2>{0.865237832f, 0.323952526f},
-std::array<float,2>{0.629762173f, 0.927126348f},
-std::array<float,2>{0.0920471698f, 0.0637080893f},
-std::array<float,2>{0.465765625f, 0.768181801f},
-std::array<float,2>{0.756266296f, 0.210341394f},
-std::array<float,2>{0.737526476f, 0.541793764f},
-std::array<float,2>{0.00706301583f, 0.397975773f},
-std::array<float,2>{0.172357902f, 0.711259782f},
-std::array<float,2>{0.568144083f, 0.292549551f},
-std::array<float,2>{0.908966601f, 0.984101295f},
-std::array<float,2>{0.266533911f, 0.0603667423f},
-std::array<float,2>{0.0977937281f, 0.896886826f},
-std::array<float,2>{0.667820036f, 0.100166298f},
-std::array<float,2>{0.83368504f, 0.664093316f},
-std::array<float,2>{0.420260698f, 0.367913187f},
-std::array<float,2>{0.362037957f, 0.565487862f},
-std::array<float,2>{0.96491915f, 0.485652119f},
-std::array<float,2>{0.555236816f, 0.819957972f},
-std::array<float,2>{0.248858005f, 0.144448921f},
-std::array<float,2>{0.277869046f, 0.805150807f},
-std::array<float,2>{0.917682052f, 0.230526477f},
-std::array<float,2>{0.572112262f, 0.519427657f},
-std::array<float,2>{0.179735765f, 0.407270908f},
-std::array<float,2>{0.00867431238f, 0.745573044f},
-std::array<float,2>{0.74526006f, 0.263829559f},
-std::array<float,2>{0.758888423f, 0.94256866f},
-std::array<float,2>{0.458298832f, 0.0247482955f},
-std::array<float,2>{0.239048228f, 0.930518329f},
-std::array<float,2>{0.552905798f, 0.0750961229f},
-std::array<float,2>{0.958711386f, 0.643768728f},
-std::array<float,2>{0.367774189f, 0.314903527f},
-std::array<float,2>{0.408703536f, 0.608109713f},
-std::array<float,2>{0.837273121f, 0.466303766f},
-std::array<float,2>{0.66403383f, 0.864425898f},
-std::array<float,2>{0.101809636f, 0.163679063f},
-std::array<float,2>{0.478359163f, 0.969127893f},
-std::array<float,2>{0.81113565f, 0.0529847629f},
-std::array<float,2>{0.701458693f, 0.703647971f},
-std::array<float,2>{0.0403180234f, 0.281758636f},
-std::array<float,2>{0.155135989f, 0.532394409f},
-std::array<float,2>{0.60370028f, 0.40157029f},
-std::array<float,2>{0.880381882f, 0.779870212f},
-std::array<float,2>{0.295766592f, 0.212292939f},
-std::array<float,2>{0.0839659199f, 0.82467854f},
-std::array<float,2>{0.637275517f, 0.152721345f},
-std::array<float,2>{0.86836791f, 0.570540071f},
-std::array<float,2>{0.378449351f, 0.497897714f},
-std::array<float,2>{0.314344496f, 0.656757355f},
-std::array<float,2>{0.989611983f, 0.360494912f},
-std::array<float,2>{0.516610742f, 0.904238939f},
-std::array<float,2>{0.212255269f, 0.109179378f},
-std::array<float,2>{0.353535742f, 0.876303971f},
-std::array<float,2>{0.952559292f, 0.109855674f},
-std::array<float,2>{0.53359741f, 0.680176675f},
-std::array<float,2>{0.233398005f, 0.344079345f},
-std::array<float,2>{0.113631457f, 0.588324845f},
-std::array<float,2>{0.682402492f, 0.480169892f},
-std::array<float,2>{0.827415705f, 0.830647886f},
-std::array<float,2>{0.429945022f, 0.127085447f},
-std::array<float,2>{0.157181591f, 0.755977869f},
-std::array<float,2>{0.586926997f, 0.195975244f},
-std::array<float,2>{0.931297243f, 0.550096333f},
-std::array<float,2>{0.260154307f, 0.376095712f},
-std::array<float,2>{0.442771077f, 0.690754652f},
-std::array<float,2>{0.772984862f, 0.307505161f},
-std::array<float,2>{0.728788376f, 0.996662319f},
-std::array<float,2>{0.0301991384f, 0.0440878123f},
-std::array<float,2>{0.393699944f, 0.858897388f},
-std::array<float,2>{0.844658017f, 0.173167095f},
-std::array<float,2>{0.654581726f, 0.611701488f},
-std::array<float,2>{0.0739066973f, 0.446537822f},
-std::array<float,2>{0.192767933f, 0.634094238f},
-std::array<float,2>{0.508744717f, 0.332728565f},
-std::array<float,2>{0.979893029f, 0.919970989f},
-std::array<float,2>{0.338734597f, 0.0782887265f},
-std::array<float,2>{0.0556638204f, 0.959744871f},
-std::array<float,2>{0.713193297f, 0.00306772534f},
-std::array<float,2>{0.784259796f, 0.732983589f},
-std::array<float,2>{0.487779886f, 0.266990274f},
-std::array<float,2>{0.309234321f, 0.511892676f},
-std::array<float,2>{0.897209525f, 0.423402011f},
-std::array<float,2>{0.619765282f, 0.794588864f},
-std::array<float,2>{0.13082099f, 0.235802755f},
-std::array<float,2>{0.372297853f, 0.763287008f},
-std::array<float,2>{0.953148603f, 0.191732302f},
-std::array<float,2>{0.548248231f, 0.559055746f},
-std::array<float,2>{0.234377682f, 0.385757774f},
-std::array<float,2>{0.1080634f, 0.69848007f},
-std::array<float,2>{0.657832742f, 0.29954958f},
-std::array<float,2>{0.843736827f, 0.986908436f},
-std::array<float,2>{0.413966715f, 0.0364675634f},
-std::array<float,2>{0.18711412f, 0.883559525f},
-std::array<float,2>{0.577293217f, 0.119697236f},
-std::array<float,2>{0.921550453f, 0.677158237f},
-std::array<float,2>{0.275348455f, 0.355612367f},
-std::array<float,2>{0.454302996f, 0.58583647f},
-std::array<float,2>{0.763826489f, 0.473382354f},
-std::array<float,2>{0.748682141f, 0.841449797f},
-std::array<float,2>{0.0123752095f, 0.137925193f},
-std::array<float,2>{0.379903674f, 0.961707234f},
-std::array<float,2>{0.874628544f, 0.013185217f},
-std::array<float,2>{0.63441819f, 0.720932782f},
-std::array<float,2>{0.0790912509f, 0.280154109f},
-std::array<float,2>{0.216805935f, 0.501651049f},
-std::array<float,2>{0.521961868f, 0.435809493f},
-std::array<float,2>{0.987558007f, 0.784741342f},
-std::array<float,2>{0.319257438f, 0.248124555f},
-std::array<float,2>{0.0440979339f, 0.850109756f},
-std::array<float,2>{0.695692837f, 0.186988458f},
-std::array<float,2>{0.805883646f, 0.619335294f},
-std::array<float,2>{0.482021749f, 0.441785306f},
-std::array<float,2>{0.289254189f, 0.632807016f},
-std::array<float,2>{0.875075996f, 0.342965573f},
-std::array<float,2>{0.606220365f, 0.910306752f},
-std::array<float,2>{0.15159668f, 0.0883560926f},
-std::array<float,2>{0.264240801f, 0.92350024f},
-std::array<float,2>{0.93702656f, 0.0677216798f},
-std::array<float,2>{0.593466043f, 0.650371492f},
-std::array<float,2>{0.160276204f, 0.325451434f},
-std::array<float,2>{0.0253818985f, 0.594098866f},
-std::array<float,2>{0.731260717f, 0.458600432f},
-std::array<float,2>{0.769322634f, 0.869478464f},
-std::array<float,2>{0.439074814f, 0.166417956f},
-std::array<float,2>{0.22704275f, 0.800374448f},
-std::array<float,2>{0.535794199f, 0.224992186f},
-std::array<float,2>{0.945950985f, 0.526560187f},
-std::array<float,2>{0.356426477f, 0.420722902f},
-std::array<float,2>{0.434629977f, 0.739988565f},
-std::array<float,2>{0.820689559f, 0.255243629f},
-std::array<float,2>{0.683880389f, 0.952989101f},
-std::array<float,2>{0.110968575f, 0.0223519299f},
-std::array<float,2>{0.4918935f, 0.816260159f},
-std::array<float,2>{0.788162708f, 0.147694811f},
-std::array<float,2>{0.71539098f, 0.568740964f},
-std::array<float,2>{0.0605243184f, 0.491952658f},
-std::array<float,2>{0.126715571f, 0.670896828f},
-std::array<float,2>{0.623380899f, 0.373572409f},
-std::array<float,2>{0.891633928f, 0.893992901f},
-std::array<float,2>{0.308469176f, 0.095561102f},
-std::array<float,2>{0.0758523867f, 0.977721334f},
-std::array<float,2>{0.650111616f, 0.0549626239f},
-std::array<float,2>{0.849589407f, 0.716771722f},
-std::array<float,2>{0.397089452f, 0.295025229f},
-std::array<float,2>{0.341112405f, 0.546534002f},
-std::array<float,2>{0.983956814f, 0.392906874f},
-std::array<float,2>{0.515181959f, 0.771574795f},
-std::array<float,2>{0.189371154f, 0.203272358f},
-std::array<float,2>{0.300700873f, 0.860262215f},
-std::array<float,2>{0.899961352f, 0.157143891f},
-std::array<float,2>{0.612749219f, 0.605318904f},
-std::array<float,2>{0.13394767f, 0.461893648f},
-std::array<float,2>{0.0503499433f, 0.644665658f},
-std::array<float,2>{0.703141749f, 0.317487746f},
-std::array<float,2>{0.795907199f, 0.936139762f},
-std::array<float,2>{0.495517433f, 0.0722966939f},
-std::array<float,2>{0.201794803f, 0.938365579f},
-std::array<float,2>{0.500067174f, 0.0312482771f},
-std::array<float,2>{0.973641634f, 0.746390164f},
-std::array<float,2>{0.334276825f, 0.261389643f},
-std::array<float,2>{0.399736762f, 0.520635366f},
-std::array<float,2>{0.857348621f, 0.413339466f},
-std::array<float,2>{0.64818418f, 0.808838546f},
-std::array<float,2>{0.0689165369f, 0.228638709f},
-std::array<float,2>{0.451148629f, 0.901400387f},
-std::array<float,2>{0.777587652f, 0.102747865f},
-std::array<float,2>{0.720401525f, 0.66343832f},
-std::array<float,2>{0.0218579806f, 0.367009073f},
-std::array<float,2>{0.165140554f, 0.576480508f},
-std::array<float,2>{0.585157037f, 0.49487415f},
-std::array<float,2>{0.923617184f, 0.82410866f},
-std::array<float,2>{0.255132854f, 0.151977614f},
-std::array<float,2>{0.122436687f, 0.775562763f},
-std::array<float,2>{0.675569594f, 0.218493536f},
-std::array<float,2>{0.819452047f, 0.536232829f},
-std::array<float,2>{0.427809477f, 0.402590483f},
-std::array<float,2>{0.344121903f, 0.710671484f},
-std::array<float,2>{0.942141235f, 0.288914293f},
-std::array<float,2>{0.544705212f, 0.975582719f},
-std::array<float,2>{0.221167699f, 0.0472666062f},
-std::array<float,2>{0.326152474f, 0.992503822f},
-std::array<float,2>{0.998716474f, 0.041257374f},
-std::array<float,2>{0.529250324f, 0.694823921f},
-std::array<float,2>{0.203820035f, 0.308669895f},
-std::array<float,2>{0.0889116153f, 0.554684579f},
-std::array<float,2>{0.625826895f, 0.38023749f},
-std::array<float,2>{0.859670579f, 0.750095606f},
-std::array<float,2>{0.389302135f, 0.200183764f},
-std::array<float,2>{0.141719818f, 0.833666146f},
-std::array<float,2>{0.59703666f, 0.131105959f},
-std::array<float,2>{0.888728499f, 0.593726158f},
-std::array<float,2>{0.284994781f, 0.48069948f},
-std::array<float,2>{0.46994254f, 0.683772326f},
-std::array<float,2>{0.798803449f, 0.347917944f},
-std::array<float,2>{0.694204688f, 0.88066715f},
-std::array<float,2>{0.0344229005f, 0.113616332f},
-std::array<float,2>{0.416681796f, 0.789876401f},
-std::array<float,2>{0.83093822f, 0.23862949f},
-std::array<float,2>{0.670924604f, 0.508421957f},
-std::array<float,2>{0.097490713f, 0.427697301f},
-std::array<float,2>{0.245911747f, 0.727499127f},
-std::array<float,2>{0.559966326f, 0.272494674f},
-std::array<float,2>{0.96480453f, 0.954492688f},
-std::array<float,2>{0.364263296f, 0.00718439883f},
-std::array<float,2>{0.00346281542f, 0.915319502f},
-std::array<float,2>{0.739110768f, 0.0838153437f},
-std::array<float,2>{0.75346607f, 0.638258398f},
-std::array<float,2>{0.461317778f, 0.328708321f},
-std::array<float,2>{0.272065163f, 0.614251673f},
-std::array<float,2>{0.912784398f, 0.449542463f},
-std::array<float,2>{0.565911651f, 0.852516413f},
-std::array<float,2>{0.178638503f, 0.176620632f},
-std::array<float,2>{0.349904269f, 0.846793294f},
-std::array<float,2>{0.939552784f, 0.180403963f},
-std::array<float,2>{0.541955531f, 0.624137163f},
-std::array<float,2>{0.226006851f, 0.439905941f},
-std::array<float,2>{0.117598549f, 0.625691414f},
-std::array<float,2>{0.676647544f, 0.338783175f},
-std::array<float,2>{0.815431833f, 0.907611847f},
-std::array<float,2>{0.423197031f, 0.0910428837f},
-std::array<float,2>{0.17063044f, 0.968724966f},
-std::array<float,2>{0.578403592f, 0.00788578577f},
-std::array<float,2>{0.929503739f, 0.724229217f},
-std::array<float,2>{0.253590494f, 0.275482863f},
-std::array<float,2>{0.445471764f, 0.506414354f},
-std::array<float,2>{0.773968041f, 0.430279136f},
-std::array<float,2>{0.724802852f, 0.786866665f},
-std::array<float,2>{0.0172277912f, 0.243011221f},
-std::array<float,2>{0.40487498f, 0.889521539f},
-std::array<float,2>{0.851928174f, 0.121099681f},
-std::array<float,2>{0.640716791f, 0.673973262f},
-std::array<float,2>{0.0644555837f, 0.354283273f},
-std::array<float,2>{0.195674181f, 0.581108391f},
-std::array<float,2>{0.504449069f, 0.469046772f},
-std::array<float,2>{0.972195804f, 0.837752342f},
-std::array<float,2>{0.330050677f, 0.133215696f},
-std::array<float,2>{0.0524799787f, 0.760740399f},
-std::array<float,2>{0.708852053f, 0.189313188f},
-std::array<float,2>{0.790829659f, 0.555473864f},
-std::array<float,2>{0.497128278f, 0.388974905f},
-std::array<float,2>{0.301862925f, 0.702766299f},
-std::array<float,2>{0.904248834f, 0.303782254f},
-std::array<float,2>{0.616113484f, 0.991811812f},
-std::array<float,2>{0.140368342f, 0.0340431444f},
-std::array<float,2>{0.269502103f, 0.982300103f},
-std::array<float,2>{0.906603694f, 0.0610926189f},
-std::array<float,2>{0.569146097f, 0.714087665f},
-std::array<float,2>{0.174351662f, 0.289580494f},
-std::array<float,2>{0.00428749714f, 0.540993273f},
-std::array<float,2>{0.734651208f, 0.396223664f},
-std::array<float,2>{0.755095959f, 0.76672852f},
-std::array<float,2>{0.468009919f, 0.208662793f},
-std::array<float,2>{0.247019336f, 0.816686392f},
-std::array<float,2>{0.558043063f, 0.142171144f},
-std::array<float,2>{0.968053222f, 0.562980413f},
-std::array<float,2>{0.359718025f, 0.486563861f},
-std::array<float,2>{0.419498414f, 0.666896164f},
-std::array<float,2>{0.834372878f, 0.370535761f},
-std::array<float,2>{0.665093899f, 0.895973623f},
-std::array<float,2>{0.101025619f, 0.0982469991f},
-std::array<float,2>{0.472820997f, 0.802297115f},
-std::array<float,2>{0.801877081f, 0.221814528f},
-std::array<float,2>{0.691367924f, 0.529777646f},
-std::array<float,2>{0.0355430432f, 0.416425377f},
-std::array<float,2>{0.145625263f, 0.737517357f},
-std::array<float,2>{0.597919703f, 0.25349471f},
-std::array<float,2>{0.885875285f, 0.948878288f},
-std::array<float,2>{0.285528362f, 0.018528305f},
-std::array<float,2>{0.0915923119f, 0.928489268f},
-std::array<float,2>{0.631624281f, 0.0661906525f},
-std::array<float,2>{0.864967167f, 0.65443629f},
-std::array<float,2>{0.384709597f, 0.321999937f},
-std::array<float,2>{0.321125388f, 0.60042423f},
-std::array<float,2>{0.993640184f, 0.454436719f},
-std::array<float,2>{0.526949465f, 0.872595072f},
-std::array<float,2>{0.207605317f, 0.171133563f},
-std::array<float,2>{0.293265283f, 0.77861017f},
-std::array<float,2>{0.881736338f, 0.213341475f},
-std::array<float,2>{0.601854205f, 0.53412503f},
-std::array<float,2>{0.154085845f, 0.399438381f},
-std::array<float,2>{0.0419094525f, 0.706319571f},
-std::array<float,2>{0.700981498f, 0.284444392f},
-std::array<float,2>{0.81002152f, 0.972165227f},
-std::array<float,2>{0.478902459f, 0.0523565672f},
-std::array<float,2>{0.213489741f, 0.904770255f},
-std::array<float,2>{0.518417478f, 0.106788062f},
-std::array<float,2>{0.991407156f, 0.660139143f},
-std::array<float,2>{0.316041529f, 0.361909539f},
-std::array<float,2>{0.375358939f, 0.572791815f},
-std::array<float,2>{0.870084882f, 0.49853152f},
-std::array<float,2>{0.639837444f, 0.826649427f},
-std::array<float,2>{0.0843490958f, 0.154515773f},
-std::array<float,2>{0.459899753f, 0.94398421f},
-std::array<float,2>{0.761617899f, 0.0263953544f},
-std::array<float,2>{0.743287385f, 0.744045377f},
-std::array<float,2>{0.010838965f, 0.26222682f},
-std::array<float,2>{0.183261007f, 0.515988529f},
-std::array<float,2>{0.573514938f, 0.408799082f},
-std::array<float,2>{0.914537311f, 0.807033002f},
-std::array<float,2>{0.280851185f, 0.234131947f},
-std::array<float,2>{0.105052203f, 0.865853786f},
-std::array<float,2>{0.660995305f, 0.161512092f},
-std::array<float,2>{0.838986039f, 0.605723083f},
-std::array<float,2>{0.408052802f, 0.46811986f},
-std::array<float,2>{0.370723546f, 0.640729666f},
-std::array<float,2>{0.960682988f, 0.312683403f},
-std::array<float,2>{0.550873578f, 0.931663632f},
-std::array<float,2>{0.24044615f, 0.0774149075f},
-std::array<float,2>{0.337829441f, 0.919515133f},
-std::array<float,2>{0.978069305f, 0.0806467012f},
-std::array<float,2>{0.511649549f, 0.634921491f},
-std::array<float,2>{0.194270775f, 0.334606946f},
-std::array<float,2>{0.0714437738f, 0.611021399f},
-std::array<float,2>{0.65318352f, 0.44897157f},
-std::array<float,2>{0.846190035f, 0.856751621f},
-std::array<float,2>{0.390915334f, 0.175688207f},
-std::array<float,2>{0.132170245f, 0.796086609f},
-std::array<float,2>{0.617207646f, 0.236737475f},
-std::array<float,2>{0.896017015f, 0.515602529f},
-std::array<float,2>{0.311955065f, 0.424458146f},
-std::array<float,2>{0.486196697f, 0.730692148f},
-std::array<float,2>{0.781726122f, 0.267924607f},
-std::array<float,2>{0.712853193f, 0.95826298f},
-std::array<float,2>{0.058121819f, 0.000198501264f},
-std::array<float,2>{0.433460951f, 0.829749763f},
-std::array<float,2>{0.825701594f, 0.126768023f},
-std::array<float,2>{0.681026399f, 0.586751461f},
-std::array<float,2>{0.115875348f, 0.477036804f},
-std::array<float,2>{0.230656058f, 0.682204425f},
-std::array<float,2>{0.533110261f, 0.346319884f},
-std::array<float,2>{0.950305283f, 0.878459752f},
-std::array<float,2>{0.351733267f, 0.113222793f},
-std::array<float,2>{0.0289315544f, 0.99984163f},
-std::array<float,2>{0.728232205f, 0.0461912677f},
-std::array<float,2>{0.771294534f, 0.688337326f},
-std::array<float,2>{0.444400132f, 0.306052029f},
-std::array<float,2>{0.259259015f, 0.548719287f},
-std::array<float,2>{0.932449102f, 0.377602249f},
-std::array<float,2>{0.588979959f, 0.755854905f},
-std::array<float,2>{0.15891698f, 0.197708845f},
-std::array<float,2>{0.31815207f, 0.782377183f},
-std::array<float,2>{0.984879076f, 0.246220648f},
-std::array<float,2>{0.521160543f, 0.503547668f},
-std::array<float,2>{0.216583252f, 0.434827447f},
-std::array<float,2>{0.080773592f, 0.719950676f},
-std::array<float,2>{0.63612324f, 0.278327644f},
-std::array<float,2>{0.871434033f, 0.963599622f},
-std::array<float,2>{0.382481307f, 0.0148136988f},
-std::array<float,2>{0.148969948f, 0.913088918f},
-std::array<float,2>{0.60874933f, 0.0863521174f},
-std::array<float,2>{0.877994835f, 0.630531788f},
-std::array<float,2>{0.291707754f, 0.341031343f},
-std::array<float,2>{0.483103752f, 0.617508531f},
-std::array<float,2>{0.807046652f, 0.443386912f},
-std::array<float,2>{0.698532224f, 0.849089146f},
-std::array<float,2>{0.0452504568f, 0.184611753f},
-std::array<float,2>{0.411880106f, 0.985422909f},
-std::array<float,2>{0.840164542f, 0.0381767415f},
-std::array<float,2>{0.658997774f, 0.697097063f},
-std::array<float,2>{0.107303075f, 0.297771633f},
-std::array<float,2>{0.237586185f, 0.561010301f},
-std::array<float,2>{0.549894273f, 0.38319838f},
-std::array<float,2>{0.955340564f, 0.765210271f},
-std::array<float,2>{0.374599308f, 0.19364354f},
-std::array<float,2>{0.0137373032f, 0.843234241f},
-std::array<float,2>{0.746284068f, 0.139943302f},
-std::array<float,2>{0.763524055f, 0.583337069f},
-std::array<float,2>{0.4567191f, 0.476046652f},
-std::array<float,2>{0.277009368f, 0.678536773f},
-std::array<float,2>{0.918208122f, 0.359331608f},
-std::array<float,2>{0.575796545f, 0.885517061f},
-std::array<float,2>{0.185070455f, 0.117649838f},
-std::array<float,2>{0.306181222f, 0.891966581f},
-std::array<float,2>{0.894084811f, 0.0973521024f},
-std::array<float,2>{0.622983932f, 0.669825375f},
-std::array<float,2>{0.126964733f, 0.371487707f},
-std::array<float,2>{0.0619149953f, 0.567195177f},
-std::array<float,2>{0.717468083f, 0.488423795f},
-std::array<float,2>{0.78609103f, 0.814429164f},
-std::array<float,2>{0.488533914f, 0.146102384f},
-std::array<float,2>{0.18947871f, 0.769569695f},
-std::array<float,2>{0.512005806f, 0.206143573f},
-std::array<float,2>{0.981129706f, 0.544876695f},
-std::array<float,2>{0.342867613f, 0.391104698f},
-std::array<float,2>{0.394976139f, 0.717558324f},
-std::array<float,2>{0.849695504f, 0.29475835f},
-std::array<float,2>{0.652340591f, 0.979962647f},
-std::array<float,2>{0.0781023279f, 0.0575743467f},
-std::array<float,2>{0.440262586f, 0.867694139f},
-std::array<float,2>{0.766841114f, 0.165570855f},
-std::array<float,2>{0.733256638f, 0.597076714f},
-std::array<float,2>{0.0272931531f, 0.459989578f},
-std::array<float,2>{0.163071781f, 0.651083708f},
-std::array<float,2>{0.589909256f, 0.32811752f},
-std::array<float,2>{0.934351623f, 0.924674928f},
-std::array<float,2>{0.263028592f, 0.0684975907f},
-std::array<float,2>{0.112200029f, 0.950566173f},
-std::array<float,2>{0.687458992f, 0.0206573624f},
-std::array<float,2>{0.823192596f, 0.740415394f},
-std::array<float,2>{0.436463207f, 0.25768134f},
-std::array<float,2>{0.35846442f, 0.524907887f},
-std::array<float,2>{0.948797703f, 0.419423878f},
-std::array<float,2>{0.537112594f, 0.798633099f},
-std::array<float,2>{0.230179802f, 0.223075867f},
-std::array<float,2>{0.256561607f, 0.822085381f},
-std::array<float,2>{0.925609231f, 0.148727745f},
-std::array<float,2>{0.583525717f, 0.576126754f},
-std::array<float,2>{0.166253656f, 0.492209136f},
-std::array<float,2>{0.0195657201f, 0.660886228f},
-std::array<float,2>{0.720765531f, 0.363988727f},
-std::array<float,2>{0.78115207f, 0.898940921f},
-std::array<float,2>{0.451372355f, 0.103886038f},
-std::array<float,2>{0.220514089f, 0.974358261f},
-std::array<float,2>{0.546433866f, 0.050628908f},
-std::array<float,2>{0.9445768f, 0.707508981f},
-std::array<float,2>{0.346936285f, 0.286029547f},
-std::array<float,2>{0.425945729f, 0.538597047f},
-std::array<float,2>{0.81750679f, 0.404425949f},
-std::array<float,2>{0.672394395f, 0.774843752f},
-std::array<float,2>{0.124223053f, 0.214916095f},
-std::array<float,2>{0.492752016f, 0.933599472f},
-std::array<float,2>{0.793944657f, 0.0703889877f},
-std::array<float,2>{0.705661297f, 0.648427844f},
-std::array<float,2>{0.0483189411f, 0.319152981f},
-std::array<float,2>{0.136124924f, 0.601698816f},
-std::array<float,2>{0.610333681f, 0.462995499f},
-std::array<float,2>{0.901955664f, 0.861333132f},
-std::array<float,2>{0.298763841f, 0.159986451f},
-std::array<float,2>{0.0671357214f, 0.81144011f},
-std::array<float,2>{0.644774437f, 0.22721982f},
-std::array<float,2>{0.859182596f, 0.52311331f},
-std::array<float,2>{0.401402682f, 0.411833435f},
-std::array<float,2>{0.333412677f, 0.749741018f},
-std::array<float,2>{0.976430655f, 0.259574115f},
-std::array<float,2>{0.502634227f, 0.9406358f},
-std::array<float,2>{0.20080854f, 0.0277507771f},
-std::array<float,2>{0.366321713f, 0.957028925f},
-std::array<float,2>{0.962185919f, 0.00425603706f},
-std::array<float,2>{0.561511695f, 0.72917676f},
-std::array<float,2>{0.242726088f, 0.27140215f},
-std::array<float,2>{0.0954948291f, 0.510888398f},
-std::array<float,2>{0.669495463f, 0.428512186f},
-std::array<float,2>{0.828208089f, 0.791233361f},
-std::array<float,2>{0.415662825f, 0.240416765f},
-std::array<float,2>{0.177638248f, 0.855251849f},
-std::array<float,2>{0.563273966f, 0.178414762f},
-std::array<float,2>{0.911757886f, 0.616211593f},
-std::array<float,2>{0.270484954f, 0.45200026f},
-std::array<float,2>{0.462921828f, 0.640562654f},
-std::array<float,2>{0.750270188f, 0.330080956f},
-std::array<float,2>{0.74128288f, 0.917824805f},
-std::array<float,2>{0.000248197641f, 0.0854257494f},
-std::array<float,2>{0.387172788f, 0.753058076f},
-std::array<float,2>{0.862176299f, 0.201446846f},
-std::array<float,2>{0.627491117f, 0.551208138f},
-std::array<float,2>{0.0862269476f, 0.381570905f},
-std::array<float,2>{0.205569252f, 0.693009615f},
-std::array<float,2>{0.529322624f, 0.311310381f},
-std::array<float,2>{0.99685657f, 0.995595634f},
-std::array<float,2>{0.326812893f, 0.040807534f},
-std::array<float,2>{0.0321975909f, 0.880890191f},
-std::array<float,2>{0.693230748f, 0.115323126f},
-std::array<float,2>{0.80070585f, 0.687234163f},
-std::array<float,2>{0.471740544f, 0.35015893f},
-std::array<float,2>{0.282053173f, 0.590209544f},
-std::array<float,2>{0.886909783f, 0.483246297f},
-std::array<float,2>{0.594462037f, 0.835240066f},
-std::array<float,2>{0.144127131f, 0.129938141f},
-std::array<float,2>{0.33835879f, 0.856958151f},
-std::array<float,2>{0.97999537f, 0.174814627f},
-std::array<float,2>{0.508005857f, 0.610612869f},
-std::array<float,2>{0.193200961f, 0.448245943f},
-std::array<float,2>{0.0733822435f, 0.635569155f},
-std::array<float,2>{0.654839516f, 0.334123194f},
-std::array<float,2>{0.843944371f, 0.918992758f},
-std::array<float,2>{0.394099325f, 0.0805568695f},
-std::array<float,2>{0.13026236f, 0.958685935f},
-std::array<float,2>{0.619151831f, 0.000760087569f},
-std::array<float,2>{0.89680779f, 0.731241465f},
-std::array<float,2>{0.30878678f, 0.26838693f},
-std::array<float,2>{0.488018781f, 0.514867604f},
-std::array<float,2>{0.785010397f, 0.423951328f},
-std::array<float,2>{0.713782132f, 0.796824336f},
-std::array<float,2>{0.0551333427f, 0.23699525f},
-std::array<float,2>{0.43043226f, 0.878183961f},
-std::array<float,2>{0.82773596f, 0.112658478f},
-std::array<float,2>{0.682001889f, 0.681709886f},
-std::array<float,2>{0.11405161f, 0.345850319f},
-std::array<float,2>{0.232687369f, 0.586214304f},
-std::array<float,2>{0.533693075f, 0.477308929f},
-std::array<float,2>{0.953108013f, 0.829166949f},
-std::array<float,2>{0.354051679f, 0.126225471f},
-std::array<float,2>{0.0293102823f, 0.754892826f},
-std::array<float,2>{0.729243279f, 0.198241919f},
-std::array<float,2>{0.772721529f, 0.547919631f},
-std::array<float,2>{0.443051279f, 0.377137959f},
-std::array<float,2>{0.260432065f, 0.687611222f},
-std::array<float,2>{0.93083334f, 0.306418955f},
-std::array<float,2>{0.587704301f, 0.999422431f},
-std::array<float,2>{0.156593308f, 0.0465871952f},
-std::array<float,2>{0.295245647f, 0.972523332f},
-std::array<float,2>{0.880337f, 0.0519072302f},
-std::array<float,2>{0.604241729f, 0.706699193f},
-std::array<float,2>{0.154521197f, 0.285129577f},
-std::array<float,2>{0.0406401753f, 0.533455193f},
-std::array<float,2>{0.701880932f, 0.400023162f},
-std::array<float,2>{0.810941279f, 0.779165149f},
-std::array<float,2>{0.477941543f, 0.213636771f},
-std::array<float,2>{0.212537274f, 0.82697314f},
-std::array<float,2>{0.517358303f, 0.155124739f},
-std::array<float,2>{0.989901662f, 0.572396457f},
-std::array<float,2>{0.313569486f, 0.498959333f},
-std::array<float,2>{0.377999961f, 0.659192145f},
-std::array<float,2>{0.86896503f, 0.361712843f},
-std::array<float,2>{0.637015045f, 0.904793561f},
-std::array<float,2>{0.0834452212f, 0.106977858f},
-std::array<float,2>{0.458791614f, 0.80760628f},
-std::array<float,2>{0.75938046f, 0.233701497f},
-std::array<float,2>{0.745962679f, 0.516384065f},
-std::array<float,2>{0.00806359109f, 0.408310473f},
-std::array<float,2>{0.180206984f, 0.743651032f},
-std::array<float,2>{0.57136488f, 0.261980742f},
-std::array<float,2>{0.917006969f, 0.943661988f},
-std::array<float,2>{0.277693719f, 0.0273191202f},
-std::array<float,2>{0.102493614f, 0.932438552f},
-std::array<float,2>{0.663348556f, 0.0779670998f},
-std::array<float,2>{0.837500691f, 0.641127229f},
-std::array<float,2>{0.408540994f, 0.313158661f},
-std::array<float,2>{0.367315084f, 0.606216311f},
-std::array<float,2>{0.958008885f, 0.468519837f},
-std::array<float,2>{0.553371906f, 0.865461171f},
-std::array<float,2>{0.238403052f, 0.161686555f},
-std::array<float,2>{0.265671402f, 0.767124534f},
-std::array<float,2>{0.908560872f, 0.208151728f},
-std::array<float,2>{0.56776458f, 0.540527046f},
-std::array<float,2>{0.172562063f, 0.395905316f},
-std::array<float,2>{0.00747992285f, 0.714569151f},
-std::array<float,2>{0.738099158f, 0.289419889f},
-std::array<float,2>{0.756718278f, 0.981625974f},
-std::array<float,2>{0.465037733f, 0.0607055984f},
-std::array<float,2>{0.248516545f, 0.896318555f},
-std::array<float,2>{0.555068791f, 0.0979559869f},
-std::array<float,2>{0.96559298f, 0.666401863f},
-std::array<float,2>{0.361546904f, 0.370736182f},
-std::array<float,2>{0.42058754f, 0.563161969f},
-std::array<float,2>{0.833485246f, 0.487129658f},
-std::array<float,2>{0.667243361f, 0.817133248f},
-std::array<float,2>{0.0985230282f, 0.141657725f},
-std::array<float,2>{0.475387812f, 0.948276639f},
-std::array<float,2>{0.804389179f, 0.0177105945f},
-std::array<float,2>{0.689414442f, 0.737910986f},
-std::array<float,2>{0.0377286114f, 0.253336161f},
-std::array<float,2>{0.147508219f, 0.530101597f},
-std::array<float,2>{0.599767506f, 0.416512698f},
-std::array<float,2>{0.883913398f, 0.801858127f},
-std::array<float,2>{0.2883358f, 0.222267672f},
-std::array<float,2>{0.0926563442f, 0.872196257f},
-std::array<float,2>{0.629274845f, 0.171548426f},
-std::array<float,2>{0.866093755f, 0.600004554f},
-std::array<float,2>{0.385314673f, 0.454974204f},
-std::array<float,2>{0.323477596f, 0.655086875f},
-std::array<float,2>{0.995744765f, 0.321531564f},
-std::array<float,2>{0.525220394f, 0.928065777f},
-std::array<float,2>{0.210285068f, 0.0658964068f},
-std::array<float,2>{0.348418057f, 0.907824576f},
-std::array<float,2>{0.939085901f, 0.0914021507f},
-std::array<float,2>{0.539912581f, 0.625318646f},
-std::array<float,2>{0.224471793f, 0.33809194f},
-std::array<float,2>{0.120026916f, 0.624991953f},
-std::array<float,2>{0.678269744f, 0.440367997f},
-std::array<float,2>{0.813398063f, 0.847438872f},
-std::array<float,2>{0.425439835f, 0.179815039f},
-std::array<float,2>{0.169539869f, 0.78622061f},
-std::array<float,2>{0.581409276f, 0.242292643f},
-std::array<float,2>{0.927512527f, 0.506084263f},
-std::array<float,2>{0.250551254f, 0.429715633f},
-std::array<float,2>{0.448968261f, 0.723659337f},
-std::array<float,2>{0.776271224f, 0.276066035f},
-std::array<float,2>{0.723070383f, 0.968209684f},
-std::array<float,2>{0.0189826321f, 0.00841543172f},
-std::array<float,2>{0.403381914f, 0.837389946f},
-std::array<float,2>{0.853841126f, 0.133448377f},
-std::array<float,2>{0.643003702f, 0.581949055f},
-std::array<float,2>{0.0638325587f, 0.469562918f},
-std::array<float,2>{0.197475553f, 0.674567997f},
-std::array<float,2>{0.507064939f, 0.353614569f},
-std::array<float,2>{0.969225645f, 0.889051318f},
-std::array<float,2>{0.331822872f, 0.12161348f},
-std::array<float,2>{0.0529858619f, 0.991520226f},
-std::array<float,2>{0.710471153f, 0.033688169f},
-std::array<float,2>{0.792250931f, 0.702564359f},
-std::array<float,2>{0.499733835f, 0.304394513f},
-std::array<float,2>{0.303670049f, 0.554738164f},
-std::array<float,2>{0.904399395f, 0.389377594f},
-std::array<float,2>{0.614385724f, 0.75989002f},
-std::array<float,2>{0.13736248f, 0.188769773f},
-std::array<float,2>{0.365133166f, 0.791584134f},
-std::array<float,2>{0.964072764f, 0.240846157f},
-std::array<float,2>{0.560521781f, 0.511440873f},
-std::array<float,2>{0.245423108f, 0.427783966f},
-std::array<float,2>{0.0967527479f, 0.728543878f},
-std::array<float,2>{0.671801448f, 0.270882279f},
-std::array<float,2>{0.830408871f, 0.956098378f},
-std::array<float,2>{0.416195363f, 0.00464393804f},
-std::array<float,2>{0.178169236f, 0.917313755f},
-std::array<float,2>{0.566150844f, 0.0858419687f},
-std::array<float,2>{0.912117302f, 0.639725447f},
-std::array<float,2>{0.271856159f, 0.330996543f},
-std::array<float,2>{0.461504936f, 0.61670512f},
-std::array<float,2>{0.753041565f, 0.451306283f},
-std::array<float,2>{0.73867029f, 0.854599893f},
-std::array<float,2>{0.00332334824f, 0.177904099f},
-std::array<float,2>{0.389145374f, 0.995882332f},
-std::array<float,2>{0.860158205f, 0.0402170494f},
-std::array<float,2>{0.62522614f, 0.692730427f},
-std::array<float,2>{0.0896845162f, 0.311005205f},
-std::array<float,2>{0.203328907f, 0.551730096f},
-std::array<float,2>{0.528562069f, 0.381167591f},
-std::array<float,2>{0.998358786f, 0.75345248f},
-std::array<float,2>{0.32537064f, 0.201690435f},
-std::array<float,2>{0.0350706391f, 0.835558951f},
-std::array<float,2>{0.693423629f, 0.130835161f},
-std::array<float,2>{0.798230708f, 0.590766251f},
-std::array<float,2>{0.470553368f, 0.482488513f},
-std::array<float,2>{0.284239858f, 0.686986923f},
-std::array<float,2>{0.889324784f, 0.349768907f},
-std::array<float,2>{0.597215295f, 0.881632984f},
-std::array<float,2>{0.142302901f, 0.116056509f},
-std::array<float,2>{0.255456626f, 0.898580253f},
-std::array<float,2>{0.922867358f, 0.104106642f},
-std::array<float,2>{0.585860729f, 0.660507441f},
-std::array<float,2>{0.165667742f, 0.363482028f},
-std::array<float,2>{0.0220737141f, 0.575246453f},
-std::array<float,2>{0.719775319f, 0.493085176f},
-std::array<float,2>{0.777992427f, 0.821445882f},
-std::array<float,2>{0.450492889f, 0.149070412f},
-std::array<float,2>{0.221225411f, 0.774997354f},
-std::array<float,2>{0.543996811f, 0.215534389f},
-std::array<float,2>{0.94152379f, 0.538565934f},
-std::array<float,2>{0.344470322f, 0.40501076f},
-std::array<float,2>{0.428487867f, 0.707729995f},
-std::array<float,2>{0.820282459f, 0.285363704f},
-std::array<float,2>{0.674823403f, 0.974089384f},
-std::array<float,2>{0.122580372f, 0.0501432084f},
-std::array<float,2>{0.496011168f, 0.862116635f},
-std::array<float,2>{0.796775281f, 0.159542099f},
-std::array<float,2>{0.703717709f, 0.602290332f},
-std::array<float,2>{0.0498586521f, 0.463701338f},
-std::array<float,2>{0.134759098f, 0.647879779f},
-std::array<float,2>{0.613000035f, 0.318633527f},
-std::array<float,2>{0.899684906f, 0.934091926f},
-std::array<float,2>{0.30028984f, 0.0709212497f},
-std::array<float,2>{0.0686782449f, 0.941135347f},
-std::array<float,2>{0.647846103f, 0.028172208f},
-std::array<float,2>{0.856889009f, 0.749199033f},
-std::array<float,2>{0.400323451f, 0.258855432f},
-std::array<float,2>{0.334659219f, 0.522870779f},
-std::array<float,2>{0.974282324f, 0.411229819f},
-std::array<float,2>{0.500854135f, 0.810935438f},
-std::array<float,2>{0.201303393f, 0.227025241f},
-std::array<float,2>{0.307782024f, 0.813531697f},
-std::array<float,2>{0.892343521f, 0.14562358f},
-std::array<float,2>{0.623845339f, 0.566856384f},
-std::array<float,2>{0.126378879f, 0.489026785f},
-std::array<float,2>{0.0599410161f, 0.668959975f},
-std::array<float,2>{0.715162516f, 0.371922463f},
-std::array<float,2>{0.789033473f, 0.892427027f},
-std::array<float,2>{0.491255432f, 0.0970124751f},
-std::array<float,2>{0.188908771f, 0.980227411f},
-std::array<float,2>{0.514896035f, 0.0567473769f},
-std::array<float,2>{0.983706892f, 0.716974735f},
-std::array<float,2>{0.341730446f, 0.294078529f},
-std::array<float,2>{0.396936417f, 0.544204772f},
-std::array<float,2>{0.848973513f, 0.391591132f},
-std::array<float,2>{0.649750352f, 0.770425022f},
-std::array<float,2>{0.0756663606f, 0.206668466f},
-std::array<float,2>{0.438885778f, 0.923959911f},
-std::array<float,2>{0.768745303f, 0.0689231008f},
-std::array<float,2>{0.730633199f, 0.650670588f},
-std::array<float,2>{0.0245312918f, 0.327492028f},
-std::array<float,2>{0.160944536f, 0.597444892f},
-std::array<float,2>{0.592911482f, 0.46047917f},
-std::array<float,2>{0.936739981f, 0.867557585f},
-std::array<float,2>{0.263723195f, 0.165168032f},
-std::array<float,2>{0.110720776f, 0.797963142f},
-std::array<float,2>{0.684170842f, 0.223194733f},
-std::array<float,2>{0.820905626f, 0.524839938f},
-std::array<float,2>{0.435089767f, 0.419921815f},
-std::array<float,2>{0.355650842f, 0.741140246f},
-std::array<float,2>{0.945645094f, 0.256889552f},
-std::array<float,2>{0.535162628f, 0.950771987f},
-std::array<float,2>{0.227513209f, 0.0214769114f},
-std::array<float,2>{0.318659931f, 0.962970138f},
-std::array<float,2>{0.987836242f, 0.0153911766f},
-std::array<float,2>{0.522166491f, 0.720482826f},
-std::array<float,2>{0.217739299f, 0.278819501f},
-std::array<float,2>{0.0783093721f, 0.503389597f},
-std::array<float,2>{0.634198725f, 0.435117185f},
-std::array<float,2>{0.874058604f, 0.783185482f},
-std::array<float,2>{0.380687594f, 0.246813357f},
-std::array<float,2>{0.152156934f, 0.849538326f},
-std::array<float,2>{0.605619848f, 0.185103923f},
-std::array<float,2>{0.875884831f, 0.617887855f},
-std::array<float,2>{0.289659679f, 0.443895102f},
-std::array<float,2>{0.48160693f, 0.630110204f},
-std::array<float,2>{0.806304097f, 0.3415851f},
-std::array<float,2>{0.696104527f, 0.913710713f},
-std::array<float,2>{0.044441998f, 0.0865109786f},
-std::array<float,2>{0.413559467f, 0.765102148f},
-std::array<float,2>{0.843098044f, 0.193851739f},
-std::array<float,2>{0.657309115f, 0.561040223f},
-std::array<float,2>{0.107650988f, 0.383647114f},
-std::array<float,2>{0.234899476f, 0.696634352f},
-std::array<float,2>{0.548741937f, 0.297212422f},
-std::array<float,2>{0.953957796f, 0.986000955f},
-std::array<float,2>{0.37304163f, 0.0390094742f},
-std::array<float,2>{0.0118311075f, 0.884778857f},
-std::array<float,2>{0.748056352f, 0.118091099f},
-std::array<float,2>{0.764222324f, 0.677970469f},
-std::array<float,2>{0.454701573f, 0.358825415f},
-std::array<float,2>{0.274557143f, 0.583587348f},
-std::array<float,2>{0.920969367f, 0.47623077f},
-std::array<float,2>{0.577773869f, 0.843608677f},
-std::array<float,2>{0.186931595f, 0.140339255f},
-std::array<float,2>{0.352303177f, 0.83012861f},
-std::array<float,2>{0.95113039f, 0.127703175f},
-std::array<float,2>{0.532246649f, 0.588386059f},
-std::array<float,2>{0.231025383f, 0.479730994f},
-std::array<float,2>{0.115444563f, 0.679757178f},
-std::array<float,2>{0.681172311f, 0.344415575f},
-std::array<float,2>{0.825255871f, 0.876513183f},
-std::array<float,2>{0.43291977f, 0.110258296f},
-std::array<float,2>{0.158441842f, 0.996410131f},
-std::array<float,2>{0.589429438f, 0.0444620959f},
-std::array<float,2>{0.9319157f, 0.691206396f},
-std::array<float,2>{0.259334028f, 0.306888789f},
-std::array<float,2>{0.445140183f, 0.550733924f},
-std::array<float,2>{0.770719469f, 0.376676768f},
-std::array<float,2>{0.727715373f, 0.756390154f},
-std::array<float,2>{0.0286567695f, 0.195452467f},
-std::array<float,2>{0.391441226f, 0.920628786f},
-std::array<float,2>{0.846676648f, 0.0790135562f},
-std::array<float,2>{0.652760744f, 0.634423256f},
-std::array<float,2>{0.0719323009f, 0.332462192f},
-std::array<float,2>{0.193428099f, 0.612127125f},
-std::array<float,2>{0.51078397f, 0.446932912f},
-std::array<float,2>{0.977795124f, 0.858572602f},
-std::array<float,2>{0.337081015f, 0.173793495f},
-std::array<float,2>{0.0577246696f, 0.794174552f},
-std::array<float,2>{0.712275386f, 0.236315146f},
-std::array<float,2>{0.781823158f, 0.512291968f},
-std::array<float,2>{0.485777646f, 0.423300445f},
-std::array<float,2>{0.312204242f, 0.732868195f},
-std::array<float,2>{0.895722747f, 0.267497867f},
-std::array<float,2>{0.617907941f, 0.959168911f},
-std::array<float,2>{0.132383391f, 0.00369981211f},
-std::array<float,2>{0.280501544f, 0.9429726f},
-std::array<float,2>{0.91467756f, 0.0251940265f},
-std::array<float,2>{0.574144721f, 0.745737076f},
-std::array<float,2>{0.182692751f, 0.264285713f},
-std::array<float,2>{0.0113755716f, 0.518621981f},
-std::array<float,2>{0.743712783f, 0.408023f},
-std::array<float,2>{0.761093616f, 0.8054142f},
-std::array<float,2>{0.459202439f, 0.231330693f},
-std::array<float,2>{0.241201833f, 0.864897251f},
-std::array<float,2>{0.551751256f, 0.163250312f},
-std::array<float,2>{0.960036814f, 0.607515454f},
-std::array<float,2>{0.370179534f, 0.466517717f},
-std::array<float,2>{0.407297581f, 0.644315124f},
-std::array<float,2>{0.839480102f, 0.314985871f},
-std::array<float,2>{0.660387695f, 0.930132329f},
-std::array<float,2>{0.104654998f, 0.0743421465f},
-std::array<float,2>{0.47920987f, 0.779747605f},
-std::array<float,2>{0.810362697f, 0.21251148f},
-std::array<float,2>{0.700554669f, 0.532868445f},
-std::array<float,2>{0.0412512235f, 0.402041823f},
-std::array<float,2>{0.153376177f, 0.703154147f},
-std::array<float,2>{0.602252901f, 0.281264901f},
-std::array<float,2>{0.881140769f, 0.969482303f},
-std::array<float,2>{0.293756902f, 0.053391099f},
-std::array<float,2>{0.0846886039f, 0.903766155f},
-std::array<float,2>{0.640538573f, 0.108453721f},
-std::array<float,2>{0.869238615f, 0.656282902f},
-std::array<float,2>{0.375548661f, 0.360878795f},
-std::array<float,2>{0.31565401f, 0.570862949f},
-std::array<float,2>{0.991981983f, 0.497457087f},
-std::array<float,2>{0.517868876f, 0.82518667f},
-std::array<float,2>{0.213338956f, 0.152855709f},
-std::array<float,2>{0.286022186f, 0.80310154f},
-std::array<float,2>{0.886467159f, 0.219441772f},
-std::array<float,2>{0.59855324f, 0.528924048f},
-std::array<float,2>{0.146319836f, 0.414274305f},
-std::array<float,2>{0.0358888693f, 0.734911978f},
-std::array<float,2>{0.690808654f, 0.251603127f},
-std::array<float,2>{0.802424908f, 0.946389198f},
-std::array<float,2>{0.473533243f, 0.0167797059f},
-std::array<float,2>{0.207047328f, 0.927470744f},
-std::array<float,2>{0.526768923f, 0.0640783608f},
-std::array<float,2>{0.993786037f, 0.652349651f},
-std::array<float,2>{0.320445091f, 0.323450655f},
-std::array<float,2>{0.384135127f, 0.59793216f},
-std::array<float,2>{0.864516139f, 0.456741124f},
-std::array<float,2>{0.631006181f, 0.873989403f},
-std::array<float,2>{0.0909316465f, 0.168820575f},
-std::array<float,2>{0.468635261f, 0.983447075f},
-std::array<float,2>{0.755564332f, 0.0600095987f},
-std::array<float,2>{0.735317945f, 0.71145767f},
-std::array<float,2>{0.00446630456f, 0.292377055f},
-std::array<float,2>{0.174021453f, 0.541276276f},
-std::array<float,2>{0.568735957f, 0.397683829f},
-std::array<float,2>{0.906932116f, 0.767640114f},
-std::array<float,2>{0.268945098f, 0.210535958f},
-std::array<float,2>{0.101548463f, 0.819440544f},
-std::array<float,2>{0.665662289f, 0.143928334f},
-std::array<float,2>{0.834677756f, 0.56597966f},
-std::array<float,2>{0.419231266f, 0.486269474f},
-std::array<float,2>{0.360098153f, 0.664790452f},
-std::array<float,2>{0.968565404f, 0.367227167f},
-std::array<float,2>{0.558381021f, 0.897363663f},
-std::array<float,2>{0.246305764f, 0.0999643505f},
-std::array<float,2>{0.329348356f, 0.887661934f},
-std::array<float,2>{0.972155392f, 0.124984697f},
-std::array<float,2>{0.504321098f, 0.672732294f},
-std::array<float,2>{0.195985839f, 0.351838678f},
-std::array<float,2>{0.065242812f, 0.579447865f},
-std::array<float,2>{0.641318083f, 0.471503079f},
-std::array<float,2>{0.852334797f, 0.838624835f},
-std::array<float,2>{0.404460251f, 0.135357663f},
-std::array<float,2>{0.140058741f, 0.759187937f},
-std::array<float,2>{0.615662575f, 0.190892532f},
-std::array<float,2>{0.903689384f, 0.558487535f},
-std::array<float,2>{0.302520454f, 0.386755884f},
-std::array<float,2>{0.497747153f, 0.699427426f},
-std::array<float,2>{0.790489018f, 0.301336914f},
-std::array<float,2>{0.708485723f, 0.988596141f},
-std::array<float,2>{0.0519382805f, 0.0313342698f},
-std::array<float,2>{0.423796207f, 0.844028831f},
-std::array<float,2>{0.816093802f, 0.183146447f},
-std::array<float,2>{0.676001489f, 0.622192144f},
-std::array<float,2>{0.117774919f, 0.43794021f},
-std::array<float,2>{0.226351723f, 0.628853023f},
-std::array<float,2>{0.541038454f, 0.336129338f},
-std::array<float,2>{0.940189242f, 0.908789277f},
-std::array<float,2>{0.350522846f, 0.092716001f},
-std::array<float,2>{0.0170219205f, 0.965481341f},
-std::array<float,2>{0.725568533f, 0.0114217307f},
-std::array<float,2>{0.773823142f, 0.724842846f},
-std::array<float,2>{0.446021825f, 0.27433449f},
-std::array<float,2>{0.253136039f, 0.504341125f},
-std::array<float,2>{0.928849518f, 0.43271476f},
-std::array<float,2>{0.579097509f, 0.788996994f},
-std::array<float,2>{0.170374319f, 0.245890364f},
-std::array<float,2>{0.326555669f, 0.75056982f},
-std::array<float,2>{0.996331096f, 0.19929485f},
-std::array<float,2>{0.530268431f, 0.554055333f},
-std::array<float,2>{0.205492914f, 0.380503684f},
-std::array<float,2>{0.0866926536f, 0.695186079f},
-std::array<float,2>{0.627062976f, 0.309564859f},
-std::array<float,2>{0.861354589f, 0.993112087f},
-std::array<float,2>{0.387589633f, 0.041911833f},
-std::array<float,2>{0.144030735f, 0.879992127f},
-std::array<float,2>{0.594109952f, 0.114003487f},
-std::array<float,2>{0.88767451f, 0.684560597f},
-std::array<float,2>{0.281526536f, 0.348565191f},
-std::array<float,2>{0.472227514f, 0.592990935f},
-std::array<float,2>{0.799952507f, 0.481304556f},
-std::array<float,2>{0.692769587f, 0.833048344f},
-std::array<float,2>{0.0316949114f, 0.131505921f},
-std::array<float,2>{0.415471971f, 0.955072582f},
-std::array<float,2>{0.828836024f, 0.00738498848f},
-std::array<float,2>{0.668997407f, 0.726642013f},
-std::array<float,2>{0.0947433785f, 0.273405433f},
-std::array<float,2>{0.242539972f, 0.508013248f},
-std::array<float,2>{0.560720742f, 0.427133381f},
-std::array<float,2>{0.962538362f, 0.78940177f},
-std::array<float,2>{0.366967887f, 0.238822162f},
-std::array<float,2>{0.000603491906f, 0.851586998f},
-std::array<float,2>{0.74214536f, 0.175887197f},
-std::array<float,2>{0.750688195f, 0.613519549f},
-std::array<float,2>{0.463432312f, 0.450187504f},
-std::array<float,2>{0.270016879f, 0.63775593f},
-std::array<float,2>{0.911396384f, 0.328273952f},
-std::array<float,2>{0.562662303f, 0.915984929f},
-std::array<float,2>{0.176856995f, 0.083042711f},
-std::array<float,2>{0.297858208f, 0.935581326f},
-std::array<float,2>{0.901756585f, 0.072759442f},
-std::array<float,2>{0.609508216f, 0.645506084f},
-std::array<float,2>{0.136468247f, 0.318309695f},
-std::array<float,2>{0.0487800352f, 0.604768753f},
-std::array<float,2>{0.705146909f, 0.460996091f},
-std::array<float,2>{0.793302774f, 0.859734237f},
-std::array<float,2>{0.492298961f, 0.156406686f},
-std::array<float,2>{0.200337052f, 0.809156299f},
-std::array<float,2>{0.502094507f, 0.229171947f},
-std::array<float,2>{0.975992441f, 0.521104336f},
-std::array<float,2>{0.333534032f, 0.41391921f},
-std::array<float,2>{0.402095884f, 0.746946812f},
-std::array<float,2>{0.858782649f, 0.261127323f},
-std::array<float,2>{0.645287156f, 0.937956095f},
-std::array<float,2>{0.0668509975f, 0.0306343604f},
-std::array<float,2>{0.45201841f, 0.823360622f},
-std::array<float,2>{0.780280769f, 0.151531383f},
-std::array<float,2>{0.721672475f, 0.577065349f},
-std::array<float,2>{0.0204280671f, 0.494601399f},
-std::array<float,2>{0.16683951f, 0.663739979f},
-std::array<float,2>{0.583251357f, 0.366341352f},
-std::array<float,2>{0.925284147f, 0.902216792f},
-std::array<float,2>{0.255911648f, 0.103325009f},
-std::array<float,2>{0.124814391f, 0.974907756f},
-std::array<float,2>{0.672179163f, 0.0475236811f},
-std::array<float,2>{0.818014085f, 0.710234046f},
-std::array<float,2>{0.426756322f, 0.288501382f},
-std::array<float,2>{0.347195357f, 0.536756337f},
-std::array<float,2>{0.945080578f, 0.403237075f},
-std::array<float,2>{0.546177924f, 0.776077807f},
-std::array<float,2>{0.220143914f, 0.217970774f},
-std::array<float,2>{0.263538092f, 0.869675517f},
-std::array<float,2>{0.933686197f, 0.16665639f},
-std::array<float,2>{0.590709269f, 0.594466984f},
-std::array<float,2>{0.162244394f, 0.458281606f},
-std::array<float,2>{0.0266030896f, 0.649597585f},
-std::array<float,2>{0.732495785f, 0.325764626f},
-std::array<float,2>{0.767398655f, 0.923229754f},
-std::array<float,2>{0.439677387f, 0.067926757f},
-std::array<float,2>{0.229746446f, 0.952171803f},
-std::array<float,2>{0.537807703f, 0.0215276629f},
-std::array<float,2>{0.948427618f, 0.739268899f},
-std::array<float,2>{0.358890861f, 0.255735636f},
-std::array<float,2>{0.435763687f, 0.52698189f},
-std::array<float,2>{0.822497547f, 0.419960499f},
-std::array<float,2>{0.686667502f, 0.800118208f},
-std::array<float,2>{0.111623079f, 0.225425586f},
-std::array<float,2>{0.488930464f, 0.894238651f},
-std::array<float,2>{0.785504937f, 0.0947518423f},
-std::array<float,2>{0.717143834f, 0.670084119f},
-std::array<float,2>{0.0624907166f, 0.373417795f},
-std::array<float,2>{0.127854452f, 0.569218159f},
-std::array<float,2>{0.622471511f, 0.491548449f},
-std::array<float,2>{0.89374882f, 0.815733314f},
-std::array<float,2>{0.305951148f, 0.148337454f},
-std::array<float,2>{0.0776161402f, 0.772105277f},
-std::array<float,2>{0.651586413f, 0.204063132f},
-std::array<float,2>{0.850510299f, 0.546011567f},
-std::array<float,2>{0.395370334f, 0.393302858f},
-std::array<float,2>{0.34363386f, 0.715898931f},
-std::array<float,2>{0.980738521f, 0.295755059f},
-std::array<float,2>{0.512569547f, 0.978112638f},
-std::array<float,2>{0.190367296f, 0.0553711355f},
-std::array<float,2>{0.374450713f, 0.986337721f},
-std::array<float,2>{0.955969512f, 0.0369844548f},
-std::array<float,2>{0.550471663f, 0.698827088f},
-std::array<float,2>{0.238002375f, 0.299218178f},
-std::array<float,2>{0.106917843f, 0.55948323f},
-std::array<float,2>{0.65848285f, 0.386547387f},
-std::array<float,2>{0.840371192f, 0.762965739f},
-std::array<float,2>{0.411339104f, 0.192359015f},
-std::array<float,2>{0.18482919f, 0.841090381f},
-std::array<float,2>{0.575662434f, 0.138612151f},
-std::array<float,2>{0.918504894f, 0.585383415f},
-std::array<float,2>{0.276616693f, 0.472765952f},
-std::array<float,2>{0.456326872f, 0.677374303f},
-std::array<float,2>{0.762957752f, 0.356357962f},
-std::array<float,2>{0.747017324f, 0.883062363f},
-std::array<float,2>{0.014163319f, 0.119389839f},
-std::array<float,2>{0.382299989f, 0.784491897f},
-std::array<float,2>{0.871963918f, 0.248974204f},
-std::array<float,2>{0.636656523f, 0.501117885f},
-std::array<float,2>{0.0801975504f, 0.436098158f},
-std::array<float,2>{0.2161109f, 0.72167629f},
-std::array<float,2>{0.520869195f, 0.27942881f},
-std::array<float,2>{0.984756768f, 0.961365342f},
-std::array<float,2>{0.31783691f, 0.0129027441f},
-std::array<float,2>{0.0454297177f, 0.91091454f},
-std::array<float,2>{0.699158549f, 0.088458918f},
-std::array<float,2>{0.807341993f, 0.632321835f},
-std::array<float,2>{0.482465297f, 0.34371838f},
-std::array<float,2>{0.291238457f, 0.619694114f},
-std::array<float,2>{0.878901601f, 0.442102432f},
-std::array<float,2>{0.609297752f, 0.849624157f},
-std::array<float,2>{0.148614138f, 0.187131777f},
-std::array<float,2>{0.313472271f, 0.826111078f},
-std::array<float,2>{0.989248514f, 0.153744653f},
-std::array<float,2>{0.516309083f, 0.571367919f},
-std::array<float,2>{0.211035103f, 0.496818632f},
-std::array<float,2>{0.082836777f, 0.658018887f},
-std::array<float,2>{0.637756705f, 0.360099941f},
-std::array<float,2>{0.867274046f, 0.90263325f},
-std::array<float,2>{0.377140373f, 0.107631467f},
-std::array<float,2>{0.156168401f, 0.969820261f},
-std::array<float,2>{0.605459988f, 0.0546770804f},
-std::array<float,2>{0.879036903f, 0.70463264f},
-std::array<float,2>{0.296033472f, 0.28304556f},
-std::array<float,2>{0.47750017f, 0.53159076f},
-std::array<float,2>{0.811647952f, 0.400961488f},
-std::array<float,2>{0.70282042f, 0.780473173f},
-std::array<float,2>{0.0392384343f, 0.211775944f},
-std::array<float,2>{0.409784079f, 0.930803776f},
-std::array<float,2>{0.836284518f, 0.0760749504f},
-std::array<float,2>{0.662537754f, 0.643098474f},
-std::array<float,2>{0.102978408f, 0.315903485f},
-std::array<float,2>{0.239422768f, 0.609244347f},
-std::array<float,2>{0.553761005f, 0.465624094f},
-std::array<float,2>{0.957688153f, 0.86341083f},
-std::array<float,2>{0.368655175f, 0.16259259f},
-std::array<float,2>{0.00962030981f, 0.806516469f},
-std::array<float,2>{0.744817019f, 0.231755659f},
-std::array<float,2>{0.758062124f, 0.518122733f},
-std::array<float,2>{0.457650006f, 0.407116085f},
-std::array<float,2>{0.2788167f, 0.744400024f},
-std::array<float,2>{0.916402102f, 0.264700443f},
-std::array<float,2>{0.571276844f, 0.942097306f},
-std::array<float,2>{0.181337222f, 0.0239147115f},
-std::array<float,2>{0.310402423f, 0.960407078f},
-std::array<float,2>{0.898336649f, 0.00226995884f},
-std::array<float,2>{0.620398819f, 0.733825743f},
-std::array<float,2>{0.129512012f, 0.265889436f},
-std::array<float,2>{0.0557737686f, 0.512953997f},
-std::array<float,2>{0.714315474f, 0.422849536f},
-std::array<float,2>{0.783736229f, 0.793272316f},
-std::array<float,2>{0.486982971f, 0.234585702f},
-std::array<float,2>{0.191665322f, 0.857631743f},
-std::array<float,2>{0.50935483f, 0.1723658f},
-std::array<float,2>{0.978554368f, 0.612778962f},
-std::array<float,2>{0.338921756f, 0.445731342f},
-std::array<float,2>{0.393041104f, 0.633655071f},
-std::array<float,2>{0.844927847f, 0.333914042f},
-std::array<float,2>{0.655757546f, 0.921291113f},
-std::array<float,2>{0.0726938322f, 0.0797436908f},
-std::array<float,2>{0.441836834f, 0.757218957f},
-std::array<float,2>{0.771635532f, 0.197197035f},
-std::array<float,2>{0.730264246f, 0.549476624f},
-std::array<float,2>{0.031118175f, 0.375898689f},
-std::array<float,2>{0.157676324f, 0.689972043f},
-std::array<float,2>{0.585977316f, 0.30824095f},
-std::array<float,2>{0.930302858f, 0.997763813f},
-std::array<float,2>{0.261371702f, 0.0429928601f},
-std::array<float,2>{0.114593849f, 0.875281453f},
-std::array<float,2>{0.682853401f, 0.110543206f},
-std::array<float,2>{0.826768637f, 0.681556523f},
-std::array<float,2>{0.431275487f, 0.345339388f},
-std::array<float,2>{0.355122477f, 0.589417458f},
-std::array<float,2>{0.951537251f, 0.479175031f},
-std::array<float,2>{0.53488338f, 0.831699014f},
-std::array<float,2>{0.234111071f, 0.128574312f},
-std::array<float,2>{0.251721501f, 0.787890077f},
-std::array<float,2>{0.926366866f, 0.244726405f},
-std::array<float,2>{0.580889463f, 0.505210221f},
-std::array<float,2>{0.168205082f, 0.432343721f},
-std::array<float,2>{0.0178005602f, 0.725775957f},
-std::array<float,2>{0.724029839f, 0.274940819f},
-std::array<float,2>{0.776854455f, 0.966757476f},
-std::array<float,2>{0.447974503f, 0.0101315705f},
-std::array<float,2>{0.223520935f, 0.909403622f},
-std::array<float,2>{0.540648341f, 0.0933224112f},
-std::array<float,2>{0.938113213f, 0.627387404f},
-std::array<float,2>{0.348769844f, 0.337628484f},
-std::array<float,2>{0.424075097f, 0.621706784f},
-std::array<float,2>{0.814308584f, 0.438785195f},
-std::array<float,2>{0.679499388f, 0.844991326f},
-std::array<float,2>{0.120429672f, 0.181893274f},
-std::array<float,2>{0.498509079f, 0.98933953f},
-std::array<float,2>{0.791109502f, 0.0329392441f},
-std::array<float,2>{0.709174097f, 0.700672805f},
-std::array<float,2>{0.0543935373f, 0.302637428f},
-std::array<float,2>{0.138470396f, 0.55682683f},
-std::array<float,2>{0.614119828f, 0.388549f},
-std::array<float,2>{0.905639231f, 0.758367658f},
-std::array<float,2>{0.304587156f, 0.189669505f},
-std::array<float,2>{0.0625162199f, 0.839059591f},
-std::array<float,2>{0.644017279f, 0.136425853f},
-std::array<float,2>{0.855248153f, 0.578581512f},
-std::array<float,2>{0.403143764f, 0.472221464f},
-std::array<float,2>{0.330516398f, 0.673193991f},
-std::array<float,2>{0.969823539f, 0.353059888f},
-std::array<float,2>{0.506740987f, 0.887959361f},
-std::array<float,2>{0.199028686f, 0.1240137f},
-std::array<float,2>{0.363264799f, 0.89788413f},
-std::array<float,2>{0.966561794f, 0.100812085f},
-std::array<float,2>{0.556395352f, 0.665432036f},
-std::array<float,2>{0.249107376f, 0.368630201f},
-std::array<float,2>{0.0991831571f, 0.565384328f},
-std::array<float,2>{0.666184843f, 0.485094786f},
-std::array<float,2>{0.832236528f, 0.818568707f},
-std::array<float,2>{0.420926452f, 0.142765045f},
-std::array<float,2>{0.172921076f, 0.768729746f},
-std::array<float,2>{0.566471756f, 0.20927918f},
-std::array<float,2>{0.909410834f, 0.542611182f},
-std::array<float,2>{0.266761243f, 0.397040159f},
-std::array<float,2>{0.466348141f, 0.712839961f},
-std::array<float,2>{0.75704211f, 0.291653067f},
-std::array<float,2>{0.736921132f, 0.983189225f},
-std::array<float,2>{0.00660963822f, 0.059381783f},
-std::array<float,2>{0.386636227f, 0.874110043f},
-std::array<float,2>{0.866224885f, 0.169747531f},
-std::array<float,2>{0.630495012f, 0.598772049f},
-std::array<float,2>{0.0928010717f, 0.455209583f},
-std::array<float,2>{0.209679499f, 0.653797448f},
-std::array<float,2>{0.524029553f, 0.322693676f},
-std::array<float,2>{0.994633317f, 0.925971687f},
-std::array<float,2>{0.32249853f, 0.0630478486f},
-std::array<float,2>{0.0386089161f, 0.946060717f},
-std::array<float,2>{0.687877297f, 0.0157765206f},
-std::array<float,2>{0.803392172f, 0.736046433f},
-std::array<float,2>{0.475988895f, 0.25069195f},
-std::array<float,2>{0.287139386f, 0.527348816f},
-std::array<float,2>{0.883204222f, 0.415831119f},
-std::array<float,2>{0.601408124f, 0.804144621f},
-std::array<float,2>{0.147017628f, 0.220333546f},
-std::array<float,2>{0.345055938f, 0.776874721f},
-std::array<float,2>{0.94308579f, 0.216992557f},
-std::array<float,2>{0.543753564f, 0.535289168f},
-std::array<float,2>{0.221820965f, 0.404279917f},
-std::array<float,2>{0.121101022f, 0.709778309f},
-std::array<float,2>{0.673891306f, 0.288045347f},
-std::array<float,2>{0.818633795f, 0.975631416f},
-std::array<float,2>{0.428735733f, 0.0482991897f},
-std::array<float,2>{0.16483435f, 0.901045799f},
-std::array<float,2>{0.584158063f, 0.102374896f},
-std::array<float,2>{0.922788441f, 0.662233114f},
-std::array<float,2>{0.254828215f, 0.365995556f},
-std::array<float,2>{0.449256361f, 0.577732146f},
-std::array<float,2>{0.779161513f, 0.495954812f},
-std::array<float,2>{0.719054461f, 0.822495818f},
-std::array<float,2>{0.0233887732f, 0.15082787f},
-std::array<float,2>{0.398634464f, 0.938950658f},
-std::array<float,2>{0.855544567f, 0.0293662399f},
-std::array<float,2>{0.64661932f, 0.747875035f},
-std::array<float,2>{0.0699210241f, 0.260285497f},
-std::array<float,2>{0.202923521f, 0.519681633f},
-std::array<float,2>{0.501369655f, 0.413061202f},
-std::array<float,2>{0.973477542f, 0.810209453f},
-std::array<float,2>{0.335361689f, 0.230260536f},
-std::array<float,2>{0.0493234843f, 0.860594392f},
-std::array<float,2>{0.704991937f, 0.158171132f},
-std::array<float,2>{0.795819521f, 0.603984594f},
-std::array<float,2>{0.494228214f, 0.462160856f},
-std::array<float,2>{0.299006283f, 0.645530283f},
-std::array<float,2>{0.89935106f, 0.316824734f},
-std::array<float,2>{0.612210751f, 0.936538577f},
-std::array<float,2>{0.132951587f, 0.0740094408f},
-std::array<float,2>{0.272886723f, 0.914914191f},
-std::array<float,2>{0.913404942f, 0.0824142694f},
-std::array<float,2>{0.565066576f, 0.636855066f},
-std::array<float,2>{0.179511651f, 0.329711378f},
-std::array<float,2>{0.0022682664f, 0.614694715f},
-std::array<float,2>{0.739864588f, 0.450728416f},
-std::array<float,2>{0.75281775f, 0.853324294f},
-std::array<float,2>{0.462814987f, 0.177226603f},
-std::array<float,2>{0.245083407f, 0.790174842f},
-std::array<float,2>{0.559235394f, 0.23946923f},
-std::array<float,2>{0.963611245f, 0.509054244f},
-std::array<float,2>{0.363692105f, 0.426743895f},
-std::array<float,2>{0.417536795f, 0.727877557f},
-std::array<float,2>{0.831218243f, 0.272214681f},
-std::array<float,2>{0.670362115f, 0.953221977f},
-std::array<float,2>{0.0961061791f, 0.00629474269f},
-std::array<float,2>{0.469054043f, 0.832897663f},
-std::array<float,2>{0.796954334f, 0.13190423f},
-std::array<float,2>{0.694792628f, 0.591943502f},
-std::array<float,2>{0.0337030552f, 0.48239544f},
-std::array<float,2>{0.141504809f, 0.685326874f},
-std::array<float,2>{0.595804334f, 0.349566132f},
-std::array<float,2>{0.889835477f, 0.879336238f},
-std::array<float,2>{0.283296317f, 0.114700682f},
-std::array<float,2>{0.0882483423f, 0.993291378f},
-std::array<float,2>{0.626651645f, 0.0423436873f},
-std::array<float,2>{0.860389173f, 0.693903923f},
-std::array<float,2>{0.390043914f, 0.309898347f},
-std::array<float,2>{0.324553579f, 0.553605199f},
-std::array<float,2>{0.99983567f, 0.379602075f},
-std::array<float,2>{0.527344644f, 0.75120914f},
-std::array<float,2>{0.205066413f, 0.200772107f},
-std::array<float,2>{0.290159255f, 0.850826025f},
-std::array<float,2>{0.876812875f, 0.186086804f},
-std::array<float,2>{0.607029378f, 0.621090233f},
-std::array<float,2>{0.15063864f, 0.442858547f},
-std::array<float,2>{0.0429957956f, 0.631038487f},
-std::array<float,2>{0.697053969f, 0.341819465f},
-std::array<float,2>{0.805088162f, 0.911529005f},
-std::array<float,2>{0.480876297f, 0.089133352f},
-std::array<float,2>{0.217924356f, 0.962432802f},
-std::array<float,2>{0.523381829f, 0.0122698499f},
-std::array<float,2>{0.986645043f, 0.721728504f},
-std::array<float,2>{0.320092916f, 0.280402005f},
-std::array<float,2>{0.378964871f, 0.50022614f},
-std::array<float,2>{0.873517096f, 0.436677426f},
-std::array<float,2>{0.632840276f, 0.783776641f},
-std::array<float,2>{0.0800409168f, 0.249116123f},
-std::array<float,2>{0.453957319f, 0.883969426f},
-std::array<float,2>{0.765090525f, 0.120290428f},
-std::array<float,2>{0.749811113f, 0.676030874f},
-std::array<float,2>{0.0133627066f, 0.357293785f},
-std::array<float,2>{0.186323181f, 0.583987772f},
-std::array<float,2>{0.576583683f, 0.474378079f},
-std::array<float,2>{0.920089245f, 0.839915693f},
-std::array<float,2>{0.274109513f, 0.137276068f},
-std::array<float,2>{0.108599894f, 0.76260066f},
-std::array<float,2>{0.657099783f, 0.19288972f},
-std::array<float,2>{0.841967404f, 0.560148597f},
-std::array<float,2>{0.412371904f, 0.385531306f},
-std::array<float,2>{0.371764183f, 0.697375417f},
-std::array<float,2>{0.954146028f, 0.300237954f},
-std::array<float,2>{0.547687829f, 0.98777622f},
-std::array<float,2>{0.235704809f, 0.0360583365f},
-std::array<float,2>{0.340578675f, 0.977416635f},
-std::array<float,2>{0.982847571f, 0.0559303686f},
-std::array<float,2>{0.514563322f, 0.715165436f},
-std::array<float,2>{0.187540933f, 0.296429724f},
-std::array<float,2>{0.0745845288f, 0.545204163f},
-std::array<float,2>{0.649003565f, 0.394517243f},
-std::array<float,2>{0.847827852f, 0.772771239f},
-std::array<float,2>{0.397866815f, 0.204846412f},
-std::array<float,2>{0.125286236f, 0.814706206f},
-std::array<float,2>{0.624319911f, 0.146917492f},
-std::array<float,2>{0.891382277f, 0.570005238f},
-std::array<float,2>{0.30711022f, 0.4908472f},
-std::array<float,2>{0.491097569f, 0.671344101f},
-std::array<float,2>{0.787162125f, 0.374828428f},
-std::array<float,2>{0.716639221f, 0.892858982f},
-std::array<float,2>{0.0590316765f, 0.0943913907f},
-std::array<float,2>{0.434367567f, 0.798841298f},
-std::array<float,2>{0.821790218f, 0.226346716f},
-std::array<float,2>{0.684607685f, 0.52606672f},
-std::array<float,2>{0.110272013f, 0.421763599f},
-std::array<float,2>{0.22804001f, 0.738454998f},
-std::array<float,2>{0.53682071f, 0.254851282f},
-std::array<float,2>{0.946900666f, 0.951964676f},
-std::array<float,2>{0.356785208f, 0.0226857197f},
-std::array<float,2>{0.0241622608f, 0.922421157f},
-std::array<float,2>{0.731642187f, 0.0671874061f},
-std::array<float,2>{0.768487871f, 0.648913622f},
-std::array<float,2>{0.437649637f, 0.324385256f},
-std::array<float,2>{0.265191942f, 0.595327973f},
-std::array<float,2>{0.935991347f, 0.457558185f},
-std::array<float,2>{0.592128873f, 0.870256484f},
-std::array<float,2>{0.161477506f, 0.166999727f},
-std::array<float,2>{0.369506001f, 0.866688251f},
-std::array<float,2>{0.959506273f, 0.160738319f},
-std::array<float,2>{0.552373171f, 0.607207775f},
-std::array<float,2>{0.241469026f, 0.467079014f},
-std::array<float,2>{0.104028314f, 0.641903639f},
-std::array<float,2>{0.662103355f, 0.313985646f},
-std::array<float,2>{0.838766873f, 0.932986677f},
-std::array<float,2>{0.407143265f, 0.0767986551f},
-std::array<float,2>{0.182578847f, 0.945035219f},
-std::array<float,2>{0.572531641f, 0.0256740954f},
-std::array<float,2>{0.9154706f, 0.742448509f},
-std::array<float,2>{0.279953182f, 0.262739867f},
-std::array<float,2>{0.460399538f, 0.516781092f},
-std::array<float,2>{0.760299921f, 0.409433663f},
-std::array<float,2>{0.742860794f, 0.808014631f},
-std::array<float,2>{0.0103766052f, 0.233177856f},
-std::array<float,2>{0.376694798f, 0.906093776f},
-std::array<float,2>{0.87076664f, 0.105990484f},
-std::array<float,2>{0.63941735f, 0.658253014f},
-std::array<float,2>{0.0853327662f, 0.362422854f},
-std::array<float,2>{0.214197204f, 0.573407471f},
-std::array<float,2>{0.519393265f, 0.499234557f},
-std::array<float,2>{0.99107945f, 0.827789783f},
-std::array<float,2>{0.314953238f, 0.155280158f},
-std::array<float,2>{0.0423545055f, 0.777453303f},
-std::array<float,2>{0.699805856f, 0.214193761f},
-std::array<float,2>{0.808712661f, 0.534560263f},
-std::array<float,2>{0.479588568f, 0.399216205f},
-std::array<float,2>{0.294083685f, 0.705734074f},
-std::array<float,2>{0.882783473f, 0.283281922f},
-std::array<float,2>{0.602589369f, 0.970723271f},
-std::array<float,2>{0.152842209f, 0.0514385775f},
-std::array<float,2>{0.25827378f, 0.998113096f},
-std::array<float,2>{0.933187902f, 0.0455380306f},
-std::array<float,2>{0.588673413f, 0.689110935f},
-std::array<float,2>{0.159471929f, 0.304860353f},
-std::array<float,2>{0.0279791541f, 0.546996236f},
-std::array<float,2>{0.72692728f, 0.378545552f},
-std::array<float,2>{0.770324409f, 0.753980458f},
-std::array<float,2>{0.443910301f, 0.198274612f},
-std::array<float,2>{0.231962919f, 0.82840097f},
-std::array<float,2>{0.531884253f, 0.125100955f},
-std::array<float,2>{0.95019412f, 0.587865531f},
-std::array<float,2>{0.353262305f, 0.477562845f},
-std::array<float,2>{0.432228565f, 0.682658315f},
-std::array<float,2>{0.824315012f, 0.347257793f},
-std::array<float,2>{0.680038929f, 0.877333999f},
-std::array<float,2>{0.117139168f, 0.111581631f},
-std::array<float,2>{0.485172838f, 0.795068443f},
-std::array<float,2>{0.782553017f, 0.237625659f},
-std::array<float,2>{0.711736619f, 0.514157891f},
-std::array<float,2>{0.0571007207f, 0.425585002f},
-std::array<float,2>{0.131557047f, 0.732032359f},
-std::array<float,2>{0.618330181f, 0.268679976f},
-std::array<float,2>{0.894701302f, 0.957550228f},
-std::array<float,2>{0.311339527f, 0.0016951398f},
-std::array<float,2>{0.0705583468f, 0.918378472f},
-std::array<float,2>{0.654016912f, 0.0813342035f},
-std::array<float,2>{0.847148955f, 0.635927916f},
-std::array<float,2>{0.391723275f, 0.335297555f},
-std::array<float,2>{0.336611032f, 0.609665751f},
-std::array<float,2>{0.976950228f, 0.447933793f},
-std::array<float,2>{0.510718405f, 0.856076241f},
-std::array<float,2>{0.195038974f, 0.17455402f},
-std::array<float,2>{0.301194519f, 0.76109159f},
-std::array<float,2>{0.902786076f, 0.187687665f},
-std::array<float,2>{0.616996765f, 0.55573529f},
-std::array<float,2>{0.138874039f, 0.390382528f},
-std::array<float,2>{0.0516844243f, 0.701960981f},
-std::array<float,2>{0.707934737f, 0.303029358f},
-std::array<float,2>{0.789999127f, 0.99056977f},
-std::array<float,2>{0.49653241f, 0.034419369f},
-std::array<float,2>{0.196940392f, 0.889900208f},
-std::array<float,2>{0.505587041f, 0.122924007f},
-std::array<float,2>{0.971511126f, 0.675080955f},
-std::array<float,2>{0.328159243f, 0.355064094f},
-std::array<float,2>{0.405710846f, 0.580311477f},
-std::array<float,2>{0.853008628f, 0.470112741f},
-std::array<float,2>{0.642407477f, 0.836260021f},
-std::array<float,2>{0.0654559657f, 0.134545714f},
-std::array<float,2>{0.446744889f, 0.96690774f},
-std::array<float,2>{0.775273085f, 0.00885912683f},
-std::array<float,2>{0.726392567f, 0.722710073f},
-std::array<float,2>{0.0159566551f, 0.277193516f},
-std::array<float,2>{0.171578273f, 0.507696092f},
-std::array<float,2>{0.579842985f, 0.430978894f},
-std::array<float,2>{0.927975059f, 0.785381973f},
-std::array<float,2>{0.252337992f, 0.243271291f},
-std::array<float,2>{0.119035751f, 0.845746577f},
-std::array<float,2>{0.677132189f, 0.18157655f},
-std::array<float,2>{0.815003157f, 0.623862743f},
-std::array<float,2>{0.422514588f, 0.440594584f},
-std::array<float,2>{0.350839734f, 0.62636143f},
-std::array<float,2>{0.940901339f, 0.339584649f},
-std::array<float,2>{0.542674005f, 0.907155693f},
-std::array<float,2>{0.224689588f, 0.0906898379f},
-std::array<float,2>{0.321504414f, 0.928771198f},
-std::array<float,2>{0.99276793f, 0.0646067262f},
-std::array<float,2>{0.525662422f, 0.655333459f},
-std::array<float,2>{0.208391875f, 0.320653319f},
-std::array<float,2>{0.089962624f, 0.600706458f},
-std::array<float,2>{0.632597268f, 0.453990042f},
-std::array<float,2>{0.864001691f, 0.871555209f},
-std::array<float,2>{0.383690387f, 0.17014645f},
-std::array<float,2>{0.144729465f, 0.801139534f},
-std::array<float,2>{0.598891973f, 0.22099942f},
-std::array<float,2>{0.885499895f, 0.53059113f},
-std::array<float,2>{0.286612272f, 0.417914242f},
-std::array<float,2>{0.474303424f, 0.73639226f},
-std::array<float,2>{0.801322043f, 0.252411872f},
-std::array<float,2>{0.689778864f, 0.947426558f},
-std::array<float,2>{0.0368504375f, 0.0186009854f},
-std::array<float,2>{0.418544561f, 0.817687094f},
-std::array<float,2>{0.835483968f, 0.141523585f},
-std::array<float,2>{0.664577186f, 0.564119518f},
-std::array<float,2>{0.100221626f, 0.487888753f},
-std::array<float,2>{0.247752681f, 0.667650998f},
-std::array<float,2>{0.557403088f, 0.36997506f},
-std::array<float,2>{0.967013836f, 0.894674659f},
-std::array<float,2>{0.360555291f, 0.0991089195f},
-std::array<float,2>{0.00578723056f, 0.980525196f},
-std::array<float,2>{0.73582232f, 0.0615960956f},
-std::array<float,2>{0.75434947f, 0.712905407f},
-std::array<float,2>{0.467768878f, 0.290986776f},
-std::array<float,2>{0.267666727f, 0.540010929f},
-std::array<float,2>{0.907607377f, 0.395297289f},
-std::array<float,2>{0.569794834f, 0.766564667f},
-std::array<float,2>{0.175441116f, 0.207735002f},
-std::array<float,2>{0.332570225f, 0.811557412f},
-std::array<float,2>{0.974931717f, 0.22841993f},
-std::array<float,2>{0.503536463f, 0.522206247f},
-std::array<float,2>{0.199426815f, 0.41054666f},
-std::array<float,2>{0.0675663203f, 0.748519301f},
-std::array<float,2>{0.646165431f, 0.258443803f},
-std::array<float,2>{0.857976019f, 0.939813316f},
-std::array<float,2>{0.400852978f, 0.0287604872f},
-std::array<float,2>{0.135313943f, 0.934616387f},
-std::array<float,2>{0.610571682f, 0.0720078498f},
-std::array<float,2>{0.901306212f, 0.646560967f},
-std::array<float,2>{0.297430187f, 0.319957405f},
-std::array<float,2>{0.493704826f, 0.602926552f},
-std::array<float,2>{0.794393361f, 0.464532316f},
-std::array<float,2>{0.706521451f, 0.863188624f},
-std::array<float,2>{0.0473951213f, 0.159102559f},
-std::array<float,2>{0.426874697f, 0.973201334f},
-std::array<float,2>{0.817224026f, 0.0492441207f},
-std::array<float,2>{0.672935486f, 0.708376408f},
-std::array<float,2>{0.123524159f, 0.286947906f},
-std::array<float,2>{0.219636679f, 0.537871301f},
-std::array<float,2>{0.545318723f, 0.405613065f},
-std::array<float,2>{0.94375968f, 0.774136305f},
-std::array<float,2>{0.345766157f, 0.216449007f},
-std::array<float,2>{0.0209068879f, 0.821119308f},
-std::array<float,2>{0.722586215f, 0.149545699f},
-std::array<float,2>{0.779943407f, 0.574988246f},
-std::array<float,2>{0.452357173f, 0.493704319f},
-std::array<float,2>{0.25760749f, 0.661655784f},
-std::array<float,2>{0.924369574f, 0.364572942f},
-std::array<float,2>{0.582609117f, 0.900382102f},
-std::array<float,2>{0.167159423f, 0.105405189f},
-std::array<float,2>{0.283159018f, 0.882771909f},
-std::array<float,2>{0.888554096f, 0.117127568f},
-std::array<float,2>{0.595143378f, 0.685883284f},
-std::array<float,2>{0.142595783f, 0.351103574f},
-std::array<float,2>{0.0323095061f, 0.591682434f},
-std::array<float,2>{0.691420376f, 0.483683467f},
-std::array<float,2>{0.798998117f, 0.834091544f},
-std::array<float,2>{0.470944554f, 0.129288152f},
-std::array<float,2>{0.206563488f, 0.752863944f},
-std::array<float,2>{0.530704975f, 0.203123838f},
-std::array<float,2>{0.99759835f, 0.552359939f},
-std::array<float,2>{0.327756464f, 0.382773757f},
-std::array<float,2>{0.387843847f, 0.692073047f},
-std::array<float,2>{0.862344503f, 0.311831921f},
-std::array<float,2>{0.628176033f, 0.995048165f},
-std::array<float,2>{0.0872058645f, 0.0400386304f},
-std::array<float,2>{0.464098096f, 0.853919804f},
-std::array<float,2>{0.751041889f, 0.178838655f},
-std::array<float,2>{0.740326524f, 0.615852833f},
-std::array<float,2>{0.00179706945f, 0.45260632f},
-std::array<float,2>{0.176106453f, 0.639484942f},
-std::array<float,2>{0.564182997f, 0.331989586f},
-std::array<float,2>{0.911103725f, 0.916989386f},
-std::array<float,2>{0.270741701f, 0.0844774917f},
-std::array<float,2>{0.094549574f, 0.955509186f},
-std::array<float,2>{0.668235123f, 0.00559415948f},
-std::array<float,2>{0.829270661f, 0.730463386f},
-std::array<float,2>{0.414306104f, 0.269663393f},
-std::array<float,2>{0.365418434f, 0.510733724f},
-std::array<float,2>{0.961137176f, 0.429594457f},
-std::array<float,2>{0.562426031f, 0.792399883f},
-std::array<float,2>{0.244118094f, 0.241389453f},
-std::array<float,2>{0.275421321f, 0.842308879f},
-std::array<float,2>{0.919474781f, 0.139630273f},
-std::array<float,2>{0.574729979f, 0.582120478f},
-std::array<float,2>{0.184429824f, 0.474626958f},
-std::array<float,2>{0.0148263704f, 0.679121435f},
-std::array<float,2>{0.747886777f, 0.357565105f},
-std::array<float,2>{0.761889517f, 0.886691451f},
-std::array<float,2>{0.456030339f, 0.118965253f},
-std::array<float,2>{0.236531779f, 0.985313177f},
-std::array<float,2>{0.549199164f, 0.0373032987f},
-std::array<float,2>{0.956252933f, 0.695970476f},
-std::array<float,2>{0.373562634f, 0.298010528f},
-std::array<float,2>{0.410718262f, 0.562278748f},
-std::array<float,2>{0.841517746f, 0.384226024f},
-std::array<float,2>{0.660077155f, 0.763966382f},
-std::array<float,2>{0.106349781f, 0.194738358f},
-std::array<float,2>{0.483621597f, 0.912528932f},
-std::array<float,2>{0.808116078f, 0.0877203867f},
-std::array<float,2>{0.698083639f, 0.628994226f},
-std::array<float,2>{0.0462844148f, 0.340567023f},
-std::array<float,2>{0.150269389f, 0.618625224f},
-std::array<float,2>{0.608209193f, 0.444781989f},
-std::array<float,2>{0.87766993f, 0.848277152f},
-std::array<float,2>{0.292392254f, 0.184397817f},
-std::array<float,2>{0.0812323764f, 0.782068431f},
-std::array<float,2>{0.634916544f, 0.247609556f},
-std::array<float,2>{0.873004019f, 0.502616584f},
-std::array<float,2>{0.381641299f, 0.434322625f},
-std::array<float,2>{0.316638231f, 0.719037831f},
-std::array<float,2>{0.985666156f, 0.2778171f},
-std::array<float,2>{0.520199776f, 0.964499295f},
-std::array<float,2>{0.214927778f, 0.013822698f},
-std::array<float,2>{0.3575131f, 0.949507594f},
-std::array<float,2>{0.94810462f, 0.0198924802f},
-std::array<float,2>{0.538512051f, 0.741533697f},
-std::array<float,2>{0.229259714f, 0.255967736f},
-std::array<float,2>{0.112556547f, 0.524270117f},
-std::array<float,2>{0.685722053f, 0.418222964f},
-std::array<float,2>{0.82404393f, 0.797822237f},
-std::array<float,2>{0.437045395f, 0.223965406f},
-std::array<float,2>{0.16365993f, 0.868794322f},
-std::array<float,2>{0.591498494f, 0.164488256f},
-std::array<float,2>{0.935458779f, 0.596356153f},
-std::array<float,2>{0.261776239f, 0.459928662f},
-std::array<float,2>{0.440666348f, 0.652050555f},
-std::array<float,2>{0.765885472f, 0.326574415f},
-std::array<float,2>{0.73361069f, 0.925482213f},
-std::array<float,2>{0.0254121702f, 0.0695836619f},
-std::array<float,2>{0.395586699f, 0.771113694f},
-std::array<float,2>{0.850645006f, 0.205507442f},
-std::array<float,2>{0.650927782f, 0.543786168f},
-std::array<float,2>{0.076497972f, 0.391816229f},
-std::array<float,2>{0.19122164f, 0.718462408f},
-std::array<float,2>{0.512765288f, 0.293773323f},
-std::array<float,2>{0.982412577f, 0.978528559f},
-std::array<float,2>{0.341850698f, 0.0579075031f},
-std::array<float,2>{0.0609554723f, 0.891599357f},
-std::array<float,2>{0.718192101f, 0.096241571f},
-std::array<float,2>{0.786381364f, 0.668884158f},
-std::array<float,2>{0.49022302f, 0.372326851f},
-std::array<float,2>{0.305388838f, 0.567711413f},
-std::array<float,2>{0.893490076f, 0.489520609f},
-std::array<float,2>{0.62157768f, 0.812790096f},
-std::array<float,2>{0.128601149f, 0.145075113f},
-std::array<float,2>{0.319872737f, 0.848748982f},
-std::array<float,2>{0.986474812f, 0.184918165f},
-std::array<float,2>{0.523030221f, 0.617393196f},
-std::array<float,2>{0.218237236f, 0.44367975f},
-std::array<float,2>{0.0797469318f, 0.630673349f},
-std::array<float,2>{0.63311547f, 0.341211945f},
-std::array<float,2>{0.873283982f, 0.91349864f},
-std::array<float,2>{0.379218489f, 0.0860759616f},
-std::array<float,2>{0.150498182f, 0.963684857f},
-std::array<float,2>{0.60734123f, 0.0151138809f},
-std::array<float,2>{0.876653194f, 0.720113397f},
-std::array<float,2>{0.290284663f, 0.278617442f},
-std::array<float,2>{0.480484992f, 0.503691852f},
-std::array<float,2>{0.804851174f, 0.434641212f},
-std::array<float,2>{0.696917117f, 0.782705843f},
-std::array<float,2>{0.043404121f, 0.246389046f},
-std::array<float,2>{0.412213594f, 0.885392785f},
-std::array<float,2>{0.842099726f, 0.117197104f},
-std::array<float,2>{0.65675348f, 0.678362548f},
-std::array<float,2>{0.108765565f, 0.358955145f},
-std::array<float,2>{0.235526621f, 0.583059847f},
-std::array<float,2>{0.547505796f, 0.47580573f},
-std::array<float,2>{0.954371035f, 0.842888892f},
-std::array<float,2>{0.372044891f, 0.139800757f},
-std::array<float,2>{0.0135550797f, 0.765503764f},
-std::array<float,2>{0.749606669f, 0.193430215f},
-std::array<float,2>{0.764788389f, 0.560637653f},
-std::array<float,2>{0.453696698f, 0.382962376f},
-std::array<float,2>{0.27419126f, 0.696782649f},
-std::array<float,2>{0.920365036f, 0.297426879f},
-std::array<float,2>{0.576201558f, 0.985596538f},
-std::array<float,2>{0.186257288f, 0.0385547802f},
-std::array<float,2>{0.306862056f, 0.979648054f},
-std::array<float,2>{0.891215324f, 0.057260152f},
-std::array<float,2>{0.62411654f, 0.717329025f},
-std::array<float,2>{0.125233158f, 0.294639647f},
-std::array<float,2>{0.0587269254f, 0.544659436f},
-std::array<float,2>{0.716405213f, 0.390861928f},
-std::array<float,2>{0.787506223f, 0.769936502f},
-std::array<float,2>{0.490935057f, 0.206314117f},
-std::array<float,2>{0.18794173f, 0.814092875f},
-std::array<float,2>{0.514396787f, 0.146399289f},
-std::array<float,2>{0.982608795f, 0.567112148f},
-std::array<float,2>{0.340517819f, 0.488734305f},
-std::array<float,2>{0.397601217f, 0.669505477f},
-std::array<float,2>{0.848068833f, 0.371225744f},
-std::array<float,2>{0.649310589f, 0.891602278f},
-std::array<float,2>{0.0743493214f, 0.0974487737f},
-std::array<float,2>{0.437921792f, 0.798427165f},
-std::array<float,2>{0.76816231f, 0.222814322f},
-std::array<float,2>{0.731855154f, 0.52537173f},
-std::array<float,2>{0.0244084708f, 0.419039518f},
-std::array<float,2>{0.161147058f, 0.740485668f},
-std::array<float,2>{0.591878116f, 0.257376224f},
-std::array<float,2>{0.935689688f, 0.950371146f},
-std::array<float,2>{0.265452355f, 0.0209083501f},
-std::array<float,2>{0.110052265f, 0.924531221f},
-std::array<float,2>{0.684974194f, 0.0688018724f},
-std::array<float,2>{0.822149813f, 0.651234746f},
-std::array<float,2>{0.434247553f, 0.327660292f},
-std::array<float,2>{0.356618553f, 0.596704006f},
-std::array<float,2>{0.947042763f, 0.460448653f},
-std::array<float,2>{0.537103891f, 0.868147552f},
-std::array<float,2>{0.22840561f, 0.165847152f},
-std::array<float,2>{0.254496098f, 0.774545491f},
-std::array<float,2>{0.922607124f, 0.215223566f},
-std::array<float,2>{0.584325373f, 0.53895241f},
-std::array<float,2>{0.164677709f, 0.404577345f},
-std::array<float,2>{0.0230533797f, 0.707104146f},
-std::array<float,2>{0.718841314f, 0.285683483f},
-std::array<float,2>{0.778941333f, 0.974444628f},
-std::array<float,2>{0.449515551f, 0.0504815914f},
-std::array<float,2>{0.222134173f, 0.899285853f},
-std::array<float,2>{0.543463707f, 0.10358265f},
-std::array<float,2>{0.943152964f, 0.661123216f},
-std::array<float,2>{0.344728112f, 0.364032f},
-std::array<float,2>{0.428966701f, 0.57577014f},
-std::array<float,2>{0.818421066f, 0.492590457f},
-std::array<float,2>{0.6741696f, 0.821861804f},
-std::array<float,2>{0.121438496f, 0.148539692f},
-std::array<float,2>{0.4944534f, 0.940685034f},
-std::array<float,2>{0.795455575f, 0.0275250338f},
-std::array<float,2>{0.704797983f, 0.749973476f},
-std::array<float,2>{0.0495820642f, 0.25933823f},
-std::array<float,2>{0.133274958f, 0.523434937f},
-std::array<float,2>{0.611924887f, 0.411981523f},
-std::array<float,2>{0.898958981f, 0.811101913f},
-std::array<float,2>{0.299116343f, 0.22753796f},
-std::array<float,2>{0.0700858459f, 0.861673832f},
-std::array<float,2>{0.646843135f, 0.159797639f},
-std::array<float,2>{0.855802715f, 0.601844549f},
-std::array<float,2>{0.398857355f, 0.463258594f},
-std::array<float,2>{0.335133582f, 0.648032188f},
-std::array<float,2>{0.973368347f, 0.319009602f},
-std::array<float,2>{0.500987589f, 0.934054852f},
-std::array<float,2>{0.202846572f, 0.0707477033f},
-std::array<float,2>{0.363435984f, 0.917541862f},
-std::array<float,2>{0.963736653f, 0.0851707011f},
-std::array<float,2>{0.559404135f, 0.640202403f},
-std::array<float,2>{0.244669527f, 0.330386609f},
-std::array<float,2>{0.0959029943f, 0.616476953f},
-std::array<float,2>{0.670108259f, 0.451712012f},
-std::array<float,2>{0.831322074f, 0.85500288f},
-std::array<float,2>{0.417879373f, 0.178499922f},
-std::array<float,2>{0.179289103f, 0.791279674f},
-std::array<float,2>{0.565354824f, 0.240512863f},
-std::array<float,2>{0.913185656f, 0.511030972f},
-std::array<float,2>{0.272614658f, 0.428259373f},
-std::array<float,2>{0.462539703f, 0.729272425f},
-std::array<float,2>{0.752443552f, 0.271095991f},
-std::array<float,2>{0.740122795f, 0.956772685f},
-std::array<float,2>{0.00204899325f, 0.00396980625f},
-std::array<float,2>{0.38988632f, 0.835196137f},
-std::array<float,2>{0.860690355f, 0.130217239f},
-std::array<float,2>{0.626909673f, 0.589882612f},
-std::array<float,2>{0.0880730823f, 0.483031243f},
-std::array<float,2>{0.204618514f, 0.687482595f},
-std::array<float,2>{0.527801931f, 0.350410759f},
-std::array<float,2>{0.999632835f, 0.881140411f},
-std::array<float,2>{0.324395537f, 0.115604185f},
-std::array<float,2>{0.0339743719f, 0.995129704f},
-std::array<float,2>{0.694413185f, 0.0406609997f},
-std::array<float,2>{0.79728055f, 0.693201303f},
-std::array<float,2>{0.468825519f, 0.311090201f},
-std::array<float,2>{0.283688337f, 0.550911307f},
-std::array<float,2>{0.890020609f, 0.381784558f},
-std::array<float,2>{0.595980644f, 0.75338769f},
-std::array<float,2>{0.141271174f, 0.201202914f},
-std::array<float,2>{0.349110484f, 0.786795676f},
-std::array<float,2>{0.938439369f, 0.242836356f},
-std::array<float,2>{0.540962696f, 0.506741941f},
-std::array<float,2>{0.223190457f, 0.430490136f},
-std::array<float,2>{0.120139331f, 0.724575102f},
-std::array<float,2>{0.679367065f, 0.275688738f},
-std::array<float,2>{0.814009845f, 0.968275547f},
-std::array<float,2>{0.4239254f, 0.00810184143f},
-std::array<float,2>{0.168290213f, 0.907457232f},
-std::array<float,2>{0.580608249f, 0.0912286565f},
-std::array<float,2>{0.926519036f, 0.625963092f},
-std::array<float,2>{0.251508832f, 0.338424832f},
-std::array<float,2>{0.448083937f, 0.624458075f},
-std::array<float,2>{0.776577711f, 0.439539254f},
-std::array<float,2>{0.723688126f, 0.846962571f},
-std::array<float,2>{0.0179526396f, 0.18054755f},
-std::array<float,2>{0.402949512f, 0.992015481f},
-std::array<float,2>{0.855011702f, 0.0337505266f},
-std::array<float,2>{0.643622875f, 0.702946603f},
-std::array<float,2>{0.0629270822f, 0.304074615f},
-std::array<float,2>{0.198864564f, 0.555375755f},
-std::array<float,2>{0.506481409f, 0.388763636f},
-std::array<float,2>{0.970186353f, 0.760448694f},
-std::array<float,2>{0.330263436f, 0.189090744f},
-std::array<float,2>{0.0546823665f, 0.837478936f},
-std::array<float,2>{0.709369779f, 0.13286683f},
-std::array<float,2>{0.791269362f, 0.58152467f},
-std::array<float,2>{0.498242527f, 0.468766332f},
-std::array<float,2>{0.304344594f, 0.674195826f},
-std::array<float,2>{0.905389488f, 0.354194522f},
-std::array<float,2>{0.613961935f, 0.889349401f},
-std::array<float,2>{0.138229638f, 0.121504359f},
-std::array<float,2>{0.267065018f, 0.895567f},
-std::array<float,2>{0.909636557f, 0.0985105261f},
-std::array<float,2>{0.566661716f, 0.666554987f},
-std::array<float,2>{0.173152417f, 0.370231539f},
-std::array<float,2>{0.00643091882f, 0.562739968f},
-std::array<float,2>{0.737214744f, 0.486603558f},
-std::array<float,2>{0.757144749f, 0.816535652f},
-std::array<float,2>{0.466703594f, 0.142355353f},
-std::array<float,2>{0.249481574f, 0.766862988f},
-std::array<float,2>{0.556458473f, 0.208905354f},
-std::array<float,2>{0.966389716f, 0.540714383f},
-std::array<float,2>{0.362877816f, 0.396286488f},
-std::array<float,2>{0.421274811f, 0.714282095f},
-std::array<float,2>{0.832458794f, 0.290030479f},
-std::array<float,2>{0.666284621f, 0.98202306f},
-std::array<float,2>{0.099558562f, 0.0615072399f},
-std::array<float,2>{0.475661278f, 0.87282759f},
-std::array<float,2>{0.803632796f, 0.171280682f},
-std::array<float,2>{0.687718868f, 0.600236118f},
-std::array<float,2>{0.0388466865f, 0.454154521f},
-std::array<float,2>{0.147402629f, 0.654757142f},
-std::array<float,2>{0.601231694f, 0.322248787f},
-std::array<float,2>{0.882992983f, 0.928458095f},
-std::array<float,2>{0.287500352f, 0.0659928024f},
-std::array<float,2>{0.0930866078f, 0.94907999f},
-std::array<float,2>{0.630826831f, 0.018145591f},
-std::array<float,2>{0.866520822f, 0.737748146f},
-std::array<float,2>{0.38624981f, 0.253811359f},
-std::array<float,2>{0.322679579f, 0.529341102f},
-std::array<float,2>{0.995088816f, 0.416143119f},
-std::array<float,2>{0.524378598f, 0.802691936f},
-std::array<float,2>{0.209844261f, 0.222073093f},
-std::array<float,2>{0.296245128f, 0.826247215f},
-std::array<float,2>{0.879319251f, 0.154576868f},
-std::array<float,2>{0.605044842f, 0.573087931f},
-std::array<float,2>{0.155856252f, 0.498182714f},
-std::array<float,2>{0.0393873751f, 0.659713209f},
-std::array<float,2>{0.702910006f, 0.362119883f},
-std::array<float,2>{0.811979413f, 0.904519796f},
-std::array<float,2>{0.477245331f, 0.106490813f},
-std::array<float,2>{0.211187467f, 0.971889019f},
-std::array<float,2>{0.516381562f, 0.0525370091f},
-std::array<float,2>{0.988988161f, 0.70622915f},
-std::array<float,2>{0.313201398f, 0.284343839f},
-std::array<float,2>{0.377221912f, 0.533779919f},
-std::array<float,2>{0.867624879f, 0.399736017f},
-std::array<float,2>{0.638065636f, 0.778560281f},
-std::array<float,2>{0.0825989395f, 0.213102087f},
-std::array<float,2>{0.457932025f, 0.932063639f},
-std::array<float,2>{0.758002102f, 0.0771780387f},
-std::array<float,2>{0.744912565f, 0.641038358f},
-std::array<float,2>{0.00946158636f, 0.312771112f},
-std::array<float,2>{0.181528777f, 0.605624378f},
-std::array<float,2>{0.570997f, 0.467805743f},
-std::array<float,2>{0.916258931f, 0.866146386f},
-std::array<float,2>{0.279095203f, 0.161304444f},
-std::array<float,2>{0.102558933f, 0.806684136f},
-std::array<float,2>{0.662215412f, 0.233901888f},
-std::array<float,2>{0.836150587f, 0.51584965f},
-std::array<float,2>{0.40992257f, 0.409126401f},
-std::array<float,2>{0.369082868f, 0.743814826f},
-std::array<float,2>{0.957917809f, 0.262566864f},
-std::array<float,2>{0.554189563f, 0.944281578f},
-std::array<float,2>{0.239555553f, 0.0266900603f},
-std::array<float,2>{0.339225799f, 0.95819819f},
-std::array<float,2>{0.978910625f, 0.00048432505f},
-std::array<float,2>{0.509614825f, 0.730778396f},
-std::array<float,2>{0.191407219f, 0.267589629f},
-std::array<float,2>{0.0722709298f, 0.515276313f},
-std::array<float,2>{0.6553725f, 0.424718261f},
-std::array<float,2>{0.844996452f, 0.796158671f},
-std::array<float,2>{0.392790198f, 0.236489594f},
-std::array<float,2>{0.129859999f, 0.856481552f},
-std::array<float,2>{0.620271802f, 0.175371602f},
-std::array<float,2>{0.897954643f, 0.611100435f},
-std::array<float,2>{0.310097456f, 0.448981345f},
-std::array<float,2>{0.487175643f, 0.635139644f},
-std::array<float,2>{0.784075141f, 0.334740818f},
-std::array<float,2>{0.71408087f, 0.919884801f},
-std::array<float,2>{0.0559772514f, 0.0810408369f},
-std::array<float,2>{0.431555897f, 0.755396187f},
-std::array<float,2>{0.826906979f, 0.197416589f},
-std::array<float,2>{0.682978511f, 0.548466861f},
-std::array<float,2>{0.114488468f, 0.37776944f},
-std::array<float,2>{0.234154195f, 0.688203692f},
-std::array<float,2>{0.534967482f, 0.305795968f},
-std::array<float,2>{0.951287389f, 0.999578536f},
-std::array<float,2>{0.355348289f, 0.0461233221f},
-std::array<float,2>{0.0309048425f, 0.878734589f},
-std::array<float,2>{0.730145335f, 0.112804636f},
-std::array<float,2>{0.771907687f, 0.682511091f},
-std::array<float,2>{0.441608191f, 0.346554846f},
-std::array<float,2>{0.261503428f, 0.58653301f},
-std::array<float,2>{0.930433452f, 0.476698905f},
-std::array<float,2>{0.586423874f, 0.829931259f},
-std::array<float,2>{0.157414243f, 0.126525924f},
-std::array<float,2>{0.373957515f, 0.841697276f},
-std::array<float,2>{0.956304252f, 0.138015106f},
-std::array<float,2>{0.548870325f, 0.585627973f},
-std::array<float,2>{0.236660063f, 0.473452061f},
-std::array<float,2>{0.106101282f, 0.676895797f},
-std::array<float,2>{0.659697115f, 0.355833024f},
-std::array<float,2>{0.841754973f, 0.883417845f},
-std::array<float,2>{0.410974592f, 0.120082542f},
-std::array<float,2>{0.184201032f, 0.987250268f},
-std::array<float,2>{0.575073659f, 0.0361487754f},
-std::array<float,2>{0.91985333f, 0.698494554f},
-std::array<float,2>{0.275855333f, 0.299719959f},
-std::array<float,2>{0.45557642f, 0.558776259f},
-std::array<float,2>{0.762075365f, 0.386061341f},
-std::array<float,2>{0.747579932f, 0.763598979f},
-std::array<float,2>{0.0150336642f, 0.191567495f},
-std::array<float,2>{0.381423771f, 0.910464227f},
-std::array<float,2>{0.872665524f, 0.0881263837f},
-std::array<float,2>{0.635163724f, 0.632498801f},
-std::array<float,2>{0.0814229771f, 0.343225986f},
-std::array<float,2>{0.215187877f, 0.619415879f},
-std::array<float,2>{0.520344794f, 0.441469371f},
-std::array<float,2>{0.985586107f, 0.850400507f},
-std::array<float,2>{0.316842228f, 0.186652258f},
-std::array<float,2>{0.0461067967f, 0.785130262f},
-std::array<float,2>{0.697940886f, 0.248293236f},
-std::array<float,2>{0.808447897f, 0.501888633f},
-std::array<float,2>{0.483710438f, 0.43566826f},
-std::array<float,2>{0.292213678f, 0.72108525f},
-std::array<float,2>{0.8778736f, 0.27994442f},
-std::array<float,2>{0.607952058f, 0.961634576f},
-std::array<float,2>{0.149934918f, 0.0135669177f},
-std::array<float,2>{0.261970967f, 0.952788711f},
-std::array<float,2>{0.935283065f, 0.022012705f},
-std::array<float,2>{0.591741264f, 0.740040958f},
-std::array<float,2>{0.163896427f, 0.255072832f},
-std::array<float,2>{0.0258477796f, 0.52663815f},
-std::array<float,2>{0.733836055f, 0.420634061f},
-std::array<float,2>{0.765863359f, 0.800686538f},
-std::array<float,2>{0.440856755f, 0.224631295f},
-std::array<float,2>{0.229009986f, 0.869174361f},
-std::array<float,2>{0.538239002f, 0.16604729f},
-std::array<float,2>{0.947881758f, 0.59392482f},
-std::array<float,2>{0.357811749f, 0.458872736f},
-std::array<float,2>{0.4373824f, 0.649996102f},
-std::array<float,2>{0.823938966f, 0.325252324f},
-std::array<float,2>{0.685867548f, 0.923760533f},
-std::array<float,2>{0.112449437f, 0.0676189959f},
-std::array<float,2>{0.48978433f, 0.771766126f},
-std::array<float,2>{0.786184967f, 0.203416556f},
-std::array<float,2>{0.717904687f, 0.546636462f},
-std::array<float,2>{0.0606250465f, 0.39259094f},
-std::array<float,2>{0.128677741f, 0.716536045f},
-std::array<float,2>{0.621240497f, 0.295183897f},
-std::array<float,2>{0.893246531f, 0.977933466f},
-std::array<float,2>{0.305663198f, 0.0547066405f},
-std::array<float,2>{0.076211676f, 0.893624008f},
-std::array<float,2>{0.65129447f, 0.0952460766f},
-std::array<float,2>{0.851064861f, 0.670562387f},
-std::array<float,2>{0.395889759f, 0.374002844f},
-std::array<float,2>{0.342111558f, 0.568549991f},
-std::array<float,2>{0.982008576f, 0.491706491f},
-std::array<float,2>{0.513014376f, 0.815983593f},
-std::array<float,2>{0.19092986f, 0.147834167f},
-std::array<float,2>{0.297645777f, 0.808642685f},
-std::array<float,2>{0.90094173f, 0.228923768f},
-std::array<float,2>{0.610730708f, 0.520772099f},
-std::array<float,2>{0.135648549f, 0.413231432f},
-std::array<float,2>{0.0476849154f, 0.746098101f},
-std::array<float,2>{0.706215262f, 0.261626661f},
-std::array<float,2>{0.794176459f, 0.938176751f},
-std::array<float,2>{0.494009852f, 0.0308891125f},
-std::array<float,2>{0.199624464f, 0.936363935f},
-std::array<float,2>{0.503729343f, 0.0725800619f},
-std::array<float,2>{0.974675059f, 0.644857347f},
-std::array<float,2>{0.332970738f, 0.317641467f},
-std::array<float,2>{0.400493175f, 0.60504818f},
-std::array<float,2>{0.858354151f, 0.461550117f},
-std::array<float,2>{0.646345198f, 0.859891176f},
-std::array<float,2>{0.0677111447f, 0.156876087f},
-std::array<float,2>{0.452528507f, 0.975127757f},
-std::array<float,2>{0.78011179f, 0.0470637977f},
-std::array<float,2>{0.722259402f, 0.710866511f},
-std::array<float,2>{0.0207223129f, 0.288762987f},
-std::array<float,2>{0.167351022f, 0.536580861f},
-std::array<float,2>{0.582808733f, 0.402473778f},
-std::array<float,2>{0.924674749f, 0.775715292f},
-std::array<float,2>{0.25739345f, 0.218663618f},
-std::array<float,2>{0.12324325f, 0.823749304f},
-std::array<float,2>{0.673128486f, 0.152324945f},
-std::array<float,2>{0.816895783f, 0.576332808f},
-std::array<float,2>{0.427134842f, 0.49473086f},
-std::array<float,2>{0.346038133f, 0.663148642f},
-std::array<float,2>{0.943485737f, 0.366884351f},
-std::array<float,2>{0.545128644f, 0.901805282f},
-std::array<float,2>{0.219247878f, 0.102836326f},
-std::array<float,2>{0.328113437f, 0.880545199f},
-std::array<float,2>{0.997974813f, 0.113448575f},
-std::array<float,2>{0.530353844f, 0.683944464f},
-std::array<float,2>{0.206833273f, 0.347821444f},
-std::array<float,2>{0.0869445056f, 0.593402147f},
-std::array<float,2>{0.628028214f, 0.480815679f},
-std::array<float,2>{0.862744153f, 0.833765566f},
-std::array<float,2>{0.388106793f, 0.130937636f},
-std::array<float,2>{0.142981499f, 0.750278056f},
-std::array<float,2>{0.594850361f, 0.199854761f},
-std::array<float,2>{0.888334334f, 0.554237068f},
-std::array<float,2>{0.282743752f, 0.379923761f},
-std::array<float,2>{0.471008539f, 0.694476902f},
-std::array<float,2>{0.799195409f, 0.309010923f},
-std::array<float,2>{0.691702962f, 0.992318809f},
-std::array<float,2>{0.0325220078f, 0.0414567627f},
-std::array<float,2>{0.414527386f, 0.852230787f},
-std::array<float,2>{0.829443157f, 0.176381513f},
-std::array<float,2>{0.668173492f, 0.613865793f},
-std::array<float,2>{0.0942786112f, 0.449265957f},
-std::array<float,2>{0.243754104f, 0.638588428f},
-std::array<float,2>{0.562082648f, 0.329050273f},
-std::array<float,2>{0.961248398f, 0.915254235f},
-std::array<float,2>{0.365600944f, 0.0836185887f},
-std::array<float,2>{0.00166709675f, 0.954144895f},
-std::array<float,2>{0.740482926f, 0.00698911725f},
-std::array<float,2>{0.751318932f, 0.72717011f},
-std::array<float,2>{0.464199692f, 0.27292785f},
-std::array<float,2>{0.270760685f, 0.508570313f},
-std::array<float,2>{0.910875261f, 0.427389026f},
-std::array<float,2>{0.564233482f, 0.789651692f},
-std::array<float,2>{0.175963774f, 0.23838076f},
-std::array<float,2>{0.328599513f, 0.759402573f},
-std::array<float,2>{0.971334457f, 0.190925047f},
-std::array<float,2>{0.505621672f, 0.55773598f},
-std::array<float,2>{0.197232962f, 0.387648404f},
-std::array<float,2>{0.0658777878f, 0.700003088f},
-std::array<float,2>{0.642163754f, 0.301037937f},
-std::array<float,2>{0.852679789f, 0.988871872f},
-std::array<float,2>{0.405500531f, 0.0318307653f},
-std::array<float,2>{0.139058635f, 0.887182891f},
-std::array<float,2>{0.616925001f, 0.124251604f},
-std::array<float,2>{0.902407527f, 0.672139525f},
-std::array<float,2>{0.300911009f, 0.352383286f},
-std::array<float,2>{0.496155411f, 0.580052257f},
-std::array<float,2>{0.789633274f, 0.470945328f},
-std::array<float,2>{0.707611084f, 0.83802098f},
-std::array<float,2>{0.0512907766f, 0.135122254f},
-std::array<float,2>{0.422835737f, 0.965285003f},
-std::array<float,2>{0.815278053f, 0.0109345606f},
-std::array<float,2>{0.676814497f, 0.725521922f},
-std::array<float,2>{0.118658587f, 0.273760676f},
-std::array<float,2>{0.224939883f, 0.504579782f},
-std::array<float,2>{0.542876601f, 0.43353337f},
-std::array<float,2>{0.940606236f, 0.788130701f},
-std::array<float,2>{0.350820363f, 0.245218307f},
-std::array<float,2>{0.0156613067f, 0.844689429f},
-std::array<float,2>{0.726151288f, 0.182966411f},
-std::array<float,2>{0.775020003f, 0.622813284f},
-std::array<float,2>{0.446342617f, 0.43821153f},
-std::array<float,2>{0.252084315f, 0.628172755f},
-std::array<float,2>{0.928189397f, 0.336646795f},
-std::array<float,2>{0.579821527f, 0.908528507f},
-std::array<float,2>{0.171826765f, 0.0920691863f},
-std::array<float,2>{0.286200315f, 0.9268291f},
-std::array<float,2>{0.885272563f, 0.0639287233f},
-std::array<float,2>{0.598658681f, 0.653257549f},
-std::array<float,2>{0.144948676f, 0.323979557f},
-std::array<float,2>{0.0370370559f, 0.598572612f},
-std::array<float,2>{0.689524591f, 0.456487864f},
-std::array<float,2>{0.801731706f, 0.873377025f},
-std::array<float,2>{0.474401861f, 0.167979643f},
-std::array<float,2>{0.208102286f, 0.803297698f},
-std::array<float,2>{0.525507689f, 0.21916841f},
-std::array<float,2>{0.993022263f, 0.528419614f},
-std::array<float,2>{0.321576953f, 0.414642483f},
-std::array<float,2>{0.38342154f, 0.734395802f},
-std::array<float,2>{0.864061713f, 0.251112729f},
-std::array<float,2>{0.632405818f, 0.946959317f},
-std::array<float,2>{0.0901443213f, 0.017393684f},
-std::array<float,2>{0.467478603f, 0.820179284f},
-std::array<float,2>{0.753912926f, 0.144056007f},
-std::array<float,2>{0.735365152f, 0.565890074f},
-std::array<float,2>{0.00542413397f, 0.485399753f},
-std::array<float,2>{0.175747409f, 0.664485931f},
-std::array<float,2>{0.569512248f, 0.367979407f},
-std::array<float,2>{0.907407582f, 0.896692812f},
-std::array<float,2>{0.268036872f, 0.100368582f},
-std::array<float,2>{0.100442268f, 0.984292328f},
-std::array<float,2>{0.664822459f, 0.0600684509f},
-std::array<float,2>{0.835705101f, 0.711172462f},
-std::array<float,2>{0.418886065f, 0.292813271f},
-std::array<float,2>{0.360744298f, 0.541559219f},
-std::array<float,2>{0.96708709f, 0.39825353f},
-std::array<float,2>{0.557311893f, 0.768370986f},
-std::array<float,2>{0.248044625f, 0.20996733f},
-std::array<float,2>{0.280082315f, 0.864613414f},
-std::array<float,2>{0.91514045f, 0.163940862f},
-std::array<float,2>{0.572297096f, 0.608231902f},
-std::array<float,2>{0.182314381f, 0.4660272f},
-std::array<float,2>{0.0106877228f, 0.643839121f},
-std::array<float,2>{0.742997468f, 0.314619094f},
-std::array<float,2>{0.760609448f, 0.930283308f},
-std::array<float,2>{0.460186243f, 0.0748744681f},
-std::array<float,2>{0.241318792f, 0.942771256f},
-std::array<float,2>{0.55265522f, 0.0245893374f},
-std::array<float,2>{0.959896863f, 0.745162606f},
-std::array<float,2>{0.369207442f, 0.264028877f},
-std::array<float,2>{0.406941414f, 0.51916486f},
-std::array<float,2>{0.83856082f, 0.407610923f},
-std::array<float,2>{0.661725879f, 0.804750562f},
-std::array<float,2>{0.10430146f, 0.230727136f},
-std::array<float,2>{0.479951888f, 0.903886497f},
-std::array<float,2>{0.808973432f, 0.108956173f},
-std::array<float,2>{0.700110853f, 0.657127678f},
-std::array<float,2>{0.0420925356f, 0.360807151f},
-std::array<float,2>{0.153209627f, 0.570730388f},
-std::array<float,2>{0.602788866f, 0.497581929f},
-std::array<float,2>{0.882465482f, 0.824374557f},
-std::array<float,2>{0.294428796f, 0.152346998f},
-std::array<float,2>{0.0850797966f, 0.780256212f},
-std::array<float,2>{0.639185667f, 0.212138057f},
-std::array<float,2>{0.870850801f, 0.532518983f},
-std::array<float,2>{0.376799703f, 0.401638538f},
-std::array<float,2>{0.315236241f, 0.703968942f},
-std::array<float,2>{0.990832508f, 0.282166958f},
-std::array<float,2>{0.519259155f, 0.968791783f},
-std::array<float,2>{0.213947952f, 0.0529783852f},
-std::array<float,2>{0.353430152f, 0.99706614f},
-std::array<float,2>{0.949921131f, 0.0442463681f},
-std::array<float,2>{0.532065988f, 0.69047302f},
-std::array<float,2>{0.23227255f, 0.30731234f},
-std::array<float,2>{0.116858244f, 0.550031602f},
-std::array<float,2>{0.679742396f, 0.376275063f},
-std::array<float,2>{0.824593902f, 0.756336391f},
-std::array<float,2>{0.432468563f, 0.196273685f},
-std::array<float,2>{0.159376577f, 0.83105284f},
-std::array<float,2>{0.588592529f, 0.127403811f},
-std::array<float,2>{0.933423579f, 0.588104427f},
-std::array<float,2>{0.257922173f, 0.480261058f},
-std::array<float,2>{0.444238663f, 0.680641174f},
-std::array<float,2>{0.770035863f, 0.343802899f},
-std::array<float,2>{0.726699114f, 0.876085639f},
-std::array<float,2>{0.0282079577f, 0.109450281f},
-std::array<float,2>{0.391880095f, 0.794680476f},
-std::array<float,2>{0.846807003f, 0.235505745f},
-std::array<float,2>{0.654275715f, 0.512110651f},
-std::array<float,2>{0.0705015138f, 0.42372781f},
-std::array<float,2>{0.195122793f, 0.733354688f},
-std::array<float,2>{0.510400712f, 0.2667723f},
-std::array<float,2>{0.976646304f, 0.959594011f},
-std::array<float,2>{0.336781114f, 0.00322620408f},
-std::array<float,2>{0.0567252897f, 0.920370221f},
-std::array<float,2>{0.711642325f, 0.0784499124f},
-std::array<float,2>{0.782365441f, 0.633890927f},
-std::array<float,2>{0.484962016f, 0.332958281f},
-std::array<float,2>{0.311244994f, 0.611340404f},
-std::array<float,2>{0.894886196f, 0.446472019f},
-std::array<float,2>{0.618480325f, 0.859144509f},
-std::array<float,2>{0.131682843f, 0.172940746f},
-std::array<float,2>{0.341470748f, 0.815185905f},
-std::array<float,2>{0.983466029f, 0.147238582f},
-std::array<float,2>{0.51466471f, 0.569472075f},
-std::array<float,2>{0.188490748f, 0.490281641f},
-std::array<float,2>{0.0754346177f, 0.671670735f},
-std::array<float,2>{0.64948523f, 0.374126971f},
-std::array<float,2>{0.848684728f, 0.893465817f},
-std::array<float,2>{0.396527857f, 0.0942234322f},
-std::array<float,2>{0.126183763f, 0.976851583f},
-std::array<float,2>{0.623550415f, 0.0564667806f},
-std::array<float,2>{0.892110825f, 0.715731323f},
-std::array<float,2>{0.307903856f, 0.296237081f},
-std::array<float,2>{0.491626561f, 0.545694113f},
-std::array<float,2>{0.788800418f, 0.393686205f},
-std::array<float,2>{0.715069592f, 0.773430586f},
-std::array<float,2>{0.0596171916f, 0.204190239f},
-std::array<float,2>{0.435407281f, 0.921890378f},
-std::array<float,2>{0.821052313f, 0.0667339787f},
-std::array<float,2>{0.684470296f, 0.648998499f},
-std::array<float,2>{0.110398531f, 0.324965179f},
-std::array<float,2>{0.227138892f, 0.594863236f},
-std::array<float,2>{0.535516918f, 0.457215875f},
-std::array<float,2>{0.9454512f, 0.870917559f},
-std::array<float,2>{0.355886549f, 0.167637631f},
-std::array<float,2>{0.0246823896f, 0.799348593f},
-std::array<float,2>{0.73073715f, 0.226018608f},
-std::array<float,2>{0.768951893f, 0.525512159f},
-std::array<float,2>{0.438529879f, 0.421218663f},
-std::array<float,2>{0.264023542f, 0.738867223f},
-std::array<float,2>{0.93684417f, 0.254260659f},
-std::array<float,2>{0.593251824f, 0.951641321f},
-std::array<float,2>{0.160798669f, 0.0234139636f},
-std::array<float,2>{0.289971203f, 0.962231934f},
-std::array<float,2>{0.875659227f, 0.0121063814f},
-std::array<float,2>{0.605757177f, 0.722250998f},
-std::array<float,2>{0.151985213f, 0.281001866f},
-std::array<float,2>{0.0448873341f, 0.500722826f},
-std::array<float,2>{0.696009099f, 0.437405676f},
-std::array<float,2>{0.806507885f, 0.783535302f},
-std::array<float,2>{0.481812298f, 0.249931499f},
-std::array<float,2>{0.217355013f, 0.851206541f},
-std::array<float,2>{0.522446692f, 0.185988471f},
-std::array<float,2>{0.988195002f, 0.620424211f},
-std::array<float,2>{0.318584889f, 0.443257421f},
-std::array<float,2>{0.380376101f, 0.631655514f},
-std::array<float,2>{0.874469995f, 0.342369974f},
-std::array<float,2>{0.633863807f, 0.911760986f},
-std::array<float,2>{0.0785787106f, 0.0898379907f},
-std::array<float,2>{0.454980493f, 0.762142241f},
-std::array<float,2>{0.76446563f, 0.192822456f},
-std::array<float,2>{0.748363674f, 0.559675992f},
-std::array<float,2>{0.0121726561f, 0.385024428f},
-std::array<float,2>{0.186631486f, 0.698083341f},
-std::array<float,2>{0.577891588f, 0.3006998f},
-std::array<float,2>{0.921223044f, 0.98785603f},
-std::array<float,2>{0.274864316f, 0.0351777188f},
-std::array<float,2>{0.107701465f, 0.884671032f},
-std::array<float,2>{0.657614708f, 0.120728731f},
-std::array<float,2>{0.842869818f, 0.676578462f},
-std::array<float,2>{0.413302302f, 0.356459767f},
-std::array<float,2>{0.372649997f, 0.584788978f},
-std::array<float,2>{0.953630567f, 0.473911762f},
-std::array<float,2>{0.548467815f, 0.840399623f},
-std::array<float,2>{0.235142112f, 0.136916459f},
-std::array<float,2>{0.271692783f, 0.790596187f},
-std::array<float,2>{0.912438512f, 0.240178451f},
-std::array<float,2>{0.566315114f, 0.509483516f},
-std::array<float,2>{0.177868336f, 0.426202118f},
-std::array<float,2>{0.00310002803f, 0.72806555f},
-std::array<float,2>{0.738409996f, 0.27158457f},
-std::array<float,2>{0.753388941f, 0.953710794f},
-std::array<float,2>{0.461704701f, 0.00660971459f},
-std::array<float,2>{0.245303765f, 0.914086461f},
-std::array<float,2>{0.560149074f, 0.0826994777f},
-std::array<float,2>{0.964159608f, 0.637693524f},
-std::array<float,2>{0.364795804f, 0.329225689f},
-std::array<float,2>{0.416294634f, 0.614757538f},
-std::array<float,2>{0.830087066f, 0.450678319f},
-std::array<float,2>{0.67150861f, 0.852731347f},
-std::array<float,2>{0.0970153436f, 0.177662984f},
-std::array<float,2>{0.470435619f, 0.994128346f},
-std::array<float,2>{0.797858834f, 0.0428472795f},
-std::array<float,2>{0.693808973f, 0.693451345f},
-std::array<float,2>{0.0349069051f, 0.31026563f},
-std::array<float,2>{0.142574191f, 0.552995086f},
-std::array<float,2>{0.597433031f, 0.379373163f},
-std::array<float,2>{0.889572144f, 0.751494527f},
-std::array<float,2>{0.28446728f, 0.200603977f},
-std::array<float,2>{0.0894768611f, 0.832328081f},
-std::array<float,2>{0.625261962f, 0.132513747f},
-std::array<float,2>{0.860094309f, 0.592656314f},
-std::array<float,2>{0.388901651f, 0.481826901f},
-std::array<float,2>{0.325605005f, 0.685024858f},
-std::array<float,2>{0.998179615f, 0.349112362f},
-std::array<float,2>{0.528807878f, 0.87987119f},
-std::array<float,2>{0.20342885f, 0.114997f},
-std::array<float,2>{0.344724804f, 0.900762975f},
-std::array<float,2>{0.941787779f, 0.101843484f},
-std::array<float,2>{0.544398546f, 0.662884414f},
-std::array<float,2>{0.221558064f, 0.365664661f},
-std::array<float,2>{0.122901976f, 0.577474594f},
-std::array<float,2>{0.675237179f, 0.49551934f},
-std::array<float,2>{0.820028305f, 0.82311213f},
-std::array<float,2>{0.428454995f, 0.151062533f},
-std::array<float,2>{0.165849864f, 0.776652873f},
-std::array<float,2>{0.585562527f, 0.217704341f},
-std::array<float,2>{0.923119783f, 0.535878658f},
-std::array<float,2>{0.255761236f, 0.403594494f},
-std::array<float,2>{0.450357765f, 0.709332883f},
-std::array<float,2>{0.778242707f, 0.287487924f},
-std::array<float,2>{0.720128f, 0.976149559f},
-std::array<float,2>{0.0223788861f, 0.0484368466f},
-std::array<float,2>{0.399943292f, 0.861207247f},
-std::array<float,2>{0.856653273f, 0.157700315f},
-std::array<float,2>{0.647649944f, 0.604305923f},
-std::array<float,2>{0.0685115308f, 0.462731868f},
-std::array<float,2>{0.201644152f, 0.646202326f},
-std::array<float,2>{0.500682712f, 0.317379594f},
-std::array<float,2>{0.974607527f, 0.937479615f},
-std::array<float,2>{0.334778279f, 0.073596403f},
-std::array<float,2>{0.0501306802f, 0.939030766f},
-std::array<float,2>{0.704047322f, 0.0298381895f},
-std::array<float,2>{0.796610713f, 0.747134686f},
-std::array<float,2>{0.495812684f, 0.25991714f},
-std::array<float,2>{0.300044805f, 0.520467281f},
-std::array<float,2>{0.899537385f, 0.412144959f},
-std::array<float,2>{0.613216043f, 0.809597611f},
-std::array<float,2>{0.134404778f, 0.229854703f},
-std::array<float,2>{0.361781389f, 0.76953125f},
-std::array<float,2>{0.965565562f, 0.209721044f},
-std::array<float,2>{0.554798543f, 0.542021096f},
-std::array<float,2>{0.248257101f, 0.396894723f},
-std::array<float,2>{0.0982638076f, 0.712230206f},
-std::array<float,2>{0.66712445f, 0.291444451f},
-std::array<float,2>{0.833117425f, 0.982589185f},
-std::array<float,2>{0.420710146f, 0.0587958843f},
-std::array<float,2>{0.172772855f, 0.897952914f},
-std::array<float,2>{0.567431688f, 0.101332188f},
-std::array<float,2>{0.908378482f, 0.665922642f},
-std::array<float,2>{0.265886545f, 0.369043648f},
-std::array<float,2>{0.465157956f, 0.564640164f},
-std::array<float,2>{0.756415725f, 0.484599799f},
-std::array<float,2>{0.738013744f, 0.819014013f},
-std::array<float,2>{0.00769904349f, 0.143098474f},
-std::array<float,2>{0.385585517f, 0.945452571f},
-std::array<float,2>{0.865794897f, 0.0162406471f},
-std::array<float,2>{0.628932953f, 0.735750973f},
-std::array<float,2>{0.0925177485f, 0.250335336f},
-std::array<float,2>{0.21001789f, 0.52793014f},
-std::array<float,2>{0.525050759f, 0.415327311f},
-std::array<float,2>{0.995946229f, 0.804675639f},
-std::array<float,2>{0.32359919f, 0.220191896f},
-std::array<float,2>{0.037985377f, 0.874890983f},
-std::array<float,2>{0.68904084f, 0.169127375f},
-std::array<float,2>{0.804684341f, 0.59950155f},
-std::array<float,2>{0.475183815f, 0.455741256f},
-std::array<float,2>{0.288131982f, 0.654263675f},
-std::array<float,2>{0.884267628f, 0.32305035f},
-std::array<float,2>{0.600090921f, 0.926479876f},
-std::array<float,2>{0.14783439f, 0.0625220835f},
-std::array<float,2>{0.250878155f, 0.910048783f},
-std::array<float,2>{0.927431643f, 0.0930064246f},
-std::array<float,2>{0.58129257f, 0.627606452f},
-std::array<float,2>{0.169795662f, 0.337372452f},
-std::array<float,2>{0.0187074766f, 0.62119931f},
-std::array<float,2>{0.722758591f, 0.439365029f},
-std::array<float,2>{0.776107013f, 0.845237732f},
-std::array<float,2>{0.449072272f, 0.182179019f},
-std::array<float,2>{0.224259913f, 0.78717643f},
-std::array<float,2>{0.539679885f, 0.244528621f},
-std::array<float,2>{0.939338505f, 0.505544424f},
-std::array<float,2>{0.348387778f, 0.432113886f},
-std::array<float,2>{0.425761759f, 0.726255059f},
-std::array<float,2>{0.813074172f, 0.274759442f},
-std::array<float,2>{0.678663075f, 0.965885222f},
-std::array<float,2>{0.119658321f, 0.0106711155f},
-std::array<float,2>{0.499879956f, 0.839576662f},
-std::array<float,2>{0.792042255f, 0.13597849f},
-std::array<float,2>{0.710809529f, 0.579098284f},
-std::array<float,2>{0.0527442284f, 0.472100049f},
-std::array<float,2>{0.13765876f, 0.673751175f},
-std::array<float,2>{0.61451453f, 0.352861524f},
-std::array<float,2>{0.904675364f, 0.888596237f},
-std::array<float,2>{0.303397655f, 0.123122305f},
-std::array<float,2>{0.0634940192f, 0.989833176f},
-std::array<float,2>{0.642697155f, 0.0324792378f},
-std::array<float,2>{0.853597939f, 0.701096833f},
-std::array<float,2>{0.403626144f, 0.302115172f},
-std::array<float,2>{0.33172226f, 0.557495415f},
-std::array<float,2>{0.96875912f, 0.387696177f},
-std::array<float,2>{0.507117569f, 0.758263648f},
-std::array<float,2>{0.197719827f, 0.190189645f},
-std::array<float,2>{0.309002399f, 0.858287394f},
-std::array<float,2>{0.896514356f, 0.172017694f},
-std::array<float,2>{0.619512856f, 0.613262057f},
-std::array<float,2>{0.130097777f, 0.446260124f},
-std::array<float,2>{0.0546977706f, 0.63310492f},
-std::array<float,2>{0.713380516f, 0.333015919f},
-std::array<float,2>{0.784802377f, 0.921402931f},
-std::array<float,2>{0.488115579f, 0.0791506767f},
-std::array<float,2>{0.192996621f, 0.960586846f},
-std::array<float,2>{0.508085907f, 0.00262449915f},
-std::array<float,2>{0.980344832f, 0.733928204f},
-std::array<float,2>{0.33811596f, 0.266320586f},
-std::array<float,2>{0.394349754f, 0.51362431f},
-std::array<float,2>{0.84419328f, 0.422112167f},
-std::array<float,2>{0.655134976f, 0.793631375f},
-std::array<float,2>{0.0735926107f, 0.235264301f},
-std::array<float,2>{0.443202794f, 0.875702977f},
-std::array<float,2>{0.772639275f, 0.111147538f},
-std::array<float,2>{0.729250908f, 0.681040287f},
-std::array<float,2>{0.0297728684f, 0.344897926f},
-std::array<float,2>{0.156294614f, 0.58891964f},
-std::array<float,2>{0.587419152f, 0.47861591f},
-std::array<float,2>{0.930930972f, 0.831126273f},
-std::array<float,2>{0.260628253f, 0.12807779f},
-std::array<float,2>{0.113995023f, 0.757755876f},
-std::array<float,2>{0.681737721f, 0.196582332f},
-std::array<float,2>{0.827882051f, 0.549109757f},
-std::array<float,2>{0.430288702f, 0.375426978f},
-std::array<float,2>{0.354250938f, 0.689670861f},
-std::array<float,2>{0.952737331f, 0.308067173f},
-std::array<float,2>{0.534152746f, 0.99719429f},
-std::array<float,2>{0.232655078f, 0.0438369922f},
-std::array<float,2>{0.313932002f, 0.9706496f},
-std::array<float,2>{0.990192175f, 0.053973604f},
-std::array<float,2>{0.517309964f, 0.704455495f},
-std::array<float,2>{0.212761313f, 0.282259196f},
-std::array<float,2>{0.0832072571f, 0.532135308f},
-std::array<float,2>{0.636931598f, 0.400825411f},
-std::array<float,2>{0.868736506f, 0.781071782f},
-std::array<float,2>{0.378401518f, 0.210983798f},
-std::array<float,2>{0.154656872f, 0.82533884f},
-std::array<float,2>{0.604284286f, 0.154235527f},
-std::array<float,2>{0.880043209f, 0.571817696f},
-std::array<float,2>{0.294987559f, 0.496233642f},
-std::array<float,2>{0.477579534f, 0.657700777f},
-std::array<float,2>{0.810693681f, 0.359708309f},
-std::array<float,2>{0.702106237f, 0.90296936f},
-std::array<float,2>{0.0409585461f, 0.107926637f},
-std::array<float,2>{0.408249587f, 0.805794179f},
-std::array<float,2>{0.837797344f, 0.232248157f},
-std::array<float,2>{0.663321614f, 0.517594516f},
-std::array<float,2>{0.102254309f, 0.406304359f},
-std::array<float,2>{0.238768891f, 0.74503082f},
-std::array<float,2>{0.553611159f, 0.265439898f},
-std::array<float,2>{0.958288431f, 0.941738963f},
-std::array<float,2>{0.36754775f, 0.0241917782f},
-std::array<float,2>{0.00800828263f, 0.931555927f},
-std::array<float,2>{0.745629311f, 0.0756553933f},
-std::array<float,2>{0.759745181f, 0.643028557f},
-std::array<float,2>{0.458601505f, 0.315970629f},
-std::array<float,2>{0.277568549f, 0.608743072f},
-std::array<float,2>{0.917470694f, 0.464992106f},
-std::array<float,2>{0.571750998f, 0.863904834f},
-std::array<float,2>{0.18059288f, 0.162907928f},
-std::array<float,2>{0.359286129f, 0.868610561f},
-std::array<float,2>{0.948517621f, 0.164892018f},
-std::array<float,2>{0.53786999f, 0.595835745f},
-std::array<float,2>{0.229579687f, 0.459055841f},
-std::array<float,2>{0.111436658f, 0.651834428f},
-std::array<float,2>{0.686782837f, 0.32691291f},
-std::array<float,2>{0.822729945f, 0.924963176f},
-std::array<float,2>{0.43602854f, 0.0698286742f},
-std::array<float,2>{0.162435561f, 0.950070024f},
-std::array<float,2>{0.590492129f, 0.0203440227f},
-std::array<float,2>{0.93407917f, 0.742001653f},
-std::array<float,2>{0.263226628f, 0.256445378f},
-std::array<float,2>{0.439801335f, 0.523888946f},
-std::array<float,2>{0.767130196f, 0.418922335f},
-std::array<float,2>{0.732711494f, 0.797163546f},
-std::array<float,2>{0.0267372597f, 0.22414133f},
-std::array<float,2>{0.395027876f, 0.890694737f},
-std::array<float,2>{0.850290954f, 0.0957512781f},
-std::array<float,2>{0.651630044f, 0.667976201f},
-std::array<float,2>{0.0773878917f, 0.372813761f},
-std::array<float,2>{0.189965099f, 0.568128288f},
-std::array<float,2>{0.512228012f, 0.490114331f},
-std::array<float,2>{0.980588675f, 0.813269675f},
-std::array<float,2>{0.343424112f, 0.144567207f},
-std::array<float,2>{0.0620122142f, 0.770687699f},
-std::array<float,2>{0.716990113f, 0.205989614f},
-std::array<float,2>{0.785208762f, 0.543081462f},
-std::array<float,2>{0.489134103f, 0.392244846f},
-std::array<float,2>{0.305788398f, 0.718192339f},
-std::array<float,2>{0.89392966f, 0.292973846f},
-std::array<float,2>{0.622227788f, 0.979330242f},
-std::array<float,2>{0.127555221f, 0.0581936985f},
-std::array<float,2>{0.276607841f, 0.984637797f},
-std::array<float,2>{0.918805301f, 0.0380094945f},
-std::array<float,2>{0.57537812f, 0.695369661f},
-std::array<float,2>{0.184783444f, 0.298492819f},
-std::array<float,2>{0.0145563791f, 0.561901569f},
-std::array<float,2>{0.746647477f, 0.384544253f},
-std::array<float,2>{0.762777984f, 0.764388382f},
-std::array<float,2>{0.456086069f, 0.195081174f},
-std::array<float,2>{0.238278493f, 0.842265129f},
-std::array<float,2>{0.550613821f, 0.138820529f},
-std::array<float,2>{0.9556095f, 0.58253181f},
-std::array<float,2>{0.374236524f, 0.475318015f},
-std::array<float,2>{0.411610156f, 0.679325163f},
-std::array<float,2>{0.840657651f, 0.357938021f},
-std::array<float,2>{0.658326924f, 0.886138141f},
-std::array<float,2>{0.106466725f, 0.118387967f},
-std::array<float,2>{0.482818693f, 0.781304419f},
-std::array<float,2>{0.807493865f, 0.247162133f},
-std::array<float,2>{0.698783934f, 0.502034485f},
-std::array<float,2>{0.0457488783f, 0.433850318f},
-std::array<float,2>{0.148899689f, 0.719439864f},
-std::array<float,2>{0.609096706f, 0.27826041f},
-std::array<float,2>{0.878507793f, 0.964150131f},
-std::array<float,2>{0.291497469f, 0.0145311523f},
-std::array<float,2>{0.0804119557f, 0.912657142f},
-std::array<float,2>{0.636368871f, 0.0869549662f},
-std::array<float,2>{0.871590078f, 0.629757404f},
-std::array<float,2>{0.382067263f, 0.339915574f},
-std::array<float,2>{0.317581803f, 0.618999898f},
-std::array<float,2>{0.984509945f, 0.445097953f},
-std::array<float,2>{0.520706952f, 0.847762167f},
-std::array<float,2>{0.215854183f, 0.183992863f},
-std::array<float,2>{0.281286627f, 0.752264559f},
-std::array<float,2>{0.887390912f, 0.202566728f},
-std::array<float,2>{0.593957186f, 0.552233934f},
-std::array<float,2>{0.143795133f, 0.38201037f},
-std::array<float,2>{0.0314690694f, 0.691685319f},
-std::array<float,2>{0.692451477f, 0.312498003f},
-std::array<float,2>{0.800066411f, 0.994330168f},
-std::array<float,2>{0.472626388f, 0.0392174199f},
-std::array<float,2>{0.205132246f, 0.882259369f},
-std::array<float,2>{0.529802978f, 0.116673388f},
-std::array<float,2>{0.99648428f, 0.686199903f},
-std::array<float,2>{0.326378286f, 0.351014793f},
-std::array<float,2>{0.387233883f, 0.591185391f},
-std::array<float,2>{0.861600697f, 0.48434779f},
-std::array<float,2>{0.627328336f, 0.83447969f},
-std::array<float,2>{0.0864669383f, 0.1297521f},
-std::array<float,2>{0.463735104f, 0.955888093f},
-std::array<float,2>{0.750834227f, 0.00524644228f},
-std::array<float,2>{0.741872489f, 0.729853928f},
-std::array<float,2>{0.000946336135f, 0.27006197f},
-std::array<float,2>{0.177188501f, 0.509890318f},
-std::array<float,2>{0.562914252f, 0.428883612f},
-std::array<float,2>{0.911213577f, 0.792801917f},
-std::array<float,2>{0.269633263f, 0.241774976f},
-std::array<float,2>{0.0951956064f, 0.85440433f},
-std::array<float,2>{0.669212937f, 0.179329842f},
-std::array<float,2>{0.829032183f, 0.615294516f},
-std::array<float,2>{0.415160954f, 0.452903003f},
-std::array<float,2>{0.366736948f, 0.638823152f},
-std::array<float,2>{0.962709069f, 0.331111223f},
-std::array<float,2>{0.560967803f, 0.916074514f},
-std::array<float,2>{0.242241308f, 0.084189631f},
-std::array<float,2>{0.333911687f, 0.935406923f},
-std::array<float,2>{0.975613594f, 0.071449481f},
-std::array<float,2>{0.502273619f, 0.6473068f},
-std::array<float,2>{0.200650871f, 0.319596857f},
-std::array<float,2>{0.0664520189f, 0.603116632f},
-std::array<float,2>{0.645104647f, 0.463878989f},
-std::array<float,2>{0.858548224f, 0.862502158f},
-std::array<float,2>{0.40219596f, 0.158266261f},
-std::array<float,2>{0.136560619f, 0.812290847f},
-std::array<float,2>{0.609626591f, 0.227697343f},
-std::array<float,2>{0.901375353f, 0.521570504f},
-std::array<float,2>{0.29815197f, 0.410946399f},
-std::array<float,2>{0.492521077f, 0.748815179f},
-std::array<float,2>{0.793136716f, 0.258042455f},
-std::array<float,2>{0.705367386f, 0.940245569f},
-std::array<float,2>{0.0485000163f, 0.029028425f},
-std::array<float,2>{0.426471531f, 0.820420623f},
-std::array<float,2>{0.818256497f, 0.150065809f},
-std::array<float,2>{0.67190367f, 0.574412405f},
-std::array<float,2>{0.124704897f, 0.493300736f},
-std::array<float,2>{0.219914794f, 0.661428273f},
-std::array<float,2>{0.546075165f, 0.364783108f},
-std::array<float,2>{0.944932997f, 0.89961189f},
-std::array<float,2>{0.347616047f, 0.104632646f},
-std::array<float,2>{0.0202577394f, 0.973105669f},
-std::array<float,2>{0.721224248f, 0.049476739f},
-std::array<float,2>{0.780713797f, 0.708812058f},
-std::array<float,2>{0.451722503f, 0.286237895f},
-std::array<float,2>{0.256168783f, 0.537470102f},
-std::array<float,2>{0.924961686f, 0.405791521f},
-std::array<float,2>{0.583280206f, 0.773540199f},
-std::array<float,2>{0.16650638f, 0.216051117f},
-std::array<float,2>{0.320666879f, 0.801463366f},
-std::array<float,2>{0.99406445f, 0.221497014f},
-std::array<float,2>{0.526583493f, 0.531225562f},
-std::array<float,2>{0.207284674f, 0.417093128f},
-std::array<float,2>{0.091249302f, 0.736852527f},
-std::array<float,2>{0.631191254f, 0.252739459f},
-std::array<float,2>{0.864471316f, 0.948228836f},
-std::array<float,2>{0.383830875f, 0.0195278544f},
-std::array<float,2>{0.146185085f, 0.929330885f},
-std::array<float,2>{0.598259985f, 0.0653577f},
-std::array<float,2>{0.886490822f, 0.655964792f},
-std::array<float,2>{0.285816908f, 0.321163297f},
-std::array<float,2>{0.473243862f, 0.601319373f},
-std::array<float,2>{0.802542508f, 0.453464329f},
-std::array<float,2>{0.690470099f, 0.871680856f},
-std::array<float,2>{0.0358226597f, 0.170488134f},
-std::array<float,2>{0.419039816f, 0.981419265f},
-std::array<float,2>{0.834742188f, 0.0620406531f},
-std::array<float,2>{0.666014612f, 0.713497996f},
-std::array<float,2>{0.1012218f, 0.290466219f},
-std::array<float,2>{0.246349648f, 0.539530337f},
-std::array<float,2>{0.55815208f, 0.394765407f},
-std::array<float,2>{0.968438029f, 0.766106248f},
-std::array<float,2>{0.360216439f, 0.207277864f},
-std::array<float,2>{0.00482167536f, 0.818078101f},
-std::array<float,2>{0.735048234f, 0.140654787f},
-std::array<float,2>{0.755789936f, 0.563739359f},
-std::array<float,2>{0.468315661f, 0.487333626f},
-std::array<float,2>{0.268777877f, 0.667382002f},
-std::array<float,2>{0.907182336f, 0.369533837f},
-std::array<float,2>{0.568386614f, 0.89550066f},
-std::array<float,2>{0.174086004f, 0.0994570702f},
-std::array<float,2>{0.302434981f, 0.890406966f},
-std::array<float,2>{0.903449118f, 0.122143f},
-std::array<float,2>{0.615407109f, 0.675308406f},
-std::array<float,2>{0.139871716f, 0.354599237f},
-std::array<float,2>{0.0521169789f, 0.580851793f},
-std::array<float,2>{0.708022535f, 0.470497549f},
-std::array<float,2>{0.790223897f, 0.836828291f},
-std::array<float,2>{0.498030931f, 0.134105071f},
-std::array<float,2>{0.196250424f, 0.761437595f},
-std::array<float,2>{0.503939688f, 0.188419893f},
-std::array<float,2>{0.971770048f, 0.556221783f},
-std::array<float,2>{0.329145551f, 0.389838666f},
-std::array<float,2>{0.404744714f, 0.701597035f},
-std::array<float,2>{0.852118969f, 0.303265423f},
-std::array<float,2>{0.64146775f, 0.990932643f},
-std::array<float,2>{0.0650966614f, 0.0348317511f},
-std::array<float,2>{0.446123421f, 0.846233487f},
-std::array<float,2>{0.773507476f, 0.180826396f},
-std::array<float,2>{0.725174367f, 0.623466372f},
-std::array<float,2>{0.0166543461f, 0.441214323f},
-std::array<float,2>{0.170140952f, 0.626479685f},
-std::array<float,2>{0.578784585f, 0.339067131f},
-std::array<float,2>{0.929180026f, 0.906493425f},
-std::array<float,2>{0.25327149f, 0.0899137706f},
-std::array<float,2>{0.118162505f, 0.967633843f},
-std::array<float,2>{0.6761536f, 0.009351735f},
-std::array<float,2>{0.816377699f, 0.723344207f},
-std::array<float,2>{0.423402637f, 0.276687771f},
-std::array<float,2>{0.350317389f, 0.507257521f},
-std::array<float,2>{0.940136731f, 0.431302518f},
-std::array<float,2>{0.541380227f, 0.785736084f},
-std::array<float,2>{0.226140633f, 0.243865564f},
-std::array<float,2>{0.259679377f, 0.828613997f},
-std::array<float,2>{0.93181771f, 0.125782877f},
-std::array<float,2>{0.589636147f, 0.587375045f},
-std::array<float,2>{0.158586875f, 0.478165597f},
-std::array<float,2>{0.0285213757f, 0.683396816f},
-std::array<float,2>{0.727895141f, 0.346968919f},
-std::array<float,2>{0.770956814f, 0.87746352f},
-std::array<float,2>{0.444987327f, 0.112248547f},
-std::array<float,2>{0.23139888f, 0.998643994f},
-std::array<float,2>{0.532587111f, 0.044963263f},
-std::array<float,2>{0.950795352f, 0.68883884f},
-std::array<float,2>{0.352263153f, 0.305538207f},
-std::array<float,2>{0.432644367f, 0.547654212f},
-std::array<float,2>{0.825447083f, 0.37838909f},
-std::array<float,2>{0.681556165f, 0.754812896f},
-std::array<float,2>{0.115692392f, 0.19907093f},
-std::array<float,2>{0.485423386f, 0.91869235f},
-std::array<float,2>{0.782209098f, 0.0817953721f},
-std::array<float,2>{0.711961091f, 0.636252761f},
-std::array<float,2>{0.0580503158f, 0.335825771f},
-std::array<float,2>{0.13268432f, 0.610293806f},
-std::array<float,2>{0.618069291f, 0.447727174f},
-std::array<float,2>{0.89598012f, 0.855865061f},
-std::array<float,2>{0.312374473f, 0.174200103f},
-std::array<float,2>{0.072099179f, 0.795621336f},
-std::array<float,2>{0.652390599f, 0.238138229f},
-std::array<float,2>{0.846342504f, 0.51451987f},
-std::array<float,2>{0.391186655f, 0.424845994f},
-std::array<float,2>{0.337220669f, 0.731520653f},
-std::array<float,2>{0.97776258f, 0.269078106f},
-std::array<float,2>{0.511016369f, 0.957472682f},
-std::array<float,2>{0.193801597f, 0.00136922929f},
-std::array<float,2>{0.370605409f, 0.944606006f},
-std::array<float,2>{0.960215151f, 0.0263547413f},
-std::array<float,2>{0.551327586f, 0.742890596f},
-std::array<float,2>{0.240963891f, 0.263467342f},
-std::array<float,2>{0.104835615f, 0.517240465f},
-std::array<float,2>{0.660452664f, 0.409677446f},
-std::array<float,2>{0.83960247f, 0.808499753f},
-std::array<float,2>{0.407551199f, 0.232533783f},
-std::array<float,2>{0.182957768f, 0.86693573f},
-std::array<float,2>{0.573812604f, 0.160487056f},
-std::array<float,2>{0.914957523f, 0.606595099f},
-std::array<float,2>{0.280576617f, 0.467759728f},
-std::array<float,2>{0.459416747f, 0.642400563f},
-std::array<float,2>{0.760922492f, 0.313521534f},
-std::array<float,2>{0.744074464f, 0.933252394f},
-std::array<float,2>{0.0116070108f, 0.076453276f},
-std::array<float,2>{0.375958979f, 0.778274536f},
-std::array<float,2>{0.869572937f, 0.214380994f},
-std::array<float,2>{0.640326858f, 0.534750462f},
-std::array<float,2>{0.0847948864f, 0.398707837f},
-std::array<float,2>{0.213108301f, 0.70521611f},
-std::array<float,2>{0.517595768f, 0.284052789f},
-std::array<float,2>{0.991761029f, 0.971194923f},
-std::array<float,2>{0.315760821f, 0.0509896539f},
-std::array<float,2>{0.0413795114f, 0.905438244f},
-std::array<float,2>{0.700304687f, 0.105939426f},
-std::array<float,2>{0.810174108f, 0.659151018f},
-std::array<float,2>{0.479289412f, 0.362907261f},
-std::array<float,2>{0.29351756f, 0.574107468f},
-std::array<float,2>{0.880938351f, 0.499861926f},
-std::array<float,2>{0.602341473f, 0.8275792f},
-std::array<float,2>{0.153783485f, 0.155912757f},
-std::array<float,2>{0.334053487f, 0.862805307f},
-std::array<float,2>{0.973917842f, 0.158753246f},
-std::array<float,2>{0.500282586f, 0.60255003f},
-std::array<float,2>{0.202106446f, 0.464676112f},
-std::array<float,2>{0.0692943335f, 0.646778762f},
-std::array<float,2>{0.648432612f, 0.320095569f},
-std::array<float,2>{0.856985688f, 0.934837639f},
-std::array<float,2>{0.399493188f, 0.0722262487f},
-std::array<float,2>{0.134086311f, 0.939536035f},
-std::array<float,2>{0.61235863f, 0.028554732f},
-std::array<float,2>{0.900335073f, 0.74811995f},
-std::array<float,2>{0.300510049f, 0.258630604f},
-std::array<float,2>{0.495268524f, 0.522242129f},
-std::array<float,2>{0.796259522f, 0.410188377f},
-std::array<float,2>{0.703570008f, 0.811986089f},
-std::array<float,2>{0.0505977422f, 0.228085682f},
-std::array<float,2>{0.428121865f, 0.899969161f},
-std::array<float,2>{0.819649994f, 0.105155192f},
-std::array<float,2>{0.675436616f, 0.661925435f},
-std::array<float,2>{0.12218561f, 0.364398688f},
-std::array<float,2>{0.220846862f, 0.574950755f},
-std::array<float,2>{0.544644833f, 0.493987352f},
-std::array<float,2>{0.942013085f, 0.820909798f},
-std::array<float,2>{0.343910664f, 0.149708241f},
-std::array<float,2>{0.0215566084f, 0.774393678f},
-std::array<float,2>{0.720694363f, 0.21661222f},
-std::array<float,2>{0.777690887f, 0.537696838f},
-std::array<float,2>{0.450893432f, 0.40547365f},
-std::array<float,2>{0.254903287f, 0.708122909f},
-std::array<float,2>{0.92351222f, 0.286758304f},
-std::array<float,2>{0.585354745f, 0.973481715f},
-std::array<float,2>{0.165324911f, 0.0490216613f},
-std::array<float,2>{0.284750313f, 0.994806528f},
-std::array<float,2>{0.889028072f, 0.0396733545f},
-std::array<float,2>{0.596865833f, 0.692224383f},
-std::array<float,2>{0.141850948f, 0.311714232f},
-std::array<float,2>{0.0345890634f, 0.552580416f},
-std::array<float,2>{0.693952441f, 0.38235715f},
-std::array<float,2>{0.798408031f, 0.752458453f},
-std::array<float,2>{0.470099896f, 0.202652723f},
-std::array<float,2>{0.203933969f, 0.834362864f},
-std::array<float,2>{0.529033422f, 0.128971487f},
-std::array<float,2>{0.999005377f, 0.591481447f},
-std::array<float,2>{0.325898319f, 0.483462006f},
-std::array<float,2>{0.389609247f, 0.685774505f},
-std::array<float,2>{0.859465003f, 0.351404577f},
-std::array<float,2>{0.625706077f, 0.882566333f},
-std::array<float,2>{0.089158684f, 0.116865531f},
-std::array<float,2>{0.461108208f, 0.792131126f},
-std::array<float,2>{0.753797174f, 0.241612345f},
-std::array<float,2>{0.738904655f, 0.510314286f},
-std::array<float,2>{0.00379908318f, 0.429309696f},
-std::array<float,2>{0.178442404f, 0.730046868f},
-std::array<float,2>{0.565447569f, 0.269902408f},
-std::array<float,2>{0.912842512f, 0.955140591f},
-std::array<float,2>{0.272446692f, 0.00564452307f},
-std::array<float,2>{0.0974014625f, 0.916549087f},
-std::array<float,2>{0.67137152f, 0.0849065036f},
-std::array<float,2>{0.830770135f, 0.639266193f},
-std::array<float,2>{0.416955382f, 0.331597358f},
-std::array<float,2>{0.364727706f, 0.616150677f},
-std::array<float,2>{0.964555919f, 0.452232689f},
-std::array<float,2>{0.559766829f, 0.853598535f},
-std::array<float,2>{0.245699227f, 0.179128766f},
-std::array<float,2>{0.275100142f, 0.763852835f},
-std::array<float,2>{0.92174834f, 0.194388047f},
-std::array<float,2>{0.577399492f, 0.56206429f},
-std::array<float,2>{0.187409595f, 0.384020418f},
-std::array<float,2>{0.0126386071f, 0.696081996f},
-std::array<float,2>{0.749001861f, 0.298278898f},
-std::array<float,2>{0.764134109f, 0.985070944f},
-std::array<float,2>{0.454414994f, 0.0374079198f},
-std::array<float,2>{0.234731972f, 0.886234164f},
-std::array<float,2>{0.547869265f, 0.118875086f},
-std::array<float,2>{0.953552902f, 0.678856909f},
-std::array<float,2>{0.372480482f, 0.357718468f},
-std::array<float,2>{0.413639486f, 0.582300842f},
-std::array<float,2>{0.84340626f, 0.474949211f},
-std::array<float,2>{0.658157051f, 0.842581093f},
-std::array<float,2>{0.108312935f, 0.139172181f},
-std::array<float,2>{0.482237935f, 0.964822769f},
-std::array<float,2>{0.80596596f, 0.013921014f},
-std::array<float,2>{0.695325255f, 0.718975782f},
-std::array<float,2>{0.0442711599f, 0.27735886f},
-std::array<float,2>{0.151791945f, 0.502703369f},
-std::array<float,2>{0.606194496f, 0.434538424f},
-std::array<float,2>{0.875458777f, 0.781758189f},
-std::array<float,2>{0.289495707f, 0.247957125f},
-std::array<float,2>{0.0786819384f, 0.848392367f},
-std::array<float,2>{0.634548604f, 0.184243619f},
-std::array<float,2>{0.874972582f, 0.618274152f},
-std::array<float,2>{0.380187631f, 0.444424629f},
-std::array<float,2>{0.319008887f, 0.629339993f},
-std::array<float,2>{0.987378657f, 0.340631694f},
-std::array<float,2>{0.52166611f, 0.912115812f},
-std::array<float,2>{0.217254624f, 0.0875609443f},
-std::array<float,2>{0.356000364f, 0.925739706f},
-std::array<float,2>{0.946185052f, 0.0695344657f},
-std::array<float,2>{0.5360111f, 0.652287424f},
-std::array<float,2>{0.226726219f, 0.326376259f},
-std::array<float,2>{0.11118643f, 0.596635818f},
-std::array<float,2>{0.683705807f, 0.459648788f},
-std::array<float,2>{0.820434332f, 0.869113982f},
-std::array<float,2>{0.435056418f, 0.16422829f},
-std::array<float,2>{0.160414577f, 0.797365546f},
-std::array<float,2>{0.593647897f, 0.223794356f},
-std::array<float,2>{0.937427044f, 0.524135232f},
-std::array<float,2>{0.264501363f, 0.418190628f},
-std::array<float,2>{0.439446539f, 0.74132365f},
-std::array<float,2>{0.76907146f, 0.256331354f},
-std::array<float,2>{0.731200516f, 0.949332714f},
-std::array<float,2>{0.0250233263f, 0.0196513794f},
-std::array<float,2>{0.397416055f, 0.812556624f},
-std::array<float,2>{0.849220514f, 0.145274177f},
-std::array<float,2>{0.65026176f, 0.567626357f},
-std::array<float,2>{0.0761040971f, 0.489495128f},
-std::array<float,2>{0.189103201f, 0.668629766f},
-std::array<float,2>{0.51548785f, 0.372280627f},
-std::array<float,2>{0.98422879f, 0.891349852f},
-std::array<float,2>{0.341036141f, 0.0964700878f},
-std::array<float,2>{0.0602321886f, 0.978896499f},
-std::array<float,2>{0.715818703f, 0.0576528423f},
-std::array<float,2>{0.788384378f, 0.718666315f},
-std::array<float,2>{0.492065132f, 0.293619722f},
-std::array<float,2>{0.308312833f, 0.543480039f},
-std::array<float,2>{0.892041206f, 0.391928285f},
-std::array<float,2>{0.6231336f, 0.771315098f},
-std::array<float,2>{0.126608431f, 0.205295905f},
-std::array<float,2>{0.368114084f, 0.807677209f},
-std::array<float,2>{0.958868682f, 0.233111054f},
-std::array<float,2>{0.552996218f, 0.516859174f},
-std::array<float,2>{0.238956168f, 0.409310281f},
-std::array<float,2>{0.101760797f, 0.742402494f},
-std::array<float,2>{0.663584232f, 0.263109148f},
-std::array<float,2>{0.836931288f, 0.94527334f},
-std::array<float,2>{0.408949286f, 0.0255483147f},
-std::array<float,2>{0.180102766f, 0.932665944f},
-std::array<float,2>{0.571908057f, 0.0770106763f},
-std::array<float,2>{0.917776942f, 0.641783476f},
-std::array<float,2>{0.278292686f, 0.314425856f},
-std::array<float,2>{0.45818004f, 0.607079148f},
-std::array<float,2>{0.75903368f, 0.466985613f},
-std::array<float,2>{0.745393157f, 0.86632967f},
-std::array<float,2>{0.00831487495f, 0.161124483f},
-std::array<float,2>{0.378696233f, 0.9710657f},
-std::array<float,2>{0.868472636f, 0.0515361093f},
-std::array<float,2>{0.637481809f, 0.70599997f},
-std::array<float,2>{0.0837328658f, 0.283574045f},
-std::array<float,2>{0.212150991f, 0.534407079f},
-std::array<float,2>{0.516999125f, 0.398971319f},
-std::array<float,2>{0.98926425f, 0.777603924f},
-std::array<float,2>{0.314127415f, 0.213994116f},
-std::array<float,2>{0.0401975513f, 0.828071296f},
-std::array<float,2>{0.701300085f, 0.1557464f},
-std::array<float,2>{0.811496317f, 0.573720336f},
-std::array<float,2>{0.478180885f, 0.49937126f},
-std::array<float,2>{0.295592546f, 0.658689439f},
-std::array<float,2>{0.880740345f, 0.36261642f},
-std::array<float,2>{0.603936076f, 0.905948997f},
-std::array<float,2>{0.154906452f, 0.106246494f},
-std::array<float,2>{0.259830594f, 0.877084732f},
-std::array<float,2>{0.931504488f, 0.111529075f},
-std::array<float,2>{0.587337852f, 0.683091819f},
-std::array<float,2>{0.156784937f, 0.347645938f},
-std::array<float,2>{0.0298021417f, 0.587500572f},
-std::array<float,2>{0.72854805f, 0.477981836f},
-std::array<float,2>{0.773335814f, 0.828316808f},
-std::array<float,2>{0.442411214f, 0.125367433f},
-std::array<float,2>{0.233053744f, 0.754273415f},
-std::array<float,2>{0.533354223f, 0.198667571f},
-std::array<float,2>{0.952174783f, 0.547229111f},
-std::array<float,2>{0.353825301f, 0.378783375f},
-std::array<float,2>{0.429697961f, 0.68936187f},
-std::array<float,2>{0.827321172f, 0.305064529f},
-std::array<float,2>{0.682185829f, 0.998488605f},
-std::array<float,2>{0.113457792f, 0.0458925404f},
-std::array<float,2>{0.487344116f, 0.856216848f},
-std::array<float,2>{0.784527361f, 0.174620152f},
-std::array<float,2>{0.712961197f, 0.609375119f},
-std::array<float,2>{0.0551811792f, 0.448069662f},
-std::array<float,2>{0.130468339f, 0.636043429f},
-std::array<float,2>{0.620041728f, 0.335126907f},
-std::array<float,2>{0.897326887f, 0.918173373f},
-std::array<float,2>{0.309536099f, 0.0810789838f},
-std::array<float,2>{0.0740900114f, 0.957922578f},
-std::array<float,2>{0.654518485f, 0.00187612034f},
-std::array<float,2>{0.844325304f, 0.732336342f},
-std::array<float,2>{0.394041568f, 0.268859297f},
-std::array<float,2>{0.338430285f, 0.513830662f},
-std::array<float,2>{0.979584217f, 0.425498843f},
-std::array<float,2>{0.508437157f, 0.795303881f},
-std::array<float,2>{0.192519903f, 0.237353325f},
-std::array<float,2>{0.302864283f, 0.836046338f},
-std::array<float,2>{0.905051291f, 0.134279311f},
-std::array<float,2>{0.615061522f, 0.580538809f},
-std::array<float,2>{0.136754125f, 0.469828993f},
-std::array<float,2>{0.0536699481f, 0.674848974f},
-std::array<float,2>{0.710248947f, 0.355365217f},
-std::array<float,2>{0.79277575f, 0.889673114f},
-std::array<float,2>{0.499151886f, 0.122617736f},
-std::array<float,2>{0.198192373f, 0.990314066f},
-std::array<float,2>{0.507506013f, 0.0344525315f},
-std::array<float,2>{0.969356358f, 0.701671124f},
-std::array<float,2>{0.331110686f, 0.302940667f},
-std::array<float,2>{0.403809607f, 0.555996239f},
-std::array<float,2>{0.85409826f, 0.390191883f},
-std::array<float,2>{0.643238664f, 0.760899067f},
-std::array<float,2>{0.064425379f, 0.187887728f},
-std::array<float,2>{0.448580235f, 0.906762123f},
-std::array<float,2>{0.775758445f, 0.0904048309f},
-std::array<float,2>{0.723410487f, 0.626097679f},
-std::array<float,2>{0.0191025995f, 0.339636862f},
-std::array<float,2>{0.169094607f, 0.62373805f},
-std::array<float,2>{0.581905603f, 0.440680444f},
-std::array<float,2>{0.927134216f, 0.846123338f},
-std::array<float,2>{0.250023812f, 0.181327075f},
-std::array<float,2>{0.119523592f, 0.78547734f},
-std::array<float,2>{0.677759945f, 0.243542746f},
-std::array<float,2>{0.812874079f, 0.507489979f},
-std::array<float,2>{0.425071359f, 0.430679977f},
-std::array<float,2>{0.34794113f, 0.723131001f},
-std::array<float,2>{0.9387061f, 0.27690658f},
-std::array<float,2>{0.539178729f, 0.967077017f},
-std::array<float,2>{0.224043489f, 0.00922810473f},
-std::array<float,2>{0.324148983f, 0.947516263f},
-std::array<float,2>{0.995604634f, 0.0190085042f},
-std::array<float,2>{0.5248667f, 0.73661238f},
-std::array<float,2>{0.210720137f, 0.252188116f},
-std::array<float,2>{0.0918091238f, 0.530465782f},
-std::array<float,2>{0.629423857f, 0.417556643f},
-std::array<float,2>{0.86548245f, 0.801022947f},
-std::array<float,2>{0.385046452f, 0.220928609f},
-std::array<float,2>{0.148395509f, 0.871128857f},
-std::array<float,2>{0.600170076f, 0.170209736f},
-std::array<float,2>{0.884714663f, 0.600857675f},
-std::array<float,2>{0.288986385f, 0.453790754f},
-std::array<float,2>{0.474997252f, 0.655701041f},
-std::array<float,2>{0.803777277f, 0.320511162f},
-std::array<float,2>{0.688507617f, 0.929015756f},
-std::array<float,2>{0.0374847949f, 0.0648258179f},
-std::array<float,2>{0.420076609f, 0.766123533f},
-std::array<float,2>{0.833766103f, 0.2078899f},
-std::array<float,2>{0.667522252f, 0.539719939f},
-std::array<float,2>{0.0980146006f, 0.395260811f},
-std::array<float,2>{0.248661071f, 0.7132321f},
-std::array<float,2>{0.555620849f, 0.290597796f},
-std::array<float,2>{0.965223908f, 0.980786264f},
-std::array<float,2>{0.362115532f, 0.0618388876f},
-std::array<float,2>{0.0072215125f, 0.894958735f},
-std::array<float,2>{0.737594545f, 0.0986674577f},
-std::array<float,2>{0.756001413f, 0.66777724f},
-std::array<float,2>{0.465574503f, 0.369659781f},
-std::array<float,2>{0.266332865f, 0.564330459f},
-std::array<float,2>{0.908820927f, 0.488051534f},
-std::array<float,2>{0.56804198f, 0.817502022f},
-std::array<float,2>{0.172077835f, 0.141273245f},
-std::array<float,2>{0.34673804f, 0.82270956f},
-std::array<float,2>{0.944621861f, 0.150613934f},
-std::array<float,2>{0.546718836f, 0.577882051f},
-std::array<float,2>{0.220221773f, 0.495650023f},
-std::array<float,2>{0.124319762f, 0.662529826f},
-std::array<float,2>{0.672648489f, 0.365869254f},
-std::array<float,2>{0.817808092f, 0.901300192f},
-std::array<float,2>{0.426113218f, 0.102122962f},
-std::array<float,2>{0.166271731f, 0.975931406f},
-std::array<float,2>{0.583860815f, 0.0480403788f},
-std::array<float,2>{0.925481975f, 0.709617138f},
-std::array<float,2>{0.256759614f, 0.287749261f},
-std::array<float,2>{0.451657683f, 0.535532415f},
-std::array<float,2>{0.780889392f, 0.404011965f},
-std::array<float,2>{0.720957339f, 0.777227461f},
-std::array<float,2>{0.0199408866f, 0.217155948f},
-std::array<float,2>{0.40181005f, 0.93681258f},
-std::array<float,2>{0.858919442f, 0.0738880038f},
-std::array<float,2>{0.64488101f, 0.645824671f},
-std::array<float,2>{0.0671634153f, 0.316496581f},
-std::array<float,2>{0.201151535f, 0.603729427f},
-std::array<float,2>{0.502739608f, 0.462100506f},
-std::array<float,2>{0.976130366f, 0.860743761f},
-std::array<float,2>{0.333178788f, 0.15780066f},
-std::array<float,2>{0.0478766225f, 0.810385048f},
-std::array<float,2>{0.705912054f, 0.230016038f},
-std::array<float,2>{0.793653607f, 0.519943953f},
-std::array<float,2>{0.493068516f, 0.412737608f},
-std::array<float,2>{0.298488379f, 0.747563601f},
-std::array<float,2>{0.902284265f, 0.260537356f},
-std::array<float,2>{0.609935701f, 0.938590825f},
-std::array<float,2>{0.135865048f, 0.0295950714f},
-std::array<float,2>{0.270218283f, 0.953415811f},
-std::array<float,2>{0.912092805f, 0.00600325735f},
-std::array<float,2>{0.563217878f, 0.727633059f},
-std::array<float,2>{0.17725268f, 0.272243172f},
-std::array<float,2>{0.000228521982f, 0.508827925f},
-std::array<float,2>{0.741691172f, 0.426482081f},
-std::array<float,2>{0.750095487f, 0.790445566f},
-std::array<float,2>{0.463286579f, 0.23971495f},
-std::array<float,2>{0.242973298f, 0.853059828f},
-std::array<float,2>{0.56115526f, 0.176997557f},
-std::array<float,2>{0.962064803f, 0.614458978f},
-std::array<float,2>{0.366473645f, 0.450957298f},
-std::array<float,2>{0.415886849f, 0.637127161f},
-std::array<float,2>{0.828384817f, 0.329905987f},
-std::array<float,2>{0.66976434f, 0.914765596f},
-std::array<float,2>{0.0953243151f, 0.0820944086f},
-std::array<float,2>{0.471979946f, 0.75135231f},
-std::array<float,2>{0.800307751f, 0.201059803f},
-std::array<float,2>{0.692883074f, 0.553429484f},
-std::array<float,2>{0.0318010934f, 0.379760534f},
-std::array<float,2>{0.144425899f, 0.694172263f},
-std::array<float,2>{0.594503999f, 0.309656024f},
-std::array<float,2>{0.886982143f, 0.993627131f},
-std::array<float,2>{0.281775743f, 0.0420877971f},
-std::array<float,2>{0.0860976949f, 0.878910959f},
-std::array<float,2>{0.627754927f, 0.11438293f},
-std::array<float,2>{0.861919463f, 0.685115695f},
-std::array<float,2>{0.386854082f, 0.349228829f},
-std::array<float,2>{0.32691595f, 0.592237175f},
-std::array<float,2>{0.99666971f, 0.482082725f},
-std::array<float,2>{0.529718161f, 0.832556427f},
-std::array<float,2>{0.205813751f, 0.132098123f},
-std::array<float,2>{0.291753769f, 0.784086406f},
-std::array<float,2>{0.8783198f, 0.249336764f},
-std::array<float,2>{0.608415008f, 0.500417471f},
-std::array<float,2>{0.149249449f, 0.436792433f},
-std::array<float,2>{0.0450796299f, 0.722103894f},
-std::array<float,2>{0.698295474f, 0.280620009f},
-std::array<float,2>{0.80667907f, 0.962819457f},
-std::array<float,2>{0.483167708f, 0.0125091234f},
-std::array<float,2>{0.216353759f, 0.911266506f},
-std::array<float,2>{0.521431446f, 0.0889266953f},
-std::array<float,2>{0.98531878f, 0.6312325f},
-std::array<float,2>{0.317897171f, 0.342125446f},
-std::array<float,2>{0.382777125f, 0.620761812f},
-std::array<float,2>{0.871188343f, 0.442520946f},
-std::array<float,2>{0.635815024f, 0.850933433f},
-std::array<float,2>{0.0808458552f, 0.186391994f},
-std::array<float,2>{0.45680508f, 0.987461805f},
-std::array<float,2>{0.763373017f, 0.0358698107f},
-std::array<float,2>{0.746454656f, 0.697715223f},
-std::array<float,2>{0.0139488485f, 0.299900293f},
-std::array<float,2>{0.185412049f, 0.560476243f},
-std::array<float,2>{0.575957179f, 0.385256708f},
-std::array<float,2>{0.918244481f, 0.762224019f},
-std::array<float,2>{0.27733168f, 0.193198755f},
-std::array<float,2>{0.107009515f, 0.84029305f},
-std::array<float,2>{0.658880174f, 0.13760981f},
-std::array<float,2>{0.840064228f, 0.584374011f},
-std::array<float,2>{0.411845565f, 0.474203199f},
-std::array<float,2>{0.374855608f, 0.676015019f},
-std::array<float,2>{0.95519191f, 0.357046038f},
-std::array<float,2>{0.550209165f, 0.884127736f},
-std::array<float,2>{0.23736012f, 0.120428473f},
-std::array<float,2>{0.343150586f, 0.892605066f},
-std::array<float,2>{0.981384039f, 0.09453962f},
-std::array<float,2>{0.511942863f, 0.671067715f},
-std::array<float,2>{0.189865962f, 0.37455833f},
-std::array<float,2>{0.0776557773f, 0.570308149f},
-std::array<float,2>{0.65192908f, 0.491193891f},
-std::array<float,2>{0.850036621f, 0.814459801f},
-std::array<float,2>{0.394709557f, 0.146718651f},
-std::array<float,2>{0.12725094f, 0.772491932f},
-std::array<float,2>{0.622618079f, 0.204732418f},
-std::array<float,2>{0.89444387f, 0.54511708f},
-std::array<float,2>{0.306539029f, 0.394109309f},
-std::array<float,2>{0.488338113f, 0.714876354f},
-std::array<float,2>{0.785728931f, 0.296802342f},
-std::array<float,2>{0.717599928f, 0.977081954f},
-std::array<float,2>{0.0617344342f, 0.0557105318f},
-std::array<float,2>{0.436083227f, 0.870531738f},
-std::array<float,2>{0.822866917f, 0.167405456f},
-std::array<float,2>{0.68722856f, 0.595495939f},
-std::array<float,2>{0.112039313f, 0.457883269f},
-std::array<float,2>{0.230256438f, 0.648481548f},
-std::array<float,2>{0.537446618f, 0.324523121f},
-std::array<float,2>{0.949057162f, 0.922656119f},
-std::array<float,2>{0.358800232f, 0.0670408309f},
-std::array<float,2>{0.0270679351f, 0.951736212f},
-std::array<float,2>{0.733084321f, 0.0228602812f},
-std::array<float,2>{0.767077267f, 0.73870945f},
-std::array<float,2>{0.440055788f, 0.254629046f},
-std::array<float,2>{0.262842536f, 0.526320875f},
-std::array<float,2>{0.934216619f, 0.421504468f},
-std::array<float,2>{0.59016639f, 0.79908669f},
-std::array<float,2>{0.162826017f, 0.226166129f},
-std::array<float,2>{0.316399813f, 0.780736446f},
-std::array<float,2>{0.991520226f, 0.211575598f},
-std::array<float,2>{0.518168747f, 0.531398296f},
-std::array<float,2>{0.21382831f, 0.401334465f},
-std::array<float,2>{0.0841923952f, 0.704941392f},
-std::array<float,2>{0.639985383f, 0.28294912f},
-std::array<float,2>{0.869757652f, 0.970071733f},
-std::array<float,2>{0.375023246f, 0.0543778762f},
-std::array<float,2>{0.153873637f, 0.902433932f},
-std::array<float,2>{0.601594388f, 0.107739419f},
-std::array<float,2>{0.881449282f, 0.657958388f},
-std::array<float,2>{0.293164074f, 0.360165745f},
-std::array<float,2>{0.47856921f, 0.571769536f},
-std::array<float,2>{0.809630454f, 0.496976912f},
-std::array<float,2>{0.70072943f, 0.825919569f},
-std::array<float,2>{0.0415860936f, 0.153443828f},
-std::array<float,2>{0.407766759f, 0.942155063f},
-std::array<float,2>{0.839324892f, 0.0235578958f},
-std::array<float,2>{0.660870731f, 0.74419874f},
-std::array<float,2>{0.105248637f, 0.264978051f},
-std::array<float,2>{0.240558326f, 0.518342614f},
-std::array<float,2>{0.551060021f, 0.406886637f},
-std::array<float,2>{0.960929215f, 0.806392968f},
-std::array<float,2>{0.371087492f, 0.23163116f},
-std::array<float,2>{0.011219399f, 0.863584518f},
-std::array<float,2>{0.743427932f, 0.162184551f},
-std::array<float,2>{0.761431217f, 0.608996212f},
-std::array<float,2>{0.459614098f, 0.465440542f},
-std::array<float,2>{0.281176776f, 0.643510818f},
-std::array<float,2>{0.914141536f, 0.31567347f},
-std::array<float,2>{0.573347092f, 0.931060553f},
-std::array<float,2>{0.183389693f, 0.0757340565f},
-std::array<float,2>{0.311615139f, 0.92093581f},
-std::array<float,2>{0.896322191f, 0.0799612775f},
-std::array<float,2>{0.617658973f, 0.633519709f},
-std::array<float,2>{0.131992489f, 0.333557904f},
-std::array<float,2>{0.0584442168f, 0.612453997f},
-std::array<float,2>{0.712482274f, 0.445423543f},
-std::array<float,2>{0.781388521f, 0.857803464f},
-std::array<float,2>{0.485847414f, 0.172784299f},
-std::array<float,2>{0.193863124f, 0.79308188f},
-std::array<float,2>{0.511380851f, 0.234648451f},
-std::array<float,2>{0.97836864f, 0.512797773f},
-std::array<float,2>{0.337516695f, 0.422483325f},
-std::array<float,2>{0.390844882f, 0.733482897f},
-std::array<float,2>{0.845936656f, 0.265711904f},
-std::array<float,2>{0.652996659f, 0.960105121f},
-std::array<float,2>{0.0715908706f, 0.00207650568f},
-std::array<float,2>{0.44465822f, 0.831954598f},
-std::array<float,2>{0.771091759f, 0.128707096f},
-std::array<float,2>{0.728352308f, 0.58982116f},
-std::array<float,2>{0.0291264094f, 0.47947827f},
-std::array<float,2>{0.159047902f, 0.68133992f},
-std::array<float,2>{0.589236796f, 0.345529944f},
-std::array<float,2>{0.932203174f, 0.8750754f},
-std::array<float,2>{0.259018332f, 0.110770524f},
-std::array<float,2>{0.116201371f, 0.997974455f},
-std::array<float,2>{0.680850923f, 0.0433506407f},
-std::array<float,2>{0.825989842f, 0.690275311f},
-std::array<float,2>{0.433248281f, 0.308433861f},
-std::array<float,2>{0.351823419f, 0.549742281f},
-std::array<float,2>{0.950618148f, 0.375557244f},
-std::array<float,2>{0.532914937f, 0.756896377f},
-std::array<float,2>{0.230855882f, 0.196944281f},
-std::array<float,2>{0.253751218f, 0.84485662f},
-std::array<float,2>{0.929264903f, 0.181676328f},
-std::array<float,2>{0.578125179f, 0.62187928f},
-std::array<float,2>{0.170864344f, 0.438579738f},
-std::array<float,2>{0.0175479259f, 0.627068579f},
-std::array<float,2>{0.725064158f, 0.33786732f},
-std::array<float,2>{0.774210513f, 0.9096421f},
-std::array<float,2>{0.445774764f, 0.0935236737f},
-std::array<float,2>{0.225771084f, 0.96650213f},
-std::array<float,2>{0.541702449f, 0.00989536662f},
-std::array<float,2>{0.9398911f, 0.726011395f},
-std::array<float,2>{0.349672526f, 0.275244385f},
-std::array<float,2>{0.42290923f, 0.504891098f},
-std::array<float,2>{0.815714538f, 0.432431281f},
-std::array<float,2>{0.676362932f, 0.787710309f},
-std::array<float,2>{0.11737667f, 0.244946763f},
-std::array<float,2>{0.497440904f, 0.887803376f},
-std::array<float,2>{0.790549099f, 0.123573095f},
-std::array<float,2>{0.708660722f, 0.672960877f},
-std::array<float,2>{0.0525096469f, 0.353392154f},
-std::array<float,2>{0.140573084f, 0.578355432f},
-std::array<float,2>{0.615861714f, 0.472626001f},
-std::array<float,2>{0.903957844f, 0.839298606f},
-std::array<float,2>{0.302233756f, 0.136641234f},
-std::array<float,2>{0.0647877976f, 0.758682787f},
-std::array<float,2>{0.640869737f, 0.189842433f},
-std::array<float,2>{0.851737142f, 0.557065368f},
-std::array<float,2>{0.405233085f, 0.388214231f},
-std::array<float,2>{0.329597354f, 0.70040828f},
-std::array<float,2>{0.972415984f, 0.302320153f},
-std::array<float,2>{0.504684567f, 0.989730597f},
-std::array<float,2>{0.19542712f, 0.0331957527f},
-std::array<float,2>{0.359466374f, 0.982915103f},
-std::array<float,2>{0.967880547f, 0.0590883829f},
-std::array<float,2>{0.5578565f, 0.712441742f},
-std::array<float,2>{0.246667996f, 0.291945308f},
-std::array<float,2>{0.100813426f, 0.542826474f},
-std::array<float,2>{0.665424943f, 0.397417843f},
-std::array<float,2>{0.834213614f, 0.769023478f},
-std::array<float,2>{0.419804305f, 0.209005535f},
-std::array<float,2>{0.174662486f, 0.818696797f},
-std::array<float,2>{0.568938792f, 0.142870471f},
-std::array<float,2>{0.906493425f, 0.565057278f},
-std::array<float,2>{0.269057691f, 0.485282004f},
-std::array<float,2>{0.468173206f, 0.665102184f},
-std::array<float,2>{0.755193412f, 0.368290544f},
-std::array<float,2>{0.734544158f, 0.897613883f},
-std::array<float,2>{0.00399723556f, 0.101062126f},
-std::array<float,2>{0.384387255f, 0.803808093f},
-std::array<float,2>{0.865005374f, 0.220610842f},
-std::array<float,2>{0.631464183f, 0.527643919f},
-std::array<float,2>{0.0914472863f, 0.415560603f},
-std::array<float,2>{0.207884073f, 0.736242235f},
-std::array<float,2>{0.527268171f, 0.250823319f},
-std::array<float,2>{0.993293524f, 0.94604367f},
-std::array<float,2>{0.32085675f, 0.0160994567f},
-std::array<float,2>{0.0353596397f, 0.926225424f},
-std::array<float,2>{0.691073418f, 0.0633509532f},
-std::array<float,2>{0.802006066f, 0.653520226f},
-std::array<float,2>{0.473100752f, 0.322278798f},
-std::array<float,2>{0.285345048f, 0.598993301f},
-std::array<float,2>{0.886183739f, 0.455323488f},
-std::array<float,2>{0.59780556f, 0.874415576f},
-std::array<float,2>{0.145896241f, 0.169638157f},
-std::array<float,2>{0.324750215f, 0.833481967f},
-std::array<float,2>{0.999448836f, 0.131784916f},
-std::array<float,2>{0.528237104f, 0.593224347f},
-std::array<float,2>{0.204140961f, 0.481166393f},
-std::array<float,2>{0.0887661949f, 0.684308767f},
-std::array<float,2>{0.626096606f, 0.348379374f},
-std::array<float,2>{0.861033201f, 0.880248845f},
-std::array<float,2>{0.390332878f, 0.11412932f},
-std::array<float,2>{0.14069429f, 0.99290812f},
-std::array<float,2>{0.596670151f, 0.0417408273f},
-std::array<float,2>{0.890356064f, 0.694859207f},
-std::array<float,2>{0.284141451f, 0.30928722f},
-std::array<float,2>{0.4695476f, 0.55378598f},
-std::array<float,2>{0.797668397f, 0.380813211f},
-std::array<float,2>{0.694886982f, 0.750962257f},
-std::array<float,2>{0.0333816484f, 0.199557155f},
-std::array<float,2>{0.41743505f, 0.915754139f},
-std::array<float,2>{0.831894934f, 0.0833616108f},
-std::array<float,2>{0.670618773f, 0.638094723f},
-std::array<float,2>{0.0963225737f, 0.328469604f},
-std::array<float,2>{0.24449192f, 0.613626778f},
-std::array<float,2>{0.558682859f, 0.449723363f},
-std::array<float,2>{0.962922037f, 0.851845741f},
-std::array<float,2>{0.363935471f, 0.176114142f},
-std::array<float,2>{0.00256189215f, 0.789070308f},
-std::array<float,2>{0.739352703f, 0.23915334f},
-std::array<float,2>{0.75209558f, 0.508199573f},
-std::array<float,2>{0.461969435f, 0.426930785f},
-std::array<float,2>{0.273324609f, 0.726953089f},
-std::array<float,2>{0.913970947f, 0.273033112f},
-std::array<float,2>{0.564456463f, 0.954827607f},
-std::array<float,2>{0.178753048f, 0.00761639234f},
-std::array<float,2>{0.29967466f, 0.937596619f},
-std::array<float,2>{0.898598969f, 0.0304653514f},
-std::array<float,2>{0.611475229f, 0.746730447f},
-std::array<float,2>{0.133609965f, 0.260836571f},
-std::array<float,2>{0.0490835086f, 0.521240473f},
-std::array<float,2>{0.704166293f, 0.413670987f},
-std::array<float,2>{0.795359969f, 0.8093279f},
-std::array<float,2>{0.495103806f, 0.229397491f},
-std::array<float,2>{0.202528343f, 0.859574616f},
-std::array<float,2>{0.501693785f, 0.156581149f},
-std::array<float,2>{0.973129451f, 0.604700804f},
-std::array<float,2>{0.335782021f, 0.461386174f},
-std::array<float,2>{0.399003685f, 0.645236552f},
-std::array<float,2>{0.856396794f, 0.317984492f},
-std::array<float,2>{0.647206903f, 0.935814202f},
-std::array<float,2>{0.069752872f, 0.0730549917f},
-std::array<float,2>{0.449741215f, 0.776311219f},
-std::array<float,2>{0.778425992f, 0.218243629f},
-std::array<float,2>{0.719356358f, 0.536925614f},
-std::array<float,2>{0.0229076855f, 0.402848065f},
-std::array<float,2>{0.164294228f, 0.710173488f},
-std::array<float,2>{0.584937334f, 0.288109392f},
-std::array<float,2>{0.922125936f, 0.974663973f},
-std::array<float,2>{0.254056901f, 0.0476224422f},
-std::array<float,2>{0.121988811f, 0.90196842f},
-std::array<float,2>{0.674624026f, 0.103127718f},
-std::array<float,2>{0.819263935f, 0.664039969f},
-std::array<float,2>{0.429662406f, 0.36647898f},
-std::array<float,2>{0.345395923f, 0.576707482f},
-std::array<float,2>{0.942791164f, 0.494270921f},
-std::array<float,2>{0.543445528f, 0.823514938f},
-std::array<float,2>{0.222496793f, 0.151735038f},
-std::array<float,2>{0.264975339f, 0.800011635f},
-std::array<float,2>{0.936382532f, 0.22520785f},
-std::array<float,2>{0.592547596f, 0.527142823f},
-std::array<float,2>{0.161786631f, 0.420407206f},
-std::array<float,2>{0.0236269888f, 0.739729106f},
-std::array<float,2>{0.732198119f, 0.255504012f},
-std::array<float,2>{0.767905295f, 0.952546418f},
-std::array<float,2>{0.438195467f, 0.0218410194f},
-std::array<float,2>{0.227715284f, 0.923063457f},
-std::array<float,2>{0.536462069f, 0.0682006553f},
-std::array<float,2>{0.946611702f, 0.649676919f},
-std::array<float,2>{0.357337177f, 0.326016366f},
-std::array<float,2>{0.433872879f, 0.594714999f},
-std::array<float,2>{0.821337461f, 0.458040237f},
-std::array<float,2>{0.685391545f, 0.870045185f},
-std::array<float,2>{0.109837323f, 0.166833743f},
-std::array<float,2>{0.490404487f, 0.978443384f},
-std::array<float,2>{0.787857473f, 0.0554761402f},
-std::array<float,2>{0.715993285f, 0.716262579f},
-std::array<float,2>{0.0592784435f, 0.29554525f},
-std::array<float,2>{0.125559434f, 0.546331108f},
-std::array<float,2>{0.62466836f, 0.393390357f},
-std::array<float,2>{0.890741587f, 0.772305369f},
-std::array<float,2>{0.307496846f, 0.203727961f},
-std::array<float,2>{0.0747552589f, 0.815455019f},
-std::array<float,2>{0.648734748f, 0.148070216f},
-std::array<float,2>{0.848536968f, 0.568979025f},
-std::array<float,2>{0.398224145f, 0.491317779f},
-std::array<float,2>{0.340228468f, 0.670203209f},
-std::array<float,2>{0.983292878f, 0.373279005f},
-std::array<float,2>{0.513801038f, 0.894439757f},
-std::array<float,2>{0.188080132f, 0.0950648487f},
-std::array<float,2>{0.371107638f, 0.883008659f},
-std::array<float,2>{0.95460546f, 0.119147889f},
-std::array<float,2>{0.547069252f, 0.677545071f},
-std::array<float,2>{0.236221716f, 0.356186509f},
-std::array<float,2>{0.108942024f, 0.585198581f},
-std::array<float,2>{0.656358242f, 0.473082036f},
-std::array<float,2>{0.842670739f, 0.840929687f},
-std::array<float,2>{0.412875712f, 0.138298899f},
-std::array<float,2>{0.185940877f, 0.76285398f},
-std::array<float,2>{0.576825261f, 0.192088515f},
-std::array<float,2>{0.920438528f, 0.559127331f},
-std::array<float,2>{0.273860902f, 0.386467755f},
-std::array<float,2>{0.453511178f, 0.699038863f},
-std::array<float,2>{0.765472591f, 0.29891324f},
-std::array<float,2>{0.749156356f, 0.986774385f},
-std::array<float,2>{0.013076324f, 0.0366656668f},
-std::array<float,2>{0.379449964f, 0.849938512f},
-std::array<float,2>{0.873857558f, 0.187327698f},
-std::array<float,2>{0.633378804f, 0.620037496f},
-std::array<float,2>{0.0791776031f, 0.442171782f},
-std::array<float,2>{0.218707517f, 0.631983399f},
-std::array<float,2>{0.522534251f, 0.343444735f},
-std::array<float,2>{0.987294793f, 0.91081202f},
-std::array<float,2>{0.319562018f, 0.0886636674f},
-std::array<float,2>{0.0435530283f, 0.960974932f},
-std::array<float,2>{0.696477056f, 0.0131052537f},
-std::array<float,2>{0.805385709f, 0.72122854f},
-std::array<float,2>{0.481372148f, 0.279662669f},
-std::array<float,2>{0.290798903f, 0.501361072f},
-std::array<float,2>{0.876264632f, 0.436413378f},
-std::array<float,2>{0.606530607f, 0.784203112f},
-std::array<float,2>{0.151027903f, 0.248717755f},
-std::array<float,2>{0.354767293f, 0.756655037f},
-std::array<float,2>{0.951963007f, 0.195722625f},
-std::array<float,2>{0.534563422f, 0.550504446f},
-std::array<float,2>{0.233880773f, 0.376938909f},
-std::array<float,2>{0.114909746f, 0.691115797f},
-std::array<float,2>{0.683226645f, 0.306717783f},
-std::array<float,2>{0.8265028f, 0.996199429f},
-std::array<float,2>{0.431091547f, 0.0447859392f},
-std::array<float,2>{0.157852411f, 0.876857936f},
-std::array<float,2>{0.58670181f, 0.109947398f},
-std::array<float,2>{0.929875433f, 0.680067241f},
-std::array<float,2>{0.26108709f, 0.344603956f},
-std::array<float,2>{0.442188412f, 0.588680148f},
-std::array<float,2>{0.772111595f, 0.479928195f},
-std::array<float,2>{0.729510188f, 0.830388904f},
-std::array<float,2>{0.0305337291f, 0.127488986f},
-std::array<float,2>{0.393076181f, 0.959309161f},
-std::array<float,2>{0.845616281f, 0.00356514845f},
-std::array<float,2>{0.655870616f, 0.73250401f},
-std::array<float,2>{0.0731719658f, 0.267321289f},
-std::array<float,2>{0.19192706f, 0.512492597f},
-std::array<float,2>{0.509022832f, 0.423063099f},
-std::array<float,2>{0.979459822f, 0.794300675f},
-std::array<float,2>{0.339622319f, 0.235870257f},
-std::array<float,2>{0.0561922267f, 0.858865976f},
-std::array<float,2>{0.714605749f, 0.173366085f},
-std::array<float,2>{0.783204556f, 0.611897469f},
-std::array<float,2>{0.486449689f, 0.447111994f},
-std::array<float,2>{0.309873104f, 0.634659111f},
-std::array<float,2>{0.897810996f, 0.332214713f},
-std::array<float,2>{0.620784581f, 0.920657992f},
-std::array<float,2>{0.129110441f, 0.0787318572f},
-std::array<float,2>{0.278326005f, 0.929928243f},
-std::array<float,2>{0.916659176f, 0.0745628923f},
-std::array<float,2>{0.570780277f, 0.644198298f},
-std::array<float,2>{0.180917203f, 0.315369129f},
-std::array<float,2>{0.00890099071f, 0.607710183f},
-std::array<float,2>{0.74426949f, 0.46678856f},
-std::array<float,2>{0.758386731f, 0.865016222f},
-std::array<float,2>{0.457423568f, 0.163366377f},
-std::array<float,2>{0.24013339f, 0.805566192f},
-std::array<float,2>{0.554562986f, 0.231004819f},
-std::array<float,2>{0.957447886f, 0.518905878f},
-std::array<float,2>{0.368406057f, 0.407945901f},
-std::array<float,2>{0.409656525f, 0.745925009f},
-std::array<float,2>{0.836733937f, 0.264433771f},
-std::array<float,2>{0.662786186f, 0.943267167f},
-std::array<float,2>{0.103045546f, 0.0250831787f},
-std::array<float,2>{0.476581544f, 0.824932873f},
-std::array<float,2>{0.812035322f, 0.153181046f},
-std::array<float,2>{0.702434897f, 0.5711959f},
-std::array<float,2>{0.0397478566f, 0.4971852f},
-std::array<float,2>{0.155697152f, 0.65663445f},
-std::array<float,2>{0.60451287f, 0.36108464f},
-std::array<float,2>{0.879742444f, 0.903467238f},
-std::array<float,2>{0.2964513f, 0.108777642f},
-std::array<float,2>{0.0821731314f, 0.969586968f},
-std::array<float,2>{0.638454854f, 0.0537048578f},
-std::array<float,2>{0.868032038f, 0.703374267f},
-std::array<float,2>{0.377455205f, 0.281503916f},
-std::array<float,2>{0.312933773f, 0.533069909f},
-std::array<float,2>{0.988682091f, 0.402327657f},
-std::array<float,2>{0.515731096f, 0.779502869f},
-std::array<float,2>{0.211754039f, 0.212809637f},
-std::array<float,2>{0.287628174f, 0.873761594f},
-std::array<float,2>{0.883444786f, 0.168471828f},
-std::array<float,2>{0.600695968f, 0.597802281f},
-std::array<float,2>{0.146621376f, 0.456914127f},
-std::array<float,2>{0.038444683f, 0.652806699f},
-std::array<float,2>{0.688091278f, 0.323646367f},
-std::array<float,2>{0.802769065f, 0.927618861f},
-std::array<float,2>{0.476430327f, 0.0642926916f},
-std::array<float,2>{0.209377572f, 0.946587622f},
-std::array<float,2>{0.523838997f, 0.0169607028f},
-std::array<float,2>{0.994590938f, 0.735188603f},
-std::array<float,2>{0.322838217f, 0.251782328f},
-std::array<float,2>{0.386032701f, 0.529264212f},
-std::array<float,2>{0.866737962f, 0.414453059f},
-std::array<float,2>{0.629972279f, 0.802802026f},
-std::array<float,2>{0.0936023295f, 0.21957919f},
-std::array<float,2>{0.466147244f, 0.897049904f},
-std::array<float,2>{0.757766604f, 0.0998479575f},
-std::array<float,2>{0.736738086f, 0.664902627f},
-std::array<float,2>{0.00589765329f, 0.367583394f},
-std::array<float,2>{0.173800915f, 0.566237688f},
-std::array<float,2>{0.567070425f, 0.485958695f},
-std::array<float,2>{0.909752429f, 0.819625437f},
-std::array<float,2>{0.267322689f, 0.14358303f},
-std::array<float,2>{0.0989081562f, 0.767969251f},
-std::array<float,2>{0.666788638f, 0.210694328f},
-std::array<float,2>{0.832713008f, 0.541198611f},
-std::array<float,2>{0.421647042f, 0.397779495f},
-std::array<float,2>{0.362496406f, 0.711848378f},
-std::array<float,2>{0.966240883f, 0.292163312f},
-std::array<float,2>{0.555931926f, 0.983865321f},
-std::array<float,2>{0.249599099f, 0.05968979f},
-std::array<float,2>{0.330574036f, 0.98850143f},
-std::array<float,2>{0.970686674f, 0.0316283442f},
-std::array<float,2>{0.5062747f, 0.699465275f},
-std::array<float,2>{0.198593184f, 0.301586211f},
-std::array<float,2>{0.0631395876f, 0.558163106f},
-std::array<float,2>{0.644363999f, 0.387067527f},
-std::array<float,2>{0.854631722f, 0.758877516f},
-std::array<float,2>{0.402556777f, 0.190603435f},
-std::array<float,2>{0.138158023f, 0.838546216f},
-std::array<float,2>{0.613704145f, 0.135705426f},
-std::array<float,2>{0.906090498f, 0.579244137f},
-std::array<float,2>{0.303893298f, 0.47134757f},
-std::array<float,2>{0.498791307f, 0.672500849f},
-std::array<float,2>{0.791582048f, 0.351737082f},
-std::array<float,2>{0.709958553f, 0.887239695f},
-std::array<float,2>{0.0541463085f, 0.124648742f},
-std::array<float,2>{0.424633592f, 0.788702846f},
-std::array<float,2>{0.813958824f, 0.245610729f},
-std::array<float,2>{0.678946674f, 0.503984749f},
-std::array<float,2>{0.12061768f, 0.432868809f},
-std::array<float,2>{0.22289741f, 0.724895298f},
-std::array<float,2>{0.540311813f, 0.274051338f},
-std::array<float,2>{0.937888861f, 0.965668499f},
-std::array<float,2>{0.349186897f, 0.0115704164f},
-std::array<float,2>{0.0184031855f, 0.909047425f},
-std::array<float,2>{0.724543393f, 0.0923357084f},
-std::array<float,2>{0.777256072f, 0.628433406f},
-std::array<float,2>{0.447289675f, 0.336346447f},
-std::array<float,2>{0.251265734f, 0.622323453f},
-std::array<float,2>{0.925865412f, 0.437635392f},
-std::array<float,2>{0.580407977f, 0.843932688f},
-std::array<float,2>{0.168743223f, 0.183582678f},
-std::array<float,2>{0.365971148f, 0.854934573f},
-std::array<float,2>{0.961545885f, 0.178134426f},
-std::array<float,2>{0.561681032f, 0.616954684f},
-std::array<float,2>{0.243641734f, 0.451564997f},
-std::array<float,2>{0.094029732f, 0.639975369f},
-std::array<float,2>{0.668913126f, 0.330583334f},
-std::array<float,2>{0.829638124f, 0.917078316f},
-std::array<float,2>{0.414731055f, 0.0855389759f},
-std::array<float,2>{0.176656306f, 0.95641768f},
-std::array<float,2>{0.563697636f, 0.00462501589f},
-std::array<float,2>{0.910618126f, 0.728962004f},
-std::array<float,2>{0.271078885f, 0.270727843f},
-std::array<float,2>{0.464680105f, 0.511631966f},
-std::array<float,2>{0.751784623f, 0.428019345f},
-std::array<float,2>{0.740885973f, 0.791840494f},
-std::array<float,2>{0.0011892207f, 0.241111338f},
-std::array<float,2>{0.388400495f, 0.881364644f},
-std::array<float,2>{0.863124073f, 0.115776859f},
-std::array<float,2>{0.628534257f, 0.686534941f},
-std::array<float,2>{0.0875758752f, 0.350012571f},
-std::array<float,2>{0.206160575f, 0.590490341f},
-std::array<float,2>{0.531060159f, 0.482765943f},
-std::array<float,2>{0.997091115f, 0.835795283f},
-std::array<float,2>{0.327517569f, 0.130508766f},
-std::array<float,2>{0.032763321f, 0.753685594f},
-std::array<float,2>{0.691989958f, 0.202033818f},
-std::array<float,2>{0.799638808f, 0.551507652f},
-std::array<float,2>{0.471248329f, 0.380913168f},
-std::array<float,2>{0.282577157f, 0.692431629f},
-std::array<float,2>{0.888009131f, 0.31059885f},
-std::array<float,2>{0.595267594f, 0.995682776f},
-std::array<float,2>{0.143424064f, 0.040319901f},
-std::array<float,2>{0.256955594f, 0.973860741f},
-std::array<float,2>{0.9242962f, 0.0500362553f},
-std::array<float,2>{0.582342684f, 0.707936287f},
-std::array<float,2>{0.167747483f, 0.285466611f},
-std::array<float,2>{0.0212989841f, 0.538151145f},
-std::array<float,2>{0.72170949f, 0.405081183f},
-std::array<float,2>{0.779449999f, 0.77524668f},
-std::array<float,2>{0.45285213f, 0.215608522f},
-std::array<float,2>{0.218885466f, 0.821671844f},
-std::array<float,2>{0.545735002f, 0.149217457f},
-std::array<float,2>{0.944234371f, 0.575537622f},
-std::array<float,2>{0.346541435f, 0.492810309f},
-std::array<float,2>{0.427728385f, 0.66027236f},
-std::array<float,2>{0.816458046f, 0.363626271f},
-std::array<float,2>{0.673537016f, 0.898707509f},
-std::array<float,2>{0.123848133f, 0.104479022f},
-std::array<float,2>{0.493484795f, 0.810774207f},
-std::array<float,2>{0.794564784f, 0.226595342f},
-std::array<float,2>{0.706837595f, 0.522579134f},
-std::array<float,2>{0.046897687f, 0.411610782f},
-std::array<float,2>{0.134990931f, 0.749506891f},
-std::array<float,2>{0.611053705f, 0.259126961f},
-std::array<float,2>{0.900651991f, 0.94120723f},
-std::array<float,2>{0.297144741f, 0.0279639009f},
-std::array<float,2>{0.0679421425f, 0.934419334f},
-std::array<float,2>{0.645826161f, 0.071279265f},
-std::array<float,2>{0.857662201f, 0.647477925f},
-std::array<float,2>{0.400919706f, 0.318488836f},
-std::array<float,2>{0.332274586f, 0.602481365f},
-std::array<float,2>{0.975313008f, 0.463575274f},
-std::array<float,2>{0.503249824f, 0.861968219f},
-std::array<float,2>{0.200111017f, 0.159273803f},
-std::array<float,2>{0.304990917f, 0.77009809f},
-std::array<float,2>{0.892809272f, 0.206797972f},
-std::array<float,2>{0.622064292f, 0.544035375f},
-std::array<float,2>{0.128374442f, 0.391281605f},
-std::array<float,2>{0.0614749826f, 0.717172027f},
-std::array<float,2>{0.718337834f, 0.294346929f},
-std::array<float,2>{0.786688507f, 0.980160773f},
-std::array<float,2>{0.489317864f, 0.0569851622f},
-std::array<float,2>{0.190501094f, 0.892186582f},
-std::array<float,2>{0.513455927f, 0.0967514291f},
-std::array<float,2>{0.981682062f, 0.669299066f},
-std::array<float,2>{0.342353642f, 0.371807545f},
-std::array<float,2>{0.39638406f, 0.566489816f},
-std::array<float,2>{0.851534963f, 0.488937706f},
-std::array<float,2>{0.650402904f, 0.813743412f},
-std::array<float,2>{0.0769856498f, 0.145920143f},
-std::array<float,2>{0.441117585f, 0.950990438f},
-std::array<float,2>{0.766228735f, 0.0211508926f},
-std::array<float,2>{0.734372199f, 0.740756989f},
-std::array<float,2>{0.0260617342f, 0.257194936f},
-std::array<float,2>{0.16321528f, 0.524531662f},
-std::array<float,2>{0.591207683f, 0.419617355f},
-std::array<float,2>{0.934727013f, 0.798289597f},
-std::array<float,2>{0.262372166f, 0.223403722f},
-std::array<float,2>{0.112949401f, 0.867265642f},
-std::array<float,2>{0.68639195f, 0.165496156f},
-std::array<float,2>{0.823289931f, 0.597179532f},
-std::array<float,2>{0.436607391f, 0.460709661f},
-std::array<float,2>{0.35825941f, 0.650503337f},
-std::array<float,2>{0.947644114f, 0.327327967f},
-std::array<float,2>{0.538705587f, 0.924266577f},
-std::array<float,2>{0.228605434f, 0.0691075623f},
-std::array<float,2>{0.316904634f, 0.913988531f},
-std::array<float,2>{0.986166239f, 0.0866935849f},
-std::array<float,2>{0.519774258f, 0.630135596f},
-std::array<float,2>{0.215332389f, 0.34155187f},
-std::array<float,2>{0.0816195458f, 0.617974341f},
-std::array<float,2>{0.635514319f, 0.444253355f},
-std::array<float,2>{0.872375011f, 0.849184453f},
-std::array<float,2>{0.380876064f, 0.185368106f},
-std::array<float,2>{0.149586469f, 0.782883286f},
-std::array<float,2>{0.607814789f, 0.246926621f},
-std::array<float,2>{0.877302408f, 0.502992451f},
-std::array<float,2>{0.292961478f, 0.435384005f},
-std::array<float,2>{0.484151065f, 0.720311463f},
-std::array<float,2>{0.807789505f, 0.279084414f},
-std::array<float,2>{0.697530925f, 0.963174701f},
-std::array<float,2>{0.0468502492f, 0.0153666371f},
-std::array<float,2>{0.410160929f, 0.843481541f},
-std::array<float,2>{0.841140747f, 0.140546456f},
-std::array<float,2>{0.659227729f, 0.583876431f},
-std::array<float,2>{0.10586334f, 0.476396531f},
-std::array<float,2>{0.237261072f, 0.678167284f},
-std::array<float,2>{0.549727857f, 0.358458608f},
-std::array<float,2>{0.957014859f, 0.885151625f},
-std::array<float,2>{0.373472184f, 0.117828622f},
-std::array<float,2>{0.0151778366f, 0.986150742f},
-std::array<float,2>{0.747440875f, 0.0387446545f},
-std::array<float,2>{0.762366593f, 0.696518183f},
-std::array<float,2>{0.455220908f, 0.296889216f},
-std::array<float,2>{0.276205003f, 0.561506808f},
-std::array<float,2>{0.919292748f, 0.383458167f},
-std::array<float,2>{0.574306011f, 0.764850378f},
-std::array<float,2>{0.183781534f, 0.194265991f},
-std::array<float,2>{0.336302519f, 0.796420872f},
-std::array<float,2>{0.977222741f, 0.237177655f},
-std::array<float,2>{0.509876013f, 0.51495856f},
-std::array<float,2>{0.194732875f, 0.424106359f},
-std::array<float,2>{0.0711491033f, 0.731144965f},
-std::array<float,2>{0.653538346f, 0.268139511f},
-std::array<float,2>{0.84744364f, 0.958767831f},
-std::array<float,2>{0.392502606f, 0.000511981954f},
-std::array<float,2>{0.13134557f, 0.919426203f},
-std::array<float,2>{0.619113028f, 0.0802804828f},
-std::array<float,2>{0.895475924f, 0.635484755f},
-std::array<float,2>{0.310731977f, 0.334353983f},
-std::array<float,2>{0.484677732f, 0.610462725f},
-std::array<float,2>{0.783175647f, 0.448613882f},
-std::array<float,2>{0.71135813f, 0.857197821f},
-std::array<float,2>{0.0574054457f, 0.175222769f},
-std::array<float,2>{0.432043523f, 0.999226689f},
-std::array<float,2>{0.825078607f, 0.046736978f},
-std::array<float,2>{0.680295289f, 0.687774301f},
-std::array<float,2>{0.116314426f, 0.306226403f},
-std::array<float,2>{0.231870398f, 0.54825902f},
-std::array<float,2>{0.531332612f, 0.377380162f},
-std::array<float,2>{0.949355721f, 0.755147934f},
-std::array<float,2>{0.352698028f, 0.197834402f},
-std::array<float,2>{0.0275964774f, 0.829389453f},
-std::array<float,2>{0.72730428f, 0.125999838f},
-std::array<float,2>{0.769690931f, 0.586127222f},
-std::array<float,2>{0.443768561f, 0.477272898f},
-std::array<float,2>{0.258397758f, 0.682122529f},
-std::array<float,2>{0.932707965f, 0.345980078f},
-std::array<float,2>{0.58834672f, 0.878111959f},
-std::array<float,2>{0.159927785f, 0.112500764f},
-std::array<float,2>{0.294851303f, 0.90508014f},
-std::array<float,2>{0.882013857f, 0.107360065f},
-std::array<float,2>{0.603431702f, 0.65946871f},
-std::array<float,2>{0.152685434f, 0.361437619f},
-std::array<float,2>{0.0429041646f, 0.572593033f},
-std::array<float,2>{0.699338794f, 0.498581588f},
-std::array<float,2>{0.809297562f, 0.826775968f},
-std::array<float,2>{0.480436027f, 0.154897526f},
-std::array<float,2>{0.214355603f, 0.778865993f},
-std::array<float,2>{0.518734396f, 0.21348013f},
-std::array<float,2>{0.990656078f, 0.533395231f},
-std::array<float,2>{0.31466049f, 0.400315553f},
-std::array<float,2>{0.375994295f, 0.706790328f},
-std::array<float,2>{0.870358765f, 0.284765989f},
-std::array<float,2>{0.638853252f, 0.97235018f},
-std::array<float,2>{0.0859369636f, 0.0521888956f},
-std::array<float,2>{0.460827976f, 0.865539014f},
-std::array<float,2>{0.760176778f, 0.161888212f},
-std::array<float,2>{0.742548764f, 0.605993032f},
-std::array<float,2>{0.0101935668f, 0.468320459f},
-std::array<float,2>{0.181977808f, 0.641592801f},
-std::array<float,2>{0.572956085f, 0.313450485f},
-std::array<float,2>{0.915729582f, 0.932157695f},
-std::array<float,2>{0.279375702f, 0.0777151212f},
-std::array<float,2>{0.103541784f, 0.943472207f},
-std::array<float,2>{0.66156888f, 0.0270882864f},
-std::array<float,2>{0.838239253f, 0.74334687f},
-std::array<float,2>{0.406380057f, 0.261949509f},
-std::array<float,2>{0.369876504f, 0.516154766f},
-std::array<float,2>{0.958990574f, 0.408638686f},
-std::array<float,2>{0.55193758f, 0.807148755f},
-std::array<float,2>{0.241730675f, 0.233487144f},
-std::array<float,2>{0.268504024f, 0.817315102f},
-std::array<float,2>{0.907948852f, 0.141857088f},
-std::array<float,2>{0.570250273f, 0.563417614f},
-std::array<float,2>{0.175205588f, 0.486873627f},
-std::array<float,2>{0.00524559338f, 0.666214228f},
-std::array<float,2>{0.736044288f, 0.371028423f},
-std::array<float,2>{0.754398346f, 0.896003306f},
-std::array<float,2>{0.467147857f, 0.0977352411f},
-std::array<float,2>{0.247204781f, 0.981765985f},
-std::array<float,2>{0.557038367f, 0.0608743541f},
-std::array<float,2>{0.967657208f, 0.714710057f},
-std::array<float,2>{0.361053973f, 0.289218426f},
-std::array<float,2>{0.418298542f, 0.540103376f},
-std::array<float,2>{0.835368514f, 0.395748615f},
-std::array<float,2>{0.664166033f, 0.767414391f},
-std::array<float,2>{0.0996659771f, 0.208327383f},
-std::array<float,2>{0.473913372f, 0.927804947f},
-std::array<float,2>{0.800787389f, 0.0654654726f},
-std::array<float,2>{0.690401495f, 0.654917955f},
-std::array<float,2>{0.0363308415f, 0.321671069f},
-std::array<float,2>{0.145415992f, 0.599703729f},
-std::array<float,2>{0.599574506f, 0.45475927f},
-std::array<float,2>{0.884826839f, 0.87243098f},
-std::array<float,2>{0.286627412f, 0.171814784f},
-std::array<float,2>{0.0905819535f, 0.802181423f},
-std::array<float,2>{0.632000685f, 0.2224783f},
-std::array<float,2>{0.863687873f, 0.529835284f},
-std::array<float,2>{0.383289307f, 0.416974097f},
-std::array<float,2>{0.321861506f, 0.738236547f},
-std::array<float,2>{0.992640316f, 0.25312987f},
-std::array<float,2>{0.526010513f, 0.948702395f},
-std::array<float,2>{0.208621621f, 0.0178369265f},
-std::array<float,2>{0.35149163f, 0.967947066f},
-std::array<float,2>{0.941206932f, 0.00875657238f},
-std::array<float,2>{0.542070448f, 0.724060357f},
-std::array<float,2>{0.225186944f, 0.276278615f},
-std::array<float,2>{0.118544504f, 0.506209314f},
-std::array<float,2>{0.677428544f, 0.429933399f},
-std::array<float,2>{0.814558506f, 0.7863819f},
-std::array<float,2>{0.422124267f, 0.242508382f},
-std::array<float,2>{0.17111063f, 0.847250998f},
-std::array<float,2>{0.579282343f, 0.180090055f},
-std::array<float,2>{0.92838949f, 0.624627829f},
-std::array<float,2>{0.252577513f, 0.440140188f},
-std::array<float,2>{0.446840882f, 0.625190735f},
-std::array<float,2>{0.774861753f, 0.338343203f},
-std::array<float,2>{0.725801647f, 0.907959878f},
-std::array<float,2>{0.0162180644f, 0.0917677209f},
-std::array<float,2>{0.405844897f, 0.760035872f},
-std::array<float,2>{0.853192627f, 0.188531578f},
-std::array<float,2>{0.642076731f, 0.555035412f},
-std::array<float,2>{0.0660899952f, 0.389447004f},
-std::array<float,2>{0.196463794f, 0.702168286f},
-std::array<float,2>{0.505190432f, 0.304593176f},
-std::array<float,2>{0.970799327f, 0.991386473f},
-std::array<float,2>{0.32890752f, 0.0333588868f},
-std::array<float,2>{0.0512261912f, 0.888733387f},
-std::array<float,2>{0.707470238f, 0.121997245f},
-std::array<float,2>{0.789359391f, 0.674482405f},
-std::array<float,2>{0.49674499f, 0.353940219f},
-std::array<float,2>{0.301343083f, 0.581714094f},
-std::array<float,2>{0.90292269f, 0.469330162f},
-std::array<float,2>{0.616231024f, 0.836971998f},
-std::array<float,2>{0.13916105f, 0.133673504f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.14878118f, 0.783652842f},
-std::array<float,2>{0.711653948f, 0.311818749f},
-std::array<float,2>{0.90911752f, 0.741045415f},
-std::array<float,2>{0.414860368f, 0.243207216f},
-std::array<float,2>{0.292177022f, 0.546061456f},
-std::array<float,2>{0.762124479f, 0.118944749f},
-std::array<float,2>{0.603345692f, 0.964212656f},
-std::array<float,2>{0.0108449347f, 0.439485073f},
-std::array<float,2>{0.0662149712f, 0.652901232f},
-std::array<float,2>{0.541556954f, 0.127641022f},
-std::array<float,2>{0.829575837f, 0.86148566f},
-std::array<float,2>{0.37050572f, 0.356132776f},
-std::array<float,2>{0.480215907f, 0.883090615f},
-std::array<float,2>{0.946166039f, 0.423952878f},
-std::array<float,2>{0.636158109f, 0.594865501f},
-std::array<float,2>{0.20825617f, 0.00175411825f},
-std::array<float,2>{0.040055126f, 0.992293239f},
-std::array<float,2>{0.583054304f, 0.469225883f},
-std::array<float,2>{0.801853478f, 0.522495389f},
-std::array<float,2>{0.261396199f, 0.0910295695f},
-std::array<float,2>{0.392160892f, 0.69281739f},
-std::array<float,2>{0.899816036f, 0.202668458f},
-std::array<float,2>{0.721818924f, 0.766644478f},
-std::array<float,2>{0.157793045f, 0.258546293f},
-std::array<float,2>{0.22589983f, 0.570869625f},
-std::array<float,2>{0.673241615f, 0.0390766002f},
-std::array<float,2>{0.982319772f, 0.922361791f},
-std::array<float,2>{0.461158931f, 0.384552151f},
-std::array<float,2>{0.335976452f, 0.843314171f},
-std::array<float,2>{0.845901132f, 0.335942775f},
-std::array<float,2>{0.51488924f, 0.687071919f},
-std::array<float,2>{0.121621087f, 0.182268277f},
-std::array<float,2>{0.192268729f, 0.920157433f},
-std::array<float,2>{0.645070612f, 0.393562198f},
-std::array<float,2>{0.967683792f, 0.586493313f},
-std::array<float,2>{0.488113761f, 0.052128654f},
-std::array<float,2>{0.358026415f, 0.666732311f},
-std::array<float,2>{0.824258506f, 0.166076615f},
-std::array<float,2>{0.548967481f, 0.824638724f},
-std::array<float,2>{0.0831431597f, 0.31839475f},
-std::array<float,2>{0.0296420492f, 0.508080006f},
-std::array<float,2>{0.609612167f, 0.0767404661f},
-std::array<float,2>{0.768214583f, 0.982270062f},
-std::array<float,2>{0.310556442f, 0.484680623f},
-std::array<float,2>{0.422885805f, 0.760638714f},
-std::array<float,2>{0.92741406f, 0.271907538f},
-std::array<float,2>{0.700498223f, 0.717799604f},
-std::array<float,2>{0.137711808f, 0.204845622f},
-std::array<float,2>{0.0941582024f, 0.851405799f},
-std::array<float,2>{0.52491951f, 0.368872076f},
-std::array<float,2>{0.873849988f, 0.625260651f},
-std::array<float,2>{0.322603732f, 0.150886267f},
-std::array<float,2>{0.437670976f, 0.621622562f},
-std::array<float,2>{0.992240906f, 0.0289243739f},
-std::array<float,2>{0.67041558f, 0.902338505f},
-std::array<float,2>{0.247107357f, 0.417743146f},
-std::array<float,2>{0.177921414f, 0.724175811f},
-std::array<float,2>{0.738189816f, 0.221677959f},
-std::array<float,2>{0.879232645f, 0.802825212f},
-std::array<float,2>{0.376027405f, 0.29445228f},
-std::array<float,2>{0.273136079f, 0.939240932f},
-std::array<float,2>{0.784513235f, 0.454921365f},
-std::array<float,2>{0.575053334f, 0.547403276f},
-std::array<float,2>{0.0609740801f, 0.10120932f},
-std::array<float,2>{0.2372915f, 0.819347322f},
-std::array<float,2>{0.659014463f, 0.32624197f},
-std::array<float,2>{0.986039758f, 0.661333144f},
-std::array<float,2>{0.446553648f, 0.161460996f},
-std::array<float,2>{0.312683165f, 0.583973348f},
-std::array<float,2>{0.860794544f, 0.0618101172f},
-std::array<float,2>{0.517486751f, 0.907496333f},
-std::array<float,2>{0.105063461f, 0.400557995f},
-std::array<float,2>{0.0487374626f, 0.708938718f},
-std::array<float,2>{0.568599761f, 0.213272929f},
-std::array<float,2>{0.790930629f, 0.75564599f},
-std::array<float,2>{0.278878212f, 0.276481658f},
-std::array<float,2>{0.384823948f, 0.973625302f},
-std::array<float,2>{0.887450755f, 0.49738422f},
-std::array<float,2>{0.743775249f, 0.500706077f},
-std::array<float,2>{0.185616359f, 0.0656732768f},
-std::array<float,2>{0.0889007226f, 0.896328628f},
-std::array<float,2>{0.561137676f, 0.412896693f},
-std::array<float,2>{0.814382255f, 0.614708185f},
-std::array<float,2>{0.344385326f, 0.0213526599f},
-std::array<float,2>{0.49556464f, 0.636133015f},
-std::array<float,2>{0.958282471f, 0.140899137f},
-std::array<float,2>{0.648790359f, 0.856411815f},
-std::array<float,2>{0.197719693f, 0.359704733f},
-std::array<float,2>{0.128278986f, 0.55733192f},
-std::array<float,2>{0.68776679f, 0.104345344f},
-std::array<float,2>{0.931453645f, 0.948272824f},
-std::array<float,2>{0.435788661f, 0.466970116f},
-std::array<float,2>{0.30081445f, 0.807656825f},
-std::array<float,2>{0.773661852f, 0.288758636f},
-std::array<float,2>{0.619258463f, 0.727403998f},
-std::array<float,2>{0.0180587023f, 0.233074382f},
-std::array<float,2>{0.165084079f, 0.956330419f},
-std::array<float,2>{0.727275014f, 0.447188884f},
-std::array<float,2>{0.895586073f, 0.534837723f},
-std::array<float,2>{0.402931899f, 0.115992248f},
-std::array<float,2>{0.250383198f, 0.74381721f},
-std::array<float,2>{0.812088847f, 0.235316128f},
-std::array<float,2>{0.586636126f, 0.792835951f},
-std::array<float,2>{0.0381763503f, 0.298224926f},
-std::array<float,2>{0.110335879f, 0.604558587f},
-std::array<float,2>{0.502445698f, 0.00791232102f},
-std::array<float,2>{0.855248272f, 0.876991272f},
-std::array<float,2>{0.330714166f, 0.435442656f},
-std::array<float,2>{0.454381436f, 0.871315539f},
-std::array<float,2>{0.971348822f, 0.344936401f},
-std::array<float,2>{0.682567656f, 0.641420782f},
-std::array<float,2>{0.227422476f, 0.134757698f},
-std::array<float,2>{0.00632759137f, 0.776385009f},
-std::array<float,2>{0.594887257f, 0.256666213f},
-std::array<float,2>{0.753745675f, 0.701871336f},
-std::array<float,2>{0.281761467f, 0.188204125f},
-std::array<float,2>{0.413870454f, 0.526495099f},
-std::array<float,2>{0.918165863f, 0.0831691399f},
-std::array<float,2>{0.706867218f, 0.987386167f},
-std::array<float,2>{0.143367812f, 0.476661295f},
-std::array<float,2>{0.215711847f, 0.679006994f},
-std::array<float,2>{0.626667917f, 0.172792584f},
-std::array<float,2>{0.944152892f, 0.830915809f},
-std::array<float,2>{0.469484657f, 0.334206581f},
-std::array<float,2>{0.366688639f, 0.934122384f},
-std::array<float,2>{0.837382734f, 0.381378263f},
-std::array<float,2>{0.534525037f, 0.567987978f},
-std::array<float,2>{0.0720517039f, 0.0329199359f},
-std::array<float,2>{0.204533786f, 0.753205836f},
-std::array<float,2>{0.639355838f, 0.280264527f},
-std::array<float,2>{0.951919556f, 0.706241906f},
-std::array<float,2>{0.481106967f, 0.217820749f},
-std::array<float,2>{0.373046309f, 0.504857242f},
-std::array<float,2>{0.833005071f, 0.0664833859f},
-std::array<float,2>{0.545801759f, 0.971232295f},
-std::array<float,2>{0.0695667267f, 0.492765486f},
-std::array<float,2>{0.0136072831f, 0.660040319f},
-std::array<float,2>{0.60609895f, 0.157804787f},
-std::array<float,2>{0.758454025f, 0.815450549f},
-std::array<float,2>{0.293825865f, 0.323643863f},
-std::array<float,2>{0.418964416f, 0.913861454f},
-std::array<float,2>{0.913630843f, 0.404217929f},
-std::array<float,2>{0.716498494f, 0.581165969f},
-std::array<float,2>{0.152850866f, 0.057854034f},
-std::array<float,2>{0.117948927f, 0.949843705f},
-std::array<float,2>{0.508728743f, 0.461159319f},
-std::array<float,2>{0.850318909f, 0.560315669f},
-std::array<float,2>{0.341493428f, 0.10772457f},
-std::array<float,2>{0.466334015f, 0.731034458f},
-std::array<float,2>{0.979557633f, 0.227492332f},
-std::array<float,2>{0.678269982f, 0.809481084f},
-std::array<float,2>{0.221407548f, 0.283921003f},
-std::array<float,2>{0.160401344f, 0.61239934f},
-std::array<float,2>{0.725372016f, 0.0174049363f},
-std::array<float,2>{0.902424574f, 0.891254783f},
-std::array<float,2>{0.396920383f, 0.408055604f},
-std::array<float,2>{0.262551218f, 0.853489995f},
-std::array<float,2>{0.79689461f, 0.363432467f},
-std::array<float,2>{0.581912756f, 0.63884306f},
-std::array<float,2>{0.0430764258f, 0.144836918f},
-std::array<float,2>{0.134875402f, 0.87993902f},
-std::array<float,2>{0.695852578f, 0.431546301f},
-std::array<float,2>{0.922814429f, 0.605522513f},
-std::array<float,2>{0.429564565f, 0.0150261652f},
-std::array<float,2>{0.308208585f, 0.64736408f},
-std::array<float,2>{0.773387909f, 0.14016743f},
-std::array<float,2>{0.61437881f, 0.870344102f},
-std::array<float,2>{0.0238143783f, 0.348303497f},
-std::array<float,2>{0.0795485973f, 0.536533415f},
-std::array<float,2>{0.554258347f, 0.110128656f},
-std::array<float,2>{0.822105289f, 0.960330904f},
-std::array<float,2>{0.354807734f, 0.450470448f},
-std::array<float,2>{0.488969356f, 0.794623792f},
-std::array<float,2>{0.962874472f, 0.301611871f},
-std::array<float,2>{0.644072473f, 0.749970138f},
-std::array<float,2>{0.188376978f, 0.239085317f},
-std::array<float,2>{0.0547024757f, 0.834291041f},
-std::array<float,2>{0.571835995f, 0.328715473f},
-std::array<float,2>{0.788076878f, 0.673674881f},
-std::array<float,2>{0.265694141f, 0.179459333f},
-std::array<float,2>{0.382003248f, 0.562858343f},
-std::array<float,2>{0.875269175f, 0.0380126573f},
-std::array<float,2>{0.741569281f, 0.931260943f},
-std::array<float,2>{0.172830537f, 0.375546306f},
-std::array<float,2>{0.242839769f, 0.69834137f},
-std::array<float,2>{0.667755544f, 0.192681611f},
-std::array<float,2>{0.996631205f, 0.779022753f},
-std::array<float,2>{0.443241179f, 0.253439635f},
-std::array<float,2>{0.325205833f, 0.990238667f},
-std::array<float,2>{0.86914742f, 0.481987834f},
-std::array<float,2>{0.530159175f, 0.528955102f},
-std::array<float,2>{0.0990230218f, 0.0798438042f},
-std::array<float,2>{0.180196762f, 0.865791798f},
-std::array<float,2>{0.747312725f, 0.353576273f},
-std::array<float,2>{0.885471284f, 0.65103507f},
-std::array<float,2>{0.389236569f, 0.129218489f},
-std::array<float,2>{0.276452094f, 0.601201534f},
-std::array<float,2>{0.79363656f, 0.00776543515f},
-std::array<float,2>{0.565336645f, 0.887504041f},
-std::array<float,2>{0.0521145687f, 0.425944805f},
-std::array<float,2>{0.107056208f, 0.737700403f},
-std::array<float,2>{0.521701813f, 0.248930514f},
-std::array<float,2>{0.864099503f, 0.785183311f},
-std::array<float,2>{0.316886067f, 0.306546003f},
-std::array<float,2>{0.44958359f, 0.965076625f},
-std::array<float,2>{0.991990507f, 0.444851279f},
-std::array<float,2>{0.663686216f, 0.539224863f},
-std::array<float,2>{0.240372881f, 0.12367966f},
-std::array<float,2>{0.0204946101f, 0.925920546f},
-std::array<float,2>{0.62343055f, 0.388109416f},
-std::array<float,2>{0.778317392f, 0.574924052f},
-std::array<float,2>{0.297514021f, 0.0459148139f},
-std::array<float,2>{0.430586964f, 0.681744337f},
-std::array<float,2>{0.934762418f, 0.186340511f},
-std::array<float,2>{0.694374204f, 0.837905884f},
-std::array<float,2>{0.129744515f, 0.341309756f},
-std::array<float,2>{0.200998917f, 0.518550336f},
-std::array<float,2>{0.653634787f, 0.0875772312f},
-std::array<float,2>{0.954978764f, 0.99901402f},
-std::array<float,2>{0.496249259f, 0.474804282f},
-std::array<float,2>{0.351017863f, 0.771103919f},
-std::array<float,2>{0.817279041f, 0.264171898f},
-std::array<float,2>{0.55595994f, 0.691212595f},
-std::array<float,2>{0.0902171135f, 0.197589055f},
-std::array<float,2>{0.232792929f, 0.978529692f},
-std::array<float,2>{0.687468529f, 0.491315603f},
-std::array<float,2>{0.976146042f, 0.514275849f},
-std::array<float,2>{0.457859367f, 0.0724992827f},
-std::array<float,2>{0.335119873f, 0.713261902f},
-std::array<float,2>{0.858558059f, 0.210637838f},
-std::array<float,2>{0.506173968f, 0.764009535f},
-std::array<float,2>{0.114520073f, 0.266799778f},
-std::array<float,2>{0.0319353826f, 0.591695428f},
-std::array<float,2>{0.591848314f, 0.0484385341f},
-std::array<float,2>{0.806609511f, 0.915922403f},
-std::array<float,2>{0.257687509f, 0.395275086f},
-std::array<float,2>{0.399367511f, 0.821856737f},
-std::array<float,2>{0.893886089f, 0.31583786f},
-std::array<float,2>{0.731540978f, 0.671434343f},
-std::array<float,2>{0.168750539f, 0.169903636f},
-std::array<float,2>{0.0778394118f, 0.799939752f},
-std::array<float,2>{0.535754323f, 0.292556286f},
-std::array<float,2>{0.843349278f, 0.720509589f},
-std::array<float,2>{0.359678298f, 0.224140182f},
-std::array<float,2>{0.473049313f, 0.553117812f},
-std::array<float,2>{0.939123333f, 0.0949043185f},
-std::array<float,2>{0.631907582f, 0.941703618f},
-std::array<float,2>{0.211294949f, 0.459426403f},
-std::array<float,2>{0.144924641f, 0.631554902f},
-std::array<float,2>{0.710843921f, 0.154712528f},
-std::array<float,2>{0.917470574f, 0.845147491f},
-std::array<float,2>{0.406796873f, 0.373416573f},
-std::array<float,2>{0.288101196f, 0.905057907f},
-std::array<float,2>{0.755197167f, 0.418940485f},
-std::array<float,2>{0.6005041f, 0.620046973f},
-std::array<float,2>{0.00316035189f, 0.023989737f},
-std::array<float,2>{0.15843235f, 0.767642856f},
-std::array<float,2>{0.720145524f, 0.260689527f},
-std::array<float,2>{0.902309597f, 0.694210052f},
-std::array<float,2>{0.393536299f, 0.19972755f},
-std::array<float,2>{0.259200931f, 0.520531416f},
-std::array<float,2>{0.804089546f, 0.0921015441f},
-std::array<float,2>{0.585683644f, 0.995702267f},
-std::array<float,2>{0.0414660387f, 0.472309172f},
-std::array<float,2>{0.124964729f, 0.684276819f},
-std::array<float,2>{0.512569726f, 0.181025907f},
-std::array<float,2>{0.844409466f, 0.841237485f},
-std::array<float,2>{0.338218331f, 0.337905437f},
-std::array<float,2>{0.464821041f, 0.925569892f},
-std::array<float,2>{0.984098196f, 0.38511017f},
-std::array<float,2>{0.674853265f, 0.573484898f},
-std::array<float,2>{0.222957537f, 0.0427386872f},
-std::array<float,2>{0.00840038247f, 0.961951673f},
-std::array<float,2>{0.604127526f, 0.43770647f},
-std::array<float,2>{0.765569568f, 0.54344064f},
-std::array<float,2>{0.290098935f, 0.12033575f},
-std::array<float,2>{0.416352123f, 0.740141153f},
-std::array<float,2>{0.906341851f, 0.24604471f},
-std::array<float,2>{0.714021146f, 0.782226145f},
-std::array<float,2>{0.150844634f, 0.31038937f},
-std::array<float,2>{0.209887058f, 0.596129596f},
-std::array<float,2>{0.633440554f, 0.00195470802f},
-std::array<float,2>{0.947306395f, 0.886597216f},
-std::array<float,2>{0.477251381f, 0.422228515f},
-std::array<float,2>{0.368025392f, 0.861104608f},
-std::array<float,2>{0.830224991f, 0.359335899f},
-std::array<float,2>{0.53965205f, 0.655780077f},
-std::array<float,2>{0.0628373474f, 0.126711786f},
-std::array<float,2>{0.248222396f, 0.899095535f},
-std::array<float,2>{0.669133604f, 0.415771425f},
-std::array<float,2>{0.994297445f, 0.623492599f},
-std::array<float,2>{0.439859688f, 0.0307152439f},
-std::array<float,2>{0.321894377f, 0.628456295f},
-std::array<float,2>{0.871306896f, 0.148461297f},
-std::array<float,2>{0.526502848f, 0.848487794f},
-std::array<float,2>{0.0968171209f, 0.370435745f},
-std::array<float,2>{0.0599972568f, 0.549125314f},
-std::array<float,2>{0.577559769f, 0.0977634937f},
-std::array<float,2>{0.782643139f, 0.941167593f},
-std::array<float,2>{0.270487547f, 0.456808269f},
-std::array<float,2>{0.377082467f, 0.802450716f},
-std::array<float,2>{0.881504655f, 0.296699166f},
-std::array<float,2>{0.735902548f, 0.726068139f},
-std::array<float,2>{0.176761404f, 0.219617963f},
-std::array<float,2>{0.0852390528f, 0.827891767f},
-std::array<float,2>{0.548725903f, 0.317378342f},
-std::array<float,2>{0.826711357f, 0.665597618f},
-std::array<float,2>{0.356248856f, 0.165426761f},
-std::array<float,2>{0.485597968f, 0.588796973f},
-std::array<float,2>{0.965364873f, 0.0530408695f},
-std::array<float,2>{0.646740556f, 0.919208467f},
-std::array<float,2>{0.193814993f, 0.392013073f},
-std::array<float,2>{0.139815629f, 0.715222299f},
-std::array<float,2>{0.701300621f, 0.206737503f},
-std::array<float,2>{0.929575443f, 0.758839369f},
-std::array<float,2>{0.42427209f, 0.271481484f},
-std::array<float,2>{0.309369713f, 0.984229803f},
-std::array<float,2>{0.765783906f, 0.487059981f},
-std::array<float,2>{0.612902701f, 0.511140227f},
-std::array<float,2>{0.028891433f, 0.0752813667f},
-std::array<float,2>{0.196801439f, 0.85815537f},
-std::array<float,2>{0.652196765f, 0.362602472f},
-std::array<float,2>{0.959662318f, 0.632877529f},
-std::array<float,2>{0.492617428f, 0.144377679f},
-std::array<float,2>{0.346817821f, 0.615521252f},
-std::array<float,2>{0.81622678f, 0.0221737903f},
-std::array<float,2>{0.559655011f, 0.89759016f},
-std::array<float,2>{0.0878688246f, 0.410317719f},
-std::array<float,2>{0.016352728f, 0.728858709f},
-std::array<float,2>{0.618669987f, 0.230561152f},
-std::array<float,2>{0.775510788f, 0.805614769f},
-std::array<float,2>{0.303850681f, 0.286578774f},
-std::array<float,2>{0.43474263f, 0.945334077f},
-std::array<float,2>{0.933440864f, 0.466242492f},
-std::array<float,2>{0.690715015f, 0.555663466f},
-std::array<float,2>{0.126172557f, 0.102875441f},
-std::array<float,2>{0.101630531f, 0.908893466f},
-std::array<float,2>{0.51825124f, 0.400257736f},
-std::array<float,2>{0.861482203f, 0.58450675f},
-std::array<float,2>{0.31622535f, 0.0594036542f},
-std::array<float,2>{0.448781013f, 0.662198365f},
-std::array<float,2>{0.986438394f, 0.163858056f},
-std::array<float,2>{0.657862306f, 0.818166256f},
-std::array<float,2>{0.234821886f, 0.324315339f},
-std::array<float,2>{0.183717668f, 0.502221406f},
-std::array<float,2>{0.746008694f, 0.064368546f},
-std::array<float,2>{0.889327586f, 0.975180686f},
-std::array<float,2>{0.384512365f, 0.499329329f},
-std::array<float,2>{0.280001849f, 0.757591426f},
-std::array<float,2>{0.79273057f, 0.273646802f},
-std::array<float,2>{0.567907333f, 0.70919764f},
-std::array<float,2>{0.0503195375f, 0.211734354f},
-std::array<float,2>{0.142500296f, 0.986292422f},
-std::array<float,2>{0.704229295f, 0.479080528f},
-std::array<float,2>{0.921433926f, 0.525286376f},
-std::array<float,2>{0.410427898f, 0.0853871703f},
-std::array<float,2>{0.284631699f, 0.700821042f},
-std::array<float,2>{0.750873506f, 0.191124618f},
-std::array<float,2>{0.596090853f, 0.773784876f},
-std::array<float,2>{0.00461299066f, 0.254690051f},
-std::array<float,2>{0.073003009f, 0.569523335f},
-std::array<float,2>{0.531450748f, 0.0340256467f},
-std::array<float,2>{0.838960111f, 0.937488794f},
-std::array<float,2>{0.363757789f, 0.37923485f},
-std::array<float,2>{0.472167969f, 0.829116166f},
-std::array<float,2>{0.94222343f, 0.333779395f},
-std::array<float,2>{0.627476871f, 0.676281869f},
-std::array<float,2>{0.217690915f, 0.175557554f},
-std::array<float,2>{0.0359965079f, 0.790684879f},
-std::array<float,2>{0.589023471f, 0.299559325f},
-std::array<float,2>{0.8086344f, 0.745229244f},
-std::array<float,2>{0.253684878f, 0.237784967f},
-std::array<float,2>{0.405506015f, 0.532701612f},
-std::array<float,2>{0.897876501f, 0.11505612f},
-std::array<float,2>{0.729694128f, 0.954834104f},
-std::array<float,2>{0.166368678f, 0.448780566f},
-std::array<float,2>{0.230323672f, 0.644145966f},
-std::array<float,2>{0.680462837f, 0.13592653f},
-std::array<float,2>{0.970261216f, 0.874078989f},
-std::array<float,2>{0.456010193f, 0.346156567f},
-std::array<float,2>{0.329952836f, 0.876732707f},
-std::array<float,2>{0.852763176f, 0.437054545f},
-std::array<float,2>{0.501636207f, 0.602011442f},
-std::array<float,2>{0.113193706f, 0.0107593834f},
-std::array<float,2>{0.220355645f, 0.811249733f},
-std::array<float,2>{0.677216172f, 0.283145696f},
-std::array<float,2>{0.976666451f, 0.732936978f},
-std::array<float,2>{0.468693346f, 0.229341835f},
-std::array<float,2>{0.342218876f, 0.561110914f},
-std::array<float,2>{0.849342406f, 0.10560897f},
-std::array<float,2>{0.511216462f, 0.952484727f},
-std::array<float,2>{0.120175399f, 0.46348545f},
-std::array<float,2>{0.0462291315f, 0.637748659f},
-std::array<float,2>{0.578352511f, 0.147674114f},
-std::array<float,2>{0.800555587f, 0.854672909f},
-std::array<float,2>{0.26404202f, 0.365291178f},
-std::array<float,2>{0.395225644f, 0.893351316f},
-std::array<float,2>{0.905134678f, 0.409167528f},
-std::array<float,2>{0.723089874f, 0.610439241f},
-std::array<float,2>{0.163446918f, 0.0189883225f},
-std::array<float,2>{0.0674042478f, 0.970604062f},
-std::array<float,2>{0.544750571f, 0.494559854f},
-std::array<float,2>{0.835376382f, 0.506883621f},
-std::array<float,2>{0.373232126f, 0.0702314228f},
-std::array<float,2>{0.483133018f, 0.703744292f},
-std::array<float,2>{0.949700832f, 0.216162428f},
-std::array<float,2>{0.638658345f, 0.750661552f},
-std::array<float,2>{0.206180498f, 0.27902934f},
-std::array<float,2>{0.156248942f, 0.578304231f},
-std::array<float,2>{0.718740106f, 0.0557337776f},
-std::array<float,2>{0.910540283f, 0.911975265f},
-std::array<float,2>{0.420140684f, 0.404497892f},
-std::array<float,2>{0.296434581f, 0.813011765f},
-std::array<float,2>{0.760804951f, 0.321220011f},
-std::array<float,2>{0.608141363f, 0.656502724f},
-std::array<float,2>{0.0149484593f, 0.158846483f},
-std::array<float,2>{0.174234763f, 0.933233142f},
-std::array<float,2>{0.739680171f, 0.377064258f},
-std::array<float,2>{0.877738774f, 0.565810919f},
-std::array<float,2>{0.379853725f, 0.0366415791f},
-std::array<float,2>{0.268532306f, 0.674585879f},
-std::array<float,2>{0.785692215f, 0.176800251f},
-std::array<float,2>{0.573668838f, 0.833209753f},
-std::array<float,2>{0.0577908233f, 0.331074029f},
-std::array<float,2>{0.100890577f, 0.530792594f},
-std::array<float,2>{0.528071284f, 0.0803821161f},
-std::array<float,2>{0.867298841f, 0.989074886f},
-std::array<float,2>{0.326180518f, 0.482489824f},
-std::array<float,2>{0.445227683f, 0.781021774f},
-std::array<float,2>{0.999312878f, 0.251643658f},
-std::array<float,2>{0.664904177f, 0.696603477f},
-std::array<float,2>{0.246077076f, 0.194656074f},
-std::array<float,2>{0.0266460534f, 0.86741513f},
-std::array<float,2>{0.615486145f, 0.351215392f},
-std::array<float,2>{0.771257818f, 0.645389497f},
-std::array<float,2>{0.305225402f, 0.138050586f},
-std::array<float,2>{0.427407891f, 0.608025908f},
-std::array<float,2>{0.925129592f, 0.0129678091f},
-std::array<float,2>{0.69793117f, 0.880914927f},
-std::array<float,2>{0.133679166f, 0.432392269f},
-std::array<float,2>{0.189981803f, 0.746920228f},
-std::array<float,2>{0.640967488f, 0.240555689f},
-std::array<float,2>{0.96476078f, 0.796021879f},
-std::array<float,2>{0.491085052f, 0.304080755f},
-std::array<float,2>{0.353302658f, 0.958630681f},
-std::array<float,2>{0.823013425f, 0.451272547f},
-std::array<float,2>{0.552367866f, 0.537799239f},
-std::array<float,2>{0.0801847354f, 0.112106293f},
-std::array<float,2>{0.131421909f, 0.837042928f},
-std::array<float,2>{0.69266057f, 0.343289018f},
-std::array<float,2>{0.936542988f, 0.680253863f},
-std::array<float,2>{0.432576656f, 0.184998542f},
-std::array<float,2>{0.299593061f, 0.576985538f},
-std::array<float,2>{0.781141639f, 0.0439641625f},
-std::array<float,2>{0.622797072f, 0.929108381f},
-std::array<float,2>{0.0234171022f, 0.388902217f},
-std::array<float,2>{0.0929393992f, 0.688171387f},
-std::array<float,2>{0.557116926f, 0.196448296f},
-std::array<float,2>{0.819093883f, 0.772375643f},
-std::array<float,2>{0.349217862f, 0.262544572f},
-std::array<float,2>{0.499844432f, 0.997388542f},
-std::array<float,2>{0.955518067f, 0.473543495f},
-std::array<float,2>{0.6559425f, 0.515688598f},
-std::array<float,2>{0.203055188f, 0.0885677487f},
-std::array<float,2>{0.0535499901f, 0.890182018f},
-std::array<float,2>{0.563001871f, 0.428228885f},
-std::array<float,2>{0.795096576f, 0.598038733f},
-std::array<float,2>{0.273815066f, 0.00404056208f},
-std::array<float,2>{0.388304651f, 0.650059402f},
-std::array<float,2>{0.884489596f, 0.131977513f},
-std::array<float,2>{0.748973727f, 0.864862323f},
-std::array<float,2>{0.182959214f, 0.35198313f},
-std::array<float,2>{0.238987848f, 0.541597664f},
-std::array<float,2>{0.660548747f, 0.121716298f},
-std::array<float,2>{0.989311218f, 0.966961563f},
-std::array<float,2>{0.452499241f, 0.441891432f},
-std::array<float,2>{0.319280148f, 0.788837731f},
-std::array<float,2>{0.86598295f, 0.308232814f},
-std::array<float,2>{0.520818591f, 0.735278964f},
-std::array<float,2>{0.107897341f, 0.247732237f},
-std::array<float,2>{0.21329163f, 0.945222318f},
-std::array<float,2>{0.630617321f, 0.457360834f},
-std::array<float,2>{0.940275311f, 0.551381946f},
-std::array<float,2>{0.475618839f, 0.0967526585f},
-std::array<float,2>{0.36283651f, 0.720780253f},
-std::array<float,2>{0.839920104f, 0.225485653f},
-std::array<float,2>{0.538522601f, 0.798058748f},
-std::array<float,2>{0.0751815885f, 0.290099382f},
-std::array<float,2>{0.00162856944f, 0.617416918f},
-std::array<float,2>{0.598466337f, 0.0262194406f},
-std::array<float,2>{0.756265759f, 0.903268337f},
-std::array<float,2>{0.28605178f, 0.421269745f},
-std::array<float,2>{0.409578413f, 0.847625971f},
-std::array<float,2>{0.915256679f, 0.37290445f},
-std::array<float,2>{0.708037674f, 0.629603267f},
-std::array<float,2>{0.146929115f, 0.153140888f},
-std::array<float,2>{0.116378598f, 0.763436913f},
-std::array<float,2>{0.504398942f, 0.268440872f},
-std::array<float,2>{0.855476081f, 0.712660551f},
-std::array<float,2>{0.333886325f, 0.207397968f},
-std::array<float,2>{0.460642576f, 0.512507856f},
-std::array<float,2>{0.973918259f, 0.0708883256f},
-std::array<float,2>{0.68506074f, 0.978064537f},
-std::array<float,2>{0.230543941f, 0.488319516f},
-std::array<float,2>{0.170422107f, 0.669507146f},
-std::array<float,2>{0.732491016f, 0.170647487f},
-std::array<float,2>{0.89212656f, 0.824076235f},
-std::array<float,2>{0.401736438f, 0.313262761f},
-std::array<float,2>{0.254436225f, 0.916995108f},
-std::array<float,2>{0.807303846f, 0.397469103f},
-std::array<float,2>{0.590760827f, 0.593511283f},
-std::array<float,2>{0.0341047756f, 0.0506743789f},
-std::array<float,2>{0.137148842f, 0.758242369f},
-std::array<float,2>{0.699260831f, 0.270343721f},
-std::array<float,2>{0.926717639f, 0.716522932f},
-std::array<float,2>{0.422371358f, 0.205747291f},
-std::array<float,2>{0.311863542f, 0.510507107f},
-std::array<float,2>{0.768827379f, 0.074758552f},
-std::array<float,2>{0.611073613f, 0.983313978f},
-std::array<float,2>{0.030670099f, 0.487578958f},
-std::array<float,2>{0.082878314f, 0.664743543f},
-std::array<float,2>{0.550002873f, 0.164083153f},
-std::array<float,2>{0.825280011f, 0.826927722f},
-std::array<float,2>{0.358922422f, 0.31746465f},
-std::array<float,2>{0.486823648f, 0.918562353f},
-std::array<float,2>{0.96858573f, 0.391128778f},
-std::array<float,2>{0.646195173f, 0.589786112f},
-std::array<float,2>{0.192715988f, 0.0541589111f},
-std::array<float,2>{0.0619404987f, 0.939606488f},
-std::array<float,2>{0.57572794f, 0.455459267f},
-std::array<float,2>{0.784010053f, 0.550771534f},
-std::array<float,2>{0.271914661f, 0.0993461311f},
-std::array<float,2>{0.375584096f, 0.725132406f},
-std::array<float,2>{0.880429864f, 0.219885021f},
-std::array<float,2>{0.736465514f, 0.801600814f},
-std::array<float,2>{0.1793385f, 0.29588598f},
-std::array<float,2>{0.246789992f, 0.624025226f},
-std::array<float,2>{0.671270251f, 0.030098943f},
-std::array<float,2>{0.993969679f, 0.899679899f},
-std::array<float,2>{0.439289033f, 0.414771676f},
-std::array<float,2>{0.323786736f, 0.849598885f},
-std::array<float,2>{0.874892473f, 0.369518846f},
-std::array<float,2>{0.524117708f, 0.627204299f},
-std::array<float,2>{0.0953359976f, 0.149915278f},
-std::array<float,2>{0.207911238f, 0.884799004f},
-std::array<float,2>{0.634941757f, 0.422976524f},
-std::array<float,2>{0.946870029f, 0.59732461f},
-std::array<float,2>{0.479414791f, 0.00312465779f},
-std::array<float,2>{0.369226277f, 0.65472728f},
-std::array<float,2>{0.828341544f, 0.125759631f},
-std::array<float,2>{0.542786956f, 0.859785795f},
-std::array<float,2>{0.065104194f, 0.358331144f},
-std::array<float,2>{0.0102416202f, 0.544170499f},
-std::array<float,2>{0.602185071f, 0.119675249f},
-std::array<float,2>{0.762998581f, 0.961422324f},
-std::array<float,2>{0.291103959f, 0.438607872f},
-std::array<float,2>{0.41590935f, 0.782396913f},
-std::array<float,2>{0.909595668f, 0.309365153f},
-std::array<float,2>{0.712807238f, 0.739029706f},
-std::array<float,2>{0.150240451f, 0.244503722f},
-std::array<float,2>{0.122228839f, 0.840623736f},
-std::array<float,2>{0.514527678f, 0.339109093f},
-std::array<float,2>{0.84683764f, 0.6853652f},
-std::array<float,2>{0.33724159f, 0.180224612f},
-std::array<float,2>{0.462502897f, 0.572368026f},
-std::array<float,2>{0.980635285f, 0.0419093221f},
-std::array<float,2>{0.672213137f, 0.924095213f},
-std::array<float,2>{0.225487575f, 0.386129886f},
-std::array<float,2>{0.157182738f, 0.694528401f},
-std::array<float,2>{0.720712364f, 0.200567856f},
-std::array<float,2>{0.899143457f, 0.769211411f},
-std::array<float,2>{0.391539127f, 0.261062413f},
-std::array<float,2>{0.259801716f, 0.99468267f},
-std::array<float,2>{0.801347673f, 0.471332848f},
-std::array<float,2>{0.582862973f, 0.519978762f},
-std::array<float,2>{0.039901711f, 0.0935084447f},
-std::array<float,2>{0.228157759f, 0.873941064f},
-std::array<float,2>{0.683034897f, 0.34738946f},
-std::array<float,2>{0.971727788f, 0.643255413f},
-std::array<float,2>{0.453474283f, 0.135516524f},
-std::array<float,2>{0.331902504f, 0.602628887f},
-std::array<float,2>{0.854344189f, 0.0104192123f},
-std::array<float,2>{0.503063619f, 0.875928104f},
-std::array<float,2>{0.110946462f, 0.435862035f},
-std::array<float,2>{0.0377935506f, 0.744399369f},
-std::array<float,2>{0.587607324f, 0.236959219f},
-std::array<float,2>{0.810577393f, 0.789833844f},
-std::array<float,2>{0.251575768f, 0.300024927f},
-std::array<float,2>{0.404216856f, 0.953864932f},
-std::array<float,2>{0.894636691f, 0.447582483f},
-std::array<float,2>{0.727939963f, 0.531665146f},
-std::array<float,2>{0.164415449f, 0.113707654f},
-std::array<float,2>{0.0710967332f, 0.9361009f},
-std::array<float,2>{0.53395021f, 0.380460888f},
-std::array<float,2>{0.836802602f, 0.568508565f},
-std::array<float,2>{0.365872055f, 0.034911748f},
-std::array<float,2>{0.470644057f, 0.677235007f},
-std::array<float,2>{0.944997489f, 0.174192265f},
-std::array<float,2>{0.62509197f, 0.828898728f},
-std::array<float,2>{0.216090709f, 0.332757801f},
-std::array<float,2>{0.143722951f, 0.524243236f},
-std::array<float,2>{0.705459714f, 0.0844619945f},
-std::array<float,2>{0.919723451f, 0.985263884f},
-std::array<float,2>{0.412680864f, 0.480339557f},
-std::array<float,2>{0.282764077f, 0.775379539f},
-std::array<float,2>{0.752826452f, 0.255222648f},
-std::array<float,2>{0.593896389f, 0.699791014f},
-std::array<float,2>{0.0073610777f, 0.189899296f},
-std::array<float,2>{0.187260717f, 0.976096153f},
-std::array<float,2>{0.742398977f, 0.498699009f},
-std::array<float,2>{0.88793093f, 0.503880084f},
-std::array<float,2>{0.385852337f, 0.0632215589f},
-std::array<float,2>{0.278101563f, 0.710493267f},
-std::array<float,2>{0.789373577f, 0.212110668f},
-std::array<float,2>{0.569366872f, 0.75667268f},
-std::array<float,2>{0.047079891f, 0.275103927f},
-std::array<float,2>{0.103560731f, 0.585366011f},
-std::array<float,2>{0.516040266f, 0.0603122637f},
-std::array<float,2>{0.859935343f, 0.910128951f},
-std::array<float,2>{0.313648432f, 0.399242073f},
-std::array<float,2>{0.44620955f, 0.816741526f},
-std::array<float,2>{0.985056579f, 0.32573247f},
-std::array<float,2>{0.659462452f, 0.663934886f},
-std::array<float,2>{0.238051817f, 0.162547931f},
-std::array<float,2>{0.0191936512f, 0.806023896f},
-std::array<float,2>{0.620831668f, 0.285373509f},
-std::array<float,2>{0.775218487f, 0.729678869f},
-std::array<float,2>{0.302398056f, 0.231764004f},
-std::array<float,2>{0.437327206f, 0.556322455f},
-std::array<float,2>{0.929795742f, 0.101672731f},
-std::array<float,2>{0.689336181f, 0.946779132f},
-std::array<float,2>{0.127816871f, 0.464899987f},
-std::array<float,2>{0.198809072f, 0.634149075f},
-std::array<float,2>{0.650033712f, 0.143416733f},
-std::array<float,2>{0.957884014f, 0.859048069f},
-std::array<float,2>{0.494170487f, 0.362153858f},
-std::array<float,2>{0.345088452f, 0.897113681f},
-std::array<float,2>{0.812717497f, 0.411457717f},
-std::array<float,2>{0.562383056f, 0.616864502f},
-std::array<float,2>{0.0880601257f, 0.0233149268f},
-std::array<float,2>{0.188569218f, 0.794958174f},
-std::array<float,2>{0.642701387f, 0.30294314f},
-std::array<float,2>{0.961181939f, 0.747614145f},
-std::array<float,2>{0.489549488f, 0.241450727f},
-std::array<float,2>{0.354271472f, 0.538933039f},
-std::array<float,2>{0.821058452f, 0.113187872f},
-std::array<float,2>{0.553211927f, 0.957883418f},
-std::array<float,2>{0.0786478147f, 0.452645957f},
-std::array<float,2>{0.0248174239f, 0.646197021f},
-std::array<float,2>{0.613503814f, 0.137378126f},
-std::array<float,2>{0.772310972f, 0.869015396f},
-std::array<float,2>{0.30713737f, 0.35055238f},
-std::array<float,2>{0.428704619f, 0.88219285f},
-std::array<float,2>{0.923801482f, 0.432630837f},
-std::array<float,2>{0.696721315f, 0.609188259f},
-std::array<float,2>{0.136231765f, 0.0126299923f},
-std::array<float,2>{0.0981001407f, 0.989789963f},
-std::array<float,2>{0.530655146f, 0.483717293f},
-std::array<float,2>{0.870526373f, 0.529468238f},
-std::array<float,2>{0.325081229f, 0.0813185945f},
-std::array<float,2>{0.441540301f, 0.695449293f},
-std::array<float,2>{0.997447371f, 0.194314554f},
-std::array<float,2>{0.666557908f, 0.780043721f},
-std::array<float,2>{0.243782267f, 0.25029999f},
-std::array<float,2>{0.173709527f, 0.565294504f},
-std::array<float,2>{0.741138697f, 0.0358512253f},
-std::array<float,2>{0.876717627f, 0.932009995f},
-std::array<float,2>{0.380951673f, 0.378353238f},
-std::array<float,2>{0.267409831f, 0.832257748f},
-std::array<float,2>{0.78856647f, 0.330928802f},
-std::array<float,2>{0.571250021f, 0.675096571f},
-std::array<float,2>{0.056540072f, 0.176640838f},
-std::array<float,2>{0.153618559f, 0.910495579f},
-std::array<float,2>{0.715248883f, 0.405285776f},
-std::array<float,2>{0.912196875f, 0.579120517f},
-std::array<float,2>{0.418936104f, 0.0549632944f},
-std::array<float,2>{0.294110864f, 0.658127785f},
-std::array<float,2>{0.759027064f, 0.159455448f},
-std::array<float,2>{0.606565475f, 0.814356387f},
-std::array<float,2>{0.012116584f, 0.322029918f},
-std::array<float,2>{0.0691138804f, 0.506479979f},
-std::array<float,2>{0.546700299f, 0.068558313f},
-std::array<float,2>{0.833332479f, 0.968893409f},
-std::array<float,2>{0.371346503f, 0.495666891f},
-std::array<float,2>{0.48212257f, 0.751157701f},
-std::array<float,2>{0.95299238f, 0.277349204f},
-std::array<float,2>{0.640440822f, 0.704365671f},
-std::array<float,2>{0.204025f, 0.215548471f},
-std::array<float,2>{0.0444723181f, 0.853522301f},
-std::array<float,2>{0.580590785f, 0.366384208f},
-std::array<float,2>{0.798227191f, 0.637048185f},
-std::array<float,2>{0.262848169f, 0.147442758f},
-std::array<float,2>{0.397761732f, 0.610296845f},
-std::array<float,2>{0.904150665f, 0.0179755129f},
-std::array<float,2>{0.725692749f, 0.894107163f},
-std::array<float,2>{0.161660835f, 0.4093858f},
-std::array<float,2>{0.222004175f, 0.733635247f},
-std::array<float,2>{0.679323673f, 0.230420798f},
-std::array<float,2>{0.978522539f, 0.811960518f},
-std::array<float,2>{0.465556592f, 0.28172946f},
-std::array<float,2>{0.340662748f, 0.95120281f},
-std::array<float,2>{0.850665987f, 0.464385122f},
-std::array<float,2>{0.509675384f, 0.562282622f},
-std::array<float,2>{0.119093761f, 0.107338026f},
-std::array<float,2>{0.169017479f, 0.822962403f},
-std::array<float,2>{0.731177986f, 0.313728064f},
-std::array<float,2>{0.89325285f, 0.668709993f},
-std::array<float,2>{0.39956212f, 0.171631187f},
-std::array<float,2>{0.25682354f, 0.592738152f},
-std::array<float,2>{0.804718256f, 0.0489146411f},
-std::array<float,2>{0.593202472f, 0.916284144f},
-std::array<float,2>{0.0323123299f, 0.396709383f},
-std::array<float,2>{0.114037141f, 0.711790681f},
-std::array<float,2>{0.507582128f, 0.208292618f},
-std::array<float,2>{0.857546806f, 0.761861682f},
-std::array<float,2>{0.334236532f, 0.268692911f},
-std::array<float,2>{0.458879232f, 0.976699471f},
-std::array<float,2>{0.974934995f, 0.489805996f},
-std::array<float,2>{0.686431646f, 0.513645768f},
-std::array<float,2>{0.234196737f, 0.071698457f},
-std::array<float,2>{0.00239215535f, 0.904029012f},
-std::array<float,2>{0.600615442f, 0.420809865f},
-std::array<float,2>{0.754583538f, 0.619085491f},
-std::array<float,2>{0.287527829f, 0.0264891442f},
-std::array<float,2>{0.407528937f, 0.630304098f},
-std::array<float,2>{0.916503072f, 0.15332675f},
-std::array<float,2>{0.709483922f, 0.845958531f},
-std::array<float,2>{0.146402314f, 0.372033685f},
-std::array<float,2>{0.212706402f, 0.552006185f},
-std::array<float,2>{0.630995035f, 0.0964494944f},
-std::array<float,2>{0.938444436f, 0.944081306f},
-std::array<float,2>{0.474528104f, 0.458164185f},
-std::array<float,2>{0.361101091f, 0.797593236f},
-std::array<float,2>{0.842378139f, 0.289086312f},
-std::array<float,2>{0.536989868f, 0.722593606f},
-std::array<float,2>{0.0769331232f, 0.226142675f},
-std::array<float,2>{0.242051303f, 0.968129933f},
-std::array<float,2>{0.662636399f, 0.443220794f},
-std::array<float,2>{0.990847945f, 0.542068124f},
-std::array<float,2>{0.45109871f, 0.122966424f},
-std::array<float,2>{0.318130225f, 0.735687792f},
-std::array<float,2>{0.864410102f, 0.246101111f},
-std::array<float,2>{0.522714376f, 0.787734509f},
-std::array<float,2>{0.106408946f, 0.306700855f},
-std::array<float,2>{0.0507896654f, 0.5988307f},
-std::array<float,2>{0.565490365f, 0.00583348516f},
-std::array<float,2>{0.794506192f, 0.889194846f},
-std::array<float,2>{0.276299357f, 0.429639429f},
-std::array<float,2>{0.389649153f, 0.863323808f},
-std::array<float,2>{0.885761917f, 0.352567285f},
-std::array<float,2>{0.746372223f, 0.648566186f},
-std::array<float,2>{0.181242973f, 0.131409511f},
-std::array<float,2>{0.0909142941f, 0.772489071f},
-std::array<float,2>{0.555479109f, 0.263602823f},
-std::array<float,2>{0.817475259f, 0.689136863f},
-std::array<float,2>{0.349962026f, 0.196084753f},
-std::array<float,2>{0.497928858f, 0.516739428f},
-std::array<float,2>{0.953596771f, 0.0896053165f},
-std::array<float,2>{0.652881622f, 0.996373713f},
-std::array<float,2>{0.200153947f, 0.474433124f},
-std::array<float,2>{0.130856022f, 0.681138754f},
-std::array<float,2>{0.693627536f, 0.183823586f},
-std::array<float,2>{0.934286177f, 0.836387038f},
-std::array<float,2>{0.431106985f, 0.34273836f},
-std::array<float,2>{0.298210144f, 0.927841127f},
-std::array<float,2>{0.778881371f, 0.390116662f},
-std::array<float,2>{0.624595881f, 0.577726424f},
-std::array<float,2>{0.0208260138f, 0.0436540507f},
-std::array<float,2>{0.176162928f, 0.804394484f},
-std::array<float,2>{0.734967411f, 0.293477207f},
-std::array<float,2>{0.882504106f, 0.72350353f},
-std::array<float,2>{0.378005803f, 0.222132325f},
-std::array<float,2>{0.270971537f, 0.548184991f},
-std::array<float,2>{0.782136977f, 0.100287482f},
-std::array<float,2>{0.576678514f, 0.937989175f},
-std::array<float,2>{0.0594384484f, 0.453787416f},
-std::array<float,2>{0.0964972898f, 0.626218975f},
-std::array<float,2>{0.526292086f, 0.151745379f},
-std::array<float,2>{0.872531176f, 0.849842906f},
-std::array<float,2>{0.320793122f, 0.367476344f},
-std::array<float,2>{0.440967619f, 0.900599957f},
-std::array<float,2>{0.995351493f, 0.416606724f},
-std::array<float,2>{0.668274879f, 0.622454166f},
-std::array<float,2>{0.249974519f, 0.0278854128f},
-std::array<float,2>{0.0277152397f, 0.980647862f},
-std::array<float,2>{0.61138761f, 0.485920221f},
-std::array<float,2>{0.767531455f, 0.50908953f},
-std::array<float,2>{0.309715778f, 0.0773682445f},
-std::array<float,2>{0.425691009f, 0.716900349f},
-std::array<float,2>{0.927838981f, 0.203360811f},
-std::array<float,2>{0.703051925f, 0.760757387f},
-std::array<float,2>{0.139433011f, 0.272920996f},
-std::array<float,2>{0.194821835f, 0.587394357f},
-std::array<float,2>{0.648331344f, 0.0509388484f},
-std::array<float,2>{0.96654135f, 0.920992672f},
-std::array<float,2>{0.484761477f, 0.393061399f},
-std::array<float,2>{0.356473476f, 0.826146185f},
-std::array<float,2>{0.828014553f, 0.319588155f},
-std::array<float,2>{0.547590017f, 0.667123675f},
-std::array<float,2>{0.0846201777f, 0.167386815f},
-std::array<float,2>{0.224593043f, 0.92361939f},
-std::array<float,2>{0.674239635f, 0.383079499f},
-std::array<float,2>{0.983122826f, 0.571554661f},
-std::array<float,2>{0.463732123f, 0.0407250226f},
-std::array<float,2>{0.339700967f, 0.685790777f},
-std::array<float,2>{0.845229089f, 0.183578581f},
-std::array<float,2>{0.513241053f, 0.841883719f},
-std::array<float,2>{0.123998113f, 0.337639987f},
-std::array<float,2>{0.0428120382f, 0.521929801f},
-std::array<float,2>{0.583993554f, 0.0900422409f},
-std::array<float,2>{0.803606093f, 0.993702471f},
-std::array<float,2>{0.258714467f, 0.470579326f},
-std::array<float,2>{0.393750846f, 0.76566577f},
-std::array<float,2>{0.900941133f, 0.259678304f},
-std::array<float,2>{0.718772948f, 0.69181937f},
-std::array<float,2>{0.160046846f, 0.201463118f},
-std::array<float,2>{0.0644375458f, 0.862972319f},
-std::array<float,2>{0.540340841f, 0.356566519f},
-std::array<float,2>{0.831980765f, 0.653752685f},
-std::array<float,2>{0.3683016f, 0.128516123f},
-std::array<float,2>{0.477997482f, 0.594202638f},
-std::array<float,2>{0.948699832f, 0.000798478839f},
-std::array<float,2>{0.634121895f, 0.884324193f},
-std::array<float,2>{0.210862085f, 0.42547372f},
-std::array<float,2>{0.151556924f, 0.741568744f},
-std::array<float,2>{0.712903321f, 0.242887527f},
-std::array<float,2>{0.907275319f, 0.784634292f},
-std::array<float,2>{0.417034894f, 0.31151256f},
-std::array<float,2>{0.289991379f, 0.963405371f},
-std::array<float,2>{0.764241695f, 0.440750986f},
-std::array<float,2>{0.605176747f, 0.544926822f},
-std::array<float,2>{0.00879535545f, 0.117539845f},
-std::array<float,2>{0.218074724f, 0.831662774f},
-std::array<float,2>{0.628644943f, 0.33587113f},
-std::array<float,2>{0.942668915f, 0.677810609f},
-std::array<float,2>{0.470793217f, 0.1730441f},
-std::array<float,2>{0.364759535f, 0.5672791f},
-std::array<float,2>{0.8382411f, 0.0321108513f},
-std::array<float,2>{0.532550573f, 0.935257733f},
-std::array<float,2>{0.0735919252f, 0.382078409f},
-std::array<float,2>{0.00530628301f, 0.702288747f},
-std::array<float,2>{0.597196639f, 0.188667327f},
-std::array<float,2>{0.751005292f, 0.775731981f},
-std::array<float,2>{0.283859849f, 0.25692293f},
-std::array<float,2>{0.411928087f, 0.987033665f},
-std::array<float,2>{0.920771122f, 0.478338987f},
-std::array<float,2>{0.70341903f, 0.525613308f},
-std::array<float,2>{0.141589165f, 0.0825272948f},
-std::array<float,2>{0.112218291f, 0.87885952f},
-std::array<float,2>{0.500938118f, 0.434012055f},
-std::array<float,2>{0.851774633f, 0.603928626f},
-std::array<float,2>{0.329031527f, 0.0091552604f},
-std::array<float,2>{0.456407189f, 0.641834915f},
-std::array<float,2>{0.969229341f, 0.133310243f},
-std::array<float,2>{0.681363702f, 0.872212052f},
-std::array<float,2>{0.228825167f, 0.344208688f},
-std::array<float,2>{0.167132512f, 0.533797204f},
-std::array<float,2>{0.729098082f, 0.11688628f},
-std::array<float,2>{0.896901548f, 0.955706775f},
-std::array<float,2>{0.404499859f, 0.446003437f},
-std::array<float,2>{0.252132118f, 0.791617811f},
-std::array<float,2>{0.810453415f, 0.297392547f},
-std::array<float,2>{0.58821106f, 0.742682993f},
-std::array<float,2>{0.0368550718f, 0.236061096f},
-std::array<float,2>{0.125045091f, 0.947434068f},
-std::array<float,2>{0.690092146f, 0.468561679f},
-std::array<float,2>{0.932589173f, 0.558351338f},
-std::array<float,2>{0.433892667f, 0.105289415f},
-std::array<float,2>{0.303263098f, 0.727591157f},
-std::array<float,2>{0.776663125f, 0.23349379f},
-std::array<float,2>{0.617809832f, 0.807185233f},
-std::array<float,2>{0.017264314f, 0.287562132f},
-std::array<float,2>{0.0865441263f, 0.613907278f},
-std::array<float,2>{0.55915767f, 0.0204630047f},
-std::array<float,2>{0.814801514f, 0.895228505f},
-std::array<float,2>{0.346518546f, 0.413156122f},
-std::array<float,2>{0.493621171f, 0.857403696f},
-std::array<float,2>{0.960129082f, 0.360848606f},
-std::array<float,2>{0.651016533f, 0.635178804f},
-std::array<float,2>{0.195939898f, 0.142348275f},
-std::array<float,2>{0.0497230105f, 0.754190803f},
-std::array<float,2>{0.56661129f, 0.275493324f},
-std::array<float,2>{0.791662574f, 0.707715631f},
-std::array<float,2>{0.280954599f, 0.214557618f},
-std::array<float,2>{0.382960528f, 0.501903713f},
-std::array<float,2>{0.889661193f, 0.0650982633f},
-std::array<float,2>{0.744252861f, 0.973836541f},
-std::array<float,2>{0.185481668f, 0.496253371f},
-std::array<float,2>{0.235604122f, 0.660999715f},
-std::array<float,2>{0.657101572f, 0.160794929f},
-std::array<float,2>{0.988153934f, 0.818926036f},
-std::array<float,2>{0.447286993f, 0.327702463f},
-std::array<float,2>{0.315384477f, 0.906450331f},
-std::array<float,2>{0.862600267f, 0.401998848f},
-std::array<float,2>{0.51862818f, 0.582979262f},
-std::array<float,2>{0.102861859f, 0.0612085536f},
-std::array<float,2>{0.244520411f, 0.778200746f},
-std::array<float,2>{0.665443301f, 0.252547801f},
-std::array<float,2>{0.998749197f, 0.698130071f},
-std::array<float,2>{0.443555415f, 0.191791877f},
-std::array<float,2>{0.327187836f, 0.527746916f},
-std::array<float,2>{0.869080484f, 0.0783622414f},
-std::array<float,2>{0.529239476f, 0.992060661f},
-std::array<float,2>{0.0996982306f, 0.480618656f},
-std::array<float,2>{0.0569707341f, 0.671919942f},
-std::array<float,2>{0.572335124f, 0.177814215f},
-std::array<float,2>{0.786486089f, 0.835866272f},
-std::array<float,2>{0.26939103f, 0.329489946f},
-std::array<float,2>{0.380832046f, 0.930248559f},
-std::array<float,2>{0.87875396f, 0.376495302f},
-std::array<float,2>{0.738315523f, 0.563626766f},
-std::array<float,2>{0.175572351f, 0.0385527126f},
-std::array<float,2>{0.0817159414f, 0.95986408f},
-std::array<float,2>{0.551393509f, 0.449866563f},
-std::array<float,2>{0.823585868f, 0.535653293f},
-std::array<float,2>{0.352190942f, 0.111102171f},
-std::array<float,2>{0.491539001f, 0.749005735f},
-std::array<float,2>{0.963653922f, 0.23945795f},
-std::array<float,2>{0.642338216f, 0.79322958f},
-std::array<float,2>{0.19089292f, 0.302640736f},
-std::array<float,2>{0.134527951f, 0.607127666f},
-std::array<float,2>{0.698707402f, 0.014600941f},
-std::array<float,2>{0.923921227f, 0.879669964f},
-std::array<float,2>{0.426154733f, 0.429721773f},
-std::array<float,2>{0.306126386f, 0.869940996f},
-std::array<float,2>{0.770031512f, 0.349314123f},
-std::array<float,2>{0.616306841f, 0.648053885f},
-std::array<float,2>{0.026162833f, 0.139614001f},
-std::array<float,2>{0.162210703f, 0.892349422f},
-std::array<float,2>{0.723898292f, 0.406826109f},
-std::array<float,2>{0.906051815f, 0.61136502f},
-std::array<float,2>{0.395628482f, 0.0165175069f},
-std::array<float,2>{0.265508354f, 0.640616775f},
-std::array<float,2>{0.798861504f, 0.14558585f},
-std::array<float,2>{0.579904914f, 0.852033675f},
-std::array<float,2>{0.0450049192f, 0.364986986f},
-std::array<float,2>{0.119641274f, 0.559278548f},
-std::array<float,2>{0.510415614f, 0.108831793f},
-std::array<float,2>{0.847787976f, 0.950970948f},
-std::array<float,2>{0.34295544f, 0.46264866f},
-std::array<float,2>{0.467409104f, 0.809600413f},
-std::array<float,2>{0.97810483f, 0.284211606f},
-std::array<float,2>{0.675815642f, 0.732190847f},
-std::array<float,2>{0.218849272f, 0.228146672f},
-std::array<float,2>{0.0137831243f, 0.81525588f},
-std::array<float,2>{0.608559728f, 0.323038161f},
-std::array<float,2>{0.760084867f, 0.658703864f},
-std::array<float,2>{0.29547736f, 0.156325638f},
-std::array<float,2>{0.421585232f, 0.580754876f},
-std::array<float,2>{0.91126281f, 0.0570980608f},
-std::array<float,2>{0.71730274f, 0.912222922f},
-std::array<float,2>{0.154772058f, 0.40269655f},
-std::array<float,2>{0.205412939f, 0.705498695f},
-std::array<float,2>{0.63694346f, 0.21761322f},
-std::array<float,2>{0.950650752f, 0.752873778f},
-std::array<float,2>{0.484124571f, 0.280839682f},
-std::array<float,2>{0.374575913f, 0.971948504f},
-std::array<float,2>{0.83461076f, 0.493499249f},
-std::array<float,2>{0.543691218f, 0.505449414f},
-std::array<float,2>{0.0672729164f, 0.0675111637f},
-std::array<float,2>{0.147497848f, 0.844222069f},
-std::array<float,2>{0.707660556f, 0.374984145f},
-std::array<float,2>{0.91443789f, 0.632171988f},
-std::array<float,2>{0.40899685f, 0.156175554f},
-std::array<float,2>{0.286901832f, 0.620711088f},
-std::array<float,2>{0.757489562f, 0.0245412569f},
-std::array<float,2>{0.598851979f, 0.905964136f},
-std::array<float,2>{0.000243267263f, 0.419833988f},
-std::array<float,2>{0.0760403052f, 0.719485521f},
-std::array<float,2>{0.537445426f, 0.222832084f},
-std::array<float,2>{0.841339052f, 0.799242973f},
-std::array<float,2>{0.36171329f, 0.291431308f},
-std::array<float,2>{0.474740148f, 0.942670166f},
-std::array<float,2>{0.940822244f, 0.460259706f},
-std::array<float,2>{0.629124641f, 0.554348528f},
-std::array<float,2>{0.21409592f, 0.0939254165f},
-std::array<float,2>{0.0349962972f, 0.914847553f},
-std::array<float,2>{0.591004014f, 0.395701885f},
-std::array<float,2>{0.808034241f, 0.590160489f},
-std::array<float,2>{0.255547076f, 0.0469194576f},
-std::array<float,2>{0.400798768f, 0.670098722f},
-std::array<float,2>{0.890964091f, 0.168763995f},
-std::array<float,2>{0.734288573f, 0.82095623f},
-std::array<float,2>{0.171103671f, 0.315007627f},
-std::array<float,2>{0.231969312f, 0.515123129f},
-std::array<float,2>{0.683596194f, 0.0733651519f},
-std::array<float,2>{0.973306417f, 0.980371952f},
-std::array<float,2>{0.459449738f, 0.490380675f},
-std::array<float,2>{0.333005518f, 0.765452623f},
-std::array<float,2>{0.857140541f, 0.266039908f},
-std::array<float,2>{0.504997551f, 0.714366138f},
-std::array<float,2>{0.115622021f, 0.209339663f},
-std::array<float,2>{0.202107891f, 0.999328196f},
-std::array<float,2>{0.654830098f, 0.475971222f},
-std::array<float,2>{0.956470191f, 0.519466341f},
-std::array<float,2>{0.49815464f, 0.0864681676f},
-std::array<float,2>{0.348398715f, 0.689629793f},
-std::array<float,2>{0.81960988f, 0.19832249f},
-std::array<float,2>{0.558477163f, 0.769713044f},
-std::array<float,2>{0.0923772305f, 0.265154898f},
-std::array<float,2>{0.0216102749f, 0.576111972f},
-std::array<float,2>{0.621596575f, 0.0456501022f},
-std::array<float,2>{0.779888928f, 0.926937342f},
-std::array<float,2>{0.300688922f, 0.387253612f},
-std::array<float,2>{0.433271229f, 0.839047313f},
-std::array<float,2>{0.935753763f, 0.340739816f},
-std::array<float,2>{0.692027688f, 0.682916045f},
-std::array<float,2>{0.132046863f, 0.187196732f},
-std::array<float,2>{0.109048203f, 0.786689043f},
-std::array<float,2>{0.519863665f, 0.304810613f},
-std::array<float,2>{0.866527736f, 0.73716265f},
-std::array<float,2>{0.319512933f, 0.249253452f},
-std::array<float,2>{0.451594651f, 0.54063344f},
-std::array<float,2>{0.989225566f, 0.124039657f},
-std::array<float,2>{0.661785841f, 0.966716051f},
-std::array<float,2>{0.239332885f, 0.444247901f},
-std::array<float,2>{0.182207942f, 0.651870906f},
-std::array<float,2>{0.749232352f, 0.130361214f},
-std::array<float,2>{0.883380294f, 0.8669402f},
-std::array<float,2>{0.387135714f, 0.354874462f},
-std::array<float,2>{0.274519205f, 0.888375282f},
-std::array<float,2>{0.796093524f, 0.427119523f},
-std::array<float,2>{0.56357801f, 0.60034126f},
-std::array<float,2>{0.0541027039f, 0.00676553277f},
-std::array<float,2>{0.127224028f, 0.807033122f},
-std::array<float,2>{0.688581705f, 0.287771434f},
-std::array<float,2>{0.930293322f, 0.728103042f},
-std::array<float,2>{0.436825186f, 0.234008119f},
-std::array<float,2>{0.301862359f, 0.557817757f},
-std::array<float,2>{0.774880946f, 0.104733139f},
-std::array<float,2>{0.620303452f, 0.94793731f},
-std::array<float,2>{0.0186065901f, 0.468210667f},
-std::array<float,2>{0.0887455791f, 0.635272145f},
-std::array<float,2>{0.56199652f, 0.141719401f},
-std::array<float,2>{0.813261271f, 0.856705725f},
-std::array<float,2>{0.345669985f, 0.360407025f},
-std::array<float,2>{0.495035231f, 0.894679427f},
-std::array<float,2>{0.957250476f, 0.413793445f},
-std::array<float,2>{0.649816036f, 0.613315165f},
-std::array<float,2>{0.198533654f, 0.0195654631f},
-std::array<float,2>{0.0477089211f, 0.974488676f},
-std::array<float,2>{0.570012569f, 0.496780634f},
-std::array<float,2>{0.789840341f, 0.501348972f},
-std::array<float,2>{0.277689695f, 0.0648896769f},
-std::array<float,2>{0.386659026f, 0.707367718f},
-std::array<float,2>{0.888631642f, 0.21399121f},
-std::array<float,2>{0.743108451f, 0.75482589f},
-std::array<float,2>{0.186912581f, 0.276165217f},
-std::array<float,2>{0.237578943f, 0.582204759f},
-std::array<float,2>{0.660153329f, 0.0608801991f},
-std::array<float,2>{0.984631777f, 0.907224178f},
-std::array<float,2>{0.445574313f, 0.401525944f},
-std::array<float,2>{0.314050436f, 0.818615258f},
-std::array<float,2>{0.85960871f, 0.327513635f},
-std::array<float,2>{0.516440868f, 0.660301745f},
-std::array<float,2>{0.104467332f, 0.160457507f},
-std::array<float,2>{0.216489628f, 0.934691846f},
-std::array<float,2>{0.625592351f, 0.382668942f},
-std::array<float,2>{0.944461226f, 0.566685915f},
-std::array<float,2>{0.469932675f, 0.0313556232f},
-std::array<float,2>{0.365552545f, 0.678620636f},
-std::array<float,2>{0.836058617f, 0.173828006f},
-std::array<float,2>{0.533608973f, 0.83126229f},
-std::array<float,2>{0.0707114413f, 0.335289091f},
-std::array<float,2>{0.00717264693f, 0.526016355f},
-std::array<float,2>{0.594294012f, 0.0824140534f},
-std::array<float,2>{0.752224803f, 0.98672986f},
-std::array<float,2>{0.282460809f, 0.47797963f},
-std::array<float,2>{0.412312359f, 0.775918126f},
-std::array<float,2>{0.918971121f, 0.257630676f},
-std::array<float,2>{0.70602721f, 0.702716231f},
-std::array<float,2>{0.144316882f, 0.189088315f},
-std::array<float,2>{0.110571675f, 0.873004436f},
-std::array<float,2>{0.503674865f, 0.344721287f},
-std::array<float,2>{0.853758514f, 0.642522812f},
-std::array<float,2>{0.331356704f, 0.132986337f},
-std::array<float,2>{0.453876972f, 0.604041934f},
-std::array<float,2>{0.972516656f, 0.00946885254f},
-std::array<float,2>{0.683429122f, 0.878176153f},
-std::array<float,2>{0.227601945f, 0.434142113f},
-std::array<float,2>{0.165009439f, 0.742241263f},
-std::array<float,2>{0.728397787f, 0.235406592f},
-std::array<float,2>{0.895377755f, 0.791200042f},
-std::array<float,2>{0.40347454f, 0.297030896f},
-std::array<float,2>{0.25137496f, 0.955176711f},
-std::array<float,2>{0.811476886f, 0.445507616f},
-std::array<float,2>{0.58709079f, 0.533403993f},
-std::array<float,2>{0.0375748351f, 0.116333157f},
-std::array<float,2>{0.224867329f, 0.842643976f},
-std::array<float,2>{0.672410846f, 0.337023497f},
-std::array<float,2>{0.981229961f, 0.686066985f},
-std::array<float,2>{0.461970568f, 0.183061898f},
-std::array<float,2>{0.337781131f, 0.572244644f},
-std::array<float,2>{0.847316742f, 0.0403452478f},
-std::array<float,2>{0.51400727f, 0.922989249f},
-std::array<float,2>{0.122772641f, 0.38376689f},
-std::array<float,2>{0.0391174406f, 0.692062497f},
-std::array<float,2>{0.582504153f, 0.201753199f},
-std::array<float,2>{0.801072419f, 0.766308844f},
-std::array<float,2>{0.260690242f, 0.258964241f},
-std::array<float,2>{0.390748531f, 0.993462384f},
-std::array<float,2>{0.898803592f, 0.470206469f},
-std::array<float,2>{0.721467316f, 0.521986187f},
-std::array<float,2>{0.156623065f, 0.0907273591f},
-std::array<float,2>{0.0648370013f, 0.883795559f},
-std::array<float,2>{0.542127907f, 0.424854666f},
-std::array<float,2>{0.828830063f, 0.59448868f},
-std::array<float,2>{0.369843423f, 2.31502036e-05f},
-std::array<float,2>{0.478748709f, 0.653934896f},
-std::array<float,2>{0.946506083f, 0.128384307f},
-std::array<float,2>{0.635294676f, 0.862786531f},
-std::array<float,2>{0.207444683f, 0.35698396f},
-std::array<float,2>{0.149546951f, 0.545493662f},
-std::array<float,2>{0.712043166f, 0.11799334f},
-std::array<float,2>{0.90993011f, 0.963232219f},
-std::array<float,2>{0.415464818f, 0.440942228f},
-std::array<float,2>{0.291862428f, 0.784732938f},
-std::array<float,2>{0.76330328f, 0.310833663f},
-std::array<float,2>{0.601883054f, 0.741770446f},
-std::array<float,2>{0.0105003081f, 0.242273465f},
-std::array<float,2>{0.179124072f, 0.93767482f},
-std::array<float,2>{0.737163782f, 0.453494102f},
-std::array<float,2>{0.880199134f, 0.548474848f},
-std::array<float,2>{0.375433177f, 0.0997803956f},
-std::array<float,2>{0.272021085f, 0.722841024f},
-std::array<float,2>{0.783483386f, 0.222240269f},
-std::array<float,2>{0.575492442f, 0.80393517f},
-std::array<float,2>{0.0620250292f, 0.292995155f},
-std::array<float,2>{0.0948141739f, 0.622766972f},
-std::array<float,2>{0.523761988f, 0.0278276969f},
-std::array<float,2>{0.874499619f, 0.901161671f},
-std::array<float,2>{0.323627383f, 0.416290104f},
-std::array<float,2>{0.438797295f, 0.850168169f},
-std::array<float,2>{0.99320817f, 0.368052989f},
-std::array<float,2>{0.671452343f, 0.62658143f},
-std::array<float,2>{0.246298939f, 0.152118668f},
-std::array<float,2>{0.0309039559f, 0.761350334f},
-std::array<float,2>{0.610770345f, 0.273041099f},
-std::array<float,2>{0.769184411f, 0.717504084f},
-std::array<float,2>{0.312485546f, 0.203818068f},
-std::array<float,2>{0.422008663f, 0.509605408f},
-std::array<float,2>{0.925986648f, 0.0780157819f},
-std::array<float,2>{0.699807107f, 0.981158733f},
-std::array<float,2>{0.137210131f, 0.485739291f},
-std::array<float,2>{0.193304464f, 0.667687237f},
-std::array<float,2>{0.645683765f, 0.167526782f},
-std::array<float,2>{0.967860162f, 0.825233996f},
-std::array<float,2>{0.486340016f, 0.320067763f},
-std::array<float,2>{0.358775973f, 0.921564043f},
-std::array<float,2>{0.825893939f, 0.393539041f},
-std::array<float,2>{0.550300717f, 0.587577164f},
-std::array<float,2>{0.0822091848f, 0.0515075587f},
-std::array<float,2>{0.19945173f, 0.770253956f},
-std::array<float,2>{0.652505755f, 0.264936209f},
-std::array<float,2>{0.953870058f, 0.690045714f},
-std::array<float,2>{0.497282803f, 0.199037105f},
-std::array<float,2>{0.35045886f, 0.518554866f},
-std::array<float,2>{0.818053365f, 0.0864162371f},
-std::array<float,2>{0.554854095f, 0.99982357f},
-std::array<float,2>{0.0914282575f, 0.476522893f},
-std::array<float,2>{0.0214708075f, 0.68331188f},
-std::array<float,2>{0.624158204f, 0.186942488f},
-std::array<float,2>{0.778538585f, 0.8396613f},
-std::array<float,2>{0.298505664f, 0.340029806f},
-std::array<float,2>{0.431256205f, 0.927354217f},
-std::array<float,2>{0.933918595f, 0.387200058f},
-std::array<float,2>{0.693849564f, 0.575305879f},
-std::array<float,2>{0.129933327f, 0.045223888f},
-std::array<float,2>{0.105503671f, 0.966049075f},
-std::array<float,2>{0.523261428f, 0.443489283f},
-std::array<float,2>{0.865193665f, 0.540178657f},
-std::array<float,2>{0.317866504f, 0.124811463f},
-std::array<float,2>{0.450273156f, 0.736433327f},
-std::array<float,2>{0.990447581f, 0.249992386f},
-std::array<float,2>{0.662506342f, 0.786343038f},
-std::array<float,2>{0.241459399f, 0.30562222f},
-std::array<float,2>{0.18069452f, 0.599858701f},
-std::array<float,2>{0.746821046f, 0.0059245117f},
-std::array<float,2>{0.886292458f, 0.887932181f},
-std::array<float,2>{0.390205473f, 0.427719951f},
-std::array<float,2>{0.275845736f, 0.866627216f},
-std::array<float,2>{0.794403017f, 0.355171502f},
-std::array<float,2>{0.566116989f, 0.651495934f},
-std::array<float,2>{0.0515015349f, 0.130828708f},
-std::array<float,2>{0.145702779f, 0.905601919f},
-std::array<float,2>{0.70933032f, 0.419030994f},
-std::array<float,2>{0.916731179f, 0.620123029f},
-std::array<float,2>{0.408069104f, 0.0249338672f},
-std::array<float,2>{0.288014084f, 0.632458866f},
-std::array<float,2>{0.753913999f, 0.155391306f},
-std::array<float,2>{0.601313889f, 0.844447792f},
-std::array<float,2>{0.00286159851f, 0.374253273f},
-std::array<float,2>{0.0762255415f, 0.55414629f},
-std::array<float,2>{0.536452889f, 0.0943919048f},
-std::array<float,2>{0.841998756f, 0.943190932f},
-std::array<float,2>{0.360595912f, 0.460759461f},
-std::array<float,2>{0.47365129f, 0.799580455f},
-std::array<float,2>{0.937921107f, 0.291706949f},
-std::array<float,2>{0.631465793f, 0.719206274f},
-std::array<float,2>{0.212276608f, 0.223615319f},
-std::array<float,2>{0.0331993774f, 0.820551276f},
-std::array<float,2>{0.593634963f, 0.314808786f},
-std::array<float,2>{0.805440843f, 0.670674443f},
-std::array<float,2>{0.256272554f, 0.168172687f},
-std::array<float,2>{0.400137693f, 0.590684175f},
-std::array<float,2>{0.892590404f, 0.0474373847f},
-std::array<float,2>{0.730478823f, 0.914524376f},
-std::array<float,2>{0.169819176f, 0.396479964f},
-std::array<float,2>{0.233683035f, 0.714287579f},
-std::array<float,2>{0.685855627f, 0.209928751f},
-std::array<float,2>{0.975429952f, 0.764955461f},
-std::array<float,2>{0.458376259f, 0.266166538f},
-std::array<float,2>{0.33448714f, 0.979749739f},
-std::array<float,2>{0.858273983f, 0.490773886f},
-std::array<float,2>{0.507265985f, 0.5151847f},
-std::array<float,2>{0.113434963f, 0.0741323307f},
-std::array<float,2>{0.161269903f, 0.852125466f},
-std::array<float,2>{0.726082146f, 0.364266604f},
-std::array<float,2>{0.903646827f, 0.640024424f},
-std::array<float,2>{0.398087233f, 0.146451414f},
-std::array<float,2>{0.263633877f, 0.612081826f},
-std::array<float,2>{0.798700035f, 0.0157115459f},
-std::array<float,2>{0.580342233f, 0.891798317f},
-std::array<float,2>{0.0443759523f, 0.406330049f},
-std::array<float,2>{0.118400566f, 0.731767833f},
-std::array<float,2>{0.509150445f, 0.227547809f},
-std::array<float,2>{0.851263165f, 0.810178041f},
-std::array<float,2>{0.340219051f, 0.284927726f},
-std::array<float,2>{0.465138704f, 0.950232685f},
-std::array<float,2>{0.979054749f, 0.461952776f},
-std::array<float,2>{0.678860724f, 0.558852792f},
-std::array<float,2>{0.222200438f, 0.1089895f},
-std::array<float,2>{0.0123335905f, 0.912623286f},
-std::array<float,2>{0.607026935f, 0.403004736f},
-std::array<float,2>{0.759402454f, 0.580124855f},
-std::array<float,2>{0.294519484f, 0.0571452677f},
-std::array<float,2>{0.418323755f, 0.658431411f},
-std::array<float,2>{0.91305995f, 0.156860486f},
-std::array<float,2>{0.715434015f, 0.814507723f},
-std::array<float,2>{0.154285774f, 0.322467357f},
-std::array<float,2>{0.203202069f, 0.505287409f},
-std::array<float,2>{0.639877379f, 0.0681142434f},
-std::array<float,2>{0.952244759f, 0.972605765f},
-std::array<float,2>{0.481712103f, 0.493911237f},
-std::array<float,2>{0.371625423f, 0.752201378f},
-std::array<float,2>{0.83382982f, 0.280688465f},
-std::array<float,2>{0.545938015f, 0.706042171f},
-std::array<float,2>{0.0684018955f, 0.216996968f},
-std::array<float,2>{0.243176758f, 0.99125284f},
-std::array<float,2>{0.666018367f, 0.481165171f},
-std::array<float,2>{0.99765408f, 0.528257728f},
-std::array<float,2>{0.442103207f, 0.0788152441f},
-std::array<float,2>{0.324511945f, 0.697283089f},
-std::array<float,2>{0.870790362f, 0.191978753f},
-std::array<float,2>{0.531151116f, 0.777829766f},
-std::array<float,2>{0.0981989428f, 0.252155811f},
-std::array<float,2>{0.0556920283f, 0.564152539f},
-std::array<float,2>{0.570492148f, 0.0387102924f},
-std::array<float,2>{0.788797438f, 0.929782808f},
-std::array<float,2>{0.266942382f, 0.376377255f},
-std::array<float,2>{0.381748617f, 0.835222006f},
-std::array<float,2>{0.87617898f, 0.330030233f},
-std::array<float,2>{0.740251482f, 0.672632992f},
-std::array<float,2>{0.172920719f, 0.178505644f},
-std::array<float,2>{0.0783907101f, 0.793549061f},
-std::array<float,2>{0.553606808f, 0.302094817f},
-std::array<float,2>{0.820488989f, 0.748220682f},
-std::array<float,2>{0.353659749f, 0.239765063f},
-std::array<float,2>{0.490091741f, 0.535639703f},
-std::array<float,2>{0.961577952f, 0.110710062f},
-std::array<float,2>{0.643377006f, 0.959190905f},
-std::array<float,2>{0.189348102f, 0.449280053f},
-std::array<float,2>{0.13595067f, 0.647944689f},
-std::array<float,2>{0.696973741f, 0.138792872f},
-std::array<float,2>{0.923275948f, 0.869450271f},
-std::array<float,2>{0.427901238f, 0.348963737f},
-std::array<float,2>{0.306665093f, 0.878913522f},
-std::array<float,2>{0.771961212f, 0.430186599f},
-std::array<float,2>{0.613846838f, 0.606754899f},
-std::array<float,2>{0.0253466964f, 0.0140217291f},
-std::array<float,2>{0.185044333f, 0.756167471f},
-std::array<float,2>{0.745072603f, 0.274645269f},
-std::array<float,2>{0.890301287f, 0.7099998f},
-std::array<float,2>{0.383533478f, 0.212593466f},
-std::array<float,2>{0.280336559f, 0.503416061f},
-std::array<float,2>{0.791266322f, 0.0626056418f},
-std::array<float,2>{0.56707418f, 0.976062596f},
-std::array<float,2>{0.0491978079f, 0.498305082f},
-std::array<float,2>{0.103081912f, 0.66348511f},
-std::array<float,2>{0.519510984f, 0.162620366f},
-std::array<float,2>{0.863135219f, 0.817120731f},
-std::array<float,2>{0.314922154f, 0.325546592f},
-std::array<float,2>{0.447853476f, 0.909286797f},
-std::array<float,2>{0.987517416f, 0.398652047f},
-std::array<float,2>{0.656615913f, 0.585686028f},
-std::array<float,2>{0.236043975f, 0.0600047633f},
-std::array<float,2>{0.017063655f, 0.946505547f},
-std::array<float,2>{0.617413402f, 0.465617508f},
-std::array<float,2>{0.777024746f, 0.555856884f},
-std::array<float,2>{0.30287078f, 0.102075502f},
-std::array<float,2>{0.434553206f, 0.730306864f},
-std::array<float,2>{0.931821883f, 0.23203738f},
-std::array<float,2>{0.689919174f, 0.806207478f},
-std::array<float,2>{0.125651598f, 0.286078155f},
-std::array<float,2>{0.195603222f, 0.616671324f},
-std::array<float,2>{0.650497913f, 0.0224626642f},
-std::array<float,2>{0.960797429f, 0.896880746f},
-std::array<float,2>{0.493730158f, 0.412108928f},
-std::array<float,2>{0.345710397f, 0.858669817f},
-std::array<float,2>{0.815276504f, 0.36151883f},
-std::array<float,2>{0.558720946f, 0.63457042f},
-std::array<float,2>{0.0863256678f, 0.142892689f},
-std::array<float,2>{0.229253352f, 0.875426531f},
-std::array<float,2>{0.680807173f, 0.436387092f},
-std::array<float,2>{0.969337463f, 0.603483438f},
-std::array<float,2>{0.456705183f, 0.00989382248f},
-std::array<float,2>{0.328513712f, 0.643027604f},
-std::array<float,2>{0.852339387f, 0.13481459f},
-std::array<float,2>{0.500278533f, 0.873118758f},
-std::array<float,2>{0.111751899f, 0.34705022f},
-std::array<float,2>{0.0365489833f, 0.531942308f},
-std::array<float,2>{0.588729024f, 0.113991678f},
-std::array<float,2>{0.80994761f, 0.95327127f},
-std::array<float,2>{0.252865136f, 0.448222965f},
-std::array<float,2>{0.404997528f, 0.78917706f},
-std::array<float,2>{0.896974564f, 0.300434589f},
-std::array<float,2>{0.728879154f, 0.74480325f},
-std::array<float,2>{0.167532519f, 0.236373931f},
-std::array<float,2>{0.0739742965f, 0.828517079f},
-std::array<float,2>{0.532748461f, 0.332137287f},
-std::array<float,2>{0.838809669f, 0.677539527f},
-std::array<float,2>{0.364518434f, 0.174493611f},
-std::array<float,2>{0.471558571f, 0.568959534f},
-std::array<float,2>{0.942899287f, 0.0342317149f},
-std::array<float,2>{0.627985477f, 0.9356094f},
-std::array<float,2>{0.218374014f, 0.379935414f},
-std::array<float,2>{0.140723199f, 0.699467361f},
-std::array<float,2>{0.704059005f, 0.189961761f},
-std::array<float,2>{0.920228481f, 0.774856865f},
-std::array<float,2>{0.411134124f, 0.25570941f},
-std::array<float,2>{0.283372581f, 0.984569728f},
-std::array<float,2>{0.751738548f, 0.479776889f},
-std::array<float,2>{0.596810043f, 0.523498774f},
-std::array<float,2>{0.00577477412f, 0.0848446265f},
-std::array<float,2>{0.210315019f, 0.860069096f},
-std::array<float,2>{0.634437203f, 0.357460231f},
-std::array<float,2>{0.949005246f, 0.655175328f},
-std::array<float,2>{0.478180915f, 0.125398368f},
-std::array<float,2>{0.368891954f, 0.597005725f},
-std::array<float,2>{0.831256092f, 0.00371992309f},
-std::array<float,2>{0.540630579f, 0.885411203f},
-std::array<float,2>{0.0637797192f, 0.423758924f},
-std::array<float,2>{0.0094639454f, 0.73855722f},
-std::array<float,2>{0.604767025f, 0.245094389f},
-std::array<float,2>{0.763944864f, 0.783003628f},
-std::array<float,2>{0.289310217f, 0.308960438f},
-std::array<float,2>{0.417920083f, 0.96181345f},
-std::array<float,2>{0.907766223f, 0.439081788f},
-std::array<float,2>{0.713447034f, 0.544700921f},
-std::array<float,2>{0.151976094f, 0.119567841f},
-std::array<float,2>{0.1232007f, 0.924399614f},
-std::array<float,2>{0.512762368f, 0.386428922f},
-std::array<float,2>{0.844951689f, 0.573040724f},
-std::array<float,2>{0.338992536f, 0.041450806f},
-std::array<float,2>{0.462999105f, 0.684818327f},
-std::array<float,2>{0.982545435f, 0.180074155f},
-std::array<float,2>{0.674619913f, 0.8403247f},
-std::array<float,2>{0.223841548f, 0.339630127f},
-std::array<float,2>{0.159459174f, 0.520407438f},
-std::array<float,2>{0.719687581f, 0.0929886475f},
-std::array<float,2>{0.900754988f, 0.994272053f},
-std::array<float,2>{0.394212037f, 0.471000433f},
-std::array<float,2>{0.257931858f, 0.768664002f},
-std::array<float,2>{0.80295521f, 0.261237383f},
-std::array<float,2>{0.584922016f, 0.694899797f},
-std::array<float,2>{0.0421562269f, 0.200849771f},
-std::array<float,2>{0.139053836f, 0.982822597f},
-std::array<float,2>{0.702161729f, 0.487871379f},
-std::array<float,2>{0.928685725f, 0.510143816f},
-std::array<float,2>{0.425062358f, 0.0746126994f},
-std::array<float,2>{0.310483813f, 0.715893745f},
-std::array<float,2>{0.767037511f, 0.205116048f},
-std::array<float,2>{0.611998498f, 0.758704007f},
-std::array<float,2>{0.0283111427f, 0.269842982f},
-std::array<float,2>{0.0844320878f, 0.589021444f},
-std::array<float,2>{0.547060013f, 0.0545221642f},
-std::array<float,2>{0.82742995f, 0.918454647f},
-std::array<float,2>{0.357015938f, 0.390812486f},
-std::array<float,2>{0.485112607f, 0.826329768f},
-std::array<float,2>{0.966013134f, 0.317889452f},
-std::array<float,2>{0.647911787f, 0.664235711f},
-std::array<float,2>{0.19492732f, 0.165013015f},
-std::array<float,2>{0.0586923808f, 0.8009516f},
-std::array<float,2>{0.576413333f, 0.295290828f},
-std::array<float,2>{0.781411707f, 0.724863708f},
-std::array<float,2>{0.271021485f, 0.220219672f},
-std::array<float,2>{0.378776938f, 0.550047398f},
-std::array<float,2>{0.882111669f, 0.0990936905f},
-std::array<float,2>{0.734644711f, 0.940276802f},
-std::array<float,2>{0.176328197f, 0.455947042f},
-std::array<float,2>{0.249307081f, 0.627558053f},
-std::array<float,2>{0.668501854f, 0.149621606f},
-std::array<float,2>{0.995874345f, 0.848925829f},
-std::array<float,2>{0.44068566f, 0.370062768f},
-std::array<float,2>{0.321272463f, 0.899996102f},
-std::array<float,2>{0.872621417f, 0.414537609f},
-std::array<float,2>{0.525785148f, 0.624931574f},
-std::array<float,2>{0.0960378572f, 0.0294369701f},
-std::array<float,2>{0.23980543f, 0.787403703f},
-std::array<float,2>{0.661499441f, 0.307165384f},
-std::array<float,2>{0.988442659f, 0.736265004f},
-std::array<float,2>{0.451873451f, 0.246682703f},
-std::array<float,2>{0.320147336f, 0.542498887f},
-std::array<float,2>{0.866715491f, 0.122190788f},
-std::array<float,2>{0.520232022f, 0.968748748f},
-std::array<float,2>{0.108632624f, 0.442622781f},
-std::array<float,2>{0.0542261451f, 0.649213374f},
-std::array<float,2>{0.564337254f, 0.131291613f},
-std::array<float,2>{0.796552777f, 0.864052415f},
-std::array<float,2>{0.274967492f, 0.353311032f},
-std::array<float,2>{0.387601346f, 0.88896054f},
-std::array<float,2>{0.882900834f, 0.428738564f},
-std::array<float,2>{0.749867797f, 0.599253774f},
-std::array<float,2>{0.181642383f, 0.00532214344f},
-std::array<float,2>{0.0918321982f, 0.99690485f},
-std::array<float,2>{0.55783093f, 0.473666668f},
-std::array<float,2>{0.820076227f, 0.517181218f},
-std::array<float,2>{0.347755492f, 0.0892807916f},
-std::array<float,2>{0.498724699f, 0.688718855f},
-std::array<float,2>{0.956679881f, 0.195362449f},
-std::array<float,2>{0.654335916f, 0.773258686f},
-std::array<float,2>{0.201604232f, 0.262910843f},
-std::array<float,2>{0.132803112f, 0.577631891f},
-std::array<float,2>{0.69162333f, 0.0430107452f},
-std::array<float,2>{0.936049402f, 0.928410232f},
-std::array<float,2>{0.432994097f, 0.39024362f},
-std::array<float,2>{0.300130099f, 0.836585343f},
-std::array<float,2>{0.779666424f, 0.34192881f},
-std::array<float,2>{0.621230423f, 0.681238532f},
-std::array<float,2>{0.0224374626f, 0.184477702f},
-std::array<float,2>{0.171777338f, 0.916818321f},
-std::array<float,2>{0.733866572f, 0.397242814f},
-std::array<float,2>{0.891594946f, 0.592245519f},
-std::array<float,2>{0.401139647f, 0.04939311f},
-std::array<float,2>{0.255007297f, 0.668080866f},
-std::array<float,2>{0.808166444f, 0.170932576f},
-std::array<float,2>{0.591502845f, 0.822354794f},
-std::array<float,2>{0.0346232057f, 0.314313531f},
-std::array<float,2>{0.116047561f, 0.512859881f},
-std::array<float,2>{0.505536556f, 0.072173886f},
-std::array<float,2>{0.856628239f, 0.977268934f},
-std::array<float,2>{0.332124025f, 0.489288032f},
-std::array<float,2>{0.459703654f, 0.762283862f},
-std::array<float,2>{0.972701073f, 0.269344866f},
-std::array<float,2>{0.684221625f, 0.711365223f},
-std::array<float,2>{0.23167707f, 0.208749264f},
-std::array<float,2>{0.000671725022f, 0.84637022f},
-std::array<float,2>{0.59939301f, 0.371306062f},
-std::array<float,2>{0.757279396f, 0.630803406f},
-std::array<float,2>{0.286520511f, 0.154083714f},
-std::array<float,2>{0.408257127f, 0.618602097f},
-std::array<float,2>{0.914705813f, 0.0271974616f},
-std::array<float,2>{0.707201064f, 0.903470635f},
-std::array<float,2>{0.148092613f, 0.420070082f},
-std::array<float,2>{0.214808375f, 0.722029448f},
-std::array<float,2>{0.629473805f, 0.225603864f},
-std::array<float,2>{0.941187263f, 0.796983242f},
-std::array<float,2>{0.475218236f, 0.289973348f},
-std::array<float,2>{0.361979663f, 0.943359792f},
-std::array<float,2>{0.84122622f, 0.458499283f},
-std::array<float,2>{0.537719071f, 0.552395344f},
-std::array<float,2>{0.0754673257f, 0.0961065739f},
-std::array<float,2>{0.155191332f, 0.813724101f},
-std::array<float,2>{0.716853499f, 0.321755707f},
-std::array<float,2>{0.91200757f, 0.657324135f},
-std::array<float,2>{0.421003342f, 0.160137057f},
-std::array<float,2>{0.294969559f, 0.580001354f},
-std::array<float,2>{0.760303557f, 0.0551772937f},
-std::array<float,2>{0.609064698f, 0.911131263f},
-std::array<float,2>{0.0145848002f, 0.406006902f},
-std::array<float,2>{0.0667097121f, 0.704829633f},
-std::array<float,2>{0.543118238f, 0.214907646f},
-std::array<float,2>{0.834336817f, 0.751846969f},
-std::array<float,2>{0.374236524f, 0.278085679f},
-std::array<float,2>{0.483838737f, 0.969409704f},
-std::array<float,2>{0.950702012f, 0.495530039f},
-std::array<float,2>{0.637622118f, 0.506201923f},
-std::array<float,2>{0.205806002f, 0.06919875f},
-std::array<float,2>{0.045730833f, 0.893755794f},
-std::array<float,2>{0.579436183f, 0.409699678f},
-std::array<float,2>{0.799367666f, 0.609383225f},
-std::array<float,2>{0.264809281f, 0.0180761199f},
-std::array<float,2>{0.396045923f, 0.637653291f},
-std::array<float,2>{0.905704081f, 0.146679759f},
-std::array<float,2>{0.724366128f, 0.854349315f},
-std::array<float,2>{0.162813157f, 0.366853356f},
-std::array<float,2>{0.219442084f, 0.561877191f},
-std::array<float,2>{0.676373124f, 0.106614321f},
-std::array<float,2>{0.977610767f, 0.952046275f},
-std::array<float,2>{0.467156589f, 0.464184761f},
-std::array<float,2>{0.34372279f, 0.812055886f},
-std::array<float,2>{0.848145962f, 0.28202486f},
-std::array<float,2>{0.509874165f, 0.734048784f},
-std::array<float,2>{0.119305082f, 0.229573756f},
-std::array<float,2>{0.191041529f, 0.957048953f},
-std::array<float,2>{0.642079949f, 0.452479631f},
-std::array<float,2>{0.963236749f, 0.538174629f},
-std::array<float,2>{0.49189043f, 0.112498753f},
-std::array<float,2>{0.351739377f, 0.74740243f},
-std::array<float,2>{0.824126124f, 0.241803423f},
-std::array<float,2>{0.551149487f, 0.795640767f},
-std::array<float,2>{0.0810707435f, 0.30365625f},
-std::array<float,2>{0.0256667621f, 0.60876596f},
-std::array<float,2>{0.617157996f, 0.0118974652f},
-std::array<float,2>{0.769577682f, 0.882612169f},
-std::array<float,2>{0.306616783f, 0.433319807f},
-std::array<float,2>{0.426641434f, 0.868535221f},
-std::array<float,2>{0.924585283f, 0.349655539f},
-std::array<float,2>{0.698955476f, 0.645770431f},
-std::array<float,2>{0.133993357f, 0.136739522f},
-std::array<float,2>{0.100369141f, 0.779392898f},
-std::array<float,2>{0.528609335f, 0.250761777f},
-std::array<float,2>{0.868492782f, 0.695972681f},
-std::array<float,2>{0.327984393f, 0.193669692f},
-std::array<float,2>{0.443883181f, 0.529824734f},
-std::array<float,2>{0.998334825f, 0.0817889124f},
-std::array<float,2>{0.665917337f, 0.989331901f},
-std::array<float,2>{0.244701415f, 0.484097689f},
-std::array<float,2>{0.175277725f, 0.675333917f},
-std::array<float,2>{0.739253283f, 0.175998375f},
-std::array<float,2>{0.878048658f, 0.832927346f},
-std::array<float,2>{0.380341232f, 0.330515504f},
-std::array<float,2>{0.268861443f, 0.932200789f},
-std::array<float,2>{0.786634862f, 0.378857166f},
-std::array<float,2>{0.573041558f, 0.564923048f},
-std::array<float,2>{0.0573368967f, 0.0355109051f},
-std::array<float,2>{0.142879575f, 0.774142742f},
-std::array<float,2>{0.706303239f, 0.254335403f},
-std::array<float,2>{0.91869247f, 0.70043546f},
-std::array<float,2>{0.413189083f, 0.190635547f},
-std::array<float,2>{0.281708747f, 0.524613261f},
-std::array<float,2>{0.753363073f, 0.0855809227f},
-std::array<float,2>{0.595432997f, 0.985674679f},
-std::array<float,2>{0.00674303714f, 0.478776038f},
-std::array<float,2>{0.0714109987f, 0.676255226f},
-std::array<float,2>{0.534936368f, 0.174993053f},
-std::array<float,2>{0.837692976f, 0.82981056f},
-std::array<float,2>{0.366814852f, 0.333183378f},
-std::array<float,2>{0.468853086f, 0.936613321f},
-std::array<float,2>{0.943466961f, 0.379880965f},
-std::array<float,2>{0.626148701f, 0.569965661f},
-std::array<float,2>{0.215188429f, 0.0334890671f},
-std::array<float,2>{0.0386149287f, 0.954346716f},
-std::array<float,2>{0.586355031f, 0.44855687f},
-std::array<float,2>{0.811806679f, 0.532948971f},
-std::array<float,2>{0.250867069f, 0.114440061f},
-std::array<float,2>{0.402496129f, 0.745675802f},
-std::array<float,2>{0.896076143f, 0.237880036f},
-std::array<float,2>{0.726810753f, 0.79024297f},
-std::array<float,2>{0.165920988f, 0.29888019f},
-std::array<float,2>{0.226849332f, 0.602070689f},
-std::array<float,2>{0.68205303f, 0.0117013212f},
-std::array<float,2>{0.970769167f, 0.876204073f},
-std::array<float,2>{0.455074579f, 0.436705917f},
-std::array<float,2>{0.330496967f, 0.874919176f},
-std::array<float,2>{0.854643822f, 0.346572846f},
-std::array<float,2>{0.502319872f, 0.643827856f},
-std::array<float,2>{0.10946352f, 0.136711434f},
-std::array<float,2>{0.197842032f, 0.898274004f},
-std::array<float,2>{0.649333894f, 0.410762906f},
-std::array<float,2>{0.958835721f, 0.616071343f},
-std::array<float,2>{0.495673239f, 0.0215362832f},
-std::array<float,2>{0.344072402f, 0.633335412f},
-std::array<float,2>{0.813838482f, 0.143920869f},
-std::array<float,2>{0.56083554f, 0.857586503f},
-std::array<float,2>{0.089832291f, 0.363109767f},
-std::array<float,2>{0.0184929892f, 0.554860294f},
-std::array<float,2>{0.619701564f, 0.103192374f},
-std::array<float,2>{0.774284005f, 0.945889592f},
-std::array<float,2>{0.301698446f, 0.466779143f},
-std::array<float,2>{0.436312616f, 0.805037618f},
-std::array<float,2>{0.931007922f, 0.286958784f},
-std::array<float,2>{0.688400269f, 0.729201972f},
-std::array<float,2>{0.128467634f, 0.231149837f},
-std::array<float,2>{0.104766183f, 0.817852855f},
-std::array<float,2>{0.516841471f, 0.325004071f},
-std::array<float,2>{0.860936999f, 0.662598073f},
-std::array<float,2>{0.313081235f, 0.163089409f},
-std::array<float,2>{0.4470689f, 0.584228098f},
-std::array<float,2>{0.985589445f, 0.0590099767f},
-std::array<float,2>{0.658571422f, 0.908319294f},
-std::array<float,2>{0.236344874f, 0.399826974f},
-std::array<float,2>{0.186366767f, 0.70965147f},
-std::array<float,2>{0.743553817f, 0.211076051f},
-std::array<float,2>{0.886876285f, 0.757276177f},
-std::array<float,2>{0.385572225f, 0.273956418f},
-std::array<float,2>{0.278675944f, 0.9748981f},
-std::array<float,2>{0.79009515f, 0.499770582f},
-std::array<float,2>{0.5693205f, 0.502583981f},
-std::array<float,2>{0.0480838232f, 0.063936621f},
-std::array<float,2>{0.247960299f, 0.847673774f},
-std::array<float,2>{0.670316935f, 0.370685905f},
-std::array<float,2>{0.993087709f, 0.628352463f},
-std::array<float,2>{0.438196808f, 0.149165377f},
-std::array<float,2>{0.322805196f, 0.623963356f},
-std::array<float,2>{0.873179674f, 0.0307627767f},
-std::array<float,2>{0.524450719f, 0.898443222f},
-std::array<float,2>{0.0945236981f, 0.415213019f},
-std::array<float,2>{0.0614270531f, 0.726188004f},
-std::array<float,2>{0.574516177f, 0.21922034f},
-std::array<float,2>{0.784785569f, 0.801775575f},
-std::array<float,2>{0.272895038f, 0.296180576f},
-std::array<float,2>{0.376951128f, 0.940811634f},
-std::array<float,2>{0.879602909f, 0.456178904f},
-std::array<float,2>{0.737706244f, 0.549331307f},
-std::array<float,2>{0.178232521f, 0.0982116237f},
-std::array<float,2>{0.0838029161f, 0.919574618f},
-std::array<float,2>{0.5497334f, 0.392381102f},
-std::array<float,2>{0.825163364f, 0.588205218f},
-std::array<float,2>{0.357548326f, 0.0532547683f},
-std::array<float,2>{0.487570256f, 0.665445626f},
-std::array<float,2>{0.96723938f, 0.1658068f},
-std::array<float,2>{0.644573212f, 0.827201128f},
-std::array<float,2>{0.191678211f, 0.31671226f},
-std::array<float,2>{0.138308018f, 0.511589289f},
-std::array<float,2>{0.701123714f, 0.0758658797f},
-std::array<float,2>{0.927235484f, 0.983549654f},
-std::array<float,2>{0.423364133f, 0.486541569f},
-std::array<float,2>{0.311334431f, 0.759760618f},
-std::array<float,2>{0.768034399f, 0.270565659f},
-std::array<float,2>{0.610213816f, 0.715593994f},
-std::array<float,2>{0.0302117243f, 0.206060559f},
-std::array<float,2>{0.157255292f, 0.995581031f},
-std::array<float,2>{0.722623348f, 0.471774191f},
-std::array<float,2>{0.900322497f, 0.52128917f},
-std::array<float,2>{0.391679615f, 0.0923505127f},
-std::array<float,2>{0.261176437f, 0.69375211f},
-std::array<float,2>{0.802578688f, 0.199559689f},
-std::array<float,2>{0.58367908f, 0.768492639f},
-std::array<float,2>{0.0410059802f, 0.259782523f},
-std::array<float,2>{0.121375509f, 0.573784709f},
-std::array<float,2>{0.515288711f, 0.0420478396f},
-std::array<float,2>{0.846629858f, 0.924881458f},
-std::array<float,2>{0.336536616f, 0.385573596f},
-std::array<float,2>{0.461843699f, 0.841621399f},
-std::array<float,2>{0.981792569f, 0.338500619f},
-std::array<float,2>{0.673775017f, 0.684022069f},
-std::array<float,2>{0.226387501f, 0.181539297f},
-std::array<float,2>{0.0116330516f, 0.781379163f},
-std::array<float,2>{0.602703273f, 0.309572279f},
-std::array<float,2>{0.762646437f, 0.739575088f},
-std::array<float,2>{0.292738289f, 0.245442733f},
-std::array<float,2>{0.414539456f, 0.543713212f},
-std::array<float,2>{0.908241749f, 0.120833807f},
-std::array<float,2>{0.711258292f, 0.962713897f},
-std::array<float,2>{0.149054945f, 0.438400358f},
-std::array<float,2>{0.208624899f, 0.655525684f},
-std::array<float,2>{0.636678934f, 0.12646091f},
-std::array<float,2>{0.945642412f, 0.860359907f},
-std::array<float,2>{0.479646415f, 0.358808517f},
-std::array<float,2>{0.370874494f, 0.885763228f},
-std::array<float,2>{0.829895854f, 0.42266503f},
-std::array<float,2>{0.541452885f, 0.596651912f},
-std::array<float,2>{0.0656917766f, 0.00292903441f},
-std::array<float,2>{0.211510181f, 0.798703134f},
-std::array<float,2>{0.632600844f, 0.290572524f},
-std::array<float,2>{0.938547373f, 0.721292198f},
-std::array<float,2>{0.473320544f, 0.225069761f},
-std::array<float,2>{0.360208094f, 0.551003695f},
-std::array<float,2>{0.84311682f, 0.0975043625f},
-std::array<float,2>{0.535331607f, 0.944699466f},
-std::array<float,2>{0.0772105381f, 0.45756045f},
-std::array<float,2>{0.00380490255f, 0.629344821f},
-std::array<float,2>{0.599629819f, 0.152786702f},
-std::array<float,2>{0.755412877f, 0.847060382f},
-std::array<float,2>{0.288643271f, 0.372545093f},
-std::array<float,2>{0.406362355f, 0.902519286f},
-std::array<float,2>{0.917954266f, 0.421473593f},
-std::array<float,2>{0.710081875f, 0.61804229f},
-std::array<float,2>{0.14536868f, 0.025410153f},
-std::array<float,2>{0.114872746f, 0.977701366f},
-std::array<float,2>{0.506762147f, 0.488841921f},
-std::array<float,2>{0.859035969f, 0.511761904f},
-std::array<float,2>{0.335489094f, 0.0707343444f},
-std::array<float,2>{0.457450479f, 0.712369978f},
-std::array<float,2>{0.975997329f, 0.207661346f},
-std::array<float,2>{0.686707199f, 0.762777865f},
-std::array<float,2>{0.233261287f, 0.267762959f},
-std::array<float,2>{0.168269753f, 0.593061268f},
-std::array<float,2>{0.732342303f, 0.0500413887f},
-std::array<float,2>{0.894295752f, 0.917915761f},
-std::array<float,2>{0.398792833f, 0.398012668f},
-std::array<float,2>{0.257028639f, 0.823657095f},
-std::array<float,2>{0.805987835f, 0.312693447f},
-std::array<float,2>{0.592333317f, 0.669386983f},
-std::array<float,2>{0.0315765776f, 0.170380473f},
-std::array<float,2>{0.128949583f, 0.929361343f},
-std::array<float,2>{0.695250034f, 0.389518201f},
-std::array<float,2>{0.935489953f, 0.576382339f},
-std::array<float,2>{0.429755896f, 0.0445771255f},
-std::array<float,2>{0.297207505f, 0.679920673f},
-std::array<float,2>{0.777549326f, 0.185414672f},
-std::array<float,2>{0.62393719f, 0.837802589f},
-std::array<float,2>{0.0200095586f, 0.342859924f},
-std::array<float,2>{0.0907840282f, 0.516388476f},
-std::array<float,2>{0.556297839f, 0.0879398435f},
-std::array<float,2>{0.816891134f, 0.997792721f},
-std::array<float,2>{0.351526678f, 0.472818345f},
-std::array<float,2>{0.496900231f, 0.771821976f},
-std::array<float,2>{0.954232633f, 0.261936277f},
-std::array<float,2>{0.653929651f, 0.687744439f},
-std::array<float,2>{0.200208694f, 0.197260246f},
-std::array<float,2>{0.0523602292f, 0.864387393f},
-std::array<float,2>{0.564680517f, 0.35212183f},
-std::array<float,2>{0.793390095f, 0.649831474f},
-std::array<float,2>{0.276934326f, 0.13267757f},
-std::array<float,2>{0.388872117f, 0.598256767f},
-std::array<float,2>{0.884781957f, 0.00441084523f},
-std::array<float,2>{0.747871995f, 0.889894605f},
-std::array<float,2>{0.180117071f, 0.427849025f},
-std::array<float,2>{0.240904331f, 0.734415591f},
-std::array<float,2>{0.663451076f, 0.24732551f},
-std::array<float,2>{0.991454661f, 0.788247645f},
-std::array<float,2>{0.449738592f, 0.307897061f},
-std::array<float,2>{0.317248702f, 0.967674971f},
-std::array<float,2>{0.863652468f, 0.441953063f},
-std::array<float,2>{0.52240634f, 0.54102838f},
-std::array<float,2>{0.106883258f, 0.121281512f},
-std::array<float,2>{0.172024444f, 0.833621025f},
-std::array<float,2>{0.742039979f, 0.331700295f},
-std::array<float,2>{0.87550354f, 0.674205542f},
-std::array<float,2>{0.382342458f, 0.177405536f},
-std::array<float,2>{0.266416937f, 0.566203058f},
-std::array<float,2>{0.787253499f, 0.0363739058f},
-std::array<float,2>{0.571637034f, 0.933071375f},
-std::array<float,2>{0.0556349494f, 0.377704203f},
-std::array<float,2>{0.0991822481f, 0.696935236f},
-std::array<float,2>{0.529639721f, 0.195247263f},
-std::array<float,2>{0.870018661f, 0.780320466f},
-std::array<float,2>{0.326013386f, 0.251396596f},
-std::array<float,2>{0.442762852f, 0.988323569f},
-std::array<float,2>{0.996485114f, 0.483213454f},
-std::array<float,2>{0.667131305f, 0.530553818f},
-std::array<float,2>{0.242616564f, 0.0807704255f},
-std::array<float,2>{0.0240937658f, 0.881714106f},
-std::array<float,2>{0.614981949f, 0.431987405f},
-std::array<float,2>{0.77254802f, 0.607775569f},
-std::array<float,2>{0.30787605f, 0.013500643f},
-std::array<float,2>{0.428771138f, 0.644932866f},
-std::array<float,2>{0.922011971f, 0.138642997f},
-std::array<float,2>{0.695595503f, 0.868074179f},
-std::array<float,2>{0.135314822f, 0.351012111f},
-std::array<float,2>{0.187665105f, 0.5375247f},
-std::array<float,2>{0.643730938f, 0.111444935f},
-std::array<float,2>{0.961936653f, 0.958161354f},
-std::array<float,2>{0.48842752f, 0.451880515f},
-std::array<float,2>{0.355161399f, 0.796443522f},
-std::array<float,2>{0.821687877f, 0.304249614f},
-std::array<float,2>{0.553752959f, 0.746498287f},
-std::array<float,2>{0.0798252597f, 0.240799323f},
-std::array<float,2>{0.220913291f, 0.95293045f},
-std::array<float,2>{0.678151608f, 0.463005185f},
-std::array<float,2>{0.980128288f, 0.560571015f},
-std::array<float,2>{0.466088176f, 0.10606093f},
-std::array<float,2>{0.340960115f, 0.732485354f},
-std::array<float,2>{0.849815726f, 0.22880733f},
-std::array<float,2>{0.507915854f, 0.810588181f},
-std::array<float,2>{0.117277645f, 0.282613635f},
-std::array<float,2>{0.0438593701f, 0.610957384f},
-std::array<float,2>{0.581173301f, 0.0195137355f},
-std::array<float,2>{0.797509551f, 0.892964065f},
-std::array<float,2>{0.261794209f, 0.408493757f},
-std::array<float,2>{0.39726761f, 0.855259538f},
-std::array<float,2>{0.902950943f, 0.366099745f},
-std::array<float,2>{0.724632382f, 0.638576031f},
-std::array<float,2>{0.160954714f, 0.148395076f},
-std::array<float,2>{0.0698685348f, 0.750284135f},
-std::array<float,2>{0.54497844f, 0.278628498f},
-std::array<float,2>{0.832093716f, 0.7031914f},
-std::array<float,2>{0.372300267f, 0.216356874f},
-std::array<float,2>{0.480752766f, 0.507642925f},
-std::array<float,2>{0.951616108f, 0.0697826371f},
-std::array<float,2>{0.638869703f, 0.970061839f},
-std::array<float,2>{0.204898134f, 0.494853526f},
-std::array<float,2>{0.152814269f, 0.656746864f},
-std::array<float,2>{0.7162745f, 0.15842098f},
-std::array<float,2>{0.913416564f, 0.812609017f},
-std::array<float,2>{0.419692814f, 0.320504159f},
-std::array<float,2>{0.293151677f, 0.911299944f},
-std::array<float,2>{0.757986486f, 0.405078471f},
-std::array<float,2>{0.605682969f, 0.57896328f},
-std::array<float,2>{0.0127243549f, 0.0564050712f},
-std::array<float,2>{0.166705459f, 0.792001843f},
-std::array<float,2>{0.730078101f, 0.298815519f},
-std::array<float,2>{0.89802736f, 0.743572533f},
-std::array<float,2>{0.405813217f, 0.234713197f},
-std::array<float,2>{0.253068507f, 0.534306586f},
-std::array<float,2>{0.809144974f, 0.115308836f},
-std::array<float,2>{0.589598835f, 0.956658661f},
-std::array<float,2>{0.0355988182f, 0.446652949f},
-std::array<float,2>{0.112786792f, 0.640931964f},
-std::array<float,2>{0.501363456f, 0.133983776f},
-std::array<float,2>{0.853384495f, 0.871863544f},
-std::array<float,2>{0.329465777f, 0.34545368f},
-std::array<float,2>{0.455148548f, 0.877478659f},
-std::array<float,2>{0.969808042f, 0.434660345f},
-std::array<float,2>{0.679752171f, 0.605354428f},
-std::array<float,2>{0.229978919f, 0.00865232758f},
-std::array<float,2>{0.00406989641f, 0.98786515f},
-std::array<float,2>{0.596271813f, 0.477503747f},
-std::array<float,2>{0.750295758f, 0.526935041f},
-std::array<float,2>{0.284960032f, 0.0837708563f},
-std::array<float,2>{0.410929859f, 0.701319635f},
-std::array<float,2>{0.920993626f, 0.187634557f},
-std::array<float,2>{0.704930365f, 0.777112722f},
-std::array<float,2>{0.142033085f, 0.256168962f},
-std::array<float,2>{0.216845259f, 0.567566991f},
-std::array<float,2>{0.627400637f, 0.0322648175f},
-std::array<float,2>{0.941629052f, 0.933736265f},
-std::array<float,2>{0.472460389f, 0.380884647f},
-std::array<float,2>{0.363915205f, 0.830323577f},
-std::array<float,2>{0.839394033f, 0.334923804f},
-std::array<float,2>{0.532059491f, 0.679530144f},
-std::array<float,2>{0.07236889f, 0.172320962f},
-std::array<float,2>{0.235270977f, 0.907745123f},
-std::array<float,2>{0.657316089f, 0.40092954f},
-std::array<float,2>{0.986897409f, 0.583037794f},
-std::array<float,2>{0.448367447f, 0.0624470785f},
-std::array<float,2>{0.315563917f, 0.661679387f},
-std::array<float,2>{0.861850739f, 0.161904722f},
-std::array<float,2>{0.518023431f, 0.820233405f},
-std::array<float,2>{0.102094859f, 0.326771587f},
-std::array<float,2>{0.0502901115f, 0.500037372f},
-std::array<float,2>{0.567474127f, 0.0663034543f},
-std::array<float,2>{0.791996062f, 0.973022401f},
-std::array<float,2>{0.279617429f, 0.497582167f},
-std::array<float,2>{0.384192258f, 0.754942f},
-std::array<float,2>{0.888967395f, 0.276979923f},
-std::array<float,2>{0.74537456f, 0.708265185f},
-std::array<float,2>{0.18419008f, 0.213762879f},
-std::array<float,2>{0.0870536715f, 0.855613053f},
-std::array<float,2>{0.560161889f, 0.360159576f},
-std::array<float,2>{0.815590918f, 0.636325061f},
-std::array<float,2>{0.347411633f, 0.141502947f},
-std::array<float,2>{0.492967576f, 0.615095258f},
-std::array<float,2>{0.959151089f, 0.0206622612f},
-std::array<float,2>{0.651564121f, 0.895955682f},
-std::array<float,2>{0.196655557f, 0.412234664f},
-std::array<float,2>{0.126520559f, 0.726616979f},
-std::array<float,2>{0.691262901f, 0.232822344f},
-std::array<float,2>{0.932969809f, 0.808166146f},
-std::array<float,2>{0.435249269f, 0.288117141f},
-std::array<float,2>{0.304488719f, 0.948768377f},
-std::array<float,2>{0.775880575f, 0.467322558f},
-std::array<float,2>{0.618621111f, 0.556886494f},
-std::array<float,2>{0.0159957632f, 0.103680789f},
-std::array<float,2>{0.194086686f, 0.824955285f},
-std::array<float,2>{0.647182822f, 0.319223523f},
-std::array<float,2>{0.965193808f, 0.666142702f},
-std::array<float,2>{0.485868305f, 0.166845292f},
-std::array<float,2>{0.355780661f, 0.585950732f},
-std::array<float,2>{0.826376975f, 0.0527170226f},
-std::array<float,2>{0.54826498f, 0.920429409f},
-std::array<float,2>{0.0858821049f, 0.394169271f},
-std::array<float,2>{0.0285958126f, 0.718323946f},
-std::array<float,2>{0.61244756f, 0.20420146f},
-std::array<float,2>{0.766310334f, 0.76007694f},
-std::array<float,2>{0.309072018f, 0.272284001f},
-std::array<float,2>{0.424686581f, 0.981659889f},
-std::array<float,2>{0.928853273f, 0.485333264f},
-std::array<float,2>{0.70205617f, 0.508437872f},
-std::array<float,2>{0.140329733f, 0.0766308978f},
-std::array<float,2>{0.097249195f, 0.901644826f},
-std::array<float,2>{0.527107477f, 0.417159021f},
-std::array<float,2>{0.871835053f, 0.621474922f},
-std::array<float,2>{0.321605593f, 0.0285435636f},
-std::array<float,2>{0.43997246f, 0.625964165f},
-std::array<float,2>{0.995027602f, 0.150635466f},
-std::array<float,2>{0.669698417f, 0.850932002f},
-std::array<float,2>{0.248568416f, 0.368167043f},
-std::array<float,2>{0.177420303f, 0.547242045f},
-std::array<float,2>{0.735695183f, 0.100821018f},
-std::array<float,2>{0.881247759f, 0.938770354f},
-std::array<float,2>{0.377900004f, 0.454512f},
-std::array<float,2>{0.269743532f, 0.803693175f},
-std::array<float,2>{0.783080637f, 0.294356018f},
-std::array<float,2>{0.577936947f, 0.724060357f},
-std::array<float,2>{0.0604572929f, 0.221090496f},
-std::array<float,2>{0.151294649f, 0.964601099f},
-std::array<float,2>{0.714661658f, 0.440359712f},
-std::array<float,2>{0.90709281f, 0.546732187f},
-std::array<float,2>{0.416583508f, 0.11828173f},
-std::array<float,2>{0.290930212f, 0.740590632f},
-std::array<float,2>{0.76480633f, 0.243959099f},
-std::array<float,2>{0.603587091f, 0.783999324f},
-std::array<float,2>{0.00808681175f, 0.312382787f},
-std::array<float,2>{0.0633979291f, 0.59548223f},
-std::array<float,2>{0.539464533f, 0.00138120377f},
-std::array<float,2>{0.831011355f, 0.883583486f},
-std::array<float,2>{0.367272109f, 0.424782634f},
-std::array<float,2>{0.476899415f, 0.862073839f},
-std::array<float,2>{0.94820708f, 0.355533302f},
-std::array<float,2>{0.632968962f, 0.652783155f},
-std::array<float,2>{0.209303766f, 0.127095833f},
-std::array<float,2>{0.0415800735f, 0.767226875f},
-std::array<float,2>{0.584995389f, 0.258040011f},
-std::array<float,2>{0.804380298f, 0.693168104f},
-std::array<float,2>{0.259752214f, 0.202175736f},
-std::array<float,2>{0.392623961f, 0.523075461f},
-std::array<float,2>{0.901540637f, 0.0917284414f},
-std::array<float,2>{0.720666051f, 0.992967963f},
-std::array<float,2>{0.159056067f, 0.469610929f},
-std::array<float,2>{0.223547727f, 0.68654573f},
-std::array<float,2>{0.675368071f, 0.182001874f},
-std::array<float,2>{0.983844995f, 0.843095303f},
-std::array<float,2>{0.464020699f, 0.336699426f},
-std::array<float,2>{0.338516951f, 0.922532618f},
-std::array<float,2>{0.84413451f, 0.383915156f},
-std::array<float,2>{0.512147248f, 0.5703215f},
-std::array<float,2>{0.124224722f, 0.0396679826f},
-std::array<float,2>{0.231211811f, 0.764646888f},
-std::array<float,2>{0.68484956f, 0.267434686f},
-std::array<float,2>{0.974267423f, 0.713574648f},
-std::array<float,2>{0.460240334f, 0.209963068f},
-std::array<float,2>{0.333305597f, 0.513844669f},
-std::array<float,2>{0.856033504f, 0.0728787556f},
-std::array<float,2>{0.504018605f, 0.97911948f},
-std::array<float,2>{0.117019743f, 0.491773546f},
-std::array<float,2>{0.03355496f, 0.671230972f},
-std::array<float,2>{0.590245187f, 0.169262379f},
-std::array<float,2>{0.806661248f, 0.821508586f},
-std::array<float,2>{0.254390508f, 0.316262424f},
-std::array<float,2>{0.402302712f, 0.915457249f},
-std::array<float,2>{0.891738534f, 0.394552439f},
-std::array<float,2>{0.733113348f, 0.591088235f},
-std::array<float,2>{0.170030504f, 0.0480149835f},
-std::array<float,2>{0.0743263438f, 0.941915393f},
-std::array<float,2>{0.538780034f, 0.459891886f},
-std::array<float,2>{0.840769887f, 0.553652823f},
-std::array<float,2>{0.362726927f, 0.0956315175f},
-std::array<float,2>{0.476556867f, 0.720061302f},
-std::array<float,2>{0.939528048f, 0.223941594f},
-std::array<float,2>{0.630110085f, 0.80038774f},
-std::array<float,2>{0.21339561f, 0.29224503f},
-std::array<float,2>{0.147310376f, 0.619623721f},
-std::array<float,2>{0.708682835f, 0.0235482752f},
-std::array<float,2>{0.915723324f, 0.904530883f},
-std::array<float,2>{0.409928232f, 0.418256879f},
-std::array<float,2>{0.285396755f, 0.845605671f},
-std::array<float,2>{0.75670588f, 0.373872161f},
-std::array<float,2>{0.598037481f, 0.630863845f},
-std::array<float,2>{0.00142067403f, 0.154838979f},
-std::array<float,2>{0.18342182f, 0.88692826f},
-std::array<float,2>{0.748063207f, 0.426627398f},
-std::array<float,2>{0.884163558f, 0.601004899f},
-std::array<float,2>{0.388125598f, 0.00715050241f},
-std::array<float,2>{0.273959756f, 0.650580406f},
-std::array<float,2>{0.795704603f, 0.129525483f},
-std::array<float,2>{0.562751055f, 0.865324974f},
-std::array<float,2>{0.053131897f, 0.354202598f},
-std::array<float,2>{0.108091302f, 0.539951861f},
-std::array<float,2>{0.521273553f, 0.12346869f},
-std::array<float,2>{0.865466833f, 0.965649307f},
-std::array<float,2>{0.31870079f, 0.444724321f},
-std::array<float,2>{0.452653766f, 0.78593868f},
-std::array<float,2>{0.989774764f, 0.306104779f},
-std::array<float,2>{0.660932422f, 0.738111079f},
-std::array<float,2>{0.238648236f, 0.248475373f},
-std::array<float,2>{0.0226629432f, 0.838531196f},
-std::array<float,2>{0.622218966f, 0.340957701f},
-std::array<float,2>{0.780604124f, 0.682287395f},
-std::array<float,2>{0.299052477f, 0.18590349f},
-std::array<float,2>{0.432042837f, 0.574465454f},
-std::array<float,2>{0.9372347f, 0.0467229187f},
-std::array<float,2>{0.69295615f, 0.926367104f},
-std::array<float,2>{0.131174698f, 0.38819322f},
-std::array<float,2>{0.202387005f, 0.690452218f},
-std::array<float,2>{0.655303359f, 0.197917908f},
-std::array<float,2>{0.955759346f, 0.770737886f},
-std::array<float,2>{0.499151021f, 0.264120132f},
-std::array<float,2>{0.349055171f, 0.998231888f},
-std::array<float,2>{0.818491042f, 0.475489199f},
-std::array<float,2>{0.557521999f, 0.518027544f},
-std::array<float,2>{0.0934681669f, 0.0869925618f},
-std::array<float,2>{0.133262306f, 0.87067616f},
-std::array<float,2>{0.697362661f, 0.348071784f},
-std::array<float,2>{0.92545712f, 0.646889985f},
-std::array<float,2>{0.4268924f, 0.139761299f},
-std::array<float,2>{0.304934472f, 0.60641098f},
-std::array<float,2>{0.770925224f, 0.0152411349f},
-std::array<float,2>{0.616102219f, 0.880742311f},
-std::array<float,2>{0.0270738546f, 0.431017339f},
-std::array<float,2>{0.0810465887f, 0.749204636f},
-std::array<float,2>{0.55178839f, 0.238586053f},
-std::array<float,2>{0.822540998f, 0.794045627f},
-std::array<float,2>{0.353001744f, 0.300945044f},
-std::array<float,2>{0.490722388f, 0.960784793f},
-std::array<float,2>{0.964183629f, 0.450805098f},
-std::array<float,2>{0.641367018f, 0.536966562f},
-std::array<float,2>{0.189698175f, 0.109546073f},
-std::array<float,2>{0.058265347f, 0.931008041f},
-std::array<float,2>{0.574027419f, 0.375127345f},
-std::array<float,2>{0.785178304f, 0.56334883f},
-std::array<float,2>{0.267882168f, 0.0372466221f},
-std::array<float,2>{0.379133165f, 0.673032463f},
-std::array<float,2>{0.877220869f, 0.179052576f},
-std::array<float,2>{0.740015447f, 0.8347193f},
-std::array<float,2>{0.174369961f, 0.328497052f},
-std::array<float,2>{0.245223209f, 0.528552234f},
-std::array<float,2>{0.664114714f, 0.0793234929f},
-std::array<float,2>{0.999759197f, 0.990781546f},
-std::array<float,2>{0.444577157f, 0.481715769f},
-std::array<float,2>{0.326809973f, 0.77860409f},
-std::array<float,2>{0.868027508f, 0.252995253f},
-std::array<float,2>{0.527714312f, 0.699115634f},
-std::array<float,2>{0.101238295f, 0.193289325f},
-std::array<float,2>{0.2065662f, 0.971032381f},
-std::array<float,2>{0.637949347f, 0.492612869f},
-std::array<float,2>{0.950040936f, 0.504283071f},
-std::array<float,2>{0.482595325f, 0.0672850534f},
-std::array<float,2>{0.373805881f, 0.706747472f},
-std::array<float,2>{0.835838914f, 0.218325362f},
-std::array<float,2>{0.544248402f, 0.753836334f},
-std::array<float,2>{0.0679537207f, 0.279634088f},
-std::array<float,2>{0.0155407721f, 0.581777215f},
-std::array<float,2>{0.607459486f, 0.058565639f},
-std::array<float,2>{0.761695862f, 0.913248003f},
-std::array<float,2>{0.296301335f, 0.403608292f},
-std::array<float,2>{0.420768023f, 0.816320717f},
-std::array<float,2>{0.910810292f, 0.323732764f},
-std::array<float,2>{0.718141556f, 0.659264922f},
-std::array<float,2>{0.155278116f, 0.157706171f},
-std::array<float,2>{0.121068537f, 0.808849514f},
-std::array<float,2>{0.511596978f, 0.283465117f},
-std::array<float,2>{0.849054635f, 0.730634868f},
-std::array<float,2>{0.342713624f, 0.226866782f},
-std::array<float,2>{0.468096763f, 0.559638917f},
-std::array<float,2>{0.977159917f, 0.108090557f},
-std::array<float,2>{0.677464068f, 0.949246228f},
-std::array<float,2>{0.219893634f, 0.461481839f},
-std::array<float,2>{0.163674757f, 0.63952148f},
-std::array<float,2>{0.723374486f, 0.145222411f},
-std::array<float,2>{0.904620171f, 0.852624714f},
-std::array<float,2>{0.394540817f, 0.364030421f},
-std::array<float,2>{0.264415681f, 0.890753388f},
-std::array<float,2>{0.800225317f, 0.407681793f},
-std::array<float,2>{0.57871139f, 0.613097131f},
-std::array<float,2>{0.0466832556f, 0.0170080569f},
-std::array<float,2>{0.145097762f, 0.799070418f},
-std::array<float,2>{0.710253179f, 0.291246414f},
-std::array<float,2>{0.917582631f, 0.719472051f},
-std::array<float,2>{0.406566381f, 0.222954169f},
-std::array<float,2>{0.288823754f, 0.554652929f},
-std::array<float,2>{0.755650342f, 0.0942283496f},
-std::array<float,2>{0.599915266f, 0.9425475f},
-std::array<float,2>{0.00356274773f, 0.459966302f},
-std::array<float,2>{0.077627711f, 0.631939888f},
-std::array<float,2>{0.535635114f, 0.15581283f},
-std::array<float,2>{0.842847168f, 0.843813241f},
-std::array<float,2>{0.359980226f, 0.374628335f},
-std::array<float,2>{0.473627329f, 0.90619719f},
-std::array<float,2>{0.938930511f, 0.41946435f},
-std::array<float,2>{0.632437646f, 0.621044576f},
-std::array<float,2>{0.211900175f, 0.0246762633f},
-std::array<float,2>{0.0312664919f, 0.980196059f},
-std::array<float,2>{0.592534006f, 0.490490645f},
-std::array<float,2>{0.805735707f, 0.514804423f},
-std::array<float,2>{0.257218599f, 0.0735262558f},
-std::array<float,2>{0.398641944f, 0.714721739f},
-std::array<float,2>{0.89406687f, 0.209153056f},
-std::array<float,2>{0.732105851f, 0.765146077f},
-std::array<float,2>{0.167999387f, 0.265633672f},
-std::array<float,2>{0.23291336f, 0.589970767f},
-std::array<float,2>{0.686865389f, 0.0473301448f},
-std::array<float,2>{0.975751758f, 0.914732337f},
-std::array<float,2>{0.457113504f, 0.395857841f},
-std::array<float,2>{0.335931629f, 0.821232975f},
-std::array<float,2>{0.859150231f, 0.315425962f},
-std::array<float,2>{0.506506324f, 0.67037648f},
-std::array<float,2>{0.115215175f, 0.16846028f},
-std::array<float,2>{0.200484067f, 0.927061558f},
-std::array<float,2>{0.654190958f, 0.387621045f},
-std::array<float,2>{0.954378247f, 0.575762212f},
-std::array<float,2>{0.496704131f, 0.0457567535f},
-std::array<float,2>{0.351274043f, 0.68268311f},
-std::array<float,2>{0.816486895f, 0.187435299f},
-std::array<float,2>{0.556609094f, 0.839221656f},
-std::array<float,2>{0.0905132219f, 0.340472579f},
-std::array<float,2>{0.0195979085f, 0.519098222f},
-std::array<float,2>{0.623620749f, 0.0867108554f},
-std::array<float,2>{0.777692318f, 0.999082029f},
-std::array<float,2>{0.296970546f, 0.475827992f},
-std::array<float,2>{0.429967254f, 0.76978749f},
-std::array<float,2>{0.935156882f, 0.265523672f},
-std::array<float,2>{0.694965303f, 0.689856768f},
-std::array<float,2>{0.12933062f, 0.198648781f},
-std::array<float,2>{0.106581524f, 0.867116868f},
-std::array<float,2>{0.522048175f, 0.354644448f},
-std::array<float,2>{0.863347828f, 0.652215898f},
-std::array<float,2>{0.316930681f, 0.129931495f},
-std::array<float,2>{0.4499515f, 0.600392044f},
-std::array<float,2>{0.991653681f, 0.00635347376f},
-std::array<float,2>{0.663200676f, 0.888527095f},
-std::array<float,2>{0.241210222f, 0.426992148f},
-std::array<float,2>{0.179724917f, 0.73698622f},
-std::array<float,2>{0.747796297f, 0.249306962f},
-std::array<float,2>{0.885090709f, 0.786995769f},
-std::array<float,2>{0.389023811f, 0.304955214f},
-std::array<float,2>{0.27723369f, 0.966535151f},
-std::array<float,2>{0.793168068f, 0.443998307f},
-std::array<float,2>{0.564938366f, 0.54092586f},
-std::array<float,2>{0.0526962802f, 0.124294586f},
-std::array<float,2>{0.242194518f, 0.835621953f},
-std::array<float,2>{0.667250693f, 0.329133421f},
-std::array<float,2>{0.996281385f, 0.672206879f},
-std::array<float,2>{0.442613602f, 0.178053647f},
-std::array<float,2>{0.325721294f, 0.563919604f},
-std::array<float,2>{0.86986798f, 0.0381220952f},
-std::array<float,2>{0.529318571f, 0.930529475f},
-std::array<float,2>{0.0994247496f, 0.376799256f},
-std::array<float,2>{0.0552052371f, 0.697766185f},
-std::array<float,2>{0.571320057f, 0.191526577f},
-std::array<float,2>{0.78737849f, 0.777893007f},
-std::array<float,2>{0.266291529f, 0.252753347f},
-std::array<float,2>{0.382811666f, 0.991852522f},
-std::array<float,2>{0.875892401f, 0.480920762f},
-std::array<float,2>{0.74192977f, 0.527437747f},
-std::array<float,2>{0.172137722f, 0.0784430355f},
-std::array<float,2>{0.0798794329f, 0.879551053f},
-std::array<float,2>{0.554146409f, 0.429954767f},
-std::array<float,2>{0.821382761f, 0.607401669f},
-std::array<float,2>{0.355406135f, 0.0142765855f},
-std::array<float,2>{0.48875168f, 0.648255944f},
-std::array<float,2>{0.962212622f, 0.139214814f},
-std::array<float,2>{0.644023597f, 0.869784474f},
-std::array<float,2>{0.187892586f, 0.34937951f},
-std::array<float,2>{0.135606483f, 0.536042988f},
-std::array<float,2>{0.695552826f, 0.111012548f},
-std::array<float,2>{0.922286153f, 0.959680915f},
-std::array<float,2>{0.429063857f, 0.450138509f},
-std::array<float,2>{0.307652175f, 0.793168128f},
-std::array<float,2>{0.772941232f, 0.302390903f},
-std::array<float,2>{0.615066648f, 0.748544455f},
-std::array<float,2>{0.0241798852f, 0.239661723f},
-std::array<float,2>{0.160658658f, 0.950746f},
-std::array<float,2>{0.725060642f, 0.46255061f},
-std::array<float,2>{0.903286815f, 0.559414625f},
-std::array<float,2>{0.397104204f, 0.108541243f},
-std::array<float,2>{0.262120038f, 0.731933773f},
-std::array<float,2>{0.797703803f, 0.228405952f},
-std::array<float,2>{0.581336796f, 0.81000638f},
-std::array<float,2>{0.0436421297f, 0.284488499f},
-std::array<float,2>{0.117537461f, 0.611612499f},
-std::array<float,2>{0.508193791f, 0.0161778964f},
-std::array<float,2>{0.849995196f, 0.892281771f},
-std::array<float,2>{0.341067582f, 0.407044798f},
-std::array<float,2>{0.46600756f, 0.851634026f},
-std::array<float,2>{0.980380356f, 0.365045488f},
-std::array<float,2>{0.677876055f, 0.640343606f},
-std::array<float,2>{0.221181676f, 0.14580825f},
-std::array<float,2>{0.0130958417f, 0.75252372f},
-std::array<float,2>{0.605887651f, 0.281125039f},
-std::array<float,2>{0.758277297f, 0.705226481f},
-std::array<float,2>{0.293275356f, 0.217315719f},
-std::array<float,2>{0.419532061f, 0.505835891f},
-std::array<float,2>{0.913103342f, 0.0676323324f},
-std::array<float,2>{0.715942204f, 0.971808493f},
-std::array<float,2>{0.152431011f, 0.493337929f},
-std::array<float,2>{0.204786211f, 0.659129202f},
-std::array<float,2>{0.639026403f, 0.156513497f},
-std::array<float,2>{0.951188624f, 0.815064073f},
-std::array<float,2>{0.480613023f, 0.32275933f},
-std::array<float,2>{0.37243551f, 0.912366986f},
-std::array<float,2>{0.832470417f, 0.402506053f},
-std::array<float,2>{0.54521054f, 0.580881953f},
-std::array<float,2>{0.0702160299f, 0.0567561351f},
-std::array<float,2>{0.214994878f, 0.775401056f},
-std::array<float,2>{0.626373589f, 0.257234961f},
-std::array<float,2>{0.943843126f, 0.702596962f},
-std::array<float,2>{0.469097406f, 0.188766316f},
-std::array<float,2>{0.367047131f, 0.525809586f},
-std::array<float,2>{0.837473273f, 0.0829033777f},
-std::array<float,2>{0.534864962f, 0.98716861f},
-std::array<float,2>{0.0715892762f, 0.47821632f},
-std::array<float,2>{0.00640083058f, 0.678059518f},
-std::array<float,2>{0.595591307f, 0.173130184f},
-std::array<float,2>{0.75299269f, 0.831900954f},
-std::array<float,2>{0.281490952f, 0.335584432f},
-std::array<float,2>{0.413344324f, 0.935399175f},
-std::array<float,2>{0.918792427f, 0.382236123f},
-std::array<float,2>{0.706288576f, 0.566929936f},
-std::array<float,2>{0.142719179f, 0.0317531452f},
-std::array<float,2>{0.109778054f, 0.955877483f},
-std::array<float,2>{0.502018392f, 0.446285933f},
-std::array<float,2>{0.854899883f, 0.534045815f},
-std::array<float,2>{0.330280632f, 0.117006242f},
-std::array<float,2>{0.454802662f, 0.742955029f},
-std::array<float,2>{0.971042991f, 0.236316934f},
-std::array<float,2>{0.681859374f, 0.791950583f},
-std::array<float,2>{0.226694182f, 0.297638804f},
-std::array<float,2>{0.165577978f, 0.603758812f},
-std::array<float,2>{0.726640999f, 0.00893610064f},
-std::array<float,2>{0.896395087f, 0.878533304f},
-std::array<float,2>{0.402608663f, 0.433730423f},
-std::array<float,2>{0.250730902f, 0.872513711f},
-std::array<float,2>{0.811617315f, 0.343791187f},
-std::array<float,2>{0.586015642f, 0.642080367f},
-std::array<float,2>{0.0390338525f, 0.133562148f},
-std::array<float,2>{0.128719032f, 0.895441055f},
-std::array<float,2>{0.68811357f, 0.413385034f},
-std::array<float,2>{0.93067354f, 0.614060938f},
-std::array<float,2>{0.436181515f, 0.0200831201f},
-std::array<float,2>{0.301290482f, 0.63483721f},
-std::array<float,2>{0.773941875f, 0.14226304f},
-std::array<float,2>{0.620007336f, 0.857040048f},
-std::array<float,2>{0.0180907343f, 0.361258566f},
-std::array<float,2>{0.0895147547f, 0.558249354f},
-std::array<float,2>{0.560554981f, 0.105067313f},
-std::array<float,2>{0.813522458f, 0.947537601f},
-std::array<float,2>{0.3438811f, 0.468414873f},
-std::array<float,2>{0.49594003f, 0.807577848f},
-std::array<float,2>{0.958516002f, 0.287138969f},
-std::array<float,2>{0.649125099f, 0.727933526f},
-std::array<float,2>{0.198235631f, 0.233694971f},
-std::array<float,2>{0.0482697412f, 0.819245517f},
-std::array<float,2>{0.568948686f, 0.328106374f},
-std::array<float,2>{0.790520012f, 0.66083312f},
-std::array<float,2>{0.278461337f, 0.161058217f},
-std::array<float,2>{0.385400414f, 0.582740009f},
-std::array<float,2>{0.886997104f, 0.0614196882f},
-std::array<float,2>{0.743239343f, 0.906618357f},
-std::array<float,2>{0.186090499f, 0.402252108f},
-std::array<float,2>{0.236767069f, 0.70781064f},
-std::array<float,2>{0.658207476f, 0.214686781f},
-std::array<float,2>{0.985612392f, 0.754030466f},
-std::array<float,2>{0.447004408f, 0.275714129f},
-std::array<float,2>{0.313475132f, 0.973996699f},
-std::array<float,2>{0.861191213f, 0.49648118f},
-std::array<float,2>{0.517067611f, 0.501593053f},
-std::array<float,2>{0.104717173f, 0.0652943924f},
-std::array<float,2>{0.178684011f, 0.849972248f},
-std::array<float,2>{0.737383544f, 0.367282003f},
-std::array<float,2>{0.879650831f, 0.626348376f},
-std::array<float,2>{0.376501769f, 0.15153046f},
-std::array<float,2>{0.272674352f, 0.622092605f},
-std::array<float,2>{0.785143077f, 0.0280871335f},
-std::array<float,2>{0.57433182f, 0.900649309f},
-std::array<float,2>{0.0610527284f, 0.416819841f},
-std::array<float,2>{0.0944282189f, 0.723269105f},
-std::array<float,2>{0.524805188f, 0.221814662f},
-std::array<float,2>{0.873527765f, 0.804470181f},
-std::array<float,2>{0.323214918f, 0.293701202f},
-std::array<float,2>{0.43846193f, 0.938306093f},
-std::array<float,2>{0.99283731f, 0.453995794f},
-std::array<float,2>{0.669988334f, 0.547875464f},
-std::array<float,2>{0.247678012f, 0.100427762f},
-std::array<float,2>{0.029946167f, 0.921221673f},
-std::array<float,2>{0.610044539f, 0.392640322f},
-std::array<float,2>{0.76767087f, 0.586931467f},
-std::array<float,2>{0.311206162f, 0.0510339737f},
-std::array<float,2>{0.423793852f, 0.667283714f},
-std::array<float,2>{0.926874816f, 0.167080343f},
-std::array<float,2>{0.700838327f, 0.825818598f},
-std::array<float,2>{0.138661459f, 0.319366097f},
-std::array<float,2>{0.191539854f, 0.508860409f},
-std::array<float,2>{0.644796252f, 0.0774814263f},
-std::array<float,2>{0.966880143f, 0.980768681f},
-std::array<float,2>{0.487425059f, 0.486262113f},
-std::array<float,2>{0.357855409f, 0.76119113f},
-std::array<float,2>{0.824775517f, 0.272563905f},
-std::array<float,2>{0.549349606f, 0.71715486f},
-std::array<float,2>{0.083565779f, 0.203538418f},
-std::array<float,2>{0.226086468f, 0.994129598f},
-std::array<float,2>{0.673469722f, 0.470231771f},
-std::array<float,2>{0.981645703f, 0.521537125f},
-std::array<float,2>{0.461526245f, 0.0902193189f},
-std::array<float,2>{0.336836934f, 0.691571236f},
-std::array<float,2>{0.846411824f, 0.201278463f},
-std::array<float,2>{0.515386522f, 0.765877485f},
-std::array<float,2>{0.121183224f, 0.2594603f},
-std::array<float,2>{0.0405882671f, 0.571402729f},
-std::array<float,2>{0.583802938f, 0.0407890268f},
-std::array<float,2>{0.802313149f, 0.923477292f},
-std::array<float,2>{0.260757238f, 0.382969737f},
-std::array<float,2>{0.392029345f, 0.842046499f},
-std::array<float,2>{0.900132656f, 0.337793738f},
-std::array<float,2>{0.72223115f, 0.685936332f},
-std::array<float,2>{0.157625243f, 0.183132082f},
-std::array<float,2>{0.0656057671f, 0.784394443f},
-std::array<float,2>{0.541248739f, 0.311104238f},
-std::array<float,2>{0.829776108f, 0.741282344f},
-std::array<float,2>{0.370680302f, 0.243066296f},
-std::array<float,2>{0.479860395f, 0.54522717f},
-std::array<float,2>{0.945486009f, 0.117247477f},
-std::array<float,2>{0.636435211f, 0.963719189f},
-std::array<float,2>{0.208974063f, 0.440560192f},
-std::array<float,2>{0.149410054f, 0.653400481f},
-std::array<float,2>{0.710974336f, 0.128666595f},
-std::array<float,2>{0.908634365f, 0.863060594f},
-std::array<float,2>{0.414253891f, 0.356691927f},
-std::array<float,2>{0.292649686f, 0.884630978f},
-std::array<float,2>{0.762310684f, 0.425632268f},
-std::array<float,2>{0.603023887f, 0.593837023f},
-std::array<float,2>{0.0114059094f, 0.000680878409f},
-std::array<float,2>{0.170220181f, 0.762002409f},
-std::array<float,2>{0.733364224f, 0.268979013f},
-std::array<float,2>{0.891945422f, 0.711430848f},
-std::array<float,2>{0.402020276f, 0.208054721f},
-std::array<float,2>{0.254060298f, 0.513391137f},
-std::array<float,2>{0.80696857f, 0.0713851899f},
-std::array<float,2>{0.589943051f, 0.976892173f},
-std::array<float,2>{0.0333102569f, 0.490124732f},
-std::array<float,2>{0.116778992f, 0.6684829f},
-std::array<float,2>{0.504306257f, 0.171604887f},
-std::array<float,2>{0.85622704f, 0.823205709f},
-std::array<float,2>{0.333018512f, 0.313505352f},
-std::array<float,2>{0.460181683f, 0.916226208f},
-std::array<float,2>{0.974443018f, 0.396854192f},
-std::array<float,2>{0.684666991f, 0.592431962f},
-std::array<float,2>{0.231156319f, 0.0492284149f},
-std::array<float,2>{0.00111400033f, 0.944162488f},
-std::array<float,2>{0.59769547f, 0.458458185f},
-std::array<float,2>{0.756468773f, 0.551979184f},
-std::array<float,2>{0.285588652f, 0.096238777f},
-std::array<float,2>{0.409909666f, 0.722193539f},
-std::array<float,2>{0.915942311f, 0.226553947f},
-std::array<float,2>{0.708864093f, 0.797715962f},
-std::array<float,2>{0.147026271f, 0.289425761f},
-std::array<float,2>{0.213774413f, 0.618780196f},
-std::array<float,2>{0.630187273f, 0.0267189965f},
-std::array<float,2>{0.939797223f, 0.904209554f},
-std::array<float,2>{0.476075679f, 0.420559973f},
-std::array<float,2>{0.362514943f, 0.845759571f},
-std::array<float,2>{0.840359807f, 0.371729851f},
-std::array<float,2>{0.538833082f, 0.629918098f},
-std::array<float,2>{0.0746947303f, 0.153592631f},
-std::array<float,2>{0.238515377f, 0.889549732f},
-std::array<float,2>{0.66086936f, 0.429338902f},
-std::array<float,2>{0.990135849f, 0.598956525f},
-std::array<float,2>{0.453048259f, 0.00545382407f},
-std::array<float,2>{0.318567187f, 0.648901403f},
-std::array<float,2>{0.865672886f, 0.131795004f},
-std::array<float,2>{0.521023691f, 0.863756776f},
-std::array<float,2>{0.108183116f, 0.352873296f},
-std::array<float,2>{0.0528569594f, 0.542276859f},
-std::array<float,2>{0.562609732f, 0.122788809f},
-std::array<float,2>{0.795461416f, 0.967846811f},
-std::array<float,2>{0.274413586f, 0.443029493f},
-std::array<float,2>{0.387843728f, 0.788065732f},
-std::array<float,2>{0.883915305f, 0.306950808f},
-std::array<float,2>{0.748346388f, 0.735449374f},
-std::array<float,2>{0.183305755f, 0.246519223f},
-std::array<float,2>{0.093725279f, 0.836090803f},
-std::array<float,2>{0.557184458f, 0.342437983f},
-std::array<float,2>{0.818721592f, 0.680799246f},
-std::array<float,2>{0.348681241f, 0.183887854f},
-std::array<float,2>{0.499470264f, 0.578088641f},
-std::array<float,2>{0.955848455f, 0.0438629389f},
-std::array<float,2>{0.655722618f, 0.928141296f},
-std::array<float,2>{0.20245719f, 0.389838964f},
-std::array<float,2>{0.131053478f, 0.689299822f},
-std::array<float,2>{0.693341196f, 0.196044028f},
-std::array<float,2>{0.937419295f, 0.772764325f},
-std::array<float,2>{0.431686461f, 0.263259858f},
-std::array<float,2>{0.299236268f, 0.9962309f},
-std::array<float,2>{0.780292153f, 0.474171877f},
-std::array<float,2>{0.622512281f, 0.516948998f},
-std::array<float,2>{0.0227501057f, 0.0895650089f},
-std::array<float,2>{0.189481914f, 0.868751347f},
-std::array<float,2>{0.641314328f, 0.350188553f},
-std::array<float,2>{0.964078605f, 0.646327734f},
-std::array<float,2>{0.490442276f, 0.13752611f},
-std::array<float,2>{0.352678895f, 0.60906744f},
-std::array<float,2>{0.822383046f, 0.0122988727f},
-std::array<float,2>{0.552218318f, 0.881859303f},
-std::array<float,2>{0.0807697326f, 0.432861984f},
-std::array<float,2>{0.0272648912f, 0.747805238f},
-std::array<float,2>{0.6157251f, 0.241542429f},
-std::array<float,2>{0.770600855f, 0.795345724f},
-std::array<float,2>{0.304762155f, 0.303138286f},
-std::array<float,2>{0.427155793f, 0.957670629f},
-std::array<float,2>{0.92569977f, 0.452938408f},
-std::array<float,2>{0.697686911f, 0.538779676f},
-std::array<float,2>{0.132905915f, 0.112906151f},
-std::array<float,2>{0.10145954f, 0.93165189f},
-std::array<float,2>{0.527399242f, 0.378154933f},
-std::array<float,2>{0.867898047f, 0.565053701f},
-std::array<float,2>{0.326998174f, 0.0360700525f},
-std::array<float,2>{0.444665432f, 0.675005198f},
-std::array<float,2>{0.999640107f, 0.176480219f},
-std::array<float,2>{0.664539933f, 0.832477033f},
-std::array<float,2>{0.245434552f, 0.330732912f},
-std::array<float,2>{0.174742728f, 0.529696882f},
-std::array<float,2>{0.739787519f, 0.0811078772f},
-std::array<float,2>{0.877175868f, 0.990080237f},
-std::array<float,2>{0.379370034f, 0.483444244f},
-std::array<float,2>{0.267689377f, 0.779854f},
-std::array<float,2>{0.785473466f, 0.250170827f},
-std::array<float,2>{0.573788524f, 0.695707917f},
-std::array<float,2>{0.0585038587f, 0.193909004f},
-std::array<float,2>{0.155626774f, 0.969067097f},
-std::array<float,2>{0.717948914f, 0.495929092f},
-std::array<float,2>{0.911130726f, 0.50682199f},
-std::array<float,2>{0.420588583f, 0.0687368214f},
-std::array<float,2>{0.296068311f, 0.704251468f},
-std::array<float,2>{0.761391938f, 0.215773493f},
-std::array<float,2>{0.607799947f, 0.7513327f},
-std::array<float,2>{0.015380335f, 0.277626097f},
-std::array<float,2>{0.0682848021f, 0.579555452f},
-std::array<float,2>{0.54408288f, 0.0548734069f},
-std::array<float,2>{0.835684299f, 0.910202205f},
-std::array<float,2>{0.373605967f, 0.405746222f},
-std::array<float,2>{0.48271662f, 0.814105034f},
-std::array<float,2>{0.949826717f, 0.322019815f},
-std::array<float,2>{0.63782984f, 0.6577878f},
-std::array<float,2>{0.206825286f, 0.159226939f},
-std::array<float,2>{0.0465446338f, 0.811630785f},
-std::array<float,2>{0.578868985f, 0.281346679f},
-std::array<float,2>{0.799860716f, 0.73369801f},
-std::array<float,2>{0.264306456f, 0.230143189f},
-std::array<float,2>{0.394837052f, 0.562070787f},
-std::array<float,2>{0.904360414f, 0.107126109f},
-std::array<float,2>{0.723612785f, 0.951433957f},
-std::array<float,2>{0.164055675f, 0.464840412f},
-std::array<float,2>{0.220033705f, 0.63681078f},
-std::array<float,2>{0.677506685f, 0.147054464f},
-std::array<float,2>{0.977413177f, 0.853889287f},
-std::array<float,2>{0.467883706f, 0.366638929f},
-std::array<float,2>{0.342363119f, 0.894309402f},
-std::array<float,2>{0.848653793f, 0.409588516f},
-std::array<float,2>{0.511362672f, 0.609885156f},
-std::array<float,2>{0.120633304f, 0.0177162737f},
-std::array<float,2>{0.22962369f, 0.789626181f},
-std::array<float,2>{0.679950416f, 0.300222725f},
-std::array<float,2>{0.970089257f, 0.744197547f},
-std::array<float,2>{0.455464423f, 0.23712188f},
-std::array<float,2>{0.329202294f, 0.53126651f},
-std::array<float,2>{0.853057623f, 0.11335405f},
-std::array<float,2>{0.501152515f, 0.953653514f},
-std::array<float,2>{0.112464443f, 0.447416127f},
-std::array<float,2>{0.0352057628f, 0.643453062f},
-std::array<float,2>{0.589799047f, 0.135371432f},
-std::array<float,2>{0.809524059f, 0.873623371f},
-std::array<float,2>{0.25334236f, 0.347515404f},
-std::array<float,2>{0.406068951f, 0.875685096f},
-std::array<float,2>{0.898296952f, 0.435644865f},
-std::array<float,2>{0.730226398f, 0.602945268f},
-std::array<float,2>{0.166979879f, 0.0106491726f},
-std::array<float,2>{0.0726568401f, 0.984936237f},
-std::array<float,2>{0.531980753f, 0.480220109f},
-std::array<float,2>{0.839797735f, 0.524006188f},
-std::array<float,2>{0.364165306f, 0.0841762051f},
-std::array<float,2>{0.472350687f, 0.700037718f},
-std::array<float,2>{0.941786885f, 0.18956545f},
-std::array<float,2>{0.627086997f, 0.775020778f},
-std::array<float,2>{0.217138574f, 0.2549541f},
-std::array<float,2>{0.141842663f, 0.568805754f},
-std::array<float,2>{0.704705894f, 0.0349872708f},
-std::array<float,2>{0.921322107f, 0.936347067f},
-std::array<float,2>{0.410675794f, 0.380715638f},
-std::array<float,2>{0.284739405f, 0.82872808f},
-std::array<float,2>{0.750219882f, 0.332866937f},
-std::array<float,2>{0.59650743f, 0.676971555f},
-std::array<float,2>{0.00433363998f, 0.174045026f},
-std::array<float,2>{0.184436053f, 0.909910679f},
-std::array<float,2>{0.745256364f, 0.398982644f},
-std::array<float,2>{0.888900936f, 0.585071266f},
-std::array<float,2>{0.383834302f, 0.060299702f},
-std::array<float,2>{0.279523373f, 0.663625479f},
-std::array<float,2>{0.79246366f, 0.162288964f},
-std::array<float,2>{0.567765772f, 0.816608131f},
-std::array<float,2>{0.0499371327f, 0.326000452f},
-std::array<float,2>{0.102400012f, 0.503525615f},
-std::array<float,2>{0.517655015f, 0.0633426383f},
-std::array<float,2>{0.862175107f, 0.976329565f},
-std::array<float,2>{0.315845281f, 0.498952419f},
-std::array<float,2>{0.448502839f, 0.756414294f},
-std::array<float,2>{0.987268925f, 0.275263727f},
-std::array<float,2>{0.657494068f, 0.71088016f},
-std::array<float,2>{0.234946296f, 0.212327436f},
-std::array<float,2>{0.0157089047f, 0.859252095f},
-std::array<float,2>{0.618344247f, 0.361988127f},
-std::array<float,2>{0.776145458f, 0.634010196f},
-std::array<float,2>{0.304386675f, 0.143176049f},
-std::array<float,2>{0.43533501f, 0.617061555f},
-std::array<float,2>{0.932738364f, 0.0230367798f},
-std::array<float,2>{0.690984368f, 0.897376418f},
-std::array<float,2>{0.126878396f, 0.411245048f},
-std::array<float,2>{0.196466148f, 0.729791999f},
-std::array<float,2>{0.651830196f, 0.231576934f},
-std::array<float,2>{0.959417462f, 0.805833459f},
-std::array<float,2>{0.492871284f, 0.285539597f},
-std::array<float,2>{0.347560406f, 0.947259307f},
-std::array<float,2>{0.815794885f, 0.46530968f},
-std::array<float,2>{0.560513675f, 0.55644536f},
-std::array<float,2>{0.0873552188f, 0.101971194f},
-std::array<float,2>{0.140467346f, 0.826674044f},
-std::array<float,2>{0.701884627f, 0.317815959f},
-std::array<float,2>{0.928961575f, 0.664856791f},
-std::array<float,2>{0.424456507f, 0.164488688f},
-std::array<float,2>{0.308820307f, 0.589456975f},
-std::array<float,2>{0.766569853f, 0.053920418f},
-std::array<float,2>{0.612682164f, 0.918921888f},
-std::array<float,2>{0.0283845849f, 0.391575664f},
-std::array<float,2>{0.0856303796f, 0.716745317f},
-std::array<float,2>{0.547922611f, 0.205827087f},
-std::array<float,2>{0.826557159f, 0.757875144f},
-std::array<float,2>{0.355643332f, 0.270115376f},
-std::array<float,2>{0.486130297f, 0.982973695f},
-std::array<float,2>{0.964958787f, 0.487421066f},
-std::array<float,2>{0.647290468f, 0.510400057f},
-std::array<float,2>{0.194197834f, 0.0751344413f},
-std::array<float,2>{0.0602927133f, 0.899481773f},
-std::array<float,2>{0.577787817f, 0.415004551f},
-std::array<float,2>{0.782865167f, 0.624501705f},
-std::array<float,2>{0.269794226f, 0.0299938451f},
-std::array<float,2>{0.377638131f, 0.627108455f},
-std::array<float,2>{0.880939484f, 0.150216177f},
-std::array<float,2>{0.73555088f, 0.849177718f},
-std::array<float,2>{0.177691966f, 0.369169563f},
-std::array<float,2>{0.248840854f, 0.550531805f},
-std::array<float,2>{0.669545829f, 0.0995700359f},
-std::array<float,2>{0.994662285f, 0.939714372f},
-std::array<float,2>{0.440357387f, 0.455203891f},
-std::array<float,2>{0.321353793f, 0.801286042f},
-std::array<float,2>{0.871819854f, 0.295628488f},
-std::array<float,2>{0.527090549f, 0.725367427f},
-std::array<float,2>{0.0975122824f, 0.220197201f},
-std::array<float,2>{0.209125131f, 0.960938692f},
-std::array<float,2>{0.633065104f, 0.438738257f},
-std::array<float,2>{0.94785893f, 0.544397831f},
-std::array<float,2>{0.476637214f, 0.119958431f},
-std::array<float,2>{0.367554098f, 0.73901093f},
-std::array<float,2>{0.830680907f, 0.244193986f},
-std::array<float,2>{0.539183795f, 0.782549202f},
-std::array<float,2>{0.0630193278f, 0.309277177f},
-std::array<float,2>{0.00786944199f, 0.597655058f},
-std::array<float,2>{0.603856385f, 0.00324900541f},
-std::array<float,2>{0.765112698f, 0.885167003f},
-std::array<float,2>{0.290708989f, 0.423196018f},
-std::array<float,2>{0.416955382f, 0.8594051f},
-std::array<float,2>{0.906771123f, 0.358001471f},
-std::array<float,2>{0.71458745f, 0.654408395f},
-std::array<float,2>{0.150984704f, 0.125703171f},
-std::array<float,2>{0.124463908f, 0.769507945f},
-std::array<float,2>{0.511799335f, 0.260789692f},
-std::array<float,2>{0.843984842f, 0.694642246f},
-std::array<float,2>{0.338843822f, 0.200358972f},
-std::array<float,2>{0.464202344f, 0.51964134f},
-std::array<float,2>{0.983573556f, 0.0932699591f},
-std::array<float,2>{0.675751209f, 0.995027781f},
-std::array<float,2>{0.223275527f, 0.471463948f},
-std::array<float,2>{0.158890948f, 0.685228646f},
-std::array<float,2>{0.720371604f, 0.180651516f},
-std::array<float,2>{0.901685655f, 0.840559959f},
-std::array<float,2>{0.393039912f, 0.339146286f},
-std::array<float,2>{0.259378165f, 0.923969567f},
-std::array<float,2>{0.804570079f, 0.385841548f},
-std::array<float,2>{0.58520937f, 0.57265681f},
-std::array<float,2>{0.0418425575f, 0.0415896215f},
-std::array<float,2>{0.130235717f, 0.772081494f},
-std::array<float,2>{0.694176197f, 0.262227029f},
-std::array<float,2>{0.933829486f, 0.688345909f},
-std::array<float,2>{0.431569636f, 0.196583673f},
-std::array<float,2>{0.298785359f, 0.516101897f},
-std::array<float,2>{0.778803408f, 0.0888519064f},
-std::array<float,2>{0.624376357f, 0.997109354f},
-std::array<float,2>{0.0212309361f, 0.473364651f},
-std::array<float,2>{0.0917130858f, 0.680445075f},
-std::array<float,2>{0.555119455f, 0.184788495f},
-std::array<float,2>{0.818247736f, 0.837334573f},
-std::array<float,2>{0.350130826f, 0.343710482f},
-std::array<float,2>{0.497325301f, 0.928722262f},
-std::array<float,2>{0.95380336f, 0.388930917f},
-std::array<float,2>{0.652681351f, 0.576826692f},
-std::array<float,2>{0.199582711f, 0.0442299955f},
-std::array<float,2>{0.0517006963f, 0.967198193f},
-std::array<float,2>{0.566180587f, 0.441623867f},
-std::array<float,2>{0.794081032f, 0.541934431f},
-std::array<float,2>{0.275453925f, 0.121912874f},
-std::array<float,2>{0.390402764f, 0.734979689f},
-std::array<float,2>{0.886583686f, 0.247825012f},
-std::array<float,2>{0.747047305f, 0.788668633f},
-std::array<float,2>{0.181129396f, 0.308585763f},
-std::array<float,2>{0.241432026f, 0.597808182f},
-std::array<float,2>{0.662151754f, 0.00426804647f},
-std::array<float,2>{0.990691245f, 0.890494466f},
-std::array<float,2>{0.450443745f, 0.428489983f},
-std::array<float,2>{0.317591667f, 0.865070343f},
-std::array<float,2>{0.864816725f, 0.35161069f},
-std::array<float,2>{0.523046672f, 0.650218129f},
-std::array<float,2>{0.105807692f, 0.132181346f},
-std::array<float,2>{0.211966008f, 0.902876556f},
-std::array<float,2>{0.631776333f, 0.420970619f},
-std::array<float,2>{0.937740088f, 0.617617786f},
-std::array<float,2>{0.474049896f, 0.0259766784f},
-std::array<float,2>{0.360534102f, 0.629861534f},
-std::array<float,2>{0.842155695f, 0.152951926f},
-std::array<float,2>{0.536296368f, 0.847173929f},
-std::array<float,2>{0.076614812f, 0.372584909f},
-std::array<float,2>{0.00253167632f, 0.551574349f},
-std::array<float,2>{0.601502001f, 0.0970512182f},
-std::array<float,2>{0.754266083f, 0.944986999f},
-std::array<float,2>{0.287617385f, 0.457229167f},
-std::array<float,2>{0.407772541f, 0.798183382f},
-std::array<float,2>{0.916774511f, 0.290284425f},
-std::array<float,2>{0.709105611f, 0.721092403f},
-std::array<float,2>{0.145993605f, 0.225246042f},
-std::array<float,2>{0.113730527f, 0.823881209f},
-std::array<float,2>{0.506978035f, 0.313171506f},
-std::array<float,2>{0.857942224f, 0.669855654f},
-std::array<float,2>{0.334873438f, 0.170893088f},
-std::array<float,2>{0.458038747f, 0.59336704f},
-std::array<float,2>{0.975127757f, 0.0502991229f},
-std::array<float,2>{0.68573308f, 0.917440474f},
-std::array<float,2>{0.233491048f, 0.397870094f},
-std::array<float,2>{0.169646025f, 0.712591708f},
-std::array<float,2>{0.730869353f, 0.207213685f},
-std::array<float,2>{0.892952681f, 0.763216436f},
-std::array<float,2>{0.400232762f, 0.268237889f},
-std::array<float,2>{0.255990326f, 0.978342772f},
-std::array<float,2>{0.805360198f, 0.488671213f},
-std::array<float,2>{0.59347868f, 0.512409627f},
-std::array<float,2>{0.0328347534f, 0.0711198375f},
-std::array<float,2>{0.222561955f, 0.854893863f},
-std::array<float,2>{0.679140866f, 0.365718514f},
-std::array<float,2>{0.979456007f, 0.638005495f},
-std::array<float,2>{0.465068728f, 0.147905365f},
-std::array<float,2>{0.339852065f, 0.610629082f},
-std::array<float,2>{0.851464689f, 0.0187269729f},
-std::array<float,2>{0.508801937f, 0.893270791f},
-std::array<float,2>{0.118512213f, 0.408793241f},
-std::array<float,2>{0.044076696f, 0.733376324f},
-std::array<float,2>{0.580125749f, 0.229191735f},
-std::array<float,2>{0.798445106f, 0.811311662f},
-std::array<float,2>{0.263195366f, 0.282729983f},
-std::array<float,2>{0.398287356f, 0.95217818f},
-std::array<float,2>{0.903479636f, 0.463854849f},
-std::array<float,2>{0.726442158f, 0.561314583f},
-std::array<float,2>{0.161598682f, 0.105731696f},
-std::array<float,2>{0.0687614828f, 0.911730945f},
-std::array<float,2>{0.546323895f, 0.404542118f},
-std::array<float,2>{0.833598256f, 0.578589916f},
-std::array<float,2>{0.372067511f, 0.0559392609f},
-std::array<float,2>{0.481457978f, 0.656418264f},
-std::array<float,2>{0.952511847f, 0.159133106f},
-std::array<float,2>{0.639949381f, 0.813427925f},
-std::array<float,2>{0.20350197f, 0.320844352f},
-std::array<float,2>{0.153813824f, 0.507270753f},
-std::array<float,2>{0.715615392f, 0.0699187666f},
-std::array<float,2>{0.912634432f, 0.970422387f},
-std::array<float,2>{0.41820541f, 0.494325221f},
-std::array<float,2>{0.294896185f, 0.750914156f},
-std::array<float,2>{0.759609342f, 0.279069781f},
-std::array<float,2>{0.607365847f, 0.703951716f},
-std::array<float,2>{0.0126879318f, 0.215967864f},
-std::array<float,2>{0.173132598f, 0.98889631f},
-std::array<float,2>{0.74064064f, 0.482713848f},
-std::array<float,2>{0.876285195f, 0.531048954f},
-std::array<float,2>{0.381436408f, 0.0802292302f},
-std::array<float,2>{0.266706437f, 0.696460485f},
-std::array<float,2>{0.788872242f, 0.194547459f},
-std::array<float,2>{0.570636034f, 0.780784905f},
-std::array<float,2>{0.0560881048f, 0.251746953f},
-std::array<float,2>{0.0984088704f, 0.565488935f},
-std::array<float,2>{0.53085959f, 0.0371090397f},
-std::array<float,2>{0.871047914f, 0.933539152f},
-std::array<float,2>{0.324397475f, 0.377334148f},
-std::array<float,2>{0.442361325f, 0.833358109f},
-std::array<float,2>{0.997818887f, 0.331493318f},
-std::array<float,2>{0.666406393f, 0.674371362f},
-std::array<float,2>{0.24343209f, 0.177176639f},
-std::array<float,2>{0.0251456201f, 0.796322107f},
-std::array<float,2>{0.614131331f, 0.303780079f},
-std::array<float,2>{0.771484792f, 0.746700048f},
-std::array<float,2>{0.307080179f, 0.24047564f},
-std::array<float,2>{0.428055644f, 0.538071752f},
-std::array<float,2>{0.923010647f, 0.112047493f},
-std::array<float,2>{0.697181761f, 0.958968163f},
-std::array<float,2>{0.136017039f, 0.45144403f},
-std::array<float,2>{0.189067245f, 0.645189881f},
-std::array<float,2>{0.643077075f, 0.137730852f},
-std::array<float,2>{0.961881459f, 0.867464066f},
-std::array<float,2>{0.489942253f, 0.35153082f},
-std::array<float,2>{0.353867203f, 0.881109416f},
-std::array<float,2>{0.820685685f, 0.432252586f},
-std::array<float,2>{0.553361952f, 0.608251631f},
-std::array<float,2>{0.0782902464f, 0.0127285188f},
-std::array<float,2>{0.198287323f, 0.805227458f},
-std::array<float,2>{0.649612308f, 0.286271572f},
-std::array<float,2>{0.957482576f, 0.728628874f},
-std::array<float,2>{0.494771272f, 0.230854899f},
-std::array<float,2>{0.345445693f, 0.555218756f},
-std::array<float,2>{0.8130458f, 0.102573931f},
-std::array<float,2>{0.561564863f, 0.945750594f},
-std::array<float,2>{0.0884382427f, 0.465982735f},
-std::array<float,2>{0.0188426636f, 0.63305819f},
-std::array<float,2>{0.620483458f, 0.144174665f},
-std::array<float,2>{0.774552345f, 0.858147919f},
-std::array<float,2>{0.302203357f, 0.36248827f},
-std::array<float,2>{0.436526686f, 0.897892416f},
-std::array<float,2>{0.930627346f, 0.410457671f},
-std::array<float,2>{0.688801408f, 0.615461111f},
-std::array<float,2>{0.127117366f, 0.0222271029f},
-std::array<float,2>{0.104047194f, 0.975415766f},
-std::array<float,2>{0.516237259f, 0.499047786f},
-std::array<float,2>{0.859795809f, 0.502032757f},
-std::array<float,2>{0.314267814f, 0.0642076805f},
-std::array<float,2>{0.445456564f, 0.709438682f},
-std::array<float,2>{0.98461318f, 0.211489722f},
-std::array<float,2>{0.659703434f, 0.757492661f},
-std::array<float,2>{0.23735714f, 0.273699164f},
-std::array<float,2>{0.186630443f, 0.584859788f},
-std::array<float,2>{0.742805481f, 0.0592288375f},
-std::array<float,2>{0.888401628f, 0.909055054f},
-std::array<float,2>{0.386238784f, 0.399911821f},
-std::array<float,2>{0.27745229f, 0.817928314f},
-std::array<float,2>{0.789736927f, 0.324492246f},
-std::array<float,2>{0.570185483f, 0.662554562f},
-std::array<float,2>{0.0474121235f, 0.163766205f},
-std::array<float,2>{0.144239128f, 0.937186182f},
-std::array<float,2>{0.705668807f, 0.379149497f},
-std::array<float,2>{0.919429362f, 0.569584787f},
-std::array<float,2>{0.41243723f, 0.0337609462f},
-std::array<float,2>{0.282709658f, 0.676622689f},
-std::array<float,2>{0.752093077f, 0.17535843f},
-std::array<float,2>{0.594578743f, 0.829418957f},
-std::array<float,2>{0.00690549426f, 0.333599746f},
-std::array<float,2>{0.070446685f, 0.525013149f},
-std::array<float,2>{0.533347607f, 0.0851030722f},
-std::array<float,2>{0.836378872f, 0.986007392f},
-std::array<float,2>{0.365437537f, 0.479475915f},
-std::array<float,2>{0.470163047f, 0.773584723f},
-std::array<float,2>{0.944763243f, 0.254517436f},
-std::array<float,2>{0.625894248f, 0.701047182f},
-std::array<float,2>{0.216721237f, 0.191269428f},
-std::array<float,2>{0.0371817537f, 0.874404609f},
-std::array<float,2>{0.587370694f, 0.345774949f},
-std::array<float,2>{0.811159015f, 0.644297957f},
-std::array<float,2>{0.251067787f, 0.136121169f},
-std::array<float,2>{0.403704286f, 0.601597011f},
-std::array<float,2>{0.89519304f, 0.0110511919f},
-std::array<float,2>{0.728124857f, 0.876661301f},
-std::array<float,2>{0.164641872f, 0.437421501f},
-std::array<float,2>{0.227788091f, 0.745472074f},
-std::array<float,2>{0.683288038f, 0.237487406f},
-std::array<float,2>{0.972308338f, 0.790813863f},
-std::array<float,2>{0.453743279f, 0.29978171f},
-std::array<float,2>{0.331237078f, 0.95467782f},
-std::array<float,2>{0.85391587f, 0.449189276f},
-std::array<float,2>{0.503570974f, 0.532418668f},
-std::array<float,2>{0.110604502f, 0.114909999f},
-std::array<float,2>{0.156411693f, 0.841044843f},
-std::array<float,2>{0.721426249f, 0.338299334f},
-std::array<float,2>{0.898640275f, 0.68432945f},
-std::array<float,2>{0.390894175f, 0.180891946f},
-std::array<float,2>{0.260315955f, 0.573573232f},
-std::array<float,2>{0.801022947f, 0.0426759124f},
-std::array<float,2>{0.582064211f, 0.925404251f},
-std::array<float,2>{0.0393137187f, 0.384767503f},
-std::array<float,2>{0.122815639f, 0.694060922f},
-std::array<float,2>{0.513744831f, 0.200128704f},
-std::array<float,2>{0.847545743f, 0.767886817f},
-std::array<float,2>{0.337617189f, 0.260365218f},
-std::array<float,2>{0.462372363f, 0.99592334f},
-std::array<float,2>{0.980965793f, 0.472460896f},
-std::array<float,2>{0.672708988f, 0.520817041f},
-std::array<float,2>{0.2247179f, 0.0918002576f},
-std::array<float,2>{0.0104277683f, 0.886456847f},
-std::array<float,2>{0.601576149f, 0.422092557f},
-std::array<float,2>{0.763566911f, 0.595794439f},
-std::array<float,2>{0.29156664f, 0.00228732079f},
-std::array<float,2>{0.415058851f, 0.65618217f},
-std::array<float,2>{0.909844577f, 0.126499504f},
-std::array<float,2>{0.712222934f, 0.860968411f},
-std::array<float,2>{0.149864525f, 0.359129012f},
-std::array<float,2>{0.207056656f, 0.543152273f},
-std::array<float,2>{0.63565135f, 0.120477773f},
-std::array<float,2>{0.94665432f, 0.962184727f},
-std::array<float,2>{0.478883803f, 0.437786222f},
-std::array<float,2>{0.369921803f, 0.781840146f},
-std::array<float,2>{0.828920066f, 0.310130268f},
-std::array<float,2>{0.542434037f, 0.739830554f},
-std::array<float,2>{0.0646733642f, 0.245617837f},
-std::array<float,2>{0.246506959f, 0.940924585f},
-std::array<float,2>{0.671769083f, 0.456571758f},
-std::array<float,2>{0.993528485f, 0.548880816f},
-std::array<float,2>{0.438604623f, 0.0979849324f},
-std::array<float,2>{0.323485255f, 0.725644052f},
-std::array<float,2>{0.874162018f, 0.219456881f},
-std::array<float,2>{0.523631036f, 0.802656889f},
-std::array<float,2>{0.0949955359f, 0.296420634f},
-std::array<float,2>{0.0624442473f, 0.623284698f},
-std::array<float,2>{0.575371385f, 0.0304148495f},
-std::array<float,2>{0.783398032f, 0.899401307f},
-std::array<float,2>{0.272428602f, 0.415829271f},
-std::array<float,2>{0.375091583f, 0.84833014f},
-std::array<float,2>{0.879941046f, 0.37031731f},
-std::array<float,2>{0.736991405f, 0.628802478f},
-std::array<float,2>{0.178832546f, 0.148914948f},
-std::array<float,2>{0.0822992176f, 0.759257317f},
-std::array<float,2>{0.550612867f, 0.271183133f},
-std::array<float,2>{0.826096535f, 0.714931011f},
-std::array<float,2>{0.358551592f, 0.206852734f},
-std::array<float,2>{0.486757249f, 0.510763109f},
-std::array<float,2>{0.96815908f, 0.075536035f},
-std::array<float,2>{0.645783126f, 0.984012246f},
-std::array<float,2>{0.192903593f, 0.487281293f},
-std::array<float,2>{0.137692586f, 0.665832877f},
-std::array<float,2>{0.699996829f, 0.165047377f},
-std::array<float,2>{0.926174998f, 0.827862442f},
-std::array<float,2>{0.422284096f, 0.316899091f},
-std::array<float,2>{0.312140703f, 0.919147611f},
-std::array<float,2>{0.769431889f, 0.391712189f},
-std::array<float,2>{0.610557795f, 0.588530123f},
-std::array<float,2>{0.0311692059f, 0.0527370274f},
-std::array<float,2>{0.182112873f, 0.785641491f},
-std::array<float,2>{0.749678731f, 0.306238919f},
-std::array<float,2>{0.883109331f, 0.737380683f},
-std::array<float,2>{0.387252867f, 0.248661697f},
-std::array<float,2>{0.275358856f, 0.539358199f},
-std::array<float,2>{0.796723545f, 0.123963453f},
-std::array<float,2>{0.56400317f, 0.965094626f},
-std::array<float,2>{0.0546830334f, 0.445103079f},
-std::array<float,2>{0.108790487f, 0.651360214f},
-std::array<float,2>{0.520315588f, 0.129095793f},
-std::array<float,2>{0.867154717f, 0.866097391f},
-std::array<float,2>{0.320031136f, 0.353803128f},
-std::array<float,2>{0.452076912f, 0.887443304f},
-std::array<float,2>{0.988710999f, 0.426150143f},
-std::array<float,2>{0.661234081f, 0.601497531f},
-std::array<float,2>{0.239992797f, 0.00751755713f},
-std::array<float,2>{0.0220343489f, 0.998737335f},
-std::array<float,2>{0.621500134f, 0.4749659f},
-std::array<float,2>{0.779299915f, 0.518122435f},
-std::array<float,2>{0.299997866f, 0.0876480043f},
-std::array<float,2>{0.432736188f, 0.690980911f},
-std::array<float,2>{0.936366677f, 0.19746998f},
-std::array<float,2>{0.691869199f, 0.771355391f},
-std::array<float,2>{0.132449523f, 0.26450026f},
-std::array<float,2>{0.201244533f, 0.57504636f},
-std::array<float,2>{0.654696882f, 0.0462024547f},
-std::array<float,2>{0.956813037f, 0.926079512f},
-std::array<float,2>{0.498888195f, 0.387732267f},
-std::array<float,2>{0.347928554f, 0.838167071f},
-std::array<float,2>{0.819996774f, 0.341558784f},
-std::array<float,2>{0.558040857f, 0.681959271f},
-std::array<float,2>{0.0921126455f, 0.186219096f},
-std::array<float,2>{0.23181811f, 0.915704489f},
-std::array<float,2>{0.68452394f, 0.395020425f},
-std::array<float,2>{0.973127782f, 0.591494024f},
-std::array<float,2>{0.459820122f, 0.0487831719f},
-std::array<float,2>{0.332482308f, 0.671634912f},
-std::array<float,2>{0.856851816f, 0.169438377f},
-std::array<float,2>{0.505767226f, 0.822135568f},
-std::array<float,2>{0.115851894f, 0.315457851f},
-std::array<float,2>{0.0343404524f, 0.514475942f},
-std::array<float,2>{0.591636598f, 0.0726226419f},
-std::array<float,2>{0.808437645f, 0.978930652f},
-std::array<float,2>{0.255283207f, 0.491489112f},
-std::array<float,2>{0.40112251f, 0.763713956f},
-std::array<float,2>{0.891125381f, 0.266949385f},
-std::array<float,2>{0.733452201f, 0.713079631f},
-std::array<float,2>{0.171588197f, 0.210712865f},
-std::array<float,2>{0.0752138942f, 0.844922662f},
-std::array<float,2>{0.537926614f, 0.373081088f},
-std::array<float,2>{0.841017902f, 0.631832957f},
-std::array<float,2>{0.362273991f, 0.154485404f},
-std::array<float,2>{0.475344121f, 0.619669616f},
-std::array<float,2>{0.94111979f, 0.0242116917f},
-std::array<float,2>{0.629844248f, 0.904921949f},
-std::array<float,2>{0.214398175f, 0.418475896f},
-std::array<float,2>{0.148357645f, 0.720297456f},
-std::array<float,2>{0.707345545f, 0.224476472f},
-std::array<float,2>{0.914894104f, 0.800164223f},
-std::array<float,2>{0.408527404f, 0.292759448f},
-std::array<float,2>{0.286133677f, 0.941561878f},
-std::array<float,2>{0.757078052f, 0.459108591f},
-std::array<float,2>{0.599269927f, 0.552954197f},
-std::array<float,2>{0.000787900935f, 0.0951668993f},
-std::array<float,2>{0.205921307f, 0.815769136f},
-std::array<float,2>{0.637339056f, 0.323285788f},
-std::array<float,2>{0.951150537f, 0.659710228f},
-std::array<float,2>{0.483464181f, 0.158110157f},
-std::array<float,2>{0.374357283f, 0.581402659f},
-std::array<float,2>{0.834057152f, 0.0580279715f},
-std::array<float,2>{0.543256462f, 0.913665712f},
-std::array<float,2>{0.0666458681f, 0.40385139f},
-std::array<float,2>{0.0142309973f, 0.706524968f},
-std::array<float,2>{0.609366834f, 0.21805039f},
-std::array<float,2>{0.760725975f, 0.75304544f},
-std::array<float,2>{0.295387834f, 0.279881001f},
-std::array<float,2>{0.421212614f, 0.971601009f},
-std::array<float,2>{0.911649704f, 0.493082225f},
-std::array<float,2>{0.717165053f, 0.50451225f},
-std::array<float,2>{0.15491797f, 0.0668270066f},
-std::array<float,2>{0.119545832f, 0.891477764f},
-std::array<float,2>{0.51014483f, 0.407780647f},
-std::array<float,2>{0.848504663f, 0.612589896f},
-std::array<float,2>{0.343467861f, 0.0172317922f},
-std::array<float,2>{0.467021048f, 0.63892597f},
-std::array<float,2>{0.977797568f, 0.14476417f},
-std::array<float,2>{0.676617324f, 0.853111029f},
-std::array<float,2>{0.219643831f, 0.363550782f},
-std::array<float,2>{0.163076416f, 0.560255051f},
-std::array<float,2>{0.724190593f, 0.107617199f},
-std::array<float,2>{0.905307412f, 0.949954689f},
-std::array<float,2>{0.396422982f, 0.461368978f},
-std::array<float,2>{0.265096992f, 0.80915314f},
-std::array<float,2>{0.799619377f, 0.284060985f},
-std::array<float,2>{0.579311967f, 0.731323779f},
-std::array<float,2>{0.0455239341f, 0.227264434f},
-std::array<float,2>{0.134239122f, 0.960075855f},
-std::array<float,2>{0.699169934f, 0.450241446f},
-std::array<float,2>{0.924396694f, 0.536228895f},
-std::array<float,2>{0.426380903f, 0.110005058f},
-std::array<float,2>{0.306274444f, 0.749640942f},
-std::array<float,2>{0.769898951f, 0.238905862f},
-std::array<float,2>{0.616883099f, 0.794695616f},
-std::array<float,2>{0.0256272517f, 0.301326901f},
-std::array<float,2>{0.0814172029f, 0.605748117f},
-std::array<float,2>{0.550852299f, 0.014692829f},
-std::array<float,2>{0.823814452f, 0.880365491f},
-std::array<float,2>{0.35186249f, 0.431350291f},
-std::array<float,2>{0.491981f, 0.870545924f},
-std::array<float,2>{0.962935269f, 0.348425061f},
-std::array<float,2>{0.641826153f, 0.647050798f},
-std::array<float,2>{0.191385075f, 0.140615582f},
-std::array<float,2>{0.0573768578f, 0.77923733f},
-std::array<float,2>{0.572868168f, 0.253845036f},
-std::array<float,2>{0.786996126f, 0.698696077f},
-std::array<float,2>{0.268751413f, 0.192530051f},
-std::array<float,2>{0.380089372f, 0.529206872f},
-std::array<float,2>{0.878277719f, 0.079747729f},
-std::array<float,2>{0.738792896f, 0.990488768f},
-std::array<float,2>{0.174940094f, 0.482196748f},
-std::array<float,2>{0.2449193f, 0.673466086f},
-std::array<float,2>{0.665756583f, 0.179208845f},
-std::array<float,2>{0.998221576f, 0.834131002f},
-std::array<float,2>{0.444207579f, 0.328857452f},
-std::array<float,2>{0.327749133f, 0.931435227f},
-std::array<float,2>{0.8683815f, 0.375877589f},
-std::array<float,2>{0.528420091f, 0.562636673f},
-std::array<float,2>{0.1002829f, 0.0376808979f},
-std::array<float,2>{0.236186445f, 0.755582452f},
-std::array<float,2>{0.656484187f, 0.27678144f},
-std::array<float,2>{0.987693846f, 0.708523512f},
-std::array<float,2>{0.448040068f, 0.213101462f},
-std::array<float,2>{0.314671427f, 0.500747919f},
-std::array<float,2>{0.862983346f, 0.0656865016f},
-std::array<float,2>{0.519280672f, 0.973254144f},
-std::array<float,2>{0.103491656f, 0.497240782f},
-std::array<float,2>{0.048940938f, 0.661399484f},
-std::array<float,2>{0.567195833f, 0.161159322f},
-std::array<float,2>{0.791097343f, 0.819683135f},
-std::array<float,2>{0.280592233f, 0.326488286f},
-std::array<float,2>{0.383743763f, 0.907383502f},
-std::array<float,2>{0.890386581f, 0.4006567f},
-std::array<float,2>{0.744835973f, 0.583651721f},
-std::array<float,2>{0.18471086f, 0.0617033094f},
-std::array<float,2>{0.0860484615f, 0.948523998f},
-std::array<float,2>{0.55895859f, 0.467089027f},
-std::array<float,2>{0.815009117f, 0.557582855f},
-std::array<float,2>{0.346016496f, 0.104085431f},
-std::array<float,2>{0.493932068f, 0.727149129f},
-std::array<float,2>{0.960647821f, 0.233280256f},
-std::array<float,2>{0.650862575f, 0.807867646f},
-std::array<float,2>{0.195500597f, 0.28885603f},
-std::array<float,2>{0.125831172f, 0.614501536f},
-std::array<float,2>{0.689514816f, 0.0211524945f},
-std::array<float,2>{0.931989014f, 0.896095395f},
-std::array<float,2>{0.434178829f, 0.412801087f},
-std::array<float,2>{0.30299443f, 0.856042266f},
-std::array<float,2>{0.777198553f, 0.359518886f},
-std::array<float,2>{0.617437303f, 0.6358518f},
-std::array<float,2>{0.016762564f, 0.140833899f},
-std::array<float,2>{0.167799115f, 0.877334416f},
-std::array<float,2>{0.72872901f, 0.435067028f},
-std::array<float,2>{0.897398829f, 0.604768336f},
-std::array<float,2>{0.405168563f, 0.00807635766f},
-std::array<float,2>{0.252544701f, 0.641215563f},
-std::array<float,2>{0.809784174f, 0.134454653f},
-std::array<float,2>{0.588499904f, 0.871495306f},
-std::array<float,2>{0.0361344367f, 0.34519279f},
-std::array<float,2>{0.111512803f, 0.534921288f},
-std::array<float,2>{0.50001502f, 0.115744062f},
-std::array<float,2>{0.852193654f, 0.956102133f},
-std::array<float,2>{0.328224808f, 0.446891189f},
-std::array<float,2>{0.456980586f, 0.792493641f},
-std::array<float,2>{0.969520271f, 0.29791382f},
-std::array<float,2>{0.68101716f, 0.743930817f},
-std::array<float,2>{0.229166865f, 0.235087723f},
-std::array<float,2>{0.00547126774f, 0.830624878f},
-std::array<float,2>{0.596976876f, 0.33429566f},
-std::array<float,2>{0.751635134f, 0.678907216f},
-std::array<float,2>{0.283681035f, 0.172527894f},
-std::array<float,2>{0.411620229f, 0.568155527f},
-std::array<float,2>{0.920117915f, 0.0330425091f},
-std::array<float,2>{0.703739643f, 0.934545517f},
-std::array<float,2>{0.140942588f, 0.381796926f},
-std::array<float,2>{0.218647808f, 0.70191437f},
-std::array<float,2>{0.628349662f, 0.188437521f},
-std::array<float,2>{0.943250477f, 0.776838541f},
-std::array<float,2>{0.471253097f, 0.25650689f},
-std::array<float,2>{0.364394218f, 0.987690568f},
-std::array<float,2>{0.83859098f, 0.476959467f},
-std::array<float,2>{0.533141792f, 0.526651144f},
-std::array<float,2>{0.0740235373f, 0.0833271593f},
-std::array<float,2>{0.152289599f, 0.86162281f},
-std::array<float,2>{0.713767946f, 0.356345594f},
-std::array<float,2>{0.908203006f, 0.653229713f},
-std::array<float,2>{0.417621911f, 0.127843872f},
-std::array<float,2>{0.289300799f, 0.59509635f},
-std::array<float,2>{0.763691127f, 0.00155056769f},
-std::array<float,2>{0.604716718f, 0.882887959f},
-std::array<float,2>{0.00963161699f, 0.424111277f},
-std::array<float,2>{0.0635640249f, 0.740868807f},
-std::array<float,2>{0.54080838f, 0.243463218f},
-std::array<float,2>{0.831513166f, 0.783331871f},
-std::array<float,2>{0.368961781f, 0.311740637f},
-std::array<float,2>{0.478356421f, 0.964048982f},
-std::array<float,2>{0.94886899f, 0.439811587f},
-std::array<float,2>{0.634734809f, 0.546312571f},
-std::array<float,2>{0.210003287f, 0.11887154f},
-std::array<float,2>{0.042456083f, 0.921965957f},
-std::array<float,2>{0.584638536f, 0.384487391f},
-std::array<float,2>{0.803076267f, 0.571199358f},
-std::array<float,2>{0.258071542f, 0.0394282155f},
-std::array<float,2>{0.394326121f, 0.687326372f},
-std::array<float,2>{0.900567472f, 0.182482779f},
-std::array<float,2>{0.719402313f, 0.843698263f},
-std::array<float,2>{0.159228981f, 0.33635354f},
-std::array<float,2>{0.223884284f, 0.522907257f},
-std::array<float,2>{0.674387336f, 0.0912898481f},
-std::array<float,2>{0.982798398f, 0.992658257f},
-std::array<float,2>{0.463192433f, 0.468940735f},
-std::array<float,2>{0.339111477f, 0.767012835f},
-std::array<float,2>{0.845044136f, 0.258360535f},
-std::array<float,2>{0.513104796f, 0.692411423f},
-std::array<float,2>{0.123341702f, 0.203092963f},
-std::array<float,2>{0.195201814f, 0.982161582f},
-std::array<float,2>{0.647576988f, 0.484532803f},
-std::array<float,2>{0.966095328f, 0.507952213f},
-std::array<float,2>{0.484902084f, 0.0770846009f},
-std::array<float,2>{0.357287586f, 0.718097866f},
-std::array<float,2>{0.827200651f, 0.20472464f},
-std::array<float,2>{0.547322631f, 0.760296166f},
-std::array<float,2>{0.0842103958f, 0.271516889f},
-std::array<float,2>{0.0278714802f, 0.586871147f},
-std::array<float,2>{0.612274289f, 0.0518128499f},
-std::array<float,2>{0.766719401f, 0.920209408f},
-std::array<float,2>{0.31016767f, 0.393996537f},
-std::array<float,2>{0.424931794f, 0.824279845f},
-std::array<float,2>{0.928260326f, 0.318845958f},
-std::array<float,2>{0.702524483f, 0.666928768f},
-std::array<float,2>{0.13869603f, 0.166380033f},
-std::array<float,2>{0.0959300473f, 0.803221405f},
-std::array<float,2>{0.525432408f, 0.294734895f},
-std::array<float,2>{0.872931361f, 0.72450912f},
-std::array<float,2>{0.320889354f, 0.221303836f},
-std::array<float,2>{0.440637261f, 0.547610164f},
-std::array<float,2>{0.995775938f, 0.101418495f},
-std::array<float,2>{0.66883868f, 0.939019144f},
-std::array<float,2>{0.249230549f, 0.454726905f},
-std::array<float,2>{0.176707566f, 0.625158846f},
-std::array<float,2>{0.734516561f, 0.151336893f},
-std::array<float,2>{0.881934166f, 0.851225138f},
-std::array<float,2>{0.378458291f, 0.369060844f},
-std::array<float,2>{0.271370083f, 0.901914656f},
-std::array<float,2>{0.781574547f, 0.41760847f},
-std::array<float,2>{0.576520741f, 0.621995151f},
-std::array<float,2>{0.0589444824f, 0.0292366613f},
-std::array<float,2>{0.136625588f, 0.794396281f},
-std::array<float,2>{0.696483254f, 0.301069468f},
-std::array<float,2>{0.923540652f, 0.749431252f},
-std::array<float,2>{0.428279907f, 0.238297671f},
-std::array<float,2>{0.307616532f, 0.536780715f},
-std::array<float,2>{0.772062421f, 0.109834343f},
-std::array<float,2>{0.613602877f, 0.960459054f},
-std::array<float,2>{0.0246431567f, 0.451088846f},
-std::array<float,2>{0.0788782984f, 0.646694183f},
-std::array<float,2>{0.552806675f, 0.139898673f},
-std::array<float,2>{0.820929825f, 0.871070564f},
-std::array<float,2>{0.354138702f, 0.347776204f},
-std::array<float,2>{0.489460945f, 0.880391777f},
-std::array<float,2>{0.961039424f, 0.430727661f},
-std::array<float,2>{0.642874599f, 0.605968773f},
-std::array<float,2>{0.188929722f, 0.0153943701f},
-std::array<float,2>{0.0563556291f, 0.991096914f},
-std::array<float,2>{0.57087183f, 0.48156023f},
-std::array<float,2>{0.788313687f, 0.528634667f},
-std::array<float,2>{0.267293066f, 0.0793777555f},
-std::array<float,2>{0.381149411f, 0.698819697f},
-std::array<float,2>{0.876579285f, 0.193094879f},
-std::array<float,2>{0.740852475f, 0.778494358f},
-std::array<float,2>{0.173394084f, 0.253372937f},
-std::array<float,2>{0.244017169f, 0.563045084f},
-std::array<float,2>{0.666821003f, 0.0373747461f},
-std::array<float,2>{0.997180641f, 0.930797279f},
-std::array<float,2>{0.441735744f, 0.375440568f},
-std::array<float,2>{0.324804425f, 0.834626913f},
-std::array<float,2>{0.870227814f, 0.328329951f},
-std::array<float,2>{0.530510724f, 0.673209429f},
-std::array<float,2>{0.097836487f, 0.178898424f},
-std::array<float,2>{0.203854814f, 0.913347363f},
-std::array<float,2>{0.640208662f, 0.403421164f},
-std::array<float,2>{0.952869177f, 0.5819453f},
-std::array<float,2>{0.482402444f, 0.0582244359f},
-std::array<float,2>{0.371307969f, 0.659561932f},
-std::array<float,2>{0.833090365f, 0.157366067f},
-std::array<float,2>{0.546527505f, 0.816079199f},
-std::array<float,2>{0.0690790415f, 0.324214816f},
-std::array<float,2>{0.0117563633f, 0.503995001f},
-std::array<float,2>{0.606899858f, 0.0670792013f},
-std::array<float,2>{0.759071708f, 0.970790148f},
-std::array<float,2>{0.294423312f, 0.492421776f},
-std::array<float,2>{0.418526381f, 0.753469288f},
-std::array<float,2>{0.912597537f, 0.279425561f},
-std::array<float,2>{0.714944601f, 0.706801653f},
-std::array<float,2>{0.153339788f, 0.218704849f},
-std::array<float,2>{0.11867471f, 0.852964818f},
-std::array<float,2>{0.509413421f, 0.36395973f},
-std::array<float,2>{0.850872159f, 0.639176846f},
-std::array<float,2>{0.340564221f, 0.145423308f},
-std::array<float,2>{0.465739965f, 0.612840056f},
-std::array<float,2>{0.978985727f, 0.0166121982f},
-std::array<float,2>{0.679523766f, 0.891007602f},
-std::array<float,2>{0.221690923f, 0.407391995f},
-std::array<float,2>{0.161879003f, 0.730765641f},
-std::array<float,2>{0.725865841f, 0.226678804f},
-std::array<float,2>{0.903871179f, 0.80881691f},
-std::array<float,2>{0.397485644f, 0.283444256f},
-std::array<float,2>{0.263080239f, 0.949587464f},
-std::array<float,2>{0.798094988f, 0.461861938f},
-std::array<float,2>{0.580817163f, 0.560023248f},
-std::array<float,2>{0.0448173769f, 0.108162612f},
-std::array<float,2>{0.234124631f, 0.821710229f},
-std::array<float,2>{0.686203778f, 0.315982044f},
-std::array<float,2>{0.97476244f, 0.671042204f},
-std::array<float,2>{0.458610684f, 0.169088751f},
-std::array<float,2>{0.33401534f, 0.591058254f},
-std::array<float,2>{0.857673168f, 0.0483209528f},
-std::array<float,2>{0.507342696f, 0.915098429f},
-std::array<float,2>{0.113941848f, 0.394941688f},
-std::array<float,2>{0.0325778648f, 0.713857114f},
-std::array<float,2>{0.59299016f, 0.210382119f},
-std::array<float,2>{0.805038869f, 0.764261127f},
-std::array<float,2>{0.256367803f, 0.267286569f},
-std::array<float,2>{0.399789155f, 0.979476571f},
-std::array<float,2>{0.89341563f, 0.492019683f},
-std::array<float,2>{0.731361747f, 0.514005184f},
-std::array<float,2>{0.169318959f, 0.073051773f},
-std::array<float,2>{0.0768337026f, 0.904558718f},
-std::array<float,2>{0.536759794f, 0.418057919f},
-std::array<float,2>{0.842736602f, 0.619236887f},
-std::array<float,2>{0.36104539f, 0.0237911828f},
-std::array<float,2>{0.474350393f, 0.631309211f},
-std::array<float,2>{0.93808943f, 0.155064791f},
-std::array<float,2>{0.631166875f, 0.84539336f},
-std::array<float,2>{0.212587938f, 0.373764724f},
-std::array<float,2>{0.146105736f, 0.553404689f},
-std::array<float,2>{0.709853292f, 0.0952599645f},
-std::array<float,2>{0.916094184f, 0.942291677f},
-std::array<float,2>{0.407388061f, 0.459695488f},
-std::array<float,2>{0.287271529f, 0.800657868f},
-std::array<float,2>{0.754790604f, 0.292022914f},
-std::array<float,2>{0.600981414f, 0.719910145f},
-std::array<float,2>{0.00203664112f, 0.223668307f},
-std::array<float,2>{0.181622058f, 0.965447485f},
-std::array<float,2>{0.74620533f, 0.44446829f},
-std::array<float,2>{0.886063278f, 0.539619148f},
-std::array<float,2>{0.389903724f, 0.123123385f},
-std::array<float,2>{0.27589342f, 0.738016129f},
-std::array<float,2>{0.79473269f, 0.24821189f},
-std::array<float,2>{0.565690815f, 0.785736799f},
-std::array<float,2>{0.0511846989f, 0.305874497f},
-std::array<float,2>{0.106067315f, 0.600801528f},
-std::array<float,2>{0.522591054f, 0.0069782678f},
-std::array<float,2>{0.864688635f, 0.886973321f},
-std::array<float,2>{0.318098336f, 0.42650336f},
-std::array<float,2>{0.450897068f, 0.865636408f},
-std::array<float,2>{0.991115689f, 0.354483575f},
-std::array<float,2>{0.663029373f, 0.650758445f},
-std::array<float,2>{0.241868868f, 0.129664108f},
-std::array<float,2>{0.0206148531f, 0.770802796f},
-std::array<float,2>{0.624977887f, 0.2637254f},
-std::array<float,2>{0.779284f, 0.690710008f},
-std::array<float,2>{0.298057854f, 0.198202491f},
-std::array<float,2>{0.430874825f, 0.517785192f},
-std::array<float,2>{0.934529185f, 0.0873171762f},
-std::array<float,2>{0.693408787f, 0.998439789f},
-std::array<float,2>{0.130466163f, 0.475267649f},
-std::array<float,2>{0.199910671f, 0.68241781f},
-std::array<float,2>{0.653106451f, 0.185747266f},
-std::array<float,2>{0.953322709f, 0.838643074f},
-std::array<float,2>{0.497629881f, 0.341095537f},
-std::array<float,2>{0.349627167f, 0.926710308f},
-std::array<float,2>{0.817729652f, 0.388647556f},
-std::array<float,2>{0.555294096f, 0.574449718f},
-std::array<float,2>{0.0912689939f, 0.0466119088f},
-std::array<float,2>{0.192410901f, 0.759939253f},
-std::array<float,2>{0.64643687f, 0.271993816f},
-std::array<float,2>{0.968305349f, 0.718594491f},
-std::array<float,2>{0.487276733f, 0.204585046f},
-std::array<float,2>{0.35921967f, 0.508636355f},
-std::array<float,2>{0.825575292f, 0.0763319358f},
-std::array<float,2>{0.550116956f, 0.981854439f},
-std::array<float,2>{0.0825840682f, 0.484971136f},
-std::array<float,2>{0.0303039998f, 0.66637224f},
-std::array<float,2>{0.611174345f, 0.166713178f},
-std::array<float,2>{0.768756211f, 0.824937105f},
-std::array<float,2>{0.311544567f, 0.318983793f},
-std::array<float,2>{0.422654718f, 0.920692861f},
-std::array<float,2>{0.926323593f, 0.394335151f},
-std::array<float,2>{0.699612081f, 0.586385787f},
-std::array<float,2>{0.136820644f, 0.0523890145f},
-std::array<float,2>{0.0955527797f, 0.938506007f},
-std::array<float,2>{0.524331808f, 0.454281628f},
-std::array<float,2>{0.874721169f, 0.547079027f},
-std::array<float,2>{0.324100226f, 0.100940846f},
-std::array<float,2>{0.439125329f, 0.723802626f},
-std::array<float,2>{0.993747771f, 0.220880777f},
-std::array<float,2>{0.671067595f, 0.803310573f},
-std::array<float,2>{0.246845201f, 0.294065922f},
-std::array<float,2>{0.179677635f, 0.621193826f},
-std::array<float,2>{0.736604214f, 0.0287389085f},
-std::array<float,2>{0.880751729f, 0.901538074f},
-std::array<float,2>{0.375939071f, 0.417279929f},
-std::array<float,2>{0.271657616f, 0.850825965f},
-std::array<float,2>{0.783742547f, 0.368459463f},
-std::array<float,2>{0.576149642f, 0.625507653f},
-std::array<float,2>{0.0616683066f, 0.150626764f},
-std::array<float,2>{0.150114f, 0.883309245f},
-std::array<float,2>{0.712615788f, 0.424443007f},
-std::array<float,2>{0.909219801f, 0.595279992f},
-std::array<float,2>{0.415701807f, 0.00118519343f},
-std::array<float,2>{0.291400701f, 0.652559638f},
-std::array<float,2>{0.76272577f, 0.127365783f},
-std::array<float,2>{0.602472007f, 0.86198467f},
-std::array<float,2>{0.00996631104f, 0.355829597f},
-std::array<float,2>{0.0653094724f, 0.54640609f},
-std::array<float,2>{0.542656541f, 0.118608601f},
-std::array<float,2>{0.828428328f, 0.964425623f},
-std::array<float,2>{0.369451493f, 0.44012779f},
-std::array<float,2>{0.479068816f, 0.783878326f},
-std::array<float,2>{0.947173834f, 0.312200755f},
-std::array<float,2>{0.635139525f, 0.740458608f},
-std::array<float,2>{0.207533643f, 0.24386555f},
-std::array<float,2>{0.0395641811f, 0.84297961f},
-std::array<float,2>{0.582615376f, 0.336512148f},
-std::array<float,2>{0.801542282f, 0.686907649f},
-std::array<float,2>{0.260045558f, 0.181751505f},
-std::array<float,2>{0.391338646f, 0.570586681f},
-std::array<float,2>{0.899261951f, 0.03996519f},
-std::array<float,2>{0.721190035f, 0.922637403f},
-std::array<float,2>{0.156828865f, 0.384210408f},
-std::array<float,2>{0.225165665f, 0.693109989f},
-std::array<float,2>{0.671875775f, 0.202396631f},
-std::array<float,2>{0.980923116f, 0.767564595f},
-std::array<float,2>{0.462887824f, 0.258142561f},
-std::array<float,2>{0.337138683f, 0.992679596f},
-std::array<float,2>{0.846994996f, 0.469293386f},
-std::array<float,2>{0.514300466f, 0.523345411f},
-std::array<float,2>{0.122317515f, 0.0915501341f},
-std::array<float,2>{0.16408515f, 0.871689677f},
-std::array<float,2>{0.727759659f, 0.345670164f},
-std::array<float,2>{0.894823134f, 0.640716493f},
-std::array<float,2>{0.403909773f, 0.134198204f},
-std::array<float,2>{0.251742899f, 0.605222464f},
-std::array<float,2>{0.810847998f, 0.00840750709f},
-std::array<float,2>{0.587723792f, 0.877779305f},
-std::array<float,2>{0.0380195715f, 0.435019881f},
-std::array<float,2>{0.111202545f, 0.743359149f},
-std::array<float,2>{0.503233552f, 0.23454988f},
-std::array<float,2>{0.85405767f, 0.792263806f},
-std::array<float,2>{0.331733495f, 0.298467755f},
-std::array<float,2>{0.453195125f, 0.956832945f},
-std::array<float,2>{0.971994758f, 0.446431339f},
-std::array<float,2>{0.682845175f, 0.534465909f},
-std::array<float,2>{0.228463456f, 0.115612842f},
-std::array<float,2>{0.00758961635f, 0.933975399f},
-std::array<float,2>{0.594201922f, 0.381330192f},
-std::array<float,2>{0.752443969f, 0.567857027f},
-std::array<float,2>{0.283058107f, 0.0325224139f},
-std::array<float,2>{0.413048744f, 0.679395735f},
-std::array<float,2>{0.919654191f, 0.171987832f},
-std::array<float,2>{0.705107093f, 0.830152214f},
-std::array<float,2>{0.143979982f, 0.334608972f},
-std::array<float,2>{0.215828955f, 0.527193725f},
-std::array<float,2>{0.625410676f, 0.0836350098f},
-std::array<float,2>{0.945310652f, 0.988215506f},
-std::array<float,2>{0.470223933f, 0.477082819f},
-std::array<float,2>{0.36620757f, 0.77700901f},
-std::array<float,2>{0.836590588f, 0.256006509f},
-std::array<float,2>{0.533736646f, 0.701495528f},
-std::array<float,2>{0.0710108578f, 0.187899143f},
-std::array<float,2>{0.237875775f, 0.972787559f},
-std::array<float,2>{0.659416199f, 0.497842908f},
-std::array<float,2>{0.985137701f, 0.500263333f},
-std::array<float,2>{0.446019441f, 0.0659264177f},
-std::array<float,2>{0.313799262f, 0.708176017f},
-std::array<float,2>{0.860170245f, 0.213563353f},
-std::array<float,2>{0.515835226f, 0.755216956f},
-std::array<float,2>{0.103968784f, 0.277217716f},
-std::array<float,2>{0.0473102555f, 0.58342582f},
-std::array<float,2>{0.569675326f, 0.0620494671f},
-std::array<float,2>{0.789281249f, 0.908013165f},
-std::array<float,2>{0.277974099f, 0.401315957f},
-std::array<float,2>{0.386020035f, 0.819875836f},
-std::array<float,2>{0.88814795f, 0.327101946f},
-std::array<float,2>{0.74251914f, 0.66204685f},
-std::array<float,2>{0.187083051f, 0.161838576f},
-std::array<float,2>{0.0882074982f, 0.808509111f},
-std::array<float,2>{0.562200546f, 0.28845793f},
-std::array<float,2>{0.812759578f, 0.727040231f},
-std::array<float,2>{0.344813854f, 0.232494846f},
-std::array<float,2>{0.494573504f, 0.556755781f},
-std::array<float,2>{0.957753539f, 0.10397435f},
-std::array<float,2>{0.650198698f, 0.948992968f},
-std::array<float,2>{0.199105278f, 0.467559069f},
-std::array<float,2>{0.127468035f, 0.636632442f},
-std::array<float,2>{0.689056158f, 0.141317859f},
-std::array<float,2>{0.929998696f, 0.855898678f},
-std::array<float,2>{0.437218904f, 0.359975755f},
-std::array<float,2>{0.302678257f, 0.895725727f},
-std::array<float,2>{0.775020003f, 0.412526548f},
-std::array<float,2>{0.620932102f, 0.614823163f},
-std::array<float,2>{0.0194661878f, 0.0208156034f},
-std::array<float,2>{0.175418064f, 0.780654669f},
-std::array<float,2>{0.738576889f, 0.251094729f},
-std::array<float,2>{0.878524899f, 0.697126448f},
-std::array<float,2>{0.380476266f, 0.194897264f},
-std::array<float,2>{0.269072294f, 0.530333638f},
-std::array<float,2>{0.786193967f, 0.0810536668f},
-std::array<float,2>{0.572559655f, 0.988606393f},
-std::array<float,2>{0.0568295904f, 0.483111531f},
-std::array<float,2>{0.0999195278f, 0.673975229f},
-std::array<float,2>{0.528829277f, 0.17764096f},
-std::array<float,2>{0.868794203f, 0.83392483f},
-std::array<float,2>{0.327420741f, 0.331818134f},
-std::array<float,2>{0.443826824f, 0.932626843f},
-std::array<float,2>{0.998890281f, 0.377444178f},
-std::array<float,2>{0.66516459f, 0.566042244f},
-std::array<float,2>{0.244198948f, 0.0365211777f},
-std::array<float,2>{0.0258909576f, 0.958357751f},
-std::array<float,2>{0.616486609f, 0.451970458f},
-std::array<float,2>{0.770404339f, 0.537310839f},
-std::array<float,2>{0.305825442f, 0.111688711f},
-std::array<float,2>{0.426015347f, 0.746102989f},
-std::array<float,2>{0.924091458f, 0.241004929f},
-std::array<float,2>{0.698472917f, 0.796730995f},
-std::array<float,2>{0.134401888f, 0.304597199f},
-std::array<float,2>{0.190475896f, 0.607428074f},
-std::array<float,2>{0.64232105f, 0.013265647f},
-std::array<float,2>{0.963416219f, 0.881359637f},
-std::array<float,2>{0.491387367f, 0.431670457f},
-std::array<float,2>{0.352503121f, 0.867677033f},
-std::array<float,2>{0.823273242f, 0.350641638f},
-std::array<float,2>{0.551724195f, 0.644693017f},
-std::array<float,2>{0.0818587393f, 0.13830699f},
-std::array<float,2>{0.219114289f, 0.892602742f},
-std::array<float,2>{0.676105917f, 0.40837881f},
-std::array<float,2>{0.978333652f, 0.611276329f},
-std::array<float,2>{0.467657506f, 0.0191315487f},
-std::array<float,2>{0.343018711f, 0.63819772f},
-std::array<float,2>{0.847919822f, 0.148137748f},
-std::array<float,2>{0.51058042f, 0.855043411f},
-std::array<float,2>{0.120055594f, 0.365933627f},
-std::array<float,2>{0.0453613102f, 0.560879946f},
-std::array<float,2>{0.579791486f, 0.106222041f},
-std::array<float,2>{0.799270749f, 0.952871621f},
-std::array<float,2>{0.265300393f, 0.46327588f},
-std::array<float,2>{0.395970702f, 0.810948551f},
-std::array<float,2>{0.905777872f, 0.28243503f},
-std::array<float,2>{0.723688543f, 0.732823491f},
-std::array<float,2>{0.162405536f, 0.228731856f},
-std::array<float,2>{0.0669255406f, 0.812765777f},
-std::array<float,2>{0.543807209f, 0.32066682f},
-std::array<float,2>{0.834924757f, 0.657120943f},
-std::array<float,2>{0.374759227f, 0.158544421f},
-std::array<float,2>{0.484141737f, 0.578843713f},
-std::array<float,2>{0.950311422f, 0.0563963875f},
-std::array<float,2>{0.637148023f, 0.911378801f},
-std::array<float,2>{0.20517166f, 0.404824913f},
-std::array<float,2>{0.154447347f, 0.703483105f},
-std::array<float,2>{0.717760146f, 0.216672987f},
-std::array<float,2>{0.911581039f, 0.750126898f},
-std::array<float,2>{0.421820849f, 0.278553784f},
-std::array<float,2>{0.295865506f, 0.969783127f},
-std::array<float,2>{0.759965658f, 0.494931877f},
-std::array<float,2>{0.608848691f, 0.507343888f},
-std::array<float,2>{0.0139468685f, 0.0693550259f},
-std::array<float,2>{0.214201152f, 0.84690094f},
-std::array<float,2>{0.629229248f, 0.372120231f},
-std::array<float,2>{0.940585732f, 0.629067898f},
-std::array<float,2>{0.475091577f, 0.152509838f},
-std::array<float,2>{0.361492395f, 0.617851317f},
-std::array<float,2>{0.84173125f, 0.0258127246f},
-std::array<float,2>{0.537266731f, 0.902738988f},
-std::array<float,2>{0.0758514851f, 0.421649814f},
-std::array<float,2>{0.000259438675f, 0.721504211f},
-std::array<float,2>{0.598995745f, 0.224617705f},
-std::array<float,2>{0.757803679f, 0.798426688f},
-std::array<float,2>{0.286842763f, 0.291000426f},
-std::array<float,2>{0.408728778f, 0.944498897f},
-std::array<float,2>{0.91424346f, 0.457914799f},
-std::array<float,2>{0.707988024f, 0.551054299f},
-std::array<float,2>{0.147813246f, 0.0972092897f},
-std::array<float,2>{0.115280069f, 0.917723656f},
-std::array<float,2>{0.505310833f, 0.398375332f},
-std::array<float,2>{0.85733366f, 0.592825472f},
-std::array<float,2>{0.332704514f, 0.0500688553f},
-std::array<float,2>{0.459159672f, 0.669146597f},
-std::array<float,2>{0.973461688f, 0.169946685f},
-std::array<float,2>{0.684003651f, 0.82345438f},
-std::array<float,2>{0.232316583f, 0.312904477f},
-std::array<float,2>{0.171176121f, 0.512136817f},
-std::array<float,2>{0.733977199f, 0.0705495328f},
-std::array<float,2>{0.89082557f, 0.977852345f},
-std::array<float,2>{0.400501221f, 0.489234895f},
-std::array<float,2>{0.255750209f, 0.763070107f},
-std::array<float,2>{0.807743609f, 0.268013865f},
-std::array<float,2>{0.59119308f, 0.712075412f},
-std::array<float,2>{0.0347079635f, 0.207992002f},
-std::array<float,2>{0.132150263f, 0.997815967f},
-std::array<float,2>{0.692257047f, 0.472912341f},
-std::array<float,2>{0.935895681f, 0.516309202f},
-std::array<float,2>{0.433372408f, 0.0882654414f},
-std::array<float,2>{0.300505936f, 0.687606931f},
-std::array<float,2>{0.78006798f, 0.196994528f},
-std::array<float,2>{0.622018456f, 0.771591306f},
-std::array<float,2>{0.0219414234f, 0.261988223f},
-std::array<float,2>{0.0926106572f, 0.576598108f},
-std::array<float,2>{0.558242083f, 0.0447442718f},
-std::array<float,2>{0.819404602f, 0.929592431f},
-std::array<float,2>{0.348182708f, 0.389359415f},
-std::array<float,2>{0.498301297f, 0.837577701f},
-std::array<float,2>{0.956258416f, 0.343037069f},
-std::array<float,2>{0.655219972f, 0.679985821f},
-std::array<float,2>{0.201762021f, 0.185110718f},
-std::array<float,2>{0.0537989177f, 0.788538516f},
-std::array<float,2>{0.563739598f, 0.307648391f},
-std::array<float,2>{0.796351314f, 0.734772265f},
-std::array<float,2>{0.274740785f, 0.24729231f},
-std::array<float,2>{0.386878729f, 0.541486979f},
-std::array<float,2>{0.883579731f, 0.121579483f},
-std::array<float,2>{0.749299526f, 0.967459321f},
-std::array<float,2>{0.182433084f, 0.442366362f},
-std::array<float,2>{0.239522815f, 0.649464607f},
-std::array<float,2>{0.66204226f, 0.132533789f},
-std::array<float,2>{0.988915086f, 0.864683151f},
-std::array<float,2>{0.451335549f, 0.352492243f},
-std::array<float,2>{0.319595546f, 0.889828384f},
-std::array<float,2>{0.866357267f, 0.428103387f},
-std::array<float,2>{0.519625664f, 0.598417699f},
-std::array<float,2>{0.109268129f, 0.00474334043f},
-std::array<float,2>{0.24953112f, 0.802208781f},
-std::array<float,2>{0.667974055f, 0.296039969f},
-std::array<float,2>{0.995579064f, 0.726379931f},
-std::array<float,2>{0.441352397f, 0.218878672f},
-std::array<float,2>{0.320549339f, 0.549597025f},
-std::array<float,2>{0.872296631f, 0.0985395312f},
-std::array<float,2>{0.526108265f, 0.940574646f},
-std::array<float,2>{0.0963615254f, 0.456351757f},
-std::array<float,2>{0.0592488982f, 0.628083587f},
-std::array<float,2>{0.577077627f, 0.149200991f},
-std::array<float,2>{0.781907618f, 0.848041296f},
-std::array<float,2>{0.27064538f, 0.370889843f},
-std::array<float,2>{0.378222406f, 0.898899853f},
-std::array<float,2>{0.882632375f, 0.415289342f},
-std::array<float,2>{0.735213399f, 0.623709023f},
-std::array<float,2>{0.175895557f, 0.0311886463f},
-std::array<float,2>{0.0847713873f, 0.983846426f},
-std::array<float,2>{0.547844231f, 0.48664099f},
-std::array<float,2>{0.827799201f, 0.51126039f},
-std::array<float,2>{0.356810629f, 0.0760970861f},
-std::array<float,2>{0.484493285f, 0.715477347f},
-std::array<float,2>{0.966588497f, 0.206477523f},
-std::array<float,2>{0.648142099f, 0.759330809f},
-std::array<float,2>{0.194410279f, 0.270832032f},
-std::array<float,2>{0.139360711f, 0.58802551f},
-std::array<float,2>{0.702815533f, 0.0536802374f},
-std::array<float,2>{0.928018212f, 0.919798136f},
-std::array<float,2>{0.42545718f, 0.392330796f},
-std::array<float,2>{0.309898436f, 0.827496409f},
-std::array<float,2>{0.767156541f, 0.316423833f},
-std::array<float,2>{0.611606896f, 0.665129662f},
-std::array<float,2>{0.0275773667f, 0.165624425f},
-std::array<float,2>{0.159711212f, 0.925085723f},
-std::array<float,2>{0.719089985f, 0.385266721f},
-std::array<float,2>{0.901365936f, 0.574146271f},
-std::array<float,2>{0.393917292f, 0.0424468927f},
-std::array<float,2>{0.25852859f, 0.683766603f},
-std::array<float,2>{0.803223193f, 0.181389064f},
-std::array<float,2>{0.584259927f, 0.841309845f},
-std::array<float,2>{0.0427145548f, 0.338699758f},
-std::array<float,2>{0.123583004f, 0.521178842f},
-std::array<float,2>{0.513573885f, 0.0925446898f},
-std::array<float,2>{0.845672488f, 0.995330036f},
-std::array<float,2>{0.339591801f, 0.472024024f},
-std::array<float,2>{0.46344918f, 0.768272758f},
-std::array<float,2>{0.983235717f, 0.260043234f},
-std::array<float,2>{0.673852623f, 0.693526208f},
-std::array<float,2>{0.224136338f, 0.199298427f},
-std::array<float,2>{0.00918888394f, 0.860652983f},
-std::array<float,2>{0.605295539f, 0.35861513f},
-std::array<float,2>{0.764430404f, 0.655513525f},
-std::array<float,2>{0.289638281f, 0.126012161f},
-std::array<float,2>{0.417446762f, 0.59627068f},
-std::array<float,2>{0.907541215f, 0.00249924464f},
-std::array<float,2>{0.713207841f, 0.886170208f},
-std::array<float,2>{0.151640192f, 0.422378957f},
-std::array<float,2>{0.210598499f, 0.739456832f},
-std::array<float,2>{0.633828342f, 0.245346561f},
-std::array<float,2>{0.948386729f, 0.781733096f},
-std::array<float,2>{0.477599263f, 0.309867978f},
-std::array<float,2>{0.368574977f, 0.962417424f},
-std::array<float,2>{0.831693649f, 0.438061059f},
-std::array<float,2>{0.540104985f, 0.543622553f},
-std::array<float,2>{0.0641955584f, 0.120934732f},
-std::array<float,2>{0.141129062f, 0.82985276f},
-std::array<float,2>{0.703294694f, 0.333342582f},
-std::array<float,2>{0.920435607f, 0.675921142f},
-std::array<float,2>{0.411689043f, 0.17515032f},
-std::array<float,2>{0.283969641f, 0.570227563f},
-std::array<float,2>{0.75125879f, 0.0334460661f},
-std::array<float,2>{0.597517431f, 0.936879814f},
-std::array<float,2>{0.00506035611f, 0.379429668f},
-std::array<float,2>{0.0733439624f, 0.700610578f},
-std::array<float,2>{0.532257736f, 0.19079791f},
-std::array<float,2>{0.837982297f, 0.774235547f},
-std::array<float,2>{0.365145415f, 0.254024714f},
-std::array<float,2>{0.471096992f, 0.985561848f},
-std::array<float,2>{0.942382932f, 0.478721708f},
-std::array<float,2>{0.628838062f, 0.524711013f},
-std::array<float,2>{0.217899278f, 0.0857350454f},
-std::array<float,2>{0.0370298587f, 0.876262903f},
-std::array<float,2>{0.587982774f, 0.436786383f},
-std::array<float,2>{0.810115218f, 0.602426052f},
-std::array<float,2>{0.252203196f, 0.0112661682f},
-std::array<float,2>{0.404724211f, 0.64358288f},
-std::array<float,2>{0.896726906f, 0.136417434f},
-std::array<float,2>{0.729424238f, 0.874515295f},
-std::array<float,2>{0.167365655f, 0.346291542f},
-std::array<float,2>{0.228696629f, 0.533198893f},
-std::array<float,2>{0.681524158f, 0.114559621f},
-std::array<float,2>{0.968898416f, 0.95430392f},
-std::array<float,2>{0.456145912f, 0.448351294f},
-std::array<float,2>{0.328845233f, 0.79036957f},
-std::array<float,2>{0.851830542f, 0.299273968f},
-std::array<float,2>{0.500527501f, 0.745894313f},
-std::array<float,2>{0.112030961f, 0.238253191f},
-std::array<float,2>{0.196207568f, 0.946105301f},
-std::array<float,2>{0.651156962f, 0.466480553f},
-std::array<float,2>{0.960388601f, 0.555107772f},
-std::array<float,2>{0.49338156f, 0.103272632f},
-std::array<float,2>{0.346227437f, 0.729447663f},
-std::array<float,2>{0.814617753f, 0.231382638f},
-std::array<float,2>{0.55942595f, 0.804870844f},
-std::array<float,2>{0.0868041366f, 0.286750048f},
-std::array<float,2>{0.0175078623f, 0.615913868f},
-std::array<float,2>{0.617976844f, 0.0218491293f},
-std::array<float,2>{0.776550174f, 0.89799577f},
-std::array<float,2>{0.303710401f, 0.411083877f},
-std::array<float,2>{0.433647245f, 0.857735574f},
-std::array<float,2>{0.932282686f, 0.362811714f},
-std::array<float,2>{0.690334737f, 0.633668602f},
-std::array<float,2>{0.125268251f, 0.143563733f},
-std::array<float,2>{0.102673203f, 0.756937802f},
-std::array<float,2>{0.518850684f, 0.27426216f},
-std::array<float,2>{0.862315059f, 0.709826052f},
-std::array<float,2>{0.315032661f, 0.211300462f},
-std::array<float,2>{0.447639108f, 0.502731323f},
-std::array<float,2>{0.987871051f, 0.0634894073f},
-std::array<float,2>{0.656848311f, 0.974850118f},
-std::array<float,2>{0.235571459f, 0.49964112f},
-std::array<float,2>{0.185158104f, 0.662963212f},
-std::array<float,2>{0.744517446f, 0.163433313f},
-std::array<float,2>{0.889908612f, 0.817569375f},
-std::array<float,2>{0.383072495f, 0.324711204f},
-std::array<float,2>{0.281072617f, 0.908526242f},
-std::array<float,2>{0.79181236f, 0.399609625f},
-std::array<float,2>{0.56679368f, 0.584470212f},
-std::array<float,2>{0.0493594743f, 0.0587040745f},
-std::array<float,2>{0.153143227f, 0.751552165f},
-std::array<float,2>{0.716564715f, 0.27792412f},
-std::array<float,2>{0.913819373f, 0.70504725f},
-std::array<float,2>{0.419432908f, 0.215156585f},
-std::array<float,2>{0.293483824f, 0.505909979f},
-std::array<float,2>{0.758555472f, 0.0690122992f},
-std::array<float,2>{0.606327772f, 0.969709396f},
-std::array<float,2>{0.013227676f, 0.495244533f},
-std::array<float,2>{0.0695866421f, 0.657597661f},
-std::array<float,2>{0.545429945f, 0.159756303f},
-std::array<float,2>{0.832688093f, 0.813648582f},
-std::array<float,2>{0.372608185f, 0.3214055f},
-std::array<float,2>{0.48125276f, 0.91077286f},
-std::array<float,2>{0.951699376f, 0.405966252f},
-std::array<float,2>{0.639496148f, 0.579762638f},
-std::array<float,2>{0.204134986f, 0.0556568392f},
-std::array<float,2>{0.0434295684f, 0.951726794f},
-std::array<float,2>{0.581746221f, 0.464066565f},
-std::array<float,2>{0.797263026f, 0.5616045f},
-std::array<float,2>{0.262436986f, 0.106845915f},
-std::array<float,2>{0.396498561f, 0.734215736f},
-std::array<float,2>{0.902796447f, 0.2299252f},
-std::array<float,2>{0.725184321f, 0.812487483f},
-std::array<float,2>{0.160215691f, 0.281941265f},
-std::array<float,2>{0.221524164f, 0.609800518f},
-std::array<float,2>{0.678503036f, 0.0183211993f},
-std::array<float,2>{0.97996515f, 0.893958569f},
-std::array<float,2>{0.466790259f, 0.409948409f},
-std::array<float,2>{0.341671914f, 0.854246616f},
-std::array<float,2>{0.850453734f, 0.367109358f},
-std::array<float,2>{0.50845474f, 0.637362719f},
-std::array<float,2>{0.117738903f, 0.146744877f},
-std::array<float,2>{0.188101694f, 0.882390916f},
-std::array<float,2>{0.644321859f, 0.433591098f},
-std::array<float,2>{0.962551355f, 0.60842675f},
-std::array<float,2>{0.489214361f, 0.0121436333f},
-std::array<float,2>{0.354681998f, 0.6456545f},
-std::array<float,2>{0.821931422f, 0.137104809f},
-std::array<float,2>{0.554653764f, 0.868403912f},
-std::array<float,2>{0.0792640969f, 0.349903792f},
-std::array<float,2>{0.0235563181f, 0.538441062f},
-std::array<float,2>{0.614514112f, 0.112595335f},
-std::array<float,2>{0.772990525f, 0.957514048f},
-std::array<float,2>{0.308435887f, 0.452268243f},
-std::array<float,2>{0.42924425f, 0.795858562f},
-std::array<float,2>{0.92256242f, 0.303454518f},
-std::array<float,2>{0.69605422f, 0.747299433f},
-std::array<float,2>{0.135213643f, 0.242025152f},
-std::array<float,2>{0.0986400396f, 0.832525074f},
-std::array<float,2>{0.529889286f, 0.330269903f},
-std::array<float,2>{0.869440913f, 0.675642729f},
-std::array<float,2>{0.325602174f, 0.176263049f},
-std::array<float,2>{0.442940503f, 0.56457454f},
-std::array<float,2>{0.997025609f, 0.0352051966f},
-std::array<float,2>{0.667634964f, 0.932588756f},
-std::array<float,2>{0.2430107f, 0.378608078f},
-std::array<float,2>{0.172371238f, 0.696214736f},
-std::array<float,2>{0.74142009f, 0.193407491f},
-std::array<float,2>{0.875191152f, 0.779708266f},
-std::array<float,2>{0.382138342f, 0.250607163f},
-std::array<float,2>{0.266080946f, 0.989696741f},
-std::array<float,2>{0.787715673f, 0.484222889f},
-std::array<float,2>{0.572242677f, 0.530070961f},
-std::array<float,2>{0.0551135093f, 0.0817195028f},
-std::array<float,2>{0.240523472f, 0.863828599f},
-std::array<float,2>{0.663902164f, 0.353056252f},
-std::array<float,2>{0.9918046f, 0.649069548f},
-std::array<float,2>{0.449361235f, 0.130964398f},
-std::array<float,2>{0.316622317f, 0.599406481f},
-std::array<float,2>{0.863962531f, 0.00503569795f},
-std::array<float,2>{0.521734536f, 0.888855577f},
-std::array<float,2>{0.107214816f, 0.429183185f},
-std::array<float,2>{0.0517617315f, 0.735857368f},
-std::array<float,2>{0.564954937f, 0.246880636f},
-std::array<float,2>{0.793780625f, 0.787186742f},
-std::array<float,2>{0.276646763f, 0.307445526f},
-std::array<float,2>{0.389561117f, 0.968438745f},
-std::array<float,2>{0.885635078f, 0.442816705f},
-std::array<float,2>{0.747352123f, 0.542781711f},
-std::array<float,2>{0.180481642f, 0.122525811f},
-std::array<float,2>{0.0899858549f, 0.928657293f},
-std::array<float,2>{0.555704713f, 0.390447289f},
-std::array<float,2>{0.817099214f, 0.577203214f},
-std::array<float,2>{0.350620687f, 0.043224439f},
-std::array<float,2>{0.496462733f, 0.68157655f},
-std::array<float,2>{0.954704225f, 0.184133515f},
-std::array<float,2>{0.653404474f, 0.836701691f},
-std::array<float,2>{0.200799346f, 0.342170119f},
-std::array<float,2>{0.129586712f, 0.517543256f},
-std::array<float,2>{0.694673479f, 0.0889476016f},
-std::array<float,2>{0.934899509f, 0.99681741f},
-std::array<float,2>{0.430313796f, 0.473895997f},
-std::array<float,2>{0.297837377f, 0.773026645f},
-std::array<float,2>{0.777889848f, 0.262972623f},
-std::array<float,2>{0.623208225f, 0.688779414f},
-std::array<float,2>{0.0200985782f, 0.195668593f},
-std::array<float,2>{0.168699533f, 0.977510989f},
-std::array<float,2>{0.731765151f, 0.489550352f},
-std::array<float,2>{0.893562317f, 0.513035238f},
-std::array<float,2>{0.399046987f, 0.0718061998f},
-std::array<float,2>{0.257427543f, 0.711097777f},
-std::array<float,2>{0.806308448f, 0.208601847f},
-std::array<float,2>{0.592214882f, 0.762485266f},
-std::array<float,2>{0.0319896527f, 0.26918456f},
-std::array<float,2>{0.114473738f, 0.591885209f},
-std::array<float,2>{0.506035686f, 0.0497945882f},
-std::array<float,2>{0.858782768f, 0.916634381f},
-std::array<float,2>{0.33540833f, 0.397074044f},
-std::array<float,2>{0.45773527f, 0.822516143f},
-std::array<float,2>{0.976410985f, 0.314042538f},
-std::array<float,2>{0.687196255f, 0.668287873f},
-std::array<float,2>{0.232568294f, 0.171312809f},
-std::array<float,2>{0.0033757207f, 0.797255397f},
-std::array<float,2>{0.600323617f, 0.289557904f},
-std::array<float,2>{0.754959643f, 0.721778154f},
-std::array<float,2>{0.288354158f, 0.225860909f},
-std::array<float,2>{0.407158136f, 0.552697003f},
-std::array<float,2>{0.917230487f, 0.095809862f},
-std::array<float,2>{0.710591316f, 0.943623781f},
-std::array<float,2>{0.144589111f, 0.458765507f},
-std::array<float,2>{0.211029753f, 0.630563021f},
-std::array<float,2>{0.63219291f, 0.153934479f},
-std::array<float,2>{0.939436972f, 0.846506357f},
-std::array<float,2>{0.472842306f, 0.371551126f},
-std::array<float,2>{0.359441578f, 0.903670371f},
-std::array<float,2>{0.843615174f, 0.420405716f},
-std::array<float,2>{0.535910368f, 0.618230104f},
-std::array<float,2>{0.0780086964f, 0.0268835593f},
-std::array<float,2>{0.208093122f, 0.7828511f},
-std::array<float,2>{0.635887146f, 0.308754057f},
-std::array<float,2>{0.94598341f, 0.738523126f},
-std::array<float,2>{0.480286568f, 0.2447979f},
-std::array<float,2>{0.370120406f, 0.544510722f},
-std::array<float,2>{0.829243839f, 0.119185112f},
-std::array<float,2>{0.541824996f, 0.961506307f},
-std::array<float,2>{0.0659335852f, 0.439282447f},
-std::array<float,2>{0.0111125605f, 0.654785633f},
-std::array<float,2>{0.603081226f, 0.125154808f},
-std::array<float,2>{0.761899889f, 0.860128164f},
-std::array<float,2>{0.292280406f, 0.357812911f},
-std::array<float,2>{0.414624214f, 0.885654509f},
-std::array<float,2>{0.908801198f, 0.423390478f},
-std::array<float,2>{0.711876869f, 0.596826494f},
-std::array<float,2>{0.148557425f, 0.0034204307f},
-std::array<float,2>{0.12185026f, 0.994421005f},
-std::array<float,2>{0.514944255f, 0.470804393f},
-std::array<float,2>{0.846134841f, 0.520046949f},
-std::array<float,2>{0.33636421f, 0.0930258781f},
-std::array<float,2>{0.461275905f, 0.695285201f},
-std::array<float,2>{0.982061803f, 0.201156363f},
-std::array<float,2>{0.673069477f, 0.769001603f},
-std::array<float,2>{0.225793242f, 0.261641145f},
-std::array<float,2>{0.158188745f, 0.572917104f},
-std::array<float,2>{0.721994042f, 0.0411909446f},
-std::array<float,2>{0.899627745f, 0.924614847f},
-std::array<float,2>{0.392389923f, 0.386480123f},
-std::array<float,2>{0.26147908f, 0.839963973f},
-std::array<float,2>{0.802102208f, 0.339529991f},
-std::array<float,2>{0.58326906f, 0.684706748f},
-std::array<float,2>{0.0403813496f, 0.179892018f},
-std::array<float,2>{0.137983024f, 0.918066621f},
-std::array<float,2>{0.700331986f, 0.391023964f},
-std::array<float,2>{0.927509129f, 0.589201391f},
-std::array<float,2>{0.423209608f, 0.054220777f},
-std::array<float,2>{0.310890943f, 0.664446294f},
-std::array<float,2>{0.768520951f, 0.164657503f},
-std::array<float,2>{0.609665453f, 0.826471865f},
-std::array<float,2>{0.0293524582f, 0.318279803f},
-std::array<float,2>{0.0833776221f, 0.509957552f},
-std::array<float,2>{0.549300492f, 0.0744087994f},
-std::array<float,2>{0.82457912f, 0.98244673f},
-std::array<float,2>{0.358305246f, 0.488173664f},
-std::array<float,2>{0.487825245f, 0.758498847f},
-std::array<float,2>{0.967356861f, 0.269711316f},
-std::array<float,2>{0.645504713f, 0.716163576f},
-std::array<float,2>{0.191947371f, 0.205397218f},
-std::array<float,2>{0.0607266724f, 0.848840058f},
-std::array<float,2>{0.574817777f, 0.369853348f},
-std::array<float,2>{0.784207642f, 0.627773106f},
-std::array<float,2>{0.273228109f, 0.149721473f},
-std::array<float,2>{0.376243293f, 0.624542952f},
-std::array<float,2>{0.879081964f, 0.0295705572f},
-std::array<float,2>{0.737810969f, 0.900215328f},
-std::array<float,2>{0.178099602f, 0.414105177f},
-std::array<float,2>{0.247536182f, 0.724690318f},
-std::array<float,2>{0.670849919f, 0.22058849f},
-std::array<float,2>{0.992659152f, 0.801235914f},
-std::array<float,2>{0.437840223f, 0.294944197f},
-std::array<float,2>{0.322282612f, 0.93999362f},
-std::array<float,2>{0.873580456f, 0.45579499f},
-std::array<float,2>{0.525202572f, 0.550053537f},
-std::array<float,2>{0.09380164f, 0.0988675207f},
-std::array<float,2>{0.186002329f, 0.81723845f},
-std::array<float,2>{0.743951797f, 0.325345218f},
-std::array<float,2>{0.887584925f, 0.663248241f},
-std::array<float,2>{0.385238975f, 0.162948504f},
-std::array<float,2>{0.279269904f, 0.58570528f},
-std::array<float,2>{0.790585518f, 0.0597495399f},
-std::array<float,2>{0.568836331f, 0.909557581f},
-std::array<float,2>{0.0485670567f, 0.398718357f},
-std::array<float,2>{0.10528931f, 0.710391343f},
-std::array<float,2>{0.517318666f, 0.212844849f},
-std::array<float,2>{0.860398948f, 0.756063104f},
-std::array<float,2>{0.312976509f, 0.274889171f},
-std::array<float,2>{0.446348131f, 0.975788295f},
-std::array<float,2>{0.986320734f, 0.49822858f},
-std::array<float,2>{0.658913314f, 0.503031194f},
-std::array<float,2>{0.236981124f, 0.0628614947f},
-std::array<float,2>{0.0177401528f, 0.896627069f},
-std::array<float,2>{0.619623303f, 0.411689699f},
-std::array<float,2>{0.77389133f, 0.616215408f},
-std::array<float,2>{0.301145107f, 0.0227346532f},
-std::array<float,2>{0.435813904f, 0.634504855f},
-std::array<float,2>{0.931193888f, 0.1427311f},
-std::array<float,2>{0.687514901f, 0.858590186f},
-std::array<float,2>{0.128003538f, 0.361587048f},
-std::array<float,2>{0.197468102f, 0.555954576f},
-std::array<float,2>{0.648586631f, 0.102500707f},
-std::array<float,2>{0.958224833f, 0.94672215f},
-std::array<float,2>{0.495343506f, 0.465356648f},
-std::array<float,2>{0.344518989f, 0.806504369f},
-std::array<float,2>{0.814157605f, 0.285875797f},
-std::array<float,2>{0.561433077f, 0.729995251f},
-std::array<float,2>{0.0893522501f, 0.232285246f},
-std::array<float,2>{0.227270722f, 0.953391314f},
-std::array<float,2>{0.682192504f, 0.447831094f},
-std::array<float,2>{0.97151798f, 0.532018721f},
-std::array<float,2>{0.454150885f, 0.114147745f},
-std::array<float,2>{0.331041038f, 0.745110333f},
-std::array<float,2>{0.85500735f, 0.236728117f},
-std::array<float,2>{0.502709389f, 0.789391518f},
-std::array<float,2>{0.110098109f, 0.300640702f},
-std::array<float,2>{0.0385573395f, 0.603188515f},
-std::array<float,2>{0.586678922f, 0.0100468816f},
-std::array<float,2>{0.812258124f, 0.875149012f},
-std::array<float,2>{0.25017184f, 0.436190993f},
-std::array<float,2>{0.40331766f, 0.873520076f},
-std::array<float,2>{0.895993829f, 0.346711457f},
-std::array<float,2>{0.727440596f, 0.642767906f},
-std::array<float,2>{0.165351227f, 0.135073528f},
-std::array<float,2>{0.0718111098f, 0.774546564f},
-std::array<float,2>{0.534321308f, 0.255605429f},
-std::array<float,2>{0.836933732f, 0.699235737f},
-std::array<float,2>{0.366298348f, 0.190214753f},
-std::array<float,2>{0.469349205f, 0.523905516f},
-std::array<float,2>{0.944035828f, 0.0845141038f},
-std::array<float,2>{0.626854777f, 0.984856427f},
-std::array<float,2>{0.215464965f, 0.479727834f},
-std::array<float,2>{0.143300787f, 0.6773476f},
-std::array<float,2>{0.706698775f, 0.174782798f},
-std::array<float,2>{0.918239594f, 0.828222215f},
-std::array<float,2>{0.413654923f, 0.332494348f},
-std::array<float,2>{0.282143205f, 0.935840547f},
-std::array<float,2>{0.753457844f, 0.38018316f},
-std::array<float,2>{0.595119894f, 0.569108069f},
-std::array<float,2>{0.00597742386f, 0.034426935f},
-std::array<float,2>{0.163209245f, 0.810340166f},
-std::array<float,2>{0.722849369f, 0.284775525f},
-std::array<float,2>{0.904928446f, 0.731598556f},
-std::array<float,2>{0.395495176f, 0.227957755f},
-std::array<float,2>{0.263761014f, 0.558691502f},
-std::array<float,2>{0.800454617f, 0.109322272f},
-std::array<float,2>{0.578506708f, 0.950442612f},
-std::array<float,2>{0.0459264517f, 0.462209582f},
-std::array<float,2>{0.120589361f, 0.639828026f},
-std::array<float,2>{0.510975063f, 0.146148145f},
-std::array<float,2>{0.849485397f, 0.852431715f},
-std::array<float,2>{0.341938555f, 0.364519179f},
-std::array<float,2>{0.468474418f, 0.891941965f},
-std::array<float,2>{0.976986408f, 0.406603038f},
-std::array<float,2>{0.676869035f, 0.611901999f},
-std::array<float,2>{0.220528007f, 0.0160815455f},
-std::array<float,2>{0.0146646416f, 0.972238243f},
-std::array<float,2>{0.608281791f, 0.493840456f},
-std::array<float,2>{0.761088192f, 0.504977882f},
-std::array<float,2>{0.296741396f, 0.0683389604f},
-std::array<float,2>{0.420226276f, 0.705685198f},
-std::array<float,2>{0.910309315f, 0.217107311f},
-std::array<float,2>{0.718292058f, 0.751996934f},
-std::array<float,2>{0.155913413f, 0.280353695f},
-std::array<float,2>{0.206416741f, 0.58042711f},
-std::array<float,2>{0.638236403f, 0.0574619994f},
-std::array<float,2>{0.949352741f, 0.91284734f},
-std::array<float,2>{0.483277708f, 0.403265029f},
-std::array<float,2>{0.37343201f, 0.814875722f},
-std::array<float,2>{0.835028887f, 0.322621405f},
-std::array<float,2>{0.544564366f, 0.658521533f},
-std::array<float,2>{0.0676602945f, 0.157054827f},
-std::array<float,2>{0.245607704f, 0.929968238f},
-std::array<float,2>{0.664618254f, 0.376037389f},
-std::array<float,2>{0.999124646f, 0.564376414f},
-std::array<float,2>{0.444851398f, 0.038989719f},
-std::array<float,2>{0.326571196f, 0.672399759f},
-std::array<float,2>{0.867446482f, 0.178314343f},
-std::array<float,2>{0.528093338f, 0.835131109f},
-std::array<float,2>{0.100749567f, 0.329753786f},
-std::array<float,2>{0.0579578429f, 0.528007269f},
-std::array<float,2>{0.573269188f, 0.0789034218f},
-std::array<float,2>{0.785950124f, 0.991636395f},
-std::array<float,2>{0.268132269f, 0.481242597f},
-std::array<float,2>{0.379621983f, 0.777506173f},
-std::array<float,2>{0.877464712f, 0.252342314f},
-std::array<float,2>{0.739482522f, 0.697671354f},
-std::array<float,2>{0.17399691f, 0.192155316f},
-std::array<float,2>{0.0805434287f, 0.869158328f},
-std::array<float,2>{0.552516997f, 0.348686576f},
-std::array<float,2>{0.822924733f, 0.647461891f},
-std::array<float,2>{0.353182852f, 0.139127836f},
-std::array<float,2>{0.490899056f, 0.606659412f},
-std::array<float,2>{0.964507163f, 0.0136953117f},
-std::array<float,2>{0.640843511f, 0.879381597f},
-std::array<float,2>{0.190254614f, 0.430497259f},
-std::array<float,2>{0.133356586f, 0.748329997f},
-std::array<float,2>{0.698044777f, 0.240200937f},
-std::array<float,2>{0.925020158f, 0.793864191f},
-std::array<float,2>{0.427715421f, 0.301783472f},
-std::array<float,2>{0.30551371f, 0.959457457f},
-std::array<float,2>{0.771010399f, 0.449471444f},
-std::array<float,2>{0.615288794f, 0.535342336f},
-std::array<float,2>{0.0264756288f, 0.110475726f},
-std::array<float,2>{0.202743307f, 0.839422464f},
-std::array<float,2>{0.656120241f, 0.340094537f},
-std::array<float,2>{0.955111265f, 0.683558345f},
-std::array<float,2>{0.499559909f, 0.186557725f},
-std::array<float,2>{0.349571019f, 0.575539529f},
-std::array<float,2>{0.819024444f, 0.0449221283f},
-std::array<float,2>{0.556870103f, 0.927659631f},
-std::array<float,2>{0.0932174101f, 0.386919975f},
-std::array<float,2>{0.023168033f, 0.690214694f},
-std::array<float,2>{0.622817099f, 0.198945716f},
-std::array<float,2>{0.780938566f, 0.770428538f},
-std::array<float,2>{0.299415112f, 0.264672786f},
-std::array<float,2>{0.432291299f, 0.999748051f},
-std::array<float,2>{0.936800778f, 0.476271391f},
-std::array<float,2>{0.692495883f, 0.519025564f},
-std::array<float,2>{0.131662399f, 0.0860164016f},
-std::array<float,2>{0.107497551f, 0.887940645f},
-std::array<float,2>{0.520592868f, 0.427458644f},
-std::array<float,2>{0.865754783f, 0.599778056f},
-std::array<float,2>{0.319034159f, 0.00619298778f},
-std::array<float,2>{0.452385336f, 0.651726961f},
-std::array<float,2>{0.989522457f, 0.130563319f},
-std::array<float,2>{0.660382569f, 0.866350532f},
-std::array<float,2>{0.239120975f, 0.355382532f},
-std::array<float,2>{0.182632655f, 0.540398598f},
-std::array<float,2>{0.74859041f, 0.124542125f},
-std::array<float,2>{0.884704769f, 0.96612817f},
-std::array<float,2>{0.388482332f, 0.443797141f},
-std::array<float,2>{0.273655087f, 0.786449552f},
-std::array<float,2>{0.795197248f, 0.305304497f},
-std::array<float,2>{0.563432872f, 0.736690283f},
-std::array<float,2>{0.053271722f, 0.249654919f},
-std::array<float,2>{0.146549895f, 0.942890525f},
-std::array<float,2>{0.70841527f, 0.460648507f},
-std::array<float,2>{0.915404618f, 0.553795636f},
-std::array<float,2>{0.40939942f, 0.0944927707f},
-std::array<float,2>{0.285667896f, 0.718882024f},
-std::array<float,2>{0.755975783f, 0.223349467f},
-std::array<float,2>{0.598368645f, 0.799456477f},
-std::array<float,2>{0.00193709217f, 0.291782886f},
-std::array<float,2>{0.0749478191f, 0.620413601f},
-std::array<float,2>{0.538190126f, 0.02531185f},
-std::array<float,2>{0.840211034f, 0.905470669f},
-std::array<float,2>{0.363229841f, 0.419412524f},
-std::array<float,2>{0.475842386f, 0.844632328f},
-std::array<float,2>{0.940039992f, 0.374386638f},
-std::array<float,2>{0.630452573f, 0.63279295f},
-std::array<float,2>{0.213065907f, 0.155543372f},
-std::array<float,2>{0.0338627286f, 0.764840066f},
-std::array<float,2>{0.590541244f, 0.266584992f},
-std::array<float,2>{0.807602286f, 0.713960648f},
-std::array<float,2>{0.254734397f, 0.209713429f},
-std::array<float,2>{0.40137431f, 0.515560865f},
-std::array<float,2>{0.892486215f, 0.0738528892f},
-std::array<float,2>{0.732832015f, 0.979641736f},
-std::array<float,2>{0.170719072f, 0.490994841f},
-std::array<float,2>{0.230848417f, 0.670584977f},
-std::array<float,2>{0.685542107f, 0.168418288f},
-std::array<float,2>{0.97382015f, 0.820788026f},
-std::array<float,2>{0.460855812f, 0.31463927f},
-std::array<float,2>{0.333608121f, 0.914219022f},
-std::array<float,2>{0.855780542f, 0.39615187f},
-std::array<float,2>{0.504764318f, 0.590569496f},
-std::array<float,2>{0.116549589f, 0.04769269f},
-std::array<float,2>{0.222722739f, 0.766425669f},
-std::array<float,2>{0.675197303f, 0.259202421f},
-std::array<float,2>{0.984250784f, 0.692333043f},
-std::array<float,2>{0.464593351f, 0.201980621f},
-std::array<float,2>{0.338125765f, 0.522368371f},
-std::array<float,2>{0.844573259f, 0.0905661508f},
-std::array<float,2>{0.51222229f, 0.993342638f},
-std::array<float,2>{0.124722175f, 0.469840527f},
-std::array<float,2>{0.0411060639f, 0.686430037f},
-std::array<float,2>{0.585744977f, 0.182647422f},
-std::array<float,2>{0.803737044f, 0.842386305f},
-std::array<float,2>{0.258819699f, 0.337374568f},
-std::array<float,2>{0.393223792f, 0.923274815f},
-std::array<float,2>{0.901939452f, 0.383465499f},
-std::array<float,2>{0.719790101f, 0.571871817f},
-std::array<float,2>{0.158679709f, 0.0401535779f},
-std::array<float,2>{0.0626703352f, 0.962907135f},
-std::array<float,2>{0.539990664f, 0.441170275f},
-std::array<float,2>{0.830509245f, 0.545805693f},
-std::array<float,2>{0.367697567f, 0.117861323f},
-std::array<float,2>{0.477327019f, 0.741979897f},
-std::array<float,2>{0.947749674f, 0.242580697f},
-std::array<float,2>{0.633608758f, 0.784935713f},
-std::array<float,2>{0.209525242f, 0.310598552f},
-std::array<float,2>{0.150393739f, 0.594332337f},
-std::array<float,2>{0.714278579f, 0.000339990773f},
-std::array<float,2>{0.906677783f, 0.884233594f},
-std::array<float,2>{0.41621238f, 0.425225765f},
-std::array<float,2>{0.290359795f, 0.862330019f},
-std::array<float,2>{0.765237212f, 0.35718286f},
-std::array<float,2>{0.604368508f, 0.654239833f},
-std::array<float,2>{0.00855183043f, 0.128027782f},
-std::array<float,2>{0.177188724f, 0.901058674f},
-std::array<float,2>{0.736282885f, 0.416183323f},
-std::array<float,2>{0.881655931f, 0.622815371f},
-std::array<float,2>{0.377384663f, 0.027365718f},
-std::array<float,2>{0.270147115f, 0.626875162f},
-std::array<float,2>{0.782333136f, 0.15191479f},
-std::array<float,2>{0.577374458f, 0.850583255f},
-std::array<float,2>{0.0595765859f, 0.36779508f},
-std::array<float,2>{0.0969395041f, 0.548627853f},
-std::array<float,2>{0.526624799f, 0.100042365f},
-std::array<float,2>{0.871581554f, 0.937959075f},
-std::array<float,2>{0.322121739f, 0.453348845f},
-std::array<float,2>{0.439607173f, 0.803979397f},
-std::array<float,2>{0.994582713f, 0.293393612f},
-std::array<float,2>{0.669289887f, 0.723137081f},
-std::array<float,2>{0.248520449f, 0.222626507f},
-std::array<float,2>{0.0291314404f, 0.825580299f},
-std::array<float,2>{0.613179386f, 0.32024917f},
-std::array<float,2>{0.765912771f, 0.667967141f},
-std::array<float,2>{0.309114277f, 0.167888686f},
-std::array<float,2>{0.424000889f, 0.587773681f},
-std::array<float,2>{0.929410219f, 0.0515649989f},
-std::array<float,2>{0.70158273f, 0.921712756f},
-std::array<float,2>{0.140012071f, 0.393078983f},
-std::array<float,2>{0.193513468f, 0.717599511f},
-std::array<float,2>{0.646535099f, 0.203934029f},
-std::array<float,2>{0.965581119f, 0.761572361f},
-std::array<float,2>{0.485364556f, 0.273367941f},
-std::array<float,2>{0.3561064f, 0.981319368f},
-std::array<float,2>{0.827134609f, 0.485406876f},
-std::array<float,2>{0.548437297f, 0.509470463f},
-std::array<float,2>{0.0849634334f, 0.0777198002f},
-std::array<float,2>{0.126333311f, 0.856554925f},
-std::array<float,2>{0.690618455f, 0.360797226f},
-std::array<float,2>{0.933193684f, 0.635555863f},
-std::array<float,2>{0.434901923f, 0.142046735f},
-std::array<float,2>{0.30404374f, 0.613761783f},
-std::array<float,2>{0.775727212f, 0.0197939891f},
-std::array<float,2>{0.619089186f, 0.895005286f},
-std::array<float,2>{0.0164315589f, 0.413979679f},
-std::array<float,2>{0.087477535f, 0.728444636f},
-std::array<float,2>{0.559947014f, 0.234140933f},
-std::array<float,2>{0.816010118f, 0.806695402f},
-std::array<float,2>{0.346979767f, 0.287984997f},
-std::array<float,2>{0.492293119f, 0.948002458f},
-std::array<float,2>{0.959739268f, 0.467916459f},
-std::array<float,2>{0.652089536f, 0.557892203f},
-std::array<float,2>{0.197248906f, 0.10475111f},
-std::array<float,2>{0.0505454838f, 0.906781495f},
-std::array<float,2>{0.568263471f, 0.401810795f},
-std::array<float,2>{0.792696178f, 0.582368672f},
-std::array<float,2>{0.280206501f, 0.0607893728f},
-std::array<float,2>{0.384563416f, 0.660556853f},
-std::array<float,2>{0.88941294f, 0.160308972f},
-std::array<float,2>{0.74580276f, 0.818522573f},
-std::array<float,2>{0.183901414f, 0.327341825f},
-std::array<float,2>{0.234473929f, 0.501159728f},
-std::array<float,2>{0.658055604f, 0.0646963939f},
-std::array<float,2>{0.986699462f, 0.97431314f},
-std::array<float,2>{0.448998988f, 0.496877819f},
-std::array<float,2>{0.315969735f, 0.754628479f},
-std::array<float,2>{0.861745656f, 0.276085466f},
-std::array<float,2>{0.518515229f, 0.707096756f},
-std::array<float,2>{0.101935111f, 0.214159533f},
-std::array<float,2>{0.217318833f, 0.986377716f},
-std::array<float,2>{0.627734423f, 0.477593929f},
-std::array<float,2>{0.942086756f, 0.52625984f},
-std::array<float,2>{0.471761465f, 0.0822589695f},
-std::array<float,2>{0.363455266f, 0.703060508f},
-std::array<float,2>{0.839168787f, 0.189215243f},
-std::array<float,2>{0.531596303f, 0.776316106f},
-std::array<float,2>{0.0728084967f, 0.257360846f},
-std::array<float,2>{0.00475177635f, 0.566631079f},
-std::array<float,2>{0.595783234f, 0.0317210853f},
-std::array<float,2>{0.750538409f, 0.934971452f},
-std::array<float,2>{0.284314752f, 0.382392883f},
-std::array<float,2>{0.410318434f, 0.831409752f},
-std::array<float,2>{0.921868265f, 0.334993631f},
-std::array<float,2>{0.704383433f, 0.678380787f},
-std::array<float,2>{0.142274618f, 0.173497453f},
-std::array<float,2>{0.112807453f, 0.791474044f},
-std::array<float,2>{0.50184989f, 0.297293425f},
-std::array<float,2>{0.852951229f, 0.742640495f},
-std::array<float,2>{0.329729438f, 0.235796377f},
-std::array<float,2>{0.455759048f, 0.533598542f},
-std::array<float,2>{0.970466197f, 0.11660739f},
-std::array<float,2>{0.680313468f, 0.955542922f},
-std::array<float,2>{0.23020345f, 0.44560492f},
-std::array<float,2>{0.166130215f, 0.642221451f},
-std::array<float,2>{0.729902864f, 0.133069634f},
-std::array<float,2>{0.897471845f, 0.872656822f},
-std::array<float,2>{0.405570984f, 0.344412357f},
-std::array<float,2>{0.253587276f, 0.877949297f},
-std::array<float,2>{0.808842003f, 0.434538543f},
-std::array<float,2>{0.589250743f, 0.60449183f},
-std::array<float,2>{0.0356637016f, 0.00963217299f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.122699253f, 0.870104253f},
-std::array<float,2>{0.769147336f, 0.411095113f},
-std::array<float,2>{0.68708235f, 0.672844648f},
-std::array<float,2>{0.294515818f, 0.0579267554f},
-std::array<float,2>{0.437731296f, 0.531534076f},
-std::array<float,2>{0.568903983f, 0.232155621f},
-std::array<float,2>{0.89689672f, 0.973781288f},
-std::array<float,2>{0.128034487f, 0.301908404f},
-std::array<float,2>{0.217563093f, 0.710591853f},
-std::array<float,2>{0.954611957f, 0.0976790935f},
-std::array<float,2>{0.52134949f, 0.799375236f},
-std::array<float,2>{0.429745376f, 0.452094615f},
-std::array<float,2>{0.34475702f, 0.884876251f},
-std::array<float,2>{0.703833222f, 0.335420787f},
-std::array<float,2>{0.870708704f, 0.610846937f},
-std::array<float,2>{0.0229496844f, 0.183492973f},
-std::array<float,2>{0.18306832f, 0.957084179f},
-std::array<float,2>{0.920071542f, 0.25139156f},
-std::array<float,2>{0.599051595f, 0.506410718f},
-std::array<float,2>{0.480860323f, 0.192285612f},
-std::array<float,2>{0.263724774f, 0.645860672f},
-std::array<float,2>{0.632244825f, 0.0129319262f},
-std::array<float,2>{0.792148471f, 0.821878016f},
-std::array<float,2>{0.0896045342f, 0.382453382f},
-std::array<float,2>{0.042995885f, 0.572890341f},
-std::array<float,2>{0.841679156f, 0.143084779f},
-std::array<float,2>{0.729282022f, 0.921286941f},
-std::array<float,2>{0.319025278f, 0.357684165f},
-std::array<float,2>{0.404591948f, 0.773279667f},
-std::array<float,2>{0.534155607f, 0.468969375f},
-std::array<float,2>{0.995132983f, 0.720657468f},
-std::array<float,2>{0.244837835f, 0.0677522048f},
-std::array<float,2>{0.0108750947f, 0.928274214f},
-std::array<float,2>{0.848259032f, 0.362611353f},
-std::array<float,2>{0.692103028f, 0.590658128f},
-std::array<float,2>{0.373989165f, 0.125382051f},
-std::array<float,2>{0.411612481f, 0.749176443f},
-std::array<float,2>{0.513949573f, 0.0857654437f},
-std::array<float,2>{0.95095396f, 0.760965109f},
-std::array<float,2>{0.194957539f, 0.499294847f},
-std::array<float,2>{0.142257571f, 0.527212799f},
-std::array<float,2>{0.887052774f, 0.217267215f},
-std::array<float,2>{0.586880445f, 0.944634974f},
-std::array<float,2>{0.466520905f, 0.267074436f},
-std::array<float,2>{0.301888824f, 0.82884866f},
-std::array<float,2>{0.659958899f, 0.403054476f},
-std::array<float,2>{0.751317918f, 0.634682894f},
-std::array<float,2>{0.104078442f, 0.0263778958f},
-std::array<float,2>{0.232549876f, 0.782834709f},
-std::array<float,2>{0.970354319f, 0.461700469f},
-std::array<float,2>{0.547653556f, 0.690246701f},
-std::array<float,2>{0.380235493f, 0.12291722f},
-std::array<float,2>{0.333628148f, 0.597761154f},
-std::array<float,2>{0.737032175f, 0.164376244f},
-std::array<float,2>{0.81292367f, 0.898807228f},
-std::array<float,2>{0.0559696704f, 0.324085057f},
-std::array<float,2>{0.0747106522f, 0.656609654f},
-std::array<float,2>{0.796884775f, 0.0427010469f},
-std::array<float,2>{0.648834229f, 0.850518465f},
-std::array<float,2>{0.26843071f, 0.433007151f},
-std::array<float,2>{0.49153766f, 0.985075831f},
-std::array<float,2>{0.613044977f, 0.290381372f},
-std::array<float,2>{0.924901366f, 0.559932709f},
-std::array<float,2>{0.163550571f, 0.234595031f},
-std::array<float,2>{0.0497326814f, 0.754476666f},
-std::array<float,2>{0.822589695f, 0.49009344f},
-std::array<float,2>{0.749106884f, 0.735921681f},
-std::array<float,2>{0.337678671f, 0.0870307237f},
-std::array<float,2>{0.385569513f, 0.585452557f},
-std::array<float,2>{0.557419479f, 0.137797087f},
-std::array<float,2>{0.977256238f, 0.931890249f},
-std::array<float,2>{0.226450369f, 0.374127269f},
-std::array<float,2>{0.168322355f, 0.626860201f},
-std::array<float,2>{0.931145549f, 0.0195452161f},
-std::array<float,2>{0.621322036f, 0.836989939f},
-std::array<float,2>{0.492689818f, 0.39687115f},
-std::array<float,2>{0.280555904f, 0.949053884f},
-std::array<float,2>{0.640686095f, 0.280765325f},
-std::array<float,2>{0.808508098f, 0.520208657f},
-std::array<float,2>{0.0668829978f, 0.206493914f},
-std::array<float,2>{0.20053646f, 0.897345245f},
-std::array<float,2>{0.939255834f, 0.312716544f},
-std::array<float,2>{0.504150987f, 0.606068432f},
-std::array<float,2>{0.419867665f, 0.15732199f},
-std::array<float,2>{0.364266336f, 0.69549793f},
-std::array<float,2>{0.701331317f, 0.112059727f},
-std::array<float,2>{0.858791053f, 0.789723217f},
-std::array<float,2>{0.00662059849f, 0.456157058f},
-std::array<float,2>{0.101018563f, 0.550075054f},
-std::array<float,2>{0.764653742f, 0.248993129f},
-std::array<float,2>{0.668854237f, 0.996246159f},
-std::array<float,2>{0.306537896f, 0.283797354f},
-std::array<float,2>{0.45461902f, 0.853684902f},
-std::array<float,2>{0.583379209f, 0.423386484f},
-std::array<float,2>{0.879477918f, 0.667268753f},
-std::array<float,2>{0.152462468f, 0.0349586047f},
-std::array<float,2>{0.0784374103f, 0.979214251f},
-std::array<float,2>{0.785611153f, 0.308266073f},
-std::array<float,2>{0.634901524f, 0.54405421f},
-std::array<float,2>{0.250778437f, 0.222894758f},
-std::array<float,2>{0.475689769f, 0.683889866f},
-std::array<float,2>{0.606521726f, 0.0479555987f},
-std::array<float,2>{0.91339165f, 0.864835322f},
-std::array<float,2>{0.172518373f, 0.421811998f},
-std::array<float,2>{0.235937044f, 0.617481947f},
-std::array<float,2>{0.991250932f, 0.17248261f},
-std::array<float,2>{0.546728313f, 0.882396996f},
-std::array<float,2>{0.39196822f, 0.339306027f},
-std::array<float,2>{0.322360367f, 0.80933255f},
-std::array<float,2>{0.72196579f, 0.438638896f},
-std::array<float,2>{0.830863237f, 0.712792635f},
-std::array<float,2>{0.0355692022f, 0.104337752f},
-std::array<float,2>{0.135352954f, 0.813503265f},
-std::array<float,2>{0.903867066f, 0.384579033f},
-std::array<float,2>{0.574397147f, 0.651888609f},
-std::array<float,2>{0.452291697f, 0.00343673257f},
-std::array<float,2>{0.284542501f, 0.510232091f},
-std::array<float,2>{0.678067982f, 0.202207237f},
-std::array<float,2>{0.775263429f, 0.967422545f},
-std::array<float,2>{0.116219491f, 0.264056057f},
-std::array<float,2>{0.0259699784f, 0.730222523f},
-std::array<float,2>{0.866062701f, 0.0751174465f},
-std::array<float,2>{0.712221265f, 0.773527622f},
-std::array<float,2>{0.357314467f, 0.479330719f},
-std::array<float,2>{0.429351926f, 0.912890673f},
-std::array<float,2>{0.530731261f, 0.34605065f},
-std::array<float,2>{0.966118395f, 0.563252926f},
-std::array<float,2>{0.204501435f, 0.156068757f},
-std::array<float,2>{0.0181236826f, 0.843583286f},
-std::array<float,2>{0.871150494f, 0.39381817f},
-std::array<float,2>{0.707405746f, 0.631358385f},
-std::array<float,2>{0.349611759f, 0.0190620739f},
-std::array<float,2>{0.436175197f, 0.516202807f},
-std::array<float,2>{0.515629292f, 0.209134385f},
-std::array<float,2>{0.957864642f, 0.949739039f},
-std::array<float,2>{0.213636115f, 0.276555061f},
-std::array<float,2>{0.131656364f, 0.738642573f},
-std::array<float,2>{0.890737712f, 0.0902899876f},
-std::array<float,2>{0.563438118f, 0.752051651f},
-std::array<float,2>{0.44357568f, 0.485924929f},
-std::array<float,2>{0.291609943f, 0.935185969f},
-std::array<float,2>{0.683565676f, 0.369654775f},
-std::array<float,2>{0.771498442f, 0.578933358f},
-std::array<float,2>{0.117455944f, 0.134986132f},
-std::array<float,2>{0.249950618f, 0.993940532f},
-std::array<float,2>{0.999039531f, 0.288687617f},
-std::array<float,2>{0.538368165f, 0.553199828f},
-std::array<float,2>{0.401132971f, 0.243229672f},
-std::array<float,2>{0.315678596f, 0.668867767f},
-std::array<float,2>{0.733287871f, 0.0368731804f},
-std::array<float,2>{0.837906122f, 0.857117534f},
-std::array<float,2>{0.0403065942f, 0.427530468f},
-std::array<float,2>{0.0937297866f, 0.604739726f},
-std::array<float,2>{0.795298636f, 0.163332239f},
-std::array<float,2>{0.628201246f, 0.892411292f},
-std::array<float,2>{0.258250415f, 0.317317456f},
-std::array<float,2>{0.476654798f, 0.795719504f},
-std::array<float,2>{0.59490329f, 0.459361702f},
-std::array<float,2>{0.915262878f, 0.701773465f},
-std::array<float,2>{0.186239868f, 0.113838293f},
-std::array<float,2>{0.108056188f, 0.877626657f},
-std::array<float,2>{0.756171286f, 0.342368573f},
-std::array<float,2>{0.660646796f, 0.622668266f},
-std::array<float,2>{0.298108786f, 0.178526759f},
-std::array<float,2>{0.464352876f, 0.717608035f},
-std::array<float,2>{0.58985287f, 0.105550103f},
-std::array<float,2>{0.885749936f, 0.805891216f},
-std::array<float,2>{0.148371652f, 0.442839414f},
-std::array<float,2>{0.190896586f, 0.54228431f},
-std::array<float,2>{0.946848214f, 0.21950008f},
-std::array<float,2>{0.509828568f, 0.980490565f},
-std::array<float,2>{0.40675202f, 0.31172365f},
-std::array<float,2>{0.368116587f, 0.861479878f},
-std::array<float,2>{0.688791633f, 0.416556835f},
-std::array<float,2>{0.847258866f, 0.681160808f},
-std::array<float,2>{0.0135943824f, 0.0510245971f},
-std::array<float,2>{0.15936479f, 0.780806661f},
-std::array<float,2>{0.928384066f, 0.483791083f},
-std::array<float,2>{0.615073442f, 0.73076731f},
-std::array<float,2>{0.487089366f, 0.0713914633f},
-std::array<float,2>{0.272282749f, 0.569503307f},
-std::array<float,2>{0.65274471f, 0.149776772f},
-std::array<float,2>{0.801853478f, 0.907989621f},
-std::array<float,2>{0.0725415498f, 0.347975403f},
-std::array<float,2>{0.0594255216f, 0.6543625f},
-std::array<float,2>{0.819691181f, 0.00723496079f},
-std::array<float,2>{0.739180148f, 0.818204939f},
-std::array<float,2>{0.3288638f, 0.388864487f},
-std::array<float,2>{0.375745744f, 0.961445034f},
-std::array<float,2>{0.551471353f, 0.258633047f},
-std::array<float,2>{0.973664522f, 0.513876796f},
-std::array<float,2>{0.227841303f, 0.197340041f},
-std::array<float,2>{0.0637459978f, 0.800880015f},
-std::array<float,2>{0.810699582f, 0.448822767f},
-std::array<float,2>{0.647525489f, 0.705648363f},
-std::array<float,2>{0.274742037f, 0.0964450389f},
-std::array<float,2>{0.498402745f, 0.615099251f},
-std::array<float,2>{0.617544711f, 0.186960042f},
-std::array<float,2>{0.935587287f, 0.88693285f},
-std::array<float,2>{0.16442664f, 0.331559747f},
-std::array<float,2>{0.219846189f, 0.679388404f},
-std::array<float,2>{0.981754959f, 0.0622243658f},
-std::array<float,2>{0.561986387f, 0.871704102f},
-std::array<float,2>{0.387344867f, 0.40795818f},
-std::array<float,2>{0.340105116f, 0.970318615f},
-std::array<float,2>{0.744641244f, 0.297234505f},
-std::array<float,2>{0.825514138f, 0.537643909f},
-std::array<float,2>{0.0541048981f, 0.227825642f},
-std::array<float,2>{0.150095835f, 0.914837718f},
-std::array<float,2>{0.875847816f, 0.352855295f},
-std::array<float,2>{0.582021952f, 0.577607751f},
-std::array<float,2>{0.460745692f, 0.146488667f},
-std::array<float,2>{0.309936315f, 0.726171851f},
-std::array<float,2>{0.664374411f, 0.0650791228f},
-std::array<float,2>{0.758437157f, 0.765818477f},
-std::array<float,2>{0.0949202403f, 0.476451904f},
-std::array<float,2>{0.00122180057f, 0.502964377f},
-std::array<float,2>{0.854454398f, 0.187754512f},
-std::array<float,2>{0.696168602f, 0.953761518f},
-std::array<float,2>{0.361988813f, 0.255964816f},
-std::array<float,2>{0.417354345f, 0.826145828f},
-std::array<float,2>{0.500774205f, 0.377935618f},
-std::array<float,2>{0.944393992f, 0.642683983f},
-std::array<float,2>{0.198466688f, 0.00811503362f},
-std::array<float,2>{0.034953814f, 0.940945148f},
-std::array<float,2>{0.833035946f, 0.270717114f},
-std::array<float,2>{0.726437747f, 0.529170632f},
-std::array<float,2>{0.325471878f, 0.213427737f},
-std::array<float,2>{0.39672327f, 0.640546501f},
-std::array<float,2>{0.54075563f, 0.0275674555f},
-std::array<float,2>{0.985559106f, 0.835257649f},
-std::array<float,2>{0.240086079f, 0.400490373f},
-std::array<float,2>{0.177908167f, 0.586530507f},
-std::array<float,2>{0.907604396f, 0.130082607f},
-std::array<float,2>{0.6037817f, 0.924624979f},
-std::array<float,2>{0.470086128f, 0.363658458f},
-std::array<float,2>{0.254726499f, 0.761917174f},
-std::array<float,2>{0.6403566f, 0.492531449f},
-std::array<float,2>{0.781374216f, 0.744298518f},
-std::array<float,2>{0.0857213512f, 0.0794920921f},
-std::array<float,2>{0.210691407f, 0.84567517f},
-std::array<float,2>{0.964054048f, 0.435270458f},
-std::array<float,2>{0.525830328f, 0.661492407f},
-std::array<float,2>{0.423682958f, 0.045436278f},
-std::array<float,2>{0.352707654f, 0.558238804f},
-std::array<float,2>{0.718254328f, 0.241609186f},
-std::array<float,2>{0.86031574f, 0.989872873f},
-std::array<float,2>{0.0304928254f, 0.296736419f},
-std::array<float,2>{0.112763174f, 0.693841577f},
-std::array<float,2>{0.777564883f, 0.120369904f},
-std::array<float,2>{0.67316848f, 0.785897791f},
-std::array<float,2>{0.285726249f, 0.467548847f},
-std::array<float,2>{0.448280901f, 0.905928075f},
-std::array<float,2>{0.572033882f, 0.325429231f},
-std::array<float,2>{0.901542187f, 0.59438014f},
-std::array<float,2>{0.138993531f, 0.170759916f},
-std::array<float,2>{0.0861277506f, 0.823155284f},
-std::array<float,2>{0.790792346f, 0.380172968f},
-std::array<float,2>{0.629258454f, 0.646730363f},
-std::array<float,2>{0.262886375f, 0.0154921738f},
-std::array<float,2>{0.484343976f, 0.504337728f},
-std::array<float,2>{0.601440549f, 0.194398656f},
-std::array<float,2>{0.918767989f, 0.960041046f},
-std::array<float,2>{0.180448726f, 0.252817929f},
-std::array<float,2>{0.242219254f, 0.722272515f},
-std::array<float,2>{0.99346447f, 0.068471767f},
-std::array<float,2>{0.531934083f, 0.770412385f},
-std::array<float,2>{0.402392089f, 0.47158438f},
-std::array<float,2>{0.316465557f, 0.919599831f},
-std::array<float,2>{0.728010356f, 0.356654495f},
-std::array<float,2>{0.842955828f, 0.570513546f},
-std::array<float,2>{0.0459216535f, 0.141194388f},
-std::array<float,2>{0.126239464f, 0.975799501f},
-std::array<float,2>{0.896390855f, 0.304534227f},
-std::array<float,2>{0.567929685f, 0.533584237f},
-std::array<float,2>{0.440724224f, 0.232534021f},
-std::array<float,2>{0.296598434f, 0.67506361f},
-std::array<float,2>{0.684750855f, 0.0547004417f},
-std::array<float,2>{0.765717804f, 0.868215084f},
-std::array<float,2>{0.123869605f, 0.412973762f},
-std::array<float,2>{0.0203121211f, 0.611527562f},
-std::array<float,2>{0.868950844f, 0.180900767f},
-std::array<float,2>{0.705394149f, 0.884726882f},
-std::array<float,2>{0.346035153f, 0.332752347f},
-std::array<float,2>{0.433036447f, 0.797862887f},
-std::array<float,2>{0.52167809f, 0.450049967f},
-std::array<float,2>{0.95657593f, 0.707535148f},
-std::array<float,2>{0.21532549f, 0.100680239f},
-std::array<float,2>{0.0584422946f, 0.900878847f},
-std::array<float,2>{0.815194249f, 0.321848094f},
-std::array<float,2>{0.734674215f, 0.600458086f},
-std::array<float,2>{0.335695595f, 0.166138202f},
-std::array<float,2>{0.381316274f, 0.688502252f},
-std::array<float,2>{0.549789131f, 0.123933814f},
-std::array<float,2>{0.971108377f, 0.784892499f},
-std::array<float,2>{0.232089639f, 0.463743031f},
-std::array<float,2>{0.160247847f, 0.561152756f},
-std::array<float,2>{0.9232831f, 0.236825377f},
-std::array<float,2>{0.611289263f, 0.987962186f},
-std::array<float,2>{0.489272743f, 0.292644382f},
-std::array<float,2>{0.265644342f, 0.848929107f},
-std::array<float,2>{0.650785625f, 0.430882961f},
-std::array<float,2>{0.799729824f, 0.658311129f},
-std::array<float,2>{0.0769360214f, 0.0401044451f},
-std::array<float,2>{0.191616789f, 0.759155214f},
-std::array<float,2>{0.952789128f, 0.496852607f},
-std::array<float,2>{0.512860715f, 0.747210324f},
-std::array<float,2>{0.412228316f, 0.0828918889f},
-std::array<float,2>{0.372563094f, 0.592972398f},
-std::array<float,2>{0.693538427f, 0.127351969f},
-std::array<float,2>{0.849897325f, 0.927321672f},
-std::array<float,2>{0.00893263705f, 0.360324502f},
-std::array<float,2>{0.103288725f, 0.63602221f},
-std::array<float,2>{0.752057016f, 0.0249964371f},
-std::array<float,2>{0.658139348f, 0.830179751f},
-std::array<float,2>{0.303498954f, 0.405905068f},
-std::array<float,2>{0.466946781f, 0.941617727f},
-std::array<float,2>{0.588162005f, 0.268076241f},
-std::array<float,2>{0.888969004f, 0.524773061f},
-std::array<float,2>{0.144104809f, 0.215938672f},
-std::array<float,2>{0.00399177521f, 0.792189777f},
-std::array<float,2>{0.856681705f, 0.454306722f},
-std::array<float,2>{0.699546099f, 0.697517633f},
-std::array<float,2>{0.365460634f, 0.110920928f},
-std::array<float,2>{0.421690017f, 0.607809901f},
-std::array<float,2>{0.506275415f, 0.158429965f},
-std::array<float,2>{0.939529061f, 0.895223379f},
-std::array<float,2>{0.202407315f, 0.314466029f},
-std::array<float,2>{0.155067503f, 0.666014254f},
-std::array<float,2>{0.882185519f, 0.0320736654f},
-std::array<float,2>{0.58566457f, 0.851973772f},
-std::array<float,2>{0.45542109f, 0.424078882f},
-std::array<float,2>{0.308297217f, 0.999279141f},
-std::array<float,2>{0.671089113f, 0.282248586f},
-std::array<float,2>{0.762474835f, 0.548587143f},
-std::array<float,2>{0.0991691798f, 0.247462884f},
-std::array<float,2>{0.223510489f, 0.930986702f},
-std::array<float,2>{0.979834199f, 0.371139109f},
-std::array<float,2>{0.556437671f, 0.582773685f},
-std::array<float,2>{0.382858008f, 0.139079735f},
-std::array<float,2>{0.338055044f, 0.73650068f},
-std::array<float,2>{0.746569455f, 0.0885011777f},
-std::array<float,2>{0.820354104f, 0.75742346f},
-std::array<float,2>{0.0481372289f, 0.490505934f},
-std::array<float,2>{0.0693046302f, 0.521768272f},
-std::array<float,2>{0.805563211f, 0.203602925f},
-std::array<float,2>{0.643376887f, 0.945736289f},
-std::array<float,2>{0.278461158f, 0.277489632f},
-std::array<float,2>{0.495276183f, 0.837989509f},
-std::array<float,2>{0.623228014f, 0.39563489f},
-std::array<float,2>{0.933590293f, 0.628434002f},
-std::array<float,2>{0.170697451f, 0.0229602139f},
-std::array<float,2>{0.113369897f, 0.96542424f},
-std::array<float,2>{0.776601076f, 0.262894064f},
-std::array<float,2>{0.677663982f, 0.508620441f},
-std::array<float,2>{0.281470984f, 0.199796379f},
-std::array<float,2>{0.451096505f, 0.649731994f},
-std::array<float,2>{0.576571107f, 0.000149976666f},
-std::array<float,2>{0.904896259f, 0.816082299f},
-std::array<float,2>{0.133890271f, 0.385467976f},
-std::array<float,2>{0.206377104f, 0.564988554f},
-std::array<float,2>{0.968340218f, 0.153056815f},
-std::array<float,2>{0.528697252f, 0.910582185f},
-std::array<float,2>{0.427547485f, 0.345077038f},
-std::array<float,2>{0.359230071f, 0.77583766f},
-std::array<float,2>{0.713101149f, 0.476911575f},
-std::array<float,2>{0.863952518f, 0.728105009f},
-std::array<float,2>{0.0242285654f, 0.0770430118f},
-std::array<float,2>{0.175364152f, 0.865832686f},
-std::array<float,2>{0.911460459f, 0.419475168f},
-std::array<float,2>{0.608177841f, 0.686241269f},
-std::array<float,2>{0.474040091f, 0.0498387739f},
-std::array<float,2>{0.252083123f, 0.546698213f},
-std::array<float,2>{0.633648872f, 0.226258025f},
-std::array<float,2>{0.788363934f, 0.977913558f},
-std::array<float,2>{0.0814369097f, 0.304739177f},
-std::array<float,2>{0.0381429866f, 0.714665294f},
-std::array<float,2>{0.828239322f, 0.102065735f},
-std::array<float,2>{0.719638705f, 0.811401367f},
-std::array<float,2>{0.321760267f, 0.439655989f},
-std::array<float,2>{0.393650562f, 0.880105674f},
-std::array<float,2>{0.542990088f, 0.337186903f},
-std::array<float,2>{0.989240468f, 0.619529784f},
-std::array<float,2>{0.236935228f, 0.175607949f},
-std::array<float,2>{0.0428925566f, 0.857826829f},
-std::array<float,2>{0.836135626f, 0.428853244f},
-std::array<float,2>{0.73066324f, 0.670967996f},
-std::array<float,2>{0.313863337f, 0.0372457355f},
-std::array<float,2>{0.399104744f, 0.551798701f},
-std::array<float,2>{0.536519647f, 0.245678082f},
-std::array<float,2>{0.99716866f, 0.994943917f},
-std::array<float,2>{0.247416198f, 0.286922127f},
-std::array<float,2>{0.184839994f, 0.701022863f},
-std::array<float,2>{0.917434335f, 0.117002532f},
-std::array<float,2>{0.595985293f, 0.794557631f},
-std::array<float,2>{0.479407728f, 0.45747152f},
-std::array<float,2>{0.26116991f, 0.893813729f},
-std::array<float,2>{0.626736283f, 0.32030347f},
-std::array<float,2>{0.793303907f, 0.603501499f},
-std::array<float,2>{0.0903598517f, 0.160245746f},
-std::array<float,2>{0.212555453f, 0.952931643f},
-std::array<float,2>{0.959151983f, 0.274755508f},
-std::array<float,2>{0.51831764f, 0.518717468f},
-std::array<float,2>{0.434753984f, 0.207689852f},
-std::array<float,2>{0.348088205f, 0.629101872f},
-std::array<float,2>{0.7106933f, 0.0163743235f},
-std::array<float,2>{0.874969125f, 0.841592073f},
-std::array<float,2>{0.0170456674f, 0.390696287f},
-std::array<float,2>{0.119415879f, 0.581252635f},
-std::array<float,2>{0.770071149f, 0.133246779f},
-std::array<float,2>{0.680012643f, 0.937438965f},
-std::array<float,2>{0.290656328f, 0.368281662f},
-std::array<float,2>{0.442391783f, 0.750503898f},
-std::array<float,2>{0.565757155f, 0.487382174f},
-std::array<float,2>{0.893013418f, 0.741001427f},
-std::array<float,2>{0.129825324f, 0.0927097425f},
-std::array<float,2>{0.0708944574f, 0.909171581f},
-std::array<float,2>{0.803066552f, 0.350054026f},
-std::array<float,2>{0.654717803f, 0.567508638f},
-std::array<float,2>{0.270935029f, 0.152052388f},
-std::array<float,2>{0.485103458f, 0.7342816f},
-std::array<float,2>{0.616031349f, 0.0729140043f},
-std::array<float,2>{0.926085413f, 0.777454317f},
-std::array<float,2>{0.15743649f, 0.481413782f},
-std::array<float,2>{0.228943259f, 0.512475073f},
-std::array<float,2>{0.97482264f, 0.19643721f},
-std::array<float,2>{0.552805781f, 0.964045465f},
-std::array<float,2>{0.377989233f, 0.261328727f},
-std::array<float,2>{0.331292212f, 0.818850636f},
-std::array<float,2>{0.741757631f, 0.386975199f},
-std::array<float,2>{0.817809999f, 0.653402805f},
-std::array<float,2>{0.0613361709f, 0.00418175105f},
-std::array<float,2>{0.145638689f, 0.808147073f},
-std::array<float,2>{0.884663701f, 0.44402957f},
-std::array<float,2>{0.591816485f, 0.716333508f},
-std::array<float,2>{0.462824434f, 0.107734025f},
-std::array<float,2>{0.299068779f, 0.623981059f},
-std::array<float,2>{0.662873566f, 0.176832408f},
-std::array<float,2>{0.75492382f, 0.8753739f},
-std::array<float,2>{0.105507284f, 0.341503441f},
-std::array<float,2>{0.0154264485f, 0.68276751f},
-std::array<float,2>{0.844489932f, 0.0529083796f},
-std::array<float,2>{0.689723492f, 0.86055696f},
-std::array<float,2>{0.370422721f, 0.415691882f},
-std::array<float,2>{0.409124613f, 0.983329654f},
-std::array<float,2>{0.508499742f, 0.308857173f},
-std::array<float,2>{0.949195683f, 0.539972544f},
-std::array<float,2>{0.188261166f, 0.221598372f},
-std::array<float,2>{0.0967721567f, 0.769154012f},
-std::array<float,2>{0.759983659f, 0.473594099f},
-std::array<float,2>{0.667064011f, 0.722857177f},
-std::array<float,2>{0.311978877f, 0.0644044057f},
-std::array<float,2>{0.458218664f, 0.57569474f},
-std::array<float,2>{0.578157783f, 0.145415291f},
-std::array<float,2>{0.877863467f, 0.917640448f},
-std::array<float,2>{0.150737748f, 0.354693741f},
-std::array<float,2>{0.196904555f, 0.64215076f},
-std::array<float,2>{0.941883862f, 0.0108521115f},
-std::array<float,2>{0.501975298f, 0.827707171f},
-std::array<float,2>{0.415825129f, 0.3769418f},
-std::array<float,2>{0.361113727f, 0.956414282f},
-std::array<float,2>{0.699143648f, 0.254520565f},
-std::array<float,2>{0.852285385f, 0.500026166f},
-std::array<float,2>{0.0037013609f, 0.190894544f},
-std::array<float,2>{0.167364821f, 0.888776243f},
-std::array<float,2>{0.934066236f, 0.328372926f},
-std::array<float,2>{0.620476902f, 0.615817189f},
-std::array<float,2>{0.496521711f, 0.184009135f},
-std::array<float,2>{0.277284145f, 0.703299165f},
-std::array<float,2>{0.646270454f, 0.093964763f},
-std::array<float,2>{0.808763027f, 0.803714454f},
-std::array<float,2>{0.0651230812f, 0.446800649f},
-std::array<float,2>{0.0508240871f, 0.536244988f},
-std::array<float,2>{0.82763356f, 0.229913786f},
-std::array<float,2>{0.743809342f, 0.972444713f},
-std::array<float,2>{0.343715787f, 0.300236493f},
-std::array<float,2>{0.390086949f, 0.87479353f},
-std::array<float,2>{0.559066713f, 0.408796668f},
-std::array<float,2>{0.982513428f, 0.676739156f},
-std::array<float,2>{0.221773222f, 0.0590203814f},
-std::array<float,2>{0.0278044771f, 0.990637779f},
-std::array<float,2>{0.861777008f, 0.294157088f},
-std::array<float,2>{0.714957237f, 0.555217862f},
-std::array<float,2>{0.355032951f, 0.239082068f},
-std::array<float,2>{0.424262613f, 0.663736939f},
-std::array<float,2>{0.524851024f, 0.0441689715f},
-std::array<float,2>{0.961061239f, 0.847652256f},
-std::array<float,2>{0.207849115f, 0.437040627f},
-std::array<float,2>{0.137394786f, 0.596592844f},
-std::array<float,2>{0.899126768f, 0.169773787f},
-std::array<float,2>{0.572645247f, 0.904271722f},
-std::array<float,2>{0.446142048f, 0.326336622f},
-std::array<float,2>{0.288817704f, 0.787920952f},
-std::array<float,2>{0.675226271f, 0.465379059f},
-std::array<float,2>{0.780191123f, 0.692416251f},
-std::array<float,2>{0.111095384f, 0.11756812f},
-std::array<float,2>{0.2418558f, 0.83331424f},
-std::array<float,2>{0.987379313f, 0.400106728f},
-std::array<float,2>{0.542583823f, 0.636915207f},
-std::array<float,2>{0.394699723f, 0.0304778218f},
-std::array<float,2>{0.32711488f, 0.530139327f},
-std::array<float,2>{0.723502398f, 0.212773293f},
-std::array<float,2>{0.834520638f, 0.939185262f},
-std::array<float,2>{0.0331985578f, 0.272243857f},
-std::array<float,2>{0.0838543773f, 0.743294537f},
-std::array<float,2>{0.784626067f, 0.0803114027f},
-std::array<float,2>{0.637306452f, 0.765454054f},
-std::array<float,2>{0.257760435f, 0.494670421f},
-std::array<float,2>{0.472314477f, 0.923736215f},
-std::array<float,2>{0.603405654f, 0.366938621f},
-std::array<float,2>{0.908309877f, 0.588788331f},
-std::array<float,2>{0.177102059f, 0.132602736f},
-std::array<float,2>{0.0778532997f, 0.851071894f},
-std::array<float,2>{0.800691068f, 0.43187201f},
-std::array<float,2>{0.652081072f, 0.657651901f},
-std::array<float,2>{0.266919136f, 0.0411487706f},
-std::array<float,2>{0.488720357f, 0.55916965f},
-std::array<float,2>{0.610168576f, 0.235533968f},
-std::array<float,2>{0.922477663f, 0.985860646f},
-std::array<float,2>{0.161959261f, 0.289674878f},
-std::array<float,2>{0.230636522f, 0.691076815f},
-std::array<float,2>{0.972555697f, 0.121694788f},
-std::array<float,2>{0.550418377f, 0.781496465f},
-std::array<float,2>{0.381912798f, 0.462018758f},
-std::array<float,2>{0.334549814f, 0.899544954f},
-std::array<float,2>{0.735482812f, 0.322414368f},
-std::array<float,2>{0.816230357f, 0.598789871f},
-std::array<float,2>{0.056652382f, 0.165119678f},
-std::array<float,2>{0.143361777f, 0.943626046f},
-std::array<float,2>{0.889858365f, 0.266269535f},
-std::array<float,2>{0.588891327f, 0.526001513f},
-std::array<float,2>{0.467961162f, 0.21824567f},
-std::array<float,2>{0.304159075f, 0.632894993f},
-std::array<float,2>{0.656289279f, 0.0259158593f},
-std::array<float,2>{0.753349423f, 0.829122543f},
-std::array<float,2>{0.102431275f, 0.404061168f},
-std::array<float,2>{0.00852767099f, 0.591627538f},
-std::array<float,2>{0.851437926f, 0.126553655f},
-std::array<float,2>{0.69515872f, 0.929228902f},
-std::array<float,2>{0.371691704f, 0.36146f},
-std::array<float,2>{0.41330862f, 0.760158837f},
-std::array<float,2>{0.511999488f, 0.498911828f},
-std::array<float,2>{0.95205915f, 0.748366654f},
-std::array<float,2>{0.193081364f, 0.0844972953f},
-std::array<float,2>{0.0455374047f, 0.920076311f},
-std::array<float,2>{0.842112422f, 0.35911715f},
-std::array<float,2>{0.727073967f, 0.573488295f},
-std::array<float,2>{0.317438602f, 0.143805817f},
-std::array<float,2>{0.403924555f, 0.719323516f},
-std::array<float,2>{0.532389522f, 0.0670588836f},
-std::array<float,2>{0.992664516f, 0.771765947f},
-std::array<float,2>{0.243795633f, 0.47047174f},
-std::array<float,2>{0.181322619f, 0.507695675f},
-std::array<float,2>{0.919209659f, 0.19298017f},
-std::array<float,2>{0.600095093f, 0.958922327f},
-std::array<float,2>{0.483121306f, 0.250714749f},
-std::array<float,2>{0.262237906f, 0.821150661f},
-std::array<float,2>{0.629884064f, 0.38147679f},
-std::array<float,2>{0.789157152f, 0.644603372f},
-std::array<float,2>{0.0872617438f, 0.012695007f},
-std::array<float,2>{0.216522709f, 0.799821019f},
-std::array<float,2>{0.955152631f, 0.45267868f},
-std::array<float,2>{0.523003042f, 0.709354043f},
-std::array<float,2>{0.431670249f, 0.0993429422f},
-std::array<float,2>{0.346840858f, 0.610003054f},
-std::array<float,2>{0.706836462f, 0.182177529f},
-std::array<float,2>{0.867774308f, 0.886464059f},
-std::array<float,2>{0.0205519851f, 0.33433345f},
-std::array<float,2>{0.124817334f, 0.673298657f},
-std::array<float,2>{0.767010152f, 0.0572001934f},
-std::array<float,2>{0.684306741f, 0.870192468f},
-std::array<float,2>{0.295159191f, 0.411819786f},
-std::array<float,2>{0.439625293f, 0.973326504f},
-std::array<float,2>{0.567115963f, 0.301559836f},
-std::array<float,2>{0.894708455f, 0.533002973f},
-std::array<float,2>{0.125355795f, 0.230679154f},
-std::array<float,2>{0.0245490633f, 0.774607956f},
-std::array<float,2>{0.864992738f, 0.479881853f},
-std::array<float,2>{0.713993967f, 0.728563249f},
-std::array<float,2>{0.357949018f, 0.0757173598f},
-std::array<float,2>{0.426363379f, 0.563692153f},
-std::array<float,2>{0.528097093f, 0.155137137f},
-std::array<float,2>{0.96744585f, 0.913138509f},
-std::array<float,2>{0.205472678f, 0.346861511f},
-std::array<float,2>{0.132825866f, 0.650745869f},
-std::array<float,2>{0.906092763f, 0.0025864793f},
-std::array<float,2>{0.577512324f, 0.813280702f},
-std::array<float,2>{0.449783385f, 0.383638442f},
-std::array<float,2>{0.282757878f, 0.967925906f},
-std::array<float,2>{0.676440239f, 0.264817059f},
-std::array<float,2>{0.775842011f, 0.511574328f},
-std::array<float,2>{0.114548527f, 0.201429576f},
-std::array<float,2>{0.238127187f, 0.880874455f},
-std::array<float,2>{0.989777863f, 0.338511586f},
-std::array<float,2>{0.544754446f, 0.618762016f},
-std::array<float,2>{0.392801553f, 0.173332438f},
-std::array<float,2>{0.321144849f, 0.710979044f},
-std::array<float,2>{0.719923794f, 0.10525585f},
-std::array<float,2>{0.829405665f, 0.810386598f},
-std::array<float,2>{0.0379568711f, 0.438181102f},
-std::array<float,2>{0.0806129202f, 0.543172956f},
-std::array<float,2>{0.787276626f, 0.223665431f},
-std::array<float,2>{0.634027779f, 0.980086625f},
-std::array<float,2>{0.253472507f, 0.307046413f},
-std::array<float,2>{0.473492503f, 0.863796055f},
-std::array<float,2>{0.608742476f, 0.4203282f},
-std::array<float,2>{0.910938978f, 0.685457349f},
-std::array<float,2>{0.174035102f, 0.0470979288f},
-std::array<float,2>{0.0982875675f, 0.99720782f},
-std::array<float,2>{0.763354659f, 0.28490606f},
-std::array<float,2>{0.670220196f, 0.549595416f},
-std::array<float,2>{0.30678907f, 0.249391586f},
-std::array<float,2>{0.456315994f, 0.666606009f},
-std::array<float,2>{0.584801972f, 0.0340766013f},
-std::array<float,2>{0.881363511f, 0.855180562f},
-std::array<float,2>{0.155693471f, 0.4223423f},
-std::array<float,2>{0.201888189f, 0.606857181f},
-std::array<float,2>{0.941031516f, 0.156593323f},
-std::array<float,2>{0.50728178f, 0.897589087f},
-std::array<float,2>{0.420517921f, 0.313951731f},
-std::array<float,2>{0.366566718f, 0.790405393f},
-std::array<float,2>{0.700206995f, 0.45552063f},
-std::array<float,2>{0.855986118f, 0.696823776f},
-std::array<float,2>{0.00496035302f, 0.112558514f},
-std::array<float,2>{0.17140609f, 0.836189628f},
-std::array<float,2>{0.932005703f, 0.397599906f},
-std::array<float,2>{0.624593437f, 0.625433564f},
-std::array<float,2>{0.495109409f, 0.0212844498f},
-std::array<float,2>{0.27765733f, 0.52096194f},
-std::array<float,2>{0.643671215f, 0.206041098f},
-std::array<float,2>{0.806543767f, 0.9472664f},
-std::array<float,2>{0.0697028413f, 0.279733896f},
-std::array<float,2>{0.0475497767f, 0.735167801f},
-std::array<float,2>{0.821762919f, 0.0866549015f},
-std::array<float,2>{0.748028338f, 0.755832911f},
-std::array<float,2>{0.339281201f, 0.48830092f},
-std::array<float,2>{0.384548485f, 0.933587611f},
-std::array<float,2>{0.555406928f, 0.373743683f},
-std::array<float,2>{0.979022205f, 0.584486902f},
-std::array<float,2>{0.224173114f, 0.136830926f},
-std::array<float,2>{0.061774563f, 0.816571891f},
-std::array<float,2>{0.816938043f, 0.390040576f},
-std::array<float,2>{0.74065578f, 0.655560791f},
-std::array<float,2>{0.330335677f, 0.00608686591f},
-std::array<float,2>{0.377132237f, 0.515144944f},
-std::array<float,2>{0.554160476f, 0.198822483f},
-std::array<float,2>{0.975925803f, 0.96280545f},
-std::array<float,2>{0.229623705f, 0.259753644f},
-std::array<float,2>{0.156990409f, 0.732066512f},
-std::array<float,2>{0.927113354f, 0.0706724972f},
-std::array<float,2>{0.616608977f, 0.779639363f},
-std::array<float,2>{0.485821277f, 0.482954413f},
-std::array<float,2>{0.269553423f, 0.906342387f},
-std::array<float,2>{0.655767977f, 0.348710805f},
-std::array<float,2>{0.804425716f, 0.568647683f},
-std::array<float,2>{0.0718704909f, 0.149095803f},
-std::array<float,2>{0.1887068f, 0.981834829f},
-std::array<float,2>{0.947467089f, 0.310693502f},
-std::array<float,2>{0.509222746f, 0.541122258f},
-std::array<float,2>{0.409890205f, 0.220518678f},
-std::array<float,2>{0.369286478f, 0.680292785f},
-std::array<float,2>{0.691132426f, 0.0518317334f},
-std::array<float,2>{0.845678389f, 0.863232076f},
-std::array<float,2>{0.0137318494f, 0.417755991f},
-std::array<float,2>{0.106636323f, 0.621603966f},
-std::array<float,2>{0.754467309f, 0.178909302f},
-std::array<float,2>{0.663677335f, 0.878529906f},
-std::array<float,2>{0.299969286f, 0.343200684f},
-std::array<float,2>{0.46152997f, 0.805552244f},
-std::array<float,2>{0.593468428f, 0.442010999f},
-std::array<float,2>{0.883051753f, 0.717829049f},
-std::array<float,2>{0.145458013f, 0.107025512f},
-std::array<float,2>{0.0911917686f, 0.89086473f},
-std::array<float,2>{0.79450047f, 0.318197966f},
-std::array<float,2>{0.625767529f, 0.603663921f},
-std::array<float,2>{0.260565072f, 0.162494987f},
-std::array<float,2>{0.479753166f, 0.702617466f},
-std::array<float,2>{0.597287834f, 0.114415318f},
-std::array<float,2>{0.916853487f, 0.796774507f},
-std::array<float,2>{0.184273019f, 0.460916847f},
-std::array<float,2>{0.247058287f, 0.554599285f},
-std::array<float,2>{0.996431053f, 0.242717326f},
-std::array<float,2>{0.535978258f, 0.99292022f},
-std::array<float,2>{0.400088876f, 0.287617117f},
-std::array<float,2>{0.313145339f, 0.856153667f},
-std::array<float,2>{0.731512249f, 0.426257074f},
-std::array<float,2>{0.837450087f, 0.669303417f},
-std::array<float,2>{0.0413751006f, 0.0355738625f},
-std::array<float,2>{0.130254671f, 0.753837109f},
-std::array<float,2>{0.89365828f, 0.485087991f},
-std::array<float,2>{0.565189123f, 0.739813805f},
-std::array<float,2>{0.441961914f, 0.091013737f},
-std::array<float,2>{0.289895594f, 0.579866052f},
-std::array<float,2>{0.680872262f, 0.136683494f},
-std::array<float,2>{0.771418989f, 0.934007049f},
-std::array<float,2>{0.120983988f, 0.370372713f},
-std::array<float,2>{0.0165032241f, 0.631933212f},
-std::array<float,2>{0.873751342f, 0.018097559f},
-std::array<float,2>{0.709106922f, 0.842472732f},
-std::array<float,2>{0.349344045f, 0.393251985f},
-std::array<float,2>{0.434554458f, 0.95073694f},
-std::array<float,2>{0.518992186f, 0.275608063f},
-std::array<float,2>{0.960287988f, 0.516667306f},
-std::array<float,2>{0.211406171f, 0.210146502f},
-std::array<float,2>{0.109727561f, 0.786156356f},
-std::array<float,2>{0.780441284f, 0.46786049f},
-std::array<float,2>{0.673909962f, 0.694937706f},
-std::array<float,2>{0.287351102f, 0.119265132f},
-std::array<float,2>{0.447039515f, 0.59539634f},
-std::array<float,2>{0.573575318f, 0.171080202f},
-std::array<float,2>{0.900368929f, 0.904445052f},
-std::array<float,2>{0.138176993f, 0.324854612f},
-std::array<float,2>{0.20858112f, 0.660331428f},
-std::array<float,2>{0.962870717f, 0.0468735136f},
-std::array<float,2>{0.52358675f, 0.844431043f},
-std::array<float,2>{0.425497562f, 0.434394121f},
-std::array<float,2>{0.353681207f, 0.989053011f},
-std::array<float,2>{0.716708541f, 0.295319468f},
-std::array<float,2>{0.863040626f, 0.557445109f},
-std::array<float,2>{0.0283381362f, 0.241000712f},
-std::array<float,2>{0.176673457f, 0.925147235f},
-std::array<float,2>{0.909265578f, 0.3647407f},
-std::array<float,2>{0.602187812f, 0.58727169f},
-std::array<float,2>{0.471331716f, 0.129165635f},
-std::array<float,2>{0.256536305f, 0.745138586f},
-std::array<float,2>{0.638314843f, 0.0785598829f},
-std::array<float,2>{0.783538461f, 0.763554573f},
-std::array<float,2>{0.0822491124f, 0.494113177f},
-std::array<float,2>{0.0317253917f, 0.527410746f},
-std::array<float,2>{0.835776806f, 0.214070231f},
-std::array<float,2>{0.72414887f, 0.93991214f},
-std::array<float,2>{0.328079879f, 0.270312905f},
-std::array<float,2>{0.396187454f, 0.83490926f},
-std::array<float,2>{0.541386366f, 0.401576489f},
-std::array<float,2>{0.987139046f, 0.638934851f},
-std::array<float,2>{0.240894064f, 0.028352255f},
-std::array<float,2>{0.00224653911f, 0.954336286f},
-std::array<float,2>{0.852787733f, 0.257321328f},
-std::array<float,2>{0.697296977f, 0.502470076f},
-std::array<float,2>{0.36032474f, 0.189156264f},
-std::array<float,2>{0.414509624f, 0.644272327f},
-std::array<float,2>{0.503419578f, 0.0095655052f},
-std::array<float,2>{0.942406833f, 0.825060546f},
-std::array<float,2>{0.196029231f, 0.377901763f},
-std::array<float,2>{0.151701927f, 0.576518416f},
-std::array<float,2>{0.878758609f, 0.148067936f},
-std::array<float,2>{0.579946697f, 0.915396631f},
-std::array<float,2>{0.457609236f, 0.351642519f},
-std::array<float,2>{0.311036855f, 0.766712308f},
-std::array<float,2>{0.666412055f, 0.475550652f},
-std::array<float,2>{0.760985136f, 0.724639475f},
-std::array<float,2>{0.0959404111f, 0.0655476004f},
-std::array<float,2>{0.221343532f, 0.87280035f},
-std::array<float,2>{0.983430386f, 0.406298727f},
-std::array<float,2>{0.560370505f, 0.678658724f},
-std::array<float,2>{0.388861656f, 0.0607126355f},
-std::array<float,2>{0.34218204f, 0.538665652f},
-std::array<float,2>{0.742570877f, 0.227041453f},
-std::array<float,2>{0.826602459f, 0.969033957f},
-std::array<float,2>{0.0519961528f, 0.298419327f},
-std::array<float,2>{0.0660296306f, 0.706661701f},
-std::array<float,2>{0.809962451f, 0.0971679986f},
-std::array<float,2>{0.645307899f, 0.802254319f},
-std::array<float,2>{0.275888532f, 0.447304934f},
-std::array<float,2>{0.49798876f, 0.888128161f},
-std::array<float,2>{0.619879782f, 0.33085233f},
-std::array<float,2>{0.935176015f, 0.613467455f},
-std::array<float,2>{0.166477069f, 0.18611303f},
-std::array<float,2>{0.105030946f, 0.831310987f},
-std::array<float,2>{0.750554442f, 0.40516299f},
-std::array<float,2>{0.658881187f, 0.635674715f},
-std::array<float,2>{0.301343262f, 0.0241589025f},
-std::array<float,2>{0.465421855f, 0.523770928f},
-std::array<float,2>{0.587584257f, 0.215180174f},
-std::array<float,2>{0.888162017f, 0.942571104f},
-std::array<float,2>{0.141482443f, 0.268855244f},
-std::array<float,2>{0.194235057f, 0.747000217f},
-std::array<float,2>{0.949851394f, 0.0839604735f},
-std::array<float,2>{0.515008748f, 0.758002579f},
-std::array<float,2>{0.410984159f, 0.497573435f},
-std::array<float,2>{0.374919772f, 0.926041245f},
-std::array<float,2>{0.693132758f, 0.360815614f},
-std::array<float,2>{0.849314272f, 0.592673123f},
-std::array<float,2>{0.0104452232f, 0.12859726f},
-std::array<float,2>{0.162138075f, 0.987015545f},
-std::array<float,2>{0.924052238f, 0.291582257f},
-std::array<float,2>{0.611738384f, 0.561983347f},
-std::array<float,2>{0.490779996f, 0.237556428f},
-std::array<float,2>{0.269294232f, 0.659412086f},
-std::array<float,2>{0.649700046f, 0.0400389358f},
-std::array<float,2>{0.798191428f, 0.848344207f},
-std::array<float,2>{0.0753596798f, 0.430358589f},
-std::array<float,2>{0.0552716292f, 0.601354778f},
-std::array<float,2>{0.81367743f, 0.167136163f},
-std::array<float,2>{0.737558603f, 0.90169996f},
-std::array<float,2>{0.332183629f, 0.320551246f},
-std::array<float,2>{0.379693806f, 0.783677995f},
-std::array<float,2>{0.548747003f, 0.464735568f},
-std::array<float,2>{0.969354987f, 0.687690437f},
-std::array<float,2>{0.234024748f, 0.124793641f},
-std::array<float,2>{0.0221528392f, 0.883752227f},
-std::array<float,2>{0.869800806f, 0.333831161f},
-std::array<float,2>{0.704123974f, 0.613105774f},
-std::array<float,2>{0.343848139f, 0.180466428f},
-std::array<float,2>{0.431314409f, 0.708312452f},
-std::array<float,2>{0.519548774f, 0.100147769f},
-std::array<float,2>{0.953579843f, 0.797333598f},
-std::array<float,2>{0.217947185f, 0.45022428f},
-std::array<float,2>{0.127764076f, 0.535116613f},
-std::array<float,2>{0.89766407f, 0.234305367f},
-std::array<float,2>{0.569702327f, 0.975485504f},
-std::array<float,2>{0.438673437f, 0.303071231f},
-std::array<float,2>{0.293043554f, 0.867781401f},
-std::array<float,2>{0.686067164f, 0.413745284f},
-std::array<float,2>{0.76759398f, 0.673860729f},
-std::array<float,2>{0.121172599f, 0.056352403f},
-std::array<float,2>{0.245771721f, 0.770561635f},
-std::array<float,2>{0.994661331f, 0.472277313f},
-std::array<float,2>{0.534904599f, 0.721193373f},
-std::array<float,2>{0.406185031f, 0.070235692f},
-std::array<float,2>{0.319395721f, 0.571433842f},
-std::array<float,2>{0.73044163f, 0.142472818f},
-std::array<float,2>{0.840158343f, 0.918662786f},
-std::array<float,2>{0.0442171693f, 0.355867177f},
-std::array<float,2>{0.0883229002f, 0.647852361f},
-std::array<float,2>{0.791525424f, 0.0136815449f},
-std::array<float,2>{0.631113589f, 0.823409319f},
-std::array<float,2>{0.264848799f, 0.379686922f},
-std::array<float,2>{0.482341468f, 0.959665418f},
-std::array<float,2>{0.598092318f, 0.253512502f},
-std::array<float,2>{0.921539128f, 0.505663097f},
-std::array<float,2>{0.182092652f, 0.193607882f},
-std::array<float,2>{0.0364353843f, 0.812074184f},
-std::array<float,2>{0.831838906f, 0.440712422f},
-std::array<float,2>{0.721549869f, 0.713019609f},
-std::array<float,2>{0.323786825f, 0.102723226f},
-std::array<float,2>{0.391162574f, 0.620387912f},
-std::array<float,2>{0.545797944f, 0.174195126f},
-std::array<float,2>{0.990686715f, 0.879228711f},
-std::array<float,2>{0.234869674f, 0.335961312f},
-std::array<float,2>{0.173307896f, 0.686701298f},
-std::array<float,2>{0.91277957f, 0.0494248457f},
-std::array<float,2>{0.605896652f, 0.866523862f},
-std::array<float,2>{0.474797785f, 0.418519974f},
-std::array<float,2>{0.251156807f, 0.976718128f},
-std::array<float,2>{0.636622071f, 0.306127787f},
-std::array<float,2>{0.787043035f, 0.545643508f},
-std::array<float,2>{0.0797600001f, 0.225425631f},
-std::array<float,2>{0.203318715f, 0.911997497f},
-std::array<float,2>{0.965380669f, 0.344293296f},
-std::array<float,2>{0.530098557f, 0.56605643f},
-std::array<float,2>{0.428154528f, 0.15400669f},
-std::array<float,2>{0.35563907f, 0.726798952f},
-std::array<float,2>{0.711129606f, 0.077711463f},
-std::array<float,2>{0.866520405f, 0.776830971f},
-std::array<float,2>{0.0263948273f, 0.478431106f},
-std::array<float,2>{0.11591018f, 0.509628117f},
-std::array<float,2>{0.773930252f, 0.200899705f},
-std::array<float,2>{0.679665983f, 0.965852499f},
-std::array<float,2>{0.283768803f, 0.262051374f},
-std::array<float,2>{0.451893479f, 0.815237641f},
-std::array<float,2>{0.576029003f, 0.385833025f},
-std::array<float,2>{0.902958572f, 0.64938581f},
-std::array<float,2>{0.136086658f, 0.00171318848f},
-std::array<float,2>{0.0683421418f, 0.946749926f},
-std::array<float,2>{0.807067752f, 0.278879195f},
-std::array<float,2>{0.642306745f, 0.522973657f},
-std::array<float,2>{0.279437751f, 0.204625994f},
-std::array<float,2>{0.493219733f, 0.627121806f},
-std::array<float,2>{0.622833729f, 0.0218627639f},
-std::array<float,2>{0.930046439f, 0.839173973f},
-std::array<float,2>{0.169635385f, 0.395242989f},
-std::array<float,2>{0.225155562f, 0.583575606f},
-std::array<float,2>{0.978354871f, 0.140559629f},
-std::array<float,2>{0.55849725f, 0.930494189f},
-std::array<float,2>{0.38651076f, 0.372244924f},
-std::array<float,2>{0.336371362f, 0.756061018f},
-std::array<float,2>{0.748848379f, 0.49166888f},
-std::array<float,2>{0.824016809f, 0.737509906f},
-std::array<float,2>{0.0499052443f, 0.0897558704f},
-std::array<float,2>{0.153914273f, 0.853206098f},
-std::array<float,2>{0.88007623f, 0.425392866f},
-std::array<float,2>{0.582844019f, 0.664639711f},
-std::array<float,2>{0.453681976f, 0.033037547f},
-std::array<float,2>{0.305413365f, 0.547793925f},
-std::array<float,2>{0.669004917f, 0.246370584f},
-std::array<float,2>{0.763981283f, 0.998324811f},
-std::array<float,2>{0.0997470543f, 0.281771749f},
-std::array<float,2>{0.00719174324f, 0.699033797f},
-std::array<float,2>{0.858142853f, 0.109779812f},
-std::array<float,2>{0.702700257f, 0.791330755f},
-std::array<float,2>{0.364223808f, 0.453902155f},
-std::array<float,2>{0.418602854f, 0.896445453f},
-std::array<float,2>{0.505442083f, 0.315937221f},
-std::array<float,2>{0.937812865f, 0.608707845f},
-std::array<float,2>{0.199434817f, 0.159375772f},
-std::array<float,2>{0.0125975441f, 0.860266984f},
-std::array<float,2>{0.84616065f, 0.414247453f},
-std::array<float,2>{0.687812507f, 0.682259619f},
-std::array<float,2>{0.368294656f, 0.0544104539f},
-std::array<float,2>{0.407862455f, 0.540364563f},
-std::array<float,2>{0.510748982f, 0.222282216f},
-std::array<float,2>{0.945418179f, 0.983857751f},
-std::array<float,2>{0.189854845f, 0.310048044f},
-std::array<float,2>{0.147224694f, 0.715800524f},
-std::array<float,2>{0.885545552f, 0.10912621f},
-std::array<float,2>{0.591408134f, 0.806865692f},
-std::array<float,2>{0.463182628f, 0.444379896f},
-std::array<float,2>{0.297489315f, 0.876243412f},
-std::array<float,2>{0.661953092f, 0.34021011f},
-std::array<float,2>{0.757425308f, 0.62413156f},
-std::array<float,2>{0.109017827f, 0.176466256f},
-std::array<float,2>{0.227449328f, 0.963398755f},
-std::array<float,2>{0.973013103f, 0.259930342f},
-std::array<float,2>{0.552034259f, 0.513159156f},
-std::array<float,2>{0.376342624f, 0.195382997f},
-std::array<float,2>{0.329361618f, 0.652373075f},
-std::array<float,2>{0.73962152f, 0.00569066964f},
-std::array<float,2>{0.819296062f, 0.819634438f},
-std::array<float,2>{0.059683267f, 0.388114303f},
-std::array<float,2>{0.0734297484f, 0.567202151f},
-std::array<float,2>{0.801722407f, 0.151103884f},
-std::array<float,2>{0.654192865f, 0.909972072f},
-std::array<float,2>{0.272813916f, 0.351173133f},
-std::array<float,2>{0.487461656f, 0.778681278f},
-std::array<float,2>{0.613936305f, 0.481584907f},
-std::array<float,2>{0.929402709f, 0.733118653f},
-std::array<float,2>{0.15876402f, 0.0736553967f},
-std::array<float,2>{0.119061843f, 0.935748816f},
-std::array<float,2>{0.772595644f, 0.367281854f},
-std::array<float,2>{0.681695879f, 0.581037462f},
-std::array<float,2>{0.292499065f, 0.134123296f},
-std::array<float,2>{0.44457823f, 0.74192977f},
-std::array<float,2>{0.563692391f, 0.0932635292f},
-std::array<float,2>{0.891794384f, 0.751416385f},
-std::array<float,2>{0.132367373f, 0.48639074f},
-std::array<float,2>{0.213970736f, 0.518080175f},
-std::array<float,2>{0.958857059f, 0.208397344f},
-std::array<float,2>{0.517186701f, 0.951538622f},
-std::array<float,2>{0.437161595f, 0.273702681f},
-std::array<float,2>{0.351014584f, 0.840144455f},
-std::array<float,2>{0.7087183f, 0.391605705f},
-std::array<float,2>{0.872219801f, 0.630520701f},
-std::array<float,2>{0.0188339315f, 0.0175678059f},
-std::array<float,2>{0.186529994f, 0.793669105f},
-std::array<float,2>{0.914935708f, 0.458097428f},
-std::array<float,2>{0.594109952f, 0.699273825f},
-std::array<float,2>{0.478194982f, 0.115347102f},
-std::array<float,2>{0.259592474f, 0.60230422f},
-std::array<float,2>{0.627198517f, 0.161237016f},
-std::array<float,2>{0.79611814f, 0.892932534f},
-std::array<float,2>{0.0926272944f, 0.318887413f},
-std::array<float,2>{0.0397248305f, 0.670499504f},
-std::array<float,2>{0.839378595f, 0.0387639366f},
-std::array<float,2>{0.734318733f, 0.858744383f},
-std::array<float,2>{0.315331459f, 0.428265482f},
-std::array<float,2>{0.401987165f, 0.995821476f},
-std::array<float,2>{0.53783524f, 0.286094695f},
-std::array<float,2>{0.998654127f, 0.551459193f},
-std::array<float,2>{0.248761907f, 0.244559079f},
-std::array<float,2>{0.0841576755f, 0.764316082f},
-std::array<float,2>{0.783165276f, 0.495645106f},
-std::array<float,2>{0.639206052f, 0.742667973f},
-std::array<float,2>{0.255189091f, 0.0812681392f},
-std::array<float,2>{0.468768746f, 0.589558244f},
-std::array<float,2>{0.605336189f, 0.131298497f},
-std::array<float,2>{0.906458616f, 0.922802925f},
-std::array<float,2>{0.179333761f, 0.365429014f},
-std::array<float,2>{0.238927409f, 0.638631344f},
-std::array<float,2>{0.984376848f, 0.0301263649f},
-std::array<float,2>{0.539932311f, 0.83220911f},
-std::array<float,2>{0.398190975f, 0.39880386f},
-std::array<float,2>{0.324957907f, 0.937716901f},
-std::array<float,2>{0.724900424f, 0.273183733f},
-std::array<float,2>{0.832749426f, 0.530978918f},
-std::array<float,2>{0.0338851549f, 0.211842909f},
-std::array<float,2>{0.139782697f, 0.902594388f},
-std::array<float,2>{0.900799334f, 0.32794264f},
-std::array<float,2>{0.570546746f, 0.596834898f},
-std::array<float,2>{0.447693527f, 0.168523967f},
-std::array<float,2>{0.286398411f, 0.691879392f},
-std::array<float,2>{0.672213197f, 0.119100004f},
-std::array<float,2>{0.779160023f, 0.788125575f},
-std::array<float,2>{0.111554407f, 0.466293931f},
-std::array<float,2>{0.0300619639f, 0.555995286f},
-std::array<float,2>{0.861136138f, 0.239811152f},
-std::array<float,2>{0.717225969f, 0.991832197f},
-std::array<float,2>{0.352313459f, 0.293603331f},
-std::array<float,2>{0.422330022f, 0.846376598f},
-std::array<float,2>{0.52665025f, 0.435749024f},
-std::array<float,2>{0.963017762f, 0.662997305f},
-std::array<float,2>{0.209555298f, 0.0437599234f},
-std::array<float,2>{0.0533200204f, 0.97134465f},
-std::array<float,2>{0.82477814f, 0.299659133f},
-std::array<float,2>{0.745166421f, 0.535348177f},
-std::array<float,2>{0.34120661f, 0.228877142f},
-std::array<float,2>{0.388378769f, 0.677526653f},
-std::array<float,2>{0.560843408f, 0.0596267134f},
-std::array<float,2>{0.980879247f, 0.873382926f},
-std::array<float,2>{0.219395369f, 0.409813255f},
-std::array<float,2>{0.165339753f, 0.617045283f},
-std::array<float,2>{0.93707478f, 0.185305238f},
-std::array<float,2>{0.618197322f, 0.890611887f},
-std::array<float,2>{0.499897987f, 0.330068141f},
-std::array<float,2>{0.274085373f, 0.80339843f},
-std::array<float,2>{0.646503448f, 0.446092904f},
-std::array<float,2>{0.812403023f, 0.704332709f},
-std::array<float,2>{0.0626768991f, 0.0949417278f},
-std::array<float,2>{0.198060274f, 0.827023745f},
-std::array<float,2>{0.943728387f, 0.375146866f},
-std::array<float,2>{0.501424015f, 0.640670002f},
-std::array<float,2>{0.416473359f, 0.0107065197f},
-std::array<float,2>{0.362715483f, 0.501088619f},
-std::array<float,2>{0.696445465f, 0.190290108f},
-std::array<float,2>{0.854704618f, 0.955252647f},
-std::array<float,2>{0.000811353268f, 0.255728632f},
-std::array<float,2>{0.0942234173f, 0.723905742f},
-std::array<float,2>{0.758876622f, 0.0633371472f},
-std::array<float,2>{0.665138543f, 0.768452585f},
-std::array<float,2>{0.309372693f, 0.473750502f},
-std::array<float,2>{0.459569454f, 0.916357398f},
-std::array<float,2>{0.580319345f, 0.353996634f},
-std::array<float,2>{0.87650311f, 0.575150549f},
-std::array<float,2>{0.14852871f, 0.14598304f},
-std::array<float,2>{0.100119196f, 0.854697347f},
-std::array<float,2>{0.764618933f, 0.422670513f},
-std::array<float,2>{0.669661641f, 0.666199327f},
-std::array<float,2>{0.304897577f, 0.0332326964f},
-std::array<float,2>{0.453494161f, 0.549224019f},
-std::array<float,2>{0.582105041f, 0.249983519f},
-std::array<float,2>{0.880750775f, 0.997635365f},
-std::array<float,2>{0.153372303f, 0.284593165f},
-std::array<float,2>{0.199974909f, 0.696294308f},
-std::array<float,2>{0.938006938f, 0.113106459f},
-std::array<float,2>{0.505034804f, 0.790768385f},
-std::array<float,2>{0.41839999f, 0.455909848f},
-std::array<float,2>{0.363579452f, 0.898285925f},
-std::array<float,2>{0.702596724f, 0.314006716f},
-std::array<float,2>{0.857487857f, 0.607119799f},
-std::array<float,2>{0.00750122126f, 0.156782046f},
-std::array<float,2>{0.169221982f, 0.947832286f},
-std::array<float,2>{0.930597723f, 0.279969245f},
-std::array<float,2>{0.622307897f, 0.521312594f},
-std::array<float,2>{0.493863463f, 0.205422491f},
-std::array<float,2>{0.280187726f, 0.625841796f},
-std::array<float,2>{0.642017066f, 0.0207506362f},
-std::array<float,2>{0.807610929f, 0.836734712f},
-std::array<float,2>{0.0675601959f, 0.397973984f},
-std::array<float,2>{0.0504750051f, 0.584330678f},
-std::array<float,2>{0.823522806f, 0.137594953f},
-std::array<float,2>{0.748301029f, 0.93290174f},
-std::array<float,2>{0.336741507f, 0.373253018f},
-std::array<float,2>{0.386023462f, 0.754885316f},
-std::array<float,2>{0.55766803f, 0.488993406f},
-std::array<float,2>{0.977679253f, 0.734669983f},
-std::array<float,2>{0.224645108f, 0.0863045156f},
-std::array<float,2>{0.0272378437f, 0.913689673f},
-std::array<float,2>{0.866822302f, 0.347346932f},
-std::array<float,2>{0.711912751f, 0.564169824f},
-std::array<float,2>{0.356438398f, 0.154589817f},
-std::array<float,2>{0.428431958f, 0.729248106f},
-std::array<float,2>{0.529723346f, 0.0752025098f},
-std::array<float,2>{0.96522814f, 0.775338173f},
-std::array<float,2>{0.203999892f, 0.480181307f},
-std::array<float,2>{0.136554852f, 0.510857821f},
-std::array<float,2>{0.902681053f, 0.201823741f},
-std::array<float,2>{0.575445712f, 0.968587697f},
-std::array<float,2>{0.45153451f, 0.265364438f},
-std::array<float,2>{0.283470362f, 0.812877238f},
-std::array<float,2>{0.679054379f, 0.383300155f},
-std::array<float,2>{0.773621917f, 0.650911331f},
-std::array<float,2>{0.115699135f, 0.00210106443f},
-std::array<float,2>{0.234680086f, 0.809610963f},
-std::array<float,2>{0.990765691f, 0.437771112f},
-std::array<float,2>{0.545391798f, 0.711554766f},
-std::array<float,2>{0.390812457f, 0.104584731f},
-std::array<float,2>{0.323577225f, 0.618451059f},
-std::array<float,2>{0.720811903f, 0.173394307f},
-std::array<float,2>{0.831390977f, 0.881481707f},
-std::array<float,2>{0.0368991978f, 0.337950706f},
-std::array<float,2>{0.0793996304f, 0.684855402f},
-std::array<float,2>{0.786188304f, 0.0476642661f},
-std::array<float,2>{0.636209905f, 0.863726139f},
-std::array<float,2>{0.251822919f, 0.420484275f},
-std::array<float,2>{0.475207865f, 0.979925811f},
-std::array<float,2>{0.606439054f, 0.307371736f},
-std::array<float,2>{0.912150502f, 0.543624878f},
-std::array<float,2>{0.173545122f, 0.22425276f},
-std::array<float,2>{0.0445535742f, 0.772376657f},
-std::array<float,2>{0.840676069f, 0.469921887f},
-std::array<float,2>{0.72949779f, 0.719140291f},
-std::array<float,2>{0.32030201f, 0.0665454417f},
-std::array<float,2>{0.405508697f, 0.57405591f},
-std::array<float,2>{0.534426212f, 0.144132912f},
-std::array<float,2>{0.994294465f, 0.920558214f},
-std::array<float,2>{0.245435745f, 0.358492166f},
-std::array<float,2>{0.182133049f, 0.645296991f},
-std::array<float,2>{0.921146572f, 0.0121516008f},
-std::array<float,2>{0.598323524f, 0.820590436f},
-std::array<float,2>{0.481520534f, 0.381222725f},
-std::array<float,2>{0.265324771f, 0.958211958f},
-std::array<float,2>{0.631801784f, 0.250095278f},
-std::array<float,2>{0.791312993f, 0.506922007f},
-std::array<float,2>{0.0884300247f, 0.192732453f},
-std::array<float,2>{0.218356356f, 0.885834634f},
-std::array<float,2>{0.95395422f, 0.334796727f},
-std::array<float,2>{0.520098329f, 0.609743655f},
-std::array<float,2>{0.430922598f, 0.18186678f},
-std::array<float,2>{0.344683409f, 0.709753454f},
-std::array<float,2>{0.704738081f, 0.0990981758f},
-std::array<float,2>{0.869345129f, 0.80073446f},
-std::array<float,2>{0.0218405947f, 0.452385634f},
-std::array<float,2>{0.121787012f, 0.532365084f},
-std::array<float,2>{0.768128276f, 0.231175974f},
-std::array<float,2>{0.685804486f, 0.972761691f},
-std::array<float,2>{0.293803632f, 0.300998002f},
-std::array<float,2>{0.439258903f, 0.87079668f},
-std::array<float,2>{0.569982588f, 0.411239266f},
-std::array<float,2>{0.898304284f, 0.673513234f},
-std::array<float,2>{0.127074569f, 0.0568577945f},
-std::array<float,2>{0.0758480355f, 0.985364795f},
-std::array<float,2>{0.798428774f, 0.289160848f},
-std::array<float,2>{0.650380135f, 0.558853149f},
-std::array<float,2>{0.268623471f, 0.236298293f},
-std::array<float,2>{0.490327775f, 0.657833636f},
-std::array<float,2>{0.612263858f, 0.0415507481f},
-std::array<float,2>{0.924644232f, 0.851115823f},
-std::array<float,2>{0.162598923f, 0.432417423f},
-std::array<float,2>{0.233626246f, 0.599232495f},
-std::array<float,2>{0.968756437f, 0.16562137f},
-std::array<float,2>{0.548165441f, 0.900052726f},
-std::array<float,2>{0.379037172f, 0.322760195f},
-std::array<float,2>{0.332792073f, 0.782187164f},
-std::array<float,2>{0.737794638f, 0.462560058f},
-std::array<float,2>{0.813993156f, 0.690557122f},
-std::array<float,2>{0.054791972f, 0.121498875f},
-std::array<float,2>{0.141038164f, 0.829645813f},
-std::array<float,2>{0.88849628f, 0.40379259f},
-std::array<float,2>{0.587190151f, 0.633430779f},
-std::array<float,2>{0.464862913f, 0.0257662479f},
-std::array<float,2>{0.301186204f, 0.52585417f},
-std::array<float,2>{0.658631146f, 0.218477234f},
-std::array<float,2>{0.750257671f, 0.944117963f},
-std::array<float,2>{0.104956523f, 0.265788436f},
-std::array<float,2>{0.0100701954f, 0.748809755f},
-std::array<float,2>{0.848805964f, 0.0840474293f},
-std::array<float,2>{0.692642808f, 0.760502279f},
-std::array<float,2>{0.374023616f, 0.498251081f},
-std::array<float,2>{0.410203993f, 0.928875327f},
-std::array<float,2>{0.515437126f, 0.36224407f},
-std::array<float,2>{0.949241459f, 0.591064274f},
-std::array<float,2>{0.19362767f, 0.126412392f},
-std::array<float,2>{1.64310459e-05f, 0.824419916f},
-std::array<float,2>{0.855299354f, 0.376994222f},
-std::array<float,2>{0.696804285f, 0.643810153f},
-std::array<float,2>{0.363101244f, 0.00895559322f},
-std::array<float,2>{0.416790187f, 0.502117395f},
-std::array<float,2>{0.501767874f, 0.188756958f},
-std::array<float,2>{0.944107354f, 0.955008268f},
-std::array<float,2>{0.197283193f, 0.257329434f},
-std::array<float,2>{0.149163038f, 0.725136042f},
-std::array<float,2>{0.876115918f, 0.0662841648f},
-std::array<float,2>{0.580699205f, 0.767216265f},
-std::array<float,2>{0.45928213f, 0.475057214f},
-std::array<float,2>{0.30905503f, 0.915982842f},
-std::array<float,2>{0.665718555f, 0.352470875f},
-std::array<float,2>{0.759732485f, 0.577016175f},
-std::array<float,2>{0.0947038978f, 0.147513464f},
-std::array<float,2>{0.218931854f, 0.969480097f},
-std::array<float,2>{0.98142159f, 0.29814896f},
-std::array<float,2>{0.561164379f, 0.538111329f},
-std::array<float,2>{0.388162702f, 0.227281645f},
-std::array<float,2>{0.341688842f, 0.677796304f},
-std::array<float,2>{0.746063173f, 0.0610504299f},
-std::array<float,2>{0.824451447f, 0.872184515f},
-std::array<float,2>{0.0531007759f, 0.406817555f},
-std::array<float,2>{0.0632813647f, 0.614059031f},
-std::array<float,2>{0.811557353f, 0.185804367f},
-std::array<float,2>{0.647148371f, 0.888459027f},
-std::array<float,2>{0.273617119f, 0.330192447f},
-std::array<float,2>{0.499448001f, 0.801870048f},
-std::array<float,2>{0.618846118f, 0.448147207f},
-std::array<float,2>{0.936728597f, 0.706419349f},
-std::array<float,2>{0.165704578f, 0.0971386507f},
-std::array<float,2>{0.112247005f, 0.905032158f},
-std::array<float,2>{0.778424203f, 0.324260473f},
-std::array<float,2>{0.672566891f, 0.59510994f},
-std::array<float,2>{0.286728621f, 0.171647549f},
-std::array<float,2>{0.448002845f, 0.694690168f},
-std::array<float,2>{0.570816994f, 0.119671218f},
-std::array<float,2>{0.90106672f, 0.786895573f},
-std::array<float,2>{0.140613452f, 0.468399942f},
-std::array<float,2>{0.2094616f, 0.5566414f},
-std::array<float,2>{0.963464856f, 0.240717635f},
-std::array<float,2>{0.527098358f, 0.988515139f},
-std::array<float,2>{0.422481894f, 0.295538217f},
-std::array<float,2>{0.351592988f, 0.843930244f},
-std::array<float,2>{0.717577219f, 0.433960408f},
-std::array<float,2>{0.860798359f, 0.660849214f},
-std::array<float,2>{0.0295658428f, 0.0459938683f},
-std::array<float,2>{0.17896767f, 0.763004601f},
-std::array<float,2>{0.906802833f, 0.493167937f},
-std::array<float,2>{0.604832292f, 0.745968282f},
-std::array<float,2>{0.469388455f, 0.0787907243f},
-std::array<float,2>{0.255474269f, 0.587863028f},
-std::array<float,2>{0.63895452f, 0.129785284f},
-std::array<float,2>{0.782470465f, 0.925296247f},
-std::array<float,2>{0.0846153125f, 0.364892632f},
-std::array<float,2>{0.0336035639f, 0.639240503f},
-std::array<float,2>{0.832389295f, 0.0289038327f},
-std::array<float,2>{0.725281298f, 0.834236562f},
-std::array<float,2>{0.324520826f, 0.401987344f},
-std::array<float,2>{0.397784621f, 0.940177381f},
-std::array<float,2>{0.539509296f, 0.269657105f},
-std::array<float,2>{0.985115767f, 0.528176844f},
-std::array<float,2>{0.238423809f, 0.214490965f},
-std::array<float,2>{0.0921460241f, 0.796230197f},
-std::array<float,2>{0.796729565f, 0.460182577f},
-std::array<float,2>{0.62773639f, 0.702698231f},
-std::array<float,2>{0.259225428f, 0.114754707f},
-std::array<float,2>{0.477610439f, 0.604208708f},
-std::array<float,2>{0.594456792f, 0.162868977f},
-std::array<float,2>{0.914231658f, 0.891326487f},
-std::array<float,2>{0.187431574f, 0.317605793f},
-std::array<float,2>{0.248477608f, 0.669752896f},
-std::array<float,2>{0.998184323f, 0.0360946096f},
-std::array<float,2>{0.53744489f, 0.855589926f},
-std::array<float,2>{0.401818991f, 0.426740706f},
-std::array<float,2>{0.31483525f, 0.992628098f},
-std::array<float,2>{0.733733594f, 0.287475616f},
-std::array<float,2>{0.838913441f, 0.554064155f},
-std::array<float,2>{0.0390727557f, 0.242243692f},
-std::array<float,2>{0.132196009f, 0.934329331f},
-std::array<float,2>{0.892513573f, 0.37080577f},
-std::array<float,2>{0.564267874f, 0.579372585f},
-std::array<float,2>{0.445021242f, 0.135893777f},
-std::array<float,2>{0.292438149f, 0.739558339f},
-std::array<float,2>{0.682487011f, 0.0914746448f},
-std::array<float,2>{0.77338016f, 0.753356695f},
-std::array<float,2>{0.118464276f, 0.484600008f},
-std::array<float,2>{0.019085763f, 0.517498255f},
-std::array<float,2>{0.873035252f, 0.210675895f},
-std::array<float,2>{0.708396435f, 0.950428784f},
-std::array<float,2>{0.351106644f, 0.275974035f},
-std::array<float,2>{0.436536789f, 0.841935873f},
-std::array<float,2>{0.516629159f, 0.392814934f},
-std::array<float,2>{0.958351314f, 0.632535398f},
-std::array<float,2>{0.214732632f, 0.0180520676f},
-std::array<float,2>{0.0604857653f, 0.96209383f},
-std::array<float,2>{0.818709493f, 0.258805752f},
-std::array<float,2>{0.740107536f, 0.51513201f},
-std::array<float,2>{0.32987234f, 0.198364452f},
-std::array<float,2>{0.376715362f, 0.656050026f},
-std::array<float,2>{0.55267638f, 0.00648299744f},
-std::array<float,2>{0.973474145f, 0.817201793f},
-std::array<float,2>{0.226679429f, 0.390234828f},
-std::array<float,2>{0.158543378f, 0.569185257f},
-std::array<float,2>{0.92900449f, 0.148855731f},
-std::array<float,2>{0.613454998f, 0.907175422f},
-std::array<float,2>{0.488216549f, 0.349181265f},
-std::array<float,2>{0.273399621f, 0.780249059f},
-std::array<float,2>{0.65344429f, 0.482805908f},
-std::array<float,2>{0.800877333f, 0.731560171f},
-std::array<float,2>{0.0739727467f, 0.0710876808f},
-std::array<float,2>{0.190316498f, 0.862724006f},
-std::array<float,2>{0.945849895f, 0.417336553f},
-std::array<float,2>{0.51132071f, 0.679931939f},
-std::array<float,2>{0.407648116f, 0.0524795689f},
-std::array<float,2>{0.368909776f, 0.54157871f},
-std::array<float,2>{0.688041151f, 0.219900906f},
-std::array<float,2>{0.846504807f, 0.982371449f},
-std::array<float,2>{0.0117305685f, 0.311183572f},
-std::array<float,2>{0.108710974f, 0.718541563f},
-std::array<float,2>{0.756892145f, 0.106502414f},
-std::array<float,2>{0.661390483f, 0.805111587f},
-std::array<float,2>{0.297078997f, 0.44151634f},
-std::array<float,2>{0.463394076f, 0.878390193f},
-std::array<float,2>{0.591204226f, 0.343422085f},
-std::array<float,2>{0.884950936f, 0.621184766f},
-std::array<float,2>{0.146957263f, 0.179634824f},
-std::array<float,2>{0.0699297935f, 0.839441001f},
-std::array<float,2>{0.806034684f, 0.39467442f},
-std::array<float,2>{0.6443367f, 0.627772808f},
-std::array<float,2>{0.277923733f, 0.0222106185f},
-std::array<float,2>{0.494440436f, 0.522568524f},
-std::array<float,2>{0.62413913f, 0.204301909f},
-std::array<float,2>{0.932351172f, 0.946835995f},
-std::array<float,2>{0.171124265f, 0.278394878f},
-std::array<float,2>{0.223777637f, 0.738027036f},
-std::array<float,2>{0.978881657f, 0.0892953798f},
-std::array<float,2>{0.555015981f, 0.756764531f},
-std::array<float,2>{0.384236872f, 0.491881311f},
-std::array<float,2>{0.339773893f, 0.929948628f},
-std::array<float,2>{0.747516751f, 0.372849256f},
-std::array<float,2>{0.822125137f, 0.583378315f},
-std::array<float,2>{0.0472943559f, 0.139980137f},
-std::array<float,2>{0.15596056f, 0.998733759f},
-std::array<float,2>{0.88133955f, 0.281694114f},
-std::array<float,2>{0.584169447f, 0.547213972f},
-std::array<float,2>{0.45663622f, 0.246912897f},
-std::array<float,2>{0.307310671f, 0.664515555f},
-std::array<float,2>{0.670677423f, 0.0323307142f},
-std::array<float,2>{0.762887597f, 0.852858245f},
-std::array<float,2>{0.0976770446f, 0.425147325f},
-std::array<float,2>{0.00547198672f, 0.608983517f},
-std::array<float,2>{0.855608404f, 0.160142869f},
-std::array<float,2>{0.700870216f, 0.895895243f},
-std::array<float,2>{0.366926044f, 0.315702707f},
-std::array<float,2>{0.420185357f, 0.791985631f},
-std::array<float,2>{0.507760465f, 0.453477979f},
-std::array<float,2>{0.940445602f, 0.698365331f},
-std::array<float,2>{0.201445684f, 0.110113144f},
-std::array<float,2>{0.0371522233f, 0.879840076f},
-std::array<float,2>{0.829699993f, 0.336687565f},
-std::array<float,2>{0.720350266f, 0.620683491f},
-std::array<float,2>{0.32039848f, 0.174573585f},
-std::array<float,2>{0.393344998f, 0.71341908f},
-std::array<float,2>{0.544004261f, 0.103053875f},
-std::array<float,2>{0.989383638f, 0.811799169f},
-std::array<float,2>{0.237535134f, 0.441208988f},
-std::array<float,2>{0.174614564f, 0.545176804f},
-std::array<float,2>{0.910403013f, 0.224895164f},
-std::array<float,2>{0.609084606f, 0.977297604f},
-std::array<float,2>{0.472801298f, 0.306571633f},
-std::array<float,2>{0.252942592f, 0.86675483f},
-std::array<float,2>{0.634585202f, 0.418113023f},
-std::array<float,2>{0.787662446f, 0.68742317f},
-std::array<float,2>{0.0805106983f, 0.0490515605f},
-std::array<float,2>{0.20571816f, 0.777012587f},
-std::array<float,2>{0.966874003f, 0.477758408f},
-std::array<float,2>{0.527805924f, 0.727264047f},
-std::array<float,2>{0.426065266f, 0.0772920772f},
-std::array<float,2>{0.357538819f, 0.565868378f},
-std::array<float,2>{0.714773417f, 0.153652653f},
-std::array<float,2>{0.864290297f, 0.911435962f},
-std::array<float,2>{0.0249895584f, 0.343913496f},
-std::array<float,2>{0.115034834f, 0.648728669f},
-std::array<float,2>{0.776290774f, 0.00114971818f},
-std::array<float,2>{0.675913632f, 0.814594865f},
-std::array<float,2>{0.282390326f, 0.38631171f},
-std::array<float,2>{0.449325323f, 0.966664672f},
-std::array<float,2>{0.578027904f, 0.262329251f},
-std::array<float,2>{0.905654848f, 0.509272754f},
-std::array<float,2>{0.133575246f, 0.200419784f},
-std::array<float,2>{0.0213189162f, 0.797764778f},
-std::array<float,2>{0.867550313f, 0.451124936f},
-std::array<float,2>{0.706301212f, 0.708934665f},
-std::array<float,2>{0.347570986f, 0.100090817f},
-std::array<float,2>{0.432399631f, 0.612652004f},
-std::array<float,2>{0.522704899f, 0.179796442f},
-std::array<float,2>{0.95568496f, 0.883195758f},
-std::array<float,2>{0.215954438f, 0.333049029f},
-std::array<float,2>{0.125858426f, 0.674514413f},
-std::array<float,2>{0.895065844f, 0.0560885221f},
-std::array<float,2>{0.56666857f, 0.867391706f},
-std::array<float,2>{0.440179557f, 0.4134202f},
-std::array<float,2>{0.295590371f, 0.974748909f},
-std::array<float,2>{0.683792889f, 0.303222716f},
-std::array<float,2>{0.767159641f, 0.534599185f},
-std::array<float,2>{0.12447165f, 0.233464807f},
-std::array<float,2>{0.243516535f, 0.91802007f},
-std::array<float,2>{0.993009865f, 0.356281787f},
-std::array<float,2>{0.533018708f, 0.571931958f},
-std::array<float,2>{0.403774559f, 0.142044753f},
-std::array<float,2>{0.318086028f, 0.720967591f},
-std::array<float,2>{0.726776302f, 0.0696351156f},
-std::array<float,2>{0.842403114f, 0.771011591f},
-std::array<float,2>{0.0452001989f, 0.472137034f},
-std::array<float,2>{0.087593928f, 0.505101979f},
-std::array<float,2>{0.789779007f, 0.194175839f},
-std::array<float,2>{0.630424261f, 0.959461749f},
-std::array<float,2>{0.262197256f, 0.253002107f},
-std::array<float,2>{0.482685566f, 0.824052453f},
-std::array<float,2>{0.60049355f, 0.379302412f},
-std::array<float,2>{0.919756591f, 0.648073554f},
-std::array<float,2>{0.181122631f, 0.0144151486f},
-std::array<float,2>{0.101588584f, 0.943291843f},
-std::array<float,2>{0.75353241f, 0.269424677f},
-std::array<float,2>{0.657087266f, 0.523979366f},
-std::array<float,2>{0.304203898f, 0.215657875f},
-std::array<float,2>{0.468595773f, 0.635165632f},
-std::array<float,2>{0.589550495f, 0.0239219256f},
-std::array<float,2>{0.89015305f, 0.8318609f},
-std::array<float,2>{0.14266336f, 0.404595315f},
-std::array<float,2>{0.192715451f, 0.591928661f},
-std::array<float,2>{0.951233089f, 0.128153428f},
-std::array<float,2>{0.512479544f, 0.926658571f},
-std::array<float,2>{0.414052814f, 0.360931784f},
-std::array<float,2>{0.371219158f, 0.758786201f},
-std::array<float,2>{0.694444537f, 0.497309595f},
-std::array<float,2>{0.8509745f, 0.746158361f},
-std::array<float,2>{0.00811785646f, 0.0830088109f},
-std::array<float,2>{0.161315456f, 0.847668529f},
-std::array<float,2>{0.922144473f, 0.429942846f},
-std::array<float,2>{0.609600723f, 0.660127819f},
-std::array<float,2>{0.489015609f, 0.0393212102f},
-std::array<float,2>{0.267277122f, 0.562452257f},
-std::array<float,2>{0.651799798f, 0.238073885f},
-std::array<float,2>{0.800163984f, 0.986480832f},
-std::array<float,2>{0.0772155449f, 0.291263312f},
-std::array<float,2>{0.0571425185f, 0.688039422f},
-std::array<float,2>{0.815600514f, 0.124143943f},
-std::array<float,2>{0.736131728f, 0.783961475f},
-std::array<float,2>{0.334188402f, 0.46421966f},
-std::array<float,2>{0.382750124f, 0.901856005f},
-std::array<float,2>{0.54998064f, 0.320939392f},
-std::array<float,2>{0.972001374f, 0.600822926f},
-std::array<float,2>{0.230997458f, 0.16779232f},
-std::array<float,2>{0.0527308062f, 0.873566628f},
-std::array<float,2>{0.827132642f, 0.409506202f},
-std::array<float,2>{0.742714047f, 0.676886261f},
-std::array<float,2>{0.342300147f, 0.0603084303f},
-std::array<float,2>{0.389483005f, 0.535942972f},
-std::array<float,2>{0.560058355f, 0.229370341f},
-std::array<float,2>{0.984208465f, 0.970902979f},
-std::array<float,2>{0.220987737f, 0.298946083f},
-std::array<float,2>{0.166511148f, 0.70471257f},
-std::array<float,2>{0.934816658f, 0.0953295156f},
-std::array<float,2>{0.61918515f, 0.802858114f},
-std::array<float,2>{0.49721083f, 0.445774019f},
-std::array<float,2>{0.275847137f, 0.889650702f},
-std::array<float,2>{0.644590259f, 0.329378128f},
-std::array<float,2>{0.810372829f, 0.616427302f},
-std::array<float,2>{0.0656631514f, 0.184677243f},
-std::array<float,2>{0.195481926f, 0.955894351f},
-std::array<float,2>{0.943275988f, 0.255144328f},
-std::array<float,2>{0.50311178f, 0.501732051f},
-std::array<float,2>{0.414913893f, 0.189706951f},
-std::array<float,2>{0.359767735f, 0.641377091f},
-std::array<float,2>{0.69802475f, 0.00990365911f},
-std::array<float,2>{0.853321671f, 0.82644999f},
-std::array<float,2>{0.00249794335f, 0.375698566f},
-std::array<float,2>{0.0964794904f, 0.574379504f},
-std::array<float,2>{0.761391103f, 0.146460667f},
-std::array<float,2>{0.666978538f, 0.916565776f},
-std::array<float,2>{0.310976475f, 0.354199976f},
-std::array<float,2>{0.457278609f, 0.768008292f},
-std::array<float,2>{0.579154134f, 0.474183261f},
-std::array<float,2>{0.878352344f, 0.724339008f},
-std::array<float,2>{0.152087122f, 0.0627603978f},
-std::array<float,2>{0.0827273279f, 0.922165453f},
-std::array<float,2>{0.784128547f, 0.366057843f},
-std::array<float,2>{0.637954295f, 0.588995934f},
-std::array<float,2>{0.256077766f, 0.13182804f},
-std::array<float,2>{0.470942318f, 0.743024528f},
-std::array<float,2>{0.601803124f, 0.0818241239f},
-std::array<float,2>{0.910112381f, 0.763937891f},
-std::array<float,2>{0.175953493f, 0.495200753f},
-std::array<float,2>{0.240289837f, 0.530532122f},
-std::array<float,2>{0.986504734f, 0.211065605f},
-std::array<float,2>{0.541946292f, 0.938394845f},
-std::array<float,2>{0.395949543f, 0.272762716f},
-std::array<float,2>{0.327437133f, 0.832672656f},
-std::array<float,2>{0.723750651f, 0.399225622f},
-std::array<float,2>{0.835123122f, 0.638182938f},
-std::array<float,2>{0.0321063362f, 0.0297803897f},
-std::array<float,2>{0.138628185f, 0.788923979f},
-std::array<float,2>{0.899746597f, 0.466558367f},
-std::array<float,2>{0.574008465f, 0.692284107f},
-std::array<float,2>{0.446759641f, 0.118322045f},
-std::array<float,2>{0.288022935f, 0.597262442f},
-std::array<float,2>{0.674630165f, 0.168431997f},
-std::array<float,2>{0.780779898f, 0.903238952f},
-std::array<float,2>{0.110036857f, 0.327172816f},
-std::array<float,2>{0.0290931035f, 0.662562728f},
-std::array<float,2>{0.86252749f, 0.043267969f},
-std::array<float,2>{0.716297626f, 0.84606415f},
-std::array<float,2>{0.354483157f, 0.436097234f},
-std::array<float,2>{0.42513153f, 0.991487861f},
-std::array<float,2>{0.524014056f, 0.293068379f},
-std::array<float,2>{0.962281585f, 0.556242168f},
-std::array<float,2>{0.208483309f, 0.239323467f},
-std::array<float,2>{0.120325767f, 0.751579225f},
-std::array<float,2>{0.770919979f, 0.486859024f},
-std::array<float,2>{0.681444347f, 0.741341114f},
-std::array<float,2>{0.28950718f, 0.0932062343f},
-std::array<float,2>{0.441801548f, 0.580521941f},
-std::array<float,2>{0.564731777f, 0.134655088f},
-std::array<float,2>{0.894087136f, 0.936175346f},
-std::array<float,2>{0.130372182f, 0.367902279f},
-std::array<float,2>{0.21154356f, 0.629927754f},
-std::array<float,2>{0.960552812f, 0.0168822203f},
-std::array<float,2>{0.51950556f, 0.84068954f},
-std::array<float,2>{0.433742702f, 0.392295212f},
-std::array<float,2>{0.348779172f, 0.951802552f},
-std::array<float,2>{0.709724069f, 0.274069369f},
-std::array<float,2>{0.87312454f, 0.517630339f},
-std::array<float,2>{0.0158229209f, 0.208549127f},
-std::array<float,2>{0.183819652f, 0.893100202f},
-std::array<float,2>{0.916038513f, 0.318452746f},
-std::array<float,2>{0.597099125f, 0.601959229f},
-std::array<float,2>{0.479992241f, 0.161913931f},
-std::array<float,2>{0.260189474f, 0.699787676f},
-std::array<float,2>{0.625227153f, 0.115759976f},
-std::array<float,2>{0.7942577f, 0.792971075f},
-std::array<float,2>{0.0915133581f, 0.458594441f},
-std::array<float,2>{0.0416565016f, 0.55124712f},
-std::array<float,2>{0.837174594f, 0.244697168f},
-std::array<float,2>{0.732337594f, 0.995238423f},
-std::array<float,2>{0.312982321f, 0.285523832f},
-std::array<float,2>{0.399464786f, 0.858919382f},
-std::array<float,2>{0.535327137f, 0.427815169f},
-std::array<float,2>{0.996961355f, 0.669977784f},
-std::array<float,2>{0.246499762f, 0.0384447761f},
-std::array<float,2>{0.0145769594f, 0.984094918f},
-std::array<float,2>{0.84503603f, 0.310377419f},
-std::array<float,2>{0.69053483f, 0.540752053f},
-std::array<float,2>{0.369903922f, 0.221731722f},
-std::array<float,2>{0.409546226f, 0.682079136f},
-std::array<float,2>{0.509509265f, 0.0539350063f},
-std::array<float,2>{0.94802624f, 0.859447181f},
-std::array<float,2>{0.189176142f, 0.41471082f},
-std::array<float,2>{0.144671187f, 0.624680459f},
-std::array<float,2>{0.883586049f, 0.176150247f},
-std::array<float,2>{0.592816353f, 0.876467586f},
-std::array<float,2>{0.460938931f, 0.340567559f},
-std::array<float,2>{0.300742924f, 0.8074494f},
-std::array<float,2>{0.663126111f, 0.445044011f},
-std::array<float,2>{0.754263282f, 0.715076685f},
-std::array<float,2>{0.107049257f, 0.108844317f},
-std::array<float,2>{0.230213404f, 0.820112169f},
-std::array<float,2>{0.97615242f, 0.388292044f},
-std::array<float,2>{0.554637194f, 0.653215051f},
-std::array<float,2>{0.37785545f, 0.00511882827f},
-std::array<float,2>{0.330588371f, 0.513504446f},
-std::array<float,2>{0.740915895f, 0.196141824f},
-std::array<float,2>{0.816591501f, 0.963175774f},
-std::array<float,2>{0.0624018759f, 0.260649204f},
-std::array<float,2>{0.0717654228f, 0.732832193f},
-std::array<float,2>{0.803875268f, 0.0737792477f},
-std::array<float,2>{0.655729949f, 0.779043198f},
-std::array<float,2>{0.270045191f, 0.482092053f},
-std::array<float,2>{0.486194938f, 0.909486651f},
-std::array<float,2>{0.61670059f, 0.351026028f},
-std::array<float,2>{0.927253008f, 0.566632688f},
-std::array<float,2>{0.156444073f, 0.150819346f},
-std::array<float,2>{0.08192949f, 0.864432693f},
-std::array<float,2>{0.788901031f, 0.421050191f},
-std::array<float,2>{0.632971048f, 0.684522033f},
-std::array<float,2>{0.252684504f, 0.0483678915f},
-std::array<float,2>{0.474486381f, 0.544620216f},
-std::array<float,2>{0.607499897f, 0.223519087f},
-std::array<float,2>{0.91206491f, 0.978818059f},
-std::array<float,2>{0.174931124f, 0.307930201f},
-std::array<float,2>{0.236343995f, 0.712063313f},
-std::array<float,2>{0.988328755f, 0.103779137f},
-std::array<float,2>{0.543637455f, 0.808761775f},
-std::array<float,2>{0.394413799f, 0.439427078f},
-std::array<float,2>{0.322101235f, 0.882181466f},
-std::array<float,2>{0.719122052f, 0.339463949f},
-std::array<float,2>{0.82890451f, 0.618032575f},
-std::array<float,2>{0.0390053764f, 0.172332332f},
-std::array<float,2>{0.134757057f, 0.966865361f},
-std::array<float,2>{0.904472411f, 0.264440924f},
-std::array<float,2>{0.577079833f, 0.510672152f},
-std::array<float,2>{0.450270623f, 0.202864602f},
-std::array<float,2>{0.28219378f, 0.651749194f},
-std::array<float,2>{0.677068949f, 0.00324127567f},
-std::array<float,2>{0.777109861f, 0.814121485f},
-std::array<float,2>{0.11418651f, 0.384264767f},
-std::array<float,2>{0.0238256734f, 0.562523901f},
-std::array<float,2>{0.863300085f, 0.155307949f},
-std::array<float,2>{0.713451207f, 0.912523568f},
-std::array<float,2>{0.358728319f, 0.346537083f},
-std::array<float,2>{0.426789403f, 0.774217129f},
-std::array<float,2>{0.529242158f, 0.478695005f},
-std::array<float,2>{0.968254745f, 0.729562342f},
-std::array<float,2>{0.206781641f, 0.0744779557f},
-std::array<float,2>{0.048656065f, 0.93233496f},
-std::array<float,2>{0.821276784f, 0.374751061f},
-std::array<float,2>{0.746849239f, 0.585046172f},
-std::array<float,2>{0.3387703f, 0.13847807f},
-std::array<float,2>{0.383302391f, 0.735579371f},
-std::array<float,2>{0.556147575f, 0.0877838731f},
-std::array<float,2>{0.980151713f, 0.754065335f},
-std::array<float,2>{0.222951308f, 0.48962149f},
-std::array<float,2>{0.17015636f, 0.519709468f},
-std::array<float,2>{0.932804286f, 0.207010224f},
-std::array<float,2>{0.623808265f, 0.948265314f},
-std::array<float,2>{0.495744288f, 0.280391783f},
-std::array<float,2>{0.278841674f, 0.837712467f},
-std::array<float,2>{0.642736375f, 0.397027284f},
-std::array<float,2>{0.804716408f, 0.626290739f},
-std::array<float,2>{0.0685235411f, 0.020398872f},
-std::array<float,2>{0.203001857f, 0.789330006f},
-std::array<float,2>{0.940342486f, 0.456664622f},
-std::array<float,2>{0.506373703f, 0.696162522f},
-std::array<float,2>{0.421157002f, 0.111705475f},
-std::array<float,2>{0.366086304f, 0.605650187f},
-std::array<float,2>{0.700100064f, 0.157891199f},
-std::array<float,2>{0.857124329f, 0.896862924f},
-std::array<float,2>{0.00440966617f, 0.313184261f},
-std::array<float,2>{0.0988028646f, 0.667600513f},
-std::array<float,2>{0.761935294f, 0.034322191f},
-std::array<float,2>{0.671618998f, 0.854458153f},
-std::array<float,2>{0.307668418f, 0.423134387f},
-std::array<float,2>{0.455589116f, 0.996970654f},
-std::array<float,2>{0.58500731f, 0.283208013f},
-std::array<float,2>{0.88235265f, 0.550617158f},
-std::array<float,2>{0.154398382f, 0.248373553f},
-std::array<float,2>{0.00938765053f, 0.76160121f},
-std::array<float,2>{0.850577235f, 0.499655008f},
-std::array<float,2>{0.694070756f, 0.749520957f},
-std::array<float,2>{0.372186989f, 0.0851741657f},
-std::array<float,2>{0.412820905f, 0.590037882f},
-std::array<float,2>{0.51350385f, 0.125622571f},
-std::array<float,2>{0.952362478f, 0.927940428f},
-std::array<float,2>{0.19208096f, 0.362891078f},
-std::array<float,2>{0.143723473f, 0.634237528f},
-std::array<float,2>{0.889235973f, 0.0272782501f},
-std::array<float,2>{0.588727772f, 0.828545213f},
-std::array<float,2>{0.467347473f, 0.402694285f},
-std::array<float,2>{0.302869409f, 0.94517231f},
-std::array<float,2>{0.657568097f, 0.267118752f},
-std::array<float,2>{0.752847075f, 0.526824653f},
-std::array<float,2>{0.102878347f, 0.217772856f},
-std::array<float,2>{0.231865004f, 0.899331152f},
-std::array<float,2>{0.971330583f, 0.323355049f},
-std::array<float,2>{0.549182832f, 0.598375618f},
-std::array<float,2>{0.381822079f, 0.165032133f},
-std::array<float,2>{0.33500883f, 0.689927399f},
-std::array<float,2>{0.735049367f, 0.122185983f},
-std::array<float,2>{0.814859807f, 0.782569945f},
-std::array<float,2>{0.0578436404f, 0.461017191f},
-std::array<float,2>{0.0764725059f, 0.560438693f},
-std::array<float,2>{0.798945904f, 0.23519969f},
-std::array<float,2>{0.651230931f, 0.984828472f},
-std::array<float,2>{0.266276151f, 0.290822595f},
-std::array<float,2>{0.490100801f, 0.850043058f},
-std::array<float,2>{0.610555887f, 0.433285177f},
-std::array<float,2>{0.923526943f, 0.656973362f},
-std::array<float,2>{0.160800442f, 0.0423941836f},
-std::array<float,2>{0.123333439f, 0.974457145f},
-std::array<float,2>{0.766559064f, 0.302431285f},
-std::array<float,2>{0.685270071f, 0.532200694f},
-std::array<float,2>{0.295998335f, 0.231895059f},
-std::array<float,2>{0.44099772f, 0.672311544f},
-std::array<float,2>{0.567469299f, 0.0584922284f},
-std::array<float,2>{0.895699024f, 0.869423509f},
-std::array<float,2>{0.126704141f, 0.410265267f},
-std::array<float,2>{0.215562075f, 0.610362947f},
-std::array<float,2>{0.956180871f, 0.182830304f},
-std::array<float,2>{0.522293925f, 0.885332823f},
-std::array<float,2>{0.433139741f, 0.335756391f},
-std::array<float,2>{0.346313864f, 0.799131989f},
-std::array<float,2>{0.705705881f, 0.451479435f},
-std::array<float,2>{0.868301868f, 0.710241556f},
-std::array<float,2>{0.0196367558f, 0.09839838f},
-std::array<float,2>{0.179775923f, 0.821510315f},
-std::array<float,2>{0.918446481f, 0.382104427f},
-std::array<float,2>{0.600624681f, 0.646178305f},
-std::array<float,2>{0.483548313f, 0.0133775417f},
-std::array<float,2>{0.263444334f, 0.506302118f},
-std::array<float,2>{0.629759312f, 0.191630885f},
-std::array<float,2>{0.790360749f, 0.957613945f},
-std::array<float,2>{0.0868207887f, 0.251922667f},
-std::array<float,2>{0.0465264991f, 0.719917655f},
-std::array<float,2>{0.84355855f, 0.0680667013f},
-std::array<float,2>{0.728505373f, 0.772496343f},
-std::array<float,2>{0.317106515f, 0.469714791f},
-std::array<float,2>{0.402924031f, 0.921649635f},
-std::array<float,2>{0.531291187f, 0.357919455f},
-std::array<float,2>{0.993856609f, 0.572351575f},
-std::array<float,2>{0.242839709f, 0.143001765f},
-std::array<float,2>{0.0324878059f, 0.835726202f},
-std::array<float,2>{0.834156752f, 0.401007891f},
-std::array<float,2>{0.722893417f, 0.639698982f},
-std::array<float,2>{0.326608121f, 0.0278742164f},
-std::array<float,2>{0.395317197f, 0.52867949f},
-std::array<float,2>{0.542371631f, 0.213223368f},
-std::array<float,2>{0.988150895f, 0.94090122f},
-std::array<float,2>{0.241416067f, 0.271379232f},
-std::array<float,2>{0.177494735f, 0.744779825f},
-std::array<float,2>{0.909010828f, 0.0799547881f},
-std::array<float,2>{0.60296613f, 0.762654603f},
-std::array<float,2>{0.472000539f, 0.493113995f},
-std::array<float,2>{0.256949693f, 0.923863053f},
-std::array<float,2>{0.636867821f, 0.36409393f},
-std::array<float,2>{0.78499788f, 0.586210847f},
-std::array<float,2>{0.0833418369f, 0.130605012f},
-std::array<float,2>{0.20737648f, 0.989371359f},
-std::array<float,2>{0.961867392f, 0.29629904f},
-std::array<float,2>{0.525376499f, 0.558064282f},
-std::array<float,2>{0.424321592f, 0.241765514f},
-std::array<float,2>{0.354970068f, 0.662044525f},
-std::array<float,2>{0.715806365f, 0.0450536311f},
-std::array<float,2>{0.861943305f, 0.844763219f},
-std::array<float,2>{0.0278933421f, 0.434954971f},
-std::array<float,2>{0.110360518f, 0.593975127f},
-std::array<float,2>{0.77937007f, 0.170044586f},
-std::array<float,2>{0.675561607f, 0.905625522f},
-std::array<float,2>{0.288164943f, 0.326010257f},
-std::array<float,2>{0.44545716f, 0.785298884f},
-std::array<float,2>{0.573007882f, 0.466920823f},
-std::array<float,2>{0.898681283f, 0.694173813f},
-std::array<float,2>{0.137175515f, 0.120765254f},
-std::array<float,2>{0.0645777509f, 0.887640476f},
-std::array<float,2>{0.809110105f, 0.331410855f},
-std::array<float,2>{0.645928502f, 0.61438179f},
-std::array<float,2>{0.276444048f, 0.187077388f},
-std::array<float,2>{0.496912569f, 0.705246866f},
-std::array<float,2>{0.620946646f, 0.096052438f},
-std::array<float,2>{0.934513152f, 0.801573277f},
-std::array<float,2>{0.167545125f, 0.448247224f},
-std::array<float,2>{0.222631738f, 0.537129223f},
-std::array<float,2>{0.983156323f, 0.228073448f},
-std::array<float,2>{0.559463501f, 0.96997565f},
-std::array<float,2>{0.390507579f, 0.297397971f},
-std::array<float,2>{0.34310931f, 0.871240377f},
-std::array<float,2>{0.7436288f, 0.407378674f},
-std::array<float,2>{0.827867329f, 0.679015636f},
-std::array<float,2>{0.0514768846f, 0.061894726f},
-std::array<float,2>{0.151134998f, 0.766185343f},
-std::array<float,2>{0.877048075f, 0.476006299f},
-std::array<float,2>{0.578930855f, 0.725649714f},
-std::array<float,2>{0.458583623f, 0.0648252591f},
-std::array<float,2>{0.312420577f, 0.577746093f},
-std::array<float,2>{0.667690456f, 0.147346884f},
-std::array<float,2>{0.760666847f, 0.914342225f},
-std::array<float,2>{0.0972879454f, 0.353226781f},
-std::array<float,2>{0.00338099152f, 0.643437326f},
-std::array<float,2>{0.851709247f, 0.00835285895f},
-std::array<float,2>{0.698514879f, 0.825656235f},
-std::array<float,2>{0.36038813f, 0.378446519f},
-std::array<float,2>{0.415194631f, 0.953472018f},
-std::array<float,2>{0.502502203f, 0.256705821f},
-std::array<float,2>{0.942130446f, 0.50390172f},
-std::array<float,2>{0.196742535f, 0.188328192f},
-std::array<float,2>{0.106262811f, 0.806202233f},
-std::array<float,2>{0.755794644f, 0.443093181f},
-std::array<float,2>{0.662498891f, 0.71716851f},
-std::array<float,2>{0.299345911f, 0.106259122f},
-std::array<float,2>{0.462199926f, 0.622458637f},
-std::array<float,2>{0.592517674f, 0.177886829f},
-std::array<float,2>{0.884240985f, 0.87695545f},
-std::array<float,2>{0.146448612f, 0.342173487f},
-std::array<float,2>{0.187881812f, 0.680711627f},
-std::array<float,2>{0.94845444f, 0.0516396724f},
-std::array<float,2>{0.508122444f, 0.861897826f},
-std::array<float,2>{0.40846169f, 0.416236311f},
-std::array<float,2>{0.370622903f, 0.980998337f},
-std::array<float,2>{0.690135777f, 0.312426358f},
-std::array<float,2>{0.844185054f, 0.542529702f},
-std::array<float,2>{0.0149032529f, 0.218969613f},
-std::array<float,2>{0.15808177f, 0.907532275f},
-std::array<float,2>{0.926435888f, 0.348531425f},
-std::array<float,2>{0.615479112f, 0.569878519f},
-std::array<float,2>{0.484842867f, 0.150346905f},
-std::array<float,2>{0.271210134f, 0.731286168f},
-std::array<float,2>{0.655183613f, 0.0720972642f},
-std::array<float,2>{0.803618908f, 0.780679941f},
-std::array<float,2>{0.0704760924f, 0.484216422f},
-std::array<float,2>{0.0608035773f, 0.514218211f},
-std::array<float,2>{0.818258464f, 0.198163539f},
-std::array<float,2>{0.741310298f, 0.960971653f},
-std::array<float,2>{0.331622571f, 0.258266896f},
-std::array<float,2>{0.378697723f, 0.817815363f},
-std::array<float,2>{0.553468525f, 0.389509916f},
-std::array<float,2>{0.975176334f, 0.655064166f},
-std::array<float,2>{0.229280949f, 0.00765118608f},
-std::array<float,2>{0.0172717851f, 0.949481428f},
-std::array<float,2>{0.874141932f, 0.277153492f},
-std::array<float,2>{0.710110366f, 0.515886009f},
-std::array<float,2>{0.348424971f, 0.209650099f},
-std::array<float,2>{0.435406685f, 0.631050229f},
-std::array<float,2>{0.518037617f, 0.0186907947f},
-std::array<float,2>{0.9598189f, 0.843247533f},
-std::array<float,2>{0.212226495f, 0.394426346f},
-std::array<float,2>{0.129205227f, 0.578370929f},
-std::array<float,2>{0.893114984f, 0.135341257f},
-std::array<float,2>{0.566336453f, 0.934962392f},
-std::array<float,2>{0.443277359f, 0.369517237f},
-std::array<float,2>{0.290247828f, 0.752630174f},
-std::array<float,2>{0.680182159f, 0.485604227f},
-std::array<float,2>{0.769790351f, 0.739162982f},
-std::array<float,2>{0.119865678f, 0.0904132649f},
-std::array<float,2>{0.247895777f, 0.85665524f},
-std::array<float,2>{0.997715414f, 0.427137852f},
-std::array<float,2>{0.536668003f, 0.668422163f},
-std::array<float,2>{0.39883846f, 0.0363037698f},
-std::array<float,2>{0.314304024f, 0.553293824f},
-std::array<float,2>{0.731112361f, 0.244067341f},
-std::array<float,2>{0.836498916f, 0.993534505f},
-std::array<float,2>{0.042232044f, 0.288499027f},
-std::array<float,2>{0.0902746618f, 0.70138365f},
-std::array<float,2>{0.79354471f, 0.113645636f},
-std::array<float,2>{0.626008034f, 0.795039117f},
-std::array<float,2>{0.261266142f, 0.459943056f},
-std::array<float,2>{0.478534222f, 0.891971111f},
-std::array<float,2>{0.596304476f, 0.316520005f},
-std::array<float,2>{0.917749703f, 0.605071008f},
-std::array<float,2>{0.18540059f, 0.163781881f},
-std::array<float,2>{0.116990693f, 0.815766394f},
-std::array<float,2>{0.774570942f, 0.385110378f},
-std::array<float,2>{0.6782763f, 0.650369525f},
-std::array<float,2>{0.284922957f, 0.000963533996f},
-std::array<float,2>{0.45301348f, 0.508238137f},
-std::array<float,2>{0.574992716f, 0.199572846f},
-std::array<float,2>{0.903654456f, 0.965267837f},
-std::array<float,2>{0.134808376f, 0.26338312f},
-std::array<float,2>{0.204701617f, 0.727699637f},
-std::array<float,2>{0.966789484f, 0.0762777701f},
-std::array<float,2>{0.530881226f, 0.776239991f},
-std::array<float,2>{0.428869903f, 0.477272928f},
-std::array<float,2>{0.356466502f, 0.911060214f},
-std::array<float,2>{0.712694943f, 0.345481932f},
-std::array<float,2>{0.865683198f, 0.564940751f},
-std::array<float,2>{0.0255861022f, 0.152756453f},
-std::array<float,2>{0.172126338f, 0.978189766f},
-std::array<float,2>{0.9140504f, 0.305534214f},
-std::array<float,2>{0.607268453f, 0.545922399f},
-std::array<float,2>{0.476443022f, 0.225995034f},
-std::array<float,2>{0.250099778f, 0.6855672f},
-std::array<float,2>{0.635627866f, 0.0505906604f},
-std::array<float,2>{0.785701394f, 0.865328074f},
-std::array<float,2>{0.0788561925f, 0.419360906f},
-std::array<float,2>{0.0359856151f, 0.61994642f},
-std::array<float,2>{0.830085874f, 0.174842566f},
-std::array<float,2>{0.722207546f, 0.880727589f},
-std::array<float,2>{0.323047459f, 0.337550521f},
-std::array<float,2>{0.392127484f, 0.810749769f},
-std::array<float,2>{0.546327412f, 0.440088987f},
-std::array<float,2>{0.992144287f, 0.714293301f},
-std::array<float,2>{0.235495538f, 0.101915799f},
-std::array<float,2>{0.00598090841f, 0.894859612f},
-std::array<float,2>{0.858942866f, 0.31541878f},
-std::array<float,2>{0.701859713f, 0.60833317f},
-std::array<float,2>{0.364997476f, 0.15884079f},
-std::array<float,2>{0.419427216f, 0.697963893f},
-std::array<float,2>{0.504594266f, 0.110566407f},
-std::array<float,2>{0.938727677f, 0.792774498f},
-std::array<float,2>{0.200721502f, 0.454830587f},
-std::array<float,2>{0.152884752f, 0.5480811f},
-std::array<float,2>{0.878934622f, 0.248039544f},
-std::array<float,2>{0.583758712f, 0.999729633f},
-std::array<float,2>{0.454141766f, 0.28318429f},
-std::array<float,2>{0.305806816f, 0.852075219f},
-std::array<float,2>{0.668026805f, 0.424461097f},
-std::array<float,2>{0.765494823f, 0.665470362f},
-std::array<float,2>{0.101426907f, 0.0314037949f},
-std::array<float,2>{0.225915432f, 0.757010162f},
-std::array<float,2>{0.976625502f, 0.490776926f},
-std::array<float,2>{0.556886733f, 0.736871958f},
-std::array<float,2>{0.384902149f, 0.0880546868f},
-std::array<float,2>{0.336983442f, 0.582500637f},
-std::array<float,2>{0.749820948f, 0.139341563f},
-std::array<float,2>{0.82289201f, 0.931615949f},
-std::array<float,2>{0.0491556451f, 0.371599913f},
-std::array<float,2>{0.0669316724f, 0.628408551f},
-std::array<float,2>{0.807718575f, 0.022947358f},
-std::array<float,2>{0.641408205f, 0.838409543f},
-std::array<float,2>{0.281209797f, 0.396027654f},
-std::array<float,2>{0.492305726f, 0.946288764f},
-std::array<float,2>{0.621914089f, 0.27817139f},
-std::array<float,2>{0.931517899f, 0.522033215f},
-std::array<float,2>{0.168521583f, 0.204023972f},
-std::array<float,2>{0.0564891286f, 0.784354627f},
-std::array<float,2>{0.813288629f, 0.463286102f},
-std::array<float,2>{0.736402631f, 0.689135373f},
-std::array<float,2>{0.333013207f, 0.12333972f},
-std::array<float,2>{0.380794764f, 0.600076139f},
-std::array<float,2>{0.546924233f, 0.166617841f},
-std::array<float,2>{0.970045388f, 0.901102424f},
-std::array<float,2>{0.233134046f, 0.321770579f},
-std::array<float,2>{0.163949981f, 0.65915823f},
-std::array<float,2>{0.925358832f, 0.0408795998f},
-std::array<float,2>{0.612584949f, 0.849576116f},
-std::array<float,2>{0.492093772f, 0.431350887f},
-std::array<float,2>{0.267599344f, 0.987679601f},
-std::array<float,2>{0.648928523f, 0.292403489f},
-std::array<float,2>{0.797524691f, 0.560938358f},
-std::array<float,2>{0.074497968f, 0.23650448f},
-std::array<float,2>{0.194813684f, 0.926767409f},
-std::array<float,2>{0.950641692f, 0.35971421f},
-std::array<float,2>{0.514396906f, 0.593550503f},
-std::array<float,2>{0.411769211f, 0.127675176f},
-std::array<float,2>{0.373424858f, 0.747569501f},
-std::array<float,2>{0.691593409f, 0.0822421014f},
-std::array<float,2>{0.847725868f, 0.759738624f},
-std::array<float,2>{0.0115989298f, 0.496229976f},
-std::array<float,2>{0.10380771f, 0.525148869f},
-std::array<float,2>{0.751473725f, 0.216732025f},
-std::array<float,2>{0.659646332f, 0.941954434f},
-std::array<float,2>{0.302399218f, 0.267891914f},
-std::array<float,2>{0.466117829f, 0.830996096f},
-std::array<float,2>{0.586075246f, 0.405529708f},
-std::array<float,2>{0.887410939f, 0.63641578f},
-std::array<float,2>{0.141851887f, 0.0245247483f},
-std::array<float,2>{0.0890258923f, 0.960594893f},
-std::array<float,2>{0.792944491f, 0.252082527f},
-std::array<float,2>{0.632717311f, 0.504561424f},
-std::array<float,2>{0.264550716f, 0.19513163f},
-std::array<float,2>{0.481364012f, 0.647283792f},
-std::array<float,2>{0.599172115f, 0.0148151331f},
-std::array<float,2>{0.920717895f, 0.822491884f},
-std::array<float,2>{0.183418885f, 0.380548894f},
-std::array<float,2>{0.244346306f, 0.571081042f},
-std::array<float,2>{0.995939791f, 0.140796974f},
-std::array<float,2>{0.533682585f, 0.918995738f},
-std::array<float,2>{0.404878199f, 0.356997073f},
-std::array<float,2>{0.318535566f, 0.769569457f},
-std::array<float,2>{0.728760481f, 0.470787615f},
-std::array<float,2>{0.84101361f, 0.722114503f},
-std::array<float,2>{0.0438095331f, 0.0691914111f},
-std::array<float,2>{0.128639892f, 0.869031072f},
-std::array<float,2>{0.897025943f, 0.412406176f},
-std::array<float,2>{0.568549812f, 0.675406218f},
-std::array<float,2>{0.438035697f, 0.0552237071f},
-std::array<float,2>{0.294287175f, 0.533799887f},
-std::array<float,2>{0.686546743f, 0.233200252f},
-std::array<float,2>{0.768722355f, 0.97640878f},
-std::array<float,2>{0.122204773f, 0.304056257f},
-std::array<float,2>{0.022702327f, 0.707045197f},
-std::array<float,2>{0.870218635f, 0.101089947f},
-std::array<float,2>{0.703284442f, 0.798799098f},
-std::array<float,2>{0.345437527f, 0.449602485f},
-std::array<float,2>{0.430213004f, 0.883818269f},
-std::array<float,2>{0.520869732f, 0.332373589f},
-std::array<float,2>{0.954209507f, 0.611978412f},
-std::array<float,2>{0.216869548f, 0.181312099f},
-std::array<float,2>{0.0311377328f, 0.847091913f},
-std::array<float,2>{0.859636247f, 0.436757714f},
-std::array<float,2>{0.71839869f, 0.663252771f},
-std::array<float,2>{0.353211671f, 0.0447188728f},
-std::array<float,2>{0.422983587f, 0.554923236f},
-std::array<float,2>{0.526073515f, 0.238650158f},
-std::array<float,2>{0.96445024f, 0.990890026f},
-std::array<float,2>{0.210087791f, 0.294555545f},
-std::array<float,2>{0.139350042f, 0.693338871f},
-std::array<float,2>{0.902040958f, 0.117748924f},
-std::array<float,2>{0.57137084f, 0.787317276f},
-std::array<float,2>{0.449214816f, 0.465022296f},
-std::array<float,2>{0.285588533f, 0.903771698f},
-std::array<float,2>{0.673445821f, 0.327002436f},
-std::array<float,2>{0.77788049f, 0.595790625f},
-std::array<float,2>{0.113275759f, 0.169393122f},
-std::array<float,2>{0.239497051f, 0.93856895f},
-std::array<float,2>{0.986203909f, 0.271911085f},
-std::array<float,2>{0.540359735f, 0.529635727f},
-std::array<float,2>{0.397448272f, 0.211918771f},
-std::array<float,2>{0.326084733f, 0.637626886f},
-std::array<float,2>{0.725684822f, 0.030953357f},
-std::array<float,2>{0.833945036f, 0.833628595f},
-std::array<float,2>{0.0341970064f, 0.399541855f},
-std::array<float,2>{0.0852458254f, 0.58835268f},
-std::array<float,2>{0.781903803f, 0.132082999f},
-std::array<float,2>{0.639976621f, 0.923273802f},
-std::array<float,2>{0.254309863f, 0.366412878f},
-std::array<float,2>{0.470625848f, 0.764922857f},
-std::array<float,2>{0.604197025f, 0.494383097f},
-std::array<float,2>{0.907791674f, 0.744120538f},
-std::array<float,2>{0.178344578f, 0.0805998668f},
-std::array<float,2>{0.0955372602f, 0.917266488f},
-std::array<float,2>{0.75791198f, 0.355299801f},
-std::array<float,2>{0.664990723f, 0.57537061f},
-std::array<float,2>{0.310130656f, 0.144538149f},
-std::array<float,2>{0.460129738f, 0.723391771f},
-std::array<float,2>{0.581223011f, 0.0639609694f},
-std::array<float,2>{0.875081539f, 0.768924832f},
-std::array<float,2>{0.149882391f, 0.472940594f},
-std::array<float,2>{0.198902339f, 0.500532091f},
-std::array<float,2>{0.945271492f, 0.191292986f},
-std::array<float,2>{0.500441253f, 0.95681417f},
-std::array<float,2>{0.417664051f, 0.254099339f},
-std::array<float,2>{0.361761361f, 0.827398717f},
-std::array<float,2>{0.695526242f, 0.37613228f},
-std::array<float,2>{0.853727102f, 0.64169991f},
-std::array<float,2>{0.00146573887f, 0.011549647f},
-std::array<float,2>{0.164733306f, 0.80441314f},
-std::array<float,2>{0.936506808f, 0.446385622f},
-std::array<float,2>{0.617805123f, 0.703726649f},
-std::array<float,2>{0.498544097f, 0.0946642756f},
-std::array<float,2>{0.274992466f, 0.61559087f},
-std::array<float,2>{0.648340046f, 0.184085056f},
-std::array<float,2>{0.811098874f, 0.889567912f},
-std::array<float,2>{0.064121142f, 0.328763068f},
-std::array<float,2>{0.0542775691f, 0.676220536f},
-std::array<float,2>{0.825749397f, 0.0591656193f},
-std::array<float,2>{0.744218886f, 0.874028146f},
-std::array<float,2>{0.340417325f, 0.408297002f},
-std::array<float,2>{0.38692221f, 0.972047985f},
-std::array<float,2>{0.562236965f, 0.300519615f},
-std::array<float,2>{0.982376814f, 0.5370121f},
-std::array<float,2>{0.220363349f, 0.230340853f},
-std::array<float,2>{0.0727903098f, 0.778023541f},
-std::array<float,2>{0.802696109f, 0.480820864f},
-std::array<float,2>{0.653254509f, 0.733463705f},
-std::array<float,2>{0.271909952f, 0.0725445375f},
-std::array<float,2>{0.486697048f, 0.567923486f},
-std::array<float,2>{0.614638507f, 0.151507527f},
-std::array<float,2>{0.928043604f, 0.908400774f},
-std::array<float,2>{0.160009325f, 0.350113481f},
-std::array<float,2>{0.228272453f, 0.653893709f},
-std::array<float,2>{0.974504709f, 0.00487022568f},
-std::array<float,2>{0.551096082f, 0.818708301f},
-std::array<float,2>{0.375385076f, 0.387441188f},
-std::array<float,2>{0.328196734f, 0.964544237f},
-std::array<float,2>{0.738407254f, 0.260850132f},
-std::array<float,2>{0.81989646f, 0.512193143f},
-std::array<float,2>{0.0587650314f, 0.197103694f},
-std::array<float,2>{0.147585168f, 0.875688553f},
-std::array<float,2>{0.886348367f, 0.340895116f},
-std::array<float,2>{0.590816915f, 0.623158336f},
-std::array<float,2>{0.464357346f, 0.177365556f},
-std::array<float,2>{0.29849568f, 0.715895951f},
-std::array<float,2>{0.660351753f, 0.108231172f},
-std::array<float,2>{0.756646335f, 0.807913959f},
-std::array<float,2>{0.107683085f, 0.443393141f},
-std::array<float,2>{0.0129897734f, 0.539095819f},
-std::array<float,2>{0.846844733f, 0.220800415f},
-std::array<float,2>{0.688978612f, 0.982454538f},
-std::array<float,2>{0.367424846f, 0.309247136f},
-std::array<float,2>{0.406303197f, 0.861281097f},
-std::array<float,2>{0.510699749f, 0.415200323f},
-std::array<float,2>{0.946444571f, 0.683480322f},
-std::array<float,2>{0.191265553f, 0.0535653606f},
-std::array<float,2>{0.0408571847f, 0.994348824f},
-std::array<float,2>{0.838499665f, 0.286354065f},
-std::array<float,2>{0.732458651f, 0.552358747f},
-std::array<float,2>{0.3163459f, 0.245528996f},
-std::array<float,2>{0.400450945f, 0.671801925f},
-std::array<float,2>{0.538820267f, 0.0377349332f},
-std::array<float,2>{0.999591351f, 0.858346939f},
-std::array<float,2>{0.249438867f, 0.429635644f},
-std::array<float,2>{0.185868368f, 0.602567673f},
-std::array<float,2>{0.915815949f, 0.160721853f},
-std::array<float,2>{0.595354915f, 0.894050181f},
-std::array<float,2>{0.47733295f, 0.319602221f},
-std::array<float,2>{0.258343279f, 0.794398546f},
-std::array<float,2>{0.62860173f, 0.457701415f},
-std::array<float,2>{0.795461357f, 0.700235367f},
-std::array<float,2>{0.0929595158f, 0.116366342f},
-std::array<float,2>{0.212934598f, 0.841249108f},
-std::array<float,2>{0.957306147f, 0.391189605f},
-std::array<float,2>{0.516168177f, 0.629597783f},
-std::array<float,2>{0.43600446f, 0.0159256384f},
-std::array<float,2>{0.350326687f, 0.519379199f},
-std::array<float,2>{0.707915962f, 0.20741643f},
-std::array<float,2>{0.87197566f, 0.952368736f},
-std::array<float,2>{0.0178216267f, 0.275184035f},
-std::array<float,2>{0.117682189f, 0.740286946f},
-std::array<float,2>{0.772226274f, 0.0922591165f},
-std::array<float,2>{0.682712317f, 0.750341773f},
-std::array<float,2>{0.291313052f, 0.488258749f},
-std::array<float,2>{0.44405666f, 0.936936319f},
-std::array<float,2>{0.562734306f, 0.369091898f},
-std::array<float,2>{0.891425431f, 0.582016826f},
-std::array<float,2>{0.13100192f, 0.133612007f},
-std::array<float,2>{0.109193325f, 0.862267911f},
-std::array<float,2>{0.757645845f, 0.416389823f},
-std::array<float,2>{0.661633253f, 0.680978775f},
-std::array<float,2>{0.297839433f, 0.0513421595f},
-std::array<float,2>{0.462930501f, 0.542835712f},
-std::array<float,2>{0.591734231f, 0.219096944f},
-std::array<float,2>{0.885363817f, 0.981413364f},
-std::array<float,2>{0.147152171f, 0.312237173f},
-std::array<float,2>{0.18969366f, 0.716917634f},
-std::array<float,2>{0.945710003f, 0.106135711f},
-std::array<float,2>{0.511153996f, 0.806618929f},
-std::array<float,2>{0.408000052f, 0.443340093f},
-std::array<float,2>{0.368469864f, 0.877332926f},
-std::array<float,2>{0.687539637f, 0.341995895f},
-std::array<float,2>{0.845869482f, 0.62212503f},
-std::array<float,2>{0.0123382825f, 0.17814061f},
-std::array<float,2>{0.159054354f, 0.961345792f},
-std::array<float,2>{0.929629624f, 0.257839471f},
-std::array<float,2>{0.614057302f, 0.514418125f},
-std::array<float,2>{0.487755716f, 0.197861493f},
-std::array<float,2>{0.272511303f, 0.65485388f},
-std::array<float,2>{0.653860748f, 0.00735358335f},
-std::array<float,2>{0.801380157f, 0.817543507f},
-std::array<float,2>{0.0736504719f, 0.38917774f},
-std::array<float,2>{0.0600488782f, 0.570307195f},
-std::array<float,2>{0.818953931f, 0.150136828f},
-std::array<float,2>{0.739338279f, 0.907287657f},
-std::array<float,2>{0.329116851f, 0.348166496f},
-std::array<float,2>{0.376197964f, 0.780365646f},
-std::array<float,2>{0.551837146f, 0.483893037f},
-std::array<float,2>{0.972892523f, 0.731100678f},
-std::array<float,2>{0.227119088f, 0.0719763935f},
-std::array<float,2>{0.0187466107f, 0.934724092f},
-std::array<float,2>{0.872427166f, 0.369253665f},
-std::array<float,2>{0.708969414f, 0.578206897f},
-std::array<float,2>{0.350814074f, 0.135733023f},
-std::array<float,2>{0.437386185f, 0.738804877f},
-std::array<float,2>{0.517474651f, 0.0907494798f},
-std::array<float,2>{0.958733737f, 0.75284636f},
-std::array<float,2>{0.214142829f, 0.485354543f},
-std::array<float,2>{0.132763088f, 0.515798271f},
-std::array<float,2>{0.891998649f, 0.209856063f},
-std::array<float,2>{0.563802838f, 0.949315786f},
-std::array<float,2>{0.444677085f, 0.276903033f},
-std::array<float,2>{0.292860061f, 0.842825413f},
-std::array<float,2>{0.681966901f, 0.394097686f},
-std::array<float,2>{0.772836983f, 0.63134706f},
-std::array<float,2>{0.118765235f, 0.0189045332f},
-std::array<float,2>{0.248990655f, 0.795325994f},
-std::array<float,2>{0.999017179f, 0.459561169f},
-std::array<float,2>{0.537912726f, 0.701615572f},
-std::array<float,2>{0.402189523f, 0.113297209f},
-std::array<float,2>{0.315061599f, 0.605439305f},
-std::array<float,2>{0.733994722f, 0.163833335f},
-std::array<float,2>{0.839797914f, 0.891738534f},
-std::array<float,2>{0.04002361f, 0.316854984f},
-std::array<float,2>{0.0924162641f, 0.6680246f},
-std::array<float,2>{0.796379566f, 0.0364848934f},
-std::array<float,2>{0.627083242f, 0.856767237f},
-std::array<float,2>{0.259368807f, 0.427000701f},
-std::array<float,2>{0.478408664f, 0.993182302f},
-std::array<float,2>{0.593944073f, 0.288284808f},
-std::array<float,2>{0.914556265f, 0.553584397f},
-std::array<float,2>{0.18697153f, 0.243743435f},
-std::array<float,2>{0.0340648144f, 0.762397885f},
-std::array<float,2>{0.83279109f, 0.492828131f},
-std::array<float,2>{0.724822283f, 0.745042741f},
-std::array<float,2>{0.324950367f, 0.0797405839f},
-std::array<float,2>{0.398231119f, 0.586181283f},
-std::array<float,2>{0.539640903f, 0.130696625f},
-std::array<float,2>{0.98475188f, 0.924253106f},
-std::array<float,2>{0.23902598f, 0.363974154f},
-std::array<float,2>{0.179459125f, 0.639930427f},
-std::array<float,2>{0.906665862f, 0.028077716f},
-std::array<float,2>{0.605205178f, 0.835487306f},
-std::array<float,2>{0.469156027f, 0.401320964f},
-std::array<float,2>{0.254934281f, 0.940454245f},
-std::array<float,2>{0.639537692f, 0.271028221f},
-std::array<float,2>{0.782920778f, 0.52838707f},
-std::array<float,2>{0.0842425972f, 0.21301876f},
-std::array<float,2>{0.209771559f, 0.905425966f},
-std::array<float,2>{0.963315308f, 0.325692862f},
-std::array<float,2>{0.526544511f, 0.594058931f},
-std::array<float,2>{0.422026753f, 0.170302823f},
-std::array<float,2>{0.352109939f, 0.69406867f},
-std::array<float,2>{0.716805458f, 0.12104623f},
-std::array<float,2>{0.860932291f, 0.785415828f},
-std::array<float,2>{0.029847648f, 0.467141062f},
-std::array<float,2>{0.111745f, 0.557828784f},
-std::array<float,2>{0.778827071f, 0.242085546f},
-std::array<float,2>{0.671955884f, 0.989567637f},
-std::array<float,2>{0.286340684f, 0.295924246f},
-std::array<float,2>{0.447442859f, 0.845154464f},
-std::array<float,2>{0.570620537f, 0.434738159f},
-std::array<float,2>{0.900528908f, 0.661635458f},
-std::array<float,2>{0.140081033f, 0.0453588404f},
-std::array<float,2>{0.0628887713f, 0.96987468f},
-std::array<float,2>{0.812063098f, 0.297800899f},
-std::array<float,2>{0.646778047f, 0.537450612f},
-std::array<float,2>{0.274203062f, 0.22847487f},
-std::array<float,2>{0.499739885f, 0.678834796f},
-std::array<float,2>{0.618496597f, 0.0617669635f},
-std::array<float,2>{0.937362552f, 0.871413708f},
-std::array<float,2>{0.165077299f, 0.407613099f},
-std::array<float,2>{0.21953325f, 0.614630342f},
-std::array<float,2>{0.98060298f, 0.187453151f},
-std::array<float,2>{0.560572624f, 0.887341201f},
-std::array<float,2>{0.388456702f, 0.331066102f},
-std::array<float,2>{0.34100762f, 0.801287293f},
-std::array<float,2>{0.745459855f, 0.448491842f},
-std::array<float,2>{0.824986577f, 0.705537319f},
-std::array<float,2>{0.0536625721f, 0.0958045796f},
-std::array<float,2>{0.148826838f, 0.825311601f},
-std::array<float,2>{0.876809537f, 0.378893048f},
-std::array<float,2>{0.580459654f, 0.643273592f},
-std::array<float,2>{0.459921777f, 0.00872218888f},
-std::array<float,2>{0.309122592f, 0.50344646f},
-std::array<float,2>{0.665504217f, 0.187992036f},
-std::array<float,2>{0.759173095f, 0.95323807f},
-std::array<float,2>{0.0938280225f, 0.256473899f},
-std::array<float,2>{0.000491342507f, 0.725928962f},
-std::array<float,2>{0.854958534f, 0.0646596029f},
-std::array<float,2>{0.696624458f, 0.76648438f},
-std::array<float,2>{0.362336636f, 0.475808173f},
-std::array<float,2>{0.4162063f, 0.914291501f},
-std::array<float,2>{0.501161337f, 0.353429168f},
-std::array<float,2>{0.943433106f, 0.57803458f},
-std::array<float,2>{0.197964579f, 0.147026688f},
-std::array<float,2>{0.0107024824f, 0.82820183f},
-std::array<float,2>{0.849472344f, 0.402386725f},
-std::array<float,2>{0.693100512f, 0.633960783f},
-std::array<float,2>{0.374530345f, 0.0268719699f},
-std::array<float,2>{0.410877436f, 0.526386023f},
-std::array<float,2>{0.514868677f, 0.217288941f},
-std::array<float,2>{0.949973047f, 0.945058763f},
-std::array<float,2>{0.193853274f, 0.267418593f},
-std::array<float,2>{0.141122594f, 0.749842525f},
-std::array<float,2>{0.887903154f, 0.0852182433f},
-std::array<float,2>{0.587728441f, 0.761293113f},
-std::array<float,2>{0.465763927f, 0.499793649f},
-std::array<float,2>{0.301749378f, 0.928202927f},
-std::array<float,2>{0.658964515f, 0.363226622f},
-std::array<float,2>{0.750888884f, 0.590278327f},
-std::array<float,2>{0.105436154f, 0.125791565f},
-std::array<float,2>{0.234366909f, 0.984550178f},
-std::array<float,2>{0.96964848f, 0.290622532f},
-std::array<float,2>{0.548547029f, 0.560225964f},
-std::array<float,2>{0.379473001f, 0.234969869f},
-std::array<float,2>{0.332406104f, 0.657100201f},
-std::array<float,2>{0.737314761f, 0.0420667008f},
-std::array<float,2>{0.813895762f, 0.849689007f},
-std::array<float,2>{0.0554545298f, 0.43337509f},
-std::array<float,2>{0.0756719857f, 0.598626673f},
-std::array<float,2>{0.79789567f, 0.164643437f},
-std::array<float,2>{0.649614871f, 0.898981273f},
-std::array<float,2>{0.269125968f, 0.323708683f},
-std::array<float,2>{0.491126925f, 0.78241539f},
-std::array<float,2>{0.611349404f, 0.461414427f},
-std::array<float,2>{0.924100876f, 0.689570367f},
-std::array<float,2>{0.162397534f, 0.122355267f},
-std::array<float,2>{0.121498674f, 0.885623097f},
-std::array<float,2>{0.768033206f, 0.3354837f},
-std::array<float,2>{0.686295867f, 0.610822737f},
-std::array<float,2>{0.293361634f, 0.182886139f},
-std::array<float,2>{0.438867569f, 0.71000731f},
-std::array<float,2>{0.569560766f, 0.0983321741f},
-std::array<float,2>{0.89791137f, 0.79886955f},
-std::array<float,2>{0.127461702f, 0.451371789f},
-std::array<float,2>{0.218081281f, 0.531803131f},
-std::array<float,2>{0.953265369f, 0.231449127f},
-std::array<float,2>{0.519907415f, 0.974131048f},
-std::array<float,2>{0.431466848f, 0.302669555f},
-std::array<float,2>{0.344237953f, 0.869296491f},
-std::array<float,2>{0.70445174f, 0.410572708f},
-std::array<float,2>{0.870019615f, 0.671970129f},
-std::array<float,2>{0.0223138258f, 0.0582323521f},
-std::array<float,2>{0.181775659f, 0.772818089f},
-std::array<float,2>{0.921749949f, 0.469336808f},
-std::array<float,2>{0.597714782f, 0.720174015f},
-std::array<float,2>{0.481987983f, 0.0682897046f},
-std::array<float,2>{0.265120447f, 0.572750866f},
-std::array<float,2>{0.630964518f, 0.142780587f},
-std::array<float,2>{0.791959584f, 0.921566248f},
-std::array<float,2>{0.0881313533f, 0.358370155f},
-std::array<float,2>{0.0441800989f, 0.646372199f},
-std::array<float,2>{0.840077519f, 0.0134890722f},
-std::array<float,2>{0.730214298f, 0.821759164f},
-std::array<float,2>{0.319762707f, 0.381912977f},
-std::array<float,2>{0.405803978f, 0.95787096f},
-std::array<float,2>{0.534991145f, 0.251676381f},
-std::array<float,2>{0.994935215f, 0.505952895f},
-std::array<float,2>{0.245872691f, 0.191674992f},
-std::array<float,2>{0.0798608139f, 0.809011638f},
-std::array<float,2>{0.786841691f, 0.438995123f},
-std::array<float,2>{0.636363864f, 0.71217531f},
-std::array<float,2>{0.251238227f, 0.103723198f},
-std::array<float,2>{0.474924743f, 0.617877722f},
-std::array<float,2>{0.605519176f, 0.17199108f},
-std::array<float,2>{0.912977993f, 0.881978512f},
-std::array<float,2>{0.172898054f, 0.339724183f},
-std::array<float,2>{0.235340372f, 0.684091985f},
-std::array<float,2>{0.990304112f, 0.0486579686f},
-std::array<float,2>{0.545605958f, 0.864705861f},
-std::array<float,2>{0.391475022f, 0.421385914f},
-std::array<float,2>{0.324178994f, 0.978614986f},
-std::array<float,2>{0.72127825f, 0.307821751f},
-std::array<float,2>{0.831766069f, 0.54485333f},
-std::array<float,2>{0.036188677f, 0.223339781f},
-std::array<float,2>{0.135794044f, 0.912278891f},
-std::array<float,2>{0.90325135f, 0.346337318f},
-std::array<float,2>{0.575774193f, 0.562849998f},
-std::array<float,2>{0.452012986f, 0.155699044f},
-std::array<float,2>{0.283999413f, 0.729783535f},
-std::array<float,2>{0.679373443f, 0.0743126646f},
-std::array<float,2>{0.774301112f, 0.773940861f},
-std::array<float,2>{0.116145253f, 0.478827804f},
-std::array<float,2>{0.0267994385f, 0.510430217f},
-std::array<float,2>{0.866447091f, 0.202915683f},
-std::array<float,2>{0.711359918f, 0.967272103f},
-std::array<float,2>{0.355761975f, 0.264175475f},
-std::array<float,2>{0.42788443f, 0.814281762f},
-std::array<float,2>{0.529879749f, 0.38380748f},
-std::array<float,2>{0.965762019f, 0.65151453f},
-std::array<float,2>{0.203534633f, 0.00298854383f},
-std::array<float,2>{0.0500852391f, 0.948549211f},
-std::array<float,2>{0.823951483f, 0.280524313f},
-std::array<float,2>{0.748611629f, 0.52000463f},
-std::array<float,2>{0.336153656f, 0.20665732f},
-std::array<float,2>{0.386304736f, 0.62606591f},
-std::array<float,2>{0.558306158f, 0.0200381465f},
-std::array<float,2>{0.978202581f, 0.837625086f},
-std::array<float,2>{0.225402281f, 0.397293001f},
-std::array<float,2>{0.169704631f, 0.585376918f},
-std::array<float,2>{0.929905772f, 0.138355896f},
-std::array<float,2>{0.622633874f, 0.932458401f},
-std::array<float,2>{0.493471742f, 0.374761194f},
-std::array<float,2>{0.279722691f, 0.754319549f},
-std::array<float,2>{0.64234519f, 0.489412576f},
-std::array<float,2>{0.806818664f, 0.735695004f},
-std::array<float,2>{0.0680637434f, 0.0875595063f},
-std::array<float,2>{0.199597001f, 0.854101121f},
-std::array<float,2>{0.9375f, 0.423053622f},
-std::array<float,2>{0.505673945f, 0.667835116f},
-std::array<float,2>{0.418782085f, 0.0344662815f},
-std::array<float,2>{0.363990724f, 0.550413609f},
-std::array<float,2>{0.702925503f, 0.248251542f},
-std::array<float,2>{0.858189344f, 0.996590614f},
-std::array<float,2>{0.00705830287f, 0.283466041f},
-std::array<float,2>{0.0999151021f, 0.695823431f},
-std::array<float,2>{0.763789415f, 0.111359477f},
-std::array<float,2>{0.669411719f, 0.789121211f},
-std::array<float,2>{0.305441469f, 0.456950456f},
-std::array<float,2>{0.453941643f, 0.896673262f},
-std::array<float,2>{0.582606614f, 0.313459784f},
-std::array<float,2>{0.880237043f, 0.605761588f},
-std::array<float,2>{0.154122427f, 0.158128127f},
-std::array<float,2>{0.0722240359f, 0.818448365f},
-std::array<float,2>{0.804643035f, 0.387587398f},
-std::array<float,2>{0.656170607f, 0.654270828f},
-std::array<float,2>{0.269820303f, 0.00449820887f},
-std::array<float,2>{0.485359013f, 0.511759579f},
-std::array<float,2>{0.616373539f, 0.196794823f},
-std::array<float,2>{0.926794827f, 0.964601398f},
-std::array<float,2>{0.156978741f, 0.261072844f},
-std::array<float,2>{0.229775354f, 0.73366642f},
-std::array<float,2>{0.975777268f, 0.0724403486f},
-std::array<float,2>{0.553857863f, 0.778149545f},
-std::array<float,2>{0.377280533f, 0.480695367f},
-std::array<float,2>{0.330144078f, 0.908676147f},
-std::array<float,2>{0.740387499f, 0.350408256f},
-std::array<float,2>{0.817154288f, 0.568323255f},
-std::array<float,2>{0.0617249086f, 0.151733875f},
-std::array<float,2>{0.145148516f, 0.982886374f},
-std::array<float,2>{0.883271515f, 0.309327155f},
-std::array<float,2>{0.593639851f, 0.539413154f},
-std::array<float,2>{0.461761266f, 0.221063107f},
-std::array<float,2>{0.300108492f, 0.683292508f},
-std::array<float,2>{0.66383779f, 0.0533015542f},
-std::array<float,2>{0.754680157f, 0.860895276f},
-std::array<float,2>{0.10686022f, 0.41542536f},
-std::array<float,2>{0.0140234539f, 0.623429179f},
-std::array<float,2>{0.845230281f, 0.177646086f},
-std::array<float,2>{0.691350996f, 0.875735044f},
-std::array<float,2>{0.369434088f, 0.34120509f},
-std::array<float,2>{0.410023689f, 0.807764351f},
-std::array<float,2>{0.508853197f, 0.443672746f},
-std::array<float,2>{0.947602749f, 0.716268241f},
-std::array<float,2>{0.188930959f, 0.108118825f},
-std::array<float,2>{0.0411195792f, 0.894439399f},
-std::array<float,2>{0.837669194f, 0.319550455f},
-std::array<float,2>{0.731693268f, 0.602820396f},
-std::array<float,2>{0.313291073f, 0.161093652f},
-std::array<float,2>{0.400189519f, 0.700583935f},
-std::array<float,2>{0.535827756f, 0.11662095f},
-std::array<float,2>{0.99620837f, 0.793977857f},
-std::array<float,2>{0.246706724f, 0.45788312f},
-std::array<float,2>{0.184498325f, 0.552591741f},
-std::array<float,2>{0.916712046f, 0.245308369f},
-std::array<float,2>{0.597500384f, 0.994593084f},
-std::array<float,2>{0.479646146f, 0.286572963f},
-std::array<float,2>{0.260420501f, 0.857982874f},
-std::array<float,2>{0.625527799f, 0.429408699f},
-std::array<float,2>{0.794806182f, 0.671533585f},
-std::array<float,2>{0.0909901559f, 0.0378747843f},
-std::array<float,2>{0.211141899f, 0.750237405f},
-std::array<float,2>{0.960075021f, 0.487820655f},
-std::array<float,2>{0.518623948f, 0.740567684f},
-std::array<float,2>{0.434284598f, 0.0919607729f},
-std::array<float,2>{0.349503219f, 0.58158654f},
-std::array<float,2>{0.709385931f, 0.133473217f},
-std::array<float,2>{0.873999357f, 0.936579645f},
-std::array<float,2>{0.0163116716f, 0.368675947f},
-std::array<float,2>{0.120773457f, 0.629725933f},
-std::array<float,2>{0.771122575f, 0.015814282f},
-std::array<float,2>{0.680950463f, 0.840882361f},
-std::array<float,2>{0.289680749f, 0.391436368f},
-std::array<float,2>{0.442303717f, 0.952414393f},
-std::array<float,2>{0.565121889f, 0.274980336f},
-std::array<float,2>{0.893981814f, 0.519177973f},
-std::array<float,2>{0.130018532f, 0.2070923f},
-std::array<float,2>{0.0286032986f, 0.787369668f},
-std::array<float,2>{0.862954617f, 0.465101004f},
-std::array<float,2>{0.716371417f, 0.692978859f},
-std::array<float,2>{0.353847444f, 0.11797902f},
-std::array<float,2>{0.425739288f, 0.596072257f},
-std::array<float,2>{0.523896873f, 0.169139117f},
-std::array<float,2>{0.962423563f, 0.903337717f},
-std::array<float,2>{0.20884876f, 0.326846868f},
-std::array<float,2>{0.137893811f, 0.663407505f},
-std::array<float,2>{0.900125802f, 0.044619035f},
-std::array<float,2>{0.573273778f, 0.846739471f},
-std::array<float,2>{0.446937263f, 0.43694368f},
-std::array<float,2>{0.287490845f, 0.99097383f},
-std::array<float,2>{0.674269259f, 0.294714034f},
-std::array<float,2>{0.780682921f, 0.555091739f},
-std::array<float,2>{0.109540492f, 0.238333672f},
-std::array<float,2>{0.241065204f, 0.923051715f},
-std::array<float,2>{0.986870348f, 0.366665632f},
-std::array<float,2>{0.541249335f, 0.588016391f},
-std::array<float,2>{0.396446526f, 0.132061183f},
-std::array<float,2>{0.327665836f, 0.74367559f},
-std::array<float,2>{0.724596977f, 0.08093483f},
-std::array<float,2>{0.835692763f, 0.764735579f},
-std::array<float,2>{0.0312914588f, 0.49439761f},
-std::array<float,2>{0.0823268965f, 0.529340386f},
-std::array<float,2>{0.783388078f, 0.212397799f},
-std::array<float,2>{0.638471007f, 0.938762188f},
-std::array<float,2>{0.256779253f, 0.271510959f},
-std::array<float,2>{0.471512854f, 0.833966494f},
-std::array<float,2>{0.602501214f, 0.399751961f},
-std::array<float,2>{0.909609079f, 0.637385249f},
-std::array<float,2>{0.176425949f, 0.0311332736f},
-std::array<float,2>{0.0960182473f, 0.956584573f},
-std::array<float,2>{0.761040092f, 0.254207432f},
-std::array<float,2>{0.666064203f, 0.500788271f},
-std::array<float,2>{0.311331779f, 0.191053078f},
-std::array<float,2>{0.457975626f, 0.641955972f},
-std::array<float,2>{0.579746783f, 0.0112509914f},
-std::array<float,2>{0.878507197f, 0.827230573f},
-std::array<float,2>{0.151569322f, 0.376458824f},
-std::array<float,2>{0.196156234f, 0.575544298f},
-std::array<float,2>{0.942850053f, 0.144871995f},
-std::array<float,2>{0.503744364f, 0.917090237f},
-std::array<float,2>{0.414139122f, 0.355177313f},
-std::array<float,2>{0.360026181f, 0.768733382f},
-std::array<float,2>{0.697607696f, 0.472741514f},
-std::array<float,2>{0.852667511f, 0.723147988f},
-std::array<float,2>{0.00203171489f, 0.0635039881f},
-std::array<float,2>{0.166181609f, 0.874506176f},
-std::array<float,2>{0.935508609f, 0.408495784f},
-std::array<float,2>{0.619855523f, 0.675810993f},
-std::array<float,2>{0.497795403f, 0.0594432093f},
-std::array<float,2>{0.276257217f, 0.536834538f},
-std::array<float,2>{0.645135403f, 0.230064675f},
-std::array<float,2>{0.809648335f, 0.971881449f},
-std::array<float,2>{0.0662029013f, 0.30068332f},
-std::array<float,2>{0.0520767421f, 0.70405364f},
-std::array<float,2>{0.826411664f, 0.0943642855f},
-std::array<float,2>{0.74227947f, 0.804572046f},
-std::array<float,2>{0.342024386f, 0.446605653f},
-std::array<float,2>{0.389142931f, 0.889208376f},
-std::array<float,2>{0.560100794f, 0.328881323f},
-std::array<float,2>{0.983674884f, 0.615460992f},
-std::array<float,2>{0.221520513f, 0.184498563f},
-std::array<float,2>{0.0570756644f, 0.849198997f},
-std::array<float,2>{0.815991342f, 0.431402832f},
-std::array<float,2>{0.735813498f, 0.658819437f},
-std::array<float,2>{0.334873796f, 0.0405603796f},
-std::array<float,2>{0.38218388f, 0.560638666f},
-std::array<float,2>{0.550626278f, 0.236580595f},
-std::array<float,2>{0.972316325f, 0.987443626f},
-std::array<float,2>{0.230878308f, 0.292192489f},
-std::array<float,2>{0.16169022f, 0.689274907f},
-std::array<float,2>{0.922713161f, 0.123254187f},
-std::array<float,2>{0.609974384f, 0.784624577f},
-std::array<float,2>{0.488521904f, 0.463098079f},
-std::array<float,2>{0.26670742f, 0.901176512f},
-std::array<float,2>{0.652183056f, 0.321481377f},
-std::array<float,2>{0.800310791f, 0.599700987f},
-std::array<float,2>{0.0780029222f, 0.166929081f},
-std::array<float,2>{0.193287134f, 0.942311883f},
-std::array<float,2>{0.951660573f, 0.267780691f},
-std::array<float,2>{0.511907876f, 0.525103509f},
-std::array<float,2>{0.41356954f, 0.216433465f},
-std::array<float,2>{0.371876687f, 0.636576831f},
-std::array<float,2>{0.69505167f, 0.024823891f},
-std::array<float,2>{0.851168692f, 0.830594957f},
-std::array<float,2>{0.00858295895f, 0.405419499f},
-std::array<float,2>{0.102192014f, 0.593347669f},
-std::array<float,2>{0.753157914f, 0.127686903f},
-std::array<float,2>{0.656521618f, 0.927021265f},
-std::array<float,2>{0.303778827f, 0.359442949f},
-std::array<float,2>{0.468087375f, 0.759338439f},
-std::array<float,2>{0.589138746f, 0.496404916f},
-std::array<float,2>{0.890111268f, 0.747998297f},
-std::array<float,2>{0.143258408f, 0.0825168416f},
-std::array<float,2>{0.0870046318f, 0.919284105f},
-std::array<float,2>{0.789310336f, 0.357194483f},
-std::array<float,2>{0.630170524f, 0.570865095f},
-std::array<float,2>{0.262521386f, 0.141095757f},
-std::array<float,2>{0.48331064f, 0.721873641f},
-std::array<float,2>{0.599785566f, 0.0690570697f},
-std::array<float,2>{0.919057548f, 0.769960225f},
-std::array<float,2>{0.181617513f, 0.471167117f},
-std::array<float,2>{0.244124711f, 0.504711509f},
-std::array<float,2>{0.992246509f, 0.194961831f},
-std::array<float,2>{0.532669902f, 0.960806012f},
-std::array<float,2>{0.404086202f, 0.252385169f},
-std::array<float,2>{0.317840338f, 0.822738171f},
-std::array<float,2>{0.72737664f, 0.380644292f},
-std::array<float,2>{0.841914535f, 0.646994352f},
-std::array<float,2>{0.045844961f, 0.0150990989f},
-std::array<float,2>{0.125011444f, 0.798524678f},
-std::array<float,2>{0.894791901f, 0.449433655f},
-std::array<float,2>{0.567281723f, 0.707425117f},
-std::array<float,2>{0.439771831f, 0.101350404f},
-std::array<float,2>{0.295327902f, 0.612273037f},
-std::array<float,2>{0.684553862f, 0.181434438f},
-std::array<float,2>{0.766625226f, 0.884175897f},
-std::array<float,2>{0.124681801f, 0.332271099f},
-std::array<float,2>{0.0209685341f, 0.675754011f},
-std::array<float,2>{0.8679654f, 0.055545304f},
-std::array<float,2>{0.706760168f, 0.868739665f},
-std::array<float,2>{0.346961588f, 0.412302524f},
-std::array<float,2>{0.431935877f, 0.976295412f},
-std::array<float,2>{0.523288131f, 0.303950101f},
-std::array<float,2>{0.955347478f, 0.534175217f},
-std::array<float,2>{0.216728076f, 0.232999697f},
-std::array<float,2>{0.114300311f, 0.776040912f},
-std::array<float,2>{0.775403559f, 0.477397382f},
-std::array<float,2>{0.676597595f, 0.72785598f},
-std::array<float,2>{0.283179224f, 0.0764450282f},
-std::array<float,2>{0.449954927f, 0.564459741f},
-std::array<float,2>{0.577248216f, 0.152462944f},
-std::array<float,2>{0.905832171f, 0.910730302f},
-std::array<float,2>{0.133154139f, 0.34540379f},
-std::array<float,2>{0.205162615f, 0.650082171f},
-std::array<float,2>{0.967650235f, 0.000563649519f},
-std::array<float,2>{0.527993262f, 0.815540552f},
-std::array<float,2>{0.426670164f, 0.384889454f},
-std::array<float,2>{0.358174413f, 0.964856148f},
-std::array<float,2>{0.714235187f, 0.263589025f},
-std::array<float,2>{0.864808977f, 0.508040607f},
-std::array<float,2>{0.024858214f, 0.199404359f},
-std::array<float,2>{0.174259722f, 0.880511701f},
-std::array<float,2>{0.910758495f, 0.337821096f},
-std::array<float,2>{0.608435571f, 0.619827151f},
-std::array<float,2>{0.473325759f, 0.175198212f},
-std::array<float,2>{0.253847122f, 0.714068532f},
-std::array<float,2>{0.634272575f, 0.101776175f},
-std::array<float,2>{0.787512422f, 0.81081605f},
-std::array<float,2>{0.0810421333f, 0.440371782f},
-std::array<float,2>{0.0376459956f, 0.546157658f},
-std::array<float,2>{0.829220653f, 0.225690633f},
-std::array<float,2>{0.720118701f, 0.97828269f},
-std::array<float,2>{0.321018785f, 0.305272788f},
-std::array<float,2>{0.392827034f, 0.865614295f},
-std::array<float,2>{0.544633031f, 0.419036627f},
-std::array<float,2>{0.990002334f, 0.68594116f},
-std::array<float,2>{0.237914875f, 0.0504659861f},
-std::array<float,2>{0.00519800652f, 0.999891639f},
-std::array<float,2>{0.856390238f, 0.282942295f},
-std::array<float,2>{0.700573087f, 0.54821825f},
-std::array<float,2>{0.366402388f, 0.247682467f},
-std::array<float,2>{0.420664549f, 0.665046334f},
-std::array<float,2>{0.506927073f, 0.0317242257f},
-std::array<float,2>{0.941188097f, 0.852460742f},
-std::array<float,2>{0.201931089f, 0.424718589f},
-std::array<float,2>{0.155455649f, 0.608008623f},
-std::array<float,2>{0.8816486f, 0.158974603f},
-std::array<float,2>{0.584692836f, 0.894775271f},
-std::array<float,2>{0.45617798f, 0.315081656f},
-std::array<float,2>{0.30697298f, 0.792482376f},
-std::array<float,2>{0.669929981f, 0.454969555f},
-std::array<float,2>{0.763652086f, 0.698037565f},
-std::array<float,2>{0.0986281708f, 0.110747963f},
-std::array<float,2>{0.224488467f, 0.838709176f},
-std::array<float,2>{0.979377389f, 0.396255285f},
-std::array<float,2>{0.55547893f, 0.627990246f},
-std::array<float,2>{0.384347379f, 0.0226736832f},
-std::array<float,2>{0.338962466f, 0.522265375f},
-std::array<float,2>{0.747708857f, 0.203693762f},
-std::array<float,2>{0.821289659f, 0.945971787f},
-std::array<float,2>{0.0477493033f, 0.277872324f},
-std::array<float,2>{0.0694400519f, 0.737093747f},
-std::array<float,2>{0.806318998f, 0.0882813781f},
-std::array<float,2>{0.643837333f, 0.757275879f},
-std::array<float,2>{0.277434081f, 0.491074651f},
-std::array<float,2>{0.494869649f, 0.93121618f},
-std::array<float,2>{0.624936104f, 0.372062981f},
-std::array<float,2>{0.931767464f, 0.582063854f},
-std::array<float,2>{0.171874061f, 0.139415413f},
-std::array<float,2>{0.0906185657f, 0.855913401f},
-std::array<float,2>{0.793066382f, 0.42629838f},
-std::array<float,2>{0.626579523f, 0.669546127f},
-std::array<float,2>{0.260839164f, 0.0357007049f},
-std::array<float,2>{0.47904548f, 0.553790271f},
-std::array<float,2>{0.595817149f, 0.242459312f},
-std::array<float,2>{0.917172194f, 0.992373645f},
-std::array<float,2>{0.18458876f, 0.287280917f},
-std::array<float,2>{0.247261733f, 0.70298779f},
-std::array<float,2>{0.997317731f, 0.115218602f},
-std::array<float,2>{0.536192596f, 0.795909643f},
-std::array<float,2>{0.39938134f, 0.460278869f},
-std::array<float,2>{0.31354332f, 0.891454577f},
-std::array<float,2>{0.730820596f, 0.317682773f},
-std::array<float,2>{0.836419642f, 0.604368687f},
-std::array<float,2>{0.042573873f, 0.162806302f},
-std::array<float,2>{0.129542679f, 0.950482368f},
-std::array<float,2>{0.892753959f, 0.276298851f},
-std::array<float,2>{0.565452158f, 0.517219484f},
-std::array<float,2>{0.442822337f, 0.210695267f},
-std::array<float,2>{0.290782064f, 0.632739842f},
-std::array<float,2>{0.6797719f, 0.0176023878f},
-std::array<float,2>{0.770381033f, 0.842105746f},
-std::array<float,2>{0.119341485f, 0.392926455f},
-std::array<float,2>{0.0166393705f, 0.579336524f},
-std::array<float,2>{0.874701977f, 0.13607654f},
-std::array<float,2>{0.710818172f, 0.934092164f},
-std::array<float,2>{0.347848237f, 0.370907843f},
-std::array<float,2>{0.434835285f, 0.752982378f},
-std::array<float,2>{0.518251359f, 0.484628648f},
-std::array<float,2>{0.959365904f, 0.739427507f},
-std::array<float,2>{0.212848887f, 0.0916401371f},
-std::array<float,2>{0.0612397604f, 0.906931043f},
-std::array<float,2>{0.817586482f, 0.349453509f},
-std::array<float,2>{0.742042959f, 0.568930447f},
-std::array<float,2>{0.331315458f, 0.148576215f},
-std::array<float,2>{0.378258526f, 0.731909275f},
-std::array<float,2>{0.553090274f, 0.0709884465f},
-std::array<float,2>{0.974998116f, 0.77996856f},
-std::array<float,2>{0.228639945f, 0.482569814f},
-std::array<float,2>{0.157488436f, 0.514696002f},
-std::array<float,2>{0.925819516f, 0.198673636f},
-std::array<float,2>{0.61589551f, 0.962299228f},
-std::array<float,2>{0.485167444f, 0.259048492f},
-std::array<float,2>{0.270560324f, 0.817064226f},
-std::array<float,2>{0.654473782f, 0.390533894f},
-std::array<float,2>{0.802904189f, 0.65577054f},
-std::array<float,2>{0.0710961446f, 0.00660916837f},
-std::array<float,2>{0.188148171f, 0.804925978f},
-std::array<float,2>{0.94885391f, 0.441756785f},
-std::array<float,2>{0.508685231f, 0.71826303f},
-std::array<float,2>{0.408901066f, 0.106778242f},
-std::array<float,2>{0.370209992f, 0.621396124f},
-std::array<float,2>{0.689603508f, 0.179377198f},
-std::array<float,2>{0.844325066f, 0.878073037f},
-std::array<float,2>{0.0152118811f, 0.343600035f},
-std::array<float,2>{0.105757862f, 0.679792166f},
-std::array<float,2>{0.755190134f, 0.052504871f},
-std::array<float,2>{0.66276592f, 0.862368762f},
-std::array<float,2>{0.299216986f, 0.416998267f},
-std::array<float,2>{0.462455034f, 0.982131183f},
-std::array<float,2>{0.59204179f, 0.31137687f},
-std::array<float,2>{0.884493172f, 0.541869998f},
-std::array<float,2>{0.14575243f, 0.220021814f},
-std::array<float,2>{0.00360361882f, 0.76739645f},
-std::array<float,2>{0.852309048f, 0.474758267f},
-std::array<float,2>{0.698860645f, 0.725466669f},
-std::array<float,2>{0.360873073f, 0.0659575239f},
-std::array<float,2>{0.415658146f, 0.576793075f},
-std::array<float,2>{0.50242722f, 0.147893131f},
-std::array<float,2>{0.941593945f, 0.915719867f},
-std::array<float,2>{0.197152227f, 0.352060139f},
-std::array<float,2>{0.150498286f, 0.643567979f},
-std::array<float,2>{0.877463341f, 0.00925769936f},
-std::array<float,2>{0.578470826f, 0.824691176f},
-std::array<float,2>{0.458445013f, 0.377342045f},
-std::array<float,2>{0.3116377f, 0.954641283f},
-std::array<float,2>{0.667252302f, 0.257721573f},
-std::array<float,2>{0.760072291f, 0.502356768f},
-std::array<float,2>{0.0971279964f, 0.188663989f},
-std::array<float,2>{0.222122535f, 0.888269663f},
-std::array<float,2>{0.98284471f, 0.330479205f},
-std::array<float,2>{0.558599651f, 0.613893449f},
-std::array<float,2>{0.389722496f, 0.185604513f},
-std::array<float,2>{0.343340963f, 0.706168711f},
-std::array<float,2>{0.74406141f, 0.0968656093f},
-std::array<float,2>{0.827370465f, 0.802017093f},
-std::array<float,2>{0.0511039495f, 0.447922468f},
-std::array<float,2>{0.0652894899f, 0.538439691f},
-std::array<float,2>{0.808891952f, 0.22735931f},
-std::array<float,2>{0.646189451f, 0.969699979f},
-std::array<float,2>{0.276893258f, 0.297970444f},
-std::array<float,2>{0.496221066f, 0.872460663f},
-std::array<float,2>{0.62021184f, 0.407079786f},
-std::array<float,2>{0.933746815f, 0.678012371f},
-std::array<float,2>{0.166995704f, 0.0614664182f},
-std::array<float,2>{0.11088533f, 0.988530397f},
-std::array<float,2>{0.779891133f, 0.295765311f},
-std::array<float,2>{0.674892604f, 0.557039678f},
-std::array<float,2>{0.288970292f, 0.240302026f},
-std::array<float,2>{0.445991814f, 0.660936236f},
-std::array<float,2>{0.572408676f, 0.0462436453f},
-std::array<float,2>{0.899323165f, 0.84413588f},
-std::array<float,2>{0.1376293f, 0.433771133f},
-std::array<float,2>{0.20760563f, 0.594761252f},
-std::array<float,2>{0.961204171f, 0.171548113f},
-std::array<float,2>{0.524504602f, 0.904991984f},
-std::array<float,2>{0.42399931f, 0.324556738f},
-std::array<float,2>{0.355449557f, 0.786803961f},
-std::array<float,2>{0.715197444f, 0.468696237f},
-std::array<float,2>{0.861450016f, 0.694502056f},
-std::array<float,2>{0.0275571588f, 0.119936511f},
-std::array<float,2>{0.176861644f, 0.834187329f},
-std::array<float,2>{0.908500075f, 0.40223527f},
-std::array<float,2>{0.603085577f, 0.639537454f},
-std::array<float,2>{0.472506285f, 0.0290688369f},
-std::array<float,2>{0.25752461f, 0.528016925f},
-std::array<float,2>{0.637649834f, 0.214791149f},
-std::array<float,2>{0.784385383f, 0.940366924f},
-std::array<float,2>{0.0836381391f, 0.269798458f},
-std::array<float,2>{0.0327368975f, 0.745738864f},
-std::array<float,2>{0.834721327f, 0.0790601596f},
-std::array<float,2>{0.723321021f, 0.762825966f},
-std::array<float,2>{0.326836348f, 0.493587494f},
-std::array<float,2>{0.394837826f, 0.92571789f},
-std::array<float,2>{0.542819262f, 0.365040809f},
-std::array<float,2>{0.987745345f, 0.587552786f},
-std::array<float,2>{0.242134497f, 0.129636869f},
-std::array<float,2>{0.0462306701f, 0.820522308f},
-std::array<float,2>{0.84313339f, 0.381005794f},
-std::array<float,2>{0.727766633f, 0.645209134f},
-std::array<float,2>{0.316889495f, 0.0119584454f},
-std::array<float,2>{0.402597338f, 0.507205009f},
-std::array<float,2>{0.532176495f, 0.192615032f},
-std::array<float,2>{0.993306637f, 0.958368659f},
-std::array<float,2>{0.242637098f, 0.250369638f},
-std::array<float,2>{0.18037881f, 0.718866825f},
-std::array<float,2>{0.918613493f, 0.0668118522f},
-std::array<float,2>{0.601096988f, 0.772040069f},
-std::array<float,2>{0.48390311f, 0.470110863f},
-std::array<float,2>{0.263151526f, 0.920790255f},
-std::array<float,2>{0.629123032f, 0.358654201f},
-std::array<float,2>{0.790763915f, 0.573763132f},
-std::array<float,2>{0.0862776637f, 0.144360393f},
-std::array<float,2>{0.214922369f, 0.973093331f},
-std::array<float,2>{0.95701319f, 0.301191509f},
-std::array<float,2>{0.521799684f, 0.532714605f},
-std::array<float,2>{0.4326334f, 0.231424779f},
-std::array<float,2>{0.345764637f, 0.673805654f},
-std::array<float,2>{0.70527029f, 0.057004869f},
-std::array<float,2>{0.868855059f, 0.870910883f},
-std::array<float,2>{0.0200941134f, 0.411458671f},
-std::array<float,2>{0.1235471f, 0.609515131f},
-std::array<float,2>{0.766039371f, 0.182100639f},
-std::array<float,2>{0.684899926f, 0.886225104f},
-std::array<float,2>{0.296812028f, 0.334533006f},
-std::array<float,2>{0.440496057f, 0.800335705f},
-std::array<float,2>{0.568293214f, 0.452460825f},
-std::array<float,2>{0.896165907f, 0.709631383f},
-std::array<float,2>{0.126188427f, 0.0987977386f},
-std::array<float,2>{0.0767447874f, 0.900248528f},
-std::array<float,2>{0.799511254f, 0.323052853f},
-std::array<float,2>{0.650450289f, 0.599452198f},
-std::array<float,2>{0.265955627f, 0.165986925f},
-std::array<float,2>{0.489557803f, 0.690690815f},
-std::array<float,2>{0.611079395f, 0.121312506f},
-std::array<float,2>{0.922937214f, 0.78183943f},
-std::array<float,2>{0.160536781f, 0.462695152f},
-std::array<float,2>{0.232342541f, 0.558794081f},
-std::array<float,2>{0.97089231f, 0.235977069f},
-std::array<float,2>{0.549476147f, 0.985719323f},
-std::array<float,2>{0.380922705f, 0.28945604f},
-std::array<float,2>{0.335651249f, 0.851429284f},
-std::array<float,2>{0.734510839f, 0.432267457f},
-std::array<float,2>{0.815029323f, 0.658000946f},
-std::array<float,2>{0.058143016f, 0.0419311672f},
-std::array<float,2>{0.144356236f, 0.760378897f},
-std::array<float,2>{0.888803303f, 0.498322874f},
-std::array<float,2>{0.587947547f, 0.748724103f},
-std::array<float,2>{0.467162818f, 0.0843587741f},
-std::array<float,2>{0.303338766f, 0.59119606f},
-std::array<float,2>{0.657933354f, 0.126136124f},
-std::array<float,2>{0.752363861f, 0.928962648f},
-std::array<float,2>{0.103219457f, 0.361882359f},
-std::array<float,2>{0.00917394087f, 0.633611143f},
-std::array<float,2>{0.849772632f, 0.0254711155f},
-std::array<float,2>{0.693719089f, 0.829850197f},
-std::array<float,2>{0.372904986f, 0.403367847f},
-std::array<float,2>{0.412462741f, 0.944010556f},
-std::array<float,2>{0.512958884f, 0.265985817f},
-std::array<float,2>{0.952966928f, 0.525422931f},
-std::array<float,2>{0.191686228f, 0.218648612f},
-std::array<float,2>{0.0995891616f, 0.790924013f},
-std::array<float,2>{0.762328684f, 0.455759376f},
-std::array<float,2>{0.671284556f, 0.696594954f},
-std::array<float,2>{0.308469594f, 0.112883538f},
-std::array<float,2>{0.455144912f, 0.607314229f},
-std::array<float,2>{0.585898578f, 0.157082617f},
-std::array<float,2>{0.882027507f, 0.898172617f},
-std::array<float,2>{0.154960588f, 0.314429224f},
-std::array<float,2>{0.202379689f, 0.666371882f},
-std::array<float,2>{0.939920008f, 0.0336667001f},
-std::array<float,2>{0.505928934f, 0.854882538f},
-std::array<float,2>{0.421572328f, 0.422366381f},
-std::array<float,2>{0.365511745f, 0.997920394f},
-std::array<float,2>{0.699349344f, 0.284181565f},
-std::array<float,2>{0.856838644f, 0.549050808f},
-std::array<float,2>{0.00417226972f, 0.24965246f},
-std::array<float,2>{0.170508862f, 0.932754755f},
-std::array<float,2>{0.933344781f, 0.373519003f},
-std::array<float,2>{0.623503268f, 0.584045231f},
-std::array<float,2>{0.495427161f, 0.137335405f},
-std::array<float,2>{0.278615206f, 0.734384656f},
-std::array<float,2>{0.643188417f, 0.0860929042f},
-std::array<float,2>{0.805322468f, 0.755337417f},
-std::array<float,2>{0.0690266564f, 0.489109337f},
-std::array<float,2>{0.0478642359f, 0.521207631f},
-std::array<float,2>{0.820614874f, 0.205307975f},
-std::array<float,2>{0.746229112f, 0.948077857f},
-std::array<float,2>{0.33831647f, 0.280230731f},
-std::array<float,2>{0.383224726f, 0.836663842f},
-std::array<float,2>{0.55632627f, 0.398401499f},
-std::array<float,2>{0.979689538f, 0.625534952f},
-std::array<float,2>{0.223298863f, 0.0207655765f},
-std::array<float,2>{0.0239305645f, 0.968485534f},
-std::array<float,2>{0.86418134f, 0.265455365f},
-std::array<float,2>{0.713279188f, 0.511092782f},
-std::array<float,2>{0.359085858f, 0.202140331f},
-std::array<float,2>{0.427254081f, 0.651157558f},
-std::array<float,2>{0.528448403f, 0.00228582486f},
-std::array<float,2>{0.968518436f, 0.812603831f},
-std::array<float,2>{0.206087187f, 0.383042097f},
-std::array<float,2>{0.134170294f, 0.564344347f},
-std::array<float,2>{0.905148029f, 0.154469728f},
-std::array<float,2>{0.576205075f, 0.913898408f},
-std::array<float,2>{0.45074597f, 0.347418129f},
-std::array<float,2>{0.281600416f, 0.775076926f},
-std::array<float,2>{0.677455127f, 0.480312645f},
-std::array<float,2>{0.77683866f, 0.729108453f},
-std::array<float,2>{0.113697797f, 0.0756512731f},
-std::array<float,2>{0.237293512f, 0.863288224f},
-std::array<float,2>{0.98898232f, 0.420824468f},
-std::array<float,2>{0.543336928f, 0.68479681f},
-std::array<float,2>{0.393887967f, 0.0474662818f},
-std::array<float,2>{0.321345896f, 0.543944657f},
-std::array<float,2>{0.719473779f, 0.224543586f},
-std::array<float,2>{0.828556597f, 0.979694128f},
-std::array<float,2>{0.0383692458f, 0.307584882f},
-std::array<float,2>{0.0810969248f, 0.711690903f},
-std::array<float,2>{0.788264632f, 0.104770392f},
-std::array<float,2>{0.633307636f, 0.809825063f},
-std::array<float,2>{0.25242576f, 0.437730253f},
-std::array<float,2>{0.473681003f, 0.881664097f},
-std::array<float,2>{0.607938111f, 0.338293195f},
-std::array<float,2>{0.911244988f, 0.618330896f},
-std::array<float,2>{0.175728798f, 0.173719957f},
-std::array<float,2>{0.117368452f, 0.840350807f},
-std::array<float,2>{0.771939516f, 0.392401159f},
-std::array<float,2>{0.683229864f, 0.630231559f},
-std::array<float,2>{0.291898936f, 0.0167473443f},
-std::array<float,2>{0.443644494f, 0.517926812f},
-std::array<float,2>{0.563020349f, 0.208972931f},
-std::array<float,2>{0.890889168f, 0.952127099f},
-std::array<float,2>{0.131351039f, 0.274314702f},
-std::array<float,2>{0.213554606f, 0.74163121f},
-std::array<float,2>{0.957617164f, 0.0929960757f},
-std::array<float,2>{0.515876353f, 0.751939654f},
-std::array<float,2>{0.436401784f, 0.487119108f},
-std::array<float,2>{0.350082606f, 0.936501145f},
-std::array<float,2>{0.707173705f, 0.368121743f},
-std::array<float,2>{0.871527433f, 0.580158174f},
-std::array<float,2>{0.018432809f, 0.134438202f},
-std::array<float,2>{0.186412275f, 0.995461941f},
-std::array<float,2>{0.915400147f, 0.285311401f},
-std::array<float,2>{0.595040619f, 0.550858557f},
-std::array<float,2>{0.476992428f, 0.24498488f},
-std::array<float,2>{0.257814467f, 0.670292854f},
-std::array<float,2>{0.628027618f, 0.0381474309f},
-std::array<float,2>{0.795073986f, 0.859252214f},
-std::array<float,2>{0.0932974964f, 0.428037196f},
-std::array<float,2>{0.0400769711f, 0.601745486f},
-std::array<float,2>{0.838235855f, 0.161658615f},
-std::array<float,2>{0.733037233f, 0.893335819f},
-std::array<float,2>{0.315457284f, 0.318726987f},
-std::array<float,2>{0.401045471f, 0.793442309f},
-std::array<float,2>{0.538089693f, 0.458837152f},
-std::array<float,2>{0.999381363f, 0.700074375f},
-std::array<float,2>{0.249669164f, 0.116028413f},
-std::array<float,2>{0.0132479453f, 0.876823485f},
-std::array<float,2>{0.847561061f, 0.340736628f},
-std::array<float,2>{0.688653767f, 0.624855578f},
-std::array<float,2>{0.367752761f, 0.175795451f},
-std::array<float,2>{0.407115549f, 0.715268075f},
-std::array<float,2>{0.510102093f, 0.108550139f},
-std::array<float,2>{0.947028935f, 0.807302594f},
-std::array<float,2>{0.19043605f, 0.445088118f},
-std::array<float,2>{0.147991732f, 0.540922463f},
-std::array<float,2>{0.88613534f, 0.222059742f},
-std::array<float,2>{0.590308726f, 0.984335065f},
-std::array<float,2>{0.463934004f, 0.310236126f},
-std::array<float,2>{0.29787159f, 0.859850049f},
-std::array<float,2>{0.660910845f, 0.415008456f},
-std::array<float,2>{0.756103098f, 0.681795478f},
-std::array<float,2>{0.108380854f, 0.0541913696f},
-std::array<float,2>{0.227646172f, 0.779178202f},
-std::array<float,2>{0.974071681f, 0.482264429f},
-std::array<float,2>{0.551536977f, 0.732442558f},
-std::array<float,2>{0.375503123f, 0.074078463f},
-std::array<float,2>{0.328657568f, 0.566867709f},
-std::array<float,2>{0.738924801f, 0.150560737f},
-std::array<float,2>{0.819568634f, 0.909217954f},
-std::array<float,2>{0.0590932108f, 0.350692719f},
-std::array<float,2>{0.072288245f, 0.653039873f},
-std::array<float,2>{0.802004933f, 0.00525304489f},
-std::array<float,2>{0.652509212f, 0.819875181f},
-std::array<float,2>{0.272053808f, 0.388487846f},
-std::array<float,2>{0.487030566f, 0.962947726f},
-std::array<float,2>{0.614798665f, 0.260377795f},
-std::array<float,2>{0.928624511f, 0.513269067f},
-std::array<float,2>{0.159459874f, 0.195806801f},
-std::array<float,2>{0.0537273102f, 0.803217232f},
-std::array<float,2>{0.825218678f, 0.445320338f},
-std::array<float,2>{0.745012105f, 0.704912484f},
-std::array<float,2>{0.339892477f, 0.095626682f},
-std::array<float,2>{0.387561619f, 0.616490245f},
-std::array<float,2>{0.561629295f, 0.185001865f},
-std::array<float,2>{0.981452942f, 0.88997215f},
-std::array<float,2>{0.219987616f, 0.329180866f},
-std::array<float,2>{0.164275676f, 0.677015007f},
-std::array<float,2>{0.935894251f, 0.0601725616f},
-std::array<float,2>{0.617218256f, 0.873787701f},
-std::array<float,2>{0.498201847f, 0.409412324f},
-std::array<float,2>{0.274527967f, 0.971086979f},
-std::array<float,2>{0.647754312f, 0.2992751f},
-std::array<float,2>{0.810796976f, 0.535763264f},
-std::array<float,2>{0.0634782463f, 0.229009867f},
-std::array<float,2>{0.198560297f, 0.916907668f},
-std::array<float,2>{0.944753647f, 0.3543199f},
-std::array<float,2>{0.500491142f, 0.57460928f},
-std::array<float,2>{0.417055935f, 0.146009341f},
-std::array<float,2>{0.362063497f, 0.724588633f},
-std::array<float,2>{0.695957303f, 0.0627122149f},
-std::array<float,2>{0.85409373f, 0.767588556f},
-std::array<float,2>{0.00118184905f, 0.474558473f},
-std::array<float,2>{0.0951311439f, 0.501550674f},
-std::array<float,2>{0.758608222f, 0.189558178f},
-std::array<float,2>{0.66420418f, 0.955765307f},
-std::array<float,2>{0.309659123f, 0.255122185f},
-std::array<float,2>{0.460585058f, 0.826402724f},
-std::array<float,2>{0.581774414f, 0.375754297f},
-std::array<float,2>{0.87569958f, 0.641266465f},
-std::array<float,2>{0.15027608f, 0.0100804176f},
-std::array<float,2>{0.0855040476f, 0.938186944f},
-std::array<float,2>{0.781502962f, 0.27262944f},
-std::array<float,2>{0.640587866f, 0.53044951f},
-std::array<float,2>{0.254518718f, 0.211240903f},
-std::array<float,2>{0.469871998f, 0.637835979f},
-std::array<float,2>{0.603638828f, 0.0294478182f},
-std::array<float,2>{0.90743202f, 0.832842171f},
-std::array<float,2>{0.178035483f, 0.399090558f},
-std::array<float,2>{0.239848346f, 0.589112937f},
-std::array<float,2>{0.985791981f, 0.13146925f},
-std::array<float,2>{0.540875554f, 0.92206037f},
-std::array<float,2>{0.396879852f, 0.365927368f},
-std::array<float,2>{0.325217813f, 0.763688982f},
-std::array<float,2>{0.726313651f, 0.495411605f},
-std::array<float,2>{0.833276153f, 0.742782176f},
-std::array<float,2>{0.0349106975f, 0.0817579776f},
-std::array<float,2>{0.138874248f, 0.845903873f},
-std::array<float,2>{0.901683152f, 0.436513007f},
-std::array<float,2>{0.571959913f, 0.662261248f},
-std::array<float,2>{0.448503196f, 0.0432073884f},
-std::array<float,2>{0.285999238f, 0.556527436f},
-std::array<float,2>{0.672971427f, 0.239722565f},
-std::array<float,2>{0.777591825f, 0.991449296f},
-std::array<float,2>{0.112466924f, 0.29337728f},
-std::array<float,2>{0.0306250639f, 0.691908836f},
-std::array<float,2>{0.859930754f, 0.118573025f},
-std::array<float,2>{0.718011618f, 0.788750887f},
-std::array<float,2>{0.353003889f, 0.466404557f},
-std::array<float,2>{0.423578233f, 0.902925909f},
-std::array<float,2>{0.525465608f, 0.327632457f},
-std::array<float,2>{0.964181066f, 0.59765172f},
-std::array<float,2>{0.210709527f, 0.168198824f},
-std::array<float,2>{0.0233368743f, 0.867546916f},
-std::array<float,2>{0.870976627f, 0.413089275f},
-std::array<float,2>{0.704033554f, 0.67473495f},
-std::array<float,2>{0.345170319f, 0.0557231121f},
-std::array<float,2>{0.430127263f, 0.534214735f},
-std::array<float,2>{0.521194816f, 0.233660087f},
-std::array<float,2>{0.955026329f, 0.975028098f},
-std::array<float,2>{0.217324793f, 0.303474873f},
-std::array<float,2>{0.128406823f, 0.708661735f},
-std::array<float,2>{0.896626472f, 0.0998273566f},
-std::array<float,2>{0.569279373f, 0.797586441f},
-std::array<float,2>{0.437777549f, 0.450843483f},
-std::array<float,2>{0.294719011f, 0.882917047f},
-std::array<float,2>{0.687331676f, 0.333396256f},
-std::array<float,2>{0.769466817f, 0.612492025f},
-std::array<float,2>{0.122848183f, 0.180147752f},
-std::array<float,2>{0.244899005f, 0.959188819f},
-std::array<float,2>{0.995503187f, 0.253362447f},
-std::array<float,2>{0.533694565f, 0.505230367f},
-std::array<float,2>{0.404322624f, 0.19403401f},
-std::array<float,2>{0.319312543f, 0.648429453f},
-std::array<float,2>{0.729042113f, 0.014332355f},
-std::array<float,2>{0.841524005f, 0.823946714f},
-std::array<float,2>{0.0433551818f, 0.379000336f},
-std::array<float,2>{0.0893834978f, 0.572204709f},
-std::array<float,2>{0.792367756f, 0.141712233f},
-std::array<float,2>{0.632008076f, 0.918299198f},
-std::array<float,2>{0.264085084f, 0.35615012f},
-std::array<float,2>{0.480709106f, 0.771465242f},
-std::array<float,2>{0.598781943f, 0.471889824f},
-std::array<float,2>{0.920338929f, 0.720772028f},
-std::array<float,2>{0.182798013f, 0.0694258735f},
-std::array<float,2>{0.104407176f, 0.926440597f},
-std::array<float,2>{0.751039505f, 0.36131829f},
-std::array<float,2>{0.659704924f, 0.59220016f},
-std::array<float,2>{0.302239299f, 0.128224671f},
-std::array<float,2>{0.466570199f, 0.746555388f},
-std::array<float,2>{0.586606324f, 0.083371602f},
-std::array<float,2>{0.886925638f, 0.758381248f},
-std::array<float,2>{0.142353967f, 0.497446805f},
-std::array<float,2>{0.195267215f, 0.524317205f},
-std::array<float,2>{0.950878024f, 0.21554552f},
-std::array<float,2>{0.513709247f, 0.943086147f},
-std::array<float,2>{0.411312968f, 0.269060075f},
-std::array<float,2>{0.373769909f, 0.831625581f},
-std::array<float,2>{0.692201018f, 0.404414147f},
-std::array<float,2>{0.848610222f, 0.634943068f},
-std::array<float,2>{0.01121502f, 0.0234441534f},
-std::array<float,2>{0.163195789f, 0.783876002f},
-std::array<float,2>{0.925145686f, 0.464033395f},
-std::array<float,2>{0.612849712f, 0.688425481f},
-std::array<float,2>{0.491313845f, 0.124276258f},
-std::array<float,2>{0.268102676f, 0.600936294f},
-std::array<float,2>{0.648575604f, 0.167668357f},
-std::array<float,2>{0.797222614f, 0.902302444f},
-std::array<float,2>{0.0750169754f, 0.321277648f},
-std::array<float,2>{0.0558422096f, 0.659688473f},
-std::array<float,2>{0.812685072f, 0.0391639732f},
-std::array<float,2>{0.737063944f, 0.847913682f},
-std::array<float,2>{0.333976418f, 0.429883003f},
-std::array<float,2>{0.380115569f, 0.986693621f},
-std::array<float,2>{0.547458649f, 0.291244328f},
-std::array<float,2>{0.970645785f, 0.562199533f},
-std::array<float,2>{0.23280412f, 0.238033295f},
-std::array<float,2>{0.0666413456f, 0.756587982f},
-std::array<float,2>{0.808199346f, 0.49204278f},
-std::array<float,2>{0.640968084f, 0.738227606f},
-std::array<float,2>{0.280385077f, 0.0889375731f},
-std::array<float,2>{0.493157476f, 0.583119929f},
-std::array<float,2>{0.621433794f, 0.139789432f},
-std::array<float,2>{0.930864692f, 0.92985332f},
-std::array<float,2>{0.168204576f, 0.372673154f},
-std::array<float,2>{0.226286024f, 0.627636433f},
-std::array<float,2>{0.977499127f, 0.0224250164f},
-std::array<float,2>{0.55729121f, 0.839655042f},
-std::array<float,2>{0.385433912f, 0.39497757f},
-std::array<float,2>{0.337552905f, 0.947078764f},
-std::array<float,2>{0.74946183f, 0.27862817f},
-std::array<float,2>{0.822443128f, 0.522767365f},
-std::array<float,2>{0.0493819006f, 0.204362214f},
-std::array<float,2>{0.152774841f, 0.895711482f},
-std::array<float,2>{0.879739165f, 0.315470427f},
-std::array<float,2>{0.583078861f, 0.609343886f},
-std::array<float,2>{0.455073774f, 0.159907624f},
-std::array<float,2>{0.306306452f, 0.698512971f},
-std::array<float,2>{0.668687999f, 0.110096969f},
-std::array<float,2>{0.764973998f, 0.791726172f},
-std::array<float,2>{0.10058625f, 0.453144163f},
-std::array<float,2>{0.00655914657f, 0.547060847f},
-std::array<float,2>{0.858464062f, 0.246814266f},
-std::array<float,2>{0.701461017f, 0.998830497f},
-std::array<float,2>{0.364573747f, 0.281302303f},
-std::array<float,2>{0.419440091f, 0.852738202f},
-std::array<float,2>{0.50400418f, 0.424899429f},
-std::array<float,2>{0.939004421f, 0.664178312f},
-std::array<float,2>{0.200280622f, 0.0326657556f},
-std::array<float,2>{0.0353794731f, 0.977133989f},
-std::array<float,2>{0.830663979f, 0.306344539f},
-std::array<float,2>{0.72175163f, 0.545044005f},
-std::array<float,2>{0.322537303f, 0.224683434f},
-std::array<float,2>{0.391640574f, 0.68712163f},
-std::array<float,2>{0.54651475f, 0.0491671488f},
-std::array<float,2>{0.991564691f, 0.867181182f},
-std::array<float,2>{0.236265227f, 0.418329984f},
-std::array<float,2>{0.172656059f, 0.620968521f},
-std::array<float,2>{0.913251102f, 0.174323559f},
-std::array<float,2>{0.606914401f, 0.879426122f},
-std::array<float,2>{0.475851268f, 0.336651146f},
-std::array<float,2>{0.250648975f, 0.811618388f},
-std::array<float,2>{0.635211527f, 0.441026896f},
-std::array<float,2>{0.785245955f, 0.713810623f},
-std::array<float,2>{0.0782575533f, 0.103502676f},
-std::array<float,2>{0.204190895f, 0.814700484f},
-std::array<float,2>{0.965982616f, 0.386657059f},
-std::array<float,2>{0.530412436f, 0.648585021f},
-std::array<float,2>{0.429516375f, 0.00127784861f},
-std::array<float,2>{0.357086331f, 0.509013295f},
-std::array<float,2>{0.711975574f, 0.20047608f},
-std::array<float,2>{0.865802884f, 0.966433048f},
-std::array<float,2>{0.0261526965f, 0.262502134f},
-std::array<float,2>{0.11652755f, 0.727314889f},
-std::array<float,2>{0.774917066f, 0.0774388909f},
-std::array<float,2>{0.677869916f, 0.777217925f},
-std::array<float,2>{0.284403831f, 0.47785303f},
-std::array<float,2>{0.452604175f, 0.911174893f},
-std::array<float,2>{0.574641526f, 0.344173789f},
-std::array<float,2>{0.904176056f, 0.565500617f},
-std::array<float,2>{0.135741338f, 0.15352346f},
-std::array<float,2>{0.112924606f, 0.844507992f},
-std::array<float,2>{0.778288126f, 0.434142172f},
-std::array<float,2>{0.673674345f, 0.660526991f},
-std::array<float,2>{0.285377294f, 0.0465311259f},
-std::array<float,2>{0.44890818f, 0.557214439f},
-std::array<float,2>{0.571596682f, 0.240821034f},
-std::array<float,2>{0.90221113f, 0.98891139f},
-std::array<float,2>{0.139436528f, 0.295080662f},
-std::array<float,2>{0.210266396f, 0.695288956f},
-std::array<float,2>{0.964637756f, 0.119457752f},
-std::array<float,2>{0.526139379f, 0.786386967f},
-std::array<float,2>{0.423243135f, 0.46826154f},
-std::array<float,2>{0.353483111f, 0.904623628f},
-std::array<float,2>{0.718737662f, 0.325145066f},
-std::array<float,2>{0.859526157f, 0.595665276f},
-std::array<float,2>{0.0309689343f, 0.171363622f},
-std::array<float,2>{0.178585395f, 0.939542949f},
-std::array<float,2>{0.908061683f, 0.270174563f},
-std::array<float,2>{0.604289114f, 0.527605176f},
-std::array<float,2>{0.470385939f, 0.214254931f},
-std::array<float,2>{0.254146695f, 0.638741136f},
-std::array<float,2>{0.639876008f, 0.0287674759f},
-std::array<float,2>{0.78212589f, 0.834632337f},
-std::array<float,2>{0.0850619972f, 0.401640832f},
-std::array<float,2>{0.0344805308f, 0.586985111f},
-std::array<float,2>{0.83354032f, 0.128907621f},
-std::array<float,2>{0.726030409f, 0.924911082f},
-std::array<float,2>{0.32576263f, 0.364404678f},
-std::array<float,2>{0.397045821f, 0.763291657f},
-std::array<float,2>{0.540190458f, 0.493776977f},
-std::array<float,2>{0.985947371f, 0.745527148f},
-std::array<float,2>{0.239702255f, 0.0781422928f},
-std::array<float,2>{0.00185867155f, 0.915193379f},
-std::array<float,2>{0.853975117f, 0.351926684f},
-std::array<float,2>{0.69574821f, 0.576193869f},
-std::array<float,2>{0.361438781f, 0.148406625f},
-std::array<float,2>{0.417776525f, 0.725062072f},
-std::array<float,2>{0.500169337f, 0.0657093525f},
-std::array<float,2>{0.944867909f, 0.767070413f},
-std::array<float,2>{0.199095115f, 0.475339085f},
-std::array<float,2>{0.149493828f, 0.502815962f},
-std::array<float,2>{0.87532109f, 0.18941471f},
-std::array<float,2>{0.581350625f, 0.954530537f},
-std::array<float,2>{0.460411698f, 0.256884187f},
-std::array<float,2>{0.310519099f, 0.824842393f},
-std::array<float,2>{0.664664447f, 0.377676755f},
-std::array<float,2>{0.758222103f, 0.644300997f},
-std::array<float,2>{0.0952335522f, 0.00945807248f},
-std::array<float,2>{0.220677048f, 0.802598059f},
-std::array<float,2>{0.982033491f, 0.447741807f},
-std::array<float,2>{0.562306404f, 0.706899464f},
-std::array<float,2>{0.387169778f, 0.0974572524f},
-std::array<float,2>{0.340787649f, 0.613759995f},
-std::array<float,2>{0.744442761f, 0.186347336f},
-std::array<float,2>{0.826058865f, 0.887748957f},
-std::array<float,2>{0.0544529743f, 0.330792487f},
-std::array<float,2>{0.0644479468f, 0.678464592f},
-std::array<float,2>{0.811339498f, 0.0608437359f},
-std::array<float,2>{0.648048699f, 0.872991502f},
-std::array<float,2>{0.275165737f, 0.406606883f},
-std::array<float,2>{0.49899438f, 0.968917191f},
-std::array<float,2>{0.617943943f, 0.298794419f},
-std::array<float,2>{0.936073542f, 0.538868427f},
-std::array<float,2>{0.164932847f, 0.226788193f},
-std::array<float,2>{0.0589962974f, 0.779416144f},
-std::array<float,2>{0.820221007f, 0.483207196f},
-std::array<float,2>{0.73863107f, 0.732213616f},
-std::array<float,2>{0.328484476f, 0.070423767f},
-std::array<float,2>{0.375092208f, 0.568598807f},
-std::array<float,2>{0.550984442f, 0.149368584f},
-std::array<float,2>{0.974309504f, 0.906500876f},
-std::array<float,2>{0.228108674f, 0.348941922f},
-std::array<float,2>{0.159707546f, 0.655329108f},
-std::array<float,2>{0.927968502f, 0.00617285864f},
-std::array<float,2>{0.614463806f, 0.816788495f},
-std::array<float,2>{0.486430854f, 0.389791936f},
-std::array<float,2>{0.271650463f, 0.962513387f},
-std::array<float,2>{0.652878761f, 0.259469986f},
-std::array<float,2>{0.802292526f, 0.515562534f},
-std::array<float,2>{0.0730239078f, 0.199124962f},
-std::array<float,2>{0.191034272f, 0.878772855f},
-std::array<float,2>{0.946645617f, 0.342999279f},
-std::array<float,2>{0.510462165f, 0.621969461f},
-std::array<float,2>{0.406603873f, 0.179135367f},
-std::array<float,2>{0.367532641f, 0.71823597f},
-std::array<float,2>{0.689334035f, 0.107218616f},
-std::array<float,2>{0.846941829f, 0.805242479f},
-std::array<float,2>{0.0129192118f, 0.442234248f},
-std::array<float,2>{0.107467674f, 0.541359901f},
-std::array<float,2>{0.756557941f, 0.220273539f},
-std::array<float,2>{0.660528779f, 0.98145479f},
-std::array<float,2>{0.298706591f, 0.310804933f},
-std::array<float,2>{0.464624465f, 0.862841606f},
-std::array<float,2>{0.590396702f, 0.417684883f},
-std::array<float,2>{0.886690795f, 0.680522323f},
-std::array<float,2>{0.147845984f, 0.0520050265f},
-std::array<float,2>{0.0930213258f, 0.992783427f},
-std::array<float,2>{0.795758724f, 0.287993491f},
-std::array<float,2>{0.628766179f, 0.554204106f},
-std::array<float,2>{0.258557558f, 0.242984831f},
-std::array<float,2>{0.47713998f, 0.66914624f},
-std::array<float,2>{0.595598996f, 0.0352843441f},
-std::array<float,2>{0.915553153f, 0.856330276f},
-std::array<float,2>{0.185580879f, 0.425897151f},
-std::array<float,2>{0.249200866f, 0.603879094f},
-std::array<float,2>{0.999906719f, 0.162196413f},
-std::array<float,2>{0.538729429f, 0.89094907f},
-std::array<float,2>{0.40066722f, 0.317994535f},
-std::array<float,2>{0.316026211f, 0.796388984f},
-std::array<float,2>{0.732873857f, 0.460456043f},
-std::array<float,2>{0.838768184f, 0.702219605f},
-std::array<float,2>{0.040640112f, 0.114619963f},
-std::array<float,2>{0.131139621f, 0.842714012f},
-std::array<float,2>{0.891220987f, 0.39339596f},
-std::array<float,2>{0.562789619f, 0.632177114f},
-std::array<float,2>{0.444118381f, 0.01842691f},
-std::array<float,2>{0.291158408f, 0.516904771f},
-std::array<float,2>{0.683062971f, 0.210207552f},
-std::array<float,2>{0.772193253f, 0.951033831f},
-std::array<float,2>{0.11808268f, 0.275823087f},
-std::array<float,2>{0.0180107728f, 0.74020195f},
-std::array<float,2>{0.871639371f, 0.0912402943f},
-std::array<float,2>{0.70768559f, 0.753467143f},
-std::array<float,2>{0.350550026f, 0.485298723f},
-std::array<float,2>{0.435750574f, 0.933669806f},
-std::array<float,2>{0.516507447f, 0.370288044f},
-std::array<float,2>{0.957089424f, 0.579666138f},
-std::array<float,2>{0.213368103f, 0.13637422f},
-std::array<float,2>{0.0257736389f, 0.813224554f},
-std::array<float,2>{0.865368307f, 0.383347243f},
-std::array<float,2>{0.71252203f, 0.650599122f},
-std::array<float,2>{0.356916547f, 0.00289910426f},
-std::array<float,2>{0.429168463f, 0.511446238f},
-std::array<float,2>{0.531095624f, 0.201276287f},
-std::array<float,2>{0.966362596f, 0.968110561f},
-std::array<float,2>{0.204993054f, 0.264945865f},
-std::array<float,2>{0.135166571f, 0.728933275f},
-std::array<float,2>{0.903438628f, 0.0761161149f},
-std::array<float,2>{0.574731231f, 0.774677455f},
-std::array<float,2>{0.45279038f, 0.479506493f},
-std::array<float,2>{0.284870595f, 0.913370013f},
-std::array<float,2>{0.678591251f, 0.347070366f},
-std::array<float,2>{0.774902105f, 0.563854754f},
-std::array<float,2>{0.116806842f, 0.154903635f},
-std::array<float,2>{0.235601559f, 0.980436325f},
-std::array<float,2>{0.991872489f, 0.306869924f},
-std::array<float,2>{0.545940816f, 0.543263137f},
-std::array<float,2>{0.392439544f, 0.224021003f},
-std::array<float,2>{0.32294333f, 0.685260832f},
-std::array<float,2>{0.722556233f, 0.0471958369f},
-std::array<float,2>{0.830514073f, 0.864199162f},
-std::array<float,2>{0.03568317f, 0.419964015f},
-std::array<float,2>{0.0789772496f, 0.619095385f},
-std::array<float,2>{0.786074638f, 0.172984183f},
-std::array<float,2>{0.635307968f, 0.881106973f},
-std::array<float,2>{0.250393212f, 0.338830292f},
-std::array<float,2>{0.476121157f, 0.810117304f},
-std::array<float,2>{0.607091725f, 0.438405454f},
-std::array<float,2>{0.913812637f, 0.711196303f},
-std::array<float,2>{0.171990216f, 0.10500396f},
-std::array<float,2>{0.101290539f, 0.897855699f},
-std::array<float,2>{0.765191495f, 0.313546062f},
-std::array<float,2>{0.66844064f, 0.606611967f},
-std::array<float,2>{0.306128889f, 0.156403363f},
-std::array<float,2>{0.454438716f, 0.697153986f},
-std::array<float,2>{0.58355248f, 0.112473503f},
-std::array<float,2>{0.879256308f, 0.790210068f},
-std::array<float,2>{0.153274164f, 0.455194473f},
-std::array<float,2>{0.201047108f, 0.549531043f},
-std::array<float,2>{0.938651383f, 0.249248341f},
-std::array<float,2>{0.504769683f, 0.997514546f},
-std::array<float,2>{0.419079363f, 0.285078406f},
-std::array<float,2>{0.364948869f, 0.855403244f},
-std::array<float,2>{0.701929748f, 0.422089756f},
-std::array<float,2>{0.859195173f, 0.666825116f},
-std::array<float,2>{0.00610799063f, 0.0338083319f},
-std::array<float,2>{0.168819457f, 0.755614936f},
-std::array<float,2>{0.931327522f, 0.48867768f},
-std::array<float,2>{0.621623456f, 0.735015929f},
-std::array<float,2>{0.492606163f, 0.086697042f},
-std::array<float,2>{0.280851543f, 0.584839225f},
-std::array<float,2>{0.64123857f, 0.13706854f},
-std::array<float,2>{0.807908714f, 0.933106899f},
-std::array<float,2>{0.0672875047f, 0.373807222f},
-std::array<float,2>{0.0488366038f, 0.625209272f},
-std::array<float,2>{0.823230684f, 0.0211283751f},
-std::array<float,2>{0.749584675f, 0.836059451f},
-std::array<float,2>{0.33718574f, 0.397883356f},
-std::array<float,2>{0.385095567f, 0.94773519f},
-std::array<float,2>{0.556767762f, 0.279481798f},
-std::array<float,2>{0.976971924f, 0.520706534f},
-std::array<float,2>{0.225797728f, 0.205725342f},
-std::array<float,2>{0.0744074509f, 0.781341493f},
-std::array<float,2>{0.797720909f, 0.462236613f},
-std::array<float,2>{0.649373651f, 0.691236854f},
-std::array<float,2>{0.267941296f, 0.121955156f},
-std::array<float,2>{0.491833568f, 0.599048078f},
-std::array<float,2>{0.612547159f, 0.165453956f},
-std::array<float,2>{0.925711036f, 0.899814308f},
-std::array<float,2>{0.163740173f, 0.322655678f},
-std::array<float,2>{0.233269066f, 0.657456279f},
-std::array<float,2>{0.969766855f, 0.0413671136f},
-std::array<float,2>{0.547227979f, 0.850637197f},
-std::array<float,2>{0.38042891f, 0.431968778f},
-std::array<float,2>{0.333268464f, 0.986085653f},
-std::array<float,2>{0.736681819f, 0.289833337f},
-std::array<float,2>{0.813077152f, 0.559525013f},
-std::array<float,2>{0.0561781563f, 0.235622242f},
-std::array<float,2>{0.141788006f, 0.929563522f},
-std::array<float,2>{0.887613416f, 0.361644506f},
-std::array<float,2>{0.586259842f, 0.591332614f},
-std::array<float,2>{0.465993613f, 0.126885727f},
-std::array<float,2>{0.302495509f, 0.748052001f},
-std::array<float,2>{0.659368098f, 0.0847494006f},
-std::array<float,2>{0.751894057f, 0.759848654f},
-std::array<float,2>{0.103538975f, 0.49861449f},
-std::array<float,2>{0.0112633323f, 0.526283324f},
-std::array<float,2>{0.848036349f, 0.217971832f},
-std::array<float,2>{0.691776752f, 0.943378687f},
-std::array<float,2>{0.373140603f, 0.266448557f},
-std::array<float,2>{0.411888987f, 0.829385579f},
-std::array<float,2>{0.51461482f, 0.403875172f},
-std::array<float,2>{0.950432181f, 0.633199334f},
-std::array<float,2>{0.194480374f, 0.0263100248f},
-std::array<float,2>{0.0435372666f, 0.958555281f},
-std::array<float,2>{0.841069281f, 0.250974983f},
-std::array<float,2>{0.728542089f, 0.507554352f},
-std::array<float,2>{0.318763137f, 0.193181172f},
-std::array<float,2>{0.405042797f, 0.644868731f},
-std::array<float,2>{0.533379674f, 0.0122448858f},
-std::array<float,2>{0.995818675f, 0.821003795f},
-std::array<float,2>{0.244587392f, 0.381731331f},
-std::array<float,2>{0.183259219f, 0.573454082f},
-std::array<float,2>{0.920444787f, 0.143592626f},
-std::array<float,2>{0.599594951f, 0.920186698f},
-std::array<float,2>{0.480978489f, 0.359236717f},
-std::array<float,2>{0.264196992f, 0.771575987f},
-std::array<float,2>{0.632495046f, 0.470381558f},
-std::array<float,2>{0.792506933f, 0.719637096f},
-std::array<float,2>{0.0891752467f, 0.0673052669f},
-std::array<float,2>{0.217149377f, 0.87047708f},
-std::array<float,2>{0.9545331f, 0.412013769f},
-std::array<float,2>{0.520728528f, 0.672932386f},
-std::array<float,2>{0.430648535f, 0.0574297719f},
-std::array<float,2>{0.345553398f, 0.53283155f},
-std::array<float,2>{0.703459322f, 0.2309369f},
-std::array<float,2>{0.87044847f, 0.973590851f},
-std::array<float,2>{0.022877695f, 0.301468492f},
-std::array<float,2>{0.122427806f, 0.709126413f},
-std::array<float,2>{0.769035578f, 0.0995322987f},
-std::array<float,2>{0.68679601f, 0.800126255f},
-std::array<float,2>{0.293991059f, 0.452901989f},
-std::array<float,2>{0.438293755f, 0.886604309f},
-std::array<float,2>{0.568731546f, 0.334134728f},
-std::array<float,2>{0.897236526f, 0.610189497f},
-std::array<float,2>{0.128724813f, 0.18244414f},
-std::array<float,2>{0.0830944255f, 0.832430005f},
-std::array<float,2>{0.784676731f, 0.398586512f},
-std::array<float,2>{0.636974931f, 0.638243377f},
-std::array<float,2>{0.257275999f, 0.0300009474f},
-std::array<float,2>{0.471843809f, 0.531188786f},
-std::array<float,2>{0.602677464f, 0.211429566f},
-std::array<float,2>{0.908786416f, 0.937809706f},
-std::array<float,2>{0.177388713f, 0.273402005f},
-std::array<float,2>{0.241588652f, 0.742197812f},
-std::array<float,2>{0.987847924f, 0.0815022364f},
-std::array<float,2>{0.542133749f, 0.764518678f},
-std::array<float,2>{0.395261705f, 0.495926976f},
-std::array<float,2>{0.326300859f, 0.922570884f},
-std::array<float,2>{0.723064065f, 0.365615398f},
-std::array<float,2>{0.834229052f, 0.589653552f},
-std::array<float,2>{0.0322498903f, 0.130953997f},
-std::array<float,2>{0.136956245f, 0.992032647f},
-std::array<float,2>{0.89876616f, 0.29373306f},
-std::array<float,2>{0.572909355f, 0.555724859f},
-std::array<float,2>{0.445711255f, 0.24007234f},
-std::array<float,2>{0.288481027f, 0.662607729f},
-std::array<float,2>{0.675297856f, 0.0436185449f},
-std::array<float,2>{0.779622734f, 0.846602023f},
-std::array<float,2>{0.110828318f, 0.435821861f},
-std::array<float,2>{0.0283108614f, 0.596982539f},
-std::array<float,2>{0.862095714f, 0.168831244f},
-std::array<float,2>{0.715554714f, 0.902440906f},
-std::array<float,2>{0.354673952f, 0.327815652f},
-std::array<float,2>{0.424793035f, 0.788384616f},
-std::array<float,2>{0.52512598f, 0.466001064f},
-std::array<float,2>{0.961552262f, 0.691523552f},
-std::array<float,2>{0.207192168f, 0.118704878f},
-std::array<float,2>{0.0516044572f, 0.890277743f},
-std::array<float,2>{0.827997267f, 0.329708189f},
-std::array<float,2>{0.74317795f, 0.616790652f},
-std::array<float,2>{0.34292686f, 0.185143203f},
-std::array<float,2>{0.390167266f, 0.704474032f},
-std::array<float,2>{0.559155941f, 0.0949919745f},
-std::array<float,2>{0.983091593f, 0.803614855f},
-std::array<float,2>{0.222214878f, 0.445979089f},
-std::array<float,2>{0.167749181f, 0.535563409f},
-std::array<float,2>{0.934211969f, 0.228538707f},
-std::array<float,2>{0.620743752f, 0.971664786f},
-std::array<float,2>{0.496736377f, 0.299445987f},
-std::array<float,2>{0.276845634f, 0.873086452f},
-std::array<float,2>{0.645541012f, 0.410072148f},
-std::array<float,2>{0.809401453f, 0.677267373f},
-std::array<float,2>{0.0648724362f, 0.0598525219f},
-std::array<float,2>{0.196419552f, 0.768119752f},
-std::array<float,2>{0.942268014f, 0.474055648f},
-std::array<float,2>{0.50277096f, 0.723717868f},
-std::array<float,2>{0.415391296f, 0.0631770194f},
-std::array<float,2>{0.360810786f, 0.574792147f},
-std::array<float,2>{0.698473334f, 0.14554736f},
-std::array<float,2>{0.851966679f, 0.916088939f},
-std::array<float,2>{0.00303781405f, 0.353707612f},
-std::array<float,2>{0.0974693745f, 0.641015351f},
-std::array<float,2>{0.760493934f, 0.0104408441f},
-std::array<float,2>{0.667747498f, 0.826823652f},
-std::array<float,2>{0.312215328f, 0.375402361f},
-std::array<float,2>{0.45895943f, 0.955447733f},
-std::array<float,2>{0.578710437f, 0.255526155f},
-std::array<float,2>{0.877293885f, 0.501272976f},
-std::array<float,2>{0.151031941f, 0.189949617f},
-std::array<float,2>{0.0148032205f, 0.807091117f},
-std::array<float,2>{0.843790531f, 0.444586158f},
-std::array<float,2>{0.690205216f, 0.715489507f},
-std::array<float,2>{0.371082067f, 0.10933689f},
-std::array<float,2>{0.408384115f, 0.624496937f},
-std::array<float,2>{0.507900178f, 0.176706687f},
-std::array<float,2>{0.948486865f, 0.876174569f},
-std::array<float,2>{0.187628016f, 0.339870244f},
-std::array<float,2>{0.146229073f, 0.682540476f},
-std::array<float,2>{0.883841038f, 0.054618042f},
-std::array<float,2>{0.592678428f, 0.86007458f},
-std::array<float,2>{0.462096393f, 0.414524347f},
-std::array<float,2>{0.299689263f, 0.983502746f},
-std::array<float,2>{0.662298381f, 0.309589982f},
-std::array<float,2>{0.755416989f, 0.540256321f},
-std::array<float,2>{0.106009655f, 0.222597942f},
-std::array<float,2>{0.22913903f, 0.909906626f},
-std::array<float,2>{0.975356638f, 0.351320416f},
-std::array<float,2>{0.553438187f, 0.567075014f},
-std::array<float,2>{0.378542006f, 0.151207983f},
-std::array<float,2>{0.331830442f, 0.733160794f},
-std::array<float,2>{0.741577446f, 0.073305577f},
-std::array<float,2>{0.817872167f, 0.77849102f},
-std::array<float,2>{0.0606551804f, 0.481708378f},
-std::array<float,2>{0.0706186667f, 0.512769103f},
-std::array<float,2>{0.80338484f, 0.195658624f},
-std::array<float,2>{0.654983759f, 0.963756859f},
-std::array<float,2>{0.27137813f, 0.260106802f},
-std::array<float,2>{0.484416157f, 0.819384873f},
-std::array<float,2>{0.615455508f, 0.387881726f},
-std::array<float,2>{0.926642597f, 0.652680099f},
-std::array<float,2>{0.157791257f, 0.00547872297f},
-std::array<float,2>{0.119894229f, 0.951260269f},
-std::array<float,2>{0.769611776f, 0.273447126f},
-std::array<float,2>{0.680585086f, 0.518352091f},
-std::array<float,2>{0.290462166f, 0.208072767f},
-std::array<float,2>{0.443001181f, 0.630788684f},
-std::array<float,2>{0.566019654f, 0.017312834f},
-std::array<float,2>{0.893449128f, 0.839999974f},
-std::array<float,2>{0.129034027f, 0.391944766f},
-std::array<float,2>{0.211929277f, 0.58062464f},
-std::array<float,2>{0.959573984f, 0.134003907f},
-std::array<float,2>{0.517751873f, 0.935970366f},
-std::array<float,2>{0.435213119f, 0.36761567f},
-std::array<float,2>{0.348330647f, 0.750977099f},
-std::array<float,2>{0.710391521f, 0.486585915f},
-std::array<float,2>{0.874463201f, 0.742153823f},
-std::array<float,2>{0.0174698997f, 0.093590863f},
-std::array<float,2>{0.185230389f, 0.858591795f},
-std::array<float,2>{0.917506039f, 0.428630859f},
-std::array<float,2>{0.596611679f, 0.67076385f},
-std::array<float,2>{0.478932768f, 0.0388594344f},
-std::array<float,2>{0.261685967f, 0.551648676f},
-std::array<float,2>{0.626289904f, 0.244249716f},
-std::array<float,2>{0.793827713f, 0.995869577f},
-std::array<float,2>{0.0899264738f, 0.285695016f},
-std::array<float,2>{0.0423235595f, 0.699577034f},
-std::array<float,2>{0.836749673f, 0.115514092f},
-std::array<float,2>{0.731300592f, 0.793724775f},
-std::array<float,2>{0.31406489f, 0.45841518f},
-std::array<float,2>{0.398599744f, 0.892634869f},
-std::array<float,2>{0.537004173f, 0.319212288f},
-std::array<float,2>{0.997908592f, 0.602084041f},
-std::array<float,2>{0.247768193f, 0.161573961f},
-std::array<float,2>{0.0388079472f, 0.86638844f},
-std::array<float,2>{0.828738928f, 0.418921709f},
-std::array<float,2>{0.718929052f, 0.686776161f},
-std::array<float,2>{0.321836531f, 0.0497678332f},
-std::array<float,2>{0.394243807f, 0.545798063f},
-std::array<float,2>{0.543902159f, 0.225248158f},
-std::array<float,2>{0.988688648f, 0.976866901f},
-std::array<float,2>{0.236706495f, 0.305815399f},
-std::array<float,2>{0.17513144f, 0.713304877f},
-std::array<float,2>{0.911682069f, 0.102812693f},
-std::array<float,2>{0.60777849f, 0.812476337f},
-std::array<float,2>{0.474166453f, 0.440515846f},
-std::array<float,2>{0.252744853f, 0.879096746f},
-std::array<float,2>{0.633167028f, 0.336298436f},
-std::array<float,2>{0.788574696f, 0.620221674f},
-std::array<float,2>{0.0817491263f, 0.173876569f},
-std::array<float,2>{0.206848696f, 0.966268003f},
-std::array<float,2>{0.967779398f, 0.261818945f},
-std::array<float,2>{0.528996706f, 0.509493172f},
-std::array<float,2>{0.427026957f, 0.200965255f},
-std::array<float,2>{0.358546853f, 0.649051249f},
-std::array<float,2>{0.713669181f, 0.00149677088f},
-std::array<float,2>{0.863557816f, 0.815063894f},
-std::array<float,2>{0.0235740319f, 0.38608861f},
-std::array<float,2>{0.113823086f, 0.566170156f},
-std::array<float,2>{0.777001262f, 0.154089689f},
-std::array<float,2>{0.676879644f, 0.911739469f},
-std::array<float,2>{0.281897336f, 0.344543606f},
-std::array<float,2>{0.450470775f, 0.776425064f},
-std::array<float,2>{0.576683581f, 0.478177339f},
-std::array<float,2>{0.904546857f, 0.727009654f},
-std::array<float,2>{0.134302273f, 0.0779786035f},
-std::array<float,2>{0.0686653703f, 0.930405438f},
-std::array<float,2>{0.805038989f, 0.372428656f},
-std::array<float,2>{0.643002868f, 0.58384198f},
-std::array<float,2>{0.279101551f, 0.140245244f},
-std::array<float,2>{0.496062487f, 0.737601995f},
-std::array<float,2>{0.623777568f, 0.0894358605f},
-std::array<float,2>{0.932930708f, 0.756243229f},
-std::array<float,2>{0.17033127f, 0.491229117f},
-std::array<float,2>{0.222872257f, 0.523344219f},
-std::array<float,2>{0.980325043f, 0.204847202f},
-std::array<float,2>{0.555741847f, 0.946305096f},
-std::array<float,2>{0.383723289f, 0.279295027f},
-std::array<float,2>{0.338414907f, 0.839049816f},
-std::array<float,2>{0.746689022f, 0.395505399f},
-std::array<float,2>{0.821007609f, 0.627325296f},
-std::array<float,2>{0.0483812317f, 0.0215771031f},
-std::array<float,2>{0.154631048f, 0.791198432f},
-std::array<float,2>{0.882619798f, 0.453815311f},
-std::array<float,2>{0.585292101f, 0.698924839f},
-std::array<float,2>{0.456026584f, 0.10947679f},
-std::array<float,2>{0.308082104f, 0.608582437f},
-std::array<float,2>{0.6717152f, 0.159586281f},
-std::array<float,2>{0.762171984f, 0.896128058f},
-std::array<float,2>{0.0990954489f, 0.316170782f},
-std::array<float,2>{0.00486327522f, 0.664820194f},
-std::array<float,2>{0.857417166f, 0.032936763f},
-std::array<float,2>{0.699873209f, 0.853512764f},
-std::array<float,2>{0.365896493f, 0.425544441f},
-std::array<float,2>{0.421088368f, 0.998081625f},
-std::array<float,2>{0.506660521f, 0.282218307f},
-std::array<float,2>{0.940145969f, 0.547507644f},
-std::array<float,2>{0.202641651f, 0.246316031f},
-std::array<float,2>{0.102646843f, 0.758295715f},
-std::array<float,2>{0.752682626f, 0.497818619f},
-std::array<float,2>{0.657291412f, 0.746782243f},
-std::array<float,2>{0.303010255f, 0.0835334957f},
-std::array<float,2>{0.467743218f, 0.59233129f},
-std::array<float,2>{0.588475645f, 0.12870571f},
-std::array<float,2>{0.889542699f, 0.925965548f},
-std::array<float,2>{0.143932596f, 0.360532045f},
-std::array<float,2>{0.192320943f, 0.635396779f},
-std::array<float,2>{0.95239687f, 0.0241840649f},
-std::array<float,2>{0.513244987f, 0.831250966f},
-std::array<float,2>{0.412929088f, 0.404932499f},
-std::array<float,2>{0.372329205f, 0.94284147f},
-std::array<float,2>{0.694146454f, 0.268623263f},
-std::array<float,2>{0.850103974f, 0.523476303f},
-std::array<float,2>{0.00959809311f, 0.214968294f},
-std::array<float,2>{0.161096856f, 0.901604295f},
-std::array<float,2>{0.923600435f, 0.320739746f},
-std::array<float,2>{0.610616446f, 0.601120293f},
-std::array<float,2>{0.489981949f, 0.167401657f},
-std::array<float,2>{0.266498685f, 0.687817752f},
-std::array<float,2>{0.650908947f, 0.124530375f},
-std::array<float,2>{0.799299598f, 0.783223867f},
-std::array<float,2>{0.0761909038f, 0.464479178f},
-std::array<float,2>{0.0579913817f, 0.561682105f},
-std::array<float,2>{0.814630032f, 0.237449557f},
-std::array<float,2>{0.735302567f, 0.987257659f},
-std::array<float,2>{0.335419297f, 0.291864216f},
-std::array<float,2>{0.381457329f, 0.848626316f},
-std::array<float,2>{0.548944831f, 0.430537075f},
-std::array<float,2>{0.971556842f, 0.659551859f},
-std::array<float,2>{0.231570378f, 0.0397362672f},
-std::array<float,2>{0.019793164f, 0.975115716f},
-std::array<float,2>{0.868614435f, 0.302755177f},
-std::array<float,2>{0.705874741f, 0.534764171f},
-std::array<float,2>{0.346557915f, 0.234099895f},
-std::array<float,2>{0.433415502f, 0.674073517f},
-std::array<float,2>{0.521990299f, 0.0565041937f},
-std::array<float,2>{0.956496716f, 0.868079364f},
-std::array<float,2>{0.2157868f, 0.413965404f},
-std::array<float,2>{0.12678732f, 0.612858415f},
-std::array<float,2>{0.895804048f, 0.180402815f},
-std::array<float,2>{0.567769289f, 0.883530259f},
-std::array<float,2>{0.441181064f, 0.333507955f},
-std::array<float,2>{0.296370775f, 0.797086895f},
-std::array<float,2>{0.685405672f, 0.450484246f},
-std::array<float,2>{0.76629746f, 0.708199799f},
-std::array<float,2>{0.123063385f, 0.100537166f},
-std::array<float,2>{0.243011087f, 0.823595762f},
-std::array<float,2>{0.993982255f, 0.379596144f},
-std::array<float,2>{0.531623185f, 0.6476475f},
-std::array<float,2>{0.403184921f, 0.0141231772f},
-std::array<float,2>{0.317264348f, 0.505514503f},
-std::array<float,2>{0.728212833f, 0.193455234f},
-std::array<float,2>{0.843468487f, 0.959960461f},
-std::array<float,2>{0.0466497988f, 0.253823459f},
-std::array<float,2>{0.0864894241f, 0.72156477f},
-std::array<float,2>{0.790114224f, 0.070032008f},
-std::array<float,2>{0.629636049f, 0.770835638f},
-std::array<float,2>{0.263300598f, 0.472542226f},
-std::array<float,2>{0.483791173f, 0.918789208f},
-std::array<float,2>{0.601008654f, 0.355561763f},
-std::array<float,2>{0.918141901f, 0.5717507f},
-std::array<float,2>{0.180142507f, 0.142176881f},
-std::array<float,2>{0.0657155812f, 0.871876061f},
-std::array<float,2>{0.810166776f, 0.407992125f},
-std::array<float,2>{0.644858181f, 0.679636717f},
-std::array<float,2>{0.275525957f, 0.0623800904f},
-std::array<float,2>{0.497424126f, 0.53795141f},
-std::array<float,2>{0.619582653f, 0.227544859f},
-std::array<float,2>{0.934572577f, 0.970691442f},
-std::array<float,2>{0.166983709f, 0.297082245f},
-std::array<float,2>{0.220811978f, 0.705915391f},
-std::array<float,2>{0.983968377f, 0.0964260548f},
-std::array<float,2>{0.559684575f, 0.801040471f},
-std::array<float,2>{0.389343411f, 0.449029267f},
-std::array<float,2>{0.342627704f, 0.887055635f},
-std::array<float,2>{0.7429775f, 0.331923515f},
-std::array<float,2>{0.826819599f, 0.614930689f},
-std::array<float,2>{0.0523024239f, 0.186682761f},
-std::array<float,2>{0.152279183f, 0.953982651f},
-std::array<float,2>{0.878169537f, 0.256133497f},
-std::array<float,2>{0.579517484f, 0.503278852f},
-std::array<float,2>{0.457225949f, 0.187598631f},
-std::array<float,2>{0.310671329f, 0.642916381f},
-std::array<float,2>{0.666643083f, 0.0078764623f},
-std::array<float,2>{0.761613071f, 0.825926244f},
-std::array<float,2>{0.0963504538f, 0.378380865f},
-std::array<float,2>{0.00284973811f, 0.577280641f},
-std::array<float,2>{0.853165627f, 0.1467897f},
-std::array<float,2>{0.697996795f, 0.914784074f},
-std::array<float,2>{0.359493256f, 0.352590144f},
-std::array<float,2>{0.414673954f, 0.765949547f},
-std::array<float,2>{0.503362298f, 0.476313323f},
-std::array<float,2>{0.942977369f, 0.72652179f},
-std::array<float,2>{0.195709214f, 0.0653661713f},
-std::array<float,2>{0.0317742005f, 0.924350977f},
-std::array<float,2>{0.835264504f, 0.363302469f},
-std::array<float,2>{0.723958194f, 0.586889267f},
-std::array<float,2>{0.32719025f, 0.130206689f},
-std::array<float,2>{0.395604491f, 0.744412184f},
-std::array<float,2>{0.541722894f, 0.0791457593f},
-std::array<float,2>{0.98663342f, 0.761999905f},
-std::array<float,2>{0.240638882f, 0.492304921f},
-std::array<float,2>{0.176193208f, 0.528908849f},
-std::array<float,2>{0.909906745f, 0.213741958f},
-std::array<float,2>{0.601878107f, 0.941320002f},
-std::array<float,2>{0.471122235f, 0.270789742f},
-std::array<float,2>{0.256259114f, 0.835040629f},
-std::array<float,2>{0.637865186f, 0.400707215f},
-std::array<float,2>{0.783753514f, 0.640273035f},
-std::array<float,2>{0.0829920024f, 0.0276389774f},
-std::array<float,2>{0.208048001f, 0.785699546f},
-std::array<float,2>{0.961975992f, 0.467383474f},
-std::array<float,2>{0.524273336f, 0.69342339f},
-std::array<float,2>{0.42481789f, 0.120168917f},
-std::array<float,2>{0.354120404f, 0.594507873f},
-std::array<float,2>{0.71584326f, 0.170414686f},
-std::array<float,2>{0.862616599f, 0.906197488f},
-std::array<float,2>{0.0290014353f, 0.325658113f},
-std::array<float,2>{0.110203877f, 0.661226392f},
-std::array<float,2>{0.781127155f, 0.0457948484f},
-std::array<float,2>{0.67448175f, 0.845255077f},
-std::array<float,2>{0.287600756f, 0.435333103f},
-std::array<float,2>{0.446298122f, 0.990225077f},
-std::array<float,2>{0.573840022f, 0.296627641f},
-std::array<float,2>{0.89949733f, 0.558519721f},
-std::array<float,2>{0.138345167f, 0.24137333f},
-std::array<float,2>{0.0160316769f, 0.752341747f},
-std::array<float,2>{0.873440683f, 0.486262828f},
-std::array<float,2>{0.709477723f, 0.738459885f},
-std::array<float,2>{0.348942578f, 0.0898748189f},
-std::array<float,2>{0.434037864f, 0.578648806f},
-std::array<float,2>{0.519229889f, 0.135180116f},
-std::array<float,2>{0.96089977f, 0.935438275f},
-std::array<float,2>{0.211703986f, 0.370074302f},
-std::array<float,2>{0.13078171f, 0.63183409f},
-std::array<float,2>{0.894444168f, 0.0193153974f},
-std::array<float,2>{0.564683735f, 0.843285322f},
-std::array<float,2>{0.441506058f, 0.393611461f},
-std::array<float,2>{0.28922531f, 0.950034559f},
-std::array<float,2>{0.681280851f, 0.276725382f},
-std::array<float,2>{0.770703435f, 0.516394913f},
-std::array<float,2>{0.120541342f, 0.209469303f},
-std::array<float,2>{0.24625735f, 0.892319739f},
-std::array<float,2>{0.996670425f, 0.317014337f},
-std::array<float,2>{0.53556025f, 0.604720235f},
-std::array<float,2>{0.399668545f, 0.163263246f},
-std::array<float,2>{0.312545002f, 0.702137887f},
-std::array<float,2>{0.732092679f, 0.114101082f},
-std::array<float,2>{0.836963475f, 0.795635223f},
-std::array<float,2>{0.0418158211f, 0.459031016f},
-std::array<float,2>{0.0915917233f, 0.552958131f},
-std::array<float,2>{0.794028044f, 0.243496612f},
-std::array<float,2>{0.625422418f, 0.993742883f},
-std::array<float,2>{0.259881407f, 0.288928926f},
-std::array<float,2>{0.480293721f, 0.857356071f},
-std::array<float,2>{0.596912324f, 0.427410245f},
-std::array<float,2>{0.916296661f, 0.668673158f},
-std::array<float,2>{0.184057444f, 0.0367343016f},
-std::array<float,2>{0.107201204f, 0.980880439f},
-std::array<float,2>{0.754032552f, 0.311916977f},
-std::array<float,2>{0.663406312f, 0.542041421f},
-std::array<float,2>{0.30052191f, 0.219311744f},
-std::array<float,2>{0.46133849f, 0.681488693f},
-std::array<float,2>{0.593030632f, 0.0511330776f},
-std::array<float,2>{0.883360863f, 0.861759722f},
-std::array<float,2>{0.144801483f, 0.416971296f},
-std::array<float,2>{0.189299256f, 0.622953415f},
-std::array<float,2>{0.947989047f, 0.178246915f},
-std::array<float,2>{0.509667039f, 0.877883077f},
-std::array<float,2>{0.409225076f, 0.342576176f},
-std::array<float,2>{0.369867295f, 0.805998504f},
-std::array<float,2>{0.690766573f, 0.442545414f},
-std::array<float,2>{0.844916046f, 0.717482924f},
-std::array<float,2>{0.0142796831f, 0.105748318f},
-std::array<float,2>{0.156625122f, 0.817994177f},
-std::array<float,2>{0.927673638f, 0.38902536f},
-std::array<float,2>{0.617132425f, 0.654739618f},
-std::array<float,2>{0.48607406f, 0.0068439953f},
-std::array<float,2>{0.270445853f, 0.514086366f},
-std::array<float,2>{0.655363083f, 0.197712839f},
-std::array<float,2>{0.804023504f, 0.961877167f},
-std::array<float,2>{0.0715270191f, 0.258372247f},
-std::array<float,2>{0.0620832779f, 0.730496824f},
-std::array<float,2>{0.816675305f, 0.0717723668f},
-std::array<float,2>{0.74102813f, 0.781060517f},
-std::array<float,2>{0.330850661f, 0.483633816f},
-std::array<float,2>{0.377579391f, 0.907841921f},
-std::array<float,2>{0.55424732f, 0.347825557f},
-std::array<float,2>{0.976508141f, 0.569723547f},
-std::array<float,2>{0.230303183f, 0.149566919f},
-std::array<float,2>{0.0469987579f, 0.837376416f},
-std::array<float,2>{0.821901798f, 0.396589547f},
-std::array<float,2>{0.747191668f, 0.626681149f},
-std::array<float,2>{0.339514792f, 0.0199756809f},
-std::array<float,2>{0.383978069f, 0.520395994f},
-std::array<float,2>{0.554847538f, 0.206253991f},
-std::array<float,2>{0.978651881f, 0.948781192f},
-std::array<float,2>{0.223939642f, 0.281170905f},
-std::array<float,2>{0.171354413f, 0.736117363f},
-std::array<float,2>{0.932503998f, 0.0872800648f},
-std::array<float,2>{0.624268174f, 0.754879475f},
-std::array<float,2>{0.494333208f, 0.489967674f},
-std::array<float,2>{0.278304249f, 0.931662083f},
-std::array<float,2>{0.644115865f, 0.374305069f},
-std::array<float,2>{0.805790424f, 0.585785151f},
-std::array<float,2>{0.0702576712f, 0.137984961f},
-std::array<float,2>{0.201277077f, 0.996465862f},
-std::array<float,2>{0.940764666f, 0.284071088f},
-std::array<float,2>{0.50756371f, 0.549857378f},
-std::array<float,2>{0.419988781f, 0.248616397f},
-std::array<float,2>{0.367053866f, 0.667096972f},
-std::array<float,2>{0.700970292f, 0.0347471125f},
-std::array<float,2>{0.855903447f, 0.85387665f},
-std::array<float,2>{0.00583974505f, 0.423607916f},
-std::array<float,2>{0.0979590192f, 0.606422424f},
-std::array<float,2>{0.763085663f, 0.157658711f},
-std::array<float,2>{0.670448065f, 0.897064209f},
-std::array<float,2>{0.307540983f, 0.312941194f},
-std::array<float,2>{0.456942737f, 0.789950848f},
-std::array<float,2>{0.584306538f, 0.456485212f},
-std::array<float,2>{0.880960941f, 0.695764482f},
-std::array<float,2>{0.156069785f, 0.11225643f},
-std::array<float,2>{0.0801658332f, 0.882634461f},
-std::array<float,2>{0.787955523f, 0.338936567f},
-std::array<float,2>{0.63443315f, 0.617302001f},
-std::array<float,2>{0.253375977f, 0.172848627f},
-std::array<float,2>{0.473144114f, 0.712449133f},
-std::array<float,2>{0.609326303f, 0.104004987f},
-std::array<float,2>{0.910294354f, 0.809109747f},
-std::array<float,2>{0.174424902f, 0.438840419f},
-std::array<float,2>{0.237732977f, 0.544289351f},
-std::array<float,2>{0.989651561f, 0.223053098f},
-std::array<float,2>{0.544418454f, 0.979419529f},
-std::array<float,2>{0.393185973f, 0.308544785f},
-std::array<float,2>{0.320788801f, 0.865020335f},
-std::array<float,2>{0.720554411f, 0.421429545f},
-std::array<float,2>{0.829952478f, 0.683784544f},
-std::array<float,2>{0.0374163724f, 0.0481446944f},
-std::array<float,2>{0.133312508f, 0.773839235f},
-std::array<float,2>{0.905444026f, 0.479032338f},
-std::array<float,2>{0.577728748f, 0.730356336f},
-std::array<float,2>{0.44966054f, 0.0747458711f},
-std::array<float,2>{0.282563061f, 0.563150525f},
-std::array<float,2>{0.676165283f, 0.155952424f},
-std::array<float,2>{0.775998294f, 0.912681878f},
-std::array<float,2>{0.114977747f, 0.345758557f},
-std::array<float,2>{0.0253107138f, 0.652233303f},
-std::array<float,2>{0.864554226f, 0.00388308917f},
-std::array<float,2>{0.714550853f, 0.81392163f},
-std::array<float,2>{0.357670635f, 0.384363383f},
-std::array<float,2>{0.425838709f, 0.967599094f},
-std::array<float,2>{0.527356625f, 0.263805449f},
-std::array<float,2>{0.967119455f, 0.509802938f},
-std::array<float,2>{0.205839187f, 0.202583298f},
-std::array<float,2>{0.124163903f, 0.799688697f},
-std::array<float,2>{0.767428637f, 0.451716661f},
-std::array<float,2>{0.68388927f, 0.710887372f},
-std::array<float,2>{0.295782685f, 0.0979272947f},
-std::array<float,2>{0.440344423f, 0.611277342f},
-std::array<float,2>{0.566649318f, 0.183143243f},
-std::array<float,2>{0.895434916f, 0.885181606f},
-std::array<float,2>{0.125521556f, 0.335048378f},
-std::array<float,2>{0.216288269f, 0.672464967f},
-std::array<float,2>{0.955847681f, 0.0576681457f},
-std::array<float,2>{0.522823393f, 0.86986506f},
-std::array<float,2>{0.432279199f, 0.410873294f},
-std::array<float,2>{0.347343177f, 0.973919034f},
-std::array<float,2>{0.706068873f, 0.302125514f},
-std::array<float,2>{0.867189646f, 0.531278491f},
-std::array<float,2>{0.0212090518f, 0.232257366f},
-std::array<float,2>{0.180780709f, 0.921045482f},
-std::array<float,2>{0.919648528f, 0.357657433f},
-std::array<float,2>{0.600184977f, 0.573011994f},
-std::array<float,2>{0.482533395f, 0.143443659f},
-std::array<float,2>{0.261772543f, 0.720313311f},
-std::array<float,2>{0.630769253f, 0.0675271079f},
-std::array<float,2>{0.790036976f, 0.773175538f},
-std::array<float,2>{0.087735042f, 0.469006091f},
-std::array<float,2>{0.0451069139f, 0.506694376f},
-std::array<float,2>{0.842722774f, 0.191983685f},
-std::array<float,2>{0.726816893f, 0.957339704f},
-std::array<float,2>{0.318340272f, 0.251116663f},
-std::array<float,2>{0.403387219f, 0.822077215f},
-std::array<float,2>{0.532949805f, 0.382690132f},
-std::array<float,2>{0.992711127f, 0.64574033f},
-std::array<float,2>{0.243326128f, 0.0131739769f},
-std::array<float,2>{0.0079963766f, 0.944579065f},
-std::array<float,2>{0.850819588f, 0.266779274f},
-std::array<float,2>{0.694689572f, 0.526929617f},
-std::array<float,2>{0.371511757f, 0.216823846f},
-std::array<float,2>{0.413695693f, 0.634298682f},
-std::array<float,2>{0.512374341f, 0.0266647972f},
-std::array<float,2>{0.9514184f, 0.828883111f},
-std::array<float,2>{0.19240725f, 0.403275073f},
-std::array<float,2>{0.142857492f, 0.590455174f},
-std::array<float,2>{0.890617013f, 0.125199467f},
-std::array<float,2>{0.589710474f, 0.928681552f},
-std::array<float,2>{0.468352795f, 0.362469643f},
-std::array<float,2>{0.304560632f, 0.761229157f},
-std::array<float,2>{0.656805933f, 0.499037713f},
-std::array<float,2>{0.753866613f, 0.749316692f},
-std::array<float,2>{0.102017529f, 0.0855320767f},
-std::array<float,2>{0.231401265f, 0.850257158f},
-std::array<float,2>{0.971868813f, 0.432811111f},
-std::array<float,2>{0.550080717f, 0.656398416f},
-std::array<float,2>{0.382480472f, 0.0429492332f},
-std::array<float,2>{0.334353626f, 0.559748352f},
-std::array<float,2>{0.736074924f, 0.234810978f},
-std::array<float,2>{0.815849721f, 0.985237062f},
-std::array<float,2>{0.0575385243f, 0.290153235f},
-std::array<float,2>{0.0775605813f, 0.69004941f},
-std::array<float,2>{0.799895763f, 0.122651145f},
-std::array<float,2>{0.651521087f, 0.783028126f},
-std::array<float,2>{0.267543733f, 0.461595565f},
-std::array<float,2>{0.4889763f, 0.898613036f},
-std::array<float,2>{0.609678864f, 0.323772401f},
-std::array<float,2>{0.921956897f, 0.598089933f},
-std::array<float,2>{0.161592305f, 0.164276555f},
-std::array<float,2>{0.0943895504f, 0.828060091f},
-std::array<float,2>{0.759466171f, 0.376699746f},
-std::array<float,2>{0.665919602f, 0.642416179f},
-std::array<float,2>{0.308669031f, 0.0110803926f},
-std::array<float,2>{0.459055364f, 0.500361264f},
-std::array<float,2>{0.580860078f, 0.190605298f},
-std::array<float,2>{0.876280785f, 0.956206203f},
-std::array<float,2>{0.149226964f, 0.254744738f},
-std::array<float,2>{0.197722241f, 0.722904325f},
-std::array<float,2>{0.943959773f, 0.064002037f},
-std::array<float,2>{0.501605153f, 0.769520164f},
-std::array<float,2>{0.416655093f, 0.473154992f},
-std::array<float,2>{0.36286214f, 0.917966187f},
-std::array<float,2>{0.69718504f, 0.354939371f},
-std::array<float,2>{0.85516876f, 0.575989187f},
-std::array<float,2>{0.000365958607f, 0.145096064f},
-std::array<float,2>{0.166009873f, 0.972270846f},
-std::array<float,2>{0.936914682f, 0.299849451f},
-std::array<float,2>{0.618987262f, 0.536528409f},
-std::array<float,2>{0.499080747f, 0.229691088f},
-std::array<float,2>{0.273834229f, 0.676286578f},
-std::array<float,2>{0.647331774f, 0.0586055256f},
-std::array<float,2>{0.811803818f, 0.874596596f},
-std::array<float,2>{0.0631312951f, 0.408976316f},
-std::array<float,2>{0.0527662337f, 0.616012037f},
-std::array<float,2>{0.824693561f, 0.183638394f},
-std::array<float,2>{0.745605648f, 0.888987899f},
-std::array<float,2>{0.341506451f, 0.328181297f},
-std::array<float,2>{0.387835234f, 0.803985178f},
-std::array<float,2>{0.561429381f, 0.447160453f},
-std::array<float,2>{0.981085837f, 0.703379571f},
-std::array<float,2>{0.219117269f, 0.0940466225f},
-std::array<float,2>{0.0294596329f, 0.903948247f},
-std::array<float,2>{0.860516489f, 0.326446921f},
-std::array<float,2>{0.717337608f, 0.596352279f},
-std::array<float,2>{0.351959735f, 0.169670105f},
-std::array<float,2>{0.422621757f, 0.692834198f},
-std::array<float,2>{0.527324319f, 0.117367648f},
-std::array<float,2>{0.963726878f, 0.787817657f},
-std::array<float,2>{0.208992615f, 0.465605259f},
-std::array<float,2>{0.140310913f, 0.555628538f},
-std::array<float,2>{0.901194513f, 0.239012465f},
-std::array<float,2>{0.571136415f, 0.990424931f},
-std::array<float,2>{0.447814494f, 0.294192493f},
-std::array<float,2>{0.286922038f, 0.847373724f},
-std::array<float,2>{0.672791839f, 0.437267631f},
-std::array<float,2>{0.778711855f, 0.664043248f},
-std::array<float,2>{0.111982942f, 0.0442821942f},
-std::array<float,2>{0.238681406f, 0.765316784f},
-std::array<float,2>{0.985021055f, 0.494883418f},
-std::array<float,2>{0.539080739f, 0.743517697f},
-std::array<float,2>{0.39770025f, 0.0804837942f},
-std::array<float,2>{0.32426542f, 0.588419557f},
-std::array<float,2>{0.725375414f, 0.13235119f},
-std::array<float,2>{0.83218509f, 0.923568666f},
-std::array<float,2>{0.0333438702f, 0.367039502f},
-std::array<float,2>{0.084855549f, 0.637153506f},
-std::array<float,2>{0.782485127f, 0.0305483248f},
-std::array<float,2>{0.63887614f, 0.833168566f},
-std::array<float,2>{0.255696923f, 0.400267243f},
-std::array<float,2>{0.469513923f, 0.939394891f},
-std::array<float,2>{0.604637086f, 0.272165745f},
-std::array<float,2>{0.907135963f, 0.529823005f},
-std::array<float,2>{0.178803548f, 0.212508172f},
-std::array<float,2>{0.0394384079f, 0.794748247f},
-std::array<float,2>{0.839112103f, 0.45712328f},
-std::array<float,2>{0.733612418f, 0.700887501f},
-std::array<float,2>{0.314605534f, 0.116775602f},
-std::array<float,2>{0.401501238f, 0.60318321f},
-std::array<float,2>{0.537122786f, 0.160609156f},
-std::array<float,2>{0.998317838f, 0.893578053f},
-std::array<float,2>{0.248148471f, 0.320012212f},
-std::array<float,2>{0.187210709f, 0.671233535f},
-std::array<float,2>{0.914425015f, 0.0375055782f},
-std::array<float,2>{0.594573855f, 0.857589722f},
-std::array<float,2>{0.477909863f, 0.429005146f},
-std::array<float,2>{0.258796066f, 0.994785547f},
-std::array<float,2>{0.627588153f, 0.286796004f},
-std::array<float,2>{0.796568096f, 0.552019715f},
-std::array<float,2>{0.0918597206f, 0.246072948f},
-std::array<float,2>{0.214494988f, 0.937075078f},
-std::array<float,2>{0.958223045f, 0.36860773f},
-std::array<float,2>{0.517059267f, 0.58148092f},
-std::array<float,2>{0.436832219f, 0.13290678f},
-std::array<float,2>{0.351372659f, 0.740770638f},
-std::array<float,2>{0.708075762f, 0.0923043713f},
-std::array<float,2>{0.872674882f, 0.750875294f},
-std::array<float,2>{0.0194142871f, 0.487722874f},
-std::array<float,2>{0.118407644f, 0.518872142f},
-std::array<float,2>{0.772982895f, 0.207980737f},
-std::array<float,2>{0.682275832f, 0.95264864f},
-std::array<float,2>{0.29211241f, 0.274626702f},
-std::array<float,2>{0.445166349f, 0.841439486f},
-std::array<float,2>{0.564025521f, 0.391078413f},
-std::array<float,2>{0.89210099f, 0.629235983f},
-std::array<float,2>{0.131988317f, 0.0162635688f},
-std::array<float,2>{0.0741827115f, 0.964172006f},
-std::array<float,2>{0.801187634f, 0.261586845f},
-std::array<float,2>{0.653754473f, 0.51240772f},
-std::array<float,2>{0.272974283f, 0.196594238f},
-std::array<float,2>{0.487810194f, 0.653744221f},
-std::array<float,2>{0.613678992f, 0.00391687592f},
-std::array<float,2>{0.928864539f, 0.819270313f},
-std::array<float,2>{0.158279777f, 0.386862278f},
-std::array<float,2>{0.227050245f, 0.567687929f},
-std::array<float,2>{0.973349988f, 0.152148187f},
-std::array<float,2>{0.5524351f, 0.908859789f},
-std::array<float,2>{0.376659691f, 0.349803954f},
-std::array<float,2>{0.329735935f, 0.777769208f},
-std::array<float,2>{0.739791751f, 0.481160283f},
-std::array<float,2>{0.818598092f, 0.733973086f},
-std::array<float,2>{0.0602546893f, 0.0732375234f},
-std::array<float,2>{0.14668119f, 0.860812247f},
-std::array<float,2>{0.885155022f, 0.4159711f},
-std::array<float,2>{0.590895593f, 0.682953596f},
-std::array<float,2>{0.463769078f, 0.0531775765f},
-std::array<float,2>{0.297180831f, 0.539590895f},
-std::array<float,2>{0.661218107f, 0.22142233f},
-std::array<float,2>{0.757151842f, 0.983119607f},
-std::array<float,2>{0.108501889f, 0.308761179f},
-std::array<float,2>{0.0119706849f, 0.716610968f},
-std::array<float,2>{0.846201837f, 0.107480586f},
-std::array<float,2>{0.688286066f, 0.808423638f},
-std::array<float,2>{0.36868602f, 0.444103301f},
-std::array<float,2>{0.407333732f, 0.875183642f},
-std::array<float,2>{0.511481583f, 0.341557503f},
-std::array<float,2>{0.946156502f, 0.623658657f},
-std::array<float,2>{0.190033525f, 0.177043527f},
-std::array<float,2>{0.00777915353f, 0.851718247f},
-std::array<float,2>{0.857881248f, 0.423935384f},
-std::array<float,2>{0.702167928f, 0.665533841f},
-std::array<float,2>{0.363367081f, 0.0319251157f},
-std::array<float,2>{0.418060362f, 0.548490345f},
-std::array<float,2>{0.505368352f, 0.247259274f},
-std::array<float,2>{0.938453496f, 0.999215424f},
-std::array<float,2>{0.19977963f, 0.282684773f},
-std::array<float,2>{0.153586105f, 0.697329104f},
-std::array<float,2>{0.880474389f, 0.111116685f},
-std::array<float,2>{0.582287133f, 0.792287171f},
-std::array<float,2>{0.453125447f, 0.454388499f},
-std::array<float,2>{0.305092871f, 0.895315409f},
-std::array<float,2>{0.669690192f, 0.314810753f},
-std::array<float,2>{0.764320791f, 0.607601106f},
-std::array<float,2>{0.100463793f, 0.158611923f},
-std::array<float,2>{0.224893972f, 0.945415258f},
-std::array<float,2>{0.977927804f, 0.277722389f},
-std::array<float,2>{0.557906985f, 0.52170825f},
-std::array<float,2>{0.385807604f, 0.2031409f},
-std::array<float,2>{0.33646366f, 0.628736079f},
-std::array<float,2>{0.748179376f, 0.0232076645f},
-std::array<float,2>{0.823308229f, 0.838348925f},
-std::array<float,2>{0.0507356375f, 0.395977974f},
-std::array<float,2>{0.0676660016f, 0.582520187f},
-std::array<float,2>{0.807226002f, 0.138827741f},
-std::array<float,2>{0.641624451f, 0.930794954f},
-std::array<float,2>{0.279787749f, 0.371476471f},
-std::array<float,2>{0.494132459f, 0.75758183f},
-std::array<float,2>{0.622485399f, 0.490423918f},
-std::array<float,2>{0.930176079f, 0.736768663f},
-std::array<float,2>{0.16899842f, 0.0887936205f},
-std::array<float,2>{0.115345582f, 0.910396338f},
-std::array<float,2>{0.773860812f, 0.344958246f},
-std::array<float,2>{0.678901374f, 0.565366983f},
-std::array<float,2>{0.283232361f, 0.153077453f},
-std::array<float,2>{0.451206177f, 0.72828877f},
-std::array<float,2>{0.575395346f, 0.0769032612f},
-std::array<float,2>{0.902475238f, 0.77543205f},
-std::array<float,2>{0.136448219f, 0.476596415f},
-std::array<float,2>{0.203618899f, 0.508512199f},
-std::array<float,2>{0.964969993f, 0.200111121f},
-std::array<float,2>{0.52948606f, 0.965819597f},
-std::array<float,2>{0.428509086f, 0.263136953f},
-std::array<float,2>{0.356167346f, 0.816176057f},
-std::array<float,2>{0.711565852f, 0.385551453f},
-std::array<float,2>{0.86698699f, 0.649532318f},
-std::array<float,2>{0.0270609017f, 0.000258199318f},
-std::array<float,2>{0.173768342f, 0.811253428f},
-std::array<float,2>{0.912577808f, 0.439863265f},
-std::array<float,2>{0.606128097f, 0.714464486f},
-std::array<float,2>{0.475571007f, 0.102503344f},
-std::array<float,2>{0.251490295f, 0.619195461f},
-std::array<float,2>{0.635778427f, 0.175527453f},
-std::array<float,2>{0.786416829f, 0.880317986f},
-std::array<float,2>{0.0791336447f, 0.337084472f},
-std::array<float,2>{0.0367679261f, 0.686304867f},
-std::array<float,2>{0.831133068f, 0.0500744954f},
-std::array<float,2>{0.720954418f, 0.866010606f},
-std::array<float,2>{0.323268592f, 0.419883102f},
-std::array<float,2>{0.391111642f, 0.977735341f},
-std::array<float,2>{0.545050979f, 0.305038989f},
-std::array<float,2>{0.991206348f, 0.546389878f},
-std::array<float,2>{0.234560952f, 0.226524681f},
-std::array<float,2>{0.0887790173f, 0.770108044f},
-std::array<float,2>{0.791182041f, 0.471355826f},
-std::array<float,2>{0.631435037f, 0.722490251f},
-std::array<float,2>{0.26556924f, 0.068629168f},
-std::array<float,2>{0.48186937f, 0.570636868f},
-std::array<float,2>{0.598470867f, 0.141478583f},
-std::array<float,2>{0.921013117f, 0.919720948f},
-std::array<float,2>{0.182489559f, 0.35671556f},
-std::array<float,2>{0.245196521f, 0.646522045f},
-std::array<float,2>{0.994605184f, 0.015263645f},
-std::array<float,2>{0.534266829f, 0.822833478f},
-std::array<float,2>{0.405746192f, 0.379983783f},
-std::array<float,2>{0.319870144f, 0.960276842f},
-std::array<float,2>{0.729864955f, 0.252465189f},
-std::array<float,2>{0.840367734f, 0.504013062f},
-std::array<float,2>{0.044707343f, 0.194605574f},
-std::array<float,2>{0.127213493f, 0.88441509f},
-std::array<float,2>{0.897961259f, 0.332849264f},
-std::array<float,2>{0.570148587f, 0.611724198f},
-std::array<float,2>{0.438969225f, 0.18102321f},
-std::array<float,2>{0.293645799f, 0.707802474f},
-std::array<float,2>{0.685723305f, 0.100895174f},
-std::array<float,2>{0.768359303f, 0.798301578f},
-std::array<float,2>{0.121858023f, 0.449800849f},
-std::array<float,2>{0.021704033f, 0.533407152f},
-std::array<float,2>{0.869420767f, 0.232781544f},
-std::array<float,2>{0.705015838f, 0.976019263f},
-std::array<float,2>{0.344267726f, 0.304310352f},
-std::array<float,2>{0.43088302f, 0.868543983f},
-std::array<float,2>{0.520397842f, 0.412798136f},
-std::array<float,2>{0.953634679f, 0.675015509f},
-std::array<float,2>{0.218704939f, 0.0551672019f},
-std::array<float,2>{0.0549853891f, 0.988077879f},
-std::array<float,2>{0.814337075f, 0.292741239f},
-std::array<float,2>{0.738094211f, 0.561410069f},
-std::array<float,2>{0.332642615f, 0.237239644f},
-std::array<float,2>{0.379328728f, 0.658610523f},
-std::array<float,2>{0.547861218f, 0.0403677486f},
-std::array<float,2>{0.969118476f, 0.848637879f},
-std::array<float,2>{0.233868346f, 0.431140065f},
-std::array<float,2>{0.162977114f, 0.600329578f},
-std::array<float,2>{0.924523652f, 0.166304812f},
-std::array<float,2>{0.61188674f, 0.900483191f},
-std::array<float,2>{0.490634441f, 0.322050244f},
-std::array<float,2>{0.268941075f, 0.785070777f},
-std::array<float,2>{0.649943829f, 0.463521451f},
-std::array<float,2>{0.798593283f, 0.688852906f},
-std::array<float,2>{0.0761418566f, 0.123745576f},
-std::array<float,2>{0.193563119f, 0.83054024f},
-std::array<float,2>{0.949482739f, 0.406110018f},
-std::array<float,2>{0.515370667f, 0.635750651f},
-std::array<float,2>{0.410567164f, 0.0253905002f},
-std::array<float,2>{0.374386787f, 0.524577558f},
-std::array<float,2>{0.692454457f, 0.216083989f},
-std::array<float,2>{0.848925948f, 0.941760063f},
-std::array<float,2>{0.0099539794f, 0.268316776f},
-std::array<float,2>{0.104639687f, 0.74741441f},
-std::array<float,2>{0.75003618f, 0.0826341808f},
-std::array<float,2>{0.658243895f, 0.758867502f},
-std::array<float,2>{0.300941199f, 0.496783555f},
-std::array<float,2>{0.465183556f, 0.927710712f},
-std::array<float,2>{0.586952507f, 0.359902114f},
-std::array<float,2>{0.888289869f, 0.593052387f},
-std::array<float,2>{0.140861467f, 0.127027065f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.887536407f, 0.257326871f},
-std::array<float,2>{0.027293358f, 0.665927708f},
-std::array<float,2>{0.389553457f, 0.185973033f},
-std::array<float,2>{0.721203029f, 0.842309177f},
-std::array<float,2>{0.608137131f, 0.00779206119f},
-std::array<float,2>{0.338124007f, 0.925494611f},
-std::array<float,2>{0.217766315f, 0.499936491f},
-std::array<float,2>{0.759302318f, 0.616196632f},
-std::array<float,2>{0.676895618f, 0.381337523f},
-std::array<float,2>{0.444823861f, 0.544698775f},
-std::array<float,2>{0.0778178498f, 0.102384321f},
-std::array<float,2>{0.958528638f, 0.995784044f},
-std::array<float,2>{0.847898364f, 0.204700425f},
-std::array<float,2>{0.12526153f, 0.810222507f},
-std::array<float,2>{0.308992147f, 0.374487191f},
-std::array<float,2>{0.554011583f, 0.696730971f},
-std::array<float,2>{0.78271234f, 0.466464162f},
-std::array<float,2>{0.220724165f, 0.578321695f},
-std::array<float,2>{0.370297611f, 0.061894726f},
-std::array<float,2>{0.572562695f, 0.895787358f},
-std::array<float,2>{0.712776184f, 0.153458372f},
-std::array<float,2>{0.407965213f, 0.857797325f},
-std::array<float,2>{0.0422595963f, 0.288144827f},
-std::array<float,2>{0.916396976f, 0.647816539f},
-std::array<float,2>{0.520620108f, 0.335063785f},
-std::array<float,2>{0.271948248f, 0.72187233f},
-std::array<float,2>{0.159947544f, 0.23638843f},
-std::array<float,2>{0.841186643f, 0.758558154f},
-std::array<float,2>{0.977511764f, 0.0928910896f},
-std::array<float,2>{0.106099881f, 0.943701148f},
-std::array<float,2>{0.485453397f, 0.43603605f},
-std::array<float,2>{0.636496246f, 0.5005759f},
-std::array<float,2>{0.945182085f, 0.414015025f},
-std::array<float,2>{0.0877592713f, 0.519960403f},
-std::array<float,2>{0.46658811f, 0.062944971f},
-std::array<float,2>{0.663241208f, 0.966279328f},
-std::array<float,2>{0.531516314f, 0.229126513f},
-std::array<float,2>{0.283372194f, 0.778764904f},
-std::array<float,2>{0.144583389f, 0.312819004f},
-std::array<float,2>{0.872379601f, 0.746873081f},
-std::array<float,2>{0.749168158f, 0.312126666f},
-std::array<float,2>{0.396761388f, 0.639937997f},
-std::array<float,2>{0.0150052616f, 0.137288824f},
-std::array<float,2>{0.892430663f, 0.871021092f},
-std::array<float,2>{0.768291116f, 0.0457835421f},
-std::array<float,2>{0.199003845f, 0.876171649f},
-std::array<float,2>{0.315263927f, 0.437511057f},
-std::array<float,2>{0.613860726f, 0.575121045f},
-std::array<float,2>{0.81643486f, 0.353963792f},
-std::array<float,2>{0.177285433f, 0.706586421f},
-std::array<float,2>{0.264150351f, 0.20245561f},
-std::array<float,2>{0.506861508f, 0.782233715f},
-std::array<float,2>{0.650043964f, 0.109432094f},
-std::array<float,2>{0.470259488f, 0.978400767f},
-std::array<float,2>{0.121927999f, 0.405790716f},
-std::array<float,2>{0.991973579f, 0.561630189f},
-std::array<float,2>{0.581214249f, 0.479216307f},
-std::array<float,2>{0.353722513f, 0.606835425f},
-std::array<float,2>{0.246059164f, 0.0279511679f},
-std::array<float,2>{0.807834029f, 0.913558304f},
-std::array<float,2>{0.933440447f, 0.166990429f},
-std::array<float,2>{0.0524739884f, 0.826132894f},
-std::array<float,2>{0.424940795f, 0.272790343f},
-std::array<float,2>{0.702726305f, 0.684847236f},
-std::array<float,2>{0.997251213f, 0.322380036f},
-std::array<float,2>{0.110222198f, 0.740806401f},
-std::array<float,2>{0.481370956f, 0.222912833f},
-std::array<float,2>{0.641145587f, 0.766790152f},
-std::array<float,2>{0.509526134f, 0.0762306228f},
-std::array<float,2>{0.253926754f, 0.956528425f},
-std::array<float,2>{0.186564118f, 0.414066762f},
-std::array<float,2>{0.823204935f, 0.524084508f},
-std::array<float,2>{0.69371897f, 0.448588401f},
-std::array<float,2>{0.43087247f, 0.569521308f},
-std::array<float,2>{0.0560520999f, 0.0389289185f},
-std::array<float,2>{0.927175939f, 0.888969958f},
-std::array<float,2>{0.800436497f, 0.130013019f},
-std::array<float,2>{0.236591801f, 0.861367881f},
-std::array<float,2>{0.351051956f, 0.302532911f},
-std::array<float,2>{0.591478884f, 0.62898612f},
-std::array<float,2>{0.862552881f, 0.391810745f},
-std::array<float,2>{0.153528288f, 0.553724527f},
-std::array<float,2>{0.289664507f, 0.122261904f},
-std::array<float,2>{0.543433845f, 0.975151181f},
-std::array<float,2>{0.665026784f, 0.195052788f},
-std::array<float,2>{0.460887134f, 0.791853309f},
-std::array<float,2>{0.084782511f, 0.344534516f},
-std::array<float,2>{0.948007047f, 0.714159846f},
-std::array<float,2>{0.619677067f, 0.274718702f},
-std::array<float,2>{0.326407462f, 0.672420323f},
-std::array<float,2>{0.191979006f, 0.164031491f},
-std::array<float,2>{0.778278291f, 0.813811064f},
-std::array<float,2>{0.905360103f, 0.0179034192f},
-std::array<float,2>{0.00733996835f, 0.920884609f},
-std::array<float,2>{0.402403623f, 0.47300145f},
-std::array<float,2>{0.734665871f, 0.596774876f},
-std::array<float,2>{0.907286048f, 0.491915852f},
-std::array<float,2>{0.0345633514f, 0.62457478f},
-std::array<float,2>{0.42009604f, 0.00906340685f},
-std::array<float,2>{0.706180274f, 0.936242878f},
-std::array<float,2>{0.563800991f, 0.178705737f},
-std::array<float,2>{0.361291617f, 0.833599031f},
-std::array<float,2>{0.231237069f, 0.260408789f},
-std::array<float,2>{0.791256011f, 0.660011828f},
-std::array<float,2>{0.631708026f, 0.361661196f},
-std::array<float,2>{0.493926138f, 0.689635038f},
-std::array<float,2>{0.0971205235f, 0.2184273f},
-std::array<float,2>{0.975958467f, 0.797934115f},
-std::array<float,2>{0.829205215f, 0.0979314819f},
-std::array<float,2>{0.166278571f, 0.988015711f},
-std::array<float,2>{0.27666977f, 0.389449716f},
-std::array<float,2>{0.526494861f, 0.535618544f},
-std::array<float,2>{0.755945802f, 0.296468258f},
-std::array<float,2>{0.206761673f, 0.649168372f},
-std::array<float,2>{0.328923434f, 0.14213784f},
-std::array<float,2>{0.599340796f, 0.84869051f},
-std::array<float,2>{0.729313254f, 0.0477355123f},
-std::array<float,2>{0.380243778f, 0.905517161f},
-std::array<float,2>{0.0193070658f, 0.459749162f},
-std::array<float,2>{0.879261434f, 0.591726661f},
-std::array<float,2>{0.556802511f, 0.427336007f},
-std::array<float,2>{0.297093213f, 0.514619708f},
-std::array<float,2>{0.134496629f, 0.0796084702f},
-std::array<float,2>{0.854466677f, 0.945422292f},
-std::array<float,2>{0.961253166f, 0.248416081f},
-std::array<float,2>{0.0687805414f, 0.753964424f},
-std::array<float,2>{0.45106867f, 0.340956777f},
-std::array<float,2>{0.687158704f, 0.727050602f},
-std::array<float,2>{0.955998182f, 0.299571782f},
-std::array<float,2>{0.0716600344f, 0.626118958f},
-std::array<float,2>{0.439729869f, 0.128745437f},
-std::array<float,2>{0.673203051f, 0.866572917f},
-std::array<float,2>{0.550671995f, 0.0339691043f},
-std::array<float,2>{0.307865292f, 0.884474993f},
-std::array<float,2>{0.130471528f, 0.452805847f},
-std::array<float,2>{0.845386565f, 0.565238655f},
-std::array<float,2>{0.724999607f, 0.419341803f},
-std::array<float,2>{0.386387378f, 0.52854383f},
-std::array<float,2>{0.0284903012f, 0.0730979964f},
-std::array<float,2>{0.886134326f, 0.960879087f},
-std::array<float,2>{0.762068033f, 0.220598564f},
-std::array<float,2>{0.211206526f, 0.771521449f},
-std::array<float,2>{0.341159493f, 0.325047672f},
-std::array<float,2>{0.603195786f, 0.73804605f},
-std::array<float,2>{0.839742303f, 0.470775515f},
-std::array<float,2>{0.161884978f, 0.597943902f},
-std::array<float,2>{0.269057274f, 0.0230738148f},
-std::array<float,2>{0.51864934f, 0.917316258f},
-std::array<float,2>{0.636733294f, 0.158499539f},
-std::array<float,2>{0.489021927f, 0.818333328f},
-std::array<float,2>{0.104803868f, 0.281234026f},
-std::array<float,2>{0.982273936f, 0.679322422f},
-std::array<float,2>{0.574812651f, 0.350290984f},
-std::array<float,2>{0.371211559f, 0.716116846f},
-std::array<float,2>{0.222848132f, 0.189311549f},
-std::array<float,2>{0.786278129f, 0.795249164f},
-std::array<float,2>{0.921225786f, 0.120071277f},
-std::array<float,2>{0.0439937524f, 0.971259713f},
-std::array<float,2>{0.413485885f, 0.395961106f},
-std::array<float,2>{0.716190219f, 0.548402846f},
-std::array<float,2>{0.896092057f, 0.386402667f},
-std::array<float,2>{0.00990528893f, 0.532470584f},
-std::array<float,2>{0.393524081f, 0.0970970392f},
-std::array<float,2>{0.743931949f, 0.992088556f},
-std::array<float,2>{0.610223532f, 0.21471931f},
-std::array<float,2>{0.319997549f, 0.803537071f},
-std::array<float,2>{0.200313613f, 0.365590096f},
-std::array<float,2>{0.770576119f, 0.695172608f},
-std::array<float,2>{0.6567204f, 0.264842361f},
-std::array<float,2>{0.464230031f, 0.661327302f},
-std::array<float,2>{0.093270801f, 0.17218183f},
-std::array<float,2>{0.938349187f, 0.82962656f},
-std::array<float,2>{0.869518697f, 0.0137063144f},
-std::array<float,2>{0.143464535f, 0.93227905f},
-std::array<float,2>{0.287861109f, 0.484544545f},
-std::array<float,2>{0.5375337f, 0.619094372f},
-std::array<float,2>{0.808921158f, 0.336000174f},
-std::array<float,2>{0.246182591f, 0.73054415f},
-std::array<float,2>{0.358902365f, 0.242684096f},
-std::array<float,2>{0.583274961f, 0.750067174f},
-std::array<float,2>{0.696736038f, 0.0847188756f},
-std::array<float,2>{0.426992893f, 0.952316403f},
-std::array<float,2>{0.0482219085f, 0.423620433f},
-std::array<float,2>{0.933730721f, 0.508136868f},
-std::array<float,2>{0.500356853f, 0.457022041f},
-std::array<float,2>{0.258831501f, 0.588136494f},
-std::array<float,2>{0.175583988f, 0.0508799814f},
-std::array<float,2>{0.813958406f, 0.902198315f},
-std::array<float,2>{0.986708164f, 0.147614166f},
-std::array<float,2>{0.119193085f, 0.845702648f},
-std::array<float,2>{0.472764194f, 0.292190284f},
-std::array<float,2>{0.655821919f, 0.652746797f},
-std::array<float,2>{0.923914433f, 0.367608488f},
-std::array<float,2>{0.0597342476f, 0.702517569f},
-std::array<float,2>{0.437394708f, 0.208486006f},
-std::array<float,2>{0.68966502f, 0.804931521f},
-std::array<float,2>{0.587507904f, 0.109047309f},
-std::array<float,2>{0.346717685f, 0.997606874f},
-std::array<float,2>{0.239786044f, 0.377391219f},
-std::array<float,2>{0.80281496f, 0.540056646f},
-std::array<float,2>{0.646057546f, 0.493422449f},
-std::array<float,2>{0.476585388f, 0.609928191f},
-std::array<float,2>{0.114392012f, 0.000475136621f},
-std::array<float,2>{0.994690835f, 0.927622914f},
-std::array<float,2>{0.826142251f, 0.179916188f},
-std::array<float,2>{0.179739878f, 0.837829292f},
-std::array<float,2>{0.251052976f, 0.252562195f},
-std::array<float,2>{0.515480459f, 0.670441806f},
-std::array<float,2>{0.773805201f, 0.429697216f},
-std::array<float,2>{0.189487904f, 0.505978465f},
-std::array<float,2>{0.323769033f, 0.0895954818f},
-std::array<float,2>{0.622349918f, 0.938328803f},
-std::array<float,2>{0.73891151f, 0.238300472f},
-std::array<float,2>{0.400027871f, 0.764276505f},
-std::array<float,2>{0.00158511696f, 0.329532653f},
-std::array<float,2>{0.900567949f, 0.724852145f},
-std::array<float,2>{0.539318919f, 0.28447634f},
-std::array<float,2>{0.294447392f, 0.642296135f},
-std::array<float,2>{0.150969386f, 0.148759753f},
-std::array<float,2>{0.863531888f, 0.853117406f},
-std::array<float,2>{0.952893019f, 0.0556999967f},
-std::array<float,2>{0.0804226249f, 0.891062081f},
-std::array<float,2>{0.453260094f, 0.464650661f},
-std::array<float,2>{0.671094179f, 0.585001528f},
-std::array<float,2>{0.970676005f, 0.444571406f},
-std::array<float,2>{0.0978528336f, 0.573059022f},
-std::array<float,2>{0.498336643f, 0.0426454619f},
-std::array<float,2>{0.625380695f, 0.882731676f},
-std::array<float,2>{0.528350592f, 0.135707766f},
-std::array<float,2>{0.279550761f, 0.872662723f},
-std::array<float,2>{0.170723155f, 0.306760609f},
-std::array<float,2>{0.832348764f, 0.636116266f},
-std::array<float,2>{0.710450351f, 0.317539752f},
-std::array<float,2>{0.417541295f, 0.742503285f},
-std::array<float,2>{0.0370649807f, 0.232179597f},
-std::array<float,2>{0.912437975f, 0.774107933f},
-std::array<float,2>{0.794095814f, 0.0688322783f},
-std::array<float,2>{0.226616621f, 0.964116931f},
-std::array<float,2>{0.363501906f, 0.406546324f},
-std::array<float,2>{0.566788077f, 0.518762887f},
-std::array<float,2>{0.858697355f, 0.268605739f},
-std::array<float,2>{0.138813138f, 0.683130503f},
-std::array<float,2>{0.300842673f, 0.170298174f},
-std::array<float,2>{0.558781862f, 0.823350191f},
-std::array<float,2>{0.682414353f, 0.0265843123f},
-std::array<float,2>{0.446637094f, 0.907418132f},
-std::array<float,2>{0.062559776f, 0.482374877f},
-std::array<float,2>{0.967456341f, 0.604515314f},
-std::array<float,2>{0.594522655f, 0.400265604f},
-std::array<float,2>{0.335793376f, 0.55742532f},
-std::array<float,2>{0.209554136f, 0.113593705f},
-std::array<float,2>{0.751684666f, 0.9827227f},
-std::array<float,2>{0.875075519f, 0.196732968f},
-std::array<float,2>{0.0221039075f, 0.785744369f},
-std::array<float,2>{0.375386506f, 0.358385116f},
-std::array<float,2>{0.731086791f, 0.710903645f},
-std::array<float,2>{0.915073335f, 0.285723895f},
-std::array<float,2>{0.0395614393f, 0.646088123f},
-std::array<float,2>{0.409848541f, 0.154863015f},
-std::array<float,2>{0.714751542f, 0.856458485f},
-std::array<float,2>{0.570811331f, 0.0604832806f},
-std::array<float,2>{0.368368953f, 0.896697104f},
-std::array<float,2>{0.220087364f, 0.467488557f},
-std::array<float,2>{0.783592403f, 0.581180871f},
-std::array<float,2>{0.634003103f, 0.433659643f},
-std::array<float,2>{0.486556798f, 0.502619147f},
-std::array<float,2>{0.108668074f, 0.0905470699f},
-std::array<float,2>{0.9795385f, 0.942905962f},
-std::array<float,2>{0.842477143f, 0.234602064f},
-std::array<float,2>{0.15711309f, 0.759910762f},
-std::array<float,2>{0.270264417f, 0.333592713f},
-std::array<float,2>{0.523151398f, 0.720263898f},
-std::array<float,2>{0.760259032f, 0.496984422f},
-std::array<float,2>{0.215862617f, 0.613525569f},
-std::array<float,2>{0.336633593f, 0.00453090807f},
-std::array<float,2>{0.605884314f, 0.922293663f},
-std::array<float,2>{0.71993655f, 0.18459855f},
-std::array<float,2>{0.387052238f, 0.841152489f},
-std::array<float,2>{0.024515355f, 0.2556099f},
-std::array<float,2>{0.889778256f, 0.66650182f},
-std::array<float,2>{0.551526904f, 0.371502906f},
-std::array<float,2>{0.311474919f, 0.697332084f},
-std::array<float,2>{0.127113357f, 0.206249431f},
-std::array<float,2>{0.849940598f, 0.81159389f},
-std::array<float,2>{0.960632384f, 0.105306663f},
-std::array<float,2>{0.076029785f, 0.994132698f},
-std::array<float,2>{0.442592114f, 0.380440921f},
-std::array<float,2>{0.678976238f, 0.546582103f},
-std::array<float,2>{0.989232183f, 0.403001845f},
-std::array<float,2>{0.124879263f, 0.558639944f},
-std::array<float,2>{0.472409606f, 0.112979263f},
-std::array<float,2>{0.651766598f, 0.979111254f},
-std::array<float,2>{0.505436599f, 0.200639397f},
-std::array<float,2>{0.262015343f, 0.784723461f},
-std::array<float,2>{0.178137869f, 0.352685034f},
-std::array<float,2>{0.818677783f, 0.70375663f},
-std::array<float,2>{0.700060964f, 0.270802587f},
-std::array<float,2>{0.423299462f, 0.687175274f},
-std::array<float,2>{0.0544946864f, 0.165485531f},
-std::array<float,2>{0.929709971f, 0.826317608f},
-std::array<float,2>{0.806516409f, 0.0300503336f},
-std::array<float,2>{0.24336727f, 0.911644399f},
-std::array<float,2>{0.351964444f, 0.47836861f},
-std::array<float,2>{0.579616308f, 0.608666778f},
-std::array<float,2>{0.874404311f, 0.314861745f},
-std::array<float,2>{0.148058191f, 0.748434126f},
-std::array<float,2>{0.282517046f, 0.226627916f},
-std::array<float,2>{0.533777714f, 0.780091166f},
-std::array<float,2>{0.661196053f, 0.0650378242f},
-std::array<float,2>{0.468375474f, 0.967127204f},
-std::array<float,2>{0.088189885f, 0.410975188f},
-std::array<float,2>{0.942399025f, 0.522310674f},
-std::array<float,2>{0.616265297f, 0.441221684f},
-std::array<float,2>{0.312818497f, 0.578085601f},
-std::array<float,2>{0.196493134f, 0.0445960276f},
-std::array<float,2>{0.766999125f, 0.877857029f},
-std::array<float,2>{0.894310951f, 0.140155688f},
-std::array<float,2>{0.0133544654f, 0.868932009f},
-std::array<float,2>{0.395633698f, 0.310352653f},
-std::array<float,2>{0.747643232f, 0.638140857f},
-std::array<float,2>{0.947135866f, 0.3464275f},
-std::array<float,2>{0.0833401605f, 0.711471856f},
-std::array<float,2>{0.458210349f, 0.192846313f},
-std::array<float,2>{0.667895317f, 0.790001988f},
-std::array<float,2>{0.54522264f, 0.124260657f},
-std::array<float,2>{0.291395515f, 0.973028064f},
-std::array<float,2>{0.156103924f, 0.393104434f},
-std::array<float,2>{0.859425306f, 0.550808787f},
-std::array<float,2>{0.736855686f, 0.475853682f},
-std::array<float,2>{0.405516893f, 0.594165921f},
-std::array<float,2>{0.00468342286f, 0.0160358027f},
-std::array<float,2>{0.902763367f, 0.918528318f},
-std::array<float,2>{0.780354619f, 0.16189155f},
-std::array<float,2>{0.194974095f, 0.814673066f},
-std::array<float,2>{0.324911386f, 0.276894867f},
-std::array<float,2>{0.618251264f, 0.675716758f},
-std::array<float,2>{0.821829438f, 0.416249514f},
-std::array<float,2>{0.183770001f, 0.525486052f},
-std::array<float,2>{0.257150531f, 0.076041013f},
-std::array<float,2>{0.511012375f, 0.954508603f},
-std::array<float,2>{0.643735468f, 0.224907801f},
-std::array<float,2>{0.483600348f, 0.768572807f},
-std::array<float,2>{0.112710468f, 0.320758462f},
-std::array<float,2>{0.998408139f, 0.738826632f},
-std::array<float,2>{0.593031645f, 0.303522199f},
-std::array<float,2>{0.348412067f, 0.632410526f},
-std::array<float,2>{0.235038996f, 0.132035494f},
-std::array<float,2>{0.798216879f, 0.861254573f},
-std::array<float,2>{0.928214967f, 0.0359235518f},
-std::array<float,2>{0.0584167428f, 0.888216376f},
-std::array<float,2>{0.432779044f, 0.446183741f},
-std::array<float,2>{0.692198694f, 0.566962361f},
-std::array<float,2>{0.882574081f, 0.457116485f},
-std::array<float,2>{0.0164503437f, 0.593509376f},
-std::array<float,2>{0.382030666f, 0.0497904979f},
-std::array<float,2>{0.728515089f, 0.903883398f},
-std::array<float,2>{0.599686086f, 0.142996594f},
-std::array<float,2>{0.33106482f, 0.851008892f},
-std::array<float,2>{0.204721525f, 0.293521285f},
-std::array<float,2>{0.754590571f, 0.651032209f},
-std::array<float,2>{0.683786988f, 0.342064947f},
-std::array<float,2>{0.45289591f, 0.729322076f},
-std::array<float,2>{0.0670122951f, 0.246173009f},
-std::array<float,2>{0.96340847f, 0.757067204f},
-std::array<float,2>{0.852715492f, 0.0819812864f},
-std::array<float,2>{0.135138422f, 0.948590636f},
-std::array<float,2>{0.300614178f, 0.429243773f},
-std::array<float,2>{0.555445194f, 0.513400316f},
-std::array<float,2>{0.790462494f, 0.257949591f},
-std::array<float,2>{0.23265253f, 0.657578409f},
-std::array<float,2>{0.361391395f, 0.177172437f},
-std::array<float,2>{0.565701723f, 0.834230542f},
-std::array<float,2>{0.704870999f, 0.0106945187f},
-std::array<float,2>{0.418208718f, 0.935206234f},
-std::array<float,2>{0.0324368104f, 0.488695115f},
-std::array<float,2>{0.908821881f, 0.622515261f},
-std::array<float,2>{0.524875402f, 0.387607753f},
-std::array<float,2>{0.274184853f, 0.537377238f},
-std::array<float,2>{0.164814517f, 0.100300662f},
-std::array<float,2>{0.830977023f, 0.985198796f},
-std::array<float,2>{0.974605083f, 0.215756446f},
-std::array<float,2>{0.0938095152f, 0.800152361f},
-std::array<float,2>{0.49531436f, 0.360929608f},
-std::array<float,2>{0.629909933f, 0.687779427f},
-std::array<float,2>{0.983649194f, 0.27862674f},
-std::array<float,2>{0.102393664f, 0.676550925f},
-std::array<float,2>{0.490734249f, 0.156948879f},
-std::array<float,2>{0.640126109f, 0.820126712f},
-std::array<float,2>{0.516146421f, 0.0209342688f},
-std::array<float,2>{0.267453253f, 0.91462177f},
-std::array<float,2>{0.162354872f, 0.470046878f},
-std::array<float,2>{0.836417735f, 0.600992799f},
-std::array<float,2>{0.718297243f, 0.396621823f},
-std::array<float,2>{0.410859525f, 0.550470293f},
-std::array<float,2>{0.0455263592f, 0.117723607f},
-std::array<float,2>{0.918780506f, 0.969797552f},
-std::array<float,2>{0.788478971f, 0.191278309f},
-std::array<float,2>{0.22472088f, 0.794581711f},
-std::array<float,2>{0.374890417f, 0.348260492f},
-std::array<float,2>{0.578061163f, 0.71786505f},
-std::array<float,2>{0.846077383f, 0.450615346f},
-std::array<float,2>{0.131375924f, 0.562805533f},
-std::array<float,2>{0.305714995f, 0.0312893242f},
-std::array<float,2>{0.548741937f, 0.884890497f},
-std::array<float,2>{0.675424933f, 0.126047492f},
-std::array<float,2>{0.439147025f, 0.864249229f},
-std::array<float,2>{0.0730028152f, 0.296967596f},
-std::array<float,2>{0.954998732f, 0.628125131f},
-std::array<float,2>{0.604711056f, 0.328026772f},
-std::array<float,2>{0.34255445f, 0.736228704f},
-std::array<float,2>{0.214613363f, 0.221034959f},
-std::array<float,2>{0.764205158f, 0.770819426f},
-std::array<float,2>{0.883776963f, 0.0705426112f},
-std::array<float,2>{0.0297578387f, 0.957929969f},
-std::array<float,2>{0.382933646f, 0.421048552f},
-std::array<float,2>{0.72439307f, 0.530091286f},
-std::array<float,2>{0.93561554f, 0.424872518f},
-std::array<float,2>{0.0499063507f, 0.511507332f},
-std::array<float,2>{0.4291704f, 0.0825134814f},
-std::array<float,2>{0.69810003f, 0.949881554f},
-std::array<float,2>{0.584061623f, 0.244861245f},
-std::array<float,2>{0.357399076f, 0.752958417f},
-std::array<float,2>{0.249351129f, 0.33794871f},
-std::array<float,2>{0.811041713f, 0.733043432f},
-std::array<float,2>{0.652697206f, 0.290632904f},
-std::array<float,2>{0.475486398f, 0.654534578f},
-std::array<float,2>{0.117634133f, 0.146243721f},
-std::array<float,2>{0.986206293f, 0.846004307f},
-std::array<float,2>{0.815989554f, 0.0535464846f},
-std::array<float,2>{0.172888279f, 0.89931947f},
-std::array<float,2>{0.259810507f, 0.455050617f},
-std::array<float,2>{0.502711654f, 0.586243451f},
-std::array<float,2>{0.773030758f, 0.363589674f},
-std::array<float,2>{0.202393368f, 0.692095101f},
-std::array<float,2>{0.317092746f, 0.211952627f},
-std::array<float,2>{0.613123059f, 0.801538229f},
-std::array<float,2>{0.745293379f, 0.094018653f},
-std::array<float,2>{0.391495526f, 0.989204466f},
-std::array<float,2>{0.00844934396f, 0.384399891f},
-std::array<float,2>{0.896545947f, 0.534081638f},
-std::array<float,2>{0.536613226f, 0.487890214f},
-std::array<float,2>{0.285887837f, 0.620398283f},
-std::array<float,2>{0.140836999f, 0.0120385345f},
-std::array<float,2>{0.867927074f, 0.930344105f},
-std::array<float,2>{0.939711928f, 0.175627202f},
-std::array<float,2>{0.0917618871f, 0.831635416f},
-std::array<float,2>{0.46249339f, 0.263420403f},
-std::array<float,2>{0.659849286f, 0.662861168f},
-std::array<float,2>{0.898516357f, 0.330312312f},
-std::array<float,2>{0.00356817921f, 0.723251998f},
-std::array<float,2>{0.402011126f, 0.24174957f},
-std::array<float,2>{0.740712106f, 0.762652218f},
-std::array<float,2>{0.624524057f, 0.0872451216f},
-std::array<float,2>{0.320993453f, 0.939570069f},
-std::array<float,2>{0.188714847f, 0.432001501f},
-std::array<float,2>{0.77606374f, 0.505678475f},
-std::array<float,2>{0.669387221f, 0.462360889f},
-std::array<float,2>{0.455943704f, 0.583131373f},
-std::array<float,2>{0.0791022778f, 0.0578994155f},
-std::array<float,2>{0.949365377f, 0.892956853f},
-std::array<float,2>{0.865636647f, 0.152074739f},
-std::array<float,2>{0.150271162f, 0.854971528f},
-std::array<float,2>{0.296640843f, 0.281515777f},
-std::array<float,2>{0.542885721f, 0.64302212f},
-std::array<float,2>{0.802540183f, 0.37646541f},
-std::array<float,2>{0.240989938f, 0.542501152f},
-std::array<float,2>{0.344408691f, 0.106153578f},
-std::array<float,2>{0.589594066f, 0.998407841f},
-std::array<float,2>{0.687905133f, 0.210371226f},
-std::array<float,2>{0.433824241f, 0.807791352f},
-std::array<float,2>{0.0616765283f, 0.369852275f},
-std::array<float,2>{0.922272325f, 0.700491905f},
-std::array<float,2>{0.512329817f, 0.251654059f},
-std::array<float,2>{0.252113372f, 0.668922424f},
-std::array<float,2>{0.18333663f, 0.182843506f},
-std::array<float,2>{0.827575505f, 0.8385548f},
-std::array<float,2>{0.992465734f, 0.00358577748f},
-std::array<float,2>{0.116174653f, 0.92855984f},
-std::array<float,2>{0.479196638f, 0.495631039f},
-std::array<float,2>{0.648310542f, 0.613241732f},
-std::array<float,2>{0.965715885f, 0.483931601f},
-std::array<float,2>{0.0645564124f, 0.602451921f},
-std::array<float,2>{0.447316021f, 0.0248521455f},
-std::array<float,2>{0.680698633f, 0.908409119f},
-std::array<float,2>{0.56062007f, 0.168927938f},
-std::array<float,2>{0.304622024f, 0.821200728f},
-std::array<float,2>{0.138515532f, 0.267311275f},
-std::array<float,2>{0.856501162f, 0.681522548f},
-std::array<float,2>{0.732697606f, 0.357193589f},
-std::array<float,2>{0.377283275f, 0.707079709f},
-std::array<float,2>{0.0196507107f, 0.199128762f},
-std::array<float,2>{0.877896249f, 0.788080573f},
-std::array<float,2>{0.753813684f, 0.115616776f},
-std::array<float,2>{0.207827792f, 0.981939852f},
-std::array<float,2>{0.333930463f, 0.400819719f},
-std::array<float,2>{0.595894635f, 0.55605334f},
-std::array<float,2>{0.835564375f, 0.305255979f},
-std::array<float,2>{0.168926254f, 0.633606613f},
-std::array<float,2>{0.278232425f, 0.132993862f},
-std::array<float,2>{0.530616641f, 0.873840094f},
-std::array<float,2>{0.627847254f, 0.0410024337f},
-std::array<float,2>{0.496175259f, 0.880640388f},
-std::array<float,2>{0.100049563f, 0.44161126f},
-std::array<float,2>{0.972541809f, 0.571869969f},
-std::array<float,2>{0.569992065f, 0.409310192f},
-std::array<float,2>{0.365608096f, 0.517185688f},
-std::array<float,2>{0.230440766f, 0.0668862537f},
-std::array<float,2>{0.795548022f, 0.962482512f},
-std::array<float,2>{0.910875559f, 0.233184054f},
-std::array<float,2>{0.0377320126f, 0.776212931f},
-std::array<float,2>{0.414540648f, 0.319676965f},
-std::array<float,2>{0.708831608f, 0.744689882f},
-std::array<float,2>{0.930729568f, 0.271638423f},
-std::array<float,2>{0.0529986992f, 0.683732271f},
-std::array<float,2>{0.422827393f, 0.167644143f},
-std::array<float,2>{0.701011479f, 0.82454735f},
-std::array<float,2>{0.578776002f, 0.028782852f},
-std::array<float,2>{0.353301138f, 0.912315249f},
-std::array<float,2>{0.242882401f, 0.480359763f},
-std::array<float,2>{0.804717481f, 0.605529428f},
-std::array<float,2>{0.650472045f, 0.405126661f},
-std::array<float,2>{0.471453696f, 0.560780168f},
-std::array<float,2>{0.12333405f, 0.111017309f},
-std::array<float,2>{0.989637077f, 0.977531731f},
-std::array<float,2>{0.819915235f, 0.202138454f},
-std::array<float,2>{0.178729936f, 0.782004774f},
-std::array<float,2>{0.263332397f, 0.354972094f},
-std::array<float,2>{0.504320621f, 0.705665529f},
-std::array<float,2>{0.766561329f, 0.438771635f},
-std::array<float,2>{0.195417792f, 0.575318992f},
-std::array<float,2>{0.314338893f, 0.0460307971f},
-std::array<float,2>{0.615887582f, 0.875034809f},
-std::array<float,2>{0.746963143f, 0.138154298f},
-std::array<float,2>{0.394698918f, 0.869929254f},
-std::array<float,2>{0.0120089864f, 0.311475307f},
-std::array<float,2>{0.892716885f, 0.638926744f},
-std::array<float,2>{0.534834504f, 0.314239085f},
-std::array<float,2>{0.282105833f, 0.747186303f},
-std::array<float,2>{0.146959588f, 0.229808271f},
-std::array<float,2>{0.873768091f, 0.777391732f},
-std::array<float,2>{0.941471338f, 0.064116843f},
-std::array<float,2>{0.0894409344f, 0.965390086f},
-std::array<float,2>{0.46745649f, 0.412385315f},
-std::array<float,2>{0.660575211f, 0.521135628f},
-std::array<float,2>{0.979432106f, 0.436989725f},
-std::array<float,2>{0.108292453f, 0.501843631f},
-std::array<float,2>{0.488128811f, 0.0919738114f},
-std::array<float,2>{0.63326484f, 0.945204258f},
-std::array<float,2>{0.522229552f, 0.238156483f},
-std::array<float,2>{0.270792872f, 0.759467125f},
-std::array<float,2>{0.158082977f, 0.33419472f},
-std::array<float,2>{0.843099236f, 0.721107543f},
-std::array<float,2>{0.713671386f, 0.287918866f},
-std::array<float,2>{0.408744693f, 0.647179484f},
-std::array<float,2>{0.0403642096f, 0.153196439f},
-std::array<float,2>{0.915004075f, 0.859156191f},
-std::array<float,2>{0.784655333f, 0.0614043698f},
-std::array<float,2>{0.219392568f, 0.895335436f},
-std::array<float,2>{0.367351711f, 0.465509981f},
-std::array<float,2>{0.571826279f, 0.579189599f},
-std::array<float,2>{0.851461828f, 0.373718351f},
-std::array<float,2>{0.128516749f, 0.695709944f},
-std::array<float,2>{0.311917424f, 0.203358531f},
-std::array<float,2>{0.551983774f, 0.808798015f},
-std::array<float,2>{0.678092182f, 0.103122264f},
-std::array<float,2>{0.442062199f, 0.994940519f},
-std::array<float,2>{0.0746613592f, 0.381913871f},
-std::array<float,2>{0.959011376f, 0.543227315f},
-std::array<float,2>{0.607416272f, 0.498572379f},
-std::array<float,2>{0.337502033f, 0.617150307f},
-std::array<float,2>{0.215590745f, 0.0068299491f},
-std::array<float,2>{0.76133734f, 0.924670517f},
-std::array<float,2>{0.889524817f, 0.187253222f},
-std::array<float,2>{0.0242057014f, 0.843107164f},
-std::array<float,2>{0.387710512f, 0.256735533f},
-std::array<float,2>{0.719031692f, 0.66414845f},
-std::array<float,2>{0.964659452f, 0.340804636f},
-std::array<float,2>{0.0681996644f, 0.727572143f},
-std::array<float,2>{0.451786131f, 0.249559522f},
-std::array<float,2>{0.684975207f, 0.755113959f},
-std::array<float,2>{0.556370437f, 0.0781763196f},
-std::array<float,2>{0.299230099f, 0.947147548f},
-std::array<float,2>{0.136553422f, 0.426343352f},
-std::array<float,2>{0.851760566f, 0.515574753f},
-std::array<float,2>{0.726806164f, 0.460552335f},
-std::array<float,2>{0.380947232f, 0.590456307f},
-std::array<float,2>{0.0169601161f, 0.0485315509f},
-std::array<float,2>{0.880877674f, 0.904969394f},
-std::array<float,2>{0.755320847f, 0.141544759f},
-std::array<float,2>{0.204071224f, 0.848624945f},
-std::array<float,2>{0.330533266f, 0.295001298f},
-std::array<float,2>{0.600910723f, 0.650290012f},
-std::array<float,2>{0.831564903f, 0.390235841f},
-std::array<float,2>{0.165860444f, 0.536812723f},
-std::array<float,2>{0.274610192f, 0.0987463593f},
-std::array<float,2>{0.523933291f, 0.9870978f},
-std::array<float,2>{0.629838586f, 0.21753642f},
-std::array<float,2>{0.494352907f, 0.797019482f},
-std::array<float,2>{0.0952060521f, 0.363155842f},
-std::array<float,2>{0.973303378f, 0.690757513f},
-std::array<float,2>{0.564548731f, 0.261108875f},
-std::array<float,2>{0.362657934f, 0.658289135f},
-std::array<float,2>{0.233406812f, 0.178918242f},
-std::array<float,2>{0.789405286f, 0.832598269f},
-std::array<float,2>{0.909211576f, 0.00862000696f},
-std::array<float,2>{0.0312979743f, 0.936647773f},
-std::array<float,2>{0.418991268f, 0.490520984f},
-std::array<float,2>{0.704071343f, 0.623831689f},
-std::array<float,2>{0.9038831f, 0.473941684f},
-std::array<float,2>{0.00550275715f, 0.596572816f},
-std::array<float,2>{0.404463172f, 0.0193855148f},
-std::array<float,2>{0.73732549f, 0.921459079f},
-std::array<float,2>{0.6178599f, 0.162855908f},
-std::array<float,2>{0.326103061f, 0.813355863f},
-std::array<float,2>{0.194001868f, 0.274102539f},
-std::array<float,2>{0.779927611f, 0.673807204f},
-std::array<float,2>{0.666446626f, 0.345003039f},
-std::array<float,2>{0.457183361f, 0.713535607f},
-std::array<float,2>{0.0825541764f, 0.193625212f},
-std::array<float,2>{0.945861757f, 0.792028546f},
-std::array<float,2>{0.860612094f, 0.121937059f},
-std::array<float,2>{0.154616743f, 0.975856423f},
-std::array<float,2>{0.292033345f, 0.391524792f},
-std::array<float,2>{0.546001315f, 0.553168356f},
-std::array<float,2>{0.797780633f, 0.301264256f},
-std::array<float,2>{0.236161053f, 0.630535781f},
-std::array<float,2>{0.349004626f, 0.129418194f},
-std::array<float,2>{0.592167854f, 0.862379074f},
-std::array<float,2>{0.692670405f, 0.0375481956f},
-std::array<float,2>{0.431864589f, 0.890194297f},
-std::array<float,2>{0.0572805703f, 0.447644264f},
-std::array<float,2>{0.928942382f, 0.569314361f},
-std::array<float,2>{0.510264933f, 0.415400296f},
-std::array<float,2>{0.256038547f, 0.524975419f},
-std::array<float,2>{0.184860602f, 0.0775150135f},
-std::array<float,2>{0.820464551f, 0.955171466f},
-std::array<float,2>{0.999562562f, 0.223893717f},
-std::array<float,2>{0.111417867f, 0.765653074f},
-std::array<float,2>{0.482923687f, 0.323712558f},
-std::array<float,2>{0.643281519f, 0.7419101f},
-std::array<float,2>{0.984505057f, 0.29117915f},
-std::array<float,2>{0.118925326f, 0.653542757f},
-std::array<float,2>{0.476321012f, 0.147044018f},
-std::array<float,2>{0.653398991f, 0.843940139f},
-std::array<float,2>{0.502993643f, 0.0526383445f},
-std::array<float,2>{0.261165202f, 0.901256382f},
-std::array<float,2>{0.17215243f, 0.45561716f},
-std::array<float,2>{0.815211713f, 0.589709342f},
-std::array<float,2>{0.699137449f, 0.422118276f},
-std::array<float,2>{0.427923143f, 0.509757042f},
-std::array<float,2>{0.0495057479f, 0.0851428434f},
-std::array<float,2>{0.936555743f, 0.951770782f},
-std::array<float,2>{0.811842501f, 0.243853688f},
-std::array<float,2>{0.248872563f, 0.751421094f},
-std::array<float,2>{0.356024653f, 0.337227255f},
-std::array<float,2>{0.585021257f, 0.731877923f},
-std::array<float,2>{0.868493736f, 0.485392392f},
-std::array<float,2>{0.142368272f, 0.617262423f},
-std::array<float,2>{0.28679952f, 0.015601946f},
-std::array<float,2>{0.535998702f, 0.933190644f},
-std::array<float,2>{0.659021854f, 0.172994792f},
-std::array<float,2>{0.461055517f, 0.828566849f},
-std::array<float,2>{0.0907741562f, 0.264156252f},
-std::array<float,2>{0.94077462f, 0.660728335f},
-std::array<float,2>{0.611988246f, 0.366372228f},
-std::array<float,2>{0.317792743f, 0.694110692f},
-std::array<float,2>{0.201829582f, 0.213558137f},
-std::array<float,2>{0.771817744f, 0.804430187f},
-std::array<float,2>{0.897976637f, 0.0963759199f},
-std::array<float,2>{0.00939751137f, 0.990482688f},
-std::array<float,2>{0.392377108f, 0.385371268f},
-std::array<float,2>{0.744538784f, 0.532090068f},
-std::array<float,2>{0.919411361f, 0.39491871f},
-std::array<float,2>{0.0459268503f, 0.547520876f},
-std::array<float,2>{0.411480963f, 0.120979428f},
-std::array<float,2>{0.717550874f, 0.972502291f},
-std::array<float,2>{0.576319158f, 0.188417077f},
-std::array<float,2>{0.373859316f, 0.796517432f},
-std::array<float,2>{0.225780949f, 0.351538897f},
-std::array<float,2>{0.787360787f, 0.715291023f},
-std::array<float,2>{0.638737977f, 0.279462188f},
-std::array<float,2>{0.492125958f, 0.678363621f},
-std::array<float,2>{0.102539502f, 0.159607455f},
-std::array<float,2>{0.982505858f, 0.816681445f},
-std::array<float,2>{0.837611794f, 0.0221566055f},
-std::array<float,2>{0.163367853f, 0.916779339f},
-std::array<float,2>{0.265697211f, 0.471869558f},
-std::array<float,2>{0.51690805f, 0.598898113f},
-std::array<float,2>{0.764894605f, 0.326087147f},
-std::array<float,2>{0.213026434f, 0.737204313f},
-std::array<float,2>{0.34359321f, 0.219490647f},
-std::array<float,2>{0.603648841f, 0.772966981f},
-std::array<float,2>{0.723114729f, 0.0733980015f},
-std::array<float,2>{0.384499937f, 0.959834754f},
-std::array<float,2>{0.0303334873f, 0.418653339f},
-std::array<float,2>{0.884210885f, 0.527647018f},
-std::array<float,2>{0.547803342f, 0.452062994f},
-std::array<float,2>{0.305542588f, 0.565610766f},
-std::array<float,2>{0.132386833f, 0.0345978253f},
-std::array<float,2>{0.8470366f, 0.883224487f},
-std::array<float,2>{0.953430772f, 0.127106577f},
-std::array<float,2>{0.0741066039f, 0.865771413f},
-std::array<float,2>{0.438073814f, 0.300198972f},
-std::array<float,2>{0.674300015f, 0.625421941f},
-std::array<float,2>{0.878151953f, 0.359036177f},
-std::array<float,2>{0.0208835565f, 0.70985949f},
-std::array<float,2>{0.378642887f, 0.195797995f},
-std::array<float,2>{0.733960271f, 0.786291301f},
-std::array<float,2>{0.597601116f, 0.114737429f},
-std::array<float,2>{0.332295269f, 0.98413682f},
-std::array<float,2>{0.208268389f, 0.399226516f},
-std::array<float,2>{0.752504647f, 0.558189213f},
-std::array<float,2>{0.680187821f, 0.48071143f},
-std::array<float,2>{0.448772252f, 0.604360104f},
-std::array<float,2>{0.0657842532f, 0.0254253857f},
-std::array<float,2>{0.966095746f, 0.906389952f},
-std::array<float,2>{0.856074452f, 0.171625629f},
-std::array<float,2>{0.137521729f, 0.823203802f},
-std::array<float,2>{0.303426981f, 0.268174797f},
-std::array<float,2>{0.562185585f, 0.681911409f},
-std::array<float,2>{0.796074569f, 0.407674551f},
-std::array<float,2>{0.228797883f, 0.518265426f},
-std::array<float,2>{0.366520971f, 0.0698649958f},
-std::array<float,2>{0.568431616f, 0.962901056f},
-std::array<float,2>{0.707043767f, 0.231018096f},
-std::array<float,2>{0.415872723f, 0.775111914f},
-std::array<float,2>{0.0382427759f, 0.316664457f},
-std::array<float,2>{0.911601007f, 0.743740916f},
-std::array<float,2>{0.530048907f, 0.307919204f},
-std::array<float,2>{0.27885884f, 0.635668755f},
-std::array<float,2>{0.169096008f, 0.136134878f},
-std::array<float,2>{0.834600151f, 0.871221066f},
-std::array<float,2>{0.971378148f, 0.0410792418f},
-std::array<float,2>{0.101330519f, 0.881624997f},
-std::array<float,2>{0.497971058f, 0.444204479f},
-std::array<float,2>{0.628801405f, 0.573384464f},
-std::array<float,2>{0.950405061f, 0.46377784f},
-std::array<float,2>{0.0790392682f, 0.584398568f},
-std::array<float,2>{0.456727296f, 0.054830689f},
-std::array<float,2>{0.668068469f, 0.891747057f},
-std::array<float,2>{0.541678309f, 0.150389984f},
-std::array<float,2>{0.2951729f, 0.852448702f},
-std::array<float,2>{0.149204597f, 0.283695161f},
-std::array<float,2>{0.86692363f, 0.640880346f},
-std::array<float,2>{0.741359055f, 0.329045981f},
-std::array<float,2>{0.40066582f, 0.72648108f},
-std::array<float,2>{0.00271998392f, 0.239533395f},
-std::array<float,2>{0.899508536f, 0.765402436f},
-std::array<float,2>{0.777309f, 0.0885041803f},
-std::array<float,2>{0.188004836f, 0.938956439f},
-std::array<float,2>{0.321933419f, 0.431560993f},
-std::array<float,2>{0.623136461f, 0.507117391f},
-std::array<float,2>{0.826625228f, 0.253200144f},
-std::array<float,2>{0.182267785f, 0.671593308f},
-std::array<float,2>{0.253536791f, 0.180902362f},
-std::array<float,2>{0.513503373f, 0.835990191f},
-std::array<float,2>{0.647216558f, 0.00142051303f},
-std::array<float,2>{0.480095029f, 0.926572859f},
-std::array<float,2>{0.116563492f, 0.493073791f},
-std::array<float,2>{0.993468523f, 0.61117965f},
-std::array<float,2>{0.588321805f, 0.378761441f},
-std::array<float,2>{0.345015943f, 0.539676368f},
-std::array<float,2>{0.241600841f, 0.107877716f},
-std::array<float,2>{0.801692486f, 0.996528327f},
-std::array<float,2>{0.923536122f, 0.20725286f},
-std::array<float,2>{0.0611193627f, 0.8059811f},
-std::array<float,2>{0.43508178f, 0.368757635f},
-std::array<float,2>{0.688690245f, 0.701345921f},
-std::array<float,2>{0.890720665f, 0.308825195f},
-std::array<float,2>{0.0139355315f, 0.637282848f},
-std::array<float,2>{0.397740185f, 0.139032081f},
-std::array<float,2>{0.74842602f, 0.867611229f},
-std::array<float,2>{0.614805937f, 0.0434195474f},
-std::array<float,2>{0.315782249f, 0.878531098f},
-std::array<float,2>{0.197599649f, 0.440288126f},
-std::array<float,2>{0.768979728f, 0.57639271f},
-std::array<float,2>{0.662215471f, 0.411728829f},
-std::array<float,2>{0.465788871f, 0.523297429f},
-std::array<float,2>{0.086711213f, 0.0660339743f},
-std::array<float,2>{0.943739295f, 0.968344927f},
-std::array<float,2>{0.871497273f, 0.227813095f},
-std::array<float,2>{0.146263614f, 0.780667186f},
-std::array<float,2>{0.284630418f, 0.315441966f},
-std::array<float,2>{0.533012509f, 0.749048889f},
-std::array<float,2>{0.8068313f, 0.477045774f},
-std::array<float,2>{0.244444653f, 0.607572675f},
-std::array<float,2>{0.354516f, 0.0307140835f},
-std::array<float,2>{0.580502689f, 0.910582244f},
-std::array<float,2>{0.701628029f, 0.164211556f},
-std::array<float,2>{0.424089819f, 0.82795763f},
-std::array<float,2>{0.0510145426f, 0.270430177f},
-std::array<float,2>{0.931888402f, 0.685923636f},
-std::array<float,2>{0.506123662f, 0.351726651f},
-std::array<float,2>{0.265615076f, 0.704944193f},
-std::array<float,2>{0.175913945f, 0.199985787f},
-std::array<float,2>{0.818012536f, 0.783682406f},
-std::array<float,2>{0.990454316f, 0.111918412f},
-std::array<float,2>{0.123016931f, 0.980144143f},
-std::array<float,2>{0.469621211f, 0.403579235f},
-std::array<float,2>{0.648468316f, 0.559819937f},
-std::array<float,2>{0.957385361f, 0.37943545f},
-std::array<float,2>{0.0769475475f, 0.545163751f},
-std::array<float,2>{0.444147348f, 0.104043916f},
-std::array<float,2>{0.676652014f, 0.992212415f},
-std::array<float,2>{0.553669453f, 0.206050813f},
-std::array<float,2>{0.310083538f, 0.810685873f},
-std::array<float,2>{0.12616089f, 0.372252524f},
-std::array<float,2>{0.84912014f, 0.698375583f},
-std::array<float,2>{0.72178936f, 0.254583329f},
-std::array<float,2>{0.390222311f, 0.667823195f},
-std::array<float,2>{0.0255218837f, 0.184230134f},
-std::array<float,2>{0.887916923f, 0.840371847f},
-std::array<float,2>{0.758416653f, 0.00497134635f},
-std::array<float,2>{0.218586028f, 0.923483789f},
-std::array<float,2>{0.339295894f, 0.497685879f},
-std::array<float,2>{0.608985126f, 0.614507198f},
-std::array<float,2>{0.840301335f, 0.332242578f},
-std::array<float,2>{0.159167305f, 0.719166279f},
-std::array<float,2>{0.272665054f, 0.236170813f},
-std::array<float,2>{0.520038545f, 0.760831594f},
-std::array<float,2>{0.635712862f, 0.091616638f},
-std::array<float,2>{0.484591097f, 0.941824675f},
-std::array<float,2>{0.106909275f, 0.435343683f},
-std::array<float,2>{0.978462458f, 0.503861904f},
-std::array<float,2>{0.574209929f, 0.468018442f},
-std::array<float,2>{0.369194418f, 0.580264151f},
-std::array<float,2>{0.22187902f, 0.059288688f},
-std::array<float,2>{0.781956613f, 0.897843778f},
-std::array<float,2>{0.917097986f, 0.155660599f},
-std::array<float,2>{0.0418684557f, 0.856179059f},
-std::array<float,2>{0.407094121f, 0.287077993f},
-std::array<float,2>{0.711402357f, 0.645051003f},
-std::array<float,2>{0.974675179f, 0.360242844f},
-std::array<float,2>{0.0962374806f, 0.689320564f},
-std::array<float,2>{0.492814392f, 0.215897694f},
-std::array<float,2>{0.63281095f, 0.79924655f},
-std::array<float,2>{0.5256868f, 0.10112828f},
-std::array<float,2>{0.276209325f, 0.985767722f},
-std::array<float,2>{0.167747334f, 0.388563156f},
-std::array<float,2>{0.829034925f, 0.538995624f},
-std::array<float,2>{0.705524087f, 0.489753455f},
-std::array<float,2>{0.421546757f, 0.621250808f},
-std::array<float,2>{0.0340894535f, 0.0114316801f},
-std::array<float,2>{0.907094598f, 0.933725893f},
-std::array<float,2>{0.792572737f, 0.176072344f},
-std::array<float,2>{0.231750652f, 0.835138202f},
-std::array<float,2>{0.359610438f, 0.258834541f},
-std::array<float,2>{0.562614441f, 0.657199204f},
-std::array<float,2>{0.855434358f, 0.427913398f},
-std::array<float,2>{0.13313143f, 0.511969388f},
-std::array<float,2>{0.298585832f, 0.0806336999f},
-std::array<float,2>{0.55790174f, 0.947373629f},
-std::array<float,2>{0.686452389f, 0.247431934f},
-std::array<float,2>{0.44962135f, 0.756479383f},
-std::array<float,2>{0.0696870461f, 0.343694985f},
-std::array<float,2>{0.962214887f, 0.730189085f},
-std::array<float,2>{0.59783709f, 0.294553459f},
-std::array<float,2>{0.329735279f, 0.651720405f},
-std::array<float,2>{0.205938712f, 0.144417509f},
-std::array<float,2>{0.757043719f, 0.849782646f},
-std::array<float,2>{0.87994653f, 0.0506173186f},
-std::array<float,2>{0.0179168154f, 0.903007627f},
-std::array<float,2>{0.379394501f, 0.458882421f},
-std::array<float,2>{0.730452657f, 0.592473209f},
-std::array<float,2>{0.9259547f, 0.446315318f},
-std::array<float,2>{0.0546955578f, 0.567421675f},
-std::array<float,2>{0.43013081f, 0.0367642716f},
-std::array<float,2>{0.694805682f, 0.887192369f},
-std::array<float,2>{0.590670645f, 0.131737709f},
-std::array<float,2>{0.350375891f, 0.860298574f},
-std::array<float,2>{0.238140389f, 0.304404587f},
-std::array<float,2>{0.799524546f, 0.631412745f},
-std::array<float,2>{0.641897202f, 0.322138965f},
-std::array<float,2>{0.482305706f, 0.739980996f},
-std::array<float,2>{0.110900462f, 0.22589609f},
-std::array<float,2>{0.996449113f, 0.767894566f},
-std::array<float,2>{0.823724329f, 0.0747222155f},
-std::array<float,2>{0.186433733f, 0.953600109f},
-std::array<float,2>{0.255319029f, 0.417891353f},
-std::array<float,2>{0.507956505f, 0.526657403f},
-std::array<float,2>{0.778931677f, 0.276331782f},
-std::array<float,2>{0.193062365f, 0.674482703f},
-std::array<float,2>{0.327976346f, 0.160314217f},
-std::array<float,2>{0.620646477f, 0.815959692f},
-std::array<float,2>{0.735910118f, 0.0168132298f},
-std::array<float,2>{0.403721839f, 0.919383526f},
-std::array<float,2>{0.00627796352f, 0.47520864f},
-std::array<float,2>{0.905118585f, 0.594789088f},
-std::array<float,2>{0.54406774f, 0.394102246f},
-std::array<float,2>{0.290837407f, 0.552196026f},
-std::array<float,2>{0.152945817f, 0.123448707f},
-std::array<float,2>{0.861666501f, 0.973682284f},
-std::array<float,2>{0.948975742f, 0.192114577f},
-std::array<float,2>{0.0852903351f, 0.790235877f},
-std::array<float,2>{0.459166825f, 0.347281277f},
-std::array<float,2>{0.665430963f, 0.712771297f},
-std::array<float,2>{0.938535631f, 0.262109309f},
-std::array<float,2>{0.0924888551f, 0.66372478f},
-std::array<float,2>{0.463362575f, 0.174640611f},
-std::array<float,2>{0.657259703f, 0.830965459f},
-std::array<float,2>{0.538960755f, 0.0133505538f},
-std::array<float,2>{0.2890459f, 0.93102628f},
-std::array<float,2>{0.144182682f, 0.48697558f},
-std::array<float,2>{0.87020576f, 0.619297802f},
-std::array<float,2>{0.743111551f, 0.383614421f},
-std::array<float,2>{0.394188374f, 0.535130382f},
-std::array<float,2>{0.0114303892f, 0.095097661f},
-std::array<float,2>{0.895307183f, 0.990043938f},
-std::array<float,2>{0.769786239f, 0.211204648f},
-std::array<float,2>{0.199829265f, 0.802510858f},
-std::array<float,2>{0.318745255f, 0.364804089f},
-std::array<float,2>{0.610523045f, 0.693170667f},
-std::array<float,2>{0.813310802f, 0.453284442f},
-std::array<float,2>{0.173939005f, 0.587361336f},
-std::array<float,2>{0.257985532f, 0.0543858632f},
-std::array<float,2>{0.501205623f, 0.89946264f},
-std::array<float,2>{0.654936075f, 0.144968346f},
-std::array<float,2>{0.473922253f, 0.846964002f},
-std::array<float,2>{0.120938793f, 0.289837718f},
-std::array<float,2>{0.987463057f, 0.655890226f},
-std::array<float,2>{0.582062602f, 0.339339286f},
-std::array<float,2>{0.357710928f, 0.733814061f},
-std::array<float,2>{0.247392744f, 0.245622143f},
-std::array<float,2>{0.810015976f, 0.752814174f},
-std::array<float,2>{0.934924364f, 0.0839718953f},
-std::array<float,2>{0.0470202677f, 0.950798333f},
-std::array<float,2>{0.426614374f, 0.424641162f},
-std::array<float,2>{0.695388317f, 0.51042527f},
-std::array<float,2>{0.884923041f, 0.420016825f},
-std::array<float,2>{0.0278926026f, 0.530855596f},
-std::array<float,2>{0.385047585f, 0.0716697946f},
-std::array<float,2>{0.725887597f, 0.958488643f},
-std::array<float,2>{0.602371097f, 0.222341672f},
-std::array<float,2>{0.340443701f, 0.769731879f},
-std::array<float,2>{0.212755099f, 0.326364726f},
-std::array<float,2>{0.763221145f, 0.735242486f},
-std::array<float,2>{0.672782481f, 0.297886461f},
-std::array<float,2>{0.440543592f, 0.627528846f},
-std::array<float,2>{0.0704054311f, 0.125966802f},
-std::array<float,2>{0.956433356f, 0.864523947f},
-std::array<float,2>{0.843988895f, 0.0328380652f},
-std::array<float,2>{0.129053131f, 0.886332273f},
-std::array<float,2>{0.307132632f, 0.449647993f},
-std::array<float,2>{0.549779296f, 0.564166844f},
-std::array<float,2>{0.785511196f, 0.348830491f},
-std::array<float,2>{0.224586859f, 0.717037976f},
-std::array<float,2>{0.37246272f, 0.190064833f},
-std::array<float,2>{0.575688064f, 0.793615639f},
-std::array<float,2>{0.714875162f, 0.118528441f},
-std::array<float,2>{0.412427783f, 0.969438732f},
-std::array<float,2>{0.043052271f, 0.397523284f},
-std::array<float,2>{0.920825183f, 0.549158096f},
-std::array<float,2>{0.518369794f, 0.469460517f},
-std::array<float,2>{0.268060952f, 0.599914849f},
-std::array<float,2>{0.160788983f, 0.0203778967f},
-std::array<float,2>{0.838771939f, 0.91527319f},
-std::array<float,2>{0.980531633f, 0.157556832f},
-std::array<float,2>{0.104267441f, 0.81877178f},
-std::array<float,2>{0.490172893f, 0.277866185f},
-std::array<float,2>{0.63863349f, 0.677025735f},
-std::array<float,2>{0.9131459f, 0.318479985f},
-std::array<float,2>{0.0361015387f, 0.745493293f},
-std::array<float,2>{0.416700333f, 0.234276369f},
-std::array<float,2>{0.709161043f, 0.776884258f},
-std::array<float,2>{0.56778115f, 0.0681255013f},
-std::array<float,2>{0.364601821f, 0.961749434f},
-std::array<float,2>{0.228272393f, 0.408647984f},
-std::array<float,2>{0.793751359f, 0.516385198f},
-std::array<float,2>{0.626585722f, 0.443205237f},
-std::array<float,2>{0.499572724f, 0.570674002f},
-std::array<float,2>{0.0987252817f, 0.0393070132f},
-std::array<float,2>{0.96890372f, 0.879869699f},
-std::array<float,2>{0.833748877f, 0.134596884f},
-std::array<float,2>{0.171477214f, 0.874950647f},
-std::array<float,2>{0.28055945f, 0.306117922f},
-std::array<float,2>{0.527368307f, 0.634129047f},
-std::array<float,2>{0.75047797f, 0.401877522f},
-std::array<float,2>{0.21061483f, 0.555074096f},
-std::array<float,2>{0.334569067f, 0.116777793f},
-std::array<float,2>{0.5954445f, 0.980534732f},
-std::array<float,2>{0.732238412f, 0.197872221f},
-std::array<float,2>{0.376856178f, 0.78882736f},
-std::array<float,2>{0.0231249928f, 0.355591327f},
-std::array<float,2>{0.87666899f, 0.708948255f},
-std::array<float,2>{0.560008645f, 0.266294092f},
-std::array<float,2>{0.302548438f, 0.680422306f},
-std::array<float,2>{0.140525043f, 0.168978766f},
-std::array<float,2>{0.857873917f, 0.821474433f},
-std::array<float,2>{0.967918277f, 0.0236879792f},
-std::array<float,2>{0.0642632172f, 0.91010654f},
-std::array<float,2>{0.44572556f, 0.483073801f},
-std::array<float,2>{0.682801366f, 0.602703094f},
-std::array<float,2>{0.99575448f, 0.494273871f},
-std::array<float,2>{0.113396831f, 0.6116696f},
-std::array<float,2>{0.477543175f, 0.00217371294f},
-std::array<float,2>{0.645273626f, 0.928824365f},
-std::array<float,2>{0.514187872f, 0.182496861f},
-std::array<float,2>{0.250437021f, 0.839220881f},
-std::array<float,2>{0.180749029f, 0.250702828f},
-std::array<float,2>{0.824928522f, 0.66977942f},
-std::array<float,2>{0.69110769f, 0.370972514f},
-std::array<float,2>{0.436387956f, 0.70012641f},
-std::array<float,2>{0.0590111837f, 0.209583685f},
-std::array<float,2>{0.925468802f, 0.807590544f},
-std::array<float,2>{0.804587483f, 0.107221544f},
-std::array<float,2>{0.238916039f, 0.999023795f},
-std::array<float,2>{0.346103311f, 0.375566453f},
-std::array<float,2>{0.586798906f, 0.541490316f},
-std::array<float,2>{0.864964068f, 0.282816619f},
-std::array<float,2>{0.151984096f, 0.644185543f},
-std::array<float,2>{0.292975664f, 0.150781706f},
-std::array<float,2>{0.54034853f, 0.854148567f},
-std::array<float,2>{0.670623124f, 0.0566578396f},
-std::array<float,2>{0.454668641f, 0.894512057f},
-std::array<float,2>{0.0814292282f, 0.46139425f},
-std::array<float,2>{0.951913655f, 0.582589149f},
-std::array<float,2>{0.621286154f, 0.433540136f},
-std::array<float,2>{0.32239002f, 0.504082859f},
-std::array<float,2>{0.191285849f, 0.086283274f},
-std::array<float,2>{0.775250673f, 0.940585911f},
-std::array<float,2>{0.901559055f, 0.240925431f},
-std::array<float,2>{0.000716026465f, 0.763654053f},
-std::array<float,2>{0.398958594f, 0.331276476f},
-std::array<float,2>{0.739744842f, 0.724148095f},
-std::array<float,2>{0.904509544f, 0.273654014f},
-std::array<float,2>{0.00647385558f, 0.672995627f},
-std::array<float,2>{0.404273272f, 0.162313849f},
-std::array<float,2>{0.735589981f, 0.812651694f},
-std::array<float,2>{0.620242834f, 0.0188055076f},
-std::array<float,2>{0.327560335f, 0.921285152f},
-std::array<float,2>{0.192747921f, 0.474364549f},
-std::array<float,2>{0.778598428f, 0.595980942f},
-std::array<float,2>{0.665708423f, 0.390658885f},
-std::array<float,2>{0.459569037f, 0.55333513f},
-std::array<float,2>{0.0855227634f, 0.121190339f},
-std::array<float,2>{0.948686242f, 0.976122618f},
-std::array<float,2>{0.862238288f, 0.194029659f},
-std::array<float,2>{0.152465656f, 0.792694986f},
-std::array<float,2>{0.290172547f, 0.345332235f},
-std::array<float,2>{0.544616699f, 0.713109195f},
-std::array<float,2>{0.799003363f, 0.448080838f},
-std::array<float,2>{0.237787306f, 0.568648994f},
-std::array<float,2>{0.349617064f, 0.0377694741f},
-std::array<float,2>{0.589997768f, 0.889741123f},
-std::array<float,2>{0.694829822f, 0.129289076f},
-std::array<float,2>{0.430336237f, 0.86282748f},
-std::array<float,2>{0.0552663691f, 0.301528394f},
-std::array<float,2>{0.926407635f, 0.63033098f},
-std::array<float,2>{0.50869453f, 0.32409361f},
-std::array<float,2>{0.255781025f, 0.741444349f},
-std::array<float,2>{0.185985163f, 0.224580944f},
-std::array<float,2>{0.824203253f, 0.766387403f},
-std::array<float,2>{0.996591508f, 0.0780949444f},
-std::array<float,2>{0.110642768f, 0.955778301f},
-std::array<float,2>{0.481861413f, 0.415681213f},
-std::array<float,2>{0.642278492f, 0.524840593f},
-std::array<float,2>{0.962649584f, 0.425816208f},
-std::array<float,2>{0.0702904463f, 0.515093923f},
-std::array<float,2>{0.449952304f, 0.0787825435f},
-std::array<float,2>{0.686019957f, 0.946392775f},
-std::array<float,2>{0.558221936f, 0.249232903f},
-std::array<float,2>{0.2981534f, 0.755441725f},
-std::array<float,2>{0.133785889f, 0.340266943f},
-std::array<float,2>{0.854570687f, 0.728085399f},
-std::array<float,2>{0.729958713f, 0.295759022f},
-std::array<float,2>{0.379789621f, 0.649661601f},
-std::array<float,2>{0.0184794143f, 0.140823513f},
-std::array<float,2>{0.880756915f, 0.847704589f},
-std::array<float,2>{0.757501483f, 0.0481779575f},
-std::array<float,2>{0.205352187f, 0.90454787f},
-std::array<float,2>{0.329582483f, 0.460270345f},
-std::array<float,2>{0.598549783f, 0.589883029f},
-std::array<float,2>{0.828217268f, 0.36242184f},
-std::array<float,2>{0.167338938f, 0.690950274f},
-std::array<float,2>{0.275639117f, 0.216898605f},
-std::array<float,2>{0.52611059f, 0.79744643f},
-std::array<float,2>{0.63221401f, 0.0991608277f},
-std::array<float,2>{0.492292613f, 0.98651439f},
-std::array<float,2>{0.0958964154f, 0.390057266f},
-std::array<float,2>{0.9754076f, 0.536300719f},
-std::array<float,2>{0.56346029f, 0.490982175f},
-std::array<float,2>{0.359892547f, 0.623443305f},
-std::array<float,2>{0.232272416f, 0.00796311814f},
-std::array<float,2>{0.792359352f, 0.93708694f},
-std::array<float,2>{0.906608582f, 0.179620072f},
-std::array<float,2>{0.0333989002f, 0.832469583f},
-std::array<float,2>{0.420981973f, 0.261411846f},
-std::array<float,2>{0.706027091f, 0.6589275f},
-std::array<float,2>{0.977786601f, 0.334496021f},
-std::array<float,2>{0.107119031f, 0.721343637f},
-std::array<float,2>{0.484916329f, 0.237581432f},
-std::array<float,2>{0.63522917f, 0.758970022f},
-std::array<float,2>{0.519668102f, 0.0926469937f},
-std::array<float,2>{0.273365408f, 0.944634616f},
-std::array<float,2>{0.158417687f, 0.437332422f},
-std::array<float,2>{0.840661049f, 0.501139879f},
-std::array<float,2>{0.711821795f, 0.465113401f},
-std::array<float,2>{0.40627259f, 0.579849243f},
-std::array<float,2>{0.0410731919f, 0.0609901659f},
-std::array<float,2>{0.917486548f, 0.894569159f},
-std::array<float,2>{0.781511486f, 0.15258801f},
-std::array<float,2>{0.222413838f, 0.858625829f},
-std::array<float,2>{0.369898349f, 0.287246078f},
-std::array<float,2>{0.573465526f, 0.646768451f},
-std::array<float,2>{0.849225104f, 0.382594407f},
-std::array<float,2>{0.126512095f, 0.543639123f},
-std::array<float,2>{0.309951216f, 0.102779225f},
-std::array<float,2>{0.552770436f, 0.994199276f},
-std::array<float,2>{0.675920844f, 0.203803971f},
-std::array<float,2>{0.443672687f, 0.80956018f},
-std::array<float,2>{0.0764256939f, 0.373277903f},
-std::array<float,2>{0.95757401f, 0.696168244f},
-std::array<float,2>{0.608546317f, 0.256294131f},
-std::array<float,2>{0.339616597f, 0.664725006f},
-std::array<float,2>{0.218010589f, 0.186718151f},
-std::array<float,2>{0.758282542f, 0.843715847f},
-std::array<float,2>{0.88835609f, 0.00624385057f},
-std::array<float,2>{0.0258934721f, 0.924283564f},
-std::array<float,2>{0.389691681f, 0.498244852f},
-std::array<float,2>{0.722182989f, 0.616273463f},
-std::array<float,2>{0.932614684f, 0.479759127f},
-std::array<float,2>{0.0516275577f, 0.606260002f},
-std::array<float,2>{0.424543381f, 0.0292879622f},
-std::array<float,2>{0.701719105f, 0.912660062f},
-std::array<float,2>{0.58091408f, 0.167163745f},
-std::array<float,2>{0.35505271f, 0.82494396f},
-std::array<float,2>{0.244808286f, 0.272382587f},
-std::array<float,2>{0.807468772f, 0.684227049f},
-std::array<float,2>{0.649123609f, 0.355408311f},
-std::array<float,2>{0.468798488f, 0.705520689f},
-std::array<float,2>{0.122206829f, 0.201415464f},
-std::array<float,2>{0.990927279f, 0.781697929f},
-std::array<float,2>{0.817683816f, 0.110550553f},
-std::array<float,2>{0.176723376f, 0.976891935f},
-std::array<float,2>{0.264814109f, 0.404300094f},
-std::array<float,2>{0.506752729f, 0.561289012f},
-std::array<float,2>{0.769088686f, 0.31080389f},
-std::array<float,2>{0.198174849f, 0.639364898f},
-std::array<float,2>{0.316290736f, 0.138639107f},
-std::array<float,2>{0.614566386f, 0.869152665f},
-std::array<float,2>{0.74889487f, 0.0465290658f},
-std::array<float,2>{0.39823994f, 0.875718415f},
-std::array<float,2>{0.0143302642f, 0.43902877f},
-std::array<float,2>{0.891256928f, 0.575985134f},
-std::array<float,2>{0.532468796f, 0.412688315f},
-std::array<float,2>{0.284734696f, 0.520792484f},
-std::array<float,2>{0.145508692f, 0.0637294129f},
-std::array<float,2>{0.871763647f, 0.965250671f},
-std::array<float,2>{0.943958342f, 0.23036778f},
-std::array<float,2>{0.0860794038f, 0.778220713f},
-std::array<float,2>{0.465207607f, 0.313524425f},
-std::array<float,2>{0.662844598f, 0.748026907f},
-std::array<float,2>{0.951190889f, 0.2834768f},
-std::array<float,2>{0.0819465816f, 0.6415658f},
-std::array<float,2>{0.454221517f, 0.149756715f},
-std::array<float,2>{0.670064211f, 0.851748526f},
-std::array<float,2>{0.541005254f, 0.0556102581f},
-std::array<float,2>{0.293730795f, 0.892397523f},
-std::array<float,2>{0.151486397f, 0.462948084f},
-std::array<float,2>{0.864320159f, 0.584879518f},
-std::array<float,2>{0.739752173f, 0.430935413f},
-std::array<float,2>{0.398761123f, 0.507540822f},
-std::array<float,2>{6.25675093e-05f, 0.0881945342f},
-std::array<float,2>{0.901901245f, 0.93932426f},
-std::array<float,2>{0.774610579f, 0.240074083f},
-std::array<float,2>{0.190473467f, 0.76485002f},
-std::array<float,2>{0.322848111f, 0.328281879f},
-std::array<float,2>{0.621740758f, 0.725956559f},
-std::array<float,2>{0.824562371f, 0.492499173f},
-std::array<float,2>{0.181620106f, 0.610632122f},
-std::array<float,2>{0.25077647f, 0.00185376522f},
-std::array<float,2>{0.513828754f, 0.926139951f},
-std::array<float,2>{0.644823015f, 0.181297287f},
-std::array<float,2>{0.478421926f, 0.836432993f},
-std::array<float,2>{0.114092693f, 0.253497213f},
-std::array<float,2>{0.995485365f, 0.671381116f},
-std::array<float,2>{0.586013913f, 0.368469566f},
-std::array<float,2>{0.346544653f, 0.70171082f},
-std::array<float,2>{0.238687709f, 0.208005831f},
-std::array<float,2>{0.80410099f, 0.806539059f},
-std::array<float,2>{0.924938977f, 0.10816142f},
-std::array<float,2>{0.059521392f, 0.996615648f},
-std::array<float,2>{0.435910314f, 0.378006697f},
-std::array<float,2>{0.690677464f, 0.539140582f},
-std::array<float,2>{0.876324832f, 0.398547143f},
-std::array<float,2>{0.0225842874f, 0.55771029f},
-std::array<float,2>{0.376014501f, 0.115154758f},
-std::array<float,2>{0.731714785f, 0.983854711f},
-std::array<float,2>{0.595104873f, 0.195930555f},
-std::array<float,2>{0.334420085f, 0.786865115f},
-std::array<float,2>{0.210210487f, 0.35850355f},
-std::array<float,2>{0.750555038f, 0.709234893f},
-std::array<float,2>{0.68357414f, 0.267888039f},
-std::array<float,2>{0.446157634f, 0.682211459f},
-std::array<float,2>{0.063691102f, 0.171336025f},
-std::array<float,2>{0.96866709f, 0.822292328f},
-std::array<float,2>{0.858180761f, 0.0260241833f},
-std::array<float,2>{0.140080824f, 0.907019913f},
-std::array<float,2>{0.302013814f, 0.481311113f},
-std::array<float,2>{0.560332477f, 0.603987098f},
-std::array<float,2>{0.793089032f, 0.317040741f},
-std::array<float,2>{0.227692127f, 0.743478954f},
-std::array<float,2>{0.364878654f, 0.230661079f},
-std::array<float,2>{0.568041921f, 0.774760127f},
-std::array<float,2>{0.709795117f, 0.069806844f},
-std::array<float,2>{0.416445166f, 0.96341908f},
-std::array<float,2>{0.0356020704f, 0.408031136f},
-std::array<float,2>{0.913956344f, 0.517697394f},
-std::array<float,2>{0.52797246f, 0.443675607f},
-std::array<float,2>{0.281151086f, 0.57397604f},
-std::array<float,2>{0.171294183f, 0.0417632349f},
-std::array<float,2>{0.833211541f, 0.881001711f},
-std::array<float,2>{0.969680727f, 0.136664897f},
-std::array<float,2>{0.0995208099f, 0.871749043f},
-std::array<float,2>{0.499388963f, 0.308523566f},
-std::array<float,2>{0.626464367f, 0.634963214f},
-std::array<float,2>{0.9203462f, 0.350731999f},
-std::array<float,2>{0.0436489806f, 0.715761125f},
-std::array<float,2>{0.412630945f, 0.187558234f},
-std::array<float,2>{0.715593755f, 0.796060443f},
-std::array<float,2>{0.575534821f, 0.120477095f},
-std::array<float,2>{0.372634202f, 0.971722126f},
-std::array<float,2>{0.223717615f, 0.395137429f},
-std::array<float,2>{0.786113799f, 0.547180712f},
-std::array<float,2>{0.638112903f, 0.472394854f},
-std::array<float,2>{0.489528954f, 0.599512696f},
-std::array<float,2>{0.103926182f, 0.0218070038f},
-std::array<float,2>{0.981214285f, 0.916074455f},
-std::array<float,2>{0.838054001f, 0.15967384f},
-std::array<float,2>{0.160486773f, 0.817336261f},
-std::array<float,2>{0.268134862f, 0.279884249f},
-std::array<float,2>{0.517742932f, 0.678164959f},
-std::array<float,2>{0.763144374f, 0.41810599f},
-std::array<float,2>{0.212309286f, 0.528083742f},
-std::array<float,2>{0.340029985f, 0.0740557387f},
-std::array<float,2>{0.601667941f, 0.959293127f},
-std::array<float,2>{0.726342201f, 0.21907194f},
-std::array<float,2>{0.385315835f, 0.772825718f},
-std::array<float,2>{0.0278151222f, 0.325465649f},
-std::array<float,2>{0.885498166f, 0.736459613f},
-std::array<float,2>{0.549221873f, 0.300349951f},
-std::array<float,2>{0.307025909f, 0.625823438f},
-std::array<float,2>{0.129667088f, 0.127899945f},
-std::array<float,2>{0.844608366f, 0.86558497f},
-std::array<float,2>{0.95688504f, 0.0351091735f},
-std::array<float,2>{0.07108365f, 0.883573771f},
-std::array<float,2>{0.441184282f, 0.451555848f},
-std::array<float,2>{0.672169507f, 0.566257596f},
-std::array<float,2>{0.987903297f, 0.455258995f},
-std::array<float,2>{0.120381318f, 0.589308798f},
-std::array<float,2>{0.474435061f, 0.0520606525f},
-std::array<float,2>{0.654300034f, 0.900859952f},
-std::array<float,2>{0.501516759f, 0.146524534f},
-std::array<float,2>{0.258609027f, 0.844670713f},
-std::array<float,2>{0.174499065f, 0.291864008f},
-std::array<float,2>{0.812772751f, 0.654023528f},
-std::array<float,2>{0.696241736f, 0.337492645f},
-std::array<float,2>{0.426079929f, 0.732170343f},
-std::array<float,2>{0.0475572124f, 0.243399024f},
-std::array<float,2>{0.935486794f, 0.7516644f},
-std::array<float,2>{0.810434163f, 0.0857269019f},
-std::array<float,2>{0.247916713f, 0.95158273f},
-std::array<float,2>{0.357942641f, 0.422485352f},
-std::array<float,2>{0.582849443f, 0.50904429f},
-std::array<float,2>{0.870928347f, 0.264533788f},
-std::array<float,2>{0.143890962f, 0.660508394f},
-std::array<float,2>{0.288131028f, 0.173430875f},
-std::array<float,2>{0.538094342f, 0.828989506f},
-std::array<float,2>{0.657829881f, 0.0149774505f},
-std::array<float,2>{0.463639408f, 0.933001518f},
-std::array<float,2>{0.0922368914f, 0.485864222f},
-std::array<float,2>{0.939363956f, 0.617806792f},
-std::array<float,2>{0.611250997f, 0.384864122f},
-std::array<float,2>{0.319177806f, 0.531681359f},
-std::array<float,2>{0.199599296f, 0.0961108506f},
-std::array<float,2>{0.770043135f, 0.990763664f},
-std::array<float,2>{0.894572318f, 0.213130474f},
-std::array<float,2>{0.0110578304f, 0.803890705f},
-std::array<float,2>{0.393687546f, 0.367137879f},
-std::array<float,2>{0.74251014f, 0.693595409f},
-std::array<float,2>{0.929473579f, 0.303946733f},
-std::array<float,2>{0.0566638932f, 0.63133198f},
-std::array<float,2>{0.432231247f, 0.13116847f},
-std::array<float,2>{0.692959845f, 0.859743476f},
-std::array<float,2>{0.592674971f, 0.0362437032f},
-std::array<float,2>{0.349293053f, 0.887545943f},
-std::array<float,2>{0.235574767f, 0.44700858f},
-std::array<float,2>{0.797112346f, 0.568003654f},
-std::array<float,2>{0.642646432f, 0.41705209f},
-std::array<float,2>{0.482790112f, 0.527180672f},
-std::array<float,2>{0.111972138f, 0.0743913502f},
-std::array<float,2>{0.999489188f, 0.95399487f},
-std::array<float,2>{0.820998371f, 0.226510897f},
-std::array<float,2>{0.185418472f, 0.768354714f},
-std::array<float,2>{0.256718993f, 0.321446329f},
-std::array<float,2>{0.509800196f, 0.739662409f},
-std::array<float,2>{0.779366136f, 0.474660307f},
-std::array<float,2>{0.193787873f, 0.595313251f},
-std::array<float,2>{0.325581998f, 0.0173801016f},
-std::array<float,2>{0.617445886f, 0.919549823f},
-std::array<float,2>{0.737811446f, 0.160646811f},
-std::array<float,2>{0.405145079f, 0.815876901f},
-std::array<float,2>{0.00488790963f, 0.275647491f},
-std::array<float,2>{0.903484821f, 0.674244642f},
-std::array<float,2>{0.546515107f, 0.34682861f},
-std::array<float,2>{0.292747378f, 0.712188125f},
-std::array<float,2>{0.15519692f, 0.191876605f},
-std::array<float,2>{0.860908329f, 0.790950835f},
-std::array<float,2>{0.94570893f, 0.123550043f},
-std::array<float,2>{0.0824891701f, 0.974425673f},
-std::array<float,2>{0.457666159f, 0.393734574f},
-std::array<float,2>{0.666632593f, 0.552525878f},
-std::array<float,2>{0.973085701f, 0.387749851f},
-std::array<float,2>{0.0953848138f, 0.538186193f},
-std::array<float,2>{0.494639456f, 0.1008818f},
-std::array<float,2>{0.629249752f, 0.986023068f},
-std::array<float,2>{0.523598671f, 0.216345817f},
-std::array<float,2>{0.274942815f, 0.799320757f},
-std::array<float,2>{0.165257365f, 0.359860629f},
-std::array<float,2>{0.831314683f, 0.688747346f},
-std::array<float,2>{0.703455508f, 0.259613603f},
-std::array<float,2>{0.419543684f, 0.656520724f},
-std::array<float,2>{0.0320607759f, 0.17665489f},
-std::array<float,2>{0.910013974f, 0.835632086f},
-std::array<float,2>{0.789616525f, 0.0108625367f},
-std::array<float,2>{0.234142244f, 0.934538245f},
-std::array<float,2>{0.363000154f, 0.489272594f},
-std::array<float,2>{0.565312207f, 0.621968806f},
-std::array<float,2>{0.8523736f, 0.34317717f},
-std::array<float,2>{0.136132464f, 0.729521453f},
-std::array<float,2>{0.299666822f, 0.247580931f},
-std::array<float,2>{0.556129158f, 0.755961835f},
-std::array<float,2>{0.685383081f, 0.080530256f},
-std::array<float,2>{0.451308817f, 0.94806087f},
-std::array<float,2>{0.0677635521f, 0.428667754f},
-std::array<float,2>{0.963946402f, 0.512289882f},
-std::array<float,2>{0.601409912f, 0.458250672f},
-std::array<float,2>{0.330685526f, 0.592058837f},
-std::array<float,2>{0.203318566f, 0.049842909f},
-std::array<float,2>{0.755433857f, 0.902535975f},
-std::array<float,2>{0.881370723f, 0.143596053f},
-std::array<float,2>{0.0173256733f, 0.850428343f},
-std::array<float,2>{0.381532669f, 0.29414171f},
-std::array<float,2>{0.727390885f, 0.65203023f},
-std::array<float,2>{0.959711969f, 0.372688562f},
-std::array<float,2>{0.0748620257f, 0.699191213f},
-std::array<float,2>{0.441498876f, 0.205157056f},
-std::array<float,2>{0.678254247f, 0.81106025f},
-std::array<float,2>{0.552684009f, 0.103533626f},
-std::array<float,2>{0.312044144f, 0.993062258f},
-std::array<float,2>{0.128277421f, 0.378943533f},
-std::array<float,2>{0.850704908f, 0.545784891f},
-std::array<float,2>{0.719457507f, 0.497392595f},
-std::array<float,2>{0.388580859f, 0.615090013f},
-std::array<float,2>{0.0235256832f, 0.00581553904f},
-std::array<float,2>{0.889078975f, 0.923145235f},
-std::array<float,2>{0.760972261f, 0.183996812f},
-std::array<float,2>{0.21525465f, 0.840282738f},
-std::array<float,2>{0.337353498f, 0.254290342f},
-std::array<float,2>{0.606799066f, 0.667410314f},
-std::array<float,2>{0.843310595f, 0.434894651f},
-std::array<float,2>{0.157581314f, 0.502974927f},
-std::array<float,2>{0.271298945f, 0.0908361003f},
-std::array<float,2>{0.52181381f, 0.942235768f},
-std::array<float,2>{0.633457005f, 0.23541759f},
-std::array<float,2>{0.487429589f, 0.761352539f},
-std::array<float,2>{0.107716896f, 0.332906008f},
-std::array<float,2>{0.978659034f, 0.719290912f},
-std::array<float,2>{0.571405828f, 0.286205977f},
-std::array<float,2>{0.368029803f, 0.644705415f},
-std::array<float,2>{0.219108239f, 0.156134844f},
-std::array<float,2>{0.784914196f, 0.85561347f},
-std::array<float,2>{0.91412425f, 0.0590493903f},
-std::array<float,2>{0.0409331471f, 0.898415983f},
-std::array<float,2>{0.408355862f, 0.468655854f},
-std::array<float,2>{0.713118732f, 0.580840409f},
-std::array<float,2>{0.893454134f, 0.439556628f},
-std::array<float,2>{0.0124116428f, 0.577074826f},
-std::array<float,2>{0.395390958f, 0.043760702f},
-std::array<float,2>{0.746243596f, 0.878213167f},
-std::array<float,2>{0.615250409f, 0.139321104f},
-std::array<float,2>{0.313879222f, 0.867676377f},
-std::array<float,2>{0.196142733f, 0.309118748f},
-std::array<float,2>{0.766088963f, 0.637036979f},
-std::array<float,2>{0.661088645f, 0.316071898f},
-std::array<float,2>{0.467007428f, 0.749883294f},
-std::array<float,2>{0.0890967175f, 0.228329703f},
-std::array<float,2>{0.942301989f, 0.781210601f},
-std::array<float,2>{0.873371243f, 0.0656045079f},
-std::array<float,2>{0.14703247f, 0.968247652f},
-std::array<float,2>{0.281602293f, 0.411237627f},
-std::array<float,2>{0.534339249f, 0.522893906f},
-std::array<float,2>{0.805652797f, 0.269537568f},
-std::array<float,2>{0.242294207f, 0.68642664f},
-std::array<float,2>{0.3526465f, 0.164606795f},
-std::array<float,2>{0.578532398f, 0.827438116f},
-std::array<float,2>{0.700436056f, 0.0311520193f},
-std::array<float,2>{0.422102243f, 0.911127627f},
-std::array<float,2>{0.053265579f, 0.47738263f},
-std::array<float,2>{0.931511283f, 0.608337104f},
-std::array<float,2>{0.504881561f, 0.404275805f},
-std::array<float,2>{0.262898594f, 0.560271919f},
-std::array<float,2>{0.179677069f, 0.111655027f},
-std::array<float,2>{0.819589436f, 0.979804337f},
-std::array<float,2>{0.99006319f, 0.199473977f},
-std::array<float,2>{0.123911269f, 0.783851206f},
-std::array<float,2>{0.470951021f, 0.352506846f},
-std::array<float,2>{0.650955915f, 0.704161108f},
-std::array<float,2>{0.99412936f, 0.250226498f},
-std::array<float,2>{0.117101513f, 0.669390798f},
-std::array<float,2>{0.479913592f, 0.181781605f},
-std::array<float,2>{0.646885097f, 0.839675725f},
-std::array<float,2>{0.512938023f, 0.00280028977f},
-std::array<float,2>{0.252936512f, 0.929654598f},
-std::array<float,2>{0.181650206f, 0.494718015f},
-std::array<float,2>{0.826887667f, 0.612141192f},
-std::array<float,2>{0.689207375f, 0.375098914f},
-std::array<float,2>{0.434912652f, 0.541605413f},
-std::array<float,2>{0.060594175f, 0.106787503f},
-std::array<float,2>{0.9233253f, 0.9995386f},
-std::array<float,2>{0.801047742f, 0.208990842f},
-std::array<float,2>{0.24209401f, 0.806798398f},
-std::array<float,2>{0.345656544f, 0.370174617f},
-std::array<float,2>{0.588741601f, 0.699642301f},
-std::array<float,2>{0.866461456f, 0.461679578f},
-std::array<float,2>{0.148801759f, 0.582192898f},
-std::array<float,2>{0.295553654f, 0.0573444068f},
-std::array<float,2>{0.541186392f, 0.89397192f},
-std::array<float,2>{0.668491304f, 0.150998428f},
-std::array<float,2>{0.45612669f, 0.853553832f},
-std::array<float,2>{0.0784088969f, 0.282638609f},
-std::array<float,2>{0.951077104f, 0.643783033f},
-std::array<float,2>{0.623584151f, 0.33183381f},
-std::array<float,2>{0.321751088f, 0.724118352f},
-std::array<float,2>{0.187764287f, 0.240363255f},
-std::array<float,2>{0.776684344f, 0.76286006f},
-std::array<float,2>{0.900036514f, 0.0864559114f},
-std::array<float,2>{0.0020443392f, 0.941151142f},
-std::array<float,2>{0.400991261f, 0.433095187f},
-std::array<float,2>{0.742091775f, 0.504816473f},
-std::array<float,2>{0.911842883f, 0.408801585f},
-std::array<float,2>{0.0386964977f, 0.515920281f},
-std::array<float,2>{0.415354759f, 0.0675098822f},
-std::array<float,2>{0.70764643f, 0.960978448f},
-std::array<float,2>{0.56887126f, 0.233880654f},
-std::array<float,2>{0.366912544f, 0.7766186f},
-std::array<float,2>{0.229135528f, 0.319224328f},
-std::array<float,2>{0.796603262f, 0.745922744f},
-std::array<float,2>{0.628282487f, 0.306291223f},
-std::array<float,2>{0.497163326f, 0.63436234f},
-std::array<float,2>{0.100878812f, 0.133864492f},
-std::array<float,2>{0.971058428f, 0.874297917f},
-std::array<float,2>{0.83402282f, 0.0396420844f},
-std::array<float,2>{0.169884458f, 0.87912184f},
-std::array<float,2>{0.278421909f, 0.44255507f},
-std::array<float,2>{0.529783428f, 0.571012318f},
-std::array<float,2>{0.7519629f, 0.35632506f},
-std::array<float,2>{0.208767578f, 0.708046973f},
-std::array<float,2>{0.332562864f, 0.19759126f},
-std::array<float,2>{0.596684456f, 0.788525999f},
-std::array<float,2>{0.73386097f, 0.116659224f},
-std::array<float,2>{0.378374666f, 0.981101394f},
-std::array<float,2>{0.0213803481f, 0.40154314f},
-std::array<float,2>{0.878686368f, 0.555532396f},
-std::array<float,2>{0.561854661f, 0.482761919f},
-std::array<float,2>{0.303102732f, 0.60306108f},
-std::array<float,2>{0.136809155f, 0.0243065339f},
-std::array<float,2>{0.855794013f, 0.909362793f},
-std::array<float,2>{0.966522753f, 0.169775173f},
-std::array<float,2>{0.0663020536f, 0.822062314f},
-std::array<float,2>{0.448677599f, 0.265744001f},
-std::array<float,2>{0.680056214f, 0.680066943f},
-std::array<float,2>{0.884495139f, 0.326859027f},
-std::array<float,2>{0.0310120489f, 0.734706819f},
-std::array<float,2>{0.384104222f, 0.221954465f},
-std::array<float,2>{0.723603427f, 0.770453632f},
-std::array<float,2>{0.604027629f, 0.0720317215f},
-std::array<float,2>{0.343120426f, 0.958630085f},
-std::array<float,2>{0.213437319f, 0.420809656f},
-std::array<float,2>{0.765495837f, 0.530710876f},
-std::array<float,2>{0.674579263f, 0.44993335f},
-std::array<float,2>{0.437742621f, 0.563482106f},
-std::array<float,2>{0.0733146518f, 0.0323172733f},
-std::array<float,2>{0.953811705f, 0.88616246f},
-std::array<float,2>{0.847446859f, 0.125050411f},
-std::array<float,2>{0.132165417f, 0.865000367f},
-std::array<float,2>{0.304726958f, 0.29872939f},
-std::array<float,2>{0.547056794f, 0.627120316f},
-std::array<float,2>{0.787644207f, 0.398076147f},
-std::array<float,2>{0.226118669f, 0.549701512f},
-std::array<float,2>{0.373052418f, 0.118681088f},
-std::array<float,2>{0.576943815f, 0.969206274f},
-std::array<float,2>{0.716920853f, 0.189787999f},
-std::array<float,2>{0.411659807f, 0.793157041f},
-std::array<float,2>{0.0464828648f, 0.349325955f},
-std::array<float,2>{0.919861972f, 0.717494249f},
-std::array<float,2>{0.517395318f, 0.277538896f},
-std::array<float,2>{0.266198635f, 0.677361369f},
-std::array<float,2>{0.164057881f, 0.157736838f},
-std::array<float,2>{0.83718574f, 0.819164097f},
-std::array<float,2>{0.983153343f, 0.0197367854f},
-std::array<float,2>{0.103491716f, 0.915945709f},
-std::array<float,2>{0.491535276f, 0.469041914f},
-std::array<float,2>{0.639466345f, 0.600436926f},
-std::array<float,2>{0.941331208f, 0.486583263f},
-std::array<float,2>{0.0901465565f, 0.620007932f},
-std::array<float,2>{0.461646914f, 0.0130388197f},
-std::array<float,2>{0.658441901f, 0.931613207f},
-std::array<float,2>{0.535210609f, 0.174208358f},
-std::array<float,2>{0.286616623f, 0.830239236f},
-std::array<float,2>{0.14202632f, 0.262548178f},
-std::array<float,2>{0.868664443f, 0.663272619f},
-std::array<float,2>{0.744785011f, 0.364331931f},
-std::array<float,2>{0.392080426f, 0.692415297f},
-std::array<float,2>{0.00881810207f, 0.211827189f},
-std::array<float,2>{0.897766232f, 0.802076936f},
-std::array<float,2>{0.772009969f, 0.0955034494f},
-std::array<float,2>{0.201503232f, 0.989712358f},
-std::array<float,2>{0.318155199f, 0.382897824f},
-std::array<float,2>{0.611381412f, 0.534534693f},
-std::array<float,2>{0.81481719f, 0.289373577f},
-std::array<float,2>{0.17262134f, 0.655291796f},
-std::array<float,2>{0.261282474f, 0.145068124f},
-std::array<float,2>{0.503751934f, 0.847210348f},
-std::array<float,2>{0.654010117f, 0.0539983287f},
-std::array<float,2>{0.47577998f, 0.900040627f},
-std::array<float,2>{0.118307136f, 0.453937501f},
-std::array<float,2>{0.98510778f, 0.587694526f},
-std::array<float,2>{0.585478544f, 0.424264461f},
-std::array<float,2>{0.355914146f, 0.510032475f},
-std::array<float,2>{0.248164058f, 0.0831003115f},
-std::array<float,2>{0.812378645f, 0.950592995f},
-std::array<float,2>{0.937421322f, 0.245118156f},
-std::array<float,2>{0.0488578267f, 0.75229001f},
-std::array<float,2>{0.428407371f, 0.33976537f},
-std::array<float,2>{0.698472202f, 0.73395735f},
-std::array<float,2>{0.908675611f, 0.259781361f},
-std::array<float,2>{0.0328669995f, 0.659340799f},
-std::array<float,2>{0.418725133f, 0.178002447f},
-std::array<float,2>{0.704163373f, 0.833219945f},
-std::array<float,2>{0.56626308f, 0.00971377827f},
-std::array<float,2>{0.361924529f, 0.936024249f},
-std::array<float,2>{0.23297587f, 0.49150154f},
-std::array<float,2>{0.790605366f, 0.624162138f},
-std::array<float,2>{0.630447686f, 0.389054596f},
-std::array<float,2>{0.495877653f, 0.536059201f},
-std::array<float,2>{0.0943863168f, 0.0983533412f},
-std::array<float,2>{0.973949432f, 0.987505674f},
-std::array<float,2>{0.830217898f, 0.218225345f},
-std::array<float,2>{0.164536104f, 0.798692465f},
-std::array<float,2>{0.273794204f, 0.362144589f},
-std::array<float,2>{0.525178909f, 0.690298557f},
-std::array<float,2>{0.754360616f, 0.45904088f},
-std::array<float,2>{0.204196975f, 0.590986133f},
-std::array<float,2>{0.331741184f, 0.0470465012f},
-std::array<float,2>{0.600483477f, 0.905997932f},
-std::array<float,2>{0.727691531f, 0.142045021f},
-std::array<float,2>{0.382604778f, 0.849320769f},
-std::array<float,2>{0.0158282146f, 0.296112448f},
-std::array<float,2>{0.882219493f, 0.648632765f},
-std::array<float,2>{0.555056453f, 0.341461539f},
-std::array<float,2>{0.30000034f, 0.727468848f},
-std::array<float,2>{0.135485858f, 0.248882979f},
-std::array<float,2>{0.853151023f, 0.754639268f},
-std::array<float,2>{0.963265359f, 0.0791377872f},
-std::array<float,2>{0.0668772236f, 0.945821762f},
-std::array<float,2>{0.45216316f, 0.426919222f},
-std::array<float,2>{0.68417865f, 0.514130652f},
-std::array<float,2>{0.998688936f, 0.414846212f},
-std::array<float,2>{0.112919569f, 0.523825824f},
-std::array<float,2>{0.484304041f, 0.0766834542f},
-std::array<float,2>{0.644174099f, 0.956994712f},
-std::array<float,2>{0.511676729f, 0.223292321f},
-std::array<float,2>{0.257795781f, 0.767382503f},
-std::array<float,2>{0.18416439f, 0.322807223f},
-std::array<float,2>{0.82152915f, 0.740294874f},
-std::array<float,2>{0.691450179f, 0.302240402f},
-std::array<float,2>{0.433466643f, 0.629781425f},
-std::array<float,2>{0.0580396615f, 0.130639493f},
-std::array<float,2>{0.928615272f, 0.861970186f},
-std::array<float,2>{0.798751891f, 0.0381926782f},
-std::array<float,2>{0.234646618f, 0.889531791f},
-std::array<float,2>{0.34766838f, 0.448858052f},
-std::array<float,2>{0.593456626f, 0.569836497f},
-std::array<float,2>{0.86019218f, 0.343901724f},
-std::array<float,2>{0.155394003f, 0.714577258f},
-std::array<float,2>{0.291731983f, 0.194636315f},
-std::array<float,2>{0.545793355f, 0.791201293f},
-std::array<float,2>{0.667417824f, 0.123028398f},
-std::array<float,2>{0.458651125f, 0.975052893f},
-std::array<float,2>{0.0838602111f, 0.392515719f},
-std::array<float,2>{0.946576953f, 0.554523826f},
-std::array<float,2>{0.61866492f, 0.473505646f},
-std::array<float,2>{0.324666142f, 0.597276926f},
-std::array<float,2>{0.194556072f, 0.018246498f},
-std::array<float,2>{0.780911565f, 0.920080245f},
-std::array<float,2>{0.9030388f, 0.163334131f},
-std::array<float,2>{0.00405639084f, 0.814075172f},
-std::array<float,2>{0.405936509f, 0.27511096f},
-std::array<float,2>{0.736439705f, 0.671944916f},
-std::array<float,2>{0.942982316f, 0.313474357f},
-std::array<float,2>{0.0884433389f, 0.746336162f},
-std::array<float,2>{0.467994064f, 0.228548095f},
-std::array<float,2>{0.661856234f, 0.779081702f},
-std::array<float,2>{0.533363998f, 0.0633959845f},
-std::array<float,2>{0.283066928f, 0.966358244f},
-std::array<float,2>{0.147698224f, 0.413250208f},
-std::array<float,2>{0.874585688f, 0.520437181f},
-std::array<float,2>{0.747320652f, 0.438456625f},
-std::array<float,2>{0.396216869f, 0.57429719f},
-std::array<float,2>{0.0131062418f, 0.0453135185f},
-std::array<float,2>{0.89391458f, 0.876813412f},
-std::array<float,2>{0.767462075f, 0.136737362f},
-std::array<float,2>{0.196887478f, 0.870483041f},
-std::array<float,2>{0.313444555f, 0.311974496f},
-std::array<float,2>{0.617174208f, 0.640360415f},
-std::array<float,2>{0.81930536f, 0.405668139f},
-std::array<float,2>{0.178238511f, 0.562150657f},
-std::array<float,2>{0.262634188f, 0.110024296f},
-std::array<float,2>{0.505053699f, 0.97763139f},
-std::array<float,2>{0.652129114f, 0.202721626f},
-std::array<float,2>{0.471927017f, 0.78293401f},
-std::array<float,2>{0.124152742f, 0.354010373f},
-std::array<float,2>{0.98854363f, 0.706062615f},
-std::array<float,2>{0.579483271f, 0.27320379f},
-std::array<float,2>{0.352331489f, 0.685242593f},
-std::array<float,2>{0.243928447f, 0.166499481f},
-std::array<float,2>{0.806144893f, 0.825497687f},
-std::array<float,2>{0.930390716f, 0.027410306f},
-std::array<float,2>{0.0537808314f, 0.913682878f},
-std::array<float,2>{0.42378822f, 0.478722751f},
-std::array<float,2>{0.699301839f, 0.606982231f},
-std::array<float,2>{0.890527785f, 0.499135822f},
-std::array<float,2>{0.0249343757f, 0.61549437f},
-std::array<float,2>{0.387466192f, 0.00721429614f},
-std::array<float,2>{0.720593512f, 0.925184667f},
-std::array<float,2>{0.606104434f, 0.186061785f},
-std::array<float,2>{0.336133003f, 0.842095315f},
-std::array<float,2>{0.216410279f, 0.257182628f},
-std::array<float,2>{0.759847879f, 0.665059805f},
-std::array<float,2>{0.679286301f, 0.374531597f},
-std::array<float,2>{0.443134665f, 0.696839929f},
-std::array<float,2>{0.0753400102f, 0.204346046f},
-std::array<float,2>{0.960370779f, 0.809654713f},
-std::array<float,2>{0.850188613f, 0.102044299f},
-std::array<float,2>{0.127708048f, 0.99545157f},
-std::array<float,2>{0.311001837f, 0.381702513f},
-std::array<float,2>{0.551213324f, 0.544220626f},
-std::array<float,2>{0.783746302f, 0.288793117f},
-std::array<float,2>{0.220563412f, 0.64797914f},
-std::array<float,2>{0.368782997f, 0.154204667f},
-std::array<float,2>{0.570489228f, 0.858042657f},
-std::array<float,2>{0.714024782f, 0.0624419898f},
-std::array<float,2>{0.409419894f, 0.896209836f},
-std::array<float,2>{0.0394246317f, 0.466157109f},
-std::array<float,2>{0.915530622f, 0.579009533f},
-std::array<float,2>{0.522498667f, 0.435608059f},
-std::array<float,2>{0.269818723f, 0.50019443f},
-std::array<float,2>{0.156670272f, 0.093748495f},
-std::array<float,2>{0.84183526f, 0.944244504f},
-std::array<float,2>{0.980098367f, 0.237006932f},
-std::array<float,2>{0.10888993f, 0.758009315f},
-std::array<float,2>{0.487053156f, 0.335588366f},
-std::array<float,2>{0.63435328f, 0.722635925f},
-std::array<float,2>{0.971713245f, 0.307143718f},
-std::array<float,2>{0.100098342f, 0.636653721f},
-std::array<float,2>{0.496794552f, 0.135157838f},
-std::array<float,2>{0.627191603f, 0.872399747f},
-std::array<float,2>{0.530911267f, 0.042326156f},
-std::array<float,2>{0.277664602f, 0.882193208f},
-std::array<float,2>{0.168174207f, 0.444956809f},
-std::array<float,2>{0.835447669f, 0.572678626f},
-std::array<float,2>{0.708149493f, 0.406813741f},
-std::array<float,2>{0.4149445f, 0.519481659f},
-std::array<float,2>{0.0375031717f, 0.0689773932f},
-std::array<float,2>{0.910160065f, 0.964807868f},
-std::array<float,2>{0.795330822f, 0.231718078f},
-std::array<float,2>{0.229780257f, 0.773484468f},
-std::array<float,2>{0.365957588f, 0.317898452f},
-std::array<float,2>{0.569345653f, 0.742942691f},
-std::array<float,2>{0.857260525f, 0.481876373f},
-std::array<float,2>{0.138147593f, 0.605314076f},
-std::array<float,2>{0.303819954f, 0.0272946022f},
-std::array<float,2>{0.561215043f, 0.90776217f},
-std::array<float,2>{0.681242824f, 0.170580909f},
-std::array<float,2>{0.447765291f, 0.82376039f},
-std::array<float,2>{0.0653302521f, 0.269115239f},
-std::array<float,2>{0.964897156f, 0.682928681f},
-std::array<float,2>{0.596571445f, 0.35755834f},
-std::array<float,2>{0.333258897f, 0.710389614f},
-std::array<float,2>{0.207242221f, 0.197080925f},
-std::array<float,2>{0.753293633f, 0.785394013f},
-std::array<float,2>{0.877065122f, 0.1141643f},
-std::array<float,2>{0.0200861264f, 0.98317939f},
-std::array<float,2>{0.377546877f, 0.399825126f},
-std::array<float,2>{0.73304826f, 0.557078123f},
-std::array<float,2>{0.922695458f, 0.377795756f},
-std::array<float,2>{0.0624293052f, 0.540749133f},
-std::array<float,2>{0.434175253f, 0.108729735f},
-std::array<float,2>{0.688021839f, 0.997526586f},
-std::array<float,2>{0.589018881f, 0.208661333f},
-std::array<float,2>{0.343897432f, 0.805342436f},
-std::array<float,2>{0.240323126f, 0.36789465f},
-std::array<float,2>{0.802075446f, 0.70298177f},
-std::array<float,2>{0.647776783f, 0.252296001f},
-std::array<float,2>{0.478552371f, 0.670365512f},
-std::array<float,2>{0.115614638f, 0.18023923f},
-std::array<float,2>{0.993102372f, 0.837167203f},
-std::array<float,2>{0.827862442f, 0.000900930318f},
-std::array<float,2>{0.183084905f, 0.926864207f},
-std::array<float,2>{0.25264594f, 0.494106621f},
-std::array<float,2>{0.511761725f, 0.609422624f},
-std::array<float,2>{0.775594652f, 0.330012202f},
-std::array<float,2>{0.189103857f, 0.725437284f},
-std::array<float,2>{0.320536971f, 0.239118546f},
-std::array<float,2>{0.624334455f, 0.76406455f},
-std::array<float,2>{0.740913093f, 0.0890926644f},
-std::array<float,2>{0.40157792f, 0.937707841f},
-std::array<float,2>{0.00302987709f, 0.430640757f},
-std::array<float,2>{0.899051726f, 0.506797671f},
-std::array<float,2>{0.542272091f, 0.463946044f},
-std::array<float,2>{0.296304792f, 0.585873008f},
-std::array<float,2>{0.149868101f, 0.0562934764f},
-std::array<float,2>{0.866205812f, 0.891131759f},
-std::array<float,2>{0.949858725f, 0.14909032f},
-std::array<float,2>{0.0796786621f, 0.852867365f},
-std::array<float,2>{0.455544293f, 0.285113275f},
-std::array<float,2>{0.669790447f, 0.641864479f},
-std::array<float,2>{0.897146165f, 0.366125494f},
-std::array<float,2>{0.00796534028f, 0.6943717f},
-std::array<float,2>{0.390771389f, 0.214015707f},
-std::array<float,2>{0.746046364f, 0.803171158f},
-std::array<float,2>{0.612364769f, 0.0972842649f},
-std::array<float,2>{0.316430122f, 0.991479218f},
-std::array<float,2>{0.202895269f, 0.386223227f},
-std::array<float,2>{0.772712767f, 0.533141673f},
-std::array<float,2>{0.659210443f, 0.485113561f},
-std::array<float,2>{0.462038368f, 0.618581414f},
-std::array<float,2>{0.0910058618f, 0.0144277131f},
-std::array<float,2>{0.940171063f, 0.932087839f},
-std::array<float,2>{0.867207885f, 0.172785282f},
-std::array<float,2>{0.141481742f, 0.829149604f},
-std::array<float,2>{0.285431534f, 0.265567482f},
-std::array<float,2>{0.536781788f, 0.661702812f},
-std::array<float,2>{0.810592711f, 0.423133135f},
-std::array<float,2>{0.249881983f, 0.508416891f},
-std::array<float,2>{0.356600165f, 0.0842726305f},
-std::array<float,2>{0.584661126f, 0.95264554f},
-std::array<float,2>{0.697505593f, 0.242217198f},
-std::array<float,2>{0.429267824f, 0.750871062f},
-std::array<float,2>{0.0503373817f, 0.336815685f},
-std::array<float,2>{0.936218321f, 0.731171489f},
-std::array<float,2>{0.502162099f, 0.292485774f},
-std::array<float,2>{0.26057905f, 0.653247893f},
-std::array<float,2>{0.173548728f, 0.148213699f},
-std::array<float,2>{0.815461218f, 0.844751835f},
-std::array<float,2>{0.985471249f, 0.0512891486f},
-std::array<float,2>{0.117894568f, 0.901540101f},
-std::array<float,2>{0.474690527f, 0.456504017f},
-std::array<float,2>{0.652984977f, 0.588691771f},
-std::array<float,2>{0.954185009f, 0.452594876f},
-std::array<float,2>{0.0727509856f, 0.564731002f},
-std::array<float,2>{0.438733965f, 0.0334315263f},
-std::array<float,2>{0.675044358f, 0.88397795f},
-std::array<float,2>{0.547919035f, 0.127974302f},
-std::array<float,2>{0.306457967f, 0.867168069f},
-std::array<float,2>{0.131036445f, 0.298959702f},
-std::array<float,2>{0.84651053f, 0.626741052f},
-std::array<float,2>{0.723925829f, 0.324588239f},
-std::array<float,2>{0.383702457f, 0.737674415f},
-std::array<float,2>{0.0300898068f, 0.220117316f},
-std::array<float,2>{0.882966995f, 0.772115707f},
-std::array<float,2>{0.763844311f, 0.0727520436f},
-std::array<float,2>{0.214301988f, 0.960426569f},
-std::array<float,2>{0.342134327f, 0.419786096f},
-std::array<float,2>{0.605058789f, 0.528948247f},
-std::array<float,2>{0.836456418f, 0.280688286f},
-std::array<float,2>{0.162968248f, 0.678781629f},
-std::array<float,2>{0.267064035f, 0.158908874f},
-std::array<float,2>{0.515781581f, 0.817632616f},
-std::array<float,2>{0.640189469f, 0.0226538703f},
-std::array<float,2>{0.490317941f, 0.917713225f},
-std::array<float,2>{0.101727247f, 0.471299827f},
-std::array<float,2>{0.984131575f, 0.598285377f},
-std::array<float,2>{0.577150404f, 0.396152496f},
-std::array<float,2>{0.37403211f, 0.547869742f},
-std::array<float,2>{0.225314409f, 0.119599693f},
-std::array<float,2>{0.788899422f, 0.970989048f},
-std::array<float,2>{0.91839087f, 0.188636571f},
-std::array<float,2>{0.0453897193f, 0.79579103f},
-std::array<float,2>{0.41049391f, 0.349872798f},
-std::array<float,2>{0.717834771f, 0.71678561f},
-std::array<float,2>{0.879576027f, 0.293190509f},
-std::array<float,2>{0.018818818f, 0.650556624f},
-std::array<float,2>{0.380596578f, 0.143506572f},
-std::array<float,2>{0.72893399f, 0.851372123f},
-std::array<float,2>{0.598774552f, 0.0490485057f},
-std::array<float,2>{0.328243583f, 0.903700292f},
-std::array<float,2>{0.206156358f, 0.457650661f},
-std::array<float,2>{0.756507635f, 0.5928213f},
-std::array<float,2>{0.686919391f, 0.428801507f},
-std::array<float,2>{0.450631827f, 0.513006866f},
-std::array<float,2>{0.0690169632f, 0.0811935812f},
-std::array<float,2>{0.961464942f, 0.948923528f},
-std::array<float,2>{0.853715301f, 0.247047216f},
-std::array<float,2>{0.134258449f, 0.757523537f},
-std::array<float,2>{0.297381222f, 0.342372596f},
-std::array<float,2>{0.557198822f, 0.728872776f},
-std::array<float,2>{0.791653335f, 0.489244968f},
-std::array<float,2>{0.230509207f, 0.62280643f},
-std::array<float,2>{0.360372543f, 0.0101983584f},
-std::array<float,2>{0.56444788f, 0.934847534f},
-std::array<float,2>{0.706785738f, 0.17744419f},
-std::array<float,2>{0.420502394f, 0.834642231f},
-std::array<float,2>{0.034990374f, 0.258389413f},
-std::array<float,2>{0.908096611f, 0.657965839f},
-std::array<float,2>{0.527232707f, 0.360708833f},
-std::array<float,2>{0.276888281f, 0.688250482f},
-std::array<float,2>{0.166527793f, 0.215290502f},
-std::array<float,2>{0.829892099f, 0.800505877f},
-std::array<float,2>{0.976085126f, 0.0999304801f},
-std::array<float,2>{0.0973457545f, 0.984458983f},
-std::array<float,2>{0.493267506f, 0.386790395f},
-std::array<float,2>{0.631036282f, 0.537759542f},
-std::array<float,2>{0.947571933f, 0.39270553f},
-std::array<float,2>{0.0841149688f, 0.551635802f},
-std::array<float,2>{0.460182488f, 0.124555923f},
-std::array<float,2>{0.664205134f, 0.973330557f},
-std::array<float,2>{0.543668926f, 0.193276361f},
-std::array<float,2>{0.289345562f, 0.789509535f},
-std::array<float,2>{0.154062077f, 0.346175343f},
-std::array<float,2>{0.863095105f, 0.711165667f},
-std::array<float,2>{0.734895766f, 0.276480436f},
-std::array<float,2>{0.402910262f, 0.675227046f},
-std::array<float,2>{0.00699025067f, 0.161600992f},
-std::array<float,2>{0.906161427f, 0.815304458f},
-std::array<float,2>{0.777533412f, 0.0164018143f},
-std::array<float,2>{0.191407099f, 0.918105364f},
-std::array<float,2>{0.32673353f, 0.476199508f},
-std::array<float,2>{0.619329751f, 0.594615757f},
-std::array<float,2>{0.822514892f, 0.321096122f},
-std::array<float,2>{0.187444106f, 0.738488972f},
-std::array<float,2>{0.254771054f, 0.225285232f},
-std::array<float,2>{0.509219468f, 0.769147158f},
-std::array<float,2>{0.640859067f, 0.0756139681f},
-std::array<float,2>{0.480472565f, 0.95478344f},
-std::array<float,2>{0.109526992f, 0.416895896f},
-std::array<float,2>{0.997723103f, 0.525943756f},
-std::array<float,2>{0.590981424f, 0.445410907f},
-std::array<float,2>{0.351152539f, 0.566440582f},
-std::array<float,2>{0.23715131f, 0.0353805348f},
-std::array<float,2>{0.799921334f, 0.887826979f},
-std::array<float,2>{0.927629352f, 0.132490993f},
-std::array<float,2>{0.0562202446f, 0.860572696f},
-std::array<float,2>{0.431163609f, 0.302980542f},
-std::array<float,2>{0.694081485f, 0.631850779f},
-std::array<float,2>{0.991636872f, 0.353164583f},
-std::array<float,2>{0.12154346f, 0.703195035f},
-std::array<float,2>{0.47009176f, 0.201023921f},
-std::array<float,2>{0.649752021f, 0.784347355f},
-std::array<float,2>{0.507413447f, 0.112492263f},
-std::array<float,2>{0.264378726f, 0.978650331f},
-std::array<float,2>{0.176933274f, 0.402741313f},
-std::array<float,2>{0.817125678f, 0.559425533f},
-std::array<float,2>{0.70243907f, 0.47758165f},
-std::array<float,2>{0.42564705f, 0.609244466f},
-std::array<float,2>{0.051802244f, 0.0294380672f},
-std::array<float,2>{0.932869136f, 0.911176026f},
-std::array<float,2>{0.808403969f, 0.165965021f},
-std::array<float,2>{0.245439515f, 0.826720357f},
-std::array<float,2>{0.354029298f, 0.271401048f},
-std::array<float,2>{0.581586123f, 0.686865389f},
-std::array<float,2>{0.872832954f, 0.410560459f},
-std::array<float,2>{0.145453334f, 0.521639407f},
-std::array<float,2>{0.284020096f, 0.0646589622f},
-std::array<float,2>{0.532005191f, 0.967705011f},
-std::array<float,2>{0.66371125f, 0.227253541f},
-std::array<float,2>{0.465936214f, 0.779604077f},
-std::array<float,2>{0.0872812569f, 0.314994186f},
-std::array<float,2>{0.944639623f, 0.748896897f},
-std::array<float,2>{0.613502741f, 0.309930295f},
-std::array<float,2>{0.314898312f, 0.638204277f},
-std::array<float,2>{0.198287457f, 0.139972746f},
-std::array<float,2>{0.76772207f, 0.868249238f},
-std::array<float,2>{0.891988516f, 0.0444049351f},
-std::array<float,2>{0.0154542541f, 0.87722069f},
-std::array<float,2>{0.397025436f, 0.440669507f},
-std::array<float,2>{0.749969304f, 0.577472687f},
-std::array<float,2>{0.916773796f, 0.4670569f},
-std::array<float,2>{0.0426589958f, 0.581616998f},
-std::array<float,2>{0.407589108f, 0.059841264f},
-std::array<float,2>{0.71221894f, 0.897040665f},
-std::array<float,2>{0.573108971f, 0.154557869f},
-std::array<float,2>{0.371003479f, 0.857056916f},
-std::array<float,2>{0.22150822f, 0.285261005f},
-std::array<float,2>{0.782817483f, 0.645851552f},
-std::array<float,2>{0.635779381f, 0.333178282f},
-std::array<float,2>{0.486278623f, 0.72009176f},
-std::array<float,2>{0.105805114f, 0.234931529f},
-std::array<float,2>{0.976681054f, 0.760319591f},
-std::array<float,2>{0.841528118f, 0.09005633f},
-std::array<float,2>{0.159459278f, 0.942395747f},
-std::array<float,2>{0.272336811f, 0.434250653f},
-std::array<float,2>{0.521170199f, 0.502316415f},
-std::array<float,2>{0.759149075f, 0.255225182f},
-std::array<float,2>{0.216874465f, 0.66660434f},
-std::array<float,2>{0.338680536f, 0.185382754f},
-std::array<float,2>{0.607884288f, 0.841342151f},
-std::array<float,2>{0.721104383f, 0.00434519723f},
-std::array<float,2>{0.388780683f, 0.922715068f},
-std::array<float,2>{0.0266443994f, 0.496496558f},
-std::array<float,2>{0.886846542f, 0.613990128f},
-std::array<float,2>{0.554262936f, 0.380214632f},
-std::array<float,2>{0.309187382f, 0.545977056f},
-std::array<float,2>{0.12579529f, 0.104920074f},
-std::array<float,2>{0.848574758f, 0.99322778f},
-std::array<float,2>{0.958018482f, 0.206959799f},
-std::array<float,2>{0.0775199905f, 0.812034965f},
-std::array<float,2>{0.444860905f, 0.371787041f},
-std::array<float,2>{0.677259147f, 0.698127151f},
-std::array<float,2>{0.967170417f, 0.266620725f},
-std::array<float,2>{0.0632569119f, 0.680812418f},
-std::array<float,2>{0.447233051f, 0.168368503f},
-std::array<float,2>{0.681728542f, 0.82042706f},
-std::array<float,2>{0.559326053f, 0.0253182463f},
-std::array<float,2>{0.301705986f, 0.908826709f},
-std::array<float,2>{0.139177531f, 0.48346895f},
-std::array<float,2>{0.859203219f, 0.601598918f},
-std::array<float,2>{0.730505943f, 0.401059628f},
-std::array<float,2>{0.375921577f, 0.556351483f},
-std::array<float,2>{0.0216072686f, 0.115783684f},
-std::array<float,2>{0.875764251f, 0.981618345f},
-std::array<float,2>{0.751358032f, 0.198273465f},
-std::array<float,2>{0.209351733f, 0.787160158f},
-std::array<float,2>{0.335384011f, 0.356608897f},
-std::array<float,2>{0.594177544f, 0.70796901f},
-std::array<float,2>{0.832885981f, 0.442245126f},
-std::array<float,2>{0.170182079f, 0.571351409f},
-std::array<float,2>{0.279893637f, 0.0404514149f},
-std::array<float,2>{0.528879523f, 0.88033998f},
-std::array<float,2>{0.625652552f, 0.133761436f},
-std::array<float,2>{0.49863264f, 0.873053491f},
-std::array<float,2>{0.0984491855f, 0.304960936f},
-std::array<float,2>{0.969884038f, 0.632976472f},
-std::array<float,2>{0.566994607f, 0.320229322f},
-std::array<float,2>{0.364045203f, 0.744385064f},
-std::array<float,2>{0.227442592f, 0.232772768f},
-std::array<float,2>{0.79467082f, 0.775835931f},
-std::array<float,2>{0.912639141f, 0.0670804977f},
-std::array<float,2>{0.0363048799f, 0.962014973f},
-std::array<float,2>{0.417100698f, 0.41001907f},
-std::array<float,2>{0.710094988f, 0.516987562f},
-std::array<float,2>{0.901174664f, 0.432206422f},
-std::array<float,2>{0.00138122868f, 0.505104482f},
-std::array<float,2>{0.399579495f, 0.087488994f},
-std::array<float,2>{0.738524854f, 0.939992726f},
-std::array<float,2>{0.622976482f, 0.241679341f},
-std::array<float,2>{0.323495954f, 0.762137234f},
-std::array<float,2>{0.190248236f, 0.330628932f},
-std::array<float,2>{0.773937285f, 0.722674131f},
-std::array<float,2>{0.67171973f, 0.282116473f},
-std::array<float,2>{0.453733981f, 0.643488169f},
-std::array<float,2>{0.0807508454f, 0.151720673f},
-std::array<float,2>{0.95254755f, 0.855352759f},
-std::array<float,2>{0.864214063f, 0.058590591f},
-std::array<float,2>{0.150511727f, 0.893373549f},
-std::array<float,2>{0.294066757f, 0.462512046f},
-std::array<float,2>{0.539723158f, 0.583568633f},
-std::array<float,2>{0.803341329f, 0.369319499f},
-std::array<float,2>{0.23934266f, 0.701083064f},
-std::array<float,2>{0.347431153f, 0.210590824f},
-std::array<float,2>{0.587190509f, 0.808446348f},
-std::array<float,2>{0.690306246f, 0.10586489f},
-std::array<float,2>{0.436735511f, 0.998654664f},
-std::array<float,2>{0.0600805767f, 0.376277268f},
-std::array<float,2>{0.924617708f, 0.542330563f},
-std::array<float,2>{0.514692307f, 0.495211124f},
-std::array<float,2>{0.251739115f, 0.612404227f},
-std::array<float,2>{0.18050842f, 0.00332393171f},
-std::array<float,2>{0.825591385f, 0.927779734f},
-std::array<float,2>{0.994619846f, 0.183394238f},
-std::array<float,2>{0.114998899f, 0.837976575f},
-std::array<float,2>{0.477502882f, 0.251443237f},
-std::array<float,2>{0.645805597f, 0.668111026f},
-std::array<float,2>{0.934534311f, 0.338430375f},
-std::array<float,2>{0.0486374646f, 0.73263061f},
-std::array<float,2>{0.427412838f, 0.244391263f},
-std::array<float,2>{0.697218537f, 0.753767192f},
-std::array<float,2>{0.583624423f, 0.0828034505f},
-std::array<float,2>{0.358860105f, 0.949630082f},
-std::array<float,2>{0.24677439f, 0.425332755f},
-std::array<float,2>{0.809147298f, 0.510866046f},
-std::array<float,2>{0.65562284f, 0.454390585f},
-std::array<float,2>{0.4732849f, 0.58674705f},
-std::array<float,2>{0.119907811f, 0.0530900545f},
-std::array<float,2>{0.98688817f, 0.898815334f},
-std::array<float,2>{0.814243317f, 0.145868734f},
-std::array<float,2>{0.175246969f, 0.846433818f},
-std::array<float,2>{0.259468287f, 0.290072888f},
-std::array<float,2>{0.50062114f, 0.654845834f},
-std::array<float,2>{0.771323562f, 0.384157568f},
-std::array<float,2>{0.200913101f, 0.533382893f},
-std::array<float,2>{0.319359571f, 0.0944565684f},
-std::array<float,2>{0.609779477f, 0.988383889f},
-std::array<float,2>{0.743571639f, 0.212700412f},
-std::array<float,2>{0.393051267f, 0.801174521f},
-std::array<float,2>{0.0106132459f, 0.364094347f},
-std::array<float,2>{0.895702183f, 0.691423059f},
-std::array<float,2>{0.537780225f, 0.262851864f},
-std::array<float,2>{0.287233919f, 0.662494302f},
-std::array<float,2>{0.143035397f, 0.175227135f},
-std::array<float,2>{0.869909108f, 0.831257164f},
-std::array<float,2>{0.937799096f, 0.0126935234f},
-std::array<float,2>{0.0929347649f, 0.930059671f},
-std::array<float,2>{0.464592457f, 0.48759988f},
-std::array<float,2>{0.657001317f, 0.620816529f},
-std::array<float,2>{0.981507301f, 0.470436007f},
-std::array<float,2>{0.10535834f, 0.601324499f},
-std::array<float,2>{0.488472253f, 0.0211473666f},
-std::array<float,2>{0.637494206f, 0.914170802f},
-std::array<float,2>{0.51935482f, 0.156309083f},
-std::array<float,2>{0.268670321f, 0.819610536f},
-std::array<float,2>{0.161408976f, 0.279134005f},
-std::array<float,2>{0.839039385f, 0.676174283f},
-std::array<float,2>{0.716694355f, 0.347984195f},
-std::array<float,2>{0.413655549f, 0.718614578f},
-std::array<float,2>{0.0445254296f, 0.190747827f},
-std::array<float,2>{0.921493471f, 0.794205368f},
-std::array<float,2>{0.786787987f, 0.117573082f},
-std::array<float,2>{0.22357668f, 0.970441341f},
-std::array<float,2>{0.371975899f, 0.397447616f},
-std::array<float,2>{0.574344575f, 0.550269425f},
-std::array<float,2>{0.845141649f, 0.297697932f},
-std::array<float,2>{0.130336046f, 0.628659487f},
-std::array<float,2>{0.308382124f, 0.12649864f},
-std::array<float,2>{0.550138295f, 0.863477468f},
-std::array<float,2>{0.673736274f, 0.0319165848f},
-std::array<float,2>{0.440171808f, 0.885723829f},
-std::array<float,2>{0.0720935315f, 0.450776607f},
-std::array<float,2>{0.9555493f, 0.56332469f},
-std::array<float,2>{0.602652371f, 0.421680659f},
-std::array<float,2>{0.341610372f, 0.529521763f},
-std::array<float,2>{0.211820722f, 0.0711026415f},
-std::array<float,2>{0.762295663f, 0.95734787f},
-std::array<float,2>{0.886416614f, 0.221546054f},
-std::array<float,2>{0.0291158855f, 0.771104157f},
-std::array<float,2>{0.385979325f, 0.327511549f},
-std::array<float,2>{0.725268483f, 0.735782504f},
-std::array<float,2>{0.895152509f, 0.265326053f},
-std::array<float,2>{0.0116646141f, 0.661932051f},
-std::array<float,2>{0.394376099f, 0.172558963f},
-std::array<float,2>{0.74273622f, 0.829434633f},
-std::array<float,2>{0.610833883f, 0.0143664386f},
-std::array<float,2>{0.318371445f, 0.931817651f},
-std::array<float,2>{0.199986085f, 0.484999776f},
-std::array<float,2>{0.769595683f, 0.618399858f},
-std::array<float,2>{0.657502651f, 0.385764003f},
-std::array<float,2>{0.463083982f, 0.53294456f},
-std::array<float,2>{0.0926479027f, 0.0975408107f},
-std::array<float,2>{0.938788235f, 0.991329491f},
-std::array<float,2>{0.870431542f, 0.214244217f},
-std::array<float,2>{0.144312859f, 0.802975297f},
-std::array<float,2>{0.288789421f, 0.365859181f},
-std::array<float,2>{0.538584888f, 0.694787145f},
-std::array<float,2>{0.809615076f, 0.456249952f},
-std::array<float,2>{0.247100979f, 0.588621438f},
-std::array<float,2>{0.357656449f, 0.05161798f},
-std::array<float,2>{0.582491755f, 0.901637912f},
-std::array<float,2>{0.695737541f, 0.148026079f},
-std::array<float,2>{0.42636025f, 0.845036685f},
-std::array<float,2>{0.0472894572f, 0.292909533f},
-std::array<float,2>{0.93475616f, 0.652973115f},
-std::array<float,2>{0.501423657f, 0.336641133f},
-std::array<float,2>{0.258295357f, 0.731229842f},
-std::array<float,2>{0.174151093f, 0.242541283f},
-std::array<float,2>{0.813070476f, 0.750526547f},
-std::array<float,2>{0.987746358f, 0.0841124132f},
-std::array<float,2>{0.12076994f, 0.952944219f},
-std::array<float,2>{0.473681897f, 0.422880292f},
-std::array<float,2>{0.655175149f, 0.508756042f},
-std::array<float,2>{0.956095636f, 0.419454813f},
-std::array<float,2>{0.0706517845f, 0.529191494f},
-std::array<float,2>{0.440835595f, 0.0723844916f},
-std::array<float,2>{0.672473133f, 0.959978819f},
-std::array<float,2>{0.549409389f, 0.219729394f},
-std::array<float,2>{0.307448f, 0.772284865f},
-std::array<float,2>{0.129161924f, 0.324243724f},
-std::array<float,2>{0.844023764f, 0.737371922f},
-std::array<float,2>{0.725589514f, 0.299259305f},
-std::array<float,2>{0.384847701f, 0.62661016f},
-std::array<float,2>{0.0282405037f, 0.12829639f},
-std::array<float,2>{0.885173619f, 0.866770446f},
-std::array<float,2>{0.763453007f, 0.0335149169f},
-std::array<float,2>{0.212487265f, 0.884159207f},
-std::array<float,2>{0.340659052f, 0.45239076f},
-std::array<float,2>{0.602202535f, 0.564516008f},
-std::array<float,2>{0.838528395f, 0.349741161f},
-std::array<float,2>{0.161001131f, 0.716331422f},
-std::array<float,2>{0.267644346f, 0.188794717f},
-std::array<float,2>{0.518183947f, 0.795595169f},
-std::array<float,2>{0.638384163f, 0.119141348f},
-std::array<float,2>{0.489770412f, 0.970910192f},
-std::array<float,2>{0.104166307f, 0.396256655f},
-std::array<float,2>{0.980836868f, 0.548311234f},
-std::array<float,2>{0.576157331f, 0.471670628f},
-std::array<float,2>{0.372180581f, 0.598440111f},
-std::array<float,2>{0.224336192f, 0.0227420647f},
-std::array<float,2>{0.785380423f, 0.917771876f},
-std::array<float,2>{0.920534372f, 0.158974379f},
-std::array<float,2>{0.0432370976f, 0.817579687f},
-std::array<float,2>{0.412323296f, 0.28032288f},
-std::array<float,2>{0.71516341f, 0.679190218f},
-std::array<float,2>{0.969150007f, 0.318239391f},
-std::array<float,2>{0.0990658477f, 0.742773473f},
-std::array<float,2>{0.499875396f, 0.231578737f},
-std::array<float,2>{0.626775742f, 0.773724079f},
-std::array<float,2>{0.527762234f, 0.0691172108f},
-std::array<float,2>{0.280359417f, 0.964574397f},
-std::array<float,2>{0.171849385f, 0.407000422f},
-std::array<float,2>{0.833643675f, 0.51919347f},
-std::array<float,2>{0.709375799f, 0.445173711f},
-std::array<float,2>{0.416907996f, 0.572331488f},
-std::array<float,2>{0.0356996655f, 0.0421640687f},
-std::array<float,2>{0.913389027f, 0.882015526f},
-std::array<float,2>{0.793466091f, 0.134976789f},
-std::array<float,2>{0.228260607f, 0.872147143f},
-std::array<float,2>{0.364417791f, 0.307615042f},
-std::array<float,2>{0.56759721f, 0.636406004f},
-std::array<float,2>{0.857638538f, 0.399657607f},
-std::array<float,2>{0.14035885f, 0.556838155f},
-std::array<float,2>{0.302324116f, 0.113870621f},
-std::array<float,2>{0.559631467f, 0.983053744f},
-std::array<float,2>{0.683098018f, 0.19691956f},
-std::array<float,2>{0.445372283f, 0.785485506f},
-std::array<float,2>{0.0640793294f, 0.357674211f},
-std::array<float,2>{0.968237162f, 0.710112333f},
-std::array<float,2>{0.595460832f, 0.269431382f},
-std::array<float,2>{0.334899157f, 0.682809174f},
-std::array<float,2>{0.210703418f, 0.17071645f},
-std::array<float,2>{0.750160635f, 0.823981881f},
-std::array<float,2>{0.876838267f, 0.0270252656f},
-std::array<float,2>{0.0233410485f, 0.908069193f},
-std::array<float,2>{0.37648955f, 0.481559902f},
-std::array<float,2>{0.732056618f, 0.605025113f},
-std::array<float,2>{0.925620735f, 0.493835956f},
-std::array<float,2>{0.0587735213f, 0.60984087f},
-std::array<float,2>{0.436121941f, 0.000522781804f},
-std::array<float,2>{0.691386223f, 0.927017927f},
-std::array<float,2>{0.586438894f, 0.180511072f},
-std::array<float,2>{0.345830858f, 0.837098002f},
-std::array<float,2>{0.239067897f, 0.252057821f},
-std::array<float,2>{0.804241538f, 0.670012176f},
-std::array<float,2>{0.645249903f, 0.368117899f},
-std::array<float,2>{0.477949023f, 0.702687263f},
-std::array<float,2>{0.113572687f, 0.208869591f},
-std::array<float,2>{0.995870709f, 0.80558759f},
-std::array<float,2>{0.824982584f, 0.108413339f},
-std::array<float,2>{0.181112543f, 0.99712652f},
-std::array<float,2>{0.25000912f, 0.377671152f},
-std::array<float,2>{0.514469385f, 0.540827274f},
-std::array<float,2>{0.774962008f, 0.284735471f},
-std::array<float,2>{0.190985024f, 0.641720891f},
-std::array<float,2>{0.322512776f, 0.149260879f},
-std::array<float,2>{0.621571481f, 0.852592587f},
-std::array<float,2>{0.739465117f, 0.056478899f},
-std::array<float,2>{0.399280459f, 0.891369998f},
-std::array<float,2>{0.000893010234f, 0.464193344f},
-std::array<float,2>{0.901781917f, 0.585597217f},
-std::array<float,2>{0.540159941f, 0.430252045f},
-std::array<float,2>{0.293446749f, 0.506561458f},
-std::array<float,2>{0.152170241f, 0.0893218666f},
-std::array<float,2>{0.865173519f, 0.937866569f},
-std::array<float,2>{0.951688468f, 0.238818362f},
-std::array<float,2>{0.08128272f, 0.763861179f},
-std::array<float,2>{0.454872817f, 0.329727083f},
-std::array<float,2>{0.670729756f, 0.725191474f},
-std::array<float,2>{0.943525195f, 0.311584055f},
-std::array<float,2>{0.0865491703f, 0.640459239f},
-std::array<float,2>{0.465370089f, 0.137158722f},
-std::array<float,2>{0.662567556f, 0.87016803f},
-std::array<float,2>{0.53277868f, 0.0450083502f},
-std::array<float,2>{0.284327507f, 0.876684725f},
-std::array<float,2>{0.146045968f, 0.438103467f},
-std::array<float,2>{0.87128067f, 0.574529111f},
-std::array<float,2>{0.748226941f, 0.413344055f},
-std::array<float,2>{0.397549093f, 0.520160675f},
-std::array<float,2>{0.0136766946f, 0.0630000532f},
-std::array<float,2>{0.891079605f, 0.966692984f},
-std::array<float,2>{0.768584669f, 0.228764415f},
-std::array<float,2>{0.197462246f, 0.778829813f},
-std::array<float,2>{0.315513194f, 0.313165694f},
-std::array<float,2>{0.615145802f, 0.746532083f},
-std::array<float,2>{0.818169296f, 0.478894532f},
-std::array<float,2>{0.176186979f, 0.607213795f},
-std::array<float,2>{0.265314996f, 0.0277399309f},
-std::array<float,2>{0.505952179f, 0.913998246f},
-std::array<float,2>{0.648709595f, 0.166217834f},
-std::array<float,2>{0.469389707f, 0.825252116f},
-std::array<float,2>{0.122629777f, 0.272951245f},
-std::array<float,2>{0.990552366f, 0.685525298f},
-std::array<float,2>{0.580296159f, 0.354348212f},
-std::array<float,2>{0.354886502f, 0.706497967f},
-std::array<float,2>{0.244192868f, 0.203084767f},
-std::array<float,2>{0.807088077f, 0.783160985f},
-std::array<float,2>{0.931658506f, 0.110207453f},
-std::array<float,2>{0.0511419661f, 0.9779616f},
-std::array<float,2>{0.423855931f, 0.405361474f},
-std::array<float,2>{0.701262534f, 0.562498689f},
-std::array<float,2>{0.888113439f, 0.38135314f},
-std::array<float,2>{0.0258033331f, 0.544187665f},
-std::array<float,2>{0.390524685f, 0.101744108f},
-std::array<float,2>{0.722052455f, 0.995220602f},
-std::array<float,2>{0.609143794f, 0.20433791f},
-std::array<float,2>{0.339017212f, 0.809972227f},
-std::array<float,2>{0.218459919f, 0.374792755f},
-std::array<float,2>{0.75876838f, 0.697050691f},
-std::array<float,2>{0.676352084f, 0.256893098f},
-std::array<float,2>{0.444049001f, 0.665311873f},
-std::array<float,2>{0.0767227411f, 0.186427787f},
-std::array<float,2>{0.957249105f, 0.841886878f},
-std::array<float,2>{0.848800957f, 0.00697371969f},
-std::array<float,2>{0.126253039f, 0.92490232f},
-std::array<float,2>{0.31040585f, 0.499426454f},
-std::array<float,2>{0.553454697f, 0.615335226f},
-std::array<float,2>{0.782184839f, 0.335936815f},
-std::array<float,2>{0.222093537f, 0.722293496f},
-std::array<float,2>{0.369627059f, 0.237262338f},
-std::array<float,2>{0.573778093f, 0.758270025f},
-std::array<float,2>{0.71102041f, 0.093351312f},
-std::array<float,2>{0.406853348f, 0.943917871f},
-std::array<float,2>{0.0416774489f, 0.435842723f},
-std::array<float,2>{0.917438447f, 0.500417948f},
-std::array<float,2>{0.520434678f, 0.465953737f},
-std::array<float,2>{0.272754043f, 0.578621626f},
-std::array<float,2>{0.158905983f, 0.062211737f},
-std::array<float,2>{0.83991307f, 0.896360397f},
-std::array<float,2>{0.978075027f, 0.153873578f},
-std::array<float,2>{0.106597006f, 0.858389974f},
-std::array<float,2>{0.484714478f, 0.288990974f},
-std::array<float,2>{0.635411739f, 0.648329973f},
-std::array<float,2>{0.906835437f, 0.361882776f},
-std::array<float,2>{0.0337794647f, 0.690116823f},
-std::array<float,2>{0.421635598f, 0.217999324f},
-std::array<float,2>{0.705266535f, 0.798398376f},
-std::array<float,2>{0.562779188f, 0.0985330418f},
-std::array<float,2>{0.359796077f, 0.987646639f},
-std::array<float,2>{0.23158364f, 0.388841867f},
-std::array<float,2>{0.792781115f, 0.535860837f},
-std::array<float,2>{0.632343411f, 0.491434127f},
-std::array<float,2>{0.492964625f, 0.62442857f},
-std::array<float,2>{0.0966154039f, 0.00945981406f},
-std::array<float,2>{0.974997997f, 0.935772479f},
-std::array<float,2>{0.828762591f, 0.177922383f},
-std::array<float,2>{0.167624772f, 0.833386064f},
-std::array<float,2>{0.275922537f, 0.260139018f},
-std::array<float,2>{0.525530815f, 0.659656763f},
-std::array<float,2>{0.757248163f, 0.427141607f},
-std::array<float,2>{0.205788195f, 0.513709426f},
-std::array<float,2>{0.330053002f, 0.0794103742f},
-std::array<float,2>{0.597936809f, 0.946126938f},
-std::array<float,2>{0.730061591f, 0.248743266f},
-std::array<float,2>{0.37895897f, 0.75450182f},
-std::array<float,2>{0.0177596547f, 0.34157294f},
-std::array<float,2>{0.880167186f, 0.727252364f},
-std::array<float,2>{0.557812631f, 0.296301603f},
-std::array<float,2>{0.298372269f, 0.648686707f},
-std::array<float,2>{0.132938892f, 0.14163132f},
-std::array<float,2>{0.855156004f, 0.849556625f},
-std::array<float,2>{0.961944997f, 0.0471429154f},
-std::array<float,2>{0.0694573969f, 0.906032681f},
-std::array<float,2>{0.449347049f, 0.459421456f},
-std::array<float,2>{0.686080039f, 0.591148198f},
-std::array<float,2>{0.996269464f, 0.449123412f},
-std::array<float,2>{0.111172587f, 0.570107996f},
-std::array<float,2>{0.482137799f, 0.0383841693f},
-std::array<float,2>{0.641617417f, 0.88917464f},
-std::array<float,2>{0.508211613f, 0.130523771f},
-std::array<float,2>{0.25496009f, 0.862200916f},
-std::array<float,2>{0.186269328f, 0.301906437f},
-std::array<float,2>{0.823254347f, 0.629517317f},
-std::array<float,2>{0.694449902f, 0.323138267f},
-std::array<float,2>{0.429746896f, 0.740659237f},
-std::array<float,2>{0.0550136566f, 0.223399311f},
-std::array<float,2>{0.926197052f, 0.767132461f},
-std::array<float,2>{0.799633205f, 0.077034913f},
-std::array<float,2>{0.237812266f, 0.956550777f},
-std::array<float,2>{0.350230157f, 0.414786369f},
-std::array<float,2>{0.590539515f, 0.523540378f},
-std::array<float,2>{0.861551821f, 0.275184721f},
-std::array<float,2>{0.153295904f, 0.672336876f},
-std::array<float,2>{0.290659487f, 0.16321142f},
-std::array<float,2>{0.544344068f, 0.814371586f},
-std::array<float,2>{0.665175319f, 0.018546313f},
-std::array<float,2>{0.45947206f, 0.920194983f},
-std::array<float,2>{0.0851709396f, 0.473332822f},
-std::array<float,2>{0.948901832f, 0.597458899f},
-std::array<float,2>{0.621014953f, 0.39215076f},
-std::array<float,2>{0.327708721f, 0.554263294f},
-std::array<float,2>{0.193158776f, 0.122719638f},
-std::array<float,2>{0.779292226f, 0.97473532f},
-std::array<float,2>{0.904892504f, 0.194555238f},
-std::array<float,2>{0.006015277f, 0.79133296f},
-std::array<float,2>{0.403345257f, 0.344176859f},
-std::array<float,2>{0.736320555f, 0.714800119f},
-std::array<float,2>{0.93688339f, 0.290363133f},
-std::array<float,2>{0.0496311486f, 0.655221462f},
-std::array<float,2>{0.428149402f, 0.145689428f},
-std::array<float,2>{0.698845387f, 0.84645927f},
-std::array<float,2>{0.585261643f, 0.0528021082f},
-std::array<float,2>{0.356441587f, 0.898678958f},
-std::array<float,2>{0.248554409f, 0.454336673f},
-std::array<float,2>{0.811624229f, 0.586476147f},
-std::array<float,2>{0.653639972f, 0.425756812f},
-std::array<float,2>{0.476231664f, 0.510988533f},
-std::array<float,2>{0.118760608f, 0.0827371329f},
-std::array<float,2>{0.984794319f, 0.949424326f},
-std::array<float,2>{0.815062404f, 0.244281456f},
-std::array<float,2>{0.171940908f, 0.753464937f},
-std::array<float,2>{0.260792017f, 0.338682503f},
-std::array<float,2>{0.503254473f, 0.732908726f},
-std::array<float,2>{0.771553695f, 0.487518251f},
-std::array<float,2>{0.201953247f, 0.620951474f},
-std::array<float,2>{0.317621291f, 0.0122430697f},
-std::array<float,2>{0.612228036f, 0.929720402f},
-std::array<float,2>{0.744221032f, 0.17492573f},
-std::array<float,2>{0.392258286f, 0.831361234f},
-std::array<float,2>{0.00958684832f, 0.263050139f},
-std::array<float,2>{0.898400068f, 0.662148356f},
-std::array<float,2>{0.535796225f, 0.363770157f},
-std::array<float,2>{0.286942452f, 0.691769004f},
-std::array<float,2>{0.142261833f, 0.212473094f},
-std::array<float,2>{0.868387043f, 0.800971687f},
-std::array<float,2>{0.940520763f, 0.0946574956f},
-std::array<float,2>{0.0904244483f, 0.988758326f},
-std::array<float,2>{0.461262286f, 0.383987695f},
-std::array<float,2>{0.658914685f, 0.533456445f},
-std::array<float,2>{0.982822895f, 0.397197902f},
-std::array<float,2>{0.102833882f, 0.549872518f},
-std::array<float,2>{0.491866529f, 0.117272593f},
-std::array<float,2>{0.63896507f, 0.970600009f},
-std::array<float,2>{0.516839743f, 0.19057627f},
-std::array<float,2>{0.266110957f, 0.79401058f},
-std::array<float,2>{0.163131043f, 0.34777683f},
-std::array<float,2>{0.837665677f, 0.71834749f},
-std::array<float,2>{0.717527747f, 0.27888447f},
-std::array<float,2>{0.411243469f, 0.675980926f},
-std::array<float,2>{0.0461727642f, 0.156565711f},
-std::array<float,2>{0.919163108f, 0.819440663f},
-std::array<float,2>{0.78721714f, 0.0214733053f},
-std::array<float,2>{0.225981936f, 0.914479792f},
-std::array<float,2>{0.373737097f, 0.470635712f},
-std::array<float,2>{0.57655859f, 0.601209283f},
-std::array<float,2>{0.84677577f, 0.327345639f},
-std::array<float,2>{0.13260819f, 0.735573232f},
-std::array<float,2>{0.305252552f, 0.221194014f},
-std::array<float,2>{0.547591805f, 0.771392763f},
-std::array<float,2>{0.673909247f, 0.0708507523f},
-std::array<float,2>{0.438315421f, 0.957117081f},
-std::array<float,2>{0.0738752559f, 0.421608865f},
-std::array<float,2>{0.953244567f, 0.529770494f},
-std::array<float,2>{0.603822112f, 0.451044887f},
-std::array<float,2>{0.343356252f, 0.562992036f},
-std::array<float,2>{0.213185072f, 0.0322017856f},
-std::array<float,2>{0.76474756f, 0.885448515f},
-std::array<float,2>{0.883809447f, 0.126893282f},
-std::array<float,2>{0.0305605102f, 0.863585413f},
-std::array<float,2>{0.384589314f, 0.297421187f},
-std::array<float,2>{0.72283262f, 0.628778458f},
-std::array<float,2>{0.965934217f, 0.356893837f},
-std::array<float,2>{0.0654302314f, 0.707668364f},
-std::array<float,2>{0.449115276f, 0.198632613f},
-std::array<float,2>{0.680442214f, 0.787545323f},
-std::array<float,2>{0.562334538f, 0.116196044f},
-std::array<float,2>{0.303473204f, 0.981869578f},
-std::array<float,2>{0.137254342f, 0.401216328f},
-std::array<float,2>{0.856344461f, 0.556483924f},
-std::array<float,2>{0.734157562f, 0.483694464f},
-std::array<float,2>{0.378837943f, 0.601877987f},
-std::array<float,2>{0.0206834506f, 0.0249731969f},
-std::array<float,2>{0.87827009f, 0.908971906f},
-std::array<float,2>{0.752786338f, 0.168181762f},
-std::array<float,2>{0.208015531f, 0.820797861f},
-std::array<float,2>{0.332223982f, 0.266974002f},
-std::array<float,2>{0.597339332f, 0.681006372f},
-std::array<float,2>{0.834872246f, 0.40980202f},
-std::array<float,2>{0.169418857f, 0.516661704f},
-std::array<float,2>{0.279236495f, 0.0671739206f},
-std::array<float,2>{0.529849172f, 0.962196827f},
-std::array<float,2>{0.62843895f, 0.232449412f},
-std::array<float,2>{0.497683614f, 0.775419474f},
-std::array<float,2>{0.101087742f, 0.319887042f},
-std::array<float,2>{0.971679211f, 0.744342387f},
-std::array<float,2>{0.568717837f, 0.304876268f},
-std::array<float,2>{0.366287082f, 0.633140981f},
-std::array<float,2>{0.228581578f, 0.133469954f},
-std::array<float,2>{0.796155512f, 0.873431504f},
-std::array<float,2>{0.911316395f, 0.0400761478f},
-std::array<float,2>{0.0383628011f, 0.879929185f},
-std::array<float,2>{0.41563502f, 0.441972047f},
-std::array<float,2>{0.707327902f, 0.571588039f},
-std::array<float,2>{0.899696767f, 0.462696642f},
-std::array<float,2>{0.00266156695f, 0.583871901f},
-std::array<float,2>{0.400518239f, 0.0581356734f},
-std::array<float,2>{0.741486549f, 0.893090546f},
-std::array<float,2>{0.623511791f, 0.151390791f},
-std::array<float,2>{0.322258025f, 0.855115652f},
-std::array<float,2>{0.188452348f, 0.281842083f},
-std::array<float,2>{0.776978433f, 0.643280745f},
-std::array<float,2>{0.66827774f, 0.330836058f},
-std::array<float,2>{0.456967294f, 0.723136425f},
-std::array<float,2>{0.0786985084f, 0.241262361f},
-std::array<float,2>{0.9506495f, 0.761767805f},
-std::array<float,2>{0.867144883f, 0.0877844691f},
-std::array<float,2>{0.149163932f, 0.940380692f},
-std::array<float,2>{0.295033246f, 0.432505906f},
-std::array<float,2>{0.541879833f, 0.505224705f},
-std::array<float,2>{0.801396608f, 0.251049966f},
-std::array<float,2>{0.241218761f, 0.668333352f},
-std::array<float,2>{0.344795197f, 0.183149889f},
-std::array<float,2>{0.587968767f, 0.838219523f},
-std::array<float,2>{0.688950956f, 0.00311944494f},
-std::array<float,2>{0.435460091f, 0.928178787f},
-std::array<float,2>{0.0614237674f, 0.495432556f},
-std::array<float,2>{0.923643649f, 0.612711489f},
-std::array<float,2>{0.51320684f, 0.376029432f},
-std::array<float,2>{0.253697991f, 0.54203862f},
-std::array<float,2>{0.182420611f, 0.105689131f},
-std::array<float,2>{0.826189876f, 0.998853207f},
-std::array<float,2>{0.993359745f, 0.210843965f},
-std::array<float,2>{0.116264753f, 0.808339655f},
-std::array<float,2>{0.480410635f, 0.369527012f},
-std::array<float,2>{0.647399545f, 0.700741351f},
-std::array<float,2>{0.989261568f, 0.27106598f},
-std::array<float,2>{0.123093687f, 0.686569929f},
-std::array<float,2>{0.471193075f, 0.165695325f},
-std::array<float,2>{0.650707066f, 0.826911092f},
-std::array<float,2>{0.504055083f, 0.0296548028f},
-std::array<float,2>{0.263656795f, 0.911420643f},
-std::array<float,2>{0.178976595f, 0.477992594f},
-std::array<float,2>{0.820184886f, 0.608957708f},
-std::array<float,2>{0.700766683f, 0.402452409f},
-std::array<float,2>{0.422595799f, 0.559181988f},
-std::array<float,2>{0.0529717356f, 0.112590097f},
-std::array<float,2>{0.931028426f, 0.97895509f},
-std::array<float,2>{0.805039704f, 0.200906605f},
-std::array<float,2>{0.243008196f, 0.784458697f},
-std::array<float,2>{0.353209019f, 0.353372037f},
-std::array<float,2>{0.579028428f, 0.703412473f},
-std::array<float,2>{0.873904705f, 0.440683633f},
-std::array<float,2>{0.146657109f, 0.577163875f},
-std::array<float,2>{0.281840056f, 0.0441274531f},
-std::array<float,2>{0.535044849f, 0.877105117f},
-std::array<float,2>{0.660292864f, 0.139722705f},
-std::array<float,2>{0.467770219f, 0.868439138f},
-std::array<float,2>{0.0896789283f, 0.30979836f},
-std::array<float,2>{0.941838086f, 0.638478816f},
-std::array<float,2>{0.616198003f, 0.315394819f},
-std::array<float,2>{0.314033359f, 0.748553336f},
-std::array<float,2>{0.19560577f, 0.227412477f},
-std::array<float,2>{0.766207635f, 0.779448748f},
-std::array<float,2>{0.893057287f, 0.0648178756f},
-std::array<float,2>{0.0117609324f, 0.967452586f},
-std::array<float,2>{0.394976467f, 0.410272539f},
-std::array<float,2>{0.74662596f, 0.521971107f},
-std::array<float,2>{0.914757907f, 0.434492767f},
-std::array<float,2>{0.0402405187f, 0.502082407f},
-std::array<float,2>{0.409136057f, 0.090248473f},
-std::array<float,2>{0.71356982f, 0.94270277f},
-std::array<float,2>{0.572208464f, 0.235238746f},
-std::array<float,2>{0.367639899f, 0.760526836f},
-std::array<float,2>{0.219722986f, 0.333359212f},
-std::array<float,2>{0.784282446f, 0.719932973f},
-std::array<float,2>{0.632993162f, 0.285533309f},
-std::array<float,2>{0.487953931f, 0.645749032f},
-std::array<float,2>{0.107998393f, 0.154441327f},
-std::array<float,2>{0.979029596f, 0.857281923f},
-std::array<float,2>{0.843011677f, 0.0598041825f},
-std::array<float,2>{0.157764286f, 0.8973248f},
-std::array<float,2>{0.270647615f, 0.466907233f},
-std::array<float,2>{0.522121608f, 0.581872106f},
-std::array<float,2>{0.761700213f, 0.372029543f},
-std::array<float,2>{0.215440959f, 0.697893083f},
-std::array<float,2>{0.337741464f, 0.206757396f},
-std::array<float,2>{0.607095063f, 0.81245935f},
-std::array<float,2>{0.718843222f, 0.104708567f},
-std::array<float,2>{0.388156295f, 0.993436396f},
-std::array<float,2>{0.0239917655f, 0.380099177f},
-std::array<float,2>{0.889360189f, 0.54619509f},
-std::array<float,2>{0.552027106f, 0.496121943f},
-std::array<float,2>{0.311723441f, 0.614112973f},
-std::array<float,2>{0.128796473f, 0.00408779038f},
-std::array<float,2>{0.851231813f, 0.922553241f},
-std::array<float,2>{0.959273577f, 0.185126841f},
-std::array<float,2>{0.0742718428f, 0.841776073f},
-std::array<float,2>{0.442209661f, 0.254942238f},
-std::array<float,2>{0.677948475f, 0.666833282f},
-std::array<float,2>{0.881274283f, 0.342619121f},
-std::array<float,2>{0.0166096147f, 0.728616297f},
-std::array<float,2>{0.381176591f, 0.246744588f},
-std::array<float,2>{0.726972699f, 0.757678032f},
-std::array<float,2>{0.600812256f, 0.0813552514f},
-std::array<float,2>{0.330229253f, 0.94912523f},
-std::array<float,2>{0.20362182f, 0.428956121f},
-std::array<float,2>{0.754925489f, 0.512924612f},
-std::array<float,2>{0.68465203f, 0.457813412f},
-std::array<float,2>{0.451918662f, 0.593224466f},
-std::array<float,2>{0.0678955317f, 0.0491187163f},
-std::array<float,2>{0.964407921f, 0.903560102f},
-std::array<float,2>{0.851809502f, 0.143209666f},
-std::array<float,2>{0.136354387f, 0.85126698f},
-std::array<float,2>{0.299056023f, 0.293260753f},
-std::array<float,2>{0.556592464f, 0.650729537f},
-std::array<float,2>{0.789265692f, 0.387041032f},
-std::array<float,2>{0.233791769f, 0.538030624f},
-std::array<float,2>{0.362348169f, 0.0996662974f},
-std::array<float,2>{0.564925432f, 0.984856904f},
-std::array<float,2>{0.703631759f, 0.214890689f},
-std::array<float,2>{0.419433415f, 0.800572753f},
-std::array<float,2>{0.0315239094f, 0.360457331f},
-std::array<float,2>{0.909534276f, 0.688078463f},
-std::array<float,2>{0.524410427f, 0.258586228f},
-std::array<float,2>{0.274735451f, 0.657882333f},
-std::array<float,2>{0.165603727f, 0.177559331f},
-std::array<float,2>{0.831972718f, 0.834785759f},
-std::array<float,2>{0.973389149f, 0.00991665013f},
-std::array<float,2>{0.0947578847f, 0.934718132f},
-std::array<float,2>{0.494407982f, 0.48896575f},
-std::array<float,2>{0.629458249f, 0.622753918f},
-std::array<float,2>{0.946126342f, 0.476407498f},
-std::array<float,2>{0.0829608366f, 0.594375432f},
-std::array<float,2>{0.457492858f, 0.0162531547f},
-std::array<float,2>{0.666233122f, 0.918453693f},
-std::array<float,2>{0.546297908f, 0.161349967f},
-std::array<float,2>{0.292427003f, 0.815132022f},
-std::array<float,2>{0.154363453f, 0.276713431f},
-std::array<float,2>{0.860479653f, 0.674935877f},
-std::array<float,2>{0.737744033f, 0.345790207f},
-std::array<float,2>{0.404575467f, 0.711424351f},
-std::array<float,2>{0.005633133f, 0.192878738f},
-std::array<float,2>{0.904291451f, 0.789195776f},
-std::array<float,2>{0.780159533f, 0.124982141f},
-std::array<float,2>{0.194127858f, 0.973495305f},
-std::array<float,2>{0.325909734f, 0.393008262f},
-std::array<float,2>{0.618034661f, 0.551405549f},
-std::array<float,2>{0.820561111f, 0.302818269f},
-std::array<float,2>{0.184810832f, 0.632216513f},
-std::array<float,2>{0.256172508f, 0.13263163f},
-std::array<float,2>{0.510555267f, 0.860669971f},
-std::array<float,2>{0.643450916f, 0.0356391743f},
-std::array<float,2>{0.48316139f, 0.888178468f},
-std::array<float,2>{0.111801699f, 0.445661128f},
-std::array<float,2>{0.999857903f, 0.566671908f},
-std::array<float,2>{0.592003942f, 0.416650176f},
-std::array<float,2>{0.348656952f, 0.526345432f},
-std::array<float,2>{0.236017272f, 0.0753024518f},
-std::array<float,2>{0.797456861f, 0.954923213f},
-std::array<float,2>{0.928991139f, 0.225380436f},
-std::array<float,2>{0.0574378669f, 0.769491792f},
-std::array<float,2>{0.431915402f, 0.321034342f},
-std::array<float,2>{0.692559242f, 0.738636017f},
-std::array<float,2>{0.918643236f, 0.280069858f},
-std::array<float,2>{0.045864556f, 0.677877903f},
-std::array<float,2>{0.411000133f, 0.159983918f},
-std::array<float,2>{0.718737602f, 0.816963971f},
-std::array<float,2>{0.577747822f, 0.0214879867f},
-std::array<float,2>{0.374742538f, 0.916410208f},
-std::array<float,2>{0.225043923f, 0.472435296f},
-std::array<float,2>{0.788285077f, 0.599277318f},
-std::array<float,2>{0.63974148f, 0.395405173f},
-std::array<float,2>{0.490999669f, 0.546957254f},
-std::array<float,2>{0.102144003f, 0.120339774f},
-std::array<float,2>{0.983410001f, 0.972052515f},
-std::array<float,2>{0.836117923f, 0.187945604f},
-std::array<float,2>{0.162184089f, 0.79638207f},
-std::array<float,2>{0.26730606f, 0.350839496f},
-std::array<float,2>{0.516414642f, 0.715430617f},
-std::array<float,2>{0.76445049f, 0.451396376f},
-std::array<float,2>{0.214379609f, 0.566029608f},
-std::array<float,2>{0.342526197f, 0.03469906f},
-std::array<float,2>{0.604754746f, 0.883358836f},
-std::array<float,2>{0.724338591f, 0.12763451f},
-std::array<float,2>{0.383218199f, 0.865238965f},
-std::array<float,2>{0.0293704867f, 0.30071491f},
-std::array<float,2>{0.883502841f, 0.625616133f},
-std::array<float,2>{0.548388064f, 0.325399399f},
-std::array<float,2>{0.306104094f, 0.736690581f},
-std::array<float,2>{0.131639779f, 0.218982011f},
-std::array<float,2>{0.845705867f, 0.7726354f},
-std::array<float,2>{0.954732835f, 0.0738268346f},
-std::array<float,2>{0.0728530362f, 0.959214509f},
-std::array<float,2>{0.439307958f, 0.418293595f},
-std::array<float,2>{0.675726056f, 0.527899265f},
-std::array<float,2>{0.985997617f, 0.422825336f},
-std::array<float,2>{0.117364019f, 0.508902669f},
-std::array<float,2>{0.475201309f, 0.0856715888f},
-std::array<float,2>{0.652581275f, 0.951180995f},
-std::array<float,2>{0.502502143f, 0.24363175f},
-std::array<float,2>{0.260117471f, 0.75188154f},
-std::array<float,2>{0.173128113f, 0.337870032f},
-std::array<float,2>{0.816336513f, 0.732246459f},
-std::array<float,2>{0.697793007f, 0.291510522f},
-std::array<float,2>{0.428849071f, 0.654156029f},
-std::array<float,2>{0.0502005294f, 0.146900252f},
-std::array<float,2>{0.936023831f, 0.844470143f},
-std::array<float,2>{0.811465919f, 0.0519352145f},
-std::array<float,2>{0.249200836f, 0.900567174f},
-std::array<float,2>{0.356954962f, 0.455405921f},
-std::array<float,2>{0.584275901f, 0.589070797f},
-std::array<float,2>{0.867797375f, 0.366868049f},
-std::array<float,2>{0.141055733f, 0.693655014f},
-std::array<float,2>{0.285940111f, 0.21326071f},
-std::array<float,2>{0.536288261f, 0.803960741f},
-std::array<float,2>{0.660005212f, 0.0957168192f},
-std::array<float,2>{0.462731808f, 0.991039693f},
-std::array<float,2>{0.0914731771f, 0.385092616f},
-std::array<float,2>{0.939583302f, 0.531314731f},
-std::array<float,2>{0.612982571f, 0.486086637f},
-std::array<float,2>{0.31735006f, 0.617945015f},
-std::array<float,2>{0.202206627f, 0.0147982258f},
-std::array<float,2>{0.773397326f, 0.932789922f},
-std::array<float,2>{0.896959066f, 0.173596665f},
-std::array<float,2>{0.00863999501f, 0.828648925f},
-std::array<float,2>{0.391356945f, 0.264215738f},
-std::array<float,2>{0.745518923f, 0.660378098f},
-std::array<float,2>{0.949521422f, 0.328577071f},
-std::array<float,2>{0.0793603733f, 0.725704193f},
-std::array<float,2>{0.455721885f, 0.239872232f},
-std::array<float,2>{0.668949664f, 0.76510483f},
-std::array<float,2>{0.542559087f, 0.0879782662f},
-std::array<float,2>{0.296416879f, 0.939206421f},
-std::array<float,2>{0.150005952f, 0.430865824f},
-std::array<float,2>{0.865347087f, 0.507768989f},
-std::array<float,2>{0.74024117f, 0.463266999f},
-std::array<float,2>{0.402238846f, 0.584688962f},
-std::array<float,2>{0.00380176026f, 0.0552254543f},
-std::array<float,2>{0.898718417f, 0.89218843f},
-std::array<float,2>{0.776342869f, 0.149645329f},
-std::array<float,2>{0.188956454f, 0.851849437f},
-std::array<float,2>{0.321288288f, 0.283261925f},
-std::array<float,2>{0.624869943f, 0.64133364f},
-std::array<float,2>{0.827171683f, 0.378205776f},
-std::array<float,2>{0.18356289f, 0.539410412f},
-std::array<float,2>{0.252224684f, 0.108015917f},
-std::array<float,2>{0.512694716f, 0.99692136f},
-std::array<float,2>{0.648124576f, 0.207559526f},
-std::array<float,2>{0.479456753f, 0.806219339f},
-std::array<float,2>{0.115911417f, 0.368356526f},
-std::array<float,2>{0.992411077f, 0.702051699f},
-std::array<float,2>{0.589795232f, 0.253796577f},
-std::array<float,2>{0.344566345f, 0.671013117f},
-std::array<float,2>{0.240956187f, 0.181473404f},
-std::array<float,2>{0.80232501f, 0.8369084f},
-std::array<float,2>{0.922085524f, 0.00155486527f},
-std::array<float,2>{0.0619698241f, 0.925831497f},
-std::array<float,2>{0.434064597f, 0.492403954f},
-std::array<float,2>{0.687555432f, 0.61042273f},
-std::array<float,2>{0.877553642f, 0.480973512f},
-std::array<float,2>{0.0199396536f, 0.603755653f},
-std::array<float,2>{0.37697956f, 0.026329428f},
-std::array<float,2>{0.732600689f, 0.906816542f},
-std::array<float,2>{0.596132934f, 0.170985907f},
-std::array<float,2>{0.333723068f, 0.82261616f},
-std::array<float,2>{0.207637534f, 0.267614931f},
-std::array<float,2>{0.753424764f, 0.682383299f},
-std::array<float,2>{0.681141675f, 0.358821511f},
-std::array<float,2>{0.447564811f, 0.709211171f},
-std::array<float,2>{0.0647571608f, 0.196265981f},
-std::array<float,2>{0.965563953f, 0.786997855f},
-std::array<float,2>{0.856774867f, 0.114811778f},
-std::array<float,2>{0.138292536f, 0.983540833f},
-std::array<float,2>{0.304320246f, 0.398839653f},
-std::array<float,2>{0.561025441f, 0.557882309f},
-std::array<float,2>{0.79588294f, 0.308142394f},
-std::array<float,2>{0.230159581f, 0.635014236f},
-std::array<float,2>{0.365400434f, 0.136389881f},
-std::array<float,2>{0.570115745f, 0.87200284f},
-std::array<float,2>{0.708629191f, 0.0416581966f},
-std::array<float,2>{0.414124161f, 0.881294668f},
-std::array<float,2>{0.0379443541f, 0.443400502f},
-std::array<float,2>{0.911006868f, 0.57390064f},
-std::array<float,2>{0.530460417f, 0.407918066f},
-std::array<float,2>{0.277890354f, 0.51803869f},
-std::array<float,2>{0.168517247f, 0.069469586f},
-std::array<float,2>{0.835881829f, 0.963857532f},
-std::array<float,2>{0.972333252f, 0.230851129f},
-std::array<float,2>{0.0997954458f, 0.774619102f},
-std::array<float,2>{0.496481359f, 0.31731832f},
-std::array<float,2>{0.627629101f, 0.743401825f},
-std::array<float,2>{0.979789257f, 0.287528068f},
-std::array<float,2>{0.108588479f, 0.646578491f},
-std::array<float,2>{0.486606985f, 0.152349561f},
-std::array<float,2>{0.634061277f, 0.858793557f},
-std::array<float,2>{0.523385346f, 0.0605510734f},
-std::array<float,2>{0.270231277f, 0.894793093f},
-std::array<float,2>{0.156957567f, 0.465054005f},
-std::array<float,2>{0.84272486f, 0.579709828f},
-std::array<float,2>{0.714500666f, 0.437195361f},
-std::array<float,2>{0.410155267f, 0.501439273f},
-std::array<float,2>{0.0398449413f, 0.0923319012f},
-std::array<float,2>{0.915320694f, 0.944447637f},
-std::array<float,2>{0.78342557f, 0.237365022f},
-std::array<float,2>{0.219788432f, 0.759268284f},
-std::array<float,2>{0.368532419f, 0.334745258f},
-std::array<float,2>{0.571287394f, 0.721516252f},
-std::array<float,2>{0.849647999f, 0.498420686f},
-std::array<float,2>{0.12733224f, 0.616549432f},
-std::array<float,2>{0.311144829f, 0.00609786576f},
-std::array<float,2>{0.551444948f, 0.923992932f},
-std::array<float,2>{0.678755522f, 0.186812297f},
-std::array<float,2>{0.442844689f, 0.843277633f},
-std::array<float,2>{0.0758201703f, 0.256101489f},
-std::array<float,2>{0.960771203f, 0.664883971f},
-std::array<float,2>{0.60558635f, 0.373321772f},
-std::array<float,2>{0.336709052f, 0.695806146f},
-std::array<float,2>{0.216150105f, 0.203984052f},
-std::array<float,2>{0.760693848f, 0.809240282f},
-std::array<float,2>{0.890128672f, 0.102988519f},
-std::array<float,2>{0.0246601943f, 0.994623005f},
-std::array<float,2>{0.386785895f, 0.382482886f},
-std::array<float,2>{0.720041275f, 0.543857992f},
-std::array<float,2>{0.930160642f, 0.404677689f},
-std::array<float,2>{0.0542332605f, 0.561231434f},
-std::array<float,2>{0.422898233f, 0.110811144f},
-std::array<float,2>{0.699765503f, 0.976626813f},
-std::array<float,2>{0.579995871f, 0.201586768f},
-std::array<float,2>{0.351745874f, 0.781320632f},
-std::array<float,2>{0.243419588f, 0.355037451f},
-std::array<float,2>{0.806332886f, 0.705126226f},
-std::array<float,2>{0.651413441f, 0.272165269f},
-std::array<float,2>{0.472464889f, 0.684443176f},
-std::array<float,2>{0.124557368f, 0.16728206f},
-std::array<float,2>{0.988911986f, 0.825128675f},
-std::array<float,2>{0.818548381f, 0.0289732814f},
-std::array<float,2>{0.177746952f, 0.912972033f},
-std::array<float,2>{0.261727333f, 0.479709148f},
-std::array<float,2>{0.505842984f, 0.605978489f},
-std::array<float,2>{0.766676843f, 0.313964605f},
-std::array<float,2>{0.19659476f, 0.747570574f},
-std::array<float,2>{0.312663525f, 0.230116755f},
-std::array<float,2>{0.61667639f, 0.777842522f},
-std::array<float,2>{0.748019278f, 0.0636842847f},
-std::array<float,2>{0.395799309f, 0.964946389f},
-std::array<float,2>{0.0135123935f, 0.412971228f},
-std::array<float,2>{0.894241691f, 0.520650327f},
-std::array<float,2>{0.533997118f, 0.439260364f},
-std::array<float,2>{0.282303691f, 0.575737655f},
-std::array<float,2>{0.148304269f, 0.0468298271f},
-std::array<float,2>{0.874049425f, 0.875733078f},
-std::array<float,2>{0.942646503f, 0.138345331f},
-std::array<float,2>{0.0880840495f, 0.869593978f},
-std::array<float,2>{0.468517244f, 0.310549915f},
-std::array<float,2>{0.661394596f, 0.639463723f},
-std::array<float,2>{0.902531266f, 0.345461458f},
-std::array<float,2>{0.00451901555f, 0.713288486f},
-std::array<float,2>{0.405558199f, 0.194121212f},
-std::array<float,2>{0.737170517f, 0.792893112f},
-std::array<float,2>{0.618492603f, 0.12141028f},
-std::array<float,2>{0.325048625f, 0.976408005f},
-std::array<float,2>{0.195246175f, 0.39101696f},
-std::array<float,2>{0.780565321f, 0.553531528f},
-std::array<float,2>{0.667596519f, 0.474436253f},
-std::array<float,2>{0.458455384f, 0.595799387f},
-std::array<float,2>{0.0830697119f, 0.0186174959f},
-std::array<float,2>{0.946916223f, 0.921118379f},
-std::array<float,2>{0.859784245f, 0.162465468f},
-std::array<float,2>{0.155907795f, 0.812965631f},
-std::array<float,2>{0.291250765f, 0.27391085f},
-std::array<float,2>{0.544989467f, 0.673280954f},
-std::array<float,2>{0.79805541f, 0.415799201f},
-std::array<float,2>{0.235287175f, 0.524467885f},
-std::array<float,2>{0.348262995f, 0.0778220817f},
-std::array<float,2>{0.592995822f, 0.955955148f},
-std::array<float,2>{0.691979885f, 0.22414802f},
-std::array<float,2>{0.433067799f, 0.766242743f},
-std::array<float,2>{0.058166489f, 0.323925525f},
-std::array<float,2>{0.927843571f, 0.741467416f},
-std::array<float,2>{0.510948956f, 0.301320046f},
-std::array<float,2>{0.256843537f, 0.630099475f},
-std::array<float,2>{0.183928579f, 0.129097432f},
-std::array<float,2>{0.822265565f, 0.863156676f},
-std::array<float,2>{0.998124957f, 0.0378875993f},
-std::array<float,2>{0.112504385f, 0.889996588f},
-std::array<float,2>{0.483882904f, 0.447854787f},
-std::array<float,2>{0.643984497f, 0.568526268f},
-std::array<float,2>{0.963686287f, 0.459967822f},
-std::array<float,2>{0.067207858f, 0.590299726f},
-std::array<float,2>{0.452744305f, 0.0479795933f},
-std::array<float,2>{0.683932364f, 0.904529929f},
-std::array<float,2>{0.555414081f, 0.140975252f},
-std::array<float,2>{0.300485194f, 0.848067284f},
-std::array<float,2>{0.134796098f, 0.295501649f},
-std::array<float,2>{0.852853775f, 0.649516404f},
-std::array<float,2>{0.728244662f, 0.340034425f},
-std::array<float,2>{0.382213682f, 0.728346288f},
-std::array<float,2>{0.016325932f, 0.249412313f},
-std::array<float,2>{0.882562757f, 0.755741537f},
-std::array<float,2>{0.754870892f, 0.0790620893f},
-std::array<float,2>{0.20497568f, 0.946582973f},
-std::array<float,2>{0.331400782f, 0.426123261f},
-std::array<float,2>{0.600077152f, 0.514733136f},
-std::array<float,2>{0.83069396f, 0.261561811f},
-std::array<float,2>{0.164553642f, 0.658949971f},
-std::array<float,2>{0.273986161f, 0.179291293f},
-std::array<float,2>{0.52452755f, 0.832051158f},
-std::array<float,2>{0.630362332f, 0.00805767532f},
-std::array<float,2>{0.495384097f, 0.93727833f},
-std::array<float,2>{0.0940122306f, 0.490831316f},
-std::array<float,2>{0.974216461f, 0.623208821f},
-std::array<float,2>{0.565496981f, 0.389731646f},
-std::array<float,2>{0.361585021f, 0.536618114f},
-std::array<float,2>{0.232821226f, 0.0994277298f},
-std::array<float,2>{0.790111601f, 0.986773312f},
-std::array<float,2>{0.909142315f, 0.217249155f},
-std::array<float,2>{0.0325486772f, 0.797692597f},
-std::array<float,2>{0.418249458f, 0.362669349f},
-std::array<float,2>{0.704702497f, 0.691194415f},
-std::array<float,2>{0.885746956f, 0.298354089f},
-std::array<float,2>{0.0286173467f, 0.627374172f},
-std::array<float,2>{0.386640429f, 0.125312701f},
-std::array<float,2>{0.724663317f, 0.864909112f},
-std::array<float,2>{0.603459895f, 0.0327077396f},
-std::array<float,2>{0.341050744f, 0.88595432f},
-std::array<float,2>{0.211152509f, 0.450127304f},
-std::array<float,2>{0.761778176f, 0.563902557f},
-std::array<float,2>{0.672870994f, 0.420446008f},
-std::array<float,2>{0.439604104f, 0.53040117f},
-std::array<float,2>{0.0714161471f, 0.0719168708f},
-std::array<float,2>{0.955659926f, 0.958766043f},
-std::array<float,2>{0.84569931f, 0.221757188f},
-std::array<float,2>{0.130707636f, 0.770136356f},
-std::array<float,2>{0.307854295f, 0.327031553f},
-std::array<float,2>{0.550328851f, 0.734419763f},
-std::array<float,2>{0.786599696f, 0.468770355f},
-std::array<float,2>{0.223049998f, 0.600320816f},
-std::array<float,2>{0.371495515f, 0.0198300648f},
-std::array<float,2>{0.575178683f, 0.915730834f},
-std::array<float,2>{0.71582526f, 0.158043772f},
-std::array<float,2>{0.413202375f, 0.819086611f},
-std::array<float,2>{0.0442706086f, 0.277824193f},
-std::array<float,2>{0.920996487f, 0.677694261f},
-std::array<float,2>{0.518846214f, 0.349540561f},
-std::array<float,2>{0.269338578f, 0.717718124f},
-std::array<float,2>{0.161784619f, 0.18954207f},
-std::array<float,2>{0.839500487f, 0.793415248f},
-std::array<float,2>{0.98199302f, 0.118993111f},
-std::array<float,2>{0.104602456f, 0.96878463f},
-std::array<float,2>{0.488887459f, 0.398320526f},
-std::array<float,2>{0.637073934f, 0.549426734f},
-std::array<float,2>{0.938202918f, 0.383072644f},
-std::array<float,2>{0.0935104191f, 0.534255207f},
-std::array<float,2>{0.464027643f, 0.0952727869f},
-std::array<float,2>{0.656260788f, 0.989268124f},
-std::array<float,2>{0.537176013f, 0.211476758f},
-std::array<float,2>{0.287820935f, 0.801970243f},
-std::array<float,2>{0.14310424f, 0.364660382f},
-std::array<float,2>{0.869162321f, 0.692777574f},
-std::array<float,2>{0.743732035f, 0.262238353f},
-std::array<float,2>{0.393153965f, 0.663482666f},
-std::array<float,2>{0.0102107404f, 0.173989564f},
-std::array<float,2>{0.896376908f, 0.83033067f},
-std::array<float,2>{0.770961404f, 0.0128464568f},
-std::array<float,2>{0.20059751f, 0.931173503f},
-std::array<float,2>{0.320114464f, 0.48640424f},
-std::array<float,2>{0.609958947f, 0.619737327f},
-std::array<float,2>{0.813577771f, 0.339471191f},
-std::array<float,2>{0.175527707f, 0.734264433f},
-std::array<float,2>{0.259047568f, 0.245428368f},
-std::array<float,2>{0.500133634f, 0.752037823f},
-std::array<float,2>{0.6561957f, 0.0832616538f},
-std::array<float,2>{0.47299698f, 0.950302064f},
-std::array<float,2>{0.119438529f, 0.423985273f},
-std::array<float,2>{0.986473083f, 0.509810627f},
-std::array<float,2>{0.583188295f, 0.453798801f},
-std::array<float,2>{0.35923174f, 0.58751452f},
-std::array<float,2>{0.246573612f, 0.0538230166f},
-std::array<float,2>{0.808627129f, 0.900198042f},
-std::array<float,2>{0.933862686f, 0.145491853f},
-std::array<float,2>{0.0478519686f, 0.847517312f},
-std::array<float,2>{0.427196652f, 0.289174944f},
-std::array<float,2>{0.696356833f, 0.655616879f},
-std::array<float,2>{0.99504602f, 0.370364964f},
-std::array<float,2>{0.114552721f, 0.699414909f},
-std::array<float,2>{0.47692439f, 0.209372491f},
-std::array<float,2>{0.646459818f, 0.807022512f},
-std::array<float,2>{0.515308261f, 0.106667988f},
-std::array<float,2>{0.251369208f, 0.999768615f},
-std::array<float,2>{0.180101484f, 0.375299603f},
-std::array<float,2>{0.825908661f, 0.541932583f},
-std::array<float,2>{0.689723313f, 0.494937778f},
-std::array<float,2>{0.437195301f, 0.611962557f},
-std::array<float,2>{0.0599973947f, 0.00258131255f},
-std::array<float,2>{0.924234092f, 0.929291487f},
-std::array<float,2>{0.803133607f, 0.181912869f},
-std::array<float,2>{0.24004291f, 0.839421868f},
-std::array<float,2>{0.347095937f, 0.250388443f},
-std::array<float,2>{0.587682307f, 0.669015825f},
-std::array<float,2>{0.863442957f, 0.432714432f},
-std::array<float,2>{0.151171789f, 0.504477859f},
-std::array<float,2>{0.294904351f, 0.0868454725f},
-std::array<float,2>{0.53918153f, 0.941170752f},
-std::array<float,2>{0.671329319f, 0.240499124f},
-std::array<float,2>{0.453410238f, 0.763114929f},
-std::array<float,2>{0.0801953524f, 0.331696004f},
-std::array<float,2>{0.952848732f, 0.723813176f},
-std::array<float,2>{0.622210681f, 0.282284915f},
-std::array<float,2>{0.324211836f, 0.643806219f},
-std::array<float,2>{0.189800113f, 0.151344866f},
-std::array<float,2>{0.773564041f, 0.853958011f},
-std::array<float,2>{0.900719166f, 0.0575055629f},
-std::array<float,2>{0.00190178456f, 0.893770039f},
-std::array<float,2>{0.400341511f, 0.461518735f},
-std::array<float,2>{0.739056289f, 0.582388818f},
-std::array<float,2>{0.91213131f, 0.442709029f},
-std::array<float,2>{0.0368053168f, 0.57126677f},
-std::array<float,2>{0.417779118f, 0.0400300696f},
-std::array<float,2>{0.710934401f, 0.87931484f},
-std::array<float,2>{0.566564679f, 0.134272203f},
-std::array<float,2>{0.363740325f, 0.874136209f},
-std::array<float,2>{0.22688216f, 0.306601286f},
-std::array<float,2>{0.794312477f, 0.634533584f},
-std::array<float,2>{0.625083685f, 0.318932682f},
-std::array<float,2>{0.498122752f, 0.745843768f},
-std::array<float,2>{0.0979173928f, 0.233612061f},
-std::array<float,2>{0.970415115f, 0.776525199f},
-std::array<float,2>{0.832160473f, 0.067741327f},
-std::array<float,2>{0.170538887f, 0.961239457f},
-std::array<float,2>{0.279318839f, 0.409124374f},
-std::array<float,2>{0.528713346f, 0.5158059f},
-std::array<float,2>{0.751785755f, 0.266018599f},
-std::array<float,2>{0.209732726f, 0.67975688f},
-std::array<float,2>{0.335476458f, 0.169502452f},
-std::array<float,2>{0.594402969f, 0.821930468f},
-std::array<float,2>{0.731355786f, 0.0239883792f},
-std::array<float,2>{0.375124931f, 0.909427106f},
-std::array<float,2>{0.0224255342f, 0.482537776f},
-std::array<float,2>{0.875431895f, 0.603419781f},
-std::array<float,2>{0.558947444f, 0.401779771f},
-std::array<float,2>{0.301178724f, 0.555329323f},
-std::array<float,2>{0.138965264f, 0.11625196f},
-std::array<float,2>{0.858637512f, 0.981253803f},
-std::array<float,2>{0.967713475f, 0.197323337f},
-std::array<float,2>{0.0627846867f, 0.7881248f},
-std::array<float,2>{0.446295977f, 0.355994165f},
-std::array<float,2>{0.682134807f, 0.708290935f},
-std::array<float,2>{0.958939672f, 0.25397712f},
-std::array<float,2>{0.0780276507f, 0.667204559f},
-std::array<float,2>{0.44433704f, 0.183752865f},
-std::array<float,2>{0.677191198f, 0.839950442f},
-std::array<float,2>{0.553774416f, 0.00553291943f},
-std::array<float,2>{0.308659971f, 0.922974706f},
-std::array<float,2>{0.125117823f, 0.497291744f},
-std::array<float,2>{0.848135591f, 0.6147874f},
-std::array<float,2>{0.721436679f, 0.379188508f},
-std::array<float,2>{0.389352977f, 0.545421958f},
-std::array<float,2>{0.0269068871f, 0.103828318f},
-std::array<float,2>{0.887389541f, 0.992701232f},
-std::array<float,2>{0.759719491f, 0.20556207f},
-std::array<float,2>{0.217457786f, 0.811346948f},
-std::array<float,2>{0.338349521f, 0.372952074f},
-std::array<float,2>{0.608388305f, 0.698856115f},
-std::array<float,2>{0.840969086f, 0.468286186f},
-std::array<float,2>{0.159701809f, 0.580780268f},
-std::array<float,2>{0.271577746f, 0.0586491637f},
-std::array<float,2>{0.52081877f, 0.897965372f},
-std::array<float,2>{0.636441767f, 0.155893281f},
-std::array<float,2>{0.485640794f, 0.855781138f},
-std::array<float,2>{0.106418863f, 0.286604136f},
-std::array<float,2>{0.977224708f, 0.644839644f},
-std::array<float,2>{0.572501421f, 0.332668573f},
-std::array<float,2>{0.370403498f, 0.719701767f},
-std::array<float,2>{0.221132293f, 0.235679328f},
-std::array<float,2>{0.782272875f, 0.761708975f},
-std::array<float,2>{0.916154802f, 0.0912937745f},
-std::array<float,2>{0.0420604534f, 0.941935599f},
-std::array<float,2>{0.407811195f, 0.434637368f},
-std::array<float,2>{0.71252346f, 0.50321728f},
-std::array<float,2>{0.892098129f, 0.411394894f},
-std::array<float,2>{0.0147856679f, 0.522655427f},
-std::array<float,2>{0.396663606f, 0.0658878982f},
-std::array<float,2>{0.749422789f, 0.967960477f},
-std::array<float,2>{0.614047706f, 0.228117839f},
-std::array<float,2>{0.314981014f, 0.780890644f},
-std::array<float,2>{0.198760852f, 0.316369504f},
-std::array<float,2>{0.768317819f, 0.749618173f},
-std::array<float,2>{0.663415194f, 0.309329093f},
-std::array<float,2>{0.466520727f, 0.636913478f},
-std::array<float,2>{0.0875845477f, 0.139408797f},
-std::array<float,2>{0.944882631f, 0.86807251f},
-std::array<float,2>{0.872120857f, 0.0436009802f},
-std::array<float,2>{0.144968688f, 0.877972603f},
-std::array<float,2>{0.283448279f, 0.439793795f},
-std::array<float,2>{0.531298876f, 0.576888978f},
-std::array<float,2>{0.80791229f, 0.352279782f},
-std::array<float,2>{0.245705679f, 0.704406619f},
-std::array<float,2>{0.353896379f, 0.199283466f},
-std::array<float,2>{0.581386626f, 0.783938289f},
-std::array<float,2>{0.703099251f, 0.11157193f},
-std::array<float,2>{0.425113946f, 0.979683399f},
-std::array<float,2>{0.0526193716f, 0.404011041f},
-std::array<float,2>{0.933300197f, 0.56031245f},
-std::array<float,2>{0.507301211f, 0.477123082f},
-std::array<float,2>{0.263883442f, 0.607929587f},
-std::array<float,2>{0.17751573f, 0.0308158565f},
-std::array<float,2>{0.816731393f, 0.910748899f},
-std::array<float,2>{0.991928995f, 0.164925471f},
-std::array<float,2>{0.121768422f, 0.827361643f},
-std::array<float,2>{0.470524192f, 0.269852966f},
-std::array<float,2>{0.650186777f, 0.68607235f},
-std::array<float,2>{0.926984549f, 0.321665943f},
-std::array<float,2>{0.0558414869f, 0.739306867f},
-std::array<float,2>{0.431137055f, 0.22615394f},
-std::array<float,2>{0.69345063f, 0.768156588f},
-std::array<float,2>{0.59158814f, 0.0746210963f},
-std::array<float,2>{0.350650162f, 0.95379132f},
-std::array<float,2>{0.236372396f, 0.417459577f},
-std::array<float,2>{0.800692379f, 0.52700609f},
-std::array<float,2>{0.6415748f, 0.447152883f},
-std::array<float,2>{0.481169194f, 0.568286657f},
-std::array<float,2>{0.109996356f, 0.0365535952f},
-std::array<float,2>{0.997346044f, 0.887212336f},
-std::array<float,2>{0.822981715f, 0.131085634f},
-std::array<float,2>{0.18690154f, 0.859499812f},
-std::array<float,2>{0.254247516f, 0.30410102f},
-std::array<float,2>{0.50950712f, 0.630951941f},
-std::array<float,2>{0.777890801f, 0.393902212f},
-std::array<float,2>{0.192222178f, 0.552353621f},
-std::array<float,2>{0.326587468f, 0.123911075f},
-std::array<float,2>{0.620063841f, 0.974298775f},
-std::array<float,2>{0.734473288f, 0.191609621f},
-std::array<float,2>{0.402698696f, 0.790649772f},
-std::array<float,2>{0.00760509539f, 0.347061694f},
-std::array<float,2>{0.905676603f, 0.71194303f},
-std::array<float,2>{0.543135822f, 0.275476754f},
-std::array<float,2>{0.289969951f, 0.673867464f},
-std::array<float,2>{0.153777286f, 0.16092515f},
-std::array<float,2>{0.862423003f, 0.815625966f},
-std::array<float,2>{0.947782755f, 0.0171852391f},
-std::array<float,2>{0.0844776258f, 0.919830322f},
-std::array<float,2>{0.460513979f, 0.474965304f},
-std::array<float,2>{0.664578259f, 0.595467031f},
-std::array<float,2>{0.975699544f, 0.489569962f},
-std::array<float,2>{0.0967663527f, 0.621754646f},
-std::array<float,2>{0.493835658f, 0.0111282747f},
-std::array<float,2>{0.631379545f, 0.934275866f},
-std::array<float,2>{0.526849926f, 0.176306605f},
-std::array<float,2>{0.276535749f, 0.83580339f},
-std::array<float,2>{0.166042835f, 0.259516925f},
-std::array<float,2>{0.829359055f, 0.656474948f},
-std::array<float,2>{0.706366301f, 0.359547049f},
-std::array<float,2>{0.420302957f, 0.688650727f},
-std::array<float,2>{0.0343294851f, 0.21664755f},
-std::array<float,2>{0.907530129f, 0.799740791f},
-std::array<float,2>{0.791314602f, 0.100761548f},
-std::array<float,2>{0.230974928f, 0.986179054f},
-std::array<float,2>{0.360866785f, 0.388013721f},
-std::array<float,2>{0.563702583f, 0.53850472f},
-std::array<float,2>{0.854165971f, 0.294304997f},
-std::array<float,2>{0.134574756f, 0.65215677f},
-std::array<float,2>{0.297127873f, 0.143937036f},
-std::array<float,2>{0.557068527f, 0.850111425f},
-std::array<float,2>{0.687480628f, 0.0502282605f},
-std::array<float,2>{0.450790197f, 0.902749002f},
-std::array<float,2>{0.0684723035f, 0.458326459f},
-std::array<float,2>{0.961121976f, 0.592020214f},
-std::array<float,2>{0.599539757f, 0.428260565f},
-std::array<float,2>{0.328829169f, 0.512582302f},
-std::array<float,2>{0.206832111f, 0.0801863149f},
-std::array<float,2>{0.756291926f, 0.947949708f},
-std::array<float,2>{0.878969073f, 0.247906163f},
-std::array<float,2>{0.0192124788f, 0.756322086f},
-std::array<float,2>{0.380111605f, 0.342949688f},
-std::array<float,2>{0.729239404f, 0.729933143f},
-std::array<float,2>{0.875654817f, 0.268512458f},
-std::array<float,2>{0.0218606461f, 0.681681633f},
-std::array<float,2>{0.375692189f, 0.171661451f},
-std::array<float,2>{0.730938971f, 0.822849691f},
-std::array<float,2>{0.593824804f, 0.0257263742f},
-std::array<float,2>{0.335061312f, 0.90670085f},
-std::array<float,2>{0.209186554f, 0.480750263f},
-std::array<float,2>{0.751015186f, 0.604072332f},
-std::array<float,2>{0.681891382f, 0.398977757f},
-std::array<float,2>{0.446856707f, 0.558453441f},
-std::array<float,2>{0.0631310046f, 0.114408553f},
-std::array<float,2>{0.966913342f, 0.983987391f},
-std::array<float,2>{0.858927727f, 0.195367083f},
-std::array<float,2>{0.139644265f, 0.786575794f},
-std::array<float,2>{0.301455706f, 0.359136939f},
-std::array<float,2>{0.55939734f, 0.709585011f},
-std::array<float,2>{0.794768333f, 0.443936646f},
-std::array<float,2>{0.227181643f, 0.573633552f},
-std::array<float,2>{0.363988489f, 0.0414210074f},
-std::array<float,2>{0.567214966f, 0.88140589f},
-std::array<float,2>{0.710250318f, 0.135830775f},
-std::array<float,2>{0.417306751f, 0.871514022f},
-std::array<float,2>{0.036491666f, 0.307793379f},
-std::array<float,2>{0.913081884f, 0.63545388f},
-std::array<float,2>{0.529142141f, 0.316541791f},
-std::array<float,2>{0.280186772f, 0.744068205f},
-std::array<float,2>{0.170119032f, 0.231353417f},
-std::array<float,2>{0.832724333f, 0.775217533f},
-std::array<float,2>{0.970139027f, 0.0702345222f},
-std::array<float,2>{0.0982710496f, 0.963322163f},
-std::array<float,2>{0.49897185f, 0.407240123f},
-std::array<float,2>{0.625780225f, 0.518343985f},
-std::array<float,2>{0.952248335f, 0.431393623f},
-std::array<float,2>{0.0808162466f, 0.50686419f},
-std::array<float,2>{0.454001307f, 0.0887701511f},
-std::array<float,2>{0.671602249f, 0.938576221f},
-std::array<float,2>{0.539861321f, 0.239335179f},
-std::array<float,2>{0.294231415f, 0.76528883f},
-std::array<float,2>{0.15081346f, 0.32867232f},
-std::array<float,2>{0.863779604f, 0.726098537f},
-std::array<float,2>{0.738654256f, 0.284150034f},
-std::array<float,2>{0.399821222f, 0.640843689f},
-std::array<float,2>{0.00119096076f, 0.149969906f},
-std::array<float,2>{0.900982678f, 0.852250874f},
-std::array<float,2>{0.77421087f, 0.0550815128f},
-std::array<float,2>{0.189955831f, 0.891900778f},
-std::array<float,2>{0.323355436f, 0.463508636f},
-std::array<float,2>{0.622725904f, 0.584021986f},
-std::array<float,2>{0.825240076f, 0.368899494f},
-std::array<float,2>{0.180412963f, 0.7014817f},
-std::array<float,2>{0.25161317f, 0.207364172f},
-std::array<float,2>{0.514903247f, 0.805707455f},
-std::array<float,2>{0.645603597f, 0.107511587f},
-std::array<float,2>{0.477151453f, 0.996288538f},
-std::array<float,2>{0.11483705f, 0.378602862f},
-std::array<float,2>{0.994340956f, 0.539886057f},
-std::array<float,2>{0.586964726f, 0.492687315f},
-std::array<float,2>{0.347258866f, 0.610947192f},
-std::array<float,2>{0.239585549f, 0.00102385331f},
-std::array<float,2>{0.803702235f, 0.926463127f},
-std::array<float,2>{0.924491167f, 0.181034386f},
-std::array<float,2>{0.0604242049f, 0.836202323f},
-std::array<float,2>{0.436848372f, 0.252999336f},
-std::array<float,2>{0.690151989f, 0.671686172f},
-std::array<float,2>{0.987115085f, 0.33695212f},
-std::array<float,2>{0.119682722f, 0.731608987f},
-std::array<float,2>{0.473629892f, 0.244050875f},
-std::array<float,2>{0.655399144f, 0.75101769f},
-std::array<float,2>{0.500826418f, 0.0852076486f},
-std::array<float,2>{0.259751379f, 0.95191443f},
-std::array<float,2>{0.174835011f, 0.422360301f},
-std::array<float,2>{0.81419009f, 0.509424806f},
-std::array<float,2>{0.696966231f, 0.456005722f},
-std::array<float,2>{0.42766127f, 0.58946085f},
-std::array<float,2>{0.0485770814f, 0.0524832532f},
-std::array<float,2>{0.9341712f, 0.900972247f},
-std::array<float,2>{0.809332013f, 0.147269085f},
-std::array<float,2>{0.246921197f, 0.844024956f},
-std::array<float,2>{0.358447015f, 0.29141888f},
-std::array<float,2>{0.583893597f, 0.6537323f},
-std::array<float,2>{0.869709015f, 0.385713071f},
-std::array<float,2>{0.142621726f, 0.531779408f},
-std::array<float,2>{0.287531793f, 0.0964425057f},
-std::array<float,2>{0.537958145f, 0.990363121f},
-std::array<float,2>{0.656754196f, 0.213630289f},
-std::array<float,2>{0.464768797f, 0.804485679f},
-std::array<float,2>{0.0930960029f, 0.366535485f},
-std::array<float,2>{0.937687993f, 0.69387722f},
-std::array<float,2>{0.609547138f, 0.263838738f},
-std::array<float,2>{0.319763541f, 0.661080003f},
-std::array<float,2>{0.200935647f, 0.173261434f},
-std::array<float,2>{0.771169901f, 0.828255236f},
-std::array<float,2>{0.895791292f, 0.0152701773f},
-std::array<float,2>{0.0104105761f, 0.933539927f},
-std::array<float,2>{0.392797619f, 0.485666901f},
-std::array<float,2>{0.743385911f, 0.617607117f},
-std::array<float,2>{0.921746016f, 0.471936941f},
-std::array<float,2>{0.0448605008f, 0.598850489f},
-std::array<float,2>{0.413919032f, 0.0222695619f},
-std::array<float,2>{0.716464102f, 0.916605353f},
-std::array<float,2>{0.574524641f, 0.159370333f},
-std::array<float,2>{0.371659636f, 0.816424429f},
-std::array<float,2>{0.223179892f, 0.279718399f},
-std::array<float,2>{0.787005603f, 0.678512394f},
-std::array<float,2>{0.637208104f, 0.351191819f},
-std::array<float,2>{0.488752156f, 0.714993715f},
-std::array<float,2>{0.105187707f, 0.188040942f},
-std::array<float,2>{0.981698632f, 0.79671216f},
-std::array<float,2>{0.839174032f, 0.120645583f},
-std::array<float,2>{0.161145329f, 0.972355008f},
-std::array<float,2>{0.268989444f, 0.394651055f},
-std::array<float,2>{0.519251525f, 0.547687888f},
-std::array<float,2>{0.762553632f, 0.299922705f},
-std::array<float,2>{0.211608261f, 0.62515378f},
-std::array<float,2>{0.341486931f, 0.127258241f},
-std::array<float,2>{0.602915347f, 0.866035283f},
-std::array<float,2>{0.725436628f, 0.0343888924f},
-std::array<float,2>{0.386083424f, 0.882910311f},
-std::array<float,2>{0.0288215373f, 0.451872468f},
-std::array<float,2>{0.886559844f, 0.565783978f},
-std::array<float,2>{0.549816608f, 0.418917328f},
-std::array<float,2>{0.308136195f, 0.527558684f},
-std::array<float,2>{0.129988864f, 0.0736017078f},
-std::array<float,2>{0.84475863f, 0.95947361f},
-std::array<float,2>{0.955321252f, 0.219299152f},
-std::array<float,2>{0.0719073042f, 0.773403823f},
-std::array<float,2>{0.440369755f, 0.325898439f},
-std::array<float,2>{0.673451543f, 0.737006307f},
-std::array<float,2>{0.96180743f, 0.295397311f},
-std::array<float,2>{0.0692382231f, 0.650034487f},
-std::array<float,2>{0.450313598f, 0.141180515f},
-std::array<float,2>{0.686585307f, 0.848243594f},
-std::array<float,2>{0.557595193f, 0.0486317798f},
-std::array<float,2>{0.297742337f, 0.905168951f},
-std::array<float,2>{0.134017557f, 0.460912555f},
-std::array<float,2>{0.85386771f, 0.590669036f},
-std::array<float,2>{0.728607893f, 0.426608533f},
-std::array<float,2>{0.380841464f, 0.51516217f},
-std::array<float,2>{0.0185658596f, 0.0784508884f},
-std::array<float,2>{0.879659235f, 0.94687748f},
-std::array<float,2>{0.756729841f, 0.249875098f},
-std::array<float,2>{0.206349015f, 0.755347073f},
-std::array<float,2>{0.328376025f, 0.340472251f},
-std::array<float,2>{0.599045873f, 0.727875233f},
-std::array<float,2>{0.829757512f, 0.490276307f},
-std::array<float,2>{0.166979626f, 0.623627961f},
-std::array<float,2>{0.277189702f, 0.00838583056f},
-std::array<float,2>{0.527083337f, 0.936927855f},
-std::array<float,2>{0.631258488f, 0.17904745f},
-std::array<float,2>{0.493440539f, 0.83279258f},
-std::array<float,2>{0.0974524021f, 0.260968566f},
-std::array<float,2>{0.976529837f, 0.658566892f},
-std::array<float,2>{0.564153254f, 0.362948239f},
-std::array<float,2>{0.360708565f, 0.690499127f},
-std::array<float,2>{0.230741903f, 0.217310041f},
-std::array<float,2>{0.791819394f, 0.79724437f},
-std::array<float,2>{0.907833576f, 0.0989157408f},
-std::array<float,2>{0.0348682813f, 0.987046182f},
-std::array<float,2>{0.42083478f, 0.390582919f},
-std::array<float,2>{0.706896782f, 0.536965847f},
-std::array<float,2>{0.905967057f, 0.391310304f},
-std::array<float,2>{0.00720248977f, 0.55280602f},
-std::array<float,2>{0.403248966f, 0.121756643f},
-std::array<float,2>{0.735335767f, 0.97565943f},
-std::array<float,2>{0.619545639f, 0.193602636f},
-std::array<float,2>{0.326941103f, 0.79226917f},
-std::array<float,2>{0.191673011f, 0.344923973f},
-std::array<float,2>{0.777763963f, 0.713720918f},
-std::array<float,2>{0.664387107f, 0.274362743f},
-std::array<float,2>{0.460444152f, 0.673340619f},
-std::array<float,2>{0.0844051763f, 0.162676007f},
-std::array<float,2>{0.947482765f, 0.813104272f},
-std::array<float,2>{0.862859964f, 0.0191447474f},
-std::array<float,2>{0.153908387f, 0.921808064f},
-std::array<float,2>{0.289185882f, 0.473744005f},
-std::array<float,2>{0.543911517f, 0.59626472f},
-std::array<float,2>{0.800192356f, 0.323404908f},
-std::array<float,2>{0.237058595f, 0.742153823f},
-std::array<float,2>{0.351480633f, 0.22366713f},
-std::array<float,2>{0.591231287f, 0.765882015f},
-std::array<float,2>{0.694114149f, 0.0771582723f},
-std::array<float,2>{0.4315238f, 0.955343306f},
-std::array<float,2>{0.0564657375f, 0.415097088f},
-std::array<float,2>{0.927485108f, 0.525258303f},
-std::array<float,2>{0.508943081f, 0.447373122f},
-std::array<float,2>{0.254605591f, 0.568953753f},
-std::array<float,2>{0.18706131f, 0.03724223f},
-std::array<float,2>{0.822413027f, 0.89061743f},
-std::array<float,2>{0.997993946f, 0.129861593f},
-std::array<float,2>{0.109713696f, 0.862695932f},
-std::array<float,2>{0.480724454f, 0.300786465f},
-std::array<float,2>{0.640985548f, 0.63064748f},
-std::array<float,2>{0.932729721f, 0.354681522f},
-std::array<float,2>{0.0520463213f, 0.705993533f},
-std::array<float,2>{0.425481558f, 0.201829031f},
-std::array<float,2>{0.702298522f, 0.781794548f},
-std::array<float,2>{0.581982732f, 0.111249074f},
-std::array<float,2>{0.354339093f, 0.977174461f},
-std::array<float,2>{0.245132282f, 0.404887944f},
-std::array<float,2>{0.808108747f, 0.560901523f},
-std::array<float,2>{0.649631321f, 0.480010748f},
-std::array<float,2>{0.469817609f, 0.605833828f},
-std::array<float,2>{0.121161722f, 0.0283814538f},
-std::array<float,2>{0.991436243f, 0.912407875f},
-std::array<float,2>{0.817299902f, 0.167762175f},
-std::array<float,2>{0.17715998f, 0.824377418f},
-std::array<float,2>{0.264464229f, 0.271910757f},
-std::array<float,2>{0.507609725f, 0.683923721f},
-std::array<float,2>{0.76789856f, 0.412266642f},
-std::array<float,2>{0.198632583f, 0.521440744f},
-std::array<float,2>{0.314619631f, 0.064362511f},
-std::array<float,2>{0.613634109f, 0.965610921f},
-std::array<float,2>{0.749579728f, 0.229549989f},
-std::array<float,2>{0.397449464f, 0.777611613f},
-std::array<float,2>{0.0152147161f, 0.314152181f},
-std::array<float,2>{0.89169842f, 0.747434318f},
-std::array<float,2>{0.531777561f, 0.311160862f},
-std::array<float,2>{0.283786356f, 0.638888955f},
-std::array<float,2>{0.145163521f, 0.137714371f},
-std::array<float,2>{0.87277168f, 0.869675994f},
-std::array<float,2>{0.944376588f, 0.0463386104f},
-std::array<float,2>{0.0869719684f, 0.875347793f},
-std::array<float,2>{0.466298729f, 0.438609809f},
-std::array<float,2>{0.66403681f, 0.575449169f},
-std::array<float,2>{0.97690177f, 0.465598375f},
-std::array<float,2>{0.105519973f, 0.579447448f},
-std::array<float,2>{0.485956728f, 0.0611628108f},
-std::array<float,2>{0.63610059f, 0.895211279f},
-std::array<float,2>{0.521420598f, 0.153047577f},
-std::array<float,2>{0.272179008f, 0.859077632f},
-std::array<float,2>{0.159222722f, 0.28776896f},
-std::array<float,2>{0.84157151f, 0.647434175f},
-std::array<float,2>{0.712026656f, 0.334305167f},
-std::array<float,2>{0.407394648f, 0.720909655f},
-std::array<float,2>{0.0428616442f, 0.238023892f},
-std::array<float,2>{0.916543543f, 0.7595402f},
-std::array<float,2>{0.783040464f, 0.0921000466f},
-std::array<float,2>{0.221319586f, 0.945050836f},
-std::array<float,2>{0.370660573f, 0.436600119f},
-std::array<float,2>{0.572997391f, 0.50154227f},
-std::array<float,2>{0.848383129f, 0.256386459f},
-std::array<float,2>{0.125728011f, 0.664421916f},
-std::array<float,2>{0.309424132f, 0.187428609f},
-std::array<float,2>{0.554561317f, 0.84282726f},
-std::array<float,2>{0.677638352f, 0.0064830007f},
-std::array<float,2>{0.445101529f, 0.924536407f},
-std::array<float,2>{0.0773909688f, 0.498868406f},
-std::array<float,2>{0.958431184f, 0.616941273f},
-std::array<float,2>{0.607570529f, 0.382115543f},
-std::array<float,2>{0.338399976f, 0.542997777f},
-std::array<float,2>{0.217106044f, 0.103465706f},
-std::array<float,2>{0.758872867f, 0.994703829f},
-std::array<float,2>{0.887052119f, 0.2035276f},
-std::array<float,2>{0.0266022719f, 0.80907023f},
-std::array<float,2>{0.389042765f, 0.373904735f},
-std::array<float,2>{0.720706046f, 0.695322573f},
-std::array<float,2>{0.91059643f, 0.305822492f},
-std::array<float,2>{0.0372923799f, 0.633857369f},
-std::array<float,2>{0.414774716f, 0.134281799f},
-std::array<float,2>{0.708445609f, 0.874548137f},
-std::array<float,2>{0.569714904f, 0.039297577f},
-std::array<float,2>{0.366027772f, 0.879531264f},
-std::array<float,2>{0.229636371f, 0.442974448f},
-std::array<float,2>{0.795082688f, 0.570459425f},
-std::array<float,2>{0.627286553f, 0.408398211f},
-std::array<float,2>{0.496868581f, 0.516257346f},
-std::array<float,2>{0.100372635f, 0.067878902f},
-std::array<float,2>{0.972147405f, 0.961449742f},
-std::array<float,2>{0.834992588f, 0.23407118f},
-std::array<float,2>{0.168440983f, 0.777282238f},
-std::array<float,2>{0.277420878f, 0.318691522f},
-std::array<float,2>{0.531224191f, 0.745197475f},
-std::array<float,2>{0.752981126f, 0.483254045f},
-std::array<float,2>{0.207396731f, 0.602942646f},
-std::array<float,2>{0.333089143f, 0.023460798f},
-std::array<float,2>{0.596302927f, 0.909857988f},
-std::array<float,2>{0.733388126f, 0.169322908f},
-std::array<float,2>{0.377843857f, 0.821568668f},
-std::array<float,2>{0.020418616f, 0.266386986f},
-std::array<float,2>{0.877319455f, 0.68027842f},
-std::array<float,2>{0.561428905f, 0.355952948f},
-std::array<float,2>{0.304062635f, 0.70868367f},
-std::array<float,2>{0.13784267f, 0.198134825f},
-std::array<float,2>{0.857027352f, 0.788616002f},
-std::array<float,2>{0.96520704f, 0.117089368f},
-std::array<float,2>{0.0650195703f, 0.980715632f},
-std::array<float,2>{0.448174119f, 0.402289212f},
-std::array<float,2>{0.681428492f, 0.554839909f},
-std::array<float,2>{0.992850244f, 0.375836313f},
-std::array<float,2>{0.115451857f, 0.541257322f},
-std::array<float,2>{0.478824377f, 0.107128032f},
-std::array<float,2>{0.647667527f, 0.999288797f},
-std::array<float,2>{0.511990726f, 0.20985052f},
-std::array<float,2>{0.252905279f, 0.807337224f},
-std::array<float,2>{0.182668298f, 0.370791525f},
-std::array<float,2>{0.827955544f, 0.699713647f},
-std::array<float,2>{0.688353479f, 0.250940412f},
-std::array<float,2>{0.434352815f, 0.669460595f},
-std::array<float,2>{0.0622435026f, 0.182153925f},
-std::array<float,2>{0.922539055f, 0.839062154f},
-std::array<float,2>{0.801955402f, 0.00228542904f},
-std::array<float,2>{0.240658134f, 0.929015517f},
-std::array<float,2>{0.344125718f, 0.494560629f},
-std::array<float,2>{0.589255929f, 0.611354589f},
-std::array<float,2>{0.865874887f, 0.331323951f},
-std::array<float,2>{0.149554491f, 0.724541485f},
-std::array<float,2>{0.296041965f, 0.240972251f},
-std::array<float,2>{0.541995347f, 0.763290644f},
-std::array<float,2>{0.669481337f, 0.0860736594f},
-std::array<float,2>{0.455193371f, 0.940891087f},
-std::array<float,2>{0.079913713f, 0.433113426f},
-std::array<float,2>{0.950014293f, 0.50439316f},
-std::array<float,2>{0.624054074f, 0.461104244f},
-std::array<float,2>{0.320633918f, 0.582798421f},
-std::array<float,2>{0.189266369f, 0.057057064f},
-std::array<float,2>{0.775771439f, 0.894234955f},
-std::array<float,2>{0.899367571f, 0.150433853f},
-std::array<float,2>{0.00322092185f, 0.854384243f},
-std::array<float,2>{0.401670247f, 0.282993495f},
-std::array<float,2>{0.741209149f, 0.644363046f},
-std::array<float,2>{0.940419376f, 0.365059465f},
-std::array<float,2>{0.0911654234f, 0.693080902f},
-std::array<float,2>{0.462242514f, 0.211169869f},
-std::array<float,2>{0.659509361f, 0.802354634f},
-std::array<float,2>{0.537030458f, 0.094957605f},
-std::array<float,2>{0.285327911f, 0.989761293f},
-std::array<float,2>{0.141315535f, 0.38349086f},
-std::array<float,2>{0.867633104f, 0.534703732f},
-std::array<float,2>{0.745693862f, 0.487149984f},
-std::array<float,2>{0.390931547f, 0.619493902f},
-std::array<float,2>{0.00816587545f, 0.0134849576f},
-std::array<float,2>{0.897245407f, 0.930770993f},
-std::array<float,2>{0.772637308f, 0.174515605f},
-std::array<float,2>{0.202719375f, 0.830571473f},
-std::array<float,2>{0.316762507f, 0.261729568f},
-std::array<float,2>{0.612557054f, 0.663838804f},
-std::array<float,2>{0.815839589f, 0.424479276f},
-std::array<float,2>{0.173677236f, 0.510528505f},
-std::array<float,2>{0.260361463f, 0.0835324302f},
-std::array<float,2>{0.50221312f, 0.951020539f},
-std::array<float,2>{0.653088033f, 0.245948792f},
-std::array<float,2>{0.475061595f, 0.752533376f},
-std::array<float,2>{0.118056446f, 0.339096606f},
-std::array<float,2>{0.985823393f, 0.733544469f},
-std::array<float,2>{0.584824502f, 0.289657503f},
-std::array<float,2>{0.356761098f, 0.656134665f},
-std::array<float,2>{0.249603584f, 0.144558057f},
-std::array<float,2>{0.811023772f, 0.846895933f},
-std::array<float,2>{0.936429739f, 0.0544941388f},
-std::array<float,2>{0.0505961664f, 0.89969492f},
-std::array<float,2>{0.429489791f, 0.453466356f},
-std::array<float,2>{0.697619438f, 0.586988628f},
-std::array<float,2>{0.883175254f, 0.449261814f},
-std::array<float,2>{0.0298700724f, 0.564429045f},
-std::array<float,2>{0.383483171f, 0.0329838842f},
-std::array<float,2>{0.723695755f, 0.886640012f},
-std::array<float,2>{0.605420113f, 0.125699535f},
-std::array<float,2>{0.341832966f, 0.864443719f},
-std::array<float,2>{0.214089751f, 0.298115343f},
-std::array<float,2>{0.763999104f, 0.627821088f},
-std::array<float,2>{0.675222456f, 0.32656917f},
-std::array<float,2>{0.438482642f, 0.734988272f},
-std::array<float,2>{0.0723667517f, 0.222552463f},
-std::array<float,2>{0.954489589f, 0.769808292f},
-std::array<float,2>{0.846404612f, 0.0713151395f},
-std::array<float,2>{0.131269976f, 0.958138466f},
-std::array<float,2>{0.306387395f, 0.420372248f},
-std::array<float,2>{0.54816258f, 0.5312168f},
-std::array<float,2>{0.788673401f, 0.278210044f},
-std::array<float,2>{0.225556999f, 0.676773787f},
-std::array<float,2>{0.374500334f, 0.157417029f},
-std::array<float,2>{0.577571571f, 0.818389058f},
-std::array<float,2>{0.718241513f, 0.0200475398f},
-std::array<float,2>{0.410350919f, 0.915398777f},
-std::array<float,2>{0.0451435447f, 0.469695657f},
-std::array<float,2>{0.918033421f, 0.599753439f},
-std::array<float,2>{0.516048968f, 0.397718787f},
-std::array<float,2>{0.266756713f, 0.548952281f},
-std::array<float,2>{0.162803069f, 0.118192337f},
-std::array<float,2>{0.836692512f, 0.969543934f},
-std::array<float,2>{0.983905852f, 0.190223783f},
-std::array<float,2>{0.101988755f, 0.793710709f},
-std::array<float,2>{0.490661889f, 0.348900646f},
-std::array<float,2>{0.640462458f, 0.717244625f},
-std::array<float,2>{0.973833978f, 0.259212881f},
-std::array<float,2>{0.0946931019f, 0.656906426f},
-std::array<float,2>{0.495662689f, 0.175923973f},
-std::array<float,2>{0.630733252f, 0.835438251f},
-std::array<float,2>{0.525099277f, 0.0116430121f},
-std::array<float,2>{0.273617953f, 0.933918238f},
-std::array<float,2>{0.164281517f, 0.490217268f},
-std::array<float,2>{0.830413163f, 0.621397793f},
-std::array<float,2>{0.704516411f, 0.388311267f},
-std::array<float,2>{0.41854623f, 0.538785219f},
-std::array<float,2>{0.0330869444f, 0.101376563f},
-std::array<float,2>{0.9083848f, 0.985470355f},
-std::array<float,2>{0.791007459f, 0.216112152f},
-std::array<float,2>{0.233218908f, 0.798968315f},
-std::array<float,2>{0.362177193f, 0.360022962f},
-std::array<float,2>{0.566052794f, 0.689001501f},
-std::array<float,2>{0.853453934f, 0.458509505f},
-std::array<float,2>{0.135665685f, 0.592731774f},
-std::array<float,2>{0.300292671f, 0.050437849f},
-std::array<float,2>{0.554831862f, 0.903306305f},
-std::array<float,2>{0.684430063f, 0.144225895f},
-std::array<float,2>{0.452418119f, 0.849943519f},
-std::array<float,2>{0.0665758252f, 0.2947191f},
-std::array<float,2>{0.963116586f, 0.651482344f},
-std::array<float,2>{0.600103498f, 0.343277007f},
-std::array<float,2>{0.331928313f, 0.73038888f},
-std::array<float,2>{0.204556569f, 0.247104406f},
-std::array<float,2>{0.75398159f, 0.756702304f},
-std::array<float,2>{0.881865144f, 0.0809715465f},
-std::array<float,2>{0.0159517713f, 0.947705269f},
-std::array<float,2>{0.382503718f, 0.428119779f},
-std::array<float,2>{0.72781086f, 0.511909485f},
-std::array<float,2>{0.928409219f, 0.417629331f},
-std::array<float,2>{0.0576285012f, 0.526553512f},
-std::array<float,2>{0.433106661f, 0.0751387998f},
-std::array<float,2>{0.691659451f, 0.95314765f},
-std::array<float,2>{0.593737662f, 0.225679457f},
-std::array<float,2>{0.347953856f, 0.767742634f},
-std::array<float,2>{0.234380469f, 0.321912944f},
-std::array<float,2>{0.798485875f, 0.740108132f},
-std::array<float,2>{0.644299507f, 0.304596186f},
-std::array<float,2>{0.483896315f, 0.631709874f},
-std::array<float,2>{0.113083534f, 0.131577894f},
-std::array<float,2>{0.99883616f, 0.860101819f},
-std::array<float,2>{0.821770489f, 0.0369137228f},
-std::array<float,2>{0.184566617f, 0.886861444f},
-std::array<float,2>{0.257481456f, 0.44677037f},
-std::array<float,2>{0.511246622f, 0.567630827f},
-std::array<float,2>{0.781103253f, 0.347560227f},
-std::array<float,2>{0.194622844f, 0.712455273f},
-std::array<float,2>{0.324380994f, 0.1923372f},
-std::array<float,2>{0.618949234f, 0.790377796f},
-std::array<float,2>{0.736671507f, 0.123074248f},
-std::array<float,2>{0.406163126f, 0.974029005f},
-std::array<float,2>{0.00426709326f, 0.394455791f},
-std::array<float,2>{0.903271437f, 0.551809549f},
-std::array<float,2>{0.545506179f, 0.475439131f},
-std::array<float,2>{0.2917732f, 0.594997585f},
-std::array<float,2>{0.155697286f, 0.017003106f},
-std::array<float,2>{0.860070944f, 0.919087768f},
-std::array<float,2>{0.946460187f, 0.160604313f},
-std::array<float,2>{0.0837278217f, 0.816380143f},
-std::array<float,2>{0.458969027f, 0.276037991f},
-std::array<float,2>{0.667096913f, 0.674794972f},
-std::array<float,2>{0.893692791f, 0.315786213f},
-std::array<float,2>{0.0129363164f, 0.749282777f},
-std::array<float,2>{0.396309406f, 0.227652952f},
-std::array<float,2>{0.747126043f, 0.780345678f},
-std::array<float,2>{0.616847336f, 0.0662282631f},
-std::array<float,2>{0.313031375f, 0.968739092f},
-std::array<float,2>{0.197227463f, 0.411907524f},
-std::array<float,2>{0.767193854f, 0.522965133f},
-std::array<float,2>{0.661911547f, 0.44007203f},
-std::array<float,2>{0.468117952f, 0.576458335f},
-std::array<float,2>{0.0888100266f, 0.0429734066f},
-std::array<float,2>{0.943259358f, 0.87882781f},
-std::array<float,2>{0.874834955f, 0.138711825f},
-std::array<float,2>{0.147948042f, 0.867424548f},
-std::array<float,2>{0.282762796f, 0.308874786f},
-std::array<float,2>{0.533594191f, 0.637483597f},
-std::array<float,2>{0.8057971f, 0.403401166f},
-std::array<float,2>{0.243727073f, 0.559648812f},
-std::array<float,2>{0.352074742f, 0.112184972f},
-std::array<float,2>{0.57912457f, 0.980313301f},
-std::array<float,2>{0.699569464f, 0.199847162f},
-std::array<float,2>{0.42336005f, 0.783329427f},
-std::array<float,2>{0.0540016107f, 0.351870894f},
-std::array<float,2>{0.930616677f, 0.704727292f},
-std::array<float,2>{0.505136013f, 0.270230085f},
-std::array<float,2>{0.262424827f, 0.68558538f},
-std::array<float,2>{0.178693146f, 0.164545551f},
-std::array<float,2>{0.818888426f, 0.82782197f},
-std::array<float,2>{0.988503695f, 0.0303747803f},
-std::array<float,2>{0.124377511f, 0.910233736f},
-std::array<float,2>{0.471787095f, 0.476684004f},
-std::array<float,2>{0.652032912f, 0.607866526f},
-std::array<float,2>{0.960194528f, 0.497899294f},
-std::array<float,2>{0.0754725114f, 0.614316821f},
-std::array<float,2>{0.442890882f, 0.00524787698f},
-std::array<float,2>{0.679516256f, 0.923718989f},
-std::array<float,2>{0.550900996f, 0.184565768f},
-std::array<float,2>{0.31068486f, 0.840813041f},
-std::array<float,2>{0.127556443f, 0.254786223f},
-std::array<float,2>{0.850473583f, 0.667636216f},
-std::array<float,2>{0.720228195f, 0.372332186f},
-std::array<float,2>{0.387435794f, 0.698663533f},
-std::array<float,2>{0.0252503585f, 0.205710873f},
-std::array<float,2>{0.890156806f, 0.811034501f},
-std::array<float,2>{0.760026097f, 0.10444244f},
-std::array<float,2>{0.216686875f, 0.992469907f},
-std::array<float,2>{0.336194783f, 0.37968275f},
-std::array<float,2>{0.606387258f, 0.545281291f},
-std::array<float,2>{0.842270911f, 0.286626577f},
-std::array<float,2>{0.156320944f, 0.645278752f},
-std::array<float,2>{0.269769967f, 0.155482247f},
-std::array<float,2>{0.522865415f, 0.856386006f},
-std::array<float,2>{0.634556472f, 0.0593411177f},
-std::array<float,2>{0.487123877f, 0.89763552f},
-std::array<float,2>{0.109139346f, 0.467824608f},
-std::array<float,2>{0.980429471f, 0.580364883f},
-std::array<float,2>{0.570615113f, 0.435134977f},
-std::array<float,2>{0.369098336f, 0.503575802f},
-std::array<float,2>{0.220288679f, 0.0914348587f},
-std::array<float,2>{0.784022152f, 0.941542089f},
-std::array<float,2>{0.915877402f, 0.236071378f},
-std::array<float,2>{0.0391851477f, 0.761125624f},
-std::array<float,2>{0.409659296f, 0.332298428f},
-std::array<float,2>{0.714227796f, 0.718825758f},
-std::array<float,2>{0.923029304f, 0.252812207f},
-std::array<float,2>{0.0608887672f, 0.670721173f},
-std::array<float,2>{0.434655905f, 0.180155218f},
-std::array<float,2>{0.689302027f, 0.837551653f},
-std::array<float,2>{0.588528216f, 0.000161426986f},
-std::array<float,2>{0.345254868f, 0.927347898f},
-std::array<float,2>{0.241870046f, 0.493255287f},
-std::array<float,2>{0.800822794f, 0.610215604f},
-std::array<float,2>{0.646703184f, 0.377149761f},
-std::array<float,2>{0.479664862f, 0.54032892f},
-std::array<float,2>{0.116740026f, 0.109213144f},
-std::array<float,2>{0.99373877f, 0.997999907f},
-std::array<float,2>{0.827086568f, 0.208019555f},
-std::array<float,2>{0.181933552f, 0.805000186f},
-std::array<float,2>{0.253346801f, 0.367215425f},
-std::array<float,2>{0.513129354f, 0.702258229f},
-std::array<float,2>{0.776579738f, 0.464490443f},
-std::array<float,2>{0.187662363f, 0.585368514f},
-std::array<float,2>{0.32152307f, 0.0560958572f},
-std::array<float,2>{0.623873234f, 0.890795767f},
-std::array<float,2>{0.741757572f, 0.148657531f},
-std::array<float,2>{0.401340842f, 0.853314221f},
-std::array<float,2>{0.00229115225f, 0.284342408f},
-std::array<float,2>{0.900298953f, 0.64238739f},
-std::array<float,2>{0.541427851f, 0.32925567f},
-std::array<float,2>{0.295739233f, 0.725043118f},
-std::array<float,2>{0.148590267f, 0.238672554f},
-std::array<float,2>{0.866349936f, 0.764473677f},
-std::array<float,2>{0.950769603f, 0.0897277743f},
-std::array<float,2>{0.0782572627f, 0.938227296f},
-std::array<float,2>{0.456465244f, 0.429991782f},
-std::array<float,2>{0.668754637f, 0.506222367f},
-std::array<float,2>{0.970716357f, 0.406250596f},
-std::array<float,2>{0.100713708f, 0.518803835f},
-std::array<float,2>{0.497497886f, 0.0684029236f},
-std::array<float,2>{0.627940834f, 0.96391058f},
-std::array<float,2>{0.529432535f, 0.232150257f},
-std::array<float,2>{0.278590471f, 0.774385035f},
-std::array<float,2>{0.169643611f, 0.317735076f},
-std::array<float,2>{0.834455609f, 0.742422104f},
-std::array<float,2>{0.707778394f, 0.307052583f},
-std::array<float,2>{0.41521129f, 0.635883927f},
-std::array<float,2>{0.0390139632f, 0.135344028f},
-std::array<float,2>{0.911961973f, 0.873034954f},
-std::array<float,2>{0.796821356f, 0.0428089313f},
-std::array<float,2>{0.229349941f, 0.882418573f},
-std::array<float,2>{0.367124498f, 0.444707155f},
-std::array<float,2>{0.569290519f, 0.572841167f},
-std::array<float,2>{0.855670869f, 0.358027071f},
-std::array<float,2>{0.137151659f, 0.710513353f},
-std::array<float,2>{0.302908808f, 0.196474984f},
-std::array<float,2>{0.561615467f, 0.785893261f},
-std::array<float,2>{0.679917455f, 0.113386817f},
-std::array<float,2>{0.448391527f, 0.982641935f},
-std::array<float,2>{0.0659651384f, 0.400016397f},
-std::array<float,2>{0.96672374f, 0.557304084f},
-std::array<float,2>{0.597047269f, 0.482076138f},
-std::array<float,2>{0.332799017f, 0.604828596f},
-std::array<float,2>{0.208695024f, 0.026648771f},
-std::array<float,2>{0.752210975f, 0.90759784f},
-std::array<float,2>{0.878553987f, 0.170088202f},
-std::array<float,2>{0.0210067518f, 0.823598623f},
-std::array<float,2>{0.377984107f, 0.268872023f},
-std::array<float,2>{0.733578563f, 0.683521032f},
-std::array<float,2>{0.953864396f, 0.324848086f},
-std::array<float,2>{0.0736840665f, 0.737926185f},
-std::array<float,2>{0.437802047f, 0.220413521f},
-std::array<float,2>{0.674449801f, 0.771912098f},
-std::array<float,2>{0.547127485f, 0.0727941543f},
-std::array<float,2>{0.305047572f, 0.960668921f},
-std::array<float,2>{0.13195464f, 0.419174701f},
-std::array<float,2>{0.847226083f, 0.528701901f},
-std::array<float,2>{0.72331357f, 0.452980369f},
-std::array<float,2>{0.383948475f, 0.564951956f},
-std::array<float,2>{0.030945329f, 0.0337032154f},
-std::array<float,2>{0.884691775f, 0.884643495f},
-std::array<float,2>{0.765343487f, 0.128527358f},
-std::array<float,2>{0.213734671f, 0.866411865f},
-std::array<float,2>{0.342802525f, 0.299471378f},
-std::array<float,2>{0.604332387f, 0.626387239f},
-std::array<float,2>{0.837065935f, 0.395677298f},
-std::array<float,2>{0.163810149f, 0.548794985f},
-std::array<float,2>{0.266437382f, 0.11984694f},
-std::array<float,2>{0.517114758f, 0.971616447f},
-std::array<float,2>{0.639197469f, 0.189080402f},
-std::array<float,2>{0.491286308f, 0.7950598f},
-std::array<float,2>{0.103227213f, 0.350399524f},
-std::array<float,2>{0.98330009f, 0.715823352f},
-std::array<float,2>{0.576674461f, 0.280782521f},
-std::array<float,2>{0.373499483f, 0.679634035f},
-std::array<float,2>{0.226427585f, 0.15834938f},
-std::array<float,2>{0.788030863f, 0.817877114f},
-std::array<float,2>{0.919662178f, 0.0234010667f},
-std::array<float,2>{0.0467176847f, 0.917063773f},
-std::array<float,2>{0.411919534f, 0.471064866f},
-std::array<float,2>{0.717252076f, 0.597799778f},
-std::array<float,2>{0.89760977f, 0.484667271f},
-std::array<float,2>{0.00916066766f, 0.618790865f},
-std::array<float,2>{0.39172861f, 0.0139242355f},
-std::array<float,2>{0.744877517f, 0.932612956f},
-std::array<float,2>{0.611758411f, 0.171877265f},
-std::array<float,2>{0.317923248f, 0.830070376f},
-std::array<float,2>{0.201285616f, 0.265114695f},
-std::array<float,2>{0.772291124f, 0.661514521f},
-std::array<float,2>{0.658636808f, 0.365237892f},
-std::array<float,2>{0.461767763f, 0.695048451f},
-std::array<float,2>{0.0898686796f, 0.214579821f},
-std::array<float,2>{0.941125631f, 0.803395748f},
-std::array<float,2>{0.868964016f, 0.0967956111f},
-std::array<float,2>{0.141798973f, 0.991935432f},
-std::array<float,2>{0.286232531f, 0.386686474f},
-std::array<float,2>{0.535421848f, 0.532589436f},
-std::array<float,2>{0.812198877f, 0.292464405f},
-std::array<float,2>{0.248360261f, 0.652397573f},
-std::array<float,2>{0.355564922f, 0.147792265f},
-std::array<float,2>{0.58581686f, 0.845441639f},
-std::array<float,2>{0.698676586f, 0.0511956774f},
-std::array<float,2>{0.428579956f, 0.901934862f},
-std::array<float,2>{0.0491576344f, 0.456571788f},
-std::array<float,2>{0.937255144f, 0.588122606f},
-std::array<float,2>{0.503544033f, 0.423569977f},
-std::array<float,2>{0.261563808f, 0.508030713f},
-std::array<float,2>{0.172436252f, 0.084590584f},
-std::array<float,2>{0.814509094f, 0.952425957f},
-std::array<float,2>{0.98506546f, 0.243043959f},
-std::array<float,2>{0.118556105f, 0.750402331f},
-std::array<float,2>{0.475907385f, 0.33634001f},
-std::array<float,2>{0.65417856f, 0.73090893f},
-std::array<float,2>{0.999038815f, 0.302408904f},
-std::array<float,2>{0.11207477f, 0.629218459f},
-std::array<float,2>{0.482602149f, 0.130302176f},
-std::array<float,2>{0.642939925f, 0.861751854f},
-std::array<float,2>{0.510133505f, 0.0387036018f},
-std::array<float,2>{0.256393582f, 0.888860703f},
-std::array<float,2>{0.185208932f, 0.448442042f},
-std::array<float,2>{0.821197033f, 0.569777608f},
-std::array<float,2>{0.693179607f, 0.414505035f},
-std::array<float,2>{0.432509899f, 0.524208665f},
-std::array<float,2>{0.0571208932f, 0.0766569152f},
-std::array<float,2>{0.929419696f, 0.956275105f},
-std::array<float,2>{0.797334611f, 0.2226744f},
-std::array<float,2>{0.235770434f, 0.767038107f},
-std::array<float,2>{0.349558502f, 0.322589815f},
-std::array<float,2>{0.592359304f, 0.741042674f},
-std::array<float,2>{0.861126065f, 0.472700447f},
-std::array<float,2>{0.154793203f, 0.597031653f},
-std::array<float,2>{0.292595327f, 0.0175979156f},
-std::array<float,2>{0.546740353f, 0.920516193f},
-std::array<float,2>{0.666923523f, 0.163734853f},
-std::array<float,2>{0.457814127f, 0.813549399f},
-std::array<float,2>{0.0820349306f, 0.274475843f},
-std::array<float,2>{0.945329666f, 0.672785103f},
-std::array<float,2>{0.617273808f, 0.344286352f},
-std::array<float,2>{0.325249523f, 0.714045525f},
-std::array<float,2>{0.193363801f, 0.195130065f},
-std::array<float,2>{0.779711545f, 0.791578114f},
-std::array<float,2>{0.903576791f, 0.122422807f},
-std::array<float,2>{0.00518679898f, 0.97546339f},
-std::array<float,2>{0.404862881f, 0.392025739f},
-std::array<float,2>{0.738243163f, 0.55405134f},
-std::array<float,2>{0.909777999f, 0.389221817f},
-std::array<float,2>{0.0318074636f, 0.535324991f},
-std::array<float,2>{0.419816375f, 0.0977665186f},
-std::array<float,2>{0.703314185f, 0.988249719f},
-std::array<float,2>{0.564942956f, 0.218634844f},
-std::array<float,2>{0.363193691f, 0.798303008f},
-std::array<float,2>{0.233944103f, 0.361340821f},
-std::array<float,2>{0.789990902f, 0.689789951f},
-std::array<float,2>{0.628928304f, 0.260505497f},
-std::array<float,2>{0.494963497f, 0.659820139f},
-std::array<float,2>{0.0956837907f, 0.178401947f},
-std::array<float,2>{0.972736001f, 0.833940864f},
-std::array<float,2>{0.831221402f, 0.008989227f},
-std::array<float,2>{0.165326297f, 0.936503053f},
-std::array<float,2>{0.275373489f, 0.492155284f},
-std::array<float,2>{0.523745179f, 0.624925196f},
-std::array<float,2>{0.755809724f, 0.341070414f},
-std::array<float,2>{0.203522444f, 0.726724088f},
-std::array<float,2>{0.331009686f, 0.248282418f},
-std::array<float,2>{0.601193726f, 0.754320323f},
-std::array<float,2>{0.727179468f, 0.0799508989f},
-std::array<float,2>{0.381685644f, 0.945660114f},
-std::array<float,2>{0.0174486972f, 0.427559555f},
-std::array<float,2>{0.88163048f, 0.514308453f},
-std::array<float,2>{0.555847228f, 0.459616691f},
-std::array<float,2>{0.299325794f, 0.591435373f},
-std::array<float,2>{0.135825619f, 0.0475513227f},
-std::array<float,2>{0.852233231f, 0.905720115f},
-std::array<float,2>{0.964150786f, 0.142377064f},
-std::array<float,2>{0.0676193312f, 0.849037945f},
-std::array<float,2>{0.451568604f, 0.29681024f},
-std::array<float,2>{0.685244203f, 0.649299026f},
-std::array<float,2>{0.888690233f, 0.374137104f},
-std::array<float,2>{0.0238662511f, 0.69645375f},
-std::array<float,2>{0.388225466f, 0.204961717f},
-std::array<float,2>{0.719631314f, 0.810485542f},
-std::array<float,2>{0.606478333f, 0.102184333f},
-std::array<float,2>{0.337137401f, 0.995966017f},
-std::array<float,2>{0.215052828f, 0.380968362f},
-std::array<float,2>{0.761074185f, 0.544464529f},
-std::array<float,2>{0.678490698f, 0.499741584f},
-std::array<float,2>{0.441685408f, 0.615846515f},
-std::array<float,2>{0.075092718f, 0.00747575192f},
-std::array<float,2>{0.959923565f, 0.925546169f},
-std::array<float,2>{0.850850463f, 0.185644597f},
-std::array<float,2>{0.1280635f, 0.842702866f},
-std::array<float,2>{0.312435389f, 0.257701993f},
-std::array<float,2>{0.552361846f, 0.66569674f},
-std::array<float,2>{0.784762442f, 0.436407655f},
-std::array<float,2>{0.218965024f, 0.500811577f},
-std::array<float,2>{0.36768949f, 0.0930998027f},
-std::array<float,2>{0.571673095f, 0.943543553f},
-std::array<float,2>{0.713231087f, 0.236792952f},
-std::array<float,2>{0.408662826f, 0.758422673f},
-std::array<float,2>{0.0407379791f, 0.335273415f},
-std::array<float,2>{0.914332092f, 0.722042501f},
-std::array<float,2>{0.521702468f, 0.288402796f},
-std::array<float,2>{0.27123189f, 0.647685647f},
-std::array<float,2>{0.157267749f, 0.153606653f},
-std::array<float,2>{0.843583405f, 0.857544482f},
-std::array<float,2>{0.978944063f, 0.0616116151f},
-std::array<float,2>{0.107469782f, 0.89575088f},
-std::array<float,2>{0.487788498f, 0.466763228f},
-std::array<float,2>{0.633780837f, 0.578517854f},
-std::array<float,2>{0.941963553f, 0.437972605f},
-std::array<float,2>{0.0891672f, 0.574754834f},
-std::array<float,2>{0.46720618f, 0.0454949029f},
-std::array<float,2>{0.660694718f, 0.876327813f},
-std::array<float,2>{0.534523845f, 0.137601331f},
-std::array<float,2>{0.281426251f, 0.870620191f},
-std::array<float,2>{0.147409275f, 0.312319905f},
-std::array<float,2>{0.873088121f, 0.639748573f},
-std::array<float,2>{0.746490002f, 0.312554955f},
-std::array<float,2>{0.395029724f, 0.746678412f},
-std::array<float,2>{0.0126284417f, 0.229441524f},
-std::array<float,2>{0.893105149f, 0.778366506f},
-std::array<float,2>{0.765681386f, 0.0627420321f},
-std::array<float,2>{0.196036264f, 0.965838075f},
-std::array<float,2>{0.313691348f, 0.413659275f},
-std::array<float,2>{0.61549598f, 0.519622743f},
-std::array<float,2>{0.819450676f, 0.272682369f},
-std::array<float,2>{0.179419562f, 0.684759557f},
-std::array<float,2>{0.263088942f, 0.166723609f},
-std::array<float,2>{0.504469752f, 0.825684965f},
-std::array<float,2>{0.651125491f, 0.0282084383f},
-std::array<float,2>{0.470765322f, 0.913308322f},
-std::array<float,2>{0.123540118f, 0.479293078f},
-std::array<float,2>{0.989844441f, 0.606468439f},
-std::array<float,2>{0.57814914f, 0.406208903f},
-std::array<float,2>{0.352934688f, 0.561833084f},
-std::array<float,2>{0.242541552f, 0.109805942f},
-std::array<float,2>{0.805205584f, 0.978040218f},
-std::array<float,2>{0.931314707f, 0.202286467f},
-std::array<float,2>{0.0536479652f, 0.782703638f},
-std::array<float,2>{0.422129214f, 0.353556782f},
-std::array<float,2>{0.700573027f, 0.707003236f},
-std::array<float,2>{0.902166426f, 0.281345487f},
-std::array<float,2>{0.000386307336f, 0.642602503f},
-std::array<float,2>{0.398544699f, 0.15234223f},
-std::array<float,2>{0.740225136f, 0.854643822f},
-std::array<float,2>{0.621911049f, 0.0577071495f},
-std::array<float,2>{0.323004067f, 0.892680109f},
-std::array<float,2>{0.19080539f, 0.461936802f},
-std::array<float,2>{0.774860382f, 0.583403528f},
-std::array<float,2>{0.670245707f, 0.43175602f},
-std::array<float,2>{0.454587877f, 0.505448222f},
-std::array<float,2>{0.081751354f, 0.0869433209f},
-std::array<float,2>{0.951607704f, 0.939787149f},
-std::array<float,2>{0.864705324f, 0.241948783f},
-std::array<float,2>{0.151810333f, 0.762336493f},
-std::array<float,2>{0.293542087f, 0.330375373f},
-std::array<float,2>{0.540755391f, 0.723553658f},
-std::array<float,2>{0.803786993f, 0.496083081f},
-std::array<float,2>{0.23839739f, 0.612988234f},
-std::array<float,2>{0.346195996f, 0.00381917087f},
-std::array<float,2>{0.5863778f, 0.928440571f},
-std::array<float,2>{0.690545321f, 0.183030784f},
-std::array<float,2>{0.435604572f, 0.838666856f},
-std::array<float,2>{0.059144333f, 0.251745582f},
-std::array<float,2>{0.925101876f, 0.668550909f},
-std::array<float,2>{0.514045537f, 0.369885713f},
-std::array<float,2>{0.250603974f, 0.700232506f},
-std::array<float,2>{0.181251809f, 0.210037336f},
-std::array<float,2>{0.824357331f, 0.808094442f},
-std::array<float,2>{0.995195448f, 0.106419899f},
-std::array<float,2>{0.113816723f, 0.998170614f},
-std::array<float,2>{0.47821188f, 0.376735955f},
-std::array<float,2>{0.644664288f, 0.542929113f},
-std::array<float,2>{0.968422055f, 0.400531471f},
-std::array<float,2>{0.0639269352f, 0.555729449f},
-std::array<float,2>{0.445956588f, 0.115273856f},
-std::array<float,2>{0.683306873f, 0.982344747f},
-std::array<float,2>{0.560171306f, 0.198898867f},
-std::array<float,2>{0.301984161f, 0.787643611f},
-std::array<float,2>{0.1396963f, 0.357056022f},
-std::array<float,2>{0.857992113f, 0.707300723f},
-std::array<float,2>{0.731503844f, 0.267471045f},
-std::array<float,2>{0.376405478f, 0.681338668f},
-std::array<float,2>{0.0228544325f, 0.168553695f},
-std::array<float,2>{0.876106203f, 0.820986271f},
-std::array<float,2>{0.750930965f, 0.0245109517f},
-std::array<float,2>{0.210058942f, 0.90849191f},
-std::array<float,2>{0.334115744f, 0.484327376f},
-std::array<float,2>{0.594891131f, 0.602138877f},
-std::array<float,2>{0.833421409f, 0.319455743f},
-std::array<float,2>{0.171123102f, 0.744909346f},
-std::array<float,2>{0.280839384f, 0.233009383f},
-std::array<float,2>{0.528251231f, 0.775990784f},
-std::array<float,2>{0.626049697f, 0.0665733889f},
-std::array<float,2>{0.499094039f, 0.962660015f},
-std::array<float,2>{0.0992933735f, 0.409576327f},
-std::array<float,2>{0.969447196f, 0.517502785f},
-std::array<float,2>{0.568282664f, 0.441810608f},
-std::array<float,2>{0.365022182f, 0.572173536f},
-std::array<float,2>{0.227889463f, 0.0405503139f},
-std::array<float,2>{0.793433249f, 0.880372465f},
-std::array<float,2>{0.913695693f, 0.133158445f},
-std::array<float,2>{0.0352175571f, 0.873567998f},
-std::array<float,2>{0.416082919f, 0.30547449f},
-std::array<float,2>{0.709643126f, 0.633526921f},
-std::array<float,2>{0.981026947f, 0.348438144f},
-std::array<float,2>{0.103525184f, 0.71805352f},
-std::array<float,2>{0.489375621f, 0.191052884f},
-std::array<float,2>{0.637806296f, 0.794849277f},
-std::array<float,2>{0.517952204f, 0.118107051f},
-std::array<float,2>{0.268339097f, 0.970177889f},
-std::array<float,2>{0.160360068f, 0.396769643f},
-std::array<float,2>{0.838332772f, 0.550591111f},
-std::array<float,2>{0.715426624f, 0.469868422f},
-std::array<float,2>{0.412981838f, 0.600767374f},
-std::array<float,2>{0.043709904f, 0.0205555316f},
-std::array<float,2>{0.919947326f, 0.914864421f},
-std::array<float,2>{0.785863459f, 0.157168925f},
-std::array<float,2>{0.224113569f, 0.819985747f},
-std::array<float,2>{0.37286666f, 0.278358698f},
-std::array<float,2>{0.575354636f, 0.676385999f},
-std::array<float,2>{0.844441593f, 0.421201795f},
-std::array<float,2>{0.129453942f, 0.529925644f},
-std::array<float,2>{0.306699872f, 0.0706223994f},
-std::array<float,2>{0.549062848f, 0.957535028f},
-std::array<float,2>{0.671963692f, 0.220928341f},
-std::array<float,2>{0.441133648f, 0.770654738f},
-std::array<float,2>{0.0709308684f, 0.32780543f},
-std::array<float,2>{0.956636906f, 0.73594147f},
-std::array<float,2>{0.601980448f, 0.297354102f},
-std::array<float,2>{0.34028402f, 0.628209352f},
-std::array<float,2>{0.212114349f, 0.126259387f},
-std::array<float,2>{0.762816429f, 0.863842726f},
-std::array<float,2>{0.885306418f, 0.0315810852f},
-std::array<float,2>{0.0275422148f, 0.885189176f},
-std::array<float,2>{0.385556847f, 0.450321406f},
-std::array<float,2>{0.726255953f, 0.562648058f},
-std::array<float,2>{0.935119152f, 0.45472911f},
-std::array<float,2>{0.047664158f, 0.586029887f},
-std::array<float,2>{0.425877631f, 0.0532613024f},
-std::array<float,2>{0.695940077f, 0.898987114f},
-std::array<float,2>{0.5826478f, 0.146221921f},
-std::array<float,2>{0.358362764f, 0.845913589f},
-std::array<float,2>{0.247774705f, 0.290973336f},
-std::array<float,2>{0.810258746f, 0.654622793f},
-std::array<float,2>{0.654725373f, 0.338266909f},
-std::array<float,2>{0.474226892f, 0.733357668f},
-std::array<float,2>{0.120163195f, 0.245086804f},
-std::array<float,2>{0.988074541f, 0.753257871f},
-std::array<float,2>{0.812709749f, 0.0820786804f},
-std::array<float,2>{0.174618185f, 0.950120866f},
-std::array<float,2>{0.258347929f, 0.425172091f},
-std::array<float,2>{0.501909196f, 0.511313021f},
-std::array<float,2>{0.770269215f, 0.263525188f},
-std::array<float,2>{0.199347988f, 0.662709653f},
-std::array<float,2>{0.319051087f, 0.175355762f},
-std::array<float,2>{0.610966623f, 0.831984758f},
-std::array<float,2>{0.742257953f, 0.0118515315f},
-std::array<float,2>{0.394038081f, 0.930427432f},
-std::array<float,2>{0.0107768411f, 0.488111019f},
-std::array<float,2>{0.894965768f, 0.620176494f},
-std::array<float,2>{0.538359702f, 0.384761781f},
-std::array<float,2>{0.288372368f, 0.533918321f},
-std::array<float,2>{0.143779904f, 0.0939137787f},
-std::array<float,2>{0.870751321f, 0.988921106f},
-std::array<float,2>{0.939151764f, 0.21239157f},
-std::array<float,2>{0.0919576585f, 0.801274598f},
-std::array<float,2>{0.463403672f, 0.363344342f},
-std::array<float,2>{0.658083439f, 0.692310631f},
-std::array<float,2>{0.948242247f, 0.277131736f},
-std::array<float,2>{0.085727632f, 0.675308108f},
-std::array<float,2>{0.459807605f, 0.161735639f},
-std::array<float,2>{0.665831089f, 0.814716756f},
-std::array<float,2>{0.544856012f, 0.0157147013f},
-std::array<float,2>{0.290370405f, 0.918714762f},
-std::array<float,2>{0.152617052f, 0.475638568f},
-std::array<float,2>{0.862031937f, 0.593895376f},
-std::array<float,2>{0.735607207f, 0.393498838f},
-std::array<float,2>{0.403982639f, 0.551184177f},
-std::array<float,2>{0.00682780845f, 0.124446534f},
-std::array<float,2>{0.904715121f, 0.97285527f},
-std::array<float,2>{0.778487742f, 0.19250451f},
-std::array<float,2>{0.192564204f, 0.78969413f},
-std::array<float,2>{0.327317625f, 0.346468031f},
-std::array<float,2>{0.620442271f, 0.711828709f},
-std::array<float,2>{0.823744774f, 0.445978612f},
-std::array<float,2>{0.185711443f, 0.567284822f},
-std::array<float,2>{0.255390227f, 0.0358124822f},
-std::array<float,2>{0.508443892f, 0.888509274f},
-std::array<float,2>{0.642370999f, 0.132118866f},
-std::array<float,2>{0.481688976f, 0.860866249f},
-std::array<float,2>{0.11056105f, 0.303315997f},
-std::array<float,2>{0.996933758f, 0.632766962f},
-std::array<float,2>{0.590130329f, 0.320516676f},
-std::array<float,2>{0.349973321f, 0.739180684f},
-std::array<float,2>{0.23740828f, 0.224734038f},
-std::array<float,2>{0.799095571f, 0.769006908f},
-std::array<float,2>{0.926539958f, 0.0757168159f},
-std::array<float,2>{0.0555090643f, 0.95430696f},
-std::array<float,2>{0.430581301f, 0.416445851f},
-std::array<float,2>{0.69508636f, 0.525781989f},
-std::array<float,2>{0.88050288f, 0.42960155f},
-std::array<float,2>{0.0182428025f, 0.513467073f},
-std::array<float,2>{0.379512757f, 0.0817504674f},
-std::array<float,2>{0.729494512f, 0.948243976f},
-std::array<float,2>{0.598168612f, 0.246516973f},
-std::array<float,2>{0.32919687f, 0.757113755f},
-std::array<float,2>{0.205097198f, 0.341845632f},
-std::array<float,2>{0.757719338f, 0.729204655f},
-std::array<float,2>{0.685606539f, 0.293746322f},
-std::array<float,2>{0.44989112f, 0.651324868f},
-std::array<float,2>{0.0698466226f, 0.142773673f},
-std::array<float,2>{0.962536752f, 0.850803554f},
-std::array<float,2>{0.854947209f, 0.0493904948f},
-std::array<float,2>{0.133300871f, 0.904230058f},
-std::array<float,2>{0.298088223f, 0.457362145f},
-std::array<float,2>{0.558414102f, 0.593278587f},
-std::array<float,2>{0.792094231f, 0.361112952f},
-std::array<float,2>{0.232007295f, 0.687574148f},
-std::array<float,2>{0.360332251f, 0.215477914f},
-std::array<float,2>{0.563108325f, 0.799950004f},
-std::array<float,2>{0.705733359f, 0.100561872f},
-std::array<float,2>{0.421316832f, 0.98495245f},
-std::array<float,2>{0.0336019807f, 0.387417853f},
-std::array<float,2>{0.906307638f, 0.537284136f},
-std::array<float,2>{0.526274979f, 0.488435179f},
-std::array<float,2>{0.275475562f, 0.622112632f},
-std::array<float,2>{0.16712822f, 0.0103338175f},
-std::array<float,2>{0.828493416f, 0.935543954f},
-std::array<float,2>{0.975200295f, 0.176790446f},
-std::array<float,2>{0.0960917547f, 0.834074378f},
-std::array<float,2>{0.492459774f, 0.258293867f},
-std::array<float,2>{0.632068157f, 0.657284737f},
-std::array<float,2>{0.917937338f, 0.333794087f},
-std::array<float,2>{0.0414001718f, 0.720591009f},
-std::array<float,2>{0.406655997f, 0.234746814f},
-std::array<float,2>{0.711582065f, 0.760022283f},
-std::array<float,2>{0.57368958f, 0.0905938894f},
-std::array<float,2>{0.369847327f, 0.943223953f},
-std::array<float,2>{0.222353235f, 0.433927864f},
-std::array<float,2>{0.78130579f, 0.502867639f},
-std::array<float,2>{0.634987295f, 0.46770066f},
-std::array<float,2>{0.485249251f, 0.581435323f},
-std::array<float,2>{0.107270963f, 0.0602209307f},
-std::array<float,2>{0.977695107f, 0.89687705f},
-std::array<float,2>{0.840334594f, 0.15512082f},
-std::array<float,2>{0.158638224f, 0.856926024f},
-std::array<float,2>{0.272995025f, 0.286021799f},
-std::array<float,2>{0.519933343f, 0.64648056f},
-std::array<float,2>{0.757813215f, 0.380804658f},
-std::array<float,2>{0.218033314f, 0.546829939f},
-std::array<float,2>{0.339557171f, 0.105093867f},
-std::array<float,2>{0.608738542f, 0.993692398f},
-std::array<float,2>{0.722510576f, 0.206400752f},
-std::array<float,2>{0.390009642f, 0.811950326f},
-std::array<float,2>{0.0261423122f, 0.371299386f},
-std::array<float,2>{0.888538361f, 0.69757247f},
-std::array<float,2>{0.553148866f, 0.255645245f},
-std::array<float,2>{0.309591949f, 0.666090906f},
-std::array<float,2>{0.126769185f, 0.184980288f},
-std::array<float,2>{0.849582493f, 0.841058314f},
-std::array<float,2>{0.957955122f, 0.00487691583f},
-std::array<float,2>{0.0763523504f, 0.92190814f},
-std::array<float,2>{0.443578571f, 0.496706963f},
-std::array<float,2>{0.67625767f, 0.613339603f},
-std::array<float,2>{0.99112922f, 0.478039056f},
-std::array<float,2>{0.122556642f, 0.608523071f},
-std::array<float,2>{0.469026268f, 0.0300253481f},
-std::array<float,2>{0.64929229f, 0.911937416f},
-std::array<float,2>{0.506437957f, 0.165095001f},
-std::array<float,2>{0.264893323f, 0.82653445f},
-std::array<float,2>{0.176489681f, 0.270649731f},
-std::array<float,2>{0.817509234f, 0.687497556f},
-std::array<float,2>{0.702070475f, 0.352821767f},
-std::array<float,2>{0.4246957f, 0.703950226f},
-std::array<float,2>{0.0514677912f, 0.200218663f},
-std::array<float,2>{0.932367384f, 0.78512609f},
-std::array<float,2>{0.807299972f, 0.113089547f},
-std::array<float,2>{0.244922385f, 0.979351878f},
-std::array<float,2>{0.355358958f, 0.403282046f},
-std::array<float,2>{0.580709338f, 0.559009671f},
-std::array<float,2>{0.872029483f, 0.310238719f},
-std::array<float,2>{0.145794928f, 0.637781441f},
-std::array<float,2>{0.28502804f, 0.140591413f},
-std::array<float,2>{0.532518208f, 0.868801475f},
-std::array<float,2>{0.662688494f, 0.0447220653f},
-std::array<float,2>{0.465019047f, 0.877493083f},
-std::array<float,2>{0.0862771049f, 0.441134483f},
-std::array<float,2>{0.944324791f, 0.577751219f},
-std::array<float,2>{0.614258528f, 0.410816282f},
-std::array<float,2>{0.316120833f, 0.522088945f},
-std::array<float,2>{0.197777376f, 0.0653498322f},
-std::array<float,2>{0.769365907f, 0.966830671f},
-std::array<float,2>{0.891441345f, 0.227046579f},
-std::array<float,2>{0.014424555f, 0.779906094f},
-std::array<float,2>{0.398138285f, 0.314511687f},
-std::array<float,2>{0.748727739f, 0.748242199f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.883592904f, 0.999218464f},
-std::array<float,2>{0.0124713713f, 0.289313197f},
-std::array<float,2>{0.745835483f, 0.148082405f},
-std::array<float,2>{0.281595916f, 0.651482582f},
-std::array<float,2>{0.562557697f, 0.613206029f},
-std::array<float,2>{0.390519142f, 0.0334747285f},
-std::array<float,2>{0.771256447f, 0.440627158f},
-std::array<float,2>{0.234012067f, 0.768598855f},
-std::array<float,2>{0.643842757f, 0.831316292f},
-std::array<float,2>{0.362439722f, 0.409788817f},
-std::array<float,2>{0.982576787f, 0.105988413f},
-std::array<float,2>{0.118236862f, 0.553332627f},
-std::array<float,2>{0.829581499f, 0.694221139f},
-std::array<float,2>{0.183686107f, 0.197797865f},
-std::array<float,2>{0.540763021f, 0.332349777f},
-std::array<float,2>{0.485284239f, 0.889515817f},
-std::array<float,2>{0.807884276f, 0.80629015f},
-std::array<float,2>{0.201130122f, 0.473728716f},
-std::array<float,2>{0.603679061f, 0.0217401478f},
-std::array<float,2>{0.408633679f, 0.591246486f},
-std::array<float,2>{0.701156437f, 0.662559688f},
-std::array<float,2>{0.264263421f, 0.158696309f},
-std::array<float,2>{0.936502993f, 0.255593151f},
-std::array<float,2>{0.0476608127f, 0.950348794f},
-std::array<float,2>{0.514041305f, 0.936852932f},
-std::array<float,2>{0.43950507f, 0.352892309f},
-std::array<float,2>{0.849822581f, 0.24337317f},
-std::array<float,2>{0.14875108f, 0.733280718f},
-std::array<float,2>{0.944441199f, 0.514158726f},
-std::array<float,2>{0.0669560581f, 0.0878768042f},
-std::array<float,2>{0.661676466f, 0.40382129f},
-std::array<float,2>{0.327845097f, 0.84614104f},
-std::array<float,2>{0.996702492f, 0.859486103f},
-std::array<float,2>{0.107487507f, 0.383037269f},
-std::array<float,2>{0.637271404f, 0.0716041774f},
-std::array<float,2>{0.355286121f, 0.527405143f},
-std::array<float,2>{0.549993217f, 0.736132979f},
-std::array<float,2>{0.471980184f, 0.223130673f},
-std::array<float,2>{0.824374735f, 0.37334466f},
-std::array<float,2>{0.163077489f, 0.914337933f},
-std::array<float,2>{0.728708506f, 0.961286128f},
-std::array<float,2>{0.305703491f, 0.277711242f},
-std::array<float,2>{0.904215157f, 0.174093917f},
-std::array<float,2>{0.0252421312f, 0.682625651f},
-std::array<float,2>{0.753010809f, 0.571421564f},
-std::array<float,2>{0.244207308f, 0.0111479918f},
-std::array<float,2>{0.585862815f, 0.499456942f},
-std::array<float,2>{0.404334456f, 0.781964123f},
-std::array<float,2>{0.868803144f, 0.899807572f},
-std::array<float,2>{0.126350105f, 0.312945306f},
-std::array<float,2>{0.530535638f, 0.209702164f},
-std::array<float,2>{0.460533381f, 0.715290725f},
-std::array<float,2>{0.674485505f, 0.536817133f},
-std::array<float,2>{0.342959076f, 0.11825598f},
-std::array<float,2>{0.954522133f, 0.433118403f},
-std::array<float,2>{0.0850277171f, 0.819965422f},
-std::array<float,2>{0.624705255f, 0.764042795f},
-std::array<float,2>{0.428004503f, 0.457739323f},
-std::array<float,2>{0.787633538f, 0.0512403511f},
-std::array<float,2>{0.213239163f, 0.598309875f},
-std::array<float,2>{0.920198262f, 0.628989756f},
-std::array<float,2>{0.0358522385f, 0.134967968f},
-std::array<float,2>{0.706098497f, 0.300836384f},
-std::array<float,2>{0.28098613f, 0.974981785f},
-std::array<float,2>{0.964160144f, 0.911877632f},
-std::array<float,2>{0.0916796476f, 0.360505939f},
-std::array<float,2>{0.681166947f, 0.233867928f},
-std::array<float,2>{0.334530562f, 0.746884167f},
-std::array<float,2>{0.522763133f, 0.517721832f},
-std::array<float,2>{0.461880922f, 0.0663733035f},
-std::array<float,2>{0.865651727f, 0.375024468f},
-std::array<float,2>{0.140376315f, 0.872978032f},
-std::array<float,2>{0.713725626f, 0.794287145f},
-std::array<float,2>{0.272099733f, 0.491759449f},
-std::array<float,2>{0.910482526f, 0.00410918193f},
-std::array<float,2>{0.0392333046f, 0.563910902f},
-std::array<float,2>{0.79435128f, 0.676856518f},
-std::array<float,2>{0.208039656f, 0.186606914f},
-std::array<float,2>{0.613942921f, 0.267393082f},
-std::array<float,2>{0.434190243f, 0.958560944f},
-std::array<float,2>{0.815176427f, 0.82404083f},
-std::array<float,2>{0.164914757f, 0.423939675f},
-std::array<float,2>{0.55616194f, 0.113435075f},
-std::array<float,2>{0.481767237f, 0.541599572f},
-std::array<float,2>{0.628866076f, 0.70803082f},
-std::array<float,2>{0.347546756f, 0.216362014f},
-std::array<float,2>{0.989449859f, 0.322703779f},
-std::array<float,2>{0.0975092277f, 0.896973491f},
-std::array<float,2>{0.592867613f, 0.983719647f},
-std::array<float,2>{0.394370496f, 0.306787372f},
-std::array<float,2>{0.763996303f, 0.130189493f},
-std::array<float,2>{0.237279773f, 0.639787734f},
-std::array<float,2>{0.89600116f, 0.605855107f},
-std::array<float,2>{0.0166342817f, 0.0597877651f},
-std::array<float,2>{0.722221434f, 0.464874476f},
-std::array<float,2>{0.299126834f, 0.755345225f},
-std::array<float,2>{0.9229213f, 0.773979664f},
-std::array<float,2>{0.0622994937f, 0.448792249f},
-std::array<float,2>{0.690513372f, 0.0397377908f},
-std::array<float,2>{0.250815809f, 0.617703319f},
-std::array<float,2>{0.593873739f, 0.647604942f},
-std::array<float,2>{0.418158591f, 0.15107426f},
-std::array<float,2>{0.80184412f, 0.284500241f},
-std::array<float,2>{0.194865778f, 0.990406394f},
-std::array<float,2>{0.671335876f, 0.878530502f},
-std::array<float,2>{0.316082448f, 0.340337485f},
-std::array<float,2>{0.947099447f, 0.19069469f},
-std::array<float,2>{0.0703700781f, 0.697197139f},
-std::array<float,2>{0.857268929f, 0.557238638f},
-std::array<float,2>{0.145322785f, 0.1012109f},
-std::array<float,2>{0.502549887f, 0.417733818f},
-std::array<float,2>{0.448849261f, 0.84173739f},
-std::array<float,2>{0.774033308f, 0.941355109f},
-std::array<float,2>{0.221187741f, 0.258148432f},
-std::array<float,2>{0.577695727f, 0.170366287f},
-std::array<float,2>{0.379415661f, 0.664361477f},
-std::array<float,2>{0.737067044f, 0.585441828f},
-std::array<float,2>{0.293661833f, 0.0298491586f},
-std::array<float,2>{0.877859533f, 0.481199414f},
-std::array<float,2>{0.00095267978f, 0.801008523f},
-std::array<float,2>{0.5354321f, 0.854211152f},
-std::array<float,2>{0.499608099f, 0.391580075f},
-std::array<float,2>{0.842336595f, 0.0811070278f},
-std::array<float,2>{0.176064923f, 0.502055645f},
-std::array<float,2>{0.97506994f, 0.722670436f},
-std::array<float,2>{0.111614071f, 0.23593618f},
-std::array<float,2>{0.652966559f, 0.350374401f},
-std::array<float,2>{0.374473304f, 0.92720437f},
-std::array<float,2>{0.907448411f, 0.886717141f},
-std::array<float,2>{0.0459546633f, 0.328358024f},
-std::array<float,2>{0.717612684f, 0.200279474f},
-std::array<float,2>{0.268906742f, 0.689569175f},
-std::array<float,2>{0.611312449f, 0.546917498f},
-std::array<float,2>{0.429878831f, 0.105330795f},
-std::array<float,2>{0.791983902f, 0.410842389f},
-std::array<float,2>{0.204743996f, 0.835045218f},
-std::array<float,2>{0.687213719f, 0.77130729f},
-std::array<float,2>{0.329402238f, 0.444063216f},
-std::array<float,2>{0.96843642f, 0.0380318426f},
-std::array<float,2>{0.0872086808f, 0.617051542f},
-std::array<float,2>{0.862936437f, 0.653364837f},
-std::array<float,2>{0.134674355f, 0.142911643f},
-std::array<float,2>{0.518505692f, 0.295320541f},
-std::array<float,2>{0.467662036f, 0.993925571f},
-std::array<float,2>{0.758882463f, 0.848615646f},
-std::array<float,2>{0.238389f, 0.401350081f},
-std::array<float,2>{0.588949025f, 0.0934428051f},
-std::array<float,2>{0.395488918f, 0.510576189f},
-std::array<float,2>{0.722980797f, 0.728328943f},
-std::array<float,2>{0.301189601f, 0.248605594f},
-std::array<float,2>{0.891999304f, 0.357610852f},
-std::array<float,2>{0.0229474828f, 0.932474434f},
-std::array<float,2>{0.56047982f, 0.947586954f},
-std::array<float,2>{0.47794345f, 0.252018124f},
-std::array<float,2>{0.820023596f, 0.162841976f},
-std::array<float,2>{0.171157107f, 0.65892458f},
-std::array<float,2>{0.984842777f, 0.588861525f},
-std::array<float,2>{0.098801136f, 0.0160652045f},
-std::array<float,2>{0.629538536f, 0.471173555f},
-std::array<float,2>{0.347832859f, 0.80998075f},
-std::array<float,2>{0.952198088f, 0.786063433f},
-std::array<float,2>{0.0780127048f, 0.495085001f},
-std::array<float,2>{0.66416198f, 0.0143285794f},
-std::array<float,2>{0.320262045f, 0.575975239f},
-std::array<float,2>{0.506456196f, 0.684418797f},
-std::array<float,2>{0.452923864f, 0.177800953f},
-std::array<float,2>{0.855216742f, 0.276630133f},
-std::array<float,2>{0.141860962f, 0.965981185f},
-std::array<float,2>{0.693262219f, 0.919282019f},
-std::array<float,2>{0.254000306f, 0.368261606f},
-std::array<float,2>{0.926236272f, 0.220299765f},
-std::array<float,2>{0.0548891239f, 0.739250779f},
-std::array<float,2>{0.800092578f, 0.52450788f},
-std::array<float,2>{0.18829985f, 0.0776501f},
-std::array<float,2>{0.599602938f, 0.389725447f},
-std::array<float,2>{0.414520323f, 0.863414526f},
-std::array<float,2>{0.836372375f, 0.970149875f},
-std::array<float,2>{0.17472434f, 0.30055958f},
-std::array<float,2>{0.53320688f, 0.137938336f},
-std::array<float,2>{0.495173723f, 0.626743793f},
-std::array<float,2>{0.651307285f, 0.596203566f},
-std::array<float,2>{0.368453354f, 0.0472490489f},
-std::array<float,2>{0.970191479f, 0.453148067f},
-std::array<float,2>{0.115541495f, 0.759308934f},
-std::array<float,2>{0.572023034f, 0.813920677f},
-std::array<float,2>{0.377680808f, 0.43686685f},
-std::array<float,2>{0.77784121f, 0.124755859f},
-std::array<float,2>{0.223169744f, 0.53339678f},
-std::array<float,2>{0.880283952f, 0.711444438f},
-std::array<float,2>{0.00492018647f, 0.206505418f},
-std::array<float,2>{0.742148519f, 0.316492945f},
-std::array<float,2>{0.289496869f, 0.904649258f},
-std::array<float,2>{0.97862345f, 0.954405427f},
-std::array<float,2>{0.122927614f, 0.270444721f},
-std::array<float,2>{0.645899415f, 0.18161571f},
-std::array<float,2>{0.366664976f, 0.675386608f},
-std::array<float,2>{0.545252144f, 0.566666424f},
-std::array<float,2>{0.490662932f, 0.000920480234f},
-std::array<float,2>{0.832254112f, 0.485904008f},
-std::array<float,2>{0.182020366f, 0.791298628f},
-std::array<float,2>{0.749789059f, 0.868180633f},
-std::array<float,2>{0.28740415f, 0.379040837f},
-std::array<float,2>{0.889801741f, 0.0681856647f},
-std::array<float,2>{0.00909840595f, 0.519663632f},
-std::array<float,2>{0.767885149f, 0.745835185f},
-std::array<float,2>{0.230387181f, 0.229181886f},
-std::array<float,2>{0.568459272f, 0.36572805f},
-std::array<float,2>{0.384132981f, 0.909348726f},
-std::array<float,2>{0.846252859f, 0.751951396f},
-std::array<float,2>{0.152797148f, 0.461994082f},
-std::array<float,2>{0.511213779f, 0.0557212755f},
-std::array<float,2>{0.445062518f, 0.604521751f},
-std::array<float,2>{0.657544911f, 0.636193037f},
-std::array<float,2>{0.323595732f, 0.127475962f},
-std::array<float,2>{0.937792182f, 0.310781449f},
-std::array<float,2>{0.0660280511f, 0.979857683f},
-std::array<float,2>{0.606064379f, 0.892814815f},
-std::array<float,2>{0.411176682f, 0.326748401f},
-std::array<float,2>{0.810429871f, 0.212221354f},
-std::array<float,2>{0.195767939f, 0.706006944f},
-std::array<float,2>{0.929705441f, 0.543608427f},
-std::array<float,2>{0.054283388f, 0.110497102f},
-std::array<float,2>{0.695712149f, 0.429085433f},
-std::array<float,2>{0.258279175f, 0.826976001f},
-std::array<float,2>{0.898753047f, 0.838336229f},
-std::array<float,2>{0.0310983807f, 0.420964062f},
-std::array<float,2>{0.732248843f, 0.0941361189f},
-std::array<float,2>{0.311755896f, 0.560464203f},
-std::array<float,2>{0.581989467f, 0.70084393f},
-std::array<float,2>{0.401807576f, 0.192483395f},
-std::array<float,2>{0.755265117f, 0.337143511f},
-std::array<float,2>{0.249721766f, 0.880289495f},
-std::array<float,2>{0.633892357f, 0.985551894f},
-std::array<float,2>{0.355654925f, 0.288804293f},
-std::array<float,2>{0.995663106f, 0.155241951f},
-std::array<float,2>{0.103069156f, 0.643547714f},
-std::array<float,2>{0.822582126f, 0.623996735f},
-std::array<float,2>{0.156923145f, 0.045342125f},
-std::array<float,2>{0.551019132f, 0.451818615f},
-std::array<float,2>{0.472740352f, 0.779575527f},
-std::array<float,2>{0.783417583f, 0.923630297f},
-std::array<float,2>{0.218585745f, 0.347601891f},
-std::array<float,2>{0.619732082f, 0.238374442f},
-std::array<float,2>{0.425104231f, 0.720492065f},
-std::array<float,2>{0.710326135f, 0.50473845f},
-std::array<float,2>{0.273646921f, 0.082179226f},
-std::array<float,2>{0.917389929f, 0.394753009f},
-std::array<float,2>{0.033020746f, 0.857687831f},
-std::array<float,2>{0.523779631f, 0.797697067f},
-std::array<float,2>{0.453215897f, 0.477821529f},
-std::array<float,2>{0.874532282f, 0.0251146685f},
-std::array<float,2>{0.129815236f, 0.579744577f},
-std::array<float,2>{0.958816886f, 0.670793653f},
-std::array<float,2>{0.0795109943f, 0.165082246f},
-std::array<float,2>{0.678925812f, 0.263947159f},
-std::array<float,2>{0.338763952f, 0.942846894f},
-std::array<float,2>{0.935398459f, 0.952248693f},
-std::array<float,2>{0.0503313243f, 0.257365197f},
-std::array<float,2>{0.702196836f, 0.158152848f},
-std::array<float,2>{0.263411283f, 0.661339045f},
-std::array<float,2>{0.602693677f, 0.592371225f},
-std::array<float,2>{0.407712787f, 0.0209708698f},
-std::array<float,2>{0.805670917f, 0.475442559f},
-std::array<float,2>{0.202882349f, 0.807137072f},
-std::array<float,2>{0.662500739f, 0.844187558f},
-std::array<float,2>{0.325059891f, 0.404767245f},
-std::array<float,2>{0.943003058f, 0.088078402f},
-std::array<float,2>{0.068848148f, 0.512955189f},
-std::array<float,2>{0.849422991f, 0.73199147f},
-std::array<float,2>{0.15144743f, 0.245701626f},
-std::array<float,2>{0.513273358f, 0.354238749f},
-std::array<float,2>{0.438397348f, 0.935064018f},
-std::array<float,2>{0.772514164f, 0.766526282f},
-std::array<float,2>{0.230730653f, 0.438549668f},
-std::array<float,2>{0.564870358f, 0.0323582552f},
-std::array<float,2>{0.388634175f, 0.609754145f},
-std::array<float,2>{0.743078411f, 0.649906933f},
-std::array<float,2>{0.284414828f, 0.145111039f},
-std::array<float,2>{0.885495722f, 0.292882323f},
-std::array<float,2>{0.0141164716f, 0.996165454f},
-std::array<float,2>{0.542518437f, 0.88724941f},
-std::array<float,2>{0.486522883f, 0.334300786f},
-std::array<float,2>{0.830352366f, 0.196182147f},
-std::array<float,2>{0.186095119f, 0.69224298f},
-std::array<float,2>{0.981571019f, 0.551037073f},
-std::array<float,2>{0.120182194f, 0.107979596f},
-std::array<float,2>{0.642153859f, 0.406953037f},
-std::array<float,2>{0.360591948f, 0.829278171f},
-std::array<float,2>{0.955127597f, 0.817790031f},
-std::array<float,2>{0.0828973204f, 0.430580676f},
-std::array<float,2>{0.673615038f, 0.120735645f},
-std::array<float,2>{0.340243965f, 0.537915766f},
-std::array<float,2>{0.528706551f, 0.717716336f},
-std::array<float,2>{0.457113475f, 0.207946286f},
-std::array<float,2>{0.869511962f, 0.315532357f},
-std::array<float,2>{0.127051324f, 0.90145129f},
-std::array<float,2>{0.70466435f, 0.973652244f},
-std::array<float,2>{0.278824508f, 0.303146243f},
-std::array<float,2>{0.918101847f, 0.133011639f},
-std::array<float,2>{0.0384845175f, 0.632322967f},
-std::array<float,2>{0.786782026f, 0.601317406f},
-std::array<float,2>{0.211301312f, 0.0532138906f},
-std::array<float,2>{0.622828841f, 0.459109098f},
-std::array<float,2>{0.426666707f, 0.762943625f},
-std::array<float,2>{0.826229095f, 0.91629076f},
-std::array<float,2>{0.161766574f, 0.371316135f},
-std::array<float,2>{0.548436522f, 0.225632444f},
-std::array<float,2>{0.469692618f, 0.737431884f},
-std::array<float,2>{0.639010072f, 0.531059504f},
-std::array<float,2>{0.3519921f, 0.0737992823f},
-std::array<float,2>{0.99935472f, 0.385392129f},
-std::array<float,2>{0.107202709f, 0.86232394f},
-std::array<float,2>{0.582686841f, 0.783697903f},
-std::array<float,2>{0.403428406f, 0.497476935f},
-std::array<float,2>{0.751044512f, 0.00915366225f},
-std::array<float,2>{0.242219344f, 0.57269752f},
-std::array<float,2>{0.905031085f, 0.681388319f},
-std::array<float,2>{0.0272303168f, 0.172287464f},
-std::array<float,2>{0.728148282f, 0.279417902f},
-std::array<float,2>{0.308061182f, 0.963170767f},
-std::array<float,2>{0.990523517f, 0.894699275f},
-std::array<float,2>{0.0942970663f, 0.321558774f},
-std::array<float,2>{0.625416279f, 0.218177512f},
-std::array<float,2>{0.344389826f, 0.709910035f},
-std::array<float,2>{0.557794273f, 0.540515423f},
-std::array<float,2>{0.483888686f, 0.115484461f},
-std::array<float,2>{0.81401366f, 0.422782481f},
-std::array<float,2>{0.167181343f, 0.82192874f},
-std::array<float,2>{0.719065189f, 0.756372035f},
-std::array<float,2>{0.298276871f, 0.468662709f},
-std::array<float,2>{0.896608055f, 0.0620203763f},
-std::array<float,2>{0.018230848f, 0.607732415f},
-std::array<float,2>{0.76228404f, 0.637109935f},
-std::array<float,2>{0.234832793f, 0.131141365f},
-std::array<float,2>{0.590670586f, 0.306402773f},
-std::array<float,2>{0.390846819f, 0.980753422f},
-std::array<float,2>{0.864905f, 0.873183072f},
-std::array<float,2>{0.137131155f, 0.377815455f},
-std::array<float,2>{0.520482063f, 0.0625029802f},
-std::array<float,2>{0.463532418f, 0.515954554f},
-std::array<float,2>{0.68205595f, 0.749196053f},
-std::array<float,2>{0.333799809f, 0.231608346f},
-std::array<float,2>{0.961806178f, 0.36292249f},
-std::array<float,2>{0.0924524963f, 0.913752913f},
-std::array<float,2>{0.615665615f, 0.959474146f},
-std::array<float,2>{0.435617983f, 0.267964512f},
-std::array<float,2>{0.796112776f, 0.18447338f},
-std::array<float,2>{0.209693298f, 0.679454207f},
-std::array<float,2>{0.913962543f, 0.566250026f},
-std::array<float,2>{0.0410329103f, 0.00594740873f},
-std::array<float,2>{0.711386979f, 0.489508361f},
-std::array<float,2>{0.269743204f, 0.796766043f},
-std::array<float,2>{0.876322627f, 0.804472089f},
-std::array<float,2>{0.00198330032f, 0.48281455f},
-std::array<float,2>{0.735567212f, 0.0289943255f},
-std::array<float,2>{0.294929534f, 0.583815396f},
-std::array<float,2>{0.575886667f, 0.666384876f},
-std::array<float,2>{0.381022006f, 0.16990529f},
-std::array<float,2>{0.777273297f, 0.260409206f},
-std::array<float,2>{0.219152555f, 0.939053237f},
-std::array<float,2>{0.654590547f, 0.927768111f},
-std::array<float,2>{0.372397274f, 0.349197686f},
-std::array<float,2>{0.973203659f, 0.23801899f},
-std::array<float,2>{0.110399097f, 0.725474775f},
-std::array<float,2>{0.840496123f, 0.501684844f},
-std::array<float,2>{0.178979501f, 0.0782424361f},
-std::array<float,2>{0.538529754f, 0.393965364f},
-std::array<float,2>{0.496163338f, 0.852761507f},
-std::array<float,2>{0.803084075f, 0.989624977f},
-std::array<float,2>{0.192488089f, 0.282259226f},
-std::array<float,2>{0.596649826f, 0.149863273f},
-std::array<float,2>{0.421114802f, 0.644740105f},
-std::array<float,2>{0.689128697f, 0.620865941f},
-std::array<float,2>{0.253816336f, 0.0422659554f},
-std::array<float,2>{0.924762785f, 0.445906907f},
-std::array<float,2>{0.0593085028f, 0.776192605f},
-std::array<float,2>{0.500829935f, 0.84278667f},
-std::array<float,2>{0.445479065f, 0.414827585f},
-std::array<float,2>{0.858557165f, 0.0983280018f},
-std::array<float,2>{0.146711275f, 0.556191266f},
-std::array<float,2>{0.949176788f, 0.698064446f},
-std::array<float,2>{0.0726942793f, 0.187913641f},
-std::array<float,2>{0.669389427f, 0.34228754f},
-std::array<float,2>{0.31398353f, 0.875279725f},
-std::array<float,2>{0.894385636f, 0.930407584f},
-std::array<float,2>{0.0197923873f, 0.357318252f},
-std::array<float,2>{0.725150108f, 0.246669665f},
-std::array<float,2>{0.303052604f, 0.730077624f},
-std::array<float,2>{0.58598423f, 0.508720875f},
-std::array<float,2>{0.397445649f, 0.0905871391f},
-std::array<float,2>{0.761297584f, 0.399300992f},
-std::array<float,2>{0.241317272f, 0.851329625f},
-std::array<float,2>{0.631964087f, 0.810616255f},
-std::array<float,2>{0.350022227f, 0.469740599f},
-std::array<float,2>{0.986934423f, 0.01951929f},
-std::array<float,2>{0.100827247f, 0.587077796f},
-std::array<float,2>{0.81656903f, 0.656929135f},
-std::array<float,2>{0.169170141f, 0.161101758f},
-std::array<float,2>{0.561931133f, 0.250592977f},
-std::array<float,2>{0.479074329f, 0.946269989f},
-std::array<float,2>{0.790776551f, 0.832387686f},
-std::array<float,2>{0.205909729f, 0.413610309f},
-std::array<float,2>{0.612300396f, 0.103181779f},
-std::array<float,2>{0.432957917f, 0.548961222f},
-std::array<float,2>{0.716465354f, 0.689073741f},
-std::array<float,2>{0.267447233f, 0.202211916f},
-std::array<float,2>{0.909928024f, 0.330332279f},
-std::array<float,2>{0.0434421189f, 0.884263456f},
-std::array<float,2>{0.515987933f, 0.994611382f},
-std::array<float,2>{0.465451837f, 0.293519825f},
-std::array<float,2>{0.860068619f, 0.142207518f},
-std::array<float,2>{0.136465117f, 0.655531168f},
-std::array<float,2>{0.966295779f, 0.614129484f},
-std::array<float,2>{0.088977769f, 0.0366255417f},
-std::array<float,2>{0.684259415f, 0.441625893f},
-std::array<float,2>{0.330616981f, 0.771703362f},
-std::array<float,2>{0.972056627f, 0.760319531f},
-std::array<float,2>{0.114099398f, 0.45598197f},
-std::array<float,2>{0.649769545f, 0.05004986f},
-std::array<float,2>{0.370203584f, 0.595211565f},
-std::array<float,2>{0.531533897f, 0.628521442f},
-std::array<float,2>{0.493662387f, 0.140096337f},
-std::array<float,2>{0.839571714f, 0.29882589f},
-std::array<float,2>{0.173459664f, 0.971705139f},
-std::array<float,2>{0.738308847f, 0.904158115f},
-std::array<float,2>{0.291540116f, 0.319069147f},
-std::array<float,2>{0.881975949f, 0.203669176f},
-std::array<float,2>{0.0070502148f, 0.71385175f},
-std::array<float,2>{0.78071022f, 0.532108188f},
-std::array<float,2>{0.22475943f, 0.121179797f},
-std::array<float,2>{0.57339263f, 0.433686674f},
-std::array<float,2>{0.375818908f, 0.814774513f},
-std::array<float,2>{0.852877378f, 0.967454672f},
-std::array<float,2>{0.144041866f, 0.274157107f},
-std::array<float,2>{0.504841805f, 0.176066235f},
-std::array<float,2>{0.450123727f, 0.685644448f},
-std::array<float,2>{0.666960657f, 0.577053487f},
-std::array<float,2>{0.318352669f, 0.0130177895f},
-std::array<float,2>{0.950878263f, 0.492944896f},
-std::array<float,2>{0.0754264221f, 0.787888527f},
-std::array<float,2>{0.600027323f, 0.866023898f},
-std::array<float,2>{0.417193532f, 0.387671322f},
-std::array<float,2>{0.797296166f, 0.075453192f},
-std::array<float,2>{0.191271827f, 0.5256387f},
-std::array<float,2>{0.929184914f, 0.741745472f},
-std::array<float,2>{0.0573455021f, 0.222307861f},
-std::array<float,2>{0.694267392f, 0.370792329f},
-std::array<float,2>{0.257141262f, 0.921726227f},
-std::array<float,2>{0.941206753f, 0.977691174f},
-std::array<float,2>{0.0638326854f, 0.310318559f},
-std::array<float,2>{0.659538627f, 0.125218928f},
-std::array<float,2>{0.321954101f, 0.634292722f},
-std::array<float,2>{0.508754075f, 0.602550805f},
-std::array<float,2>{0.442191571f, 0.0566857457f},
-std::array<float,2>{0.845093429f, 0.46361199f},
-std::array<float,2>{0.155367568f, 0.752732396f},
-std::array<float,2>{0.698319674f, 0.824918449f},
-std::array<float,2>{0.261565149f, 0.427185804f},
-std::array<float,2>{0.931777894f, 0.112706557f},
-std::array<float,2>{0.0513629802f, 0.545635283f},
-std::array<float,2>{0.812388122f, 0.703245223f},
-std::array<float,2>{0.197911382f, 0.213603586f},
-std::array<float,2>{0.608435094f, 0.32581082f},
-std::array<float,2>{0.412515432f, 0.890679955f},
-std::array<float,2>{0.835494697f, 0.79069376f},
-std::array<float,2>{0.180158123f, 0.487777174f},
-std::array<float,2>{0.543461382f, 0.00312193669f},
-std::array<float,2>{0.48934558f, 0.569295108f},
-std::array<float,2>{0.647378802f, 0.672636747f},
-std::array<float,2>{0.364572048f, 0.18251057f},
-std::array<float,2>{0.977658331f, 0.271627903f},
-std::array<float,2>{0.123767689f, 0.956770003f},
-std::array<float,2>{0.568086863f, 0.906575561f},
-std::array<float,2>{0.386647671f, 0.364622086f},
-std::array<float,2>{0.766739309f, 0.227991387f},
-std::array<float,2>{0.227453142f, 0.743383706f},
-std::array<float,2>{0.887085915f, 0.522458673f},
-std::array<float,2>{0.0102507481f, 0.0695069954f},
-std::array<float,2>{0.747021437f, 0.382265836f},
-std::array<float,2>{0.286917835f, 0.870562136f},
-std::array<float,2>{0.914585888f, 0.856837034f},
-std::array<float,2>{0.0334363915f, 0.396664768f},
-std::array<float,2>{0.707952678f, 0.085502848f},
-std::array<float,2>{0.276031226f, 0.506512225f},
-std::array<float,2>{0.619108379f, 0.721026182f},
-std::array<float,2>{0.423641622f, 0.24128978f},
-std::array<float,2>{0.782207727f, 0.344395071f},
-std::array<float,2>{0.215134278f, 0.925156415f},
-std::array<float,2>{0.677587986f, 0.943538547f},
-std::array<float,2>{0.336569339f, 0.262037814f},
-std::array<float,2>{0.959290862f, 0.167617083f},
-std::array<float,2>{0.0813213363f, 0.668338478f},
-std::array<float,2>{0.871342123f, 0.580857694f},
-std::array<float,2>{0.131650165f, 0.0265743583f},
-std::array<float,2>{0.526903689f, 0.478543282f},
-std::array<float,2>{0.455800772f, 0.799438477f},
-std::array<float,2>{0.757644415f, 0.882534385f},
-std::array<float,2>{0.247915909f, 0.338836402f},
-std::array<float,2>{0.578611016f, 0.195222527f},
-std::array<float,2>{0.399379879f, 0.702280581f},
-std::array<float,2>{0.733855844f, 0.562015474f},
-std::array<float,2>{0.310303628f, 0.0963753313f},
-std::array<float,2>{0.902112782f, 0.418232143f},
-std::array<float,2>{0.0285831019f, 0.837137401f},
-std::array<float,2>{0.553525329f, 0.777549803f},
-std::array<float,2>{0.475601435f, 0.44973433f},
-std::array<float,2>{0.820797443f, 0.0436801873f},
-std::array<float,2>{0.158434778f, 0.622300982f},
-std::array<float,2>{0.993094325f, 0.641162634f},
-std::array<float,2>{0.105034493f, 0.154040426f},
-std::array<float,2>{0.636190474f, 0.286738664f},
-std::array<float,2>{0.358444244f, 0.988139749f},
-std::array<float,2>{0.919039726f, 0.975790024f},
-std::array<float,2>{0.0375653319f, 0.302580178f},
-std::array<float,2>{0.703204453f, 0.1363969f},
-std::array<float,2>{0.277622551f, 0.63026619f},
-std::array<float,2>{0.621118665f, 0.599377096f},
-std::array<float,2>{0.427496105f, 0.0526451878f},
-std::array<float,2>{0.786065876f, 0.458538055f},
-std::array<float,2>{0.212561026f, 0.765109062f},
-std::array<float,2>{0.67271632f, 0.819155335f},
-std::array<float,2>{0.34130761f, 0.432046324f},
-std::array<float,2>{0.956160069f, 0.117971659f},
-std::array<float,2>{0.0833394378f, 0.535907209f},
-std::array<float,2>{0.870716393f, 0.71600318f},
-std::array<float,2>{0.127947181f, 0.2100849f},
-std::array<float,2>{0.527488589f, 0.314242452f},
-std::array<float,2>{0.458816379f, 0.898517668f},
-std::array<float,2>{0.750959933f, 0.782976925f},
-std::array<float,2>{0.243570685f, 0.498392403f},
-std::array<float,2>{0.583874583f, 0.00989238638f},
-std::array<float,2>{0.402573287f, 0.570783615f},
-std::array<float,2>{0.727402389f, 0.68179065f},
-std::array<float,2>{0.306999266f, 0.17544502f},
-std::array<float,2>{0.906041801f, 0.278460294f},
-std::array<float,2>{0.025532037f, 0.962016821f},
-std::array<float,2>{0.546926558f, 0.915132105f},
-std::array<float,2>{0.470416635f, 0.374983162f},
-std::array<float,2>{0.827552259f, 0.224300086f},
-std::array<float,2>{0.1609146f, 0.734948397f},
-std::array<float,2>{0.998475134f, 0.528719187f},
-std::array<float,2>{0.106327072f, 0.0705955252f},
-std::array<float,2>{0.63986814f, 0.384578288f},
-std::array<float,2>{0.352924168f, 0.860513091f},
-std::array<float,2>{0.941894233f, 0.847205102f},
-std::array<float,2>{0.0696331859f, 0.402639806f},
-std::array<float,2>{0.663642168f, 0.0867114812f},
-std::array<float,2>{0.326159239f, 0.515219033f},
-std::array<float,2>{0.512357116f, 0.733608902f},
-std::array<float,2>{0.438995034f, 0.242856845f},
-std::array<float,2>{0.848208547f, 0.352215409f},
-std::array<float,2>{0.150392413f, 0.935925245f},
-std::array<float,2>{0.701735139f, 0.949877083f},
-std::array<float,2>{0.262112051f, 0.254644662f},
-std::array<float,2>{0.934408784f, 0.159354061f},
-std::array<float,2>{0.0496783406f, 0.663930833f},
-std::array<float,2>{0.804758489f, 0.58997339f},
-std::array<float,2>{0.201259494f, 0.0234185252f},
-std::array<float,2>{0.602382064f, 0.473225951f},
-std::array<float,2>{0.407019943f, 0.805274606f},
-std::array<float,2>{0.831546426f, 0.889864504f},
-std::array<float,2>{0.187125459f, 0.333501846f},
-std::array<float,2>{0.541713476f, 0.198949143f},
-std::array<float,2>{0.487891823f, 0.69513154f},
-std::array<float,2>{0.640744984f, 0.554442823f},
-std::array<float,2>{0.359772414f, 0.106494516f},
-std::array<float,2>{0.981115341f, 0.40866071f},
-std::array<float,2>{0.120026134f, 0.830087781f},
-std::array<float,2>{0.56611371f, 0.768152773f},
-std::array<float,2>{0.387077689f, 0.440047503f},
-std::array<float,2>{0.772245884f, 0.0346138328f},
-std::array<float,2>{0.231956244f, 0.612197995f},
-std::array<float,2>{0.886017799f, 0.65123117f},
-std::array<float,2>{0.0146796713f, 0.147174835f},
-std::array<float,2>{0.743701935f, 0.290993541f},
-std::array<float,2>{0.283849895f, 0.998321414f},
-std::array<float,2>{0.974269569f, 0.926069736f},
-std::array<float,2>{0.109718345f, 0.350749016f},
-std::array<float,2>{0.656153083f, 0.235112399f},
-std::array<float,2>{0.371384948f, 0.724455774f},
-std::array<float,2>{0.537255466f, 0.503341496f},
-std::array<float,2>{0.497998774f, 0.0807532147f},
-std::array<float,2>{0.840894818f, 0.391827941f},
-std::array<float,2>{0.178507343f, 0.85465616f},
-std::array<float,2>{0.734450281f, 0.802185237f},
-std::array<float,2>{0.296746284f, 0.481994748f},
-std::array<float,2>{0.875616312f, 0.0303653702f},
-std::array<float,2>{0.00386852538f, 0.584500313f},
-std::array<float,2>{0.775554955f, 0.665995359f},
-std::array<float,2>{0.220578089f, 0.171375334f},
-std::array<float,2>{0.575109482f, 0.259590417f},
-std::array<float,2>{0.382441163f, 0.940047681f},
-std::array<float,2>{0.85767132f, 0.840268552f},
-std::array<float,2>{0.147854507f, 0.416037142f},
-std::array<float,2>{0.501357198f, 0.100548819f},
-std::array<float,2>{0.446811199f, 0.558521926f},
-std::array<float,2>{0.668829978f, 0.695334017f},
-std::array<float,2>{0.313409835f, 0.189781517f},
-std::array<float,2>{0.947417855f, 0.341335088f},
-std::array<float,2>{0.0734125823f, 0.877725601f},
-std::array<float,2>{0.597369134f, 0.99213624f},
-std::array<float,2>{0.419980794f, 0.283369839f},
-std::array<float,2>{0.804046154f, 0.152168289f},
-std::array<float,2>{0.192196786f, 0.646830618f},
-std::array<float,2>{0.924890995f, 0.618659258f},
-std::array<float,2>{0.0604379363f, 0.0404235534f},
-std::array<float,2>{0.687544703f, 0.447550118f},
-std::array<float,2>{0.25249052f, 0.775083303f},
-std::array<float,2>{0.898144484f, 0.754858971f},
-std::array<float,2>{0.0187140498f, 0.466045409f},
-std::array<float,2>{0.719828248f, 0.0587342978f},
-std::array<float,2>{0.297134399f, 0.607081711f},
-std::array<float,2>{0.590827942f, 0.639369726f},
-std::array<float,2>{0.391701132f, 0.128912777f},
-std::array<float,2>{0.763101697f, 0.308309197f},
-std::array<float,2>{0.235514581f, 0.983040094f},
-std::array<float,2>{0.62688905f, 0.89759028f},
-std::array<float,2>{0.345635176f, 0.323646486f},
-std::array<float,2>{0.991699398f, 0.215728492f},
-std::array<float,2>{0.0951742902f, 0.707586169f},
-std::array<float,2>{0.813363433f, 0.5427531f},
-std::array<float,2>{0.166788578f, 0.114400752f},
-std::array<float,2>{0.557548106f, 0.424944997f},
-std::array<float,2>{0.482427388f, 0.822857678f},
-std::array<float,2>{0.795102954f, 0.957365155f},
-std::array<float,2>{0.210159302f, 0.265636891f},
-std::array<float,2>{0.616836071f, 0.185565352f},
-std::array<float,2>{0.437137365f, 0.675899386f},
-std::array<float,2>{0.712767243f, 0.56262815f},
-std::array<float,2>{0.271217912f, 0.00528110098f},
-std::array<float,2>{0.912755251f, 0.49114427f},
-std::array<float,2>{0.0421593785f, 0.793618143f},
-std::array<float,2>{0.521095872f, 0.8718431f},
-std::array<float,2>{0.464157939f, 0.376719475f},
-std::array<float,2>{0.864073634f, 0.0647888556f},
-std::array<float,2>{0.137701035f, 0.518778205f},
-std::array<float,2>{0.962847412f, 0.747461915f},
-std::array<float,2>{0.0928600058f, 0.23258011f},
-std::array<float,2>{0.683248997f, 0.359654933f},
-std::array<float,2>{0.332631886f, 0.910876513f},
-std::array<float,2>{0.881817341f, 0.906105578f},
-std::array<float,2>{0.00623908127f, 0.317785054f},
-std::array<float,2>{0.739339948f, 0.205437571f},
-std::array<float,2>{0.292600483f, 0.712281406f},
-std::array<float,2>{0.572499216f, 0.534223855f},
-std::array<float,2>{0.376102716f, 0.123217754f},
-std::array<float,2>{0.779890656f, 0.43587622f},
-std::array<float,2>{0.225666821f, 0.81288445f},
-std::array<float,2>{0.649177194f, 0.758116901f},
-std::array<float,2>{0.370094419f, 0.45469445f},
-std::array<float,2>{0.970731199f, 0.0487497374f},
-std::array<float,2>{0.114323884f, 0.597570777f},
-std::array<float,2>{0.838803947f, 0.625512183f},
-std::array<float,2>{0.172285289f, 0.137290284f},
-std::array<float,2>{0.532233894f, 0.299019486f},
-std::array<float,2>{0.492696881f, 0.968763292f},
-std::array<float,2>{0.798455894f, 0.864905536f},
-std::array<float,2>{0.190014377f, 0.389288336f},
-std::array<float,2>{0.600922465f, 0.0764562413f},
-std::array<float,2>{0.416089535f, 0.523448408f},
-std::array<float,2>{0.695273519f, 0.739307284f},
-std::array<float,2>{0.255913943f, 0.218984067f},
-std::array<float,2>{0.927785516f, 0.367736489f},
-std::array<float,2>{0.057682503f, 0.918598592f},
-std::array<float,2>{0.505169928f, 0.965339959f},
-std::array<float,2>{0.450489908f, 0.276342422f},
-std::array<float,2>{0.852046967f, 0.179574013f},
-std::array<float,2>{0.142974794f, 0.684859395f},
-std::array<float,2>{0.95013684f, 0.575030208f},
-std::array<float,2>{0.0742557347f, 0.0155456346f},
-std::array<float,2>{0.667496204f, 0.496000797f},
-std::array<float,2>{0.316907585f, 0.786386013f},
-std::array<float,2>{0.987315595f, 0.80939889f},
-std::array<float,2>{0.100526229f, 0.472025633f},
-std::array<float,2>{0.631497145f, 0.0171382409f},
-std::array<float,2>{0.351426125f, 0.589294314f},
-std::array<float,2>{0.561378658f, 0.659974635f},
-std::array<float,2>{0.479986042f, 0.163510427f},
-std::array<float,2>{0.818124175f, 0.253838211f},
-std::array<float,2>{0.167993307f, 0.949158728f},
-std::array<float,2>{0.72646147f, 0.933561981f},
-std::array<float,2>{0.304465711f, 0.359163433f},
-std::array<float,2>{0.893287659f, 0.249683976f},
-std::array<float,2>{0.021338651f, 0.727338791f},
-std::array<float,2>{0.759869456f, 0.51153928f},
-std::array<float,2>{0.241075024f, 0.0926467329f},
-std::array<float,2>{0.586978674f, 0.40207234f},
-std::array<float,2>{0.39785701f, 0.848766327f},
-std::array<float,2>{0.861305714f, 0.992369294f},
-std::array<float,2>{0.134813979f, 0.296031356f},
-std::array<float,2>{0.517334402f, 0.144074127f},
-std::array<float,2>{0.466105282f, 0.652401745f},
-std::array<float,2>{0.685173631f, 0.615993261f},
-std::array<float,2>{0.331801981f, 0.0386440866f},
-std::array<float,2>{0.965217233f, 0.445309609f},
-std::array<float,2>{0.0885367617f, 0.770292222f},
-std::array<float,2>{0.613198876f, 0.834167361f},
-std::array<float,2>{0.431718498f, 0.411574513f},
-std::array<float,2>{0.789273024f, 0.104377359f},
-std::array<float,2>{0.206298381f, 0.548478305f},
-std::array<float,2>{0.908626437f, 0.69140172f},
-std::array<float,2>{0.0442920774f, 0.199323997f},
-std::array<float,2>{0.715491593f, 0.329913437f},
-std::array<float,2>{0.266272068f, 0.885032952f},
-std::array<float,2>{0.960291982f, 0.941432059f},
-std::array<float,2>{0.0807080194f, 0.265610665f},
-std::array<float,2>{0.676227868f, 0.164693013f},
-std::array<float,2>{0.337877184f, 0.671183348f},
-std::array<float,2>{0.525862336f, 0.578593433f},
-std::array<float,2>{0.456271708f, 0.0235971734f},
-std::array<float,2>{0.872705519f, 0.477127999f},
-std::array<float,2>{0.132127389f, 0.798629463f},
-std::array<float,2>{0.708216429f, 0.859007895f},
-std::array<float,2>{0.276853174f, 0.395512104f},
-std::array<float,2>{0.915434659f, 0.0833107382f},
-std::array<float,2>{0.0348083638f, 0.5052315f},
-std::array<float,2>{0.783183694f, 0.718881011f},
-std::array<float,2>{0.215916306f, 0.240084991f},
-std::array<float,2>{0.618039906f, 0.346342623f},
-std::array<float,2>{0.422249287f, 0.922242105f},
-std::array<float,2>{0.821896255f, 0.780529678f},
-std::array<float,2>{0.15975146f, 0.452601224f},
-std::array<float,2>{0.554082751f, 0.0466487855f},
-std::array<float,2>{0.475231111f, 0.624265254f},
-std::array<float,2>{0.635675728f, 0.644391716f},
-std::array<float,2>{0.35788852f, 0.155686051f},
-std::array<float,2>{0.993724167f, 0.287805289f},
-std::array<float,2>{0.104328729f, 0.985171854f},
-std::array<float,2>{0.579861939f, 0.879618704f},
-std::array<float,2>{0.399888039f, 0.336630315f},
-std::array<float,2>{0.755969524f, 0.191736162f},
-std::array<float,2>{0.246459335f, 0.700143874f},
-std::array<float,2>{0.900836289f, 0.55949837f},
-std::array<float,2>{0.0282241032f, 0.0947676972f},
-std::array<float,2>{0.733030438f, 0.420127273f},
-std::array<float,2>{0.309544802f, 0.839583695f},
-std::array<float,2>{0.93287909f, 0.82752794f},
-std::array<float,2>{0.0520191602f, 0.428046584f},
-std::array<float,2>{0.697868168f, 0.110288292f},
-std::array<float,2>{0.259952158f, 0.544672191f},
-std::array<float,2>{0.608288884f, 0.706359029f},
-std::array<float,2>{0.413535506f, 0.211763844f},
-std::array<float,2>{0.810717225f, 0.327937663f},
-std::array<float,2>{0.198664039f, 0.893938482f},
-std::array<float,2>{0.658333957f, 0.97940886f},
-std::array<float,2>{0.321038067f, 0.312138349f},
-std::array<float,2>{0.939562142f, 0.128575861f},
-std::array<float,2>{0.062838912f, 0.634883404f},
-std::array<float,2>{0.844452739f, 0.603996575f},
-std::array<float,2>{0.154950738f, 0.054952383f},
-std::array<float,2>{0.50925076f, 0.461392641f},
-std::array<float,2>{0.443263084f, 0.750748873f},
-std::array<float,2>{0.765982032f, 0.909168303f},
-std::array<float,2>{0.228354722f, 0.366231292f},
-std::array<float,2>{0.567059994f, 0.229503974f},
-std::array<float,2>{0.385481954f, 0.744309902f},
-std::array<float,2>{0.747237682f, 0.521368742f},
-std::array<float,2>{0.285631716f, 0.067071192f},
-std::array<float,2>{0.887883365f, 0.380110472f},
-std::array<float,2>{0.0115382373f, 0.867647767f},
-std::array<float,2>{0.544398725f, 0.79238236f},
-std::array<float,2>{0.489051431f, 0.485004008f},
-std::array<float,2>{0.834907293f, 0.00161594665f},
-std::array<float,2>{0.180789649f, 0.567990303f},
-std::array<float,2>{0.976740897f, 0.674063087f},
-std::array<float,2>{0.124922112f, 0.17992413f},
-std::array<float,2>{0.648087621f, 0.271413207f},
-std::array<float,2>{0.363919824f, 0.953560889f},
-std::array<float,2>{0.902600646f, 0.96452117f},
-std::array<float,2>{0.0236368179f, 0.280306131f},
-std::array<float,2>{0.730225027f, 0.172911763f},
-std::array<float,2>{0.30509907f, 0.680456281f},
-std::array<float,2>{0.584331691f, 0.574042141f},
-std::array<float,2>{0.405709147f, 0.00814753119f},
-std::array<float,2>{0.752042949f, 0.49677965f},
-std::array<float,2>{0.245658532f, 0.784511328f},
-std::array<float,2>{0.638095558f, 0.861704171f},
-std::array<float,2>{0.353610665f, 0.386452824f},
-std::array<float,2>{0.997315168f, 0.0730399564f},
-std::array<float,2>{0.10871239f, 0.529959977f},
-std::array<float,2>{0.825202227f, 0.736523032f},
-std::array<float,2>{0.163399011f, 0.225558177f},
-std::array<float,2>{0.54975903f, 0.372407377f},
-std::array<float,2>{0.470912039f, 0.917903721f},
-std::array<float,2>{0.788693249f, 0.762310565f},
-std::array<float,2>{0.214635924f, 0.460021168f},
-std::array<float,2>{0.623539984f, 0.0543020219f},
-std::array<float,2>{0.428814441f, 0.600087106f},
-std::array<float,2>{0.705345988f, 0.630964994f},
-std::array<float,2>{0.280126244f, 0.133805409f},
-std::array<float,2>{0.921121836f, 0.304112524f},
-std::array<float,2>{0.0367095359f, 0.972902775f},
-std::array<float,2>{0.530231833f, 0.901251495f},
-std::array<float,2>{0.459781677f, 0.31533736f},
-std::array<float,2>{0.867883265f, 0.20880352f},
-std::array<float,2>{0.125018597f, 0.717939436f},
-std::array<float,2>{0.953944087f, 0.538210869f},
-std::array<float,2>{0.0845158547f, 0.119987346f},
-std::array<float,2>{0.675443888f, 0.431275994f},
-std::array<float,2>{0.341976732f, 0.816890955f},
-std::array<float,2>{0.983445346f, 0.828643739f},
-std::array<float,2>{0.117995135f, 0.407479614f},
-std::array<float,2>{0.642650545f, 0.108401053f},
-std::array<float,2>{0.361597866f, 0.552374244f},
-std::array<float,2>{0.539729893f, 0.692501724f},
-std::array<float,2>{0.486040682f, 0.19694759f},
-std::array<float,2>{0.828139782f, 0.335848749f},
-std::array<float,2>{0.185337067f, 0.887734711f},
-std::array<float,2>{0.744828939f, 0.997364104f},
-std::array<float,2>{0.282666862f, 0.291250676f},
-std::array<float,2>{0.883898914f, 0.1462138f},
-std::array<float,2>{0.0129421391f, 0.648549736f},
-std::array<float,2>{0.769600987f, 0.610744953f},
-std::array<float,2>{0.232470185f, 0.0320544541f},
-std::array<float,2>{0.563553095f, 0.437539667f},
-std::array<float,2>{0.389645189f, 0.766999543f},
-std::array<float,2>{0.850854576f, 0.93451649f},
-std::array<float,2>{0.149892718f, 0.355105877f},
-std::array<float,2>{0.515430689f, 0.244635388f},
-std::array<float,2>{0.440853715f, 0.730684936f},
-std::array<float,2>{0.660222113f, 0.512389123f},
-std::array<float,2>{0.326192886f, 0.0892741606f},
-std::array<float,2>{0.94344306f, 0.405619264f},
-std::array<float,2>{0.0681397989f, 0.845261335f},
-std::array<float,2>{0.604768693f, 0.808476925f},
-std::array<float,2>{0.409205496f, 0.476377219f},
-std::array<float,2>{0.807195783f, 0.0204602145f},
-std::array<float,2>{0.20015502f, 0.59320879f},
-std::array<float,2>{0.937264025f, 0.661091924f},
-std::array<float,2>{0.0479714982f, 0.156412587f},
-std::array<float,2>{0.699998081f, 0.256368369f},
-std::array<float,2>{0.265239298f, 0.951846957f},
-std::array<float,2>{0.946270168f, 0.876926959f},
-std::array<float,2>{0.0719991773f, 0.3437078f},
-std::array<float,2>{0.670010984f, 0.189369425f},
-std::array<float,2>{0.314824849f, 0.698894918f},
-std::array<float,2>{0.503540516f, 0.555070698f},
-std::array<float,2>{0.447903991f, 0.0990176871f},
-std::array<float,2>{0.856148362f, 0.416008502f},
-std::array<float,2>{0.146470144f, 0.842227519f},
-std::array<float,2>{0.689473987f, 0.776900232f},
-std::array<float,2>{0.251134276f, 0.446876764f},
-std::array<float,2>{0.922206223f, 0.0418102331f},
-std::array<float,2>{0.0605702139f, 0.619196892f},
-std::array<float,2>{0.801209211f, 0.646036685f},
-std::array<float,2>{0.193782389f, 0.149286702f},
-std::array<float,2>{0.595327497f, 0.281575292f},
-std::array<float,2>{0.419595361f, 0.989076912f},
-std::array<float,2>{0.843560219f, 0.852133989f},
-std::array<float,2>{0.176770911f, 0.392876625f},
-std::array<float,2>{0.536755383f, 0.0792326555f},
-std::array<float,2>{0.498362303f, 0.500570774f},
-std::array<float,2>{0.653891742f, 0.72596252f},
-std::array<float,2>{0.373099983f, 0.237005755f},
-std::array<float,2>{0.976553977f, 0.348468155f},
-std::array<float,2>{0.112418406f, 0.929382205f},
-std::array<float,2>{0.576738238f, 0.937670767f},
-std::array<float,2>{0.380574435f, 0.261536509f},
-std::array<float,2>{0.775230467f, 0.168558121f},
-std::array<float,2>{0.222357392f, 0.667774796f},
-std::array<float,2>{0.878196657f, 0.58264488f},
-std::array<float,2>{0.00106311066f, 0.0277989842f},
-std::array<float,2>{0.737313449f, 0.483993679f},
-std::array<float,2>{0.293981671f, 0.803064704f},
-std::array<float,2>{0.911666393f, 0.795855761f},
-std::array<float,2>{0.0405917428f, 0.488811314f},
-std::array<float,2>{0.714645267f, 0.00775527488f},
-std::array<float,2>{0.272589892f, 0.56507355f},
-std::array<float,2>{0.614367664f, 0.677928627f},
-std::array<float,2>{0.435314089f, 0.185501799f},
-std::array<float,2>{0.793570817f, 0.26936242f},
-std::array<float,2>{0.20738931f, 0.960587561f},
-std::array<float,2>{0.679958403f, 0.912320971f},
-std::array<float,2>{0.335814387f, 0.361569524f},
-std::array<float,2>{0.963571727f, 0.230999842f},
-std::array<float,2>{0.0898500383f, 0.748179555f},
-std::array<float,2>{0.86635685f, 0.517109036f},
-std::array<float,2>{0.139170319f, 0.0641107261f},
-std::array<float,2>{0.522251427f, 0.378474325f},
-std::array<float,2>{0.462574601f, 0.874154866f},
-std::array<float,2>{0.7655496f, 0.981973588f},
-std::array<float,2>{0.237848192f, 0.305282205f},
-std::array<float,2>{0.592599988f, 0.132110238f},
-std::array<float,2>{0.392956346f, 0.638244689f},
-std::array<float,2>{0.72084564f, 0.609309375f},
-std::array<float,2>{0.299930125f, 0.0612980425f},
-std::array<float,2>{0.895502031f, 0.467655122f},
-std::array<float,2>{0.0159296393f, 0.757070005f},
-std::array<float,2>{0.555526137f, 0.820738494f},
-std::array<float,2>{0.480560303f, 0.423557967f},
-std::array<float,2>{0.816256821f, 0.117166162f},
-std::array<float,2>{0.165939465f, 0.539670646f},
-std::array<float,2>{0.989216506f, 0.710017562f},
-std::array<float,2>{0.0961660147f, 0.217525631f},
-std::array<float,2>{0.627617836f, 0.321234643f},
-std::array<float,2>{0.346332967f, 0.896154404f},
-std::array<float,2>{0.927637398f, 0.920233727f},
-std::array<float,2>{0.0558480471f, 0.369907022f},
-std::array<float,2>{0.692265749f, 0.221588403f},
-std::array<float,2>{0.255470008f, 0.740843534f},
-std::array<float,2>{0.598161459f, 0.52645272f},
-std::array<float,2>{0.415466517f, 0.0751407146f},
-std::array<float,2>{0.799070954f, 0.388657391f},
-std::array<float,2>{0.18896088f, 0.866859257f},
-std::array<float,2>{0.665842831f, 0.788256705f},
-std::array<float,2>{0.319304913f, 0.493907273f},
-std::array<float,2>{0.951599181f, 0.0126305642f},
-std::array<float,2>{0.0768974647f, 0.577765107f},
-std::array<float,2>{0.853595853f, 0.687149942f},
-std::array<float,2>{0.140652761f, 0.177415103f},
-std::array<float,2>{0.50741452f, 0.275049686f},
-std::array<float,2>{0.451426148f, 0.968261361f},
-std::array<float,2>{0.778659403f, 0.815620422f},
-std::array<float,2>{0.224109307f, 0.435369194f},
-std::array<float,2>{0.570793986f, 0.12232323f},
-std::array<float,2>{0.37865445f, 0.532424986f},
-std::array<float,2>{0.740494668f, 0.714500785f},
-std::array<float,2>{0.290975988f, 0.204160482f},
-std::array<float,2>{0.879774928f, 0.320221305f},
-std::array<float,2>{0.0043863235f, 0.90289855f},
-std::array<float,2>{0.53506881f, 0.971652389f},
-std::array<float,2>{0.494969964f, 0.296996087f},
-std::array<float,2>{0.83710593f, 0.138743386f},
-std::array<float,2>{0.175087661f, 0.627584934f},
-std::array<float,2>{0.969004214f, 0.594030142f},
-std::array<float,2>{0.116493478f, 0.0494585373f},
-std::array<float,2>{0.651623666f, 0.456683904f},
-std::array<float,2>{0.367380738f, 0.76086539f},
-std::array<float,2>{0.966918468f, 0.772860885f},
-std::array<float,2>{0.0866481662f, 0.442724824f},
-std::array<float,2>{0.685834885f, 0.0357523561f},
-std::array<float,2>{0.328726649f, 0.61493659f},
-std::array<float,2>{0.519411743f, 0.654971361f},
-std::array<float,2>{0.468584388f, 0.140743613f},
-std::array<float,2>{0.86221844f, 0.294605464f},
-std::array<float,2>{0.132926911f, 0.996046782f},
-std::array<float,2>{0.71801728f, 0.883409083f},
-std::array<float,2>{0.268543452f, 0.331675112f},
-std::array<float,2>{0.906377256f, 0.201340199f},
-std::array<float,2>{0.0455379076f, 0.688098133f},
-std::array<float,2>{0.792480886f, 0.550096095f},
-std::array<float,2>{0.20376581f, 0.1017216f},
-std::array<float,2>{0.609496295f, 0.412694126f},
-std::array<float,2>{0.431091011f, 0.833906054f},
-std::array<float,2>{0.818631053f, 0.947154105f},
-std::array<float,2>{0.170103565f, 0.251330048f},
-std::array<float,2>{0.55880779f, 0.161487401f},
-std::array<float,2>{0.476635247f, 0.657664239f},
-std::array<float,2>{0.630800903f, 0.586031079f},
-std::array<float,2>{0.349571943f, 0.0180618204f},
-std::array<float,2>{0.985927641f, 0.468907714f},
-std::array<float,2>{0.098542355f, 0.811766565f},
-std::array<float,2>{0.588294089f, 0.850501239f},
-std::array<float,2>{0.396037072f, 0.399672151f},
-std::array<float,2>{0.758715451f, 0.0909281448f},
-std::array<float,2>{0.239297777f, 0.508880138f},
-std::array<float,2>{0.891019106f, 0.729415894f},
-std::array<float,2>{0.0216015689f, 0.247413173f},
-std::array<float,2>{0.723942935f, 0.355587214f},
-std::array<float,2>{0.301759839f, 0.93152231f},
-std::array<float,2>{0.99454987f, 0.987139642f},
-std::array<float,2>{0.101746134f, 0.285876572f},
-std::array<float,2>{0.633788228f, 0.152419776f},
-std::array<float,2>{0.357298821f, 0.641803205f},
-std::array<float,2>{0.552732885f, 0.621859491f},
-std::array<float,2>{0.474104077f, 0.0439677835f},
-std::array<float,2>{0.82396853f, 0.450356007f},
-std::array<float,2>{0.15808709f, 0.778947175f},
-std::array<float,2>{0.73135668f, 0.836227119f},
-std::array<float,2>{0.31144014f, 0.419408649f},
-std::array<float,2>{0.899908662f, 0.0967768729f},
-std::array<float,2>{0.0301720556f, 0.561208963f},
-std::array<float,2>{0.75439024f, 0.702047467f},
-std::array<float,2>{0.248830035f, 0.193790331f},
-std::array<float,2>{0.580716014f, 0.33897388f},
-std::array<float,2>{0.400548607f, 0.881175339f},
-std::array<float,2>{0.873323143f, 0.800284266f},
-std::array<float,2>{0.130647048f, 0.479735613f},
-std::array<float,2>{0.525137126f, 0.0262027606f},
-std::array<float,2>{0.45461458f, 0.581613123f},
-std::array<float,2>{0.678132772f, 0.669763625f},
-std::array<float,2>{0.339528829f, 0.16628617f},
-std::array<float,2>{0.957790971f, 0.262849987f},
-std::array<float,2>{0.078660883f, 0.945004463f},
-std::array<float,2>{0.620172739f, 0.924046814f},
-std::array<float,2>{0.42394796f, 0.344951332f},
-std::array<float,2>{0.784285545f, 0.240990862f},
-std::array<float,2>{0.217014819f, 0.722036719f},
-std::array<float,2>{0.916667402f, 0.507647872f},
-std::array<float,2>{0.0313601457f, 0.0840932727f},
-std::array<float,2>{0.709228039f, 0.397790074f},
-std::array<float,2>{0.275322258f, 0.856039941f},
-std::array<float,2>{0.88872987f, 0.869750619f},
-std::array<float,2>{0.00876895897f, 0.380897135f},
-std::array<float,2>{0.748280048f, 0.0688866451f},
-std::array<float,2>{0.289057076f, 0.523307025f},
-std::array<float,2>{0.570282102f, 0.742876828f},
-std::array<float,2>{0.383752823f, 0.227487221f},
-std::array<float,2>{0.768808901f, 0.363448709f},
-std::array<float,2>{0.229241163f, 0.90728277f},
-std::array<float,2>{0.644604087f, 0.955971479f},
-std::array<float,2>{0.365718067f, 0.27285111f},
-std::array<float,2>{0.979637921f, 0.182626367f},
-std::array<float,2>{0.121324211f, 0.672944605f},
-std::array<float,2>{0.833407342f, 0.570038855f},
-std::array<float,2>{0.182741567f, 0.00216379482f},
-std::array<float,2>{0.546633005f, 0.487214178f},
-std::array<float,2>{0.491667658f, 0.789120138f},
-std::array<float,2>{0.808600962f, 0.892389596f},
-std::array<float,2>{0.196767315f, 0.324928343f},
-std::array<float,2>{0.606805921f, 0.214629859f},
-std::array<float,2>{0.410428822f, 0.704903662f},
-std::array<float,2>{0.69722724f, 0.54678905f},
-std::array<float,2>{0.258914441f, 0.11219991f},
-std::array<float,2>{0.931571841f, 0.425915927f},
-std::array<float,2>{0.0529430397f, 0.825829387f},
-std::array<float,2>{0.510123372f, 0.753442585f},
-std::array<float,2>{0.443503857f, 0.464303255f},
-std::array<float,2>{0.846903443f, 0.0576874018f},
-std::array<float,2>{0.153902248f, 0.601715624f},
-std::array<float,2>{0.939132392f, 0.633170307f},
-std::array<float,2>{0.0647590309f, 0.126796827f},
-std::array<float,2>{0.656760573f, 0.309063405f},
-std::array<float,2>{0.322606593f, 0.977278113f},
-std::array<float,2>{0.894626975f, 0.98278439f},
-std::array<float,2>{0.0165863857f, 0.308027774f},
-std::array<float,2>{0.721283615f, 0.129471034f},
-std::array<float,2>{0.300635844f, 0.639042258f},
-std::array<float,2>{0.592049539f, 0.606701314f},
-std::array<float,2>{0.393284678f, 0.059121415f},
-std::array<float,2>{0.764663577f, 0.466565073f},
-std::array<float,2>{0.237606883f, 0.754187882f},
-std::array<float,2>{0.627170861f, 0.822305977f},
-std::array<float,2>{0.34591347f, 0.425445199f},
-std::array<float,2>{0.988529384f, 0.115159683f},
-std::array<float,2>{0.0962961614f, 0.542054236f},
-std::array<float,2>{0.815843701f, 0.707408547f},
-std::array<float,2>{0.165449649f, 0.215205476f},
-std::array<float,2>{0.555048525f, 0.323869824f},
-std::array<float,2>{0.481098026f, 0.89810425f},
-std::array<float,2>{0.793364942f, 0.792974114f},
-std::array<float,2>{0.207825869f, 0.490483314f},
-std::array<float,2>{0.615195215f, 0.00580025837f},
-std::array<float,2>{0.434988588f, 0.563413501f},
-std::array<float,2>{0.714281976f, 0.676467776f},
-std::array<float,2>{0.273188591f, 0.186288491f},
-std::array<float,2>{0.911545336f, 0.266338289f},
-std::array<float,2>{0.0402322374f, 0.95781219f},
-std::array<float,2>{0.521653712f, 0.910307705f},
-std::array<float,2>{0.462340981f, 0.35986346f},
-std::array<float,2>{0.867184937f, 0.233344868f},
-std::array<float,2>{0.139059216f, 0.747608662f},
-std::array<float,2>{0.963014662f, 0.519267142f},
-std::array<float,2>{0.0906970054f, 0.0649425089f},
-std::array<float,2>{0.680630147f, 0.376372874f},
-std::array<float,2>{0.3350389f, 0.871526718f},
-std::array<float,2>{0.97571069f, 0.855368257f},
-std::array<float,2>{0.112988181f, 0.392463744f},
-std::array<float,2>{0.653536379f, 0.0803701133f},
-std::array<float,2>{0.373932928f, 0.503476858f},
-std::array<float,2>{0.53656143f, 0.723969162f},
-std::array<float,2>{0.498619646f, 0.234414116f},
-std::array<float,2>{0.842881382f, 0.351555556f},
-std::array<float,2>{0.177447602f, 0.926576316f},
-std::array<float,2>{0.737912893f, 0.939880192f},
-std::array<float,2>{0.29449746f, 0.258874148f},
-std::array<float,2>{0.878619671f, 0.171872407f},
-std::array<float,2>{0.00170236488f, 0.665227771f},
-std::array<float,2>{0.77476877f, 0.584133208f},
-std::array<float,2>{0.221988901f, 0.0310272425f},
-std::array<float,2>{0.576315105f, 0.48179093f},
-std::array<float,2>{0.380141109f, 0.802274346f},
-std::array<float,2>{0.855853319f, 0.877068341f},
-std::array<float,2>{0.14562957f, 0.341172457f},
-std::array<float,2>{0.503328502f, 0.190058455f},
-std::array<float,2>{0.447285116f, 0.69593066f},
-std::array<float,2>{0.670566261f, 0.558002532f},
-std::array<float,2>{0.315394819f, 0.0999840498f},
-std::array<float,2>{0.945776761f, 0.416638076f},
-std::array<float,2>{0.0715636164f, 0.840732634f},
-std::array<float,2>{0.594999075f, 0.774603367f},
-std::array<float,2>{0.419059396f, 0.447858721f},
-std::array<float,2>{0.801446497f, 0.0407978371f},
-std::array<float,2>{0.194125637f, 0.618618667f},
-std::array<float,2>{0.922623038f, 0.647268653f},
-std::array<float,2>{0.0614887178f, 0.151380286f},
-std::array<float,2>{0.690160394f, 0.283908367f},
-std::array<float,2>{0.25176999f, 0.991656125f},
-std::array<float,2>{0.944021404f, 0.936279058f},
-std::array<float,2>{0.067614302f, 0.351813585f},
-std::array<float,2>{0.660825849f, 0.242211983f},
-std::array<float,2>{0.327038467f, 0.734350264f},
-std::array<float,2>{0.514913738f, 0.514755666f},
-std::array<float,2>{0.441301465f, 0.0860898569f},
-std::array<float,2>{0.851267695f, 0.402999729f},
-std::array<float,2>{0.150061145f, 0.846833289f},
-std::array<float,2>{0.699424207f, 0.804714561f},
-std::array<float,2>{0.265026152f, 0.473083049f},
-std::array<float,2>{0.936898291f, 0.0225131717f},
-std::array<float,2>{0.0485474057f, 0.590551555f},
-std::array<float,2>{0.806642771f, 0.663310766f},
-std::array<float,2>{0.199664786f, 0.159768492f},
-std::array<float,2>{0.604995489f, 0.254298955f},
-std::array<float,2>{0.40988183f, 0.949396014f},
-std::array<float,2>{0.828956842f, 0.830823779f},
-std::array<float,2>{0.18472746f, 0.408906192f},
-std::array<float,2>{0.539353609f, 0.107140981f},
-std::array<float,2>{0.485658735f, 0.553833425f},
-std::array<float,2>{0.643079281f, 0.694605708f},
-std::array<float,2>{0.362150788f, 0.198388353f},
-std::array<float,2>{0.984029233f, 0.333328515f},
-std::array<float,2>{0.117632404f, 0.890561879f},
-std::array<float,2>{0.563987315f, 0.998541355f},
-std::array<float,2>{0.389031261f, 0.290220529f},
-std::array<float,2>{0.770419598f, 0.146496475f},
-std::array<float,2>{0.233305871f, 0.650568187f},
-std::array<float,2>{0.884462476f, 0.611662865f},
-std::array<float,2>{0.0134674786f, 0.0348712243f},
-std::array<float,2>{0.744601786f, 0.43981269f},
-std::array<float,2>{0.283005923f, 0.767835915f},
-std::array<float,2>{0.921429336f, 0.765242696f},
-std::array<float,2>{0.0363762937f, 0.458180904f},
-std::array<float,2>{0.705655158f, 0.0518505052f},
-std::array<float,2>{0.279389381f, 0.598689735f},
-std::array<float,2>{0.623186886f, 0.630414128f},
-std::array<float,2>{0.429636449f, 0.13609226f},
-std::array<float,2>{0.788216114f, 0.301967144f},
-std::array<float,2>{0.214137092f, 0.976202428f},
-std::array<float,2>{0.675005794f, 0.899077296f},
-std::array<float,2>{0.342519253f, 0.313960284f},
-std::array<float,2>{0.953535378f, 0.210794523f},
-std::array<float,2>{0.0842447057f, 0.716345787f},
-std::array<float,2>{0.867202699f, 0.535437822f},
-std::array<float,2>{0.125802442f, 0.117442898f},
-std::array<float,2>{0.529360712f, 0.432599604f},
-std::array<float,2>{0.45926407f, 0.818732202f},
-std::array<float,2>{0.752886713f, 0.962745488f},
-std::array<float,2>{0.245472476f, 0.279005557f},
-std::array<float,2>{0.584499896f, 0.174853861f},
-std::array<float,2>{0.406168073f, 0.682566166f},
-std::array<float,2>{0.729859233f, 0.570849836f},
-std::array<float,2>{0.305282831f, 0.0103634158f},
-std::array<float,2>{0.902980566f, 0.498698771f},
-std::array<float,2>{0.023980543f, 0.782618344f},
-std::array<float,2>{0.549138486f, 0.86107105f},
-std::array<float,2>{0.471222132f, 0.384032041f},
-std::array<float,2>{0.825899243f, 0.0708662495f},
-std::array<float,2>{0.163849488f, 0.528897941f},
-std::array<float,2>{0.998013139f, 0.734590232f},
-std::array<float,2>{0.109048478f, 0.224109426f},
-std::array<float,2>{0.638398588f, 0.374046147f},
-std::array<float,2>{0.354295909f, 0.915547371f},
-std::array<float,2>{0.930916786f, 0.894226551f},
-std::array<float,2>{0.053661637f, 0.32757324f},
-std::array<float,2>{0.696604669f, 0.211294726f},
-std::array<float,2>{0.259739161f, 0.706753433f},
-std::array<float,2>{0.607003927f, 0.544126332f},
-std::array<float,2>{0.410761535f, 0.109382026f},
-std::array<float,2>{0.809278846f, 0.428228378f},
-std::array<float,2>{0.196865052f, 0.827636778f},
-std::array<float,2>{0.65658462f, 0.750330865f},
-std::array<float,2>{0.322876364f, 0.461675346f},
-std::array<float,2>{0.938946605f, 0.0553875342f},
-std::array<float,2>{0.0650775507f, 0.604035735f},
-std::array<float,2>{0.847506046f, 0.635679185f},
-std::array<float,2>{0.153416321f, 0.128027782f},
-std::array<float,2>{0.510679603f, 0.311573565f},
-std::array<float,2>{0.444130212f, 0.978877544f},
-std::array<float,2>{0.76926136f, 0.867834032f},
-std::array<float,2>{0.228787318f, 0.380606741f},
-std::array<float,2>{0.569498897f, 0.0667702779f},
-std::array<float,2>{0.382832408f, 0.520614326f},
-std::array<float,2>{0.748843014f, 0.744957209f},
-std::array<float,2>{0.288527578f, 0.230370909f},
-std::array<float,2>{0.889194727f, 0.367112398f},
-std::array<float,2>{0.00820839684f, 0.90829128f},
-std::array<float,2>{0.546006083f, 0.954021215f},
-std::array<float,2>{0.491915554f, 0.270618707f},
-std::array<float,2>{0.83379519f, 0.180218235f},
-std::array<float,2>{0.183126956f, 0.67464143f},
-std::array<float,2>{0.980326235f, 0.567395031f},
-std::array<float,2>{0.121811353f, 0.00134173827f},
-std::array<float,2>{0.645278573f, 0.484821349f},
-std::array<float,2>{0.366090268f, 0.792804897f},
-std::array<float,2>{0.957455933f, 0.798151612f},
-std::array<float,2>{0.0784189552f, 0.476932168f},
-std::array<float,2>{0.678448081f, 0.0243201815f},
-std::array<float,2>{0.339196265f, 0.578825176f},
-std::array<float,2>{0.524561524f, 0.671726465f},
-std::array<float,2>{0.454391539f, 0.164485097f},
-std::array<float,2>{0.873953044f, 0.264833391f},
-std::array<float,2>{0.130023092f, 0.9421013f},
-std::array<float,2>{0.709614336f, 0.922473431f},
-std::array<float,2>{0.274891138f, 0.34609136f},
-std::array<float,2>{0.916148365f, 0.239363939f},
-std::array<float,2>{0.0319566242f, 0.719692111f},
-std::array<float,2>{0.785023272f, 0.505731344f},
-std::array<float,2>{0.21749343f, 0.0835330188f},
-std::array<float,2>{0.620814323f, 0.39643684f},
-std::array<float,2>{0.424607217f, 0.858417451f},
-std::array<float,2>{0.823469877f, 0.984483659f},
-std::array<float,2>{0.157286555f, 0.287423521f},
-std::array<float,2>{0.552140415f, 0.156015441f},
-std::array<float,2>{0.474181831f, 0.64373982f},
-std::array<float,2>{0.633234322f, 0.624888718f},
-std::array<float,2>{0.356700152f, 0.0460353643f},
-std::array<float,2>{0.994817495f, 0.452919006f},
-std::array<float,2>{0.10207472f, 0.781013787f},
-std::array<float,2>{0.580484211f, 0.838971317f},
-std::array<float,2>{0.401263505f, 0.420542568f},
-std::array<float,2>{0.754748285f, 0.0953976735f},
-std::array<float,2>{0.248384953f, 0.559062421f},
-std::array<float,2>{0.899505138f, 0.699514627f},
-std::array<float,2>{0.0293705761f, 0.192051694f},
-std::array<float,2>{0.730722725f, 0.335938871f},
-std::array<float,2>{0.310940295f, 0.87915802f},
-std::array<float,2>{0.985798061f, 0.948268175f},
-std::array<float,2>{0.0977859795f, 0.253105491f},
-std::array<float,2>{0.630267143f, 0.163823619f},
-std::array<float,2>{0.349075228f, 0.659270525f},
-std::array<float,2>{0.559380352f, 0.589814901f},
-std::array<float,2>{0.477300256f, 0.0168259218f},
-std::array<float,2>{0.81906116f, 0.472213835f},
-std::array<float,2>{0.17069602f, 0.80883491f},
-std::array<float,2>{0.724608064f, 0.849599242f},
-std::array<float,2>{0.302723944f, 0.4014467f},
-std::array<float,2>{0.891120315f, 0.0919054151f},
-std::array<float,2>{0.0224512089f, 0.510882318f},
-std::array<float,2>{0.758125544f, 0.726688325f},
-std::array<float,2>{0.239773318f, 0.249050677f},
-std::array<float,2>{0.588457406f, 0.358864784f},
-std::array<float,2>{0.395621508f, 0.93308723f},
-std::array<float,2>{0.861451328f, 0.769795358f},
-std::array<float,2>{0.133744463f, 0.444698751f},
-std::array<float,2>{0.518655777f, 0.0385477394f},
-std::array<float,2>{0.468028277f, 0.615641177f},
-std::array<float,2>{0.686204791f, 0.653092086f},
-std::array<float,2>{0.328302532f, 0.143576503f},
-std::array<float,2>{0.967480481f, 0.296797872f},
-std::array<float,2>{0.0862195492f, 0.992711902f},
-std::array<float,2>{0.610157669f, 0.885740161f},
-std::array<float,2>{0.431616306f, 0.32944268f},
-std::array<float,2>{0.792175531f, 0.200096637f},
-std::array<float,2>{0.203530535f, 0.690449834f},
-std::array<float,2>{0.907219648f, 0.548193812f},
-std::array<float,2>{0.0453605466f, 0.10355591f},
-std::array<float,2>{0.718264818f, 0.411908776f},
-std::array<float,2>{0.268001169f, 0.834869146f},
-std::array<float,2>{0.878913581f, 0.81308341f},
-std::array<float,2>{0.00463827839f, 0.436435491f},
-std::array<float,2>{0.741082609f, 0.123803839f},
-std::array<float,2>{0.290185541f, 0.534953594f},
-std::array<float,2>{0.570986688f, 0.712587595f},
-std::array<float,2>{0.378003538f, 0.205841511f},
-std::array<float,2>{0.77902174f, 0.318331778f},
-std::array<float,2>{0.224591509f, 0.905445755f},
-std::array<float,2>{0.65225631f, 0.969289243f},
-std::array<float,2>{0.367940336f, 0.29974702f},
-std::array<float,2>{0.969577551f, 0.137017205f},
-std::array<float,2>{0.116727442f, 0.625038326f},
-std::array<float,2>{0.837648332f, 0.597093523f},
-std::array<float,2>{0.175612122f, 0.048099976f},
-std::array<float,2>{0.534443974f, 0.454569757f},
-std::array<float,2>{0.494269967f, 0.758368134f},
-std::array<float,2>{0.799715638f, 0.918111444f},
-std::array<float,2>{0.189227656f, 0.36733374f},
-std::array<float,2>{0.597952425f, 0.219375402f},
-std::array<float,2>{0.415866524f, 0.739988983f},
-std::array<float,2>{0.691705763f, 0.524280846f},
-std::array<float,2>{0.255089432f, 0.0769053251f},
-std::array<float,2>{0.927051723f, 0.388896048f},
-std::array<float,2>{0.0565903038f, 0.864648461f},
-std::array<float,2>{0.5069049f, 0.786722243f},
-std::array<float,2>{0.451950252f, 0.495149434f},
-std::array<float,2>{0.85447818f, 0.0147227347f},
-std::array<float,2>{0.141398355f, 0.574645102f},
-std::array<float,2>{0.952127159f, 0.685319662f},
-std::array<float,2>{0.0763278678f, 0.178732276f},
-std::array<float,2>{0.665115833f, 0.275749683f},
-std::array<float,2>{0.318767399f, 0.965260804f},
-std::array<float,2>{0.912386179f, 0.960131586f},
-std::array<float,2>{0.0425589457f, 0.268568963f},
-std::array<float,2>{0.712211132f, 0.184621111f},
-std::array<float,2>{0.270663768f, 0.678411901f},
-std::array<float,2>{0.616297781f, 0.564645886f},
-std::array<float,2>{0.43667987f, 0.00698740361f},
-std::array<float,2>{0.795629859f, 0.488716334f},
-std::array<float,2>{0.21061556f, 0.795076072f},
-std::array<float,2>{0.682658255f, 0.874926269f},
-std::array<float,2>{0.332179189f, 0.378276408f},
-std::array<float,2>{0.96221453f, 0.063512288f},
-std::array<float,2>{0.0934643224f, 0.51667726f},
-std::array<float,2>{0.863741338f, 0.748692572f},
-std::array<float,2>{0.138585463f, 0.230945766f},
-std::array<float,2>{0.520908117f, 0.362295508f},
-std::array<float,2>{0.464499742f, 0.913009048f},
-std::array<float,2>{0.76319319f, 0.757544935f},
-std::array<float,2>{0.236003861f, 0.467056304f},
-std::array<float,2>{0.591573298f, 0.0608614311f},
-std::array<float,2>{0.392538697f, 0.608761907f},
-std::array<float,2>{0.720677197f, 0.637953699f},
-std::array<float,2>{0.297364354f, 0.132773861f},
-std::array<float,2>{0.897639811f, 0.304960161f},
-std::array<float,2>{0.0191893149f, 0.981690168f},
-std::array<float,2>{0.557078302f, 0.89588362f},
-std::array<float,2>{0.483113915f, 0.320411146f},
-std::array<float,2>{0.812687039f, 0.217207804f},
-std::array<float,2>{0.1662734f, 0.710846007f},
-std::array<float,2>{0.991580367f, 0.539103746f},
-std::array<float,2>{0.0955111384f, 0.116679057f},
-std::array<float,2>{0.626229703f, 0.422933102f},
-std::array<float,2>{0.344832093f, 0.821205914f},
-std::array<float,2>{0.948055625f, 0.84232378f},
-std::array<float,2>{0.073826395f, 0.415343255f},
-std::array<float,2>{0.668027818f, 0.0991845801f},
-std::array<float,2>{0.312676728f, 0.555520177f},
-std::array<float,2>{0.501621664f, 0.698542356f},
-std::array<float,2>{0.446353316f, 0.188558534f},
-std::array<float,2>{0.858351409f, 0.343030542f},
-std::array<float,2>{0.148150563f, 0.876288593f},
-std::array<float,2>{0.688257933f, 0.988699853f},
-std::array<float,2>{0.252336711f, 0.282062292f},
-std::array<float,2>{0.925465167f, 0.148586497f},
-std::array<float,2>{0.0599312782f, 0.645945549f},
-std::array<float,2>{0.804498971f, 0.619813681f},
-std::array<float,2>{0.191670284f, 0.0412316583f},
-std::array<float,2>{0.596932709f, 0.446524084f},
-std::array<float,2>{0.420773268f, 0.776822984f},
-std::array<float,2>{0.841559887f, 0.928881943f},
-std::array<float,2>{0.178147867f, 0.348142862f},
-std::array<float,2>{0.537639081f, 0.236581683f},
-std::array<float,2>{0.497074127f, 0.726553082f},
-std::array<float,2>{0.655484378f, 0.500271618f},
-std::array<float,2>{0.371952742f, 0.0800166205f},
-std::array<float,2>{0.973685443f, 0.393177837f},
-std::array<float,2>{0.109966919f, 0.851675153f},
-std::array<float,2>{0.574260354f, 0.803693295f},
-std::array<float,2>{0.381931156f, 0.483538032f},
-std::array<float,2>{0.776238263f, 0.0281573255f},
-std::array<float,2>{0.219764352f, 0.582216918f},
-std::array<float,2>{0.875197411f, 0.667197526f},
-std::array<float,2>{0.0031359687f, 0.168105274f},
-std::array<float,2>{0.735193551f, 0.26107347f},
-std::array<float,2>{0.296376377f, 0.938399494f},
-std::array<float,2>{0.980897844f, 0.888267815f},
-std::array<float,2>{0.119275331f, 0.335074931f},
-std::array<float,2>{0.641339839f, 0.196641177f},
-std::array<float,2>{0.359951317f, 0.692985773f},
-std::array<float,2>{0.541234255f, 0.552237988f},
-std::array<float,2>{0.487305522f, 0.108954065f},
-std::array<float,2>{0.831322849f, 0.408158034f},
-std::array<float,2>{0.186850399f, 0.828575909f},
-std::array<float,2>{0.74330169f, 0.76753521f},
-std::array<float,2>{0.28356567f, 0.438448906f},
-std::array<float,2>{0.886649549f, 0.0316745453f},
-std::array<float,2>{0.0151893804f, 0.61113441f},
-std::array<float,2>{0.771927714f, 0.649392843f},
-std::array<float,2>{0.231685877f, 0.145871505f},
-std::array<float,2>{0.565682292f, 0.291797698f},
-std::array<float,2>{0.387209535f, 0.997707427f},
-std::array<float,2>{0.847718835f, 0.844858885f},
-std::array<float,2>{0.151227996f, 0.406123549f},
-std::array<float,2>{0.511788607f, 0.0895468742f},
-std::array<float,2>{0.438941956f, 0.512144923f},
-std::array<float,2>{0.663446367f, 0.73119545f},
-std::array<float,2>{0.325469345f, 0.244187966f},
-std::array<float,2>{0.942016602f, 0.35485661f},
-std::array<float,2>{0.0699165091f, 0.933947921f},
-std::array<float,2>{0.602019191f, 0.951194584f},
-std::array<float,2>{0.406345814f, 0.256148726f},
-std::array<float,2>{0.805232406f, 0.156895339f},
-std::array<float,2>{0.202122673f, 0.660194933f},
-std::array<float,2>{0.933844209f, 0.593641639f},
-std::array<float,2>{0.0492968075f, 0.019801734f},
-std::array<float,2>{0.701280713f, 0.475898743f},
-std::array<float,2>{0.262393653f, 0.807760894f},
-std::array<float,2>{0.905398428f, 0.784978569f},
-std::array<float,2>{0.0261412356f, 0.496567786f},
-std::array<float,2>{0.726919413f, 0.00840515178f},
-std::array<float,2>{0.307262599f, 0.573409617f},
-std::array<float,2>{0.583432138f, 0.679893076f},
-std::array<float,2>{0.403241485f, 0.173432425f},
-std::array<float,2>{0.750235796f, 0.281004637f},
-std::array<float,2>{0.244106874f, 0.964316308f},
-std::array<float,2>{0.640395343f, 0.91739291f},
-std::array<float,2>{0.353141308f, 0.372915417f},
-std::array<float,2>{0.998652041f, 0.225004956f},
-std::array<float,2>{0.105951928f, 0.737270892f},
-std::array<float,2>{0.827901065f, 0.529361248f},
-std::array<float,2>{0.160198689f, 0.0723976493f},
-std::array<float,2>{0.547616661f, 0.385923803f},
-std::array<float,2>{0.47007969f, 0.862236023f},
-std::array<float,2>{0.785492897f, 0.9734056f},
-std::array<float,2>{0.211992815f, 0.304261237f},
-std::array<float,2>{0.621972501f, 0.134436384f},
-std::array<float,2>{0.427022368f, 0.631578326f},
-std::array<float,2>{0.704065323f, 0.600399613f},
-std::array<float,2>{0.278007895f, 0.0537382737f},
-std::array<float,2>{0.919583738f, 0.460538775f},
-std::array<float,2>{0.0380111523f, 0.762001395f},
-std::array<float,2>{0.528026342f, 0.817284763f},
-std::array<float,2>{0.458138973f, 0.430858463f},
-std::array<float,2>{0.870436728f, 0.119449861f},
-std::array<float,2>{0.128624082f, 0.538640022f},
-std::array<float,2>{0.956608474f, 0.718428433f},
-std::array<float,2>{0.0837094039f, 0.208208263f},
-std::array<float,2>{0.671963096f, 0.314689517f},
-std::array<float,2>{0.341344804f, 0.900442719f},
-std::array<float,2>{0.888219893f, 0.907784104f},
-std::array<float,2>{0.0110514993f, 0.364159495f},
-std::array<float,2>{0.747650564f, 0.226620376f},
-std::array<float,2>{0.285949588f, 0.742203534f},
-std::array<float,2>{0.566736817f, 0.522648215f},
-std::array<float,2>{0.385131001f, 0.0683765784f},
-std::array<float,2>{0.766302884f, 0.381418943f},
-std::array<float,2>{0.227911025f, 0.869317949f},
-std::array<float,2>{0.647475064f, 0.789725482f},
-std::array<float,2>{0.363661468f, 0.486530274f},
-std::array<float,2>{0.977319956f, 0.0028060968f},
-std::array<float,2>{0.124147244f, 0.569382071f},
-std::array<float,2>{0.834430218f, 0.673496485f},
-std::array<float,2>{0.181560516f, 0.183191538f},
-std::array<float,2>{0.544446468f, 0.273394406f},
-std::array<float,2>{0.488392591f, 0.955393493f},
-std::array<float,2>{0.811083317f, 0.825322986f},
-std::array<float,2>{0.19920522f, 0.426662713f},
-std::array<float,2>{0.607750595f, 0.111548096f},
-std::array<float,2>{0.413883716f, 0.546044827f},
-std::array<float,2>{0.697671473f, 0.704237223f},
-std::array<float,2>{0.260480106f, 0.213945538f},
-std::array<float,2>{0.933591664f, 0.324296564f},
-std::array<float,2>{0.0526611693f, 0.891689301f},
-std::array<float,2>{0.509357452f, 0.976747811f},
-std::array<float,2>{0.442549884f, 0.309313297f},
-std::array<float,2>{0.844113469f, 0.126276344f},
-std::array<float,2>{0.154736698f, 0.633557856f},
-std::array<float,2>{0.940031707f, 0.602465153f},
-std::array<float,2>{0.0631268844f, 0.0585218444f},
-std::array<float,2>{0.659028769f, 0.464503318f},
-std::array<float,2>{0.320682734f, 0.753117085f},
-std::array<float,2>{0.993415833f, 0.778486252f},
-std::array<float,2>{0.103515767f, 0.450891882f},
-std::array<float,2>{0.635169029f, 0.0448286571f},
-std::array<float,2>{0.358340591f, 0.621475101f},
-std::array<float,2>{0.554215431f, 0.642480314f},
-std::array<float,2>{0.47492978f, 0.15301019f},
-std::array<float,2>{0.82168597f, 0.28542605f},
-std::array<float,2>{0.15943037f, 0.986754656f},
-std::array<float,2>{0.732821763f, 0.881823897f},
-std::array<float,2>{0.308793008f, 0.339533955f},
-std::array<float,2>{0.901138961f, 0.194002405f},
-std::array<float,2>{0.0274092965f, 0.701465011f},
-std::array<float,2>{0.756437898f, 0.56057024f},
-std::array<float,2>{0.246829912f, 0.0972268432f},
-std::array<float,2>{0.579436183f, 0.419605345f},
-std::array<float,2>{0.400319934f, 0.836665094f},
-std::array<float,2>{0.872251511f, 0.944669425f},
-std::array<float,2>{0.132473126f, 0.263442814f},
-std::array<float,2>{0.52592665f, 0.166652188f},
-std::array<float,2>{0.456743449f, 0.669033766f},
-std::array<float,2>{0.676318645f, 0.581316292f},
-std::array<float,2>{0.337262511f, 0.0255447663f},
-std::array<float,2>{0.960831225f, 0.480021149f},
-std::array<float,2>{0.0802191645f, 0.800401986f},
-std::array<float,2>{0.617653608f, 0.855882466f},
-std::array<float,2>{0.422694802f, 0.398052573f},
-std::array<float,2>{0.782668829f, 0.0846599638f},
-std::array<float,2>{0.216751933f, 0.50714767f},
-std::array<float,2>{0.915923893f, 0.722366929f},
-std::array<float,2>{0.0345113873f, 0.240716994f},
-std::array<float,2>{0.708726168f, 0.345483601f},
-std::array<float,2>{0.276863366f, 0.924650371f},
-std::array<float,2>{0.965733528f, 0.995232463f},
-std::array<float,2>{0.0883152932f, 0.294383764f},
-std::array<float,2>{0.684988499f, 0.141215339f},
-std::array<float,2>{0.331290334f, 0.654643357f},
-std::array<float,2>{0.517032027f, 0.614601374f},
-std::array<float,2>{0.466478169f, 0.0352355428f},
-std::array<float,2>{0.860786915f, 0.443148404f},
-std::array<float,2>{0.135453582f, 0.773372769f},
-std::array<float,2>{0.715319514f, 0.833400667f},
-std::array<float,2>{0.265736431f, 0.4124358f},
-std::array<float,2>{0.908805847f, 0.102160431f},
-std::array<float,2>{0.0447806232f, 0.550691605f},
-std::array<float,2>{0.789773703f, 0.687615335f},
-std::array<float,2>{0.206669584f, 0.201740935f},
-std::array<float,2>{0.612304926f, 0.331374288f},
-std::array<float,2>{0.432611287f, 0.883230567f},
-std::array<float,2>{0.817549944f, 0.812102497f},
-std::array<float,2>{0.168473229f, 0.469290018f},
-std::array<float,2>{0.561001837f, 0.0182120632f},
-std::array<float,2>{0.479582846f, 0.586716652f},
-std::array<float,2>{0.630958557f, 0.658183336f},
-std::array<float,2>{0.350765765f, 0.16204904f},
-std::array<float,2>{0.988155603f, 0.251814276f},
-std::array<float,2>{0.0999844223f, 0.946600437f},
-std::array<float,2>{0.587876201f, 0.930794239f},
-std::array<float,2>{0.398435205f, 0.356098354f},
-std::array<float,2>{0.760450065f, 0.247956708f},
-std::array<float,2>{0.240388513f, 0.728897512f},
-std::array<float,2>{0.892637193f, 0.509441853f},
-std::array<float,2>{0.0206009187f, 0.0916944966f},
-std::array<float,2>{0.725990236f, 0.400311857f},
-std::array<float,2>{0.303889364f, 0.849793434f},
-std::array<float,2>{0.928505778f, 0.866393983f},
-std::array<float,2>{0.0582317002f, 0.388090074f},
-std::array<float,2>{0.694498956f, 0.0743566677f},
-std::array<float,2>{0.256594747f, 0.526983678f},
-std::array<float,2>{0.601240098f, 0.74070102f},
-std::array<float,2>{0.416648358f, 0.220929906f},
-std::array<float,2>{0.798101664f, 0.369479567f},
-std::array<float,2>{0.189719111f, 0.920641363f},
-std::array<float,2>{0.667047918f, 0.968478322f},
-std::array<float,2>{0.31667766f, 0.274719566f},
-std::array<float,2>{0.949315667f, 0.176845744f},
-std::array<float,2>{0.0748564899f, 0.686762631f},
-std::array<float,2>{0.852068067f, 0.577299058f},
-std::array<float,2>{0.143182874f, 0.0121084386f},
-std::array<float,2>{0.505771637f, 0.49334842f},
-std::array<float,2>{0.450936764f, 0.788700104f},
-std::array<float,2>{0.779557347f, 0.902618468f},
-std::array<float,2>{0.226346344f, 0.319416314f},
-std::array<float,2>{0.572850227f, 0.204992399f},
-std::array<float,2>{0.376600623f, 0.714347541f},
-std::array<float,2>{0.739843607f, 0.533009291f},
-std::array<float,2>{0.292415768f, 0.122941352f},
-std::array<float,2>{0.881075323f, 0.43472752f},
-std::array<float,2>{0.00680424133f, 0.816298544f},
-std::array<float,2>{0.53304255f, 0.761509955f},
-std::array<float,2>{0.492527127f, 0.456229389f},
-std::array<float,2>{0.83792448f, 0.0491443984f},
-std::array<float,2>{0.172736481f, 0.594584286f},
-std::array<float,2>{0.971384883f, 0.627297401f},
-std::array<float,2>{0.114927858f, 0.139298767f},
-std::array<float,2>{0.648886979f, 0.297618479f},
-std::array<float,2>{0.369510829f, 0.97093612f},
-std::array<float,2>{0.923837602f, 0.990736127f},
-std::array<float,2>{0.0586865135f, 0.284994364f},
-std::array<float,2>{0.688890576f, 0.150487944f},
-std::array<float,2>{0.25312385f, 0.647959411f},
-std::array<float,2>{0.596005082f, 0.617507637f},
-std::array<float,2>{0.421470493f, 0.0391742699f},
-std::array<float,2>{0.803467751f, 0.448645294f},
-std::array<float,2>{0.192876995f, 0.773497939f},
-std::array<float,2>{0.669786334f, 0.841068745f},
-std::array<float,2>{0.313547999f, 0.417161971f},
-std::array<float,2>{0.948652625f, 0.101050287f},
-std::array<float,2>{0.0731590316f, 0.557107389f},
-std::array<float,2>{0.859212101f, 0.696322858f},
-std::array<float,2>{0.147411972f, 0.191097111f},
-std::array<float,2>{0.500423908f, 0.340241134f},
-std::array<float,2>{0.445987284f, 0.878160715f},
-std::array<float,2>{0.776828527f, 0.801513016f},
-std::array<float,2>{0.21945627f, 0.480787247f},
-std::array<float,2>{0.575324476f, 0.0294573344f},
-std::array<float,2>{0.38138181f, 0.585668921f},
-std::array<float,2>{0.735980093f, 0.664976776f},
-std::array<float,2>{0.295558423f, 0.170888886f},
-std::array<float,2>{0.876853406f, 0.258624494f},
-std::array<float,2>{0.00259310612f, 0.940621138f},
-std::array<float,2>{0.539026737f, 0.927714705f},
-std::array<float,2>{0.496985584f, 0.350053638f},
-std::array<float,2>{0.840209186f, 0.235500693f},
-std::array<float,2>{0.179607466f, 0.723552763f},
-std::array<float,2>{0.972750783f, 0.50278002f},
-std::array<float,2>{0.111251846f, 0.0818583891f},
-std::array<float,2>{0.65519762f, 0.390693843f},
-std::array<float,2>{0.372812361f, 0.85397172f},
-std::array<float,2>{0.961035013f, 0.872222662f},
-std::array<float,2>{0.0922183469f, 0.375703543f},
-std::array<float,2>{0.682377219f, 0.0655121207f},
-std::array<float,2>{0.333272427f, 0.518403113f},
-std::array<float,2>{0.519806623f, 0.74653703f},
-std::array<float,2>{0.463256389f, 0.234259501f},
-std::array<float,2>{0.864730418f, 0.360925466f},
-std::array<float,2>{0.137530804f, 0.911598742f},
-std::array<float,2>{0.711878538f, 0.958253562f},
-std::array<float,2>{0.270188481f, 0.266899467f},
-std::array<float,2>{0.913571119f, 0.187422812f},
-std::array<float,2>{0.0415199436f, 0.677699327f},
-std::array<float,2>{0.796444774f, 0.564304411f},
-std::array<float,2>{0.209051728f, 0.00476199668f},
-std::array<float,2>{0.616039038f, 0.491509408f},
-std::array<float,2>{0.436354935f, 0.79455024f},
-std::array<float,2>{0.813917577f, 0.896665215f},
-std::array<float,2>{0.167554781f, 0.32315284f},
-std::array<float,2>{0.558489323f, 0.21610333f},
-std::array<float,2>{0.483698547f, 0.708711267f},
-std::array<float,2>{0.62593019f, 0.541095674f},
-std::array<float,2>{0.344103843f, 0.114015199f},
-std::array<float,2>{0.990928113f, 0.424792826f},
-std::array<float,2>{0.0941188559f, 0.823455334f},
-std::array<float,2>{0.590315282f, 0.755835056f},
-std::array<float,2>{0.391320109f, 0.465607077f},
-std::array<float,2>{0.761867046f, 0.0603564158f},
-std::array<float,2>{0.234918296f, 0.606290877f},
-std::array<float,2>{0.897035003f, 0.640286684f},
-std::array<float,2>{0.0179266352f, 0.130820855f},
-std::array<float,2>{0.719260991f, 0.307394564f},
-std::array<float,2>{0.298774362f, 0.98412627f},
-std::array<float,2>{0.999953032f, 0.914556861f},
-std::array<float,2>{0.106888048f, 0.373593807f},
-std::array<float,2>{0.639541268f, 0.223230109f},
-std::array<float,2>{0.352467477f, 0.735363483f},
-std::array<float,2>{0.548151493f, 0.528156996f},
-std::array<float,2>{0.469109923f, 0.0720827729f},
-std::array<float,2>{0.826801002f, 0.383601129f},
-std::array<float,2>{0.161242753f, 0.860261202f},
-std::array<float,2>{0.727686882f, 0.781726539f},
-std::array<float,2>{0.308226883f, 0.499798715f},
-std::array<float,2>{0.904557168f, 0.0115811592f},
-std::array<float,2>{0.0264897402f, 0.572046459f},
-std::array<float,2>{0.751506209f, 0.683174253f},
-std::array<float,2>{0.243067786f, 0.174519747f},
-std::array<float,2>{0.582045555f, 0.2782076f},
-std::array<float,2>{0.40389213f, 0.961431742f},
-std::array<float,2>{0.869710386f, 0.819566786f},
-std::array<float,2>{0.127898812f, 0.432781667f},
-std::array<float,2>{0.529153287f, 0.118882693f},
-std::array<float,2>{0.457732797f, 0.536547959f},
-std::array<float,2>{0.673052609f, 0.715588987f},
-std::array<float,2>{0.340425342f, 0.209261268f},
-std::array<float,2>{0.955941379f, 0.313427746f},
-std::array<float,2>{0.0824603662f, 0.900305152f},
-std::array<float,2>{0.622451723f, 0.975502312f},
-std::array<float,2>{0.42618978f, 0.301482618f},
-std::array<float,2>{0.78615284f, 0.135661572f},
-std::array<float,2>{0.21189256f, 0.629467249f},
-std::array<float,2>{0.918815553f, 0.59813571f},
-std::array<float,2>{0.0387736298f, 0.0513322689f},
-std::array<float,2>{0.704585433f, 0.457449943f},
-std::array<float,2>{0.278667927f, 0.764554262f},
-std::array<float,2>{0.884814501f, 0.769356906f},
-std::array<float,2>{0.0146235786f, 0.441388547f},
-std::array<float,2>{0.742534637f, 0.0340012684f},
-std::array<float,2>{0.285002947f, 0.612757266f},
-std::array<float,2>{0.56507355f, 0.652213275f},
-std::array<float,2>{0.388157547f, 0.147519171f},
-std::array<float,2>{0.773120701f, 0.28973031f},
-std::array<float,2>{0.231015876f, 0.999571562f},
-std::array<float,2>{0.641899824f, 0.888748527f},
-std::array<float,2>{0.361000299f, 0.332603961f},
-std::array<float,2>{0.982008755f, 0.197463572f},
-std::array<float,2>{0.120849624f, 0.693493545f},
-std::array<float,2>{0.83092314f, 0.552784085f},
-std::array<float,2>{0.185752377f, 0.105694182f},
-std::array<float,2>{0.54244113f, 0.409335077f},
-std::array<float,2>{0.487046063f, 0.831728816f},
-std::array<float,2>{0.806436658f, 0.951119602f},
-std::array<float,2>{0.202431291f, 0.255148917f},
-std::array<float,2>{0.603054166f, 0.158234149f},
-std::array<float,2>{0.408124208f, 0.662654638f},
-std::array<float,2>{0.702962637f, 0.591604054f},
-std::array<float,2>{0.262872308f, 0.0221658982f},
-std::array<float,2>{0.934632957f, 0.474315464f},
-std::array<float,2>{0.0499409884f, 0.806051135f},
-std::array<float,2>{0.51308763f, 0.846275032f},
-std::array<float,2>{0.437776446f, 0.40368104f},
-std::array<float,2>{0.849095941f, 0.087343052f},
-std::array<float,2>{0.151870504f, 0.514556289f},
-std::array<float,2>{0.942846537f, 0.732479095f},
-std::array<float,2>{0.0685917735f, 0.243739471f},
-std::array<float,2>{0.662771642f, 0.353072882f},
-std::array<float,2>{0.324341059f, 0.937121391f},
-std::array<float,2>{0.901810467f, 0.880536199f},
-std::array<float,2>{0.0289951693f, 0.337799728f},
-std::array<float,2>{0.734047532f, 0.193202138f},
-std::array<float,2>{0.309890211f, 0.700282216f},
-std::array<float,2>{0.578663051f, 0.559618175f},
-std::array<float,2>{0.398582727f, 0.0945129544f},
-std::array<float,2>{0.757238865f, 0.421532571f},
-std::array<float,2>{0.247557193f, 0.838495791f},
-std::array<float,2>{0.636241078f, 0.779851258f},
-std::array<float,2>{0.359366715f, 0.451502919f},
-std::array<float,2>{0.992337346f, 0.0454909764f},
-std::array<float,2>{0.104528666f, 0.623260677f},
-std::array<float,2>{0.821112275f, 0.642919898f},
-std::array<float,2>{0.159175113f, 0.154509872f},
-std::array<float,2>{0.55318588f, 0.288312912f},
-std::array<float,2>{0.476189911f, 0.986087382f},
-std::array<float,2>{0.781532407f, 0.858160555f},
-std::array<float,2>{0.215765879f, 0.395196915f},
-std::array<float,2>{0.618597269f, 0.0825648308f},
-std::array<float,2>{0.423144251f, 0.504252315f},
-std::array<float,2>{0.707438767f, 0.719805956f},
-std::array<float,2>{0.275629401f, 0.239038542f},
-std::array<float,2>{0.91414088f, 0.34701848f},
-std::array<float,2>{0.0341552868f, 0.923016965f},
-std::array<float,2>{0.526773214f, 0.94321692f},
-std::array<float,2>{0.455126286f, 0.264544278f},
-std::array<float,2>{0.871640861f, 0.165600717f},
-std::array<float,2>{0.131145999f, 0.669985414f},
-std::array<float,2>{0.959707558f, 0.579510152f},
-std::array<float,2>{0.081900686f, 0.0247434862f},
-std::array<float,2>{0.676998973f, 0.478111744f},
-std::array<float,2>{0.335951984f, 0.797196209f},
-std::array<float,2>{0.978398681f, 0.791990697f},
-std::array<float,2>{0.123138256f, 0.485381007f},
-std::array<float,2>{0.646668434f, 0.000388021348f},
-std::array<float,2>{0.364980161f, 0.567058623f},
-std::array<float,2>{0.543043494f, 0.675167859f},
-std::array<float,2>{0.4900361f, 0.180973917f},
-std::array<float,2>{0.835167885f, 0.269727319f},
-std::array<float,2>{0.18035081f, 0.954950929f},
-std::array<float,2>{0.746437192f, 0.910075605f},
-std::array<float,2>{0.286620408f, 0.365647197f},
-std::array<float,2>{0.887402177f, 0.228713766f},
-std::array<float,2>{0.0105485432f, 0.74511832f},
-std::array<float,2>{0.767193139f, 0.520095706f},
-std::array<float,2>{0.226617634f, 0.067770876f},
-std::array<float,2>{0.56749779f, 0.379527032f},
-std::array<float,2>{0.38577795f, 0.868884981f},
-std::array<float,2>{0.845325351f, 0.980360746f},
-std::array<float,2>{0.156147614f, 0.311083883f},
-std::array<float,2>{0.508185923f, 0.126979843f},
-std::array<float,2>{0.441477895f, 0.636715114f},
-std::array<float,2>{0.659793735f, 0.605285823f},
-std::array<float,2>{0.321349353f, 0.0563094988f},
-std::array<float,2>{0.940765619f, 0.462503195f},
-std::array<float,2>{0.064394258f, 0.751409948f},
-std::array<float,2>{0.609091043f, 0.826608658f},
-std::array<float,2>{0.412765026f, 0.429283291f},
-std::array<float,2>{0.811823606f, 0.110880949f},
-std::array<float,2>{0.19735527f, 0.543384373f},
-std::array<float,2>{0.932606757f, 0.705135286f},
-std::array<float,2>{0.0512645692f, 0.212795869f},
-std::array<float,2>{0.699073493f, 0.326217294f},
-std::array<float,2>{0.261075139f, 0.893295527f},
-std::array<float,2>{0.950306475f, 0.966538668f},
-std::array<float,2>{0.0760758743f, 0.277322203f},
-std::array<float,2>{0.666417778f, 0.178542927f},
-std::array<float,2>{0.317798942f, 0.684051991f},
-std::array<float,2>{0.504370034f, 0.575677931f},
-std::array<float,2>{0.449424893f, 0.0137032075f},
-std::array<float,2>{0.853467941f, 0.494309604f},
-std::array<float,2>{0.144428104f, 0.785402834f},
-std::array<float,2>{0.693485498f, 0.864091516f},
-std::array<float,2>{0.25746417f, 0.390558988f},
-std::array<float,2>{0.929630101f, 0.0772195905f},
-std::array<float,2>{0.057047639f, 0.524924338f},
-std::array<float,2>{0.797840953f, 0.738287747f},
-std::array<float,2>{0.190785438f, 0.22010842f},
-std::array<float,2>{0.600352883f, 0.368899733f},
-std::array<float,2>{0.417832017f, 0.919693768f},
-std::array<float,2>{0.839135766f, 0.759206653f},
-std::array<float,2>{0.173012406f, 0.453624666f},
-std::array<float,2>{0.531815112f, 0.0475925095f},
-std::array<float,2>{0.493622005f, 0.595855176f},
-std::array<float,2>{0.650041401f, 0.626145661f},
-std::array<float,2>{0.371076077f, 0.138599724f},
-std::array<float,2>{0.972471178f, 0.300144941f},
-std::array<float,2>{0.113460153f, 0.970462978f},
-std::array<float,2>{0.573949456f, 0.905151188f},
-std::array<float,2>{0.37520054f, 0.317262799f},
-std::array<float,2>{0.780992925f, 0.206590638f},
-std::array<float,2>{0.225386307f, 0.710970581f},
-std::array<float,2>{0.882619262f, 0.533923388f},
-std::array<float,2>{0.00769317802f, 0.124247313f},
-std::array<float,2>{0.738980234f, 0.437331647f},
-std::array<float,2>{0.291334897f, 0.814392388f},
-std::array<float,2>{0.90940243f, 0.835672915f},
-std::array<float,2>{0.0438577309f, 0.410552323f},
-std::array<float,2>{0.716017008f, 0.104699187f},
-std::array<float,2>{0.267061234f, 0.5478338f},
-std::array<float,2>{0.61152643f, 0.690116167f},
-std::array<float,2>{0.433173388f, 0.201054722f},
-std::array<float,2>{0.790051818f, 0.329007804f},
-std::array<float,2>{0.20508571f, 0.886002123f},
-std::array<float,2>{0.683957875f, 0.993211627f},
-std::array<float,2>{0.330220014f, 0.29577902f},
-std::array<float,2>{0.96672684f, 0.143107176f},
-std::array<float,2>{0.089456372f, 0.653901994f},
-std::array<float,2>{0.859393895f, 0.616331279f},
-std::array<float,2>{0.136120021f, 0.0373936482f},
-std::array<float,2>{0.516268671f, 0.443776339f},
-std::array<float,2>{0.465142101f, 0.77071768f},
-std::array<float,2>{0.761027634f, 0.931679547f},
-std::array<float,2>{0.242027476f, 0.358256519f},
-std::array<float,2>{0.586755097f, 0.248109818f},
-std::array<float,2>{0.396909118f, 0.727657855f},
-std::array<float,2>{0.724799693f, 0.510187626f},
-std::array<float,2>{0.303573787f, 0.0928986818f},
-std::array<float,2>{0.8936252f, 0.400649488f},
-std::array<float,2>{0.0201010983f, 0.847988427f},
-std::array<float,2>{0.5624246f, 0.810328782f},
-std::array<float,2>{0.4788436f, 0.471209913f},
-std::array<float,2>{0.817268729f, 0.0165806692f},
-std::array<float,2>{0.169694081f, 0.588257432f},
-std::array<float,2>{0.986505866f, 0.658543706f},
-std::array<float,2>{0.101368323f, 0.16228421f},
-std::array<float,2>{0.632748306f, 0.252663583f},
-std::array<float,2>{0.350273311f, 0.948051631f},
-std::array<float,2>{0.877077758f, 0.938549697f},
-std::array<float,2>{0.000467464153f, 0.260240048f},
-std::array<float,2>{0.736577988f, 0.169198841f},
-std::array<float,2>{0.293253869f, 0.666746438f},
-std::array<float,2>{0.57721734f, 0.583020329f},
-std::array<float,2>{0.379090905f, 0.028706044f},
-std::array<float,2>{0.773525f, 0.483348966f},
-std::array<float,2>{0.221218541f, 0.804047644f},
-std::array<float,2>{0.652554452f, 0.853436768f},
-std::array<float,2>{0.374625057f, 0.394378364f},
-std::array<float,2>{0.975130737f, 0.0789510757f},
-std::array<float,2>{0.111891501f, 0.501452565f},
-std::array<float,2>{0.841946065f, 0.724609375f},
-std::array<float,2>{0.176398426f, 0.237316623f},
-std::array<float,2>{0.535722792f, 0.349056154f},
-std::array<float,2>{0.499038607f, 0.928277612f},
-std::array<float,2>{0.802326679f, 0.775485158f},
-std::array<float,2>{0.194651142f, 0.445657909f},
-std::array<float,2>{0.594681919f, 0.0429633446f},
-std::array<float,2>{0.418890566f, 0.620358527f},
-std::array<float,2>{0.690960288f, 0.64542222f},
-std::array<float,2>{0.250335783f, 0.150299922f},
-std::array<float,2>{0.923457623f, 0.283118665f},
-std::array<float,2>{0.0616276935f, 0.989855945f},
-std::array<float,2>{0.502189875f, 0.875825405f},
-std::array<float,2>{0.448543757f, 0.342012495f},
-std::array<float,2>{0.856736183f, 0.188133135f},
-std::array<float,2>{0.145016104f, 0.6975227f},
-std::array<float,2>{0.946685016f, 0.555721998f},
-std::array<float,2>{0.0710177571f, 0.0980593488f},
-std::array<float,2>{0.671871781f, 0.414110899f},
-std::array<float,2>{0.315586239f, 0.84341985f},
-std::array<float,2>{0.989882767f, 0.821505606f},
-std::array<float,2>{0.0967380926f, 0.422166407f},
-std::array<float,2>{0.628197312f, 0.115835227f},
-std::array<float,2>{0.346868306f, 0.540798783f},
-std::array<float,2>{0.556028605f, 0.709083557f},
-std::array<float,2>{0.482331365f, 0.218355983f},
-std::array<float,2>{0.814558983f, 0.32191363f},
-std::array<float,2>{0.16455029f, 0.89547205f},
-std::array<float,2>{0.721970856f, 0.981150448f},
-std::array<float,2>{0.299645901f, 0.305948347f},
-std::array<float,2>{0.895612061f, 0.131493315f},
-std::array<float,2>{0.0173677225f, 0.637303591f},
-std::array<float,2>{0.764176607f, 0.60831821f},
-std::array<float,2>{0.236405954f, 0.0616607778f},
-std::array<float,2>{0.593386412f, 0.468005776f},
-std::array<float,2>{0.393686235f, 0.756286502f},
-std::array<float,2>{0.865779936f, 0.913444161f},
-std::array<float,2>{0.139908195f, 0.3623555f},
-std::array<float,2>{0.523093402f, 0.231995225f},
-std::array<float,2>{0.461114287f, 0.749808908f},
-std::array<float,2>{0.680676997f, 0.516308367f},
-std::array<float,2>{0.334008723f, 0.0632102713f},
-std::array<float,2>{0.964837492f, 0.377170682f},
-std::array<float,2>{0.0908688828f, 0.873586833f},
-std::array<float,2>{0.613639355f, 0.796129405f},
-std::array<float,2>{0.433648199f, 0.489919871f},
-std::array<float,2>{0.794492245f, 0.00638142601f},
-std::array<float,2>{0.208843753f, 0.56562233f},
-std::array<float,2>{0.910906315f, 0.678902924f},
-std::array<float,2>{0.0399938785f, 0.183899418f},
-std::array<float,2>{0.713323057f, 0.268376291f},
-std::array<float,2>{0.271681488f, 0.959032714f},
-std::array<float,2>{0.954976022f, 0.902334332f},
-std::array<float,2>{0.0858391225f, 0.315926999f},
-std::array<float,2>{0.673913419f, 0.207466334f},
-std::array<float,2>{0.343313068f, 0.717048049f},
-std::array<float,2>{0.531112313f, 0.537246644f},
-std::array<float,2>{0.460247606f, 0.120153442f},
-std::array<float,2>{0.868303955f, 0.429699421f},
-std::array<float,2>{0.126872644f, 0.818311989f},
-std::array<float,2>{0.706763446f, 0.76358521f},
-std::array<float,2>{0.280739963f, 0.459892035f},
-std::array<float,2>{0.920746863f, 0.0532306582f},
-std::array<float,2>{0.0353135541f, 0.600756764f},
-std::array<float,2>{0.787403345f, 0.632549405f},
-std::array<float,2>{0.213441297f, 0.133339152f},
-std::array<float,2>{0.624284446f, 0.303396374f},
-std::array<float,2>{0.428525865f, 0.974378705f},
-std::array<float,2>{0.825004399f, 0.862802327f},
-std::array<float,2>{0.162268251f, 0.385245264f},
-std::array<float,2>{0.550559163f, 0.073431164f},
-std::array<float,2>{0.472526997f, 0.530495882f},
-std::array<float,2>{0.637128353f, 0.738075316f},
-std::array<float,2>{0.354756594f, 0.22634837f},
-std::array<float,2>{0.996531844f, 0.371926486f},
-std::array<float,2>{0.108313672f, 0.916532934f},
-std::array<float,2>{0.585310578f, 0.963528454f},
-std::array<float,2>{0.405011803f, 0.280167669f},
-std::array<float,2>{0.753752053f, 0.172677502f},
-std::array<float,2>{0.244884178f, 0.680687129f},
-std::array<float,2>{0.903418541f, 0.572905302f},
-std::array<float,2>{0.0244192854f, 0.00929128844f},
-std::array<float,2>{0.729375005f, 0.498044074f},
-std::array<float,2>{0.306192636f, 0.783535302f},
-std::array<float,2>{0.935712636f, 0.807090044f},
-std::array<float,2>{0.0470840558f, 0.474845856f},
-std::array<float,2>{0.70024997f, 0.0212008394f},
-std::array<float,2>{0.264129907f, 0.5918051f},
-std::array<float,2>{0.604460239f, 0.661892951f},
-std::array<float,2>{0.408812642f, 0.157707557f},
-std::array<float,2>{0.808370829f, 0.257283717f},
-std::array<float,2>{0.200473621f, 0.952835321f},
-std::array<float,2>{0.661355674f, 0.934914708f},
-std::array<float,2>{0.327615619f, 0.353578538f},
-std::array<float,2>{0.945193768f, 0.245512754f},
-std::array<float,2>{0.06658829f, 0.731633186f},
-std::array<float,2>{0.850488961f, 0.513549745f},
-std::array<float,2>{0.149037421f, 0.0887802765f},
-std::array<float,2>{0.51420486f, 0.40488404f},
-std::array<float,2>{0.440186858f, 0.844625473f},
-std::array<float,2>{0.770737588f, 0.997028232f},
-std::array<float,2>{0.233848602f, 0.292101413f},
-std::array<float,2>{0.563471258f, 0.144550413f},
-std::array<float,2>{0.389828146f, 0.649605751f},
-std::array<float,2>{0.745563805f, 0.610096633f},
-std::array<float,2>{0.281767339f, 0.0328845046f},
-std::array<float,2>{0.883241951f, 0.439031065f},
-std::array<float,2>{0.012099361f, 0.765815079f},
-std::array<float,2>{0.540085316f, 0.829833925f},
-std::array<float,2>{0.484602809f, 0.406465828f},
-std::array<float,2>{0.829779685f, 0.10748291f},
-std::array<float,2>{0.184460118f, 0.551445603f},
-std::array<float,2>{0.983176768f, 0.691681206f},
-std::array<float,2>{0.118773669f, 0.195379153f},
-std::array<float,2>{0.644317091f, 0.334556609f},
-std::array<float,2>{0.362845093f, 0.887042165f},
-std::array<float,2>{0.917663813f, 0.925655782f},
-std::array<float,2>{0.0326019302f, 0.344224483f},
-std::array<float,2>{0.710627258f, 0.241728753f},
-std::array<float,2>{0.274044037f, 0.721427262f},
-std::array<float,2>{0.619160473f, 0.506265938f},
-std::array<float,2>{0.425558507f, 0.0849973112f},
-std::array<float,2>{0.783920705f, 0.397395551f},
-std::array<float,2>{0.217897996f, 0.857420981f},
-std::array<float,2>{0.679339528f, 0.799249351f},
-std::array<float,2>{0.337951601f, 0.47912097f},
-std::array<float,2>{0.958290398f, 0.0270185899f},
-std::array<float,2>{0.0798316225f, 0.580513954f},
-std::array<float,2>{0.874288321f, 0.668547332f},
-std::array<float,2>{0.129018277f, 0.167277738f},
-std::array<float,2>{0.524143219f, 0.262335569f},
-std::array<float,2>{0.45379442f, 0.943882644f},
-std::array<float,2>{0.755668521f, 0.837606966f},
-std::array<float,2>{0.249375954f, 0.418579161f},
-std::array<float,2>{0.581444621f, 0.0959872976f},
-std::array<float,2>{0.402239799f, 0.561531365f},
-std::array<float,2>{0.731522977f, 0.703023195f},
-std::array<float,2>{0.312467635f, 0.194699839f},
-std::array<float,2>{0.899257004f, 0.337985724f},
-std::array<float,2>{0.0303109754f, 0.882192731f},
-std::array<float,2>{0.55158639f, 0.987312198f},
-std::array<float,2>{0.473303556f, 0.286248773f},
-std::array<float,2>{0.823063731f, 0.153576747f},
-std::array<float,2>{0.156730115f, 0.640907824f},
-std::array<float,2>{0.995537698f, 0.62302047f},
-std::array<float,2>{0.102942847f, 0.0431308076f},
-std::array<float,2>{0.634399533f, 0.449261069f},
-std::array<float,2>{0.356241316f, 0.777953744f},
-std::array<float,2>{0.938350201f, 0.752111018f},
-std::array<float,2>{0.0658036694f, 0.463036925f},
-std::array<float,2>{0.657949984f, 0.0576146618f},
-std::array<float,2>{0.323910415f, 0.603441954f},
-std::array<float,2>{0.511256754f, 0.634118915f},
-std::array<float,2>{0.444470763f, 0.125517398f},
-std::array<float,2>{0.845745683f, 0.309911162f},
-std::array<float,2>{0.152856722f, 0.978217602f},
-std::array<float,2>{0.695897043f, 0.891163588f},
-std::array<float,2>{0.258741826f, 0.325648576f},
-std::array<float,2>{0.930663288f, 0.213360548f},
-std::array<float,2>{0.0541453026f, 0.703778923f},
-std::array<float,2>{0.809826314f, 0.545309782f},
-std::array<float,2>{0.195920795f, 0.113107115f},
-std::array<float,2>{0.605799198f, 0.427277148f},
-std::array<float,2>{0.411803842f, 0.824605346f},
-std::array<float,2>{0.832822561f, 0.956317425f},
-std::array<float,2>{0.182610199f, 0.272120386f},
-std::array<float,2>{0.545894444f, 0.182013154f},
-std::array<float,2>{0.490839809f, 0.672082782f},
-std::array<float,2>{0.646448851f, 0.568726718f},
-std::array<float,2>{0.367145896f, 0.00372122857f},
-std::array<float,2>{0.979204357f, 0.48783496f},
-std::array<float,2>{0.122345895f, 0.790051937f},
-std::array<float,2>{0.569206476f, 0.871053517f},
-std::array<float,2>{0.384570777f, 0.382371455f},
-std::array<float,2>{0.768359542f, 0.0699108839f},
-std::array<float,2>{0.229742259f, 0.521690071f},
-std::array<float,2>{0.89043057f, 0.743898988f},
-std::array<float,2>{0.00956375152f, 0.228028297f},
-std::array<float,2>{0.749291956f, 0.36504215f},
-std::array<float,2>{0.287913084f, 0.906997442f},
-std::array<float,2>{0.970387638f, 0.972341597f},
-std::array<float,2>{0.115773953f, 0.297970593f},
-std::array<float,2>{0.650657952f, 0.140475169f},
-std::array<float,2>{0.368832231f, 0.628310025f},
-std::array<float,2>{0.53409493f, 0.595345199f},
-std::array<float,2>{0.495757699f, 0.0505782925f},
-std::array<float,2>{0.836640239f, 0.455316007f},
-std::array<float,2>{0.174240902f, 0.760212779f},
-std::array<float,2>{0.74123919f, 0.81532234f},
-std::array<float,2>{0.289725304f, 0.434166163f},
-std::array<float,2>{0.880847573f, 0.121881388f},
-std::array<float,2>{0.00574539416f, 0.531533003f},
-std::array<float,2>{0.7776016f, 0.713023722f},
-std::array<float,2>{0.222746059f, 0.203425869f},
-std::array<float,2>{0.571752667f, 0.318664551f},
-std::array<float,2>{0.377371937f, 0.903626204f},
-std::array<float,2>{0.854625821f, 0.787253022f},
-std::array<float,2>{0.142522499f, 0.492361218f},
-std::array<float,2>{0.505861163f, 0.0133731859f},
-std::array<float,2>{0.452301353f, 0.57642436f},
-std::array<float,2>{0.664865613f, 0.686404884f},
-std::array<float,2>{0.319656581f, 0.176599562f},
-std::array<float,2>{0.953103721f, 0.273459166f},
-std::array<float,2>{0.0773455352f, 0.967089772f},
-std::array<float,2>{0.599039674f, 0.921029568f},
-std::array<float,2>{0.415032119f, 0.370213836f},
-std::array<float,2>{0.800600469f, 0.221743822f},
-std::array<float,2>{0.187778801f, 0.741293192f},
-std::array<float,2>{0.926456332f, 0.526075542f},
-std::array<float,2>{0.05535689f, 0.0759910643f},
-std::array<float,2>{0.692809343f, 0.387142807f},
-std::array<float,2>{0.254501343f, 0.865656078f},
-std::array<float,2>{0.892537892f, 0.850833833f},
-std::array<float,2>{0.0230159182f, 0.398513585f},
-std::array<float,2>{0.723155022f, 0.0901247412f},
-std::array<float,2>{0.301283807f, 0.507837892f},
-std::array<float,2>{0.589517713f, 0.729688048f},
-std::array<float,2>{0.39474991f, 0.246509224f},
-std::array<float,2>{0.759297907f, 0.356522083f},
-std::array<float,2>{0.239055157f, 0.929801285f},
-std::array<float,2>{0.629136562f, 0.945593238f},
-std::array<float,2>{0.348540336f, 0.250168771f},
-std::array<float,2>{0.985024989f, 0.160218731f},
-std::array<float,2>{0.0991941243f, 0.656713724f},
-std::array<float,2>{0.819740117f, 0.587824523f},
-std::array<float,2>{0.171651646f, 0.0186487585f},
-std::array<float,2>{0.559915364f, 0.470697731f},
-std::array<float,2>{0.478169024f, 0.811224103f},
-std::array<float,2>{0.791113257f, 0.884596407f},
-std::array<float,2>{0.204388514f, 0.330646813f},
-std::array<float,2>{0.610446811f, 0.202914745f},
-std::array<float,2>{0.430353999f, 0.688482761f},
-std::array<float,2>{0.717042685f, 0.549650609f},
-std::array<float,2>{0.269435138f, 0.102693148f},
-std::array<float,2>{0.908132553f, 0.413312703f},
-std::array<float,2>{0.046531193f, 0.832653701f},
-std::array<float,2>{0.517829776f, 0.772066236f},
-std::array<float,2>{0.467236757f, 0.441949308f},
-std::array<float,2>{0.862719178f, 0.0361698978f},
-std::array<float,2>{0.133869663f, 0.613747537f},
-std::array<float,2>{0.968193352f, 0.655766428f},
-std::array<float,2>{0.0875734389f, 0.141791314f},
-std::array<float,2>{0.686545789f, 0.293162882f},
-std::array<float,2>{0.329732776f, 0.994767845f},
-std::array<float,2>{0.900235593f, 0.985919058f},
-std::array<float,2>{0.0297977664f, 0.28848505f},
-std::array<float,2>{0.731115997f, 0.154583439f},
-std::array<float,2>{0.311055779f, 0.642688513f},
-std::array<float,2>{0.58093363f, 0.623510599f},
-std::array<float,2>{0.400679082f, 0.0457498655f},
-std::array<float,2>{0.754130125f, 0.451173633f},
-std::array<float,2>{0.248772979f, 0.780273378f},
-std::array<float,2>{0.633524358f, 0.83874315f},
-std::array<float,2>{0.357115865f, 0.421693057f},
-std::array<float,2>{0.994317472f, 0.0943988487f},
-std::array<float,2>{0.101932384f, 0.559885383f},
-std::array<float,2>{0.824179649f, 0.700539291f},
-std::array<float,2>{0.157929376f, 0.193071499f},
-std::array<float,2>{0.552259624f, 0.337433934f},
-std::array<float,2>{0.473774254f, 0.880801439f},
-std::array<float,2>{0.78451246f, 0.79702419f},
-std::array<float,2>{0.21722056f, 0.478399187f},
-std::array<float,2>{0.620595396f, 0.0245445669f},
-std::array<float,2>{0.42409575f, 0.579225898f},
-std::array<float,2>{0.709363222f, 0.67025435f},
-std::array<float,2>{0.275061876f, 0.165932119f},
-std::array<float,2>{0.916779697f, 0.264304847f},
-std::array<float,2>{0.0315211862f, 0.942917287f},
-std::array<float,2>{0.525287747f, 0.923182547f},
-std::array<float,2>{0.454947889f, 0.34689042f},
-std::array<float,2>{0.87326926f, 0.23893255f},
-std::array<float,2>{0.130392343f, 0.720197618f},
-std::array<float,2>{0.957641721f, 0.504094422f},
-std::array<float,2>{0.0790488124f, 0.0828765035f},
-std::array<float,2>{0.677742898f, 0.395295799f},
-std::array<float,2>{0.339614362f, 0.857998073f},
-std::array<float,2>{0.979840875f, 0.868910134f},
-std::array<float,2>{0.121480614f, 0.379677594f},
-std::array<float,2>{0.644867599f, 0.067405805f},
-std::array<float,2>{0.365278065f, 0.520382583f},
-std::array<float,2>{0.546622813f, 0.745591342f},
-std::array<float,2>{0.491280347f, 0.228899881f},
-std::array<float,2>{0.83305198f, 0.36541152f},
-std::array<float,2>{0.182870924f, 0.909901798f},
-std::array<float,2>{0.74830538f, 0.954687834f},
-std::array<float,2>{0.288774461f, 0.269955158f},
-std::array<float,2>{0.888995469f, 0.180881187f},
-std::array<float,2>{0.00844218209f, 0.675038457f},
-std::array<float,2>{0.76872617f, 0.567243934f},
-std::array<float,2>{0.229459465f, 0.000241876827f},
-std::array<float,2>{0.569950819f, 0.485725582f},
-std::array<float,2>{0.383321583f, 0.791672409f},
-std::array<float,2>{0.847024024f, 0.893396318f},
-std::array<float,2>{0.15413852f, 0.326650262f},
-std::array<float,2>{0.509973288f, 0.212477624f},
-std::array<float,2>{0.443772137f, 0.705561638f},
-std::array<float,2>{0.657041371f, 0.543114007f},
-std::array<float,2>{0.322384238f, 0.111090541f},
-std::array<float,2>{0.939263046f, 0.429473549f},
-std::array<float,2>{0.0644655824f, 0.826359868f},
-std::array<float,2>{0.606490195f, 0.751016557f},
-std::array<float,2>{0.410302401f, 0.462827146f},
-std::array<float,2>{0.808933794f, 0.0564742908f},
-std::array<float,2>{0.196425512f, 0.605148554f},
-std::array<float,2>{0.93139118f, 0.636294246f},
-std::array<float,2>{0.0529821217f, 0.1273202f},
-std::array<float,2>{0.696993649f, 0.311291337f},
-std::array<float,2>{0.259101152f, 0.980200529f},
-std::array<float,2>{0.951282501f, 0.919488013f},
-std::array<float,2>{0.0769546703f, 0.368752271f},
-std::array<float,2>{0.665682852f, 0.219921663f},
-std::array<float,2>{0.319019407f, 0.738703072f},
-std::array<float,2>{0.50762862f, 0.525192082f},
-std::array<float,2>{0.451350331f, 0.0774151608f},
-std::array<float,2>{0.853801906f, 0.390211433f},
-std::array<float,2>{0.140962884f, 0.863955438f},
-std::array<float,2>{0.691934466f, 0.785351694f},
-std::array<float,2>{0.255624861f, 0.49455142f},
-std::array<float,2>{0.92736119f, 0.0140297553f},
-std::array<float,2>{0.0560671911f, 0.575244009f},
-std::array<float,2>{0.799092174f, 0.683625221f},
-std::array<float,2>{0.188681543f, 0.178402573f},
-std::array<float,2>{0.598603249f, 0.276914895f},
-std::array<float,2>{0.415053457f, 0.966627002f},
-std::array<float,2>{0.837217569f, 0.81398654f},
-std::array<float,2>{0.174907669f, 0.43702662f},
-std::array<float,2>{0.534723997f, 0.124295801f},
-std::array<float,2>{0.494770616f, 0.533986032f},
-std::array<float,2>{0.651467502f, 0.711244464f},
-std::array<float,2>{0.367586046f, 0.206803724f},
-std::array<float,2>{0.968866825f, 0.317038447f},
-std::array<float,2>{0.116222911f, 0.904993832f},
-std::array<float,2>{0.570439041f, 0.970434487f},
-std::array<float,2>{0.378755599f, 0.299895525f},
-std::array<float,2>{0.778331399f, 0.138238236f},
-std::array<float,2>{0.22373347f, 0.626293123f},
-std::array<float,2>{0.87940079f, 0.596161067f},
-std::array<float,2>{0.00396478875f, 0.0476276129f},
-std::array<float,2>{0.740311623f, 0.454079509f},
-std::array<float,2>{0.290639162f, 0.758997619f},
-std::array<float,2>{0.906627059f, 0.770787954f},
-std::array<float,2>{0.0456930138f, 0.443360031f},
-std::array<float,2>{0.718075156f, 0.0372708626f},
-std::array<float,2>{0.268108606f, 0.616627634f},
-std::array<float,2>{0.609760523f, 0.65416795f},
-std::array<float,2>{0.430903137f, 0.143523559f},
-std::array<float,2>{0.792860866f, 0.295653462f},
-std::array<float,2>{0.20388481f, 0.993622899f},
-std::array<float,2>{0.68563509f, 0.885942161f},
-std::array<float,2>{0.329058915f, 0.328705877f},
-std::array<float,2>{0.967249393f, 0.200878784f},
-std::array<float,2>{0.0868950486f, 0.690375209f},
-std::array<float,2>{0.861995935f, 0.547514439f},
-std::array<float,2>{0.133122668f, 0.104871407f},
-std::array<float,2>{0.519208789f, 0.410317689f},
-std::array<float,2>{0.468425035f, 0.835857093f},
-std::array<float,2>{0.758413613f, 0.94798851f},
-std::array<float,2>{0.239511102f, 0.25279513f},
-std::array<float,2>{0.588041663f, 0.162590325f},
-std::array<float,2>{0.396445602f, 0.658284783f},
-std::array<float,2>{0.723737061f, 0.588017523f},
-std::array<float,2>{0.302189708f, 0.0162382908f},
-std::array<float,2>{0.890769184f, 0.471445322f},
-std::array<float,2>{0.0219310261f, 0.810066164f},
-std::array<float,2>{0.558979332f, 0.847763777f},
-std::array<float,2>{0.476968288f, 0.4006235f},
-std::array<float,2>{0.818472207f, 0.0931615233f},
-std::array<float,2>{0.17019321f, 0.509975612f},
-std::array<float,2>{0.986308157f, 0.727976382f},
-std::array<float,2>{0.098373726f, 0.248502865f},
-std::array<float,2>{0.630585074f, 0.358065546f},
-std::array<float,2>{0.349318892f, 0.931885839f},
-std::array<float,2>{0.921960652f, 0.878342867f},
-std::array<float,2>{0.0608971901f, 0.339937299f},
-std::array<float,2>{0.689727783f, 0.191370144f},
-std::array<float,2>{0.251254529f, 0.69666642f},
-std::array<float,2>{0.595663607f, 0.556818843f},
-std::array<float,2>{0.419837475f, 0.100657776f},
-std::array<float,2>{0.800895095f, 0.417467684f},
-std::array<float,2>{0.193602994f, 0.840895236f},
-std::array<float,2>{0.670334339f, 0.773767471f},
-std::array<float,2>{0.314543903f, 0.448433816f},
-std::array<float,2>{0.945931315f, 0.0394298434f},
-std::array<float,2>{0.0722351f, 0.617397666f},
-std::array<float,2>{0.856382012f, 0.648392618f},
-std::array<float,2>{0.146036878f, 0.150646538f},
-std::array<float,2>{0.503829539f, 0.284694463f},
-std::array<float,2>{0.448146731f, 0.99097538f},
-std::array<float,2>{0.775115788f, 0.853610754f},
-std::array<float,2>{0.222573504f, 0.390987486f},
-std::array<float,2>{0.577018261f, 0.0817675516f},
-std::array<float,2>{0.380769253f, 0.502575696f},
-std::array<float,2>{0.737740576f, 0.723239064f},
-std::array<float,2>{0.294284463f, 0.235837102f},
-std::array<float,2>{0.878006577f, 0.34976989f},
-std::array<float,2>{0.00135997904f, 0.927431762f},
-std::array<float,2>{0.536876261f, 0.94078964f},
-std::array<float,2>{0.498075664f, 0.258484274f},
-std::array<float,2>{0.84343487f, 0.170560941f},
-std::array<float,2>{0.177042916f, 0.664770007f},
-std::array<float,2>{0.976279974f, 0.585837662f},
-std::array<float,2>{0.112559684f, 0.0297606159f},
-std::array<float,2>{0.654103875f, 0.480539322f},
-std::array<float,2>{0.373433471f, 0.801545084f},
-std::array<float,2>{0.963661849f, 0.794792175f},
-std::array<float,2>{0.090188615f, 0.491301149f},
-std::array<float,2>{0.679923058f, 0.00450479193f},
-std::array<float,2>{0.335455f, 0.564163566f},
-std::array<float,2>{0.522043824f, 0.677296937f},
-std::array<float,2>{0.462786973f, 0.187242955f},
-std::array<float,2>{0.866686046f, 0.266715795f},
-std::array<float,2>{0.13953428f, 0.958197534f},
-std::array<float,2>{0.714559138f, 0.911276996f},
-std::array<float,2>{0.272737741f, 0.361173034f},
-std::array<float,2>{0.911982298f, 0.233920828f},
-std::array<float,2>{0.0410031788f, 0.746113479f},
-std::array<float,2>{0.793840647f, 0.518245399f},
-std::array<float,2>{0.207167998f, 0.0657416359f},
-std::array<float,2>{0.614687979f, 0.375781357f},
-std::array<float,2>{0.435112178f, 0.872436941f},
-std::array<float,2>{0.816091061f, 0.984306097f},
-std::array<float,2>{0.165688038f, 0.30716005f},
-std::array<float,2>{0.55523324f, 0.130465016f},
-std::array<float,2>{0.480906844f, 0.640391648f},
-std::array<float,2>{0.627887368f, 0.605980396f},
-std::array<float,2>{0.346663266f, 0.0600666031f},
-std::array<float,2>{0.988811314f, 0.465398103f},
-std::array<float,2>{0.0958371535f, 0.755507827f},
-std::array<float,2>{0.592396498f, 0.823564947f},
-std::array<float,2>{0.392787635f, 0.424323499f},
-std::array<float,2>{0.765373051f, 0.113779455f},
-std::array<float,2>{0.238210663f, 0.541469812f},
-std::array<float,2>{0.895061433f, 0.708925068f},
-std::array<float,2>{0.0158682056f, 0.215977892f},
-std::array<float,2>{0.720988572f, 0.322996706f},
-std::array<float,2>{0.300287575f, 0.896829665f},
-std::array<float,2>{0.997220218f, 0.961760104f},
-std::array<float,2>{0.108555846f, 0.2778368f},
-std::array<float,2>{0.63789463f, 0.174641356f},
-std::array<float,2>{0.353912413f, 0.683555245f},
-std::array<float,2>{0.54949224f, 0.571928144f},
-std::array<float,2>{0.471084893f, 0.0112880627f},
-std::array<float,2>{0.825648129f, 0.499618471f},
-std::array<float,2>{0.163102388f, 0.781348944f},
-std::array<float,2>{0.730134726f, 0.860025644f},
-std::array<float,2>{0.304733574f, 0.383416146f},
-std::array<float,2>{0.902444243f, 0.0718684122f},
-std::array<float,2>{0.0238644928f, 0.528060377f},
-std::array<float,2>{0.752271473f, 0.735610485f},
-std::array<float,2>{0.246061519f, 0.223478794f},
-std::array<float,2>{0.583986759f, 0.373908311f},
-std::array<float,2>{0.40527609f, 0.914951444f},
-std::array<float,2>{0.868049741f, 0.764277279f},
-std::array<float,2>{0.125245094f, 0.457215607f},
-std::array<float,2>{0.529928982f, 0.051536575f},
-std::array<float,2>{0.459626824f, 0.597799838f},
-std::array<float,2>{0.675576806f, 0.629695833f},
-std::array<float,2>{0.342101097f, 0.135436252f},
-std::array<float,2>{0.953835785f, 0.301596403f},
-std::array<float,2>{0.0847897381f, 0.975330055f},
-std::array<float,2>{0.623853803f, 0.900079131f},
-std::array<float,2>{0.429062903f, 0.313210428f},
-std::array<float,2>{0.789041996f, 0.209093496f},
-std::array<float,2>{0.214561105f, 0.715462804f},
-std::array<float,2>{0.921175659f, 0.53624928f},
-std::array<float,2>{0.0369139239f, 0.118981741f},
-std::array<float,2>{0.705122113f, 0.433078468f},
-std::array<float,2>{0.279787958f, 0.819644332f},
-std::array<float,2>{0.884210289f, 0.831877947f},
-std::array<float,2>{0.0128376167f, 0.409474343f},
-std::array<float,2>{0.745066226f, 0.105847687f},
-std::array<float,2>{0.282408118f, 0.553066313f},
-std::array<float,2>{0.56381011f, 0.693671644f},
-std::array<float,2>{0.389249325f, 0.197629511f},
-std::array<float,2>{0.769855261f, 0.332960308f},
-std::array<float,2>{0.232768774f, 0.889035225f},
-std::array<float,2>{0.642941773f, 0.999833524f},
-std::array<float,2>{0.361414462f, 0.289828062f},
-std::array<float,2>{0.983792484f, 0.147840992f},
-std::array<float,2>{0.117846012f, 0.651961327f},
-std::array<float,2>{0.828565001f, 0.612543881f},
-std::array<float,2>{0.185242862f, 0.0338947847f},
-std::array<float,2>{0.539999545f, 0.441138953f},
-std::array<float,2>{0.486237228f, 0.769120276f},
-std::array<float,2>{0.807379663f, 0.937373877f},
-std::array<float,2>{0.199931189f, 0.353282869f},
-std::array<float,2>{0.604650557f, 0.244045526f},
-std::array<float,2>{0.409638852f, 0.732760429f},
-std::array<float,2>{0.699799538f, 0.51435715f},
-std::array<float,2>{0.265382946f, 0.0870208293f},
-std::array<float,2>{0.937013626f, 0.403412104f},
-std::array<float,2>{0.0481401384f, 0.846595645f},
-std::array<float,2>{0.515150726f, 0.80578649f},
-std::array<float,2>{0.44048664f, 0.474579632f},
-std::array<float,2>{0.850627422f, 0.0223429762f},
-std::array<float,2>{0.149524286f, 0.591364324f},
-std::array<float,2>{0.943685055f, 0.662896574f},
-std::array<float,2>{0.0679273829f, 0.158629507f},
-std::array<float,2>{0.660470665f, 0.254902989f},
-std::array<float,2>{0.326547205f, 0.950759232f},
-std::array<float,2>{0.915107787f, 0.944098711f},
-std::array<float,2>{0.0349847749f, 0.26262328f},
-std::array<float,2>{0.708352983f, 0.167104334f},
-std::array<float,2>{0.276454806f, 0.668837249f},
-std::array<float,2>{0.617687464f, 0.580296099f},
-std::array<float,2>{0.421896905f, 0.0271841194f},
-std::array<float,2>{0.782937288f, 0.479367077f},
-std::array<float,2>{0.216276556f, 0.798900366f},
-std::array<float,2>{0.675976515f, 0.856942594f},
-std::array<float,2>{0.337498486f, 0.397097975f},
-std::array<float,2>{0.96020025f, 0.0852566957f},
-std::array<float,2>{0.0810065046f, 0.506055236f},
-std::array<float,2>{0.872912645f, 0.721598506f},
-std::array<float,2>{0.131914064f, 0.241992146f},
-std::array<float,2>{0.525610864f, 0.343827724f},
-std::array<float,2>{0.456359386f, 0.925414264f},
-std::array<float,2>{0.7561602f, 0.778289735f},
-std::array<float,2>{0.246254399f, 0.449551731f},
-std::array<float,2>{0.579662263f, 0.0434182137f},
-std::array<float,2>{0.399532199f, 0.622752309f},
-std::array<float,2>{0.73336798f, 0.640752494f},
-std::array<float,2>{0.309325516f, 0.153512865f},
-std::array<float,2>{0.900464475f, 0.286453754f},
-std::array<float,2>{0.0279150661f, 0.987734675f},
-std::array<float,2>{0.553844571f, 0.881940484f},
-std::array<float,2>{0.47546643f, 0.338323653f},
-std::array<float,2>{0.822097719f, 0.194447726f},
-std::array<float,2>{0.160141304f, 0.702802181f},
-std::array<float,2>{0.993969142f, 0.561909318f},
-std::array<float,2>{0.104083963f, 0.0959254652f},
-std::array<float,2>{0.635438144f, 0.418927699f},
-std::array<float,2>{0.357458323f, 0.837697506f},
-std::array<float,2>{0.939879656f, 0.82429105f},
-std::array<float,2>{0.0625156239f, 0.42769888f},
-std::array<float,2>{0.658671796f, 0.112798534f},
-std::array<float,2>{0.321205318f, 0.544982612f},
-std::array<float,2>{0.509000659f, 0.70385915f},
-std::array<float,2>{0.44292146f, 0.213130623f},
-std::array<float,2>{0.844522417f, 0.325315982f},
-std::array<float,2>{0.155039594f, 0.891474664f},
-std::array<float,2>{0.698225141f, 0.978313267f},
-std::array<float,2>{0.260103613f, 0.309792012f},
-std::array<float,2>{0.932748973f, 0.125855029f},
-std::array<float,2>{0.0519448891f, 0.633856952f},
-std::array<float,2>{0.810903907f, 0.60324347f},
-std::array<float,2>{0.198378906f, 0.0571462326f},
-std::array<float,2>{0.608018577f, 0.463315248f},
-std::array<float,2>{0.413310796f, 0.752198637f},
-std::array<float,2>{0.834712565f, 0.906961381f},
-std::array<float,2>{0.181023672f, 0.364777833f},
-std::array<float,2>{0.544173598f, 0.2284161f},
-std::array<float,2>{0.488815218f, 0.743870795f},
-std::array<float,2>{0.64833343f, 0.521776497f},
-std::array<float,2>{0.364257812f, 0.0702771023f},
-std::array<float,2>{0.976816356f, 0.382628113f},
-std::array<float,2>{0.124696754f, 0.870795369f},
-std::array<float,2>{0.567225695f, 0.790377736f},
-std::array<float,2>{0.385637254f, 0.488174915f},
-std::array<float,2>{0.765717208f, 0.00351864705f},
-std::array<float,2>{0.228069395f, 0.568573534f},
-std::array<float,2>{0.887964427f, 0.672205627f},
-std::array<float,2>{0.0114068827f, 0.181766525f},
-std::array<float,2>{0.747338593f, 0.272327513f},
-std::array<float,2>{0.285222411f, 0.956180632f},
-std::array<float,2>{0.971030354f, 0.90355593f},
-std::array<float,2>{0.114684902f, 0.318388849f},
-std::array<float,2>{0.648990154f, 0.203239307f},
-std::array<float,2>{0.369637907f, 0.713244259f},
-std::array<float,2>{0.532589078f, 0.531354308f},
-std::array<float,2>{0.493094921f, 0.121728249f},
-std::array<float,2>{0.838571429f, 0.434520304f},
-std::array<float,2>{0.17192927f, 0.815082848f},
-std::array<float,2>{0.739687264f, 0.759951293f},
-std::array<float,2>{0.292770416f, 0.455399871f},
-std::array<float,2>{0.881424367f, 0.050502412f},
-std::array<float,2>{0.0060575176f, 0.595585465f},
-std::array<float,2>{0.780161798f, 0.628090262f},
-std::array<float,2>{0.226018503f, 0.140220791f},
-std::array<float,2>{0.572751641f, 0.298308015f},
-std::array<float,2>{0.376399726f, 0.97243315f},
-std::array<float,2>{0.851774812f, 0.865477502f},
-std::array<float,2>{0.142726004f, 0.386821777f},
-std::array<float,2>{0.505118906f, 0.0758521408f},
-std::array<float,2>{0.450283498f, 0.526276648f},
-std::array<float,2>{0.667875171f, 0.741602242f},
-std::array<float,2>{0.31729275f, 0.221972883f},
-std::array<float,2>{0.949833751f, 0.370445609f},
-std::array<float,2>{0.074555181f, 0.921193242f},
-std::array<float,2>{0.600691855f, 0.966946244f},
-std::array<float,2>{0.416438937f, 0.273708463f},
-std::array<float,2>{0.798697531f, 0.17635335f},
-std::array<float,2>{0.190253571f, 0.686214626f},
-std::array<float,2>{0.928183496f, 0.576393604f},
-std::array<float,2>{0.0580965988f, 0.0134424632f},
-std::array<float,2>{0.695029855f, 0.492660582f},
-std::array<float,2>{0.256144553f, 0.787450194f},
-std::array<float,2>{0.893544555f, 0.811368465f},
-std::array<float,2>{0.0211087931f, 0.470442414f},
-std::array<float,2>{0.726137102f, 0.0189636126f},
-std::array<float,2>{0.304402739f, 0.587615192f},
-std::array<float,2>{0.587400734f, 0.656348407f},
-std::array<float,2>{0.397697449f, 0.160632536f},
-std::array<float,2>{0.760191441f, 0.250345886f},
-std::array<float,2>{0.240798861f, 0.945346236f},
-std::array<float,2>{0.631667435f, 0.930052221f},
-std::array<float,2>{0.35129109f, 0.356917411f},
-std::array<float,2>{0.987597704f, 0.246204972f},
-std::array<float,2>{0.100296445f, 0.729776621f},
-std::array<float,2>{0.817908049f, 0.508287132f},
-std::array<float,2>{0.168236554f, 0.0898696184f},
-std::array<float,2>{0.561261117f, 0.398838818f},
-std::array<float,2>{0.480301857f, 0.850682557f},
-std::array<float,2>{0.789313197f, 0.994927406f},
-std::array<float,2>{0.206413135f, 0.293258518f},
-std::array<float,2>{0.612855434f, 0.142017901f},
-std::array<float,2>{0.431889415f, 0.656146646f},
-std::array<float,2>{0.715676725f, 0.613300323f},
-std::array<float,2>{0.266471982f, 0.0364580303f},
-std::array<float,2>{0.90827477f, 0.442272514f},
-std::array<float,2>{0.0441429652f, 0.772452354f},
-std::array<float,2>{0.517317653f, 0.832901597f},
-std::array<float,2>{0.46603635f, 0.413520783f},
-std::array<float,2>{0.861059666f, 0.10285259f},
-std::array<float,2>{0.13522467f, 0.549399137f},
-std::array<float,2>{0.964969456f, 0.688911557f},
-std::array<float,2>{0.0888140649f, 0.202748746f},
-std::array<float,2>{0.685471117f, 0.330883861f},
-std::array<float,2>{0.331719398f, 0.884400547f},
-std::array<float,2>{0.875889063f, 0.928504109f},
-std::array<float,2>{0.0035283796f, 0.348713219f},
-std::array<float,2>{0.734688938f, 0.237641871f},
-std::array<float,2>{0.296467543f, 0.72487694f},
-std::array<float,2>{0.574751794f, 0.501037419f},
-std::array<float,2>{0.382630378f, 0.0786345452f},
-std::array<float,2>{0.775731921f, 0.394226372f},
-std::array<float,2>{0.220401958f, 0.853081524f},
-std::array<float,2>{0.655821681f, 0.803940296f},
-std::array<float,2>{0.371228665f, 0.483100682f},
-std::array<float,2>{0.974395156f, 0.0285476577f},
-std::array<float,2>{0.109395638f, 0.583289564f},
-std::array<float,2>{0.841099262f, 0.666983366f},
-std::array<float,2>{0.178319886f, 0.168961063f},
-std::array<float,2>{0.537371695f, 0.259896278f},
-std::array<float,2>{0.497626066f, 0.938794732f},
-std::array<float,2>{0.803786337f, 0.843702316f},
-std::array<float,2>{0.191967055f, 0.414330363f},
-std::array<float,2>{0.59745115f, 0.0978900343f},
-std::array<float,2>{0.420248687f, 0.556121111f},
-std::array<float,2>{0.687961102f, 0.697464466f},
-std::array<float,2>{0.252892047f, 0.188405186f},
-std::array<float,2>{0.925161779f, 0.342142642f},
-std::array<float,2>{0.0601897351f, 0.875490487f},
-std::array<float,2>{0.501172483f, 0.990153074f},
-std::array<float,2>{0.447238564f, 0.282809049f},
-std::array<float,2>{0.857611656f, 0.149958894f},
-std::array<float,2>{0.147626966f, 0.645156085f},
-std::array<float,2>{0.947638333f, 0.620553315f},
-std::array<float,2>{0.0737086236f, 0.0426053554f},
-std::array<float,2>{0.668483734f, 0.44545114f},
-std::array<float,2>{0.312992662f, 0.775655568f},
-std::array<float,2>{0.992131352f, 0.756025076f},
-std::array<float,2>{0.0947933868f, 0.46822983f},
-std::array<float,2>{0.62656492f, 0.0619926713f},
-std::array<float,2>{0.345226377f, 0.608040273f},
-std::array<float,2>{0.557276905f, 0.637558877f},
-std::array<float,2>{0.48271659f, 0.13174957f},
-std::array<float,2>{0.813109934f, 0.305722892f},
-std::array<float,2>{0.166681692f, 0.981349647f},
-std::array<float,2>{0.720170498f, 0.895253062f},
-std::array<float,2>{0.296933264f, 0.3221322f},
-std::array<float,2>{0.898274481f, 0.218663678f},
-std::array<float,2>{0.0189408883f, 0.709457815f},
-std::array<float,2>{0.762846887f, 0.540672302f},
-std::array<float,2>{0.235743165f, 0.116163477f},
-std::array<float,2>{0.591263294f, 0.421978265f},
-std::array<float,2>{0.391850054f, 0.821761549f},
-std::array<float,2>{0.863777041f, 0.959440827f},
-std::array<float,2>{0.137947261f, 0.26819697f},
-std::array<float,2>{0.521482885f, 0.183744192f},
-std::array<float,2>{0.463879377f, 0.679026186f},
-std::array<float,2>{0.683388531f, 0.565747023f},
-std::array<float,2>{0.332929313f, 0.00675562676f},
-std::array<float,2>{0.962410033f, 0.490086347f},
-std::array<float,2>{0.0930735543f, 0.796349347f},
-std::array<float,2>{0.617103875f, 0.873943448f},
-std::array<float,2>{0.437408507f, 0.377214909f},
-std::array<float,2>{0.795331061f, 0.0633108467f},
-std::array<float,2>{0.21025674f, 0.516533136f},
-std::array<float,2>{0.912875891f, 0.749632478f},
-std::array<float,2>{0.0422926471f, 0.232314095f},
-std::array<float,2>{0.712588847f, 0.362760633f},
-std::array<float,2>{0.271398336f, 0.913319051f},
-std::array<float,2>{0.9563936f, 0.974356771f},
-std::array<float,2>{0.0831854045f, 0.303647578f},
-std::array<float,2>{0.672446251f, 0.133705527f},
-std::array<float,2>{0.341044158f, 0.632780254f},
-std::array<float,2>{0.527831018f, 0.600913584f},
-std::array<float,2>{0.458730817f, 0.0536633097f},
-std::array<float,2>{0.870853782f, 0.459671378f},
-std::array<float,2>{0.128395945f, 0.763392925f},
-std::array<float,2>{0.703528881f, 0.817985594f},
-std::array<float,2>{0.27758643f, 0.429967284f},
-std::array<float,2>{0.919317245f, 0.120467685f},
-std::array<float,2>{0.0372546688f, 0.537469327f},
-std::array<float,2>{0.785776198f, 0.716961086f},
-std::array<float,2>{0.2127022f, 0.207081109f},
-std::array<float,2>{0.621531069f, 0.316403389f},
-std::array<float,2>{0.427265137f, 0.902035475f},
-std::array<float,2>{0.827344239f, 0.783239603f},
-std::array<float,2>{0.160789818f, 0.497686982f},
-std::array<float,2>{0.547312617f, 0.00968457386f},
-std::array<float,2>{0.470588654f, 0.573067546f},
-std::array<float,2>{0.640026331f, 0.680921137f},
-std::array<float,2>{0.352555454f, 0.172586903f},
-std::array<float,2>{0.998089433f, 0.279800415f},
-std::array<float,2>{0.105963416f, 0.9636361f},
-std::array<float,2>{0.58364135f, 0.916884542f},
-std::array<float,2>{0.402750582f, 0.37179631f},
-std::array<float,2>{0.750502944f, 0.226146862f},
-std::array<float,2>{0.243215442f, 0.738025248f},
-std::array<float,2>{0.905896425f, 0.53063184f},
-std::array<float,2>{0.0258313678f, 0.073574014f},
-std::array<float,2>{0.727124512f, 0.384887308f},
-std::array<float,2>{0.306803226f, 0.863202095f},
-std::array<float,2>{0.934186518f, 0.844433367f},
-std::array<float,2>{0.0494897813f, 0.405167699f},
-std::array<float,2>{0.702092648f, 0.0884348378f},
-std::array<float,2>{0.261753976f, 0.513250649f},
-std::array<float,2>{0.602254748f, 0.731854439f},
-std::array<float,2>{0.406739533f, 0.245357871f},
-std::array<float,2>{0.805118203f, 0.353969306f},
-std::array<float,2>{0.201512352f, 0.934615254f},
-std::array<float,2>{0.663991094f, 0.953003228f},
-std::array<float,2>{0.32578674f, 0.257047832f},
-std::array<float,2>{0.941488683f, 0.157346576f},
-std::array<float,2>{0.0693428889f, 0.661745489f},
-std::array<float,2>{0.848568857f, 0.59222573f},
-std::array<float,2>{0.15077737f, 0.0213961266f},
-std::array<float,2>{0.512540996f, 0.474942803f},
-std::array<float,2>{0.439302742f, 0.806713998f},
-std::array<float,2>{0.772090018f, 0.886868536f},
-std::array<float,2>{0.232322142f, 0.334913254f},
-std::array<float,2>{0.566333055f, 0.195721298f},
-std::array<float,2>{0.38693437f, 0.691464901f},
-std::array<float,2>{0.744007468f, 0.551601052f},
-std::array<float,2>{0.284053802f, 0.107816249f},
-std::array<float,2>{0.885852516f, 0.406571418f},
-std::array<float,2>{0.0151050873f, 0.829897583f},
-std::array<float,2>{0.541925132f, 0.765969634f},
-std::array<float,2>{0.48821643f, 0.439395338f},
-std::array<float,2>{0.831885815f, 0.0330713205f},
-std::array<float,2>{0.187261701f, 0.610202491f},
-std::array<float,2>{0.981390715f, 0.649862647f},
-std::array<float,2>{0.119630814f, 0.144808143f},
-std::array<float,2>{0.641054511f, 0.292408824f},
-std::array<float,2>{0.359579265f, 0.996788025f},
-std::array<float,2>{0.932084322f, 0.978690028f},
-std::array<float,2>{0.0517241843f, 0.311792016f},
-std::array<float,2>{0.698676407f, 0.128181145f},
-std::array<float,2>{0.261440933f, 0.635443687f},
-std::array<float,2>{0.608762383f, 0.604325831f},
-std::array<float,2>{0.412332028f, 0.0554542616f},
-std::array<float,2>{0.812023997f, 0.461500853f},
-std::array<float,2>{0.198144302f, 0.750149488f},
-std::array<float,2>{0.659409106f, 0.828108728f},
-std::array<float,2>{0.322262675f, 0.428582966f},
-std::array<float,2>{0.941142678f, 0.109630384f},
-std::array<float,2>{0.0636974499f, 0.544306278f},
-std::array<float,2>{0.844934404f, 0.70698756f},
-std::array<float,2>{0.155734584f, 0.210938558f},
-std::array<float,2>{0.508417308f, 0.327246904f},
-std::array<float,2>{0.441949159f, 0.894476593f},
-std::array<float,2>{0.766881764f, 0.792554975f},
-std::array<float,2>{0.227204084f, 0.484544575f},
-std::array<float,2>{0.56821698f, 0.00117921154f},
-std::array<float,2>{0.386406004f, 0.567869842f},
-std::array<float,2>{0.746653616f, 0.674357891f},
-std::array<float,2>{0.286836445f, 0.180507839f},
-std::array<float,2>{0.886956871f, 0.270849377f},
-std::array<float,2>{0.00981238671f, 0.953715563f},
-std::array<float,2>{0.543800235f, 0.908471823f},
-std::array<float,2>{0.489626646f, 0.366920382f},
-std::array<float,2>{0.835750163f, 0.230137765f},
-std::array<float,2>{0.179702178f, 0.744826198f},
-std::array<float,2>{0.977899373f, 0.520819128f},
-std::array<float,2>{0.12393494f, 0.0665262043f},
-std::array<float,2>{0.647060037f, 0.380784422f},
-std::array<float,2>{0.364392996f, 0.867973685f},
-std::array<float,2>{0.959031701f, 0.858805478f},
-std::array<float,2>{0.0811851844f, 0.396198809f},
-std::array<float,2>{0.67733562f, 0.0837513432f},
-std::array<float,2>{0.336891115f, 0.505425036f},
-std::array<float,2>{0.527321577f, 0.719339192f},
-std::array<float,2>{0.455971807f, 0.239531189f},
-std::array<float,2>{0.871204972f, 0.345717192f},
-std::array<float,2>{0.131545439f, 0.922816098f},
-std::array<float,2>{0.707647443f, 0.942147434f},
-std::array<float,2>{0.276307434f, 0.265055776f},
-std::array<float,2>{0.915026605f, 0.164300382f},
-std::array<float,2>{0.0334526487f, 0.671443462f},
-std::array<float,2>{0.781856954f, 0.578936398f},
-std::array<float,2>{0.214894637f, 0.0240077544f},
-std::array<float,2>{0.618813217f, 0.476705372f},
-std::array<float,2>{0.423344493f, 0.798027515f},
-std::array<float,2>{0.820527911f, 0.879087508f},
-std::array<float,2>{0.158558622f, 0.336208284f},
-std::array<float,2>{0.553311586f, 0.192292154f},
-std::array<float,2>{0.476055473f, 0.699444413f},
-std::array<float,2>{0.635791421f, 0.558669806f},
-std::array<float,2>{0.358731747f, 0.0954636261f},
-std::array<float,2>{0.992878497f, 0.420856297f},
-std::array<float,2>{0.105323993f, 0.83928138f},
-std::array<float,2>{0.578129232f, 0.780793488f},
-std::array<float,2>{0.399136484f, 0.452851862f},
-std::array<float,2>{0.757385612f, 0.0462836549f},
-std::array<float,2>{0.247752011f, 0.624640465f},
-std::array<float,2>{0.901994407f, 0.643966615f},
-std::array<float,2>{0.0283616837f, 0.155799598f},
-std::array<float,2>{0.733577609f, 0.287130564f},
-std::array<float,2>{0.310100377f, 0.984745502f},
-std::array<float,2>{0.987213612f, 0.932831943f},
-std::array<float,2>{0.100942627f, 0.358614475f},
-std::array<float,2>{0.632195532f, 0.249269977f},
-std::array<float,2>{0.349775374f, 0.726833165f},
-std::array<float,2>{0.561582744f, 0.511213481f},
-std::array<float,2>{0.479344219f, 0.0921566933f},
-std::array<float,2>{0.816723585f, 0.401757538f},
-std::array<float,2>{0.169399872f, 0.84912461f},
-std::array<float,2>{0.725437939f, 0.80901885f},
-std::array<float,2>{0.302846313f, 0.472449929f},
-std::array<float,2>{0.894120991f, 0.0170376934f},
-std::array<float,2>{0.0197326206f, 0.589394212f},
-std::array<float,2>{0.761547804f, 0.659552634f},
-std::array<float,2>{0.24146463f, 0.163638592f},
-std::array<float,2>{0.586200714f, 0.253360778f},
-std::array<float,2>{0.397200465f, 0.948492944f},
-std::array<float,2>{0.860252798f, 0.834550083f},
-std::array<float,2>{0.136660248f, 0.411822408f},
-std::array<float,2>{0.515691638f, 0.103873402f},
-std::array<float,2>{0.465598732f, 0.54795593f},
-std::array<float,2>{0.684457064f, 0.690896392f},
-std::array<float,2>{0.330930561f, 0.199820012f},
-std::array<float,2>{0.965928137f, 0.329213947f},
-std::array<float,2>{0.0892251059f, 0.885277927f},
-std::array<float,2>{0.611884475f, 0.99293834f},
-std::array<float,2>{0.43263635f, 0.296452731f},
-std::array<float,2>{0.790734112f, 0.144008726f},
-std::array<float,2>{0.205768302f, 0.652923226f},
-std::array<float,2>{0.909782708f, 0.615307868f},
-std::array<float,2>{0.0431547239f, 0.0381202996f},
-std::array<float,2>{0.716795623f, 0.444397837f},
-std::array<float,2>{0.267185688f, 0.769713759f},
-std::array<float,2>{0.882090271f, 0.75869745f},
-std::array<float,2>{0.0071766898f, 0.454148382f},
-std::array<float,2>{0.738712013f, 0.0479249544f},
-std::array<float,2>{0.291964978f, 0.596828938f},
-std::array<float,2>{0.573619008f, 0.625267029f},
-std::array<float,2>{0.375542611f, 0.136901006f},
-std::array<float,2>{0.780416489f, 0.299527317f},
-std::array<float,2>{0.224931762f, 0.969648659f},
-std::array<float,2>{0.649555385f, 0.905687094f},
-std::array<float,2>{0.370497763f, 0.318068355f},
-std::array<float,2>{0.971755803f, 0.205689609f},
-std::array<float,2>{0.113983065f, 0.712755561f},
-std::array<float,2>{0.839670241f, 0.534860909f},
-std::array<float,2>{0.173651174f, 0.123572655f},
-std::array<float,2>{0.531256199f, 0.436169654f},
-std::array<float,2>{0.494023055f, 0.813453734f},
-std::array<float,2>{0.797098815f, 0.964914083f},
-std::array<float,2>{0.191012993f, 0.275603324f},
-std::array<float,2>{0.599719167f, 0.178976163f},
-std::array<float,2>{0.417314291f, 0.68528223f},
-std::array<float,2>{0.693851471f, 0.574400723f},
-std::array<float,2>{0.256953657f, 0.0149535602f},
-std::array<float,2>{0.928862631f, 0.495453924f},
-std::array<float,2>{0.0574987866f, 0.786887527f},
-std::array<float,2>{0.504609346f, 0.864327013f},
-std::array<float,2>{0.449793696f, 0.388952255f},
-std::array<float,2>{0.852681339f, 0.0767392442f},
-std::array<float,2>{0.143717989f, 0.524001837f},
-std::array<float,2>{0.951013327f, 0.740169823f},
-std::array<float,2>{0.0755855218f, 0.21971266f},
-std::array<float,2>{0.666513026f, 0.367628485f},
-std::array<float,2>{0.318047822f, 0.918270648f},
-std::array<float,2>{0.896741509f, 0.898204803f},
-std::array<float,2>{0.0185209103f, 0.324020952f},
-std::array<float,2>{0.718787849f, 0.214956358f},
-std::array<float,2>{0.298090637f, 0.707269609f},
-std::array<float,2>{0.590424299f, 0.54242754f},
-std::array<float,2>{0.391098738f, 0.11486543f},
-std::array<float,2>{0.762593508f, 0.425720781f},
-std::array<float,2>{0.234446689f, 0.82260555f},
-std::array<float,2>{0.625137866f, 0.754029036f},
-std::array<float,2>{0.344705671f, 0.466500491f},
-std::array<float,2>{0.990244329f, 0.0594108663f},
-std::array<float,2>{0.094501093f, 0.606500924f},
-std::array<float,2>{0.814255357f, 0.638681114f},
-std::array<float,2>{0.167414188f, 0.129647195f},
-std::array<float,2>{0.557868183f, 0.307827652f},
-std::array<float,2>{0.484217376f, 0.982659817f},
-std::array<float,2>{0.796344995f, 0.871332407f},
-std::array<float,2>{0.209879771f, 0.376158774f},
-std::array<float,2>{0.615378082f, 0.0654279292f},
-std::array<float,2>{0.435842067f, 0.51935029f},
-std::array<float,2>{0.711127043f, 0.748020351f},
-std::array<float,2>{0.26993534f, 0.233098552f},
-std::array<float,2>{0.913624823f, 0.360290676f},
-std::array<float,2>{0.0413764007f, 0.910534084f},
-std::array<float,2>{0.520153701f, 0.957581103f},
-std::array<float,2>{0.463727385f, 0.266374379f},
-std::array<float,2>{0.865213454f, 0.186207294f},
-std::array<float,2>{0.136735722f, 0.676622987f},
-std::array<float,2>{0.961561978f, 0.563020051f},
-std::array<float,2>{0.0926748961f, 0.00540978601f},
-std::array<float,2>{0.681821287f, 0.49024725f},
-std::array<float,2>{0.333579451f, 0.793286264f},
-std::array<float,2>{0.973442435f, 0.802504838f},
-std::array<float,2>{0.110703774f, 0.481643111f},
-std::array<float,2>{0.654502332f, 0.030843487f},
-std::array<float,2>{0.372110367f, 0.584230006f},
-std::array<float,2>{0.538309753f, 0.665490448f},
-std::array<float,2>{0.496346325f, 0.171387419f},
-std::array<float,2>{0.840661407f, 0.259034425f},
-std::array<float,2>{0.178855509f, 0.939514279f},
-std::array<float,2>{0.735720336f, 0.926447153f},
-std::array<float,2>{0.295379281f, 0.351188213f},
-std::array<float,2>{0.876152277f, 0.234734759f},
-std::array<float,2>{0.00240804069f, 0.723844051f},
-std::array<float,2>{0.776896954f, 0.503728211f},
-std::array<float,2>{0.21889399f, 0.0802659839f},
-std::array<float,2>{0.576072097f, 0.392170161f},
-std::array<float,2>{0.38111034f, 0.85508877f},
-std::array<float,2>{0.858673036f, 0.991338789f},
-std::array<float,2>{0.146864265f, 0.284102499f},
-std::array<float,2>{0.500562251f, 0.151796728f},
-std::array<float,2>{0.4456532f, 0.6471982f},
-std::array<float,2>{0.669124007f, 0.618321061f},
-std::array<float,2>{0.31440106f, 0.040555127f},
-std::array<float,2>{0.948751926f, 0.448067844f},
-std::array<float,2>{0.0725043267f, 0.774881959f},
-std::array<float,2>{0.596423864f, 0.84054637f},
-std::array<float,2>{0.421183288f, 0.416768014f},
-std::array<float,2>{0.802795708f, 0.0998174399f},
-std::array<float,2>{0.192754969f, 0.557783127f},
-std::array<float,2>{0.924537778f, 0.696219325f},
-std::array<float,2>{0.0595512427f, 0.190347672f},
-std::array<float,2>{0.689407051f, 0.341024578f},
-std::array<float,2>{0.253455162f, 0.877422571f},
-std::array<float,2>{0.943166852f, 0.949594557f},
-std::array<float,2>{0.0691507384f, 0.254052997f},
-std::array<float,2>{0.662193537f, 0.159957007f},
-std::array<float,2>{0.324760377f, 0.663354814f},
-std::array<float,2>{0.513475418f, 0.590742707f},
-std::array<float,2>{0.438066423f, 0.0227438733f},
-std::array<float,2>{0.849126518f, 0.47281456f},
-std::array<float,2>{0.151744694f, 0.805048883f},
-std::array<float,2>{0.702627957f, 0.847045481f},
-std::array<float,2>{0.263609231f, 0.403217733f},
-std::array<float,2>{0.935120285f, 0.0862638652f},
-std::array<float,2>{0.0506959818f, 0.515009999f},
-std::array<float,2>{0.806047678f, 0.734068692f},
-std::array<float,2>{0.202710137f, 0.24258773f},
-std::array<float,2>{0.602788329f, 0.351615041f},
-std::array<float,2>{0.407415807f, 0.936306238f},
-std::array<float,2>{0.830176115f, 0.76765126f},
-std::array<float,2>{0.186445266f, 0.439632595f},
-std::array<float,2>{0.542776704f, 0.035056293f},
-std::array<float,2>{0.486639231f, 0.611360908f},
-std::array<float,2>{0.642435193f, 0.650767624f},
-std::array<float,2>{0.360775143f, 0.146892741f},
-std::array<float,2>{0.981709957f, 0.290443122f},
-std::array<float,2>{0.120535262f, 0.998938143f},
-std::array<float,2>{0.564656615f, 0.890364587f},
-std::array<float,2>{0.388309032f, 0.333185911f},
-std::array<float,2>{0.772913039f, 0.198581561f},
-std::array<float,2>{0.230683684f, 0.694377244f},
-std::array<float,2>{0.885617375f, 0.554120541f},
-std::array<float,2>{0.0138700139f, 0.107378267f},
-std::array<float,2>{0.74283731f, 0.409026146f},
-std::array<float,2>{0.284588963f, 0.830774248f},
-std::array<float,2>{0.918424547f, 0.818492651f},
-std::array<float,2>{0.0381200872f, 0.432299703f},
-std::array<float,2>{0.704951644f, 0.117401458f},
-std::array<float,2>{0.279249847f, 0.535194576f},
-std::array<float,2>{0.622737467f, 0.716740608f},
-std::array<float,2>{0.426416606f, 0.210520148f},
-std::array<float,2>{0.786887884f, 0.313672096f},
-std::array<float,2>{0.210985407f, 0.899379373f},
-std::array<float,2>{0.673350692f, 0.976408899f},
-std::array<float,2>{0.339940935f, 0.30220449f},
-std::array<float,2>{0.955430925f, 0.13574928f},
-std::array<float,2>{0.0826964751f, 0.63080126f},
-std::array<float,2>{0.869276464f, 0.598984122f},
-std::array<float,2>{0.127384976f, 0.0521623008f},
-std::array<float,2>{0.528509438f, 0.458342731f},
-std::array<float,2>{0.457351744f, 0.765614867f},
-std::array<float,2>{0.751293778f, 0.915870309f},
-std::array<float,2>{0.242508352f, 0.374412358f},
-std::array<float,2>{0.582815826f, 0.223858818f},
-std::array<float,2>{0.403575987f, 0.734712183f},
-std::array<float,2>{0.728341997f, 0.529075503f},
-std::array<float,2>{0.30764538f, 0.0711060315f},
-std::array<float,2>{0.9048841f, 0.384093255f},
-std::array<float,2>{0.0270282533f, 0.861118376f},
-std::array<float,2>{0.548714697f, 0.782293916f},
-std::array<float,2>{0.46925357f, 0.498936862f},
-std::array<float,2>{0.826653183f, 0.0105114765f},
-std::array<float,2>{0.162010998f, 0.571103036f},
-std::array<float,2>{0.99921757f, 0.682159781f},
-std::array<float,2>{0.107121356f, 0.175265834f},
-std::array<float,2>{0.638742089f, 0.279107332f},
-std::array<float,2>{0.351715237f, 0.962557256f},
-std::array<float,2>{0.890084505f, 0.955153763f},
-std::array<float,2>{0.00889223069f, 0.273055196f},
-std::array<float,2>{0.749521494f, 0.183477148f},
-std::array<float,2>{0.287125409f, 0.673639059f},
-std::array<float,2>{0.56883353f, 0.56980747f},
-std::array<float,2>{0.384002328f, 0.00252684089f},
-std::array<float,2>{0.767619073f, 0.48677063f},
-std::array<float,2>{0.230014995f, 0.789893985f},
-std::array<float,2>{0.645650566f, 0.869555175f},
-std::array<float,2>{0.366373003f, 0.381731421f},
-std::array<float,2>{0.978953123f, 0.0687872544f},
-std::array<float,2>{0.122715898f, 0.522897184f},
-std::array<float,2>{0.832449257f, 0.742636263f},
-std::array<float,2>{0.181872949f, 0.226814628f},
-std::array<float,2>{0.545011282f, 0.363955617f},
-std::array<float,2>{0.490414619f, 0.908158302f},
-std::array<float,2>{0.810175359f, 0.753243983f},
-std::array<float,2>{0.195547074f, 0.464709073f},
-std::array<float,2>{0.606223404f, 0.0582939759f},
-std::array<float,2>{0.411458582f, 0.602143824f},
-std::array<float,2>{0.695450664f, 0.633349419f},
-std::array<float,2>{0.257977158f, 0.126155227f},
-std::array<float,2>{0.930063903f, 0.309446007f},
-std::array<float,2>{0.0546715818f, 0.976864994f},
-std::array<float,2>{0.510786355f, 0.891983569f},
-std::array<float,2>{0.44529891f, 0.324553162f},
-std::array<float,2>{0.846592367f, 0.214133725f},
-std::array<float,2>{0.152568445f, 0.704488754f},
-std::array<float,2>{0.937605858f, 0.546273768f},
-std::array<float,2>{0.0662891716f, 0.111743979f},
-std::array<float,2>{0.657356322f, 0.426415592f},
-std::array<float,2>{0.323437214f, 0.825682878f},
-std::array<float,2>{0.995939195f, 0.836711407f},
-std::array<float,2>{0.103315882f, 0.41989994f},
-std::array<float,2>{0.634272933f, 0.097597979f},
-std::array<float,2>{0.355814904f, 0.560891092f},
-std::array<float,2>{0.551025987f, 0.701366246f},
-std::array<float,2>{0.472994655f, 0.194162458f},
-std::array<float,2>{0.822327375f, 0.339698285f},
-std::array<float,2>{0.156988904f, 0.881384075f},
-std::array<float,2>{0.731971264f, 0.986537874f},
-std::array<float,2>{0.311971456f, 0.285396785f},
-std::array<float,2>{0.898513854f, 0.153243214f},
-std::array<float,2>{0.030762475f, 0.642115057f},
-std::array<float,2>{0.755077183f, 0.621217966f},
-std::array<float,2>{0.249920711f, 0.0446368605f},
-std::array<float,2>{0.581581712f, 0.451068312f},
-std::array<float,2>{0.401595354f, 0.778615117f},
-std::array<float,2>{0.874909341f, 0.924423575f},
-std::array<float,2>{0.129470691f, 0.345361918f},
-std::array<float,2>{0.523674965f, 0.240375295f},
-std::array<float,2>{0.453444868f, 0.722625554f},
-std::array<float,2>{0.679003119f, 0.506896794f},
-std::array<float,2>{0.338384271f, 0.0848153308f},
-std::array<float,2>{0.958590209f, 0.398343503f},
-std::array<float,2>{0.0792647973f, 0.855507374f},
-std::array<float,2>{0.620049596f, 0.800678313f},
-std::array<float,2>{0.425002694f, 0.480296016f},
-std::array<float,2>{0.783487797f, 0.0256437007f},
-std::array<float,2>{0.218312413f, 0.581104398f},
-std::array<float,2>{0.917060316f, 0.669367492f},
-std::array<float,2>{0.0328190289f, 0.166860566f},
-std::array<float,2>{0.710130632f, 0.263318688f},
-std::array<float,2>{0.273920089f, 0.944406688f},
-std::array<float,2>{0.968653381f, 0.882842541f},
-std::array<float,2>{0.0869209394f, 0.331194907f},
-std::array<float,2>{0.687279582f, 0.202087268f},
-std::array<float,2>{0.329296708f, 0.687950313f},
-std::array<float,2>{0.518103302f, 0.55039078f},
-std::array<float,2>{0.467445612f, 0.102460891f},
-std::array<float,2>{0.863258719f, 0.412320137f},
-std::array<float,2>{0.13444221f, 0.833064675f},
-std::array<float,2>{0.717442274f, 0.773055196f},
-std::array<float,2>{0.268689215f, 0.442976654f},
-std::array<float,2>{0.907530427f, 0.0354462303f},
-std::array<float,2>{0.0462488793f, 0.614355862f},
-std::array<float,2>{0.791723013f, 0.654504538f},
-std::array<float,2>{0.204865813f, 0.141413867f},
-std::array<float,2>{0.611000001f, 0.294106632f},
-std::array<float,2>{0.430001855f, 0.995514214f},
-std::array<float,2>{0.820215166f, 0.849898517f},
-std::array<float,2>{0.171097279f, 0.399955064f},
-std::array<float,2>{0.560291827f, 0.0913818777f},
-std::array<float,2>{0.477555513f, 0.509637713f},
-std::array<float,2>{0.62986362f, 0.728704274f},
-std::array<float,2>{0.348020643f, 0.247592241f},
-std::array<float,2>{0.984591365f, 0.356443018f},
-std::array<float,2>{0.0989842117f, 0.9309448f},
-std::array<float,2>{0.58920306f, 0.946492493f},
-std::array<float,2>{0.395178199f, 0.25170818f},
-std::array<float,2>{0.759094894f, 0.161771715f},
-std::array<float,2>{0.238644734f, 0.657788098f},
-std::array<float,2>{0.891627312f, 0.586566985f},
-std::array<float,2>{0.0226574261f, 0.0185165182f},
-std::array<float,2>{0.722816765f, 0.469508469f},
-std::array<float,2>{0.300820559f, 0.812299371f},
-std::array<float,2>{0.925971508f, 0.788868487f},
-std::array<float,2>{0.0549703278f, 0.49358198f},
-std::array<float,2>{0.692934036f, 0.0117630037f},
-std::array<float,2>{0.254345983f, 0.577616274f},
-std::array<float,2>{0.599169672f, 0.686885953f},
-std::array<float,2>{0.414138943f, 0.177213177f},
-std::array<float,2>{0.799922764f, 0.274520457f},
-std::array<float,2>{0.18804045f, 0.968671739f},
-std::array<float,2>{0.66450578f, 0.920811296f},
-std::array<float,2>{0.319894105f, 0.369312227f},
-std::array<float,2>{0.952568293f, 0.221097305f},
-std::array<float,2>{0.0777133554f, 0.740460098f},
-std::array<float,2>{0.85526979f, 0.527319372f},
-std::array<float,2>{0.141705915f, 0.0746746659f},
-std::array<float,2>{0.506700635f, 0.387813538f},
-std::array<float,2>{0.452752888f, 0.86655736f},
-std::array<float,2>{0.778228343f, 0.971043646f},
-std::array<float,2>{0.223559186f, 0.297388941f},
-std::array<float,2>{0.571809173f, 0.139648035f},
-std::array<float,2>{0.37774846f, 0.627058864f},
-std::array<float,2>{0.741730809f, 0.594295323f},
-std::array<float,2>{0.289276302f, 0.0488965288f},
-std::array<float,2>{0.880108416f, 0.456455708f},
-std::array<float,2>{0.00520302681f, 0.761431515f},
-std::array<float,2>{0.533601165f, 0.816019237f},
-std::array<float,2>{0.495543867f, 0.435003668f},
-std::array<float,2>{0.836094379f, 0.122770041f},
-std::array<float,2>{0.174400166f, 0.532765448f},
-std::array<float,2>{0.969794869f, 0.714081526f},
-std::array<float,2>{0.115363203f, 0.204660594f},
-std::array<float,2>{0.651119113f, 0.319595546f},
-std::array<float,2>{0.368170232f, 0.902350366f},
-std::array<float,2>{0.910161793f, 0.912629485f},
-std::array<float,2>{0.0393839516f, 0.362012923f},
-std::array<float,2>{0.713551819f, 0.230565563f},
-std::array<float,2>{0.27226305f, 0.74885416f},
-std::array<float,2>{0.614115238f, 0.516961992f},
-std::array<float,2>{0.434468687f, 0.0638728365f},
-std::array<float,2>{0.79403758f, 0.378070951f},
-std::array<float,2>{0.208288208f, 0.874710023f},
-std::array<float,2>{0.681530535f, 0.79519403f},
-std::array<float,2>{0.334837347f, 0.488377273f},
-std::array<float,2>{0.964024246f, 0.00713589508f},
-std::array<float,2>{0.0915473998f, 0.564907193f},
-std::array<float,2>{0.865252674f, 0.678652823f},
-std::array<float,2>{0.140423223f, 0.184934884f},
-std::array<float,2>{0.522664845f, 0.268960059f},
-std::array<float,2>{0.461570501f, 0.96024543f},
-std::array<float,2>{0.763838708f, 0.820964873f},
-std::array<float,2>{0.236943245f, 0.423209995f},
-std::array<float,2>{0.593242764f, 0.116412409f},
-std::array<float,2>{0.394128978f, 0.539339483f},
-std::array<float,2>{0.722484708f, 0.71062094f},
-std::array<float,2>{0.298923343f, 0.21702978f},
-std::array<float,2>{0.896412492f, 0.320721507f},
-std::array<float,2>{0.0170646049f, 0.895643413f},
-std::array<float,2>{0.556440055f, 0.981668234f},
-std::array<float,2>{0.481496453f, 0.304847389f},
-std::array<float,2>{0.815320849f, 0.132414177f},
-std::array<float,2>{0.164752692f, 0.6378268f},
-std::array<float,2>{0.989667535f, 0.608499587f},
-std::array<float,2>{0.0971976966f, 0.0607197173f},
-std::array<float,2>{0.628606141f, 0.466993272f},
-std::array<float,2>{0.347317666f, 0.757756948f},
-std::array<float,2>{0.946810007f, 0.776425004f},
-std::array<float,2>{0.0707919374f, 0.446567625f},
-std::array<float,2>{0.671114206f, 0.0412933528f},
-std::array<float,2>{0.316332608f, 0.620064735f},
-std::array<float,2>{0.502760589f, 0.645745337f},
-std::array<float,2>{0.449069679f, 0.148852825f},
-std::array<float,2>{0.856965959f, 0.281788498f},
-std::array<float,2>{0.145246416f, 0.988381863f},
-std::array<float,2>{0.690874577f, 0.876005352f},
-std::array<float,2>{0.25060755f, 0.342857599f},
-std::array<float,2>{0.923175454f, 0.188740134f},
-std::array<float,2>{0.0620466881f, 0.698405027f},
-std::array<float,2>{0.802151263f, 0.555390775f},
-std::array<float,2>{0.19514294f, 0.0994734988f},
-std::array<float,2>{0.594015718f, 0.415253967f},
-std::array<float,2>{0.418332517f, 0.842640638f},
-std::array<float,2>{0.842665136f, 0.938064575f},
-std::array<float,2>{0.175885245f, 0.260978222f},
-std::array<float,2>{0.535208762f, 0.168269262f},
-std::array<float,2>{0.499847144f, 0.667409778f},
-std::array<float,2>{0.65329051f, 0.582478166f},
-std::array<float,2>{0.374231815f, 0.0280316044f},
-std::array<float,2>{0.97472477f, 0.483771443f},
-std::array<float,2>{0.111555904f, 0.80336982f},
-std::array<float,2>{0.577917516f, 0.851860046f},
-std::array<float,2>{0.379820049f, 0.39351216f},
-std::array<float,2>{0.774198592f, 0.0797737911f},
-std::array<float,2>{0.220815137f, 0.500022709f},
-std::array<float,2>{0.877680719f, 0.726171494f},
-std::array<float,2>{0.000630213937f, 0.236352652f},
-std::array<float,2>{0.736999512f, 0.34777227f},
-std::array<float,2>{0.293707252f, 0.929123163f},
-std::array<float,2>{0.982781231f, 0.997872889f},
-std::array<float,2>{0.118611164f, 0.291739702f},
-std::array<float,2>{0.643661976f, 0.145673707f},
-std::array<float,2>{0.362742186f, 0.649109125f},
-std::array<float,2>{0.540801585f, 0.610955715f},
-std::array<float,2>{0.485064626f, 0.0313654952f},
-std::array<float,2>{0.82923913f, 0.43810764f},
-std::array<float,2>{0.183951467f, 0.767128468f},
-std::array<float,2>{0.74587512f, 0.828329742f},
-std::array<float,2>{0.281482399f, 0.407842875f},
-std::array<float,2>{0.883532405f, 0.109219618f},
-std::array<float,2>{0.0123868706f, 0.551965714f},
-std::array<float,2>{0.771067619f, 0.693237245f},
-std::array<float,2>{0.234277695f, 0.196451619f},
-std::array<float,2>{0.562933922f, 0.335416913f},
-std::array<float,2>{0.390343457f, 0.888551414f},
-std::array<float,2>{0.849865794f, 0.808072329f},
-std::array<float,2>{0.148643896f, 0.475781322f},
-std::array<float,2>{0.51380533f, 0.0196009297f},
-std::array<float,2>{0.4397026f, 0.593413174f},
-std::array<float,2>{0.661934257f, 0.660540581f},
-std::array<float,2>{0.327917755f, 0.157165155f},
-std::array<float,2>{0.944694698f, 0.256008238f},
-std::array<float,2>{0.0671898052f, 0.951523542f},
-std::array<float,2>{0.603822589f, 0.933613598f},
-std::array<float,2>{0.408277452f, 0.354621232f},
-std::array<float,2>{0.80783397f, 0.244514108f},
-std::array<float,2>{0.200807825f, 0.731405795f},
-std::array<float,2>{0.936104655f, 0.511784256f},
-std::array<float,2>{0.047454454f, 0.0897547379f},
-std::array<float,2>{0.700806856f, 0.405982465f},
-std::array<float,2>{0.264630556f, 0.844979882f},
-std::array<float,2>{0.903956413f, 0.861965358f},
-std::array<float,2>{0.0249641351f, 0.386139154f},
-std::array<float,2>{0.728843331f, 0.0727467313f},
-std::array<float,2>{0.306127667f, 0.529655218f},
-std::array<float,2>{0.58561945f, 0.737043619f},
-std::array<float,2>{0.404583156f, 0.224841595f},
-std::array<float,2>{0.753390729f, 0.372620791f},
-std::array<float,2>{0.244490698f, 0.917009115f},
-std::array<float,2>{0.637474835f, 0.964041293f},
-std::array<float,2>{0.355149716f, 0.281218261f},
-std::array<float,2>{0.996918619f, 0.173813313f},
-std::array<float,2>{0.107753776f, 0.679953039f},
-std::array<float,2>{0.824564695f, 0.573587596f},
-std::array<float,2>{0.162609354f, 0.00858856179f},
-std::array<float,2>{0.550179482f, 0.496183634f},
-std::array<float,2>{0.471759677f, 0.784778595f},
-std::array<float,2>{0.787865102f, 0.900646269f},
-std::array<float,2>{0.21305263f, 0.314903647f},
-std::array<float,2>{0.624809444f, 0.208362669f},
-std::array<float,2>{0.427821457f, 0.718534231f},
-std::array<float,2>{0.706418097f, 0.538935781f},
-std::array<float,2>{0.281171083f, 0.119308524f},
-std::array<float,2>{0.919986367f, 0.431062996f},
-std::array<float,2>{0.0358984061f, 0.816933751f},
-std::array<float,2>{0.530431688f, 0.761740983f},
-std::array<float,2>{0.460812777f, 0.460914433f},
-std::array<float,2>{0.869001925f, 0.0541422404f},
-std::array<float,2>{0.126027077f, 0.600287676f},
-std::array<float,2>{0.954140007f, 0.631678998f},
-std::array<float,2>{0.0853884295f, 0.134525269f},
-std::array<float,2>{0.674637318f, 0.304456264f},
-std::array<float,2>{0.343247116f, 0.973313749f},
-std::array<float,2>{0.880545199f, 0.969140947f},
-std::array<float,2>{0.00543501554f, 0.299204439f},
-std::array<float,2>{0.741571784f, 0.137494087f},
-std::array<float,2>{0.289892286f, 0.625816345f},
-std::array<float,2>{0.571425974f, 0.597298741f},
-std::array<float,2>{0.376985252f, 0.0484058894f},
-std::array<float,2>{0.777493298f, 0.455040574f},
-std::array<float,2>{0.223106101f, 0.757824659f},
-std::array<float,2>{0.6504215f, 0.812629044f},
-std::array<float,2>{0.368897498f, 0.435674638f},
-std::array<float,2>{0.970491886f, 0.123321727f},
-std::array<float,2>{0.1160549f, 0.534618855f},
-std::array<float,2>{0.836854637f, 0.712015867f},
-std::array<float,2>{0.17397505f, 0.205220029f},
-std::array<float,2>{0.533769608f, 0.317614526f},
-std::array<float,2>{0.496089965f, 0.905905604f},
-std::array<float,2>{0.800533652f, 0.786259174f},
-std::array<float,2>{0.187540606f, 0.495848477f},
-std::array<float,2>{0.598673165f, 0.0153665962f},
-std::array<float,2>{0.414602578f, 0.574713051f},
-std::array<float,2>{0.692585289f, 0.684619606f},
-std::array<float,2>{0.254696339f, 0.179438412f},
-std::array<float,2>{0.926717937f, 0.275944561f},
-std::array<float,2>{0.0555120446f, 0.965606332f},
-std::array<float,2>{0.506112397f, 0.918720186f},
-std::array<float,2>{0.452405095f, 0.367920309f},
-std::array<float,2>{0.854893446f, 0.219120741f},
-std::array<float,2>{0.142187759f, 0.73963958f},
-std::array<float,2>{0.952716053f, 0.52385819f},
-std::array<float,2>{0.0774472281f, 0.0762970075f},
-std::array<float,2>{0.664722979f, 0.389492363f},
-std::array<float,2>{0.319556981f, 0.865037918f},
-std::array<float,2>{0.985138416f, 0.848897099f},
-std::array<float,2>{0.0994325504f, 0.402141839f},
-std::array<float,2>{0.629355013f, 0.0925225616f},
-std::array<float,2>{0.348381758f, 0.511437893f},
-std::array<float,2>{0.55977118f, 0.7270841f},
-std::array<float,2>{0.478429914f, 0.249769241f},
-std::array<float,2>{0.819506347f, 0.358987451f},
-std::array<float,2>{0.171490029f, 0.933208406f},
-std::array<float,2>{0.723421335f, 0.94887954f},
-std::array<float,2>{0.301605463f, 0.253614724f},
-std::array<float,2>{0.892297566f, 0.163107947f},
-std::array<float,2>{0.0233201701f, 0.659686625f},
-std::array<float,2>{0.759595335f, 0.588880479f},
-std::array<float,2>{0.238891289f, 0.0173836518f},
-std::array<float,2>{0.589660227f, 0.471846104f},
-std::array<float,2>{0.394838125f, 0.809109032f},
-std::array<float,2>{0.8624174f, 0.884824455f},
-std::array<float,2>{0.134274557f, 0.329640269f},
-std::array<float,2>{0.517765105f, 0.199565113f},
-std::array<float,2>{0.466940999f, 0.691142201f},
-std::array<float,2>{0.686782777f, 0.548690736f},
-std::array<float,2>{0.3299748f, 0.104113437f},
-std::array<float,2>{0.967862904f, 0.411277741f},
-std::array<float,2>{0.0878669396f, 0.834339201f},
-std::array<float,2>{0.610628128f, 0.770167112f},
-std::array<float,2>{0.430453092f, 0.444997668f},
-std::array<float,2>{0.79146409f, 0.0389368162f},
-std::array<float,2>{0.204312861f, 0.615724862f},
-std::array<float,2>{0.90781641f, 0.652741432f},
-std::array<float,2>{0.0467736125f, 0.144298375f},
-std::array<float,2>{0.717029274f, 0.296366751f},
-std::array<float,2>{0.269077867f, 0.992662013f},
-std::array<float,2>{0.958249092f, 0.921875f},
-std::array<float,2>{0.0799034759f, 0.346573621f},
-std::array<float,2>{0.679462612f, 0.239777863f},
-std::array<float,2>{0.338318944f, 0.719183862f},
-std::array<float,2>{0.52426976f, 0.505071104f},
-std::array<float,2>{0.454073995f, 0.0830683932f},
-std::array<float,2>{0.874164999f, 0.395821571f},
-std::array<float,2>{0.12926209f, 0.859354258f},
-std::array<float,2>{0.710914314f, 0.798356533f},
-std::array<float,2>{0.274256647f, 0.477378815f},
-std::array<float,2>{0.917900562f, 0.0238248501f},
-std::array<float,2>{0.0323148407f, 0.578285217f},
-std::array<float,2>{0.784027636f, 0.67101723f},
-std::array<float,2>{0.218239233f, 0.164874107f},
-std::array<float,2>{0.61943692f, 0.265193254f},
-std::array<float,2>{0.425386786f, 0.941723406f},
-std::array<float,2>{0.822885156f, 0.83963716f},
-std::array<float,2>{0.156384751f, 0.420362651f},
-std::array<float,2>{0.551423967f, 0.095107697f},
-std::array<float,2>{0.47340706f, 0.559258461f},
-std::array<float,2>{0.634639978f, 0.699782133f},
-std::array<float,2>{0.356123984f, 0.191466883f},
-std::array<float,2>{0.99519819f, 0.336815476f},
-std::array<float,2>{0.102598816f, 0.879826486f},
-std::array<float,2>{0.581154525f, 0.984868884f},
-std::array<float,2>{0.401946723f, 0.287953228f},
-std::array<float,2>{0.755525172f, 0.155371562f},
-std::array<float,2>{0.249118075f, 0.644191563f},
-std::array<float,2>{0.899041831f, 0.624469936f},
-std::array<float,2>{0.0306378938f, 0.0464203618f},
-std::array<float,2>{0.731849015f, 0.452200204f},
-std::array<float,2>{0.312101841f, 0.780299604f},
-std::array<float,2>{0.930182397f, 0.75062871f},
-std::array<float,2>{0.0538051538f, 0.460954368f},
-std::array<float,2>{0.696115851f, 0.0549111068f},
-std::array<float,2>{0.2583673f, 0.603560328f},
-std::array<float,2>{0.605670035f, 0.635250866f},
-std::array<float,2>{0.41194123f, 0.128875539f},
-std::array<float,2>{0.809772789f, 0.312325269f},
-std::array<float,2>{0.196269959f, 0.979074597f},
-std::array<float,2>{0.658148587f, 0.893595457f},
-std::array<float,2>{0.324078113f, 0.327759594f},
-std::array<float,2>{0.93804872f, 0.211487949f},
-std::array<float,2>{0.0656367242f, 0.706293106f},
-std::array<float,2>{0.84603399f, 0.544824362f},
-std::array<float,2>{0.153099731f, 0.110037901f},
-std::array<float,2>{0.511634231f, 0.427941412f},
-std::array<float,2>{0.444673568f, 0.827282727f},
-std::array<float,2>{0.76823926f, 0.953214407f},
-std::array<float,2>{0.229621038f, 0.271003157f},
-std::array<float,2>{0.568849146f, 0.180156022f},
-std::array<float,2>{0.384446114f, 0.674162328f},
-std::array<float,2>{0.749246299f, 0.568290651f},
-std::array<float,2>{0.287709802f, 0.00178033765f},
-std::array<float,2>{0.890279353f, 0.485310853f},
-std::array<float,2>{0.00932764169f, 0.792150795f},
-std::array<float,2>{0.545612454f, 0.867295325f},
-std::array<float,2>{0.490983725f, 0.380312413f},
-std::array<float,2>{0.832742155f, 0.0671900138f},
-std::array<float,2>{0.182256773f, 0.521107018f},
-std::array<float,2>{0.979339838f, 0.744577348f},
-std::array<float,2>{0.122233108f, 0.229890704f},
-std::array<float,2>{0.646009445f, 0.36655122f},
-std::array<float,2>{0.366866618f, 0.908860564f},
-std::array<float,2>{0.920500159f, 0.898855329f},
-std::array<float,2>{0.0356117412f, 0.314202458f},
-std::array<float,2>{0.70691365f, 0.210225821f},
-std::array<float,2>{0.280427724f, 0.716074646f},
-std::array<float,2>{0.624102056f, 0.535740376f},
-std::array<float,2>{0.428398579f, 0.117915697f},
-std::array<float,2>{0.787215233f, 0.43185252f},
-std::array<float,2>{0.213631272f, 0.819051862f},
-std::array<float,2>{0.674255431f, 0.764657378f},
-std::array<float,2>{0.343731135f, 0.458873481f},
-std::array<float,2>{0.95480293f, 0.0522895344f},
-std::array<float,2>{0.085462369f, 0.599355698f},
-std::array<float,2>{0.868506968f, 0.629990757f},
-std::array<float,2>{0.126592383f, 0.13658075f},
-std::array<float,2>{0.530785799f, 0.302328974f},
-std::array<float,2>{0.460125089f, 0.975830734f},
-std::array<float,2>{0.753500283f, 0.860630393f},
-std::array<float,2>{0.244656384f, 0.384472668f},
-std::array<float,2>{0.585096598f, 0.0704446658f},
-std::array<float,2>{0.405101359f, 0.528448045f},
-std::array<float,2>{0.729065835f, 0.73525995f},
-std::array<float,2>{0.306632936f, 0.224369764f},
-std::array<float,2>{0.903591335f, 0.374532014f},
-std::array<float,2>{0.0247114263f, 0.915358901f},
-std::array<float,2>{0.550370991f, 0.962392509f},
-std::array<float,2>{0.472338855f, 0.278756917f},
-std::array<float,2>{0.824831963f, 0.175649345f},
-std::array<float,2>{0.16254361f, 0.681963861f},
-std::array<float,2>{0.996241331f, 0.570321381f},
-std::array<float,2>{0.108032018f, 0.0100473752f},
-std::array<float,2>{0.636940777f, 0.498063564f},
-std::array<float,2>{0.354563326f, 0.782861233f},
-std::array<float,2>{0.94491148f, 0.805530429f},
-std::array<float,2>{0.0668781623f, 0.473510891f},
-std::array<float,2>{0.661467493f, 0.0231231973f},
-std::array<float,2>{0.327296823f, 0.590102613f},
-std::array<float,2>{0.514532208f, 0.663746774f},
-std::array<float,2>{0.440068454f, 0.159447104f},
-std::array<float,2>{0.850178659f, 0.254490614f},
-std::array<float,2>{0.149203405f, 0.950138748f},
-std::array<float,2>{0.70044297f, 0.935684919f},
-std::array<float,2>{0.263871968f, 0.352338582f},
-std::array<float,2>{0.935965836f, 0.24297452f},
-std::array<float,2>{0.0472500846f, 0.733790874f},
-std::array<float,2>{0.808142483f, 0.515454531f},
-std::array<float,2>{0.200339615f, 0.0866346881f},
-std::array<float,2>{0.604224503f, 0.402375638f},
-std::array<float,2>{0.409116447f, 0.84745723f},
-std::array<float,2>{0.830044627f, 0.998113394f},
-std::array<float,2>{0.184118062f, 0.290693194f},
-std::array<float,2>{0.540398538f, 0.147306249f},
-std::array<float,2>{0.48472774f, 0.651109576f},
-std::array<float,2>{0.644112289f, 0.611988425f},
-std::array<float,2>{0.363178432f, 0.0344098546f},
-std::array<float,2>{0.982957363f, 0.440315634f},
-std::array<float,2>{0.118910313f, 0.768459439f},
-std::array<float,2>{0.563204885f, 0.830483198f},
-std::array<float,2>{0.389956534f, 0.408210754f},
-std::array<float,2>{0.770965338f, 0.106883258f},
-std::array<float,2>{0.233565763f, 0.554625332f},
-std::array<float,2>{0.882966459f, 0.695039153f},
-std::array<float,2>{0.0118496316f, 0.199197754f},
-std::array<float,2>{0.745318234f, 0.333832353f},
-std::array<float,2>{0.282174259f, 0.890077293f},
-std::array<float,2>{0.975537002f, 0.940344751f},
-std::array<float,2>{0.112221621f, 0.259400785f},
-std::array<float,2>{0.652737021f, 0.170964509f},
-std::array<float,2>{0.374930501f, 0.665627897f},
-std::array<float,2>{0.536029994f, 0.584958732f},
-std::array<float,2>{0.49951148f, 0.0306473449f},
-std::array<float,2>{0.842156291f, 0.482247978f},
-std::array<float,2>{0.176675931f, 0.801908195f},
-std::array<float,2>{0.736367404f, 0.854900062f},
-std::array<float,2>{0.292969823f, 0.391978651f},
-std::array<float,2>{0.877202928f, 0.0810284838f},
-std::array<float,2>{0.000219245907f, 0.502999544f},
-std::array<float,2>{0.773822367f, 0.724160373f},
-std::array<float,2>{0.221649021f, 0.23490265f},
-std::array<float,2>{0.577474713f, 0.351064384f},
-std::array<float,2>{0.379381716f, 0.925967634f},
-std::array<float,2>{0.856454432f, 0.775320709f},
-std::array<float,2>{0.14457643f, 0.447342008f},
-std::array<float,2>{0.502256513f, 0.0400912538f},
-std::array<float,2>{0.448332638f, 0.618916154f},
-std::array<float,2>{0.671431303f, 0.646683514f},
-std::array<float,2>{0.315896183f, 0.151888952f},
-std::array<float,2>{0.946340859f, 0.283516765f},
-std::array<float,2>{0.07108704f, 0.991743505f},
-std::array<float,2>{0.59446156f, 0.877469838f},
-std::array<float,2>{0.418536425f, 0.341657937f},
-std::array<float,2>{0.802655518f, 0.189567178f},
-std::array<float,2>{0.19450666f, 0.695794344f},
-std::array<float,2>{0.923742473f, 0.558281243f},
-std::array<float,2>{0.0617775247f, 0.100165069f},
-std::array<float,2>{0.691297293f, 0.416371018f},
-std::array<float,2>{0.250029922f, 0.839908779f},
-std::array<float,2>{0.895908475f, 0.823123038f},
-std::array<float,2>{0.0171613842f, 0.425138772f},
-std::array<float,2>{0.721836627f, 0.114571683f},
-std::array<float,2>{0.299553186f, 0.542585254f},
-std::array<float,2>{0.593748331f, 0.707945049f},
-std::array<float,2>{0.393839538f, 0.215570301f},
-std::array<float,2>{0.764407039f, 0.323344231f},
-std::array<float,2>{0.236626178f, 0.897785664f},
-std::array<float,2>{0.628009677f, 0.983156264f},
-std::array<float,2>{0.346966028f, 0.308544517f},
-std::array<float,2>{0.990230739f, 0.129309714f},
-std::array<float,2>{0.0970491543f, 0.639544487f},
-std::array<float,2>{0.814859152f, 0.6072644f},
-std::array<float,2>{0.164300814f, 0.058955688f},
-std::array<float,2>{0.555830419f, 0.466165841f},
-std::array<float,2>{0.482097566f, 0.754515707f},
-std::array<float,2>{0.794699848f, 0.911033988f},
-std::array<float,2>{0.208664253f, 0.359580785f},
-std::array<float,2>{0.613344789f, 0.23279728f},
-std::array<float,2>{0.434078872f, 0.747199059f},
-std::array<float,2>{0.713070214f, 0.518984914f},
-std::array<float,2>{0.271953523f, 0.0645260811f},
-std::array<float,2>{0.910662532f, 0.376521707f},
-std::array<float,2>{0.0397427082f, 0.87169981f},
-std::array<float,2>{0.523397088f, 0.793877304f},
-std::array<float,2>{0.461243153f, 0.490829051f},
-std::array<float,2>{0.866091251f, 0.00500576571f},
-std::array<float,2>{0.139739737f, 0.562923431f},
-std::array<float,2>{0.96451062f, 0.676241338f},
-std::array<float,2>{0.091112867f, 0.185975358f},
-std::array<float,2>{0.681008518f, 0.266108543f},
-std::array<float,2>{0.334301531f, 0.957146585f},
-std::array<float,2>{0.929393172f, 0.967982233f},
-std::array<float,2>{0.0568390228f, 0.2753672f},
-std::array<float,2>{0.693626583f, 0.17753154f},
-std::array<float,2>{0.257676095f, 0.687262654f},
-std::array<float,2>{0.600312948f, 0.578068435f},
-std::array<float,2>{0.417566121f, 0.0123204328f},
-std::array<float,2>{0.797414005f, 0.49381116f},
-std::array<float,2>{0.190624461f, 0.788345516f},
-std::array<float,2>{0.666108787f, 0.867139578f},
-std::array<float,2>{0.317403018f, 0.38841936f},
-std::array<float,2>{0.950652719f, 0.0748440474f},
-std::array<float,2>{0.0758469626f, 0.526844978f},
-std::array<float,2>{0.853180349f, 0.740975857f},
-std::array<float,2>{0.144160673f, 0.221337691f},
-std::array<float,2>{0.503911257f, 0.369675905f},
-std::array<float,2>{0.449527353f, 0.920039356f},
-std::array<float,2>{0.781218529f, 0.761171579f},
-std::array<float,2>{0.225140929f, 0.456794202f},
-std::array<float,2>{0.574130595f, 0.0496348143f},
-std::array<float,2>{0.375348598f, 0.593855798f},
-std::array<float,2>{0.739058673f, 0.627778232f},
-std::array<float,2>{0.291199237f, 0.139023304f},
-std::array<float,2>{0.882413328f, 0.297253907f},
-std::array<float,2>{0.00754611846f, 0.971212864f},
-std::array<float,2>{0.532157779f, 0.903190315f},
-std::array<float,2>{0.493322372f, 0.320034474f},
-std::array<float,2>{0.838948071f, 0.204565778f},
-std::array<float,2>{0.173198491f, 0.714724123f},
-std::array<float,2>{0.972310722f, 0.532680213f},
-std::array<float,2>{0.113679372f, 0.12228746f},
-std::array<float,2>{0.650222003f, 0.435162276f},
-std::array<float,2>{0.370775461f, 0.815783024f},
-std::array<float,2>{0.966518164f, 0.833561242f},
-std::array<float,2>{0.0898418278f, 0.413069338f},
-std::array<float,2>{0.683674932f, 0.101810284f},
-std::array<float,2>{0.330471843f, 0.549896955f},
-std::array<float,2>{0.516589761f, 0.688466668f},
-std::array<float,2>{0.464935243f, 0.201528445f},
-std::array<float,2>{0.859821856f, 0.331874877f},
-std::array<float,2>{0.135858595f, 0.883736193f},
-std::array<float,2>{0.716299117f, 0.995615423f},
-std::array<float,2>{0.266832411f, 0.294771641f},
-std::array<float,2>{0.90955925f, 0.140884236f},
-std::array<float,2>{0.0436661541f, 0.655056953f},
-std::array<float,2>{0.790491641f, 0.614995837f},
-std::array<float,2>{0.205531269f, 0.036095079f},
-std::array<float,2>{0.611652255f, 0.442474097f},
-std::array<float,2>{0.433549166f, 0.772502005f},
-std::array<float,2>{0.816987634f, 0.931318045f},
-std::array<float,2>{0.169581056f, 0.355769753f},
-std::array<float,2>{0.562136889f, 0.247263327f},
-std::array<float,2>{0.478703707f, 0.729049802f},
-std::array<float,2>{0.632332087f, 0.509147882f},
-std::array<float,2>{0.350578398f, 0.0912969187f},
-std::array<float,2>{0.986574829f, 0.39961347f},
-std::array<float,2>{0.101078987f, 0.850327492f},
-std::array<float,2>{0.586442888f, 0.811846137f},
-std::array<float,2>{0.39667064f, 0.469130248f},
-std::array<float,2>{0.760767221f, 0.0177644212f},
-std::array<float,2>{0.241922498f, 0.586292982f},
-std::array<float,2>{0.893993318f, 0.657400966f},
-std::array<float,2>{0.0203610063f, 0.161309347f},
-std::array<float,2>{0.724973738f, 0.251147151f},
-std::array<float,2>{0.303298712f, 0.946872413f},
-std::array<float,2>{0.992640674f, 0.880894423f},
-std::array<float,2>{0.104746707f, 0.33930999f},
-std::array<float,2>{0.636675f, 0.193366349f},
-std::array<float,2>{0.359116286f, 0.701888323f},
-std::array<float,2>{0.552883625f, 0.561306059f},
-std::array<float,2>{0.476391584f, 0.0969791263f},
-std::array<float,2>{0.820829034f, 0.419124871f},
-std::array<float,2>{0.158865824f, 0.835993648f},
-std::array<float,2>{0.734148979f, 0.779083192f},
-std::array<float,2>{0.309684217f, 0.450439841f},
-std::array<float,2>{0.901478648f, 0.0443020277f},
-std::array<float,2>{0.0292355437f, 0.621793866f},
-std::array<float,2>{0.757066905f, 0.642047048f},
-std::array<float,2>{0.247169077f, 0.15268743f},
-std::array<float,2>{0.579039097f, 0.28605321f},
-std::array<float,2>{0.39884761f, 0.987013638f},
-std::array<float,2>{0.871996582f, 0.856444776f},
-std::array<float,2>{0.130963311f, 0.397633582f},
-std::array<float,2>{0.526524067f, 0.0842988491f},
-std::array<float,2>{0.455547512f, 0.507527888f},
-std::array<float,2>{0.677193999f, 0.721857786f},
-std::array<float,2>{0.336257547f, 0.240872011f},
-std::array<float,2>{0.959849894f, 0.345013201f},
-std::array<float,2>{0.0817018673f, 0.924110651f},
-std::array<float,2>{0.618251562f, 0.945307195f},
-std::array<float,2>{0.423088163f, 0.263105094f},
-std::array<float,2>{0.781264126f, 0.166236177f},
-std::array<float,2>{0.215512171f, 0.669558644f},
-std::array<float,2>{0.914547741f, 0.581977546f},
-std::array<float,2>{0.033809714f, 0.0260423496f},
-std::array<float,2>{0.707199693f, 0.479944348f},
-std::array<float,2>{0.275818855f, 0.799997091f},
-std::array<float,2>{0.887556016f, 0.789416432f},
-std::array<float,2>{0.0103758872f, 0.486905485f},
-std::array<float,2>{0.746311545f, 0.00223596278f},
-std::array<float,2>{0.286163539f, 0.570139825f},
-std::array<float,2>{0.567627668f, 0.673178077f},
-std::array<float,2>{0.386064053f, 0.182922125f},
-std::array<float,2>{0.767533958f, 0.2725932f},
-std::array<float,2>{0.226873547f, 0.955724061f},
-std::array<float,2>{0.646732152f, 0.907693207f},
-std::array<float,2>{0.36510253f, 0.363671869f},
-std::array<float,2>{0.978115261f, 0.2271979f},
-std::array<float,2>{0.123397514f, 0.743098021f},
-std::array<float,2>{0.835307479f, 0.523084939f},
-std::array<float,2>{0.180444121f, 0.0691567138f},
-std::array<float,2>{0.543248057f, 0.381155849f},
-std::array<float,2>{0.489906996f, 0.870018303f},
-std::array<float,2>{0.811667562f, 0.977487326f},
-std::array<float,2>{0.1976621f, 0.308746576f},
-std::array<float,2>{0.609309494f, 0.126641914f},
-std::array<float,2>{0.41286546f, 0.632997453f},
-std::array<float,2>{0.698788166f, 0.601966381f},
-std::array<float,2>{0.260816664f, 0.0579531305f},
-std::array<float,2>{0.932181239f, 0.464021951f},
-std::array<float,2>{0.0508511625f, 0.753840983f},
-std::array<float,2>{0.507875264f, 0.826041341f},
-std::array<float,2>{0.441792816f, 0.426177889f},
-std::array<float,2>{0.845629811f, 0.111978106f},
-std::array<float,2>{0.155772746f, 0.546400845f},
-std::array<float,2>{0.94056201f, 0.704711556f},
-std::array<float,2>{0.0640547425f, 0.21441254f},
-std::array<float,2>{0.659921229f, 0.325009048f},
-std::array<float,2>{0.32171762f, 0.892091036f},
-std::array<float,2>{0.904540956f, 0.917699099f},
-std::array<float,2>{0.0268078204f, 0.37221086f},
-std::array<float,2>{0.72798866f, 0.225180238f},
-std::array<float,2>{0.308540761f, 0.736773789f},
-std::array<float,2>{0.582387626f, 0.530213416f},
-std::array<float,2>{0.404135615f, 0.0728951544f},
-std::array<float,2>{0.751929283f, 0.386534601f},
-std::array<float,2>{0.242795691f, 0.861447334f},
-std::array<float,2>{0.639332533f, 0.784237683f},
-std::array<float,2>{0.352133185f, 0.496833265f},
-std::array<float,2>{0.999708593f, 0.00795367826f},
-std::array<float,2>{0.106514439f, 0.573818743f},
-std::array<float,2>{0.826942384f, 0.680374026f},
-std::array<float,2>{0.161557257f, 0.173136413f},
-std::array<float,2>{0.548029602f, 0.280527443f},
-std::array<float,2>{0.468941033f, 0.96473819f},
-std::array<float,2>{0.786402285f, 0.816528618f},
-std::array<float,2>{0.211650535f, 0.431513429f},
-std::array<float,2>{0.622079909f, 0.119656377f},
-std::array<float,2>{0.425909162f, 0.538517416f},
-std::array<float,2>{0.70423609f, 0.718098342f},
-std::array<float,2>{0.278554589f, 0.208590746f},
-std::array<float,2>{0.918628097f, 0.315182716f},
-std::array<float,2>{0.0390318967f, 0.901032388f},
-std::array<float,2>{0.529044867f, 0.972818732f},
-std::array<float,2>{0.457798362f, 0.303900391f},
-std::array<float,2>{0.869884014f, 0.134253025f},
-std::array<float,2>{0.127552181f, 0.631239176f},
-std::array<float,2>{0.955610573f, 0.599710226f},
-std::array<float,2>{0.0821875781f, 0.0546482354f},
-std::array<float,2>{0.673223853f, 0.460434735f},
-std::array<float,2>{0.340600103f, 0.762643993f},
-std::array<float,2>{0.982400954f, 0.766784668f},
-std::array<float,2>{0.120813258f, 0.437806338f},
-std::array<float,2>{0.641679168f, 0.0317945033f},
-std::array<float,2>{0.361295491f, 0.610478222f},
-std::array<float,2>{0.542186916f, 0.648710907f},
-std::array<float,2>{0.487206638f, 0.146388397f},
-std::array<float,2>{0.830645025f, 0.291465491f},
-std::array<float,2>{0.18597047f, 0.997152805f},
-std::array<float,2>{0.742287397f, 0.888176739f},
-std::array<float,2>{0.284769714f, 0.335594743f},
-std::array<float,2>{0.885209382f, 0.197203368f},
-std::array<float,2>{0.0143063441f, 0.692663789f},
-std::array<float,2>{0.773334324f, 0.552581131f},
-std::array<float,2>{0.231212914f, 0.108647674f},
-std::array<float,2>{0.565248489f, 0.407247245f},
-std::array<float,2>{0.387822241f, 0.828983963f},
-std::array<float,2>{0.848655164f, 0.95190829f},
-std::array<float,2>{0.152262509f, 0.256831795f},
-std::array<float,2>{0.512859344f, 0.156636357f},
-std::array<float,2>{0.437502086f, 0.660773218f},
-std::array<float,2>{0.662867188f, 0.592962801f},
-std::array<float,2>{0.32458058f, 0.0201611593f},
-std::array<float,2>{0.942409158f, 0.476260692f},
-std::array<float,2>{0.0687203482f, 0.808130741f},
-std::array<float,2>{0.603448868f, 0.845479012f},
-std::array<float,2>{0.407870859f, 0.405309588f},
-std::array<float,2>{0.806373298f, 0.0888980031f},
-std::array<float,2>{0.202155128f, 0.512674809f},
-std::array<float,2>{0.93499732f, 0.730922401f},
-std::array<float,2>{0.0501255579f, 0.24501282f},
-std::array<float,2>{0.70279175f, 0.3552517f},
-std::array<float,2>{0.263177216f, 0.934219301f},
-std::array<float,2>{0.948414922f, 0.98880744f},
-std::array<float,2>{0.0728601143f, 0.281267673f},
-std::array<float,2>{0.669660687f, 0.148990095f},
-std::array<float,2>{0.31390202f, 0.646437287f},
-std::array<float,2>{0.500211298f, 0.619505644f},
-std::array<float,2>{0.446205854f, 0.0415071659f},
-std::array<float,2>{0.859113753f, 0.447047234f},
-std::array<float,2>{0.147006422f, 0.777315021f},
-std::array<float,2>{0.688574076f, 0.841891944f},
-std::array<float,2>{0.253406286f, 0.415600985f},
-std::array<float,2>{0.92408818f, 0.0988085866f},
-std::array<float,2>{0.0589069203f, 0.554759741f},
-std::array<float,2>{0.803310156f, 0.699141264f},
-std::array<float,2>{0.193116575f, 0.188992769f},
-std::array<float,2>{0.595915914f, 0.343355447f},
-std::array<float,2>{0.421756327f, 0.876543999f},
-std::array<float,2>{0.840017498f, 0.802745938f},
-std::array<float,2>{0.179241478f, 0.484155923f},
-std::array<float,2>{0.53880322f, 0.0275290925f},
-std::array<float,2>{0.496597767f, 0.582939982f},
-std::array<float,2>{0.654920816f, 0.667588115f},
-std::array<float,2>{0.372794628f, 0.168708146f},
-std::array<float,2>{0.97314316f, 0.261458188f},
-std::array<float,2>{0.110841803f, 0.937936425f},
-std::array<float,2>{0.575472057f, 0.929663718f},
-std::array<float,2>{0.381595463f, 0.348221123f},
-std::array<float,2>{0.776474655f, 0.237247244f},
-std::array<float,2>{0.219612762f, 0.725687504f},
-std::array<float,2>{0.876700997f, 0.500949264f},
-std::array<float,2>{0.00290681748f, 0.0794593245f},
-std::array<float,2>{0.736263514f, 0.392600685f},
-std::array<float,2>{0.295788258f, 0.852329612f},
-std::array<float,2>{0.913157344f, 0.874368668f},
-std::array<float,2>{0.0419148467f, 0.378834367f},
-std::array<float,2>{0.711645603f, 0.0643207878f},
-std::array<float,2>{0.270483643f, 0.517525792f},
-std::array<float,2>{0.615735412f, 0.748398483f},
-std::array<float,2>{0.43612662f, 0.231409356f},
-std::array<float,2>{0.79666543f, 0.361762345f},
-std::array<float,2>{0.209234238f, 0.912422478f},
-std::array<float,2>{0.682157218f, 0.960898817f},
-std::array<float,2>{0.333025932f, 0.269166052f},
-std::array<float,2>{0.961385429f, 0.185278624f},
-std::array<float,2>{0.0918333456f, 0.678121626f},
-std::array<float,2>{0.864372671f, 0.565241337f},
-std::array<float,2>{0.137235194f, 0.0075401403f},
-std::array<float,2>{0.519629717f, 0.489170521f},
-std::array<float,2>{0.46304664f, 0.795590162f},
-std::array<float,2>{0.762205601f, 0.896286249f},
-std::array<float,2>{0.235162228f, 0.320904464f},
-std::array<float,2>{0.590062022f, 0.217660338f},
-std::array<float,2>{0.391444623f, 0.710418999f},
-std::array<float,2>{0.719704568f, 0.539979398f},
-std::array<float,2>{0.298474073f, 0.11687544f},
-std::array<float,2>{0.897266924f, 0.423596203f},
-std::array<float,2>{0.0177790467f, 0.820377529f},
-std::array<float,2>{0.55830425f, 0.757207453f},
-std::array<float,2>{0.483457834f, 0.467388153f},
-std::array<float,2>{0.813670933f, 0.0610475242f},
-std::array<float,2>{0.167923242f, 0.609080553f},
-std::array<float,2>{0.99098587f, 0.638635933f},
-std::array<float,2>{0.0938792899f, 0.131966129f},
-std::array<float,2>{0.625648022f, 0.305474281f},
-std::array<float,2>{0.343901724f, 0.982193232f},
-std::array<float,2>{0.90907532f, 0.993850708f},
-std::array<float,2>{0.0446496569f, 0.295108944f},
-std::array<float,2>{0.715059876f, 0.142642334f},
-std::array<float,2>{0.266040295f, 0.653613567f},
-std::array<float,2>{0.612704635f, 0.61680758f},
-std::array<float,2>{0.432301849f, 0.037660215f},
-std::array<float,2>{0.789810956f, 0.444301814f},
-std::array<float,2>{0.206933007f, 0.771127999f},
-std::array<float,2>{0.684747398f, 0.835333884f},
-std::array<float,2>{0.331424534f, 0.411073893f},
-std::array<float,2>{0.965400577f, 0.105211385f},
-std::array<float,2>{0.0879256204f, 0.547274888f},
-std::array<float,2>{0.860468864f, 0.689704895f},
-std::array<float,2>{0.135685235f, 0.200471044f},
-std::array<float,2>{0.516807735f, 0.328467369f},
-std::array<float,2>{0.466705382f, 0.886343539f},
-std::array<float,2>{0.760678649f, 0.809703171f},
-std::array<float,2>{0.240614504f, 0.47087273f},
-std::array<float,2>{0.587483108f, 0.015686851f},
-std::array<float,2>{0.397950768f, 0.588474691f},
-std::array<float,2>{0.725803435f, 0.659018755f},
-std::array<float,2>{0.304047555f, 0.162818864f},
-std::array<float,2>{0.892995596f, 0.252280354f},
-std::array<float,2>{0.0209527183f, 0.947307289f},
-std::array<float,2>{0.56072402f, 0.932197213f},
-std::array<float,2>{0.479749382f, 0.357756585f},
-std::array<float,2>{0.817749798f, 0.248808637f},
-std::array<float,2>{0.168893784f, 0.728223681f},
-std::array<float,2>{0.987845719f, 0.510426939f},
-std::array<float,2>{0.0998065397f, 0.0937057957f},
-std::array<float,2>{0.631135404f, 0.401081473f},
-std::array<float,2>{0.350979388f, 0.84825176f},
-std::array<float,2>{0.949674249f, 0.863560081f},
-std::array<float,2>{0.0750442892f, 0.390101016f},
-std::array<float,2>{0.667312622f, 0.0779642314f},
-std::array<float,2>{0.31645906f, 0.52485913f},
-std::array<float,2>{0.505502522f, 0.738850534f},
-std::array<float,2>{0.450802028f, 0.220491692f},
-std::array<float,2>{0.852497697f, 0.368626654f},
-std::array<float,2>{0.14355424f, 0.919090986f},
-std::array<float,2>{0.694639683f, 0.966112792f},
-std::array<float,2>{0.256528646f, 0.276523739f},
-std::array<float,2>{0.928375721f, 0.178146943f},
-std::array<float,2>{0.0584144928f, 0.684307992f},
-std::array<float,2>{0.797906458f, 0.575843751f},
-std::array<float,2>{0.189586803f, 0.0146180922f},
-std::array<float,2>{0.601412773f, 0.494677395f},
-std::array<float,2>{0.4167898f, 0.785831094f},
-std::array<float,2>{0.838212192f, 0.904415905f},
-std::array<float,2>{0.172384396f, 0.316845775f},
-std::array<float,2>{0.532867551f, 0.206095338f},
-std::array<float,2>{0.492310286f, 0.711859941f},
-std::array<float,2>{0.648642421f, 0.533660889f},
-std::array<float,2>{0.36930427f, 0.124728873f},
-std::array<float,2>{0.971640646f, 0.436738372f},
-std::array<float,2>{0.115113311f, 0.81371665f},
-std::array<float,2>{0.573028147f, 0.759545743f},
-std::array<float,2>{0.376925588f, 0.453556329f},
-std::array<float,2>{0.779359579f, 0.0469549671f},
-std::array<float,2>{0.226201609f, 0.596601069f},
-std::array<float,2>{0.881232798f, 0.626598716f},
-std::array<float,2>{0.00637348881f, 0.138178751f},
-std::array<float,2>{0.740066767f, 0.300343573f},
-std::array<float,2>{0.292218536f, 0.969778776f},
-std::array<float,2>{0.977277398f, 0.90948844f},
-std::array<float,2>{0.124466278f, 0.366073668f},
-std::array<float,2>{0.647896707f, 0.229447678f},
-std::array<float,2>{0.363377064f, 0.745963275f},
-std::array<float,2>{0.544734657f, 0.519977033f},
-std::array<float,2>{0.488569409f, 0.0680679753f},
-std::array<float,2>{0.834078968f, 0.379379362f},
-std::array<float,2>{0.181313828f, 0.868528187f},
-std::array<float,2>{0.747871816f, 0.791087985f},
-std::array<float,2>{0.285707563f, 0.486276746f},
-std::array<float,2>{0.888666987f, 0.000638779369f},
-std::array<float,2>{0.0108323069f, 0.56662792f},
-std::array<float,2>{0.766468465f, 0.675604403f},
-std::array<float,2>{0.227672935f, 0.181391701f},
-std::array<float,2>{0.566410005f, 0.270089626f},
-std::array<float,2>{0.384880453f, 0.954291701f},
-std::array<float,2>{0.843767107f, 0.826665699f},
-std::array<float,2>{0.154360116f, 0.428904086f},
-std::array<float,2>{0.509648621f, 0.11081636f},
-std::array<float,2>{0.442663401f, 0.543866992f},
-std::array<float,2>{0.658732414f, 0.705786228f},
-std::array<float,2>{0.320442438f, 0.212066665f},
-std::array<float,2>{0.940369606f, 0.327059716f},
-std::array<float,2>{0.0632953048f, 0.893046618f},
-std::array<float,2>{0.607600927f, 0.979661942f},
-std::array<float,2>{0.413733363f, 0.310912371f},
-std::array<float,2>{0.811286807f, 0.127693608f},
-std::array<float,2>{0.198841467f, 0.635817349f},
-std::array<float,2>{0.933179319f, 0.604828715f},
-std::array<float,2>{0.0523801893f, 0.0559936762f},
-std::array<float,2>{0.697449565f, 0.46227476f},
-std::array<float,2>{0.260538757f, 0.751675069f},
-std::array<float,2>{0.900897861f, 0.77950716f},
-std::array<float,2>{0.0277290903f, 0.45205155f},
-std::array<float,2>{0.732658029f, 0.0449398309f},
-std::array<float,2>{0.309080273f, 0.623660803f},
-std::array<float,2>{0.579146802f, 0.643089831f},
-std::array<float,2>{0.400098503f, 0.154850319f},
-std::array<float,2>{0.756659925f, 0.288923085f},
-std::array<float,2>{0.246741533f, 0.985677838f},
-std::array<float,2>{0.634848714f, 0.879925311f},
-std::array<float,2>{0.35796994f, 0.337239951f},
-std::array<float,2>{0.99340409f, 0.192818195f},
-std::array<float,2>{0.10388469f, 0.701058328f},
-std::array<float,2>{0.821530104f, 0.560079813f},
-std::array<float,2>{0.159407094f, 0.0938469395f},
-std::array<float,2>{0.554506063f, 0.421367377f},
-std::array<float,2>{0.474620521f, 0.838052452f},
-std::array<float,2>{0.782364428f, 0.942593873f},
-std::array<float,2>{0.216494977f, 0.263716847f},
-std::array<float,2>{0.61734122f, 0.165499315f},
-std::array<float,2>{0.4224751f, 0.670559824f},
-std::array<float,2>{0.708925068f, 0.579894722f},
-std::array<float,2>{0.277169615f, 0.0253735036f},
-std::array<float,2>{0.915699542f, 0.477635473f},
-std::array<float,2>{0.0342293605f, 0.797561109f},
-std::array<float,2>{0.526134014f, 0.857460082f},
-std::array<float,2>{0.456971198f, 0.394816399f},
-std::array<float,2>{0.872353315f, 0.0823168457f},
-std::array<float,2>{0.132702261f, 0.50446713f},
-std::array<float,2>{0.96053189f, 0.720351994f},
-std::array<float,2>{0.0805336535f, 0.238746494f},
-std::array<float,2>{0.676596045f, 0.347182184f},
-std::array<float,2>{0.337000996f, 0.923490584f},
-std::array<float,2>{0.886452258f, 0.889304936f},
-std::array<float,2>{0.0155940214f, 0.332155585f},
-std::array<float,2>{0.743504047f, 0.1980398f},
-std::array<float,2>{0.283235818f, 0.693908036f},
-std::array<float,2>{0.565589488f, 0.553499579f},
-std::array<float,2>{0.38767758f, 0.10642273f},
-std::array<float,2>{0.77150625f, 0.410144836f},
-std::array<float,2>{0.231847465f, 0.831168056f},
-std::array<float,2>{0.641561806f, 0.768906832f},
-std::array<float,2>{0.360252202f, 0.440725505f},
-std::array<float,2>{0.980683804f, 0.0333070494f},
-std::array<float,2>{0.11957141f, 0.613022864f},
-std::array<float,2>{0.831186414f, 0.651853621f},
-std::array<float,2>{0.186740428f, 0.148349017f},
-std::array<float,2>{0.541331649f, 0.289070368f},
-std::array<float,2>{0.487730801f, 0.999483049f},
-std::array<float,2>{0.805469751f, 0.845758736f},
-std::array<float,2>{0.201806843f, 0.40418309f},
-std::array<float,2>{0.601616681f, 0.0875145793f},
-std::array<float,2>{0.406529993f, 0.513891697f},
-std::array<float,2>{0.701612055f, 0.733047545f},
-std::array<float,2>{0.262505889f, 0.24357298f},
-std::array<float,2>{0.933600247f, 0.352695405f},
-std::array<float,2>{0.048835814f, 0.936577976f},
-std::array<float,2>{0.512153208f, 0.950459123f},
-std::array<float,2>{0.438530982f, 0.255767524f},
-std::array<float,2>{0.848043382f, 0.159097284f},
-std::array<float,2>{0.150995448f, 0.662240565f},
-std::array<float,2>{0.94216758f, 0.59101218f},
-std::array<float,2>{0.0702414662f, 0.0216720216f},
-std::array<float,2>{0.663122296f, 0.47401005f},
-std::array<float,2>{0.325247884f, 0.806614399f},
-std::array<float,2>{0.99893111f, 0.782065034f},
-std::array<float,2>{0.105570361f, 0.499107867f},
-std::array<float,2>{0.640326083f, 0.0108721917f},
-std::array<float,2>{0.353338152f, 0.57162112f},
-std::array<float,2>{0.547530711f, 0.683018386f},
-std::array<float,2>{0.469959468f, 0.173963204f},
-std::array<float,2>{0.827667177f, 0.277478099f},
-std::array<float,2>{0.160545066f, 0.96094054f},
-std::array<float,2>{0.726736605f, 0.914240062f},
-std::array<float,2>{0.3075324f, 0.37314418f},
-std::array<float,2>{0.905746877f, 0.222678021f},
-std::array<float,2>{0.0260775592f, 0.736050367f},
-std::array<float,2>{0.750283003f, 0.527793944f},
-std::array<float,2>{0.243655175f, 0.0713003129f},
-std::array<float,2>{0.583033502f, 0.383182377f},
-std::array<float,2>{0.402908564f, 0.859778225f},
-std::array<float,2>{0.87021476f, 0.974621952f},
-std::array<float,2>{0.128878891f, 0.301176757f},
-std::array<float,2>{0.528132617f, 0.135030806f},
-std::array<float,2>{0.458277464f, 0.629257798f},
-std::array<float,2>{0.672128141f, 0.598605633f},
-std::array<float,2>{0.341564119f, 0.0510073081f},
-std::array<float,2>{0.956979752f, 0.457893819f},
-std::array<float,2>{0.0839676559f, 0.763806939f},
-std::array<float,2>{0.621669233f, 0.820115864f},
-std::array<float,2>{0.426845014f, 0.433454305f},
-std::array<float,2>{0.785308659f, 0.118464045f},
-std::array<float,2>{0.212189123f, 0.537084699f},
-std::array<float,2>{0.919895113f, 0.714984f},
-std::array<float,2>{0.0376140587f, 0.209743783f},
-std::array<float,2>{0.70372051f, 0.312742949f},
-std::array<float,2>{0.278188795f, 0.899609268f},
-std::array<float,2>{0.96194464f, 0.958792627f},
-std::array<float,2>{0.0935385227f, 0.267212868f},
-std::array<float,2>{0.683026731f, 0.186924934f},
-std::array<float,2>{0.332444489f, 0.677155614f},
-std::array<float,2>{0.520664811f, 0.563691556f},
-std::array<float,2>{0.464823782f, 0.00431564962f},
-std::array<float,2>{0.863439679f, 0.492115825f},
-std::array<float,2>{0.138227567f, 0.794005275f},
-std::array<float,2>{0.711930513f, 0.872779429f},
-std::array<float,2>{0.270909965f, 0.375363648f},
-std::array<float,2>{0.912269831f, 0.0659308955f},
-std::array<float,2>{0.0428489186f, 0.518048227f},
-std::array<float,2>{0.795699716f, 0.74664402f},
-std::array<float,2>{0.210820138f, 0.233573124f},
-std::array<float,2>{0.616471231f, 0.36076358f},
-std::array<float,2>{0.436878771f, 0.911784112f},
-std::array<float,2>{0.812795222f, 0.754904389f},
-std::array<float,2>{0.166134074f, 0.465091854f},
-std::array<float,2>{0.556785941f, 0.0598252825f},
-std::array<float,2>{0.483273238f, 0.605531514f},
-std::array<float,2>{0.625981867f, 0.639925838f},
-std::array<float,2>{0.345013976f, 0.129974857f},
-std::array<float,2>{0.991454482f, 0.30708909f},
-std::array<float,2>{0.0953329504f, 0.983637512f},
-std::array<float,2>{0.591442227f, 0.897453249f},
-std::array<float,2>{0.392100662f, 0.322340071f},
-std::array<float,2>{0.763515234f, 0.216756299f},
-std::array<float,2>{0.23611322f, 0.70838201f},
-std::array<float,2>{0.897944868f, 0.541819751f},
-std::array<float,2>{0.0193362944f, 0.113572463f},
-std::array<float,2>{0.72043556f, 0.424153864f},
-std::array<float,2>{0.297812879f, 0.823817313f},
-std::array<float,2>{0.925774395f, 0.84149313f},
-std::array<float,2>{0.0596439317f, 0.417707622f},
-std::array<float,2>{0.68810904f, 0.101367511f},
-std::array<float,2>{0.252049655f, 0.557582319f},
-std::array<float,2>{0.596827149f, 0.696798146f},
-std::array<float,2>{0.42054683f, 0.190445498f},
-std::array<float,2>{0.804322541f, 0.340651363f},
-std::array<float,2>{0.191576317f, 0.878728509f},
-std::array<float,2>{0.668281913f, 0.990496159f},
-std::array<float,2>{0.312938154f, 0.284404695f},
-std::array<float,2>{0.947786808f, 0.151204079f},
-std::array<float,2>{0.0740336329f, 0.647895634f},
-std::array<float,2>{0.858060777f, 0.617982686f},
-std::array<float,2>{0.14820458f, 0.0399672203f},
-std::array<float,2>{0.501917005f, 0.449007869f},
-std::array<float,2>{0.446619332f, 0.774370849f},
-std::array<float,2>{0.776004076f, 0.926789761f},
-std::array<float,2>{0.220144853f, 0.350164205f},
-std::array<float,2>{0.574623466f, 0.236189455f},
-std::array<float,2>{0.382208526f, 0.723083436f},
-std::array<float,2>{0.734893799f, 0.502237082f},
-std::array<float,2>{0.296104699f, 0.0814281181f},
-std::array<float,2>{0.875446498f, 0.391192198f},
-std::array<float,2>{0.00333556277f, 0.854304016f},
-std::array<float,2>{0.537967145f, 0.801216245f},
-std::array<float,2>{0.497420698f, 0.481434673f},
-std::array<float,2>{0.841417313f, 0.0301903989f},
-std::array<float,2>{0.177839503f, 0.584984124f},
-std::array<float,2>{0.97409904f, 0.664120495f},
-std::array<float,2>{0.110195763f, 0.169928521f},
-std::array<float,2>{0.655632615f, 0.257832587f},
-std::array<float,2>{0.371818095f, 0.941089511f},
-std::array<float,2>{0.891527295f, 0.94600749f},
-std::array<float,2>{0.0220646299f, 0.250932127f},
-std::array<float,2>{0.724232435f, 0.160765126f},
-std::array<float,2>{0.302334458f, 0.657200456f},
-std::array<float,2>{0.588640153f, 0.587201655f},
-std::array<float,2>{0.395910442f, 0.0191297214f},
-std::array<float,2>{0.75791049f, 0.470028371f},
-std::array<float,2>{0.240177259f, 0.810915411f},
-std::array<float,2>{0.629909754f, 0.851278722f},
-std::array<float,2>{0.348646909f, 0.39901343f},
-std::array<float,2>{0.985395253f, 0.0903711841f},
-std::array<float,2>{0.0980634168f, 0.508328378f},
-std::array<float,2>{0.819269538f, 0.730457604f},
-std::array<float,2>{0.170580879f, 0.246997282f},
-std::array<float,2>{0.559253454f, 0.356939048f},
-std::array<float,2>{0.477065712f, 0.930661798f},
-std::array<float,2>{0.792434931f, 0.771921694f},
-std::array<float,2>{0.203342617f, 0.441653371f},
-std::array<float,2>{0.610006332f, 0.0369417258f},
-std::array<float,2>{0.431242555f, 0.613863885f},
-std::array<float,2>{0.718623519f, 0.65535301f},
-std::array<float,2>{0.267614096f, 0.142490029f},
-std::array<float,2>{0.906751692f, 0.293766439f},
-std::array<float,2>{0.0450088717f, 0.994340837f},
-std::array<float,2>{0.51899004f, 0.883988082f},
-std::array<float,2>{0.467821687f, 0.330303699f},
-std::array<float,2>{0.861718237f, 0.202439114f},
-std::array<float,2>{0.13349241f, 0.689330578f},
-std::array<float,2>{0.967661977f, 0.549178421f},
-std::array<float,2>{0.0859459788f, 0.10334903f},
-std::array<float,2>{0.686452746f, 0.413975716f},
-std::array<float,2>{0.328589737f, 0.832171917f},
-std::array<float,2>{0.969393909f, 0.814585507f},
-std::array<float,2>{0.117069818f, 0.433990568f},
-std::array<float,2>{0.6518839f, 0.121527605f},
-std::array<float,2>{0.367882818f, 0.531807303f},
-std::array<float,2>{0.534266889f, 0.713453054f},
-std::array<float,2>{0.494501054f, 0.204096898f},
-std::array<float,2>{0.837446988f, 0.319111168f},
-std::array<float,2>{0.175333202f, 0.90392679f},
-std::array<float,2>{0.740781128f, 0.972001851f},
-std::array<float,2>{0.290444225f, 0.298562586f},
-std::array<float,2>{0.879217803f, 0.139808327f},
-std::array<float,2>{0.00482470822f, 0.628829896f},
-std::array<float,2>{0.779114246f, 0.594750583f},
-std::array<float,2>{0.224200666f, 0.0500096306f},
-std::array<float,2>{0.571121812f, 0.455629855f},
-std::array<float,2>{0.378392041f, 0.760527074f},
-std::array<float,2>{0.854129672f, 0.921441197f},
-std::array<float,2>{0.141323596f, 0.370988429f},
-std::array<float,2>{0.507240951f, 0.222468928f},
-std::array<float,2>{0.451719582f, 0.742148459f},
-std::array<float,2>{0.665497065f, 0.525623798f},
-std::array<float,2>{0.318434864f, 0.075321652f},
-std::array<float,2>{0.95186913f, 0.387417287f},
-std::array<float,2>{0.0764449462f, 0.865915537f},
-std::array<float,2>{0.597728014f, 0.787627816f},
-std::array<float,2>{0.415639132f, 0.492916554f},
-std::array<float,2>{0.799457729f, 0.0127060618f},
-std::array<float,2>{0.189033166f, 0.576874018f},
-std::array<float,2>{0.926803529f, 0.685798466f},
-std::array<float,2>{0.0561627559f, 0.175785109f},
-std::array<float,2>{0.691640437f, 0.274300724f},
-std::array<float,2>{0.255249918f, 0.967563331f},
-std::array<float,2>{0.938696504f, 0.890981734f},
-std::array<float,2>{0.0654278472f, 0.325977981f},
-std::array<float,2>{0.656334817f, 0.213783175f},
-std::array<float,2>{0.323167801f, 0.703484952f},
-std::array<float,2>{0.510396719f, 0.545797527f},
-std::array<float,2>{0.443851411f, 0.112372376f},
-std::array<float,2>{0.847388566f, 0.426837504f},
-std::array<float,2>{0.153680071f, 0.824962556f},
-std::array<float,2>{0.696528733f, 0.752555549f},
-std::array<float,2>{0.259337783f, 0.463801473f},
-std::array<float,2>{0.930814624f, 0.0569405369f},
-std::array<float,2>{0.053446997f, 0.602919281f},
-std::array<float,2>{0.80940032f, 0.634567618f},
-std::array<float,2>{0.197050571f, 0.125320166f},
-std::array<float,2>{0.607287526f, 0.310193986f},
-std::array<float,2>{0.410954982f, 0.978018165f},
-std::array<float,2>{0.833540499f, 0.870203495f},
-std::array<float,2>{0.18351531f, 0.381885767f},
-std::array<float,2>{0.546162128f, 0.0698114783f},
-std::array<float,2>{0.491997033f, 0.522088587f},
-std::array<float,2>{0.645216107f, 0.743482172f},
-std::array<float,2>{0.365906775f, 0.227583438f},
-std::array<float,2>{0.980114341f, 0.364348322f},
-std::array<float,2>{0.121989556f, 0.906412303f},
-std::array<float,2>{0.56965977f, 0.956930578f},
-std::array<float,2>{0.383183718f, 0.271850526f},
-std::array<float,2>{0.769380748f, 0.182171449f},
-std::array<float,2>{0.228745833f, 0.672432184f},
-std::array<float,2>{0.889581263f, 0.569085538f},
-std::array<float,2>{0.00796887372f, 0.00338867633f},
-std::array<float,2>{0.748539448f, 0.487468362f},
-std::array<float,2>{0.288282961f, 0.790841341f},
-std::array<float,2>{0.916320443f, 0.79970634f},
-std::array<float,2>{0.0320893675f, 0.47884351f},
-std::array<float,2>{0.709907651f, 0.0266208556f},
-std::array<float,2>{0.274530172f, 0.580600202f},
-std::array<float,2>{0.621005654f, 0.668181837f},
-std::array<float,2>{0.42435196f, 0.167842373f},
-std::array<float,2>{0.784792364f, 0.261917233f},
-std::array<float,2>{0.217752755f, 0.943843484f},
-std::array<float,2>{0.678547621f, 0.924877822f},
-std::array<float,2>{0.338983566f, 0.344636917f},
-std::array<float,2>{0.95708096f, 0.241685078f},
-std::array<float,2>{0.0782110766f, 0.720779181f},
-std::array<float,2>{0.873615682f, 0.506664097f},
-std::array<float,2>{0.130369887f, 0.0857109949f},
-std::array<float,2>{0.524673522f, 0.396914423f},
-std::array<float,2>{0.454162568f, 0.856598794f},
-std::array<float,2>{0.754417539f, 0.987874389f},
-std::array<float,2>{0.248212755f, 0.287079096f},
-std::array<float,2>{0.580084026f, 0.154286087f},
-std::array<float,2>{0.400960386f, 0.641551375f},
-std::array<float,2>{0.730626106f, 0.62250334f},
-std::array<float,2>{0.310770243f, 0.0437411852f},
-std::array<float,2>{0.89987421f, 0.450161666f},
-std::array<float,2>{0.0296654627f, 0.777669549f},
-std::array<float,2>{0.551899731f, 0.837195337f},
-std::array<float,2>{0.474526316f, 0.418198198f},
-std::array<float,2>{0.823565245f, 0.0966064706f},
-std::array<float,2>{0.157547072f, 0.562443733f},
-std::array<float,2>{0.994900823f, 0.702487946f},
-std::array<float,2>{0.102495179f, 0.194879577f},
-std::array<float,2>{0.632851005f, 0.338431478f},
-std::array<float,2>{0.356669217f, 0.882785141f},
-std::array<float,2>{0.936652005f, 0.935341895f},
-std::array<float,2>{0.0486725643f, 0.354429245f},
-std::array<float,2>{0.699537635f, 0.245896384f},
-std::array<float,2>{0.264742881f, 0.732257247f},
-std::array<float,2>{0.605343759f, 0.512804866f},
-std::array<float,2>{0.410045505f, 0.0883428007f},
-std::array<float,2>{0.807019532f, 0.404520124f},
-std::array<float,2>{0.199343145f, 0.84381026f},
-std::array<float,2>{0.660898805f, 0.807404637f},
-std::array<float,2>{0.326815963f, 0.475117385f},
-std::array<float,2>{0.944322884f, 0.0207496528f},
-std::array<float,2>{0.0677371249f, 0.59265852f},
-std::array<float,2>{0.851537108f, 0.661569655f},
-std::array<float,2>{0.150261268f, 0.157729775f},
-std::array<float,2>{0.514883339f, 0.257790804f},
-std::array<float,2>{0.441161841f, 0.952450097f},
-std::array<float,2>{0.770068288f, 0.82947135f},
-std::array<float,2>{0.233139575f, 0.407001436f},
-std::array<float,2>{0.56433171f, 0.10822577f},
-std::array<float,2>{0.388872206f, 0.551006973f},
-std::array<float,2>{0.744335413f, 0.691924274f},
-std::array<float,2>{0.282780796f, 0.195858613f},
-std::array<float,2>{0.884612679f, 0.33420527f},
-std::array<float,2>{0.0132417521f, 0.88748908f},
-std::array<float,2>{0.53917861f, 0.996360004f},
-std::array<float,2>{0.485410988f, 0.292656064f},
-std::array<float,2>{0.828666866f, 0.14550066f},
-std::array<float,2>{0.184929892f, 0.650180221f},
-std::array<float,2>{0.984293818f, 0.609568894f},
-std::array<float,2>{0.117408551f, 0.0326278545f},
-std::array<float,2>{0.64338243f, 0.438755274f},
-std::array<float,2>{0.362008184f, 0.766340792f},
-std::array<float,2>{0.953350067f, 0.762805045f},
-std::array<float,2>{0.0841336325f, 0.459346831f},
-std::array<float,2>{0.675192893f, 0.0529038087f},
-std::array<float,2>{0.342704475f, 0.601508915f},
-std::array<float,2>{0.529680192f, 0.632050216f},
-std::array<float,2>{0.4590514f, 0.133076355f},
-std::array<float,2>{0.867642879f, 0.302849263f},
-std::array<float,2>{0.12569961f, 0.973906994f},
-std::array<float,2>{0.706007719f, 0.901694477f},
-std::array<float,2>{0.27963537f, 0.315704465f},
-std::array<float,2>{0.921872377f, 0.20762603f},
-std::array<float,2>{0.0364373736f, 0.717345893f},
-std::array<float,2>{0.78856504f, 0.537608027f},
-std::array<float,2>{0.214023724f, 0.121025249f},
-std::array<float,2>{0.623523176f, 0.430267096f},
-std::array<float,2>{0.429301471f, 0.817543149f},
-std::array<float,2>{0.82609421f, 0.963082731f},
-std::array<float,2>{0.163791582f, 0.279639781f},
-std::array<float,2>{0.549068213f, 0.172093287f},
-std::array<float,2>{0.471633941f, 0.681542397f},
-std::array<float,2>{0.638642728f, 0.572284579f},
-std::array<float,2>{0.354046911f, 0.00893269852f},
-std::array<float,2>{0.997675538f, 0.497099727f},
-std::array<float,2>{0.109224387f, 0.783969939f},
-std::array<float,2>{0.584925711f, 0.862583339f},
-std::array<float,2>{0.405892938f, 0.385628343f},
-std::array<float,2>{0.752453148f, 0.0742127523f},
-std::array<float,2>{0.245172054f, 0.530840755f},
-std::array<float,2>{0.903233647f, 0.73768872f},
-std::array<float,2>{0.0242675841f, 0.225900963f},
-std::array<float,2>{0.729663312f, 0.371542454f},
-std::array<float,2>{0.305525184f, 0.916074157f},
-std::array<float,2>{0.988464832f, 0.980610728f},
-std::array<float,2>{0.0965853408f, 0.306186497f},
-std::array<float,2>{0.627278209f, 0.130872563f},
-std::array<float,2>{0.345955759f, 0.636961102f},
-std::array<float,2>{0.554728031f, 0.607587278f},
-std::array<float,2>{0.481369972f, 0.0623758584f},
-std::array<float,2>{0.815532446f, 0.468411684f},
-std::array<float,2>{0.165260464f, 0.7568174f},
-std::array<float,2>{0.721452653f, 0.822137535f},
-std::array<float,2>{0.300367713f, 0.422564805f},
-std::array<float,2>{0.894901693f, 0.11541757f},
-std::array<float,2>{0.0161699522f, 0.540040016f},
-std::array<float,2>{0.764968574f, 0.7096138f},
-std::array<float,2>{0.237308428f, 0.217873365f},
-std::array<float,2>{0.59186554f, 0.321473092f},
-std::array<float,2>{0.393456906f, 0.895016789f},
-std::array<float,2>{0.866906404f, 0.79648912f},
-std::array<float,2>{0.138873056f, 0.489451647f},
-std::array<float,2>{0.521969914f, 0.00626422465f},
-std::array<float,2>{0.462038249f, 0.566134632f},
-std::array<float,2>{0.680335701f, 0.679231226f},
-std::array<float,2>{0.335310757f, 0.184214696f},
-std::array<float,2>{0.963171065f, 0.267671525f},
-std::array<float,2>{0.0904404521f, 0.959731281f},
-std::array<float,2>{0.61474818f, 0.913832843f},
-std::array<float,2>{0.434573948f, 0.363058031f},
-std::array<float,2>{0.79305613f, 0.231715336f},
-std::array<float,2>{0.207667768f, 0.749439359f},
-std::array<float,2>{0.911195993f, 0.515835822f},
-std::array<float,2>{0.0403789878f, 0.0628403202f},
-std::array<float,2>{0.713882267f, 0.377486855f},
-std::array<float,2>{0.27338618f, 0.873341024f},
-std::array<float,2>{0.878697276f, 0.852861047f},
-std::array<float,2>{0.00173025171f, 0.393749446f},
-std::array<float,2>{0.738237083f, 0.0784894526f},
-std::array<float,2>{0.294724047f, 0.501723289f},
-std::array<float,2>{0.576546848f, 0.725317121f},
-std::array<float,2>{0.380058467f, 0.238251954f},
-std::array<float,2>{0.774548411f, 0.349493533f},
-std::array<float,2>{0.221702829f, 0.928095341f},
-std::array<float,2>{0.65356493f, 0.939298272f},
-std::array<float,2>{0.373724818f, 0.260626465f},
-std::array<float,2>{0.97599858f, 0.169623032f},
-std::array<float,2>{0.113111049f, 0.666089237f},
-std::array<float,2>{0.843085527f, 0.583510458f},
-std::array<float,2>{0.177567557f, 0.0292523541f},
-std::array<float,2>{0.536319792f, 0.482518971f},
-std::array<float,2>{0.498884201f, 0.804333568f},
-std::array<float,2>{0.801550388f, 0.875216246f},
-std::array<float,2>{0.1940099f, 0.342557073f},
-std::array<float,2>{0.594919741f, 0.187722728f},
-std::array<float,2>{0.419284314f, 0.697774708f},
-std::array<float,2>{0.690197468f, 0.556562841f},
-std::array<float,2>{0.251596004f, 0.0984211788f},
-std::array<float,2>{0.922456503f, 0.414629221f},
-std::array<float,2>{0.0612150952f, 0.843049705f},
-std::array<float,2>{0.503150105f, 0.775916815f},
-std::array<float,2>{0.447561175f, 0.446133614f},
-std::array<float,2>{0.855696023f, 0.0420181751f},
-std::array<float,2>{0.145917594f, 0.620709598f},
-std::array<float,2>{0.945374668f, 0.644900084f},
-std::array<float,2>{0.0714993104f, 0.149489835f},
-std::array<float,2>{0.670743406f, 0.282678217f},
-std::array<float,2>{0.315037549f, 0.989458382f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.787586927f, 0.505497992f},
-std::array<float,2>{0.363583446f, 0.0731151477f},
-std::array<float,2>{0.0475486331f, 0.873319983f},
-std::array<float,2>{0.583333492f, 0.490180433f},
-std::array<float,2>{0.701827884f, 0.943842113f},
-std::array<float,2>{0.180403113f, 0.345385849f},
-std::array<float,2>{0.450209498f, 0.732197404f},
-std::array<float,2>{0.934036732f, 0.218603566f},
-std::array<float,2>{0.522267222f, 0.685996652f},
-std::array<float,2>{0.112469442f, 0.139253855f},
-std::array<float,2>{0.287380159f, 0.906483471f},
-std::array<float,2>{0.864227712f, 0.250741005f},
-std::array<float,2>{0.938977599f, 0.764473021f},
-std::array<float,2>{0.398415834f, 0.381176919f},
-std::array<float,2>{0.224874377f, 0.616548538f},
-std::array<float,2>{0.66585815f, 0.0315726884f},
-std::array<float,2>{0.87862438f, 0.691373527f},
-std::array<float,2>{0.498407096f, 0.241612136f},
-std::array<float,2>{0.151298687f, 0.978766382f},
-std::array<float,2>{0.721482992f, 0.312517256f},
-std::array<float,2>{0.620674491f, 0.834183872f},
-std::array<float,2>{0.0128484285f, 0.443616301f},
-std::array<float,2>{0.331160277f, 0.543385327f},
-std::array<float,2>{0.779228508f, 0.111834288f},
-std::array<float,2>{0.645974576f, 0.564130485f},
-std::array<float,2>{0.192877591f, 0.0282795504f},
-std::array<float,2>{0.413512796f, 0.800099969f},
-std::array<float,2>{0.972016275f, 0.424797833f},
-std::array<float,2>{0.843706965f, 0.88582468f},
-std::array<float,2>{0.267126441f, 0.30720827f},
-std::array<float,2>{0.0806234404f, 0.634385407f},
-std::array<float,2>{0.538610637f, 0.169633985f},
-std::array<float,2>{0.989364028f, 0.603250682f},
-std::array<float,2>{0.434038073f, 0.0474089831f},
-std::array<float,2>{0.207139984f, 0.781120002f},
-std::array<float,2>{0.630173147f, 0.391269386f},
-std::array<float,2>{0.553385377f, 0.932591915f},
-std::array<float,2>{0.0703757256f, 0.268073857f},
-std::array<float,2>{0.260019064f, 0.663989604f},
-std::array<float,2>{0.819170713f, 0.145649925f},
-std::array<float,2>{0.742902339f, 0.749358535f},
-std::array<float,2>{0.125933886f, 0.190058798f},
-std::array<float,2>{0.481447935f, 0.966598272f},
-std::array<float,2>{0.898923218f, 0.366000712f},
-std::array<float,2>{0.754016161f, 0.844804704f},
-std::array<float,2>{0.323630661f, 0.472743988f},
-std::array<float,2>{0.0158995744f, 0.519726634f},
-std::array<float,2>{0.603996098f, 0.0883536488f},
-std::array<float,2>{0.85476917f, 0.650893271f},
-std::array<float,2>{0.307225466f, 0.182827502f},
-std::array<float,2>{0.0943252817f, 0.898567617f},
-std::array<float,2>{0.511004031f, 0.28397575f},
-std::array<float,2>{0.674917102f, 0.790596247f},
-std::array<float,2>{0.236606166f, 0.411842376f},
-std::array<float,2>{0.387843698f, 0.585392654f},
-std::array<float,2>{0.958293617f, 0.000150712149f},
-std::array<float,2>{0.568916023f, 0.551203549f},
-std::array<float,2>{0.0458204299f, 0.0983504876f},
-std::array<float,2>{0.351385802f, 0.813651323f},
-std::array<float,2>{0.807304323f, 0.453587085f},
-std::array<float,2>{0.910746098f, 0.994374335f},
-std::array<float,2>{0.463232458f, 0.341476172f},
-std::array<float,2>{0.170790359f, 0.711165011f},
-std::array<float,2>{0.703552365f, 0.230364293f},
-std::array<float,2>{0.820432901f, 0.588407278f},
-std::array<float,2>{0.257624269f, 0.0118969455f},
-std::array<float,2>{0.0626094416f, 0.787025511f},
-std::array<float,2>{0.560110986f, 0.421049356f},
-std::array<float,2>{0.638853192f, 0.895430565f},
-std::array<float,2>{0.213186428f, 0.291729718f},
-std::array<float,2>{0.42203474f, 0.640885949f},
-std::array<float,2>{0.998059392f, 0.173135027f},
-std::array<float,2>{0.599660456f, 0.705892444f},
-std::array<float,2>{0.0288149826f, 0.220415205f},
-std::array<float,2>{0.316007912f, 0.990488172f},
-std::array<float,2>{0.760219038f, 0.334241003f},
-std::array<float,2>{0.895733535f, 0.822633922f},
-std::array<float,2>{0.469131738f, 0.461286753f},
-std::array<float,2>{0.133359998f, 0.55719775f},
-std::array<float,2>{0.741535962f, 0.109187417f},
-std::array<float,2>{0.961720645f, 0.668677151f},
-std::array<float,2>{0.380434096f, 0.149304509f},
-std::array<float,2>{0.243564248f, 0.929436326f},
-std::array<float,2>{0.682729363f, 0.280416965f},
-std::array<float,2>{0.502953947f, 0.768676996f},
-std::array<float,2>{0.106441632f, 0.403102726f},
-std::array<float,2>{0.302025348f, 0.599685013f},
-std::array<float,2>{0.848441541f, 0.0572681725f},
-std::array<float,2>{0.711508334f, 0.525501966f},
-std::array<float,2>{0.163314804f, 0.0785807967f},
-std::array<float,2>{0.458069205f, 0.852128208f},
-std::array<float,2>{0.915012002f, 0.483924866f},
-std::array<float,2>{0.802398384f, 0.954056263f},
-std::array<float,2>{0.357019782f, 0.371028513f},
-std::array<float,2>{0.0369088799f, 0.736201227f},
-std::array<float,2>{0.573233902f, 0.202346638f},
-std::array<float,2>{0.925957084f, 0.534826756f},
-std::array<float,2>{0.444495559f, 0.119989589f},
-std::array<float,2>{0.172577098f, 0.838869274f},
-std::array<float,2>{0.691241682f, 0.452805489f},
-std::array<float,2>{0.590732098f, 0.974060178f},
-std::array<float,2>{0.0608272552f, 0.322072893f},
-std::array<float,2>{0.367253482f, 0.696510971f},
-std::array<float,2>{0.795150638f, 0.24944967f},
-std::array<float,2>{0.66008836f, 0.629144132f},
-std::array<float,2>{0.229085371f, 0.159106717f},
-std::array<float,2>{0.404105276f, 0.882073581f},
-std::array<float,2>{0.951518714f, 0.298741102f},
-std::array<float,2>{0.873753071f, 0.8119663f},
-std::array<float,2>{0.292850375f, 0.433752328f},
-std::array<float,2>{0.123593107f, 0.57444787f},
-std::array<float,2>{0.523525417f, 0.0177488364f},
-std::array<float,2>{0.765933573f, 0.720637262f},
-std::array<float,2>{0.339424074f, 0.208006084f},
-std::array<float,2>{0.00452298857f, 0.947238386f},
-std::array<float,2>{0.614401162f, 0.356161773f},
-std::array<float,2>{0.731328309f, 0.864485264f},
-std::array<float,2>{0.144347817f, 0.499865741f},
-std::array<float,2>{0.487022161f, 0.512379944f},
-std::array<float,2>{0.884135902f, 0.069121778f},
-std::array<float,2>{0.546662748f, 0.623373628f},
-std::array<float,2>{0.0937120393f, 0.0458841287f},
-std::array<float,2>{0.274209589f, 0.757082283f},
-std::array<float,2>{0.830267131f, 0.383689255f},
-std::array<float,2>{0.983494163f, 0.92096132f},
-std::array<float,2>{0.414767325f, 0.264219791f},
-std::array<float,2>{0.202412903f, 0.672002137f},
-std::array<float,2>{0.650027275f, 0.127320305f},
-std::array<float,2>{0.762463987f, 0.610446334f},
-std::array<float,2>{0.319139659f, 0.0370539948f},
-std::array<float,2>{0.023680564f, 0.758275628f},
-std::array<float,2>{0.596440494f, 0.376767129f},
-std::array<float,2>{0.734747469f, 0.91269666f},
-std::array<float,2>{0.137614951f, 0.257529169f},
-std::array<float,2>{0.47466293f, 0.680595875f},
-std::array<float,2>{0.892678142f, 0.13560085f},
-std::array<float,2>{0.556359887f, 0.727587342f},
-std::array<float,2>{0.0670905784f, 0.211357608f},
-std::array<float,2>{0.252905995f, 0.940304518f},
-std::array<float,2>{0.825241268f, 0.349723518f},
-std::array<float,2>{0.993107378f, 0.868719935f},
-std::array<float,2>{0.428751439f, 0.488042206f},
-std::array<float,2>{0.217851475f, 0.501672983f},
-std::array<float,2>{0.636680245f, 0.0764142573f},
-std::array<float,2>{0.921399832f, 0.639899373f},
-std::array<float,2>{0.456244826f, 0.165184498f},
-std::array<float,2>{0.160105899f, 0.889348507f},
-std::array<float,2>{0.718579292f, 0.311224192f},
-std::array<float,2>{0.574638307f, 0.803528965f},
-std::array<float,2>{0.0328570381f, 0.426240444f},
-std::array<float,2>{0.352212757f, 0.56921804f},
-std::array<float,2>{0.797944665f, 0.024601005f},
-std::array<float,2>{0.684933245f, 0.540782034f},
-std::array<float,2>{0.247708485f, 0.114030421f},
-std::array<float,2>{0.378236979f, 0.828824162f},
-std::array<float,2>{0.967020571f, 0.438952446f},
-std::array<float,2>{0.845349431f, 0.980491996f},
-std::array<float,2>{0.296949208f, 0.320107758f},
-std::array<float,2>{0.105067223f, 0.692748547f},
-std::array<float,2>{0.507707238f, 0.2346659f},
-std::array<float,2>{0.947044611f, 0.516944468f},
-std::array<float,2>{0.401595443f, 0.0929071605f},
-std::array<float,2>{0.232557446f, 0.850252509f},
-std::array<float,2>{0.663718522f, 0.470621705f},
-std::array<float,2>{0.528397679f, 0.963982701f},
-std::array<float,2>{0.120992824f, 0.361081511f},
-std::array<float,2>{0.295981079f, 0.743453801f},
-std::array<float,2>{0.870460927f, 0.194936365f},
-std::array<float,2>{0.694540679f, 0.657297611f},
-std::array<float,2>{0.179600775f, 0.142944261f},
-std::array<float,2>{0.439976424f, 0.935837209f},
-std::array<float,2>{0.922666669f, 0.270462424f},
-std::array<float,2>{0.789309919f, 0.773801923f},
-std::array<float,2>{0.371451527f, 0.398004979f},
-std::array<float,2>{0.0578961782f, 0.60641551f},
-std::array<float,2>{0.58638531f, 0.0521016531f},
-std::array<float,2>{0.835025907f, 0.716861069f},
-std::array<float,2>{0.280346394f, 0.231284082f},
-std::array<float,2>{0.0859518275f, 0.997424603f},
-std::array<float,2>{0.540305078f, 0.336409837f},
-std::array<float,2>{0.655022621f, 0.816448331f},
-std::array<float,2>{0.198533252f, 0.45987916f},
-std::array<float,2>{0.420068234f, 0.547778726f},
-std::array<float,2>{0.977233946f, 0.0971539915f},
-std::array<float,2>{0.612646639f, 0.581681728f},
-std::array<float,2>{0.00178996334f, 0.00517515233f},
-std::array<float,2>{0.342827946f, 0.793728173f},
-std::array<float,2>{0.770269573f, 0.408789814f},
-std::array<float,2>{0.888816714f, 0.902455688f},
-std::array<float,2>{0.488648862f, 0.287410587f},
-std::array<float,2>{0.147513866f, 0.654672027f},
-std::array<float,2>{0.728076041f, 0.184170142f},
-std::array<float,2>{0.860110521f, 0.562213778f},
-std::array<float,2>{0.283730596f, 0.103638172f},
-std::array<float,2>{0.115423657f, 0.827684939f},
-std::array<float,2>{0.515886962f, 0.466422021f},
-std::array<float,2>{0.671342969f, 0.987668216f},
-std::array<float,2>{0.219148412f, 0.329215378f},
-std::array<float,2>{0.392250121f, 0.707211614f},
-std::array<float,2>{0.943067253f, 0.223377809f},
-std::array<float,2>{0.580815852f, 0.6458143f},
-std::array<float,2>{0.0535216443f, 0.177818507f},
-std::array<float,2>{0.362128139f, 0.894503176f},
-std::array<float,2>{0.782222629f, 0.295400828f},
-std::array<float,2>{0.932577372f, 0.783758879f},
-std::array<float,2>{0.449110121f, 0.41587761f},
-std::array<float,2>{0.18489413f, 0.592056036f},
-std::array<float,2>{0.695729136f, 0.0089419242f},
-std::array<float,2>{0.973733783f, 0.738681555f},
-std::array<float,2>{0.408739984f, 0.196643725f},
-std::array<float,2>{0.1903283f, 0.958116233f},
-std::array<float,2>{0.641313136f, 0.372478515f},
-std::array<float,2>{0.533369124f, 0.858504891f},
-std::array<float,2>{0.0852977112f, 0.48025164f},
-std::array<float,2>{0.271646023f, 0.529162824f},
-std::array<float,2>{0.836915076f, 0.084322162f},
-std::array<float,2>{0.725317597f, 0.593941569f},
-std::array<float,2>{0.154013589f, 0.0586970262f},
-std::array<float,2>{0.493865013f, 0.772452533f},
-std::array<float,2>{0.879931569f, 0.40212363f},
-std::array<float,2>{0.774749219f, 0.92310226f},
-std::array<float,2>{0.33373794f, 0.273985952f},
-std::array<float,2>{0.00902409945f, 0.667033613f},
-std::array<float,2>{0.624207079f, 0.15265128f},
-std::array<float,2>{0.903578818f, 0.572799206f},
-std::array<float,2>{0.479999274f, 0.0226831865f},
-std::array<float,2>{0.129712924f, 0.807201982f},
-std::array<float,2>{0.748216331f, 0.431278914f},
-std::array<float,2>{0.60729754f, 0.876187325f},
-std::array<float,2>{0.0209142826f, 0.301107019f},
-std::array<float,2>{0.327350855f, 0.628676653f},
-std::array<float,2>{0.752007961f, 0.163061514f},
-std::array<float,2>{0.625960946f, 0.702927172f},
-std::array<float,2>{0.203404233f, 0.242554069f},
-std::array<float,2>{0.430776745f, 0.9711411f},
-std::array<float,2>{0.986756861f, 0.327679873f},
-std::array<float,2>{0.812952459f, 0.842150509f},
-std::array<float,2>{0.262653738f, 0.445786923f},
-std::array<float,2>{0.074890092f, 0.53644979f},
-std::array<float,2>{0.549145818f, 0.122416794f},
-std::array<float,2>{0.811941504f, 0.678008795f},
-std::array<float,2>{0.345616281f, 0.132183105f},
-std::array<float,2>{0.0427767597f, 0.916050434f},
-std::array<float,2>{0.564724684f, 0.258622855f},
-std::array<float,2>{0.707194388f, 0.752052248f},
-std::array<float,2>{0.164481819f, 0.387634695f},
-std::array<float,2>{0.465910286f, 0.620322704f},
-std::array<float,2>{0.909187198f, 0.0416044444f},
-std::array<float,2>{0.513330579f, 0.509428024f},
-std::array<float,2>{0.0994338542f, 0.064939484f},
-std::array<float,2>{0.309112489f, 0.861178696f},
-std::array<float,2>{0.858812273f, 0.495708883f},
-std::array<float,2>{0.956179738f, 0.951559424f},
-std::array<float,2>{0.385677665f, 0.353408188f},
-std::array<float,2>{0.239507183f, 0.725331247f},
-std::array<float,2>{0.679470778f, 0.204371423f},
-std::array<float,2>{0.780807078f, 0.546750009f},
-std::array<float,2>{0.329641938f, 0.111124024f},
-std::array<float,2>{0.0155173549f, 0.833242953f},
-std::array<float,2>{0.618447423f, 0.442346841f},
-std::array<float,2>{0.720589101f, 0.977257073f},
-std::array<float,2>{0.149573028f, 0.316276312f},
-std::array<float,2>{0.49721843f, 0.68944782f},
-std::array<float,2>{0.875251532f, 0.239211425f},
-std::array<float,2>{0.536760986f, 0.636466086f},
-std::array<float,2>{0.0790610537f, 0.171227843f},
-std::array<float,2>{0.26807344f, 0.884018719f},
-std::array<float,2>{0.840803981f, 0.305608988f},
-std::array<float,2>{0.969720662f, 0.79794085f},
-std::array<float,2>{0.411970884f, 0.423236489f},
-std::array<float,2>{0.193837047f, 0.565190673f},
-std::array<float,2>{0.646829426f, 0.0294493977f},
-std::array<float,2>{0.935949743f, 0.732635379f},
-std::array<float,2>{0.452695101f, 0.215931565f},
-std::array<float,2>{0.182349429f, 0.942992628f},
-std::array<float,2>{0.700174451f, 0.346298784f},
-std::array<float,2>{0.585292339f, 0.871652305f},
-std::array<float,2>{0.0504957922f, 0.490362376f},
-std::array<float,2>{0.365917981f, 0.505923867f},
-std::array<float,2>{0.785986543f, 0.0716653913f},
-std::array<float,2>{0.666085601f, 0.614392698f},
-std::array<float,2>{0.22355406f, 0.0343918018f},
-std::array<float,2>{0.395693004f, 0.761882186f},
-std::array<float,2>{0.940948486f, 0.379794836f},
-std::array<float,2>{0.867022276f, 0.910094678f},
-std::array<float,2>{0.285619736f, 0.253189385f},
-std::array<float,2>{0.110719807f, 0.684477687f},
-std::array<float,2>{0.521170795f, 0.138551757f},
-std::array<float,2>{0.959377348f, 0.583518624f},
-std::array<float,2>{0.389910072f, 0.00301403087f},
-std::array<float,2>{0.234494254f, 0.79266274f},
-std::array<float,2>{0.67307359f, 0.413194567f},
-std::array<float,2>{0.508646309f, 0.900984347f},
-std::array<float,2>{0.0969590247f, 0.28189975f},
-std::array<float,2>{0.30519557f, 0.649140537f},
-std::array<float,2>{0.852118731f, 0.181009129f},
-std::array<float,2>{0.706293762f, 0.714736342f},
-std::array<float,2>{0.169791922f, 0.22709994f},
-std::array<float,2>{0.462505788f, 0.993011117f},
-std::array<float,2>{0.914015949f, 0.343363047f},
-std::array<float,2>{0.804819703f, 0.816107452f},
-std::array<float,2>{0.349209368f, 0.456319749f},
-std::array<float,2>{0.0431036837f, 0.553888738f},
-std::array<float,2>{0.567895055f, 0.100100905f},
-std::array<float,2>{0.816616535f, 0.661560059f},
-std::array<float,2>{0.258965909f, 0.147019252f},
-std::array<float,2>{0.0732108131f, 0.931249142f},
-std::array<float,2>{0.551828444f, 0.265836179f},
-std::array<float,2>{0.631022573f, 0.778979242f},
-std::array<float,2>{0.210632443f, 0.392595857f},
-std::array<float,2>{0.43709293f, 0.603606164f},
-std::array<float,2>{0.991726935f, 0.0488526411f},
-std::array<float,2>{0.602535069f, 0.522908747f},
-std::array<float,2>{0.0177391469f, 0.0865008309f},
-std::array<float,2>{0.320960879f, 0.846335292f},
-std::array<float,2>{0.757594526f, 0.476502925f},
-std::array<float,2>{0.902080119f, 0.967228532f},
-std::array<float,2>{0.483782858f, 0.363528281f},
-std::array<float,2>{0.127798408f, 0.746507466f},
-std::array<float,2>{0.744639277f, 0.187771916f},
-std::array<float,2>{0.850621223f, 0.597802579f},
-std::array<float,2>{0.303419858f, 0.0547028594f},
-std::array<float,2>{0.10756702f, 0.767041624f},
-std::array<float,2>{0.501574814f, 0.40517351f},
-std::array<float,2>{0.681570768f, 0.926711023f},
-std::array<float,2>{0.24533768f, 0.279248089f},
-std::array<float,2>{0.382000953f, 0.671646059f},
-std::array<float,2>{0.964198768f, 0.151570112f},
-std::array<float,2>{0.57048738f, 0.737012446f},
-std::array<float,2>{0.0381627753f, 0.199933842f},
-std::array<float,2>{0.358344853f, 0.955322266f},
-std::array<float,2>{0.804525971f, 0.368139654f},
-std::array<float,2>{0.917758286f, 0.854768515f},
-std::array<float,2>{0.460277826f, 0.480489641f},
-std::array<float,2>{0.160873517f, 0.523655415f},
-std::array<float,2>{0.713749468f, 0.0802058354f},
-std::array<float,2>{0.996881604f, 0.643897593f},
-std::array<float,2>{0.424675673f, 0.174695939f},
-std::array<float,2>{0.212270662f, 0.897602558f},
-std::array<float,2>{0.638397455f, 0.29040724f},
-std::array<float,2>{0.561323881f, 0.788238466f},
-std::array<float,2>{0.0663409606f, 0.418459386f},
-std::array<float,2>{0.254132509f, 0.587609112f},
-std::array<float,2>{0.822989464f, 0.0143688805f},
-std::array<float,2>{0.739607275f, 0.55648005f},
-std::array<float,2>{0.134990066f, 0.105663925f},
-std::array<float,2>{0.472199261f, 0.821179867f},
-std::array<float,2>{0.898043692f, 0.463360548f},
-std::array<float,2>{0.758511245f, 0.989840984f},
-std::array<float,2>{0.313171327f, 0.332228571f},
-std::array<float,2>{0.0293167885f, 0.704620242f},
-std::array<float,2>{0.598369122f, 0.221239239f},
-std::array<float,2>{0.886026025f, 0.515499175f},
-std::array<float,2>{0.485964864f, 0.0672625974f},
-std::array<float,2>{0.141849801f, 0.866542459f},
-std::array<float,2>{0.734263301f, 0.497644991f},
-std::array<float,2>{0.616636872f, 0.948292851f},
-std::array<float,2>{0.0060976469f, 0.359274089f},
-std::array<float,2>{0.336511552f, 0.722076893f},
-std::array<float,2>{0.769106686f, 0.21070762f},
-std::array<float,2>{0.651367486f, 0.674284935f},
-std::array<float,2>{0.199383736f, 0.126917928f},
-std::array<float,2>{0.416358888f, 0.919169903f},
-std::array<float,2>{0.981500447f, 0.262685061f},
-std::array<float,2>{0.828868985f, 0.754348814f},
-std::array<float,2>{0.277061731f, 0.385781288f},
-std::array<float,2>{0.0911808014f, 0.622963369f},
-std::array<float,2>{0.543619812f, 0.0439952575f},
-std::array<float,2>{0.794016063f, 0.698660076f},
-std::array<float,2>{0.370714933f, 0.246421605f},
-std::array<float,2>{0.0587260947f, 0.976174831f},
-std::array<float,2>{0.592769504f, 0.323696047f},
-std::array<float,2>{0.688913226f, 0.83646369f},
-std::array<float,2>{0.174700215f, 0.449657947f},
-std::array<float,2>{0.441789657f, 0.53258121f},
-std::array<float,2>{0.92784667f, 0.118558861f},
-std::array<float,2>{0.525571942f, 0.578007162f},
-std::array<float,2>{0.121949509f, 0.0171886068f},
-std::array<float,2>{0.289527178f, 0.810249686f},
-std::array<float,2>{0.871507466f, 0.436723411f},
-std::array<float,2>{0.949807405f, 0.879995584f},
-std::array<float,2>{0.406109571f, 0.299226165f},
-std::array<float,2>{0.227101013f, 0.631906867f},
-std::array<float,2>{0.656277597f, 0.157837182f},
-std::array<float,2>{0.799858451f, 0.56677866f},
-std::array<float,2>{0.355467975f, 0.0269808043f},
-std::array<float,2>{0.0336602256f, 0.80190742f},
-std::array<float,2>{0.576285601f, 0.428553492f},
-std::array<float,2>{0.716511428f, 0.888096094f},
-std::array<float,2>{0.157024324f, 0.310515672f},
-std::array<float,2>{0.454877108f, 0.637373924f},
-std::array<float,2>{0.919323564f, 0.166765794f},
-std::array<float,2>{0.504448652f, 0.694446564f},
-std::array<float,2>{0.101645462f, 0.237209886f},
-std::array<float,2>{0.299486816f, 0.983331084f},
-std::array<float,2>{0.847062051f, 0.318115085f},
-std::array<float,2>{0.966032505f, 0.831004977f},
-std::array<float,2>{0.375342369f, 0.441106677f},
-std::array<float,2>{0.248235106f, 0.541353405f},
-std::array<float,2>{0.686819136f, 0.116716199f},
-std::array<float,2>{0.89069289f, 0.681663811f},
-std::array<float,2>{0.474392802f, 0.134475455f},
-std::array<float,2>{0.14004229f, 0.910574555f},
-std::array<float,2>{0.73822391f, 0.254555136f},
-std::array<float,2>{0.593791962f, 0.760679781f},
-std::array<float,2>{0.0268610418f, 0.377083391f},
-std::array<float,2>{0.317944705f, 0.611429214f},
-std::array<float,2>{0.765575528f, 0.0388736688f},
-std::array<float,2>{0.633675456f, 0.503673792f},
-std::array<float,2>{0.216403529f, 0.0750286132f},
-std::array<float,2>{0.426323831f, 0.870051742f},
-std::array<float,2>{0.994457364f, 0.484761775f},
-std::array<float,2>{0.827804387f, 0.937570453f},
-std::array<float,2>{0.251908571f, 0.348345518f},
-std::array<float,2>{0.0685645342f, 0.729358017f},
-std::array<float,2>{0.557167232f, 0.213882253f},
-std::array<float,2>{0.979747474f, 0.549883127f},
-std::array<float,2>{0.418059975f, 0.0941923708f},
-std::array<float,2>{0.196179226f, 0.819231212f},
-std::array<float,2>{0.653218031f, 0.457458735f},
-std::array<float,2>{0.54112041f, 0.999091506f},
-std::array<float,2>{0.0882381201f, 0.339322329f},
-std::array<float,2>{0.279112399f, 0.715771258f},
-std::array<float,2>{0.832814813f, 0.233946443f},
-std::array<float,2>{0.728693187f, 0.653175294f},
-std::array<float,2>{0.14507857f, 0.186076626f},
-std::array<float,2>{0.491550118f, 0.906003058f},
-std::array<float,2>{0.887819469f, 0.285801202f},
-std::array<float,2>{0.772899806f, 0.795961738f},
-std::array<float,2>{0.340423346f, 0.407978088f},
-std::array<float,2>{0.00322759408f, 0.57951498f},
-std::array<float,2>{0.611050606f, 0.00592491683f},
-std::array<float,2>{0.867939413f, 0.744899035f},
-std::array<float,2>{0.294260323f, 0.191605076f},
-std::array<float,2>{0.119053513f, 0.962422073f},
-std::array<float,2>{0.529711545f, 0.362397075f},
-std::array<float,2>{0.662071466f, 0.849310279f},
-std::array<float,2>{0.231786832f, 0.471011251f},
-std::array<float,2>{0.398940653f, 0.518703282f},
-std::array<float,2>{0.947936177f, 0.0907641649f},
-std::array<float,2>{0.588614881f, 0.608825445f},
-std::array<float,2>{0.0547557771f, 0.0529221147f},
-std::array<float,2>{0.373346657f, 0.776534379f},
-std::array<float,2>{0.79137677f, 0.394993991f},
-std::array<float,2>{0.925699413f, 0.933688819f},
-std::array<float,2>{0.437571287f, 0.271917015f},
-std::array<float,2>{0.175904855f, 0.659758091f},
-std::array<float,2>{0.691421092f, 0.142130017f},
-std::array<float,2>{0.839286804f, 0.52953732f},
-std::array<float,2>{0.270912021f, 0.0826840401f},
-std::array<float,2>{0.0828488469f, 0.856553376f},
-std::array<float,2>{0.531283855f, 0.477717578f},
-std::array<float,2>{0.644359112f, 0.960191488f},
-std::array<float,2>{0.188490555f, 0.373255968f},
-std::array<float,2>{0.406293482f, 0.74024725f},
-std::array<float,2>{0.975755274f, 0.198836803f},
-std::array<float,2>{0.621552348f, 0.664993227f},
-std::array<float,2>{0.010205566f, 0.155137822f},
-std::array<float,2>{0.335630804f, 0.925722182f},
-std::array<float,2>{0.775896072f, 0.27646783f},
-std::array<float,2>{0.881121933f, 0.770463347f},
-std::array<float,2>{0.495523661f, 0.399500698f},
-std::array<float,2>{0.156097919f, 0.596288145f},
-std::array<float,2>{0.723044634f, 0.0613888726f},
-std::array<float,2>{0.943971217f, 0.709895611f},
-std::array<float,2>{0.394024342f, 0.22560212f},
-std::array<float,2>{0.221993178f, 0.985953033f},
-std::array<float,2>{0.668863297f, 0.3309367f},
-std::array<float,2>{0.517907023f, 0.825798929f},
-std::array<float,2>{0.114863835f, 0.467644006f},
-std::array<float,2>{0.282923907f, 0.559412718f},
-std::array<float,2>{0.861410379f, 0.101607695f},
-std::array<float,2>{0.699112833f, 0.589939833f},
-std::array<float,2>{0.186025903f, 0.0101835635f},
-std::array<float,2>{0.447080493f, 0.782298923f},
-std::array<float,2>{0.930110395f, 0.417157829f},
-std::array<float,2>{0.783952177f, 0.890816092f},
-std::array<float,2>{0.36053133f, 0.294313312f},
-std::array<float,2>{0.0519520119f, 0.646643698f},
-std::array<float,2>{0.580000222f, 0.177360594f},
-std::array<float,2>{0.908106506f, 0.619059205f},
-std::array<float,2>{0.467332542f, 0.0402550437f},
-std::array<float,2>{0.167096883f, 0.751877189f},
-std::array<float,2>{0.709476471f, 0.389039367f},
-std::array<float,2>{0.563961506f, 0.91427511f},
-std::array<float,2>{0.0407943465f, 0.260210574f},
-std::array<float,2>{0.34593606f, 0.677280128f},
-std::array<float,2>{0.808726132f, 0.129432008f},
-std::array<float,2>{0.676505864f, 0.723474085f},
-std::array<float,2>{0.241830751f, 0.20637171f},
-std::array<float,2>{0.382959634f, 0.950343788f},
-std::array<float,2>{0.954630315f, 0.354640603f},
-std::array<float,2>{0.857013464f, 0.862411976f},
-std::array<float,2>{0.311889291f, 0.49323073f},
-std::array<float,2>{0.101307318f, 0.510646284f},
-std::array<float,2>{0.514673829f, 0.063557148f},
-std::array<float,2>{0.751840174f, 0.626269042f},
-std::array<float,2>{0.324784994f, 0.161633804f},
-std::array<float,2>{0.0230696797f, 0.878605127f},
-std::array<float,2>{0.609196901f, 0.304020524f},
-std::array<float,2>{0.746181011f, 0.805952191f},
-std::array<float,2>{0.132495061f, 0.43273893f},
-std::array<float,2>{0.478356719f, 0.572034836f},
-std::array<float,2>{0.905332148f, 0.0209860094f},
-std::array<float,2>{0.548756897f, 0.537187576f},
-std::array<float,2>{0.0780459046f, 0.123801842f},
-std::array<float,2>{0.265494138f, 0.839945853f},
-std::array<float,2>{0.815393031f, 0.448239863f},
-std::array<float,2>{0.98483634f, 0.970676064f},
-std::array<float,2>{0.432810515f, 0.324954569f},
-std::array<float,2>{0.205288172f, 0.699967802f},
-std::array<float,2>{0.627242863f, 0.245140657f},
-std::array<float,2>{0.807813883f, 0.553486705f},
-std::array<float,2>{0.34981361f, 0.101057425f},
-std::array<float,2>{0.0459209122f, 0.815414429f},
-std::array<float,2>{0.569417298f, 0.455906302f},
-std::array<float,2>{0.705014348f, 0.994017661f},
-std::array<float,2>{0.17100504f, 0.34230274f},
-std::array<float,2>{0.463960737f, 0.713145852f},
-std::array<float,2>{0.911998153f, 0.227778301f},
-std::array<float,2>{0.509811103f, 0.650138676f},
-std::array<float,2>{0.094841525f, 0.180330932f},
-std::array<float,2>{0.308183491f, 0.902144551f},
-std::array<float,2>{0.854415774f, 0.282794386f},
-std::array<float,2>{0.957312763f, 0.79115963f},
-std::array<float,2>{0.386756867f, 0.412295043f},
-std::array<float,2>{0.237517893f, 0.582735121f},
-std::array<float,2>{0.674268961f, 0.00234555965f},
-std::array<float,2>{0.899777293f, 0.747394264f},
-std::array<float,2>{0.480957896f, 0.188896626f},
-std::array<float,2>{0.12658295f, 0.968430579f},
-std::array<float,2>{0.743543506f, 0.364962369f},
-std::array<float,2>{0.605098903f, 0.847545922f},
-std::array<float,2>{0.0174477939f, 0.475534379f},
-std::array<float,2>{0.323030621f, 0.521755815f},
-std::array<float,2>{0.755120337f, 0.0874333605f},
-std::array<float,2>{0.629451811f, 0.604601741f},
-std::array<float,2>{0.208618164f, 0.0507003032f},
-std::array<float,2>{0.435029328f, 0.77795434f},
-std::array<float,2>{0.988842189f, 0.393562406f},
-std::array<float,2>{0.819913328f, 0.929722309f},
-std::array<float,2>{0.261417329f, 0.266894698f},
-std::array<float,2>{0.0714393258f, 0.660166621f},
-std::array<float,2>{0.554262936f, 0.147844657f},
-std::array<float,2>{0.970736504f, 0.565735638f},
-std::array<float,2>{0.412342727f, 0.0303848796f},
-std::array<float,2>{0.192286402f, 0.797670305f},
-std::array<float,2>{0.645295978f, 0.422283143f},
-std::array<float,2>{0.537733972f, 0.883266687f},
-std::array<float,2>{0.0814892873f, 0.305835843f},
-std::array<float,2>{0.266445279f, 0.635010779f},
-std::array<float,2>{0.842203557f, 0.170798481f},
-std::array<float,2>{0.722283006f, 0.687936425f},
-std::array<float,2>{0.152323127f, 0.239321977f},
-std::array<float,2>{0.49941653f, 0.977897942f},
-std::array<float,2>{0.877848864f, 0.314789861f},
-std::array<float,2>{0.777876973f, 0.832397997f},
-std::array<float,2>{0.330424219f, 0.442982107f},
-std::array<float,2>{0.0126466705f, 0.545746624f},
-std::array<float,2>{0.619430125f, 0.109949067f},
-std::array<float,2>{0.865234315f, 0.685379267f},
-std::array<float,2>{0.28850168f, 0.137646079f},
-std::array<float,2>{0.111516744f, 0.908699036f},
-std::array<float,2>{0.522502542f, 0.252079457f},
-std::array<float,2>{0.664111853f, 0.763069272f},
-std::array<float,2>{0.22594139f, 0.380812019f},
-std::array<float,2>{0.396715134f, 0.613991261f},
-std::array<float,2>{0.937819541f, 0.033382915f},
-std::array<float,2>{0.582315385f, 0.507654309f},
-std::array<float,2>{0.0478741452f, 0.0706157535f},
-std::array<float,2>{0.36429134f, 0.872728348f},
-std::array<float,2>{0.788192749f, 0.492120117f},
-std::array<float,2>{0.934703708f, 0.942088783f},
-std::array<float,2>{0.449573696f, 0.346995592f},
-std::array<float,2>{0.180822089f, 0.733790636f},
-std::array<float,2>{0.703000844f, 0.215646639f},
-std::array<float,2>{0.831255198f, 0.622049272f},
-std::array<float,2>{0.275308579f, 0.0436081104f},
-std::array<float,2>{0.0923708305f, 0.755234599f},
-std::array<float,2>{0.545789063f, 0.38549909f},
-std::array<float,2>{0.649362862f, 0.918554783f},
-std::array<float,2>{0.201483935f, 0.263119578f},
-std::array<float,2>{0.415044218f, 0.675625503f},
-std::array<float,2>{0.983245969f, 0.125792474f},
-std::array<float,2>{0.613427997f, 0.720748663f},
-std::array<float,2>{0.0049529057f, 0.209832758f},
-std::array<float,2>{0.338683575f, 0.948200464f},
-std::array<float,2>{0.767508686f, 0.358179182f},
-std::array<float,2>{0.883756042f, 0.866037905f},
-std::array<float,2>{0.48755601f, 0.496313632f},
-std::array<float,2>{0.143261671f, 0.514081717f},
-std::array<float,2>{0.731919944f, 0.0678923875f},
-std::array<float,2>{0.952428043f, 0.631766796f},
-std::array<float,2>{0.402437478f, 0.156563967f},
-std::array<float,2>{0.230198458f, 0.879418552f},
-std::array<float,2>{0.659090519f, 0.300502539f},
-std::array<float,2>{0.524488568f, 0.809525073f},
-std::array<float,2>{0.124233335f, 0.435649782f},
-std::array<float,2>{0.291644156f, 0.576194763f},
-std::array<float,2>{0.874416411f, 0.0158350691f},
-std::array<float,2>{0.689973712f, 0.531916678f},
-std::array<float,2>{0.173798397f, 0.118049055f},
-std::array<float,2>{0.443785459f, 0.837812006f},
-std::array<float,2>{0.927719831f, 0.450859755f},
-std::array<float,2>{0.796191812f, 0.974783421f},
-std::array<float,2>{0.368880451f, 0.322683066f},
-std::array<float,2>{0.0617422573f, 0.697695613f},
-std::array<float,2>{0.590851784f, 0.247390047f},
-std::array<float,2>{0.915622115f, 0.525078833f},
-std::array<float,2>{0.457394898f, 0.081682995f},
-std::array<float,2>{0.162235677f, 0.854043305f},
-std::array<float,2>{0.712294281f, 0.481787592f},
-std::array<float,2>{0.573669195f, 0.956333756f},
-std::array<float,2>{0.0353050157f, 0.368238539f},
-std::array<float,2>{0.356042206f, 0.738002121f},
-std::array<float,2>{0.80122304f, 0.201103121f},
-std::array<float,2>{0.681709647f, 0.670809805f},
-std::array<float,2>{0.243114173f, 0.151238605f},
-std::array<float,2>{0.37915808f, 0.927106678f},
-std::array<float,2>{0.962890506f, 0.27734527f},
-std::array<float,2>{0.84946394f, 0.765650034f},
-std::array<float,2>{0.301677585f, 0.405457944f},
-std::array<float,2>{0.106477879f, 0.599538624f},
-std::array<float,2>{0.502057076f, 0.0563262366f},
-std::array<float,2>{0.760753691f, 0.703234255f},
-std::array<float,2>{0.315067649f, 0.222056687f},
-std::array<float,2>{0.0279218759f, 0.988720059f},
-std::array<float,2>{0.600949883f, 0.333178639f},
-std::array<float,2>{0.740734339f, 0.821980894f},
-std::array<float,2>{0.133878961f, 0.464391768f},
-std::array<float,2>{0.469871193f, 0.555327415f},
-std::array<float,2>{0.89466691f, 0.107313395f},
-std::array<float,2>{0.559295416f, 0.586874127f},
-std::array<float,2>{0.0638138428f, 0.0147054438f},
-std::array<float,2>{0.255881608f, 0.787834942f},
-std::array<float,2>{0.821555614f, 0.418988705f},
-std::array<float,2>{0.999576449f, 0.896636128f},
-std::array<float,2>{0.423604995f, 0.289549738f},
-std::array<float,2>{0.214651302f, 0.643173754f},
-std::array<float,2>{0.639870524f, 0.175322279f},
-std::array<float,2>{0.77137661f, 0.578197718f},
-std::array<float,2>{0.342121065f, 0.00728551857f},
-std::array<float,2>{0.00054301304f, 0.795022368f},
-std::array<float,2>{0.611973047f, 0.406719327f},
-std::array<float,2>{0.727117062f, 0.905131936f},
-std::array<float,2>{0.147406876f, 0.286249638f},
-std::array<float,2>{0.489966273f, 0.653423667f},
-std::array<float,2>{0.890218019f, 0.186774001f},
-std::array<float,2>{0.539230466f, 0.716088057f},
-std::array<float,2>{0.0876093656f, 0.233198911f},
-std::array<float,2>{0.279369593f, 0.99863869f},
-std::array<float,2>{0.834244311f, 0.338173598f},
-std::array<float,2>{0.978121281f, 0.820168555f},
-std::array<float,2>{0.421752006f, 0.458084643f},
-std::array<float,2>{0.198012456f, 0.549179792f},
-std::array<float,2>{0.655280709f, 0.0953206643f},
-std::array<float,2>{0.923597574f, 0.658211529f},
-std::array<float,2>{0.440951198f, 0.141469449f},
-std::array<float,2>{0.17795226f, 0.935095251f},
-std::array<float,2>{0.694120169f, 0.27270928f},
-std::array<float,2>{0.58728832f, 0.776130557f},
-std::array<float,2>{0.057609085f, 0.395862281f},
-std::array<float,2>{0.372648448f, 0.607481539f},
-std::array<float,2>{0.790811419f, 0.0540027544f},
-std::array<float,2>{0.663067758f, 0.518226087f},
-std::array<float,2>{0.233481705f, 0.0917558894f},
-std::array<float,2>{0.4005256f, 0.848061621f},
-std::array<float,2>{0.945370793f, 0.472017586f},
-std::array<float,2>{0.86999023f, 0.961151242f},
-std::array<float,2>{0.295397401f, 0.362186581f},
-std::array<float,2>{0.119865321f, 0.745757937f},
-std::array<float,2>{0.527946949f, 0.192764819f},
-std::array<float,2>{0.968414187f, 0.542924285f},
-std::array<float,2>{0.37709409f, 0.115704186f},
-std::array<float,2>{0.246389553f, 0.831861377f},
-std::array<float,2>{0.684423089f, 0.439907968f},
-std::array<float,2>{0.506384134f, 0.984054804f},
-std::array<float,2>{0.10378959f, 0.317217171f},
-std::array<float,2>{0.29872635f, 0.693749726f},
-std::array<float,2>{0.844650686f, 0.238078162f},
-std::array<float,2>{0.717220604f, 0.638421774f},
-std::array<float,2>{0.158587426f, 0.167101488f},
-std::array<float,2>{0.455255151f, 0.887513876f},
-std::array<float,2>{0.919959664f, 0.309061497f},
-std::array<float,2>{0.797189176f, 0.801268458f},
-std::array<float,2>{0.352560669f, 0.428935915f},
-std::array<float,2>{0.0316243954f, 0.567718625f},
-std::array<float,2>{0.575367033f, 0.0256854296f},
-std::array<float,2>{0.82441783f, 0.729777396f},
-std::array<float,2>{0.252933532f, 0.213832572f},
-std::array<float,2>{0.0682487637f, 0.939056814f},
-std::array<float,2>{0.555343688f, 0.349180222f},
-std::array<float,2>{0.635326445f, 0.870186925f},
-std::array<float,2>{0.217741713f, 0.48619172f},
-std::array<float,2>{0.428583205f, 0.502365232f},
-std::array<float,2>{0.994005561f, 0.0761248767f},
-std::array<float,2>{0.596885979f, 0.61301738f},
-std::array<float,2>{0.0246856213f, 0.0377354063f},
-std::array<float,2>{0.320074886f, 0.761464f},
-std::array<float,2>{0.76299578f, 0.378651649f},
-std::array<float,2>{0.89397651f, 0.911966264f},
-std::array<float,2>{0.475677848f, 0.255081713f},
-std::array<float,2>{0.138089851f, 0.683147073f},
-std::array<float,2>{0.735583484f, 0.133773401f},
-std::array<float,2>{0.858064175f, 0.511219025f},
-std::array<float,2>{0.309865892f, 0.0626127645f},
-std::array<float,2>{0.0984969065f, 0.861979663f},
-std::array<float,2>{0.511931777f, 0.492457747f},
-std::array<float,2>{0.678513527f, 0.949829578f},
-std::array<float,2>{0.239035949f, 0.354097158f},
-std::array<float,2>{0.386227846f, 0.723712564f},
-std::array<float,2>{0.955213726f, 0.205162436f},
-std::array<float,2>{0.566258371f, 0.67622f},
-std::array<float,2>{0.0411485955f, 0.130284145f},
-std::array<float,2>{0.344665259f, 0.915490627f},
-std::array<float,2>{0.81069833f, 0.261089325f},
-std::array<float,2>{0.908895135f, 0.750062585f},
-std::array<float,2>{0.465202361f, 0.389808387f},
-std::array<float,2>{0.165380701f, 0.617565811f},
-std::array<float,2>{0.708919346f, 0.0393295363f},
-std::array<float,2>{0.98810041f, 0.701069593f},
-std::array<float,2>{0.430535674f, 0.244297549f},
-std::array<float,2>{0.204287097f, 0.969574928f},
-std::array<float,2>{0.626000404f, 0.325315237f},
-std::array<float,2>{0.55027163f, 0.841372788f},
-std::array<float,2>{0.0754102543f, 0.449065417f},
-std::array<float,2>{0.262775362f, 0.538554907f},
-std::array<float,2>{0.814353108f, 0.124266393f},
-std::array<float,2>{0.749412477f, 0.570814312f},
-std::array<float,2>{0.130416721f, 0.0195756182f},
-std::array<float,2>{0.478917301f, 0.805429399f},
-std::array<float,2>{0.902703822f, 0.431784898f},
-std::array<float,2>{0.753211796f, 0.877760768f},
-std::array<float,2>{0.326181889f, 0.302781969f},
-std::array<float,2>{0.0202050228f, 0.625891447f},
-std::array<float,2>{0.605831265f, 0.160344005f},
-std::array<float,2>{0.878946185f, 0.596761405f},
-std::array<float,2>{0.49257049f, 0.0617913119f},
-std::array<float,2>{0.152447909f, 0.771172941f},
-std::array<float,2>{0.72567755f, 0.398871452f},
-std::array<float,2>{0.623439431f, 0.924024165f},
-std::array<float,2>{0.0081798723f, 0.275895685f},
-std::array<float,2>{0.333001792f, 0.665925562f},
-std::array<float,2>{0.774407327f, 0.155796528f},
-std::array<float,2>{0.642490566f, 0.741698444f},
-std::array<float,2>{0.191004828f, 0.198182777f},
-std::array<float,2>{0.409415245f, 0.959956527f},
-std::array<float,2>{0.973457456f, 0.374438018f},
-std::array<float,2>{0.836821735f, 0.85570097f},
-std::array<float,2>{0.272550881f, 0.476771444f},
-std::array<float,2>{0.0840287134f, 0.530870974f},
-std::array<float,2>{0.534453332f, 0.0834734887f},
-std::array<float,2>{0.782810986f, 0.647747159f},
-std::array<float,2>{0.363157898f, 0.175877929f},
-std::array<float,2>{0.0546003953f, 0.891877174f},
-std::array<float,2>{0.581373632f, 0.293165535f},
-std::array<float,2>{0.696618497f, 0.782110333f},
-std::array<float,2>{0.183733702f, 0.416015893f},
-std::array<float,2>{0.448065192f, 0.591439962f},
-std::array<float,2>{0.933513224f, 0.0107902288f},
-std::array<float,2>{0.51712364f, 0.560227156f},
-std::array<float,2>{0.116921872f, 0.103319198f},
-std::array<float,2>{0.285130918f, 0.82428205f},
-std::array<float,2>{0.861055434f, 0.468074948f},
-std::array<float,2>{0.942379892f, 0.985222399f},
-std::array<float,2>{0.391134977f, 0.331356943f},
-std::array<float,2>{0.220292896f, 0.710000873f},
-std::array<float,2>{0.670002043f, 0.225157201f},
-std::array<float,2>{0.756729007f, 0.520921826f},
-std::array<float,2>{0.322065622f, 0.0893985927f},
-std::array<float,2>{0.0194133073f, 0.844154119f},
-std::array<float,2>{0.602791607f, 0.474249095f},
-std::array<float,2>{0.745971382f, 0.96491164f},
-std::array<float,2>{0.128292829f, 0.366226882f},
-std::array<float,2>{0.483168781f, 0.748084664f},
-std::array<float,2>{0.901047528f, 0.19077982f},
-std::array<float,2>{0.551299274f, 0.662414789f},
-std::array<float,2>{0.0739116669f, 0.145358235f},
-std::array<float,2>{0.258006006f, 0.932754695f},
-std::array<float,2>{0.817924142f, 0.269452542f},
-std::array<float,2>{0.990237415f, 0.779334664f},
-std::array<float,2>{0.436166644f, 0.391798198f},
-std::array<float,2>{0.20964621f, 0.602043152f},
-std::array<float,2>{0.632533789f, 0.0479602069f},
-std::array<float,2>{0.912661612f, 0.712096572f},
-std::array<float,2>{0.461651206f, 0.228806794f},
-std::array<float,2>{0.168489471f, 0.995679915f},
-std::array<float,2>{0.705579817f, 0.340305597f},
-std::array<float,2>{0.566956818f, 0.813443422f},
-std::array<float,2>{0.0441971719f, 0.455023289f},
-std::array<float,2>{0.348421037f, 0.55190891f},
-std::array<float,2>{0.80569756f, 0.0986467451f},
-std::array<float,2>{0.672072768f, 0.584421813f},
-std::array<float,2>{0.235578969f, 0.00126451394f},
-std::array<float,2>{0.389425159f, 0.789792061f},
-std::array<float,2>{0.960606754f, 0.411046237f},
-std::array<float,2>{0.8527475f, 0.899746656f},
-std::array<float,2>{0.306619495f, 0.284803331f},
-std::array<float,2>{0.0962177143f, 0.652250886f},
-std::array<float,2>{0.509066284f, 0.18212074f},
-std::array<float,2>{0.93987155f, 0.615305781f},
-std::array<float,2>{0.394680649f, 0.0327004679f},
-std::array<float,2>{0.224085152f, 0.765277147f},
-std::array<float,2>{0.667761147f, 0.382495105f},
-std::array<float,2>{0.519617021f, 0.907792032f},
-std::array<float,2>{0.109548055f, 0.251522481f},
-std::array<float,2>{0.286848933f, 0.687440276f},
-std::array<float,2>{0.865540206f, 0.139939427f},
-std::array<float,2>{0.70103091f, 0.730921388f},
-std::array<float,2>{0.182716474f, 0.217359126f},
-std::array<float,2>{0.451977253f, 0.944843948f},
-std::array<float,2>{0.937003732f, 0.344307393f},
-std::array<float,2>{0.787050188f, 0.874811888f},
-std::array<float,2>{0.366319776f, 0.488365412f},
-std::array<float,2>{0.0492443256f, 0.50453192f},
-std::array<float,2>{0.584440947f, 0.0735965148f},
-std::array<float,2>{0.841447353f, 0.633414805f},
-std::array<float,2>{0.269511521f, 0.168413043f},
-std::array<float,2>{0.0793858841f, 0.884886265f},
-std::array<float,2>{0.535683155f, 0.308012456f},
-std::array<float,2>{0.648290157f, 0.79888463f},
-std::array<float,2>{0.194940835f, 0.425493151f},
-std::array<float,2>{0.410645247f, 0.563473403f},
-std::array<float,2>{0.970442295f, 0.0289678816f},
-std::array<float,2>{0.617404222f, 0.544472873f},
-std::array<float,2>{0.0139671108f, 0.112984464f},
-std::array<float,2>{0.328150868f, 0.835701287f},
-std::array<float,2>{0.779892623f, 0.444926381f},
-std::array<float,2>{0.87626487f, 0.9799698f},
-std::array<float,2>{0.49644658f, 0.313738316f},
-std::array<float,2>{0.149273857f, 0.690117836f},
-std::array<float,2>{0.718846142f, 0.240972728f},
-std::array<float,2>{0.873013377f, 0.57597208f},
-std::array<float,2>{0.290424645f, 0.0194666684f},
-std::array<float,2>{0.122154139f, 0.810567856f},
-std::array<float,2>{0.527301371f, 0.434813023f},
-std::array<float,2>{0.658179283f, 0.881417811f},
-std::array<float,2>{0.228365436f, 0.297322452f},
-std::array<float,2>{0.405179203f, 0.630391955f},
-std::array<float,2>{0.950296938f, 0.159807891f},
-std::array<float,2>{0.593292415f, 0.696095109f},
-std::array<float,2>{0.0605201796f, 0.248463526f},
-std::array<float,2>{0.369680762f, 0.973302007f},
-std::array<float,2>{0.793258846f, 0.320546359f},
-std::array<float,2>{0.928770423f, 0.838169158f},
-std::array<float,2>{0.44268024f, 0.452075511f},
-std::array<float,2>{0.175346985f, 0.53331244f},
-std::array<float,2>{0.688455105f, 0.120278738f},
-std::array<float,2>{0.981180072f, 0.67341423f},
-std::array<float,2>{0.417459399f, 0.128059492f},
-std::array<float,2>{0.200826481f, 0.920313001f},
-std::array<float,2>{0.650902689f, 0.265502572f},
-std::array<float,2>{0.544741392f, 0.756011963f},
-std::array<float,2>{0.0904393196f, 0.38445583f},
-std::array<float,2>{0.276069552f, 0.624687076f},
-std::array<float,2>{0.829409719f, 0.0461706854f},
-std::array<float,2>{0.732591093f, 0.51357168f},
-std::array<float,2>{0.141559258f, 0.070171982f},
-std::array<float,2>{0.485075086f, 0.864166796f},
-std::array<float,2>{0.885629892f, 0.498205006f},
-std::array<float,2>{0.768065453f, 0.945903242f},
-std::array<float,2>{0.337631524f, 0.356470853f},
-std::array<float,2>{0.0075425026f, 0.719370246f},
-std::array<float,2>{0.615904093f, 0.208224744f},
-std::array<float,2>{0.896953464f, 0.557651579f},
-std::array<float,2>{0.47162649f, 0.107754081f},
-std::array<float,2>{0.136381224f, 0.823285043f},
-std::array<float,2>{0.738533199f, 0.462206304f},
-std::array<float,2>{0.599168241f, 0.991257608f},
-std::array<float,2>{0.0312483553f, 0.335686147f},
-std::array<float,2>{0.314292312f, 0.706322551f},
-std::array<float,2>{0.75964874f, 0.219340324f},
-std::array<float,2>{0.637130678f, 0.642143369f},
-std::array<float,2>{0.21128422f, 0.172145188f},
-std::array<float,2>{0.425666988f, 0.895568669f},
-std::array<float,2>{0.997684419f, 0.292796463f},
-std::array<float,2>{0.823394239f, 0.785733223f},
-std::array<float,2>{0.255751967f, 0.420329094f},
-std::array<float,2>{0.0648794025f, 0.589154661f},
-std::array<float,2>{0.562450945f, 0.0127436537f},
-std::array<float,2>{0.802751124f, 0.734674335f},
-std::array<float,2>{0.359318554f, 0.202132821f},
-std::array<float,2>{0.0377717838f, 0.954373121f},
-std::array<float,2>{0.572103024f, 0.370060205f},
-std::array<float,2>{0.714606881f, 0.852969646f},
-std::array<float,2>{0.161593407f, 0.483330339f},
-std::array<float,2>{0.459348351f, 0.526530027f},
-std::array<float,2>{0.91654861f, 0.080035679f},
-std::array<float,2>{0.50089556f, 0.601189733f},
-std::array<float,2>{0.108936086f, 0.0577707775f},
-std::array<float,2>{0.304226756f, 0.767755747f},
-std::array<float,2>{0.850116253f, 0.403928787f},
-std::array<float,2>{0.96343118f, 0.928346574f},
-std::array<float,2>{0.381061524f, 0.279489636f},
-std::array<float,2>{0.244854629f, 0.669025302f},
-std::array<float,2>{0.680619001f, 0.149441391f},
-std::array<float,2>{0.792381763f, 0.606678367f},
-std::array<float,2>{0.374535322f, 0.0508112311f},
-std::array<float,2>{0.0564543344f, 0.774811745f},
-std::array<float,2>{0.589295745f, 0.396744639f},
-std::array<float,2>{0.693283021f, 0.936879337f},
-std::array<float,2>{0.177651301f, 0.271261573f},
-std::array<float,2>{0.438971996f, 0.657213032f},
-std::array<float,2>{0.924521565f, 0.14387162f},
-std::array<float,2>{0.530411601f, 0.742793918f},
-std::array<float,2>{0.117666267f, 0.193639651f},
-std::array<float,2>{0.293242216f, 0.963613868f},
-std::array<float,2>{0.868350148f, 0.360140741f},
-std::array<float,2>{0.948607147f, 0.850750446f},
-std::array<float,2>{0.400182962f, 0.468758136f},
-std::array<float,2>{0.230834052f, 0.516441047f},
-std::array<float,2>{0.66077143f, 0.0925719142f},
-std::array<float,2>{0.886921048f, 0.655630469f},
-std::array<float,2>{0.490754038f, 0.184718251f},
-std::array<float,2>{0.145795837f, 0.903454661f},
-std::array<float,2>{0.729947567f, 0.288342208f},
-std::array<float,2>{0.61021179f, 0.794569254f},
-std::array<float,2>{0.00285954424f, 0.40939799f},
-std::array<float,2>{0.341796368f, 0.580520809f},
-std::array<float,2>{0.772411585f, 0.00408707606f},
-std::array<float,2>{0.654181123f, 0.548364043f},
-std::array<float,2>{0.197068736f, 0.0965554863f},
-std::array<float,2>{0.419476777f, 0.818351626f},
-std::array<float,2>{0.979161799f, 0.460478455f},
-std::array<float,2>{0.83318311f, 0.99617517f},
-std::array<float,2>{0.277792096f, 0.337450594f},
-std::array<float,2>{0.0889573172f, 0.718712747f},
-std::array<float,2>{0.542821705f, 0.231760606f},
-std::array<float,2>{0.995523751f, 0.500625014f},
-std::array<float,2>{0.4270446f, 0.0774699226f},
-std::array<float,2>{0.215182692f, 0.867604256f},
-std::array<float,2>{0.6341241f, 0.486886591f},
-std::array<float,2>{0.557804942f, 0.940713465f},
-std::array<float,2>{0.0694106296f, 0.351003021f},
-std::array<float,2>{0.250602305f, 0.726931453f},
-std::array<float,2>{0.826633215f, 0.212874666f},
-std::array<float,2>{0.73729527f, 0.680787146f},
-std::array<float,2>{0.138803318f, 0.136068955f},
-std::array<float,2>{0.473436177f, 0.913965344f},
-std::array<float,2>{0.892402828f, 0.256808758f},
-std::array<float,2>{0.764183521f, 0.759643316f},
-std::array<float,2>{0.317304611f, 0.37562114f},
-std::array<float,2>{0.0257023834f, 0.609971583f},
-std::array<float,2>{0.595187545f, 0.0359074511f},
-std::array<float,2>{0.846637666f, 0.691499531f},
-std::array<float,2>{0.300184935f, 0.235974148f},
-std::array<float,2>{0.102898791f, 0.982098937f},
-std::array<float,2>{0.505246162f, 0.31898734f},
-std::array<float,2>{0.686184108f, 0.829445779f},
-std::array<float,2>{0.24995473f, 0.438095421f},
-std::array<float,2>{0.376120359f, 0.539673924f},
-std::array<float,2>{0.965507388f, 0.114981316f},
-std::array<float,2>{0.577579677f, 0.569613159f},
-std::array<float,2>{0.0347717628f, 0.024372166f},
-std::array<float,2>{0.354441136f, 0.803879976f},
-std::array<float,2>{0.798940718f, 0.427651852f},
-std::array<float,2>{0.91838032f, 0.889994025f},
-std::array<float,2>{0.453977793f, 0.311589509f},
-std::array<float,2>{0.157309771f, 0.639548719f},
-std::array<float,2>{0.715077877f, 0.164237708f},
-std::array<float,2>{0.816194475f, 0.535969913f},
-std::array<float,2>{0.264539659f, 0.12122418f},
-std::array<float,2>{0.0762216076f, 0.843108833f},
-std::array<float,2>{0.547573328f, 0.446863711f},
-std::array<float,2>{0.628309906f, 0.972008049f},
-std::array<float,2>{0.206845775f, 0.327097595f},
-std::array<float,2>{0.432510823f, 0.701278031f},
-std::array<float,2>{0.985789537f, 0.243673488f},
-std::array<float,2>{0.607802987f, 0.627868474f},
-std::array<float,2>{0.0221234802f, 0.164051548f},
-std::array<float,2>{0.325360984f, 0.875469923f},
-std::array<float,2>{0.750656128f, 0.302715927f},
-std::array<float,2>{0.904360235f, 0.808000982f},
-std::array<float,2>{0.477195233f, 0.430184811f},
-std::array<float,2>{0.130867302f, 0.573846042f},
-std::array<float,2>{0.74786377f, 0.0216305871f},
-std::array<float,2>{0.953520298f, 0.726125538f},
-std::array<float,2>{0.383840561f, 0.203575f},
-std::array<float,2>{0.240981504f, 0.952216566f},
-std::array<float,2>{0.677265227f, 0.351692557f},
-std::array<float,2>{0.514455259f, 0.85957408f},
-std::array<float,2>{0.100307308f, 0.494859457f},
-std::array<float,2>{0.311065406f, 0.508345187f},
-std::array<float,2>{0.855921805f, 0.0657770038f},
-std::array<float,2>{0.710247457f, 0.62008816f},
-std::array<float,2>{0.166989595f, 0.0420275442f},
-std::array<float,2>{0.468068272f, 0.753895283f},
-std::array<float,2>{0.906968832f, 0.38797012f},
-std::array<float,2>{0.810229063f, 0.917718053f},
-std::array<float,2>{0.346821368f, 0.259271741f},
-std::array<float,2>{0.0398167744f, 0.678921163f},
-std::array<float,2>{0.562843859f, 0.130986154f},
-std::array<float,2>{0.930731177f, 0.593704402f},
-std::array<float,2>{0.445444286f, 0.00798512716f},
-std::array<float,2>{0.187230855f, 0.784852505f},
-std::array<float,2>{0.698009968f, 0.414977491f},
-std::array<float,2>{0.578501344f, 0.892579913f},
-std::array<float,2>{0.0516096652f, 0.296670616f},
-std::array<float,2>{0.359801292f, 0.645076513f},
-std::array<float,2>{0.784184754f, 0.179600775f},
-std::array<float,2>{0.669901013f, 0.708859265f},
-std::array<float,2>{0.221521601f, 0.22379981f},
-std::array<float,2>{0.393259227f, 0.986882508f},
-std::array<float,2>{0.944978595f, 0.328176498f},
-std::array<float,2>{0.862993121f, 0.826502562f},
-std::array<float,2>{0.282108963f, 0.464912325f},
-std::array<float,2>{0.113445602f, 0.561090529f},
-std::array<float,2>{0.518624544f, 0.10486877f},
-std::array<float,2>{0.777341485f, 0.666400492f},
-std::array<float,2>{0.334400713f, 0.153629437f},
-std::array<float,2>{0.0114121111f, 0.922714293f},
-std::array<float,2>{0.622506142f, 0.274578452f},
-std::array<float,2>{0.724566817f, 0.773383915f},
-std::array<float,2>{0.155136943f, 0.401076287f},
-std::array<float,2>{0.494824439f, 0.595441043f},
-std::array<float,2>{0.882321775f, 0.0603933334f},
-std::array<float,2>{0.532808244f, 0.527620375f},
-std::array<float,2>{0.0833440796f, 0.0857128724f},
-std::array<float,2>{0.27041325f, 0.858207881f},
-std::array<float,2>{0.837994874f, 0.478625804f},
-std::array<float,2>{0.975562572f, 0.957403421f},
-std::array<float,2>{0.407260507f, 0.371730566f},
-std::array<float,2>{0.188293591f, 0.740099549f},
-std::array<float,2>{0.643440604f, 0.195604905f},
-std::array<float,2>{0.80168891f, 0.527288854f},
-std::array<float,2>{0.355644792f, 0.0794803649f},
-std::array<float,2>{0.0360656194f, 0.853309095f},
-std::array<float,2>{0.57398963f, 0.482599646f},
-std::array<float,2>{0.712704062f, 0.954765141f},
-std::array<float,2>{0.162969336f, 0.369244099f},
-std::array<float,2>{0.457842827f, 0.734953821f},
-std::array<float,2>{0.915383518f, 0.201198786f},
-std::array<float,2>{0.502534211f, 0.669696867f},
-std::array<float,2>{0.1072824f, 0.150312141f},
-std::array<float,2>{0.300868094f, 0.928220212f},
-std::array<float,2>{0.84879142f, 0.280119866f},
-std::array<float,2>{0.962332487f, 0.768322647f},
-std::array<float,2>{0.379764318f, 0.403384089f},
-std::array<float,2>{0.242369831f, 0.600762963f},
-std::array<float,2>{0.682510912f, 0.0584320202f},
-std::array<float,2>{0.895449996f, 0.706797361f},
-std::array<float,2>{0.470315278f, 0.219211355f},
-std::array<float,2>{0.134289384f, 0.992151797f},
-std::array<float,2>{0.740280271f, 0.335320175f},
-std::array<float,2>{0.60153538f, 0.824066281f},
-std::array<float,2>{0.0274218973f, 0.462866843f},
-std::array<float,2>{0.314794838f, 0.558324158f},
-std::array<float,2>{0.761413097f, 0.108282141f},
-std::array<float,2>{0.640286922f, 0.589428484f},
-std::array<float,2>{0.214184865f, 0.013364926f},
-std::array<float,2>{0.423250705f, 0.78515631f},
-std::array<float,2>{0.999328613f, 0.420795947f},
-std::array<float,2>{0.822088718f, 0.896338761f},
-std::array<float,2>{0.256831765f, 0.29199627f},
-std::array<float,2>{0.0642675608f, 0.641710877f},
-std::array<float,2>{0.559012294f, 0.172565043f},
-std::array<float,2>{0.982563019f, 0.624024928f},
-std::array<float,2>{0.415887624f, 0.0464795977f},
-std::array<float,2>{0.201987207f, 0.756510615f},
-std::array<float,2>{0.648804843f, 0.383990467f},
-std::array<float,2>{0.544942379f, 0.920440376f},
-std::array<float,2>{0.0919066668f, 0.264727175f},
-std::array<float,2>{0.274557531f, 0.673138082f},
-std::array<float,2>{0.832008421f, 0.128476158f},
-std::array<float,2>{0.732209504f, 0.719111085f},
-std::array<float,2>{0.142648786f, 0.208924979f},
-std::array<float,2>{0.488138199f, 0.945316911f},
-std::array<float,2>{0.883189857f, 0.356966048f},
-std::array<float,2>{0.7666803f, 0.863425553f},
-std::array<float,2>{0.337951452f, 0.498999298f},
-std::array<float,2>{0.0055528502f, 0.512935102f},
-std::array<float,2>{0.614017248f, 0.0696282685f},
-std::array<float,2>{0.87495321f, 0.630294681f},
-std::array<float,2>{0.291459084f, 0.159371853f},
-std::array<float,2>{0.124845348f, 0.881190121f},
-std::array<float,2>{0.52498579f, 0.297416508f},
-std::array<float,2>{0.658327401f, 0.811468005f},
-std::array<float,2>{0.229891106f, 0.435208261f},
-std::array<float,2>{0.402843207f, 0.575561464f},
-std::array<float,2>{0.952708066f, 0.0189266372f},
-std::array<float,2>{0.591534555f, 0.533704996f},
-std::array<float,2>{0.0624954253f, 0.120715939f},
-std::array<float,2>{0.368224829f, 0.838769317f},
-std::array<float,2>{0.79682225f, 0.451413304f},
-std::array<float,2>{0.92682004f, 0.972929955f},
-std::array<float,2>{0.443864197f, 0.32109791f},
-std::array<float,2>{0.173139364f, 0.695684075f},
-std::array<float,2>{0.689867437f, 0.248665959f},
-std::array<float,2>{0.842480838f, 0.562581301f},
-std::array<float,2>{0.26579079f, 0.0286767799f},
-std::array<float,2>{0.081731908f, 0.799721301f},
-std::array<float,2>{0.537380278f, 0.425271839f},
-std::array<float,2>{0.644946635f, 0.885296106f},
-std::array<float,2>{0.191522762f, 0.308315277f},
-std::array<float,2>{0.412936389f, 0.633135259f},
-std::array<float,2>{0.971341431f, 0.168604314f},
-std::array<float,2>{0.61975503f, 0.689806819f},
-std::array<float,2>{0.0121785728f, 0.240300402f},
-std::array<float,2>{0.330739915f, 0.980072558f},
-std::array<float,2>{0.777365446f, 0.314315557f},
-std::array<float,2>{0.877167404f, 0.835425436f},
-std::array<float,2>{0.499576837f, 0.444442838f},
-std::array<float,2>{0.151553318f, 0.544069767f},
-std::array<float,2>{0.722118556f, 0.112643152f},
-std::array<float,2>{0.937995672f, 0.686905265f},
-std::array<float,2>{0.396973193f, 0.140205801f},
-std::array<float,2>{0.226198882f, 0.907548845f},
-std::array<float,2>{0.664792836f, 0.251302779f},
-std::array<float,2>{0.523124397f, 0.765006661f},
-std::array<float,2>{0.112186074f, 0.382185698f},
-std::array<float,2>{0.288699597f, 0.615991831f},
-std::array<float,2>{0.864628613f, 0.0329926684f},
-std::array<float,2>{0.70221132f, 0.50404644f},
-std::array<float,2>{0.181426138f, 0.073826842f},
-std::array<float,2>{0.450148076f, 0.874244988f},
-std::array<float,2>{0.93537122f, 0.488901585f},
-std::array<float,2>{0.788710356f, 0.944688141f},
-std::array<float,2>{0.364813596f, 0.344013751f},
-std::array<float,2>{0.048456423f, 0.73142463f},
-std::array<float,2>{0.582624197f, 0.216978565f},
-std::array<float,2>{0.911371052f, 0.552252054f},
-std::array<float,2>{0.464478016f, 0.0993219763f},
-std::array<float,2>{0.171741992f, 0.812500894f},
-std::array<float,2>{0.704472363f, 0.454539478f},
-std::array<float,2>{0.570231497f, 0.995160818f},
-std::array<float,2>{0.0465753414f, 0.340686321f},
-std::array<float,2>{0.350552559f, 0.712443352f},
-std::array<float,2>{0.808522224f, 0.229109064f},
-std::array<float,2>{0.674720705f, 0.651744127f},
-std::array<float,2>{0.238070443f, 0.182277426f},
-std::array<float,2>{0.387582928f, 0.900037467f},
-std::array<float,2>{0.957934022f, 0.284428388f},
-std::array<float,2>{0.853915751f, 0.789264977f},
-std::array<float,2>{0.307895452f, 0.410166532f},
-std::array<float,2>{0.0956018418f, 0.58448565f},
-std::array<float,2>{0.51028347f, 0.00193192647f},
-std::array<float,2>{0.755443633f, 0.748938739f},
-std::array<float,2>{0.322420657f, 0.191251397f},
-std::array<float,2>{0.0167952999f, 0.965652823f},
-std::array<float,2>{0.60466826f, 0.366768032f},
-std::array<float,2>{0.743839562f, 0.844380677f},
-std::array<float,2>{0.126061141f, 0.473955095f},
-std::array<float,2>{0.480888128f, 0.521396697f},
-std::array<float,2>{0.900060952f, 0.0891994238f},
-std::array<float,2>{0.553817749f, 0.60244894f},
-std::array<float,2>{0.0721221268f, 0.0484622531f},
-std::array<float,2>{0.261189133f, 0.780147374f},
-std::array<float,2>{0.8197155f, 0.392554104f},
-std::array<float,2>{0.988311291f, 0.933461905f},
-std::array<float,2>{0.435327113f, 0.268666297f},
-std::array<float,2>{0.208109587f, 0.66261971f},
-std::array<float,2>{0.628961384f, 0.144585907f},
-std::array<float,2>{0.773783326f, 0.594771743f},
-std::array<float,2>{0.332151443f, 0.059655007f},
-std::array<float,2>{0.00834012777f, 0.772848129f},
-std::array<float,2>{0.623775244f, 0.400751114f},
-std::array<float,2>{0.726557732f, 0.922099113f},
-std::array<float,2>{0.152843684f, 0.27523315f},
-std::array<float,2>{0.492696762f, 0.66657728f},
-std::array<float,2>{0.879667938f, 0.154135004f},
-std::array<float,2>{0.535064578f, 0.73955375f},
-std::array<float,2>{0.0847610161f, 0.195914f},
-std::array<float,2>{0.27325666f, 0.957655132f},
-std::array<float,2>{0.836392939f, 0.371231258f},
-std::array<float,2>{0.973021805f, 0.857727647f},
-std::array<float,2>{0.409942955f, 0.479275107f},
-std::array<float,2>{0.190781251f, 0.528006673f},
-std::array<float,2>{0.64190048f, 0.0853573084f},
-std::array<float,2>{0.932770729f, 0.644886911f},
-std::array<float,2>{0.447515011f, 0.178742692f},
-std::array<float,2>{0.184140235f, 0.893541455f},
-std::array<float,2>{0.697210252f, 0.296167821f},
-std::array<float,2>{0.58197844f, 0.784213305f},
-std::array<float,2>{0.0539231189f, 0.414248109f},
-std::array<float,2>{0.362364233f, 0.592784286f},
-std::array<float,2>{0.782327414f, 0.00847645197f},
-std::array<float,2>{0.670449972f, 0.560691714f},
-std::array<float,2>{0.219733417f, 0.105015717f},
-std::array<float,2>{0.390628308f, 0.82668072f},
-std::array<float,2>{0.941528022f, 0.465668768f},
-std::array<float,2>{0.860595167f, 0.986596465f},
-std::array<float,2>{0.284451932f, 0.328970671f},
-std::array<float,2>{0.116597086f, 0.708239734f},
-std::array<float,2>{0.517052829f, 0.224139139f},
-std::array<float,2>{0.95591259f, 0.507975101f},
-std::array<float,2>{0.386651963f, 0.0659421384f},
-std::array<float,2>{0.238351986f, 0.860335588f},
-std::array<float,2>{0.678197384f, 0.494390041f},
-std::array<float,2>{0.512663484f, 0.952902496f},
-std::array<float,2>{0.0981368273f, 0.352516592f},
-std::array<float,2>{0.310296983f, 0.725613594f},
-std::array<float,2>{0.857795f, 0.203852147f},
-std::array<float,2>{0.708170533f, 0.679343522f},
-std::array<float,2>{0.165591314f, 0.131514996f},
-std::array<float,2>{0.465509892f, 0.9172346f},
-std::array<float,2>{0.908348799f, 0.259340674f},
-std::array<float,2>{0.811349988f, 0.753395796f},
-std::array<float,2>{0.343921304f, 0.388337612f},
-std::array<float,2>{0.0419568047f, 0.619362473f},
-std::array<float,2>{0.565480471f, 0.0429216027f},
-std::array<float,2>{0.813733757f, 0.70197022f},
-std::array<float,2>{0.263428301f, 0.243450701f},
-std::array<float,2>{0.0757459626f, 0.972630858f},
-std::array<float,2>{0.550503314f, 0.326598287f},
-std::array<float,2>{0.626929522f, 0.843523204f},
-std::array<float,2>{0.205069721f, 0.446708649f},
-std::array<float,2>{0.429845452f, 0.535260379f},
-std::array<float,2>{0.98773241f, 0.121861257f},
-std::array<float,2>{0.606333494f, 0.573595405f},
-std::array<float,2>{0.0197699834f, 0.0221527275f},
-std::array<float,2>{0.327037305f, 0.808521569f},
-std::array<float,2>{0.753699839f, 0.430142939f},
-std::array<float,2>{0.90291661f, 0.875703633f},
-std::array<float,2>{0.479212224f, 0.30218485f},
-std::array<float,2>{0.130248412f, 0.627389669f},
-std::array<float,2>{0.749645233f, 0.163121402f},
-std::array<float,2>{0.843751013f, 0.539382577f},
-std::array<float,2>{0.298157603f, 0.11468672f},
-std::array<float,2>{0.104458392f, 0.829757035f},
-std::array<float,2>{0.50600332f, 0.437905371f},
-std::array<float,2>{0.683737993f, 0.981923699f},
-std::array<float,2>{0.246788651f, 0.318561852f},
-std::array<float,2>{0.377538621f, 0.692352176f},
-std::array<float,2>{0.967805207f, 0.235543624f},
-std::array<float,2>{0.575980961f, 0.638951361f},
-std::array<float,2>{0.0319320969f, 0.164873347f},
-std::array<float,2>{0.353189826f, 0.890363455f},
-std::array<float,2>{0.797434926f, 0.312368244f},
-std::array<float,2>{0.920505106f, 0.804208755f},
-std::array<float,2>{0.455918759f, 0.42687574f},
-std::array<float,2>{0.158888608f, 0.570149839f},
-std::array<float,2>{0.717436433f, 0.0237868298f},
-std::array<float,2>{0.993304551f, 0.727477074f},
-std::array<float,2>{0.428188801f, 0.212207273f},
-std::array<float,2>{0.217139795f, 0.940936208f},
-std::array<float,2>{0.634986162f, 0.351405174f},
-std::array<float,2>{0.555070519f, 0.867899656f},
-std::array<float,2>{0.0676207617f, 0.486460119f},
-std::array<float,2>{0.253715277f, 0.500457406f},
-std::array<float,2>{0.82503444f, 0.0777102485f},
-std::array<float,2>{0.735992432f, 0.609745681f},
-std::array<float,2>{0.138525441f, 0.035386242f},
-std::array<float,2>{0.476332098f, 0.758796215f},
-std::array<float,2>{0.894236982f, 0.375439107f},
-std::array<float,2>{0.763302147f, 0.913387299f},
-std::array<float,2>{0.319485843f, 0.256184012f},
-std::array<float,2>{0.0249698758f, 0.681292474f},
-std::array<float,2>{0.597285092f, 0.136542574f},
-std::array<float,2>{0.889699459f, 0.580677688f},
-std::array<float,2>{0.489473671f, 0.00472715544f},
-std::array<float,2>{0.14688541f, 0.794321716f},
-std::array<float,2>{0.726947904f, 0.409757048f},
-std::array<float,2>{0.611527562f, 0.903919637f},
-std::array<float,2>{0.000303973153f, 0.288812608f},
-std::array<float,2>{0.342761815f, 0.656146288f},
-std::array<float,2>{0.770806849f, 0.18516475f},
-std::array<float,2>{0.656192839f, 0.717887878f},
-std::array<float,2>{0.197519645f, 0.23218435f},
-std::array<float,2>{0.421359241f, 0.996734381f},
-std::array<float,2>{0.977551818f, 0.336957425f},
-std::array<float,2>{0.834850848f, 0.817783356f},
-std::array<float,2>{0.28026247f, 0.460363388f},
-std::array<float,2>{0.0869351253f, 0.548167288f},
-std::array<float,2>{0.539860785f, 0.0958381146f},
-std::array<float,2>{0.790450692f, 0.656607151f},
-std::array<float,2>{0.372434825f, 0.144083917f},
-std::array<float,2>{0.0569185503f, 0.937331259f},
-std::array<float,2>{0.587415338f, 0.270655394f},
-std::array<float,2>{0.693796754f, 0.775257051f},
-std::array<float,2>{0.178526461f, 0.39715749f},
-std::array<float,2>{0.440897137f, 0.606996357f},
-std::array<float,2>{0.922890365f, 0.0516917482f},
-std::array<float,2>{0.527513325f, 0.515686154f},
-std::array<float,2>{0.119253047f, 0.0921958983f},
-std::array<float,2>{0.295661509f, 0.85135603f},
-std::array<float,2>{0.869310021f, 0.469357669f},
-std::array<float,2>{0.946260452f, 0.963336468f},
-std::array<float,2>{0.401291609f, 0.359687358f},
-std::array<float,2>{0.233958781f, 0.742656708f},
-std::array<float,2>{0.662325978f, 0.194231346f},
-std::array<float,2>{0.759026825f, 0.554929435f},
-std::array<float,2>{0.313825369f, 0.106752172f},
-std::array<float,2>{0.0303843748f, 0.821308613f},
-std::array<float,2>{0.598768294f, 0.46408838f},
-std::array<float,2>{0.738776803f, 0.989246905f},
-std::array<float,2>{0.136042103f, 0.333520025f},
-std::array<float,2>{0.471001267f, 0.703853309f},
-std::array<float,2>{0.897341907f, 0.222406626f},
-std::array<float,2>{0.561532557f, 0.642600238f},
-std::array<float,2>{0.0651213378f, 0.175152019f},
-std::array<float,2>{0.255038679f, 0.897153556f},
-std::array<float,2>{0.824103594f, 0.289607555f},
-std::array<float,2>{0.997485757f, 0.787256598f},
-std::array<float,2>{0.425141901f, 0.419737101f},
-std::array<float,2>{0.211457089f, 0.586327314f},
-std::array<float,2>{0.637444794f, 0.0151726045f},
-std::array<float,2>{0.91631788f, 0.737732887f},
-std::array<float,2>{0.459801435f, 0.200434536f},
-std::array<float,2>{0.161974862f, 0.956926703f},
-std::array<float,2>{0.714220166f, 0.368998617f},
-std::array<float,2>{0.571769893f, 0.853538692f},
-std::array<float,2>{0.0372976027f, 0.482345134f},
-std::array<float,2>{0.358820885f, 0.524615645f},
-std::array<float,2>{0.803390205f, 0.0811021626f},
-std::array<float,2>{0.679959297f, 0.598944902f},
-std::array<float,2>{0.244150758f, 0.055755768f},
-std::array<float,2>{0.381511658f, 0.766417921f},
-std::array<float,2>{0.962899983f, 0.406116217f},
-std::array<float,2>{0.849913061f, 0.9277215f},
-std::array<float,2>{0.303784817f, 0.277929902f},
-std::array<float,2>{0.108590372f, 0.670404732f},
-std::array<float,2>{0.500220716f, 0.150662512f},
-std::array<float,2>{0.950923026f, 0.57676214f},
-std::array<float,2>{0.404375821f, 0.0162300244f},
-std::array<float,2>{0.227604091f, 0.808710217f},
-std::array<float,2>{0.657561421f, 0.436082214f},
-std::array<float,2>{0.526393652f, 0.878947616f},
-std::array<float,2>{0.122867078f, 0.29992643f},
-std::array<float,2>{0.290639609f, 0.631268322f},
-std::array<float,2>{0.872216702f, 0.156944245f},
-std::array<float,2>{0.687614799f, 0.698085964f},
-std::array<float,2>{0.175094858f, 0.247733861f},
-std::array<float,2>{0.443148404f, 0.97545743f},
-std::array<float,2>{0.929216325f, 0.322947234f},
-std::array<float,2>{0.793730974f, 0.836992204f},
-std::array<float,2>{0.369497836f, 0.450666457f},
-std::array<float,2>{0.0596831255f, 0.531404257f},
-std::array<float,2>{0.592972577f, 0.117384568f},
-std::array<float,2>{0.829658806f, 0.674943984f},
-std::array<float,2>{0.275869846f, 0.125102922f},
-std::array<float,2>{0.0900087282f, 0.917990744f},
-std::array<float,2>{0.544022501f, 0.263274372f},
-std::array<float,2>{0.650817692f, 0.755692065f},
-std::array<float,2>{0.200591922f, 0.38493821f},
-std::array<float,2>{0.417679191f, 0.621157825f},
-std::array<float,2>{0.980528176f, 0.0434435494f},
-std::array<float,2>{0.615639865f, 0.514283657f},
-std::array<float,2>{0.00696211215f, 0.067757763f},
-std::array<float,2>{0.337062508f, 0.865252793f},
-std::array<float,2>{0.768342435f, 0.496679068f},
-std::array<float,2>{0.885137141f, 0.947715759f},
-std::array<float,2>{0.484814405f, 0.357754081f},
-std::array<float,2>{0.141065761f, 0.721615553f},
-std::array<float,2>{0.733377993f, 0.209268749f},
-std::array<float,2>{0.866121352f, 0.613764524f},
-std::array<float,2>{0.28660959f, 0.0340152532f},
-std::array<float,2>{0.110258304f, 0.763246715f},
-std::array<float,2>{0.520294011f, 0.379978985f},
-std::array<float,2>{0.667372406f, 0.908334613f},
-std::array<float,2>{0.224261388f, 0.25251022f},
-std::array<float,2>{0.395284712f, 0.684771121f},
-std::array<float,2>{0.940252721f, 0.136927262f},
-std::array<float,2>{0.584785998f, 0.73404485f},
-std::array<float,2>{0.0497549325f, 0.214952931f},
-std::array<float,2>{0.366943479f, 0.941490352f},
-std::array<float,2>{0.786219001f, 0.347573012f},
-std::array<float,2>{0.937307954f, 0.872359335f},
-std::array<float,2>{0.451266706f, 0.491487145f},
-std::array<float,2>{0.183152348f, 0.507148504f},
-std::array<float,2>{0.700242102f, 0.0709384009f},
-std::array<float,2>{0.970130026f, 0.635265052f},
-std::array<float,2>{0.410275459f, 0.170303717f},
-std::array<float,2>{0.194767445f, 0.883628309f},
-std::array<float,2>{0.647913814f, 0.306329906f},
-std::array<float,2>{0.535538375f, 0.797090411f},
-std::array<float,2>{0.0796559304f, 0.422707856f},
-std::array<float,2>{0.268928826f, 0.566279531f},
-std::array<float,2>{0.840962827f, 0.0310008246f},
-std::array<float,2>{0.719477654f, 0.545366883f},
-std::array<float,2>{0.148638755f, 0.109594315f},
-std::array<float,2>{0.496680796f, 0.832934856f},
-std::array<float,2>{0.876914799f, 0.442758232f},
-std::array<float,2>{0.779478073f, 0.978102386f},
-std::array<float,2>{0.328632265f, 0.314963579f},
-std::array<float,2>{0.0142066544f, 0.688212514f},
-std::array<float,2>{0.618012369f, 0.240210503f},
-std::array<float,2>{0.900591254f, 0.522221804f},
-std::array<float,2>{0.48284626f, 0.0872392431f},
-std::array<float,2>{0.128660694f, 0.847044587f},
-std::array<float,2>{0.745461822f, 0.474796802f},
-std::array<float,2>{0.60324806f, 0.968151867f},
-std::array<float,2>{0.0189167112f, 0.364446789f},
-std::array<float,2>{0.32144922f, 0.74782002f},
-std::array<float,2>{0.756189466f, 0.189448848f},
-std::array<float,2>{0.631934047f, 0.661011517f},
-std::array<float,2>{0.209094331f, 0.147996172f},
-std::array<float,2>{0.435618162f, 0.930236757f},
-std::array<float,2>{0.990913808f, 0.267334372f},
-std::array<float,2>{0.817439258f, 0.777418196f},
-std::array<float,2>{0.258375883f, 0.394397169f},
-std::array<float,2>{0.0733157694f, 0.605325341f},
-std::array<float,2>{0.551053047f, 0.0499043539f},
-std::array<float,2>{0.806427598f, 0.713733912f},
-std::array<float,2>{0.348067194f, 0.22840935f},
-std::array<float,2>{0.0447069295f, 0.993359208f},
-std::array<float,2>{0.566689968f, 0.342106551f},
-std::array<float,2>{0.705396831f, 0.814529061f},
-std::array<float,2>{0.168343261f, 0.455388695f},
-std::array<float,2>{0.461093277f, 0.55284524f},
-std::array<float,2>{0.912246406f, 0.101314552f},
-std::array<float,2>{0.50933665f, 0.582454026f},
-std::array<float,2>{0.0961372554f, 0.00259331451f},
-std::array<float,2>{0.305836409f, 0.791661382f},
-std::array<float,2>{0.853298068f, 0.412941337f},
-std::array<float,2>{0.960174322f, 0.901503563f},
-std::array<float,2>{0.388687789f, 0.282585353f},
-std::array<float,2>{0.23593007f, 0.649451613f},
-std::array<float,2>{0.672797859f, 0.179720059f},
-std::array<float,2>{0.784720182f, 0.591271698f},
-std::array<float,2>{0.360342145f, 0.0114085982f},
-std::array<float,2>{0.0508989431f, 0.781538367f},
-std::array<float,2>{0.578689277f, 0.416858703f},
-std::array<float,2>{0.697685897f, 0.892411172f},
-std::array<float,2>{0.186901972f, 0.293635428f},
-std::array<float,2>{0.446117491f, 0.648165524f},
-std::array<float,2>{0.931449831f, 0.176326424f},
-std::array<float,2>{0.519185007f, 0.710560083f},
-std::array<float,2>{0.114024214f, 0.225061595f},
-std::array<float,2>{0.281645894f, 0.98475045f},
-std::array<float,2>{0.862612545f, 0.331812471f},
-std::array<float,2>{0.944633663f, 0.825017512f},
-std::array<float,2>{0.392866343f, 0.46839565f},
-std::array<float,2>{0.220872611f, 0.559646547f},
-std::array<float,2>{0.6692276f, 0.102657333f},
-std::array<float,2>{0.882704735f, 0.665396214f},
-std::array<float,2>{0.494181186f, 0.155438319f},
-std::array<float,2>{0.154376045f, 0.924678624f},
-std::array<float,2>{0.723687589f, 0.275424927f},
-std::array<float,2>{0.622940361f, 0.770918608f},
-std::array<float,2>{0.010822569f, 0.399286151f},
-std::array<float,2>{0.334799975f, 0.597469032f},
-std::array<float,2>{0.776547253f, 0.0623738393f},
-std::array<float,2>{0.642745078f, 0.530627668f},
-std::array<float,2>{0.187795475f, 0.0839019045f},
-std::array<float,2>{0.408039063f, 0.85643661f},
-std::array<float,2>{0.974629998f, 0.477304697f},
-std::array<float,2>{0.838604212f, 0.95946306f},
-std::array<float,2>{0.269762069f, 0.374890476f},
-std::array<float,2>{0.0838933215f, 0.741731465f},
-std::array<float,2>{0.53257215f, 0.197277993f},
-std::array<float,2>{0.98624742f, 0.538831234f},
-std::array<float,2>{0.432105392f, 0.124725789f},
-std::array<float,2>{0.206388503f, 0.840848267f},
-std::array<float,2>{0.628690481f, 0.448276252f},
-std::array<float,2>{0.547209561f, 0.969178259f},
-std::array<float,2>{0.07708776f, 0.325889677f},
-std::array<float,2>{0.263973385f, 0.700347304f},
-std::array<float,2>{0.815841913f, 0.244895965f},
-std::array<float,2>{0.747147083f, 0.625459433f},
-std::array<float,2>{0.131529704f, 0.160863146f},
-std::array<float,2>{0.476655692f, 0.877214074f},
-std::array<float,2>{0.904857874f, 0.303516775f},
-std::array<float,2>{0.750258744f, 0.804870009f},
-std::array<float,2>{0.326047987f, 0.432444483f},
-std::array<float,2>{0.0216691066f, 0.57073462f},
-std::array<float,2>{0.607979119f, 0.0201213732f},
-std::array<float,2>{0.856008947f, 0.724207044f},
-std::array<float,2>{0.310561419f, 0.2056541f},
-std::array<float,2>{0.0999509767f, 0.949468076f},
-std::array<float,2>{0.514070094f, 0.353718072f},
-std::array<float,2>{0.676816463f, 0.861361802f},
-std::array<float,2>{0.240515292f, 0.493056357f},
-std::array<float,2>{0.384296715f, 0.511232615f},
-std::array<float,2>{0.953773022f, 0.0630853251f},
-std::array<float,2>{0.562989235f, 0.617749572f},
-std::array<float,2>{0.0393076688f, 0.039746426f},
-std::array<float,2>{0.347528815f, 0.750860333f},
-std::array<float,2>{0.809822023f, 0.390406907f},
-std::array<float,2>{0.906398833f, 0.915737033f},
-std::array<float,2>{0.468421698f, 0.261648893f},
-std::array<float,2>{0.166179746f, 0.676435292f},
-std::array<float,2>{0.710605204f, 0.130548894f},
-std::array<float,2>{0.827012002f, 0.502541661f},
-std::array<float,2>{0.25044778f, 0.0755077377f},
-std::array<float,2>{0.0699285865f, 0.870942533f},
-std::array<float,2>{0.558468938f, 0.485729158f},
-std::array<float,2>{0.63450706f, 0.938512146f},
-std::array<float,2>{0.215459958f, 0.349096447f},
-std::array<float,2>{0.427276075f, 0.730377972f},
-std::array<float,2>{0.995606899f, 0.21310845f},
-std::array<float,2>{0.595254064f, 0.682908118f},
-std::array<float,2>{0.0259604678f, 0.133052915f},
-std::array<float,2>{0.316692203f, 0.911367476f},
-std::array<float,2>{0.763795197f, 0.255400002f},
-std::array<float,2>{0.891844392f, 0.760837376f},
-std::array<float,2>{0.473099768f, 0.378261119f},
-std::array<float,2>{0.13944456f, 0.612365723f},
-std::array<float,2>{0.73647207f, 0.0373941101f},
-std::array<float,2>{0.965050817f, 0.694128871f},
-std::array<float,2>{0.376917213f, 0.237564445f},
-std::array<float,2>{0.249472618f, 0.983453035f},
-std::array<float,2>{0.685632825f, 0.31669715f},
-std::array<float,2>{0.505452633f, 0.831137538f},
-std::array<float,2>{0.103119202f, 0.440326422f},
-std::array<float,2>{0.300661355f, 0.542247772f},
-std::array<float,2>{0.845711768f, 0.115797959f},
-std::array<float,2>{0.715680659f, 0.567884028f},
-std::array<float,2>{0.15810436f, 0.0261309799f},
-std::array<float,2>{0.453396797f, 0.80132246f},
-std::array<float,2>{0.918934822f, 0.429418892f},
-std::array<float,2>{0.799709082f, 0.886902153f},
-std::array<float,2>{0.353788108f, 0.309354365f},
-std::array<float,2>{0.0342421606f, 0.637781322f},
-std::array<float,2>{0.577741146f, 0.167625204f},
-std::array<float,2>{0.924099207f, 0.608249128f},
-std::array<float,2>{0.438504577f, 0.0546363778f},
-std::array<float,2>{0.177017838f, 0.775792837f},
-std::array<float,2>{0.692785203f, 0.396316856f},
-std::array<float,2>{0.589591801f, 0.934585512f},
-std::array<float,2>{0.0557779782f, 0.273367465f},
-std::array<float,2>{0.374072939f, 0.658989847f},
-std::array<float,2>{0.792540491f, 0.141095817f},
-std::array<float,2>{0.660244107f, 0.745485306f},
-std::array<float,2>{0.231071204f, 0.1929162f},
-std::array<float,2>{0.399638236f, 0.961552322f},
-std::array<float,2>{0.94884032f, 0.36137265f},
-std::array<float,2>{0.868966818f, 0.848215222f},
-std::array<float,2>{0.293527126f, 0.472629935f},
-std::array<float,2>{0.118151262f, 0.517730296f},
-std::array<float,2>{0.530884743f, 0.0908885673f},
-std::array<float,2>{0.771755099f, 0.654003143f},
-std::array<float,2>{0.340865105f, 0.187452421f},
-std::array<float,2>{0.00238274224f, 0.904778659f},
-std::array<float,2>{0.609511733f, 0.286734223f},
-std::array<float,2>{0.730129421f, 0.79567492f},
-std::array<float,2>{0.146256655f, 0.406842798f},
-std::array<float,2>{0.490256071f, 0.578856707f},
-std::array<float,2>{0.887539148f, 0.00746008009f},
-std::array<float,2>{0.542018473f, 0.549708247f},
-std::array<float,2>{0.0897074416f, 0.0948033035f},
-std::array<float,2>{0.278312474f, 0.819391489f},
-std::array<float,2>{0.833898425f, 0.458508164f},
-std::array<float,2>{0.978966296f, 0.99850738f},
-std::array<float,2>{0.4191944f, 0.338391215f},
-std::array<float,2>{0.196650803f, 0.71663481f},
-std::array<float,2>{0.653633356f, 0.232896f},
-std::array<float,2>{0.795610905f, 0.533121943f},
-std::array<float,2>{0.367780745f, 0.118821844f},
-std::array<float,2>{0.0611986183f, 0.836294055f},
-std::array<float,2>{0.589960515f, 0.449783504f},
-std::array<float,2>{0.690708637f, 0.975800633f},
-std::array<float,2>{0.172207817f, 0.323802143f},
-std::array<float,2>{0.444913119f, 0.699036181f},
-std::array<float,2>{0.926487148f, 0.246954605f},
-std::array<float,2>{0.524056792f, 0.6325472f},
-std::array<float,2>{0.123352386f, 0.157428175f},
-std::array<float,2>{0.292144626f, 0.880606949f},
-std::array<float,2>{0.873533487f, 0.299593538f},
-std::array<float,2>{0.95171994f, 0.809720814f},
-std::array<float,2>{0.403439403f, 0.437469244f},
-std::array<float,2>{0.228522211f, 0.577605665f},
-std::array<float,2>{0.659226596f, 0.0166503638f},
-std::array<float,2>{0.884397149f, 0.722640812f},
-std::array<float,2>{0.486343116f, 0.209963024f},
-std::array<float,2>{0.143762022f, 0.948776603f},
-std::array<float,2>{0.730817556f, 0.35850206f},
-std::array<float,2>{0.615044951f, 0.867170036f},
-std::array<float,2>{0.00421476923f, 0.497093648f},
-std::array<float,2>{0.338935971f, 0.515128791f},
-std::array<float,2>{0.7663517f, 0.0665474609f},
-std::array<float,2>{0.649428725f, 0.622476161f},
-std::array<float,2>{0.202854991f, 0.0445035174f},
-std::array<float,2>{0.414067566f, 0.754621387f},
-std::array<float,2>{0.983911037f, 0.38632369f},
-std::array<float,2>{0.830636442f, 0.919908285f},
-std::array<float,2>{0.273448825f, 0.262067556f},
-std::array<float,2>{0.0931207389f, 0.674659491f},
-std::array<float,2>{0.546034276f, 0.126199186f},
-std::array<float,2>{0.998591721f, 0.587164998f},
-std::array<float,2>{0.422799349f, 0.0137416599f},
-std::array<float,2>{0.2134725f, 0.788742959f},
-std::array<float,2>{0.639599204f, 0.418242097f},
-std::array<float,2>{0.559692085f, 0.898346663f},
-std::array<float,2>{0.0633425564f, 0.2907435f},
-std::array<float,2>{0.25688976f, 0.644333065f},
-std::array<float,2>{0.820802689f, 0.173941001f},
-std::array<float,2>{0.742104173f, 0.704187095f},
-std::array<float,2>{0.133086249f, 0.221058831f},
-std::array<float,2>{0.469656914f, 0.989481807f},
-std::array<float,2>{0.896015942f, 0.332556218f},
-std::array<float,2>{0.760603428f, 0.820639729f},
-std::array<float,2>{0.315787345f, 0.463825703f},
-std::array<float,2>{0.0286101159f, 0.555850148f},
-std::array<float,2>{0.600231409f, 0.10638646f},
-std::array<float,2>{0.847847342f, 0.671306014f},
-std::array<float,2>{0.302382052f, 0.152140066f},
-std::array<float,2>{0.105772868f, 0.925946772f},
-std::array<float,2>{0.503706515f, 0.278430611f},
-std::array<float,2>{0.683357418f, 0.76712209f},
-std::array<float,2>{0.244134381f, 0.404457301f},
-std::array<float,2>{0.380135089f, 0.5986166f},
-std::array<float,2>{0.961086035f, 0.0555388629f},
-std::array<float,2>{0.572517097f, 0.524115145f},
-std::array<float,2>{0.0362761654f, 0.0806926116f},
-std::array<float,2>{0.35657236f, 0.855227172f},
-std::array<float,2>{0.801804423f, 0.481319726f},
-std::array<float,2>{0.914218187f, 0.955655932f},
-std::array<float,2>{0.458754987f, 0.367616236f},
-std::array<float,2>{0.163834035f, 0.73642993f},
-std::array<float,2>{0.711284518f, 0.199357122f},
-std::array<float,2>{0.818360865f, 0.604099274f},
-std::array<float,2>{0.260668755f, 0.0497696958f},
-std::array<float,2>{0.0712471604f, 0.778638065f},
-std::array<float,2>{0.552905977f, 0.393440664f},
-std::array<float,2>{0.630455613f, 0.930734754f},
-std::array<float,2>{0.207712919f, 0.266167194f},
-std::array<float,2>{0.434269756f, 0.661725402f},
-std::array<float,2>{0.990215003f, 0.146747038f},
-std::array<float,2>{0.604004383f, 0.747009158f},
-std::array<float,2>{0.0165647622f, 0.188167632f},
-std::array<float,2>{0.323841631f, 0.967701554f},
-std::array<float,2>{0.754694223f, 0.36402452f},
-std::array<float,2>{0.899313986f, 0.845753551f},
-std::array<float,2>{0.482165337f, 0.475672513f},
-std::array<float,2>{0.125460252f, 0.523098052f},
-std::array<float,2>{0.742667437f, 0.0864081755f},
-std::array<float,2>{0.958747327f, 0.648880899f},
-std::array<float,2>{0.388468027f, 0.181342646f},
-std::array<float,2>{0.236940324f, 0.900514126f},
-std::array<float,2>{0.675464034f, 0.281254917f},
-std::array<float,2>{0.51139158f, 0.792094469f},
-std::array<float,2>{0.0940828845f, 0.413950026f},
-std::array<float,2>{0.306744277f, 0.583055675f},
-std::array<float,2>{0.855151296f, 0.00363548938f},
-std::array<float,2>{0.703693926f, 0.554384768f},
-std::array<float,2>{0.170350775f, 0.0997640714f},
-std::array<float,2>{0.463676274f, 0.815609694f},
-std::array<float,2>{0.91054666f, 0.456820726f},
-std::array<float,2>{0.806974113f, 0.992461801f},
-std::array<float,2>{0.350595683f, 0.343222737f},
-std::array<float,2>{0.0453921929f, 0.714045405f},
-std::array<float,2>{0.568611562f, 0.226757437f},
-std::array<float,2>{0.934439838f, 0.506472051f},
-std::array<float,2>{0.450898618f, 0.0719388276f},
-std::array<float,2>{0.18007189f, 0.871418417f},
-std::array<float,2>{0.701613188f, 0.490957052f},
-std::array<float,2>{0.583930612f, 0.942711413f},
-std::array<float,2>{0.046931386f, 0.345962226f},
-std::array<float,2>{0.364152968f, 0.732935846f},
-std::array<float,2>{0.788013041f, 0.216325685f},
-std::array<float,2>{0.665440619f, 0.684046924f},
-std::array<float,2>{0.225522891f, 0.137867153f},
-std::array<float,2>{0.397574842f, 0.909193397f},
-std::array<float,2>{0.938509464f, 0.253523946f},
-std::array<float,2>{0.86331439f, 0.762638748f},
-std::array<float,2>{0.287631512f, 0.379124135f},
-std::array<float,2>{0.113266788f, 0.614922345f},
-std::array<float,2>{0.521706939f, 0.0348059051f},
-std::array<float,2>{0.778352916f, 0.688856661f},
-std::array<float,2>{0.331738055f, 0.238360941f},
-std::array<float,2>{0.0135855414f, 0.977032185f},
-std::array<float,2>{0.620159566f, 0.315690786f},
-std::array<float,2>{0.721048117f, 0.833610117f},
-std::array<float,2>{0.150408164f, 0.441848725f},
-std::array<float,2>{0.498616964f, 0.546316624f},
-std::array<float,2>{0.878224969f, 0.110812686f},
-std::array<float,2>{0.538449883f, 0.564871013f},
-std::array<float,2>{0.0804135576f, 0.0302087646f},
-std::array<float,2>{0.267088056f, 0.798361778f},
-std::array<float,2>{0.842873275f, 0.423499793f},
-std::array<float,2>{0.972445667f, 0.884699881f},
-std::array<float,2>{0.413674414f, 0.304948628f},
-std::array<float,2>{0.192468137f, 0.635757327f},
-std::array<float,2>{0.64626497f, 0.171505794f},
-std::array<float,2>{0.752502143f, 0.571694672f},
-std::array<float,2>{0.327805817f, 0.0214561671f},
-std::array<float,2>{0.0214231163f, 0.806590319f},
-std::array<float,2>{0.6067397f, 0.433291584f},
-std::array<float,2>{0.748815417f, 0.878325939f},
-std::array<float,2>{0.128926829f, 0.30434522f},
-std::array<float,2>{0.479927182f, 0.626501858f},
-std::array<float,2>{0.903963983f, 0.161481649f},
-std::array<float,2>{0.549384594f, 0.699558079f},
-std::array<float,2>{0.0746328309f, 0.245973527f},
-std::array<float,2>{0.261933535f, 0.970071971f},
-std::array<float,2>{0.813256264f, 0.3245911f},
-std::array<float,2>{0.986904204f, 0.840498328f},
-std::array<float,2>{0.43131119f, 0.447599143f},
-std::array<float,2>{0.204001218f, 0.537665665f},
-std::array<float,2>{0.625203013f, 0.123166516f},
-std::array<float,2>{0.909760892f, 0.677098155f},
-std::array<float,2>{0.466487825f, 0.12929143f},
-std::array<float,2>{0.164930359f, 0.914775133f},
-std::array<float,2>{0.707543015f, 0.260564625f},
-std::array<float,2>{0.565333128f, 0.751371026f},
-std::array<float,2>{0.0424716659f, 0.389319211f},
-std::array<float,2>{0.344935119f, 0.618369341f},
-std::array<float,2>{0.812403917f, 0.0408109799f},
-std::array<float,2>{0.679009855f, 0.510158837f},
-std::array<float,2>{0.239940315f, 0.0641889498f},
-std::array<float,2>{0.385184467f, 0.862952888f},
-std::array<float,2>{0.956749082f, 0.493783057f},
-std::array<float,2>{0.859300613f, 0.950968683f},
-std::array<float,2>{0.308881104f, 0.355167866f},
-std::array<float,2>{0.098778829f, 0.722824514f},
-std::array<float,2>{0.513029218f, 0.206654862f},
-std::array<float,2>{0.942802548f, 0.558902979f},
-std::array<float,2>{0.391808689f, 0.102168784f},
-std::array<float,2>{0.219471022f, 0.825221837f},
-std::array<float,2>{0.671622872f, 0.467029214f},
-std::array<float,2>{0.516261995f, 0.985362709f},
-std::array<float,2>{0.116181195f, 0.330400735f},
-std::array<float,2>{0.283372939f, 0.709257066f},
-std::array<float,2>{0.859381437f, 0.226299539f},
-std::array<float,2>{0.695936918f, 0.647347033f},
-std::array<float,2>{0.18536377f, 0.177098796f},
-std::array<float,2>{0.448417723f, 0.891569376f},
-std::array<float,2>{0.931701541f, 0.294608295f},
-std::array<float,2>{0.781651795f, 0.782903552f},
-std::array<float,2>{0.36173594f, 0.417758673f},
-std::array<float,2>{0.0527527034f, 0.590406656f},
-std::array<float,2>{0.58048594f, 0.0105337137f},
-std::array<float,2>{0.837845623f, 0.740756214f},
-std::array<float,2>{0.27210021f, 0.198601946f},
-std::array<float,2>{0.0854952782f, 0.960469365f},
-std::array<float,2>{0.534091532f, 0.373970747f},
-std::array<float,2>{0.640638292f, 0.857278526f},
-std::array<float,2>{0.189897001f, 0.478263885f},
-std::array<float,2>{0.408677548f, 0.530017197f},
-std::array<float,2>{0.974207103f, 0.0821183547f},
-std::array<float,2>{0.624658167f, 0.59584105f},
-std::array<float,2>{0.0093730567f, 0.0610117465f},
-std::array<float,2>{0.333456367f, 0.769626617f},
-std::array<float,2>{0.774941146f, 0.399977058f},
-std::array<float,2>{0.880468726f, 0.925156653f},
-std::array<float,2>{0.493199587f, 0.277308494f},
-std::array<float,2>{0.153629214f, 0.664315701f},
-std::array<float,2>{0.724938631f, 0.154658541f},
-std::array<float,2>{0.871042967f, 0.51949513f},
-std::array<float,2>{0.296400249f, 0.0900039673f},
-std::array<float,2>{0.120369278f, 0.848734498f},
-std::array<float,2>{0.529085398f, 0.471331626f},
-std::array<float,2>{0.663110077f, 0.962376654f},
-std::array<float,2>{0.232938468f, 0.363083422f},
-std::array<float,2>{0.402138621f, 0.74430275f},
-std::array<float,2>{0.946320653f, 0.192201152f},
-std::array<float,2>{0.586887658f, 0.6594944f},
-std::array<float,2>{0.0583249144f, 0.141672418f},
-std::array<float,2>{0.371644378f, 0.934174418f},
-std::array<float,2>{0.789739132f, 0.272395045f},
-std::array<float,2>{0.921888292f, 0.776985884f},
-std::array<float,2>{0.439504415f, 0.39548257f},
-std::array<float,2>{0.178748578f, 0.608987451f},
-std::array<float,2>{0.695295095f, 0.0536613464f},
-std::array<float,2>{0.97661382f, 0.715156376f},
-std::array<float,2>{0.420579493f, 0.233602449f},
-std::array<float,2>{0.199197754f, 0.999512374f},
-std::array<float,2>{0.654449344f, 0.339717269f},
-std::array<float,2>{0.540985107f, 0.81857723f},
-std::array<float,2>{0.0867929086f, 0.457907021f},
-std::array<float,2>{0.280947149f, 0.550375879f},
-std::array<float,2>{0.83555299f, 0.0945857987f},
-std::array<float,2>{0.727715075f, 0.579985857f},
-std::array<float,2>{0.148023471f, 0.00669179857f},
-std::array<float,2>{0.488810122f, 0.796520114f},
-std::array<float,2>{0.889601588f, 0.407414615f},
-std::array<float,2>{0.769945145f, 0.905279398f},
-std::array<float,2>{0.34341082f, 0.285595f},
-std::array<float,2>{0.00128645101f, 0.652794003f},
-std::array<float,2>{0.612809658f, 0.18567282f},
-std::array<float,2>{0.893342078f, 0.611822903f},
-std::array<float,2>{0.475456297f, 0.0381696448f},
-std::array<float,2>{0.137101889f, 0.759778559f},
-std::array<float,2>{0.735292256f, 0.377730489f},
-std::array<float,2>{0.59591341f, 0.911005855f},
-std::array<float,2>{0.0239836965f, 0.254071802f},
-std::array<float,2>{0.318392396f, 0.682384014f},
-std::array<float,2>{0.761897147f, 0.133848608f},
-std::array<float,2>{0.636123955f, 0.728954673f},
-std::array<float,2>{0.218321785f, 0.214655548f},
-std::array<float,2>{0.429561019f, 0.938115537f},
-std::array<float,2>{0.992650688f, 0.347702652f},
-std::array<float,2>{0.825773478f, 0.869376123f},
-std::array<float,2>{0.252177984f, 0.485289752f},
-std::array<float,2>{0.0664560646f, 0.503368735f},
-std::array<float,2>{0.555771112f, 0.0742733032f},
-std::array<float,2>{0.798416138f, 0.637195349f},
-std::array<float,2>{0.351930141f, 0.166243494f},
-std::array<float,2>{0.0322713628f, 0.888671756f},
-std::array<float,2>{0.574908733f, 0.309679925f},
-std::array<float,2>{0.717868865f, 0.802543223f},
-std::array<float,2>{0.159490556f, 0.427947938f},
-std::array<float,2>{0.456559896f, 0.567137063f},
-std::array<float,2>{0.921343207f, 0.0268078316f},
-std::array<float,2>{0.507035017f, 0.541558743f},
-std::array<float,2>{0.104593068f, 0.116385333f},
-std::array<float,2>{0.297542065f, 0.83021754f},
-std::array<float,2>{0.844939351f, 0.440447152f},
-std::array<float,2>{0.967387438f, 0.982889116f},
-std::array<float,2>{0.378632337f, 0.317781776f},
-std::array<float,2>{0.247466534f, 0.695167482f},
-std::array<float,2>{0.685350299f, 0.236621112f},
-std::array<float,2>{0.768992186f, 0.511896729f},
-std::array<float,2>{0.336018562f, 0.0685232431f},
-std::array<float,2>{0.00652083103f, 0.865049839f},
-std::array<float,2>{0.617129922f, 0.499157578f},
-std::array<float,2>{0.733401179f, 0.946511865f},
-std::array<float,2>{0.142146438f, 0.355924547f},
-std::array<float,2>{0.485467643f, 0.720112324f},
-std::array<float,2>{0.886384189f, 0.207364216f},
-std::array<float,2>{0.54328382f, 0.672584891f},
-std::array<float,2>{0.0914897919f, 0.127754331f},
-std::array<float,2>{0.276481718f, 0.921389461f},
-std::array<float,2>{0.828351498f, 0.263865232f},
-std::array<float,2>{0.982033074f, 0.757451594f},
-std::array<float,2>{0.416589171f, 0.383172125f},
-std::array<float,2>{0.199727148f, 0.623921752f},
-std::array<float,2>{0.652171671f, 0.0451734252f},
-std::array<float,2>{0.928428411f, 0.697241843f},
-std::array<float,2>{0.442272663f, 0.249863356f},
-std::array<float,2>{0.174089149f, 0.974535108f},
-std::array<float,2>{0.689158797f, 0.321330488f},
-std::array<float,2>{0.591979027f, 0.839392543f},
-std::array<float,2>{0.059445817f, 0.452206969f},
-std::array<float,2>{0.370317936f, 0.534354687f},
-std::array<float,2>{0.794847429f, 0.11943154f},
-std::array<float,2>{0.657062113f, 0.574799061f},
-std::array<float,2>{0.226582274f, 0.0180796999f},
-std::array<float,2>{0.405575633f, 0.812434793f},
-std::array<float,2>{0.949431777f, 0.434518427f},
-std::array<float,2>{0.87203449f, 0.882347345f},
-std::array<float,2>{0.289819598f, 0.298242509f},
-std::array<float,2>{0.121100307f, 0.629777789f},
-std::array<float,2>{0.526016176f, 0.158650935f},
-std::array<float,2>{0.964579105f, 0.600396693f},
-std::array<float,2>{0.382801235f, 0.0567013025f},
-std::array<float,2>{0.245867863f, 0.769174099f},
-std::array<float,2>{0.681040704f, 0.402724802f},
-std::array<float,2>{0.501281202f, 0.929002523f},
-std::array<float,2>{0.108300187f, 0.280979961f},
-std::array<float,2>{0.302963436f, 0.668150604f},
-std::array<float,2>{0.85136497f, 0.148629993f},
-std::array<float,2>{0.71295166f, 0.735396922f},
-std::array<float,2>{0.160451353f, 0.202729285f},
-std::array<float,2>{0.460734129f, 0.953450441f},
-std::array<float,2>{0.916996062f, 0.370345265f},
-std::array<float,2>{0.803997934f, 0.852040589f},
-std::array<float,2>{0.357597589f, 0.48369959f},
-std::array<float,2>{0.0389639251f, 0.526009619f},
-std::array<float,2>{0.570864379f, 0.0790803209f},
-std::array<float,2>{0.822666824f, 0.641218424f},
-std::array<float,2>{0.254843444f, 0.173467249f},
-std::array<float,2>{0.0657959208f, 0.894844174f},
-std::array<float,2>{0.560865283f, 0.291430146f},
-std::array<float,2>{0.637768805f, 0.786307752f},
-std::array<float,2>{0.212705269f, 0.421730846f},
-std::array<float,2>{0.424000531f, 0.588319778f},
-std::array<float,2>{0.996299744f, 0.0124074826f},
-std::array<float,2>{0.598122656f, 0.557030678f},
-std::array<float,2>{0.0300786532f, 0.108710982f},
-std::array<float,2>{0.312781781f, 0.822811842f},
-std::array<float,2>{0.758184552f, 0.461801499f},
-std::array<float,2>{0.897698998f, 0.991139948f},
-std::array<float,2>{0.472059935f, 0.334710121f},
-std::array<float,2>{0.135553122f, 0.705262542f},
-std::array<float,2>{0.740055919f, 0.219882771f},
-std::array<float,2>{0.851754725f, 0.585562289f},
-std::array<float,2>{0.305005759f, 0.000760917028f},
-std::array<float,2>{0.0972110927f, 0.79046607f},
-std::array<float,2>{0.508090556f, 0.411286443f},
-std::array<float,2>{0.673673511f, 0.899080813f},
-std::array<float,2>{0.235124439f, 0.283488929f},
-std::array<float,2>{0.39033246f, 0.650791883f},
-std::array<float,2>{0.959920645f, 0.183383852f},
-std::array<float,2>{0.5673877f, 0.711893618f},
-std::array<float,2>{0.0437808484f, 0.229526818f},
-std::array<float,2>{0.348709822f, 0.99507302f},
-std::array<float,2>{0.805635512f, 0.34127599f},
-std::array<float,2>{0.913282156f, 0.814121604f},
-std::array<float,2>{0.461968243f, 0.453740746f},
-std::array<float,2>{0.169309527f, 0.551399469f},
-std::array<float,2>{0.706740737f, 0.0979594067f},
-std::array<float,2>{0.991416097f, 0.663399279f},
-std::array<float,2>{0.437003195f, 0.146005183f},
-std::array<float,2>{0.210381657f, 0.931889713f},
-std::array<float,2>{0.631767213f, 0.267712742f},
-std::array<float,2>{0.552250504f, 0.780759096f},
-std::array<float,2>{0.0724313036f, 0.390720934f},
-std::array<float,2>{0.259319633f, 0.602695882f},
-std::array<float,2>{0.817113996f, 0.047111202f},
-std::array<float,2>{0.744278014f, 0.520063519f},
-std::array<float,2>{0.127051309f, 0.0884971544f},
-std::array<float,2>{0.484295726f, 0.845495641f},
-std::array<float,2>{0.901706457f, 0.473239273f},
-std::array<float,2>{0.757262409f, 0.966075897f},
-std::array<float,2>{0.320346177f, 0.365383297f},
-std::array<float,2>{0.018513307f, 0.749853909f},
-std::array<float,2>{0.601727307f, 0.189873487f},
-std::array<float,2>{0.875796497f, 0.543701112f},
-std::array<float,2>{0.497670978f, 0.111773908f},
-std::array<float,2>{0.149981111f, 0.834868371f},
-std::array<float,2>{0.720116556f, 0.443941146f},
-std::array<float,2>{0.619124055f, 0.97927022f},
-std::array<float,2>{0.0146969389f, 0.313146472f},
-std::array<float,2>{0.329536915f, 0.690647304f},
-std::array<float,2>{0.780649185f, 0.242048323f},
-std::array<float,2>{0.64702177f, 0.633955657f},
-std::array<float,2>{0.194318563f, 0.169193298f},
-std::array<float,2>{0.411325276f, 0.886247933f},
-std::array<float,2>{0.969007969f, 0.307086289f},
-std::array<float,2>{0.839950204f, 0.800477982f},
-std::array<float,2>{0.267610133f, 0.42418763f},
-std::array<float,2>{0.0782778785f, 0.563723803f},
-std::array<float,2>{0.536159813f, 0.027552899f},
-std::array<float,2>{0.785168529f, 0.731704533f},
-std::array<float,2>{0.365525305f, 0.218089312f},
-std::array<float,2>{0.0501386635f, 0.944267392f},
-std::array<float,2>{0.585890651f, 0.344738483f},
-std::array<float,2>{0.699416578f, 0.873835683f},
-std::array<float,2>{0.181858972f, 0.489622146f},
-std::array<float,2>{0.45240429f, 0.505283713f},
-std::array<float,2>{0.936142623f, 0.0723849908f},
-std::array<float,2>{0.520647347f, 0.616877079f},
-std::array<float,2>{0.110879213f, 0.0318267643f},
-std::array<float,2>{0.285871863f, 0.763698995f},
-std::array<float,2>{0.866382957f, 0.381833553f},
-std::array<float,2>{0.940540373f, 0.90709269f},
-std::array<float,2>{0.396299064f, 0.250192016f},
-std::array<float,2>{0.222987115f, 0.686231136f},
-std::array<float,2>{0.666796803f, 0.138947576f},
-std::array<float,2>{0.809415221f, 0.621063352f},
-std::array<float,2>{0.346353203f, 0.0413120016f},
-std::array<float,2>{0.0402930863f, 0.752630949f},
-std::array<float,2>{0.564288676f, 0.386805952f},
-std::array<float,2>{0.709002852f, 0.916857541f},
-std::array<float,2>{0.167579487f, 0.258275211f},
-std::array<float,2>{0.467258185f, 0.678298056f},
-std::array<float,2>{0.907453477f, 0.132778227f},
-std::array<float,2>{0.515327632f, 0.725014806f},
-std::array<float,2>{0.100911446f, 0.204879731f},
-std::array<float,2>{0.312190145f, 0.951859474f},
-std::array<float,2>{0.85678035f, 0.352869451f},
-std::array<float,2>{0.954519391f, 0.860433936f},
-std::array<float,2>{0.383783638f, 0.495205075f},
-std::array<float,2>{0.241369426f, 0.509083629f},
-std::array<float,2>{0.676152885f, 0.06510818f},
-std::array<float,2>{0.906184733f, 0.628217459f},
-std::array<float,2>{0.477959961f, 0.162120223f},
-std::array<float,2>{0.131856844f, 0.876881599f},
-std::array<float,2>{0.746900558f, 0.301682055f},
-std::array<float,2>{0.608758986f, 0.8068766f},
-std::array<float,2>{0.0224839039f, 0.431131303f},
-std::array<float,2>{0.324271291f, 0.57233268f},
-std::array<float,2>{0.751254261f, 0.023255853f},
-std::array<float,2>{0.627868235f, 0.53702867f},
-std::array<float,2>{0.205575794f, 0.122899547f},
-std::array<float,2>{0.433238089f, 0.842769444f},
-std::array<float,2>{0.985003412f, 0.445897251f},
-std::array<float,2>{0.814886332f, 0.971553564f},
-std::array<float,2>{0.265063941f, 0.327290863f},
-std::array<float,2>{0.0774155632f, 0.702624083f},
-std::array<float,2>{0.548193157f, 0.242991641f},
-std::array<float,2>{0.976406753f, 0.528448105f},
-std::array<float,2>{0.407028615f, 0.0848003775f},
-std::array<float,2>{0.189213559f, 0.859256387f},
-std::array<float,2>{0.64371711f, 0.479716152f},
-std::array<float,2>{0.531764746f, 0.958925962f},
-std::array<float,2>{0.0825060233f, 0.372782409f},
-std::array<float,2>{0.271113575f, 0.739133298f},
-std::array<float,2>{0.839524448f, 0.196877509f},
-std::array<float,2>{0.723397851f, 0.667619467f},
-std::array<float,2>{0.155496418f, 0.152864695f},
-std::array<float,2>{0.495928138f, 0.923561096f},
-std::array<float,2>{0.881809235f, 0.273570329f},
-std::array<float,2>{0.775735199f, 0.771510065f},
-std::array<float,2>{0.335023046f, 0.40149796f},
-std::array<float,2>{0.010585703f, 0.594672918f},
-std::array<float,2>{0.621938825f, 0.0594150797f},
-std::array<float,2>{0.861879408f, 0.70774138f},
-std::array<float,2>{0.28226319f, 0.222777382f},
-std::array<float,2>{0.114618473f, 0.98780185f},
-std::array<float,2>{0.518066585f, 0.330038846f},
-std::array<float,2>{0.668076098f, 0.827573419f},
-std::array<float,2>{0.222445428f, 0.465983421f},
-std::array<float,2>{0.394205749f, 0.56200707f},
-std::array<float,2>{0.943691611f, 0.104283229f},
-std::array<float,2>{0.579271138f, 0.592421651f},
-std::array<float,2>{0.0525530726f, 0.0097014783f},
-std::array<float,2>{0.36121133f, 0.783239424f},
-std::array<float,2>{0.78327924f, 0.415060401f},
-std::array<float,2>{0.930233598f, 0.893675447f},
-std::array<float,2>{0.446437657f, 0.295462966f},
-std::array<float,2>{0.186112776f, 0.646017075f},
-std::array<float,2>{0.698352754f, 0.178277314f},
-std::array<float,2>{0.832163393f, 0.546985567f},
-std::array<float,2>{0.278387696f, 0.0975837857f},
-std::array<float,2>{0.0884831473f, 0.817222059f},
-std::array<float,2>{0.541679442f, 0.459361255f},
-std::array<float,2>{0.652536392f, 0.997979462f},
-std::array<float,2>{0.195715651f, 0.336867929f},
-std::array<float,2>{0.418706f, 0.717555463f},
-std::array<float,2>{0.980421841f, 0.23052597f},
-std::array<float,2>{0.610687494f, 0.655189097f},
-std::array<float,2>{0.00352996541f, 0.183795542f},
-std::array<float,2>{0.339909852f, 0.902949631f},
-std::array<float,2>{0.773304701f, 0.287607133f},
-std::array<float,2>{0.888447165f, 0.793211281f},
-std::array<float,2>{0.491942465f, 0.408630997f},
-std::array<float,2>{0.144595981f, 0.581532061f},
-std::array<float,2>{0.729013145f, 0.00559657253f},
-std::array<float,2>{0.947384953f, 0.744126737f},
-std::array<float,2>{0.398618221f, 0.194548458f},
-std::array<float,2>{0.231961086f, 0.964385152f},
-std::array<float,2>{0.661525548f, 0.360376507f},
-std::array<float,2>{0.530183554f, 0.850037575f},
-std::array<float,2>{0.118279606f, 0.470092297f},
-std::array<float,2>{0.294889778f, 0.517148137f},
-std::array<float,2>{0.867267072f, 0.0934797004f},
-std::array<float,2>{0.692262709f, 0.605897725f},
-std::array<float,2>{0.17631124f, 0.05236369f},
-std::array<float,2>{0.438020796f, 0.773938239f},
-std::array<float,2>{0.924936712f, 0.397793621f},
-std::array<float,2>{0.791809857f, 0.936416566f},
-std::array<float,2>{0.373584956f, 0.269879252f},
-std::array<float,2>{0.0555736758f, 0.658046782f},
-std::array<float,2>{0.588281333f, 0.143112153f},
-std::array<float,2>{0.919685185f, 0.568810821f},
-std::array<float,2>{0.454117388f, 0.0251764078f},
-std::array<float,2>{0.156456962f, 0.802755475f},
-std::array<float,2>{0.71600163f, 0.426728934f},
-std::array<float,2>{0.576857746f, 0.888762832f},
-std::array<float,2>{0.0340796635f, 0.310631752f},
-std::array<float,2>{0.354555517f, 0.640614033f},
-std::array<float,2>{0.800694644f, 0.16554448f},
-std::array<float,2>{0.687195599f, 0.69301784f},
-std::array<float,2>{0.248804137f, 0.234920517f},
-std::array<float,2>{0.375558108f, 0.981007695f},
-std::array<float,2>{0.966753423f, 0.319346875f},
-std::array<float,2>{0.847226799f, 0.828477919f},
-std::array<float,2>{0.299242526f, 0.439060867f},
-std::array<float,2>{0.102294445f, 0.540484905f},
-std::array<float,2>{0.503995776f, 0.113342628f},
-std::array<float,2>{0.765055597f, 0.679720223f},
-std::array<float,2>{0.31779772f, 0.135242537f},
-std::array<float,2>{0.0267405137f, 0.912514865f},
-std::array<float,2>{0.594307482f, 0.256847113f},
-std::array<float,2>{0.737547219f, 0.75846827f},
-std::array<float,2>{0.140369728f, 0.376168936f},
-std::array<float,2>{0.473856777f, 0.611193478f},
-std::array<float,2>{0.891200542f, 0.0365834758f},
-std::array<float,2>{0.556652069f, 0.501208246f},
-std::array<float,2>{0.0691316873f, 0.0770309642f},
-std::array<float,2>{0.251099527f, 0.868463874f},
-std::array<float,2>{0.827284098f, 0.487742782f},
-std::array<float,2>{0.99491477f, 0.939707935f},
-std::array<float,2>{0.426230788f, 0.350250244f},
-std::array<float,2>{0.216236517f, 0.728301048f},
-std::array<float,2>{0.633095026f, 0.211894497f},
-std::array<float,2>{0.789875865f, 0.516274571f},
-std::array<float,2>{0.372052073f, 0.0923240781f},
-std::array<float,2>{0.0584762543f, 0.851020157f},
-std::array<float,2>{0.586619556f, 0.469144583f},
-std::array<float,2>{0.695031404f, 0.963740826f},
-std::array<float,2>{0.178964108f, 0.359925508f},
-std::array<float,2>{0.439798534f, 0.743155539f},
-std::array<float,2>{0.922206759f, 0.193518385f},
-std::array<float,2>{0.528856337f, 0.656976521f},
-std::array<float,2>{0.120172255f, 0.143780321f},
-std::array<float,2>{0.296765268f, 0.936697423f},
-std::array<float,2>{0.870815754f, 0.271146655f},
-std::array<float,2>{0.946632624f, 0.77444315f},
-std::array<float,2>{0.401856244f, 0.396669507f},
-std::array<float,2>{0.233178899f, 0.606718481f},
-std::array<float,2>{0.663404644f, 0.0510703102f},
-std::array<float,2>{0.889186144f, 0.718465686f},
-std::array<float,2>{0.489129454f, 0.23146081f},
-std::array<float,2>{0.148322389f, 0.996471107f},
-std::array<float,2>{0.728006899f, 0.337847918f},
-std::array<float,2>{0.613088429f, 0.818019092f},
-std::array<float,2>{0.000990734436f, 0.460813701f},
-std::array<float,2>{0.343531519f, 0.548686504f},
-std::array<float,2>{0.769610107f, 0.0964290798f},
-std::array<float,2>{0.654733539f, 0.580199003f},
-std::array<float,2>{0.198964745f, 0.00416965084f},
-std::array<float,2>{0.420803905f, 0.794704318f},
-std::array<float,2>{0.977041841f, 0.409611315f},
-std::array<float,2>{0.835738361f, 0.903654456f},
-std::array<float,2>{0.281211168f, 0.288294882f},
-std::array<float,2>{0.0865740031f, 0.655339539f},
-std::array<float,2>{0.540618062f, 0.184960186f},
-std::array<float,2>{0.992224276f, 0.610318005f},
-std::array<float,2>{0.429332763f, 0.0357937999f},
-std::array<float,2>{0.218660638f, 0.759406865f},
-std::array<float,2>{0.635888219f, 0.375847071f},
-std::array<float,2>{0.55597192f, 0.913730323f},
-std::array<float,2>{0.0667699948f, 0.256561011f},
-std::array<float,2>{0.252264172f, 0.681032836f},
-std::array<float,2>{0.826140702f, 0.135942265f},
-std::array<float,2>{0.734864295f, 0.726696551f},
-std::array<float,2>{0.136868045f, 0.212417677f},
-std::array<float,2>{0.47522074f, 0.940437078f},
-std::array<float,2>{0.893233895f, 0.350740075f},
-std::array<float,2>{0.762098014f, 0.867374122f},
-std::array<float,2>{0.318800002f, 0.48727721f},
-std::array<float,2>{0.0243521947f, 0.500887811f},
-std::array<float,2>{0.596096158f, 0.077391915f},
-std::array<float,2>{0.845184386f, 0.639287889f},
-std::array<float,2>{0.297791898f, 0.164462179f},
-std::array<float,2>{0.104778737f, 0.889659047f},
-std::array<float,2>{0.507210732f, 0.311984062f},
-std::array<float,2>{0.685124099f, 0.80413872f},
-std::array<float,2>{0.24729912f, 0.427276105f},
-std::array<float,2>{0.37882039f, 0.569574893f},
-std::array<float,2>{0.967562139f, 0.024079768f},
-std::array<float,2>{0.575088978f, 0.539978206f},
-std::array<float,2>{0.0325506665f, 0.115026638f},
-std::array<float,2>{0.351729691f, 0.829300225f},
-std::array<float,2>{0.798685193f, 0.4384332f},
-std::array<float,2>{0.920989692f, 0.982290685f},
-std::array<float,2>{0.456864893f, 0.319271594f},
-std::array<float,2>{0.159357697f, 0.691670835f},
-std::array<float,2>{0.718089342f, 0.236150756f},
-std::array<float,2>{0.813028812f, 0.574079931f},
-std::array<float,2>{0.262065411f, 0.0217395127f},
-std::array<float,2>{0.0743214116f, 0.807651162f},
-std::array<float,2>{0.549683452f, 0.430495113f},
-std::array<float,2>{0.625283062f, 0.875153601f},
-std::array<float,2>{0.203752413f, 0.302420259f},
-std::array<float,2>{0.431553662f, 0.627662539f},
-std::array<float,2>{0.987109005f, 0.163752049f},
-std::array<float,2>{0.606548488f, 0.70158124f},
-std::array<float,2>{0.0210015643f, 0.244107246f},
-std::array<float,2>{0.328015953f, 0.971830964f},
-std::array<float,2>{0.752852976f, 0.326746941f},
-std::array<float,2>{0.904159307f, 0.84278065f},
-std::array<float,2>{0.479585677f, 0.447221875f},
-std::array<float,2>{0.129375547f, 0.535733283f},
-std::array<float,2>{0.748714507f, 0.121527277f},
-std::array<float,2>{0.956905305f, 0.679107189f},
-std::array<float,2>{0.384969652f, 0.131257161f},
-std::array<float,2>{0.240115672f, 0.917818248f},
-std::array<float,2>{0.678888679f, 0.259000301f},
-std::array<float,2>{0.512858808f, 0.753568292f},
-std::array<float,2>{0.0990934372f, 0.387743026f},
-std::array<float,2>{0.308797836f, 0.619733274f},
-std::array<float,2>{0.859011948f, 0.0423004664f},
-std::array<float,2>{0.707775295f, 0.508587956f},
-std::array<float,2>{0.164670095f, 0.0656704828f},
-std::array<float,2>{0.466708779f, 0.859717369f},
-std::array<float,2>{0.910122335f, 0.495028228f},
-std::array<float,2>{0.812086403f, 0.95259887f},
-std::array<float,2>{0.345000267f, 0.352008671f},
-std::array<float,2>{0.0421656817f, 0.726550162f},
-std::array<float,2>{0.565078557f, 0.2031333f},
-std::array<float,2>{0.932018816f, 0.56141758f},
-std::array<float,2>{0.448498815f, 0.10457439f},
-std::array<float,2>{0.185152501f, 0.826325715f},
-std::array<float,2>{0.696164131f, 0.465247124f},
-std::array<float,2>{0.580298364f, 0.987295747f},
-std::array<float,2>{0.0530524291f, 0.328475744f},
-std::array<float,2>{0.36133182f, 0.708714008f},
-std::array<float,2>{0.781486094f, 0.223909274f},
-std::array<float,2>{0.671642601f, 0.645329475f},
-std::array<float,2>{0.219553962f, 0.179337621f},
-std::array<float,2>{0.391902328f, 0.892917156f},
-std::array<float,2>{0.942458153f, 0.296620309f},
-std::array<float,2>{0.859733582f, 0.785058498f},
-std::array<float,2>{0.283560693f, 0.414587408f},
-std::array<float,2>{0.115931369f, 0.593470395f},
-std::array<float,2>{0.516383469f, 0.00827305112f},
-std::array<float,2>{0.775309145f, 0.739778101f},
-std::array<float,2>{0.33322227f, 0.195449978f},
-std::array<float,2>{0.00961280428f, 0.95722121f},
-std::array<float,2>{0.624823093f, 0.372008443f},
-std::array<float,2>{0.724817634f, 0.85800451f},
-std::array<float,2>{0.153325707f, 0.478926718f},
-std::array<float,2>{0.493458569f, 0.527532518f},
-std::array<float,2>{0.880729914f, 0.085685052f},
-std::array<float,2>{0.533810198f, 0.595602095f},
-std::array<float,2>{0.0857050791f, 0.0601198077f},
-std::array<float,2>{0.272342026f, 0.772955f},
-std::array<float,2>{0.837522209f, 0.401258767f},
-std::array<float,2>{0.974367738f, 0.922378421f},
-std::array<float,2>{0.408236235f, 0.274804056f},
-std::array<float,2>{0.189582378f, 0.666163623f},
-std::array<float,2>{0.64099443f, 0.153476253f},
-std::array<float,2>{0.754512906f, 0.601800621f},
-std::array<float,2>{0.324152261f, 0.0482261665f},
-std::array<float,2>{0.0162792243f, 0.779612958f},
-std::array<float,2>{0.604304731f, 0.391849697f},
-std::array<float,2>{0.742290497f, 0.932914793f},
-std::array<float,2>{0.125130445f, 0.26926738f},
-std::array<float,2>{0.482185066f, 0.662279069f},
-std::array<float,2>{0.898979545f, 0.145100817f},
-std::array<float,2>{0.553079009f, 0.748447597f},
-std::array<float,2>{0.0710281059f, 0.190463707f},
-std::array<float,2>{0.26029864f, 0.965119183f},
-std::array<float,2>{0.818825781f, 0.366493046f},
-std::array<float,2>{0.989955783f, 0.843791664f},
-std::array<float,2>{0.434443951f, 0.47444877f},
-std::array<float,2>{0.207968459f, 0.5207358f},
-std::array<float,2>{0.630833089f, 0.0898075253f},
-std::array<float,2>{0.910268128f, 0.652086556f},
-std::array<float,2>{0.463442445f, 0.181709051f},
-std::array<float,2>{0.169960096f, 0.899505019f},
-std::array<float,2>{0.703998864f, 0.285113692f},
-std::array<float,2>{0.568512917f, 0.789968729f},
-std::array<float,2>{0.0450293683f, 0.410667986f},
-std::array<float,2>{0.351031125f, 0.584187031f},
-std::array<float,2>{0.806683719f, 0.00102722168f},
-std::array<float,2>{0.675657749f, 0.552156031f},
-std::array<float,2>{0.237285748f, 0.0988916829f},
-std::array<float,2>{0.388242543f, 0.813001335f},
-std::array<float,2>{0.958707929f, 0.454779595f},
-std::array<float,2>{0.855232537f, 0.99608773f},
-std::array<float,2>{0.307006836f, 0.339942127f},
-std::array<float,2>{0.0938650966f, 0.712232888f},
-std::array<float,2>{0.51155901f, 0.228716731f},
-std::array<float,2>{0.938949406f, 0.504853904f},
-std::array<float,2>{0.397805214f, 0.0734265149f},
-std::array<float,2>{0.225192606f, 0.874555647f},
-std::array<float,2>{0.665223897f, 0.488751799f},
-std::array<float,2>{0.521808207f, 0.945208669f},
-std::array<float,2>{0.113007091f, 0.344507217f},
-std::array<float,2>{0.287975162f, 0.730570734f},
-std::array<float,2>{0.863624871f, 0.217646018f},
-std::array<float,2>{0.701379657f, 0.687189221f},
-std::array<float,2>{0.179873675f, 0.139724538f},
-std::array<float,2>{0.451056272f, 0.9081285f},
-std::array<float,2>{0.934096515f, 0.251804829f},
-std::array<float,2>{0.787654579f, 0.765508413f},
-std::array<float,2>{0.363809168f, 0.382753283f},
-std::array<float,2>{0.0473376475f, 0.615492165f},
-std::array<float,2>{0.583695292f, 0.0323696472f},
-std::array<float,2>{0.843138874f, 0.690291524f},
-std::array<float,2>{0.266641736f, 0.240821823f},
-std::array<float,2>{0.0802387595f, 0.979566574f},
-std::array<float,2>{0.538176894f, 0.313588172f},
-std::array<float,2>{0.646022677f, 0.835471332f},
-std::array<float,2>{0.192861512f, 0.44513467f},
-std::array<float,2>{0.414044768f, 0.54490298f},
-std::array<float,2>{0.972241938f, 0.113142416f},
-std::array<float,2>{0.620466471f, 0.563133419f},
-std::array<float,2>{0.0133254584f, 0.0292103589f},
-std::array<float,2>{0.331819445f, 0.799188316f},
-std::array<float,2>{0.778659463f, 0.425635964f},
-std::array<float,2>{0.878153503f, 0.885233402f},
-std::array<float,2>{0.498838335f, 0.307841986f},
-std::array<float,2>{0.150793105f, 0.633610666f},
-std::array<float,2>{0.720884442f, 0.168171763f},
-std::array<float,2>{0.87321198f, 0.533458531f},
-std::array<float,2>{0.292361915f, 0.120557487f},
-std::array<float,2>{0.123150043f, 0.83790493f},
-std::array<float,2>{0.524401307f, 0.451847821f},
-std::array<float,2>{0.659458756f, 0.973516405f},
-std::array<float,2>{0.228796303f, 0.320686668f},
-std::array<float,2>{0.403675377f, 0.696030378f},
-std::array<float,2>{0.951910615f, 0.248061195f},
-std::array<float,2>{0.590243518f, 0.630827487f},
-std::array<float,2>{0.0613875426f, 0.159986109f},
-std::array<float,2>{0.36796698f, 0.881748974f},
-std::array<float,2>{0.795884371f, 0.296947807f},
-std::array<float,2>{0.926755607f, 0.810799718f},
-std::array<float,2>{0.445258677f, 0.434893072f},
-std::array<float,2>{0.171955079f, 0.575695276f},
-std::array<float,2>{0.690461934f, 0.0190497283f},
-std::array<float,2>{0.98424089f, 0.719544053f},
-std::array<float,2>{0.414369345f, 0.208482057f},
-std::array<float,2>{0.202957183f, 0.946051121f},
-std::array<float,2>{0.649779677f, 0.356718928f},
-std::array<float,2>{0.546334147f, 0.86389643f},
-std::array<float,2>{0.092795819f, 0.498437583f},
-std::array<float,2>{0.273723423f, 0.513421774f},
-std::array<float,2>{0.830834091f, 0.0699407607f},
-std::array<float,2>{0.73064208f, 0.624784291f},
-std::array<float,2>{0.143965274f, 0.0459508859f},
-std::array<float,2>{0.486593425f, 0.756182134f},
-std::array<float,2>{0.884739995f, 0.384589702f},
-std::array<float,2>{0.766566157f, 0.919926822f},
-std::array<float,2>{0.339231372f, 0.265180767f},
-std::array<float,2>{0.00408990914f, 0.673769116f},
-std::array<float,2>{0.614937067f, 0.128293499f},
-std::array<float,2>{0.896289349f, 0.589105129f},
-std::array<float,2>{0.469343811f, 0.0130706588f},
-std::array<float,2>{0.132934436f, 0.785905957f},
-std::array<float,2>{0.741835713f, 0.419922233f},
-std::array<float,2>{0.600508273f, 0.895989656f},
-std::array<float,2>{0.0285503343f, 0.292498887f},
-std::array<float,2>{0.315440476f, 0.642552018f},
-std::array<float,2>{0.760287642f, 0.172112361f},
-std::array<float,2>{0.639236927f, 0.70626229f},
-std::array<float,2>{0.21377264f, 0.219688728f},
-std::array<float,2>{0.422492504f, 0.991523981f},
-std::array<float,2>{0.998868585f, 0.335829347f},
-std::array<float,2>{0.82104969f, 0.823583603f},
-std::array<float,2>{0.257207394f, 0.462074727f},
-std::array<float,2>{0.0630181208f, 0.557990193f},
-std::array<float,2>{0.559869766f, 0.107467465f},
-std::array<float,2>{0.802083552f, 0.669203639f},
-std::array<float,2>{0.356892765f, 0.149792328f},
-std::array<float,2>{0.0364703238f, 0.9286502f},
-std::array<float,2>{0.572351277f, 0.27966556f},
-std::array<float,2>{0.711086631f, 0.767990947f},
-std::array<float,2>{0.163801894f, 0.404175639f},
-std::array<float,2>{0.458561093f, 0.601528943f},
-std::array<float,2>{0.914545238f, 0.0580745488f},
-std::array<float,2>{0.503578007f, 0.526737928f},
-std::array<float,2>{0.105482183f, 0.0796000957f},
-std::array<float,2>{0.302693307f, 0.852551997f},
-std::array<float,2>{0.848009408f, 0.483140826f},
-std::array<float,2>{0.961302578f, 0.954190254f},
-std::array<float,2>{0.380056947f, 0.369707376f},
-std::array<float,2>{0.243758082f, 0.734572768f},
-std::array<float,2>{0.683219314f, 0.201841772f},
-std::array<float,2>{0.773054481f, 0.548997343f},
-std::array<float,2>{0.340270221f, 0.0956345722f},
-std::array<float,2>{0.00372471148f, 0.819914579f},
-std::array<float,2>{0.610401392f, 0.458365053f},
-std::array<float,2>{0.729326785f, 0.99886024f},
-std::array<float,2>{0.14480637f, 0.337987691f},
-std::array<float,2>{0.492058963f, 0.715922952f},
-std::array<float,2>{0.888412178f, 0.232911572f},
-std::array<float,2>{0.54187423f, 0.653761744f},
-std::array<float,2>{0.0887413993f, 0.186673597f},
-std::array<float,2>{0.27877602f, 0.904981732f},
-std::array<float,2>{0.832511365f, 0.286575019f},
-std::array<float,2>{0.980026424f, 0.795328259f},
-std::array<float,2>{0.418633312f, 0.406337351f},
-std::array<float,2>{0.19546321f, 0.578476727f},
-std::array<float,2>{0.652742684f, 0.00695568044f},
-std::array<float,2>{0.925214648f, 0.746053338f},
-std::array<float,2>{0.438351184f, 0.192428663f},
-std::array<float,2>{0.176518127f, 0.961214185f},
-std::array<float,2>{0.691949308f, 0.361991286f},
-std::array<float,2>{0.587949753f, 0.847721636f},
-std::array<float,2>{0.0553045198f, 0.471846849f},
-std::array<float,2>{0.373964608f, 0.518407464f},
-std::array<float,2>{0.791569114f, 0.0913827494f},
-std::array<float,2>{0.661155581f, 0.607817233f},
-std::array<float,2>{0.232238904f, 0.0539263599f},
-std::array<float,2>{0.398838282f, 0.776038826f},
-std::array<float,2>{0.947643638f, 0.39571023f},
-std::array<float,2>{0.867540836f, 0.935445726f},
-std::array<float,2>{0.294536322f, 0.272649944f},
-std::array<float,2>{0.118627854f, 0.658507586f},
-std::array<float,2>{0.530009151f, 0.14133884f},
-std::array<float,2>{0.966511548f, 0.567534208f},
-std::array<float,2>{0.375781506f, 0.0255549438f},
-std::array<float,2>{0.248582751f, 0.800861239f},
-std::array<float,2>{0.687309563f, 0.428960681f},
-std::array<float,2>{0.504328012f, 0.887365282f},
-std::array<float,2>{0.102363795f, 0.308752805f},
-std::array<float,2>{0.299070835f, 0.638579011f},
-std::array<float,2>{0.847541273f, 0.167367548f},
-std::array<float,2>{0.716098785f, 0.693383634f},
-std::array<float,2>{0.156542242f, 0.237907544f},
-std::array<float,2>{0.454488099f, 0.984191597f},
-std::array<float,2>{0.919550538f, 0.317078203f},
-std::array<float,2>{0.80042237f, 0.831702709f},
-std::array<float,2>{0.354891986f, 0.439688116f},
-std::array<float,2>{0.0337946527f, 0.542614698f},
-std::array<float,2>{0.576953113f, 0.115457341f},
-std::array<float,2>{0.827437997f, 0.683370233f},
-std::array<float,2>{0.251346469f, 0.133482635f},
-std::array<float,2>{0.0688977838f, 0.911760032f},
-std::array<float,2>{0.557057261f, 0.255174845f},
-std::array<float,2>{0.633038402f, 0.76159364f},
-std::array<float,2>{0.215937376f, 0.378754526f},
-std::array<float,2>{0.425901532f, 0.613225043f},
-std::array<float,2>{0.994816601f, 0.0379579924f},
-std::array<float,2>{0.594496369f, 0.502082825f},
-std::array<float,2>{0.0264582634f, 0.0759036168f},
-std::array<float,2>{0.317401379f, 0.870530069f},
-std::array<float,2>{0.764707983f, 0.486067802f},
-std::array<float,2>{0.891446114f, 0.939392924f},
-std::array<float,2>{0.473914206f, 0.34957549f},
-std::array<float,2>{0.140543208f, 0.729577601f},
-std::array<float,2>{0.737743258f, 0.213574022f},
-std::array<float,2>{0.856493056f, 0.617267787f},
-std::array<float,2>{0.312402517f, 0.0392833538f},
-std::array<float,2>{0.100786492f, 0.750322521f},
-std::array<float,2>{0.515464783f, 0.390002221f},
-std::array<float,2>{0.676023006f, 0.915203691f},
-std::array<float,2>{0.24159272f, 0.260882348f},
-std::array<float,2>{0.383321047f, 0.675843298f},
-std::array<float,2>{0.954111278f, 0.130122319f},
-std::array<float,2>{0.564012647f, 0.724119484f},
-std::array<float,2>{0.0400822796f, 0.205434784f},
-std::array<float,2>{0.34647873f, 0.950180352f},
-std::array<float,2>{0.809245467f, 0.354416221f},
-std::array<float,2>{0.907513857f, 0.862267315f},
-std::array<float,2>{0.46688807f, 0.492278963f},
-std::array<float,2>{0.167940423f, 0.510768473f},
-std::array<float,2>{0.70936805f, 0.0629134327f},
-std::array<float,2>{0.985273957f, 0.625727475f},
-std::array<float,2>{0.433496952f, 0.16053395f},
-std::array<float,2>{0.206011653f, 0.877442658f},
-std::array<float,2>{0.627671719f, 0.303055227f},
-std::array<float,2>{0.547985017f, 0.805294633f},
-std::array<float,2>{0.0772722512f, 0.432042152f},
-std::array<float,2>{0.264740646f, 0.571055174f},
-std::array<float,2>{0.814523041f, 0.0199491121f},
-std::array<float,2>{0.746792793f, 0.538191676f},
-std::array<float,2>{0.132301807f, 0.12450362f},
-std::array<float,2>{0.477581739f, 0.841655731f},
-std::array<float,2>{0.90586555f, 0.448754311f},
-std::array<float,2>{0.751071274f, 0.969290555f},
-std::array<float,2>{0.324513406f, 0.325534582f},
-std::array<float,2>{0.0227068588f, 0.700865448f},
-std::array<float,2>{0.608485401f, 0.244502693f},
-std::array<float,2>{0.881408036f, 0.531073153f},
-std::array<float,2>{0.49573648f, 0.0831614733f},
-std::array<float,2>{0.155568406f, 0.855933785f},
-std::array<float,2>{0.723207295f, 0.476965725f},
-std::array<float,2>{0.621611118f, 0.959549129f},
-std::array<float,2>{0.0103715742f, 0.374115288f},
-std::array<float,2>{0.33521992f, 0.741239846f},
-std::array<float,2>{0.775474012f, 0.197985828f},
-std::array<float,2>{0.64400661f, 0.665529788f},
-std::array<float,2>{0.189193696f, 0.156132281f},
-std::array<float,2>{0.406929106f, 0.924149752f},
-std::array<float,2>{0.976180494f, 0.27622357f},
-std::array<float,2>{0.839749396f, 0.771475494f},
-std::array<float,2>{0.271438241f, 0.398611814f},
-std::array<float,2>{0.0820938423f, 0.597000837f},
-std::array<float,2>{0.532076299f, 0.0615869462f},
-std::array<float,2>{0.78351897f, 0.710238039f},
-std::array<float,2>{0.360926718f, 0.225490719f},
-std::array<float,2>{0.052391164f, 0.985026062f},
-std::array<float,2>{0.579366863f, 0.331088156f},
-std::array<float,2>{0.698524714f, 0.824491978f},
-std::array<float,2>{0.186396524f, 0.467930347f},
-std::array<float,2>{0.446766347f, 0.560436249f},
-std::array<float,2>{0.930570245f, 0.103263639f},
-std::array<float,2>{0.518362284f, 0.591632962f},
-std::array<float,2>{0.114453815f, 0.0112127168f},
-std::array<float,2>{0.282613665f, 0.781950593f},
-std::array<float,2>{0.862225592f, 0.416479886f},
-std::array<float,2>{0.943575442f, 0.891724825f},
-std::array<float,2>{0.394320309f, 0.293288678f},
-std::array<float,2>{0.222351909f, 0.647498965f},
-std::array<float,2>{0.668360054f, 0.176190525f},
-std::array<float,2>{0.805305839f, 0.582984149f},
-std::array<float,2>{0.349084795f, 0.00203243364f},
-std::array<float,2>{0.0435977802f, 0.791260421f},
-std::array<float,2>{0.567683399f, 0.412433535f},
-std::array<float,2>{0.706963122f, 0.901946664f},
-std::array<float,2>{0.169063658f, 0.282970011f},
-std::array<float,2>{0.462351412f, 0.650315821f},
-std::array<float,2>{0.913378656f, 0.180637583f},
-std::array<float,2>{0.507997692f, 0.712988853f},
-std::array<float,2>{0.0975930542f, 0.227990642f},
-std::array<float,2>{0.304820478f, 0.993671894f},
-std::array<float,2>{0.85195291f, 0.342615247f},
-std::array<float,2>{0.95949775f, 0.815183282f},
-std::array<float,2>{0.390584499f, 0.455721885f},
-std::array<float,2>{0.235025644f, 0.553387582f},
-std::array<float,2>{0.673465192f, 0.100639053f},
-std::array<float,2>{0.901533604f, 0.660554051f},
-std::array<float,2>{0.483938307f, 0.14759858f},
-std::array<float,2>{0.127285242f, 0.930075645f},
-std::array<float,2>{0.744470775f, 0.266812861f},
-std::array<float,2>{0.601957321f, 0.778307974f},
-std::array<float,2>{0.0181522407f, 0.393982798f},
-std::array<float,2>{0.320708543f, 0.604752541f},
-std::array<float,2>{0.756927192f, 0.0503485464f},
-std::array<float,2>{0.631383657f, 0.521543622f},
-std::array<float,2>{0.210099772f, 0.0877639428f},
-std::array<float,2>{0.436708599f, 0.847280264f},
-std::array<float,2>{0.991568804f, 0.475140661f},
-std::array<float,2>{0.817177415f, 0.968641162f},
-std::array<float,2>{0.259595245f, 0.365027457f},
-std::array<float,2>{0.0725390092f, 0.747099042f},
-std::array<float,2>{0.552581072f, 0.1886103f},
-std::array<float,2>{0.968790174f, 0.545621991f},
-std::array<float,2>{0.411403388f, 0.110246681f},
-std::array<float,2>{0.194087416f, 0.832245767f},
-std::array<float,2>{0.647234261f, 0.443259954f},
-std::array<float,2>{0.536466897f, 0.977653027f},
-std::array<float,2>{0.0785014406f, 0.314600021f},
-std::array<float,2>{0.267993838f, 0.687626064f},
-std::array<float,2>{0.840159714f, 0.239704996f},
-std::array<float,2>{0.719892204f, 0.634770393f},
-std::array<float,2>{0.15032576f, 0.170459077f},
-std::array<float,2>{0.497855186f, 0.882839739f},
-std::array<float,2>{0.875669062f, 0.306020498f},
-std::array<float,2>{0.780348718f, 0.797413707f},
-std::array<float,2>{0.329171956f, 0.422068596f},
-std::array<float,2>{0.0150414379f, 0.565457046f},
-std::array<float,2>{0.61872071f, 0.0305233076f},
-std::array<float,2>{0.866472185f, 0.733516634f},
-std::array<float,2>{0.286073655f, 0.215351909f},
-std::array<float,2>{0.111148372f, 0.942305684f},
-std::array<float,2>{0.520783246f, 0.346782327f},
-std::array<float,2>{0.666664064f, 0.873045206f},
-std::array<float,2>{0.22278221f, 0.49192211f},
-std::array<float,2>{0.396036744f, 0.507341981f},
-std::array<float,2>{0.940721571f, 0.0705276057f},
-std::array<float,2>{0.585539043f, 0.614017904f},
-std::array<float,2>{0.0499699824f, 0.0336339138f},
-std::array<float,2>{0.365244895f, 0.762818635f},
-std::array<float,2>{0.785589457f, 0.380461901f},
-std::array<float,2>{0.936361909f, 0.909163952f},
-std::array<float,2>{0.452189445f, 0.252369165f},
-std::array<float,2>{0.181900248f, 0.685070395f},
-std::array<float,2>{0.699676275f, 0.137263611f},
-std::array<float,2>{0.828428149f, 0.513720572f},
-std::array<float,2>{0.276765287f, 0.0682523921f},
-std::array<float,2>{0.0916797742f, 0.865845859f},
-std::array<float,2>{0.543184757f, 0.496431351f},
-std::array<float,2>{0.652051806f, 0.947927177f},
-std::array<float,2>{0.200033829f, 0.358037204f},
-std::array<float,2>{0.416987598f, 0.72113359f},
-std::array<float,2>{0.982240856f, 0.209606454f},
-std::array<float,2>{0.616833448f, 0.675532162f},
-std::array<float,2>{0.00674584741f, 0.125656649f},
-std::array<float,2>{0.336205751f, 0.918729663f},
-std::array<float,2>{0.768663168f, 0.2627092f},
-std::array<float,2>{0.886594772f, 0.75497818f},
-std::array<float,2>{0.485774964f, 0.385279596f},
-std::array<float,2>{0.142502889f, 0.621712267f},
-std::array<float,2>{0.733653009f, 0.0437605679f},
-std::array<float,2>{0.949495494f, 0.697453916f},
-std::array<float,2>{0.405351639f, 0.24708885f},
-std::array<float,2>{0.226831883f, 0.975025058f},
-std::array<float,2>{0.656812608f, 0.322498322f},
-std::array<float,2>{0.52613008f, 0.83762002f},
-std::array<float,2>{0.121426895f, 0.451003939f},
-std::array<float,2>{0.28968358f, 0.531995058f},
-std::array<float,2>{0.871694863f, 0.117725044f},
-std::array<float,2>{0.689423203f, 0.576440811f},
-std::array<float,2>{0.173846662f, 0.0159290452f},
-std::array<float,2>{0.441924334f, 0.809200466f},
-std::array<float,2>{0.928504765f, 0.436015218f},
-std::array<float,2>{0.794622838f, 0.879760861f},
-std::array<float,2>{0.370561928f, 0.300540268f},
-std::array<float,2>{0.0592705943f, 0.631454468f},
-std::array<float,2>{0.592053473f, 0.156289577f},
-std::array<float,2>{0.917322814f, 0.599179327f},
-std::array<float,2>{0.46049729f, 0.0563980304f},
-std::array<float,2>{0.160213172f, 0.765880644f},
-std::array<float,2>{0.713165283f, 0.405693293f},
-std::array<float,2>{0.571106851f, 0.926840365f},
-std::array<float,2>{0.0386383049f, 0.27779308f},
-std::array<float,2>{0.357849091f, 0.670638442f},
-std::array<float,2>{0.803783476f, 0.150949031f},
-std::array<float,2>{0.680787444f, 0.738122344f},
-std::array<float,2>{0.245619491f, 0.200893387f},
-std::array<float,2>{0.382537156f, 0.956219077f},
-std::array<float,2>{0.964620769f, 0.368555397f},
-std::array<float,2>{0.851123273f, 0.854261696f},
-std::array<float,2>{0.30310896f, 0.481635541f},
-std::array<float,2>{0.10798081f, 0.52525866f},
-std::array<float,2>{0.501206696f, 0.0818050206f},
-std::array<float,2>{0.757996321f, 0.643415511f},
-std::array<float,2>{0.312675029f, 0.17563732f},
-std::array<float,2>{0.0299787354f, 0.896946549f},
-std::array<float,2>{0.597835779f, 0.289173424f},
-std::array<float,2>{0.739950657f, 0.788080513f},
-std::array<float,2>{0.135347813f, 0.419268847f},
-std::array<float,2>{0.471814692f, 0.586455226f},
-std::array<float,2>{0.897763371f, 0.0149856936f},
-std::array<float,2>{0.56058079f, 0.555633128f},
-std::array<float,2>{0.0654495656f, 0.107133493f},
-std::array<float,2>{0.254418522f, 0.822147727f},
-std::array<float,2>{0.822330892f, 0.464614064f},
-std::array<float,2>{0.996479809f, 0.988439977f},
-std::array<float,2>{0.424252838f, 0.333459318f},
-std::array<float,2>{0.212524727f, 0.703473747f},
-std::array<float,2>{0.63814044f, 0.221721873f},
-std::array<float,2>{0.797715485f, 0.541226089f},
-std::array<float,2>{0.353482991f, 0.116977185f},
-std::array<float,2>{0.0320020877f, 0.830682099f},
-std::array<float,2>{0.575829804f, 0.441227913f},
-std::array<float,2>{0.717612803f, 0.982915521f},
-std::array<float,2>{0.159133807f, 0.318332583f},
-std::array<float,2>{0.455581278f, 0.694740951f},
-std::array<float,2>{0.920707881f, 0.237007707f},
-std::array<float,2>{0.506173968f, 0.63759321f},
-std::array<float,2>{0.104141153f, 0.166565061f},
-std::array<float,2>{0.298030734f, 0.887814224f},
-std::array<float,2>{0.844154239f, 0.31017822f},
-std::array<float,2>{0.968151927f, 0.802011967f},
-std::array<float,2>{0.377884001f, 0.428463429f},
-std::array<float,2>{0.247025296f, 0.566518009f},
-std::array<float,2>{0.684064209f, 0.0271403026f},
-std::array<float,2>{0.894336462f, 0.729121923f},
-std::array<float,2>{0.476245731f, 0.214248389f},
-std::array<float,2>{0.138211697f, 0.93784982f},
-std::array<float,2>{0.736152768f, 0.348550767f},
-std::array<float,2>{0.59741801f, 0.869681358f},
-std::array<float,2>{0.0252524652f, 0.484415174f},
-std::array<float,2>{0.319776744f, 0.503617346f},
-std::array<float,2>{0.763602138f, 0.0749262199f},
-std::array<float,2>{0.635110855f, 0.611740351f},
-std::array<float,2>{0.216814503f, 0.0387053825f},
-std::array<float,2>{0.427947164f, 0.760338485f},
-std::array<float,2>{0.993639946f, 0.377349317f},
-std::array<float,2>{0.824727654f, 0.910272121f},
-std::array<float,2>{0.253559113f, 0.254643768f},
-std::array<float,2>{0.0678252429f, 0.682079852f},
-std::array<float,2>{0.554788411f, 0.134608164f},
-std::array<float,2>{0.977787614f, 0.579171836f},
-std::array<float,2>{0.420923442f, 0.00611029053f},
-std::array<float,2>{0.197337896f, 0.79618144f},
-std::array<float,2>{0.655900478f, 0.407921463f},
-std::array<float,2>{0.539732814f, 0.9061566f},
-std::array<float,2>{0.0873881429f, 0.286040366f},
-std::array<float,2>{0.279873282f, 0.652875781f},
-std::array<float,2>{0.834515214f, 0.186481297f},
-std::array<float,2>{0.726630449f, 0.715421081f},
-std::array<float,2>{0.146647081f, 0.234321579f},
-std::array<float,2>{0.489649028f, 0.999408245f},
-std::array<float,2>{0.890041232f, 0.338869482f},
-std::array<float,2>{0.770585358f, 0.818891227f},
-std::array<float,2>{0.342356086f, 0.457152665f},
-std::array<float,2>{0.000239653091f, 0.550238311f},
-std::array<float,2>{0.611605704f, 0.0937874764f},
-std::array<float,2>{0.86961031f, 0.659935713f},
-std::array<float,2>{0.295614064f, 0.142575428f},
-std::array<float,2>{0.119418837f, 0.933849573f},
-std::array<float,2>{0.527752101f, 0.271582514f},
-std::array<float,2>{0.662476718f, 0.776734233f},
-std::array<float,2>{0.234256834f, 0.394582421f},
-std::array<float,2>{0.400989443f, 0.608525455f},
-std::array<float,2>{0.945831656f, 0.0530396141f},
-std::array<float,2>{0.587850809f, 0.518936217f},
-std::array<float,2>{0.0567054711f, 0.0903876796f},
-std::array<float,2>{0.372273415f, 0.849393785f},
-std::array<float,2>{0.79019177f, 0.47093299f},
-std::array<float,2>{0.92326349f, 0.962696791f},
-std::array<float,2>{0.44058156f, 0.362710238f},
-std::array<float,2>{0.178241834f, 0.744861245f},
-std::array<float,2>{0.693391323f, 0.19178997f},
-std::array<float,2>{0.836158395f, 0.596678853f},
-std::array<float,2>{0.273043573f, 0.0612524711f},
-std::array<float,2>{0.0845669806f, 0.770220041f},
-std::array<float,2>{0.534843624f, 0.399791867f},
-std::array<float,2>{0.641832769f, 0.925404906f},
-std::array<float,2>{0.190534934f, 0.276641637f},
-std::array<float,2>{0.409708381f, 0.664655268f},
-std::array<float,2>{0.972704113f, 0.154965624f},
-std::array<float,2>{0.623799086f, 0.740570903f},
-std::array<float,2>{0.00862710364f, 0.19919537f},
-std::array<float,2>{0.332400143f, 0.960435092f},
-std::array<float,2>{0.773627758f, 0.373311639f},
-std::array<float,2>{0.87958926f, 0.8567186f},
-std::array<float,2>{0.493160576f, 0.477923691f},
-std::array<float,2>{0.1532657f, 0.529746115f},
-std::array<float,2>{0.726170123f, 0.0828969553f},
-std::array<float,2>{0.941800296f, 0.64693737f},
-std::array<float,2>{0.391046077f, 0.177709401f},
-std::array<float,2>{0.220127374f, 0.890908599f},
-std::array<float,2>{0.670774937f, 0.294091225f},
-std::array<float,2>{0.516790688f, 0.782650113f},
-std::array<float,2>{0.11621733f, 0.417285055f},
-std::array<float,2>{0.284370214f, 0.59017992f},
-std::array<float,2>{0.860839784f, 0.00979120843f},
-std::array<float,2>{0.696872115f, 0.559202731f},
-std::array<float,2>{0.184382543f, 0.101957962f},
-std::array<float,2>{0.447401822f, 0.826038182f},
-std::array<float,2>{0.933101773f, 0.467443496f},
-std::array<float,2>{0.782570541f, 0.986145258f},
-std::array<float,2>{0.36268276f, 0.330672622f},
-std::array<float,2>{0.0540460944f, 0.709713936f},
-std::array<float,2>{0.58163923f, 0.225943938f},
-std::array<float,2>{0.908562362f, 0.510276079f},
-std::array<float,2>{0.465771884f, 0.0637689754f},
-std::array<float,2>{0.165880039f, 0.862776875f},
-std::array<float,2>{0.708299875f, 0.493602872f},
-std::array<float,2>{0.565753579f, 0.950485349f},
-std::array<float,2>{0.0415204503f, 0.354891151f},
-std::array<float,2>{0.344186038f, 0.723387778f},
-std::array<float,2>{0.81119889f, 0.206259668f},
-std::array<float,2>{0.677916825f, 0.677491546f},
-std::array<float,2>{0.238611102f, 0.129681155f},
-std::array<float,2>{0.386254519f, 0.914501786f},
-std::array<float,2>{0.955735624f, 0.259888828f},
-std::array<float,2>{0.857540905f, 0.751695633f},
-std::array<float,2>{0.310414344f, 0.388744295f},
-std::array<float,2>{0.0978962481f, 0.618803859f},
-std::array<float,2>{0.512342751f, 0.040514607f},
-std::array<float,2>{0.753524721f, 0.699737251f},
-std::array<float,2>{0.326708406f, 0.245390147f},
-std::array<float,2>{0.0199354477f, 0.970328212f},
-std::array<float,2>{0.606149137f, 0.324930221f},
-std::array<float,2>{0.749983966f, 0.840165734f},
-std::array<float,2>{0.130125746f, 0.447792679f},
-std::array<float,2>{0.479397029f, 0.537475526f},
-std::array<float,2>{0.903137326f, 0.123663418f},
-std::array<float,2>{0.550570071f, 0.571952403f},
-std::array<float,2>{0.0759800598f, 0.0207057726f},
-std::array<float,2>{0.263383836f, 0.805874348f},
-std::array<float,2>{0.813610435f, 0.433083594f},
-std::array<float,2>{0.987527251f, 0.878799319f},
-std::array<float,2>{0.430107802f, 0.30383566f},
-std::array<float,2>{0.204832986f, 0.626144469f},
-std::array<float,2>{0.626517832f, 0.161980525f},
-std::array<float,2>{0.777672589f, 0.565005481f},
-std::array<float,2>{0.33094576f, 0.0296644848f},
-std::array<float,2>{0.0117555419f, 0.798151195f},
-std::array<float,2>{0.619949758f, 0.422867268f},
-std::array<float,2>{0.721701443f, 0.884162068f},
-std::array<float,2>{0.151835501f, 0.305278122f},
-std::array<float,2>{0.499923378f, 0.636609316f},
-std::array<float,2>{0.877361476f, 0.171100512f},
-std::array<float,2>{0.537156403f, 0.689009488f},
-std::array<float,2>{0.0819310099f, 0.23897095f},
-std::array<float,2>{0.266009152f, 0.977534592f},
-std::array<float,2>{0.842688859f, 0.316141218f},
-std::array<float,2>{0.971622407f, 0.83329165f},
-std::array<float,2>{0.412813276f, 0.441989899f},
-std::array<float,2>{0.19169879f, 0.546570778f},
-std::array<float,2>{0.644631326f, 0.110932656f},
-std::array<float,2>{0.935093343f, 0.684139669f},
-std::array<float,2>{0.449816942f, 0.138249606f},
-std::array<float,2>{0.181207255f, 0.909723103f},
-std::array<float,2>{0.702518821f, 0.253109396f},
-std::array<float,2>{0.582777977f, 0.761978328f},
-std::array<float,2>{0.0486562513f, 0.379551262f},
-std::array<float,2>{0.36501351f, 0.614618301f},
-std::array<float,2>{0.788961828f, 0.0346656665f},
-std::array<float,2>{0.664923549f, 0.506319284f},
-std::array<float,2>{0.226348341f, 0.0713471174f},
-std::array<float,2>{0.397417814f, 0.87193805f},
-std::array<float,2>{0.9384709f, 0.490601331f},
-std::array<float,2>{0.864284039f, 0.943264484f},
-std::array<float,2>{0.288963705f, 0.346457958f},
-std::array<float,2>{0.11185129f, 0.732873976f},
-std::array<float,2>{0.523297846f, 0.216225028f},
-std::array<float,2>{0.957721651f, 0.554049373f},
-std::array<float,2>{0.387301922f, 0.100464031f},
-std::array<float,2>{0.237994805f, 0.816261232f},
-std::array<float,2>{0.674431384f, 0.456098795f},
-std::array<float,2>{0.510506153f, 0.992811263f},
-std::array<float,2>{0.0952542275f, 0.343519658f},
-std::array<float,2>{0.307625711f, 0.714488447f},
-std::array<float,2>{0.853543401f, 0.227500781f},
-std::array<float,2>{0.704221964f, 0.649231493f},
-std::array<float,2>{0.171494722f, 0.180840567f},
-std::array<float,2>{0.464617372f, 0.901180387f},
-std::array<float,2>{0.911392272f, 0.282097399f},
-std::array<float,2>{0.808154702f, 0.792931557f},
-std::array<float,2>{0.350271195f, 0.41339156f},
-std::array<float,2>{0.0467637405f, 0.583779454f},
-std::array<float,2>{0.569926441f, 0.00321330596f},
-std::array<float,2>{0.819353223f, 0.746158302f},
-std::array<float,2>{0.260933727f, 0.1877314f},
-std::array<float,2>{0.0720036328f, 0.966904402f},
-std::array<float,2>{0.554114223f, 0.36333093f},
-std::array<float,2>{0.629203677f, 0.84655112f},
-std::array<float,2>{0.208358034f, 0.476118416f},
-std::array<float,2>{0.435192794f, 0.522637367f},
-std::array<float,2>{0.988615453f, 0.0867361128f},
-std::array<float,2>{0.604933202f, 0.603922784f},
-std::array<float,2>{0.0168974362f, 0.0492353365f},
-std::array<float,2>{0.322571367f, 0.779071629f},
-std::array<float,2>{0.755663395f, 0.392970353f},
-std::array<float,2>{0.900192916f, 0.93143779f},
-std::array<float,2>{0.480660409f, 0.265898854f},
-std::array<float,2>{0.126265198f, 0.661183774f},
-std::array<float,2>{0.743904412f, 0.147255555f},
-std::array<float,2>{0.848929524f, 0.523856223f},
-std::array<float,2>{0.301091969f, 0.0805644244f},
-std::array<float,2>{0.107061327f, 0.854507327f},
-std::array<float,2>{0.502808511f, 0.480784327f},
-std::array<float,2>{0.682205081f, 0.955256164f},
-std::array<float,2>{0.24244529f, 0.367849529f},
-std::array<float,2>{0.379414737f, 0.737077415f},
-std::array<float,2>{0.96210587f, 0.200149f},
-std::array<float,2>{0.573750138f, 0.671595216f},
-std::array<float,2>{0.0357926078f, 0.151815146f},
-std::array<float,2>{0.355842054f, 0.926425636f},
-std::array<float,2>{0.801371396f, 0.27891618f},
-std::array<float,2>{0.915045857f, 0.766649127f},
-std::array<float,2>{0.457553148f, 0.404829204f},
-std::array<float,2>{0.162667036f, 0.597926915f},
-std::array<float,2>{0.712606966f, 0.0550319068f},
-std::array<float,2>{0.99924165f, 0.705042422f},
-std::array<float,2>{0.423005551f, 0.221550092f},
-std::array<float,2>{0.213889673f, 0.990071595f},
-std::array<float,2>{0.640383005f, 0.332415968f},
-std::array<float,2>{0.558808625f, 0.821026623f},
-std::array<float,2>{0.064162299f, 0.463061839f},
-std::array<float,2>{0.2565777f, 0.55629611f},
-std::array<float,2>{0.822007239f, 0.105955973f},
-std::array<float,2>{0.740602911f, 0.587782979f},
-std::array<float,2>{0.134741858f, 0.0146459611f},
-std::array<float,2>{0.47046271f, 0.788409173f},
-std::array<float,2>{0.895170927f, 0.418733954f},
-std::array<float,2>{0.761564791f, 0.897816956f},
-std::array<float,2>{0.314660877f, 0.290198058f},
-std::array<float,2>{0.0277723204f, 0.643580616f},
-std::array<float,2>{0.601229846f, 0.174427912f},
-std::array<float,2>{0.883016288f, 0.622771621f},
-std::array<float,2>{0.487982512f, 0.0443671159f},
-std::array<float,2>{0.142961696f, 0.753920138f},
-std::array<float,2>{0.732062101f, 0.386123896f},
-std::array<float,2>{0.613856435f, 0.919387221f},
-std::array<float,2>{0.00568828918f, 0.262380183f},
-std::array<float,2>{0.338183731f, 0.673915267f},
-std::array<float,2>{0.767045498f, 0.126586676f},
-std::array<float,2>{0.648532927f, 0.721701503f},
-std::array<float,2>{0.201771945f, 0.210633487f},
-std::array<float,2>{0.415768445f, 0.948591948f},
-std::array<float,2>{0.982678533f, 0.358940631f},
-std::array<float,2>{0.831659436f, 0.866237164f},
-std::array<float,2>{0.274813861f, 0.497846365f},
-std::array<float,2>{0.0922213644f, 0.515342176f},
-std::array<float,2>{0.545297205f, 0.0670982823f},
-std::array<float,2>{0.796598017f, 0.632169604f},
-std::array<float,2>{0.368603349f, 0.15813984f},
-std::array<float,2>{0.0622399785f, 0.880235195f},
-std::array<float,2>{0.591685951f, 0.299007654f},
-std::array<float,2>{0.689637661f, 0.810501933f},
-std::array<float,2>{0.173086047f, 0.436917096f},
-std::array<float,2>{0.444284946f, 0.577753007f},
-std::array<float,2>{0.927154899f, 0.0174042024f},
-std::array<float,2>{0.525204122f, 0.532245815f},
-std::array<float,2>{0.124716237f, 0.118235677f},
-std::array<float,2>{0.291066468f, 0.836800694f},
-std::array<float,2>{0.874628365f, 0.449301243f},
-std::array<float,2>{0.952913284f, 0.976485193f},
-std::array<float,2>{0.403153479f, 0.323436737f},
-std::array<float,2>{0.229718506f, 0.698311627f},
-std::array<float,2>{0.658604562f, 0.246126786f},
-std::array<float,2>{0.764017344f, 0.5018664f},
-std::array<float,2>{0.316635072f, 0.0764885992f},
-std::array<float,2>{0.0262327082f, 0.869030714f},
-std::array<float,2>{0.595561802f, 0.488025039f},
-std::array<float,2>{0.736594379f, 0.940126777f},
-std::array<float,2>{0.139247775f, 0.350058734f},
-std::array<float,2>{0.472712815f, 0.727856696f},
-std::array<float,2>{0.891888142f, 0.211012393f},
-std::array<float,2>{0.558242083f, 0.680276632f},
-std::array<float,2>{0.0701393336f, 0.13536647f},
-std::array<float,2>{0.250068754f, 0.913072705f},
-std::array<float,2>{0.826870978f, 0.257688433f},
-std::array<float,2>{0.995936692f, 0.758012712f},
-std::array<float,2>{0.42753759f, 0.376605093f},
-std::array<float,2>{0.215781704f, 0.610749722f},
-std::array<float,2>{0.634601295f, 0.0368160494f},
-std::array<float,2>{0.918479919f, 0.692501962f},
-std::array<float,2>{0.453284621f, 0.234460697f},
-std::array<float,2>{0.157873929f, 0.980835259f},
-std::array<float,2>{0.715367019f, 0.320016325f},
-std::array<float,2>{0.577883661f, 0.828964412f},
-std::array<float,2>{0.034582559f, 0.438594759f},
-std::array<float,2>{0.353592992f, 0.540605545f},
-std::array<float,2>{0.799421728f, 0.113868453f},
-std::array<float,2>{0.685996532f, 0.568937898f},
-std::array<float,2>{0.249225691f, 0.0246720873f},
-std::array<float,2>{0.37654683f, 0.803378344f},
-std::array<float,2>{0.965145469f, 0.425862551f},
-std::array<float,2>{0.846118271f, 0.889577985f},
-std::array<float,2>{0.300362587f, 0.311392516f},
-std::array<float,2>{0.103277214f, 0.639692187f},
-std::array<float,2>{0.505733848f, 0.165324003f},
-std::array<float,2>{0.94903636f, 0.605990231f},
-std::array<float,2>{0.399840772f, 0.0519764945f},
-std::array<float,2>{0.231203169f, 0.773455501f},
-std::array<float,2>{0.660585999f, 0.398369282f},
-std::array<float,2>{0.531079769f, 0.935607076f},
-std::array<float,2>{0.117869474f, 0.270064592f},
-std::array<float,2>{0.293814361f, 0.657556772f},
-std::array<float,2>{0.86880821f, 0.142648056f},
-std::array<float,2>{0.692435384f, 0.743365884f},
-std::array<float,2>{0.176869959f, 0.195173442f},
-std::array<float,2>{0.438784629f, 0.964299142f},
-std::array<float,2>{0.924069166f, 0.361201912f},
-std::array<float,2>{0.792801797f, 0.850503266f},
-std::array<float,2>{0.374319017f, 0.470231831f},
-std::array<float,2>{0.0561016798f, 0.516738892f},
-std::array<float,2>{0.5896191f, 0.0930955857f},
-std::array<float,2>{0.833640337f, 0.654325247f},
-std::array<float,2>{0.277869672f, 0.184512198f},
-std::array<float,2>{0.0893903673f, 0.902824819f},
-std::array<float,2>{0.542316735f, 0.287334591f},
-std::array<float,2>{0.65334183f, 0.793614388f},
-std::array<float,2>{0.196477547f, 0.409058154f},
-std::array<float,2>{0.419045448f, 0.581824958f},
-std::array<float,2>{0.978654623f, 0.00499128457f},
-std::array<float,2>{0.609858394f, 0.547373354f},
-std::array<float,2>{0.00207675132f, 0.0967837423f},
-std::array<float,2>{0.341199189f, 0.816887021f},
-std::array<float,2>{0.771566808f, 0.459659725f},
-std::array<float,2>{0.887257278f, 0.997216821f},
-std::array<float,2>{0.490580469f, 0.335968554f},
-std::array<float,2>{0.146017358f, 0.717069566f},
-std::array<float,2>{0.73033601f, 0.230990112f},
-std::array<float,2>{0.862427473f, 0.591892898f},
-std::array<float,2>{0.281282246f, 0.00919045135f},
-std::array<float,2>{0.113773823f, 0.784143567f},
-std::array<float,2>{0.519471169f, 0.415751666f},
-std::array<float,2>{0.669123828f, 0.894165874f},
-std::array<float,2>{0.220966786f, 0.294991672f},
-std::array<float,2>{0.392607778f, 0.645638704f},
-std::array<float,2>{0.944534302f, 0.178166926f},
-std::array<float,2>{0.579071999f, 0.707391739f},
-std::array<float,2>{0.0511349477f, 0.223434374f},
-std::array<float,2>{0.360059619f, 0.987483025f},
-std::array<float,2>{0.785013437f, 0.329352438f},
-std::array<float,2>{0.931392074f, 0.827912211f},
-std::array<float,2>{0.445883989f, 0.466635704f},
-std::array<float,2>{0.186523587f, 0.562421799f},
-std::array<float,2>{0.697440386f, 0.103767708f},
-std::array<float,2>{0.974886894f, 0.667258203f},
-std::array<float,2>{0.407789081f, 0.152526483f},
-std::array<float,2>{0.18774049f, 0.922908366f},
-std::array<float,2>{0.643006444f, 0.274255991f},
-std::array<float,2>{0.532372653f, 0.771974742f},
-std::array<float,2>{0.0836804137f, 0.402016997f},
-std::array<float,2>{0.269831419f, 0.594124258f},
-std::array<float,2>{0.838709712f, 0.0590268783f},
-std::array<float,2>{0.724020541f, 0.528862298f},
-std::array<float,2>{0.154582515f, 0.0841218308f},
-std::array<float,2>{0.494612992f, 0.85874027f},
-std::array<float,2>{0.882550716f, 0.479982138f},
-std::array<float,2>{0.776662827f, 0.958423674f},
-std::array<float,2>{0.334626049f, 0.372159898f},
-std::array<float,2>{0.0111440774f, 0.738336921f},
-std::array<float,2>{0.622734427f, 0.196324766f},
-std::array<float,2>{0.905217707f, 0.536316335f},
-std::array<float,2>{0.47704339f, 0.12229871f},
-std::array<float,2>{0.131761655f, 0.8420102f},
-std::array<float,2>{0.747440219f, 0.445447803f},
-std::array<float,2>{0.608203948f, 0.970882952f},
-std::array<float,2>{0.0218393318f, 0.328065127f},
-std::array<float,2>{0.325825572f, 0.702853978f},
-std::array<float,2>{0.750200748f, 0.242291301f},
-std::array<float,2>{0.628533721f, 0.628442883f},
-std::array<float,2>{0.20616141f, 0.162717953f},
-std::array<float,2>{0.431643486f, 0.876376808f},
-std::array<float,2>{0.986035466f, 0.300832063f},
-std::array<float,2>{0.815600038f, 0.807503402f},
-std::array<float,2>{0.263829887f, 0.431486994f},
-std::array<float,2>{0.0767694488f, 0.573083639f},
-std::array<float,2>{0.546898603f, 0.0228945371f},
-std::array<float,2>{0.809789181f, 0.725429118f},
-std::array<float,2>{0.347311825f, 0.204292387f},
-std::array<float,2>{0.0391624048f, 0.951330602f},
-std::array<float,2>{0.563318968f, 0.353230774f},
-std::array<float,2>{0.710852563f, 0.860882998f},
-std::array<float,2>{0.166285843f, 0.495940298f},
-std::array<float,2>{0.46866104f, 0.509625971f},
-std::array<float,2>{0.906738043f, 0.0645162538f},
-std::array<float,2>{0.513881743f, 0.62058562f},
-std::array<float,2>{0.0998195112f, 0.0417631157f},
-std::array<float,2>{0.310806662f, 0.752363861f},
-std::array<float,2>{0.856308103f, 0.387285292f},
-std::array<float,2>{0.953888297f, 0.916285992f},
-std::array<float,2>{0.384748906f, 0.258459061f},
-std::array<float,2>{0.240384758f, 0.67791611f},
-std::array<float,2>{0.67721951f, 0.131886125f},
-std::array<float,2>{0.786599338f, 0.616385698f},
-std::array<float,2>{0.366789281f, 0.0313410461f},
-std::array<float,2>{0.0494205803f, 0.764291942f},
-std::array<float,2>{0.58448422f, 0.380972266f},
-std::array<float,2>{0.700615823f, 0.906638622f},
-std::array<float,2>{0.183522701f, 0.25066331f},
-std::array<float,2>{0.451535672f, 0.685618043f},
-std::array<float,2>{0.937037766f, 0.139422849f},
-std::array<float,2>{0.520116866f, 0.732081413f},
-std::array<float,2>{0.109950766f, 0.218379989f},
-std::array<float,2>{0.286316186f, 0.943407595f},
-std::array<float,2>{0.865952253f, 0.345501482f},
-std::array<float,2>{0.939995527f, 0.873074412f},
-std::array<float,2>{0.395259351f, 0.489762366f},
-std::array<float,2>{0.22447212f, 0.50578326f},
-std::array<float,2>{0.66705811f, 0.07290712f},
-std::array<float,2>{0.876622081f, 0.634532094f},
-std::array<float,2>{0.496848583f, 0.169875577f},
-std::array<float,2>{0.148682237f, 0.88598752f},
-std::array<float,2>{0.719687998f, 0.307574093f},
-std::array<float,2>{0.617782295f, 0.799831927f},
-std::array<float,2>{0.0144574037f, 0.424544424f},
-std::array<float,2>{0.329031885f, 0.56425339f},
-std::array<float,2>{0.779678702f, 0.0279584806f},
-std::array<float,2>{0.647611201f, 0.542992473f},
-std::array<float,2>{0.194541648f, 0.112181477f},
-std::array<float,2>{0.410463065f, 0.83433497f},
-std::array<float,2>{0.969754875f, 0.44337061f},
-std::array<float,2>{0.841303825f, 0.978705227f},
-std::array<float,2>{0.268691808f, 0.312828392f},
-std::array<float,2>{0.0800748169f, 0.69113946f},
-std::array<float,2>{0.535335124f, 0.241353154f},
-std::array<float,2>{0.991090417f, 0.519854605f},
-std::array<float,2>{0.435876578f, 0.0879607275f},
-std::array<float,2>{0.209372267f, 0.845187843f},
-std::array<float,2>{0.6321311f, 0.472974867f},
-std::array<float,2>{0.550951004f, 0.966315448f},
-std::array<float,2>{0.0735779479f, 0.365828454f},
-std::array<float,2>{0.258578569f, 0.749139607f},
-std::array<float,2>{0.817682147f, 0.190289333f},
-std::array<float,2>{0.745265543f, 0.66369015f},
-std::array<float,2>{0.128687188f, 0.145808473f},
-std::array<float,2>{0.482647687f, 0.932251096f},
-std::array<float,2>{0.90071094f, 0.26834619f},
-std::array<float,2>{0.755959928f, 0.780790448f},
-std::array<float,2>{0.321688175f, 0.391501814f},
-std::array<float,2>{0.0186947882f, 0.603458166f},
-std::array<float,2>{0.603423953f, 0.0478127524f},
-std::array<float,2>{0.853179932f, 0.71121937f},
-std::array<float,2>{0.306108087f, 0.230193332f},
-std::array<float,2>{0.0957412496f, 0.99448961f},
-std::array<float,2>{0.509735107f, 0.341584861f},
-std::array<float,2>{0.672536314f, 0.81377387f},
-std::array<float,2>{0.236164421f, 0.453248829f},
-std::array<float,2>{0.389048934f, 0.550868094f},
-std::array<float,2>{0.960446358f, 0.0985566676f},
-std::array<float,2>{0.566625834f, 0.584990621f},
-std::array<float,2>{0.0446169116f, 0.000366364286f},
-std::array<float,2>{0.347862035f, 0.791015208f},
-std::array<float,2>{0.806250632f, 0.411981195f},
-std::array<float,2>{0.912529886f, 0.898775935f},
-std::array<float,2>{0.461283833f, 0.283839077f},
-std::array<float,2>{0.168116167f, 0.651234806f},
-std::array<float,2>{0.705078542f, 0.183009565f},
-std::array<float,2>{0.823736012f, 0.55744493f},
-std::array<float,2>{0.255172074f, 0.108977973f},
-std::array<float,2>{0.0653297156f, 0.822287321f},
-std::array<float,2>{0.562006712f, 0.461011648f},
-std::array<float,2>{0.637676954f, 0.9904387f},
-std::array<float,2>{0.211708874f, 0.334011078f},
-std::array<float,2>{0.42498827f, 0.705687881f},
-std::array<float,2>{0.997280478f, 0.220654532f},
-std::array<float,2>{0.598985136f, 0.640841305f},
-std::array<float,2>{0.0305378158f, 0.173089921f},
-std::array<float,2>{0.313526154f, 0.895136058f},
-std::array<float,2>{0.759102046f, 0.291887075f},
-std::array<float,2>{0.896996439f, 0.786811292f},
-std::array<float,2>{0.47093153f, 0.421155304f},
-std::array<float,2>{0.135927796f, 0.588689446f},
-std::array<float,2>{0.739185393f, 0.0119790956f},
-std::array<float,2>{0.963358402f, 0.735919595f},
-std::array<float,2>{0.3818115f, 0.202418119f},
-std::array<float,2>{0.244504064f, 0.953689337f},
-std::array<float,2>{0.679913104f, 0.370804131f},
-std::array<float,2>{0.500314057f, 0.852483869f},
-std::array<float,2>{0.108684704f, 0.48415184f},
-std::array<float,2>{0.30404529f, 0.52573365f},
-std::array<float,2>{0.849735677f, 0.0782947391f},
-std::array<float,2>{0.713921666f, 0.599993706f},
-std::array<float,2>{0.161857665f, 0.0574228168f},
-std::array<float,2>{0.459563851f, 0.768882215f},
-std::array<float,2>{0.91622448f, 0.403039724f},
-std::array<float,2>{0.803570926f, 0.929477394f},
-std::array<float,2>{0.358440012f, 0.280557364f},
-std::array<float,2>{0.0374205709f, 0.668914974f},
-std::array<float,2>{0.57150805f, 0.149047583f},
-std::array<float,2>{0.929638445f, 0.574582338f},
-std::array<float,2>{0.442906171f, 0.0179718826f},
-std::array<float,2>{0.174960747f, 0.811530888f},
-std::array<float,2>{0.687906682f, 0.433971286f},
-std::array<float,2>{0.593033314f, 0.882258952f},
-std::array<float,2>{0.0600078925f, 0.298376799f},
-std::array<float,2>{0.369158059f, 0.629322171f},
-std::array<float,2>{0.79367739f, 0.158738732f},
-std::array<float,2>{0.657275081f, 0.696703792f},
-std::array<float,2>{0.227919981f, 0.24917312f},
-std::array<float,2>{0.404677987f, 0.97370851f},
-std::array<float,2>{0.951087832f, 0.321878344f},
-std::array<float,2>{0.872339547f, 0.839208543f},
-std::array<float,2>{0.290874153f, 0.452972591f},
-std::array<float,2>{0.122583695f, 0.535133839f},
-std::array<float,2>{0.526781976f, 0.119789861f},
-std::array<float,2>{0.768293738f, 0.672263205f},
-std::array<float,2>{0.337397993f, 0.127007619f},
-std::array<float,2>{0.00727063464f, 0.921344817f},
-std::array<float,2>{0.615276873f, 0.264608741f},
-std::array<float,2>{0.733053863f, 0.756889522f},
-std::array<float,2>{0.140757173f, 0.383429676f},
-std::array<float,2>{0.484554708f, 0.623184264f},
-std::array<float,2>{0.884921074f, 0.0456446931f},
-std::array<float,2>{0.544276893f, 0.512623847f},
-std::array<float,2>{0.090315029f, 0.068904534f},
-std::array<float,2>{0.275624692f, 0.864624798f},
-std::array<float,2>{0.829912066f, 0.499736547f},
-std::array<float,2>{0.980953395f, 0.946978927f},
-std::array<float,2>{0.417881727f, 0.356236368f},
-std::array<float,2>{0.200321421f, 0.720294416f},
-std::array<float,2>{0.650407076f, 0.207748353f},
-std::array<float,2>{0.810818136f, 0.50899756f},
-std::array<float,2>{0.344408393f, 0.0654051825f},
-std::array<float,2>{0.0413649566f, 0.860728025f},
-std::array<float,2>{0.565922678f, 0.495448083f},
-std::array<float,2>{0.708604872f, 0.952128232f},
-std::array<float,2>{0.165084526f, 0.352655381f},
-std::array<float,2>{0.465009123f, 0.724704325f},
-std::array<float,2>{0.909023702f, 0.204742402f},
-std::array<float,2>{0.512158811f, 0.67854321f},
-std::array<float,2>{0.0981471539f, 0.132445633f},
-std::array<float,2>{0.309637964f, 0.916731715f},
-std::array<float,2>{0.858240783f, 0.258055568f},
-std::array<float,2>{0.955353022f, 0.752703846f},
-std::array<float,2>{0.385835588f, 0.387115002f},
-std::array<float,2>{0.238969043f, 0.620631695f},
-std::array<float,2>{0.678439319f, 0.0410333239f},
-std::array<float,2>{0.902469456f, 0.702329755f},
-std::array<float,2>{0.478742659f, 0.242702559f},
-std::array<float,2>{0.13084434f, 0.971305907f},
-std::array<float,2>{0.749109447f, 0.327584118f},
-std::array<float,2>{0.605629742f, 0.842496932f},
-std::array<float,2>{0.0204607509f, 0.446264803f},
-std::array<float,2>{0.326489091f, 0.536715269f},
-std::array<float,2>{0.753146052f, 0.122784495f},
-std::array<float,2>{0.626238883f, 0.572732687f},
-std::array<float,2>{0.204442635f, 0.0229508467f},
-std::array<float,2>{0.430371195f, 0.806983829f},
-std::array<float,2>{0.987806439f, 0.430765599f},
-std::array<float,2>{0.814203203f, 0.876643479f},
-std::array<float,2>{0.262984514f, 0.301450372f},
-std::array<float,2>{0.075493671f, 0.628016651f},
-std::array<float,2>{0.550015867f, 0.162416428f},
-std::array<float,2>{0.973345935f, 0.594295442f},
-std::array<float,2>{0.409500808f, 0.0591289029f},
-std::array<float,2>{0.191365257f, 0.77177465f},
-std::array<float,2>{0.642278075f, 0.401751935f},
-std::array<float,2>{0.534362197f, 0.923591614f},
-std::array<float,2>{0.0843243152f, 0.273717344f},
-std::array<float,2>{0.272733241f, 0.667761624f},
-std::array<float,2>{0.836589992f, 0.153308287f},
-std::array<float,2>{0.725837708f, 0.738900244f},
-std::array<float,2>{0.152830184f, 0.197248682f},
-std::array<float,2>{0.492311656f, 0.958648324f},
-std::array<float,2>{0.879307449f, 0.372968465f},
-std::array<float,2>{0.774038017f, 0.858991563f},
-std::array<float,2>{0.332585603f, 0.479771048f},
-std::array<float,2>{0.00782372989f, 0.528738141f},
-std::array<float,2>{0.623235464f, 0.0845404565f},
-std::array<float,2>{0.861139119f, 0.64643991f},
-std::array<float,2>{0.284766525f, 0.178591862f},
-std::array<float,2>{0.117072143f, 0.893965244f},
-std::array<float,2>{0.517361879f, 0.29579401f},
-std::array<float,2>{0.670262218f, 0.783599198f},
-std::array<float,2>{0.220535964f, 0.41550526f},
-std::array<float,2>{0.391396463f, 0.592565358f},
-std::array<float,2>{0.942094803f, 0.0095197428f},
-std::array<float,2>{0.581155002f, 0.561554432f},
-std::array<float,2>{0.0542347319f, 0.104088485f},
-std::array<float,2>{0.362989932f, 0.827256799f},
-std::array<float,2>{0.783080876f, 0.466096699f},
-std::array<float,2>{0.933347285f, 0.98824507f},
-std::array<float,2>{0.447878033f, 0.329667836f},
-std::array<float,2>{0.183898985f, 0.708005905f},
-std::array<float,2>{0.696444571f, 0.223021299f},
-std::array<float,2>{0.834089339f, 0.581297696f},
-std::array<float,2>{0.279586852f, 0.0057656616f},
-std::array<float,2>{0.0878246129f, 0.793255985f},
-std::array<float,2>{0.539501607f, 0.408388942f},
-std::array<float,2>{0.655567348f, 0.903143942f},
-std::array<float,2>{0.197923243f, 0.287941635f},
-std::array<float,2>{0.421478242f, 0.6548509f},
-std::array<float,2>{0.978313386f, 0.183886826f},
-std::array<float,2>{0.612303972f, 0.717486501f},
-std::array<float,2>{0.000974907307f, 0.230726838f},
-std::array<float,2>{0.341819197f, 0.997563899f},
-std::array<float,2>{0.771137238f, 0.336462647f},
-std::array<float,2>{0.890461266f, 0.816922069f},
-std::array<float,2>{0.490014434f, 0.45915705f},
-std::array<float,2>{0.147049621f, 0.547304273f},
-std::array<float,2>{0.727478027f, 0.0972503871f},
-std::array<float,2>{0.945592165f, 0.657790422f},
-std::array<float,2>{0.400771409f, 0.143375874f},
-std::array<float,2>{0.233775988f, 0.936243117f},
-std::array<float,2>{0.662802279f, 0.269584626f},
-std::array<float,2>{0.528210878f, 0.774321139f},
-std::array<float,2>{0.120036282f, 0.39759928f},
-std::array<float,2>{0.294976234f, 0.605520785f},
-std::array<float,2>{0.869808614f, 0.0526843332f},
-std::array<float,2>{0.693944216f, 0.517461538f},
-std::array<float,2>{0.17798394f, 0.0936542079f},
-std::array<float,2>{0.441350669f, 0.849840641f},
-std::array<float,2>{0.92335242f, 0.46987313f},
-std::array<float,2>{0.790538192f, 0.964657068f},
-std::array<float,2>{0.372881144f, 0.360699028f},
-std::array<float,2>{0.0573378131f, 0.743740797f},
-std::array<float,2>{0.587093055f, 0.194740683f},
-std::array<float,2>{0.920191407f, 0.540178418f},
-std::array<float,2>{0.455430508f, 0.113628432f},
-std::array<float,2>{0.158285245f, 0.828314185f},
-std::array<float,2>{0.716991067f, 0.439209074f},
-std::array<float,2>{0.575502813f, 0.981408417f},
-std::array<float,2>{0.0313596912f, 0.319598079f},
-std::array<float,2>{0.353002757f, 0.693159223f},
-std::array<float,2>{0.796939552f, 0.235144913f},
-std::array<float,2>{0.684090614f, 0.640251815f},
-std::array<float,2>{0.24616994f, 0.165965915f},
-std::array<float,2>{0.377285302f, 0.889025927f},
-std::array<float,2>{0.968514562f, 0.310834467f},
-std::array<float,2>{0.844359517f, 0.803018689f},
-std::array<float,2>{0.298576266f, 0.426433146f},
-std::array<float,2>{0.103598855f, 0.568559408f},
-std::array<float,2>{0.506830931f, 0.0250328425f},
-std::array<float,2>{0.762927592f, 0.728135169f},
-std::array<float,2>{0.320062488f, 0.211455271f},
-std::array<float,2>{0.024447294f, 0.93966496f},
-std::array<float,2>{0.597058356f, 0.350444138f},
-std::array<float,2>{0.735678971f, 0.868283927f},
-std::array<float,2>{0.137911633f, 0.487316638f},
-std::array<float,2>{0.475880861f, 0.50140214f},
-std::array<float,2>{0.893605888f, 0.0767444372f},
-std::array<float,2>{0.555642366f, 0.61101377f},
-std::array<float,2>{0.0680649728f, 0.0363400728f},
-std::array<float,2>{0.253311813f, 0.7585814f},
-std::array<float,2>{0.824468851f, 0.376338065f},
-std::array<float,2>{0.993791759f, 0.912266612f},
-std::array<float,2>{0.428241253f, 0.257085919f},
-std::array<float,2>{0.217361867f, 0.679984152f},
-std::array<float,2>{0.635558426f, 0.134859383f},
-std::array<float,2>{0.767206609f, 0.623598039f},
-std::array<float,2>{0.338407159f, 0.0449330285f},
-std::array<float,2>{0.00521552563f, 0.757627964f},
-std::array<float,2>{0.613568723f, 0.382903248f},
-std::array<float,2>{0.731538594f, 0.921673596f},
-std::array<float,2>{0.143480808f, 0.263954818f},
-std::array<float,2>{0.48739168f, 0.672639549f},
-std::array<float,2>{0.883412898f, 0.127485022f},
-std::array<float,2>{0.545584202f, 0.719929993f},
-std::array<float,2>{0.092562221f, 0.207201943f},
-std::array<float,2>{0.275106251f, 0.946748674f},
-std::array<float,2>{0.831366718f, 0.355561614f},
-std::array<float,2>{0.983152926f, 0.86492002f},
-std::array<float,2>{0.41535908f, 0.499291718f},
-std::array<float,2>{0.201398909f, 0.512085795f},
-std::array<float,2>{0.648950517f, 0.0687708259f},
-std::array<float,2>{0.927295744f, 0.629540861f},
-std::array<float,2>{0.443451107f, 0.158420548f},
-std::array<float,2>{0.173487172f, 0.882666171f},
-std::array<float,2>{0.690416574f, 0.2980389f},
-std::array<float,2>{0.591193914f, 0.812107444f},
-std::array<float,2>{0.0619103089f, 0.434134752f},
-std::array<float,2>{0.369123518f, 0.575194716f},
-std::array<float,2>{0.79613775f, 0.0183648076f},
-std::array<float,2>{0.658935547f, 0.53459233f},
-std::array<float,2>{0.230285749f, 0.119219065f},
-std::array<float,2>{0.402706206f, 0.839630902f},
-std::array<float,2>{0.95216161f, 0.452406198f},
-std::array<float,2>{0.874057353f, 0.974255621f},
-std::array<float,2>{0.291961342f, 0.321591526f},
-std::array<float,2>{0.124415822f, 0.696831703f},
-std::array<float,2>{0.524883449f, 0.249742702f},
-std::array<float,2>{0.962576687f, 0.5262447f},
-std::array<float,2>{0.379139632f, 0.0787197575f},
-std::array<float,2>{0.242905959f, 0.851641834f},
-std::array<float,2>{0.681902587f, 0.483475745f},
-std::array<float,2>{0.502429485f, 0.953368008f},
-std::array<float,2>{0.10685043f, 0.370375752f},
-std::array<float,2>{0.301289737f, 0.735796034f},
-std::array<float,2>{0.849310696f, 0.202927485f},
-std::array<float,2>{0.712141275f, 0.66829741f},
-std::array<float,2>{0.162451863f, 0.148925096f},
-std::array<float,2>{0.457072407f, 0.928876996f},
-std::array<float,2>{0.91589272f, 0.281227201f},
-std::array<float,2>{0.800875068f, 0.769321203f},
-std::array<float,2>{0.356369734f, 0.402501911f},
-std::array<float,2>{0.0354077034f, 0.600117981f},
-std::array<float,2>{0.573476613f, 0.0569092147f},
-std::array<float,2>{0.821366429f, 0.705324113f},
-std::array<float,2>{0.256166309f, 0.22012566f},
-std::array<float,2>{0.0637049675f, 0.990903616f},
-std::array<float,2>{0.559499621f, 0.334901631f},
-std::array<float,2>{0.640065432f, 0.823096752f},
-std::array<float,2>{0.214597657f, 0.461623311f},
-std::array<float,2>{0.423375517f, 0.556766748f},
-std::array<float,2>{0.999770463f, 0.108470753f},
-std::array<float,2>{0.600610971f, 0.587998629f},
-std::array<float,2>{0.0281296447f, 0.012691942f},
-std::array<float,2>{0.315274447f, 0.786486149f},
-std::array<float,2>{0.761027753f, 0.421447128f},
-std::array<float,2>{0.894893646f, 0.894635499f},
-std::array<float,2>{0.470050871f, 0.291015983f},
-std::array<float,2>{0.134207994f, 0.641377985f},
-std::array<float,2>{0.741087973f, 0.1736103f},
-std::array<float,2>{0.854025781f, 0.551516354f},
-std::array<float,2>{0.308489859f, 0.0978947729f},
-std::array<float,2>{0.0950945616f, 0.814392805f},
-std::array<float,2>{0.510228872f, 0.453984946f},
-std::array<float,2>{0.673838377f, 0.994682193f},
-std::array<float,2>{0.237619534f, 0.340931654f},
-std::array<float,2>{0.386977434f, 0.71145308f},
-std::array<float,2>{0.957211733f, 0.229772523f},
-std::array<float,2>{0.569772422f, 0.65052098f},
-std::array<float,2>{0.0462145209f, 0.183291107f},
-std::array<float,2>{0.349986315f, 0.899411023f},
-std::array<float,2>{0.807985365f, 0.283338189f},
-std::array<float,2>{0.911697567f, 0.790061355f},
-std::array<float,2>{0.464299679f, 0.411511809f},
-std::array<float,2>{0.171206057f, 0.585754275f},
-std::array<float,2>{0.704827905f, 0.00055401487f},
-std::array<float,2>{0.989045858f, 0.74956131f},
-std::array<float,2>{0.434803814f, 0.189488843f},
-std::array<float,2>{0.208848298f, 0.965981781f},
-std::array<float,2>{0.629823089f, 0.365717858f},
-std::array<float,2>{0.554670215f, 0.845442295f},
-std::array<float,2>{0.0717604533f, 0.473450422f},
-std::array<float,2>{0.261586666f, 0.520441711f},
-std::array<float,2>{0.820241034f, 0.0887821391f},
-std::array<float,2>{0.74329263f, 0.602894425f},
-std::array<float,2>{0.126709163f, 0.0472047031f},
-std::array<float,2>{0.481292814f, 0.78032428f},
-std::array<float,2>{0.899517536f, 0.390979916f},
-std::array<float,2>{0.755154848f, 0.931860328f},
-std::array<float,2>{0.322829753f, 0.268055499f},
-std::array<float,2>{0.0172837693f, 0.663092077f},
-std::array<float,2>{0.605352044f, 0.146295384f},
-std::array<float,2>{0.877518535f, 0.563516617f},
-std::array<float,2>{0.499226242f, 0.0276183095f},
-std::array<float,2>{0.151963666f, 0.800702214f},
-std::array<float,2>{0.722579062f, 0.42406106f},
-std::array<float,2>{0.619267225f, 0.886546254f},
-std::array<float,2>{0.0122801634f, 0.306882948f},
-std::array<float,2>{0.330286145f, 0.634216547f},
-std::array<float,2>{0.778200507f, 0.16915597f},
-std::array<float,2>{0.645033419f, 0.690861344f},
-std::array<float,2>{0.191970438f, 0.241828918f},
-std::array<float,2>{0.412544399f, 0.979203999f},
-std::array<float,2>{0.971010447f, 0.313342988f},
-std::array<float,2>{0.841838002f, 0.834599078f},
-std::array<float,2>{0.266178757f, 0.444295049f},
-std::array<float,2>{0.0812418163f, 0.543713033f},
-std::array<float,2>{0.537988305f, 0.111359984f},
-std::array<float,2>{0.788414419f, 0.686321855f},
-std::array<float,2>{0.364630282f, 0.138862029f},
-std::array<float,2>{0.0482677221f, 0.90696013f},
-std::array<float,2>{0.582224369f, 0.250464886f},
-std::array<float,2>{0.702643871f, 0.76394552f},
-std::array<float,2>{0.181068316f, 0.381382883f},
-std::array<float,2>{0.449271381f, 0.617156029f},
-std::array<float,2>{0.934971213f, 0.0322043188f},
-std::array<float,2>{0.522740185f, 0.504925609f},
-std::array<float,2>{0.111682042f, 0.0727289319f},
-std::array<float,2>{0.288295954f, 0.873692214f},
-std::array<float,2>{0.864762485f, 0.489288211f},
-std::array<float,2>{0.937632263f, 0.943849146f},
-std::array<float,2>{0.396935195f, 0.345149189f},
-std::array<float,2>{0.225640073f, 0.73148334f},
-std::array<float,2>{0.664409995f, 0.217923447f},
-std::array<float,2>{0.750795066f, 0.538022697f},
-std::array<float,2>{0.325555205f, 0.123412311f},
-std::array<float,2>{0.0222613253f, 0.840605378f},
-std::array<float,2>{0.607649684f, 0.447454333f},
-std::array<float,2>{0.747653425f, 0.969872236f},
-std::array<float,2>{0.131174877f, 0.324389815f},
-std::array<float,2>{0.477364093f, 0.699401021f},
-std::array<float,2>{0.904656112f, 0.245724455f},
-std::array<float,2>{0.547669172f, 0.626898527f},
-std::array<float,2>{0.0766316652f, 0.161176816f},
-std::array<float,2>{0.264347702f, 0.878026426f},
-std::array<float,2>{0.816109955f, 0.304526329f},
-std::array<float,2>{0.985500038f, 0.806224406f},
-std::array<float,2>{0.432226777f, 0.433463335f},
-std::array<float,2>{0.206590891f, 0.571317077f},
-std::array<float,2>{0.628050685f, 0.0210347679f},
-std::array<float,2>{0.907170951f, 0.723112762f},
-std::array<float,2>{0.467775494f, 0.206965193f},
-std::array<float,2>{0.166652218f, 0.950698555f},
-std::array<float,2>{0.710074902f, 0.355300099f},
-std::array<float,2>{0.562580109f, 0.863161206f},
-std::array<float,2>{0.0397605821f, 0.494027853f},
-std::array<float,2>{0.346933961f, 0.509795487f},
-std::array<float,2>{0.810311019f, 0.0642106235f},
-std::array<float,2>{0.677577972f, 0.618521869f},
-std::array<float,2>{0.240751594f, 0.0405377746f},
-std::array<float,2>{0.384218633f, 0.751171589f},
-std::array<float,2>{0.953260779f, 0.389604539f},
-std::array<float,2>{0.855608881f, 0.915006042f},
-std::array<float,2>{0.311444253f, 0.260317862f},
-std::array<float,2>{0.100374214f, 0.676828265f},
-std::array<float,2>{0.514196455f, 0.128967449f},
-std::array<float,2>{0.945182383f, 0.590671241f},
-std::array<float,2>{0.393518001f, 0.0104692867f},
-std::array<float,2>{0.221277416f, 0.783169448f},
-std::array<float,2>{0.669582546f, 0.417582631f},
-std::array<float,2>{0.518903613f, 0.891162395f},
-std::array<float,2>{0.11373423f, 0.294840485f},
-std::array<float,2>{0.281965733f, 0.647116363f},
-std::array<float,2>{0.863113523f, 0.176972479f},
-std::array<float,2>{0.697858214f, 0.70914799f},
-std::array<float,2>{0.187385514f, 0.226373538f},
-std::array<float,2>{0.445636928f, 0.98560071f},
-std::array<float,2>{0.930921078f, 0.33009997f},
-std::array<float,2>{0.78464365f, 0.825546205f},
-std::array<float,2>{0.359432012f, 0.467161775f},
-std::array<float,2>{0.0514947921f, 0.558722615f},
-std::array<float,2>{0.578360617f, 0.102314234f},
-std::array<float,2>{0.838348925f, 0.664224505f},
-std::array<float,2>{0.270102143f, 0.154539868f},
-std::array<float,2>{0.0830690414f, 0.925008893f},
-std::array<float,2>{0.532969952f, 0.277016312f},
-std::array<float,2>{0.643224597f, 0.769865036f},
-std::array<float,2>{0.188222095f, 0.40029338f},
-std::array<float,2>{0.407544166f, 0.595974743f},
-std::array<float,2>{0.975266457f, 0.060606733f},
-std::array<float,2>{0.622123957f, 0.530115783f},
-std::array<float,2>{0.0116239144f, 0.0824716091f},
-std::array<float,2>{0.334151804f, 0.856990933f},
-std::array<float,2>{0.776883602f, 0.478300095f},
-std::array<float,2>{0.881993949f, 0.960894227f},
-std::array<float,2>{0.494917303f, 0.373678952f},
-std::array<float,2>{0.154997706f, 0.741009295f},
-std::array<float,2>{0.724187195f, 0.19845672f},
-std::array<float,2>{0.868467331f, 0.609327078f},
-std::array<float,2>{0.293194771f, 0.0533587113f},
-std::array<float,2>{0.117371015f, 0.777342916f},
-std::array<float,2>{0.530589163f, 0.395092934f},
-std::array<float,2>{0.66105634f, 0.934474349f},
-std::array<float,2>{0.230547279f, 0.272177041f},
-std::array<float,2>{0.399947286f, 0.659323752f},
-std::array<float,2>{0.948267281f, 0.141945466f},
-std::array<float,2>{0.588978171f, 0.744604468f},
-std::array<float,2>{0.0561892614f, 0.192076907f},
-std::array<float,2>{0.37475732f, 0.962014198f},
-std::array<float,2>{0.792230904f, 0.362996906f},
-std::array<float,2>{0.924663544f, 0.848957598f},
-std::array<float,2>{0.439283758f, 0.471654654f},
-std::array<float,2>{0.177278802f, 0.519123197f},
-std::array<float,2>{0.693106592f, 0.0903196037f},
-std::array<float,2>{0.979322612f, 0.65238446f},
-std::array<float,2>{0.419824392f, 0.185821012f},
-std::array<float,2>{0.196992919f, 0.905577242f},
-std::array<float,2>{0.653988004f, 0.285178363f},
-std::array<float,2>{0.542709529f, 0.796745181f},
-std::array<float,2>{0.0892713144f, 0.407688528f},
-std::array<float,2>{0.277393281f, 0.579755545f},
-std::array<float,2>{0.833406985f, 0.00648572948f},
-std::array<float,2>{0.729584813f, 0.550607443f},
-std::array<float,2>{0.145694524f, 0.0942875296f},
-std::array<float,2>{0.491174966f, 0.818696201f},
-std::array<float,2>{0.887097955f, 0.457658112f},
-std::array<float,2>{0.771981359f, 0.999864817f},
-std::array<float,2>{0.341534466f, 0.339590907f},
-std::array<float,2>{0.00265918043f, 0.714850008f},
-std::array<float,2>{0.609863937f, 0.233657897f},
-std::array<float,2>{0.892234743f, 0.503121138f},
-std::array<float,2>{0.473388404f, 0.0744813383f},
-std::array<float,2>{0.139028773f, 0.869417012f},
-std::array<float,2>{0.736995578f, 0.485026449f},
-std::array<float,2>{0.594806969f, 0.938450336f},
-std::array<float,2>{0.0254004113f, 0.347941846f},
-std::array<float,2>{0.316966355f, 0.728533804f},
-std::array<float,2>{0.764499009f, 0.214596614f},
-std::array<float,2>{0.633901536f, 0.682227373f},
-std::array<float,2>{0.214926288f, 0.134191841f},
-std::array<float,2>{0.426865131f, 0.910726547f},
-std::array<float,2>{0.995280802f, 0.254254639f},
-std::array<float,2>{0.826227129f, 0.760105908f},
-std::array<float,2>{0.250954866f, 0.377480656f},
-std::array<float,2>{0.0697664022f, 0.612170696f},
-std::array<float,2>{0.557976246f, 0.0385537259f},
-std::array<float,2>{0.799131155f, 0.694846809f},
-std::array<float,2>{0.354185909f, 0.236381292f},
-std::array<float,2>{0.0351462476f, 0.982432187f},
-std::array<float,2>{0.577235281f, 0.317610085f},
-std::array<float,2>{0.715169311f, 0.830455601f},
-std::array<float,2>{0.157594606f, 0.440882713f},
-std::array<float,2>{0.453711957f, 0.54188025f},
-std::array<float,2>{0.917995393f, 0.116664104f},
-std::array<float,2>{0.50501138f, 0.567203224f},
-std::array<float,2>{0.102762364f, 0.0265275985f},
-std::array<float,2>{0.299856365f, 0.802387893f},
-std::array<float,2>{0.846252501f, 0.428054929f},
-std::array<float,2>{0.965657353f, 0.888419211f},
-std::array<float,2>{0.376431257f, 0.309878498f},
-std::array<float,2>{0.249613464f, 0.636741161f},
-std::array<float,2>{0.686459363f, 0.166369185f},
-std::array<float,2>{0.793159604f, 0.577184796f},
-std::array<float,2>{0.36995706f, 0.0169279631f},
-std::array<float,2>{0.0601171255f, 0.809842467f},
-std::array<float,2>{0.593531787f, 0.437081724f},
-std::array<float,2>{0.688119531f, 0.880653858f},
-std::array<float,2>{0.175561801f, 0.299360663f},
-std::array<float,2>{0.442479432f, 0.632754207f},
-std::array<float,2>{0.92899543f, 0.15760231f},
-std::array<float,2>{0.526856124f, 0.698956311f},
-std::array<float,2>{0.122398473f, 0.246612757f},
-std::array<float,2>{0.290240884f, 0.97596699f},
-std::array<float,2>{0.8727988f, 0.32414192f},
-std::array<float,2>{0.950489342f, 0.836046159f},
-std::array<float,2>{0.404918849f, 0.449986964f},
-std::array<float,2>{0.22813873f, 0.532744646f},
-std::array<float,2>{0.657953501f, 0.119002581f},
-std::array<float,2>{0.885436177f, 0.674432158f},
-std::array<float,2>{0.485349029f, 0.126310498f},
-std::array<float,2>{0.141142383f, 0.919434726f},
-std::array<float,2>{0.732845068f, 0.261791497f},
-std::array<float,2>{0.61613822f, 0.75475657f},
-std::array<float,2>{0.00774895959f, 0.386618823f},
-std::array<float,2>{0.337787539f, 0.622128665f},
-std::array<float,2>{0.767672896f, 0.0447240844f},
-std::array<float,2>{0.651311398f, 0.51477164f},
-std::array<float,2>{0.201158136f, 0.0667686239f},
-std::array<float,2>{0.417134523f, 0.86680907f},
-std::array<float,2>{0.981295645f, 0.497512251f},
-std::array<float,2>{0.829216361f, 0.949174762f},
-std::array<float,2>{0.276297897f, 0.358677387f},
-std::array<float,2>{0.0906992629f, 0.722323716f},
-std::array<float,2>{0.544656217f, 0.21038264f},
-std::array<float,2>{0.997861028f, 0.556111634f},
-std::array<float,2>{0.42551139f, 0.106023781f},
-std::array<float,2>{0.211041749f, 0.820364475f},
-std::array<float,2>{0.63683486f, 0.463421524f},
-std::array<float,2>{0.562148392f, 0.989580512f},
-std::array<float,2>{0.0645983592f, 0.332796037f},
-std::array<float,2>{0.255602211f, 0.704367995f},
-std::array<float,2>{0.823647738f, 0.220873713f},
-std::array<float,2>{0.738283753f, 0.644245863f},
-std::array<float,2>{0.136635587f, 0.174151585f},
-std::array<float,2>{0.471415788f, 0.898048639f},
-std::array<float,2>{0.896641672f, 0.290931135f},
-std::array<float,2>{0.759302914f, 0.788997233f},
-std::array<float,2>{0.3141087f, 0.418012232f},
-std::array<float,2>{0.0309610311f, 0.58714205f},
-std::array<float,2>{0.599392533f, 0.0140538104f},
-std::array<float,2>{0.850571752f, 0.736616552f},
-std::array<float,2>{0.304483622f, 0.199519143f},
-std::array<float,2>{0.109352998f, 0.955943465f},
-std::array<float,2>{0.500633359f, 0.367259353f},
-std::array<float,2>{0.680366457f, 0.855059564f},
-std::array<float,2>{0.244981125f, 0.48106885f},
-std::array<float,2>{0.381178766f, 0.524248242f},
-std::array<float,2>{0.963806212f, 0.0809723213f},
-std::array<float,2>{0.571937263f, 0.598161399f},
-std::array<float,2>{0.0379913598f, 0.0552339517f},
-std::array<float,2>{0.35889098f, 0.767514527f},
-std::array<float,2>{0.803190947f, 0.404712439f},
-std::array<float,2>{0.916953802f, 0.926158249f},
-std::array<float,2>{0.459023476f, 0.27859199f},
-std::array<float,2>{0.161234573f, 0.670936286f},
-std::array<float,2>{0.714565098f, 0.151971459f},
-std::array<float,2>{0.818136275f, 0.523350954f},
-std::array<float,2>{0.258095711f, 0.0861608833f},
-std::array<float,2>{0.0739938617f, 0.845976591f},
-std::array<float,2>{0.551743448f, 0.476008058f},
-std::array<float,2>{0.632755876f, 0.967408955f},
-std::array<float,2>{0.209958568f, 0.363883704f},
-std::array<float,2>{0.43641147f, 0.746705234f},
-std::array<float,2>{0.99056375f, 0.188362166f},
-std::array<float,2>{0.60265553f, 0.661906242f},
-std::array<float,2>{0.0191448405f, 0.146534026f},
-std::array<float,2>{0.321820498f, 0.931064606f},
-std::array<float,2>{0.756465673f, 0.266431928f},
-std::array<float,2>{0.901245415f, 0.778531849f},
-std::array<float,2>{0.483054459f, 0.393070102f},
-std::array<float,2>{0.128009751f, 0.604423225f},
-std::array<float,2>{0.745782316f, 0.0493520088f},
-std::array<float,2>{0.960773408f, 0.714323521f},
-std::array<float,2>{0.389267027f, 0.22699669f},
-std::array<float,2>{0.235598028f, 0.992318511f},
-std::array<float,2>{0.672167242f, 0.342832088f},
-std::array<float,2>{0.50891012f, 0.815737307f},
-std::array<float,2>{0.0966659039f, 0.456777304f},
-std::array<float,2>{0.30633378f, 0.554540992f},
-std::array<float,2>{0.852992415f, 0.100002043f},
-std::array<float,2>{0.705827475f, 0.583287656f},
-std::array<float,2>{0.168717057f, 0.00368510257f},
-std::array<float,2>{0.461909622f, 0.792238295f},
-std::array<float,2>{0.912913322f, 0.413734734f},
-std::array<float,2>{0.805971146f, 0.900746822f},
-std::array<float,2>{0.348177612f, 0.281521618f},
-std::array<float,2>{0.0439551063f, 0.648548603f},
-std::array<float,2>{0.567356884f, 0.181494355f},
-std::array<float,2>{0.936644375f, 0.615196407f},
-std::array<float,2>{0.451839f, 0.0350236148f},
-std::array<float,2>{0.182949692f, 0.762222409f},
-std::array<float,2>{0.700911522f, 0.379311889f},
-std::array<float,2>{0.58417803f, 0.909625888f},
-std::array<float,2>{0.0489198789f, 0.253809601f},
-std::array<float,2>{0.366550535f, 0.68363905f},
-std::array<float,2>{0.786636055f, 0.138017982f},
-std::array<float,2>{0.66757232f, 0.733295381f},
-std::array<float,2>{0.223843247f, 0.216680363f},
-std::array<float,2>{0.394969285f, 0.942471862f},
-std::array<float,2>{0.939555764f, 0.345741719f},
-std::array<float,2>{0.86524123f, 0.871099889f},
-std::array<float,2>{0.287003279f, 0.491054505f},
-std::array<float,2>{0.109680794f, 0.50673002f},
-std::array<float,2>{0.519846976f, 0.0721163601f},
-std::array<float,2>{0.780272663f, 0.636176884f},
-std::array<float,2>{0.328583241f, 0.171848878f},
-std::array<float,2>{0.0138413329f, 0.884451449f},
-std::array<float,2>{0.617661297f, 0.304793835f},
-std::array<float,2>{0.719172359f, 0.798786104f},
-std::array<float,2>{0.149159148f, 0.423677117f},
-std::array<float,2>{0.496253967f, 0.564674675f},
-std::array<float,2>{0.876177788f, 0.0299911741f},
-std::array<float,2>{0.536057293f, 0.546081364f},
-std::array<float,2>{0.0793237761f, 0.110448331f},
-std::array<float,2>{0.269110352f, 0.83396101f},
-std::array<float,2>{0.841650665f, 0.441615313f},
-std::array<float,2>{0.970681727f, 0.976616263f},
-std::array<float,2>{0.410925955f, 0.31558454f},
-std::array<float,2>{0.195257217f, 0.688582122f},
-std::array<float,2>{0.648070097f, 0.238535464f},
-std::array<float,2>{0.781906724f, 0.559935451f},
-std::array<float,2>{0.362030923f, 0.102831937f},
-std::array<float,2>{0.0533334874f, 0.824865639f},
-std::array<float,2>{0.580748916f, 0.468645364f},
-std::array<float,2>{0.695448279f, 0.984472215f},
-std::array<float,2>{0.184790432f, 0.331550926f},
-std::array<float,2>{0.448891729f, 0.710808873f},
-std::array<float,2>{0.932321131f, 0.224728018f},
-std::array<float,2>{0.515704274f, 0.648339391f},
-std::array<float,2>{0.11560756f, 0.176731065f},
-std::array<float,2>{0.284087121f, 0.892198563f},
-std::array<float,2>{0.860075831f, 0.293718159f},
-std::array<float,2>{0.943141282f, 0.781449735f},
-std::array<float,2>{0.39245221f, 0.416620016f},
-std::array<float,2>{0.218990281f, 0.590924144f},
-std::array<float,2>{0.671116352f, 0.0116491541f},
-std::array<float,2>{0.880362093f, 0.74204278f},
-std::array<float,2>{0.494020283f, 0.197668552f},
-std::array<float,2>{0.154086784f, 0.959083617f},
-std::array<float,2>{0.725364149f, 0.374590248f},
-std::array<float,2>{0.624309301f, 0.856018305f},
-std::array<float,2>{0.00908186845f, 0.477209955f},
-std::array<float,2>{0.333797038f, 0.530343831f},
-std::array<float,2>{0.774519384f, 0.0836603418f},
-std::array<float,2>{0.641546965f, 0.597253203f},
-std::array<float,2>{0.189952374f, 0.0620418675f},
-std::array<float,2>{0.409104139f, 0.770679593f},
-std::array<float,2>{0.974085689f, 0.399048328f},
-std::array<float,2>{0.837229252f, 0.924423873f},
-std::array<float,2>{0.271833599f, 0.275798976f},
-std::array<float,2>{0.0850057751f, 0.665044546f},
-std::array<float,2>{0.533482134f, 0.155596271f},
-std::array<float,2>{0.986403167f, 0.570344687f},
-std::array<float,2>{0.431132555f, 0.0204301421f},
-std::array<float,2>{0.203364298f, 0.805086792f},
-std::array<float,2>{0.625527084f, 0.432232559f},
-std::array<float,2>{0.548928559f, 0.877092957f},
-std::array<float,2>{0.0751091912f, 0.303241283f},
-std::array<float,2>{0.26243937f, 0.625174701f},
-std::array<float,2>{0.812645018f, 0.161060899f},
-std::array<float,2>{0.748350143f, 0.700577497f},
-std::array<float,2>{0.129636288f, 0.24469842f},
-std::array<float,2>{0.480457634f, 0.968835175f},
-std::array<float,2>{0.903354585f, 0.326061189f},
-std::array<float,2>{0.752297699f, 0.841080785f},
-std::array<float,2>{0.327484459f, 0.44850263f},
-std::array<float,2>{0.0207448434f, 0.538631916f},
-std::array<float,2>{0.607148886f, 0.124794327f},
-std::array<float,2>{0.858525157f, 0.676631033f},
-std::array<float,2>{0.30938974f, 0.13082473f},
-std::array<float,2>{0.0992211103f, 0.915930867f},
-std::array<float,2>{0.513639808f, 0.261307418f},
-std::array<float,2>{0.679261208f, 0.750626802f},
-std::array<float,2>{0.239280969f, 0.39035368f},
-std::array<float,2>{0.385411084f, 0.618088067f},
-std::array<float,2>{0.956477582f, 0.0398308709f},
-std::array<float,2>{0.564546525f, 0.511605322f},
-std::array<float,2>{0.0427128598f, 0.063473247f},
-std::array<float,2>{0.345454276f, 0.861644745f},
-std::array<float,2>{0.811643362f, 0.492905736f},
-std::array<float,2>{0.909502506f, 0.949402153f},
-std::array<float,2>{0.466094524f, 0.353762954f},
-std::array<float,2>{0.164246455f, 0.724540293f},
-std::array<float,2>{0.707398534f, 0.205902666f},
-std::array<float,2>{0.825608432f, 0.612688959f},
-std::array<float,2>{0.252574235f, 0.0371869169f},
-std::array<float,2>{0.0672460124f, 0.760990858f},
-std::array<float,2>{0.556490958f, 0.378139824f},
-std::array<float,2>{0.636432767f, 0.911462784f},
-std::array<float,2>{0.218176648f, 0.255640984f},
-std::array<float,2>{0.429073602f, 0.682653725f},
-std::array<float,2>{0.992748141f, 0.133080661f},
-std::array<float,2>{0.596260488f, 0.730151057f},
-std::array<float,2>{0.0239105951f, 0.213149786f},
-std::array<float,2>{0.319030911f, 0.938888073f},
-std::array<float,2>{0.762322843f, 0.348665953f},
-std::array<float,2>{0.892894268f, 0.870769143f},
-std::array<float,2>{0.474957585f, 0.485434651f},
-std::array<float,2>{0.13740018f, 0.502727926f},
-std::array<float,2>{0.734435499f, 0.0751998648f},
-std::array<float,2>{0.967173934f, 0.63809222f},
-std::array<float,2>{0.378079027f, 0.167951703f},
-std::array<float,2>{0.247909889f, 0.887157798f},
-std::array<float,2>{0.684723079f, 0.309302121f},
-std::array<float,2>{0.507336617f, 0.801521301f},
-std::array<float,2>{0.105256587f, 0.429639101f},
-std::array<float,2>{0.297305644f, 0.56827414f},
-std::array<float,2>{0.845646322f, 0.0260391571f},
-std::array<float,2>{0.718417645f, 0.542089939f},
-std::array<float,2>{0.159844205f, 0.116187878f},
-std::array<float,2>{0.456382066f, 0.831407011f},
-std::array<float,2>{0.921841919f, 0.440162152f},
-std::array<float,2>{0.798338354f, 0.983781874f},
-std::array<float,2>{0.35231939f, 0.3165645f},
-std::array<float,2>{0.0330250189f, 0.694065154f},
-std::array<float,2>{0.574221849f, 0.237517551f},
-std::array<float,2>{0.922486722f, 0.517996848f},
-std::array<float,2>{0.440378606f, 0.0912366435f},
-std::array<float,2>{0.179278538f, 0.848582268f},
-std::array<float,2>{0.694581449f, 0.472191662f},
-std::array<float,2>{0.586092412f, 0.961774588f},
-std::array<float,2>{0.0577486977f, 0.361764938f},
-std::array<float,2>{0.371225715f, 0.745162427f},
-std::array<float,2>{0.789208889f, 0.193260148f},
-std::array<float,2>{0.663929701f, 0.65882653f},
-std::array<float,2>{0.23271434f, 0.140757769f},
-std::array<float,2>{0.40168792f, 0.934921205f},
-std::array<float,2>{0.94690907f, 0.273043573f},
-std::array<float,2>{0.870256722f, 0.775556564f},
-std::array<float,2>{0.296187222f, 0.396218836f},
-std::array<float,2>{0.12066444f, 0.607963145f},
-std::array<float,2>{0.52869457f, 0.0542730279f},
-std::array<float,2>{0.770172536f, 0.716368437f},
-std::array<float,2>{0.343053848f, 0.232646734f},
-std::array<float,2>{0.00169247587f, 0.998251379f},
-std::array<float,2>{0.612545073f, 0.338646889f},
-std::array<float,2>{0.728278697f, 0.819773734f},
-std::array<float,2>{0.147741541f, 0.458907396f},
-std::array<float,2>{0.488449097f, 0.5494138f},
-std::array<float,2>{0.889097869f, 0.0951638967f},
-std::array<float,2>{0.540082157f, 0.579014301f},
-std::array<float,2>{0.0862945169f, 0.00771516375f},
-std::array<float,2>{0.280595303f, 0.795579374f},
-std::array<float,2>{0.835320413f, 0.407088012f},
-std::array<float,2>{0.97733885f, 0.904374659f},
-std::array<float,2>{0.420350194f, 0.287014753f},
-std::array<float,2>{0.198281616f, 0.654256642f},
-std::array<float,2>{0.655083656f, 0.187172771f},
-std::array<float,2>{0.759780347f, 0.58603555f},
-std::array<float,2>{0.316210479f, 0.0155558456f},
-std::array<float,2>{0.0291203521f, 0.78754878f},
-std::array<float,2>{0.600068986f, 0.419619709f},
-std::array<float,2>{0.741292715f, 0.897450984f},
-std::array<float,2>{0.133693591f, 0.289942801f},
-std::array<float,2>{0.468845278f, 0.643023551f},
-std::array<float,2>{0.895904601f, 0.175009966f},
-std::array<float,2>{0.560461164f, 0.704067171f},
-std::array<float,2>{0.0627840385f, 0.222441882f},
-std::array<float,2>{0.25737679f, 0.988807499f},
-std::array<float,2>{0.820712149f, 0.333929926f},
-std::array<float,2>{0.998514712f, 0.821692765f},
-std::array<float,2>{0.422261596f, 0.46430707f},
-std::array<float,2>{0.213053167f, 0.555126488f},
-std::array<float,2>{0.639012992f, 0.106607668f},
-std::array<float,2>{0.914700747f, 0.670130432f},
-std::array<float,2>{0.458418101f, 0.150579467f},
-std::array<float,2>{0.163376465f, 0.927377343f},
-std::array<float,2>{0.711766541f, 0.278250366f},
-std::array<float,2>{0.572838545f, 0.766227126f},
-std::array<float,2>{0.0367524438f, 0.405920893f},
-std::array<float,2>{0.357202172f, 0.598776042f},
-std::array<float,2>{0.802517295f, 0.0560928062f},
-std::array<float,2>{0.683073103f, 0.52478683f},
-std::array<float,2>{0.243170381f, 0.0814799294f},
-std::array<float,2>{0.380791038f, 0.853968024f},
-std::array<float,2>{0.961634159f, 0.482156336f},
-std::array<float,2>{0.848240256f, 0.956610441f},
-std::array<float,2>{0.301981002f, 0.368690103f},
-std::array<float,2>{0.10601934f, 0.737492204f},
-std::array<float,2>{0.503407598f, 0.20047617f},
-std::array<float,2>{0.951358676f, 0.531595945f},
-std::array<float,2>{0.40389815f, 0.117504641f},
-std::array<float,2>{0.229424983f, 0.837249041f},
-std::array<float,2>{0.659855008f, 0.450269431f},
-std::array<float,2>{0.523839891f, 0.975108802f},
-std::array<float,2>{0.123848647f, 0.32310456f},
-std::array<float,2>{0.292531252f, 0.697816193f},
-std::array<float,2>{0.874005198f, 0.248031542f},
-std::array<float,2>{0.691149354f, 0.630898297f},
-std::array<float,2>{0.172650307f, 0.157075748f},
-std::array<float,2>{0.444603175f, 0.879192829f},
-std::array<float,2>{0.926115751f, 0.300209105f},
-std::array<float,2>{0.795195401f, 0.809064507f},
-std::array<float,2>{0.367537647f, 0.436478227f},
-std::array<float,2>{0.0606094897f, 0.577015817f},
-std::array<float,2>{0.590377867f, 0.0165864192f},
-std::array<float,2>{0.830526352f, 0.721248627f},
-std::array<float,2>{0.274083436f, 0.209190503f},
-std::array<float,2>{0.0935004354f, 0.947424591f},
-std::array<float,2>{0.546395719f, 0.357579619f},
-std::array<float,2>{0.650314987f, 0.865619183f},
-std::array<float,2>{0.202292383f, 0.497021496f},
-std::array<float,2>{0.41485855f, 0.514441252f},
-std::array<float,2>{0.983688235f, 0.0674188882f},
-std::array<float,2>{0.614623487f, 0.62151897f},
-std::array<float,2>{0.00481470721f, 0.0430210195f},
-std::array<float,2>{0.339793056f, 0.755514264f},
-std::array<float,2>{0.765841186f, 0.385134846f},
-std::array<float,2>{0.883880794f, 0.918298125f},
-std::array<float,2>{0.487266719f, 0.263624638f},
-std::array<float,2>{0.144240439f, 0.675143123f},
-std::array<float,2>{0.731119394f, 0.125476778f},
-std::array<float,2>{0.86384511f, 0.506901801f},
-std::array<float,2>{0.287273556f, 0.0711227506f},
-std::array<float,2>{0.11266581f, 0.872228801f},
-std::array<float,2>{0.521996677f, 0.49131757f},
-std::array<float,2>{0.665629983f, 0.94179368f},
-std::array<float,2>{0.224658996f, 0.347267956f},
-std::array<float,2>{0.39807713f, 0.734243631f},
-std::array<float,2>{0.939296901f, 0.215116158f},
-std::array<float,2>{0.583185911f, 0.684843004f},
-std::array<float,2>{0.0477004275f, 0.137064055f},
-std::array<float,2>{0.363367528f, 0.908660233f},
-std::array<float,2>{0.787112415f, 0.252917379f},
-std::array<float,2>{0.933645844f, 0.763546348f},
-std::array<float,2>{0.450601906f, 0.380132109f},
-std::array<float,2>{0.180421829f, 0.613509715f},
-std::array<float,2>{0.70197922f, 0.0337447785f},
-std::array<float,2>{0.971922457f, 0.6884045f},
-std::array<float,2>{0.413311034f, 0.239815727f},
-std::array<float,2>{0.193224624f, 0.978371501f},
-std::array<float,2>{0.645712018f, 0.315256745f},
-std::array<float,2>{0.538825214f, 0.832626939f},
-std::array<float,2>{0.0809167847f, 0.442544103f},
-std::array<float,2>{0.267352581f, 0.545126319f},
-std::array<float,2>{0.843368828f, 0.109824076f},
-std::array<float,2>{0.721244872f, 0.566011131f},
-std::array<float,2>{0.150883093f, 0.0311552398f},
-std::array<float,2>{0.498170853f, 0.797142029f},
-std::array<float,2>{0.878738642f, 0.422595501f},
-std::array<float,2>{0.778892696f, 0.883335233f},
-std::array<float,2>{0.331461549f, 0.306620032f},
-std::array<float,2>{0.0131222513f, 0.635629892f},
-std::array<float,2>{0.620919168f, 0.169999436f},
-std::array<float,2>{0.898501098f, 0.60507679f},
-std::array<float,2>{0.481933087f, 0.0502045304f},
-std::array<float,2>{0.12570025f, 0.777625978f},
-std::array<float,2>{0.74302119f, 0.394163072f},
-std::array<float,2>{0.60351938f, 0.930511951f},
-std::array<float,2>{0.0157997608f, 0.267294705f},
-std::array<float,2>{0.323353112f, 0.660755277f},
-std::array<float,2>{0.754304767f, 0.148287281f},
-std::array<float,2>{0.630026758f, 0.747702658f},
-std::array<float,2>{0.207486823f, 0.189146563f},
-std::array<float,2>{0.433751911f, 0.967986166f},
-std::array<float,2>{0.989627302f, 0.364613622f},
-std::array<float,2>{0.819076002f, 0.846714377f},
-std::array<float,2>{0.259801388f, 0.47501871f},
-std::array<float,2>{0.0705654696f, 0.522150815f},
-std::array<float,2>{0.553614199f, 0.087156415f},
-std::array<float,2>{0.807502806f, 0.649872839f},
-std::array<float,2>{0.351125449f, 0.17996563f},
-std::array<float,2>{0.0455197506f, 0.901836038f},
-std::array<float,2>{0.569096804f, 0.282452703f},
-std::array<float,2>{0.703270078f, 0.791807711f},
-std::array<float,2>{0.170479029f, 0.412672073f},
-std::array<float,2>{0.463083684f, 0.582238495f},
-std::array<float,2>{0.911023557f, 0.00285774074f},
-std::array<float,2>{0.510914743f, 0.553068042f},
-std::array<float,2>{0.0946182162f, 0.101330556f},
-std::array<float,2>{0.307564765f, 0.814793587f},
-std::array<float,2>{0.854652941f, 0.455285221f},
-std::array<float,2>{0.958015919f, 0.993502855f},
-std::array<float,2>{0.38818258f, 0.3420223f},
-std::array<float,2>{0.236507818f, 0.713399291f},
-std::array<float,2>{0.675096631f, 0.228116229f},
-std::array<float,2>{0.776191235f, 0.528202057f},
-std::array<float,2>{0.335727513f, 0.0849620551f},
-std::array<float,2>{0.00991693698f, 0.857566953f},
-std::array<float,2>{0.621222377f, 0.479144365f},
-std::array<float,2>{0.722777784f, 0.957969546f},
-std::array<float,2>{0.155927807f, 0.371345222f},
-std::array<float,2>{0.495348781f, 0.739262581f},
-std::array<float,2>{0.8811028f, 0.19628793f},
-std::array<float,2>{0.531497002f, 0.666856766f},
-std::array<float,2>{0.0825398713f, 0.153960317f},
-std::array<float,2>{0.270737737f, 0.922218323f},
-std::array<float,2>{0.83903861f, 0.274919838f},
-std::array<float,2>{0.975902259f, 0.772463381f},
-std::array<float,2>{0.406680465f, 0.400497466f},
-std::array<float,2>{0.188838556f, 0.595058143f},
-std::array<float,2>{0.644233584f, 0.0599496625f},
-std::array<float,2>{0.929742694f, 0.708390534f},
-std::array<float,2>{0.447000444f, 0.224407956f},
-std::array<float,2>{0.185591072f, 0.986561835f},
-std::array<float,2>{0.698924363f, 0.328813136f},
-std::array<float,2>{0.579768658f, 0.827132583f},
-std::array<float,2>{0.0521611422f, 0.465450287f},
-std::array<float,2>{0.360746235f, 0.560930073f},
-std::array<float,2>{0.783918142f, 0.105423294f},
-std::array<float,2>{0.668614686f, 0.593221426f},
-std::array<float,2>{0.221689761f, 0.00873458199f},
-std::array<float,2>{0.39365536f, 0.784609616f},
-std::array<float,2>{0.944277287f, 0.414523602f},
-std::array<float,2>{0.861643434f, 0.893073261f},
-std::array<float,2>{0.282992303f, 0.296068132f},
-std::array<float,2>{0.115007229f, 0.644713223f},
-std::array<float,2>{0.517644584f, 0.179156929f},
-std::array<float,2>{0.954998732f, 0.619474828f},
-std::array<float,2>{0.383177429f, 0.0426495336f},
-std::array<float,2>{0.242105633f, 0.753091455f},
-std::array<float,2>{0.676606476f, 0.388591737f},
-std::array<float,2>{0.51505518f, 0.917351961f},
-std::array<float,2>{0.10147839f, 0.259733886f},
-std::array<float,2>{0.311625063f, 0.679563105f},
-std::array<float,2>{0.857340038f, 0.131651342f},
-std::array<float,2>{0.709858f, 0.7259866f},
-std::array<float,2>{0.167424351f, 0.20408006f},
-std::array<float,2>{0.467714965f, 0.952804565f},
-std::array<float,2>{0.907942176f, 0.352134913f},
-std::array<float,2>{0.808920145f, 0.860015929f},
-std::array<float,2>{0.34602052f, 0.494287223f},
-std::array<float,2>{0.0406209491f, 0.508108437f},
-std::array<float,2>{0.563714445f, 0.0662035197f},
-std::array<float,2>{0.814968407f, 0.627037644f},
-std::array<float,2>{0.265136957f, 0.163511127f},
-std::array<float,2>{0.0776699781f, 0.875818312f},
-std::array<float,2>{0.548507631f, 0.301780879f},
-std::array<float,2>{0.627002358f, 0.80826962f},
-std::array<float,2>{0.205537885f, 0.429705769f},
-std::array<float,2>{0.43304944f, 0.573444426f},
-std::array<float,2>{0.984393358f, 0.0223228429f},
-std::array<float,2>{0.609109938f, 0.535498261f},
-std::array<float,2>{0.0233735908f, 0.121729232f},
-std::array<float,2>{0.325156957f, 0.843456924f},
-std::array<float,2>{0.751475215f, 0.446398824f},
-std::array<float,2>{0.905630708f, 0.972298563f},
-std::array<float,2>{0.478096038f, 0.32618165f},
-std::array<float,2>{0.132755905f, 0.70185411f},
-std::array<float,2>{0.746519864f, 0.243265018f},
-std::array<float,2>{0.846914113f, 0.569985747f},
-std::array<float,2>{0.299582601f, 0.0235375185f},
-std::array<float,2>{0.10182026f, 0.80448997f},
-std::array<float,2>{0.504652441f, 0.427139997f},
-std::array<float,2>{0.686755657f, 0.890542567f},
-std::array<float,2>{0.24831973f, 0.312250078f},
-std::array<float,2>{0.375072032f, 0.638789952f},
-std::array<float,2>{0.966232181f, 0.164727122f},
-std::array<float,2>{0.576422751f, 0.692132175f},
-std::array<float,2>{0.0334049538f, 0.235798687f},
-std::array<float,2>{0.355204254f, 0.981687903f},
-std::array<float,2>{0.800174356f, 0.318780899f},
-std::array<float,2>{0.91904217f, 0.830006361f},
-std::array<float,2>{0.454705983f, 0.437550306f},
-std::array<float,2>{0.156877324f, 0.53920269f},
-std::array<float,2>{0.716778576f, 0.114447072f},
-std::array<float,2>{0.994279623f, 0.681521118f},
-std::array<float,2>{0.426591516f, 0.136290073f},
-std::array<float,2>{0.216722026f, 0.913329899f},
-std::array<float,2>{0.63335067f, 0.256041884f},
-std::array<float,2>{0.557402432f, 0.759102941f},
-std::array<float,2>{0.06862019f, 0.375033587f},
-std::array<float,2>{0.251659274f, 0.609386981f},
-std::array<float,2>{0.827978253f, 0.0355235636f},
-std::array<float,2>{0.737957358f, 0.500163615f},
-std::array<float,2>{0.139886305f, 0.0780441761f},
-std::array<float,2>{0.474247396f, 0.868125081f},
-std::array<float,2>{0.89109236f, 0.486739784f},
-std::array<float,2>{0.765356898f, 0.941181302f},
-std::array<float,2>{0.318147153f, 0.351248413f},
-std::array<float,2>{0.0271240547f, 0.72707206f},
-std::array<float,2>{0.594067037f, 0.211914957f},
-std::array<float,2>{0.887975693f, 0.548058152f},
-std::array<float,2>{0.491404682f, 0.0960319564f},
-std::array<float,2>{0.14531441f, 0.8175174f},
-std::array<float,2>{0.728833735f, 0.459979445f},
-std::array<float,2>{0.611102343f, 0.996994376f},
-std::array<float,2>{0.00314323558f, 0.337279588f},
-std::array<float,2>{0.340747178f, 0.71825242f},
-std::array<float,2>{0.772580385f, 0.232026994f},
-std::array<float,2>{0.652837157f, 0.655906856f},
-std::array<float,2>{0.195908904f, 0.185334742f},
-std::array<float,2>{0.418239892f, 0.904062986f},
-std::array<float,2>{0.979565263f, 0.288996994f},
-std::array<float,2>{0.832633793f, 0.794058263f},
-std::array<float,2>{0.278973699f, 0.410011053f},
-std::array<float,2>{0.08794339f, 0.58082056f},
-std::array<float,2>{0.541407228f, 0.00463491818f},
-std::array<float,2>{0.791095734f, 0.742338717f},
-std::array<float,2>{0.373172045f, 0.193929121f},
-std::array<float,2>{0.0551192611f, 0.963017404f},
-std::array<float,2>{0.588737011f, 0.359542698f},
-std::array<float,2>{0.691730917f, 0.851109147f},
-std::array<float,2>{0.176093921f, 0.469687283f},
-std::array<float,2>{0.437798858f, 0.516078591f},
-std::array<float,2>{0.925328732f, 0.0919389278f},
-std::array<float,2>{0.529301822f, 0.607405245f},
-std::array<float,2>{0.118739158f, 0.0514461249f},
-std::array<float,2>{0.294041485f, 0.775110245f},
-std::array<float,2>{0.86787951f, 0.397221535f},
-std::array<float,2>{0.948013425f, 0.937021315f},
-std::array<float,2>{0.399191141f, 0.270756364f},
-std::array<float,2>{0.231616512f, 0.65645045f},
-std::array<float,2>{0.661626756f, 0.144337237f},
-std::array<float,2>{0.804210484f, 0.600877345f},
-std::array<float,2>{0.358134896f, 0.0582096018f},
-std::array<float,2>{0.0385691077f, 0.768153906f},
-std::array<float,2>{0.570684373f, 0.403695256f},
-std::array<float,2>{0.713456869f, 0.927796364f},
-std::array<float,2>{0.160983592f, 0.279940456f},
-std::array<float,2>{0.460169643f, 0.669653833f},
-std::array<float,2>{0.91753751f, 0.15000613f},
-std::array<float,2>{0.501890779f, 0.735296071f},
-std::array<float,2>{0.107849762f, 0.201581046f},
-std::array<float,2>{0.303543389f, 0.955067217f},
-std::array<float,2>{0.85099566f, 0.369454324f},
-std::array<float,2>{0.964058995f, 0.853066802f},
-std::array<float,2>{0.382200837f, 0.48289606f},
-std::array<float,2>{0.245536715f, 0.526926756f},
-std::array<float,2>{0.681317151f, 0.0793132484f},
-std::array<float,2>{0.898249984f, 0.642051458f},
-std::array<float,2>{0.472466975f, 0.17271705f},
-std::array<float,2>{0.135132492f, 0.896188319f},
-std::array<float,2>{0.739465237f, 0.292454511f},
-std::array<float,2>{0.598404586f, 0.78560698f},
-std::array<float,2>{0.0297841169f, 0.420481861f},
-std::array<float,2>{0.313388526f, 0.589793861f},
-std::array<float,2>{0.758755207f, 0.0135190459f},
-std::array<float,2>{0.638451755f, 0.558571339f},
-std::array<float,2>{0.211973608f, 0.107988425f},
-std::array<float,2>{0.424360842f, 0.823805809f},
-std::array<float,2>{0.996688247f, 0.462569237f},
-std::array<float,2>{0.823227167f, 0.991831601f},
-std::array<float,2>{0.25432682f, 0.335106432f},
-std::array<float,2>{0.0659467131f, 0.706697762f},
-std::array<float,2>{0.56127882f, 0.218828723f},
-std::array<float,2>{0.981725097f, 0.513053596f},
-std::array<float,2>{0.416048378f, 0.0694545731f},
-std::array<float,2>{0.199631795f, 0.863724232f},
-std::array<float,2>{0.651626408f, 0.498737782f},
-std::array<float,2>{0.543720007f, 0.945579648f},
-std::array<float,2>{0.0908757001f, 0.357243717f},
-std::array<float,2>{0.277326316f, 0.718880415f},
-std::array<float,2>{0.828810513f, 0.208709285f},
-std::array<float,2>{0.734067142f, 0.672981024f},
-std::array<float,2>{0.141711012f, 0.128790408f},
-std::array<float,2>{0.4860906f, 0.920693457f},
-std::array<float,2>{0.885951042f, 0.265031487f},
-std::array<float,2>{0.769291878f, 0.756804109f},
-std::array<float,2>{0.336745262f, 0.384196728f},
-std::array<float,2>{0.00625736825f, 0.62439841f},
-std::array<float,2>{0.616225541f, 0.046742443f},
-std::array<float,2>{0.871115208f, 0.6953246f},
-std::array<float,2>{0.289083898f, 0.248876199f},
-std::array<float,2>{0.121636964f, 0.97279489f},
-std::array<float,2>{0.525678754f, 0.320916861f},
-std::array<float,2>{0.656706274f, 0.838487923f},
-std::array<float,2>{0.227385819f, 0.451537073f},
-std::array<float,2>{0.405848831f, 0.534140408f},
-std::array<float,2>{0.950099826f, 0.120925501f},
-std::array<float,2>{0.592456043f, 0.575308144f},
-std::array<float,2>{0.0590748414f, 0.0187064558f},
-std::array<float,2>{0.371059954f, 0.811241925f},
-std::array<float,2>{0.794379413f, 0.435343891f},
-std::array<float,2>{0.92821753f, 0.880951941f},
-std::array<float,2>{0.441501141f, 0.297704518f},
-std::array<float,2>{0.174404263f, 0.629906058f},
-std::array<float,2>{0.688574553f, 0.159577027f},
-std::array<float,2>{0.840528309f, 0.544366956f},
-std::array<float,2>{0.268341184f, 0.112313531f},
-std::array<float,2>{0.0788027197f, 0.835201144f},
-std::array<float,2>{0.536967039f, 0.444702238f},
-std::array<float,2>{0.646697342f, 0.980264127f},
-std::array<float,2>{0.193485633f, 0.314139068f},
-std::array<float,2>{0.411665767f, 0.689550459f},
-std::array<float,2>{0.969304085f, 0.240533903f},
-std::array<float,2>{0.618277848f, 0.633055151f},
-std::array<float,2>{0.0151389614f, 0.168887585f},
-std::array<float,2>{0.329888821f, 0.88571465f},
-std::array<float,2>{0.781152487f, 0.308433414f},
-std::array<float,2>{0.875186801f, 0.799456239f},
-std::array<float,2>{0.497453243f, 0.424862593f},
-std::array<float,2>{0.149767682f, 0.562930405f},
-std::array<float,2>{0.720423937f, 0.0284274183f},
-std::array<float,2>{0.941316307f, 0.731081903f},
-std::array<float,2>{0.39576745f, 0.217193052f},
-std::array<float,2>{0.223314688f, 0.944378912f},
-std::array<float,2>{0.666351736f, 0.343826115f},
-std::array<float,2>{0.521244466f, 0.874391019f},
-std::array<float,2>{0.110469759f, 0.489182442f},
-std::array<float,2>{0.285278797f, 0.504189491f},
-std::array<float,2>{0.866787374f, 0.0741754547f},
-std::array<float,2>{0.699814379f, 0.615865052f},
-std::array<float,2>{0.182434365f, 0.0329094976f},
-std::array<float,2>{0.452936739f, 0.7646631f},
-std::array<float,2>{0.935749292f, 0.382056624f},
-std::array<float,2>{0.785739481f, 0.907351494f},
-std::array<float,2>{0.365971774f, 0.251086444f},
-std::array<float,2>{0.0506622121f, 0.68653667f},
-std::array<float,2>{0.585138559f, 0.140499443f},
-std::array<float,2>{0.913675547f, 0.584848762f},
-std::array<float,2>{0.462768674f, 0.00164790684f},
-std::array<float,2>{0.169585764f, 0.789329588f},
-std::array<float,2>{0.706328928f, 0.410542041f},
-std::array<float,2>{0.568151414f, 0.900152624f},
-std::array<float,2>{0.0434211232f, 0.284271151f},
-std::array<float,2>{0.349382371f, 0.651560366f},
-std::array<float,2>{0.805003345f, 0.18241477f},
-std::array<float,2>{0.673237383f, 0.712868571f},
-std::array<float,2>{0.234744117f, 0.229438037f},
-std::array<float,2>{0.389686465f, 0.995531321f},
-std::array<float,2>{0.959147334f, 0.340393573f},
-std::array<float,2>{0.852457345f, 0.812811255f},
-std::array<float,2>{0.305429131f, 0.454245538f},
-std::array<float,2>{0.0967665389f, 0.552543759f},
-std::array<float,2>{0.508445263f, 0.0994628817f},
-std::array<float,2>{0.757362247f, 0.66301322f},
-std::array<float,2>{0.321286291f, 0.144812226f},
-std::array<float,2>{0.0179456677f, 0.933114052f},
-std::array<float,2>{0.602083325f, 0.268969536f},
-std::array<float,2>{0.745116889f, 0.77978611f},
-std::array<float,2>{0.127500534f, 0.392204016f},
-std::array<float,2>{0.483449697f, 0.602223635f},
-std::array<float,2>{0.902116597f, 0.0485923961f},
-std::array<float,2>{0.552096009f, 0.521137297f},
-std::array<float,2>{0.0728664771f, 0.0890288278f},
-std::array<float,2>{0.259108067f, 0.844703555f},
-std::array<float,2>{0.816880524f, 0.473867387f},
-std::array<float,2>{0.991980314f, 0.96549648f},
-std::array<float,2>{0.437283128f, 0.366953969f},
-std::array<float,2>{0.210700721f, 0.748574138f},
-std::array<float,2>{0.631278515f, 0.191150427f}}
\ No newline at end of file
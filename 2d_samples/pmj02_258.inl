@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.343009174f, 0.843355715f},
-std::array<float,2>{0.514113784f, 0.26070866f},
-std::array<float,2>{0.128470168f, 0.0485888012f},
-std::array<float,2>{0.945050478f, 0.532615304f},
-std::array<float,2>{0.0105593251f, 0.657891989f},
-std::array<float,2>{0.80522418f, 0.210391775f},
-std::array<float,2>{0.40121752f, 0.396126717f},
-std::array<float,2>{0.64635253f, 0.940665245f},
-std::array<float,2>{0.456890196f, 0.609586179f},
-std::array<float,2>{0.689088523f, 0.119475096f},
-std::array<float,2>{0.0953235924f, 0.340793431f},
-std::array<float,2>{0.872209787f, 0.78111285f},
-std::array<float,2>{0.205368042f, 0.909782469f},
-std::array<float,2>{0.879698038f, 0.447204798f},
-std::array<float,2>{0.310693055f, 0.127836153f},
-std::array<float,2>{0.598234773f, 0.742971778f},
-std::array<float,2>{0.409816802f, 0.973376334f},
-std::array<float,2>{0.656580925f, 0.417675823f},
-std::array<float,2>{0.0439259596f, 0.234827772f},
-std::array<float,2>{0.759106278f, 0.652305961f},
-std::array<float,2>{0.180259675f, 0.507371068f},
-std::array<float,2>{0.994921744f, 0.0142089026f},
-std::array<float,2>{0.350328028f, 0.305479795f},
-std::array<float,2>{0.550555229f, 0.853019714f},
-std::array<float,2>{0.250329226f, 0.697554052f},
-std::array<float,2>{0.589042664f, 0.180323854f},
-std::array<float,2>{0.238204211f, 0.493080944f},
-std::array<float,2>{0.911963642f, 0.88936168f},
-std::array<float,2>{0.0740789324f, 0.800640225f},
-std::array<float,2>{0.823041856f, 0.370805413f},
-std::array<float,2>{0.495873839f, 0.0837631449f},
-std::array<float,2>{0.7477386f, 0.59064585f},
-std::array<float,2>{0.287626773f, 0.899443269f},
-std::array<float,2>{0.622365594f, 0.474787086f},
-std::array<float,2>{0.202794611f, 0.170491844f},
-std::array<float,2>{0.895299554f, 0.715971768f},
-std::array<float,2>{0.117849186f, 0.571213126f},
-std::array<float,2>{0.853696704f, 0.0768717229f},
-std::array<float,2>{0.450057358f, 0.345871329f},
-std::array<float,2>{0.704900503f, 0.783328891f},
-std::array<float,2>{0.380276382f, 0.628406048f},
-std::array<float,2>{0.627363265f, 0.222735912f},
-std::array<float,2>{0.0240376163f, 0.424627036f},
-std::array<float,2>{0.782173514f, 0.995835662f},
-std::array<float,2>{0.14331761f, 0.870861232f},
-std::array<float,2>{0.961995363f, 0.288473159f},
-std::array<float,2>{0.316529334f, 0.0183926374f},
-std::array<float,2>{0.518051624f, 0.523298681f},
-std::array<float,2>{0.471390724f, 0.758859575f},
-std::array<float,2>{0.721732318f, 0.321414977f},
-std::array<float,2>{0.0907064453f, 0.0941125527f},
-std::array<float,2>{0.840863109f, 0.602875531f},
-std::array<float,2>{0.223364502f, 0.734006047f},
-std::array<float,2>{0.928102076f, 0.145893455f},
-std::array<float,2>{0.278912336f, 0.457751691f},
-std::array<float,2>{0.567085624f, 0.92421329f},
-std::array<float,2>{0.374797016f, 0.557014585f},
-std::array<float,2>{0.544467211f, 0.0312658772f},
-std::array<float,2>{0.159932047f, 0.270248353f},
-std::array<float,2>{0.969079137f, 0.820755243f},
-std::array<float,2>{0.0511159711f, 0.953456342f},
-std::array<float,2>{0.767612934f, 0.376995653f},
-std::array<float,2>{0.425602943f, 0.199623868f},
-std::array<float,2>{0.679211259f, 0.672498167f},
-std::array<float,2>{0.268499821f, 0.795928657f},
-std::array<float,2>{0.577705979f, 0.354151875f},
-std::array<float,2>{0.232432663f, 0.0689010397f},
-std::array<float,2>{0.935407162f, 0.567591846f},
-std::array<float,2>{0.0840128958f, 0.707881451f},
-std::array<float,2>{0.829594195f, 0.162926584f},
-std::array<float,2>{0.47952652f, 0.476801544f},
-std::array<float,2>{0.728491843f, 0.891404092f},
-std::array<float,2>{0.43745023f, 0.525327206f},
-std::array<float,2>{0.68097645f, 0.0247498658f},
-std::array<float,2>{0.0563154817f, 0.292581141f},
-std::array<float,2>{0.775793791f, 0.862227023f},
-std::array<float,2>{0.165955663f, 0.988917112f},
-std::array<float,2>{0.977165222f, 0.437332392f},
-std::array<float,2>{0.364755988f, 0.227665603f},
-std::array<float,2>{0.536284983f, 0.636659682f},
-std::array<float,2>{0.441981167f, 0.933099806f},
-std::array<float,2>{0.711884916f, 0.463588983f},
-std::array<float,2>{0.110643201f, 0.151554719f},
-std::array<float,2>{0.844747424f, 0.719566405f},
-std::array<float,2>{0.189894244f, 0.599991798f},
-std::array<float,2>{0.903401613f, 0.10522753f},
-std::array<float,2>{0.292484492f, 0.31700775f},
-std::array<float,2>{0.616431952f, 0.750170946f},
-std::array<float,2>{0.325409412f, 0.680331409f},
-std::array<float,2>{0.527734578f, 0.189178184f},
-std::array<float,2>{0.15153864f, 0.389146805f},
-std::array<float,2>{0.954271853f, 0.961302221f},
-std::array<float,2>{0.0216964483f, 0.819139183f},
-std::array<float,2>{0.796125054f, 0.275895536f},
-std::array<float,2>{0.382977396f, 0.0421045832f},
-std::array<float,2>{0.638825357f, 0.552075267f},
-std::array<float,2>{0.358712345f, 0.946234703f},
-std::array<float,2>{0.558866322f, 0.401151806f},
-std::array<float,2>{0.174586028f, 0.21268633f},
-std::array<float,2>{0.991993487f, 0.666190147f},
-std::array<float,2>{0.0319193862f, 0.540913582f},
-std::array<float,2>{0.752877891f, 0.0612991117f},
-std::array<float,2>{0.419178873f, 0.254382193f},
-std::array<float,2>{0.669953167f, 0.832830727f},
-std::array<float,2>{0.489565372f, 0.740607917f},
-std::array<float,2>{0.741753519f, 0.139932111f},
-std::array<float,2>{0.0646407977f, 0.438739121f},
-std::array<float,2>{0.813152671f, 0.921713293f},
-std::array<float,2>{0.244181842f, 0.766430974f},
-std::array<float,2>{0.91979754f, 0.330008119f},
-std::array<float,2>{0.260923028f, 0.11520642f},
-std::array<float,2>{0.579823613f, 0.624017894f},
-std::array<float,2>{0.398000985f, 0.845441341f},
-std::array<float,2>{0.649896145f, 0.301896155f},
-std::array<float,2>{0.00376613298f, 0.00391918793f},
-std::array<float,2>{0.798063576f, 0.514709175f},
-std::array<float,2>{0.13474901f, 0.646274269f},
-std::array<float,2>{0.946032107f, 0.246649772f},
-std::array<float,2>{0.330680668f, 0.40782699f},
-std::array<float,2>{0.507707059f, 0.981740713f},
-std::array<float,2>{0.301728874f, 0.581021369f},
-std::array<float,2>{0.609083652f, 0.0863803774f},
-std::array<float,2>{0.214176238f, 0.365534484f},
-std::array<float,2>{0.888222516f, 0.809441626f},
-std::array<float,2>{0.104674637f, 0.878975809f},
-std::array<float,2>{0.861931264f, 0.488482565f},
-std::array<float,2>{0.464428127f, 0.178103298f},
-std::array<float,2>{0.698312044f, 0.693331301f},
-std::array<float,2>{0.305157453f, 0.866020977f},
-std::array<float,2>{0.59646982f, 0.294091463f},
-std::array<float,2>{0.208949968f, 0.0275365226f},
-std::array<float,2>{0.87788856f, 0.527660072f},
-std::array<float,2>{0.100063585f, 0.639043272f},
-std::array<float,2>{0.869301081f, 0.233347818f},
-std::array<float,2>{0.459636897f, 0.43258518f},
-std::array<float,2>{0.69329232f, 0.984980047f},
-std::array<float,2>{0.405402333f, 0.564695418f},
-std::array<float,2>{0.64391005f, 0.0643988848f},
-std::array<float,2>{0.0121980868f, 0.357834727f},
-std::array<float,2>{0.808689594f, 0.789416969f},
-std::array<float,2>{0.130253613f, 0.897101223f},
-std::array<float,2>{0.938030839f, 0.482305259f},
-std::array<float,2>{0.338318557f, 0.159624234f},
-std::array<float,2>{0.511538267f, 0.706000745f},
-std::array<float,2>{0.497958839f, 0.965899825f},
-std::array<float,2>{0.744732082f, 0.385796636f},
-std::array<float,2>{0.0767099559f, 0.193859652f},
-std::array<float,2>{0.824561715f, 0.685757518f},
-std::array<float,2>{0.238867551f, 0.547449648f},
-std::array<float,2>{0.908655226f, 0.0448484644f},
-std::array<float,2>{0.255502254f, 0.27994889f},
-std::array<float,2>{0.591786504f, 0.812765956f},
-std::array<float,2>{0.346904099f, 0.726553619f},
-std::array<float,2>{0.552279592f, 0.155631348f},
-std::array<float,2>{0.186332434f, 0.465539485f},
-std::array<float,2>{0.996818006f, 0.936879396f},
-std::array<float,2>{0.0429250412f, 0.753969073f},
-std::array<float,2>{0.762124479f, 0.313567698f},
-std::array<float,2>{0.412436306f, 0.108459696f},
-std::array<float,2>{0.660797834f, 0.595408499f},
-std::array<float,2>{0.31534341f, 0.91795212f},
-std::array<float,2>{0.523102939f, 0.44313556f},
-std::array<float,2>{0.146502182f, 0.13445352f},
-std::array<float,2>{0.967877448f, 0.736951351f},
-std::array<float,2>{0.0276453961f, 0.61765635f},
-std::array<float,2>{0.787973821f, 0.112320028f},
-std::array<float,2>{0.376945615f, 0.335369021f},
-std::array<float,2>{0.631804883f, 0.773170114f},
-std::array<float,2>{0.448713511f, 0.671867251f},
-std::array<float,2>{0.709568441f, 0.217812568f},
-std::array<float,2>{0.124003455f, 0.404551148f},
-std::array<float,2>{0.856943727f, 0.949283421f},
-std::array<float,2>{0.197321787f, 0.829062641f},
-std::array<float,2>{0.892137766f, 0.250055879f},
-std::array<float,2>{0.282637864f, 0.0575399622f},
-std::array<float,2>{0.619999468f, 0.543728769f},
-std::array<float,2>{0.428086996f, 0.807797134f},
-std::array<float,2>{0.67567575f, 0.362231642f},
-std::array<float,2>{0.0477181859f, 0.092712f},
-std::array<float,2>{0.770914197f, 0.582698941f},
-std::array<float,2>{0.162469715f, 0.688628972f},
-std::array<float,2>{0.972781479f, 0.174743488f},
-std::array<float,2>{0.371000379f, 0.487347066f},
-std::array<float,2>{0.540534854f, 0.877133548f},
-std::array<float,2>{0.274122208f, 0.508634925f},
-std::array<float,2>{0.563014865f, 0.0020548841f},
-std::array<float,2>{0.220666498f, 0.29864639f},
-std::array<float,2>{0.923582613f, 0.849945307f},
-std::array<float,2>{0.0891219974f, 0.978314042f},
-std::array<float,2>{0.835965991f, 0.410419703f},
-std::array<float,2>{0.4750669f, 0.244375363f},
-std::array<float,2>{0.723628759f, 0.642276406f},
-std::array<float,2>{0.361077636f, 0.774386346f},
-std::array<float,2>{0.533276439f, 0.336224437f},
-std::array<float,2>{0.168516159f, 0.123289295f},
-std::array<float,2>{0.983614981f, 0.615505159f},
-std::array<float,2>{0.0611111447f, 0.746238768f},
-std::array<float,2>{0.778566599f, 0.132082954f},
-std::array<float,2>{0.433304191f, 0.452525705f},
-std::array<float,2>{0.685614586f, 0.912062109f},
-std::array<float,2>{0.482902229f, 0.537816465f},
-std::array<float,2>{0.733783782f, 0.0530963503f},
-std::array<float,2>{0.0789613724f, 0.264752984f},
-std::array<float,2>{0.835394204f, 0.836570203f},
-std::array<float,2>{0.228476107f, 0.945304513f},
-std::array<float,2>{0.931058466f, 0.39397338f},
-std::array<float,2>{0.27206099f, 0.203560844f},
-std::array<float,2>{0.57277441f, 0.661432207f},
-std::array<float,2>{0.390282869f, 0.884331584f},
-std::array<float,2>{0.634836316f, 0.498869836f},
-std::array<float,2>{0.0176828746f, 0.18431893f},
-std::array<float,2>{0.792533278f, 0.701632798f},
-std::array<float,2>{0.155224949f, 0.587197542f},
-std::array<float,2>{0.958282828f, 0.0785365552f},
-std::array<float,2>{0.321007133f, 0.371362031f},
-std::array<float,2>{0.526584744f, 0.801643491f},
-std::array<float,2>{0.296047509f, 0.655626178f},
-std::array<float,2>{0.612465978f, 0.23905547f},
-std::array<float,2>{0.194475725f, 0.418291926f},
-std::array<float,2>{0.899733841f, 0.969875455f},
-std::array<float,2>{0.116202205f, 0.857988536f},
-std::array<float,2>{0.848301053f, 0.309500694f},
-std::array<float,2>{0.438256174f, 0.00962018967f},
-std::array<float,2>{0.715884328f, 0.502769887f},
-std::array<float,2>{0.264930665f, 0.997332335f},
-std::array<float,2>{0.584454179f, 0.426478446f},
-std::array<float,2>{0.246872485f, 0.219993159f},
-std::array<float,2>{0.914867163f, 0.631200731f},
-std::array<float,2>{0.0693966523f, 0.517126501f},
-std::array<float,2>{0.818955004f, 0.0219113883f},
-std::array<float,2>{0.485112101f, 0.282788604f},
-std::array<float,2>{0.736292899f, 0.873379767f},
-std::array<float,2>{0.415510863f, 0.713797629f},
-std::array<float,2>{0.666715086f, 0.164990082f},
-std::array<float,2>{0.0387340523f, 0.472625047f},
-std::array<float,2>{0.755954444f, 0.904910684f},
-std::array<float,2>{0.177797079f, 0.788323402f},
-std::array<float,2>{0.986491561f, 0.350054532f},
-std::array<float,2>{0.354204297f, 0.0728768036f},
-std::array<float,2>{0.557123303f, 0.577692688f},
-std::array<float,2>{0.467121005f, 0.827680051f},
-std::array<float,2>{0.701916337f, 0.26839745f},
-std::array<float,2>{0.106244721f, 0.0367968567f},
-std::array<float,2>{0.866932213f, 0.561651587f},
-std::array<float,2>{0.215113521f, 0.679247081f},
-std::array<float,2>{0.884256184f, 0.196136311f},
-std::array<float,2>{0.297812581f, 0.381149918f},
-std::array<float,2>{0.603250682f, 0.958190084f},
-std::array<float,2>{0.33295396f, 0.607863724f},
-std::array<float,2>{0.503397405f, 0.101176955f},
-std::array<float,2>{0.140349269f, 0.325434178f},
-std::array<float,2>{0.952987552f, 0.764490366f},
-std::array<float,2>{0.00652129063f, 0.926509738f},
-std::array<float,2>{0.800975382f, 0.456966549f},
-std::array<float,2>{0.393795669f, 0.143892407f},
-std::array<float,2>{0.654370248f, 0.728074014f},
-std::array<float,2>{0.347996473f, 0.854943752f},
-std::array<float,2>{0.548219264f, 0.307841837f},
-std::array<float,2>{0.18213287f, 0.0134389587f},
-std::array<float,2>{0.992309451f, 0.504829943f},
-std::array<float,2>{0.0464700758f, 0.649281383f},
-std::array<float,2>{0.760055721f, 0.237169936f},
-std::array<float,2>{0.408132225f, 0.415534943f},
-std::array<float,2>{0.658948958f, 0.975321531f},
-std::array<float,2>{0.492510349f, 0.592979014f},
-std::array<float,2>{0.749360025f, 0.0851816833f},
-std::array<float,2>{0.0721643344f, 0.368456751f},
-std::array<float,2>{0.82158649f, 0.796909392f},
-std::array<float,2>{0.235416889f, 0.888635278f},
-std::array<float,2>{0.913671613f, 0.495208621f},
-std::array<float,2>{0.253420591f, 0.182225704f},
-std::array<float,2>{0.587205768f, 0.696332216f},
-std::array<float,2>{0.39865905f, 0.937501252f},
-std::array<float,2>{0.64703244f, 0.397297919f},
-std::array<float,2>{0.00885437243f, 0.208468378f},
-std::array<float,2>{0.80816412f, 0.65830934f},
-std::array<float,2>{0.126690924f, 0.534510314f},
-std::array<float,2>{0.942710042f, 0.0493587032f},
-std::array<float,2>{0.340061456f, 0.25826636f},
-std::array<float,2>{0.512750149f, 0.840509534f},
-std::array<float,2>{0.310185373f, 0.744245589f},
-std::array<float,2>{0.601453781f, 0.126732022f},
-std::array<float,2>{0.204218566f, 0.448548466f},
-std::array<float,2>{0.88182652f, 0.908021092f},
-std::array<float,2>{0.097256124f, 0.778570652f},
-std::array<float,2>{0.873213887f, 0.342089653f},
-std::array<float,2>{0.453892171f, 0.118809476f},
-std::array<float,2>{0.689541817f, 0.612003148f},
-std::array<float,2>{0.280670822f, 0.922745585f},
-std::array<float,2>{0.569370568f, 0.460500836f},
-std::array<float,2>{0.224706024f, 0.1472646f},
-std::array<float,2>{0.925951481f, 0.730908573f},
-std::array<float,2>{0.0935906544f, 0.604499161f},
-std::array<float,2>{0.842973828f, 0.0959766433f},
-std::array<float,2>{0.468761384f, 0.323973149f},
-std::array<float,2>{0.719269812f, 0.759812951f},
-std::array<float,2>{0.422731251f, 0.675524592f},
-std::array<float,2>{0.675999522f, 0.201300383f},
-std::array<float,2>{0.0545974933f, 0.376657635f},
-std::array<float,2>{0.767337322f, 0.956496179f},
-std::array<float,2>{0.157995358f, 0.822965264f},
-std::array<float,2>{0.970826566f, 0.272458434f},
-std::array<float,2>{0.372544438f, 0.0346515924f},
-std::array<float,2>{0.54576236f, 0.554883003f},
-std::array<float,2>{0.452025235f, 0.781853735f},
-std::array<float,2>{0.706611753f, 0.345346987f},
-std::array<float,2>{0.11933241f, 0.075646542f},
-std::array<float,2>{0.853024662f, 0.572740138f},
-std::array<float,2>{0.200798377f, 0.718277037f},
-std::array<float,2>{0.897114217f, 0.169500098f},
-std::array<float,2>{0.285926104f, 0.472978085f},
-std::array<float,2>{0.624907255f, 0.900765777f},
-std::array<float,2>{0.319580436f, 0.520868421f},
-std::array<float,2>{0.517547548f, 0.0164766703f},
-std::array<float,2>{0.14193663f, 0.28573966f},
-std::array<float,2>{0.963612854f, 0.867591858f},
-std::array<float,2>{0.0262936559f, 0.992200613f},
-std::array<float,2>{0.783755243f, 0.422820061f},
-std::array<float,2>{0.380999893f, 0.22490716f},
-std::array<float,2>{0.626309693f, 0.625242949f},
-std::array<float,2>{0.289765f, 0.752745688f},
-std::array<float,2>{0.614272952f, 0.319581568f},
-std::array<float,2>{0.189134359f, 0.102412969f},
-std::array<float,2>{0.905339897f, 0.597818613f},
-std::array<float,2>{0.113218404f, 0.722028792f},
-std::array<float,2>{0.846525013f, 0.148931906f},
-std::array<float,2>{0.44471243f, 0.462341905f},
-std::array<float,2>{0.714059234f, 0.931514919f},
-std::array<float,2>{0.385292739f, 0.55345422f},
-std::array<float,2>{0.637470365f, 0.0408133715f},
-std::array<float,2>{0.0212165695f, 0.274185061f},
-std::array<float,2>{0.79417932f, 0.817787588f},
-std::array<float,2>{0.14997983f, 0.963424444f},
-std::array<float,2>{0.956006467f, 0.387959123f},
-std::array<float,2>{0.326299846f, 0.190316573f},
-std::array<float,2>{0.530514538f, 0.683373272f},
-std::array<float,2>{0.477198392f, 0.894255877f},
-std::array<float,2>{0.728597641f, 0.478779078f},
-std::array<float,2>{0.0837783292f, 0.160562977f},
-std::array<float,2>{0.83022505f, 0.7107566f},
-std::array<float,2>{0.231987938f, 0.569393456f},
-std::array<float,2>{0.936946929f, 0.066957362f},
-std::array<float,2>{0.265855521f, 0.352070689f},
-std::array<float,2>{0.574941695f, 0.794023097f},
-std::array<float,2>{0.366878301f, 0.633783698f},
-std::array<float,2>{0.538486719f, 0.228775278f},
-std::array<float,2>{0.167640626f, 0.435036272f},
-std::array<float,2>{0.978572786f, 0.991616368f},
-std::array<float,2>{0.0582808778f, 0.85948205f},
-std::array<float,2>{0.77415216f, 0.290283084f},
-std::array<float,2>{0.43385011f, 0.0271404441f},
-std::array<float,2>{0.681977034f, 0.52718389f},
-std::array<float,2>{0.328727484f, 0.984168112f},
-std::array<float,2>{0.505265832f, 0.409327924f},
-std::array<float,2>{0.135824025f, 0.248468846f},
-std::array<float,2>{0.948228419f, 0.646719754f},
-std::array<float,2>{0.000658702513f, 0.513191879f},
-std::array<float,2>{0.799908638f, 0.00770130567f},
-std::array<float,2>{0.39614889f, 0.302888364f},
-std::array<float,2>{0.652014494f, 0.845799387f},
-std::array<float,2>{0.462474167f, 0.694899321f},
-std::array<float,2>{0.695969045f, 0.177070394f},
-std::array<float,2>{0.102211609f, 0.491214544f},
-std::array<float,2>{0.86053884f, 0.881208062f},
-std::array<float,2>{0.211032376f, 0.811709642f},
-std::array<float,2>{0.889623582f, 0.363396168f},
-std::array<float,2>{0.304388881f, 0.0888546482f},
-std::array<float,2>{0.60639298f, 0.579927921f},
-std::array<float,2>{0.420431763f, 0.835067868f},
-std::array<float,2>{0.66854769f, 0.256273121f},
-std::array<float,2>{0.0335723497f, 0.060363654f},
-std::array<float,2>{0.750328422f, 0.541261792f},
-std::array<float,2>{0.172830984f, 0.664618969f},
-std::array<float,2>{0.989931405f, 0.214322031f},
-std::array<float,2>{0.357359052f, 0.399502367f},
-std::array<float,2>{0.561893344f, 0.948450863f},
-std::array<float,2>{0.259537309f, 0.621231854f},
-std::array<float,2>{0.581903875f, 0.115747198f},
-std::array<float,2>{0.243313834f, 0.331637144f},
-std::array<float,2>{0.921744585f, 0.768554628f},
-std::array<float,2>{0.0641712248f, 0.918949127f},
-std::array<float,2>{0.815850854f, 0.441215545f},
-std::array<float,2>{0.49168402f, 0.138062254f},
-std::array<float,2>{0.739154756f, 0.739212096f},
-std::array<float,2>{0.257291853f, 0.815123558f},
-std::array<float,2>{0.593181193f, 0.278310955f},
-std::array<float,2>{0.24093619f, 0.0451359339f},
-std::array<float,2>{0.908187628f, 0.549247861f},
-std::array<float,2>{0.0744781867f, 0.684231579f},
-std::array<float,2>{0.827075362f, 0.192575455f},
-std::array<float,2>{0.498313308f, 0.383502603f},
-std::array<float,2>{0.742904842f, 0.96715492f},
-std::array<float,2>{0.410463214f, 0.596527815f},
-std::array<float,2>{0.663778722f, 0.105824642f},
-std::array<float,2>{0.0394425131f, 0.31475836f},
-std::array<float,2>{0.763882101f, 0.757199168f},
-std::array<float,2>{0.184184298f, 0.934494734f},
-std::array<float,2>{0.999124885f, 0.467381626f},
-std::array<float,2>{0.345067382f, 0.153524116f},
-std::array<float,2>{0.553499877f, 0.722738326f},
-std::array<float,2>{0.458354235f, 0.988177776f},
-std::array<float,2>{0.694857121f, 0.430282176f},
-std::array<float,2>{0.0994943157f, 0.230903685f},
-std::array<float,2>{0.868570626f, 0.636997759f},
-std::array<float,2>{0.210878193f, 0.53029722f},
-std::array<float,2>{0.876755416f, 0.0307759009f},
-std::array<float,2>{0.306889951f, 0.295550257f},
-std::array<float,2>{0.595586121f, 0.86420548f},
-std::array<float,2>{0.337654442f, 0.703650892f},
-std::array<float,2>{0.508008361f, 0.156789809f},
-std::array<float,2>{0.131367445f, 0.483283848f},
-std::array<float,2>{0.940236688f, 0.8955217f},
-std::array<float,2>{0.0151820658f, 0.792393625f},
-std::array<float,2>{0.810772896f, 0.357110858f},
-std::array<float,2>{0.404172629f, 0.0649613366f},
-std::array<float,2>{0.642030895f, 0.564060748f},
-std::array<float,2>{0.368165851f, 0.876748443f},
-std::array<float,2>{0.541253984f, 0.486091644f},
-std::array<float,2>{0.161931157f, 0.172161773f},
-std::array<float,2>{0.97532934f, 0.690889776f},
-std::array<float,2>{0.0494866073f, 0.585396469f},
-std::array<float,2>{0.773087859f, 0.0911133513f},
-std::array<float,2>{0.427622914f, 0.359487385f},
-std::array<float,2>{0.672077239f, 0.804940641f},
-std::array<float,2>{0.473780036f, 0.644169569f},
-std::array<float,2>{0.725701034f, 0.244048581f},
-std::array<float,2>{0.0876645595f, 0.412956804f},
-std::array<float,2>{0.838731587f, 0.978681922f},
-std::array<float,2>{0.222138703f, 0.848098397f},
-std::array<float,2>{0.924993694f, 0.299887121f},
-std::array<float,2>{0.276152164f, 0.000445131678f},
-std::array<float,2>{0.564963579f, 0.510805428f},
-std::array<float,2>{0.377346873f, 0.770675719f},
-std::array<float,2>{0.629036605f, 0.33338502f},
-std::array<float,2>{0.0301969089f, 0.110516004f},
-std::array<float,2>{0.785445511f, 0.62072295f},
-std::array<float,2>{0.144910574f, 0.734896421f},
-std::array<float,2>{0.965218067f, 0.136667684f},
-std::array<float,2>{0.314020842f, 0.443835407f},
-std::array<float,2>{0.520305932f, 0.915013075f},
-std::array<float,2>{0.284551173f, 0.546398401f},
-std::array<float,2>{0.618697643f, 0.0551845357f},
-std::array<float,2>{0.195827261f, 0.252438724f},
-std::array<float,2>{0.893663406f, 0.831513524f},
-std::array<float,2>{0.122754224f, 0.952406347f},
-std::array<float,2>{0.859279692f, 0.402345389f},
-std::array<float,2>{0.445937574f, 0.216382027f},
-std::array<float,2>{0.708861649f, 0.668521345f},
-std::array<float,2>{0.323784798f, 0.804524958f},
-std::array<float,2>{0.524372041f, 0.373960972f},
-std::array<float,2>{0.153651953f, 0.0819777921f},
-std::array<float,2>{0.960732579f, 0.58897537f},
-std::array<float,2>{0.0166976415f, 0.700851321f},
-std::array<float,2>{0.789794981f, 0.186495736f},
-std::array<float,2>{0.387439787f, 0.49641937f},
-std::array<float,2>{0.633182228f, 0.884952724f},
-std::array<float,2>{0.441213548f, 0.500726461f},
-std::array<float,2>{0.717492044f, 0.0104164733f},
-std::array<float,2>{0.114746161f, 0.311420351f},
-std::array<float,2>{0.849988461f, 0.856787503f},
-std::array<float,2>{0.192213327f, 0.972194076f},
-std::array<float,2>{0.901494861f, 0.420041859f},
-std::array<float,2>{0.293881863f, 0.241846889f},
-std::array<float,2>{0.609917819f, 0.652806401f},
-std::array<float,2>{0.431021065f, 0.913665295f},
-std::array<float,2>{0.685410917f, 0.449666947f},
-std::array<float,2>{0.0599968359f, 0.129507706f},
-std::array<float,2>{0.780534923f, 0.74855876f},
-std::array<float,2>{0.171104461f, 0.614297509f},
-std::array<float,2>{0.980775297f, 0.121536054f},
-std::array<float,2>{0.361410677f, 0.337981194f},
-std::array<float,2>{0.532907188f, 0.775791705f},
-std::array<float,2>{0.270414114f, 0.66348666f},
-std::array<float,2>{0.571515381f, 0.205832064f},
-std::array<float,2>{0.229884595f, 0.391279221f},
-std::array<float,2>{0.933325887f, 0.941733062f},
-std::array<float,2>{0.080664359f, 0.838952303f},
-std::array<float,2>{0.832484424f, 0.261903375f},
-std::array<float,2>{0.481644005f, 0.052102901f},
-std::array<float,2>{0.730480731f, 0.535165966f},
-std::array<float,2>{0.300274879f, 0.960073411f},
-std::array<float,2>{0.604988813f, 0.379849136f},
-std::array<float,2>{0.217693597f, 0.198932156f},
-std::array<float,2>{0.885635436f, 0.675942779f},
-std::array<float,2>{0.108286276f, 0.559738278f},
-std::array<float,2>{0.864666581f, 0.038745869f},
-std::array<float,2>{0.465681732f, 0.267062753f},
-std::array<float,2>{0.699661314f, 0.824311614f},
-std::array<float,2>{0.392078102f, 0.728734672f},
-std::array<float,2>{0.652846992f, 0.141620636f},
-std::array<float,2>{0.00413016463f, 0.453388065f},
-std::array<float,2>{0.803564489f, 0.927945554f},
-std::array<float,2>{0.138057724f, 0.76366204f},
-std::array<float,2>{0.949282646f, 0.327229202f},
-std::array<float,2>{0.335301518f, 0.0979474187f},
-std::array<float,2>{0.50110805f, 0.605994284f},
-std::array<float,2>{0.486917168f, 0.871868849f},
-std::array<float,2>{0.736984134f, 0.284783542f},
-std::array<float,2>{0.0676271617f, 0.0209839176f},
-std::array<float,2>{0.818119764f, 0.518468916f},
-std::array<float,2>{0.249308616f, 0.630210817f},
-std::array<float,2>{0.916032791f, 0.22151351f},
-std::array<float,2>{0.263381302f, 0.429508507f},
-std::array<float,2>{0.583890557f, 0.999685764f},
-std::array<float,2>{0.35168612f, 0.575237513f},
-std::array<float,2>{0.5552935f, 0.0719255656f},
-std::array<float,2>{0.176828861f, 0.348066628f},
-std::array<float,2>{0.98574239f, 0.786846876f},
-std::array<float,2>{0.0369542576f, 0.90238899f},
-std::array<float,2>{0.755452394f, 0.469849676f},
-std::array<float,2>{0.416753411f, 0.167713836f},
-std::array<float,2>{0.664790213f, 0.710942268f},
-std::array<float,2>{0.371220142f, 0.821986496f},
-std::array<float,2>{0.546083927f, 0.270570517f},
-std::array<float,2>{0.156730652f, 0.0322453454f},
-std::array<float,2>{0.971814871f, 0.557730377f},
-std::array<float,2>{0.053432636f, 0.673088133f},
-std::array<float,2>{0.76567328f, 0.200984299f},
-std::array<float,2>{0.423407227f, 0.378235698f},
-std::array<float,2>{0.677165091f, 0.95499748f},
-std::array<float,2>{0.470534682f, 0.602326274f},
-std::array<float,2>{0.720351994f, 0.0956969857f},
-std::array<float,2>{0.0918387324f, 0.32123667f},
-std::array<float,2>{0.841901898f, 0.758447886f},
-std::array<float,2>{0.226135582f, 0.925566375f},
-std::array<float,2>{0.927258193f, 0.45814383f},
-std::array<float,2>{0.279921621f, 0.144839957f},
-std::array<float,2>{0.569174767f, 0.732681692f},
-std::array<float,2>{0.381949097f, 0.994401753f},
-std::array<float,2>{0.625894964f, 0.425141782f},
-std::array<float,2>{0.02717847f, 0.224603593f},
-std::array<float,2>{0.785014808f, 0.627264202f},
-std::array<float,2>{0.140684858f, 0.522129536f},
-std::array<float,2>{0.964513719f, 0.0190221369f},
-std::array<float,2>{0.31838724f, 0.287481725f},
-std::array<float,2>{0.51580739f, 0.869929016f},
-std::array<float,2>{0.286557138f, 0.715753317f},
-std::array<float,2>{0.623970151f, 0.171641797f},
-std::array<float,2>{0.200066164f, 0.475843042f},
-std::array<float,2>{0.89816916f, 0.899329305f},
-std::array<float,2>{0.120441929f, 0.784876287f},
-std::array<float,2>{0.851959407f, 0.347199291f},
-std::array<float,2>{0.452219367f, 0.077387847f},
-std::array<float,2>{0.705877841f, 0.571435392f},
-std::array<float,2>{0.252062351f, 0.889650047f},
-std::array<float,2>{0.586776376f, 0.49399963f},
-std::array<float,2>{0.234730467f, 0.181135774f},
-std::array<float,2>{0.912377596f, 0.698821187f},
-std::array<float,2>{0.0709361881f, 0.590991139f},
-std::array<float,2>{0.820857346f, 0.0823534951f},
-std::array<float,2>{0.493888527f, 0.369791776f},
-std::array<float,2>{0.748846412f, 0.798947871f},
-std::array<float,2>{0.406459898f, 0.650770128f},
-std::array<float,2>{0.659940422f, 0.235749006f},
-std::array<float,2>{0.0452666804f, 0.416813374f},
-std::array<float,2>{0.760903537f, 0.973993182f},
-std::array<float,2>{0.182920977f, 0.85170871f},
-std::array<float,2>{0.993700147f, 0.305878639f},
-std::array<float,2>{0.349064469f, 0.0149489883f},
-std::array<float,2>{0.547463477f, 0.505919874f},
-std::array<float,2>{0.454675585f, 0.779542387f},
-std::array<float,2>{0.690617561f, 0.341661394f},
-std::array<float,2>{0.0965358391f, 0.12027397f},
-std::array<float,2>{0.87430954f, 0.610673845f},
-std::array<float,2>{0.203914613f, 0.743384898f},
-std::array<float,2>{0.882392466f, 0.128258377f},
-std::array<float,2>{0.309015214f, 0.445784181f},
-std::array<float,2>{0.59965688f, 0.908681452f},
-std::array<float,2>{0.341513962f, 0.53135699f},
-std::array<float,2>{0.512023151f, 0.0474380627f},
-std::array<float,2>{0.125634104f, 0.260771841f},
-std::array<float,2>{0.942092836f, 0.842766881f},
-std::array<float,2>{0.00812935177f, 0.939463854f},
-std::array<float,2>{0.807199895f, 0.394810498f},
-std::array<float,2>{0.399573833f, 0.2092195f},
-std::array<float,2>{0.647648394f, 0.656327486f},
-std::array<float,2>{0.303690761f, 0.810433269f},
-std::array<float,2>{0.60728246f, 0.366496086f},
-std::array<float,2>{0.212157801f, 0.0877031535f},
-std::array<float,2>{0.890000522f, 0.581185937f},
-std::array<float,2>{0.102814212f, 0.691779792f},
-std::array<float,2>{0.860244453f, 0.178881839f},
-std::array<float,2>{0.461489558f, 0.489696085f},
-std::array<float,2>{0.696603179f, 0.880206347f},
-std::array<float,2>{0.395160794f, 0.514475703f},
-std::array<float,2>{0.650884748f, 0.00551306736f},
-std::array<float,2>{0.0010937429f, 0.301522166f},
-std::array<float,2>{0.798851132f, 0.844545364f},
-std::array<float,2>{0.134964228f, 0.980932772f},
-std::array<float,2>{0.94867599f, 0.406741768f},
-std::array<float,2>{0.330001891f, 0.247313008f},
-std::array<float,2>{0.504524112f, 0.644877553f},
-std::array<float,2>{0.490479916f, 0.920029521f},
-std::array<float,2>{0.739605069f, 0.43806389f},
-std::array<float,2>{0.0634651482f, 0.138965413f},
-std::array<float,2>{0.814471424f, 0.74205786f},
-std::array<float,2>{0.242313355f, 0.624500155f},
-std::array<float,2>{0.920646906f, 0.113671251f},
-std::array<float,2>{0.258780569f, 0.329040378f},
-std::array<float,2>{0.580925345f, 0.767217934f},
-std::array<float,2>{0.356235504f, 0.667300284f},
-std::array<float,2>{0.560604453f, 0.211496219f},
-std::array<float,2>{0.17368798f, 0.40202263f},
-std::array<float,2>{0.989007473f, 0.94685322f},
-std::array<float,2>{0.0351051949f, 0.833063006f},
-std::array<float,2>{0.751225829f, 0.255541325f},
-std::array<float,2>{0.421659291f, 0.0620990284f},
-std::array<float,2>{0.66984576f, 0.539617956f},
-std::array<float,2>{0.327847689f, 0.962576926f},
-std::array<float,2>{0.530109107f, 0.390076488f},
-std::array<float,2>{0.14893195f, 0.188387141f},
-std::array<float,2>{0.957013309f, 0.681452215f},
-std::array<float,2>{0.0204956941f, 0.55153501f},
-std::array<float,2>{0.793900669f, 0.0417657793f},
-std::array<float,2>{0.386068791f, 0.277222514f},
-std::array<float,2>{0.638057172f, 0.820025384f},
-std::array<float,2>{0.443366677f, 0.720397711f},
-std::array<float,2>{0.71379602f, 0.150926188f},
-std::array<float,2>{0.111521408f, 0.464428842f},
-std::array<float,2>{0.847653508f, 0.932441294f},
-std::array<float,2>{0.188084051f, 0.751938939f},
-std::array<float,2>{0.90431565f, 0.318078876f},
-std::array<float,2>{0.290559769f, 0.104137786f},
-std::array<float,2>{0.614230514f, 0.600683808f},
-std::array<float,2>{0.434675038f, 0.862514913f},
-std::array<float,2>{0.683171034f, 0.291298419f},
-std::array<float,2>{0.0571041256f, 0.024368437f},
-std::array<float,2>{0.775003493f, 0.524308681f},
-std::array<float,2>{0.166738093f, 0.634779096f},
-std::array<float,2>{0.97996968f, 0.227491543f},
-std::array<float,2>{0.365692377f, 0.435770184f},
-std::array<float,2>{0.537179887f, 0.989345789f},
-std::array<float,2>{0.267440796f, 0.566454709f},
-std::array<float,2>{0.57570219f, 0.0698999166f},
-std::array<float,2>{0.231377035f, 0.355325818f},
-std::array<float,2>{0.936122835f, 0.795734465f},
-std::array<float,2>{0.0822659656f, 0.892254829f},
-std::array<float,2>{0.831772625f, 0.47770521f},
-std::array<float,2>{0.478430778f, 0.163458973f},
-std::array<float,2>{0.729650736f, 0.70865339f},
-std::array<float,2>{0.27680701f, 0.850845575f},
-std::array<float,2>{0.56591332f, 0.297681212f},
-std::array<float,2>{0.220966175f, 0.00360913132f},
-std::array<float,2>{0.924189806f, 0.509641588f},
-std::array<float,2>{0.0862048045f, 0.641210198f},
-std::array<float,2>{0.839789987f, 0.245674819f},
-std::array<float,2>{0.473518103f, 0.411306232f},
-std::array<float,2>{0.724658906f, 0.977496564f},
-std::array<float,2>{0.426505566f, 0.583970666f},
-std::array<float,2>{0.673330903f, 0.093723461f},
-std::array<float,2>{0.0504760034f, 0.363122165f},
-std::array<float,2>{0.771602213f, 0.806828678f},
-std::array<float,2>{0.160381258f, 0.877936244f},
-std::array<float,2>{0.975707352f, 0.486464262f},
-std::array<float,2>{0.368162006f, 0.174888134f},
-std::array<float,2>{0.54225868f, 0.688233852f},
-std::array<float,2>{0.447176069f, 0.95079565f},
-std::array<float,2>{0.707915902f, 0.405699134f},
-std::array<float,2>{0.121265039f, 0.216986373f},
-std::array<float,2>{0.857435882f, 0.670295477f},
-std::array<float,2>{0.196787745f, 0.544793189f},
-std::array<float,2>{0.893208504f, 0.0585191883f},
-std::array<float,2>{0.283818007f, 0.251614362f},
-std::array<float,2>{0.617517292f, 0.829187632f},
-std::array<float,2>{0.313446045f, 0.737429023f},
-std::array<float,2>{0.520761788f, 0.132950738f},
-std::array<float,2>{0.146430969f, 0.442293018f},
-std::array<float,2>{0.96591121f, 0.916619837f},
-std::array<float,2>{0.0310806427f, 0.771810889f},
-std::array<float,2>{0.786606014f, 0.334160626f},
-std::array<float,2>{0.378196001f, 0.112012774f},
-std::array<float,2>{0.630385101f, 0.61826551f},
-std::array<float,2>{0.344164819f, 0.935773551f},
-std::array<float,2>{0.554609895f, 0.466159105f},
-std::array<float,2>{0.185048193f, 0.154385939f},
-std::array<float,2>{0.99839431f, 0.724800169f},
-std::array<float,2>{0.0408496782f, 0.594352186f},
-std::array<float,2>{0.764998972f, 0.108321078f},
-std::array<float,2>{0.411441803f, 0.312551737f},
-std::array<float,2>{0.662559211f, 0.755430639f},
-std::array<float,2>{0.499400586f, 0.68749851f},
-std::array<float,2>{0.74407804f, 0.194344103f},
-std::array<float,2>{0.0759721547f, 0.384958208f},
-std::array<float,2>{0.827985168f, 0.965411901f},
-std::array<float,2>{0.242111072f, 0.813652098f},
-std::array<float,2>{0.906276524f, 0.280309379f},
-std::array<float,2>{0.256731927f, 0.0435169451f},
-std::array<float,2>{0.592639148f, 0.547884405f},
-std::array<float,2>{0.402855188f, 0.790850163f},
-std::array<float,2>{0.640971005f, 0.359183788f},
-std::array<float,2>{0.0137969488f, 0.0626119822f},
-std::array<float,2>{0.81186527f, 0.565858543f},
-std::array<float,2>{0.132487908f, 0.706236422f},
-std::array<float,2>{0.940434992f, 0.158750266f},
-std::array<float,2>{0.336571544f, 0.480986565f},
-std::array<float,2>{0.509111881f, 0.898401797f},
-std::array<float,2>{0.308247328f, 0.528838336f},
-std::array<float,2>{0.594480991f, 0.0292804558f},
-std::array<float,2>{0.209585235f, 0.293285906f},
-std::array<float,2>{0.87541163f, 0.866423428f},
-std::array<float,2>{0.0981371626f, 0.986310065f},
-std::array<float,2>{0.867438555f, 0.433262348f},
-std::array<float,2>{0.457812458f, 0.233890757f},
-std::array<float,2>{0.693886578f, 0.640207469f},
-std::array<float,2>{0.334800065f, 0.765425265f},
-std::array<float,2>{0.500050783f, 0.324257135f},
-std::array<float,2>{0.137586519f, 0.0999664292f},
-std::array<float,2>{0.951080859f, 0.609219074f},
-std::array<float,2>{0.00521422317f, 0.726826072f},
-std::array<float,2>{0.804226339f, 0.142750308f},
-std::array<float,2>{0.39144966f, 0.455265254f},
-std::array<float,2>{0.653351068f, 0.927593887f},
-std::array<float,2>{0.466475785f, 0.561157525f},
-std::array<float,2>{0.701075673f, 0.0360634811f},
-std::array<float,2>{0.10878472f, 0.269146025f},
-std::array<float,2>{0.864110231f, 0.826288342f},
-std::array<float,2>{0.218645096f, 0.957679927f},
-std::array<float,2>{0.886672556f, 0.38185662f},
-std::array<float,2>{0.29953289f, 0.196937248f},
-std::array<float,2>{0.603586078f, 0.678486049f},
-std::array<float,2>{0.417844832f, 0.905918419f},
-std::array<float,2>{0.665916979f, 0.470732957f},
-std::array<float,2>{0.0352302566f, 0.165672198f},
-std::array<float,2>{0.754431605f, 0.714328229f},
-std::array<float,2>{0.176452458f, 0.576364517f},
-std::array<float,2>{0.985152662f, 0.0736292005f},
-std::array<float,2>{0.353144765f, 0.351249158f},
-std::array<float,2>{0.55596453f, 0.787282586f},
-std::array<float,2>{0.262649417f, 0.632045209f},
-std::array<float,2>{0.582267225f, 0.219441071f},
-std::array<float,2>{0.248416677f, 0.427192897f},
-std::array<float,2>{0.917909086f, 0.996504366f},
-std::array<float,2>{0.0666437745f, 0.874852777f},
-std::array<float,2>{0.817314804f, 0.281512618f},
-std::array<float,2>{0.487681389f, 0.0234268699f},
-std::array<float,2>{0.737591505f, 0.516473293f},
-std::array<float,2>{0.294585407f, 0.969624281f},
-std::array<float,2>{0.610642552f, 0.419865966f},
-std::array<float,2>{0.193055421f, 0.239806265f},
-std::array<float,2>{0.900556922f, 0.655182838f},
-std::array<float,2>{0.113385238f, 0.503186703f},
-std::array<float,2>{0.85084939f, 0.00803077128f},
-std::array<float,2>{0.439915061f, 0.309732288f},
-std::array<float,2>{0.718510032f, 0.858905733f},
-std::array<float,2>{0.388664484f, 0.702474236f},
-std::array<float,2>{0.634218991f, 0.185288489f},
-std::array<float,2>{0.0158418212f, 0.499664426f},
-std::array<float,2>{0.79028368f, 0.883467078f},
-std::array<float,2>{0.153125048f, 0.802701354f},
-std::array<float,2>{0.959555924f, 0.372385621f},
-std::array<float,2>{0.322816551f, 0.0792292133f},
-std::array<float,2>{0.524757802f, 0.586415589f},
-std::array<float,2>{0.481358886f, 0.837297618f},
-std::array<float,2>{0.731930375f, 0.264571935f},
-std::array<float,2>{0.0819915608f, 0.0542780124f},
-std::array<float,2>{0.833591759f, 0.539061666f},
-std::array<float,2>{0.229451582f, 0.660508037f},
-std::array<float,2>{0.931803524f, 0.204837441f},
-std::array<float,2>{0.270713925f, 0.393421769f},
-std::array<float,2>{0.570597053f, 0.944173515f},
-std::array<float,2>{0.362983435f, 0.616639674f},
-std::array<float,2>{0.531386971f, 0.12453685f},
-std::array<float,2>{0.170072019f, 0.337659836f},
-std::array<float,2>{0.981937885f, 0.775131106f},
-std::array<float,2>{0.0593381003f, 0.910913765f},
-std::array<float,2>{0.77965337f, 0.451493889f},
-std::array<float,2>{0.430262417f, 0.131523162f},
-std::array<float,2>{0.683876932f, 0.747488976f},
-std::array<float,2>{0.317882717f, 0.868458927f},
-std::array<float,2>{0.51942277f, 0.286978871f},
-std::array<float,2>{0.144026339f, 0.0172708146f},
-std::array<float,2>{0.96161437f, 0.519824326f},
-std::array<float,2>{0.0244349837f, 0.626223624f},
-std::array<float,2>{0.782228172f, 0.226210207f},
-std::array<float,2>{0.37899822f, 0.423203617f},
-std::array<float,2>{0.628087223f, 0.993303657f},
-std::array<float,2>{0.450953215f, 0.573503315f},
-std::array<float,2>{0.703458548f, 0.0744519308f},
-std::array<float,2>{0.119006693f, 0.343984097f},
-std::array<float,2>{0.854569972f, 0.782812119f},
-std::array<float,2>{0.201194197f, 0.902139843f},
-std::array<float,2>{0.895692647f, 0.474409491f},
-std::array<float,2>{0.288980812f, 0.168807968f},
-std::array<float,2>{0.621207178f, 0.717558742f},
-std::array<float,2>{0.423969209f, 0.955151975f},
-std::array<float,2>{0.678112626f, 0.375923485f},
-std::array<float,2>{0.0518324077f, 0.202312559f},
-std::array<float,2>{0.76887393f, 0.674563289f},
-std::array<float,2>{0.158726797f, 0.55594331f},
-std::array<float,2>{0.9703089f, 0.0336262099f},
-std::array<float,2>{0.373224437f, 0.272628248f},
-std::array<float,2>{0.543149412f, 0.823350728f},
-std::array<float,2>{0.27794081f, 0.73192054f},
-std::array<float,2>{0.56763351f, 0.148264736f},
-std::array<float,2>{0.224541485f, 0.459835619f},
-std::array<float,2>{0.929502845f, 0.923588991f},
-std::array<float,2>{0.0909189582f, 0.761613548f},
-std::array<float,2>{0.840072095f, 0.322362542f},
-std::array<float,2>{0.472218871f, 0.0974840447f},
-std::array<float,2>{0.721592367f, 0.604321361f},
-std::array<float,2>{0.311723828f, 0.90681529f},
-std::array<float,2>{0.598641098f, 0.447983086f},
-std::array<float,2>{0.206703573f, 0.125937879f},
-std::array<float,2>{0.880473316f, 0.745221198f},
-std::array<float,2>{0.0940034539f, 0.612644792f},
-std::array<float,2>{0.871732116f, 0.117448635f},
-std::array<float,2>{0.455517292f, 0.343117207f},
-std::array<float,2>{0.688176572f, 0.777360976f},
-std::array<float,2>{0.401479542f, 0.659937501f},
-std::array<float,2>{0.645411074f, 0.20783481f},
-std::array<float,2>{0.0113443471f, 0.39771083f},
-std::array<float,2>{0.805965364f, 0.938829958f},
-std::array<float,2>{0.127414539f, 0.841028273f},
-std::array<float,2>{0.943719447f, 0.259659529f},
-std::array<float,2>{0.341884136f, 0.0507748015f},
-std::array<float,2>{0.515381634f, 0.534036517f},
-std::array<float,2>{0.494676173f, 0.798416078f},
-std::array<float,2>{0.746481657f, 0.36813584f},
-std::array<float,2>{0.0723770782f, 0.0842284709f},
-std::array<float,2>{0.824206769f, 0.592368662f},
-std::array<float,2>{0.23654297f, 0.695920527f},
-std::array<float,2>{0.911082029f, 0.18278271f},
-std::array<float,2>{0.251452953f, 0.494902372f},
-std::array<float,2>{0.588615894f, 0.886889338f},
-std::array<float,2>{0.351132751f, 0.505110443f},
-std::array<float,2>{0.54909271f, 0.0119964918f},
-std::array<float,2>{0.180844933f, 0.306840092f},
-std::array<float,2>{0.995449603f, 0.85391432f},
-std::array<float,2>{0.0446947552f, 0.976524293f},
-std::array<float,2>{0.758613765f, 0.414605498f},
-std::array<float,2>{0.409073353f, 0.237551138f},
-std::array<float,2>{0.658054769f, 0.649552882f},
-std::array<float,2>{0.260195673f, 0.769309759f},
-std::array<float,2>{0.578287184f, 0.330786079f},
-std::array<float,2>{0.245761603f, 0.116346791f},
-std::array<float,2>{0.918090403f, 0.622982919f},
-std::array<float,2>{0.0658806562f, 0.73937571f},
-std::array<float,2>{0.813737571f, 0.136992097f},
-std::array<float,2>{0.489246279f, 0.439751178f},
-std::array<float,2>{0.740672946f, 0.918000042f},
-std::array<float,2>{0.418021023f, 0.542943954f},
-std::array<float,2>{0.671676576f, 0.0591807365f},
-std::array<float,2>{0.0329185575f, 0.257342815f},
-std::array<float,2>{0.753215373f, 0.834683061f},
-std::array<float,2>{0.175238818f, 0.947752953f},
-std::array<float,2>{0.990362227f, 0.399308652f},
-std::array<float,2>{0.358369589f, 0.213646576f},
-std::array<float,2>{0.560098112f, 0.665165544f},
-std::array<float,2>{0.463410437f, 0.882137179f},
-std::array<float,2>{0.697785914f, 0.490985811f},
-std::array<float,2>{0.103710301f, 0.175846636f},
-std::array<float,2>{0.862598479f, 0.693404973f},
-std::array<float,2>{0.213729799f, 0.579039633f},
-std::array<float,2>{0.887489438f, 0.0895167142f},
-std::array<float,2>{0.302473098f, 0.365024924f},
-std::array<float,2>{0.608120203f, 0.811485827f},
-std::array<float,2>{0.331734121f, 0.648332536f},
-std::array<float,2>{0.506298423f, 0.24927637f},
-std::array<float,2>{0.133659348f, 0.408248782f},
-std::array<float,2>{0.946618557f, 0.983320892f},
-std::array<float,2>{0.00290866243f, 0.847324431f},
-std::array<float,2>{0.797241747f, 0.304651767f},
-std::array<float,2>{0.397288382f, 0.00673252577f},
-std::array<float,2>{0.648672283f, 0.51253593f},
-std::array<float,2>{0.363873303f, 0.990762115f},
-std::array<float,2>{0.535415947f, 0.434358358f},
-std::array<float,2>{0.16502434f, 0.229895428f},
-std::array<float,2>{0.978244364f, 0.634434462f},
-std::array<float,2>{0.0554713942f, 0.525987387f},
-std::array<float,2>{0.77714026f, 0.025887128f},
-std::array<float,2>{0.436367452f, 0.289297909f},
-std::array<float,2>{0.680599689f, 0.860678315f},
-std::array<float,2>{0.478900254f, 0.709115207f},
-std::array<float,2>{0.726811886f, 0.162074119f},
-std::array<float,2>{0.0850887373f, 0.479847312f},
-std::array<float,2>{0.828654408f, 0.893091261f},
-std::array<float,2>{0.234319344f, 0.793658495f},
-std::array<float,2>{0.933884561f, 0.353013575f},
-std::array<float,2>{0.26887247f, 0.0682910308f},
-std::array<float,2>{0.57664144f, 0.569241583f},
-std::array<float,2>{0.384064972f, 0.816777527f},
-std::array<float,2>{0.640500903f, 0.275250107f},
-std::array<float,2>{0.0227459576f, 0.0392628796f},
-std::array<float,2>{0.79584825f, 0.554252744f},
-std::array<float,2>{0.15057838f, 0.682557225f},
-std::array<float,2>{0.953147709f, 0.190975353f},
-std::array<float,2>{0.32490626f, 0.387199104f},
-std::array<float,2>{0.529010534f, 0.964075804f},
-std::array<float,2>{0.291170597f, 0.599217772f},
-std::array<float,2>{0.615914106f, 0.102669351f},
-std::array<float,2>{0.190618888f, 0.318978518f},
-std::array<float,2>{0.902777493f, 0.753644109f},
-std::array<float,2>{0.109486274f, 0.930554628f},
-std::array<float,2>{0.843854904f, 0.461880982f},
-std::array<float,2>{0.443358213f, 0.149574593f},
-std::array<float,2>{0.712647438f, 0.72145772f},
-std::array<float,2>{0.281578183f, 0.830509245f},
-std::array<float,2>{0.621000469f, 0.253069162f},
-std::array<float,2>{0.198929265f, 0.0564670786f},
-std::array<float,2>{0.890993774f, 0.545377314f},
-std::array<float,2>{0.124380454f, 0.669171572f},
-std::array<float,2>{0.856065631f, 0.21514f},
-std::array<float,2>{0.44812572f, 0.403625369f},
-std::array<float,2>{0.710626781f, 0.951573074f},
-std::array<float,2>{0.37579596f, 0.619584262f},
-std::array<float,2>{0.632384598f, 0.10999085f},
-std::array<float,2>{0.0285359547f, 0.332447886f},
-std::array<float,2>{0.789020777f, 0.769958854f},
-std::array<float,2>{0.147581533f, 0.915338337f},
-std::array<float,2>{0.967586815f, 0.444391847f},
-std::array<float,2>{0.315695018f, 0.135242864f},
-std::array<float,2>{0.521794856f, 0.73571068f},
-std::array<float,2>{0.476043284f, 0.980408669f},
-std::array<float,2>{0.723891556f, 0.41359213f},
-std::array<float,2>{0.0888559893f, 0.242403537f},
-std::array<float,2>{0.837379873f, 0.643292785f},
-std::array<float,2>{0.218817726f, 0.509774029f},
-std::array<float,2>{0.922623873f, 0.00148963137f},
-std::array<float,2>{0.275373846f, 0.298897445f},
-std::array<float,2>{0.563998759f, 0.848949373f},
-std::array<float,2>{0.369987458f, 0.690416873f},
-std::array<float,2>{0.539362371f, 0.173381269f},
-std::array<float,2>{0.16365476f, 0.484621495f},
-std::array<float,2>{0.973976672f, 0.875695407f},
-std::array<float,2>{0.0486977696f, 0.806634963f},
-std::array<float,2>{0.769572377f, 0.36128819f},
-std::array<float,2>{0.4291417f, 0.0899104923f},
-std::array<float,2>{0.674291909f, 0.584366262f},
-std::array<float,2>{0.338950604f, 0.894979179f},
-std::array<float,2>{0.509808958f, 0.484349281f},
-std::array<float,2>{0.12933962f, 0.157422036f},
-std::array<float,2>{0.938485146f, 0.704764962f},
-std::array<float,2>{0.0135250334f, 0.562891424f},
-std::array<float,2>{0.809748769f, 0.0657172799f},
-std::array<float,2>{0.4045026f, 0.355988175f},
-std::array<float,2>{0.642686307f, 0.791657567f},
-std::array<float,2>{0.460066885f, 0.638055384f},
-std::array<float,2>{0.69217521f, 0.232200772f},
-std::array<float,2>{0.100746043f, 0.431059569f},
-std::array<float,2>{0.870955408f, 0.986555994f},
-std::array<float,2>{0.207218766f, 0.865104258f},
-std::array<float,2>{0.87849015f, 0.29597041f},
-std::array<float,2>{0.305835277f, 0.0294975843f},
-std::array<float,2>{0.596976995f, 0.529733896f},
-std::array<float,2>{0.413435072f, 0.756818533f},
-std::array<float,2>{0.661766052f, 0.316068202f},
-std::array<float,2>{0.0411789939f, 0.1071724f},
-std::array<float,2>{0.763489842f, 0.597563386f},
-std::array<float,2>{0.18740578f, 0.723981142f},
-std::array<float,2>{0.99766171f, 0.152828574f},
-std::array<float,2>{0.346364528f, 0.467790842f},
-std::array<float,2>{0.551597357f, 0.935345292f},
-std::array<float,2>{0.253973842f, 0.550683141f},
-std::array<float,2>{0.590149224f, 0.0466394387f},
-std::array<float,2>{0.23980014f, 0.278735816f},
-std::array<float,2>{0.909755111f, 0.815835357f},
-std::array<float,2>{0.0772193521f, 0.968613863f},
-std::array<float,2>{0.826053262f, 0.383898556f},
-std::array<float,2>{0.496999532f, 0.191840097f},
-std::array<float,2>{0.745801032f, 0.685505211f},
-std::array<float,2>{0.354931802f, 0.786022902f},
-std::array<float,2>{0.558145761f, 0.349093914f},
-std::array<float,2>{0.178766012f, 0.0704137683f},
-std::array<float,2>{0.987695038f, 0.574961424f},
-std::array<float,2>{0.0376537293f, 0.712311625f},
-std::array<float,2>{0.756861091f, 0.166884169f},
-std::array<float,2>{0.414586276f, 0.469691247f},
-std::array<float,2>{0.667599916f, 0.90371424f},
-std::array<float,2>{0.485495567f, 0.518600285f},
-std::array<float,2>{0.735075235f, 0.0200693067f},
-std::array<float,2>{0.0689154491f, 0.284145474f},
-std::array<float,2>{0.820107818f, 0.872598827f},
-std::array<float,2>{0.247373521f, 0.998528421f},
-std::array<float,2>{0.915666938f, 0.427868932f},
-std::array<float,2>{0.2636756f, 0.222433582f},
-std::array<float,2>{0.585397363f, 0.629572034f},
-std::array<float,2>{0.393383294f, 0.928932607f},
-std::array<float,2>{0.655863523f, 0.454306096f},
-std::array<float,2>{0.00690331403f, 0.1410335f},
-std::array<float,2>{0.802091122f, 0.730236709f},
-std::array<float,2>{0.138737008f, 0.606902122f},
-std::array<float,2>{0.952025414f, 0.0987201706f},
-std::array<float,2>{0.333017975f, 0.32643804f},
-std::array<float,2>{0.502872109f, 0.762325168f},
-std::array<float,2>{0.298774064f, 0.676929653f},
-std::array<float,2>{0.602311015f, 0.197753668f},
-std::array<float,2>{0.216291994f, 0.380078763f},
-std::array<float,2>{0.883235753f, 0.959931254f},
-std::array<float,2>{0.106842488f, 0.825528502f},
-std::array<float,2>{0.865385532f, 0.266031533f},
-std::array<float,2>{0.468013197f, 0.0374104455f},
-std::array<float,2>{0.702205122f, 0.559549153f},
-std::array<float,2>{0.2728737f, 0.943085968f},
-std::array<float,2>{0.574048042f, 0.391827673f},
-std::array<float,2>{0.227273569f, 0.20652312f},
-std::array<float,2>{0.930287719f, 0.662370443f},
-std::array<float,2>{0.0796344578f, 0.536776423f},
-std::array<float,2>{0.83453095f, 0.0510444492f},
-std::array<float,2>{0.483838916f, 0.262949705f},
-std::array<float,2>{0.733359277f, 0.838206589f},
-std::array<float,2>{0.432034731f, 0.749701977f},
-std::array<float,2>{0.687499046f, 0.130481318f},
-std::array<float,2>{0.0615346022f, 0.45023182f},
-std::array<float,2>{0.777689517f, 0.912243843f},
-std::array<float,2>{0.169482991f, 0.776465416f},
-std::array<float,2>{0.98301369f, 0.339842826f},
-std::array<float,2>{0.359822005f, 0.122453794f},
-std::array<float,2>{0.534499526f, 0.613814592f},
-std::array<float,2>{0.438781738f, 0.856140196f},
-std::array<float,2>{0.715709031f, 0.311586797f},
-std::array<float,2>{0.117001817f, 0.0115140527f},
-std::array<float,2>{0.849222898f, 0.50166899f},
-std::array<float,2>{0.19400087f, 0.654012144f},
-std::array<float,2>{0.898560464f, 0.240892813f},
-std::array<float,2>{0.295858115f, 0.421741664f},
-std::array<float,2>{0.611702561f, 0.971519887f},
-std::array<float,2>{0.322025627f, 0.588032603f},
-std::array<float,2>{0.525672615f, 0.0800842494f},
-std::array<float,2>{0.155625537f, 0.374856561f},
-std::array<float,2>{0.957980037f, 0.802753091f},
-std::array<float,2>{0.0190696586f, 0.886704862f},
-std::array<float,2>{0.791497409f, 0.497613281f},
-std::array<float,2>{0.389208078f, 0.18676573f},
-std::array<float,2>{0.636349082f, 0.699424028f},
-std::array<float,2>{0.324578285f, 0.819439471f},
-std::array<float,2>{0.52859956f, 0.276683182f},
-std::array<float,2>{0.150886029f, 0.0414744653f},
-std::array<float,2>{0.953987479f, 0.550851524f},
-std::array<float,2>{0.0233275611f, 0.68099457f},
-std::array<float,2>{0.795019567f, 0.187671497f},
-std::array<float,2>{0.384532452f, 0.390474379f},
-std::array<float,2>{0.640002906f, 0.962189853f},
-std::array<float,2>{0.442796618f, 0.601295412f},
-std::array<float,2>{0.712023675f, 0.103809893f},
-std::array<float,2>{0.110311367f, 0.317752153f},
-std::array<float,2>{0.844679475f, 0.751350701f},
-std::array<float,2>{0.191313908f, 0.931750774f},
-std::array<float,2>{0.903265536f, 0.463889927f},
-std::array<float,2>{0.291752934f, 0.150645018f},
-std::array<float,2>{0.615647137f, 0.719787717f},
-std::array<float,2>{0.435918331f, 0.990064979f},
-std::array<float,2>{0.679936707f, 0.436434269f},
-std::array<float,2>{0.0549756773f, 0.226792485f},
-std::array<float,2>{0.776746154f, 0.635265887f},
-std::array<float,2>{0.164287269f, 0.523712099f},
-std::array<float,2>{0.977923512f, 0.0236672889f},
-std::array<float,2>{0.363460243f, 0.291965961f},
-std::array<float,2>{0.535683632f, 0.863214195f},
-std::array<float,2>{0.269283563f, 0.708146572f},
-std::array<float,2>{0.576667607f, 0.163732946f},
-std::array<float,2>{0.233757436f, 0.478188783f},
-std::array<float,2>{0.934189141f, 0.89184612f},
-std::array<float,2>{0.0855626613f, 0.795194447f},
-std::array<float,2>{0.828458965f, 0.354914039f},
-std::array<float,2>{0.479330748f, 0.0695330724f},
-std::array<float,2>{0.727147818f, 0.567332387f},
-std::array<float,2>{0.301957518f, 0.880503714f},
-std::array<float,2>{0.607757211f, 0.490128875f},
-std::array<float,2>{0.213125631f, 0.179666609f},
-std::array<float,2>{0.887091458f, 0.692234457f},
-std::array<float,2>{0.104249887f, 0.581722796f},
-std::array<float,2>{0.863217413f, 0.0871002898f},
-std::array<float,2>{0.463114142f, 0.367040187f},
-std::array<float,2>{0.697538376f, 0.809729993f},
-std::array<float,2>{0.396861345f, 0.645326853f},
-std::array<float,2>{0.64929378f, 0.247845694f},
-std::array<float,2>{0.00197947421f, 0.406364799f},
-std::array<float,2>{0.79771626f, 0.981399179f},
-std::array<float,2>{0.133111328f, 0.844001472f},
-std::array<float,2>{0.947089911f, 0.301059097f},
-std::array<float,2>{0.331152499f, 0.00490649929f},
-std::array<float,2>{0.506439626f, 0.51396656f},
-std::array<float,2>{0.488481045f, 0.766938567f},
-std::array<float,2>{0.740804493f, 0.328286827f},
-std::array<float,2>{0.0662291795f, 0.114018343f},
-std::array<float,2>{0.813969493f, 0.62455076f},
-std::array<float,2>{0.245460019f, 0.741382778f},
-std::array<float,2>{0.9186427f, 0.139367521f},
-std::array<float,2>{0.26042071f, 0.437772572f},
-std::array<float,2>{0.578909278f, 0.920419633f},
-std::array<float,2>{0.357510835f, 0.539088309f},
-std::array<float,2>{0.559662044f, 0.061801035f},
-std::array<float,2>{0.175522745f, 0.255194277f},
-std::array<float,2>{0.990902841f, 0.833807707f},
-std::array<float,2>{0.0325915404f, 0.946303725f},
-std::array<float,2>{0.753578901f, 0.401710868f},
-std::array<float,2>{0.418872446f, 0.21108976f},
-std::array<float,2>{0.670918703f, 0.667933524f},
-std::array<float,2>{0.251885682f, 0.79945302f},
-std::array<float,2>{0.588101804f, 0.369461298f},
-std::array<float,2>{0.236889929f, 0.0829432681f},
-std::array<float,2>{0.910427153f, 0.59165746f},
-std::array<float,2>{0.0728768259f, 0.69865334f},
-std::array<float,2>{0.823723197f, 0.181531072f},
-std::array<float,2>{0.494342625f, 0.493539304f},
-std::array<float,2>{0.746666849f, 0.89016813f},
-std::array<float,2>{0.408299834f, 0.506622314f},
-std::array<float,2>{0.657349885f, 0.0155064445f},
-std::array<float,2>{0.0441154763f, 0.306447268f},
-std::array<float,2>{0.758033812f, 0.852118134f},
-std::array<float,2>{0.181171462f, 0.974432886f},
-std::array<float,2>{0.995886445f, 0.416032553f},
-std::array<float,2>{0.350945503f, 0.236238137f},
-std::array<float,2>{0.549341023f, 0.65125376f},
-std::array<float,2>{0.455841899f, 0.908887804f},
-std::array<float,2>{0.687714517f, 0.446199715f},
-std::array<float,2>{0.0944218561f, 0.128778383f},
-std::array<float,2>{0.871323764f, 0.744004369f},
-std::array<float,2>{0.206516609f, 0.611130893f},
-std::array<float,2>{0.880252898f, 0.12096791f},
-std::array<float,2>{0.312209636f, 0.340975404f},
-std::array<float,2>{0.599436224f, 0.779897749f},
-std::array<float,2>{0.342514217f, 0.65708375f},
-std::array<float,2>{0.514858127f, 0.209820062f},
-std::array<float,2>{0.127793208f, 0.395077497f},
-std::array<float,2>{0.944210768f, 0.940385878f},
-std::array<float,2>{0.0111938976f, 0.841861546f},
-std::array<float,2>{0.806460321f, 0.261409998f},
-std::array<float,2>{0.402120441f, 0.0471216403f},
-std::array<float,2>{0.644585013f, 0.532091141f},
-std::array<float,2>{0.374008477f, 0.954470217f},
-std::array<float,2>{0.54390645f, 0.378853709f},
-std::array<float,2>{0.158426881f, 0.200322226f},
-std::array<float,2>{0.970070124f, 0.673609078f},
-std::array<float,2>{0.0525408834f, 0.558561862f},
-std::array<float,2>{0.769103348f, 0.0328783765f},
-std::array<float,2>{0.424484998f, 0.271146327f},
-std::array<float,2>{0.678410351f, 0.821754158f},
-std::array<float,2>{0.471918166f, 0.733176231f},
-std::array<float,2>{0.720946431f, 0.145239606f},
-std::array<float,2>{0.0916913748f, 0.458544701f},
-std::array<float,2>{0.840575278f, 0.924839556f},
-std::array<float,2>{0.223781914f, 0.75803113f},
-std::array<float,2>{0.929136157f, 0.320761919f},
-std::array<float,2>{0.277351797f, 0.0950989276f},
-std::array<float,2>{0.567997575f, 0.601579249f},
-std::array<float,2>{0.379877001f, 0.86956203f},
-std::array<float,2>{0.6286695f, 0.287609667f},
-std::array<float,2>{0.0253643114f, 0.0193338525f},
-std::array<float,2>{0.782738566f, 0.521807432f},
-std::array<float,2>{0.144332394f, 0.627733171f},
-std::array<float,2>{0.961069703f, 0.224101663f},
-std::array<float,2>{0.317633271f, 0.425681561f},
-std::array<float,2>{0.519042611f, 0.995017231f},
-std::array<float,2>{0.288339376f, 0.572184205f},
-std::array<float,2>{0.621821463f, 0.0780797079f},
-std::array<float,2>{0.201683789f, 0.346972018f},
-std::array<float,2>{0.896368384f, 0.784405053f},
-std::array<float,2>{0.118502051f, 0.898567557f},
-std::array<float,2>{0.855272591f, 0.476205438f},
-std::array<float,2>{0.450354964f, 0.171235487f},
-std::array<float,2>{0.703870177f, 0.715267837f},
-std::array<float,2>{0.295145571f, 0.858666539f},
-std::array<float,2>{0.612047374f, 0.310491472f},
-std::array<float,2>{0.193697304f, 0.00834739301f},
-std::array<float,2>{0.899294794f, 0.503573358f},
-std::array<float,2>{0.116277322f, 0.654541314f},
-std::array<float,2>{0.848870337f, 0.239440128f},
-std::array<float,2>{0.438968629f, 0.419066191f},
-std::array<float,2>{0.715192318f, 0.96920836f},
-std::array<float,2>{0.388769805f, 0.586556137f},
-std::array<float,2>{0.636021733f, 0.0798598751f},
-std::array<float,2>{0.0187076516f, 0.372849077f},
-std::array<float,2>{0.791904569f, 0.802008688f},
-std::array<float,2>{0.155829102f, 0.883005381f},
-std::array<float,2>{0.957351983f, 0.499482721f},
-std::array<float,2>{0.321355492f, 0.18473281f},
-std::array<float,2>{0.526125848f, 0.702647686f},
-std::array<float,2>{0.483938992f, 0.943822086f},
-std::array<float,2>{0.732838035f, 0.392654896f},
-std::array<float,2>{0.0791246518f, 0.204466864f},
-std::array<float,2>{0.834272861f, 0.660904765f},
-std::array<float,2>{0.226886764f, 0.53830266f},
-std::array<float,2>{0.930138826f, 0.0541537404f},
-std::array<float,2>{0.273163378f, 0.263916284f},
-std::array<float,2>{0.573689044f, 0.837426007f},
-std::array<float,2>{0.360220224f, 0.747852147f},
-std::array<float,2>{0.535081208f, 0.130937338f},
-std::array<float,2>{0.169110775f, 0.451924831f},
-std::array<float,2>{0.982437909f, 0.910592616f},
-std::array<float,2>{0.0622790344f, 0.774829209f},
-std::array<float,2>{0.777942955f, 0.337354064f},
-std::array<float,2>{0.432133287f, 0.124395378f},
-std::array<float,2>{0.686799943f, 0.616735518f},
-std::array<float,2>{0.333751589f, 0.927014649f},
-std::array<float,2>{0.50221324f, 0.456032395f},
-std::array<float,2>{0.139161691f, 0.14345625f},
-std::array<float,2>{0.951286852f, 0.727476418f},
-std::array<float,2>{0.00752785848f, 0.608717322f},
-std::array<float,2>{0.802336931f, 0.100408986f},
-std::array<float,2>{0.392767876f, 0.325123101f},
-std::array<float,2>{0.655313432f, 0.764998734f},
-std::array<float,2>{0.468513101f, 0.677857876f},
-std::array<float,2>{0.702927768f, 0.196396068f},
-std::array<float,2>{0.107154734f, 0.382682949f},
-std::array<float,2>{0.866129518f, 0.957287669f},
-std::array<float,2>{0.21660994f, 0.826734722f},
-std::array<float,2>{0.883426189f, 0.268762439f},
-std::array<float,2>{0.297945529f, 0.0352900736f},
-std::array<float,2>{0.601985633f, 0.561017454f},
-std::array<float,2>{0.414463758f, 0.7880463f},
-std::array<float,2>{0.667178988f, 0.350824267f},
-std::array<float,2>{0.0372669287f, 0.0737989023f},
-std::array<float,2>{0.757729352f, 0.576758623f},
-std::array<float,2>{0.179256827f, 0.714688897f},
-std::array<float,2>{0.987867653f, 0.165085912f},
-std::array<float,2>{0.35514155f, 0.471599132f},
-std::array<float,2>{0.558053613f, 0.905557334f},
-std::array<float,2>{0.264268309f, 0.515639424f},
-std::array<float,2>{0.585580766f, 0.0225904305f},
-std::array<float,2>{0.247713625f, 0.282087028f},
-std::array<float,2>{0.915108442f, 0.874453843f},
-std::array<float,2>{0.0686166286f, 0.996749818f},
-std::array<float,2>{0.819393516f, 0.427618474f},
-std::array<float,2>{0.485891193f, 0.219219849f},
-std::array<float,2>{0.734654367f, 0.632589996f},
-std::array<float,2>{0.346130043f, 0.755070627f},
-std::array<float,2>{0.551104367f, 0.313329071f},
-std::array<float,2>{0.187004209f, 0.107852727f},
-std::array<float,2>{0.997193456f, 0.593995512f},
-std::array<float,2>{0.0419403575f, 0.725405574f},
-std::array<float,2>{0.763115644f, 0.155046746f},
-std::array<float,2>{0.413885802f, 0.466562748f},
-std::array<float,2>{0.661546648f, 0.936246753f},
-std::array<float,2>{0.496506125f, 0.548389733f},
-std::array<float,2>{0.745449364f, 0.0432208367f},
-std::array<float,2>{0.0779929012f, 0.281085044f},
-std::array<float,2>{0.825439155f, 0.814097762f},
-std::array<float,2>{0.239378378f, 0.964947343f},
-std::array<float,2>{0.90958637f, 0.385389447f},
-std::array<float,2>{0.254725963f, 0.195092157f},
-std::array<float,2>{0.590616226f, 0.686709881f},
-std::array<float,2>{0.405187517f, 0.897510707f},
-std::array<float,2>{0.643189669f, 0.480526447f},
-std::array<float,2>{0.0131783038f, 0.158482358f},
-std::array<float,2>{0.810167193f, 0.706650019f},
-std::array<float,2>{0.129762203f, 0.566385448f},
-std::array<float,2>{0.939001083f, 0.0633583888f},
-std::array<float,2>{0.33946377f, 0.358783543f},
-std::array<float,2>{0.510678887f, 0.79050976f},
-std::array<float,2>{0.306405455f, 0.639820457f},
-std::array<float,2>{0.597332776f, 0.233440682f},
-std::array<float,2>{0.207630366f, 0.432713181f},
-std::array<float,2>{0.87802583f, 0.98573637f},
-std::array<float,2>{0.101409644f, 0.866876304f},
-std::array<float,2>{0.870159924f, 0.293805301f},
-std::array<float,2>{0.460845411f, 0.0284384433f},
-std::array<float,2>{0.691465437f, 0.528480887f},
-std::array<float,2>{0.274881005f, 0.97664386f},
-std::array<float,2>{0.563833177f, 0.411962658f},
-std::array<float,2>{0.21943827f, 0.245572805f},
-std::array<float,2>{0.922043562f, 0.640708566f},
-std::array<float,2>{0.08821477f, 0.508876562f},
-std::array<float,2>{0.837604642f, 0.00293901865f},
-std::array<float,2>{0.476373464f, 0.296967983f},
-std::array<float,2>{0.724478602f, 0.851239324f},
-std::array<float,2>{0.429628134f, 0.687605739f},
-std::array<float,2>{0.674498618f, 0.175387561f},
-std::array<float,2>{0.0480249636f, 0.487182915f},
-std::array<float,2>{0.770029604f, 0.878498077f},
-std::array<float,2>{0.163342491f, 0.807583094f},
-std::array<float,2>{0.974314213f, 0.362559706f},
-std::array<float,2>{0.369467497f, 0.0932564214f},
-std::array<float,2>{0.539670587f, 0.583240926f},
-std::array<float,2>{0.447558254f, 0.829816401f},
-std::array<float,2>{0.710212588f, 0.251174927f},
-std::array<float,2>{0.124911502f, 0.0580515712f},
-std::array<float,2>{0.855869651f, 0.544324279f},
-std::array<float,2>{0.198616236f, 0.670860171f},
-std::array<float,2>{0.891418815f, 0.217385396f},
-std::array<float,2>{0.282096744f, 0.406128675f},
-std::array<float,2>{0.620335817f, 0.950660348f},
-std::array<float,2>{0.31638968f, 0.619081974f},
-std::array<float,2>{0.522406638f, 0.11156673f},
-std::array<float,2>{0.148229405f, 0.334653437f},
-std::array<float,2>{0.966839194f, 0.772398889f},
-std::array<float,2>{0.0288754795f, 0.916186869f},
-std::array<float,2>{0.788267195f, 0.441530645f},
-std::array<float,2>{0.375033528f, 0.133324072f},
-std::array<float,2>{0.632302999f, 0.737913668f},
-std::array<float,2>{0.366123199f, 0.861235201f},
-std::array<float,2>{0.537971973f, 0.28991431f},
-std::array<float,2>{0.1664913f, 0.0257154703f},
-std::array<float,2>{0.980201483f, 0.525486887f},
-std::array<float,2>{0.0572930239f, 0.633971632f},
-std::array<float,2>{0.774698436f, 0.230413064f},
-std::array<float,2>{0.435442358f, 0.43364346f},
-std::array<float,2>{0.682805538f, 0.990696847f},
-std::array<float,2>{0.477624506f, 0.568515003f},
-std::array<float,2>{0.730414093f, 0.0676898435f},
-std::array<float,2>{0.0825560912f, 0.353409827f},
-std::array<float,2>{0.831387877f, 0.793390989f},
-std::array<float,2>{0.230531618f, 0.892956257f},
-std::array<float,2>{0.936015129f, 0.480148375f},
-std::array<float,2>{0.26676178f, 0.161243543f},
-std::array<float,2>{0.575564384f, 0.709516823f},
-std::array<float,2>{0.386321604f, 0.964654922f},
-std::array<float,2>{0.63832885f, 0.387338519f},
-std::array<float,2>{0.0197312385f, 0.190748394f},
-std::array<float,2>{0.793059289f, 0.68168819f},
-std::array<float,2>{0.148439139f, 0.553813457f},
-std::array<float,2>{0.956412792f, 0.0399028994f},
-std::array<float,2>{0.327211291f, 0.274626046f},
-std::array<float,2>{0.529381871f, 0.817023695f},
-std::array<float,2>{0.290226579f, 0.720958114f},
-std::array<float,2>{0.613405347f, 0.150176629f},
-std::array<float,2>{0.187516555f, 0.461078376f},
-std::array<float,2>{0.905036867f, 0.929943621f},
-std::array<float,2>{0.112202436f, 0.753096104f},
-std::array<float,2>{0.84706372f, 0.318549424f},
-std::array<float,2>{0.44393f, 0.103173211f},
-std::array<float,2>{0.713344157f, 0.598677874f},
-std::array<float,2>{0.258153647f, 0.918554485f},
-std::array<float,2>{0.580184162f, 0.440365434f},
-std::array<float,2>{0.243117228f, 0.13726604f},
-std::array<float,2>{0.920190454f, 0.739884853f},
-std::array<float,2>{0.0628669038f, 0.622504532f},
-std::array<float,2>{0.815358162f, 0.117150061f},
-std::array<float,2>{0.491176158f, 0.330549538f},
-std::array<float,2>{0.739876449f, 0.768571019f},
-std::array<float,2>{0.42119208f, 0.66583693f},
-std::array<float,2>{0.669012308f, 0.21290876f},
-std::array<float,2>{0.0344456546f, 0.398814857f},
-std::array<float,2>{0.751504183f, 0.948148966f},
-std::array<float,2>{0.172955349f, 0.834401309f},
-std::array<float,2>{0.988503456f, 0.25689593f},
-std::array<float,2>{0.355637312f, 0.0587191768f},
-std::array<float,2>{0.561073482f, 0.542077482f},
-std::array<float,2>{0.461005151f, 0.810930014f},
-std::array<float,2>{0.696907938f, 0.364659667f},
-std::array<float,2>{0.103104807f, 0.0889798403f},
-std::array<float,2>{0.859827161f, 0.578554213f},
-std::array<float,2>{0.21253328f, 0.694300771f},
-std::array<float,2>{0.890181303f, 0.176282823f},
-std::array<float,2>{0.303186297f, 0.490693927f},
-std::array<float,2>{0.606539667f, 0.882672369f},
-std::array<float,2>{0.329556584f, 0.512010872f},
-std::array<float,2>{0.504041195f, 0.00604880229f},
-std::array<float,2>{0.1352541f, 0.303732842f},
-std::array<float,2>{0.94873178f, 0.846831679f},
-std::array<float,2>{0.00177204015f, 0.982496202f},
-std::array<float,2>{0.799513757f, 0.408696026f},
-std::array<float,2>{0.394991606f, 0.249863222f},
-std::array<float,2>{0.650544941f, 0.647771478f},
-std::array<float,2>{0.309472501f, 0.778161824f},
-std::array<float,2>{0.600462615f, 0.343408912f},
-std::array<float,2>{0.203343555f, 0.117924504f},
-std::array<float,2>{0.881846905f, 0.613245726f},
-std::array<float,2>{0.095716469f, 0.745665252f},
-std::array<float,2>{0.874877453f, 0.125443488f},
-std::array<float,2>{0.454221159f, 0.447613627f},
-std::array<float,2>{0.691237569f, 0.906649828f},
-std::array<float,2>{0.400004596f, 0.533666193f},
-std::array<float,2>{0.648076534f, 0.0501909927f},
-std::array<float,2>{0.00832907483f, 0.259056062f},
-std::array<float,2>{0.807061553f, 0.84132719f},
-std::array<float,2>{0.125155687f, 0.939412355f},
-std::array<float,2>{0.941635013f, 0.398060828f},
-std::array<float,2>{0.341100216f, 0.207392812f},
-std::array<float,2>{0.512623131f, 0.659332395f},
-std::array<float,2>{0.49327442f, 0.887588561f},
-std::array<float,2>{0.748446286f, 0.494276315f},
-std::array<float,2>{0.0707749724f, 0.183508962f},
-std::array<float,2>{0.820597827f, 0.6956141f},
-std::array<float,2>{0.234908938f, 0.591937244f},
-std::array<float,2>{0.912828267f, 0.084475778f},
-std::array<float,2>{0.252829731f, 0.367482454f},
-std::array<float,2>{0.586160183f, 0.798044324f},
-std::array<float,2>{0.34932068f, 0.649906039f},
-std::array<float,2>{0.54720664f, 0.237822831f},
-std::array<float,2>{0.183574215f, 0.414398015f},
-std::array<float,2>{0.993466616f, 0.975635171f},
-std::array<float,2>{0.045793198f, 0.854309082f},
-std::array<float,2>{0.761589885f, 0.307453156f},
-std::array<float,2>{0.407061517f, 0.0123768486f},
-std::array<float,2>{0.659215927f, 0.50565815f},
-std::array<float,2>{0.318878442f, 0.994042516f},
-std::array<float,2>{0.516530812f, 0.423721462f},
-std::array<float,2>{0.141427875f, 0.225898877f},
-std::array<float,2>{0.963909328f, 0.626735449f},
-std::array<float,2>{0.0266862195f, 0.520486116f},
-std::array<float,2>{0.784582913f, 0.0170200262f},
-std::array<float,2>{0.382358223f, 0.286253601f},
-std::array<float,2>{0.625031531f, 0.868898511f},
-std::array<float,2>{0.453041613f, 0.717084706f},
-std::array<float,2>{0.705408394f, 0.168343887f},
-std::array<float,2>{0.12084654f, 0.473843485f},
-std::array<float,2>{0.852180421f, 0.901374102f},
-std::array<float,2>{0.199609175f, 0.782575786f},
-std::array<float,2>{0.897704422f, 0.344705969f},
-std::array<float,2>{0.286779851f, 0.0748234987f},
-std::array<float,2>{0.623358548f, 0.573827088f},
-std::array<float,2>{0.423101664f, 0.823959351f},
-std::array<float,2>{0.677318096f, 0.273063272f},
-std::array<float,2>{0.0531013943f, 0.0339652896f},
-std::array<float,2>{0.766551435f, 0.556610644f},
-std::array<float,2>{0.156921402f, 0.674179375f},
-std::array<float,2>{0.972336471f, 0.202799097f},
-std::array<float,2>{0.37160188f, 0.375153095f},
-std::array<float,2>{0.546855211f, 0.955752134f},
-std::array<float,2>{0.279629797f, 0.603737354f},
-std::array<float,2>{0.568678081f, 0.0966943353f},
-std::array<float,2>{0.226023346f, 0.323049158f},
-std::array<float,2>{0.927194893f, 0.760927141f},
-std::array<float,2>{0.092600435f, 0.922990799f},
-std::array<float,2>{0.842312396f, 0.459048897f},
-std::array<float,2>{0.469915986f, 0.147883371f},
-std::array<float,2>{0.7197963f, 0.732250094f},
-std::array<float,2>{0.271171391f, 0.838738501f},
-std::array<float,2>{0.57119751f, 0.263330191f},
-std::array<float,2>{0.228893667f, 0.0517283604f},
-std::array<float,2>{0.932258964f, 0.536565721f},
-std::array<float,2>{0.0813126042f, 0.662603259f},
-std::array<float,2>{0.833248138f, 0.206921846f},
-std::array<float,2>{0.48078984f, 0.392255634f},
-std::array<float,2>{0.73211664f, 0.942701161f},
-std::array<float,2>{0.429687858f, 0.61372751f},
-std::array<float,2>{0.684351325f, 0.12285009f},
-std::array<float,2>{0.0590647683f, 0.33922103f},
-std::array<float,2>{0.780201137f, 0.777002335f},
-std::array<float,2>{0.170621365f, 0.91297853f},
-std::array<float,2>{0.981582105f, 0.451170355f},
-std::array<float,2>{0.362488776f, 0.13021791f},
-std::array<float,2>{0.531910241f, 0.749112546f},
-std::array<float,2>{0.440391749f, 0.971089721f},
-std::array<float,2>{0.718079865f, 0.421253979f},
-std::array<float,2>{0.114072613f, 0.240532547f},
-std::array<float,2>{0.851323307f, 0.653524518f},
-std::array<float,2>{0.192451671f, 0.50118202f},
-std::array<float,2>{0.901111245f, 0.0108152982f},
-std::array<float,2>{0.294401437f, 0.312225938f},
-std::array<float,2>{0.611245632f, 0.855745673f},
-std::array<float,2>{0.322643816f, 0.699942946f},
-std::array<float,2>{0.525240719f, 0.187197939f},
-std::array<float,2>{0.152473211f, 0.497368515f},
-std::array<float,2>{0.959046185f, 0.885931373f},
-std::array<float,2>{0.0162696596f, 0.803613067f},
-std::array<float,2>{0.79070121f, 0.374213785f},
-std::array<float,2>{0.388139904f, 0.0809547305f},
-std::array<float,2>{0.634696007f, 0.588858783f},
-std::array<float,2>{0.352790147f, 0.9041453f},
-std::array<float,2>{0.556515872f, 0.468826771f},
-std::array<float,2>{0.1759817f, 0.166139305f},
-std::array<float,2>{0.984479725f, 0.712851822f},
-std::array<float,2>{0.0359766148f, 0.574581861f},
-std::array<float,2>{0.753912747f, 0.0712296218f},
-std::array<float,2>{0.417414039f, 0.349173635f},
-std::array<float,2>{0.665277541f, 0.785392225f},
-std::array<float,2>{0.487805784f, 0.628978968f},
-std::array<float,2>{0.737809777f, 0.221689031f},
-std::array<float,2>{0.0670792237f, 0.428495169f},
-std::array<float,2>{0.816508353f, 0.998928666f},
-std::array<float,2>{0.248895556f, 0.872168839f},
-std::array<float,2>{0.917117119f, 0.283533335f},
-std::array<float,2>{0.262137175f, 0.019708721f},
-std::array<float,2>{0.582750261f, 0.519253135f},
-std::array<float,2>{0.391088814f, 0.762115002f},
-std::array<float,2>{0.654173613f, 0.326948673f},
-std::array<float,2>{0.00569466501f, 0.0994475484f},
-std::array<float,2>{0.803782225f, 0.60717541f},
-std::array<float,2>{0.137047857f, 0.729845047f},
-std::array<float,2>{0.950357139f, 0.141343877f},
-std::array<float,2>{0.334063679f, 0.454607397f},
-std::array<float,2>{0.500538051f, 0.929539323f},
-std::array<float,2>{0.298936188f, 0.558638453f},
-std::array<float,2>{0.604155064f, 0.0378015153f},
-std::array<float,2>{0.217889562f, 0.266220063f},
-std::array<float,2>{0.885770619f, 0.826145172f},
-std::array<float,2>{0.109001994f, 0.959207833f},
-std::array<float,2>{0.863768935f, 0.380576074f},
-std::array<float,2>{0.465898991f, 0.197946355f},
-std::array<float,2>{0.700353444f, 0.677526534f},
-std::array<float,2>{0.336218536f, 0.791166663f},
-std::array<float,2>{0.509411991f, 0.355837435f},
-std::array<float,2>{0.132103279f, 0.0661244765f},
-std::array<float,2>{0.941169858f, 0.563282251f},
-std::array<float,2>{0.0146364532f, 0.704261601f},
-std::array<float,2>{0.81228435f, 0.158165514f},
-std::array<float,2>{0.402766377f, 0.483779281f},
-std::array<float,2>{0.641396523f, 0.895379424f},
-std::array<float,2>{0.457486391f, 0.530035198f},
-std::array<float,2>{0.693382263f, 0.0298147462f},
-std::array<float,2>{0.0983240232f, 0.296632797f},
-std::array<float,2>{0.868002236f, 0.864269495f},
-std::array<float,2>{0.209005833f, 0.987221062f},
-std::array<float,2>{0.875661671f, 0.43127951f},
-std::array<float,2>{0.307965159f, 0.231581539f},
-std::array<float,2>{0.593930721f, 0.638658285f},
-std::array<float,2>{0.411791831f, 0.934764087f},
-std::array<float,2>{0.662678003f, 0.468636811f},
-std::array<float,2>{0.0403404795f, 0.153040424f},
-std::array<float,2>{0.765348852f, 0.724386871f},
-std::array<float,2>{0.185221449f, 0.596739173f},
-std::array<float,2>{0.998580813f, 0.106504373f},
-std::array<float,2>{0.344622672f, 0.315857559f},
-std::array<float,2>{0.553822875f, 0.75595063f},
-std::array<float,2>{0.256139755f, 0.685006976f},
-std::array<float,2>{0.592133164f, 0.192222595f},
-std::array<float,2>{0.241318196f, 0.384285152f},
-std::array<float,2>{0.907170475f, 0.967973053f},
-std::array<float,2>{0.0752406418f, 0.815941989f},
-std::array<float,2>{0.82753247f, 0.278948992f},
-std::array<float,2>{0.499564409f, 0.04636769f},
-std::array<float,2>{0.743226826f, 0.550023377f},
-std::array<float,2>{0.283211052f, 0.952137172f},
-std::array<float,2>{0.617703795f, 0.404227346f},
-std::array<float,2>{0.19638513f, 0.215429544f},
-std::array<float,2>{0.892713189f, 0.669804931f},
-std::array<float,2>{0.121693127f, 0.545527875f},
-std::array<float,2>{0.858188331f, 0.0558628626f},
-std::array<float,2>{0.446307391f, 0.253655851f},
-std::array<float,2>{0.707230747f, 0.830924928f},
-std::array<float,2>{0.378691226f, 0.73628521f},
-std::array<float,2>{0.630227745f, 0.135344535f},
-std::array<float,2>{0.0305104814f, 0.445168555f},
-std::array<float,2>{0.786926448f, 0.915919781f},
-std::array<float,2>{0.145858884f, 0.770190895f},
-std::array<float,2>{0.966627598f, 0.332787067f},
-std::array<float,2>{0.312971473f, 0.109376095f},
-std::array<float,2>{0.521457851f, 0.619713664f},
-std::array<float,2>{0.472878098f, 0.849394739f},
-std::array<float,2>{0.725113094f, 0.299468011f},
-std::array<float,2>{0.086633198f, 0.0012192782f},
-std::array<float,2>{0.838920295f, 0.510718524f},
-std::array<float,2>{0.221546441f, 0.642962813f},
-std::array<float,2>{0.9246279f, 0.24274087f},
-std::array<float,2>{0.277323097f, 0.413549155f},
-std::array<float,2>{0.56637305f, 0.979626477f},
-std::array<float,2>{0.36747241f, 0.5846349f},
-std::array<float,2>{0.542675495f, 0.09043587f},
-std::array<float,2>{0.160685286f, 0.360819519f},
-std::array<float,2>{0.976516128f, 0.805898547f},
-std::array<float,2>{0.0498276837f, 0.875016987f},
-std::array<float,2>{0.77240783f, 0.485084325f},
-std::array<float,2>{0.425888002f, 0.17326948f},
-std::array<float,2>{0.673524678f, 0.689580977f},
-std::array<float,2>{0.356535137f, 0.832240462f},
-std::array<float,2>{0.562453926f, 0.254665881f},
-std::array<float,2>{0.172104016f, 0.0609028302f},
-std::array<float,2>{0.989685774f, 0.540156782f},
-std::array<float,2>{0.0341338813f, 0.666810989f},
-std::array<float,2>{0.750890195f, 0.212231949f},
-std::array<float,2>{0.420404464f, 0.40044412f},
-std::array<float,2>{0.668400526f, 0.945385337f},
-std::array<float,2>{0.492105335f, 0.623291969f},
-std::array<float,2>{0.73855108f, 0.114267342f},
-std::array<float,2>{0.063539587f, 0.329152822f},
-std::array<float,2>{0.815942526f, 0.765785813f},
-std::array<float,2>{0.24384512f, 0.920913517f},
-std::array<float,2>{0.920996249f, 0.438998818f},
-std::array<float,2>{0.259172559f, 0.140482381f},
-std::array<float,2>{0.581461847f, 0.740843594f},
-std::array<float,2>{0.395780206f, 0.982289791f},
-std::array<float,2>{0.651455998f, 0.407464206f},
-std::array<float,2>{0.000404563791f, 0.246182963f},
-std::array<float,2>{0.800656617f, 0.645960569f},
-std::array<float,2>{0.136629209f, 0.515331388f},
-std::array<float,2>{0.947453201f, 0.00474672252f},
-std::array<float,2>{0.328537107f, 0.302445233f},
-std::array<float,2>{0.505516469f, 0.844954073f},
-std::array<float,2>{0.304099262f, 0.692869782f},
-std::array<float,2>{0.605846047f, 0.17823711f},
-std::array<float,2>{0.211551502f, 0.489086926f},
-std::array<float,2>{0.888758063f, 0.879755497f},
-std::array<float,2>{0.101628765f, 0.808808863f},
-std::array<float,2>{0.860965431f, 0.366041303f},
-std::array<float,2>{0.462067515f, 0.0868084803f},
-std::array<float,2>{0.695585608f, 0.580163419f},
-std::array<float,2>{0.266600519f, 0.891091228f},
-std::array<float,2>{0.574615359f, 0.477500498f},
-std::array<float,2>{0.231572255f, 0.162260234f},
-std::array<float,2>{0.937057197f, 0.707272828f},
-std::array<float,2>{0.0834793672f, 0.568355083f},
-std::array<float,2>{0.83092761f, 0.0688328072f},
-std::array<float,2>{0.476815671f, 0.353824526f},
-std::array<float,2>{0.729423225f, 0.796446979f},
-std::array<float,2>{0.434087723f, 0.635931134f},
-std::array<float,2>{0.682159364f, 0.228105471f},
-std::array<float,2>{0.0580265187f, 0.43677184f},
-std::array<float,2>{0.773452878f, 0.988605499f},
-std::array<float,2>{0.167083919f, 0.861406684f},
-std::array<float,2>{0.979149222f, 0.292348802f},
-std::array<float,2>{0.366673619f, 0.0252761934f},
-std::array<float,2>{0.538687944f, 0.524852991f},
-std::array<float,2>{0.445178658f, 0.750626981f},
-std::array<float,2>{0.714482427f, 0.316888452f},
-std::array<float,2>{0.112621233f, 0.104676977f},
-std::array<float,2>{0.845942914f, 0.600260139f},
-std::array<float,2>{0.188763812f, 0.71888411f},
-std::array<float,2>{0.906167746f, 0.15222697f},
-std::array<float,2>{0.289200246f, 0.463056058f},
-std::array<float,2>{0.615060329f, 0.933362126f},
-std::array<float,2>{0.32672289f, 0.552458763f},
-std::array<float,2>{0.530973852f, 0.0426719636f},
-std::array<float,2>{0.149837032f, 0.275501728f},
-std::array<float,2>{0.955187678f, 0.818435013f},
-std::array<float,2>{0.0205602236f, 0.961866558f},
-std::array<float,2>{0.794728756f, 0.389603198f},
-std::array<float,2>{0.384987116f, 0.188720062f},
-std::array<float,2>{0.636894226f, 0.679691851f},
-std::array<float,2>{0.285301715f, 0.783774495f},
-std::array<float,2>{0.624055386f, 0.346671551f},
-std::array<float,2>{0.200216398f, 0.0765038803f},
-std::array<float,2>{0.896928847f, 0.570319831f},
-std::array<float,2>{0.119983308f, 0.716619432f},
-std::array<float,2>{0.853096545f, 0.169924319f},
-std::array<float,2>{0.451388597f, 0.475236595f},
-std::array<float,2>{0.706155658f, 0.900369406f},
-std::array<float,2>{0.381386667f, 0.522906482f},
-std::array<float,2>{0.626897037f, 0.017715076f},
-std::array<float,2>{0.0254807957f, 0.288941383f},
-std::array<float,2>{0.783524394f, 0.870247424f},
-std::array<float,2>{0.142333478f, 0.995397985f},
-std::array<float,2>{0.963088155f, 0.424305052f},
-std::array<float,2>{0.320144266f, 0.223475978f},
-std::array<float,2>{0.516977847f, 0.628546298f},
-std::array<float,2>{0.469465882f, 0.924544156f},
-std::array<float,2>{0.719051301f, 0.457133085f},
-std::array<float,2>{0.0930842012f, 0.146424606f},
-std::array<float,2>{0.843613207f, 0.733785808f},
-std::array<float,2>{0.225344479f, 0.603506088f},
-std::array<float,2>{0.926689565f, 0.0942865685f},
-std::array<float,2>{0.281115323f, 0.32215625f},
-std::array<float,2>{0.569947422f, 0.759482563f},
-std::array<float,2>{0.373028278f, 0.672229111f},
-std::array<float,2>{0.545349836f, 0.199877962f},
-std::array<float,2>{0.157701284f, 0.377775311f},
-std::array<float,2>{0.971616745f, 0.953930259f},
-std::array<float,2>{0.0539413914f, 0.820895612f},
-std::array<float,2>{0.766987324f, 0.269959599f},
-std::array<float,2>{0.422033548f, 0.032132078f},
-std::array<float,2>{0.676397264f, 0.5573861f},
-std::array<float,2>{0.340340555f, 0.9410097f},
-std::array<float,2>{0.513386846f, 0.395695925f},
-std::array<float,2>{0.126078904f, 0.210717455f},
-std::array<float,2>{0.942953825f, 0.657646656f},
-std::array<float,2>{0.00933743548f, 0.532769918f},
-std::array<float,2>{0.807641804f, 0.0483353175f},
-std::array<float,2>{0.398989975f, 0.259838551f},
-std::array<float,2>{0.646893084f, 0.843160868f},
-std::array<float,2>{0.453581989f, 0.74236834f},
-std::array<float,2>{0.690118492f, 0.127381876f},
-std::array<float,2>{0.0967223048f, 0.446375877f},
-std::array<float,2>{0.873999178f, 0.909541845f},
-std::array<float,2>{0.204878986f, 0.780704737f},
-std::array<float,2>{0.881208479f, 0.340002447f},
-std::array<float,2>{0.309985131f, 0.119907685f},
-std::array<float,2>{0.600797832f, 0.610158205f},
-std::array<float,2>{0.40724656f, 0.853314459f},
-std::array<float,2>{0.658341348f, 0.304786116f},
-std::array<float,2>{0.0463094339f, 0.0137166204f},
-std::array<float,2>{0.760740399f, 0.506918073f},
-std::array<float,2>{0.181917652f, 0.651426256f},
-std::array<float,2>{0.992751122f, 0.235324025f},
-std::array<float,2>{0.348592967f, 0.417373419f},
-std::array<float,2>{0.548416257f, 0.972815454f},
-std::array<float,2>{0.253127068f, 0.589902222f},
-std::array<float,2>{0.587719142f, 0.0831532627f},
-std::array<float,2>{0.235883787f, 0.370465249f},
-std::array<float,2>{0.913431108f, 0.800253153f},
-std::array<float,2>{0.0714620501f, 0.888998628f},
-std::array<float,2>{0.822172642f, 0.492473185f},
-std::array<float,2>{0.492721289f, 0.180165216f},
-std::array<float,2>{0.749802172f, 0.698186636f},
-std::array<float,2>{0.262768984f, 0.873634696f},
-std::array<float,2>{0.583241343f, 0.28234908f},
-std::array<float,2>{0.2499163f, 0.0222710799f},
-std::array<float,2>{0.916873395f, 0.517064512f},
-std::array<float,2>{0.0678825155f, 0.631682754f},
-std::array<float,2>{0.817692399f, 0.220260501f},
-std::array<float,2>{0.486413598f, 0.426095814f},
-std::array<float,2>{0.736440718f, 0.9976331f},
-std::array<float,2>{0.41609174f, 0.57748121f},
-std::array<float,2>{0.66411221f, 0.0727044046f},
-std::array<float,2>{0.0362694934f, 0.350256175f},
-std::array<float,2>{0.755198061f, 0.788997233f},
-std::array<float,2>{0.177720502f, 0.904609859f},
-std::array<float,2>{0.985941708f, 0.472027004f},
-std::array<float,2>{0.352095127f, 0.164075226f},
-std::array<float,2>{0.554779172f, 0.71323806f},
-std::array<float,2>{0.46490255f, 0.958850682f},
-std::array<float,2>{0.700040877f, 0.381357074f},
-std::array<float,2>{0.107457288f, 0.195751637f},
-std::array<float,2>{0.864921987f, 0.678911388f},
-std::array<float,2>{0.216812655f, 0.562330782f},
-std::array<float,2>{0.884936333f, 0.036157079f},
-std::array<float,2>{0.300753325f, 0.267923743f},
-std::array<float,2>{0.604633629f, 0.827566445f},
-std::array<float,2>{0.335542828f, 0.727710724f},
-std::array<float,2>{0.50186944f, 0.144484028f},
-std::array<float,2>{0.138648182f, 0.456126213f},
-std::array<float,2>{0.950141191f, 0.926137984f},
-std::array<float,2>{0.00486630015f, 0.76402694f},
-std::array<float,2>{0.802877724f, 0.325841784f},
-std::array<float,2>{0.392483145f, 0.10096027f},
-std::array<float,2>{0.65261662f, 0.60811013f},
-std::array<float,2>{0.362190753f, 0.911205173f},
-std::array<float,2>{0.53234005f, 0.452882975f},
-std::array<float,2>{0.171647847f, 0.132717088f},
-std::array<float,2>{0.981368184f, 0.747055471f},
-std::array<float,2>{0.0602161102f, 0.616061568f},
-std::array<float,2>{0.780872881f, 0.123831645f},
-std::array<float,2>{0.431352049f, 0.336616278f},
-std::array<float,2>{0.684706807f, 0.77379173f},
-std::array<float,2>{0.482371241f, 0.66174829f},
-std::array<float,2>{0.731433809f, 0.203689143f},
-std::array<float,2>{0.0805467591f, 0.394326687f},
-std::array<float,2>{0.832876682f, 0.944656372f},
-std::array<float,2>{0.230170652f, 0.835953176f},
-std::array<float,2>{0.932881355f, 0.265542299f},
-std::array<float,2>{0.270008385f, 0.053440094f},
-std::array<float,2>{0.571994781f, 0.537547886f},
-std::array<float,2>{0.386951089f, 0.800951302f},
-std::array<float,2>{0.633425176f, 0.371964961f},
-std::array<float,2>{0.0173602737f, 0.07900922f},
-std::array<float,2>{0.789369106f, 0.587766826f},
-std::array<float,2>{0.154094905f, 0.702005684f},
-std::array<float,2>{0.959978461f, 0.183856979f},
-std::array<float,2>{0.32325387f, 0.498197228f},
-std::array<float,2>{0.523647845f, 0.883824289f},
-std::array<float,2>{0.293235123f, 0.502007365f},
-std::array<float,2>{0.609716117f, 0.00921900943f},
-std::array<float,2>{0.191571027f, 0.308755368f},
-std::array<float,2>{0.90211761f, 0.857844353f},
-std::array<float,2>{0.114426188f, 0.970238447f},
-std::array<float,2>{0.850336909f, 0.418811828f},
-std::array<float,2>{0.440648973f, 0.238308176f},
-std::array<float,2>{0.717044115f, 0.656043589f},
-std::array<float,2>{0.31372872f, 0.772871673f},
-std::array<float,2>{0.519858658f, 0.335500956f},
-std::array<float,2>{0.145169199f, 0.113032185f},
-std::array<float,2>{0.965334773f, 0.617969692f},
-std::array<float,2>{0.0297450535f, 0.736647964f},
-std::array<float,2>{0.78580904f, 0.133924425f},
-std::array<float,2>{0.377528936f, 0.442552358f},
-std::array<float,2>{0.629509866f, 0.917324245f},
-std::array<float,2>{0.44542104f, 0.543349028f},
-std::array<float,2>{0.708165288f, 0.0569899306f},
-std::array<float,2>{0.122279294f, 0.250808269f},
-std::array<float,2>{0.858816862f, 0.828393161f},
-std::array<float,2>{0.195544705f, 0.949883699f},
-std::array<float,2>{0.894245028f, 0.404921293f},
-std::array<float,2>{0.285144806f, 0.218646884f},
-std::array<float,2>{0.618266106f, 0.671004295f},
-std::array<float,2>{0.426911116f, 0.87789309f},
-std::array<float,2>{0.672455966f, 0.487975001f},
-std::array<float,2>{0.0492209233f, 0.17400445f},
-std::array<float,2>{0.77294147f, 0.689328849f},
-std::array<float,2>{0.161542356f, 0.582294106f},
-std::array<float,2>{0.97478199f, 0.091935046f},
-std::array<float,2>{0.369049549f, 0.361770838f},
-std::array<float,2>{0.541732609f, 0.808143675f},
-std::array<float,2>{0.275625616f, 0.641754329f},
-std::array<float,2>{0.564493895f, 0.24487707f},
-std::array<float,2>{0.22234261f, 0.410810202f},
-std::array<float,2>{0.925435364f, 0.977640092f},
-std::array<float,2>{0.0874012336f, 0.850171685f},
-std::array<float,2>{0.837900877f, 0.29787913f},
-std::array<float,2>{0.474443227f, 0.00278520724f},
-std::array<float,2>{0.726315975f, 0.508242071f},
-std::array<float,2>{0.30758068f, 0.984692156f},
-std::array<float,2>{0.595192373f, 0.431733906f},
-std::array<float,2>{0.210411698f, 0.232696265f},
-std::array<float,2>{0.876434684f, 0.639395237f},
-std::array<float,2>{0.0989273489f, 0.528263807f},
-std::array<float,2>{0.868864119f, 0.0280988514f},
-std::array<float,2>{0.45879221f, 0.29456386f},
-std::array<float,2>{0.694678605f, 0.865462422f},
-std::array<float,2>{0.403699219f, 0.705417335f},
-std::array<float,2>{0.64226836f, 0.159956351f},
-std::array<float,2>{0.0147430608f, 0.481676012f},
-std::array<float,2>{0.811519563f, 0.896942556f},
-std::array<float,2>{0.131097034f, 0.789881885f},
-std::array<float,2>{0.939687967f, 0.357942253f},
-std::array<float,2>{0.337400198f, 0.0635816529f},
-std::array<float,2>{0.508367777f, 0.565093696f},
-std::array<float,2>{0.498963088f, 0.813000441f},
-std::array<float,2>{0.742520928f, 0.279617757f},
-std::array<float,2>{0.0748538151f, 0.044239983f},
-std::array<float,2>{0.826468289f, 0.54719758f},
-std::array<float,2>{0.240274534f, 0.686203063f},
-std::array<float,2>{0.907586634f, 0.193740845f},
-std::array<float,2>{0.257688463f, 0.38635993f},
-std::array<float,2>{0.593738794f, 0.96649009f},
-std::array<float,2>{0.345348001f, 0.59511739f},
-std::array<float,2>{0.553074598f, 0.109337993f},
-std::array<float,2>{0.183655739f, 0.314263433f},
-std::array<float,2>{0.999750078f, 0.754529119f},
-std::array<float,2>{0.0398617573f, 0.937451541f},
-std::array<float,2>{0.764587045f, 0.465298772f},
-std::array<float,2>{0.410785407f, 0.156149298f},
-std::array<float,2>{0.663435757f, 0.726070404f},
-std::array<float,2>{0.330563635f, 0.846578121f},
-std::array<float,2>{0.507052362f, 0.303287268f},
-std::array<float,2>{0.133996636f, 0.0070637553f},
-std::array<float,2>{0.945380926f, 0.513131678f},
-std::array<float,2>{0.00304920343f, 0.647231281f},
-std::array<float,2>{0.798648119f, 0.24898763f},
-std::array<float,2>{0.397699058f, 0.410135478f},
-std::array<float,2>{0.650252521f, 0.983704448f},
-std::array<float,2>{0.463890493f, 0.579157412f},
-std::array<float,2>{0.69890213f, 0.088329576f},
-std::array<float,2>{0.105350897f, 0.363826513f},
-std::array<float,2>{0.861644745f, 0.812229574f},
-std::array<float,2>{0.214675367f, 0.881632984f},
-std::array<float,2>{0.888097882f, 0.492059231f},
-std::array<float,2>{0.301156312f, 0.177251637f},
-std::array<float,2>{0.608647883f, 0.694448352f},
-std::array<float,2>{0.419591427f, 0.948904634f},
-std::array<float,2>{0.670798182f, 0.400036663f},
-std::array<float,2>{0.0317057595f, 0.214831352f},
-std::array<float,2>{0.752429903f, 0.664453208f},
-std::array<float,2>{0.17388235f, 0.54178226f},
-std::array<float,2>{0.991592467f, 0.0597615354f},
-std::array<float,2>{0.359243602f, 0.256483853f},
-std::array<float,2>{0.559303343f, 0.835475743f},
-std::array<float,2>{0.26148659f, 0.738494396f},
-std::array<float,2>{0.579505622f, 0.138411492f},
-std::array<float,2>{0.245085701f, 0.440901399f},
-std::array<float,2>{0.919187069f, 0.919905066f},
-std::array<float,2>{0.0651976988f, 0.767717063f},
-std::array<float,2>{0.812650502f, 0.331398517f},
-std::array<float,2>{0.489831179f, 0.115654729f},
-std::array<float,2>{0.741371512f, 0.621950805f},
-std::array<float,2>{0.292442143f, 0.931081057f},
-std::array<float,2>{0.616891265f, 0.462817639f},
-std::array<float,2>{0.190283194f, 0.14879562f},
-std::array<float,2>{0.903815269f, 0.722487271f},
-std::array<float,2>{0.111154571f, 0.598475277f},
-std::array<float,2>{0.8454445f, 0.101745024f},
-std::array<float,2>{0.441681713f, 0.319873869f},
-std::array<float,2>{0.711075366f, 0.752244234f},
-std::array<float,2>{0.383685142f, 0.682919383f},
-std::array<float,2>{0.639294744f, 0.189567521f},
-std::array<float,2>{0.0224099644f, 0.388581038f},
-std::array<float,2>{0.796428919f, 0.963308811f},
-std::array<float,2>{0.151954919f, 0.817907929f},
-std::array<float,2>{0.954899669f, 0.273579121f},
-std::array<float,2>{0.325852305f, 0.0404086187f},
-std::array<float,2>{0.527916968f, 0.552798152f},
-std::array<float,2>{0.480012745f, 0.794779003f},
-std::array<float,2>{0.72776407f, 0.351696104f},
-std::array<float,2>{0.0844928399f, 0.066858463f},
-std::array<float,2>{0.829330146f, 0.570065916f},
-std::array<float,2>{0.23316364f, 0.710097432f},
-std::array<float,2>{0.934963942f, 0.160740986f},
-std::array<float,2>{0.267927349f, 0.479257256f},
-std::array<float,2>{0.577152669f, 0.893747509f},
-std::array<float,2>{0.364522159f, 0.526713133f},
-std::array<float,2>{0.536975741f, 0.0268019158f},
-std::array<float,2>{0.165353686f, 0.290598422f},
-std::array<float,2>{0.977020442f, 0.860185146f},
-std::array<float,2>{0.055705063f, 0.991867602f},
-std::array<float,2>{0.776359677f, 0.43517971f},
-std::array<float,2>{0.436619312f, 0.229489252f},
-std::array<float,2>{0.68130213f, 0.632946432f},
-std::array<float,2>{0.278735012f, 0.760659337f},
-std::array<float,2>{0.566686273f, 0.323617369f},
-std::array<float,2>{0.22267814f, 0.0962768644f},
-std::array<float,2>{0.928272605f, 0.605268538f},
-std::array<float,2>{0.0901037976f, 0.731398284f},
-std::array<float,2>{0.841487765f, 0.146690056f},
-std::array<float,2>{0.470782191f, 0.460070342f},
-std::array<float,2>{0.722303212f, 0.92236042f},
-std::array<float,2>{0.425085276f, 0.555343509f},
-std::array<float,2>{0.679082394f, 0.0348195843f},
-std::array<float,2>{0.051308997f, 0.271860689f},
-std::array<float,2>{0.768068671f, 0.822593391f},
-std::array<float,2>{0.159197509f, 0.956911504f},
-std::array<float,2>{0.969297111f, 0.376302004f},
-std::array<float,2>{0.374088824f, 0.201988593f},
-std::array<float,2>{0.544370592f, 0.674810827f},
-std::array<float,2>{0.449266076f, 0.901277602f},
-std::array<float,2>{0.704319596f, 0.473311663f},
-std::array<float,2>{0.117540114f, 0.169165701f},
-std::array<float,2>{0.854373038f, 0.717930496f},
-std::array<float,2>{0.202607796f, 0.573110819f},
-std::array<float,2>{0.894553721f, 0.0757583454f},
-std::array<float,2>{0.287322879f, 0.345109642f},
-std::array<float,2>{0.622945487f, 0.781378448f},
-std::array<float,2>{0.317248762f, 0.625606596f},
-std::array<float,2>{0.51833725f, 0.225215197f},
-std::array<float,2>{0.142790899f, 0.422360867f},
-std::array<float,2>{0.962507308f, 0.993068993f},
-std::array<float,2>{0.0236087367f, 0.868130207f},
-std::array<float,2>{0.781368256f, 0.285330534f},
-std::array<float,2>{0.380645216f, 0.0158129763f},
-std::array<float,2>{0.627792776f, 0.521060109f},
-std::array<float,2>{0.349848956f, 0.974687219f},
-std::array<float,2>{0.550221443f, 0.415089726f},
-std::array<float,2>{0.180114627f, 0.236815304f},
-std::array<float,2>{0.994430184f, 0.648780942f},
-std::array<float,2>{0.0434077457f, 0.504390538f},
-std::array<float,2>{0.759711504f, 0.0131133189f},
-std::array<float,2>{0.409328312f, 0.308580577f},
-std::array<float,2>{0.657196045f, 0.855199397f},
-std::array<float,2>{0.495571226f, 0.696988404f},
-std::array<float,2>{0.747311711f, 0.181666136f},
-std::array<float,2>{0.0733520463f, 0.495918781f},
-std::array<float,2>{0.822489381f, 0.888097823f},
-std::array<float,2>{0.237667963f, 0.797815323f},
-std::array<float,2>{0.911525905f, 0.368678331f},
-std::array<float,2>{0.250793517f, 0.0858855024f},
-std::array<float,2>{0.589439094f, 0.59342134f},
-std::array<float,2>{0.400657117f, 0.840165436f},
-std::array<float,2>{0.645837069f, 0.258667558f},
-std::array<float,2>{0.0101745706f, 0.0488917716f},
-std::array<float,2>{0.804814994f, 0.53481108f},
-std::array<float,2>{0.128186032f, 0.658752859f},
-std::array<float,2>{0.944400072f, 0.208663046f},
-std::array<float,2>{0.343678534f, 0.396924317f},
-std::array<float,2>{0.51442945f, 0.938417554f},
-std::array<float,2>{0.311455667f, 0.611439586f},
-std::array<float,2>{0.598016143f, 0.118482716f},
-std::array<float,2>{0.205619931f, 0.342618853f},
-std::array<float,2>{0.879164994f, 0.778980255f},
-std::array<float,2>{0.0949668884f, 0.907401323f},
-std::array<float,2>{0.872800171f, 0.448829621f},
-std::array<float,2>{0.456341118f, 0.126199037f},
-std::array<float,2>{0.688701749f, 0.744934618f},
-std::array<float,2>{0.297022879f, 0.824816763f},
-std::array<float,2>{0.602637053f, 0.26749897f},
-std::array<float,2>{0.215797082f, 0.0381425321f},
-std::array<float,2>{0.884622157f, 0.560162187f},
-std::array<float,2>{0.105579361f, 0.676582992f},
-std::array<float,2>{0.866440952f, 0.198729515f},
-std::array<float,2>{0.467681944f, 0.379313886f},
-std::array<float,2>{0.701393425f, 0.960833251f},
-std::array<float,2>{0.394381016f, 0.605848968f},
-std::array<float,2>{0.654835522f, 0.0982498005f},
-std::array<float,2>{0.00605633482f, 0.327936172f},
-std::array<float,2>{0.801678717f, 0.762989044f},
-std::array<float,2>{0.139885664f, 0.928563654f},
-std::array<float,2>{0.952453971f, 0.453774691f},
-std::array<float,2>{0.332145959f, 0.142391518f},
-std::array<float,2>{0.503866434f, 0.729122043f},
-std::array<float,2>{0.484445274f, 0.999075592f},
-std::array<float,2>{0.735471487f, 0.428764045f},
-std::array<float,2>{0.0702421814f, 0.221184835f},
-std::array<float,2>{0.818509042f, 0.630665839f},
-std::array<float,2>{0.246321857f, 0.517878056f},
-std::array<float,2>{0.914419591f, 0.0210086368f},
-std::array<float,2>{0.2651999f, 0.284435213f},
-std::array<float,2>{0.584581494f, 0.871308208f},
-std::array<float,2>{0.353710324f, 0.71176362f},
-std::array<float,2>{0.557392776f, 0.167264938f},
-std::array<float,2>{0.178533703f, 0.470462203f},
-std::array<float,2>{0.98720032f, 0.903084576f},
-std::array<float,2>{0.0382263958f, 0.786250532f},
-std::array<float,2>{0.756356239f, 0.348455608f},
-std::array<float,2>{0.415711582f, 0.07147751f},
-std::array<float,2>{0.66623193f, 0.575788379f},
-std::array<float,2>{0.320536047f, 0.885327518f},
-std::array<float,2>{0.527267337f, 0.496894926f},
-std::array<float,2>{0.154627576f, 0.185785979f},
-std::array<float,2>{0.958714545f, 0.700249374f},
-std::array<float,2>{0.0184088461f, 0.589427471f},
-std::array<float,2>{0.792297959f, 0.081486918f},
-std::array<float,2>{0.389683038f, 0.373180836f},
-std::array<float,2>{0.635270536f, 0.804068506f},
-std::array<float,2>{0.437539399f, 0.65317899f},
-std::array<float,2>{0.716321647f, 0.241233975f},
-std::array<float,2>{0.115344703f, 0.420678496f},
-std::array<float,2>{0.848070025f, 0.971825838f},
-std::array<float,2>{0.195281431f, 0.857067883f},
-std::array<float,2>{0.899972975f, 0.310941428f},
-std::array<float,2>{0.296844602f, 0.0100648543f},
-std::array<float,2>{0.612890422f, 0.500258744f},
-std::array<float,2>{0.432973832f, 0.776189864f},
-std::array<float,2>{0.686400115f, 0.338701993f},
-std::array<float,2>{0.0607211813f, 0.121710531f},
-std::array<float,2>{0.779232919f, 0.615121841f},
-std::array<float,2>{0.168011442f, 0.748395145f},
-std::array<float,2>{0.984145224f, 0.129232049f},
-std::array<float,2>{0.360610843f, 0.450097769f},
-std::array<float,2>{0.533722341f, 0.913268805f},
-std::array<float,2>{0.271887034f, 0.535728395f},
-std::array<float,2>{0.572618663f, 0.0523402691f},
-std::array<float,2>{0.227731466f, 0.262253523f},
-std::array<float,2>{0.93115598f, 0.839460731f},
-std::array<float,2>{0.0783607438f, 0.942052901f},
-std::array<float,2>{0.835824966f, 0.391106457f},
-std::array<float,2>{0.483044714f, 0.205330074f},
-std::array<float,2>{0.734309971f, 0.663688123f},
-std::array<float,2>{0.370179951f, 0.805374503f},
-std::array<float,2>{0.540348709f, 0.360351294f},
-std::array<float,2>{0.162735805f, 0.0914977267f},
-std::array<float,2>{0.97335434f, 0.585779786f},
-std::array<float,2>{0.0469395779f, 0.691161335f},
-std::array<float,2>{0.771383405f, 0.172410727f},
-std::array<float,2>{0.428617895f, 0.485709935f},
-std::array<float,2>{0.675255597f, 0.876279831f},
-std::array<float,2>{0.475488991f, 0.511618614f},
-std::array<float,2>{0.722781718f, 0.000542204827f},
-std::array<float,2>{0.0896432325f, 0.300612301f},
-std::array<float,2>{0.836746097f, 0.848270416f},
-std::array<float,2>{0.219762623f, 0.979462743f},
-std::array<float,2>{0.923062682f, 0.412440479f},
-std::array<float,2>{0.273501277f, 0.24325344f},
-std::array<float,2>{0.562754095f, 0.644017816f},
-std::array<float,2>{0.376387537f, 0.914123178f},
-std::array<float,2>{0.630946577f, 0.444259673f},
-std::array<float,2>{0.0281787459f, 0.13598755f},
-std::array<float,2>{0.787327647f, 0.734577835f},
-std::array<float,2>{0.147278711f, 0.620461702f},
-std::array<float,2>{0.968297839f, 0.110841103f},
-std::array<float,2>{0.314665139f, 0.333806932f},
-std::array<float,2>{0.522639096f, 0.771181464f},
-std::array<float,2>{0.283086389f, 0.668429255f},
-std::array<float,2>{0.619617701f, 0.216274709f},
-std::array<float,2>{0.198158443f, 0.403263599f},
-std::array<float,2>{0.892013907f, 0.953120291f},
-std::array<float,2>{0.123511419f, 0.831642747f},
-std::array<float,2>{0.856781542f, 0.252846807f},
-std::array<float,2>{0.449203521f, 0.0551691763f},
-std::array<float,2>{0.709125996f, 0.545953989f},
-std::array<float,2>{0.254943609f, 0.967675567f},
-std::array<float,2>{0.590827942f, 0.382899433f},
-std::array<float,2>{0.238448709f, 0.193246022f},
-std::array<float,2>{0.908988059f, 0.683830261f},
-std::array<float,2>{0.07653936f, 0.54976368f},
-std::array<float,2>{0.825104535f, 0.0458737649f},
-std::array<float,2>{0.497241795f, 0.277709454f},
-std::array<float,2>{0.744309008f, 0.81465137f},
-std::array<float,2>{0.412740171f, 0.72315824f},
-std::array<float,2>{0.660588861f, 0.153989181f},
-std::array<float,2>{0.0422720797f, 0.467096567f},
-std::array<float,2>{0.762655556f, 0.933947682f},
-std::array<float,2>{0.185659602f, 0.757400811f},
-std::array<float,2>{0.996492207f, 0.315280944f},
-std::array<float,2>{0.347408533f, 0.106048957f},
-std::array<float,2>{0.551855922f, 0.595758319f},
-std::array<float,2>{0.459173054f, 0.863604188f},
-std::array<float,2>{0.692548335f, 0.295116454f},
-std::array<float,2>{0.1002995f, 0.0304814558f},
-std::array<float,2>{0.869974673f, 0.530836403f},
-std::array<float,2>{0.208190158f, 0.637430787f},
-std::array<float,2>{0.877429366f, 0.231203526f},
-std::array<float,2>{0.305218548f, 0.429900676f},
-std::array<float,2>{0.595708728f, 0.987459719f},
-std::array<float,2>{0.338823318f, 0.563663125f},
-std::array<float,2>{0.510983646f, 0.0646507889f},
-std::array<float,2>{0.130477116f, 0.356646121f},
-std::array<float,2>{0.93759197f, 0.792849839f},
-std::array<float,2>{0.012220161f, 0.896422863f},
-std::array<float,2>{0.809442997f, 0.482674539f},
-std::array<float,2>{0.406107575f, 0.156288087f},
-std::array<float,2>{0.64449352f, 0.703460157f},
-std::array<float,2>{0.315499693f, 0.828142762f},
-std::array<float,2>{0.521686256f, 0.250564665f},
-std::array<float,2>{0.147920802f, 0.0567321703f},
-std::array<float,2>{0.967494547f, 0.543158412f},
-std::array<float,2>{0.0285922438f, 0.671323121f},
-std::array<float,2>{0.788593352f, 0.218466356f},
-std::array<float,2>{0.375665665f, 0.405221224f},
-std::array<float,2>{0.632581472f, 0.95002985f},
-std::array<float,2>{0.447969377f, 0.617868543f},
-std::array<float,2>{0.710806847f, 0.113122784f},
-std::array<float,2>{0.124208763f, 0.335717082f},
-std::array<float,2>{0.856384277f, 0.772643685f},
-std::array<float,2>{0.199218452f, 0.917234421f},
-std::array<float,2>{0.89085412f, 0.442769885f},
-std::array<float,2>{0.28134492f, 0.134118453f},
-std::array<float,2>{0.620799839f, 0.736353874f},
-std::array<float,2>{0.428795546f, 0.977980256f},
-std::array<float,2>{0.673918843f, 0.411038429f},
-std::array<float,2>{0.0484398007f, 0.244686589f},
-std::array<float,2>{0.769816577f, 0.641965985f},
-std::array<float,2>{0.163819358f, 0.508035302f},
-std::array<float,2>{0.973663747f, 0.00261337426f},
-std::array<float,2>{0.369778484f, 0.298241287f},
-std::array<float,2>{0.539073348f, 0.850401998f},
-std::array<float,2>{0.274942964f, 0.689071178f},
-std::array<float,2>{0.564222157f, 0.174120113f},
-std::array<float,2>{0.219055042f, 0.488053203f},
-std::array<float,2>{0.922463655f, 0.877683997f},
-std::array<float,2>{0.0884909853f, 0.808536828f},
-std::array<float,2>{0.836929977f, 0.361434907f},
-std::array<float,2>{0.475743592f, 0.092125982f},
-std::array<float,2>{0.723696351f, 0.582098842f},
-std::array<float,2>{0.306073815f, 0.896703601f},
-std::array<float,2>{0.596920073f, 0.481726825f},
-std::array<float,2>{0.207431257f, 0.159718871f},
-std::array<float,2>{0.878771901f, 0.705308497f},
-std::array<float,2>{0.101056866f, 0.565272152f},
-std::array<float,2>{0.870611846f, 0.0639241859f},
-std::array<float,2>{0.46039626f, 0.358249187f},
-std::array<float,2>{0.691913188f, 0.789699376f},
-std::array<float,2>{0.404747397f, 0.639575064f},
-std::array<float,2>{0.643030286f, 0.23250854f},
-std::array<float,2>{0.0132473595f, 0.43193689f},
-std::array<float,2>{0.809960783f, 0.984376967f},
-std::array<float,2>{0.128941506f, 0.86549288f},
-std::array<float,2>{0.93875742f, 0.294884771f},
-std::array<float,2>{0.339192599f, 0.0278855637f},
-std::array<float,2>{0.510179639f, 0.528041899f},
-std::array<float,2>{0.496793509f, 0.754868269f},
-std::array<float,2>{0.745865226f, 0.314169079f},
-std::array<float,2>{0.0775332451f, 0.10890463f},
-std::array<float,2>{0.825844884f, 0.594728649f},
-std::array<float,2>{0.240133435f, 0.725621164f},
-std::array<float,2>{0.910094202f, 0.155869156f},
-std::array<float,2>{0.254268318f, 0.464915544f},
-std::array<float,2>{0.59006834f, 0.937255025f},
-std::array<float,2>{0.346646339f, 0.547011197f},
-std::array<float,2>{0.551375926f, 0.0440942608f},
-std::array<float,2>{0.187100172f, 0.279446989f},
-std::array<float,2>{0.997950256f, 0.813416362f},
-std::array<float,2>{0.041465681f, 0.966560185f},
-std::array<float,2>{0.763370752f, 0.386684746f},
-std::array<float,2>{0.413303524f, 0.193426684f},
-std::array<float,2>{0.662066817f, 0.686296761f},
-std::array<float,2>{0.263924778f, 0.788586318f},
-std::array<float,2>{0.585002482f, 0.350479305f},
-std::array<float,2>{0.2471793f, 0.0724598095f},
-std::array<float,2>{0.915899098f, 0.577358782f},
-std::array<float,2>{0.0691519901f, 0.712989092f},
-std::array<float,2>{0.819990337f, 0.164531261f},
-std::array<float,2>{0.485729307f, 0.47168833f},
-std::array<float,2>{0.735257983f, 0.904304147f},
-std::array<float,2>{0.414926916f, 0.516625881f},
-std::array<float,2>{0.667950451f, 0.0220178925f},
-std::array<float,2>{0.0380158871f, 0.28253302f},
-std::array<float,2>{0.75723958f, 0.873841703f},
-std::array<float,2>{0.179106683f, 0.997865558f},
-std::array<float,2>{0.987378538f, 0.425917774f},
-std::array<float,2>{0.354622871f, 0.220690459f},
-std::array<float,2>{0.558425009f, 0.631547511f},
-std::array<float,2>{0.468020588f, 0.925822258f},
-std::array<float,2>{0.702527463f, 0.456388861f},
-std::array<float,2>{0.106567726f, 0.144112274f},
-std::array<float,2>{0.865686178f, 0.727839172f},
-std::array<float,2>{0.216026545f, 0.608180821f},
-std::array<float,2>{0.882817447f, 0.100730129f},
-std::array<float,2>{0.298489839f, 0.325982511f},
-std::array<float,2>{0.60221386f, 0.763791323f},
-std::array<float,2>{0.333382487f, 0.67899102f},
-std::array<float,2>{0.502564669f, 0.195478648f},
-std::array<float,2>{0.139079973f, 0.381738335f},
-std::array<float,2>{0.951801777f, 0.958687127f},
-std::array<float,2>{0.00727377692f, 0.827286363f},
-std::array<float,2>{0.801897645f, 0.267685443f},
-std::array<float,2>{0.393180996f, 0.0364050269f},
-std::array<float,2>{0.656101346f, 0.56204015f},
-std::array<float,2>{0.359606922f, 0.944550991f},
-std::array<float,2>{0.534337997f, 0.394109428f},
-std::array<float,2>{0.169707894f, 0.203982875f},
-std::array<float,2>{0.983173549f, 0.661950946f},
-std::array<float,2>{0.0619307533f, 0.537161231f},
-std::array<float,2>{0.77748245f, 0.0536868274f},
-std::array<float,2>{0.431757003f, 0.265186012f},
-std::array<float,2>{0.687047362f, 0.836257517f},
-std::array<float,2>{0.483604461f, 0.746606469f},
-std::array<float,2>{0.733001292f, 0.132521316f},
-std::array<float,2>{0.080045782f, 0.452768058f},
-std::array<float,2>{0.83481127f, 0.91159153f},
-std::array<float,2>{0.227530569f, 0.773531556f},
-std::array<float,2>{0.930454016f, 0.336832404f},
-std::array<float,2>{0.272565961f, 0.123744398f},
-std::array<float,2>{0.573958457f, 0.615813196f},
-std::array<float,2>{0.389617592f, 0.85747838f},
-std::array<float,2>{0.636485934f, 0.309008926f},
-std::array<float,2>{0.0193095189f, 0.00885892939f},
-std::array<float,2>{0.791225433f, 0.502438903f},
-std::array<float,2>{0.155404538f, 0.655816376f},
-std::array<float,2>{0.95768249f, 0.238721833f},
-std::array<float,2>{0.32191959f, 0.418657213f},
-std::array<float,2>{0.525479496f, 0.970621765f},
-std::array<float,2>{0.295631349f, 0.587622404f},
-std::array<float,2>{0.611513853f, 0.0786770061f},
-std::array<float,2>{0.194200575f, 0.371824712f},
-std::array<float,2>{0.898703098f, 0.80108881f},
-std::array<float,2>{0.116757967f, 0.884199381f},
-std::array<float,2>{0.849388897f, 0.498303324f},
-std::array<float,2>{0.438496917f, 0.183731481f},
-std::array<float,2>{0.715393722f, 0.701667607f},
-std::array<float,2>{0.288616359f, 0.870449543f},
-std::array<float,2>{0.62137264f, 0.288785636f},
-std::array<float,2>{0.201418385f, 0.0178328045f},
-std::array<float,2>{0.895831943f, 0.522619247f},
-std::array<float,2>{0.118763015f, 0.628700376f},
-std::array<float,2>{0.854771852f, 0.223157108f},
-std::array<float,2>{0.450827152f, 0.42405054f},
-std::array<float,2>{0.7031762f, 0.995140731f},
-std::array<float,2>{0.379319072f, 0.570700824f},
-std::array<float,2>{0.628284216f, 0.076228261f},
-std::array<float,2>{0.0248417296f, 0.346323907f},
-std::array<float,2>{0.782533884f, 0.784053445f},
-std::array<float,2>{0.143678606f, 0.900090098f},
-std::array<float,2>{0.961710274f, 0.475372672f},
-std::array<float,2>{0.318348169f, 0.170389235f},
-std::array<float,2>{0.519203186f, 0.716411889f},
-std::array<float,2>{0.472535908f, 0.953676343f},
-std::array<float,2>{0.721350551f, 0.377603501f},
-std::array<float,2>{0.091076836f, 0.200036436f},
-std::array<float,2>{0.840192378f, 0.671885431f},
-std::array<float,2>{0.224210873f, 0.557256877f},
-std::array<float,2>{0.929403722f, 0.0319529325f},
-std::array<float,2>{0.278154582f, 0.269664288f},
-std::array<float,2>{0.567494988f, 0.821182668f},
-std::array<float,2>{0.373418599f, 0.733485699f},
-std::array<float,2>{0.543412626f, 0.146014363f},
-std::array<float,2>{0.158940464f, 0.457489848f},
-std::array<float,2>{0.970492184f, 0.924677134f},
-std::array<float,2>{0.052212324f, 0.759536743f},
-std::array<float,2>{0.768783987f, 0.321885049f},
-std::array<float,2>{0.424111843f, 0.0945402235f},
-std::array<float,2>{0.677964628f, 0.603134751f},
-std::array<float,2>{0.34220624f, 0.909218669f},
-std::array<float,2>{0.515274227f, 0.446752518f},
-std::array<float,2>{0.127044573f, 0.127102003f},
-std::array<float,2>{0.943373322f, 0.742439032f},
-std::array<float,2>{0.0115230782f, 0.610013068f},
-std::array<float,2>{0.805795312f, 0.119636342f},
-std::array<float,2>{0.401661783f, 0.340224266f},
-std::array<float,2>{0.645135045f, 0.780412972f},
-std::array<float,2>{0.455167711f, 0.657304823f},
-std::array<float,2>{0.688399255f, 0.210521743f},
-std::array<float,2>{0.0938834995f, 0.39591518f},
-std::array<float,2>{0.872012496f, 0.941280842f},
-std::array<float,2>{0.206884608f, 0.843009412f},
-std::array<float,2>{0.880703747f, 0.260215849f},
-std::array<float,2>{0.311794639f, 0.0480511375f},
-std::array<float,2>{0.598915756f, 0.533155322f},
-std::array<float,2>{0.408762366f, 0.800044417f},
-std::array<float,2>{0.657773852f, 0.37035948f},
-std::array<float,2>{0.0445422307f, 0.0832834095f},
-std::array<float,2>{0.758309245f, 0.590323985f},
-std::array<float,2>{0.181021586f, 0.697849691f},
-std::array<float,2>{0.995341897f, 0.179791912f},
-std::array<float,2>{0.351534933f, 0.49237138f},
-std::array<float,2>{0.548870027f, 0.888875663f},
-std::array<float,2>{0.251001269f, 0.507167518f},
-std::array<float,2>{0.588797331f, 0.0141045768f},
-std::array<float,2>{0.236601353f, 0.305167556f},
-std::array<float,2>{0.91082108f, 0.853222847f},
-std::array<float,2>{0.072632134f, 0.973139703f},
-std::array<float,2>{0.823939025f, 0.417131484f},
-std::array<float,2>{0.495004207f, 0.234886631f},
-std::array<float,2>{0.746252358f, 0.651739895f},
-std::array<float,2>{0.358131379f, 0.766088903f},
-std::array<float,2>{0.560477555f, 0.329407007f},
-std::array<float,2>{0.174878061f, 0.114576742f},
-std::array<float,2>{0.99065572f, 0.623224676f},
-std::array<float,2>{0.0329667628f, 0.740981698f},
-std::array<float,2>{0.75315702f, 0.140206963f},
-std::array<float,2>{0.418345213f, 0.439445734f},
-std::array<float,2>{0.671438694f, 0.921229899f},
-std::array<float,2>{0.488818645f, 0.540284455f},
-std::array<float,2>{0.740268886f, 0.0605635196f},
-std::array<float,2>{0.065589942f, 0.254604459f},
-std::array<float,2>{0.813705981f, 0.832324207f},
-std::array<float,2>{0.246012226f, 0.945563674f},
-std::array<float,2>{0.918370366f, 0.400823742f},
-std::array<float,2>{0.25983879f, 0.212138101f},
-std::array<float,2>{0.578417659f, 0.666697443f},
-std::array<float,2>{0.397159547f, 0.879591882f},
-std::array<float,2>{0.648767769f, 0.488927752f},
-std::array<float,2>{0.00264838059f, 0.178572163f},
-std::array<float,2>{0.797118664f, 0.692551672f},
-std::array<float,2>{0.133522391f, 0.580379546f},
-std::array<float,2>{0.946458578f, 0.0864323974f},
-std::array<float,2>{0.331995189f, 0.365856916f},
-std::array<float,2>{0.50586319f, 0.808930576f},
-std::array<float,2>{0.302504361f, 0.64565742f},
-std::array<float,2>{0.608326972f, 0.24640578f},
-std::array<float,2>{0.213386357f, 0.407662839f},
-std::array<float,2>{0.887293518f, 0.982128441f},
-std::array<float,2>{0.103824347f, 0.845054328f},
-std::array<float,2>{0.862355351f, 0.302625537f},
-std::array<float,2>{0.463751227f, 0.00463410793f},
-std::array<float,2>{0.698098123f, 0.515529633f},
-std::array<float,2>{0.268663406f, 0.988364875f},
-std::array<float,2>{0.576250732f, 0.436543107f},
-std::array<float,2>{0.23403798f, 0.228403822f},
-std::array<float,2>{0.933633387f, 0.636007011f},
-std::array<float,2>{0.0852869451f, 0.524435282f},
-std::array<float,2>{0.828992307f, 0.0249083135f},
-std::array<float,2>{0.478718966f, 0.292114228f},
-std::array<float,2>{0.726798773f, 0.861717105f},
-std::array<float,2>{0.436184049f, 0.707296669f},
-std::array<float,2>{0.680343032f, 0.162504509f},
-std::array<float,2>{0.055179093f, 0.477096885f},
-std::array<float,2>{0.777001202f, 0.890837073f},
-std::array<float,2>{0.164598629f, 0.796870053f},
-std::array<float,2>{0.978280187f, 0.353640825f},
-std::array<float,2>{0.36405772f, 0.0683714524f},
-std::array<float,2>{0.535178959f, 0.567886293f},
-std::array<float,2>{0.443024725f, 0.818826675f},
-std::array<float,2>{0.712630868f, 0.27583912f},
-std::array<float,2>{0.109633565f, 0.0428251997f},
-std::array<float,2>{0.844217896f, 0.552731454f},
-std::array<float,2>{0.190716535f, 0.680028141f},
-std::array<float,2>{0.902450442f, 0.188914463f},
-std::array<float,2>{0.291286916f, 0.389307886f},
-std::array<float,2>{0.616202593f, 0.961463332f},
-std::array<float,2>{0.325166166f, 0.600389719f},
-std::array<float,2>{0.529223263f, 0.10482017f},
-std::array<float,2>{0.150680915f, 0.316423059f},
-std::array<float,2>{0.953510046f, 0.750787258f},
-std::array<float,2>{0.0226054732f, 0.933158219f},
-std::array<float,2>{0.795540392f, 0.463287145f},
-std::array<float,2>{0.383827418f, 0.15207018f},
-std::array<float,2>{0.640286684f, 0.719227552f},
-std::array<float,2>{0.367848128f, 0.848393083f},
-std::array<float,2>{0.542025864f, 0.300294071f},
-std::array<float,2>{0.160417154f, 0.00079305307f},
-std::array<float,2>{0.975865841f, 0.511452198f},
-std::array<float,2>{0.0507354252f, 0.643794179f},
-std::array<float,2>{0.771841347f, 0.243504733f},
-std::array<float,2>{0.426718295f, 0.412223816f},
-std::array<float,2>{0.672992945f, 0.979091167f},
-std::array<float,2>{0.473374069f, 0.585674345f},
-std::array<float,2>{0.724866092f, 0.09174826f},
-std::array<float,2>{0.0861784816f, 0.359992445f},
-std::array<float,2>{0.83957088f, 0.805463791f},
-std::array<float,2>{0.220801741f, 0.876040339f},
-std::array<float,2>{0.923894227f, 0.485388517f},
-std::array<float,2>{0.276440263f, 0.172697246f},
-std::array<float,2>{0.56546545f, 0.691358685f},
-std::array<float,2>{0.37812373f, 0.952719212f},
-std::array<float,2>{0.630660772f, 0.402839303f},
-std::array<float,2>{0.0307845585f, 0.215882644f},
-std::array<float,2>{0.786189735f, 0.668203533f},
-std::array<float,2>{0.146221161f, 0.546170056f},
-std::array<float,2>{0.966165721f, 0.0548697151f},
-std::array<float,2>{0.313105881f, 0.252593875f},
-std::array<float,2>{0.520632148f, 0.83189261f},
-std::array<float,2>{0.283952594f, 0.734663248f},
-std::array<float,2>{0.617367923f, 0.135805905f},
-std::array<float,2>{0.197115406f, 0.444012463f},
-std::array<float,2>{0.893494785f, 0.914360404f},
-std::array<float,2>{0.121413201f, 0.771344841f},
-std::array<float,2>{0.857682407f, 0.333520383f},
-std::array<float,2>{0.446807235f, 0.111121364f},
-std::array<float,2>{0.707738698f, 0.620308161f},
-std::array<float,2>{0.25637722f, 0.93360728f},
-std::array<float,2>{0.592406571f, 0.466849655f},
-std::array<float,2>{0.241924822f, 0.154290274f},
-std::array<float,2>{0.906517029f, 0.72353512f},
-std::array<float,2>{0.0757222474f, 0.595996261f},
-std::array<float,2>{0.827821791f, 0.106338955f},
-std::array<float,2>{0.499104857f, 0.314959288f},
-std::array<float,2>{0.74388808f, 0.75780803f},
-std::array<float,2>{0.411267579f, 0.684081674f},
-std::array<float,2>{0.662112057f, 0.192990497f},
-std::array<float,2>{0.0405387729f, 0.383066148f},
-std::array<float,2>{0.76482141f, 0.967456162f},
-std::array<float,2>{0.184791103f, 0.814764738f},
-std::array<float,2>{0.998248696f, 0.277349621f},
-std::array<float,2>{0.343829423f, 0.0455425754f},
-std::array<float,2>{0.554433882f, 0.54949379f},
-std::array<float,2>{0.457541853f, 0.792608738f},
-std::array<float,2>{0.694261014f, 0.356856376f},
-std::array<float,2>{0.0978435427f, 0.0648696199f},
-std::array<float,2>{0.867383301f, 0.563833416f},
-std::array<float,2>{0.209858373f, 0.703142047f},
-std::array<float,2>{0.875093997f, 0.156523123f},
-std::array<float,2>{0.308539629f, 0.482496142f},
-std::array<float,2>{0.594636023f, 0.896029532f},
-std::array<float,2>{0.336911023f, 0.531118035f},
-std::array<float,2>{0.508889139f, 0.0306860171f},
-std::array<float,2>{0.132740915f, 0.29523319f},
-std::array<float,2>{0.940755785f, 0.863377631f},
-std::array<float,2>{0.0140562449f, 0.987671793f},
-std::array<float,2>{0.811624527f, 0.430127889f},
-std::array<float,2>{0.403299332f, 0.231083274f},
-std::array<float,2>{0.640777409f, 0.637658596f},
-std::array<float,2>{0.299759626f, 0.762778401f},
-std::array<float,2>{0.60387373f, 0.327656835f},
-std::array<float,2>{0.218352064f, 0.0984491929f},
-std::array<float,2>{0.886379778f, 0.605518937f},
-std::array<float,2>{0.108639404f, 0.729470491f},
-std::array<float,2>{0.863889217f, 0.142191678f},
-std::array<float,2>{0.466687232f, 0.453969419f},
-std::array<float,2>{0.700886667f, 0.928429842f},
-std::array<float,2>{0.391125888f, 0.560347199f},
-std::array<float,2>{0.653728008f, 0.0385035872f},
-std::array<float,2>{0.00504093384f, 0.267102778f},
-std::array<float,2>{0.804551363f, 0.825111806f},
-std::array<float,2>{0.137279928f, 0.960667968f},
-std::array<float,2>{0.950810432f, 0.378937513f},
-std::array<float,2>{0.334574044f, 0.198386505f},
-std::array<float,2>{0.500377536f, 0.676297545f},
-std::array<float,2>{0.487537712f, 0.902910531f},
-std::array<float,2>{0.737417996f, 0.470349669f},
-std::array<float,2>{0.0667742118f, 0.16714029f},
-std::array<float,2>{0.81695205f, 0.71152395f},
-std::array<float,2>{0.248282745f, 0.576004326f},
-std::array<float,2>{0.917708874f, 0.0715934858f},
-std::array<float,2>{0.262291729f, 0.348256618f},
-std::array<float,2>{0.582340062f, 0.786608577f},
-std::array<float,2>{0.353423595f, 0.630389631f},
-std::array<float,2>{0.555716634f, 0.22084856f},
-std::array<float,2>{0.176581591f, 0.429117233f},
-std::array<float,2>{0.984990895f, 0.999336004f},
-std::array<float,2>{0.0354047753f, 0.871543407f},
-std::array<float,2>{0.754775941f, 0.284246862f},
-std::array<float,2>{0.417650104f, 0.0213550404f},
-std::array<float,2>{0.665767014f, 0.517801225f},
-std::array<float,2>{0.32321623f, 0.972075284f},
-std::array<float,2>{0.524415851f, 0.420418978f},
-std::array<float,2>{0.152850196f, 0.241582498f},
-std::array<float,2>{0.959750712f, 0.6528458f},
-std::array<float,2>{0.0159430448f, 0.500068903f},
-std::array<float,2>{0.790217519f, 0.00987230428f},
-std::array<float,2>{0.388284683f, 0.31065467f},
-std::array<float,2>{0.633856475f, 0.857371211f},
-std::array<float,2>{0.439564675f, 0.700515747f},
-std::array<float,2>{0.71831727f, 0.185896993f},
-std::array<float,2>{0.11359334f, 0.496810168f},
-std::array<float,2>{0.850764811f, 0.885666728f},
-std::array<float,2>{0.193247333f, 0.803749561f},
-std::array<float,2>{0.900821805f, 0.373380214f},
-std::array<float,2>{0.294740438f, 0.0812896788f},
-std::array<float,2>{0.610480964f, 0.589820623f},
-std::array<float,2>{0.430641681f, 0.839647412f},
-std::array<float,2>{0.683814764f, 0.26246646f},
-std::array<float,2>{0.0593217686f, 0.0526309684f},
-std::array<float,2>{0.779538155f, 0.536056459f},
-std::array<float,2>{0.170356363f, 0.663894057f},
-std::array<float,2>{0.982362211f, 0.205212578f},
-std::array<float,2>{0.363150209f, 0.390819997f},
-std::array<float,2>{0.531497717f, 0.942324519f},
-std::array<float,2>{0.2709741f, 0.614785135f},
-std::array<float,2>{0.570361435f, 0.12203598f},
-std::array<float,2>{0.229089543f, 0.338558376f},
-std::array<float,2>{0.93190068f, 0.77595216f},
-std::array<float,2>{0.0815492496f, 0.913451195f},
-std::array<float,2>{0.833904624f, 0.449884355f},
-std::array<float,2>{0.48096177f, 0.129099682f},
-std::array<float,2>{0.731657505f, 0.748200238f},
-std::array<float,2>{0.280251443f, 0.822272122f},
-std::array<float,2>{0.56891489f, 0.271540225f},
-std::array<float,2>{0.226394996f, 0.0350556783f},
-std::array<float,2>{0.927507997f, 0.555425525f},
-std::array<float,2>{0.0920972079f, 0.675289094f},
-std::array<float,2>{0.842057526f, 0.201825917f},
-std::array<float,2>{0.470239311f, 0.376148224f},
-std::array<float,2>{0.720585287f, 0.956689477f},
-std::array<float,2>{0.423648387f, 0.605043948f},
-std::array<float,2>{0.676942945f, 0.0966750458f},
-std::array<float,2>{0.0536427274f, 0.323448002f},
-std::array<float,2>{0.766093254f, 0.760458469f},
-std::array<float,2>{0.156400293f, 0.922118068f},
-std::array<float,2>{0.971981406f, 0.460312635f},
-std::array<float,2>{0.37143445f, 0.14694494f},
-std::array<float,2>{0.546366334f, 0.731135368f},
-std::array<float,2>{0.452629358f, 0.992760241f},
-std::array<float,2>{0.705780149f, 0.421986014f},
-std::array<float,2>{0.120270342f, 0.225437716f},
-std::array<float,2>{0.85179317f, 0.625805378f},
-std::array<float,2>{0.199852556f, 0.521398962f},
-std::array<float,2>{0.898207247f, 0.0161056574f},
-std::array<float,2>{0.286156267f, 0.285572588f},
-std::array<float,2>{0.623621762f, 0.867768943f},
-std::array<float,2>{0.31860736f, 0.718195975f},
-std::array<float,2>{0.515997231f, 0.169272691f},
-std::array<float,2>{0.140893027f, 0.473389f},
-std::array<float,2>{0.96464622f, 0.901012301f},
-std::array<float,2>{0.0270284973f, 0.781507254f},
-std::array<float,2>{0.784817159f, 0.344844937f},
-std::array<float,2>{0.382187426f, 0.0759847239f},
-std::array<float,2>{0.62567997f, 0.572917402f},
-std::array<float,2>{0.348875761f, 0.887835205f},
-std::array<float,2>{0.547610521f, 0.495783567f},
-std::array<float,2>{0.18276909f, 0.182112843f},
-std::array<float,2>{0.993957758f, 0.697202325f},
-std::array<float,2>{0.0450837798f, 0.59358871f},
-std::array<float,2>{0.760999322f, 0.0856747478f},
-std::array<float,2>{0.406514972f, 0.36903441f},
-std::array<float,2>{0.659802973f, 0.797368824f},
-std::array<float,2>{0.494041741f, 0.64853996f},
-std::array<float,2>{0.748718381f, 0.236559451f},
-std::array<float,2>{0.0712662861f, 0.415351033f},
-std::array<float,2>{0.82105267f, 0.974999011f},
-std::array<float,2>{0.234399214f, 0.855370283f},
-std::array<float,2>{0.912257075f, 0.308250338f},
-std::array<float,2>{0.252268642f, 0.0128980931f},
-std::array<float,2>{0.5866611f, 0.504016757f},
-std::array<float,2>{0.399748653f, 0.779084921f},
-std::array<float,2>{0.647737265f, 0.342310309f},
-std::array<float,2>{0.00793785602f, 0.118205555f},
-std::array<float,2>{0.807567537f, 0.611596584f},
-std::array<float,2>{0.125852928f, 0.744819283f},
-std::array<float,2>{0.942341626f, 0.12629883f},
-std::array<float,2>{0.34169811f, 0.449103415f},
-std::array<float,2>{0.511898756f, 0.907634437f},
-std::array<float,2>{0.308677673f, 0.535043418f},
-std::array<float,2>{0.600017488f, 0.0492568836f},
-std::array<float,2>{0.203856796f, 0.258505464f},
-std::array<float,2>{0.882776916f, 0.840081394f},
-std::array<float,2>{0.0962575302f, 0.938143611f},
-std::array<float,2>{0.874100924f, 0.396624804f},
-std::array<float,2>{0.454856902f, 0.2089656f},
-std::array<float,2>{0.69081068f, 0.659024715f},
-std::array<float,2>{0.329744399f, 0.812400818f},
-std::array<float,2>{0.504724443f, 0.364105284f},
-std::array<float,2>{0.135137409f, 0.0880745575f},
-std::array<float,2>{0.948258519f, 0.579466701f},
-std::array<float,2>{0.00143167027f, 0.694766939f},
-std::array<float,2>{0.799275041f, 0.177550003f},
-std::array<float,2>{0.395276934f, 0.491879016f},
-std::array<float,2>{0.65117687f, 0.881373346f},
-std::array<float,2>{0.461757034f, 0.512818038f},
-std::array<float,2>{0.696446836f, 0.00731935538f},
-std::array<float,2>{0.102607459f, 0.303503126f},
-std::array<float,2>{0.859907031f, 0.846385539f},
-std::array<float,2>{0.212180242f, 0.98362875f},
-std::array<float,2>{0.889772832f, 0.409689724f},
-std::array<float,2>{0.303393006f, 0.248630106f},
-std::array<float,2>{0.607074559f, 0.647127628f},
-std::array<float,2>{0.421547264f, 0.919489622f},
-std::array<float,2>{0.669534683f, 0.440462321f},
-std::array<float,2>{0.0348108187f, 0.138622597f},
-std::array<float,2>{0.751047969f, 0.738759637f},
-std::array<float,2>{0.173450798f, 0.621628165f},
-std::array<float,2>{0.989021182f, 0.115465969f},
-std::array<float,2>{0.356038958f, 0.331184894f},
-std::array<float,2>{0.561013877f, 0.767943263f},
-std::array<float,2>{0.258514285f, 0.664306283f},
-std::array<float,2>{0.580752015f, 0.214543f},
-std::array<float,2>{0.242588192f, 0.400188863f},
-std::array<float,2>{0.920839131f, 0.94921875f},
-std::array<float,2>{0.0630399287f, 0.835908651f},
-std::array<float,2>{0.814883769f, 0.256800145f},
-std::array<float,2>{0.490341455f, 0.0600392856f},
-std::array<float,2>{0.73938489f, 0.541711867f},
-std::array<float,2>{0.290966272f, 0.962919891f},
-std::array<float,2>{0.613839507f, 0.388263106f},
-std::array<float,2>{0.188332781f, 0.189739004f},
-std::array<float,2>{0.904628575f, 0.682725966f},
-std::array<float,2>{0.11161238f, 0.553108811f},
-std::array<float,2>{0.847273648f, 0.0402766764f},
-std::array<float,2>{0.443733275f, 0.273750812f},
-std::array<float,2>{0.713395417f, 0.818134367f},
-std::array<float,2>{0.385936439f, 0.722253203f},
-std::array<float,2>{0.637905777f, 0.148623675f},
-std::array<float,2>{0.0201194547f, 0.462607533f},
-std::array<float,2>{0.793574154f, 0.930784166f},
-std::array<float,2>{0.149386838f, 0.752011478f},
-std::array<float,2>{0.956661165f, 0.32028228f},
-std::array<float,2>{0.328015745f, 0.101897724f},
-std::array<float,2>{0.529793322f, 0.598388433f},
-std::array<float,2>{0.478242397f, 0.859961987f},
-std::array<float,2>{0.729783654f, 0.290949345f},
-std::array<float,2>{0.0823091939f, 0.0264342539f},
-std::array<float,2>{0.831844628f, 0.526372313f},
-std::array<float,2>{0.230973631f, 0.633276403f},
-std::array<float,2>{0.936407745f, 0.229106307f},
-std::array<float,2>{0.267325342f, 0.435461044f},
-std::array<float,2>{0.575965106f, 0.992080331f},
-std::array<float,2>{0.36527276f, 0.570290744f},
-std::array<float,2>{0.537520945f, 0.0664185509f},
-std::array<float,2>{0.166783184f, 0.351871163f},
-std::array<float,2>{0.979503751f, 0.794643939f},
-std::array<float,2>{0.0567157939f, 0.893889487f},
-std::array<float,2>{0.775344849f, 0.479227781f},
-std::array<float,2>{0.434895635f, 0.160936236f},
-std::array<float,2>{0.6833902f, 0.710232377f},
-std::array<float,2>{0.344778955f, 0.814343691f},
-std::array<float,2>{0.55345124f, 0.280854613f},
-std::array<float,2>{0.184353307f, 0.0429717265f},
-std::array<float,2>{0.999328196f, 0.548629105f},
-std::array<float,2>{0.0392134152f, 0.68686074f},
-std::array<float,2>{0.764089823f, 0.194954917f},
-std::array<float,2>{0.410344392f, 0.38560769f},
-std::array<float,2>{0.664036155f, 0.965130508f},
-std::array<float,2>{0.498254716f, 0.593755722f},
-std::array<float,2>{0.743069589f, 0.107643723f},
-std::array<float,2>{0.0743744746f, 0.313017815f},
-std::array<float,2>{0.826736867f, 0.755254388f},
-std::array<float,2>{0.241121367f, 0.93628937f},
-std::array<float,2>{0.907793999f, 0.466516018f},
-std::array<float,2>{0.256994277f, 0.154974952f},
-std::array<float,2>{0.592890084f, 0.725289047f},
-std::array<float,2>{0.404007256f, 0.985542119f},
-std::array<float,2>{0.641813099f, 0.433036745f},
-std::array<float,2>{0.015583029f, 0.23371318f},
-std::array<float,2>{0.81080538f, 0.639946461f},
-std::array<float,2>{0.131678239f, 0.528806746f},
-std::array<float,2>{0.940007031f, 0.0285865776f},
-std::array<float,2>{0.337460339f, 0.293613434f},
-std::array<float,2>{0.508212209f, 0.867110908f},
-std::array<float,2>{0.306652755f, 0.706847131f},
-std::array<float,2>{0.595341265f, 0.158226162f},
-std::array<float,2>{0.210679144f, 0.480750382f},
-std::array<float,2>{0.876531184f, 0.897824585f},
-std::array<float,2>{0.0991333202f, 0.79012531f},
-std::array<float,2>{0.868353903f, 0.358472794f},
-std::array<float,2>{0.458116889f, 0.0631204173f},
-std::array<float,2>{0.695133865f, 0.566134751f},
-std::array<float,2>{0.275886625f, 0.878673732f},
-std::array<float,2>{0.565235019f, 0.48687917f},
-std::array<float,2>{0.221779078f, 0.175756857f},
-std::array<float,2>{0.925126851f, 0.687918901f},
-std::array<float,2>{0.0875590146f, 0.583269954f},
-std::array<float,2>{0.838495731f, 0.0927842706f},
-std::array<float,2>{0.47397393f, 0.36238417f},
-std::array<float,2>{0.725867093f, 0.807317555f},
-std::array<float,2>{0.427438438f, 0.641077936f},
-std::array<float,2>{0.672282517f, 0.245292634f},
-std::array<float,2>{0.0497497991f, 0.41180864f},
-std::array<float,2>{0.77328229f, 0.976941228f},
-std::array<float,2>{0.161659539f, 0.851321518f},
-std::array<float,2>{0.975392997f, 0.297304392f},
-std::array<float,2>{0.368507266f, 0.0032726049f},
-std::array<float,2>{0.541442633f, 0.5091663f},
-std::array<float,2>{0.44615218f, 0.771981835f},
-std::array<float,2>{0.70850873f, 0.334725708f},
-std::array<float,2>{0.122922294f, 0.111633532f},
-std::array<float,2>{0.858980656f, 0.618745863f},
-std::array<float,2>{0.196268708f, 0.738127351f},
-std::array<float,2>{0.893901765f, 0.133715332f},
-std::array<float,2>{0.284404635f, 0.44171074f},
-std::array<float,2>{0.618948162f, 0.916481256f},
-std::array<float,2>{0.314435571f, 0.544132352f},
-std::array<float,2>{0.520201683f, 0.0578200184f},
-std::array<float,2>{0.144597024f, 0.25135681f},
-std::array<float,2>{0.965044081f, 0.829919457f},
-std::array<float,2>{0.0298242103f, 0.950394809f},
-std::array<float,2>{0.785343051f, 0.405974627f},
-std::array<float,2>{0.377095491f, 0.217682466f},
-std::array<float,2>{0.629208624f, 0.670495629f},
-std::array<float,2>{0.293488562f, 0.801909328f},
-std::array<float,2>{0.610290825f, 0.372601599f},
-std::array<float,2>{0.192010656f, 0.0796137229f},
-std::array<float,2>{0.901760161f, 0.58679539f},
-std::array<float,2>{0.11520949f, 0.702998519f},
-std::array<float,2>{0.84965688f, 0.184918627f},
-std::array<float,2>{0.440991193f, 0.499157697f},
-std::array<float,2>{0.71762675f, 0.883224905f},
-std::array<float,2>{0.387634546f, 0.503795326f},
-std::array<float,2>{0.632826328f, 0.00874319673f},
-std::array<float,2>{0.0169003028f, 0.310238659f},
-std::array<float,2>{0.789730549f, 0.85843873f},
-std::array<float,2>{0.153507471f, 0.968838692f},
-std::array<float,2>{0.960464478f, 0.41929552f},
-std::array<float,2>{0.323991448f, 0.239532411f},
-std::array<float,2>{0.524092555f, 0.654385805f},
-std::array<float,2>{0.481926084f, 0.910356045f},
-std::array<float,2>{0.730885327f, 0.451832235f},
-std::array<float,2>{0.081028752f, 0.131338298f},
-std::array<float,2>{0.832180738f, 0.747755289f},
-std::array<float,2>{0.229735687f, 0.617079794f},
-std::array<float,2>{0.933379531f, 0.124059744f},
-std::array<float,2>{0.270204544f, 0.337038189f},
-std::array<float,2>{0.571758389f, 0.774504781f},
-std::array<float,2>{0.361656338f, 0.660660505f},
-std::array<float,2>{0.533050179f, 0.204172775f},
-std::array<float,2>{0.171267301f, 0.393064797f},
-std::array<float,2>{0.980638981f, 0.943361282f},
-std::array<float,2>{0.0598143898f, 0.837846339f},
-std::array<float,2>{0.78034544f, 0.263756782f},
-std::array<float,2>{0.430765688f, 0.0538267158f},
-std::array<float,2>{0.685297668f, 0.538384199f},
-std::array<float,2>{0.335196793f, 0.95706898f},
-std::array<float,2>{0.501332641f, 0.382329166f},
-std::array<float,2>{0.137716025f, 0.196589842f},
-std::array<float,2>{0.949654698f, 0.678178847f},
-std::array<float,2>{0.00434400467f, 0.560576975f},
-std::array<float,2>{0.8033517f, 0.0355315693f},
-std::array<float,2>{0.391762495f, 0.268871218f},
-std::array<float,2>{0.653226554f, 0.827104807f},
-std::array<float,2>{0.465404063f, 0.727123141f},
-std::array<float,2>{0.699352264f, 0.143178985f},
-std::array<float,2>{0.108057566f, 0.455797046f},
-std::array<float,2>{0.864486635f, 0.926823437f},
-std::array<float,2>{0.217451036f, 0.764803469f},
-std::array<float,2>{0.885387003f, 0.324799895f},
-std::array<float,2>{0.29987973f, 0.100262828f},
-std::array<float,2>{0.605294049f, 0.608410537f},
-std::array<float,2>{0.416521698f, 0.874219656f},
-std::array<float,2>{0.664938211f, 0.281869054f},
-std::array<float,2>{0.0366942436f, 0.0228960551f},
-std::array<float,2>{0.755748332f, 0.515915811f},
-std::array<float,2>{0.177101552f, 0.632560134f},
-std::array<float,2>{0.985554814f, 0.218763605f},
-std::array<float,2>{0.351963907f, 0.427375615f},
-std::array<float,2>{0.555429935f, 0.996868849f},
-std::array<float,2>{0.263507485f, 0.577063918f},
-std::array<float,2>{0.583675981f, 0.074139744f},
-std::array<float,2>{0.249129638f, 0.351008385f},
-std::array<float,2>{0.916458428f, 0.787628591f},
-std::array<float,2>{0.0675503761f, 0.905369282f},
-std::array<float,2>{0.81801033f, 0.471284509f},
-std::array<float,2>{0.48706764f, 0.16538617f},
-std::array<float,2>{0.737198591f, 0.714592159f},
-std::array<float,2>{0.253884703f, 0.852318943f},
-std::array<float,2>{0.587149978f, 0.306387931f},
-std::array<float,2>{0.235837623f, 0.0152489468f},
-std::array<float,2>{0.913931191f, 0.506546438f},
-std::array<float,2>{0.0719142556f, 0.651122272f},
-std::array<float,2>{0.821443915f, 0.235910714f},
-std::array<float,2>{0.492384642f, 0.416374594f},
-std::array<float,2>{0.749159038f, 0.974227548f},
-std::array<float,2>{0.407786459f, 0.591363728f},
-std::array<float,2>{0.65871352f, 0.0827332586f},
-std::array<float,2>{0.0467627868f, 0.369257599f},
-std::array<float,2>{0.75995326f, 0.79971081f},
-std::array<float,2>{0.182559028f, 0.890608013f},
-std::array<float,2>{0.992644787f, 0.493245482f},
-std::array<float,2>{0.347881138f, 0.181298524f},
-std::array<float,2>{0.547952652f, 0.69838351f},
-std::array<float,2>{0.453782529f, 0.94008112f},
-std::array<float,2>{0.689769149f, 0.395498842f},
-std::array<float,2>{0.0974172652f, 0.209565938f},
-std::array<float,2>{0.873405576f, 0.656846285f},
-std::array<float,2>{0.204540119f, 0.531751513f},
-std::array<float,2>{0.881551266f, 0.0469096452f},
-std::array<float,2>{0.310540766f, 0.261633366f},
-std::array<float,2>{0.601212621f, 0.842073202f},
-std::array<float,2>{0.340233773f, 0.743784547f},
-std::array<float,2>{0.51295644f, 0.128578797f},
-std::array<float,2>{0.126874104f, 0.445816338f},
-std::array<float,2>{0.942514837f, 0.908963203f},
-std::array<float,2>{0.00914006494f, 0.780046344f},
-std::array<float,2>{0.80836165f, 0.341267139f},
-std::array<float,2>{0.398734093f, 0.120643847f},
-std::array<float,2>{0.647323906f, 0.610841393f},
-std::array<float,2>{0.372147024f, 0.925135911f},
-std::array<float,2>{0.545427859f, 0.458787918f},
-std::array<float,2>{0.157746702f, 0.145477533f},
-std::array<float,2>{0.971114397f, 0.733090281f},
-std::array<float,2>{0.054323405f, 0.601875305f},
-std::array<float,2>{0.767308831f, 0.0949340835f},
-std::array<float,2>{0.422393709f, 0.320553511f},
-std::array<float,2>{0.676243305f, 0.758066416f},
-std::array<float,2>{0.469048142f, 0.67335695f},
-std::array<float,2>{0.719647706f, 0.200527951f},
-std::array<float,2>{0.0934396684f, 0.378637046f},
-std::array<float,2>{0.843046427f, 0.954319f},
-std::array<float,2>{0.224958032f, 0.821471691f},
-std::array<float,2>{0.92621994f, 0.271268547f},
-std::array<float,2>{0.280504495f, 0.0329647399f},
-std::array<float,2>{0.569671273f, 0.558291912f},
-std::array<float,2>{0.381239861f, 0.784463167f},
-std::array<float,2>{0.626012921f, 0.346728146f},
-std::array<float,2>{0.0260076076f, 0.0777248144f},
-std::array<float,2>{0.784179449f, 0.571811855f},
-std::array<float,2>{0.141720727f, 0.714919627f},
-std::array<float,2>{0.963643789f, 0.171122968f},
-std::array<float,2>{0.31953156f, 0.476357967f},
-std::array<float,2>{0.517308056f, 0.898861349f},
-std::array<float,2>{0.285777688f, 0.521524727f},
-std::array<float,2>{0.624599278f, 0.0191805977f},
-std::array<float,2>{0.20101884f, 0.287962109f},
-std::array<float,2>{0.897441506f, 0.869256079f},
-std::array<float,2>{0.119388901f, 0.994766474f},
-std::array<float,2>{0.852615595f, 0.425414413f},
-std::array<float,2>{0.45186162f, 0.223770127f},
-std::array<float,2>{0.706992447f, 0.627615452f},
-std::array<float,2>{0.326439947f, 0.751105189f},
-std::array<float,2>{0.53051883f, 0.317492276f},
-std::array<float,2>{0.150180697f, 0.103531614f},
-std::array<float,2>{0.955585659f, 0.601560771f},
-std::array<float,2>{0.0213517714f, 0.720202982f},
-std::array<float,2>{0.79427129f, 0.150508747f},
-std::array<float,2>{0.385725826f, 0.464240968f},
-std::array<float,2>{0.637420237f, 0.931964755f},
-std::array<float,2>{0.444398552f, 0.551066697f},
-std::array<float,2>{0.714250267f, 0.0411986858f},
-std::array<float,2>{0.112959437f, 0.276582062f},
-std::array<float,2>{0.846422076f, 0.819683731f},
-std::array<float,2>{0.18930155f, 0.962145627f},
-std::array<float,2>{0.905602932f, 0.390227854f},
-std::array<float,2>{0.289967507f, 0.187913328f},
-std::array<float,2>{0.61462909f, 0.68083322f},
-std::array<float,2>{0.433821827f, 0.891771555f},
-std::array<float,2>{0.681874156f, 0.478327155f},
-std::array<float,2>{0.0585454367f, 0.163850024f},
-std::array<float,2>{0.774386048f, 0.708328068f},
-std::array<float,2>{0.16785273f, 0.567041934f},
-std::array<float,2>{0.978933573f, 0.0697746053f},
-std::array<float,2>{0.36695087f, 0.354498416f},
-std::array<float,2>{0.53809768f, 0.795153201f},
-std::array<float,2>{0.265965402f, 0.635545909f},
-std::array<float,2>{0.575019419f, 0.226834118f},
-std::array<float,2>{0.23227492f, 0.436043292f},
-std::array<float,2>{0.936647832f, 0.989827931f},
-std::array<float,2>{0.0836412907f, 0.863022685f},
-std::array<float,2>{0.830364406f, 0.291676641f},
-std::array<float,2>{0.477507293f, 0.0237354059f},
-std::array<float,2>{0.728988469f, 0.523501337f},
-std::array<float,2>{0.304687381f, 0.980961025f},
-std::array<float,2>{0.606001616f, 0.406724423f},
-std::array<float,2>{0.211219028f, 0.247779727f},
-std::array<float,2>{0.889229655f, 0.645129502f},
-std::array<float,2>{0.102510929f, 0.51373899f},
-std::array<float,2>{0.860693336f, 0.00523781031f},
-std::array<float,2>{0.462864906f, 0.300911486f},
-std::array<float,2>{0.696206093f, 0.843829572f},
-std::array<float,2>{0.396463096f, 0.691979647f},
-std::array<float,2>{0.652281582f, 0.179396138f},
-std::array<float,2>{0.000789205369f, 0.489746362f},
-std::array<float,2>{0.800111711f, 0.880746365f},
-std::array<float,2>{0.136052489f, 0.809881568f},
-std::array<float,2>{0.947956622f, 0.366705537f},
-std::array<float,2>{0.32893613f, 0.0873216242f},
-std::array<float,2>{0.505036116f, 0.581958354f},
-std::array<float,2>{0.491336375f, 0.833526373f},
-std::array<float,2>{0.738978624f, 0.255022615f},
-std::array<float,2>{0.0643526688f, 0.0615842454f},
-std::array<float,2>{0.815533638f, 0.539490581f},
-std::array<float,2>{0.243595928f, 0.667507827f},
-std::array<float,2>{0.921517909f, 0.211255595f},
-std::array<float,2>{0.259419113f, 0.401588142f},
-std::array<float,2>{0.581651211f, 0.946646035f},
-std::array<float,2>{0.356945455f, 0.624876618f},
-std::array<float,2>{0.561538517f, 0.113957934f},
-std::array<float,2>{0.172459885f, 0.328475118f},
-std::array<float,2>{0.99015528f, 0.766747475f},
-std::array<float,2>{0.0333104096f, 0.920669973f},
-std::array<float,2>{0.750177681f, 0.437542349f},
-std::array<float,2>{0.420693904f, 0.139434755f},
-std::array<float,2>{0.668941736f, 0.74147433f},
-std::array<float,2>{0.337894976f, 0.864533365f},
-std::array<float,2>{0.511332572f, 0.29663077f},
-std::array<float,2>{0.130086049f, 0.0300753098f},
-std::array<float,2>{0.938351929f, 0.530008614f},
-std::array<float,2>{0.0117949639f, 0.638194144f},
-std::array<float,2>{0.808956861f, 0.231855527f},
-std::array<float,2>{0.405729324f, 0.4314363f},
-std::array<float,2>{0.643650293f, 0.986824155f},
-std::array<float,2>{0.45984894f, 0.563229263f},
-std::array<float,2>{0.693095624f, 0.0663363487f},
-std::array<float,2>{0.0996277928f, 0.355567932f},
-std::array<float,2>{0.869502008f, 0.791368127f},
-std::array<float,2>{0.208656281f, 0.895136118f},
-std::array<float,2>{0.877629697f, 0.483558774f},
-std::array<float,2>{0.304711282f, 0.157850176f},
-std::array<float,2>{0.596378922f, 0.704465389f},
-std::array<float,2>{0.412264228f, 0.96809119f},
-std::array<float,2>{0.661066294f, 0.38458398f},
-std::array<float,2>{0.0425152555f, 0.191907927f},
-std::array<float,2>{0.761743963f, 0.684722483f},
-std::array<float,2>{0.186206043f, 0.550098717f},
-std::array<float,2>{0.996942103f, 0.0460648015f},
-std::array<float,2>{0.347063988f, 0.279224932f},
-std::array<float,2>{0.552586079f, 0.816383183f},
-std::array<float,2>{0.255808383f, 0.724273384f},
-std::array<float,2>{0.591372609f, 0.153167456f},
-std::array<float,2>{0.239140645f, 0.468439877f},
-std::array<float,2>{0.908445954f, 0.934982836f},
-std::array<float,2>{0.077027902f, 0.756227195f},
-std::array<float,2>{0.824292421f, 0.315553397f},
-std::array<float,2>{0.497743011f, 0.10674455f},
-std::array<float,2>{0.744903624f, 0.597134173f},
-std::array<float,2>{0.282377273f, 0.915598929f},
-std::array<float,2>{0.619815648f, 0.445004851f},
-std::array<float,2>{0.197663978f, 0.135516882f},
-std::array<float,2>{0.892508984f, 0.736056089f},
-std::array<float,2>{0.123700105f, 0.620088756f},
-std::array<float,2>{0.857363403f, 0.109773241f},
-std::array<float,2>{0.448374569f, 0.332715988f},
-std::array<float,2>{0.709786952f, 0.77043581f},
-std::array<float,2>{0.376495272f, 0.669440925f},
-std::array<float,2>{0.63147527f, 0.215809792f},
-std::array<float,2>{0.0273735374f, 0.403982937f},
-std::array<float,2>{0.787649333f, 0.951792777f},
-std::array<float,2>{0.146950737f, 0.830800653f},
-std::array<float,2>{0.968098879f, 0.253716975f},
-std::array<float,2>{0.315154254f, 0.056110166f},
-std::array<float,2>{0.523211479f, 0.545663476f},
-std::array<float,2>{0.474748731f, 0.805971682f},
-std::array<float,2>{0.723162651f, 0.36035198f},
-std::array<float,2>{0.0889291763f, 0.0907325298f},
-std::array<float,2>{0.836265028f, 0.58472085f},
-std::array<float,2>{0.220431283f, 0.689757764f},
-std::array<float,2>{0.923669279f, 0.17302078f},
-std::array<float,2>{0.274186075f, 0.485220224f},
-std::array<float,2>{0.563289583f, 0.875455439f},
-std::array<float,2>{0.37076357f, 0.510404229f},
-std::array<float,2>{0.54080832f, 0.00124248373f},
-std::array<float,2>{0.162278876f, 0.299619347f},
-std::array<float,2>{0.97313565f, 0.849232018f},
-std::array<float,2>{0.0476033315f, 0.979978561f},
-std::array<float,2>{0.770617127f, 0.41313839f},
-std::array<float,2>{0.427898407f, 0.242981449f},
-std::array<float,2>{0.675443947f, 0.642624915f},
-std::array<float,2>{0.272316277f, 0.777217031f},
-std::array<float,2>{0.573161125f, 0.338930637f},
-std::array<float,2>{0.228267774f, 0.122695163f},
-std::array<float,2>{0.930882454f, 0.613407969f},
-std::array<float,2>{0.0787093565f, 0.749311447f},
-std::array<float,2>{0.835055947f, 0.129998833f},
-std::array<float,2>{0.482486099f, 0.450779557f},
-std::array<float,2>{0.73346591f, 0.912767589f},
-std::array<float,2>{0.433562487f, 0.53614831f},
-std::array<float,2>{0.6859501f, 0.0513926968f},
-std::array<float,2>{0.0612794235f, 0.263616025f},
-std::array<float,2>{0.778358519f, 0.838481605f},
-std::array<float,2>{0.168903813f, 0.942603827f},
-std::array<float,2>{0.983680308f, 0.392369896f},
-std::array<float,2>{0.361188531f, 0.206556052f},
-std::array<float,2>{0.533649862f, 0.662921309f},
-std::array<float,2>{0.43810913f, 0.885995209f},
-std::array<float,2>{0.7162202f, 0.497087151f},
-std::array<float,2>{0.11575143f, 0.187474594f},
-std::array<float,2>{0.848403573f, 0.699968457f},
-std::array<float,2>{0.194657281f, 0.588613629f},
-std::array<float,2>{0.89962846f, 0.0805802867f},
-std::array<float,2>{0.296229929f, 0.374468565f},
-std::array<float,2>{0.612608135f, 0.803281844f},
-std::array<float,2>{0.321100712f, 0.653707445f},
-std::array<float,2>{0.526714265f, 0.240335912f},
-std::array<float,2>{0.154848158f, 0.420998037f},
-std::array<float,2>{0.958029807f, 0.970864654f},
-std::array<float,2>{0.0180331394f, 0.855656326f},
-std::array<float,2>{0.792856634f, 0.312440187f},
-std::array<float,2>{0.390574694f, 0.0111821396f},
-std::array<float,2>{0.635194182f, 0.501281857f},
-std::array<float,2>{0.354474425f, 0.998551786f},
-std::array<float,2>{0.556854367f, 0.428303778f},
-std::array<float,2>{0.178106695f, 0.222108275f},
-std::array<float,2>{0.986646235f, 0.629248798f},
-std::array<float,2>{0.0389592163f, 0.519452155f},
-std::array<float,2>{0.756109774f, 0.0198915396f},
-std::array<float,2>{0.415053546f, 0.28340292f},
-std::array<float,2>{0.666770875f, 0.872508764f},
-std::array<float,2>{0.484931171f, 0.71240294f},
-std::array<float,2>{0.736052155f, 0.166328058f},
-std::array<float,2>{0.0696697384f, 0.469153821f},
-std::array<float,2>{0.819198608f, 0.90394032f},
-std::array<float,2>{0.246730044f, 0.785475194f},
-std::array<float,2>{0.914612949f, 0.349527955f},
-std::array<float,2>{0.264660478f, 0.0709061027f},
-std::array<float,2>{0.58401227f, 0.574461877f},
-std::array<float,2>{0.393850923f, 0.825868607f},
-std::array<float,2>{0.654664576f, 0.266534299f},
-std::array<float,2>{0.00682772603f, 0.0379678644f},
-std::array<float,2>{0.801254392f, 0.559053302f},
-std::array<float,2>{0.140463606f, 0.677471936f},
-std::array<float,2>{0.952826738f, 0.198117495f},
-std::array<float,2>{0.332547843f, 0.380636305f},
-std::array<float,2>{0.502971888f, 0.959385216f},
-std::array<float,2>{0.297443628f, 0.607317865f},
-std::array<float,2>{0.603422523f, 0.0992436931f},
-std::array<float,2>{0.214977995f, 0.326744139f},
-std::array<float,2>{0.884018481f, 0.761785388f},
-std::array<float,2>{0.106184311f, 0.929342985f},
-std::array<float,2>{0.866945148f, 0.454952538f},
-std::array<float,2>{0.466842204f, 0.141590536f},
-std::array<float,2>{0.701865971f, 0.729578912f},
-std::array<float,2>{0.31089893f, 0.841601253f},
-std::array<float,2>{0.598592818f, 0.258820415f},
-std::array<float,2>{0.205213919f, 0.0500172526f},
-std::array<float,2>{0.879542589f, 0.533303857f},
-std::array<float,2>{0.095466949f, 0.659483552f},
-std::array<float,2>{0.872364044f, 0.20704633f},
-std::array<float,2>{0.456544518f, 0.398230553f},
-std::array<float,2>{0.689266622f, 0.939010024f},
-std::array<float,2>{0.401070118f, 0.613028467f},
-std::array<float,2>{0.646134198f, 0.117877156f},
-std::array<float,2>{0.0104886414f, 0.343583196f},
-std::array<float,2>{0.8056494f, 0.777882695f},
-std::array<float,2>{0.1286982f, 0.906261742f},
-std::array<float,2>{0.945223451f, 0.447462171f},
-std::array<float,2>{0.343048543f, 0.125193343f},
-std::array<float,2>{0.513827324f, 0.745970249f},
-std::array<float,2>{0.495610148f, 0.975929439f},
-std::array<float,2>{0.747991502f, 0.414257824f},
-std::array<float,2>{0.0737755299f, 0.238105088f},
-std::array<float,2>{0.822867036f, 0.650340736f},
-std::array<float,2>{0.238005772f, 0.505458593f},
-std::array<float,2>{0.91172266f, 0.0126632275f},
-std::array<float,2>{0.250160515f, 0.307287216f},
-std::array<float,2>{0.58928448f, 0.85403496f},
-std::array<float,2>{0.350575298f, 0.695327699f},
-std::array<float,2>{0.550525963f, 0.183191091f},
-std::array<float,2>{0.180427492f, 0.494446367f},
-std::array<float,2>{0.994840205f, 0.887417793f},
-std::array<float,2>{0.0436263643f, 0.798167944f},
-std::array<float,2>{0.758793831f, 0.367248863f},
-std::array<float,2>{0.410004705f, 0.0848473608f},
-std::array<float,2>{0.656326532f, 0.592182457f},
-std::array<float,2>{0.316854566f, 0.90185523f},
-std::array<float,2>{0.517609298f, 0.473878056f},
-std::array<float,2>{0.143192276f, 0.168133944f},
-std::array<float,2>{0.962363183f, 0.717024207f},
-std::array<float,2>{0.0242339429f, 0.574096978f},
-std::array<float,2>{0.781894326f, 0.0751221776f},
-std::array<float,2>{0.38001585f, 0.344412029f},
-std::array<float,2>{0.627175033f, 0.78231734f},
-std::array<float,2>{0.449805796f, 0.626474798f},
-std::array<float,2>{0.704598844f, 0.225796327f},
-std::array<float,2>{0.117924504f, 0.423569798f},
-std::array<float,2>{0.853998125f, 0.993729591f},
-std::array<float,2>{0.202980131f, 0.868656278f},
-std::array<float,2>{0.895089924f, 0.286452353f},
-std::array<float,2>{0.287893951f, 0.0166073889f},
-std::array<float,2>{0.622168124f, 0.52009505f},
-std::array<float,2>{0.425337672f, 0.761182308f},
-std::array<float,2>{0.679670155f, 0.322927028f},
-std::array<float,2>{0.0508322008f, 0.0970288292f},
-std::array<float,2>{0.768062413f, 0.603939116f},
-std::array<float,2>{0.159808159f, 0.73203665f},
-std::array<float,2>{0.9689731f, 0.147702917f},
-std::array<float,2>{0.374715775f, 0.459461182f},
-std::array<float,2>{0.544852078f, 0.923121333f},
-std::array<float,2>{0.27916795f, 0.556325257f},
-std::array<float,2>{0.56735605f, 0.0336971767f},
-std::array<float,2>{0.223628923f, 0.273392588f},
-std::array<float,2>{0.92797637f, 0.824010074f},
-std::array<float,2>{0.0904462039f, 0.955931664f},
-std::array<float,2>{0.841172814f, 0.375353873f},
-std::array<float,2>{0.471556246f, 0.202992722f},
-std::array<float,2>{0.722161591f, 0.673870146f},
-std::array<float,2>{0.365222782f, 0.792996347f},
-std::array<float,2>{0.536417663f, 0.35318327f},
-std::array<float,2>{0.165637031f, 0.0673866197f},
-std::array<float,2>{0.977538526f, 0.568767786f},
-std::array<float,2>{0.0566222146f, 0.709868014f},
-std::array<float,2>{0.775440395f, 0.161448881f},
-std::array<float,2>{0.437179834f, 0.480346113f},
-std::array<float,2>{0.680849075f, 0.892666161f},
-std::array<float,2>{0.479848087f, 0.52569592f},
-std::array<float,2>{0.72814554f, 0.0254714079f},
-std::array<float,2>{0.0842290893f, 0.289646983f},
-std::array<float,2>{0.830022514f, 0.860976636f},
-std::array<float,2>{0.232807726f, 0.99030894f},
-std::array<float,2>{0.93511194f, 0.433917403f},
-std::array<float,2>{0.268236727f, 0.230092436f},
-std::array<float,2>{0.577957749f, 0.634258807f},
-std::array<float,2>{0.383277655f, 0.929878592f},
-std::array<float,2>{0.639102817f, 0.461214215f},
-std::array<float,2>{0.0218742657f, 0.150050789f},
-std::array<float,2>{0.796228051f, 0.720907032f},
-std::array<float,2>{0.151624218f, 0.598959029f},
-std::array<float,2>{0.954505026f, 0.103460103f},
-std::array<float,2>{0.325600594f, 0.31862241f},
-std::array<float,2>{0.527496696f, 0.753361762f},
-std::array<float,2>{0.292761326f, 0.682050169f},
-std::array<float,2>{0.616487801f, 0.190591767f},
-std::array<float,2>{0.189563215f, 0.387452662f},
-std::array<float,2>{0.903672934f, 0.964423835f},
-std::array<float,2>{0.110373542f, 0.817289054f},
-std::array<float,2>{0.845175564f, 0.274744093f},
-std::array<float,2>{0.442202926f, 0.0396877453f},
-std::array<float,2>{0.71162957f, 0.553958416f},
-std::array<float,2>{0.261212707f, 0.947916448f},
-std::array<float,2>{0.579973102f, 0.398454338f},
-std::array<float,2>{0.244498596f, 0.213140965f},
-std::array<float,2>{0.919464111f, 0.665564716f},
-std::array<float,2>{0.064781256f, 0.542394638f},
-std::array<float,2>{0.813425779f, 0.0590318628f},
-std::array<float,2>{0.489356965f, 0.257321477f},
-std::array<float,2>{0.742065609f, 0.834177434f},
-std::array<float,2>{0.419430733f, 0.740090489f},
-std::array<float,2>{0.670206249f, 0.137457341f},
-std::array<float,2>{0.0320250168f, 0.440027207f},
-std::array<float,2>{0.752587378f, 0.918872893f},
-std::array<float,2>{0.174430087f, 0.769007385f},
-std::array<float,2>{0.991933465f, 0.330149084f},
-std::array<float,2>{0.358629584f, 0.116731435f},
-std::array<float,2>{0.558785021f, 0.622134626f},
-std::array<float,2>{0.464786619f, 0.847111523f},
-std::array<float,2>{0.69861728f, 0.304001927f},
-std::array<float,2>{0.10493093f, 0.00619676197f},
-std::array<float,2>{0.862277627f, 0.511873305f},
-std::array<float,2>{0.214043856f, 0.647560716f},
-std::array<float,2>{0.888565779f, 0.249567151f},
-std::array<float,2>{0.301293761f, 0.409082294f},
-std::array<float,2>{0.609155655f, 0.982718527f},
-std::array<float,2>{0.330925316f, 0.578327179f},
-std::array<float,2>{0.507398307f, 0.0892052725f},
-std::array<float,2>{0.134308785f, 0.364318073f},
-std::array<float,2>{0.946123064f, 0.810621917f},
-std::array<float,2>{0.00341852964f, 0.882535636f},
-std::array<float,2>{0.798337817f, 0.490340889f},
-std::array<float,2>{0.398286402f, 0.176528856f},
-std::array<float,2>{0.649496019f, 0.694087625f},
-std::array<float,2>{0.332432985f, 0.826490402f},
-std::array<float,2>{0.5035941f, 0.269299567f},
-std::array<float,2>{0.14013043f, 0.0357456841f},
-std::array<float,2>{0.952314436f, 0.561411619f},
-std::array<float,2>{0.00621933118f, 0.678337634f},
-std::array<float,2>{0.801407516f, 0.197198227f},
-std::array<float,2>{0.394173503f, 0.382170975f},
-std::array<float,2>{0.655129015f, 0.957997441f},
-std::array<float,2>{0.467421532f, 0.609077215f},
-std::array<float,2>{0.701531231f, 0.0996730626f},
-std::array<float,2>{0.105841145f, 0.324489325f},
-std::array<float,2>{0.866461635f, 0.765210152f},
-std::array<float,2>{0.215425879f, 0.927340806f},
-std::array<float,2>{0.884509325f, 0.455439001f},
-std::array<float,2>{0.297209382f, 0.143014148f},
-std::array<float,2>{0.602973998f, 0.726730287f},
-std::array<float,2>{0.415991694f, 0.996223211f},
-std::array<float,2>{0.666390181f, 0.426850826f},
-std::array<float,2>{0.0384794995f, 0.219500676f},
-std::array<float,2>{0.756710827f, 0.632122159f},
-std::array<float,2>{0.17839168f, 0.51626724f},
-std::array<float,2>{0.987056255f, 0.0230739582f},
-std::array<float,2>{0.353818655f, 0.281252712f},
-std::array<float,2>{0.557286799f, 0.874739766f},
-std::array<float,2>{0.26543811f, 0.713957667f},
-std::array<float,2>{0.584760308f, 0.165822551f},
-std::array<float,2>{0.246430665f, 0.471189469f},
-std::array<float,2>{0.914179802f, 0.906043589f},
-std::array<float,2>{0.0700504258f, 0.787561238f},
-std::array<float,2>{0.818769693f, 0.351460159f},
-std::array<float,2>{0.484734654f, 0.0733767897f},
-std::array<float,2>{0.735790253f, 0.576616764f},
-std::array<float,2>{0.296568781f, 0.883728564f},
-std::array<float,2>{0.613274872f, 0.499997407f},
-std::array<float,2>{0.194908172f, 0.185469046f},
-std::array<float,2>{0.900165975f, 0.702324569f},
-std::array<float,2>{0.115635931f, 0.586041331f},
-std::array<float,2>{0.847680271f, 0.0795036852f},
-std::array<float,2>{0.437963694f, 0.372279018f},
-std::array<float,2>{0.716712296f, 0.802459061f},
-std::array<float,2>{0.389975131f, 0.654855788f},
-std::array<float,2>{0.635564029f, 0.24003154f},
-std::array<float,2>{0.0182629265f, 0.419446319f},
-std::array<float,2>{0.7920596f, 0.969274163f},
-std::array<float,2>{0.15450792f, 0.859158814f},
-std::array<float,2>{0.958810449f, 0.309863001f},
-std::array<float,2>{0.32078141f, 0.00814531278f},
-std::array<float,2>{0.526974678f, 0.502942383f},
-std::array<float,2>{0.483388394f, 0.775279343f},
-std::array<float,2>{0.733962476f, 0.337486088f},
-std::array<float,2>{0.0785208344f, 0.124967828f},
-std::array<float,2>{0.835566044f, 0.616417289f},
-std::array<float,2>{0.227996528f, 0.747298956f},
-std::array<float,2>{0.931430876f, 0.131617755f},
-std::array<float,2>{0.271678001f, 0.451199442f},
-std::array<float,2>{0.572443366f, 0.910782039f},
-std::array<float,2>{0.360368043f, 0.538727403f},
-std::array<float,2>{0.533980906f, 0.0545955412f},
-std::array<float,2>{0.168230891f, 0.264326483f},
-std::array<float,2>{0.983990431f, 0.837032497f},
-std::array<float,2>{0.0607950278f, 0.943994224f},
-std::array<float,2>{0.778945148f, 0.39307043f},
-std::array<float,2>{0.432787627f, 0.204749048f},
-std::array<float,2>{0.68608427f, 0.660254776f},
-std::array<float,2>{0.273855716f, 0.806927025f},
-std::array<float,2>{0.562635243f, 0.362848788f},
-std::array<float,2>{0.220207855f, 0.0934901685f},
-std::array<float,2>{0.923174024f, 0.583550155f},
-std::array<float,2>{0.0895746201f, 0.688202977f},
-std::array<float,2>{0.836585522f, 0.175120428f},
-std::array<float,2>{0.475198448f, 0.486717045f},
-std::array<float,2>{0.722962797f, 0.878385782f},
-std::array<float,2>{0.428367883f, 0.509492815f},
-std::array<float,2>{0.674810767f, 0.00380969094f},
-std::array<float,2>{0.0472376794f, 0.297460556f},
-std::array<float,2>{0.771114826f, 0.850739241f},
-std::array<float,2>{0.162990943f, 0.977077663f},
-std::array<float,2>{0.973389626f, 0.411601692f},
-std::array<float,2>{0.370458096f, 0.245952457f},
-std::array<float,2>{0.540176451f, 0.641580284f},
-std::array<float,2>{0.448732853f, 0.916840374f},
-std::array<float,2>{0.709414303f, 0.441945374f},
-std::array<float,2>{0.123066813f, 0.13315855f},
-std::array<float,2>{0.856464922f, 0.737559617f},
-std::array<float,2>{0.197778523f, 0.618408561f},
-std::array<float,2>{0.891757488f, 0.112077571f},
-std::array<float,2>{0.282827049f, 0.334468603f},
-std::array<float,2>{0.61921674f, 0.771533132f},
-std::array<float,2>{0.314784676f, 0.669947505f},
-std::array<float,2>{0.522879064f, 0.217071727f},
-std::array<float,2>{0.14711538f, 0.405471087f},
-std::array<float,2>{0.968720973f, 0.951047003f},
-std::array<float,2>{0.0278901197f, 0.829523861f},
-std::array<float,2>{0.78738749f, 0.251799911f},
-std::array<float,2>{0.376127213f, 0.0581990331f},
-std::array<float,2>{0.631288826f, 0.544605315f},
-std::array<float,2>{0.347444564f, 0.965637088f},
-std::array<float,2>{0.552052855f, 0.385029912f},
-std::array<float,2>{0.185971543f, 0.194740042f},
-std::array<float,2>{0.996201992f, 0.687077343f},
-std::array<float,2>{0.042023439f, 0.548264921f},
-std::array<float,2>{0.762399435f, 0.0437819064f},
-std::array<float,2>{0.412872404f, 0.280748546f},
-std::array<float,2>{0.660279095f, 0.81381923f},
-std::array<float,2>{0.49740991f, 0.724979579f},
-std::array<float,2>{0.744554102f, 0.154668763f},
-std::array<float,2>{0.0763342902f, 0.46589753f},
-std::array<float,2>{0.824844062f, 0.935950875f},
-std::array<float,2>{0.2385263f, 0.755754828f},
-std::array<float,2>{0.908807993f, 0.312893361f},
-std::array<float,2>{0.255260438f, 0.108048618f},
-std::array<float,2>{0.591077864f, 0.594697595f},
-std::array<float,2>{0.405867338f, 0.866632938f},
-std::array<float,2>{0.644254982f, 0.292995721f},
-std::array<float,2>{0.012621928f, 0.0288780723f},
-std::array<float,2>{0.809149504f, 0.529101908f},
-std::array<float,2>{0.130661815f, 0.64043951f},
-std::array<float,2>{0.937874556f, 0.234315529f},
-std::array<float,2>{0.33842504f, 0.433493555f},
-std::array<float,2>{0.511000156f, 0.985898316f},
-std::array<float,2>{0.305658966f, 0.56551069f},
-std::array<float,2>{0.596057475f, 0.0627719536f},
-std::array<float,2>{0.208265781f, 0.358913243f},
-std::array<float,2>{0.876982868f, 0.790642917f},
-std::array<float,2>{0.100412071f, 0.898165703f},
-std::array<float,2>{0.869817793f, 0.481221765f},
-std::array<float,2>{0.459414601f, 0.159057543f},
-std::array<float,2>{0.692852139f, 0.706447899f},
-std::array<float,2>{0.300924897f, 0.844392836f},
-std::array<float,2>{0.608533859f, 0.301371366f},
-std::array<float,2>{0.214382336f, 0.00576438988f},
-std::array<float,2>{0.887749732f, 0.514379025f},
-std::array<float,2>{0.105091147f, 0.644768476f},
-std::array<float,2>{0.861553431f, 0.247346282f},
-std::array<float,2>{0.4642497f, 0.407023579f},
-std::array<float,2>{0.69901824f, 0.98050797f},
-std::array<float,2>{0.397828311f, 0.581446946f},
-std::array<float,2>{0.649953127f, 0.0875795409f},
-std::array<float,2>{0.00326704746f, 0.3663311f},
-std::array<float,2>{0.798461974f, 0.810227931f},
-std::array<float,2>{0.134169847f, 0.880042136f},
-std::array<float,2>{0.945790708f, 0.489398569f},
-std::array<float,2>{0.330229431f, 0.179088354f},
-std::array<float,2>{0.507260323f, 0.691464245f},
-std::array<float,2>{0.490189254f, 0.947067976f},
-std::array<float,2>{0.741612196f, 0.402165473f},
-std::array<float,2>{0.065051049f, 0.211746469f},
-std::array<float,2>{0.812965274f, 0.6670717f},
-std::array<float,2>{0.244816571f, 0.540002823f},
-std::array<float,2>{0.919327021f, 0.0624657348f},
-std::array<float,2>{0.261288375f, 0.255765051f},
-std::array<float,2>{0.579185486f, 0.833256066f},
-std::array<float,2>{0.359129161f, 0.741796553f},
-std::array<float,2>{0.559402525f, 0.138834596f},
-std::array<float,2>{0.174268857f, 0.43846947f},
-std::array<float,2>{0.991241574f, 0.920408905f},
-std::array<float,2>{0.0313104838f, 0.767408073f},
-std::array<float,2>{0.752105415f, 0.328671962f},
-std::array<float,2>{0.419919074f, 0.113441937f},
-std::array<float,2>{0.670572937f, 0.624241412f},
-std::array<float,2>{0.32600984f, 0.932223856f},
-std::array<float,2>{0.528195322f, 0.464797884f},
-std::array<float,2>{0.15212658f, 0.151221693f},
-std::array<float,2>{0.954708815f, 0.720679402f},
-std::array<float,2>{0.0220088325f, 0.601012886f},
-std::array<float,2>{0.796756685f, 0.104260109f},
-std::array<float,2>{0.383528799f, 0.318167329f},
-std::array<float,2>{0.639483213f, 0.751605272f},
-std::array<float,2>{0.441522837f, 0.681292593f},
-std::array<float,2>{0.711295724f, 0.188078552f},
-std::array<float,2>{0.111083761f, 0.389727443f},
-std::array<float,2>{0.845492184f, 0.962784469f},
-std::array<float,2>{0.19005774f, 0.820277929f},
-std::array<float,2>{0.904138088f, 0.276876301f},
-std::array<float,2>{0.29219535f, 0.0417323261f},
-std::array<float,2>{0.616969407f, 0.551412642f},
-std::array<float,2>{0.436966151f, 0.795561135f},
-std::array<float,2>{0.681638122f, 0.355100453f},
-std::array<float,2>{0.0559937954f, 0.0702004954f},
-std::array<float,2>{0.77609688f, 0.566783369f},
-std::array<float,2>{0.16519466f, 0.708791554f},
-std::array<float,2>{0.976802111f, 0.163298979f},
-std::array<float,2>{0.364486724f, 0.477910161f},
-std::array<float,2>{0.536825418f, 0.892344713f},
-std::array<float,2>{0.267754138f, 0.523977995f},
-std::array<float,2>{0.577534258f, 0.0240020752f},
-std::array<float,2>{0.232985094f, 0.29108277f},
-std::array<float,2>{0.934628427f, 0.862618446f},
-std::array<float,2>{0.0849311426f, 0.989517987f},
-std::array<float,2>{0.82942158f, 0.435941249f},
-std::array<float,2>{0.480389476f, 0.227173537f},
-std::array<float,2>{0.727806509f, 0.635218143f},
-std::array<float,2>{0.374373734f, 0.75869298f},
-std::array<float,2>{0.544139087f, 0.320830345f},
-std::array<float,2>{0.159467846f, 0.0953938812f},
-std::array<float,2>{0.969718933f, 0.602075636f},
-std::array<float,2>{0.0515306927f, 0.732511222f},
-std::array<float,2>{0.768329084f, 0.144686386f},
-std::array<float,2>{0.424885482f, 0.458449751f},
-std::array<float,2>{0.67879951f, 0.925402045f},
-std::array<float,2>{0.471127719f, 0.558021367f},
-std::array<float,2>{0.72258687f, 0.0326483175f},
-std::array<float,2>{0.0900230408f, 0.270835847f},
-std::array<float,2>{0.841655433f, 0.822238863f},
-std::array<float,2>{0.222981364f, 0.954641283f},
-std::array<float,2>{0.928698957f, 0.378019989f},
-std::array<float,2>{0.278508931f, 0.200768009f},
-std::array<float,2>{0.566640258f, 0.673292398f},
-std::array<float,2>{0.380494148f, 0.899038672f},
-std::array<float,2>{0.627569437f, 0.475617737f},
-std::array<float,2>{0.0238614678f, 0.171456844f},
-std::array<float,2>{0.781616032f, 0.715480208f},
-std::array<float,2>{0.142855912f, 0.571752608f},
-std::array<float,2>{0.962685347f, 0.0774935186f},
-std::array<float,2>{0.317032874f, 0.347521037f},
-std::array<float,2>{0.518101156f, 0.784986794f},
-std::array<float,2>{0.287524253f, 0.627186298f},
-std::array<float,2>{0.622575045f, 0.224275827f},
-std::array<float,2>{0.202369139f, 0.424911112f},
-std::array<float,2>{0.894805253f, 0.994244695f},
-std::array<float,2>{0.117249683f, 0.8697083f},
-std::array<float,2>{0.854147971f, 0.287233204f},
-std::array<float,2>{0.449701756f, 0.0185943283f},
-std::array<float,2>{0.704542577f, 0.522382259f},
-std::array<float,2>{0.250696659f, 0.973850965f},
-std::array<float,2>{0.589657605f, 0.416708648f},
-std::array<float,2>{0.237492204f, 0.235576048f},
-std::array<float,2>{0.911319733f, 0.650451243f},
-std::array<float,2>{0.0735440552f, 0.506208479f},
-std::array<float,2>{0.822633803f, 0.0148875071f},
-std::array<float,2>{0.49512735f, 0.305962443f},
-std::array<float,2>{0.74750185f, 0.852026939f},
-std::array<float,2>{0.409470856f, 0.699049592f},
-std::array<float,2>{0.656739652f, 0.180901602f},
-std::array<float,2>{0.0431888141f, 0.493774086f},
-std::array<float,2>{0.759389997f, 0.890046239f},
-std::array<float,2>{0.179710492f, 0.799228013f},
-std::array<float,2>{0.994332492f, 0.369964033f},
-std::array<float,2>{0.349880695f, 0.0821421072f},
-std::array<float,2>{0.549873888f, 0.591273606f},
-std::array<float,2>{0.456088334f, 0.842379272f},
-std::array<float,2>{0.688840508f, 0.26104629f},
-std::array<float,2>{0.0950944126f, 0.0476371534f},
-std::array<float,2>{0.872908413f, 0.53159833f},
-std::array<float,2>{0.205972329f, 0.656530797f},
-std::array<float,2>{0.879031658f, 0.209383249f},
-std::array<float,2>{0.311275512f, 0.394662648f},
-std::array<float,2>{0.597718f, 0.939754307f},
-std::array<float,2>{0.343406767f, 0.610362232f},
-std::array<float,2>{0.514270723f, 0.12056534f},
-std::array<float,2>{0.128060624f, 0.341497034f},
-std::array<float,2>{0.944705427f, 0.779500365f},
-std::array<float,2>{0.00999724586f, 0.908264279f},
-std::array<float,2>{0.805043995f, 0.445394635f},
-std::array<float,2>{0.400473922f, 0.128042713f},
-std::array<float,2>{0.645738661f, 0.743421614f},
-std::array<float,2>{0.352441728f, 0.872880936f},
-std::array<float,2>{0.555152535f, 0.28379178f},
-std::array<float,2>{0.17726016f, 0.0204430372f},
-std::array<float,2>{0.986231863f, 0.518823326f},
-std::array<float,2>{0.0366205648f, 0.629671156f},
-std::array<float,2>{0.755054653f, 0.222411692f},
-std::array<float,2>{0.416427463f, 0.428052694f},
-std::array<float,2>{0.664539099f, 0.998241842f},
-std::array<float,2>{0.486763418f, 0.57493937f},
-std::array<float,2>{0.736785412f, 0.0707105622f},
-std::array<float,2>{0.0682627112f, 0.348650962f},
-std::array<float,2>{0.8175928f, 0.785856783f},
-std::array<float,2>{0.24966611f, 0.903369308f},
-std::array<float,2>{0.916511953f, 0.469286501f},
-std::array<float,2>{0.263159394f, 0.166713104f},
-std::array<float,2>{0.583377361f, 0.711969674f},
-std::array<float,2>{0.392228007f, 0.959620893f},
-std::array<float,2>{0.652461529f, 0.380330205f},
-std::array<float,2>{0.00441416074f, 0.197353989f},
-std::array<float,2>{0.803172529f, 0.67707485f},
-std::array<float,2>{0.138237104f, 0.559165418f},
-std::array<float,2>{0.949883819f, 0.0373456664f},
-std::array<float,2>{0.335698575f, 0.265699029f},
-std::array<float,2>{0.501688123f, 0.825252175f},
-std::array<float,2>{0.300460845f, 0.730219662f},
-std::array<float,2>{0.604832053f, 0.14079231f},
-std::array<float,2>{0.217077523f, 0.454496741f},
-std::array<float,2>{0.885070324f, 0.929056942f},
-std::array<float,2>{0.107870854f, 0.762611568f},
-std::array<float,2>{0.865175188f, 0.326352805f},
-std::array<float,2>{0.465292931f, 0.0990434662f},
-std::array<float,2>{0.699857175f, 0.606658578f},
-std::array<float,2>{0.269549549f, 0.912571073f},
-std::array<float,2>{0.57208246f, 0.450592458f},
-std::array<float,2>{0.230247214f, 0.130856931f},
-std::array<float,2>{0.93276304f, 0.749997556f},
-std::array<float,2>{0.0802919269f, 0.61419791f},
-std::array<float,2>{0.832534611f, 0.122217193f},
-std::array<float,2>{0.482041001f, 0.339481562f},
-std::array<float,2>{0.731057167f, 0.776688278f},
-std::array<float,2>{0.431501627f, 0.662234008f},
-std::array<float,2>{0.684912443f, 0.206215367f},
-std::array<float,2>{0.0603646152f, 0.392017126f},
-std::array<float,2>{0.781126857f, 0.943329811f},
-std::array<float,2>{0.171583682f, 0.838011503f},
-std::array<float,2>{0.980966449f, 0.262800694f},
-std::array<float,2>{0.361898333f, 0.050855644f},
-std::array<float,2>{0.532688498f, 0.537065804f},
-std::array<float,2>{0.440874934f, 0.803052545f},
-std::array<float,2>{0.716991842f, 0.374563664f},
-std::array<float,2>{0.114698552f, 0.0804482847f},
-std::array<float,2>{0.850370228f, 0.588214219f},
-std::array<float,2>{0.191691175f, 0.699622929f},
-std::array<float,2>{0.90195322f, 0.186937228f},
-std::array<float,2>{0.293064564f, 0.497879088f},
-std::array<float,2>{0.609422028f, 0.886406958f},
-std::array<float,2>{0.323503405f, 0.501918733f},
-std::array<float,2>{0.523708284f, 0.0113537656f},
-std::array<float,2>{0.15387696f, 0.311833292f},
-std::array<float,2>{0.960206687f, 0.856410801f},
-std::array<float,2>{0.0172503218f, 0.971234262f},
-std::array<float,2>{0.789116144f, 0.421388566f},
-std::array<float,2>{0.387131274f, 0.241143078f},
-std::array<float,2>{0.63369298f, 0.654264629f},
-std::array<float,2>{0.284743756f, 0.769660413f},
-std::array<float,2>{0.61844027f, 0.332172811f},
-std::array<float,2>{0.195652381f, 0.110170864f},
-std::array<float,2>{0.894321322f, 0.619272947f},
-std::array<float,2>{0.122382782f, 0.735413015f},
-std::array<float,2>{0.858418345f, 0.134782881f},
-std::array<float,2>{0.445626497f, 0.44467178f},
-std::array<float,2>{0.708420157f, 0.915206432f},
-std::array<float,2>{0.377720147f, 0.544922531f},
-std::array<float,2>{0.62983048f, 0.056274429f},
-std::array<float,2>{0.0294411853f, 0.25332433f},
-std::array<float,2>{0.786028147f, 0.83031559f},
-std::array<float,2>{0.145311743f, 0.951179087f},
-std::array<float,2>{0.965746939f, 0.403434277f},
-std::array<float,2>{0.313676476f, 0.214893728f},
-std::array<float,2>{0.519649982f, 0.669219673f},
-std::array<float,2>{0.474310935f, 0.875804424f},
-std::array<float,2>{0.726544082f, 0.484440863f},
-std::array<float,2>{0.0869254172f, 0.173703685f},
-std::array<float,2>{0.838208079f, 0.690177143f},
-std::array<float,2>{0.222439364f, 0.584162176f},
-std::array<float,2>{0.925736904f, 0.0901389644f},
-std::array<float,2>{0.275866985f, 0.360988855f},
-std::array<float,2>{0.564738333f, 0.806355417f},
-std::array<float,2>{0.368764788f, 0.643521547f},
-std::array<float,2>{0.541885376f, 0.242660776f},
-std::array<float,2>{0.161328867f, 0.413870037f},
-std::array<float,2>{0.975087941f, 0.979985058f},
-std::array<float,2>{0.0489222594f, 0.84883225f},
-std::array<float,2>{0.772640705f, 0.299224049f},
-std::array<float,2>{0.427087367f, 0.00191453507f},
-std::array<float,2>{0.672739565f, 0.51008296f},
-std::array<float,2>{0.336971462f, 0.986746669f},
-std::array<float,2>{0.508697093f, 0.430744797f},
-std::array<float,2>{0.13114661f, 0.232046723f},
-std::array<float,2>{0.93985033f, 0.637731969f},
-std::array<float,2>{0.0150627652f, 0.529335499f},
-std::array<float,2>{0.811171353f, 0.0297092572f},
-std::array<float,2>{0.40353933f, 0.29621619f},
-std::array<float,2>{0.642394066f, 0.864765584f},
-std::array<float,2>{0.458694875f, 0.704955816f},
-std::array<float,2>{0.69446224f, 0.15757972f},
-std::array<float,2>{0.0987098217f, 0.484037936f},
-std::array<float,2>{0.86895293f, 0.89460963f},
-std::array<float,2>{0.210009873f, 0.791815102f},
-std::array<float,2>{0.876004696f, 0.356358081f},
-std::array<float,2>{0.307134897f, 0.0654547438f},
-std::array<float,2>{0.594825804f, 0.56262964f},
-std::array<float,2>{0.411034286f, 0.815666854f},
-std::array<float,2>{0.663217306f, 0.278552175f},
-std::array<float,2>{0.0397484899f, 0.0465498306f},
-std::array<float,2>{0.764170885f, 0.550307453f},
-std::array<float,2>{0.183990195f, 0.685271978f},
-std::array<float,2>{0.999973059f, 0.191442385f},
-std::array<float,2>{0.345483243f, 0.384078473f},
-std::array<float,2>{0.552788734f, 0.968470335f},
-std::array<float,2>{0.25746718f, 0.597322464f},
-std::array<float,2>{0.593346f, 0.107192121f},
-std::array<float,2>{0.240713194f, 0.316347301f},
-std::array<float,2>{0.90732348f, 0.756354272f},
-std::array<float,2>{0.0751512498f, 0.935226142f},
-std::array<float,2>{0.826194704f, 0.468038291f},
-std::array<float,2>{0.498723119f, 0.152436063f},
-std::array<float,2>{0.742312789f, 0.723832786f},
-std::array<float,2>{0.258814603f, 0.834750414f},
-std::array<float,2>{0.581245601f, 0.257607579f},
-std::array<float,2>{0.244092375f, 0.0593912303f},
-std::array<float,2>{0.921307862f, 0.542484045f},
-std::array<float,2>{0.0637765899f, 0.665315986f},
-std::array<float,2>{0.816264808f, 0.213390812f},
-std::array<float,2>{0.491817981f, 0.399033099f},
-std::array<float,2>{0.738320708f, 0.947463572f},
-std::array<float,2>{0.419988036f, 0.622745156f},
-std::array<float,2>{0.668031394f, 0.116547577f},
-std::array<float,2>{0.0337869003f, 0.330979288f},
-std::array<float,2>{0.750709236f, 0.769244432f},
-std::array<float,2>{0.172152013f, 0.918424308f},
-std::array<float,2>{0.989280403f, 0.439597756f},
-std::array<float,2>{0.356803447f, 0.136734709f},
-std::array<float,2>{0.56211102f, 0.739601731f},
-std::array<float,2>{0.462236971f, 0.983035028f},
-std::array<float,2>{0.695371211f, 0.408581853f},
-std::array<float,2>{0.10192012f, 0.249078736f},
-std::array<float,2>{0.861218154f, 0.648160398f},
-std::array<float,2>{0.211897016f, 0.512429595f},
-std::array<float,2>{0.889044523f, 0.00645326683f},
-std::array<float,2>{0.303816587f, 0.304292113f},
-std::array<float,2>{0.605609417f, 0.847420573f},
-std::array<float,2>{0.328343868f, 0.693664491f},
-std::array<float,2>{0.505663633f, 0.17610915f},
-std::array<float,2>{0.136459857f, 0.490944386f},
-std::array<float,2>{0.947584033f, 0.881981134f},
-std::array<float,2>{0.000197140485f, 0.811195612f},
-std::array<float,2>{0.800516605f, 0.364851117f},
-std::array<float,2>{0.395556569f, 0.0896434784f},
-std::array<float,2>{0.651754439f, 0.578806698f},
-std::array<float,2>{0.366235733f, 0.893502951f},
-std::array<float,2>{0.538926125f, 0.479702413f},
-std::array<float,2>{0.167438284f, 0.161680833f},
-std::array<float,2>{0.979301333f, 0.709378839f},
-std::array<float,2>{0.0577140637f, 0.568961084f},
-std::array<float,2>{0.773908734f, 0.0679483041f},
-std::array<float,2>{0.434340388f, 0.352626741f},
-std::array<float,2>{0.682553649f, 0.793787062f},
-std::array<float,2>{0.476753592f, 0.63463223f},
-std::array<float,2>{0.729079068f, 0.229538202f},
-std::array<float,2>{0.0831037611f, 0.434290558f},
-std::array<float,2>{0.830646336f, 0.99117893f},
-std::array<float,2>{0.231858507f, 0.860554934f},
-std::array<float,2>{0.937489688f, 0.289431632f},
-std::array<float,2>{0.26618275f, 0.0263640787f},
-std::array<float,2>{0.574369788f, 0.526141822f},
-std::array<float,2>{0.385186791f, 0.753667295f},
-std::array<float,2>{0.63718468f, 0.319285035f},
-std::array<float,2>{0.0208754893f, 0.1027885f},
-std::array<float,2>{0.794609249f, 0.599401832f},
-std::array<float,2>{0.149567306f, 0.721203744f},
-std::array<float,2>{0.955462277f, 0.149719283f},
-std::array<float,2>{0.326992095f, 0.46159029f},
-std::array<float,2>{0.531038582f, 0.930209816f},
-std::array<float,2>{0.289413959f, 0.554475963f},
-std::array<float,2>{0.614809275f, 0.0394471288f},
-std::array<float,2>{0.188565239f, 0.275018305f},
-std::array<float,2>{0.905938745f, 0.816553235f},
-std::array<float,2>{0.112325162f, 0.964320302f},
-std::array<float,2>{0.845974982f, 0.386917502f},
-std::array<float,2>{0.44482848f, 0.191214561f},
-std::array<float,2>{0.714799583f, 0.682165384f},
-std::array<float,2>{0.319853753f, 0.783015609f},
-std::array<float,2>{0.5166381f, 0.344157785f},
-std::array<float,2>{0.142421976f, 0.0744795054f},
-std::array<float,2>{0.963181973f, 0.57336539f},
-std::array<float,2>{0.0256835129f, 0.717464268f},
-std::array<float,2>{0.783268154f, 0.168645635f},
-std::array<float,2>{0.381831735f, 0.474126965f},
-std::array<float,2>{0.626577377f, 0.901924491f},
-std::array<float,2>{0.451489061f, 0.51957953f},
-std::array<float,2>{0.706539869f, 0.0175610147f},
-std::array<float,2>{0.119649954f, 0.286643565f},
-std::array<float,2>{0.853283346f, 0.868327856f},
-std::array<float,2>{0.200454533f, 0.993498981f},
-std::array<float,2>{0.896724105f, 0.422974974f},
-std::array<float,2>{0.285568774f, 0.226410523f},
-std::array<float,2>{0.624425471f, 0.626051545f},
-std::array<float,2>{0.422121167f, 0.9233464f},
-std::array<float,2>{0.676692188f, 0.459682614f},
-std::array<float,2>{0.0539818443f, 0.147958025f},
-std::array<float,2>{0.76660639f, 0.731643915f},
-std::array<float,2>{0.157263085f, 0.604208112f},
-std::array<float,2>{0.971259415f, 0.097169213f},
-std::array<float,2>{0.372629672f, 0.32261765f},
-std::array<float,2>{0.544959486f, 0.761272192f},
-std::array<float,2>{0.280792803f, 0.674371004f},
-std::array<float,2>{0.570100665f, 0.202484474f},
-std::array<float,2>{0.225183666f, 0.375586331f},
-std::array<float,2>{0.926401377f, 0.95538646f},
-std::array<float,2>{0.0929020643f, 0.823565841f},
-std::array<float,2>{0.843365848f, 0.272867978f},
-std::array<float,2>{0.469716549f, 0.0333852284f},
-std::array<float,2>{0.718842268f, 0.555860996f},
-std::array<float,2>{0.309630841f, 0.938508749f},
-std::array<float,2>{0.60088104f, 0.397669077f},
-std::array<float,2>{0.204820052f, 0.207669497f},
-std::array<float,2>{0.880995274f, 0.659724951f},
-std::array<float,2>{0.0970924199f, 0.533898234f},
-std::array<float,2>{0.873761833f, 0.0503546335f},
-std::array<float,2>{0.453141987f, 0.259334087f},
-std::array<float,2>{0.690372825f, 0.841069937f},
-std::array<float,2>{0.399259418f, 0.745571196f},
-std::array<float,2>{0.646641314f, 0.125730172f},
-std::array<float,2>{0.0097005479f, 0.44808346f},
-std::array<float,2>{0.807929099f, 0.90713346f},
-std::array<float,2>{0.126431242f, 0.7778005f},
-std::array<float,2>{0.943304479f, 0.342784405f},
-std::array<float,2>{0.340577573f, 0.117330231f},
-std::array<float,2>{0.513670385f, 0.612460554f},
-std::array<float,2>{0.493005931f, 0.853663146f},
-std::array<float,2>{0.749554813f, 0.306962907f},
-std::array<float,2>{0.0715940818f, 0.0118806474f},
-std::array<float,2>{0.821962118f, 0.505332351f},
-std::array<float,2>{0.236163408f, 0.649758458f},
-std::array<float,2>{0.913127244f, 0.237474665f},
-std::array<float,2>{0.253311187f, 0.414818317f},
-std::array<float,2>{0.587555408f, 0.976105034f},
-std::array<float,2>{0.348384678f, 0.59262687f},
-std::array<float,2>{0.548802376f, 0.0842935741f},
-std::array<float,2>{0.18169947f, 0.367783874f},
-std::array<float,2>{0.992988706f, 0.798706889f},
-std::array<float,2>{0.0460049473f, 0.887062311f},
-std::array<float,2>{0.76036799f, 0.494824737f},
-std::array<float,2>{0.407700926f, 0.182879344f},
-std::array<float,2>{0.658548594f, 0.69607985f},
-std::array<float,2>{0.362664998f, 0.836904883f},
-std::array<float,2>{0.532212734f, 0.265104145f},
-std::array<float,2>{0.170886919f, 0.0528618582f},
-std::array<float,2>{0.981916964f, 0.53806895f},
-std::array<float,2>{0.0586319454f, 0.661296725f},
-std::array<float,2>{0.779830039f, 0.20321551f},
-std::array<float,2>{0.430158615f, 0.393587053f},
-std::array<float,2>{0.684319377f, 0.945067465f},
-std::array<float,2>{0.480540007f, 0.615245044f},
-std::array<float,2>{0.732393563f, 0.123434454f},
-std::array<float,2>{0.0811160132f, 0.336013824f},
-std::array<float,2>{0.83339715f, 0.774129629f},
-std::array<float,2>{0.228713155f, 0.911765039f},
-std::array<float,2>{0.932458699f, 0.452310413f},
-std::array<float,2>{0.271431625f, 0.132001832f},
-std::array<float,2>{0.57082212f, 0.746580958f},
-std::array<float,2>{0.38779071f, 0.969989657f},
-std::array<float,2>{0.634414971f, 0.418206692f},
-std::array<float,2>{0.0165358409f, 0.238913611f},
-std::array<float,2>{0.790945947f, 0.655507207f},
-std::array<float,2>{0.152686805f, 0.502507865f},
-std::array<float,2>{0.959381163f, 0.00937523879f},
-std::array<float,2>{0.322479308f, 0.309312433f},
-std::array<float,2>{0.525084078f, 0.858285367f},
-std::array<float,2>{0.294061214f, 0.701245666f},
-std::array<float,2>{0.610947013f, 0.184468821f},
-std::array<float,2>{0.192814916f, 0.498736143f},
-std::array<float,2>{0.90122515f, 0.88464874f},
-std::array<float,2>{0.113856673f, 0.80132854f},
-std::array<float,2>{0.851192236f, 0.371141613f},
-std::array<float,2>{0.440018594f, 0.0783064514f},
-std::array<float,2>{0.717888832f, 0.587089121f},
-std::array<float,2>{0.261784375f, 0.905041337f},
-std::array<float,2>{0.582791746f, 0.472221345f},
-std::array<float,2>{0.248693794f, 0.164590403f},
-std::array<float,2>{0.917390764f, 0.713479042f},
-std::array<float,2>{0.0673184395f, 0.578114331f},
-std::array<float,2>{0.816832781f, 0.0731360987f},
-std::array<float,2>{0.488132834f, 0.349788368f},
-std::array<float,2>{0.738124073f, 0.788428485f},
-std::array<float,2>{0.417014688f, 0.630941749f},
-std::array<float,2>{0.665416241f, 0.219731525f},
-std::array<float,2>{0.035732992f, 0.426744103f},
-std::array<float,2>{0.754368186f, 0.997306228f},
-std::array<float,2>{0.176205859f, 0.873261154f},
-std::array<float,2>{0.984781742f, 0.283168077f},
-std::array<float,2>{0.35275948f, 0.0217010323f},
-std::array<float,2>{0.556241214f, 0.517362475f},
-std::array<float,2>{0.466270894f, 0.764278173f},
-std::array<float,2>{0.70052433f, 0.325581074f},
-std::array<float,2>{0.109261505f, 0.101504959f},
-std::array<float,2>{0.863489568f, 0.607437015f},
-std::array<float,2>{0.218261197f, 0.728376091f},
-std::array<float,2>{0.886163294f, 0.143754229f},
-std::array<float,2>{0.299144804f, 0.456786335f},
-std::array<float,2>{0.604294121f, 0.926711619f},
-std::array<float,2>{0.334242702f, 0.561888099f},
-std::array<float,2>{0.500760436f, 0.0369543247f},
-std::array<float,2>{0.136737555f, 0.26830101f},
-std::array<float,2>{0.950650632f, 0.827885151f},
-std::array<float,2>{0.00553846499f, 0.958329499f},
-std::array<float,2>{0.80397296f, 0.381075561f},
-std::array<float,2>{0.390672237f, 0.19589138f},
-std::array<float,2>{0.654018641f, 0.679572344f},
-std::array<float,2>{0.307687521f, 0.789212704f},
-std::array<float,2>{0.594119966f, 0.357622117f},
-std::array<float,2>{0.209310398f, 0.0641394407f},
-std::array<float,2>{0.875948727f, 0.56493926f},
-std::array<float,2>{0.0986131057f, 0.705631673f},
-std::array<float,2>{0.867777169f, 0.159378335f},
-std::array<float,2>{0.457134277f, 0.482013643f},
-std::array<float,2>{0.693839312f, 0.897379577f},
-std::array<float,2>{0.402503461f, 0.527528822f},
-std::array<float,2>{0.641265273f, 0.0276212394f},
-std::array<float,2>{0.0143220983f, 0.294278264f},
-std::array<float,2>{0.812234581f, 0.865816712f},
-std::array<float,2>{0.13202329f, 0.985297203f},
-std::array<float,2>{0.940997541f, 0.432339519f},
-std::array<float,2>{0.33600232f, 0.233045653f},
-std::array<float,2>{0.509653509f, 0.638892889f},
-std::array<float,2>{0.499994636f, 0.936685503f},
-std::array<float,2>{0.743565857f, 0.465787411f},
-std::array<float,2>{0.0756420493f, 0.15544337f},
-std::array<float,2>{0.82717365f, 0.726133406f},
-std::array<float,2>{0.241560578f, 0.595549047f},
-std::array<float,2>{0.906747401f, 0.108873338f},
-std::array<float,2>{0.255990922f, 0.313850224f},
-std::array<float,2>{0.591859341f, 0.754374683f},
-std::array<float,2>{0.344417423f, 0.685901642f},
-std::array<float,2>{0.554166079f, 0.194279626f},
-std::array<float,2>{0.18539764f, 0.38619411f},
-std::array<float,2>{0.998805642f, 0.966247857f},
-std::array<float,2>{0.0401139073f, 0.81262368f},
-std::array<float,2>{0.765574515f, 0.280037075f},
-std::array<float,2>{0.41207701f, 0.0445352234f},
-std::array<float,2>{0.662959814f, 0.547743142f},
-std::array<float,2>{0.312538892f, 0.94947958f},
-std::array<float,2>{0.521124959f, 0.404425144f},
-std::array<float,2>{0.145695254f, 0.21816127f},
-std::array<float,2>{0.966487169f, 0.671541035f},
-std::array<float,2>{0.0307374131f, 0.54363668f},
-std::array<float,2>{0.786819339f, 0.0571720786f},
-std::array<float,2>{0.378579468f, 0.250387132f},
-std::array<float,2>{0.630000949f, 0.828827262f},
-std::array<float,2>{0.446754009f, 0.737114251f},
-std::array<float,2>{0.707317829f, 0.134604931f},
-std::array<float,2>{0.122022718f, 0.442931056f},
-std::array<float,2>{0.857949615f, 0.917689264f},
-std::array<float,2>{0.196602926f, 0.773285627f},
-std::array<float,2>{0.892956138f, 0.33520487f},
-std::array<float,2>{0.283626407f, 0.112790138f},
-std::array<float,2>{0.617945194f, 0.617189407f},
-std::array<float,2>{0.426045328f, 0.849726439f},
-std::array<float,2>{0.673586607f, 0.298392534f},
-std::array<float,2>{0.0501643606f, 0.00234541763f},
-std::array<float,2>{0.772098601f, 0.508326173f},
-std::array<float,2>{0.160958827f, 0.642571688f},
-std::array<float,2>{0.976200759f, 0.244536713f},
-std::array<float,2>{0.367257595f, 0.410204709f},
-std::array<float,2>{0.542733908f, 0.978251219f},
-std::array<float,2>{0.276915699f, 0.5829041f},
-std::array<float,2>{0.565967321f, 0.0923379883f},
-std::array<float,2>{0.221379057f, 0.36189574f},
-std::array<float,2>{0.924517512f, 0.807865262f},
-std::array<float,2>{0.0868483633f, 0.877249599f},
-std::array<float,2>{0.839133084f, 0.48768571f},
-std::array<float,2>{0.473015338f, 0.17437984f},
-std::array<float,2>{0.72553277f, 0.688840806f},
-std::array<float,2>{0.266948819f, 0.861884713f},
-std::array<float,2>{0.575344265f, 0.292778671f},
-std::array<float,2>{0.230890095f, 0.0244949181f},
-std::array<float,2>{0.935691833f, 0.525010228f},
-std::array<float,2>{0.082821019f, 0.636401415f},
-std::array<float,2>{0.831225753f, 0.227929935f},
-std::array<float,2>{0.477868855f, 0.437188059f},
-std::array<float,2>{0.730059743f, 0.989249706f},
-std::array<float,2>{0.435114294f, 0.567860961f},
-std::array<float,2>{0.683066785f, 0.0692862645f},
-std::array<float,2>{0.0574228913f, 0.354345292f},
-std::array<float,2>{0.774554491f, 0.796295643f},
-std::array<float,2>{0.166145578f, 0.8912462f},
-std::array<float,2>{0.980280399f, 0.476943731f},
-std::array<float,2>{0.365911663f, 0.162653431f},
-std::array<float,2>{0.537635386f, 0.70762521f},
-std::array<float,2>{0.4442029f, 0.961153805f},
-std::array<float,2>{0.712929606f, 0.38876316f},
-std::array<float,2>{0.111877076f, 0.189347699f},
-std::array<float,2>{0.846853554f, 0.680631399f},
-std::array<float,2>{0.18783091f, 0.551854849f},
-std::array<float,2>{0.904891193f, 0.0424026065f},
-std::array<float,2>{0.290298492f, 0.276174635f},
-std::array<float,2>{0.61359942f, 0.819072425f},
-std::array<float,2>{0.327558845f, 0.719334841f},
-std::array<float,2>{0.529673398f, 0.151689678f},
-std::array<float,2>{0.148766965f, 0.463741839f},
-std::array<float,2>{0.956266642f, 0.932822466f},
-std::array<float,2>{0.0198712628f, 0.750438571f},
-std::array<float,2>{0.79321897f, 0.317307144f},
-std::array<float,2>{0.386530906f, 0.105222933f},
-std::array<float,2>{0.638655782f, 0.59967798f},
-std::array<float,2>{0.355755508f, 0.921575665f},
-std::array<float,2>{0.561380923f, 0.438534766f},
-std::array<float,2>{0.173217684f, 0.139754131f},
-std::array<float,2>{0.988628328f, 0.740252495f},
-std::array<float,2>{0.0342960805f, 0.62361896f},
-std::array<float,2>{0.751741767f, 0.114899479f},
-std::array<float,2>{0.420902342f, 0.32982105f},
-std::array<float,2>{0.669252872f, 0.766286135f},
-std::array<float,2>{0.490775198f, 0.666480362f},
-std::array<float,2>{0.74013865f, 0.212572083f},
-std::array<float,2>{0.062637426f, 0.400979519f},
-std::array<float,2>{0.815089464f, 0.94580394f},
-std::array<float,2>{0.242710635f, 0.83273226f},
-std::array<float,2>{0.920094252f, 0.254089534f},
-std::array<float,2>{0.257990211f, 0.0611210167f},
-std::array<float,2>{0.580500007f, 0.540580511f},
-std::array<float,2>{0.39473483f, 0.80910486f},
-std::array<float,2>{0.650870562f, 0.365403742f},
-std::array<float,2>{0.0016378623f, 0.0860572979f},
-std::array<float,2>{0.799729168f, 0.580756724f},
-std::array<float,2>{0.135611683f, 0.693030059f},
-std::array<float,2>{0.94902426f, 0.177802578f},
-std::array<float,2>{0.329214036f, 0.488630593f},
-std::array<float,2>{0.504300177f, 0.879359961f},
-std::array<float,2>{0.302957833f, 0.515027761f},
-std::array<float,2>{0.606904924f, 0.00431758864f},
-std::array<float,2>{0.212774694f, 0.302185714f},
-std::array<float,2>{0.890609264f, 0.845590293f},
-std::array<float,2>{0.103307776f, 0.981595695f},
-std::array<float,2>{0.859409809f, 0.408023834f},
-std::array<float,2>{0.461282939f, 0.24698624f},
-std::array<float,2>{0.697064996f, 0.646141231f},
-std::array<float,2>{0.340878308f, 0.780921638f},
-std::array<float,2>{0.512354434f, 0.340533555f},
-std::array<float,2>{0.125454992f, 0.119247645f},
-std::array<float,2>{0.941855073f, 0.609673917f},
-std::array<float,2>{0.00855267793f, 0.742747843f},
-std::array<float,2>{0.806781471f, 0.127615139f},
-std::array<float,2>{0.400366575f, 0.446993738f},
-std::array<float,2>{0.648413599f, 0.909986258f},
-std::array<float,2>{0.454454243f, 0.532437503f},
-std::array<float,2>{0.691147029f, 0.0485622063f},
-std::array<float,2>{0.0961071923f, 0.26036194f},
-std::array<float,2>{0.874611437f, 0.843512714f},
-std::array<float,2>{0.203535244f, 0.940895855f},
-std::array<float,2>{0.882294595f, 0.396290004f},
-std::array<float,2>{0.309117287f, 0.210023388f},
-std::array<float,2>{0.60013485f, 0.657975495f},
-std::array<float,2>{0.406793088f, 0.889632404f},
-std::array<float,2>{0.659609914f, 0.492697597f},
-std::array<float,2>{0.0454108492f, 0.180500075f},
-std::array<float,2>{0.761276424f, 0.697360933f},
-std::array<float,2>{0.183341637f, 0.590370655f},
-std::array<float,2>{0.993167698f, 0.0835825577f},
-std::array<float,2>{0.349515259f, 0.370897859f},
-std::array<float,2>{0.546919405f, 0.800413311f},
-std::array<float,2>{0.252522141f, 0.652097642f},
-std::array<float,2>{0.586367905f, 0.234519318f},
-std::array<float,2>{0.235296518f, 0.417853892f},
-std::array<float,2>{0.912918091f, 0.973457634f},
-std::array<float,2>{0.0704741552f, 0.852714479f},
-std::array<float,2>{0.820415854f, 0.30520609f},
-std::array<float,2>{0.493594646f, 0.0144570824f},
-std::array<float,2>{0.74821502f, 0.507761538f},
-std::array<float,2>{0.28699708f, 0.995929658f},
-std::array<float,2>{0.623160183f, 0.4243581f},
-std::array<float,2>{0.199338272f, 0.222958699f},
-std::array<float,2>{0.897720397f, 0.627981246f},
-std::array<float,2>{0.121031292f, 0.523015678f},
-std::array<float,2>{0.852377772f, 0.0181418266f},
-std::array<float,2>{0.452641219f, 0.288251132f},
-std::array<float,2>{0.705268145f, 0.870785713f},
-std::array<float,2>{0.382801086f, 0.716273129f},
-std::array<float,2>{0.625294328f, 0.170695722f},
-std::array<float,2>{0.0264851153f, 0.474918306f},
-std::array<float,2>{0.784335732f, 0.899797916f},
-std::array<float,2>{0.141134202f, 0.783495247f},
-std::array<float,2>{0.964326382f, 0.346063197f},
-std::array<float,2>{0.319095761f, 0.0770561248f},
-std::array<float,2>{0.516167521f, 0.570962846f},
-std::array<float,2>{0.470024645f, 0.820356429f},
-std::array<float,2>{0.720187664f, 0.270313978f},
-std::array<float,2>{0.0924416259f, 0.0315294527f},
-std::array<float,2>{0.842707694f, 0.556794465f},
-std::array<float,2>{0.225679249f, 0.672728479f},
-std::array<float,2>{0.926830232f, 0.199332327f},
-std::array<float,2>{0.279349446f, 0.37737906f},
-std::array<float,2>{0.568583965f, 0.953326046f},
-std::array<float,2>{0.37190935f, 0.602700472f},
-std::array<float,2>{0.546400726f, 0.093770586f},
-std::array<float,2>{0.157180429f, 0.321543843f},
-std::array<float,2>{0.972613871f, 0.759267688f},
-std::array<float,2>{0.0527593195f, 0.923882365f},
-std::array<float,2>{0.766266167f, 0.457981348f},
-std::array<float,2>{0.422894686f, 0.145730674f},
-std::array<float,2>{0.677677929f, 0.73414582f},
-std::array<float,2>{0.321559668f, 0.856622875f},
-std::array<float,2>{0.526051939f, 0.311035395f},
-std::array<float,2>{0.156226277f, 0.0106460145f},
-std::array<float,2>{0.957041204f, 0.500933111f},
-std::array<float,2>{0.0188480448f, 0.652371287f},
-std::array<float,2>{0.791569591f, 0.241976529f},
-std::array<float,2>{0.388926268f, 0.420252085f},
-std::array<float,2>{0.63596046f, 0.972517669f},
-std::array<float,2>{0.439239949f, 0.589198947f},
-std::array<float,2>{0.715063214f, 0.0817667395f},
-std::array<float,2>{0.116533987f, 0.373744965f},
-std::array<float,2>{0.848951459f, 0.804256618f},
-std::array<float,2>{0.193537459f, 0.885071456f},
-std::array<float,2>{0.899122357f, 0.496106595f},
-std::array<float,2>{0.295395017f, 0.186273098f},
-std::array<float,2>{0.612287641f, 0.701074898f},
-std::array<float,2>{0.432415545f, 0.9415344f},
-std::array<float,2>{0.686610699f, 0.391376913f},
-std::array<float,2>{0.0622325316f, 0.205759168f},
-std::array<float,2>{0.778288484f, 0.663107038f},
-std::array<float,2>{0.169382438f, 0.535466135f},
-std::array<float,2>{0.98287642f, 0.0518141836f},
-std::array<float,2>{0.359989226f, 0.261974722f},
-std::array<float,2>{0.534806848f, 0.839252353f},
-std::array<float,2>{0.273356974f, 0.748892725f},
-std::array<float,2>{0.573243797f, 0.129690647f},
-std::array<float,2>{0.226776242f, 0.449402094f},
-std::array<float,2>{0.929923356f, 0.913963497f},
-std::array<float,2>{0.0794583037f, 0.775603175f},
-std::array<float,2>{0.834183455f, 0.338154227f},
-std::array<float,2>{0.484229684f, 0.121321887f},
-std::array<float,2>{0.732508957f, 0.61474365f},
-std::array<float,2>{0.29814741f, 0.92803216f},
-std::array<float,2>{0.601784348f, 0.45326677f},
-std::array<float,2>{0.216525033f, 0.141952544f},
-std::array<float,2>{0.883735955f, 0.728987277f},
-std::array<float,2>{0.107232161f, 0.606403708f},
-std::array<float,2>{0.865961313f, 0.09772861f},
-std::array<float,2>{0.468263596f, 0.327534735f},
-std::array<float,2>{0.702830553f, 0.763426363f},
-std::array<float,2>{0.39297086f, 0.676268101f},
-std::array<float,2>{0.655710697f, 0.199160621f},
-std::array<float,2>{0.00769444834f, 0.379517794f},
-std::array<float,2>{0.802507162f, 0.960385323f},
-std::array<float,2>{0.139406964f, 0.824559987f},
-std::array<float,2>{0.95151341f, 0.266808897f},
-std::array<float,2>{0.333694756f, 0.0388527997f},
-std::array<float,2>{0.502064049f, 0.559832752f},
-std::array<float,2>{0.486274391f, 0.787007213f},
-std::array<float,2>{0.734492719f, 0.347823858f},
-std::array<float,2>{0.0684057847f, 0.0720336959f},
-std::array<float,2>{0.81966126f, 0.575630248f},
-std::array<float,2>{0.247995764f, 0.71130079f},
-std::array<float,2>{0.915363729f, 0.167762622f},
-std::array<float,2>{0.264559984f, 0.46998921f},
-std::array<float,2>{0.585885644f, 0.902747929f},
-std::array<float,2>{0.355350256f, 0.518305659f},
-std::array<float,2>{0.55771631f, 0.0207235385f},
-std::array<float,2>{0.179564044f, 0.285126537f},
-std::array<float,2>{0.988203108f, 0.87176609f},
-std::array<float,2>{0.0375337675f, 0.999803066f},
-std::array<float,2>{0.757415414f, 0.429425776f},
-std::array<float,2>{0.414150685f, 0.221202239f},
-std::array<float,2>{0.667276561f, 0.630006552f},
-std::array<float,2>{0.254531294f, 0.757061124f},
-std::array<float,2>{0.590338826f, 0.314616978f},
-std::array<float,2>{0.239662081f, 0.105494887f},
-std::array<float,2>{0.909265518f, 0.596419454f},
-std::array<float,2>{0.0778056234f, 0.723091364f},
-std::array<float,2>{0.825662911f, 0.153590083f},
-std::array<float,2>{0.49609834f, 0.467645645f},
-std::array<float,2>{0.745235324f, 0.934193134f},
-std::array<float,2>{0.413692296f, 0.548911572f},
-std::array<float,2>{0.66119951f, 0.0452631526f},
-std::array<float,2>{0.0417190455f, 0.278029442f},
-std::array<float,2>{0.762755454f, 0.815254092f},
-std::array<float,2>{0.186604202f, 0.967020392f},
-std::array<float,2>{0.997430265f, 0.383721918f},
-std::array<float,2>{0.345813006f, 0.192701131f},
-std::array<float,2>{0.550825953f, 0.684398592f},
-std::array<float,2>{0.460682929f, 0.895980239f},
-std::array<float,2>{0.691784918f, 0.483033329f},
-std::array<float,2>{0.101295196f, 0.157025233f},
-std::array<float,2>{0.870399415f, 0.704052329f},
-std::array<float,2>{0.207985699f, 0.56430316f},
-std::array<float,2>{0.878256083f, 0.0654019788f},
-std::array<float,2>{0.306358993f, 0.357295185f},
-std::array<float,2>{0.597554088f, 0.792079568f},
-std::array<float,2>{0.339634925f, 0.636909008f},
-std::array<float,2>{0.51034224f, 0.23063536f},
-std::array<float,2>{0.12952897f, 0.430531859f},
-std::array<float,2>{0.939276397f, 0.987831593f},
-std::array<float,2>{0.0128845703f, 0.863967836f},
-std::array<float,2>{0.810388744f, 0.295756012f},
-std::array<float,2>{0.404832512f, 0.0310563631f},
-std::array<float,2>{0.643377721f, 0.530592263f},
-std::array<float,2>{0.369234025f, 0.978901029f},
-std::array<float,2>{0.539830685f, 0.412819833f},
-std::array<float,2>{0.163157627f, 0.243795067f},
-std::array<float,2>{0.974451184f, 0.644452035f},
-std::array<float,2>{0.0481490567f, 0.510994196f},
-std::array<float,2>{0.770424962f, 0.000106582076f},
-std::array<float,2>{0.429287195f, 0.300055772f},
-std::array<float,2>{0.674758852f, 0.847687423f},
-std::array<float,2>{0.476216316f, 0.690551639f},
-std::array<float,2>{0.724327028f, 0.172078788f},
-std::array<float,2>{0.0879946873f, 0.485947311f},
-std::array<float,2>{0.837793887f, 0.876604438f},
-std::array<float,2>{0.219707459f, 0.804806948f},
-std::array<float,2>{0.922231257f, 0.359665573f},
-std::array<float,2>{0.274593383f, 0.0908546746f},
-std::array<float,2>{0.56356585f, 0.58509016f},
-std::array<float,2>{0.375296801f, 0.831059396f},
-std::array<float,2>{0.631936312f, 0.252105445f},
-std::array<float,2>{0.0291497875f, 0.0554250367f},
-std::array<float,2>{0.788392782f, 0.546799958f},
-std::array<float,2>{0.147960782f, 0.668703079f},
-std::array<float,2>{0.967118502f, 0.216736227f},
-std::array<float,2>{0.31600216f, 0.402767092f},
-std::array<float,2>{0.522054851f, 0.952302635f},
-std::array<float,2>{0.281802803f, 0.62087965f},
-std::array<float,2>{0.62055254f, 0.110640019f},
-std::array<float,2>{0.198281169f, 0.333207786f},
-std::array<float,2>{0.891276598f, 0.770876288f},
-std::array<float,2>{0.124589413f, 0.914698541f},
-std::array<float,2>{0.855606079f, 0.443391234f},
-std::array<float,2>{0.44748494f, 0.136465922f},
-std::array<float,2>{0.710006058f, 0.735246599f},
-std::array<float,2>{0.291594654f, 0.817586064f},
-std::array<float,2>{0.615347505f, 0.274034142f},
-std::array<float,2>{0.191059798f, 0.0405508764f},
-std::array<float,2>{0.902902305f, 0.553474724f},
-std::array<float,2>{0.109996319f, 0.683185518f},
-std::array<float,2>{0.844275951f, 0.190116391f},
-std::array<float,2>{0.442572087f, 0.387910336f},
-std::array<float,2>{0.712226272f, 0.963683128f},
-std::array<float,2>{0.384461254f, 0.597959518f},
-std::array<float,2>{0.639682829f, 0.102130622f},
-std::array<float,2>{0.0229518805f, 0.319433302f},
-std::array<float,2>{0.79525286f, 0.752479136f},
-std::array<float,2>{0.151193619f, 0.931362867f},
-std::array<float,2>{0.953739405f, 0.461930126f},
-std::array<float,2>{0.324454606f, 0.149405912f},
-std::array<float,2>{0.528513968f, 0.721820056f},
-std::array<float,2>{0.47913897f, 0.991352737f},
-std::array<float,2>{0.727371573f, 0.434579521f},
-std::array<float,2>{0.0859081224f, 0.22869128f},
-std::array<float,2>{0.828313589f, 0.633485854f},
-std::array<float,2>{0.233474359f, 0.527018309f},
-std::array<float,2>{0.934487402f, 0.0270084068f},
-std::array<float,2>{0.269403279f, 0.290457428f},
-std::array<float,2>{0.577107668f, 0.859796226f},
-std::array<float,2>{0.363564163f, 0.710645318f},
-std::array<float,2>{0.535927117f, 0.160242498f},
-std::array<float,2>{0.164373085f, 0.478710383f},
-std::array<float,2>{0.977733076f, 0.894465446f},
-std::array<float,2>{0.0547230504f, 0.794329464f},
-std::array<float,2>{0.776376545f, 0.352522999f},
-std::array<float,2>{0.435727507f, 0.0671977699f},
-std::array<float,2>{0.679737687f, 0.569804072f},
-std::array<float,2>{0.331498921f, 0.881073296f},
-std::array<float,2>{0.506802201f, 0.491551667f},
-std::array<float,2>{0.132819191f, 0.176788747f},
-std::array<float,2>{0.946949184f, 0.695200801f},
-std::array<float,2>{0.00239592395f, 0.579748273f},
-std::array<float,2>{0.79741478f, 0.0884529427f},
-std::array<float,2>{0.396678656f, 0.363586038f},
-std::array<float,2>{0.649065673f, 0.811789691f},
-std::array<float,2>{0.46324569f, 0.646769941f},
-std::array<float,2>{0.697329819f, 0.248191833f},
-std::array<float,2>{0.104235977f, 0.409480512f},
-std::array<float,2>{0.862992406f, 0.984017611f},
-std::array<float,2>{0.213275775f, 0.846145093f},
-std::array<float,2>{0.886751354f, 0.303080291f},
-std::array<float,2>{0.302070081f, 0.00749743963f},
-std::array<float,2>{0.607554793f, 0.513587117f},
-std::array<float,2>{0.418551028f, 0.768276274f},
-std::array<float,2>{0.671216667f, 0.331796765f},
-std::array<float,2>{0.0322419293f, 0.116135687f},
-std::array<float,2>{0.753905535f, 0.621362388f},
-std::array<float,2>{0.175657466f, 0.738805056f},
-std::array<float,2>{0.991167605f, 0.137738898f},
-std::array<float,2>{0.357681125f, 0.441000819f},
-std::array<float,2>{0.560046375f, 0.919253469f},
-std::array<float,2>{0.260502398f, 0.541169345f},
-std::array<float,2>{0.578663349f, 0.0601712465f},
-std::array<float,2>{0.245284379f, 0.255924195f},
-std::array<float,2>{0.918781459f, 0.835232854f},
-std::array<float,2>{0.0659409314f, 0.94852978f},
-std::array<float,2>{0.81421268f, 0.399733931f},
-std::array<float,2>{0.488711894f, 0.214042708f},
-std::array<float,2>{0.740973711f, 0.664993823f},
-std::array<float,2>{0.350677162f, 0.79715991f},
-std::array<float,2>{0.549616933f, 0.368311286f},
-std::array<float,2>{0.181551293f, 0.0852766708f},
-std::array<float,2>{0.995662153f, 0.593154788f},
-std::array<float,2>{0.0444204845f, 0.696580231f},
-std::array<float,2>{0.758170247f, 0.18251501f},
-std::array<float,2>{0.408656567f, 0.49552238f},
-std::array<float,2>{0.657631338f, 0.888242662f},
-std::array<float,2>{0.494611859f, 0.504402578f},
-std::array<float,2>{0.747048318f, 0.0131943757f},
-std::array<float,2>{0.0731220692f, 0.308000147f},
-std::array<float,2>{0.823277354f, 0.854544878f},
-std::array<float,2>{0.237120524f, 0.975486457f},
-std::array<float,2>{0.910240293f, 0.415902644f},
-std::array<float,2>{0.251652628f, 0.236964196f},
-std::array<float,2>{0.588162243f, 0.648964882f},
-std::array<float,2>{0.401889324f, 0.907818675f},
-std::array<float,2>{0.644987762f, 0.448320776f},
-std::array<float,2>{0.0107760774f, 0.126667365f},
-std::array<float,2>{0.806260169f, 0.744618356f},
-std::array<float,2>{0.127549678f, 0.612276793f},
-std::array<float,2>{0.944007814f, 0.11898341f},
-std::array<float,2>{0.342693835f, 0.341882139f},
-std::array<float,2>{0.514908314f, 0.778500617f},
-std::array<float,2>{0.31245786f, 0.658629417f},
-std::array<float,2>{0.599333405f, 0.20803009f},
-std::array<float,2>{0.206145272f, 0.397184134f},
-std::array<float,2>{0.879945636f, 0.937829852f},
-std::array<float,2>{0.0945852548f, 0.840790093f},
-std::array<float,2>{0.871501684f, 0.257891268f},
-std::array<float,2>{0.455715418f, 0.0496774763f},
-std::array<float,2>{0.687910259f, 0.534193158f},
-std::array<float,2>{0.277748764f, 0.956213236f},
-std::array<float,2>{0.568204403f, 0.376906842f},
-std::array<float,2>{0.223944798f, 0.20147559f},
-std::array<float,2>{0.928944528f, 0.67560333f},
-std::array<float,2>{0.0915024504f, 0.555143297f},
-std::array<float,2>{0.840610802f, 0.0343660377f},
-std::array<float,2>{0.472115278f, 0.272174627f},
-std::array<float,2>{0.721060514f, 0.82309866f},
-std::array<float,2>{0.424702436f, 0.73067522f},
-std::array<float,2>{0.678621769f, 0.147053599f},
-std::array<float,2>{0.0523551553f, 0.460885882f},
-std::array<float,2>{0.769525528f, 0.922555089f},
-std::array<float,2>{0.158449307f, 0.760181069f},
-std::array<float,2>{0.969766676f, 0.324187934f},
-std::array<float,2>{0.373558164f, 0.0957932174f},
-std::array<float,2>{0.54352051f, 0.604926884f},
-std::array<float,2>{0.450682521f, 0.867366016f},
-std::array<float,2>{0.70380497f, 0.286015362f},
-std::array<float,2>{0.118329711f, 0.0163148642f},
-std::array<float,2>{0.854999483f, 0.52064693f},
-std::array<float,2>{0.202117532f, 0.625372112f},
-std::array<float,2>{0.896195889f, 0.224841654f},
-std::array<float,2>{0.288319677f, 0.422385752f},
-std::array<float,2>{0.621889651f, 0.992451251f},
-std::array<float,2>{0.31745857f, 0.572290003f},
-std::array<float,2>{0.518755794f, 0.0752709135f},
-std::array<float,2>{0.144137979f, 0.345608473f},
-std::array<float,2>{0.961227179f, 0.782033682f},
-std::array<float,2>{0.0250582192f, 0.900547981f},
-std::array<float,2>{0.783178389f, 0.47285226f},
-std::array<float,2>{0.379577905f, 0.169700921f},
-std::array<float,2>{0.628554046f, 0.718710542f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.239653483f, 0.0096604703f},
-std::array<float,2>{0.979572296f, 0.514862537f},
-std::array<float,2>{0.567210734f, 0.425628453f},
-std::array<float,2>{0.31926924f, 0.785143316f},
-std::array<float,2>{0.406193495f, 0.299378365f},
-std::array<float,2>{0.639693856f, 0.924537361f},
-std::array<float,2>{0.805186868f, 0.191402927f},
-std::array<float,2>{0.0547266155f, 0.706567228f},
-std::array<float,2>{0.123189911f, 0.489545077f},
-std::array<float,2>{0.860042095f, 0.863703847f},
-std::array<float,2>{0.726658642f, 0.082845822f},
-std::array<float,2>{0.47492376f, 0.583570778f},
-std::array<float,2>{0.270860225f, 0.167473778f},
-std::array<float,2>{0.500375688f, 0.670206606f},
-std::array<float,2>{0.883978307f, 0.321686357f},
-std::array<float,2>{0.151502103f, 0.954446912f},
-std::array<float,2>{0.0298719909f, 0.247097865f},
-std::array<float,2>{0.762628376f, 0.729764938f},
-std::array<float,2>{0.656331122f, 0.260767937f},
-std::array<float,2>{0.43354407f, 0.891468227f},
-std::array<float,2>{0.371450186f, 0.393157452f},
-std::array<float,2>{0.595703483f, 0.7686975f},
-std::array<float,2>{0.953423202f, 0.0406815931f},
-std::array<float,2>{0.207802877f, 0.556302905f},
-std::array<float,2>{0.156671539f, 0.365307778f},
-std::array<float,2>{0.918247521f, 0.979072332f},
-std::array<float,2>{0.532760262f, 0.126774296f},
-std::array<float,2>{0.308591753f, 0.647225201f},
-std::array<float,2>{0.467571497f, 0.0995096117f},
-std::array<float,2>{0.70690161f, 0.61538583f},
-std::array<float,2>{0.82893163f, 0.452184856f},
-std::array<float,2>{0.080403693f, 0.83186847f},
-std::array<float,2>{0.134249881f, 0.148646131f},
-std::array<float,2>{0.904333353f, 0.627433777f},
-std::array<float,2>{0.520036697f, 0.35205248f},
-std::array<float,2>{0.264247656f, 0.993992746f},
-std::array<float,2>{0.489378989f, 0.45728749f},
-std::array<float,2>{0.735603929f, 0.824790537f},
-std::array<float,2>{0.848464787f, 0.124503285f},
-std::array<float,2>{0.0952370539f, 0.605299115f},
-std::array<float,2>{0.0437525101f, 0.269642442f},
-std::array<float,2>{0.781450391f, 0.882356942f},
-std::array<float,2>{0.652027369f, 0.220447391f},
-std::array<float,2>{0.378385216f, 0.735802054f},
-std::array<float,2>{0.332304001f, 0.0472577773f},
-std::array<float,2>{0.590808868f, 0.534904361f},
-std::array<float,2>{0.998718321f, 0.376077652f},
-std::array<float,2>{0.222800106f, 0.755641818f},
-std::array<float,2>{0.0632796288f, 0.0671625361f},
-std::array<float,2>{0.825876236f, 0.573340833f},
-std::array<float,2>{0.688761711f, 0.469841927f},
-std::array<float,2>{0.447850913f, 0.854898334f},
-std::array<float,2>{0.294496298f, 0.328562379f},
-std::array<float,2>{0.550106943f, 0.938546658f},
-std::array<float,2>{0.922588706f, 0.18599087f},
-std::array<float,2>{0.182466045f, 0.685779512f},
-std::array<float,2>{0.202842206f, 0.416418582f},
-std::array<float,2>{0.94579798f, 0.811276376f},
-std::array<float,2>{0.610163093f, 0.0283674933f},
-std::array<float,2>{0.353383005f, 0.516015589f},
-std::array<float,2>{0.411886752f, 0.207185343f},
-std::array<float,2>{0.679636955f, 0.700475216f},
-std::array<float,2>{0.765815139f, 0.283680081f},
-std::array<float,2>{0.00593811693f, 0.920092881f},
-std::array<float,2>{0.178708076f, 0.110705301f},
-std::array<float,2>{0.936055303f, 0.600391269f},
-std::array<float,2>{0.559707105f, 0.462397546f},
-std::array<float,2>{0.284957319f, 0.816623569f},
-std::array<float,2>{0.441656262f, 0.344435304f},
-std::array<float,2>{0.702896178f, 0.985791028f},
-std::array<float,2>{0.81391108f, 0.142810434f},
-std::array<float,2>{0.075276494f, 0.640112698f},
-std::array<float,2>{0.00984984823f, 0.383107305f},
-std::array<float,2>{0.777733684f, 0.76237154f},
-std::array<float,2>{0.684192181f, 0.0548796803f},
-std::array<float,2>{0.420847803f, 0.545745254f},
-std::array<float,2>{0.348490745f, 0.228035033f},
-std::array<float,2>{0.624710917f, 0.745007277f},
-std::array<float,2>{0.945018649f, 0.277519047f},
-std::array<float,2>{0.188524827f, 0.883467019f},
-std::array<float,2>{0.102252662f, 0.176362455f},
-std::array<float,2>{0.8517946f, 0.677659035f},
-std::array<float,2>{0.748323619f, 0.33678183f},
-std::array<float,2>{0.497498542f, 0.946744204f},
-std::array<float,2>{0.25472796f, 0.477437288f},
-std::array<float,2>{0.52905041f, 0.848921955f},
-std::array<float,2>{0.897176147f, 0.0704725534f},
-std::array<float,2>{0.127949804f, 0.569237888f},
-std::array<float,2>{0.231701761f, 0.290439129f},
-std::array<float,2>{0.990235209f, 0.910768509f},
-std::array<float,2>{0.580697179f, 0.213897094f},
-std::array<float,2>{0.341522664f, 0.692776144f},
-std::array<float,2>{0.382868379f, 0.0174426138f},
-std::array<float,2>{0.641047359f, 0.529081821f},
-std::array<float,2>{0.790837109f, 0.407726526f},
-std::array<float,2>{0.0377039537f, 0.800052643f},
-std::array<float,2>{0.213473529f, 0.198602542f},
-std::array<float,2>{0.961651623f, 0.717272937f},
-std::array<float,2>{0.606223881f, 0.310297728f},
-std::array<float,2>{0.363865316f, 0.934455335f},
-std::array<float,2>{0.423795164f, 0.435663283f},
-std::array<float,2>{0.666184843f, 0.789558291f},
-std::array<float,2>{0.752614975f, 0.00120142906f},
-std::array<float,2>{0.0161111802f, 0.50106144f},
-std::array<float,2>{0.0900058076f, 0.312772393f},
-std::array<float,2>{0.843423605f, 0.964944839f},
-std::array<float,2>{0.712484539f, 0.162256509f},
-std::array<float,2>{0.459367484f, 0.659454167f},
-std::array<float,2>{0.297134787f, 0.0915063694f},
-std::array<float,2>{0.541047335f, 0.590516865f},
-std::array<float,2>{0.91332835f, 0.498403519f},
-std::array<float,2>{0.170197383f, 0.87386632f},
-std::array<float,2>{0.0492654182f, 0.0319107771f},
-std::array<float,2>{0.799975872f, 0.550795794f},
-std::array<float,2>{0.626697779f, 0.398892283f},
-std::array<float,2>{0.392504394f, 0.775862753f},
-std::array<float,2>{0.323748857f, 0.25729689f},
-std::array<float,2>{0.573924541f, 0.90501529f},
-std::array<float,2>{0.969162107f, 0.235113978f},
-std::array<float,2>{0.248700738f, 0.723849237f},
-std::array<float,2>{0.141843081f, 0.438161254f},
-std::array<float,2>{0.877189815f, 0.839780569f},
-std::array<float,2>{0.512471259f, 0.10666734f},
-std::array<float,2>{0.275936723f, 0.61883992f},
-std::array<float,2>{0.476927549f, 0.136122689f},
-std::array<float,2>{0.718759716f, 0.65211606f},
-std::array<float,2>{0.874393165f, 0.369063139f},
-std::array<float,2>{0.110732272f, 0.971962571f},
-std::array<float,2>{0.154749647f, 0.0605625622f},
-std::array<float,2>{0.887365818f, 0.539086103f},
-std::array<float,2>{0.50538522f, 0.389972627f},
-std::array<float,2>{0.268224001f, 0.759816885f},
-std::array<float,2>{0.47243163f, 0.274938405f},
-std::array<float,2>{0.732209742f, 0.889049649f},
-std::array<float,2>{0.866145968f, 0.233432516f},
-std::array<float,2>{0.119259469f, 0.748552084f},
-std::array<float,2>{0.0596926883f, 0.467220843f},
-std::array<float,2>{0.81117785f, 0.814044237f},
-std::array<float,2>{0.633508444f, 0.114036344f},
-std::array<float,2>{0.399153978f, 0.594990373f},
-std::array<float,2>{0.313274145f, 0.146340325f},
-std::array<float,2>{0.563997626f, 0.63623172f},
-std::array<float,2>{0.982957184f, 0.347995788f},
-std::array<float,2>{0.234585866f, 0.988453567f},
-std::array<float,2>{0.0838998705f, 0.216097534f},
-std::array<float,2>{0.832318842f, 0.689712346f},
-std::array<float,2>{0.707606494f, 0.294969261f},
-std::array<float,2>{0.463578343f, 0.90914458f},
-std::array<float,2>{0.308668882f, 0.413483948f},
-std::array<float,2>{0.535276771f, 0.80180949f},
-std::array<float,2>{0.916922271f, 0.0205704905f},
-std::array<float,2>{0.160456106f, 0.527338624f},
-std::array<float,2>{0.203167424f, 0.34180066f},
-std::array<float,2>{0.96001786f, 0.951154649f},
-std::array<float,2>{0.599496424f, 0.172145531f},
-std::array<float,2>{0.369738191f, 0.672391355f},
-std::array<float,2>{0.434357345f, 0.0775417984f},
-std::array<float,2>{0.661025465f, 0.56543088f},
-std::array<float,2>{0.757840574f, 0.484255284f},
-std::array<float,2>{0.0241576172f, 0.844701469f},
-std::array<float,2>{0.221955732f, 0.156332225f},
-std::array<float,2>{0.993479788f, 0.662118435f},
-std::array<float,2>{0.589663386f, 0.316513091f},
-std::array<float,2>{0.328769207f, 0.964184463f},
-std::array<float,2>{0.382170677f, 0.493259668f},
-std::array<float,2>{0.653876543f, 0.870646656f},
-std::array<float,2>{0.787929893f, 0.0877851844f},
-std::array<float,2>{0.0416196994f, 0.588375509f},
-std::array<float,2>{0.100451767f, 0.308463722f},
-std::array<float,2>{0.844560623f, 0.932992399f},
-std::array<float,2>{0.74184823f, 0.200305641f},
-std::array<float,2>{0.487536937f, 0.711284459f},
-std::array<float,2>{0.261102498f, 0.00754956622f},
-std::array<float,2>{0.518606007f, 0.505276918f},
-std::array<float,2>{0.901057959f, 0.431999058f},
-std::array<float,2>{0.139126182f, 0.793816507f},
-std::array<float,2>{0.00116090453f, 0.10248366f},
-std::array<float,2>{0.772082984f, 0.6249879f},
-std::array<float,2>{0.673495948f, 0.443779826f},
-std::array<float,2>{0.408531547f, 0.843687892f},
-std::array<float,2>{0.358231157f, 0.371683449f},
-std::array<float,2>{0.616015673f, 0.973770797f},
-std::array<float,2>{0.949807048f, 0.137455881f},
-std::array<float,2>{0.197376072f, 0.652459025f},
-std::array<float,2>{0.186806887f, 0.405445129f},
-std::array<float,2>{0.927237988f, 0.77889967f},
-std::array<float,2>{0.553314626f, 0.0389191136f},
-std::array<float,2>{0.291955233f, 0.547375739f},
-std::array<float,2>{0.450376272f, 0.241329774f},
-std::array<float,2>{0.69525528f, 0.720984757f},
-std::array<float,2>{0.822815299f, 0.250487268f},
-std::array<float,2>{0.0680323243f, 0.901621938f},
-std::array<float,2>{0.191450104f, 0.0806243122f},
-std::array<float,2>{0.94093591f, 0.581237018f},
-std::array<float,2>{0.618685782f, 0.486805141f},
-std::array<float,2>{0.346433163f, 0.862026989f},
-std::array<float,2>{0.417073965f, 0.32547763f},
-std::array<float,2>{0.682471633f, 0.96045506f},
-std::array<float,2>{0.775410235f, 0.168651327f},
-std::array<float,2>{0.0127178468f, 0.666081011f},
-std::array<float,2>{0.0710893422f, 0.426666409f},
-std::array<float,2>{0.816533148f, 0.786326468f},
-std::array<float,2>{0.69768846f, 0.0143046407f},
-std::array<float,2>{0.43996948f, 0.511178255f},
-std::array<float,2>{0.288313031f, 0.192840442f},
-std::array<float,2>{0.556466818f, 0.708886981f},
-std::array<float,2>{0.933124304f, 0.30440709f},
-std::array<float,2>{0.174110368f, 0.928549588f},
-std::array<float,2>{0.0320014507f, 0.130886286f},
-std::array<float,2>{0.79309082f, 0.643130124f},
-std::array<float,2>{0.646575391f, 0.359927893f},
-std::array<float,2>{0.387622207f, 0.983747005f},
-std::array<float,2>{0.337452918f, 0.445638478f},
-std::array<float,2>{0.582640827f, 0.834167659f},
-std::array<float,2>{0.986783743f, 0.0938244462f},
-std::array<float,2>{0.229470357f, 0.61271435f},
-std::array<float,2>{0.131973937f, 0.263125747f},
-std::array<float,2>{0.890691519f, 0.897275388f},
-std::array<float,2>{0.523870409f, 0.243144259f},
-std::array<float,2>{0.252350539f, 0.731819034f},
-std::array<float,2>{0.494954258f, 0.0434851497f},
-std::array<float,2>{0.744638145f, 0.560744107f},
-std::array<float,2>{0.858196139f, 0.39463684f},
-std::array<float,2>{0.109040968f, 0.772172153f},
-std::array<float,2>{0.166198358f, 0.222823873f},
-std::array<float,2>{0.909691334f, 0.739798069f},
-std::array<float,2>{0.544611096f, 0.268979996f},
-std::array<float,2>{0.301125675f, 0.876594365f},
-std::array<float,2>{0.453765601f, 0.381083578f},
-std::array<float,2>{0.715910971f, 0.751459062f},
-std::array<float,2>{0.837795734f, 0.0532426685f},
-std::array<float,2>{0.0879040137f, 0.535793483f},
-std::array<float,2>{0.0196909104f, 0.359307706f},
-std::array<float,2>{0.757629275f, 0.996757805f},
-std::array<float,2>{0.670628726f, 0.153815344f},
-std::array<float,2>{0.425883085f, 0.632500529f},
-std::array<float,2>{0.359684348f, 0.117306165f},
-std::array<float,2>{0.602319896f, 0.606433392f},
-std::array<float,2>{0.964861572f, 0.455805302f},
-std::array<float,2>{0.21633555f, 0.821778476f},
-std::array<float,2>{0.113372356f, 0.0261394214f},
-std::array<float,2>{0.870780468f, 0.519694507f},
-std::array<float,2>{0.726293147f, 0.420471072f},
-std::array<float,2>{0.483501732f, 0.807053506f},
-std::array<float,2>{0.279435366f, 0.288022578f},
-std::array<float,2>{0.509254992f, 0.917051136f},
-std::array<float,2>{0.879538774f, 0.205215678f},
-std::array<float,2>{0.145361379f, 0.698879123f},
-std::array<float,2>{0.245612755f, 0.473434001f},
-std::array<float,2>{0.975185692f, 0.857445419f},
-std::array<float,2>{0.576147914f, 0.0635896772f},
-std::array<float,2>{0.328042299f, 0.574893415f},
-std::array<float,2>{0.397955745f, 0.179947421f},
-std::array<float,2>{0.629457116f, 0.679831266f},
-std::array<float,2>{0.801102161f, 0.334266216f},
-std::array<float,2>{0.053655304f, 0.943110764f},
-std::array<float,2>{0.210924715f, 0.0417537466f},
-std::array<float,2>{0.95585078f, 0.558245957f},
-std::array<float,2>{0.59485507f, 0.390730411f},
-std::array<float,2>{0.37478599f, 0.766434073f},
-std::array<float,2>{0.429884166f, 0.259138137f},
-std::array<float,2>{0.659404814f, 0.893332839f},
-std::array<float,2>{0.764986992f, 0.249583066f},
-std::array<float,2>{0.0288271382f, 0.726829886f},
-std::array<float,2>{0.0796306655f, 0.45081988f},
-std::array<float,2>{0.831195474f, 0.828507364f},
-std::array<float,2>{0.705017388f, 0.100374311f},
-std::array<float,2>{0.466054618f, 0.614447474f},
-std::array<float,2>{0.30527395f, 0.128094748f},
-std::array<float,2>{0.534033358f, 0.645904183f},
-std::array<float,2>{0.920496583f, 0.364366263f},
-std::array<float,2>{0.159067377f, 0.976984859f},
-std::array<float,2>{0.0571134463f, 0.189128339f},
-std::array<float,2>{0.808232486f, 0.703623414f},
-std::array<float,2>{0.637034297f, 0.29695186f},
-std::array<float,2>{0.403773874f, 0.923640907f},
-std::array<float,2>{0.316937804f, 0.423679769f},
-std::array<float,2>{0.569462836f, 0.783114791f},
-std::array<float,2>{0.9773224f, 0.010513762f},
-std::array<float,2>{0.240591183f, 0.512381315f},
-std::array<float,2>{0.148611069f, 0.323023647f},
-std::array<float,2>{0.885034859f, 0.956006289f},
-std::array<float,2>{0.502755582f, 0.164467633f},
-std::array<float,2>{0.271495819f, 0.66921097f},
-std::array<float,2>{0.472967058f, 0.0857991353f},
-std::array<float,2>{0.730440497f, 0.585387349f},
-std::array<float,2>{0.862564266f, 0.491883248f},
-std::array<float,2>{0.121515051f, 0.86642015f},
-std::array<float,2>{0.180223584f, 0.185312897f},
-std::array<float,2>{0.924957573f, 0.685302079f},
-std::array<float,2>{0.548658907f, 0.330411702f},
-std::array<float,2>{0.296514779f, 0.940554619f},
-std::array<float,2>{0.446447402f, 0.471045852f},
-std::array<float,2>{0.690326214f, 0.853208661f},
-std::array<float,2>{0.82765013f, 0.0687391609f},
-std::array<float,2>{0.0648322329f, 0.571003973f},
-std::array<float,2>{0.0056942841f, 0.281264216f},
-std::array<float,2>{0.769163907f, 0.918236196f},
-std::array<float,2>{0.676370263f, 0.210154295f},
-std::array<float,2>{0.412209153f, 0.702170908f},
-std::array<float,2>{0.355383903f, 0.0295386445f},
-std::array<float,2>{0.612686157f, 0.518155873f},
-std::array<float,2>{0.947440863f, 0.41539064f},
-std::array<float,2>{0.20092164f, 0.809799552f},
-std::array<float,2>{0.0976071805f, 0.121360987f},
-std::array<float,2>{0.851372659f, 0.602917016f},
-std::array<float,2>{0.738260984f, 0.459103197f},
-std::array<float,2>{0.490418553f, 0.827001393f},
-std::array<float,2>{0.262340665f, 0.355202287f},
-std::array<float,2>{0.521659851f, 0.994487464f},
-std::array<float,2>{0.903342605f, 0.150565401f},
-std::array<float,2>{0.136034369f, 0.625961423f},
-std::array<float,2>{0.226415798f, 0.377084345f},
-std::array<float,2>{0.997163236f, 0.757460475f},
-std::array<float,2>{0.592696846f, 0.0491089039f},
-std::array<float,2>{0.335721731f, 0.53178978f},
-std::array<float,2>{0.37675193f, 0.222129911f},
-std::array<float,2>{0.649251461f, 0.737986922f},
-std::array<float,2>{0.784428596f, 0.272840321f},
-std::array<float,2>{0.0461458452f, 0.880280733f},
-std::array<float,2>{0.125571311f, 0.0730309933f},
-std::array<float,2>{0.896161616f, 0.567725599f},
-std::array<float,2>{0.530903518f, 0.479555935f},
-std::array<float,2>{0.257447362f, 0.850977659f},
-std::array<float,2>{0.498976797f, 0.339009464f},
-std::array<float,2>{0.746679246f, 0.947890043f},
-std::array<float,2>{0.854578495f, 0.179227233f},
-std::array<float,2>{0.105121233f, 0.6789518f},
-std::array<float,2>{0.0362079293f, 0.409918457f},
-std::array<float,2>{0.792773366f, 0.79879719f},
-std::array<float,2>{0.643447757f, 0.018055534f},
-std::array<float,2>{0.385403246f, 0.530274272f},
-std::array<float,2>{0.343172193f, 0.211223632f},
-std::array<float,2>{0.579170644f, 0.694154799f},
-std::array<float,2>{0.989725947f, 0.291673094f},
-std::array<float,2>{0.234144375f, 0.912164629f},
-std::array<float,2>{0.0777769387f, 0.142298996f},
-std::array<float,2>{0.815534234f, 0.638356149f},
-std::array<float,2>{0.700379431f, 0.347160161f},
-std::array<float,2>{0.444381386f, 0.988099515f},
-std::array<float,2>{0.282839835f, 0.464076459f},
-std::array<float,2>{0.5613572f, 0.819881856f},
-std::array<float,2>{0.934651196f, 0.111807235f},
-std::array<float,2>{0.175888494f, 0.598280549f},
-std::array<float,2>{0.191127121f, 0.279375225f},
-std::array<float,2>{0.942869067f, 0.886517167f},
-std::array<float,2>{0.622346997f, 0.229900897f},
-std::array<float,2>{0.351205021f, 0.743833363f},
-std::array<float,2>{0.418043196f, 0.0573894866f},
-std::array<float,2>{0.685813308f, 0.5433743f},
-std::array<float,2>{0.780401051f, 0.385667592f},
-std::array<float,2>{0.00792581216f, 0.765498221f},
-std::array<float,2>{0.248027906f, 0.237337738f},
-std::array<float,2>{0.971882045f, 0.726425886f},
-std::array<float,2>{0.570813358f, 0.254976571f},
-std::array<float,2>{0.320731312f, 0.903811634f},
-std::array<float,2>{0.393726259f, 0.400468886f},
-std::array<float,2>{0.62699455f, 0.774054885f},
-std::array<float,2>{0.797052801f, 0.034016937f},
-std::array<float,2>{0.0474702939f, 0.553632736f},
-std::array<float,2>{0.112183318f, 0.369200826f},
-std::array<float,2>{0.871393561f, 0.970619559f},
-std::array<float,2>{0.72103256f, 0.134644479f},
-std::array<float,2>{0.479129583f, 0.65036571f},
-std::array<float,2>{0.274397552f, 0.108361296f},
-std::array<float,2>{0.514680862f, 0.620414436f},
-std::array<float,2>{0.876653075f, 0.439560115f},
-std::array<float,2>{0.1444076f, 0.836610734f},
-std::array<float,2>{0.0178405438f, 0.00383885764f},
-std::array<float,2>{0.750888467f, 0.503030419f},
-std::array<float,2>{0.665938377f, 0.434026241f},
-std::array<float,2>{0.424430937f, 0.791140139f},
-std::array<float,2>{0.365613848f, 0.311318785f},
-std::array<float,2>{0.608537912f, 0.935743392f},
-std::array<float,2>{0.963423073f, 0.196187824f},
-std::array<float,2>{0.211900964f, 0.71606189f},
-std::array<float,2>{0.169420809f, 0.496273309f},
-std::array<float,2>{0.911858678f, 0.872811496f},
-std::array<float,2>{0.539883494f, 0.0922076479f},
-std::array<float,2>{0.30062598f, 0.593360305f},
-std::array<float,2>{0.45833835f, 0.161852479f},
-std::array<float,2>{0.714118361f, 0.656588256f},
-std::array<float,2>{0.840427995f, 0.315805227f},
-std::array<float,2>{0.0929898098f, 0.968048394f},
-std::array<float,2>{0.163179576f, 0.0216412153f},
-std::array<float,2>{0.914662898f, 0.523554206f},
-std::array<float,2>{0.53761512f, 0.411289066f},
-std::array<float,2>{0.31240797f, 0.803324819f},
-std::array<float,2>{0.461740196f, 0.294017196f},
-std::array<float,2>{0.710909367f, 0.906774938f},
-std::array<float,2>{0.834247053f, 0.217716932f},
-std::array<float,2>{0.0849975571f, 0.689038992f},
-std::array<float,2>{0.0257838052f, 0.481317222f},
-std::array<float,2>{0.760049462f, 0.846655428f},
-std::array<float,2>{0.66248244f, 0.0743088722f},
-std::array<float,2>{0.436057389f, 0.562989593f},
-std::array<float,2>{0.368248314f, 0.174256459f},
-std::array<float,2>{0.600238383f, 0.67566669f},
-std::array<float,2>{0.958857f, 0.34149915f},
-std::array<float,2>{0.205675542f, 0.952839196f},
-std::array<float,2>{0.118064664f, 0.231249735f},
-std::array<float,2>{0.86375314f, 0.747413397f},
-std::array<float,2>{0.734148443f, 0.276512921f},
-std::array<float,2>{0.470176846f, 0.888333082f},
-std::array<float,2>{0.266769886f, 0.387028992f},
-std::array<float,2>{0.506483257f, 0.75852859f},
-std::array<float,2>{0.888826191f, 0.0602900088f},
-std::array<float,2>{0.153352186f, 0.541723669f},
-std::array<float,2>{0.237938613f, 0.351551086f},
-std::array<float,2>{0.981146514f, 0.990648508f},
-std::array<float,2>{0.565532267f, 0.147112802f},
-std::array<float,2>{0.314832628f, 0.633941591f},
-std::array<float,2>{0.401404977f, 0.11588648f},
-std::array<float,2>{0.636547506f, 0.596856534f},
-std::array<float,2>{0.809530079f, 0.465139449f},
-std::array<float,2>{0.0618572384f, 0.814974725f},
-std::array<float,2>{0.196847171f, 0.140519291f},
-std::array<float,2>{0.95125562f, 0.655817747f},
-std::array<float,2>{0.614862382f, 0.374280781f},
-std::array<float,2>{0.355897337f, 0.976120949f},
-std::array<float,2>{0.407711416f, 0.443120956f},
-std::array<float,2>{0.674259663f, 0.841211975f},
-std::array<float,2>{0.770964324f, 0.105299927f},
-std::array<float,2>{0.00313319778f, 0.621729434f},
-std::array<float,2>{0.0694674179f, 0.253591776f},
-std::array<float,2>{0.821538508f, 0.89984268f},
-std::array<float,2>{0.691978872f, 0.240085945f},
-std::array<float,2>{0.452485293f, 0.720225453f},
-std::array<float,2>{0.289224237f, 0.0361865945f},
-std::array<float,2>{0.550927579f, 0.549298465f},
-std::array<float,2>{0.927884221f, 0.403968245f},
-std::array<float,2>{0.185072795f, 0.780536473f},
-std::array<float,2>{0.0397157073f, 0.089044638f},
-std::array<float,2>{0.786189556f, 0.586661577f},
-std::array<float,2>{0.655350327f, 0.49604097f},
-std::array<float,2>{0.379512191f, 0.868460715f},
-std::array<float,2>{0.332014233f, 0.318989247f},
-std::array<float,2>{0.587851763f, 0.961395621f},
-std::array<float,2>{0.995215178f, 0.158252731f},
-std::array<float,2>{0.21942921f, 0.66123867f},
-std::array<float,2>{0.138510749f, 0.430630416f},
-std::array<float,2>{0.899924815f, 0.796089768f},
-std::array<float,2>{0.517097712f, 0.00418289425f},
-std::array<float,2>{0.258223832f, 0.506925464f},
-std::array<float,2>{0.485953182f, 0.201749802f},
-std::array<float,2>{0.739026189f, 0.714116514f},
-std::array<float,2>{0.847033918f, 0.306043297f},
-std::array<float,2>{0.0979790911f, 0.930046976f},
-std::array<float,2>{0.227466986f, 0.0959434211f},
-std::array<float,2>{0.986196995f, 0.611093223f},
-std::array<float,2>{0.585160553f, 0.449213207f},
-std::array<float,2>{0.339461148f, 0.833586872f},
-std::array<float,2>{0.389971524f, 0.362578422f},
-std::array<float,2>{0.646105349f, 0.981780291f},
-std::array<float,2>{0.795760155f, 0.130722463f},
-std::array<float,2>{0.0351174027f, 0.641822577f},
-std::array<float,2>{0.105557993f, 0.397423178f},
-std::array<float,2>{0.856399f, 0.769812584f},
-std::array<float,2>{0.742982507f, 0.0456945822f},
-std::array<float,2>{0.49388507f, 0.559089661f},
-std::array<float,2>{0.251702249f, 0.245142922f},
-std::array<float,2>{0.526930153f, 0.732478142f},
-std::array<float,2>{0.894296885f, 0.264269173f},
-std::array<float,2>{0.130431756f, 0.89481461f},
-std::array<float,2>{0.0152640799f, 0.170999035f},
-std::array<float,2>{0.775026321f, 0.664413154f},
-std::array<float,2>{0.680154979f, 0.326832563f},
-std::array<float,2>{0.415351301f, 0.95739913f},
-std::array<float,2>{0.344725579f, 0.485180765f},
-std::array<float,2>{0.62044245f, 0.861203253f},
-std::array<float,2>{0.939275622f, 0.0782241598f},
-std::array<float,2>{0.19524397f, 0.578677177f},
-std::array<float,2>{0.1731105f, 0.302266806f},
-std::array<float,2>{0.930995226f, 0.926085234f},
-std::array<float,2>{0.557485938f, 0.195146754f},
-std::array<float,2>{0.285620987f, 0.709638417f},
-std::array<float,2>{0.439250529f, 0.0118223354f},
-std::array<float,2>{0.696813285f, 0.509186029f},
-std::array<float,2>{0.819669664f, 0.428634793f},
-std::array<float,2>{0.0737656727f, 0.788204372f},
-std::array<float,2>{0.148364723f, 0.203801215f},
-std::array<float,2>{0.882114649f, 0.697029352f},
-std::array<float,2>{0.509955108f, 0.285855085f},
-std::array<float,2>{0.277444631f, 0.915352583f},
-std::array<float,2>{0.481699407f, 0.4187859f},
-std::array<float,2>{0.723242819f, 0.804955482f},
-std::array<float,2>{0.869009197f, 0.0239457022f},
-std::array<float,2>{0.115943253f, 0.521587193f},
-std::array<float,2>{0.0523279533f, 0.333174497f},
-std::array<float,2>{0.804030061f, 0.944155157f},
-std::array<float,2>{0.631542921f, 0.181759611f},
-std::array<float,2>{0.395246178f, 0.682758868f},
-std::array<float,2>{0.324874669f, 0.0645615757f},
-std::array<float,2>{0.576227903f, 0.576543152f},
-std::array<float,2>{0.973103225f, 0.475415438f},
-std::array<float,2>{0.243421063f, 0.856286585f},
-std::array<float,2>{0.0866089463f, 0.0523220487f},
-std::array<float,2>{0.839274526f, 0.537967563f},
-std::array<float,2>{0.716841936f, 0.379260182f},
-std::array<float,2>{0.456561744f, 0.752116382f},
-std::array<float,2>{0.303218484f, 0.26681444f},
-std::array<float,2>{0.545438766f, 0.876970708f},
-std::array<float,2>{0.907628298f, 0.224960744f},
-std::array<float,2>{0.165498331f, 0.74165827f},
-std::array<float,2>{0.217437655f, 0.453361213f},
-std::array<float,2>{0.96750325f, 0.823231697f},
-std::array<float,2>{0.605391324f, 0.120676577f},
-std::array<float,2>{0.36158824f, 0.607992113f},
-std::array<float,2>{0.428900152f, 0.154333726f},
-std::array<float,2>{0.66941613f, 0.630700886f},
-std::array<float,2>{0.754603207f, 0.356025815f},
-std::array<float,2>{0.0214914493f, 0.99824965f},
-std::array<float,2>{0.22364369f, 0.0501002334f},
-std::array<float,2>{0.999208331f, 0.532319844f},
-std::array<float,2>{0.591601431f, 0.378759891f},
-std::array<float,2>{0.333703071f, 0.755978465f},
-std::array<float,2>{0.377128243f, 0.272175491f},
-std::array<float,2>{0.651045203f, 0.879649043f},
-std::array<float,2>{0.783149123f, 0.221344933f},
-std::array<float,2>{0.0443601422f, 0.736872733f},
-std::array<float,2>{0.0947079435f, 0.46025008f},
-std::array<float,2>{0.849590003f, 0.827598333f},
-std::array<float,2>{0.735236526f, 0.122497216f},
-std::array<float,2>{0.48835507f, 0.602186739f},
-std::array<float,2>{0.264999121f, 0.152053744f},
-std::array<float,2>{0.520516336f, 0.626358628f},
-std::array<float,2>{0.905524254f, 0.353728622f},
-std::array<float,2>{0.13316296f, 0.995816886f},
-std::array<float,2>{0.00779568916f, 0.20922479f},
-std::array<float,2>{0.766650081f, 0.70160985f},
-std::array<float,2>{0.67806977f, 0.282734871f},
-std::array<float,2>{0.410884976f, 0.919025779f},
-std::array<float,2>{0.352473617f, 0.415014625f},
-std::array<float,2>{0.610409558f, 0.808597565f},
-std::array<float,2>{0.947209179f, 0.0308258515f},
-std::array<float,2>{0.201971903f, 0.519523799f},
-std::array<float,2>{0.183118701f, 0.33125633f},
-std::array<float,2>{0.923681557f, 0.939877152f},
-std::array<float,2>{0.549792349f, 0.18454583f},
-std::array<float,2>{0.293080658f, 0.683965325f},
-std::array<float,2>{0.448775679f, 0.0694554746f},
-std::array<float,2>{0.687710106f, 0.572106004f},
-std::array<float,2>{0.824790239f, 0.472198546f},
-std::array<float,2>{0.0636720359f, 0.852374911f},
-std::array<float,2>{0.151160508f, 0.165479392f},
-std::array<float,2>{0.882969439f, 0.668537796f},
-std::array<float,2>{0.501619279f, 0.323736608f},
-std::array<float,2>{0.269754589f, 0.956574619f},
-std::array<float,2>{0.47641632f, 0.490410596f},
-std::array<float,2>{0.728337049f, 0.866076529f},
-std::array<float,2>{0.861143172f, 0.084190242f},
-std::array<float,2>{0.12490087f, 0.583986819f},
-std::array<float,2>{0.0558588989f, 0.298518062f},
-std::array<float,2>{0.806365073f, 0.922111928f},
-std::array<float,2>{0.639010966f, 0.18823871f},
-std::array<float,2>{0.404375821f, 0.704292655f},
-std::array<float,2>{0.320124f, 0.0116943149f},
-std::array<float,2>{0.567641199f, 0.513333619f},
-std::array<float,2>{0.97851795f, 0.422000587f},
-std::array<float,2>{0.239139497f, 0.781840205f},
-std::array<float,2>{0.0820137709f, 0.10130129f},
-std::array<float,2>{0.829390466f, 0.614025831f},
-std::array<float,2>{0.705363929f, 0.450019032f},
-std::array<float,2>{0.468178362f, 0.829802573f},
-std::array<float,2>{0.30706051f, 0.363413185f},
-std::array<float,2>{0.531292021f, 0.977864563f},
-std::array<float,2>{0.919329762f, 0.127251819f},
-std::array<float,2>{0.157967523f, 0.645451307f},
-std::array<float,2>{0.208534613f, 0.392028779f},
-std::array<float,2>{0.954312801f, 0.766965926f},
-std::array<float,2>{0.597062588f, 0.0428066999f},
-std::array<float,2>{0.372451186f, 0.556772351f},
-std::array<float,2>{0.432036549f, 0.248993367f},
-std::array<float,2>{0.657626987f, 0.728050768f},
-std::array<float,2>{0.763082922f, 0.2585769f},
-std::array<float,2>{0.0303709675f, 0.893583834f},
-std::array<float,2>{0.171570212f, 0.0930124f},
-std::array<float,2>{0.912857533f, 0.592481554f},
-std::array<float,2>{0.542386532f, 0.497255743f},
-std::array<float,2>{0.298490912f, 0.871402681f},
-std::array<float,2>{0.46044144f, 0.314524025f},
-std::array<float,2>{0.711871684f, 0.96761018f},
-std::array<float,2>{0.842669547f, 0.160292059f},
-std::array<float,2>{0.0910275728f, 0.65758121f},
-std::array<float,2>{0.0166797023f, 0.434607178f},
-std::array<float,2>{0.752941191f, 0.792126954f},
-std::array<float,2>{0.667913556f, 0.00263922312f},
-std::array<float,2>{0.422762275f, 0.502456725f},
-std::array<float,2>{0.364500612f, 0.197097719f},
-std::array<float,2>{0.606486738f, 0.715736628f},
-std::array<float,2>{0.962649286f, 0.311867893f},
-std::array<float,2>{0.214762032f, 0.936808228f},
-std::array<float,2>{0.110001735f, 0.133033529f},
-std::array<float,2>{0.87307626f, 0.649218321f},
-std::array<float,2>{0.719899833f, 0.370583743f},
-std::array<float,2>{0.478185058f, 0.969032586f},
-std::array<float,2>{0.276891768f, 0.440542907f},
-std::array<float,2>{0.512909591f, 0.8370502f},
-std::array<float,2>{0.878076673f, 0.108770959f},
-std::array<float,2>{0.140649348f, 0.619416773f},
-std::array<float,2>{0.249940634f, 0.254648745f},
-std::array<float,2>{0.970085561f, 0.903084278f},
-std::array<float,2>{0.573133469f, 0.236987948f},
-std::array<float,2>{0.323040068f, 0.724740326f},
-std::array<float,2>{0.390968055f, 0.0346977897f},
-std::array<float,2>{0.625052869f, 0.554245889f},
-std::array<float,2>{0.799403608f, 0.401488423f},
-std::array<float,2>{0.0498626567f, 0.774722219f},
-std::array<float,2>{0.187613159f, 0.22912249f},
-std::array<float,2>{0.943615139f, 0.742625058f},
-std::array<float,2>{0.623585224f, 0.280828893f},
-std::array<float,2>{0.349287599f, 0.885098219f},
-std::array<float,2>{0.421222299f, 0.386016488f},
-std::array<float,2>{0.684714079f, 0.764076889f},
-std::array<float,2>{0.778648913f, 0.0580932125f},
-std::array<float,2>{0.0110654021f, 0.544896305f},
-std::array<float,2>{0.074246265f, 0.346652359f},
-std::array<float,2>{0.812825561f, 0.987231672f},
-std::array<float,2>{0.701527655f, 0.140864834f},
-std::array<float,2>{0.442573577f, 0.637573481f},
-std::array<float,2>{0.28326115f, 0.112465076f},
-std::array<float,2>{0.5590083f, 0.598752141f},
-std::array<float,2>{0.937197387f, 0.463183165f},
-std::array<float,2>{0.178780481f, 0.818910837f},
-std::array<float,2>{0.0390101969f, 0.0192086101f},
-std::array<float,2>{0.789408386f, 0.529815078f},
-std::array<float,2>{0.641708612f, 0.408818364f},
-std::array<float,2>{0.384285837f, 0.797424376f},
-std::array<float,2>{0.340394646f, 0.292540312f},
-std::array<float,2>{0.581510365f, 0.913564622f},
-std::array<float,2>{0.99135828f, 0.212611571f},
-std::array<float,2>{0.230665669f, 0.694909215f},
-std::array<float,2>{0.127251521f, 0.479075313f},
-std::array<float,2>{0.897974968f, 0.850423932f},
-std::array<float,2>{0.527444541f, 0.0738213882f},
-std::array<float,2>{0.25516206f, 0.566581845f},
-std::array<float,2>{0.496278465f, 0.178322718f},
-std::array<float,2>{0.749114275f, 0.678564847f},
-std::array<float,2>{0.852572799f, 0.338580698f},
-std::array<float,2>{0.103233144f, 0.94890821f},
-std::array<float,2>{0.139706358f, 0.00494271982f},
-std::array<float,2>{0.901751459f, 0.506505907f},
-std::array<float,2>{0.518007994f, 0.431336939f},
-std::array<float,2>{0.259820312f, 0.795070708f},
-std::array<float,2>{0.486425161f, 0.305267423f},
-std::array<float,2>{0.740939677f, 0.931141794f},
-std::array<float,2>{0.845225036f, 0.202280611f},
-std::array<float,2>{0.101147421f, 0.713422775f},
-std::array<float,2>{0.0427498184f, 0.494299352f},
-std::array<float,2>{0.788955331f, 0.867427051f},
-std::array<float,2>{0.652777672f, 0.0886969715f},
-std::array<float,2>{0.381291837f, 0.587662995f},
-std::array<float,2>{0.329213381f, 0.1596791f},
-std::array<float,2>{0.588637292f, 0.660213053f},
-std::array<float,2>{0.992978036f, 0.319552004f},
-std::array<float,2>{0.221473441f, 0.962872982f},
-std::array<float,2>{0.0668422207f, 0.239105642f},
-std::array<float,2>{0.824084103f, 0.71912986f},
-std::array<float,2>{0.693717778f, 0.252397329f},
-std::array<float,2>{0.449973106f, 0.898471117f},
-std::array<float,2>{0.29224655f, 0.402617693f},
-std::array<float,2>{0.554118395f, 0.779840887f},
-std::array<float,2>{0.926742673f, 0.0356301889f},
-std::array<float,2>{0.185592711f, 0.550451636f},
-std::array<float,2>{0.198503718f, 0.373130739f},
-std::array<float,2>{0.950554907f, 0.975024462f},
-std::array<float,2>{0.616249979f, 0.139465451f},
-std::array<float,2>{0.359309614f, 0.654390752f},
-std::array<float,2>{0.409323841f, 0.103622437f},
-std::array<float,2>{0.672017872f, 0.622113109f},
-std::array<float,2>{0.772937059f, 0.442216903f},
-std::array<float,2>{0.00023099508f, 0.840520322f},
-std::array<float,2>{0.235716179f, 0.148311824f},
-std::array<float,2>{0.984144866f, 0.633749962f},
-std::array<float,2>{0.563465476f, 0.349797875f},
-std::array<float,2>{0.314434648f, 0.992121994f},
-std::array<float,2>{0.400272965f, 0.466093242f},
-std::array<float,2>{0.634187758f, 0.816352248f},
-std::array<float,2>{0.811969042f, 0.116795205f},
-std::array<float,2>{0.0594304278f, 0.596131444f},
-std::array<float,2>{0.120356344f, 0.275837004f},
-std::array<float,2>{0.86695689f, 0.886880815f},
-std::array<float,2>{0.730495274f, 0.231732756f},
-std::array<float,2>{0.471513242f, 0.747038424f},
-std::array<float,2>{0.268666834f, 0.05861843f},
-std::array<float,2>{0.504024684f, 0.542775512f},
-std::array<float,2>{0.887881219f, 0.388144761f},
-std::array<float,2>{0.155919999f, 0.759704471f},
-std::array<float,2>{0.024552498f, 0.0755606219f},
-std::array<float,2>{0.759162068f, 0.563842952f},
-std::array<float,2>{0.661387861f, 0.482393742f},
-std::array<float,2>{0.435379386f, 0.846733868f},
-std::array<float,2>{0.370646447f, 0.340662718f},
-std::array<float,2>{0.597930133f, 0.951992631f},
-std::array<float,2>{0.959917724f, 0.175712213f},
-std::array<float,2>{0.204395384f, 0.674225807f},
-std::array<float,2>{0.161341771f, 0.410770208f},
-std::array<float,2>{0.917946875f, 0.804542065f},
-std::array<float,2>{0.536663175f, 0.0227988064f},
-std::array<float,2>{0.310064912f, 0.525136948f},
-std::array<float,2>{0.463984013f, 0.218424991f},
-std::array<float,2>{0.708911479f, 0.687681258f},
-std::array<float,2>{0.833132923f, 0.293555975f},
-std::array<float,2>{0.0829896331f, 0.907609999f},
-std::array<float,2>{0.215453252f, 0.119608529f},
-std::array<float,2>{0.966009438f, 0.608708143f},
-std::array<float,2>{0.60322088f, 0.45462659f},
-std::array<float,2>{0.360527158f, 0.824218571f},
-std::array<float,2>{0.427375615f, 0.356509924f},
-std::array<float,2>{0.671321869f, 0.99972862f},
-std::array<float,2>{0.756515861f, 0.155840576f},
-std::array<float,2>{0.0211094078f, 0.629296362f},
-std::array<float,2>{0.0891314149f, 0.380457819f},
-std::array<float,2>{0.836845517f, 0.753761888f},
-std::array<float,2>{0.715439618f, 0.0513885878f},
-std::array<float,2>{0.454363734f, 0.538380623f},
-std::array<float,2>{0.302603424f, 0.226002663f},
-std::array<float,2>{0.543362796f, 0.740470529f},
-std::array<float,2>{0.908913016f, 0.265989393f},
-std::array<float,2>{0.167143971f, 0.878683686f},
-std::array<float,2>{0.0538348258f, 0.182810158f},
-std::array<float,2>{0.802461147f, 0.681985736f},
-std::array<float,2>{0.63055563f, 0.332448334f},
-std::array<float,2>{0.397304177f, 0.944520831f},
-std::array<float,2>{0.326654017f, 0.475850403f},
-std::array<float,2>{0.575190008f, 0.85741061f},
-std::array<float,2>{0.976154447f, 0.0664018244f},
-std::array<float,2>{0.244408831f, 0.57719481f},
-std::array<float,2>{0.146006733f, 0.286356807f},
-std::array<float,2>{0.880021572f, 0.914637804f},
-std::array<float,2>{0.508188367f, 0.204868183f},
-std::array<float,2>{0.280791938f, 0.696273983f},
-std::array<float,2>{0.483190864f, 0.0252540912f},
-std::array<float,2>{0.72557956f, 0.523162186f},
-std::array<float,2>{0.869579196f, 0.419588715f},
-std::array<float,2>{0.11438065f, 0.805705369f},
-std::array<float,2>{0.174818814f, 0.193883091f},
-std::array<float,2>{0.932283103f, 0.710792363f},
-std::array<float,2>{0.555146635f, 0.301405698f},
-std::array<float,2>{0.287383825f, 0.927474797f},
-std::array<float,2>{0.440807134f, 0.429390222f},
-std::array<float,2>{0.698361099f, 0.787865758f},
-std::array<float,2>{0.8183375f, 0.0135399401f},
-std::array<float,2>{0.0719538778f, 0.508252263f},
-std::array<float,2>{0.0124456082f, 0.327977657f},
-std::array<float,2>{0.776587725f, 0.958296955f},
-std::array<float,2>{0.683178484f, 0.170766711f},
-std::array<float,2>{0.416152656f, 0.665322185f},
-std::array<float,2>{0.347337991f, 0.0800537318f},
-std::array<float,2>{0.618125021f, 0.579740167f},
-std::array<float,2>{0.940215409f, 0.485447884f},
-std::array<float,2>{0.192787707f, 0.860083997f},
-std::array<float,2>{0.108221732f, 0.0466857366f},
-std::array<float,2>{0.859137416f, 0.559583426f},
-std::array<float,2>{0.745311201f, 0.398113549f},
-std::array<float,2>{0.495935172f, 0.770766735f},
-std::array<float,2>{0.253349453f, 0.264918238f},
-std::array<float,2>{0.524418354f, 0.895523965f},
-std::array<float,2>{0.892204344f, 0.244788229f},
-std::array<float,2>{0.130960822f, 0.733833253f},
-std::array<float,2>{0.230356321f, 0.447698623f},
-std::array<float,2>{0.987509668f, 0.83273989f},
-std::array<float,2>{0.583071113f, 0.0976372808f},
-std::array<float,2>{0.336914003f, 0.609624982f},
-std::array<float,2>{0.387975812f, 0.129571185f},
-std::array<float,2>{0.64814198f, 0.641186953f},
-std::array<float,2>{0.794825673f, 0.362213671f},
-std::array<float,2>{0.032317508f, 0.980754375f},
-std::array<float,2>{0.200031072f, 0.0274404921f},
-std::array<float,2>{0.948556364f, 0.517257929f},
-std::array<float,2>{0.611550033f, 0.417552292f},
-std::array<float,2>{0.354126602f, 0.81162107f},
-std::array<float,2>{0.413633257f, 0.284908116f},
-std::array<float,2>{0.677671611f, 0.921520412f},
-std::array<float,2>{0.768503904f, 0.208227992f},
-std::array<float,2>{0.00420287671f, 0.700164557f},
-std::array<float,2>{0.0661943033f, 0.469433695f},
-std::array<float,2>{0.82683295f, 0.853821397f},
-std::array<float,2>{0.690701783f, 0.0681253374f},
-std::array<float,2>{0.446124524f, 0.572487116f},
-std::array<float,2>{0.295145243f, 0.186855972f},
-std::array<float,2>{0.547595143f, 0.687383831f},
-std::array<float,2>{0.923990667f, 0.329318702f},
-std::array<float,2>{0.181464583f, 0.937842906f},
-std::array<float,2>{0.0458900779f, 0.219624847f},
-std::array<float,2>{0.783449054f, 0.734503865f},
-std::array<float,2>{0.649429202f, 0.270656765f},
-std::array<float,2>{0.375135839f, 0.88103044f},
-std::array<float,2>{0.334730476f, 0.375944227f},
-std::array<float,2>{0.593476355f, 0.754793584f},
-std::array<float,2>{0.996923089f, 0.0482247658f},
-std::array<float,2>{0.225578159f, 0.534171999f},
-std::array<float,2>{0.135571733f, 0.353508115f},
-std::array<float,2>{0.902425289f, 0.992338657f},
-std::array<float,2>{0.522916436f, 0.149781987f},
-std::array<float,2>{0.263419926f, 0.628235817f},
-std::array<float,2>{0.491411507f, 0.123052113f},
-std::array<float,2>{0.73711282f, 0.603691399f},
-std::array<float,2>{0.849751413f, 0.458406061f},
-std::array<float,2>{0.0960570425f, 0.826038539f},
-std::array<float,2>{0.159408823f, 0.1257312f},
-std::array<float,2>{0.921031594f, 0.647746086f},
-std::array<float,2>{0.534223616f, 0.366628855f},
-std::array<float,2>{0.305844873f, 0.9803828f},
-std::array<float,2>{0.465157866f, 0.45180425f},
-std::array<float,2>{0.703811169f, 0.830397069f},
-std::array<float,2>{0.830871582f, 0.0983226597f},
-std::array<float,2>{0.0788037479f, 0.616435409f},
-std::array<float,2>{0.0280377995f, 0.260627806f},
-std::array<float,2>{0.764642358f, 0.892476678f},
-std::array<float,2>{0.658252537f, 0.246807486f},
-std::array<float,2>{0.431171954f, 0.728806615f},
-std::array<float,2>{0.373277366f, 0.0394888967f},
-std::array<float,2>{0.593836904f, 0.554943979f},
-std::array<float,2>{0.956483424f, 0.393591613f},
-std::array<float,2>{0.209012926f, 0.768543899f},
-std::array<float,2>{0.122289948f, 0.0831947103f},
-std::array<float,2>{0.861442983f, 0.582616448f},
-std::array<float,2>{0.729000688f, 0.48904103f},
-std::array<float,2>{0.473874032f, 0.865144014f},
-std::array<float,2>{0.272705495f, 0.320668429f},
-std::array<float,2>{0.503459394f, 0.953551471f},
-std::array<float,2>{0.886592209f, 0.166948035f},
-std::array<float,2>{0.149823546f, 0.671735764f},
-std::array<float,2>{0.242076352f, 0.423863649f},
-std::array<float,2>{0.977776587f, 0.784128606f},
-std::array<float,2>{0.568825841f, 0.00785030052f},
-std::array<float,2>{0.318104506f, 0.51443702f},
-std::array<float,2>{0.403296918f, 0.19033213f},
-std::array<float,2>{0.638149202f, 0.705258369f},
-std::array<float,2>{0.807302475f, 0.300582498f},
-std::array<float,2>{0.0584965907f, 0.925777733f},
-std::array<float,2>{0.142760471f, 0.10583742f},
-std::array<float,2>{0.875949383f, 0.61781472f},
-std::array<float,2>{0.514441371f, 0.43852523f},
-std::array<float,2>{0.275184453f, 0.838565946f},
-std::array<float,2>{0.479606032f, 0.367553085f},
-std::array<float,2>{0.722247899f, 0.971525431f},
-std::array<float,2>{0.872659147f, 0.135346681f},
-std::array<float,2>{0.112345852f, 0.650452971f},
-std::array<float,2>{0.0488170348f, 0.399634153f},
-std::array<float,2>{0.798307657f, 0.776815593f},
-std::array<float,2>{0.628408849f, 0.0323459208f},
-std::array<float,2>{0.392903298f, 0.552438974f},
-std::array<float,2>{0.322196335f, 0.236269578f},
-std::array<float,2>{0.571562588f, 0.722866893f},
-std::array<float,2>{0.970873892f, 0.256176412f},
-std::array<float,2>{0.246586382f, 0.905306458f},
-std::array<float,2>{0.0925647542f, 0.16333355f},
-std::array<float,2>{0.841481984f, 0.658513427f},
-std::array<float,2>{0.713279247f, 0.313882232f},
-std::array<float,2>{0.457257718f, 0.965984881f},
-std::array<float,2>{0.299252838f, 0.499945968f},
-std::array<float,2>{0.540791988f, 0.874733269f},
-std::array<float,2>{0.911096632f, 0.0899551362f},
-std::array<float,2>{0.168862313f, 0.591485262f},
-std::array<float,2>{0.212728024f, 0.309366256f},
-std::array<float,2>{0.964340925f, 0.935535967f},
-std::array<float,2>{0.607635081f, 0.19754447f},
-std::array<float,2>{0.367095679f, 0.718115926f},
-std::array<float,2>{0.425307244f, 0.000449492916f},
-std::array<float,2>{0.664528787f, 0.500894129f},
-std::array<float,2>{0.75173521f, 0.437253445f},
-std::array<float,2>{0.0189038552f, 0.7906124f},
-std::array<float,2>{0.233355492f, 0.213541672f},
-std::array<float,2>{0.988793731f, 0.692262709f},
-std::array<float,2>{0.5783602f, 0.28910926f},
-std::array<float,2>{0.342625737f, 0.911175251f},
-std::array<float,2>{0.385858536f, 0.406258523f},
-std::array<float,2>{0.644062877f, 0.79975915f},
-std::array<float,2>{0.791380763f, 0.0163053293f},
-std::array<float,2>{0.0355864167f, 0.527934611f},
-std::array<float,2>{0.104100801f, 0.337003082f},
-std::array<float,2>{0.853973448f, 0.945569217f},
-std::array<float,2>{0.74726361f, 0.176866367f},
-std::array<float,2>{0.499741137f, 0.676263511f},
-std::array<float,2>{0.255999416f, 0.0720801204f},
-std::array<float,2>{0.529518545f, 0.569967985f},
-std::array<float,2>{0.89468199f, 0.478295058f},
-std::array<float,2>{0.126886606f, 0.848004639f},
-std::array<float,2>{0.00949403923f, 0.055953294f},
-std::array<float,2>{0.779941559f, 0.54637897f},
-std::array<float,2>{0.687055469f, 0.384747654f},
-std::array<float,2>{0.419727355f, 0.763057888f},
-std::array<float,2>{0.350156188f, 0.278321564f},
-std::array<float,2>{0.62161541f, 0.884624958f},
-std::array<float,2>{0.942022622f, 0.227366015f},
-std::array<float,2>{0.190212354f, 0.745265186f},
-std::array<float,2>{0.177184418f, 0.461832285f},
-std::array<float,2>{0.934438646f, 0.817588687f},
-std::array<float,2>{0.562270105f, 0.109384686f},
-std::array<float,2>{0.281954736f, 0.601218581f},
-std::array<float,2>{0.444124073f, 0.14431186f},
-std::array<float,2>{0.699976504f, 0.638765037f},
-std::array<float,2>{0.814509332f, 0.344943285f},
-std::array<float,2>{0.0767091215f, 0.985316277f},
-std::array<float,2>{0.184065953f, 0.0379015766f},
-std::array<float,2>{0.929039657f, 0.5487414f},
-std::array<float,2>{0.552192867f, 0.404897928f},
-std::array<float,2>{0.290127128f, 0.777829051f},
-std::array<float,2>{0.451210409f, 0.251598865f},
-std::array<float,2>{0.692488492f, 0.901358664f},
-std::array<float,2>{0.821040988f, 0.240654573f},
-std::array<float,2>{0.0690867305f, 0.721698463f},
-std::array<float,2>{0.00260533323f, 0.444841444f},
-std::array<float,2>{0.769785345f, 0.842545629f},
-std::array<float,2>{0.675487757f, 0.103257559f},
-std::array<float,2>{0.406418681f, 0.62313354f},
-std::array<float,2>{0.356692433f, 0.137969315f},
-std::array<float,2>{0.613951087f, 0.6538257f},
-std::array<float,2>{0.952285409f, 0.37282899f},
-std::array<float,2>{0.195434406f, 0.973511338f},
-std::array<float,2>{0.0995803922f, 0.199833557f},
-std::array<float,2>{0.846334517f, 0.712698102f},
-std::array<float,2>{0.739337623f, 0.306758076f},
-std::array<float,2>{0.484814703f, 0.931844175f},
-std::array<float,2>{0.259700626f, 0.433571249f},
-std::array<float,2>{0.516322136f, 0.794895589f},
-std::array<float,2>{0.898692191f, 0.00644780649f},
-std::array<float,2>{0.137286738f, 0.504505098f},
-std::array<float,2>{0.219902977f, 0.317765504f},
-std::array<float,2>{0.994763374f, 0.963355899f},
-std::array<float,2>{0.586225152f, 0.157858536f},
-std::array<float,2>{0.330313534f, 0.663792729f},
-std::array<float,2>{0.380176693f, 0.0860255286f},
-std::array<float,2>{0.654668033f, 0.589580178f},
-std::array<float,2>{0.785521269f, 0.493160665f},
-std::array<float,2>{0.0407892764f, 0.870024741f},
-std::array<float,2>{0.206951752f, 0.172913328f},
-std::array<float,2>{0.957212925f, 0.67343837f},
-std::array<float,2>{0.600612521f, 0.342851579f},
-std::array<float,2>{0.367613256f, 0.949834883f},
-std::array<float,2>{0.43684113f, 0.482712537f},
-std::array<float,2>{0.663377404f, 0.845155597f},
-std::array<float,2>{0.761148989f, 0.0769483596f},
-std::array<float,2>{0.0267947074f, 0.564632237f},
-std::array<float,2>{0.0848403648f, 0.296420842f},
-std::array<float,2>{0.835551262f, 0.909758568f},
-std::array<float,2>{0.709130883f, 0.215792492f},
-std::array<float,2>{0.462601393f, 0.690862477f},
-std::array<float,2>{0.311253726f, 0.0196761675f},
-std::array<float,2>{0.5384022f, 0.526169598f},
-std::array<float,2>{0.915553033f, 0.412258804f},
-std::array<float,2>{0.162995756f, 0.801241696f},
-std::array<float,2>{0.0611046664f, 0.114830866f},
-std::array<float,2>{0.810387611f, 0.593946815f},
-std::array<float,2>{0.635030985f, 0.468511522f},
-std::array<float,2>{0.401213408f, 0.812990367f},
-std::array<float,2>{0.315620512f, 0.349451989f},
-std::array<float,2>{0.565311432f, 0.989553094f},
-std::array<float,2>{0.982379436f, 0.14544864f},
-std::array<float,2>{0.236682564f, 0.635122597f},
-std::array<float,2>{0.152401373f, 0.389220148f},
-std::array<float,2>{0.889724493f, 0.761692524f},
-std::array<float,2>{0.506865442f, 0.062345054f},
-std::array<float,2>{0.265875459f, 0.540378571f},
-std::array<float,2>{0.469621688f, 0.233347848f},
-std::array<float,2>{0.732887089f, 0.74997437f},
-std::array<float,2>{0.864534736f, 0.273925006f},
-std::array<float,2>{0.118853822f, 0.889891565f},
-std::array<float,2>{0.242194399f, 0.0629780591f},
-std::array<float,2>{0.974508762f, 0.575259268f},
-std::array<float,2>{0.577870607f, 0.474274397f},
-std::array<float,2>{0.325509071f, 0.859305561f},
-std::array<float,2>{0.396478921f, 0.335324109f},
-std::array<float,2>{0.632190108f, 0.942046762f},
-std::array<float,2>{0.802963018f, 0.181624874f},
-std::array<float,2>{0.0515060239f, 0.681620181f},
-std::array<float,2>{0.11713393f, 0.421662718f},
-std::array<float,2>{0.867326677f, 0.807811439f},
-std::array<float,2>{0.724481165f, 0.0271423589f},
-std::array<float,2>{0.481013685f, 0.521183193f},
-std::array<float,2>{0.278755307f, 0.206157535f},
-std::array<float,2>{0.511048734f, 0.69777441f},
-std::array<float,2>{0.881136477f, 0.288485467f},
-std::array<float,2>{0.14680095f, 0.916575849f},
-std::array<float,2>{0.0225843079f, 0.152997971f},
-std::array<float,2>{0.755804002f, 0.630903006f},
-std::array<float,2>{0.668737113f, 0.35789749f},
-std::array<float,2>{0.428420901f, 0.997231901f},
-std::array<float,2>{0.362756521f, 0.456232876f},
-std::array<float,2>{0.603611708f, 0.820662439f},
-std::array<float,2>{0.967952192f, 0.118180543f},
-std::array<float,2>{0.217847317f, 0.606996119f},
-std::array<float,2>{0.164316937f, 0.268365711f},
-std::array<float,2>{0.907151461f, 0.875969887f},
-std::array<float,2>{0.546681881f, 0.223758295f},
-std::array<float,2>{0.304574877f, 0.738864303f},
-std::array<float,2>{0.455137908f, 0.0541319996f},
-std::array<float,2>{0.718390286f, 0.536971986f},
-std::array<float,2>{0.838109076f, 0.382518262f},
-std::array<float,2>{0.0870592073f, 0.750712454f},
-std::array<float,2>{0.129758403f, 0.243198633f},
-std::array<float,2>{0.893402636f, 0.730771601f},
-std::array<float,2>{0.525969863f, 0.26214245f},
-std::array<float,2>{0.250669628f, 0.898041964f},
-std::array<float,2>{0.493007004f, 0.395845264f},
-std::array<float,2>{0.743330538f, 0.773294806f},
-std::array<float,2>{0.856817245f, 0.0447911099f},
-std::array<float,2>{0.107330248f, 0.561719239f},
-std::array<float,2>{0.0337973721f, 0.360785007f},
-std::array<float,2>{0.796606779f, 0.98338443f},
-std::array<float,2>{0.644563496f, 0.132096365f},
-std::array<float,2>{0.389020085f, 0.644140482f},
-std::array<float,2>{0.338508368f, 0.0954388753f},
-std::array<float,2>{0.584715009f, 0.611810029f},
-std::array<float,2>{0.984829664f, 0.446584433f},
-std::array<float,2>{0.227714241f, 0.835062265f},
-std::array<float,2>{0.0723065734f, 0.0147398058f},
-std::array<float,2>{0.818962574f, 0.510375619f},
-std::array<float,2>{0.695473611f, 0.427642524f},
-std::array<float,2>{0.438257366f, 0.785568953f},
-std::array<float,2>{0.286983967f, 0.30310154f},
-std::array<float,2>{0.55791533f, 0.929372728f},
-std::array<float,2>{0.930158973f, 0.191608816f},
-std::array<float,2>{0.17281881f, 0.707142711f},
-std::array<float,2>{0.193714797f, 0.488145977f},
-std::array<float,2>{0.938148618f, 0.863194525f},
-std::array<float,2>{0.62009567f, 0.0816856325f},
-std::array<float,2>{0.345193893f, 0.580283999f},
-std::array<float,2>{0.414908469f, 0.169386953f},
-std::array<float,2>{0.681335151f, 0.667098343f},
-std::array<float,2>{0.774216592f, 0.324850142f},
-std::array<float,2>{0.0143983597f, 0.959676504f},
-std::array<float,2>{0.231266543f, 0.016102612f},
-std::array<float,2>{0.991922021f, 0.527569473f},
-std::array<float,2>{0.581543088f, 0.407125711f},
-std::array<float,2>{0.340136409f, 0.798922122f},
-std::array<float,2>{0.383838981f, 0.289596975f},
-std::array<float,2>{0.642468691f, 0.911896527f},
-std::array<float,2>{0.790007651f, 0.213006943f},
-std::array<float,2>{0.0382093303f, 0.691619515f},
-std::array<float,2>{0.102632195f, 0.477730632f},
-std::array<float,2>{0.853114069f, 0.848187685f},
-std::array<float,2>{0.749931157f, 0.0717605501f},
-std::array<float,2>{0.496611595f, 0.569811165f},
-std::array<float,2>{0.255628109f, 0.177377269f},
-std::array<float,2>{0.527836621f, 0.676691532f},
-std::array<float,2>{0.897628129f, 0.337706298f},
-std::array<float,2>{0.127730995f, 0.9460814f},
-std::array<float,2>{0.0116797574f, 0.226880297f},
-std::array<float,2>{0.779210925f, 0.746042013f},
-std::array<float,2>{0.685125053f, 0.278927147f},
-std::array<float,2>{0.421674877f, 0.884119034f},
-std::array<float,2>{0.349000543f, 0.383955419f},
-std::array<float,2>{0.623107493f, 0.763646185f},
-std::array<float,2>{0.943937421f, 0.0562186912f},
-std::array<float,2>{0.188111365f, 0.54668057f},
-std::array<float,2>{0.179339409f, 0.345261812f},
-std::array<float,2>{0.936778903f, 0.984589338f},
-std::array<float,2>{0.559216559f, 0.143676549f},
-std::array<float,2>{0.283933967f, 0.639217734f},
-std::array<float,2>{0.443142533f, 0.110141821f},
-std::array<float,2>{0.701731145f, 0.600808203f},
-std::array<float,2>{0.813126087f, 0.461230785f},
-std::array<float,2>{0.0747615248f, 0.81818682f},
-std::array<float,2>{0.14131397f, 0.13505961f},
-std::array<float,2>{0.878604054f, 0.6513592f},
-std::array<float,2>{0.513584197f, 0.367952973f},
-std::array<float,2>{0.276552588f, 0.971081138f},
-std::array<float,2>{0.477685153f, 0.439086199f},
-std::array<float,2>{0.720366418f, 0.838070631f},
-std::array<float,2>{0.873617709f, 0.106385469f},
-std::array<float,2>{0.109384827f, 0.617429256f},
-std::array<float,2>{0.0503351651f, 0.256432533f},
-std::array<float,2>{0.799117684f, 0.906141996f},
-std::array<float,2>{0.625889421f, 0.235571653f},
-std::array<float,2>{0.391198218f, 0.723556697f},
-std::array<float,2>{0.322477996f, 0.0328625701f},
-std::array<float,2>{0.57250458f, 0.552202404f},
-std::array<float,2>{0.970416963f, 0.400338143f},
-std::array<float,2>{0.249490246f, 0.777241468f},
-std::array<float,2>{0.0916969702f, 0.0904335752f},
-std::array<float,2>{0.841915667f, 0.591229856f},
-std::array<float,2>{0.711329997f, 0.499230951f},
-std::array<float,2>{0.460704297f, 0.874158442f},
-std::array<float,2>{0.298187703f, 0.314103812f},
-std::array<float,2>{0.542542398f, 0.966532886f},
-std::array<float,2>{0.912218332f, 0.16390717f},
-std::array<float,2>{0.170962229f, 0.659036875f},
-std::array<float,2>{0.214126796f, 0.436924368f},
-std::array<float,2>{0.961927354f, 0.790443718f},
-std::array<float,2>{0.607375681f, 0.000969128043f},
-std::array<float,2>{0.365148544f, 0.500123203f},
-std::array<float,2>{0.422180861f, 0.197812706f},
-std::array<float,2>{0.66716212f, 0.718703628f},
-std::array<float,2>{0.753898323f, 0.308815181f},
-std::array<float,2>{0.0171801671f, 0.934841812f},
-std::array<float,2>{0.157573298f, 0.0977407247f},
-std::array<float,2>{0.919793129f, 0.616907179f},
-std::array<float,2>{0.53220737f, 0.45142138f},
-std::array<float,2>{0.307337433f, 0.830651224f},
-std::array<float,2>{0.468286574f, 0.366819084f},
-std::array<float,2>{0.705657065f, 0.979600906f},
-std::array<float,2>{0.829928756f, 0.125105903f},
-std::array<float,2>{0.0813831016f, 0.648305237f},
-std::array<float,2>{0.0308424179f, 0.394173503f},
-std::array<float,2>{0.763542473f, 0.767857909f},
-std::array<float,2>{0.657907724f, 0.0400099009f},
-std::array<float,2>{0.432252884f, 0.555365026f},
-std::array<float,2>{0.372799069f, 0.246213183f},
-std::array<float,2>{0.597438574f, 0.729332983f},
-std::array<float,2>{0.9550246f, 0.259931982f},
-std::array<float,2>{0.208125398f, 0.89191103f},
-std::array<float,2>{0.124088682f, 0.16638726f},
-std::array<float,2>{0.860571265f, 0.671289623f},
-std::array<float,2>{0.727783203f, 0.321163297f},
-std::array<float,2>{0.475644022f, 0.953626573f},
-std::array<float,2>{0.270443469f, 0.488520324f},
-std::array<float,2>{0.501002908f, 0.864437044f},
-std::array<float,2>{0.883786619f, 0.0835359022f},
-std::array<float,2>{0.150704071f, 0.582227588f},
-std::array<float,2>{0.23838003f, 0.299871236f},
-std::array<float,2>{0.979284227f, 0.925093949f},
-std::array<float,2>{0.568354011f, 0.18987447f},
-std::array<float,2>{0.319758415f, 0.705859005f},
-std::array<float,2>{0.405059814f, 0.00873509236f},
-std::array<float,2>{0.639298201f, 0.514049768f},
-std::array<float,2>{0.805987239f, 0.42434746f},
-std::array<float,2>{0.0563628264f, 0.783535719f},
-std::array<float,2>{0.201532066f, 0.208789095f},
-std::array<float,2>{0.946475267f, 0.699253678f},
-std::array<float,2>{0.61085248f, 0.28430739f},
-std::array<float,2>{0.351672709f, 0.921338797f},
-std::array<float,2>{0.410172075f, 0.417129785f},
-std::array<float,2>{0.678470254f, 0.812294364f},
-std::array<float,2>{0.767201364f, 0.0278639495f},
-std::array<float,2>{0.00703764241f, 0.516755998f},
-std::array<float,2>{0.0640046448f, 0.330046356f},
-std::array<float,2>{0.824546814f, 0.938279688f},
-std::array<float,2>{0.688298702f, 0.187434003f},
-std::array<float,2>{0.448420525f, 0.686886251f},
-std::array<float,2>{0.29376018f, 0.0677600726f},
-std::array<float,2>{0.548911214f, 0.573123038f},
-std::array<float,2>{0.923288465f, 0.468761742f},
-std::array<float,2>{0.182864189f, 0.854232967f},
-std::array<float,2>{0.0445434637f, 0.0485957861f},
-std::array<float,2>{0.782636702f, 0.533561885f},
-std::array<float,2>{0.650503218f, 0.375211149f},
-std::array<float,2>{0.377763093f, 0.754115582f},
-std::array<float,2>{0.333269119f, 0.271167189f},
-std::array<float,2>{0.590984643f, 0.88146311f},
-std::array<float,2>{0.999967217f, 0.218854129f},
-std::array<float,2>{0.224400207f, 0.735093534f},
-std::array<float,2>{0.133548573f, 0.458685786f},
-std::array<float,2>{0.906006217f, 0.825309813f},
-std::array<float,2>{0.521259725f, 0.123915784f},
-std::array<float,2>{0.265345007f, 0.60424155f},
-std::array<float,2>{0.488937169f, 0.150055155f},
-std::array<float,2>{0.734753668f, 0.628429711f},
-std::array<float,2>{0.849052489f, 0.352932215f},
-std::array<float,2>{0.0939662606f, 0.992899895f},
-std::array<float,2>{0.131464273f, 0.0443179868f},
-std::array<float,2>{0.891925573f, 0.56202203f},
-std::array<float,2>{0.525246084f, 0.396463454f},
-std::array<float,2>{0.253592581f, 0.772932708f},
-std::array<float,2>{0.495340019f, 0.262497306f},
-std::array<float,2>{0.74562031f, 0.897929966f},
-std::array<float,2>{0.858529627f, 0.243760735f},
-std::array<float,2>{0.107577808f, 0.7313568f},
-std::array<float,2>{0.0331869908f, 0.446908474f},
-std::array<float,2>{0.794049382f, 0.835565388f},
-std::array<float,2>{0.647843719f, 0.0951105654f},
-std::array<float,2>{0.388214707f, 0.611817479f},
-std::array<float,2>{0.336273015f, 0.132433206f},
-std::array<float,2>{0.583788514f, 0.643709719f},
-std::array<float,2>{0.987959921f, 0.361274809f},
-std::array<float,2>{0.229564488f, 0.982485592f},
-std::array<float,2>{0.0714997128f, 0.192317888f},
-std::array<float,2>{0.817383468f, 0.707869112f},
-std::array<float,2>{0.698852777f, 0.303319544f},
-std::array<float,2>{0.441246569f, 0.92891115f},
-std::array<float,2>{0.287890404f, 0.426972598f},
-std::array<float,2>{0.555539608f, 0.785794258f},
-std::array<float,2>{0.932073355f, 0.0155440159f},
-std::array<float,2>{0.175361514f, 0.509970427f},
-std::array<float,2>{0.193095729f, 0.324255288f},
-std::array<float,2>{0.939806223f, 0.959358931f},
-std::array<float,2>{0.617394567f, 0.169844285f},
-std::array<float,2>{0.346847564f, 0.667515397f},
-std::array<float,2>{0.416732967f, 0.0810893551f},
-std::array<float,2>{0.682781637f, 0.580954194f},
-std::array<float,2>{0.777177989f, 0.487390578f},
-std::array<float,2>{0.0118643036f, 0.862790406f},
-std::array<float,2>{0.244680509f, 0.181057796f},
-std::array<float,2>{0.976034284f, 0.681086957f},
-std::array<float,2>{0.574699521f, 0.335523874f},
-std::array<float,2>{0.326730877f, 0.941526115f},
-std::array<float,2>{0.396960109f, 0.473750532f},
-std::array<float,2>{0.629962027f, 0.858469784f},
-std::array<float,2>{0.802214205f, 0.0634355769f},
-std::array<float,2>{0.0543340705f, 0.575728774f},
-std::array<float,2>{0.115232728f, 0.289007157f},
-std::array<float,2>{0.86969012f, 0.916329861f},
-std::array<float,2>{0.724674523f, 0.206707269f},
-std::array<float,2>{0.482679874f, 0.697461247f},
-std::array<float,2>{0.28063482f, 0.0263996013f},
-std::array<float,2>{0.508758605f, 0.520655751f},
-std::array<float,2>{0.880635977f, 0.420981944f},
-std::array<float,2>{0.145522416f, 0.80841732f},
-std::array<float,2>{0.020556489f, 0.118921213f},
-std::array<float,2>{0.756336868f, 0.606447697f},
-std::array<float,2>{0.671571314f, 0.456622124f},
-std::array<float,2>{0.427112758f, 0.821152747f},
-std::array<float,2>{0.360903651f, 0.358011901f},
-std::array<float,2>{0.60300225f, 0.997560263f},
-std::array<float,2>{0.966611147f, 0.15254423f},
-std::array<float,2>{0.215113118f, 0.631762862f},
-std::array<float,2>{0.167811424f, 0.382140964f},
-std::array<float,2>{0.90850234f, 0.75006634f},
-std::array<float,2>{0.543513358f, 0.0543561243f},
-std::array<float,2>{0.302200168f, 0.536550879f},
-std::array<float,2>{0.454689205f, 0.224568561f},
-std::array<float,2>{0.715146422f, 0.738604784f},
-std::array<float,2>{0.836014807f, 0.268016905f},
-std::array<float,2>{0.0894462541f, 0.875082254f},
-std::array<float,2>{0.204905525f, 0.0765174478f},
-std::array<float,2>{0.959448636f, 0.565421581f},
-std::array<float,2>{0.59842962f, 0.483145952f},
-std::array<float,2>{0.370583326f, 0.845220208f},
-std::array<float,2>{0.434723437f, 0.343388081f},
-std::array<float,2>{0.662008226f, 0.949405849f},
-std::array<float,2>{0.759543478f, 0.173711523f},
-std::array<float,2>{0.0250842702f, 0.673010707f},
-std::array<float,2>{0.0823562369f, 0.413061261f},
-std::array<float,2>{0.833743632f, 0.801498175f},
-std::array<float,2>{0.708290696f, 0.0204378013f},
-std::array<float,2>{0.464536041f, 0.525561273f},
-std::array<float,2>{0.310020924f, 0.215267852f},
-std::array<float,2>{0.536271334f, 0.691253543f},
-std::array<float,2>{0.917249143f, 0.296260566f},
-std::array<float,2>{0.161696613f, 0.909512579f},
-std::array<float,2>{0.0587001368f, 0.144905701f},
-std::array<float,2>{0.812254429f, 0.635341883f},
-std::array<float,2>{0.634459436f, 0.34908089f},
-std::array<float,2>{0.399517149f, 0.989932299f},
-std::array<float,2>{0.313794017f, 0.468070149f},
-std::array<float,2>{0.562578022f, 0.812626779f},
-std::array<float,2>{0.9836514f, 0.11471729f},
-std::array<float,2>{0.235864788f, 0.594543636f},
-std::array<float,2>{0.155469015f, 0.274213582f},
-std::array<float,2>{0.888223886f, 0.890418828f},
-std::array<float,2>{0.504822969f, 0.232462004f},
-std::array<float,2>{0.269402146f, 0.749230921f},
-std::array<float,2>{0.470908642f, 0.0619396977f},
-std::array<float,2>{0.731086552f, 0.540583909f},
-std::array<float,2>{0.866409123f, 0.389103621f},
-std::array<float,2>{0.120930925f, 0.76095891f},
-std::array<float,2>{0.186162427f, 0.24116531f},
-std::array<float,2>{0.926205218f, 0.722303271f},
-std::array<float,2>{0.554453492f, 0.251046866f},
-std::array<float,2>{0.292795688f, 0.900851488f},
-std::array<float,2>{0.44940865f, 0.404551119f},
-std::array<float,2>{0.694022119f, 0.777941644f},
-std::array<float,2>{0.823668182f, 0.0371669531f},
-std::array<float,2>{0.0670519173f, 0.548306942f},
-std::array<float,2>{0.000799977977f, 0.372326493f},
-std::array<float,2>{0.773373425f, 0.972912371f},
-std::array<float,2>{0.672688663f, 0.138451844f},
-std::array<float,2>{0.409922779f, 0.653677285f},
-std::array<float,2>{0.358572662f, 0.102781042f},
-std::array<float,2>{0.616979957f, 0.623872876f},
-std::array<float,2>{0.950914443f, 0.444505632f},
-std::array<float,2>{0.198904768f, 0.842211902f},
-std::array<float,2>{0.10062699f, 0.00588080613f},
-std::array<float,2>{0.845038235f, 0.504297256f},
-std::array<float,2>{0.740377903f, 0.4329575f},
-std::array<float,2>{0.486933827f, 0.794193089f},
-std::array<float,2>{0.260377139f, 0.307567805f},
-std::array<float,2>{0.518348992f, 0.932569385f},
-std::array<float,2>{0.90211159f, 0.199397177f},
-std::array<float,2>{0.140403673f, 0.712257624f},
-std::array<float,2>{0.220814884f, 0.492212832f},
-std::array<float,2>{0.992555022f, 0.8692801f},
-std::array<float,2>{0.588365555f, 0.0867335722f},
-std::array<float,2>{0.329648316f, 0.589001477f},
-std::array<float,2>{0.38146469f, 0.157652318f},
-std::array<float,2>{0.6529181f, 0.663427711f},
-std::array<float,2>{0.78839612f, 0.318343103f},
-std::array<float,2>{0.0420448296f, 0.963692069f},
-std::array<float,2>{0.189742163f, 0.0583905689f},
-std::array<float,2>{0.941612244f, 0.544044852f},
-std::array<float,2>{0.621205032f, 0.386345506f},
-std::array<float,2>{0.349969894f, 0.764466584f},
-std::array<float,2>{0.419391572f, 0.280590415f},
-std::array<float,2>{0.686821103f, 0.885662019f},
-std::array<float,2>{0.779350519f, 0.228902042f},
-std::array<float,2>{0.0088562984f, 0.742951691f},
-std::array<float,2>{0.076356858f, 0.463529378f},
-std::array<float,2>{0.815402925f, 0.818576932f},
-std::array<float,2>{0.699530125f, 0.112804264f},
-std::array<float,2>{0.443656385f, 0.599527776f},
-std::array<float,2>{0.281466633f, 0.141332239f},
-std::array<float,2>{0.561815739f, 0.636827707f},
-std::array<float,2>{0.933701038f, 0.346156031f},
-std::array<float,2>{0.177563056f, 0.986457705f},
-std::array<float,2>{0.0356450826f, 0.211976841f},
-std::array<float,2>{0.791877806f, 0.694598496f},
-std::array<float,2>{0.643988192f, 0.292151123f},
-std::array<float,2>{0.386301041f, 0.913844347f},
-std::array<float,2>{0.341878116f, 0.408635587f},
-std::array<float,2>{0.578769207f, 0.797247171f},
-std::array<float,2>{0.988483787f, 0.0187329613f},
-std::array<float,2>{0.232622892f, 0.529542327f},
-std::array<float,2>{0.126343265f, 0.33790943f},
-std::array<float,2>{0.895067155f, 0.948366642f},
-std::array<float,2>{0.529972374f, 0.178135112f},
-std::array<float,2>{0.256632924f, 0.677841544f},
-std::array<float,2>{0.499151289f, 0.0736041069f},
-std::array<float,2>{0.747604787f, 0.567201078f},
-std::array<float,2>{0.854076982f, 0.478776246f},
-std::array<float,2>{0.103836872f, 0.84996444f},
-std::array<float,2>{0.168085396f, 0.160708576f},
-std::array<float,2>{0.910440981f, 0.65818584f},
-std::array<float,2>{0.540124595f, 0.315257281f},
-std::array<float,2>{0.299686134f, 0.967129052f},
-std::array<float,2>{0.457688212f, 0.497651398f},
-std::array<float,2>{0.71378535f, 0.871738195f},
-std::array<float,2>{0.840931654f, 0.0935364366f},
-std::array<float,2>{0.0921079963f, 0.592068672f},
-std::array<float,2>{0.0194018334f, 0.312055558f},
-std::array<float,2>{0.751185f, 0.937061131f},
-std::array<float,2>{0.664805591f, 0.196540356f},
-std::array<float,2>{0.425239861f, 0.715164781f},
-std::array<float,2>{0.366435558f, 0.00205088593f},
-std::array<float,2>{0.608010888f, 0.501995504f},
-std::array<float,2>{0.964584231f, 0.435079068f},
-std::array<float,2>{0.212166429f, 0.792702377f},
-std::array<float,2>{0.113108389f, 0.109085247f},
-std::array<float,2>{0.87251097f, 0.619684756f},
-std::array<float,2>{0.722131193f, 0.44118616f},
-std::array<float,2>{0.480336934f, 0.837544084f},
-std::array<float,2>{0.274746001f, 0.37096417f},
-std::array<float,2>{0.513911366f, 0.969576538f},
-std::array<float,2>{0.875238001f, 0.133383393f},
-std::array<float,2>{0.14344196f, 0.648474157f},
-std::array<float,2>{0.246229321f, 0.401895046f},
-std::array<float,2>{0.971211076f, 0.775149882f},
-std::array<float,2>{0.572045147f, 0.034631405f},
-std::array<float,2>{0.32136324f, 0.554109931f},
-std::array<float,2>{0.393174648f, 0.236593977f},
-std::array<float,2>{0.628779769f, 0.72525382f},
-std::array<float,2>{0.798757374f, 0.254361451f},
-std::array<float,2>{0.0479164012f, 0.902390838f},
-std::array<float,2>{0.150083065f, 0.0846094191f},
-std::array<float,2>{0.886226594f, 0.584707379f},
-std::array<float,2>{0.503174901f, 0.491063893f},
-std::array<float,2>{0.273002982f, 0.865617812f},
-std::array<float,2>{0.474521995f, 0.323379546f},
-std::array<float,2>{0.729337811f, 0.956277013f},
-std::array<float,2>{0.862230361f, 0.165834218f},
-std::array<float,2>{0.122780301f, 0.668063641f},
-std::array<float,2>{0.0579777397f, 0.422385037f},
-std::array<float,2>{0.806759596f, 0.781330049f},
-std::array<float,2>{0.638251066f, 0.0109952586f},
-std::array<float,2>{0.402422339f, 0.51316613f},
-std::array<float,2>{0.317560256f, 0.18784526f},
-std::array<float,2>{0.569236994f, 0.705072343f},
-std::array<float,2>{0.978238225f, 0.298184603f},
-std::array<float,2>{0.241400376f, 0.922368526f},
-std::array<float,2>{0.0783582628f, 0.127517253f},
-std::array<float,2>{0.830194354f, 0.644993782f},
-std::array<float,2>{0.703216553f, 0.364017099f},
-std::array<float,2>{0.465573907f, 0.978152812f},
-std::array<float,2>{0.306230634f, 0.449695855f},
-std::array<float,2>{0.534961104f, 0.829138458f},
-std::array<float,2>{0.921602786f, 0.10101641f},
-std::array<float,2>{0.160142824f, 0.613536716f},
-std::array<float,2>{0.20978111f, 0.258238792f},
-std::array<float,2>{0.956713021f, 0.894468546f},
-std::array<float,2>{0.59428978f, 0.248367712f},
-std::array<float,2>{0.374009848f, 0.727594197f},
-std::array<float,2>{0.431041628f, 0.0423149392f},
-std::array<float,2>{0.659018219f, 0.557180524f},
-std::array<float,2>{0.763807118f, 0.392354071f},
-std::array<float,2>{0.0277818851f, 0.767446876f},
-std::array<float,2>{0.224996284f, 0.220885098f},
-std::array<float,2>{0.996411622f, 0.736723661f},
-std::array<float,2>{0.593206108f, 0.271773756f},
-std::array<float,2>{0.334055185f, 0.879382849f},
-std::array<float,2>{0.375713706f, 0.378226876f},
-std::array<float,2>{0.650287628f, 0.756387532f},
-std::array<float,2>{0.783772945f, 0.0506877117f},
-std::array<float,2>{0.0451242551f, 0.532738924f},
-std::array<float,2>{0.096312277f, 0.354411006f},
-std::array<float,2>{0.850192249f, 0.995315254f},
-std::array<float,2>{0.736440301f, 0.151402831f},
-std::array<float,2>{0.492107421f, 0.626803696f},
-std::array<float,2>{0.263094217f, 0.122952573f},
-std::array<float,2>{0.522978723f, 0.60183847f},
-std::array<float,2>{0.903299034f, 0.4606677f},
-std::array<float,2>{0.134950951f, 0.827640057f},
-std::array<float,2>{0.00444017863f, 0.0306450222f},
-std::array<float,2>{0.767606795f, 0.518570662f},
-std::array<float,2>{0.677031636f, 0.414183766f},
-std::array<float,2>{0.413269758f, 0.80924058f},
-std::array<float,2>{0.353610277f, 0.28256321f},
-std::array<float,2>{0.611865878f, 0.919517338f},
-std::array<float,2>{0.948997915f, 0.209719554f},
-std::array<float,2>{0.199397013f, 0.701738834f},
-std::array<float,2>{0.180840075f, 0.47173053f},
-std::array<float,2>{0.924671173f, 0.851624846f},
-std::array<float,2>{0.547345102f, 0.0702148154f},
-std::array<float,2>{0.295657098f, 0.571715891f},
-std::array<float,2>{0.445615441f, 0.18393214f},
-std::array<float,2>{0.691348732f, 0.684523284f},
-std::array<float,2>{0.826365709f, 0.331734806f},
-std::array<float,2>{0.0654735863f, 0.939964473f},
-std::array<float,2>{0.172254905f, 0.0130723109f},
-std::array<float,2>{0.930631518f, 0.508329511f},
-std::array<float,2>{0.558474481f, 0.429144353f},
-std::array<float,2>{0.286257148f, 0.787189603f},
-std::array<float,2>{0.437505126f, 0.300858527f},
-std::array<float,2>{0.696247816f, 0.926995933f},
-std::array<float,2>{0.818560719f, 0.193469286f},
-std::array<float,2>{0.0731992051f, 0.71013093f},
-std::array<float,2>{0.0139184957f, 0.485957533f},
-std::array<float,2>{0.773743033f, 0.85941577f},
-std::array<float,2>{0.681048036f, 0.0791665912f},
-std::array<float,2>{0.41453144f, 0.579160392f},
-std::array<float,2>{0.34525007f, 0.169993028f},
-std::array<float,2>{0.619543374f, 0.665980041f},
-std::array<float,2>{0.93755126f, 0.327190757f},
-std::array<float,2>{0.193893522f, 0.958956778f},
-std::array<float,2>{0.106590919f, 0.244607821f},
-std::array<float,2>{0.857311726f, 0.734276175f},
-std::array<float,2>{0.743904293f, 0.265564919f},
-std::array<float,2>{0.492542148f, 0.896316051f},
-std::array<float,2>{0.250459284f, 0.397828132f},
-std::array<float,2>{0.525727987f, 0.77118969f},
-std::array<float,2>{0.892725646f, 0.0462096557f},
-std::array<float,2>{0.129362732f, 0.560182095f},
-std::array<float,2>{0.228305593f, 0.361702055f},
-std::array<float,2>{0.98489511f, 0.981317043f},
-std::array<float,2>{0.584291995f, 0.128963634f},
-std::array<float,2>{0.338171363f, 0.640712976f},
-std::array<float,2>{0.389394432f, 0.0969987214f},
-std::array<float,2>{0.645071924f, 0.610042989f},
-std::array<float,2>{0.796068311f, 0.448232263f},
-std::array<float,2>{0.0334796086f, 0.832210898f},
-std::array<float,2>{0.218746081f, 0.155600205f},
-std::array<float,2>{0.96867913f, 0.629857838f},
-std::array<float,2>{0.604285181f, 0.357043028f},
-std::array<float,2>{0.363246351f, 0.999436259f},
-std::array<float,2>{0.428073555f, 0.454532117f},
-std::array<float,2>{0.668073475f, 0.823712707f},
-std::array<float,2>{0.754909575f, 0.120036364f},
-std::array<float,2>{0.0232319776f, 0.609091759f},
-std::array<float,2>{0.0877846405f, 0.266233593f},
-std::array<float,2>{0.838860273f, 0.877942502f},
-std::array<float,2>{0.71782428f, 0.226558253f},
-std::array<float,2>{0.455854923f, 0.740770817f},
-std::array<float,2>{0.304055393f, 0.050985653f},
-std::array<float,2>{0.546036363f, 0.538701892f},
-std::array<float,2>{0.906388819f, 0.380197287f},
-std::array<float,2>{0.164711341f, 0.753293812f},
-std::array<float,2>{0.051010564f, 0.0657913238f},
-std::array<float,2>{0.803425312f, 0.577798128f},
-std::array<float,2>{0.632453084f, 0.476244211f},
-std::array<float,2>{0.395881563f, 0.856482089f},
-std::array<float,2>{0.325778395f, 0.332795233f},
-std::array<float,2>{0.577306747f, 0.945300102f},
-std::array<float,2>{0.973755121f, 0.183255941f},
-std::array<float,2>{0.242851868f, 0.682469904f},
-std::array<float,2>{0.146983504f, 0.419325262f},
-std::array<float,2>{0.881759465f, 0.806196153f},
-std::array<float,2>{0.511537552f, 0.0246106815f},
-std::array<float,2>{0.278885961f, 0.522643983f},
-std::array<float,2>{0.480690062f, 0.204533294f},
-std::array<float,2>{0.723888814f, 0.695477545f},
-std::array<float,2>{0.867767036f, 0.286916822f},
-std::array<float,2>{0.116396822f, 0.914145947f},
-std::array<float,2>{0.237298042f, 0.1166045f},
-std::array<float,2>{0.981773555f, 0.596241295f},
-std::array<float,2>{0.564911067f, 0.466438711f},
-std::array<float,2>{0.316019565f, 0.81544596f},
-std::array<float,2>{0.400552988f, 0.35011813f},
-std::array<float,2>{0.635474324f, 0.991695762f},
-std::array<float,2>{0.809903622f, 0.147746459f},
-std::array<float,2>{0.0608247072f, 0.633147597f},
-std::array<float,2>{0.118289277f, 0.388310194f},
-std::array<float,2>{0.864866614f, 0.759187996f},
-std::array<float,2>{0.732972205f, 0.0593131185f},
-std::array<float,2>{0.468780279f, 0.542205274f},
-std::array<float,2>{0.266473949f, 0.232092798f},
-std::array<float,2>{0.50745517f, 0.746146917f},
-std::array<float,2>{0.890211105f, 0.276073486f},
-std::array<float,2>{0.153256744f, 0.887239873f},
-std::array<float,2>{0.0270176865f, 0.174809173f},
-std::array<float,2>{0.761576593f, 0.674322128f},
-std::array<float,2>{0.663631976f, 0.340296f},
-std::array<float,2>{0.437480688f, 0.951478541f},
-std::array<float,2>{0.367985815f, 0.481705278f},
-std::array<float,2>{0.601260543f, 0.84741652f},
-std::array<float,2>{0.957679152f, 0.0761317909f},
-std::array<float,2>{0.206226692f, 0.564432621f},
-std::array<float,2>{0.162170365f, 0.293217421f},
-std::array<float,2>{0.915410876f, 0.907838345f},
-std::array<float,2>{0.538983405f, 0.217838377f},
-std::array<float,2>{0.310871601f, 0.688431978f},
-std::array<float,2>{0.462346524f, 0.0232197121f},
-std::array<float,2>{0.709871292f, 0.524502993f},
-std::array<float,2>{0.835058451f, 0.410491437f},
-std::array<float,2>{0.0844397917f, 0.803866267f},
-std::array<float,2>{0.136912212f, 0.202979684f},
-std::array<float,2>{0.899048448f, 0.712897658f},
-std::array<float,2>{0.515887022f, 0.3050538f},
-std::array<float,2>{0.259030402f, 0.931505859f},
-std::array<float,2>{0.484931737f, 0.430894703f},
-std::array<float,2>{0.740161419f, 0.795605481f},
-std::array<float,2>{0.846184611f, 0.00557078561f},
-std::array<float,2>{0.0990435109f, 0.505991518f},
-std::array<float,2>{0.0400506333f, 0.319853842f},
-std::array<float,2>{0.78595829f, 0.962353706f},
-std::array<float,2>{0.65495193f, 0.159522042f},
-std::array<float,2>{0.380459547f, 0.660807848f},
-std::array<float,2>{0.330619246f, 0.0882074386f},
-std::array<float,2>{0.58653295f, 0.58713311f},
-std::array<float,2>{0.994237781f, 0.494842947f},
-std::array<float,2>{0.220523313f, 0.867735445f},
-std::array<float,2>{0.0688373372f, 0.0359982103f},
-std::array<float,2>{0.820620179f, 0.550051153f},
-std::array<float,2>{0.693257093f, 0.40314889f},
-std::array<float,2>{0.452134162f, 0.779521823f},
-std::array<float,2>{0.290583521f, 0.252583355f},
-std::array<float,2>{0.552345991f, 0.899364591f},
-std::array<float,2>{0.929324806f, 0.238648221f},
-std::array<float,2>{0.18429859f, 0.719290495f},
-std::array<float,2>{0.196167454f, 0.441748798f},
-std::array<float,2>{0.952642143f, 0.840030789f},
-std::array<float,2>{0.613533378f, 0.1043524f},
-std::array<float,2>{0.357265174f, 0.622826278f},
-std::array<float,2>{0.406945199f, 0.138925374f},
-std::array<float,2>{0.675249457f, 0.654911041f},
-std::array<float,2>{0.770340383f, 0.373965144f},
-std::array<float,2>{0.00201354665f, 0.975286603f},
-std::array<float,2>{0.248158813f, 0.033577539f},
-std::array<float,2>{0.96941036f, 0.552825987f},
-std::array<float,2>{0.573660195f, 0.401314974f},
-std::array<float,2>{0.32336092f, 0.773623884f},
-std::array<float,2>{0.391719908f, 0.255479604f},
-std::array<float,2>{0.626426697f, 0.903488159f},
-std::array<float,2>{0.800420582f, 0.237882763f},
-std::array<float,2>{0.049338486f, 0.7257725f},
-std::array<float,2>{0.111247681f, 0.44013536f},
-std::array<float,2>{0.874589324f, 0.836199641f},
-std::array<float,2>{0.719285369f, 0.107640088f},
-std::array<float,2>{0.477167159f, 0.621083736f},
-std::array<float,2>{0.275752068f, 0.13397266f},
-std::array<float,2>{0.511744559f, 0.649743319f},
-std::array<float,2>{0.877750993f, 0.369681567f},
-std::array<float,2>{0.142526716f, 0.969873965f},
-std::array<float,2>{0.0162630826f, 0.195797831f},
-std::array<float,2>{0.752242625f, 0.716653943f},
-std::array<float,2>{0.666819334f, 0.310586661f},
-std::array<float,2>{0.423013419f, 0.936229885f},
-std::array<float,2>{0.363504529f, 0.434100777f},
-std::array<float,2>{0.605584085f, 0.791802824f},
-std::array<float,2>{0.961351097f, 0.00294178165f},
-std::array<float,2>{0.213327318f, 0.503487468f},
-std::array<float,2>{0.170840636f, 0.31622836f},
-std::array<float,2>{0.913683116f, 0.968564093f},
-std::array<float,2>{0.541822791f, 0.161225602f},
-std::array<float,2>{0.297597706f, 0.657029867f},
-std::array<float,2>{0.459748447f, 0.0924990326f},
-std::array<float,2>{0.712286174f, 0.593119621f},
-std::array<float,2>{0.842936397f, 0.496982992f},
-std::array<float,2>{0.0906390473f, 0.872240365f},
-std::array<float,2>{0.128779098f, 0.179164603f},
-std::array<float,2>{0.896675587f, 0.679420352f},
-std::array<float,2>{0.528787911f, 0.339491427f},
-std::array<float,2>{0.253972828f, 0.947376668f},
-std::array<float,2>{0.497912616f, 0.480092496f},
-std::array<float,2>{0.748932123f, 0.851196408f},
-std::array<float,2>{0.852323353f, 0.0723959208f},
-std::array<float,2>{0.101851121f, 0.568326771f},
-std::array<float,2>{0.0372039154f, 0.291251481f},
-std::array<float,2>{0.790486097f, 0.912944436f},
-std::array<float,2>{0.641406536f, 0.211665481f},
-std::array<float,2>{0.383408606f, 0.693599641f},
-std::array<float,2>{0.341113061f, 0.0183760822f},
-std::array<float,2>{0.580345273f, 0.531130016f},
-std::array<float,2>{0.990992785f, 0.409251869f},
-std::array<float,2>{0.232380524f, 0.797979236f},
-std::array<float,2>{0.0760431886f, 0.112010173f},
-std::array<float,2>{0.814202249f, 0.597720087f},
-std::array<float,2>{0.702579916f, 0.464741558f},
-std::array<float,2>{0.442329675f, 0.819426298f},
-std::array<float,2>{0.284479648f, 0.347400248f},
-std::array<float,2>{0.560491085f, 0.98734504f},
-std::array<float,2>{0.935907364f, 0.141793832f},
-std::array<float,2>{0.177867472f, 0.638091862f},
-std::array<float,2>{0.189420879f, 0.384936213f},
-std::array<float,2>{0.944675326f, 0.76487267f},
-std::array<float,2>{0.624256194f, 0.0568721443f},
-std::array<float,2>{0.347966164f, 0.543524742f},
-std::array<float,2>{0.420019805f, 0.230400607f},
-std::array<float,2>{0.683767736f, 0.743628323f},
-std::array<float,2>{0.778011322f, 0.28000176f},
-std::array<float,2>{0.0104336534f, 0.885924578f},
-std::array<float,2>{0.181992382f, 0.069023557f},
-std::array<float,2>{0.922059178f, 0.570558965f},
-std::array<float,2>{0.550344765f, 0.471344769f},
-std::array<float,2>{0.294002086f, 0.852701068f},
-std::array<float,2>{0.447437435f, 0.330955476f},
-std::array<float,2>{0.689441442f, 0.941236615f},
-std::array<float,2>{0.825414002f, 0.185040876f},
-std::array<float,2>{0.0629177168f, 0.684661865f},
-std::array<float,2>{0.00672293361f, 0.415936232f},
-std::array<float,2>{0.766295075f, 0.810240448f},
-std::array<float,2>{0.679099381f, 0.0300726332f},
-std::array<float,2>{0.411337405f, 0.517695427f},
-std::array<float,2>{0.352597445f, 0.210620567f},
-std::array<float,2>{0.609630585f, 0.702766359f},
-std::array<float,2>{0.945861161f, 0.281949192f},
-std::array<float,2>{0.202259049f, 0.918794632f},
-std::array<float,2>{0.0949461609f, 0.151028067f},
-std::array<float,2>{0.848014653f, 0.625153899f},
-std::array<float,2>{0.735920608f, 0.354708582f},
-std::array<float,2>{0.489952445f, 0.994701505f},
-std::array<float,2>{0.263742834f, 0.459809542f},
-std::array<float,2>{0.519573748f, 0.826493502f},
-std::array<float,2>{0.9051615f, 0.12184298f},
-std::array<float,2>{0.134386465f, 0.603066564f},
-std::array<float,2>{0.223169491f, 0.273305655f},
-std::array<float,2>{0.998518407f, 0.880514205f},
-std::array<float,2>{0.590088367f, 0.22252667f},
-std::array<float,2>{0.33265987f, 0.737592578f},
-std::array<float,2>{0.378517658f, 0.0495279469f},
-std::array<float,2>{0.651671231f, 0.531683803f},
-std::array<float,2>{0.781978607f, 0.377446115f},
-std::array<float,2>{0.0432760529f, 0.757214785f},
-std::array<float,2>{0.207409322f, 0.249036074f},
-std::array<float,2>{0.95377183f, 0.727186143f},
-std::array<float,2>{0.596288383f, 0.259332627f},
-std::array<float,2>{0.371955276f, 0.892696917f},
-std::array<float,2>{0.432890832f, 0.391266048f},
-std::array<float,2>{0.656955421f, 0.765889049f},
-std::array<float,2>{0.762202024f, 0.0410298221f},
-std::array<float,2>{0.0296480116f, 0.557865202f},
-std::array<float,2>{0.080992952f, 0.365055263f},
-std::array<float,2>{0.828257978f, 0.977401376f},
-std::array<float,2>{0.706242621f, 0.128778085f},
-std::array<float,2>{0.466897219f, 0.646479011f},
-std::array<float,2>{0.307668358f, 0.0997198373f},
-std::array<float,2>{0.532349706f, 0.615107417f},
-std::array<float,2>{0.918478549f, 0.450400621f},
-std::array<float,2>{0.157147661f, 0.829084337f},
-std::array<float,2>{0.0552025475f, 0.0101324376f},
-std::array<float,2>{0.804882646f, 0.511860251f},
-std::array<float,2>{0.640202999f, 0.422880679f},
-std::array<float,2>{0.405582249f, 0.782455623f},
-std::array<float,2>{0.318797767f, 0.297721595f},
-std::array<float,2>{0.566571057f, 0.922958255f},
-std::array<float,2>{0.980299473f, 0.188737467f},
-std::array<float,2>{0.239819095f, 0.703199506f},
-std::array<float,2>{0.152262822f, 0.491309106f},
-std::array<float,2>{0.884533703f, 0.866711557f},
-std::array<float,2>{0.500600636f, 0.0852030292f},
-std::array<float,2>{0.27128166f, 0.585846722f},
-std::array<float,2>{0.475357682f, 0.164627776f},
-std::array<float,2>{0.727066219f, 0.669564545f},
-std::array<float,2>{0.859535098f, 0.322374612f},
-std::array<float,2>{0.123642385f, 0.955379725f},
-std::array<float,2>{0.144649893f, 0.0234948099f},
-std::array<float,2>{0.879145682f, 0.522131622f},
-std::array<float,2>{0.509636521f, 0.41805476f},
-std::array<float,2>{0.280143231f, 0.805483639f},
-std::array<float,2>{0.483891547f, 0.285233438f},
-std::array<float,2>{0.7259956f, 0.915611088f},
-std::array<float,2>{0.870239437f, 0.203215823f},
-std::array<float,2>{0.114044137f, 0.696664572f},
-std::array<float,2>{0.052773688f, 0.475063473f},
-std::array<float,2>{0.801756024f, 0.855647206f},
-std::array<float,2>{0.62903595f, 0.0651806369f},
-std::array<float,2>{0.397742897f, 0.576756537f},
-std::array<float,2>{0.327320784f, 0.182485074f},
-std::array<float,2>{0.57545346f, 0.683250546f},
-std::array<float,2>{0.974620342f, 0.333775908f},
-std::array<float,2>{0.245185524f, 0.943374932f},
-std::array<float,2>{0.0885838047f, 0.225230604f},
-std::array<float,2>{0.837229788f, 0.741817772f},
-std::array<float,2>{0.716412246f, 0.267277151f},
-std::array<float,2>{0.453539193f, 0.877493799f},
-std::array<float,2>{0.301689655f, 0.37969327f},
-std::array<float,2>{0.544003725f, 0.752734125f},
-std::array<float,2>{0.909185827f, 0.0517728142f},
-std::array<float,2>{0.166882247f, 0.537303329f},
-std::array<float,2>{0.216272622f, 0.355731905f},
-std::array<float,2>{0.965527594f, 0.998780429f},
-std::array<float,2>{0.601830006f, 0.155231178f},
-std::array<float,2>{0.360315472f, 0.630263865f},
-std::array<float,2>{0.426348299f, 0.120421894f},
-std::array<float,2>{0.670265138f, 0.607462287f},
-std::array<float,2>{0.757058322f, 0.45391503f},
-std::array<float,2>{0.0200351365f, 0.822423875f},
-std::array<float,2>{0.228984192f, 0.130148172f},
-std::array<float,2>{0.986824453f, 0.642344952f},
-std::array<float,2>{0.582173586f, 0.363196224f},
-std::array<float,2>{0.336960495f, 0.981993556f},
-std::array<float,2>{0.386946499f, 0.448399246f},
-std::array<float,2>{0.647108972f, 0.833301187f},
-std::array<float,2>{0.793908119f, 0.0964532346f},
-std::array<float,2>{0.0315814763f, 0.610451698f},
-std::array<float,2>{0.10867691f, 0.264123261f},
-std::array<float,2>{0.85750407f, 0.895499766f},
-std::array<float,2>{0.744454026f, 0.245841235f},
-std::array<float,2>{0.494556129f, 0.732914627f},
-std::array<float,2>{0.252724499f, 0.0451302752f},
-std::array<float,2>{0.524354339f, 0.558766484f},
-std::array<float,2>{0.891330421f, 0.396491259f},
-std::array<float,2>{0.132676512f, 0.770026922f},
-std::array<float,2>{0.0134659568f, 0.0787559301f},
-std::array<float,2>{0.775931001f, 0.578578055f},
-std::array<float,2>{0.681679368f, 0.484591842f},
-std::array<float,2>{0.417769492f, 0.860786021f},
-std::array<float,2>{0.346041322f, 0.326496482f},
-std::array<float,2>{0.618273258f, 0.957902849f},
-std::array<float,2>{0.940864146f, 0.171607524f},
-std::array<float,2>{0.191943511f, 0.664761245f},
-std::array<float,2>{0.174420893f, 0.427879661f},
-std::array<float,2>{0.932729661f, 0.788725853f},
-std::array<float,2>{0.555974543f, 0.012280941f},
-std::array<float,2>{0.289045781f, 0.509604454f},
-std::array<float,2>{0.439885318f, 0.194758579f},
-std::array<float,2>{0.69813776f, 0.709176958f},
-std::array<float,2>{0.817141771f, 0.301814139f},
-std::array<float,2>{0.0705942512f, 0.926380754f},
-std::array<float,2>{0.198110789f, 0.104926452f},
-std::array<float,2>{0.949499726f, 0.621128738f},
-std::array<float,2>{0.615706027f, 0.44260025f},
-std::array<float,2>{0.357703596f, 0.841776967f},
-std::array<float,2>{0.409038931f, 0.374605209f},
-std::array<float,2>{0.672957063f, 0.975699484f},
-std::array<float,2>{0.771602094f, 0.140072092f},
-std::array<float,2>{0.0019188117f, 0.655588627f},
-std::array<float,2>{0.067744948f, 0.403724849f},
-std::array<float,2>{0.822638631f, 0.781246662f},
-std::array<float,2>{0.694640756f, 0.0367370248f},
-std::array<float,2>{0.451127023f, 0.549740553f},
-std::array<float,2>{0.291341394f, 0.239420027f},
-std::array<float,2>{0.553031385f, 0.720171332f},
-std::array<float,2>{0.927729189f, 0.253166169f},
-std::array<float,2>{0.187177673f, 0.900115907f},
-std::array<float,2>{0.0410709381f, 0.158767849f},
-std::array<float,2>{0.787260652f, 0.66199255f},
-std::array<float,2>{0.653425217f, 0.318602055f},
-std::array<float,2>{0.382332146f, 0.961634278f},
-std::array<float,2>{0.328527838f, 0.495474309f},
-std::array<float,2>{0.58907944f, 0.869117439f},
-std::array<float,2>{0.99403131f, 0.0895584524f},
-std::array<float,2>{0.222533762f, 0.586421251f},
-std::array<float,2>{0.139644668f, 0.306574345f},
-std::array<float,2>{0.900733531f, 0.930332303f},
-std::array<float,2>{0.519308031f, 0.201545969f},
-std::array<float,2>{0.261256665f, 0.714621723f},
-std::array<float,2>{0.488201886f, 0.00457159569f},
-std::array<float,2>{0.74147892f, 0.507769167f},
-std::array<float,2>{0.844002426f, 0.430129945f},
-std::array<float,2>{0.0999754667f, 0.796851933f},
-std::array<float,2>{0.160838827f, 0.217033491f},
-std::array<float,2>{0.916121066f, 0.688516557f},
-std::array<float,2>{0.535736561f, 0.294561863f},
-std::array<float,2>{0.309309334f, 0.906671047f},
-std::array<float,2>{0.463191926f, 0.411972284f},
-std::array<float,2>{0.707166135f, 0.802781165f},
-std::array<float,2>{0.832622468f, 0.0220796019f},
-std::array<float,2>{0.0831295624f, 0.524384558f},
-std::array<float,2>{0.0236814823f, 0.341083527f},
-std::array<float,2>{0.758580983f, 0.952471256f},
-std::array<float,2>{0.660323441f, 0.174469024f},
-std::array<float,2>{0.434059381f, 0.675176978f},
-std::array<float,2>{0.369456023f, 0.0750690848f},
-std::array<float,2>{0.598721206f, 0.56280607f},
-std::array<float,2>{0.960906744f, 0.480600059f},
-std::array<float,2>{0.204011589f, 0.845881045f},
-std::array<float,2>{0.119798988f, 0.0599148646f},
-std::array<float,2>{0.865538895f, 0.541238487f},
-std::array<float,2>{0.731634498f, 0.387295842f},
-std::array<float,2>{0.471824616f, 0.757952571f},
-std::array<float,2>{0.267957836f, 0.277319521f},
-std::array<float,2>{0.505093753f, 0.888146222f},
-std::array<float,2>{0.887189746f, 0.230597809f},
-std::array<float,2>{0.15497531f, 0.747902393f},
-std::array<float,2>{0.235204548f, 0.465533882f},
-std::array<float,2>{0.982741773f, 0.814711094f},
-std::array<float,2>{0.563885093f, 0.115644835f},
-std::array<float,2>{0.312684983f, 0.59761709f},
-std::array<float,2>{0.398830026f, 0.146501571f},
-std::array<float,2>{0.632847607f, 0.634681702f},
-std::array<float,2>{0.8109442f, 0.351055682f},
-std::array<float,2>{0.0600985698f, 0.990775764f},
-std::array<float,2>{0.211390078f, 0.00169880851f},
-std::array<float,2>{0.963048398f, 0.501834333f},
-std::array<float,2>{0.6089347f, 0.436199874f},
-std::array<float,2>{0.366053969f, 0.789175928f},
-std::array<float,2>{0.424055636f, 0.310000122f},
-std::array<float,2>{0.665121317f, 0.933711708f},
-std::array<float,2>{0.750420213f, 0.198831379f},
-std::array<float,2>{0.0183684547f, 0.717372715f},
-std::array<float,2>{0.0936886743f, 0.498929024f},
-std::array<float,2>{0.839991927f, 0.873072386f},
-std::array<float,2>{0.714498341f, 0.0910161957f},
-std::array<float,2>{0.458782345f, 0.590288162f},
-std::array<float,2>{0.300203741f, 0.162924826f},
-std::array<float,2>{0.539134204f, 0.660020411f},
-std::array<float,2>{0.911528289f, 0.3134588f},
-std::array<float,2>{0.169508398f, 0.965560913f},
-std::array<float,2>{0.0471665449f, 0.234666497f},
-std::array<float,2>{0.797700405f, 0.724291205f},
-std::array<float,2>{0.627528191f, 0.257477313f},
-std::array<float,2>{0.39452967f, 0.904628098f},
-std::array<float,2>{0.320848465f, 0.399114698f},
-std::array<float,2>{0.57058537f, 0.776341558f},
-std::array<float,2>{0.972337484f, 0.0314399078f},
-std::array<float,2>{0.247456834f, 0.551674902f},
-std::array<float,2>{0.143704876f, 0.368347883f},
-std::array<float,2>{0.876080096f, 0.972448885f},
-std::array<float,2>{0.515179932f, 0.136686549f},
-std::array<float,2>{0.273674458f, 0.651484132f},
-std::array<float,2>{0.478590965f, 0.107096016f},
-std::array<float,2>{0.721670389f, 0.618430555f},
-std::array<float,2>{0.871637344f, 0.43773362f},
-std::array<float,2>{0.111675426f, 0.839025855f},
-std::array<float,2>{0.176725179f, 0.143208131f},
-std::array<float,2>{0.93539542f, 0.640207052f},
-std::array<float,2>{0.560934842f, 0.344152778f},
-std::array<float,2>{0.282408446f, 0.98584789f},
-std::array<float,2>{0.44494465f, 0.462757558f},
-std::array<float,2>{0.701145947f, 0.816928804f},
-std::array<float,2>{0.815958321f, 0.111285336f},
-std::array<float,2>{0.0773429349f, 0.59984833f},
-std::array<float,2>{0.00869234093f, 0.277864069f},
-std::array<float,2>{0.780818224f, 0.883016169f},
-std::array<float,2>{0.686473191f, 0.227674559f},
-std::array<float,2>{0.418818265f, 0.744200528f},
-std::array<float,2>{0.350757986f, 0.0555761456f},
-std::array<float,2>{0.622783601f, 0.54511255f},
-std::array<float,2>{0.943337142f, 0.383625239f},
-std::array<float,2>{0.190732867f, 0.761773407f},
-std::array<float,2>{0.104504302f, 0.070936881f},
-std::array<float,2>{0.855282605f, 0.568571091f},
-std::array<float,2>{0.746202469f, 0.476932228f},
-std::array<float,2>{0.498248696f, 0.849351704f},
-std::array<float,2>{0.25725621f, 0.33634752f},
-std::array<float,2>{0.530542135f, 0.946918905f},
-std::array<float,2>{0.895889878f, 0.176163554f},
-std::array<float,2>{0.125322849f, 0.677218914f},
-std::array<float,2>{0.233587384f, 0.407554448f},
-std::array<float,2>{0.990001857f, 0.800424278f},
-std::array<float,2>{0.579632461f, 0.0168159734f},
-std::array<float,2>{0.343678743f, 0.52873826f},
-std::array<float,2>{0.384991467f, 0.214553773f},
-std::array<float,2>{0.642741978f, 0.693048596f},
-std::array<float,2>{0.792035639f, 0.290865332f},
-std::array<float,2>{0.0367512368f, 0.910221577f},
-std::array<float,2>{0.136264458f, 0.124854364f},
-std::array<float,2>{0.904276609f, 0.604899764f},
-std::array<float,2>{0.522115052f, 0.457900971f},
-std::array<float,2>{0.261747301f, 0.824402094f},
-std::array<float,2>{0.490754247f, 0.351651609f},
-std::array<float,2>{0.737625718f, 0.993577123f},
-std::array<float,2>{0.851056099f, 0.149072781f},
-std::array<float,2>{0.0971497595f, 0.627745271f},
-std::array<float,2>{0.0466027409f, 0.37692678f},
-std::array<float,2>{0.784705222f, 0.755233526f},
-std::array<float,2>{0.648912787f, 0.0475847647f},
-std::array<float,2>{0.376093596f, 0.534444928f},
-std::array<float,2>{0.335240126f, 0.22007072f},
-std::array<float,2>{0.592280328f, 0.736072779f},
-std::array<float,2>{0.997836888f, 0.270416617f},
-std::array<float,2>{0.225632548f, 0.881946623f},
-std::array<float,2>{0.0651570037f, 0.186055377f},
-std::array<float,2>{0.827351928f, 0.686433017f},
-std::array<float,2>{0.689579368f, 0.328630567f},
-std::array<float,2>{0.447154343f, 0.939301074f},
-std::array<float,2>{0.296022892f, 0.470240533f},
-std::array<float,2>{0.548286259f, 0.855066717f},
-std::array<float,2>{0.925502837f, 0.066548638f},
-std::array<float,2>{0.179791898f, 0.574104071f},
-std::array<float,2>{0.200658515f, 0.284155011f},
-std::array<float,2>{0.947809339f, 0.920411766f},
-std::array<float,2>{0.613156915f, 0.207569554f},
-std::array<float,2>{0.354792625f, 0.700996399f},
-std::array<float,2>{0.412706912f, 0.0288269743f},
-std::array<float,2>{0.675894678f, 0.516274273f},
-std::array<float,2>{0.768884897f, 0.416563064f},
-std::array<float,2>{0.00532207126f, 0.810981393f},
-std::array<float,2>{0.240841642f, 0.190865621f},
-std::array<float,2>{0.976705849f, 0.706515074f},
-std::array<float,2>{0.570303798f, 0.298889756f},
-std::array<float,2>{0.316669077f, 0.924007416f},
-std::array<float,2>{0.404139519f, 0.424964249f},
-std::array<float,2>{0.637413383f, 0.784190834f},
-std::array<float,2>{0.808099508f, 0.00903176703f},
-std::array<float,2>{0.0573189668f, 0.51555258f},
-std::array<float,2>{0.122055024f, 0.322227269f},
-std::array<float,2>{0.863120019f, 0.954614639f},
-std::array<float,2>{0.729888082f, 0.167905569f},
-std::array<float,2>{0.473413259f, 0.670676351f},
-std::array<float,2>{0.272198051f, 0.0820545033f},
-std::array<float,2>{0.502421021f, 0.583215117f},
-std::array<float,2>{0.885715067f, 0.489784539f},
-std::array<float,2>{0.149063021f, 0.863965213f},
-std::array<float,2>{0.0283240937f, 0.0400972404f},
-std::array<float,2>{0.765553713f, 0.555989325f},
-std::array<float,2>{0.659768283f, 0.392873526f},
-std::array<float,2>{0.430654168f, 0.769241273f},
-std::array<float,2>{0.374350429f, 0.2612409f},
-std::array<float,2>{0.595619559f, 0.89102757f},
-std::array<float,2>{0.955500007f, 0.247632504f},
-std::array<float,2>{0.209961191f, 0.730435669f},
-std::array<float,2>{0.158209771f, 0.452992737f},
-std::array<float,2>{0.920086861f, 0.831153035f},
-std::array<float,2>{0.533419728f, 0.0986813232f},
-std::array<float,2>{0.305085987f, 0.615806043f},
-std::array<float,2>{0.466537267f, 0.126164153f},
-std::array<float,2>{0.704460144f, 0.646595299f},
-std::array<float,2>{0.831861854f, 0.366195798f},
-std::array<float,2>{0.0793478042f, 0.978671908f},
-std::array<float,2>{0.165672854f, 0.0530782342f},
-std::array<float,2>{0.908147216f, 0.535311162f},
-std::array<float,2>{0.545012653f, 0.3814542f},
-std::array<float,2>{0.303349406f, 0.751622379f},
-std::array<float,2>{0.456199199f, 0.269237697f},
-std::array<float,2>{0.717469096f, 0.876181901f},
-std::array<float,2>{0.839520991f, 0.223333299f},
-std::array<float,2>{0.0863608941f, 0.739644468f},
-std::array<float,2>{0.0222662594f, 0.455218107f},
-std::array<float,2>{0.754370451f, 0.821323216f},
-std::array<float,2>{0.669467568f, 0.117861077f},
-std::array<float,2>{0.429612994f, 0.605617225f},
-std::array<float,2>{0.361849368f, 0.153420076f},
-std::array<float,2>{0.604856491f, 0.632197559f},
-std::array<float,2>{0.966971874f, 0.358801752f},
-std::array<float,2>{0.217095643f, 0.996411443f},
-std::array<float,2>{0.115444332f, 0.206005782f},
-std::array<float,2>{0.868340373f, 0.698347569f},
-std::array<float,2>{0.722668409f, 0.287585735f},
-std::array<float,2>{0.482283115f, 0.917833805f},
-std::array<float,2>{0.278002173f, 0.420083702f},
-std::array<float,2>{0.510453701f, 0.80737561f},
-std::array<float,2>{0.882372737f, 0.025669856f},
-std::array<float,2>{0.147724047f, 0.520138979f},
-std::array<float,2>{0.243927553f, 0.334675401f},
-std::array<float,2>{0.973427534f, 0.942449331f},
-std::array<float,2>{0.577028394f, 0.180622056f},
-std::array<float,2>{0.324696898f, 0.68021667f},
-std::array<float,2>{0.394545346f, 0.0642886311f},
-std::array<float,2>{0.631294072f, 0.57433629f},
-std::array<float,2>{0.804319978f, 0.472815037f},
-std::array<float,2>{0.051895313f, 0.858099043f},
-std::array<float,2>{0.194664463f, 0.168073833f},
-std::array<float,2>{0.938521445f, 0.66687268f},
-std::array<float,2>{0.62061733f, 0.325709552f},
-std::array<float,2>{0.34385097f, 0.960312188f},
-std::array<float,2>{0.415920913f, 0.487030804f},
-std::array<float,2>{0.68051374f, 0.861642599f},
-std::array<float,2>{0.774508953f, 0.0803932399f},
-std::array<float,2>{0.0151087148f, 0.581667602f},
-std::array<float,2>{0.0733604282f, 0.304167956f},
-std::array<float,2>{0.820069253f, 0.927949905f},
-std::array<float,2>{0.696524322f, 0.193325758f},
-std::array<float,2>{0.438490003f, 0.708065271f},
-std::array<float,2>{0.286000222f, 0.0140289003f},
-std::array<float,2>{0.556922793f, 0.511624098f},
-std::array<float,2>{0.931543469f, 0.426235467f},
-std::array<float,2>{0.173456892f, 0.786940455f},
-std::array<float,2>{0.0344681144f, 0.0943324938f},
-std::array<float,2>{0.795065105f, 0.613251448f},
-std::array<float,2>{0.645957828f, 0.445904493f},
-std::array<float,2>{0.390337884f, 0.834911466f},
-std::array<float,2>{0.338912308f, 0.359755427f},
-std::array<float,2>{0.585818648f, 0.983894408f},
-std::array<float,2>{0.985535264f, 0.131553307f},
-std::array<float,2>{0.226688936f, 0.642619193f},
-std::array<float,2>{0.12996988f, 0.395292372f},
-std::array<float,2>{0.893711746f, 0.771815777f},
-std::array<float,2>{0.526626706f, 0.0432953797f},
-std::array<float,2>{0.251447618f, 0.561240852f},
-std::array<float,2>{0.493386388f, 0.242494032f},
-std::array<float,2>{0.742228031f, 0.732251823f},
-std::array<float,2>{0.855717361f, 0.263584524f},
-std::array<float,2>{0.106212974f, 0.896729052f},
-std::array<float,2>{0.219157174f, 0.0873247311f},
-std::array<float,2>{0.995909989f, 0.588721693f},
-std::array<float,2>{0.587317407f, 0.494074255f},
-std::array<float,2>{0.331186086f, 0.870524704f},
-std::array<float,2>{0.379019886f, 0.31709972f},
-std::array<float,2>{0.655870795f, 0.964698732f},
-std::array<float,2>{0.786770105f, 0.157118425f},
-std::array<float,2>{0.039116703f, 0.662930131f},
-std::array<float,2>{0.0983760208f, 0.432133704f},
-std::array<float,2>{0.8475402f, 0.793309152f},
-std::array<float,2>{0.73858881f, 0.00686884206f},
-std::array<float,2>{0.485612184f, 0.505511582f},
-std::array<float,2>{0.258557439f, 0.201132566f},
-std::array<float,2>{0.516750336f, 0.711746693f},
-std::array<float,2>{0.899585843f, 0.307869881f},
-std::array<float,2>{0.138141513f, 0.933217108f},
-std::array<float,2>{0.00352106686f, 0.137181789f},
-std::array<float,2>{0.771265209f, 0.653297186f},
-std::array<float,2>{0.6743325f, 0.371364444f},
-std::array<float,2>{0.407778084f, 0.974584818f},
-std::array<float,2>{0.356303394f, 0.444121718f},
-std::array<float,2>{0.614274561f, 0.842863441f},
-std::array<float,2>{0.951722622f, 0.101940058f},
-std::array<float,2>{0.196525767f, 0.624204516f},
-std::array<float,2>{0.184586287f, 0.25075829f},
-std::array<float,2>{0.928646386f, 0.901935935f},
-std::array<float,2>{0.551341414f, 0.242024124f},
-std::array<float,2>{0.28968361f, 0.721508205f},
-std::array<float,2>{0.452984691f, 0.0381373763f},
-std::array<float,2>{0.691583395f, 0.54704237f},
-std::array<float,2>{0.822161436f, 0.406241834f},
-std::array<float,2>{0.0702358335f, 0.778600156f},
-std::array<float,2>{0.15413408f, 0.234193519f},
-std::array<float,2>{0.889525056f, 0.748534381f},
-std::array<float,2>{0.506260633f, 0.274840415f},
-std::array<float,2>{0.267529249f, 0.889189124f},
-std::array<float,2>{0.470534146f, 0.390140355f},
-std::array<float,2>{0.733717442f, 0.760674298f},
-std::array<float,2>{0.863995016f, 0.0614810549f},
-std::array<float,2>{0.11751543f, 0.539551675f},
-std::array<float,2>{0.06201813f, 0.348438174f},
-std::array<float,2>{0.808734298f, 0.989140511f},
-std::array<float,2>{0.635995328f, 0.145625845f},
-std::array<float,2>{0.402168274f, 0.636102974f},
-std::array<float,2>{0.315304458f, 0.113737553f},
-std::array<float,2>{0.566057622f, 0.595278323f},
-std::array<float,2>{0.980956495f, 0.4677279f},
-std::array<float,2>{0.237444565f, 0.813572407f},
-std::array<float,2>{0.0856685117f, 0.0213053767f},
-std::array<float,2>{0.834860623f, 0.52681756f},
-std::array<float,2>{0.71005702f, 0.413589388f},
-std::array<float,2>{0.461221337f, 0.802719951f},
-std::array<float,2>{0.31174019f, 0.295734257f},
-std::array<float,2>{0.537368715f, 0.908421218f},
-std::array<float,2>{0.914445579f, 0.216594726f},
-std::array<float,2>{0.163861766f, 0.690280497f},
-std::array<float,2>{0.205435976f, 0.48382324f},
-std::array<float,2>{0.958041131f, 0.843833864f},
-std::array<float,2>{0.599724233f, 0.0776409507f},
-std::array<float,2>{0.368781805f, 0.566313982f},
-std::array<float,2>{0.435774446f, 0.172723353f},
-std::array<float,2>{0.663016558f, 0.672341108f},
-std::array<float,2>{0.760302007f, 0.342309862f},
-std::array<float,2>{0.0261109266f, 0.950316191f},
-std::array<float,2>{0.245422199f, 0.0268975236f},
-std::array<float,2>{0.974856555f, 0.521328747f},
-std::array<float,2>{0.575299144f, 0.421596706f},
-std::array<float,2>{0.327418238f, 0.807992876f},
-std::array<float,2>{0.397506088f, 0.288187414f},
-std::array<float,2>{0.629332125f, 0.916926742f},
-std::array<float,2>{0.801415801f, 0.206481352f},
-std::array<float,2>{0.0530169457f, 0.698165059f},
-std::array<float,2>{0.113897905f, 0.474456847f},
-std::array<float,2>{0.870416641f, 0.858941078f},
-std::array<float,2>{0.725810468f, 0.0626062378f},
-std::array<float,2>{0.484175116f, 0.575639248f},
-std::array<float,2>{0.279876024f, 0.181332305f},
-std::array<float,2>{0.509459853f, 0.6813187f},
-std::array<float,2>{0.879273415f, 0.335201442f},
-std::array<float,2>{0.144784242f, 0.942374706f},
-std::array<float,2>{0.0204865355f, 0.224013507f},
-std::array<float,2>{0.757220924f, 0.739182889f},
-std::array<float,2>{0.669973075f, 0.268294334f},
-std::array<float,2>{0.426641613f, 0.87561059f},
-std::array<float,2>{0.360036701f, 0.382606804f},
-std::array<float,2>{0.601662159f, 0.750853181f},
-std::array<float,2>{0.965637743f, 0.0539521873f},
-std::array<float,2>{0.215846166f, 0.536787033f},
-std::array<float,2>{0.166569144f, 0.357602209f},
-std::array<float,2>{0.909490466f, 0.997343898f},
-std::array<float,2>{0.544262707f, 0.153101206f},
-std::array<float,2>{0.301319838f, 0.631221175f},
-std::array<float,2>{0.453159869f, 0.118553892f},
-std::array<float,2>{0.71656245f, 0.60721916f},
-std::array<float,2>{0.837145984f, 0.456487387f},
-std::array<float,2>{0.0888663679f, 0.820505798f},
-std::array<float,2>{0.132328346f, 0.131964311f},
-std::array<float,2>{0.891374588f, 0.644334316f},
-std::array<float,2>{0.523948431f, 0.360483319f},
-std::array<float,2>{0.252656907f, 0.983094692f},
-std::array<float,2>{0.494364381f, 0.446354508f},
-std::array<float,2>{0.744281411f, 0.835321784f},
-std::array<float,2>{0.857777894f, 0.0956104547f},
-std::array<float,2>{0.10843195f, 0.611510336f},
-std::array<float,2>{0.0314045139f, 0.261901766f},
-std::array<float,2>{0.793691874f, 0.898322701f},
-std::array<float,2>{0.647245526f, 0.243553996f},
-std::array<float,2>{0.387165517f, 0.730627179f},
-std::array<float,2>{0.337166518f, 0.0446328633f},
-std::array<float,2>{0.582277715f, 0.561886489f},
-std::array<float,2>{0.987235367f, 0.39566046f},
-std::array<float,2>{0.228638157f, 0.773028851f},
-std::array<float,2>{0.0704914033f, 0.0818254203f},
-std::array<float,2>{0.817085743f, 0.580456972f},
-std::array<float,2>{0.697857559f, 0.487913638f},
-std::array<float,2>{0.439565063f, 0.86297369f},
-std::array<float,2>{0.288652837f, 0.324968725f},
-std::array<float,2>{0.555745542f, 0.959920943f},
-std::array<float,2>{0.933067977f, 0.169081002f},
-std::array<float,2>{0.174798578f, 0.667456806f},
-std::array<float,2>{0.192350999f, 0.427319586f},
-std::array<float,2>{0.940472603f, 0.785192072f},
-std::array<float,2>{0.618590713f, 0.0149587076f},
-std::array<float,2>{0.345915616f, 0.510527611f},
-std::array<float,2>{0.417720944f, 0.191658527f},
-std::array<float,2>{0.68205291f, 0.707297385f},
-std::array<float,2>{0.776192725f, 0.302787453f},
-std::array<float,2>{0.0133577185f, 0.929644525f},
-std::array<float,2>{0.18733786f, 0.103323072f},
-std::array<float,2>{0.927268982f, 0.623416305f},
-std::array<float,2>{0.552845716f, 0.445169628f},
-std::array<float,2>{0.291050166f, 0.842316031f},
-std::array<float,2>{0.450791895f, 0.372746885f},
-std::array<float,2>{0.694479108f, 0.973370969f},
-std::array<float,2>{0.82237798f, 0.137910992f},
-std::array<float,2>{0.0676093325f, 0.654295146f},
-std::array<float,2>{0.00157417392f, 0.405149788f},
-std::array<float,2>{0.771922767f, 0.777504981f},
-std::array<float,2>{0.673274219f, 0.0376524664f},
-std::array<float,2>{0.408803344f, 0.548385024f},
-std::array<float,2>{0.357441753f, 0.24046801f},
-std::array<float,2>{0.615297973f, 0.721976042f},
-std::array<float,2>{0.949388444f, 0.251771867f},
-std::array<float,2>{0.197891429f, 0.900920987f},
-std::array<float,2>{0.0998366177f, 0.158045068f},
-std::array<float,2>{0.84376353f, 0.663848698f},
-std::array<float,2>{0.741296589f, 0.317392856f},
-std::array<float,2>{0.487931997f, 0.962966561f},
-std::array<float,2>{0.261591375f, 0.492728382f},
-std::array<float,2>{0.519214213f, 0.869654298f},
-std::array<float,2>{0.900398195f, 0.086231485f},
-std::array<float,2>{0.139353216f, 0.589653671f},
-std::array<float,2>{0.222404495f, 0.306950837f},
-std::array<float,2>{0.993739188f, 0.931897938f},
-std::array<float,2>{0.58918339f, 0.200121179f},
-std::array<float,2>{0.328230649f, 0.712427974f},
-std::array<float,2>{0.382726759f, 0.00669237133f},
-std::array<float,2>{0.653681993f, 0.504742265f},
-std::array<float,2>{0.787477732f, 0.433349073f},
-std::array<float,2>{0.0413553677f, 0.794479311f},
-std::array<float,2>{0.203836456f, 0.215549394f},
-std::array<float,2>{0.96046561f, 0.690434813f},
-std::array<float,2>{0.599109232f, 0.296640664f},
-std::array<float,2>{0.369146258f, 0.910021424f},
-std::array<float,2>{0.433628589f, 0.412385345f},
-std::array<float,2>{0.660425127f, 0.800934315f},
-std::array<float,2>{0.758486331f, 0.0198009182f},
-std::array<float,2>{0.0237858873f, 0.525950968f},
-std::array<float,2>{0.0834934711f, 0.343207061f},
-std::array<float,2>{0.832800508f, 0.950110734f},
-std::array<float,2>{0.707287967f, 0.17319271f},
-std::array<float,2>{0.463113844f, 0.673636556f},
-std::array<float,2>{0.309356272f, 0.0767537132f},
-std::array<float,2>{0.536073864f, 0.564936399f},
-std::array<float,2>{0.91632694f, 0.482440352f},
-std::array<float,2>{0.161085427f, 0.844820559f},
-std::array<float,2>{0.0603146814f, 0.0621914007f},
-std::array<float,2>{0.810595274f, 0.540147781f},
-std::array<float,2>{0.633065403f, 0.389452249f},
-std::array<float,2>{0.398483574f, 0.761231184f},
-std::array<float,2>{0.312753797f, 0.273568451f},
-std::array<float,2>{0.563559353f, 0.889934897f},
-std::array<float,2>{0.982492685f, 0.232983872f},
-std::array<float,2>{0.234871075f, 0.749538898f},
-std::array<float,2>{0.155063376f, 0.468328416f},
-std::array<float,2>{0.886889637f, 0.813320935f},
-std::array<float,2>{0.505275249f, 0.115207776f},
-std::array<float,2>{0.267817736f, 0.594131827f},
-std::array<float,2>{0.472008765f, 0.145072907f},
-std::array<float,2>{0.731822789f, 0.63495928f},
-std::array<float,2>{0.865405858f, 0.349223197f},
-std::array<float,2>{0.12007568f, 0.989322662f},
-std::array<float,2>{0.142128035f, 0.0325245969f},
-std::array<float,2>{0.877463341f, 0.552678108f},
-std::array<float,2>{0.512008846f, 0.399841249f},
-std::array<float,2>{0.275575548f, 0.776607931f},
-std::array<float,2>{0.477431476f, 0.255935073f},
-std::array<float,2>{0.719618917f, 0.905575335f},
-std::array<float,2>{0.874842465f, 0.236056954f},
-std::array<float,2>{0.110957503f, 0.72291702f},
-std::array<float,2>{0.0497594401f, 0.438770801f},
-std::array<float,2>{0.800607264f, 0.838709533f},
-std::array<float,2>{0.626047015f, 0.10565567f},
-std::array<float,2>{0.392040342f, 0.618014753f},
-std::array<float,2>{0.323626101f, 0.135556176f},
-std::array<float,2>{0.573391855f, 0.650644481f},
-std::array<float,2>{0.969641089f, 0.367194027f},
-std::array<float,2>{0.248313874f, 0.971262276f},
-std::array<float,2>{0.0905188546f, 0.197505876f},
-std::array<float,2>{0.843146503f, 0.718003571f},
-std::array<float,2>{0.711989701f, 0.309146255f},
-std::array<float,2>{0.459602445f, 0.935208857f},
-std::array<float,2>{0.29769367f, 0.437407255f},
-std::array<float,2>{0.541695535f, 0.790871859f},
-std::array<float,2>{0.913880765f, 6.14916717e-05f},
-std::array<float,2>{0.170610622f, 0.500577927f},
-std::array<float,2>{0.212895393f, 0.313708007f},
-std::array<float,2>{0.961116076f, 0.966251254f},
-std::array<float,2>{0.605732679f, 0.163132936f},
-std::array<float,2>{0.363570273f, 0.658307195f},
-std::array<float,2>{0.423161536f, 0.0903087556f},
-std::array<float,2>{0.666739106f, 0.591774404f},
-std::array<float,2>{0.752111077f, 0.49969703f},
-std::array<float,2>{0.016596742f, 0.874861002f},
-std::array<float,2>{0.231959745f, 0.177083775f},
-std::array<float,2>{0.990810275f, 0.675879538f},
-std::array<float,2>{0.580311894f, 0.33726114f},
-std::array<float,2>{0.341006845f, 0.945350111f},
-std::array<float,2>{0.383659244f, 0.478177369f},
-std::array<float,2>{0.641146243f, 0.847896278f},
-std::array<float,2>{0.790270865f, 0.0719563141f},
-std::array<float,2>{0.0374207944f, 0.570239127f},
-std::array<float,2>{0.101731397f, 0.289435089f},
-std::array<float,2>{0.852167428f, 0.911619127f},
-std::array<float,2>{0.748742819f, 0.213688344f},
-std::array<float,2>{0.497737139f, 0.692119658f},
-std::array<float,2>{0.254151762f, 0.0165737122f},
-std::array<float,2>{0.528546453f, 0.528166175f},
-std::array<float,2>{0.896861613f, 0.406610757f},
-std::array<float,2>{0.128493086f, 0.799347878f},
-std::array<float,2>{0.0106005603f, 0.109790668f},
-std::array<float,2>{0.778294444f, 0.601356804f},
-std::array<float,2>{0.68407172f, 0.461603314f},
-std::array<float,2>{0.420196116f, 0.817683995f},
-std::array<float,2>{0.347726703f, 0.345134526f},
-std::array<float,2>{0.624407828f, 0.985028028f},
-std::array<float,2>{0.944535196f, 0.144113436f},
-std::array<float,2>{0.188999087f, 0.639125168f},
-std::array<float,2>{0.178088769f, 0.384432733f},
-std::array<float,2>{0.935697675f, 0.762876272f},
-std::array<float,2>{0.560258389f, 0.0557205565f},
-std::array<float,2>{0.284401774f, 0.546022177f},
-std::array<float,2>{0.442013502f, 0.227226436f},
-std::array<float,2>{0.702356339f, 0.745514274f},
-std::array<float,2>{0.814404488f, 0.278633058f},
-std::array<float,2>{0.0757396966f, 0.884324789f},
-std::array<float,2>{0.20252578f, 0.0679139346f},
-std::array<float,2>{0.946084917f, 0.572519243f},
-std::array<float,2>{0.609571159f, 0.469514817f},
-std::array<float,2>{0.352932841f, 0.853664756f},
-std::array<float,2>{0.411493719f, 0.329464316f},
-std::array<float,2>{0.67892915f, 0.937736273f},
-std::array<float,2>{0.766388655f, 0.186628908f},
-std::array<float,2>{0.00658932468f, 0.687125921f},
-std::array<float,2>{0.0625856891f, 0.417841405f},
-std::array<float,2>{0.82548517f, 0.811950564f},
-std::array<float,2>{0.68905133f, 0.0278110914f},
-std::array<float,2>{0.447615355f, 0.517373979f},
-std::array<float,2>{0.294377536f, 0.208404243f},
-std::array<float,2>{0.550742745f, 0.699806213f},
-std::array<float,2>{0.922173381f, 0.285119623f},
-std::array<float,2>{0.181753442f, 0.921691477f},
-std::array<float,2>{0.0430890843f, 0.149480805f},
-std::array<float,2>{0.781987548f, 0.628054023f},
-std::array<float,2>{0.651534319f, 0.35316813f},
-std::array<float,2>{0.378886759f, 0.992609918f},
-std::array<float,2>{0.332764894f, 0.458212346f},
-std::array<float,2>{0.589955568f, 0.825836957f},
-std::array<float,2>{0.998268843f, 0.12347918f},
-std::array<float,2>{0.22354874f, 0.603886664f},
-std::array<float,2>{0.134625584f, 0.270949125f},
-std::array<float,2>{0.905015111f, 0.881310463f},
-std::array<float,2>{0.519835949f, 0.219362795f},
-std::array<float,2>{0.264109373f, 0.73465699f},
-std::array<float,2>{0.490114599f, 0.047994189f},
-std::array<float,2>{0.736280799f, 0.533866763f},
-std::array<float,2>{0.847880185f, 0.375628501f},
-std::array<float,2>{0.0952028707f, 0.754611671f},
-std::array<float,2>{0.156876072f, 0.24699676f},
-std::array<float,2>{0.918745041f, 0.728649318f},
-std::array<float,2>{0.532530785f, 0.260303259f},
-std::array<float,2>{0.307964563f, 0.892132163f},
-std::array<float,2>{0.467207968f, 0.393955022f},
-std::array<float,2>{0.706437469f, 0.768160343f},
-std::array<float,2>{0.828410864f, 0.0392814353f},
-std::array<float,2>{0.0807446912f, 0.554898798f},
-std::array<float,2>{0.0293692909f, 0.366334558f},
-std::array<float,2>{0.761729062f, 0.980169654f},
-std::array<float,2>{0.657066166f, 0.125872523f},
-std::array<float,2>{0.432762265f, 0.647584438f},
-std::array<float,2>{0.371687561f, 0.0983923003f},
-std::array<float,2>{0.596607804f, 0.61661607f},
-std::array<float,2>{0.954050899f, 0.451953292f},
-std::array<float,2>{0.207204893f, 0.83010143f},
-std::array<float,2>{0.124014787f, 0.00818180852f},
-std::array<float,2>{0.859861493f, 0.514176071f},
-std::array<float,2>{0.727305472f, 0.424117446f},
-std::array<float,2>{0.475193411f, 0.783861816f},
-std::array<float,2>{0.271027416f, 0.300321579f},
-std::array<float,2>{0.500890493f, 0.925300777f},
-std::array<float,2>{0.88441056f, 0.190046906f},
-std::array<float,2>{0.1520648f, 0.705498278f},
-std::array<float,2>{0.240046769f, 0.488792479f},
-std::array<float,2>{0.980172157f, 0.864941835f},
-std::array<float,2>{0.566729605f, 0.0834901556f},
-std::array<float,2>{0.318360627f, 0.582840085f},
-std::array<float,2>{0.405388921f, 0.166661829f},
-std::array<float,2>{0.64056325f, 0.671607971f},
-std::array<float,2>{0.805094242f, 0.32035163f},
-std::array<float,2>{0.0555738211f, 0.953345418f},
-std::array<float,2>{0.216885343f, 0.051704675f},
-std::array<float,2>{0.967121542f, 0.538160801f},
-std::array<float,2>{0.604704797f, 0.380787432f},
-std::array<float,2>{0.362240344f, 0.753486097f},
-std::array<float,2>{0.429257214f, 0.26573807f},
-std::array<float,2>{0.669775009f, 0.878468335f},
-std::array<float,2>{0.754003406f, 0.22581166f},
-std::array<float,2>{0.0221067183f, 0.740608275f},
-std::array<float,2>{0.0860943943f, 0.455077589f},
-std::array<float,2>{0.83984226f, 0.823732257f},
-std::array<float,2>{0.717570007f, 0.119143397f},
-std::array<float,2>{0.456302553f, 0.608429551f},
-std::array<float,2>{0.30357039f, 0.156232968f},
-std::array<float,2>{0.54522717f, 0.628965974f},
-std::array<float,2>{0.907826066f, 0.356889039f},
-std::array<float,2>{0.165897578f, 0.999945402f},
-std::array<float,2>{0.0520896614f, 0.204651371f},
-std::array<float,2>{0.804573119f, 0.695942223f},
-std::array<float,2>{0.631097317f, 0.286415726f},
-std::array<float,2>{0.395005971f, 0.91499567f},
-std::array<float,2>{0.324365586f, 0.419780612f},
-std::array<float,2>{0.576720476f, 0.806021988f},
-std::array<float,2>{0.973197341f, 0.0249808095f},
-std::array<float,2>{0.243808866f, 0.523229063f},
-std::array<float,2>{0.147499934f, 0.332155317f},
-std::array<float,2>{0.88260448f, 0.944592416f},
-std::array<float,2>{0.510656893f, 0.183062315f},
-std::array<float,2>{0.27817744f, 0.68176496f},
-std::array<float,2>{0.482079089f, 0.0661286116f},
-std::array<float,2>{0.723070264f, 0.577500761f},
-std::array<float,2>{0.868540347f, 0.475805193f},
-std::array<float,2>{0.11570131f, 0.857091725f},
-std::array<float,2>{0.173599467f, 0.170449644f},
-std::array<float,2>{0.931347132f, 0.665279746f},
-std::array<float,2>{0.55685991f, 0.327722818f},
-std::array<float,2>{0.285735905f, 0.958009064f},
-std::array<float,2>{0.438738018f, 0.485690027f},
-std::array<float,2>{0.696600139f, 0.860242605f},
-std::array<float,2>{0.819829881f, 0.0796713158f},
-std::array<float,2>{0.0735665932f, 0.5799281f},
-std::array<float,2>{0.014759344f, 0.301721156f},
-std::array<float,2>{0.774848461f, 0.927580476f},
-std::array<float,2>{0.680330813f, 0.194268852f},
-std::array<float,2>{0.415527791f, 0.710558057f},
-std::array<float,2>{0.344155043f, 0.0132059688f},
-std::array<float,2>{0.621074378f, 0.507859826f},
-std::array<float,2>{0.938849628f, 0.4295353f},
-std::array<float,2>{0.19452624f, 0.787827253f},
-std::array<float,2>{0.106162928f, 0.0972816423f},
-std::array<float,2>{0.855649173f, 0.609511852f},
-std::array<float,2>{0.742612123f, 0.447449297f},
-std::array<float,2>{0.493601233f, 0.832787037f},
-std::array<float,2>{0.250983149f, 0.36186412f},
-std::array<float,2>{0.526610136f, 0.980533361f},
-std::array<float,2>{0.893823504f, 0.129674062f},
-std::array<float,2>{0.130308509f, 0.641374469f},
-std::array<float,2>{0.226887643f, 0.3982355f},
-std::array<float,2>{0.985641599f, 0.770566404f},
-std::array<float,2>{0.585449874f, 0.0464496613f},
-std::array<float,2>{0.339165121f, 0.559945643f},
-std::array<float,2>{0.39057371f, 0.245026633f},
-std::array<float,2>{0.645682812f, 0.733601153f},
-std::array<float,2>{0.795354486f, 0.264855385f},
-std::array<float,2>{0.0342485942f, 0.895929158f},
-std::array<float,2>{0.13785772f, 0.0884162039f},
-std::array<float,2>{0.899697363f, 0.587440848f},
-std::array<float,2>{0.516985655f, 0.494565964f},
-std::array<float,2>{0.25847584f, 0.867441714f},
-std::array<float,2>{0.485549659f, 0.319648147f},
-std::array<float,2>{0.738375485f, 0.96241498f},
-std::array<float,2>{0.847249806f, 0.160042852f},
-std::array<float,2>{0.0986053273f, 0.660443485f},
-std::array<float,2>{0.0394400097f, 0.431620508f},
-std::array<float,2>{0.787022293f, 0.79538399f},
-std::array<float,2>{0.656014085f, 0.00532685174f},
-std::array<float,2>{0.37915197f, 0.506637514f},
-std::array<float,2>{0.331345469f, 0.202423528f},
-std::array<float,2>{0.587140679f, 0.713758767f},
-std::array<float,2>{0.995768607f, 0.305470198f},
-std::array<float,2>{0.218867078f, 0.930889547f},
-std::array<float,2>{0.0699401349f, 0.139379442f},
-std::array<float,2>{0.821987092f, 0.654660761f},
-std::array<float,2>{0.691787422f, 0.373310417f},
-std::array<float,2>{0.452816248f, 0.974812448f},
-std::array<float,2>{0.289982617f, 0.44203341f},
-std::array<float,2>{0.551725924f, 0.840743423f},
-std::array<float,2>{0.92826575f, 0.103884697f},
-std::array<float,2>{0.184992164f, 0.622474372f},
-std::array<float,2>{0.196773395f, 0.25208649f},
-std::array<float,2>{0.951961696f, 0.898923159f},
-std::array<float,2>{0.61460501f, 0.23896417f},
-std::array<float,2>{0.356200933f, 0.718893468f},
-std::array<float,2>{0.408008933f, 0.0352437422f},
-std::array<float,2>{0.674736083f, 0.55068481f},
-std::array<float,2>{0.771057665f, 0.402544826f},
-std::array<float,2>{0.00380170322f, 0.78016454f},
-std::array<float,2>{0.237760559f, 0.231619656f},
-std::array<float,2>{0.980679274f, 0.746619225f},
-std::array<float,2>{0.566327035f, 0.275493294f},
-std::array<float,2>{0.314968526f, 0.887010217f},
-std::array<float,2>{0.402066648f, 0.387748569f},
-std::array<float,2>{0.635834336f, 0.759375036f},
-std::array<float,2>{0.808946431f, 0.0589470044f},
-std::array<float,2>{0.062286187f, 0.542607605f},
-std::array<float,2>{0.117229857f, 0.349965483f},
-std::array<float,2>{0.864044726f, 0.991748095f},
-std::array<float,2>{0.733443737f, 0.148175061f},
-std::array<float,2>{0.470328152f, 0.633397341f},
-std::array<float,2>{0.267223448f, 0.117143556f},
-std::array<float,2>{0.506015837f, 0.595772088f},
-std::array<float,2>{0.889326394f, 0.465833277f},
-std::array<float,2>{0.153865054f, 0.816029549f},
-std::array<float,2>{0.0261574481f, 0.0226863734f},
-std::array<float,2>{0.760605454f, 0.525270283f},
-std::array<float,2>{0.662835956f, 0.41107136f},
-std::array<float,2>{0.436005533f, 0.80421859f},
-std::array<float,2>{0.369133323f, 0.293729693f},
-std::array<float,2>{0.599898756f, 0.907326221f},
-std::array<float,2>{0.95843792f, 0.218521073f},
-std::array<float,2>{0.205228597f, 0.687854826f},
-std::array<float,2>{0.163726375f, 0.482081532f},
-std::array<float,2>{0.914111316f, 0.846984744f},
-std::array<float,2>{0.537259698f, 0.0753490478f},
-std::array<float,2>{0.311805427f, 0.563558221f},
-std::array<float,2>{0.461056203f, 0.175501511f},
-std::array<float,2>{0.710289955f, 0.673830271f},
-std::array<float,2>{0.834509492f, 0.340482086f},
-std::array<float,2>{0.0858829543f, 0.951663733f},
-std::array<float,2>{0.169755295f, 0.00285311812f},
-std::array<float,2>{0.911330402f, 0.502794504f},
-std::array<float,2>{0.539328277f, 0.434919298f},
-std::array<float,2>{0.299955308f, 0.792324066f},
-std::array<float,2>{0.458663106f, 0.311763108f},
-std::array<float,2>{0.71468395f, 0.936671317f},
-std::array<float,2>{0.840177715f, 0.196813926f},
-std::array<float,2>{0.0932880491f, 0.715500236f},
-std::array<float,2>{0.0182323009f, 0.497387677f},
-std::array<float,2>{0.750047803f, 0.871294975f},
-std::array<float,2>{0.665370643f, 0.0930214003f},
-std::array<float,2>{0.42422834f, 0.592683375f},
-std::array<float,2>{0.365913332f, 0.160530075f},
-std::array<float,2>{0.609286547f, 0.657465518f},
-std::array<float,2>{0.963211954f, 0.314760596f},
-std::array<float,2>{0.2111101f, 0.967335641f},
-std::array<float,2>{0.111416318f, 0.237164646f},
-std::array<float,2>{0.871966541f, 0.724895775f},
-std::array<float,2>{0.721385777f, 0.254441142f},
-std::array<float,2>{0.479000479f, 0.902868807f},
-std::array<float,2>{0.273858279f, 0.401662916f},
-std::array<float,2>{0.515543997f, 0.774539888f},
-std::array<float,2>{0.87631315f, 0.0349832512f},
-std::array<float,2>{0.14392966f, 0.554627419f},
-std::array<float,2>{0.247278303f, 0.370225757f},
-std::array<float,2>{0.97244221f, 0.968793273f},
-std::array<float,2>{0.570495486f, 0.133227289f},
-std::array<float,2>{0.321058124f, 0.648955286f},
-std::array<float,2>{0.39423582f, 0.108420908f},
-std::array<float,2>{0.627903938f, 0.619247556f},
-std::array<float,2>{0.797383785f, 0.440735042f},
-std::array<float,2>{0.0470469855f, 0.83722645f},
-std::array<float,2>{0.190433592f, 0.141081795f},
-std::array<float,2>{0.943071604f, 0.637272239f},
-std::array<float,2>{0.622961879f, 0.346345365f},
-std::array<float,2>{0.350870967f, 0.986829102f},
-std::array<float,2>{0.418549001f, 0.463044107f},
-std::array<float,2>{0.686076343f, 0.81910938f},
-std::array<float,2>{0.78113544f, 0.112610325f},
-std::array<float,2>{0.00834457017f, 0.598896623f},
-std::array<float,2>{0.0774449557f, 0.281151444f},
-std::array<float,2>{0.816282451f, 0.885005355f},
-std::array<float,2>{0.700686455f, 0.229417413f},
-std::array<float,2>{0.445159644f, 0.742414474f},
-std::array<float,2>{0.282712072f, 0.0577097572f},
-std::array<float,2>{0.560677469f, 0.544446766f},
-std::array<float,2>{0.935249329f, 0.385777742f},
-std::array<float,2>{0.176438645f, 0.76379317f},
-std::array<float,2>{0.0369180478f, 0.0741419718f},
-std::array<float,2>{0.7924155f, 0.566827655f},
-std::array<float,2>{0.643056989f, 0.479467601f},
-std::array<float,2>{0.385214597f, 0.850285709f},
-std::array<float,2>{0.343432367f, 0.338633239f},
-std::array<float,2>{0.58005923f, 0.949200213f},
-std::array<float,2>{0.989834785f, 0.178506017f},
-std::array<float,2>{0.233839199f, 0.678236604f},
-std::array<float,2>{0.125086844f, 0.408958435f},
-std::array<float,2>{0.89557302f, 0.797844589f},
-std::array<float,2>{0.530392051f, 0.0194879696f},
-std::array<float,2>{0.256868869f, 0.530196309f},
-std::array<float,2>{0.498308361f, 0.212664112f},
-std::array<float,2>{0.746408343f, 0.695175231f},
-std::array<float,2>{0.855159998f, 0.292754889f},
-std::array<float,2>{0.104848966f, 0.913198173f},
-std::array<float,2>{0.225991786f, 0.122137599f},
-std::array<float,2>{0.997560918f, 0.602538884f},
-std::array<float,2>{0.591947436f, 0.46017015f},
-std::array<float,2>{0.335002065f, 0.827275515f},
-std::array<float,2>{0.376394242f, 0.353846848f},
-std::array<float,2>{0.648505092f, 0.996083379f},
-std::array<float,2>{0.784922123f, 0.152338222f},
-std::array<float,2>{0.0466485843f, 0.62612164f},
-std::array<float,2>{0.096688807f, 0.378430873f},
-std::array<float,2>{0.850752652f, 0.756222546f},
-std::array<float,2>{0.737545848f, 0.0498802699f},
-std::array<float,2>{0.491186708f, 0.532614052f},
-std::array<float,2>{0.262002707f, 0.221516132f},
-std::array<float,2>{0.522296429f, 0.737217844f},
-std::array<float,2>{0.903931677f, 0.272372723f},
-std::array<float,2>{0.136684418f, 0.879625201f},
-std::array<float,2>{0.0049296245f, 0.184119478f},
-std::array<float,2>{0.768657327f, 0.6837672f},
-std::array<float,2>{0.67621845f, 0.331426442f},
-std::array<float,2>{0.41290912f, 0.939671695f},
-std::array<float,2>{0.354725003f, 0.472492605f},
-std::array<float,2>{0.612943769f, 0.85208261f},
-std::array<float,2>{0.948239982f, 0.0697907358f},
-std::array<float,2>{0.200221613f, 0.571929157f},
-std::array<float,2>{0.179955408f, 0.28310591f},
-std::array<float,2>{0.925731957f, 0.919212401f},
-std::array<float,2>{0.548035264f, 0.209268048f},
-std::array<float,2>{0.296217144f, 0.701231241f},
-std::array<float,2>{0.446811676f, 0.0310267769f},
-std::array<float,2>{0.689719319f, 0.519220889f},
-std::array<float,2>{0.82757473f, 0.414666355f},
-std::array<float,2>{0.0653438345f, 0.808878481f},
-std::array<float,2>{0.149307027f, 0.18821758f},
-std::array<float,2>{0.885487199f, 0.704541504f},
-std::array<float,2>{0.502111375f, 0.298770785f},
-std::array<float,2>{0.272263348f, 0.922319233f},
-std::array<float,2>{0.473339975f, 0.42231372f},
-std::array<float,2>{0.72962147f, 0.782072663f},
-std::array<float,2>{0.862916112f, 0.0114591066f},
-std::array<float,2>{0.121675f, 0.5135324f},
-std::array<float,2>{0.0574779212f, 0.324216843f},
-std::array<float,2>{0.807708561f, 0.956797183f},
-std::array<float,2>{0.637591004f, 0.165196657f},
-std::array<float,2>{0.403964072f, 0.668771148f},
-std::array<float,2>{0.316647232f, 0.0843243748f},
-std::array<float,2>{0.569893897f, 0.58425051f},
-std::array<float,2>{0.976939738f, 0.490708739f},
-std::array<float,2>{0.241200909f, 0.865909934f},
-std::array<float,2>{0.0792018622f, 0.0426664017f},
-std::array<float,2>{0.831663132f, 0.557039082f},
-std::array<float,2>{0.704300106f, 0.391764253f},
-std::array<float,2>{0.466717809f, 0.766732395f},
-std::array<float,2>{0.304688126f, 0.258509666f},
-std::array<float,2>{0.5336501f, 0.89386487f},
-std::array<float,2>{0.920178652f, 0.248608202f},
-std::array<float,2>{0.158508062f, 0.728272974f},
-std::array<float,2>{0.210282758f, 0.449707568f},
-std::array<float,2>{0.955217004f, 0.829987347f},
-std::array<float,2>{0.595270216f, 0.101429015f},
-std::array<float,2>{0.374156773f, 0.613810599f},
-std::array<float,2>{0.430352509f, 0.126984417f},
-std::array<float,2>{0.660111308f, 0.645026088f},
-std::array<float,2>{0.765231848f, 0.363592595f},
-std::array<float,2>{0.0287806597f, 0.977753341f},
-std::array<float,2>{0.229861841f, 0.0455835722f},
-std::array<float,2>{0.988080502f, 0.559329152f},
-std::array<float,2>{0.583591342f, 0.397200257f},
-std::array<float,2>{0.336055487f, 0.769651771f},
-std::array<float,2>{0.388510406f, 0.264618546f},
-std::array<float,2>{0.647632658f, 0.894731164f},
-std::array<float,2>{0.794416428f, 0.245503902f},
-std::array<float,2>{0.0329064801f, 0.732852936f},
-std::array<float,2>{0.107755885f, 0.448864222f},
-std::array<float,2>{0.858645022f, 0.833843231f},
-std::array<float,2>{0.746035695f, 0.0959554017f},
-std::array<float,2>{0.495571464f, 0.610905766f},
-std::array<float,2>{0.25387603f, 0.130571619f},
-std::array<float,2>{0.52506721f, 0.642014623f},
-std::array<float,2>{0.891772449f, 0.362318724f},
-std::array<float,2>{0.131595567f, 0.981662631f},
-std::array<float,2>{0.0120416945f, 0.194836631f},
-std::array<float,2>{0.776879847f, 0.709774852f},
-std::array<float,2>{0.682939231f, 0.302605808f},
-std::array<float,2>{0.41694957f, 0.925822437f},
-std::array<float,2>{0.346951842f, 0.428251624f},
-std::array<float,2>{0.617542267f, 0.788520932f},
-std::array<float,2>{0.939460695f, 0.0119960885f},
-std::array<float,2>{0.193138152f, 0.508840978f},
-std::array<float,2>{0.175638244f, 0.327041358f},
-std::array<float,2>{0.931795061f, 0.957260907f},
-std::array<float,2>{0.555374384f, 0.171362698f},
-std::array<float,2>{0.287704587f, 0.664288998f},
-std::array<float,2>{0.441064119f, 0.0785990655f},
-std::array<float,2>{0.699079454f, 0.578959584f},
-std::array<float,2>{0.817818582f, 0.48501429f},
-std::array<float,2>{0.0716389343f, 0.860894978f},
-std::array<float,2>{0.145850286f, 0.181937739f},
-std::array<float,2>{0.880608261f, 0.683019638f},
-std::array<float,2>{0.508363664f, 0.333456546f},
-std::array<float,2>{0.280353218f, 0.94405061f},
-std::array<float,2>{0.482423574f, 0.475224674f},
-std::array<float,2>{0.724972486f, 0.856051087f},
-std::array<float,2>{0.869887173f, 0.0648760498f},
-std::array<float,2>{0.114908829f, 0.576297045f},
-std::array<float,2>{0.0544869378f, 0.285984218f},
-std::array<float,2>{0.801960528f, 0.915176094f},
-std::array<float,2>{0.630286694f, 0.203913003f},
-std::array<float,2>{0.396517515f, 0.696826994f},
-std::array<float,2>{0.327078819f, 0.0242728665f},
-std::array<float,2>{0.574342132f, 0.521939337f},
-std::array<float,2>{0.975817025f, 0.418572932f},
-std::array<float,2>{0.245087415f, 0.804710805f},
-std::array<float,2>{0.0897174254f, 0.121038489f},
-std::array<float,2>{0.836271644f, 0.608187973f},
-std::array<float,2>{0.71501255f, 0.453588039f},
-std::array<float,2>{0.45500648f, 0.822949827f},
-std::array<float,2>{0.301855743f, 0.356248528f},
-std::array<float,2>{0.543749392f, 0.998390198f},
-std::array<float,2>{0.908412039f, 0.154619172f},
-std::array<float,2>{0.16750145f, 0.630599976f},
-std::array<float,2>{0.215015143f, 0.37902534f},
-std::array<float,2>{0.966481447f, 0.752200603f},
-std::array<float,2>{0.602699995f, 0.0527204499f},
-std::array<float,2>{0.361203969f, 0.537645102f},
-std::array<float,2>{0.426997572f, 0.224681795f},
-std::array<float,2>{0.67166549f, 0.741310894f},
-std::array<float,2>{0.755942822f, 0.267038405f},
-std::array<float,2>{0.0209431555f, 0.877211034f},
-std::array<float,2>{0.161979824f, 0.0746332705f},
-std::array<float,2>{0.917095482f, 0.563370287f},
-std::array<float,2>{0.53651017f, 0.481059462f},
-std::array<float,2>{0.309761256f, 0.846233726f},
-std::array<float,2>{0.464737564f, 0.341738641f},
-std::array<float,2>{0.708019078f, 0.953014731f},
-std::array<float,2>{0.833511651f, 0.173877075f},
-std::array<float,2>{0.0822449178f, 0.675459743f},
-std::array<float,2>{0.0252141729f, 0.411380947f},
-std::array<float,2>{0.759362578f, 0.803557575f},
-std::array<float,2>{0.661825359f, 0.0218695737f},
-std::array<float,2>{0.43491295f, 0.52372098f},
-std::array<float,2>{0.370322257f, 0.217366934f},
-std::array<float,2>{0.598278284f, 0.689419091f},
-std::array<float,2>{0.959073067f, 0.294399709f},
-std::array<float,2>{0.204798862f, 0.907068491f},
-std::array<float,2>{0.120710932f, 0.147434279f},
-std::array<float,2>{0.866638482f, 0.634088159f},
-std::array<float,2>{0.731407762f, 0.351315677f},
-std::array<float,2>{0.470979184f, 0.990453839f},
-std::array<float,2>{0.269107819f, 0.464999795f},
-std::array<float,2>{0.504538357f, 0.815340817f},
-std::array<float,2>{0.888532877f, 0.116114579f},
-std::array<float,2>{0.155703425f, 0.597136855f},
-std::array<float,2>{0.236132711f, 0.27663669f},
-std::array<float,2>{0.983596861f, 0.888461113f},
-std::array<float,2>{0.562907517f, 0.231132865f},
-std::array<float,2>{0.313499421f, 0.747288585f},
-std::array<float,2>{0.399705946f, 0.0603222661f},
-std::array<float,2>{0.634752035f, 0.541759372f},
-std::array<float,2>{0.812491834f, 0.386888921f},
-std::array<float,2>{0.0588506535f, 0.75873512f},
-std::array<float,2>{0.199036926f, 0.239839077f},
-std::array<float,2>{0.950975537f, 0.720694482f},
-std::array<float,2>{0.616751313f, 0.253834099f},
-std::array<float,2>{0.358848125f, 0.899483263f},
-std::array<float,2>{0.409672171f, 0.40406093f},
-std::array<float,2>{0.672386825f, 0.780505538f},
-std::array<float,2>{0.772976339f, 0.0365277119f},
-std::array<float,2>{0.000518552552f, 0.548839867f},
-std::array<float,2>{0.0671744347f, 0.374252468f},
-std::array<float,2>{0.823470533f, 0.976374269f},
-std::array<float,2>{0.694172084f, 0.140285194f},
-std::array<float,2>{0.449500442f, 0.656158507f},
-std::array<float,2>{0.292722106f, 0.10505484f},
-std::array<float,2>{0.554321527f, 0.621867895f},
-std::array<float,2>{0.925828815f, 0.442948878f},
-std::array<float,2>{0.186437801f, 0.840990841f},
-std::array<float,2>{0.0424587242f, 0.00400742562f},
-std::array<float,2>{0.788283825f, 0.507239163f},
-std::array<float,2>{0.65330708f, 0.430177093f},
-std::array<float,2>{0.381797671f, 0.796296775f},
-std::array<float,2>{0.329872817f, 0.305888504f},
-std::array<float,2>{0.587943375f, 0.929706931f},
-std::array<float,2>{0.992426813f, 0.201912045f},
-std::array<float,2>{0.221029535f, 0.714055955f},
-std::array<float,2>{0.140345991f, 0.495615602f},
-std::array<float,2>{0.901869774f, 0.868364394f},
-std::array<float,2>{0.518223643f, 0.0893311575f},
-std::array<float,2>{0.26057896f, 0.586906731f},
-std::array<float,2>{0.487244427f, 0.158593193f},
-std::array<float,2>{0.740710378f, 0.661530674f},
-std::array<float,2>{0.844961703f, 0.31923306f},
-std::array<float,2>{0.100831658f, 0.961163938f},
-std::array<float,2>{0.127577528f, 0.0176058766f},
-std::array<float,2>{0.897889555f, 0.530567169f},
-std::array<float,2>{0.528275967f, 0.409902781f},
-std::array<float,2>{0.25559485f, 0.798545659f},
-std::array<float,2>{0.497050703f, 0.29178074f},
-std::array<float,2>{0.749590755f, 0.91256386f},
-std::array<float,2>{0.853410184f, 0.211095929f},
-std::array<float,2>{0.103005342f, 0.69405812f},
-std::array<float,2>{0.0384852625f, 0.479944289f},
-std::array<float,2>{0.789750516f, 0.850710034f},
-std::array<float,2>{0.642177045f, 0.0729175285f},
-std::array<float,2>{0.38413164f, 0.567573905f},
-std::array<float,2>{0.33994171f, 0.179497212f},
-std::array<float,2>{0.581955194f, 0.679175675f},
-std::array<float,2>{0.992162704f, 0.339220315f},
-std::array<float,2>{0.230979025f, 0.948234081f},
-std::array<float,2>{0.0751560256f, 0.229703516f},
-std::array<float,2>{0.81333828f, 0.743898451f},
-std::array<float,2>{0.702027798f, 0.279617786f},
-std::array<float,2>{0.442971677f, 0.886233509f},
-std::array<float,2>{0.284169734f, 0.385293931f},
-std::array<float,2>{0.559492767f, 0.765151083f},
-std::array<float,2>{0.936614096f, 0.0572968237f},
-std::array<float,2>{0.179587603f, 0.543092668f},
-std::array<float,2>{0.188309401f, 0.346869439f},
-std::array<float,2>{0.944257915f, 0.987869382f},
-std::array<float,2>{0.623378217f, 0.142523393f},
-std::array<float,2>{0.348805904f, 0.638620198f},
-std::array<float,2>{0.4214513f, 0.111332402f},
-std::array<float,2>{0.685373247f, 0.59855777f},
-std::array<float,2>{0.779030204f, 0.464231998f},
-std::array<float,2>{0.0112309642f, 0.820082068f},
-std::array<float,2>{0.249132439f, 0.134502634f},
-std::array<float,2>{0.970692039f, 0.650118411f},
-std::array<float,2>{0.572532773f, 0.369439453f},
-std::array<float,2>{0.322750807f, 0.970452249f},
-std::array<float,2>{0.391468763f, 0.439870656f},
-std::array<float,2>{0.625546217f, 0.836845398f},
-std::array<float,2>{0.798936188f, 0.10797102f},
-std::array<float,2>{0.0505655184f, 0.620344043f},
-std::array<float,2>{0.109628268f, 0.255207926f},
-std::array<float,2>{0.873800814f, 0.904195547f},
-std::array<float,2>{0.720702469f, 0.23774597f},
-std::array<float,2>{0.477925003f, 0.726180613f},
-std::array<float,2>{0.276782662f, 0.0337411202f},
-std::array<float,2>{0.513332725f, 0.553423822f},
-std::array<float,2>{0.87875849f, 0.400793225f},
-std::array<float,2>{0.141488016f, 0.774310827f},
-std::array<float,2>{0.0173863359f, 0.0918791369f},
-std::array<float,2>{0.753481448f, 0.593683183f},
-std::array<float,2>{0.667433202f, 0.496363759f},
-std::array<float,2>{0.42205283f, 0.872659564f},
-std::array<float,2>{0.364808232f, 0.315594256f},
-std::array<float,2>{0.606976032f, 0.967826426f},
-std::array<float,2>{0.962263763f, 0.162023872f},
-std::array<float,2>{0.214011252f, 0.656299591f},
-std::array<float,2>{0.171375915f, 0.433750212f},
-std::array<float,2>{0.912582278f, 0.791333497f},
-std::array<float,2>{0.542839289f, 0.00359543227f},
-std::array<float,2>{0.29787311f, 0.5033831f},
-std::array<float,2>{0.46067974f, 0.195958957f},
-std::array<float,2>{0.711017728f, 0.716097414f},
-std::array<float,2>{0.842261195f, 0.31125471f},
-std::array<float,2>{0.091537714f, 0.936014295f},
-std::array<float,2>{0.208374009f, 0.100155927f},
-std::array<float,2>{0.954638064f, 0.614618897f},
-std::array<float,2>{0.597328544f, 0.451024234f},
-std::array<float,2>{0.372968763f, 0.828177869f},
-std::array<float,2>{0.432576329f, 0.364675671f},
-std::array<float,2>{0.657998323f, 0.9766289f},
-std::array<float,2>{0.763301134f, 0.128259256f},
-std::array<float,2>{0.0312383752f, 0.64573884f},
-std::array<float,2>{0.0810904726f, 0.390975773f},
-std::array<float,2>{0.829780877f, 0.766166329f},
-std::array<float,2>{0.705973804f, 0.0417187251f},
-std::array<float,2>{0.468714744f, 0.558530092f},
-std::array<float,2>{0.307607025f, 0.249758795f},
-std::array<float,2>{0.531868815f, 0.726804376f},
-std::array<float,2>{0.919473171f, 0.258921027f},
-std::array<float,2>{0.157413974f, 0.893161714f},
-std::array<float,2>{0.0565516017f, 0.164210528f},
-std::array<float,2>{0.805747986f, 0.669152141f},
-std::array<float,2>{0.639609158f, 0.322969139f},
-std::array<float,2>{0.404949814f, 0.955805123f},
-std::array<float,2>{0.319450557f, 0.492070496f},
-std::array<float,2>{0.56792897f, 0.866597176f},
-std::array<float,2>{0.979102671f, 0.085681349f},
-std::array<float,2>{0.238615185f, 0.584987998f},
-std::array<float,2>{0.150563791f, 0.297271192f},
-std::array<float,2>{0.883512557f, 0.923477411f},
-std::array<float,2>{0.501295984f, 0.189211726f},
-std::array<float,2>{0.270147771f, 0.703933239f},
-std::array<float,2>{0.475833863f, 0.0103108594f},
-std::array<float,2>{0.727712095f, 0.512584329f},
-std::array<float,2>{0.860822499f, 0.423381925f},
-std::array<float,2>{0.124409378f, 0.782901645f},
-std::array<float,2>{0.182726502f, 0.210274979f},
-std::array<float,2>{0.922883153f, 0.702440441f},
-std::array<float,2>{0.549084723f, 0.281534612f},
-std::array<float,2>{0.293524921f, 0.91809994f},
-std::array<float,2>{0.448688149f, 0.415060073f},
-std::array<float,2>{0.688046455f, 0.809855342f},
-std::array<float,2>{0.824440241f, 0.0296003893f},
-std::array<float,2>{0.0644442737f, 0.518485248f},
-std::array<float,2>{0.00716331275f, 0.330173194f},
-std::array<float,2>{0.767396748f, 0.94087708f},
-std::array<float,2>{0.678411961f, 0.185106859f},
-std::array<float,2>{0.410402149f, 0.685520828f},
-std::array<float,2>{0.351870388f, 0.0683695301f},
-std::array<float,2>{0.611233115f, 0.571138442f},
-std::array<float,2>{0.946629941f, 0.470839024f},
-std::array<float,2>{0.201347142f, 0.853283823f},
-std::array<float,2>{0.0940071866f, 0.0489616245f},
-std::array<float,2>{0.848694384f, 0.532141566f},
-std::array<float,2>{0.734607816f, 0.377220213f},
-std::array<float,2>{0.489031285f, 0.757756472f},
-std::array<float,2>{0.265597373f, 0.272542715f},
-std::array<float,2>{0.521021724f, 0.880093217f},
-std::array<float,2>{0.905978143f, 0.221878871f},
-std::array<float,2>{0.13353093f, 0.738114119f},
-std::array<float,2>{0.224182323f, 0.459237814f},
-std::array<float,2>{0.999516547f, 0.826883972f},
-std::array<float,2>{0.591251552f, 0.121263072f},
-std::array<float,2>{0.333038479f, 0.602570415f},
-std::array<float,2>{0.377467602f, 0.150695458f},
-std::array<float,2>{0.65082866f, 0.625489116f},
-std::array<float,2>{0.78228122f, 0.35534659f},
-std::array<float,2>{0.0449176021f, 0.994280756f},
-std::array<float,2>{0.194222167f, 0.0145865018f},
-std::array<float,2>{0.937817395f, 0.510985553f},
-std::array<float,2>{0.619296968f, 0.426285058f},
-std::array<float,2>{0.345522672f, 0.786442161f},
-std::array<float,2>{0.41419667f, 0.304620326f},
-std::array<float,2>{0.680828691f, 0.928329349f},
-std::array<float,2>{0.77365607f, 0.192514151f},
-std::array<float,2>{0.01373736f, 0.70861119f},
-std::array<float,2>{0.0728543848f, 0.486450016f},
-std::array<float,2>{0.818647444f, 0.862147987f},
-std::array<float,2>{0.696043611f, 0.0809680223f},
-std::array<float,2>{0.437946945f, 0.581503093f},
-std::array<float,2>{0.286457747f, 0.168829381f},
-std::array<float,2>{0.558118701f, 0.666478813f},
-std::array<float,2>{0.930188179f, 0.325357676f},
-std::array<float,2>{0.172023773f, 0.960784316f},
-std::array<float,2>{0.0333637558f, 0.242720246f},
-std::array<float,2>{0.796251535f, 0.731508195f},
-std::array<float,2>{0.645329118f, 0.262843013f},
-std::array<float,2>{0.389469177f, 0.896986723f},
-std::array<float,2>{0.33809045f, 0.39479661f},
-std::array<float,2>{0.584156215f, 0.772436321f},
-std::array<float,2>{0.985138118f, 0.0439110175f},
-std::array<float,2>{0.228123233f, 0.560833216f},
-std::array<float,2>{0.128977031f, 0.360291183f},
-std::array<float,2>{0.892983139f, 0.983519971f},
-std::array<float,2>{0.525551975f, 0.131196231f},
-std::array<float,2>{0.250103801f, 0.643533707f},
-std::array<float,2>{0.492302239f, 0.0941689163f},
-std::array<float,2>{0.743737638f, 0.612516463f},
-std::array<float,2>{0.856989384f, 0.445555747f},
-std::array<float,2>{0.106846958f, 0.834327698f},
-std::array<float,2>{0.164882421f, 0.154223159f},
-std::array<float,2>{0.906701505f, 0.632609963f},
-std::array<float,2>{0.546295643f, 0.359034479f},
-std::array<float,2>{0.303858608f, 0.996866047f},
-std::array<float,2>{0.45562166f, 0.455984384f},
-std::array<float,2>{0.718039513f, 0.822040081f},
-std::array<float,2>{0.838433027f, 0.117596261f},
-std::array<float,2>{0.087590225f, 0.605998933f},
-std::array<float,2>{0.0231699198f, 0.268689662f},
-std::array<float,2>{0.755352914f, 0.876781762f},
-std::array<float,2>{0.668253481f, 0.223139569f},
-std::array<float,2>{0.427927911f, 0.740192711f},
-std::array<float,2>{0.36282447f, 0.0536922105f},
-std::array<float,2>{0.604238808f, 0.536002517f},
-std::array<float,2>{0.968327701f, 0.381305814f},
-std::array<float,2>{0.218500972f, 0.751075923f},
-std::array<float,2>{0.11648012f, 0.0639090315f},
-std::array<float,2>{0.868118882f, 0.575106621f},
-std::array<float,2>{0.723733425f, 0.47318989f},
-std::array<float,2>{0.480950981f, 0.857699692f},
-std::array<float,2>{0.27925849f, 0.334038973f},
-std::array<float,2>{0.5113343f, 0.943315506f},
-std::array<float,2>{0.881513596f, 0.179899067f},
-std::array<float,2>{0.147433057f, 0.680094421f},
-std::array<float,2>{0.242929578f, 0.420703173f},
-std::array<float,2>{0.974033475f, 0.806853175f},
-std::array<float,2>{0.577400923f, 0.025983559f},
-std::array<float,2>{0.325959176f, 0.519832253f},
-std::array<float,2>{0.39553076f, 0.205471858f},
-std::array<float,2>{0.632666349f, 0.699152112f},
-std::array<float,2>{0.803545296f, 0.287748843f},
-std::array<float,2>{0.0512520522f, 0.917430818f},
-std::array<float,2>{0.15302518f, 0.113819562f},
-std::array<float,2>{0.8906039f, 0.594935238f},
-std::array<float,2>{0.507611513f, 0.466830045f},
-std::array<float,2>{0.266126603f, 0.814238131f},
-std::array<float,2>{0.469142884f, 0.347714484f},
-std::array<float,2>{0.733310461f, 0.98864466f},
-std::array<float,2>{0.86515367f, 0.146139354f},
-std::array<float,2>{0.118450478f, 0.636689126f},
-std::array<float,2>{0.0606210753f, 0.389853567f},
-std::array<float,2>{0.809802294f, 0.760024846f},
-std::array<float,2>{0.635651946f, 0.0608253889f},
-std::array<float,2>{0.400690228f, 0.539309382f},
-std::array<float,2>{0.316208541f, 0.233645752f},
-std::array<float,2>{0.564566493f, 0.748807371f},
-std::array<float,2>{0.981540143f, 0.275272876f},
-std::array<float,2>{0.236905977f, 0.888779342f},
-std::array<float,2>{0.0841132998f, 0.171887204f},
-std::array<float,2>{0.835280359f, 0.672705829f},
-std::array<float,2>{0.709701657f, 0.342109382f},
-std::array<float,2>{0.462077051f, 0.950786293f},
-std::array<float,2>{0.310585529f, 0.484073311f},
-std::array<float,2>{0.538686156f, 0.844334543f},
-std::array<float,2>{0.91505301f, 0.0772257969f},
-std::array<float,2>{0.162471026f, 0.56591469f},
-std::array<float,2>{0.2064614f, 0.295252383f},
-std::array<float,2>{0.957923889f, 0.908708394f},
-std::array<float,2>{0.601327777f, 0.215872794f},
-std::array<float,2>{0.367832243f, 0.689582944f},
-std::array<float,2>{0.437125444f, 0.0207684264f},
-std::array<float,2>{0.66398406f, 0.527046442f},
-std::array<float,2>{0.761363387f, 0.413264304f},
-std::array<float,2>{0.0272707865f, 0.802020192f},
-std::array<float,2>{0.220224589f, 0.200665951f},
-std::array<float,2>{0.994583488f, 0.710940659f},
-std::array<float,2>{0.586794734f, 0.308244675f},
-std::array<float,2>{0.33093071f, 0.932726264f},
-std::array<float,2>{0.380646408f, 0.431704164f},
-std::array<float,2>{0.655245781f, 0.793545187f},
-std::array<float,2>{0.785697341f, 0.00759430975f},
-std::array<float,2>{0.0403939411f, 0.505122662f},
-std::array<float,2>{0.0988655537f, 0.316848338f},
-std::array<float,2>{0.845912218f, 0.96392262f},
-std::array<float,2>{0.739749908f, 0.156717241f},
-std::array<float,2>{0.485266894f, 0.662499666f},
-std::array<float,2>{0.259087473f, 0.0876425654f},
-std::array<float,2>{0.515814304f, 0.588f},
-std::array<float,2>{0.899204314f, 0.493567914f},
-std::array<float,2>{0.136966631f, 0.870990992f},
-std::array<float,2>{0.00226381631f, 0.0387329869f},
-std::array<float,2>{0.770119905f, 0.547732472f},
-std::array<float,2>{0.674836695f, 0.405592829f},
-std::array<float,2>{0.407053441f, 0.779108763f},
-std::array<float,2>{0.356935591f, 0.250216812f},
-std::array<float,2>{0.613469422f, 0.901515186f},
-std::array<float,2>{0.953079402f, 0.241460979f},
-std::array<float,2>{0.196004629f, 0.720748425f},
-std::array<float,2>{0.184428334f, 0.443477541f},
-std::array<float,2>{0.929463863f, 0.843283296f},
-std::array<float,2>{0.552651823f, 0.10220132f},
-std::array<float,2>{0.290872723f, 0.624671578f},
-std::array<float,2>{0.451869011f, 0.1373806f},
-std::array<float,2>{0.692991376f, 0.652784526f},
-std::array<float,2>{0.820400119f, 0.371940464f},
-std::array<float,2>{0.0684938878f, 0.974049747f},
-std::array<float,2>{0.177334219f, 0.0549754761f},
-std::array<float,2>{0.934065521f, 0.545609951f},
-std::array<float,2>{0.561747432f, 0.382936329f},
-std::array<float,2>{0.28157258f, 0.762680173f},
-std::array<float,2>{0.443461835f, 0.277767748f},
-std::array<float,2>{0.699239671f, 0.883727968f},
-std::array<float,2>{0.81503731f, 0.228422597f},
-std::array<float,2>{0.0766036808f, 0.744762957f},
-std::array<float,2>{0.00923970714f, 0.462071955f},
-std::array<float,2>{0.779595852f, 0.816777766f},
-std::array<float,2>{0.686639667f, 0.110518791f},
-std::array<float,2>{0.418969601f, 0.600262582f},
-std::array<float,2>{0.34973675f, 0.142953485f},
-std::array<float,2>{0.621560514f, 0.639710248f},
-std::array<float,2>{0.941679358f, 0.344550312f},
-std::array<float,2>{0.189556718f, 0.985413969f},
-std::array<float,2>{0.103562482f, 0.214141905f},
-std::array<float,2>{0.854461968f, 0.692599356f},
-std::array<float,2>{0.747916818f, 0.290145218f},
-std::array<float,2>{0.499487549f, 0.91090709f},
-std::array<float,2>{0.256432295f, 0.408193201f},
-std::array<float,2>{0.530168653f, 0.799959898f},
-std::array<float,2>{0.895350575f, 0.0173295904f},
-std::array<float,2>{0.126096264f, 0.528935671f},
-std::array<float,2>{0.232667223f, 0.336595595f},
-std::array<float,2>{0.98873347f, 0.946485996f},
-std::array<float,2>{0.579056263f, 0.176618025f},
-std::array<float,2>{0.342257977f, 0.677384257f},
-std::array<float,2>{0.386699319f, 0.0706069693f},
-std::array<float,2>{0.643627584f, 0.568956256f},
-std::array<float,2>{0.791591644f, 0.477074802f},
-std::array<float,2>{0.0361041091f, 0.84867537f},
-std::array<float,2>{0.212102205f, 0.16236642f},
-std::array<float,2>{0.964613795f, 0.659238875f},
-std::array<float,2>{0.608179569f, 0.312667787f},
-std::array<float,2>{0.36654824f, 0.965184212f},
-std::array<float,2>{0.424910367f, 0.498056978f},
-std::array<float,2>{0.664610863f, 0.873739898f},
-std::array<float,2>{0.751232505f, 0.0917666703f},
-std::array<float,2>{0.0191708244f, 0.590650976f},
-std::array<float,2>{0.0919247717f, 0.310508251f},
-std::array<float,2>{0.841093898f, 0.934158683f},
-std::array<float,2>{0.71349746f, 0.198320195f},
-std::array<float,2>{0.457968473f, 0.71684885f},
-std::array<float,2>{0.299559057f, 0.00124469539f},
-std::array<float,2>{0.540527225f, 0.501460731f},
-std::array<float,2>{0.910231531f, 0.435998023f},
-std::array<float,2>{0.168440133f, 0.789997399f},
-std::array<float,2>{0.0481830835f, 0.106910355f},
-std::array<float,2>{0.79849112f, 0.618987203f},
-std::array<float,2>{0.628440261f, 0.438462466f},
-std::array<float,2>{0.393495589f, 0.839424968f},
-std::array<float,2>{0.321640223f, 0.368868411f},
-std::array<float,2>{0.571948409f, 0.971689165f},
-std::array<float,2>{0.971508622f, 0.135892957f},
-std::array<float,2>{0.246375978f, 0.651889503f},
-std::array<float,2>{0.143166125f, 0.39844197f},
-std::array<float,2>{0.875358999f, 0.775587142f},
-std::array<float,2>{0.513979793f, 0.0321145952f},
-std::array<float,2>{0.274427116f, 0.551199615f},
-std::array<float,2>{0.480001718f, 0.234943479f},
-std::array<float,2>{0.721752226f, 0.723896801f},
-std::array<float,2>{0.872202396f, 0.256896883f},
-std::array<float,2>{0.112844504f, 0.905147195f},
-std::array<float,2>{0.241553277f, 0.0826713964f},
-std::array<float,2>{0.978299499f, 0.583971918f},
-std::array<float,2>{0.568855047f, 0.489409506f},
-std::array<float,2>{0.317647368f, 0.863305628f},
-std::array<float,2>{0.402800709f, 0.321416438f},
-std::array<float,2>{0.638511002f, 0.954333305f},
-std::array<float,2>{0.806894183f, 0.167203233f},
-std::array<float,2>{0.0577899516f, 0.670002997f},
-std::array<float,2>{0.122993194f, 0.425468206f},
-std::array<float,2>{0.862019718f, 0.784712017f},
-std::array<float,2>{0.729004979f, 0.00929703843f},
-std::array<float,2>{0.474127173f, 0.51506567f},
-std::array<float,2>{0.273416519f, 0.191036865f},
-std::array<float,2>{0.503029346f, 0.706883788f},
-std::array<float,2>{0.885849774f, 0.299607009f},
-std::array<float,2>{0.150290206f, 0.924669266f},
-std::array<float,2>{0.02751383f, 0.126650125f},
-std::array<float,2>{0.764096141f, 0.647116184f},
-std::array<float,2>{0.658923388f, 0.365674973f},
-std::array<float,2>{0.430907905f, 0.979328275f},
-std::array<float,2>{0.37362507f, 0.452424467f},
-std::array<float,2>{0.594489396f, 0.831772149f},
-std::array<float,2>{0.956805885f, 0.0992164388f},
-std::array<float,2>{0.209713787f, 0.615629792f},
-std::array<float,2>{0.159813747f, 0.261167079f},
-std::array<float,2>{0.921803355f, 0.891326249f},
-std::array<float,2>{0.53491056f, 0.24741441f},
-std::array<float,2>{0.306407392f, 0.729707718f},
-std::array<float,2>{0.465614855f, 0.0409185849f},
-std::array<float,2>{0.703578234f, 0.556409776f},
-std::array<float,2>{0.830481529f, 0.393441647f},
-std::array<float,2>{0.0784345642f, 0.768825114f},
-std::array<float,2>{0.135024026f, 0.22060363f},
-std::array<float,2>{0.90288204f, 0.735569775f},
-std::array<float,2>{0.52329731f, 0.270005763f},
-std::array<float,2>{0.262904882f, 0.882761657f},
-std::array<float,2>{0.491754889f, 0.376251072f},
-std::array<float,2>{0.736739337f, 0.755389333f},
-std::array<float,2>{0.850395441f, 0.0469938889f},
-std::array<float,2>{0.0966729224f, 0.535016477f},
-std::array<float,2>{0.045241829f, 0.352475137f},
-std::array<float,2>{0.784126341f, 0.993857741f},
-std::array<float,2>{0.650080025f, 0.148709953f},
-std::array<float,2>{0.37584573f, 0.627086639f},
-std::array<float,2>{0.334381521f, 0.124030992f},
-std::array<float,2>{0.592917979f, 0.604999602f},
-std::array<float,2>{0.996245801f, 0.457246423f},
-std::array<float,2>{0.224815488f, 0.82507962f},
-std::array<float,2>{0.0656869784f, 0.0287596174f},
-std::array<float,2>{0.82651943f, 0.51576972f},
-std::array<float,2>{0.69105649f, 0.416099846f},
-std::array<float,2>{0.445482403f, 0.811411798f},
-std::array<float,2>{0.295463324f, 0.283341587f},
-std::array<float,2>{0.547066271f, 0.920359612f},
-std::array<float,2>{0.924477994f, 0.207506478f},
-std::array<float,2>{0.181107804f, 0.700210929f},
-std::array<float,2>{0.199609682f, 0.470117301f},
-std::array<float,2>{0.948919296f, 0.854665101f},
-std::array<float,2>{0.612133503f, 0.0670990497f},
-std::array<float,2>{0.353789389f, 0.573657215f},
-std::array<float,2>{0.413460612f, 0.185702577f},
-std::array<float,2>{0.67693907f, 0.685883582f},
-std::array<float,2>{0.767852008f, 0.328174621f},
-std::array<float,2>{0.00478680432f, 0.938850701f},
-std::array<float,2>{0.221332625f, 0.00723822787f},
-std::array<float,2>{0.992757499f, 0.505689919f},
-std::array<float,2>{0.588577032f, 0.432520717f},
-std::array<float,2>{0.329584986f, 0.793098032f},
-std::array<float,2>{0.380989045f, 0.307685226f},
-std::array<float,2>{0.65252161f, 0.933490276f},
-std::array<float,2>{0.788722217f, 0.200816885f},
-std::array<float,2>{0.0425570756f, 0.71153605f},
-std::array<float,2>{0.101521544f, 0.493748933f},
-std::array<float,2>{0.84561944f, 0.870340765f},
-std::array<float,2>{0.741132379f, 0.0870186985f},
-std::array<float,2>{0.486728221f, 0.588422716f},
-std::array<float,2>{0.260202795f, 0.1569359f},
-std::array<float,2>{0.517687738f, 0.66266793f},
-std::array<float,2>{0.901497543f, 0.317322761f},
-std::array<float,2>{0.139899448f, 0.964504838f},
-std::array<float,2>{0.000408925349f, 0.24179256f},
-std::array<float,2>{0.772633672f, 0.721337497f},
-std::array<float,2>{0.672302902f, 0.250496536f},
-std::array<float,2>{0.409546793f, 0.902336061f},
-std::array<float,2>{0.359007478f, 0.405822009f},
-std::array<float,2>{0.616531849f, 0.778325737f},
-std::array<float,2>{0.95038718f, 0.0383847542f},
-std::array<float,2>{0.198294491f, 0.547233582f},
-std::array<float,2>{0.185822904f, 0.371184915f},
-std::array<float,2>{0.92638737f, 0.97414571f},
-std::array<float,2>{0.553847194f, 0.136952624f},
-std::array<float,2>{0.292050362f, 0.652866185f},
-std::array<float,2>{0.449810803f, 0.101591513f},
-std::array<float,2>{0.693598628f, 0.624467194f},
-std::array<float,2>{0.823924065f, 0.444086015f},
-std::array<float,2>{0.0664392933f, 0.843067169f},
-std::array<float,2>{0.156167194f, 0.14578931f},
-std::array<float,2>{0.888087928f, 0.635958016f},
-std::array<float,2>{0.504361331f, 0.348310441f},
-std::array<float,2>{0.269012064f, 0.988861322f},
-std::array<float,2>{0.471198231f, 0.467491716f},
-std::array<float,2>{0.73083955f, 0.813812852f},
-std::array<float,2>{0.866937935f, 0.113389626f},
-std::array<float,2>{0.12037231f, 0.595507205f},
-std::array<float,2>{0.0591874272f, 0.274545252f},
-std::array<float,2>{0.811645091f, 0.889505267f},
-std::array<float,2>{0.633906007f, 0.23408471f},
-std::array<float,2>{0.400119543f, 0.748054504f},
-std::array<float,2>{0.314111412f, 0.0610404462f},
-std::array<float,2>{0.562991023f, 0.539855361f},
-std::array<float,2>{0.9840222f, 0.390517682f},
-std::array<float,2>{0.235562176f, 0.760468364f},
-std::array<float,2>{0.0825833529f, 0.0780467391f},
-std::array<float,2>{0.833286405f, 0.566045642f},
-std::array<float,2>{0.708696067f, 0.483595043f},
-std::array<float,2>{0.464172304f, 0.844058037f},
-std::array<float,2>{0.310354143f, 0.342577636f},
-std::array<float,2>{0.536993206f, 0.950570405f},
-std::array<float,2>{0.917654812f, 0.172574908f},
-std::array<float,2>{0.161526293f, 0.671898127f},
-std::array<float,2>{0.204144344f, 0.413873196f},
-std::array<float,2>{0.959567547f, 0.802416682f},
-std::array<float,2>{0.597851217f, 0.0212066416f},
-std::array<float,2>{0.370878607f, 0.526562095f},
-std::array<float,2>{0.435099721f, 0.216388419f},
-std::array<float,2>{0.661182761f, 0.68998003f},
-std::array<float,2>{0.758888185f, 0.29541105f},
-std::array<float,2>{0.0248949397f, 0.908470452f},
-std::array<float,2>{0.167262346f, 0.11807698f},
-std::array<float,2>{0.909063518f, 0.605778873f},
-std::array<float,2>{0.543065846f, 0.455355078f},
-std::array<float,2>{0.3023054f, 0.821575701f},
-std::array<float,2>{0.454224855f, 0.358600646f},
-std::array<float,2>{0.715725541f, 0.996162176f},
-std::array<float,2>{0.836488664f, 0.153697371f},
-std::array<float,2>{0.0889615342f, 0.632045507f},
-std::array<float,2>{0.0213181991f, 0.381675333f},
-std::array<float,2>{0.756695986f, 0.751759887f},
-std::array<float,2>{0.67090714f, 0.0529525615f},
-std::array<float,2>{0.42764923f, 0.535634041f},
-std::array<float,2>{0.36066407f, 0.223559171f},
-std::array<float,2>{0.603400886f, 0.739318013f},
-std::array<float,2>{0.966307998f, 0.269492358f},
-std::array<float,2>{0.215766922f, 0.876318634f},
-std::array<float,2>{0.114549749f, 0.180254817f},
-std::array<float,2>{0.869314551f, 0.680604458f},
-std::array<float,2>{0.72533381f, 0.334807903f},
-std::array<float,2>{0.483104557f, 0.942718267f},
-std::array<float,2>{0.281084448f, 0.472923696f},
-std::array<float,2>{0.507993817f, 0.858154535f},
-std::array<float,2>{0.880155325f, 0.0641765893f},
-std::array<float,2>{0.146287829f, 0.57467401f},
-std::array<float,2>{0.244234741f, 0.287340343f},
-std::array<float,2>{0.976420999f, 0.91755712f},
-std::array<float,2>{0.574896395f, 0.205732495f},
-std::array<float,2>{0.326257318f, 0.698646307f},
-std::array<float,2>{0.397182584f, 0.0255844984f},
-std::array<float,2>{0.630646348f, 0.520330608f},
-std::array<float,2>{0.802674592f, 0.420394629f},
-std::array<float,2>{0.0540653281f, 0.807325304f},
-std::array<float,2>{0.192482755f, 0.193047658f},
-std::array<float,2>{0.940096915f, 0.708481431f},
-std::array<float,2>{0.617783368f, 0.303949445f},
-std::array<float,2>{0.347655654f, 0.928040147f},
-std::array<float,2>{0.416372001f, 0.425848395f},
-std::array<float,2>{0.683445334f, 0.786851764f},
-std::array<float,2>{0.776684284f, 0.0138565814f},
-std::array<float,2>{0.0125652822f, 0.51134485f},
-std::array<float,2>{0.0721334666f, 0.325987816f},
-std::array<float,2>{0.81788367f, 0.960200071f},
-std::array<float,2>{0.698583722f, 0.168290481f},
-std::array<float,2>{0.440439403f, 0.666577935f},
-std::array<float,2>{0.287184268f, 0.0802060664f},
-std::array<float,2>{0.55478543f, 0.581796348f},
-std::array<float,2>{0.932492495f, 0.487200588f},
-std::array<float,2>{0.175140545f, 0.861339211f},
-std::array<float,2>{0.0325250067f, 0.0429790877f},
-std::array<float,2>{0.794654906f, 0.56146872f},
-std::array<float,2>{0.648311913f, 0.395145088f},
-std::array<float,2>{0.387936801f, 0.77164644f},
-std::array<float,2>{0.336436152f, 0.263421506f},
-std::array<float,2>{0.583307743f, 0.896647751f},
-std::array<float,2>{0.987708569f, 0.242198035f},
-std::array<float,2>{0.230081961f, 0.732042789f},
-std::array<float,2>{0.13134715f, 0.446220517f},
-std::array<float,2>{0.892459333f, 0.834483087f},
-std::array<float,2>{0.524876356f, 0.094514735f},
-std::array<float,2>{0.25316745f, 0.61299783f},
-std::array<float,2>{0.495678872f, 0.131631836f},
-std::array<float,2>{0.745395005f, 0.642905056f},
-std::array<float,2>{0.858900547f, 0.359587371f},
-std::array<float,2>{0.108015858f, 0.984332263f},
-std::array<float,2>{0.133055806f, 0.0476084165f},
-std::array<float,2>{0.905508816f, 0.534293473f},
-std::array<float,2>{0.520783484f, 0.376649112f},
-std::array<float,2>{0.264716953f, 0.754975438f},
-std::array<float,2>{0.488563031f, 0.270156175f},
-std::array<float,2>{0.73497951f, 0.882151544f},
-std::array<float,2>{0.849153161f, 0.219946608f},
-std::array<float,2>{0.0943082199f, 0.736094713f},
-std::array<float,2>{0.044045113f, 0.457614213f},
-std::array<float,2>{0.78293848f, 0.824599922f},
-std::array<float,2>{0.651234984f, 0.124650128f},
-std::array<float,2>{0.377222508f, 0.604714751f},
-std::array<float,2>{0.333768815f, 0.149373814f},
-std::array<float,2>{0.591355264f, 0.627664268f},
-std::array<float,2>{0.999448717f, 0.352021098f},
-std::array<float,2>{0.223953113f, 0.993361413f},
-std::array<float,2>{0.0639151111f, 0.207844809f},
-std::array<float,2>{0.825001955f, 0.700688004f},
-std::array<float,2>{0.68783015f, 0.283747137f},
-std::array<float,2>{0.449079961f, 0.920890927f},
-std::array<float,2>{0.293347538f, 0.416818142f},
-std::array<float,2>{0.549334526f, 0.810718119f},
-std::array<float,2>{0.923434556f, 0.0291006546f},
-std::array<float,2>{0.183391616f, 0.516543806f},
-std::array<float,2>{0.201869249f, 0.328969657f},
-std::array<float,2>{0.946837485f, 0.93900454f},
-std::array<float,2>{0.610818923f, 0.186344981f},
-std::array<float,2>{0.352073252f, 0.686137199f},
-std::array<float,2>{0.410913348f, 0.066790387f},
-std::array<float,2>{0.67786938f, 0.573951304f},
-std::array<float,2>{0.766963482f, 0.470611334f},
-std::array<float,2>{0.00752845313f, 0.855249465f},
-std::array<float,2>{0.238815844f, 0.167682722f},
-std::array<float,2>{0.978800297f, 0.670561731f},
-std::array<float,2>{0.567414582f, 0.321871608f},
-std::array<float,2>{0.320017189f, 0.954966187f},
-std::array<float,2>{0.404687852f, 0.490056098f},
-std::array<float,2>{0.638687074f, 0.864014626f},
-std::array<float,2>{0.80643779f, 0.0823902339f},
-std::array<float,2>{0.0560044684f, 0.583479822f},
-std::array<float,2>{0.124595746f, 0.299296826f},
-std::array<float,2>{0.861001849f, 0.924073279f},
-std::array<float,2>{0.72815758f, 0.19050695f},
-std::array<float,2>{0.476285905f, 0.706183672f},
-std::array<float,2>{0.269802302f, 0.0091386158f},
-std::array<float,2>{0.501806974f, 0.515172958f},
-std::array<float,2>{0.883178651f, 0.425230801f},
-std::array<float,2>{0.151011512f, 0.784480751f},
-std::array<float,2>{0.0306556989f, 0.0989215523f},
-std::array<float,2>{0.762930155f, 0.615985155f},
-std::array<float,2>{0.657466054f, 0.452762365f},
-std::array<float,2>{0.431660593f, 0.83153075f},
-std::array<float,2>{0.372193068f, 0.365905702f},
-std::array<float,2>{0.596819222f, 0.978853047f},
-std::array<float,2>{0.954388082f, 0.126393929f},
-std::array<float,2>{0.208811507f, 0.646800935f},
-std::array<float,2>{0.157929346f, 0.392656028f},
-std::array<float,2>{0.919110656f, 0.769293606f},
-std::array<float,2>{0.531583548f, 0.0404180363f},
-std::array<float,2>{0.306800872f, 0.555776894f},
-std::array<float,2>{0.467831165f, 0.248000413f},
-std::array<float,2>{0.705293179f, 0.73006624f},
-std::array<float,2>{0.829128802f, 0.261679888f},
-std::array<float,2>{0.0815497264f, 0.890752971f},
-std::array<float,2>{0.214532435f, 0.0911831707f},
-std::array<float,2>{0.962581754f, 0.589867175f},
-std::array<float,2>{0.606911957f, 0.498623967f},
-std::array<float,2>{0.364529759f, 0.87331295f},
-std::array<float,2>{0.422569424f, 0.313218892f},
-std::array<float,2>{0.667531371f, 0.965692639f},
-std::array<float,2>{0.75324899f, 0.162622407f},
-std::array<float,2>{0.0170015879f, 0.659751654f},
-std::array<float,2>{0.091207765f, 0.436451554f},
-std::array<float,2>{0.842474639f, 0.789386094f},
-std::array<float,2>{0.711595833f, 0.00174395973f},
-std::array<float,2>{0.460070461f, 0.50166142f},
-std::array<float,2>{0.298615664f, 0.198983401f},
-std::array<float,2>{0.541995883f, 0.7176072f},
-std::array<float,2>{0.912630796f, 0.309741408f},
-std::array<float,2>{0.171764538f, 0.934080184f},
-std::array<float,2>{0.050223127f, 0.136390179f},
-std::array<float,2>{0.799568713f, 0.651807845f},
-std::array<float,2>{0.625429153f, 0.368516833f},
-std::array<float,2>{0.390704453f, 0.972394645f},
-std::array<float,2>{0.322995812f, 0.437977314f},
-std::array<float,2>{0.572948158f, 0.839196503f},
-std::array<float,2>{0.969912171f, 0.107264414f},
-std::array<float,2>{0.249529302f, 0.618302166f},
-std::array<float,2>{0.141026616f, 0.257593989f},
-std::array<float,2>{0.878316402f, 0.904534459f},
-std::array<float,2>{0.513021946f, 0.234510481f},
-std::array<float,2>{0.277234107f, 0.724381208f},
-std::array<float,2>{0.478368193f, 0.0315296389f},
-std::array<float,2>{0.720003068f, 0.551328003f},
-std::array<float,2>{0.873436809f, 0.399279594f},
-std::array<float,2>{0.11029496f, 0.775903463f},
-std::array<float,2>{0.179106399f, 0.227955028f},
-std::array<float,2>{0.93742007f, 0.744598627f},
-std::array<float,2>{0.558669806f, 0.278105497f},
-std::array<float,2>{0.283690363f, 0.883145809f},
-std::array<float,2>{0.442753762f, 0.383489519f},
-std::array<float,2>{0.70120585f, 0.761974096f},
-std::array<float,2>{0.812722802f, 0.0552201048f},
-std::array<float,2>{0.0744849145f, 0.545266449f},
-std::array<float,2>{0.0108517446f, 0.343799829f},
-std::array<float,2>{0.778462648f, 0.986283123f},
-std::array<float,2>{0.685001791f, 0.143319741f},
-std::array<float,2>{0.420995116f, 0.640495479f},
-std::array<float,2>{0.349409848f, 0.110962018f},
-std::array<float,2>{0.623879135f, 0.599897802f},
-std::array<float,2>{0.943460405f, 0.462452054f},
-std::array<float,2>{0.187855273f, 0.817376256f},
-std::array<float,2>{0.103414237f, 0.0168597326f},
-std::array<float,2>{0.852942348f, 0.52855736f},
-std::array<float,2>{0.749328017f, 0.40738219f},
-std::array<float,2>{0.49638474f, 0.800547659f},
-std::array<float,2>{0.25502196f, 0.290757895f},
-std::array<float,2>{0.527663469f, 0.910506129f},
-std::array<float,2>{0.898335934f, 0.214741766f},
-std::array<float,2>{0.12716946f, 0.69326669f},
-std::array<float,2>{0.230914563f, 0.476670653f},
-std::array<float,2>{0.991636455f, 0.849502563f},
-std::array<float,2>{0.58116895f, 0.0710467398f},
-std::array<float,2>{0.340706736f, 0.568811059f},
-std::array<float,2>{0.384543687f, 0.175988346f},
-std::array<float,2>{0.641976237f, 0.676918209f},
-std::array<float,2>{0.789191246f, 0.336033911f},
-std::array<float,2>{0.0386327878f, 0.947150767f},
-std::array<float,2>{0.195664898f, 0.0370332673f},
-std::array<float,2>{0.952459633f, 0.54950422f},
-std::array<float,2>{0.614013731f, 0.403500497f},
-std::array<float,2>{0.356510818f, 0.780913651f},
-std::array<float,2>{0.406723648f, 0.253300905f},
-std::array<float,2>{0.675706387f, 0.900330842f},
-std::array<float,2>{0.769746423f, 0.23953104f},
-std::array<float,2>{0.00274168141f, 0.719816148f},
-std::array<float,2>{0.0692223459f, 0.442759663f},
-std::array<float,2>{0.821249306f, 0.841355205f},
-std::array<float,2>{0.692636728f, 0.10462556f},
-std::array<float,2>{0.451556772f, 0.621532679f},
-std::array<float,2>{0.290417314f, 0.139774829f},
-std::array<float,2>{0.551984429f, 0.655443966f},
-std::array<float,2>{0.928952157f, 0.374932438f},
-std::array<float,2>{0.183723658f, 0.97604841f},
-std::array<float,2>{0.040677391f, 0.201273218f},
-std::array<float,2>{0.785346866f, 0.714589775f},
-std::array<float,2>{0.654398203f, 0.306317866f},
-std::array<float,2>{0.380048752f, 0.930481017f},
-std::array<float,2>{0.330457062f, 0.429866016f},
-std::array<float,2>{0.586012185f, 0.796467304f},
-std::array<float,2>{0.995076895f, 0.00471149804f},
-std::array<float,2>{0.220091864f, 0.50745666f},
-std::array<float,2>{0.137556553f, 0.318635941f},
-std::array<float,2>{0.89854753f, 0.961758375f},
-std::array<float,2>{0.516387999f, 0.158969983f},
-std::array<float,2>{0.259500325f, 0.661686361f},
-std::array<float,2>{0.484486878f, 0.0898254737f},
-std::array<float,2>{0.739700377f, 0.586148679f},
-std::array<float,2>{0.846503317f, 0.495312244f},
-std::array<float,2>{0.0991786569f, 0.868759155f},
-std::array<float,2>{0.162789315f, 0.174654186f},
-std::array<float,2>{0.91589576f, 0.674828947f},
-std::array<float,2>{0.538250327f, 0.340827435f},
-std::array<float,2>{0.311421752f, 0.952291667f},
-std::array<float,2>{0.462862283f, 0.480930805f},
-std::array<float,2>{0.709471822f, 0.846119046f},
-std::array<float,2>{0.835886121f, 0.074877575f},
-std::array<float,2>{0.0845005438f, 0.562633514f},
-std::array<float,2>{0.0263868142f, 0.294689655f},
-std::array<float,2>{0.760967731f, 0.906370401f},
-std::array<float,2>{0.663107455f, 0.217068076f},
-std::array<float,2>{0.43676123f, 0.688794374f},
-std::array<float,2>{0.367279649f, 0.0222498998f},
-std::array<float,2>{0.60095191f, 0.524070859f},
-std::array<float,2>{0.957317412f, 0.411702037f},
-std::array<float,2>{0.206552863f, 0.803217769f},
-std::array<float,2>{0.119108036f, 0.115288652f},
-std::array<float,2>{0.864444077f, 0.597327828f},
-std::array<float,2>{0.73248136f, 0.465712845f},
-std::array<float,2>{0.469482094f, 0.814536512f},
-std::array<float,2>{0.2658526f, 0.35062021f},
-std::array<float,2>{0.50716114f, 0.990967512f},
-std::array<float,2>{0.889970839f, 0.146951348f},
-std::array<float,2>{0.152612284f, 0.634278595f},
-std::array<float,2>{0.236517504f, 0.387493104f},
-std::array<float,2>{0.981998742f, 0.758227468f},
-std::array<float,2>{0.565024555f, 0.0596916862f},
-std::array<float,2>{0.315752298f, 0.541385591f},
-std::array<float,2>{0.400947243f, 0.230916172f},
-std::array<float,2>{0.634916604f, 0.747582555f},
-std::array<float,2>{0.810062945f, 0.276950479f},
-std::array<float,2>{0.0613211393f, 0.887896538f},
-std::array<float,2>{0.14648445f, 0.0653054938f},
-std::array<float,2>{0.88103497f, 0.576991916f},
-std::array<float,2>{0.510806441f, 0.474813879f},
-std::array<float,2>{0.278529048f, 0.855876684f},
-std::array<float,2>{0.481352746f, 0.333627343f},
-std::array<float,2>{0.724276841f, 0.943648696f},
-std::array<float,2>{0.867505729f, 0.182193339f},
-std::array<float,2>{0.116711393f, 0.683405578f},
-std::array<float,2>{0.0516695045f, 0.418269128f},
-std::array<float,2>{0.803191006f, 0.805317879f},
-std::array<float,2>{0.63185817f, 0.0236877743f},
-std::array<float,2>{0.396086067f, 0.522410333f},
-std::array<float,2>{0.325324267f, 0.203496262f},
-std::array<float,2>{0.578059077f, 0.696472287f},
-std::array<float,2>{0.974201977f, 0.285571367f},
-std::array<float,2>{0.24250637f, 0.915930331f},
-std::array<float,2>{0.0872663781f, 0.155016899f},
-std::array<float,2>{0.838367283f, 0.630104125f},
-std::array<float,2>{0.718658328f, 0.355643362f},
-std::array<float,2>{0.455375105f, 0.998718381f},
-std::array<float,2>{0.304426581f, 0.453825623f},
-std::array<float,2>{0.546566546f, 0.822526097f},
-std::array<float,2>{0.906761944f, 0.120248698f},
-std::array<float,2>{0.164089888f, 0.607701659f},
-std::array<float,2>{0.218232691f, 0.267451406f},
-std::array<float,2>{0.968060374f, 0.877877414f},
-std::array<float,2>{0.603986561f, 0.22542049f},
-std::array<float,2>{0.362433374f, 0.742035091f},
-std::array<float,2>{0.428684294f, 0.052090954f},
-std::array<float,2>{0.668492436f, 0.537427843f},
-std::array<float,2>{0.755530298f, 0.379401654f},
-std::array<float,2>{0.0228253808f, 0.752578437f},
-std::array<float,2>{0.227839306f, 0.246022895f},
-std::array<float,2>{0.984516859f, 0.733240008f},
-std::array<float,2>{0.584819436f, 0.2638762f},
-std::array<float,2>{0.338832051f, 0.895081341f},
-std::array<float,2>{0.388767183f, 0.396829814f},
-std::array<float,2>{0.645018935f, 0.770282745f},
-std::array<float,2>{0.796775639f, 0.0451984145f},
-std::array<float,2>{0.0340687744f, 0.558881223f},
-std::array<float,2>{0.107117094f, 0.362955362f},
-std::array<float,2>{0.856488168f, 0.982322991f},
-std::array<float,2>{0.743609905f, 0.13009125f},
-std::array<float,2>{0.492754847f, 0.64228189f},
-std::array<float,2>{0.250791162f, 0.0963561609f},
-std::array<float,2>{0.526304841f, 0.610788047f},
-std::array<float,2>{0.893272102f, 0.448601186f},
-std::array<float,2>{0.129609764f, 0.83322221f},
-std::array<float,2>{0.0146114454f, 0.0126006315f},
-std::array<float,2>{0.773965299f, 0.509343326f},
-std::array<float,2>{0.681405604f, 0.428037077f},
-std::array<float,2>{0.414775401f, 0.788985312f},
-std::array<float,2>{0.34481737f, 0.30203113f},
-std::array<float,2>{0.619650066f, 0.926580966f},
-std::array<float,2>{0.938315868f, 0.19453986f},
-std::array<float,2>{0.193532974f, 0.70933187f},
-std::array<float,2>{0.172480479f, 0.484661698f},
-std::array<float,2>{0.929772913f, 0.860565186f},
-std::array<float,2>{0.557669163f, 0.0789084211f},
-std::array<float,2>{0.286719054f, 0.578358054f},
-std::array<float,2>{0.438219905f, 0.171720237f},
-std::array<float,2>{0.695629299f, 0.664966047f},
-std::array<float,2>{0.819323361f, 0.32618621f},
-std::array<float,2>{0.0727083907f, 0.957636714f},
-std::array<float,2>{0.181280285f, 0.0300225038f},
-std::array<float,2>{0.924295902f, 0.517909884f},
-std::array<float,2>{0.547608137f, 0.415629923f},
-std::array<float,2>{0.29530248f, 0.810419381f},
-std::array<float,2>{0.44595924f, 0.282149017f},
-std::array<float,2>{0.690456569f, 0.918463051f},
-std::array<float,2>{0.826933265f, 0.210749939f},
-std::array<float,2>{0.0659347549f, 0.703002155f},
-std::array<float,2>{0.00397109287f, 0.471531719f},
-std::array<float,2>{0.768116117f, 0.852893353f},
-std::array<float,2>{0.677482665f, 0.0693139955f},
-std::array<float,2>{0.414028466f, 0.570532978f},
-std::array<float,2>{0.354455978f, 0.18465364f},
-std::array<float,2>{0.6117118f, 0.684843659f},
-std::array<float,2>{0.948260605f, 0.330785215f},
-std::array<float,2>{0.199885458f, 0.940942943f},
-std::array<float,2>{0.0959103927f, 0.222348422f},
-std::array<float,2>{0.8499825f, 0.737460136f},
-std::array<float,2>{0.736933589f, 0.27298674f},
-std::array<float,2>{0.491502434f, 0.880854368f},
-std::array<float,2>{0.263593316f, 0.377722472f},
-std::array<float,2>{0.522467613f, 0.757051051f},
-std::array<float,2>{0.902767718f, 0.0497568622f},
-std::array<float,2>{0.135379285f, 0.531304002f},
-std::array<float,2>{0.22533682f, 0.354965091f},
-std::array<float,2>{0.996717036f, 0.995112896f},
-std::array<float,2>{0.593577266f, 0.151291013f},
-std::array<float,2>{0.334653735f, 0.625428736f},
-std::array<float,2>{0.375481308f, 0.121583417f},
-std::array<float,2>{0.649793088f, 0.603359222f},
-std::array<float,2>{0.783279777f, 0.459521145f},
-std::array<float,2>{0.0454190411f, 0.826208293f},
-std::array<float,2>{0.209300995f, 0.128581911f},
-std::array<float,2>{0.956176221f, 0.646058381f},
-std::array<float,2>{0.594026804f, 0.364881784f},
-std::array<float,2>{0.373417318f, 0.977248132f},
-std::array<float,2>{0.431635559f, 0.450524777f},
-std::array<float,2>{0.658625126f, 0.828768253f},
-std::array<float,2>{0.764223993f, 0.0999303907f},
-std::array<float,2>{0.0282815099f, 0.614815533f},
-std::array<float,2>{0.0790000632f, 0.259542018f},
-std::array<float,2>{0.830668747f, 0.893010378f},
-std::array<float,2>{0.704017341f, 0.249315053f},
-std::array<float,2>{0.464916706f, 0.727448702f},
-std::array<float,2>{0.306106299f, 0.0414648913f},
-std::array<float,2>{0.534645617f, 0.557676494f},
-std::array<float,2>{0.921373129f, 0.39157632f},
-std::array<float,2>{0.15951921f, 0.765686393f},
-std::array<float,2>{0.0582427494f, 0.085268423f},
-std::array<float,2>{0.807543159f, 0.58551085f},
-std::array<float,2>{0.637769461f, 0.49150753f},
-std::array<float,2>{0.402885169f, 0.867067933f},
-std::array<float,2>{0.31821996f, 0.322657049f},
-std::array<float,2>{0.568491101f, 0.955213308f},
-std::array<float,2>{0.97799015f, 0.164932892f},
-std::array<float,2>{0.241800845f, 0.669775248f},
-std::array<float,2>{0.149591476f, 0.42310077f},
-std::array<float,2>{0.886276722f, 0.782681942f},
-std::array<float,2>{0.503896177f, 0.00991900824f},
-std::array<float,2>{0.272570938f, 0.512086868f},
-std::array<float,2>{0.473924756f, 0.188627958f},
-std::array<float,2>{0.728669047f, 0.703378499f},
-std::array<float,2>{0.861802995f, 0.297408134f},
-std::array<float,2>{0.122511752f, 0.923324943f},
-std::array<float,2>{0.246875376f, 0.10777472f},
-std::array<float,2>{0.97102356f, 0.620796621f},
-std::array<float,2>{0.57152766f, 0.440306008f},
-std::array<float,2>{0.321943015f, 0.836042762f},
-std::array<float,2>{0.392718554f, 0.370042682f},
-std::array<float,2>{0.627987742f, 0.970189929f},
-std::array<float,2>{0.797944427f, 0.134038582f},
-std::array<float,2>{0.048395928f, 0.64948225f},
-std::array<float,2>{0.112737931f, 0.40107131f},
-std::array<float,2>{0.872884035f, 0.773781002f},
-std::array<float,2>{0.722426116f, 0.0333209485f},
-std::array<float,2>{0.479831785f, 0.553126812f},
-std::array<float,2>{0.275055617f, 0.238041252f},
-std::array<float,2>{0.514307201f, 0.725890636f},
-std::array<float,2>{0.875644147f, 0.255686849f},
-std::array<float,2>{0.142977268f, 0.903600276f},
-std::array<float,2>{0.0185815338f, 0.161443219f},
-std::array<float,2>{0.751528859f, 0.656796098f},
-std::array<float,2>{0.664292037f, 0.31602627f},
-std::array<float,2>{0.425692677f, 0.968459547f},
-std::array<float,2>{0.366795719f, 0.496667475f},
-std::array<float,2>{0.607887924f, 0.872478068f},
-std::array<float,2>{0.96391362f, 0.0926573053f},
-std::array<float,2>{0.212640926f, 0.592935383f},
-std::array<float,2>{0.168490455f, 0.310923368f},
-std::array<float,2>{0.910792708f, 0.936400056f},
-std::array<float,2>{0.540529728f, 0.195372373f},
-std::array<float,2>{0.299003184f, 0.71639812f},
-std::array<float,2>{0.457325786f, 0.00330973417f},
-std::array<float,2>{0.71290344f, 0.503699362f},
-std::array<float,2>{0.841676056f, 0.434436917f},
-std::array<float,2>{0.0924799293f, 0.791559875f},
-std::array<float,2>{0.126636952f, 0.211697578f},
-std::array<float,2>{0.894846857f, 0.693744004f},
-std::array<float,2>{0.529548466f, 0.291264415f},
-std::array<float,2>{0.25630331f, 0.912778258f},
-std::array<float,2>{0.499939144f, 0.409569412f},
-std::array<float,2>{0.747415543f, 0.798235476f},
-std::array<float,2>{0.853704214f, 0.0182063989f},
-std::array<float,2>{0.104294308f, 0.53085494f},
-std::array<float,2>{0.0353002734f, 0.339607358f},
-std::array<float,2>{0.791199088f, 0.947722137f},
-std::array<float,2>{0.644382358f, 0.178785399f},
-std::array<float,2>{0.386158556f, 0.679489493f},
-std::array<float,2>{0.342301548f, 0.0725103766f},
-std::array<float,2>{0.578576565f, 0.567923307f},
-std::array<float,2>{0.989183128f, 0.480224997f},
-std::array<float,2>{0.233140513f, 0.851431489f},
-std::array<float,2>{0.0769148618f, 0.0570244491f},
-std::array<float,2>{0.814922988f, 0.543932855f},
-std::array<float,2>{0.699797034f, 0.385148227f},
-std::array<float,2>{0.44391942f, 0.765084743f},
-std::array<float,2>{0.282199085f, 0.280052871f},
-std::array<float,2>{0.562253535f, 0.886040509f},
-std::array<float,2>{0.934249163f, 0.230107069f},
-std::array<float,2>{0.17699793f, 0.743195772f},
-std::array<float,2>{0.1901398f, 0.464386314f},
-std::array<float,2>{0.942289352f, 0.819766521f},
-std::array<float,2>{0.622052193f, 0.112280995f},
-std::array<float,2>{0.350493103f, 0.598104954f},
-std::array<float,2>{0.419662386f, 0.141886055f},
-std::array<float,2>{0.687288284f, 0.637714505f},
-std::array<float,2>{0.780202568f, 0.347546011f},
-std::array<float,2>{0.00958163291f, 0.9876948f},
-std::array<float,2>{0.234761581f, 0.059327092f},
-std::array<float,2>{0.98319453f, 0.542357624f},
-std::array<float,2>{0.564379454f, 0.388663054f},
-std::array<float,2>{0.313125074f, 0.759029508f},
-std::array<float,2>{0.399286836f, 0.276230454f},
-std::array<float,2>{0.63365531f, 0.887672067f},
-std::array<float,2>{0.811410308f, 0.232318014f},
-std::array<float,2>{0.059964221f, 0.74635005f},
-std::array<float,2>{0.11959374f, 0.466622919f},
-std::array<float,2>{0.865955174f, 0.815715909f},
-std::array<float,2>{0.732027829f, 0.116339996f},
-std::array<float,2>{0.472337753f, 0.596540153f},
-std::array<float,2>{0.268508762f, 0.147526115f},
-std::array<float,2>{0.505766809f, 0.632895947f},
-std::array<float,2>{0.887652814f, 0.350570023f},
-std::array<float,2>{0.154455721f, 0.991302848f},
-std::array<float,2>{0.0243306346f, 0.218236282f},
-std::array<float,2>{0.758235455f, 0.688111901f},
-std::array<float,2>{0.660814703f, 0.293172032f},
-std::array<float,2>{0.434116334f, 0.908054709f},
-std::array<float,2>{0.369977385f, 0.410307199f},
-std::array<float,2>{0.59925127f, 0.803968906f},
-std::array<float,2>{0.960293174f, 0.0229596123f},
-std::array<float,2>{0.203591764f, 0.524674475f},
-std::array<float,2>{0.160301581f, 0.340033621f},
-std::array<float,2>{0.91674757f, 0.951189756f},
-std::array<float,2>{0.535492897f, 0.175292894f},
-std::array<float,2>{0.308865488f, 0.674621463f},
-std::array<float,2>{0.463694602f, 0.0758914128f},
-std::array<float,2>{0.708003104f, 0.564098299f},
-std::array<float,2>{0.832209468f, 0.481496811f},
-std::array<float,2>{0.0835564807f, 0.847337425f},
-std::array<float,2>{0.138741612f, 0.159191564f},
-std::array<float,2>{0.901193082f, 0.661054075f},
-std::array<float,2>{0.519009173f, 0.32030794f},
-std::array<float,2>{0.260972023f, 0.962107778f},
-std::array<float,2>{0.4876436f, 0.495047063f},
-std::array<float,2>{0.741961002f, 0.86811775f},
-std::array<float,2>{0.844352186f, 0.087931864f},
-std::array<float,2>{0.100177467f, 0.58717972f},
-std::array<float,2>{0.041791141f, 0.304838598f},
-std::array<float,2>{0.787833154f, 0.931386828f},
-std::array<float,2>{0.654294968f, 0.202707052f},
-std::array<float,2>{0.381939501f, 0.713289857f},
-std::array<float,2>{0.328876972f, 0.00579501782f},
-std::array<float,2>{0.589428604f, 0.506137848f},
-std::array<float,2>{0.993220985f, 0.431092352f},
-std::array<float,2>{0.221773297f, 0.795669198f},
-std::array<float,2>{0.0682134181f, 0.104184285f},
-std::array<float,2>{0.82314676f, 0.622680128f},
-std::array<float,2>{0.694847763f, 0.4414846f},
-std::array<float,2>{0.450467765f, 0.840302706f},
-std::array<float,2>{0.291722387f, 0.373717397f},
-std::array<float,2>{0.553530335f, 0.975524664f},
-std::array<float,2>{0.92686528f, 0.138829902f},
-std::array<float,2>{0.186544791f, 0.655037761f},
-std::array<float,2>{0.197705746f, 0.403066635f},
-std::array<float,2>{0.950036645f, 0.779774368f},
-std::array<float,2>{0.615939677f, 0.0357914828f},
-std::array<float,2>{0.357922047f, 0.549888253f},
-std::array<float,2>{0.408360034f, 0.238501489f},
-std::array<float,2>{0.673745096f, 0.719684303f},
-std::array<float,2>{0.772219837f, 0.252896279f},
-std::array<float,2>{0.00143922993f, 0.899092376f},
-std::array<float,2>{0.174066484f, 0.0794401392f},
-std::array<float,2>{0.93355608f, 0.579544127f},
-std::array<float,2>{0.55618602f, 0.486317843f},
-std::array<float,2>{0.288509578f, 0.859778166f},
-std::array<float,2>{0.440378845f, 0.327434778f},
-std::array<float,2>{0.697300494f, 0.95866245f},
-std::array<float,2>{0.816797674f, 0.170193151f},
-std::array<float,2>{0.0708727539f, 0.665740192f},
-std::array<float,2>{0.0131576946f, 0.428910673f},
-std::array<float,2>{0.775747061f, 0.787488401f},
-std::array<float,2>{0.682221234f, 0.012728963f},
-std::array<float,2>{0.41742143f, 0.508585036f},
-std::array<float,2>{0.346580565f, 0.193642691f},
-std::array<float,2>{0.618994355f, 0.710395873f},
-std::array<float,2>{0.941369236f, 0.301148117f},
-std::array<float,2>{0.191837102f, 0.927215099f},
-std::array<float,2>{0.109214008f, 0.129322335f},
-std::array<float,2>{0.858086705f, 0.64110148f},
-std::array<float,2>{0.745067418f, 0.361438334f},
-std::array<float,2>{0.494851261f, 0.98115176f},
-std::array<float,2>{0.252086669f, 0.447758019f},
-std::array<float,2>{0.523492098f, 0.83237958f},
-std::array<float,2>{0.891062617f, 0.0968718678f},
-std::array<float,2>{0.132216915f, 0.610307574f},
-std::array<float,2>{0.229176641f, 0.265368372f},
-std::array<float,2>{0.986400962f, 0.896095514f},
-std::array<float,2>{0.582886517f, 0.244319946f},
-std::array<float,2>{0.337681323f, 0.73405081f},
-std::array<float,2>{0.387389213f, 0.0460510738f},
-std::array<float,2>{0.646778345f, 0.560468554f},
-std::array<float,2>{0.793275177f, 0.39756161f},
-std::array<float,2>{0.0319637284f, 0.771397054f},
-std::array<float,2>{0.216785505f, 0.226274028f},
-std::array<float,2>{0.965227425f, 0.741189122f},
-std::array<float,2>{0.602238595f, 0.266369939f},
-std::array<float,2>{0.359397709f, 0.878266275f},
-std::array<float,2>{0.426197469f, 0.380118221f},
-std::array<float,2>{0.670817614f, 0.753164709f},
-std::array<float,2>{0.757480204f, 0.0512028895f},
-std::array<float,2>{0.0199667159f, 0.538901567f},
-std::array<float,2>{0.0883012339f, 0.357205153f},
-std::array<float,2>{0.837646246f, 0.999115825f},
-std::array<float,2>{0.716212809f, 0.1554254f},
-std::array<float,2>{0.453944176f, 0.629413724f},
-std::array<float,2>{0.300831676f, 0.119872503f},
-std::array<float,2>{0.544810891f, 0.609369993f},
-std::array<float,2>{0.909957051f, 0.454299271f},
-std::array<float,2>{0.16632168f, 0.823369861f},
-std::array<float,2>{0.0533118993f, 0.0248553455f},
-std::array<float,2>{0.800783098f, 0.52278173f},
-std::array<float,2>{0.629757941f, 0.419187576f},
-std::array<float,2>{0.398243964f, 0.806587577f},
-std::array<float,2>{0.327743888f, 0.286803484f},
-std::array<float,2>{0.575753152f, 0.914321005f},
-std::array<float,2>{0.975417435f, 0.204240933f},
-std::array<float,2>{0.245999619f, 0.695596933f},
-std::array<float,2>{0.145179644f, 0.4764162f},
-std::array<float,2>{0.879758298f, 0.856806159f},
-std::array<float,2>{0.508859932f, 0.0656468049f},
-std::array<float,2>{0.279682338f, 0.57800281f},
-std::array<float,2>{0.483819783f, 0.183355704f},
-std::array<float,2>{0.726490676f, 0.682210565f},
-std::array<float,2>{0.870983422f, 0.332578301f},
-std::array<float,2>{0.113576367f, 0.944993079f},
-std::array<float,2>{0.151833445f, 0.0109541332f},
-std::array<float,2>{0.884093702f, 0.512824059f},
-std::array<float,2>{0.500018895f, 0.422640324f},
-std::array<float,2>{0.270658731f, 0.781610906f},
-std::array<float,2>{0.474851936f, 0.298051566f},
-std::array<float,2>{0.726946115f, 0.922846913f},
-std::array<float,2>{0.860303223f, 0.187671885f},
-std::array<float,2>{0.123399332f, 0.704645514f},
-std::array<float,2>{0.055052679f, 0.490790099f},
-std::array<float,2>{0.805471301f, 0.865427852f},
-std::array<float,2>{0.639958203f, 0.0849533379f},
-std::array<float,2>{0.405931503f, 0.584785283f},
-std::array<float,2>{0.319080949f, 0.165671483f},
-std::array<float,2>{0.567046523f, 0.66825676f},
-std::array<float,2>{0.979863942f, 0.323538959f},
-std::array<float,2>{0.23928833f, 0.956370056f},
-std::array<float,2>{0.0801222399f, 0.248100221f},
-std::array<float,2>{0.828826427f, 0.727929473f},
-std::array<float,2>{0.706547141f, 0.2579934f},
-std::array<float,2>{0.467301905f, 0.894284189f},
-std::array<float,2>{0.308158487f, 0.392247498f},
-std::array<float,2>{0.533164918f, 0.76715529f},
-std::array<float,2>{0.918190598f, 0.042038966f},
-std::array<float,2>{0.156485543f, 0.557377219f},
-std::array<float,2>{0.207708508f, 0.363772511f},
-std::array<float,2>{0.953181267f, 0.978441536f},
-std::array<float,2>{0.596009672f, 0.127781317f},
-std::array<float,2>{0.371194392f, 0.644754291f},
-std::array<float,2>{0.433288902f, 0.100640595f},
-std::array<float,2>{0.656577945f, 0.613517284f},
-std::array<float,2>{0.762352169f, 0.449285299f},
-std::array<float,2>{0.0301968697f, 0.829481304f},
-std::array<float,2>{0.223035201f, 0.151814282f},
-std::array<float,2>{0.998813689f, 0.626647413f},
-std::array<float,2>{0.590408266f, 0.354089677f},
-std::array<float,2>{0.332264185f, 0.995413125f},
-std::array<float,2>{0.37795344f, 0.460875779f},
-std::array<float,2>{0.652300835f, 0.827948689f},
-std::array<float,2>{0.781686068f, 0.122660629f},
-std::array<float,2>{0.0435815603f, 0.60178411f},
-std::array<float,2>{0.0956382975f, 0.271696001f},
-std::array<float,2>{0.848327219f, 0.879108965f},
-std::array<float,2>{0.735547602f, 0.221041292f},
-std::array<float,2>{0.489559591f, 0.736427188f},
-std::array<float,2>{0.264542133f, 0.0504185036f},
-std::array<float,2>{0.52042973f, 0.533059061f},
-std::array<float,2>{0.904713154f, 0.378048897f},
-std::array<float,2>{0.1338626f, 0.756678224f},
-std::array<float,2>{0.00628309278f, 0.0699704215f},
-std::array<float,2>{0.765880108f, 0.57134831f},
-std::array<float,2>{0.679400861f, 0.47201556f},
-std::array<float,2>{0.411817372f, 0.851932704f},
-std::array<float,2>{0.353049636f, 0.332022339f},
-std::array<float,2>{0.610044539f, 0.940238059f},
-std::array<float,2>{0.94544661f, 0.183600187f},
-std::array<float,2>{0.202951401f, 0.684231818f},
-std::array<float,2>{0.182361349f, 0.414463282f},
-std::array<float,2>{0.922664285f, 0.809363484f},
-std::array<float,2>{0.54993552f, 0.0302955788f},
-std::array<float,2>{0.294804633f, 0.518829763f},
-std::array<float,2>{0.448218644f, 0.209562197f},
-std::array<float,2>{0.688520849f, 0.701941133f},
-std::array<float,2>{0.825952828f, 0.282307506f},
-std::array<float,2>{0.063082397f, 0.919683456f},
-std::array<float,2>{0.188814491f, 0.113231562f},
-std::array<float,2>{0.945234001f, 0.599160671f},
-std::array<float,2>{0.624978721f, 0.463742077f},
-std::array<float,2>{0.348297298f, 0.818795443f},
-std::array<float,2>{0.420483828f, 0.345765889f},
-std::array<float,2>{0.684542656f, 0.986629903f},
-std::array<float,2>{0.777456045f, 0.141458467f},
-std::array<float,2>{0.0101679554f, 0.637107074f},
-std::array<float,2>{0.0754784569f, 0.386606932f},
-std::array<float,2>{0.813675702f, 0.764181554f},
-std::array<float,2>{0.702782393f, 0.0583022237f},
-std::array<float,2>{0.441539556f, 0.544401467f},
-std::array<float,2>{0.284897894f, 0.228676558f},
-std::array<float,2>{0.560025394f, 0.74289459f},
-std::array<float,2>{0.936505258f, 0.280366868f},
-std::array<float,2>{0.178253531f, 0.885492504f},
-std::array<float,2>{0.0378696918f, 0.17781429f},
-std::array<float,2>{0.790581167f, 0.678152144f},
-std::array<float,2>{0.6407305f, 0.338245034f},
-std::array<float,2>{0.383153588f, 0.948545516f},
-std::array<float,2>{0.341659874f, 0.478752732f},
-std::array<float,2>{0.580973506f, 0.849824488f},
-std::array<float,2>{0.990610659f, 0.0734796077f},
-std::array<float,2>{0.231605977f, 0.566911221f},
-std::array<float,2>{0.128269136f, 0.292359263f},
-std::array<float,2>{0.897280335f, 0.913811088f},
-std::array<float,2>{0.529282212f, 0.212275282f},
-std::array<float,2>{0.254600495f, 0.69450134f},
-std::array<float,2>{0.497117519f, 0.0188743062f},
-std::array<float,2>{0.748220026f, 0.529477119f},
-std::array<float,2>{0.851987302f, 0.40820834f},
-std::array<float,2>{0.102482431f, 0.79706651f},
-std::array<float,2>{0.170020252f, 0.196392447f},
-std::array<float,2>{0.913402855f, 0.714954615f},
-std::array<float,2>{0.541297197f, 0.312276691f},
-std::array<float,2>{0.297066748f, 0.937395692f},
-std::array<float,2>{0.45906505f, 0.435321867f},
-std::array<float,2>{0.712810338f, 0.792851806f},
-std::array<float,2>{0.843631029f, 0.00232432294f},
-std::array<float,2>{0.0900902972f, 0.502305925f},
-std::array<float,2>{0.0156989787f, 0.315024585f},
-std::array<float,2>{0.752746582f, 0.966913223f},
-std::array<float,2>{0.666293502f, 0.16112034f},
-std::array<float,2>{0.423513651f, 0.657886028f},
-std::array<float,2>{0.364041924f, 0.093270205f},
-std::array<float,2>{0.606196404f, 0.591971874f},
-std::array<float,2>{0.961852372f, 0.498039633f},
-std::array<float,2>{0.213774636f, 0.871967852f},
-std::array<float,2>{0.110493459f, 0.0341895223f},
-std::array<float,2>{0.874071002f, 0.55389899f},
-std::array<float,2>{0.719177961f, 0.402159333f},
-std::array<float,2>{0.476661712f, 0.775093913f},
-std::array<float,2>{0.276147932f, 0.253951222f},
-std::array<float,2>{0.512305677f, 0.902826607f},
-std::array<float,2>{0.877350807f, 0.236513481f},
-std::array<float,2>{0.141915426f, 0.725572705f},
-std::array<float,2>{0.248780519f, 0.440919518f},
-std::array<float,2>{0.968852997f, 0.8376894f},
-std::array<float,2>{0.57404995f, 0.109285109f},
-std::array<float,2>{0.324051887f, 0.619891047f},
-std::array<float,2>{0.392110318f, 0.13368082f},
-std::array<float,2>{0.626912713f, 0.648778319f},
-std::array<float,2>{0.800064325f, 0.370651335f},
-std::array<float,2>{0.0489888117f, 0.96924299f},
-std::array<float,2>{0.205877855f, 0.0200986825f},
-std::array<float,2>{0.958683431f, 0.525818169f},
-std::array<float,2>{0.600452185f, 0.412600547f},
-std::array<float,2>{0.368631303f, 0.801596344f},
-std::array<float,2>{0.436493427f, 0.296132952f},
-std::array<float,2>{0.66213274f, 0.909267187f},
-std::array<float,2>{0.75986141f, 0.215050906f},
-std::array<float,2>{0.0253939182f, 0.69107157f},
-std::array<float,2>{0.0854267552f, 0.483192474f},
-std::array<float,2>{0.834003568f, 0.84563452f},
-std::array<float,2>{0.710586131f, 0.0762992129f},
-std::array<float,2>{0.461447954f, 0.564966142f},
-std::array<float,2>{0.312093496f, 0.173466429f},
-std::array<float,2>{0.537849844f, 0.673229158f},
-std::array<float,2>{0.914897144f, 0.343748897f},
-std::array<float,2>{0.163429633f, 0.949528217f},
-std::array<float,2>{0.0616036467f, 0.232678115f},
-std::array<float,2>{0.809161186f, 0.749364674f},
-std::array<float,2>{0.636399984f, 0.274150461f},
-std::array<float,2>{0.401740223f, 0.890233755f},
-std::array<float,2>{0.314592123f, 0.388734788f},
-std::array<float,2>{0.565700352f, 0.761082709f},
-std::array<float,2>{0.981428266f, 0.0615887679f},
-std::array<float,2>{0.238238484f, 0.541007996f},
-std::array<float,2>{0.153664172f, 0.348735094f},
-std::array<float,2>{0.888979375f, 0.990080893f},
-std::array<float,2>{0.506732821f, 0.144729942f},
-std::array<float,2>{0.267051131f, 0.635671914f},
-std::array<float,2>{0.46994102f, 0.114430688f},
-std::array<float,2>{0.734052122f, 0.594253898f},
-std::array<float,2>{0.863408685f, 0.467782587f},
-std::array<float,2>{0.117776491f, 0.812886178f},
-std::array<float,2>{0.185341462f, 0.138396814f},
-std::array<float,2>{0.928178787f, 0.653497756f},
-std::array<float,2>{0.551113963f, 0.372107446f},
-std::array<float,2>{0.289402485f, 0.972829521f},
-std::array<float,2>{0.452333719f, 0.444736511f},
-std::array<float,2>{0.692169666f, 0.841933966f},
-std::array<float,2>{0.821416616f, 0.102793507f},
-std::array<float,2>{0.0697667822f, 0.623538911f},
-std::array<float,2>{0.0033274265f, 0.251430154f},
-std::array<float,2>{0.770599425f, 0.900534391f},
-std::array<float,2>{0.673989356f, 0.240948617f},
-std::array<float,2>{0.407263488f, 0.72248596f},
-std::array<float,2>{0.355485976f, 0.0373748504f},
-std::array<float,2>{0.61505127f, 0.547863185f},
-std::array<float,2>{0.951476872f, 0.404508919f},
-std::array<float,2>{0.197215721f, 0.77831322f},
-std::array<float,2>{0.0978113562f, 0.0866509378f},
-std::array<float,2>{0.84671104f, 0.589140773f},
-std::array<float,2>{0.738806784f, 0.492466092f},
-std::array<float,2>{0.48610568f, 0.869529903f},
-std::array<float,2>{0.25790751f, 0.318022966f},
-std::array<float,2>{0.517388761f, 0.963526905f},
-std::array<float,2>{0.900367916f, 0.157407403f},
-std::array<float,2>{0.138281196f, 0.663142085f},
-std::array<float,2>{0.219622284f, 0.432807982f},
-std::array<float,2>{0.995397925f, 0.794043183f},
-std::array<float,2>{0.587555647f, 0.00624717027f},
-std::array<float,2>{0.331550568f, 0.504047573f},
-std::array<float,2>{0.379660636f, 0.199687317f},
-std::array<float,2>{0.655727863f, 0.711945891f},
-std::array<float,2>{0.786427617f, 0.307198912f},
-std::array<float,2>{0.0398960859f, 0.932266593f},
-std::array<float,2>{0.130711034f, 0.0947589576f},
-std::array<float,2>{0.894230068f, 0.61218667f},
-std::array<float,2>{0.527290344f, 0.447083592f},
-std::array<float,2>{0.251853347f, 0.835805297f},
-std::array<float,2>{0.493911296f, 0.360845923f},
-std::array<float,2>{0.742828548f, 0.982907236f},
-std::array<float,2>{0.855977297f, 0.132697925f},
-std::array<float,2>{0.105902798f, 0.643814325f},
-std::array<float,2>{0.0347409733f, 0.396078289f},
-std::array<float,2>{0.795496106f, 0.772652507f},
-std::array<float,2>{0.646266699f, 0.044103872f},
-std::array<float,2>{0.389870077f, 0.562261879f},
-std::array<float,2>{0.339726567f, 0.243982658f},
-std::array<float,2>{0.58539927f, 0.73100549f},
-std::array<float,2>{0.985995471f, 0.262316734f},
-std::array<float,2>{0.227196321f, 0.897580802f},
-std::array<float,2>{0.0741614401f, 0.16949892f},
-std::array<float,2>{0.819374323f, 0.667795241f},
-std::array<float,2>{0.697201133f, 0.324601382f},
-std::array<float,2>{0.439192027f, 0.959109008f},
-std::array<float,2>{0.285348237f, 0.487745345f},
-std::array<float,2>{0.557227671f, 0.862306476f},
-std::array<float,2>{0.93085748f, 0.0814456269f},
-std::array<float,2>{0.173057422f, 0.580641329f},
-std::array<float,2>{0.194968879f, 0.303659797f},
-std::array<float,2>{0.939070404f, 0.92919898f},
-std::array<float,2>{0.620302916f, 0.1921307f},
-std::array<float,2>{0.344259411f, 0.707722545f},
-std::array<float,2>{0.415115654f, 0.0151768401f},
-std::array<float,2>{0.679860055f, 0.510079265f},
-std::array<float,2>{0.775216103f, 0.427050889f},
-std::array<float,2>{0.0154980421f, 0.786027849f},
-std::array<float,2>{0.243249774f, 0.20679757f},
-std::array<float,2>{0.97288394f, 0.697660565f},
-std::array<float,2>{0.576583087f, 0.288652986f},
-std::array<float,2>{0.324959576f, 0.916108131f},
-std::array<float,2>{0.395500511f, 0.421334624f},
-std::array<float,2>{0.631684899f, 0.808192313f},
-std::array<float,2>{0.803797722f, 0.0266953353f},
-std::array<float,2>{0.0527019277f, 0.52079469f},
-std::array<float,2>{0.115984783f, 0.335817754f},
-std::array<float,2>{0.868837416f, 0.941678464f},
-std::array<float,2>{0.723484993f, 0.180721283f},
-std::array<float,2>{0.481519461f, 0.680740416f},
-std::array<float,2>{0.277652979f, 0.0631944537f},
-std::array<float,2>{0.5102368f, 0.575976908f},
-std::array<float,2>{0.882059813f, 0.473905116f},
-std::array<float,2>{0.147998646f, 0.858842194f},
-std::array<float,2>{0.0218649507f, 0.0544601604f},
-std::array<float,2>{0.754820228f, 0.536360323f},
-std::array<float,2>{0.668981433f, 0.381884694f},
-std::array<float,2>{0.42917043f, 0.750270784f},
-std::array<float,2>{0.361396909f, 0.267638355f},
-std::array<float,2>{0.605022073f, 0.875279486f},
-std::array<float,2>{0.967630923f, 0.224260956f},
-std::array<float,2>{0.217587978f, 0.738449037f},
-std::array<float,2>{0.165106729f, 0.456927836f},
-std::array<float,2>{0.907351971f, 0.820950806f},
-std::array<float,2>{0.545729935f, 0.118747301f},
-std::array<float,2>{0.302826196f, 0.606901824f},
-std::array<float,2>{0.456801862f, 0.152725801f},
-std::array<float,2>{0.717143238f, 0.63139385f},
-std::array<float,2>{0.838921547f, 0.358346999f},
-std::array<float,2>{0.086680837f, 0.998036683f},
-std::array<float,2>{0.15882948f, 0.0397515595f},
-std::array<float,2>{0.920846581f, 0.555519402f},
-std::array<float,2>{0.533759058f, 0.394328326f},
-std::array<float,2>{0.305632204f, 0.767764449f},
-std::array<float,2>{0.466117233f, 0.260106534f},
-std::array<float,2>{0.704745531f, 0.891756654f},
-std::array<float,2>{0.831520557f, 0.246492043f},
-std::array<float,2>{0.0800214484f, 0.729187846f},
-std::array<float,2>{0.0292530376f, 0.451337129f},
-std::array<float,2>{0.76469487f, 0.830811262f},
-std::array<float,2>{0.659426808f, 0.0979356095f},
-std::array<float,2>{0.429975182f, 0.617043793f},
-std::array<float,2>{0.374607116f, 0.125265211f},
-std::array<float,2>{0.595062554f, 0.64802444f},
-std::array<float,2>{0.955788136f, 0.367109716f},
-std::array<float,2>{0.210578889f, 0.979931772f},
-std::array<float,2>{0.121249117f, 0.189630345f},
-std::array<float,2>{0.862508297f, 0.705704749f},
-std::array<float,2>{0.730171263f, 0.300215662f},
-std::array<float,2>{0.47271657f, 0.925018251f},
-std::array<float,2>{0.27178067f, 0.424718887f},
-std::array<float,2>{0.502561867f, 0.783250749f},
-std::array<float,2>{0.884983003f, 0.00850778166f},
-std::array<float,2>{0.148860559f, 0.513910294f},
-std::array<float,2>{0.240418389f, 0.320898861f},
-std::array<float,2>{0.977078259f, 0.953927755f},
-std::array<float,2>{0.569613039f, 0.166126832f},
-std::array<float,2>{0.317170352f, 0.671090424f},
-std::array<float,2>{0.403508753f, 0.0838464051f},
-std::array<float,2>{0.636734724f, 0.582483053f},
-std::array<float,2>{0.808444083f, 0.488687575f},
-std::array<float,2>{0.0568166822f, 0.864682138f},
-std::array<float,2>{0.201146439f, 0.187236726f},
-std::array<float,2>{0.947669446f, 0.686646521f},
-std::array<float,2>{0.612514853f, 0.329676419f},
-std::array<float,2>{0.355111599f, 0.938130736f},
-std::array<float,2>{0.412517995f, 0.469149411f},
-std::array<float,2>{0.676552117f, 0.854457259f},
-std::array<float,2>{0.769331157f, 0.0674840286f},
-std::array<float,2>{0.00554791233f, 0.572910964f},
-std::array<float,2>{0.0645783469f, 0.284465939f},
-std::array<float,2>{0.827998042f, 0.921136618f},
-std::array<float,2>{0.690010905f, 0.208582908f},
-std::array<float,2>{0.446734607f, 0.699479401f},
-std::array<float,2>{0.296670794f, 0.0282551907f},
-std::array<float,2>{0.548520327f, 0.516982198f},
-std::array<float,2>{0.925210893f, 0.41730085f},
-std::array<float,2>{0.180649027f, 0.812045395f},
-std::array<float,2>{0.0460579321f, 0.123600744f},
-std::array<float,2>{0.784395933f, 0.604255795f},
-std::array<float,2>{0.648994803f, 0.458757192f},
-std::array<float,2>{0.376500309f, 0.825557113f},
-std::array<float,2>{0.335477591f, 0.352720469f},
-std::array<float,2>{0.592398822f, 0.993109941f},
-std::array<float,2>{0.997330785f, 0.150284827f},
-std::array<float,2>{0.226182655f, 0.628848672f},
-std::array<float,2>{0.135952204f, 0.375418186f},
-std::array<float,2>{0.903669536f, 0.754249275f},
-std::array<float,2>{0.52174741f, 0.0483936369f},
-std::array<float,2>{0.262517244f, 0.533386946f},
-std::array<float,2>{0.490631491f, 0.219140247f},
-std::array<float,2>{0.737997234f, 0.735305548f},
-std::array<float,2>{0.851253033f, 0.271443188f},
-std::array<float,2>{0.0973905101f, 0.881612837f},
-std::array<float,2>{0.233965412f, 0.0714484081f},
-std::array<float,2>{0.989501655f, 0.569375634f},
-std::array<float,2>{0.579574943f, 0.477950186f},
-std::array<float,2>{0.34278062f, 0.848439991f},
-std::array<float,2>{0.385583699f, 0.337622225f},
-std::array<float,2>{0.643275201f, 0.946036756f},
-std::array<float,2>{0.792535186f, 0.177684516f},
-std::array<float,2>{0.0365673304f, 0.67643404f},
-std::array<float,2>{0.105257533f, 0.406816483f},
-std::array<float,2>{0.854736447f, 0.799225092f},
-std::array<float,2>{0.746971905f, 0.0157630499f},
-std::array<float,2>{0.498614103f, 0.527798355f},
-std::array<float,2>{0.257611156f, 0.213206455f},
-std::array<float,2>{0.531231344f, 0.691853046f},
-std::array<float,2>{0.896350503f, 0.289808691f},
-std::array<float,2>{0.125877127f, 0.911857069f},
-std::array<float,2>{0.00827961043f, 0.143959701f},
-std::array<float,2>{0.780518293f, 0.639413297f},
-std::array<float,2>{0.685689509f, 0.34569028f},
-std::array<float,2>{0.418400645f, 0.984664023f},
-std::array<float,2>{0.351388186f, 0.460943252f},
-std::array<float,2>{0.622175932f, 0.818053067f},
-std::array<float,2>{0.942499876f, 0.109916233f},
-std::array<float,2>{0.191199899f, 0.600969791f},
-std::array<float,2>{0.176229179f, 0.279070437f},
-std::array<float,2>{0.934928715f, 0.884021759f},
-std::array<float,2>{0.561208665f, 0.226570278f},
-std::array<float,2>{0.283182859f, 0.745787203f},
-std::array<float,2>{0.444766939f, 0.0565373078f},
-std::array<float,2>{0.700485468f, 0.546554029f},
-std::array<float,2>{0.815822721f, 0.384126335f},
-std::array<float,2>{0.0779368728f, 0.763251483f},
-std::array<float,2>{0.144201547f, 0.235746637f},
-std::array<float,2>{0.876774311f, 0.723364174f},
-std::array<float,2>{0.515106261f, 0.256683201f},
-std::array<float,2>{0.27413559f, 0.905865014f},
-std::array<float,2>{0.479347527f, 0.400070101f},
-std::array<float,2>{0.720802724f, 0.777074516f},
-std::array<float,2>{0.871312678f, 0.0329997465f},
-std::array<float,2>{0.111822292f, 0.551897287f},
-std::array<float,2>{0.0476959869f, 0.36774379f},
-std::array<float,2>{0.797303021f, 0.970934153f},
-std::array<float,2>{0.62737906f, 0.134978116f},
-std::array<float,2>{0.393816024f, 0.651038468f},
-std::array<float,2>{0.32034272f, 0.10617698f},
-std::array<float,2>{0.571274936f, 0.617452919f},
-std::array<float,2>{0.972003341f, 0.439358711f},
-std::array<float,2>{0.247653261f, 0.838216543f},
-std::array<float,2>{0.0931604207f, 0.000645237509f},
-std::array<float,2>{0.840579152f, 0.500335932f},
-std::array<float,2>{0.71389693f, 0.436707914f},
-std::array<float,2>{0.458118409f, 0.790075183f},
-std::array<float,2>{0.300360054f, 0.309013695f},
-std::array<float,2>{0.539565802f, 0.934813559f},
-std::array<float,2>{0.912005961f, 0.198196575f},
-std::array<float,2>{0.169134855f, 0.718460202f},
-std::array<float,2>{0.211593226f, 0.499285519f},
-std::array<float,2>{0.963623643f, 0.874298155f},
-std::array<float,2>{0.608782351f, 0.090780735f},
-std::array<float,2>{0.365414172f, 0.590973198f},
-std::array<float,2>{0.424779117f, 0.163665563f},
-std::array<float,2>{0.66566056f, 0.658867121f},
-std::array<float,2>{0.750696957f, 0.314339161f},
-std::array<float,2>{0.0176373869f, 0.96672231f}}
\ No newline at end of file
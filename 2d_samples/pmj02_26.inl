@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.4284603f, 0.423553109f},
-std::array<float,2>{0.576079786f, 0.627959788f},
-std::array<float,2>{0.110254057f, 0.977551579f},
-std::array<float,2>{0.839929342f, 0.210577965f},
-std::array<float,2>{0.176381052f, 0.0781654641f},
-std::array<float,2>{0.978732228f, 0.857107222f},
-std::array<float,2>{0.261010051f, 0.620502949f},
-std::array<float,2>{0.700931489f, 0.339503586f},
-std::array<float,2>{0.0261483174f, 0.307307392f},
-std::array<float,2>{0.77545929f, 0.512858748f},
-std::array<float,2>{0.482691973f, 0.755665362f},
-std::array<float,2>{0.508971512f, 0.0403314419f},
-std::array<float,2>{0.325005382f, 0.14562121f},
-std::array<float,2>{0.666598737f, 0.885884225f},
-std::array<float,2>{0.205160901f, 0.717168272f},
-std::array<float,2>{0.910452127f, 0.462454259f},
-std::array<float,2>{0.294174999f, 0.354319751f},
-std::array<float,2>{0.747163177f, 0.577777267f},
-std::array<float,2>{0.147490501f, 0.818552375f},
-std::array<float,2>{0.944899678f, 0.107327029f},
-std::array<float,2>{0.0787808299f, 0.237860426f},
-std::array<float,2>{0.873733342f, 0.968179226f},
-std::array<float,2>{0.379402012f, 0.682096839f},
-std::array<float,2>{0.608199418f, 0.404104054f},
-std::array<float,2>{0.246109977f, 0.477000475f},
-std::array<float,2>{0.879401088f, 0.743732929f},
-std::array<float,2>{0.345179379f, 0.921640277f},
-std::array<float,2>{0.648691833f, 0.179691717f},
-std::array<float,2>{0.44843632f, 0.0256839227f},
-std::array<float,2>{0.54386574f, 0.802936912f},
-std::array<float,2>{0.032863155f, 0.543603539f},
-std::array<float,2>{0.783075035f, 0.272411853f},
-std::array<float,2>{0.495321691f, 0.263168573f},
-std::array<float,2>{0.527979076f, 0.552069485f},
-std::array<float,2>{0.00434898539f, 0.791401505f},
-std::array<float,2>{0.756011546f, 0.0049778847f},
-std::array<float,2>{0.196068317f, 0.158538729f},
-std::array<float,2>{0.936187744f, 0.932460785f},
-std::array<float,2>{0.330340147f, 0.728551686f},
-std::array<float,2>{0.672183812f, 0.494002879f},
-std::array<float,2>{0.108439028f, 0.389964938f},
-std::array<float,2>{0.827402472f, 0.671251237f},
-std::array<float,2>{0.407578737f, 0.944385171f},
-std::array<float,2>{0.586101532f, 0.234342068f},
-std::array<float,2>{0.270089f, 0.11215762f},
-std::array<float,2>{0.712590635f, 0.836919785f},
-std::array<float,2>{0.162570477f, 0.590910673f},
-std::array<float,2>{0.985866308f, 0.360584974f},
-std::array<float,2>{0.366368622f, 0.439833343f},
-std::array<float,2>{0.636955023f, 0.687930942f},
-std::array<float,2>{0.219232559f, 0.895373642f},
-std::array<float,2>{0.902733684f, 0.131910041f},
-std::array<float,2>{0.0515399016f, 0.050685849f},
-std::array<float,2>{0.806191981f, 0.766970873f},
-std::array<float,2>{0.466891259f, 0.525129497f},
-std::array<float,2>{0.547134697f, 0.295491546f},
-std::array<float,2>{0.130328745f, 0.322803944f},
-std::array<float,2>{0.965170324f, 0.595215619f},
-std::array<float,2>{0.308857083f, 0.874616742f},
-std::array<float,2>{0.731921434f, 0.066634506f},
-std::array<float,2>{0.399806887f, 0.202355519f},
-std::array<float,2>{0.619766176f, 0.991801798f},
-std::array<float,2>{0.067355521f, 0.648166478f},
-std::array<float,2>{0.853756666f, 0.419736862f},
-std::array<float,2>{0.45350951f, 0.486955404f},
-std::array<float,2>{0.559995353f, 0.723602355f},
-std::array<float,2>{0.0565596409f, 0.924197495f},
-std::array<float,2>{0.798223138f, 0.170666516f},
-std::array<float,2>{0.22908105f, 0.0152395926f},
-std::array<float,2>{0.897333026f, 0.786533117f},
-std::array<float,2>{0.369865626f, 0.559537411f},
-std::array<float,2>{0.629975557f, 0.251434237f},
-std::array<float,2>{0.0749970302f, 0.37086156f},
-std::array<float,2>{0.849607289f, 0.579916418f},
-std::array<float,2>{0.395372421f, 0.831224382f},
-std::array<float,2>{0.6147241f, 0.121942788f},
-std::array<float,2>{0.303524703f, 0.221387118f},
-std::array<float,2>{0.724424481f, 0.948733449f},
-std::array<float,2>{0.137446612f, 0.659233332f},
-std::array<float,2>{0.956948578f, 0.382568926f},
-std::array<float,2>{0.338023394f, 0.28418088f},
-std::array<float,2>{0.680956721f, 0.523170292f},
-std::array<float,2>{0.192269117f, 0.774574637f},
-std::array<float,2>{0.928017974f, 0.0565610267f},
-std::array<float,2>{0.0081060119f, 0.139889538f},
-std::array<float,2>{0.758496284f, 0.905100226f},
-std::array<float,2>{0.489270419f, 0.698385537f},
-std::array<float,2>{0.519966722f, 0.451462537f},
-std::array<float,2>{0.166941643f, 0.409364462f},
-std::array<float,2>{0.994868159f, 0.649773836f},
-std::array<float,2>{0.279444486f, 0.995443881f},
-std::array<float,2>{0.705750406f, 0.189215004f},
-std::array<float,2>{0.419902831f, 0.0710794553f},
-std::array<float,2>{0.578335822f, 0.86405015f},
-std::array<float,2>{0.0945206136f, 0.602223694f},
-std::array<float,2>{0.81272459f, 0.317880213f},
-std::array<float,2>{0.383784354f, 0.331450582f},
-std::array<float,2>{0.59456861f, 0.609759986f},
-std::array<float,2>{0.0864202008f, 0.844858885f},
-std::array<float,2>{0.865293562f, 0.0862844065f},
-std::array<float,2>{0.151765168f, 0.215701953f},
-std::array<float,2>{0.951091409f, 0.973879755f},
-std::array<float,2>{0.284691513f, 0.633013189f},
-std::array<float,2>{0.738485575f, 0.430852145f},
-std::array<float,2>{0.0442352369f, 0.460296839f},
-std::array<float,2>{0.795429349f, 0.706021547f},
-std::array<float,2>{0.442617625f, 0.882714808f},
-std::array<float,2>{0.536262095f, 0.151308507f},
-std::array<float,2>{0.359065175f, 0.0321797542f},
-std::array<float,2>{0.640628517f, 0.761729956f},
-std::array<float,2>{0.240087464f, 0.50585717f},
-std::array<float,2>{0.884386778f, 0.298105538f},
-std::array<float,2>{0.2568973f, 0.398156226f},
-std::array<float,2>{0.694570839f, 0.677581131f},
-std::array<float,2>{0.182095394f, 0.955647647f},
-std::array<float,2>{0.973590195f, 0.249828205f},
-std::array<float,2>{0.124407522f, 0.101535812f},
-std::array<float,2>{0.831678748f, 0.825202286f},
-std::array<float,2>{0.437406063f, 0.564194024f},
-std::array<float,2>{0.564263761f, 0.351048797f},
-std::array<float,2>{0.215230614f, 0.274780065f},
-std::array<float,2>{0.918114781f, 0.537150085f},
-std::array<float,2>{0.315847367f, 0.81141305f},
-std::array<float,2>{0.66067934f, 0.0204877891f},
-std::array<float,2>{0.475273967f, 0.173749954f},
-std::array<float,2>{0.504062533f, 0.908296108f},
-std::array<float,2>{0.0211169608f, 0.740731776f},
-std::array<float,2>{0.768170714f, 0.470283478f},
-std::array<float,2>{0.394282013f, 0.467975348f},
-std::array<float,2>{0.610624909f, 0.713345468f},
-std::array<float,2>{0.0725402683f, 0.890200615f},
-std::array<float,2>{0.845328867f, 0.143572405f},
-std::array<float,2>{0.135393262f, 0.0444098301f},
-std::array<float,2>{0.957919478f, 0.750549316f},
-std::array<float,2>{0.300689697f, 0.511713147f},
-std::array<float,2>{0.722347081f, 0.309733331f},
-std::array<float,2>{0.0597494729f, 0.343389183f},
-std::array<float,2>{0.801080942f, 0.621629f},
-std::array<float,2>{0.460374206f, 0.853632569f},
-std::array<float,2>{0.557615221f, 0.085889779f},
-std::array<float,2>{0.373244077f, 0.203561008f},
-std::array<float,2>{0.62725997f, 0.982573271f},
-std::array<float,2>{0.232930288f, 0.629742742f},
-std::array<float,2>{0.89409256f, 0.429014623f},
-std::array<float,2>{0.276097864f, 0.267651767f},
-std::array<float,2>{0.708174229f, 0.542735577f},
-std::array<float,2>{0.170395643f, 0.797455609f},
-std::array<float,2>{0.999137521f, 0.0283727814f},
-std::array<float,2>{0.0995418802f, 0.184133962f},
-std::array<float,2>{0.816938579f, 0.915924191f},
-std::array<float,2>{0.41734302f, 0.749833703f},
-std::array<float,2>{0.583166897f, 0.48202914f},
-std::array<float,2>{0.189870879f, 0.400225729f},
-std::array<float,2>{0.922100544f, 0.685840428f},
-std::array<float,2>{0.342326075f, 0.964048624f},
-std::array<float,2>{0.687318861f, 0.239324003f},
-std::array<float,2>{0.487194866f, 0.102768876f},
-std::array<float,2>{0.517757773f, 0.815566361f},
-std::array<float,2>{0.013422275f, 0.57288754f},
-std::array<float,2>{0.765411139f, 0.358069777f},
-std::array<float,2>{0.439051181f, 0.364997447f},
-std::array<float,2>{0.533643961f, 0.589449763f},
-std::array<float,2>{0.0426097587f, 0.840477645f},
-std::array<float,2>{0.789834678f, 0.114520393f},
-std::array<float,2>{0.234524429f, 0.228550732f},
-std::array<float,2>{0.890035689f, 0.938859224f},
-std::array<float,2>{0.353962988f, 0.667924464f},
-std::array<float,2>{0.645990789f, 0.383695304f},
-std::array<float,2>{0.0910685211f, 0.499523252f},
-std::array<float,2>{0.860874116f, 0.731708467f},
-std::array<float,2>{0.388538569f, 0.936440945f},
-std::array<float,2>{0.600620091f, 0.161841154f},
-std::array<float,2>{0.285881847f, 0.00204425445f},
-std::array<float,2>{0.737372875f, 0.794218361f},
-std::array<float,2>{0.15341948f, 0.548094213f},
-std::array<float,2>{0.946620882f, 0.261043221f},
-std::array<float,2>{0.317754358f, 0.4175331f},
-std::array<float,2>{0.657282412f, 0.643066406f},
-std::array<float,2>{0.213013545f, 0.986577034f},
-std::array<float,2>{0.916533649f, 0.197361767f},
-std::array<float,2>{0.0178460367f, 0.0663709119f},
-std::array<float,2>{0.772443712f, 0.867504358f},
-std::array<float,2>{0.469459653f, 0.601282001f},
-std::array<float,2>{0.50004822f, 0.32723543f},
-std::array<float,2>{0.185247868f, 0.292139918f},
-std::array<float,2>{0.969196141f, 0.530562103f},
-std::array<float,2>{0.25101456f, 0.770860434f},
-std::array<float,2>{0.691082299f, 0.052094195f},
-std::array<float,2>{0.43077904f, 0.127965644f},
-std::array<float,2>{0.567335486f, 0.892295182f},
-std::array<float,2>{0.119729497f, 0.691774964f},
-std::array<float,2>{0.835609376f, 0.443569988f},
-std::array<float,2>{0.47957024f, 0.377468437f},
-std::array<float,2>{0.514082551f, 0.660939157f},
-std::array<float,2>{0.0310720168f, 0.952365279f},
-std::array<float,2>{0.780977547f, 0.226332456f},
-std::array<float,2>{0.208587036f, 0.119579032f},
-std::array<float,2>{0.909679294f, 0.835202157f},
-std::array<float,2>{0.323180109f, 0.583878815f},
-std::array<float,2>{0.668668449f, 0.37293005f},
-std::array<float,2>{0.115050681f, 0.256916851f},
-std::array<float,2>{0.839020073f, 0.554950297f},
-std::array<float,2>{0.4254646f, 0.7850793f},
-std::array<float,2>{0.573061168f, 0.00934200827f},
-std::array<float,2>{0.262883633f, 0.166246131f},
-std::array<float,2>{0.699135542f, 0.92612344f},
-std::array<float,2>{0.175452396f, 0.72002238f},
-std::array<float,2>{0.983962595f, 0.491753727f},
-std::array<float,2>{0.348384947f, 0.313156307f},
-std::array<float,2>{0.654615521f, 0.60912627f},
-std::array<float,2>{0.243121698f, 0.859921992f},
-std::array<float,2>{0.878182948f, 0.0756777823f},
-std::array<float,2>{0.0356739312f, 0.194215238f},
-std::array<float,2>{0.78637141f, 0.9976179f},
-std::array<float,2>{0.44979167f, 0.652367949f},
-std::array<float,2>{0.540261269f, 0.410700262f},
-std::array<float,2>{0.144524679f, 0.446878135f},
-std::array<float,2>{0.9383986f, 0.701747179f},
-std::array<float,2>{0.291896909f, 0.9022699f},
-std::array<float,2>{0.745696008f, 0.134741068f},
-std::array<float,2>{0.378892094f, 0.0620584674f},
-std::array<float,2>{0.604460061f, 0.779369593f},
-std::array<float,2>{0.0837409347f, 0.516091168f},
-std::array<float,2>{0.868518531f, 0.285899699f},
-std::array<float,2>{0.411850065f, 0.302485466f},
-std::array<float,2>{0.59005785f, 0.503322065f},
-std::array<float,2>{0.104885064f, 0.761201799f},
-std::array<float,2>{0.82208544f, 0.037979506f},
-std::array<float,2>{0.159462824f, 0.156214818f},
-std::array<float,2>{0.990038574f, 0.876528323f},
-std::array<float,2>{0.269253224f, 0.708841324f},
-std::array<float,2>{0.715236247f, 0.454481393f},
-std::array<float,2>{0.00287127751f, 0.433884799f},
-std::array<float,2>{0.750110567f, 0.640560567f},
-std::array<float,2>{0.496517867f, 0.971237957f},
-std::array<float,2>{0.525589287f, 0.214015573f},
-std::array<float,2>{0.335767716f, 0.0920128673f},
-std::array<float,2>{0.677450836f, 0.850782633f},
-std::array<float,2>{0.200202122f, 0.615225554f},
-std::array<float,2>{0.931474149f, 0.333344042f},
-std::array<float,2>{0.306559861f, 0.474082261f},
-std::array<float,2>{0.727552116f, 0.734825015f},
-std::array<float,2>{0.126661882f, 0.912806928f},
-std::array<float,2>{0.963501155f, 0.17767261f},
-std::array<float,2>{0.0637606084f, 0.0160910767f},
-std::array<float,2>{0.858857393f, 0.805821836f},
-std::array<float,2>{0.405509442f, 0.531733871f},
-std::array<float,2>{0.621515214f, 0.279790342f},
-std::array<float,2>{0.223515525f, 0.344588935f},
-std::array<float,2>{0.899468005f, 0.569345355f},
-std::array<float,2>{0.360018492f, 0.820766687f},
-std::array<float,2>{0.634595931f, 0.0976214856f},
-std::array<float,2>{0.463612318f, 0.244575515f},
-std::array<float,2>{0.552565634f, 0.958468556f},
-std::array<float,2>{0.0498305187f, 0.674122274f},
-std::array<float,2>{0.809966326f, 0.392333835f},
-std::array<float,2>{0.381676614f, 0.40569827f},
-std::array<float,2>{0.606015921f, 0.681615591f},
-std::array<float,2>{0.0820227638f, 0.966326773f},
-std::array<float,2>{0.871248007f, 0.234408781f},
-std::array<float,2>{0.145518467f, 0.108949311f},
-std::array<float,2>{0.941599846f, 0.816968024f},
-std::array<float,2>{0.294993103f, 0.575551331f},
-std::array<float,2>{0.748411536f, 0.352439016f},
-std::array<float,2>{0.0340241492f, 0.270504862f},
-std::array<float,2>{0.784566939f, 0.546138346f},
-std::array<float,2>{0.445552826f, 0.801160157f},
-std::array<float,2>{0.545806587f, 0.0236822125f},
-std::array<float,2>{0.346336752f, 0.182192117f},
-std::array<float,2>{0.65165323f, 0.919523954f},
-std::array<float,2>{0.249323815f, 0.744807184f},
-std::array<float,2>{0.882608771f, 0.479843318f},
-std::array<float,2>{0.258720428f, 0.33636567f},
-std::array<float,2>{0.701959908f, 0.618756354f},
-std::array<float,2>{0.179167986f, 0.858057261f},
-std::array<float,2>{0.977364779f, 0.0810511559f},
-std::array<float,2>{0.111571126f, 0.208154157f},
-std::array<float,2>{0.843331993f, 0.980251253f},
-std::array<float,2>{0.426593661f, 0.625254571f},
-std::array<float,2>{0.576329887f, 0.42497766f},
-std::array<float,2>{0.204329967f, 0.464287817f},
-std::array<float,2>{0.912806571f, 0.715648949f},
-std::array<float,2>{0.327590346f, 0.882903576f},
-std::array<float,2>{0.664536178f, 0.146702617f},
-std::array<float,2>{0.48081404f, 0.0429130308f},
-std::array<float,2>{0.511024296f, 0.756958961f},
-std::array<float,2>{0.0236682445f, 0.514618933f},
-std::array<float,2>{0.773567915f, 0.304772735f},
-std::array<float,2>{0.46677506f, 0.293771535f},
-std::array<float,2>{0.55023706f, 0.526342332f},
-std::array<float,2>{0.054370068f, 0.769234598f},
-std::array<float,2>{0.807506979f, 0.0474458635f},
-std::array<float,2>{0.22164169f, 0.129693106f},
-std::array<float,2>{0.905238211f, 0.89662677f},
-std::array<float,2>{0.364423394f, 0.689564645f},
-std::array<float,2>{0.639566302f, 0.437752545f},
-std::array<float,2>{0.0698995143f, 0.4210006f},
-std::array<float,2>{0.852193296f, 0.645450413f},
-std::array<float,2>{0.401492178f, 0.989920199f},
-std::array<float,2>{0.617589355f, 0.199557036f},
-std::array<float,2>{0.31134966f, 0.0689328834f},
-std::array<float,2>{0.733829856f, 0.872062147f},
-std::array<float,2>{0.132470459f, 0.597581983f},
-std::array<float,2>{0.967464805f, 0.321490288f},
-std::array<float,2>{0.329744279f, 0.494264901f},
-std::array<float,2>{0.674401939f, 0.726816475f},
-std::array<float,2>{0.197652623f, 0.931508124f},
-std::array<float,2>{0.935034096f, 0.156851515f},
-std::array<float,2>{0.00661866227f, 0.00619854825f},
-std::array<float,2>{0.754927933f, 0.790996194f},
-std::array<float,2>{0.492638409f, 0.552990198f},
-std::array<float,2>{0.529838741f, 0.265461922f},
-std::array<float,2>{0.160628349f, 0.362017721f},
-std::array<float,2>{0.988251209f, 0.592696607f},
-std::array<float,2>{0.273150653f, 0.839649618f},
-std::array<float,2>{0.714592934f, 0.110584535f},
-std::array<float,2>{0.409523487f, 0.231616497f},
-std::array<float,2>{0.58902669f, 0.94303745f},
-std::array<float,2>{0.106859609f, 0.668615341f},
-std::array<float,2>{0.82562387f, 0.386919409f},
-std::array<float,2>{0.491728008f, 0.450496465f},
-std::array<float,2>{0.523370326f, 0.697236538f},
-std::array<float,2>{0.00997958891f, 0.904026747f},
-std::array<float,2>{0.760038078f, 0.138386816f},
-std::array<float,2>{0.194001779f, 0.0582501739f},
-std::array<float,2>{0.926680982f, 0.776786804f},
-std::array<float,2>{0.336910576f, 0.521266401f},
-std::array<float,2>{0.683414102f, 0.282317817f},
-std::array<float,2>{0.0965571627f, 0.319512755f},
-std::array<float,2>{0.815518975f, 0.604727089f},
-std::array<float,2>{0.421175152f, 0.865692973f},
-std::array<float,2>{0.581705749f, 0.072353974f},
-std::array<float,2>{0.278969646f, 0.189781129f},
-std::array<float,2>{0.704964042f, 0.993317604f},
-std::array<float,2>{0.165910199f, 0.651356161f},
-std::array<float,2>{0.993979335f, 0.406518489f},
-std::array<float,2>{0.367358267f, 0.253121585f},
-std::array<float,2>{0.631970882f, 0.561254084f},
-std::array<float,2>{0.22779946f, 0.788373053f},
-std::array<float,2>{0.895362794f, 0.0130660068f},
-std::array<float,2>{0.0574666746f, 0.169686794f},
-std::array<float,2>{0.799557686f, 0.922632217f},
-std::array<float,2>{0.456289619f, 0.725999117f},
-std::array<float,2>{0.562338412f, 0.485131353f},
-std::array<float,2>{0.14019461f, 0.379422754f},
-std::array<float,2>{0.954570293f, 0.656906962f},
-std::array<float,2>{0.30080983f, 0.947152853f},
-std::array<float,2>{0.725249648f, 0.220467091f},
-std::array<float,2>{0.396725833f, 0.123631388f},
-std::array<float,2>{0.616555154f, 0.829712451f},
-std::array<float,2>{0.0762691721f, 0.580365658f},
-std::array<float,2>{0.850532949f, 0.36842218f},
-std::array<float,2>{0.434885025f, 0.34924376f},
-std::array<float,2>{0.564626098f, 0.565633237f},
-std::array<float,2>{0.122012578f, 0.827230394f},
-std::array<float,2>{0.829664052f, 0.0978328958f},
-std::array<float,2>{0.18000409f, 0.247005954f},
-std::array<float,2>{0.974730551f, 0.954115331f},
-std::array<float,2>{0.25405553f, 0.678629756f},
-std::array<float,2>{0.692784131f, 0.394791067f},
-std::array<float,2>{0.0227408353f, 0.471201539f},
-std::array<float,2>{0.766876221f, 0.738632202f},
-std::array<float,2>{0.474166334f, 0.907013237f},
-std::array<float,2>{0.506842852f, 0.175762311f},
-std::array<float,2>{0.31335032f, 0.0229288451f},
-std::array<float,2>{0.664014578f, 0.809052706f},
-std::array<float,2>{0.218031153f, 0.535494864f},
-std::array<float,2>{0.920642495f, 0.276099861f},
-std::array<float,2>{0.282990307f, 0.432521671f},
-std::array<float,2>{0.741897225f, 0.636366665f},
-std::array<float,2>{0.149844766f, 0.975216389f},
-std::array<float,2>{0.951400101f, 0.21778968f},
-std::array<float,2>{0.0884526819f, 0.0886105746f},
-std::array<float,2>{0.864796281f, 0.846739173f},
-std::array<float,2>{0.385735542f, 0.611817062f},
-std::array<float,2>{0.597509623f, 0.329400718f},
-std::array<float,2>{0.241550818f, 0.300090432f},
-std::array<float,2>{0.885579824f, 0.507060349f},
-std::array<float,2>{0.356542706f, 0.763963342f},
-std::array<float,2>{0.644335091f, 0.0345475376f},
-std::array<float,2>{0.443600655f, 0.149756312f},
-std::array<float,2>{0.537268519f, 0.879837215f},
-std::array<float,2>{0.0459017456f, 0.703583419f},
-std::array<float,2>{0.794355273f, 0.457396567f},
-std::array<float,2>{0.415605456f, 0.483450413f},
-std::array<float,2>{0.584998429f, 0.746133089f},
-std::array<float,2>{0.100084797f, 0.916461349f},
-std::array<float,2>{0.819295764f, 0.185756102f},
-std::array<float,2>{0.169371262f, 0.0302636139f},
-std::array<float,2>{0.997268975f, 0.800643206f},
-std::array<float,2>{0.275365442f, 0.540858209f},
-std::array<float,2>{0.709360421f, 0.265677065f},
-std::array<float,2>{0.0141703952f, 0.355471075f},
-std::array<float,2>{0.763291538f, 0.570402026f},
-std::array<float,2>{0.485775888f, 0.814447403f},
-std::array<float,2>{0.516752005f, 0.105112724f},
-std::array<float,2>{0.340439558f, 0.241347581f},
-std::array<float,2>{0.684864521f, 0.961975753f},
-std::array<float,2>{0.187783957f, 0.684365273f},
-std::array<float,2>{0.924947679f, 0.401601225f},
-std::array<float,2>{0.298066914f, 0.312087446f},
-std::array<float,2>{0.718797505f, 0.508741558f},
-std::array<float,2>{0.133532554f, 0.753486633f},
-std::array<float,2>{0.960634112f, 0.0450910479f},
-std::array<float,2>{0.0704496205f, 0.140645087f},
-std::array<float,2>{0.846544743f, 0.887911379f},
-std::array<float,2>{0.391182035f, 0.712863386f},
-std::array<float,2>{0.612417102f, 0.46519044f},
-std::array<float,2>{0.230925113f, 0.426631391f},
-std::array<float,2>{0.8912763f, 0.631559491f},
-std::array<float,2>{0.371990442f, 0.980802953f},
-std::array<float,2>{0.626699507f, 0.206516892f},
-std::array<float,2>{0.458425432f, 0.0830283538f},
-std::array<float,2>{0.554858267f, 0.852698565f},
-std::array<float,2>{0.0624091737f, 0.624297738f},
-std::array<float,2>{0.802798212f, 0.340726376f},
-std::array<float,2>{0.472400814f, 0.325246602f},
-std::array<float,2>{0.503293812f, 0.598068476f},
-std::array<float,2>{0.0164386053f, 0.870767355f},
-std::array<float,2>{0.769605458f, 0.0641317442f},
-std::array<float,2>{0.212085947f, 0.197014421f},
-std::array<float,2>{0.915525734f, 0.985021651f},
-std::array<float,2>{0.319412798f, 0.641922176f},
-std::array<float,2>{0.659643888f, 0.414084643f},
-std::array<float,2>{0.118034422f, 0.441595405f},
-std::array<float,2>{0.833403051f, 0.694600284f},
-std::array<float,2>{0.432029694f, 0.894358933f},
-std::array<float,2>{0.568820655f, 0.126134604f},
-std::array<float,2>{0.253640324f, 0.0537515841f},
-std::array<float,2>{0.689100385f, 0.773293018f},
-std::array<float,2>{0.186594188f, 0.529231668f},
-std::array<float,2>{0.972240329f, 0.289223194f},
-std::array<float,2>{0.352577269f, 0.385294139f},
-std::array<float,2>{0.648435473f, 0.664552391f},
-std::array<float,2>{0.236464307f, 0.94035542f},
-std::array<float,2>{0.888121903f, 0.226834461f},
-std::array<float,2>{0.0397085026f, 0.117018163f},
-std::array<float,2>{0.792291522f, 0.84264493f},
-std::array<float,2>{0.440067232f, 0.587373316f},
-std::array<float,2>{0.531947136f, 0.365523487f},
-std::array<float,2>{0.154428035f, 0.258506864f},
-std::array<float,2>{0.948368013f, 0.550549567f},
-std::array<float,2>{0.287521601f, 0.796677172f},
-std::array<float,2>{0.736077666f, 0.00172031682f},
-std::array<float,2>{0.389521122f, 0.16333589f},
-std::array<float,2>{0.597757041f, 0.934143662f},
-std::array<float,2>{0.0923517123f, 0.733695686f},
-std::array<float,2>{0.86272943f, 0.497131139f},
-std::array<float,2>{0.452128917f, 0.412807137f},
-std::array<float,2>{0.54288286f, 0.654385686f},
-std::array<float,2>{0.0382074155f, 0.99867171f},
-std::array<float,2>{0.789020002f, 0.192771554f},
-std::array<float,2>{0.244377404f, 0.0769612119f},
-std::array<float,2>{0.875778735f, 0.862264991f},
-std::array<float,2>{0.350613087f, 0.605917931f},
-std::array<float,2>{0.6524297f, 0.31494683f},
-std::array<float,2>{0.084583275f, 0.287882477f},
-std::array<float,2>{0.869638085f, 0.518701732f},
-std::array<float,2>{0.376481861f, 0.77827245f},
-std::array<float,2>{0.603304267f, 0.0601834431f},
-std::array<float,2>{0.289480031f, 0.136689886f},
-std::array<float,2>{0.743062079f, 0.898568451f},
-std::array<float,2>{0.141418338f, 0.700143516f},
-std::array<float,2>{0.939562261f, 0.448267847f},
-std::array<float,2>{0.320639521f, 0.37323454f},
-std::array<float,2>{0.670264065f, 0.584451497f},
-std::array<float,2>{0.20982407f, 0.833225012f},
-std::array<float,2>{0.906252563f, 0.118828185f},
-std::array<float,2>{0.0287747774f, 0.224448532f},
-std::array<float,2>{0.778438687f, 0.949950516f},
-std::array<float,2>{0.477399111f, 0.662574172f},
-std::array<float,2>{0.512371421f, 0.376883179f},
-std::array<float,2>{0.173583329f, 0.489689976f},
-std::array<float,2>{0.980511367f, 0.722320676f},
-std::array<float,2>{0.264269829f, 0.928210974f},
-std::array<float,2>{0.695394278f, 0.165443942f},
-std::array<float,2>{0.422610193f, 0.00978067424f},
-std::array<float,2>{0.571436763f, 0.783024609f},
-std::array<float,2>{0.116864629f, 0.55729425f},
-std::array<float,2>{0.836681366f, 0.254153609f},
-std::array<float,2>{0.403597325f, 0.278278381f},
-std::array<float,2>{0.623730659f, 0.534488201f},
-std::array<float,2>{0.0663088039f, 0.80778414f},
-std::array<float,2>{0.857039094f, 0.0190948844f},
-std::array<float,2>{0.126967922f, 0.178309351f},
-std::array<float,2>{0.961778045f, 0.911614239f},
-std::array<float,2>{0.306828618f, 0.737653852f},
-std::array<float,2>{0.729378343f, 0.476048172f},
-std::array<float,2>{0.0484787896f, 0.394473046f},
-std::array<float,2>{0.812189937f, 0.673324227f},
-std::array<float,2>{0.461042702f, 0.960371315f},
-std::array<float,2>{0.552987516f, 0.243123934f},
-std::array<float,2>{0.362476677f, 0.0939026847f},
-std::array<float,2>{0.635903239f, 0.82232666f},
-std::array<float,2>{0.224983081f, 0.567959666f},
-std::array<float,2>{0.902284622f, 0.346704841f},
-std::array<float,2>{0.266736537f, 0.456837952f},
-std::array<float,2>{0.717439532f, 0.709148645f},
-std::array<float,2>{0.157880917f, 0.877066731f},
-std::array<float,2>{0.991361618f, 0.15304409f},
-std::array<float,2>{0.102875158f, 0.0366237089f},
-std::array<float,2>{0.823082268f, 0.759567499f},
-std::array<float,2>{0.413161606f, 0.500085592f},
-std::array<float,2>{0.592104673f, 0.304200947f},
-std::array<float,2>{0.202259988f, 0.335710585f},
-std::array<float,2>{0.932004929f, 0.616316438f},
-std::array<float,2>{0.332949251f, 0.84948194f},
-std::array<float,2>{0.678323328f, 0.0911474228f},
-std::array<float,2>{0.498639494f, 0.211572453f},
-std::array<float,2>{0.523621619f, 0.969021976f},
-std::array<float,2>{0.00092206226f, 0.636827648f},
-std::array<float,2>{0.752431095f, 0.437440634f},
-std::array<float,2>{0.40130049f, 0.418207824f},
-std::array<float,2>{0.618281543f, 0.646983981f},
-std::array<float,2>{0.0689390004f, 0.990867078f},
-std::array<float,2>{0.852595806f, 0.201727957f},
-std::array<float,2>{0.131743476f, 0.0680481493f},
-std::array<float,2>{0.968010068f, 0.873099506f},
-std::array<float,2>{0.312454641f, 0.593926847f},
-std::array<float,2>{0.733121634f, 0.323647887f},
-std::array<float,2>{0.053111434f, 0.296421707f},
-std::array<float,2>{0.808318675f, 0.524113536f},
-std::array<float,2>{0.465318233f, 0.766317844f},
-std::array<float,2>{0.549244881f, 0.0488747768f},
-std::array<float,2>{0.364015281f, 0.131774053f},
-std::array<float,2>{0.639797688f, 0.89556253f},
-std::array<float,2>{0.221727967f, 0.688707709f},
-std::array<float,2>{0.906245232f, 0.441317171f},
-std::array<float,2>{0.272036374f, 0.359585106f},
-std::array<float,2>{0.713430226f, 0.589923024f},
-std::array<float,2>{0.16142723f, 0.836216271f},
-std::array<float,2>{0.987093031f, 0.113078438f},
-std::array<float,2>{0.106071293f, 0.233308807f},
-std::array<float,2>{0.824424803f, 0.94423753f},
-std::array<float,2>{0.408706158f, 0.670302987f},
-std::array<float,2>{0.588562191f, 0.389551342f},
-std::array<float,2>{0.198637962f, 0.492645413f},
-std::array<float,2>{0.934550643f, 0.729865074f},
-std::array<float,2>{0.328185499f, 0.933146834f},
-std::array<float,2>{0.675510764f, 0.160091966f},
-std::array<float,2>{0.493395269f, 0.00425377581f},
-std::array<float,2>{0.530386508f, 0.792053461f},
-std::array<float,2>{0.00774892466f, 0.55118531f},
-std::array<float,2>{0.75392741f, 0.262403995f},
-std::array<float,2>{0.446738869f, 0.272813231f},
-std::array<float,2>{0.546598077f, 0.543993354f},
-std::array<float,2>{0.0348384343f, 0.804654181f},
-std::array<float,2>{0.783343613f, 0.0268605556f},
-std::array<float,2>{0.248345733f, 0.181351781f},
-std::array<float,2>{0.881691277f, 0.920472741f},
-std::array<float,2>{0.347233087f, 0.742467761f},
-std::array<float,2>{0.651221216f, 0.478129685f},
-std::array<float,2>{0.0808207765f, 0.402870029f},
-std::array<float,2>{0.872508526f, 0.68341738f},
-std::array<float,2>{0.382635504f, 0.967007458f},
-std::array<float,2>{0.606820345f, 0.237197548f},
-std::array<float,2>{0.296446562f, 0.105792217f},
-std::array<float,2>{0.749210298f, 0.819884837f},
-std::array<float,2>{0.144641533f, 0.576577604f},
-std::array<float,2>{0.943152308f, 0.355452478f},
-std::array<float,2>{0.326998413f, 0.461581141f},
-std::array<float,2>{0.665247023f, 0.717906594f},
-std::array<float,2>{0.203964412f, 0.884939492f},
-std::array<float,2>{0.913150966f, 0.145198345f},
-std::array<float,2>{0.0247275531f, 0.0398246385f},
-std::array<float,2>{0.77494359f, 0.754334986f},
-std::array<float,2>{0.482283622f, 0.512161016f},
-std::array<float,2>{0.509829521f, 0.307638139f},
-std::array<float,2>{0.177773371f, 0.338242143f},
-std::array<float,2>{0.977672756f, 0.619406998f},
-std::array<float,2>{0.259121835f, 0.855915904f},
-std::array<float,2>{0.702813506f, 0.0795591325f},
-std::array<float,2>{0.427313209f, 0.209683433f},
-std::array<float,2>{0.577255666f, 0.976680517f},
-std::array<float,2>{0.113163248f, 0.626984894f},
-std::array<float,2>{0.842531502f, 0.422629744f},
-std::array<float,2>{0.473245561f, 0.469404012f},
-std::array<float,2>{0.506759226f, 0.74123764f},
-std::array<float,2>{0.021914022f, 0.909475207f},
-std::array<float,2>{0.766179264f, 0.17203933f},
-std::array<float,2>{0.216874063f, 0.0206853021f},
-std::array<float,2>{0.921517491f, 0.812157691f},
-std::array<float,2>{0.314153671f, 0.538648546f},
-std::array<float,2>{0.663066804f, 0.274397016f},
-std::array<float,2>{0.12279515f, 0.350046962f},
-std::array<float,2>{0.828968048f, 0.562856138f},
-std::array<float,2>{0.433666587f, 0.824553728f},
-std::array<float,2>{0.565550566f, 0.0999256894f},
-std::array<float,2>{0.255001783f, 0.248590842f},
-std::array<float,2>{0.691428006f, 0.956968665f},
-std::array<float,2>{0.180967465f, 0.676283062f},
-std::array<float,2>{0.976469934f, 0.396539122f},
-std::array<float,2>{0.355489343f, 0.296886563f},
-std::array<float,2>{0.64321655f, 0.504330873f},
-std::array<float,2>{0.241016224f, 0.762705743f},
-std::array<float,2>{0.886049747f, 0.0325096287f},
-std::array<float,2>{0.0457945578f, 0.151922822f},
-std::array<float,2>{0.793808162f, 0.881144524f},
-std::array<float,2>{0.445183069f, 0.70653975f},
-std::array<float,2>{0.538757026f, 0.459351689f},
-std::array<float,2>{0.148941725f, 0.430295557f},
-std::array<float,2>{0.953056574f, 0.634467006f},
-std::array<float,2>{0.281364024f, 0.972983301f},
-std::array<float,2>{0.740654528f, 0.216099247f},
-std::array<float,2>{0.386709034f, 0.0875849649f},
-std::array<float,2>{0.59644717f, 0.84378314f},
-std::array<float,2>{0.0894321203f, 0.611002803f},
-std::array<float,2>{0.86408639f, 0.330874503f},
-std::array<float,2>{0.419978917f, 0.316622198f},
-std::array<float,2>{0.580973804f, 0.602873027f},
-std::array<float,2>{0.0972666815f, 0.86478889f},
-std::array<float,2>{0.815206468f, 0.0715344176f},
-std::array<float,2>{0.164072603f, 0.18833144f},
-std::array<float,2>{0.99251914f, 0.994814277f},
-std::array<float,2>{0.277439415f, 0.649330735f},
-std::array<float,2>{0.70363313f, 0.408213019f},
-std::array<float,2>{0.0109238299f, 0.452161163f},
-std::array<float,2>{0.76099664f, 0.69811815f},
-std::array<float,2>{0.490744323f, 0.905756652f},
-std::array<float,2>{0.522169232f, 0.138962507f},
-std::array<float,2>{0.337589025f, 0.0553500615f},
-std::array<float,2>{0.682510674f, 0.774012804f},
-std::array<float,2>{0.194688618f, 0.522242963f},
-std::array<float,2>{0.927348375f, 0.283615023f},
-std::array<float,2>{0.302489042f, 0.381111532f},
-std::array<float,2>{0.726429999f, 0.658428252f},
-std::array<float,2>{0.139086381f, 0.947906673f},
-std::array<float,2>{0.953205824f, 0.221776515f},
-std::array<float,2>{0.0776660144f, 0.122494429f},
-std::array<float,2>{0.850673914f, 0.830879271f},
-std::array<float,2>{0.398434371f, 0.57882905f},
-std::array<float,2>{0.616087079f, 0.369397879f},
-std::array<float,2>{0.227102891f, 0.250714332f},
-std::array<float,2>{0.895697832f, 0.56048286f},
-std::array<float,2>{0.369135648f, 0.786070824f},
-std::array<float,2>{0.631159425f, 0.0144066364f},
-std::array<float,2>{0.45562017f, 0.171398163f},
-std::array<float,2>{0.561268866f, 0.925150692f},
-std::array<float,2>{0.057784576f, 0.72432524f},
-std::array<float,2>{0.800704122f, 0.487419665f},
-std::array<float,2>{0.433350772f, 0.44522047f},
-std::array<float,2>{0.569384754f, 0.692938983f},
-std::array<float,2>{0.118895933f, 0.890800416f},
-std::array<float,2>{0.832115471f, 0.127275571f},
-std::array<float,2>{0.186296761f, 0.0516992584f},
-std::array<float,2>{0.971512198f, 0.770447493f},
-std::array<float,2>{0.252209872f, 0.52983433f},
-std::array<float,2>{0.687812209f, 0.291574389f},
-std::array<float,2>{0.017569514f, 0.326408535f},
-std::array<float,2>{0.770740986f, 0.599622488f},
-std::array<float,2>{0.470964938f, 0.868984401f},
-std::array<float,2>{0.502379775f, 0.064991571f},
-std::array<float,2>{0.319315374f, 0.198915467f},
-std::array<float,2>{0.658436775f, 0.988000512f},
-std::array<float,2>{0.211744145f, 0.643666863f},
-std::array<float,2>{0.914701283f, 0.416663826f},
-std::array<float,2>{0.288484693f, 0.260487556f},
-std::array<float,2>{0.734416723f, 0.547547221f},
-std::array<float,2>{0.155711204f, 0.793419003f},
-std::array<float,2>{0.948076487f, 0.00367172621f},
-std::array<float,2>{0.0927788168f, 0.160206199f},
-std::array<float,2>{0.86188066f, 0.937223852f},
-std::array<float,2>{0.390214413f, 0.730547011f},
-std::array<float,2>{0.598924994f, 0.498830944f},
-std::array<float,2>{0.237665862f, 0.384488255f},
-std::array<float,2>{0.887531698f, 0.666024983f},
-std::array<float,2>{0.352313638f, 0.938284397f},
-std::array<float,2>{0.646786273f, 0.230434224f},
-std::array<float,2>{0.440834254f, 0.114135958f},
-std::array<float,2>{0.532821834f, 0.841543496f},
-std::array<float,2>{0.0409819223f, 0.588708341f},
-std::array<float,2>{0.791305661f, 0.363861918f},
-std::array<float,2>{0.484501392f, 0.358538359f},
-std::array<float,2>{0.515667677f, 0.573292375f},
-std::array<float,2>{0.0151914489f, 0.815011621f},
-std::array<float,2>{0.762313724f, 0.102090508f},
-std::array<float,2>{0.188678876f, 0.238544226f},
-std::array<float,2>{0.924034297f, 0.962934613f},
-std::array<float,2>{0.341005623f, 0.687094152f},
-std::array<float,2>{0.684387326f, 0.398828149f},
-std::array<float,2>{0.100806497f, 0.480723321f},
-std::array<float,2>{0.819833457f, 0.748241842f},
-std::array<float,2>{0.414572626f, 0.914208651f},
-std::array<float,2>{0.584695697f, 0.185496166f},
-std::array<float,2>{0.274293333f, 0.0277427007f},
-std::array<float,2>{0.710882783f, 0.798192561f},
-std::array<float,2>{0.168412611f, 0.54107517f},
-std::array<float,2>{0.996678233f, 0.268620849f},
-std::array<float,2>{0.372320533f, 0.427857637f},
-std::array<float,2>{0.625064313f, 0.630346179f},
-std::array<float,2>{0.231505826f, 0.983554959f},
-std::array<float,2>{0.891786933f, 0.204560533f},
-std::array<float,2>{0.0610141791f, 0.0849057212f},
-std::array<float,2>{0.804539084f, 0.854838729f},
-std::array<float,2>{0.45750466f, 0.622564256f},
-std::array<float,2>{0.556071401f, 0.34243536f},
-std::array<float,2>{0.134457454f, 0.308665156f},
-std::array<float,2>{0.959219754f, 0.509812772f},
-std::array<float,2>{0.297252893f, 0.751159549f},
-std::array<float,2>{0.720673144f, 0.0432516411f},
-std::array<float,2>{0.392415255f, 0.142972246f},
-std::array<float,2>{0.611960649f, 0.888924122f},
-std::array<float,2>{0.072159417f, 0.714512706f},
-std::array<float,2>{0.847226083f, 0.466846645f},
-std::array<float,2>{0.462835699f, 0.391126037f},
-std::array<float,2>{0.554232001f, 0.675073147f},
-std::array<float,2>{0.0473055989f, 0.95730859f},
-std::array<float,2>{0.810659945f, 0.246019259f},
-std::array<float,2>{0.225660354f, 0.0963967517f},
-std::array<float,2>{0.901201904f, 0.821658432f},
-std::array<float,2>{0.36188522f, 0.568506658f},
-std::array<float,2>{0.635142684f, 0.345507175f},
-std::array<float,2>{0.0651137009f, 0.281017154f},
-std::array<float,2>{0.855718136f, 0.533112645f},
-std::array<float,2>{0.402818531f, 0.804824531f},
-std::array<float,2>{0.624927461f, 0.0174964443f},
-std::array<float,2>{0.308214635f, 0.175903454f},
-std::array<float,2>{0.730321825f, 0.913621008f},
-std::array<float,2>{0.128306955f, 0.735716701f},
-std::array<float,2>{0.962337673f, 0.472676218f},
-std::array<float,2>{0.333519399f, 0.332651973f},
-std::array<float,2>{0.678824246f, 0.613914669f},
-std::array<float,2>{0.201572001f, 0.849874973f},
-std::array<float,2>{0.93341893f, 0.0929809734f},
-std::array<float,2>{0.00126850733f, 0.213629052f},
-std::array<float,2>{0.753579676f, 0.971746206f},
-std::array<float,2>{0.499835074f, 0.639308751f},
-std::array<float,2>{0.524783671f, 0.435425848f},
-std::array<float,2>{0.157188118f, 0.453335434f},
-std::array<float,2>{0.991185844f, 0.707259238f},
-std::array<float,2>{0.265696347f, 0.875443041f},
-std::array<float,2>{0.718231678f, 0.154726267f},
-std::array<float,2>{0.412997127f, 0.0384129584f},
-std::array<float,2>{0.593659103f, 0.760292292f},
-std::array<float,2>{0.102136552f, 0.50239259f},
-std::array<float,2>{0.823743105f, 0.300983161f},
-std::array<float,2>{0.375562042f, 0.286527604f},
-std::array<float,2>{0.601705432f, 0.51718092f},
-std::array<float,2>{0.0856464654f, 0.78081286f},
-std::array<float,2>{0.870449781f, 0.0608055964f},
-std::array<float,2>{0.141922712f, 0.133206487f},
-std::array<float,2>{0.940585136f, 0.901135147f},
-std::array<float,2>{0.290917724f, 0.702959776f},
-std::array<float,2>{0.743261516f, 0.445958823f},
-std::array<float,2>{0.0372357592f, 0.411502481f},
-std::array<float,2>{0.787818074f, 0.653485298f},
-std::array<float,2>{0.453051597f, 0.996974766f},
-std::array<float,2>{0.541652501f, 0.195077404f},
-std::array<float,2>{0.349998206f, 0.0745852739f},
-std::array<float,2>{0.653338134f, 0.861243069f},
-std::array<float,2>{0.245588362f, 0.608248651f},
-std::array<float,2>{0.876624823f, 0.313760072f},
-std::array<float,2>{0.264714509f, 0.491029948f},
-std::array<float,2>{0.696621001f, 0.719323695f},
-std::array<float,2>{0.172036305f, 0.926775753f},
-std::array<float,2>{0.982274413f, 0.167865351f},
-std::array<float,2>{0.115757219f, 0.00877940655f},
-std::array<float,2>{0.837714612f, 0.783993781f},
-std::array<float,2>{0.423448324f, 0.556568027f},
-std::array<float,2>{0.571261287f, 0.256833285f},
-std::array<float,2>{0.210034594f, 0.372054309f},
-std::array<float,2>{0.908135355f, 0.582570374f},
-std::array<float,2>{0.32219857f, 0.834224701f},
-std::array<float,2>{0.671089172f, 0.120228335f},
-std::array<float,2>{0.478273928f, 0.225138813f},
-std::array<float,2>{0.512859106f, 0.952000737f},
-std::array<float,2>{0.0275722407f, 0.661682606f},
-std::array<float,2>{0.777717769f, 0.378822535f},
-std::array<float,2>{0.406924695f, 0.3886379f},
-std::array<float,2>{0.5876773f, 0.669454217f},
-std::array<float,2>{0.108064495f, 0.942000926f},
-std::array<float,2>{0.827009916f, 0.230921552f},
-std::array<float,2>{0.163814992f, 0.110252671f},
-std::array<float,2>{0.984472513f, 0.838136435f},
-std::array<float,2>{0.270769209f, 0.592977107f},
-std::array<float,2>{0.711895823f, 0.362974852f},
-std::array<float,2>{0.00575218163f, 0.26409772f},
-std::array<float,2>{0.75728482f, 0.554175138f},
-std::array<float,2>{0.494794667f, 0.789504945f},
-std::array<float,2>{0.529031992f, 0.00713658752f},
-std::array<float,2>{0.331956059f, 0.157901809f},
-std::array<float,2>{0.673282981f, 0.929805517f},
-std::array<float,2>{0.196370021f, 0.727934837f},
-std::array<float,2>{0.937422097f, 0.495946646f},
-std::array<float,2>{0.310399801f, 0.32102865f},
-std::array<float,2>{0.731433392f, 0.596461356f},
-std::array<float,2>{0.129437447f, 0.872651875f},
-std::array<float,2>{0.96584022f, 0.0701275617f},
-std::array<float,2>{0.0676487386f, 0.200311318f},
-std::array<float,2>{0.854519963f, 0.988617361f},
-std::array<float,2>{0.398855865f, 0.645626545f},
-std::array<float,2>{0.62068373f, 0.420761734f},
-std::array<float,2>{0.219747648f, 0.438550234f},
-std::array<float,2>{0.90394485f, 0.690782547f},
-std::array<float,2>{0.366133004f, 0.898335338f},
-std::array<float,2>{0.638557494f, 0.130226269f},
-std::array<float,2>{0.467865616f, 0.0481523089f},
-std::array<float,2>{0.548609018f, 0.767861605f},
-std::array<float,2>{0.0526271574f, 0.526483595f},
-std::array<float,2>{0.805139482f, 0.294014126f},
-std::array<float,2>{0.483931571f, 0.306025267f},
-std::array<float,2>{0.508434057f, 0.515291512f},
-std::array<float,2>{0.0264973156f, 0.756529152f},
-std::array<float,2>{0.776373744f, 0.0417154282f},
-std::array<float,2>{0.206376791f, 0.147543937f},
-std::array<float,2>{0.912066877f, 0.88419205f},
-std::array<float,2>{0.325532824f, 0.716369629f},
-std::array<float,2>{0.667097509f, 0.463418633f},
-std::array<float,2>{0.111258298f, 0.423844963f},
-std::array<float,2>{0.840880632f, 0.626104236f},
-std::array<float,2>{0.429511577f, 0.979211092f},
-std::array<float,2>{0.574621797f, 0.207912415f},
-std::array<float,2>{0.260668993f, 0.0814602673f},
-std::array<float,2>{0.699854732f, 0.858800948f},
-std::array<float,2>{0.177612349f, 0.617822945f},
-std::array<float,2>{0.980372012f, 0.337373734f},
-std::array<float,2>{0.344029158f, 0.478933662f},
-std::array<float,2>{0.650342643f, 0.745951772f},
-std::array<float,2>{0.247863367f, 0.918889999f},
-std::array<float,2>{0.879971504f, 0.183391094f},
-std::array<float,2>{0.0319773704f, 0.0247376151f},
-std::array<float,2>{0.781297803f, 0.801984608f},
-std::array<float,2>{0.447398514f, 0.545461297f},
-std::array<float,2>{0.544801593f, 0.271357f},
-std::array<float,2>{0.146973059f, 0.353300989f},
-std::array<float,2>{0.943666816f, 0.574295104f},
-std::array<float,2>{0.293802649f, 0.817656815f},
-std::array<float,2>{0.746605515f, 0.107792616f},
-std::array<float,2>{0.380524695f, 0.235493347f},
-std::array<float,2>{0.608453751f, 0.965033114f},
-std::array<float,2>{0.0796812475f, 0.680505991f},
-std::array<float,2>{0.874748826f, 0.405041337f},
-std::array<float,2>{0.441578895f, 0.458880514f},
-std::array<float,2>{0.535553992f, 0.704932034f},
-std::array<float,2>{0.0431858785f, 0.880103171f},
-std::array<float,2>{0.796233833f, 0.148786053f},
-std::array<float,2>{0.238726005f, 0.0336443372f},
-std::array<float,2>{0.883538902f, 0.76475364f},
-std::array<float,2>{0.358009845f, 0.505967915f},
-std::array<float,2>{0.642450213f, 0.299562901f},
-std::array<float,2>{0.0874045417f, 0.328722954f},
-std::array<float,2>{0.866605639f, 0.612456918f},
-std::array<float,2>{0.384224415f, 0.845764816f},
-std::array<float,2>{0.595042765f, 0.0890191719f},
-std::array<float,2>{0.28376022f, 0.217110217f},
-std::array<float,2>{0.740172863f, 0.975810647f},
-std::array<float,2>{0.150901526f, 0.635190547f},
-std::array<float,2>{0.949536562f, 0.432703048f},
-std::array<float,2>{0.314750969f, 0.277026802f},
-std::array<float,2>{0.661657929f, 0.536472023f},
-std::array<float,2>{0.216720685f, 0.809838414f},
-std::array<float,2>{0.919629037f, 0.0216695797f},
-std::array<float,2>{0.0203420836f, 0.174634129f},
-std::array<float,2>{0.768894672f, 0.907349825f},
-std::array<float,2>{0.476536155f, 0.739792705f},
-std::array<float,2>{0.505298913f, 0.472201884f},
-std::array<float,2>{0.18345435f, 0.396253407f},
-std::array<float,2>{0.974009097f, 0.679403067f},
-std::array<float,2>{0.256780773f, 0.953875542f},
-std::array<float,2>{0.694173038f, 0.247211054f},
-std::array<float,2>{0.436029553f, 0.0990146175f},
-std::array<float,2>{0.562714636f, 0.826919615f},
-std::array<float,2>{0.123247758f, 0.565250635f},
-std::array<float,2>{0.831026495f, 0.3483105f},
-std::array<float,2>{0.396359086f, 0.367748946f},
-std::array<float,2>{0.613303602f, 0.581969619f},
-std::array<float,2>{0.0755996928f, 0.828550816f},
-std::array<float,2>{0.848197401f, 0.124128684f},
-std::array<float,2>{0.13787891f, 0.219052598f},
-std::array<float,2>{0.955276966f, 0.946208775f},
-std::array<float,2>{0.304618597f, 0.657799184f},
-std::array<float,2>{0.72281301f, 0.379970461f},
-std::array<float,2>{0.0553714447f, 0.485640287f},
-std::array<float,2>{0.797228098f, 0.725509763f},
-std::array<float,2>{0.454847842f, 0.923247397f},
-std::array<float,2>{0.559552431f, 0.16855444f},
-std::array<float,2>{0.370999128f, 0.0117220618f},
-std::array<float,2>{0.629766464f, 0.787944853f},
-std::array<float,2>{0.230414823f, 0.562164247f},
-std::array<float,2>{0.897565424f, 0.252124041f},
-std::array<float,2>{0.280346394f, 0.40763405f},
-std::array<float,2>{0.707028747f, 0.651409566f},
-std::array<float,2>{0.167782739f, 0.992200732f},
-std::array<float,2>{0.995172262f, 0.190516457f},
-std::array<float,2>{0.0956786051f, 0.0739761516f},
-std::array<float,2>{0.813594341f, 0.866884232f},
-std::array<float,2>{0.418894768f, 0.603748441f},
-std::array<float,2>{0.579799533f, 0.318822145f},
-std::array<float,2>{0.19262059f, 0.281716108f},
-std::array<float,2>{0.928835571f, 0.520025849f},
-std::array<float,2>{0.339520514f, 0.775811911f},
-std::array<float,2>{0.680102468f, 0.0569425896f},
-std::array<float,2>{0.488637269f, 0.136722267f},
-std::array<float,2>{0.520854354f, 0.902839601f},
-std::array<float,2>{0.00892436504f, 0.696011841f},
-std::array<float,2>{0.758850992f, 0.449252009f},
-std::array<float,2>{0.38686955f, 0.496654332f},
-std::array<float,2>{0.599770963f, 0.732771635f},
-std::array<float,2>{0.0900328085f, 0.93509382f},
-std::array<float,2>{0.860328257f, 0.162423655f},
-std::array<float,2>{0.153157383f, 0.000301527791f},
-std::array<float,2>{0.94628197f, 0.795447052f},
-std::array<float,2>{0.286205053f, 0.549364507f},
-std::array<float,2>{0.736662805f, 0.259228259f},
-std::array<float,2>{0.0414599739f, 0.366632491f},
-std::array<float,2>{0.790874958f, 0.5859918f},
-std::array<float,2>{0.438016057f, 0.843551338f},
-std::array<float,2>{0.534306109f, 0.116158143f},
-std::array<float,2>{0.354528159f, 0.227889776f},
-std::array<float,2>{0.644811988f, 0.940784335f},
-std::array<float,2>{0.235355929f, 0.665087581f},
-std::array<float,2>{0.889362931f, 0.386486322f},
-std::array<float,2>{0.25034833f, 0.290627778f},
-std::array<float,2>{0.690120578f, 0.528025508f},
-std::array<float,2>{0.18371132f, 0.772436082f},
-std::array<float,2>{0.970678091f, 0.0530542992f},
-std::array<float,2>{0.120233849f, 0.125851765f},
-std::array<float,2>{0.834172726f, 0.892961681f},
-std::array<float,2>{0.430193156f, 0.694130003f},
-std::array<float,2>{0.567655444f, 0.442489147f},
-std::array<float,2>{0.214527741f, 0.415073395f},
-std::array<float,2>{0.917229176f, 0.640652537f},
-std::array<float,2>{0.317311525f, 0.986018836f},
-std::array<float,2>{0.656986117f, 0.195799306f},
-std::array<float,2>{0.470185041f, 0.0627254918f},
-std::array<float,2>{0.500993848f, 0.86995697f},
-std::array<float,2>{0.0191378221f, 0.599563181f},
-std::array<float,2>{0.772897303f, 0.325094551f},
-std::array<float,2>{0.459516197f, 0.341104209f},
-std::array<float,2>{0.558493376f, 0.623600662f},
-std::array<float,2>{0.0591864549f, 0.851695299f},
-std::array<float,2>{0.802076161f, 0.0824332386f},
-std::array<float,2>{0.233587444f, 0.205191121f},
-std::array<float,2>{0.892940283f, 0.981951773f},
-std::array<float,2>{0.374771744f, 0.6326074f},
-std::array<float,2>{0.628469288f, 0.427120924f},
-std::array<float,2>{0.0732438862f, 0.466719151f},
-std::array<float,2>{0.843766391f, 0.711814344f},
-std::array<float,2>{0.393396646f, 0.887449563f},
-std::array<float,2>{0.610009968f, 0.142562002f},
-std::array<float,2>{0.298833907f, 0.0461670235f},
-std::array<float,2>{0.721316576f, 0.752873003f},
-std::array<float,2>{0.136488646f, 0.50931251f},
-std::array<float,2>{0.958943486f, 0.3110888f},
-std::array<float,2>{0.343357742f, 0.400398165f},
-std::array<float,2>{0.685999274f, 0.684708774f},
-std::array<float,2>{0.191294223f, 0.960953951f},
-std::array<float,2>{0.923227966f, 0.240683109f},
-std::array<float,2>{0.0126527799f, 0.103958584f},
-std::array<float,2>{0.763694227f, 0.812545061f},
-std::array<float,2>{0.488040507f, 0.571993172f},
-std::array<float,2>{0.519135892f, 0.35730803f},
-std::array<float,2>{0.171711192f, 0.266844779f},
-std::array<float,2>{0.998903036f, 0.539661169f},
-std::array<float,2>{0.276587456f, 0.799109042f},
-std::array<float,2>{0.707981765f, 0.0303069074f},
-std::array<float,2>{0.416166872f, 0.186825156f},
-std::array<float,2>{0.582487583f, 0.91787219f},
-std::array<float,2>{0.0977871716f, 0.747303486f},
-std::array<float,2>{0.818080544f, 0.482689142f},
-std::array<float,2>{0.497828007f, 0.436356008f},
-std::array<float,2>{0.526591003f, 0.637926519f},
-std::array<float,2>{0.00327603659f, 0.970314682f},
-std::array<float,2>{0.751208663f, 0.212642685f},
-std::array<float,2>{0.199808836f, 0.090601705f},
-std::array<float,2>{0.929739892f, 0.848516822f},
-std::array<float,2>{0.334180176f, 0.615813911f},
-std::array<float,2>{0.67646867f, 0.334378272f},
-std::array<float,2>{0.104465455f, 0.303214848f},
-std::array<float,2>{0.820748389f, 0.501043499f},
-std::array<float,2>{0.411045343f, 0.758674264f},
-std::array<float,2>{0.591233194f, 0.0352784768f},
-std::array<float,2>{0.267746806f, 0.153575674f},
-std::array<float,2>{0.716142714f, 0.878274739f},
-std::array<float,2>{0.158231378f, 0.710582137f},
-std::array<float,2>{0.988942325f, 0.455792218f},
-std::array<float,2>{0.360460103f, 0.345993608f},
-std::array<float,2>{0.633687675f, 0.5669294f},
-std::array<float,2>{0.224471748f, 0.8238253f},
-std::array<float,2>{0.899414062f, 0.0955350921f},
-std::array<float,2>{0.0496824831f, 0.24390623f},
-std::array<float,2>{0.809331298f, 0.959090769f},
-std::array<float,2>{0.464831233f, 0.672632098f},
-std::array<float,2>{0.55159843f, 0.393402308f},
-std::array<float,2>{0.125639483f, 0.474701107f},
-std::array<float,2>{0.963901937f, 0.737241209f},
-std::array<float,2>{0.305395603f, 0.910614014f},
-std::array<float,2>{0.726992965f, 0.179492235f},
-std::array<float,2>{0.404948086f, 0.0177692696f},
-std::array<float,2>{0.622966826f, 0.807353437f},
-std::array<float,2>{0.063407436f, 0.533364415f},
-std::array<float,2>{0.857618928f, 0.279223561f},
-std::array<float,2>{0.42400533f, 0.255524516f},
-std::array<float,2>{0.57389164f, 0.557620645f},
-std::array<float,2>{0.113748826f, 0.781672537f},
-std::array<float,2>{0.838404179f, 0.0114162387f},
-std::array<float,2>{0.173954815f, 0.164892316f},
-std::array<float,2>{0.983242035f, 0.929513693f},
-std::array<float,2>{0.26180768f, 0.720782161f},
-std::array<float,2>{0.697449744f, 0.488975227f},
-std::array<float,2>{0.0293168053f, 0.375869095f},
-std::array<float,2>{0.77986443f, 0.663550436f},
-std::array<float,2>{0.478533059f, 0.950957894f},
-std::array<float,2>{0.51470238f, 0.223376423f},
-std::array<float,2>{0.323559165f, 0.117967546f},
-std::array<float,2>{0.669328392f, 0.832696676f},
-std::array<float,2>{0.207364425f, 0.585520506f},
-std::array<float,2>{0.908585191f, 0.374349862f},
-std::array<float,2>{0.292639971f, 0.448047847f},
-std::array<float,2>{0.744783163f, 0.700538158f},
-std::array<float,2>{0.143181205f, 0.899866998f},
-std::array<float,2>{0.93857491f, 0.135542989f},
-std::array<float,2>{0.0820959434f, 0.0589677244f},
-std::array<float,2>{0.868147552f, 0.77892673f},
-std::array<float,2>{0.377259731f, 0.518495023f},
-std::array<float,2>{0.604567051f, 0.288345903f},
-std::array<float,2>{0.24399668f, 0.315698177f},
-std::array<float,2>{0.877414823f, 0.607055604f},
-std::array<float,2>{0.348890275f, 0.862943828f},
-std::array<float,2>{0.655282676f, 0.0778899193f},
-std::array<float,2>{0.450657398f, 0.191612035f},
-std::array<float,2>{0.539525867f, 0.999385118f},
-std::array<float,2>{0.036462985f, 0.656146169f},
-std::array<float,2>{0.785827518f, 0.41338414f},
-std::array<float,2>{0.41820243f, 0.408934236f},
-std::array<float,2>{0.579200387f, 0.648608863f},
-std::array<float,2>{0.0951111093f, 0.994512558f},
-std::array<float,2>{0.814221501f, 0.187664405f},
-std::array<float,2>{0.167299703f, 0.0720492378f},
-std::array<float,2>{0.995964408f, 0.864400744f},
-std::array<float,2>{0.281233728f, 0.603080571f},
-std::array<float,2>{0.706532001f, 0.316960216f},
-std::array<float,2>{0.0093697561f, 0.283863932f},
-std::array<float,2>{0.759602308f, 0.521518409f},
-std::array<float,2>{0.488896161f, 0.773807943f},
-std::array<float,2>{0.52136606f, 0.0548358038f},
-std::array<float,2>{0.33925125f, 0.139296204f},
-std::array<float,2>{0.680474877f, 0.905906022f},
-std::array<float,2>{0.193063408f, 0.697296262f},
-std::array<float,2>{0.929249167f, 0.452936441f},
-std::array<float,2>{0.303755701f, 0.369873375f},
-std::array<float,2>{0.723197043f, 0.578303933f},
-std::array<float,2>{0.138297275f, 0.830474436f},
-std::array<float,2>{0.955653191f, 0.122950464f},
-std::array<float,2>{0.0758469105f, 0.222383246f},
-std::array<float,2>{0.848048508f, 0.947450578f},
-std::array<float,2>{0.395640612f, 0.659122705f},
-std::array<float,2>{0.613849998f, 0.381613731f},
-std::array<float,2>{0.229733929f, 0.488164335f},
-std::array<float,2>{0.898020923f, 0.723791599f},
-std::array<float,2>{0.370597661f, 0.925532401f},
-std::array<float,2>{0.629057288f, 0.171298891f},
-std::array<float,2>{0.454508752f, 0.0138539225f},
-std::array<float,2>{0.55900532f, 0.785389662f},
-std::array<float,2>{0.0548415221f, 0.559940696f},
-std::array<float,2>{0.797557831f, 0.250169903f},
-std::array<float,2>{0.475701571f, 0.273707509f},
-std::array<float,2>{0.505456805f, 0.538278759f},
-std::array<float,2>{0.0197667088f, 0.811957359f},
-std::array<float,2>{0.769355893f, 0.0213497505f},
-std::array<float,2>{0.216064438f, 0.172715604f},
-std::array<float,2>{0.919297099f, 0.909853339f},
-std::array<float,2>{0.314964741f, 0.742150664f},
-std::array<float,2>{0.661392033f, 0.469157279f},
-std::array<float,2>{0.123982295f, 0.39705345f},
-std::array<float,2>{0.830423474f, 0.676190674f},
-std::array<float,2>{0.436126381f, 0.956333458f},
-std::array<float,2>{0.56343919f, 0.24849689f},
-std::array<float,2>{0.256234765f, 0.100469209f},
-std::array<float,2>{0.693393826f, 0.82498771f},
-std::array<float,2>{0.182710022f, 0.563076973f},
-std::array<float,2>{0.974259198f, 0.35044083f},
-std::array<float,2>{0.357760817f, 0.459589303f},
-std::array<float,2>{0.641950727f, 0.706850231f},
-std::array<float,2>{0.238849431f, 0.881716251f},
-std::array<float,2>{0.883015573f, 0.151811197f},
-std::array<float,2>{0.0438741148f, 0.032763958f},
-std::array<float,2>{0.796465039f, 0.763567626f},
-std::array<float,2>{0.442315876f, 0.504526913f},
-std::array<float,2>{0.535817266f, 0.29779309f},
-std::array<float,2>{0.15064308f, 0.330504805f},
-std::array<float,2>{0.950048864f, 0.610431075f},
-std::array<float,2>{0.283349454f, 0.844554663f},
-std::array<float,2>{0.739633501f, 0.0871056467f},
-std::array<float,2>{0.384611815f, 0.216414437f},
-std::array<float,2>{0.595384181f, 0.973544836f},
-std::array<float,2>{0.087229386f, 0.634035051f},
-std::array<float,2>{0.866881549f, 0.429992527f},
-std::array<float,2>{0.44777298f, 0.477665484f},
-std::array<float,2>{0.544194698f, 0.742724657f},
-std::array<float,2>{0.0316497386f, 0.919965088f},
-std::array<float,2>{0.782078445f, 0.180683941f},
-std::array<float,2>{0.247255236f, 0.0265664384f},
-std::array<float,2>{0.880502284f, 0.803939342f},
-std::array<float,2>{0.344492227f, 0.544541717f},
-std::array<float,2>{0.649428964f, 0.273341089f},
-std::array<float,2>{0.0791295171f, 0.354741067f},
-std::array<float,2>{0.874058247f, 0.576821923f},
-std::array<float,2>{0.380363315f, 0.819492638f},
-std::array<float,2>{0.609119713f, 0.106229372f},
-std::array<float,2>{0.293126017f, 0.236728728f},
-std::array<float,2>{0.746427715f, 0.967344522f},
-std::array<float,2>{0.146618724f, 0.682719886f},
-std::array<float,2>{0.94420284f, 0.402344167f},
-std::array<float,2>{0.325731128f, 0.308208942f},
-std::array<float,2>{0.66774255f, 0.512214184f},
-std::array<float,2>{0.207011566f, 0.754604876f},
-std::array<float,2>{0.911421418f, 0.0391620956f},
-std::array<float,2>{0.0270934496f, 0.144955486f},
-std::array<float,2>{0.777175963f, 0.885326862f},
-std::array<float,2>{0.483579308f, 0.718494534f},
-std::array<float,2>{0.507874429f, 0.46123749f},
-std::array<float,2>{0.177197143f, 0.422087878f},
-std::array<float,2>{0.979856789f, 0.627673805f},
-std::array<float,2>{0.259784937f, 0.977410197f},
-std::array<float,2>{0.699382126f, 0.209106192f},
-std::array<float,2>{0.429149359f, 0.0799503103f},
-std::array<float,2>{0.574733615f, 0.856236935f},
-std::array<float,2>{0.110504627f, 0.619851947f},
-std::array<float,2>{0.841355026f, 0.338593245f},
-std::array<float,2>{0.399373353f, 0.323860526f},
-std::array<float,2>{0.620320797f, 0.594301283f},
-std::array<float,2>{0.0682103932f, 0.873767853f},
-std::array<float,2>{0.855436385f, 0.06751775f},
-std::array<float,2>{0.129101127f, 0.201433271f},
-std::array<float,2>{0.966657162f, 0.990443885f},
-std::array<float,2>{0.3098014f, 0.646513104f},
-std::array<float,2>{0.730896175f, 0.418619931f},
-std::array<float,2>{0.0519284792f, 0.440445602f},
-std::array<float,2>{0.805647194f, 0.689045727f},
-std::array<float,2>{0.46842435f, 0.896412849f},
-std::array<float,2>{0.548296094f, 0.130930334f},
-std::array<float,2>{0.365488946f, 0.0496492013f},
-std::array<float,2>{0.638017058f, 0.765676558f},
-std::array<float,2>{0.220294878f, 0.523705781f},
-std::array<float,2>{0.903741181f, 0.296162426f},
-std::array<float,2>{0.271089137f, 0.389137655f},
-std::array<float,2>{0.711277068f, 0.670734525f},
-std::array<float,2>{0.163243487f, 0.943564177f},
-std::array<float,2>{0.985139489f, 0.232790887f},
-std::array<float,2>{0.107462391f, 0.112624303f},
-std::array<float,2>{0.826309681f, 0.836887002f},
-std::array<float,2>{0.406620204f, 0.590477169f},
-std::array<float,2>{0.587003827f, 0.360214442f},
-std::array<float,2>{0.196941867f, 0.261986017f},
-std::array<float,2>{0.936715484f, 0.551507473f},
-std::array<float,2>{0.331157833f, 0.792890847f},
-std::array<float,2>{0.673418105f, 0.00464556925f},
-std::array<float,2>{0.49441573f, 0.159576327f},
-std::array<float,2>{0.528358936f, 0.932964444f},
-std::array<float,2>{0.00530505367f, 0.730000854f},
-std::array<float,2>{0.757736027f, 0.492794454f},
-std::array<float,2>{0.377779275f, 0.44556877f},
-std::array<float,2>{0.605015635f, 0.702590108f},
-std::array<float,2>{0.0826536566f, 0.900596797f},
-std::array<float,2>{0.867406487f, 0.133771539f},
-std::array<float,2>{0.143022612f, 0.061146304f},
-std::array<float,2>{0.938990355f, 0.78073436f},
-std::array<float,2>{0.292472094f, 0.516827404f},
-std::array<float,2>{0.744317055f, 0.286626309f},
-std::array<float,2>{0.0367328785f, 0.314256817f},
-std::array<float,2>{0.78549391f, 0.607773125f},
-std::array<float,2>{0.45094648f, 0.860530376f},
-std::array<float,2>{0.539885819f, 0.0751045048f},
-std::array<float,2>{0.349505872f, 0.19442755f},
-std::array<float,2>{0.655849636f, 0.996321261f},
-std::array<float,2>{0.243468687f, 0.653930068f},
-std::array<float,2>{0.877881944f, 0.411941409f},
-std::array<float,2>{0.262332171f, 0.256156772f},
-std::array<float,2>{0.697843492f, 0.555665374f},
-std::array<float,2>{0.174482241f, 0.78321141f},
-std::array<float,2>{0.982831001f, 0.00784519222f},
-std::array<float,2>{0.113903008f, 0.167024374f},
-std::array<float,2>{0.838095665f, 0.927595139f},
-std::array<float,2>{0.424389392f, 0.719175935f},
-std::array<float,2>{0.573670447f, 0.49038747f},
-std::array<float,2>{0.207969084f, 0.378365368f},
-std::array<float,2>{0.908764899f, 0.661478579f},
-std::array<float,2>{0.323849976f, 0.951525152f},
-std::array<float,2>{0.6699031f, 0.224944994f},
-std::array<float,2>{0.479276121f, 0.120850198f},
-std::array<float,2>{0.515363455f, 0.83483839f},
-std::array<float,2>{0.0298297685f, 0.582230508f},
-std::array<float,2>{0.779505432f, 0.371253341f},
-std::array<float,2>{0.463909835f, 0.345028847f},
-std::array<float,2>{0.551193357f, 0.56900686f},
-std::array<float,2>{0.048944477f, 0.821779668f},
-std::array<float,2>{0.808776975f, 0.0958724469f},
-std::array<float,2>{0.223798335f, 0.245430037f},
-std::array<float,2>{0.89860481f, 0.957651198f},
-std::array<float,2>{0.361174464f, 0.67563206f},
-std::array<float,2>{0.633087218f, 0.390811533f},
-std::array<float,2>{0.0625463426f, 0.473226339f},
-std::array<float,2>{0.858009517f, 0.736302555f},
-std::array<float,2>{0.404621303f, 0.91314584f},
-std::array<float,2>{0.622386575f, 0.176589429f},
-std::array<float,2>{0.304958075f, 0.0169082191f},
-std::array<float,2>{0.72748214f, 0.805405736f},
-std::array<float,2>{0.125190154f, 0.532484591f},
-std::array<float,2>{0.964442968f, 0.280672133f},
-std::array<float,2>{0.334864169f, 0.43481496f},
-std::array<float,2>{0.676200807f, 0.638691127f},
-std::array<float,2>{0.199543655f, 0.972205997f},
-std::array<float,2>{0.930354655f, 0.213308126f},
-std::array<float,2>{0.00384822115f, 0.0934839621f},
-std::array<float,2>{0.751805902f, 0.850512147f},
-std::array<float,2>{0.497454017f, 0.613325596f},
-std::array<float,2>{0.527147353f, 0.332110018f},
-std::array<float,2>{0.159150004f, 0.301358074f},
-std::array<float,2>{0.988603711f, 0.502620161f},
-std::array<float,2>{0.268500924f, 0.760245144f},
-std::array<float,2>{0.71673286f, 0.0386139862f},
-std::array<float,2>{0.410410613f, 0.154874012f},
-std::array<float,2>{0.591792345f, 0.875808358f},
-std::array<float,2>{0.103739627f, 0.707919061f},
-std::array<float,2>{0.820874155f, 0.453890741f},
-std::array<float,2>{0.487479687f, 0.39923954f},
-std::array<float,2>{0.518992662f, 0.686632991f},
-std::array<float,2>{0.0118759507f, 0.963514388f},
-std::array<float,2>{0.764378726f, 0.239074633f},
-std::array<float,2>{0.19054614f, 0.102009729f},
-std::array<float,2>{0.923579931f, 0.814924002f},
-std::array<float,2>{0.343038291f, 0.574025214f},
-std::array<float,2>{0.686149478f, 0.359222442f},
-std::array<float,2>{0.0981888026f, 0.269396812f},
-std::array<float,2>{0.817446947f, 0.541705072f},
-std::array<float,2>{0.416513085f, 0.798624039f},
-std::array<float,2>{0.582868516f, 0.0281676054f},
-std::array<float,2>{0.277323335f, 0.184743017f},
-std::array<float,2>{0.707314491f, 0.914647341f},
-std::array<float,2>{0.171185777f, 0.748999238f},
-std::array<float,2>{0.998163819f, 0.481207162f},
-std::array<float,2>{0.374444097f, 0.342063099f},
-std::array<float,2>{0.628034592f, 0.622546256f},
-std::array<float,2>{0.233945861f, 0.855151951f},
-std::array<float,2>{0.893382013f, 0.0841336176f},
-std::array<float,2>{0.058805421f, 0.204738051f},
-std::array<float,2>{0.802333176f, 0.983936429f},
-std::array<float,2>{0.459071755f, 0.630696177f},
-std::array<float,2>{0.55762583f, 0.42854178f},
-std::array<float,2>{0.135747522f, 0.467548788f},
-std::array<float,2>{0.958087444f, 0.714141548f},
-std::array<float,2>{0.299454689f, 0.889553547f},
-std::array<float,2>{0.720967054f, 0.14352788f},
-std::array<float,2>{0.392592013f, 0.0437283702f},
-std::array<float,2>{0.609788299f, 0.751537204f},
-std::array<float,2>{0.0737692714f, 0.510720253f},
-std::array<float,2>{0.844674408f, 0.30910638f},
-std::array<float,2>{0.429958969f, 0.291267246f},
-std::array<float,2>{0.568159163f, 0.529503345f},
-std::array<float,2>{0.120696105f, 0.769657135f},
-std::array<float,2>{0.834808946f, 0.0511907078f},
-std::array<float,2>{0.18425478f, 0.127894595f},
-std::array<float,2>{0.969995975f, 0.891577184f},
-std::array<float,2>{0.250583649f, 0.692635238f},
-std::array<float,2>{0.689656079f, 0.444773644f},
-std::array<float,2>{0.0186184067f, 0.416280508f},
-std::array<float,2>{0.773145735f, 0.644145787f},
-std::array<float,2>{0.470462829f, 0.987739444f},
-std::array<float,2>{0.501541674f, 0.198275551f},
-std::array<float,2>{0.316691667f, 0.0648136362f},
-std::array<float,2>{0.656521499f, 0.868374109f},
-std::array<float,2>{0.214282125f, 0.600244462f},
-std::array<float,2>{0.917536497f, 0.326708198f},
-std::array<float,2>{0.286944926f, 0.498259783f},
-std::array<float,2>{0.736964941f, 0.731313288f},
-std::array<float,2>{0.152431056f, 0.93692708f},
-std::array<float,2>{0.945532978f, 0.160721257f},
-std::array<float,2>{0.0904720947f, 0.00293514505f},
-std::array<float,2>{0.859853804f, 0.793458104f},
-std::array<float,2>{0.387413204f, 0.547341645f},
-std::array<float,2>{0.600493371f, 0.25990513f},
-std::array<float,2>{0.236040294f, 0.363637924f},
-std::array<float,2>{0.888819098f, 0.588105857f},
-std::array<float,2>{0.355392307f, 0.84113425f},
-std::array<float,2>{0.645247638f, 0.113484696f},
-std::array<float,2>{0.437589139f, 0.229661047f},
-std::array<float,2>{0.534790993f, 0.93762368f},
-std::array<float,2>{0.0419117175f, 0.666748285f},
-std::array<float,2>{0.790394187f, 0.383969486f},
-std::array<float,2>{0.397856444f, 0.380474299f},
-std::array<float,2>{0.615253091f, 0.657493711f},
-std::array<float,2>{0.0772948563f, 0.945464313f},
-std::array<float,2>{0.851455212f, 0.219404951f},
-std::array<float,2>{0.139390379f, 0.12497773f},
-std::array<float,2>{0.953614354f, 0.829063356f},
-std::array<float,2>{0.302016497f, 0.581435263f},
-std::array<float,2>{0.72572422f, 0.367628306f},
-std::array<float,2>{0.0582490377f, 0.25288862f},
-std::array<float,2>{0.800012827f, 0.56194216f},
-std::array<float,2>{0.455460966f, 0.787303507f},
-std::array<float,2>{0.560988545f, 0.0122988084f},
-std::array<float,2>{0.368390322f, 0.168141201f},
-std::array<float,2>{0.631474376f, 0.92364943f},
-std::array<float,2>{0.227000281f, 0.724659741f},
-std::array<float,2>{0.896391571f, 0.486074895f},
-std::array<float,2>{0.27798745f, 0.318973839f},
-std::array<float,2>{0.703532577f, 0.60445255f},
-std::array<float,2>{0.164911807f, 0.8662889f},
-std::array<float,2>{0.993150771f, 0.0733561814f},
-std::array<float,2>{0.0970404744f, 0.19134897f},
-std::array<float,2>{0.814700186f, 0.993154585f},
-std::array<float,2>{0.420714647f, 0.652088165f},
-std::array<float,2>{0.580515325f, 0.408180088f},
-std::array<float,2>{0.195035875f, 0.449787408f},
-std::array<float,2>{0.927148283f, 0.695578218f},
-std::array<float,2>{0.337152898f, 0.902734339f},
-std::array<float,2>{0.681945205f, 0.137428492f},
-std::array<float,2>{0.490366697f, 0.0573865436f},
-std::array<float,2>{0.521512806f, 0.77608484f},
-std::array<float,2>{0.0114804255f, 0.519770324f},
-std::array<float,2>{0.761236429f, 0.281896532f},
-std::array<float,2>{0.444534034f, 0.298962504f},
-std::array<float,2>{0.53827244f, 0.50665772f},
-std::array<float,2>{0.0452943556f, 0.765547752f},
-std::array<float,2>{0.793399215f, 0.0339420885f},
-std::array<float,2>{0.240405202f, 0.149373412f},
-std::array<float,2>{0.886388004f, 0.88064301f},
-std::array<float,2>{0.356122822f, 0.704532981f},
-std::array<float,2>{0.643017292f, 0.458310157f},
-std::array<float,2>{0.0889952332f, 0.433434546f},
-std::array<float,2>{0.863357842f, 0.635370612f},
-std::array<float,2>{0.386158586f, 0.976406395f},
-std::array<float,2>{0.596024334f, 0.217301935f},
-std::array<float,2>{0.281757325f, 0.0895327106f},
-std::array<float,2>{0.740903437f, 0.846468151f},
-std::array<float,2>{0.148526937f, 0.612942159f},
-std::array<float,2>{0.952247143f, 0.328259468f},
-std::array<float,2>{0.313861966f, 0.472049832f},
-std::array<float,2>{0.662336707f, 0.739470959f},
-std::array<float,2>{0.217616081f, 0.908175349f},
-std::array<float,2>{0.921054661f, 0.173936471f},
-std::array<float,2>{0.0220744833f, 0.0221488699f},
-std::array<float,2>{0.765975177f, 0.810234785f},
-std::array<float,2>{0.47291854f, 0.536871016f},
-std::array<float,2>{0.505889773f, 0.27657041f},
-std::array<float,2>{0.181394294f, 0.347885221f},
-std::array<float,2>{0.976068735f, 0.564811826f},
-std::array<float,2>{0.255508989f, 0.826367378f},
-std::array<float,2>{0.692050338f, 0.0995045155f},
-std::array<float,2>{0.434238642f, 0.247792587f},
-std::array<float,2>{0.566251874f, 0.953472018f},
-std::array<float,2>{0.122396365f, 0.678826988f},
-std::array<float,2>{0.828466594f, 0.395950764f},
-std::array<float,2>{0.481743336f, 0.463146538f},
-std::array<float,2>{0.510529041f, 0.716007829f},
-std::array<float,2>{0.0249331109f, 0.884746552f},
-std::array<float,2>{0.774514616f, 0.14839372f},
-std::array<float,2>{0.203544572f, 0.0411258601f},
-std::array<float,2>{0.91390729f, 0.75619328f},
-std::array<float,2>{0.326189578f, 0.51472342f},
-std::array<float,2>{0.665977001f, 0.306553036f},
-std::array<float,2>{0.112621874f, 0.337519735f},
-std::array<float,2>{0.84204942f, 0.617364049f},
-std::array<float,2>{0.426922321f, 0.859048784f},
-std::array<float,2>{0.577909291f, 0.0815842599f},
-std::array<float,2>{0.259423822f, 0.207044259f},
-std::array<float,2>{0.702529788f, 0.978934646f},
-std::array<float,2>{0.178493038f, 0.626742482f},
-std::array<float,2>{0.978452206f, 0.424670517f},
-std::array<float,2>{0.34680903f, 0.270834327f},
-std::array<float,2>{0.650474906f, 0.544962347f},
-std::array<float,2>{0.248714507f, 0.802415311f},
-std::array<float,2>{0.881333947f, 0.0252131261f},
-std::array<float,2>{0.0346653834f, 0.182829916f},
-std::array<float,2>{0.784125924f, 0.918302834f},
-std::array<float,2>{0.446908832f, 0.745540202f},
-std::array<float,2>{0.546303213f, 0.479414701f},
-std::array<float,2>{0.145281866f, 0.404778033f},
-std::array<float,2>{0.94250828f, 0.680120647f},
-std::array<float,2>{0.29595843f, 0.965666771f},
-std::array<float,2>{0.749988854f, 0.236251354f},
-std::array<float,2>{0.381972879f, 0.108120471f},
-std::array<float,2>{0.607119322f, 0.818320692f},
-std::array<float,2>{0.0804836005f, 0.57513839f},
-std::array<float,2>{0.872727811f, 0.352816641f},
-std::array<float,2>{0.40833652f, 0.362726033f},
-std::array<float,2>{0.588161051f, 0.593670487f},
-std::array<float,2>{0.105674922f, 0.83848083f},
-std::array<float,2>{0.824904323f, 0.109488063f},
-std::array<float,2>{0.161820278f, 0.231055707f},
-std::array<float,2>{0.986398816f, 0.941773117f},
-std::array<float,2>{0.271965265f, 0.66941011f},
-std::array<float,2>{0.713101089f, 0.387709677f},
-std::array<float,2>{0.00707663735f, 0.495195717f},
-std::array<float,2>{0.754859567f, 0.728290379f},
-std::array<float,2>{0.494071931f, 0.930631518f},
-std::array<float,2>{0.531087875f, 0.157489419f},
-std::array<float,2>{0.328670293f, 0.00753257005f},
-std::array<float,2>{0.675249517f, 0.789667726f},
-std::array<float,2>{0.199176237f, 0.554284096f},
-std::array<float,2>{0.933672011f, 0.26434648f},
-std::array<float,2>{0.311886996f, 0.420007855f},
-std::array<float,2>{0.73245275f, 0.646127522f},
-std::array<float,2>{0.131338537f, 0.989143312f},
-std::array<float,2>{0.968718112f, 0.201057047f},
-std::array<float,2>{0.0684985965f, 0.0695664287f},
-std::array<float,2>{0.853226781f, 0.872129261f},
-std::array<float,2>{0.400755644f, 0.595704794f},
-std::array<float,2>{0.618810415f, 0.320729136f},
-std::array<float,2>{0.22224018f, 0.294733435f},
-std::array<float,2>{0.905661941f, 0.527269661f},
-std::array<float,2>{0.363552362f, 0.7682845f},
-std::array<float,2>{0.640165091f, 0.0484477766f},
-std::array<float,2>{0.465398699f, 0.130519241f},
-std::array<float,2>{0.549656689f, 0.897627831f},
-std::array<float,2>{0.0536374524f, 0.691069603f},
-std::array<float,2>{0.807994723f, 0.439013243f},
-std::array<float,2>{0.423187554f, 0.488358885f},
-std::array<float,2>{0.570484281f, 0.721480191f},
-std::array<float,2>{0.115416445f, 0.928949118f},
-std::array<float,2>{0.837043047f, 0.164224252f},
-std::array<float,2>{0.172776476f, 0.0110016223f},
-std::array<float,2>{0.981731772f, 0.781926513f},
-std::array<float,2>{0.265556484f, 0.558207393f},
-std::array<float,2>{0.697083354f, 0.255083263f},
-std::array<float,2>{0.0281374864f, 0.374828696f},
-std::array<float,2>{0.777900457f, 0.585095167f},
-std::array<float,2>{0.477989554f, 0.832134008f},
-std::array<float,2>{0.513456166f, 0.11759235f},
-std::array<float,2>{0.321417958f, 0.222858414f},
-std::array<float,2>{0.671633363f, 0.950226605f},
-std::array<float,2>{0.210844651f, 0.663759768f},
-std::array<float,2>{0.907668471f, 0.375077903f},
-std::array<float,2>{0.290399969f, 0.288765073f},
-std::array<float,2>{0.743723035f, 0.517953813f},
-std::array<float,2>{0.142181396f, 0.778592229f},
-std::array<float,2>{0.941151798f, 0.059100084f},
-std::array<float,2>{0.0851849169f, 0.135230049f},
-std::array<float,2>{0.871020615f, 0.900387406f},
-std::array<float,2>{0.375261605f, 0.700864732f},
-std::array<float,2>{0.602414548f, 0.447698206f},
-std::array<float,2>{0.245815665f, 0.413925797f},
-std::array<float,2>{0.876278877f, 0.655705273f},
-std::array<float,2>{0.35013023f, 0.999960363f},
-std::array<float,2>{0.653980315f, 0.192278832f},
-std::array<float,2>{0.452629864f, 0.077341482f},
-std::array<float,2>{0.541318059f, 0.86238414f},
-std::array<float,2>{0.0376497172f, 0.606617212f},
-std::array<float,2>{0.787229776f, 0.316258401f},
-std::array<float,2>{0.499253482f, 0.334572136f},
-std::array<float,2>{0.525238812f, 0.615346551f},
-std::array<float,2>{0.00177264959f, 0.847752213f},
-std::array<float,2>{0.753350675f, 0.0899850279f},
-std::array<float,2>{0.201685786f, 0.212223962f},
-std::array<float,2>{0.932968318f, 0.96981138f},
-std::array<float,2>{0.333061844f, 0.63828963f},
-std::array<float,2>{0.679611981f, 0.435654193f},
-std::array<float,2>{0.101730928f, 0.455239147f},
-std::array<float,2>{0.823433042f, 0.710443318f},
-std::array<float,2>{0.412230343f, 0.878773451f},
-std::array<float,2>{0.59308672f, 0.154201388f},
-std::array<float,2>{0.266270518f, 0.0361271165f},
-std::array<float,2>{0.718562722f, 0.758031189f},
-std::array<float,2>{0.156270698f, 0.501538813f},
-std::array<float,2>{0.99051404f, 0.303487897f},
-std::array<float,2>{0.361411214f, 0.392984957f},
-std::array<float,2>{0.635326803f, 0.672082901f},
-std::array<float,2>{0.226365298f, 0.959585309f},
-std::array<float,2>{0.900592327f, 0.243206069f},
-std::array<float,2>{0.0476805381f, 0.0951245502f},
-std::array<float,2>{0.811511159f, 0.823485911f},
-std::array<float,2>{0.462201685f, 0.566622496f},
-std::array<float,2>{0.553852737f, 0.346658617f},
-std::array<float,2>{0.128758997f, 0.278598666f},
-std::array<float,2>{0.962689042f, 0.534135342f},
-std::array<float,2>{0.307664245f, 0.806808352f},
-std::array<float,2>{0.729782581f, 0.0183046795f},
-std::array<float,2>{0.403293282f, 0.179083481f},
-std::array<float,2>{0.624362946f, 0.910874009f},
-std::array<float,2>{0.0649373606f, 0.73677516f},
-std::array<float,2>{0.856235743f, 0.475372136f},
-std::array<float,2>{0.457779139f, 0.427693367f},
-std::array<float,2>{0.556423068f, 0.631902456f},
-std::array<float,2>{0.0610620975f, 0.981467426f},
-std::array<float,2>{0.804068923f, 0.205728784f},
-std::array<float,2>{0.232066974f, 0.0827354491f},
-std::array<float,2>{0.892557263f, 0.852235615f},
-std::array<float,2>{0.373023719f, 0.623262286f},
-std::array<float,2>{0.625828207f, 0.341310143f},
-std::array<float,2>{0.0715204552f, 0.310612202f},
-std::array<float,2>{0.847022533f, 0.509054184f},
-std::array<float,2>{0.391706735f, 0.752396107f},
-std::array<float,2>{0.611482203f, 0.046870403f},
-std::array<float,2>{0.297442496f, 0.141802117f},
-std::array<float,2>{0.720087588f, 0.886925876f},
-std::array<float,2>{0.133925661f, 0.710961521f},
-std::array<float,2>{0.959870636f, 0.465963364f},
-std::array<float,2>{0.341710716f, 0.356705666f},
-std::array<float,2>{0.683862984f, 0.571701288f},
-std::array<float,2>{0.189308435f, 0.813037217f},
-std::array<float,2>{0.924578071f, 0.104113728f},
-std::array<float,2>{0.0148465298f, 0.241109371f},
-std::array<float,2>{0.76214242f, 0.961464345f},
-std::array<float,2>{0.48533693f, 0.685089707f},
-std::array<float,2>{0.516485929f, 0.401285857f},
-std::array<float,2>{0.168654785f, 0.482921571f},
-std::array<float,2>{0.996415913f, 0.747721553f},
-std::array<float,2>{0.27367267f, 0.917139232f},
-std::array<float,2>{0.709969997f, 0.187342316f},
-std::array<float,2>{0.414468646f, 0.0308209043f},
-std::array<float,2>{0.584061086f, 0.79969281f},
-std::array<float,2>{0.101086006f, 0.539217532f},
-std::array<float,2>{0.819681168f, 0.267399222f},
-std::array<float,2>{0.38985163f, 0.259416312f},
-std::array<float,2>{0.599157512f, 0.548902929f},
-std::array<float,2>{0.0934784561f, 0.79521656f},
-std::array<float,2>{0.861439168f, 0.000897643389f},
-std::array<float,2>{0.155954868f, 0.162793294f},
-std::array<float,2>{0.947463334f, 0.934857726f},
-std::array<float,2>{0.288578421f, 0.732911587f},
-std::array<float,2>{0.734895945f, 0.496531934f},
-std::array<float,2>{0.0405109264f, 0.385790646f},
-std::array<float,2>{0.791947246f, 0.665766001f},
-std::array<float,2>{0.441321701f, 0.941337883f},
-std::array<float,2>{0.532531738f, 0.228492394f},
-std::array<float,2>{0.35203898f, 0.115603752f},
-std::array<float,2>{0.647049427f, 0.843260825f},
-std::array<float,2>{0.238158822f, 0.586802185f},
-std::array<float,2>{0.88692534f, 0.366917014f},
-std::array<float,2>{0.252635717f, 0.443144023f},
-std::array<float,2>{0.688221276f, 0.693665683f},
-std::array<float,2>{0.185821444f, 0.893214405f},
-std::array<float,2>{0.971043706f, 0.125093699f},
-std::array<float,2>{0.118354261f, 0.0532245524f},
-std::array<float,2>{0.832885504f, 0.771796823f},
-std::array<float,2>{0.432726026f, 0.527804017f},
-std::array<float,2>{0.570274949f, 0.290198475f},
-std::array<float,2>{0.211202383f, 0.324544936f},
-std::array<float,2>{0.914197564f, 0.599085212f},
-std::array<float,2>{0.318368137f, 0.869514167f},
-std::array<float,2>{0.659179628f, 0.0631314144f},
-std::array<float,2>{0.47152546f, 0.195997834f},
-std::array<float,2>{0.502650201f, 0.985559464f},
-std::array<float,2>{0.0169144254f, 0.641366541f},
-std::array<float,2>{0.771315515f, 0.415920258f},
-std::array<float,2>{0.384888202f, 0.431269407f},
-std::array<float,2>{0.597113907f, 0.633695841f},
-std::array<float,2>{0.0881259441f, 0.974134862f},
-std::array<float,2>{0.864381135f, 0.215291962f},
-std::array<float,2>{0.150142446f, 0.0865315348f},
-std::array<float,2>{0.951661766f, 0.845608652f},
-std::array<float,2>{0.282692999f, 0.609876871f},
-std::array<float,2>{0.741478324f, 0.331681758f},
-std::array<float,2>{0.0464669019f, 0.298671246f},
-std::array<float,2>{0.794547915f, 0.50534749f},
-std::array<float,2>{0.444192171f, 0.762265921f},
-std::array<float,2>{0.537660122f, 0.0313122012f},
-std::array<float,2>{0.357276618f, 0.150420263f},
-std::array<float,2>{0.64359659f, 0.88187325f},
-std::array<float,2>{0.241882473f, 0.705403268f},
-std::array<float,2>{0.885046721f, 0.460706055f},
-std::array<float,2>{0.25473088f, 0.351483911f},
-std::array<float,2>{0.692908704f, 0.563824058f},
-std::array<float,2>{0.180191338f, 0.826161385f},
-std::array<float,2>{0.975148797f, 0.100895263f},
-std::array<float,2>{0.121412896f, 0.249433219f},
-std::array<float,2>{0.829517543f, 0.955520332f},
-std::array<float,2>{0.435267299f, 0.677119195f},
-std::array<float,2>{0.565107524f, 0.397622377f},
-std::array<float,2>{0.218701094f, 0.470039994f},
-std::array<float,2>{0.920161784f, 0.740590036f},
-std::array<float,2>{0.312547266f, 0.908813953f},
-std::array<float,2>{0.66331172f, 0.173141673f},
-std::array<float,2>{0.473792255f, 0.019918479f},
-std::array<float,2>{0.507421315f, 0.810704887f},
-std::array<float,2>{0.0232662614f, 0.537917614f},
-std::array<float,2>{0.767338693f, 0.275183141f},
-std::array<float,2>{0.457026154f, 0.251798689f},
-std::array<float,2>{0.56188941f, 0.558650553f},
-std::array<float,2>{0.0567012578f, 0.786660194f},
-std::array<float,2>{0.799087644f, 0.0150528736f},
-std::array<float,2>{0.228318244f, 0.170372963f},
-std::array<float,2>{0.894993603f, 0.924447715f},
-std::array<float,2>{0.36810711f, 0.722853363f},
-std::array<float,2>{0.632628083f, 0.486421227f},
-std::array<float,2>{0.076734066f, 0.382001311f},
-std::array<float,2>{0.849902093f, 0.660146952f},
-std::array<float,2>{0.397246629f, 0.948374093f},
-std::array<float,2>{0.617067575f, 0.220861867f},
-std::array<float,2>{0.301637888f, 0.12111102f},
-std::array<float,2>{0.725075066f, 0.831776917f},
-std::array<float,2>{0.139762223f, 0.579296112f},
-std::array<float,2>{0.95497334f, 0.37031433f},
-std::array<float,2>{0.336137712f, 0.451700687f},
-std::array<float,2>{0.682630837f, 0.698986888f},
-std::array<float,2>{0.193520337f, 0.904758096f},
-std::array<float,2>{0.925815344f, 0.140368327f},
-std::array<float,2>{0.0102779614f, 0.0559146032f},
-std::array<float,2>{0.76041615f, 0.775072396f},
-std::array<float,2>{0.491214931f, 0.522817194f},
-std::array<float,2>{0.522587419f, 0.284682393f},
-std::array<float,2>{0.165343568f, 0.31751439f},
-std::array<float,2>{0.993237376f, 0.602043748f},
-std::array<float,2>{0.278765976f, 0.863514185f},
-std::array<float,2>{0.704390466f, 0.0704404414f},
-std::array<float,2>{0.421510428f, 0.188680798f},
-std::array<float,2>{0.58133775f, 0.995842397f},
-std::array<float,2>{0.0959050059f, 0.649984658f},
-std::array<float,2>{0.816019714f, 0.409903944f},
-std::array<float,2>{0.492985338f, 0.493394941f},
-std::array<float,2>{0.529714763f, 0.729295194f},
-std::array<float,2>{0.00596720865f, 0.931677938f},
-std::array<float,2>{0.755752921f, 0.158803478f},
-std::array<float,2>{0.197791576f, 0.00541953323f},
-std::array<float,2>{0.935360312f, 0.791802943f},
-std::array<float,2>{0.329369515f, 0.552734077f},
-std::array<float,2>{0.673886001f, 0.26354596f},
-std::array<float,2>{0.107137509f, 0.361297995f},
-std::array<float,2>{0.825848341f, 0.591774106f},
-std::array<float,2>{0.410049796f, 0.837749898f},
-std::array<float,2>{0.589678288f, 0.111376286f},
-std::array<float,2>{0.27255404f, 0.233445078f},
-std::array<float,2>{0.71429801f, 0.945038438f},
-std::array<float,2>{0.160692856f, 0.67151314f},
-std::array<float,2>{0.987460554f, 0.390391439f},
-std::array<float,2>{0.365183622f, 0.294961572f},
-std::array<float,2>{0.63886106f, 0.524560571f},
-std::array<float,2>{0.22089009f, 0.767252922f},
-std::array<float,2>{0.904509902f, 0.0499852374f},
-std::array<float,2>{0.0541366413f, 0.132628232f},
-std::array<float,2>{0.806937754f, 0.894644082f},
-std::array<float,2>{0.466215193f, 0.688313544f},
-std::array<float,2>{0.550512433f, 0.440131366f},
-std::array<float,2>{0.132148385f, 0.419036508f},
-std::array<float,2>{0.966971695f, 0.647644162f},
-std::array<float,2>{0.310982138f, 0.991295218f},
-std::array<float,2>{0.734232008f, 0.203023672f},
-std::array<float,2>{0.402250737f, 0.0671562552f},
-std::array<float,2>{0.617733836f, 0.874149263f},
-std::array<float,2>{0.0695103854f, 0.595134854f},
-std::array<float,2>{0.851910889f, 0.322344244f},
-std::array<float,2>{0.42594254f, 0.339184076f},
-std::array<float,2>{0.577069819f, 0.621000946f},
-std::array<float,2>{0.11197608f, 0.856884897f},
-std::array<float,2>{0.842909217f, 0.0788619295f},
-std::array<float,2>{0.179526165f, 0.210059941f},
-std::array<float,2>{0.97700572f, 0.978320181f},
-std::array<float,2>{0.25804016f, 0.628883123f},
-std::array<float,2>{0.701506078f, 0.42287159f},
-std::array<float,2>{0.0243525859f, 0.46220234f},
-std::array<float,2>{0.774338901f, 0.717599928f},
-std::array<float,2>{0.481259823f, 0.886289179f},
-std::array<float,2>{0.511261821f, 0.146123499f},
-std::array<float,2>{0.327836603f, 0.0409587175f},
-std::array<float,2>{0.664578855f, 0.755202472f},
-std::array<float,2>{0.204689339f, 0.51351583f},
-std::array<float,2>{0.912240446f, 0.306724966f},
-std::array<float,2>{0.29588607f, 0.403775871f},
-std::array<float,2>{0.748914123f, 0.682451069f},
-std::array<float,2>{0.146151677f, 0.968366623f},
-std::array<float,2>{0.942347229f, 0.237339258f},
-std::array<float,2>{0.0814722627f, 0.106626667f},
-std::array<float,2>{0.871712506f, 0.818960905f},
-std::array<float,2>{0.381341934f, 0.577361584f},
-std::array<float,2>{0.605523944f, 0.35390228f},
-std::array<float,2>{0.249845266f, 0.271858633f},
-std::array<float,2>{0.881843269f, 0.543295264f},
-std::array<float,2>{0.346067637f, 0.803663254f},
-std::array<float,2>{0.65194422f, 0.0261503141f},
-std::array<float,2>{0.446083426f, 0.180442423f},
-std::array<float,2>{0.544942141f, 0.920935273f},
-std::array<float,2>{0.0335128792f, 0.743643105f},
-std::array<float,2>{0.784771979f, 0.477390796f},
-std::array<float,2>{0.414007753f, 0.454927504f},
-std::array<float,2>{0.592644811f, 0.708090365f},
-std::array<float,2>{0.103504568f, 0.876322865f},
-std::array<float,2>{0.822587669f, 0.155535445f},
-std::array<float,2>{0.157473281f, 0.0372551084f},
-std::array<float,2>{0.992057621f, 0.761491656f},
-std::array<float,2>{0.267136753f, 0.503820539f},
-std::array<float,2>{0.717212439f, 0.301821917f},
-std::array<float,2>{0.000193162618f, 0.33393684f},
-std::array<float,2>{0.752561331f, 0.614399731f},
-std::array<float,2>{0.498191684f, 0.851358533f},
-std::array<float,2>{0.524055064f, 0.0923888311f},
-std::array<float,2>{0.332458884f, 0.214729339f},
-std::array<float,2>{0.677813768f, 0.970918f},
-std::array<float,2>{0.203111887f, 0.639869511f},
-std::array<float,2>{0.93239373f, 0.434455603f},
-std::array<float,2>{0.30733487f, 0.279517919f},
-std::array<float,2>{0.728786111f, 0.53197974f},
-std::array<float,2>{0.127866f, 0.806330144f},
-std::array<float,2>{0.96108216f, 0.0162538905f},
-std::array<float,2>{0.065604791f, 0.177101523f},
-std::array<float,2>{0.856651545f, 0.912134647f},
-std::array<float,2>{0.403829813f, 0.735198975f},
-std::array<float,2>{0.623459935f, 0.474275976f},
-std::array<float,2>{0.225417539f, 0.391973883f},
-std::array<float,2>{0.901587784f, 0.674700439f},
-std::array<float,2>{0.362808138f, 0.9587726f},
-std::array<float,2>{0.636465609f, 0.244914979f},
-std::array<float,2>{0.461628318f, 0.0967158154f},
-std::array<float,2>{0.553690434f, 0.821040928f},
-std::array<float,2>{0.0478630103f, 0.570164979f},
-std::array<float,2>{0.811630726f, 0.344018728f},
-std::array<float,2>{0.476848811f, 0.37232995f},
-std::array<float,2>{0.511912644f, 0.583434463f},
-std::array<float,2>{0.0288575888f, 0.835928023f},
-std::array<float,2>{0.77923727f, 0.119964622f},
-std::array<float,2>{0.209047034f, 0.225620195f},
-std::array<float,2>{0.906775415f, 0.952782273f},
-std::array<float,2>{0.320825428f, 0.660203516f},
-std::array<float,2>{0.670428157f, 0.37707752f},
-std::array<float,2>{0.11668212f, 0.491411895f},
-std::array<float,2>{0.836363196f, 0.720410287f},
-std::array<float,2>{0.422093183f, 0.926618099f},
-std::array<float,2>{0.572146058f, 0.166967064f},
-std::array<float,2>{0.263980597f, 0.0091533307f},
-std::array<float,2>{0.696259797f, 0.784435749f},
-std::array<float,2>{0.172920406f, 0.555473268f},
-std::array<float,2>{0.98095721f, 0.257376939f},
-std::array<float,2>{0.351439953f, 0.410372913f},
-std::array<float,2>{0.65309006f, 0.652952313f},
-std::array<float,2>{0.244643047f, 0.997540176f},
-std::array<float,2>{0.875192463f, 0.193362787f},
-std::array<float,2>{0.0389790535f, 0.0757736564f},
-std::array<float,2>{0.788108826f, 0.85945487f},
-std::array<float,2>{0.451319098f, 0.608412683f},
-std::array<float,2>{0.542460084f, 0.312916636f},
-std::array<float,2>{0.14099741f, 0.285212547f},
-std::array<float,2>{0.940068662f, 0.516205907f},
-std::array<float,2>{0.290004313f, 0.780218482f},
-std::array<float,2>{0.742227912f, 0.0619925261f},
-std::array<float,2>{0.376457185f, 0.134102002f},
-std::array<float,2>{0.602748215f, 0.901797891f},
-std::array<float,2>{0.08425349f, 0.701497614f},
-std::array<float,2>{0.869263947f, 0.446444273f},
-std::array<float,2>{0.439865291f, 0.382904887f},
-std::array<float,2>{0.531530857f, 0.667229712f},
-std::array<float,2>{0.0394165441f, 0.939450443f},
-std::array<float,2>{0.792708099f, 0.229103804f},
-std::array<float,2>{0.236958101f, 0.114901267f},
-std::array<float,2>{0.888669729f, 0.839847267f},
-std::array<float,2>{0.353199065f, 0.589317203f},
-std::array<float,2>{0.647897661f, 0.364296794f},
-std::array<float,2>{0.091985777f, 0.261453778f},
-std::array<float,2>{0.863007069f, 0.548520565f},
-std::array<float,2>{0.388891578f, 0.794727981f},
-std::array<float,2>{0.598602235f, 0.00263087475f},
-std::array<float,2>{0.287614971f, 0.161584944f},
-std::array<float,2>{0.735678613f, 0.935734034f},
-std::array<float,2>{0.155262575f, 0.732031941f},
-std::array<float,2>{0.949072778f, 0.499459684f},
-std::array<float,2>{0.320224553f, 0.328087032f},
-std::array<float,2>{0.659946203f, 0.601032972f},
-std::array<float,2>{0.212523878f, 0.868037879f},
-std::array<float,2>{0.915668249f, 0.0655009523f},
-std::array<float,2>{0.0160827469f, 0.198163718f},
-std::array<float,2>{0.770412147f, 0.98701185f},
-std::array<float,2>{0.471711218f, 0.642759919f},
-std::array<float,2>{0.503819108f, 0.417207807f},
-std::array<float,2>{0.187407449f, 0.444004476f},
-std::array<float,2>{0.972079933f, 0.69229126f},
-std::array<float,2>{0.253231138f, 0.891949952f},
-std::array<float,2>{0.688949704f, 0.128857374f},
-std::array<float,2>{0.432147503f, 0.0526207238f},
-std::array<float,2>{0.569183826f, 0.771326303f},
-std::array<float,2>{0.117255084f, 0.531145275f},
-std::array<float,2>{0.833600998f, 0.292500257f},
-std::array<float,2>{0.390679538f, 0.31032759f},
-std::array<float,2>{0.613013566f, 0.510896504f},
-std::array<float,2>{0.0711093247f, 0.750116169f},
-std::array<float,2>{0.846138418f, 0.0447988063f},
-std::array<float,2>{0.13296847f, 0.14450638f},
-std::array<float,2>{0.960066438f, 0.889995456f},
-std::array<float,2>{0.298816502f, 0.713559508f},
-std::array<float,2>{0.71959126f, 0.468413591f},
-std::array<float,2>{0.0615661815f, 0.429597408f},
-std::array<float,2>{0.803291678f, 0.62894547f},
-std::array<float,2>{0.458721936f, 0.983353019f},
-std::array<float,2>{0.55520761f, 0.203905612f},
-std::array<float,2>{0.37157169f, 0.0849965066f},
-std::array<float,2>{0.626375616f, 0.854095042f},
-std::array<float,2>{0.231313124f, 0.621198714f},
-std::array<float,2>{0.8907637f, 0.343214452f},
-std::array<float,2>{0.274446905f, 0.481575698f},
-std::array<float,2>{0.709869683f, 0.749267042f},
-std::array<float,2>{0.169807494f, 0.915206552f},
-std::array<float,2>{0.997727215f, 0.183805361f},
-std::array<float,2>{0.100226797f, 0.0288993455f},
-std::array<float,2>{0.818721354f, 0.797231734f},
-std::array<float,2>{0.415237129f, 0.542267621f},
-std::array<float,2>{0.585884452f, 0.268338501f},
-std::array<float,2>{0.188394785f, 0.357651323f},
-std::array<float,2>{0.925597548f, 0.572676241f},
-std::array<float,2>{0.340270609f, 0.816319525f},
-std::array<float,2>{0.685173452f, 0.103424288f},
-std::array<float,2>{0.48619023f, 0.240033701f},
-std::array<float,2>{0.517566979f, 0.96449703f},
-std::array<float,2>{0.0138449846f, 0.686313212f},
-std::array<float,2>{0.763143718f, 0.399692267f},
-std::array<float,2>{0.436656117f, 0.395479679f},
-std::array<float,2>{0.563924074f, 0.677897811f},
-std::array<float,2>{0.124915913f, 0.954996943f},
-std::array<float,2>{0.831155896f, 0.246490881f},
-std::array<float,2>{0.182143435f, 0.0986096263f},
-std::array<float,2>{0.972801089f, 0.827733219f},
-std::array<float,2>{0.257773042f, 0.566309571f},
-std::array<float,2>{0.695106983f, 0.348894417f},
-std::array<float,2>{0.0208990052f, 0.275645137f},
-std::array<float,2>{0.767954648f, 0.535901189f},
-std::array<float,2>{0.475016862f, 0.809295714f},
-std::array<float,2>{0.504784644f, 0.0232065562f},
-std::array<float,2>{0.316349924f, 0.175102234f},
-std::array<float,2>{0.660302341f, 0.906542718f},
-std::array<float,2>{0.215392992f, 0.738943815f},
-std::array<float,2>{0.918464959f, 0.470953822f},
-std::array<float,2>{0.284585267f, 0.329825252f},
-std::array<float,2>{0.739172995f, 0.611712933f},
-std::array<float,2>{0.151872084f, 0.847339571f},
-std::array<float,2>{0.95025003f, 0.0879445896f},
-std::array<float,2>{0.0868712887f, 0.218684003f},
-std::array<float,2>{0.866125166f, 0.974786758f},
-std::array<float,2>{0.382820189f, 0.636119962f},
-std::array<float,2>{0.594045103f, 0.432092577f},
-std::array<float,2>{0.239644781f, 0.457926244f},
-std::array<float,2>{0.883891821f, 0.703780115f},
-std::array<float,2>{0.358681619f, 0.879267752f},
-std::array<float,2>{0.641145706f, 0.150180832f},
-std::array<float,2>{0.443331808f, 0.0349613205f},
-std::array<float,2>{0.536708117f, 0.764539719f},
-std::array<float,2>{0.0445175506f, 0.507358968f},
-std::array<float,2>{0.795053303f, 0.300645977f},
-std::array<float,2>{0.490028858f, 0.283089489f},
-std::array<float,2>{0.520148695f, 0.520859182f},
-std::array<float,2>{0.0084629897f, 0.776918769f},
-std::array<float,2>{0.757928193f, 0.0580272563f},
-std::array<float,2>{0.191583067f, 0.13799046f},
-std::array<float,2>{0.928240657f, 0.903592706f},
-std::array<float,2>{0.338536084f, 0.696486592f},
-std::array<float,2>{0.681486905f, 0.451133251f},
-std::array<float,2>{0.094205983f, 0.407025427f},
-std::array<float,2>{0.813313305f, 0.650779605f},
-std::array<float,2>{0.419269949f, 0.994053721f},
-std::array<float,2>{0.578649104f, 0.190381721f},
-std::array<float,2>{0.280253232f, 0.0731356665f},
-std::array<float,2>{0.705081403f, 0.866068006f},
-std::array<float,2>{0.166450918f, 0.605365634f},
-std::array<float,2>{0.99460572f, 0.319891363f},
-std::array<float,2>{0.369228601f, 0.484558612f},
-std::array<float,2>{0.630547285f, 0.72638768f},
-std::array<float,2>{0.228560433f, 0.921941638f},
-std::array<float,2>{0.896913171f, 0.169029117f},
-std::array<float,2>{0.056120418f, 0.0131991245f},
-std::array<float,2>{0.798782408f, 0.788894415f},
-std::array<float,2>{0.453809798f, 0.560907602f},
-std::array<float,2>{0.560250938f, 0.253547728f},
-std::array<float,2>{0.136939734f, 0.368831396f},
-std::array<float,2>{0.956431687f, 0.580793798f},
-std::array<float,2>{0.303130299f, 0.829151988f},
-std::array<float,2>{0.723640025f, 0.123214878f},
-std::array<float,2>{0.394618928f, 0.220160052f},
-std::array<float,2>{0.615090251f, 0.946490049f},
-std::array<float,2>{0.0742652714f, 0.656657338f},
-std::array<float,2>{0.848637938f, 0.379288286f},
-std::array<float,2>{0.467486948f, 0.438422263f},
-std::array<float,2>{0.547363341f, 0.690115452f},
-std::array<float,2>{0.0509660654f, 0.897298634f},
-std::array<float,2>{0.805876315f, 0.129092157f},
-std::array<float,2>{0.219618753f, 0.0469895564f},
-std::array<float,2>{0.90289402f, 0.76901406f},
-std::array<float,2>{0.367172748f, 0.525551856f},
-std::array<float,2>{0.6376912f, 0.293375432f},
-std::array<float,2>{0.0667199939f, 0.322021663f},
-std::array<float,2>{0.854153335f, 0.596929014f},
-std::array<float,2>{0.400077462f, 0.871238828f},
-std::array<float,2>{0.619617641f, 0.0686106458f},
-std::array<float,2>{0.309465766f, 0.19984068f},
-std::array<float,2>{0.732185066f, 0.989705324f},
-std::array<float,2>{0.130796716f, 0.644557416f},
-std::array<float,2>{0.965642154f, 0.421630174f},
-std::array<float,2>{0.331014097f, 0.264914066f},
-std::array<float,2>{0.672426999f, 0.553630352f},
-std::array<float,2>{0.19535467f, 0.790408552f},
-std::array<float,2>{0.935890496f, 0.00670401892f},
-std::array<float,2>{0.00452048331f, 0.156551868f},
-std::array<float,2>{0.756511271f, 0.930849433f},
-std::array<float,2>{0.496024072f, 0.727080524f},
-std::array<float,2>{0.527577281f, 0.494643301f},
-std::array<float,2>{0.163026899f, 0.387317061f},
-std::array<float,2>{0.9856022f, 0.667995214f},
-std::array<float,2>{0.269962907f, 0.942419946f},
-std::array<float,2>{0.712306798f, 0.232097432f},
-std::array<float,2>{0.40791297f, 0.110965922f},
-std::array<float,2>{0.58671385f, 0.839169085f},
-std::array<float,2>{0.108949952f, 0.592114449f},
-std::array<float,2>{0.827861786f, 0.361631364f},
-std::array<float,2>{0.37929073f, 0.351771235f},
-std::array<float,2>{0.607899606f, 0.57570231f},
-std::array<float,2>{0.078388676f, 0.816443443f},
-std::array<float,2>{0.873194873f, 0.108860642f},
-std::array<float,2>{0.14795734f, 0.234913215f},
-std::array<float,2>{0.944357216f, 0.965945482f},
-std::array<float,2>{0.294775575f, 0.681143165f},
-std::array<float,2>{0.74779135f, 0.406047165f},
-std::array<float,2>{0.0323219113f, 0.480350137f},
-std::array<float,2>{0.78265667f, 0.744529903f},
-std::array<float,2>{0.449194759f, 0.919350147f},
-std::array<float,2>{0.543433607f, 0.18201521f},
-std::array<float,2>{0.345676363f, 0.0241246764f},
-std::array<float,2>{0.649361253f, 0.801540077f},
-std::array<float,2>{0.246860996f, 0.546762764f},
-std::array<float,2>{0.879124105f, 0.26971513f},
-std::array<float,2>{0.26136905f, 0.425450683f},
-std::array<float,2>{0.700415611f, 0.625834227f},
-std::array<float,2>{0.176161706f, 0.979677379f},
-std::array<float,2>{0.979263484f, 0.208931252f},
-std::array<float,2>{0.109682009f, 0.0801982954f},
-std::array<float,2>{0.840615988f, 0.857812047f},
-std::array<float,2>{0.427929342f, 0.618379414f},
-std::array<float,2>{0.575409532f, 0.336895198f},
-std::array<float,2>{0.205630615f, 0.305618525f},
-std::array<float,2>{0.91096288f, 0.513801932f},
-std::array<float,2>{0.3244102f, 0.757392585f},
-std::array<float,2>{0.666024268f, 0.0424529836f},
-std::array<float,2>{0.483095765f, 0.1473791f},
-std::array<float,2>{0.509642541f, 0.88336432f},
-std::array<float,2>{0.0257768743f, 0.715331197f},
-std::array<float,2>{0.776030064f, 0.464399099f},
-std::array<float,2>{0.406170011f, 0.476204693f},
-std::array<float,2>{0.621924341f, 0.738221824f},
-std::array<float,2>{0.0643748194f, 0.911674082f},
-std::array<float,2>{0.859155238f, 0.178169802f},
-std::array<float,2>{0.126034066f, 0.0187714808f},
-std::array<float,2>{0.963278294f, 0.808184147f},
-std::array<float,2>{0.305697769f, 0.535046995f},
-std::array<float,2>{0.728383482f, 0.277513057f},
-std::array<float,2>{0.050680656f, 0.347343147f},
-std::array<float,2>{0.810061455f, 0.567464769f},
-std::array<float,2>{0.463372171f, 0.822882891f},
-std::array<float,2>{0.552072048f, 0.0942976847f},
-std::array<float,2>{0.359651476f, 0.242621273f},
-std::array<float,2>{0.634107471f, 0.960809112f},
-std::array<float,2>{0.222748175f, 0.673526406f},
-std::array<float,2>{0.90030086f, 0.393928945f},
-std::array<float,2>{0.268657148f, 0.30404675f},
-std::array<float,2>{0.71553731f, 0.500504553f},
-std::array<float,2>{0.159964338f, 0.758986592f},
-std::array<float,2>{0.989677966f, 0.0363029949f},
-std::array<float,2>{0.10542307f, 0.15263176f},
-std::array<float,2>{0.821582735f, 0.877829075f},
-std::array<float,2>{0.411310434f, 0.709917068f},
-std::array<float,2>{0.590746522f, 0.45624572f},
-std::array<float,2>{0.200919136f, 0.43659994f},
-std::array<float,2>{0.931016386f, 0.637405574f},
-std::array<float,2>{0.335319936f, 0.969520509f},
-std::array<float,2>{0.67685163f, 0.211145759f},
-std::array<float,2>{0.496764183f, 0.0916270912f},
-std::array<float,2>{0.526139557f, 0.848842263f},
-std::array<float,2>{0.00199327222f, 0.616755784f},
-std::array<float,2>{0.750541568f, 0.335158944f},
-std::array<float,2>{0.449589044f, 0.314769268f},
-std::array<float,2>{0.54089433f, 0.606081247f},
-std::array<float,2>{0.0355996042f, 0.861479163f},
-std::array<float,2>{0.78664273f, 0.0761956424f},
-std::array<float,2>{0.24232541f, 0.193204984f},
-std::array<float,2>{0.878454983f, 0.998312891f},
-std::array<float,2>{0.347858518f, 0.655192733f},
-std::array<float,2>{0.654975891f, 0.412171215f},
-std::array<float,2>{0.0834681392f, 0.448819399f},
-std::array<float,2>{0.868841529f, 0.699340522f},
-std::array<float,2>{0.377973914f, 0.899108052f},
-std::array<float,2>{0.603545249f, 0.136159405f},
-std::array<float,2>{0.291460752f, 0.0596649088f},
-std::array<float,2>{0.745353699f, 0.777364314f},
-std::array<float,2>{0.143969819f, 0.519387484f},
-std::array<float,2>{0.937682986f, 0.287260473f},
-std::array<float,2>{0.32240662f, 0.376175165f},
-std::array<float,2>{0.668302f, 0.662697792f},
-std::array<float,2>{0.208041012f, 0.94922626f},
-std::array<float,2>{0.909582913f, 0.223889604f},
-std::array<float,2>{0.0304760356f, 0.118177086f},
-std::array<float,2>{0.780748188f, 0.83358562f},
-std::array<float,2>{0.480266958f, 0.584644735f},
-std::array<float,2>{0.514611363f, 0.373611957f},
-std::array<float,2>{0.175288007f, 0.25478217f},
-std::array<float,2>{0.983728588f, 0.556793451f},
-std::array<float,2>{0.263219684f, 0.782297552f},
-std::array<float,2>{0.698392987f, 0.0102895414f},
-std::array<float,2>{0.424954712f, 0.165816903f},
-std::array<float,2>{0.572602689f, 0.928446829f},
-std::array<float,2>{0.114644073f, 0.721944988f},
-std::array<float,2>{0.839596808f, 0.489943445f},
-std::array<float,2>{0.469229847f, 0.414608449f},
-std::array<float,2>{0.500882149f, 0.64254725f},
-std::array<float,2>{0.0182353556f, 0.984719157f},
-std::array<float,2>{0.771596611f, 0.196471035f},
-std::array<float,2>{0.213751689f, 0.0635364205f},
-std::array<float,2>{0.916436732f, 0.870154917f},
-std::array<float,2>{0.318279922f, 0.598546207f},
-std::array<float,2>{0.658074915f, 0.325874984f},
-std::array<float,2>{0.119416185f, 0.289761573f},
-std::array<float,2>{0.83542484f, 0.528769195f},
-std::array<float,2>{0.43134287f, 0.772466719f},
-std::array<float,2>{0.566752195f, 0.054557018f},
-std::array<float,2>{0.251631856f, 0.126844704f},
-std::array<float,2>{0.690578282f, 0.893802702f},
-std::array<float,2>{0.1846845f, 0.694851577f},
-std::array<float,2>{0.969410837f, 0.441977829f},
-std::array<float,2>{0.354075044f, 0.36606127f},
-std::array<float,2>{0.646294057f, 0.587500036f},
-std::array<float,2>{0.235074937f, 0.842211425f},
-std::array<float,2>{0.890148461f, 0.116441749f},
-std::array<float,2>{0.0419944301f, 0.227479458f},
-std::array<float,2>{0.7892977f, 0.939816058f},
-std::array<float,2>{0.438668489f, 0.664135933f},
-std::array<float,2>{0.534132838f, 0.384936571f},
-std::array<float,2>{0.153865993f, 0.497763008f},
-std::array<float,2>{0.947162151f, 0.733954847f},
-std::array<float,2>{0.285222828f, 0.933685422f},
-std::array<float,2>{0.737939298f, 0.163846284f},
-std::array<float,2>{0.387946218f, 0.00122132711f},
-std::array<float,2>{0.601490915f, 0.796257317f},
-std::array<float,2>{0.091617614f, 0.549832225f},
-std::array<float,2>{0.860385895f, 0.257923573f},
-std::array<float,2>{0.417733639f, 0.266390532f},
-std::array<float,2>{0.583724618f, 0.540469289f},
-std::array<float,2>{0.0989759266f, 0.800187528f},
-std::array<float,2>{0.816767454f, 0.0295092929f},
-std::array<float,2>{0.170460641f, 0.18643257f},
-std::array<float,2>{0.999803066f, 0.916831732f},
-std::array<float,2>{0.275549263f, 0.746646047f},
-std::array<float,2>{0.708924294f, 0.484163016f},
-std::array<float,2>{0.0130019039f, 0.402192801f},
-std::array<float,2>{0.765095711f, 0.683757901f},
-std::array<float,2>{0.486484915f, 0.962763667f},
-std::array<float,2>{0.518437326f, 0.241973385f},
-std::array<float,2>{0.341967106f, 0.104884654f},
-std::array<float,2>{0.686833024f, 0.813837647f},
-std::array<float,2>{0.190415218f, 0.571233332f},
-std::array<float,2>{0.922587156f, 0.356352806f},
-std::array<float,2>{0.300124526f, 0.465689361f},
-std::array<float,2>{0.721872032f, 0.712093055f},
-std::array<float,2>{0.135155842f, 0.888257444f},
-std::array<float,2>{0.95721817f, 0.141550884f},
-std::array<float,2>{0.0730372667f, 0.045798026f},
-std::array<float,2>{0.845144272f, 0.753087819f},
-std::array<float,2>{0.393909425f, 0.507814646f},
-std::array<float,2>{0.611162961f, 0.31193766f},
-std::array<float,2>{0.232435465f, 0.340038866f},
-std::array<float,2>{0.893649459f, 0.624943852f},
-std::array<float,2>{0.373770505f, 0.8531183f},
-std::array<float,2>{0.627698362f, 0.083670795f},
-std::array<float,2>{0.460713267f, 0.206724241f},
-std::array<float,2>{0.556902826f, 0.981366932f},
-std::array<float,2>{0.0600846894f, 0.631170273f},
-std::array<float,2>{0.801596642f, 0.425930738f},
-std::array<float,2>{0.431434214f, 0.416957825f},
-std::array<float,2>{0.566437125f, 0.643956959f},
-std::array<float,2>{0.119244441f, 0.988187015f},
-std::array<float,2>{0.835066557f, 0.199084282f},
-std::array<float,2>{0.184942424f, 0.0652128235f},
-std::array<float,2>{0.969695449f, 0.868833125f},
-std::array<float,2>{0.251728296f, 0.599896133f},
-std::array<float,2>{0.690807998f, 0.32652092f},
-std::array<float,2>{0.0184582435f, 0.291892916f},
-std::array<float,2>{0.77176553f, 0.53014797f},
-std::array<float,2>{0.468753785f, 0.770073235f},
-std::array<float,2>{0.500501931f, 0.0512840487f},
-std::array<float,2>{0.318010062f, 0.126956746f},
-std::array<float,2>{0.657839119f, 0.890968621f},
-std::array<float,2>{0.213562414f, 0.693350494f},
-std::array<float,2>{0.916196465f, 0.444936514f},
-std::array<float,2>{0.285544604f, 0.364176482f},
-std::array<float,2>{0.738176703f, 0.588472962f},
-std::array<float,2>{0.154239923f, 0.841687381f},
-std::array<float,2>{0.947013259f, 0.113989852f},
-std::array<float,2>{0.0914146304f, 0.230087772f},
-std::array<float,2>{0.86073482f, 0.938223004f},
-std::array<float,2>{0.387712598f, 0.666496992f},
-std::array<float,2>{0.601198733f, 0.384644449f},
-std::array<float,2>{0.235179543f, 0.498563826f},
-std::array<float,2>{0.890500009f, 0.730790794f},
-std::array<float,2>{0.354354173f, 0.937443376f},
-std::array<float,2>{0.646047473f, 0.160600856f},
-std::array<float,2>{0.438953876f, 0.0036049136f},
-std::array<float,2>{0.533834338f, 0.793045521f},
-std::array<float,2>{0.0424104035f, 0.547789574f},
-std::array<float,2>{0.789369345f, 0.260621101f},
-std::array<float,2>{0.486786932f, 0.268923789f},
-std::array<float,2>{0.51825881f, 0.541503131f},
-std::array<float,2>{0.0128344502f, 0.797897696f},
-std::array<float,2>{0.764772773f, 0.0274011679f},
-std::array<float,2>{0.190061197f, 0.185273454f},
-std::array<float,2>{0.922701657f, 0.914381623f},
-std::array<float,2>{0.342169344f, 0.748366654f},
-std::array<float,2>{0.686544478f, 0.480578154f},
-std::array<float,2>{0.0988465026f, 0.398529649f},
-std::array<float,2>{0.816570342f, 0.687311172f},
-std::array<float,2>{0.417523831f, 0.963156998f},
-std::array<float,2>{0.583750427f, 0.238300011f},
-std::array<float,2>{0.275769591f, 0.102380238f},
-std::array<float,2>{0.708514929f, 0.815297782f},
-std::array<float,2>{0.17076911f, 0.573729753f},
-std::array<float,2>{0.999673963f, 0.358821213f},
-std::array<float,2>{0.37388429f, 0.467079192f},
-std::array<float,2>{0.62768048f, 0.714657962f},
-std::array<float,2>{0.2327566f, 0.888693452f},
-std::array<float,2>{0.893879533f, 0.14264594f},
-std::array<float,2>{0.060330037f, 0.0431064181f},
-std::array<float,2>{0.801495135f, 0.751410544f},
-std::array<float,2>{0.460572958f, 0.510145366f},
-std::array<float,2>{0.556729734f, 0.309016556f},
-std::array<float,2>{0.134890333f, 0.342735946f},
-std::array<float,2>{0.957303405f, 0.622904956f},
-std::array<float,2>{0.299859911f, 0.854497135f},
-std::array<float,2>{0.722092867f, 0.0845829472f},
-std::array<float,2>{0.393691808f, 0.20422855f},
-std::array<float,2>{0.610902011f, 0.983776867f},
-std::array<float,2>{0.0728689656f, 0.630069554f},
-std::array<float,2>{0.844741762f, 0.428164095f},
-std::array<float,2>{0.462928504f, 0.472912848f},
-std::array<float,2>{0.551768184f, 0.735359669f},
-std::array<float,2>{0.0503527485f, 0.913944244f},
-std::array<float,2>{0.810452223f, 0.176033542f},
-std::array<float,2>{0.222921953f, 0.0172271132f},
-std::array<float,2>{0.900060177f, 0.805081129f},
-std::array<float,2>{0.359423459f, 0.532829702f},
-std::array<float,2>{0.633929312f, 0.280762613f},
-std::array<float,2>{0.0641848817f, 0.345291823f},
-std::array<float,2>{0.859125912f, 0.568815291f},
-std::array<float,2>{0.405944735f, 0.821318805f},
-std::array<float,2>{0.621700466f, 0.0966033489f},
-std::array<float,2>{0.305998415f, 0.245769829f},
-std::array<float,2>{0.728198051f, 0.957034588f},
-std::array<float,2>{0.126320601f, 0.674945891f},
-std::array<float,2>{0.963073075f, 0.391441107f},
-std::array<float,2>{0.335068852f, 0.301179826f},
-std::array<float,2>{0.677160442f, 0.50203532f},
-std::array<float,2>{0.201140776f, 0.760690868f},
-std::array<float,2>{0.930885732f, 0.038314335f},
-std::array<float,2>{0.00236657518f, 0.154379845f},
-std::array<float,2>{0.75091058f, 0.87506628f},
-std::array<float,2>{0.496893942f, 0.707286119f},
-std::array<float,2>{0.52593267f, 0.453608245f},
-std::array<float,2>{0.159811124f, 0.435119629f},
-std::array<float,2>{0.989487588f, 0.639573574f},
-std::array<float,2>{0.268899381f, 0.971939683f},
-std::array<float,2>{0.715808868f, 0.213491499f},
-std::array<float,2>{0.411481977f, 0.0932078585f},
-std::array<float,2>{0.590409696f, 0.849617779f},
-std::array<float,2>{0.105009936f, 0.614190876f},
-std::array<float,2>{0.821386158f, 0.332945198f},
-std::array<float,2>{0.378293902f, 0.313477546f},
-std::array<float,2>{0.603871346f, 0.60806936f},
-std::array<float,2>{0.0830871388f, 0.861012876f},
-std::array<float,2>{0.868966818f, 0.0744266137f},
-std::array<float,2>{0.143700838f, 0.194931209f},
-std::array<float,2>{0.937889755f, 0.996694446f},
-std::array<float,2>{0.291244507f, 0.653699756f},
-std::array<float,2>{0.745513499f, 0.411197186f},
-std::array<float,2>{0.0351669453f, 0.446150631f},
-std::array<float,2>{0.786870837f, 0.702785015f},
-std::array<float,2>{0.449359387f, 0.901103318f},
-std::array<float,2>{0.540750444f, 0.133038446f},
-std::array<float,2>{0.348021805f, 0.0606951751f},
-std::array<float,2>{0.655214608f, 0.781034768f},
-std::array<float,2>{0.242519423f, 0.517553389f},
-std::array<float,2>{0.878664851f, 0.286295831f},
-std::array<float,2>{0.263445169f, 0.378634632f},
-std::array<float,2>{0.698699534f, 0.661939383f},
-std::array<float,2>{0.175017938f, 0.95166254f},
-std::array<float,2>{0.983552158f, 0.225394204f},
-std::array<float,2>{0.114486083f, 0.120374151f},
-std::array<float,2>{0.839835525f, 0.834295273f},
-std::array<float,2>{0.425062686f, 0.582813919f},
-std::array<float,2>{0.572329938f, 0.371620119f},
-std::array<float,2>{0.208267868f, 0.256551743f},
-std::array<float,2>{0.909222007f, 0.556190908f},
-std::array<float,2>{0.322626024f, 0.783723295f},
-std::array<float,2>{0.668073237f, 0.00831049215f},
-std::array<float,2>{0.480038524f, 0.167493328f},
-std::array<float,2>{0.514312685f, 0.927189767f},
-std::array<float,2>{0.030709181f, 0.719698608f},
-std::array<float,2>{0.780404925f, 0.490792215f},
-std::array<float,2>{0.400231898f, 0.440951288f},
-std::array<float,2>{0.619347692f, 0.688858807f},
-std::array<float,2>{0.0665663257f, 0.89579922f},
-std::array<float,2>{0.854479253f, 0.131545737f},
-std::array<float,2>{0.130403444f, 0.0493101701f},
-std::array<float,2>{0.965504944f, 0.766376972f},
-std::array<float,2>{0.309290409f, 0.524403751f},
-std::array<float,2>{0.732170761f, 0.296815038f},
-std::array<float,2>{0.0512328856f, 0.323243409f},
-std::array<float,2>{0.806021452f, 0.59413749f},
-std::array<float,2>{0.467718363f, 0.873465657f},
-std::array<float,2>{0.547847807f, 0.068293184f},
-std::array<float,2>{0.36687234f, 0.201961637f},
-std::array<float,2>{0.637324035f, 0.991123855f},
-std::array<float,2>{0.219370931f, 0.647457957f},
-std::array<float,2>{0.903106332f, 0.418373227f},
-std::array<float,2>{0.269587636f, 0.262633562f},
-std::array<float,2>{0.711927652f, 0.550792754f},
-std::array<float,2>{0.162693426f, 0.792460203f},
-std::array<float,2>{0.985531509f, 0.00400059251f},
-std::array<float,2>{0.109306112f, 0.159739256f},
-std::array<float,2>{0.827900171f, 0.933491826f},
-std::array<float,2>{0.408023566f, 0.729571462f},
-std::array<float,2>{0.586580873f, 0.492316216f},
-std::array<float,2>{0.195666283f, 0.389176011f},
-std::array<float,2>{0.935740054f, 0.670032918f},
-std::array<float,2>{0.33069402f, 0.943918169f},
-std::array<float,2>{0.672620833f, 0.233065784f},
-std::array<float,2>{0.495770037f, 0.112825975f},
-std::array<float,2>{0.527795792f, 0.836013794f},
-std::array<float,2>{0.00469136471f, 0.590313017f},
-std::array<float,2>{0.756813765f, 0.359802186f},
-std::array<float,2>{0.44894594f, 0.355219156f},
-std::array<float,2>{0.543017745f, 0.576376975f},
-std::array<float,2>{0.0325262286f, 0.820236742f},
-std::array<float,2>{0.782417238f, 0.105682537f},
-std::array<float,2>{0.246712759f, 0.236986727f},
-std::array<float,2>{0.879275024f, 0.96707958f},
-std::array<float,2>{0.345415145f, 0.683224797f},
-std::array<float,2>{0.64894098f, 0.403093934f},
-std::array<float,2>{0.0782989636f, 0.478286296f},
-std::array<float,2>{0.873523235f, 0.74238652f},
-std::array<float,2>{0.378976166f, 0.920746624f},
-std::array<float,2>{0.607608914f, 0.181529671f},
-std::array<float,2>{0.294564784f, 0.0271786097f},
-std::array<float,2>{0.747810483f, 0.804274082f},
-std::array<float,2>{0.148400709f, 0.544245601f},
-std::array<float,2>{0.944658697f, 0.272683501f},
-std::array<float,2>{0.324682653f, 0.422409683f},
-std::array<float,2>{0.666455626f, 0.627361059f},
-std::array<float,2>{0.205980837f, 0.976911962f},
-std::array<float,2>{0.910799384f, 0.209793583f},
-std::array<float,2>{0.025599543f, 0.0792029127f},
-std::array<float,2>{0.776275933f, 0.855511785f},
-std::array<float,2>{0.483186722f, 0.619318783f},
-std::array<float,2>{0.509429574f, 0.33804816f},
-std::array<float,2>{0.175787732f, 0.308006197f},
-std::array<float,2>{0.979012847f, 0.511885881f},
-std::array<float,2>{0.261487395f, 0.75413096f},
-std::array<float,2>{0.700666726f, 0.0397084169f},
-std::array<float,2>{0.427995712f, 0.145266816f},
-std::array<float,2>{0.575487137f, 0.885111749f},
-std::array<float,2>{0.109468624f, 0.718141675f},
-std::array<float,2>{0.840551555f, 0.461864442f},
-std::array<float,2>{0.474776804f, 0.396950185f},
-std::array<float,2>{0.504576504f, 0.676573336f},
-std::array<float,2>{0.020545423f, 0.956606925f},
-std::array<float,2>{0.767612398f, 0.248833016f},
-std::array<float,2>{0.215798348f, 0.0998381674f},
-std::array<float,2>{0.918812752f, 0.824383438f},
-std::array<float,2>{0.315955102f, 0.562585115f},
-std::array<float,2>{0.660444558f, 0.349830985f},
-std::array<float,2>{0.124563411f, 0.274092197f},
-std::array<float,2>{0.831321895f, 0.53901118f},
-std::array<float,2>{0.436980128f, 0.812485814f},
-std::array<float,2>{0.563508987f, 0.0209490061f},
-std::array<float,2>{0.257330984f, 0.172264054f},
-std::array<float,2>{0.695042551f, 0.909405529f},
-std::array<float,2>{0.182571203f, 0.741510034f},
-std::array<float,2>{0.973014235f, 0.469680905f},
-std::array<float,2>{0.358523607f, 0.330670744f},
-std::array<float,2>{0.641395032f, 0.611299276f},
-std::array<float,2>{0.239382669f, 0.84406215f},
-std::array<float,2>{0.884174824f, 0.0877847075f},
-std::array<float,2>{0.0448674895f, 0.215916634f},
-std::array<float,2>{0.795227468f, 0.97268939f},
-std::array<float,2>{0.44303897f, 0.634635985f},
-std::array<float,2>{0.536912262f, 0.430647671f},
-std::array<float,2>{0.15225181f, 0.458994865f},
-std::array<float,2>{0.950614333f, 0.706095278f},
-std::array<float,2>{0.284386635f, 0.880887985f},
-std::array<float,2>{0.73884654f, 0.152259469f},
-std::array<float,2>{0.383227944f, 0.0323142521f},
-std::array<float,2>{0.593977213f, 0.762960792f},
-std::array<float,2>{0.0864901319f, 0.504074752f},
-std::array<float,2>{0.865819454f, 0.29728502f},
-std::array<float,2>{0.41899842f, 0.283322096f},
-std::array<float,2>{0.579003215f, 0.522092521f},
-std::array<float,2>{0.0938158259f, 0.774170876f},
-std::array<float,2>{0.813158274f, 0.0554346703f},
-std::array<float,2>{0.166151181f, 0.138904005f},
-std::array<float,2>{0.994156063f, 0.905455232f},
-std::array<float,2>{0.279923052f, 0.697880924f},
-std::array<float,2>{0.705477715f, 0.45248726f},
-std::array<float,2>{0.00863175746f, 0.408523083f},
-std::array<float,2>{0.758058131f, 0.648935437f},
-std::array<float,2>{0.489891052f, 0.994895399f},
-std::array<float,2>{0.520400882f, 0.188183442f},
-std::array<float,2>{0.33880052f, 0.0714959577f},
-std::array<float,2>{0.681313217f, 0.865093708f},
-std::array<float,2>{0.191853374f, 0.602772355f},
-std::array<float,2>{0.928569078f, 0.316887826f},
-std::array<float,2>{0.302909642f, 0.487587154f},
-std::array<float,2>{0.723898172f, 0.72459048f},
-std::array<float,2>{0.137031078f, 0.925026238f},
-std::array<float,2>{0.956234753f, 0.171780661f},
-std::array<float,2>{0.0746830776f, 0.0142893596f},
-std::array<float,2>{0.849016786f, 0.785756946f},
-std::array<float,2>{0.395017445f, 0.560167551f},
-std::array<float,2>{0.614850402f, 0.250949442f},
-std::array<float,2>{0.228771195f, 0.369211346f},
-std::array<float,2>{0.896701872f, 0.578941226f},
-std::array<float,2>{0.369390577f, 0.830751717f},
-std::array<float,2>{0.630626142f, 0.122192152f},
-std::array<float,2>{0.453936607f, 0.222060338f},
-std::array<float,2>{0.560472012f, 0.9480474f},
-std::array<float,2>{0.0558111742f, 0.65860337f},
-std::array<float,2>{0.798398674f, 0.380992651f},
-std::array<float,2>{0.389043897f, 0.386344284f},
-std::array<float,2>{0.598358929f, 0.665314436f},
-std::array<float,2>{0.0920635238f, 0.940669835f},
-std::array<float,2>{0.863084793f, 0.227584973f},
-std::array<float,2>{0.154831499f, 0.115850896f},
-std::array<float,2>{0.948814094f, 0.843334734f},
-std::array<float,2>{0.288034678f, 0.586340964f},
-std::array<float,2>{0.735370576f, 0.366419971f},
-std::array<float,2>{0.0392093919f, 0.258999974f},
-std::array<float,2>{0.792907715f, 0.549583912f},
-std::array<float,2>{0.439668268f, 0.79571563f},
-std::array<float,2>{0.531424224f, 0.000227339682f},
-std::array<float,2>{0.353381306f, 0.162256941f},
-std::array<float,2>{0.647527635f, 0.935345352f},
-std::array<float,2>{0.237206966f, 0.732539058f},
-std::array<float,2>{0.888231814f, 0.496975899f},
-std::array<float,2>{0.252962381f, 0.324724823f},
-std::array<float,2>{0.688570917f, 0.599206269f},
-std::array<float,2>{0.187114403f, 0.869704962f},
-std::array<float,2>{0.971697748f, 0.062862888f},
-std::array<float,2>{0.117613785f, 0.195523381f},
-std::array<float,2>{0.833821595f, 0.986305594f},
-std::array<float,2>{0.432572782f, 0.640889049f},
-std::array<float,2>{0.569014013f, 0.415361732f},
-std::array<float,2>{0.212757304f, 0.442654431f},
-std::array<float,2>{0.916001678f, 0.694024861f},
-std::array<float,2>{0.319896042f, 0.892795384f},
-std::array<float,2>{0.659748197f, 0.125593305f},
-std::array<float,2>{0.471970528f, 0.0528505482f},
-std::array<float,2>{0.503458142f, 0.772190273f},
-std::array<float,2>{0.0157126021f, 0.528282285f},
-std::array<float,2>{0.770233691f, 0.290983617f},
-std::array<float,2>{0.45897758f, 0.311435103f},
-std::array<float,2>{0.555454493f, 0.509701908f},
-std::array<float,2>{0.0617835782f, 0.752614796f},
-std::array<float,2>{0.803645074f, 0.046003975f},
-std::array<float,2>{0.230987012f, 0.142108932f},
-std::array<float,2>{0.890997767f, 0.887520611f},
-std::array<float,2>{0.3712551f, 0.711570621f},
-std::array<float,2>{0.626208603f, 0.466439366f},
-std::array<float,2>{0.0708367154f, 0.426941454f},
-std::array<float,2>{0.845867693f, 0.632428586f},
-std::array<float,2>{0.391020387f, 0.982388258f},
-std::array<float,2>{0.613059282f, 0.205410495f},
-std::array<float,2>{0.298412979f, 0.0822446346f},
-std::array<float,2>{0.719446838f, 0.851913273f},
-std::array<float,2>{0.133296356f, 0.623995841f},
-std::array<float,2>{0.96036154f, 0.340890706f},
-std::array<float,2>{0.339982092f, 0.482662857f},
-std::array<float,2>{0.685533524f, 0.747396946f},
-std::array<float,2>{0.188058212f, 0.91754508f},
-std::array<float,2>{0.925457716f, 0.186693937f},
-std::array<float,2>{0.0140813161f, 0.0306424629f},
-std::array<float,2>{0.762865305f, 0.798838079f},
-std::array<float,2>{0.485965461f, 0.539856374f},
-std::array<float,2>{0.517182291f, 0.267023802f},
-std::array<float,2>{0.169573322f, 0.357019961f},
-std::array<float,2>{0.997888923f, 0.572163999f},
-std::array<float,2>{0.274805546f, 0.812934041f},
-std::array<float,2>{0.709570587f, 0.103745617f},
-std::array<float,2>{0.415518999f, 0.240268111f},
-std::array<float,2>{0.585558116f, 0.961240828f},
-std::array<float,2>{0.100465707f, 0.684970319f},
-std::array<float,2>{0.818367898f, 0.400853366f},
-std::array<float,2>{0.498298198f, 0.455931634f},
-std::array<float,2>{0.524353683f, 0.710818648f},
-std::array<float,2>{0.000313353288f, 0.878047049f},
-std::array<float,2>{0.752791226f, 0.153466836f},
-std::array<float,2>{0.202642202f, 0.0355324075f},
-std::array<float,2>{0.932219684f, 0.758528054f},
-std::array<float,2>{0.332084537f, 0.501440644f},
-std::array<float,2>{0.678180873f, 0.302904755f},
-std::array<float,2>{0.103230916f, 0.334109902f},
-std::array<float,2>{0.822445869f, 0.616110861f},
-std::array<float,2>{0.413813293f, 0.848307729f},
-std::array<float,2>{0.592461586f, 0.0905195326f},
-std::array<float,2>{0.267412573f, 0.212738469f},
-std::array<float,2>{0.71681726f, 0.97066462f},
-std::array<float,2>{0.1572721f, 0.638019204f},
-std::array<float,2>{0.991767168f, 0.436072439f},
-std::array<float,2>{0.363051414f, 0.278965414f},
-std::array<float,2>{0.636498094f, 0.533505797f},
-std::array<float,2>{0.225244731f, 0.807399273f},
-std::array<float,2>{0.901629448f, 0.017950166f},
-std::array<float,2>{0.0482470207f, 0.179388255f},
-std::array<float,2>{0.81188947f, 0.910278022f},
-std::array<float,2>{0.46187678f, 0.736902595f},
-std::array<float,2>{0.553397238f, 0.474894851f},
-std::array<float,2>{0.127445981f, 0.393233299f},
-std::array<float,2>{0.961268723f, 0.672567189f},
-std::array<float,2>{0.307537079f, 0.959248185f},
-std::array<float,2>{0.728708267f, 0.243701413f},
-std::array<float,2>{0.404286861f, 0.0954467505f},
-std::array<float,2>{0.623134494f, 0.824217498f},
-std::array<float,2>{0.0657060444f, 0.567327738f},
-std::array<float,2>{0.856884599f, 0.345750511f},
-std::array<float,2>{0.422266513f, 0.374197036f},
-std::array<float,2>{0.572001159f, 0.585918486f},
-std::array<float,2>{0.116321616f, 0.832968473f},
-std::array<float,2>{0.836167216f, 0.11770764f},
-std::array<float,2>{0.173290834f, 0.223611206f},
-std::array<float,2>{0.981308043f, 0.950856149f},
-std::array<float,2>{0.263791651f, 0.663241327f},
-std::array<float,2>{0.695886195f, 0.375665545f},
-std::array<float,2>{0.0291998126f, 0.489114583f},
-std::array<float,2>{0.7790488f, 0.721168816f},
-std::array<float,2>{0.476607591f, 0.92923981f},
-std::array<float,2>{0.512141109f, 0.164769769f},
-std::array<float,2>{0.321080834f, 0.0114981346f},
-std::array<float,2>{0.670803547f, 0.781486571f},
-std::array<float,2>{0.209257379f, 0.558052242f},
-std::array<float,2>{0.907213926f, 0.255853534f},
-std::array<float,2>{0.289560348f, 0.413255364f},
-std::array<float,2>{0.742560506f, 0.656001151f},
-std::array<float,2>{0.140635103f, 0.999058485f},
-std::array<float,2>{0.94023627f, 0.191725165f},
-std::array<float,2>{0.084119156f, 0.0776851252f},
-std::array<float,2>{0.869393885f, 0.863263905f},
-std::array<float,2>{0.375990063f, 0.607375205f},
-std::array<float,2>{0.602784812f, 0.315479755f},
-std::array<float,2>{0.245058432f, 0.28818953f},
-std::array<float,2>{0.875378907f, 0.518219829f},
-std::array<float,2>{0.351209193f, 0.779227376f},
-std::array<float,2>{0.65300864f, 0.0586847216f},
-std::array<float,2>{0.451572239f, 0.135321572f},
-std::array<float,2>{0.542190254f, 0.899653316f},
-std::array<float,2>{0.0386724137f, 0.700438738f},
-std::array<float,2>{0.788448274f, 0.447950453f},
-std::array<float,2>{0.40970853f, 0.495693028f},
-std::array<float,2>{0.589411795f, 0.727546275f},
-std::array<float,2>{0.107381232f, 0.930014551f},
-std::array<float,2>{0.826034904f, 0.158094496f},
-std::array<float,2>{0.160981104f, 0.00700077694f},
-std::array<float,2>{0.987589717f, 0.789211631f},
-std::array<float,2>{0.272939205f, 0.553823411f},
-std::array<float,2>{0.714006722f, 0.263809681f},
-std::array<float,2>{0.00625790004f, 0.363182366f},
-std::array<float,2>{0.75551796f, 0.593174756f},
-std::array<float,2>{0.492699265f, 0.838117838f},
-std::array<float,2>{0.52953434f, 0.109921925f},
-std::array<float,2>{0.329236805f, 0.23061569f},
-std::array<float,2>{0.674085319f, 0.942145884f},
-std::array<float,2>{0.19800438f, 0.669864178f},
-std::array<float,2>{0.93518883f, 0.388383389f},
-std::array<float,2>{0.31067884f, 0.294222981f},
-std::array<float,2>{0.733934224f, 0.526697338f},
-std::array<float,2>{0.131837785f, 0.767734528f},
-std::array<float,2>{0.967193544f, 0.0479285046f},
-std::array<float,2>{0.0696395561f, 0.129925162f},
-std::array<float,2>{0.851709723f, 0.898086667f},
-std::array<float,2>{0.401958048f, 0.69059217f},
-std::array<float,2>{0.618116736f, 0.438877881f},
-std::array<float,2>{0.22113432f, 0.420628726f},
-std::array<float,2>{0.90474081f, 0.645950079f},
-std::array<float,2>{0.364901245f, 0.988292515f},
-std::array<float,2>{0.638932884f, 0.200619638f},
-std::array<float,2>{0.46585077f, 0.0698505566f},
-std::array<float,2>{0.550634444f, 0.872947276f},
-std::array<float,2>{0.0538542308f, 0.596390545f},
-std::array<float,2>{0.806644201f, 0.321241081f},
-std::array<float,2>{0.481093019f, 0.337128967f},
-std::array<float,2>{0.511621654f, 0.618149996f},
-std::array<float,2>{0.0239468217f, 0.858433485f},
-std::array<float,2>{0.774106979f, 0.0810869336f},
-std::array<float,2>{0.204914451f, 0.207593292f},
-std::array<float,2>{0.912585616f, 0.979316056f},
-std::array<float,2>{0.32796067f, 0.626332223f},
-std::array<float,2>{0.664899111f, 0.424076945f},
-std::array<float,2>{0.112156078f, 0.463653296f},
-std::array<float,2>{0.843222916f, 0.716553271f},
-std::array<float,2>{0.426074952f, 0.883989155f},
-std::array<float,2>{0.576876819f, 0.147718206f},
-std::array<float,2>{0.258174747f, 0.0419894233f},
-std::array<float,2>{0.701415837f, 0.756611824f},
-std::array<float,2>{0.179204702f, 0.515582263f},
-std::array<float,2>{0.976756454f, 0.305717558f},
-std::array<float,2>{0.345792949f, 0.404812336f},
-std::array<float,2>{0.652205169f, 0.680274963f},
-std::array<float,2>{0.249596566f, 0.965232432f},
-std::array<float,2>{0.882133186f, 0.235626906f},
-std::array<float,2>{0.0333894677f, 0.107483767f},
-std::array<float,2>{0.785091996f, 0.817528427f},
-std::array<float,2>{0.445979923f, 0.574481189f},
-std::array<float,2>{0.545351863f, 0.353176892f},
-std::array<float,2>{0.146319181f, 0.271078795f},
-std::array<float,2>{0.941981077f, 0.545721769f},
-std::array<float,2>{0.295573771f, 0.802006066f},
-std::array<float,2>{0.748697221f, 0.0245261863f},
-std::array<float,2>{0.380978972f, 0.183162093f},
-std::array<float,2>{0.605801344f, 0.918694735f},
-std::array<float,2>{0.0811970755f, 0.745628178f},
-std::array<float,2>{0.871884286f, 0.478757709f},
-std::array<float,2>{0.443970144f, 0.432920456f},
-std::array<float,2>{0.538037956f, 0.634886384f},
-std::array<float,2>{0.0467286892f, 0.976052344f},
-std::array<float,2>{0.794893682f, 0.216814056f},
-std::array<float,2>{0.242136851f, 0.08924108f},
-std::array<float,2>{0.884960353f, 0.846088886f},
-std::array<float,2>{0.356980652f, 0.612633288f},
-std::array<float,2>{0.643841565f, 0.328882903f},
-std::array<float,2>{0.0882329196f, 0.299553841f},
-std::array<float,2>{0.864616811f, 0.506147921f},
-std::array<float,2>{0.385146797f, 0.765055835f},
-std::array<float,2>{0.596892774f, 0.0334274061f},
-std::array<float,2>{0.282250822f, 0.148544014f},
-std::array<float,2>{0.741218388f, 0.880274117f},
-std::array<float,2>{0.150219679f, 0.704763949f},
-std::array<float,2>{0.951995134f, 0.458717942f},
-std::array<float,2>{0.312883914f, 0.34840259f},
-std::array<float,2>{0.663527191f, 0.56509006f},
-std::array<float,2>{0.218346477f, 0.826889515f},
-std::array<float,2>{0.92024076f, 0.0987276509f},
-std::array<float,2>{0.0231668968f, 0.247494802f},
-std::array<float,2>{0.767125368f, 0.953779519f},
-std::array<float,2>{0.473968774f, 0.679657102f},
-std::array<float,2>{0.507739007f, 0.396028221f},
-std::array<float,2>{0.180591196f, 0.472572148f},
-std::array<float,2>{0.975395679f, 0.740082681f},
-std::array<float,2>{0.254627258f, 0.907675683f},
-std::array<float,2>{0.693197131f, 0.174370706f},
-std::array<float,2>{0.435474694f, 0.0217783451f},
-std::array<float,2>{0.565383554f, 0.809802651f},
-std::array<float,2>{0.121155515f, 0.53630048f},
-std::array<float,2>{0.829190493f, 0.277309954f},
-std::array<float,2>{0.397199571f, 0.252370775f},
-std::array<float,2>{0.616828263f, 0.562307894f},
-std::array<float,2>{0.0771227553f, 0.787708461f},
-std::array<float,2>{0.849646747f, 0.0120600415f},
-std::array<float,2>{0.139895618f, 0.168941185f},
-std::array<float,2>{0.954715669f, 0.923089087f},
-std::array<float,2>{0.30146566f, 0.725183725f},
-std::array<float,2>{0.724775434f, 0.485499799f},
-std::array<float,2>{0.0569832213f, 0.380336225f},
-std::array<float,2>{0.799004972f, 0.6581074f},
-std::array<float,2>{0.456584483f, 0.945934474f},
-std::array<float,2>{0.561625302f, 0.218802229f},
-std::array<float,2>{0.367784232f, 0.124469988f},
-std::array<float,2>{0.632396281f, 0.828186154f},
-std::array<float,2>{0.228130117f, 0.581670642f},
-std::array<float,2>{0.894697785f, 0.368051618f},
-std::array<float,2>{0.278419733f, 0.449643761f},
-std::array<float,2>{0.704181552f, 0.696078122f},
-std::array<float,2>{0.165214673f, 0.903143346f},
-std::array<float,2>{0.993593156f, 0.137174308f},
-std::array<float,2>{0.0960443392f, 0.0568646453f},
-std::array<float,2>{0.816361427f, 0.775457263f},
-std::array<float,2>{0.421631187f, 0.520335615f},
-std::array<float,2>{0.581256151f, 0.281422108f},
-std::array<float,2>{0.193756655f, 0.31849581f},
-std::array<float,2>{0.926190794f, 0.603933215f},
-std::array<float,2>{0.336272091f, 0.867132902f},
-std::array<float,2>{0.682898164f, 0.0737529919f},
-std::array<float,2>{0.491506904f, 0.190777332f},
-std::array<float,2>{0.522840798f, 0.992483318f},
-std::array<float,2>{0.0107376669f, 0.651727498f},
-std::array<float,2>{0.76056093f, 0.407444388f},
-std::array<float,2>{0.39203614f, 0.428857118f},
-std::array<float,2>{0.61170274f, 0.629395008f},
-std::array<float,2>{0.0716639161f, 0.982870519f},
-std::array<float,2>{0.846901178f, 0.203363538f},
-std::array<float,2>{0.134130865f, 0.0855995938f},
-std::array<float,2>{0.9596048f, 0.853772998f},
-std::array<float,2>{0.29771474f, 0.621993244f},
-std::array<float,2>{0.719890654f, 0.34362042f},
-std::array<float,2>{0.0614099167f, 0.30986625f},
-std::array<float,2>{0.803864241f, 0.511459172f},
-std::array<float,2>{0.457702935f, 0.750743747f},
-std::array<float,2>{0.556349754f, 0.043996349f},
-std::array<float,2>{0.372725844f, 0.143826723f},
-std::array<float,2>{0.625559092f, 0.890467346f},
-std::array<float,2>{0.232193768f, 0.712919176f},
-std::array<float,2>{0.892305911f, 0.468036741f},
-std::array<float,2>{0.273841411f, 0.358322591f},
-std::array<float,2>{0.710438609f, 0.5731529f},
-std::array<float,2>{0.168768913f, 0.815771878f},
-std::array<float,2>{0.996319592f, 0.102867641f},
-std::array<float,2>{0.101333752f, 0.239693269f},
-std::array<float,2>{0.819509685f, 0.96425885f},
-std::array<float,2>{0.414275527f, 0.685742676f},
-std::array<float,2>{0.584252357f, 0.399921656f},
-std::array<float,2>{0.188977838f, 0.482294589f},
-std::array<float,2>{0.924439967f, 0.749718487f},
-std::array<float,2>{0.34152323f, 0.915746808f},
-std::array<float,2>{0.683790207f, 0.184356228f},
-std::array<float,2>{0.485049635f, 0.0287939962f},
-std::array<float,2>{0.516207516f, 0.797764957f},
-std::array<float,2>{0.0149173578f, 0.542574883f},
-std::array<float,2>{0.761844516f, 0.268050909f},
-std::array<float,2>{0.440939724f, 0.260970116f},
-std::array<float,2>{0.532237768f, 0.548235774f},
-std::array<float,2>{0.0400482267f, 0.793966532f},
-std::array<float,2>{0.791508973f, 0.00239527621f},
-std::array<float,2>{0.238013536f, 0.161979556f},
-std::array<float,2>{0.887057364f, 0.936172485f},
-std::array<float,2>{0.351636589f, 0.731458127f},
-std::array<float,2>{0.647245228f, 0.499991089f},
-std::array<float,2>{0.0936975852f, 0.383422881f},
-std::array<float,2>{0.861692667f, 0.667702615f},
-std::array<float,2>{0.389947385f, 0.938492298f},
-std::array<float,2>{0.599456131f, 0.22890842f},
-std::array<float,2>{0.288866431f, 0.114408657f},
-std::array<float,2>{0.735119045f, 0.840659559f},
-std::array<float,2>{0.156220153f, 0.589601994f},
-std::array<float,2>{0.947553039f, 0.36495927f},
-std::array<float,2>{0.318725377f, 0.443654239f},
-std::array<float,2>{0.658889592f, 0.691564023f},
-std::array<float,2>{0.211030513f, 0.892500639f},
-std::array<float,2>{0.914392114f, 0.128308356f},
-std::array<float,2>{0.0167403445f, 0.0518081747f},
-std::array<float,2>{0.771092594f, 0.77074182f},
-std::array<float,2>{0.47137931f, 0.53050071f},
-std::array<float,2>{0.502815187f, 0.292264253f},
-std::array<float,2>{0.18571493f, 0.327465594f},
-std::array<float,2>{0.970794678f, 0.601388514f},
-std::array<float,2>{0.252913564f, 0.86727041f},
-std::array<float,2>{0.688251972f, 0.0661577731f},
-std::array<float,2>{0.433043629f, 0.19754374f},
-std::array<float,2>{0.569907486f, 0.986468732f},
-std::array<float,2>{0.118614972f, 0.643503368f},
-std::array<float,2>{0.832630515f, 0.417942166f},
-std::array<float,2>{0.477564782f, 0.492126316f},
-std::array<float,2>{0.513199508f, 0.719778419f},
-std::array<float,2>{0.0279659275f, 0.925802469f},
-std::array<float,2>{0.778111815f, 0.166405752f},
-std::array<float,2>{0.210560977f, 0.00972060207f},
-std::array<float,2>{0.907263279f, 0.784831047f},
-std::array<float,2>{0.321540594f, 0.554857552f},
-std::array<float,2>{0.671538711f, 0.25719294f},
-std::array<float,2>{0.115703672f, 0.372746527f},
-std::array<float,2>{0.83716011f, 0.583678484f},
-std::array<float,2>{0.422890872f, 0.835420966f},
-std::array<float,2>{0.570565581f, 0.119371645f},
-std::array<float,2>{0.265173346f, 0.22628817f},
-std::array<float,2>{0.696840882f, 0.952454507f},
-std::array<float,2>{0.172499999f, 0.660796881f},
-std::array<float,2>{0.981552899f, 0.377842844f},
-std::array<float,2>{0.350419879f, 0.285717249f},
-std::array<float,2>{0.654077291f, 0.515673637f},
-std::array<float,2>{0.245978117f, 0.779703438f},
-std::array<float,2>{0.876024485f, 0.06235715f},
-std::array<float,2>{0.0379924625f, 0.13438201f},
-std::array<float,2>{0.787421107f, 0.901910484f},
-std::array<float,2>{0.452308148f, 0.702040911f},
-std::array<float,2>{0.541111946f, 0.447048575f},
-std::array<float,2>{0.142518416f, 0.411131293f},
-std::array<float,2>{0.94124943f, 0.652821064f},
-std::array<float,2>{0.290125996f, 0.997959435f},
-std::array<float,2>{0.743942976f, 0.193869114f},
-std::array<float,2>{0.375097781f, 0.0752977133f},
-std::array<float,2>{0.602077365f, 0.860163033f},
-std::array<float,2>{0.0853251964f, 0.609288931f},
-std::array<float,2>{0.870717287f, 0.313325167f},
-std::array<float,2>{0.412386209f, 0.333179057f},
-std::array<float,2>{0.593008399f, 0.614790559f},
-std::array<float,2>{0.101830922f, 0.850957751f},
-std::array<float,2>{0.82358557f, 0.0921676308f},
-std::array<float,2>{0.156651527f, 0.214137509f},
-std::array<float,2>{0.990255594f, 0.971636891f},
-std::array<float,2>{0.266514748f, 0.640207648f},
-std::array<float,2>{0.718492746f, 0.433700949f},
-std::array<float,2>{0.0015770332f, 0.454327583f},
-std::array<float,2>{0.753087044f, 0.708520472f},
-std::array<float,2>{0.499440104f, 0.876788855f},
-std::array<float,2>{0.524975121f, 0.155876651f},
-std::array<float,2>{0.333420366f, 0.037671946f},
-std::array<float,2>{0.679332376f, 0.760776103f},
-std::array<float,2>{0.20211409f, 0.503077984f},
-std::array<float,2>{0.932721317f, 0.302655995f},
-std::array<float,2>{0.307970703f, 0.392371446f},
-std::array<float,2>{0.729619682f, 0.674066484f},
-std::array<float,2>{0.128511235f, 0.958099306f},
-std::array<float,2>{0.962644637f, 0.244227603f},
-std::array<float,2>{0.0646925792f, 0.0972132236f},
-std::array<float,2>{0.856049716f, 0.820380032f},
-std::array<float,2>{0.403069437f, 0.569782495f},
-std::array<float,2>{0.624251246f, 0.344436526f},
-std::array<float,2>{0.226086751f, 0.280198038f},
-std::array<float,2>{0.900700271f, 0.5314641f},
-std::array<float,2>{0.36158666f, 0.806032181f},
-std::array<float,2>{0.635505378f, 0.0157313477f},
-std::array<float,2>{0.462120831f, 0.177397087f},
-std::array<float,2>{0.554187298f, 0.913057745f},
-std::array<float,2>{0.0474207029f, 0.734423399f},
-std::array<float,2>{0.811198056f, 0.473800331f},
-std::array<float,2>{0.427056223f, 0.462834775f},
-std::array<float,2>{0.577716291f, 0.71688056f},
-std::array<float,2>{0.112494513f, 0.885999203f},
-std::array<float,2>{0.841989279f, 0.145904452f},
-std::array<float,2>{0.178434551f, 0.0400891416f},
-std::array<float,2>{0.978152215f, 0.755429447f},
-std::array<float,2>{0.259616345f, 0.513047874f},
-std::array<float,2>{0.702376664f, 0.307572126f},
-std::array<float,2>{0.025249904f, 0.339637905f},
-std::array<float,2>{0.774793625f, 0.620171428f},
-std::array<float,2>{0.481539726f, 0.857375145f},
-std::array<float,2>{0.510294139f, 0.0785218254f},
-std::array<float,2>{0.326456517f, 0.210887522f},
-std::array<float,2>{0.665704072f, 0.977821231f},
-std::array<float,2>{0.203338787f, 0.628202558f},
-std::array<float,2>{0.913703144f, 0.423700064f},
-std::array<float,2>{0.296262205f, 0.271990687f},
-std::array<float,2>{0.749743223f, 0.543719471f},
-std::array<float,2>{0.145087644f, 0.80316633f},
-std::array<float,2>{0.942786574f, 0.0255209077f},
-std::array<float,2>{0.0802299008f, 0.180150464f},
-std::array<float,2>{0.87288928f, 0.92161262f},
-std::array<float,2>{0.382080227f, 0.743921459f},
-std::array<float,2>{0.607230723f, 0.476782143f},
-std::array<float,2>{0.248957023f, 0.404043525f},
-std::array<float,2>{0.881070256f, 0.68165338f},
-std::array<float,2>{0.346984744f, 0.967858195f},
-std::array<float,2>{0.650875449f, 0.238131121f},
-std::array<float,2>{0.447262228f, 0.107030272f},
-std::array<float,2>{0.545904636f, 0.818671465f},
-std::array<float,2>{0.0342148617f, 0.578045487f},
-std::array<float,2>{0.783753276f, 0.354085445f},
-std::array<float,2>{0.493760616f, 0.360607862f},
-std::array<float,2>{0.530832767f, 0.591128051f},
-std::array<float,2>{0.007273647f, 0.837386549f},
-std::array<float,2>{0.75445348f, 0.112019099f},
-std::array<float,2>{0.198801622f, 0.234088883f},
-std::array<float,2>{0.934034586f, 0.944741547f},
-std::array<float,2>{0.329020411f, 0.671109438f},
-std::array<float,2>{0.674936056f, 0.38975215f},
-std::array<float,2>{0.105803534f, 0.493723005f},
-std::array<float,2>{0.825106442f, 0.728799641f},
-std::array<float,2>{0.408548683f, 0.932191133f},
-std::array<float,2>{0.588067651f, 0.158206582f},
-std::array<float,2>{0.271527439f, 0.00520127919f},
-std::array<float,2>{0.713196099f, 0.791124403f},
-std::array<float,2>{0.161884516f, 0.551792622f},
-std::array<float,2>{0.986730754f, 0.262768656f},
-std::array<float,2>{0.363425523f, 0.419497907f},
-std::array<float,2>{0.640387654f, 0.648224533f},
-std::array<float,2>{0.222494066f, 0.992098391f},
-std::array<float,2>{0.90529716f, 0.202518806f},
-std::array<float,2>{0.053440012f, 0.0668579787f},
-std::array<float,2>{0.807621181f, 0.874967456f},
-std::array<float,2>{0.46581158f, 0.595541835f},
-std::array<float,2>{0.54942137f, 0.323145181f},
-std::array<float,2>{0.130965695f, 0.295895547f},
-std::array<float,2>{0.968333244f, 0.525189877f},
-std::array<float,2>{0.311676621f, 0.766756833f},
-std::array<float,2>{0.732847393f, 0.0504743829f},
-std::array<float,2>{0.400483102f, 0.132311165f},
-std::array<float,2>{0.618898511f, 0.895103216f},
-std::array<float,2>{0.0686960593f, 0.687626541f},
-std::array<float,2>{0.853497744f, 0.439674526f},
-std::array<float,2>{0.455286592f, 0.382324934f},
-std::array<float,2>{0.560592175f, 0.659534693f},
-std::array<float,2>{0.0584385358f, 0.949055433f},
-std::array<float,2>{0.800229967f, 0.221438751f},
-std::array<float,2>{0.226782978f, 0.121783413f},
-std::array<float,2>{0.896025658f, 0.831523657f},
-std::array<float,2>{0.368563801f, 0.579725683f},
-std::array<float,2>{0.631662607f, 0.370614558f},
-std::array<float,2>{0.0775825679f, 0.251177013f},
-std::array<float,2>{0.851082861f, 0.559129059f},
-std::array<float,2>{0.397622257f, 0.786374271f},
-std::array<float,2>{0.615722656f, 0.0155586302f},
-std::array<float,2>{0.301757902f, 0.170537069f},
-std::array<float,2>{0.726067722f, 0.923836589f},
-std::array<float,2>{0.13959609f, 0.72333318f},
-std::array<float,2>{0.953889787f, 0.487074196f},
-std::array<float,2>{0.337340117f, 0.318242699f},
-std::array<float,2>{0.681755483f, 0.60230124f},
-std::array<float,2>{0.195278808f, 0.86377883f},
-std::array<float,2>{0.926811993f, 0.0710403994f},
-std::array<float,2>{0.011354561f, 0.189074084f},
-std::array<float,2>{0.761542201f, 0.995267272f},
-std::array<float,2>{0.490700841f, 0.649454653f},
-std::array<float,2>{0.521926343f, 0.409508914f},
-std::array<float,2>{0.164778188f, 0.451360285f},
-std::array<float,2>{0.992833972f, 0.698499203f},
-std::array<float,2>{0.278090775f, 0.904866397f},
-std::array<float,2>{0.70323509f, 0.13996166f},
-std::array<float,2>{0.420552731f, 0.0563699566f},
-std::array<float,2>{0.580211699f, 0.774866045f},
-std::array<float,2>{0.0968619958f, 0.523363948f},
-std::array<float,2>{0.814595878f, 0.284509242f},
-std::array<float,2>{0.38589412f, 0.298024178f},
-std::array<float,2>{0.595746756f, 0.505593956f},
-std::array<float,2>{0.0891561881f, 0.762128353f},
-std::array<float,2>{0.86369276f, 0.0317551792f},
-std::array<float,2>{0.148700655f, 0.150899261f},
-std::array<float,2>{0.952396929f, 0.882350683f},
-std::array<float,2>{0.28220883f, 0.705783606f},
-std::array<float,2>{0.741071463f, 0.460042953f},
-std::array<float,2>{0.0449727215f, 0.431034654f},
-std::array<float,2>{0.79312855f, 0.633081079f},
-std::array<float,2>{0.444791794f, 0.973772466f},
-std::array<float,2>{0.538349688f, 0.215550065f},
-std::array<float,2>{0.356391579f, 0.0861004069f},
-std::array<float,2>{0.642583013f, 0.845087826f},
-std::array<float,2>{0.240585089f, 0.609609246f},
-std::array<float,2>{0.886547029f, 0.331211537f},
-std::array<float,2>{0.255761623f, 0.470503986f},
-std::array<float,2>{0.692301095f, 0.741036296f},
-std::array<float,2>{0.181548357f, 0.908590972f},
-std::array<float,2>{0.975678325f, 0.173409209f},
-std::array<float,2>{0.12228369f, 0.0201580673f},
-std::array<float,2>{0.828273654f, 0.811074138f},
-std::array<float,2>{0.434384227f, 0.537572682f},
-std::array<float,2>{0.566091359f, 0.274593681f},
-std::array<float,2>{0.21734865f, 0.35061115f},
-std::array<float,2>{0.921245039f, 0.564250946f},
-std::array<float,2>{0.31360805f, 0.825556874f},
-std::array<float,2>{0.662459791f, 0.101224765f},
-std::array<float,2>{0.4727768f, 0.249568f},
-std::array<float,2>{0.506154239f, 0.955903709f},
-std::array<float,2>{0.0223682448f, 0.67736876f},
-std::array<float,2>{0.765651643f, 0.398222774f},
-std::array<float,2>{0.416934222f, 0.401648104f},
-std::array<float,2>{0.582607627f, 0.68409729f},
-std::array<float,2>{0.0985610262f, 0.962192774f},
-std::array<float,2>{0.817815959f, 0.241461903f},
-std::array<float,2>{0.171056449f, 0.105250016f},
-std::array<float,2>{0.998295963f, 0.81396693f},
-std::array<float,2>{0.276992559f, 0.570616007f},
-std::array<float,2>{0.707060277f, 0.355875969f},
-std::array<float,2>{0.0120767178f, 0.265960306f},
-std::array<float,2>{0.764621317f, 0.540541589f},
-std::array<float,2>{0.487673908f, 0.800504625f},
-std::array<float,2>{0.518642068f, 0.0298837572f},
-std::array<float,2>{0.34301427f, 0.18583636f},
-std::array<float,2>{0.686393619f, 0.916083813f},
-std::array<float,2>{0.190732345f, 0.746511221f},
-std::array<float,2>{0.923813403f, 0.483683348f},
-std::array<float,2>{0.299588263f, 0.340377986f},
-std::array<float,2>{0.720837235f, 0.624227047f},
-std::array<float,2>{0.136120573f, 0.852896869f},
-std::array<float,2>{0.958442748f, 0.0834360793f},
-std::array<float,2>{0.0741281956f, 0.206128478f},
-std::array<float,2>{0.844319463f, 0.980514586f},
-std::array<float,2>{0.392887324f, 0.631749511f},
-std::array<float,2>{0.609390318f, 0.426331371f},
-std::array<float,2>{0.234238282f, 0.465064198f},
-std::array<float,2>{0.893205047f, 0.712601125f},
-std::array<float,2>{0.374031752f, 0.88817668f},
-std::array<float,2>{0.628251076f, 0.141069144f},
-std::array<float,2>{0.459302694f, 0.0452843942f},
-std::array<float,2>{0.55794847f, 0.753876209f},
-std::array<float,2>{0.058841642f, 0.508539677f},
-std::array<float,2>{0.802535236f, 0.312329054f},
-std::array<float,2>{0.47040683f, 0.289491206f},
-std::array<float,2>{0.501745284f, 0.528954566f},
-std::array<float,2>{0.0189594161f, 0.7729702f},
-std::array<float,2>{0.773383021f, 0.0539842173f},
-std::array<float,2>{0.21394521f, 0.126223654f},
-std::array<float,2>{0.917830586f, 0.89420718f},
-std::array<float,2>{0.31646505f, 0.694494009f},
-std::array<float,2>{0.656453967f, 0.441653997f},
-std::array<float,2>{0.121061556f, 0.414542824f},
-std::array<float,2>{0.834568381f, 0.641834855f},
-std::array<float,2>{0.429829031f, 0.985293508f},
-std::array<float,2>{0.567932963f, 0.197182298f},
-std::array<float,2>{0.250890881f, 0.0642337054f},
-std::array<float,2>{0.689854443f, 0.870894432f},
-std::array<float,2>{0.184348598f, 0.597796142f},
-std::array<float,2>{0.969874382f, 0.325618535f},
-std::array<float,2>{0.355011404f, 0.497325003f},
-std::array<float,2>{0.645296931f, 0.73358804f},
-std::array<float,2>{0.236113191f, 0.934355199f},
-std::array<float,2>{0.8889575f, 0.163104549f},
-std::array<float,2>{0.0416435562f, 0.00151467847f},
-std::array<float,2>{0.790182412f, 0.796630263f},
-std::array<float,2>{0.437901616f, 0.550424755f},
-std::array<float,2>{0.535152316f, 0.258595556f},
-std::array<float,2>{0.152800232f, 0.365405291f},
-std::array<float,2>{0.945732832f, 0.586974204f},
-std::array<float,2>{0.286697954f, 0.842495918f},
-std::array<float,2>{0.737165272f, 0.11687573f},
-std::array<float,2>{0.387476116f, 0.226741225f},
-std::array<float,2>{0.600102305f, 0.940129638f},
-std::array<float,2>{0.0907466263f, 0.664892793f},
-std::array<float,2>{0.859396815f, 0.385729313f},
-std::array<float,2>{0.45075649f, 0.448497385f},
-std::array<float,2>{0.539637506f, 0.699738562f},
-std::array<float,2>{0.0370342284f, 0.898695529f},
-std::array<float,2>{0.785267293f, 0.136457533f},
-std::array<float,2>{0.243215129f, 0.0603503957f},
-std::array<float,2>{0.877612174f, 0.777905822f},
-std::array<float,2>{0.349316508f, 0.518848538f},
-std::array<float,2>{0.656038404f, 0.287792444f},
-std::array<float,2>{0.082797043f, 0.315349519f},
-std::array<float,2>{0.86743921f, 0.605650783f},
-std::array<float,2>{0.377674669f, 0.861834407f},
-std::array<float,2>{0.605447233f, 0.076754801f},
-std::array<float,2>{0.292160094f, 0.192422166f},
-std::array<float,2>{0.744540811f, 0.99885869f},
-std::array<float,2>{0.142661646f, 0.654591262f},
-std::array<float,2>{0.939221621f, 0.412998855f},
-std::array<float,2>{0.323985577f, 0.253983736f},
-std::array<float,2>{0.66947633f, 0.557525873f},
-std::array<float,2>{0.207726434f, 0.782842577f},
-std::array<float,2>{0.909087718f, 0.0102133183f},
-std::array<float,2>{0.0301605742f, 0.165218368f},
-std::array<float,2>{0.779755235f, 0.927842915f},
-std::array<float,2>{0.47912088f, 0.72250998f},
-std::array<float,2>{0.515547872f, 0.489366412f},
-std::array<float,2>{0.174599126f, 0.376564115f},
-std::array<float,2>{0.982616425f, 0.662244022f},
-std::array<float,2>{0.262664855f, 0.949992955f},
-std::array<float,2>{0.698111534f, 0.224212661f},
-std::array<float,2>{0.424571663f, 0.118947074f},
-std::array<float,2>{0.573345363f, 0.833390176f},
-std::array<float,2>{0.114187784f, 0.584067762f},
-std::array<float,2>{0.838319361f, 0.373520821f},
-std::array<float,2>{0.4045344f, 0.347137213f},
-std::array<float,2>{0.622279465f, 0.568266749f},
-std::array<float,2>{0.0629491583f, 0.822562158f},
-std::array<float,2>{0.858311713f, 0.0940556824f},
-std::array<float,2>{0.125249252f, 0.242850825f},
-std::array<float,2>{0.964678824f, 0.959997535f},
-std::array<float,2>{0.304828286f, 0.673083305f},
-std::array<float,2>{0.727160215f, 0.394214869f},
-std::array<float,2>{0.0491686352f, 0.475745618f},
-std::array<float,2>{0.808918834f, 0.73734808f},
-std::array<float,2>{0.464267641f, 0.911264181f},
-std::array<float,2>{0.55079037f, 0.178531051f},
-std::array<float,2>{0.360975057f, 0.0193351414f},
-std::array<float,2>{0.632878304f, 0.807925642f},
-std::array<float,2>{0.224099383f, 0.534395456f},
-std::array<float,2>{0.898838162f, 0.277926356f},
-std::array<float,2>{0.268173814f, 0.437199563f},
-std::array<float,2>{0.716391206f, 0.637106836f},
-std::array<float,2>{0.158838809f, 0.968924165f},
-std::array<float,2>{0.988498032f, 0.211827382f},
-std::array<float,2>{0.103774361f, 0.0908303782f},
-std::array<float,2>{0.821195781f, 0.849342048f},
-std::array<float,2>{0.41017437f, 0.616614878f},
-std::array<float,2>{0.591538012f, 0.335512757f},
-std::array<float,2>{0.199267328f, 0.304583013f},
-std::array<float,2>{0.930504262f, 0.500298321f},
-std::array<float,2>{0.33456111f, 0.759346664f},
-std::array<float,2>{0.675851762f, 0.0369467735f},
-std::array<float,2>{0.49714449f, 0.153304398f},
-std::array<float,2>{0.527027786f, 0.877334237f},
-std::array<float,2>{0.00345865241f, 0.709427238f},
-std::array<float,2>{0.751516223f, 0.456722587f},
-std::array<float,2>{0.380009413f, 0.479612857f},
-std::array<float,2>{0.609370887f, 0.745023549f},
-std::array<float,2>{0.0794237033f, 0.919830263f},
-std::array<float,2>{0.874504805f, 0.182549417f},
-std::array<float,2>{0.146731511f, 0.0235568881f},
-std::array<float,2>{0.944078147f, 0.80102241f},
-std::array<float,2>{0.293326557f, 0.546164513f},
-std::array<float,2>{0.746203065f, 0.270123005f},
-std::array<float,2>{0.031271562f, 0.352286011f},
-std::array<float,2>{0.781859756f, 0.575409651f},
-std::array<float,2>{0.448206693f, 0.817366481f},
-std::array<float,2>{0.543991566f, 0.109230712f},
-std::array<float,2>{0.344281703f, 0.234725535f},
-std::array<float,2>{0.649729669f, 0.966625988f},
-std::array<float,2>{0.247550473f, 0.681343138f},
-std::array<float,2>{0.880836666f, 0.405401736f},
-std::array<float,2>{0.260127157f, 0.305132747f},
-std::array<float,2>{0.69970274f, 0.51424998f},
-std::array<float,2>{0.176875189f, 0.757121742f},
-std::array<float,2>{0.979589224f, 0.0426090993f},
-std::array<float,2>{0.110679276f, 0.14677164f},
-std::array<float,2>{0.841724813f, 0.883221745f},
-std::array<float,2>{0.428752184f, 0.715572655f},
-std::array<float,2>{0.575030088f, 0.463888258f},
-std::array<float,2>{0.206571802f, 0.42517966f},
-std::array<float,2>{0.911348522f, 0.625108719f},
-std::array<float,2>{0.326061279f, 0.980199933f},
-std::array<float,2>{0.667592704f, 0.208378926f},
-std::array<float,2>{0.483875394f, 0.0807049796f},
-std::array<float,2>{0.508193731f, 0.858364701f},
-std::array<float,2>{0.0272685699f, 0.618944883f},
-std::array<float,2>{0.777033448f, 0.336100101f},
-std::array<float,2>{0.468684107f, 0.321618974f},
-std::array<float,2>{0.548083246f, 0.597410321f},
-std::array<float,2>{0.0522343814f, 0.871667624f},
-std::array<float,2>{0.805289567f, 0.0691414773f},
-std::array<float,2>{0.220658615f, 0.199435487f},
-std::array<float,2>{0.903435886f, 0.990133643f},
-std::array<float,2>{0.365361273f, 0.645162523f},
-std::array<float,2>{0.637933969f, 0.421273649f},
-std::array<float,2>{0.0678886622f, 0.437670261f},
-std::array<float,2>{0.855025828f, 0.689706683f},
-std::array<float,2>{0.398981899f, 0.896763682f},
-std::array<float,2>{0.620488882f, 0.129569203f},
-std::array<float,2>{0.30989483f, 0.0477190129f},
-std::array<float,2>{0.730534554f, 0.769510031f},
-std::array<float,2>{0.129291356f, 0.526070416f},
-std::array<float,2>{0.966362298f, 0.293666452f},
-std::array<float,2>{0.331525803f, 0.387062579f},
-std::array<float,2>{0.673797131f, 0.668878853f},
-std::array<float,2>{0.197188318f, 0.943122387f},
-std::array<float,2>{0.936971784f, 0.231726408f},
-std::array<float,2>{0.00500026112f, 0.110641755f},
-std::array<float,2>{0.757418156f, 0.839575171f},
-std::array<float,2>{0.494322807f, 0.592341304f},
-std::array<float,2>{0.528644264f, 0.362073332f},
-std::array<float,2>{0.163570017f, 0.265331358f},
-std::array<float,2>{0.9850474f, 0.552763402f},
-std::array<float,2>{0.271468371f, 0.790557623f},
-std::array<float,2>{0.711136341f, 0.00588760292f},
-std::array<float,2>{0.406383723f, 0.157084227f},
-std::array<float,2>{0.58722508f, 0.931174695f},
-std::array<float,2>{0.107829392f, 0.726625979f},
-std::array<float,2>{0.826600194f, 0.494408011f},
-std::array<float,2>{0.489253908f, 0.406459302f},
-std::array<float,2>{0.521149635f, 0.65107578f},
-std::array<float,2>{0.00971894711f, 0.993568122f},
-std::array<float,2>{0.75936693f, 0.189693078f},
-std::array<float,2>{0.193170473f, 0.0726081133f},
-std::array<float,2>{0.929564178f, 0.865336061f},
-std::array<float,2>{0.339077353f, 0.604947805f},
-std::array<float,2>{0.680407405f, 0.319694161f},
-std::array<float,2>{0.0947290286f, 0.282479346f},
-std::array<float,2>{0.814054489f, 0.521030426f},
-std::array<float,2>{0.418223113f, 0.776576817f},
-std::array<float,2>{0.579495668f, 0.0583763942f},
-std::array<float,2>{0.280981809f, 0.138434023f},
-std::array<float,2>{0.706078112f, 0.904072046f},
-std::array<float,2>{0.16717194f, 0.696916163f},
-std::array<float,2>{0.995672822f, 0.450296193f},
-std::array<float,2>{0.370198816f, 0.368221939f},
-std::array<float,2>{0.629197419f, 0.580192804f},
-std::array<float,2>{0.229894489f, 0.830013633f},
-std::array<float,2>{0.898380697f, 0.123910181f},
-std::array<float,2>{0.0551178455f, 0.220318899f},
-std::array<float,2>{0.797687531f, 0.946838617f},
-std::array<float,2>{0.454187125f, 0.657138228f},
-std::array<float,2>{0.558596551f, 0.37971735f},
-std::array<float,2>{0.138651878f, 0.48498863f},
-std::array<float,2>{0.955950618f, 0.725633204f},
-std::array<float,2>{0.304035187f, 0.92245996f},
-std::array<float,2>{0.723441899f, 0.169451535f},
-std::array<float,2>{0.395859033f, 0.0128590232f},
-std::array<float,2>{0.614077985f, 0.788157463f},
-std::array<float,2>{0.0760550648f, 0.561386347f},
-std::array<float,2>{0.8477332f, 0.253376454f},
-std::array<float,2>{0.436282605f, 0.276223511f},
-std::array<float,2>{0.563148797f, 0.535332382f},
-std::array<float,2>{0.123739593f, 0.808611453f},
-std::array<float,2>{0.830278873f, 0.0225549489f},
-std::array<float,2>{0.182924792f, 0.175527498f},
-std::array<float,2>{0.974558473f, 0.906819165f},
-std::array<float,2>{0.256015748f, 0.738416791f},
-std::array<float,2>{0.693634093f, 0.471571654f},
-std::array<float,2>{0.0198840126f, 0.394586235f},
-std::array<float,2>{0.769071758f, 0.67841655f},
-std::array<float,2>{0.475991428f, 0.954573214f},
-std::array<float,2>{0.505850375f, 0.246604502f},
-std::array<float,2>{0.315189004f, 0.0981193185f},
-std::array<float,2>{0.661174357f, 0.827554464f},
-std::array<float,2>{0.216222346f, 0.565678656f},
-std::array<float,2>{0.919160843f, 0.349588841f},
-std::array<float,2>{0.283534944f, 0.457066536f},
-std::array<float,2>{0.739480317f, 0.703168333f},
-std::array<float,2>{0.150569335f, 0.879559815f},
-std::array<float,2>{0.949778199f, 0.149571419f},
-std::array<float,2>{0.0870395452f, 0.0341894366f},
-std::array<float,2>{0.867136598f, 0.763688207f},
-std::array<float,2>{0.384300798f, 0.507164478f},
-std::array<float,2>{0.595662534f, 0.299852788f},
-std::array<float,2>{0.239204213f, 0.329131365f},
-std::array<float,2>{0.883170545f, 0.612193108f},
-std::array<float,2>{0.357448727f, 0.847120106f},
-std::array<float,2>{0.641794503f, 0.0886703134f},
-std::array<float,2>{0.442018241f, 0.218232274f},
-std::array<float,2>{0.53600508f, 0.975545526f},
-std::array<float,2>{0.0435620733f, 0.636519134f},
-std::array<float,2>{0.796642363f, 0.432363242f},
-std::array<float,2>{0.41080156f, 0.434293717f},
-std::array<float,2>{0.590963721f, 0.64000833f},
-std::array<float,2>{0.104218051f, 0.970986903f},
-std::array<float,2>{0.820314705f, 0.21451664f},
-std::array<float,2>{0.158470765f, 0.0926842317f},
-std::array<float,2>{0.989052355f, 0.851163387f},
-std::array<float,2>{0.268045276f, 0.614518106f},
-std::array<float,2>{0.716034234f, 0.333703995f},
-std::array<float,2>{0.00303974375f, 0.302167892f},
-std::array<float,2>{0.751247525f, 0.50350529f},
-std::array<float,2>{0.497724891f, 0.761430442f},
-std::array<float,2>{0.526696324f, 0.0375096016f},
-std::array<float,2>{0.334366709f, 0.155287251f},
-std::array<float,2>{0.676612318f, 0.875979125f},
-std::array<float,2>{0.199953437f, 0.708253384f},
-std::array<float,2>{0.930014491f, 0.454652399f},
-std::array<float,2>{0.305639863f, 0.343919873f},
-std::array<float,2>{0.72676146f, 0.570022106f},
-std::array<float,2>{0.125838086f, 0.821199298f},
-std::array<float,2>{0.964236498f, 0.0971182808f},
-std::array<float,2>{0.0630944893f, 0.244779661f},
-std::array<float,2>{0.857880175f, 0.95856899f},
-std::array<float,2>{0.405268669f, 0.674473703f},
-std::array<float,2>{0.622646511f, 0.391688347f},
-std::array<float,2>{0.224282593f, 0.474456757f},
-std::array<float,2>{0.898972094f, 0.734958708f},
-std::array<float,2>{0.360803813f, 0.912577808f},
-std::array<float,2>{0.633402348f, 0.176809579f},
-std::array<float,2>{0.464588702f, 0.0164575316f},
-std::array<float,2>{0.551368892f, 0.806547463f},
-std::array<float,2>{0.0493638068f, 0.532015324f},
-std::array<float,2>{0.809247315f, 0.279552191f},
-std::array<float,2>{0.478872806f, 0.257775694f},
-std::array<float,2>{0.515059888f, 0.555288136f},
-std::array<float,2>{0.029650731f, 0.784389198f},
-std::array<float,2>{0.780229986f, 0.009011521f},
-std::array<float,2>{0.207216993f, 0.166722611f},
-std::array<float,2>{0.908391297f, 0.926270366f},
-std::array<float,2>{0.323294938f, 0.720593214f},
-std::array<float,2>{0.669111013f, 0.491600484f},
-std::array<float,2>{0.11334233f, 0.377237558f},
-std::array<float,2>{0.838766158f, 0.66043824f},
-std::array<float,2>{0.424097985f, 0.952896178f},
-std::array<float,2>{0.574076295f, 0.225842178f},
-std::array<float,2>{0.262176245f, 0.119833648f},
-std::array<float,2>{0.697669923f, 0.835674167f},
-std::array<float,2>{0.17418766f, 0.583147466f},
-std::array<float,2>{0.982943535f, 0.372213364f},
-std::array<float,2>{0.348760724f, 0.446638286f},
-std::array<float,2>{0.655619204f, 0.701277971f},
-std::array<float,2>{0.243886501f, 0.901592255f},
-std::array<float,2>{0.877143383f, 0.133808136f},
-std::array<float,2>{0.0363662466f, 0.061647702f},
-std::array<float,2>{0.78598994f, 0.779952765f},
-std::array<float,2>{0.450350761f, 0.516545832f},
-std::array<float,2>{0.539169073f, 0.285604328f},
-std::array<float,2>{0.143531978f, 0.312559366f},
-std::array<float,2>{0.93884933f, 0.608665407f},
-std::array<float,2>{0.292757511f, 0.859697223f},
-std::array<float,2>{0.744998813f, 0.0759574622f},
-std::array<float,2>{0.376959324f, 0.193737954f},
-std::array<float,2>{0.604742408f, 0.997300684f},
-std::array<float,2>{0.0823831558f, 0.653219104f},
-std::array<float,2>{0.867827773f, 0.410562128f},
-std::array<float,2>{0.438319892f, 0.499064684f},
-std::array<float,2>{0.534622192f, 0.732329071f},
-std::array<float,2>{0.0412441045f, 0.935796738f},
-std::array<float,2>{0.790713429f, 0.161180124f},
-std::array<float,2>{0.235816032f, 0.00277361483f},
-std::array<float,2>{0.88959527f, 0.794501603f},
-std::array<float,2>{0.354741395f, 0.548667431f},
-std::array<float,2>{0.64456743f, 0.261570424f},
-std::array<float,2>{0.0903258771f, 0.364659905f},
-std::array<float,2>{0.859952629f, 0.589045644f},
-std::array<float,2>{0.387147129f, 0.84019208f},
-std::array<float,2>{0.600026846f, 0.114992075f},
-std::array<float,2>{0.286462724f, 0.229280233f},
-std::array<float,2>{0.736541629f, 0.939180672f},
-std::array<float,2>{0.152959764f, 0.667296529f},
-std::array<float,2>{0.945855379f, 0.383068562f},
-std::array<float,2>{0.316901535f, 0.29283002f},
-std::array<float,2>{0.656749964f, 0.530891716f},
-std::array<float,2>{0.21463275f, 0.771096528f},
-std::array<float,2>{0.917404771f, 0.0522624068f},
-std::array<float,2>{0.0193512142f, 0.128531143f},
-std::array<float,2>{0.772665322f, 0.891756237f},
-std::array<float,2>{0.469766557f, 0.692057133f},
-std::array<float,2>{0.501389384f, 0.44419387f},
-std::array<float,2>{0.18394345f, 0.417330265f},
-std::array<float,2>{0.970305443f, 0.64285171f},
-std::array<float,2>{0.250002623f, 0.987225115f},
-std::array<float,2>{0.690342665f, 0.197990447f},
-std::array<float,2>{0.430527747f, 0.0658646896f},
-std::array<float,2>{0.567593396f, 0.867722154f},
-std::array<float,2>{0.120512702f, 0.60067749f},
-std::array<float,2>{0.834280729f, 0.327814043f},
-std::array<float,2>{0.393177122f, 0.342977047f},
-std::array<float,2>{0.610115826f, 0.621472001f},
-std::array<float,2>{0.0736878514f, 0.854446113f},
-std::array<float,2>{0.844145834f, 0.0852393508f},
-std::array<float,2>{0.136440843f, 0.203716278f},
-std::array<float,2>{0.958528936f, 0.983066857f},
-std::array<float,2>{0.299272209f, 0.629361629f},
-std::array<float,2>{0.721457541f, 0.42932111f},
-std::array<float,2>{0.0593598634f, 0.468722522f},
-std::array<float,2>{0.801926017f, 0.713667333f},
-std::array<float,2>{0.459830761f, 0.889667571f},
-std::array<float,2>{0.558125257f, 0.144084632f},
-std::array<float,2>{0.374648541f, 0.0445804857f},
-std::array<float,2>{0.628674626f, 0.750341296f},
-std::array<float,2>{0.233647376f, 0.511093318f},
-std::array<float,2>{0.892763138f, 0.310293257f},
-std::array<float,2>{0.276694179f, 0.399581373f},
-std::array<float,2>{0.707666218f, 0.686134577f},
-std::array<float,2>{0.171545267f, 0.964831352f},
-std::array<float,2>{0.998677373f, 0.239851907f},
-std::array<float,2>{0.098076582f, 0.103126623f},
-std::array<float,2>{0.818275452f, 0.815936327f},
-std::array<float,2>{0.416345567f, 0.572460353f},
-std::array<float,2>{0.582115591f, 0.357670397f},
-std::array<float,2>{0.191052958f, 0.268290579f},
-std::array<float,2>{0.922866344f, 0.542039573f},
-std::array<float,2>{0.343515456f, 0.796889842f},
-std::array<float,2>{0.685670912f, 0.0290931743f},
-std::array<float,2>{0.487906158f, 0.183886901f},
-std::array<float,2>{0.519421399f, 0.915496469f},
-std::array<float,2>{0.0123132383f, 0.749436796f},
-std::array<float,2>{0.763975799f, 0.481859356f},
-std::array<float,2>{0.383937299f, 0.460687518f},
-std::array<float,2>{0.594785452f, 0.705237925f},
-std::array<float,2>{0.087701261f, 0.88228929f},
-std::array<float,2>{0.866409063f, 0.150766194f},
-std::array<float,2>{0.15121606f, 0.0315009579f},
-std::array<float,2>{0.949373066f, 0.762477934f},
-std::array<float,2>{0.284160644f, 0.505003572f},
-std::array<float,2>{0.739935637f, 0.298434585f},
-std::array<float,2>{0.0433555357f, 0.331917554f},
-std::array<float,2>{0.796008587f, 0.610271633f},
-std::array<float,2>{0.441664308f, 0.845309377f},
-std::array<float,2>{0.535323858f, 0.0867269188f},
-std::array<float,2>{0.358168632f, 0.215047121f},
-std::array<float,2>{0.642163336f, 0.974400401f},
-std::array<float,2>{0.238428846f, 0.633410275f},
-std::array<float,2>{0.883614063f, 0.431464672f},
-std::array<float,2>{0.256396919f, 0.275084168f},
-std::array<float,2>{0.693892241f, 0.537838161f},
-std::array<float,2>{0.183120176f, 0.810807467f},
-std::array<float,2>{0.973673522f, 0.0196638517f},
-std::array<float,2>{0.123348162f, 0.172855899f},
-std::array<float,2>{0.830620229f, 0.909121394f},
-std::array<float,2>{0.435575157f, 0.740261316f},
-std::array<float,2>{0.562909901f, 0.469872802f},
-std::array<float,2>{0.216501713f, 0.397766858f},
-std::array<float,2>{0.919842601f, 0.676894069f},
-std::array<float,2>{0.31467548f, 0.955151081f},
-std::array<float,2>{0.661999524f, 0.249141112f},
-std::array<float,2>{0.476100236f, 0.100728735f},
-std::array<float,2>{0.505005836f, 0.825853169f},
-std::array<float,2>{0.0202606432f, 0.563549876f},
-std::array<float,2>{0.768758833f, 0.351175308f},
-std::array<float,2>{0.454633236f, 0.370442003f},
-std::array<float,2>{0.559283197f, 0.579538167f},
-std::array<float,2>{0.055562377f, 0.831971645f},
-std::array<float,2>{0.797116518f, 0.121466696f},
-std::array<float,2>{0.230046272f, 0.221056446f},
-std::array<float,2>{0.897843957f, 0.948716044f},
-std::array<float,2>{0.370609969f, 0.659887373f},
-std::array<float,2>{0.629542172f, 0.382124901f},
-std::array<float,2>{0.07541655f, 0.486618936f},
-std::array<float,2>{0.84852916f, 0.723027408f},
-std::array<float,2>{0.396199644f, 0.924654067f},
-std::array<float,2>{0.613542557f, 0.169946477f},
-std::array<float,2>{0.304418385f, 0.0146563957f},
-std::array<float,2>{0.723088443f, 0.786878705f},
-std::array<float,2>{0.138087198f, 0.558932841f},
-std::array<float,2>{0.955344617f, 0.251693785f},
-std::array<float,2>{0.339614004f, 0.410000563f},
-std::array<float,2>{0.679906726f, 0.650174499f},
-std::array<float,2>{0.192632824f, 0.995909154f},
-std::array<float,2>{0.928998411f, 0.188766599f},
-std::array<float,2>{0.00919388421f, 0.0706901327f},
-std::array<float,2>{0.759218812f, 0.863573968f},
-std::array<float,2>{0.488322854f, 0.601717412f},
-std::array<float,2>{0.520661891f, 0.317723393f},
-std::array<float,2>{0.167640537f, 0.284941792f},
-std::array<float,2>{0.995415211f, 0.522522569f},
-std::array<float,2>{0.280725628f, 0.775178313f},
-std::array<float,2>{0.706707776f, 0.0557768233f},
-std::array<float,2>{0.418551445f, 0.140410244f},
-std::array<float,2>{0.580003738f, 0.904303968f},
-std::array<float,2>{0.0953582823f, 0.698868334f},
-std::array<float,2>{0.813952148f, 0.451977402f},
-std::array<float,2>{0.495093763f, 0.390248507f},
-std::array<float,2>{0.529169381f, 0.671723425f},
-std::array<float,2>{0.00550549012f, 0.945217669f},
-std::array<float,2>{0.756878734f, 0.233650118f},
-std::array<float,2>{0.196592718f, 0.111685432f},
-std::array<float,2>{0.937024474f, 0.837433994f},
-std::array<float,2>{0.331599653f, 0.591550231f},
-std::array<float,2>{0.673063874f, 0.361026794f},
-std::array<float,2>{0.108173169f, 0.263245314f},
-std::array<float,2>{0.826660872f, 0.552459717f},
-std::array<float,2>{0.407051295f, 0.791681886f},
-std::array<float,2>{0.587495327f, 0.00562042417f},
-std::array<float,2>{0.270744741f, 0.159126103f},
-std::array<float,2>{0.711648107f, 0.932079136f},
-std::array<float,2>{0.163923606f, 0.729022801f},
-std::array<float,2>{0.984728694f, 0.493587494f},
-std::array<float,2>{0.365870833f, 0.322574198f},
-std::array<float,2>{0.638414979f, 0.594860196f},
-std::array<float,2>{0.21998246f, 0.87431097f},
-std::array<float,2>{0.904251099f, 0.0670162886f},
-std::array<float,2>{0.05224666f, 0.202872396f},
-std::array<float,2>{0.804729998f, 0.991517723f},
-std::array<float,2>{0.468037933f, 0.647812903f},
-std::array<float,2>{0.548560441f, 0.419412017f},
-std::array<float,2>{0.129832283f, 0.440213442f},
-std::array<float,2>{0.966123044f, 0.688180566f},
-std::array<float,2>{0.310164213f, 0.894919813f},
-std::array<float,2>{0.73096621f, 0.132473961f},
-std::array<float,2>{0.398474693f, 0.0501000956f},
-std::array<float,2>{0.620983362f, 0.767406106f},
-std::array<float,2>{0.0675228313f, 0.524863422f},
-std::array<float,2>{0.854885936f, 0.295371771f},
-std::array<float,2>{0.429201156f, 0.306912333f},
-std::array<float,2>{0.574278891f, 0.513331473f},
-std::array<float,2>{0.110862128f, 0.755099118f},
-std::array<float,2>{0.841239512f, 0.0407448038f},
-std::array<float,2>{0.177377596f, 0.146469951f},
-std::array<float,2>{0.980087757f, 0.886558473f},
-std::array<float,2>{0.260401517f, 0.71730274f},
-std::array<float,2>{0.699969649f, 0.46199441f},
-std::array<float,2>{0.0267160833f, 0.423339784f},
-std::array<float,2>{0.776613414f, 0.628583789f},
-std::array<float,2>{0.484304816f, 0.978247046f},
-std::array<float,2>{0.508787334f, 0.210410699f},
-std::array<float,2>{0.325284749f, 0.0787248984f},
-std::array<float,2>{0.667345345f, 0.856646121f},
-std::array<float,2>{0.20618391f, 0.620716631f},
-std::array<float,2>{0.911834598f, 0.339050531f},
-std::array<float,2>{0.293635309f, 0.477201134f},
-std::array<float,2>{0.746957541f, 0.743257642f},
-std::array<float,2>{0.147367775f, 0.921213269f},
-std::array<float,2>{0.943524539f, 0.180309609f},
-std::array<float,2>{0.0799929574f, 0.0260701012f},
-std::array<float,2>{0.874992251f, 0.803338647f},
-std::array<float,2>{0.380755216f, 0.543145001f},
-std::array<float,2>{0.60870111f, 0.271667093f},
-std::array<float,2>{0.247651875f, 0.353679478f},
-std::array<float,2>{0.880218565f, 0.577600896f},
-std::array<float,2>{0.343793631f, 0.819158256f},
-std::array<float,2>{0.650117397f, 0.106762744f},
-std::array<float,2>{0.447685987f, 0.237570271f},
-std::array<float,2>{0.544545889f, 0.9686625f},
-std::array<float,2>{0.032208994f, 0.682363987f},
-std::array<float,2>{0.781681061f, 0.403466105f},
-std::array<float,2>{0.402487099f, 0.393642873f},
-std::array<float,2>{0.624729455f, 0.673687458f},
-std::array<float,2>{0.0653018802f, 0.960568726f},
-std::array<float,2>{0.855616629f, 0.242363796f},
-std::array<float,2>{0.128156736f, 0.0944994017f},
-std::array<float,2>{0.962033927f, 0.823159993f},
-std::array<float,2>{0.308579862f, 0.567753077f},
-std::array<float,2>{0.730145395f, 0.347626448f},
-std::array<float,2>{0.0468961708f, 0.277824998f},
-std::array<float,2>{0.810890317f, 0.534707308f},
-std::array<float,2>{0.462470591f, 0.808454037f},
-std::array<float,2>{0.554652393f, 0.0189403221f},
-std::array<float,2>{0.362138599f, 0.177969903f},
-std::array<float,2>{0.634837389f, 0.911914706f},
-std::array<float,2>{0.226045281f, 0.737994313f},
-std::array<float,2>{0.90111196f, 0.476403952f},
-std::array<float,2>{0.265919894f, 0.335317731f},
-std::array<float,2>{0.717786372f, 0.617041111f},
-std::array<float,2>{0.156871513f, 0.848962605f},
-std::array<float,2>{0.990845501f, 0.0914577916f},
-std::array<float,2>{0.102336928f, 0.211259708f},
-std::array<float,2>{0.824216783f, 0.96924758f},
-std::array<float,2>{0.412765384f, 0.637671471f},
-std::array<float,2>{0.593467057f, 0.436796904f},
-std::array<float,2>{0.201198295f, 0.456532359f},
-std::array<float,2>{0.933195353f, 0.709611654f},
-std::array<float,2>{0.333755195f, 0.877604127f},
-std::array<float,2>{0.679042459f, 0.152410179f},
-std::array<float,2>{0.499578595f, 0.0365097411f},
-std::array<float,2>{0.524529696f, 0.759165585f},
-std::array<float,2>{0.00109014753f, 0.500838459f},
-std::array<float,2>{0.753886163f, 0.303887367f},
-std::array<float,2>{0.452857763f, 0.287385225f},
-std::array<float,2>{0.541782558f, 0.519129753f},
-std::array<float,2>{0.0375603959f, 0.777748108f},
-std::array<float,2>{0.787885249f, 0.0598875135f},
-std::array<float,2>{0.245268881f, 0.135821015f},
-std::array<float,2>{0.876809716f, 0.899350941f},
-std::array<float,2>{0.349747479f, 0.699658036f},
-std::array<float,2>{0.653581738f, 0.449136347f},
-std::array<float,2>{0.0857145935f, 0.412488341f},
-std::array<float,2>{0.870186388f, 0.654998899f},
-std::array<float,2>{0.375795215f, 0.998225033f},
-std::array<float,2>{0.60199815f, 0.192945138f},
-std::array<float,2>{0.290768236f, 0.0766489133f},
-std::array<float,2>{0.743602037f, 0.861713469f},
-std::array<float,2>{0.141720384f, 0.60644424f},
-std::array<float,2>{0.940900266f, 0.314696223f},
-std::array<float,2>{0.321812779f, 0.490007877f},
-std::array<float,2>{0.671204627f, 0.721812665f},
-std::array<float,2>{0.210268453f, 0.928666592f},
-std::array<float,2>{0.907790124f, 0.165630341f},
-std::array<float,2>{0.027679367f, 0.0105694244f},
-std::array<float,2>{0.777442396f, 0.782515764f},
-std::array<float,2>{0.478159398f, 0.556903422f},
-std::array<float,2>{0.512960196f, 0.254551381f},
-std::array<float,2>{0.172119305f, 0.373900086f},
-std::array<float,2>{0.982118547f, 0.584750831f},
-std::array<float,2>{0.264960796f, 0.8339324f},
-std::array<float,2>{0.696328402f, 0.118593946f},
-std::array<float,2>{0.423712045f, 0.223752961f},
-std::array<float,2>{0.570918024f, 0.949534059f},
-std::array<float,2>{0.116021499f, 0.663006961f},
-std::array<float,2>{0.837586582f, 0.376432657f},
-std::array<float,2>{0.470807403f, 0.442204207f},
-std::array<float,2>{0.50207597f, 0.695258737f},
-std::array<float,2>{0.0173209868f, 0.893676281f},
-std::array<float,2>{0.770827532f, 0.126540005f},
-std::array<float,2>{0.211429983f, 0.0542345569f},
-std::array<float,2>{0.915003836f, 0.772920728f},
-std::array<float,2>{0.319000781f, 0.528352797f},
-std::array<float,2>{0.658477962f, 0.289980531f},
-std::array<float,2>{0.118920967f, 0.326046437f},
-std::array<float,2>{0.83235997f, 0.598244846f},
-std::array<float,2>{0.433297932f, 0.870579123f},
-std::array<float,2>{0.56978792f, 0.0637439042f},
-std::array<float,2>{0.252088577f, 0.196710914f},
-std::array<float,2>{0.687505782f, 0.984471798f},
-std::array<float,2>{0.186136484f, 0.642146766f},
-std::array<float,2>{0.971206307f, 0.414968163f},
-std::array<float,2>{0.352190852f, 0.258199722f},
-std::array<float,2>{0.646672785f, 0.550219893f},
-std::array<float,2>{0.237502262f, 0.795927107f},
-std::array<float,2>{0.887314379f, 0.00103842898f},
-std::array<float,2>{0.0406730883f, 0.163645342f},
-std::array<float,2>{0.791162133f, 0.934060514f},
-std::array<float,2>{0.440592438f, 0.734278381f},
-std::array<float,2>{0.533067286f, 0.497858286f},
-std::array<float,2>{0.155375019f, 0.385017186f},
-std::array<float,2>{0.947862506f, 0.664432049f},
-std::array<float,2>{0.28819266f, 0.939628482f},
-std::array<float,2>{0.734626532f, 0.227113083f},
-std::array<float,2>{0.390455693f, 0.116661258f},
-std::array<float,2>{0.598737955f, 0.842028975f},
-std::array<float,2>{0.0931162536f, 0.587770641f},
-std::array<float,2>{0.862300754f, 0.365856916f},
-std::array<float,2>{0.414822906f, 0.356199443f},
-std::array<float,2>{0.584807217f, 0.570889175f},
-std::array<float,2>{0.101006337f, 0.813504398f},
-std::array<float,2>{0.820211232f, 0.104635961f},
-std::array<float,2>{0.168008462f, 0.24180612f},
-std::array<float,2>{0.996902108f, 0.962631524f},
-std::array<float,2>{0.274041682f, 0.683979809f},
-std::array<float,2>{0.710492909f, 0.402067333f},
-std::array<float,2>{0.0154264923f, 0.484042704f},
-std::array<float,2>{0.762519896f, 0.746829808f},
-std::array<float,2>{0.484732419f, 0.916579306f},
-std::array<float,2>{0.516083062f, 0.186132327f},
-std::array<float,2>{0.341168165f, 0.0295845512f},
-std::array<float,2>{0.684098244f, 0.799998462f},
-std::array<float,2>{0.18885088f, 0.540128708f},
-std::array<float,2>{0.924164891f, 0.266195357f},
-std::array<float,2>{0.296942145f, 0.426222801f},
-std::array<float,2>{0.720386624f, 0.630928695f},
-std::array<float,2>{0.134562314f, 0.981087267f},
-std::array<float,2>{0.959357381f, 0.207001492f},
-std::array<float,2>{0.0719617605f, 0.0839216262f},
-std::array<float,2>{0.847489297f, 0.853431821f},
-std::array<float,2>{0.392135054f, 0.624607325f},
-std::array<float,2>{0.612130582f, 0.340255171f},
-std::array<float,2>{0.231924832f, 0.311643273f},
-std::array<float,2>{0.891938746f, 0.508182287f},
-std::array<float,2>{0.37207666f, 0.753337204f},
-std::array<float,2>{0.625406027f, 0.0456146188f},
-std::array<float,2>{0.45718208f, 0.141258374f},
-std::array<float,2>{0.555886209f, 0.888588428f},
-std::array<float,2>{0.0606830455f, 0.712336063f},
-std::array<float,2>{0.804436982f, 0.465352714f},
-std::array<float,2>{0.433952689f, 0.470752656f},
-std::array<float,2>{0.565869391f, 0.739145398f},
-std::array<float,2>{0.122955412f, 0.90627414f},
-std::array<float,2>{0.828622878f, 0.174903691f},
-std::array<float,2>{0.180807307f, 0.0231432635f},
-std::array<float,2>{0.976278305f, 0.809326887f},
-std::array<float,2>{0.255255312f, 0.535687685f},
-std::array<float,2>{0.691753268f, 0.275418967f},
-std::array<float,2>{0.0216187518f, 0.348834604f},
-std::array<float,2>{0.766560972f, 0.56597966f},
-std::array<float,2>{0.473493397f, 0.827933967f},
-std::array<float,2>{0.506421685f, 0.0982444957f},
-std::array<float,2>{0.314364076f, 0.246108755f},
-std::array<float,2>{0.662600994f, 0.954729676f},
-std::array<float,2>{0.217187226f, 0.678195953f},
-std::array<float,2>{0.921693444f, 0.395154923f},
-std::array<float,2>{0.281723917f, 0.300507903f},
-std::array<float,2>{0.740422904f, 0.507582784f},
-std::array<float,2>{0.14937976f, 0.764261484f},
-std::array<float,2>{0.95286274f, 0.0348379463f},
-std::array<float,2>{0.0898142904f, 0.149986148f},
-std::array<float,2>{0.863963246f, 0.879143417f},
-std::array<float,2>{0.386343539f, 0.703871489f},
-std::array<float,2>{0.596395731f, 0.457589388f},
-std::array<float,2>{0.240950361f, 0.431767076f},
-std::array<float,2>{0.885947526f, 0.635851145f},
-std::array<float,2>{0.355872363f, 0.975009322f},
-std::array<float,2>{0.643321276f, 0.21846357f},
-std::array<float,2>{0.444911629f, 0.0882646441f},
-std::array<float,2>{0.539007843f, 0.847485423f},
-std::array<float,2>{0.04546386f, 0.611343622f},
-std::array<float,2>{0.793588161f, 0.329873055f},
-std::array<float,2>{0.491147578f, 0.3202613f},
-std::array<float,2>{0.522452831f, 0.605053544f},
-std::array<float,2>{0.0111330096f, 0.865813315f},
-std::array<float,2>{0.760753512f, 0.0727601349f},
-std::array<float,2>{0.194533125f, 0.189959884f},
-std::array<float,2>{0.927667737f, 0.99379319f},
-std::array<float,2>{0.337665886f, 0.650541902f},
-std::array<float,2>{0.682309985f, 0.406788886f},
-std::array<float,2>{0.0974819437f, 0.450731695f},
-std::array<float,2>{0.814943373f, 0.696595073f},
-std::array<float,2>{0.420330793f, 0.903450131f},
-std::array<float,2>{0.580809712f, 0.137938619f},
-std::array<float,2>{0.277655154f, 0.0577468239f},
-std::array<float,2>{0.70401144f, 0.777110279f},
-std::array<float,2>{0.164335445f, 0.520593166f},
-std::array<float,2>{0.992405593f, 0.282858402f},
-std::array<float,2>{0.368684679f, 0.378912747f},
-std::array<float,2>{0.631029606f, 0.656470895f},
-std::array<float,2>{0.227349669f, 0.946578264f},
-std::array<float,2>{0.895844698f, 0.219931573f},
-std::array<float,2>{0.0578654259f, 0.123316377f},
-std::array<float,2>{0.800492227f, 0.829508066f},
-std::array<float,2>{0.455925494f, 0.580958188f},
-std::array<float,2>{0.561461568f, 0.369024724f},
-std::array<float,2>{0.138696626f, 0.253729403f},
-std::array<float,2>{0.953503072f, 0.560596347f},
-std::array<float,2>{0.302580893f, 0.788738847f},
-std::array<float,2>{0.726182699f, 0.0134420488f},
-std::array<float,2>{0.398066461f, 0.169413358f},
-std::array<float,2>{0.615928173f, 0.922301412f},
-std::array<float,2>{0.0780198947f, 0.726204991f},
-std::array<float,2>{0.851028681f, 0.484803766f},
-std::array<float,2>{0.465020597f, 0.42182532f},
-std::array<float,2>{0.549038708f, 0.644893706f},
-std::array<float,2>{0.0527658872f, 0.989487588f},
-std::array<float,2>{0.808593094f, 0.200189993f},
-std::array<float,2>{0.221951738f, 0.0684026852f},
-std::array<float,2>{0.905848145f, 0.871429384f},
-std::array<float,2>{0.363822311f, 0.596711278f},
-std::array<float,2>{0.6401214f, 0.321792752f},
-std::array<float,2>{0.0691846013f, 0.29304713f},
-std::array<float,2>{0.852985799f, 0.525685847f},
-std::array<float,2>{0.40110597f, 0.768628299f},
-std::array<float,2>{0.6186198f, 0.0471226797f},
-std::array<float,2>{0.312027901f, 0.129331186f},
-std::array<float,2>{0.733231902f, 0.89714551f},
-std::array<float,2>{0.131477222f, 0.690424144f},
-std::array<float,2>{0.968177259f, 0.438194394f},
-std::array<float,2>{0.328463137f, 0.361389041f},
-std::array<float,2>{0.675555646f, 0.591950297f},
-std::array<float,2>{0.198427096f, 0.838919461f},
-std::array<float,2>{0.934199929f, 0.111130841f},
-std::array<float,2>{0.00742620882f, 0.232315481f},
-std::array<float,2>{0.754267573f, 0.942712426f},
-std::array<float,2>{0.493523657f, 0.668314338f},
-std::array<float,2>{0.530539453f, 0.387655705f},
-std::array<float,2>{0.161177844f, 0.495115757f},
-std::array<float,2>{0.986971438f, 0.727355778f},
-std::array<float,2>{0.272440493f, 0.931008756f},
-std::array<float,2>{0.713707507f, 0.156370148f},
-std::array<float,2>{0.408953846f, 0.00656442577f},
-std::array<float,2>{0.588764131f, 0.790080011f},
-std::array<float,2>{0.106267296f, 0.553422511f},
-std::array<float,2>{0.82453084f, 0.264863908f},
-std::array<float,2>{0.382515311f, 0.269936651f},
-std::array<float,2>{0.606448531f, 0.546502829f},
-std::array<float,2>{0.0806585774f, 0.801497579f},
-std::array<float,2>{0.872131765f, 0.0243773088f},
-std::array<float,2>{0.145016089f, 0.181854889f},
-std::array<float,2>{0.942997098f, 0.918997765f},
-std::array<float,2>{0.296869338f, 0.744295359f},
-std::array<float,2>{0.749385834f, 0.480059534f},
-std::array<float,2>{0.0349750333f, 0.405972004f},
-std::array<float,2>{0.78367424f, 0.68087554f},
-std::array<float,2>{0.446337223f, 0.966160655f},
-std::array<float,2>{0.546704113f, 0.235253468f},
-std::array<float,2>{0.34752363f, 0.108562067f},
-std::array<float,2>{0.651060283f, 0.816783607f},
-std::array<float,2>{0.248286083f, 0.576126277f},
-std::array<float,2>{0.881569386f, 0.35196358f},
-std::array<float,2>{0.258930236f, 0.464735895f},
-std::array<float,2>{0.703090668f, 0.714940608f},
-std::array<float,2>{0.178213149f, 0.883635461f},
-std::array<float,2>{0.977963924f, 0.14705795f},
-std::array<float,2>{0.112900063f, 0.0420847312f},
-std::array<float,2>{0.842302084f, 0.757772863f},
-std::array<float,2>{0.427632064f, 0.513926744f},
-std::array<float,2>{0.577584743f, 0.305374146f},
-std::array<float,2>{0.203754708f, 0.336485922f},
-std::array<float,2>{0.913503468f, 0.618635595f},
-std::array<float,2>{0.326795965f, 0.857477725f},
-std::array<float,2>{0.665289462f, 0.0804103315f},
-std::array<float,2>{0.481972754f, 0.208610654f},
-std::array<float,2>{0.510158777f, 0.979780972f},
-std::array<float,2>{0.0245760009f, 0.625514746f},
-std::array<float,2>{0.775212109f, 0.425589293f},
-std::array<float,2>{0.376787812f, 0.411736935f},
-std::array<float,2>{0.603217304f, 0.654087663f},
-std::array<float,2>{0.084928751f, 0.996580124f},
-std::array<float,2>{0.8698861f, 0.194779664f},
-std::array<float,2>{0.141330406f, 0.0748458281f},
-std::array<float,2>{0.939867973f, 0.860742688f},
-std::array<float,2>{0.289247513f, 0.607504606f},
-std::array<float,2>{0.742797732f, 0.314016432f},
-std::array<float,2>{0.0384269729f, 0.286872417f},
-std::array<float,2>{0.788611174f, 0.51699239f},
-std::array<float,2>{0.451766968f, 0.78036654f},
-std::array<float,2>{0.542505741f, 0.0615067706f},
-std::array<float,2>{0.35104835f, 0.133361652f},
-std::array<float,2>{0.652743399f, 0.900668442f},
-std::array<float,2>{0.244543552f, 0.702322483f},
-std::array<float,2>{0.875623584f, 0.445528299f},
-std::array<float,2>{0.264454573f, 0.371397704f},
-std::array<float,2>{0.695785999f, 0.582344115f},
-std::array<float,2>{0.173606023f, 0.83457303f},
-std::array<float,2>{0.980775118f, 0.120693967f},
-std::array<float,2>{0.116973653f, 0.224787757f},
-std::array<float,2>{0.836645126f, 0.951285362f},
-std::array<float,2>{0.422458529f, 0.661221743f},
-std::array<float,2>{0.571552455f, 0.377988428f},
-std::array<float,2>{0.209530264f, 0.49069649f},
-std::array<float,2>{0.906554818f, 0.718769312f},
-std::array<float,2>{0.320423335f, 0.927366197f},
-std::array<float,2>{0.669966698f, 0.167260259f},
-std::array<float,2>{0.47705394f, 0.00806326699f},
-std::array<float,2>{0.512452781f, 0.7836712f},
-std::array<float,2>{0.0283933394f, 0.555939257f},
-std::array<float,2>{0.778753102f, 0.256004721f},
-std::array<float,2>{0.461223423f, 0.280325145f},
-std::array<float,2>{0.552946091f, 0.532236993f},
-std::array<float,2>{0.0487484299f, 0.8054353f},
-std::array<float,2>{0.812458217f, 0.0167456735f},
-std::array<float,2>{0.224849716f, 0.176312849f},
-std::array<float,2>{0.90190047f, 0.913536549f},
-std::array<float,2>{0.362658143f, 0.735896051f},
-std::array<float,2>{0.636052072f, 0.473562568f},
-std::array<float,2>{0.0659983754f, 0.390899748f},
-std::array<float,2>{0.857392311f, 0.675503731f},
-std::array<float,2>{0.403422207f, 0.957841098f},
-std::array<float,2>{0.623858809f, 0.245263711f},
-std::array<float,2>{0.307128757f, 0.0961614102f},
-std::array<float,2>{0.729098976f, 0.822247386f},
-std::array<float,2>{0.127399549f, 0.569327712f},
-std::array<float,2>{0.961462736f, 0.344891638f},
-std::array<float,2>{0.332527876f, 0.453822255f},
-std::array<float,2>{0.678664505f, 0.70774895f},
-std::array<float,2>{0.202420309f, 0.875693381f},
-std::array<float,2>{0.931802273f, 0.1550612f},
-std::array<float,2>{0.000698082324f, 0.0388435945f},
-std::array<float,2>{0.752174318f, 0.759989321f},
-std::array<float,2>{0.498941928f, 0.502759159f},
-std::array<float,2>{0.523700416f, 0.301570505f},
-std::array<float,2>{0.15818496f, 0.332414091f},
-std::array<float,2>{0.991560876f, 0.613710821f},
-std::array<float,2>{0.266857058f, 0.850160122f},
-std::array<float,2>{0.717549205f, 0.0935522988f},
-std::array<float,2>{0.413511425f, 0.212992385f},
-std::array<float,2>{0.59181416f, 0.972600758f},
-std::array<float,2>{0.102747731f, 0.639153302f},
-std::array<float,2>{0.822794259f, 0.434706062f},
-std::array<float,2>{0.485461742f, 0.481057346f},
-std::array<float,2>{0.517083228f, 0.748595834f},
-std::array<float,2>{0.0144852325f, 0.915007412f},
-std::array<float,2>{0.763632774f, 0.184917137f},
-std::array<float,2>{0.187635958f, 0.0279779192f},
-std::array<float,2>{0.925117612f, 0.798557281f},
-std::array<float,2>{0.340586931f, 0.541825473f},
-std::array<float,2>{0.684763074f, 0.269067526f},
-std::array<float,2>{0.0996452272f, 0.359000415f},
-std::array<float,2>{0.819052637f, 0.573746324f},
-std::array<float,2>{0.415821582f, 0.814583957f},
-std::array<float,2>{0.585286677f, 0.101690091f},
-std::array<float,2>{0.274922401f, 0.238965183f},
-std::array<float,2>{0.709176719f, 0.96370405f},
-std::array<float,2>{0.169110477f, 0.68701005f},
-std::array<float,2>{0.997356594f, 0.399020672f},
-std::array<float,2>{0.371822864f, 0.309531033f},
-std::array<float,2>{0.626906991f, 0.510308981f},
-std::array<float,2>{0.23054789f, 0.751900136f},
-std::array<float,2>{0.891363025f, 0.0435857289f},
-std::array<float,2>{0.06209068f, 0.143112421f},
-std::array<float,2>{0.803156734f, 0.88939184f},
-std::array<float,2>{0.458206773f, 0.714001954f},
-std::array<float,2>{0.555065632f, 0.467315197f},
-std::array<float,2>{0.133694798f, 0.428325474f},
-std::array<float,2>{0.960705042f, 0.630508184f},
-std::array<float,2>{0.298314631f, 0.98437047f},
-std::array<float,2>{0.719230652f, 0.20505023f},
-std::array<float,2>{0.391433954f, 0.08437711f},
-std::array<float,2>{0.612737715f, 0.85543555f},
-std::array<float,2>{0.0706638619f, 0.622270465f},
-std::array<float,2>{0.846296549f, 0.341931283f},
-std::array<float,2>{0.43178758f, 0.327144116f},
-std::array<float,2>{0.568585157f, 0.600492895f},
-std::array<float,2>{0.117821328f, 0.868594766f},
-std::array<float,2>{0.833247423f, 0.0645668805f},
-std::array<float,2>{0.186933026f, 0.19861044f},
-std::array<float,2>{0.972632468f, 0.987412393f},
-std::array<float,2>{0.253723264f, 0.644318104f},
-std::array<float,2>{0.689341247f, 0.416097671f},
-std::array<float,2>{0.0162203591f, 0.444460332f},
-std::array<float,2>{0.76978749f, 0.692538202f},
-std::array<float,2>{0.472420603f, 0.891315579f},
-std::array<float,2>{0.503134727f, 0.127464935f},
-std::array<float,2>{0.319682121f, 0.0509913303f},
-std::array<float,2>{0.659280717f, 0.769791245f},
-std::array<float,2>{0.21229741f, 0.529633403f},
-std::array<float,2>{0.915129483f, 0.291233927f},
-std::array<float,2>{0.287115395f, 0.384272367f},
-std::array<float,2>{0.736230254f, 0.666636348f},
-std::array<float,2>{0.154686019f, 0.937792838f},
-std::array<float,2>{0.948700786f, 0.229821876f},
-std::array<float,2>{0.0926516503f, 0.1137373f},
-std::array<float,2>{0.862470686f, 0.840898514f},
-std::array<float,2>{0.389197856f, 0.588359416f},
-std::array<float,2>{0.597990394f, 0.36334753f},
-std::array<float,2>{0.236801311f, 0.260200649f},
-std::array<float,2>{0.887907684f, 0.546895981f},
-std::array<float,2>{0.352922469f, 0.793839037f},
-std::array<float,2>{0.648154557f, 0.0033650042f},
-std::array<float,2>{0.440340251f, 0.160979748f},
-std::array<float,2>{0.532012165f, 0.936722457f},
-std::array<float,2>{0.0399644077f, 0.730998814f},
-std::array<float,2>{0.792146206f, 0.49845016f},
-std::array<float,2>{0.420936197f, 0.452648461f},
-std::array<float,2>{0.581795633f, 0.697653353f},
-std::array<float,2>{0.0962323174f, 0.906108975f},
-std::array<float,2>{0.815883219f, 0.139479354f},
-std::array<float,2>{0.165768728f, 0.0550254621f},
-std::array<float,2>{0.993751585f, 0.773541927f},
-std::array<float,2>{0.2791982f, 0.521760702f},
-std::array<float,2>{0.704776227f, 0.28394115f},
-std::array<float,2>{0.0100746853f, 0.317305267f},
-std::array<float,2>{0.759812951f, 0.603377283f},
-std::array<float,2>{0.492112964f, 0.864632905f},
-std::array<float,2>{0.522970438f, 0.0719156936f},
-std::array<float,2>{0.336578131f, 0.187749892f},
-std::array<float,2>{0.683296621f, 0.994204462f},
-std::array<float,2>{0.19409962f, 0.648782015f},
-std::array<float,2>{0.926436484f, 0.409048498f},
-std::array<float,2>{0.301206797f, 0.250361145f},
-std::array<float,2>{0.725454211f, 0.559713304f},
-std::array<float,2>{0.140438616f, 0.785456419f},
-std::array<float,2>{0.954181492f, 0.0140151614f},
-std::array<float,2>{0.0765556395f, 0.171008795f},
-std::array<float,2>{0.850246191f, 0.925733685f},
-std::array<float,2>{0.396765381f, 0.724018276f},
-std::array<float,2>{0.616306186f, 0.488032281f},
-std::array<float,2>{0.227604151f, 0.3814632f},
-std::array<float,2>{0.895251691f, 0.65892899f},
-std::array<float,2>{0.367660582f, 0.94767344f},
-std::array<float,2>{0.632149816f, 0.222612172f},
-std::array<float,2>{0.456413209f, 0.122639664f},
-std::array<float,2>{0.56216675f, 0.830209017f},
-std::array<float,2>{0.0571389347f, 0.578559518f},
-std::array<float,2>{0.799754083f, 0.369765073f},
-std::array<float,2>{0.474479765f, 0.350129426f},
-std::array<float,2>{0.507124364f, 0.563425183f},
-std::array<float,2>{0.0225833636f, 0.82475251f},
-std::array<float,2>{0.766826391f, 0.100332871f},
-std::array<float,2>{0.217874542f, 0.248244718f},
-std::array<float,2>{0.920707643f, 0.956204236f},
-std::array<float,2>{0.313223451f, 0.675822973f},
-std::array<float,2>{0.663747609f, 0.397271037f},
-std::array<float,2>{0.121731915f, 0.468773752f},
-std::array<float,2>{0.830061376f, 0.741905153f},
-std::array<float,2>{0.434773445f, 0.910092354f},
-std::array<float,2>{0.564706504f, 0.172376022f},
-std::array<float,2>{0.254257083f, 0.0211928673f},
-std::array<float,2>{0.692406774f, 0.811660767f},
-std::array<float,2>{0.179753289f, 0.538441539f},
-std::array<float,2>{0.974867105f, 0.273501396f},
-std::array<float,2>{0.356727511f, 0.429817528f},
-std::array<float,2>{0.644234955f, 0.633937776f},
-std::array<float,2>{0.241390064f, 0.973385632f},
-std::array<float,2>{0.885444641f, 0.216555163f},
-std::array<float,2>{0.0461499356f, 0.087327458f},
-std::array<float,2>{0.793952584f, 0.844361782f},
-std::array<float,2>{0.443833292f, 0.610651195f},
-std::array<float,2>{0.537528336f, 0.330145061f},
-std::array<float,2>{0.149426013f, 0.297436744f},
-std::array<float,2>{0.9514184f, 0.50481981f},
-std::array<float,2>{0.282753259f, 0.76333952f},
-std::array<float,2>{0.74202925f, 0.0330248512f},
-std::array<float,2>{0.385352373f, 0.151378125f},
-std::array<float,2>{0.597391009f, 0.881503105f},
-std::array<float,2>{0.0887823552f, 0.706685781f},
-std::array<float,2>{0.865021229f, 0.459871054f},
-std::array<float,2>{0.445665538f, 0.402734369f},
-std::array<float,2>{0.545473814f, 0.68286854f},
-std::array<float,2>{0.0338488929f, 0.967721581f},
-std::array<float,2>{0.784378946f, 0.236485824f},
-std::array<float,2>{0.249095172f, 0.105993144f},
-std::array<float,2>{0.882518828f, 0.819752872f},
-std::array<float,2>{0.346452296f, 0.577063143f},
-std::array<float,2>{0.651436687f, 0.354511291f},
-std::array<float,2>{0.0817059129f, 0.272961974f},
-std::array<float,2>{0.871349752f, 0.544878602f},
-std::array<float,2>{0.381417692f, 0.804052651f},
-std::array<float,2>{0.606264293f, 0.0266180579f},
-std::array<float,2>{0.295284301f, 0.18103987f},
-std::array<float,2>{0.748092115f, 0.92030853f},
-std::array<float,2>{0.145912111f, 0.743055105f},
-std::array<float,2>{0.941863954f, 0.477998823f},
-std::array<float,2>{0.327341765f, 0.338630974f},
-std::array<float,2>{0.664135993f, 0.620070755f},
-std::array<float,2>{0.204437256f, 0.856128871f},
-std::array<float,2>{0.912922204f, 0.079728581f},
-std::array<float,2>{0.0239102636f, 0.209356919f},
-std::array<float,2>{0.773749709f, 0.977154851f},
-std::array<float,2>{0.480694234f, 0.627865434f},
-std::array<float,2>{0.510840178f, 0.42230612f},
-std::array<float,2>{0.178869352f, 0.461122066f},
-std::array<float,2>{0.977077723f, 0.718634844f},
-std::array<float,2>{0.258509606f, 0.885504425f},
-std::array<float,2>{0.701743782f, 0.144752681f},
-std::array<float,2>{0.426344484f, 0.0394348949f},
-std::array<float,2>{0.57646054f, 0.754831791f},
-std::array<float,2>{0.11178147f, 0.512682676f},
-std::array<float,2>{0.843598127f, 0.308575094f},
-std::array<float,2>{0.401676446f, 0.295928091f},
-std::array<float,2>{0.617299199f, 0.52356559f},
-std::array<float,2>{0.0702523068f, 0.766112804f},
-std::array<float,2>{0.852434516f, 0.0495577641f},
-std::array<float,2>{0.132756189f, 0.131165966f},
-std::array<float,2>{0.967643261f, 0.896179497f},
-std::array<float,2>{0.311119467f, 0.689391553f},
-std::array<float,2>{0.733461797f, 0.440768987f},
-std::array<float,2>{0.0545779951f, 0.418784499f},
-std::array<float,2>{0.807326555f, 0.646739185f},
-std::array<float,2>{0.466432065f, 0.990529001f},
-std::array<float,2>{0.549832344f, 0.201173827f},
-std::array<float,2>{0.364651203f, 0.0676836297f},
-std::array<float,2>{0.639322817f, 0.873780787f},
-std::array<float,2>{0.221247122f, 0.594484329f},
-std::array<float,2>{0.904872477f, 0.324097842f},
-std::array<float,2>{0.273205727f, 0.493044376f},
-std::array<float,2>{0.714793861f, 0.730253339f},
-std::array<float,2>{0.1603643f, 0.932851911f},
-std::array<float,2>{0.987815917f, 0.159245074f},
-std::array<float,2>{0.10651765f, 0.00447983341f},
-std::array<float,2>{0.825364769f, 0.792575836f},
-std::array<float,2>{0.409344554f, 0.551695168f},
-std::array<float,2>{0.589253664f, 0.261907607f},
-std::array<float,2>{0.1972799f, 0.359979361f},
-std::array<float,2>{0.934786677f, 0.590767324f},
-std::array<float,2>{0.329873174f, 0.836585462f},
-std::array<float,2>{0.674597204f, 0.112493157f},
-std::array<float,2>{0.492218554f, 0.232557818f},
-std::array<float,2>{0.530078709f, 0.943757236f},
-std::array<float,2>{0.00653676828f, 0.670545697f},
-std::array<float,2>{0.755161583f, 0.388911307f},
-std::array<float,2>{0.425561666f, 0.375447661f},
-std::array<float,2>{0.572818577f, 0.66394192f},
-std::array<float,2>{0.114829302f, 0.950455368f},
-std::array<float,2>{0.839288592f, 0.223060116f},
-std::array<float,2>{0.175555646f, 0.117402539f},
-std::array<float,2>{0.984213173f, 0.832393885f},
-std::array<float,2>{0.263006389f, 0.58540827f},
-std::array<float,2>{0.69884038f, 0.374684364f},
-std::array<float,2>{0.0308145937f, 0.255326152f},
-std::array<float,2>{0.781219065f, 0.558395386f},
-std::array<float,2>{0.479779452f, 0.782014728f},
-std::array<float,2>{0.513852298f, 0.0108069312f},
-std::array<float,2>{0.322959334f, 0.164485142f},
-std::array<float,2>{0.668872714f, 0.929088473f},
-std::array<float,2>{0.208764657f, 0.7212919f},
-std::array<float,2>{0.909937143f, 0.488653868f},
-std::array<float,2>{0.291539878f, 0.316132069f},
-std::array<float,2>{0.745937526f, 0.606924295f},
-std::array<float,2>{0.144087315f, 0.862640738f},
-std::array<float,2>{0.938132107f, 0.0776204467f},
-std::array<float,2>{0.083617568f, 0.191909954f},
-std::array<float,2>{0.868196964f, 0.999747694f},
-std::array<float,2>{0.378629506f, 0.655495942f},
-std::array<float,2>{0.604189813f, 0.413614392f},
-std::array<float,2>{0.242768973f, 0.447328269f},
-std::array<float,2>{0.87795186f, 0.700943172f},
-std::array<float,2>{0.348451853f, 0.900012195f},
-std::array<float,2>{0.654363334f, 0.134911224f},
-std::array<float,2>{0.450076163f, 0.0595440418f},
-std::array<float,2>{0.54030931f, 0.778550327f},
-std::array<float,2>{0.0360118039f, 0.517695665f},
-std::array<float,2>{0.786496639f, 0.288839012f},
-std::array<float,2>{0.49621436f, 0.303465456f},
-std::array<float,2>{0.525859952f, 0.501821995f},
-std::array<float,2>{0.00268468121f, 0.758296967f},
-std::array<float,2>{0.750419974f, 0.0358141623f},
-std::array<float,2>{0.200609148f, 0.154013634f},
-std::array<float,2>{0.931255579f, 0.87843138f},
-std::array<float,2>{0.335680097f, 0.710141301f},
-std::array<float,2>{0.677504659f, 0.455552131f},
-std::array<float,2>{0.104649685f, 0.435808748f},
-std::array<float,2>{0.821838975f, 0.638576329f},
-std::array<float,2>{0.412023813f, 0.970017016f},
-std::array<float,2>{0.590139508f, 0.212056562f},
-std::array<float,2>{0.269528091f, 0.0902274773f},
-std::array<float,2>{0.71492368f, 0.848011911f},
-std::array<float,2>{0.15934442f, 0.61551702f},
-std::array<float,2>{0.989797115f, 0.334879309f},
-std::array<float,2>{0.360233545f, 0.475109607f},
-std::array<float,2>{0.634299457f, 0.736531258f},
-std::array<float,2>{0.223186985f, 0.9110955f},
-std::array<float,2>{0.89968425f, 0.178896859f},
-std::array<float,2>{0.0501247831f, 0.0183305349f},
-std::array<float,2>{0.809749305f, 0.807128847f},
-std::array<float,2>{0.463634998f, 0.533907413f},
-std::array<float,2>{0.552452147f, 0.278401852f},
-std::array<float,2>{0.126783609f, 0.346294194f},
-std::array<float,2>{0.963858008f, 0.566867828f},
-std::array<float,2>{0.306388468f, 0.823708355f},
-std::array<float,2>{0.727923274f, 0.0949042737f},
-std::array<float,2>{0.405616075f, 0.243537039f},
-std::array<float,2>{0.621150911f, 0.959774673f},
-std::array<float,2>{0.0636424944f, 0.672202468f},
-std::array<float,2>{0.85855478f, 0.392672509f},
-std::array<float,2>{0.460001349f, 0.466244996f},
-std::array<float,2>{0.557250321f, 0.711232424f},
-std::array<float,2>{0.0598611161f, 0.887179017f},
-std::array<float,2>{0.800947785f, 0.142037958f},
-std::array<float,2>{0.233196661f, 0.0465351902f},
-std::array<float,2>{0.894333959f, 0.751986384f},
-std::array<float,2>{0.373479933f, 0.508948624f},
-std::array<float,2>{0.627014399f, 0.310906053f},
-std::array<float,2>{0.0723065734f, 0.341642529f},
-std::array<float,2>{0.845559835f, 0.623506963f},
-std::array<float,2>{0.394301385f, 0.852454543f},
-std::array<float,2>{0.610373676f, 0.0829865262f},
-std::array<float,2>{0.300509006f, 0.205919862f},
-std::array<float,2>{0.72263509f, 0.981753707f},
-std::array<float,2>{0.135681301f, 0.632240772f},
-std::array<float,2>{0.957684278f, 0.427329957f},
-std::array<float,2>{0.342741311f, 0.267106056f},
-std::array<float,2>{0.687249959f, 0.539415836f},
-std::array<float,2>{0.189551711f, 0.799425602f},
-std::array<float,2>{0.922122478f, 0.0311624818f},
-std::array<float,2>{0.013496832f, 0.187213257f},
-std::array<float,2>{0.765322685f, 0.917399585f},
-std::array<float,2>{0.486864716f, 0.747903109f},
-std::array<float,2>{0.517929018f, 0.483322412f},
-std::array<float,2>{0.17013377f, 0.400923967f},
-std::array<float,2>{0.999300659f, 0.685451806f},
-std::array<float,2>{0.276213706f, 0.961782515f},
-std::array<float,2>{0.708485067f, 0.240817308f},
-std::array<float,2>{0.417208821f, 0.104405418f},
-std::array<float,2>{0.583268225f, 0.813438177f},
-std::array<float,2>{0.0992289931f, 0.571387291f},
-std::array<float,2>{0.817321897f, 0.356445879f},
-std::array<float,2>{0.388416857f, 0.367044866f},
-std::array<float,2>{0.600920856f, 0.586439192f},
-std::array<float,2>{0.0910031199f, 0.842930853f},
-std::array<float,2>{0.861291528f, 0.115239583f},
-std::array<float,2>{0.153730199f, 0.228161946f},
-std::array<float,2>{0.946388662f, 0.940953434f},
-std::array<float,2>{0.285970896f, 0.665811598f},
-std::array<float,2>{0.737699389f, 0.386115193f},
-std::array<float,2>{0.0427837484f, 0.496159852f},
-std::array<float,2>{0.78978008f, 0.733332694f},
-std::array<float,2>{0.439346224f, 0.934579015f},
-std::array<float,2>{0.533373177f, 0.163026214f},
-std::array<float,2>{0.353740245f, 0.000592340017f},
-std::array<float,2>{0.645534575f, 0.795127809f},
-std::array<float,2>{0.234756529f, 0.549130917f},
-std::array<float,2>{0.889787376f, 0.259638071f},
-std::array<float,2>{0.251359314f, 0.415758461f},
-std::array<float,2>{0.691404581f, 0.641129553f},
-std::array<float,2>{0.185446143f, 0.985700786f},
-std::array<float,2>{0.968808055f, 0.196090341f},
-std::array<float,2>{0.119884647f, 0.0632549375f},
-std::array<float,2>{0.835876226f, 0.869281948f},
-std::array<float,2>{0.430915982f, 0.59873426f},
-std::array<float,2>{0.567118108f, 0.324260414f},
-std::array<float,2>{0.213150263f, 0.290520817f},
-std::array<float,2>{0.916906178f, 0.527568877f},
-std::array<float,2>{0.317502081f, 0.77166754f},
-std::array<float,2>{0.657682657f, 0.053699024f},
-std::array<float,2>{0.469532281f, 0.125396878f},
-std::array<float,2>{0.500462592f, 0.893511236f},
-std::array<float,2>{0.0176862013f, 0.69351095f},
-std::array<float,2>{0.772154212f, 0.442912102f},
-std::array<float,2>{0.395045906f, 0.486088842f},
-std::array<float,2>{0.614409387f, 0.725026965f},
-std::array<float,2>{0.0747127905f, 0.923481703f},
-std::array<float,2>{0.849241197f, 0.168295264f},
-std::array<float,2>{0.137635931f, 0.012628369f},
-std::array<float,2>{0.956726551f, 0.787399471f},
-std::array<float,2>{0.303230584f, 0.561639905f},
-std::array<float,2>{0.724198937f, 0.252678603f},
-std::array<float,2>{0.0563108772f, 0.367276967f},
-std::array<float,2>{0.797916174f, 0.581220925f},
-std::array<float,2>{0.453145474f, 0.828734279f},
-std::array<float,2>{0.559788942f, 0.124691665f},
-std::array<float,2>{0.36995253f, 0.219584376f},
-std::array<float,2>{0.63027072f, 0.945560634f},
-std::array<float,2>{0.229300112f, 0.657455266f},
-std::array<float,2>{0.897125781f, 0.380760252f},
-std::array<float,2>{0.279769659f, 0.282070339f},
-std::array<float,2>{0.705863178f, 0.519876778f},
-std::array<float,2>{0.166607797f, 0.776299596f},
-std::array<float,2>{0.994970262f, 0.0572781004f},
-std::array<float,2>{0.0943717286f, 0.137600571f},
-std::array<float,2>{0.812952518f, 0.902429044f},
-std::array<float,2>{0.419659615f, 0.695520997f},
-std::array<float,2>{0.578583777f, 0.450114071f},
-std::array<float,2>{0.191932693f, 0.407784432f},
-std::array<float,2>{0.927874088f, 0.652243316f},
-std::array<float,2>{0.338229269f, 0.992816567f},
-std::array<float,2>{0.680804253f, 0.191144541f},
-std::array<float,2>{0.489524454f, 0.0736525357f},
-std::array<float,2>{0.519531667f, 0.866591513f},
-std::array<float,2>{0.00784379896f, 0.604203999f},
-std::array<float,2>{0.758719027f, 0.319238871f},
-std::array<float,2>{0.442867398f, 0.32844156f},
-std::array<float,2>{0.536498189f, 0.613214612f},
-std::array<float,2>{0.0440879464f, 0.84638226f},
-std::array<float,2>{0.795879304f, 0.0896705464f},
-std::array<float,2>{0.239776641f, 0.217536032f},
-std::array<float,2>{0.884530604f, 0.976233423f},
-std::array<float,2>{0.359189898f, 0.635514438f},
-std::array<float,2>{0.641069651f, 0.433108717f},
-std::array<float,2>{0.0859440491f, 0.458121002f},
-std::array<float,2>{0.865609825f, 0.704262793f},
-std::array<float,2>{0.383476049f, 0.880446017f},
-std::array<float,2>{0.594346344f, 0.149080873f},
-std::array<float,2>{0.284982145f, 0.033814013f},
-std::array<float,2>{0.738693833f, 0.765231371f},
-std::array<float,2>{0.151481882f, 0.506427884f},
-std::array<float,2>{0.950894713f, 0.299256682f},
-std::array<float,2>{0.315534264f, 0.3957133f},
-std::array<float,2>{0.661072016f, 0.679014385f},
-std::array<float,2>{0.214921027f, 0.953266621f},
-std::array<float,2>{0.91831249f, 0.247818187f},
-std::array<float,2>{0.0213197451f, 0.0992987901f},
-std::array<float,2>{0.768391132f, 0.826473653f},
-std::array<float,2>{0.475543141f, 0.564482689f},
-std::array<float,2>{0.504176021f, 0.347960949f},
-std::array<float,2>{0.181748062f, 0.276757747f},
-std::array<float,2>{0.973177791f, 0.536632776f},
-std::array<float,2>{0.257283211f, 0.810465336f},
-std::array<float,2>{0.69471091f, 0.0224501137f},
-std::array<float,2>{0.437033981f, 0.174250647f},
-std::array<float,2>{0.564063847f, 0.907945156f},
-std::array<float,2>{0.124220088f, 0.739544392f},
-std::array<float,2>{0.83193022f, 0.471801758f},
-std::array<float,2>{0.482632488f, 0.424388289f},
-std::array<float,2>{0.509251535f, 0.626538515f},
-std::array<float,2>{0.025930915f, 0.978519738f},
-std::array<float,2>{0.775805175f, 0.207432359f},
-std::array<float,2>{0.205457926f, 0.0818618089f},
-std::array<float,2>{0.910280168f, 0.859168589f},
-std::array<float,2>{0.324899644f, 0.617490053f},
-std::array<float,2>{0.666899621f, 0.337747902f},
-std::array<float,2>{0.110038199f, 0.306264102f},
-std::array<float,2>{0.840292871f, 0.514958978f},
-std::array<float,2>{0.428684831f, 0.755926847f},
-std::array<float,2>{0.575901449f, 0.0413852222f},
-std::array<float,2>{0.260742575f, 0.148178235f},
-std::array<float,2>{0.700903654f, 0.884299755f},
-std::array<float,2>{0.176640198f, 0.716162086f},
-std::array<float,2>{0.978981733f, 0.463056087f},
-std::array<float,2>{0.344959468f, 0.352567941f},
-std::array<float,2>{0.648573637f, 0.57476151f},
-std::array<float,2>{0.246547133f, 0.817921996f},
-std::array<float,2>{0.879870772f, 0.108330995f},
-std::array<float,2>{0.0331908911f, 0.235982433f},
-std::array<float,2>{0.78273654f, 0.965477169f},
-std::array<float,2>{0.448535055f, 0.679777145f},
-std::array<float,2>{0.543566704f, 0.404529124f},
-std::array<float,2>{0.147781342f, 0.47919479f},
-std::array<float,2>{0.945306718f, 0.745335162f},
-std::array<float,2>{0.294316828f, 0.918016315f},
-std::array<float,2>{0.747370839f, 0.182888165f},
-std::array<float,2>{0.379797399f, 0.0249559954f},
-std::array<float,2>{0.608106196f, 0.802634001f},
-std::array<float,2>{0.0790641978f, 0.545242846f},
-std::array<float,2>{0.873825371f, 0.270669341f},
-std::array<float,2>{0.407245517f, 0.264506549f},
-std::array<float,2>{0.586288393f, 0.554644167f},
-std::array<float,2>{0.108671859f, 0.789899468f},
-std::array<float,2>{0.82723856f, 0.00767849199f},
-std::array<float,2>{0.162193075f, 0.157407388f},
-std::array<float,2>{0.986265063f, 0.930233181f},
-std::array<float,2>{0.270281523f, 0.728222907f},
-std::array<float,2>{0.712665677f, 0.49544093f},
-std::array<float,2>{0.00413155882f, 0.38805896f},
-std::array<float,2>{0.756188333f, 0.669167161f},
-std::array<float,2>{0.495410413f, 0.941580951f},
-std::array<float,2>{0.528299034f, 0.231223583f},
-std::array<float,2>{0.3302145f, 0.109630629f},
-std::array<float,2>{0.671880424f, 0.838720918f},
-std::array<float,2>{0.195943013f, 0.593453348f},
-std::array<float,2>{0.936307132f, 0.362358123f},
-std::array<float,2>{0.308811009f, 0.439355433f},
-std::array<float,2>{0.731630504f, 0.691293061f},
-std::array<float,2>{0.12995638f, 0.897834659f},
-std::array<float,2>{0.965070903f, 0.130813494f},
-std::array<float,2>{0.0670109317f, 0.0487124547f},
-std::array<float,2>{0.853817523f, 0.768316209f},
-std::array<float,2>{0.399555296f, 0.526993871f},
-std::array<float,2>{0.620075941f, 0.294557363f},
-std::array<float,2>{0.218800381f, 0.320519239f},
-std::array<float,2>{0.902377963f, 0.596131861f},
-std::array<float,2>{0.366502196f, 0.872450352f},
-std::array<float,2>{0.637128115f, 0.0696477592f},
-std::array<float,2>{0.467126191f, 0.200703382f},
-std::array<float,2>{0.546897411f, 0.988955557f},
-std::array<float,2>{0.0514636599f, 0.646356761f},
-std::array<float,2>{0.806414247f, 0.420227855f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.0695106164f, 0.726471782f},
-std::array<float,2>{0.552009046f, 0.285953611f},
-std::array<float,2>{0.47224924f, 0.145926058f},
-std::array<float,2>{0.993432283f, 0.787592828f},
-std::array<float,2>{0.282789767f, 0.993214965f},
-std::array<float,2>{0.750265718f, 0.0696902424f},
-std::array<float,2>{0.244573444f, 0.396016598f},
-std::array<float,2>{0.66088599f, 0.623815536f},
-std::array<float,2>{0.408687651f, 0.548753917f},
-std::array<float,2>{0.878135681f, 0.43880406f},
-std::array<float,2>{0.0439662635f, 0.0112071428f},
-std::array<float,2>{0.612765908f, 0.883141696f},
-std::array<float,2>{0.154516608f, 0.843378246f},
-std::array<float,2>{0.730164886f, 0.193649366f},
-std::array<float,2>{0.32569024f, 0.372684866f},
-std::array<float,2>{0.830805302f, 0.671486914f},
-std::array<float,2>{0.194350496f, 0.591082513f},
-std::array<float,2>{0.651424825f, 0.419783026f},
-std::array<float,2>{0.250497222f, 0.118647136f},
-std::array<float,2>{0.807970345f, 0.944616139f},
-std::array<float,2>{0.442162126f, 0.759385109f},
-std::array<float,2>{0.963596165f, 0.158305168f},
-std::array<float,2>{0.100949682f, 0.256261945f},
-std::array<float,2>{0.509934604f, 0.696408272f},
-std::array<float,2>{0.361599535f, 0.632513583f},
-std::array<float,2>{0.857492447f, 0.326456159f},
-std::array<float,2>{0.158380732f, 0.232027411f},
-std::array<float,2>{0.689995646f, 0.84891957f},
-std::array<float,2>{0.0141326711f, 0.92117846f},
-std::array<float,2>{0.591463566f, 0.0561664999f},
-std::array<float,2>{0.381997555f, 0.494593233f},
-std::array<float,2>{0.919333935f, 0.527363002f},
-std::array<float,2>{0.0522008985f, 0.50082159f},
-std::array<float,2>{0.600272655f, 0.475659043f},
-std::array<float,2>{0.431968302f, 0.0381552279f},
-std::array<float,2>{0.906021595f, 0.926975965f},
-std::array<float,2>{0.343263268f, 0.871535122f},
-std::array<float,2>{0.823134303f, 0.236892909f},
-std::array<float,2>{0.139740735f, 0.332257688f},
-std::array<float,2>{0.735057235f, 0.652160585f},
-std::array<float,2>{0.490674794f, 0.706120431f},
-std::array<float,2>{0.982624114f, 0.277833074f},
-std::array<float,2>{0.0869403556f, 0.184547022f},
-std::array<float,2>{0.541586459f, 0.77108866f},
-std::array<float,2>{0.220120326f, 0.956339002f},
-std::array<float,2>{0.677282572f, 0.104312532f},
-std::array<float,2>{0.300279766f, 0.43111971f},
-std::array<float,2>{0.770233154f, 0.56419611f},
-std::array<float,2>{0.174907267f, 0.674730718f},
-std::array<float,2>{0.713693082f, 0.34419924f},
-std::array<float,2>{0.345402479f, 0.20352979f},
-std::array<float,2>{0.871744275f, 0.812825799f},
-std::array<float,2>{0.397666425f, 0.897486627f},
-std::array<float,2>{0.923538208f, 0.0205121655f},
-std::array<float,2>{0.0157907065f, 0.457054079f},
-std::array<float,2>{0.570088804f, 0.54113251f},
-std::array<float,2>{0.278984368f, 0.609032094f},
-std::array<float,2>{0.784667134f, 0.382326424f},
-std::array<float,2>{0.204096794f, 0.0783480555f},
-std::array<float,2>{0.640220761f, 0.969681978f},
-std::array<float,2>{0.111425802f, 0.804839551f},
-std::array<float,2>{0.52769655f, 0.131408557f},
-std::array<float,2>{0.458506674f, 0.305865914f},
-std::array<float,2>{0.944312215f, 0.743308544f},
-std::array<float,2>{0.0258492455f, 0.64526546f},
-std::array<float,2>{0.571160257f, 0.342677504f},
-std::array<float,2>{0.400030047f, 0.247744873f},
-std::array<float,2>{0.936607242f, 0.86036551f},
-std::array<float,2>{0.353450865f, 0.933578849f},
-std::array<float,2>{0.864552379f, 0.0440716445f},
-std::array<float,2>{0.183632985f, 0.481203377f},
-std::array<float,2>{0.707986057f, 0.511249542f},
-std::array<float,2>{0.462501854f, 0.574183345f},
-std::array<float,2>{0.949355721f, 0.427207559f},
-std::array<float,2>{0.121787034f, 0.096703276f},
-std::array<float,2>{0.523129821f, 0.967069149f},
-std::array<float,2>{0.211801827f, 0.776904643f},
-std::array<float,2>{0.62518239f, 0.174431637f},
-std::array<float,2>{0.268607944f, 0.269716531f},
-std::array<float,2>{0.795214057f, 0.718013942f},
-std::array<float,2>{0.127616107f, 0.538410902f},
-std::array<float,2>{0.74590683f, 0.464808255f},
-std::array<float,2>{0.333778113f, 0.0286186151f},
-std::array<float,2>{0.81505847f, 0.905206382f},
-std::array<float,2>{0.425446808f, 0.82787329f},
-std::array<float,2>{0.897506177f, 0.218227684f},
-std::array<float,2>{0.0623705834f, 0.358686775f},
-std::array<float,2>{0.604676127f, 0.683139265f},
-std::array<float,2>{0.311960071f, 0.736240387f},
-std::array<float,2>{0.773949206f, 0.30423075f},
-std::array<float,2>{0.233615115f, 0.139484227f},
-std::array<float,2>{0.681755662f, 0.803249419f},
-std::array<float,2>{0.0840918198f, 0.984283447f},
-std::array<float,2>{0.533410788f, 0.0892107263f},
-std::array<float,2>{0.496741235f, 0.38899532f},
-std::array<float,2>{0.969613314f, 0.599706888f},
-std::array<float,2>{0.107578926f, 0.610103786f},
-std::array<float,2>{0.500088036f, 0.399772555f},
-std::array<float,2>{0.452206641f, 0.0758747235f},
-std::array<float,2>{0.95789659f, 0.991008818f},
-std::array<float,2>{0.260970235f, 0.793081164f},
-std::array<float,2>{0.798642278f, 0.15582864f},
-std::array<float,2>{0.19620502f, 0.290032268f},
-std::array<float,2>{0.644049942f, 0.733102858f},
-std::array<float,2>{0.385812908f, 0.659280777f},
-std::array<float,2>{0.907920957f, 0.365115374f},
-std::array<float,2>{0.00114864821f, 0.196085006f},
-std::array<float,2>{0.579231501f, 0.830785215f},
-std::array<float,2>{0.164581895f, 0.875553787f},
-std::array<float,2>{0.696475625f, 0.00308517646f},
-std::array<float,2>{0.374105215f, 0.446760654f},
-std::array<float,2>{0.851128638f, 0.558751166f},
-std::array<float,2>{0.241694361f, 0.693012834f},
-std::array<float,2>{0.669884264f, 0.259584606f},
-std::array<float,2>{0.296119958f, 0.167889103f},
-std::array<float,2>{0.759304047f, 0.753437519f},
-std::array<float,2>{0.48021993f, 0.952159286f},
-std::array<float,2>{0.987362683f, 0.113169082f},
-std::array<float,2>{0.0707525909f, 0.413367808f},
-std::array<float,2>{0.557437897f, 0.580384851f},
-std::array<float,2>{0.316729516f, 0.520037115f},
-std::array<float,2>{0.837904453f, 0.488254488f},
-std::array<float,2>{0.142230406f, 0.0509739183f},
-std::array<float,2>{0.719787657f, 0.913545012f},
-std::array<float,2>{0.0335281491f, 0.857663155f},
-std::array<float,2>{0.621977746f, 0.222165078f},
-std::array<float,2>{0.419709176f, 0.319053292f},
-std::array<float,2>{0.889897823f, 0.639659464f},
-std::array<float,2>{0.118286252f, 0.664548516f},
-std::array<float,2>{0.519277692f, 0.369952381f},
-std::array<float,2>{0.46709013f, 0.189810917f},
-std::array<float,2>{0.946824729f, 0.838300049f},
-std::array<float,2>{0.271028429f, 0.889317989f},
-std::array<float,2>{0.790127873f, 0.0127820615f},
-std::array<float,2>{0.216908902f, 0.445211709f},
-std::array<float,2>{0.629849494f, 0.553845406f},
-std::array<float,2>{0.403936356f, 0.620141208f},
-std::array<float,2>{0.931548536f, 0.393358976f},
-std::array<float,2>{0.0274329595f, 0.0630790889f},
-std::array<float,2>{0.575283289f, 0.999720514f},
-std::array<float,2>{0.179759279f, 0.78145653f},
-std::array<float,2>{0.704186797f, 0.144502237f},
-std::array<float,2>{0.358469337f, 0.285047829f},
-std::array<float,2>{0.859401286f, 0.722315252f},
-std::array<float,2>{0.228184342f, 0.525645196f},
-std::array<float,2>{0.685946167f, 0.49639681f},
-std::array<float,2>{0.308194607f, 0.061524909f},
-std::array<float,2>{0.78039521f, 0.914968371f},
-std::array<float,2>{0.4957228f, 0.844387591f},
-std::array<float,2>{0.973109961f, 0.227348283f},
-std::array<float,2>{0.0794028863f, 0.323503941f},
-std::array<float,2>{0.535731733f, 0.626130939f},
-std::array<float,2>{0.331442207f, 0.700930893f},
-std::array<float,2>{0.819666147f, 0.253629506f},
-std::array<float,2>{0.129378885f, 0.163843632f},
-std::array<float,2>{0.747960031f, 0.76556623f},
-std::array<float,2>{0.057405524f, 0.940863907f},
-std::array<float,2>{0.609132707f, 0.123377368f},
-std::array<float,2>{0.426396936f, 0.414117038f},
-std::array<float,2>{0.892498791f, 0.585947394f},
-std::array<float,2>{0.00731149083f, 0.570266068f},
-std::array<float,2>{0.585858226f, 0.435042202f},
-std::array<float,2>{0.387547582f, 0.109042093f},
-std::array<float,2>{0.911638737f, 0.957785428f},
-std::array<float,2>{0.370008558f, 0.768184602f},
-std::array<float,2>{0.845114052f, 0.182359278f},
-std::array<float,2>{0.168510243f, 0.276522249f},
-std::array<float,2>{0.700932205f, 0.70827353f},
-std::array<float,2>{0.449178427f, 0.655603111f},
-std::array<float,2>{0.956619501f, 0.328285843f},
-std::array<float,2>{0.10313803f, 0.241160497f},
-std::array<float,2>{0.507634044f, 0.870198369f},
-std::array<float,2>{0.201427877f, 0.921920717f},
-std::array<float,2>{0.648420632f, 0.0329723619f},
-std::array<float,2>{0.263962775f, 0.469209224f},
-std::array<float,2>{0.802611053f, 0.506167114f},
-std::array<float,2>{0.148004845f, 0.747239411f},
-std::array<float,2>{0.725964546f, 0.311533481f},
-std::array<float,2>{0.315357447f, 0.126166269f},
-std::array<float,2>{0.840247631f, 0.811935008f},
-std::array<float,2>{0.414652348f, 0.973494112f},
-std::array<float,2>{0.885469198f, 0.0849760696f},
-std::array<float,2>{0.038179595f, 0.375673115f},
-std::array<float,2>{0.620778859f, 0.602222264f},
-std::array<float,2>{0.291542143f, 0.544451416f},
-std::array<float,2>{0.762911618f, 0.454793185f},
-std::array<float,2>{0.236995444f, 0.0184753072f},
-std::array<float,2>{0.667188525f, 0.891366959f},
-std::array<float,2>{0.0765742809f, 0.81783855f},
-std::array<float,2>{0.560055375f, 0.207062766f},
-std::array<float,2>{0.482284397f, 0.347656608f},
-std::array<float,2>{0.992022395f, 0.675938487f},
-std::array<float,2>{0.0397799276f, 0.712085962f},
-std::array<float,2>{0.614042521f, 0.267799258f},
-std::array<float,2>{0.413746953f, 0.176952496f},
-std::array<float,2>{0.882358372f, 0.780442774f},
-std::array<float,2>{0.322683394f, 0.961257279f},
-std::array<float,2>{0.835491478f, 0.0999046415f},
-std::array<float,2>{0.152136803f, 0.425059885f},
-std::array<float,2>{0.731755257f, 0.576631188f},
-std::array<float,2>{0.475146919f, 0.515132308f},
-std::array<float,2>{0.999043465f, 0.477676719f},
-std::array<float,2>{0.065392606f, 0.042554047f},
-std::array<float,2>{0.549552202f, 0.935796976f},
-std::array<float,2>{0.249160558f, 0.866286814f},
-std::array<float,2>{0.658973515f, 0.243043572f},
-std::array<float,2>{0.288094491f, 0.33661738f},
-std::array<float,2>{0.757694721f, 0.641305685f},
-std::array<float,2>{0.163793728f, 0.594237983f},
-std::array<float,2>{0.693596005f, 0.384396762f},
-std::array<float,2>{0.366384059f, 0.0902161822f},
-std::array<float,2>{0.85436821f, 0.977619886f},
-std::array<float,2>{0.378436089f, 0.798069358f},
-std::array<float,2>{0.914855719f, 0.133956119f},
-std::array<float,2>{0.0115908897f, 0.297600627f},
-std::array<float,2>{0.58786267f, 0.741207302f},
-std::array<float,2>{0.254477799f, 0.684577107f},
-std::array<float,2>{0.812482536f, 0.35258159f},
-std::array<float,2>{0.190522119f, 0.21100226f},
-std::array<float,2>{0.65536952f, 0.82254529f},
-std::array<float,2>{0.0944541842f, 0.900865376f},
-std::array<float,2>{0.512655556f, 0.0265232138f},
-std::array<float,2>{0.437612951f, 0.466930121f},
-std::array<float,2>{0.966974556f, 0.532616138f},
-std::array<float,2>{0.0913048908f, 0.557468057f},
-std::array<float,2>{0.545525193f, 0.453003258f},
-std::array<float,2>{0.484671444f, 0.0050188778f},
-std::array<float,2>{0.978424549f, 0.87934953f},
-std::array<float,2>{0.302804261f, 0.834867597f},
-std::array<float,2>{0.769221902f, 0.201906949f},
-std::array<float,2>{0.223267898f, 0.361673325f},
-std::array<float,2>{0.672186553f, 0.663670242f},
-std::array<float,2>{0.435017616f, 0.729665577f},
-std::array<float,2>{0.899125874f, 0.293264836f},
-std::array<float,2>{0.0475322567f, 0.148607954f},
-std::array<float,2>{0.594637334f, 0.792109728f},
-std::array<float,2>{0.13334696f, 0.986952066f},
-std::array<float,2>{0.739815354f, 0.0729582608f},
-std::array<float,2>{0.338776976f, 0.403895885f},
-std::array<float,2>{0.825995922f, 0.616459429f},
-std::array<float,2>{0.207345888f, 0.633580148f},
-std::array<float,2>{0.634536088f, 0.313492447f},
-std::array<float,2>{0.27432397f, 0.223092049f},
-std::array<float,2>{0.786561012f, 0.854417622f},
-std::array<float,2>{0.455686867f, 0.907899201f},
-std::array<float,2>{0.940490484f, 0.0475978218f},
-std::array<float,2>{0.116485968f, 0.491784692f},
-std::array<float,2>{0.524736166f, 0.518643022f},
-std::array<float,2>{0.348929673f, 0.583205819f},
-std::array<float,2>{0.868368506f, 0.406408757f},
-std::array<float,2>{0.178652883f, 0.113702834f},
-std::array<float,2>{0.717665672f, 0.948873997f},
-std::array<float,2>{0.0198359657f, 0.755701125f},
-std::array<float,2>{0.564137757f, 0.171595663f},
-std::array<float,2>{0.393049031f, 0.262487292f},
-std::array<float,2>{0.92654568f, 0.690989137f},
-std::array<float,2>{0.0985135883f, 0.69917649f},
-std::array<float,2>{0.509101272f, 0.255208641f},
-std::array<float,2>{0.444351584f, 0.156532943f},
-std::array<float,2>{0.961821616f, 0.760506034f},
-std::array<float,2>{0.25276491f, 0.943148911f},
-std::array<float,2>{0.804901838f, 0.119798884f},
-std::array<float,2>{0.191941366f, 0.421536744f},
-std::array<float,2>{0.650254667f, 0.59242785f},
-std::array<float,2>{0.379512817f, 0.530441701f},
-std::array<float,2>{0.920286298f, 0.493230402f},
-std::array<float,2>{0.0120923026f, 0.0568333939f},
-std::array<float,2>{0.592727304f, 0.918070853f},
-std::array<float,2>{0.156562343f, 0.851546466f},
-std::array<float,2>{0.688287079f, 0.234251887f},
-std::array<float,2>{0.360058397f, 0.325622112f},
-std::array<float,2>{0.856342494f, 0.629198611f},
-std::array<float,2>{0.244059831f, 0.623014688f},
-std::array<float,2>{0.663665116f, 0.397120118f},
-std::array<float,2>{0.283945113f, 0.067124024f},
-std::array<float,2>{0.752976298f, 0.996089518f},
-std::array<float,2>{0.468793899f, 0.785411716f},
-std::array<float,2>{0.994517386f, 0.14666602f},
-std::array<float,2>{0.066467233f, 0.288500041f},
-std::array<float,2>{0.554476142f, 0.724124968f},
-std::array<float,2>{0.326905966f, 0.668229461f},
-std::array<float,2>{0.829864025f, 0.3737019f},
-std::array<float,2>{0.153959662f, 0.191938385f},
-std::array<float,2>{0.7279495f, 0.841237307f},
-std::array<float,2>{0.04608633f, 0.88638109f},
-std::array<float,2>{0.609918892f, 0.00963004306f},
-std::array<float,2>{0.407779425f, 0.440263599f},
-std::array<float,2>{0.875083208f, 0.550350189f},
-std::array<float,2>{0.017601531f, 0.54060483f},
-std::array<float,2>{0.567996323f, 0.459244221f},
-std::array<float,2>{0.395753175f, 0.0228701122f},
-std::array<float,2>{0.924781263f, 0.894879758f},
-std::array<float,2>{0.34764275f, 0.816231966f},
-std::array<float,2>{0.87309438f, 0.206111446f},
-std::array<float,2>{0.17263642f, 0.346824378f},
-std::array<float,2>{0.712446749f, 0.673600018f},
-std::array<float,2>{0.459176421f, 0.745553195f},
-std::array<float,2>{0.943098903f, 0.307328105f},
-std::array<float,2>{0.110439025f, 0.128955245f},
-std::array<float,2>{0.530380607f, 0.808260083f},
-std::array<float,2>{0.206851482f, 0.971560657f},
-std::array<float,2>{0.637075484f, 0.0817993507f},
-std::array<float,2>{0.281014204f, 0.379303545f},
-std::array<float,2>{0.783022523f, 0.606984675f},
-std::array<float,2>{0.136898175f, 0.649722934f},
-std::array<float,2>{0.738018572f, 0.335370839f},
-std::array<float,2>{0.341204107f, 0.235829979f},
-std::array<float,2>{0.821612716f, 0.873377323f},
-std::array<float,2>{0.430818021f, 0.927890182f},
-std::array<float,2>{0.903612554f, 0.0354205519f},
-std::array<float,2>{0.0531222112f, 0.473206997f},
-std::array<float,2>{0.598485291f, 0.503789067f},
-std::array<float,2>{0.297835052f, 0.565845191f},
-std::array<float,2>{0.772409439f, 0.433229625f},
-std::array<float,2>{0.222427517f, 0.102268025f},
-std::array<float,2>{0.677940965f, 0.954991341f},
-std::array<float,2>{0.0894316286f, 0.773360014f},
-std::array<float,2>{0.539285183f, 0.18710193f},
-std::array<float,2>{0.488404095f, 0.280758947f},
-std::array<float,2>{0.981618822f, 0.704460382f},
-std::array<float,2>{0.0602161139f, 0.680641294f},
-std::array<float,2>{0.601834536f, 0.355914176f},
-std::array<float,2>{0.423770189f, 0.215671629f},
-std::array<float,2>{0.895975292f, 0.826035082f},
-std::array<float,2>{0.334370762f, 0.903203547f},
-std::array<float,2>{0.813025355f, 0.0298877396f},
-std::array<float,2>{0.125163198f, 0.46278277f},
-std::array<float,2>{0.74364382f, 0.535351276f},
-std::array<float,2>{0.499865353f, 0.599596322f},
-std::array<float,2>{0.970793128f, 0.387372732f},
-std::array<float,2>{0.0834188238f, 0.0864984542f},
-std::array<float,2>{0.532318234f, 0.980884612f},
-std::array<float,2>{0.231528133f, 0.801896989f},
-std::array<float,2>{0.680081427f, 0.137809485f},
-std::array<float,2>{0.310010523f, 0.302564979f},
-std::array<float,2>{0.776221573f, 0.738122821f},
-std::array<float,2>{0.187333405f, 0.508729219f},
-std::array<float,2>{0.71022445f, 0.483839452f},
-std::array<float,2>{0.353674978f, 0.0462728627f},
-std::array<float,2>{0.866064072f, 0.930410922f},
-std::array<float,2>{0.401860118f, 0.862196207f},
-std::array<float,2>{0.933971286f, 0.248832062f},
-std::array<float,2>{0.0242745746f, 0.341184258f},
-std::array<float,2>{0.57233417f, 0.647841036f},
-std::array<float,2>{0.26729995f, 0.715366185f},
-std::array<float,2>{0.794687808f, 0.272449642f},
-std::array<float,2>{0.214563876f, 0.172502458f},
-std::array<float,2>{0.627987325f, 0.774282157f},
-std::array<float,2>{0.123613678f, 0.96658504f},
-std::array<float,2>{0.520672917f, 0.0948127434f},
-std::array<float,2>{0.464449465f, 0.428276777f},
-std::array<float,2>{0.952860057f, 0.571292877f},
-std::array<float,2>{0.0734802112f, 0.579785824f},
-std::array<float,2>{0.556227446f, 0.410951227f},
-std::array<float,2>{0.478139579f, 0.111153543f},
-std::array<float,2>{0.985817909f, 0.949825883f},
-std::array<float,2>{0.293962061f, 0.751784801f},
-std::array<float,2>{0.760367334f, 0.164771885f},
-std::array<float,2>{0.239470422f, 0.261272013f},
-std::array<float,2>{0.67176199f, 0.693995655f},
-std::array<float,2>{0.420355022f, 0.636842251f},
-std::array<float,2>{0.888438344f, 0.318283856f},
-std::array<float,2>{0.0331919342f, 0.21887514f},
-std::array<float,2>{0.623532653f, 0.856918931f},
-std::array<float,2>{0.143615514f, 0.911854744f},
-std::array<float,2>{0.722190738f, 0.0544326976f},
-std::array<float,2>{0.318807334f, 0.484728158f},
-std::array<float,2>{0.836043954f, 0.522536218f},
-std::array<float,2>{0.19774276f, 0.732264161f},
-std::array<float,2>{0.641126871f, 0.291096151f},
-std::array<float,2>{0.259329647f, 0.1534435f},
-std::array<float,2>{0.799918234f, 0.795786023f},
-std::array<float,2>{0.450596064f, 0.988812208f},
-std::array<float,2>{0.959455609f, 0.0776841715f},
-std::array<float,2>{0.106301427f, 0.402038038f},
-std::array<float,2>{0.502432108f, 0.612597823f},
-std::array<float,2>{0.371106118f, 0.561035872f},
-std::array<float,2>{0.849392056f, 0.447946876f},
-std::array<float,2>{0.166016817f, 0.000444833946f},
-std::array<float,2>{0.697290659f, 0.87748462f},
-std::array<float,2>{0.00208958914f, 0.83000356f},
-std::array<float,2>{0.581916273f, 0.198481634f},
-std::array<float,2>{0.383266538f, 0.366843194f},
-std::array<float,2>{0.909942389f, 0.657731116f},
-std::array<float,2>{0.080582954f, 0.628591657f},
-std::array<float,2>{0.537675321f, 0.320888102f},
-std::array<float,2>{0.492970169f, 0.229302377f},
-std::array<float,2>{0.975788593f, 0.846207738f},
-std::array<float,2>{0.306300551f, 0.916949749f},
-std::array<float,2>{0.778258979f, 0.0596501231f},
-std::array<float,2>{0.230156332f, 0.499724984f},
-std::array<float,2>{0.683661819f, 0.524008036f},
-std::array<float,2>{0.428449541f, 0.589049041f},
-std::array<float,2>{0.894150019f, 0.417753041f},
-std::array<float,2>{0.0557698198f, 0.121308722f},
-std::array<float,2>{0.606975019f, 0.93812716f},
-std::array<float,2>{0.131700367f, 0.762642145f},
-std::array<float,2>{0.748329282f, 0.1612048f},
-std::array<float,2>{0.329192668f, 0.25084886f},
-std::array<float,2>{0.816927135f, 0.702584505f},
-std::array<float,2>{0.215086028f, 0.5518682f},
-std::array<float,2>{0.632805467f, 0.441854268f},
-std::array<float,2>{0.272834301f, 0.0144911911f},
-std::array<float,2>{0.792035341f, 0.887620032f},
-std::array<float,2>{0.46598497f, 0.836816788f},
-std::array<float,2>{0.947623193f, 0.187684789f},
-std::array<float,2>{0.120732583f, 0.368328452f},
-std::array<float,2>{0.516072214f, 0.667030096f},
-std::array<float,2>{0.355752975f, 0.720363557f},
-std::array<float,2>{0.862432301f, 0.282354802f},
-std::array<float,2>{0.182133764f, 0.141828656f},
-std::array<float,2>{0.705515087f, 0.784235895f},
-std::array<float,2>{0.0293290298f, 0.997047842f},
-std::array<float,2>{0.576391637f, 0.0649985522f},
-std::array<float,2>{0.404780239f, 0.3913064f},
-std::array<float,2>{0.932741523f, 0.61896497f},
-std::array<float,2>{0.0364487916f, 0.604692519f},
-std::array<float,2>{0.618226588f, 0.377911717f},
-std::array<float,2>{0.416522145f, 0.0832831711f},
-std::array<float,2>{0.884254396f, 0.975724578f},
-std::array<float,2>{0.313696653f, 0.810462177f},
-std::array<float,2>{0.843745947f, 0.127530396f},
-std::array<float,2>{0.145887628f, 0.310142219f},
-std::array<float,2>{0.723429859f, 0.748790979f},
-std::array<float,2>{0.483264506f, 0.677964687f},
-std::array<float,2>{0.990163088f, 0.350831717f},
-std::array<float,2>{0.0759520605f, 0.210461393f},
-std::array<float,2>{0.561103284f, 0.819396436f},
-std::array<float,2>{0.23491098f, 0.893567264f},
-std::array<float,2>{0.66557318f, 0.0173493885f},
-std::array<float,2>{0.28988561f, 0.456374079f},
-std::array<float,2>{0.764715731f, 0.545226514f},
-std::array<float,2>{0.170386031f, 0.710429311f},
-std::array<float,2>{0.702385962f, 0.275264621f},
-std::array<float,2>{0.368830025f, 0.181047261f},
-std::array<float,2>{0.846645415f, 0.767197728f},
-std::array<float,2>{0.389462084f, 0.959479094f},
-std::array<float,2>{0.913249254f, 0.10723038f},
-std::array<float,2>{0.00457504764f, 0.436180562f},
-std::array<float,2>{0.583007574f, 0.567181051f},
-std::array<float,2>{0.263189048f, 0.505093157f},
-std::array<float,2>{0.803913474f, 0.470732719f},
-std::array<float,2>{0.200864807f, 0.0339731984f},
-std::array<float,2>{0.644640386f, 0.924798727f},
-std::array<float,2>{0.104086384f, 0.868786931f},
-std::array<float,2>{0.505444646f, 0.238472268f},
-std::array<float,2>{0.446334958f, 0.33156386f},
-std::array<float,2>{0.954886854f, 0.652436614f},
-std::array<float,2>{0.00885941554f, 0.739857495f},
-std::array<float,2>{0.588081777f, 0.29996416f},
-std::array<float,2>{0.376326084f, 0.136340111f},
-std::array<float,2>{0.916761458f, 0.798942566f},
-std::array<float,2>{0.36381492f, 0.980016291f},
-std::array<float,2>{0.852604866f, 0.0924020484f},
-std::array<float,2>{0.161566585f, 0.384952277f},
-std::array<float,2>{0.692446172f, 0.596794486f},
-std::array<float,2>{0.440144181f, 0.534135878f},
-std::array<float,2>{0.966125131f, 0.466417581f},
-std::array<float,2>{0.095816724f, 0.0236846358f},
-std::array<float,2>{0.513804913f, 0.899905205f},
-std::array<float,2>{0.189186186f, 0.822011352f},
-std::array<float,2>{0.654222071f, 0.213669136f},
-std::array<float,2>{0.257106692f, 0.354447275f},
-std::array<float,2>{0.810215473f, 0.686727703f},
-std::array<float,2>{0.149242997f, 0.575029194f},
-std::array<float,2>{0.734249413f, 0.422822386f},
-std::array<float,2>{0.320502847f, 0.0978360474f},
-std::array<float,2>{0.832875431f, 0.964548469f},
-std::array<float,2>{0.410506815f, 0.777663291f},
-std::array<float,2>{0.879934072f, 0.179208398f},
-std::array<float,2>{0.0428765528f, 0.265873671f},
-std::array<float,2>{0.616545439f, 0.713016391f},
-std::array<float,2>{0.286878109f, 0.64434135f},
-std::array<float,2>{0.754083991f, 0.33844614f},
-std::array<float,2>{0.24684532f, 0.244451731f},
-std::array<float,2>{0.656269193f, 0.865163684f},
-std::array<float,2>{0.0629676878f, 0.935371399f},
-std::array<float,2>{0.548124313f, 0.04044649f},
-std::array<float,2>{0.473415583f, 0.479369611f},
-std::array<float,2>{0.997945786f, 0.512253344f},
-std::array<float,2>{0.113711901f, 0.516806901f},
-std::array<float,2>{0.52700454f, 0.489194423f},
-std::array<float,2>{0.45368284f, 0.0493002795f},
-std::array<float,2>{0.938282728f, 0.909330606f},
-std::array<float,2>{0.276697308f, 0.853237391f},
-std::array<float,2>{0.787649512f, 0.225074291f},
-std::array<float,2>{0.210708946f, 0.3154248f},
-std::array<float,2>{0.635931849f, 0.63631624f},
-std::array<float,2>{0.391702473f, 0.687936664f},
-std::array<float,2>{0.927970469f, 0.265226543f},
-std::array<float,2>{0.0229468383f, 0.169600993f},
-std::array<float,2>{0.565765083f, 0.75720048f},
-std::array<float,2>{0.177106634f, 0.946755469f},
-std::array<float,2>{0.716197848f, 0.115893885f},
-std::array<float,2>{0.350376695f, 0.409874827f},
-std::array<float,2>{0.869326115f, 0.585501313f},
-std::array<float,2>{0.225828722f, 0.661105037f},
-std::array<float,2>{0.675713718f, 0.360376209f},
-std::array<float,2>{0.302638054f, 0.199606821f},
-std::array<float,2>{0.76724261f, 0.833960176f},
-std::array<float,2>{0.487168521f, 0.881525695f},
-std::array<float,2>{0.979745448f, 0.0069929501f},
-std::array<float,2>{0.0932997689f, 0.450318307f},
-std::array<float,2>{0.5445925f, 0.554722786f},
-std::array<float,2>{0.33594963f, 0.614200711f},
-std::array<float,2>{0.826791763f, 0.404843658f},
-std::array<float,2>{0.135914549f, 0.0709825158f},
-std::array<float,2>{0.740828276f, 0.984975159f},
-std::array<float,2>{0.0505903326f, 0.789607942f},
-std::array<float,2>{0.595754743f, 0.151640147f},
-std::array<float,2>{0.436733454f, 0.296240926f},
-std::array<float,2>{0.901606619f, 0.72774601f},
-std::array<float,2>{0.109859116f, 0.74284929f},
-std::array<float,2>{0.529473245f, 0.304810882f},
-std::array<float,2>{0.460932821f, 0.132550225f},
-std::array<float,2>{0.942271352f, 0.805927038f},
-std::array<float,2>{0.280210853f, 0.970615208f},
-std::array<float,2>{0.78136766f, 0.0791156143f},
-std::array<float,2>{0.205894589f, 0.381578296f},
-std::array<float,2>{0.638604999f, 0.608034492f},
-std::array<float,2>{0.394898295f, 0.542956948f},
-std::array<float,2>{0.925239563f, 0.458947062f},
-std::array<float,2>{0.0192452222f, 0.0196279734f},
-std::array<float,2>{0.566437662f, 0.897294581f},
-std::array<float,2>{0.173059583f, 0.813510478f},
-std::array<float,2>{0.710969329f, 0.204482809f},
-std::array<float,2>{0.346409142f, 0.344930261f},
-std::array<float,2>{0.874526739f, 0.67491287f},
-std::array<float,2>{0.220905855f, 0.562556982f},
-std::array<float,2>{0.679168463f, 0.430335015f},
-std::array<float,2>{0.298564792f, 0.104709513f},
-std::array<float,2>{0.772556901f, 0.956006408f},
-std::array<float,2>{0.489499509f, 0.770022571f},
-std::array<float,2>{0.981317997f, 0.185196921f},
-std::array<float,2>{0.0879812986f, 0.278541028f},
-std::array<float,2>{0.540080845f, 0.705524206f},
-std::array<float,2>{0.340775549f, 0.651156843f},
-std::array<float,2>{0.82086134f, 0.333872855f},
-std::array<float,2>{0.138273194f, 0.237552464f},
-std::array<float,2>{0.736427903f, 0.87209636f},
-std::array<float,2>{0.0544675402f, 0.926580846f},
-std::array<float,2>{0.598847032f, 0.0371134505f},
-std::array<float,2>{0.430306196f, 0.474995136f},
-std::array<float,2>{0.902503729f, 0.501786649f},
-std::array<float,2>{0.0136711961f, 0.528901637f},
-std::array<float,2>{0.592820048f, 0.49544999f},
-std::array<float,2>{0.380696565f, 0.0555245988f},
-std::array<float,2>{0.921156168f, 0.920675695f},
-std::array<float,2>{0.361012638f, 0.848286152f},
-std::array<float,2>{0.856940091f, 0.23065412f},
-std::array<float,2>{0.157387629f, 0.327664912f},
-std::array<float,2>{0.688544631f, 0.630895436f},
-std::array<float,2>{0.443600029f, 0.695737183f},
-std::array<float,2>{0.96272099f, 0.257716715f},
-std::array<float,2>{0.0992974639f, 0.159182921f},
-std::array<float,2>{0.508355021f, 0.758035898f},
-std::array<float,2>{0.19267714f, 0.94411844f},
-std::array<float,2>{0.649250209f, 0.118004449f},
-std::array<float,2>{0.253368139f, 0.41805923f},
-std::array<float,2>{0.806628048f, 0.590112448f},
-std::array<float,2>{0.152797207f, 0.670716941f},
-std::array<float,2>{0.72751528f, 0.371692777f},
-std::array<float,2>{0.327354908f, 0.194953352f},
-std::array<float,2>{0.828297615f, 0.842336655f},
-std::array<float,2>{0.406904697f, 0.884705365f},
-std::array<float,2>{0.876152277f, 0.0100523029f},
-std::array<float,2>{0.0452322885f, 0.437596262f},
-std::array<float,2>{0.610819876f, 0.547716081f},
-std::array<float,2>{0.284551859f, 0.624377906f},
-std::array<float,2>{0.752670884f, 0.394599676f},
-std::array<float,2>{0.2429948f, 0.0692068487f},
-std::array<float,2>{0.66289264f, 0.992528796f},
-std::array<float,2>{0.0674911961f, 0.788280547f},
-std::array<float,2>{0.553539515f, 0.144820839f},
-std::array<float,2>{0.470568031f, 0.286477476f},
-std::array<float,2>{0.995913565f, 0.725111187f},
-std::array<float,2>{0.0314418823f, 0.639406562f},
-std::array<float,2>{0.624500215f, 0.319375098f},
-std::array<float,2>{0.420935988f, 0.221583098f},
-std::array<float,2>{0.887198687f, 0.858533084f},
-std::array<float,2>{0.319600999f, 0.912599683f},
-std::array<float,2>{0.837857187f, 0.052102305f},
-std::array<float,2>{0.143544361f, 0.486450374f},
-std::array<float,2>{0.720775902f, 0.521422029f},
-std::array<float,2>{0.47699675f, 0.581285894f},
-std::array<float,2>{0.98477298f, 0.41305989f},
-std::array<float,2>{0.0730610564f, 0.112287395f},
-std::array<float,2>{0.555373073f, 0.951342583f},
-std::array<float,2>{0.23903434f, 0.752575099f},
-std::array<float,2>{0.670867622f, 0.166274175f},
-std::array<float,2>{0.293672293f, 0.258247197f},
-std::array<float,2>{0.760818064f, 0.692330956f},
-std::array<float,2>{0.167617828f, 0.560415864f},
-std::array<float,2>{0.69907999f, 0.445735067f},
-std::array<float,2>{0.372518718f, 0.0025959909f},
-std::array<float,2>{0.848499238f, 0.876475215f},
-std::array<float,2>{0.383814752f, 0.83165133f},
-std::array<float,2>{0.908203483f, 0.196661308f},
-std::array<float,2>{0.00348940212f, 0.363477498f},
-std::array<float,2>{0.580290556f, 0.659154654f},
-std::array<float,2>{0.258788556f, 0.733756721f},
-std::array<float,2>{0.798971176f, 0.290645212f},
-std::array<float,2>{0.198775411f, 0.154810101f},
-std::array<float,2>{0.641740084f, 0.794382274f},
-std::array<float,2>{0.106763057f, 0.991736293f},
-std::array<float,2>{0.503641427f, 0.0743483827f},
-std::array<float,2>{0.449294657f, 0.399382591f},
-std::array<float,2>{0.960197031f, 0.61103487f},
-std::array<float,2>{0.0827485844f, 0.601400495f},
-std::array<float,2>{0.53181994f, 0.390333444f},
-std::array<float,2>{0.498131394f, 0.0879808143f},
-std::array<float,2>{0.972605646f, 0.983181596f},
-std::array<float,2>{0.308629066f, 0.804564297f},
-std::array<float,2>{0.776835322f, 0.139677301f},
-std::array<float,2>{0.23108466f, 0.303055525f},
-std::array<float,2>{0.681136131f, 0.734609544f},
-std::array<float,2>{0.42270574f, 0.681846976f},
-std::array<float,2>{0.894788504f, 0.358280897f},
-std::array<float,2>{0.0587063357f, 0.217125714f},
-std::array<float,2>{0.603245318f, 0.826331735f},
-std::array<float,2>{0.126663581f, 0.905968308f},
-std::array<float,2>{0.742610872f, 0.0280776378f},
-std::array<float,2>{0.335401505f, 0.463432431f},
-std::array<float,2>{0.814016521f, 0.537981927f},
-std::array<float,2>{0.213736653f, 0.717330575f},
-std::array<float,2>{0.627880633f, 0.271026045f},
-std::array<float,2>{0.266163915f, 0.175469533f},
-std::array<float,2>{0.793188095f, 0.776242256f},
-std::array<float,2>{0.463526726f, 0.968645811f},
-std::array<float,2>{0.951314211f, 0.0965650827f},
-std::array<float,2>{0.124719478f, 0.426740527f},
-std::array<float,2>{0.520151138f, 0.572990775f},
-std::array<float,2>{0.354802817f, 0.510648072f},
-std::array<float,2>{0.86667484f, 0.481695026f},
-std::array<float,2>{0.185663566f, 0.0436427668f},
-std::array<float,2>{0.70906508f, 0.932027698f},
-std::array<float,2>{0.0246906355f, 0.85944134f},
-std::array<float,2>{0.574003637f, 0.247059196f},
-std::array<float,2>{0.400616467f, 0.342818409f},
-std::array<float,2>{0.935014188f, 0.645945251f},
-std::array<float,2>{0.0747768134f, 0.677523911f},
-std::array<float,2>{0.561974049f, 0.349048942f},
-std::array<float,2>{0.484301269f, 0.208923727f},
-std::array<float,2>{0.988331795f, 0.817114413f},
-std::array<float,2>{0.290752172f, 0.892353296f},
-std::array<float,2>{0.764534533f, 0.0194701478f},
-std::array<float,2>{0.23569724f, 0.454037309f},
-std::array<float,2>{0.664971709f, 0.543795884f},
-std::array<float,2>{0.417367846f, 0.602637172f},
-std::array<float,2>{0.883132756f, 0.376412392f},
-std::array<float,2>{0.0356024615f, 0.0846203417f},
-std::array<float,2>{0.617783606f, 0.973896325f},
-std::array<float,2>{0.144926906f, 0.811107457f},
-std::array<float,2>{0.724044621f, 0.125253141f},
-std::array<float,2>{0.312985003f, 0.310623199f},
-std::array<float,2>{0.841893971f, 0.746615648f},
-std::array<float,2>{0.199654028f, 0.507199883f},
-std::array<float,2>{0.645802557f, 0.469752073f},
-std::array<float,2>{0.262179971f, 0.0320365317f},
-std::array<float,2>{0.803669393f, 0.92365098f},
-std::array<float,2>{0.445376903f, 0.869183242f},
-std::array<float,2>{0.9534778f, 0.242067248f},
-std::array<float,2>{0.105136804f, 0.329660356f},
-std::array<float,2>{0.5045982f, 0.654527545f},
-std::array<float,2>{0.368093997f, 0.707279682f},
-std::array<float,2>{0.847084165f, 0.275606513f},
-std::array<float,2>{0.171054959f, 0.183509752f},
-std::array<float,2>{0.701334655f, 0.769527197f},
-std::array<float,2>{0.00570378499f, 0.958580315f},
-std::array<float,2>{0.58325398f, 0.108161964f},
-std::array<float,2>{0.390611768f, 0.434303492f},
-std::array<float,2>{0.912279546f, 0.568726778f},
-std::array<float,2>{0.0555337481f, 0.587146878f},
-std::array<float,2>{0.605713427f, 0.415142506f},
-std::array<float,2>{0.429633856f, 0.124137998f},
-std::array<float,2>{0.893268764f, 0.939468265f},
-std::array<float,2>{0.32902655f, 0.764537096f},
-std::array<float,2>{0.817647338f, 0.162307441f},
-std::array<float,2>{0.132517964f, 0.252156973f},
-std::array<float,2>{0.749254286f, 0.699305773f},
-std::array<float,2>{0.493289143f, 0.625405312f},
-std::array<float,2>{0.975564599f, 0.322855324f},
-std::array<float,2>{0.0819614157f, 0.227954566f},
-std::array<float,2>{0.538500547f, 0.844873488f},
-std::array<float,2>{0.228758082f, 0.915845692f},
-std::array<float,2>{0.68463099f, 0.0614853539f},
-std::array<float,2>{0.305523336f, 0.497398138f},
-std::array<float,2>{0.778557539f, 0.52727735f},
-std::array<float,2>{0.183054686f, 0.721261203f},
-std::array<float,2>{0.706999242f, 0.283874542f},
-std::array<float,2>{0.357188046f, 0.142675519f},
-std::array<float,2>{0.861743033f, 0.782652497f},
-std::array<float,2>{0.405405343f, 0.998130143f},
-std::array<float,2>{0.932451248f, 0.0643590093f},
-std::array<float,2>{0.0310771521f, 0.393642515f},
-std::array<float,2>{0.577457011f, 0.61947608f},
-std::array<float,2>{0.271519929f, 0.553457797f},
-std::array<float,2>{0.791032851f, 0.44411096f},
-std::array<float,2>{0.215874314f, 0.0123805488f},
-std::array<float,2>{0.631357729f, 0.890062511f},
-std::array<float,2>{0.119166762f, 0.83921361f},
-std::array<float,2>{0.516786814f, 0.190459728f},
-std::array<float,2>{0.464921564f, 0.370878845f},
-std::array<float,2>{0.948306561f, 0.665779829f},
-std::array<float,2>{0.021948779f, 0.689693749f},
-std::array<float,2>{0.564951658f, 0.263030231f},
-std::array<float,2>{0.391415626f, 0.17064999f},
-std::array<float,2>{0.929023445f, 0.754598439f},
-std::array<float,2>{0.35071373f, 0.947354555f},
-std::array<float,2>{0.870207846f, 0.114765726f},
-std::array<float,2>{0.17665121f, 0.408170998f},
-std::array<float,2>{0.71490097f, 0.582690656f},
-std::array<float,2>{0.454945743f, 0.517771542f},
-std::array<float,2>{0.938511252f, 0.490298003f},
-std::array<float,2>{0.114679568f, 0.0478882045f},
-std::array<float,2>{0.526271284f, 0.907038271f},
-std::array<float,2>{0.20953007f, 0.855102658f},
-std::array<float,2>{0.635731697f, 0.224000812f},
-std::array<float,2>{0.27620095f, 0.313380897f},
-std::array<float,2>{0.788195252f, 0.634411395f},
-std::array<float,2>{0.135703132f, 0.61548847f},
-std::array<float,2>{0.741981924f, 0.402920544f},
-std::array<float,2>{0.337805182f, 0.0737083256f},
-std::array<float,2>{0.827824891f, 0.98818177f},
-std::array<float,2>{0.435746163f, 0.791568458f},
-std::array<float,2>{0.901256263f, 0.149977818f},
-std::array<float,2>{0.0489811338f, 0.294660032f},
-std::array<float,2>{0.597655535f, 0.728881121f},
-std::array<float,2>{0.301673353f, 0.662277997f},
-std::array<float,2>{0.765812278f, 0.363087982f},
-std::array<float,2>{0.224675909f, 0.202601567f},
-std::array<float,2>{0.67459631f, 0.835614502f},
-std::array<float,2>{0.0922036171f, 0.879985869f},
-std::array<float,2>{0.543672442f, 0.00439951336f},
-std::array<float,2>{0.487698823f, 0.451871991f},
-std::array<float,2>{0.979102671f, 0.557663321f},
-std::array<float,2>{0.096723564f, 0.531909168f},
-std::array<float,2>{0.515451908f, 0.468521237f},
-std::array<float,2>{0.440782875f, 0.0257425867f},
-std::array<float,2>{0.964946389f, 0.901952267f},
-std::array<float,2>{0.256715089f, 0.824072123f},
-std::array<float,2>{0.809394121f, 0.212403491f},
-std::array<float,2>{0.188458115f, 0.351591915f},
-std::array<float,2>{0.653310478f, 0.684177876f},
-std::array<float,2>{0.375766695f, 0.741758049f},
-std::array<float,2>{0.917558968f, 0.298465848f},
-std::array<float,2>{0.00868129078f, 0.132915288f},
-std::array<float,2>{0.589277804f, 0.79722482f},
-std::array<float,2>{0.160639837f, 0.977332115f},
-std::array<float,2>{0.692158818f, 0.0913725719f},
-std::array<float,2>{0.364553571f, 0.383542836f},
-std::array<float,2>{0.852245867f, 0.595312953f},
-std::array<float,2>{0.247147933f, 0.642375946f},
-std::array<float,2>{0.657536328f, 0.337612897f},
-std::array<float,2>{0.285626471f, 0.243663833f},
-std::array<float,2>{0.755712688f, 0.865896285f},
-std::array<float,2>{0.473745793f, 0.937490463f},
-std::array<float,2>{0.996249557f, 0.0411007553f},
-std::array<float,2>{0.0641433895f, 0.477391422f},
-std::array<float,2>{0.547467947f, 0.514538229f},
-std::array<float,2>{0.321762681f, 0.577929139f},
-std::array<float,2>{0.833400428f, 0.424616724f},
-std::array<float,2>{0.1501434f, 0.101396151f},
-std::array<float,2>{0.733249724f, 0.962369621f},
-std::array<float,2>{0.0415932499f, 0.779951394f},
-std::array<float,2>{0.616141081f, 0.176372081f},
-std::array<float,2>{0.411730736f, 0.268881142f},
-std::array<float,2>{0.879592955f, 0.711686671f},
-std::array<float,2>{0.08609844f, 0.703313708f},
-std::array<float,2>{0.542858481f, 0.280108005f},
-std::array<float,2>{0.491773427f, 0.186311498f},
-std::array<float,2>{0.984344661f, 0.772158086f},
-std::array<float,2>{0.299305469f, 0.953430533f},
-std::array<float,2>{0.771028519f, 0.103377774f},
-std::array<float,2>{0.219047859f, 0.432209522f},
-std::array<float,2>{0.676352322f, 0.565282345f},
-std::array<float,2>{0.432783365f, 0.502374411f},
-std::array<float,2>{0.905013561f, 0.473782748f},
-std::array<float,2>{0.0512967445f, 0.0362543762f},
-std::array<float,2>{0.601046979f, 0.92883575f},
-std::array<float,2>{0.139314801f, 0.874487996f},
-std::array<float,2>{0.735682726f, 0.235329226f},
-std::array<float,2>{0.342000663f, 0.334522665f},
-std::array<float,2>{0.824060678f, 0.648720801f},
-std::array<float,2>{0.20441559f, 0.606181979f},
-std::array<float,2>{0.639360726f, 0.380152255f},
-std::array<float,2>{0.278060198f, 0.0808684528f},
-std::array<float,2>{0.784101784f, 0.972080827f},
-std::array<float,2>{0.457334429f, 0.807586372f},
-std::array<float,2>{0.944513917f, 0.130466178f},
-std::array<float,2>{0.112328492f, 0.308476567f},
-std::array<float,2>{0.528550208f, 0.745045125f},
-std::array<float,2>{0.343769997f, 0.672707796f},
-std::array<float,2>{0.872250259f, 0.346438468f},
-std::array<float,2>{0.174109027f, 0.205986887f},
-std::array<float,2>{0.71417582f, 0.814575791f},
-std::array<float,2>{0.0173472222f, 0.895787597f},
-std::array<float,2>{0.569309652f, 0.0220124274f},
-std::array<float,2>{0.397239804f, 0.460386753f},
-std::array<float,2>{0.922008276f, 0.539921522f},
-std::array<float,2>{0.0430042669f, 0.549788117f},
-std::array<float,2>{0.612037778f, 0.441289485f},
-std::array<float,2>{0.409716815f, 0.0080998512f},
-std::array<float,2>{0.87704432f, 0.885735929f},
-std::array<float,2>{0.325021803f, 0.839909375f},
-std::array<float,2>{0.831642389f, 0.193010136f},
-std::array<float,2>{0.156012461f, 0.374316722f},
-std::array<float,2>{0.729150057f, 0.669830024f},
-std::array<float,2>{0.471246302f, 0.723021805f},
-std::array<float,2>{0.993163109f, 0.287992924f},
-std::array<float,2>{0.0692531914f, 0.147909254f},
-std::array<float,2>{0.551563084f, 0.786441147f},
-std::array<float,2>{0.245817661f, 0.994175673f},
-std::array<float,2>{0.661891699f, 0.0677999407f},
-std::array<float,2>{0.281750917f, 0.397767484f},
-std::array<float,2>{0.751631856f, 0.621561825f},
-std::array<float,2>{0.159680679f, 0.62992084f},
-std::array<float,2>{0.690735102f, 0.32468614f},
-std::array<float,2>{0.362944752f, 0.233168587f},
-std::array<float,2>{0.859323621f, 0.850565195f},
-std::array<float,2>{0.38113445f, 0.919158518f},
-std::array<float,2>{0.91861397f, 0.0582452118f},
-std::array<float,2>{0.0151941897f, 0.492710352f},
-std::array<float,2>{0.590182722f, 0.529551029f},
-std::array<float,2>{0.251434416f, 0.592844367f},
-std::array<float,2>{0.807172239f, 0.420197278f},
-std::array<float,2>{0.194203094f, 0.120717861f},
-std::array<float,2>{0.650638521f, 0.941461205f},
-std::array<float,2>{0.100233674f, 0.761295915f},
-std::array<float,2>{0.511579752f, 0.157578737f},
-std::array<float,2>{0.443145186f, 0.254139006f},
-std::array<float,2>{0.963889718f, 0.698204815f},
-std::array<float,2>{0.00072793971f, 0.656820714f},
-std::array<float,2>{0.578938842f, 0.365322411f},
-std::array<float,2>{0.385731041f, 0.198114663f},
-std::array<float,2>{0.906354368f, 0.828204393f},
-std::array<float,2>{0.373444557f, 0.878398538f},
-std::array<float,2>{0.849963605f, 0.00187788613f},
-std::array<float,2>{0.165689692f, 0.449021906f},
-std::array<float,2>{0.695951402f, 0.561528981f},
-std::array<float,2>{0.451426566f, 0.612044394f},
-std::array<float,2>{0.958621502f, 0.401100069f},
-std::array<float,2>{0.108514965f, 0.0764393583f},
-std::array<float,2>{0.501479864f, 0.989706516f},
-std::array<float,2>{0.196365044f, 0.796834052f},
-std::array<float,2>{0.643220544f, 0.152916476f},
-std::array<float,2>{0.260161221f, 0.292805314f},
-std::array<float,2>{0.797427237f, 0.730645895f},
-std::array<float,2>{0.141029298f, 0.522447348f},
-std::array<float,2>{0.71911788f, 0.485592008f},
-std::array<float,2>{0.318058997f, 0.0536886305f},
-std::array<float,2>{0.839358509f, 0.91108346f},
-std::array<float,2>{0.418613464f, 0.856005311f},
-std::array<float,2>{0.889631867f, 0.219869703f},
-std::array<float,2>{0.0343171805f, 0.317272067f},
-std::array<float,2>{0.622163832f, 0.638081849f},
-std::array<float,2>{0.294983447f, 0.695006847f},
-std::array<float,2>{0.758232355f, 0.26007849f},
-std::array<float,2>{0.240304574f, 0.165302962f},
-std::array<float,2>{0.668152094f, 0.75053668f},
-std::array<float,2>{0.0717391521f, 0.950462997f},
-std::array<float,2>{0.55822587f, 0.109843262f},
-std::array<float,2>{0.47881493f, 0.411354899f},
-std::array<float,2>{0.987158179f, 0.578785419f},
-std::array<float,2>{0.122754879f, 0.57099694f},
-std::array<float,2>{0.522221267f, 0.429594129f},
-std::array<float,2>{0.461062074f, 0.0947114229f},
-std::array<float,2>{0.950654387f, 0.9653368f},
-std::array<float,2>{0.268337727f, 0.774826407f},
-std::array<float,2>{0.79661274f, 0.172923386f},
-std::array<float,2>{0.212883383f, 0.273219734f},
-std::array<float,2>{0.626037538f, 0.71610415f},
-std::array<float,2>{0.398621947f, 0.646945953f},
-std::array<float,2>{0.935975134f, 0.339850932f},
-std::array<float,2>{0.0270483475f, 0.249438435f},
-std::array<float,2>{0.572114468f, 0.86275208f},
-std::array<float,2>{0.18542017f, 0.931375861f},
-std::array<float,2>{0.708239317f, 0.0458907634f},
-std::array<float,2>{0.352476388f, 0.482931137f},
-std::array<float,2>{0.863660693f, 0.509478569f},
-std::array<float,2>{0.233236998f, 0.736384392f},
-std::array<float,2>{0.68268925f, 0.301193476f},
-std::array<float,2>{0.31150499f, 0.13728936f},
-std::array<float,2>{0.775245011f, 0.801258445f},
-std::array<float,2>{0.497894794f, 0.982128859f},
-std::array<float,2>{0.970178008f, 0.0869843513f},
-std::array<float,2>{0.0855928436f, 0.388510734f},
-std::array<float,2>{0.534528732f, 0.59855032f},
-std::array<float,2>{0.332281321f, 0.536199152f},
-std::array<float,2>{0.816187918f, 0.461187035f},
-std::array<float,2>{0.128264278f, 0.0312293433f},
-std::array<float,2>{0.745016277f, 0.903778434f},
-std::array<float,2>{0.0614903718f, 0.824459493f},
-std::array<float,2>{0.603817999f, 0.21595633f},
-std::array<float,2>{0.424766511f, 0.356716245f},
-std::array<float,2>{0.897110522f, 0.680809021f},
-std::array<float,2>{0.10221491f, 0.654048979f},
-std::array<float,2>{0.506822526f, 0.33087948f},
-std::array<float,2>{0.447824597f, 0.240023807f},
-std::array<float,2>{0.955565214f, 0.868113339f},
-std::array<float,2>{0.264886171f, 0.925227404f},
-std::array<float,2>{0.801153839f, 0.0348145813f},
-std::array<float,2>{0.203118324f, 0.471772432f},
-std::array<float,2>{0.647172511f, 0.504497349f},
-std::array<float,2>{0.388252407f, 0.56803602f},
-std::array<float,2>{0.910625696f, 0.43691656f},
-std::array<float,2>{0.0060635116f, 0.106180243f},
-std::array<float,2>{0.584262788f, 0.960296035f},
-std::array<float,2>{0.169493511f, 0.766525626f},
-std::array<float,2>{0.700001657f, 0.18060194f},
-std::array<float,2>{0.370310038f, 0.273719788f},
-std::array<float,2>{0.844063759f, 0.709185302f},
-std::array<float,2>{0.238076434f, 0.546451986f},
-std::array<float,2>{0.666134536f, 0.455819279f},
-std::array<float,2>{0.292931497f, 0.0157232415f},
-std::array<float,2>{0.762281775f, 0.893225312f},
-std::array<float,2>{0.480530739f, 0.819233418f},
-std::array<float,2>{0.990691066f, 0.209549606f},
-std::array<float,2>{0.0774643272f, 0.350196213f},
-std::array<float,2>{0.559466183f, 0.67914176f},
-std::array<float,2>{0.316298276f, 0.749145091f},
-std::array<float,2>{0.840986013f, 0.308979481f},
-std::array<float,2>{0.146550223f, 0.128782704f},
-std::array<float,2>{0.724935174f, 0.808970869f},
-std::array<float,2>{0.0379478f, 0.975536227f},
-std::array<float,2>{0.619389236f, 0.082251288f},
-std::array<float,2>{0.415785074f, 0.378214508f},
-std::array<float,2>{0.886064589f, 0.60395205f},
-std::array<float,2>{0.0289268717f, 0.618080378f},
-std::array<float,2>{0.574442983f, 0.391604602f},
-std::array<float,2>{0.403024346f, 0.0662849694f},
-std::array<float,2>{0.929898024f, 0.997423351f},
-std::array<float,2>{0.358375698f, 0.783732891f},
-std::array<float,2>{0.860893071f, 0.14117144f},
-std::array<float,2>{0.181418687f, 0.282005191f},
-std::array<float,2>{0.703697979f, 0.719602168f},
-std::array<float,2>{0.468012601f, 0.66642946f},
-std::array<float,2>{0.946064949f, 0.367189586f},
-std::array<float,2>{0.117904857f, 0.189372927f},
-std::array<float,2>{0.517897844f, 0.837732732f},
-std::array<float,2>{0.217915863f, 0.888596535f},
-std::array<float,2>{0.630495727f, 0.0155156851f},
-std::array<float,2>{0.270466149f, 0.442724764f},
-std::array<float,2>{0.7891168f, 0.551756978f},
-std::array<float,2>{0.130708933f, 0.70160675f},
-std::array<float,2>{0.74672544f, 0.251150012f},
-std::array<float,2>{0.330631107f, 0.16049175f},
-std::array<float,2>{0.819009662f, 0.763553858f},
-std::array<float,2>{0.427388638f, 0.93898797f},
-std::array<float,2>{0.891189218f, 0.122630134f},
-std::array<float,2>{0.0577820353f, 0.416164577f},
-std::array<float,2>{0.608032048f, 0.587980032f},
-std::array<float,2>{0.307605863f, 0.525132716f},
-std::array<float,2>{0.779860973f, 0.498765171f},
-std::array<float,2>{0.227500454f, 0.0591840781f},
-std::array<float,2>{0.686559021f, 0.917102277f},
-std::array<float,2>{0.0784536675f, 0.847209573f},
-std::array<float,2>{0.536633015f, 0.230466247f},
-std::array<float,2>{0.494543791f, 0.322242171f},
-std::array<float,2>{0.974442542f, 0.627690852f},
-std::array<float,2>{0.0486468785f, 0.727102041f},
-std::array<float,2>{0.595098138f, 0.295146644f},
-std::array<float,2>{0.434142679f, 0.150545061f},
-std::array<float,2>{0.899613321f, 0.790786445f},
-std::array<float,2>{0.33952567f, 0.986322761f},
-std::array<float,2>{0.824542403f, 0.0721075907f},
-std::array<float,2>{0.134650603f, 0.405336678f},
-std::array<float,2>{0.738847971f, 0.614815652f},
-std::array<float,2>{0.486200631f, 0.556041896f},
-std::array<float,2>{0.976798892f, 0.449326634f},
-std::array<float,2>{0.0904575363f, 0.00683272909f},
-std::array<float,2>{0.546237171f, 0.882061601f},
-std::array<float,2>{0.224086642f, 0.832875729f},
-std::array<float,2>{0.673131347f, 0.201066554f},
-std::array<float,2>{0.304101408f, 0.359729767f},
-std::array<float,2>{0.768232286f, 0.661250412f},
-std::array<float,2>{0.179234087f, 0.584095895f},
-std::array<float,2>{0.717978776f, 0.409160614f},
-std::array<float,2>{0.347724915f, 0.116351068f},
-std::array<float,2>{0.867217004f, 0.945563555f},
-std::array<float,2>{0.39428091f, 0.756008804f},
-std::array<float,2>{0.927381814f, 0.168667793f},
-std::array<float,2>{0.0209985599f, 0.264138579f},
-std::array<float,2>{0.563148439f, 0.688804626f},
-std::array<float,2>{0.274676412f, 0.635307074f},
-std::array<float,2>{0.785265386f, 0.315678686f},
-std::array<float,2>{0.208703652f, 0.225795284f},
-std::array<float,2>{0.633183658f, 0.852038324f},
-std::array<float,2>{0.115242064f, 0.908749163f},
-std::array<float,2>{0.5234828f, 0.0505578741f},
-std::array<float,2>{0.456749231f, 0.489362836f},
-std::array<float,2>{0.939642131f, 0.516092777f},
-std::array<float,2>{0.0660712346f, 0.512915313f},
-std::array<float,2>{0.550354898f, 0.479583472f},
-std::array<float,2>{0.475617588f, 0.0397720858f},
-std::array<float,2>{0.998289883f, 0.934489548f},
-std::array<float,2>{0.287821233f, 0.863627374f},
-std::array<float,2>{0.756110191f, 0.245287329f},
-std::array<float,2>{0.248525277f, 0.33976528f},
-std::array<float,2>{0.659195781f, 0.642922103f},
-std::array<float,2>{0.412656069f, 0.714340687f},
-std::array<float,2>{0.880928099f, 0.267134249f},
-std::array<float,2>{0.0405605175f, 0.177851319f},
-std::array<float,2>{0.614428639f, 0.778602719f},
-std::array<float,2>{0.150531262f, 0.9637326f},
-std::array<float,2>{0.730758965f, 0.099026598f},
-std::array<float,2>{0.324054897f, 0.423776716f},
-std::array<float,2>{0.834656358f, 0.575501621f},
-std::array<float,2>{0.19020775f, 0.686193407f},
-std::array<float,2>{0.65470916f, 0.355046362f},
-std::array<float,2>{0.255484611f, 0.214097261f},
-std::array<float,2>{0.811099648f, 0.820575595f},
-std::array<float,2>{0.438957572f, 0.898474932f},
-std::array<float,2>{0.968693197f, 0.024853237f},
-std::array<float,2>{0.0953572765f, 0.465609699f},
-std::array<float,2>{0.513104498f, 0.534279883f},
-std::array<float,2>{0.365240604f, 0.596115053f},
-std::array<float,2>{0.854642987f, 0.385816336f},
-std::array<float,2>{0.163048849f, 0.0935205296f},
-std::array<float,2>{0.695117235f, 0.979102015f},
-std::array<float,2>{0.0106367199f, 0.799846351f},
-std::array<float,2>{0.586270452f, 0.135431856f},
-std::array<float,2>{0.37791121f, 0.299750388f},
-std::array<float,2>{0.915235043f, 0.738972902f},
-std::array<float,2>{0.0852810964f, 0.735054791f},
-std::array<float,2>{0.53502667f, 0.303403914f},
-std::array<float,2>{0.497107178f, 0.140378132f},
-std::array<float,2>{0.970239758f, 0.80410248f},
-std::array<float,2>{0.310848027f, 0.98251611f},
-std::array<float,2>{0.774755478f, 0.0887354687f},
-std::array<float,2>{0.232794419f, 0.389927298f},
-std::array<float,2>{0.683392704f, 0.600592434f},
-std::array<float,2>{0.423975736f, 0.537373602f},
-std::array<float,2>{0.896883249f, 0.462997288f},
-std::array<float,2>{0.0606514476f, 0.027398644f},
-std::array<float,2>{0.60413909f, 0.905289352f},
-std::array<float,2>{0.128869027f, 0.827029407f},
-std::array<float,2>{0.744541526f, 0.217761099f},
-std::array<float,2>{0.332951188f, 0.357461363f},
-std::array<float,2>{0.815572441f, 0.682428122f},
-std::array<float,2>{0.212395594f, 0.572511971f},
-std::array<float,2>{0.626561105f, 0.426080525f},
-std::array<float,2>{0.267944127f, 0.0958031714f},
-std::array<float,2>{0.796272397f, 0.968008757f},
-std::array<float,2>{0.461635172f, 0.775627434f},
-std::array<float,2>{0.950724185f, 0.174971491f},
-std::array<float,2>{0.122185439f, 0.270794481f},
-std::array<float,2>{0.521737993f, 0.717148483f},
-std::array<float,2>{0.351745009f, 0.646455228f},
-std::array<float,2>{0.864038646f, 0.34329772f},
-std::array<float,2>{0.184676707f, 0.246440008f},
-std::array<float,2>{0.708789349f, 0.85993427f},
-std::array<float,2>{0.02656742f, 0.932557285f},
-std::array<float,2>{0.571737409f, 0.043196246f},
-std::array<float,2>{0.399116009f, 0.482142687f},
-std::array<float,2>{0.936175406f, 0.509793997f},
-std::array<float,2>{0.0346949622f, 0.520905852f},
-std::array<float,2>{0.622742534f, 0.487242013f},
-std::array<float,2>{0.418290108f, 0.0523403883f},
-std::array<float,2>{0.888900399f, 0.912399113f},
-std::array<float,2>{0.317851782f, 0.859332144f},
-std::array<float,2>{0.839047968f, 0.221129537f},
-std::array<float,2>{0.141517922f, 0.3200773f},
-std::array<float,2>{0.719645917f, 0.6390692f},
-std::array<float,2>{0.479332089f, 0.691492558f},
-std::array<float,2>{0.98678869f, 0.258349657f},
-std::array<float,2>{0.0720477104f, 0.166947126f},
-std::array<float,2>{0.55795151f, 0.752286196f},
-std::array<float,2>{0.241093442f, 0.951858938f},
-std::array<float,2>{0.668623745f, 0.111534186f},
-std::array<float,2>{0.295816809f, 0.412405461f},
-std::array<float,2>{0.758705735f, 0.581670344f},
-std::array<float,2>{0.1651797f, 0.65858233f},
-std::array<float,2>{0.695741713f, 0.363780767f},
-std::array<float,2>{0.373827934f, 0.197214365f},
-std::array<float,2>{0.850560725f, 0.831398249f},
-std::array<float,2>{0.384823799f, 0.87628448f},
-std::array<float,2>{0.906980813f, 0.00204348401f},
-std::array<float,2>{0.000411406392f, 0.446228892f},
-std::array<float,2>{0.57860291f, 0.559771478f},
-std::array<float,2>{0.2606076f, 0.610577881f},
-std::array<float,2>{0.796893895f, 0.398841411f},
-std::array<float,2>{0.197144136f, 0.0747438893f},
-std::array<float,2>{0.642585337f, 0.991561234f},
-std::array<float,2>{0.109036036f, 0.794568837f},
-std::array<float,2>{0.501021206f, 0.154525816f},
-std::array<float,2>{0.451666564f, 0.290218323f},
-std::array<float,2>{0.958153427f, 0.734335661f},
-std::array<float,2>{0.0148735829f, 0.631441772f},
-std::array<float,2>{0.590708852f, 0.327423304f},
-std::array<float,2>{0.381353974f, 0.231430843f},
-std::array<float,2>{0.918369114f, 0.848001182f},
-std::array<float,2>{0.362340748f, 0.920144916f},
-std::array<float,2>{0.858720005f, 0.0549640767f},
-std::array<float,2>{0.159448668f, 0.495829463f},
-std::array<float,2>{0.69094342f, 0.528604269f},
-std::array<float,2>{0.442643583f, 0.590384305f},
-std::array<float,2>{0.964490235f, 0.418488681f},
-std::array<float,2>{0.10008385f, 0.117189072f},
-std::array<float,2>{0.510813534f, 0.94363147f},
-std::array<float,2>{0.193493411f, 0.758388996f},
-std::array<float,2>{0.651207745f, 0.159791857f},
-std::array<float,2>{0.251657397f, 0.257171094f},
-std::array<float,2>{0.806994259f, 0.696099937f},
-std::array<float,2>{0.155297801f, 0.547060609f},
-std::array<float,2>{0.728581905f, 0.438421816f},
-std::array<float,2>{0.324698865f, 0.0105690444f},
-std::array<float,2>{0.831397593f, 0.884011984f},
-std::array<float,2>{0.409221977f, 0.841971934f},
-std::array<float,2>{0.877637565f, 0.194341406f},
-std::array<float,2>{0.0437474139f, 0.371214181f},
-std::array<float,2>{0.611813426f, 0.670166314f},
-std::array<float,2>{0.281285048f, 0.72489363f},
-std::array<float,2>{0.751271307f, 0.286851376f},
-std::array<float,2>{0.245359376f, 0.145104349f},
-std::array<float,2>{0.661399543f, 0.788893402f},
-std::array<float,2>{0.0684635937f, 0.992742479f},
-std::array<float,2>{0.551106989f, 0.0687748864f},
-std::array<float,2>{0.471151978f, 0.395202577f},
-std::array<float,2>{0.9925704f, 0.624569714f},
-std::array<float,2>{0.113174647f, 0.60769093f},
-std::array<float,2>{0.529168606f, 0.381077856f},
-std::array<float,2>{0.457879156f, 0.0796996877f},
-std::array<float,2>{0.944845796f, 0.969779611f},
-std::array<float,2>{0.277778089f, 0.806277871f},
-std::array<float,2>{0.783320248f, 0.131898373f},
-std::array<float,2>{0.205061629f, 0.305456132f},
-std::array<float,2>{0.638720036f, 0.742216468f},
-std::array<float,2>{0.396861553f, 0.675459921f},
-std::array<float,2>{0.922702849f, 0.345559329f},
-std::array<float,2>{0.0167585928f, 0.204666868f},
-std::array<float,2>{0.568524241f, 0.814000189f},
-std::array<float,2>{0.174768776f, 0.896784365f},
-std::array<float,2>{0.714795232f, 0.0204725172f},
-std::array<float,2>{0.344720334f, 0.458107293f},
-std::array<float,2>{0.872613847f, 0.542428195f},
-std::array<float,2>{0.219250768f, 0.705967546f},
-std::array<float,2>{0.675866067f, 0.278933316f},
-std::array<float,2>{0.299698174f, 0.185033336f},
-std::array<float,2>{0.7706756f, 0.769985795f},
-std::array<float,2>{0.491222143f, 0.955370367f},
-std::array<float,2>{0.98340106f, 0.105270885f},
-std::array<float,2>{0.0864731967f, 0.43002528f},
-std::array<float,2>{0.542004824f, 0.563284934f},
-std::array<float,2>{0.342632085f, 0.50122273f},
-std::array<float,2>{0.823571265f, 0.475582421f},
-std::array<float,2>{0.138686374f, 0.0378357098f},
-std::array<float,2>{0.73588407f, 0.926024318f},
-std::array<float,2>{0.0509131737f, 0.872600913f},
-std::array<float,2>{0.60143131f, 0.237807959f},
-std::array<float,2>{0.43357262f, 0.333301663f},
-std::array<float,2>{0.904470682f, 0.650835216f},
-std::array<float,2>{0.0948181003f, 0.683898449f},
-std::array<float,2>{0.513275564f, 0.352178931f},
-std::array<float,2>{0.439370453f, 0.21224077f},
-std::array<float,2>{0.968017519f, 0.823594034f},
-std::array<float,2>{0.255337417f, 0.901448905f},
-std::array<float,2>{0.810925841f, 0.0262998734f},
-std::array<float,2>{0.189482614f, 0.468098521f},
-std::array<float,2>{0.655036092f, 0.531678259f},
-std::array<float,2>{0.377417207f, 0.595195949f},
-std::array<float,2>{0.915982723f, 0.382935762f},
-std::array<float,2>{0.00996147934f, 0.091253683f},
-std::array<float,2>{0.586572587f, 0.976609707f},
-std::array<float,2>{0.162275434f, 0.797618747f},
-std::array<float,2>{0.694492996f, 0.133360326f},
-std::array<float,2>{0.365829706f, 0.298295736f},
-std::array<float,2>{0.855370104f, 0.741514504f},
-std::array<float,2>{0.248730645f, 0.513867378f},
-std::array<float,2>{0.659892678f, 0.477022171f},
-std::array<float,2>{0.287195891f, 0.0418194532f},
-std::array<float,2>{0.75680548f, 0.936525285f},
-std::array<float,2>{0.476338297f, 0.865582168f},
-std::array<float,2>{0.99878943f, 0.243277878f},
-std::array<float,2>{0.0658366829f, 0.337363333f},
-std::array<float,2>{0.550087392f, 0.641928136f},
-std::array<float,2>{0.323682547f, 0.71128118f},
-std::array<float,2>{0.834431469f, 0.269052386f},
-std::array<float,2>{0.151312009f, 0.176185206f},
-std::array<float,2>{0.731316566f, 0.779465377f},
-std::array<float,2>{0.0401612073f, 0.962791145f},
-std::array<float,2>{0.614899278f, 0.100945093f},
-std::array<float,2>{0.41253683f, 0.423982739f},
-std::array<float,2>{0.881359696f, 0.577260852f},
-std::array<float,2>{0.0207774825f, 0.582153559f},
-std::array<float,2>{0.562696218f, 0.407431453f},
-std::array<float,2>{0.393661022f, 0.1145337f},
-std::array<float,2>{0.926823378f, 0.947856724f},
-std::array<float,2>{0.348571867f, 0.754367173f},
-std::array<float,2>{0.867959678f, 0.169936806f},
-std::array<float,2>{0.17917715f, 0.263219476f},
-std::array<float,2>{0.718321025f, 0.69012481f},
-std::array<float,2>{0.456332058f, 0.634030581f},
-std::array<float,2>{0.940388978f, 0.312589437f},
-std::array<float,2>{0.115967773f, 0.224134311f},
-std::array<float,2>{0.524029136f, 0.854848504f},
-std::array<float,2>{0.20823656f, 0.906575859f},
-std::array<float,2>{0.633749247f, 0.0485942699f},
-std::array<float,2>{0.27511254f, 0.49120757f},
-std::array<float,2>{0.785848022f, 0.518502474f},
-std::array<float,2>{0.134033486f, 0.729111612f},
-std::array<float,2>{0.738303185f, 0.294160903f},
-std::array<float,2>{0.339119405f, 0.149414346f},
-std::array<float,2>{0.825091124f, 0.791140258f},
-std::array<float,2>{0.433660984f, 0.987577856f},
-std::array<float,2>{0.900177896f, 0.0738787502f},
-std::array<float,2>{0.0482721217f, 0.402621686f},
-std::array<float,2>{0.595368862f, 0.616051555f},
-std::array<float,2>{0.304578751f, 0.558249116f},
-std::array<float,2>{0.76769346f, 0.451510578f},
-std::array<float,2>{0.224475384f, 0.00418735389f},
-std::array<float,2>{0.673406482f, 0.880805254f},
-std::array<float,2>{0.0900649279f, 0.834962487f},
-std::array<float,2>{0.546802938f, 0.202745616f},
-std::array<float,2>{0.48582834f, 0.362788945f},
-std::array<float,2>{0.977530122f, 0.662599206f},
-std::array<float,2>{0.0585154556f, 0.699994028f},
-std::array<float,2>{0.607830346f, 0.252600938f},
-std::array<float,2>{0.426891565f, 0.162674904f},
-std::array<float,2>{0.891112924f, 0.763729632f},
-std::array<float,2>{0.33024621f, 0.940389216f},
-std::array<float,2>{0.818800867f, 0.124852523f},
-std::array<float,2>{0.130016431f, 0.415900946f},
-std::array<float,2>{0.746478438f, 0.587816954f},
-std::array<float,2>{0.495067477f, 0.526497185f},
-std::array<float,2>{0.973851442f, 0.497928232f},
-std::array<float,2>{0.0788671598f, 0.0606346242f},
-std::array<float,2>{0.53615427f, 0.915162385f},
-std::array<float,2>{0.226875544f, 0.845568657f},
-std::array<float,2>{0.687221825f, 0.228177056f},
-std::array<float,2>{0.306836933f, 0.322339743f},
-std::array<float,2>{0.779568672f, 0.625900328f},
-std::array<float,2>{0.180845827f, 0.619823515f},
-std::array<float,2>{0.703322709f, 0.394243836f},
-std::array<float,2>{0.35771814f, 0.0634846762f},
-std::array<float,2>{0.860788643f, 0.998704851f},
-std::array<float,2>{0.402675837f, 0.782874882f},
-std::array<float,2>{0.930374503f, 0.143068597f},
-std::array<float,2>{0.0283434354f, 0.283222646f},
-std::array<float,2>{0.575140059f, 0.720896363f},
-std::array<float,2>{0.269991219f, 0.665094256f},
-std::array<float,2>{0.789690971f, 0.370269209f},
-std::array<float,2>{0.218348309f, 0.191372782f},
-std::array<float,2>{0.629887104f, 0.839433432f},
-std::array<float,2>{0.117194176f, 0.890504181f},
-std::array<float,2>{0.518203259f, 0.011737084f},
-std::array<float,2>{0.468352824f, 0.443456143f},
-std::array<float,2>{0.945708275f, 0.552891254f},
-std::array<float,2>{0.0780737251f, 0.543198943f},
-std::array<float,2>{0.558935285f, 0.45339942f},
-std::array<float,2>{0.481214106f, 0.0188167375f},
-std::array<float,2>{0.990781665f, 0.891613543f},
-std::array<float,2>{0.292131305f, 0.816771984f},
-std::array<float,2>{0.761755943f, 0.208016053f},
-std::array<float,2>{0.23737593f, 0.349605322f},
-std::array<float,2>{0.666738033f, 0.677149236f},
-std::array<float,2>{0.415214688f, 0.746184945f},
-std::array<float,2>{0.886312485f, 0.311523318f},
-std::array<float,2>{0.0371463336f, 0.125743553f},
-std::array<float,2>{0.620062053f, 0.810631633f},
-std::array<float,2>{0.147336856f, 0.974254966f},
-std::array<float,2>{0.72547245f, 0.0842496827f},
-std::array<float,2>{0.315858662f, 0.376902133f},
-std::array<float,2>{0.841557741f, 0.603335381f},
-std::array<float,2>{0.202499419f, 0.655187845f},
-std::array<float,2>{0.646582007f, 0.329524338f},
-std::array<float,2>{0.265494734f, 0.241485208f},
-std::array<float,2>{0.801688612f, 0.869689047f},
-std::array<float,2>{0.447470784f, 0.923201919f},
-std::array<float,2>{0.955683708f, 0.0315182507f},
-std::array<float,2>{0.101683132f, 0.470644236f},
-std::array<float,2>{0.506072879f, 0.507762551f},
-std::array<float,2>{0.371049732f, 0.568848372f},
-std::array<float,2>{0.844535768f, 0.434030384f},
-std::array<float,2>{0.169251591f, 0.107562505f},
-std::array<float,2>{0.699262023f, 0.958407462f},
-std::array<float,2>{0.00671799714f, 0.768860877f},
-std::array<float,2>{0.584707797f, 0.182989717f},
-std::array<float,2>{0.38802737f, 0.276096314f},
-std::array<float,2>{0.910953701f, 0.707838356f},
-std::array<float,2>{0.124379575f, 0.716329157f},
-std::array<float,2>{0.519939899f, 0.272730023f},
-std::array<float,2>{0.463117331f, 0.173658863f},
-std::array<float,2>{0.951700866f, 0.775005758f},
-std::array<float,2>{0.266040564f, 0.964921296f},
-std::array<float,2>{0.793885827f, 0.0941956788f},
-std::array<float,2>{0.213341162f, 0.428834021f},
-std::array<float,2>{0.627006054f, 0.570626378f},
-std::array<float,2>{0.400960535f, 0.508883297f},
-std::array<float,2>{0.93538475f, 0.482434332f},
-std::array<float,2>{0.0251086708f, 0.0450455956f},
-std::array<float,2>{0.57349658f, 0.930731833f},
-std::array<float,2>{0.186391741f, 0.862871408f},
-std::array<float,2>{0.709758818f, 0.24955222f},
-std::array<float,2>{0.355111569f, 0.340699017f},
-std::array<float,2>{0.866797745f, 0.647060215f},
-std::array<float,2>{0.230602443f, 0.598093688f},
-std::array<float,2>{0.681516886f, 0.387821108f},
-std::array<float,2>{0.30916363f, 0.0874911249f},
-std::array<float,2>{0.776867867f, 0.981542706f},
-std::array<float,2>{0.498672128f, 0.801394463f},
-std::array<float,2>{0.971975505f, 0.136836395f},
-std::array<float,2>{0.082308203f, 0.301466554f},
-std::array<float,2>{0.531522214f, 0.73698318f},
-std::array<float,2>{0.335722625f, 0.68116039f},
-std::array<float,2>{0.813772917f, 0.357416749f},
-std::array<float,2>{0.126204148f, 0.216660351f},
-std::array<float,2>{0.742776752f, 0.824844897f},
-std::array<float,2>{0.0592840128f, 0.903853357f},
-std::array<float,2>{0.602719188f, 0.0304821748f},
-std::array<float,2>{0.422300637f, 0.461840004f},
-std::array<float,2>{0.895347118f, 0.536746323f},
-std::array<float,2>{0.00307727349f, 0.562379897f},
-std::array<float,2>{0.580664337f, 0.448609561f},
-std::array<float,2>{0.384286076f, 0.00110660179f},
-std::array<float,2>{0.908927262f, 0.87885946f},
-std::array<float,2>{0.372591823f, 0.828622699f},
-std::array<float,2>{0.847966313f, 0.197433144f},
-std::array<float,2>{0.167313591f, 0.36583817f},
-std::array<float,2>{0.698572278f, 0.656413138f},
-std::array<float,2>{0.449827939f, 0.73117429f},
-std::array<float,2>{0.960694134f, 0.292385608f},
-std::array<float,2>{0.107043982f, 0.152577743f},
-std::array<float,2>{0.503411174f, 0.796127439f},
-std::array<float,2>{0.198360085f, 0.990199327f},
-std::array<float,2>{0.642421663f, 0.0771306753f},
-std::array<float,2>{0.258231968f, 0.400627226f},
-std::array<float,2>{0.799427032f, 0.611505568f},
-std::array<float,2>{0.143027723f, 0.638587296f},
-std::array<float,2>{0.721387982f, 0.316533446f},
-std::array<float,2>{0.32017827f, 0.220322505f},
-std::array<float,2>{0.837359548f, 0.855572402f},
-std::array<float,2>{0.421734005f, 0.910258353f},
-std::array<float,2>{0.887438715f, 0.0530027188f},
-std::array<float,2>{0.032197129f, 0.48622787f},
-std::array<float,2>{0.6249277f, 0.521811664f},
-std::array<float,2>{0.293220848f, 0.578460753f},
-std::array<float,2>{0.761552691f, 0.411981374f},
-std::array<float,2>{0.238758981f, 0.109942809f},
-std::array<float,2>{0.670378208f, 0.951146543f},
-std::array<float,2>{0.0726331994f, 0.75025934f},
-std::array<float,2>{0.554729223f, 0.16568768f},
-std::array<float,2>{0.477301568f, 0.260665298f},
-std::array<float,2>{0.985246003f, 0.694630384f},
-std::array<float,2>{0.045625452f, 0.6689502f},
-std::array<float,2>{0.611182034f, 0.374712467f},
-std::array<float,2>{0.406601399f, 0.192828283f},
-std::array<float,2>{0.876590312f, 0.84065938f},
-std::array<float,2>{0.328067213f, 0.884916902f},
-std::array<float,2>{0.829002261f, 0.00835946202f},
-std::array<float,2>{0.153005049f, 0.440512329f},
-std::array<float,2>{0.726804137f, 0.549154103f},
-std::array<float,2>{0.469760656f, 0.621707857f},
-std::array<float,2>{0.99527508f, 0.39813301f},
-std::array<float,2>{0.0681178495f, 0.067998372f},
-std::array<float,2>{0.553021371f, 0.994709849f},
-std::array<float,2>{0.242345572f, 0.786905706f},
-std::array<float,2>{0.662201822f, 0.148095757f},
-std::array<float,2>{0.284743905f, 0.287495285f},
-std::array<float,2>{0.752066851f, 0.723512352f},
-std::array<float,2>{0.157959521f, 0.530099273f},
-std::array<float,2>{0.689268708f, 0.492548406f},
-std::array<float,2>{0.360633016f, 0.0580316074f},
-std::array<float,2>{0.856656194f, 0.919673145f},
-std::array<float,2>{0.379905343f, 0.849918902f},
-std::array<float,2>{0.921751618f, 0.232831612f},
-std::array<float,2>{0.0131389862f, 0.325095683f},
-std::array<float,2>{0.593661249f, 0.630805433f},
-std::array<float,2>{0.253886998f, 0.697491884f},
-std::array<float,2>{0.805973947f, 0.25486511f},
-std::array<float,2>{0.192943424f, 0.157878563f},
-std::array<float,2>{0.648903728f, 0.761125982f},
-std::array<float,2>{0.098837547f, 0.941928506f},
-std::array<float,2>{0.508021474f, 0.120412126f},
-std::array<float,2>{0.443940341f, 0.420818627f},
-std::array<float,2>{0.962140143f, 0.593680561f},
-std::array<float,2>{0.0887315497f, 0.564578056f},
-std::array<float,2>{0.540801346f, 0.431991279f},
-std::array<float,2>{0.490224063f, 0.102906942f},
-std::array<float,2>{0.980954528f, 0.954054832f},
-std::array<float,2>{0.298235387f, 0.771549284f},
-std::array<float,2>{0.772993863f, 0.185786873f},
-std::array<float,2>{0.221584484f, 0.279743046f},
-std::array<float,2>{0.679364622f, 0.704003096f},
-std::array<float,2>{0.429719031f, 0.649291217f},
-std::array<float,2>{0.903276324f, 0.334142238f},
-std::array<float,2>{0.0539613962f, 0.234749034f},
-std::array<float,2>{0.599325299f, 0.874772906f},
-std::array<float,2>{0.137822911f, 0.929532111f},
-std::array<float,2>{0.737284005f, 0.0367180482f},
-std::array<float,2>{0.340239078f, 0.474348933f},
-std::array<float,2>{0.820350409f, 0.502498865f},
-std::array<float,2>{0.205391228f, 0.744541883f},
-std::array<float,2>{0.638051927f, 0.308046967f},
-std::array<float,2>{0.27956742f, 0.130088985f},
-std::array<float,2>{0.781872809f, 0.807047665f},
-std::array<float,2>{0.460365593f, 0.972364426f},
-std::array<float,2>{0.941714644f, 0.0805171505f},
-std::array<float,2>{0.109988719f, 0.380825102f},
-std::array<float,2>{0.5300861f, 0.605950832f},
-std::array<float,2>{0.34588939f, 0.539110363f},
-std::array<float,2>{0.874138117f, 0.460539132f},
-std::array<float,2>{0.173670933f, 0.0217282381f},
-std::array<float,2>{0.711495876f, 0.896249533f},
-std::array<float,2>{0.018915249f, 0.815150857f},
-std::array<float,2>{0.567025185f, 0.205234155f},
-std::array<float,2>{0.395170122f, 0.346001923f},
-std::array<float,2>{0.925461709f, 0.672260463f},
-std::array<float,2>{0.0638269484f, 0.643442035f},
-std::array<float,2>{0.547037601f, 0.339018553f},
-std::array<float,2>{0.474579215f, 0.24600552f},
-std::array<float,2>{0.996785581f, 0.863887072f},
-std::array<float,2>{0.286021173f, 0.933617532f},
-std::array<float,2>{0.755093336f, 0.0390727408f},
-std::array<float,2>{0.247841597f, 0.480004251f},
-std::array<float,2>{0.657742262f, 0.513616204f},
-std::array<float,2>{0.411267668f, 0.576155782f},
-std::array<float,2>{0.879197776f, 0.423185945f},
-std::array<float,2>{0.0410482995f, 0.0995990857f},
-std::array<float,2>{0.615715921f, 0.963320494f},
-std::array<float,2>{0.149800718f, 0.779068232f},
-std::array<float,2>{0.732898772f, 0.178685188f},
-std::array<float,2>{0.322069108f, 0.267087728f},
-std::array<float,2>{0.833975255f, 0.714617133f},
-std::array<float,2>{0.187775865f, 0.534835994f},
-std::array<float,2>{0.652796686f, 0.465119362f},
-std::array<float,2>{0.255951494f, 0.0249538198f},
-std::array<float,2>{0.808670819f, 0.899393618f},
-std::array<float,2>{0.441080958f, 0.820849836f},
-std::array<float,2>{0.965723157f, 0.21466735f},
-std::array<float,2>{0.0972741842f, 0.35493508f},
-std::array<float,2>{0.515136242f, 0.685724974f},
-std::array<float,2>{0.364919573f, 0.738299072f},
-std::array<float,2>{0.851919413f, 0.298876911f},
-std::array<float,2>{0.161034748f, 0.134960577f},
-std::array<float,2>{0.691784441f, 0.800717294f},
-std::array<float,2>{0.00783177186f, 0.978707135f},
-std::array<float,2>{0.589706361f, 0.0928109735f},
-std::array<float,2>{0.375406384f, 0.386665642f},
-std::array<float,2>{0.917045951f, 0.596388996f},
-std::array<float,2>{0.0496294647f, 0.614331245f},
-std::array<float,2>{0.59712702f, 0.406096458f},
-std::array<float,2>{0.436090112f, 0.0717746094f},
-std::array<float,2>{0.900556684f, 0.98556757f},
-std::array<float,2>{0.337175697f, 0.790404439f},
-std::array<float,2>{0.82716012f, 0.151183113f},
-std::array<float,2>{0.134797364f, 0.295437515f},
-std::array<float,2>{0.74128741f, 0.726636052f},
-std::array<float,2>{0.488145471f, 0.662061691f},
-std::array<float,2>{0.978988647f, 0.35991475f},
-std::array<float,2>{0.0923140198f, 0.200366363f},
-std::array<float,2>{0.543248177f, 0.832079709f},
-std::array<float,2>{0.225143015f, 0.882502973f},
-std::array<float,2>{0.674133241f, 0.00625062641f},
-std::array<float,2>{0.301199734f, 0.45006001f},
-std::array<float,2>{0.766553521f, 0.556240737f},
-std::array<float,2>{0.175812274f, 0.689262629f},
-std::array<float,2>{0.715708733f, 0.264259368f},
-std::array<float,2>{0.351537645f, 0.167981729f},
-std::array<float,2>{0.870893121f, 0.756791711f},
-std::array<float,2>{0.390969098f, 0.946248055f},
-std::array<float,2>{0.929656982f, 0.117115013f},
-std::array<float,2>{0.0224212967f, 0.408579409f},
-std::array<float,2>{0.56447047f, 0.584827185f},
-std::array<float,2>{0.275539309f, 0.516126871f},
-std::array<float,2>{0.788627863f, 0.489877939f},
-std::array<float,2>{0.209221438f, 0.049852863f},
-std::array<float,2>{0.635116041f, 0.908679783f},
-std::array<float,2>{0.115055338f, 0.852160394f},
-std::array<float,2>{0.525786281f, 0.226184934f},
-std::array<float,2>{0.454169154f, 0.316015989f},
-std::array<float,2>{0.939344049f, 0.635137558f},
-std::array<float,2>{0.0302807577f, 0.719002545f},
-std::array<float,2>{0.57774961f, 0.281660557f},
-std::array<float,2>{0.405962348f, 0.141024098f},
-std::array<float,2>{0.931847095f, 0.783350587f},
-std::array<float,2>{0.356562465f, 0.997588694f},
-std::array<float,2>{0.86186254f, 0.0657155961f},
-std::array<float,2>{0.183169782f, 0.392462194f},
-std::array<float,2>{0.706352293f, 0.617198288f},
-std::array<float,2>{0.465714037f, 0.550827682f},
-std::array<float,2>{0.94893378f, 0.443197101f},
-std::array<float,2>{0.120104857f, 0.0150371743f},
-std::array<float,2>{0.517396688f, 0.88788116f},
-std::array<float,2>{0.216319397f, 0.837157071f},
-std::array<float,2>{0.631132841f, 0.188638836f},
-std::array<float,2>{0.272340328f, 0.367786169f},
-std::array<float,2>{0.791945219f, 0.666602075f},
-std::array<float,2>{0.132229432f, 0.588853955f},
-std::array<float,2>{0.749512017f, 0.416788429f},
-std::array<float,2>{0.328487337f, 0.122230895f},
-std::array<float,2>{0.817996264f, 0.938897908f},
-std::array<float,2>{0.429082155f, 0.762766123f},
-std::array<float,2>{0.892986238f, 0.160668775f},
-std::array<float,2>{0.0549221151f, 0.251537979f},
-std::array<float,2>{0.606405795f, 0.701955616f},
-std::array<float,2>{0.304831326f, 0.627370894f},
-std::array<float,2>{0.779114306f, 0.321393579f},
-std::array<float,2>{0.229271293f, 0.229910344f},
-std::array<float,2>{0.685064316f, 0.846763015f},
-std::array<float,2>{0.0812063962f, 0.917489171f},
-std::array<float,2>{0.538906872f, 0.0589085706f},
-std::array<float,2>{0.493719667f, 0.498518676f},
-std::array<float,2>{0.974958479f, 0.524521649f},
-std::array<float,2>{0.10495165f, 0.50407058f},
-std::array<float,2>{0.503911555f, 0.472352654f},
-std::array<float,2>{0.446149975f, 0.0344228707f},
-std::array<float,2>{0.953665972f, 0.925507665f},
-std::array<float,2>{0.262523562f, 0.867524326f},
-std::array<float,2>{0.803078175f, 0.239360929f},
-std::array<float,2>{0.19987081f, 0.330445111f},
-std::array<float,2>{0.646295428f, 0.653542936f},
-std::array<float,2>{0.38971746f, 0.70967716f},
-std::array<float,2>{0.91285336f, 0.274164051f},
-std::array<float,2>{0.00491484674f, 0.1797373f},
-std::array<float,2>{0.583735824f, 0.765892327f},
-std::array<float,2>{0.171838313f, 0.960567296f},
-std::array<float,2>{0.702094913f, 0.105653554f},
-std::array<float,2>{0.367361516f, 0.437267989f},
-std::array<float,2>{0.847265005f, 0.5677405f},
-std::array<float,2>{0.235888824f, 0.679314971f},
-std::array<float,2>{0.664472461f, 0.349727362f},
-std::array<float,2>{0.290273011f, 0.209107324f},
-std::array<float,2>{0.76396805f, 0.818571746f},
-std::array<float,2>{0.483652562f, 0.892618716f},
-std::array<float,2>{0.989034832f, 0.0165493265f},
-std::array<float,2>{0.074432537f, 0.455301881f},
-std::array<float,2>{0.562356651f, 0.546076775f},
-std::array<float,2>{0.313392341f, 0.604028642f},
-std::array<float,2>{0.842286646f, 0.378526539f},
-std::array<float,2>{0.145218164f, 0.0829366595f},
-std::array<float,2>{0.72448647f, 0.975005329f},
-std::array<float,2>{0.0360921361f, 0.809495926f},
-std::array<float,2>{0.617419004f, 0.128353581f},
-std::array<float,2>{0.41755724f, 0.309384167f},
-std::array<float,2>{0.883525491f, 0.749694347f},
-std::array<float,2>{0.105747536f, 0.732885718f},
-std::array<float,2>{0.502785087f, 0.289469093f},
-std::array<float,2>{0.450824678f, 0.155311704f},
-std::array<float,2>{0.959758341f, 0.793940485f},
-std::array<float,2>{0.259215087f, 0.990465403f},
-std::array<float,2>{0.800451815f, 0.0752466917f},
-std::array<float,2>{0.198003456f, 0.40003258f},
-std::array<float,2>{0.640679896f, 0.609642982f},
-std::array<float,2>{0.383700103f, 0.559127808f},
-std::array<float,2>{0.909469068f, 0.447135895f},
-std::array<float,2>{0.00292096776f, 0.00366361113f},
-std::array<float,2>{0.581199467f, 0.875247478f},
-std::array<float,2>{0.166937649f, 0.830307841f},
-std::array<float,2>{0.698072255f, 0.195645884f},
-std::array<float,2>{0.371850193f, 0.364357144f},
-std::array<float,2>{0.848765671f, 0.65986824f},
-std::array<float,2>{0.239764243f, 0.580700219f},
-std::array<float,2>{0.670920789f, 0.413918406f},
-std::array<float,2>{0.294554472f, 0.112579934f},
-std::array<float,2>{0.760112882f, 0.952884793f},
-std::array<float,2>{0.477850914f, 0.753236711f},
-std::array<float,2>{0.985974431f, 0.167170614f},
-std::array<float,2>{0.0738142356f, 0.259209991f},
-std::array<float,2>{0.555828393f, 0.692383289f},
-std::array<float,2>{0.319316387f, 0.640292466f},
-std::array<float,2>{0.836808443f, 0.318493724f},
-std::array<float,2>{0.144189045f, 0.222398207f},
-std::array<float,2>{0.721856594f, 0.858338237f},
-std::array<float,2>{0.0323306695f, 0.91368109f},
-std::array<float,2>{0.623571455f, 0.0514793508f},
-std::array<float,2>{0.420423716f, 0.487560779f},
-std::array<float,2>{0.887894511f, 0.51987505f},
-std::array<float,2>{0.0239186864f, 0.510963559f},
-std::array<float,2>{0.572887123f, 0.480728179f},
-std::array<float,2>{0.4016743f, 0.0446017161f},
-std::array<float,2>{0.934278488f, 0.933021128f},
-std::array<float,2>{0.354104996f, 0.861079156f},
-std::array<float,2>{0.865237117f, 0.247327194f},
-std::array<float,2>{0.186809242f, 0.341968268f},
-std::array<float,2>{0.710723996f, 0.644591272f},
-std::array<float,2>{0.464017451f, 0.718621016f},
-std::array<float,2>{0.95216465f, 0.270394087f},
-std::array<float,2>{0.123063244f, 0.173937276f},
-std::array<float,2>{0.52134043f, 0.776523948f},
-std::array<float,2>{0.213871285f, 0.96762377f},
-std::array<float,2>{0.628643811f, 0.097241208f},
-std::array<float,2>{0.266642153f, 0.427680731f},
-std::array<float,2>{0.794214189f, 0.57335484f},
-std::array<float,2>{0.125542283f, 0.682747722f},
-std::array<float,2>{0.743923724f, 0.359192908f},
-std::array<float,2>{0.334903389f, 0.218316734f},
-std::array<float,2>{0.812509894f, 0.827158213f},
-std::array<float,2>{0.423084497f, 0.904498816f},
-std::array<float,2>{0.896269858f, 0.0289938673f},
-std::array<float,2>{0.0597059987f, 0.464100718f},
-std::array<float,2>{0.602069736f, 0.538784921f},
-std::array<float,2>{0.310383976f, 0.600483298f},
-std::array<float,2>{0.775541544f, 0.389537334f},
-std::array<float,2>{0.232420355f, 0.0898349509f},
-std::array<float,2>{0.68045181f, 0.983881533f},
-std::array<float,2>{0.0837590471f, 0.802773654f},
-std::array<float,2>{0.533174515f, 0.138943553f},
-std::array<float,2>{0.499047071f, 0.304037154f},
-std::array<float,2>{0.971347392f, 0.73570621f},
-std::array<float,2>{0.0534448996f, 0.651845336f},
-std::array<float,2>{0.597827733f, 0.332956374f},
-std::array<float,2>{0.431559592f, 0.236364663f},
-std::array<float,2>{0.903854311f, 0.871931911f},
-std::array<float,2>{0.341721684f, 0.927660048f},
-std::array<float,2>{0.821952164f, 0.0389155969f},
-std::array<float,2>{0.137417346f, 0.476469576f},
-std::array<float,2>{0.737456322f, 0.500389159f},
-std::array<float,2>{0.489232272f, 0.563590825f},
-std::array<float,2>{0.982159913f, 0.431482583f},
-std::array<float,2>{0.0892205313f, 0.103828393f},
-std::array<float,2>{0.539980173f, 0.956902504f},
-std::array<float,2>{0.221735671f, 0.770615876f},
-std::array<float,2>{0.678445876f, 0.183890373f},
-std::array<float,2>{0.297037333f, 0.277469099f},
-std::array<float,2>{0.771761596f, 0.706653893f},
-std::array<float,2>{0.172001481f, 0.541639328f},
-std::array<float,2>{0.711932182f, 0.457772583f},
-std::array<float,2>{0.346917748f, 0.0212480575f},
-std::array<float,2>{0.873786569f, 0.89830029f},
-std::array<float,2>{0.396267653f, 0.813006878f},
-std::array<float,2>{0.924082577f, 0.203776821f},
-std::array<float,2>{0.0181356743f, 0.344487667f},
-std::array<float,2>{0.567628682f, 0.674214602f},
-std::array<float,2>{0.280759633f, 0.743811369f},
-std::array<float,2>{0.782315612f, 0.306489885f},
-std::array<float,2>{0.206153855f, 0.131018922f},
-std::array<float,2>{0.637583852f, 0.805584848f},
-std::array<float,2>{0.11129652f, 0.96880883f},
-std::array<float,2>{0.53118062f, 0.078631863f},
-std::array<float,2>{0.459582597f, 0.382100046f},
-std::array<float,2>{0.94279474f, 0.608480513f},
-std::array<float,2>{0.0669973865f, 0.623181105f},
-std::array<float,2>{0.554041624f, 0.395711094f},
-std::array<float,2>{0.469316661f, 0.0700279027f},
-std::array<float,2>{0.994740725f, 0.994100094f},
-std::array<float,2>{0.283428311f, 0.787788272f},
-std::array<float,2>{0.753742397f, 0.146318004f},
-std::array<float,2>{0.243451312f, 0.285338253f},
-std::array<float,2>{0.663275123f, 0.726013303f},
-std::array<float,2>{0.407340139f, 0.671330273f},
-std::array<float,2>{0.875516713f, 0.37231186f},
-std::array<float,2>{0.0464238301f, 0.193986997f},
-std::array<float,2>{0.609715641f, 0.843061268f},
-std::array<float,2>{0.15377216f, 0.883447707f},
-std::array<float,2>{0.728188992f, 0.0115520107f},
-std::array<float,2>{0.326252341f, 0.438990861f},
-std::array<float,2>{0.829302192f, 0.548155844f},
-std::array<float,2>{0.191632003f, 0.697247744f},
-std::array<float,2>{0.64951086f, 0.256556004f},
-std::array<float,2>{0.251953244f, 0.159095317f},
-std::array<float,2>{0.805230916f, 0.758822203f},
-std::array<float,2>{0.444885492f, 0.945117116f},
-std::array<float,2>{0.961094737f, 0.1189707f},
-std::array<float,2>{0.0977626294f, 0.419075459f},
-std::array<float,2>{0.509669423f, 0.591745913f},
-std::array<float,2>{0.359652042f, 0.527978897f},
-std::array<float,2>{0.855571389f, 0.495109856f},
-std::array<float,2>{0.156862259f, 0.0560677908f},
-std::array<float,2>{0.687606037f, 0.921578228f},
-std::array<float,2>{0.0126536591f, 0.849243343f},
-std::array<float,2>{0.59219265f, 0.231610745f},
-std::array<float,2>{0.379235387f, 0.326862365f},
-std::array<float,2>{0.920548618f, 0.631913304f},
-std::array<float,2>{0.0930081382f, 0.663499236f},
-std::array<float,2>{0.544368327f, 0.361986637f},
-std::array<float,2>{0.486642063f, 0.201591656f},
-std::array<float,2>{0.979997575f, 0.834115386f},
-std::array<float,2>{0.301846683f, 0.879773617f},
-std::array<float,2>{0.766681015f, 0.00557145616f},
-std::array<float,2>{0.226532474f, 0.452536702f},
-std::array<float,2>{0.674823642f, 0.556924939f},
-std::array<float,2>{0.437338978f, 0.61693573f},
-std::array<float,2>{0.902317643f, 0.403385431f},
-std::array<float,2>{0.0502154604f, 0.072365582f},
-std::array<float,2>{0.596285164f, 0.986639559f},
-std::array<float,2>{0.136672482f, 0.792614639f},
-std::array<float,2>{0.740589082f, 0.149087101f},
-std::array<float,2>{0.336909682f, 0.293658406f},
-std::array<float,2>{0.826350749f, 0.730292618f},
-std::array<float,2>{0.210392043f, 0.519379318f},
-std::array<float,2>{0.636247814f, 0.491318405f},
-std::array<float,2>{0.277123541f, 0.0470006689f},
-std::array<float,2>{0.787345052f, 0.907434404f},
-std::array<float,2>{0.453261197f, 0.85363692f},
-std::array<float,2>{0.93796128f, 0.223485366f},
-std::array<float,2>{0.113881737f, 0.314186692f},
-std::array<float,2>{0.526510775f, 0.633070111f},
-std::array<float,2>{0.350075513f, 0.690843701f},
-std::array<float,2>{0.869870424f, 0.261872619f},
-std::array<float,2>{0.177344158f, 0.171038046f},
-std::array<float,2>{0.716365039f, 0.755169988f},
-std::array<float,2>{0.0232090484f, 0.948506296f},
-std::array<float,2>{0.565935612f, 0.114016242f},
-std::array<float,2>{0.392347872f, 0.40716058f},
-std::array<float,2>{0.928480029f, 0.583847225f},
-std::array<float,2>{0.0421231687f, 0.57691139f},
-std::array<float,2>{0.616883278f, 0.425531238f},
-std::array<float,2>{0.410733104f, 0.100284874f},
-std::array<float,2>{0.88084811f, 0.961483479f},
-std::array<float,2>{0.320977092f, 0.780978322f},
-std::array<float,2>{0.832193136f, 0.177293271f},
-std::array<float,2>{0.148719251f, 0.268166482f},
-std::array<float,2>{0.733592331f, 0.712575734f},
-std::array<float,2>{0.473108411f, 0.640689254f},
-std::array<float,2>{0.997353256f, 0.336153209f},
-std::array<float,2>{0.0631185547f, 0.242374897f},
-std::array<float,2>{0.548503757f, 0.866938889f},
-std::array<float,2>{0.246350288f, 0.936196685f},
-std::array<float,2>{0.656864941f, 0.0424130186f},
-std::array<float,2>{0.286315799f, 0.478050143f},
-std::array<float,2>{0.754554152f, 0.515363991f},
-std::array<float,2>{0.16195938f, 0.740600467f},
-std::array<float,2>{0.693268836f, 0.296995372f},
-std::array<float,2>{0.363709241f, 0.134328589f},
-std::array<float,2>{0.853419363f, 0.798585117f},
-std::array<float,2>{0.376679629f, 0.97804451f},
-std::array<float,2>{0.916232109f, 0.0907880217f},
-std::array<float,2>{0.00931998156f, 0.384013772f},
-std::array<float,2>{0.58871305f, 0.594543338f},
-std::array<float,2>{0.257641912f, 0.532749057f},
-std::array<float,2>{0.809735656f, 0.467610925f},
-std::array<float,2>{0.188807651f, 0.0273184404f},
-std::array<float,2>{0.653674483f, 0.900953472f},
-std::array<float,2>{0.0962839723f, 0.822850585f},
-std::array<float,2>{0.51456368f, 0.211779043f},
-std::array<float,2>{0.439588934f, 0.353174925f},
-std::array<float,2>{0.966757953f, 0.685305774f},
-std::array<float,2>{0.00436278386f, 0.708529472f},
-std::array<float,2>{0.582287133f, 0.276867867f},
-std::array<float,2>{0.389047801f, 0.181667343f},
-std::array<float,2>{0.913929284f, 0.767850518f},
-std::array<float,2>{0.368650049f, 0.957211077f},
-std::array<float,2>{0.845849872f, 0.108558141f},
-std::array<float,2>{0.17080842f, 0.435084254f},
-std::array<float,2>{0.702640057f, 0.569663584f},
-std::array<float,2>{0.446916014f, 0.506483555f},
-std::array<float,2>{0.954342723f, 0.469408989f},
-std::array<float,2>{0.103960648f, 0.0326819085f},
-std::array<float,2>{0.504981279f, 0.922567427f},
-std::array<float,2>{0.200404972f, 0.871031702f},
-std::array<float,2>{0.645295262f, 0.240406796f},
-std::array<float,2>{0.262794077f, 0.328911752f},
-std::array<float,2>{0.804564238f, 0.656006873f},
-std::array<float,2>{0.146094546f, 0.601718605f},
-std::array<float,2>{0.722751379f, 0.375076115f},
-std::array<float,2>{0.314213336f, 0.0856237635f},
-std::array<float,2>{0.842980623f, 0.973030865f},
-std::array<float,2>{0.416379094f, 0.812184393f},
-std::array<float,2>{0.884355962f, 0.126718238f},
-std::array<float,2>{0.0371051505f, 0.312397778f},
-std::array<float,2>{0.618811011f, 0.747855365f},
-std::array<float,2>{0.289180249f, 0.676361442f},
-std::array<float,2>{0.765138865f, 0.348449737f},
-std::array<float,2>{0.234728858f, 0.207717493f},
-std::array<float,2>{0.665128112f, 0.818059862f},
-std::array<float,2>{0.0754293799f, 0.890714526f},
-std::array<float,2>{0.561032057f, 0.0177879445f},
-std::array<float,2>{0.482736886f, 0.454576969f},
-std::array<float,2>{0.989311516f, 0.544118166f},
-std::array<float,2>{0.120203547f, 0.554434299f},
-std::array<float,2>{0.516206801f, 0.444630861f},
-std::array<float,2>{0.466583192f, 0.0134035526f},
-std::array<float,2>{0.948228657f, 0.888769925f},
-std::array<float,2>{0.273067713f, 0.838621676f},
-std::array<float,2>{0.792961895f, 0.190239176f},
-std::array<float,2>{0.215641782f, 0.369567961f},
-std::array<float,2>{0.631855011f, 0.664957702f},
-std::array<float,2>{0.40485549f, 0.72206527f},
-std::array<float,2>{0.933192551f, 0.284446239f},
-std::array<float,2>{0.0300237872f, 0.143567204f},
-std::array<float,2>{0.57710886f, 0.781863987f},
-std::array<float,2>{0.182048187f, 0.999344885f},
-std::array<float,2>{0.705643535f, 0.0625211075f},
-std::array<float,2>{0.356032163f, 0.392820716f},
-std::array<float,2>{0.862841427f, 0.620875955f},
-std::array<float,2>{0.229882166f, 0.62658149f},
-std::array<float,2>{0.684370458f, 0.324109614f},
-std::array<float,2>{0.305715382f, 0.226812422f},
-std::array<float,2>{0.777473986f, 0.843951344f},
-std::array<float,2>{0.492421627f, 0.914264798f},
-std::array<float,2>{0.976129591f, 0.0621288866f},
-std::array<float,2>{0.0805516839f, 0.497032404f},
-std::array<float,2>{0.537136972f, 0.525978923f},
-std::array<float,2>{0.329653233f, 0.586739004f},
-std::array<float,2>{0.816602707f, 0.41483283f},
-std::array<float,2>{0.130985796f, 0.123589851f},
-std::array<float,2>{0.748928964f, 0.941106379f},
-std::array<float,2>{0.0563106723f, 0.764827371f},
-std::array<float,2>{0.606541097f, 0.163116738f},
-std::array<float,2>{0.428121388f, 0.253227293f},
-std::array<float,2>{0.894034266f, 0.700458229f},
-std::array<float,2>{0.0710464269f, 0.693555951f},
-std::array<float,2>{0.556712866f, 0.26118499f},
-std::array<float,2>{0.479578227f, 0.164272204f},
-std::array<float,2>{0.988269508f, 0.751410306f},
-std::array<float,2>{0.296772838f, 0.949285805f},
-std::array<float,2>{0.759230137f, 0.110780783f},
-std::array<float,2>{0.241782188f, 0.410198808f},
-std::array<float,2>{0.669159651f, 0.579342067f},
-std::array<float,2>{0.419269353f, 0.523322225f},
-std::array<float,2>{0.890576363f, 0.485076547f},
-std::array<float,2>{0.0337645225f, 0.0539645702f},
-std::array<float,2>{0.621437967f, 0.91133064f},
-std::array<float,2>{0.141796499f, 0.85702318f},
-std::array<float,2>{0.720475256f, 0.219254598f},
-std::array<float,2>{0.317180842f, 0.317473233f},
-std::array<float,2>{0.838411093f, 0.637543976f},
-std::array<float,2>{0.195535406f, 0.612840414f},
-std::array<float,2>{0.643621206f, 0.401579022f},
-std::array<float,2>{0.261545688f, 0.0775835738f},
-std::array<float,2>{0.797953904f, 0.988622069f},
-std::array<float,2>{0.452776492f, 0.795260191f},
-std::array<float,2>{0.957063019f, 0.154031992f},
-std::array<float,2>{0.107933447f, 0.291983366f},
-std::array<float,2>{0.500784934f, 0.731462896f},
-std::array<float,2>{0.374575943f, 0.657451034f},
-std::array<float,2>{0.850614488f, 0.366288662f},
-std::array<float,2>{0.164086208f, 0.198736429f},
-std::array<float,2>{0.696941614f, 0.829366207f},
-std::array<float,2>{0.00155331357f, 0.877272964f},
-std::array<float,2>{0.579962969f, 0.000702458608f},
-std::array<float,2>{0.386287034f, 0.447318375f},
-std::array<float,2>{0.907296956f, 0.560845912f},
-std::array<float,2>{0.0618640035f, 0.535672307f},
-std::array<float,2>{0.605213046f, 0.46232757f},
-std::array<float,2>{0.425100148f, 0.0297127012f},
-std::array<float,2>{0.898121476f, 0.902667642f},
-std::array<float,2>{0.333182037f, 0.825342536f},
-std::array<float,2>{0.814621985f, 0.215134472f},
-std::array<float,2>{0.12735115f, 0.356166363f},
-std::array<float,2>{0.745429873f, 0.679930866f},
-std::array<float,2>{0.49641636f, 0.737549484f},
-std::array<float,2>{0.968789756f, 0.302182645f},
-std::array<float,2>{0.0848851949f, 0.138485387f},
-std::array<float,2>{0.53408879f, 0.802370965f},
-std::array<float,2>{0.23416236f, 0.981423259f},
-std::array<float,2>{0.682576478f, 0.0863193423f},
-std::array<float,2>{0.312222034f, 0.386732727f},
-std::array<float,2>{0.773473203f, 0.598799884f},
-std::array<float,2>{0.18420285f, 0.648392558f},
-std::array<float,2>{0.70718646f, 0.341528475f},
-std::array<float,2>{0.352741092f, 0.248369694f},
-std::array<float,2>{0.864855289f, 0.861791432f},
-std::array<float,2>{0.399865776f, 0.929812849f},
-std::array<float,2>{0.937477827f, 0.0464823134f},
-std::array<float,2>{0.0259060394f, 0.483959198f},
-std::array<float,2>{0.570615053f, 0.508107662f},
-std::array<float,2>{0.269441396f, 0.571796775f},
-std::array<float,2>{0.795501888f, 0.42808637f},
-std::array<float,2>{0.211103007f, 0.0953004211f},
-std::array<float,2>{0.625927031f, 0.96603173f},
-std::array<float,2>{0.121531174f, 0.773622632f},
-std::array<float,2>{0.522736251f, 0.17222178f},
-std::array<float,2>{0.462325662f, 0.271899372f},
-std::array<float,2>{0.949911296f, 0.7151016f},
-std::array<float,2>{0.0165160652f, 0.673137963f},
-std::array<float,2>{0.569466472f, 0.347361267f},
-std::array<float,2>{0.398111641f, 0.206762686f},
-std::array<float,2>{0.923098624f, 0.815710485f},
-std::array<float,2>{0.345194787f, 0.895413637f},
-std::array<float,2>{0.871246219f, 0.0233643483f},
-std::array<float,2>{0.175703391f, 0.459958375f},
-std::array<float,2>{0.713027298f, 0.540314019f},
-std::array<float,2>{0.458274394f, 0.606467664f},
-std::array<float,2>{0.943806767f, 0.379448801f},
-std::array<float,2>{0.111988246f, 0.0814343542f},
-std::array<float,2>{0.527835011f, 0.971190095f},
-std::array<float,2>{0.203466743f, 0.808051646f},
-std::array<float,2>{0.63985461f, 0.129572853f},
-std::array<float,2>{0.278373152f, 0.306804061f},
-std::array<float,2>{0.784880877f, 0.745914519f},
-std::array<float,2>{0.140270561f, 0.502930403f},
-std::array<float,2>{0.734424591f, 0.472685188f},
-std::array<float,2>{0.343042225f, 0.0358713754f},
-std::array<float,2>{0.822348535f, 0.928477824f},
-std::array<float,2>{0.432583779f, 0.873976529f},
-std::array<float,2>{0.905391693f, 0.236020133f},
-std::array<float,2>{0.0526901446f, 0.33565414f},
-std::array<float,2>{0.599831045f, 0.650191069f},
-std::array<float,2>{0.30057925f, 0.704907835f},
-std::array<float,2>{0.76962769f, 0.280923575f},
-std::array<float,2>{0.22030291f, 0.186621144f},
-std::array<float,2>{0.677134156f, 0.772894084f},
-std::array<float,2>{0.0878881663f, 0.954214513f},
-std::array<float,2>{0.541311264f, 0.101891398f},
-std::array<float,2>{0.490907431f, 0.432734221f},
-std::array<float,2>{0.983071566f, 0.566356122f},
-std::array<float,2>{0.101557232f, 0.592118919f},
-std::array<float,2>{0.510311902f, 0.421242237f},
-std::array<float,2>{0.441435665f, 0.119173169f},
-std::array<float,2>{0.963072836f, 0.942676485f},
-std::array<float,2>{0.250249267f, 0.759820104f},
-std::array<float,2>{0.808113217f, 0.157201111f},
-std::array<float,2>{0.194841415f, 0.25547722f},
-std::array<float,2>{0.652255535f, 0.698563278f},
-std::array<float,2>{0.382589668f, 0.629402995f},
-std::array<float,2>{0.919767082f, 0.326010466f},
-std::array<float,2>{0.0141952764f, 0.233614802f},
-std::array<float,2>{0.591100335f, 0.851047635f},
-std::array<float,2>{0.159008473f, 0.918626785f},
-std::array<float,2>{0.689614356f, 0.0576055385f},
-std::array<float,2>{0.362021565f, 0.493742883f},
-std::array<float,2>{0.857916057f, 0.531040668f},
-std::array<float,2>{0.245082319f, 0.723948896f},
-std::array<float,2>{0.660173535f, 0.28880766f},
-std::array<float,2>{0.282648444f, 0.147043318f},
-std::array<float,2>{0.750890613f, 0.785766542f},
-std::array<float,2>{0.47184667f, 0.995341301f},
-std::array<float,2>{0.994018972f, 0.066816628f},
-std::array<float,2>{0.0698917508f, 0.396896541f},
-std::array<float,2>{0.552403927f, 0.622227013f},
-std::array<float,2>{0.325288832f, 0.549976289f},
-std::array<float,2>{0.830155551f, 0.439754337f},
-std::array<float,2>{0.155264571f, 0.0092629306f},
-std::array<float,2>{0.729753077f, 0.885797977f},
-std::array<float,2>{0.0445174091f, 0.841699839f},
-std::array<float,2>{0.613120854f, 0.191629887f},
-std::array<float,2>{0.409134924f, 0.373237163f},
-std::array<float,2>{0.878485799f, 0.668834984f},
-std::array<float,2>{0.117082417f, 0.635938764f},
-std::array<float,2>{0.525245547f, 0.314614952f},
-std::array<float,2>{0.45540157f, 0.225492403f},
-std::array<float,2>{0.940963328f, 0.852910519f},
-std::array<float,2>{0.273811758f, 0.909960389f},
-std::array<float,2>{0.786651194f, 0.0494099557f},
-std::array<float,2>{0.207724094f, 0.488615215f},
-std::array<float,2>{0.634230793f, 0.51727736f},
-std::array<float,2>{0.393334359f, 0.585367858f},
-std::array<float,2>{0.926223278f, 0.409325689f},
-std::array<float,2>{0.0202386677f, 0.115376487f},
-std::array<float,2>{0.563712537f, 0.946861625f},
-std::array<float,2>{0.177878335f, 0.757521689f},
-std::array<float,2>{0.717230976f, 0.169428363f},
-std::array<float,2>{0.349241525f, 0.264777571f},
-std::array<float,2>{0.868997753f, 0.688291371f},
-std::array<float,2>{0.222979993f, 0.555617988f},
-std::array<float,2>{0.672699869f, 0.450926572f},
-std::array<float,2>{0.30364722f, 0.00770014105f},
-std::array<float,2>{0.768785238f, 0.881087422f},
-std::array<float,2>{0.48527512f, 0.833299696f},
-std::array<float,2>{0.977923214f, 0.199840903f},
-std::array<float,2>{0.0917161405f, 0.361264914f},
-std::array<float,2>{0.544928014f, 0.660480261f},
-std::array<float,2>{0.338084906f, 0.728117406f},
-std::array<float,2>{0.825678229f, 0.296660334f},
-std::array<float,2>{0.133099616f, 0.152271509f},
-std::array<float,2>{0.739509225f, 0.789378703f},
-std::array<float,2>{0.0471813753f, 0.984448373f},
-std::array<float,2>{0.593953252f, 0.0704300925f},
-std::array<float,2>{0.43508181f, 0.404468238f},
-std::array<float,2>{0.898826241f, 0.613501847f},
-std::array<float,2>{0.0110753272f, 0.597463846f},
-std::array<float,2>{0.586992502f, 0.385451227f},
-std::array<float,2>{0.378002584f, 0.0921789408f},
-std::array<float,2>{0.914116621f, 0.979798675f},
-std::array<float,2>{0.36701709f, 0.799703121f},
-std::array<float,2>{0.853879511f, 0.136147216f},
-std::array<float,2>{0.163185999f, 0.300572366f},
-std::array<float,2>{0.694229841f, 0.739382923f},
-std::array<float,2>{0.43821913f, 0.687111557f},
-std::array<float,2>{0.967516303f, 0.35361895f},
-std::array<float,2>{0.0939026475f, 0.213131309f},
-std::array<float,2>{0.511931896f, 0.821473837f},
-std::array<float,2>{0.191131875f, 0.899589956f},
-std::array<float,2>{0.656123757f, 0.023942655f},
-std::array<float,2>{0.253909141f, 0.465845823f},
-std::array<float,2>{0.811970472f, 0.533317924f},
-std::array<float,2>{0.151500434f, 0.713583767f},
-std::array<float,2>{0.731975317f, 0.266385645f},
-std::array<float,2>{0.323088288f, 0.179104686f},
-std::array<float,2>{0.835223198f, 0.778085053f},
-std::array<float,2>{0.413473427f, 0.963945389f},
-std::array<float,2>{0.882238865f, 0.0983375758f},
-std::array<float,2>{0.0394654498f, 0.421936512f},
-std::array<float,2>{0.613562822f, 0.574529231f},
-std::array<float,2>{0.288903385f, 0.51218158f},
-std::array<float,2>{0.757094979f, 0.478584498f},
-std::array<float,2>{0.2498115f, 0.0410106145f},
-std::array<float,2>{0.658279896f, 0.934651256f},
-std::array<float,2>{0.0646289214f, 0.864669204f},
-std::array<float,2>{0.548859358f, 0.244751394f},
-std::array<float,2>{0.47464186f, 0.33789438f},
-std::array<float,2>{0.999854565f, 0.643742085f},
-std::array<float,2>{0.0385755077f, 0.74839288f},
-std::array<float,2>{0.620223343f, 0.309669614f},
-std::array<float,2>{0.41434136f, 0.127065793f},
-std::array<float,2>{0.885075748f, 0.809919298f},
-std::array<float,2>{0.314728022f, 0.97628659f},
-std::array<float,2>{0.840425551f, 0.0838104486f},
-std::array<float,2>{0.147790551f, 0.376987308f},
-std::array<float,2>{0.726549804f, 0.6050542f},
-std::array<float,2>{0.481466413f, 0.54582113f},
-std::array<float,2>{0.99127835f, 0.456711859f},
-std::array<float,2>{0.0768645555f, 0.0166394562f},
-std::array<float,2>{0.560267508f, 0.894485474f},
-std::array<float,2>{0.236544997f, 0.82015568f},
-std::array<float,2>{0.667487323f, 0.210182458f},
-std::array<float,2>{0.291294128f, 0.351136237f},
-std::array<float,2>{0.763419509f, 0.678606331f},
-std::array<float,2>{0.168084919f, 0.566740274f},
-std::array<float,2>{0.700197577f, 0.435590655f},
-std::array<float,2>{0.369188577f, 0.106556028f},
-std::array<float,2>{0.845457315f, 0.959100544f},
-std::array<float,2>{0.387032628f, 0.766694188f},
-std::array<float,2>{0.911376595f, 0.181461766f},
-std::array<float,2>{0.00749132736f, 0.274514675f},
-std::array<float,2>{0.585188568f, 0.710499823f},
-std::array<float,2>{0.264492005f, 0.653022945f},
-std::array<float,2>{0.802204251f, 0.331152409f},
-std::array<float,2>{0.202127963f, 0.239223555f},
-std::array<float,2>{0.647513986f, 0.868265688f},
-std::array<float,2>{0.102806434f, 0.923882663f},
-std::array<float,2>{0.507005394f, 0.0332123302f},
-std::array<float,2>{0.448686421f, 0.471369982f},
-std::array<float,2>{0.956083417f, 0.505772412f},
-std::array<float,2>{0.0797890127f, 0.523922324f},
-std::array<float,2>{0.535627961f, 0.499179393f},
-std::array<float,2>{0.49512428f, 0.0601950511f},
-std::array<float,2>{0.973434925f, 0.916394234f},
-std::array<float,2>{0.307849288f, 0.845823467f},
-std::array<float,2>{0.780849457f, 0.228934512f},
-std::array<float,2>{0.227730781f, 0.320700496f},
-std::array<float,2>{0.686106801f, 0.62794441f},
-std::array<float,2>{0.425959051f, 0.70279026f},
-std::array<float,2>{0.891777158f, 0.250466704f},
-std::array<float,2>{0.0566727966f, 0.161980525f},
-std::array<float,2>{0.608484983f, 0.762042344f},
-std::array<float,2>{0.129856154f, 0.93758136f},
-std::array<float,2>{0.747545362f, 0.12177664f},
-std::array<float,2>{0.331676424f, 0.417414963f},
-std::array<float,2>{0.819891453f, 0.589644313f},
-std::array<float,2>{0.217565581f, 0.667682409f},
-std::array<float,2>{0.629112959f, 0.369042099f},
-std::array<float,2>{0.270741314f, 0.188018367f},
-std::array<float,2>{0.790692627f, 0.83593899f},
-std::array<float,2>{0.467709571f, 0.886948586f},
-std::array<float,2>{0.946548581f, 0.0137102809f},
-std::array<float,2>{0.118679382f, 0.442221105f},
-std::array<float,2>{0.518691123f, 0.552630186f},
-std::array<float,2>{0.359109402f, 0.618364036f},
-std::array<float,2>{0.85994333f, 0.390925705f},
-std::array<float,2>{0.180585802f, 0.0647784546f},
-std::array<float,2>{0.705052078f, 0.996274114f},
-std::array<float,2>{0.0280406792f, 0.784675837f},
-std::array<float,2>{0.575790465f, 0.142529443f},
-std::array<float,2>{0.403671801f, 0.283023119f},
-std::array<float,2>{0.930879235f, 0.719802618f},
-std::array<float,2>{0.0907926187f, 0.730070055f},
-std::array<float,2>{0.545918822f, 0.293877482f},
-std::array<float,2>{0.485926449f, 0.149328068f},
-std::array<float,2>{0.976944804f, 0.792727828f},
-std::array<float,2>{0.30379644f, 0.986433446f},
-std::array<float,2>{0.768467963f, 0.0727418661f},
-std::array<float,2>{0.223826408f, 0.40370971f},
-std::array<float,2>{0.672990024f, 0.617066145f},
-std::array<float,2>{0.434394985f, 0.556677103f},
-std::array<float,2>{0.899870872f, 0.452260017f},
-std::array<float,2>{0.0485736169f, 0.00570457987f},
-std::array<float,2>{0.59491837f, 0.879478753f},
-std::array<float,2>{0.13442415f, 0.83445406f},
-std::array<float,2>{0.73924917f, 0.201255366f},
-std::array<float,2>{0.339726716f, 0.362128824f},
-std::array<float,2>{0.824415386f, 0.66322118f},
-std::array<float,2>{0.208937883f, 0.583540797f},
-std::array<float,2>{0.632906914f, 0.406965166f},
-std::array<float,2>{0.274440289f, 0.113992631f},
-std::array<float,2>{0.785411239f, 0.948375762f},
-std::array<float,2>{0.456918806f, 0.755043924f},
-std::array<float,2>{0.939861596f, 0.171239361f},
-std::array<float,2>{0.115555882f, 0.262026787f},
-std::array<float,2>{0.523707747f, 0.690459311f},
-std::array<float,2>{0.348078966f, 0.63293159f},
-std::array<float,2>{0.867492557f, 0.314220458f},
-std::array<float,2>{0.179526493f, 0.22328113f},
-std::array<float,2>{0.718259811f, 0.853791833f},
-std::array<float,2>{0.0214515235f, 0.907590747f},
-std::array<float,2>{0.563268006f, 0.0472278856f},
-std::array<float,2>{0.394405007f, 0.491517454f},
-std::array<float,2>{0.927523971f, 0.519211709f},
-std::array<float,2>{0.0407834314f, 0.515543938f},
-std::array<float,2>{0.614654422f, 0.478328675f},
-std::array<float,2>{0.412842631f, 0.0421462469f},
-std::array<float,2>{0.88129276f, 0.936308146f},
-std::array<float,2>{0.323960036f, 0.867076516f},
-std::array<float,2>{0.834871173f, 0.242544547f},
-std::array<float,2>{0.150715128f, 0.336330652f},
-std::array<float,2>{0.730672479f, 0.64098078f},
-std::array<float,2>{0.476042569f, 0.712818444f},
-std::array<float,2>{0.998358548f, 0.268528968f},
-std::array<float,2>{0.0662360936f, 0.177529603f},
-std::array<float,2>{0.550612569f, 0.781194866f},
-std::array<float,2>{0.248149648f, 0.9617576f},
-std::array<float,2>{0.65954411f, 0.100481749f},
-std::array<float,2>{0.287995666f, 0.425658822f},
-std::array<float,2>{0.756079316f, 0.576663554f},
-std::array<float,2>{0.162662685f, 0.685110569f},
-std::array<float,2>{0.695058405f, 0.353511512f},
-std::array<float,2>{0.365519524f, 0.211496696f},
-std::array<float,2>{0.854780555f, 0.823127508f},
-std::array<float,2>{0.377498269f, 0.901355386f},
-std::array<float,2>{0.915324628f, 0.0268883724f},
-std::array<float,2>{0.0103747575f, 0.467519313f},
-std::array<float,2>{0.586021423f, 0.533199966f},
-std::array<float,2>{0.255735189f, 0.594366848f},
-std::array<float,2>{0.811423123f, 0.384083867f},
-std::array<float,2>{0.190079153f, 0.0904648677f},
-std::array<float,2>{0.654455125f, 0.978448451f},
-std::array<float,2>{0.0955230147f, 0.798363388f},
-std::array<float,2>{0.512818277f, 0.13475208f},
-std::array<float,2>{0.438603848f, 0.297137558f},
-std::array<float,2>{0.968416095f, 0.740250707f},
-std::array<float,2>{0.00616205484f, 0.65593493f},
-std::array<float,2>{0.584224463f, 0.328760952f},
-std::array<float,2>{0.388565242f, 0.240507036f},
-std::array<float,2>{0.910227358f, 0.870717585f},
-std::array<float,2>{0.37037304f, 0.922752738f},
-std::array<float,2>{0.843773901f, 0.0323949978f},
-std::array<float,2>{0.169772416f, 0.46964252f},
-std::array<float,2>{0.699760556f, 0.506630063f},
-std::array<float,2>{0.448005468f, 0.569361031f},
-std::array<float,2>{0.955158174f, 0.435410321f},
-std::array<float,2>{0.102456048f, 0.108689785f},
-std::array<float,2>{0.506580234f, 0.95739311f},
-std::array<float,2>{0.202658147f, 0.767594814f},
-std::array<float,2>{0.647404969f, 0.181886002f},
-std::array<float,2>{0.264893979f, 0.277250856f},
-std::array<float,2>{0.800825715f, 0.708799899f},
-std::array<float,2>{0.146792173f, 0.544263244f},
-std::array<float,2>{0.724827111f, 0.45424971f},
-std::array<float,2>{0.316116214f, 0.0179562587f},
-std::array<float,2>{0.841291904f, 0.890978575f},
-std::array<float,2>{0.415555149f, 0.818304181f},
-std::array<float,2>{0.885870814f, 0.207979843f},
-std::array<float,2>{0.0376257524f, 0.348265052f},
-std::array<float,2>{0.619234145f, 0.676743984f},
-std::array<float,2>{0.292624176f, 0.74759531f},
-std::array<float,2>{0.76258713f, 0.312189639f},
-std::array<float,2>{0.237863585f, 0.126509115f},
-std::array<float,2>{0.666425347f, 0.812299252f},
-std::array<float,2>{0.0773738995f, 0.972839594f},
-std::array<float,2>{0.559299648f, 0.0858405456f},
-std::array<float,2>{0.480888754f, 0.375310361f},
-std::array<float,2>{0.9903332f, 0.601964414f},
-std::array<float,2>{0.117981739f, 0.620650291f},
-std::array<float,2>{0.517621994f, 0.393045396f},
-std::array<float,2>{0.468059897f, 0.0629613847f},
-std::array<float,2>{0.94588244f, 0.999115765f},
-std::array<float,2>{0.270134658f, 0.782154977f},
-std::array<float,2>{0.789308429f, 0.144009456f},
-std::array<float,2>{0.218085721f, 0.284220338f},
-std::array<float,2>{0.630652905f, 0.721894562f},
-std::array<float,2>{0.403105199f, 0.664587677f},
-std::array<float,2>{0.930113971f, 0.369233251f},
-std::array<float,2>{0.0291076582f, 0.190104157f},
-std::array<float,2>{0.57464695f, 0.838865697f},
-std::array<float,2>{0.181268916f, 0.889078915f},
-std::array<float,2>{0.703938484f, 0.0134954965f},
-std::array<float,2>{0.358004868f, 0.444369316f},
-std::array<float,2>{0.861215413f, 0.55454427f},
-std::array<float,2>{0.227288961f, 0.700432897f},
-std::array<float,2>{0.686936796f, 0.253172427f},
-std::array<float,2>{0.307155192f, 0.163364261f},
-std::array<float,2>{0.780269742f, 0.764991105f},
-std::array<float,2>{0.494172156f, 0.941239536f},
-std::array<float,2>{0.974165678f, 0.123973377f},
-std::array<float,2>{0.0783147141f, 0.414649248f},
-std::array<float,2>{0.536926031f, 0.5864802f},
-std::array<float,2>{0.331006259f, 0.526182652f},
-std::array<float,2>{0.819175243f, 0.496776074f},
-std::array<float,2>{0.130380422f, 0.0623844117f},
-std::array<float,2>{0.746952653f, 0.914410174f},
-std::array<float,2>{0.0580950789f, 0.844146132f},
-std::array<float,2>{0.608160317f, 0.22677213f},
-std::array<float,2>{0.427587152f, 0.323907942f},
-std::array<float,2>{0.89145261f, 0.62694782f},
-std::array<float,2>{0.108749233f, 0.660116673f},
-std::array<float,2>{0.501762211f, 0.364661425f},
-std::array<float,2>{0.451264501f, 0.195455179f},
-std::array<float,2>{0.958803058f, 0.830488145f},
-std::array<float,2>{0.259911746f, 0.875089228f},
-std::array<float,2>{0.79763031f, 0.00356953591f},
-std::array<float,2>{0.196695924f, 0.446979702f},
-std::array<float,2>{0.643341422f, 0.559333086f},
-std::array<float,2>{0.385472566f, 0.60953021f},
-std::array<float,2>{0.906720281f, 0.400151789f},
-std::array<float,2>{0.000771691033f, 0.0756339803f},
-std::array<float,2>{0.578650713f, 0.990574419f},
-std::array<float,2>{0.165801689f, 0.793688595f},
-std::array<float,2>{0.696281195f, 0.155752301f},
-std::array<float,2>{0.373289019f, 0.28921628f},
-std::array<float,2>{0.849665821f, 0.732587159f},
-std::array<float,2>{0.240699336f, 0.519548118f},
-std::array<float,2>{0.668431759f, 0.487406522f},
-std::array<float,2>{0.295208663f, 0.0515398495f},
-std::array<float,2>{0.757850707f, 0.91400826f},
-std::array<float,2>{0.478733271f, 0.858096302f},
-std::array<float,2>{0.986908793f, 0.222511739f},
-std::array<float,2>{0.0714953542f, 0.318793237f},
-std::array<float,2>{0.558494806f, 0.64046216f},
-std::array<float,2>{0.318187267f, 0.692784011f},
-std::array<float,2>{0.839606404f, 0.258835763f},
-std::array<float,2>{0.140631124f, 0.167333543f},
-std::array<float,2>{0.718814909f, 0.753052056f},
-std::array<float,2>{0.0346109644f, 0.952789605f},
-std::array<float,2>{0.62237525f, 0.112474501f},
-std::array<float,2>{0.418756068f, 0.413802564f},
-std::array<float,2>{0.889359593f, 0.580835223f},
-std::array<float,2>{0.0273010246f, 0.573720157f},
-std::array<float,2>{0.571795642f, 0.427441865f},
-std::array<float,2>{0.398841828f, 0.0975078568f},
-std::array<float,2>{0.935570538f, 0.967310965f},
-std::array<float,2>{0.352193922f, 0.776817024f},
-std::array<float,2>{0.863467693f, 0.174113944f},
-std::array<float,2>{0.18526493f, 0.270089149f},
-std::array<float,2>{0.70835948f, 0.718270898f},
-std::array<float,2>{0.461271256f, 0.644873917f},
-std::array<float,2>{0.950426459f, 0.342146188f},
-std::array<float,2>{0.123015925f, 0.247181416f},
-std::array<float,2>{0.522071898f, 0.861234844f},
-std::array<float,2>{0.21260415f, 0.93262738f},
-std::array<float,2>{0.626244068f, 0.0447120219f},
-std::array<float,2>{0.268297851f, 0.480608344f},
-std::array<float,2>{0.796707332f, 0.511205435f},
-std::array<float,2>{0.128003016f, 0.735460758f},
-std::array<float,2>{0.744687915f, 0.303826451f},
-std::array<float,2>{0.332254261f, 0.138690069f},
-std::array<float,2>{0.816046298f, 0.803179026f},
-std::array<float,2>{0.424530387f, 0.98363179f},
-std::array<float,2>{0.897233605f, 0.0893611163f},
-std::array<float,2>{0.0612321682f, 0.389350712f},
-std::array<float,2>{0.603541434f, 0.600307167f},
-std::array<float,2>{0.311122179f, 0.538940728f},
-std::array<float,2>{0.775126338f, 0.46435079f},
-std::array<float,2>{0.23303172f, 0.0292911921f},
-std::array<float,2>{0.683087766f, 0.904736578f},
-std::array<float,2>{0.0858899429f, 0.827482045f},
-std::array<float,2>{0.53428477f, 0.218509153f},
-std::array<float,2>{0.497665018f, 0.358929098f},
-std::array<float,2>{0.96985811f, 0.683078468f},
-std::array<float,2>{0.0517183952f, 0.706808567f},
-std::array<float,2>{0.600792229f, 0.277607173f},
-std::array<float,2>{0.433024704f, 0.183602691f},
-std::array<float,2>{0.905042648f, 0.770864844f},
-std::array<float,2>{0.342173278f, 0.956624985f},
-std::array<float,2>{0.823784888f, 0.103611283f},
-std::array<float,2>{0.139578193f, 0.431303442f},
-std::array<float,2>{0.735455751f, 0.563907981f},
-std::array<float,2>{0.49218142f, 0.500024915f},
-std::array<float,2>{0.984007478f, 0.4761329f},
-std::array<float,2>{0.0862529576f, 0.0386966728f},
-std::array<float,2>{0.542489469f, 0.927351415f},
-std::array<float,2>{0.218801841f, 0.871674538f},
-std::array<float,2>{0.676730692f, 0.23678866f},
-std::array<float,2>{0.298976541f, 0.332579464f},
-std::array<float,2>{0.771310747f, 0.651489556f},
-std::array<float,2>{0.174034148f, 0.608877599f},
-std::array<float,2>{0.713967264f, 0.38193962f},
-std::array<float,2>{0.344061494f, 0.0790816545f},
-std::array<float,2>{0.872512758f, 0.969040692f},
-std::array<float,2>{0.397007585f, 0.805201769f},
-std::array<float,2>{0.922221541f, 0.13113226f},
-std::array<float,2>{0.0171363484f, 0.306171626f},
-std::array<float,2>{0.568923473f, 0.74392736f},
-std::array<float,2>{0.278194964f, 0.673953891f},
-std::array<float,2>{0.783882022f, 0.344312698f},
-std::array<float,2>{0.204292133f, 0.203943953f},
-std::array<float,2>{0.639408946f, 0.813250661f},
-std::array<float,2>{0.112782992f, 0.897970617f},
-std::array<float,2>{0.528701365f, 0.0210937727f},
-std::array<float,2>{0.457167327f, 0.457533568f},
-std::array<float,2>{0.94477272f, 0.541918099f},
-std::array<float,2>{0.0689975619f, 0.548032045f},
-std::array<float,2>{0.551436663f, 0.439328462f},
-std::array<float,2>{0.471617788f, 0.0112654669f},
-std::array<float,2>{0.992794096f, 0.883714259f},
-std::array<float,2>{0.282178789f, 0.842835426f},
-std::array<float,2>{0.751727998f, 0.194101438f},
-std::array<float,2>{0.245984867f, 0.372481436f},
-std::array<float,2>{0.661639035f, 0.671061575f},
-std::array<float,2>{0.40994668f, 0.725681841f},
-std::array<float,2>{0.877251804f, 0.285613865f},
-std::array<float,2>{0.0433146022f, 0.146080092f},
-std::array<float,2>{0.612097085f, 0.788022637f},
-std::array<float,2>{0.155926809f, 0.993668735f},
-std::array<float,2>{0.729375184f, 0.0700707808f},
-std::array<float,2>{0.324807525f, 0.395784318f},
-std::array<float,2>{0.831854224f, 0.623494208f},
-std::array<float,2>{0.194007456f, 0.632186592f},
-std::array<float,2>{0.650401831f, 0.327125549f},
-std::array<float,2>{0.251106113f, 0.231759652f},
-std::array<float,2>{0.807481229f, 0.849414766f},
-std::array<float,2>{0.442977697f, 0.921808839f},
-std::array<float,2>{0.964186013f, 0.0558774807f},
-std::array<float,2>{0.100478701f, 0.494628966f},
-std::array<float,2>{0.511253595f, 0.528129458f},
-std::array<float,2>{0.363275379f, 0.591321826f},
-std::array<float,2>{0.859018862f, 0.419212788f},
-std::array<float,2>{0.159937501f, 0.118675269f},
-std::array<float,2>{0.690495253f, 0.944837511f},
-std::array<float,2>{0.0155603373f, 0.759154201f},
-std::array<float,2>{0.589985669f, 0.158908695f},
-std::array<float,2>{0.381060004f, 0.256723493f},
-std::array<float,2>{0.918891788f, 0.696786761f},
-std::array<float,2>{0.114300072f, 0.688194633f},
-std::array<float,2>{0.525935352f, 0.264962912f},
-std::array<float,2>{0.454620004f, 0.169187739f},
-std::array<float,2>{0.938924968f, 0.757746577f},
-std::array<float,2>{0.276000142f, 0.947032869f},
-std::array<float,2>{0.788573563f, 0.115713388f},
-std::array<float,2>{0.20979017f, 0.409632862f},
-std::array<float,2>{0.635346889f, 0.585149825f},
-std::array<float,2>{0.391194463f, 0.517350912f},
-std::array<float,2>{0.928866923f, 0.488402575f},
-std::array<float,2>{0.0216036588f, 0.0497646704f},
-std::array<float,2>{0.565303028f, 0.909766495f},
-std::array<float,2>{0.176399574f, 0.852632701f},
-std::array<float,2>{0.715189576f, 0.225175738f},
-std::array<float,2>{0.350911707f, 0.314837515f},
-std::array<float,2>{0.870526254f, 0.63607657f},
-std::array<float,2>{0.224860847f, 0.613711953f},
-std::array<float,2>{0.674351275f, 0.404611886f},
-std::array<float,2>{0.301452816f, 0.0706589743f},
-std::array<float,2>{0.766016304f, 0.984737337f},
-std::array<float,2>{0.487313539f, 0.789186299f},
-std::array<float,2>{0.979484022f, 0.152086139f},
-std::array<float,2>{0.0918266475f, 0.296535969f},
-std::array<float,2>{0.543919623f, 0.728461623f},
-std::array<float,2>{0.337553263f, 0.660394669f},
-std::array<float,2>{0.828049481f, 0.360931456f},
-std::array<float,2>{0.135361388f, 0.200102314f},
-std::array<float,2>{0.741858602f, 0.833054662f},
-std::array<float,2>{0.0490789451f, 0.881291986f},
-std::array<float,2>{0.597171485f, 0.00736467727f},
-std::array<float,2>{0.435830921f, 0.451014519f},
-std::array<float,2>{0.901043892f, 0.555195868f},
-std::array<float,2>{0.00833364576f, 0.533535063f},
-std::array<float,2>{0.588981628f, 0.466299921f},
-std::array<float,2>{0.375722438f, 0.0241982546f},
-std::array<float,2>{0.917783737f, 0.89983505f},
-std::array<float,2>{0.364275008f, 0.821679115f},
-std::array<float,2>{0.852296889f, 0.213279083f},
-std::array<float,2>{0.160372391f, 0.353990346f},
-std::array<float,2>{0.691970408f, 0.687474966f},
-std::array<float,2>{0.440501571f, 0.739513397f},
-std::array<float,2>{0.965218663f, 0.300435543f},
-std::array<float,2>{0.0969768241f, 0.135744691f},
-std::array<float,2>{0.515282512f, 0.799537063f},
-std::array<float,2>{0.188083366f, 0.979722679f},
-std::array<float,2>{0.652835548f, 0.0919843316f},
-std::array<float,2>{0.256518096f, 0.38555783f},
-std::array<float,2>{0.809277177f, 0.597270191f},
-std::array<float,2>{0.150198221f, 0.643951297f},
-std::array<float,2>{0.733081281f, 0.338331491f},
-std::array<float,2>{0.321510106f, 0.244874299f},
-std::array<float,2>{0.833042741f, 0.864417493f},
-std::array<float,2>{0.412031502f, 0.934913754f},
-std::array<float,2>{0.879648268f, 0.0405730903f},
-std::array<float,2>{0.0418451764f, 0.478843778f},
-std::array<float,2>{0.615837514f, 0.511810005f},
-std::array<float,2>{0.285286576f, 0.574343085f},
-std::array<float,2>{0.755436599f, 0.42221427f},
-std::array<float,2>{0.247324169f, 0.0986013263f},
-std::array<float,2>{0.65726459f, 0.964348733f},
-std::array<float,2>{0.0644337609f, 0.778006911f},
-std::array<float,2>{0.5478248f, 0.178873718f},
-std::array<float,2>{0.473920494f, 0.266270131f},
-std::array<float,2>{0.99641943f, 0.713762939f},
-std::array<float,2>{0.0352067277f, 0.678413868f},
-std::array<float,2>{0.61798501f, 0.351348817f},
-std::array<float,2>{0.417182863f, 0.210437506f},
-std::array<float,2>{0.882991195f, 0.819855869f},
-std::array<float,2>{0.312674105f, 0.89418298f},
-std::array<float,2>{0.842264593f, 0.0169162489f},
-std::array<float,2>{0.144547254f, 0.456791192f},
-std::array<float,2>{0.723785937f, 0.545591235f},
-std::array<float,2>{0.484042615f, 0.605438232f},
-std::array<float,2>{0.988596499f, 0.377221704f},
-std::array<float,2>{0.0749862418f, 0.0835379288f},
-std::array<float,2>{0.561733484f, 0.976544857f},
-std::array<float,2>{0.2354507f, 0.809642255f},
-std::array<float,2>{0.664722979f, 0.127363384f},
-std::array<float,2>{0.290875077f, 0.309939623f},
-std::array<float,2>{0.764232218f, 0.748234093f},
-std::array<float,2>{0.171167091f, 0.505603313f},
-std::array<float,2>{0.701444507f, 0.471499056f},
-std::array<float,2>{0.367826581f, 0.0336095802f},
-std::array<float,2>{0.846798122f, 0.924117267f},
-std::array<float,2>{0.390188098f, 0.868579805f},
-std::array<float,2>{0.912551701f, 0.23888965f},
-std::array<float,2>{0.00560655491f, 0.331347346f},
-std::array<float,2>{0.583248198f, 0.653296292f},
-std::array<float,2>{0.261838526f, 0.710916936f},
-std::array<float,2>{0.803285599f, 0.274899513f},
-std::array<float,2>{0.199442491f, 0.181384593f},
-std::array<float,2>{0.645679414f, 0.767058372f},
-std::array<float,2>{0.105433732f, 0.959394813f},
-std::array<float,2>{0.504725277f, 0.106768869f},
-std::array<float,2>{0.445611745f, 0.435924739f},
-std::array<float,2>{0.953323901f, 0.566550791f},
-std::array<float,2>{0.0816537961f, 0.589368999f},
-std::array<float,2>{0.53826195f, 0.417129934f},
-std::array<float,2>{0.493648618f, 0.121937431f},
-std::array<float,2>{0.97525996f, 0.937925935f},
-std::array<float,2>{0.305250883f, 0.761960566f},
-std::array<float,2>{0.778800488f, 0.161677003f},
-std::array<float,2>{0.228771284f, 0.25002268f},
-std::array<float,2>{0.685012281f, 0.703004539f},
-std::array<float,2>{0.429439634f, 0.628290713f},
-std::array<float,2>{0.893362939f, 0.320381433f},
-std::array<float,2>{0.0554168485f, 0.228518471f},
-std::array<float,2>{0.605523705f, 0.846177161f},
-std::array<float,2>{0.132568985f, 0.916019022f},
-std::array<float,2>{0.749459743f, 0.0603131019f},
-std::array<float,2>{0.328773975f, 0.499450147f},
-std::array<float,2>{0.817597687f, 0.523573995f},
-std::array<float,2>{0.216101259f, 0.72009629f},
-std::array<float,2>{0.631731331f, 0.282792419f},
-std::array<float,2>{0.271870226f, 0.142123595f},
-std::array<float,2>{0.791298449f, 0.785020411f},
-std::array<float,2>{0.465208679f, 0.996350706f},
-std::array<float,2>{0.948657691f, 0.0646556392f},
-std::array<float,2>{0.119603038f, 0.390762985f},
-std::array<float,2>{0.516853988f, 0.618551135f},
-std::array<float,2>{0.357001424f, 0.552340984f},
-std::array<float,2>{0.861516297f, 0.441973597f},
-std::array<float,2>{0.182621419f, 0.0139891012f},
-std::array<float,2>{0.706706226f, 0.887059331f},
-std::array<float,2>{0.0308857355f, 0.83635354f},
-std::array<float,2>{0.577313006f, 0.18826507f},
-std::array<float,2>{0.40561226f, 0.368707776f},
-std::array<float,2>{0.932199895f, 0.667786539f},
-std::array<float,2>{0.0729515478f, 0.637292862f},
-std::array<float,2>{0.555445254f, 0.317869961f},
-std::array<float,2>{0.476750314f, 0.219585851f},
-std::array<float,2>{0.984575689f, 0.857421041f},
-std::array<float,2>{0.293860167f, 0.911486864f},
-std::array<float,2>{0.761062562f, 0.0539053977f},
-std::array<float,2>{0.238792107f, 0.485248655f},
-std::array<float,2>{0.670437753f, 0.523182988f},
-std::array<float,2>{0.421176344f, 0.579399049f},
-std::array<float,2>{0.886802852f, 0.41044277f},
-std::array<float,2>{0.0317250229f, 0.110480033f},
-std::array<float,2>{0.624231398f, 0.949634433f},
-std::array<float,2>{0.143279806f, 0.751199961f},
-std::array<float,2>{0.721169531f, 0.164420381f},
-std::array<float,2>{0.319416791f, 0.260924637f},
-std::array<float,2>{0.837593913f, 0.693647206f},
-std::array<float,2>{0.199079618f, 0.560631633f},
-std::array<float,2>{0.641897142f, 0.447727591f},
-std::array<float,2>{0.258454204f, 0.00094134605f},
-std::array<float,2>{0.799271703f, 0.877144396f},
-std::array<float,2>{0.449686408f, 0.829234064f},
-std::array<float,2>{0.960243464f, 0.199099705f},
-std::array<float,2>{0.106636651f, 0.366539568f},
-std::array<float,2>{0.503789723f, 0.65747267f},
-std::array<float,2>{0.3720963f, 0.73171252f},
-std::array<float,2>{0.848307371f, 0.291687846f},
-std::array<float,2>{0.167847753f, 0.154165611f},
-std::array<float,2>{0.698733866f, 0.7950176f},
-std::array<float,2>{0.00371618941f, 0.988433361f},
-std::array<float,2>{0.580384731f, 0.0773557797f},
-std::array<float,2>{0.384137601f, 0.401708782f},
-std::array<float,2>{0.908518314f, 0.613098502f},
-std::array<float,2>{0.0588997416f, 0.599114895f},
-std::array<float,2>{0.603473008f, 0.387189984f},
-std::array<float,2>{0.422386557f, 0.0861501023f},
-std::array<float,2>{0.89463824f, 0.980959833f},
-std::array<float,2>{0.335037172f, 0.802608967f},
-std::array<float,2>{0.814324915f, 0.13819392f},
-std::array<float,2>{0.126884043f, 0.301997274f},
-std::array<float,2>{0.74224472f, 0.737412214f},
-std::array<float,2>{0.498291999f, 0.679953337f},
-std::array<float,2>{0.972409844f, 0.3563416f},
-std::array<float,2>{0.0828602836f, 0.214927331f},
-std::array<float,2>{0.532163501f, 0.825499654f},
-std::array<float,2>{0.231267259f, 0.902477086f},
-std::array<float,2>{0.680691063f, 0.0294351019f},
-std::array<float,2>{0.308991075f, 0.462008417f},
-std::array<float,2>{0.776465595f, 0.536086321f},
-std::array<float,2>{0.185801163f, 0.714936197f},
-std::array<float,2>{0.709427536f, 0.271615326f},
-std::array<float,2>{0.354547203f, 0.172072008f},
-std::array<float,2>{0.866223335f, 0.773878336f},
-std::array<float,2>{0.400811702f, 0.96615231f},
-std::array<float,2>{0.934710085f, 0.0955640897f},
-std::array<float,2>{0.0246182736f, 0.427749753f},
-std::array<float,2>{0.573919296f, 0.572074115f},
-std::array<float,2>{0.26658389f, 0.508006752f},
-std::array<float,2>{0.793270946f, 0.484308898f},
-std::array<float,2>{0.213568732f, 0.0467656143f},
-std::array<float,2>{0.627505124f, 0.930072248f},
-std::array<float,2>{0.124764219f, 0.861489415f},
-std::array<float,2>{0.520400941f, 0.248216867f},
-std::array<float,2>{0.463836163f, 0.341698349f},
-std::array<float,2>{0.95156163f, 0.648034751f},
-std::array<float,2>{0.0194502715f, 0.7457515f},
-std::array<float,2>{0.566663921f, 0.30694738f},
-std::array<float,2>{0.394745767f, 0.129858553f},
-std::array<float,2>{0.924845278f, 0.807833672f},
-std::array<float,2>{0.346483469f, 0.97089684f},
-std::array<float,2>{0.874917686f, 0.0811353624f},
-std::array<float,2>{0.173319861f, 0.379776418f},
-std::array<float,2>{0.711278081f, 0.606740832f},
-std::array<float,2>{0.460456938f, 0.540232241f},
-std::array<float,2>{0.942127585f, 0.45957002f},
-std::array<float,2>{0.10937845f, 0.0230336748f},
-std::array<float,2>{0.529580534f, 0.895054162f},
-std::array<float,2>{0.205709785f, 0.815662861f},
-std::array<float,2>{0.638228178f, 0.206934005f},
-std::array<float,2>{0.280024439f, 0.347481847f},
-std::array<float,2>{0.781540692f, 0.67309314f},
-std::array<float,2>{0.138453379f, 0.566072285f},
-std::array<float,2>{0.736653268f, 0.433045775f},
-std::array<float,2>{0.340565234f, 0.101723678f},
-std::array<float,2>{0.821151018f, 0.954432726f},
-std::array<float,2>{0.430533618f, 0.772580624f},
-std::array<float,2>{0.902711332f, 0.186922237f},
-std::array<float,2>{0.0543735661f, 0.281148255f},
-std::array<float,2>{0.598918915f, 0.704618454f},
-std::array<float,2>{0.298786879f, 0.650027275f},
-std::array<float,2>{0.772783279f, 0.335721493f},
-std::array<float,2>{0.220949367f, 0.236245945f},
-std::array<float,2>{0.678924024f, 0.873675168f},
-std::array<float,2>{0.0883031487f, 0.928336084f},
-std::array<float,2>{0.540285528f, 0.035952922f},
-std::array<float,2>{0.489651054f, 0.473086536f},
-std::array<float,2>{0.981131732f, 0.503307104f},
-std::array<float,2>{0.0995078012f, 0.530945599f},
-std::array<float,2>{0.50866574f, 0.493901581f},
-std::array<float,2>{0.443740308f, 0.057241898f},
-std::array<float,2>{0.962623537f, 0.918824375f},
-std::array<float,2>{0.252952456f, 0.850751698f},
-std::array<float,2>{0.806390703f, 0.233805344f},
-std::array<float,2>{0.192540064f, 0.325915992f},
-std::array<float,2>{0.648958921f, 0.629683435f},
-std::array<float,2>{0.380604357f, 0.69837743f},
-std::array<float,2>{0.921017051f, 0.255792797f},
-std::array<float,2>{0.0131940721f, 0.156856492f},
-std::array<float,2>{0.593216777f, 0.760084093f},
-std::array<float,2>{0.157663465f, 0.942421138f},
-std::array<float,2>{0.688865483f, 0.119441435f},
-std::array<float,2>{0.361291915f, 0.421064824f},
-std::array<float,2>{0.857341111f, 0.591858387f},
-std::array<float,2>{0.242753193f, 0.668554544f},
-std::array<float,2>{0.662631094f, 0.37349081f},
-std::array<float,2>{0.284376919f, 0.191700384f},
-std::array<float,2>{0.752844095f, 0.84141469f},
-std::array<float,2>{0.47024104f, 0.886116982f},
-std::array<float,2>{0.9957093f, 0.00888874475f},
-std::array<float,2>{0.0676746666f, 0.439663738f},
-std::array<float,2>{0.553371549f, 0.550197184f},
-std::array<float,2>{0.327403814f, 0.622424483f},
-std::array<float,2>{0.828374922f, 0.396501034f},
-std::array<float,2>{0.152393401f, 0.0665093735f},
-std::array<float,2>{0.727092862f, 0.995449483f},
-std::array<float,2>{0.0449306555f, 0.786094546f},
-std::array<float,2>{0.610480249f, 0.147427008f},
-std::array<float,2>{0.407103211f, 0.2890549f},
-std::array<float,2>{0.876389027f, 0.723861098f},
-std::array<float,2>{0.0960006863f, 0.741321027f},
-std::array<float,2>{0.51409477f, 0.298066884f},
-std::array<float,2>{0.440418005f, 0.133560643f},
-std::array<float,2>{0.965849996f, 0.797569811f},
-std::array<float,2>{0.25703451f, 0.976940215f},
-std::array<float,2>{0.810370445f, 0.0909685344f},
-std::array<float,2>{0.189276442f, 0.383185625f},
-std::array<float,2>{0.653972268f, 0.59474951f},
-std::array<float,2>{0.376116991f, 0.53130275f},
-std::array<float,2>{0.916569531f, 0.468014687f},
-std::array<float,2>{0.00925259385f, 0.0260254666f},
-std::array<float,2>{0.588248789f, 0.9017995f},
-std::array<float,2>{0.161295995f, 0.823463738f},
-std::array<float,2>{0.692682505f, 0.212157488f},
-std::array<float,2>{0.364184797f, 0.352526218f},
-std::array<float,2>{0.852973521f, 0.683771193f},
-std::array<float,2>{0.246733874f, 0.577562213f},
-std::array<float,2>{0.656623602f, 0.42431283f},
-std::array<float,2>{0.286632389f, 0.100701481f},
-std::array<float,2>{0.754190445f, 0.962560177f},
-std::array<float,2>{0.47316578f, 0.779624283f},
-std::array<float,2>{0.997791469f, 0.175888509f},
-std::array<float,2>{0.0625294968f, 0.269449383f},
-std::array<float,2>{0.54796803f, 0.711063743f},
-std::array<float,2>{0.320769906f, 0.641695797f},
-std::array<float,2>{0.832679808f, 0.336948305f},
-std::array<float,2>{0.14898023f, 0.243641898f},
-std::array<float,2>{0.734019041f, 0.865284562f},
-std::array<float,2>{0.0427001379f, 0.936999023f},
-std::array<float,2>{0.616442144f, 0.0417062864f},
-std::array<float,2>{0.41033265f, 0.476696283f},
-std::array<float,2>{0.880178332f, 0.513936818f},
-std::array<float,2>{0.0225773994f, 0.518299818f},
-std::array<float,2>{0.565447748f, 0.490745276f},
-std::array<float,2>{0.392049402f, 0.0485215373f},
-std::array<float,2>{0.928067625f, 0.906335771f},
-std::array<float,2>{0.350337744f, 0.85460335f},
-std::array<float,2>{0.869602084f, 0.224545002f},
-std::array<float,2>{0.176963121f, 0.312782824f},
-std::array<float,2>{0.7158674f, 0.634116471f},
-std::array<float,2>{0.453922004f, 0.690379322f},
-std::array<float,2>{0.93822664f, 0.263434678f},
-std::array<float,2>{0.113505825f, 0.170402914f},
-std::array<float,2>{0.527161539f, 0.754113674f},
-std::array<float,2>{0.210584641f, 0.9481861f},
-std::array<float,2>{0.636065125f, 0.11449483f},
-std::array<float,2>{0.276530057f, 0.407553703f},
-std::array<float,2>{0.788057208f, 0.582334697f},
-std::array<float,2>{0.136007026f, 0.66301471f},
-std::array<float,2>{0.741040885f, 0.362515002f},
-std::array<float,2>{0.33622244f, 0.203096956f},
-std::array<float,2>{0.826933146f, 0.835268915f},
-std::array<float,2>{0.436987281f, 0.880419075f},
-std::array<float,2>{0.90169102f, 0.00405600667f},
-std::array<float,2>{0.0504945703f, 0.45132184f},
-std::array<float,2>{0.596159935f, 0.558570087f},
-std::array<float,2>{0.302379489f, 0.615729749f},
-std::array<float,2>{0.767386138f, 0.402455151f},
-std::array<float,2>{0.22594437f, 0.0741560161f},
-std::array<float,2>{0.675458372f, 0.987448215f},
-std::array<float,2>{0.0936283991f, 0.79142797f},
-std::array<float,2>{0.54491353f, 0.149747655f},
-std::array<float,2>{0.486833453f, 0.294190168f},
-std::array<float,2>{0.979577601f, 0.729333162f},
-std::array<float,2>{0.0559722148f, 0.625664115f},
-std::array<float,2>{0.607405961f, 0.322517395f},
-std::array<float,2>{0.428619266f, 0.228298187f},
-std::array<float,2>{0.894353926f, 0.845382631f},
-std::array<float,2>{0.329400599f, 0.915320396f},
-std::array<float,2>{0.817242205f, 0.0607975647f},
-std::array<float,2>{0.131546244f, 0.497639537f},
-std::array<float,2>{0.74815917f, 0.526794672f},
-std::array<float,2>{0.49286896f, 0.587598443f},
-std::array<float,2>{0.975902319f, 0.415596157f},
-std::array<float,2>{0.0809925646f, 0.124574438f},
-std::array<float,2>{0.53803134f, 0.940014243f},
-std::array<float,2>{0.230286717f, 0.764058769f},
-std::array<float,2>{0.684007406f, 0.162983f},
-std::array<float,2>{0.306428164f, 0.252825171f},
-std::array<float,2>{0.777982414f, 0.699799299f},
-std::array<float,2>{0.182418093f, 0.553011835f},
-std::array<float,2>{0.705120862f, 0.443725467f},
-std::array<float,2>{0.355578929f, 0.0120380018f},
-std::array<float,2>{0.862571239f, 0.890225351f},
-std::array<float,2>{0.404375136f, 0.839674592f},
-std::array<float,2>{0.932894409f, 0.191080496f},
-std::array<float,2>{0.0295876712f, 0.370488733f},
-std::array<float,2>{0.576468587f, 0.665324867f},
-std::array<float,2>{0.272509366f, 0.721045136f},
-std::array<float,2>{0.792443752f, 0.283632815f},
-std::array<float,2>{0.21514681f, 0.143525392f},
-std::array<float,2>{0.632414818f, 0.783147335f},
-std::array<float,2>{0.12101505f, 0.998849988f},
-std::array<float,2>{0.515792489f, 0.0638703778f},
-std::array<float,2>{0.466067284f, 0.394374549f},
-std::array<float,2>{0.947315514f, 0.620032907f},
-std::array<float,2>{0.0758298859f, 0.603249192f},
-std::array<float,2>{0.561446309f, 0.376560867f},
-std::array<float,2>{0.482985824f, 0.0841757283f},
-std::array<float,2>{0.989894152f, 0.974400282f},
-std::array<float,2>{0.289629251f, 0.81082201f},
-std::array<float,2>{0.765079141f, 0.125617132f},
-std::array<float,2>{0.235265538f, 0.311157405f},
-std::array<float,2>{0.665779293f, 0.746555924f},
-std::array<float,2>{0.416851044f, 0.676944911f},
-std::array<float,2>{0.883790731f, 0.349329442f},
-std::array<float,2>{0.0363376588f, 0.208331868f},
-std::array<float,2>{0.618500292f, 0.816491961f},
-std::array<float,2>{0.145726889f, 0.891937256f},
-std::array<float,2>{0.723358691f, 0.0185731836f},
-std::array<float,2>{0.313886166f, 0.453350902f},
-std::array<float,2>{0.843292534f, 0.543412805f},
-std::array<float,2>{0.201169357f, 0.707688212f},
-std::array<float,2>{0.644781232f, 0.276239455f},
-std::array<float,2>{0.263594002f, 0.182807893f},
-std::array<float,2>{0.804008543f, 0.76878202f},
-std::array<float,2>{0.4466618f, 0.958212972f},
-std::array<float,2>{0.954707742f, 0.10775777f},
-std::array<float,2>{0.104289204f, 0.433795601f},
-std::array<float,2>{0.505704463f, 0.569287062f},
-std::array<float,2>{0.36894533f, 0.507400036f},
-std::array<float,2>{0.846416056f, 0.470454365f},
-std::array<float,2>{0.17003639f, 0.0312914066f},
-std::array<float,2>{0.70250839f, 0.922992229f},
-std::array<float,2>{0.00482326327f, 0.869968355f},
-std::array<float,2>{0.582709849f, 0.241385043f},
-std::array<float,2>{0.389201015f, 0.329298913f},
-std::array<float,2>{0.913462639f, 0.654842257f},
-std::array<float,2>{0.0830814466f, 0.682131827f},
-std::array<float,2>{0.532477975f, 0.357720107f},
-std::array<float,2>{0.499666244f, 0.217415795f},
-std::array<float,2>{0.971010685f, 0.826872587f},
-std::array<float,2>{0.309688151f, 0.905740857f},
-std::array<float,2>{0.776083231f, 0.0277694948f},
-std::array<float,2>{0.231721893f, 0.46328488f},
-std::array<float,2>{0.679821551f, 0.53729111f},
-std::array<float,2>{0.423446208f, 0.600984812f},
-std::array<float,2>{0.895596147f, 0.3898139f},
-std::array<float,2>{0.0603783727f, 0.088512823f},
-std::array<float,2>{0.601593435f, 0.982745767f},
-std::array<float,2>{0.125321165f, 0.803849995f},
-std::array<float,2>{0.743178368f, 0.140422851f},
-std::array<float,2>{0.334184587f, 0.303639948f},
-std::array<float,2>{0.813362956f, 0.735208333f},
-std::array<float,2>{0.214670017f, 0.51016295f},
-std::array<float,2>{0.628237426f, 0.482372314f},
-std::array<float,2>{0.267514586f, 0.0433684848f},
-std::array<float,2>{0.794541001f, 0.932346761f},
-std::array<float,2>{0.464616925f, 0.860303998f},
-std::array<float,2>{0.952933967f, 0.246264756f},
-std::array<float,2>{0.123841338f, 0.343568116f},
-std::array<float,2>{0.520768166f, 0.646224439f},
-std::array<float,2>{0.353775144f, 0.716988921f},
-std::array<float,2>{0.86583668f, 0.270552009f},
-std::array<float,2>{0.187177822f, 0.175173253f},
-std::array<float,2>{0.71006906f, 0.775662422f},
-std::array<float,2>{0.0240689721f, 0.968027234f},
-std::array<float,2>{0.572596908f, 0.0959897786f},
-std::array<float,2>{0.402310938f, 0.425914854f},
-std::array<float,2>{0.933797359f, 0.572326481f},
-std::array<float,2>{0.0327923037f, 0.581837595f},
-std::array<float,2>{0.623210788f, 0.412336141f},
-std::array<float,2>{0.419944257f, 0.111711912f},
-std::array<float,2>{0.888410687f, 0.951932907f},
-std::array<float,2>{0.318493247f, 0.75214529f},
-std::array<float,2>{0.836353302f, 0.166731045f},
-std::array<float,2>{0.143813133f, 0.258767128f},
-std::array<float,2>{0.722624004f, 0.691824436f},
-std::array<float,2>{0.47834447f, 0.638902664f},
-std::array<float,2>{0.985378802f, 0.319917232f},
-std::array<float,2>{0.0734953806f, 0.22085318f},
-std::array<float,2>{0.556540132f, 0.859103918f},
-std::array<float,2>{0.23953557f, 0.912194133f},
-std::array<float,2>{0.671534121f, 0.0526236072f},
-std::array<float,2>{0.294391602f, 0.487002671f},
-std::array<float,2>{0.760707259f, 0.520662904f},
-std::array<float,2>{0.166260913f, 0.734084606f},
-std::array<float,2>{0.697525144f, 0.290389925f},
-std::array<float,2>{0.371388793f, 0.154714897f},
-std::array<float,2>{0.849335909f, 0.794763803f},
-std::array<float,2>{0.382999539f, 0.991384387f},
-std::array<float,2>{0.909747779f, 0.0750114918f},
-std::array<float,2>{0.00227173441f, 0.398671001f},
-std::array<float,2>{0.581579983f, 0.610732794f},
-std::array<float,2>{0.259705424f, 0.560040295f},
-std::array<float,2>{0.800147474f, 0.445889533f},
-std::array<float,2>{0.1973553f, 0.0022767128f},
-std::array<float,2>{0.641571581f, 0.876181543f},
-std::array<float,2>{0.106113926f, 0.83113569f},
-std::array<float,2>{0.502196968f, 0.196882918f},
-std::array<float,2>{0.450428337f, 0.364103317f},
-std::array<float,2>{0.959082067f, 0.658295453f},
-std::array<float,2>{0.0118217217f, 0.695988953f},
-std::array<float,2>{0.592439175f, 0.256836563f},
-std::array<float,2>{0.379880577f, 0.159988403f},
-std::array<float,2>{0.920107543f, 0.758583188f},
-std::array<float,2>{0.360282481f, 0.94357872f},
-std::array<float,2>{0.856068432f, 0.117629595f},
-std::array<float,2>{0.156310827f, 0.418778598f},
-std::array<float,2>{0.688145936f, 0.590664625f},
-std::array<float,2>{0.444751561f, 0.528558373f},
-std::array<float,2>{0.96150136f, 0.495878398f},
-std::array<float,2>{0.0982731655f, 0.054853335f},
-std::array<float,2>{0.50896889f, 0.920366108f},
-std::array<float,2>{0.192283988f, 0.847792208f},
-std::array<float,2>{0.650059462f, 0.230999053f},
-std::array<float,2>{0.252503633f, 0.327153236f},
-std::array<float,2>{0.805007577f, 0.631735206f},
-std::array<float,2>{0.154071942f, 0.624981761f},
-std::array<float,2>{0.72758466f, 0.39540112f},
-std::array<float,2>{0.326735735f, 0.0685797036f},
-std::array<float,2>{0.829694211f, 0.992980599f},
-std::array<float,2>{0.408120424f, 0.788712323f},
-std::array<float,2>{0.87532419f, 0.145496234f},
-std::array<float,2>{0.0463643111f, 0.287032515f},
-std::array<float,2>{0.610125959f, 0.72475332f},
-std::array<float,2>{0.283866137f, 0.670042932f},
-std::array<float,2>{0.753332436f, 0.371525705f},
-std::array<float,2>{0.243827298f, 0.194710121f},
-std::array<float,2>{0.664027035f, 0.842060268f},
-std::array<float,2>{0.0667613074f, 0.884183466f},
-std::array<float,2>{0.554210246f, 0.0103406543f},
-std::array<float,2>{0.469216913f, 0.43817839f},
-std::array<float,2>{0.994323432f, 0.547195256f},
-std::array<float,2>{0.110745214f, 0.54215008f},
-std::array<float,2>{0.530661941f, 0.458315879f},
-std::array<float,2>{0.459348232f, 0.0202456787f},
-std::array<float,2>{0.94314009f, 0.896575153f},
-std::array<float,2>{0.280882895f, 0.814226508f},
-std::array<float,2>{0.782751739f, 0.204837769f},
-std::array<float,2>{0.206713617f, 0.345272958f},
-std::array<float,2>{0.636734724f, 0.675691128f},
-std::array<float,2>{0.395745009f, 0.742559075f},
-std::array<float,2>{0.92447418f, 0.305271119f},
-std::array<float,2>{0.0178591963f, 0.132179335f},
-std::array<float,2>{0.568224072f, 0.806562185f},
-std::array<float,2>{0.17252475f, 0.970205843f},
-std::array<float,2>{0.712774515f, 0.0799434409f},
-std::array<float,2>{0.347396731f, 0.38122043f},
-std::array<float,2>{0.873495162f, 0.60760808f},
-std::array<float,2>{0.222210854f, 0.650547624f},
-std::array<float,2>{0.678144693f, 0.333194047f},
-std::array<float,2>{0.297501504f, 0.238253638f},
-std::array<float,2>{0.772045493f, 0.872929215f},
-std::array<float,2>{0.488648564f, 0.926190436f},
-std::array<float,2>{0.981694281f, 0.0378528386f},
-std::array<float,2>{0.0896223485f, 0.475141734f},
-std::array<float,2>{0.539389849f, 0.500992835f},
-std::array<float,2>{0.340866596f, 0.563196778f},
-std::array<float,2>{0.821364164f, 0.429806143f},
-std::array<float,2>{0.137005076f, 0.105038173f},
-std::array<float,2>{0.738103569f, 0.955191255f},
-std::array<float,2>{0.0527842119f, 0.769753039f},
-std::array<float,2>{0.598330319f, 0.184742406f},
-std::array<float,2>{0.431116313f, 0.279123276f},
-std::array<float,2>{0.903552115f, 0.705723822f},
-std::array<float,2>{0.0650295019f, 0.714581251f},
-std::array<float,2>{0.549568653f, 0.266767144f},
-std::array<float,2>{0.475432098f, 0.178390697f},
-std::array<float,2>{0.999437928f, 0.778844118f},
-std::array<float,2>{0.288389146f, 0.96309036f},
-std::array<float,2>{0.757424653f, 0.099311322f},
-std::array<float,2>{0.249433085f, 0.422999114f},
-std::array<float,2>{0.658835351f, 0.57571435f},
-std::array<float,2>{0.413970977f, 0.513381004f},
-std::array<float,2>{0.882660687f, 0.480362505f},
-std::array<float,2>{0.0398428179f, 0.0393636152f},
-std::array<float,2>{0.613924444f, 0.934037328f},
-std::array<float,2>{0.151916057f, 0.864032805f},
-std::array<float,2>{0.731625617f, 0.245674208f},
-std::array<float,2>{0.322488815f, 0.339280695f},
-std::array<float,2>{0.835768521f, 0.64320147f},
-std::array<float,2>{0.190758198f, 0.596638799f},
-std::array<float,2>{0.655543387f, 0.386395812f},
-std::array<float,2>{0.254851848f, 0.0930411369f},
-std::array<float,2>{0.812042952f, 0.978798091f},
-std::array<float,2>{0.437845588f, 0.800406158f},
-std::array<float,2>{0.967154026f, 0.135039777f},
-std::array<float,2>{0.0947143734f, 0.29920426f},
-std::array<float,2>{0.512288868f, 0.738530874f},
-std::array<float,2>{0.366588116f, 0.686033428f},
-std::array<float,2>{0.854019701f, 0.354632169f},
-std::array<float,2>{0.164024621f, 0.21453917f},
-std::array<float,2>{0.693731427f, 0.821162939f},
-std::array<float,2>{0.0114081334f, 0.898988545f},
-std::array<float,2>{0.587495446f, 0.0253747217f},
-std::array<float,2>{0.378703296f, 0.465056956f},
-std::array<float,2>{0.914710701f, 0.535153151f},
-std::array<float,2>{0.0477457717f, 0.556541562f},
-std::array<float,2>{0.594377816f, 0.44978857f},
-std::array<float,2>{0.434742928f, 0.00598440459f},
-std::array<float,2>{0.899274647f, 0.882774293f},
-std::array<float,2>{0.338447928f, 0.832348645f},
-std::array<float,2>{0.825880408f, 0.200570449f},
-std::array<float,2>{0.13357535f, 0.360132605f},
-std::array<float,2>{0.740085661f, 0.661733568f},
-std::array<float,2>{0.484498918f, 0.726813257f},
-std::array<float,2>{0.978247941f, 0.295854181f},
-std::array<float,2>{0.0909490511f, 0.151016429f},
-std::array<float,2>{0.545700848f, 0.790074646f},
-std::array<float,2>{0.223525867f, 0.985685527f},
-std::array<float,2>{0.672101796f, 0.0714774579f},
-std::array<float,2>{0.303207338f, 0.405800402f},
-std::array<float,2>{0.769342005f, 0.614539504f},
-std::array<float,2>{0.178382352f, 0.634902894f},
-std::array<float,2>{0.71735394f, 0.316364825f},
-std::array<float,2>{0.348799467f, 0.226463974f},
-std::array<float,2>{0.868590057f, 0.85233289f},
-std::array<float,2>{0.392678261f, 0.908341527f},
-std::array<float,2>{0.926321387f, 0.050103765f},
-std::array<float,2>{0.0196103211f, 0.490108639f},
-std::array<float,2>{0.56422931f, 0.516537905f},
-std::array<float,2>{0.27409479f, 0.584593713f},
-std::array<float,2>{0.786271214f, 0.40821442f},
-std::array<float,2>{0.207037121f, 0.116887003f},
-std::array<float,2>{0.634345055f, 0.945924878f},
-std::array<float,2>{0.11631798f, 0.756559491f},
-std::array<float,2>{0.524558425f, 0.168334186f},
-std::array<float,2>{0.456052601f, 0.26443693f},
-std::array<float,2>{0.940745294f, 0.689159751f},
-std::array<float,2>{0.0277531371f, 0.666813731f},
-std::array<float,2>{0.575453341f, 0.368004143f},
-std::array<float,2>{0.404135317f, 0.188931376f},
-std::array<float,2>{0.93122232f, 0.837216914f},
-std::array<float,2>{0.358870924f, 0.887958229f},
-std::array<float,2>{0.859729469f, 0.0148257175f},
-std::array<float,2>{0.179938242f, 0.442890465f},
-std::array<float,2>{0.704372346f, 0.551029742f},
-std::array<float,2>{0.466828257f, 0.617579103f},
-std::array<float,2>{0.947099447f, 0.392196536f},
-std::array<float,2>{0.118511982f, 0.0655419305f},
-std::array<float,2>{0.5194965f, 0.997820854f},
-std::array<float,2>{0.217232406f, 0.783481658f},
-std::array<float,2>{0.629510581f, 0.140755311f},
-std::array<float,2>{0.271288872f, 0.281453073f},
-std::array<float,2>{0.790521324f, 0.718845546f},
-std::array<float,2>{0.129095748f, 0.524867356f},
-std::array<float,2>{0.747721851f, 0.498188615f},
-std::array<float,2>{0.331291169f, 0.0587797984f},
-std::array<float,2>{0.819539964f, 0.917840898f},
-std::array<float,2>{0.426652789f, 0.847004354f},
-std::array<float,2>{0.892305791f, 0.229647353f},
-std::array<float,2>{0.0572323836f, 0.321694613f},
-std::array<float,2>{0.60904938f, 0.627140701f},
-std::array<float,2>{0.308422238f, 0.70171088f},
-std::array<float,2>{0.78074646f, 0.251794636f},
-std::array<float,2>{0.228377923f, 0.160892829f},
-std::array<float,2>{0.685762525f, 0.763109565f},
-std::array<float,2>{0.0792571306f, 0.938495934f},
-std::array<float,2>{0.536131799f, 0.122489125f},
-std::array<float,2>{0.49595055f, 0.416547418f},
-std::array<float,2>{0.97289598f, 0.588586748f},
-std::array<float,2>{0.103451818f, 0.567414343f},
-std::array<float,2>{0.50743866f, 0.437030137f},
-std::array<float,2>{0.448807836f, 0.105839781f},
-std::array<float,2>{0.956885874f, 0.960778296f},
-std::array<float,2>{0.263754815f, 0.765695035f},
-std::array<float,2>{0.802385747f, 0.179946572f},
-std::array<float,2>{0.201354325f, 0.274357587f},
-std::array<float,2>{0.648159623f, 0.709824264f},
-std::array<float,2>{0.387402356f, 0.653743088f},
-std::array<float,2>{0.912020266f, 0.330152631f},
-std::array<float,2>{0.00703399116f, 0.239527106f},
-std::array<float,2>{0.585504591f, 0.867345333f},
-std::array<float,2>{0.168754786f, 0.925684154f},
-std::array<float,2>{0.700821936f, 0.0344615243f},
-std::array<float,2>{0.369858116f, 0.472598404f},
-std::array<float,2>{0.84478426f, 0.504189372f},
-std::array<float,2>{0.237061277f, 0.749771118f},
-std::array<float,2>{0.66739434f, 0.309129775f},
-std::array<float,2>{0.291910201f, 0.128044114f},
-std::array<float,2>{0.762940526f, 0.809316039f},
-std::array<float,2>{0.482137412f, 0.974664152f},
-std::array<float,2>{0.991902888f, 0.0825710967f},
-std::array<float,2>{0.0763254687f, 0.378869653f},
-std::array<float,2>{0.559641182f, 0.604400873f},
-std::array<float,2>{0.315099359f, 0.546214104f},
-std::array<float,2>{0.839970291f, 0.455368608f},
-std::array<float,2>{0.148354396f, 0.0161974337f},
-std::array<float,2>{0.725784957f, 0.893046439f},
-std::array<float,2>{0.0384819135f, 0.818763673f},
-std::array<float,2>{0.620925903f, 0.209430978f},
-std::array<float,2>{0.414895564f, 0.350009918f},
-std::array<float,2>{0.885531962f, 0.679652095f},
-std::array<float,2>{0.121957876f, 0.647317529f},
-std::array<float,2>{0.523314893f, 0.340401471f},
-std::array<float,2>{0.46267578f, 0.249836758f},
-std::array<float,2>{0.949622929f, 0.863048375f},
-std::array<float,2>{0.268841445f, 0.930935085f},
-std::array<float,2>{0.795007825f, 0.0453942455f},
-std::array<float,2>{0.211662799f, 0.48272863f},
-std::array<float,2>{0.625408113f, 0.509156048f},
-std::array<float,2>{0.400206476f, 0.570529103f},
-std::array<float,2>{0.936810434f, 0.429014653f},
-std::array<float,2>{0.0254815388f, 0.09376394f},
-std::array<float,2>{0.570853055f, 0.965147614f},
-std::array<float,2>{0.183859065f, 0.775260448f},
-std::array<float,2>{0.707546532f, 0.173549995f},
-std::array<float,2>{0.353132814f, 0.272545099f},
-std::array<float,2>{0.864441156f, 0.716756642f},
-std::array<float,2>{0.233854026f, 0.53703934f},
-std::array<float,2>{0.682016969f, 0.461564809f},
-std::array<float,2>{0.311747134f, 0.0305413082f},
-std::array<float,2>{0.774238288f, 0.904112399f},
-std::array<float,2>{0.496906251f, 0.825033188f},
-std::array<float,2>{0.969388366f, 0.216392562f},
-std::array<float,2>{0.0842366293f, 0.357145458f},
-std::array<float,2>{0.533491611f, 0.681531072f},
-std::array<float,2>{0.333669841f, 0.737245917f},
-std::array<float,2>{0.815407872f, 0.301640451f},
-std::array<float,2>{0.127890095f, 0.136979654f},
-std::array<float,2>{0.745787561f, 0.801627815f},
-std::array<float,2>{0.0621290505f, 0.981849968f},
-std::array<float,2>{0.604799211f, 0.0877757519f},
-std::array<float,2>{0.425760984f, 0.38810268f},
-std::array<float,2>{0.897829056f, 0.597667515f},
-std::array<float,2>{0.00141677074f, 0.611649394f},
-std::array<float,2>{0.579353452f, 0.400820196f},
-std::array<float,2>{0.386066556f, 0.0767263621f},
-std::array<float,2>{0.90805167f, 0.989970803f},
-std::array<float,2>{0.374445021f, 0.796370327f},
-std::array<float,2>{0.851375997f, 0.152597576f},
-std::array<float,2>{0.164888263f, 0.292208552f},
-std::array<float,2>{0.696564198f, 0.731241763f},
-std::array<float,2>{0.452530652f, 0.656500697f},
-std::array<float,2>{0.957753479f, 0.36613965f},
-std::array<float,2>{0.107707076f, 0.197522625f},
-std::array<float,2>{0.500389338f, 0.828865349f},
-std::array<float,2>{0.195850596f, 0.87866056f},
-std::array<float,2>{0.644530952f, 0.0013475368f},
-std::array<float,2>{0.261193991f, 0.448485017f},
-std::array<float,2>{0.798456013f, 0.562231719f},
-std::array<float,2>{0.142378092f, 0.694493532f},
-std::array<float,2>{0.719974577f, 0.260293424f},
-std::array<float,2>{0.316451788f, 0.165939316f},
-std::array<float,2>{0.838138759f, 0.750229836f},
-std::array<float,2>{0.419551104f, 0.950822353f},
-std::array<float,2>{0.889738858f, 0.110188417f},
-std::array<float,2>{0.0334041268f, 0.411701262f},
-std::array<float,2>{0.621741474f, 0.578160405f},
-std::array<float,2>{0.296188295f, 0.521552861f},
-std::array<float,2>{0.759741962f, 0.485973269f},
-std::array<float,2>{0.241386846f, 0.052806627f},
-std::array<float,2>{0.669434726f, 0.910535157f},
-std::array<float,2>{0.0703487247f, 0.855822682f},
-std::array<float,2>{0.557276011f, 0.220475301f},
-std::array<float,2>{0.48034206f, 0.316870421f},
-std::array<float,2>{0.987764955f, 0.638374031f},
-std::array<float,2>{0.0443511829f, 0.723187447f},
-std::array<float,2>{0.612353861f, 0.287162125f},
-std::array<float,2>{0.408224583f, 0.148265049f},
-std::array<float,2>{0.87823534f, 0.786681771f},
-std::array<float,2>{0.325939327f, 0.994897962f},
-std::array<float,2>{0.830842376f, 0.0682387277f},
-std::array<float,2>{0.154615507f, 0.398335159f},
-std::array<float,2>{0.730305791f, 0.62187022f},
-std::array<float,2>{0.472556621f, 0.548929155f},
-std::array<float,2>{0.993220687f, 0.440881461f},
-std::array<float,2>{0.0697783232f, 0.00872061029f},
-std::array<float,2>{0.551901579f, 0.885223031f},
-std::array<float,2>{0.244380295f, 0.840369284f},
-std::array<float,2>{0.661060989f, 0.192399114f},
-std::array<float,2>{0.283159345f, 0.374771148f},
-std::array<float,2>{0.750047326f, 0.669279456f},
-std::array<float,2>{0.15848498f, 0.593409419f},
-std::array<float,2>{0.690242231f, 0.420649409f},
-std::array<float,2>{0.361390263f, 0.12018767f},
-std::array<float,2>{0.857750833f, 0.942362726f},
-std::array<float,2>{0.382253289f, 0.760818422f},
-std::array<float,2>{0.919171989f, 0.158119708f},
-std::array<float,2>{0.0137888556f, 0.254629284f},
-std::array<float,2>{0.591725707f, 0.697530806f},
-std::array<float,2>{0.250880808f, 0.630526125f},
-std::array<float,2>{0.807680428f, 0.32490328f},
-std::array<float,2>{0.194633171f, 0.23262392f},
-std::array<float,2>{0.651845396f, 0.849796236f},
-std::array<float,2>{0.10082563f, 0.919893444f},
-std::array<float,2>{0.510187149f, 0.0576360561f},
-std::array<float,2>{0.442006618f, 0.492262781f},
-std::array<float,2>{0.963739455f, 0.529973507f},
-std::array<float,2>{0.0872379169f, 0.502884865f},
-std::array<float,2>{0.541864216f, 0.474484503f},
-std::array<float,2>{0.490373045f, 0.036983747f},
-std::array<float,2>{0.982702017f, 0.929297328f},
-std::array<float,2>{0.299824476f, 0.874707282f},
-std::array<float,2>{0.770476818f, 0.23458609f},
-std::array<float,2>{0.219959646f, 0.334470719f},
-std::array<float,2>{0.67757535f, 0.648944318f},
-std::array<float,2>{0.431743622f, 0.703809321f},
-std::array<float,2>{0.905920446f, 0.279345751f},
-std::array<float,2>{0.0517761707f, 0.186021119f},
-std::array<float,2>{0.600454032f, 0.771752536f},
-std::array<float,2>{0.139917135f, 0.953779876f},
-std::array<float,2>{0.73525393f, 0.102723517f},
-std::array<float,2>{0.34351179f, 0.43172434f},
-std::array<float,2>{0.822881639f, 0.564795017f},
-std::array<float,2>{0.203753307f, 0.671928287f},
-std::array<float,2>{0.640602887f, 0.345943302f},
-std::array<float,2>{0.279126078f, 0.205352515f},
-std::array<float,2>{0.784259915f, 0.815352678f},
-std::array<float,2>{0.45894289f, 0.89607358f},
-std::array<float,2>{0.943847716f, 0.0217563808f},
-std::array<float,2>{0.111774489f, 0.460774809f},
-std::array<float,2>{0.527345717f, 0.539342999f},
-std::array<float,2>{0.345649272f, 0.6055246f},
-std::array<float,2>{0.872034788f, 0.380603582f},
-std::array<float,2>{0.1752823f, 0.0803203955f},
-std::array<float,2>{0.713421941f, 0.972561002f},
-std::array<float,2>{0.0160792414f, 0.806876123f},
-std::array<float,2>{0.569995701f, 0.130192161f},
-std::array<float,2>{0.39774859f, 0.307726175f},
-std::array<float,2>{0.923613489f, 0.744306624f},
-std::array<float,2>{0.0771224424f, 0.746842563f},
-std::array<float,2>{0.560401976f, 0.310892552f},
-std::array<float,2>{0.481754333f, 0.125122353f},
-std::array<float,2>{0.991622806f, 0.811337352f},
-std::array<float,2>{0.291190207f, 0.973633587f},
-std::array<float,2>{0.763655603f, 0.0848763362f},
-std::array<float,2>{0.236585781f, 0.376034945f},
-std::array<float,2>{0.667755306f, 0.602983594f},
-std::array<float,2>{0.414097637f, 0.543616474f},
-std::array<float,2>{0.884827971f, 0.453756422f},
-std::array<float,2>{0.038905859f, 0.0192049798f},
-std::array<float,2>{0.620466828f, 0.892208755f},
-std::array<float,2>{0.147616908f, 0.817195117f},
-std::array<float,2>{0.726208746f, 0.208638906f},
-std::array<float,2>{0.314502299f, 0.348709852f},
-std::array<float,2>{0.840656221f, 0.677301347f},
-std::array<float,2>{0.201809034f, 0.568454027f},
-std::array<float,2>{0.647746086f, 0.434527218f},
-std::array<float,2>{0.264204264f, 0.107980534f},
-std::array<float,2>{0.801929533f, 0.958763182f},
-std::array<float,2>{0.448430926f, 0.769099474f},
-std::array<float,2>{0.956538618f, 0.18321985f},
-std::array<float,2>{0.102659121f, 0.27587828f},
-std::array<float,2>{0.507132351f, 0.70715642f},
-std::array<float,2>{0.369482487f, 0.654767513f},
-std::array<float,2>{0.845560551f, 0.330019534f},
-std::array<float,2>{0.168274507f, 0.241857827f},
-std::array<float,2>{0.700522542f, 0.869504511f},
-std::array<float,2>{0.00777130062f, 0.92334199f},
-std::array<float,2>{0.585430741f, 0.0318937376f},
-std::array<float,2>{0.38686499f, 0.47003296f},
-std::array<float,2>{0.911461234f, 0.506906867f},
-std::array<float,2>{0.0571250468f, 0.526975393f},
-std::array<float,2>{0.60888505f, 0.497260988f},
-std::array<float,2>{0.426027745f, 0.0611279495f},
-std::array<float,2>{0.891847789f, 0.9155913f},
-std::array<float,2>{0.331912756f, 0.845099568f},
-std::array<float,2>{0.820210934f, 0.227552429f},
-std::array<float,2>{0.129481763f, 0.323107988f},
-std::array<float,2>{0.747251332f, 0.625010908f},
-std::array<float,2>{0.495430171f, 0.699605763f},
-std::array<float,2>{0.973223805f, 0.252424687f},
-std::array<float,2>{0.0800597966f, 0.162356809f},
-std::array<float,2>{0.53523314f, 0.764317036f},
-std::array<float,2>{0.22794129f, 0.939739585f},
-std::array<float,2>{0.686520398f, 0.12430343f},
-std::array<float,2>{0.307928562f, 0.415429562f},
-std::array<float,2>{0.781088114f, 0.587220311f},
-std::array<float,2>{0.180298239f, 0.665624142f},
-std::array<float,2>{0.704806864f, 0.370753795f},
-std::array<float,2>{0.359291017f, 0.190806955f},
-std::array<float,2>{0.860235631f, 0.838875651f},
-std::array<float,2>{0.403413743f, 0.889739633f},
-std::array<float,2>{0.930966794f, 0.0126416609f},
-std::array<float,2>{0.0281579159f, 0.443983018f},
-std::array<float,2>{0.576165736f, 0.553560972f},
-std::array<float,2>{0.270764858f, 0.619266272f},
-std::array<float,2>{0.790849566f, 0.393893421f},
-std::array<float,2>{0.217322409f, 0.0640389174f},
-std::array<float,2>{0.629185796f, 0.998309195f},
-std::array<float,2>{0.119132027f, 0.782246888f},
-std::array<float,2>{0.518911302f, 0.142910421f},
-std::array<float,2>{0.467423677f, 0.283995569f},
-std::array<float,2>{0.946489811f, 0.721446693f},
-std::array<float,2>{0.0203518197f, 0.634556353f},
-std::array<float,2>{0.563814938f, 0.313087583f},
-std::array<float,2>{0.393223077f, 0.223797143f},
-std::array<float,2>{0.925911903f, 0.855301857f},
-std::array<float,2>{0.349403799f, 0.906878829f},
-std::array<float,2>{0.868842423f, 0.0482184738f},
-std::array<float,2>{0.178206265f, 0.49065122f},
-std::array<float,2>{0.716960609f, 0.518003285f},
-std::array<float,2>{0.455270171f, 0.582862377f},
-std::array<float,2>{0.94140172f, 0.407719582f},
-std::array<float,2>{0.116881132f, 0.115101859f},
-std::array<float,2>{0.524960458f, 0.947674453f},
-std::array<float,2>{0.20799017f, 0.754823387f},
-std::array<float,2>{0.633842409f, 0.170696452f},
-std::array<float,2>{0.273563445f, 0.262725919f},
-std::array<float,2>{0.787002683f, 0.689863443f},
-std::array<float,2>{0.132824317f, 0.558015108f},
-std::array<float,2>{0.739267766f, 0.452019423f},
-std::array<float,2>{0.338290602f, 0.0046857358f},
-std::array<float,2>{0.825401187f, 0.880195618f},
-std::array<float,2>{0.435397714f, 0.835713744f},
-std::array<float,2>{0.898506403f, 0.20228149f},
-std::array<float,2>{0.0471171588f, 0.362941265f},
-std::array<float,2>{0.594214439f, 0.662503779f},
-std::array<float,2>{0.303377002f, 0.728667617f},
-std::array<float,2>{0.76881063f, 0.294842511f},
-std::array<float,2>{0.222711787f, 0.15030545f},
-std::array<float,2>{0.672487974f, 0.791983783f},
-std::array<float,2>{0.0913857147f, 0.987954676f},
-std::array<float,2>{0.545345426f, 0.0733599067f},
-std::array<float,2>{0.48498866f, 0.403090328f},
-std::array<float,2>{0.977571785f, 0.615294099f},
-std::array<float,2>{0.0941664577f, 0.595571041f},
-std::array<float,2>{0.512105882f, 0.383731633f},
-std::array<float,2>{0.438398331f, 0.0917877331f},
-std::array<float,2>{0.967722714f, 0.977127135f},
-std::array<float,2>{0.254274905f, 0.797040939f},
-std::array<float,2>{0.811659098f, 0.133095413f},
-std::array<float,2>{0.191297486f, 0.298681706f},
-std::array<float,2>{0.655776918f, 0.742158771f},
-std::array<float,2>{0.378310859f, 0.684457779f},
-std::array<float,2>{0.914343953f, 0.351901859f},
-std::array<float,2>{0.010960917f, 0.212834626f},
-std::array<float,2>{0.587257802f, 0.823960781f},
-std::array<float,2>{0.163484126f, 0.902233839f},
-std::array<float,2>{0.694044828f, 0.0255246367f},
-std::array<float,2>{0.366933763f, 0.468502164f},
-std::array<float,2>{0.85359323f, 0.532176256f},
-std::array<float,2>{0.249562949f, 0.71142596f},
-std::array<float,2>{0.658579648f, 0.268566817f},
-std::array<float,2>{0.288800716f, 0.176716387f},
-std::array<float,2>{0.756891608f, 0.780215859f},
-std::array<float,2>{0.475042701f, 0.961992383f},
-std::array<float,2>{0.999602854f, 0.10123162f},
-std::array<float,2>{0.0649199635f, 0.424520671f},
-std::array<float,2>{0.549201727f, 0.577875793f},
-std::array<float,2>{0.322874874f, 0.514344156f},
-std::array<float,2>{0.835038841f, 0.477187574f},
-std::array<float,2>{0.151818573f, 0.0413387418f},
-std::array<float,2>{0.732217848f, 0.93716532f},
-std::array<float,2>{0.0391249768f, 0.866096199f},
-std::array<float,2>{0.613397837f, 0.244068295f},
-std::array<float,2>{0.413252026f, 0.337675333f},
-std::array<float,2>{0.882019758f, 0.642100096f},
-std::array<float,2>{0.112236619f, 0.675248325f},
-std::array<float,2>{0.528211117f, 0.345074326f},
-std::array<float,2>{0.458201528f, 0.204325452f},
-std::array<float,2>{0.943457425f, 0.813927174f},
-std::array<float,2>{0.278673738f, 0.89702934f},
-std::array<float,2>{0.785111487f, 0.0199920051f},
-std::array<float,2>{0.203315139f, 0.458704382f},
-std::array<float,2>{0.639961064f, 0.542604923f},
-std::array<float,2>{0.39837876f, 0.6082955f},
-std::array<float,2>{0.923054576f, 0.381741077f},
-std::array<float,2>{0.0162911676f, 0.0795684755f},
-std::array<float,2>{0.569813669f, 0.970358491f},
-std::array<float,2>{0.175320551f, 0.805764735f},
-std::array<float,2>{0.713155627f, 0.132579669f},
-std::array<float,2>{0.344804049f, 0.304984808f},
-std::array<float,2>{0.871553242f, 0.743074656f},
-std::array<float,2>{0.220670432f, 0.501579762f},
-std::array<float,2>{0.676847041f, 0.474669009f},
-std::array<float,2>{0.300342143f, 0.0374034159f},
-std::array<float,2>{0.769826055f, 0.926322341f},
-std::array<float,2>{0.491128564f, 0.872488916f},
-std::array<float,2>{0.9832142f, 0.237471879f},
-std::array<float,2>{0.0874854401f, 0.333667397f},
-std::array<float,2>{0.541158259f, 0.650939941f},
-std::array<float,2>{0.342844874f, 0.705206692f},
-std::array<float,2>{0.822602034f, 0.278699517f},
-std::array<float,2>{0.140553504f, 0.185504347f},
-std::array<float,2>{0.734738767f, 0.770421624f},
-std::array<float,2>{0.0522739477f, 0.955770373f},
-std::array<float,2>{0.600086689f, 0.104926229f},
-std::array<float,2>{0.432342857f, 0.430449843f},
-std::array<float,2>{0.905635953f, 0.562868655f},
-std::array<float,2>{0.0144198611f, 0.590051353f},
-std::array<float,2>{0.590844989f, 0.41824168f},
-std::array<float,2>{0.382541835f, 0.117831491f},
-std::array<float,2>{0.919586539f, 0.943921506f},
-std::array<float,2>{0.362237066f, 0.758255661f},
-std::array<float,2>{0.858172715f, 0.159589395f},
-std::array<float,2>{0.158895671f, 0.257390618f},
-std::array<float,2>{0.689858794f, 0.695497215f},
-std::array<float,2>{0.441692382f, 0.631265998f},
-std::array<float,2>{0.963176966f, 0.32810846f},
-std::array<float,2>{0.101227611f, 0.230851039f},
-std::array<float,2>{0.510544896f, 0.84857887f},
-std::array<float,2>{0.195142224f, 0.920607567f},
-std::array<float,2>{0.652043343f, 0.0553296655f},
-std::array<float,2>{0.250134319f, 0.495198071f},
-std::array<float,2>{0.808569491f, 0.529196739f},
-std::array<float,2>{0.154908076f, 0.725478768f},
-std::array<float,2>{0.729688942f, 0.286185235f},
-std::array<float,2>{0.325646013f, 0.144641399f},
-std::array<float,2>{0.830444694f, 0.788512647f},
-std::array<float,2>{0.408906162f, 0.992404997f},
-std::array<float,2>{0.878792942f, 0.0688910261f},
-std::array<float,2>{0.0447265059f, 0.394958645f},
-std::array<float,2>{0.613024533f, 0.624220848f},
-std::array<float,2>{0.282243222f, 0.547440529f},
-std::array<float,2>{0.750693977f, 0.437779635f},
-std::array<float,2>{0.244868234f, 0.00990313105f},
-std::array<float,2>{0.660560906f, 0.884329557f},
-std::array<float,2>{0.0702536181f, 0.842666268f},
-std::array<float,2>{0.552543581f, 0.195093915f},
-std::array<float,2>{0.471989334f, 0.372017652f},
-std::array<float,2>{0.993848205f, 0.670448959f},
-std::array<float,2>{0.0341332778f, 0.691926599f},
-std::array<float,2>{0.621154428f, 0.257886082f},
-std::array<float,2>{0.419161201f, 0.166202828f},
-std::array<float,2>{0.890345037f, 0.752709806f},
-std::array<float,2>{0.317005008f, 0.951480329f},
-std::array<float,2>{0.838650107f, 0.111920774f},
-std::array<float,2>{0.141989514f, 0.412695706f},
-std::array<float,2>{0.720374107f, 0.581371069f},
-std::array<float,2>{0.47982356f, 0.521096468f},
-std::array<float,2>{0.987955153f, 0.486664027f},
-std::array<float,2>{0.0708897784f, 0.0518551879f},
-std::array<float,2>{0.556902766f, 0.912901223f},
-std::array<float,2>{0.241952226f, 0.858644962f},
-std::array<float,2>{0.669412434f, 0.221347973f},
-std::array<float,2>{0.296491921f, 0.319798768f},
-std::array<float,2>{0.758838296f, 0.639183223f},
-std::array<float,2>{0.164407805f, 0.611249208f},
-std::array<float,2>{0.697056651f, 0.399004191f},
-std::array<float,2>{0.374961495f, 0.0745891631f},
-std::array<float,2>{0.850926518f, 0.992093265f},
-std::array<float,2>{0.386717469f, 0.793975651f},
-std::array<float,2>{0.907511175f, 0.155101627f},
-std::array<float,2>{0.00186047808f, 0.290917516f},
-std::array<float,2>{0.579657197f, 0.733421266f},
-std::array<float,2>{0.26132971f, 0.658863127f},
-std::array<float,2>{0.798133135f, 0.363606602f},
-std::array<float,2>{0.195593342f, 0.196518451f},
-std::array<float,2>{0.643872678f, 0.831949115f},
-std::array<float,2>{0.108329341f, 0.876844525f},
-std::array<float,2>{0.500608683f, 0.00274301646f},
-std::array<float,2>{0.453114897f, 0.445347607f},
-std::array<float,2>{0.957419813f, 0.56028682f},
-std::array<float,2>{0.0846064985f, 0.53771323f},
-std::array<float,2>{0.53393209f, 0.463755697f},
-std::array<float,2>{0.496319622f, 0.0279558264f},
-std::array<float,2>{0.969213545f, 0.906177163f},
-std::array<float,2>{0.312264293f, 0.826423645f},
-std::array<float,2>{0.773849308f, 0.217019737f},
-std::array<float,2>{0.233986169f, 0.35807091f},
-std::array<float,2>{0.682263136f, 0.681980491f},
-std::array<float,2>{0.424965233f, 0.734757543f},
-std::array<float,2>{0.898358583f, 0.302807719f},
-std::array<float,2>{0.061641816f, 0.140112683f},
-std::array<float,2>{0.605239689f, 0.804286957f},
-std::array<float,2>{0.126982063f, 0.982966721f},
-std::array<float,2>{0.745264113f, 0.0882036984f},
-std::array<float,2>{0.33326304f, 0.390409589f},
-std::array<float,2>{0.814871609f, 0.601316571f},
-std::array<float,2>{0.21120587f, 0.645508111f},
-std::array<float,2>{0.625708818f, 0.343226463f},
-std::array<float,2>{0.269247025f, 0.246751845f},
-std::array<float,2>{0.795790493f, 0.859854996f},
-std::array<float,2>{0.462094009f, 0.931833923f},
-std::array<float,2>{0.95011884f, 0.0438715704f},
-std::array<float,2>{0.121294908f, 0.481496513f},
-std::array<float,2>{0.522644877f, 0.510357201f},
-std::array<float,2>{0.35295409f, 0.573065519f},
-std::array<float,2>{0.865130842f, 0.426302433f},
-std::array<float,2>{0.184389547f, 0.0964238197f},
-std::array<float,2>{0.707426012f, 0.968298078f},
-std::array<float,2>{0.0262806918f, 0.775922716f},
-std::array<float,2>{0.570522487f, 0.175779566f},
-std::array<float,2>{0.399601042f, 0.271247745f},
-std::array<float,2>{0.937218189f, 0.717660189f},
-std::array<float,2>{0.103518464f, 0.709268451f},
-std::array<float,2>{0.505188584f, 0.27359882f},
-std::array<float,2>{0.447059274f, 0.180181846f},
-std::array<float,2>{0.954424381f, 0.766253054f},
-std::array<float,2>{0.263044268f, 0.960119545f},
-std::array<float,2>{0.804200649f, 0.106216997f},
-std::array<float,2>{0.200612411f, 0.436602175f},
-std::array<float,2>{0.645179689f, 0.568154275f},
-std::array<float,2>{0.388834864f, 0.50472945f},
-std::array<float,2>{0.913637519f, 0.47209537f},
-std::array<float,2>{0.00398017699f, 0.0349591412f},
-std::array<float,2>{0.582074523f, 0.925027072f},
-std::array<float,2>{0.170511752f, 0.867832541f},
-std::array<float,2>{0.702947438f, 0.239898756f},
-std::array<float,2>{0.368204147f, 0.330628246f},
-std::array<float,2>{0.846002042f, 0.654294193f},
-std::array<float,2>{0.234385803f, 0.603733301f},
-std::array<float,2>{0.665309191f, 0.37814787f},
-std::array<float,2>{0.289416611f, 0.0823593661f},
-std::array<float,2>{0.765443623f, 0.975308836f},
-std::array<float,2>{0.482431918f, 0.808835745f},
-std::array<float,2>{0.989535093f, 0.12861599f},
-std::array<float,2>{0.0755809844f, 0.308701217f},
-std::array<float,2>{0.560732305f, 0.749456704f},
-std::array<float,2>{0.313993096f, 0.678816974f},
-std::array<float,2>{0.84318161f, 0.350496411f},
-std::array<float,2>{0.146396533f, 0.209787354f},
-std::array<float,2>{0.722908258f, 0.818973601f},
-std::array<float,2>{0.036773432f, 0.893541634f},
-std::array<float,2>{0.618959963f, 0.0158940516f},
-std::array<float,2>{0.416095167f, 0.455655694f},
-std::array<float,2>{0.88473475f, 0.546705902f},
-std::array<float,2>{0.0301583931f, 0.551404059f},
-std::array<float,2>{0.576817214f, 0.442385405f},
-std::array<float,2>{0.405106843f, 0.0152782286f},
-std::array<float,2>{0.933433652f, 0.888415337f},
-std::array<float,2>{0.356370598f, 0.837420642f},
-std::array<float,2>{0.863123357f, 0.188981712f},
-std::array<float,2>{0.181724712f, 0.367647201f},
-std::array<float,2>{0.705843568f, 0.666021705f},
-std::array<float,2>{0.466400623f, 0.719393194f},
-std::array<float,2>{0.94783932f, 0.281835437f},
-std::array<float,2>{0.12055885f, 0.141578734f},
-std::array<float,2>{0.516476691f, 0.784036338f},
-std::array<float,2>{0.21554108f, 0.997313321f},
-std::array<float,2>{0.632200718f, 0.0660930946f},
-std::array<float,2>{0.273374766f, 0.391887546f},
-std::array<float,2>{0.792481244f, 0.617710292f},
-std::array<float,2>{0.131232649f, 0.627452731f},
-std::array<float,2>{0.748640418f, 0.321951658f},
-std::array<float,2>{0.329870492f, 0.230003968f},
-std::array<float,2>{0.816779494f, 0.847602308f},
-std::array<float,2>{0.427846998f, 0.91739285f},
-std::array<float,2>{0.893574357f, 0.0595342256f},
-std::array<float,2>{0.0564366207f, 0.498785496f},
-std::array<float,2>{0.606807172f, 0.525367022f},
-std::array<float,2>{0.305922061f, 0.588264465f},
-std::array<float,2>{0.777614176f, 0.416284591f},
-std::array<float,2>{0.229620486f, 0.122833081f},
-std::array<float,2>{0.684284091f, 0.939377546f},
-std::array<float,2>{0.0800967962f, 0.763380766f},
-std::array<float,2>{0.537555516f, 0.160397172f},
-std::array<float,2>{0.492662936f, 0.251226455f},
-std::array<float,2>{0.976498306f, 0.701209784f},
-std::array<float,2>{0.049841091f, 0.66154778f},
-std::array<float,2>{0.596595168f, 0.359499425f},
-std::array<float,2>{0.437035501f, 0.200807318f},
-std::array<float,2>{0.902044237f, 0.832542479f},
-std::array<float,2>{0.336590648f, 0.882215619f},
-std::array<float,2>{0.826634645f, 0.0064231148f},
-std::array<float,2>{0.136407122f, 0.449521929f},
-std::array<float,2>{0.740447104f, 0.555882573f},
-std::array<float,2>{0.486500055f, 0.615196884f},
-std::array<float,2>{0.980455875f, 0.405714929f},
-std::array<float,2>{0.0931905136f, 0.0719649419f},
-std::array<float,2>{0.543947935f, 0.985934377f},
-std::array<float,2>{0.226305082f, 0.790588319f},
-std::array<float,2>{0.675289392f, 0.15071322f},
-std::array<float,2>{0.302102059f, 0.295277655f},
-std::array<float,2>{0.766885579f, 0.727532625f},
-std::array<float,2>{0.177679941f, 0.515850961f},
-std::array<float,2>{0.716748118f, 0.489717364f},
-std::array<float,2>{0.349678308f, 0.050424207f},
-std::array<float,2>{0.869912863f, 0.908987701f},
-std::array<float,2>{0.392126173f, 0.85174197f},
-std::array<float,2>{0.928324938f, 0.225871116f},
-std::array<float,2>{0.0229505841f, 0.315665543f},
-std::array<float,2>{0.566298127f, 0.63570255f},
-std::array<float,2>{0.277073413f, 0.688632071f},
-std::array<float,2>{0.787512541f, 0.263868928f},
-std::array<float,2>{0.210184529f, 0.168864638f},
-std::array<float,2>{0.636569023f, 0.756195784f},
-std::array<float,2>{0.11402262f, 0.945509672f},
-std::array<float,2>{0.526843846f, 0.116510965f},
-std::array<float,2>{0.453551829f, 0.408762574f},
-std::array<float,2>{0.937506914f, 0.584337234f},
-std::array<float,2>{0.0634731799f, 0.575295031f},
-std::array<float,2>{0.548677444f, 0.423437715f},
-std::array<float,2>{0.472754091f, 0.0987635776f},
-std::array<float,2>{0.997286499f, 0.963471591f},
-std::array<float,2>{0.286525846f, 0.778406441f},
-std::array<float,2>{0.754664898f, 0.17813246f},
-std::array<float,2>{0.246323198f, 0.267490655f},
-std::array<float,2>{0.657054663f, 0.713947296f},
-std::array<float,2>{0.410901457f, 0.642603815f},
-std::array<float,2>{0.880584955f, 0.339503735f},
-std::array<float,2>{0.0423942246f, 0.245394036f},
-std::array<float,2>{0.617024302f, 0.863489807f},
-std::array<float,2>{0.14846763f, 0.934306681f},
-std::array<float,2>{0.733700514f, 0.0400002487f},
-std::array<float,2>{0.321278989f, 0.47988376f},
-std::array<float,2>{0.832389593f, 0.513000131f},
-std::array<float,2>{0.188718632f, 0.739078045f},
-std::array<float,2>{0.653453588f, 0.299553216f},
-std::array<float,2>{0.257541984f, 0.135557801f},
-std::array<float,2>{0.809992671f, 0.800174475f},
-std::array<float,2>{0.439707249f, 0.979316592f},
-std::array<float,2>{0.966514587f, 0.0933012143f},
-std::array<float,2>{0.0966289341f, 0.386128813f},
-std::array<float,2>{0.514317632f, 0.595773637f},
-std::array<float,2>{0.36333701f, 0.534475863f},
-std::array<float,2>{0.853208244f, 0.465532809f},
-std::array<float,2>{0.161729783f, 0.024482606f},
-std::array<float,2>{0.692984104f, 0.898698032f},
-std::array<float,2>{0.00964126643f, 0.820511341f},
-std::array<float,2>{0.588520646f, 0.214293748f},
-std::array<float,2>{0.376794487f, 0.355236053f},
-std::array<float,2>{0.916377962f, 0.686323285f},
-std::array<float,2>{0.0888980031f, 0.648464978f},
-std::array<float,2>{0.539746642f, 0.334777981f},
-std::array<float,2>{0.48878026f, 0.235010669f},
-std::array<float,2>{0.982283652f, 0.87413013f},
-std::array<float,2>{0.297216624f, 0.928957522f},
-std::array<float,2>{0.771600008f, 0.036535617f},
-std::array<float,2>{0.222030714f, 0.474015862f},
-std::array<float,2>{0.678709447f, 0.502102256f},
-std::array<float,2>{0.431334615f, 0.565135837f},
-std::array<float,2>{0.904291272f, 0.432425499f},
-std::array<float,2>{0.0534980036f, 0.10311868f},
-std::array<float,2>{0.598015606f, 0.953138888f},
-std::array<float,2>{0.137511045f, 0.772383869f},
-std::array<float,2>{0.737748981f, 0.186060652f},
-std::array<float,2>{0.341347694f, 0.279799253f},
-std::array<float,2>{0.82226187f, 0.70359385f},
-std::array<float,2>{0.206368208f, 0.539618194f},
-std::array<float,2>{0.637444556f, 0.459977031f},
-std::array<float,2>{0.280391961f, 0.0222277213f},
-std::array<float,2>{0.782601893f, 0.895642817f},
-std::array<float,2>{0.4598158f, 0.814808786f},
-std::array<float,2>{0.942543626f, 0.205806017f},
-std::array<float,2>{0.110907249f, 0.34633106f},
-std::array<float,2>{0.530802906f, 0.672568381f},
-std::array<float,2>{0.347142339f, 0.744747996f},
-std::array<float,2>{0.873544335f, 0.308184594f},
-std::array<float,2>{0.172285691f, 0.130642191f},
-std::array<float,2>{0.712349296f, 0.807296991f},
-std::array<float,2>{0.0184509624f, 0.971886158f},
-std::array<float,2>{0.567413867f, 0.0805934519f},
-std::array<float,2>{0.396150202f, 0.380008101f},
-std::array<float,2>{0.924016833f, 0.60633117f},
-std::array<float,2>{0.0466991626f, 0.621095061f},
-std::array<float,2>{0.609513521f, 0.397673875f},
-std::array<float,2>{0.407470733f, 0.0674787536f},
-std::array<float,2>{0.875765681f, 0.994533777f},
-std::array<float,2>{0.326504886f, 0.786328673f},
-std::array<float,2>{0.829565167f, 0.147535205f},
-std::array<float,2>{0.153484121f, 0.287677765f},
-std::array<float,2>{0.728307486f, 0.722784162f},
-std::array<float,2>{0.469560385f, 0.669509351f},
-std::array<float,2>{0.994894147f, 0.374145329f},
-std::array<float,2>{0.0673217848f, 0.193304986f},
-std::array<float,2>{0.553852379f, 0.8402192f},
-std::array<float,2>{0.243342951f, 0.885391653f},
-std::array<float,2>{0.663535476f, 0.00784188882f},
-std::array<float,2>{0.283502847f, 0.441140294f},
-std::array<float,2>{0.753450155f, 0.549544215f},
-std::array<float,2>{0.157202333f, 0.697973013f},
-std::array<float,2>{0.687949777f, 0.254351169f},
-std::array<float,2>{0.359408349f, 0.157265946f},
-std::array<float,2>{0.855818093f, 0.761525214f},
-std::array<float,2>{0.378906429f, 0.941712856f},
-std::array<float,2>{0.920764625f, 0.121027857f},
-std::array<float,2>{0.0124488603f, 0.419936061f},
-std::array<float,2>{0.591864049f, 0.593189776f},
-std::array<float,2>{0.25229916f, 0.529303253f},
-std::array<float,2>{0.805430651f, 0.49299258f},
-std::array<float,2>{0.19180195f, 0.0583746731f},
-std::array<float,2>{0.649682939f, 0.91927141f},
-std::array<float,2>{0.0979675651f, 0.850275874f},
-std::array<float,2>{0.5093503f, 0.233061746f},
-std::array<float,2>{0.445272446f, 0.324225813f},
-std::array<float,2>{0.961345851f, 0.630224645f},
-std::array<float,2>{0.00257182331f, 0.730840743f},
-std::array<float,2>{0.581502616f, 0.292640895f},
-std::array<float,2>{0.383442372f, 0.153164536f},
-std::array<float,2>{0.90931046f, 0.796392083f},
-std::array<float,2>{0.371817023f, 0.989461303f},
-std::array<float,2>{0.849042773f, 0.0762150139f},
-std::array<float,2>{0.166675881f, 0.401329637f},
-std::array<float,2>{0.697929323f, 0.612245917f},
-std::array<float,2>{0.450949758f, 0.561906576f},
-std::array<float,2>{0.959569395f, 0.448919445f},
-std::array<float,2>{0.105556749f, 0.0016910953f},
-std::array<float,2>{0.502472222f, 0.878096819f},
-std::array<float,2>{0.197799534f, 0.828432024f},
-std::array<float,2>{0.64095515f, 0.197811872f},
-std::array<float,2>{0.258948773f, 0.365514576f},
-std::array<float,2>{0.800590396f, 0.6571154f},
-std::array<float,2>{0.144441351f, 0.579059124f},
-std::array<float,2>{0.72198981f, 0.41140154f},
-std::array<float,2>{0.318868548f, 0.109380908f},
-std::array<float,2>{0.836649954f, 0.950404167f},
-std::array<float,2>{0.420800328f, 0.750951171f},
-std::array<float,2>{0.888003588f, 0.165039137f},
-std::array<float,2>{0.0325876623f, 0.259765953f},
-std::array<float,2>{0.623868942f, 0.695171595f},
-std::array<float,2>{0.294841409f, 0.637815058f},
-std::array<float,2>{0.759906411f, 0.316953421f},
-std::array<float,2>{0.240044013f, 0.220210776f},
-std::array<float,2>{0.671318829f, 0.856429935f},
-std::array<float,2>{0.0740859881f, 0.910875738f},
-std::array<float,2>{0.555979133f, 0.0533696264f},
-std::array<float,2>{0.477763981f, 0.485687107f},
-std::array<float,2>{0.986318469f, 0.522146702f},
-std::array<float,2>{0.123419203f, 0.509577513f},
-std::array<float,2>{0.521164894f, 0.483329028f},
-std::array<float,2>{0.464273244f, 0.0456488729f},
-std::array<float,2>{0.952608168f, 0.931434691f},
-std::array<float,2>{0.266861141f, 0.862537563f},
-std::array<float,2>{0.794008493f, 0.249070138f},
-std::array<float,2>{0.214345858f, 0.340257645f},
-std::array<float,2>{0.628832459f, 0.64654839f},
-std::array<float,2>{0.40160495f, 0.716005981f},
-std::array<float,2>{0.93449533f, 0.273053944f},
-std::array<float,2>{0.0234514587f, 0.173323944f},
-std::array<float,2>{0.573080122f, 0.774471223f},
-std::array<float,2>{0.186593518f, 0.965719879f},
-std::array<float,2>{0.710656822f, 0.0942836627f},
-std::array<float,2>{0.354364604f, 0.429371387f},
-std::array<float,2>{0.865715742f, 0.571193755f},
-std::array<float,2>{0.23208876f, 0.680927932f},
-std::array<float,2>{0.680411816f, 0.356555939f},
-std::array<float,2>{0.310133576f, 0.216065168f},
-std::array<float,2>{0.775686681f, 0.82466501f},
-std::array<float,2>{0.499507517f, 0.903515875f},
-std::array<float,2>{0.971520305f, 0.0309894346f},
-std::array<float,2>{0.0835320577f, 0.460999191f},
-std::array<float,2>{0.532872617f, 0.536513031f},
-std::array<float,2>{0.334610164f, 0.598184526f},
-std::array<float,2>{0.812805355f, 0.388404489f},
-std::array<float,2>{0.125957683f, 0.0872992873f},
-std::array<float,2>{0.743745208f, 0.982417047f},
-std::array<float,2>{0.0599470809f, 0.800961018f},
-std::array<float,2>{0.602311552f, 0.137618139f},
-std::array<float,2>{0.42330417f, 0.300943762f},
-std::array<float,2>{0.896079481f, 0.736688673f},
-std::array<float,2>{0.119763464f, 0.722447515f},
-std::array<float,2>{0.517198682f, 0.284871221f},
-std::array<float,2>{0.465338975f, 0.144236684f},
-std::array<float,2>{0.949008346f, 0.781500399f},
-std::array<float,2>{0.272199839f, 0.999820948f},
-std::array<float,2>{0.791608512f, 0.0634690151f},
-std::array<float,2>{0.216639355f, 0.393304378f},
-std::array<float,2>{0.630984664f, 0.620597422f},
-std::array<float,2>{0.406080246f, 0.554011405f},
-std::array<float,2>{0.932001531f, 0.444935381f},
-std::array<float,2>{0.0305872578f, 0.0129921483f},
-std::array<float,2>{0.578049242f, 0.889454186f},
-std::array<float,2>{0.183441356f, 0.837986469f},
-std::array<float,2>{0.706105053f, 0.189654097f},
-std::array<float,2>{0.356768906f, 0.369710177f},
-std::array<float,2>{0.862089217f, 0.664186776f},
-std::array<float,2>{0.229245618f, 0.586339772f},
-std::array<float,2>{0.685489297f, 0.414490581f},
-std::array<float,2>{0.304979265f, 0.123089083f},
-std::array<float,2>{0.779019833f, 0.940529644f},
-std::array<float,2>{0.494123846f, 0.76515615f},
-std::array<float,2>{0.974661887f, 0.16369082f},
-std::array<float,2>{0.081375815f, 0.253763407f},
-std::array<float,2>{0.538668513f, 0.700684786f},
-std::array<float,2>{0.328341752f, 0.626311302f},
-std::array<float,2>{0.818188727f, 0.323269576f},
-std::array<float,2>{0.13197349f, 0.227288753f},
-std::array<float,2>{0.74983412f, 0.844657421f},
-std::array<float,2>{0.0551180653f, 0.914627433f},
-std::array<float,2>{0.606186569f, 0.0618437007f},
-std::array<float,2>{0.42873463f, 0.496279895f},
-std::array<float,2>{0.892686188f, 0.525449872f},
-std::array<float,2>{0.00536829652f, 0.50589776f},
-std::array<float,2>{0.583787262f, 0.468868136f},
-std::array<float,2>{0.390083343f, 0.032741867f},
-std::array<float,2>{0.91273272f, 0.922314763f},
-std::array<float,2>{0.367464542f, 0.870461464f},
-std::array<float,2>{0.847485065f, 0.240802228f},
-std::array<float,2>{0.171450153f, 0.328433216f},
-std::array<float,2>{0.701833725f, 0.655514479f},
-std::array<float,2>{0.445992231f, 0.708211303f},
-std::array<float,2>{0.954050303f, 0.276802629f},
-std::array<float,2>{0.104687124f, 0.182397351f},
-std::array<float,2>{0.504215956f, 0.768482029f},
-std::array<float,2>{0.200061694f, 0.95768863f},
-std::array<float,2>{0.646083295f, 0.109311901f},
-std::array<float,2>{0.262250394f, 0.434694558f},
-std::array<float,2>{0.80287677f, 0.570028603f},
-std::array<float,2>{0.145311937f, 0.676218808f},
-std::array<float,2>{0.724253416f, 0.347904772f},
-std::array<float,2>{0.313180029f, 0.207444385f},
-std::array<float,2>{0.842737615f, 0.817523599f},
-std::array<float,2>{0.417799354f, 0.891142428f},
-std::array<float,2>{0.883669615f, 0.0181201994f},
-std::array<float,2>{0.0357495733f, 0.454842389f},
-std::array<float,2>{0.61765784f, 0.544740021f},
-std::array<float,2>{0.290400624f, 0.602359593f},
-std::array<float,2>{0.763768554f, 0.375929326f},
-std::array<float,2>{0.236236766f, 0.0854087844f},
-std::array<float,2>{0.664199591f, 0.973276079f},
-std::array<float,2>{0.0745218247f, 0.811525583f},
-std::array<float,2>{0.562187612f, 0.126288503f},
-std::array<float,2>{0.4835684f, 0.311965376f},
-std::array<float,2>{0.988845527f, 0.747393429f},
-std::array<float,2>{0.0412763432f, 0.641417086f},
-std::array<float,2>{0.615380883f, 0.336810559f},
-std::array<float,2>{0.411611259f, 0.242909417f},
-std::array<float,2>{0.879050434f, 0.866602302f},
-std::array<float,2>{0.3219679f, 0.935599267f},
-std::array<float,2>{0.833559811f, 0.0427960567f},
-std::array<float,2>{0.149476394f, 0.477963716f},
-std::array<float,2>{0.732640922f, 0.514732599f},
-std::array<float,2>{0.47416091f, 0.576182663f},
-std::array<float,2>{0.996992707f, 0.42484507f},
-std::array<float,2>{0.0635945648f, 0.0997755378f},
-std::array<float,2>{0.547306001f, 0.961017728f},
-std::array<float,2>{0.247769207f, 0.780586839f},
-std::array<float,2>{0.658132434f, 0.177058414f},
-std::array<float,2>{0.285739064f, 0.267970711f},
-std::array<float,2>{0.755323291f, 0.712381244f},
-std::array<float,2>{0.160865441f, 0.53228724f},
-std::array<float,2>{0.691462517f, 0.467122108f},
-std::array<float,2>{0.365017056f, 0.0266883094f},
-std::array<float,2>{0.851586938f, 0.90055418f},
-std::array<float,2>{0.375123501f, 0.822266579f},
-std::array<float,2>{0.917444229f, 0.211360157f},
-std::array<float,2>{0.00829766504f, 0.352871239f},
-std::array<float,2>{0.589548588f, 0.684840083f},
-std::array<float,2>{0.256110877f, 0.740823388f},
-std::array<float,2>{0.808976054f, 0.297784209f},
-std::array<float,2>{0.187641725f, 0.134084597f},
-std::array<float,2>{0.652554512f, 0.798273087f},
-std::array<float,2>{0.0976310596f, 0.978018641f},
-std::array<float,2>{0.514891565f, 0.0900778323f},
-std::array<float,2>{0.441284686f, 0.384646833f},
-std::array<float,2>{0.965451837f, 0.593982041f},
-std::array<float,2>{0.0926736668f, 0.61634618f},
-std::array<float,2>{0.543192983f, 0.404245347f},
-std::array<float,2>{0.487971425f, 0.0731256232f},
-std::array<float,2>{0.978623331f, 0.987209678f},
-std::array<float,2>{0.300857991f, 0.792474151f},
-std::array<float,2>{0.766336322f, 0.148869202f},
-std::array<float,2>{0.225475013f, 0.293037027f},
-std::array<float,2>{0.673844755f, 0.729903877f},
-std::array<float,2>{0.436411798f, 0.664044976f},
-std::array<float,2>{0.900797009f, 0.361349374f},
-std::array<float,2>{0.0493337773f, 0.201777369f},
-std::array<float,2>{0.596688151f, 0.834642708f},
-std::array<float,2>{0.135050327f, 0.879001796f},
-std::array<float,2>{0.741463482f, 0.00514677633f},
-std::array<float,2>{0.33694315f, 0.45275265f},
-std::array<float,2>{0.827589452f, 0.557313561f},
-std::array<float,2>{0.209233522f, 0.691229761f},
-std::array<float,2>{0.634926796f, 0.262287468f},
-std::array<float,2>{0.275637776f, 0.171679556f},
-std::array<float,2>{0.788936198f, 0.755427957f},
-std::array<float,2>{0.454418361f, 0.94903177f},
-std::array<float,2>{0.93900919f, 0.113370776f},
-std::array<float,2>{0.114926957f, 0.406687498f},
-std::array<float,2>{0.525391638f, 0.583403766f},
-std::array<float,2>{0.351130009f, 0.518920481f},
-std::array<float,2>{0.87071979f, 0.49208051f},
-std::array<float,2>{0.176079124f, 0.0476534925f},
-std::array<float,2>{0.715342402f, 0.908115566f},
-std::array<float,2>{0.0220596772f, 0.854244947f},
-std::array<float,2>{0.564732134f, 0.222856104f},
-std::array<float,2>{0.390726805f, 0.313951999f},
-std::array<float,2>{0.929225802f, 0.63352567f},
-std::array<float,2>{0.0680863634f, 0.671759725f},
-std::array<float,2>{0.552899837f, 0.372807384f},
-std::array<float,2>{0.470034361f, 0.193596303f},
-std::array<float,2>{0.995567501f, 0.843527198f},
-std::array<float,2>{0.285072416f, 0.882849216f},
-std::array<float,2>{0.752429962f, 0.0109309657f},
-std::array<float,2>{0.242649004f, 0.438719898f},
-std::array<float,2>{0.662361979f, 0.548449457f},
-std::array<float,2>{0.406329513f, 0.623655736f},
-std::array<float,2>{0.876881421f, 0.396471113f},
-std::array<float,2>{0.0457947478f, 0.0695125386f},
-std::array<float,2>{0.611009479f, 0.993593693f},
-std::array<float,2>{0.153310299f, 0.78730309f},
-std::array<float,2>{0.726833165f, 0.145550445f},
-std::array<float,2>{0.327647209f, 0.285751551f},
-std::array<float,2>{0.828650594f, 0.726282001f},
-std::array<float,2>{0.193270534f, 0.527632833f},
-std::array<float,2>{0.648637295f, 0.494266987f},
-std::array<float,2>{0.25358662f, 0.0565152876f},
-std::array<float,2>{0.805834413f, 0.920930147f},
-std::array<float,2>{0.444284648f, 0.848710299f},
-std::array<float,2>{0.962352097f, 0.232418314f},
-std::array<float,2>{0.0990036577f, 0.326315194f},
-std::array<float,2>{0.508267105f, 0.632595897f},
-std::array<float,2>{0.36036846f, 0.696730912f},
-std::array<float,2>{0.856731594f, 0.255875021f},
-std::array<float,2>{0.157854915f, 0.158688053f},
-std::array<float,2>{0.689027548f, 0.759657919f},
-std::array<float,2>{0.0127992369f, 0.944419503f},
-std::array<float,2>{0.593275249f, 0.118164614f},
-std::array<float,2>{0.380302817f, 0.419455737f},
-std::array<float,2>{0.921514869f, 0.590865493f},
-std::array<float,2>{0.0538298041f, 0.564443648f},
-std::array<float,2>{0.599585652f, 0.430820107f},
-std::array<float,2>{0.430098087f, 0.104065679f},
-std::array<float,2>{0.902993262f, 0.956074893f},
-std::array<float,2>{0.339986086f, 0.771429658f},
-std::array<float,2>{0.820620716f, 0.184320554f},
-std::array<float,2>{0.138076872f, 0.278083026f},
-std::array<float,2>{0.736861885f, 0.706466496f},
-std::array<float,2>{0.489914328f, 0.651963532f},
-std::array<float,2>{0.980613112f, 0.332473457f},
-std::array<float,2>{0.0884099752f, 0.237227038f},
-std::array<float,2>{0.540539861f, 0.871250451f},
-std::array<float,2>{0.221287891f, 0.927202344f},
-std::array<float,2>{0.679500401f, 0.0383502617f},
-std::array<float,2>{0.298003763f, 0.475870013f},
-std::array<float,2>{0.773271322f, 0.500675678f},
-std::array<float,2>{0.173457086f, 0.743549943f},
-std::array<float,2>{0.711837232f, 0.306048334f},
-std::array<float,2>{0.346115917f, 0.131625339f},
-std::array<float,2>{0.87430495f, 0.805018783f},
-std::array<float,2>{0.395494908f, 0.969430625f},
-std::array<float,2>{0.925656796f, 0.0784046203f},
-std::array<float,2>{0.0187194534f, 0.382730037f},
-std::array<float,2>{0.567143738f, 0.609152973f},
-std::array<float,2>{0.27939719f, 0.541462541f},
-std::array<float,2>{0.782218158f, 0.457500368f},
-std::array<float,2>{0.20516561f, 0.0208146349f},
-std::array<float,2>{0.637906075f, 0.897770107f},
-std::array<float,2>{0.110147908f, 0.812648952f},
-std::array<float,2>{0.52994293f, 0.203200296f},
-std::array<float,2>{0.460023165f, 0.343860269f},
-std::array<float,2>{0.941539466f, 0.67437911f},
-std::array<float,2>{0.0252795704f, 0.71820873f},
-std::array<float,2>{0.573440313f, 0.269872218f},
-std::array<float,2>{0.401354343f, 0.174749032f},
-std::array<float,2>{0.935087442f, 0.777323902f},
-std::array<float,2>{0.355294198f, 0.966949344f},
-std::array<float,2>{0.867045343f, 0.0969244689f},
-std::array<float,2>{0.186090216f, 0.426765323f},
-std::array<float,2>{0.709664702f, 0.573797524f},
-std::array<float,2>{0.463365376f, 0.511647582f},
-std::array<float,2>{0.952097714f, 0.48099339f},
-std::array<float,2>{0.124261968f, 0.0442340821f},
-std::array<float,2>{0.519720197f, 0.933312416f},
-std::array<float,2>{0.212942392f, 0.860765517f},
-std::array<float,2>{0.627417624f, 0.247818917f},
-std::array<float,2>{0.265813321f, 0.342356056f},
-std::array<float,2>{0.793666482f, 0.645190358f},
-std::array<float,2>{0.126282305f, 0.599987864f},
-std::array<float,2>{0.742970288f, 0.38884151f},
-std::array<float,2>{0.335513324f, 0.0891084746f},
-std::array<float,2>{0.813567579f, 0.984117985f},
-std::array<float,2>{0.422004879f, 0.803550541f},
-std::array<float,2>{0.895067334f, 0.139199942f},
-std::array<float,2>{0.0594576448f, 0.304605752f},
-std::array<float,2>{0.602956533f, 0.73594594f},
-std::array<float,2>{0.309538275f, 0.683493495f},
-std::array<float,2>{0.777209282f, 0.358455271f},
-std::array<float,2>{0.230874568f, 0.217974901f},
-std::array<float,2>{0.681366086f, 0.828049242f},
-std::array<float,2>{0.082245484f, 0.904880226f},
-std::array<float,2>{0.531480908f, 0.0284497552f},
-std::array<float,2>{0.498818129f, 0.4643794f},
-std::array<float,2>{0.971859872f, 0.538265347f},
-std::array<float,2>{0.107270263f, 0.55886668f},
-std::array<float,2>{0.503062248f, 0.446463138f},
-std::array<float,2>{0.45010978f, 0.00327220862f},
-std::array<float,2>{0.960595787f, 0.875848591f},
-std::array<float,2>{0.258022726f, 0.830879629f},
-std::array<float,2>{0.799642563f, 0.195858672f},
-std::array<float,2>{0.198721334f, 0.36496374f},
-std::array<float,2>{0.642194986f, 0.659457386f},
-std::array<float,2>{0.384586632f, 0.733352065f},
-std::array<float,2>{0.909170628f, 0.289784491f},
-std::array<float,2>{0.00320053915f, 0.156019509f},
-std::array<float,2>{0.580849946f, 0.793249249f},
-std::array<float,2>{0.167183846f, 0.990966618f},
-std::array<float,2>{0.698383212f, 0.0759921074f},
-std::array<float,2>{0.372880399f, 0.399611652f},
-std::array<float,2>{0.847826481f, 0.610252619f},
-std::array<float,2>{0.238284126f, 0.639897704f},
-std::array<float,2>{0.669945359f, 0.31922251f},
-std::array<float,2>{0.293045759f, 0.221764222f},
-std::array<float,2>{0.761416972f, 0.857888639f},
-std::array<float,2>{0.477170467f, 0.913295984f},
-std::array<float,2>{0.984944105f, 0.0510301217f},
-std::array<float,2>{0.0723828375f, 0.488018245f},
-std::array<float,2>{0.555003643f, 0.520456016f},
-std::array<float,2>{0.319953412f, 0.580124736f},
-std::array<float,2>{0.837146223f, 0.413093686f},
-std::array<float,2>{0.142794967f, 0.11302381f},
-std::array<float,2>{0.721602559f, 0.952481031f},
-std::array<float,2>{0.0317675956f, 0.75375098f},
-std::array<float,2>{0.624517381f, 0.167540789f},
-std::array<float,2>{0.421543092f, 0.259351224f},
-std::array<float,2>{0.887574553f, 0.693291128f},
-std::array<float,2>{0.0787167996f, 0.702371538f},
-std::array<float,2>{0.536508203f, 0.250659704f},
-std::array<float,2>{0.49467808f, 0.161566839f},
-std::array<float,2>{0.973974466f, 0.762412012f},
-std::array<float,2>{0.307104647f, 0.938253343f},
-std::array<float,2>{0.779414356f, 0.121429808f},
-std::array<float,2>{0.226719901f, 0.417717934f},
-std::array<float,2>{0.687296271f, 0.58916229f},
-std::array<float,2>{0.427147448f, 0.524368763f},
-std::array<float,2>{0.890773416f, 0.499968171f},
-std::array<float,2>{0.0582362376f, 0.0599832758f},
-std::array<float,2>{0.607480943f, 0.916723371f},
-std::array<float,2>{0.130190149f, 0.846678376f},
-std::array<float,2>{0.746333241f, 0.22912471f},
-std::array<float,2>{0.330471039f, 0.321076542f},
-std::array<float,2>{0.818469346f, 0.62881732f},
-std::array<float,2>{0.218530074f, 0.618760943f},
-std::array<float,2>{0.630219698f, 0.391495466f},
-std::array<float,2>{0.269535094f, 0.0652608499f},
-std::array<float,2>{0.789836228f, 0.99665302f},
-std::array<float,2>{0.468708992f, 0.784632564f},
-std::array<float,2>{0.945430696f, 0.14198637f},
-std::array<float,2>{0.117521912f, 0.282506526f},
-std::array<float,2>{0.518338501f, 0.720484197f},
-std::array<float,2>{0.357473701f, 0.667427599f},
-std::array<float,2>{0.860499501f, 0.36851868f},
-std::array<float,2>{0.181041181f, 0.187979579f},
-std::array<float,2>{0.703391612f, 0.836569011f},
-std::array<float,2>{0.0286179837f, 0.887275994f},
-std::array<float,2>{0.574920714f, 0.014219488f},
-std::array<float,2>{0.40252158f, 0.441515863f},
-std::array<float,2>{0.930556059f, 0.552153051f},
-std::array<float,2>{0.0375244953f, 0.545012474f},
-std::array<float,2>{0.619870365f, 0.456268251f},
-std::array<float,2>{0.415326595f, 0.0172566772f},
-std::array<float,2>{0.886526525f, 0.893941879f},
-std::array<float,2>{0.315632015f, 0.819728851f},
-std::array<float,2>{0.841489851f, 0.210829794f},
-std::array<float,2>{0.147059038f, 0.350752532f},
-std::array<float,2>{0.725279093f, 0.678219855f},
-std::array<float,2>{0.481192172f, 0.748650908f},
-std::array<float,2>{0.991154194f, 0.310325652f},
-std::array<float,2>{0.0777370185f, 0.127685666f},
-std::array<float,2>{0.558720827f, 0.810078561f},
-std::array<float,2>{0.237709239f, 0.976019084f},
-std::array<float,2>{0.666911006f, 0.0830302462f},
-std::array<float,2>{0.292398304f, 0.377624482f},
-std::array<float,2>{0.762051046f, 0.604932547f},
-std::array<float,2>{0.169081599f, 0.652714431f},
-std::array<float,2>{0.699674368f, 0.33197102f},
-std::array<float,2>{0.370693296f, 0.238629371f},
-std::array<float,2>{0.844475567f, 0.869137526f},
-std::array<float,2>{0.387935847f, 0.924526811f},
-std::array<float,2>{0.9107759f, 0.0338696986f},
-std::array<float,2>{0.0064462563f, 0.471097052f},
-std::array<float,2>{0.584836721f, 0.50515449f},
-std::array<float,2>{0.265238225f, 0.567117333f},
-std::array<float,2>{0.801392555f, 0.436376423f},
-std::array<float,2>{0.202248707f, 0.107168384f},
-std::array<float,2>{0.646772265f, 0.959775925f},
-std::array<float,2>{0.102003768f, 0.767513216f},
-std::array<float,2>{0.506120265f, 0.18076767f},
-std::array<float,2>{0.447742373f, 0.275065064f},
-std::array<float,2>{0.956039965f, 0.710197031f},
-std::array<float,2>{0.0101579456f, 0.686914682f},
-std::array<float,2>{0.586679578f, 0.354151964f},
-std::array<float,2>{0.377137631f, 0.213611111f},
-std::array<float,2>{0.915609419f, 0.822111487f},
-std::array<float,2>{0.36596936f, 0.900301158f},
-std::array<float,2>{0.855221629f, 0.0236164331f},
-std::array<float,2>{0.162405446f, 0.466566622f},
-std::array<float,2>{0.694631577f, 0.533724129f},
-std::array<float,2>{0.439167768f, 0.597157657f},
-std::array<float,2>{0.968078256f, 0.385151267f},
-std::array<float,2>{0.0952122286f, 0.0927733704f},
-std::array<float,2>{0.513652682f, 0.980305195f},
-std::array<float,2>{0.189802393f, 0.799282193f},
-std::array<float,2>{0.654999912f, 0.136712432f},
-std::array<float,2>{0.255088657f, 0.300224811f},
-std::array<float,2>{0.810672462f, 0.740231574f},
-std::array<float,2>{0.151027799f, 0.512667656f},
-std::array<float,2>{0.730985463f, 0.479085356f},
-std::array<float,2>{0.323282331f, 0.0402273722f},
-std::array<float,2>{0.834222674f, 0.93528986f},
-std::array<float,2>{0.412174195f, 0.864954412f},
-std::array<float,2>{0.881710052f, 0.244236901f},
-std::array<float,2>{0.040429607f, 0.338799596f},
-std::array<float,2>{0.615190208f, 0.6442222f},
-std::array<float,2>{0.287456661f, 0.713353455f},
-std::array<float,2>{0.756530702f, 0.265701979f},
-std::array<float,2>{0.248779446f, 0.179471701f},
-std::array<float,2>{0.66004169f, 0.777451575f},
-std::array<float,2>{0.0656168833f, 0.96471709f},
-std::array<float,2>{0.549876451f, 0.0980081186f},
-std::array<float,2>{0.476274759f, 0.422530293f},
-std::array<float,2>{0.998641491f, 0.574811637f},
-std::array<float,2>{0.115877718f, 0.585895836f},
-std::array<float,2>{0.524392247f, 0.410085142f},
-std::array<float,2>{0.456187397f, 0.116160765f},
-std::array<float,2>{0.940178335f, 0.946524084f},
-std::array<float,2>{0.275288194f, 0.756915689f},
-std::array<float,2>{0.786059797f, 0.169909298f},
-std::array<float,2>{0.208431602f, 0.265416563f},
-std::array<float,2>{0.633399427f, 0.687586069f},
-std::array<float,2>{0.393878996f, 0.636554837f},
-std::array<float,2>{0.927112281f, 0.315065205f},
-std::array<float,2>{0.0207024887f, 0.224687442f},
-std::array<float,2>{0.562887967f, 0.853288054f},
-std::array<float,2>{0.178902507f, 0.909514546f},
-std::array<float,2>{0.71869123f, 0.0489520207f},
-std::array<float,2>{0.348174721f, 0.488818288f},
-std::array<float,2>{0.86768347f, 0.516941726f},
-std::array<float,2>{0.224187687f, 0.727880597f},
-std::array<float,2>{0.673685014f, 0.296029657f},
-std::array<float,2>{0.304224402f, 0.151379436f},
-std::array<float,2>{0.767918289f, 0.789819241f},
-std::array<float,2>{0.485559195f, 0.985214949f},
-std::array<float,2>{0.977059841f, 0.0710556731f},
-std::array<float,2>{0.0903239399f, 0.405078977f},
-std::array<float,2>{0.546405613f, 0.613998055f},
-std::array<float,2>{0.338895679f, 0.55498594f},
-std::array<float,2>{0.824729681f, 0.450603455f},
-std::array<float,2>{0.133997947f, 0.00725009944f},
-std::array<float,2>{0.738677561f, 0.881738603f},
-std::array<float,2>{0.0479748845f, 0.833509922f},
-std::array<float,2>{0.595587671f, 0.199390456f},
-std::array<float,2>{0.433889747f, 0.360640734f},
-std::array<float,2>{0.899912894f, 0.660651684f},
-std::array<float,2>{0.0998419672f, 0.629023492f},
-std::array<float,2>{0.511107385f, 0.325369269f},
-std::array<float,2>{0.44261387f, 0.234057337f},
-std::array<float,2>{0.964613855f, 0.851252794f},
-std::array<float,2>{0.251869559f, 0.918295622f},
-std::array<float,2>{0.806838632f, 0.0570143983f},
-std::array<float,2>{0.193672329f, 0.493489683f},
-std::array<float,2>{0.650998414f, 0.530686378f},
-std::array<float,2>{0.381599218f, 0.592738569f},
-std::array<float,2>{0.918019235f, 0.421734959f},
-std::array<float,2>{0.0149244163f, 0.11995893f},
-std::array<float,2>{0.590429723f, 0.942991316f},
-std::array<float,2>{0.159316882f, 0.760348022f},
-std::array<float,2>{0.691296279f, 0.156450987f},
-std::array<float,2>{0.362584621f, 0.25498867f},
-std::array<float,2>{0.858608365f, 0.698864102f},
-std::array<float,2>{0.245521769f, 0.550662458f},
-std::array<float,2>{0.661357105f, 0.440156847f},
-std::array<float,2>{0.281650603f, 0.00936386641f},
-std::array<float,2>{0.751008272f, 0.886633873f},
-std::array<float,2>{0.470719397f, 0.840986252f},
-std::array<float,2>{0.992255688f, 0.192148939f},
-std::array<float,2>{0.0687159523f, 0.373967916f},
-std::array<float,2>{0.550865769f, 0.667971849f},
-std::array<float,2>{0.324229538f, 0.724405468f},
-std::array<float,2>{0.831164539f, 0.288237154f},
-std::array<float,2>{0.155748338f, 0.146862999f},
-std::array<float,2>{0.728873909f, 0.785305738f},
-std::array<float,2>{0.043560151f, 0.995609403f},
-std::array<float,2>{0.611396968f, 0.0673517585f},
-std::array<float,2>{0.40959385f, 0.397372603f},
-std::array<float,2>{0.877768874f, 0.622562647f},
-std::array<float,2>{0.0168780442f, 0.607411623f},
-std::array<float,2>{0.568774521f, 0.379130214f},
-std::array<float,2>{0.396587282f, 0.0816092566f},
-std::array<float,2>{0.922416687f, 0.971221089f},
-std::array<float,2>{0.344371527f, 0.808431029f},
-std::array<float,2>{0.872917116f, 0.129356042f},
-std::array<float,2>{0.174378172f, 0.307524621f},
-std::array<float,2>{0.714458525f, 0.745284796f},
-std::array<float,2>{0.457582414f, 0.673354268f},
-std::array<float,2>{0.945152879f, 0.34705025f},
-std::array<float,2>{0.112856939f, 0.206471056f},
-std::array<float,2>{0.528901815f, 0.816094637f},
-std::array<float,2>{0.204791725f, 0.894598901f},
-std::array<float,2>{0.639068425f, 0.0226728115f},
-std::array<float,2>{0.277534336f, 0.459119022f},
-std::array<float,2>{0.783520281f, 0.540805638f},
-std::array<float,2>{0.139157444f, 0.704220593f},
-std::array<float,2>{0.736275911f, 0.280463099f},
-std::array<float,2>{0.342509955f, 0.187345818f},
-std::array<float,2>{0.823363483f, 0.773175418f},
-std::array<float,2>{0.433340609f, 0.954829752f},
-std::array<float,2>{0.904596031f, 0.102525383f},
-std::array<float,2>{0.0511072427f, 0.433520496f},
-std::array<float,2>{0.60120064f, 0.565543413f},
-std::array<float,2>{0.299443334f, 0.503563523f},
-std::array<float,2>{0.770952761f, 0.473557591f},
-std::array<float,2>{0.21949181f, 0.0353869125f},
-std::array<float,2>{0.676064909f, 0.928095162f},
-std::array<float,2>{0.086824581f, 0.873145401f},
-std::array<float,2>{0.542379975f, 0.235461727f},
-std::array<float,2>{0.491649717f, 0.334970504f},
-std::array<float,2>{0.983740807f, 0.64950186f},
-std::array<float,2>{0.06083389f, 0.738015771f},
-std::array<float,2>{0.604379177f, 0.302444309f},
-std::array<float,2>{0.424227834f, 0.137959883f},
-std::array<float,2>{0.896544397f, 0.802210867f},
-std::array<float,2>{0.332727879f, 0.980670035f},
-std::array<float,2>{0.815780759f, 0.086835742f},
-std::array<float,2>{0.128650188f, 0.38752088f},
-std::array<float,2>{0.744239151f, 0.59915328f},
-std::array<float,2>{0.497501433f, 0.535609066f},
-std::array<float,2>{0.970639586f, 0.462562591f},
-std::array<float,2>{0.085172832f, 0.0301660262f},
-std::array<float,2>{0.534719229f, 0.903031647f},
-std::array<float,2>{0.232633725f, 0.825701892f},
-std::array<float,2>{0.683286726f, 0.215562165f},
-std::array<float,2>{0.31057775f, 0.355656654f},
-std::array<float,2>{0.774534166f, 0.680249214f},
-std::array<float,2>{0.185056195f, 0.571675062f},
-std::array<float,2>{0.708738685f, 0.428571612f},
-std::array<float,2>{0.351962984f, 0.0950930342f},
-std::array<float,2>{0.863948464f, 0.966518641f},
-std::array<float,2>{0.399325818f, 0.773979545f},
-std::array<float,2>{0.936481595f, 0.172725767f},
-std::array<float,2>{0.0268144794f, 0.272109896f},
-std::array<float,2>{0.571498334f, 0.715673625f},
-std::array<float,2>{0.26779896f, 0.647562802f},
-std::array<float,2>{0.796084583f, 0.34099856f},
-std::array<float,2>{0.212080136f, 0.248681754f},
-std::array<float,2>{0.626845002f, 0.862005413f},
-std::array<float,2>{0.122504003f, 0.930474937f},
-std::array<float,2>{0.521604538f, 0.0459516272f},
-std::array<float,2>{0.461693853f, 0.483492196f},
-std::array<float,2>{0.950929463f, 0.508380949f},
-std::array<float,2>{0.0720171407f, 0.522862494f},
-std::array<float,2>{0.557757795f, 0.484521747f},
-std::array<float,2>{0.479121f, 0.0544882305f},
-std::array<float,2>{0.986499965f, 0.911934078f},
-std::array<float,2>{0.295616299f, 0.856645703f},
-std::array<float,2>{0.758303881f, 0.219218567f},
-std::array<float,2>{0.240892142f, 0.317894459f},
-std::array<float,2>{0.66893965f, 0.637194932f},
-std::array<float,2>{0.418087393f, 0.69417572f},
-std::array<float,2>{0.889044642f, 0.26168257f},
-std::array<float,2>{0.034917064f, 0.164992198f},
-std::array<float,2>{0.622911751f, 0.751551628f},
-std::array<float,2>{0.141239196f, 0.950019956f},
-std::array<float,2>{0.719253898f, 0.111013629f},
-std::array<float,2>{0.317462653f, 0.41068387f},
-std::array<float,2>{0.839185715f, 0.579971671f},
-std::array<float,2>{0.196980074f, 0.658028126f},
-std::array<float,2>{0.642894983f, 0.367162585f},
-std::array<float,2>{0.260298997f, 0.198660687f},
-std::array<float,2>{0.797327936f, 0.82969439f},
-std::array<float,2>{0.452082843f, 0.877783775f},
-std::array<float,2>{0.958412707f, 0.000177775466f},
-std::array<float,2>{0.109160654f, 0.448076278f},
-std::array<float,2>{0.501403689f, 0.561301589f},
-std::array<float,2>{0.373714834f, 0.612448931f},
-std::array<float,2>{0.850337625f, 0.402151644f},
-std::array<float,2>{0.16547133f, 0.078092359f},
-std::array<float,2>{0.695483863f, 0.98921752f},
-std::array<float,2>{0.000215074353f, 0.795450091f},
-std::array<float,2>{0.578164101f, 0.153586775f},
-std::array<float,2>{0.3851206f, 0.291381985f},
-std::array<float,2>{0.907135248f, 0.731998622f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.285973459f, 0.185307011f},
-std::array<float,2>{0.744183362f, 0.683960259f},
-std::array<float,2>{0.0229225289f, 0.879684091f},
-std::array<float,2>{0.839624703f, 0.499001324f},
-std::array<float,2>{0.176765263f, 0.272257954f},
-std::array<float,2>{0.894960821f, 0.854001939f},
-std::array<float,2>{0.41409266f, 0.599149704f},
-std::array<float,2>{0.606110215f, 0.0531670973f},
-std::array<float,2>{0.098872833f, 0.111293338f},
-std::array<float,2>{0.785193145f, 0.518754542f},
-std::array<float,2>{0.334600836f, 0.759108901f},
-std::array<float,2>{0.663287282f, 0.320641994f},
-std::array<float,2>{0.478836715f, 0.406781524f},
-std::array<float,2>{0.534977078f, 0.942126453f},
-std::array<float,2>{0.221116334f, 0.709121644f},
-std::array<float,2>{0.993430555f, 0.238198355f},
-std::array<float,2>{0.405667424f, 0.0184590742f},
-std::array<float,2>{0.577277184f, 0.56680274f},
-std::array<float,2>{0.134978846f, 0.837215662f},
-std::array<float,2>{0.922617137f, 0.283785641f},
-std::array<float,2>{0.0575142764f, 0.446805805f},
-std::array<float,2>{0.866120994f, 0.908083975f},
-std::array<float,2>{0.256250203f, 0.631102324f},
-std::array<float,2>{0.700966954f, 0.144367695f},
-std::array<float,2>{0.195107758f, 0.191764429f},
-std::array<float,2>{0.939387202f, 0.749844909f},
-std::array<float,2>{0.465717673f, 0.987870336f},
-std::array<float,2>{0.51531744f, 0.375613272f},
-std::array<float,2>{0.356331736f, 0.374615461f},
-std::array<float,2>{0.654266238f, 0.794182122f},
-std::array<float,2>{0.0721106231f, 0.539000988f},
-std::array<float,2>{0.759074807f, 0.0769057348f},
-std::array<float,2>{0.447942197f, 0.221566558f},
-std::array<float,2>{0.525855601f, 0.700634301f},
-std::array<float,2>{0.20596312f, 0.963914335f},
-std::array<float,2>{0.953370452f, 0.42814067f},
-std::array<float,2>{0.0850560963f, 0.331037223f},
-std::array<float,2>{0.773101747f, 0.769502044f},
-std::array<float,2>{0.360736132f, 0.511519015f},
-std::array<float,2>{0.634632647f, 0.102327667f},
-std::array<float,2>{0.143951952f, 0.0390359722f},
-std::array<float,2>{0.912227273f, 0.618183136f},
-std::array<float,2>{0.384618431f, 0.871314347f},
-std::array<float,2>{0.579180777f, 0.261692613f},
-std::array<float,2>{0.276649565f, 0.484259099f},
-std::array<float,2>{0.709588528f, 0.901122391f},
-std::array<float,2>{0.0317643993f, 0.658202231f},
-std::array<float,2>{0.849152803f, 0.16036202f},
-std::array<float,2>{0.322768569f, 0.082811527f},
-std::array<float,2>{0.676854551f, 0.554494441f},
-std::array<float,2>{0.118358336f, 0.805202961f},
-std::array<float,2>{0.804868698f, 0.345359743f},
-std::array<float,2>{0.240211725f, 0.404808372f},
-std::array<float,2>{0.983040631f, 0.972335875f},
-std::array<float,2>{0.491292298f, 0.721394598f},
-std::array<float,2>{0.555638552f, 0.204985991f},
-std::array<float,2>{0.0120597202f, 0.12532559f},
-std::array<float,2>{0.817217648f, 0.649116933f},
-std::array<float,2>{0.30600372f, 0.923404217f},
-std::array<float,2>{0.729445815f, 0.457624406f},
-std::array<float,2>{0.430631578f, 0.302415013f},
-std::array<float,2>{0.620512903f, 0.824684918f},
-std::array<float,2>{0.160981372f, 0.582489491f},
-std::array<float,2>{0.890453875f, 0.0105822552f},
-std::array<float,2>{0.371723622f, 0.218584657f},
-std::array<float,2>{0.626575768f, 0.734038949f},
-std::array<float,2>{0.0892561153f, 0.979932427f},
-std::array<float,2>{0.781175315f, 0.39327237f},
-std::array<float,2>{0.212924078f, 0.357235819f},
-std::array<float,2>{0.961966395f, 0.80217135f},
-std::array<float,2>{0.440644622f, 0.558929324f},
-std::array<float,2>{0.521274447f, 0.0878581852f},
-std::array<float,2>{0.042511899f, 0.00605777744f},
-std::array<float,2>{0.859054506f, 0.592594326f},
-std::array<float,2>{0.267563194f, 0.818896651f},
-std::array<float,2>{0.715026498f, 0.309159786f},
-std::array<float,2>{0.376055062f, 0.462458253f},
-std::array<float,2>{0.591149807f, 0.936570346f},
-std::array<float,2>{0.154620081f, 0.643843055f},
-std::array<float,2>{0.917665184f, 0.133878648f},
-std::array<float,2>{0.495936126f, 0.101235084f},
-std::array<float,2>{0.554089665f, 0.506493807f},
-std::array<float,2>{0.249538675f, 0.775481105f},
-std::array<float,2>{0.969957888f, 0.338656306f},
-std::array<float,2>{0.111108758f, 0.433936417f},
-std::array<float,2>{0.801082075f, 0.954389632f},
-std::array<float,2>{0.314534575f, 0.691977561f},
-std::array<float,2>{0.681682885f, 0.228632003f},
-std::array<float,2>{0.16486764f, 0.170329586f},
-std::array<float,2>{0.880724192f, 0.667839825f},
-std::array<float,2>{0.422516197f, 0.894494176f},
-std::array<float,2>{0.611621797f, 0.469142556f},
-std::array<float,2>{0.30215618f, 0.250918448f},
-std::array<float,2>{0.725614727f, 0.864500761f},
-std::array<float,2>{0.0051067099f, 0.609624326f},
-std::array<float,2>{0.82806313f, 0.0445061438f},
-std::array<float,2>{0.408269256f, 0.152001798f},
-std::array<float,2>{0.596972167f, 0.637161136f},
-std::array<float,2>{0.185256004f, 0.916185081f},
-std::array<float,2>{0.903251052f, 0.440247327f},
-std::array<float,2>{0.0311323963f, 0.291419297f},
-std::array<float,2>{0.830038607f, 0.830492079f},
-std::array<float,2>{0.295911163f, 0.575188279f},
-std::array<float,2>{0.73970902f, 0.0280337073f},
-std::array<float,2>{0.232750863f, 0.0642241687f},
-std::array<float,2>{0.986010849f, 0.546038568f},
-std::array<float,2>{0.475668758f, 0.788483322f},
-std::array<float,2>{0.540736854f, 0.362951249f},
-std::array<float,2>{0.339823216f, 0.38777411f},
-std::array<float,2>{0.670803368f, 0.996128321f},
-std::array<float,2>{0.102964893f, 0.739170909f},
-std::array<float,2>{0.796075225f, 0.198889911f},
-std::array<float,2>{0.264901131f, 0.0589462817f},
-std::array<float,2>{0.689380288f, 0.606292307f},
-std::array<float,2>{0.0480996147f, 0.844101012f},
-std::array<float,2>{0.870096684f, 0.277245224f},
-std::array<float,2>{0.125916079f, 0.49107036f},
-std::array<float,2>{0.933131754f, 0.887613416f},
-std::array<float,2>{0.397982746f, 0.672731042f},
-std::array<float,2>{0.567128062f, 0.179276809f},
-std::array<float,2>{0.0692109466f, 0.243080005f},
-std::array<float,2>{0.756893158f, 0.713279426f},
-std::array<float,2>{0.348415613f, 0.952369571f},
-std::array<float,2>{0.641462147f, 0.418062389f},
-std::array<float,2>{0.454627693f, 0.317599982f},
-std::array<float,2>{0.502070308f, 0.75378114f},
-std::array<float,2>{0.203047633f, 0.529121041f},
-std::array<float,2>{0.949809313f, 0.119338006f},
-std::array<float,2>{0.330662459f, 0.137928575f},
-std::array<float,2>{0.656797707f, 0.645303011f},
-std::array<float,2>{0.0963266268f, 0.931610882f},
-std::array<float,2>{0.782547772f, 0.467943311f},
-std::array<float,2>{0.222919956f, 0.307005137f},
-std::array<float,2>{0.997789681f, 0.814887047f},
-std::array<float,2>{0.484023571f, 0.588187337f},
-std::array<float,2>{0.537998676f, 0.000900404702f},
-std::array<float,2>{0.016901033f, 0.0905229747f},
-std::array<float,2>{0.842340112f, 0.557629585f},
-std::array<float,2>{0.281754017f, 0.79695785f},
-std::array<float,2>{0.747652173f, 0.353563666f},
-std::array<float,2>{0.418556571f, 0.394821137f},
-std::array<float,2>{0.604762495f, 0.983565092f},
-std::array<float,2>{0.173227757f, 0.728211582f},
-std::array<float,2>{0.894113123f, 0.212623939f},
-std::array<float,2>{0.462402105f, 0.0406168289f},
-std::array<float,2>{0.510535598f, 0.613844752f},
-std::array<float,2>{0.19068931f, 0.862325728f},
-std::array<float,2>{0.945088387f, 0.255967438f},
-std::array<float,2>{0.074492611f, 0.474864453f},
-std::array<float,2>{0.763325036f, 0.896198928f},
-std::array<float,2>{0.354087412f, 0.668016255f},
-std::array<float,2>{0.6506055f, 0.164736584f},
-std::array<float,2>{0.139056399f, 0.232529283f},
-std::array<float,2>{0.927364171f, 0.691120982f},
-std::array<float,2>{0.400691658f, 0.958564341f},
-std::array<float,2>{0.574134469f, 0.432911158f},
-std::array<float,2>{0.250937045f, 0.342422426f},
-std::array<float,2>{0.697208524f, 0.778628707f},
-std::array<float,2>{0.061860472f, 0.500615597f},
-std::array<float,2>{0.860701799f, 0.0955465585f},
-std::array<float,2>{0.389408767f, 0.2023983f},
-std::array<float,2>{0.584478855f, 0.736308217f},
-std::array<float,2>{0.14719674f, 0.994906843f},
-std::array<float,2>{0.909096062f, 0.38472876f},
-std::array<float,2>{0.0353381f, 0.36514318f},
-std::array<float,2>{0.84448868f, 0.783631861f},
-std::array<float,2>{0.277847856f, 0.539240837f},
-std::array<float,2>{0.706990063f, 0.0676971897f},
-std::array<float,2>{0.20907566f, 0.0271067712f},
-std::array<float,2>{0.959787607f, 0.57184273f},
-std::array<float,2>{0.452467591f, 0.833431005f},
-std::array<float,2>{0.530987442f, 0.295570731f},
-std::array<float,2>{0.365611345f, 0.442750335f},
-std::array<float,2>{0.640361309f, 0.918902397f},
-std::array<float,2>{0.080392696f, 0.634463966f},
-std::array<float,2>{0.76579684f, 0.153190434f},
-std::array<float,2>{0.310205251f, 0.123810567f},
-std::array<float,2>{0.730705738f, 0.524809957f},
-std::array<float,2>{0.010151363f, 0.757606924f},
-std::array<float,2>{0.813935816f, 0.312915891f},
-std::array<float,2>{0.156579629f, 0.416805327f},
-std::array<float,2>{0.884097576f, 0.947075486f},
-std::array<float,2>{0.435144275f, 0.718400896f},
-std::array<float,2>{0.621658027f, 0.246424675f},
-std::array<float,2>{0.121410683f, 0.172140449f},
-std::array<float,2>{0.81021595f, 0.677912593f},
-std::array<float,2>{0.324640781f, 0.886645317f},
-std::array<float,2>{0.675653279f, 0.487124532f},
-std::array<float,2>{0.486600906f, 0.280490965f},
-std::array<float,2>{0.559580743f, 0.848164141f},
-std::array<float,2>{0.234455079f, 0.604893744f},
-std::array<float,2>{0.979175448f, 0.0566951856f},
-std::array<float,2>{0.273179799f, 0.239435673f},
-std::array<float,2>{0.714102805f, 0.704796851f},
-std::array<float,2>{0.0461457409f, 0.939374864f},
-std::array<float,2>{0.854089022f, 0.413610578f},
-std::array<float,2>{0.151347667f, 0.32593444f},
-std::array<float,2>{0.918158174f, 0.761723161f},
-std::array<float,2>{0.379534632f, 0.523165345f},
-std::array<float,2>{0.586950302f, 0.116928644f},
-std::array<float,2>{0.091166243f, 0.0507785343f},
-std::array<float,2>{0.776650667f, 0.594764829f},
-std::array<float,2>{0.367471755f, 0.85905683f},
-std::array<float,2>{0.628924727f, 0.269404113f},
-std::array<float,2>{0.444902956f, 0.495354146f},
-std::array<float,2>{0.516155541f, 0.878049612f},
-std::array<float,2>{0.218191832f, 0.680048048f},
-std::array<float,2>{0.967298329f, 0.182581082f},
-std::array<float,2>{0.427595556f, 0.070457235f},
-std::array<float,2>{0.61400944f, 0.534759223f},
-std::array<float,2>{0.169232756f, 0.790462792f},
-std::array<float,2>{0.878180981f, 0.367386848f},
-std::array<float,2>{0.000526655407f, 0.378956616f},
-std::array<float,2>{0.821849823f, 0.990205467f},
-std::array<float,2>{0.298216909f, 0.743744493f},
-std::array<float,2>{0.720235109f, 0.188125193f},
-std::array<float,2>{0.242391452f, 0.145660654f},
-std::array<float,2>{0.976391375f, 0.627725899f},
-std::array<float,2>{0.499489933f, 0.911500394f},
-std::array<float,2>{0.54859364f, 0.451114655f},
-std::array<float,2>{0.317885876f, 0.288228452f},
-std::array<float,2>{0.684461951f, 0.843497574f},
-std::array<float,2>{0.113436483f, 0.565429509f},
-std::array<float,2>{0.799754262f, 0.0205766018f},
-std::array<float,2>{0.472628713f, 0.157619536f},
-std::array<float,2>{0.544190884f, 0.6632725f},
-std::array<float,2>{0.228395447f, 0.905198276f},
-std::array<float,2>{0.99123019f, 0.479636014f},
-std::array<float,2>{0.107288606f, 0.263168573f},
-std::array<float,2>{0.791647434f, 0.869623721f},
-std::array<float,2>{0.34327215f, 0.623041332f},
-std::array<float,2>{0.667191625f, 0.0349215753f},
-std::array<float,2>{0.180652231f, 0.107703947f},
-std::array<float,2>{0.89903152f, 0.511793554f},
-std::array<float,2>{0.413214743f, 0.773323894f},
-std::array<float,2>{0.600949168f, 0.333147883f},
-std::array<float,2>{0.290437549f, 0.422454208f},
-std::array<float,2>{0.735521197f, 0.967545629f},
-std::array<float,2>{0.0245811027f, 0.698059559f},
-std::array<float,2>{0.835817158f, 0.226316318f},
-std::array<float,2>{0.345399797f, 0.0134539986f},
-std::array<float,2>{0.6477772f, 0.579721689f},
-std::array<float,2>{0.0630276278f, 0.822239876f},
-std::array<float,2>{0.753265381f, 0.299122781f},
-std::array<float,2>{0.196376979f, 0.45660153f},
-std::array<float,2>{0.948355258f, 0.928206265f},
-std::array<float,2>{0.459997922f, 0.6532318f},
-std::array<float,2>{0.503921807f, 0.131608203f},
-std::array<float,2>{0.0531266332f, 0.207402766f},
-std::array<float,2>{0.871639609f, 0.722851634f},
-std::array<float,2>{0.260361552f, 0.974490285f},
-std::array<float,2>{0.694173455f, 0.4002226f},
-std::array<float,2>{0.394239783f, 0.351256847f},
-std::array<float,2>{0.565882683f, 0.811812162f},
-std::array<float,2>{0.130905166f, 0.547449887f},
-std::array<float,2>{0.935127795f, 0.078659378f},
-std::array<float,2>{0.254593045f, 0.142103702f},
-std::array<float,2>{0.702702165f, 0.630388677f},
-std::array<float,2>{0.055114951f, 0.908706188f},
-std::array<float,2>{0.864256442f, 0.449050188f},
-std::array<float,2>{0.132957712f, 0.282984585f},
-std::array<float,2>{0.924240351f, 0.839488149f},
-std::array<float,2>{0.403544545f, 0.569459498f},
-std::array<float,2>{0.5753268f, 0.0160570722f},
-std::array<float,2>{0.0724511147f, 0.075414829f},
-std::array<float,2>{0.760725975f, 0.536892354f},
-std::array<float,2>{0.359217167f, 0.795664728f},
-std::array<float,2>{0.654829204f, 0.371588618f},
-std::array<float,2>{0.467956781f, 0.377702475f},
-std::array<float,2>{0.513446271f, 0.985177338f},
-std::array<float,2>{0.191914394f, 0.747935414f},
-std::array<float,2>{0.940036952f, 0.194489092f},
-std::array<float,2>{0.417562217f, 0.0515524559f},
-std::array<float,2>{0.607543409f, 0.600258529f},
-std::array<float,2>{0.17786029f, 0.852314115f},
-std::array<float,2>{0.896927476f, 0.270904124f},
-std::array<float,2>{0.0205221903f, 0.497026622f},
-std::array<float,2>{0.836335957f, 0.881737769f},
-std::array<float,2>{0.287272662f, 0.686645985f},
-std::array<float,2>{0.743118823f, 0.186843246f},
-std::array<float,2>{0.219407722f, 0.23441574f},
-std::array<float,2>{0.99544245f, 0.708154559f},
-std::array<float,2>{0.478488266f, 0.944575071f},
-std::array<float,2>{0.533031881f, 0.409392983f},
-std::array<float,2>{0.333519042f, 0.322269797f},
-std::array<float,2>{0.661102533f, 0.760846436f},
-std::array<float,2>{0.100748517f, 0.517552316f},
-std::array<float,2>{0.788292587f, 0.111833557f},
-std::array<float,2>{0.488544971f, 0.206670418f},
-std::array<float,2>{0.55759424f, 0.719434619f},
-std::array<float,2>{0.240586817f, 0.970465481f},
-std::array<float,2>{0.980605602f, 0.402514249f},
-std::array<float,2>{0.121003017f, 0.34743011f},
-std::array<float,2>{0.807222843f, 0.808531165f},
-std::array<float,2>{0.320515454f, 0.552119553f},
-std::array<float,2>{0.67903775f, 0.0840081722f},
-std::array<float,2>{0.163033143f, 0.00921551697f},
-std::array<float,2>{0.887728453f, 0.584017754f},
-std::array<float,2>{0.433013201f, 0.827870369f},
-std::array<float,2>{0.617463589f, 0.303708971f},
-std::array<float,2>{0.307708323f, 0.459761888f},
-std::array<float,2>{0.727040231f, 0.925297916f},
-std::array<float,2>{0.0137319854f, 0.651748061f},
-std::array<float,2>{0.820290029f, 0.127366394f},
-std::array<float,2>{0.362151206f, 0.105056614f},
-std::array<float,2>{0.635497093f, 0.50942111f},
-std::array<float,2>{0.0825410634f, 0.766121805f},
-std::array<float,2>{0.77144742f, 0.328320116f},
-std::array<float,2>{0.203565598f, 0.426690638f},
-std::array<float,2>{0.95635432f, 0.962350011f},
-std::array<float,2>{0.446673036f, 0.70142585f},
-std::array<float,2>{0.524321139f, 0.220289871f},
-std::array<float,2>{0.0346981734f, 0.163690552f},
-std::array<float,2>{0.84966296f, 0.658942699f},
-std::array<float,2>{0.274868965f, 0.899656534f},
-std::array<float,2>{0.707357824f, 0.482207865f},
-std::array<float,2>{0.385133117f, 0.257992327f},
-std::array<float,2>{0.580700696f, 0.873389125f},
-std::array<float,2>{0.141141281f, 0.619150043f},
-std::array<float,2>{0.910821617f, 0.0364691615f},
-std::array<float,2>{0.312920719f, 0.226854369f},
-std::array<float,2>{0.680286527f, 0.694679856f},
-std::array<float,2>{0.111810751f, 0.956164002f},
-std::array<float,2>{0.803155243f, 0.437081814f},
-std::array<float,2>{0.248009726f, 0.336502701f},
-std::array<float,2>{0.972487748f, 0.774696946f},
-std::array<float,2>{0.493069917f, 0.504159272f},
-std::array<float,2>{0.552327394f, 0.0995222777f},
-std::array<float,2>{0.00725750625f, 0.0467244834f},
-std::array<float,2>{0.825913668f, 0.613263905f},
-std::array<float,2>{0.304625064f, 0.86587441f},
-std::array<float,2>{0.723359346f, 0.253259867f},
-std::array<float,2>{0.425392866f, 0.472256452f},
-std::array<float,2>{0.609704077f, 0.89158529f},
-std::array<float,2>{0.167509422f, 0.664349377f},
-std::array<float,2>{0.881578088f, 0.16873233f},
-std::array<float,2>{0.438268572f, 0.0882146508f},
-std::array<float,2>{0.521820366f, 0.562465847f},
-std::array<float,2>{0.211897075f, 0.803890288f},
-std::array<float,2>{0.964606524f, 0.358955741f},
-std::array<float,2>{0.0868377388f, 0.391644657f},
-std::array<float,2>{0.77918005f, 0.977888763f},
-std::array<float,2>{0.373783022f, 0.730547249f},
-std::array<float,2>{0.627772987f, 0.215703219f},
-std::array<float,2>{0.153329343f, 0.136096984f},
-std::array<float,2>{0.9146173f, 0.641803145f},
-std::array<float,2>{0.37825039f, 0.934194982f},
-std::array<float,2>{0.592600942f, 0.464215249f},
-std::array<float,2>{0.268537104f, 0.311266154f},
-std::array<float,2>{0.717643321f, 0.816810966f},
-std::array<float,2>{0.0409511551f, 0.591750205f},
-std::array<float,2>{0.856683075f, 0.00392886857f},
-std::array<float,2>{0.395318598f, 0.177384406f},
-std::array<float,2>{0.568869829f, 0.674385905f},
-std::array<float,2>{0.127770782f, 0.890180767f},
-std::array<float,2>{0.931509793f, 0.489922583f},
-std::array<float,2>{0.0502846241f, 0.275286853f},
-std::array<float,2>{0.867309391f, 0.846872151f},
-std::array<float,2>{0.262274921f, 0.609284639f},
-std::array<float,2>{0.68949604f, 0.0624401495f},
-std::array<float,2>{0.200017914f, 0.117271848f},
-std::array<float,2>{0.952344656f, 0.53012538f},
-std::array<float,2>{0.456179827f, 0.751714826f},
-std::array<float,2>{0.50008744f, 0.319736809f},
-std::array<float,2>{0.349976599f, 0.421640635f},
-std::array<float,2>{0.644181013f, 0.949252069f},
-std::array<float,2>{0.0670037642f, 0.712045789f},
-std::array<float,2>{0.754635394f, 0.245702744f},
-std::array<float,2>{0.294635236f, 0.0305054504f},
-std::array<float,2>{0.740840197f, 0.576538324f},
-std::array<float,2>{0.029085096f, 0.829330027f},
-std::array<float,2>{0.830765784f, 0.289500505f},
-std::array<float,2>{0.187131613f, 0.438517779f},
-std::array<float,2>{0.905058861f, 0.915368378f},
-std::array<float,2>{0.407619536f, 0.640355766f},
-std::array<float,2>{0.594472826f, 0.148612589f},
-std::array<float,2>{0.105406329f, 0.196262628f},
-std::array<float,2>{0.794293046f, 0.740745068f},
-std::array<float,2>{0.337428689f, 0.99814707f},
-std::array<float,2>{0.668992937f, 0.388842732f},
-std::array<float,2>{0.472984761f, 0.359789371f},
-std::array<float,2>{0.542395175f, 0.78626287f},
-std::array<float,2>{0.23220697f, 0.543273151f},
-std::array<float,2>{0.987420619f, 0.0662670359f},
-std::array<float,2>{0.352216125f, 0.167876825f},
-std::array<float,2>{0.649753511f, 0.66995734f},
-std::array<float,2>{0.0779775828f, 0.898185968f},
-std::array<float,2>{0.764444232f, 0.474603236f},
-std::array<float,2>{0.189196751f, 0.255672455f},
-std::array<float,2>{0.942945778f, 0.860762835f},
-std::array<float,2>{0.463675886f, 0.615536511f},
-std::array<float,2>{0.509764254f, 0.0417344756f},
-std::array<float,2>{0.0603175499f, 0.0963034183f},
-std::array<float,2>{0.86297971f, 0.502457559f},
-std::array<float,2>{0.25260523f, 0.780149758f},
-std::array<float,2>{0.698060155f, 0.341057777f},
-std::array<float,2>{0.39972344f, 0.431458116f},
-std::array<float,2>{0.571492016f, 0.959784985f},
-std::array<float,2>{0.138513282f, 0.68848896f},
-std::array<float,2>{0.92850405f, 0.23160468f},
-std::array<float,2>{0.480571568f, 0.0036840532f},
-std::array<float,2>{0.53544718f, 0.586017847f},
-std::array<float,2>{0.226353094f, 0.813869119f},
-std::array<float,2>{0.999513447f, 0.305498749f},
-std::array<float,2>{0.0948707312f, 0.466445178f},
-std::array<float,2>{0.783210576f, 0.93249172f},
-std::array<float,2>{0.329923064f, 0.646654963f},
-std::array<float,2>{0.659995377f, 0.140468553f},
-std::array<float,2>{0.17439644f, 0.213761911f},
-std::array<float,2>{0.891146481f, 0.730098546f},
-std::array<float,2>{0.420659274f, 0.98128438f},
-std::array<float,2>{0.60301584f, 0.396737367f},
-std::array<float,2>{0.284961969f, 0.352974862f},
-std::array<float,2>{0.749796093f, 0.799620926f},
-std::array<float,2>{0.0177010056f, 0.555933654f},
-std::array<float,2>{0.840484262f, 0.0921614692f},
-std::array<float,2>{0.435872674f, 0.248376712f},
-std::array<float,2>{0.623911083f, 0.716769099f},
-std::array<float,2>{0.159123078f, 0.949047863f},
-std::array<float,2>{0.885869801f, 0.415883809f},
-std::array<float,2>{0.00963514578f, 0.315780878f},
-std::array<float,2>{0.81568259f, 0.755798042f},
-std::array<float,2>{0.311447144f, 0.526210487f},
-std::array<float,2>{0.734199047f, 0.122972645f},
-std::array<float,2>{0.236429736f, 0.0548428223f},
-std::array<float,2>{0.976970077f, 0.602820218f},
-std::array<float,2>{0.485042423f, 0.849844813f},
-std::array<float,2>{0.561092734f, 0.27809754f},
-std::array<float,2>{0.326537013f, 0.485737145f},
-std::array<float,2>{0.672551155f, 0.884542465f},
-std::array<float,2>{0.124132112f, 0.677065969f},
-std::array<float,2>{0.811650336f, 0.175297275f},
-std::array<float,2>{0.279597104f, 0.0702522025f},
-std::array<float,2>{0.703360498f, 0.542637646f},
-std::array<float,2>{0.0375525281f, 0.782401383f},
-std::array<float,2>{0.84644717f, 0.366283745f},
-std::array<float,2>{0.145490617f, 0.385664523f},
-std::array<float,2>{0.907692552f, 0.993377268f},
-std::array<float,2>{0.388246506f, 0.736555457f},
-std::array<float,2>{0.583906472f, 0.199700341f},
-std::array<float,2>{0.0789597631f, 0.154343754f},
-std::array<float,2>{0.769023955f, 0.635936737f},
-std::array<float,2>{0.36376217f, 0.920449197f},
-std::array<float,2>{0.637796402f, 0.444007218f},
-std::array<float,2>{0.449350715f, 0.294775516f},
-std::array<float,2>{0.52831018f, 0.83583492f},
-std::array<float,2>{0.207108915f, 0.572693706f},
-std::array<float,2>{0.958939254f, 0.0236413591f},
-std::array<float,2>{0.298928648f, 0.19068554f},
-std::array<float,2>{0.722157776f, 0.744964004f},
-std::array<float,2>{0.00367367663f, 0.991134822f},
-std::array<float,2>{0.823249996f, 0.382076234f},
-std::array<float,2>{0.171053097f, 0.36943838f},
-std::array<float,2>{0.876803875f, 0.792823851f},
-std::array<float,2>{0.429397225f, 0.53282851f},
-std::array<float,2>{0.61583364f, 0.0733636767f},
-std::array<float,2>{0.115340792f, 0.0218496248f},
-std::array<float,2>{0.798264027f, 0.563989282f},
-std::array<float,2>{0.318505585f, 0.84039855f},
-std::array<float,2>{0.685654581f, 0.286624849f},
-std::array<float,2>{0.496171325f, 0.452814996f},
-std::array<float,2>{0.549459457f, 0.913311303f},
-std::array<float,2>{0.245664075f, 0.625598073f},
-std::array<float,2>{0.973586082f, 0.147580534f},
-std::array<float,2>{0.38268435f, 0.114444837f},
-std::array<float,2>{0.589092374f, 0.521097362f},
-std::array<float,2>{0.14894864f, 0.764172554f},
-std::array<float,2>{0.921714962f, 0.327205986f},
-std::array<float,2>{0.0445852205f, 0.410341173f},
-std::array<float,2>{0.852681279f, 0.940983713f},
-std::array<float,2>{0.269628793f, 0.705457747f},
-std::array<float,2>{0.712117851f, 0.241769567f},
-std::array<float,2>{0.216571912f, 0.18039389f},
-std::array<float,2>{0.966720581f, 0.6816594f},
-std::array<float,2>{0.443104476f, 0.876318634f},
-std::array<float,2>{0.519475639f, 0.493961334f},
-std::array<float,2>{0.370993882f, 0.267506719f},
-std::array<float,2>{0.631162226f, 0.85731262f},
-std::array<float,2>{0.0925968364f, 0.596791446f},
-std::array<float,2>{0.775298953f, 0.0477318689f},
-std::array<float,2>{0.457994074f, 0.129439726f},
-std::array<float,2>{0.506218553f, 0.654327333f},
-std::array<float,2>{0.19766514f, 0.927354038f},
-std::array<float,2>{0.945776582f, 0.454959005f},
-std::array<float,2>{0.0648572296f, 0.297200084f},
-std::array<float,2>{0.75187403f, 0.824152768f},
-std::array<float,2>{0.347195476f, 0.582002819f},
-std::array<float,2>{0.646342337f, 0.0155979693f},
-std::array<float,2>{0.129441619f, 0.0818035752f},
-std::array<float,2>{0.936515749f, 0.548913479f},
-std::array<float,2>{0.390793443f, 0.809699833f},
-std::array<float,2>{0.563457429f, 0.348595202f},
-std::array<float,2>{0.259098798f, 0.401417851f},
-std::array<float,2>{0.692175329f, 0.97595048f},
-std::array<float,2>{0.051049035f, 0.725644469f},
-std::array<float,2>{0.874826968f, 0.209374413f},
-std::array<float,2>{0.341442853f, 0.0329538919f},
-std::array<float,2>{0.665959835f, 0.624310732f},
-std::array<float,2>{0.108353376f, 0.869082749f},
-std::array<float,2>{0.790336609f, 0.264687628f},
-std::array<float,2>{0.229040772f, 0.47712782f},
-std::array<float,2>{0.988717973f, 0.903627634f},
-std::array<float,2>{0.46911037f, 0.660544217f},
-std::array<float,2>{0.54542917f, 0.159829557f},
-std::array<float,2>{0.026848508f, 0.223419085f},
-std::array<float,2>{0.833113313f, 0.696618199f},
-std::array<float,2>{0.291429728f, 0.964971721f},
-std::array<float,2>{0.738203347f, 0.423989683f},
-std::array<float,2>{0.410405636f, 0.334358215f},
-std::array<float,2>{0.599066556f, 0.770302415f},
-std::array<float,2>{0.182649389f, 0.514591575f},
-std::array<float,2>{0.901243687f, 0.107020423f},
-std::array<float,2>{0.305266112f, 0.128111288f},
-std::array<float,2>{0.729665995f, 0.650862634f},
-std::array<float,2>{0.0135875735f, 0.924499393f},
-std::array<float,2>{0.817591667f, 0.460145414f},
-std::array<float,2>{0.161925614f, 0.304193854f},
-std::array<float,2>{0.88895762f, 0.826435208f},
-std::array<float,2>{0.431220621f, 0.585368752f},
-std::array<float,2>{0.619486392f, 0.00827319361f},
-std::array<float,2>{0.117910638f, 0.0851223171f},
-std::array<float,2>{0.80568707f, 0.550881267f},
-std::array<float,2>{0.323671132f, 0.806943238f},
-std::array<float,2>{0.676063597f, 0.346452922f},
-std::array<float,2>{0.491175175f, 0.404055476f},
-std::array<float,2>{0.556138754f, 0.96887666f},
-std::array<float,2>{0.238682747f, 0.720078766f},
-std::array<float,2>{0.983758748f, 0.205825418f},
-std::array<float,2>{0.383576572f, 0.0352927335f},
-std::array<float,2>{0.579071105f, 0.620644271f},
-std::array<float,2>{0.142991602f, 0.874642432f},
-std::array<float,2>{0.913105249f, 0.259258389f},
-std::array<float,2>{0.0329236984f, 0.481338501f},
-std::array<float,2>{0.847929776f, 0.899205744f},
-std::array<float,2>{0.276143044f, 0.659184813f},
-std::array<float,2>{0.710189939f, 0.162762329f},
-std::array<float,2>{0.206836149f, 0.219183028f},
-std::array<float,2>{0.954956293f, 0.70304215f},
-std::array<float,2>{0.448707968f, 0.961845398f},
-std::array<float,2>{0.527022719f, 0.42693913f},
-std::array<float,2>{0.359526217f, 0.329734296f},
-std::array<float,2>{0.633715868f, 0.767099738f},
-std::array<float,2>{0.0846187696f, 0.508460402f},
-std::array<float,2>{0.772165f, 0.10432747f},
-std::array<float,2>{0.465853125f, 0.193998575f},
-std::array<float,2>{0.514141858f, 0.746351004f},
-std::array<float,2>{0.193965003f, 0.985781074f},
-std::array<float,2>{0.938271403f, 0.378412127f},
-std::array<float,2>{0.0703961551f, 0.372312427f},
-std::array<float,2>{0.75802511f, 0.796472788f},
-std::array<float,2>{0.356743276f, 0.535389185f},
-std::array<float,2>{0.65234822f, 0.074858889f},
-std::array<float,2>{0.13637729f, 0.0174075868f},
-std::array<float,2>{0.922913194f, 0.568672121f},
-std::array<float,2>{0.405269563f, 0.838611603f},
-std::array<float,2>{0.576566219f, 0.281427383f},
-std::array<float,2>{0.257447898f, 0.447971314f},
-std::array<float,2>{0.699423134f, 0.909716845f},
-std::array<float,2>{0.0576876998f, 0.62978214f},
-std::array<float,2>{0.866895795f, 0.14145951f},
-std::array<float,2>{0.334990233f, 0.112486631f},
-std::array<float,2>{0.662414968f, 0.516420901f},
-std::array<float,2>{0.0983333662f, 0.760502338f},
-std::array<float,2>{0.786571503f, 0.323379487f},
-std::array<float,2>{0.222295418f, 0.408868849f},
-std::array<float,2>{0.992690206f, 0.944144607f},
-std::array<float,2>{0.479905963f, 0.707702637f},
-std::array<float,2>{0.533755958f, 0.23582226f},
-std::array<float,2>{0.0216905773f, 0.186315238f},
-std::array<float,2>{0.838490665f, 0.685935974f},
-std::array<float,2>{0.286874413f, 0.882792592f},
-std::array<float,2>{0.745125771f, 0.497799695f},
-std::array<float,2>{0.41568011f, 0.269940108f},
-std::array<float,2>{0.607174575f, 0.852910101f},
-std::array<float,2>{0.176461741f, 0.600931227f},
-std::array<float,2>{0.895850718f, 0.0525036752f},
-std::array<float,2>{0.34912622f, 0.244518444f},
-std::array<float,2>{0.642153084f, 0.711236119f},
-std::array<float,2>{0.0694095269f, 0.950266182f},
-std::array<float,2>{0.756512821f, 0.420762241f},
-std::array<float,2>{0.201491654f, 0.318561286f},
-std::array<float,2>{0.95044452f, 0.750955641f},
-std::array<float,2>{0.453228384f, 0.531073272f},
-std::array<float,2>{0.503409922f, 0.119132839f},
-std::array<float,2>{0.047140453f, 0.0606398508f},
-std::array<float,2>{0.870750904f, 0.607422054f},
-std::array<float,2>{0.264439374f, 0.846571863f},
-std::array<float,2>{0.688065886f, 0.273780614f},
-std::array<float,2>{0.396547288f, 0.489247948f},
-std::array<float,2>{0.567397058f, 0.889513254f},
-std::array<float,2>{0.126333952f, 0.674870849f},
-std::array<float,2>{0.93176496f, 0.176369697f},
-std::array<float,2>{0.475214034f, 0.0649287701f},
-std::array<float,2>{0.539925396f, 0.544179916f},
-std::array<float,2>{0.233688593f, 0.785389006f},
-std::array<float,2>{0.984859645f, 0.360762745f},
-std::array<float,2>{0.102207661f, 0.390327394f},
-std::array<float,2>{0.795594931f, 0.999599874f},
-std::array<float,2>{0.338241786f, 0.741975725f},
-std::array<float,2>{0.671343565f, 0.197146237f},
-std::array<float,2>{0.183646843f, 0.150215268f},
-std::array<float,2>{0.904197454f, 0.63932693f},
-std::array<float,2>{0.410016f, 0.914927423f},
-std::array<float,2>{0.596000612f, 0.437507033f},
-std::array<float,2>{0.29584077f, 0.290471703f},
-std::array<float,2>{0.738935351f, 0.828964472f},
-std::array<float,2>{0.0296261087f, 0.577491462f},
-std::array<float,2>{0.828809083f, 0.0296229906f},
-std::array<float,2>{0.422939658f, 0.169658437f},
-std::array<float,2>{0.612371266f, 0.665471554f},
-std::array<float,2>{0.165271804f, 0.892065585f},
-std::array<float,2>{0.879705667f, 0.47165069f},
-std::array<float,2>{0.00450247619f, 0.252923429f},
-std::array<float,2>{0.826875091f, 0.867176473f},
-std::array<float,2>{0.301590681f, 0.612078667f},
-std::array<float,2>{0.72546494f, 0.0451705903f},
-std::array<float,2>{0.248643801f, 0.0984771624f},
-std::array<float,2>{0.969049513f, 0.505404413f},
-std::array<float,2>{0.494225174f, 0.774094582f},
-std::array<float,2>{0.553186178f, 0.337681919f},
-std::array<float,2>{0.31637165f, 0.43584463f},
-std::array<float,2>{0.683026195f, 0.955139816f},
-std::array<float,2>{0.110299237f, 0.693763435f},
-std::array<float,2>{0.80270499f, 0.228432328f},
-std::array<float,2>{0.266066372f, 0.00514985342f},
-std::array<float,2>{0.71612376f, 0.590361416f},
-std::array<float,2>{0.0415327102f, 0.81750232f},
-std::array<float,2>{0.857635677f, 0.312459081f},
-std::array<float,2>{0.156194001f, 0.463414013f},
-std::array<float,2>{0.916675091f, 0.934804559f},
-std::array<float,2>{0.375151694f, 0.640808821f},
-std::array<float,2>{0.590159476f, 0.134847313f},
-std::array<float,2>{0.0881632343f, 0.216641739f},
-std::array<float,2>{0.779384494f, 0.731642127f},
-std::array<float,2>{0.372242272f, 0.977478325f},
-std::array<float,2>{0.625474751f, 0.391106039f},
-std::array<float,2>{0.439746737f, 0.35746035f},
-std::array<float,2>{0.520166934f, 0.802878261f},
-std::array<float,2>{0.214640602f, 0.560948789f},
-std::array<float,2>{0.961001813f, 0.0896149725f},
-std::array<float,2>{0.325238794f, 0.174050048f},
-std::array<float,2>{0.674067676f, 0.676455617f},
-std::array<float,2>{0.122199945f, 0.883344114f},
-std::array<float,2>{0.808687985f, 0.484502196f},
-std::array<float,2>{0.235949069f, 0.27904278f},
-std::array<float,2>{0.980048478f, 0.851417422f},
-std::array<float,2>{0.487712473f, 0.601567507f},
-std::array<float,2>{0.559134066f, 0.0558748804f},
-std::array<float,2>{0.0114049008f, 0.121803999f},
-std::array<float,2>{0.813031256f, 0.52696991f},
-std::array<float,2>{0.309076607f, 0.754857957f},
-std::array<float,2>{0.731842339f, 0.314569145f},
-std::array<float,2>{0.434227705f, 0.414533764f},
-std::array<float,2>{0.622552693f, 0.947713256f},
-std::array<float,2>{0.157286122f, 0.714946568f},
-std::array<float,2>{0.883042634f, 0.249953657f},
-std::array<float,2>{0.452088714f, 0.0252778158f},
-std::array<float,2>{0.530186236f, 0.573777199f},
-std::array<float,2>{0.210446715f, 0.834098577f},
-std::array<float,2>{0.960332632f, 0.293042213f},
-std::array<float,2>{0.0819929242f, 0.444397509f},
-std::array<float,2>{0.767255902f, 0.921724081f},
-std::array<float,2>{0.366917849f, 0.635465145f},
-std::array<float,2>{0.638776183f, 0.155932412f},
-std::array<float,2>{0.147935674f, 0.2005703f},
-std::array<float,2>{0.909460723f, 0.737775087f},
-std::array<float,2>{0.389759183f, 0.992189169f},
-std::array<float,2>{0.585803568f, 0.386550069f},
-std::array<float,2>{0.278909773f, 0.365287691f},
-std::array<float,2>{0.705713809f, 0.78166008f},
-std::array<float,2>{0.0367813632f, 0.541343808f},
-std::array<float,2>{0.845367849f, 0.0686193109f},
-std::array<float,2>{0.401846856f, 0.231349915f},
-std::array<float,2>{0.572435975f, 0.687537611f},
-std::array<float,2>{0.139911115f, 0.960825622f},
-std::array<float,2>{0.926702499f, 0.430356324f},
-std::array<float,2>{0.0615159608f, 0.339914292f},
-std::array<float,2>{0.859838605f, 0.781034529f},
-std::array<float,2>{0.251214743f, 0.503447115f},
-std::array<float,2>{0.695647478f, 0.0968689695f},
-std::array<float,2>{0.190409258f, 0.0422533378f},
-std::array<float,2>{0.944111228f, 0.617140889f},
-std::array<float,2>{0.461484641f, 0.859595478f},
-std::array<float,2>{0.510912061f, 0.253924668f},
-std::array<float,2>{0.35498938f, 0.472757548f},
-std::array<float,2>{0.652118146f, 0.896492064f},
-std::array<float,2>{0.0752936825f, 0.671636164f},
-std::array<float,2>{0.762455881f, 0.166454315f},
-std::array<float,2>{0.282368511f, 0.0928632319f},
-std::array<float,2>{0.746197462f, 0.555430114f},
-std::array<float,2>{0.0161676593f, 0.800103188f},
-std::array<float,2>{0.843002141f, 0.352465212f},
-std::array<float,2>{0.172652394f, 0.397911996f},
-std::array<float,2>{0.893027544f, 0.98199302f},
-std::array<float,2>{0.419872075f, 0.728994787f},
-std::array<float,2>{0.603551209f, 0.214721873f},
-std::array<float,2>{0.097450532f, 0.13949129f},
-std::array<float,2>{0.781568587f, 0.648030758f},
-std::array<float,2>{0.331310391f, 0.932631671f},
-std::array<float,2>{0.657564819f, 0.465602368f},
-std::array<float,2>{0.483158648f, 0.306168675f},
-std::array<float,2>{0.538451314f, 0.812751472f},
-std::array<float,2>{0.224435821f, 0.587382972f},
-std::array<float,2>{0.996798098f, 0.00263364031f},
-std::array<float,2>{0.261114776f, 0.210883036f},
-std::array<float,2>{0.694852054f, 0.725148976f},
-std::array<float,2>{0.0542105883f, 0.975290179f},
-std::array<float,2>{0.873016119f, 0.401165783f},
-std::array<float,2>{0.131951511f, 0.348704249f},
-std::array<float,2>{0.933788776f, 0.809264004f},
-std::array<float,2>{0.392972529f, 0.550060451f},
-std::array<float,2>{0.564519823f, 0.0808813274f},
-std::array<float,2>{0.0639403611f, 0.0137871271f},
-std::array<float,2>{0.752036393f, 0.580335677f},
-std::array<float,2>{0.3442913f, 0.823081672f},
-std::array<float,2>{0.646630049f, 0.297886133f},
-std::array<float,2>{0.459310681f, 0.453523785f},
-std::array<float,2>{0.505561709f, 0.926469684f},
-std::array<float,2>{0.195440784f, 0.655429482f},
-std::array<float,2>{0.947888076f, 0.130632401f},
-std::array<float,2>{0.412624627f, 0.105507158f},
-std::array<float,2>{0.600383639f, 0.514722586f},
-std::array<float,2>{0.180965468f, 0.771282256f},
-std::array<float,2>{0.899484813f, 0.335661769f},
-std::array<float,2>{0.0236128252f, 0.425027013f},
-std::array<float,2>{0.834074914f, 0.966384113f},
-std::array<float,2>{0.289873928f, 0.695853412f},
-std::array<float,2>{0.735134661f, 0.224199921f},
-std::array<float,2>{0.22718294f, 0.158292398f},
-std::array<float,2>{0.990247607f, 0.661155164f},
-std::array<float,2>{0.471624285f, 0.903280854f},
-std::array<float,2>{0.543224871f, 0.478010297f},
-std::array<float,2>{0.342743456f, 0.263695061f},
-std::array<float,2>{0.666059732f, 0.868009329f},
-std::array<float,2>{0.106360853f, 0.623197436f},
-std::array<float,2>{0.792708337f, 0.0317516215f},
-std::array<float,2>{0.498489827f, 0.147234038f},
-std::array<float,2>{0.547524452f, 0.626824498f},
-std::array<float,2>{0.244073406f, 0.913054883f},
-std::array<float,2>{0.975544512f, 0.452116102f},
-std::array<float,2>{0.114432044f, 0.285438865f},
-std::array<float,2>{0.800409675f, 0.841593146f},
-std::array<float,2>{0.316780418f, 0.563427389f},
-std::array<float,2>{0.685158551f, 0.0228073932f},
-std::array<float,2>{0.168134838f, 0.0725072399f},
-std::array<float,2>{0.877229214f, 0.531261921f},
-std::array<float,2>{0.426424533f, 0.791301012f},
-std::array<float,2>{0.614885449f, 0.370965719f},
-std::array<float,2>{0.297767043f, 0.381000549f},
-std::array<float,2>{0.719196856f, 0.99202925f},
-std::array<float,2>{0.00124638644f, 0.745759428f},
-std::array<float,2>{0.820852578f, 0.189690515f},
-std::array<float,2>{0.368755251f, 0.0478973277f},
-std::array<float,2>{0.630805373f, 0.595907092f},
-std::array<float,2>{0.0908092856f, 0.85619247f},
-std::array<float,2>{0.776225865f, 0.265872389f},
-std::array<float,2>{0.2170645f, 0.492568702f},
-std::array<float,2>{0.96859175f, 0.875931978f},
-std::array<float,2>{0.443589419f, 0.683177114f},
-std::array<float,2>{0.516896307f, 0.180997685f},
-std::array<float,2>{0.0458092541f, 0.240308151f},
-std::array<float,2>{0.855360687f, 0.706558168f},
-std::array<float,2>{0.271510065f, 0.940250397f},
-std::array<float,2>{0.713097036f, 0.411235213f},
-std::array<float,2>{0.380786568f, 0.326506108f},
-std::array<float,2>{0.585967541f, 0.764805973f},
-std::array<float,2>{0.151966527f, 0.520328104f},
-std::array<float,2>{0.919551432f, 0.113861755f},
-std::array<float,2>{0.274195075f, 0.161606923f},
-std::array<float,2>{0.708693326f, 0.656749964f},
-std::array<float,2>{0.0340662301f, 0.901730001f},
-std::array<float,2>{0.850974083f, 0.483139157f},
-std::array<float,2>{0.14222537f, 0.259979606f},
-std::array<float,2>{0.911481321f, 0.872877121f},
-std::array<float,2>{0.386422306f, 0.617450535f},
-std::array<float,2>{0.581595123f, 0.0374592058f},
-std::array<float,2>{0.0835438147f, 0.103102423f},
-std::array<float,2>{0.77031517f, 0.510156631f},
-std::array<float,2>{0.362450749f, 0.768434405f},
-std::array<float,2>{0.636365473f, 0.331995547f},
-std::array<float,2>{0.445568651f, 0.429032922f},
-std::array<float,2>{0.524783313f, 0.963465333f},
-std::array<float,2>{0.204813227f, 0.69929862f},
-std::array<float,2>{0.955195129f, 0.222007707f},
-std::array<float,2>{0.431681484f, 0.0116364658f},
-std::array<float,2>{0.618571937f, 0.583087385f},
-std::array<float,2>{0.163207382f, 0.825725079f},
-std::array<float,2>{0.886998534f, 0.301313639f},
-std::array<float,2>{0.0154595049f, 0.458049536f},
-std::array<float,2>{0.819224179f, 0.922497034f},
-std::array<float,2>{0.30726859f, 0.650091529f},
-std::array<float,2>{0.72785151f, 0.126370415f},
-std::array<float,2>{0.242025226f, 0.203846604f},
-std::array<float,2>{0.981517136f, 0.721807361f},
-std::array<float,2>{0.489259988f, 0.971055686f},
-std::array<float,2>{0.558158278f, 0.405320704f},
-std::array<float,2>{0.321933776f, 0.343844384f},
-std::array<float,2>{0.67784375f, 0.80620116f},
-std::array<float,2>{0.120063677f, 0.5531739f},
-std::array<float,2>{0.807946324f, 0.0838195533f},
-std::array<float,2>{0.477384895f, 0.236979112f},
-std::array<float,2>{0.53162539f, 0.710830927f},
-std::array<float,2>{0.220215842f, 0.942386746f},
-std::array<float,2>{0.994526565f, 0.40794459f},
-std::array<float,2>{0.0997639224f, 0.322156847f},
-std::array<float,2>{0.787550569f, 0.758420885f},
-std::array<float,2>{0.332857728f, 0.517649114f},
-std::array<float,2>{0.661212564f, 0.110192664f},
-std::array<float,2>{0.179225028f, 0.0539191589f},
-std::array<float,2>{0.898308575f, 0.598192394f},
-std::array<float,2>{0.416948706f, 0.855179012f},
-std::array<float,2>{0.608501136f, 0.273168743f},
-std::array<float,2>{0.288368493f, 0.499871969f},
-std::array<float,2>{0.743996382f, 0.880283833f},
-std::array<float,2>{0.0199208483f, 0.685239315f},
-std::array<float,2>{0.837136328f, 0.183737278f},
-std::array<float,2>{0.357580304f, 0.0780383274f},
-std::array<float,2>{0.656135738f, 0.537477076f},
-std::array<float,2>{0.0741008446f, 0.793802321f},
-std::array<float,2>{0.761035919f, 0.373343766f},
-std::array<float,2>{0.193271145f, 0.376893014f},
-std::array<float,2>{0.941147208f, 0.986780345f},
-std::array<float,2>{0.467155486f, 0.748124182f},
-std::array<float,2>{0.512589812f, 0.193063751f},
-std::array<float,2>{0.0563325137f, 0.142801881f},
-std::array<float,2>{0.864475012f, 0.632083535f},
-std::array<float,2>{0.255496323f, 0.906887949f},
-std::array<float,2>{0.701614618f, 0.445381463f},
-std::array<float,2>{0.402824879f, 0.285077423f},
-std::array<float,2>{0.574925125f, 0.836470068f},
-std::array<float,2>{0.134183824f, 0.567673028f},
-std::array<float,2>{0.925641596f, 0.0188475605f},
-std::array<float,2>{0.335971206f, 0.198011681f},
-std::array<float,2>{0.668617487f, 0.739341795f},
-std::array<float,2>{0.104250886f, 0.997277081f},
-std::array<float,2>{0.793393612f, 0.387455314f},
-std::array<float,2>{0.231366545f, 0.361647129f},
-std::array<float,2>{0.986504972f, 0.78740859f},
-std::array<float,2>{0.474045247f, 0.5456146f},
-std::array<float,2>{0.54156357f, 0.0625010133f},
-std::array<float,2>{0.0283024497f, 0.0285657588f},
-std::array<float,2>{0.831934631f, 0.576133966f},
-std::array<float,2>{0.293527424f, 0.831090868f},
-std::array<float,2>{0.741433561f, 0.292851597f},
-std::array<float,2>{0.406366199f, 0.440995961f},
-std::array<float,2>{0.595446229f, 0.917113543f},
-std::array<float,2>{0.18608743f, 0.637716472f},
-std::array<float,2>{0.905532181f, 0.151247188f},
-std::array<float,2>{0.456005663f, 0.120131187f},
-std::array<float,2>{0.501411557f, 0.527933598f},
-std::array<float,2>{0.200976223f, 0.752486587f},
-std::array<float,2>{0.951659501f, 0.316855252f},
-std::array<float,2>{0.0682044327f, 0.419544578f},
-std::array<float,2>{0.755300522f, 0.952136338f},
-std::array<float,2>{0.351163357f, 0.714831352f},
-std::array<float,2>{0.643429756f, 0.24363701f},
-std::array<float,2>{0.128675833f, 0.177820146f},
-std::array<float,2>{0.930192471f, 0.673083425f},
-std::array<float,2>{0.396127075f, 0.888666093f},
-std::array<float,2>{0.569819272f, 0.491339326f},
-std::array<float,2>{0.263282269f, 0.275612265f},
-std::array<float,2>{0.690514922f, 0.845604599f},
-std::array<float,2>{0.0490077622f, 0.60699898f},
-std::array<float,2>{0.86831218f, 0.0597927906f},
-std::array<float,2>{0.377064794f, 0.132861227f},
-std::array<float,2>{0.593187869f, 0.643221617f},
-std::array<float,2>{0.152774602f, 0.936291337f},
-std::array<float,2>{0.915165305f, 0.461090773f},
-std::array<float,2>{0.0397469774f, 0.309691548f},
-std::array<float,2>{0.856054127f, 0.819491863f},
-std::array<float,2>{0.26948759f, 0.593273699f},
-std::array<float,2>{0.718247712f, 0.00718751037f},
-std::array<float,2>{0.212551281f, 0.0863810629f},
-std::array<float,2>{0.963773668f, 0.559649348f},
-std::array<float,2>{0.439166367f, 0.801082015f},
-std::array<float,2>{0.522518456f, 0.355748415f},
-std::array<float,2>{0.374940813f, 0.394355029f},
-std::array<float,2>{0.628868937f, 0.978934109f},
-std::array<float,2>{0.0871418342f, 0.732963383f},
-std::array<float,2>{0.777404606f, 0.216797769f},
-std::array<float,2>{0.302945107f, 0.043283619f},
-std::array<float,2>{0.724292636f, 0.610641599f},
-std::array<float,2>{0.00624600658f, 0.863933384f},
-std::array<float,2>{0.824653983f, 0.251692921f},
-std::array<float,2>{0.166480362f, 0.470376343f},
-std::array<float,2>{0.882533729f, 0.893236339f},
-std::array<float,2>{0.424263507f, 0.66633445f},
-std::array<float,2>{0.610815942f, 0.171102762f},
-std::array<float,2>{0.112858519f, 0.229509264f},
-std::array<float,2>{0.804028571f, 0.69328773f},
-std::array<float,2>{0.314257443f, 0.95347327f},
-std::array<float,2>{0.681580544f, 0.43535924f},
-std::array<float,2>{0.493180782f, 0.339057654f},
-std::array<float,2>{0.551148951f, 0.776402056f},
-std::array<float,2>{0.246473849f, 0.507090926f},
-std::array<float,2>{0.970859885f, 0.100423239f},
-std::array<float,2>{0.365142614f, 0.154135391f},
-std::array<float,2>{0.636928201f, 0.633202314f},
-std::array<float,2>{0.0799075216f, 0.919034243f},
-std::array<float,2>{0.767867088f, 0.442099661f},
-std::array<float,2>{0.208936289f, 0.29626596f},
-std::array<float,2>{0.957536101f, 0.832051933f},
-std::array<float,2>{0.450751185f, 0.571204543f},
-std::array<float,2>{0.528659344f, 0.0257863626f},
-std::array<float,2>{0.0386123769f, 0.0670842901f},
-std::array<float,2>{0.846706688f, 0.54049474f},
-std::array<float,2>{0.281065047f, 0.785063386f},
-std::array<float,2>{0.704439163f, 0.364225477f},
-std::array<float,2>{0.387317896f, 0.383402705f},
-std::array<float,2>{0.582688868f, 0.995728374f},
-std::array<float,2>{0.145757049f, 0.734811485f},
-std::array<float,2>{0.907021463f, 0.202142254f},
-std::array<float,2>{0.486069679f, 0.0579881817f},
-std::array<float,2>{0.561630905f, 0.603616834f},
-std::array<float,2>{0.237777308f, 0.848703265f},
-std::array<float,2>{0.977632403f, 0.280253798f},
-std::array<float,2>{0.123415016f, 0.487831086f},
-std::array<float,2>{0.810923874f, 0.885250807f},
-std::array<float,2>{0.328041583f, 0.678958416f},
-std::array<float,2>{0.673399746f, 0.173145026f},
-std::array<float,2>{0.159508377f, 0.247279584f},
-std::array<float,2>{0.885381341f, 0.717675984f},
-std::array<float,2>{0.437065005f, 0.945753336f},
-std::array<float,2>{0.624938071f, 0.41737932f},
-std::array<float,2>{0.312280506f, 0.314244986f},
-std::array<float,2>{0.732855439f, 0.756070077f},
-std::array<float,2>{0.0087059075f, 0.523889542f},
-std::array<float,2>{0.814849555f, 0.124306045f},
-std::array<float,2>{0.421703637f, 0.211151332f},
-std::array<float,2>{0.601647854f, 0.726684868f},
-std::array<float,2>{0.175476447f, 0.983092725f},
-std::array<float,2>{0.891824663f, 0.396366268f},
-std::array<float,2>{0.0186971221f, 0.354868352f},
-std::array<float,2>{0.841714084f, 0.798344553f},
-std::array<float,2>{0.28347525f, 0.556766927f},
-std::array<float,2>{0.748282015f, 0.0910754129f},
-std::array<float,2>{0.225542203f, 0.00144068745f},
-std::array<float,2>{0.998739898f, 0.588991821f},
-std::array<float,2>{0.481808454f, 0.815716863f},
-std::array<float,2>{0.537085474f, 0.308155596f},
-std::array<float,2>{0.328416228f, 0.466915548f},
-std::array<float,2>{0.658727884f, 0.930637181f},
-std::array<float,2>{0.094271563f, 0.645605981f},
-std::array<float,2>{0.78491354f, 0.136949793f},
-std::array<float,2>{0.253076375f, 0.0944891796f},
-std::array<float,2>{0.698872209f, 0.501290321f},
-std::array<float,2>{0.0593781285f, 0.777554274f},
-std::array<float,2>{0.861726999f, 0.343514293f},
-std::array<float,2>{0.136912107f, 0.432489395f},
-std::array<float,2>{0.929218233f, 0.957369149f},
-std::array<float,2>{0.398558676f, 0.690328121f},
-std::array<float,2>{0.57071352f, 0.233678028f},
-std::array<float,2>{0.0766116008f, 0.165995181f},
-std::array<float,2>{0.764674485f, 0.668985546f},
-std::array<float,2>{0.352660686f, 0.895017445f},
-std::array<float,2>{0.649215162f, 0.475977212f},
-std::array<float,2>{0.464045793f, 0.257687688f},
-std::array<float,2>{0.507856488f, 0.861935914f},
-std::array<float,2>{0.187806129f, 0.614481926f},
-std::array<float,2>{0.941660464f, 0.0390672721f},
-std::array<float,2>{0.29262951f, 0.225151286f},
-std::array<float,2>{0.736715019f, 0.699047923f},
-std::array<float,2>{0.025791809f, 0.968631327f},
-std::array<float,2>{0.832168996f, 0.423185796f},
-std::array<float,2>{0.182423845f, 0.332854927f},
-std::array<float,2>{0.901654005f, 0.772057593f},
-std::array<float,2>{0.411220223f, 0.513523877f},
-std::array<float,2>{0.598015845f, 0.108461648f},
-std::array<float,2>{0.108848616f, 0.0338458754f},
-std::array<float,2>{0.789853692f, 0.621231794f},
-std::array<float,2>{0.340817094f, 0.870653987f},
-std::array<float,2>{0.6644063f, 0.26241231f},
-std::array<float,2>{0.469977558f, 0.478605241f},
-std::array<float,2>{0.54667151f, 0.905824423f},
-std::array<float,2>{0.229969546f, 0.662437916f},
-std::array<float,2>{0.990010381f, 0.156446442f},
-std::array<float,2>{0.392499179f, 0.0794838145f},
-std::array<float,2>{0.563944161f, 0.54818666f},
-std::array<float,2>{0.130100608f, 0.810913086f},
-std::array<float,2>{0.936837375f, 0.349848986f},
-std::array<float,2>{0.0522010997f, 0.398832321f},
-std::array<float,2>{0.873069227f, 0.97322768f},
-std::array<float,2>{0.258341491f, 0.724099517f},
-std::array<float,2>{0.693183005f, 0.208130434f},
-std::array<float,2>{0.198520258f, 0.132383972f},
-std::array<float,2>{0.946931005f, 0.653483689f},
-std::array<float,2>{0.458651096f, 0.929324448f},
-std::array<float,2>{0.507448316f, 0.455542713f},
-std::array<float,2>{0.345909655f, 0.300185949f},
-std::array<float,2>{0.645495951f, 0.820462406f},
-std::array<float,2>{0.0663148016f, 0.578564882f},
-std::array<float,2>{0.750625849f, 0.0123855928f},
-std::array<float,2>{0.442222178f, 0.182921842f},
-std::array<float,2>{0.517699242f, 0.681439817f},
-std::array<float,2>{0.215671554f, 0.877579093f},
-std::array<float,2>{0.96540755f, 0.495000958f},
-std::array<float,2>{0.0935987607f, 0.26823473f},
-std::array<float,2>{0.774155259f, 0.857430756f},
-std::array<float,2>{0.369822979f, 0.59457016f},
-std::array<float,2>{0.632795215f, 0.0497927852f},
-std::array<float,2>{0.150108337f, 0.116098419f},
-std::array<float,2>{0.920038104f, 0.522386074f},
-std::array<float,2>{0.381199181f, 0.763500273f},
-std::array<float,2>{0.588127077f, 0.324584961f},
-std::array<float,2>{0.271163195f, 0.412875354f},
-std::array<float,2>{0.711190581f, 0.937696755f},
-std::array<float,2>{0.0438419245f, 0.703583121f},
-std::array<float,2>{0.852039695f, 0.238297477f},
-std::array<float,2>{0.319568545f, 0.0195962936f},
-std::array<float,2>{0.687282026f, 0.565881014f},
-std::array<float,2>{0.116585426f, 0.842154503f},
-std::array<float,2>{0.797308028f, 0.287507296f},
-std::array<float,2>{0.244200915f, 0.449412405f},
-std::array<float,2>{0.974442601f, 0.911051095f},
-std::array<float,2>{0.497102469f, 0.62873441f},
-std::array<float,2>{0.549816966f, 0.14526099f},
-std::array<float,2>{0.00198800419f, 0.188656539f},
-std::array<float,2>{0.822518587f, 0.742453337f},
-std::array<float,2>{0.300486863f, 0.989189625f},
-std::array<float,2>{0.721145332f, 0.380130351f},
-std::array<float,2>{0.428666681f, 0.368881196f},
-std::array<float,2>{0.616832793f, 0.789191663f},
-std::array<float,2>{0.170023397f, 0.533769727f},
-std::array<float,2>{0.875383675f, 0.0715115815f},
-std::array<float,2>{0.300899416f, 0.171797544f},
-std::array<float,2>{0.724966943f, 0.666620791f},
-std::array<float,2>{0.0040420033f, 0.89304179f},
-std::array<float,2>{0.826420605f, 0.469993562f},
-std::array<float,2>{0.165585086f, 0.251083404f},
-std::array<float,2>{0.879281223f, 0.863700092f},
-std::array<float,2>{0.423362464f, 0.611122668f},
-std::array<float,2>{0.612820327f, 0.0439134762f},
-std::array<float,2>{0.109492518f, 0.0999580845f},
-std::array<float,2>{0.802060068f, 0.507456243f},
-std::array<float,2>{0.315773338f, 0.777256131f},
-std::array<float,2>{0.683364809f, 0.339382768f},
-std::array<float,2>{0.494918466f, 0.435034215f},
-std::array<float,2>{0.553503931f, 0.953939617f},
-std::array<float,2>{0.248160988f, 0.692671001f},
-std::array<float,2>{0.969458282f, 0.230262846f},
-std::array<float,2>{0.375507832f, 0.00770972483f},
-std::array<float,2>{0.590620279f, 0.592949212f},
-std::array<float,2>{0.155600235f, 0.820230305f},
-std::array<float,2>{0.916253626f, 0.31012404f},
-std::array<float,2>{0.0410818458f, 0.461684942f},
-std::array<float,2>{0.857923508f, 0.935566187f},
-std::array<float,2>{0.266393751f, 0.642700553f},
-std::array<float,2>{0.716784537f, 0.133310378f},
-std::array<float,2>{0.214277059f, 0.217540503f},
-std::array<float,2>{0.961604536f, 0.732817471f},
-std::array<float,2>{0.440301597f, 0.979394197f},
-std::array<float,2>{0.519590318f, 0.393781304f},
-std::array<float,2>{0.372591406f, 0.355961442f},
-std::array<float,2>{0.625533402f, 0.801442027f},
-std::array<float,2>{0.0886810422f, 0.560440779f},
-std::array<float,2>{0.780183434f, 0.086696662f},
-std::array<float,2>{0.45380348f, 0.24382849f},
-std::array<float,2>{0.503506243f, 0.714315891f},
-std::array<float,2>{0.201892003f, 0.951226711f},
-std::array<float,2>{0.951168358f, 0.419147462f},
-std::array<float,2>{0.0699864179f, 0.317028582f},
-std::array<float,2>{0.756185651f, 0.75221622f},
-std::array<float,2>{0.348767728f, 0.527805984f},
-std::array<float,2>{0.642043054f, 0.120739356f},
-std::array<float,2>{0.126611501f, 0.0602312759f},
-std::array<float,2>{0.932308376f, 0.606748164f},
-std::array<float,2>{0.39734894f, 0.844860315f},
-std::array<float,2>{0.567893982f, 0.276099026f},
-std::array<float,2>{0.263989925f, 0.491993338f},
-std::array<float,2>{0.687629223f, 0.887860119f},
-std::array<float,2>{0.0475103892f, 0.673814952f},
-std::array<float,2>{0.870386362f, 0.178652868f},
-std::array<float,2>{0.338668704f, 0.0630091801f},
-std::array<float,2>{0.671785355f, 0.544984281f},
-std::array<float,2>{0.101615012f, 0.788084149f},
-std::array<float,2>{0.795330107f, 0.362301737f},
-std::array<float,2>{0.234017923f, 0.387049049f},
-std::array<float,2>{0.985004246f, 0.997953236f},
-std::array<float,2>{0.474859089f, 0.739896894f},
-std::array<float,2>{0.539137006f, 0.197500914f},
-std::array<float,2>{0.0299988855f, 0.150778726f},
-std::array<float,2>{0.828150451f, 0.638626337f},
-std::array<float,2>{0.295306712f, 0.917500198f},
-std::array<float,2>{0.738766611f, 0.440885305f},
-std::array<float,2>{0.409583509f, 0.292406738f},
-std::array<float,2>{0.596432626f, 0.831797659f},
-std::array<float,2>{0.184291363f, 0.575495005f},
-std::array<float,2>{0.903455913f, 0.0291993897f},
-std::array<float,2>{0.357245237f, 0.192659602f},
-std::array<float,2>{0.652976394f, 0.748785138f},
-std::array<float,2>{0.0710868314f, 0.987161756f},
-std::array<float,2>{0.758618712f, 0.376360029f},
-std::array<float,2>{0.193705991f, 0.373719424f},
-std::array<float,2>{0.937585473f, 0.793260872f},
-std::array<float,2>{0.466686636f, 0.537898004f},
-std::array<float,2>{0.514409482f, 0.0773382485f},
-std::array<float,2>{0.0584290177f, 0.0192087106f},
-std::array<float,2>{0.866670847f, 0.568066478f},
-std::array<float,2>{0.257209092f, 0.836138606f},
-std::array<float,2>{0.699930608f, 0.284376651f},
-std::array<float,2>{0.40458554f, 0.446235776f},
-std::array<float,2>{0.576838672f, 0.906666219f},
-std::array<float,2>{0.13590607f, 0.632677555f},
-std::array<float,2>{0.923341215f, 0.143096268f},
-std::array<float,2>{0.480106592f, 0.109806344f},
-std::array<float,2>{0.533265591f, 0.518352151f},
-std::array<float,2>{0.221776485f, 0.75808084f},
-std::array<float,2>{0.99236244f, 0.321361363f},
-std::array<float,2>{0.0978132114f, 0.40754509f},
-std::array<float,2>{0.786767781f, 0.943156481f},
-std::array<float,2>{0.335908622f, 0.710365057f},
-std::array<float,2>{0.662764251f, 0.236452192f},
-std::array<float,2>{0.175884873f, 0.184356108f},
-std::array<float,2>{0.896471143f, 0.685054421f},
-std::array<float,2>{0.41543895f, 0.880432963f},
-std::array<float,2>{0.606470287f, 0.499433666f},
-std::array<float,2>{0.286606878f, 0.272513002f},
-std::array<float,2>{0.745897532f, 0.854670584f},
-std::array<float,2>{0.022377152f, 0.59805727f},
-std::array<float,2>{0.837947249f, 0.054327108f},
-std::array<float,2>{0.431010813f, 0.12684831f},
-std::array<float,2>{0.619926155f, 0.649751008f},
-std::array<float,2>{0.161426246f, 0.921946943f},
-std::array<float,2>{0.889376581f, 0.45872578f},
-std::array<float,2>{0.0127411429f, 0.301147014f},
-std::array<float,2>{0.817908883f, 0.825351298f},
-std::array<float,2>{0.304697663f, 0.583772719f},
-std::array<float,2>{0.730111182f, 0.0111403745f},
-std::array<float,2>{0.239092067f, 0.083165057f},
-std::array<float,2>{0.98417455f, 0.55368638f},
-std::array<float,2>{0.490345836f, 0.805738389f},
-std::array<float,2>{0.556550384f, 0.344284683f},
-std::array<float,2>{0.324213058f, 0.406099528f},
-std::array<float,2>{0.676464856f, 0.971491873f},
-std::array<float,2>{0.117260128f, 0.722536922f},
-std::array<float,2>{0.806336105f, 0.20342128f},
-std::array<float,2>{0.275847703f, 0.0376129635f},
-std::array<float,2>{0.710480392f, 0.617698193f},
-std::array<float,2>{0.0325389206f, 0.872137666f},
-std::array<float,2>{0.848413646f, 0.260619015f},
-std::array<float,2>{0.143485129f, 0.482803375f},
-std::array<float,2>{0.913994849f, 0.902134836f},
-std::array<float,2>{0.383030176f, 0.65626502f},
-std::array<float,2>{0.578458726f, 0.161849454f},
-std::array<float,2>{0.0840022415f, 0.222168282f},
-std::array<float,2>{0.771692991f, 0.699807703f},
-std::array<float,2>{0.360345095f, 0.963049471f},
-std::array<float,2>{0.6329512f, 0.429353714f},
-std::array<float,2>{0.448909909f, 0.331167847f},
-std::array<float,2>{0.526667893f, 0.767600834f},
-std::array<float,2>{0.206302196f, 0.510259271f},
-std::array<float,2>{0.954387784f, 0.102799192f},
-std::array<float,2>{0.31709069f, 0.14468649f},
-std::array<float,2>{0.684578061f, 0.628416538f},
-std::array<float,2>{0.115084089f, 0.910288095f},
-std::array<float,2>{0.800104618f, 0.449707836f},
-std::array<float,2>{0.243202358f, 0.287880987f},
-std::array<float,2>{0.974885404f, 0.84237045f},
-std::array<float,2>{0.498995066f, 0.566363215f},
-std::array<float,2>{0.546943665f, 0.0201184452f},
-std::array<float,2>{0.00192470092f, 0.0720826834f},
-std::array<float,2>{0.820698738f, 0.533440769f},
-std::array<float,2>{0.297298431f, 0.789905965f},
-std::array<float,2>{0.719625294f, 0.368455917f},
-std::array<float,2>{0.426015705f, 0.380468488f},
-std::array<float,2>{0.614295781f, 0.988306284f},
-std::array<float,2>{0.168460608f, 0.742730796f},
-std::array<float,2>{0.877769589f, 0.1892564f},
-std::array<float,2>{0.44384864f, 0.0489748567f},
-std::array<float,2>{0.517512918f, 0.593973577f},
-std::array<float,2>{0.217453018f, 0.857962787f},
-std::array<float,2>{0.967871189f, 0.267707556f},
-std::array<float,2>{0.0898490697f, 0.494526118f},
-std::array<float,2>{0.775636196f, 0.877195001f},
-std::array<float,2>{0.368467003f, 0.680846453f},
-std::array<float,2>{0.630241036f, 0.183472395f},
-std::array<float,2>{0.151456103f, 0.238899961f},
-std::array<float,2>{0.919297993f, 0.703735054f},
-std::array<float,2>{0.379984647f, 0.938280344f},
-std::array<float,2>{0.586673021f, 0.412145168f},
-std::array<float,2>{0.272013575f, 0.325089514f},
-std::array<float,2>{0.713651538f, 0.762802958f},
-std::array<float,2>{0.0450005233f, 0.521624506f},
-std::array<float,2>{0.854771435f, 0.115249075f},
-std::array<float,2>{0.393170685f, 0.208951414f},
-std::array<float,2>{0.565224946f, 0.724321961f},
-std::array<float,2>{0.132782862f, 0.972986937f},
-std::array<float,2>{0.934516072f, 0.3991175f},
-std::array<float,2>{0.054159347f, 0.350554198f},
-std::array<float,2>{0.872463822f, 0.811322451f},
-std::array<float,2>{0.261640608f, 0.548736334f},
-std::array<float,2>{0.694372714f, 0.0800031722f},
-std::array<float,2>{0.19604075f, 0.0120168058f},
-std::array<float,2>{0.947520673f, 0.57890588f},
-std::array<float,2>{0.459667325f, 0.820815146f},
-std::array<float,2>{0.505333126f, 0.300680608f},
-std::array<float,2>{0.344046384f, 0.456010729f},
-std::array<float,2>{0.647036672f, 0.928955376f},
-std::array<float,2>{0.0642849058f, 0.65404439f},
-std::array<float,2>{0.752819121f, 0.132018104f},
-std::array<float,2>{0.289152026f, 0.109292731f},
-std::array<float,2>{0.734682083f, 0.512797296f},
-std::array<float,2>{0.024299996f, 0.771861494f},
-std::array<float,2>{0.834607303f, 0.332390994f},
-std::array<float,2>{0.181391716f, 0.423719555f},
-std::array<float,2>{0.900176585f, 0.968132019f},
-std::array<float,2>{0.412266791f, 0.698682725f},
-std::array<float,2>{0.599942625f, 0.22485958f},
-std::array<float,2>{0.105944365f, 0.156925902f},
-std::array<float,2>{0.792188585f, 0.662718117f},
-std::array<float,2>{0.342281133f, 0.905623674f},
-std::array<float,2>{0.666699409f, 0.479320735f},
-std::array<float,2>{0.470839649f, 0.261868119f},
-std::array<float,2>{0.543726563f, 0.870360851f},
-std::array<float,2>{0.22682941f, 0.622012973f},
-std::array<float,2>{0.990955949f, 0.0333664194f},
-std::array<float,2>{0.2516554f, 0.233974889f},
-std::array<float,2>{0.696073294f, 0.689787269f},
-std::array<float,2>{0.0605705008f, 0.957926154f},
-std::array<float,2>{0.860316455f, 0.43200174f},
-std::array<float,2>{0.140405536f, 0.343127608f},
-std::array<float,2>{0.926167607f, 0.777932048f},
-std::array<float,2>{0.402333975f, 0.501617014f},
-std::array<float,2>{0.572963715f, 0.0940658823f},
-std::array<float,2>{0.0758494064f, 0.0399657413f},
-std::array<float,2>{0.762036264f, 0.615122974f},
-std::array<float,2>{0.354688942f, 0.861625314f},
-std::array<float,2>{0.651610792f, 0.256884426f},
-std::array<float,2>{0.46108216f, 0.476511329f},
-std::array<float,2>{0.511268318f, 0.895029187f},
-std::array<float,2>{0.189774349f, 0.669518054f},
-std::array<float,2>{0.943406224f, 0.165364236f},
-std::array<float,2>{0.419401228f, 0.0914532468f},
-std::array<float,2>{0.604199409f, 0.557330012f},
-std::array<float,2>{0.17192097f, 0.798058033f},
-std::array<float,2>{0.893418968f, 0.355416268f},
-std::array<float,2>{0.0156837627f, 0.39597854f},
-std::array<float,2>{0.843537927f, 0.982865691f},
-std::array<float,2>{0.283039987f, 0.727358878f},
-std::array<float,2>{0.746921241f, 0.211433917f},
-std::array<float,2>{0.223673582f, 0.137610078f},
-std::array<float,2>{0.996346593f, 0.646048725f},
-std::array<float,2>{0.482503474f, 0.92973882f},
-std::array<float,2>{0.53903693f, 0.467762887f},
-std::array<float,2>{0.331990361f, 0.307887763f},
-std::array<float,2>{0.657981455f, 0.81594497f},
-std::array<float,2>{0.0968574211f, 0.589597225f},
-std::array<float,2>{0.782167077f, 0.00168639398f},
-std::array<float,2>{0.488138676f, 0.17369993f},
-std::array<float,2>{0.558725238f, 0.679620981f},
-std::array<float,2>{0.235727444f, 0.885455906f},
-std::array<float,2>{0.979619682f, 0.487703443f},
-std::array<float,2>{0.122695237f, 0.279576093f},
-std::array<float,2>{0.809484959f, 0.849466681f},
-std::array<float,2>{0.325986564f, 0.604206622f},
-std::array<float,2>{0.67450875f, 0.0583162196f},
-std::array<float,2>{0.157874286f, 0.124515899f},
-std::array<float,2>{0.883392692f, 0.524359345f},
-std::array<float,2>{0.433829725f, 0.756809831f},
-std::array<float,2>{0.622790039f, 0.313721776f},
-std::array<float,2>{0.309112728f, 0.417820036f},
-std::array<float,2>{0.732215166f, 0.945848048f},
-std::array<float,2>{0.0110994037f, 0.71681118f},
-std::array<float,2>{0.812687337f, 0.247764364f},
-std::array<float,2>{0.366492361f, 0.026077373f},
-std::array<float,2>{0.639312983f, 0.570724368f},
-std::array<float,2>{0.08120545f, 0.832767308f},
-std::array<float,2>{0.766798139f, 0.296500623f},
-std::array<float,2>{0.210853815f, 0.441647083f},
-std::array<float,2>{0.960705876f, 0.919837475f},
-std::array<float,2>{0.451642752f, 0.633393764f},
-std::array<float,2>{0.529367983f, 0.15365085f},
-std::array<float,2>{0.0362743065f, 0.201652631f},
-std::array<float,2>{0.845070302f, 0.735040963f},
-std::array<float,2>{0.278499544f, 0.995435834f},
-std::array<float,2>{0.705514789f, 0.382844567f},
-std::array<float,2>{0.390208632f, 0.363742888f},
-std::array<float,2>{0.585382521f, 0.784661293f},
-std::array<float,2>{0.14819777f, 0.540813982f},
-std::array<float,2>{0.910148203f, 0.0666224137f},
-std::array<float,2>{0.268982977f, 0.135701224f},
-std::array<float,2>{0.718738019f, 0.641354084f},
-std::array<float,2>{0.0390647687f, 0.935143113f},
-std::array<float,2>{0.855647445f, 0.463353157f},
-std::array<float,2>{0.15307948f, 0.311745405f},
-std::array<float,2>{0.915800929f, 0.818327665f},
-std::array<float,2>{0.377689898f, 0.590076745f},
-std::array<float,2>{0.593324244f, 0.0054568355f},
-std::array<float,2>{0.0876745284f, 0.0892849341f},
-std::array<float,2>{0.777842462f, 0.561152458f},
-std::array<float,2>{0.37436384f, 0.803299129f},
-std::array<float,2>{0.627986431f, 0.358283937f},
-std::array<float,2>{0.438741982f, 0.391420394f},
-std::array<float,2>{0.523022234f, 0.976961911f},
-std::array<float,2>{0.212243542f, 0.732303202f},
-std::array<float,2>{0.963175237f, 0.216116026f},
-std::array<float,2>{0.424667925f, 0.0454126447f},
-std::array<float,2>{0.611142635f, 0.611348689f},
-std::array<float,2>{0.166789263f, 0.866599739f},
-std::array<float,2>{0.88194716f, 0.252010167f},
-std::array<float,2>{0.00643797638f, 0.470951498f},
-std::array<float,2>{0.825099349f, 0.892269135f},
-std::array<float,2>{0.303291142f, 0.665873706f},
-std::array<float,2>{0.723971009f, 0.169312641f},
-std::array<float,2>{0.246978253f, 0.228001267f},
-std::array<float,2>{0.971363068f, 0.694143832f},
-std::array<float,2>{0.493764192f, 0.955923915f},
-std::array<float,2>{0.551452816f, 0.436076254f},
-std::array<float,2>{0.31354472f, 0.337063283f},
-std::array<float,2>{0.680731237f, 0.773859441f},
-std::array<float,2>{0.11234618f, 0.505065918f},
-std::array<float,2>{0.804633737f, 0.0976941288f},
-std::array<float,2>{0.474482536f, 0.196612686f},
-std::array<float,2>{0.54130882f, 0.741680324f},
-std::array<float,2>{0.230771303f, 0.999479771f},
-std::array<float,2>{0.987058759f, 0.389847964f},
-std::array<float,2>{0.103700459f, 0.360953003f},
-std::array<float,2>{0.793708265f, 0.78592658f},
-std::array<float,2>{0.336564898f, 0.544616401f},
-std::array<float,2>{0.668150485f, 0.065347746f},
-std::array<float,2>{0.185954303f, 0.0300405566f},
-std::array<float,2>{0.906098127f, 0.577732265f},
-std::array<float,2>{0.407096177f, 0.828290462f},
-std::array<float,2>{0.59517163f, 0.291006148f},
-std::array<float,2>{0.293348938f, 0.43816781f},
-std::array<float,2>{0.741809964f, 0.914234281f},
-std::array<float,2>{0.0276990887f, 0.639012098f},
-std::array<float,2>{0.831306636f, 0.149867028f},
-std::array<float,2>{0.350595057f, 0.118464835f},
-std::array<float,2>{0.642732501f, 0.530403972f},
-std::array<float,2>{0.0677007586f, 0.750402987f},
-std::array<float,2>{0.755579233f, 0.31925115f},
-std::array<float,2>{0.200631529f, 0.420026094f},
-std::array<float,2>{0.951974869f, 0.951096356f},
-std::array<float,2>{0.455281377f, 0.711678386f},
-std::array<float,2>{0.501614094f, 0.244769394f},
-std::array<float,2>{0.0495109335f, 0.175945967f},
-std::array<float,2>{0.868828714f, 0.675742149f},
-std::array<float,2>{0.262940347f, 0.889100254f},
-std::array<float,2>{0.691159427f, 0.488307655f},
-std::array<float,2>{0.395672232f, 0.274341643f},
-std::array<float,2>{0.570205748f, 0.846031725f},
-std::array<float,2>{0.1280251f, 0.608302712f},
-std::array<float,2>{0.930048287f, 0.0613872409f},
-std::array<float,2>{0.332119942f, 0.236133024f},
-std::array<float,2>{0.661945224f, 0.70718652f},
-std::array<float,2>{0.100379296f, 0.943639338f},
-std::array<float,2>{0.787730575f, 0.408679247f},
-std::array<float,2>{0.219850734f, 0.324135333f},
-std::array<float,2>{0.995104074f, 0.760196865f},
-std::array<float,2>{0.476990849f, 0.515868425f},
-std::array<float,2>{0.531808436f, 0.113134377f},
-std::array<float,2>{0.020441914f, 0.0520088151f},
-std::array<float,2>{0.837665915f, 0.601224065f},
-std::array<float,2>{0.289027542f, 0.853038251f},
-std::array<float,2>{0.74339813f, 0.270127684f},
-std::array<float,2>{0.416355133f, 0.497365028f},
-std::array<float,2>{0.608887017f, 0.882090509f},
-std::array<float,2>{0.179113954f, 0.686441302f},
-std::array<float,2>{0.897504866f, 0.185590163f},
-std::array<float,2>{0.467623949f, 0.0743546635f},
-std::array<float,2>{0.511920273f, 0.536085308f},
-std::array<float,2>{0.192791685f, 0.796175778f},
-std::array<float,2>{0.940533817f, 0.37257427f},
-std::array<float,2>{0.0732983723f, 0.378456414f},
-std::array<float,2>{0.761612236f, 0.98603487f},
-std::array<float,2>{0.358096093f, 0.746661484f},
-std::array<float,2>{0.655289888f, 0.193784803f},
-std::array<float,2>{0.134507582f, 0.140834093f},
-std::array<float,2>{0.925103009f, 0.629378557f},
-std::array<float,2>{0.402880132f, 0.909182668f},
-std::array<float,2>{0.574583352f, 0.447723508f},
-std::array<float,2>{0.255186528f, 0.281739056f},
-std::array<float,2>{0.70180434f, 0.837965012f},
-std::array<float,2>{0.0558801629f, 0.569030821f},
-std::array<float,2>{0.865178883f, 0.0167461094f},
-std::array<float,2>{0.385766149f, 0.162380278f},
-std::array<float,2>{0.581392825f, 0.6596784f},
-std::array<float,2>{0.141817808f, 0.898823321f},
-std::array<float,2>{0.91189611f, 0.480656564f},
-std::array<float,2>{0.0332188308f, 0.259499252f},
-std::array<float,2>{0.851092398f, 0.874103069f},
-std::array<float,2>{0.273498029f, 0.620191336f},
-std::array<float,2>{0.708449543f, 0.0360756367f},
-std::array<float,2>{0.204421803f, 0.103630185f},
-std::array<float,2>{0.955695152f, 0.507862985f},
-std::array<float,2>{0.4458206f, 0.766631186f},
-std::array<float,2>{0.525253057f, 0.329183251f},
-std::array<float,2>{0.363045931f, 0.427435994f},
-std::array<float,2>{0.636229336f, 0.961039245f},
-std::array<float,2>{0.0832533091f, 0.702526152f},
-std::array<float,2>{0.769900441f, 0.219279557f},
-std::array<float,2>{0.306889117f, 0.00842393469f},
-std::array<float,2>{0.728111148f, 0.58557564f},
-std::array<float,2>{0.0148396567f, 0.826859951f},
-std::array<float,2>{0.818415642f, 0.304311603f},
-std::array<float,2>{0.163781911f, 0.460820168f},
-std::array<float,2>{0.887457252f, 0.923835933f},
-std::array<float,2>{0.43250075f, 0.651017427f},
-std::array<float,2>{0.619089723f, 0.128687903f},
-std::array<float,2>{0.119578585f, 0.205236241f},
-std::array<float,2>{0.80858618f, 0.720333815f},
-std::array<float,2>{0.321606874f, 0.969463766f},
-std::array<float,2>{0.678370237f, 0.403737515f},
-std::array<float,2>{0.48985821f, 0.345708758f},
-std::array<float,2>{0.558083057f, 0.807326376f},
-std::array<float,2>{0.241606355f, 0.551341116f},
-std::array<float,2>{0.982294738f, 0.0858100057f},
-std::array<float,2>{0.36919561f, 0.18140541f},
-std::array<float,2>{0.632076085f, 0.68300885f},
-std::array<float,2>{0.0929873288f, 0.875048339f},
-std::array<float,2>{0.77369386f, 0.493099391f},
-std::array<float,2>{0.215252995f, 0.266470045f},
-std::array<float,2>{0.965034485f, 0.85547328f},
-std::array<float,2>{0.441517264f, 0.596268296f},
-std::array<float,2>{0.518512607f, 0.0488158874f},
-std::array<float,2>{0.0432851166f, 0.113585517f},
-std::array<float,2>{0.852065027f, 0.519611716f},
-std::array<float,2>{0.270830631f, 0.765464067f},
-std::array<float,2>{0.711906731f, 0.326704264f},
-std::array<float,2>{0.381566554f, 0.411939621f},
-std::array<float,2>{0.588632882f, 0.939591169f},
-std::array<float,2>{0.149846584f, 0.706222415f},
-std::array<float,2>{0.920805216f, 0.241085798f},
-std::array<float,2>{0.497614682f, 0.0231481567f},
-std::array<float,2>{0.550588965f, 0.562618017f},
-std::array<float,2>{0.245026916f, 0.841071188f},
-std::array<float,2>{0.974078894f, 0.285842866f},
-std::array<float,2>{0.116948955f, 0.45135957f},
-std::array<float,2>{0.797664762f, 0.912506878f},
-std::array<float,2>{0.319836229f, 0.626419783f},
-std::array<float,2>{0.686635554f, 0.146646276f},
-std::array<float,2>{0.170552984f, 0.190268025f},
-std::array<float,2>{0.875503778f, 0.745367944f},
-std::array<float,2>{0.427852601f, 0.991437674f},
-std::array<float,2>{0.616215467f, 0.381441802f},
-std::array<float,2>{0.300253868f, 0.370597273f},
-std::array<float,2>{0.721332848f, 0.791784465f},
-std::array<float,2>{0.00288902479f, 0.531778038f},
-std::array<float,2>{0.822909236f, 0.073189199f},
-std::array<float,2>{0.412055224f, 0.224092513f},
-std::array<float,2>{0.598377109f, 0.695418119f},
-std::array<float,2>{0.181824252f, 0.966165304f},
-std::array<float,2>{0.902067959f, 0.425588608f},
-std::array<float,2>{0.0259051882f, 0.335249364f},
-std::array<float,2>{0.832579136f, 0.770615339f},
-std::array<float,2>{0.292141885f, 0.515192866f},
-std::array<float,2>{0.736860394f, 0.10597118f},
-std::array<float,2>{0.230332613f, 0.0312561207f},
-std::array<float,2>{0.989586234f, 0.623659551f},
-std::array<float,2>{0.470393866f, 0.867241025f},
-std::array<float,2>{0.545976222f, 0.264211446f},
-std::array<float,2>{0.34023276f, 0.478504717f},
-std::array<float,2>{0.664843142f, 0.902734995f},
-std::array<float,2>{0.109190725f, 0.661989391f},
-std::array<float,2>{0.789412081f, 0.158850104f},
-std::array<float,2>{0.25791657f, 0.0805482119f},
-std::array<float,2>{0.692394853f, 0.550362587f},
-std::array<float,2>{0.0525125712f, 0.809032798f},
-std::array<float,2>{0.873951852f, 0.349290967f},
-std::array<float,2>{0.13067174f, 0.400412321f},
-std::array<float,2>{0.937101364f, 0.974810839f},
-std::array<float,2>{0.391786069f, 0.724858582f},
-std::array<float,2>{0.564002216f, 0.209972262f},
-std::array<float,2>{0.0658672154f, 0.130341575f},
-std::array<float,2>{0.750153959f, 0.655765295f},
-std::array<float,2>{0.34667632f, 0.92595917f},
-std::array<float,2>{0.645011723f, 0.453893274f},
-std::array<float,2>{0.458095789f, 0.298645973f},
-std::array<float,2>{0.507146299f, 0.822560847f},
-std::array<float,2>{0.198743224f, 0.580807149f},
-std::array<float,2>{0.946481645f, 0.0143944705f},
-std::array<float,2>{0.28389436f, 0.213983983f},
-std::array<float,2>{0.748668849f, 0.729143083f},
-std::array<float,2>{0.0195048228f, 0.981756687f},
-std::array<float,2>{0.841123223f, 0.398302227f},
-std::array<float,2>{0.175250337f, 0.351968676f},
-std::array<float,2>{0.892308891f, 0.800650299f},
-std::array<float,2>{0.42095083f, 0.5548684f},
-std::array<float,2>{0.602395833f, 0.0935198218f},
-std::array<float,2>{0.0941693485f, 0.00202837423f},
-std::array<float,2>{0.78460294f, 0.587705314f},
-std::array<float,2>{0.32872957f, 0.813349009f},
-std::array<float,2>{0.658367097f, 0.306000054f},
-std::array<float,2>{0.482286066f, 0.4649795f},
-std::array<float,2>{0.53628087f, 0.933459699f},
-std::array<float,2>{0.224889755f, 0.647703409f},
-std::array<float,2>{0.998168945f, 0.138823152f},
-std::array<float,2>{0.399217993f, 0.0975480899f},
-std::array<float,2>{0.570917785f, 0.503136635f},
-std::array<float,2>{0.137473896f, 0.780712426f},
-std::array<float,2>{0.928848863f, 0.340539634f},
-std::array<float,2>{0.0586292967f, 0.430159688f},
-std::array<float,2>{0.862033844f, 0.960038722f},
-std::array<float,2>{0.253626883f, 0.688226163f},
-std::array<float,2>{0.69836843f, 0.230793864f},
-std::array<float,2>{0.188081369f, 0.166547135f},
-std::array<float,2>{0.942357302f, 0.671272159f},
-std::array<float,2>{0.464740247f, 0.897385895f},
-std::array<float,2>{0.508338511f, 0.473146409f},
-std::array<float,2>{0.353405058f, 0.254719466f},
-std::array<float,2>{0.648641527f, 0.860209942f},
-std::array<float,2>{0.0766752437f, 0.61663121f},
-std::array<float,2>{0.7653234f, 0.0428259857f},
-std::array<float,2>{0.450359583f, 0.155641407f},
-std::array<float,2>{0.52907753f, 0.635086417f},
-std::array<float,2>{0.208071291f, 0.920983851f},
-std::array<float,2>{0.957505465f, 0.445235997f},
-std::array<float,2>{0.079580158f, 0.293881267f},
-std::array<float,2>{0.768553793f, 0.834948897f},
-std::array<float,2>{0.364631981f, 0.573438346f},
-std::array<float,2>{0.637268126f, 0.0247350503f},
-std::array<float,2>{0.146188393f, 0.0690199882f},
-std::array<float,2>{0.906540573f, 0.541791916f},
-std::array<float,2>{0.387154281f, 0.781873167f},
-std::array<float,2>{0.582123578f, 0.365935057f},
-std::array<float,2>{0.280353993f, 0.385796338f},
-std::array<float,2>{0.705054224f, 0.992771327f},
-std::array<float,2>{0.0381541029f, 0.738160849f},
-std::array<float,2>{0.847445726f, 0.200785235f},
-std::array<float,2>{0.327555478f, 0.0566035472f},
-std::array<float,2>{0.672879755f, 0.602483749f},
-std::array<float,2>{0.123740971f, 0.850598752f},
-std::array<float,2>{0.811381936f, 0.278388083f},
-std::array<float,2>{0.238067284f, 0.48510471f},
-std::array<float,2>{0.978153467f, 0.883127153f},
-std::array<float,2>{0.48560667f, 0.675807893f},
-std::array<float,2>{0.562447727f, 0.174415559f},
-std::array<float,2>{0.00809297245f, 0.249246359f},
-std::array<float,2>{0.815004289f, 0.71551466f},
-std::array<float,2>{0.311748534f, 0.948024511f},
-std::array<float,2>{0.733120441f, 0.414951414f},
-std::array<float,2>{0.436588526f, 0.315327287f},
-std::array<float,2>{0.624190748f, 0.754143238f},
-std::array<float,2>{0.159881249f, 0.526845336f},
-std::array<float,2>{0.885003865f, 0.121415831f},
-std::array<float,2>{0.296605647f, 0.149363592f},
-std::array<float,2>{0.740123391f, 0.64000231f},
-std::array<float,2>{0.0303082354f, 0.915970445f},
-std::array<float,2>{0.829259515f, 0.439434677f},
-std::array<float,2>{0.184743315f, 0.289613128f},
-std::array<float,2>{0.90239203f, 0.829597414f},
-std::array<float,2>{0.408735007f, 0.577127039f},
-std::array<float,2>{0.597532034f, 0.0310967397f},
-std::array<float,2>{0.103494301f, 0.0655055568f},
-std::array<float,2>{0.796674788f, 0.543545425f},
-std::array<float,2>{0.339033276f, 0.786811173f},
-std::array<float,2>{0.670375586f, 0.360068172f},
-std::array<float,2>{0.476430893f, 0.389599621f},
-std::array<float,2>{0.540417969f, 0.998983085f},
-std::array<float,2>{0.233316138f, 0.740632772f},
-std::array<float,2>{0.985814273f, 0.195428535f},
-std::array<float,2>{0.397940069f, 0.0619292296f},
-std::array<float,2>{0.566823483f, 0.608848035f},
-std::array<float,2>{0.125075072f, 0.847432256f},
-std::array<float,2>{0.932640374f, 0.27476117f},
-std::array<float,2>{0.0487487428f, 0.489427775f},
-std::array<float,2>{0.869457126f, 0.889816046f},
-std::array<float,2>{0.265265018f, 0.673906744f},
-std::array<float,2>{0.688696504f, 0.177200049f},
-std::array<float,2>{0.202425912f, 0.245373607f},
-std::array<float,2>{0.949705362f, 0.712775767f},
-std::array<float,2>{0.454250693f, 0.949921012f},
-std::array<float,2>{0.502594471f, 0.421169817f},
-std::array<float,2>{0.348116368f, 0.319915742f},
-std::array<float,2>{0.640877962f, 0.751105726f},
-std::array<float,2>{0.0686217099f, 0.529670537f},
-std::array<float,2>{0.757565141f, 0.118037835f},
-std::array<float,2>{0.441243291f, 0.215222359f},
-std::array<float,2>{0.520887971f, 0.731193304f},
-std::array<float,2>{0.213380173f, 0.978384793f},
-std::array<float,2>{0.962626457f, 0.392224193f},
-std::array<float,2>{0.0896666124f, 0.358829826f},
-std::array<float,2>{0.780402064f, 0.804616094f},
-std::array<float,2>{0.371237606f, 0.562003493f},
-std::array<float,2>{0.626407206f, 0.0887694508f},
-std::array<float,2>{0.155075341f, 0.00452495413f},
-std::array<float,2>{0.917477846f, 0.591046393f},
-std::array<float,2>{0.376609951f, 0.816911817f},
-std::array<float,2>{0.591730654f, 0.311024994f},
-std::array<float,2>{0.266642272f, 0.46448493f},
-std::array<float,2>{0.715506315f, 0.933939815f},
-std::array<float,2>{0.0422132015f, 0.642126143f},
-std::array<float,2>{0.858615756f, 0.136361033f},
-std::array<float,2>{0.315231413f, 0.0989148766f},
-std::array<float,2>{0.682177961f, 0.504675567f},
-std::array<float,2>{0.110662475f, 0.77523452f},
-std::array<float,2>{0.801273882f, 0.336122394f},
-std::array<float,2>{0.24926497f, 0.436820716f},
-std::array<float,2>{0.970548391f, 0.956663251f},
-std::array<float,2>{0.495318383f, 0.695228279f},
-std::array<float,2>{0.554382682f, 0.227131546f},
-std::array<float,2>{0.00548354769f, 0.16804634f},
-std::array<float,2>{0.827353358f, 0.664709687f},
-std::array<float,2>{0.302499056f, 0.890861988f},
-std::array<float,2>{0.726251423f, 0.471977592f},
-std::array<float,2>{0.422016323f, 0.253828943f},
-std::array<float,2>{0.612154245f, 0.865498543f},
-std::array<float,2>{0.164326936f, 0.612755597f},
-std::array<float,2>{0.880301058f, 0.0463024862f},
-std::array<float,2>{0.361273587f, 0.219798163f},
-std::array<float,2>{0.634248376f, 0.701824903f},
-std::array<float,2>{0.0857406482f, 0.962711275f},
-std::array<float,2>{0.772726536f, 0.426072836f},
-std::array<float,2>{0.205297366f, 0.329005301f},
-std::array<float,2>{0.953781664f, 0.765922844f},
-std::array<float,2>{0.447323442f, 0.508815825f},
-std::array<float,2>{0.526292622f, 0.104753375f},
-std::array<float,2>{0.0315324999f, 0.0369551852f},
-std::array<float,2>{0.848884583f, 0.619655013f},
-std::array<float,2>{0.277330488f, 0.87395072f},
-std::array<float,2>{0.709263325f, 0.258354992f},
-std::array<float,2>{0.383947223f, 0.481754482f},
-std::array<float,2>{0.579723954f, 0.900140464f},
-std::array<float,2>{0.144429296f, 0.658222258f},
-std::array<float,2>{0.912752688f, 0.163114309f},
-std::array<float,2>{0.492138088f, 0.0846672356f},
-std::array<float,2>{0.554951608f, 0.552452743f},
-std::array<float,2>{0.239441812f, 0.807618856f},
-std::array<float,2>{0.982587874f, 0.346853971f},
-std::array<float,2>{0.119021274f, 0.402861476f},
-std::array<float,2>{0.805529058f, 0.970113516f},
-std::array<float,2>{0.322505683f, 0.719093978f},
-std::array<float,2>{0.67743367f, 0.206183478f},
-std::array<float,2>{0.160246909f, 0.127587169f},
-std::array<float,2>{0.889745414f, 0.651967347f},
-std::array<float,2>{0.430076033f, 0.925024211f},
-std::array<float,2>{0.620911419f, 0.459469587f},
-std::array<float,2>{0.306241035f, 0.302997321f},
-std::array<float,2>{0.72896409f, 0.827532291f},
-std::array<float,2>{0.0126144337f, 0.584821999f},
-std::array<float,2>{0.816890478f, 0.00957387127f},
-std::array<float,2>{0.414741546f, 0.187119201f},
-std::array<float,2>{0.605486929f, 0.687386692f},
-std::array<float,2>{0.177252352f, 0.881335378f},
-std::array<float,2>{0.895105183f, 0.496141583f},
-std::array<float,2>{0.02324697f, 0.271073341f},
-std::array<float,2>{0.839072049f, 0.851942778f},
-std::array<float,2>{0.285627961f, 0.599675f},
-std::array<float,2>{0.744901538f, 0.0511758849f},
-std::array<float,2>{0.221248448f, 0.111749567f},
-std::array<float,2>{0.993929505f, 0.516971469f},
-std::array<float,2>{0.479086071f, 0.761349618f},
-std::array<float,2>{0.534585476f, 0.322831124f},
-std::array<float,2>{0.33439377f, 0.409792334f},
-std::array<float,2>{0.663585603f, 0.944963992f},
-std::array<float,2>{0.0991295278f, 0.708541393f},
-std::array<float,2>{0.785858989f, 0.235119268f},
-std::array<float,2>{0.256627262f, 0.0162293781f},
-std::array<float,2>{0.700445175f, 0.570077121f},
-std::array<float,2>{0.0566434674f, 0.839265347f},
-std::array<float,2>{0.865489721f, 0.282495439f},
-std::array<float,2>{0.135371774f, 0.448276132f},
-std::array<float,2>{0.921904147f, 0.908611596f},
-std::array<float,2>{0.40584439f, 0.630253553f},
-std::array<float,2>{0.577658713f, 0.141643494f},
-std::array<float,2>{0.071316205f, 0.19523631f},
-std::array<float,2>{0.759757936f, 0.747095525f},
-std::array<float,2>{0.355664492f, 0.984698057f},
-std::array<float,2>{0.653545797f, 0.377325267f},
-std::array<float,2>{0.465036333f, 0.37113145f},
-std::array<float,2>{0.514835358f, 0.795147896f},
-std::array<float,2>{0.194474071f, 0.536466122f},
-std::array<float,2>{0.9385373f, 0.0759893358f},
-std::array<float,2>{0.343003303f, 0.159251869f},
-std::array<float,2>{0.66789782f, 0.660997629f},
-std::array<float,2>{0.106824838f, 0.904030919f},
-std::array<float,2>{0.791119277f, 0.476596951f},
-std::array<float,2>{0.227687329f, 0.265220582f},
-std::array<float,2>{0.991699696f, 0.868371487f},
-std::array<float,2>{0.471945614f, 0.624667704f},
-std::array<float,2>{0.544763625f, 0.0325604454f},
-std::array<float,2>{0.0250547044f, 0.106466629f},
-std::array<float,2>{0.835147321f, 0.513867497f},
-std::array<float,2>{0.29067865f, 0.769839227f},
-std::array<float,2>{0.736016989f, 0.33494556f},
-std::array<float,2>{0.413799614f, 0.42445308f},
-std::array<float,2>{0.60137713f, 0.965789616f},
-std::array<float,2>{0.179854259f, 0.696905017f},
-std::array<float,2>{0.898481786f, 0.222967252f},
-std::array<float,2>{0.460908085f, 0.0148540456f},
-std::array<float,2>{0.50480485f, 0.581427097f},
-std::array<float,2>{0.197029397f, 0.823486447f},
-std::array<float,2>{0.948751628f, 0.297448516f},
-std::array<float,2>{0.0628965124f, 0.454324633f},
-std::array<float,2>{0.753427267f, 0.926940024f},
-std::array<float,2>{0.345128626f, 0.654877126f},
-std::array<float,2>{0.648265839f, 0.129280806f},
-std::array<float,2>{0.131562039f, 0.209787384f},
-std::array<float,2>{0.934873104f, 0.726090968f},
-std::array<float,2>{0.39382872f, 0.976403892f},
-std::array<float,2>{0.566075265f, 0.401898414f},
-std::array<float,2>{0.260175228f, 0.348063469f},
-std::array<float,2>{0.69383502f, 0.810157239f},
-std::array<float,2>{0.0535587631f, 0.549521923f},
-std::array<float,2>{0.871113539f, 0.0812163651f},
-std::array<float,2>{0.379312068f, 0.24152483f},
-std::array<float,2>{0.587441862f, 0.706017733f},
-std::array<float,2>{0.150832579f, 0.940514147f},
-std::array<float,2>{0.918517292f, 0.410702795f},
-std::array<float,2>{0.0468205623f, 0.327950776f},
-std::array<float,2>{0.853826642f, 0.763828814f},
-std::array<float,2>{0.272837162f, 0.520757675f},
-std::array<float,2>{0.71473366f, 0.114833392f},
-std::array<float,2>{0.218418941f, 0.0472932197f},
-std::array<float,2>{0.96680373f, 0.597496331f},
-std::array<float,2>{0.444476962f, 0.856629372f},
-std::array<float,2>{0.515674531f, 0.267062873f},
-std::array<float,2>{0.368071407f, 0.493585914f},
-std::array<float,2>{0.629537642f, 0.876863897f},
-std::array<float,2>{0.0913946033f, 0.682565749f},
-std::array<float,2>{0.776995838f, 0.180097401f},
-std::array<float,2>{0.298601449f, 0.0741737261f},
-std::array<float,2>{0.719753921f, 0.532601893f},
-std::array<float,2>{0.000105938612f, 0.792248964f},
-std::array<float,2>{0.821496785f, 0.369764656f},
-std::array<float,2>{0.169650614f, 0.382811844f},
-std::array<float,2>{0.878646255f, 0.990276158f},
-std::array<float,2>{0.427183628f, 0.744349301f},
-std::array<float,2>{0.613550246f, 0.190980628f},
-std::array<float,2>{0.113787383f, 0.148017973f},
-std::array<float,2>{0.798946619f, 0.625104964f},
-std::array<float,2>{0.317701668f, 0.91375488f},
-std::array<float,2>{0.683709145f, 0.452400953f},
-std::array<float,2>{0.499943316f, 0.286556005f},
-std::array<float,2>{0.548303187f, 0.839911699f},
-std::array<float,2>{0.243046194f, 0.56354475f},
-std::array<float,2>{0.975775123f, 0.0221449714f},
-std::array<float,2>{0.2775473f, 0.199803233f},
-std::array<float,2>{0.706256628f, 0.73718816f},
-std::array<float,2>{0.035823483f, 0.99410069f},
-std::array<float,2>{0.84417057f, 0.384832829f},
-std::array<float,2>{0.146511003f, 0.366754353f},
-std::array<float,2>{0.908343434f, 0.783006132f},
-std::array<float,2>{0.389098793f, 0.542030513f},
-std::array<float,2>{0.584360242f, 0.0697563738f},
-std::array<float,2>{0.0809794813f, 0.0242085997f},
-std::array<float,2>{0.766126037f, 0.573217034f},
-std::array<float,2>{0.366100609f, 0.835044861f},
-std::array<float,2>{0.639981091f, 0.293960959f},
-std::array<float,2>{0.452878088f, 0.44373998f},
-std::array<float,2>{0.530348778f, 0.920048952f},
-std::array<float,2>{0.209601209f, 0.636392355f},
-std::array<float,2>{0.959194422f, 0.154973358f},
-std::array<float,2>{0.434770793f, 0.122384876f},
-std::array<float,2>{0.621388912f, 0.525397122f},
-std::array<float,2>{0.156883404f, 0.755255044f},
-std::array<float,2>{0.884462714f, 0.315929323f},
-std::array<float,2>{0.01071628f, 0.415411204f},
-std::array<float,2>{0.814242184f, 0.948360145f},
-std::array<float,2>{0.309925884f, 0.716118097f},
-std::array<float,2>{0.731258273f, 0.248646498f},
-std::array<float,2>{0.235142127f, 0.175019428f},
-std::array<float,2>{0.978816032f, 0.67758292f},
-std::array<float,2>{0.487270057f, 0.88384521f},
-std::array<float,2>{0.560137033f, 0.485855758f},
-std::array<float,2>{0.324818015f, 0.27779454f},
-std::array<float,2>{0.675225794f, 0.850240588f},
-std::array<float,2>{0.12181776f, 0.603501201f},
-std::array<float,2>{0.809996843f, 0.0554447919f},
-std::array<float,2>{0.483568788f, 0.13971132f},
-std::array<float,2>{0.537371159f, 0.647375941f},
-std::array<float,2>{0.223412126f, 0.931841433f},
-std::array<float,2>{0.997260511f, 0.466218174f},
-std::array<float,2>{0.0957202762f, 0.304965556f},
-std::array<float,2>{0.782910645f, 0.814304888f},
-std::array<float,2>{0.33012253f, 0.586777151f},
-std::array<float,2>{0.656719208f, 0.00326585071f},
-std::array<float,2>{0.173620299f, 0.0923365951f},
-std::array<float,2>{0.893688619f, 0.556552708f},
-std::array<float,2>{0.418156385f, 0.798948765f},
-std::array<float,2>{0.605015814f, 0.353459209f},
-std::array<float,2>{0.281577408f, 0.397210807f},
-std::array<float,2>{0.747430801f, 0.98067981f},
-std::array<float,2>{0.0171483625f, 0.729884326f},
-std::array<float,2>{0.842097104f, 0.213195026f},
-std::array<float,2>{0.353644133f, 0.0411477685f},
-std::array<float,2>{0.651032865f, 0.61586374f},
-std::array<float,2>{0.0751326978f, 0.861066341f},
-std::array<float,2>{0.762798369f, 0.255005002f},
-std::array<float,2>{0.191070497f, 0.473983258f},
-std::array<float,2>{0.94472748f, 0.897710621f},
-std::array<float,2>{0.462634265f, 0.670536876f},
-std::array<float,2>{0.509922087f, 0.167022839f},
-std::array<float,2>{0.0622383282f, 0.231950179f},
-std::array<float,2>{0.861288548f, 0.688984573f},
-std::array<float,2>{0.250111133f, 0.959342122f},
-std::array<float,2>{0.696371853f, 0.430990905f},
-std::array<float,2>{0.401254326f, 0.34157598f},
-std::array<float,2>{0.573712945f, 0.779366732f},
-std::array<float,2>{0.139452919f, 0.501983762f},
-std::array<float,2>{0.926968455f, 0.0958799496f},
-std::array<float,2>{0.26176393f, 0.178898558f},
-std::array<float,2>{0.690360069f, 0.671930075f},
-std::array<float,2>{0.0504030921f, 0.887145281f},
-std::array<float,2>{0.867847025f, 0.490269393f},
-std::array<float,2>{0.127099931f, 0.276843339f},
-std::array<float,2>{0.931027889f, 0.844493866f},
-std::array<float,2>{0.39470762f, 0.605839789f},
-std::array<float,2>{0.568739057f, 0.0592343099f},
-std::array<float,2>{0.0665346459f, 0.120063134f},
-std::array<float,2>{0.754118145f, 0.528637886f},
-std::array<float,2>{0.35034281f, 0.75322175f},
-std::array<float,2>{0.643703818f, 0.318353742f},
-std::array<float,2>{0.456942946f, 0.418902367f},
-std::array<float,2>{0.500828803f, 0.952740312f},
-std::array<float,2>{0.19930619f, 0.713605344f},
-std::array<float,2>{0.953019083f, 0.242667377f},
-std::array<float,2>{0.408141553f, 0.027676288f},
-std::array<float,2>{0.593801379f, 0.574404001f},
-std::array<float,2>{0.186626196f, 0.830753088f},
-std::array<float,2>{0.904418111f, 0.291514665f},
-std::array<float,2>{0.0287514906f, 0.439654827f},
-std::array<float,2>{0.830242991f, 0.91677767f},
-std::array<float,2>{0.294388175f, 0.637290835f},
-std::array<float,2>{0.740427554f, 0.151376709f},
-std::array<float,2>{0.231920794f, 0.198432311f},
-std::array<float,2>{0.988193095f, 0.738501787f},
-std::array<float,2>{0.473229468f, 0.996848226f},
-std::array<float,2>{0.542834103f, 0.388486564f},
-std::array<float,2>{0.337109059f, 0.362485945f},
-std::array<float,2>{0.66958648f, 0.789043128f},
-std::array<float,2>{0.104738489f, 0.546731591f},
-std::array<float,2>{0.794843197f, 0.0636925921f},
-std::array<float,2>{0.492427409f, 0.229458988f},
-std::array<float,2>{0.551769793f, 0.691866279f},
-std::array<float,2>{0.24747847f, 0.95477742f},
-std::array<float,2>{0.971856654f, 0.434391737f},
-std::array<float,2>{0.112019636f, 0.338087618f},
-std::array<float,2>{0.803667009f, 0.776292324f},
-std::array<float,2>{0.313058883f, 0.506061614f},
-std::array<float,2>{0.67997545f, 0.100955516f},
-std::array<float,2>{0.167343035f, 0.0444177091f},
-std::array<float,2>{0.881063282f, 0.610325813f},
-std::array<float,2>{0.425286651f, 0.865127206f},
-std::array<float,2>{0.610077858f, 0.25028047f},
-std::array<float,2>{0.303789169f, 0.469596148f},
-std::array<float,2>{0.722763658f, 0.893662333f},
-std::array<float,2>{0.0076121022f, 0.667122304f},
-std::array<float,2>{0.825268686f, 0.170792863f},
-std::array<float,2>{0.373315573f, 0.0871060416f},
-std::array<float,2>{0.627337515f, 0.559253871f},
-std::array<float,2>{0.0863709301f, 0.802595198f},
-std::array<float,2>{0.778645039f, 0.356592923f},
-std::array<float,2>{0.210963279f, 0.392822087f},
-std::array<float,2>{0.963925481f, 0.980391026f},
-std::array<float,2>{0.437817454f, 0.733571589f},
-std::array<float,2>{0.522171736f, 0.217979833f},
-std::array<float,2>{0.0401103459f, 0.134349659f},
-std::array<float,2>{0.857367456f, 0.644237638f},
-std::array<float,2>{0.267830402f, 0.937454879f},
-std::array<float,2>{0.716991127f, 0.462356627f},
-std::array<float,2>{0.378694475f, 0.308971554f},
-std::array<float,2>{0.591984332f, 0.818775296f},
-std::array<float,2>{0.153989345f, 0.592247963f},
-std::array<float,2>{0.914459229f, 0.00642366661f},
-std::array<float,2>{0.320978999f, 0.204284206f},
-std::array<float,2>{0.679424882f, 0.72073406f},
-std::array<float,2>{0.120576181f, 0.972047269f},
-std::array<float,2>{0.806775391f, 0.404726267f},
-std::array<float,2>{0.241086125f, 0.345024168f},
-std::array<float,2>{0.981322169f, 0.80484432f},
-std::array<float,2>{0.489113867f, 0.554191172f},
-std::array<float,2>{0.556701303f, 0.0821047872f},
-std::array<float,2>{0.0143651562f, 0.00990864914f},
-std::array<float,2>{0.819452763f, 0.582890868f},
-std::array<float,2>{0.308570892f, 0.824956536f},
-std::array<float,2>{0.727521598f, 0.302193165f},
-std::array<float,2>{0.433507115f, 0.457432061f},
-std::array<float,2>{0.618108332f, 0.922865748f},
-std::array<float,2>{0.162500545f, 0.64873457f},
-std::array<float,2>{0.888195217f, 0.125788718f},
-std::array<float,2>{0.44687289f, 0.101665415f},
-std::array<float,2>{0.523672044f, 0.511003792f},
-std::array<float,2>{0.203953579f, 0.76897037f},
-std::array<float,2>{0.95674926f, 0.330252469f},
-std::array<float,2>{0.0822986513f, 0.428633362f},
-std::array<float,2>{0.770540416f, 0.964575291f},
-std::array<float,2>{0.361398071f, 0.700767279f},
-std::array<float,2>{0.635038912f, 0.220720172f},
-std::array<float,2>{0.14062649f, 0.160913274f},
-std::array<float,2>{0.910292745f, 0.657592535f},
-std::array<float,2>{0.385633558f, 0.900877893f},
-std::array<float,2>{0.580340207f, 0.483545095f},
-std::array<float,2>{0.275132596f, 0.261186421f},
-std::array<float,2>{0.707646787f, 0.871914387f},
-std::array<float,2>{0.0346675888f, 0.618823409f},
-std::array<float,2>{0.850371659f, 0.0383258462f},
-std::array<float,2>{0.404277027f, 0.143816903f},
-std::array<float,2>{0.575846076f, 0.631363153f},
-std::array<float,2>{0.133646861f, 0.907290637f},
-std::array<float,2>{0.924681008f, 0.446618974f},
-std::array<float,2>{0.0555134155f, 0.283340514f},
-std::array<float,2>{0.863739192f, 0.837703526f},
-std::array<float,2>{0.253908515f, 0.567196131f},
-std::array<float,2>{0.702403188f, 0.0175795201f},
-std::array<float,2>{0.191756353f, 0.0762536079f},
-std::array<float,2>{0.939618647f, 0.538452625f},
-std::array<float,2>{0.468429536f, 0.794606388f},
-std::array<float,2>{0.512856662f, 0.374258459f},
-std::array<float,2>{0.358578831f, 0.375472933f},
-std::array<float,2>{0.654456973f, 0.987495899f},
-std::array<float,2>{0.0728456974f, 0.74940443f},
-std::array<float,2>{0.760150313f, 0.192327052f},
-std::array<float,2>{0.287670642f, 0.0533065721f},
-std::array<float,2>{0.742603719f, 0.599063039f},
-std::array<float,2>{0.0211945381f, 0.854227543f},
-std::array<float,2>{0.8367576f, 0.27175644f},
-std::array<float,2>{0.178381652f, 0.498151571f},
-std::array<float,2>{0.897381723f, 0.879153311f},
-std::array<float,2>{0.417268455f, 0.684182942f},
-std::array<float,2>{0.608261466f, 0.1846333f},
-std::array<float,2>{0.101233289f, 0.237525493f},
-std::array<float,2>{0.788583934f, 0.709669292f},
-std::array<float,2>{0.333432078f, 0.941708565f},
-std::array<float,2>{0.660261571f, 0.40625909f},
-std::array<float,2>{0.477657795f, 0.32118541f},
-std::array<float,2>{0.532357812f, 0.759625137f},
-std::array<float,2>{0.219170436f, 0.519166887f},
-std::array<float,2>{0.995888174f, 0.110545143f},
-std::array<float,2>{0.346745968f, 0.131306797f},
-std::array<float,2>{0.645563483f, 0.652655005f},
-std::array<float,2>{0.0649459288f, 0.9283126f},
-std::array<float,2>{0.751362503f, 0.456478357f},
-std::array<float,2>{0.197931111f, 0.299726933f},
-std::array<float,2>{0.946026206f, 0.821487308f},
-std::array<float,2>{0.45732519f, 0.57943964f},
-std::array<float,2>{0.506464064f, 0.0130168339f},
-std::array<float,2>{0.0515472218f, 0.0783641711f},
-std::array<float,2>{0.874302268f, 0.54726243f},
-std::array<float,2>{0.259591401f, 0.812142253f},
-std::array<float,2>{0.691882432f, 0.350779891f},
-std::array<float,2>{0.391373694f, 0.39970997f},
-std::array<float,2>{0.562660456f, 0.973771155f},
-std::array<float,2>{0.129042104f, 0.723284841f},
-std::array<float,2>{0.935872734f, 0.207619876f},
-std::array<float,2>{0.469651908f, 0.034627378f},
-std::array<float,2>{0.544939697f, 0.622309327f},
-std::array<float,2>{0.228609324f, 0.869930327f},
-std::array<float,2>{0.989103079f, 0.263633937f},
-std::array<float,2>{0.107880212f, 0.480352372f},
-std::array<float,2>{0.790689468f, 0.904593945f},
-std::array<float,2>{0.340875536f, 0.663839817f},
-std::array<float,2>{0.665202916f, 0.157758266f},
-std::array<float,2>{0.18322134f, 0.22587201f},
-std::array<float,2>{0.90047133f, 0.697628558f},
-std::array<float,2>{0.410877764f, 0.96726656f},
-std::array<float,2>{0.599314868f, 0.422135949f},
-std::array<float,2>{0.291722566f, 0.333866417f},
-std::array<float,2>{0.737556994f, 0.772485733f},
-std::array<float,2>{0.0272211023f, 0.512521923f},
-std::array<float,2>{0.83361876f, 0.108234599f},
-std::array<float,2>{0.428876609f, 0.187685579f},
-std::array<float,2>{0.615662277f, 0.743418276f},
-std::array<float,2>{0.171848744f, 0.989692926f},
-std::array<float,2>{0.876214981f, 0.37972185f},
-std::array<float,2>{0.00307110883f, 0.367777318f},
-std::array<float,2>{0.824209273f, 0.790620983f},
-std::array<float,2>{0.299598366f, 0.534350216f},
-std::array<float,2>{0.722572744f, 0.0712735802f},
-std::array<float,2>{0.245603055f, 0.0210031085f},
-std::array<float,2>{0.972868502f, 0.564689577f},
-std::array<float,2>{0.497022897f, 0.843199193f},
-std::array<float,2>{0.549034953f, 0.288579792f},
-std::array<float,2>{0.31924969f, 0.450461119f},
-std::array<float,2>{0.68614471f, 0.911749363f},
-std::array<float,2>{0.116142415f, 0.627101719f},
-std::array<float,2>{0.798436701f, 0.146421164f},
-std::array<float,2>{0.270355791f, 0.116606966f},
-std::array<float,2>{0.712827742f, 0.522909224f},
-std::array<float,2>{0.0443723761f, 0.762689769f},
-std::array<float,2>{0.853214562f, 0.325418144f},
-std::array<float,2>{0.148688123f, 0.413533092f},
-std::array<float,2>{0.921063662f, 0.938614547f},
-std::array<float,2>{0.381905526f, 0.704295516f},
-std::array<float,2>{0.589824259f, 0.239845887f},
-std::array<float,2>{0.0922702178f, 0.181969121f},
-std::array<float,2>{0.774619281f, 0.680228531f},
-std::array<float,2>{0.370528072f, 0.878502488f},
-std::array<float,2>{0.63160038f, 0.495842516f},
-std::array<float,2>{0.442449838f, 0.268794209f},
-std::array<float,2>{0.518689036f, 0.85882926f},
-std::array<float,2>{0.216093481f, 0.595507562f},
-std::array<float,2>{0.965916455f, 0.0499584153f},
-std::array<float,2>{0.31055519f, 0.246688694f},
-std::array<float,2>{0.733562529f, 0.718033612f},
-std::array<float,2>{0.00921151321f, 0.946477115f},
-std::array<float,2>{0.816355348f, 0.416103691f},
-std::array<float,2>{0.158560559f, 0.313405842f},
-std::array<float,2>{0.886337161f, 0.757233858f},
-std::array<float,2>{0.436422557f, 0.525005996f},
-std::array<float,2>{0.623369157f, 0.123075388f},
-std::array<float,2>{0.124645144f, 0.0575562976f},
-std::array<float,2>{0.812207043f, 0.605200231f},
-std::array<float,2>{0.327039719f, 0.847792327f},
-std::array<float,2>{0.672004223f, 0.280871361f},
-std::array<float,2>{0.484522879f, 0.486476123f},
-std::array<float,2>{0.560907066f, 0.886000574f},
-std::array<float,2>{0.236863494f, 0.678505301f},
-std::array<float,2>{0.977474272f, 0.17260915f},
-std::array<float,2>{0.388061076f, 0.0681527555f},
-std::array<float,2>{0.583399117f, 0.539561987f},
-std::array<float,2>{0.144636571f, 0.78373313f},
-std::array<float,2>{0.90786165f, 0.364335507f},
-std::array<float,2>{0.0379837304f, 0.383987516f},
-std::array<float,2>{0.84591049f, 0.994558692f},
-std::array<float,2>{0.279853672f, 0.735792339f},
-std::array<float,2>{0.70407176f, 0.202899292f},
-std::array<float,2>{0.207843512f, 0.152523309f},
-std::array<float,2>{0.958267987f, 0.634195924f},
-std::array<float,2>{0.450160533f, 0.918162048f},
-std::array<float,2>{0.527685046f, 0.44321385f},
-std::array<float,2>{0.363907933f, 0.295244932f},
-std::array<float,2>{0.638547242f, 0.833585143f},
-std::array<float,2>{0.0782013834f, 0.571709931f},
-std::array<float,2>{0.769105732f, 0.0268440098f},
-std::array<float,2>{0.462997943f, 0.164490998f},
-std::array<float,2>{0.508802295f, 0.668676019f},
-std::array<float,2>{0.188880339f, 0.895691216f},
-std::array<float,2>{0.942724824f, 0.475436419f},
-std::array<float,2>{0.0773739293f, 0.256457925f},
-std::array<float,2>{0.764041901f, 0.86282599f},
-std::array<float,2>{0.351684391f, 0.613409817f},
-std::array<float,2>{0.649953961f, 0.0402924307f},
-std::array<float,2>{0.137755632f, 0.0948438793f},
-std::array<float,2>{0.927748859f, 0.500189662f},
-std::array<float,2>{0.399960816f, 0.778840661f},
-std::array<float,2>{0.571998656f, 0.342227131f},
-std::array<float,2>{0.251971394f, 0.433358699f},
-std::array<float,2>{0.697751522f, 0.958096623f},
-std::array<float,2>{0.0598915517f, 0.690786064f},
-std::array<float,2>{0.86272341f, 0.23295556f},
-std::array<float,2>{0.329538256f, 0.0001383989f},
-std::array<float,2>{0.659638703f, 0.588502884f},
-std::array<float,2>{0.0954134613f, 0.815311372f},
-std::array<float,2>{0.783835292f, 0.307528734f},
-std::array<float,2>{0.225960463f, 0.468627721f},
-std::array<float,2>{0.999499142f, 0.930773199f},
-std::array<float,2>{0.481113911f, 0.644707799f},
-std::array<float,2>{0.535763085f, 0.138533175f},
-std::array<float,2>{0.0180835649f, 0.212082461f},
-std::array<float,2>{0.840170681f, 0.728020072f},
-std::array<float,2>{0.284562796f, 0.984224617f},
-std::array<float,2>{0.749120712f, 0.395163f},
-std::array<float,2>{0.42040509f, 0.354383796f},
-std::array<float,2>{0.603078365f, 0.797782302f},
-std::array<float,2>{0.17416662f, 0.558587909f},
-std::array<float,2>{0.890776575f, 0.0902464837f},
-std::array<float,2>{0.290778697f, 0.156652868f},
-std::array<float,2>{0.736289799f, 0.662140429f},
-std::array<float,2>{0.0252386183f, 0.906027019f},
-std::array<float,2>{0.835287035f, 0.478882939f},
-std::array<float,2>{0.18013981f, 0.262619644f},
-std::array<float,2>{0.898748159f, 0.871002376f},
-std::array<float,2>{0.413836837f, 0.621492803f},
-std::array<float,2>{0.601171851f, 0.0340532288f},
-std::array<float,2>{0.10662993f, 0.10864865f},
-std::array<float,2>{0.791363776f, 0.51321286f},
-std::array<float,2>{0.34306401f, 0.772375107f},
-std::array<float,2>{0.667631328f, 0.332586348f},
-std::array<float,2>{0.471777171f, 0.423053712f},
-std::array<float,2>{0.544617951f, 0.96831274f},
-std::array<float,2>{0.22786653f, 0.698797703f},
-std::array<float,2>{0.992047489f, 0.225418046f},
-std::array<float,2>{0.393576294f, 0.01256321f},
-std::array<float,2>{0.566296339f, 0.578273773f},
-std::array<float,2>{0.1317994f, 0.82077384f},
-std::array<float,2>{0.934634328f, 0.299850374f},
-std::array<float,2>{0.0533864386f, 0.455137998f},
-std::array<float,2>{0.871579587f, 0.929572046f},
-std::array<float,2>{0.259956598f, 0.653721273f},
-std::array<float,2>{0.693362296f, 0.132665947f},
-std::array<float,2>{0.196852058f, 0.208391681f},
-std::array<float,2>{0.948997855f, 0.723785877f},
-std::array<float,2>{0.460666597f, 0.973397195f},
-std::array<float,2>{0.504588366f, 0.398616999f},
-std::array<float,2>{0.344808817f, 0.350049227f},
-std::array<float,2>{0.648187101f, 0.810599685f},
-std::array<float,2>{0.0625955164f, 0.547925651f},
-std::array<float,2>{0.753680944f, 0.0791530088f},
-std::array<float,2>{0.444773287f, 0.238554582f},
-std::array<float,2>{0.51587069f, 0.70325321f},
-std::array<float,2>{0.21865122f, 0.937837183f},
-std::array<float,2>{0.96721226f, 0.412729919f},
-std::array<float,2>{0.0916885138f, 0.324290663f},
-std::array<float,2>{0.777194917f, 0.763322532f},
-std::array<float,2>{0.367841214f, 0.522172511f},
-std::array<float,2>{0.62981832f, 0.11574588f},
-std::array<float,2>{0.150630772f, 0.0493460596f},
-std::array<float,2>{0.918714225f, 0.594281197f},
-std::array<float,2>{0.379063398f, 0.857809722f},
-std::array<float,2>{0.587872982f, 0.26836127f},
-std::array<float,2>{0.272610486f, 0.494812608f},
-std::array<float,2>{0.71447885f, 0.877859354f},
-std::array<float,2>{0.0464393385f, 0.681224525f},
-std::array<float,2>{0.853703618f, 0.182700038f},
-std::array<float,2>{0.317558259f, 0.0716474503f},
-std::array<float,2>{0.684009373f, 0.533967257f},
-std::array<float,2>{0.114069402f, 0.789521694f},
-std::array<float,2>{0.79919523f, 0.36897099f},
-std::array<float,2>{0.242819682f, 0.380023837f},
-std::array<float,2>{0.97585094f, 0.988968968f},
-std::array<float,2>{0.499550581f, 0.74223274f},
-std::array<float,2>{0.547951639f, 0.188940421f},
-std::array<float,2>{0.000371114817f, 0.14547655f},
-std::array<float,2>{0.821767986f, 0.628561676f},
-std::array<float,2>{0.298347652f, 0.910646379f},
-std::array<float,2>{0.720212221f, 0.449679494f},
-std::array<float,2>{0.426793933f, 0.287320703f},
-std::array<float,2>{0.613397598f, 0.842023134f},
-std::array<float,2>{0.169806406f, 0.565460384f},
-std::array<float,2>{0.878803968f, 0.0198159255f},
-std::array<float,2>{0.365866691f, 0.201747283f},
-std::array<float,2>{0.639811099f, 0.734375477f},
-std::array<float,2>{0.0807020068f, 0.996081114f},
-std::array<float,2>{0.766449988f, 0.383568674f},
-std::array<float,2>{0.2098113f, 0.363969117f},
-std::array<float,2>{0.959256589f, 0.78475225f},
-std::array<float,2>{0.452936113f, 0.540137291f},
-std::array<float,2>{0.530676007f, 0.067314662f},
-std::array<float,2>{0.0360233895f, 0.0255755205f},
-std::array<float,2>{0.843992651f, 0.570988715f},
-std::array<float,2>{0.277629435f, 0.832431674f},
-std::array<float,2>{0.706307471f, 0.296026856f},
-std::array<float,2>{0.388864398f, 0.442225218f},
-std::array<float,2>{0.584003389f, 0.919346094f},
-std::array<float,2>{0.14676635f, 0.632819891f},
-std::array<float,2>{0.908557117f, 0.153934434f},
-std::array<float,2>{0.48693943f, 0.124118209f},
-std::array<float,2>{0.560423911f, 0.523498297f},
-std::array<float,2>{0.234894082f, 0.756189764f},
-std::array<float,2>{0.9787305f, 0.314009488f},
-std::array<float,2>{0.121926263f, 0.417210162f},
-std::array<float,2>{0.809649825f, 0.945504308f},
-std::array<float,2>{0.325105458f, 0.717442274f},
-std::array<float,2>{0.67502445f, 0.247518063f},
-std::array<float,2>{0.157129034f, 0.172896504f},
-std::array<float,2>{0.884762883f, 0.678737938f},
-std::array<float,2>{0.435054481f, 0.884876966f},
-std::array<float,2>{0.621175647f, 0.488194883f},
-std::array<float,2>{0.309746414f, 0.279791266f},
-std::array<float,2>{0.731010616f, 0.84903127f},
-std::array<float,2>{0.0103512155f, 0.603912532f},
-std::array<float,2>{0.814059138f, 0.0576439276f},
-std::array<float,2>{0.418307275f, 0.137113675f},
-std::array<float,2>{0.605338454f, 0.645937026f},
-std::array<float,2>{0.173507914f, 0.930359304f},
-std::array<float,2>{0.893981516f, 0.467087805f},
-std::array<float,2>{0.0173833352f, 0.308405727f},
-std::array<float,2>{0.841879368f, 0.815598905f},
-std::array<float,2>{0.28129819f, 0.589266956f},
-std::array<float,2>{0.747259974f, 0.00113407127f},
-std::array<float,2>{0.223228738f, 0.0909220353f},
-std::array<float,2>{0.99732846f, 0.557078779f},
-std::array<float,2>{0.483720332f, 0.798809767f},
-std::array<float,2>{0.537172318f, 0.354680479f},
-std::array<float,2>{0.330459148f, 0.396025956f},
-std::array<float,2>{0.656395912f, 0.983338833f},
-std::array<float,2>{0.0960334763f, 0.726838052f},
-std::array<float,2>{0.783013821f, 0.211384013f},
-std::array<float,2>{0.250258923f, 0.0395017266f},
-std::array<float,2>{0.696667373f, 0.614565372f},
-std::array<float,2>{0.0624809042f, 0.862093389f},
-std::array<float,2>{0.860960007f, 0.257532716f},
-std::array<float,2>{0.139316231f, 0.475641102f},
-std::array<float,2>{0.927230418f, 0.89472872f},
-std::array<float,2>{0.400905371f, 0.669325829f},
-std::array<float,2>{0.573340058f, 0.165536359f},
-std::array<float,2>{0.0749036595f, 0.233548f},
-std::array<float,2>{0.762988269f, 0.689950705f},
-std::array<float,2>{0.353773654f, 0.957094371f},
-std::array<float,2>{0.651295722f, 0.432130545f},
-std::array<float,2>{0.462719768f, 0.343458861f},
-std::array<float,2>{0.510221839f, 0.777775049f},
-std::array<float,2>{0.191278458f, 0.501055837f},
-std::array<float,2>{0.944440603f, 0.0944757387f},
-std::array<float,2>{0.339348257f, 0.151082993f},
-std::array<float,2>{0.670163751f, 0.637977362f},
-std::array<float,2>{0.10312587f, 0.917347729f},
-std::array<float,2>{0.796609819f, 0.441355914f},
-std::array<float,2>{0.233016789f, 0.292680591f},
-std::array<float,2>{0.985501528f, 0.831397712f},
-std::array<float,2>{0.476238072f, 0.575866222f},
-std::array<float,2>{0.540240049f, 0.0284456816f},
-std::array<float,2>{0.0305398516f, 0.0627890378f},
-std::array<float,2>{0.82947892f, 0.545664251f},
-std::array<float,2>{0.296763182f, 0.787242234f},
-std::array<float,2>{0.739934444f, 0.361395031f},
-std::array<float,2>{0.408977598f, 0.387372404f},
-std::array<float,2>{0.597324193f, 0.99733001f},
-std::array<float,2>{0.18503283f, 0.739698052f},
-std::array<float,2>{0.90273118f, 0.197884023f},
-std::array<float,2>{0.454401225f, 0.0599177778f},
-std::array<float,2>{0.502926767f, 0.607383072f},
-std::array<float,2>{0.202252015f, 0.845239222f},
-std::array<float,2>{0.949417531f, 0.275817722f},
-std::array<float,2>{0.0684451833f, 0.491476089f},
-std::array<float,2>{0.757581353f, 0.88831532f},
-std::array<float,2>{0.347899199f, 0.673328221f},
-std::array<float,2>{0.64065671f, 0.178080603f},
-std::array<float,2>{0.125274748f, 0.243375018f},
-std::array<float,2>{0.932948053f, 0.714441359f},
-std::array<float,2>{0.397609323f, 0.951864243f},
-std::array<float,2>{0.566576123f, 0.419908732f},
-std::array<float,2>{0.265612096f, 0.316491723f},
-std::array<float,2>{0.688851953f, 0.752812624f},
-std::array<float,2>{0.0484354272f, 0.528233826f},
-std::array<float,2>{0.869166613f, 0.120455511f},
-std::array<float,2>{0.376734167f, 0.217094138f},
-std::array<float,2>{0.591505289f, 0.7333287f},
-std::array<float,2>{0.155001715f, 0.978577316f},
-std::array<float,2>{0.917196929f, 0.394196182f},
-std::array<float,2>{0.0424136892f, 0.355688214f},
-std::array<float,2>{0.858797252f, 0.80097717f},
-std::array<float,2>{0.266994506f, 0.55986917f},
-std::array<float,2>{0.715695441f, 0.0860828683f},
-std::array<float,2>{0.213847369f, 0.00700931903f},
-std::array<float,2>{0.962773502f, 0.593683958f},
-std::array<float,2>{0.44092539f, 0.819743335f},
-std::array<float,2>{0.520520508f, 0.309996963f},
-std::array<float,2>{0.371478379f, 0.461387187f},
-std::array<float,2>{0.626195312f, 0.9360708f},
-std::array<float,2>{0.0894130543f, 0.643473864f},
-std::array<float,2>{0.780612707f, 0.133254915f},
-std::array<float,2>{0.302419901f, 0.10034167f},
-std::array<float,2>{0.7264781f, 0.506872833f},
-std::array<float,2>{0.00573479943f, 0.7766366f},
-std::array<float,2>{0.827567935f, 0.339311212f},
-std::array<float,2>{0.164288417f, 0.435168147f},
-std::array<float,2>{0.879944623f, 0.953346252f},
-std::array<float,2>{0.4222956f, 0.69303298f},
-std::array<float,2>{0.611995876f, 0.229840204f},
-std::array<float,2>{0.11041221f, 0.17119877f},
-std::array<float,2>{0.801699579f, 0.66601783f},
-std::array<float,2>{0.315143555f, 0.893418729f},
-std::array<float,2>{0.682559907f, 0.470667034f},
-std::array<float,2>{0.495488405f, 0.251903027f},
-std::array<float,2>{0.554551721f, 0.864212871f},
-std::array<float,2>{0.249476954f, 0.610594809f},
-std::array<float,2>{0.970386982f, 0.0430467427f},
-std::array<float,2>{0.277088463f, 0.221825138f},
-std::array<float,2>{0.709178507f, 0.699477851f},
-std::array<float,2>{0.0312950276f, 0.963819563f},
-std::array<float,2>{0.848759651f, 0.42884171f},
-std::array<float,2>{0.144148931f, 0.331625223f},
-std::array<float,2>{0.912852824f, 0.768190861f},
-std::array<float,2>{0.384249002f, 0.509809971f},
-std::array<float,2>{0.579834998f, 0.103321292f},
-std::array<float,2>{0.0855663493f, 0.0373380072f},
-std::array<float,2>{0.772612631f, 0.617279172f},
-std::array<float,2>{0.360877842f, 0.872760653f},
-std::array<float,2>{0.633819282f, 0.26008904f},
-std::array<float,2>{0.447607428f, 0.483217686f},
-std::array<float,2>{0.525974691f, 0.901417732f},
-std::array<float,2>{0.205324605f, 0.657136142f},
-std::array<float,2>{0.953866124f, 0.161167622f},
-std::array<float,2>{0.429822892f, 0.0835685655f},
-std::array<float,2>{0.620818496f, 0.552898884f},
-std::array<float,2>{0.160572469f, 0.80640161f},
-std::array<float,2>{0.889960527f, 0.34401682f},
-std::array<float,2>{0.0123053733f, 0.405556321f},
-std::array<float,2>{0.81643194f, 0.970760345f},
-std::array<float,2>{0.306584537f, 0.722041368f},
-std::array<float,2>{0.728638947f, 0.203941002f},
-std::array<float,2>{0.239683434f, 0.126169547f},
-std::array<float,2>{0.982743502f, 0.650363147f},
-std::array<float,2>{0.491794765f, 0.92273432f},
-std::array<float,2>{0.55479753f, 0.458402038f},
-std::array<float,2>{0.322701335f, 0.301709175f},
-std::array<float,2>{0.677548528f, 0.826074243f},
-std::array<float,2>{0.118843362f, 0.583337367f},
-std::array<float,2>{0.805251718f, 0.0112775099f},
-std::array<float,2>{0.479340136f, 0.18401067f},
-std::array<float,2>{0.534241617f, 0.685517788f},
-std::array<float,2>{0.221616313f, 0.879995227f},
-std::array<float,2>{0.993763149f, 0.499517441f},
-std::array<float,2>{0.0995150879f, 0.273320138f},
-std::array<float,2>{0.786001563f, 0.855333388f},
-std::array<float,2>{0.334034562f, 0.598445058f},
-std::array<float,2>{0.664014876f, 0.0539880432f},
-std::array<float,2>{0.177714318f, 0.109867923f},
-std::array<float,2>{0.895350277f, 0.51784271f},
-std::array<float,2>{0.414939493f, 0.758777678f},
-std::array<float,2>{0.605867624f, 0.321877509f},
-std::array<float,2>{0.285392702f, 0.407981277f},
-std::array<float,2>{0.74485147f, 0.942693472f},
-std::array<float,2>{0.0229782294f, 0.710577548f},
-std::array<float,2>{0.839156806f, 0.237191409f},
-std::array<float,2>{0.355803847f, 0.0187244434f},
-std::array<float,2>{0.65372473f, 0.567541897f},
-std::array<float,2>{0.0716256127f, 0.836736321f},
-std::array<float,2>{0.759428322f, 0.284876108f},
-std::array<float,2>{0.194748387f, 0.445696622f},
-std::array<float,2>{0.93882823f, 0.907040775f},
-std::array<float,2>{0.465294987f, 0.632006466f},
-std::array<float,2>{0.515036583f, 0.142835587f},
-std::array<float,2>{0.0569517501f, 0.193303987f},
-std::array<float,2>{0.865263999f, 0.748495221f},
-std::array<float,2>{0.256450802f, 0.986451149f},
-std::array<float,2>{0.70020026f, 0.376602471f},
-std::array<float,2>{0.406152099f, 0.373116702f},
-std::array<float,2>{0.577988923f, 0.793552339f},
-std::array<float,2>{0.135681733f, 0.537234843f},
-std::array<float,2>{0.922210872f, 0.0778252631f},
-std::array<float,2>{0.25946933f, 0.13061446f},
-std::array<float,2>{0.691551924f, 0.655687332f},
-std::array<float,2>{0.0515080467f, 0.9267416f},
-std::array<float,2>{0.874054134f, 0.453234464f},
-std::array<float,2>{0.129214138f, 0.298281044f},
-std::array<float,2>{0.935566306f, 0.822921515f},
-std::array<float,2>{0.391209453f, 0.580128431f},
-std::array<float,2>{0.562913954f, 0.0139693897f},
-std::array<float,2>{0.0652756393f, 0.0807703361f},
-std::array<float,2>{0.751208007f, 0.549977183f},
-std::array<float,2>{0.347125351f, 0.809426606f},
-std::array<float,2>{0.645943463f, 0.348976254f},
-std::array<float,2>{0.457188338f, 0.400970936f},
-std::array<float,2>{0.506804287f, 0.975432813f},
-std::array<float,2>{0.198205739f, 0.72552526f},
-std::array<float,2>{0.946115851f, 0.210575342f},
-std::array<float,2>{0.410987556f, 0.0321847647f},
-std::array<float,2>{0.599397182f, 0.623354197f},
-std::array<float,2>{0.183490202f, 0.867719412f},
-std::array<float,2>{0.900845766f, 0.264091969f},
-std::array<float,2>{0.0269578304f, 0.477686286f},
-std::array<float,2>{0.833800614f, 0.902879596f},
-std::array<float,2>{0.291847527f, 0.661553919f},
-std::array<float,2>{0.737306654f, 0.158581346f},
-std::array<float,2>{0.228908256f, 0.224488139f},
-std::array<float,2>{0.988810718f, 0.696120501f},
-std::array<float,2>{0.469421893f, 0.966789842f},
-std::array<float,2>{0.545358121f, 0.425174415f},
-std::array<float,2>{0.341175437f, 0.335893273f},
-std::array<float,2>{0.665392816f, 0.771116018f},
-std::array<float,2>{0.107616365f, 0.51505363f},
-std::array<float,2>{0.790837526f, 0.105760895f},
-std::array<float,2>{0.49673298f, 0.189830884f},
-std::array<float,2>{0.549162626f, 0.745864153f},
-std::array<float,2>{0.245324597f, 0.991907656f},
-std::array<float,2>{0.973133981f, 0.381336927f},
-std::array<float,2>{0.115831546f, 0.370651215f},
-std::array<float,2>{0.798723876f, 0.791039109f},
-std::array<float,2>{0.318942368f, 0.531553388f},
-std::array<float,2>{0.686381161f, 0.0726977736f},
-std::array<float,2>{0.171593815f, 0.022501234f},
-std::array<float,2>{0.876306593f, 0.563055158f},
-std::array<float,2>{0.429191917f, 0.841544747f},
-std::array<float,2>{0.615259469f, 0.285382241f},
-std::array<float,2>{0.299498826f, 0.451720029f},
-std::array<float,2>{0.722369254f, 0.912727952f},
-std::array<float,2>{0.00337470346f, 0.626653731f},
-std::array<float,2>{0.823904097f, 0.147058472f},
-std::array<float,2>{0.37018615f, 0.114177637f},
-std::array<float,2>{0.631444693f, 0.520241857f},
-std::array<float,2>{0.0920303166f, 0.765011489f},
-std::array<float,2>{0.774752378f, 0.326319218f},
-std::array<float,2>{0.21596989f, 0.411506116f},
-std::array<float,2>{0.96607089f, 0.940111756f},
-std::array<float,2>{0.442858636f, 0.706973314f},
-std::array<float,2>{0.518855989f, 0.240704715f},
-std::array<float,2>{0.0441227518f, 0.1808431f},
-std::array<float,2>{0.853306592f, 0.683356583f},
-std::array<float,2>{0.270218283f, 0.875651538f},
-std::array<float,2>{0.712599576f, 0.492328793f},
-std::array<float,2>{0.382189989f, 0.265795112f},
-std::array<float,2>{0.58939141f, 0.85624963f},
-std::array<float,2>{0.14867489f, 0.595989048f},
-std::array<float,2>{0.921352565f, 0.0482650623f},
-std::array<float,2>{0.326741338f, 0.249621779f},
-std::array<float,2>{0.672355652f, 0.715095639f},
-std::array<float,2>{0.124820694f, 0.94745177f},
-std::array<float,2>{0.812339723f, 0.414302945f},
-std::array<float,2>{0.237098277f, 0.314724416f},
-std::array<float,2>{0.977150023f, 0.754624069f},
-std::array<float,2>{0.484855562f, 0.527111948f},
-std::array<float,2>{0.560553491f, 0.122067243f},
-std::array<float,2>{0.0088554034f, 0.056055136f},
-std::array<float,2>{0.816142619f, 0.602018356f},
-std::array<float,2>{0.311034799f, 0.851307452f},
-std::array<float,2>{0.733845651f, 0.279264659f},
-std::array<float,2>{0.436203897f, 0.484677255f},
-std::array<float,2>{0.623216331f, 0.883763969f},
-std::array<float,2>{0.158245042f, 0.676719725f},
-std::array<float,2>{0.8865031f, 0.17425175f},
-std::array<float,2>{0.449750781f, 0.068429254f},
-std::array<float,2>{0.527362585f, 0.541086018f},
-std::array<float,2>{0.207520023f, 0.781270385f},
-std::array<float,2>{0.958165765f, 0.365565956f},
-std::array<float,2>{0.0783792734f, 0.386308044f},
-std::array<float,2>{0.769290328f, 0.992551863f},
-std::array<float,2>{0.364253908f, 0.737408578f},
-std::array<float,2>{0.638320744f, 0.20025143f},
-std::array<float,2>{0.144908711f, 0.156117231f},
-std::array<float,2>{0.908040464f, 0.635735273f},
-std::array<float,2>{0.387786329f, 0.921540499f},
-std::array<float,2>{0.583095312f, 0.444765002f},
-std::array<float,2>{0.280113786f, 0.293217748f},
-std::array<float,2>{0.703690946f, 0.83438462f},
-std::array<float,2>{0.0376742259f, 0.574037373f},
-std::array<float,2>{0.846037269f, 0.0249038506f},
-std::array<float,2>{0.400297314f, 0.166058928f},
-std::array<float,2>{0.57209003f, 0.671608329f},
-std::array<float,2>{0.138111845f, 0.896848619f},
-std::array<float,2>{0.928049088f, 0.473125815f},
-std::array<float,2>{0.0597996935f, 0.254296839f},
-std::array<float,2>{0.862465084f, 0.859628499f},
-std::array<float,2>{0.252219945f, 0.616756082f},
-std::array<float,2>{0.697481632f, 0.0421900302f},
-std::array<float,2>{0.188586459f, 0.0970027819f},
-std::array<float,2>{0.942506254f, 0.503801346f},
-std::array<float,2>{0.46319145f, 0.780878663f},
-std::array<float,2>{0.509139776f, 0.340200961f},
-std::array<float,2>{0.351829708f, 0.430543751f},
-std::array<float,2>{0.650291681f, 0.960466623f},
-std::array<float,2>{0.0775062218f, 0.687880635f},
-std::array<float,2>{0.763823509f, 0.231153235f},
-std::array<float,2>{0.2843979f, 0.00286445906f},
-std::array<float,2>{0.749424875f, 0.587102354f},
-std::array<float,2>{0.0183655564f, 0.81253171f},
-std::array<float,2>{0.839886546f, 0.306427002f},
-std::array<float,2>{0.173940837f, 0.46550405f},
-std::array<float,2>{0.890974462f, 0.93300426f},
-std::array<float,2>{0.419962615f, 0.648415923f},
-std::array<float,2>{0.603443563f, 0.139169097f},
-std::array<float,2>{0.0956598818f, 0.21457845f},
-std::array<float,2>{0.784139395f, 0.728717327f},
-std::array<float,2>{0.329238892f, 0.982198477f},
-std::array<float,2>{0.659418881f, 0.397628188f},
-std::array<float,2>{0.481371164f, 0.35217157f},
-std::array<float,2>{0.536128223f, 0.799823284f},
-std::array<float,2>{0.225736961f, 0.55535394f},
-std::array<float,2>{0.999138832f, 0.0931354389f},
-std::array<float,2>{0.350310922f, 0.176745772f},
-std::array<float,2>{0.64386034f, 0.675154686f},
-std::array<float,2>{0.0667270944f, 0.889237881f},
-std::array<float,2>{0.754353821f, 0.488955855f},
-std::array<float,2>{0.19961381f, 0.273464531f},
-std::array<float,2>{0.952861428f, 0.846302986f},
-std::array<float,2>{0.456567973f, 0.607779205f},
-std::array<float,2>{0.500640035f, 0.0608727708f},
-std::array<float,2>{0.0505798422f, 0.118744902f},
-std::array<float,2>{0.868091583f, 0.53094399f},
-std::array<float,2>{0.262052119f, 0.750673771f},
-std::array<float,2>{0.690097153f, 0.318609178f},
-std::array<float,2>{0.394805789f, 0.42061606f},
-std::array<float,2>{0.568404257f, 0.950490832f},
-std::array<float,2>{0.127351657f, 0.710990191f},
-std::array<float,2>{0.930842578f, 0.244247213f},
-std::array<float,2>{0.473469406f, 0.0293828137f},
-std::array<float,2>{0.542663991f, 0.57732749f},
-std::array<float,2>{0.231483161f, 0.828628957f},
-std::array<float,2>{0.987955153f, 0.290076971f},
-std::array<float,2>{0.104541995f, 0.437827021f},
-std::array<float,2>{0.794533372f, 0.914635837f},
-std::array<float,2>{0.337183446f, 0.639629066f},
-std::array<float,2>{0.669849813f, 0.150102645f},
-std::array<float,2>{0.186948434f, 0.196819291f},
-std::array<float,2>{0.904773951f, 0.741717458f},
-std::array<float,2>{0.407900333f, 0.999842703f},
-std::array<float,2>{0.594121277f, 0.390458792f},
-std::array<float,2>{0.294014692f, 0.360535115f},
-std::array<float,2>{0.740498245f, 0.785464287f},
-std::array<float,2>{0.0284106787f, 0.544345796f},
-std::array<float,2>{0.830416501f, 0.0646961555f},
-std::array<float,2>{0.425047636f, 0.228248551f},
-std::array<float,2>{0.610269666f, 0.693525076f},
-std::array<float,2>{0.167151153f, 0.955379307f},
-std::array<float,2>{0.881260693f, 0.43576327f},
-std::array<float,2>{0.00737990346f, 0.337448061f},
-std::array<float,2>{0.825679004f, 0.774301589f},
-std::array<float,2>{0.304034472f, 0.505711317f},
-std::array<float,2>{0.722927809f, 0.0983314589f},
-std::array<float,2>{0.247087911f, 0.0450197496f},
-std::array<float,2>{0.971937001f, 0.611972213f},
-std::array<float,2>{0.492655009f, 0.866776347f},
-std::array<float,2>{0.552222311f, 0.252463073f},
-std::array<float,2>{0.313375235f, 0.471219003f},
-std::array<float,2>{0.679877102f, 0.891726315f},
-std::array<float,2>{0.112205751f, 0.665184319f},
-std::array<float,2>{0.803272247f, 0.169761792f},
-std::array<float,2>{0.267720222f, 0.0893906876f},
-std::array<float,2>{0.717265606f, 0.560559213f},
-std::array<float,2>{0.0403045677f, 0.803073823f},
-std::array<float,2>{0.857092679f, 0.357868493f},
-std::array<float,2>{0.154182583f, 0.390821993f},
-std::array<float,2>{0.914083898f, 0.977129877f},
-std::array<float,2>{0.378427744f, 0.731758296f},
-std::array<float,2>{0.592052042f, 0.216435507f},
-std::array<float,2>{0.0860690176f, 0.135092422f},
-std::array<float,2>{0.778386295f, 0.640904963f},
-std::array<float,2>{0.373060852f, 0.935009956f},
-std::array<float,2>{0.62717706f, 0.463814259f},
-std::array<float,2>{0.437632591f, 0.312049031f},
-std::array<float,2>{0.522351325f, 0.817805529f},
-std::array<float,2>{0.211349308f, 0.59060359f},
-std::array<float,2>{0.964333355f, 0.00504327333f},
-std::array<float,2>{0.3081972f, 0.20561263f},
-std::array<float,2>{0.727094114f, 0.719840705f},
-std::array<float,2>{0.0145360706f, 0.969218254f},
-std::array<float,2>{0.819592476f, 0.404027611f},
-std::array<float,2>{0.162146598f, 0.346390784f},
-std::array<float,2>{0.88866818f, 0.80665648f},
-std::array<float,2>{0.433271587f, 0.551247597f},
-std::array<float,2>{0.617796898f, 0.0853778869f},
-std::array<float,2>{0.120133556f, 0.00799609907f},
-std::array<float,2>{0.806892812f, 0.584990501f},
-std::array<float,2>{0.321138352f, 0.826213419f},
-std::array<float,2>{0.679488361f, 0.303875983f},
-std::array<float,2>{0.488841265f, 0.460379183f},
-std::array<float,2>{0.557038844f, 0.924566329f},
-std::array<float,2>{0.240965217f, 0.650555491f},
-std::array<float,2>{0.981198907f, 0.128283739f},
-std::array<float,2>{0.385394037f, 0.104239367f},
-std::array<float,2>{0.580095112f, 0.50865984f},
-std::array<float,2>{0.141044959f, 0.767539501f},
-std::array<float,2>{0.910544455f, 0.329979479f},
-std::array<float,2>{0.0343751237f, 0.42714566f},
-std::array<float,2>{0.850143671f, 0.961468399f},
-std::array<float,2>{0.275375783f, 0.702804029f},
-std::array<float,2>{0.707771301f, 0.218892142f},
-std::array<float,2>{0.203831613f, 0.162906215f},
-std::array<float,2>{0.956964731f, 0.659630477f},
-std::array<float,2>{0.44711256f, 0.898968816f},
-std::array<float,2>{0.523855507f, 0.481088191f},
-std::array<float,2>{0.361630797f, 0.259007037f},
-std::array<float,2>{0.634982288f, 0.874853611f},
-std::array<float,2>{0.0822151303f, 0.620930314f},
-std::array<float,2>{0.770882666f, 0.0354886763f},
-std::array<float,2>{0.468622386f, 0.141269714f},
-std::array<float,2>{0.513109267f, 0.629594862f},
-std::array<float,2>{0.191467673f, 0.91012466f},
-std::array<float,2>{0.939751327f, 0.448002666f},
-std::array<float,2>{0.0731974244f, 0.281628758f},
-std::array<float,2>{0.75981015f, 0.838856936f},
-std::array<float,2>{0.358730912f, 0.56858182f},
-std::array<float,2>{0.654709697f, 0.0171110667f},
-std::array<float,2>{0.133322835f, 0.0750041083f},
-std::array<float,2>{0.924457133f, 0.535546482f},
-std::array<float,2>{0.403972805f, 0.796783268f},
-std::array<float,2>{0.576097965f, 0.372436196f},
-std::array<float,2>{0.254217982f, 0.377977848f},
-std::array<float,2>{0.702217162f, 0.985487938f},
-std::array<float,2>{0.0553532206f, 0.746222079f},
-std::array<float,2>{0.863453746f, 0.194248438f},
-std::array<float,2>{0.333059996f, 0.0523159765f},
-std::array<float,2>{0.660636246f, 0.600640297f},
-std::array<float,2>{0.101478912f, 0.852621257f},
-std::array<float,2>{0.788992226f, 0.26962769f},
-std::array<float,2>{0.218751952f, 0.497822285f},
-std::array<float,2>{0.995728672f, 0.882420897f},
-std::array<float,2>{0.478006214f, 0.685633421f},
-std::array<float,2>{0.532626092f, 0.186066225f},
-std::array<float,2>{0.0213570222f, 0.235575318f},
-std::array<float,2>{0.836652696f, 0.707877398f},
-std::array<float,2>{0.287970334f, 0.943878055f},
-std::array<float,2>{0.742350399f, 0.409057319f},
-std::array<float,2>{0.417167068f, 0.323720723f},
-std::array<float,2>{0.607933104f, 0.760415733f},
-std::array<float,2>{0.178571567f, 0.516309142f},
-std::array<float,2>{0.897046208f, 0.112575248f},
-std::array<float,2>{0.296987385f, 0.147780433f},
-std::array<float,2>{0.719308078f, 0.625973463f},
-std::array<float,2>{0.00169735414f, 0.913516164f},
-std::array<float,2>{0.820555449f, 0.452982575f},
-std::array<float,2>{0.168928176f, 0.286865801f},
-std::array<float,2>{0.877621353f, 0.840638936f},
-std::array<float,2>{0.426073313f, 0.564262748f},
-std::array<float,2>{0.614619136f, 0.021706339f},
-std::array<float,2>{0.114870399f, 0.073615849f},
-std::array<float,2>{0.799910069f, 0.533062756f},
-std::array<float,2>{0.317326427f, 0.792540133f},
-std::array<float,2>{0.684864879f, 0.369236499f},
-std::array<float,2>{0.49873513f, 0.38226977f},
-std::array<float,2>{0.547299802f, 0.990908146f},
-std::array<float,2>{0.243494406f, 0.744668126f},
-std::array<float,2>{0.974763393f, 0.190456405f},
-std::array<float,2>{0.380348116f, 0.0474519171f},
-std::array<float,2>{0.586582601f, 0.597109914f},
-std::array<float,2>{0.151789412f, 0.857043624f},
-std::array<float,2>{0.919010341f, 0.26730594f},
-std::array<float,2>{0.0452581793f, 0.493863404f},
-std::array<float,2>{0.854628384f, 0.876213312f},
-std::array<float,2>{0.27239415f, 0.682074189f},
-std::array<float,2>{0.71342355f, 0.18045941f},
-std::array<float,2>{0.217672348f, 0.242130294f},
-std::array<float,2>{0.968021333f, 0.705267966f},
-std::array<float,2>{0.444291502f, 0.941246033f},
-std::array<float,2>{0.51727581f, 0.410544038f},
-std::array<float,2>{0.368307799f, 0.327445835f},
-std::array<float,2>{0.630119085f, 0.764517069f},
-std::array<float,2>{0.090152137f, 0.521483243f},
-std::array<float,2>{0.775512278f, 0.114632003f},
-std::array<float,2>{0.459887207f, 0.209131107f},
-std::array<float,2>{0.505084157f, 0.725972176f},
-std::array<float,2>{0.196149021f, 0.975701094f},
-std::array<float,2>{0.947452068f, 0.401673973f},
-std::array<float,2>{0.0641412884f, 0.348331422f},
-std::array<float,2>{0.752669156f, 0.809871972f},
-std::array<float,2>{0.343939692f, 0.54927969f},
-std::array<float,2>{0.647354543f, 0.0816961825f},
-std::array<float,2>{0.132513463f, 0.015161342f},
-std::array<float,2>{0.934161127f, 0.581562638f},
-std::array<float,2>{0.393336594f, 0.823881209f},
-std::array<float,2>{0.565177858f, 0.297077775f},
-std::array<float,2>{0.261331499f, 0.45465672f},
-std::array<float,2>{0.694649875f, 0.927569687f},
-std::array<float,2>{0.0538506806f, 0.654573798f},
-std::array<float,2>{0.872096062f, 0.129741251f},
-std::array<float,2>{0.341900796f, 0.10721498f},
-std::array<float,2>{0.666873157f, 0.514379144f},
-std::array<float,2>{0.105547465f, 0.770205259f},
-std::array<float,2>{0.792353153f, 0.33400321f},
-std::array<float,2>{0.226675972f, 0.424199104f},
-std::array<float,2>{0.991188467f, 0.96515733f},
-std::array<float,2>{0.471137553f, 0.696376264f},
-std::array<float,2>{0.543519557f, 0.223196402f},
-std::array<float,2>{0.024062559f, 0.16008684f},
-std::array<float,2>{0.834851563f, 0.660206199f},
-std::array<float,2>{0.289471716f, 0.903406501f},
-std::array<float,2>{0.734514177f, 0.477505237f},
-std::array<float,2>{0.412486494f, 0.265078902f},
-std::array<float,2>{0.599748909f, 0.868766904f},
-std::array<float,2>{0.181462854f, 0.624179065f},
-std::array<float,2>{0.900080621f, 0.0331035592f},
-std::array<float,2>{0.354974329f, 0.231703296f},
-std::array<float,2>{0.651715279f, 0.688842893f},
-std::array<float,2>{0.0761404932f, 0.959549665f},
-std::array<float,2>{0.761736214f, 0.431242704f},
-std::array<float,2>{0.189478889f, 0.341140985f},
-std::array<float,2>{0.943734765f, 0.779964924f},
-std::array<float,2>{0.461322963f, 0.502876282f},
-std::array<float,2>{0.511682451f, 0.0965834931f},
-std::array<float,2>{0.0609547421f, 0.041836556f},
-std::array<float,2>{0.860000908f, 0.615340769f},
-std::array<float,2>{0.251933783f, 0.86048758f},
-std::array<float,2>{0.69595021f, 0.255562186f},
-std::array<float,2>{0.401907653f, 0.474236131f},
-std::array<float,2>{0.57323873f, 0.898427129f},
-std::array<float,2>{0.14028874f, 0.670225322f},
-std::array<float,2>{0.92581588f, 0.167680815f},
-std::array<float,2>{0.482678235f, 0.0918940902f},
-std::array<float,2>{0.538760185f, 0.55573678f},
-std::array<float,2>{0.223941177f, 0.799433053f},
-std::array<float,2>{0.996127784f, 0.352724314f},
-std::array<float,2>{0.0969807655f, 0.396674901f},
-std::array<float,2>{0.781847358f, 0.980997741f},
-std::array<float,2>{0.331672132f, 0.730373561f},
-std::array<float,2>{0.657926679f, 0.213476911f},
-std::array<float,2>{0.172217384f, 0.140371919f},
-std::array<float,2>{0.893169045f, 0.646846473f},
-std::array<float,2>{0.419099152f, 0.932154417f},
-std::array<float,2>{0.604353845f, 0.466602474f},
-std::array<float,2>{0.282720178f, 0.305245847f},
-std::array<float,2>{0.746779025f, 0.813491881f},
-std::array<float,2>{0.0160945263f, 0.58639133f},
-std::array<float,2>{0.84335959f, 0.00347269187f},
-std::array<float,2>{0.433976293f, 0.1755981f},
-std::array<float,2>{0.622989953f, 0.676958144f},
-std::array<float,2>{0.15796411f, 0.884411812f},
-std::array<float,2>{0.88375926f, 0.485361904f},
-std::array<float,2>{0.0109483562f, 0.277879745f},
-std::array<float,2>{0.812983751f, 0.849857867f},
-std::array<float,2>{0.309536844f, 0.602555633f},
-std::array<float,2>{0.732158124f, 0.054968778f},
-std::array<float,2>{0.235502675f, 0.122750551f},
-std::array<float,2>{0.97984153f, 0.526008368f},
-std::array<float,2>{0.487835407f, 0.755489647f},
-std::array<float,2>{0.558841705f, 0.315551043f},
-std::array<float,2>{0.325715274f, 0.415551662f},
-std::array<float,2>{0.674674451f, 0.948926449f},
-std::array<float,2>{0.122899301f, 0.716472447f},
-std::array<float,2>{0.809280455f, 0.248186111f},
-std::array<float,2>{0.278672516f, 0.0237422865f},
-std::array<float,2>{0.70529145f, 0.572315753f},
-std::array<float,2>{0.0364289992f, 0.835522771f},
-std::array<float,2>{0.844888389f, 0.294629991f},
-std::array<float,2>{0.147951052f, 0.444248348f},
-std::array<float,2>{0.909706593f, 0.920888245f},
-std::array<float,2>{0.390443176f, 0.636104405f},
-std::array<float,2>{0.585120499f, 0.154558927f},
-std::array<float,2>{0.0814096555f, 0.199443385f},
-std::array<float,2>{0.76704067f, 0.736622393f},
-std::array<float,2>{0.366213679f, 0.993488729f},
-std::array<float,2>{0.639531791f, 0.385390401f},
-std::array<float,2>{0.451342672f, 0.366514027f},
-std::array<float,2>{0.529769778f, 0.782520473f},
-std::array<float,2>{0.210565791f, 0.54293853f},
-std::array<float,2>{0.960601747f, 0.0698987693f},
-std::array<float,2>{0.315442234f, 0.168607324f},
-std::array<float,2>{0.683206022f, 0.664304018f},
-std::array<float,2>{0.109700687f, 0.891349435f},
-std::array<float,2>{0.801982582f, 0.472458273f},
-std::array<float,2>{0.248426631f, 0.2530123f},
-std::array<float,2>{0.969617367f, 0.866047204f},
-std::array<float,2>{0.494810045f, 0.612834156f},
-std::array<float,2>{0.553239524f, 0.0465850718f},
-std::array<float,2>{0.00433606282f, 0.099254854f},
-std::array<float,2>{0.826215267f, 0.503914773f},
-std::array<float,2>{0.301027864f, 0.774602234f},
-std::array<float,2>{0.724652052f, 0.336866796f},
-std::array<float,2>{0.423669964f, 0.437333554f},
-std::array<float,2>{0.613183081f, 0.956427395f},
-std::array<float,2>{0.1657947f, 0.694357693f},
-std::array<float,2>{0.87900877f, 0.22672379f},
-std::array<float,2>{0.440057635f, 0.00424118433f},
-std::array<float,2>{0.519987106f, 0.591529965f},
-std::array<float,2>{0.213932246f, 0.816427171f},
-std::array<float,2>{0.961908519f, 0.311404586f},
-std::array<float,2>{0.0885760561f, 0.46404314f},
-std::array<float,2>{0.779937267f, 0.934506834f},
-std::array<float,2>{0.372996718f, 0.641907334f},
-std::array<float,2>{0.625846505f, 0.135842815f},
-std::array<float,2>{0.15539901f, 0.215552121f},
-std::array<float,2>{0.916361988f, 0.730896771f},
-std::array<float,2>{0.375773877f, 0.97756362f},
-std::array<float,2>{0.590455532f, 0.391980737f},
-std::array<float,2>{0.266348809f, 0.359358311f},
-std::array<float,2>{0.716417789f, 0.80413121f},
-std::array<float,2>{0.0413026996f, 0.562230825f},
-std::array<float,2>{0.858374298f, 0.0879639611f},
-std::array<float,2>{0.396974742f, 0.245912045f},
-std::array<float,2>{0.56825161f, 0.712264597f},
-std::array<float,2>{0.126861945f, 0.949535191f},
-std::array<float,2>{0.932596803f, 0.421487391f},
-std::array<float,2>{0.0477694906f, 0.319556445f},
-std::array<float,2>{0.870225251f, 0.751524389f},
-std::array<float,2>{0.263741374f, 0.529849529f},
-std::array<float,2>{0.687797964f, 0.117536649f},
-std::array<float,2>{0.201910451f, 0.0620212592f},
-std::array<float,2>{0.950870872f, 0.608968675f},
-std::array<float,2>{0.45393908f, 0.847070336f},
-std::array<float,2>{0.503841341f, 0.27490297f},
-std::array<float,2>{0.34906736f, 0.490024835f},
-std::array<float,2>{0.641812265f, 0.890608609f},
-std::array<float,2>{0.070237726f, 0.674790621f},
-std::array<float,2>{0.755902588f, 0.177538872f},
-std::array<float,2>{0.295082122f, 0.0659334958f},
-std::array<float,2>{0.738476932f, 0.543046832f},
-std::array<float,2>{0.0301464517f, 0.786467612f},
-std::array<float,2>{0.828530312f, 0.359504938f},
-std::array<float,2>{0.184388816f, 0.389115065f},
-std::array<float,2>{0.903655708f, 0.998310328f},
-std::array<float,2>{0.409285158f, 0.741196036f},
-std::array<float,2>{0.596674919f, 0.19580777f},
-std::array<float,2>{0.101927161f, 0.148801699f},
-std::array<float,2>{0.79501456f, 0.640470564f},
-std::array<float,2>{0.338479817f, 0.915099025f},
-std::array<float,2>{0.671408176f, 0.438746274f},
-std::array<float,2>{0.474762172f, 0.289250106f},
-std::array<float,2>{0.539450347f, 0.829561949f},
-std::array<float,2>{0.234341383f, 0.576193154f},
-std::array<float,2>{0.985236049f, 0.0305632744f},
-std::array<float,2>{0.256875694f, 0.194689587f},
-std::array<float,2>{0.700167835f, 0.747640669f},
-std::array<float,2>{0.0583069436f, 0.984996319f},
-std::array<float,2>{0.866341054f, 0.37761572f},
-std::array<float,2>{0.136031747f, 0.37183851f},
-std::array<float,2>{0.92365104f, 0.795469284f},
-std::array<float,2>{0.404527158f, 0.536683381f},
-std::array<float,2>{0.577094972f, 0.0756821334f},
-std::array<float,2>{0.0709245279f, 0.0156892296f},
-std::array<float,2>{0.758491814f, 0.569752812f},
-std::array<float,2>{0.357167721f, 0.839652896f},
-std::array<float,2>{0.653218925f, 0.282863379f},
-std::array<float,2>{0.466552585f, 0.448802143f},
-std::array<float,2>{0.514370024f, 0.909161925f},
-std::array<float,2>{0.193377376f, 0.630687296f},
-std::array<float,2>{0.937982619f, 0.142566547f},
-std::array<float,2>{0.415263414f, 0.11228586f},
-std::array<float,2>{0.606758535f, 0.517278612f},
-std::array<float,2>{0.176119253f, 0.761018634f},
-std::array<float,2>{0.896105409f, 0.322640866f},
-std::array<float,2>{0.0221110452f, 0.409614056f},
-std::array<float,2>{0.83833307f, 0.944747925f},
-std::array<float,2>{0.28633979f, 0.708351254f},
-std::array<float,2>{0.745783448f, 0.234685272f},
-std::array<float,2>{0.222028688f, 0.186747923f},
-std::array<float,2>{0.992540181f, 0.686902583f},
-std::array<float,2>{0.480300605f, 0.881424606f},
-std::array<float,2>{0.533495665f, 0.496714324f},
-std::array<float,2>{0.335618168f, 0.270599306f},
-std::array<float,2>{0.662938178f, 0.852279603f},
-std::array<float,2>{0.0979347527f, 0.600510538f},
-std::array<float,2>{0.786943197f, 0.0512930416f},
-std::array<float,2>{0.490599245f, 0.127090663f},
-std::array<float,2>{0.556295931f, 0.651524305f},
-std::array<float,2>{0.238874376f, 0.925605118f},
-std::array<float,2>{0.983983696f, 0.459473014f},
-std::array<float,2>{0.117598251f, 0.30332917f},
-std::array<float,2>{0.806444407f, 0.82791549f},
-std::array<float,2>{0.323800355f, 0.584411323f},
-std::array<float,2>{0.676603973f, 0.00882235914f},
-std::array<float,2>{0.161178306f, 0.0844033509f},
-std::array<float,2>{0.889636993f, 0.55177331f},
-std::array<float,2>{0.430875927f, 0.808284581f},
-std::array<float,2>{0.619746447f, 0.347311884f},
-std::array<float,2>{0.305151731f, 0.40279907f},
-std::array<float,2>{0.730392635f, 0.970321894f},
-std::array<float,2>{0.0129448986f, 0.719594717f},
-std::array<float,2>{0.818230331f, 0.206805557f},
-std::array<float,2>{0.360018671f, 0.0363145322f},
-std::array<float,2>{0.633250654f, 0.619424462f},
-std::array<float,2>{0.0843429267f, 0.873250365f},
-std::array<float,2>{0.771940351f, 0.2582573f},
-std::array<float,2>{0.206281409f, 0.481998026f},
-std::array<float,2>{0.954259455f, 0.899749279f},
-std::array<float,2>{0.44898501f, 0.658846676f},
-std::array<float,2>{0.526495278f, 0.163896948f},
-std::array<float,2>{0.0323061608f, 0.220682889f},
-std::array<float,2>{0.848230958f, 0.701269865f},
-std::array<float,2>{0.275605142f, 0.962023735f},
-std::array<float,2>{0.71084851f, 0.426438481f},
-std::array<float,2>{0.383230031f, 0.328568846f},
-std::array<float,2>{0.578229964f, 0.766427815f},
-std::array<float,2>{0.143142775f, 0.509612143f},
-std::array<float,2>{0.913773298f, 0.105350502f},
-std::array<float,2>{0.27073136f, 0.182284057f},
-std::array<float,2>{0.711495757f, 0.679769039f},
-std::array<float,2>{0.042976018f, 0.878335595f},
-std::array<float,2>{0.852313757f, 0.495471597f},
-std::array<float,2>{0.149441376f, 0.269239247f},
-std::array<float,2>{0.92057085f, 0.859209418f},
-std::array<float,2>{0.381747186f, 0.595016897f},
-std::array<float,2>{0.588574469f, 0.0504221767f},
-std::array<float,2>{0.0930500925f, 0.117080666f},
-std::array<float,2>{0.773583889f, 0.523346663f},
-std::array<float,2>{0.369400084f, 0.762082934f},
-std::array<float,2>{0.632314742f, 0.325823396f},
-std::array<float,2>{0.441885293f, 0.414056271f},
-std::array<float,2>{0.518307626f, 0.938994169f},
-std::array<float,2>{0.214937642f, 0.704862356f},
-std::array<float,2>{0.965262115f, 0.239621565f},
-std::array<float,2>{0.428178966f, 0.0209799632f},
-std::array<float,2>{0.616573274f, 0.565077305f},
-std::array<float,2>{0.170676678f, 0.843518972f},
-std::array<float,2>{0.875784755f, 0.288363755f},
-std::array<float,2>{0.0026545031f, 0.450699806f},
-std::array<float,2>{0.823144197f, 0.911319554f},
-std::array<float,2>{0.299816877f, 0.627551556f},
-std::array<float,2>{0.721537232f, 0.145910889f},
-std::array<float,2>{0.244797349f, 0.188369036f},
-std::array<float,2>{0.973741412f, 0.743929803f},
-std::array<float,2>{0.49795869f, 0.989749193f},
-std::array<float,2>{0.550437093f, 0.379257888f},
-std::array<float,2>{0.320197582f, 0.367489159f},
-std::array<float,2>{0.686803341f, 0.790174782f},
-std::array<float,2>{0.116786607f, 0.535026729f},
-std::array<float,2>{0.797580361f, 0.0707228407f},
-std::array<float,2>{0.470606446f, 0.226397276f},
-std::array<float,2>{0.546176255f, 0.697779238f},
-std::array<float,2>{0.230134308f, 0.96742636f},
-std::array<float,2>{0.989355266f, 0.422753215f},
-std::array<float,2>{0.109025739f, 0.333453953f},
-std::array<float,2>{0.78917408f, 0.773163855f},
-std::array<float,2>{0.339955807f, 0.512055278f},
-std::array<float,2>{0.664764464f, 0.107450373f},
-std::array<float,2>{0.181946591f, 0.0348463766f},
-std::array<float,2>{0.902144909f, 0.622685432f},
-std::array<float,2>{0.411732316f, 0.869216144f},
-std::array<float,2>{0.598453641f, 0.262838155f},
-std::array<float,2>{0.292448252f, 0.479951799f},
-std::array<float,2>{0.737225056f, 0.905021191f},
-std::array<float,2>{0.0262741279f, 0.663359821f},
-std::array<float,2>{0.832887471f, 0.157400832f},
-std::array<float,2>{0.34627974f, 0.0790906474f},
-std::array<float,2>{0.644541025f, 0.547614634f},
-std::array<float,2>{0.0655658543f, 0.811662197f},
-std::array<float,2>{0.75038141f, 0.351458013f},
-std::array<float,2>{0.199105486f, 0.400106668f},
-std::array<float,2>{0.946729124f, 0.974249423f},
-std::array<float,2>{0.458289117f, 0.722940683f},
-std::array<float,2>{0.506955147f, 0.207188264f},
-std::array<float,2>{0.0524109341f, 0.131361172f},
-std::array<float,2>{0.873580098f, 0.652913868f},
-std::array<float,2>{0.258233279f, 0.927764297f},
-std::array<float,2>{0.692726016f, 0.45693931f},
-std::array<float,2>{0.391853422f, 0.299058735f},
-std::array<float,2>{0.564267099f, 0.821839333f},
-std::array<float,2>{0.13047123f, 0.580029428f},
-std::array<float,2>{0.937399745f, 0.01319189f},
-std::array<float,2>{0.329061449f, 0.212776214f},
-std::array<float,2>{0.658596158f, 0.728301525f},
-std::array<float,2>{0.0939032063f, 0.983726442f},
-std::array<float,2>{0.784262955f, 0.39471963f},
-std::array<float,2>{0.224798143f, 0.353914976f},
-std::array<float,2>{0.998486459f, 0.797261953f},
-std::array<float,2>{0.482063979f, 0.557960153f},
-std::array<float,2>{0.536453128f, 0.0905801505f},
-std::array<float,2>{0.0190860797f, 0.000573740166f},
-std::array<float,2>{0.840839267f, 0.587961614f},
-std::array<float,2>{0.284044355f, 0.814552605f},
-std::array<float,2>{0.748780608f, 0.306853294f},
-std::array<float,2>{0.421321839f, 0.468051314f},
-std::array<float,2>{0.602094352f, 0.931348383f},
-std::array<float,2>{0.17494601f, 0.64519918f},
-std::array<float,2>{0.892544508f, 0.137973681f},
-std::array<float,2>{0.464471996f, 0.095442459f},
-std::array<float,2>{0.508582532f, 0.50080663f},
-std::array<float,2>{0.188319385f, 0.778492451f},
-std::array<float,2>{0.942050219f, 0.342769712f},
-std::array<float,2>{0.0771427453f, 0.432851464f},
-std::array<float,2>{0.765405238f, 0.958787143f},
-std::array<float,2>{0.35318321f, 0.691277683f},
-std::array<float,2>{0.648741663f, 0.232692167f},
-std::array<float,2>{0.137288883f, 0.1649317f},
-std::array<float,2>{0.928982496f, 0.668286681f},
-std::array<float,2>{0.399009526f, 0.896415472f},
-std::array<float,2>{0.571194112f, 0.474798083f},
-std::array<float,2>{0.253704399f, 0.256289214f},
-std::array<float,2>{0.698622465f, 0.86266607f},
-std::array<float,2>{0.0589690991f, 0.614240944f},
-std::array<float,2>{0.862215877f, 0.0407779776f},
-std::array<float,2>{0.386814356f, 0.152965069f},
-std::array<float,2>{0.582357764f, 0.634660125f},
-std::array<float,2>{0.146398202f, 0.918478847f},
-std::array<float,2>{0.90627265f, 0.442579657f},
-std::array<float,2>{0.0384176672f, 0.295656323f},
-std::array<float,2>{0.847235918f, 0.833062351f},
-std::array<float,2>{0.280672431f, 0.572034717f},
-std::array<float,2>{0.704697788f, 0.0269232281f},
-std::array<float,2>{0.208423913f, 0.0674223825f},
-std::array<float,2>{0.957116425f, 0.53951931f},
-std::array<float,2>{0.450556874f, 0.783288956f},
-std::array<float,2>{0.528863609f, 0.36477527f},
-std::array<float,2>{0.364310652f, 0.384340793f},
-std::array<float,2>{0.63757211f, 0.994803309f},
-std::array<float,2>{0.0792680532f, 0.73595494f},
-std::array<float,2>{0.768115997f, 0.202373907f},
-std::array<float,2>{0.311977983f, 0.0568852723f},
-std::array<float,2>{0.733211637f, 0.604510605f},
-std::array<float,2>{0.00800927356f, 0.848458529f},
-std::array<float,2>{0.815320909f, 0.280665547f},
-std::array<float,2>{0.159942329f, 0.487040281f},
-std::array<float,2>{0.88509959f, 0.886400521f},
-std::array<float,2>{0.436992019f, 0.678116977f},
-std::array<float,2>{0.624465227f, 0.172014385f},
-std::array<float,2>{0.124022081f, 0.246291742f},
-std::array<float,2>{0.811271548f, 0.718685329f},
-std::array<float,2>{0.327276468f, 0.946840882f},
-std::array<float,2>{0.673116922f, 0.416600049f},
-std::array<float,2>{0.48551628f, 0.312588841f},
-std::array<float,2>{0.562037945f, 0.757371604f},
-std::array<float,2>{0.237989068f, 0.524652779f},
-std::array<float,2>{0.978403211f, 0.12373057f},
-std::array<float,2>{0.374239653f, 0.134111062f},
-std::array<float,2>{0.628220618f, 0.643625796f},
-std::array<float,2>{0.0875960588f, 0.936780393f},
-std::array<float,2>{0.778119743f, 0.462706298f},
-std::array<float,2>{0.211993992f, 0.309379399f},
-std::array<float,2>{0.963048458f, 0.81926465f},
-std::array<float,2>{0.438565671f, 0.592421353f},
-std::array<float,2>{0.523321569f, 0.00622387789f},
-std::array<float,2>{0.0394115597f, 0.0876313001f},
-std::array<float,2>{0.855870008f, 0.558670461f},
-std::array<float,2>{0.268701255f, 0.801890254f},
-std::array<float,2>{0.718431115f, 0.357015282f},
-std::array<float,2>{0.377610266f, 0.393451184f},
-std::array<float,2>{0.593663514f, 0.979620576f},
-std::array<float,2>{0.152852952f, 0.734356821f},
-std::array<float,2>{0.915603936f, 0.218471423f},
-std::array<float,2>{0.493965447f, 0.0447766706f},
-std::array<float,2>{0.551584899f, 0.609576046f},
-std::array<float,2>{0.24671571f, 0.864524066f},
-std::array<float,2>{0.971627235f, 0.250490129f},
-std::array<float,2>{0.112631254f, 0.468990624f},
-std::array<float,2>{0.8043648f, 0.894070208f},
-std::array<float,2>{0.313775212f, 0.667623222f},
-std::array<float,2>{0.681049824f, 0.170119345f},
-std::array<float,2>{0.166719556f, 0.228862077f},
-std::array<float,2>{0.882313192f, 0.692318618f},
-std::array<float,2>{0.424317628f, 0.954289258f},
-std::array<float,2>{0.611064196f, 0.433781117f},
-std::array<float,2>{0.303663135f, 0.338557839f},
-std::array<float,2>{0.723742068f, 0.775807261f},
-std::array<float,2>{0.00659247953f, 0.506804407f},
-std::array<float,2>{0.824716985f, 0.101539277f},
-std::array<float,2>{0.406756967f, 0.199133068f},
-std::array<float,2>{0.594854176f, 0.738821149f},
-std::array<float,2>{0.185781077f, 0.99634093f},
-std::array<float,2>{0.905920863f, 0.388124615f},
-std::array<float,2>{0.0274040252f, 0.363113821f},
-std::array<float,2>{0.831281543f, 0.788224101f},
-std::array<float,2>{0.293106288f, 0.546376228f},
-std::array<float,2>{0.742142141f, 0.0640285611f},
-std::array<float,2>{0.230529144f, 0.0282825213f},
-std::array<float,2>{0.987144172f, 0.574765742f},
-std::array<float,2>{0.47422725f, 0.830295622f},
-std::array<float,2>{0.541079164f, 0.291187614f},
-std::array<float,2>{0.336672723f, 0.440053433f},
-std::array<float,2>{0.668421447f, 0.916358471f},
-std::array<float,2>{0.104000255f, 0.636898637f},
-std::array<float,2>{0.793657601f, 0.152274877f},
-std::array<float,2>{0.262728155f, 0.119587198f},
-std::array<float,2>{0.69140178f, 0.528844118f},
-std::array<float,2>{0.049638018f, 0.75344491f},
-std::array<float,2>{0.86903578f, 0.317762524f},
-std::array<float,2>{0.128288314f, 0.418443322f},
-std::array<float,2>{0.92990303f, 0.952541232f},
-std::array<float,2>{0.395810872f, 0.712978303f},
-std::array<float,2>{0.570065439f, 0.242872521f},
-std::array<float,2>{0.0675189048f, 0.179660931f},
-std::array<float,2>{0.755810678f, 0.672510147f},
-std::array<float,2>{0.350896716f, 0.887432694f},
-std::array<float,2>{0.642928421f, 0.490809381f},
-std::array<float,2>{0.455332726f, 0.277036637f},
-std::array<float,2>{0.501757026f, 0.843936265f},
-std::array<float,2>{0.200363904f, 0.606061697f},
-std::array<float,2>{0.9518255f, 0.0587221049f},
-std::array<float,2>{0.288798392f, 0.237794459f},
-std::array<float,2>{0.743570149f, 0.70936197f},
-std::array<float,2>{0.0200963542f, 0.942358732f},
-std::array<float,2>{0.837486863f, 0.406985998f},
-std::array<float,2>{0.178904995f, 0.320385128f},
-std::array<float,2>{0.897788644f, 0.75886482f},
-std::array<float,2>{0.416131824f, 0.518799424f},
-std::array<float,2>{0.609256566f, 0.110898837f},
-std::array<float,2>{0.10016375f, 0.0527492575f},
-std::array<float,2>{0.788025737f, 0.599473476f},
-std::array<float,2>{0.332475781f, 0.853541791f},
-std::array<float,2>{0.661796808f, 0.272092819f},
-std::array<float,2>{0.476647437f, 0.49853918f},
-std::array<float,2>{0.532067001f, 0.879475057f},
-std::array<float,2>{0.220147595f, 0.68375808f},
-std::array<float,2>{0.994755328f, 0.185088754f},
-std::array<float,2>{0.403238028f, 0.0766638741f},
-std::array<float,2>{0.574353755f, 0.538628817f},
-std::array<float,2>{0.134544224f, 0.794315934f},
-std::array<float,2>{0.925023079f, 0.374758333f},
-std::array<float,2>{0.0560323559f, 0.375933468f},
-std::array<float,2>{0.864805281f, 0.988179803f},
-std::array<float,2>{0.255074263f, 0.749641299f},
-std::array<float,2>{0.701992929f, 0.191525862f},
-std::array<float,2>{0.192620456f, 0.144113168f},
-std::array<float,2>{0.940680265f, 0.631127954f},
-std::array<float,2>{0.46743235f, 0.90772891f},
-std::array<float,2>{0.51199609f, 0.447191477f},
-std::array<float,2>{0.358174503f, 0.284059018f},
-std::array<float,2>{0.655596495f, 0.836942732f},
-std::array<float,2>{0.0736078024f, 0.566457629f},
-std::array<float,2>{0.761289477f, 0.0183097422f},
-std::array<float,2>{0.44624576f, 0.160566956f},
-std::array<float,2>{0.524937034f, 0.657877088f},
-std::array<float,2>{0.204157323f, 0.901304007f},
-std::array<float,2>{0.956048548f, 0.483970642f},
-std::array<float,2>{0.0832251906f, 0.26136604f},
-std::array<float,2>{0.769668996f, 0.871501327f},
-std::array<float,2>{0.363015503f, 0.618456364f},
-std::array<float,2>{0.635868549f, 0.0386806279f},
-std::array<float,2>{0.141927406f, 0.102202341f},
-std::array<float,2>{0.911658883f, 0.511428714f},
-std::array<float,2>{0.38602829f, 0.769214571f},
-std::array<float,2>{0.581149697f, 0.330713391f},
-std::array<float,2>{0.273782313f, 0.427758485f},
-std::array<float,2>{0.708156407f, 0.96419394f},
-std::array<float,2>{0.0335648842f, 0.700368106f},
-std::array<float,2>{0.851555347f, 0.221224844f},
-std::array<float,2>{0.321364075f, 0.010472673f},
-std::array<float,2>{0.678707361f, 0.582180262f},
-std::array<float,2>{0.119261883f, 0.824331105f},
-std::array<float,2>{0.808274984f, 0.302695423f},
-std::array<float,2>{0.241287038f, 0.457858592f},
-std::array<float,2>{0.982142687f, 0.923625946f},
-std::array<float,2>{0.490113288f, 0.649240911f},
-std::array<float,2>{0.557750225f, 0.125172675f},
-std::array<float,2>{0.0150921214f, 0.20461975f},
-std::array<float,2>{0.818686366f, 0.721610308f},
-std::array<float,2>{0.306860387f, 0.972644091f},
-std::array<float,2>{0.728405416f, 0.40506795f},
-std::array<float,2>{0.432315022f, 0.345536798f},
-std::array<float,2>{0.618886292f, 0.80546248f},
-std::array<float,2>{0.163965896f, 0.554269493f},
-std::array<float,2>{0.887380898f, 0.0825797245f},
-std::array<float,2>{0.308660775f, 0.172447279f},
-std::array<float,2>{0.731639862f, 0.678415835f},
-std::array<float,2>{0.0115673384f, 0.885960639f},
-std::array<float,2>{0.813376427f, 0.48673898f},
-std::array<float,2>{0.157553449f, 0.281029463f},
-std::array<float,2>{0.883276045f, 0.847963095f},
-std::array<float,2>{0.434566319f, 0.605342686f},
-std::array<float,2>{0.622228324f, 0.0572766922f},
-std::array<float,2>{0.122346036f, 0.123440132f},
-std::array<float,2>{0.808894932f, 0.525273442f},
-std::array<float,2>{0.325536907f, 0.756984234f},
-std::array<float,2>{0.674286306f, 0.313165098f},
-std::array<float,2>{0.487369746f, 0.416481733f},
-std::array<float,2>{0.559420526f, 0.946536899f},
-std::array<float,2>{0.236275792f, 0.717813909f},
-std::array<float,2>{0.980357945f, 0.246978924f},
-std::array<float,2>{0.390027851f, 0.0265980847f},
-std::array<float,2>{0.585513711f, 0.571491599f},
-std::array<float,2>{0.147699997f, 0.833969235f},
-std::array<float,2>{0.909246862f, 0.29515776f},
-std::array<float,2>{0.0370909646f, 0.442898512f},
-std::array<float,2>{0.845556438f, 0.918432355f},
-std::array<float,2>{0.279240996f, 0.633803248f},
-std::array<float,2>{0.705857098f, 0.152755409f},
-std::array<float,2>{0.209965006f, 0.202733561f},
-std::array<float,2>{0.95999372f, 0.735478222f},
-std::array<float,2>{0.45168227f, 0.994233191f},
-std::array<float,2>{0.530011833f, 0.384120136f},
-std::array<float,2>{0.36706689f, 0.364727169f},
-std::array<float,2>{0.639004171f, 0.784153342f},
-std::array<float,2>{0.0815733746f, 0.539858699f},
-std::array<float,2>{0.767500401f, 0.0680081621f},
-std::array<float,2>{0.461740643f, 0.233204827f},
-std::array<float,2>{0.51102978f, 0.69044143f},
-std::array<float,2>{0.189947471f, 0.958277702f},
-std::array<float,2>{0.943933547f, 0.433166146f},
-std::array<float,2>{0.075652495f, 0.341893882f},
-std::array<float,2>{0.76238817f, 0.779196858f},
-std::array<float,2>{0.355358213f, 0.500468075f},
-std::array<float,2>{0.652007699f, 0.095016636f},
-std::array<float,2>{0.139743716f, 0.0401897989f},
-std::array<float,2>{0.926281154f, 0.613761425f},
-std::array<float,2>{0.40144819f, 0.863239825f},
-std::array<float,2>{0.57264334f, 0.256753504f},
-std::array<float,2>{0.251407176f, 0.475310206f},
-std::array<float,2>{0.695348382f, 0.895952106f},
-std::array<float,2>{0.061076127f, 0.668824911f},
-std::array<float,2>{0.859422088f, 0.164083347f},
-std::array<float,2>{0.331154466f, 0.0899287686f},
-std::array<float,2>{0.657459259f, 0.558224678f},
-std::array<float,2>{0.0972251445f, 0.797408879f},
-std::array<float,2>{0.781467259f, 0.354137152f},
-std::array<float,2>{0.224260092f, 0.395486146f},
-std::array<float,2>{0.996885836f, 0.98399061f},
-std::array<float,2>{0.483033806f, 0.727700293f},
-std::array<float,2>{0.53822577f, 0.212200552f},
-std::array<float,2>{0.0165516306f, 0.138219938f},
-std::array<float,2>{0.843103111f, 0.644975245f},
-std::array<float,2>{0.28267318f, 0.930921793f},
-std::array<float,2>{0.74655354f, 0.468278468f},
-std::array<float,2>{0.419506729f, 0.307222396f},
-std::array<float,2>{0.603871465f, 0.814966798f},
-std::array<float,2>{0.172419861f, 0.5886994f},
-std::array<float,2>{0.89269799f, 0.00024561811f},
-std::array<float,2>{0.344569087f, 0.207767755f},
-std::array<float,2>{0.646932364f, 0.723532438f},
-std::array<float,2>{0.0636771396f, 0.97397387f},
-std::array<float,2>{0.752335608f, 0.399602622f},
-std::array<float,2>{0.195609495f, 0.351057053f},
-std::array<float,2>{0.948094785f, 0.812293887f},
-std::array<float,2>{0.45908314f, 0.54688555f},
-std::array<float,2>{0.505750537f, 0.078442812f},
-std::array<float,2>{0.0546108522f, 0.0127073675f},
-std::array<float,2>{0.872600198f, 0.579146445f},
-std::array<float,2>{0.260872155f, 0.821576834f},
-std::array<float,2>{0.695256114f, 0.29951939f},
-std::array<float,2>{0.392580003f, 0.456286579f},
-std::array<float,2>{0.564858496f, 0.928574383f},
-std::array<float,2>{0.132219106f, 0.652546763f},
-std::array<float,2>{0.93399322f, 0.1310976f},
-std::array<float,2>{0.471426308f, 0.107930541f},
-std::array<float,2>{0.54315722f, 0.512353599f},
-std::array<float,2>{0.227500603f, 0.77284807f},
-std::array<float,2>{0.990552843f, 0.333687127f},
-std::array<float,2>{0.106157482f, 0.421907783f},
-std::array<float,2>{0.792795599f, 0.966826439f},
-std::array<float,2>{0.342492551f, 0.697384059f},
-std::array<float,2>{0.666368723f, 0.225648731f},
-std::array<float,2>{0.18073909f, 0.158063382f},
-std::array<float,2>{0.89979738f, 0.663593471f},
-std::array<float,2>{0.412979066f, 0.904399335f},
-std::array<float,2>{0.600278974f, 0.479998231f},
-std::array<float,2>{0.28971234f, 0.263309538f},
-std::array<float,2>{0.73493588f, 0.869825482f},
-std::array<float,2>{0.0238174386f, 0.622447014f},
-std::array<float,2>{0.834375441f, 0.034271203f},
-std::array<float,2>{0.42672947f, 0.14603579f},
-std::array<float,2>{0.615122318f, 0.627305448f},
-std::array<float,2>{0.168332085f, 0.912047446f},
-std::array<float,2>{0.877187848f, 0.450271785f},
-std::array<float,2>{0.00105160184f, 0.288957775f},
-std::array<float,2>{0.821198881f, 0.842992723f},
-std::array<float,2>{0.297377855f, 0.564704716f},
-std::array<float,2>{0.718767703f, 0.0214529708f},
-std::array<float,2>{0.243682668f, 0.0708067641f},
-std::array<float,2>{0.975307882f, 0.534535348f},
-std::array<float,2>{0.498261958f, 0.790801942f},
-std::array<float,2>{0.547774076f, 0.368047476f},
-std::array<float,2>{0.316601843f, 0.379427552f},
-std::array<float,2>{0.685476243f, 0.989457786f},
-std::array<float,2>{0.11460527f, 0.743248045f},
-std::array<float,2>{0.800713003f, 0.187856555f},
-std::array<float,2>{0.271894366f, 0.0500821806f},
-std::array<float,2>{0.713330925f, 0.595371902f},
-std::array<float,2>{0.045425687f, 0.858510733f},
-std::array<float,2>{0.855197132f, 0.268877f},
-std::array<float,2>{0.152174547f, 0.495999902f},
-std::array<float,2>{0.919708133f, 0.878878474f},
-std::array<float,2>{0.380484879f, 0.680659533f},
-std::array<float,2>{0.58627522f, 0.181856334f},
-std::array<float,2>{0.0904179513f, 0.240171432f},
-std::array<float,2>{0.775963366f, 0.704517663f},
-std::array<float,2>{0.36894393f, 0.93882376f},
-std::array<float,2>{0.630536914f, 0.413173527f},
-std::array<float,2>{0.443679869f, 0.325542182f},
-std::array<float,2>{0.516741693f, 0.762229085f},
-std::array<float,2>{0.216883436f, 0.522507548f},
-std::array<float,2>{0.968357444f, 0.116366327f},
-std::array<float,2>{0.323348641f, 0.125508413f},
-std::array<float,2>{0.675882697f, 0.648443997f},
-std::array<float,2>{0.118120037f, 0.923233569f},
-std::array<float,2>{0.806014955f, 0.457062721f},
-std::array<float,2>{0.23837769f, 0.301874012f},
-std::array<float,2>{0.983410299f, 0.824812174f},
-std::array<float,2>{0.490910292f, 0.582563281f},
-std::array<float,2>{0.555788696f, 0.0102014216f},
-std::array<float,2>{0.0133618377f, 0.082503885f},
-std::array<float,2>{0.817737579f, 0.553916693f},
-std::array<float,2>{0.305568457f, 0.805134714f},
-std::array<float,2>{0.729909062f, 0.344912529f},
-std::array<float,2>{0.4314695f, 0.404416621f},
-std::array<float,2>{0.61914742f, 0.971908748f},
-std::array<float,2>{0.161759689f, 0.720991611f},
-std::array<float,2>{0.888689339f, 0.204432324f},
-std::array<float,2>{0.448300689f, 0.0383534208f},
-std::array<float,2>{0.527151108f, 0.619023144f},
-std::array<float,2>{0.206661373f, 0.871778727f},
-std::array<float,2>{0.954760075f, 0.260913312f},
-std::array<float,2>{0.0847795159f, 0.483841181f},
-std::array<float,2>{0.772331595f, 0.900498569f},
-std::array<float,2>{0.359789312f, 0.657461226f},
-std::array<float,2>{0.633461058f, 0.160705104f},
-std::array<float,2>{0.142754987f, 0.220983386f},
-std::array<float,2>{0.913561106f, 0.701165438f},
-std::array<float,2>{0.383427083f, 0.964724362f},
-std::array<float,2>{0.578670502f, 0.428265333f},
-std::array<float,2>{0.276109099f, 0.330359906f},
-std::array<float,2>{0.710326016f, 0.768622994f},
-std::array<float,2>{0.0331096947f, 0.510817707f},
-std::array<float,2>{0.84784472f, 0.101845592f},
-std::array<float,2>{0.404818982f, 0.191922262f},
-std::array<float,2>{0.576334298f, 0.749243736f},
-std::array<float,2>{0.136546776f, 0.987558663f},
-std::array<float,2>{0.923127055f, 0.375134736f},
-std::array<float,2>{0.0580912493f, 0.374271214f},
-std::array<float,2>{0.86718303f, 0.794805229f},
-std::array<float,2>{0.257744938f, 0.53821224f},
-std::array<float,2>{0.699694216f, 0.0764874518f},
-std::array<float,2>{0.194216326f, 0.0178503152f},
-std::array<float,2>{0.938158154f, 0.567098975f},
-std::array<float,2>{0.466137558f, 0.837548614f},
-std::array<float,2>{0.513887465f, 0.283539146f},
-std::array<float,2>{0.356473893f, 0.446321547f},
-std::array<float,2>{0.652639031f, 0.907548249f},
-std::array<float,2>{0.0706837326f, 0.631625116f},
-std::array<float,2>{0.758114934f, 0.143725052f},
-std::array<float,2>{0.286813349f, 0.110662773f},
-std::array<float,2>{0.745562375f, 0.51936996f},
-std::array<float,2>{0.0219083335f, 0.759356081f},
-std::array<float,2>{0.838864148f, 0.320847541f},
-std::array<float,2>{0.176585555f, 0.406689495f},
-std::array<float,2>{0.895584047f, 0.941480696f},
-std::array<float,2>{0.415800393f, 0.709791899f},
-std::array<float,2>{0.60734129f, 0.237685114f},
-std::array<float,2>{0.0985487476f, 0.185017571f},
-std::array<float,2>{0.786303043f, 0.68448627f},
-std::array<float,2>{0.335345834f, 0.879070044f},
-std::array<float,2>{0.662139237f, 0.49852705f},
-std::array<float,2>{0.479603916f, 0.271575063f},
-std::array<float,2>{0.533989072f, 0.854475617f},
-std::array<float,2>{0.222652867f, 0.598715544f},
-std::array<float,2>{0.993096709f, 0.0536167584f},
-std::array<float,2>{0.264402807f, 0.242336765f},
-std::array<float,2>{0.688369572f, 0.713626504f},
-std::array<float,2>{0.0470163412f, 0.952893972f},
-std::array<float,2>{0.870867014f, 0.418622166f},
-std::array<float,2>{0.126076996f, 0.318075985f},
-std::array<float,2>{0.932110429f, 0.753170431f},
-std::array<float,2>{0.39673242f, 0.528470457f},
-std::array<float,2>{0.56775403f, 0.119816646f},
-std::array<float,2>{0.0698193833f, 0.0595240034f},
-std::array<float,2>{0.756834805f, 0.605699778f},
-std::array<float,2>{0.349556237f, 0.844398558f},
-std::array<float,2>{0.642510533f, 0.276548147f},
-std::array<float,2>{0.453429312f, 0.490512609f},
-std::array<float,2>{0.503057539f, 0.886814892f},
-std::array<float,2>{0.201214224f, 0.672325492f},
-std::array<float,2>{0.950363815f, 0.178972632f},
-std::array<float,2>{0.409887999f, 0.0637350306f},
-std::array<float,2>{0.595845163f, 0.546527565f},
-std::array<float,2>{0.184054166f, 0.788802266f},
-std::array<float,2>{0.903924942f, 0.362667799f},
-std::array<float,2>{0.0295239594f, 0.388279051f},
-std::array<float,2>{0.829074204f, 0.996738493f},
-std::array<float,2>{0.295648843f, 0.738740146f},
-std::array<float,2>{0.739031971f, 0.198725879f},
-std::array<float,2>{0.23351413f, 0.151683748f},
-std::array<float,2>{0.984446287f, 0.637585878f},
-std::array<float,2>{0.475462884f, 0.916685045f},
-std::array<float,2>{0.539762318f, 0.439917773f},
-std::array<float,2>{0.338046104f, 0.291875392f},
-std::array<float,2>{0.67110157f, 0.83081454f},
-std::array<float,2>{0.102337413f, 0.57462132f},
-std::array<float,2>{0.79587543f, 0.0274341423f},
-std::array<float,2>{0.494470656f, 0.170459405f},
-std::array<float,2>{0.55291003f, 0.667472541f},
-std::array<float,2>{0.248935536f, 0.893825412f},
-std::array<float,2>{0.968978524f, 0.469243914f},
-std::array<float,2>{0.109952562f, 0.250040472f},
-std::array<float,2>{0.802340627f, 0.864853382f},
-std::array<float,2>{0.315994114f, 0.609911025f},
-std::array<float,2>{0.682829738f, 0.0440846942f},
-std::array<float,2>{0.16529718f, 0.100715175f},
-std::array<float,2>{0.879585326f, 0.506208777f},
-std::array<float,2>{0.423326433f, 0.7759884f},
-std::array<float,2>{0.61268568f, 0.338303983f},
-std::array<float,2>{0.301420838f, 0.434130669f},
-std::array<float,2>{0.72519052f, 0.95490849f},
-std::array<float,2>{0.00486233504f, 0.691621304f},
-std::array<float,2>{0.827056766f, 0.229068801f},
-std::array<float,2>{0.372496247f, 0.0066225715f},
-std::array<float,2>{0.625119507f, 0.591913283f},
-std::array<float,2>{0.0881202668f, 0.818450034f},
-std::array<float,2>{0.779757202f, 0.308632821f},
-std::array<float,2>{0.214584842f, 0.461979985f},
-std::array<float,2>{0.961277068f, 0.937071323f},
-std::array<float,2>{0.439659059f, 0.644465864f},
-std::array<float,2>{0.520308673f, 0.134603217f},
-std::array<float,2>{0.0418441743f, 0.218124375f},
-std::array<float,2>{0.85787034f, 0.73371011f},
-std::array<float,2>{0.265651941f, 0.980038941f},
-std::array<float,2>{0.71604234f, 0.392912f},
-std::array<float,2>{0.37542969f, 0.356756032f},
-std::array<float,2>{0.58986491f, 0.802278936f},
-std::array<float,2>{0.155929834f, 0.559470117f},
-std::array<float,2>{0.916904211f, 0.0873919725f},
-std::array<float,2>{0.280771762f, 0.15516749f},
-std::array<float,2>{0.704187274f, 0.636487782f},
-std::array<float,2>{0.0390082672f, 0.920319855f},
-std::array<float,2>{0.847139299f, 0.443397552f},
-std::array<float,2>{0.145642281f, 0.294381589f},
-std::array<float,2>{0.906805992f, 0.835256219f},
-std::array<float,2>{0.387548089f, 0.572924912f},
-std::array<float,2>{0.582784295f, 0.0239273645f},
-std::array<float,2>{0.0797650218f, 0.0694635734f},
-std::array<float,2>{0.767596304f, 0.54246521f},
-std::array<float,2>{0.364987075f, 0.782944143f},
-std::array<float,2>{0.637080073f, 0.366993964f},
-std::array<float,2>{0.451093167f, 0.3850995f},
-std::array<float,2>{0.528486609f, 0.993729651f},
-std::array<float,2>{0.208629563f, 0.737001956f},
-std::array<float,2>{0.957905889f, 0.200072885f},
-std::array<float,2>{0.437487751f, 0.0551827289f},
-std::array<float,2>{0.624545515f, 0.603152633f},
-std::array<float,2>{0.159331203f, 0.85057652f},
-std::array<float,2>{0.885658979f, 0.277523279f},
-std::array<float,2>{0.00834079366f, 0.486276388f},
-std::array<float,2>{0.814680099f, 0.884231687f},
-std::array<float,2>{0.31209448f, 0.677266359f},
-std::array<float,2>{0.732526958f, 0.175183862f},
-std::array<float,2>{0.237310097f, 0.248898268f},
-std::array<float,2>{0.97793746f, 0.716051102f},
-std::array<float,2>{0.486204535f, 0.948609829f},
-std::array<float,2>{0.56180805f, 0.415156782f},
-std::array<float,2>{0.327818006f, 0.316308111f},
-std::array<float,2>{0.673781753f, 0.755093038f},
-std::array<float,2>{0.123098403f, 0.525753081f},
-std::array<float,2>{0.810645342f, 0.122089818f},
-std::array<float,2>{0.481568187f, 0.21307902f},
-std::array<float,2>{0.536844373f, 0.729534924f},
-std::array<float,2>{0.22523801f, 0.980942726f},
-std::array<float,2>{0.998876631f, 0.397354424f},
-std::array<float,2>{0.0947228f, 0.353270054f},
-std::array<float,2>{0.784751475f, 0.799290061f},
-std::array<float,2>{0.328214258f, 0.55630374f},
-std::array<float,2>{0.659011722f, 0.0925898179f},
-std::array<float,2>{0.17565468f, 0.00309017138f},
-std::array<float,2>{0.891910195f, 0.586565733f},
-std::array<float,2>{0.421515793f, 0.814182997f},
-std::array<float,2>{0.602008343f, 0.304828078f},
-std::array<float,2>{0.283243537f, 0.465827167f},
-std::array<float,2>{0.748339951f, 0.93191272f},
-std::array<float,2>{0.0189179666f, 0.646975636f},
-std::array<float,2>{0.841492474f, 0.140068114f},
-std::array<float,2>{0.352978557f, 0.0960584879f},
-std::array<float,2>{0.648988903f, 0.502207816f},
-std::array<float,2>{0.0761874691f, 0.779679537f},
-std::array<float,2>{0.765082181f, 0.341397762f},
-std::array<float,2>{0.187709659f, 0.430772603f},
-std::array<float,2>{0.941568315f, 0.959058762f},
-std::array<float,2>{0.464291662f, 0.689346194f},
-std::array<float,2>{0.508200526f, 0.232179314f},
-std::array<float,2>{0.0591606312f, 0.167274788f},
-std::array<float,2>{0.861458063f, 0.670856476f},
-std::array<float,2>{0.253305703f, 0.897519588f},
-std::array<float,2>{0.699159563f, 0.473834604f},
-std::array<float,2>{0.398840517f, 0.25533399f},
-std::array<float,2>{0.570464492f, 0.861321807f},
-std::array<float,2>{0.137123942f, 0.616122484f},
-std::array<float,2>{0.929668605f, 0.0412907042f},
-std::array<float,2>{0.340400755f, 0.222877607f},
-std::array<float,2>{0.664166212f, 0.697231412f},
-std::array<float,2>{0.108475372f, 0.965432763f},
-std::array<float,2>{0.789735973f, 0.424758941f},
-std::array<float,2>{0.229562029f, 0.334530652f},
-std::array<float,2>{0.98987788f, 0.7697559f},
-std::array<float,2>{0.469969511f, 0.51415664f},
-std::array<float,2>{0.546584547f, 0.106818654f},
-std::array<float,2>{0.0254200529f, 0.0323344171f},
-std::array<float,2>{0.832508087f, 0.624827564f},
-std::array<float,2>{0.292912781f, 0.868602872f},
-std::array<float,2>{0.736535788f, 0.265577942f},
-std::array<float,2>{0.411418915f, 0.476901978f},
-std::array<float,2>{0.597732365f, 0.904232979f},
-std::array<float,2>{0.182130083f, 0.660833597f},
-std::array<float,2>{0.901382625f, 0.159542352f},
-std::array<float,2>{0.458964467f, 0.0814045742f},
-std::array<float,2>{0.507669687f, 0.549667954f},
-std::array<float,2>{0.198251769f, 0.810420811f},
-std::array<float,2>{0.947174311f, 0.347850025f},
-std::array<float,2>{0.0659307763f, 0.40232414f},
-std::array<float,2>{0.750777841f, 0.976224244f},
-std::array<float,2>{0.345989645f, 0.726447463f},
-std::array<float,2>{0.645085692f, 0.209592536f},
-std::array<float,2>{0.130166963f, 0.129117206f},
-std::array<float,2>{0.936544478f, 0.655195177f},
-std::array<float,2>{0.392166048f, 0.927203894f},
-std::array<float,2>{0.563715339f, 0.454444408f},
-std::array<float,2>{0.258618832f, 0.297788829f},
-std::array<float,2>{0.692964673f, 0.823277771f},
-std::array<float,2>{0.0517955907f, 0.581066728f},
-std::array<float,2>{0.873299778f, 0.0149386171f},
-std::array<float,2>{0.38093859f, 0.179848284f},
-std::array<float,2>{0.588184059f, 0.682346761f},
-std::array<float,2>{0.150287211f, 0.876480043f},
-std::array<float,2>{0.920406163f, 0.493374199f},
-std::array<float,2>{0.043695949f, 0.266625106f},
-std::array<float,2>{0.851647794f, 0.856725931f},
-std::array<float,2>{0.27136752f, 0.597331643f},
-std::array<float,2>{0.711136162f, 0.0468977578f},
-std::array<float,2>{0.215567783f, 0.115164973f},
-std::array<float,2>{0.965660572f, 0.520540178f},
-std::array<float,2>{0.442110181f, 0.764045656f},
-std::array<float,2>{0.517988205f, 0.327714741f},
-std::array<float,2>{0.370018035f, 0.411073476f},
-std::array<float,2>{0.632498801f, 0.940773427f},
-std::array<float,2>{0.0932818055f, 0.705621719f},
-std::array<float,2>{0.774182916f, 0.241240337f},
-std::array<float,2>{0.30070138f, 0.0222959816f},
-std::array<float,2>{0.720900834f, 0.563882887f},
-std::array<float,2>{0.00242245547f, 0.840106249f},
-std::array<float,2>{0.822455168f, 0.286359578f},
-std::array<float,2>{0.170299232f, 0.452260077f},
-std::array<float,2>{0.875100851f, 0.913892448f},
-std::array<float,2>{0.428462833f, 0.625333965f},
-std::array<float,2>{0.616992712f, 0.14835982f},
-std::array<float,2>{0.116297245f, 0.1912857f},
-std::array<float,2>{0.797012091f, 0.744522452f},
-std::array<float,2>{0.319590867f, 0.990712523f},
-std::array<float,2>{0.687232316f, 0.382560194f},
-std::array<float,2>{0.497378051f, 0.369980961f},
-std::array<float,2>{0.550211608f, 0.792032242f},
-std::array<float,2>{0.244520396f, 0.532436252f},
-std::array<float,2>{0.974138677f, 0.0737433136f},
-std::array<float,2>{0.362579793f, 0.163420245f},
-std::array<float,2>{0.636717498f, 0.658516228f},
-std::array<float,2>{0.0838572606f, 0.900220215f},
-std::array<float,2>{0.770239055f, 0.481548816f},
-std::array<float,2>{0.20492129f, 0.258563399f},
-std::array<float,2>{0.955377817f, 0.873535335f},
-std::array<float,2>{0.445419669f, 0.620076895f},
-std::array<float,2>{0.524509966f, 0.0368486121f},
-std::array<float,2>{0.0338140577f, 0.104700662f},
-std::array<float,2>{0.850778103f, 0.509136975f},
-std::array<float,2>{0.27395761f, 0.765652657f},
-std::array<float,2>{0.708851516f, 0.328617603f},
-std::array<float,2>{0.386703074f, 0.425879031f},
-std::array<float,2>{0.581817448f, 0.9624421f},
-std::array<float,2>{0.142536551f, 0.701945662f},
-std::array<float,2>{0.911152661f, 0.220171943f},
-std::array<float,2>{0.48958391f, 0.00938494224f},
-std::array<float,2>{0.558566868f, 0.584642768f},
-std::array<float,2>{0.241726309f, 0.827359378f},
-std::array<float,2>{0.98169893f, 0.302735329f},
-std::array<float,2>{0.119726479f, 0.459151834f},
-std::array<float,2>{0.807786226f, 0.925056696f},
-std::array<float,2>{0.32224983f, 0.652144551f},
-std::array<float,2>{0.678035796f, 0.12786828f},
-std::array<float,2>{0.163353577f, 0.206476122f},
-std::array<float,2>{0.88691783f, 0.718934774f},
-std::array<float,2>{0.432040334f, 0.969961643f},
-std::array<float,2>{0.618310273f, 0.403310359f},
-std::array<float,2>{0.307504714f, 0.347130388f},
-std::array<float,2>{0.727730989f, 0.807901859f},
-std::array<float,2>{0.0152735524f, 0.552542567f},
-std::array<float,2>{0.819071054f, 0.08479435f},
-std::array<float,2>{0.416519225f, 0.234942228f},
-std::array<float,2>{0.608652711f, 0.708818436f},
-std::array<float,2>{0.179502979f, 0.945221782f},
-std::array<float,2>{0.898097932f, 0.40995127f},
-std::array<float,2>{0.0195626803f, 0.323159218f},
-std::array<float,2>{0.837179542f, 0.761593401f},
-std::array<float,2>{0.288092077f, 0.516770005f},
-std::array<float,2>{0.743706644f, 0.111465491f},
-std::array<float,2>{0.220579043f, 0.0507984608f},
-std::array<float,2>{0.994245648f, 0.599893212f},
-std::array<float,2>{0.477279246f, 0.851615429f},
-std::array<float,2>{0.531255305f, 0.27146256f},
-std::array<float,2>{0.332528204f, 0.496573061f},
-std::array<float,2>{0.661613762f, 0.880873203f},
-std::array<float,2>{0.099961184f, 0.687093258f},
-std::array<float,2>{0.787208974f, 0.187262461f},
-std::array<float,2>{0.255668938f, 0.0758396536f},
-std::array<float,2>{0.701233149f, 0.536337495f},
-std::array<float,2>{0.0565896071f, 0.79520905f},
-std::array<float,2>{0.864598334f, 0.371374726f},
-std::array<float,2>{0.133908764f, 0.377138883f},
-std::array<float,2>{0.925509989f, 0.984566927f},
-std::array<float,2>{0.40252912f, 0.747317076f},
-std::array<float,2>{0.575155556f, 0.194873884f},
-std::array<float,2>{0.0737586394f, 0.141868666f},
-std::array<float,2>{0.760801494f, 0.629914641f},
-std::array<float,2>{0.357736439f, 0.908391416f},
-std::array<float,2>{0.655807853f, 0.448601961f},
-std::array<float,2>{0.466825634f, 0.282312781f},
-std::array<float,2>{0.512384772f, 0.838995337f},
-std::array<float,2>{0.192874163f, 0.570056021f},
-std::array<float,2>{0.941311061f, 0.0164897852f},
-std::array<float,2>{0.293857932f, 0.195659086f},
-std::array<float,2>{0.741504431f, 0.740404665f},
-std::array<float,2>{0.027913576f, 0.998578429f},
-std::array<float,2>{0.831741512f, 0.389202684f},
-std::array<float,2>{0.186453953f, 0.360162288f},
-std::array<float,2>{0.905347168f, 0.786893249f},
-std::array<float,2>{0.406513363f, 0.543729007f},
-std::array<float,2>{0.59545958f, 0.0657465458f},
-std::array<float,2>{0.104136646f, 0.0309505984f},
-std::array<float,2>{0.79303962f, 0.576812983f},
-std::array<float,2>{0.336392343f, 0.829906344f},
-std::array<float,2>{0.668835163f, 0.289861083f},
-std::array<float,2>{0.473762602f, 0.438977987f},
-std::array<float,2>{0.541860461f, 0.915591776f},
-std::array<float,2>{0.23101142f, 0.639768422f},
-std::array<float,2>{0.986644387f, 0.148973793f},
-std::array<float,2>{0.396263719f, 0.117898338f},
-std::array<float,2>{0.569518387f, 0.529482126f},
-std::array<float,2>{0.128532976f, 0.751324594f},
-std::array<float,2>{0.930420995f, 0.320108742f},
-std::array<float,2>{0.0492386892f, 0.421079516f},
-std::array<float,2>{0.868520617f, 0.950094581f},
-std::array<float,2>{0.263459921f, 0.712536752f},
-std::array<float,2>{0.690900087f, 0.245144039f},
-std::array<float,2>{0.200900227f, 0.176995516f},
-std::array<float,2>{0.951200306f, 0.674261808f},
-std::array<float,2>{0.455671161f, 0.889950097f},
-std::array<float,2>{0.50098604f, 0.489697278f},
-std::array<float,2>{0.3514314f, 0.274607629f},
-std::array<float,2>{0.643186033f, 0.847388804f},
-std::array<float,2>{0.068024151f, 0.608505011f},
-std::array<float,2>{0.755120993f, 0.0617540665f},
-std::array<float,2>{0.43920958f, 0.136616766f},
-std::array<float,2>{0.522722721f, 0.642382503f},
-std::array<float,2>{0.212702438f, 0.933826983f},
-std::array<float,2>{0.963387549f, 0.46460861f},
-std::array<float,2>{0.0871693492f, 0.31060043f},
-std::array<float,2>{0.77765131f, 0.81737721f},
-std::array<float,2>{0.374570131f, 0.591082513f},
-std::array<float,2>{0.628502011f, 0.00464551337f},
-std::array<float,2>{0.152545422f, 0.0884402022f},
-std::array<float,2>{0.915433764f, 0.561632276f},
-std::array<float,2>{0.37740311f, 0.80422914f},
-std::array<float,2>{0.592840135f, 0.358591735f},
-std::array<float,2>{0.269209653f, 0.392349064f},
-std::array<float,2>{0.718011022f, 0.978240848f},
-std::array<float,2>{0.0400054753f, 0.731412292f},
-std::array<float,2>{0.856348455f, 0.215047657f},
-std::array<float,2>{0.314138472f, 0.046095755f},
-std::array<float,2>{0.681383073f, 0.612436235f},
-std::array<float,2>{0.113137215f, 0.865348756f},
-std::array<float,2>{0.803811967f, 0.253505528f},
-std::array<float,2>{0.246115148f, 0.471785158f},
-std::array<float,2>{0.971074045f, 0.890945077f},
-std::array<float,2>{0.493622482f, 0.664866209f},
-std::array<float,2>{0.550818682f, 0.168399692f},
-std::array<float,2>{0.00608355319f, 0.227356464f},
-std::array<float,2>{0.824409306f, 0.695027232f},
-std::array<float,2>{0.30307427f, 0.957006633f},
-std::array<float,2>{0.724405408f, 0.436611205f},
-std::array<float,2>{0.423984826f, 0.336273342f},
-std::array<float,2>{0.610463977f, 0.775006831f},
-std::array<float,2>{0.166099101f, 0.504460692f},
-std::array<float,2>{0.882658005f, 0.0986533388f},
-std::array<float,2>{0.282105386f, 0.13907668f},
-std::array<float,2>{0.747920036f, 0.647871792f},
-std::array<float,2>{0.0167000014f, 0.933135748f},
-std::array<float,2>{0.84262979f, 0.465176463f},
-std::array<float,2>{0.173028275f, 0.30581373f},
-std::array<float,2>{0.894307733f, 0.813124835f},
-std::array<float,2>{0.418904632f, 0.587530434f},
-std::array<float,2>{0.60449338f, 0.002198976f},
-std::array<float,2>{0.0965343043f, 0.0933804885f},
-std::array<float,2>{0.782254457f, 0.554963231f},
-std::array<float,2>{0.331018507f, 0.800341427f},
-std::array<float,2>{0.657179594f, 0.351668835f},
-std::array<float,2>{0.48414737f, 0.398122251f},
-std::array<float,2>{0.537687659f, 0.981667638f},
-std::array<float,2>{0.222772837f, 0.729480684f},
-std::array<float,2>{0.99802053f, 0.214302063f},
-std::array<float,2>{0.400437236f, 0.0427178293f},
-std::array<float,2>{0.573746681f, 0.616243601f},
-std::array<float,2>{0.138906434f, 0.859915257f},
-std::array<float,2>{0.9276492f, 0.254556507f},
-std::array<float,2>{0.0616030879f, 0.473610461f},
-std::array<float,2>{0.860563457f, 0.897173762f},
-std::array<float,2>{0.250650942f, 0.671011984f},
-std::array<float,2>{0.696840286f, 0.166963533f},
-std::array<float,2>{0.190568075f, 0.230599701f},
-std::array<float,2>{0.94503212f, 0.688384414f},
-std::array<float,2>{0.461972237f, 0.960435867f},
-std::array<float,2>{0.510430694f, 0.429769456f},
-std::array<float,2>{0.354425102f, 0.340607673f},
-std::array<float,2>{0.650646687f, 0.780494392f},
-std::array<float,2>{0.0743357539f, 0.503328204f},
-std::array<float,2>{0.76352942f, 0.0972379148f},
-std::array<float,2>{0.452155352f, 0.2010151f},
-std::array<float,2>{0.531026781f, 0.737840414f},
-std::array<float,2>{0.209380746f, 0.993029237f},
-std::array<float,2>{0.959562421f, 0.385997802f},
-std::array<float,2>{0.0803022534f, 0.366077155f},
-std::array<float,2>{0.765957415f, 0.782056808f},
-std::array<float,2>{0.365380198f, 0.541710973f},
-std::array<float,2>{0.640622079f, 0.0691445097f},
-std::array<float,2>{0.147365406f, 0.024491217f},
-std::array<float,2>{0.908769548f, 0.573666751f},
-std::array<float,2>{0.389380425f, 0.83455795f},
-std::array<float,2>{0.584729195f, 0.29369539f},
-std::array<float,2>{0.27827695f, 0.444885463f},
-std::array<float,2>{0.706641853f, 0.921303511f},
-std::array<float,2>{0.0354560092f, 0.634998202f},
-std::array<float,2>{0.844269335f, 0.155440688f},
-std::array<float,2>{0.324254364f, 0.12109863f},
-std::array<float,2>{0.675477445f, 0.526551127f},
-std::array<float,2>{0.121279396f, 0.754163682f},
-std::array<float,2>{0.810347795f, 0.315154731f},
-std::array<float,2>{0.23463349f, 0.414647579f},
-std::array<float,2>{0.979379594f, 0.947845399f},
-std::array<float,2>{0.486389935f, 0.715655088f},
-std::array<float,2>{0.559889555f, 0.249296427f},
-std::array<float,2>{0.00998664275f, 0.174596414f},
-std::array<float,2>{0.813635528f, 0.676220059f},
-std::array<float,2>{0.310520142f, 0.882890403f},
-std::array<float,2>{0.730885208f, 0.485204965f},
-std::array<float,2>{0.435370654f, 0.278633893f},
-std::array<float,2>{0.621843338f, 0.850956976f},
-std::array<float,2>{0.156351089f, 0.602180362f},
-std::array<float,2>{0.883791625f, 0.056243021f},
-std::array<float,2>{0.367285401f, 0.240827441f},
-std::array<float,2>{0.629285455f, 0.706458449f},
-std::array<float,2>{0.0910529494f, 0.939845383f},
-std::array<float,2>{0.776600063f, 0.411809057f},
-std::array<float,2>{0.217916444f, 0.327093065f},
-std::array<float,2>{0.967666566f, 0.765282393f},
-std::array<float,2>{0.44530791f, 0.519945145f},
-std::array<float,2>{0.516377389f, 0.113342479f},
-std::array<float,2>{0.0460756682f, 0.0484373048f},
-std::array<float,2>{0.854480445f, 0.5965662f},
-std::array<float,2>{0.273420423f, 0.855773389f},
-std::array<float,2>{0.714234948f, 0.266216844f},
-std::array<float,2>{0.379781604f, 0.492851287f},
-std::array<float,2>{0.587184608f, 0.875258207f},
-std::array<float,2>{0.150895312f, 0.682638347f},
-std::array<float,2>{0.918336332f, 0.181275263f},
-std::array<float,2>{0.499100477f, 0.0728642568f},
-std::array<float,2>{0.548550546f, 0.53198278f},
-std::array<float,2>{0.242638022f, 0.791742504f},
-std::array<float,2>{0.976219714f, 0.37027666f},
-std::array<float,2>{0.113688134f, 0.381762743f},
-std::array<float,2>{0.799344897f, 0.991506219f},
-std::array<float,2>{0.318145305f, 0.745215714f},
-std::array<float,2>{0.684264302f, 0.190160215f},
-std::array<float,2>{0.169168204f, 0.146828875f},
-std::array<float,2>{0.878008783f, 0.626217902f},
-std::array<float,2>{0.427416116f, 0.912316918f},
-std::array<float,2>{0.614196897f, 0.451586604f},
-std::array<float,2>{0.297859997f, 0.285962373f},
-std::array<float,2>{0.720663965f, 0.841053247f},
-std::array<float,2>{0.00078118901f, 0.56295532f},
-std::array<float,2>{0.822022736f, 0.0232679602f},
-std::array<float,2>{0.413330346f, 0.159082279f},
-std::array<float,2>{0.600823343f, 0.661704004f},
-std::array<float,2>{0.180331871f, 0.902462721f},
-std::array<float,2>{0.899364114f, 0.478180647f},
-std::array<float,2>{0.0247307662f, 0.264542609f},
-std::array<float,2>{0.835629761f, 0.867549181f},
-std::array<float,2>{0.290196061f, 0.623886943f},
-std::array<float,2>{0.735782802f, 0.0314998142f},
-std::array<float,2>{0.228043437f, 0.106430292f},
-std::array<float,2>{0.991645098f, 0.515568674f},
-std::array<float,2>{0.472310454f, 0.770932674f},
-std::array<float,2>{0.544129312f, 0.335184604f},
-std::array<float,2>{0.34359771f, 0.425487816f},
-std::array<float,2>{0.667369664f, 0.965888679f},
-std::array<float,2>{0.107108593f, 0.695698857f},
-std::array<float,2>{0.791827977f, 0.223690212f},
-std::array<float,2>{0.260630935f, 0.0146146864f},
-std::array<float,2>{0.694039941f, 0.581022501f},
-std::array<float,2>{0.05286007f, 0.822367549f},
-std::array<float,2>{0.872064292f, 0.298412472f},
-std::array<float,2>{0.131161332f, 0.453666538f},
-std::array<float,2>{0.935399115f, 0.9261657f},
-std::array<float,2>{0.394384086f, 0.656180501f},
-std::array<float,2>{0.565443397f, 0.130005851f},
-std::array<float,2>{0.0633793399f, 0.210271627f},
-std::array<float,2>{0.752977788f, 0.724847734f},
-std::array<float,2>{0.345512867f, 0.974988103f},
-std::array<float,2>{0.647508025f, 0.400764883f},
-std::array<float,2>{0.46032843f, 0.349488795f},
-std::array<float,2>{0.504222274f, 0.808769464f},
-std::array<float,2>{0.196586579f, 0.550622761f},
-std::array<float,2>{0.948486984f, 0.0802528709f},
-std::array<float,2>{0.334856153f, 0.185807258f},
-std::array<float,2>{0.663566589f, 0.686172068f},
-std::array<float,2>{0.0989624858f, 0.881946266f},
-std::array<float,2>{0.785516322f, 0.497280777f},
-std::array<float,2>{0.220886067f, 0.270427853f},
-std::array<float,2>{0.993171394f, 0.853476048f},
-std::array<float,2>{0.478751808f, 0.601377428f},
-std::array<float,2>{0.534760714f, 0.0519694947f},
-std::array<float,2>{0.022660315f, 0.112983853f},
-std::array<float,2>{0.839583933f, 0.515950322f},
-std::array<float,2>{0.285689771f, 0.75980109f},
-std::array<float,2>{0.744608045f, 0.323877573f},
-std::array<float,2>{0.414309829f, 0.40841502f},
-std::array<float,2>{0.606364965f, 0.943556309f},
-std::array<float,2>{0.177092791f, 0.70733881f},
-std::array<float,2>{0.89456445f, 0.236043558f},
-std::array<float,2>{0.465445518f, 0.0168578606f},
-std::array<float,2>{0.515512705f, 0.56913501f},
-std::array<float,2>{0.195024803f, 0.838241994f},
-std::array<float,2>{0.939203203f, 0.282006592f},
-std::array<float,2>{0.0718757361f, 0.447280854f},
-std::array<float,2>{0.758980632f, 0.909427166f},
-std::array<float,2>{0.356044501f, 0.629148364f},
-std::array<float,2>{0.653836787f, 0.140900239f},
-std::array<float,2>{0.13522777f, 0.193545774f},
-std::array<float,2>{0.922504008f, 0.746845424f},
-std::array<float,2>{0.405462712f, 0.986088872f},
-std::array<float,2>{0.577485383f, 0.378833383f},
-std::array<float,2>{0.255915523f, 0.372820556f},
-std::array<float,2>{0.700727582f, 0.796141684f},
-std::array<float,2>{0.0571797267f, 0.535645187f},
-std::array<float,2>{0.865845799f, 0.0745709762f},
-std::array<float,2>{0.384332091f, 0.219703108f},
-std::array<float,2>{0.579523087f, 0.702344477f},
-std::array<float,2>{0.143769756f, 0.961287141f},
-std::array<float,2>{0.912443459f, 0.427528918f},
-std::array<float,2>{0.032200966f, 0.329573005f},
-std::array<float,2>{0.849531591f, 0.766883671f},
-std::array<float,2>{0.276495904f, 0.508266449f},
-std::array<float,2>{0.709890068f, 0.103885382f},
-std::array<float,2>{0.205647305f, 0.0356918164f},
-std::array<float,2>{0.953175426f, 0.620509386f},
-std::array<float,2>{0.448214412f, 0.874361813f},
-std::array<float,2>{0.525396943f, 0.259730846f},
-std::array<float,2>{0.360464066f, 0.480754018f},
-std::array<float,2>{0.63432467f, 0.8986305f},
-std::array<float,2>{0.0852606744f, 0.659966588f},
-std::array<float,2>{0.773358405f, 0.162112117f},
-std::array<float,2>{0.305793077f, 0.0855708122f},
-std::array<float,2>{0.729218066f, 0.551546276f},
-std::array<float,2>{0.011857843f, 0.807457209f},
-std::array<float,2>{0.817124963f, 0.346179664f},
-std::array<float,2>{0.160713986f, 0.403396934f},
-std::array<float,2>{0.890338123f, 0.969653428f},
-std::array<float,2>{0.430364549f, 0.720630705f},
-std::array<float,2>{0.620319247f, 0.205404207f},
-std::array<float,2>{0.118549943f, 0.128519356f},
-std::array<float,2>{0.805030346f, 0.651169956f},
-std::array<float,2>{0.323178947f, 0.924171567f},
-std::array<float,2>{0.677045465f, 0.460500062f},
-std::array<float,2>{0.491503626f, 0.304498166f},
-std::array<float,2>{0.555193007f, 0.827066481f},
-std::array<float,2>{0.23987405f, 0.585903466f},
-std::array<float,2>{0.983274341f, 0.00870136637f},
-std::array<float,2>{0.267176628f, 0.215991035f},
-std::array<float,2>{0.715201259f, 0.731955409f},
-std::array<float,2>{0.0427589603f, 0.976688385f},
-std::array<float,2>{0.859261513f, 0.391228348f},
-std::array<float,2>{0.154413387f, 0.357933611f},
-std::array<float,2>{0.91790098f, 0.803685069f},
-std::array<float,2>{0.37646246f, 0.561326563f},
-std::array<float,2>{0.59106195f, 0.0889592543f},
-std::array<float,2>{0.088988319f, 0.005699398f},
-std::array<float,2>{0.780840516f, 0.590095937f},
-std::array<float,2>{0.372032404f, 0.818085611f},
-std::array<float,2>{0.626876414f, 0.311831832f},
-std::array<float,2>{0.440700501f, 0.463011295f},
-std::array<float,2>{0.521107852f, 0.935342193f},
-std::array<float,2>{0.213209182f, 0.641521215f},
-std::array<float,2>{0.962389648f, 0.135380849f},
-std::array<float,2>{0.42266506f, 0.0979833379f},
-std::array<float,2>{0.611523032f, 0.505316615f},
-std::array<float,2>{0.164748371f, 0.773478627f},
-std::array<float,2>{0.880577862f, 0.337293237f},
-std::array<float,2>{0.00527119776f, 0.436343461f},
-std::array<float,2>{0.827734768f, 0.955634534f},
-std::array<float,2>{0.301956981f, 0.693942308f},
-std::array<float,2>{0.725948334f, 0.227667511f},
-std::array<float,2>{0.249900833f, 0.168958485f},
-std::array<float,2>{0.970144212f, 0.665755928f},
-std::array<float,2>{0.495807081f, 0.892411113f},
-std::array<float,2>{0.553929865f, 0.470931649f},
-std::array<float,2>{0.314750373f, 0.252368033f},
-std::array<float,2>{0.681891799f, 0.866257846f},
-std::array<float,2>{0.11107789f, 0.611799359f},
-std::array<float,2>{0.800873697f, 0.0457037017f},
-std::array<float,2>{0.476044029f, 0.149645522f},
-std::array<float,2>{0.540843904f, 0.638699412f},
-std::array<float,2>{0.232444063f, 0.914537787f},
-std::array<float,2>{0.986176014f, 0.438460171f},
-std::array<float,2>{0.102722578f, 0.290746897f},
-std::array<float,2>{0.796343207f, 0.828589976f},
-std::array<float,2>{0.339570045f, 0.578084469f},
-std::array<float,2>{0.670477748f, 0.0298779234f},
-std::array<float,2>{0.185367331f, 0.0651574731f},
-std::array<float,2>{0.902885497f, 0.544884145f},
-std::array<float,2>{0.408618718f, 0.785853803f},
-std::array<float,2>{0.596801996f, 0.361091405f},
-std::array<float,2>{0.296219051f, 0.390107721f},
-std::array<float,2>{0.739304543f, 0.999174774f},
-std::array<float,2>{0.0308587756f, 0.741250455f},
-std::array<float,2>{0.829621673f, 0.196452886f},
-std::array<float,2>{0.348291308f, 0.0611324906f},
-std::array<float,2>{0.641201735f, 0.6080845f},
-std::array<float,2>{0.0690106601f, 0.845826507f},
-std::array<float,2>{0.757196128f, 0.273952603f},
-std::array<float,2>{0.202821985f, 0.488575667f},
-std::array<float,2>{0.950032949f, 0.88888824f},
-std::array<float,2>{0.454872817f, 0.675392032f},
-std::array<float,2>{0.502294421f, 0.176114589f},
-std::array<float,2>{0.0478864349f, 0.244906545f},
-std::array<float,2>{0.869638801f, 0.711649299f},
-std::array<float,2>{0.264701217f, 0.950787246f},
-std::array<float,2>{0.689127684f, 0.420191765f},
-std::array<float,2>{0.398332804f, 0.318883747f},
-std::array<float,2>{0.567358613f, 0.750127673f},
-std::array<float,2>{0.125551209f, 0.53066206f},
-std::array<float,2>{0.933493316f, 0.118177779f},
-std::array<float,2>{0.25280267f, 0.165242255f},
-std::array<float,2>{0.697963476f, 0.669911683f},
-std::array<float,2>{0.0600727759f, 0.89534384f},
-std::array<float,2>{0.863195956f, 0.476212949f},
-std::array<float,2>{0.13822028f, 0.257252187f},
-std::array<float,2>{0.928450584f, 0.861439466f},
-std::array<float,2>{0.399628282f, 0.614895046f},
-std::array<float,2>{0.571751654f, 0.0395929925f},
-std::array<float,2>{0.0777532607f, 0.0938335061f},
-std::array<float,2>{0.764178038f, 0.501886964f},
-std::array<float,2>{0.352423012f, 0.778164327f},
-std::array<float,2>{0.649581254f, 0.342840582f},
-std::array<float,2>{0.463420004f, 0.431653559f},
-std::array<float,2>{0.509462476f, 0.957588375f},
-std::array<float,2>{0.189367443f, 0.689666033f},
-std::array<float,2>{0.943144619f, 0.234214947f},
-std::array<float,2>{0.420590013f, 0.00191355043f},
-std::array<float,2>{0.602686703f, 0.589615047f},
-std::array<float,2>{0.174599007f, 0.816343844f},
-std::array<float,2>{0.89139545f, 0.307825536f},
-std::array<float,2>{0.018038867f, 0.467395395f},
-std::array<float,2>{0.84064424f, 0.930158019f},
-std::array<float,2>{0.284719914f, 0.646363795f},
-std::array<float,2>{0.74959141f, 0.137279406f},
-std::array<float,2>{0.22631526f, 0.211694464f},
-std::array<float,2>{0.999785662f, 0.727085233f},
-std::array<float,2>{0.480901718f, 0.982494116f},
-std::array<float,2>{0.535196841f, 0.395708859f},
-std::array<float,2>{0.329773933f, 0.355077505f},
-std::array<float,2>{0.65989387f, 0.798281491f},
-std::array<float,2>{0.0950169265f, 0.557504892f},
-std::array<float,2>{0.783566535f, 0.0917215273f},
-std::array<float,2>{0.485278815f, 0.24793908f},
-std::array<float,2>{0.561393678f, 0.71705693f},
-std::array<float,2>{0.236727357f, 0.946222723f},
-std::array<float,2>{0.976608872f, 0.417703956f},
-std::array<float,2>{0.124321535f, 0.313482672f},
-std::array<float,2>{0.811834395f, 0.756419361f},
-std::array<float,2>{0.32620424f, 0.524165034f},
-std::array<float,2>{0.672731876f, 0.124793254f},
-std::array<float,2>{0.158851668f, 0.0585089624f},
-std::array<float,2>{0.886056364f, 0.604382932f},
-std::array<float,2>{0.43578133f, 0.849173605f},
-std::array<float,2>{0.623714685f, 0.279376239f},
-std::array<float,2>{0.311168462f, 0.487482071f},
-std::array<float,2>{0.734079659f, 0.885736823f},
-std::array<float,2>{0.00950690266f, 0.67925638f},
-std::array<float,2>{0.815474033f, 0.173414201f},
-std::array<float,2>{0.36344564f, 0.0666795969f},
-std::array<float,2>{0.638047397f, 0.54066503f},
-std::array<float,2>{0.0787370726f, 0.784274757f},
-std::array<float,2>{0.768792987f, 0.363461107f},
-std::array<float,2>{0.207381427f, 0.38326481f},
-std::array<float,2>{0.958545029f, 0.995245457f},
-std::array<float,2>{0.449608684f, 0.735206723f},
-std::array<float,2>{0.527871192f, 0.201221392f},
-std::array<float,2>{0.0372368917f, 0.153477088f},
-std::array<float,2>{0.846357644f, 0.633740306f},
-std::array<float,2>{0.279461205f, 0.919546306f},
-std::array<float,2>{0.703424752f, 0.441703022f},
-std::array<float,2>{0.388463497f, 0.296839118f},
-std::array<float,2>{0.583520055f, 0.832561433f},
-std::array<float,2>{0.145092219f, 0.570475519f},
-std::array<float,2>{0.907429636f, 0.0261467267f},
-std::array<float,2>{0.318847358f, 0.18919912f},
-std::array<float,2>{0.685964882f, 0.743070006f},
-std::array<float,2>{0.115616336f, 0.988635898f},
-std::array<float,2>{0.797905564f, 0.38062489f},
-std::array<float,2>{0.245907351f, 0.368307918f},
-std::array<float,2>{0.973190367f, 0.789646506f},
-std::array<float,2>{0.496425748f, 0.533517003f},
-std::array<float,2>{0.549767613f, 0.0719093978f},
-std::array<float,2>{0.00345867849f, 0.0204896536f},
-std::array<float,2>{0.823652267f, 0.566072941f},
-std::array<float,2>{0.29920429f, 0.842723072f},
-std::array<float,2>{0.721831918f, 0.287657797f},
-std::array<float,2>{0.429445803f, 0.450057536f},
-std::array<float,2>{0.616086543f, 0.910409093f},
-std::array<float,2>{0.171272978f, 0.628140271f},
-std::array<float,2>{0.87647599f, 0.144966945f},
-std::array<float,2>{0.443202585f, 0.115584806f},
-std::array<float,2>{0.519197941f, 0.521844506f},
-std::array<float,2>{0.216473252f, 0.763110518f},
-std::array<float,2>{0.966474056f, 0.324720532f},
-std::array<float,2>{0.0925122201f, 0.412432313f},
-std::array<float,2>{0.775002658f, 0.938105226f},
-std::array<float,2>{0.370657265f, 0.70386523f},
-std::array<float,2>{0.631028771f, 0.239153951f},
-std::array<float,2>{0.14930065f, 0.183130115f},
-std::array<float,2>{0.921465635f, 0.680922508f},
-std::array<float,2>{0.382461101f, 0.877380967f},
-std::array<float,2>{0.589310944f, 0.494311243f},
-std::array<float,2>{0.269883215f, 0.268029541f},
-std::array<float,2>{0.71222049f, 0.858308911f},
-std::array<float,2>{0.0447369777f, 0.594104052f},
-std::array<float,2>{0.852838099f, 0.0492238961f},
-std::array<float,2>{0.390957981f, 0.132296115f},
-std::array<float,2>{0.563140571f, 0.654152393f},
-std::array<float,2>{0.129749492f, 0.928898931f},
-std::array<float,2>{0.93608737f, 0.455702573f},
-std::array<float,2>{0.0509502552f, 0.300408393f},
-std::array<float,2>{0.874680459f, 0.821172953f},
-std::array<float,2>{0.258976042f, 0.578800738f},
-std::array<float,2>{0.691920936f, 0.0117326826f},
-std::array<float,2>{0.197499111f, 0.0797063261f},
-std::array<float,2>{0.94539535f, 0.548557401f},
-std::array<float,2>{0.457570404f, 0.811073899f},
-std::array<float,2>{0.505985558f, 0.350100547f},
-std::array<float,2>{0.347623557f, 0.399341643f},
-std::array<float,2>{0.646114767f, 0.972809255f},
-std::array<float,2>{0.0645071939f, 0.724587917f},
-std::array<float,2>{0.75165391f, 0.208733752f},
-std::array<float,2>{0.291095287f, 0.0335363299f},
-std::array<float,2>{0.737867594f, 0.621700525f},
-std::array<float,2>{0.0265672505f, 0.87050885f},
-std::array<float,2>{0.833391428f, 0.261996776f},
-std::array<float,2>{0.183003336f, 0.479075968f},
-std::array<float,2>{0.900958002f, 0.905423999f},
-std::array<float,2>{0.410400093f, 0.662952423f},
-std::array<float,2>{0.598739386f, 0.157014802f},
-std::array<float,2>{0.107960612f, 0.224726453f},
-std::array<float,2>{0.790276051f, 0.698298454f},
-std::array<float,2>{0.341589451f, 0.967867494f},
-std::array<float,2>{0.665705025f, 0.423358709f},
-std::array<float,2>{0.468920887f, 0.332223654f},
-std::array<float,2>{0.545712531f, 0.771540463f},
-std::array<float,2>{0.229439855f, 0.513072848f},
-std::array<float,2>{0.988389611f, 0.108931139f},
-std::array<float,2>{0.359065354f, 0.143356174f},
-std::array<float,2>{0.655055285f, 0.632488191f},
-std::array<float,2>{0.0725555569f, 0.906289637f},
-std::array<float,2>{0.760447085f, 0.445928305f},
-std::array<float,2>{0.192185849f, 0.284564763f},
-std::array<float,2>{0.940384686f, 0.836278737f},
-std::array<float,2>{0.468223631f, 0.568158448f},
-std::array<float,2>{0.513424993f, 0.019357061f},
-std::array<float,2>{0.0547823943f, 0.0775041878f},
-std::array<float,2>{0.863890529f, 0.537809372f},
-std::array<float,2>{0.2548002f, 0.793091834f},
-std::array<float,2>{0.703025401f, 0.373875529f},
-std::array<float,2>{0.403657556f, 0.37604782f},
-std::array<float,2>{0.575584888f, 0.986919641f},
-std::array<float,2>{0.133167744f, 0.748611629f},
-std::array<float,2>{0.924048364f, 0.192391783f},
-std::array<float,2>{0.478193969f, 0.0545253344f},
-std::array<float,2>{0.532957911f, 0.597670972f},
-std::array<float,2>{0.219651923f, 0.854762673f},
-std::array<float,2>{0.995292246f, 0.272809178f},
-std::array<float,2>{0.100842707f, 0.4990955f},
-std::array<float,2>{0.788529932f, 0.880813658f},
-std::array<float,2>{0.333967775f, 0.68457973f},
-std::array<float,2>{0.660837531f, 0.1842646f},
-std::array<float,2>{0.178132936f, 0.236739188f},
-std::array<float,2>{0.896580398f, 0.710077584f},
-std::array<float,2>{0.417837977f, 0.942925036f},
-std::array<float,2>{0.607741952f, 0.407295913f},
-std::array<float,2>{0.287409127f, 0.321553618f},
-std::array<float,2>{0.74272573f, 0.757879972f},
-std::array<float,2>{0.0209452678f, 0.518108428f},
-std::array<float,2>{0.836094916f, 0.109407149f},
-std::array<float,2>{0.432725608f, 0.203363881f},
-std::array<float,2>{0.617249489f, 0.722180009f},
-std::array<float,2>{0.162651375f, 0.971223772f},
-std::array<float,2>{0.888159275f, 0.405904084f},
-std::array<float,2>{0.0139268702f, 0.344584525f},
-std::array<float,2>{0.820031941f, 0.805994272f},
-std::array<float,2>{0.307886243f, 0.553381503f},
-std::array<float,2>{0.726687014f, 0.0834017769f},
-std::array<float,2>{0.240239903f, 0.0107631292f},
-std::array<float,2>{0.980822027f, 0.583560765f},
-std::array<float,2>{0.488480687f, 0.825647652f},
-std::array<float,2>{0.557347536f, 0.300958663f},
-std::array<float,2>{0.320668638f, 0.458981097f},
-std::array<float,2>{0.678892612f, 0.922323346f},
-std::array<float,2>{0.120727055f, 0.649416149f},
-std::array<float,2>{0.807462156f, 0.126573563f},
-std::array<float,2>{0.27442655f, 0.102603532f},
-std::array<float,2>{0.707226276f, 0.510634363f},
-std::array<float,2>{0.0351378545f, 0.76793313f},
-std::array<float,2>{0.850010574f, 0.331408352f},
-std::array<float,2>{0.14147824f, 0.429571301f},
-std::array<float,2>{0.911082447f, 0.963213086f},
-std::array<float,2>{0.384884953f, 0.700133741f},
-std::array<float,2>{0.580949068f, 0.222509861f},
-std::array<float,2>{0.0828273147f, 0.162027061f},
-std::array<float,2>{0.771200359f, 0.656570077f},
-std::array<float,2>{0.361997753f, 0.901893258f},
-std::array<float,2>{0.63563025f, 0.482591718f},
-std::array<float,2>{0.446327567f, 0.260318696f},
-std::array<float,2>{0.523973584f, 0.872356951f},
-std::array<float,2>{0.203294933f, 0.618126094f},
-std::array<float,2>{0.956179798f, 0.0378426649f},
-std::array<float,2>{0.304205447f, 0.230111644f},
-std::array<float,2>{0.723579586f, 0.692491531f},
-std::array<float,2>{0.00691880193f, 0.953615189f},
-std::array<float,2>{0.826111197f, 0.434721142f},
-std::array<float,2>{0.167824656f, 0.339632243f},
-std::array<float,2>{0.881635427f, 0.77694577f},
-std::array<float,2>{0.4256275f, 0.507592857f},
-std::array<float,2>{0.609420776f, 0.099740237f},
-std::array<float,2>{0.111340247f, 0.0436795279f},
-std::array<float,2>{0.802961648f, 0.610868156f},
-std::array<float,2>{0.312577099f, 0.863297164f},
-std::array<float,2>{0.680555642f, 0.25142622f},
-std::array<float,2>{0.492714316f, 0.469728887f},
-std::array<float,2>{0.552577615f, 0.892617404f},
-std::array<float,2>{0.247752085f, 0.666859508f},
-std::array<float,2>{0.972191274f, 0.171560392f},
-std::array<float,2>{0.37808159f, 0.0866380036f},
-std::array<float,2>{0.592331707f, 0.560082436f},
-std::array<float,2>{0.153583467f, 0.801666021f},
-std::array<float,2>{0.914951146f, 0.356257319f},
-std::array<float,2>{0.0406094976f, 0.39387095f},
-std::array<float,2>{0.856731892f, 0.979096472f},
-std::array<float,2>{0.268236309f, 0.732621372f},
-std::array<float,2>{0.717299938f, 0.217400268f},
-std::array<float,2>{0.211439356f, 0.133751452f},
-std::array<float,2>{0.964595079f, 0.643012702f},
-std::array<float,2>{0.438070685f, 0.935947359f},
-std::array<float,2>{0.521633804f, 0.461589545f},
-std::array<float,2>{0.373585671f, 0.310379416f},
-std::array<float,2>{0.6276384f, 0.819931865f},
-std::array<float,2>{0.0866536498f, 0.593215346f},
-std::array<float,2>{0.779042482f, 0.00751932943f},
-std::array<float,2>{0.456483901f, 0.178282261f},
-std::array<float,2>{0.500278413f, 0.673527479f},
-std::array<float,2>{0.19991146f, 0.888123691f},
-std::array<float,2>{0.952480972f, 0.491854966f},
-std::array<float,2>{0.0671719238f, 0.276332676f},
-std::array<float,2>{0.754737258f, 0.845190346f},
-std::array<float,2>{0.349794f, 0.60646534f},
-std::array<float,2>{0.644503415f, 0.0604396872f},
-std::array<float,2>{0.12754111f, 0.120873109f},
-std::array<float,2>{0.931370258f, 0.527382135f},
-std::array<float,2>{0.395211637f, 0.752086937f},
-std::array<float,2>{0.569182932f, 0.317154974f},
-std::array<float,2>{0.262593895f, 0.41935277f},
-std::array<float,2>{0.689830422f, 0.951603532f},
-std::array<float,2>{0.0500100031f, 0.714003026f},
-std::array<float,2>{0.867466569f, 0.243948445f},
-std::array<float,2>{0.337838739f, 0.0290093776f},
-std::array<float,2>{0.669285476f, 0.575211406f},
-std::array<float,2>{0.105160549f, 0.831621706f},
-std::array<float,2>{0.794184864f, 0.292066425f},
-std::array<float,2>{0.232086226f, 0.440635651f},
-std::array<float,2>{0.987701178f, 0.917793751f},
-std::array<float,2>{0.472841889f, 0.638352275f},
-std::array<float,2>{0.542212546f, 0.150609493f},
-std::array<float,2>{0.0289828163f, 0.197738484f},
-std::array<float,2>{0.831004202f, 0.740152597f},
-std::array<float,2>{0.294844955f, 0.997785866f},
-std::array<float,2>{0.741137266f, 0.386895955f},
-std::array<float,2>{0.407343715f, 0.361972243f},
-std::array<float,2>{0.594551086f, 0.787772477f},
-std::array<float,2>{0.187317044f, 0.545271814f},
-std::array<float,2>{0.904790103f, 0.0633157939f}}
\ No newline at end of file
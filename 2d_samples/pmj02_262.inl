@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.38537249f, 0.61386174f},
-std::array<float,2>{0.981375456f, 0.0319418274f},
-std::array<float,2>{0.513051391f, 0.873081326f},
-std::array<float,2>{0.0127546769f, 0.406161666f},
-std::array<float,2>{0.151855648f, 0.900828838f},
-std::array<float,2>{0.690944374f, 0.272545069f},
-std::array<float,2>{0.809593558f, 0.724952459f},
-std::array<float,2>{0.260909557f, 0.191125825f},
-std::array<float,2>{0.10757032f, 0.665398359f},
-std::array<float,2>{0.603860855f, 0.153075531f},
-std::array<float,2>{0.904312372f, 0.960538924f},
-std::array<float,2>{0.459110349f, 0.319455475f},
-std::array<float,2>{0.369799852f, 0.75206089f},
-std::array<float,2>{0.855523646f, 0.458154202f},
-std::array<float,2>{0.642157674f, 0.542097807f},
-std::array<float,2>{0.188932836f, 0.0637342632f},
-std::array<float,2>{0.293737203f, 0.710138679f},
-std::array<float,2>{0.773197889f, 0.225295305f},
-std::array<float,2>{0.739764035f, 0.915448368f},
-std::array<float,2>{0.16887489f, 0.283440948f},
-std::array<float,2>{0.0337194875f, 0.818959534f},
-std::array<float,2>{0.532491207f, 0.427667916f},
-std::array<float,2>{0.958377421f, 0.571250021f},
-std::array<float,2>{0.431575775f, 0.027624242f},
-std::array<float,2>{0.223969817f, 0.505201638f},
-std::array<float,2>{0.674444377f, 0.121898688f},
-std::array<float,2>{0.827886939f, 0.806240499f},
-std::array<float,2>{0.334982574f, 0.472808987f},
-std::array<float,2>{0.496295273f, 0.972323596f},
-std::array<float,2>{0.932336926f, 0.352976173f},
-std::array<float,2>{0.576954901f, 0.632329583f},
-std::array<float,2>{0.0872616693f, 0.17740351f},
-std::array<float,2>{0.320837587f, 0.556787908f},
-std::array<float,2>{0.832903922f, 0.0919566229f},
-std::array<float,2>{0.657016695f, 0.776010454f},
-std::array<float,2>{0.239283845f, 0.449037284f},
-std::array<float,2>{0.0672787502f, 0.948137879f},
-std::array<float,2>{0.588133752f, 0.329447478f},
-std::array<float,2>{0.914288938f, 0.685013652f},
-std::array<float,2>{0.483900905f, 0.128336713f},
-std::array<float,2>{0.174198791f, 0.738321543f},
-std::array<float,2>{0.730205953f, 0.215016961f},
-std::array<float,2>{0.751493394f, 0.878253639f},
-std::array<float,2>{0.302949876f, 0.250176638f},
-std::array<float,2>{0.415747494f, 0.857100964f},
-std::array<float,2>{0.946933031f, 0.389100432f},
-std::array<float,2>{0.552430928f, 0.597405076f},
-std::array<float,2>{0.049124293f, 0.061503429f},
-std::array<float,2>{0.446354866f, 0.64699322f},
-std::array<float,2>{0.876718938f, 0.166803032f},
-std::array<float,2>{0.615444481f, 0.998959363f},
-std::array<float,2>{0.123481415f, 0.361812919f},
-std::array<float,2>{0.204706132f, 0.784998775f},
-std::array<float,2>{0.634604514f, 0.496778309f},
-std::array<float,2>{0.862180233f, 0.52133733f},
-std::array<float,2>{0.348073423f, 0.102347769f},
-std::array<float,2>{0.0177615639f, 0.588824689f},
-std::array<float,2>{0.523419499f, 0.00924821477f},
-std::array<float,2>{0.995080948f, 0.835685432f},
-std::array<float,2>{0.396674782f, 0.407485187f},
-std::array<float,2>{0.272183746f, 0.92347908f},
-std::array<float,2>{0.793080151f, 0.308653712f},
-std::array<float,2>{0.714654803f, 0.689607441f},
-std::array<float,2>{0.131259531f, 0.243834496f},
-std::array<float,2>{0.474202335f, 0.526891053f},
-std::array<float,2>{0.908173859f, 0.0991479307f},
-std::array<float,2>{0.584000528f, 0.793903828f},
-std::array<float,2>{0.0722955689f, 0.487169236f},
-std::array<float,2>{0.244315997f, 0.984856427f},
-std::array<float,2>{0.669744849f, 0.372500181f},
-std::array<float,2>{0.838110924f, 0.648894548f},
-std::array<float,2>{0.319442242f, 0.160470128f},
-std::array<float,2>{0.0559141822f, 0.695931435f},
-std::array<float,2>{0.557968438f, 0.240447193f},
-std::array<float,2>{0.941708565f, 0.935932457f},
-std::array<float,2>{0.410669297f, 0.300840318f},
-std::array<float,2>{0.311085701f, 0.836678565f},
-std::array<float,2>{0.761644781f, 0.417171687f},
-std::array<float,2>{0.720334053f, 0.578634202f},
-std::array<float,2>{0.186875403f, 0.00462437328f},
-std::array<float,2>{0.359039605f, 0.677631378f},
-std::array<float,2>{0.872840822f, 0.134658426f},
-std::array<float,2>{0.632534266f, 0.94195807f},
-std::array<float,2>{0.217229366f, 0.336690038f},
-std::array<float,2>{0.111928813f, 0.770512938f},
-std::array<float,2>{0.620275795f, 0.437805772f},
-std::array<float,2>{0.884124041f, 0.550615013f},
-std::array<float,2>{0.437814772f, 0.0845100358f},
-std::array<float,2>{0.134558409f, 0.606937289f},
-std::array<float,2>{0.707112551f, 0.0507051162f},
-std::array<float,2>{0.784486651f, 0.847407103f},
-std::array<float,2>{0.275027514f, 0.375203669f},
-std::array<float,2>{0.398534358f, 0.886287272f},
-std::array<float,2>{0.989920139f, 0.261927783f},
-std::array<float,2>{0.526442826f, 0.746937633f},
-std::array<float,2>{0.0293985754f, 0.206405714f},
-std::array<float,2>{0.252705365f, 0.563920915f},
-std::array<float,2>{0.800972044f, 0.0201572068f},
-std::array<float,2>{0.701730549f, 0.826788545f},
-std::array<float,2>{0.142030984f, 0.430202067f},
-std::array<float,2>{0.00421906216f, 0.906513512f},
-std::array<float,2>{0.507392883f, 0.291092277f},
-std::array<float,2>{0.969600201f, 0.712778926f},
-std::array<float,2>{0.380230725f, 0.233829424f},
-std::array<float,2>{0.197550699f, 0.639735818f},
-std::array<float,2>{0.648946345f, 0.18474406f},
-std::array<float,2>{0.850432277f, 0.977463663f},
-std::array<float,2>{0.360699266f, 0.350045711f},
-std::array<float,2>{0.461454004f, 0.800905645f},
-std::array<float,2>{0.896924078f, 0.483156234f},
-std::array<float,2>{0.593855739f, 0.514149725f},
-std::array<float,2>{0.0955806375f, 0.110595882f},
-std::array<float,2>{0.424560219f, 0.73063457f},
-std::array<float,2>{0.968221188f, 0.198054165f},
-std::array<float,2>{0.540478766f, 0.894030452f},
-std::array<float,2>{0.0447190627f, 0.280733973f},
-std::array<float,2>{0.159149751f, 0.865724921f},
-std::array<float,2>{0.745273113f, 0.39327234f},
-std::array<float,2>{0.777821183f, 0.620816231f},
-std::array<float,2>{0.283016354f, 0.0404171348f},
-std::array<float,2>{0.0835758299f, 0.534855902f},
-std::array<float,2>{0.568901777f, 0.0725781024f},
-std::array<float,2>{0.92596364f, 0.760117829f},
-std::array<float,2>{0.488224983f, 0.464205146f},
-std::array<float,2>{0.343013585f, 0.965668619f},
-std::array<float,2>{0.81909889f, 0.327735484f},
-std::array<float,2>{0.679736435f, 0.6617679f},
-std::array<float,2>{0.229313731f, 0.140750021f},
-std::array<float,2>{0.40680933f, 0.544947207f},
-std::array<float,2>{0.940086782f, 0.0668346807f},
-std::array<float,2>{0.559431493f, 0.757265687f},
-std::array<float,2>{0.0587547235f, 0.453373224f},
-std::array<float,2>{0.181732893f, 0.954342723f},
-std::array<float,2>{0.723564208f, 0.315270543f},
-std::array<float,2>{0.763340473f, 0.668248296f},
-std::array<float,2>{0.305620819f, 0.150925845f},
-std::array<float,2>{0.0769005865f, 0.722191751f},
-std::array<float,2>{0.581844985f, 0.193232507f},
-std::array<float,2>{0.913585007f, 0.903928638f},
-std::array<float,2>{0.46986109f, 0.266320586f},
-std::array<float,2>{0.312531531f, 0.870059609f},
-std::array<float,2>{0.842437029f, 0.398618281f},
-std::array<float,2>{0.665819824f, 0.611585379f},
-std::array<float,2>{0.247154549f, 0.0352425575f},
-std::array<float,2>{0.281234592f, 0.627845109f},
-std::array<float,2>{0.785328925f, 0.173948184f},
-std::array<float,2>{0.704029739f, 0.974570513f},
-std::array<float,2>{0.138794482f, 0.355583042f},
-std::array<float,2>{0.0250098202f, 0.809943497f},
-std::array<float,2>{0.531001806f, 0.469869047f},
-std::array<float,2>{0.986935079f, 0.501920521f},
-std::array<float,2>{0.406095058f, 0.119981468f},
-std::array<float,2>{0.211221084f, 0.575241029f},
-std::array<float,2>{0.626455843f, 0.0235535279f},
-std::array<float,2>{0.869549692f, 0.814816594f},
-std::array<float,2>{0.352065295f, 0.424145371f},
-std::array<float,2>{0.443433225f, 0.920211434f},
-std::array<float,2>{0.887690961f, 0.286355078f},
-std::array<float,2>{0.622053623f, 0.704139709f},
-std::array<float,2>{0.114783414f, 0.218780667f},
-std::array<float,2>{0.366483837f, 0.597658932f},
-std::array<float,2>{0.845131755f, 0.0550324544f},
-std::array<float,2>{0.652853966f, 0.853733778f},
-std::array<float,2>{0.200520292f, 0.384928614f},
-std::array<float,2>{0.0976788029f, 0.881768942f},
-std::array<float,2>{0.599171519f, 0.256145149f},
-std::array<float,2>{0.89260751f, 0.738218904f},
-std::array<float,2>{0.466907829f, 0.214227229f},
-std::array<float,2>{0.145578906f, 0.683430433f},
-std::array<float,2>{0.695342302f, 0.130310401f},
-std::array<float,2>{0.797984183f, 0.951069415f},
-std::array<float,2>{0.254583508f, 0.334820777f},
-std::array<float,2>{0.377030075f, 0.778418183f},
-std::array<float,2>{0.975574493f, 0.453005016f},
-std::array<float,2>{0.500509143f, 0.561398566f},
-std::array<float,2>{0.00366970664f, 0.0877666771f},
-std::array<float,2>{0.488649219f, 0.695089757f},
-std::array<float,2>{0.925294995f, 0.246351555f},
-std::array<float,2>{0.565223932f, 0.927787006f},
-std::array<float,2>{0.0782518461f, 0.307387739f},
-std::array<float,2>{0.230996892f, 0.829012454f},
-std::array<float,2>{0.687412262f, 0.413497478f},
-std::array<float,2>{0.8136518f, 0.59339124f},
-std::array<float,2>{0.337210119f, 0.0147524644f},
-std::array<float,2>{0.0422296412f, 0.51950717f},
-std::array<float,2>{0.545261562f, 0.107299566f},
-std::array<float,2>{0.963967025f, 0.785477281f},
-std::array<float,2>{0.427720487f, 0.493298203f},
-std::array<float,2>{0.287573725f, 0.994347811f},
-std::array<float,2>{0.774148166f, 0.367155194f},
-std::array<float,2>{0.748286545f, 0.640924513f},
-std::array<float,2>{0.161472052f, 0.170323655f},
-std::array<float,2>{0.456796855f, 0.582715034f},
-std::array<float,2>{0.901213169f, 0.00168831646f},
-std::array<float,2>{0.608792603f, 0.841346323f},
-std::array<float,2>{0.103446968f, 0.421584874f},
-std::array<float,2>{0.191504344f, 0.931254923f},
-std::array<float,2>{0.647040963f, 0.298648477f},
-std::array<float,2>{0.854363739f, 0.699560702f},
-std::array<float,2>{0.373706579f, 0.236169606f},
-std::array<float,2>{0.0105142938f, 0.653020382f},
-std::array<float,2>{0.508761585f, 0.158086732f},
-std::array<float,2>{0.979823649f, 0.991515398f},
-std::array<float,2>{0.387887776f, 0.369197726f},
-std::array<float,2>{0.262517482f, 0.789326727f},
-std::array<float,2>{0.807392478f, 0.488672793f},
-std::array<float,2>{0.694323897f, 0.529978275f},
-std::array<float,2>{0.153029665f, 0.0950297266f},
-std::array<float,2>{0.328596562f, 0.745348155f},
-std::array<float,2>{0.82194829f, 0.210869253f},
-std::array<float,2>{0.678766966f, 0.890115023f},
-std::array<float,2>{0.220668644f, 0.258957088f},
-std::array<float,2>{0.0929249302f, 0.84997499f},
-std::array<float,2>{0.573517561f, 0.381534666f},
-std::array<float,2>{0.936132789f, 0.604801118f},
-std::array<float,2>{0.492492914f, 0.0518815406f},
-std::array<float,2>{0.165472403f, 0.552739501f},
-std::array<float,2>{0.737949193f, 0.0788784474f},
-std::array<float,2>{0.76777029f, 0.767121196f},
-std::array<float,2>{0.291100174f, 0.443108708f},
-std::array<float,2>{0.435936868f, 0.940698802f},
-std::array<float,2>{0.954825699f, 0.341308922f},
-std::array<float,2>{0.538516939f, 0.674359739f},
-std::array<float,2>{0.0352615155f, 0.137499377f},
-std::array<float,2>{0.297401667f, 0.509915829f},
-std::array<float,2>{0.755077422f, 0.116518453f},
-std::array<float,2>{0.733971298f, 0.797736764f},
-std::array<float,2>{0.179227754f, 0.479898185f},
-std::array<float,2>{0.0537925139f, 0.983775556f},
-std::array<float,2>{0.548686504f, 0.345509678f},
-std::array<float,2>{0.953041375f, 0.633918285f},
-std::array<float,2>{0.421205312f, 0.181072488f},
-std::array<float,2>{0.23541458f, 0.716163397f},
-std::array<float,2>{0.661502838f, 0.229002699f},
-std::array<float,2>{0.829402804f, 0.910391688f},
-std::array<float,2>{0.325209469f, 0.2936382f},
-std::array<float,2>{0.479625493f, 0.822758257f},
-std::array<float,2>{0.920671999f, 0.434366792f},
-std::array<float,2>{0.592776418f, 0.570086002f},
-std::array<float,2>{0.0648763552f, 0.0167337563f},
-std::array<float,2>{0.393312335f, 0.658131659f},
-std::array<float,2>{0.999260783f, 0.145467386f},
-std::array<float,2>{0.516739845f, 0.963139772f},
-std::array<float,2>{0.0225253776f, 0.320947319f},
-std::array<float,2>{0.128287137f, 0.763319731f},
-std::array<float,2>{0.717486322f, 0.467265308f},
-std::array<float,2>{0.791843772f, 0.537776411f},
-std::array<float,2>{0.267282069f, 0.074416399f},
-std::array<float,2>{0.118163146f, 0.621158063f},
-std::array<float,2>{0.610826313f, 0.0453744121f},
-std::array<float,2>{0.882095993f, 0.862538278f},
-std::array<float,2>{0.451542109f, 0.397022367f},
-std::array<float,2>{0.347246557f, 0.894933522f},
-std::array<float,2>{0.86558789f, 0.274968743f},
-std::array<float,2>{0.639615238f, 0.729176521f},
-std::array<float,2>{0.21035336f, 0.199336633f},
-std::array<float,2>{0.433299303f, 0.572273672f},
-std::array<float,2>{0.960841358f, 0.030619476f},
-std::array<float,2>{0.534898102f, 0.816569746f},
-std::array<float,2>{0.0324549675f, 0.427964449f},
-std::array<float,2>{0.170725793f, 0.916922987f},
-std::array<float,2>{0.741397262f, 0.282386035f},
-std::array<float,2>{0.771099567f, 0.708227038f},
-std::array<float,2>{0.295283526f, 0.223507404f},
-std::array<float,2>{0.0889097527f, 0.628968656f},
-std::array<float,2>{0.575660825f, 0.177804962f},
-std::array<float,2>{0.930331767f, 0.969074428f},
-std::array<float,2>{0.499118358f, 0.355082184f},
-std::array<float,2>{0.332644135f, 0.807325065f},
-std::array<float,2>{0.825218618f, 0.475590527f},
-std::array<float,2>{0.672011554f, 0.506494582f},
-std::array<float,2>{0.225871027f, 0.124060556f},
-std::array<float,2>{0.258039594f, 0.722743452f},
-std::array<float,2>{0.812194586f, 0.188149393f},
-std::array<float,2>{0.688076079f, 0.900092006f},
-std::array<float,2>{0.149589851f, 0.269901991f},
-std::array<float,2>{0.0152781764f, 0.871334612f},
-std::array<float,2>{0.514419794f, 0.403561264f},
-std::array<float,2>{0.983667672f, 0.616624594f},
-std::array<float,2>{0.382853776f, 0.0350500979f},
-std::array<float,2>{0.191376194f, 0.540297866f},
-std::array<float,2>{0.644316196f, 0.0655277967f},
-std::array<float,2>{0.858893216f, 0.750938237f},
-std::array<float,2>{0.367431134f, 0.460203618f},
-std::array<float,2>{0.458870232f, 0.95782274f},
-std::array<float,2>{0.903368771f, 0.316694736f},
-std::array<float,2>{0.602821648f, 0.666601896f},
-std::array<float,2>{0.107091449f, 0.155166253f},
-std::array<float,2>{0.349984348f, 0.522796154f},
-std::array<float,2>{0.859547675f, 0.104591526f},
-std::array<float,2>{0.634816408f, 0.783101797f},
-std::array<float,2>{0.206304625f, 0.498963058f},
-std::array<float,2>{0.122387677f, 0.996566892f},
-std::array<float,2>{0.614018619f, 0.360934526f},
-std::array<float,2>{0.877828658f, 0.645901382f},
-std::array<float,2>{0.448927552f, 0.164971694f},
-std::array<float,2>{0.129705131f, 0.688757658f},
-std::array<float,2>{0.711267471f, 0.24593854f},
-std::array<float,2>{0.796269417f, 0.924007714f},
-std::array<float,2>{0.270553559f, 0.311377943f},
-std::array<float,2>{0.395335078f, 0.832541168f},
-std::array<float,2>{0.994033575f, 0.409863383f},
-std::array<float,2>{0.521239042f, 0.586803794f},
-std::array<float,2>{0.0157108959f, 0.00994952116f},
-std::array<float,2>{0.481935024f, 0.686570168f},
-std::array<float,2>{0.916764975f, 0.125596866f},
-std::array<float,2>{0.587484121f, 0.946643829f},
-std::array<float,2>{0.0702820271f, 0.331081837f},
-std::array<float,2>{0.241123363f, 0.774636865f},
-std::array<float,2>{0.65824163f, 0.446161985f},
-std::array<float,2>{0.83587271f, 0.55553472f},
-std::array<float,2>{0.323139489f, 0.0902617425f},
-std::array<float,2>{0.048253864f, 0.595149219f},
-std::array<float,2>{0.554399729f, 0.0598746389f},
-std::array<float,2>{0.947947025f, 0.859189749f},
-std::array<float,2>{0.417115211f, 0.388599664f},
-std::array<float,2>{0.301001549f, 0.875219405f},
-std::array<float,2>{0.753560185f, 0.253019154f},
-std::array<float,2>{0.726896763f, 0.741340101f},
-std::array<float,2>{0.173159957f, 0.216960713f},
-std::array<float,2>{0.44089067f, 0.548791945f},
-std::array<float,2>{0.885536611f, 0.0831677839f},
-std::array<float,2>{0.617706835f, 0.773081005f},
-std::array<float,2>{0.110951774f, 0.44036907f},
-std::array<float,2>{0.216450542f, 0.944740951f},
-std::array<float,2>{0.629021823f, 0.338300794f},
-std::array<float,2>{0.873251438f, 0.678195953f},
-std::array<float,2>{0.356594741f, 0.135347024f},
-std::array<float,2>{0.028489504f, 0.748975813f},
-std::array<float,2>{0.524427116f, 0.204683229f},
-std::array<float,2>{0.990946531f, 0.884245276f},
-std::array<float,2>{0.40181917f, 0.264190793f},
-std::array<float,2>{0.276560724f, 0.84382689f},
-std::array<float,2>{0.781618297f, 0.378189772f},
-std::array<float,2>{0.710833013f, 0.608478546f},
-std::array<float,2>{0.135619313f, 0.046936322f},
-std::array<float,2>{0.31670326f, 0.650921106f},
-std::array<float,2>{0.837162673f, 0.162637293f},
-std::array<float,2>{0.671481073f, 0.987043321f},
-std::array<float,2>{0.242720082f, 0.373514533f},
-std::array<float,2>{0.0717887357f, 0.795704424f},
-std::array<float,2>{0.583326399f, 0.486170471f},
-std::array<float,2>{0.908304214f, 0.525292993f},
-std::array<float,2>{0.476045012f, 0.100998282f},
-std::array<float,2>{0.183950543f, 0.581528544f},
-std::array<float,2>{0.721242845f, 0.00621754769f},
-std::array<float,2>{0.75836575f, 0.838167012f},
-std::array<float,2>{0.309292078f, 0.414958715f},
-std::array<float,2>{0.412349105f, 0.933872461f},
-std::array<float,2>{0.944892526f, 0.303986788f},
-std::array<float,2>{0.556494713f, 0.698537588f},
-std::array<float,2>{0.0574742928f, 0.239215687f},
-std::array<float,2>{0.284525692f, 0.61829704f},
-std::array<float,2>{0.779902875f, 0.0425510108f},
-std::array<float,2>{0.74301511f, 0.864434779f},
-std::array<float,2>{0.157614022f, 0.392412812f},
-std::array<float,2>{0.045156382f, 0.891950488f},
-std::array<float,2>{0.5422647f, 0.278958946f},
-std::array<float,2>{0.966002882f, 0.733724713f},
-std::array<float,2>{0.423796505f, 0.197128147f},
-std::array<float,2>{0.228460476f, 0.662578583f},
-std::array<float,2>{0.682409048f, 0.143129125f},
-std::array<float,2>{0.81682086f, 0.967560172f},
-std::array<float,2>{0.340598702f, 0.325410455f},
-std::array<float,2>{0.486109287f, 0.759158909f},
-std::array<float,2>{0.928576767f, 0.46094346f},
-std::array<float,2>{0.568141758f, 0.53288883f},
-std::array<float,2>{0.0851626322f, 0.0717444718f},
-std::array<float,2>{0.381535202f, 0.714602828f},
-std::array<float,2>{0.972170472f, 0.231998593f},
-std::array<float,2>{0.504475713f, 0.908884048f},
-std::array<float,2>{0.00743258651f, 0.289875478f},
-std::array<float,2>{0.143060446f, 0.825363636f},
-std::array<float,2>{0.69965595f, 0.432719171f},
-std::array<float,2>{0.803634942f, 0.565688074f},
-std::array<float,2>{0.251812816f, 0.0231088754f},
-std::array<float,2>{0.0971505567f, 0.512979805f},
-std::array<float,2>{0.596132815f, 0.112256333f},
-std::array<float,2>{0.894564629f, 0.803861499f},
-std::array<float,2>{0.463540196f, 0.48128733f},
-std::array<float,2>{0.362668186f, 0.979364872f},
-std::array<float,2>{0.848897815f, 0.348448724f},
-std::array<float,2>{0.652000666f, 0.637419045f},
-std::array<float,2>{0.196308687f, 0.18740204f},
-std::array<float,2>{0.403511137f, 0.503106654f},
-std::array<float,2>{0.9847278f, 0.119129784f},
-std::array<float,2>{0.528145313f, 0.811528623f},
-std::array<float,2>{0.0264814571f, 0.471842676f},
-std::array<float,2>{0.13763541f, 0.974912941f},
-std::array<float,2>{0.706915021f, 0.358065784f},
-std::array<float,2>{0.788469553f, 0.625827491f},
-std::array<float,2>{0.278256238f, 0.173141956f},
-std::array<float,2>{0.115524456f, 0.706463218f},
-std::array<float,2>{0.623276234f, 0.222455561f},
-std::array<float,2>{0.88921237f, 0.918003142f},
-std::array<float,2>{0.442233682f, 0.287281871f},
-std::array<float,2>{0.354105949f, 0.813297927f},
-std::array<float,2>{0.867673814f, 0.423424095f},
-std::array<float,2>{0.627710938f, 0.577862144f},
-std::array<float,2>{0.212911978f, 0.0263783559f},
-std::array<float,2>{0.307108521f, 0.671565175f},
-std::array<float,2>{0.765176833f, 0.148699582f},
-std::array<float,2>{0.725104451f, 0.956201971f},
-std::array<float,2>{0.179873124f, 0.312649667f},
-std::array<float,2>{0.0617019758f, 0.75506717f},
-std::array<float,2>{0.561615586f, 0.455841094f},
-std::array<float,2>{0.937522173f, 0.544448555f},
-std::array<float,2>{0.409280241f, 0.0688852072f},
-std::array<float,2>{0.248243734f, 0.609436333f},
-std::array<float,2>{0.667288303f, 0.0379906967f},
-std::array<float,2>{0.84000957f, 0.867643714f},
-std::array<float,2>{0.315086782f, 0.401717216f},
-std::array<float,2>{0.470911652f, 0.90542376f},
-std::array<float,2>{0.911956012f, 0.269384712f},
-std::array<float,2>{0.579570413f, 0.719111204f},
-std::array<float,2>{0.0761061013f, 0.193545133f},
-std::array<float,2>{0.339408427f, 0.590658009f},
-std::array<float,2>{0.815345943f, 0.0127221467f},
-std::array<float,2>{0.685047686f, 0.831460893f},
-std::array<float,2>{0.233334124f, 0.411717147f},
-std::array<float,2>{0.0808738768f, 0.926453292f},
-std::array<float,2>{0.563274443f, 0.305267751f},
-std::array<float,2>{0.922798395f, 0.692646146f},
-std::array<float,2>{0.492096901f, 0.249813914f},
-std::array<float,2>{0.162359655f, 0.644295633f},
-std::array<float,2>{0.74621141f, 0.169458508f},
-std::array<float,2>{0.775645018f, 0.992865324f},
-std::array<float,2>{0.285465926f, 0.364865005f},
-std::array<float,2>{0.427785039f, 0.787943423f},
-std::array<float,2>{0.962034941f, 0.494698316f},
-std::array<float,2>{0.543538451f, 0.516575277f},
-std::array<float,2>{0.0393177308f, 0.108631589f},
-std::array<float,2>{0.46522367f, 0.73440063f},
-std::array<float,2>{0.891647041f, 0.211490527f},
-std::array<float,2>{0.601277411f, 0.879812956f},
-std::array<float,2>{0.101531036f, 0.255596846f},
-std::array<float,2>{0.201413423f, 0.85298562f},
-std::array<float,2>{0.655504704f, 0.383574873f},
-std::array<float,2>{0.84663415f, 0.60103482f},
-std::array<float,2>{0.364272952f, 0.0571192317f},
-std::array<float,2>{0.00186831027f, 0.559425354f},
-std::array<float,2>{0.503481865f, 0.0897084698f},
-std::array<float,2>{0.972910762f, 0.780626237f},
-std::array<float,2>{0.375766337f, 0.44983086f},
-std::array<float,2>{0.257603973f, 0.952068448f},
-std::array<float,2>{0.799385428f, 0.333648592f},
-std::array<float,2>{0.698733211f, 0.681323767f},
-std::array<float,2>{0.14667581f, 0.132070988f},
-std::array<float,2>{0.495221138f, 0.602405071f},
-std::array<float,2>{0.933615923f, 0.0543406047f},
-std::array<float,2>{0.571059883f, 0.849565089f},
-std::array<float,2>{0.0905754492f, 0.379852206f},
-std::array<float,2>{0.221067399f, 0.888446331f},
-std::array<float,2>{0.676695168f, 0.261384487f},
-std::array<float,2>{0.822591245f, 0.74310708f},
-std::array<float,2>{0.331878155f, 0.207375199f},
-std::array<float,2>{0.03837841f, 0.672540665f},
-std::array<float,2>{0.535191059f, 0.139551282f},
-std::array<float,2>{0.956325412f, 0.938776553f},
-std::array<float,2>{0.434321821f, 0.341949224f},
-std::array<float,2>{0.289650023f, 0.768771589f},
-std::array<float,2>{0.767570972f, 0.444062799f},
-std::array<float,2>{0.734877765f, 0.551760137f},
-std::array<float,2>{0.166535869f, 0.0816843137f},
-std::array<float,2>{0.372464597f, 0.702687383f},
-std::array<float,2>{0.852725327f, 0.237923309f},
-std::array<float,2>{0.645822287f, 0.931967735f},
-std::array<float,2>{0.194052503f, 0.299171984f},
-std::array<float,2>{0.105251484f, 0.841817617f},
-std::array<float,2>{0.607132316f, 0.419530123f},
-std::array<float,2>{0.899559498f, 0.584743559f},
-std::array<float,2>{0.454683006f, 0.00374059426f},
-std::array<float,2>{0.155692101f, 0.528312922f},
-std::array<float,2>{0.691731274f, 0.0964744464f},
-std::array<float,2>{0.806447148f, 0.791315138f},
-std::array<float,2>{0.265207887f, 0.491910666f},
-std::array<float,2>{0.389692724f, 0.989709735f},
-std::array<float,2>{0.977891743f, 0.367537111f},
-std::array<float,2>{0.510093391f, 0.65458101f},
-std::array<float,2>{0.00970648043f, 0.159528136f},
-std::array<float,2>{0.267788857f, 0.536076128f},
-std::array<float,2>{0.79032129f, 0.0764163211f},
-std::array<float,2>{0.714960933f, 0.764861226f},
-std::array<float,2>{0.126342669f, 0.466742307f},
-std::array<float,2>{0.0210341606f, 0.961565435f},
-std::array<float,2>{0.517990112f, 0.322959095f},
-std::array<float,2>{0.996301293f, 0.65912205f},
-std::array<float,2>{0.392262697f, 0.14817819f},
-std::array<float,2>{0.208006918f, 0.727304578f},
-std::array<float,2>{0.637449622f, 0.201941535f},
-std::array<float,2>{0.864306986f, 0.897864759f},
-std::array<float,2>{0.344470888f, 0.275652111f},
-std::array<float,2>{0.449730784f, 0.860079288f},
-std::array<float,2>{0.879687965f, 0.394588619f},
-std::array<float,2>{0.61213845f, 0.623546779f},
-std::array<float,2>{0.120986305f, 0.0443170741f},
-std::array<float,2>{0.419405937f, 0.635302961f},
-std::array<float,2>{0.950018525f, 0.182504237f},
-std::array<float,2>{0.550095618f, 0.98186928f},
-std::array<float,2>{0.0525338389f, 0.347631931f},
-std::array<float,2>{0.176497057f, 0.799025059f},
-std::array<float,2>{0.731085181f, 0.477359176f},
-std::array<float,2>{0.75628674f, 0.508892179f},
-std::array<float,2>{0.29981786f, 0.115069486f},
-std::array<float,2>{0.0638872907f, 0.567062974f},
-std::array<float,2>{0.590189338f, 0.0188111756f},
-std::array<float,2>{0.918728113f, 0.821143568f},
-std::array<float,2>{0.476943821f, 0.436960518f},
-std::array<float,2>{0.327354401f, 0.912224174f},
-std::array<float,2>{0.830211163f, 0.296726376f},
-std::array<float,2>{0.66319716f, 0.718449295f},
-std::array<float,2>{0.236465916f, 0.228080451f},
-std::array<float,2>{0.398339599f, 0.586949766f},
-std::array<float,2>{0.995687604f, 0.0113433367f},
-std::array<float,2>{0.52194792f, 0.833298206f},
-std::array<float,2>{0.0192378461f, 0.408408642f},
-std::array<float,2>{0.132135287f, 0.925115645f},
-std::array<float,2>{0.713798285f, 0.311650097f},
-std::array<float,2>{0.794659853f, 0.688254535f},
-std::array<float,2>{0.272601992f, 0.245027155f},
-std::array<float,2>{0.124785803f, 0.645120561f},
-std::array<float,2>{0.617077649f, 0.165241271f},
-std::array<float,2>{0.875383317f, 0.997997284f},
-std::array<float,2>{0.446279377f, 0.359506011f},
-std::array<float,2>{0.348885566f, 0.781339705f},
-std::array<float,2>{0.862944424f, 0.499098778f},
-std::array<float,2>{0.633274674f, 0.522205949f},
-std::array<float,2>{0.203219235f, 0.10410478f},
-std::array<float,2>{0.303869843f, 0.741030872f},
-std::array<float,2>{0.750244915f, 0.218488187f},
-std::array<float,2>{0.729285479f, 0.876248538f},
-std::array<float,2>{0.174877852f, 0.252114594f},
-std::array<float,2>{0.0505057499f, 0.858043492f},
-std::array<float,2>{0.551718414f, 0.387344211f},
-std::array<float,2>{0.946021318f, 0.593943417f},
-std::array<float,2>{0.414070249f, 0.0591920912f},
-std::array<float,2>{0.239014357f, 0.556423843f},
-std::array<float,2>{0.658095598f, 0.0910756961f},
-std::array<float,2>{0.833577275f, 0.773788571f},
-std::array<float,2>{0.321882546f, 0.44650507f},
-std::array<float,2>{0.482793987f, 0.945327401f},
-std::array<float,2>{0.915066659f, 0.33046031f},
-std::array<float,2>{0.589473486f, 0.685884535f},
-std::array<float,2>{0.0678954795f, 0.126841366f},
-std::array<float,2>{0.334621817f, 0.507445216f},
-std::array<float,2>{0.826229453f, 0.123407729f},
-std::array<float,2>{0.675518811f, 0.807738006f},
-std::array<float,2>{0.223557413f, 0.474640071f},
-std::array<float,2>{0.0863171965f, 0.970639646f},
-std::array<float,2>{0.577305019f, 0.353722125f},
-std::array<float,2>{0.932823539f, 0.630167902f},
-std::array<float,2>{0.497698009f, 0.179379165f},
-std::array<float,2>{0.169839844f, 0.707450032f},
-std::array<float,2>{0.738570094f, 0.224134967f},
-std::array<float,2>{0.771864951f, 0.917321444f},
-std::array<float,2>{0.293997914f, 0.28157112f},
-std::array<float,2>{0.430464029f, 0.817704558f},
-std::array<float,2>{0.957681477f, 0.428949773f},
-std::array<float,2>{0.531955063f, 0.573395789f},
-std::array<float,2>{0.0342871845f, 0.0294061322f},
-std::array<float,2>{0.460155517f, 0.667590916f},
-std::array<float,2>{0.905352473f, 0.155960605f},
-std::array<float,2>{0.604840815f, 0.95828867f},
-std::array<float,2>{0.10915257f, 0.318008304f},
-std::array<float,2>{0.188239962f, 0.751344919f},
-std::array<float,2>{0.640937686f, 0.459427416f},
-std::array<float,2>{0.857248604f, 0.539919138f},
-std::array<float,2>{0.370549083f, 0.0650995746f},
-std::array<float,2>{0.0117719546f, 0.61541754f},
-std::array<float,2>{0.512491107f, 0.0332112312f},
-std::array<float,2>{0.982266247f, 0.872619927f},
-std::array<float,2>{0.386608303f, 0.402346194f},
-std::array<float,2>{0.26045391f, 0.899283886f},
-std::array<float,2>{0.809543312f, 0.270860612f},
-std::array<float,2>{0.690402091f, 0.724155486f},
-std::array<float,2>{0.150971249f, 0.188738555f},
-std::array<float,2>{0.486401767f, 0.531579792f},
-std::array<float,2>{0.927423179f, 0.0703393519f},
-std::array<float,2>{0.570082307f, 0.758294284f},
-std::array<float,2>{0.0822395161f, 0.462066829f},
-std::array<float,2>{0.229795977f, 0.968255699f},
-std::array<float,2>{0.681276679f, 0.325187027f},
-std::array<float,2>{0.819904804f, 0.663597345f},
-std::array<float,2>{0.341834307f, 0.14394182f},
-std::array<float,2>{0.0436235853f, 0.732920825f},
-std::array<float,2>{0.53959769f, 0.1956864f},
-std::array<float,2>{0.967596054f, 0.890973568f},
-std::array<float,2>{0.425550044f, 0.278312236f},
-std::array<float,2>{0.281723559f, 0.863748968f},
-std::array<float,2>{0.778790712f, 0.39159143f},
-std::array<float,2>{0.744811058f, 0.61790061f},
-std::array<float,2>{0.159193754f, 0.0413517579f},
-std::array<float,2>{0.360156298f, 0.638176084f},
-std::array<float,2>{0.851036191f, 0.185584322f},
-std::array<float,2>{0.650040865f, 0.979754865f},
-std::array<float,2>{0.198615998f, 0.349372f},
-std::array<float,2>{0.0943684056f, 0.803223073f},
-std::array<float,2>{0.59502095f, 0.482393026f},
-std::array<float,2>{0.897726834f, 0.512310863f},
-std::array<float,2>{0.462429881f, 0.112316944f},
-std::array<float,2>{0.141110599f, 0.564556539f},
-std::array<float,2>{0.702408612f, 0.0218941178f},
-std::array<float,2>{0.802200496f, 0.825080037f},
-std::array<float,2>{0.253190696f, 0.431832641f},
-std::array<float,2>{0.37913242f, 0.909271777f},
-std::array<float,2>{0.970059156f, 0.290631384f},
-std::array<float,2>{0.506745696f, 0.713165879f},
-std::array<float,2>{0.00494009815f, 0.231405795f},
-std::array<float,2>{0.273580223f, 0.607560277f},
-std::array<float,2>{0.783434331f, 0.0478936173f},
-std::array<float,2>{0.708711863f, 0.845384419f},
-std::array<float,2>{0.133645445f, 0.377731323f},
-std::array<float,2>{0.030306261f, 0.883203447f},
-std::array<float,2>{0.526101768f, 0.265455097f},
-std::array<float,2>{0.988370299f, 0.749424517f},
-std::array<float,2>{0.399690658f, 0.203791395f},
-std::array<float,2>{0.218373075f, 0.679578185f},
-std::array<float,2>{0.631792665f, 0.13621448f},
-std::array<float,2>{0.871690691f, 0.944302261f},
-std::array<float,2>{0.357487351f, 0.339800715f},
-std::array<float,2>{0.438812673f, 0.772371709f},
-std::array<float,2>{0.883779645f, 0.441113412f},
-std::array<float,2>{0.619808674f, 0.546922743f},
-std::array<float,2>{0.113223292f, 0.0822610334f},
-std::array<float,2>{0.41117841f, 0.697325647f},
-std::array<float,2>{0.943086147f, 0.239349723f},
-std::array<float,2>{0.55735743f, 0.934586525f},
-std::array<float,2>{0.0554416627f, 0.30301407f},
-std::array<float,2>{0.185553744f, 0.839747787f},
-std::array<float,2>{0.719225824f, 0.415240645f},
-std::array<float,2>{0.760551333f, 0.580893159f},
-std::array<float,2>{0.312386423f, 0.00752957165f},
-std::array<float,2>{0.0738231242f, 0.523481309f},
-std::array<float,2>{0.585392952f, 0.0996559113f},
-std::array<float,2>{0.90643096f, 0.795977235f},
-std::array<float,2>{0.473542213f, 0.484821081f},
-std::array<float,2>{0.319275707f, 0.987309515f},
-std::array<float,2>{0.839660168f, 0.374622345f},
-std::array<float,2>{0.668033838f, 0.651374161f},
-std::array<float,2>{0.245953307f, 0.16375789f},
-std::array<float,2>{0.426458597f, 0.517187297f},
-std::array<float,2>{0.963146925f, 0.107915826f},
-std::array<float,2>{0.546612501f, 0.788901806f},
-std::array<float,2>{0.0413119569f, 0.495214999f},
-std::array<float,2>{0.160458684f, 0.994073033f},
-std::array<float,2>{0.749663293f, 0.363452703f},
-std::array<float,2>{0.775320768f, 0.642650962f},
-std::array<float,2>{0.288406312f, 0.168542415f},
-std::array<float,2>{0.0798934177f, 0.692052066f},
-std::array<float,2>{0.565779924f, 0.248224452f},
-std::array<float,2>{0.924033523f, 0.926947057f},
-std::array<float,2>{0.489370495f, 0.306268752f},
-std::array<float,2>{0.336138934f, 0.830894351f},
-std::array<float,2>{0.813058913f, 0.410842955f},
-std::array<float,2>{0.685976207f, 0.591156483f},
-std::array<float,2>{0.231499135f, 0.0120788077f},
-std::array<float,2>{0.255359322f, 0.67991209f},
-std::array<float,2>{0.79783392f, 0.131716862f},
-std::array<float,2>{0.696448505f, 0.95231396f},
-std::array<float,2>{0.144783437f, 0.332705736f},
-std::array<float,2>{0.00198832946f, 0.780096412f},
-std::array<float,2>{0.501465559f, 0.450383037f},
-std::array<float,2>{0.9758811f, 0.559727728f},
-std::array<float,2>{0.378504872f, 0.0887892693f},
-std::array<float,2>{0.199750692f, 0.600166202f},
-std::array<float,2>{0.653384209f, 0.0577422902f},
-std::array<float,2>{0.844368041f, 0.851826251f},
-std::array<float,2>{0.365428895f, 0.384451598f},
-std::array<float,2>{0.468664378f, 0.880145669f},
-std::array<float,2>{0.89439708f, 0.254225463f},
-std::array<float,2>{0.598483622f, 0.735393047f},
-std::array<float,2>{0.0986760855f, 0.212046757f},
-std::array<float,2>{0.352648675f, 0.577006102f},
-std::array<float,2>{0.870994389f, 0.0259342268f},
-std::array<float,2>{0.625867307f, 0.814432621f},
-std::array<float,2>{0.212631598f, 0.422610015f},
-std::array<float,2>{0.113647595f, 0.919371963f},
-std::array<float,2>{0.62286526f, 0.288595289f},
-std::array<float,2>{0.888409853f, 0.705104113f},
-std::array<float,2>{0.444532484f, 0.220894471f},
-std::array<float,2>{0.140408218f, 0.626068175f},
-std::array<float,2>{0.704127133f, 0.172167704f},
-std::array<float,2>{0.786746621f, 0.976294875f},
-std::array<float,2>{0.280037135f, 0.358729661f},
-std::array<float,2>{0.405129582f, 0.81124568f},
-std::array<float,2>{0.98790735f, 0.471252769f},
-std::array<float,2>{0.530144215f, 0.502328694f},
-std::array<float,2>{0.0241671298f, 0.117736019f},
-std::array<float,2>{0.469026953f, 0.720391035f},
-std::array<float,2>{0.91288054f, 0.194960326f},
-std::array<float,2>{0.580815077f, 0.904490352f},
-std::array<float,2>{0.0777139515f, 0.268034011f},
-std::array<float,2>{0.246151716f, 0.868627131f},
-std::array<float,2>{0.664658189f, 0.401026905f},
-std::array<float,2>{0.842798054f, 0.610462964f},
-std::array<float,2>{0.313702404f, 0.0389889516f},
-std::array<float,2>{0.0605432466f, 0.543030381f},
-std::array<float,2>{0.559675276f, 0.0701281503f},
-std::array<float,2>{0.94101572f, 0.754155815f},
-std::array<float,2>{0.407493323f, 0.456727684f},
-std::array<float,2>{0.306627899f, 0.955735803f},
-std::array<float,2>{0.762523472f, 0.314106613f},
-std::array<float,2>{0.723920584f, 0.67064929f},
-std::array<float,2>{0.182720065f, 0.149711028f},
-std::array<float,2>{0.452993244f, 0.624027669f},
-std::array<float,2>{0.881274343f, 0.0432350673f},
-std::array<float,2>{0.609907269f, 0.860565543f},
-std::array<float,2>{0.118474372f, 0.395978987f},
-std::array<float,2>{0.209699184f, 0.896688104f},
-std::array<float,2>{0.640564263f, 0.276434839f},
-std::array<float,2>{0.867181659f, 0.728065968f},
-std::array<float,2>{0.346545368f, 0.202235922f},
-std::array<float,2>{0.0217257347f, 0.659862518f},
-std::array<float,2>{0.516191006f, 0.146929502f},
-std::array<float,2>{0.998971522f, 0.962267041f},
-std::array<float,2>{0.394409835f, 0.323949695f},
-std::array<float,2>{0.266287655f, 0.763725638f},
-std::array<float,2>{0.792833447f, 0.465534806f},
-std::array<float,2>{0.718692005f, 0.536968172f},
-std::array<float,2>{0.127903387f, 0.0780516565f},
-std::array<float,2>{0.325169444f, 0.716825485f},
-std::array<float,2>{0.828230202f, 0.226936802f},
-std::array<float,2>{0.660688519f, 0.913640976f},
-std::array<float,2>{0.234378159f, 0.295507729f},
-std::array<float,2>{0.0659405366f, 0.822237134f},
-std::array<float,2>{0.592339933f, 0.436505616f},
-std::array<float,2>{0.921289682f, 0.567922473f},
-std::array<float,2>{0.479207128f, 0.0184319019f},
-std::array<float,2>{0.178662553f, 0.508607686f},
-std::array<float,2>{0.73294872f, 0.114177912f},
-std::array<float,2>{0.754299581f, 0.800531328f},
-std::array<float,2>{0.298137546f, 0.477694869f},
-std::array<float,2>{0.420809567f, 0.981353819f},
-std::array<float,2>{0.951804817f, 0.345739186f},
-std::array<float,2>{0.547503293f, 0.636534274f},
-std::array<float,2>{0.0531050935f, 0.183330253f},
-std::array<float,2>{0.292674541f, 0.550985575f},
-std::array<float,2>{0.769492209f, 0.0808187947f},
-std::array<float,2>{0.736622572f, 0.76807332f},
-std::array<float,2>{0.164210469f, 0.444695204f},
-std::array<float,2>{0.0370576419f, 0.938202679f},
-std::array<float,2>{0.53791368f, 0.343485177f},
-std::array<float,2>{0.95325613f, 0.673007369f},
-std::array<float,2>{0.436567396f, 0.140356615f},
-std::array<float,2>{0.218797758f, 0.743454874f},
-std::array<float,2>{0.678657949f, 0.208829924f},
-std::array<float,2>{0.820804894f, 0.887672126f},
-std::array<float,2>{0.329918414f, 0.260442644f},
-std::array<float,2>{0.493889302f, 0.848581791f},
-std::array<float,2>{0.937330604f, 0.380196124f},
-std::array<float,2>{0.572901309f, 0.603304982f},
-std::array<float,2>{0.0925147086f, 0.0533591546f},
-std::array<float,2>{0.387285322f, 0.655981183f},
-std::array<float,2>{0.978948474f, 0.158332929f},
-std::array<float,2>{0.509144545f, 0.988640487f},
-std::array<float,2>{0.0116772242f, 0.369081855f},
-std::array<float,2>{0.154064491f, 0.792683542f},
-std::array<float,2>{0.695052624f, 0.49107796f},
-std::array<float,2>{0.80774647f, 0.529239058f},
-std::array<float,2>{0.263538927f, 0.0973825008f},
-std::array<float,2>{0.101966158f, 0.585450768f},
-std::array<float,2>{0.607667983f, 0.00291778217f},
-std::array<float,2>{0.902149439f, 0.842968822f},
-std::array<float,2>{0.455254316f, 0.418519527f},
-std::array<float,2>{0.374582857f, 0.933179557f},
-std::array<float,2>{0.854561269f, 0.300605237f},
-std::array<float,2>{0.647846818f, 0.701506019f},
-std::array<float,2>{0.192636654f, 0.236872882f},
-std::array<float,2>{0.416988671f, 0.59651804f},
-std::array<float,2>{0.948787391f, 0.0624673143f},
-std::array<float,2>{0.55362761f, 0.856195271f},
-std::array<float,2>{0.0476555414f, 0.390512556f},
-std::array<float,2>{0.172343954f, 0.877813399f},
-std::array<float,2>{0.728438616f, 0.251267135f},
-std::array<float,2>{0.752070546f, 0.740122616f},
-std::array<float,2>{0.302125186f, 0.216286987f},
-std::array<float,2>{0.0693149567f, 0.683672488f},
-std::array<float,2>{0.586116612f, 0.127883688f},
-std::array<float,2>{0.917916358f, 0.948485494f},
-std::array<float,2>{0.480744064f, 0.328626007f},
-std::array<float,2>{0.324045509f, 0.777182579f},
-std::array<float,2>{0.834549844f, 0.448181778f},
-std::array<float,2>{0.659787178f, 0.557640135f},
-std::array<float,2>{0.241390154f, 0.0936433673f},
-std::array<float,2>{0.270037323f, 0.690805852f},
-std::array<float,2>{0.795881033f, 0.2425403f},
-std::array<float,2>{0.712348223f, 0.922799826f},
-std::array<float,2>{0.130840749f, 0.309986174f},
-std::array<float,2>{0.0173884314f, 0.834219337f},
-std::array<float,2>{0.519708574f, 0.406404287f},
-std::array<float,2>{0.992190361f, 0.589534402f},
-std::array<float,2>{0.395732969f, 0.00818908773f},
-std::array<float,2>{0.205219299f, 0.520431101f},
-std::array<float,2>{0.635744452f, 0.103233762f},
-std::array<float,2>{0.861137331f, 0.784097373f},
-std::array<float,2>{0.351356f, 0.497219175f},
-std::array<float,2>{0.448105931f, 0.999640167f},
-std::array<float,2>{0.878662944f, 0.362496734f},
-std::array<float,2>{0.614387572f, 0.647978008f},
-std::array<float,2>{0.121904798f, 0.167869285f},
-std::array<float,2>{0.368401378f, 0.541413069f},
-std::array<float,2>{0.857495487f, 0.0632462129f},
-std::array<float,2>{0.642694354f, 0.753163218f},
-std::array<float,2>{0.190012768f, 0.45758158f},
-std::array<float,2>{0.105977088f, 0.959457517f},
-std::array<float,2>{0.601853311f, 0.318466067f},
-std::array<float,2>{0.903151333f, 0.664260924f},
-std::array<float,2>{0.457313389f, 0.153605729f},
-std::array<float,2>{0.149358541f, 0.725953043f},
-std::array<float,2>{0.68904078f, 0.189879924f},
-std::array<float,2>{0.811131299f, 0.902159691f},
-std::array<float,2>{0.258809984f, 0.271679103f},
-std::array<float,2>{0.384720623f, 0.874122798f},
-std::array<float,2>{0.983311355f, 0.404431313f},
-std::array<float,2>{0.515484333f, 0.614921689f},
-std::array<float,2>{0.0137877651f, 0.0327319577f},
-std::array<float,2>{0.498566687f, 0.631788194f},
-std::array<float,2>{0.93144691f, 0.17628099f},
-std::array<float,2>{0.574901581f, 0.971380353f},
-std::array<float,2>{0.0886653587f, 0.351908624f},
-std::array<float,2>{0.224687919f, 0.805033624f},
-std::array<float,2>{0.672895253f, 0.474030763f},
-std::array<float,2>{0.824517965f, 0.503994346f},
-std::array<float,2>{0.333533734f, 0.122214556f},
-std::array<float,2>{0.0321869887f, 0.571391761f},
-std::array<float,2>{0.533462763f, 0.0286533199f},
-std::array<float,2>{0.959120452f, 0.820308447f},
-std::array<float,2>{0.432595521f, 0.42608586f},
-std::array<float,2>{0.296502531f, 0.914902091f},
-std::array<float,2>{0.769999087f, 0.284348488f},
-std::array<float,2>{0.740577042f, 0.709546149f},
-std::array<float,2>{0.170939058f, 0.226073235f},
-std::array<float,2>{0.464327157f, 0.515407741f},
-std::array<float,2>{0.895641387f, 0.10989888f},
-std::array<float,2>{0.597104609f, 0.802008271f},
-std::array<float,2>{0.0959508568f, 0.484366864f},
-std::array<float,2>{0.196234748f, 0.978113472f},
-std::array<float,2>{0.650768578f, 0.350813419f},
-std::array<float,2>{0.848205149f, 0.639243066f},
-std::array<float,2>{0.362053871f, 0.184080854f},
-std::array<float,2>{0.00598346209f, 0.711207032f},
-std::array<float,2>{0.505087316f, 0.233306393f},
-std::array<float,2>{0.971086681f, 0.90780741f},
-std::array<float,2>{0.382078618f, 0.292860419f},
-std::array<float,2>{0.250699639f, 0.827792287f},
-std::array<float,2>{0.804329574f, 0.431269079f},
-std::array<float,2>{0.701009274f, 0.563182652f},
-std::array<float,2>{0.143747956f, 0.0205266085f},
-std::array<float,2>{0.341330707f, 0.660446763f},
-std::array<float,2>{0.818199635f, 0.142194375f},
-std::array<float,2>{0.683057487f, 0.966692209f},
-std::array<float,2>{0.226946041f, 0.326282024f},
-std::array<float,2>{0.0847323686f, 0.761143982f},
-std::array<float,2>{0.567175448f, 0.463269114f},
-std::array<float,2>{0.929561257f, 0.534101307f},
-std::array<float,2>{0.484743029f, 0.0733367726f},
-std::array<float,2>{0.156996891f, 0.619669974f},
-std::array<float,2>{0.743266165f, 0.039720051f},
-std::array<float,2>{0.78097415f, 0.866746485f},
-std::array<float,2>{0.283229351f, 0.393978119f},
-std::array<float,2>{0.422800511f, 0.892771482f},
-std::array<float,2>{0.965460181f, 0.280095518f},
-std::array<float,2>{0.541638076f, 0.731465101f},
-std::array<float,2>{0.0459046178f, 0.198873207f},
-std::array<float,2>{0.309738308f, 0.579190791f},
-std::array<float,2>{0.759092331f, 0.00504416553f},
-std::array<float,2>{0.721864164f, 0.837336183f},
-std::array<float,2>{0.184630066f, 0.416506231f},
-std::array<float,2>{0.0579102375f, 0.936961353f},
-std::array<float,2>{0.555289507f, 0.301949888f},
-std::array<float,2>{0.943446219f, 0.696861506f},
-std::array<float,2>{0.413606495f, 0.241930246f},
-std::array<float,2>{0.243447915f, 0.650048673f},
-std::array<float,2>{0.670520127f, 0.162031084f},
-std::array<float,2>{0.836378038f, 0.986326218f},
-std::array<float,2>{0.318091094f, 0.371968001f},
-std::array<float,2>{0.474947244f, 0.794054508f},
-std::array<float,2>{0.909559667f, 0.487896144f},
-std::array<float,2>{0.58298713f, 0.525550663f},
-std::array<float,2>{0.0708655566f, 0.0976960436f},
-std::array<float,2>{0.40042609f, 0.747460186f},
-std::array<float,2>{0.991957724f, 0.205933005f},
-std::array<float,2>{0.524154544f, 0.885215521f},
-std::array<float,2>{0.027514575f, 0.263527215f},
-std::array<float,2>{0.136148915f, 0.846135676f},
-std::array<float,2>{0.709837198f, 0.376763165f},
-std::array<float,2>{0.78228724f, 0.606306434f},
-std::array<float,2>{0.275456399f, 0.0495802835f},
-std::array<float,2>{0.109420836f, 0.549064994f},
-std::array<float,2>{0.618204951f, 0.0855954885f},
-std::array<float,2>{0.885823786f, 0.770314872f},
-std::array<float,2>{0.439774752f, 0.438997298f},
-std::array<float,2>{0.356065929f, 0.942680597f},
-std::array<float,2>{0.874876797f, 0.337245822f},
-std::array<float,2>{0.630496085f, 0.675803602f},
-std::array<float,2>{0.215776339f, 0.133199736f},
-std::array<float,2>{0.376535743f, 0.561963558f},
-std::array<float,2>{0.973896444f, 0.086861752f},
-std::array<float,2>{0.502162755f, 0.777706802f},
-std::array<float,2>{0.000898735248f, 0.451218307f},
-std::array<float,2>{0.148216248f, 0.94926846f},
-std::array<float,2>{0.697456479f, 0.335057408f},
-std::array<float,2>{0.800709963f, 0.68239826f},
-std::array<float,2>{0.256605238f, 0.12926361f},
-std::array<float,2>{0.100539058f, 0.736507833f},
-std::array<float,2>{0.60032475f, 0.212938234f},
-std::array<float,2>{0.890740395f, 0.881945074f},
-std::array<float,2>{0.466382205f, 0.257663786f},
-std::array<float,2>{0.36398378f, 0.854836285f},
-std::array<float,2>{0.846824944f, 0.386604339f},
-std::array<float,2>{0.655258179f, 0.598699152f},
-std::array<float,2>{0.202719405f, 0.0559200272f},
-std::array<float,2>{0.286811322f, 0.642439902f},
-std::array<float,2>{0.776827157f, 0.171357408f},
-std::array<float,2>{0.747665346f, 0.99589026f},
-std::array<float,2>{0.163784936f, 0.36599806f},
-std::array<float,2>{0.0406271592f, 0.786690891f},
-std::array<float,2>{0.544514418f, 0.492622733f},
-std::array<float,2>{0.96105361f, 0.517810047f},
-std::array<float,2>{0.429600298f, 0.105489515f},
-std::array<float,2>{0.234366521f, 0.592601001f},
-std::array<float,2>{0.683917105f, 0.0144977598f},
-std::array<float,2>{0.815998912f, 0.829257548f},
-std::array<float,2>{0.338840842f, 0.412438244f},
-std::array<float,2>{0.490733087f, 0.929368198f},
-std::array<float,2>{0.923498333f, 0.308308989f},
-std::array<float,2>{0.564016521f, 0.694188833f},
-std::array<float,2>{0.0812112466f, 0.247320235f},
-std::array<float,2>{0.315921307f, 0.613149762f},
-std::array<float,2>{0.841190875f, 0.037036974f},
-std::array<float,2>{0.666165411f, 0.870337546f},
-std::array<float,2>{0.24994202f, 0.399676383f},
-std::array<float,2>{0.0744557083f, 0.902745664f},
-std::array<float,2>{0.578192413f, 0.266901225f},
-std::array<float,2>{0.910974085f, 0.721343696f},
-std::array<float,2>{0.472544312f, 0.191459537f},
-std::array<float,2>{0.181140542f, 0.669354677f},
-std::array<float,2>{0.726309121f, 0.151605189f},
-std::array<float,2>{0.764322877f, 0.954033852f},
-std::array<float,2>{0.307980955f, 0.316300362f},
-std::array<float,2>{0.4082219f, 0.755948484f},
-std::array<float,2>{0.938934743f, 0.454646617f},
-std::array<float,2>{0.560610771f, 0.546425819f},
-std::array<float,2>{0.0613369159f, 0.0681996197f},
-std::array<float,2>{0.442698121f, 0.70395118f},
-std::array<float,2>{0.890624642f, 0.219847351f},
-std::array<float,2>{0.624153435f, 0.9218207f},
-std::array<float,2>{0.116327502f, 0.285424829f},
-std::array<float,2>{0.214694023f, 0.816073537f},
-std::array<float,2>{0.62886554f, 0.424884528f},
-std::array<float,2>{0.8690539f, 0.574416637f},
-std::array<float,2>{0.355448157f, 0.0253282096f},
-std::array<float,2>{0.0255842619f, 0.500941098f},
-std::array<float,2>{0.529063165f, 0.120486036f},
-std::array<float,2>{0.986028552f, 0.808653474f},
-std::array<float,2>{0.402750403f, 0.469343871f},
-std::array<float,2>{0.278700829f, 0.973004162f},
-std::array<float,2>{0.787670255f, 0.356754333f},
-std::array<float,2>{0.705809772f, 0.628140509f},
-std::array<float,2>{0.138295233f, 0.175246313f},
-std::array<float,2>{0.478215307f, 0.568394065f},
-std::array<float,2>{0.919732094f, 0.0157225449f},
-std::array<float,2>{0.591465354f, 0.824132979f},
-std::array<float,2>{0.062776126f, 0.435252696f},
-std::array<float,2>{0.237669647f, 0.912023604f},
-std::array<float,2>{0.662666202f, 0.294558734f},
-std::array<float,2>{0.831726909f, 0.715382397f},
-std::array<float,2>{0.326644182f, 0.230092704f},
-std::array<float,2>{0.050833188f, 0.63365227f},
-std::array<float,2>{0.549696147f, 0.17970863f},
-std::array<float,2>{0.951108217f, 0.982511044f},
-std::array<float,2>{0.418634176f, 0.34398064f},
-std::array<float,2>{0.299731463f, 0.798360646f},
-std::array<float,2>{0.757349133f, 0.478665888f},
-std::array<float,2>{0.73203361f, 0.51165545f},
-std::array<float,2>{0.177306041f, 0.115681536f},
-std::array<float,2>{0.34539932f, 0.729784608f},
-std::array<float,2>{0.863563001f, 0.200290412f},
-std::array<float,2>{0.638257682f, 0.89565438f},
-std::array<float,2>{0.208117291f, 0.273781866f},
-std::array<float,2>{0.120087333f, 0.861446857f},
-std::array<float,2>{0.61276269f, 0.398394614f},
-std::array<float,2>{0.880383611f, 0.622283518f},
-std::array<float,2>{0.450748026f, 0.0462382212f},
-std::array<float,2>{0.125953883f, 0.538173616f},
-std::array<float,2>{0.716608465f, 0.0758267269f},
-std::array<float,2>{0.789836586f, 0.762250125f},
-std::array<float,2>{0.268947005f, 0.467953056f},
-std::array<float,2>{0.390807748f, 0.96441251f},
-std::array<float,2>{0.997744679f, 0.321537346f},
-std::array<float,2>{0.518666148f, 0.656478643f},
-std::array<float,2>{0.0200587809f, 0.146191418f},
-std::array<float,2>{0.264402479f, 0.530992448f},
-std::array<float,2>{0.80545634f, 0.0941842347f},
-std::array<float,2>{0.692597389f, 0.79074496f},
-std::array<float,2>{0.15524146f, 0.489702344f},
-std::array<float,2>{0.00801611692f, 0.990677297f},
-std::array<float,2>{0.511004865f, 0.370328069f},
-std::array<float,2>{0.977176309f, 0.653834224f},
-std::array<float,2>{0.389218837f, 0.156324998f},
-std::array<float,2>{0.194520041f, 0.700627923f},
-std::array<float,2>{0.645501196f, 0.234951735f},
-std::array<float,2>{0.852099299f, 0.930210173f},
-std::array<float,2>{0.371449947f, 0.297736168f},
-std::array<float,2>{0.45405665f, 0.840212822f},
-std::array<float,2>{0.898533762f, 0.420816749f},
-std::array<float,2>{0.60567838f, 0.583679378f},
-std::array<float,2>{0.104006171f, 0.000131544875f},
-std::array<float,2>{0.434600383f, 0.675267696f},
-std::array<float,2>{0.95508647f, 0.137895614f},
-std::array<float,2>{0.536818981f, 0.939659536f},
-std::array<float,2>{0.0378553085f, 0.340612173f},
-std::array<float,2>{0.167416349f, 0.765670598f},
-std::array<float,2>{0.735848665f, 0.441416055f},
-std::array<float,2>{0.766395271f, 0.553728521f},
-std::array<float,2>{0.29020372f, 0.0799182132f},
-std::array<float,2>{0.0915109217f, 0.603561282f},
-std::array<float,2>{0.572204173f, 0.0516288579f},
-std::array<float,2>{0.934622109f, 0.851259053f},
-std::array<float,2>{0.494194537f, 0.382102609f},
-std::array<float,2>{0.330637544f, 0.888905466f},
-std::array<float,2>{0.824134946f, 0.258444637f},
-std::array<float,2>{0.677262068f, 0.745062292f},
-std::array<float,2>{0.222265258f, 0.209139198f},
-std::array<float,2>{0.400009364f, 0.605871856f},
-std::array<float,2>{0.988860369f, 0.0491344072f},
-std::array<float,2>{0.525615454f, 0.84641844f},
-std::array<float,2>{0.0311634671f, 0.376463532f},
-std::array<float,2>{0.133191779f, 0.885514736f},
-std::array<float,2>{0.708267927f, 0.263107538f},
-std::array<float,2>{0.783819497f, 0.747564912f},
-std::array<float,2>{0.274073362f, 0.205410644f},
-std::array<float,2>{0.112677842f, 0.676450074f},
-std::array<float,2>{0.619628847f, 0.133326232f},
-std::array<float,2>{0.882944882f, 0.94306612f},
-std::array<float,2>{0.439434052f, 0.337771207f},
-std::array<float,2>{0.35805735f, 0.769959688f},
-std::array<float,2>{0.871129155f, 0.438782543f},
-std::array<float,2>{0.63087827f, 0.549715936f},
-std::array<float,2>{0.218089655f, 0.0854323357f},
-std::array<float,2>{0.311727673f, 0.696660161f},
-std::array<float,2>{0.759923756f, 0.24157007f},
-std::array<float,2>{0.719683945f, 0.937384546f},
-std::array<float,2>{0.186174154f, 0.302494466f},
-std::array<float,2>{0.0548499115f, 0.837590337f},
-std::array<float,2>{0.556881845f, 0.416482806f},
-std::array<float,2>{0.94263041f, 0.579809785f},
-std::array<float,2>{0.412067831f, 0.0055642454f},
-std::array<float,2>{0.245201245f, 0.526183069f},
-std::array<float,2>{0.668588817f, 0.0984025523f},
-std::array<float,2>{0.839189291f, 0.794821382f},
-std::array<float,2>{0.318506122f, 0.487480462f},
-std::array<float,2>{0.472674757f, 0.98549509f},
-std::array<float,2>{0.906923413f, 0.371447116f},
-std::array<float,2>{0.585510075f, 0.649755418f},
-std::array<float,2>{0.0736939311f, 0.161602944f},
-std::array<float,2>{0.342769623f, 0.533246875f},
-std::array<float,2>{0.819461882f, 0.0739509091f},
-std::array<float,2>{0.680800796f, 0.761704147f},
-std::array<float,2>{0.229995802f, 0.463451475f},
-std::array<float,2>{0.0827164873f, 0.965916097f},
-std::array<float,2>{0.56944865f, 0.326722264f},
-std::array<float,2>{0.927008033f, 0.660837173f},
-std::array<float,2>{0.487148404f, 0.141922921f},
-std::array<float,2>{0.159942836f, 0.732374966f},
-std::array<float,2>{0.744430602f, 0.198291555f},
-std::array<float,2>{0.779082119f, 0.893318117f},
-std::array<float,2>{0.281962574f, 0.279460996f},
-std::array<float,2>{0.4252325f, 0.866479158f},
-std::array<float,2>{0.967144012f, 0.394191861f},
-std::array<float,2>{0.539319277f, 0.619272292f},
-std::array<float,2>{0.0433645695f, 0.0392337218f},
-std::array<float,2>{0.462312073f, 0.639001846f},
-std::array<float,2>{0.898084998f, 0.184253976f},
-std::array<float,2>{0.595556974f, 0.977643609f},
-std::array<float,2>{0.0939862654f, 0.351143837f},
-std::array<float,2>{0.199174151f, 0.80262965f},
-std::array<float,2>{0.649872243f, 0.48365581f},
-std::array<float,2>{0.851481915f, 0.514698267f},
-std::array<float,2>{0.359820694f, 0.109611362f},
-std::array<float,2>{0.00545176631f, 0.562918961f},
-std::array<float,2>{0.505924523f, 0.0213248283f},
-std::array<float,2>{0.970654786f, 0.82742995f},
-std::array<float,2>{0.379711598f, 0.430930614f},
-std::array<float,2>{0.253647417f, 0.90742743f},
-std::array<float,2>{0.802717268f, 0.292248756f},
-std::array<float,2>{0.702638209f, 0.711822867f},
-std::array<float,2>{0.141375318f, 0.232518077f},
-std::array<float,2>{0.497382015f, 0.504474282f},
-std::array<float,2>{0.933442295f, 0.122760102f},
-std::array<float,2>{0.577659667f, 0.805267155f},
-std::array<float,2>{0.0866675824f, 0.474590808f},
-std::array<float,2>{0.222941518f, 0.970806003f},
-std::array<float,2>{0.675116599f, 0.352374375f},
-std::array<float,2>{0.826998293f, 0.630952895f},
-std::array<float,2>{0.33443743f, 0.176098466f},
-std::array<float,2>{0.0350831337f, 0.709282577f},
-std::array<float,2>{0.531289697f, 0.226343781f},
-std::array<float,2>{0.957322121f, 0.914314508f},
-std::array<float,2>{0.430005014f, 0.284998924f},
-std::array<float,2>{0.294553906f, 0.819494009f},
-std::array<float,2>{0.772233427f, 0.426359236f},
-std::array<float,2>{0.738957286f, 0.57215035f},
-std::array<float,2>{0.168966413f, 0.0292846933f},
-std::array<float,2>{0.370711625f, 0.664618254f},
-std::array<float,2>{0.856629968f, 0.15415144f},
-std::array<float,2>{0.641115904f, 0.959694505f},
-std::array<float,2>{0.187648132f, 0.31931591f},
-std::array<float,2>{0.10851454f, 0.753659844f},
-std::array<float,2>{0.605223238f, 0.457418114f},
-std::array<float,2>{0.905769646f, 0.541624486f},
-std::array<float,2>{0.46071288f, 0.0628687218f},
-std::array<float,2>{0.150775269f, 0.614572227f},
-std::array<float,2>{0.689861774f, 0.0322700329f},
-std::array<float,2>{0.809019983f, 0.874602437f},
-std::array<float,2>{0.259909004f, 0.40525946f},
-std::array<float,2>{0.385758787f, 0.901667774f},
-std::array<float,2>{0.981447518f, 0.272200167f},
-std::array<float,2>{0.511891544f, 0.726172626f},
-std::array<float,2>{0.0124037163f, 0.19010821f},
-std::array<float,2>{0.273355961f, 0.589225888f},
-std::array<float,2>{0.794398189f, 0.00864195358f},
-std::array<float,2>{0.713322759f, 0.834724545f},
-std::array<float,2>{0.132493526f, 0.406745791f},
-std::array<float,2>{0.0188124254f, 0.921901643f},
-std::array<float,2>{0.521991193f, 0.310450912f},
-std::array<float,2>{0.995207906f, 0.691074371f},
-std::array<float,2>{0.397634655f, 0.242974088f},
-std::array<float,2>{0.203701451f, 0.647854984f},
-std::array<float,2>{0.63359803f, 0.167138502f},
-std::array<float,2>{0.862676859f, 0.999086857f},
-std::array<float,2>{0.349588543f, 0.363239318f},
-std::array<float,2>{0.445335418f, 0.783498883f},
-std::array<float,2>{0.875971019f, 0.497829646f},
-std::array<float,2>{0.616371095f, 0.519961357f},
-std::array<float,2>{0.124329858f, 0.103003152f},
-std::array<float,2>{0.414956421f, 0.739332259f},
-std::array<float,2>{0.945652962f, 0.216550082f},
-std::array<float,2>{0.551257074f, 0.877101004f},
-std::array<float,2>{0.0499296971f, 0.251811355f},
-std::array<float,2>{0.175547034f, 0.855866075f},
-std::array<float,2>{0.728874385f, 0.390128374f},
-std::array<float,2>{0.750882268f, 0.595974982f},
-std::array<float,2>{0.304448783f, 0.0618257895f},
-std::array<float,2>{0.0677628815f, 0.558324516f},
-std::array<float,2>{0.589002013f, 0.0932530165f},
-std::array<float,2>{0.915869355f, 0.776511908f},
-std::array<float,2>{0.483207554f, 0.44733721f},
-std::array<float,2>{0.32149753f, 0.948928952f},
-std::array<float,2>{0.833334565f, 0.328281373f},
-std::array<float,2>{0.657291532f, 0.684314847f},
-std::array<float,2>{0.238653183f, 0.127357274f},
-std::array<float,2>{0.437063724f, 0.554639399f},
-std::array<float,2>{0.954021096f, 0.079310663f},
-std::array<float,2>{0.537249506f, 0.76616931f},
-std::array<float,2>{0.0364120193f, 0.442255706f},
-std::array<float,2>{0.164859548f, 0.940120101f},
-std::array<float,2>{0.737020254f, 0.340139598f},
-std::array<float,2>{0.768698096f, 0.675498247f},
-std::array<float,2>{0.292067111f, 0.13843137f},
-std::array<float,2>{0.092095986f, 0.744361579f},
-std::array<float,2>{0.572735131f, 0.209671989f},
-std::array<float,2>{0.936946154f, 0.889278471f},
-std::array<float,2>{0.493252367f, 0.257955194f},
-std::array<float,2>{0.329220772f, 0.85066092f},
-std::array<float,2>{0.820508063f, 0.382401139f},
-std::array<float,2>{0.677765429f, 0.604016602f},
-std::array<float,2>{0.219603583f, 0.0508994572f},
-std::array<float,2>{0.263046324f, 0.653639078f},
-std::array<float,2>{0.808421791f, 0.157215446f},
-std::array<float,2>{0.694579065f, 0.990754664f},
-std::array<float,2>{0.15376164f, 0.370795399f},
-std::array<float,2>{0.010795908f, 0.790205479f},
-std::array<float,2>{0.509326756f, 0.489783347f},
-std::array<float,2>{0.979147077f, 0.530607998f},
-std::array<float,2>{0.386857003f, 0.0943497345f},
-std::array<float,2>{0.193265617f, 0.583135843f},
-std::array<float,2>{0.648028791f, 0.000614447636f},
-std::array<float,2>{0.855238914f, 0.840771019f},
-std::array<float,2>{0.374276727f, 0.420136541f},
-std::array<float,2>{0.455960482f, 0.93015188f},
-std::array<float,2>{0.901369691f, 0.296961874f},
-std::array<float,2>{0.608045995f, 0.7010746f},
-std::array<float,2>{0.102395371f, 0.234693706f},
-std::array<float,2>{0.345784634f, 0.622918129f},
-std::array<float,2>{0.866669416f, 0.0467291847f},
-std::array<float,2>{0.639725029f, 0.861906528f},
-std::array<float,2>{0.20936437f, 0.397723049f},
-std::array<float,2>{0.119134486f, 0.896386206f},
-std::array<float,2>{0.609822392f, 0.274014115f},
-std::array<float,2>{0.881634593f, 0.73029542f},
-std::array<float,2>{0.452575415f, 0.20076184f},
-std::array<float,2>{0.127351597f, 0.656929076f},
-std::array<float,2>{0.718254447f, 0.145531431f},
-std::array<float,2>{0.7922135f, 0.964250982f},
-std::array<float,2>{0.266097784f, 0.32188651f},
-std::array<float,2>{0.393670112f, 0.761748075f},
-std::array<float,2>{0.998518527f, 0.468360275f},
-std::array<float,2>{0.515643954f, 0.539041102f},
-std::array<float,2>{0.0221724305f, 0.0756371543f},
-std::array<float,2>{0.478944689f, 0.714938045f},
-std::array<float,2>{0.921436191f, 0.229750827f},
-std::array<float,2>{0.591931164f, 0.911568046f},
-std::array<float,2>{0.0657446384f, 0.294080645f},
-std::array<float,2>{0.235192344f, 0.823300838f},
-std::array<float,2>{0.660512745f, 0.434701443f},
-std::array<float,2>{0.828883827f, 0.569141746f},
-std::array<float,2>{0.324316144f, 0.016470911f},
-std::array<float,2>{0.0532445051f, 0.511012375f},
-std::array<float,2>{0.547192514f, 0.116112955f},
-std::array<float,2>{0.951292276f, 0.798191488f},
-std::array<float,2>{0.42021817f, 0.479110479f},
-std::array<float,2>{0.298353881f, 0.983096778f},
-std::array<float,2>{0.754817605f, 0.344257236f},
-std::array<float,2>{0.732499123f, 0.632858813f},
-std::array<float,2>{0.177918389f, 0.180615187f},
-std::array<float,2>{0.445013762f, 0.574915946f},
-std::array<float,2>{0.888089776f, 0.0246854704f},
-std::array<float,2>{0.622294843f, 0.815768242f},
-std::array<float,2>{0.114014916f, 0.425452769f},
-std::array<float,2>{0.212159038f, 0.921264768f},
-std::array<float,2>{0.625125289f, 0.286070436f},
-std::array<float,2>{0.870580137f, 0.703181684f},
-std::array<float,2>{0.353195041f, 0.220309198f},
-std::array<float,2>{0.0235802718f, 0.62853235f},
-std::array<float,2>{0.529405355f, 0.175435409f},
-std::array<float,2>{0.987525702f, 0.973505497f},
-std::array<float,2>{0.404608279f, 0.357274771f},
-std::array<float,2>{0.279420733f, 0.809559584f},
-std::array<float,2>{0.78624928f, 0.46904543f},
-std::array<float,2>{0.70484221f, 0.500108838f},
-std::array<float,2>{0.140105352f, 0.12096031f},
-std::array<float,2>{0.314259589f, 0.720780849f},
-std::array<float,2>{0.843573689f, 0.191915408f},
-std::array<float,2>{0.664365828f, 0.902956128f},
-std::array<float,2>{0.246715888f, 0.267401367f},
-std::array<float,2>{0.0773573816f, 0.870862603f},
-std::array<float,2>{0.580110908f, 0.400184184f},
-std::array<float,2>{0.912349701f, 0.612788677f},
-std::array<float,2>{0.469519615f, 0.0365527608f},
-std::array<float,2>{0.183238357f, 0.545899451f},
-std::array<float,2>{0.724319279f, 0.0676253811f},
-std::array<float,2>{0.761719465f, 0.756497681f},
-std::array<float,2>{0.306140542f, 0.45454675f},
-std::array<float,2>{0.407898337f, 0.953486264f},
-std::array<float,2>{0.940905333f, 0.315722942f},
-std::array<float,2>{0.560407221f, 0.669828534f},
-std::array<float,2>{0.0599986576f, 0.152243525f},
-std::array<float,2>{0.288743019f, 0.518206f},
-std::array<float,2>{0.774846196f, 0.106297433f},
-std::array<float,2>{0.749110758f, 0.786283731f},
-std::array<float,2>{0.16083616f, 0.492922127f},
-std::array<float,2>{0.0419133343f, 0.995511711f},
-std::array<float,2>{0.546142876f, 0.365343213f},
-std::array<float,2>{0.963676989f, 0.642044008f},
-std::array<float,2>{0.425936162f, 0.171614677f},
-std::array<float,2>{0.2324204f, 0.693536043f},
-std::array<float,2>{0.686203063f, 0.247861251f},
-std::array<float,2>{0.812702179f, 0.928923428f},
-std::array<float,2>{0.336751997f, 0.308030397f},
-std::array<float,2>{0.49006319f, 0.829848528f},
-std::array<float,2>{0.924658537f, 0.412730068f},
-std::array<float,2>{0.566097021f, 0.592042327f},
-std::array<float,2>{0.0794265121f, 0.0141575616f},
-std::array<float,2>{0.378135085f, 0.681774914f},
-std::array<float,2>{0.976411462f, 0.129608527f},
-std::array<float,2>{0.501084924f, 0.950119495f},
-std::array<float,2>{0.00263901637f, 0.335675508f},
-std::array<float,2>{0.145342663f, 0.778033435f},
-std::array<float,2>{0.69718045f, 0.451670825f},
-std::array<float,2>{0.796928525f, 0.562253952f},
-std::array<float,2>{0.255778462f, 0.0860769227f},
-std::array<float,2>{0.099357985f, 0.599132299f},
-std::array<float,2>{0.597925603f, 0.0566375926f},
-std::array<float,2>{0.893884897f, 0.855274439f},
-std::array<float,2>{0.467774659f, 0.385812044f},
-std::array<float,2>{0.365800053f, 0.88265723f},
-std::array<float,2>{0.844134152f, 0.257220387f},
-std::array<float,2>{0.654191732f, 0.737171531f},
-std::array<float,2>{0.199692085f, 0.213600174f},
-std::array<float,2>{0.413445503f, 0.580179811f},
-std::array<float,2>{0.943921268f, 0.00710043311f},
-std::array<float,2>{0.554761112f, 0.839051366f},
-std::array<float,2>{0.0583615676f, 0.415926397f},
-std::array<float,2>{0.185059994f, 0.935538352f},
-std::array<float,2>{0.722440422f, 0.303627193f},
-std::array<float,2>{0.759390712f, 0.697903872f},
-std::array<float,2>{0.310146242f, 0.239785478f},
-std::array<float,2>{0.0706690922f, 0.652207553f},
-std::array<float,2>{0.582294822f, 0.163418233f},
-std::array<float,2>{0.910049558f, 0.987811923f},
-std::array<float,2>{0.475148797f, 0.374066204f},
-std::array<float,2>{0.317867488f, 0.796509147f},
-std::array<float,2>{0.836633027f, 0.485280603f},
-std::array<float,2>{0.669931591f, 0.524095774f},
-std::array<float,2>{0.243661463f, 0.100555666f},
-std::array<float,2>{0.276113153f, 0.749781251f},
-std::array<float,2>{0.782939792f, 0.203420356f},
-std::array<float,2>{0.709223092f, 0.883469403f},
-std::array<float,2>{0.136405721f, 0.264683694f},
-std::array<float,2>{0.0279111862f, 0.84507513f},
-std::array<float,2>{0.523903847f, 0.37704441f},
-std::array<float,2>{0.991431355f, 0.60804379f},
-std::array<float,2>{0.401232243f, 0.0485583171f},
-std::array<float,2>{0.215034679f, 0.547823191f},
-std::array<float,2>{0.630323231f, 0.0829797983f},
-std::array<float,2>{0.874477923f, 0.771746874f},
-std::array<float,2>{0.355688453f, 0.440797687f},
-std::array<float,2>{0.440293491f, 0.943530142f},
-std::array<float,2>{0.886323452f, 0.339043885f},
-std::array<float,2>{0.619095743f, 0.678833902f},
-std::array<float,2>{0.110000156f, 0.13666971f},
-std::array<float,2>{0.361505896f, 0.51181072f},
-std::array<float,2>{0.847963333f, 0.112993903f},
-std::array<float,2>{0.651054025f, 0.802995205f},
-std::array<float,2>{0.195467159f, 0.481718391f},
-std::array<float,2>{0.0964544117f, 0.98015511f},
-std::array<float,2>{0.597424984f, 0.348684669f},
-std::array<float,2>{0.896409869f, 0.638304293f},
-std::array<float,2>{0.464832783f, 0.186055988f},
-std::array<float,2>{0.144427657f, 0.713763595f},
-std::array<float,2>{0.700330377f, 0.230603173f},
-std::array<float,2>{0.803785443f, 0.910006285f},
-std::array<float,2>{0.250172436f, 0.290359616f},
-std::array<float,2>{0.382444859f, 0.824688435f},
-std::array<float,2>{0.971494436f, 0.432568282f},
-std::array<float,2>{0.505750597f, 0.565159023f},
-std::array<float,2>{0.006424197f, 0.0220350418f},
-std::array<float,2>{0.485160559f, 0.663567722f},
-std::array<float,2>{0.928952694f, 0.144118056f},
-std::array<float,2>{0.566671312f, 0.96843183f},
-std::array<float,2>{0.0841634497f, 0.324621707f},
-std::array<float,2>{0.227098763f, 0.758681655f},
-std::array<float,2>{0.683482051f, 0.462884873f},
-std::array<float,2>{0.81747061f, 0.531819701f},
-std::array<float,2>{0.341199249f, 0.0708330125f},
-std::array<float,2>{0.0466906764f, 0.617511868f},
-std::array<float,2>{0.541167557f, 0.0417979509f},
-std::array<float,2>{0.964876771f, 0.86381036f},
-std::array<float,2>{0.422267556f, 0.390789986f},
-std::array<float,2>{0.283775926f, 0.891180515f},
-std::array<float,2>{0.780302942f, 0.277731389f},
-std::array<float,2>{0.743854046f, 0.732896626f},
-std::array<float,2>{0.156372041f, 0.196115553f},
-std::array<float,2>{0.45765093f, 0.539419949f},
-std::array<float,2>{0.90238446f, 0.0647630468f},
-std::array<float,2>{0.602455199f, 0.751680791f},
-std::array<float,2>{0.105721988f, 0.459667534f},
-std::array<float,2>{0.189572424f, 0.958945632f},
-std::array<float,2>{0.643205285f, 0.317573398f},
-std::array<float,2>{0.858002365f, 0.667102337f},
-std::array<float,2>{0.368740052f, 0.155653104f},
-std::array<float,2>{0.0144114392f, 0.724100769f},
-std::array<float,2>{0.514828205f, 0.189187512f},
-std::array<float,2>{0.982848167f, 0.898869336f},
-std::array<float,2>{0.384051412f, 0.271327585f},
-std::array<float,2>{0.259590864f, 0.872144699f},
-std::array<float,2>{0.810643256f, 0.40303582f},
-std::array<float,2>{0.68852824f, 0.616122723f},
-std::array<float,2>{0.148780912f, 0.0338771008f},
-std::array<float,2>{0.333084494f, 0.630502462f},
-std::array<float,2>{0.824962258f, 0.178914443f},
-std::array<float,2>{0.673814356f, 0.969862938f},
-std::array<float,2>{0.225292891f, 0.354446888f},
-std::array<float,2>{0.087984845f, 0.808416009f},
-std::array<float,2>{0.574256897f, 0.475563437f},
-std::array<float,2>{0.930738866f, 0.50702709f},
-std::array<float,2>{0.498055071f, 0.123638183f},
-std::array<float,2>{0.171397313f, 0.574026644f},
-std::array<float,2>{0.740761101f, 0.0297914799f},
-std::array<float,2>{0.770341933f, 0.817933857f},
-std::array<float,2>{0.295936644f, 0.429321498f},
-std::array<float,2>{0.431894034f, 0.917591572f},
-std::array<float,2>{0.959707916f, 0.281871378f},
-std::array<float,2>{0.534073353f, 0.707731307f},
-std::array<float,2>{0.0314593911f, 0.223798022f},
-std::array<float,2>{0.302318543f, 0.594666541f},
-std::array<float,2>{0.7528615f, 0.0590667538f},
-std::array<float,2>{0.727670312f, 0.857570231f},
-std::array<float,2>{0.172692537f, 0.387046754f},
-std::array<float,2>{0.047339607f, 0.876803041f},
-std::array<float,2>{0.55313009f, 0.252743036f},
-std::array<float,2>{0.948293746f, 0.740417182f},
-std::array<float,2>{0.416433156f, 0.217782781f},
-std::array<float,2>{0.241784126f, 0.686424732f},
-std::array<float,2>{0.659592807f, 0.126405954f},
-std::array<float,2>{0.834374785f, 0.945836365f},
-std::array<float,2>{0.323304981f, 0.330835521f},
-std::array<float,2>{0.481158733f, 0.774407744f},
-std::array<float,2>{0.917048454f, 0.446835637f},
-std::array<float,2>{0.586753309f, 0.555810392f},
-std::array<float,2>{0.0685415864f, 0.0917939469f},
-std::array<float,2>{0.396141589f, 0.687906623f},
-std::array<float,2>{0.992824674f, 0.244201198f},
-std::array<float,2>{0.520125031f, 0.925307751f},
-std::array<float,2>{0.0169141069f, 0.312383384f},
-std::array<float,2>{0.130025133f, 0.833531201f},
-std::array<float,2>{0.712871552f, 0.408843219f},
-std::array<float,2>{0.795244694f, 0.587432027f},
-std::array<float,2>{0.269636661f, 0.0110102063f},
-std::array<float,2>{0.121467605f, 0.521826088f},
-std::array<float,2>{0.615118682f, 0.10395278f},
-std::array<float,2>{0.878194392f, 0.781792343f},
-std::array<float,2>{0.447529465f, 0.499814093f},
-std::array<float,2>{0.350924909f, 0.997309923f},
-std::array<float,2>{0.860678375f, 0.360321134f},
-std::array<float,2>{0.636293173f, 0.644634485f},
-std::array<float,2>{0.205615029f, 0.165873468f},
-std::array<float,2>{0.388708532f, 0.5283795f},
-std::array<float,2>{0.977017999f, 0.0970914289f},
-std::array<float,2>{0.51155889f, 0.792161226f},
-std::array<float,2>{0.00855752546f, 0.490629286f},
-std::array<float,2>{0.154763564f, 0.988991976f},
-std::array<float,2>{0.692880034f, 0.368277162f},
-std::array<float,2>{0.80513525f, 0.655491054f},
-std::array<float,2>{0.264008373f, 0.158790156f},
-std::array<float,2>{0.103770681f, 0.701699674f},
-std::array<float,2>{0.606245279f, 0.236684754f},
-std::array<float,2>{0.899136662f, 0.932714522f},
-std::array<float,2>{0.453224808f, 0.300249696f},
-std::array<float,2>{0.371894687f, 0.843677342f},
-std::array<float,2>{0.851840258f, 0.418099284f},
-std::array<float,2>{0.644595802f, 0.585059762f},
-std::array<float,2>{0.19523336f, 0.00243749283f},
-std::array<float,2>{0.290784746f, 0.673780322f},
-std::array<float,2>{0.765706956f, 0.140001535f},
-std::array<float,2>{0.735782802f, 0.937632561f},
-std::array<float,2>{0.167554334f, 0.343101561f},
-std::array<float,2>{0.0375116877f, 0.767771363f},
-std::array<float,2>{0.536575258f, 0.445264161f},
-std::array<float,2>{0.956026018f, 0.551422775f},
-std::array<float,2>{0.435249895f, 0.080230169f},
-std::array<float,2>{0.221879989f, 0.602691591f},
-std::array<float,2>{0.677061737f, 0.0528778732f},
-std::array<float,2>{0.823395967f, 0.847990453f},
-std::array<float,2>{0.33051461f, 0.380437672f},
-std::array<float,2>{0.494835198f, 0.886945605f},
-std::array<float,2>{0.935452342f, 0.259902239f},
-std::array<float,2>{0.571379483f, 0.743999481f},
-std::array<float,2>{0.0911189169f, 0.208142161f},
-std::array<float,2>{0.327138662f, 0.567395806f},
-std::array<float,2>{0.831090271f, 0.0176136028f},
-std::array<float,2>{0.662362218f, 0.821533442f},
-std::array<float,2>{0.238050625f, 0.435633659f},
-std::array<float,2>{0.0631084368f, 0.913354278f},
-std::array<float,2>{0.590896189f, 0.295340598f},
-std::array<float,2>{0.91905266f, 0.717743278f},
-std::array<float,2>{0.477694362f, 0.227530584f},
-std::array<float,2>{0.176839188f, 0.636213839f},
-std::array<float,2>{0.731649399f, 0.18272315f},
-std::array<float,2>{0.757016122f, 0.980921745f},
-std::array<float,2>{0.299205571f, 0.34664762f},
-std::array<float,2>{0.418299794f, 0.800105929f},
-std::array<float,2>{0.950636089f, 0.478492767f},
-std::array<float,2>{0.548925936f, 0.507888079f},
-std::array<float,2>{0.0516251102f, 0.113289244f},
-std::array<float,2>{0.45066452f, 0.727657855f},
-std::array<float,2>{0.879972994f, 0.202950343f},
-std::array<float,2>{0.612976313f, 0.89714402f},
-std::array<float,2>{0.119232751f, 0.277299494f},
-std::array<float,2>{0.208744526f, 0.86094445f},
-std::array<float,2>{0.637793481f, 0.396211773f},
-std::array<float,2>{0.864124477f, 0.624762714f},
-std::array<float,2>{0.344977289f, 0.0437068529f},
-std::array<float,2>{0.0196909625f, 0.536598325f},
-std::array<float,2>{0.519169688f, 0.077450268f},
-std::array<float,2>{0.997100294f, 0.764351428f},
-std::array<float,2>{0.39143163f, 0.464849204f},
-std::array<float,2>{0.26951161f, 0.962576628f},
-std::array<float,2>{0.789286256f, 0.323639989f},
-std::array<float,2>{0.716165066f, 0.659438252f},
-std::array<float,2>{0.125261918f, 0.147439897f},
-std::array<float,2>{0.471740276f, 0.611067533f},
-std::array<float,2>{0.910326838f, 0.038398575f},
-std::array<float,2>{0.579078734f, 0.868699431f},
-std::array<float,2>{0.0749102831f, 0.400803208f},
-std::array<float,2>{0.249084622f, 0.905120015f},
-std::array<float,2>{0.666951716f, 0.26839447f},
-std::array<float,2>{0.841516972f, 0.720152497f},
-std::array<float,2>{0.315456957f, 0.194776386f},
-std::array<float,2>{0.0607902966f, 0.670223951f},
-std::array<float,2>{0.561400354f, 0.150232106f},
-std::array<float,2>{0.93914026f, 0.955278158f},
-std::array<float,2>{0.409028411f, 0.313808709f},
-std::array<float,2>{0.308303416f, 0.754813135f},
-std::array<float,2>{0.763982892f, 0.456502378f},
-std::array<float,2>{0.725915313f, 0.54366982f},
-std::array<float,2>{0.181292638f, 0.069409214f},
-std::array<float,2>{0.354653031f, 0.705983102f},
-std::array<float,2>{0.868550539f, 0.221522644f},
-std::array<float,2>{0.628281772f, 0.919621766f},
-std::array<float,2>{0.214263275f, 0.288492262f},
-std::array<float,2>{0.116752513f, 0.813817561f},
-std::array<float,2>{0.624648273f, 0.422154844f},
-std::array<float,2>{0.889707446f, 0.576625288f},
-std::array<float,2>{0.4433375f, 0.0255360827f},
-std::array<float,2>{0.137877777f, 0.502789319f},
-std::array<float,2>{0.705449164f, 0.117281124f},
-std::array<float,2>{0.787456214f, 0.810968161f},
-std::array<float,2>{0.278836727f, 0.471103191f},
-std::array<float,2>{0.403243899f, 0.975614011f},
-std::array<float,2>{0.985724747f, 0.359009951f},
-std::array<float,2>{0.528657317f, 0.626604378f},
-std::array<float,2>{0.0261734184f, 0.172783703f},
-std::array<float,2>{0.256340325f, 0.560387313f},
-std::array<float,2>{0.79997015f, 0.0883156657f},
-std::array<float,2>{0.697985411f, 0.779553294f},
-std::array<float,2>{0.1476762f, 0.450939864f},
-std::array<float,2>{0.000443095691f, 0.952906191f},
-std::array<float,2>{0.502636731f, 0.33233735f},
-std::array<float,2>{0.974167705f, 0.680317283f},
-std::array<float,2>{0.376083314f, 0.131177664f},
-std::array<float,2>{0.202159762f, 0.735927224f},
-std::array<float,2>{0.654733777f, 0.212589547f},
-std::array<float,2>{0.847228527f, 0.880658627f},
-std::array<float,2>{0.363486618f, 0.254840761f},
-std::array<float,2>{0.465915322f, 0.852372348f},
-std::array<float,2>{0.891191363f, 0.384168118f},
-std::array<float,2>{0.599841535f, 0.5997141f},
-std::array<float,2>{0.0999139026f, 0.0581205525f},
-std::array<float,2>{0.429086834f, 0.643388927f},
-std::array<float,2>{0.961653769f, 0.168236926f},
-std::array<float,2>{0.544410288f, 0.99325484f},
-std::array<float,2>{0.0404041559f, 0.363871843f},
-std::array<float,2>{0.163171068f, 0.788204432f},
-std::array<float,2>{0.747555852f, 0.495726377f},
-std::array<float,2>{0.777095914f, 0.516711414f},
-std::array<float,2>{0.286605f, 0.107603475f},
-std::array<float,2>{0.0817634165f, 0.591482878f},
-std::array<float,2>{0.563704669f, 0.0125619769f},
-std::array<float,2>{0.922958255f, 0.830168962f},
-std::array<float,2>{0.490254551f, 0.410197288f},
-std::array<float,2>{0.338353723f, 0.927661419f},
-std::array<float,2>{0.815467f, 0.305719852f},
-std::array<float,2>{0.684411824f, 0.69159466f},
-std::array<float,2>{0.233709127f, 0.248729542f},
-std::array<float,2>{0.380479068f, 0.565959156f},
-std::array<float,2>{0.969126403f, 0.022475075f},
-std::array<float,2>{0.507088363f, 0.825721502f},
-std::array<float,2>{0.00463011302f, 0.433542132f},
-std::array<float,2>{0.142372787f, 0.90834868f},
-std::array<float,2>{0.701412439f, 0.289486706f},
-std::array<float,2>{0.8016994f, 0.71399045f},
-std::array<float,2>{0.252354741f, 0.231918663f},
-std::array<float,2>{0.0949128196f, 0.636955857f},
-std::array<float,2>{0.594531357f, 0.186620817f},
-std::array<float,2>{0.897434771f, 0.978943765f},
-std::array<float,2>{0.461298019f, 0.347861528f},
-std::array<float,2>{0.360937238f, 0.80427736f},
-std::array<float,2>{0.849998116f, 0.480672985f},
-std::array<float,2>{0.648883462f, 0.513625264f},
-std::array<float,2>{0.198145717f, 0.111717038f},
-std::array<float,2>{0.282708704f, 0.734205425f},
-std::array<float,2>{0.777902722f, 0.196328163f},
-std::array<float,2>{0.746076107f, 0.892500758f},
-std::array<float,2>{0.158438146f, 0.278770238f},
-std::array<float,2>{0.0440537333f, 0.865046024f},
-std::array<float,2>{0.540935874f, 0.391901493f},
-std::array<float,2>{0.968340576f, 0.619135559f},
-std::array<float,2>{0.424053997f, 0.0423925854f},
-std::array<float,2>{0.228970513f, 0.532508552f},
-std::array<float,2>{0.680511653f, 0.0720701888f},
-std::array<float,2>{0.818706751f, 0.759649098f},
-std::array<float,2>{0.343564838f, 0.461509824f},
-std::array<float,2>{0.487473518f, 0.967064381f},
-std::array<float,2>{0.926631212f, 0.325998098f},
-std::array<float,2>{0.568431377f, 0.662626684f},
-std::array<float,2>{0.0832699835f, 0.142711237f},
-std::array<float,2>{0.320264161f, 0.524509311f},
-std::array<float,2>{0.838825107f, 0.101441793f},
-std::array<float,2>{0.669378519f, 0.795287609f},
-std::array<float,2>{0.244939476f, 0.485486329f},
-std::array<float,2>{0.0729064196f, 0.98652488f},
-std::array<float,2>{0.584909499f, 0.373610735f},
-std::array<float,2>{0.90727675f, 0.650404692f},
-std::array<float,2>{0.473963141f, 0.162185147f},
-std::array<float,2>{0.187484831f, 0.698953032f},
-std::array<float,2>{0.719991863f, 0.238656089f},
-std::array<float,2>{0.760819018f, 0.934240639f},
-std::array<float,2>{0.310897529f, 0.304199547f},
-std::array<float,2>{0.410281152f, 0.83846581f},
-std::array<float,2>{0.942368329f, 0.414332271f},
-std::array<float,2>{0.558509946f, 0.581610084f},
-std::array<float,2>{0.0563986041f, 0.00652577402f},
-std::array<float,2>{0.438349754f, 0.678569257f},
-std::array<float,2>{0.884322762f, 0.134859607f},
-std::array<float,2>{0.620739341f, 0.945137262f},
-std::array<float,2>{0.111469381f, 0.338496327f},
-std::array<float,2>{0.217609465f, 0.772657931f},
-std::array<float,2>{0.632034302f, 0.439481169f},
-std::array<float,2>{0.872115612f, 0.547993839f},
-std::array<float,2>{0.358580053f, 0.0838450715f},
-std::array<float,2>{0.0299741905f, 0.6090675f},
-std::array<float,2>{0.526922822f, 0.047432404f},
-std::array<float,2>{0.989574552f, 0.84449923f},
-std::array<float,2>{0.399171859f, 0.378802538f},
-std::array<float,2>{0.274864912f, 0.884344518f},
-std::array<float,2>{0.78508544f, 0.263785124f},
-std::array<float,2>{0.707716405f, 0.748129904f},
-std::array<float,2>{0.134144053f, 0.204372972f},
-std::array<float,2>{0.483603835f, 0.55501622f},
-std::array<float,2>{0.914652944f, 0.0903545395f},
-std::array<float,2>{0.588676214f, 0.775078595f},
-std::array<float,2>{0.0668368787f, 0.445653766f},
-std::array<float,2>{0.240172446f, 0.947064519f},
-std::array<float,2>{0.65672785f, 0.331850618f},
-std::array<float,2>{0.83219558f, 0.68736279f},
-std::array<float,2>{0.32062304f, 0.125137255f},
-std::array<float,2>{0.0494211838f, 0.741823554f},
-std::array<float,2>{0.551961184f, 0.217485934f},
-std::array<float,2>{0.946379364f, 0.875952303f},
-std::array<float,2>{0.415345013f, 0.253791571f},
-std::array<float,2>{0.303262413f, 0.858630776f},
-std::array<float,2>{0.751139462f, 0.387889892f},
-std::array<float,2>{0.729775965f, 0.595643699f},
-std::array<float,2>{0.17450887f, 0.0601015203f},
-std::array<float,2>{0.348169357f, 0.64619571f},
-std::array<float,2>{0.861358345f, 0.164254352f},
-std::array<float,2>{0.633910418f, 0.996587157f},
-std::array<float,2>{0.204292372f, 0.360374779f},
-std::array<float,2>{0.123597614f, 0.78255564f},
-std::array<float,2>{0.615999401f, 0.498329431f},
-std::array<float,2>{0.876218021f, 0.523248792f},
-std::array<float,2>{0.446869284f, 0.105070487f},
-std::array<float,2>{0.131701872f, 0.585985839f},
-std::array<float,2>{0.714220464f, 0.0104279425f},
-std::array<float,2>{0.793578982f, 0.832347035f},
-std::array<float,2>{0.271857202f, 0.409310162f},
-std::array<float,2>{0.397096723f, 0.924363434f},
-std::array<float,2>{0.994245708f, 0.31081894f},
-std::array<float,2>{0.522617579f, 0.689358771f},
-std::array<float,2>{0.0183596462f, 0.245138541f},
-std::array<float,2>{0.261302143f, 0.616871715f},
-std::array<float,2>{0.810088694f, 0.034660764f},
-std::array<float,2>{0.690481365f, 0.871921539f},
-std::array<float,2>{0.151847303f, 0.403994918f},
-std::array<float,2>{0.0133597227f, 0.899555981f},
-std::array<float,2>{0.513224125f, 0.270224929f},
-std::array<float,2>{0.980897784f, 0.723333538f},
-std::array<float,2>{0.385249585f, 0.187902629f},
-std::array<float,2>{0.189150363f, 0.66630131f},
-std::array<float,2>{0.64168942f, 0.154634401f},
-std::array<float,2>{0.855990946f, 0.957281888f},
-std::array<float,2>{0.369335085f, 0.317332774f},
-std::array<float,2>{0.459927231f, 0.750261366f},
-std::array<float,2>{0.904827833f, 0.460625529f},
-std::array<float,2>{0.604330957f, 0.540909767f},
-std::array<float,2>{0.108322985f, 0.0661196485f},
-std::array<float,2>{0.430970013f, 0.708597898f},
-std::array<float,2>{0.958542645f, 0.222942635f},
-std::array<float,2>{0.532929003f, 0.916329324f},
-std::array<float,2>{0.0335454941f, 0.282732964f},
-std::array<float,2>{0.168007165f, 0.816991329f},
-std::array<float,2>{0.739585698f, 0.428476006f},
-std::array<float,2>{0.772678733f, 0.572951853f},
-std::array<float,2>{0.293074369f, 0.0311111435f},
-std::array<float,2>{0.0875906646f, 0.505874097f},
-std::array<float,2>{0.57624799f, 0.124996081f},
-std::array<float,2>{0.93209523f, 0.807042539f},
-std::array<float,2>{0.496856004f, 0.476306289f},
-std::array<float,2>{0.335655957f, 0.969268143f},
-std::array<float,2>{0.827391505f, 0.354548514f},
-std::array<float,2>{0.674308598f, 0.629501104f},
-std::array<float,2>{0.224450856f, 0.178238511f},
-std::array<float,2>{0.421574026f, 0.509508014f},
-std::array<float,2>{0.952415705f, 0.114731342f},
-std::array<float,2>{0.548239172f, 0.799711347f},
-std::array<float,2>{0.0545079447f, 0.476958692f},
-std::array<float,2>{0.178995311f, 0.982285559f},
-std::array<float,2>{0.733674169f, 0.346707582f},
-std::array<float,2>{0.755734742f, 0.634862542f},
-std::array<float,2>{0.297066748f, 0.181746349f},
-std::array<float,2>{0.0654037744f, 0.717907965f},
-std::array<float,2>{0.593284607f, 0.227614522f},
-std::array<float,2>{0.919928193f, 0.912734091f},
-std::array<float,2>{0.480337769f, 0.295970827f},
-std::array<float,2>{0.325773537f, 0.820755601f},
-std::array<float,2>{0.829647422f, 0.437062085f},
-std::array<float,2>{0.662075043f, 0.566758633f},
-std::array<float,2>{0.235865459f, 0.0194611661f},
-std::array<float,2>{0.266923785f, 0.658308029f},
-std::array<float,2>{0.791385114f, 0.147636622f},
-std::array<float,2>{0.716920078f, 0.96137327f},
-std::array<float,2>{0.128435805f, 0.322523057f},
-std::array<float,2>{0.0230843481f, 0.76515156f},
-std::array<float,2>{0.517109811f, 0.466124862f},
-std::array<float,2>{0.999793768f, 0.535548031f},
-std::array<float,2>{0.392954648f, 0.0769015774f},
-std::array<float,2>{0.210849941f, 0.623269379f},
-std::array<float,2>{0.6386801f, 0.0444534011f},
-std::array<float,2>{0.865980387f, 0.859641135f},
-std::array<float,2>{0.34714976f, 0.395238936f},
-std::array<float,2>{0.451825559f, 0.898010075f},
-std::array<float,2>{0.882557631f, 0.275963604f},
-std::array<float,2>{0.610917747f, 0.726928234f},
-std::array<float,2>{0.117202975f, 0.201227009f},
-std::array<float,2>{0.373093843f, 0.584252954f},
-std::array<float,2>{0.853864133f, 0.00322586135f},
-std::array<float,2>{0.646946073f, 0.842384398f},
-std::array<float,2>{0.192036375f, 0.419316977f},
-std::array<float,2>{0.102993667f, 0.932373464f},
-std::array<float,2>{0.609037697f, 0.299609482f},
-std::array<float,2>{0.900513113f, 0.702271342f},
-std::array<float,2>{0.456480026f, 0.237503991f},
-std::array<float,2>{0.152692944f, 0.655162871f},
-std::array<float,2>{0.69366473f, 0.159704387f},
-std::array<float,2>{0.807033956f, 0.990202785f},
-std::array<float,2>{0.261812866f, 0.367794633f},
-std::array<float,2>{0.388249904f, 0.791594386f},
-std::array<float,2>{0.980101645f, 0.491540223f},
-std::array<float,2>{0.508294344f, 0.527577877f},
-std::array<float,2>{0.0099397786f, 0.0958904698f},
-std::array<float,2>{0.492692947f, 0.742553174f},
-std::array<float,2>{0.935797751f, 0.207571775f},
-std::array<float,2>{0.57380718f, 0.888122916f},
-std::array<float,2>{0.0936377719f, 0.261196971f},
-std::array<float,2>{0.219874725f, 0.848971725f},
-std::array<float,2>{0.679535389f, 0.379303396f},
-std::array<float,2>{0.821693599f, 0.602020562f},
-std::array<float,2>{0.329010487f, 0.0541418791f},
-std::array<float,2>{0.0359012671f, 0.552433908f},
-std::array<float,2>{0.538821518f, 0.0813611895f},
-std::array<float,2>{0.954369545f, 0.769232929f},
-std::array<float,2>{0.436048567f, 0.443402648f},
-std::array<float,2>{0.291687876f, 0.939093292f},
-std::array<float,2>{0.76848799f, 0.342531055f},
-std::array<float,2>{0.737640083f, 0.67209512f},
-std::array<float,2>{0.165659338f, 0.138847455f},
-std::array<float,2>{0.467476875f, 0.601225615f},
-std::array<float,2>{0.893353224f, 0.0574112833f},
-std::array<float,2>{0.598990738f, 0.85341078f},
-std::array<float,2>{0.0984447822f, 0.382859796f},
-std::array<float,2>{0.200747862f, 0.879331887f},
-std::array<float,2>{0.652671337f, 0.255108327f},
-std::array<float,2>{0.845549405f, 0.734954059f},
-std::array<float,2>{0.367139578f, 0.211162031f},
-std::array<float,2>{0.00313525554f, 0.680941582f},
-std::array<float,2>{0.500166416f, 0.132522374f},
-std::array<float,2>{0.975037575f, 0.951310337f},
-std::array<float,2>{0.377845675f, 0.333123356f},
-std::array<float,2>{0.254051685f, 0.781104445f},
-std::array<float,2>{0.798670113f, 0.44937247f},
-std::array<float,2>{0.696128309f, 0.558594763f},
-std::array<float,2>{0.146470532f, 0.0890380889f},
-std::array<float,2>{0.337654769f, 0.69307667f},
-std::array<float,2>{0.814186811f, 0.249351397f},
-std::array<float,2>{0.686864734f, 0.92617625f},
-std::array<float,2>{0.230868831f, 0.304786354f},
-std::array<float,2>{0.0786505565f, 0.831776381f},
-std::array<float,2>{0.564931333f, 0.411375254f},
-std::array<float,2>{0.924849331f, 0.59002769f},
-std::array<float,2>{0.488889575f, 0.0133065181f},
-std::array<float,2>{0.16167064f, 0.515856326f},
-std::array<float,2>{0.748972416f, 0.109101191f},
-std::array<float,2>{0.773494959f, 0.78747946f},
-std::array<float,2>{0.287614733f, 0.49419108f},
-std::array<float,2>{0.427095592f, 0.992230654f},
-std::array<float,2>{0.96445924f, 0.364411354f},
-std::array<float,2>{0.545541883f, 0.643775523f},
-std::array<float,2>{0.0429260321f, 0.168959886f},
-std::array<float,2>{0.305122912f, 0.544009805f},
-std::array<float,2>{0.762903929f, 0.0684122369f},
-std::array<float,2>{0.722688258f, 0.755568385f},
-std::array<float,2>{0.182348952f, 0.455453813f},
-std::array<float,2>{0.0592275485f, 0.95663631f},
-std::array<float,2>{0.558643997f, 0.313258559f},
-std::array<float,2>{0.939664423f, 0.670941114f},
-std::array<float,2>{0.406500399f, 0.148985043f},
-std::array<float,2>{0.248007059f, 0.719489336f},
-std::array<float,2>{0.66521883f, 0.194290355f},
-std::array<float,2>{0.842010915f, 0.905971289f},
-std::array<float,2>{0.313452542f, 0.268643439f},
-std::array<float,2>{0.470254153f, 0.867805719f},
-std::array<float,2>{0.913319528f, 0.402180016f},
-std::array<float,2>{0.581294417f, 0.610001028f},
-std::array<float,2>{0.0764690712f, 0.0372884236f},
-std::array<float,2>{0.405641258f, 0.625021636f},
-std::array<float,2>{0.986438572f, 0.173387319f},
-std::array<float,2>{0.530432403f, 0.97533083f},
-std::array<float,2>{0.0246626213f, 0.357679725f},
-std::array<float,2>{0.139339864f, 0.812198341f},
-std::array<float,2>{0.703294694f, 0.472250104f},
-std::array<float,2>{0.785757422f, 0.503801227f},
-std::array<float,2>{0.280303717f, 0.118575819f},
-std::array<float,2>{0.11455211f, 0.577174246f},
-std::array<float,2>{0.621392787f, 0.0270703882f},
-std::array<float,2>{0.887185812f, 0.81250906f},
-std::array<float,2>{0.444063783f, 0.423236102f},
-std::array<float,2>{0.351922333f, 0.918816209f},
-std::array<float,2>{0.87003231f, 0.287758082f},
-std::array<float,2>{0.62666446f, 0.706594646f},
-std::array<float,2>{0.211469859f, 0.221729308f},
-std::array<float,2>{0.423100621f, 0.620193481f},
-std::array<float,2>{0.966789901f, 0.0406994373f},
-std::array<float,2>{0.542720079f, 0.865616202f},
-std::array<float,2>{0.0458456613f, 0.392595023f},
-std::array<float,2>{0.158048302f, 0.894222617f},
-std::array<float,2>{0.742655396f, 0.281209469f},
-std::array<float,2>{0.779545605f, 0.731008351f},
-std::array<float,2>{0.28485924f, 0.197690502f},
-std::array<float,2>{0.0854949802f, 0.661527753f},
-std::array<float,2>{0.567596495f, 0.141314074f},
-std::array<float,2>{0.927952707f, 0.965233564f},
-std::array<float,2>{0.48580876f, 0.327368468f},
-std::array<float,2>{0.340245515f, 0.760398448f},
-std::array<float,2>{0.816975474f, 0.464824945f},
-std::array<float,2>{0.681882977f, 0.534300447f},
-std::array<float,2>{0.227630034f, 0.0731696412f},
-std::array<float,2>{0.251418918f, 0.712353766f},
-std::array<float,2>{0.803002179f, 0.233950019f},
-std::array<float,2>{0.700017273f, 0.906821489f},
-std::array<float,2>{0.143266633f, 0.291614771f},
-std::array<float,2>{0.0070168958f, 0.826550961f},
-std::array<float,2>{0.504223168f, 0.430014849f},
-std::array<float,2>{0.97208637f, 0.563981354f},
-std::array<float,2>{0.381016046f, 0.0198793206f},
-std::array<float,2>{0.197037295f, 0.514330626f},
-std::array<float,2>{0.651633263f, 0.111068182f},
-std::array<float,2>{0.849469662f, 0.801290095f},
-std::array<float,2>{0.363220155f, 0.482537419f},
-std::array<float,2>{0.462927401f, 0.976775467f},
-std::array<float,2>{0.895352602f, 0.350192606f},
-std::array<float,2>{0.596368849f, 0.640292525f},
-std::array<float,2>{0.0972238705f, 0.185277134f},
-std::array<float,2>{0.3571724f, 0.549810648f},
-std::array<float,2>{0.873706341f, 0.0843070671f},
-std::array<float,2>{0.629808366f, 0.771076202f},
-std::array<float,2>{0.216132849f, 0.438431263f},
-std::array<float,2>{0.110575818f, 0.941573858f},
-std::array<float,2>{0.617611289f, 0.336156905f},
-std::array<float,2>{0.885246277f, 0.676959872f},
-std::array<float,2>{0.440945506f, 0.134244576f},
-std::array<float,2>{0.134792626f, 0.746283233f},
-std::array<float,2>{0.710442901f, 0.206946924f},
-std::array<float,2>{0.782105029f, 0.886179388f},
-std::array<float,2>{0.277166426f, 0.262468576f},
-std::array<float,2>{0.401929021f, 0.846694827f},
-std::array<float,2>{0.990522385f, 0.375811309f},
-std::array<float,2>{0.525329173f, 0.606455326f},
-std::array<float,2>{0.0289485473f, 0.0501258671f},
-std::array<float,2>{0.476513386f, 0.649364769f},
-std::array<float,2>{0.908888757f, 0.160812378f},
-std::array<float,2>{0.583573878f, 0.985123634f},
-std::array<float,2>{0.0717718899f, 0.372639477f},
-std::array<float,2>{0.242216036f, 0.79313612f},
-std::array<float,2>{0.671352923f, 0.486587703f},
-std::array<float,2>{0.837718844f, 0.526769161f},
-std::array<float,2>{0.317229688f, 0.0986662209f},
-std::array<float,2>{0.0568040833f, 0.578415573f},
-std::array<float,2>{0.556100607f, 0.00433515804f},
-std::array<float,2>{0.944364786f, 0.83620733f},
-std::array<float,2>{0.412759572f, 0.417527705f},
-std::array<float,2>{0.308645427f, 0.936162651f},
-std::array<float,2>{0.758166492f, 0.30138433f},
-std::array<float,2>{0.72104609f, 0.695326149f},
-std::array<float,2>{0.184097126f, 0.241175875f},
-std::array<float,2>{0.448343158f, 0.520640671f},
-std::array<float,2>{0.877112627f, 0.10201551f},
-std::array<float,2>{0.613301635f, 0.784337163f},
-std::array<float,2>{0.122827299f, 0.496370047f},
-std::array<float,2>{0.20658423f, 0.998123825f},
-std::array<float,2>{0.635602117f, 0.36218676f},
-std::array<float,2>{0.860257745f, 0.646782637f},
-std::array<float,2>{0.35027498f, 0.166441262f},
-std::array<float,2>{0.0164790098f, 0.690257013f},
-std::array<float,2>{0.520917296f, 0.243375733f},
-std::array<float,2>{0.993398309f, 0.922976613f},
-std::array<float,2>{0.39479962f, 0.309470177f},
-std::array<float,2>{0.271429777f, 0.834974885f},
-std::array<float,2>{0.796819031f, 0.408090025f},
-std::array<float,2>{0.711740971f, 0.588126659f},
-std::array<float,2>{0.128962696f, 0.00942051597f},
-std::array<float,2>{0.32261014f, 0.685277939f},
-std::array<float,2>{0.835243225f, 0.128887132f},
-std::array<float,2>{0.65889889f, 0.947301209f},
-std::array<float,2>{0.240253195f, 0.329899162f},
-std::array<float,2>{0.0697305351f, 0.775515139f},
-std::array<float,2>{0.587372005f, 0.44858107f},
-std::array<float,2>{0.91625607f, 0.557462752f},
-std::array<float,2>{0.481628627f, 0.0927103758f},
-std::array<float,2>{0.173592672f, 0.596989632f},
-std::array<float,2>{0.727145255f, 0.0606006682f},
-std::array<float,2>{0.75328505f, 0.856609702f},
-std::array<float,2>{0.301434606f, 0.389363438f},
-std::array<float,2>{0.417752057f, 0.878657162f},
-std::array<float,2>{0.947575092f, 0.250528872f},
-std::array<float,2>{0.553938627f, 0.738876224f},
-std::array<float,2>{0.0483727008f, 0.215444565f},
-std::array<float,2>{0.2956523f, 0.570323229f},
-std::array<float,2>{0.770899057f, 0.0282087363f},
-std::array<float,2>{0.741913021f, 0.818394601f},
-std::array<float,2>{0.170101836f, 0.427099138f},
-std::array<float,2>{0.033189062f, 0.915691257f},
-std::array<float,2>{0.534194231f, 0.284011811f},
-std::array<float,2>{0.960329711f, 0.710844576f},
-std::array<float,2>{0.432786405f, 0.224801704f},
-std::array<float,2>{0.226444587f, 0.632126927f},
-std::array<float,2>{0.67251426f, 0.177192315f},
-std::array<float,2>{0.825939059f, 0.971990943f},
-std::array<float,2>{0.33249858f, 0.353355676f},
-std::array<float,2>{0.499829322f, 0.805917621f},
-std::array<float,2>{0.929848552f, 0.473271579f},
-std::array<float,2>{0.576135457f, 0.505771458f},
-std::array<float,2>{0.0897270888f, 0.121187016f},
-std::array<float,2>{0.383315384f, 0.725579977f},
-std::array<float,2>{0.984095812f, 0.190586001f},
-std::array<float,2>{0.514057696f, 0.901100278f},
-std::array<float,2>{0.015043905f, 0.273092359f},
-std::array<float,2>{0.1503544f, 0.873681664f},
-std::array<float,2>{0.687681139f, 0.405466437f},
-std::array<float,2>{0.811828136f, 0.613581657f},
-std::array<float,2>{0.258370459f, 0.0313877538f},
-std::array<float,2>{0.106522791f, 0.542810559f},
-std::array<float,2>{0.603095531f, 0.0644064173f},
-std::array<float,2>{0.903987288f, 0.752923369f},
-std::array<float,2>{0.458477944f, 0.458791435f},
-std::array<float,2>{0.367952466f, 0.960426807f},
-std::array<float,2>{0.858508408f, 0.3200216f},
-std::array<float,2>{0.644036531f, 0.665852368f},
-std::array<float,2>{0.190592453f, 0.152550727f},
-std::array<float,2>{0.391833752f, 0.537293077f},
-std::array<float,2>{0.996584833f, 0.0749626309f},
-std::array<float,2>{0.518254578f, 0.762978017f},
-std::array<float,2>{0.0206729323f, 0.467637479f},
-std::array<float,2>{0.126472771f, 0.963548958f},
-std::array<float,2>{0.715416491f, 0.320654839f},
-std::array<float,2>{0.790855646f, 0.657242835f},
-std::array<float,2>{0.268444151f, 0.144622043f},
-std::array<float,2>{0.120215632f, 0.728740931f},
-std::array<float,2>{0.611611187f, 0.199951842f},
-std::array<float,2>{0.879002035f, 0.895080984f},
-std::array<float,2>{0.449600101f, 0.274780691f},
-std::array<float,2>{0.343868226f, 0.863032281f},
-std::array<float,2>{0.864977002f, 0.396581262f},
-std::array<float,2>{0.637100697f, 0.621598303f},
-std::array<float,2>{0.207134977f, 0.0455261953f},
-std::array<float,2>{0.30036518f, 0.634734392f},
-std::array<float,2>{0.756770849f, 0.181549385f},
-std::array<float,2>{0.730737209f, 0.984058797f},
-std::array<float,2>{0.176182851f, 0.345169395f},
-std::array<float,2>{0.0518164039f, 0.797349393f},
-std::array<float,2>{0.550575733f, 0.480008125f},
-std::array<float,2>{0.949392617f, 0.510349214f},
-std::array<float,2>{0.419550925f, 0.116938546f},
-std::array<float,2>{0.236967713f, 0.56961143f},
-std::array<float,2>{0.663955688f, 0.0170964282f},
-std::array<float,2>{0.831049204f, 0.822363079f},
-std::array<float,2>{0.328036487f, 0.433935374f},
-std::array<float,2>{0.477388531f, 0.910834014f},
-std::array<float,2>{0.918006718f, 0.29297632f},
-std::array<float,2>{0.590583146f, 0.716335654f},
-std::array<float,2>{0.0640324503f, 0.229102492f},
-std::array<float,2>{0.331206322f, 0.60505265f},
-std::array<float,2>{0.823218584f, 0.0524791032f},
-std::array<float,2>{0.675823212f, 0.850569963f},
-std::array<float,2>{0.221254319f, 0.381145746f},
-std::array<float,2>{0.089864701f, 0.890472472f},
-std::array<float,2>{0.570608795f, 0.259463131f},
-std::array<float,2>{0.934407473f, 0.7458781f},
-std::array<float,2>{0.495629251f, 0.210276395f},
-std::array<float,2>{0.16610609f, 0.673963785f},
-std::array<float,2>{0.734388828f, 0.137082487f},
-std::array<float,2>{0.767041087f, 0.940927744f},
-std::array<float,2>{0.289284199f, 0.341028512f},
-std::array<float,2>{0.434036613f, 0.766891718f},
-std::array<float,2>{0.956623733f, 0.442697346f},
-std::array<float,2>{0.535732925f, 0.553489149f},
-std::array<float,2>{0.038574934f, 0.078295283f},
-std::array<float,2>{0.454513133f, 0.699954867f},
-std::array<float,2>{0.899916232f, 0.23543036f},
-std::array<float,2>{0.60682404f, 0.930856645f},
-std::array<float,2>{0.104888469f, 0.298060387f},
-std::array<float,2>{0.193815947f, 0.841255486f},
-std::array<float,2>{0.646161258f, 0.42091921f},
-std::array<float,2>{0.853334308f, 0.582317352f},
-std::array<float,2>{0.37271139f, 0.00121849088f},
-std::array<float,2>{0.00885722227f, 0.529408932f},
-std::array<float,2>{0.510313451f, 0.0953819826f},
-std::array<float,2>{0.978056729f, 0.789972305f},
-std::array<float,2>{0.390457541f, 0.488915354f},
-std::array<float,2>{0.264659286f, 0.991941035f},
-std::array<float,2>{0.806080878f, 0.369884372f},
-std::array<float,2>{0.691896379f, 0.652601182f},
-std::array<float,2>{0.155946776f, 0.157237336f},
-std::array<float,2>{0.491229117f, 0.593175948f},
-std::array<float,2>{0.921946466f, 0.0154729551f},
-std::array<float,2>{0.562934637f, 0.828572214f},
-std::array<float,2>{0.080160886f, 0.413909584f},
-std::array<float,2>{0.232713029f, 0.928474069f},
-std::array<float,2>{0.685391486f, 0.306688607f},
-std::array<float,2>{0.814731419f, 0.694634557f},
-std::array<float,2>{0.338992834f, 0.246867105f},
-std::array<float,2>{0.0399510041f, 0.641164005f},
-std::array<float,2>{0.543373585f, 0.170759439f},
-std::array<float,2>{0.962566376f, 0.994815946f},
-std::array<float,2>{0.428501397f, 0.366517901f},
-std::array<float,2>{0.285792351f, 0.785705984f},
-std::array<float,2>{0.776270688f, 0.494077861f},
-std::array<float,2>{0.746802509f, 0.518672764f},
-std::array<float,2>{0.162991479f, 0.106710494f},
-std::array<float,2>{0.364910781f, 0.737622201f},
-std::array<float,2>{0.845850348f, 0.214372694f},
-std::array<float,2>{0.656070471f, 0.881040335f},
-std::array<float,2>{0.20172359f, 0.256516308f},
-std::array<float,2>{0.100980714f, 0.854216576f},
-std::array<float,2>{0.600635171f, 0.385498673f},
-std::array<float,2>{0.892204821f, 0.598418891f},
-std::array<float,2>{0.465367734f, 0.0552894101f},
-std::array<float,2>{0.147205204f, 0.56079191f},
-std::array<float,2>{0.698686182f, 0.0871952474f},
-std::array<float,2>{0.798969567f, 0.779273033f},
-std::array<float,2>{0.256855756f, 0.452594578f},
-std::array<float,2>{0.3750512f, 0.950244188f},
-std::array<float,2>{0.973162711f, 0.334140837f},
-std::array<float,2>{0.503117085f, 0.683064997f},
-std::array<float,2>{0.00134161895f, 0.130471841f},
-std::array<float,2>{0.277528763f, 0.501025438f},
-std::array<float,2>{0.789041519f, 0.119564921f},
-std::array<float,2>{0.706347406f, 0.810176611f},
-std::array<float,2>{0.137065887f, 0.470274746f},
-std::array<float,2>{0.0270690192f, 0.973901033f},
-std::array<float,2>{0.527565539f, 0.356231481f},
-std::array<float,2>{0.984889984f, 0.626974821f},
-std::array<float,2>{0.404146284f, 0.174439549f},
-std::array<float,2>{0.213736326f, 0.705075264f},
-std::array<float,2>{0.626990795f, 0.219491452f},
-std::array<float,2>{0.868156433f, 0.920671701f},
-std::array<float,2>{0.353784263f, 0.286752105f},
-std::array<float,2>{0.441700935f, 0.815002501f},
-std::array<float,2>{0.888866246f, 0.424635917f},
-std::array<float,2>{0.62386024f, 0.576111615f},
-std::array<float,2>{0.115763918f, 0.0243107732f},
-std::array<float,2>{0.409779787f, 0.668921292f},
-std::array<float,2>{0.938326478f, 0.150728032f},
-std::array<float,2>{0.562059283f, 0.954900324f},
-std::array<float,2>{0.0621296242f, 0.31477958f},
-std::array<float,2>{0.180548832f, 0.757507741f},
-std::array<float,2>{0.724656403f, 0.453907669f},
-std::array<float,2>{0.764884651f, 0.545569897f},
-std::array<float,2>{0.307349682f, 0.0670011491f},
-std::array<float,2>{0.075273931f, 0.612185538f},
-std::array<float,2>{0.579706371f, 0.0358962305f},
-std::array<float,2>{0.911261082f, 0.869540036f},
-std::array<float,2>{0.471657366f, 0.399191737f},
-std::array<float,2>{0.314696252f, 0.903626978f},
-std::array<float,2>{0.840542853f, 0.266013592f},
-std::array<float,2>{0.667490721f, 0.722092569f},
-std::array<float,2>{0.248997509f, 0.19239682f},
-std::array<float,2>{0.377602786f, 0.598960221f},
-std::array<float,2>{0.974682689f, 0.0558993407f},
-std::array<float,2>{0.500328183f, 0.854692519f},
-std::array<float,2>{0.00339026004f, 0.386366338f},
-std::array<float,2>{0.146226466f, 0.882228911f},
-std::array<float,2>{0.695923328f, 0.257475644f},
-std::array<float,2>{0.798401117f, 0.736805081f},
-std::array<float,2>{0.254359692f, 0.213285774f},
-std::array<float,2>{0.0981644988f, 0.682232141f},
-std::array<float,2>{0.598802924f, 0.129022852f},
-std::array<float,2>{0.893133223f, 0.949694514f},
-std::array<float,2>{0.467616647f, 0.335254252f},
-std::array<float,2>{0.366847128f, 0.777542055f},
-std::array<float,2>{0.845291138f, 0.451569974f},
-std::array<float,2>{0.652359605f, 0.561656892f},
-std::array<float,2>{0.200966984f, 0.0864709318f},
-std::array<float,2>{0.287941605f, 0.69394511f},
-std::array<float,2>{0.773775041f, 0.247302189f},
-std::array<float,2>{0.748730361f, 0.92948103f},
-std::array<float,2>{0.16203478f, 0.30836165f},
-std::array<float,2>{0.0425678156f, 0.829573989f},
-std::array<float,2>{0.54584527f, 0.41218251f},
-std::array<float,2>{0.964720249f, 0.592471361f},
-std::array<float,2>{0.426845074f, 0.0143414671f},
-std::array<float,2>{0.230661958f, 0.517863572f},
-std::array<float,2>{0.686705887f, 0.105847932f},
-std::array<float,2>{0.81435746f, 0.787072241f},
-std::array<float,2>{0.337598175f, 0.492187589f},
-std::array<float,2>{0.489204705f, 0.995710373f},
-std::array<float,2>{0.925051808f, 0.365929693f},
-std::array<float,2>{0.564558029f, 0.642144024f},
-std::array<float,2>{0.0790079758f, 0.171126604f},
-std::array<float,2>{0.313221723f, 0.546768904f},
-std::array<float,2>{0.842239439f, 0.0679756775f},
-std::array<float,2>{0.665409029f, 0.756110728f},
-std::array<float,2>{0.247774526f, 0.454910189f},
-std::array<float,2>{0.0763695091f, 0.953667581f},
-std::array<float,2>{0.581350744f, 0.316040426f},
-std::array<float,2>{0.913364708f, 0.66915077f},
-std::array<float,2>{0.470560014f, 0.151815996f},
-std::array<float,2>{0.182476297f, 0.721618414f},
-std::array<float,2>{0.722910285f, 0.191887289f},
-std::array<float,2>{0.763095558f, 0.90245533f},
-std::array<float,2>{0.304788202f, 0.266837656f},
-std::array<float,2>{0.406350583f, 0.870561838f},
-std::array<float,2>{0.939827621f, 0.399577439f},
-std::array<float,2>{0.559073746f, 0.612843394f},
-std::array<float,2>{0.0593301132f, 0.0367699079f},
-std::array<float,2>{0.444282532f, 0.628277242f},
-std::array<float,2>{0.886957586f, 0.17499575f},
-std::array<float,2>{0.621150076f, 0.972713292f},
-std::array<float,2>{0.114266157f, 0.356536895f},
-std::array<float,2>{0.211697295f, 0.808852315f},
-std::array<float,2>{0.62678498f, 0.46965906f},
-std::array<float,2>{0.869719625f, 0.500563145f},
-std::array<float,2>{0.351646781f, 0.12032073f},
-std::array<float,2>{0.024523763f, 0.574471951f},
-std::array<float,2>{0.530675769f, 0.024969371f},
-std::array<float,2>{0.986782193f, 0.816169322f},
-std::array<float,2>{0.405309737f, 0.425095975f},
-std::array<float,2>{0.280682743f, 0.921506763f},
-std::array<float,2>{0.786053717f, 0.285390735f},
-std::array<float,2>{0.703522503f, 0.703852177f},
-std::array<float,2>{0.139485583f, 0.219997451f},
-std::array<float,2>{0.480177134f, 0.511324465f},
-std::array<float,2>{0.920260608f, 0.115421347f},
-std::array<float,2>{0.59359479f, 0.798716605f},
-std::array<float,2>{0.0651097074f, 0.478964627f},
-std::array<float,2>{0.236243993f, 0.982775807f},
-std::array<float,2>{0.661760986f, 0.34409371f},
-std::array<float,2>{0.830002248f, 0.633474469f},
-std::array<float,2>{0.326056451f, 0.179999277f},
-std::array<float,2>{0.054246556f, 0.715587974f},
-std::array<float,2>{0.547855079f, 0.230454102f},
-std::array<float,2>{0.952241898f, 0.911625743f},
-std::array<float,2>{0.421650171f, 0.29478997f},
-std::array<float,2>{0.29712218f, 0.823764861f},
-std::array<float,2>{0.755423784f, 0.435317725f},
-std::array<float,2>{0.733604252f, 0.568630934f},
-std::array<float,2>{0.178748921f, 0.0159056913f},
-std::array<float,2>{0.346837997f, 0.656661808f},
-std::array<float,2>{0.865878999f, 0.146288276f},
-std::array<float,2>{0.639007688f, 0.964636862f},
-std::array<float,2>{0.210537523f, 0.321417689f},
-std::array<float,2>{0.117495447f, 0.762615502f},
-std::array<float,2>{0.611111879f, 0.468112111f},
-std::array<float,2>{0.882794201f, 0.538355768f},
-std::array<float,2>{0.451965243f, 0.0761424303f},
-std::array<float,2>{0.128786504f, 0.62249881f},
-std::array<float,2>{0.717253149f, 0.0459964871f},
-std::array<float,2>{0.791159868f, 0.86174047f},
-std::array<float,2>{0.266747236f, 0.398129582f},
-std::array<float,2>{0.392660856f, 0.895983994f},
-std::array<float,2>{0.999668539f, 0.273533911f},
-std::array<float,2>{0.517508209f, 0.729569197f},
-std::array<float,2>{0.0233788863f, 0.200455129f},
-std::array<float,2>{0.262081444f, 0.583896697f},
-std::array<float,2>{0.806741059f, 0.000425345788f},
-std::array<float,2>{0.693392575f, 0.840040982f},
-std::array<float,2>{0.152455792f, 0.420458794f},
-std::array<float,2>{0.0102141667f, 0.930536926f},
-std::array<float,2>{0.507953048f, 0.297451109f},
-std::array<float,2>{0.980388105f, 0.700260222f},
-std::array<float,2>{0.388434738f, 0.235260427f},
-std::array<float,2>{0.192326829f, 0.654162407f},
-std::array<float,2>{0.646606565f, 0.156645283f},
-std::array<float,2>{0.85368973f, 0.99037987f},
-std::array<float,2>{0.373457283f, 0.370382547f},
-std::array<float,2>{0.45626241f, 0.790886045f},
-std::array<float,2>{0.900867522f, 0.489391416f},
-std::array<float,2>{0.609266341f, 0.531158924f},
-std::array<float,2>{0.102598019f, 0.0939079747f},
-std::array<float,2>{0.436444819f, 0.744854391f},
-std::array<float,2>{0.954184949f, 0.20928961f},
-std::array<float,2>{0.538653553f, 0.888919175f},
-std::array<float,2>{0.0357117914f, 0.258613229f},
-std::array<float,2>{0.165921792f, 0.851473749f},
-std::array<float,2>{0.737541616f, 0.382065266f},
-std::array<float,2>{0.768243849f, 0.6039958f},
-std::array<float,2>{0.291751504f, 0.0514997877f},
-std::array<float,2>{0.093400754f, 0.554158032f},
-std::array<float,2>{0.57411164f, 0.0796392858f},
-std::array<float,2>{0.935686886f, 0.765941978f},
-std::array<float,2>{0.493036747f, 0.441799551f},
-std::array<float,2>{0.328745186f, 0.939863205f},
-std::array<float,2>{0.821383178f, 0.340557843f},
-std::array<float,2>{0.679380953f, 0.674977243f},
-std::array<float,2>{0.220095292f, 0.138060033f},
-std::array<float,2>{0.415266633f, 0.55801338f},
-std::array<float,2>{0.946614802f, 0.0933364853f},
-std::array<float,2>{0.552071929f, 0.776916444f},
-std::array<float,2>{0.0497174375f, 0.4477579f},
-std::array<float,2>{0.174747303f, 0.948571444f},
-std::array<float,2>{0.72951144f, 0.328981072f},
-std::array<float,2>{0.751230776f, 0.683866143f},
-std::array<float,2>{0.303641558f, 0.127492294f},
-std::array<float,2>{0.0664923489f, 0.73995018f},
-std::array<float,2>{0.588547111f, 0.215897113f},
-std::array<float,2>{0.914875627f, 0.877625227f},
-std::array<float,2>{0.483814359f, 0.251166403f},
-std::array<float,2>{0.320441902f, 0.856222689f},
-std::array<float,2>{0.832286537f, 0.390303701f},
-std::array<float,2>{0.656328201f, 0.596401334f},
-std::array<float,2>{0.239883497f, 0.0620271191f},
-std::array<float,2>{0.271567196f, 0.648242056f},
-std::array<float,2>{0.793883026f, 0.167715564f},
-std::array<float,2>{0.713939667f, 0.999855995f},
-std::array<float,2>{0.131428227f, 0.362792641f},
-std::array<float,2>{0.0182599816f, 0.783851683f},
-std::array<float,2>{0.522771597f, 0.497428983f},
-std::array<float,2>{0.994578779f, 0.520101607f},
-std::array<float,2>{0.397364169f, 0.103485331f},
-std::array<float,2>{0.204369709f, 0.589669585f},
-std::array<float,2>{0.634169459f, 0.00805172231f},
-std::array<float,2>{0.861679494f, 0.834455848f},
-std::array<float,2>{0.348583549f, 0.406720638f},
-std::array<float,2>{0.447260767f, 0.922380447f},
-std::array<float,2>{0.876463532f, 0.309694648f},
-std::array<float,2>{0.615908921f, 0.690590978f},
-std::array<float,2>{0.123787098f, 0.242351815f},
-std::array<float,2>{0.36939916f, 0.615082562f},
-std::array<float,2>{0.856327474f, 0.0331319496f},
-std::array<float,2>{0.642051995f, 0.87443763f},
-std::array<float,2>{0.189435571f, 0.404547811f},
-std::array<float,2>{0.107951626f, 0.902015746f},
-std::array<float,2>{0.604216397f, 0.271779537f},
-std::array<float,2>{0.905147731f, 0.725670815f},
-std::array<float,2>{0.459646612f, 0.189664125f},
-std::array<float,2>{0.151526928f, 0.664537787f},
-std::array<float,2>{0.690858245f, 0.153452009f},
-std::array<float,2>{0.810385764f, 0.959214151f},
-std::array<float,2>{0.261640191f, 0.318662763f},
-std::array<float,2>{0.384822935f, 0.753321469f},
-std::array<float,2>{0.980631471f, 0.45788902f},
-std::array<float,2>{0.513611197f, 0.541190028f},
-std::array<float,2>{0.0135200815f, 0.0631052256f},
-std::array<float,2>{0.4968234f, 0.709726453f},
-std::array<float,2>{0.931667924f, 0.22578004f},
-std::array<float,2>{0.576463163f, 0.914611459f},
-std::array<float,2>{0.0878700465f, 0.284426421f},
-std::array<float,2>{0.224275962f, 0.820047319f},
-std::array<float,2>{0.67389828f, 0.425895363f},
-std::array<float,2>{0.827511072f, 0.571751058f},
-std::array<float,2>{0.335745841f, 0.0284991991f},
-std::array<float,2>{0.0334318317f, 0.504288852f},
-std::array<float,2>{0.53296572f, 0.122491501f},
-std::array<float,2>{0.958958149f, 0.804928064f},
-std::array<float,2>{0.430702001f, 0.473699003f},
-std::array<float,2>{0.293360323f, 0.971649945f},
-std::array<float,2>{0.77278775f, 0.351721883f},
-std::array<float,2>{0.739373446f, 0.631476939f},
-std::array<float,2>{0.168213546f, 0.176744729f},
-std::array<float,2>{0.461000562f, 0.563444793f},
-std::array<float,2>{0.8970294f, 0.0208367091f},
-std::array<float,2>{0.594373286f, 0.828096807f},
-std::array<float,2>{0.0950042158f, 0.431477278f},
-std::array<float,2>{0.197939053f, 0.908197165f},
-std::array<float,2>{0.648623347f, 0.29266715f},
-std::array<float,2>{0.849715292f, 0.711153567f},
-std::array<float,2>{0.361143738f, 0.233136877f},
-std::array<float,2>{0.00467861537f, 0.639455318f},
-std::array<float,2>{0.506855667f, 0.183668211f},
-std::array<float,2>{0.968751252f, 0.978278756f},
-std::array<float,2>{0.380777299f, 0.350862592f},
-std::array<float,2>{0.251969755f, 0.801842809f},
-std::array<float,2>{0.801320493f, 0.484096706f},
-std::array<float,2>{0.70156157f, 0.51524806f},
-std::array<float,2>{0.142139271f, 0.110294692f},
-std::array<float,2>{0.343467683f, 0.731735587f},
-std::array<float,2>{0.818561852f, 0.199134603f},
-std::array<float,2>{0.680415094f, 0.893043578f},
-std::array<float,2>{0.228586376f, 0.279859424f},
-std::array<float,2>{0.0831621885f, 0.867134571f},
-std::array<float,2>{0.568627834f, 0.393763036f},
-std::array<float,2>{0.926429629f, 0.619997382f},
-std::array<float,2>{0.487644702f, 0.0398362279f},
-std::array<float,2>{0.158590496f, 0.533709109f},
-std::array<float,2>{0.745655537f, 0.0735856071f},
-std::array<float,2>{0.77820462f, 0.760805905f},
-std::array<float,2>{0.282409072f, 0.463059604f},
-std::array<float,2>{0.424106777f, 0.96641916f},
-std::array<float,2>{0.968532205f, 0.326515406f},
-std::array<float,2>{0.540533602f, 0.660290122f},
-std::array<float,2>{0.0443350635f, 0.142573163f},
-std::array<float,2>{0.31074962f, 0.5257743f},
-std::array<float,2>{0.761048973f, 0.0980543494f},
-std::array<float,2>{0.71992588f, 0.794419765f},
-std::array<float,2>{0.187144011f, 0.488135189f},
-std::array<float,2>{0.0561625883f, 0.986027598f},
-std::array<float,2>{0.558315933f, 0.371612966f},
-std::array<float,2>{0.941967607f, 0.650203586f},
-std::array<float,2>{0.410455406f, 0.161632508f},
-std::array<float,2>{0.244867727f, 0.697130919f},
-std::array<float,2>{0.669040084f, 0.242048115f},
-std::array<float,2>{0.838396788f, 0.936568439f},
-std::array<float,2>{0.320014805f, 0.302092165f},
-std::array<float,2>{0.473812252f, 0.837124109f},
-std::array<float,2>{0.907669723f, 0.416912019f},
-std::array<float,2>{0.584668875f, 0.579528689f},
-std::array<float,2>{0.0730777234f, 0.00532204285f},
-std::array<float,2>{0.399093628f, 0.6761024f},
-std::array<float,2>{0.98942709f, 0.132830635f},
-std::array<float,2>{0.52714771f, 0.942506611f},
-std::array<float,2>{0.0301310532f, 0.337052017f},
-std::array<float,2>{0.134021968f, 0.770067155f},
-std::array<float,2>{0.707833827f, 0.439281762f},
-std::array<float,2>{0.784685433f, 0.549300313f},
-std::array<float,2>{0.274437636f, 0.0857017189f},
-std::array<float,2>{0.111813247f, 0.606148124f},
-std::array<float,2>{0.621092796f, 0.0495207682f},
-std::array<float,2>{0.88455373f, 0.84591347f},
-std::array<float,2>{0.438026816f, 0.376567572f},
-std::array<float,2>{0.358826667f, 0.884912789f},
-std::array<float,2>{0.872355223f, 0.263418645f},
-std::array<float,2>{0.632140815f, 0.747302592f},
-std::array<float,2>{0.217361629f, 0.205633208f},
-std::array<float,2>{0.428275585f, 0.590971828f},
-std::array<float,2>{0.9627918f, 0.0118046431f},
-std::array<float,2>{0.543193877f, 0.830732882f},
-std::array<float,2>{0.0397768542f, 0.411068588f},
-std::array<float,2>{0.162727162f, 0.927237332f},
-std::array<float,2>{0.747040331f, 0.306589097f},
-std::array<float,2>{0.775907338f, 0.692339122f},
-std::array<float,2>{0.285929292f, 0.248473451f},
-std::array<float,2>{0.0803509429f, 0.642916322f},
-std::array<float,2>{0.56261009f, 0.168837696f},
-std::array<float,2>{0.922154725f, 0.993818104f},
-std::array<float,2>{0.491605878f, 0.36357376f},
-std::array<float,2>{0.339125395f, 0.788645923f},
-std::array<float,2>{0.814621687f, 0.49541989f},
-std::array<float,2>{0.685174167f, 0.517353296f},
-std::array<float,2>{0.232496262f, 0.108273335f},
-std::array<float,2>{0.25716278f, 0.735679924f},
-std::array<float,2>{0.799126923f, 0.212346807f},
-std::array<float,2>{0.6982885f, 0.880022109f},
-std::array<float,2>{0.147271857f, 0.254059553f},
-std::array<float,2>{0.00102395925f, 0.851797938f},
-std::array<float,2>{0.50339812f, 0.384754926f},
-std::array<float,2>{0.973433375f, 0.600548267f},
-std::array<float,2>{0.375360221f, 0.0579853766f},
-std::array<float,2>{0.201934442f, 0.559945762f},
-std::array<float,2>{0.655881941f, 0.0886202455f},
-std::array<float,2>{0.846024215f, 0.779789448f},
-std::array<float,2>{0.365069926f, 0.450469732f},
-std::array<float,2>{0.465662956f, 0.952628434f},
-std::array<float,2>{0.892363489f, 0.332853109f},
-std::array<float,2>{0.601071119f, 0.680007577f},
-std::array<float,2>{0.100632586f, 0.131450534f},
-std::array<float,2>{0.353751451f, 0.501996696f},
-std::array<float,2>{0.867866158f, 0.1180024f},
-std::array<float,2>{0.627421081f, 0.811319232f},
-std::array<float,2>{0.213438883f, 0.471486866f},
-std::array<float,2>{0.116013132f, 0.976488531f},
-std::array<float,2>{0.62374711f, 0.358505666f},
-std::array<float,2>{0.889104009f, 0.626397133f},
-std::array<float,2>{0.441590607f, 0.172080144f},
-std::array<float,2>{0.136887237f, 0.70537895f},
-std::array<float,2>{0.706137538f, 0.221025407f},
-std::array<float,2>{0.78876251f, 0.919035435f},
-std::array<float,2>{0.277627319f, 0.288988829f},
-std::array<float,2>{0.403850436f, 0.814069748f},
-std::array<float,2>{0.985114932f, 0.42246142f},
-std::array<float,2>{0.527798712f, 0.576771617f},
-std::array<float,2>{0.027181549f, 0.0262328461f},
-std::array<float,2>{0.471254259f, 0.67088604f},
-std::array<float,2>{0.911420465f, 0.149462387f},
-std::array<float,2>{0.57999146f, 0.956017137f},
-std::array<float,2>{0.0755672231f, 0.314278126f},
-std::array<float,2>{0.248709291f, 0.753935456f},
-std::array<float,2>{0.667733252f, 0.456941664f},
-std::array<float,2>{0.840773702f, 0.543373108f},
-std::array<float,2>{0.314710915f, 0.069897972f},
-std::array<float,2>{0.0623711534f, 0.610831857f},
-std::array<float,2>{0.56236881f, 0.0386008434f},
-std::array<float,2>{0.938037992f, 0.868189931f},
-std::array<float,2>{0.410044491f, 0.401190817f},
-std::array<float,2>{0.307399094f, 0.904672444f},
-std::array<float,2>{0.764995575f, 0.26762554f},
-std::array<float,2>{0.724979401f, 0.720660031f},
-std::array<float,2>{0.180187538f, 0.195193216f},
-std::array<float,2>{0.449297816f, 0.536855638f},
-std::array<float,2>{0.879227161f, 0.0777877569f},
-std::array<float,2>{0.611521602f, 0.763988972f},
-std::array<float,2>{0.120602854f, 0.465665191f},
-std::array<float,2>{0.207465053f, 0.962005258f},
-std::array<float,2>{0.636779487f, 0.324191213f},
-std::array<float,2>{0.865176737f, 0.659939408f},
-std::array<float,2>{0.344011635f, 0.146537915f},
-std::array<float,2>{0.0208079685f, 0.728279293f},
-std::array<float,2>{0.518449128f, 0.202496737f},
-std::array<float,2>{0.996836543f, 0.896747887f},
-std::array<float,2>{0.391861975f, 0.276786417f},
-std::array<float,2>{0.268157303f, 0.860818863f},
-std::array<float,2>{0.790703714f, 0.395547301f},
-std::array<float,2>{0.715686858f, 0.624351442f},
-std::array<float,2>{0.126914248f, 0.0430322625f},
-std::array<float,2>{0.32772541f, 0.636391521f},
-std::array<float,2>{0.830716014f, 0.183431908f},
-std::array<float,2>{0.663744569f, 0.981025577f},
-std::array<float,2>{0.237295195f, 0.345972896f},
-std::array<float,2>{0.0643640757f, 0.800538361f},
-std::array<float,2>{0.590565205f, 0.477937579f},
-std::array<float,2>{0.918279529f, 0.508510232f},
-std::array<float,2>{0.477292478f, 0.113773257f},
-std::array<float,2>{0.175797492f, 0.568127513f},
-std::array<float,2>{0.730706871f, 0.0182990097f},
-std::array<float,2>{0.756573379f, 0.82178688f},
-std::array<float,2>{0.300675243f, 0.43618229f},
-std::array<float,2>{0.419810712f, 0.914028108f},
-std::array<float,2>{0.949522614f, 0.295764387f},
-std::array<float,2>{0.550531983f, 0.717043638f},
-std::array<float,2>{0.0520098023f, 0.226800486f},
-std::array<float,2>{0.289416641f, 0.60321033f},
-std::array<float,2>{0.766777217f, 0.0535238832f},
-std::array<float,2>{0.734682918f, 0.848222911f},
-std::array<float,2>{0.166355342f, 0.379911661f},
-std::array<float,2>{0.0389980413f, 0.887233138f},
-std::array<float,2>{0.535984695f, 0.260532379f},
-std::array<float,2>{0.956949234f, 0.743323565f},
-std::array<float,2>{0.433712423f, 0.208630264f},
-std::array<float,2>{0.221667424f, 0.673303127f},
-std::array<float,2>{0.67625761f, 0.140426427f},
-std::array<float,2>{0.822850943f, 0.93838048f},
-std::array<float,2>{0.331322372f, 0.343621045f},
-std::array<float,2>{0.495858461f, 0.768422008f},
-std::array<float,2>{0.934215426f, 0.444475383f},
-std::array<float,2>{0.570331752f, 0.551036358f},
-std::array<float,2>{0.0902408585f, 0.0807688013f},
-std::array<float,2>{0.390295893f, 0.70117867f},
-std::array<float,2>{0.978433549f, 0.237223864f},
-std::array<float,2>{0.510601044f, 0.933359325f},
-std::array<float,2>{0.0092350347f, 0.300508112f},
-std::array<float,2>{0.156024456f, 0.843069196f},
-std::array<float,2>{0.692288458f, 0.418728173f},
-std::array<float,2>{0.80590111f, 0.585787117f},
-std::array<float,2>{0.265012532f, 0.00252749701f},
-std::array<float,2>{0.104682498f, 0.528879821f},
-std::array<float,2>{0.606611371f, 0.0975276083f},
-std::array<float,2>{0.900241613f, 0.792914748f},
-std::array<float,2>{0.454124212f, 0.490928829f},
-std::array<float,2>{0.372820675f, 0.988308966f},
-std::array<float,2>{0.853250682f, 0.368884861f},
-std::array<float,2>{0.646327198f, 0.656026244f},
-std::array<float,2>{0.193377897f, 0.15849936f},
-std::array<float,2>{0.394566089f, 0.522425056f},
-std::array<float,2>{0.993481636f, 0.104482286f},
-std::array<float,2>{0.520660102f, 0.781618118f},
-std::array<float,2>{0.0161525887f, 0.499491513f},
-std::array<float,2>{0.129343733f, 0.997796178f},
-std::array<float,2>{0.711499572f, 0.359778523f},
-std::array<float,2>{0.796535969f, 0.645316362f},
-std::array<float,2>{0.271025747f, 0.165363371f},
-std::array<float,2>{0.12269637f, 0.68817234f},
-std::array<float,2>{0.613613367f, 0.244796261f},
-std::array<float,2>{0.877426147f, 0.924839497f},
-std::array<float,2>{0.448646128f, 0.311854541f},
-std::array<float,2>{0.350428045f, 0.833153188f},
-std::array<float,2>{0.859881699f, 0.408575296f},
-std::array<float,2>{0.635452271f, 0.587179363f},
-std::array<float,2>{0.206874803f, 0.0115196789f},
-std::array<float,2>{0.301716387f, 0.685745299f},
-std::array<float,2>{0.753053367f, 0.126496226f},
-std::array<float,2>{0.727481246f, 0.945650637f},
-std::array<float,2>{0.173477471f, 0.330281794f},
-std::array<float,2>{0.0486869477f, 0.773588479f},
-std::array<float,2>{0.554094911f, 0.446584553f},
-std::array<float,2>{0.947433114f, 0.556362987f},
-std::array<float,2>{0.417484701f, 0.0910274982f},
-std::array<float,2>{0.240492985f, 0.594129622f},
-std::array<float,2>{0.659036338f, 0.0594936833f},
-std::array<float,2>{0.835193753f, 0.858258307f},
-std::array<float,2>{0.322437763f, 0.38761884f},
-std::array<float,2>{0.481845558f, 0.876036644f},
-std::array<float,2>{0.916475713f, 0.252424628f},
-std::array<float,2>{0.58713454f, 0.74080807f},
-std::array<float,2>{0.0695554987f, 0.218746692f},
-std::array<float,2>{0.332102329f, 0.573667169f},
-std::array<float,2>{0.825914145f, 0.0295999423f},
-std::array<float,2>{0.672790825f, 0.817493975f},
-std::array<float,2>{0.226202339f, 0.429099202f},
-std::array<float,2>{0.0894935206f, 0.917077124f},
-std::array<float,2>{0.575731397f, 0.281290382f},
-std::array<float,2>{0.929982841f, 0.707124293f},
-std::array<float,2>{0.499659836f, 0.224598616f},
-std::array<float,2>{0.170259759f, 0.629902422f},
-std::array<float,2>{0.74215281f, 0.179641709f},
-std::array<float,2>{0.770528138f, 0.970245898f},
-std::array<float,2>{0.295853525f, 0.353854448f},
-std::array<float,2>{0.432902306f, 0.808015049f},
-std::array<float,2>{0.960092247f, 0.474969447f},
-std::array<float,2>{0.534505904f, 0.507751822f},
-std::array<float,2>{0.032744512f, 0.12327189f},
-std::array<float,2>{0.458040148f, 0.724373519f},
-std::array<float,2>{0.904071569f, 0.188602671f},
-std::array<float,2>{0.603485644f, 0.899155438f},
-std::array<float,2>{0.10678035f, 0.270587653f},
-std::array<float,2>{0.19071053f, 0.872934461f},
-std::array<float,2>{0.643780172f, 0.402817965f},
-std::array<float,2>{0.858859837f, 0.615588129f},
-std::array<float,2>{0.367784679f, 0.0335738659f},
-std::array<float,2>{0.0148482593f, 0.539603293f},
-std::array<float,2>{0.513895452f, 0.0651970357f},
-std::array<float,2>{0.984307349f, 0.751059949f},
-std::array<float,2>{0.383699626f, 0.459189445f},
-std::array<float,2>{0.258734941f, 0.958164215f},
-std::array<float,2>{0.811651766f, 0.318334132f},
-std::array<float,2>{0.687951088f, 0.667804003f},
-std::array<float,2>{0.149946362f, 0.156111702f},
-std::array<float,2>{0.48540473f, 0.618163228f},
-std::array<float,2>{0.928105056f, 0.0411545783f},
-std::array<float,2>{0.567843556f, 0.863473058f},
-std::array<float,2>{0.0857551023f, 0.391326696f},
-std::array<float,2>{0.227854788f, 0.890769482f},
-std::array<float,2>{0.682055652f, 0.277869165f},
-std::array<float,2>{0.817159235f, 0.733234346f},
-std::array<float,2>{0.340051204f, 0.195455641f},
-std::array<float,2>{0.0454715937f, 0.664012969f},
-std::array<float,2>{0.54278177f, 0.143663749f},
-std::array<float,2>{0.966396689f, 0.968002498f},
-std::array<float,2>{0.423074991f, 0.324731231f},
-std::array<float,2>{0.284922123f, 0.757838964f},
-std::array<float,2>{0.779455125f, 0.462344646f},
-std::array<float,2>{0.742261708f, 0.53144896f},
-std::array<float,2>{0.157797098f, 0.0706462786f},
-std::array<float,2>{0.362847298f, 0.712916732f},
-std::array<float,2>{0.849183977f, 0.231039599f},
-std::array<float,2>{0.651430249f, 0.909548223f},
-std::array<float,2>{0.196784168f, 0.290792793f},
-std::array<float,2>{0.0976160094f, 0.824788153f},
-std::array<float,2>{0.596478879f, 0.431981593f},
-std::array<float,2>{0.895105422f, 0.564785242f},
-std::array<float,2>{0.463342875f, 0.0217090305f},
-std::array<float,2>{0.143547937f, 0.512601912f},
-std::array<float,2>{0.699876785f, 0.112781361f},
-std::array<float,2>{0.802930892f, 0.803674281f},
-std::array<float,2>{0.251087636f, 0.482008725f},
-std::array<float,2>{0.381285101f, 0.97964251f},
-std::array<float,2>{0.971899569f, 0.349200964f},
-std::array<float,2>{0.504026771f, 0.637812674f},
-std::array<float,2>{0.0071718893f, 0.185904309f},
-std::array<float,2>{0.277060628f, 0.547141254f},
-std::array<float,2>{0.781799853f, 0.0824659392f},
-std::array<float,2>{0.710101604f, 0.772210181f},
-std::array<float,2>{0.135217741f, 0.441279858f},
-std::array<float,2>{0.0290851388f, 0.944075048f},
-std::array<float,2>{0.524908483f, 0.339490175f},
-std::array<float,2>{0.990267456f, 0.679327309f},
-std::array<float,2>{0.402135313f, 0.135918155f},
-std::array<float,2>{0.215821713f, 0.749091089f},
-std::array<float,2>{0.629596531f, 0.20409447f},
-std::array<float,2>{0.873794913f, 0.882882714f},
-std::array<float,2>{0.357286513f, 0.26521638f},
-std::array<float,2>{0.441351146f, 0.845595479f},
-std::array<float,2>{0.884813726f, 0.377565414f},
-std::array<float,2>{0.617357194f, 0.607731402f},
-std::array<float,2>{0.110674798f, 0.0482095666f},
-std::array<float,2>{0.41308257f, 0.651712358f},
-std::array<float,2>{0.944629371f, 0.163823366f},
-std::array<float,2>{0.555817842f, 0.987626791f},
-std::array<float,2>{0.0569350347f, 0.374761105f},
-std::array<float,2>{0.184545964f, 0.796349466f},
-std::array<float,2>{0.720726371f, 0.484537274f},
-std::array<float,2>{0.75797534f, 0.523684204f},
-std::array<float,2>{0.309081972f, 0.0999866202f},
-std::array<float,2>{0.0713060722f, 0.580797732f},
-std::array<float,2>{0.583756506f, 0.00779236434f},
-std::array<float,2>{0.909067452f, 0.839463234f},
-std::array<float,2>{0.47622177f, 0.415481955f},
-std::array<float,2>{0.317106932f, 0.934945464f},
-std::array<float,2>{0.837632418f, 0.302737057f},
-std::array<float,2>{0.671074331f, 0.697717488f},
-std::array<float,2>{0.242433399f, 0.2396314f},
-std::array<float,2>{0.404316664f, 0.577996075f},
-std::array<float,2>{0.987696052f, 0.0266597345f},
-std::array<float,2>{0.52965945f, 0.813045382f},
-std::array<float,2>{0.023792481f, 0.423809588f},
-std::array<float,2>{0.139792547f, 0.91832906f},
-std::array<float,2>{0.704792082f, 0.287463635f},
-std::array<float,2>{0.786430955f, 0.706266105f},
-std::array<float,2>{0.279585063f, 0.222180039f},
-std::array<float,2>{0.113964349f, 0.625624061f},
-std::array<float,2>{0.622499526f, 0.172901377f},
-std::array<float,2>{0.887704253f, 0.974729896f},
-std::array<float,2>{0.445174038f, 0.358289957f},
-std::array<float,2>{0.353343278f, 0.811823964f},
-std::array<float,2>{0.870147049f, 0.472090632f},
-std::array<float,2>{0.625366926f, 0.503183782f},
-std::array<float,2>{0.2119665f, 0.118810475f},
-std::array<float,2>{0.305829167f, 0.718922138f},
-std::array<float,2>{0.762149513f, 0.193837866f},
-std::array<float,2>{0.724389434f, 0.905748367f},
-std::array<float,2>{0.183573142f, 0.269277066f},
-std::array<float,2>{0.0596793443f, 0.867334962f},
-std::array<float,2>{0.560266316f, 0.401555419f},
-std::array<float,2>{0.940548301f, 0.609683394f},
-std::array<float,2>{0.408131301f, 0.0376916267f},
-std::array<float,2>{0.247063577f, 0.544761717f},
-std::array<float,2>{0.66423434f, 0.0691167265f},
-std::array<float,2>{0.843484402f, 0.755240023f},
-std::array<float,2>{0.314182788f, 0.455586076f},
-std::array<float,2>{0.469288886f, 0.956519842f},
-std::array<float,2>{0.912507236f, 0.312982142f},
-std::array<float,2>{0.580393016f, 0.671871245f},
-std::array<float,2>{0.0776106268f, 0.148616463f},
-std::array<float,2>{0.336535394f, 0.516172886f},
-std::array<float,2>{0.812799037f, 0.108734652f},
-std::array<float,2>{0.686472237f, 0.787825048f},
-std::array<float,2>{0.231991425f, 0.494960397f},
-std::array<float,2>{0.0792399496f, 0.992938042f},
-std::array<float,2>{0.566360056f, 0.365109235f},
-std::array<float,2>{0.924476266f, 0.644169271f},
-std::array<float,2>{0.48984921f, 0.169721171f},
-std::array<float,2>{0.160928145f, 0.692396939f},
-std::array<float,2>{0.749325991f, 0.249536857f},
-std::array<float,2>{0.774588227f, 0.926524103f},
-std::array<float,2>{0.289054394f, 0.305576742f},
-std::array<float,2>{0.42620495f, 0.831242502f},
-std::array<float,2>{0.963621199f, 0.412036508f},
-std::array<float,2>{0.545944273f, 0.590569019f},
-std::array<float,2>{0.0415879712f, 0.0131298648f},
-std::array<float,2>{0.468032271f, 0.681462288f},
-std::array<float,2>{0.893663466f, 0.132204384f},
-std::array<float,2>{0.597669125f, 0.951755762f},
-std::array<float,2>{0.0995020345f, 0.333871514f},
-std::array<float,2>{0.199362859f, 0.780475259f},
-std::array<float,2>{0.653866589f, 0.449967504f},
-std::array<float,2>{0.843983412f, 0.559284508f},
-std::array<float,2>{0.36615926f, 0.089359358f},
-std::array<float,2>{0.00274649821f, 0.600790799f},
-std::array<float,2>{0.501275539f, 0.0567797609f},
-std::array<float,2>{0.976144135f, 0.852612019f},
-std::array<float,2>{0.378335029f, 0.383364439f},
-std::array<float,2>{0.255443722f, 0.879586577f},
-std::array<float,2>{0.797185123f, 0.25582239f},
-std::array<float,2>{0.696784556f, 0.734694362f},
-std::array<float,2>{0.145169988f, 0.211700216f},
-std::array<float,2>{0.493427694f, 0.552175164f},
-std::array<float,2>{0.936703503f, 0.0819613859f},
-std::array<float,2>{0.572402477f, 0.768950999f},
-std::array<float,2>{0.0919326022f, 0.444101572f},
-std::array<float,2>{0.219448522f, 0.938649535f},
-std::array<float,2>{0.678073704f, 0.342161834f},
-std::array<float,2>{0.820631206f, 0.672762513f},
-std::array<float,2>{0.329524964f, 0.139395803f},
-std::array<float,2>{0.0363575518f, 0.742875934f},
-std::array<float,2>{0.537367642f, 0.207205459f},
-std::array<float,2>{0.953726351f, 0.888223767f},
-std::array<float,2>{0.437306046f, 0.261653781f},
-std::array<float,2>{0.29225111f, 0.849158883f},
-std::array<float,2>{0.768816471f, 0.379457593f},
-std::array<float,2>{0.73726362f, 0.602280676f},
-std::array<float,2>{0.164676711f, 0.0544896945f},
-std::array<float,2>{0.374102384f, 0.654381096f},
-std::array<float,2>{0.855074584f, 0.159214273f},
-std::array<float,2>{0.648197353f, 0.989394665f},
-std::array<float,2>{0.192968264f, 0.367306292f},
-std::array<float,2>{0.102263093f, 0.791083872f},
-std::array<float,2>{0.608183682f, 0.4919855f},
-std::array<float,2>{0.901782215f, 0.527877986f},
-std::array<float,2>{0.455742896f, 0.0962407514f},
-std::array<float,2>{0.15349336f, 0.58464545f},
-std::array<float,2>{0.694774389f, 0.00348714506f},
-std::array<float,2>{0.808123648f, 0.842196047f},
-std::array<float,2>{0.26278159f, 0.419855893f},
-std::array<float,2>{0.386998713f, 0.931815267f},
-std::array<float,2>{0.979272425f, 0.298977047f},
-std::array<float,2>{0.509523571f, 0.702981293f},
-std::array<float,2>{0.0110438317f, 0.238048613f},
-std::array<float,2>{0.265740812f, 0.623938203f},
-std::array<float,2>{0.792471826f, 0.0440175943f},
-std::array<float,2>{0.717987001f, 0.860226393f},
-std::array<float,2>{0.127047122f, 0.394923419f},
-std::array<float,2>{0.0224061795f, 0.897623301f},
-std::array<float,2>{0.516021788f, 0.275553644f},
-std::array<float,2>{0.998089552f, 0.727263868f},
-std::array<float,2>{0.393948227f, 0.201664671f},
-std::array<float,2>{0.209214911f, 0.658806324f},
-std::array<float,2>{0.640068352f, 0.148250237f},
-std::array<float,2>{0.866265118f, 0.961833298f},
-std::array<float,2>{0.346024603f, 0.323239177f},
-std::array<float,2>{0.452191412f, 0.765010715f},
-std::array<float,2>{0.881427765f, 0.466550618f},
-std::array<float,2>{0.609596193f, 0.535887241f},
-std::array<float,2>{0.118877165f, 0.0763087645f},
-std::array<float,2>{0.420019239f, 0.718647659f},
-std::array<float,2>{0.951575637f, 0.22829558f},
-std::array<float,2>{0.546910763f, 0.91235429f},
-std::array<float,2>{0.0536476113f, 0.29661414f},
-std::array<float,2>{0.178045049f, 0.82087028f},
-std::array<float,2>{0.732718647f, 0.43674916f},
-std::array<float,2>{0.754598439f, 0.567237794f},
-std::array<float,2>{0.298686743f, 0.0186860524f},
-std::array<float,2>{0.0654462129f, 0.509210348f},
-std::array<float,2>{0.592172742f, 0.114852831f},
-std::array<float,2>{0.921792328f, 0.79918313f},
-std::array<float,2>{0.478638232f, 0.477195174f},
-std::array<float,2>{0.324609488f, 0.981478453f},
-std::array<float,2>{0.828738511f, 0.347369522f},
-std::array<float,2>{0.660302222f, 0.635645092f},
-std::array<float,2>{0.234912843f, 0.182146817f},
-std::array<float,2>{0.429694325f, 0.506704032f},
-std::array<float,2>{0.957145274f, 0.124271303f},
-std::array<float,2>{0.531534135f, 0.807397842f},
-std::array<float,2>{0.0348385833f, 0.475846767f},
-std::array<float,2>{0.169278458f, 0.968902647f},
-std::array<float,2>{0.739229977f, 0.355420172f},
-std::array<float,2>{0.772037446f, 0.629285276f},
-std::array<float,2>{0.294885516f, 0.17819126f},
-std::array<float,2>{0.0867354646f, 0.708478153f},
-std::array<float,2>{0.578026772f, 0.22320196f},
-std::array<float,2>{0.933271468f, 0.916535497f},
-std::array<float,2>{0.497219324f, 0.282523006f},
-std::array<float,2>{0.334183067f, 0.816822588f},
-std::array<float,2>{0.826793849f, 0.428000242f},
-std::array<float,2>{0.674868166f, 0.572745621f},
-std::array<float,2>{0.222899944f, 0.0304630883f},
-std::array<float,2>{0.260145456f, 0.666973352f},
-std::array<float,2>{0.808750868f, 0.154876992f},
-std::array<float,2>{0.689659059f, 0.957706749f},
-std::array<float,2>{0.150479421f, 0.316586614f},
-std::array<float,2>{0.0125666764f, 0.75068301f},
-std::array<float,2>{0.512031198f, 0.460365444f},
-std::array<float,2>{0.981843591f, 0.540136993f},
-std::array<float,2>{0.386047632f, 0.0656792f},
-std::array<float,2>{0.187851667f, 0.616434872f},
-std::array<float,2>{0.641512811f, 0.0347630009f},
-std::array<float,2>{0.856847346f, 0.871561587f},
-std::array<float,2>{0.370897323f, 0.403568089f},
-std::array<float,2>{0.460589677f, 0.900166035f},
-std::array<float,2>{0.906136692f, 0.269537747f},
-std::array<float,2>{0.605338991f, 0.723032951f},
-std::array<float,2>{0.108735122f, 0.18837285f},
-std::array<float,2>{0.349262774f, 0.586506844f},
-std::array<float,2>{0.862377763f, 0.0102415802f},
-std::array<float,2>{0.633493483f, 0.832993507f},
-std::array<float,2>{0.204065979f, 0.410154521f},
-std::array<float,2>{0.12414895f, 0.924199641f},
-std::array<float,2>{0.616469324f, 0.311139315f},
-std::array<float,2>{0.875656188f, 0.688623011f},
-std::array<float,2>{0.44579798f, 0.245809361f},
-std::array<float,2>{0.132659286f, 0.64568603f},
-std::array<float,2>{0.713129044f, 0.164648443f},
-std::array<float,2>{0.794044495f, 0.99630487f},
-std::array<float,2>{0.27304098f, 0.36115852f},
-std::array<float,2>{0.397893757f, 0.782915831f},
-std::array<float,2>{0.995553315f, 0.498695344f},
-std::array<float,2>{0.522356868f, 0.522577882f},
-std::array<float,2>{0.018772563f, 0.104889922f},
-std::array<float,2>{0.48302564f, 0.741638839f},
-std::array<float,2>{0.915698469f, 0.217049867f},
-std::array<float,2>{0.589337766f, 0.875277638f},
-std::array<float,2>{0.0675250068f, 0.25321579f},
-std::array<float,2>{0.238409907f, 0.859012604f},
-std::array<float,2>{0.657560229f, 0.388351142f},
-std::array<float,2>{0.833145857f, 0.594741404f},
-std::array<float,2>{0.321571946f, 0.0597277693f},
-std::array<float,2>{0.0500978269f, 0.555345595f},
-std::array<float,2>{0.551018655f, 0.08991348f},
-std::array<float,2>{0.945532084f, 0.774787545f},
-std::array<float,2>{0.414680749f, 0.445974141f},
-std::array<float,2>{0.304286599f, 0.946296275f},
-std::array<float,2>{0.750616491f, 0.331482679f},
-std::array<float,2>{0.728623688f, 0.686845243f},
-std::array<float,2>{0.175439045f, 0.125869945f},
-std::array<float,2>{0.439008743f, 0.608806908f},
-std::array<float,2>{0.883058488f, 0.0471808761f},
-std::array<float,2>{0.619213581f, 0.844024062f},
-std::array<float,2>{0.112372972f, 0.378129214f},
-std::array<float,2>{0.21795705f, 0.884031892f},
-std::array<float,2>{0.63134712f, 0.264430702f},
-std::array<float,2>{0.871536493f, 0.74858433f},
-std::array<float,2>{0.35817036f, 0.204891354f},
-std::array<float,2>{0.0309149828f, 0.677879572f},
-std::array<float,2>{0.525710046f, 0.135507777f},
-std::array<float,2>{0.989130974f, 0.944519222f},
-std::array<float,2>{0.400198936f, 0.33804065f},
-std::array<float,2>{0.274255991f, 0.773423314f},
-std::array<float,2>{0.784118235f, 0.440111309f},
-std::array<float,2>{0.708175778f, 0.548531473f},
-std::array<float,2>{0.133047f, 0.0833572075f},
-std::array<float,2>{0.318822592f, 0.698325396f},
-std::array<float,2>{0.839026868f, 0.238826647f},
-std::array<float,2>{0.668737471f, 0.933749139f},
-std::array<float,2>{0.245591164f, 0.303909481f},
-std::array<float,2>{0.073479183f, 0.837988198f},
-std::array<float,2>{0.585782647f, 0.414767265f},
-std::array<float,2>{0.90704149f, 0.581245899f},
-std::array<float,2>{0.473091453f, 0.00603208598f},
-std::array<float,2>{0.186475739f, 0.524916172f},
-std::array<float,2>{0.719399869f, 0.100617915f},
-std::array<float,2>{0.760110915f, 0.79541564f},
-std::array<float,2>{0.311961889f, 0.485878676f},
-std::array<float,2>{0.411732346f, 0.98713398f},
-std::array<float,2>{0.942619443f, 0.373138785f},
-std::array<float,2>{0.557064831f, 0.651242673f},
-std::array<float,2>{0.0550847501f, 0.162956268f},
-std::array<float,2>{0.28201133f, 0.533160627f},
-std::array<float,2>{0.778882384f, 0.0713915154f},
-std::array<float,2>{0.744224906f, 0.758793056f},
-std::array<float,2>{0.159857407f, 0.461399972f},
-std::array<float,2>{0.0430041142f, 0.967447102f},
-std::array<float,2>{0.539250791f, 0.325641513f},
-std::array<float,2>{0.966831684f, 0.662278116f},
-std::array<float,2>{0.424808443f, 0.143436551f},
-std::array<float,2>{0.230291814f, 0.733473361f},
-std::array<float,2>{0.680986881f, 0.196831822f},
-std::array<float,2>{0.819797039f, 0.891749561f},
-std::array<float,2>{0.3424353f, 0.279145271f},
-std::array<float,2>{0.486850291f, 0.864533067f},
-std::array<float,2>{0.926877618f, 0.392294854f},
-std::array<float,2>{0.569806933f, 0.618509233f},
-std::array<float,2>{0.0829087496f, 0.0428810604f},
-std::array<float,2>{0.379532635f, 0.637672067f},
-std::array<float,2>{0.970296025f, 0.18710272f},
-std::array<float,2>{0.50616914f, 0.979207575f},
-std::array<float,2>{0.00576211046f, 0.348161787f},
-std::array<float,2>{0.141324446f, 0.804073453f},
-std::array<float,2>{0.702985883f, 0.481163979f},
-std::array<float,2>{0.802386343f, 0.512836277f},
-std::array<float,2>{0.253835529f, 0.111959256f},
-std::array<float,2>{0.0942159891f, 0.565465927f},
-std::array<float,2>{0.595294356f, 0.0234126523f},
-std::array<float,2>{0.898204148f, 0.825446904f},
-std::array<float,2>{0.462017387f, 0.433010161f},
-std::array<float,2>{0.359382957f, 0.909083486f},
-std::array<float,2>{0.851163149f, 0.289703846f},
-std::array<float,2>{0.649462759f, 0.714459479f},
-std::array<float,2>{0.198793456f, 0.232204676f},
-std::array<float,2>{0.408783138f, 0.611563683f},
-std::array<float,2>{0.939400733f, 0.0355365425f},
-std::array<float,2>{0.561227083f, 0.86965704f},
-std::array<float,2>{0.0609059408f, 0.398789048f},
-std::array<float,2>{0.18154189f, 0.90420866f},
-std::array<float,2>{0.725757778f, 0.266456246f},
-std::array<float,2>{0.763686895f, 0.722606719f},
-std::array<float,2>{0.308416218f, 0.1929373f},
-std::array<float,2>{0.0750866011f, 0.667970717f},
-std::array<float,2>{0.578621387f, 0.151132315f},
-std::array<float,2>{0.910548031f, 0.954484582f},
-std::array<float,2>{0.472141355f, 0.315034539f},
-std::array<float,2>{0.315838128f, 0.756879628f},
-std::array<float,2>{0.841751635f, 0.453331083f},
-std::array<float,2>{0.666574538f, 0.545203328f},
-std::array<float,2>{0.249474406f, 0.0664812103f},
-std::array<float,2>{0.279207259f, 0.704502106f},
-std::array<float,2>{0.787130237f, 0.219172299f},
-std::array<float,2>{0.705284357f, 0.919983864f},
-std::array<float,2>{0.138169184f, 0.286504686f},
-std::array<float,2>{0.0260136575f, 0.814556956f},
-std::array<float,2>{0.528458893f, 0.424015909f},
-std::array<float,2>{0.985577583f, 0.575539351f},
-std::array<float,2>{0.402976394f, 0.023831008f},
-std::array<float,2>{0.214012414f, 0.501487017f},
-std::array<float,2>{0.627981305f, 0.119784646f},
-std::array<float,2>{0.868195295f, 0.809612334f},
-std::array<float,2>{0.354797542f, 0.470020354f},
-std::array<float,2>{0.44289124f, 0.97413826f},
-std::array<float,2>{0.889900506f, 0.355742395f},
-std::array<float,2>{0.624899566f, 0.627518177f},
-std::array<float,2>{0.117018074f, 0.174128219f},
-std::array<float,2>{0.363550127f, 0.561175168f},
-std::array<float,2>{0.847630024f, 0.0875467584f},
-std::array<float,2>{0.654474676f, 0.778787255f},
-std::array<float,2>{0.202461481f, 0.452804416f},
-std::array<float,2>{0.0998530537f, 0.950763941f},
-std::array<float,2>{0.60003233f, 0.334506243f},
-std::array<float,2>{0.891372919f, 0.683187485f},
-std::array<float,2>{0.466181546f, 0.130002066f},
-std::array<float,2>{0.147733092f, 0.737883925f},
-std::array<float,2>{0.698077381f, 0.213972196f},
-std::array<float,2>{0.800146103f, 0.881562173f},
-std::array<float,2>{0.256014645f, 0.25601536f},
-std::array<float,2>{0.376388222f, 0.853993356f},
-std::array<float,2>{0.974396884f, 0.385214448f},
-std::array<float,2>{0.502769172f, 0.598133683f},
-std::array<float,2>{1.04313394e-05f, 0.0547420308f},
-std::array<float,2>{0.490621626f, 0.640668392f},
-std::array<float,2>{0.923310339f, 0.169965059f},
-std::array<float,2>{0.563803136f, 0.994574249f},
-std::array<float,2>{0.0818380341f, 0.366919667f},
-std::array<float,2>{0.233601987f, 0.785167515f},
-std::array<float,2>{0.684223294f, 0.493617296f},
-std::array<float,2>{0.815898001f, 0.519104719f},
-std::array<float,2>{0.338052362f, 0.107022338f},
-std::array<float,2>{0.0401559733f, 0.593709826f},
-std::array<float,2>{0.544173181f, 0.0149807176f},
-std::array<float,2>{0.96179831f, 0.828821957f},
-std::array<float,2>{0.428919077f, 0.413197964f},
-std::array<float,2>{0.286286235f, 0.928069949f},
-std::array<float,2>{0.777238369f, 0.307303011f},
-std::array<float,2>{0.747235179f, 0.694830894f},
-std::array<float,2>{0.163528144f, 0.246175364f},
-std::array<float,2>{0.45338279f, 0.530160487f},
-std::array<float,2>{0.899257064f, 0.0947927609f},
-std::array<float,2>{0.606173754f, 0.789129794f},
-std::array<float,2>{0.103722632f, 0.488485068f},
-std::array<float,2>{0.195038408f, 0.991222978f},
-std::array<float,2>{0.644995332f, 0.36938709f},
-std::array<float,2>{0.85174191f, 0.65316987f},
-std::array<float,2>{0.371733993f, 0.157927662f},
-std::array<float,2>{0.00832103007f, 0.699296355f},
-std::array<float,2>{0.511436403f, 0.235888049f},
-std::array<float,2>{0.976633132f, 0.931486905f},
-std::array<float,2>{0.389069945f, 0.298468679f},
-std::array<float,2>{0.263831556f, 0.841555357f},
-std::array<float,2>{0.804769158f, 0.421730399f},
-std::array<float,2>{0.693311989f, 0.582882226f},
-std::array<float,2>{0.154425636f, 0.00187083439f},
-std::array<float,2>{0.330304801f, 0.674748719f},
-std::array<float,2>{0.823693156f, 0.1372201f},
-std::array<float,2>{0.676892161f, 0.940514386f},
-std::array<float,2>{0.222108841f, 0.341665775f},
-std::array<float,2>{0.0908771977f, 0.7673406f},
-std::array<float,2>{0.571574092f, 0.443176895f},
-std::array<float,2>{0.935268998f, 0.553172767f},
-std::array<float,2>{0.494880795f, 0.0788460374f},
-std::array<float,2>{0.167755336f, 0.604552329f},
-std::array<float,2>{0.735514998f, 0.0521827228f},
-std::array<float,2>{0.7661044f, 0.849734783f},
-std::array<float,2>{0.290563881f, 0.381650954f},
-std::array<float,2>{0.435404062f, 0.889736712f},
-std::array<float,2>{0.955681503f, 0.259109974f},
-std::array<float,2>{0.536321998f, 0.74537611f},
-std::array<float,2>{0.0373241864f, 0.210506096f},
-std::array<float,2>{0.299014419f, 0.569840431f},
-std::array<float,2>{0.757126629f, 0.0168923941f},
-std::array<float,2>{0.7318874f, 0.823058248f},
-std::array<float,2>{0.177036375f, 0.434261352f},
-std::array<float,2>{0.0513273291f, 0.910631359f},
-std::array<float,2>{0.549085915f, 0.293772787f},
-std::array<float,2>{0.950395048f, 0.715948462f},
-std::array<float,2>{0.418129891f, 0.228598416f},
-std::array<float,2>{0.237965435f, 0.634076953f},
-std::array<float,2>{0.662122428f, 0.180712104f},
-std::array<float,2>{0.831449926f, 0.983503699f},
-std::array<float,2>{0.32678619f, 0.345446318f},
-std::array<float,2>{0.477945358f, 0.797552109f},
-std::array<float,2>{0.919271469f, 0.479653507f},
-std::array<float,2>{0.591255248f, 0.510044277f},
-std::array<float,2>{0.0634590536f, 0.116427951f},
-std::array<float,2>{0.391310871f, 0.729377747f},
-std::array<float,2>{0.997387707f, 0.199583843f},
-std::array<float,2>{0.519374967f, 0.894687235f},
-std::array<float,2>{0.0200032145f, 0.275265545f},
-std::array<float,2>{0.125230357f, 0.862626433f},
-std::array<float,2>{0.716015816f, 0.397310764f},
-std::array<float,2>{0.789516747f, 0.62148726f},
-std::array<float,2>{0.269114226f, 0.0449691117f},
-std::array<float,2>{0.119398147f, 0.538003027f},
-std::array<float,2>{0.613190591f, 0.0745018795f},
-std::array<float,2>{0.880358994f, 0.763657928f},
-std::array<float,2>{0.450296104f, 0.466798812f},
-std::array<float,2>{0.3448174f, 0.963049591f},
-std::array<float,2>{0.863807678f, 0.321168274f},
-std::array<float,2>{0.637952566f, 0.657753825f},
-std::array<float,2>{0.208557978f, 0.145253435f},
-std::array<float,2>{0.384003878f, 0.542357147f},
-std::array<float,2>{0.982535243f, 0.0636845082f},
-std::array<float,2>{0.514950335f, 0.752310574f},
-std::array<float,2>{0.014250543f, 0.458433509f},
-std::array<float,2>{0.148471639f, 0.960779667f},
-std::array<float,2>{0.688728511f, 0.319697648f},
-std::array<float,2>{0.810870349f, 0.665175796f},
-std::array<float,2>{0.259510607f, 0.153296173f},
-std::array<float,2>{0.105546743f, 0.724627912f},
-std::array<float,2>{0.602292776f, 0.191261619f},
-std::array<float,2>{0.902733564f, 0.900554955f},
-std::array<float,2>{0.457862675f, 0.272943705f},
-std::array<float,2>{0.36909169f, 0.873310745f},
-std::array<float,2>{0.858350575f, 0.405890226f},
-std::array<float,2>{0.643351793f, 0.614023387f},
-std::array<float,2>{0.189830899f, 0.03220677f},
-std::array<float,2>{0.296224147f, 0.632752717f},
-std::array<float,2>{0.770032465f, 0.177645817f},
-std::array<float,2>{0.740974247f, 0.972526729f},
-std::array<float,2>{0.171791092f, 0.352727413f},
-std::array<float,2>{0.0315508023f, 0.806451857f},
-std::array<float,2>{0.533742428f, 0.473126143f},
-std::array<float,2>{0.959750175f, 0.50494951f},
-std::array<float,2>{0.43182382f, 0.121683903f},
-std::array<float,2>{0.225458294f, 0.570940256f},
-std::array<float,2>{0.67335099f, 0.0274292454f},
-std::array<float,2>{0.824946404f, 0.81914562f},
-std::array<float,2>{0.333473206f, 0.427468866f},
-std::array<float,2>{0.49830246f, 0.91519165f},
-std::array<float,2>{0.930981934f, 0.283628225f},
-std::array<float,2>{0.57448256f, 0.71021086f},
-std::array<float,2>{0.0883731768f, 0.225428551f},
-std::array<float,2>{0.323534608f, 0.597512007f},
-std::array<float,2>{0.834136963f, 0.0611816123f},
-std::array<float,2>{0.659316719f, 0.857410491f},
-std::array<float,2>{0.242085412f, 0.388761789f},
-std::array<float,2>{0.0687311888f, 0.878077567f},
-std::array<float,2>{0.586621404f, 0.250419199f},
-std::array<float,2>{0.91730994f, 0.73854661f},
-std::array<float,2>{0.481345326f, 0.215297818f},
-std::array<float,2>{0.172500402f, 0.684745073f},
-std::array<float,2>{0.727945685f, 0.127967998f},
-std::array<float,2>{0.752554595f, 0.947955012f},
-std::array<float,2>{0.302730799f, 0.32927686f},
-std::array<float,2>{0.416125894f, 0.776134849f},
-std::array<float,2>{0.94857043f, 0.448886693f},
-std::array<float,2>{0.552770555f, 0.556936383f},
-std::array<float,2>{0.0470000766f, 0.0922233537f},
-std::array<float,2>{0.447282195f, 0.689871252f},
-std::array<float,2>{0.878145278f, 0.24392274f},
-std::array<float,2>{0.614878654f, 0.923709989f},
-std::array<float,2>{0.121328205f, 0.308895499f},
-std::array<float,2>{0.205812052f, 0.835829973f},
-std::array<float,2>{0.636645257f, 0.407285273f},
-std::array<float,2>{0.860352874f, 0.588620603f},
-std::array<float,2>{0.35062927f, 0.00888443459f},
-std::array<float,2>{0.0166132357f, 0.521025956f},
-std::array<float,2>{0.520445585f, 0.102096006f},
-std::array<float,2>{0.993070662f, 0.784839869f},
-std::array<float,2>{0.396350503f, 0.496850848f},
-std::array<float,2>{0.269822627f, 0.998745918f},
-std::array<float,2>{0.795042813f, 0.36153698f},
-std::array<float,2>{0.712502539f, 0.647308588f},
-std::array<float,2>{0.130213976f, 0.166562006f},
-std::array<float,2>{0.475551337f, 0.578917742f},
-std::array<float,2>{0.909745157f, 0.00467623957f},
-std::array<float,2>{0.582235694f, 0.836654723f},
-std::array<float,2>{0.0703151524f, 0.417391509f},
-std::array<float,2>{0.244007021f, 0.935656071f},
-std::array<float,2>{0.670350611f, 0.30113253f},
-std::array<float,2>{0.836762369f, 0.696239293f},
-std::array<float,2>{0.317401081f, 0.24067533f},
-std::array<float,2>{0.0583459735f, 0.648446083f},
-std::array<float,2>{0.555023849f, 0.160249248f},
-std::array<float,2>{0.944108903f, 0.984449387f},
-std::array<float,2>{0.413319618f, 0.372274876f},
-std::array<float,2>{0.310498446f, 0.793521285f},
-std::array<float,2>{0.759755671f, 0.486991554f},
-std::array<float,2>{0.722400486f, 0.527146995f},
-std::array<float,2>{0.185489044f, 0.0995501801f},
-std::array<float,2>{0.355925143f, 0.746740103f},
-std::array<float,2>{0.874056697f, 0.20612295f},
-std::array<float,2>{0.630064666f, 0.886604548f},
-std::array<float,2>{0.215305403f, 0.262145311f},
-std::array<float,2>{0.110346235f, 0.847594559f},
-std::array<float,2>{0.618813097f, 0.375401676f},
-std::array<float,2>{0.886523008f, 0.607391059f},
-std::array<float,2>{0.440104753f, 0.0504378341f},
-std::array<float,2>{0.136606067f, 0.550303757f},
-std::array<float,2>{0.709317446f, 0.0848726183f},
-std::array<float,2>{0.783106387f, 0.770773113f},
-std::array<float,2>{0.276317894f, 0.43750748f},
-std::array<float,2>{0.400980443f, 0.942142904f},
-std::array<float,2>{0.991617143f, 0.336603731f},
-std::array<float,2>{0.523612499f, 0.677354991f},
-std::array<float,2>{0.0281705651f, 0.134455323f},
-std::array<float,2>{0.250485301f, 0.513772249f},
-std::array<float,2>{0.804027319f, 0.110413492f},
-std::array<float,2>{0.700473428f, 0.801197708f},
-std::array<float,2>{0.144202128f, 0.483042777f},
-std::array<float,2>{0.00667205593f, 0.977216661f},
-std::array<float,2>{0.50554812f, 0.349677563f},
-std::array<float,2>{0.971294522f, 0.639897823f},
-std::array<float,2>{0.382603705f, 0.185034648f},
-std::array<float,2>{0.195779741f, 0.71261555f},
-std::array<float,2>{0.651288986f, 0.233546212f},
-std::array<float,2>{0.847666979f, 0.906346262f},
-std::array<float,2>{0.361639887f, 0.291328371f},
-std::array<float,2>{0.464430481f, 0.82697022f},
-std::array<float,2>{0.896087945f, 0.430635959f},
-std::array<float,2>{0.597236097f, 0.563609302f},
-std::array<float,2>{0.0962013081f, 0.0203345474f},
-std::array<float,2>{0.42193085f, 0.662092865f},
-std::array<float,2>{0.965289056f, 0.140998319f},
-std::array<float,2>{0.541389644f, 0.965404332f},
-std::array<float,2>{0.046546638f, 0.32810232f},
-std::array<float,2>{0.15667735f, 0.759912074f},
-std::array<float,2>{0.744116426f, 0.463955939f},
-std::array<float,2>{0.780640304f, 0.535039067f},
-std::array<float,2>{0.283981532f, 0.0723008215f},
-std::array<float,2>{0.0844340026f, 0.620985627f},
-std::array<float,2>{0.566601932f, 0.0400591753f},
-std::array<float,2>{0.929147363f, 0.866111815f},
-std::array<float,2>{0.484881282f, 0.393320769f},
-std::array<float,2>{0.34083423f, 0.893588066f},
-std::array<float,2>{0.817785621f, 0.280372947f},
-std::array<float,2>{0.68317014f, 0.730731547f},
-std::array<float,2>{0.227523372f, 0.197754562f},
-std::array<float,2>{0.394172639f, 0.621982217f},
-std::array<float,2>{0.998604894f, 0.0457652509f},
-std::array<float,2>{0.516565144f, 0.863175809f},
-std::array<float,2>{0.021905696f, 0.39685607f},
-std::array<float,2>{0.127628848f, 0.895468771f},
-std::array<float,2>{0.718278408f, 0.274485826f},
-std::array<float,2>{0.792523026f, 0.728828728f},
-std::array<float,2>{0.26639533f, 0.199924752f},
-std::array<float,2>{0.118317291f, 0.657601058f},
-std::array<float,2>{0.610298753f, 0.145008683f},
-std::array<float,2>{0.881026387f, 0.963864863f},
-std::array<float,2>{0.452788204f, 0.320443928f},
-std::array<float,2>{0.346342802f, 0.762844205f},
-std::array<float,2>{0.866800725f, 0.467455566f},
-std::array<float,2>{0.640215099f, 0.537526011f},
-std::array<float,2>{0.209858716f, 0.0748920962f},
-std::array<float,2>{0.297955573f, 0.716718674f},
-std::array<float,2>{0.754036963f, 0.229478523f},
-std::array<float,2>{0.733163357f, 0.910986841f},
-std::array<float,2>{0.178392127f, 0.293356746f},
-std::array<float,2>{0.0528216325f, 0.822522461f},
-std::array<float,2>{0.547712445f, 0.433651954f},
-std::array<float,2>{0.951927841f, 0.569534361f},
-std::array<float,2>{0.420519263f, 0.0174557585f},
-std::array<float,2>{0.234696537f, 0.510610223f},
-std::array<float,2>{0.661115587f, 0.117167249f},
-std::array<float,2>{0.828441203f, 0.79702121f},
-std::array<float,2>{0.324722171f, 0.480343699f},
-std::array<float,2>{0.47938478f, 0.984179735f},
-std::array<float,2>{0.920948088f, 0.344748646f},
-std::array<float,2>{0.592634022f, 0.634446442f},
-std::array<float,2>{0.0662472919f, 0.181373551f},
-std::array<float,2>{0.329633892f, 0.55333668f},
-std::array<float,2>{0.821053565f, 0.0785177127f},
-std::array<float,2>{0.678394377f, 0.766747832f},
-std::array<float,2>{0.219074562f, 0.442578584f},
-std::array<float,2>{0.0925488546f, 0.941325843f},
-std::array<float,2>{0.573004663f, 0.34115389f},
-std::array<float,2>{0.937216222f, 0.674124777f},
-std::array<float,2>{0.493967801f, 0.136800453f},
-std::array<float,2>{0.164497867f, 0.745743394f},
-std::array<float,2>{0.736519098f, 0.21007669f},
-std::array<float,2>{0.769274175f, 0.890182555f},
-std::array<float,2>{0.292845279f, 0.259542555f},
-std::array<float,2>{0.436866105f, 0.850171506f},
-std::array<float,2>{0.953518689f, 0.380989939f},
-std::array<float,2>{0.537691116f, 0.605393052f},
-std::array<float,2>{0.0367777683f, 0.0526611991f},
-std::array<float,2>{0.455405086f, 0.652520478f},
-std::array<float,2>{0.902033627f, 0.157491952f},
-std::array<float,2>{0.607477367f, 0.992111444f},
-std::array<float,2>{0.101752833f, 0.369723976f},
-std::array<float,2>{0.192550138f, 0.789647937f},
-std::array<float,2>{0.647681177f, 0.489239663f},
-std::array<float,2>{0.854846716f, 0.529653192f},
-std::array<float,2>{0.374952942f, 0.095562622f},
-std::array<float,2>{0.0113449125f, 0.582102597f},
-std::array<float,2>{0.508841455f, 0.00130974734f},
-std::array<float,2>{0.978657365f, 0.84082067f},
-std::array<float,2>{0.387536645f, 0.421378374f},
-std::array<float,2>{0.263366908f, 0.931044996f},
-std::array<float,2>{0.807987392f, 0.298102677f},
-std::array<float,2>{0.695268452f, 0.69984597f},
-std::array<float,2>{0.153945163f, 0.235804737f},
-std::array<float,2>{0.489542842f, 0.518816173f},
-std::array<float,2>{0.924120307f, 0.1066254f},
-std::array<float,2>{0.565463662f, 0.786029279f},
-std::array<float,2>{0.0796818733f, 0.493675679f},
-std::array<float,2>{0.231746942f, 0.995061338f},
-std::array<float,2>{0.685623348f, 0.366362482f},
-std::array<float,2>{0.813442647f, 0.641531825f},
-std::array<float,2>{0.336369216f, 0.170561612f},
-std::array<float,2>{0.041042041f, 0.694358349f},
-std::array<float,2>{0.546659768f, 0.246635795f},
-std::array<float,2>{0.963058054f, 0.92827785f},
-std::array<float,2>{0.426735938f, 0.306968421f},
-std::array<float,2>{0.288241804f, 0.828183651f},
-std::array<float,2>{0.774943531f, 0.41364181f},
-std::array<float,2>{0.749773383f, 0.592948616f},
-std::array<float,2>{0.160162002f, 0.0152644198f},
-std::array<float,2>{0.365575403f, 0.682823718f},
-std::array<float,2>{0.844528735f, 0.130784422f},
-std::array<float,2>{0.653708935f, 0.950538993f},
-std::array<float,2>{0.20002605f, 0.334286243f},
-std::array<float,2>{0.0990141258f, 0.77886498f},
-std::array<float,2>{0.598183453f, 0.452204764f},
-std::array<float,2>{0.894239366f, 0.560699224f},
-std::array<float,2>{0.468388468f, 0.0869233832f},
-std::array<float,2>{0.144735798f, 0.598239422f},
-std::array<float,2>{0.696695626f, 0.0555523373f},
-std::array<float,2>{0.797513604f, 0.854274154f},
-std::array<float,2>{0.254952788f, 0.385262609f},
-std::array<float,2>{0.37866804f, 0.881184518f},
-std::array<float,2>{0.975670815f, 0.25678432f},
-std::array<float,2>{0.501868069f, 0.737426043f},
-std::array<float,2>{0.00231542182f, 0.214732543f},
-std::array<float,2>{0.279786915f, 0.575750887f},
-std::array<float,2>{0.786928058f, 0.0241676588f},
-std::array<float,2>{0.704379201f, 0.815241218f},
-std::array<float,2>{0.140239075f, 0.42433545f},
-std::array<float,2>{0.0242575742f, 0.920474291f},
-std::array<float,2>{0.529910266f, 0.287006348f},
-std::array<float,2>{0.988049567f, 0.704752922f},
-std::array<float,2>{0.405022711f, 0.219334453f},
-std::array<float,2>{0.212726459f, 0.627310038f},
-std::array<float,2>{0.62569809f, 0.174675301f},
-std::array<float,2>{0.870608926f, 0.97375834f},
-std::array<float,2>{0.352967709f, 0.356057107f},
-std::array<float,2>{0.444757551f, 0.810381114f},
-std::array<float,2>{0.888586581f, 0.470659822f},
-std::array<float,2>{0.622731745f, 0.501287162f},
-std::array<float,2>{0.113413572f, 0.119365968f},
-std::array<float,2>{0.407419711f, 0.721721292f},
-std::array<float,2>{0.941280127f, 0.1926855f},
-std::array<float,2>{0.560036063f, 0.903462052f},
-std::array<float,2>{0.0603012964f, 0.265866607f},
-std::array<float,2>{0.183072224f, 0.869265974f},
-std::array<float,2>{0.723862767f, 0.399077594f},
-std::array<float,2>{0.762440443f, 0.611978531f},
-std::array<float,2>{0.306224048f, 0.0358254835f},
-std::array<float,2>{0.0780311748f, 0.54573071f},
-std::array<float,2>{0.58063519f, 0.0672883764f},
-std::array<float,2>{0.91273874f, 0.757807195f},
-std::array<float,2>{0.468952417f, 0.45367071f},
-std::array<float,2>{0.313848674f, 0.954776347f},
-std::array<float,2>{0.843092561f, 0.314524412f},
-std::array<float,2>{0.664920688f, 0.668688595f},
-std::array<float,2>{0.246545658f, 0.15055798f},
-std::array<float,2>{0.425412565f, 0.534535527f},
-std::array<float,2>{0.967301786f, 0.0728849545f},
-std::array<float,2>{0.539988101f, 0.76072526f},
-std::array<float,2>{0.0437174849f, 0.464409411f},
-std::array<float,2>{0.15953432f, 0.964902163f},
-std::array<float,2>{0.744873226f, 0.32754904f},
-std::array<float,2>{0.778420568f, 0.661146879f},
-std::array<float,2>{0.281378448f, 0.141443864f},
-std::array<float,2>{0.0823346674f, 0.731216729f},
-std::array<float,2>{0.569871902f, 0.197368369f},
-std::array<float,2>{0.927519858f, 0.894418597f},
-std::array<float,2>{0.486640751f, 0.280863166f},
-std::array<float,2>{0.342047393f, 0.865258396f},
-std::array<float,2>{0.82009244f, 0.392949373f},
-std::array<float,2>{0.681466877f, 0.620432854f},
-std::array<float,2>{0.229534015f, 0.0408962332f},
-std::array<float,2>{0.252939731f, 0.640404165f},
-std::array<float,2>{0.801812768f, 0.185326755f},
-std::array<float,2>{0.702380121f, 0.977046728f},
-std::array<float,2>{0.14072454f, 0.350565732f},
-std::array<float,2>{0.00529120769f, 0.801711321f},
-std::array<float,2>{0.506367981f, 0.482829422f},
-std::array<float,2>{0.969907999f, 0.514604032f},
-std::array<float,2>{0.379256368f, 0.111161955f},
-std::array<float,2>{0.198437259f, 0.564295113f},
-std::array<float,2>{0.650165915f, 0.0196066499f},
-std::array<float,2>{0.85072279f, 0.826278269f},
-std::array<float,2>{0.360074341f, 0.429859251f},
-std::array<float,2>{0.462721229f, 0.90703547f},
-std::array<float,2>{0.897505105f, 0.29197526f},
-std::array<float,2>{0.594744623f, 0.712008417f},
-std::array<float,2>{0.0945748091f, 0.234264255f},
-std::array<float,2>{0.35785383f, 0.606736898f},
-std::array<float,2>{0.871853948f, 0.0499310829f},
-std::array<float,2>{0.631510258f, 0.847160041f},
-std::array<float,2>{0.218680412f, 0.375600547f},
-std::array<float,2>{0.112831801f, 0.885961533f},
-std::array<float,2>{0.620083451f, 0.262384593f},
-std::array<float,2>{0.883506179f, 0.746577561f},
-std::array<float,2>{0.438499987f, 0.206746697f},
-std::array<float,2>{0.13334462f, 0.677104115f},
-std::array<float,2>{0.708835483f, 0.133984774f},
-std::array<float,2>{0.783605456f, 0.941838086f},
-std::array<float,2>{0.273751259f, 0.336222976f},
-std::array<float,2>{0.39958483f, 0.771301866f},
-std::array<float,2>{0.988606513f, 0.438150078f},
-std::array<float,2>{0.526169062f, 0.550160885f},
-std::array<float,2>{0.0306133982f, 0.0840945765f},
-std::array<float,2>{0.473361343f, 0.695571959f},
-std::array<float,2>{0.906618476f, 0.240812391f},
-std::array<float,2>{0.584995508f, 0.936410546f},
-std::array<float,2>{0.0740978792f, 0.301520258f},
-std::array<float,2>{0.245740563f, 0.835965812f},
-std::array<float,2>{0.668317854f, 0.417841405f},
-std::array<float,2>{0.839367747f, 0.57817477f},
-std::array<float,2>{0.318936914f, 0.0041489671f},
-std::array<float,2>{0.0551989935f, 0.526602447f},
-std::array<float,2>{0.557396293f, 0.0989336073f},
-std::array<float,2>{0.943312049f, 0.793333113f},
-std::array<float,2>{0.411380231f, 0.486435562f},
-std::array<float,2>{0.312214851f, 0.984893262f},
-std::array<float,2>{0.760286272f, 0.372864157f},
-std::array<float,2>{0.718882859f, 0.64913106f},
-std::array<float,2>{0.185996622f, 0.161067367f},
-std::array<float,2>{0.445861071f, 0.588334978f},
-std::array<float,2>{0.875099421f, 0.00961349625f},
-std::array<float,2>{0.616881251f, 0.835249007f},
-std::array<float,2>{0.124542467f, 0.407864183f},
-std::array<float,2>{0.203509286f, 0.92323035f},
-std::array<float,2>{0.6330176f, 0.309216231f},
-std::array<float,2>{0.863245666f, 0.689998865f},
-std::array<float,2>{0.348732471f, 0.243474677f},
-std::array<float,2>{0.019331798f, 0.646677434f},
-std::array<float,2>{0.521696091f, 0.166219696f},
-std::array<float,2>{0.996032298f, 0.998517752f},
-std::array<float,2>{0.397962689f, 0.361974806f},
-std::array<float,2>{0.272880405f, 0.784543514f},
-std::array<float,2>{0.794762552f, 0.496143103f},
-std::array<float,2>{0.713589668f, 0.520957768f},
-std::array<float,2>{0.131948784f, 0.101705328f},
-std::array<float,2>{0.322133869f, 0.739032388f},
-std::array<float,2>{0.83393991f, 0.21565339f},
-std::array<float,2>{0.657718301f, 0.878824353f},
-std::array<float,2>{0.238782823f, 0.250916332f},
-std::array<float,2>{0.0681161508f, 0.856886148f},
-std::array<float,2>{0.589808226f, 0.389506876f},
-std::array<float,2>{0.915297508f, 0.596829474f},
-std::array<float,2>{0.482563853f, 0.0608557984f},
-std::array<float,2>{0.175138667f, 0.557269573f},
-std::array<float,2>{0.729160786f, 0.0924891829f},
-std::array<float,2>{0.750109494f, 0.775671661f},
-std::array<float,2>{0.304150283f, 0.448310047f},
-std::array<float,2>{0.414376587f, 0.947699606f},
-std::array<float,2>{0.946107149f, 0.329657197f},
-std::array<float,2>{0.551360846f, 0.685499489f},
-std::array<float,2>{0.0507426001f, 0.128596649f},
-std::array<float,2>{0.294372052f, 0.505485952f},
-std::array<float,2>{0.771582007f, 0.121494152f},
-std::array<float,2>{0.738391757f, 0.805757761f},
-std::array<float,2>{0.169436961f, 0.473397434f},
-std::array<float,2>{0.0346512161f, 0.971812963f},
-std::array<float,2>{0.532027364f, 0.353149056f},
-std::array<float,2>{0.957815528f, 0.631922066f},
-std::array<float,2>{0.430411965f, 0.176976725f},
-std::array<float,2>{0.223343745f, 0.71062839f},
-std::array<float,2>{0.675750256f, 0.225089058f},
-std::array<float,2>{0.826577544f, 0.915798545f},
-std::array<float,2>{0.334830344f, 0.283694863f},
-std::array<float,2>{0.497877896f, 0.818677783f},
-std::array<float,2>{0.933030605f, 0.426929623f},
-std::array<float,2>{0.57756418f, 0.570775628f},
-std::array<float,2>{0.0860145912f, 0.0278494935f},
-std::array<float,2>{0.386247963f, 0.665641606f},
-std::array<float,2>{0.98197031f, 0.152812079f},
-std::array<float,2>{0.512350202f, 0.960080743f},
-std::array<float,2>{0.0120171085f, 0.320238709f},
-std::array<float,2>{0.151251793f, 0.752503395f},
-std::array<float,2>{0.690114856f, 0.458732337f},
-std::array<float,2>{0.80922544f, 0.542585373f},
-std::array<float,2>{0.260598004f, 0.063973859f},
-std::array<float,2>{0.108926937f, 0.613298833f},
-std::array<float,2>{0.604687214f, 0.0316711776f},
-std::array<float,2>{0.905608356f, 0.873853743f},
-std::array<float,2>{0.460278481f, 0.405725628f},
-std::array<float,2>{0.370304137f, 0.901324809f},
-std::array<float,2>{0.856935978f, 0.273296326f},
-std::array<float,2>{0.640753925f, 0.725243509f},
-std::array<float,2>{0.18816179f, 0.190682754f},
-std::array<float,2>{0.418880701f, 0.566557825f},
-std::array<float,2>{0.950700581f, 0.0192164555f},
-std::array<float,2>{0.549488485f, 0.820486128f},
-std::array<float,2>{0.0510781221f, 0.437344104f},
-std::array<float,2>{0.177634269f, 0.912960947f},
-std::array<float,2>{0.732239962f, 0.296167672f},
-std::array<float,2>{0.757593513f, 0.718235254f},
-std::array<float,2>{0.299326092f, 0.227912158f},
-std::array<float,2>{0.0625835732f, 0.635240078f},
-std::array<float,2>{0.591652274f, 0.181912363f},
-std::array<float,2>{0.919536889f, 0.981986821f},
-std::array<float,2>{0.478424907f, 0.347156495f},
-std::array<float,2>{0.326378882f, 0.799490631f},
-std::array<float,2>{0.831972241f, 0.476676255f},
-std::array<float,2>{0.663083434f, 0.509585261f},
-std::array<float,2>{0.237318128f, 0.114294596f},
-std::array<float,2>{0.26879859f, 0.726751029f},
-std::array<float,2>{0.789772213f, 0.201554686f},
-std::array<float,2>{0.716310918f, 0.898246765f},
-std::array<float,2>{0.125546664f, 0.27631852f},
-std::array<float,2>{0.0203722604f, 0.859524369f},
-std::array<float,2>{0.518812239f, 0.39542836f},
-std::array<float,2>{0.997824371f, 0.623389781f},
-std::array<float,2>{0.390871108f, 0.0447391383f},
-std::array<float,2>{0.208486289f, 0.535248518f},
-std::array<float,2>{0.638586462f, 0.0770377368f},
-std::array<float,2>{0.86328572f, 0.765482068f},
-std::array<float,2>{0.345635742f, 0.465901971f},
-std::array<float,2>{0.451020598f, 0.960964859f},
-std::array<float,2>{0.88066262f, 0.322396576f},
-std::array<float,2>{0.61253792f, 0.658646762f},
-std::array<float,2>{0.119712286f, 0.147827938f},
-std::array<float,2>{0.371284634f, 0.527671814f},
-std::array<float,2>{0.852484465f, 0.096035786f},
-std::array<float,2>{0.645234048f, 0.791874945f},
-std::array<float,2>{0.194635808f, 0.491397649f},
-std::array<float,2>{0.104440711f, 0.989961207f},
-std::array<float,2>{0.605779469f, 0.368051618f},
-std::array<float,2>{0.898922563f, 0.654944241f},
-std::array<float,2>{0.453787982f, 0.159954533f},
-std::array<float,2>{0.154964983f, 0.702590287f},
-std::array<float,2>{0.69272542f, 0.23776482f},
-std::array<float,2>{0.805211306f, 0.932290494f},
-std::array<float,2>{0.264509946f, 0.299552917f},
-std::array<float,2>{0.389454663f, 0.842647433f},
-std::array<float,2>{0.977428138f, 0.419087768f},
-std::array<float,2>{0.510933161f, 0.584200323f},
-std::array<float,2>{0.00819500536f, 0.00301486161f},
-std::array<float,2>{0.494599134f, 0.672292829f},
-std::array<float,2>{0.934837162f, 0.139141962f},
-std::array<float,2>{0.571929276f, 0.939448059f},
-std::array<float,2>{0.0916962996f, 0.342371196f},
-std::array<float,2>{0.222413674f, 0.769469202f},
-std::array<float,2>{0.677582264f, 0.443830788f},
-std::array<float,2>{0.823929667f, 0.552521229f},
-std::array<float,2>{0.330883712f, 0.0811684653f},
-std::array<float,2>{0.0377811603f, 0.601737261f},
-std::array<float,2>{0.536930025f, 0.0538011119f},
-std::array<float,2>{0.95535779f, 0.84876287f},
-std::array<float,2>{0.434981138f, 0.379078418f},
-std::array<float,2>{0.290337086f, 0.887743652f},
-std::array<float,2>{0.766288042f, 0.260777593f},
-std::array<float,2>{0.736302972f, 0.742339551f},
-std::array<float,2>{0.167230755f, 0.207885832f},
-std::array<float,2>{0.466633558f, 0.558967233f},
-std::array<float,2>{0.890941381f, 0.0892526135f},
-std::array<float,2>{0.600485086f, 0.780913949f},
-std::array<float,2>{0.100243442f, 0.449685097f},
-std::array<float,2>{0.203006074f, 0.951447546f},
-std::array<float,2>{0.654827952f, 0.333297223f},
-std::array<float,2>{0.847102165f, 0.680689812f},
-std::array<float,2>{0.364175081f, 0.132728741f},
-std::array<float,2>{0.000636066427f, 0.73534596f},
-std::array<float,2>{0.502404749f, 0.2113491f},
-std::array<float,2>{0.973649621f, 0.879104197f},
-std::array<float,2>{0.376722068f, 0.255328298f},
-std::array<float,2>{0.256414503f, 0.853221536f},
-std::array<float,2>{0.800414383f, 0.38312149f},
-std::array<float,2>{0.697692513f, 0.601347327f},
-std::array<float,2>{0.147971794f, 0.0572760813f},
-std::array<float,2>{0.338448465f, 0.643941939f},
-std::array<float,2>{0.816265762f, 0.169230059f},
-std::array<float,2>{0.683778703f, 0.992566705f},
-std::array<float,2>{0.23404339f, 0.364612073f},
-std::array<float,2>{0.0813729167f, 0.787231088f},
-std::array<float,2>{0.564231575f, 0.494523138f},
-std::array<float,2>{0.92363435f, 0.515901327f},
-std::array<float,2>{0.491038531f, 0.109193921f},
-std::array<float,2>{0.163883105f, 0.590089381f},
-std::array<float,2>{0.748030782f, 0.0136019653f},
-std::array<float,2>{0.776509047f, 0.83181721f},
-std::array<float,2>{0.287053287f, 0.411422163f},
-std::array<float,2>{0.429440975f, 0.925952852f},
-std::array<float,2>{0.961285651f, 0.305129051f},
-std::array<float,2>{0.544866741f, 0.693285644f},
-std::array<float,2>{0.0408010706f, 0.24924241f},
-std::array<float,2>{0.307800859f, 0.610345483f},
-std::array<float,2>{0.764641404f, 0.0373808257f},
-std::array<float,2>{0.72651279f, 0.868040681f},
-std::array<float,2>{0.180812493f, 0.402078778f},
-std::array<float,2>{0.0611879453f, 0.906206489f},
-std::array<float,2>{0.560997963f, 0.269031763f},
-std::array<float,2>{0.938647211f, 0.719457388f},
-std::array<float,2>{0.408487767f, 0.193871617f},
-std::array<float,2>{0.249536753f, 0.671246231f},
-std::array<float,2>{0.666398227f, 0.149309292f},
-std::array<float,2>{0.841004431f, 0.956991851f},
-std::array<float,2>{0.316225439f, 0.313186318f},
-std::array<float,2>{0.472363353f, 0.755740047f},
-std::array<float,2>{0.910732687f, 0.455181003f},
-std::array<float,2>{0.578574121f, 0.544318557f},
-std::array<float,2>{0.0746544823f, 0.0687328726f},
-std::array<float,2>{0.402400255f, 0.706885755f},
-std::array<float,2>{0.986273706f, 0.222008497f},
-std::array<float,2>{0.528914154f, 0.918528199f},
-std::array<float,2>{0.0258389283f, 0.287858635f},
-std::array<float,2>{0.138530403f, 0.812768221f},
-std::array<float,2>{0.705895126f, 0.422982424f},
-std::array<float,2>{0.787901461f, 0.577533603f},
-std::array<float,2>{0.278551579f, 0.027296409f},
-std::array<float,2>{0.116500616f, 0.503592074f},
-std::array<float,2>{0.624315917f, 0.118254952f},
-std::array<float,2>{0.890320659f, 0.812277734f},
-std::array<float,2>{0.442480534f, 0.472461611f},
-std::array<float,2>{0.355016798f, 0.975501776f},
-std::array<float,2>{0.86877811f, 0.357501566f},
-std::array<float,2>{0.628636897f, 0.625394464f},
-std::array<float,2>{0.214500174f, 0.173650742f},
-std::array<float,2>{0.382210195f, 0.513395071f},
-std::array<float,2>{0.97077769f, 0.111523151f},
-std::array<float,2>{0.505369604f, 0.804500043f},
-std::array<float,2>{0.00627665268f, 0.480799198f},
-std::array<float,2>{0.143857345f, 0.978653252f},
-std::array<float,2>{0.700892389f, 0.347903669f},
-std::array<float,2>{0.804490328f, 0.637105942f},
-std::array<float,2>{0.250793874f, 0.186867133f},
-std::array<float,2>{0.0957396701f, 0.7142452f},
-std::array<float,2>{0.596751451f, 0.231510505f},
-std::array<float,2>{0.8958323f, 0.908553779f},
-std::array<float,2>{0.464109927f, 0.289077997f},
-std::array<float,2>{0.362128705f, 0.826016366f},
-std::array<float,2>{0.848390281f, 0.433240563f},
-std::array<float,2>{0.650447488f, 0.56623441f},
-std::array<float,2>{0.19585602f, 0.0228590127f},
-std::array<float,2>{0.283632159f, 0.662900984f},
-std::array<float,2>{0.781015754f, 0.143025532f},
-std::array<float,2>{0.743582845f, 0.967015862f},
-std::array<float,2>{0.156768873f, 0.325773627f},
-std::array<float,2>{0.0462844223f, 0.759391069f},
-std::array<float,2>{0.541931212f, 0.461807638f},
-std::array<float,2>{0.965767086f, 0.532303512f},
-std::array<float,2>{0.422529519f, 0.0718905553f},
-std::array<float,2>{0.226666033f, 0.618889034f},
-std::array<float,2>{0.682747543f, 0.0422225185f},
-std::array<float,2>{0.81791693f, 0.864897609f},
-std::array<float,2>{0.341757506f, 0.391838938f},
-std::array<float,2>{0.48444584f, 0.892132521f},
-std::array<float,2>{0.929283559f, 0.278328389f},
-std::array<float,2>{0.566978455f, 0.734003186f},
-std::array<float,2>{0.0845471919f, 0.196670651f},
-std::array<float,2>{0.318255782f, 0.581884623f},
-std::array<float,2>{0.836078942f, 0.0067903786f},
-std::array<float,2>{0.670722842f, 0.83878839f},
-std::array<float,2>{0.243336394f, 0.41421777f},
-std::array<float,2>{0.0712226108f, 0.934408724f},
-std::array<float,2>{0.582722783f, 0.304682583f},
-std::array<float,2>{0.909225702f, 0.699079275f},
-std::array<float,2>{0.474791199f, 0.23849529f},
-std::array<float,2>{0.184849992f, 0.650833488f},
-std::array<float,2>{0.721960783f, 0.162587807f},
-std::array<float,2>{0.759023011f, 0.986745238f},
-std::array<float,2>{0.30984059f, 0.374012202f},
-std::array<float,2>{0.413918972f, 0.794941068f},
-std::array<float,2>{0.943779588f, 0.485637665f},
-std::array<float,2>{0.555444658f, 0.524769723f},
-std::array<float,2>{0.057738103f, 0.101312965f},
-std::array<float,2>{0.439605087f, 0.748533726f},
-std::array<float,2>{0.886119723f, 0.20410955f},
-std::array<float,2>{0.618631899f, 0.884582698f},
-std::array<float,2>{0.109675035f, 0.264104187f},
-std::array<float,2>{0.215465918f, 0.844252765f},
-std::array<float,2>{0.630712628f, 0.378554642f},
-std::array<float,2>{0.87466228f, 0.609232008f},
-std::array<float,2>{0.356311113f, 0.0477683619f},
-std::array<float,2>{0.0276860632f, 0.548211098f},
-std::array<float,2>{0.524379969f, 0.0836812332f},
-std::array<float,2>{0.991861999f, 0.772763193f},
-std::array<float,2>{0.400806099f, 0.43971321f},
-std::array<float,2>{0.275836825f, 0.944979668f},
-std::array<float,2>{0.782597065f, 0.338808745f},
-std::array<float,2>{0.709653914f, 0.678460121f},
-std::array<float,2>{0.135954693f, 0.135133758f},
-std::array<float,2>{0.480666041f, 0.595264554f},
-std::array<float,2>{0.9175089f, 0.0605028868f},
-std::array<float,2>{0.586317658f, 0.858814001f},
-std::array<float,2>{0.0688717663f, 0.388080269f},
-std::array<float,2>{0.241464525f, 0.875682592f},
-std::array<float,2>{0.65999639f, 0.253577232f},
-std::array<float,2>{0.834814727f, 0.742123961f},
-std::array<float,2>{0.323914289f, 0.217710793f},
-std::array<float,2>{0.0474090017f, 0.687088847f},
-std::array<float,2>{0.553268731f, 0.12547484f},
-std::array<float,2>{0.949175f, 0.946865499f},
-std::array<float,2>{0.416639805f, 0.331770808f},
-std::array<float,2>{0.301893562f, 0.775304019f},
-std::array<float,2>{0.752232134f, 0.445487231f},
-std::array<float,2>{0.728129208f, 0.554895222f},
-std::array<float,2>{0.17193836f, 0.0907334536f},
-std::array<float,2>{0.351108879f, 0.689003468f},
-std::array<float,2>{0.860964775f, 0.245582923f},
-std::array<float,2>{0.636220455f, 0.924672127f},
-std::array<float,2>{0.205362201f, 0.310642213f},
-std::array<float,2>{0.121594109f, 0.832083464f},
-std::array<float,2>{0.61459136f, 0.409635842f},
-std::array<float,2>{0.878428876f, 0.586319566f},
-std::array<float,2>{0.447818995f, 0.0106772976f},
-std::array<float,2>{0.130460232f, 0.523157656f},
-std::array<float,2>{0.712105632f, 0.105306312f},
-std::array<float,2>{0.795623481f, 0.782298446f},
-std::array<float,2>{0.270335734f, 0.498081207f},
-std::array<float,2>{0.39576751f, 0.997029781f},
-std::array<float,2>{0.992671669f, 0.36061734f},
-std::array<float,2>{0.519828618f, 0.646481693f},
-std::array<float,2>{0.0172292292f, 0.164549008f},
-std::array<float,2>{0.259217978f, 0.540690601f},
-std::array<float,2>{0.811457098f, 0.0662802011f},
-std::array<float,2>{0.689288855f, 0.750008583f},
-std::array<float,2>{0.149053231f, 0.460730314f},
-std::array<float,2>{0.0139724175f, 0.957261264f},
-std::array<float,2>{0.515368879f, 0.317030698f},
-std::array<float,2>{0.983105302f, 0.666199744f},
-std::array<float,2>{0.384427309f, 0.154462382f},
-std::array<float,2>{0.190224722f, 0.723466635f},
-std::array<float,2>{0.642847896f, 0.187725544f},
-std::array<float,2>{0.857880473f, 0.899888575f},
-std::array<float,2>{0.368586302f, 0.270376205f},
-std::array<float,2>{0.457068056f, 0.871792674f},
-std::array<float,2>{0.902990341f, 0.404085249f},
-std::array<float,2>{0.60163033f, 0.617124438f},
-std::array<float,2>{0.106242381f, 0.0342307426f},
-std::array<float,2>{0.432320505f, 0.629773915f},
-std::array<float,2>{0.959462523f, 0.178706065f},
-std::array<float,2>{0.533304334f, 0.969485939f},
-std::array<float,2>{0.0318259187f, 0.354821533f},
-std::array<float,2>{0.171216264f, 0.806720018f},
-std::array<float,2>{0.740334988f, 0.476421475f},
-std::array<float,2>{0.769618869f, 0.506255031f},
-std::array<float,2>{0.296641916f, 0.124569394f},
-std::array<float,2>{0.0884225219f, 0.573153138f},
-std::array<float,2>{0.574988663f, 0.0308080334f},
-std::array<float,2>{0.931285322f, 0.817174435f},
-std::array<float,2>{0.498942703f, 0.428417355f},
-std::array<float,2>{0.333904773f, 0.916083992f},
-std::array<float,2>{0.82442975f, 0.283159614f},
-std::array<float,2>{0.673106313f, 0.708824933f},
-std::array<float,2>{0.2249275f, 0.222716495f},
-std::array<float,2>{0.387956947f, 0.585428596f},
-std::array<float,2>{0.97956425f, 0.00197773217f},
-std::array<float,2>{0.508315682f, 0.843281448f},
-std::array<float,2>{0.0103082769f, 0.418237537f},
-std::array<float,2>{0.15325211f, 0.932939827f},
-std::array<float,2>{0.693867385f, 0.299983352f},
-std::array<float,2>{0.807208121f, 0.702127934f},
-std::array<float,2>{0.262286991f, 0.236463189f},
-std::array<float,2>{0.103174806f, 0.65569067f},
-std::array<float,2>{0.608441412f, 0.159128711f},
-std::array<float,2>{0.90093708f, 0.989035547f},
-std::array<float,2>{0.456771135f, 0.368544608f},
-std::array<float,2>{0.373835921f, 0.792455137f},
-std::array<float,2>{0.854127407f, 0.490393281f},
-std::array<float,2>{0.647326529f, 0.528592885f},
-std::array<float,2>{0.191837832f, 0.0967437252f},
-std::array<float,2>{0.291447073f, 0.743865907f},
-std::array<float,2>{0.767930865f, 0.208373427f},
-std::array<float,2>{0.738227069f, 0.887071431f},
-std::array<float,2>{0.165203437f, 0.26005736f},
-std::array<float,2>{0.0354668051f, 0.847827911f},
-std::array<float,2>{0.538324416f, 0.380738199f},
-std::array<float,2>{0.955031335f, 0.602840126f},
-std::array<float,2>{0.435669929f, 0.0530088469f},
-std::array<float,2>{0.220226869f, 0.551716805f},
-std::array<float,2>{0.678961575f, 0.0804102048f},
-std::array<float,2>{0.82203424f, 0.767864764f},
-std::array<float,2>{0.328272402f, 0.445056528f},
-std::array<float,2>{0.492221743f, 0.937914968f},
-std::array<float,2>{0.936427355f, 0.342854351f},
-std::array<float,2>{0.573342144f, 0.673459828f},
-std::array<float,2>{0.093221277f, 0.13987799f},
-std::array<float,2>{0.325519234f, 0.508092761f},
-std::array<float,2>{0.829202533f, 0.113748237f},
-std::array<float,2>{0.661344886f, 0.799816489f},
-std::array<float,2>{0.23568143f, 0.478196949f},
-std::array<float,2>{0.0645029098f, 0.980665445f},
-std::array<float,2>{0.593107522f, 0.34626016f},
-std::array<float,2>{0.920526922f, 0.635853827f},
-std::array<float,2>{0.479919314f, 0.182900056f},
-std::array<float,2>{0.179650038f, 0.717397332f},
-std::array<float,2>{0.734134614f, 0.227236271f},
-std::array<float,2>{0.755343914f, 0.913322508f},
-std::array<float,2>{0.297779977f, 0.295009345f},
-std::array<float,2>{0.421089768f, 0.821357965f},
-std::array<float,2>{0.952841163f, 0.436028898f},
-std::array<float,2>{0.548435032f, 0.567859948f},
-std::array<float,2>{0.0540832393f, 0.0179742277f},
-std::array<float,2>{0.451403916f, 0.659237802f},
-std::array<float,2>{0.882044971f, 0.147182718f},
-std::array<float,2>{0.610553622f, 0.962656677f},
-std::array<float,2>{0.117757864f, 0.323421478f},
-std::array<float,2>{0.209964961f, 0.764640272f},
-std::array<float,2>{0.639284253f, 0.465327203f},
-std::array<float,2>{0.865353525f, 0.536325514f},
-std::array<float,2>{0.347589821f, 0.0773826763f},
-std::array<float,2>{0.0227078386f, 0.624643624f},
-std::array<float,2>{0.516963243f, 0.0436666571f},
-std::array<float,2>{0.999351621f, 0.86113894f},
-std::array<float,2>{0.393191218f, 0.396408349f},
-std::array<float,2>{0.267519236f, 0.897343338f},
-std::array<float,2>{0.791570067f, 0.276982397f},
-std::array<float,2>{0.717755079f, 0.72788918f},
-std::array<float,2>{0.128018796f, 0.202758387f},
-std::array<float,2>{0.470059335f, 0.543938577f},
-std::array<float,2>{0.914041579f, 0.06973508f},
-std::array<float,2>{0.581684113f, 0.754613459f},
-std::array<float,2>{0.0769342929f, 0.456122637f},
-std::array<float,2>{0.247393638f, 0.955480158f},
-std::array<float,2>{0.665671289f, 0.31364426f},
-std::array<float,2>{0.842751443f, 0.670104623f},
-std::array<float,2>{0.312875956f, 0.149997413f},
-std::array<float,2>{0.0590362437f, 0.719919205f},
-std::array<float,2>{0.559087813f, 0.194363251f},
-std::array<float,2>{0.94033426f, 0.904992342f},
-std::array<float,2>{0.407147735f, 0.268251747f},
-std::array<float,2>{0.305299431f, 0.868980944f},
-std::array<float,2>{0.763630033f, 0.400434703f},
-std::array<float,2>{0.723187268f, 0.611262977f},
-std::array<float,2>{0.182022437f, 0.0381075516f},
-std::array<float,2>{0.35240224f, 0.626945734f},
-std::array<float,2>{0.869374752f, 0.172544643f},
-std::array<float,2>{0.626060784f, 0.97589606f},
-std::array<float,2>{0.211180493f, 0.359326899f},
-std::array<float,2>{0.115226775f, 0.810624659f},
-std::array<float,2>{0.621817231f, 0.470820695f},
-std::array<float,2>{0.887402296f, 0.502550125f},
-std::array<float,2>{0.443751723f, 0.117637694f},
-std::array<float,2>{0.139126718f, 0.576255262f},
-std::array<float,2>{0.703712225f, 0.025842566f},
-std::array<float,2>{0.785566509f, 0.813705802f},
-std::array<float,2>{0.28076756f, 0.422024816f},
-std::array<float,2>{0.405903935f, 0.919791162f},
-std::array<float,2>{0.987175584f, 0.288173974f},
-std::array<float,2>{0.531072855f, 0.705596149f},
-std::array<float,2>{0.0253466908f, 0.221414477f},
-std::array<float,2>{0.254872113f, 0.600079298f},
-std::array<float,2>{0.798185825f, 0.0585220456f},
-std::array<float,2>{0.695703924f, 0.85224992f},
-std::array<float,2>{0.145984411f, 0.38398388f},
-std::array<float,2>{0.00345636625f, 0.880612493f},
-std::array<float,2>{0.500743747f, 0.254503548f},
-std::array<float,2>{0.975159943f, 0.736262441f},
-std::array<float,2>{0.377281338f, 0.212750077f},
-std::array<float,2>{0.2001964f, 0.680538416f},
-std::array<float,2>{0.653260648f, 0.131098166f},
-std::array<float,2>{0.844853103f, 0.952762306f},
-std::array<float,2>{0.366393089f, 0.332111239f},
-std::array<float,2>{0.467064887f, 0.779429018f},
-std::array<float,2>{0.892906606f, 0.450857073f},
-std::array<float,2>{0.599602699f, 0.56018883f},
-std::array<float,2>{0.0979156494f, 0.0880013406f},
-std::array<float,2>{0.427337259f, 0.691676974f},
-std::array<float,2>{0.964259446f, 0.248820692f},
-std::array<float,2>{0.544933081f, 0.927323461f},
-std::array<float,2>{0.0422440544f, 0.305966198f},
-std::array<float,2>{0.161374137f, 0.83035022f},
-std::array<float,2>{0.748313189f, 0.410580426f},
-std::array<float,2>{0.774295688f, 0.591621816f},
-std::array<float,2>{0.287238955f, 0.0124193002f},
-std::array<float,2>{0.0785215199f, 0.516963601f},
-std::array<float,2>{0.565025926f, 0.107828386f},
-std::array<float,2>{0.925768077f, 0.788529396f},
-std::array<float,2>{0.488476396f, 0.496028602f},
-std::array<float,2>{0.336914092f, 0.993631005f},
-std::array<float,2>{0.813721418f, 0.364193469f},
-std::array<float,2>{0.687249482f, 0.643146813f},
-std::array<float,2>{0.231429309f, 0.167976841f},
-std::array<float,2>{0.41110149f, 0.524237633f},
-std::array<float,2>{0.941409528f, 0.100276858f},
-std::array<float,2>{0.557730556f, 0.796756685f},
-std::array<float,2>{0.0558837429f, 0.48489368f},
-std::array<float,2>{0.186581686f, 0.988059461f},
-std::array<float,2>{0.720561802f, 0.374401629f},
-std::array<float,2>{0.76139003f, 0.651906967f},
-std::array<float,2>{0.311379999f, 0.163281694f},
-std::array<float,2>{0.0726444721f, 0.698206544f},
-std::array<float,2>{0.584307551f, 0.240009323f},
-std::array<float,2>{0.907740355f, 0.935188174f},
-std::array<float,2>{0.474599987f, 0.303294599f},
-std::array<float,2>{0.319692701f, 0.839222848f},
-std::array<float,2>{0.838215292f, 0.415678203f},
-std::array<float,2>{0.669614315f, 0.5803352f},
-std::array<float,2>{0.24450171f, 0.00700368127f},
-std::array<float,2>{0.275171697f, 0.679095626f},
-std::array<float,2>{0.784314215f, 0.136360437f},
-std::array<float,2>{0.707345366f, 0.943730712f},
-std::array<float,2>{0.134380102f, 0.33914423f},
-std::array<float,2>{0.0297096372f, 0.771649301f},
-std::array<float,2>{0.526762426f, 0.440458f},
-std::array<float,2>{0.9900195f, 0.547422767f},
-std::array<float,2>{0.398916453f, 0.0827020481f},
-std::array<float,2>{0.21702233f, 0.608358622f},
-std::array<float,2>{0.6327281f, 0.0487308577f},
-std::array<float,2>{0.872760296f, 0.844872892f},
-std::array<float,2>{0.359256238f, 0.377227187f},
-std::array<float,2>{0.437682897f, 0.883776724f},
-std::array<float,2>{0.884020805f, 0.265095383f},
-std::array<float,2>{0.620422065f, 0.749631107f},
-std::array<float,2>{0.112162434f, 0.203176811f},
-std::array<float,2>{0.360359758f, 0.565251291f},
-std::array<float,2>{0.850181162f, 0.0224393178f},
-std::array<float,2>{0.64931637f, 0.824292898f},
-std::array<float,2>{0.197320282f, 0.432314873f},
-std::array<float,2>{0.095410876f, 0.909772396f},
-std::array<float,2>{0.594152868f, 0.290116996f},
-std::array<float,2>{0.896590531f, 0.713397741f},
-std::array<float,2>{0.461753666f, 0.230928123f},
-std::array<float,2>{0.141660422f, 0.638477743f},
-std::array<float,2>{0.702127695f, 0.186487511f},
-std::array<float,2>{0.801073372f, 0.980300426f},
-std::array<float,2>{0.252597302f, 0.349095106f},
-std::array<float,2>{0.380088389f, 0.802907288f},
-std::array<float,2>{0.969378233f, 0.481626332f},
-std::array<float,2>{0.507636726f, 0.512100041f},
-std::array<float,2>{0.00399743346f, 0.113189146f},
-std::array<float,2>{0.487818301f, 0.732512772f},
-std::array<float,2>{0.926191866f, 0.195977792f},
-std::array<float,2>{0.56932503f, 0.891508281f},
-std::array<float,2>{0.0838539302f, 0.277436852f},
-std::array<float,2>{0.229232758f, 0.864079833f},
-std::array<float,2>{0.68007654f, 0.390901238f},
-std::array<float,2>{0.81889385f, 0.617403924f},
-std::array<float,2>{0.343187422f, 0.0415785424f},
-std::array<float,2>{0.0445403084f, 0.532024145f},
-std::array<float,2>{0.540130019f, 0.0712391585f},
-std::array<float,2>{0.967815995f, 0.758398712f},
-std::array<float,2>{0.424661428f, 0.462553412f},
-std::array<float,2>{0.282757252f, 0.968516231f},
-std::array<float,2>{0.777365625f, 0.324240983f},
-std::array<float,2>{0.745530903f, 0.663286626f},
-std::array<float,2>{0.158849254f, 0.144332185f},
-std::array<float,2>{0.459407628f, 0.615916848f},
-std::array<float,2>{0.90455246f, 0.0340172239f},
-std::array<float,2>{0.603573382f, 0.872387588f},
-std::array<float,2>{0.107901432f, 0.403299987f},
-std::array<float,2>{0.188501135f, 0.898545802f},
-std::array<float,2>{0.642381132f, 0.27116254f},
-std::array<float,2>{0.855791807f, 0.723874271f},
-std::array<float,2>{0.370021135f, 0.18934913f},
-std::array<float,2>{0.0131460456f, 0.667236567f},
-std::array<float,2>{0.512928307f, 0.15539372f},
-std::array<float,2>{0.981156588f, 0.958527029f},
-std::array<float,2>{0.385719359f, 0.317754894f},
-std::array<float,2>{0.26117745f, 0.751782835f},
-std::array<float,2>{0.810036004f, 0.459830552f},
-std::array<float,2>{0.69122082f, 0.539202094f},
-std::array<float,2>{0.152102739f, 0.064590618f},
-std::array<float,2>{0.335428655f, 0.707864702f},
-std::array<float,2>{0.827758849f, 0.223987907f},
-std::array<float,2>{0.674635351f, 0.917968094f},
-std::array<float,2>{0.223695129f, 0.281994671f},
-std::array<float,2>{0.0870322287f, 0.818206668f},
-std::array<float,2>{0.576755464f, 0.429510176f},
-std::array<float,2>{0.932580769f, 0.57394278f},
-std::array<float,2>{0.496349156f, 0.0302647334f},
-std::array<float,2>{0.168540046f, 0.507168114f},
-std::array<float,2>{0.740151703f, 0.124005556f},
-std::array<float,2>{0.77300626f, 0.808281243f},
-std::array<float,2>{0.293512642f, 0.475179076f},
-std::array<float,2>{0.43120262f, 0.970007718f},
-std::array<float,2>{0.95813024f, 0.354044139f},
-std::array<float,2>{0.532338917f, 0.630765796f},
-std::array<float,2>{0.0339975916f, 0.178968564f},
-std::array<float,2>{0.303190529f, 0.556072474f},
-std::array<float,2>{0.751806378f, 0.091434069f},
-std::array<float,2>{0.730430424f, 0.773976743f},
-std::array<float,2>{0.173916593f, 0.447182685f},
-std::array<float,2>{0.048842866f, 0.94615078f},
-std::array<float,2>{0.552552938f, 0.330746353f},
-std::array<float,2>{0.947184026f, 0.686145306f},
-std::array<float,2>{0.415850997f, 0.125985563f},
-std::array<float,2>{0.239686847f, 0.740702391f},
-std::array<float,2>{0.656808794f, 0.218068048f},
-std::array<float,2>{0.832536638f, 0.876582623f},
-std::array<float,2>{0.321232706f, 0.252604812f},
-std::array<float,2>{0.48424384f, 0.85790509f},
-std::array<float,2>{0.914547443f, 0.386906892f},
-std::array<float,2>{0.588160336f, 0.594269812f},
-std::array<float,2>{0.0669549033f, 0.0587579496f},
-std::array<float,2>{0.39691484f, 0.644985378f},
-std::array<float,2>{0.994633615f, 0.165605128f},
-std::array<float,2>{0.523004055f, 0.997461855f},
-std::array<float,2>{0.0180164687f, 0.359999776f},
-std::array<float,2>{0.130990773f, 0.782192051f},
-std::array<float,2>{0.71456188f, 0.499653816f},
-std::array<float,2>{0.7932356f, 0.521709204f},
-std::array<float,2>{0.272411942f, 0.103634678f},
-std::array<float,2>{0.123080738f, 0.58772248f},
-std::array<float,2>{0.615598619f, 0.0108465608f},
-std::array<float,2>{0.87654084f, 0.833983183f},
-std::array<float,2>{0.44669798f, 0.409091234f},
-std::array<float,2>{0.34786135f, 0.925600648f},
-std::array<float,2>{0.861888587f, 0.312144876f},
-std::array<float,2>{0.63434571f, 0.687655151f},
-std::array<float,2>{0.204985484f, 0.244533181f},
-std::array<float,2>{0.434467345f, 0.604374468f},
-std::array<float,2>{0.956259549f, 0.0510839038f},
-std::array<float,2>{0.535532832f, 0.851002932f},
-std::array<float,2>{0.0382563099f, 0.382780612f},
-std::array<float,2>{0.166959256f, 0.889567912f},
-std::array<float,2>{0.73534441f, 0.258100569f},
-std::array<float,2>{0.767325103f, 0.744549751f},
-std::array<float,2>{0.289904326f, 0.209867448f},
-std::array<float,2>{0.0905870646f, 0.675718665f},
-std::array<float,2>{0.570878148f, 0.138320282f},
-std::array<float,2>{0.933935165f, 0.940370202f},
-std::array<float,2>{0.495484143f, 0.339971542f},
-std::array<float,2>{0.331625253f, 0.766550541f},
-std::array<float,2>{0.822289824f, 0.442009062f},
-std::array<float,2>{0.676369846f, 0.554406583f},
-std::array<float,2>{0.220789418f, 0.079351455f},
-std::array<float,2>{0.265446275f, 0.700829625f},
-std::array<float,2>{0.80638808f, 0.234543875f},
-std::array<float,2>{0.691633642f, 0.929836273f},
-std::array<float,2>{0.155406058f, 0.297280818f},
-std::array<float,2>{0.00943784136f, 0.840441704f},
-std::array<float,2>{0.509993732f, 0.420322627f},
-std::array<float,2>{0.977554381f, 0.583285511f},
-std::array<float,2>{0.389911622f, 0.000784084958f},
-std::array<float,2>{0.194112495f, 0.530317962f},
-std::array<float,2>{0.645538032f, 0.0945545137f},
-std::array<float,2>{0.852934837f, 0.790352941f},
-std::array<float,2>{0.372181505f, 0.49016434f},
-std::array<float,2>{0.454935014f, 0.991130829f},
-std::array<float,2>{0.899662018f, 0.370962918f},
-std::array<float,2>{0.607327342f, 0.653378427f},
-std::array<float,2>{0.105204202f, 0.156763554f},
-std::array<float,2>{0.344706863f, 0.538709581f},
-std::array<float,2>{0.864632845f, 0.0753056705f},
-std::array<float,2>{0.637552977f, 0.762097061f},
-std::array<float,2>{0.207672343f, 0.468570292f},
-std::array<float,2>{0.120746821f, 0.964056492f},
-std::array<float,2>{0.611999571f, 0.322128922f},
-std::array<float,2>{0.879470885f, 0.657111168f},
-std::array<float,2>{0.449969321f, 0.145918086f},
-std::array<float,2>{0.126123503f, 0.730156898f},
-std::array<float,2>{0.715250373f, 0.201077774f},
-std::array<float,2>{0.790072143f, 0.896179259f},
-std::array<float,2>{0.267836601f, 0.274218678f},
-std::array<float,2>{0.392510206f, 0.86225456f},
-std::array<float,2>{0.996580005f, 0.397547781f},
-std::array<float,2>{0.517782629f, 0.622694016f},
-std::array<float,2>{0.0214191582f, 0.0464209318f},
-std::array<float,2>{0.476757258f, 0.633191109f},
-std::array<float,2>{0.918594718f, 0.180372089f},
-std::array<float,2>{0.590016842f, 0.983213842f},
-std::array<float,2>{0.0636370182f, 0.344638884f},
-std::array<float,2>{0.236776203f, 0.798014343f},
-std::array<float,2>{0.66336298f, 0.479379892f},
-std::array<float,2>{0.830549598f, 0.510743976f},
-std::array<float,2>{0.327398777f, 0.115856461f},
-std::array<float,2>{0.0523861237f, 0.568865895f},
-std::array<float,2>{0.549886167f, 0.0163392629f},
-std::array<float,2>{0.949816763f, 0.823700666f},
-std::array<float,2>{0.419065654f, 0.434860438f},
-std::array<float,2>{0.300150722f, 0.911133349f},
-std::array<float,2>{0.755886257f, 0.294386238f},
-std::array<float,2>{0.731317163f, 0.715272248f},
-std::array<float,2>{0.176718563f, 0.229522184f},
-std::array<float,2>{0.442135423f, 0.500293791f},
-std::array<float,2>{0.889457345f, 0.120759182f},
-std::array<float,2>{0.623488724f, 0.80910641f},
-std::array<float,2>{0.115270115f, 0.468927979f},
-std::array<float,2>{0.213315204f, 0.973205626f},
-std::array<float,2>{0.627669036f, 0.357140362f},
-std::array<float,2>{0.867263854f, 0.628790855f},
-std::array<float,2>{0.354441464f, 0.175562933f},
-std::array<float,2>{0.0266141798f, 0.703416526f},
-std::array<float,2>{0.52802062f, 0.220659778f},
-std::array<float,2>{0.984431088f, 0.920952737f},
-std::array<float,2>{0.40365535f, 0.285756707f},
-std::array<float,2>{0.278020173f, 0.815605164f},
-std::array<float,2>{0.788167775f, 0.425632805f},
-std::array<float,2>{0.706764162f, 0.575161159f},
-std::array<float,2>{0.137424201f, 0.0246425066f},
-std::array<float,2>{0.315268785f, 0.669611514f},
-std::array<float,2>{0.840222716f, 0.152055889f},
-std::array<float,2>{0.667105496f, 0.953236639f},
-std::array<float,2>{0.24851957f, 0.315646917f},
-std::array<float,2>{0.0757074207f, 0.756809115f},
-std::array<float,2>{0.579111099f, 0.454171598f},
-std::array<float,2>{0.911784112f, 0.546382666f},
-std::array<float,2>{0.470983684f, 0.0677871257f},
-std::array<float,2>{0.179965228f, 0.612385571f},
-std::array<float,2>{0.725502431f, 0.0361529998f},
-std::array<float,2>{0.765560448f, 0.870670617f},
-std::array<float,2>{0.306867957f, 0.400002241f},
-std::array<float,2>{0.409469157f, 0.903290987f},
-std::array<float,2>{0.9377442f, 0.267124534f},
-std::array<float,2>{0.561992943f, 0.721066773f},
-std::array<float,2>{0.0618987903f, 0.192150727f},
-std::array<float,2>{0.285319716f, 0.591902792f},
-std::array<float,2>{0.775578976f, 0.0138423266f},
-std::array<float,2>{0.746524096f, 0.829769373f},
-std::array<float,2>{0.162292764f, 0.412891239f},
-std::array<float,2>{0.0391509943f, 0.929169893f},
-std::array<float,2>{0.543760359f, 0.307839721f},
-std::array<float,2>{0.962296963f, 0.693842351f},
-std::array<float,2>{0.428173214f, 0.247573406f},
-std::array<float,2>{0.233029619f, 0.641744018f},
-std::array<float,2>{0.684647679f, 0.171726629f},
-std::array<float,2>{0.814996123f, 0.995219946f},
-std::array<float,2>{0.339691192f, 0.365655452f},
-std::array<float,2>{0.491734982f, 0.786475956f},
-std::array<float,2>{0.922569215f, 0.492677838f},
-std::array<float,2>{0.563055456f, 0.518354118f},
-std::array<float,2>{0.0807598233f, 0.106119178f},
-std::array<float,2>{0.375713885f, 0.737003922f},
-std::array<float,2>{0.972819209f, 0.213773429f},
-std::array<float,2>{0.503833175f, 0.882477522f},
-std::array<float,2>{0.00167893292f, 0.256905377f},
-std::array<float,2>{0.146913603f, 0.855174124f},
-std::array<float,2>{0.699101031f, 0.386229724f},
-std::array<float,2>{0.7996732f, 0.599500835f},
-std::array<float,2>{0.25747928f, 0.0562448166f},
-std::array<float,2>{0.101253152f, 0.562497497f},
-std::array<float,2>{0.601517618f, 0.0863953754f},
-std::array<float,2>{0.892023861f, 0.77808243f},
-std::array<float,2>{0.46494326f, 0.451935142f},
-std::array<float,2>{0.364641964f, 0.94980377f},
-std::array<float,2>{0.846414924f, 0.335853755f},
-std::array<float,2>{0.655620277f, 0.682110608f},
-std::array<float,2>{0.201470897f, 0.129714504f},
-std::array<float,2>{0.401608437f, 0.549403727f},
-std::array<float,2>{0.991110444f, 0.0850314796f},
-std::array<float,2>{0.524876714f, 0.769735098f},
-std::array<float,2>{0.0285781864f, 0.438552856f},
-std::array<float,2>{0.135317475f, 0.943306029f},
-std::array<float,2>{0.71048826f, 0.337579012f},
-std::array<float,2>{0.781287909f, 0.676525235f},
-std::array<float,2>{0.27675885f, 0.133610055f},
-std::array<float,2>{0.111242197f, 0.748029232f},
-std::array<float,2>{0.618073702f, 0.205202714f},
-std::array<float,2>{0.885477781f, 0.885482073f},
-std::array<float,2>{0.440665394f, 0.262697458f},
-std::array<float,2>{0.356888086f, 0.846565604f},
-std::array<float,2>{0.873359501f, 0.376190335f},
-std::array<float,2>{0.629259884f, 0.605500281f},
-std::array<float,2>{0.216699883f, 0.0488808863f},
-std::array<float,2>{0.30941537f, 0.649612427f},
-std::array<float,2>{0.758786321f, 0.16129598f},
-std::array<float,2>{0.721643329f, 0.985809982f},
-std::array<float,2>{0.183671147f, 0.371176392f},
-std::array<float,2>{0.0572192408f, 0.794645429f},
-std::array<float,2>{0.556254625f, 0.487548977f},
-std::array<float,2>{0.945109844f, 0.526012301f},
-std::array<float,2>{0.412423939f, 0.0981934518f},
-std::array<float,2>{0.243071258f, 0.579966247f},
-std::array<float,2>{0.671787858f, 0.00565051846f},
-std::array<float,2>{0.837156057f, 0.837667286f},
-std::array<float,2>{0.316415191f, 0.416103631f},
-std::array<float,2>{0.475605667f, 0.937079191f},
-std::array<float,2>{0.908512354f, 0.302362978f},
-std::array<float,2>{0.583053768f, 0.69650799f},
-std::array<float,2>{0.0721582845f, 0.241286144f},
-std::array<float,2>{0.340531081f, 0.619392931f},
-std::array<float,2>{0.816593647f, 0.0394254588f},
-std::array<float,2>{0.682259142f, 0.866404712f},
-std::array<float,2>{0.228249595f, 0.394443154f},
-std::array<float,2>{0.0852747411f, 0.893281162f},
-std::array<float,2>{0.568075538f, 0.279721707f},
-std::array<float,2>{0.928270817f, 0.731943846f},
-std::array<float,2>{0.486015141f, 0.198650807f},
-std::array<float,2>{0.157279342f, 0.661109447f},
-std::array<float,2>{0.742724836f, 0.141816244f},
-std::array<float,2>{0.780199409f, 0.966259658f},
-std::array<float,2>{0.28430903f, 0.327039361f},
-std::array<float,2>{0.423579663f, 0.761439145f},
-std::array<float,2>{0.966300488f, 0.463663191f},
-std::array<float,2>{0.542055726f, 0.533613265f},
-std::array<float,2>{0.0452192165f, 0.0741134286f},
-std::array<float,2>{0.463801742f, 0.711581886f},
-std::array<float,2>{0.894832313f, 0.232905298f},
-std::array<float,2>{0.595803559f, 0.907657444f},
-std::array<float,2>{0.0967846215f, 0.2921817f},
-std::array<float,2>{0.196747735f, 0.827262759f},
-std::array<float,2>{0.652264595f, 0.430794388f},
-std::array<float,2>{0.848672628f, 0.56256026f},
-std::array<float,2>{0.362520099f, 0.0211147703f},
-std::array<float,2>{0.00773753319f, 0.514895499f},
-std::array<float,2>{0.504789472f, 0.109726422f},
-std::array<float,2>{0.972475529f, 0.802405417f},
-std::array<float,2>{0.381639898f, 0.483492732f},
-std::array<float,2>{0.25164628f, 0.978007793f},
-std::array<float,2>{0.803316534f, 0.351511389f},
-std::array<float,2>{0.69930619f, 0.638680339f},
-std::array<float,2>{0.142690197f, 0.184534758f},
-std::array<float,2>{0.499281794f, 0.572014511f},
-std::array<float,2>{0.930473626f, 0.0288512893f},
-std::array<float,2>{0.575339735f, 0.819726229f},
-std::array<float,2>{0.0891425535f, 0.426517576f},
-std::array<float,2>{0.225797921f, 0.914149165f},
-std::array<float,2>{0.672163308f, 0.284857363f},
-std::array<float,2>{0.825459003f, 0.709219813f},
-std::array<float,2>{0.332841724f, 0.226091757f},
-std::array<float,2>{0.0325583108f, 0.631298721f},
-std::array<float,2>{0.535044193f, 0.17578131f},
-std::array<float,2>{0.960584462f, 0.971162498f},
-std::array<float,2>{0.433501542f, 0.352135748f},
-std::array<float,2>{0.294926524f, 0.805581748f},
-std::array<float,2>{0.771389425f, 0.474319607f},
-std::array<float,2>{0.741476595f, 0.504801333f},
-std::array<float,2>{0.170625031f, 0.122824192f},
-std::array<float,2>{0.367498755f, 0.726324856f},
-std::array<float,2>{0.859132648f, 0.190238342f},
-std::array<float,2>{0.644267321f, 0.901375115f},
-std::array<float,2>{0.191118389f, 0.272342533f},
-std::array<float,2>{0.107184984f, 0.874975681f},
-std::array<float,2>{0.60277319f, 0.404868484f},
-std::array<float,2>{0.903736651f, 0.614388585f},
-std::array<float,2>{0.458738446f, 0.0326972343f},
-std::array<float,2>{0.14982608f, 0.541836262f},
-std::array<float,2>{0.688469052f, 0.0626433864f},
-std::array<float,2>{0.812343121f, 0.753896415f},
-std::array<float,2>{0.258119524f, 0.457214445f},
-std::array<float,2>{0.383248836f, 0.959886312f},
-std::array<float,2>{0.983564138f, 0.319024593f},
-std::array<float,2>{0.514251649f, 0.664873779f},
-std::array<float,2>{0.0156194037f, 0.154014483f},
-std::array<float,2>{0.270782828f, 0.519562125f},
-std::array<float,2>{0.796066761f, 0.102546312f},
-std::array<float,2>{0.711129248f, 0.783344984f},
-std::array<float,2>{0.129440069f, 0.497793913f},
-std::array<float,2>{0.0160168093f, 0.999384165f},
-std::array<float,2>{0.521437287f, 0.362876296f},
-std::array<float,2>{0.993886352f, 0.647626221f},
-std::array<float,2>{0.395056307f, 0.167291731f},
-std::array<float,2>{0.206067845f, 0.69134903f},
-std::array<float,2>{0.635101795f, 0.242903247f},
-std::array<float,2>{0.859805703f, 0.922147453f},
-std::array<float,2>{0.34976545f, 0.310281545f},
-std::array<float,2>{0.449171245f, 0.834581971f},
-std::array<float,2>{0.877487898f, 0.407075614f},
-std::array<float,2>{0.613843024f, 0.58903414f},
-std::array<float,2>{0.122265309f, 0.00837917347f},
-std::array<float,2>{0.417369336f, 0.684532166f},
-std::array<float,2>{0.948159456f, 0.127122462f},
-std::array<float,2>{0.554671764f, 0.949068725f},
-std::array<float,2>{0.0478748195f, 0.32847628f},
-std::array<float,2>{0.173091546f, 0.776787937f},
-std::array<float,2>{0.726726055f, 0.447666049f},
-std::array<float,2>{0.753901362f, 0.558400154f},
-std::array<float,2>{0.301263362f, 0.0929711238f},
-std::array<float,2>{0.0698638633f, 0.595863163f},
-std::array<float,2>{0.587779105f, 0.0617533103f},
-std::array<float,2>{0.91664952f, 0.855487168f},
-std::array<float,2>{0.482336164f, 0.389773697f},
-std::array<float,2>{0.322767884f, 0.877232373f},
-std::array<float,2>{0.835554421f, 0.251633525f},
-std::array<float,2>{0.658456922f, 0.739535809f},
-std::array<float,2>{0.240752101f, 0.216685608f}}
\ No newline at end of file
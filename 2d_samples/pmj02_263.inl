@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.61485815f, 0.684925377f},
-std::array<float,2>{0.290486038f, 0.205408156f},
-std::array<float,2>{0.222960204f, 0.869707525f},
-std::array<float,2>{0.926515996f, 0.384469181f},
-std::array<float,2>{0.76549691f, 0.885606825f},
-std::array<float,2>{0.0552420393f, 0.267364711f},
-std::array<float,2>{0.377694279f, 0.608486831f},
-std::array<float,2>{0.687173247f, 0.0600589924f},
-std::array<float,2>{0.95143187f, 0.547706544f},
-std::array<float,2>{0.146196425f, 0.123254247f},
-std::array<float,2>{0.362760425f, 0.961991787f},
-std::array<float,2>{0.51523149f, 0.348754317f},
-std::array<float,2>{0.733767211f, 0.791415453f},
-std::array<float,2>{0.470348686f, 0.449251115f},
-std::array<float,2>{0.0769307241f, 0.696847379f},
-std::array<float,2>{0.825179279f, 0.151206642f},
-std::array<float,2>{0.627387524f, 0.572677135f},
-std::array<float,2>{0.424865246f, 0.0225039478f},
-std::array<float,2>{0.00650872942f, 0.935840547f},
-std::array<float,2>{0.799743056f, 0.287656426f},
-std::array<float,2>{0.903656602f, 0.833152771f},
-std::array<float,2>{0.20553185f, 0.413897812f},
-std::array<float,2>{0.272260725f, 0.6300295f},
-std::array<float,2>{0.593248665f, 0.247438446f},
-std::array<float,2>{0.874416769f, 0.728017747f},
-std::array<float,2>{0.111343555f, 0.18079932f},
-std::array<float,2>{0.440848827f, 0.759268522f},
-std::array<float,2>{0.716702521f, 0.479091913f},
-std::array<float,2>{0.556721926f, 0.997152507f},
-std::array<float,2>{0.325105429f, 0.318970442f},
-std::array<float,2>{0.159305587f, 0.512989044f},
-std::array<float,2>{0.987152517f, 0.0675264522f},
-std::array<float,2>{0.69617486f, 0.705261409f},
-std::array<float,2>{0.456499815f, 0.128476351f},
-std::array<float,2>{0.106345803f, 0.805589855f},
-std::array<float,2>{0.850823104f, 0.461943388f},
-std::array<float,2>{0.976660728f, 0.947983563f},
-std::array<float,2>{0.172055349f, 0.362256587f},
-std::array<float,2>{0.332234085f, 0.540573299f},
-std::array<float,2>{0.540559828f, 0.108477816f},
-std::array<float,2>{0.787242591f, 0.613769948f},
-std::array<float,2>{0.0253073331f, 0.0338664204f},
-std::array<float,2>{0.406326383f, 0.8984797f},
-std::array<float,2>{0.652780831f, 0.259170413f},
-std::array<float,2>{0.570985675f, 0.846231759f},
-std::array<float,2>{0.263085186f, 0.397231847f},
-std::array<float,2>{0.19324784f, 0.668101549f},
-std::array<float,2>{0.879054308f, 0.198851421f},
-std::array<float,2>{0.52249223f, 0.527441323f},
-std::array<float,2>{0.344880968f, 0.0805971548f},
-std::array<float,2>{0.133494601f, 0.968948722f},
-std::array<float,2>{0.96071744f, 0.3307648f},
-std::array<float,2>{0.842354655f, 0.766610026f},
-std::array<float,2>{0.0801837966f, 0.494522154f},
-std::array<float,2>{0.499635279f, 0.735074222f},
-std::array<float,2>{0.742890179f, 0.168876231f},
-std::array<float,2>{0.919345617f, 0.655043483f},
-std::array<float,2>{0.240181521f, 0.221346527f},
-std::array<float,2>{0.308728516f, 0.826600611f},
-std::array<float,2>{0.607229829f, 0.43232125f},
-std::array<float,2>{0.656784475f, 0.911961019f},
-std::array<float,2>{0.403213233f, 0.311021149f},
-std::array<float,2>{0.0379163846f, 0.58349067f},
-std::array<float,2>{0.769502461f, 0.00447337748f},
-std::array<float,2>{0.532178879f, 0.744525671f},
-std::array<float,2>{0.342061579f, 0.16379866f},
-std::array<float,2>{0.182822019f, 0.779160619f},
-std::array<float,2>{0.97593385f, 0.490113139f},
-std::array<float,2>{0.853816628f, 0.980690479f},
-std::array<float,2>{0.101385452f, 0.337483495f},
-std::array<float,2>{0.463427365f, 0.521066606f},
-std::array<float,2>{0.688325405f, 0.0925023034f},
-std::array<float,2>{0.883466959f, 0.590590298f},
-std::array<float,2>{0.202015266f, 0.0131397247f},
-std::array<float,2>{0.256070346f, 0.91764313f},
-std::array<float,2>{0.563206732f, 0.301246583f},
-std::array<float,2>{0.647971153f, 0.819997191f},
-std::array<float,2>{0.417123049f, 0.422187686f},
-std::array<float,2>{0.0209362824f, 0.643225551f},
-std::array<float,2>{0.790132105f, 0.228611231f},
-std::array<float,2>{0.738491595f, 0.536458194f},
-std::array<float,2>{0.485273838f, 0.0980839059f},
-std::array<float,2>{0.0927177072f, 0.93999356f},
-std::array<float,2>{0.831150711f, 0.373638719f},
-std::array<float,2>{0.96205771f, 0.803318262f},
-std::array<float,2>{0.126581192f, 0.460846543f},
-std::array<float,2>{0.357791096f, 0.713314354f},
-std::array<float,2>{0.527536869f, 0.135883555f},
-std::array<float,2>{0.780106723f, 0.65751344f},
-std::array<float,2>{0.0452994853f, 0.192709297f},
-std::array<float,2>{0.394566208f, 0.853386998f},
-std::array<float,2>{0.669791579f, 0.400820196f},
-std::array<float,2>{0.594937921f, 0.893712699f},
-std::array<float,2>{0.300033629f, 0.254986376f},
-std::array<float,2>{0.244729131f, 0.620738208f},
-std::array<float,2>{0.909851432f, 0.0422831699f},
-std::array<float,2>{0.672402799f, 0.63868022f},
-std::array<float,2>{0.385345906f, 0.241831288f},
-std::array<float,2>{0.0525385141f, 0.843676686f},
-std::array<float,2>{0.75623244f, 0.419780552f},
-std::array<float,2>{0.937463582f, 0.924534976f},
-std::array<float,2>{0.231299877f, 0.296318054f},
-std::array<float,2>{0.283229083f, 0.569666922f},
-std::array<float,2>{0.619697094f, 0.024952447f},
-std::array<float,2>{0.814028859f, 0.507093608f},
-std::array<float,2>{0.0693860129f, 0.0744836032f},
-std::array<float,2>{0.480647683f, 0.98807162f},
-std::array<float,2>{0.723362088f, 0.325310349f},
-std::array<float,2>{0.503548801f, 0.751199722f},
-std::array<float,2>{0.371179521f, 0.46964407f},
-std::array<float,2>{0.149103284f, 0.720583379f},
-std::array<float,2>{0.939220667f, 0.179016992f},
-std::array<float,2>{0.584851086f, 0.600168347f},
-std::array<float,2>{0.275194228f, 0.0529122725f},
-std::array<float,2>{0.218013734f, 0.880429924f},
-std::array<float,2>{0.895701647f, 0.277913749f},
-std::array<float,2>{0.811618447f, 0.865346313f},
-std::array<float,2>{0.00966548733f, 0.379531026f},
-std::array<float,2>{0.435795903f, 0.672788382f},
-std::array<float,2>{0.639346361f, 0.215114042f},
-std::array<float,2>{0.998049915f, 0.690152109f},
-std::array<float,2>{0.167520419f, 0.140976533f},
-std::array<float,2>{0.314109415f, 0.788493812f},
-std::array<float,2>{0.553581059f, 0.437843293f},
-std::array<float,2>{0.707163632f, 0.957960367f},
-std::array<float,2>{0.445753932f, 0.358193278f},
-std::array<float,2>{0.117866307f, 0.561964989f},
-std::array<float,2>{0.865324914f, 0.114387684f},
-std::array<float,2>{0.569598973f, 0.700629652f},
-std::array<float,2>{0.251332045f, 0.153972507f},
-std::array<float,2>{0.19722195f, 0.795436025f},
-std::array<float,2>{0.887745142f, 0.449078172f},
-std::array<float,2>{0.793755889f, 0.965642631f},
-std::array<float,2>{0.0192930903f, 0.34554252f},
-std::array<float,2>{0.418151319f, 0.552463651f},
-std::array<float,2>{0.643058956f, 0.117544986f},
-std::array<float,2>{0.972405732f, 0.604897916f},
-std::array<float,2>{0.185590908f, 0.0575846247f},
-std::array<float,2>{0.337124795f, 0.890198827f},
-std::array<float,2>{0.535742044f, 0.272276133f},
-std::array<float,2>{0.692152619f, 0.87414968f},
-std::array<float,2>{0.468316883f, 0.389089167f},
-std::array<float,2>{0.097000964f, 0.679731786f},
-std::array<float,2>{0.858545244f, 0.210632578f},
-std::array<float,2>{0.66574502f, 0.51098603f},
-std::array<float,2>{0.390778691f, 0.0649426207f},
-std::array<float,2>{0.0410163403f, 0.994200349f},
-std::array<float,2>{0.775513172f, 0.316251427f},
-std::array<float,2>{0.910293877f, 0.76247251f},
-std::array<float,2>{0.246798843f, 0.483651578f},
-std::array<float,2>{0.300926775f, 0.733567894f},
-std::array<float,2>{0.600704491f, 0.186840788f},
-std::array<float,2>{0.834008157f, 0.627380192f},
-std::array<float,2>{0.0865801573f, 0.242587164f},
-std::array<float,2>{0.489902526f, 0.828321576f},
-std::array<float,2>{0.734455466f, 0.406861514f},
-std::array<float,2>{0.523902357f, 0.931913495f},
-std::array<float,2>{0.353466511f, 0.282577336f},
-std::array<float,2>{0.130467683f, 0.577154696f},
-std::array<float,2>{0.968320966f, 0.0157554112f},
-std::array<float,2>{0.722430229f, 0.667726874f},
-std::array<float,2>{0.476689249f, 0.201115862f},
-std::array<float,2>{0.0641132891f, 0.851538777f},
-std::array<float,2>{0.819232821f, 0.394229919f},
-std::array<float,2>{0.944180012f, 0.904955506f},
-std::array<float,2>{0.154062808f, 0.262209535f},
-std::array<float,2>{0.367629647f, 0.611046433f},
-std::array<float,2>{0.50516355f, 0.03683291f},
-std::array<float,2>{0.752333283f, 0.546850801f},
-std::array<float,2>{0.0485670306f, 0.103865191f},
-std::array<float,2>{0.389566213f, 0.951130569f},
-std::array<float,2>{0.679680169f, 0.365714878f},
-std::array<float,2>{0.622208536f, 0.809147477f},
-std::array<float,2>{0.286315203f, 0.466861308f},
-std::array<float,2>{0.23000975f, 0.708817363f},
-std::array<float,2>{0.933329463f, 0.130185872f},
-std::array<float,2>{0.547000766f, 0.580796838f},
-std::array<float,2>{0.318253398f, 0.000605547335f},
-std::array<float,2>{0.168129623f, 0.908230245f},
-std::array<float,2>{0.992755473f, 0.308520496f},
-std::array<float,2>{0.86135149f, 0.822117448f},
-std::array<float,2>{0.122418635f, 0.436567038f},
-std::array<float,2>{0.450608492f, 0.651345909f},
-std::array<float,2>{0.704175353f, 0.225785986f},
-std::array<float,2>{0.892177284f, 0.739303648f},
-std::array<float,2>{0.213328898f, 0.16634503f},
-std::array<float,2>{0.280696541f, 0.773118258f},
-std::array<float,2>{0.578530729f, 0.498437166f},
-std::array<float,2>{0.632905245f, 0.976325333f},
-std::array<float,2>{0.432300955f, 0.333111763f},
-std::array<float,2>{0.0137653165f, 0.523800075f},
-std::array<float,2>{0.807867646f, 0.0838528797f},
-std::array<float,2>{0.509791613f, 0.646849692f},
-std::array<float,2>{0.366517067f, 0.233361378f},
-std::array<float,2>{0.141657308f, 0.813738108f},
-std::array<float,2>{0.949043155f, 0.425980955f},
-std::array<float,2>{0.823651373f, 0.918130815f},
-std::array<float,2>{0.0706905797f, 0.299669594f},
-std::array<float,2>{0.475075722f, 0.587993264f},
-std::array<float,2>{0.73014456f, 0.00976442546f},
-std::array<float,2>{0.922759235f, 0.519426942f},
-std::array<float,2>{0.221598074f, 0.0865720436f},
-std::array<float,2>{0.29659462f, 0.979520023f},
-std::array<float,2>{0.611335933f, 0.340867132f},
-std::array<float,2>{0.681318998f, 0.775120795f},
-std::array<float,2>{0.38198474f, 0.485874444f},
-std::array<float,2>{0.0593728237f, 0.747557938f},
-std::array<float,2>{0.760585546f, 0.15807119f},
-std::array<float,2>{0.712630749f, 0.624065876f},
-std::array<float,2>{0.44402051f, 0.0434302315f},
-std::array<float,2>{0.113571979f, 0.895482957f},
-std::array<float,2>{0.868850052f, 0.251479715f},
-std::array<float,2>{0.989737272f, 0.857340336f},
-std::array<float,2>{0.162831411f, 0.404930443f},
-std::array<float,2>{0.322001159f, 0.662290812f},
-std::array<float,2>{0.560089111f, 0.189249992f},
-std::array<float,2>{0.80341047f, 0.71497637f},
-std::array<float,2>{0.000225137876f, 0.137347564f},
-std::array<float,2>{0.428893477f, 0.800118923f},
-std::array<float,2>{0.629175484f, 0.456453115f},
-std::array<float,2>{0.586436689f, 0.942273438f},
-std::array<float,2>{0.266124398f, 0.370939791f},
-std::array<float,2>{0.21054031f, 0.534617901f},
-std::array<float,2>{0.900193572f, 0.0951532274f},
-std::array<float,2>{0.652023315f, 0.724929631f},
-std::array<float,2>{0.410749644f, 0.175747052f},
-std::array<float,2>{0.027516542f, 0.755436003f},
-std::array<float,2>{0.784788609f, 0.474891275f},
-std::array<float,2>{0.875469863f, 0.989959359f},
-std::array<float,2>{0.187589407f, 0.322957546f},
-std::array<float,2>{0.260688931f, 0.500498831f},
-std::array<float,2>{0.576953411f, 0.0712494478f},
-std::array<float,2>{0.843968868f, 0.56434238f},
-std::array<float,2>{0.102495976f, 0.0294693056f},
-std::array<float,2>{0.457453609f, 0.926864982f},
-std::array<float,2>{0.701584637f, 0.289167523f},
-std::array<float,2>{0.543369949f, 0.839823902f},
-std::array<float,2>{0.32956931f, 0.414826274f},
-std::array<float,2>{0.17755422f, 0.635276198f},
-std::array<float,2>{0.98176837f, 0.237637147f},
-std::array<float,2>{0.604289055f, 0.556901991f},
-std::array<float,2>{0.305695146f, 0.110193126f},
-std::array<float,2>{0.237861872f, 0.953570604f},
-std::array<float,2>{0.916652799f, 0.354173243f},
-std::array<float,2>{0.773426235f, 0.784063339f},
-std::array<float,2>{0.0323559865f, 0.442498237f},
-std::array<float,2>{0.399502099f, 0.69448638f},
-std::array<float,2>{0.660622478f, 0.148149356f},
-std::array<float,2>{0.955545127f, 0.677389324f},
-std::array<float,2>{0.13980487f, 0.214236677f},
-std::array<float,2>{0.347851634f, 0.862543344f},
-std::array<float,2>{0.516812205f, 0.376060098f},
-std::array<float,2>{0.747759581f, 0.878448904f},
-std::array<float,2>{0.49306941f, 0.274491161f},
-std::array<float,2>{0.0845969766f, 0.596559286f},
-std::array<float,2>{0.836355984f, 0.0490568504f},
-std::array<float,2>{0.591266334f, 0.631711185f},
-std::array<float,2>{0.270851612f, 0.24815537f},
-std::array<float,2>{0.203634754f, 0.835033655f},
-std::array<float,2>{0.905427158f, 0.410596162f},
-std::array<float,2>{0.796912789f, 0.935253739f},
-std::array<float,2>{0.00436873361f, 0.286341459f},
-std::array<float,2>{0.42293936f, 0.570677936f},
-std::array<float,2>{0.62654686f, 0.0200152546f},
-std::array<float,2>{0.984615386f, 0.514220834f},
-std::array<float,2>{0.156260327f, 0.0690160394f},
-std::array<float,2>{0.327542901f, 0.999361098f},
-std::array<float,2>{0.555127978f, 0.317267537f},
-std::array<float,2>{0.717874348f, 0.760537982f},
-std::array<float,2>{0.438324332f, 0.477487683f},
-std::array<float,2>{0.110926665f, 0.728782773f},
-std::array<float,2>{0.871110559f, 0.182952121f},
-std::array<float,2>{0.68508631f, 0.606547058f},
-std::array<float,2>{0.375929654f, 0.061715737f},
-std::array<float,2>{0.0572532527f, 0.884319961f},
-std::array<float,2>{0.763514161f, 0.268678606f},
-std::array<float,2>{0.92967993f, 0.867234945f},
-std::array<float,2>{0.225193664f, 0.386244565f},
-std::array<float,2>{0.292051405f, 0.687381446f},
-std::array<float,2>{0.615595281f, 0.204224914f},
-std::array<float,2>{0.82696563f, 0.698596001f},
-std::array<float,2>{0.0750883669f, 0.149924248f},
-std::array<float,2>{0.471343011f, 0.789420545f},
-std::array<float,2>{0.730986238f, 0.45117873f},
-std::array<float,2>{0.513520837f, 0.96372062f},
-std::array<float,2>{0.360830218f, 0.350097299f},
-std::array<float,2>{0.147549495f, 0.549729645f},
-std::array<float,2>{0.951157093f, 0.121624134f},
-std::array<float,2>{0.74562645f, 0.737841308f},
-std::array<float,2>{0.496170521f, 0.170402348f},
-std::array<float,2>{0.0800603777f, 0.768331051f},
-std::array<float,2>{0.840228081f, 0.493240803f},
-std::array<float,2>{0.958466768f, 0.970922947f},
-std::array<float,2>{0.136070594f, 0.328741372f},
-std::array<float,2>{0.346398979f, 0.530431628f},
-std::array<float,2>{0.521444142f, 0.0797418579f},
-std::array<float,2>{0.766187727f, 0.585126996f},
-std::array<float,2>{0.0370058455f, 0.00709741702f},
-std::array<float,2>{0.404544741f, 0.912419379f},
-std::array<float,2>{0.659804344f, 0.31028375f},
-std::array<float,2>{0.60839355f, 0.824805737f},
-std::array<float,2>{0.311946958f, 0.431401491f},
-std::array<float,2>{0.240647778f, 0.653201401f},
-std::array<float,2>{0.92120719f, 0.219074264f},
-std::array<float,2>{0.541882396f, 0.541900396f},
-std::array<float,2>{0.335754365f, 0.10639824f},
-std::array<float,2>{0.174444258f, 0.945964098f},
-std::array<float,2>{0.979800582f, 0.361105531f},
-std::array<float,2>{0.847883701f, 0.807144165f},
-std::array<float,2>{0.108555719f, 0.463614553f},
-std::array<float,2>{0.453747809f, 0.704168797f},
-std::array<float,2>{0.698266566f, 0.126650751f},
-std::array<float,2>{0.881399095f, 0.671028912f},
-std::array<float,2>{0.194095626f, 0.196758628f},
-std::array<float,2>{0.264272928f, 0.844252944f},
-std::array<float,2>{0.573285997f, 0.395951599f},
-std::array<float,2>{0.654638171f, 0.901028991f},
-std::array<float,2>{0.409569561f, 0.260416627f},
-std::array<float,2>{0.0266286619f, 0.615549266f},
-std::array<float,2>{0.785997689f, 0.0321174152f},
-std::array<float,2>{0.531045318f, 0.711644709f},
-std::array<float,2>{0.357153744f, 0.133731186f},
-std::array<float,2>{0.127444148f, 0.801324606f},
-std::array<float,2>{0.963358819f, 0.458748251f},
-std::array<float,2>{0.829339981f, 0.939224422f},
-std::array<float,2>{0.0914997905f, 0.371426672f},
-std::array<float,2>{0.486564994f, 0.537522972f},
-std::array<float,2>{0.742159903f, 0.100003175f},
-std::array<float,2>{0.907451153f, 0.617941797f},
-std::array<float,2>{0.243389159f, 0.0406023823f},
-std::array<float,2>{0.297676623f, 0.891237378f},
-std::array<float,2>{0.597566783f, 0.256600469f},
-std::array<float,2>{0.671657562f, 0.855218112f},
-std::array<float,2>{0.397287786f, 0.399218589f},
-std::array<float,2>{0.0444861017f, 0.659998477f},
-std::array<float,2>{0.777571917f, 0.193900764f},
-std::array<float,2>{0.690220356f, 0.523254752f},
-std::array<float,2>{0.46109125f, 0.0906524435f},
-std::array<float,2>{0.097957924f, 0.982511997f},
-std::array<float,2>{0.853037953f, 0.338670373f},
-std::array<float,2>{0.974506795f, 0.780959904f},
-std::array<float,2>{0.180762723f, 0.492107987f},
-std::array<float,2>{0.340800613f, 0.742711842f},
-std::array<float,2>{0.534410477f, 0.16112189f},
-std::array<float,2>{0.791275799f, 0.640868127f},
-std::array<float,2>{0.0217241906f, 0.227660745f},
-std::array<float,2>{0.41522795f, 0.817388237f},
-std::array<float,2>{0.64505583f, 0.424343318f},
-std::array<float,2>{0.565746903f, 0.915685534f},
-std::array<float,2>{0.255212337f, 0.303327918f},
-std::array<float,2>{0.200735301f, 0.592571378f},
-std::array<float,2>{0.886314809f, 0.0137464898f},
-std::array<float,2>{0.638499796f, 0.674021006f},
-std::array<float,2>{0.435163587f, 0.217469692f},
-std::array<float,2>{0.0100864135f, 0.863856554f},
-std::array<float,2>{0.809392095f, 0.381353348f},
-std::array<float,2>{0.896756947f, 0.880897224f},
-std::array<float,2>{0.216426671f, 0.279623836f},
-std::array<float,2>{0.276979774f, 0.597772539f},
-std::array<float,2>{0.582879961f, 0.0513549596f},
-std::array<float,2>{0.865031481f, 0.559645712f},
-std::array<float,2>{0.119789869f, 0.116404794f},
-std::array<float,2>{0.447690487f, 0.958997607f},
-std::array<float,2>{0.709623098f, 0.355472863f},
-std::array<float,2>{0.551529109f, 0.785433888f},
-std::array<float,2>{0.314748913f, 0.440160424f},
-std::array<float,2>{0.165765956f, 0.688313365f},
-std::array<float,2>{0.996147931f, 0.143078879f},
-std::array<float,2>{0.618472695f, 0.567396224f},
-std::array<float,2>{0.281576484f, 0.0264608487f},
-std::array<float,2>{0.234324887f, 0.922193587f},
-std::array<float,2>{0.933731258f, 0.293736637f},
-std::array<float,2>{0.754165232f, 0.841399908f},
-std::array<float,2>{0.0544248112f, 0.421427071f},
-std::array<float,2>{0.383760065f, 0.638616323f},
-std::array<float,2>{0.675650001f, 0.238878623f},
-std::array<float,2>{0.941010237f, 0.721595228f},
-std::array<float,2>{0.151029646f, 0.176482886f},
-std::array<float,2>{0.374655247f, 0.752947152f},
-std::array<float,2>{0.501807988f, 0.472525179f},
-std::array<float,2>{0.725543559f, 0.984487712f},
-std::array<float,2>{0.483671546f, 0.328004032f},
-std::array<float,2>{0.067500785f, 0.504466474f},
-std::array<float,2>{0.81522429f, 0.0766648278f},
-std::array<float,2>{0.599291325f, 0.731255233f},
-std::array<float,2>{0.304162771f, 0.185162187f},
-std::array<float,2>{0.248181269f, 0.764981508f},
-std::array<float,2>{0.913245142f, 0.481145769f},
-std::array<float,2>{0.77463305f, 0.993788302f},
-std::array<float,2>{0.0399626307f, 0.313764483f},
-std::array<float,2>{0.394411445f, 0.50827688f},
-std::array<float,2>{0.667529285f, 0.0642110109f},
-std::array<float,2>{0.965036154f, 0.575235665f},
-std::array<float,2>{0.132093176f, 0.0191871375f},
-std::array<float,2>{0.353859305f, 0.930819988f},
-std::array<float,2>{0.527259648f, 0.284527332f},
-std::array<float,2>{0.738147736f, 0.831742823f},
-std::array<float,2>{0.492071539f, 0.408885181f},
-std::array<float,2>{0.0888145268f, 0.626915038f},
-std::array<float,2>{0.833361804f, 0.244701877f},
-std::array<float,2>{0.641634524f, 0.553857267f},
-std::array<float,2>{0.420812607f, 0.120721512f},
-std::array<float,2>{0.0170635153f, 0.967424512f},
-std::array<float,2>{0.796668112f, 0.346232921f},
-std::array<float,2>{0.889301956f, 0.794316709f},
-std::array<float,2>{0.198573932f, 0.447044343f},
-std::array<float,2>{0.252048075f, 0.70202893f},
-std::array<float,2>{0.567299426f, 0.156194374f},
-std::array<float,2>{0.855938673f, 0.681801856f},
-std::array<float,2>{0.0945954174f, 0.208856031f},
-std::array<float,2>{0.466049999f, 0.8730039f},
-std::array<float,2>{0.695120871f, 0.388099313f},
-std::array<float,2>{0.537895381f, 0.888356626f},
-std::array<float,2>{0.338044584f, 0.270021558f},
-std::array<float,2>{0.184490517f, 0.603097856f},
-std::array<float,2>{0.969490111f, 0.0556822233f},
-std::array<float,2>{0.705257118f, 0.649520099f},
-std::array<float,2>{0.452877402f, 0.22329931f},
-std::array<float,2>{0.124660075f, 0.823253632f},
-std::array<float,2>{0.860527575f, 0.434518695f},
-std::array<float,2>{0.994309068f, 0.907544971f},
-std::array<float,2>{0.171730742f, 0.306496501f},
-std::array<float,2>{0.319105506f, 0.579170465f},
-std::array<float,2>{0.550564051f, 0.00290506054f},
-std::array<float,2>{0.806236506f, 0.526372313f},
-std::array<float,2>{0.012524019f, 0.0850813463f},
-std::array<float,2>{0.430466592f, 0.972890615f},
-std::array<float,2>{0.634975553f, 0.335013449f},
-std::array<float,2>{0.580459297f, 0.770535231f},
-std::array<float,2>{0.278417498f, 0.49720189f},
-std::array<float,2>{0.21169579f, 0.741814315f},
-std::array<float,2>{0.893535674f, 0.165726095f},
-std::array<float,2>{0.506898403f, 0.612310886f},
-std::array<float,2>{0.369681686f, 0.0372585393f},
-std::array<float,2>{0.155759767f, 0.902624249f},
-std::array<float,2>{0.942967117f, 0.26448676f},
-std::array<float,2>{0.8171013f, 0.847847462f},
-std::array<float,2>{0.0662977472f, 0.391886801f},
-std::array<float,2>{0.479706705f, 0.664331198f},
-std::array<float,2>{0.72030592f, 0.202478319f},
-std::array<float,2>{0.930099964f, 0.710547686f},
-std::array<float,2>{0.227919698f, 0.131398678f},
-std::array<float,2>{0.287177235f, 0.811312854f},
-std::array<float,2>{0.62466079f, 0.465293646f},
-std::array<float,2>{0.67614001f, 0.952102721f},
-std::array<float,2>{0.387806088f, 0.364271581f},
-std::array<float,2>{0.049352631f, 0.544660091f},
-std::array<float,2>{0.751572013f, 0.102107793f},
-std::array<float,2>{0.562423468f, 0.66044718f},
-std::array<float,2>{0.323550224f, 0.189828575f},
-std::array<float,2>{0.161049828f, 0.859134257f},
-std::array<float,2>{0.991835535f, 0.403902024f},
-std::array<float,2>{0.870635927f, 0.896593571f},
-std::array<float,2>{0.116292112f, 0.253080428f},
-std::array<float,2>{0.441443264f, 0.622278869f},
-std::array<float,2>{0.714296639f, 0.0468080752f},
-std::array<float,2>{0.902276933f, 0.531821072f},
-std::array<float,2>{0.207432806f, 0.0964279696f},
-std::array<float,2>{0.267938405f, 0.943932056f},
-std::array<float,2>{0.589383841f, 0.367423892f},
-std::array<float,2>{0.631040931f, 0.798571706f},
-std::array<float,2>{0.427577913f, 0.454382151f},
-std::array<float,2>{0.00257010502f, 0.718717754f},
-std::array<float,2>{0.801020503f, 0.139398083f},
-std::array<float,2>{0.726612926f, 0.585976601f},
-std::array<float,2>{0.474603534f, 0.0113169169f},
-std::array<float,2>{0.0727941543f, 0.921306968f},
-std::array<float,2>{0.822187781f, 0.298804462f},
-std::array<float,2>{0.947122455f, 0.815925539f},
-std::array<float,2>{0.144226506f, 0.428472519f},
-std::array<float,2>{0.364809632f, 0.646048427f},
-std::array<float,2>{0.50800252f, 0.231041759f},
-std::array<float,2>{0.758322179f, 0.748835802f},
-std::array<float,2>{0.0610919595f, 0.1595705f},
-std::array<float,2>{0.38003388f, 0.775977314f},
-std::array<float,2>{0.681744397f, 0.487704098f},
-std::array<float,2>{0.610081375f, 0.978430986f},
-std::array<float,2>{0.294657201f, 0.342395812f},
-std::array<float,2>{0.219180346f, 0.516271651f},
-std::array<float,2>{0.92444998f, 0.0893542245f},
-std::array<float,2>{0.662931323f, 0.692395508f},
-std::array<float,2>{0.400907576f, 0.145290688f},
-std::array<float,2>{0.0346045159f, 0.782177091f},
-std::array<float,2>{0.770262003f, 0.443730712f},
-std::array<float,2>{0.915366232f, 0.955695987f},
-std::array<float,2>{0.23438926f, 0.352803141f},
-std::array<float,2>{0.308557391f, 0.555170834f},
-std::array<float,2>{0.601800978f, 0.112766214f},
-std::array<float,2>{0.838559985f, 0.593815863f},
-std::array<float,2>{0.0825617611f, 0.0478067659f},
-std::array<float,2>{0.495269537f, 0.876463354f},
-std::array<float,2>{0.748309135f, 0.276510745f},
-std::array<float,2>{0.518580794f, 0.860402465f},
-std::array<float,2>{0.351524234f, 0.377254158f},
-std::array<float,2>{0.136880443f, 0.679586828f},
-std::array<float,2>{0.953541815f, 0.21227929f},
-std::array<float,2>{0.574521959f, 0.503243446f},
-std::array<float,2>{0.258296967f, 0.0728727654f},
-std::array<float,2>{0.190313339f, 0.991160572f},
-std::array<float,2>{0.878608525f, 0.321257889f},
-std::array<float,2>{0.782033801f, 0.756036937f},
-std::array<float,2>{0.0297262445f, 0.473577231f},
-std::array<float,2>{0.413238019f, 0.722732961f},
-std::array<float,2>{0.649119496f, 0.17325063f},
-std::array<float,2>{0.982764423f, 0.634017229f},
-std::array<float,2>{0.179498345f, 0.234522805f},
-std::array<float,2>{0.331617385f, 0.836571515f},
-std::array<float,2>{0.545709133f, 0.41680485f},
-std::array<float,2>{0.699223399f, 0.929325402f},
-std::array<float,2>{0.460599422f, 0.29107666f},
-std::array<float,2>{0.104377434f, 0.564476132f},
-std::array<float,2>{0.845983088f, 0.0275512412f},
-std::array<float,2>{0.572960854f, 0.669709086f},
-std::array<float,2>{0.264870405f, 0.197649062f},
-std::array<float,2>{0.195072502f, 0.847640216f},
-std::array<float,2>{0.882218182f, 0.397729188f},
-std::array<float,2>{0.786515057f, 0.899706662f},
-std::array<float,2>{0.0259712581f, 0.257958204f},
-std::array<float,2>{0.408704191f, 0.614274263f},
-std::array<float,2>{0.655997813f, 0.0345781222f},
-std::array<float,2>{0.97853756f, 0.539512336f},
-std::array<float,2>{0.175541207f, 0.107806049f},
-std::array<float,2>{0.334132522f, 0.94914341f},
-std::array<float,2>{0.542472482f, 0.362862319f},
-std::array<float,2>{0.697322726f, 0.80651933f},
-std::array<float,2>{0.454279006f, 0.461314678f},
-std::array<float,2>{0.107423529f, 0.706273496f},
-std::array<float,2>{0.848800123f, 0.12750186f},
-std::array<float,2>{0.659010828f, 0.582049847f},
-std::array<float,2>{0.405347675f, 0.0051915776f},
-std::array<float,2>{0.0358163714f, 0.910762608f},
-std::array<float,2>{0.767210305f, 0.311546504f},
-std::array<float,2>{0.92005682f, 0.827213228f},
-std::array<float,2>{0.241443142f, 0.433077067f},
-std::array<float,2>{0.311341971f, 0.65591234f},
-std::array<float,2>{0.609207392f, 0.222175866f},
-std::array<float,2>{0.841167271f, 0.735666871f},
-std::array<float,2>{0.0789260268f, 0.169450328f},
-std::array<float,2>{0.497228295f, 0.766309559f},
-std::array<float,2>{0.744745135f, 0.495561302f},
-std::array<float,2>{0.519901931f, 0.970001578f},
-std::array<float,2>{0.347232848f, 0.331292331f},
-std::array<float,2>{0.135061309f, 0.528493106f},
-std::array<float,2>{0.957253218f, 0.0817556158f},
-std::array<float,2>{0.732296526f, 0.695607424f},
-std::array<float,2>{0.472278267f, 0.152103692f},
-std::array<float,2>{0.0758460611f, 0.792693436f},
-std::array<float,2>{0.827205777f, 0.450810492f},
-std::array<float,2>{0.94996649f, 0.961671472f},
-std::array<float,2>{0.146771714f, 0.348374933f},
-std::array<float,2>{0.360335231f, 0.548706949f},
-std::array<float,2>{0.512163818f, 0.124835074f},
-std::array<float,2>{0.762607515f, 0.608000517f},
-std::array<float,2>{0.0582278334f, 0.0591082573f},
-std::array<float,2>{0.37648192f, 0.886618793f},
-std::array<float,2>{0.683680236f, 0.266317189f},
-std::array<float,2>{0.616964042f, 0.870329618f},
-std::array<float,2>{0.29105708f, 0.383600891f},
-std::array<float,2>{0.226253852f, 0.68361938f},
-std::array<float,2>{0.928520441f, 0.206320494f},
-std::array<float,2>{0.555965126f, 0.511767864f},
-std::array<float,2>{0.327086866f, 0.0667073876f},
-std::array<float,2>{0.157332584f, 0.996241271f},
-std::array<float,2>{0.985940397f, 0.320224345f},
-std::array<float,2>{0.872541428f, 0.758013725f},
-std::array<float,2>{0.109512411f, 0.479667813f},
-std::array<float,2>{0.439083487f, 0.727449477f},
-std::array<float,2>{0.716910124f, 0.180460393f},
-std::array<float,2>{0.905030668f, 0.629807413f},
-std::array<float,2>{0.205062091f, 0.246779472f},
-std::array<float,2>{0.27023223f, 0.832744777f},
-std::array<float,2>{0.590185046f, 0.412685305f},
-std::array<float,2>{0.625443459f, 0.936738312f},
-std::array<float,2>{0.422395021f, 0.28872025f},
-std::array<float,2>{0.00569295278f, 0.57334137f},
-std::array<float,2>{0.798798978f, 0.0216919575f},
-std::array<float,2>{0.50036937f, 0.718988478f},
-std::array<float,2>{0.373991877f, 0.178689376f},
-std::array<float,2>{0.151779324f, 0.750806749f},
-std::array<float,2>{0.93994987f, 0.469786257f},
-std::array<float,2>{0.816016078f, 0.987225354f},
-std::array<float,2>{0.0672736987f, 0.324563771f},
-std::array<float,2>{0.482600927f, 0.505995691f},
-std::array<float,2>{0.72638005f, 0.0754690394f},
-std::array<float,2>{0.935266435f, 0.569105744f},
-std::array<float,2>{0.232960433f, 0.0239678938f},
-std::array<float,2>{0.282274187f, 0.925126612f},
-std::array<float,2>{0.617956996f, 0.295872033f},
-std::array<float,2>{0.673993349f, 0.842268467f},
-std::array<float,2>{0.383929133f, 0.41856575f},
-std::array<float,2>{0.053456068f, 0.639852166f},
-std::array<float,2>{0.755105257f, 0.241085529f},
-std::array<float,2>{0.710436344f, 0.56081152f},
-std::array<float,2>{0.448285401f, 0.114134021f},
-std::array<float,2>{0.120444633f, 0.958547413f},
-std::array<float,2>{0.863807142f, 0.359227389f},
-std::array<float,2>{0.997296095f, 0.787965357f},
-std::array<float,2>{0.164794534f, 0.439172745f},
-std::array<float,2>{0.315462649f, 0.690644324f},
-std::array<float,2>{0.55209595f, 0.142522588f},
-std::array<float,2>{0.810493708f, 0.673630953f},
-std::array<float,2>{0.0114955818f, 0.216707721f},
-std::array<float,2>{0.434251308f, 0.866332591f},
-std::array<float,2>{0.637274444f, 0.380628794f},
-std::array<float,2>{0.58364898f, 0.879373193f},
-std::array<float,2>{0.276037723f, 0.278618038f},
-std::array<float,2>{0.215007663f, 0.600946009f},
-std::array<float,2>{0.898239493f, 0.0544181801f},
-std::array<float,2>{0.645720363f, 0.643597245f},
-std::array<float,2>{0.414412588f, 0.22955136f},
-std::array<float,2>{0.0234360229f, 0.818754554f},
-std::array<float,2>{0.79267168f, 0.423763365f},
-std::array<float,2>{0.885707319f, 0.916134894f},
-std::array<float,2>{0.199888811f, 0.301818252f},
-std::array<float,2>{0.254834592f, 0.591040552f},
-std::array<float,2>{0.564773142f, 0.012501156f},
-std::array<float,2>{0.852156818f, 0.520255327f},
-std::array<float,2>{0.0992599875f, 0.0936217457f},
-std::array<float,2>{0.462077796f, 0.981751442f},
-std::array<float,2>{0.691125631f, 0.336669803f},
-std::array<float,2>{0.533300698f, 0.778083205f},
-std::array<float,2>{0.341694504f, 0.48897326f},
-std::array<float,2>{0.180380136f, 0.745989323f},
-std::array<float,2>{0.972899258f, 0.16288735f},
-std::array<float,2>{0.59617877f, 0.619951606f},
-std::array<float,2>{0.297905356f, 0.0418637358f},
-std::array<float,2>{0.242227137f, 0.892995059f},
-std::array<float,2>{0.90714258f, 0.254504353f},
-std::array<float,2>{0.778364897f, 0.852419317f},
-std::array<float,2>{0.0433669612f, 0.402215391f},
-std::array<float,2>{0.397799641f, 0.656347096f},
-std::array<float,2>{0.670837045f, 0.192248642f},
-std::array<float,2>{0.964767218f, 0.714748681f},
-std::array<float,2>{0.128146425f, 0.1355021f},
-std::array<float,2>{0.356066495f, 0.803766847f},
-std::array<float,2>{0.529881179f, 0.459339023f},
-std::array<float,2>{0.741080999f, 0.940499783f},
-std::array<float,2>{0.48801285f, 0.374535292f},
-std::array<float,2>{0.0906578526f, 0.535363197f},
-std::array<float,2>{0.829039752f, 0.0989975706f},
-std::array<float,2>{0.623327672f, 0.707985103f},
-std::array<float,2>{0.288637877f, 0.129747748f},
-std::array<float,2>{0.226764992f, 0.810386419f},
-std::array<float,2>{0.931457698f, 0.468063593f},
-std::array<float,2>{0.750496149f, 0.949940383f},
-std::array<float,2>{0.0500490479f, 0.366651773f},
-std::array<float,2>{0.387378484f, 0.545480609f},
-std::array<float,2>{0.677214861f, 0.104848027f},
-std::array<float,2>{0.941661239f, 0.609995425f},
-std::array<float,2>{0.154505938f, 0.0358672291f},
-std::array<float,2>{0.370609224f, 0.905359268f},
-std::array<float,2>{0.506780446f, 0.263532907f},
-std::array<float,2>{0.718998075f, 0.850487232f},
-std::array<float,2>{0.479252338f, 0.393146485f},
-std::array<float,2>{0.064563565f, 0.666507006f},
-std::array<float,2>{0.81788367f, 0.199849248f},
-std::array<float,2>{0.636228502f, 0.524673522f},
-std::array<float,2>{0.430845737f, 0.0825315565f},
-std::array<float,2>{0.0133644734f, 0.975390136f},
-std::array<float,2>{0.805229545f, 0.332609028f},
-std::array<float,2>{0.894273162f, 0.771988094f},
-std::array<float,2>{0.212006986f, 0.499934882f},
-std::array<float,2>{0.277522981f, 0.738784194f},
-std::array<float,2>{0.581633925f, 0.167838961f},
-std::array<float,2>{0.859405696f, 0.65208143f},
-std::array<float,2>{0.123734057f, 0.225001961f},
-std::array<float,2>{0.451603919f, 0.821239829f},
-std::array<float,2>{0.70631671f, 0.436414927f},
-std::array<float,2>{0.549341619f, 0.909915686f},
-std::array<float,2>{0.319924831f, 0.307235748f},
-std::array<float,2>{0.17087689f, 0.581762671f},
-std::array<float,2>{0.99521029f, 0.00112095487f},
-std::array<float,2>{0.694117248f, 0.680853546f},
-std::array<float,2>{0.465507984f, 0.209619805f},
-std::array<float,2>{0.0956888869f, 0.873639464f},
-std::array<float,2>{0.857151747f, 0.390116632f},
-std::array<float,2>{0.969949901f, 0.889118969f},
-std::array<float,2>{0.184982121f, 0.272990137f},
-std::array<float,2>{0.339101195f, 0.603674948f},
-std::array<float,2>{0.539049745f, 0.0576744974f},
-std::array<float,2>{0.795255661f, 0.551387787f},
-std::array<float,2>{0.0157930851f, 0.118288398f},
-std::array<float,2>{0.421481222f, 0.966119826f},
-std::array<float,2>{0.640834332f, 0.343893915f},
-std::array<float,2>{0.56779021f, 0.796386361f},
-std::array<float,2>{0.253312469f, 0.447420627f},
-std::array<float,2>{0.19803147f, 0.699872732f},
-std::array<float,2>{0.889791846f, 0.152754098f},
-std::array<float,2>{0.526148081f, 0.576978445f},
-std::array<float,2>{0.355100691f, 0.0169146862f},
-std::array<float,2>{0.131475672f, 0.933009088f},
-std::array<float,2>{0.966030717f, 0.281292051f},
-std::array<float,2>{0.832904935f, 0.829761922f},
-std::array<float,2>{0.0892214999f, 0.407279342f},
-std::array<float,2>{0.490728796f, 0.628902316f},
-std::array<float,2>{0.736410916f, 0.243366808f},
-std::array<float,2>{0.912893593f, 0.73296994f},
-std::array<float,2>{0.249598384f, 0.186295912f},
-std::array<float,2>{0.303169936f, 0.763153374f},
-std::array<float,2>{0.598248124f, 0.48277095f},
-std::array<float,2>{0.666540802f, 0.995504737f},
-std::array<float,2>{0.392709374f, 0.31458205f},
-std::array<float,2>{0.0401154459f, 0.510585785f},
-std::array<float,2>{0.773846388f, 0.0654638112f},
-std::array<float,2>{0.546780884f, 0.635865569f},
-std::array<float,2>{0.33040297f, 0.236477956f},
-std::array<float,2>{0.177781448f, 0.838188469f},
-std::array<float,2>{0.983761966f, 0.415952384f},
-std::array<float,2>{0.847184956f, 0.926598907f},
-std::array<float,2>{0.105262674f, 0.290849596f},
-std::array<float,2>{0.459799021f, 0.563355446f},
-std::array<float,2>{0.700774014f, 0.0306118447f},
-std::array<float,2>{0.877576649f, 0.501722515f},
-std::array<float,2>{0.191314802f, 0.0713496283f},
-std::array<float,2>{0.258820832f, 0.988338053f},
-std::array<float,2>{0.575243771f, 0.324063271f},
-std::array<float,2>{0.650234401f, 0.754360378f},
-std::array<float,2>{0.412711024f, 0.475969136f},
-std::array<float,2>{0.0311995912f, 0.725673318f},
-std::array<float,2>{0.783137441f, 0.174663857f},
-std::array<float,2>{0.749189854f, 0.59758538f},
-std::array<float,2>{0.494177431f, 0.0506240353f},
-std::array<float,2>{0.0836311951f, 0.877857447f},
-std::array<float,2>{0.839811087f, 0.273702651f},
-std::array<float,2>{0.954160273f, 0.861682773f},
-std::array<float,2>{0.137714967f, 0.375235111f},
-std::array<float,2>{0.349784255f, 0.676342547f},
-std::array<float,2>{0.51771611f, 0.213156477f},
-std::array<float,2>{0.771220446f, 0.693718731f},
-std::array<float,2>{0.0338267833f, 0.147183761f},
-std::array<float,2>{0.401908994f, 0.784378529f},
-std::array<float,2>{0.663855374f, 0.441466242f},
-std::array<float,2>{0.602827251f, 0.9548437f},
-std::array<float,2>{0.307611257f, 0.355048269f},
-std::array<float,2>{0.235797524f, 0.557891965f},
-std::array<float,2>{0.91482991f, 0.110382825f},
-std::array<float,2>{0.682733357f, 0.746792853f},
-std::array<float,2>{0.37979117f, 0.157052889f},
-std::array<float,2>{0.062008284f, 0.773520589f},
-std::array<float,2>{0.75960058f, 0.48450762f},
-std::array<float,2>{0.924811721f, 0.97938031f},
-std::array<float,2>{0.220389068f, 0.340220898f},
-std::array<float,2>{0.29362309f, 0.517777622f},
-std::array<float,2>{0.610607743f, 0.0874904543f},
-std::array<float,2>{0.820836544f, 0.589634478f},
-std::array<float,2>{0.0732509568f, 0.00786834583f},
-std::array<float,2>{0.473195344f, 0.919726729f},
-std::array<float,2>{0.727813423f, 0.299845308f},
-std::array<float,2>{0.509530902f, 0.812772274f},
-std::array<float,2>{0.364178091f, 0.427511245f},
-std::array<float,2>{0.142621025f, 0.647474587f},
-std::array<float,2>{0.94626826f, 0.234203845f},
-std::array<float,2>{0.588275731f, 0.534033358f},
-std::array<float,2>{0.269403934f, 0.0940269232f},
-std::array<float,2>{0.208149746f, 0.942487717f},
-std::array<float,2>{0.900664449f, 0.369546711f},
-std::array<float,2>{0.801791608f, 0.79923296f},
-std::array<float,2>{0.00315850112f, 0.455854177f},
-std::array<float,2>{0.426070988f, 0.716359317f},
-std::array<float,2>{0.632258296f, 0.138558298f},
-std::array<float,2>{0.990426421f, 0.663899243f},
-std::array<float,2>{0.161593989f, 0.187512994f},
-std::array<float,2>{0.322857678f, 0.856048703f},
-std::array<float,2>{0.561085463f, 0.405859351f},
-std::array<float,2>{0.712965786f, 0.896142066f},
-std::array<float,2>{0.443006396f, 0.250314474f},
-std::array<float,2>{0.116175912f, 0.623628557f},
-std::array<float,2>{0.869161308f, 0.0449136756f},
-std::array<float,2>{0.606282294f, 0.653917134f},
-std::array<float,2>{0.309928298f, 0.220052943f},
-std::array<float,2>{0.238660648f, 0.825692117f},
-std::array<float,2>{0.917998433f, 0.430226207f},
-std::array<float,2>{0.768419325f, 0.913134456f},
-std::array<float,2>{0.039040681f, 0.30918321f},
-std::array<float,2>{0.403804123f, 0.584616303f},
-std::array<float,2>{0.658180714f, 0.00670032622f},
-std::array<float,2>{0.959937751f, 0.529407144f},
-std::array<float,2>{0.133994505f, 0.0786790624f},
-std::array<float,2>{0.344041884f, 0.971909165f},
-std::array<float,2>{0.522026718f, 0.329677105f},
-std::array<float,2>{0.743924618f, 0.768927276f},
-std::array<float,2>{0.498876512f, 0.492287964f},
-std::array<float,2>{0.0813527629f, 0.736556768f},
-std::array<float,2>{0.843145013f, 0.171392947f},
-std::array<float,2>{0.653807104f, 0.617031455f},
-std::array<float,2>{0.407890439f, 0.0327290818f},
-std::array<float,2>{0.0236097425f, 0.901576996f},
-std::array<float,2>{0.788891375f, 0.261178315f},
-std::array<float,2>{0.879936755f, 0.84504956f},
-std::array<float,2>{0.192079753f, 0.394537896f},
-std::array<float,2>{0.262069851f, 0.670520186f},
-std::array<float,2>{0.571694791f, 0.195520937f},
-std::array<float,2>{0.849789262f, 0.703406453f},
-std::array<float,2>{0.10722217f, 0.125904828f},
-std::array<float,2>{0.455688328f, 0.807654083f},
-std::array<float,2>{0.696570933f, 0.464203417f},
-std::array<float,2>{0.539593995f, 0.946766496f},
-std::array<float,2>{0.333563566f, 0.359391093f},
-std::array<float,2>{0.173383847f, 0.542063236f},
-std::array<float,2>{0.977831483f, 0.107324377f},
-std::array<float,2>{0.71520561f, 0.729544878f},
-std::array<float,2>{0.440098941f, 0.182349771f},
-std::array<float,2>{0.113138899f, 0.761527658f},
-std::array<float,2>{0.873496711f, 0.478034586f},
-std::array<float,2>{0.988198817f, 0.998575926f},
-std::array<float,2>{0.158412039f, 0.317406505f},
-std::array<float,2>{0.325471371f, 0.515497744f},
-std::array<float,2>{0.558331251f, 0.0695468783f},
-std::array<float,2>{0.800216317f, 0.571669281f},
-std::array<float,2>{0.00778290536f, 0.0206024405f},
-std::array<float,2>{0.423929363f, 0.933956742f},
-std::array<float,2>{0.628379822f, 0.285399467f},
-std::array<float,2>{0.592331886f, 0.834026337f},
-std::array<float,2>{0.272515088f, 0.41153416f},
-std::array<float,2>{0.206962064f, 0.632623136f},
-std::array<float,2>{0.902599871f, 0.249421746f},
-std::array<float,2>{0.513760984f, 0.55050534f},
-std::array<float,2>{0.361986011f, 0.123002768f},
-std::array<float,2>{0.145122185f, 0.964245498f},
-std::array<float,2>{0.952623785f, 0.351081878f},
-std::array<float,2>{0.825376511f, 0.790489316f},
-std::array<float,2>{0.0776209235f, 0.452777416f},
-std::array<float,2>{0.469416767f, 0.697434843f},
-std::array<float,2>{0.733146012f, 0.148446336f},
-std::array<float,2>{0.926960647f, 0.686247885f},
-std::array<float,2>{0.224489897f, 0.203568071f},
-std::array<float,2>{0.289752692f, 0.868242443f},
-std::array<float,2>{0.613466263f, 0.385423034f},
-std::array<float,2>{0.686501682f, 0.883272827f},
-std::array<float,2>{0.378827423f, 0.268323153f},
-std::array<float,2>{0.0559052043f, 0.606373489f},
-std::array<float,2>{0.763908267f, 0.0608358532f},
-std::array<float,2>{0.553875566f, 0.688909352f},
-std::array<float,2>{0.312541604f, 0.143814474f},
-std::array<float,2>{0.166932046f, 0.786376238f},
-std::array<float,2>{0.99965018f, 0.440562606f},
-std::array<float,2>{0.866907656f, 0.960751772f},
-std::array<float,2>{0.118323348f, 0.35648647f},
-std::array<float,2>{0.446743011f, 0.559281349f},
-std::array<float,2>{0.708070576f, 0.115993053f},
-std::array<float,2>{0.894540191f, 0.598697126f},
-std::array<float,2>{0.217505977f, 0.0518521816f},
-std::array<float,2>{0.274006367f, 0.882181585f},
-std::array<float,2>{0.585703909f, 0.28046459f},
-std::array<float,2>{0.640446067f, 0.86485821f},
-std::array<float,2>{0.437147021f, 0.381891429f},
-std::array<float,2>{0.00856149197f, 0.675575197f},
-std::array<float,2>{0.811478913f, 0.218708441f},
-std::array<float,2>{0.723904788f, 0.505631745f},
-std::array<float,2>{0.481637865f, 0.0774201527f},
-std::array<float,2>{0.0693186298f, 0.985548854f},
-std::array<float,2>{0.813139737f, 0.32671231f},
-std::array<float,2>{0.937611997f, 0.752405703f},
-std::array<float,2>{0.150084093f, 0.471262187f},
-std::array<float,2>{0.372388721f, 0.722085655f},
-std::array<float,2>{0.502592564f, 0.177526295f},
-std::array<float,2>{0.75728929f, 0.637453437f},
-std::array<float,2>{0.0513242558f, 0.239321917f},
-std::array<float,2>{0.385788471f, 0.840580523f},
-std::array<float,2>{0.673639834f, 0.420823842f},
-std::array<float,2>{0.620442808f, 0.923631549f},
-std::array<float,2>{0.284686685f, 0.294187546f},
-std::array<float,2>{0.23199527f, 0.566680312f},
-std::array<float,2>{0.936153889f, 0.026142437f},
-std::array<float,2>{0.668723941f, 0.658271551f},
-std::array<float,2>{0.396327257f, 0.195199475f},
-std::array<float,2>{0.0462922566f, 0.854302824f},
-std::array<float,2>{0.780294836f, 0.400197327f},
-std::array<float,2>{0.908501029f, 0.892447233f},
-std::array<float,2>{0.245816424f, 0.257327348f},
-std::array<float,2>{0.299481302f, 0.618348956f},
-std::array<float,2>{0.594367087f, 0.0392527618f},
-std::array<float,2>{0.83026427f, 0.538854778f},
-std::array<float,2>{0.0932440534f, 0.100941218f},
-std::array<float,2>{0.485470742f, 0.937681437f},
-std::array<float,2>{0.739425302f, 0.372076392f},
-std::array<float,2>{0.528996348f, 0.801937222f},
-std::array<float,2>{0.358945638f, 0.457252204f},
-std::array<float,2>{0.125540346f, 0.712290943f},
-std::array<float,2>{0.961221993f, 0.134765506f},
-std::array<float,2>{0.563963413f, 0.593646884f},
-std::array<float,2>{0.257667392f, 0.0152276345f},
-std::array<float,2>{0.2029365f, 0.914288461f},
-std::array<float,2>{0.884027243f, 0.304447621f},
-std::array<float,2>{0.789823592f, 0.816795886f},
-std::array<float,2>{0.0199358035f, 0.425376028f},
-std::array<float,2>{0.416632861f, 0.64160496f},
-std::array<float,2>{0.646991074f, 0.227242962f},
-std::array<float,2>{0.975313604f, 0.743382454f},
-std::array<float,2>{0.181784689f, 0.161768183f},
-std::array<float,2>{0.343356162f, 0.779604197f},
-std::array<float,2>{0.532987773f, 0.490484506f},
-std::array<float,2>{0.689386487f, 0.983974397f},
-std::array<float,2>{0.464376003f, 0.339141786f},
-std::array<float,2>{0.100376479f, 0.522119105f},
-std::array<float,2>{0.854955852f, 0.091419667f},
-std::array<float,2>{0.579609513f, 0.740547121f},
-std::array<float,2>{0.279685199f, 0.164458215f},
-std::array<float,2>{0.214021102f, 0.769580305f},
-std::array<float,2>{0.891304135f, 0.497028887f},
-std::array<float,2>{0.80682832f, 0.973972976f},
-std::array<float,2>{0.0149575137f, 0.334953696f},
-std::array<float,2>{0.433187783f, 0.52586627f},
-std::array<float,2>{0.63445425f, 0.0844548196f},
-std::array<float,2>{0.99409914f, 0.578183055f},
-std::array<float,2>{0.169920728f, 0.00381054985f},
-std::array<float,2>{0.316725433f, 0.90633744f},
-std::array<float,2>{0.548343062f, 0.304886252f},
-std::array<float,2>{0.703808427f, 0.82243818f},
-std::array<float,2>{0.449460357f, 0.4351677f},
-std::array<float,2>{0.121619791f, 0.649201989f},
-std::array<float,2>{0.863215268f, 0.223866507f},
-std::array<float,2>{0.678507924f, 0.543760777f},
-std::array<float,2>{0.390555859f, 0.102920473f},
-std::array<float,2>{0.0471546017f, 0.952257872f},
-std::array<float,2>{0.753170431f, 0.36400491f},
-std::array<float,2>{0.93204993f, 0.812014878f},
-std::array<float,2>{0.229000106f, 0.466555268f},
-std::array<float,2>{0.285300642f, 0.709760308f},
-std::array<float,2>{0.621207297f, 0.132592887f},
-std::array<float,2>{0.819615602f, 0.66554594f},
-std::array<float,2>{0.0630341619f, 0.201371312f},
-std::array<float,2>{0.477808833f, 0.849453807f},
-std::array<float,2>{0.721463382f, 0.391050637f},
-std::array<float,2>{0.504580081f, 0.904111922f},
-std::array<float,2>{0.368970305f, 0.264879107f},
-std::array<float,2>{0.152697667f, 0.611804724f},
-std::array<float,2>{0.944995463f, 0.0388482399f},
-std::array<float,2>{0.736321807f, 0.62530607f},
-std::array<float,2>{0.489026308f, 0.245674476f},
-std::array<float,2>{0.08778923f, 0.830657721f},
-std::array<float,2>{0.835178435f, 0.410006046f},
-std::array<float,2>{0.96697557f, 0.929828644f},
-std::array<float,2>{0.129548177f, 0.283333927f},
-std::array<float,2>{0.352427363f, 0.574411452f},
-std::array<float,2>{0.525211871f, 0.0176018048f},
-std::array<float,2>{0.776675224f, 0.509390175f},
-std::array<float,2>{0.0423270799f, 0.0625012666f},
-std::array<float,2>{0.391715258f, 0.992613137f},
-std::array<float,2>{0.664437294f, 0.313337386f},
-std::array<float,2>{0.599983215f, 0.76415956f},
-std::array<float,2>{0.302546173f, 0.482383698f},
-std::array<float,2>{0.247353822f, 0.732364595f},
-std::array<float,2>{0.912087679f, 0.183898315f},
-std::array<float,2>{0.536478698f, 0.602374613f},
-std::array<float,2>{0.336245239f, 0.0554032102f},
-std::array<float,2>{0.1869753f, 0.887331069f},
-std::array<float,2>{0.971011639f, 0.270757586f},
-std::array<float,2>{0.85791117f, 0.871419311f},
-std::array<float,2>{0.0958410576f, 0.387517542f},
-std::array<float,2>{0.46745792f, 0.682871759f},
-std::array<float,2>{0.692488492f, 0.207167655f},
-std::array<float,2>{0.887294412f, 0.702180445f},
-std::array<float,2>{0.195990115f, 0.154869542f},
-std::array<float,2>{0.250492722f, 0.793607712f},
-std::array<float,2>{0.569305539f, 0.445982605f},
-std::array<float,2>{0.643741012f, 0.967778563f},
-std::array<float,2>{0.419132352f, 0.347109526f},
-std::array<float,2>{0.0179421846f, 0.553207338f},
-std::array<float,2>{0.794136107f, 0.120076708f},
-std::array<float,2>{0.516421854f, 0.678100765f},
-std::array<float,2>{0.34915331f, 0.211472392f},
-std::array<float,2>{0.139488369f, 0.860344052f},
-std::array<float,2>{0.956845105f, 0.378131062f},
-std::array<float,2>{0.837411046f, 0.875045836f},
-std::array<float,2>{0.085361369f, 0.27558884f},
-std::array<float,2>{0.493977755f, 0.595171273f},
-std::array<float,2>{0.746861994f, 0.0484939367f},
-std::array<float,2>{0.917481422f, 0.556577206f},
-std::array<float,2>{0.236600459f, 0.112103149f},
-std::array<float,2>{0.305265576f, 0.956652343f},
-std::array<float,2>{0.604932785f, 0.352220833f},
-std::array<float,2>{0.662002802f, 0.782960951f},
-std::array<float,2>{0.399288535f, 0.444723815f},
-std::array<float,2>{0.0315930545f, 0.691957176f},
-std::array<float,2>{0.771492302f, 0.146375939f},
-std::array<float,2>{0.702712297f, 0.565897822f},
-std::array<float,2>{0.458806396f, 0.0284294803f},
-std::array<float,2>{0.102584161f, 0.928271651f},
-std::array<float,2>{0.84494108f, 0.292681366f},
-std::array<float,2>{0.981327951f, 0.8369596f},
-std::array<float,2>{0.175791696f, 0.417469293f},
-std::array<float,2>{0.328793615f, 0.633137345f},
-std::array<float,2>{0.544589162f, 0.23616153f},
-std::array<float,2>{0.784097314f, 0.724205256f},
-std::array<float,2>{0.0287845246f, 0.171991825f},
-std::array<float,2>{0.411437631f, 0.757657409f},
-std::array<float,2>{0.651325405f, 0.474235892f},
-std::array<float,2>{0.577310383f, 0.991729081f},
-std::array<float,2>{0.260908306f, 0.322127432f},
-std::array<float,2>{0.188536838f, 0.502300858f},
-std::array<float,2>{0.876296103f, 0.0740415081f},
-std::array<float,2>{0.629898846f, 0.717526853f},
-std::array<float,2>{0.428600192f, 0.140409648f},
-std::array<float,2>{0.00111007993f, 0.797214925f},
-std::array<float,2>{0.80389452f, 0.45337674f},
-std::array<float,2>{0.899300516f, 0.944929719f},
-std::array<float,2>{0.209122822f, 0.368563086f},
-std::array<float,2>{0.267166853f, 0.532544672f},
-std::array<float,2>{0.587662876f, 0.097089991f},
-std::array<float,2>{0.867457211f, 0.621366918f},
-std::array<float,2>{0.114494935f, 0.0452000722f},
-std::array<float,2>{0.444666535f, 0.898233354f},
-std::array<float,2>{0.711515427f, 0.252862483f},
-std::array<float,2>{0.55932498f, 0.858036876f},
-std::array<float,2>{0.321248233f, 0.403123081f},
-std::array<float,2>{0.163107336f, 0.661677241f},
-std::array<float,2>{0.989102423f, 0.190464556f},
-std::array<float,2>{0.612934887f, 0.517349124f},
-std::array<float,2>{0.295196027f, 0.0884319171f},
-std::array<float,2>{0.221881449f, 0.97664541f},
-std::array<float,2>{0.923708498f, 0.343220234f},
-std::array<float,2>{0.760819495f, 0.776636064f},
-std::array<float,2>{0.05979155f, 0.487122506f},
-std::array<float,2>{0.38177672f, 0.749913514f},
-std::array<float,2>{0.680498242f, 0.1584066f},
-std::array<float,2>{0.948088169f, 0.645141721f},
-std::array<float,2>{0.141268134f, 0.23195821f},
-std::array<float,2>{0.36571303f, 0.815311074f},
-std::array<float,2>{0.510910451f, 0.429356664f},
-std::array<float,2>{0.72890991f, 0.920614481f},
-std::array<float,2>{0.475660205f, 0.297367424f},
-std::array<float,2>{0.0720311105f, 0.587164044f},
-std::array<float,2>{0.82250154f, 0.010344008f},
-std::array<float,2>{0.59379065f, 0.656771719f},
-std::array<float,2>{0.299287349f, 0.191838905f},
-std::array<float,2>{0.24519442f, 0.851988316f},
-std::array<float,2>{0.908779085f, 0.401578188f},
-std::array<float,2>{0.780883968f, 0.893528521f},
-std::array<float,2>{0.0466020107f, 0.25403142f},
-std::array<float,2>{0.395750284f, 0.619286418f},
-std::array<float,2>{0.668409467f, 0.0411914662f},
-std::array<float,2>{0.961639881f, 0.536079288f},
-std::array<float,2>{0.125382975f, 0.0994563475f},
-std::array<float,2>{0.358736515f, 0.941328704f},
-std::array<float,2>{0.528498352f, 0.374379694f},
-std::array<float,2>{0.739953339f, 0.80456841f},
-std::array<float,2>{0.486049026f, 0.459610909f},
-std::array<float,2>{0.0937421396f, 0.714174151f},
-std::array<float,2>{0.830818057f, 0.135217994f},
-std::array<float,2>{0.646606326f, 0.591319621f},
-std::array<float,2>{0.416427225f, 0.0121811163f},
-std::array<float,2>{0.0200818293f, 0.916603327f},
-std::array<float,2>{0.789326787f, 0.302428395f},
-std::array<float,2>{0.884728014f, 0.818872631f},
-std::array<float,2>{0.202517629f, 0.42304191f},
-std::array<float,2>{0.257231474f, 0.644205928f},
-std::array<float,2>{0.564278722f, 0.230220735f},
-std::array<float,2>{0.854987502f, 0.745439649f},
-std::array<float,2>{0.0997551382f, 0.162334785f},
-std::array<float,2>{0.464224845f, 0.777795613f},
-std::array<float,2>{0.688686073f, 0.488500208f},
-std::array<float,2>{0.532577157f, 0.982288003f},
-std::array<float,2>{0.343179286f, 0.336289197f},
-std::array<float,2>{0.182548702f, 0.519905806f},
-std::array<float,2>{0.974696279f, 0.0932163671f},
-std::array<float,2>{0.708539844f, 0.691057205f},
-std::array<float,2>{0.447114408f, 0.1417256f},
-std::array<float,2>{0.118916363f, 0.787596226f},
-std::array<float,2>{0.866619885f, 0.43859455f},
-std::array<float,2>{0.999231279f, 0.958299935f},
-std::array<float,2>{0.166090652f, 0.35855177f},
-std::array<float,2>{0.313152283f, 0.561071634f},
-std::array<float,2>{0.554245889f, 0.113662355f},
-std::array<float,2>{0.8110044f, 0.601204932f},
-std::array<float,2>{0.00798888318f, 0.0538899936f},
-std::array<float,2>{0.436985165f, 0.879608452f},
-std::array<float,2>{0.639678001f, 0.279107302f},
-std::array<float,2>{0.585171402f, 0.866833329f},
-std::array<float,2>{0.273621142f, 0.379901469f},
-std::array<float,2>{0.216963649f, 0.673232555f},
-std::array<float,2>{0.895146906f, 0.216189697f},
-std::array<float,2>{0.502336979f, 0.506749511f},
-std::array<float,2>{0.37303111f, 0.0760761797f},
-std::array<float,2>{0.149696141f, 0.986671329f},
-std::array<float,2>{0.938215613f, 0.325134873f},
-std::array<float,2>{0.812791169f, 0.75045532f},
-std::array<float,2>{0.068427451f, 0.470646232f},
-std::array<float,2>{0.482420743f, 0.719693244f},
-std::array<float,2>{0.724197447f, 0.177854672f},
-std::array<float,2>{0.935933053f, 0.640219271f},
-std::array<float,2>{0.231575146f, 0.240600631f},
-std::array<float,2>{0.28419292f, 0.842382669f},
-std::array<float,2>{0.620856404f, 0.417992264f},
-std::array<float,2>{0.673266709f, 0.92536062f},
-std::array<float,2>{0.38627249f, 0.294989467f},
-std::array<float,2>{0.0511374176f, 0.568617284f},
-std::array<float,2>{0.75775063f, 0.0234471429f},
-std::array<float,2>{0.557764351f, 0.726578414f},
-std::array<float,2>{0.326139718f, 0.179697454f},
-std::array<float,2>{0.158830404f, 0.758463979f},
-std::array<float,2>{0.987671912f, 0.480247468f},
-std::array<float,2>{0.873871922f, 0.996856451f},
-std::array<float,2>{0.112591319f, 0.319724709f},
-std::array<float,2>{0.439554513f, 0.512526512f},
-std::array<float,2>{0.715492725f, 0.0669116452f},
-std::array<float,2>{0.903069675f, 0.573890984f},
-std::array<float,2>{0.206361175f, 0.0224460401f},
-std::array<float,2>{0.273099363f, 0.937368512f},
-std::array<float,2>{0.592120647f, 0.288539797f},
-std::array<float,2>{0.628859878f, 0.832306564f},
-std::array<float,2>{0.424612045f, 0.412424892f},
-std::array<float,2>{0.00714223366f, 0.629136741f},
-std::array<float,2>{0.800311267f, 0.246412188f},
-std::array<float,2>{0.732692838f, 0.547854364f},
-std::array<float,2>{0.46914643f, 0.124450967f},
-std::array<float,2>{0.0777320564f, 0.961083233f},
-std::array<float,2>{0.82574439f, 0.347730666f},
-std::array<float,2>{0.95299542f, 0.792272925f},
-std::array<float,2>{0.14468351f, 0.450443745f},
-std::array<float,2>{0.361459941f, 0.69606781f},
-std::array<float,2>{0.514562011f, 0.151648656f},
-std::array<float,2>{0.764181614f, 0.68425113f},
-std::array<float,2>{0.0562792346f, 0.206909865f},
-std::array<float,2>{0.378046036f, 0.870607793f},
-std::array<float,2>{0.685676336f, 0.383047044f},
-std::array<float,2>{0.613817275f, 0.886073351f},
-std::array<float,2>{0.289081842f, 0.265914381f},
-std::array<float,2>{0.223644182f, 0.607528985f},
-std::array<float,2>{0.927349031f, 0.0590489767f},
-std::array<float,2>{0.657278776f, 0.655285716f},
-std::array<float,2>{0.404114515f, 0.221867591f},
-std::array<float,2>{0.0381713472f, 0.827917457f},
-std::array<float,2>{0.767850995f, 0.433303803f},
-std::array<float,2>{0.91846019f, 0.91020447f},
-std::array<float,2>{0.238792777f, 0.312159717f},
-std::array<float,2>{0.310376644f, 0.582768142f},
-std::array<float,2>{0.605930567f, 0.00551238377f},
-std::array<float,2>{0.843623817f, 0.529042304f},
-std::array<float,2>{0.0816045478f, 0.0811314657f},
-std::array<float,2>{0.498067141f, 0.970304787f},
-std::array<float,2>{0.743409157f, 0.331825733f},
-std::array<float,2>{0.521805108f, 0.765967786f},
-std::array<float,2>{0.344484538f, 0.496050268f},
-std::array<float,2>{0.134363741f, 0.736248076f},
-std::array<float,2>{0.959270537f, 0.16917707f},
-std::array<float,2>{0.571944058f, 0.614762604f},
-std::array<float,2>{0.262503892f, 0.0347061567f},
-std::array<float,2>{0.191541821f, 0.900160968f},
-std::array<float,2>{0.880599439f, 0.258778751f},
-std::array<float,2>{0.788123488f, 0.846785486f},
-std::array<float,2>{0.023987161f, 0.398413032f},
-std::array<float,2>{0.407288909f, 0.669173181f},
-std::array<float,2>{0.654149234f, 0.197774485f},
-std::array<float,2>{0.978059053f, 0.706862807f},
-std::array<float,2>{0.172921166f, 0.127138123f},
-std::array<float,2>{0.333274364f, 0.805767179f},
-std::array<float,2>{0.539080262f, 0.46166572f},
-std::array<float,2>{0.697060883f, 0.948682189f},
-std::array<float,2>{0.455448151f, 0.362465173f},
-std::array<float,2>{0.106455475f, 0.539790988f},
-std::array<float,2>{0.850552559f, 0.108152732f},
-std::array<float,2>{0.587352514f, 0.716062784f},
-std::array<float,2>{0.266632855f, 0.138003334f},
-std::array<float,2>{0.209547669f, 0.799785852f},
-std::array<float,2>{0.898644149f, 0.455416739f},
-std::array<float,2>{0.804638445f, 0.943135142f},
-std::array<float,2>{0.00192666997f, 0.369922519f},
-std::array<float,2>{0.427826434f, 0.533576429f},
-std::array<float,2>{0.630645394f, 0.0944289342f},
-std::array<float,2>{0.988398373f, 0.623242676f},
-std::array<float,2>{0.163618147f, 0.0441663601f},
-std::array<float,2>{0.320705175f, 0.895705402f},
-std::array<float,2>{0.558906615f, 0.250675082f},
-std::array<float,2>{0.711197853f, 0.855532944f},
-std::array<float,2>{0.445039839f, 0.405534744f},
-std::array<float,2>{0.114911877f, 0.66347146f},
-std::array<float,2>{0.867922366f, 0.188014999f},
-std::array<float,2>{0.679877281f, 0.518429995f},
-std::array<float,2>{0.381168991f, 0.0873582289f},
-std::array<float,2>{0.0602121688f, 0.978711367f},
-std::array<float,2>{0.761619627f, 0.340724587f},
-std::array<float,2>{0.923041821f, 0.774295449f},
-std::array<float,2>{0.222358346f, 0.485171586f},
-std::array<float,2>{0.295566946f, 0.746540308f},
-std::array<float,2>{0.612636507f, 0.156348154f},
-std::array<float,2>{0.823098421f, 0.648156047f},
-std::array<float,2>{0.0716482997f, 0.233560175f},
-std::array<float,2>{0.476418704f, 0.813367367f},
-std::array<float,2>{0.72909683f, 0.427099645f},
-std::array<float,2>{0.511479735f, 0.918983102f},
-std::array<float,2>{0.366193622f, 0.300690591f},
-std::array<float,2>{0.141042531f, 0.589108706f},
-std::array<float,2>{0.947375178f, 0.00867527723f},
-std::array<float,2>{0.746468902f, 0.676161408f},
-std::array<float,2>{0.493339658f, 0.213559493f},
-std::array<float,2>{0.0857402459f, 0.862001359f},
-std::array<float,2>{0.837019801f, 0.375548244f},
-std::array<float,2>{0.956234992f, 0.877300382f},
-std::array<float,2>{0.138800621f, 0.274261117f},
-std::array<float,2>{0.348913521f, 0.597008765f},
-std::array<float,2>{0.515926898f, 0.0501688831f},
-std::array<float,2>{0.772309959f, 0.558303177f},
-std::array<float,2>{0.0320177712f, 0.110887401f},
-std::array<float,2>{0.398833036f, 0.954208672f},
-std::array<float,2>{0.661298573f, 0.354742944f},
-std::array<float,2>{0.605148315f, 0.784680009f},
-std::array<float,2>{0.304826766f, 0.441974163f},
-std::array<float,2>{0.237074062f, 0.693868458f},
-std::array<float,2>{0.917010605f, 0.146917164f},
-std::array<float,2>{0.54401356f, 0.562675416f},
-std::array<float,2>{0.328344822f, 0.0309157688f},
-std::array<float,2>{0.176330835f, 0.925830722f},
-std::array<float,2>{0.980638444f, 0.290105641f},
-std::array<float,2>{0.845656216f, 0.838382363f},
-std::array<float,2>{0.103055343f, 0.415482521f},
-std::array<float,2>{0.458270222f, 0.636320829f},
-std::array<float,2>{0.702532053f, 0.237126261f},
-std::array<float,2>{0.876564443f, 0.726518095f},
-std::array<float,2>{0.189342901f, 0.174069196f},
-std::array<float,2>{0.261408746f, 0.754422188f},
-std::array<float,2>{0.577878952f, 0.476154745f},
-std::array<float,2>{0.650871575f, 0.988973081f},
-std::array<float,2>{0.412069857f, 0.323390633f},
-std::array<float,2>{0.0291660968f, 0.501174212f},
-std::array<float,2>{0.78354162f, 0.0721854866f},
-std::array<float,2>{0.524711609f, 0.628115475f},
-std::array<float,2>{0.351938248f, 0.244088709f},
-std::array<float,2>{0.129255384f, 0.829255998f},
-std::array<float,2>{0.967372179f, 0.407943249f},
-std::array<float,2>{0.835887849f, 0.933500409f},
-std::array<float,2>{0.0873061121f, 0.281965256f},
-std::array<float,2>{0.48847416f, 0.576263607f},
-std::array<float,2>{0.735505402f, 0.017531056f},
-std::array<float,2>{0.911619246f, 0.509945571f},
-std::array<float,2>{0.248031333f, 0.0661264583f},
-std::array<float,2>{0.301809788f, 0.99591738f},
-std::array<float,2>{0.600431502f, 0.315054685f},
-std::array<float,2>{0.66480571f, 0.763185799f},
-std::array<float,2>{0.39244318f, 0.482915968f},
-std::array<float,2>{0.042607177f, 0.732718706f},
-std::array<float,2>{0.777223766f, 0.185788527f},
-std::array<float,2>{0.693282425f, 0.604483008f},
-std::array<float,2>{0.466812611f, 0.058457166f},
-std::array<float,2>{0.0964589044f, 0.889533997f},
-std::array<float,2>{0.857623637f, 0.272770792f},
-std::array<float,2>{0.971273303f, 0.873305976f},
-std::array<float,2>{0.187165797f, 0.390598685f},
-std::array<float,2>{0.3367365f, 0.681292593f},
-std::array<float,2>{0.536887705f, 0.208990604f},
-std::array<float,2>{0.794514477f, 0.699560285f},
-std::array<float,2>{0.0182348955f, 0.153275624f},
-std::array<float,2>{0.419752538f, 0.796546638f},
-std::array<float,2>{0.644334912f, 0.447822958f},
-std::array<float,2>{0.568398058f, 0.966569841f},
-std::array<float,2>{0.250450134f, 0.344564617f},
-std::array<float,2>{0.195419759f, 0.551205099f},
-std::array<float,2>{0.887190938f, 0.119087137f},
-std::array<float,2>{0.634270906f, 0.738419592f},
-std::array<float,2>{0.432713091f, 0.167055786f},
-std::array<float,2>{0.0151370456f, 0.771630287f},
-std::array<float,2>{0.807455182f, 0.499477446f},
-std::array<float,2>{0.890713692f, 0.974745333f},
-std::array<float,2>{0.214782625f, 0.332484305f},
-std::array<float,2>{0.279869318f, 0.524998188f},
-std::array<float,2>{0.579297245f, 0.0820709765f},
-std::array<float,2>{0.862390876f, 0.581390977f},
-std::array<float,2>{0.12147335f, 0.00190850708f},
-std::array<float,2>{0.449864209f, 0.909516513f},
-std::array<float,2>{0.703287601f, 0.306773365f},
-std::array<float,2>{0.547936916f, 0.820704877f},
-std::array<float,2>{0.317360193f, 0.435590446f},
-std::array<float,2>{0.169320852f, 0.651432097f},
-std::array<float,2>{0.99362129f, 0.225505993f},
-std::array<float,2>{0.621628165f, 0.545182407f},
-std::array<float,2>{0.285757124f, 0.10529422f},
-std::array<float,2>{0.229447499f, 0.949590743f},
-std::array<float,2>{0.932457983f, 0.366968006f},
-std::array<float,2>{0.753550887f, 0.80996263f},
-std::array<float,2>{0.0475963913f, 0.46855101f},
-std::array<float,2>{0.389702171f, 0.707302153f},
-std::array<float,2>{0.677889884f, 0.128963709f},
-std::array<float,2>{0.944360375f, 0.666218996f},
-std::array<float,2>{0.152950108f, 0.199639753f},
-std::array<float,2>{0.368533105f, 0.849661469f},
-std::array<float,2>{0.50390625f, 0.392601877f},
-std::array<float,2>{0.720984995f, 0.906155705f},
-std::array<float,2>{0.478041589f, 0.262727171f},
-std::array<float,2>{0.0628433004f, 0.609527528f},
-std::array<float,2>{0.819930315f, 0.0353905335f},
-std::array<float,2>{0.565049291f, 0.642442822f},
-std::array<float,2>{0.254089564f, 0.226576149f},
-std::array<float,2>{0.199303672f, 0.817173183f},
-std::array<float,2>{0.884921789f, 0.425179988f},
-std::array<float,2>{0.792178214f, 0.914705276f},
-std::array<float,2>{0.0225966629f, 0.304096401f},
-std::array<float,2>{0.414675951f, 0.593225181f},
-std::array<float,2>{0.646268964f, 0.0147334551f},
-std::array<float,2>{0.973187923f, 0.521855474f},
-std::array<float,2>{0.179841593f, 0.0908290818f},
-std::array<float,2>{0.3409307f, 0.983511269f},
-std::array<float,2>{0.533852458f, 0.339584082f},
-std::array<float,2>{0.690731645f, 0.780219913f},
-std::array<float,2>{0.462855548f, 0.490850747f},
-std::array<float,2>{0.0986463055f, 0.743825436f},
-std::array<float,2>{0.851957202f, 0.161310032f},
-std::array<float,2>{0.670074224f, 0.618826926f},
-std::array<float,2>{0.398399621f, 0.039777413f},
-std::array<float,2>{0.0439204611f, 0.891875148f},
-std::array<float,2>{0.779171705f, 0.257115334f},
-std::array<float,2>{0.906261265f, 0.853606284f},
-std::array<float,2>{0.243129954f, 0.399822026f},
-std::array<float,2>{0.298414975f, 0.658966243f},
-std::array<float,2>{0.596400917f, 0.19460693f},
-std::array<float,2>{0.828201532f, 0.712633908f},
-std::array<float,2>{0.0903177187f, 0.134105697f},
-std::array<float,2>{0.487717867f, 0.802396119f},
-std::array<float,2>{0.740378857f, 0.458006531f},
-std::array<float,2>{0.529663086f, 0.938289702f},
-std::array<float,2>{0.355770141f, 0.37289694f},
-std::array<float,2>{0.128707275f, 0.538274288f},
-std::array<float,2>{0.964027166f, 0.101426303f},
-std::array<float,2>{0.725802898f, 0.722461462f},
-std::array<float,2>{0.483311266f, 0.177208036f},
-std::array<float,2>{0.0664303601f, 0.752659261f},
-std::array<float,2>{0.815579057f, 0.470869422f},
-std::array<float,2>{0.939886093f, 0.986020029f},
-std::array<float,2>{0.152329549f, 0.326401323f},
-std::array<float,2>{0.373409867f, 0.505238056f},
-std::array<float,2>{0.500818908f, 0.0780723542f},
-std::array<float,2>{0.755508482f, 0.567160308f},
-std::array<float,2>{0.0529271103f, 0.0257294811f},
-std::array<float,2>{0.384431869f, 0.923039138f},
-std::array<float,2>{0.67479223f, 0.294647068f},
-std::array<float,2>{0.617446303f, 0.839886069f},
-std::array<float,2>{0.283136666f, 0.420006424f},
-std::array<float,2>{0.232903019f, 0.637070298f},
-std::array<float,2>{0.934744239f, 0.239969149f},
-std::array<float,2>{0.552473664f, 0.558957458f},
-std::array<float,2>{0.31640622f, 0.115374424f},
-std::array<float,2>{0.164473996f, 0.960348189f},
-std::array<float,2>{0.997976899f, 0.357195735f},
-std::array<float,2>{0.863525987f, 0.786840916f},
-std::array<float,2>{0.120946258f, 0.440963924f},
-std::array<float,2>{0.448996156f, 0.689271212f},
-std::array<float,2>{0.710786879f, 0.144045398f},
-std::array<float,2>{0.897937f, 0.674895644f},
-std::array<float,2>{0.215465635f, 0.217989311f},
-std::array<float,2>{0.275753111f, 0.864273608f},
-std::array<float,2>{0.583008766f, 0.382593006f},
-std::array<float,2>{0.637019694f, 0.882439673f},
-std::array<float,2>{0.433676988f, 0.281172812f},
-std::array<float,2>{0.0108077358f, 0.59929353f},
-std::array<float,2>{0.80996865f, 0.0527107678f},
-std::array<float,2>{0.51224786f, 0.698091567f},
-std::array<float,2>{0.359816968f, 0.149254173f},
-std::array<float,2>{0.147068337f, 0.790610552f},
-std::array<float,2>{0.949374735f, 0.452597648f},
-std::array<float,2>{0.827648044f, 0.964364946f},
-std::array<float,2>{0.0753562897f, 0.350806713f},
-std::array<float,2>{0.471773505f, 0.549997687f},
-std::array<float,2>{0.731758416f, 0.122189932f},
-std::array<float,2>{0.927901328f, 0.605698824f},
-std::array<float,2>{0.22588788f, 0.0614470877f},
-std::array<float,2>{0.291835099f, 0.883683205f},
-std::array<float,2>{0.616532624f, 0.267654032f},
-std::array<float,2>{0.684162378f, 0.869135916f},
-std::array<float,2>{0.376412749f, 0.385029227f},
-std::array<float,2>{0.0577056855f, 0.685580194f},
-std::array<float,2>{0.761810541f, 0.203655735f},
-std::array<float,2>{0.717350602f, 0.515069842f},
-std::array<float,2>{0.438700706f, 0.0699005127f},
-std::array<float,2>{0.109912828f, 0.998198807f},
-std::array<float,2>{0.872841358f, 0.318193614f},
-std::array<float,2>{0.985756874f, 0.761084318f},
-std::array<float,2>{0.158029601f, 0.477561176f},
-std::array<float,2>{0.326652646f, 0.730441809f},
-std::array<float,2>{0.556603014f, 0.18169868f},
-std::array<float,2>{0.79808563f, 0.631977439f},
-std::array<float,2>{0.00507231522f, 0.249942854f},
-std::array<float,2>{0.421925396f, 0.834661543f},
-std::array<float,2>{0.625885963f, 0.411767632f},
-std::array<float,2>{0.590768099f, 0.934218109f},
-std::array<float,2>{0.269817233f, 0.285835713f},
-std::array<float,2>{0.204330951f, 0.571999788f},
-std::array<float,2>{0.904501796f, 0.0213473439f},
-std::array<float,2>{0.655550003f, 0.670029283f},
-std::array<float,2>{0.408607155f, 0.196071833f},
-std::array<float,2>{0.0257346034f, 0.845651925f},
-std::array<float,2>{0.786800146f, 0.395317376f},
-std::array<float,2>{0.882351637f, 0.902136683f},
-std::array<float,2>{0.194657475f, 0.261440784f},
-std::array<float,2>{0.265234888f, 0.616556644f},
-std::array<float,2>{0.572345197f, 0.0323245786f},
-std::array<float,2>{0.849436402f, 0.542869031f},
-std::array<float,2>{0.108318768f, 0.106728815f},
-std::array<float,2>{0.454844087f, 0.947063923f},
-std::array<float,2>{0.69798106f, 0.360022992f},
-std::array<float,2>{0.542647302f, 0.808406293f},
-std::array<float,2>{0.334640801f, 0.464435101f},
-std::array<float,2>{0.175180852f, 0.703990161f},
-std::array<float,2>{0.979082823f, 0.125277236f},
-std::array<float,2>{0.608881176f, 0.584201455f},
-std::array<float,2>{0.310801089f, 0.0062407488f},
-std::array<float,2>{0.241801545f, 0.913897634f},
-std::array<float,2>{0.920582414f, 0.30867672f},
-std::array<float,2>{0.766878188f, 0.825298965f},
-std::array<float,2>{0.0352265537f, 0.429746598f},
-std::array<float,2>{0.405783534f, 0.653395951f},
-std::array<float,2>{0.658430755f, 0.220468879f},
-std::array<float,2>{0.957536697f, 0.737261355f},
-std::array<float,2>{0.135631338f, 0.171220243f},
-std::array<float,2>{0.346915156f, 0.769158542f},
-std::array<float,2>{0.520445228f, 0.493087888f},
-std::array<float,2>{0.744574428f, 0.972273529f},
-std::array<float,2>{0.497937351f, 0.329320073f},
-std::array<float,2>{0.078368172f, 0.529800057f},
-std::array<float,2>{0.841531098f, 0.0783057138f},
-std::array<float,2>{0.610929191f, 0.74907738f},
-std::array<float,2>{0.293210894f, 0.158756807f},
-std::array<float,2>{0.219953254f, 0.77710557f},
-std::array<float,2>{0.925741673f, 0.486551017f},
-std::array<float,2>{0.759217799f, 0.977491081f},
-std::array<float,2>{0.0623377375f, 0.343384743f},
-std::array<float,2>{0.379224867f, 0.5167135f},
-std::array<float,2>{0.683325171f, 0.0881210044f},
-std::array<float,2>{0.945611894f, 0.587556303f},
-std::array<float,2>{0.143384695f, 0.00997197255f},
-std::array<float,2>{0.363719404f, 0.920361638f},
-std::array<float,2>{0.509154439f, 0.297030598f},
-std::array<float,2>{0.728212059f, 0.814731359f},
-std::array<float,2>{0.472958356f, 0.429113805f},
-std::array<float,2>{0.0739006326f, 0.64486289f},
-std::array<float,2>{0.820360482f, 0.231756508f},
-std::array<float,2>{0.632753372f, 0.532717407f},
-std::array<float,2>{0.426665604f, 0.0975901559f},
-std::array<float,2>{0.00382906501f, 0.944680691f},
-std::array<float,2>{0.802552998f, 0.369026929f},
-std::array<float,2>{0.901332438f, 0.797746956f},
-std::array<float,2>{0.208971545f, 0.453905433f},
-std::array<float,2>{0.268579334f, 0.71710825f},
-std::array<float,2>{0.588735223f, 0.139853671f},
-std::array<float,2>{0.869780719f, 0.661503255f},
-std::array<float,2>{0.115320385f, 0.191302642f},
-std::array<float,2>{0.442655206f, 0.857575357f},
-std::array<float,2>{0.713855982f, 0.402399123f},
-std::array<float,2>{0.560988367f, 0.8977198f},
-std::array<float,2>{0.322339684f, 0.252042949f},
-std::array<float,2>{0.161740899f, 0.621705592f},
-std::array<float,2>{0.990946352f, 0.0457836762f},
-std::array<float,2>{0.700659811f, 0.633690774f},
-std::array<float,2>{0.459402442f, 0.235440388f},
-std::array<float,2>{0.104730792f, 0.837481201f},
-std::array<float,2>{0.847090542f, 0.417711854f},
-std::array<float,2>{0.983906209f, 0.927915275f},
-std::array<float,2>{0.178633124f, 0.292088658f},
-std::array<float,2>{0.330891371f, 0.566117764f},
-std::array<float,2>{0.545936942f, 0.0289004594f},
-std::array<float,2>{0.782533765f, 0.502703071f},
-std::array<float,2>{0.0305145103f, 0.0736713633f},
-std::array<float,2>{0.412324727f, 0.991540372f},
-std::array<float,2>{0.649893343f, 0.321570069f},
-std::array<float,2>{0.57593292f, 0.757205248f},
-std::array<float,2>{0.259481877f, 0.474081695f},
-std::array<float,2>{0.19075267f, 0.723767042f},
-std::array<float,2>{0.877102673f, 0.172826499f},
-std::array<float,2>{0.518184364f, 0.595462322f},
-std::array<float,2>{0.350557595f, 0.0479996018f},
-std::array<float,2>{0.138285756f, 0.875926733f},
-std::array<float,2>{0.954914153f, 0.275924802f},
-std::array<float,2>{0.839121401f, 0.859622419f},
-std::array<float,2>{0.0830106735f, 0.378750324f},
-std::array<float,2>{0.494946152f, 0.678691089f},
-std::array<float,2>{0.749671102f, 0.211402506f},
-std::array<float,2>{0.914422572f, 0.69165343f},
-std::array<float,2>{0.235998958f, 0.145714164f},
-std::array<float,2>{0.306646377f, 0.782467663f},
-std::array<float,2>{0.603330374f, 0.445245415f},
-std::array<float,2>{0.663447917f, 0.956445515f},
-std::array<float,2>{0.401785851f, 0.351774901f},
-std::array<float,2>{0.0335889496f, 0.556055367f},
-std::array<float,2>{0.770908535f, 0.111660153f},
-std::array<float,2>{0.538492084f, 0.683530152f},
-std::array<float,2>{0.339755923f, 0.207572743f},
-std::array<float,2>{0.185424939f, 0.871958435f},
-std::array<float,2>{0.970392525f, 0.387167305f},
-std::array<float,2>{0.856665015f, 0.886882961f},
-std::array<float,2>{0.0951047614f, 0.271032274f},
-std::array<float,2>{0.465168148f, 0.601969242f},
-std::array<float,2>{0.693740547f, 0.0550009273f},
-std::array<float,2>{0.890420198f, 0.553240418f},
-std::array<float,2>{0.197339222f, 0.11950478f},
-std::array<float,2>{0.253893137f, 0.968590975f},
-std::array<float,2>{0.567887604f, 0.34723562f},
-std::array<float,2>{0.641247094f, 0.793167949f},
-std::array<float,2>{0.421130985f, 0.4455823f},
-std::array<float,2>{0.0165387038f, 0.703094304f},
-std::array<float,2>{0.795869887f, 0.154579595f},
-std::array<float,2>{0.736861169f, 0.574859083f},
-std::array<float,2>{0.490352988f, 0.0184881594f},
-std::array<float,2>{0.0898145437f, 0.930630803f},
-std::array<float,2>{0.832272768f, 0.283969551f},
-std::array<float,2>{0.966488302f, 0.83022356f},
-std::array<float,2>{0.131145462f, 0.409486026f},
-std::array<float,2>{0.354743123f, 0.625624657f},
-std::array<float,2>{0.525799632f, 0.245566666f},
-std::array<float,2>{0.774217784f, 0.731508136f},
-std::array<float,2>{0.0407079235f, 0.184358165f},
-std::array<float,2>{0.393322647f, 0.764386833f},
-std::array<float,2>{0.666339517f, 0.481924325f},
-std::array<float,2>{0.598062932f, 0.992900789f},
-std::array<float,2>{0.303234011f, 0.312895477f},
-std::array<float,2>{0.249383256f, 0.509006679f},
-std::array<float,2>{0.912246346f, 0.0633362606f},
-std::array<float,2>{0.677407146f, 0.709015727f},
-std::array<float,2>{0.38720426f, 0.132080764f},
-std::array<float,2>{0.0503115542f, 0.811525166f},
-std::array<float,2>{0.750030637f, 0.465855002f},
-std::array<float,2>{0.931063771f, 0.952830553f},
-std::array<float,2>{0.227261588f, 0.363428593f},
-std::array<float,2>{0.288458526f, 0.543358803f},
-std::array<float,2>{0.623828053f, 0.103334084f},
-std::array<float,2>{0.817525566f, 0.611968935f},
-std::array<float,2>{0.0654130578f, 0.0385247506f},
-std::array<float,2>{0.478566796f, 0.903751194f},
-std::array<float,2>{0.719303906f, 0.265207767f},
-std::array<float,2>{0.506151915f, 0.848722339f},
-std::array<float,2>{0.370438933f, 0.391258538f},
-std::array<float,2>{0.155240923f, 0.665194392f},
-std::array<float,2>{0.942142606f, 0.201714754f},
-std::array<float,2>{0.581184387f, 0.525991678f},
-std::array<float,2>{0.27826947f, 0.0844809711f},
-std::array<float,2>{0.212538421f, 0.974416018f},
-std::array<float,2>{0.893653631f, 0.3343665f},
-std::array<float,2>{0.804825485f, 0.770389736f},
-std::array<float,2>{0.012776142f, 0.496224463f},
-std::array<float,2>{0.431217015f, 0.74090451f},
-std::array<float,2>{0.636375368f, 0.165033519f},
-std::array<float,2>{0.995728612f, 0.648811221f},
-std::array<float,2>{0.17002137f, 0.224471673f},
-std::array<float,2>{0.319336176f, 0.823226213f},
-std::array<float,2>{0.549221456f, 0.43465063f},
-std::array<float,2>{0.70701313f, 0.907013714f},
-std::array<float,2>{0.451771826f, 0.305308491f},
-std::array<float,2>{0.123111464f, 0.578832507f},
-std::array<float,2>{0.860108316f, 0.0032895396f},
-std::array<float,2>{0.582319677f, 0.672097087f},
-std::array<float,2>{0.276517302f, 0.215711474f},
-std::array<float,2>{0.215949729f, 0.865861356f},
-std::array<float,2>{0.89740026f, 0.379190922f},
-std::array<float,2>{0.809031904f, 0.880145967f},
-std::array<float,2>{0.0106888581f, 0.277638763f},
-std::array<float,2>{0.434889495f, 0.599979281f},
-std::array<float,2>{0.637807071f, 0.053310968f},
-std::array<float,2>{0.996836066f, 0.562058449f},
-std::array<float,2>{0.165226832f, 0.114748523f},
-std::array<float,2>{0.315407395f, 0.957303405f},
-std::array<float,2>{0.550930083f, 0.35762611f},
-std::array<float,2>{0.709219933f, 0.788986623f},
-std::array<float,2>{0.44782123f, 0.438235223f},
-std::array<float,2>{0.119532779f, 0.689919949f},
-std::array<float,2>{0.864459693f, 0.141495317f},
-std::array<float,2>{0.675244749f, 0.569968343f},
-std::array<float,2>{0.383049279f, 0.0244277101f},
-std::array<float,2>{0.0541474298f, 0.924035907f},
-std::array<float,2>{0.75462389f, 0.29670161f},
-std::array<float,2>{0.934098125f, 0.842834651f},
-std::array<float,2>{0.233875036f, 0.419356048f},
-std::array<float,2>{0.282045424f, 0.639351189f},
-std::array<float,2>{0.618977427f, 0.241271287f},
-std::array<float,2>{0.814721763f, 0.720182598f},
-std::array<float,2>{0.068320334f, 0.179246813f},
-std::array<float,2>{0.484133363f, 0.751879156f},
-std::array<float,2>{0.725057423f, 0.469116539f},
-std::array<float,2>{0.500991881f, 0.987621784f},
-std::array<float,2>{0.374058217f, 0.325971425f},
-std::array<float,2>{0.150396943f, 0.50776571f},
-std::array<float,2>{0.940808713f, 0.074711673f},
-std::array<float,2>{0.741581082f, 0.713668883f},
-std::array<float,2>{0.487258613f, 0.136294752f},
-std::array<float,2>{0.0910128281f, 0.803122878f},
-std::array<float,2>{0.829986453f, 0.460352004f},
-std::array<float,2>{0.963480413f, 0.939891219f},
-std::array<float,2>{0.127391815f, 0.373256952f},
-std::array<float,2>{0.356763303f, 0.536829114f},
-std::array<float,2>{0.530744374f, 0.0985011607f},
-std::array<float,2>{0.777834594f, 0.620225012f},
-std::array<float,2>{0.044128824f, 0.0428797975f},
-std::array<float,2>{0.396738231f, 0.894353747f},
-std::array<float,2>{0.671120703f, 0.255382329f},
-std::array<float,2>{0.597056031f, 0.852550685f},
-std::array<float,2>{0.296878159f, 0.401260376f},
-std::array<float,2>{0.243700564f, 0.657746851f},
-std::array<float,2>{0.907924473f, 0.192967966f},
-std::array<float,2>{0.534828901f, 0.520952344f},
-std::array<float,2>{0.339906573f, 0.0918980613f},
-std::array<float,2>{0.181206226f, 0.981324673f},
-std::array<float,2>{0.973652542f, 0.336979806f},
-std::array<float,2>{0.852975965f, 0.778792024f},
-std::array<float,2>{0.0982849598f, 0.489345551f},
-std::array<float,2>{0.461492032f, 0.744798601f},
-std::array<float,2>{0.689633846f, 0.163440257f},
-std::array<float,2>{0.885801852f, 0.642767668f},
-std::array<float,2>{0.200495124f, 0.229112104f},
-std::array<float,2>{0.255837798f, 0.819548845f},
-std::array<float,2>{0.565928638f, 0.422767401f},
-std::array<float,2>{0.644977391f, 0.917453885f},
-std::array<float,2>{0.416005224f, 0.301577032f},
-std::array<float,2>{0.0222852975f, 0.590121984f},
-std::array<float,2>{0.791554868f, 0.0135460673f},
-std::array<float,2>{0.520921171f, 0.734636605f},
-std::array<float,2>{0.345791429f, 0.168373078f},
-std::array<float,2>{0.136567816f, 0.767114639f},
-std::array<float,2>{0.958753228f, 0.494685471f},
-std::array<float,2>{0.840383768f, 0.969366193f},
-std::array<float,2>{0.0793075562f, 0.330140352f},
-std::array<float,2>{0.496659696f, 0.52793777f},
-std::array<float,2>{0.74521637f, 0.0802067146f},
-std::array<float,2>{0.921448529f, 0.583676696f},
-std::array<float,2>{0.24094151f, 0.00422429247f},
-std::array<float,2>{0.312140465f, 0.91155082f},
-std::array<float,2>{0.607614279f, 0.31103757f},
-std::array<float,2>{0.659594357f, 0.826717257f},
-std::array<float,2>{0.405196875f, 0.431743205f},
-std::array<float,2>{0.036568433f, 0.654451668f},
-std::array<float,2>{0.765891135f, 0.220971525f},
-std::array<float,2>{0.698914766f, 0.540145695f},
-std::array<float,2>{0.453469157f, 0.10918732f},
-std::array<float,2>{0.109298252f, 0.947440565f},
-std::array<float,2>{0.848208547f, 0.361483693f},
-std::array<float,2>{0.980171382f, 0.804846108f},
-std::array<float,2>{0.174129054f, 0.462487519f},
-std::array<float,2>{0.335009187f, 0.705781281f},
-std::array<float,2>{0.541074276f, 0.128150225f},
-std::array<float,2>{0.785332084f, 0.668553531f},
-std::array<float,2>{0.0273010861f, 0.198370025f},
-std::array<float,2>{0.409676045f, 0.845836043f},
-std::array<float,2>{0.654961348f, 0.396551281f},
-std::array<float,2>{0.573774636f, 0.899162591f},
-std::array<float,2>{0.263999075f, 0.259380966f},
-std::array<float,2>{0.193451613f, 0.613604546f},
-std::array<float,2>{0.880945027f, 0.033250466f},
-std::array<float,2>{0.626134098f, 0.630494952f},
-std::array<float,2>{0.42344752f, 0.247641653f},
-std::array<float,2>{0.00488022994f, 0.83355093f},
-std::array<float,2>{0.797551811f, 0.413573116f},
-std::array<float,2>{0.906128049f, 0.93634063f},
-std::array<float,2>{0.203242421f, 0.287499905f},
-std::array<float,2>{0.271218836f, 0.572899997f},
-std::array<float,2>{0.591442108f, 0.0230878331f},
-std::array<float,2>{0.871645033f, 0.513625681f},
-std::array<float,2>{0.110696755f, 0.0679234937f},
-std::array<float,2>{0.437810987f, 0.997860551f},
-std::array<float,2>{0.718390524f, 0.318717033f},
-std::array<float,2>{0.555393338f, 0.759675026f},
-std::array<float,2>{0.32796216f, 0.478772432f},
-std::array<float,2>{0.156898931f, 0.728305519f},
-std::array<float,2>{0.984920621f, 0.181281835f},
-std::array<float,2>{0.615833461f, 0.609101176f},
-std::array<float,2>{0.292774469f, 0.0595938265f},
-std::array<float,2>{0.224957645f, 0.885018528f},
-std::array<float,2>{0.928729773f, 0.266602457f},
-std::array<float,2>{0.763106763f, 0.869403064f},
-std::array<float,2>{0.05665401f, 0.384199202f},
-std::array<float,2>{0.375358105f, 0.685222805f},
-std::array<float,2>{0.684711695f, 0.205596104f},
-std::array<float,2>{0.950391591f, 0.696451247f},
-std::array<float,2>{0.14807415f, 0.150583357f},
-std::array<float,2>{0.361308873f, 0.791854143f},
-std::array<float,2>{0.513095319f, 0.450031698f},
-std::array<float,2>{0.730865717f, 0.962830484f},
-std::array<float,2>{0.470899105f, 0.349316239f},
-std::array<float,2>{0.0744615644f, 0.547170877f},
-std::array<float,2>{0.826300979f, 0.123806082f},
-std::array<float,2>{0.602405906f, 0.695293009f},
-std::array<float,2>{0.308056742f, 0.147887737f},
-std::array<float,2>{0.235054791f, 0.783345699f},
-std::array<float,2>{0.915912688f, 0.443151593f},
-std::array<float,2>{0.769731939f, 0.953771114f},
-std::array<float,2>{0.034826044f, 0.353531361f},
-std::array<float,2>{0.400859773f, 0.557151377f},
-std::array<float,2>{0.662409008f, 0.109765939f},
-std::array<float,2>{0.95406574f, 0.59574455f},
-std::array<float,2>{0.137596667f, 0.0497237332f},
-std::array<float,2>{0.350682586f, 0.878247797f},
-std::array<float,2>{0.519518316f, 0.275155783f},
-std::array<float,2>{0.748690605f, 0.863025367f},
-std::array<float,2>{0.495853692f, 0.376542419f},
-std::array<float,2>{0.0821350366f, 0.677065849f},
-std::array<float,2>{0.837979913f, 0.214786068f},
-std::array<float,2>{0.648837209f, 0.500483632f},
-std::array<float,2>{0.413778394f, 0.070745036f},
-std::array<float,2>{0.0302115045f, 0.989494026f},
-std::array<float,2>{0.781615555f, 0.322753072f},
-std::array<float,2>{0.877938867f, 0.755343437f},
-std::array<float,2>{0.189781934f, 0.475129962f},
-std::array<float,2>{0.258347183f, 0.725483894f},
-std::array<float,2>{0.574707329f, 0.175103858f},
-std::array<float,2>{0.846209466f, 0.634904802f},
-std::array<float,2>{0.103746049f, 0.238106355f},
-std::array<float,2>{0.460286051f, 0.839070559f},
-std::array<float,2>{0.699946404f, 0.41408661f},
-std::array<float,2>{0.545105398f, 0.927582622f},
-std::array<float,2>{0.331067204f, 0.289578348f},
-std::array<float,2>{0.178728655f, 0.563684523f},
-std::array<float,2>{0.982957423f, 0.0300761182f},
-std::array<float,2>{0.714701593f, 0.662696362f},
-std::array<float,2>{0.442185432f, 0.188631654f},
-std::array<float,2>{0.11671409f, 0.856492519f},
-std::array<float,2>{0.870215058f, 0.404553771f},
-std::array<float,2>{0.991233826f, 0.894986272f},
-std::array<float,2>{0.160247102f, 0.251453459f},
-std::array<float,2>{0.323997587f, 0.624621809f},
-std::array<float,2>{0.561657369f, 0.0437442623f},
-std::array<float,2>{0.801691175f, 0.535069406f},
-std::array<float,2>{0.00222107326f, 0.0955000743f},
-std::array<float,2>{0.42723611f, 0.941865265f},
-std::array<float,2>{0.631373525f, 0.370475233f},
-std::array<float,2>{0.589240909f, 0.80043608f},
-std::array<float,2>{0.26829645f, 0.456908375f},
-std::array<float,2>{0.207920283f, 0.715355158f},
-std::array<float,2>{0.901497245f, 0.136813894f},
-std::array<float,2>{0.508502543f, 0.588792682f},
-std::array<float,2>{0.364314198f, 0.00889355876f},
-std::array<float,2>{0.143701002f, 0.918533862f},
-std::array<float,2>{0.946595967f, 0.299190938f},
-std::array<float,2>{0.821533978f, 0.814126611f},
-std::array<float,2>{0.0724377781f, 0.426537216f},
-std::array<float,2>{0.473643363f, 0.647078156f},
-std::array<float,2>{0.727221549f, 0.232898548f},
-std::array<float,2>{0.924180806f, 0.747788727f},
-std::array<float,2>{0.219272643f, 0.157293275f},
-std::array<float,2>{0.294097513f, 0.774700761f},
-std::array<float,2>{0.60960114f, 0.485752732f},
-std::array<float,2>{0.682260275f, 0.980423391f},
-std::array<float,2>{0.380383462f, 0.341507643f},
-std::array<float,2>{0.0606910102f, 0.518838406f},
-std::array<float,2>{0.758251667f, 0.0861565247f},
-std::array<float,2>{0.550166905f, 0.650812447f},
-std::array<float,2>{0.318742931f, 0.226195872f},
-std::array<float,2>{0.17102246f, 0.821741343f},
-std::array<float,2>{0.995037079f, 0.437475085f},
-std::array<float,2>{0.860903203f, 0.909001887f},
-std::array<float,2>{0.124441557f, 0.307778686f},
-std::array<float,2>{0.452534646f, 0.580331802f},
-std::array<float,2>{0.705618501f, 0.000307447364f},
-std::array<float,2>{0.893016517f, 0.524255633f},
-std::array<float,2>{0.210967556f, 0.0834065825f},
-std::array<float,2>{0.279252082f, 0.975877821f},
-std::array<float,2>{0.580628455f, 0.333667308f},
-std::array<float,2>{0.635655761f, 0.772550762f},
-std::array<float,2>{0.429980606f, 0.498555452f},
-std::array<float,2>{0.0120452736f, 0.740091562f},
-std::array<float,2>{0.805779934f, 0.166709915f},
-std::array<float,2>{0.720181406f, 0.610586882f},
-std::array<float,2>{0.479989827f, 0.0362327695f},
-std::array<float,2>{0.0657656714f, 0.904696465f},
-std::array<float,2>{0.816695929f, 0.261915684f},
-std::array<float,2>{0.942603648f, 0.850890219f},
-std::array<float,2>{0.156005666f, 0.393839836f},
-std::array<float,2>{0.369146317f, 0.6670174f},
-std::array<float,2>{0.507521749f, 0.200332254f},
-std::array<float,2>{0.750997901f, 0.708443761f},
-std::array<float,2>{0.0489337146f, 0.130714566f},
-std::array<float,2>{0.388558924f, 0.808765709f},
-std::array<float,2>{0.676324368f, 0.467375249f},
-std::array<float,2>{0.624486804f, 0.950239539f},
-std::array<float,2>{0.287613273f, 0.365746349f},
-std::array<float,2>{0.228206709f, 0.545964479f},
-std::array<float,2>{0.930405498f, 0.104244128f},
-std::array<float,2>{0.667240918f, 0.734279454f},
-std::array<float,2>{0.394039333f, 0.187394038f},
-std::array<float,2>{0.0395080671f, 0.761838734f},
-std::array<float,2>{0.775076687f, 0.483941793f},
-std::array<float,2>{0.913725793f, 0.994635403f},
-std::array<float,2>{0.248921841f, 0.315769553f},
-std::array<float,2>{0.304411888f, 0.511432648f},
-std::array<float,2>{0.599079788f, 0.0645369142f},
-std::array<float,2>{0.833903491f, 0.57806021f},
-std::array<float,2>{0.0879426748f, 0.0164886676f},
-std::array<float,2>{0.491419017f, 0.932509661f},
-std::array<float,2>{0.737562895f, 0.282838196f},
-std::array<float,2>{0.526801407f, 0.828992426f},
-std::array<float,2>{0.35423401f, 0.406335503f},
-std::array<float,2>{0.132698014f, 0.62746048f},
-std::array<float,2>{0.965588331f, 0.242779493f},
-std::array<float,2>{0.566776335f, 0.552042484f},
-std::array<float,2>{0.252780676f, 0.117884137f},
-std::array<float,2>{0.199033141f, 0.965281725f},
-std::array<float,2>{0.888855994f, 0.34505558f},
-std::array<float,2>{0.796169341f, 0.79515624f},
-std::array<float,2>{0.0172822159f, 0.448312581f},
-std::array<float,2>{0.419944912f, 0.70098716f},
-std::array<float,2>{0.642376363f, 0.153690696f},
-std::array<float,2>{0.969220638f, 0.680402577f},
-std::array<float,2>{0.18403478f, 0.21042423f},
-std::array<float,2>{0.33850798f, 0.874865413f},
-std::array<float,2>{0.53743434f, 0.389335662f},
-std::array<float,2>{0.694434226f, 0.889914632f},
-std::array<float,2>{0.466367215f, 0.271816641f},
-std::array<float,2>{0.0941468179f, 0.605465353f},
-std::array<float,2>{0.856118679f, 0.056667868f},
-std::array<float,2>{0.619364262f, 0.637987435f},
-std::array<float,2>{0.284036458f, 0.23834686f},
-std::array<float,2>{0.230593294f, 0.841120481f},
-std::array<float,2>{0.936923385f, 0.421078742f},
-std::array<float,2>{0.756723404f, 0.922382176f},
-std::array<float,2>{0.0522401668f, 0.293029428f},
-std::array<float,2>{0.385116041f, 0.568109691f},
-std::array<float,2>{0.672092915f, 0.0271527972f},
-std::array<float,2>{0.938495576f, 0.503926396f},
-std::array<float,2>{0.148611575f, 0.0765764341f},
-std::array<float,2>{0.371655792f, 0.98491019f},
-std::array<float,2>{0.503284335f, 0.327507317f},
-std::array<float,2>{0.723109424f, 0.753765404f},
-std::array<float,2>{0.481340647f, 0.47181797f},
-std::array<float,2>{0.0699669048f, 0.720765769f},
-std::array<float,2>{0.813835442f, 0.176020637f},
-std::array<float,2>{0.639022529f, 0.598620653f},
-std::array<float,2>{0.436480045f, 0.0508988276f},
-std::array<float,2>{0.0088761216f, 0.881739438f},
-std::array<float,2>{0.812246621f, 0.279813349f},
-std::array<float,2>{0.89647311f, 0.863627553f},
-std::array<float,2>{0.218445659f, 0.380952358f},
-std::array<float,2>{0.274672121f, 0.674630284f},
-std::array<float,2>{0.584137201f, 0.217015564f},
-std::array<float,2>{0.866029859f, 0.687790215f},
-std::array<float,2>{0.117582664f, 0.143047258f},
-std::array<float,2>{0.446153492f, 0.785751402f},
-std::array<float,2>{0.707660079f, 0.439784706f},
-std::array<float,2>{0.552960992f, 0.959526598f},
-std::array<float,2>{0.313881516f, 0.356039256f},
-std::array<float,2>{0.16718173f, 0.560437322f},
-std::array<float,2>{0.998846531f, 0.116715051f},
-std::array<float,2>{0.687591732f, 0.742362916f},
-std::array<float,2>{0.462934256f, 0.160165846f},
-std::array<float,2>{0.100753188f, 0.780336618f},
-std::array<float,2>{0.854155242f, 0.491340697f},
-std::array<float,2>{0.976156235f, 0.982970655f},
-std::array<float,2>{0.183149815f, 0.337904125f},
-std::array<float,2>{0.34255594f, 0.522881806f},
-std::array<float,2>{0.531291604f, 0.0901433975f},
-std::array<float,2>{0.790765047f, 0.591939449f},
-std::array<float,2>{0.0214403309f, 0.0145191485f},
-std::array<float,2>{0.417664021f, 0.915231407f},
-std::array<float,2>{0.647730052f, 0.303144634f},
-std::array<float,2>{0.562587976f, 0.818213642f},
-std::array<float,2>{0.256660849f, 0.423986346f},
-std::array<float,2>{0.201203644f, 0.641323686f},
-std::array<float,2>{0.882817745f, 0.228402138f},
-std::array<float,2>{0.528078198f, 0.537599921f},
-std::array<float,2>{0.35820815f, 0.100262411f},
-std::array<float,2>{0.126011088f, 0.938653171f},
-std::array<float,2>{0.96257031f, 0.371605754f},
-std::array<float,2>{0.831740379f, 0.800869167f},
-std::array<float,2>{0.092283532f, 0.45810613f},
-std::array<float,2>{0.484453321f, 0.711139202f},
-std::array<float,2>{0.738854051f, 0.133114442f},
-std::array<float,2>{0.909414113f, 0.659584582f},
-std::array<float,2>{0.244178355f, 0.193556711f},
-std::array<float,2>{0.300479323f, 0.854649186f},
-std::array<float,2>{0.595486522f, 0.398475915f},
-std::array<float,2>{0.669412374f, 0.891034186f},
-std::array<float,2>{0.395453304f, 0.256011069f},
-std::array<float,2>{0.045678243f, 0.617428362f},
-std::array<float,2>{0.779521704f, 0.0404259823f},
-std::array<float,2>{0.540255845f, 0.705048144f},
-std::array<float,2>{0.332857102f, 0.12640442f},
-std::array<float,2>{0.172720283f, 0.807095408f},
-std::array<float,2>{0.977222204f, 0.463367462f},
-std::array<float,2>{0.851280212f, 0.945657432f},
-std::array<float,2>{0.105541155f, 0.360441148f},
-std::array<float,2>{0.456929713f, 0.541252732f},
-std::array<float,2>{0.695773244f, 0.105573565f},
-std::array<float,2>{0.879484475f, 0.615980268f},
-std::array<float,2>{0.192389444f, 0.0314885601f},
-std::array<float,2>{0.263415903f, 0.900579512f},
-std::array<float,2>{0.570515037f, 0.260169864f},
-std::array<float,2>{0.653091908f, 0.844181478f},
-std::array<float,2>{0.406787306f, 0.396359921f},
-std::array<float,2>{0.0245269202f, 0.671710551f},
-std::array<float,2>{0.787896514f, 0.197225273f},
-std::array<float,2>{0.742208362f, 0.531136394f},
-std::array<float,2>{0.499130547f, 0.0793748721f},
-std::array<float,2>{0.0808900595f, 0.971669495f},
-std::array<float,2>{0.842081785f, 0.328547031f},
-std::array<float,2>{0.960359931f, 0.767795742f},
-std::array<float,2>{0.132898986f, 0.494065076f},
-std::array<float,2>{0.345655084f, 0.737724006f},
-std::array<float,2>{0.523201406f, 0.170521781f},
-std::array<float,2>{0.76891005f, 0.652677596f},
-std::array<float,2>{0.0373157859f, 0.219714805f},
-std::array<float,2>{0.402682692f, 0.82451582f},
-std::array<float,2>{0.656265736f, 0.430762291f},
-std::array<float,2>{0.606595159f, 0.912891686f},
-std::array<float,2>{0.309389681f, 0.309712619f},
-std::array<float,2>{0.239492714f, 0.585520089f},
-std::array<float,2>{0.919741571f, 0.0075400318f},
-std::array<float,2>{0.686717868f, 0.686910272f},
-std::array<float,2>{0.377284318f, 0.204603031f},
-std::array<float,2>{0.0550462157f, 0.867879212f},
-std::array<float,2>{0.764953136f, 0.385983586f},
-std::array<float,2>{0.925917685f, 0.883975625f},
-std::array<float,2>{0.223542035f, 0.269344032f},
-std::array<float,2>{0.290828019f, 0.607266605f},
-std::array<float,2>{0.614418924f, 0.0622901581f},
-std::array<float,2>{0.824645221f, 0.54929471f},
-std::array<float,2>{0.0766019225f, 0.121120766f},
-std::array<float,2>{0.470138222f, 0.963279903f},
-std::array<float,2>{0.734255254f, 0.350502998f},
-std::array<float,2>{0.515039444f, 0.789918721f},
-std::array<float,2>{0.362905174f, 0.451699466f},
-std::array<float,2>{0.145893008f, 0.699051321f},
-std::array<float,2>{0.951894164f, 0.149881825f},
-std::array<float,2>{0.593316078f, 0.571065962f},
-std::array<float,2>{0.271944821f, 0.0203429963f},
-std::array<float,2>{0.205904886f, 0.93492049f},
-std::array<float,2>{0.904064f, 0.286853522f},
-std::array<float,2>{0.799257398f, 0.835882783f},
-std::array<float,2>{0.00621832721f, 0.410961121f},
-std::array<float,2>{0.425600916f, 0.631024241f},
-std::array<float,2>{0.627699852f, 0.248651311f},
-std::array<float,2>{0.986714602f, 0.729203582f},
-std::array<float,2>{0.160006195f, 0.183412194f},
-std::array<float,2>{0.324409723f, 0.759799421f},
-std::array<float,2>{0.557408094f, 0.476682425f},
-std::array<float,2>{0.716155827f, 0.999693394f},
-std::array<float,2>{0.441097558f, 0.316408277f},
-std::array<float,2>{0.111881822f, 0.513798475f},
-std::array<float,2>{0.87462467f, 0.0684797764f},
-std::array<float,2>{0.576533973f, 0.723165929f},
-std::array<float,2>{0.260021329f, 0.173699632f},
-std::array<float,2>{0.188209713f, 0.75644666f},
-std::array<float,2>{0.875844717f, 0.473089784f},
-std::array<float,2>{0.784469783f, 0.990389884f},
-std::array<float,2>{0.027939871f, 0.320714891f},
-std::array<float,2>{0.41047439f, 0.503723621f},
-std::array<float,2>{0.651406109f, 0.0725812316f},
-std::array<float,2>{0.981967807f, 0.564982474f},
-std::array<float,2>{0.177002907f, 0.0279092267f},
-std::array<float,2>{0.330058008f, 0.92906332f},
-std::array<float,2>{0.543647826f, 0.291958988f},
-std::array<float,2>{0.702098846f, 0.836361408f},
-std::array<float,2>{0.457582086f, 0.416255742f},
-std::array<float,2>{0.101772673f, 0.634628594f},
-std::array<float,2>{0.844579041f, 0.235121906f},
-std::array<float,2>{0.660974443f, 0.555645168f},
-std::array<float,2>{0.400312096f, 0.113014013f},
-std::array<float,2>{0.0327457637f, 0.95544076f},
-std::array<float,2>{0.772798479f, 0.353259534f},
-std::array<float,2>{0.916462719f, 0.781551003f},
-std::array<float,2>{0.237685174f, 0.443983316f},
-std::array<float,2>{0.306326509f, 0.693338692f},
-std::array<float,2>{0.603581667f, 0.144919619f},
-std::array<float,2>{0.83684665f, 0.678835094f},
-std::array<float,2>{0.0844231695f, 0.212573454f},
-std::array<float,2>{0.492322564f, 0.861096859f},
-std::array<float,2>{0.747498453f, 0.377599269f},
-std::array<float,2>{0.5171296f, 0.876562774f},
-std::array<float,2>{0.348265618f, 0.277287483f},
-std::array<float,2>{0.140523165f, 0.594595551f},
-std::array<float,2>{0.955754578f, 0.0472785272f},
-std::array<float,2>{0.729863465f, 0.645661652f},
-std::array<float,2>{0.475561947f, 0.23077628f},
-std::array<float,2>{0.0710486397f, 0.815859735f},
-std::array<float,2>{0.824108958f, 0.427914977f},
-std::array<float,2>{0.948693693f, 0.921604574f},
-std::array<float,2>{0.142388254f, 0.297912836f},
-std::array<float,2>{0.367070377f, 0.586502731f},
-std::array<float,2>{0.510339439f, 0.0111034047f},
-std::array<float,2>{0.760067225f, 0.516044319f},
-std::array<float,2>{0.0587316006f, 0.0894332826f},
-std::array<float,2>{0.382568568f, 0.97779429f},
-std::array<float,2>{0.680687666f, 0.341832459f},
-std::array<float,2>{0.612245083f, 0.775586665f},
-std::array<float,2>{0.295906872f, 0.487976998f},
-std::array<float,2>{0.22111091f, 0.748078048f},
-std::array<float,2>{0.922103047f, 0.159678712f},
-std::array<float,2>{0.559979498f, 0.622791111f},
-std::array<float,2>{0.321434468f, 0.0463304743f},
-std::array<float,2>{0.1623303f, 0.897382736f},
-std::array<float,2>{0.99021554f, 0.253700346f},
-std::array<float,2>{0.868343651f, 0.858770847f},
-std::array<float,2>{0.113867588f, 0.403585702f},
-std::array<float,2>{0.443376005f, 0.660863042f},
-std::array<float,2>{0.712089002f, 0.190158084f},
-std::array<float,2>{0.899721146f, 0.718082488f},
-std::array<float,2>{0.21005106f, 0.138787314f},
-std::array<float,2>{0.265793264f, 0.797971547f},
-std::array<float,2>{0.585988402f, 0.454634756f},
-std::array<float,2>{0.629488766f, 0.943705678f},
-std::array<float,2>{0.42951715f, 0.368140429f},
-std::array<float,2>{0.000814290892f, 0.531735599f},
-std::array<float,2>{0.803129375f, 0.0957729742f},
-std::array<float,2>{0.505377233f, 0.664723635f},
-std::array<float,2>{0.367829025f, 0.202723116f},
-std::array<float,2>{0.153465778f, 0.848611891f},
-std::array<float,2>{0.943847001f, 0.392202914f},
-std::array<float,2>{0.818842232f, 0.902914405f},
-std::array<float,2>{0.0636438802f, 0.264148355f},
-std::array<float,2>{0.477083206f, 0.612851083f},
-std::array<float,2>{0.722055495f, 0.0379657857f},
-std::array<float,2>{0.932944834f, 0.544001818f},
-std::array<float,2>{0.229553461f, 0.101958223f},
-std::array<float,2>{0.287046701f, 0.951642454f},
-std::array<float,2>{0.622853935f, 0.365073413f},
-std::array<float,2>{0.678797126f, 0.810579717f},
-std::array<float,2>{0.388721198f, 0.465652168f},
-std::array<float,2>{0.0479010977f, 0.710309267f},
-std::array<float,2>{0.752555013f, 0.130893409f},
-std::array<float,2>{0.704608798f, 0.579788566f},
-std::array<float,2>{0.451043248f, 0.00203627045f},
-std::array<float,2>{0.122745872f, 0.908047974f},
-std::array<float,2>{0.862269938f, 0.30588153f},
-std::array<float,2>{0.992212951f, 0.824171841f},
-std::array<float,2>{0.168754846f, 0.433859587f},
-std::array<float,2>{0.317699045f, 0.65012908f},
-std::array<float,2>{0.547497272f, 0.223120272f},
-std::array<float,2>{0.808345973f, 0.741379261f},
-std::array<float,2>{0.0145932594f, 0.165421784f},
-std::array<float,2>{0.431784689f, 0.771455109f},
-std::array<float,2>{0.633398235f, 0.497635394f},
-std::array<float,2>{0.578891397f, 0.973582804f},
-std::array<float,2>{0.280973345f, 0.33548674f},
-std::array<float,2>{0.21349299f, 0.527177095f},
-std::array<float,2>{0.89204371f, 0.0857315287f},
-std::array<float,2>{0.643180609f, 0.701484978f},
-std::array<float,2>{0.418929875f, 0.155581132f},
-std::array<float,2>{0.0190275293f, 0.794817865f},
-std::array<float,2>{0.793437004f, 0.446314305f},
-std::array<float,2>{0.888311028f, 0.967012405f},
-std::array<float,2>{0.196561337f, 0.345750719f},
-std::array<float,2>{0.251544148f, 0.554443598f},
-std::array<float,2>{0.569834471f, 0.120287664f},
-std::array<float,2>{0.859327674f, 0.602922142f},
-std::array<float,2>{0.0975225121f, 0.0565767623f},
-std::array<float,2>{0.468170702f, 0.887935102f},
-std::array<float,2>{0.691433847f, 0.269986242f},
-std::array<float,2>{0.535555124f, 0.872262597f},
-std::array<float,2>{0.337702572f, 0.388496518f},
-std::array<float,2>{0.186064422f, 0.682499945f},
-std::array<float,2>{0.971838713f, 0.208483443f},
-std::array<float,2>{0.601479888f, 0.508602321f},
-std::array<float,2>{0.301336199f, 0.0638958961f},
-std::array<float,2>{0.246282682f, 0.993224859f},
-std::array<float,2>{0.910994411f, 0.314023554f},
-std::array<float,2>{0.776078761f, 0.76514256f},
-std::array<float,2>{0.0418894701f, 0.480719835f},
-std::array<float,2>{0.39137274f, 0.730610967f},
-std::array<float,2>{0.66530925f, 0.184960276f},
-std::array<float,2>{0.968152523f, 0.626341283f},
-std::array<float,2>{0.130224332f, 0.244435191f},
-std::array<float,2>{0.35285598f, 0.831522763f},
-std::array<float,2>{0.52397871f, 0.408470988f},
-std::array<float,2>{0.735206068f, 0.93143785f},
-std::array<float,2>{0.489676595f, 0.284743637f},
-std::array<float,2>{0.0861037672f, 0.575966716f},
-std::array<float,2>{0.834648132f, 0.0188270956f},
-std::array<float,2>{0.622592032f, 0.666884363f},
-std::array<float,2>{0.286857158f, 0.200081244f},
-std::array<float,2>{0.229746997f, 0.850281119f},
-std::array<float,2>{0.932645917f, 0.393437356f},
-std::array<float,2>{0.752772331f, 0.90565002f},
-std::array<float,2>{0.048321005f, 0.263331711f},
-std::array<float,2>{0.389145315f, 0.610168397f},
-std::array<float,2>{0.679067194f, 0.0360797122f},
-std::array<float,2>{0.943550229f, 0.545890152f},
-std::array<float,2>{0.153668657f, 0.10463421f},
-std::array<float,2>{0.367994934f, 0.950010359f},
-std::array<float,2>{0.505647361f, 0.366248608f},
-std::array<float,2>{0.721804321f, 0.810204148f},
-std::array<float,2>{0.477499902f, 0.467877865f},
-std::array<float,2>{0.0639234185f, 0.707565069f},
-std::array<float,2>{0.818469763f, 0.129508004f},
-std::array<float,2>{0.633594632f, 0.581817627f},
-std::array<float,2>{0.431923658f, 0.00129749207f},
-std::array<float,2>{0.0142401559f, 0.909702718f},
-std::array<float,2>{0.808447897f, 0.307587922f},
-std::array<float,2>{0.891759574f, 0.820922136f},
-std::array<float,2>{0.213740706f, 0.436210275f},
-std::array<float,2>{0.281203777f, 0.652334452f},
-std::array<float,2>{0.578775585f, 0.224624857f},
-std::array<float,2>{0.862032056f, 0.739213765f},
-std::array<float,2>{0.122957461f, 0.167587161f},
-std::array<float,2>{0.450703204f, 0.772236049f},
-std::array<float,2>{0.70493257f, 0.499533445f},
-std::array<float,2>{0.54783535f, 0.975253284f},
-std::array<float,2>{0.317499042f, 0.332822174f},
-std::array<float,2>{0.168700173f, 0.524540186f},
-std::array<float,2>{0.992594063f, 0.0828713328f},
-std::array<float,2>{0.691734254f, 0.700037301f},
-std::array<float,2>{0.467807502f, 0.152524471f},
-std::array<float,2>{0.0973496437f, 0.795901835f},
-std::array<float,2>{0.858917236f, 0.447558671f},
-std::array<float,2>{0.972020507f, 0.965921342f},
-std::array<float,2>{0.186396912f, 0.344153076f},
-std::array<float,2>{0.337643266f, 0.55154109f},
-std::array<float,2>{0.535189986f, 0.118423335f},
-std::array<float,2>{0.793084085f, 0.603782117f},
-std::array<float,2>{0.0185597129f, 0.0579523854f},
-std::array<float,2>{0.418668598f, 0.888911784f},
-std::array<float,2>{0.643357575f, 0.273281217f},
-std::array<float,2>{0.570204854f, 0.873975694f},
-std::array<float,2>{0.251876026f, 0.38973856f},
-std::array<float,2>{0.19633688f, 0.680973589f},
-std::array<float,2>{0.888665974f, 0.209950134f},
-std::array<float,2>{0.524282455f, 0.510385752f},
-std::array<float,2>{0.35277611f, 0.0658143908f},
-std::array<float,2>{0.12990132f, 0.995234728f},
-std::array<float,2>{0.967967689f, 0.314725429f},
-std::array<float,2>{0.834755599f, 0.762715757f},
-std::array<float,2>{0.0863344297f, 0.48260507f},
-std::array<float,2>{0.489447773f, 0.733330548f},
-std::array<float,2>{0.735020936f, 0.186174497f},
-std::array<float,2>{0.910829365f, 0.628629386f},
-std::array<float,2>{0.246541187f, 0.243651539f},
-std::array<float,2>{0.301574558f, 0.829855621f},
-std::array<float,2>{0.601242006f, 0.40757215f},
-std::array<float,2>{0.66514957f, 0.932848394f},
-std::array<float,2>{0.391332746f, 0.281652361f},
-std::array<float,2>{0.0415168703f, 0.576892257f},
-std::array<float,2>{0.776307702f, 0.0166506395f},
-std::array<float,2>{0.543795645f, 0.726056099f},
-std::array<float,2>{0.329817742f, 0.174359277f},
-std::array<float,2>{0.176907137f, 0.754003763f},
-std::array<float,2>{0.982286394f, 0.47560668f},
-std::array<float,2>{0.844293833f, 0.988528311f},
-std::array<float,2>{0.101954564f, 0.323755413f},
-std::array<float,2>{0.45793882f, 0.501685083f},
-std::array<float,2>{0.7017079f, 0.0716200322f},
-std::array<float,2>{0.875718296f, 0.563162327f},
-std::array<float,2>{0.188310146f, 0.030386623f},
-std::array<float,2>{0.259839147f, 0.926383913f},
-std::array<float,2>{0.576276004f, 0.290625811f},
-std::array<float,2>{0.651709378f, 0.838003516f},
-std::array<float,2>{0.41016531f, 0.415735096f},
-std::array<float,2>{0.02810473f, 0.636095226f},
-std::array<float,2>{0.784360468f, 0.236678749f},
-std::array<float,2>{0.747169375f, 0.55763638f},
-std::array<float,2>{0.492564231f, 0.110785887f},
-std::array<float,2>{0.0841364786f, 0.954819798f},
-std::array<float,2>{0.836589992f, 0.355337203f},
-std::array<float,2>{0.955888331f, 0.784428895f},
-std::array<float,2>{0.140295357f, 0.441882312f},
-std::array<float,2>{0.348404348f, 0.693382263f},
-std::array<float,2>{0.517464459f, 0.147373319f},
-std::array<float,2>{0.772579253f, 0.676756918f},
-std::array<float,2>{0.0330046713f, 0.212952226f},
-std::array<float,2>{0.399956375f, 0.86141026f},
-std::array<float,2>{0.660770059f, 0.37541315f},
-std::array<float,2>{0.603887081f, 0.87744391f},
-std::array<float,2>{0.306420028f, 0.273655623f},
-std::array<float,2>{0.237377599f, 0.59727633f},
-std::array<float,2>{0.916033208f, 0.0503402725f},
-std::array<float,2>{0.681075037f, 0.647843182f},
-std::array<float,2>{0.382519364f, 0.233894229f},
-std::array<float,2>{0.0590541698f, 0.812605441f},
-std::array<float,2>{0.759945571f, 0.427355886f},
-std::array<float,2>{0.922132432f, 0.919540167f},
-std::array<float,2>{0.220879078f, 0.300072432f},
-std::array<float,2>{0.296310663f, 0.589590907f},
-std::array<float,2>{0.611899197f, 0.00818531215f},
-std::array<float,2>{0.823781073f, 0.517853379f},
-std::array<float,2>{0.0708358213f, 0.0877361894f},
-std::array<float,2>{0.475328416f, 0.979131401f},
-std::array<float,2>{0.729579687f, 0.340062559f},
-std::array<float,2>{0.510740638f, 0.773735583f},
-std::array<float,2>{0.366776615f, 0.48482731f},
-std::array<float,2>{0.142234877f, 0.746996522f},
-std::array<float,2>{0.948313892f, 0.156791404f},
-std::array<float,2>{0.586297154f, 0.62378931f},
-std::array<float,2>{0.26608932f, 0.0445955843f},
-std::array<float,2>{0.210354775f, 0.896310449f},
-std::array<float,2>{0.89962852f, 0.25015524f},
-std::array<float,2>{0.802929938f, 0.856218994f},
-std::array<float,2>{0.000676500436f, 0.406142503f},
-std::array<float,2>{0.429328263f, 0.663656592f},
-std::array<float,2>{0.629713595f, 0.187957138f},
-std::array<float,2>{0.989753187f, 0.716570139f},
-std::array<float,2>{0.162374541f, 0.138196558f},
-std::array<float,2>{0.321573555f, 0.799034119f},
-std::array<float,2>{0.559717596f, 0.455632418f},
-std::array<float,2>{0.712304711f, 0.942722201f},
-std::array<float,2>{0.443800539f, 0.369257599f},
-std::array<float,2>{0.114098936f, 0.53382951f},
-std::array<float,2>{0.868643701f, 0.0937592611f},
-std::array<float,2>{0.570583582f, 0.706526399f},
-std::array<float,2>{0.26348874f, 0.127830699f},
-std::array<float,2>{0.192682609f, 0.806357384f},
-std::array<float,2>{0.879670203f, 0.461157441f},
-std::array<float,2>{0.787603915f, 0.948909044f},
-std::array<float,2>{0.0247857925f, 0.363265842f},
-std::array<float,2>{0.407126933f, 0.539253235f},
-std::array<float,2>{0.652954996f, 0.107585296f},
-std::array<float,2>{0.977511048f, 0.614557981f},
-std::array<float,2>{0.1725187f, 0.0342060141f},
-std::array<float,2>{0.332694262f, 0.899429321f},
-std::array<float,2>{0.540376663f, 0.258089721f},
-std::array<float,2>{0.695481658f, 0.847193658f},
-std::array<float,2>{0.45669198f, 0.397611737f},
-std::array<float,2>{0.105846621f, 0.669458807f},
-std::array<float,2>{0.851427495f, 0.197442368f},
-std::array<float,2>{0.656735301f, 0.528798282f},
-std::array<float,2>{0.402525961f, 0.0818003938f},
-std::array<float,2>{0.0375581458f, 0.969926596f},
-std::array<float,2>{0.768684089f, 0.3313241f},
-std::array<float,2>{0.91944629f, 0.766445458f},
-std::array<float,2>{0.239722192f, 0.495177358f},
-std::array<float,2>{0.309254676f, 0.735464692f},
-std::array<float,2>{0.606756628f, 0.169883206f},
-std::array<float,2>{0.841915429f, 0.656020403f},
-std::array<float,2>{0.0807066858f, 0.222591802f},
-std::array<float,2>{0.499305695f, 0.827536762f},
-std::array<float,2>{0.742563128f, 0.43272844f},
-std::array<float,2>{0.523190796f, 0.910892308f},
-std::array<float,2>{0.345285535f, 0.311976433f},
-std::array<float,2>{0.133259267f, 0.582405031f},
-std::array<float,2>{0.960076332f, 0.00490621105f},
-std::array<float,2>{0.733942091f, 0.683863223f},
-std::array<float,2>{0.469804287f, 0.206098005f},
-std::array<float,2>{0.0763258263f, 0.870420218f},
-std::array<float,2>{0.824255526f, 0.38330543f},
-std::array<float,2>{0.951911747f, 0.886253893f},
-std::array<float,2>{0.145626545f, 0.266594946f},
-std::array<float,2>{0.363246411f, 0.608329594f},
-std::array<float,2>{0.514715135f, 0.0594348423f},
-std::array<float,2>{0.764704108f, 0.548387289f},
-std::array<float,2>{0.0547153167f, 0.124703057f},
-std::array<float,2>{0.377086699f, 0.961605251f},
-std::array<float,2>{0.687001348f, 0.34851104f},
-std::array<float,2>{0.614716589f, 0.792853177f},
-std::array<float,2>{0.290583611f, 0.45106259f},
-std::array<float,2>{0.22325024f, 0.695555449f},
-std::array<float,2>{0.926169813f, 0.152033702f},
-std::array<float,2>{0.557249069f, 0.573646128f},
-std::array<float,2>{0.324580431f, 0.0218577664f},
-std::array<float,2>{0.159790322f, 0.936818242f},
-std::array<float,2>{0.986336052f, 0.288949072f},
-std::array<float,2>{0.874952614f, 0.832977533f},
-std::array<float,2>{0.112203702f, 0.412942678f},
-std::array<float,2>{0.441381067f, 0.629456103f},
-std::array<float,2>{0.715942442f, 0.246960714f},
-std::array<float,2>{0.904043674f, 0.727065802f},
-std::array<float,2>{0.205604106f, 0.180187508f},
-std::array<float,2>{0.27169168f, 0.758099854f},
-std::array<float,2>{0.593542755f, 0.479870081f},
-std::array<float,2>{0.627620399f, 0.99642241f},
-std::array<float,2>{0.425406069f, 0.319897592f},
-std::array<float,2>{0.00604992453f, 0.512131393f},
-std::array<float,2>{0.799025655f, 0.0666392148f},
-std::array<float,2>{0.502955317f, 0.639937758f},
-std::array<float,2>{0.37206009f, 0.240843624f},
-std::array<float,2>{0.148779511f, 0.841893017f},
-std::array<float,2>{0.938744009f, 0.418862671f},
-std::array<float,2>{0.81367439f, 0.925027311f},
-std::array<float,2>{0.0702021495f, 0.295563072f},
-std::array<float,2>{0.480994582f, 0.568890035f},
-std::array<float,2>{0.722658575f, 0.0242778454f},
-std::array<float,2>{0.93657738f, 0.506105483f},
-std::array<float,2>{0.230829403f, 0.0753569007f},
-std::array<float,2>{0.283777833f, 0.987031519f},
-std::array<float,2>{0.619406939f, 0.324455142f},
-std::array<float,2>{0.672274053f, 0.750538945f},
-std::array<float,2>{0.384805232f, 0.470154941f},
-std::array<float,2>{0.0518326573f, 0.719161749f},
-std::array<float,2>{0.756474257f, 0.178338349f},
-std::array<float,2>{0.707880676f, 0.600726306f},
-std::array<float,2>{0.445955783f, 0.0545875952f},
-std::array<float,2>{0.117354415f, 0.879095137f},
-std::array<float,2>{0.86587745f, 0.278373331f},
-std::array<float,2>{0.998629868f, 0.866665721f},
-std::array<float,2>{0.167377248f, 0.380415916f},
-std::array<float,2>{0.313612849f, 0.673405766f},
-std::array<float,2>{0.55312556f, 0.21635586f},
-std::array<float,2>{0.812394559f, 0.690888524f},
-std::array<float,2>{0.00913489051f, 0.142274201f},
-std::array<float,2>{0.436211288f, 0.787776947f},
-std::array<float,2>{0.638710499f, 0.439433515f},
-std::array<float,2>{0.584407747f, 0.958828747f},
-std::array<float,2>{0.274473727f, 0.359092504f},
-std::array<float,2>{0.218520716f, 0.560667694f},
-std::array<float,2>{0.896061361f, 0.113821082f},
-std::array<float,2>{0.647638381f, 0.74567616f},
-std::array<float,2>{0.417842388f, 0.162763432f},
-std::array<float,2>{0.0209971461f, 0.777907312f},
-std::array<float,2>{0.790917993f, 0.48915711f},
-std::array<float,2>{0.883152127f, 0.981506884f},
-std::array<float,2>{0.201435342f, 0.336673111f},
-std::array<float,2>{0.25643602f, 0.520425916f},
-std::array<float,2>{0.562778711f, 0.0934627801f},
-std::array<float,2>{0.854348958f, 0.591194808f},
-std::array<float,2>{0.101010256f, 0.0123325447f},
-std::array<float,2>{0.463235378f, 0.916270196f},
-std::array<float,2>{0.68776983f, 0.30207929f},
-std::array<float,2>{0.531505287f, 0.818583369f},
-std::array<float,2>{0.342405796f, 0.423485547f},
-std::array<float,2>{0.183428973f, 0.643850029f},
-std::array<float,2>{0.976318479f, 0.229840249f},
-std::array<float,2>{0.59539932f, 0.535594165f},
-std::array<float,2>{0.300636292f, 0.0987101942f},
-std::array<float,2>{0.24443306f, 0.940706551f},
-std::array<float,2>{0.909645975f, 0.374817193f},
-std::array<float,2>{0.779717982f, 0.804044306f},
-std::array<float,2>{0.0454175025f, 0.459005624f},
-std::array<float,2>{0.395249367f, 0.714508176f},
-std::array<float,2>{0.66916728f, 0.135445222f},
-std::array<float,2>{0.962780952f, 0.656713963f},
-std::array<float,2>{0.126425788f, 0.192110896f},
-std::array<float,2>{0.358062178f, 0.852220714f},
-std::array<float,2>{0.528053582f, 0.401861161f},
-std::array<float,2>{0.739106834f, 0.892667472f},
-std::array<float,2>{0.484803617f, 0.254747689f},
-std::array<float,2>{0.0918420255f, 0.619663656f},
-std::array<float,2>{0.831924677f, 0.0416569412f},
-std::array<float,2>{0.581037879f, 0.649098098f},
-std::array<float,2>{0.278808713f, 0.223998547f},
-std::array<float,2>{0.211319759f, 0.822589755f},
-std::array<float,2>{0.892798901f, 0.435371995f},
-std::array<float,2>{0.806102753f, 0.906652331f},
-std::array<float,2>{0.0118946759f, 0.305107117f},
-std::array<float,2>{0.429871261f, 0.578589082f},
-std::array<float,2>{0.635370433f, 0.00358241354f},
-std::array<float,2>{0.994640052f, 0.525506556f},
-std::array<float,2>{0.171213701f, 0.0842222795f},
-std::array<float,2>{0.318449706f, 0.973867357f},
-std::array<float,2>{0.549826622f, 0.33469829f},
-std::array<float,2>{0.70589149f, 0.769985557f},
-std::array<float,2>{0.452236772f, 0.496690512f},
-std::array<float,2>{0.124027506f, 0.740408897f},
-std::array<float,2>{0.861287236f, 0.164160818f},
-std::array<float,2>{0.676600277f, 0.611347973f},
-std::array<float,2>{0.388297647f, 0.0388072319f},
-std::array<float,2>{0.0492670648f, 0.904002428f},
-std::array<float,2>{0.751457632f, 0.265061766f},
-std::array<float,2>{0.930506229f, 0.849148571f},
-std::array<float,2>{0.228436649f, 0.390672147f},
-std::array<float,2>{0.28792268f, 0.665973723f},
-std::array<float,2>{0.624107957f, 0.201438084f},
-std::array<float,2>{0.816574991f, 0.709683836f},
-std::array<float,2>{0.0655770153f, 0.132436171f},
-std::array<float,2>{0.480436862f, 0.812390268f},
-std::array<float,2>{0.71990931f, 0.466518253f},
-std::array<float,2>{0.507606149f, 0.95260781f},
-std::array<float,2>{0.369485378f, 0.364058971f},
-std::array<float,2>{0.156104147f, 0.543621182f},
-std::array<float,2>{0.94275552f, 0.10275691f},
-std::array<float,2>{0.737458706f, 0.732172191f},
-std::array<float,2>{0.491603345f, 0.183700785f},
-std::array<float,2>{0.0882219821f, 0.763781428f},
-std::array<float,2>{0.833713353f, 0.481966138f},
-std::array<float,2>{0.965495825f, 0.992268741f},
-std::array<float,2>{0.132330865f, 0.313075304f},
-std::array<float,2>{0.354257315f, 0.509761751f},
-std::array<float,2>{0.526519895f, 0.0628211796f},
-std::array<float,2>{0.77518487f, 0.574702978f},
-std::array<float,2>{0.039122317f, 0.0179134626f},
-std::array<float,2>{0.393665105f, 0.929940403f},
-std::array<float,2>{0.666999221f, 0.283600152f},
-std::array<float,2>{0.598851085f, 0.830877781f},
-std::array<float,2>{0.304561555f, 0.40972659f},
-std::array<float,2>{0.248717487f, 0.625122786f},
-std::array<float,2>{0.914048016f, 0.245868772f},
-std::array<float,2>{0.537320912f, 0.552866697f},
-std::array<float,2>{0.338780016f, 0.119640976f},
-std::array<float,2>{0.18379949f, 0.968115628f},
-std::array<float,2>{0.968931615f, 0.346813053f},
-std::array<float,2>{0.856224895f, 0.793815076f},
-std::array<float,2>{0.0939175561f, 0.446162105f},
-std::array<float,2>{0.466553658f, 0.702485681f},
-std::array<float,2>{0.694718778f, 0.155053362f},
-std::array<float,2>{0.888942659f, 0.682861209f},
-std::array<float,2>{0.198732778f, 0.207303956f},
-std::array<float,2>{0.252504259f, 0.871329486f},
-std::array<float,2>{0.566524684f, 0.387352616f},
-std::array<float,2>{0.642187536f, 0.887472212f},
-std::array<float,2>{0.420388103f, 0.270728618f},
-std::array<float,2>{0.0174126923f, 0.602112353f},
-std::array<float,2>{0.796083033f, 0.0554684885f},
-std::array<float,2>{0.519134879f, 0.692231476f},
-std::array<float,2>{0.350835592f, 0.146228507f},
-std::array<float,2>{0.137253627f, 0.782786131f},
-std::array<float,2>{0.953645349f, 0.444377035f},
-std::array<float,2>{0.838181078f, 0.95698297f},
-std::array<float,2>{0.0825178176f, 0.352425396f},
-std::array<float,2>{0.495716661f, 0.556302667f},
-std::array<float,2>{0.748899639f, 0.111964867f},
-std::array<float,2>{0.915628433f, 0.594849467f},
-std::array<float,2>{0.235127792f, 0.0486245416f},
-std::array<float,2>{0.30769217f, 0.875433087f},
-std::array<float,2>{0.602244854f, 0.275693327f},
-std::array<float,2>{0.662286043f, 0.859892786f},
-std::array<float,2>{0.40054965f, 0.37833178f},
-std::array<float,2>{0.0350050554f, 0.677849889f},
-std::array<float,2>{0.769833267f, 0.211866349f},
-std::array<float,2>{0.7000646f, 0.502177179f},
-std::array<float,2>{0.460038066f, 0.0737646371f},
-std::array<float,2>{0.103816375f, 0.992150307f},
-std::array<float,2>{0.846476138f, 0.321807474f},
-std::array<float,2>{0.983234644f, 0.757340074f},
-std::array<float,2>{0.179120019f, 0.474401355f},
-std::array<float,2>{0.331312001f, 0.724519014f},
-std::array<float,2>{0.545323312f, 0.172355995f},
-std::array<float,2>{0.781331599f, 0.632826865f},
-std::array<float,2>{0.0299197678f, 0.236015081f},
-std::array<float,2>{0.413993478f, 0.83737123f},
-std::array<float,2>{0.648501456f, 0.417073786f},
-std::array<float,2>{0.575046241f, 0.928632259f},
-std::array<float,2>{0.258758157f, 0.292867988f},
-std::array<float,2>{0.189559802f, 0.565593481f},
-std::array<float,2>{0.878220022f, 0.0285973884f},
-std::array<float,2>{0.631732643f, 0.661990225f},
-std::array<float,2>{0.426982343f, 0.190827012f},
-std::array<float,2>{0.00201863889f, 0.858181715f},
-std::array<float,2>{0.80143863f, 0.402978718f},
-std::array<float,2>{0.901676118f, 0.89804858f},
-std::array<float,2>{0.207732797f, 0.252587378f},
-std::array<float,2>{0.268325597f, 0.621116459f},
-std::array<float,2>{0.589031518f, 0.0450335257f},
-std::array<float,2>{0.870592535f, 0.532372355f},
-std::array<float,2>{0.117187314f, 0.0969083756f},
-std::array<float,2>{0.44204849f, 0.945299983f},
-std::array<float,2>{0.714400589f, 0.368383348f},
-std::array<float,2>{0.561827242f, 0.797052681f},
-std::array<float,2>{0.323850751f, 0.453279018f},
-std::array<float,2>{0.160449475f, 0.717663348f},
-std::array<float,2>{0.991524756f, 0.140154809f},
-std::array<float,2>{0.609777451f, 0.587009192f},
-std::array<float,2>{0.294358671f, 0.0106672635f},
-std::array<float,2>{0.219669297f, 0.920757353f},
-std::array<float,2>{0.9239586f, 0.297839433f},
-std::array<float,2>{0.758007109f, 0.81498915f},
-std::array<float,2>{0.0608556159f, 0.429557651f},
-std::array<float,2>{0.380831331f, 0.645410478f},
-std::array<float,2>{0.682549238f, 0.232258484f},
-std::array<float,2>{0.946463823f, 0.749563575f},
-std::array<float,2>{0.143898591f, 0.158480093f},
-std::array<float,2>{0.364665538f, 0.776580989f},
-std::array<float,2>{0.508768976f, 0.486818373f},
-std::array<float,2>{0.727517128f, 0.977008998f},
-std::array<float,2>{0.473965108f, 0.342989445f},
-std::array<float,2>{0.0725883394f, 0.517268121f},
-std::array<float,2>{0.821408689f, 0.0886337757f},
-std::array<float,2>{0.60768795f, 0.736781061f},
-std::array<float,2>{0.312396556f, 0.171874166f},
-std::array<float,2>{0.241022065f, 0.76863414f},
-std::array<float,2>{0.921859562f, 0.492478609f},
-std::array<float,2>{0.765811443f, 0.971953273f},
-std::array<float,2>{0.0363409966f, 0.329907984f},
-std::array<float,2>{0.404861569f, 0.52971828f},
-std::array<float,2>{0.65938592f, 0.0789988935f},
-std::array<float,2>{0.958694279f, 0.584769905f},
-std::array<float,2>{0.136295795f, 0.00638179807f},
-std::array<float,2>{0.346069187f, 0.913342774f},
-std::array<float,2>{0.520690382f, 0.309349269f},
-std::array<float,2>{0.745493233f, 0.826124847f},
-std::array<float,2>{0.496916085f, 0.430453628f},
-std::array<float,2>{0.0793529972f, 0.654278934f},
-std::array<float,2>{0.840789199f, 0.219946399f},
-std::array<float,2>{0.655042648f, 0.542440593f},
-std::array<float,2>{0.410074264f, 0.107141837f},
-std::array<float,2>{0.0269505084f, 0.946335852f},
-std::array<float,2>{0.785506845f, 0.359735221f},
-std::array<float,2>{0.881332874f, 0.807974339f},
-std::array<float,2>{0.193815887f, 0.464099318f},
-std::array<float,2>{0.26380223f, 0.703273892f},
-std::array<float,2>{0.574017167f, 0.125696018f},
-std::array<float,2>{0.848499477f, 0.670865536f},
-std::array<float,2>{0.108928919f, 0.195797458f},
-std::array<float,2>{0.4531762f, 0.844880879f},
-std::array<float,2>{0.69899416f, 0.394867063f},
-std::array<float,2>{0.541485012f, 0.901716173f},
-std::array<float,2>{0.335263997f, 0.260982871f},
-std::array<float,2>{0.173835382f, 0.616795778f},
-std::array<float,2>{0.980241179f, 0.0330947936f},
-std::array<float,2>{0.718686163f, 0.632455707f},
-std::array<float,2>{0.437634259f, 0.249080867f},
-std::array<float,2>{0.110502616f, 0.834296286f},
-std::array<float,2>{0.871885061f, 0.411267549f},
-std::array<float,2>{0.985149443f, 0.9335953f},
-std::array<float,2>{0.157074377f, 0.285414726f},
-std::array<float,2>{0.327854216f, 0.571478069f},
-std::array<float,2>{0.555592477f, 0.0208730157f},
-std::array<float,2>{0.797643602f, 0.51521194f},
-std::array<float,2>{0.00441637821f, 0.0696832389f},
-std::array<float,2>{0.423689723f, 0.998783708f},
-std::array<float,2>{0.626454234f, 0.317780286f},
-std::array<float,2>{0.591685057f, 0.761457086f},
-std::array<float,2>{0.271275222f, 0.478412002f},
-std::array<float,2>{0.203489363f, 0.729918718f},
-std::array<float,2>{0.905942023f, 0.182559595f},
-std::array<float,2>{0.512796521f, 0.60609746f},
-std::array<float,2>{0.361058265f, 0.0606689565f},
-std::array<float,2>{0.148352847f, 0.882896721f},
-std::array<float,2>{0.950597167f, 0.268243998f},
-std::array<float,2>{0.826653421f, 0.868525088f},
-std::array<float,2>{0.0746490285f, 0.385551482f},
-std::array<float,2>{0.470983952f, 0.686374843f},
-std::array<float,2>{0.730487168f, 0.203301921f},
-std::array<float,2>{0.92914927f, 0.697747648f},
-std::array<float,2>{0.224758595f, 0.148703456f},
-std::array<float,2>{0.292639256f, 0.790121973f},
-std::array<float,2>{0.616124034f, 0.453002483f},
-std::array<float,2>{0.685021937f, 0.963932872f},
-std::array<float,2>{0.375218123f, 0.351430058f},
-std::array<float,2>{0.0569940843f, 0.550688386f},
-std::array<float,2>{0.762892544f, 0.122776791f},
-std::array<float,2>{0.551107228f, 0.675510645f},
-std::array<float,2>{0.315172851f, 0.218367472f},
-std::array<float,2>{0.16543293f, 0.865220308f},
-std::array<float,2>{0.996756792f, 0.382087767f},
-std::array<float,2>{0.864553452f, 0.881872118f},
-std::array<float,2>{0.119196594f, 0.280605674f},
-std::array<float,2>{0.448046476f, 0.598946452f},
-std::array<float,2>{0.709289432f, 0.0522294417f},
-std::array<float,2>{0.897123456f, 0.559484422f},
-std::array<float,2>{0.216140106f, 0.115949318f},
-std::array<float,2>{0.276751637f, 0.96053654f},
-std::array<float,2>{0.582145333f, 0.356698424f},
-std::array<float,2>{0.638153315f, 0.786482096f},
-std::array<float,2>{0.434676528f, 0.440709382f},
-std::array<float,2>{0.0104639167f, 0.688625276f},
-std::array<float,2>{0.808651388f, 0.1437314f},
-std::array<float,2>{0.724815428f, 0.566457152f},
-std::array<float,2>{0.48409614f, 0.0259264149f},
-std::array<float,2>{0.0680591911f, 0.923551559f},
-std::array<float,2>{0.814649343f, 0.294241756f},
-std::array<float,2>{0.940614402f, 0.840566754f},
-std::array<float,2>{0.150700912f, 0.420605391f},
-std::array<float,2>{0.374482751f, 0.637348294f},
-std::array<float,2>{0.501231492f, 0.239741564f},
-std::array<float,2>{0.754794538f, 0.721714795f},
-std::array<float,2>{0.0538501479f, 0.177297562f},
-std::array<float,2>{0.383183986f, 0.752085686f},
-std::array<float,2>{0.674920678f, 0.471474856f},
-std::array<float,2>{0.618730366f, 0.985814393f},
-std::array<float,2>{0.281949461f, 0.32695514f},
-std::array<float,2>{0.233402774f, 0.50555402f},
-std::array<float,2>{0.934338272f, 0.0772007629f},
-std::array<float,2>{0.671251535f, 0.712158203f},
-std::array<float,2>{0.396607369f, 0.134498835f},
-std::array<float,2>{0.0442779139f, 0.802156329f},
-std::array<float,2>{0.778274119f, 0.457331628f},
-std::array<float,2>{0.907986224f, 0.937816322f},
-std::array<float,2>{0.244122669f, 0.372394383f},
-std::array<float,2>{0.297256917f, 0.538616121f},
-std::array<float,2>{0.596839607f, 0.100821391f},
-std::array<float,2>{0.829796195f, 0.618465364f},
-std::array<float,2>{0.0911220983f, 0.0395043902f},
-std::array<float,2>{0.486846358f, 0.892170906f},
-std::array<float,2>{0.74121356f, 0.257622391f},
-std::array<float,2>{0.530431867f, 0.854172051f},
-std::array<float,2>{0.356452763f, 0.399935991f},
-std::array<float,2>{0.127082556f, 0.658630252f},
-std::array<float,2>{0.963680625f, 0.194872931f},
-std::array<float,2>{0.566211581f, 0.522367001f},
-std::array<float,2>{0.255598664f, 0.0917932689f},
-std::array<float,2>{0.200253099f, 0.984145284f},
-std::array<float,2>{0.886137187f, 0.33892259f},
-std::array<float,2>{0.791777015f, 0.779509485f},
-std::array<float,2>{0.0221384298f, 0.490414977f},
-std::array<float,2>{0.415694863f, 0.743532121f},
-std::array<float,2>{0.644557416f, 0.162080467f},
-std::array<float,2>{0.974046588f, 0.642028868f},
-std::array<float,2>{0.181575075f, 0.227329686f},
-std::array<float,2>{0.340103686f, 0.816509604f},
-std::array<float,2>{0.535143375f, 0.425549865f},
-std::array<float,2>{0.689918816f, 0.914508641f},
-std::array<float,2>{0.461912185f, 0.304207772f},
-std::array<float,2>{0.0985452831f, 0.59333992f},
-std::array<float,2>{0.852539241f, 0.0155452639f},
-std::array<float,2>{0.568145931f, 0.6800583f},
-std::array<float,2>{0.253527522f, 0.210805506f},
-std::array<float,2>{0.197521016f, 0.874286354f},
-std::array<float,2>{0.890145004f, 0.388778508f},
-std::array<float,2>{0.795430064f, 0.890421748f},
-std::array<float,2>{0.0161852352f, 0.272042662f},
-std::array<float,2>{0.421320409f, 0.604498625f},
-std::array<float,2>{0.641462684f, 0.057286717f},
-std::array<float,2>{0.970584512f, 0.552710176f},
-std::array<float,2>{0.185210094f, 0.117235422f},
-std::array<float,2>{0.339428961f, 0.965402126f},
-std::array<float,2>{0.538159966f, 0.34532401f},
-std::array<float,2>{0.693463027f, 0.795674503f},
-std::array<float,2>{0.465040803f, 0.448852688f},
-std::array<float,2>{0.0947446898f, 0.70042491f},
-std::array<float,2>{0.856759906f, 0.154109627f},
-std::array<float,2>{0.66610074f, 0.57759279f},
-std::array<float,2>{0.393198222f, 0.0159899127f},
-std::array<float,2>{0.0407873876f, 0.931713223f},
-std::array<float,2>{0.774017632f, 0.282240301f},
-std::array<float,2>{0.912513375f, 0.828402698f},
-std::array<float,2>{0.249082804f, 0.407175303f},
-std::array<float,2>{0.30354467f, 0.627182066f},
-std::array<float,2>{0.597731471f, 0.242208272f},
-std::array<float,2>{0.832344651f, 0.733839214f},
-std::array<float,2>{0.0894510821f, 0.186564967f},
-std::array<float,2>{0.490634173f, 0.762234509f},
-std::array<float,2>{0.737252831f, 0.483511835f},
-std::array<float,2>{0.525399506f, 0.994591177f},
-std::array<float,2>{0.354592502f, 0.31610474f},
-std::array<float,2>{0.130889833f, 0.511051834f},
-std::array<float,2>{0.966633379f, 0.0653848723f},
-std::array<float,2>{0.719543874f, 0.708571911f},
-std::array<float,2>{0.478773654f, 0.130072311f},
-std::array<float,2>{0.0650252625f, 0.809506893f},
-std::array<float,2>{0.817678154f, 0.467101902f},
-std::array<float,2>{0.941929042f, 0.95084995f},
-std::array<float,2>{0.154985383f, 0.365419477f},
-std::array<float,2>{0.370173573f, 0.546457171f},
-std::array<float,2>{0.505954027f, 0.103757985f},
-std::array<float,2>{0.750375748f, 0.611253083f},
-std::array<float,2>{0.050698448f, 0.0369424336f},
-std::array<float,2>{0.38692525f, 0.905033529f},
-std::array<float,2>{0.677622736f, 0.262620658f},
-std::array<float,2>{0.623724699f, 0.851261854f},
-std::array<float,2>{0.288246512f, 0.394443959f},
-std::array<float,2>{0.227474704f, 0.667543948f},
-std::array<float,2>{0.930898309f, 0.200767055f},
-std::array<float,2>{0.548837066f, 0.523623943f},
-std::array<float,2>{0.319661766f, 0.0836251751f},
-std::array<float,2>{0.170328364f, 0.976234376f},
-std::array<float,2>{0.995952129f, 0.33346644f},
-std::array<float,2>{0.860038638f, 0.773278356f},
-std::array<float,2>{0.123340935f, 0.498258203f},
-std::array<float,2>{0.452035367f, 0.739729524f},
-std::array<float,2>{0.706652999f, 0.166124135f},
-std::array<float,2>{0.893834293f, 0.651069224f},
-std::array<float,2>{0.212653548f, 0.226048976f},
-std::array<float,2>{0.277868211f, 0.822016895f},
-std::array<float,2>{0.581466973f, 0.436785072f},
-std::array<float,2>{0.636531413f, 0.908492982f},
-std::array<float,2>{0.43161726f, 0.30831635f},
-std::array<float,2>{0.0131057147f, 0.58082968f},
-std::array<float,2>{0.805096984f, 0.000746725302f},
-std::array<float,2>{0.508873343f, 0.747143149f},
-std::array<float,2>{0.363480926f, 0.15780212f},
-std::array<float,2>{0.143096611f, 0.775184333f},
-std::array<float,2>{0.945498288f, 0.486107379f},
-std::array<float,2>{0.82065779f, 0.979758263f},
-std::array<float,2>{0.0741981044f, 0.341120511f},
-std::array<float,2>{0.472733676f, 0.519088089f},
-std::array<float,2>{0.728359342f, 0.0867640227f},
-std::array<float,2>{0.925484419f, 0.588314712f},
-std::array<float,2>{0.22005932f, 0.00940919574f},
-std::array<float,2>{0.293433607f, 0.918317318f},
-std::array<float,2>{0.61109525f, 0.299513638f},
-std::array<float,2>{0.683554292f, 0.813584924f},
-std::array<float,2>{0.379074574f, 0.426106483f},
-std::array<float,2>{0.062184006f, 0.646723688f},
-std::array<float,2>{0.758851349f, 0.233127922f},
-std::array<float,2>{0.713396907f, 0.53425777f},
-std::array<float,2>{0.442589074f, 0.0949048474f},
-std::array<float,2>{0.11565838f, 0.941994488f},
-std::array<float,2>{0.869888723f, 0.370818317f},
-std::array<float,2>{0.991043985f, 0.79996103f},
-std::array<float,2>{0.161961302f, 0.456111372f},
-std::array<float,2>{0.322725922f, 0.715107441f},
-std::array<float,2>{0.56056726f, 0.137589663f},
-std::array<float,2>{0.802422404f, 0.66239965f},
-std::array<float,2>{0.00357213407f, 0.189150333f},
-std::array<float,2>{0.4262999f, 0.856960535f},
-std::array<float,2>{0.632504702f, 0.405230224f},
-std::array<float,2>{0.588395178f, 0.895113826f},
-std::array<float,2>{0.268885881f, 0.251859337f},
-std::array<float,2>{0.208544716f, 0.624434412f},
-std::array<float,2>{0.900949776f, 0.0431347415f},
-std::array<float,2>{0.649463356f, 0.635647118f},
-std::array<float,2>{0.412390441f, 0.237392589f},
-std::array<float,2>{0.0305181611f, 0.83940804f},
-std::array<float,2>{0.782242477f, 0.414615571f},
-std::array<float,2>{0.877331972f, 0.927117109f},
-std::array<float,2>{0.190531254f, 0.289482296f},
-std::array<float,2>{0.25975123f, 0.564139605f},
-std::array<float,2>{0.57580626f, 0.029775748f},
-std::array<float,2>{0.846831918f, 0.500935137f},
-std::array<float,2>{0.10483481f, 0.0709658638f},
-std::array<float,2>{0.459223807f, 0.99021107f},
-std::array<float,2>{0.70035851f, 0.32302919f},
-std::array<float,2>{0.546186686f, 0.755712271f},
-std::array<float,2>{0.330794126f, 0.474734485f},
-std::array<float,2>{0.178362504f, 0.724620283f},
-std::array<float,2>{0.984209836f, 0.175471336f},
-std::array<float,2>{0.603150129f, 0.596244514f},
-std::array<float,2>{0.306923419f, 0.0492588505f},
-std::array<float,2>{0.23613894f, 0.878840327f},
-std::array<float,2>{0.914134204f, 0.274709582f},
-std::array<float,2>{0.770719886f, 0.862568617f},
-std::array<float,2>{0.0333548002f, 0.376239002f},
-std::array<float,2>{0.401371181f, 0.677527726f},
-std::array<float,2>{0.663320601f, 0.213938996f},
-std::array<float,2>{0.954640925f, 0.694730699f},
-std::array<float,2>{0.138555124f, 0.14836657f},
-std::array<float,2>{0.350111008f, 0.783701122f},
-std::array<float,2>{0.518503308f, 0.442689896f},
-std::array<float,2>{0.749863744f, 0.953204155f},
-std::array<float,2>{0.49475953f, 0.354386181f},
-std::array<float,2>{0.0834809169f, 0.556662381f},
-std::array<float,2>{0.83896178f, 0.110072561f},
-std::array<float,2>{0.616229057f, 0.697161794f},
-std::array<float,2>{0.291672826f, 0.150879413f},
-std::array<float,2>{0.225681707f, 0.791037381f},
-std::array<float,2>{0.928027689f, 0.449567318f},
-std::array<float,2>{0.762088656f, 0.962257802f},
-std::array<float,2>{0.0579281077f, 0.349058777f},
-std::array<float,2>{0.376087785f, 0.547517121f},
-std::array<float,2>{0.684538364f, 0.123470463f},
-std::array<float,2>{0.949581444f, 0.608709931f},
-std::array<float,2>{0.147364423f, 0.0604514703f},
-std::array<float,2>{0.359410346f, 0.885303438f},
-std::array<float,2>{0.512659907f, 0.267321318f},
-std::array<float,2>{0.731559992f, 0.869929135f},
-std::array<float,2>{0.472145379f, 0.384555787f},
-std::array<float,2>{0.0755824372f, 0.684785426f},
-std::array<float,2>{0.827960849f, 0.205305099f},
-std::array<float,2>{0.625697255f, 0.512900412f},
-std::array<float,2>{0.422198117f, 0.0676549226f},
-std::array<float,2>{0.00536090648f, 0.997469962f},
-std::array<float,2>{0.798209131f, 0.319182217f},
-std::array<float,2>{0.90462631f, 0.758876264f},
-std::array<float,2>{0.204407752f, 0.479357719f},
-std::array<float,2>{0.269770145f, 0.727599919f},
-std::array<float,2>{0.590569139f, 0.180923507f},
-std::array<float,2>{0.872691631f, 0.630297899f},
-std::array<float,2>{0.110258482f, 0.247145206f},
-std::array<float,2>{0.43885687f, 0.833478212f},
-std::array<float,2>{0.717537642f, 0.413606346f},
-std::array<float,2>{0.556269825f, 0.935754538f},
-std::array<float,2>{0.326294035f, 0.287963778f},
-std::array<float,2>{0.157830045f, 0.572457671f},
-std::array<float,2>{0.985581756f, 0.0229379665f},
-std::array<float,2>{0.698115647f, 0.66843605f},
-std::array<float,2>{0.454750508f, 0.199007407f},
-std::array<float,2>{0.108139753f, 0.846493542f},
-std::array<float,2>{0.849145651f, 0.397004575f},
-std::array<float,2>{0.979474127f, 0.898853898f},
-std::array<float,2>{0.175026551f, 0.258892387f},
-std::array<float,2>{0.334942967f, 0.614207447f},
-std::array<float,2>{0.542957962f, 0.033990711f},
-std::array<float,2>{0.78696233f, 0.540917993f},
-std::array<float,2>{0.0254808944f, 0.108726315f},
-std::array<float,2>{0.408411086f, 0.948104858f},
-std::array<float,2>{0.655446291f, 0.361931711f},
-std::array<float,2>{0.57256937f, 0.805362642f},
-std::array<float,2>{0.265393555f, 0.462389082f},
-std::array<float,2>{0.194408298f, 0.705343604f},
-std::array<float,2>{0.882654786f, 0.128800899f},
-std::array<float,2>{0.520203531f, 0.583176672f},
-std::array<float,2>{0.346974701f, 0.00472424366f},
-std::array<float,2>{0.135431349f, 0.911681175f},
-std::array<float,2>{0.957880139f, 0.310577273f},
-std::array<float,2>{0.841741562f, 0.826321304f},
-std::array<float,2>{0.0783862323f, 0.432413399f},
-std::array<float,2>{0.497592241f, 0.655018806f},
-std::array<float,2>{0.744364083f, 0.221670181f},
-std::array<float,2>{0.920852721f, 0.735312581f},
-std::array<float,2>{0.242104709f, 0.168485805f},
-std::array<float,2>{0.310620338f, 0.766896904f},
-std::array<float,2>{0.608614624f, 0.494307071f},
-std::array<float,2>{0.658589482f, 0.969117701f},
-std::array<float,2>{0.406191766f, 0.330996424f},
-std::array<float,2>{0.0354392193f, 0.527677774f},
-std::array<float,2>{0.766624272f, 0.0808641091f},
-std::array<float,2>{0.534009397f, 0.64343524f},
-std::array<float,2>{0.341258645f, 0.228886887f},
-std::array<float,2>{0.180042252f, 0.820211947f},
-std::array<float,2>{0.973451138f, 0.421946853f},
-std::array<float,2>{0.8517856f, 0.917947173f},
-std::array<float,2>{0.0989884436f, 0.300888211f},
-std::array<float,2>{0.462519854f, 0.590525031f},
-std::array<float,2>{0.690563917f, 0.0127918888f},
-std::array<float,2>{0.885083795f, 0.521273136f},
-std::array<float,2>{0.199578881f, 0.0926835611f},
-std::array<float,2>{0.254166752f, 0.980768442f},
-std::array<float,2>{0.565389812f, 0.337795079f},
-std::array<float,2>{0.646134555f, 0.778983891f},
-std::array<float,2>{0.415005147f, 0.489958167f},
-std::array<float,2>{0.0227576979f, 0.744282722f},
-std::array<float,2>{0.792280495f, 0.163821116f},
-std::array<float,2>{0.740529239f, 0.621070802f},
-std::array<float,2>{0.487481385f, 0.0421897657f},
-std::array<float,2>{0.0899453834f, 0.893953919f},
-std::array<float,2>{0.828496993f, 0.25524348f},
-std::array<float,2>{0.964154422f, 0.853186488f},
-std::array<float,2>{0.128623784f, 0.400582314f},
-std::array<float,2>{0.355631471f, 0.657277405f},
-std::array<float,2>{0.529317617f, 0.19258447f},
-std::array<float,2>{0.778814495f, 0.712950289f},
-std::array<float,2>{0.0436306521f, 0.136161312f},
-std::array<float,2>{0.398037851f, 0.803691506f},
-std::array<float,2>{0.670184314f, 0.460536301f},
-std::array<float,2>{0.596675992f, 0.940244198f},
-std::array<float,2>{0.298657537f, 0.373821199f},
-std::array<float,2>{0.242861748f, 0.536220729f},
-std::array<float,2>{0.906512499f, 0.0977353603f},
-std::array<float,2>{0.674405932f, 0.720389187f},
-std::array<float,2>{0.384604245f, 0.17891784f},
-std::array<float,2>{0.0530407578f, 0.751336098f},
-std::array<float,2>{0.755658686f, 0.469349265f},
-std::array<float,2>{0.935015202f, 0.98791939f},
-std::array<float,2>{0.232473463f, 0.325557232f},
-std::array<float,2>{0.282922804f, 0.506913602f},
-std::array<float,2>{0.617277861f, 0.0743685961f},
-std::array<float,2>{0.815732181f, 0.569559216f},
-std::array<float,2>{0.0668091998f, 0.0253691915f},
-std::array<float,2>{0.483115286f, 0.924775183f},
-std::array<float,2>{0.725830376f, 0.296133101f},
-std::array<float,2>{0.50063163f, 0.843377233f},
-std::array<float,2>{0.373122066f, 0.419600338f},
-std::array<float,2>{0.151909158f, 0.639043629f},
-std::array<float,2>{0.939509749f, 0.242143661f},
-std::array<float,2>{0.583271682f, 0.561530054f},
-std::array<float,2>{0.275600672f, 0.11452353f},
-std::array<float,2>{0.215722173f, 0.957719207f},
-std::array<float,2>{0.897481024f, 0.358098447f},
-std::array<float,2>{0.809721828f, 0.788278461f},
-std::array<float,2>{0.0110176858f, 0.43756479f},
-std::array<float,2>{0.43397826f, 0.690341353f},
-std::array<float,2>{0.636761248f, 0.140771255f},
-std::array<float,2>{0.9977988f, 0.672468781f},
-std::array<float,2>{0.164101854f, 0.215046719f},
-std::array<float,2>{0.316102624f, 0.865597546f},
-std::array<float,2>{0.552521586f, 0.379686773f},
-std::array<float,2>{0.710484922f, 0.880737603f},
-std::array<float,2>{0.448862821f, 0.278103054f},
-std::array<float,2>{0.120756611f, 0.600406408f},
-std::array<float,2>{0.863355279f, 0.0531087108f},
-std::array<float,2>{0.600135922f, 0.626612127f},
-std::array<float,2>{0.3020522f, 0.245009452f},
-std::array<float,2>{0.247600451f, 0.831792414f},
-std::array<float,2>{0.911348641f, 0.409029722f},
-std::array<float,2>{0.776969135f, 0.931011677f},
-std::array<float,2>{0.0428608879f, 0.284204125f},
-std::array<float,2>{0.39232713f, 0.575530887f},
-std::array<float,2>{0.664596498f, 0.0194124356f},
-std::array<float,2>{0.967542648f, 0.507883966f},
-std::array<float,2>{0.128940687f, 0.0640472025f},
-std::array<float,2>{0.351769269f, 0.993982375f},
-std::array<float,2>{0.524534464f, 0.313492298f},
-std::array<float,2>{0.735838115f, 0.764744937f},
-std::array<float,2>{0.488739818f, 0.481347948f},
-std::array<float,2>{0.0869626179f, 0.731140077f},
-std::array<float,2>{0.835486531f, 0.18540971f},
-std::array<float,2>{0.644257367f, 0.603294134f},
-std::array<float,2>{0.419511199f, 0.0559313409f},
-std::array<float,2>{0.0185538549f, 0.888650894f},
-std::array<float,2>{0.794777691f, 0.270311713f},
-std::array<float,2>{0.886769116f, 0.872633159f},
-std::array<float,2>{0.19567214f, 0.387840807f},
-std::array<float,2>{0.250043273f, 0.682125449f},
-std::array<float,2>{0.568809927f, 0.208501875f},
-std::array<float,2>{0.85785532f, 0.701898038f},
-std::array<float,2>{0.0963847637f, 0.155766979f},
-std::array<float,2>{0.467154592f, 0.794161439f},
-std::array<float,2>{0.693041742f, 0.446843505f},
-std::array<float,2>{0.536706388f, 0.967703581f},
-std::array<float,2>{0.33653605f, 0.346479058f},
-std::array<float,2>{0.187444761f, 0.554015934f},
-std::array<float,2>{0.971475601f, 0.120995417f},
-std::array<float,2>{0.703493536f, 0.742108583f},
-std::array<float,2>{0.45012033f, 0.165963799f},
-std::array<float,2>{0.121308021f, 0.770845592f},
-std::array<float,2>{0.862635791f, 0.497527778f},
-std::array<float,2>{0.993335664f, 0.972913563f},
-std::array<float,2>{0.168950245f, 0.335212916f},
-std::array<float,2>{0.316975474f, 0.526729822f},
-std::array<float,2>{0.548295856f, 0.0852385461f},
-std::array<float,2>{0.807277024f, 0.57953161f},
-std::array<float,2>{0.0154519761f, 0.00262252381f},
-std::array<float,2>{0.432974875f, 0.907396495f},
-std::array<float,2>{0.633888423f, 0.306209475f},
-std::array<float,2>{0.579436719f, 0.82352674f},
-std::array<float,2>{0.280166715f, 0.434274524f},
-std::array<float,2>{0.214570254f, 0.649788678f},
-std::array<float,2>{0.890985131f, 0.223404214f},
-std::array<float,2>{0.504370391f, 0.544711828f},
-std::array<float,2>{0.368246108f, 0.102466114f},
-std::array<float,2>{0.153317243f, 0.951861262f},
-std::array<float,2>{0.944743633f, 0.364590526f},
-std::array<float,2>{0.820242226f, 0.81111455f},
-std::array<float,2>{0.0626509786f, 0.465072453f},
-std::array<float,2>{0.478370816f, 0.710893333f},
-std::array<float,2>{0.720819354f, 0.13164787f},
-std::array<float,2>{0.932321906f, 0.664069176f},
-std::array<float,2>{0.229050994f, 0.202315882f},
-std::array<float,2>{0.285949856f, 0.847925544f},
-std::array<float,2>{0.621956408f, 0.391835183f},
-std::array<float,2>{0.678124368f, 0.902451277f},
-std::array<float,2>{0.390077621f, 0.264180124f},
-std::array<float,2>{0.0476623029f, 0.612731218f},
-std::array<float,2>{0.753788292f, 0.0374664664f},
-std::array<float,2>{0.558636785f, 0.71833688f},
-std::array<float,2>{0.320375443f, 0.13942641f},
-std::array<float,2>{0.163893595f, 0.798738122f},
-std::array<float,2>{0.988562524f, 0.454114437f},
-std::array<float,2>{0.867737353f, 0.944226325f},
-std::array<float,2>{0.115035333f, 0.367499053f},
-std::array<float,2>{0.445218772f, 0.532139182f},
-std::array<float,2>{0.710979998f, 0.0965397954f},
-std::array<float,2>{0.898822486f, 0.622465193f},
-std::array<float,2>{0.209796444f, 0.0464872159f},
-std::array<float,2>{0.267053366f, 0.896843433f},
-std::array<float,2>{0.586928606f, 0.253299147f},
-std::array<float,2>{0.630399048f, 0.859095395f},
-std::array<float,2>{0.428131491f, 0.404289335f},
-std::array<float,2>{0.00163274782f, 0.660344124f},
-std::array<float,2>{0.804397583f, 0.189609036f},
-std::array<float,2>{0.72948736f, 0.516502619f},
-std::array<float,2>{0.476237088f, 0.0889810473f},
-std::array<float,2>{0.0713108033f, 0.978077054f},
-std::array<float,2>{0.822959244f, 0.342657208f},
-std::array<float,2>{0.947735846f, 0.776203573f},
-std::array<float,2>{0.140743524f, 0.487384528f},
-std::array<float,2>{0.365809321f, 0.748670399f},
-std::array<float,2>{0.51134032f, 0.159223571f},
-std::array<float,2>{0.761305749f, 0.646301389f},
-std::array<float,2>{0.0604357719f, 0.231302693f},
-std::array<float,2>{0.38092339f, 0.816306114f},
-std::array<float,2>{0.680167913f, 0.428262651f},
-std::array<float,2>{0.612414956f, 0.921021998f},
-std::array<float,2>{0.295709908f, 0.298572928f},
-std::array<float,2>{0.222438157f, 0.586393297f},
-std::array<float,2>{0.92325592f, 0.0116967754f},
-std::array<float,2>{0.661596894f, 0.679398954f},
-std::array<float,2>{0.398533434f, 0.211915717f},
-std::array<float,2>{0.0319560729f, 0.860731304f},
-std::array<float,2>{0.772156656f, 0.376993805f},
-std::array<float,2>{0.91735214f, 0.876118183f},
-std::array<float,2>{0.237000585f, 0.276752114f},
-std::array<float,2>{0.304957241f, 0.594119728f},
-std::array<float,2>{0.605273902f, 0.0474293418f},
-std::array<float,2>{0.837364972f, 0.554763734f},
-std::array<float,2>{0.085510917f, 0.112312473f},
-std::array<float,2>{0.493487239f, 0.955906749f},
-std::array<float,2>{0.746281743f, 0.352718711f},
-std::array<float,2>{0.515675008f, 0.78180033f},
-std::array<float,2>{0.348706126f, 0.443478972f},
-std::array<float,2>{0.139049262f, 0.692753911f},
-std::array<float,2>{0.95643127f, 0.145184308f},
-std::array<float,2>{0.578096986f, 0.564847589f},
-std::array<float,2>{0.261657834f, 0.027636094f},
-std::array<float,2>{0.189045608f, 0.929461002f},
-std::array<float,2>{0.876777351f, 0.291345209f},
-std::array<float,2>{0.783232987f, 0.83690089f},
-std::array<float,2>{0.0290241856f, 0.416573763f},
-std::array<float,2>{0.411767066f, 0.634266853f},
-std::array<float,2>{0.65042454f, 0.234630346f},
-std::array<float,2>{0.98088932f, 0.722910404f},
-std::array<float,2>{0.176665455f, 0.17302075f},
-std::array<float,2>{0.328513175f, 0.756249487f},
-std::array<float,2>{0.54428196f, 0.473175615f},
-std::array<float,2>{0.702157855f, 0.990780234f},
-std::array<float,2>{0.458158225f, 0.320892185f},
-std::array<float,2>{0.103284746f, 0.503126919f},
-std::array<float,2>{0.845393121f, 0.0731941313f},
-std::array<float,2>{0.591888368f, 0.728681505f},
-std::array<float,2>{0.273258597f, 0.182841927f},
-std::array<float,2>{0.206103057f, 0.760370433f},
-std::array<float,2>{0.903297007f, 0.477069378f},
-std::array<float,2>{0.800563753f, 0.999251902f},
-std::array<float,2>{0.0069882432f, 0.31694448f},
-std::array<float,2>{0.424452454f, 0.51451242f},
-std::array<float,2>{0.628476799f, 0.0691165328f},
-std::array<float,2>{0.987532139f, 0.570477128f},
-std::array<float,2>{0.158973381f, 0.0196311008f},
-std::array<float,2>{0.325887531f, 0.935328186f},
-std::array<float,2>{0.557956874f, 0.286380738f},
-std::array<float,2>{0.715742886f, 0.835323453f},
-std::array<float,2>{0.43983686f, 0.410286635f},
-std::array<float,2>{0.112462342f, 0.631373227f},
-std::array<float,2>{0.873779178f, 0.248347998f},
-std::array<float,2>{0.685991406f, 0.549373209f},
-std::array<float,2>{0.37830615f, 0.121975891f},
-std::array<float,2>{0.0566271991f, 0.96348691f},
-std::array<float,2>{0.764575422f, 0.349768132f},
-std::array<float,2>{0.92771709f, 0.789101124f},
-std::array<float,2>{0.224114284f, 0.451597989f},
-std::array<float,2>{0.289550632f, 0.698372662f},
-std::array<float,2>{0.614141464f, 0.150181219f},
-std::array<float,2>{0.826106012f, 0.687050879f},
-std::array<float,2>{0.0781088024f, 0.204429477f},
-std::array<float,2>{0.468927026f, 0.867593825f},
-std::array<float,2>{0.732629836f, 0.38657397f},
-std::array<float,2>{0.514321089f, 0.884583592f},
-std::array<float,2>{0.361777633f, 0.268966734f},
-std::array<float,2>{0.14483048f, 0.60672909f},
-std::array<float,2>{0.952759683f, 0.061897397f},
-std::array<float,2>{0.743184745f, 0.65291822f},
-std::array<float,2>{0.498428941f, 0.218925044f},
-std::array<float,2>{0.0818990171f, 0.825093508f},
-std::array<float,2>{0.843447864f, 0.431197584f},
-std::array<float,2>{0.959100127f, 0.912327945f},
-std::array<float,2>{0.134576574f, 0.310315996f},
-std::array<float,2>{0.344286114f, 0.585284472f},
-std::array<float,2>{0.521705985f, 0.0068563628f},
-std::array<float,2>{0.767645597f, 0.530702651f},
-std::array<float,2>{0.0383968502f, 0.079877682f},
-std::array<float,2>{0.403978556f, 0.971003413f},
-std::array<float,2>{0.657495439f, 0.32907936f},
-std::array<float,2>{0.605598867f, 0.768292129f},
-std::array<float,2>{0.310082197f, 0.493515551f},
-std::array<float,2>{0.239036277f, 0.738233328f},
-std::array<float,2>{0.918759108f, 0.170130163f},
-std::array<float,2>{0.539355755f, 0.615328908f},
-std::array<float,2>{0.33303377f, 0.0318978392f},
-std::array<float,2>{0.173286691f, 0.901213646f},
-std::array<float,2>{0.978439271f, 0.260663688f},
-std::array<float,2>{0.850250542f, 0.844549954f},
-std::array<float,2>{0.106878377f, 0.395575494f},
-std::array<float,2>{0.455122143f, 0.671175778f},
-std::array<float,2>{0.69699502f, 0.196291909f},
-std::array<float,2>{0.880815268f, 0.704347193f},
-std::array<float,2>{0.191795513f, 0.126945779f},
-std::array<float,2>{0.262406856f, 0.807595253f},
-std::array<float,2>{0.572038293f, 0.463648885f},
-std::array<float,2>{0.65391171f, 0.946237683f},
-std::array<float,2>{0.407478988f, 0.360953271f},
-std::array<float,2>{0.0243280977f, 0.541541219f},
-std::array<float,2>{0.788376331f, 0.106047533f},
-std::array<float,2>{0.528590381f, 0.659907818f},
-std::array<float,2>{0.358563811f, 0.194154561f},
-std::array<float,2>{0.125014231f, 0.855461597f},
-std::array<float,2>{0.961685896f, 0.398963839f},
-std::array<float,2>{0.830673099f, 0.891488016f},
-std::array<float,2>{0.0932623819f, 0.256537139f},
-std::array<float,2>{0.486303955f, 0.617779136f},
-std::array<float,2>{0.740139842f, 0.0408135578f},
-std::array<float,2>{0.909133673f, 0.537184536f},
-std::array<float,2>{0.245464057f, 0.0997894555f},
-std::array<float,2>{0.298901469f, 0.939012587f},
-std::array<float,2>{0.594082773f, 0.371294826f},
-std::array<float,2>{0.66797626f, 0.801627576f},
-std::array<float,2>{0.395849496f, 0.458656847f},
-std::array<float,2>{0.0468111038f, 0.71171695f},
-std::array<float,2>{0.781223834f, 0.133310318f},
-std::array<float,2>{0.688948989f, 0.592513859f},
-std::array<float,2>{0.464078277f, 0.0141310431f},
-std::array<float,2>{0.0999232382f, 0.915813029f},
-std::array<float,2>{0.855348468f, 0.303657889f},
-std::array<float,2>{0.974955261f, 0.817856669f},
-std::array<float,2>{0.182175741f, 0.424747556f},
-std::array<float,2>{0.34290418f, 0.641046584f},
-std::array<float,2>{0.532401562f, 0.227945894f},
-std::array<float,2>{0.789170206f, 0.743078947f},
-std::array<float,2>{0.0204745028f, 0.160690278f},
-std::array<float,2>{0.416176766f, 0.781081796f},
-std::array<float,2>{0.646817446f, 0.491859406f},
-std::array<float,2>{0.563987553f, 0.982881248f},
-std::array<float,2>{0.256977856f, 0.338494688f},
-std::array<float,2>{0.202215031f, 0.523167074f},
-std::array<float,2>{0.884503603f, 0.0904949158f},
-std::array<float,2>{0.640102565f, 0.688208818f},
-std::array<float,2>{0.436589122f, 0.143523887f},
-std::array<float,2>{0.00819785614f, 0.785362959f},
-std::array<float,2>{0.810731649f, 0.440227836f},
-std::array<float,2>{0.895307243f, 0.959243119f},
-std::array<float,2>{0.217139676f, 0.355842859f},
-std::array<float,2>{0.273913175f, 0.559941292f},
-std::array<float,2>{0.585441351f, 0.116604149f},
-std::array<float,2>{0.866368175f, 0.598137259f},
-std::array<float,2>{0.118874736f, 0.0515756458f},
-std::array<float,2>{0.446855336f, 0.881321549f},
-std::array<float,2>{0.708800256f, 0.279384911f},
-std::array<float,2>{0.554446578f, 0.864103258f},
-std::array<float,2>{0.313237488f, 0.381826162f},
-std::array<float,2>{0.166263714f, 0.6742118f},
-std::array<float,2>{0.999481678f, 0.217544749f},
-std::array<float,2>{0.620743811f, 0.504735947f},
-std::array<float,2>{0.284646958f, 0.0769642293f},
-std::array<float,2>{0.231927961f, 0.984644055f},
-std::array<float,2>{0.935698867f, 0.327827483f},
-std::array<float,2>{0.757431746f, 0.753257811f},
-std::array<float,2>{0.0508425049f, 0.472358823f},
-std::array<float,2>{0.386518925f, 0.721202672f},
-std::array<float,2>{0.673005581f, 0.176689267f},
-std::array<float,2>{0.938273609f, 0.638395369f},
-std::array<float,2>{0.149609491f, 0.239115521f},
-std::array<float,2>{0.372620434f, 0.841564178f},
-std::array<float,2>{0.502124369f, 0.421639502f},
-std::array<float,2>{0.724402606f, 0.921944618f},
-std::array<float,2>{0.481947809f, 0.293605566f},
-std::array<float,2>{0.0686970949f, 0.567660153f},
-std::array<float,2>{0.812643647f, 0.026729174f},
-std::array<float,2>{0.604524612f, 0.676825166f},
-std::array<float,2>{0.305495858f, 0.214595318f},
-std::array<float,2>{0.236501291f, 0.863054335f},
-std::array<float,2>{0.917900741f, 0.376910836f},
-std::array<float,2>{0.771873891f, 0.878008187f},
-std::array<float,2>{0.0314698778f, 0.27514264f},
-std::array<float,2>{0.398966044f, 0.595999181f},
-std::array<float,2>{0.661745489f, 0.0493715294f},
-std::array<float,2>{0.956754744f, 0.557603538f},
-std::array<float,2>{0.139343783f, 0.109444462f},
-std::array<float,2>{0.349551708f, 0.953969002f},
-std::array<float,2>{0.516204834f, 0.353800803f},
-std::array<float,2>{0.746769488f, 0.783493519f},
-std::array<float,2>{0.493755817f, 0.443041444f},
-std::array<float,2>{0.0851892307f, 0.694878101f},
-std::array<float,2>{0.837677836f, 0.147563577f},
-std::array<float,2>{0.651081264f, 0.563836157f},
-std::array<float,2>{0.411194205f, 0.0299331602f},
-std::array<float,2>{0.0283897538f, 0.927363932f},
-std::array<float,2>{0.783691466f, 0.289950222f},
-std::array<float,2>{0.875990689f, 0.839291573f},
-std::array<float,2>{0.188809156f, 0.414381355f},
-std::array<float,2>{0.261089832f, 0.635145009f},
-std::array<float,2>{0.577421188f, 0.237865269f},
-std::array<float,2>{0.845137954f, 0.725276053f},
-std::array<float,2>{0.102809548f, 0.17484495f},
-std::array<float,2>{0.458679795f, 0.754953206f},
-std::array<float,2>{0.703105807f, 0.475416452f},
-std::array<float,2>{0.544790387f, 0.989603937f},
-std::array<float,2>{0.32901603f, 0.322476238f},
-std::array<float,2>{0.176033035f, 0.500207841f},
-std::array<float,2>{0.981191993f, 0.0704905987f},
-std::array<float,2>{0.711705387f, 0.715745628f},
-std::array<float,2>{0.44456014f, 0.137111649f},
-std::array<float,2>{0.114532255f, 0.800601363f},
-std::array<float,2>{0.867237866f, 0.456711143f},
-std::array<float,2>{0.988885343f, 0.941619873f},
-std::array<float,2>{0.163406357f, 0.370339543f},
-std::array<float,2>{0.321031958f, 0.534857154f},
-std::array<float,2>{0.559492946f, 0.0953294337f},
-std::array<float,2>{0.804182351f, 0.624890149f},
-std::array<float,2>{0.00137694832f, 0.0436482057f},
-std::array<float,2>{0.428411633f, 0.894666016f},
-std::array<float,2>{0.630183339f, 0.251119375f},
-std::array<float,2>{0.587473214f, 0.856801271f},
-std::array<float,2>{0.267466456f, 0.404359967f},
-std::array<float,2>{0.20932667f, 0.663008392f},
-std::array<float,2>{0.898980558f, 0.188888505f},
-std::array<float,2>{0.5111081f, 0.518614352f},
-std::array<float,2>{0.365399092f, 0.0864146501f},
-std::array<float,2>{0.141531482f, 0.980003834f},
-std::array<float,2>{0.947878599f, 0.341640055f},
-std::array<float,2>{0.82264024f, 0.774599969f},
-std::array<float,2>{0.0718912408f, 0.485377759f},
-std::array<float,2>{0.475920469f, 0.747808933f},
-std::array<float,2>{0.728706241f, 0.157513067f},
-std::array<float,2>{0.923425376f, 0.647252142f},
-std::array<float,2>{0.222130433f, 0.232532412f},
-std::array<float,2>{0.295072705f, 0.814348876f},
-std::array<float,2>{0.613122106f, 0.426427454f},
-std::array<float,2>{0.680416405f, 0.918786228f},
-std::array<float,2>{0.381492466f, 0.298919529f},
-std::array<float,2>{0.0598841794f, 0.588572919f},
-std::array<float,2>{0.761087656f, 0.00904027f},
-std::array<float,2>{0.548704624f, 0.739804327f},
-std::array<float,2>{0.316503733f, 0.166837692f},
-std::array<float,2>{0.169461995f, 0.772782505f},
-std::array<float,2>{0.993792713f, 0.499002069f},
-std::array<float,2>{0.863021791f, 0.975614011f},
-std::array<float,2>{0.122002482f, 0.333933741f},
-std::array<float,2>{0.449509054f, 0.524019301f},
-std::array<float,2>{0.703983068f, 0.0830570906f},
-std::array<float,2>{0.89146477f, 0.580109954f},
-std::array<float,2>{0.214269713f, 0.000233944185f},
-std::array<float,2>{0.279455364f, 0.908912897f},
-std::array<float,2>{0.580003083f, 0.308089018f},
-std::array<float,2>{0.634661257f, 0.821371853f},
-std::array<float,2>{0.433361262f, 0.437140852f},
-std::array<float,2>{0.0148755489f, 0.650494039f},
-std::array<float,2>{0.806924582f, 0.226445779f},
-std::array<float,2>{0.721344888f, 0.546191037f},
-std::array<float,2>{0.477766097f, 0.104475975f},
-std::array<float,2>{0.0633410588f, 0.950625837f},
-std::array<float,2>{0.819463491f, 0.36611259f},
-std::array<float,2>{0.945170701f, 0.809044838f},
-std::array<float,2>{0.152444318f, 0.467749953f},
-std::array<float,2>{0.368765056f, 0.708214164f},
-std::array<float,2>{0.504760385f, 0.130504966f},
-std::array<float,2>{0.753405273f, 0.667431891f},
-std::array<float,2>{0.0468942448f, 0.200586662f},
-std::array<float,2>{0.390197277f, 0.850738823f},
-std::array<float,2>{0.678253829f, 0.393787891f},
-std::array<float,2>{0.621574461f, 0.904388666f},
-std::array<float,2>{0.285639435f, 0.262112558f},
-std::array<float,2>{0.228587523f, 0.610659897f},
-std::array<float,2>{0.931689322f, 0.0363822207f},
-std::array<float,2>{0.664234459f, 0.627907157f},
-std::array<float,2>{0.391892254f, 0.242934823f},
-std::array<float,2>{0.0421971828f, 0.828771949f},
-std::array<float,2>{0.776493192f, 0.406564295f},
-std::array<float,2>{0.911732554f, 0.932267725f},
-std::array<float,2>{0.247133508f, 0.283057421f},
-std::array<float,2>{0.302477419f, 0.577720702f},
-std::array<float,2>{0.599793553f, 0.0163350329f},
-std::array<float,2>{0.835246503f, 0.51161629f},
-std::array<float,2>{0.0875936374f, 0.0648822412f},
-std::array<float,2>{0.488972247f, 0.995075941f},
-std::array<float,2>{0.736000061f, 0.315452546f},
-std::array<float,2>{0.525032282f, 0.761993766f},
-std::array<float,2>{0.352176517f, 0.484153539f},
-std::array<float,2>{0.129829034f, 0.733940303f},
-std::array<float,2>{0.967065334f, 0.187197179f},
-std::array<float,2>{0.569066465f, 0.605014205f},
-std::array<float,2>{0.250887781f, 0.0569429919f},
-std::array<float,2>{0.196144819f, 0.88981241f},
-std::array<float,2>{0.887475908f, 0.271602571f},
-std::array<float,2>{0.79439801f, 0.874586046f},
-std::array<float,2>{0.0175986383f, 0.389586955f},
-std::array<float,2>{0.419380963f, 0.68047297f},
-std::array<float,2>{0.643958867f, 0.209979594f},
-std::array<float,2>{0.970716715f, 0.700768828f},
-std::array<float,2>{0.186732888f, 0.153391123f},
-std::array<float,2>{0.336167336f, 0.795305133f},
-std::array<float,2>{0.536352456f, 0.448635489f},
-std::array<float,2>{0.692696154f, 0.965057731f},
-std::array<float,2>{0.467625529f, 0.344775945f},
-std::array<float,2>{0.0960724279f, 0.551825762f},
-std::array<float,2>{0.858180463f, 0.118005365f},
-std::array<float,2>{0.585591078f, 0.68950814f},
-std::array<float,2>{0.274252445f, 0.141187266f},
-std::array<float,2>{0.217587963f, 0.788646162f},
-std::array<float,2>{0.894810975f, 0.438095391f},
-std::array<float,2>{0.811163723f, 0.957105935f},
-std::array<float,2>{0.00853249338f, 0.357750475f},
-std::array<float,2>{0.437272459f, 0.562417269f},
-std::array<float,2>{0.640293777f, 0.115217112f},
-std::array<float,2>{0.999808192f, 0.599775553f},
-std::array<float,2>{0.166619733f, 0.0535571277f},
-std::array<float,2>{0.312870681f, 0.879897654f},
-std::array<float,2>{0.554184675f, 0.277480274f},
-std::array<float,2>{0.708383024f, 0.866187096f},
-std::array<float,2>{0.446485251f, 0.379055887f},
-std::array<float,2>{0.118488267f, 0.672163248f},
-std::array<float,2>{0.86705935f, 0.215357646f},
-std::array<float,2>{0.673498273f, 0.507487059f},
-std::array<float,2>{0.386210531f, 0.0751520321f},
-std::array<float,2>{0.0515657663f, 0.987313032f},
-std::array<float,2>{0.756851554f, 0.325874656f},
-std::array<float,2>{0.93642211f, 0.751469553f},
-std::array<float,2>{0.232303411f, 0.468953162f},
-std::array<float,2>{0.285099059f, 0.719777942f},
-std::array<float,2>{0.620245755f, 0.179637983f},
-std::array<float,2>{0.813293099f, 0.639585912f},
-std::array<float,2>{0.069057107f, 0.241565987f},
-std::array<float,2>{0.481810778f, 0.843038559f},
-std::array<float,2>{0.723751128f, 0.419068485f},
-std::array<float,2>{0.502726793f, 0.924239755f},
-std::array<float,2>{0.372093886f, 0.296489775f},
-std::array<float,2>{0.150329441f, 0.570242107f},
-std::array<float,2>{0.937859595f, 0.0247068759f},
-std::array<float,2>{0.739614487f, 0.658079445f},
-std::array<float,2>{0.485729873f, 0.193182141f},
-std::array<float,2>{0.092785947f, 0.85297358f},
-std::array<float,2>{0.830523908f, 0.400946081f},
-std::array<float,2>{0.961005151f, 0.894180834f},
-std::array<float,2>{0.125788003f, 0.255683362f},
-std::array<float,2>{0.359354198f, 0.620390356f},
-std::array<float,2>{0.52907896f, 0.0426720493f},
-std::array<float,2>{0.780566812f, 0.536884308f},
-std::array<float,2>{0.0459095649f, 0.0982511416f},
-std::array<float,2>{0.396064728f, 0.939569652f},
-std::array<float,2>{0.668498278f, 0.373402834f},
-std::array<float,2>{0.594532311f, 0.802955091f},
-std::array<float,2>{0.299631625f, 0.460136086f},
-std::array<float,2>{0.246001765f, 0.713569641f},
-std::array<float,2>{0.90824002f, 0.136501536f},
-std::array<float,2>{0.532862544f, 0.589885116f},
-std::array<float,2>{0.343523502f, 0.0134125091f},
-std::array<float,2>{0.182081535f, 0.917205215f},
-std::array<float,2>{0.975429595f, 0.301278114f},
-std::array<float,2>{0.854537427f, 0.819784701f},
-std::array<float,2>{0.100193217f, 0.422471821f},
-std::array<float,2>{0.464838266f, 0.643023312f},
-std::array<float,2>{0.689036548f, 0.229248092f},
-std::array<float,2>{0.884177923f, 0.745089173f},
-std::array<float,2>{0.202861443f, 0.163210973f},
-std::array<float,2>{0.257340699f, 0.778438449f},
-std::array<float,2>{0.563714802f, 0.489564866f},
-std::array<float,2>{0.647411823f, 0.981079161f},
-std::array<float,2>{0.416872054f, 0.337331027f},
-std::array<float,2>{0.019763127f, 0.52057606f},
-std::array<float,2>{0.789589345f, 0.092199631f},
-std::array<float,2>{0.522270501f, 0.654593587f},
-std::array<float,2>{0.343886614f, 0.220703527f},
-std::array<float,2>{0.134267822f, 0.827020526f},
-std::array<float,2>{0.959511757f, 0.432116896f},
-std::array<float,2>{0.843016386f, 0.911372662f},
-std::array<float,2>{0.0812272355f, 0.31151101f},
-std::array<float,2>{0.498762488f, 0.583782136f},
-std::array<float,2>{0.743689895f, 0.00400769431f},
-std::array<float,2>{0.918253839f, 0.528164864f},
-std::array<float,2>{0.23834908f, 0.0803774074f},
-std::array<float,2>{0.309571505f, 0.969696641f},
-std::array<float,2>{0.606185496f, 0.330335587f},
-std::array<float,2>{0.657908618f, 0.767510355f},
-std::array<float,2>{0.403347403f, 0.495101541f},
-std::array<float,2>{0.0386093371f, 0.734420598f},
-std::array<float,2>{0.768197536f, 0.168158293f},
-std::array<float,2>{0.696447968f, 0.613506079f},
-std::array<float,2>{0.455924958f, 0.0335313529f},
-std::array<float,2>{0.107161932f, 0.899275362f},
-std::array<float,2>{0.849935353f, 0.259752095f},
-std::array<float,2>{0.977572322f, 0.846059024f},
-std::array<float,2>{0.173709303f, 0.396926641f},
-std::array<float,2>{0.333934486f, 0.668847203f},
-std::array<float,2>{0.539923668f, 0.198687211f},
-std::array<float,2>{0.788596988f, 0.706006348f},
-std::array<float,2>{0.0236923192f, 0.128190488f},
-std::array<float,2>{0.408121407f, 0.804994285f},
-std::array<float,2>{0.653487623f, 0.462753475f},
-std::array<float,2>{0.571418583f, 0.947666407f},
-std::array<float,2>{0.261728317f, 0.361726314f},
-std::array<float,2>{0.192298248f, 0.540389478f},
-std::array<float,2>{0.880242825f, 0.10913042f},
-std::array<float,2>{0.627996862f, 0.728230596f},
-std::array<float,2>{0.424135417f, 0.181433484f},
-std::array<float,2>{0.00743550714f, 0.759432316f},
-std::array<float,2>{0.800015748f, 0.478715986f},
-std::array<float,2>{0.902582347f, 0.997789741f},
-std::array<float,2>{0.206780538f, 0.318527848f},
-std::array<float,2>{0.272762328f, 0.513316035f},
-std::array<float,2>{0.592531323f, 0.0683454722f},
-std::array<float,2>{0.873230875f, 0.573040307f},
-std::array<float,2>{0.112937897f, 0.0232020766f},
-std::array<float,2>{0.440298706f, 0.936071873f},
-std::array<float,2>{0.714942217f, 0.287287563f},
-std::array<float,2>{0.558443606f, 0.83396101f},
-std::array<float,2>{0.32522887f, 0.413232565f},
-std::array<float,2>{0.158546999f, 0.630858064f},
-std::array<float,2>{0.987797201f, 0.247886926f},
-std::array<float,2>{0.613601029f, 0.547049522f},
-std::array<float,2>{0.289929539f, 0.123573728f},
-std::array<float,2>{0.224162489f, 0.962497711f},
-std::array<float,2>{0.92719394f, 0.349455416f},
-std::array<float,2>{0.764036417f, 0.791603088f},
-std::array<float,2>{0.0559392162f, 0.449726194f},
-std::array<float,2>{0.378506094f, 0.696558714f},
-std::array<float,2>{0.686156929f, 0.150807455f},
-std::array<float,2>{0.952383518f, 0.685379446f},
-std::array<float,2>{0.145497888f, 0.205938652f},
-std::array<float,2>{0.362182617f, 0.869198263f},
-std::array<float,2>{0.513996065f, 0.383863807f},
-std::array<float,2>{0.733192563f, 0.884980798f},
-std::array<float,2>{0.46955511f, 0.26705572f},
-std::array<float,2>{0.0773824602f, 0.609148145f},
-std::array<float,2>{0.825648308f, 0.059919633f},
-std::array<float,2>{0.575564921f, 0.634434044f},
-std::array<float,2>{0.259247154f, 0.234961569f},
-std::array<float,2>{0.191096783f, 0.836042702f},
-std::array<float,2>{0.877725124f, 0.416308552f},
-std::array<float,2>{0.782847166f, 0.928952098f},
-std::array<float,2>{0.0308824759f, 0.291617543f},
-std::array<float,2>{0.412863702f, 0.565342128f},
-std::array<float,2>{0.649935246f, 0.0281965081f},
-std::array<float,2>{0.983529091f, 0.503619432f},
-std::array<float,2>{0.178134203f, 0.0724021569f},
-std::array<float,2>{0.330276608f, 0.990654588f},
-std::array<float,2>{0.54643774f, 0.320446581f},
-std::array<float,2>{0.700999975f, 0.756742239f},
-std::array<float,2>{0.459646165f, 0.472893924f},
-std::array<float,2>{0.105118692f, 0.72352767f},
-std::array<float,2>{0.847566307f, 0.173548639f},
-std::array<float,2>{0.663787246f, 0.594456494f},
-std::array<float,2>{0.402171999f, 0.0469869003f},
-std::array<float,2>{0.0340297595f, 0.876815617f},
-std::array<float,2>{0.771243036f, 0.276953757f},
-std::array<float,2>{0.914584875f, 0.861054778f},
-std::array<float,2>{0.235438719f, 0.377889752f},
-std::array<float,2>{0.307308376f, 0.679054856f},
-std::array<float,2>{0.602721453f, 0.212671965f},
-std::array<float,2>{0.839563966f, 0.69302249f},
-std::array<float,2>{0.0838156044f, 0.144678131f},
-std::array<float,2>{0.494475007f, 0.781314313f},
-std::array<float,2>{0.749272048f, 0.444275856f},
-std::array<float,2>{0.518028021f, 0.955322146f},
-std::array<float,2>{0.349993914f, 0.35349074f},
-std::array<float,2>{0.138070047f, 0.555206358f},
-std::array<float,2>{0.95436734f, 0.113197595f},
-std::array<float,2>{0.727698863f, 0.7484954f},
-std::array<float,2>{0.47344628f, 0.159940347f},
-std::array<float,2>{0.073610276f, 0.775729656f},
-std::array<float,2>{0.821215749f, 0.488177985f},
-std::array<float,2>{0.946005225f, 0.97774303f},
-std::array<float,2>{0.142958432f, 0.342285007f},
-std::array<float,2>{0.363913387f, 0.515802085f},
-std::array<float,2>{0.509359777f, 0.089789629f},
-std::array<float,2>{0.759459853f, 0.586821079f},
-std::array<float,2>{0.0616160259f, 0.0107632075f},
-std::array<float,2>{0.379519433f, 0.921682835f},
-std::array<float,2>{0.683081746f, 0.298170149f},
-std::array<float,2>{0.610586584f, 0.815489829f},
-std::array<float,2>{0.293755323f, 0.427987337f},
-std::array<float,2>{0.220595971f, 0.645828843f},
-std::array<float,2>{0.925065637f, 0.230692789f},
-std::array<float,2>{0.56135118f, 0.531459808f},
-std::array<float,2>{0.323177278f, 0.0960402936f},
-std::array<float,2>{0.161235541f, 0.943495274f},
-std::array<float,2>{0.990499318f, 0.367837548f},
-std::array<float,2>{0.869505823f, 0.798149407f},
-std::array<float,2>{0.115797512f, 0.455053538f},
-std::array<float,2>{0.443251669f, 0.717889905f},
-std::array<float,2>{0.713202715f, 0.139077127f},
-std::array<float,2>{0.900616527f, 0.661103427f},
-std::array<float,2>{0.208281592f, 0.190254584f},
-std::array<float,2>{0.26915437f, 0.858452082f},
-std::array<float,2>{0.587914288f, 0.403553516f},
-std::array<float,2>{0.632068455f, 0.897076964f},
-std::array<float,2>{0.425875545f, 0.253492415f},
-std::array<float,2>{0.003221147f, 0.622899234f},
-std::array<float,2>{0.802183151f, 0.0459354632f},
-std::array<float,2>{0.506479919f, 0.710162044f},
-std::array<float,2>{0.370920688f, 0.131297946f},
-std::array<float,2>{0.154698551f, 0.810813189f},
-std::array<float,2>{0.941448569f, 0.465460122f},
-std::array<float,2>{0.818310678f, 0.951350629f},
-std::array<float,2>{0.064831093f, 0.364802092f},
-std::array<float,2>{0.479189426f, 0.544396937f},
-std::array<float,2>{0.718992889f, 0.101652682f},
-std::array<float,2>{0.931313872f, 0.613094091f},
-std::array<float,2>{0.226810738f, 0.0376756229f},
-std::array<float,2>{0.288999915f, 0.903170824f},
-std::array<float,2>{0.623094976f, 0.263743252f},
-std::array<float,2>{0.676861346f, 0.848148048f},
-std::array<float,2>{0.387595981f, 0.392507285f},
-std::array<float,2>{0.04990061f, 0.664878428f},
-std::array<float,2>{0.750733256f, 0.203084052f},
-std::array<float,2>{0.706248522f, 0.527054131f},
-std::array<float,2>{0.451296002f, 0.0856446102f},
-std::array<float,2>{0.123911686f, 0.973294556f},
-std::array<float,2>{0.859773815f, 0.335907191f},
-std::array<float,2>{0.995423257f, 0.771032989f},
-std::array<float,2>{0.170564726f, 0.497852325f},
-std::array<float,2>{0.320198804f, 0.741609812f},
-std::array<float,2>{0.549783945f, 0.165070713f},
-std::array<float,2>{0.805605233f, 0.650351822f},
-std::array<float,2>{0.0135825602f, 0.222873598f},
-std::array<float,2>{0.431141853f, 0.82395494f},
-std::array<float,2>{0.63583082f, 0.433629453f},
-std::array<float,2>{0.581972301f, 0.907899916f},
-std::array<float,2>{0.277739555f, 0.305928171f},
-std::array<float,2>{0.212189212f, 0.579898596f},
-std::array<float,2>{0.894304991f, 0.00222574989f},
-std::array<float,2>{0.641058445f, 0.682347357f},
-std::array<float,2>{0.421769202f, 0.20819886f},
-std::array<float,2>{0.015981894f, 0.872554839f},
-std::array<float,2>{0.794945836f, 0.388325691f},
-std::array<float,2>{0.889903605f, 0.887998462f},
-std::array<float,2>{0.197969511f, 0.269720048f},
-std::array<float,2>{0.253172874f, 0.602564335f},
-std::array<float,2>{0.56752044f, 0.0563522652f},
-std::array<float,2>{0.857382357f, 0.554409444f},
-std::array<float,2>{0.0953441337f, 0.120504148f},
-std::array<float,2>{0.465759099f, 0.967120826f},
-std::array<float,2>{0.693981886f, 0.346148074f},
-std::array<float,2>{0.538576603f, 0.794668257f},
-std::array<float,2>{0.339143455f, 0.446672887f},
-std::array<float,2>{0.184701353f, 0.701200545f},
-std::array<float,2>{0.97000277f, 0.155330911f},
-std::array<float,2>{0.598581433f, 0.575695097f},
-std::array<float,2>{0.302933842f, 0.0186409708f},
-std::array<float,2>{0.249771982f, 0.931228876f},
-std::array<float,2>{0.912599325f, 0.284980625f},
-std::array<float,2>{0.773625731f, 0.831114531f},
-std::array<float,2>{0.040426366f, 0.408391953f},
-std::array<float,2>{0.3930116f, 0.626105428f},
-std::array<float,2>{0.666904211f, 0.244170725f},
-std::array<float,2>{0.966067314f, 0.730775654f},
-std::array<float,2>{0.131600156f, 0.184617639f},
-std::array<float,2>{0.355342448f, 0.765613198f},
-std::array<float,2>{0.526001632f, 0.480495542f},
-std::array<float,2>{0.736614347f, 0.993606567f},
-std::array<float,2>{0.491009414f, 0.314354688f},
-std::array<float,2>{0.0889115781f, 0.508385062f},
-std::array<float,2>{0.832649291f, 0.0636088625f},
-std::array<float,2>{0.617853284f, 0.720977843f},
-std::array<float,2>{0.282656252f, 0.176258698f},
-std::array<float,2>{0.23337622f, 0.753618002f},
-std::array<float,2>{0.935397148f, 0.472070962f},
-std::array<float,2>{0.755294204f, 0.985177457f},
-std::array<float,2>{0.0537026264f, 0.327339798f},
-std::array<float,2>{0.384215891f, 0.504249692f},
-std::array<float,2>{0.674305022f, 0.0763323456f},
-std::array<float,2>{0.940193176f, 0.568209052f},
-std::array<float,2>{0.15136981f, 0.0269525964f},
-std::array<float,2>{0.373643219f, 0.922670603f},
-std::array<float,2>{0.500195801f, 0.293357551f},
-std::array<float,2>{0.726189554f, 0.840825558f},
-std::array<float,2>{0.482763916f, 0.421270311f},
-std::array<float,2>{0.066911824f, 0.637699246f},
-std::array<float,2>{0.816247225f, 0.238691375f},
-std::array<float,2>{0.637643099f, 0.560138583f},
-std::array<float,2>{0.434449852f, 0.117152415f},
-std::array<float,2>{0.0114040244f, 0.959788442f},
-std::array<float,2>{0.810234368f, 0.356220692f},
-std::array<float,2>{0.898173034f, 0.786020041f},
-std::array<float,2>{0.215098277f, 0.439599723f},
-std::array<float,2>{0.276125371f, 0.687525094f},
-std::array<float,2>{0.583794177f, 0.142706499f},
-std::array<float,2>{0.864174664f, 0.674343824f},
-std::array<float,2>{0.120196424f, 0.217096716f},
-std::array<float,2>{0.448701292f, 0.863519549f},
-std::array<float,2>{0.710163295f, 0.381118357f},
-std::array<float,2>{0.551988065f, 0.881357431f},
-std::array<float,2>{0.315871477f, 0.280232817f},
-std::array<float,2>{0.164875716f, 0.598302424f},
-std::array<float,2>{0.997403085f, 0.0511701591f},
-std::array<float,2>{0.69139874f, 0.641517222f},
-std::array<float,2>{0.462261707f, 0.228157505f},
-std::array<float,2>{0.0995138064f, 0.818062007f},
-std::array<float,2>{0.852447093f, 0.424121827f},
-std::array<float,2>{0.972969174f, 0.915516376f},
-std::array<float,2>{0.180422664f, 0.302953392f},
-std::array<float,2>{0.341463566f, 0.592112422f},
-std::array<float,2>{0.533559084f, 0.0143334987f},
-std::array<float,2>{0.792827666f, 0.522614539f},
-std::array<float,2>{0.0230277367f, 0.0898930058f},
-std::array<float,2>{0.414081782f, 0.983265638f},
-std::array<float,2>{0.645806968f, 0.338246375f},
-std::array<float,2>{0.564473271f, 0.780607998f},
-std::array<float,2>{0.254496664f, 0.491557419f},
-std::array<float,2>{0.200013921f, 0.742458463f},
-std::array<float,2>{0.885459006f, 0.160402223f},
-std::array<float,2>{0.530179203f, 0.617643178f},
-std::array<float,2>{0.356238097f, 0.040214926f},
-std::array<float,2>{0.128357753f, 0.890644073f},
-std::array<float,2>{0.964486599f, 0.256295502f},
-std::array<float,2>{0.828684688f, 0.854772091f},
-std::array<float,2>{0.0904428363f, 0.398707449f},
-std::array<float,2>{0.48816067f, 0.659361541f},
-std::array<float,2>{0.740944982f, 0.193609282f},
-std::array<float,2>{0.90688175f, 0.71136868f},
-std::array<float,2>{0.242636487f, 0.132954612f},
-std::array<float,2>{0.29829216f, 0.801186919f},
-std::array<float,2>{0.595722556f, 0.458254457f},
-std::array<float,2>{0.670413315f, 0.938749373f},
-std::array<float,2>{0.397589415f, 0.372065216f},
-std::array<float,2>{0.0429841094f, 0.537954748f},
-std::array<float,2>{0.778768241f, 0.100424409f},
-std::array<float,2>{0.542131007f, 0.671525359f},
-std::array<float,2>{0.334409744f, 0.197005555f},
-std::array<float,2>{0.175532043f, 0.843769312f},
-std::array<float,2>{0.978925169f, 0.395996332f},
-std::array<float,2>{0.849073827f, 0.900728285f},
-std::array<float,2>{0.107719846f, 0.259950638f},
-std::array<float,2>{0.4544788f, 0.615799785f},
-std::array<float,2>{0.697575569f, 0.0315070115f},
-std::array<float,2>{0.881958544f, 0.541483521f},
-std::array<float,2>{0.194873661f, 0.105765402f},
-std::array<float,2>{0.264985561f, 0.945476055f},
-std::array<float,2>{0.573087692f, 0.36067459f},
-std::array<float,2>{0.656180859f, 0.806823134f},
-std::array<float,2>{0.409168541f, 0.463021994f},
-std::array<float,2>{0.0263650008f, 0.704674423f},
-std::array<float,2>{0.786141753f, 0.126132384f},
-std::array<float,2>{0.745001197f, 0.585804045f},
-std::array<float,2>{0.497474492f, 0.00765335374f},
-std::array<float,2>{0.0788105279f, 0.912710428f},
-std::array<float,2>{0.840930998f, 0.310019672f},
-std::array<float,2>{0.957277477f, 0.824229836f},
-std::array<float,2>{0.134873256f, 0.430968046f},
-std::array<float,2>{0.347560346f, 0.652585685f},
-std::array<float,2>{0.519536853f, 0.219241068f},
-std::array<float,2>{0.767490268f, 0.737521529f},
-std::array<float,2>{0.0359071009f, 0.170891285f},
-std::array<float,2>{0.405617774f, 0.768054605f},
-std::array<float,2>{0.658841848f, 0.493806988f},
-std::array<float,2>{0.609123468f, 0.971322834f},
-std::array<float,2>{0.311098963f, 0.328149021f},
-std::array<float,2>{0.241596118f, 0.530944049f},
-std::array<float,2>{0.920369208f, 0.0791907907f},
-std::array<float,2>{0.683957517f, 0.698821485f},
-std::array<float,2>{0.376740754f, 0.149585173f},
-std::array<float,2>{0.0583596453f, 0.789655447f},
-std::array<float,2>{0.762445867f, 0.452043295f},
-std::array<float,2>{0.928374469f, 0.963011265f},
-std::array<float,2>{0.226408944f, 0.350293577f},
-std::array<float,2>{0.291445702f, 0.548967779f},
-std::array<float,2>{0.616816342f, 0.121433318f},
-std::array<float,2>{0.827422738f, 0.60697037f},
-std::array<float,2>{0.0760449097f, 0.062156193f},
-std::array<float,2>{0.47255221f, 0.884060085f},
-std::array<float,2>{0.731978476f, 0.269130647f},
-std::array<float,2>{0.511822104f, 0.867935598f},
-std::array<float,2>{0.359886438f, 0.386181921f},
-std::array<float,2>{0.14658618f, 0.686671019f},
-std::array<float,2>{0.949878216f, 0.204870731f},
-std::array<float,2>{0.589886308f, 0.514077306f},
-std::array<float,2>{0.270428985f, 0.0686616823f},
-std::array<float,2>{0.204780191f, 0.999991179f},
-std::array<float,2>{0.904787719f, 0.316809058f},
-std::array<float,2>{0.798366666f, 0.760129809f},
-std::array<float,2>{0.00545360474f, 0.476940781f},
-std::array<float,2>{0.422607601f, 0.729269743f},
-std::array<float,2>{0.625116289f, 0.183278576f},
-std::array<float,2>{0.986254573f, 0.631308138f},
-std::array<float,2>{0.157590792f, 0.248816848f},
-std::array<float,2>{0.326789707f, 0.83564204f},
-std::array<float,2>{0.555845261f, 0.410833687f},
-std::array<float,2>{0.717125833f, 0.934773803f},
-std::array<float,2>{0.439272672f, 0.287038565f},
-std::array<float,2>{0.109668411f, 0.570804477f},
-std::array<float,2>{0.872173667f, 0.0202328227f},
-std::array<float,2>{0.589670539f, 0.663245618f},
-std::array<float,2>{0.267671376f, 0.188239411f},
-std::array<float,2>{0.207201332f, 0.855742991f},
-std::array<float,2>{0.901958287f, 0.405289501f},
-std::array<float,2>{0.801071167f, 0.895917833f},
-std::array<float,2>{0.00286940346f, 0.250825822f},
-std::array<float,2>{0.427355856f, 0.623391867f},
-std::array<float,2>{0.631215632f, 0.044209592f},
-std::array<float,2>{0.992141247f, 0.533426881f},
-std::array<float,2>{0.160672933f, 0.0944979042f},
-std::array<float,2>{0.323402047f, 0.942929566f},
-std::array<float,2>{0.562118292f, 0.369632185f},
-std::array<float,2>{0.713907182f, 0.79934746f},
-std::array<float,2>{0.441854686f, 0.45510006f},
-std::array<float,2>{0.116613373f, 0.716234148f},
-std::array<float,2>{0.871068776f, 0.137872413f},
-std::array<float,2>{0.682121515f, 0.58934027f},
-std::array<float,2>{0.380157381f, 0.00847735628f},
-std::array<float,2>{0.0614793599f, 0.91934371f},
-std::array<float,2>{0.758748412f, 0.300394505f},
-std::array<float,2>{0.92475009f, 0.813069224f},
-std::array<float,2>{0.218879342f, 0.426836729f},
-std::array<float,2>{0.29481864f, 0.648311377f},
-std::array<float,2>{0.610235572f, 0.23376295f},
-std::array<float,2>{0.821897149f, 0.746095717f},
-std::array<float,2>{0.0730870888f, 0.156687215f},
-std::array<float,2>{0.474208772f, 0.774093151f},
-std::array<float,2>{0.726981044f, 0.484914452f},
-std::array<float,2>{0.508134544f, 0.979000628f},
-std::array<float,2>{0.365209699f, 0.340505153f},
-std::array<float,2>{0.14435719f, 0.518094599f},
-std::array<float,2>{0.946866512f, 0.0870804042f},
-std::array<float,2>{0.748133779f, 0.694158256f},
-std::array<float,2>{0.495513201f, 0.146586731f},
-std::array<float,2>{0.0828550607f, 0.784988642f},
-std::array<float,2>{0.838626266f, 0.442248255f},
-std::array<float,2>{0.953334928f, 0.954513729f},
-std::array<float,2>{0.137195751f, 0.354564697f},
-std::array<float,2>{0.351246208f, 0.55837357f},
-std::array<float,2>{0.518837273f, 0.11128629f},
-std::array<float,2>{0.770434916f, 0.596775115f},
-std::array<float,2>{0.0343198404f, 0.050018549f},
-std::array<float,2>{0.401277125f, 0.876987517f},
-std::array<float,2>{0.66273737f, 0.273946494f},
-std::array<float,2>{0.602042973f, 0.862142563f},
-std::array<float,2>{0.308211982f, 0.375802577f},
-std::array<float,2>{0.234672219f, 0.675946474f},
-std::array<float,2>{0.915055931f, 0.213785827f},
-std::array<float,2>{0.545419335f, 0.50130105f},
-std::array<float,2>{0.332011551f, 0.0718204826f},
-std::array<float,2>{0.179241538f, 0.989194274f},
-std::array<float,2>{0.982559741f, 0.323508531f},
-std::array<float,2>{0.845830739f, 0.754663587f},
-std::array<float,2>{0.104145475f, 0.476357847f},
-std::array<float,2>{0.460786432f, 0.726150274f},
-std::array<float,2>{0.699476242f, 0.174176291f},
-std::array<float,2>{0.878792286f, 0.636519134f},
-std::array<float,2>{0.189966768f, 0.237005666f},
-std::array<float,2>{0.258050531f, 0.838818371f},
-std::array<float,2>{0.574379444f, 0.41523838f},
-std::array<float,2>{0.649277627f, 0.926195323f},
-std::array<float,2>{0.413362771f, 0.290401548f},
-std::array<float,2>{0.0294234622f, 0.562895536f},
-std::array<float,2>{0.781948924f, 0.0312412195f},
-std::array<float,2>{0.527070105f, 0.732604206f},
-std::array<float,2>{0.353665739f, 0.185837001f},
-std::array<float,2>{0.131918728f, 0.76357311f},
-std::array<float,2>{0.965234578f, 0.48319608f},
-std::array<float,2>{0.833233118f, 0.995771229f},
-std::array<float,2>{0.0884522647f, 0.315185994f},
-std::array<float,2>{0.491908371f, 0.510162413f},
-std::array<float,2>{0.73783201f, 0.0662873238f},
-std::array<float,2>{0.913410246f, 0.576605499f},
-std::array<float,2>{0.24847956f, 0.01714883f},
-std::array<float,2>{0.303803653f, 0.933168054f},
-std::array<float,2>{0.599523902f, 0.282124907f},
-std::array<float,2>{0.667753816f, 0.829527676f},
-std::array<float,2>{0.394260198f, 0.408059388f},
-std::array<float,2>{0.0397841819f, 0.628352761f},
-std::array<float,2>{0.774743199f, 0.243857667f},
-std::array<float,2>{0.694842339f, 0.551021934f},
-std::array<float,2>{0.466307491f, 0.118682645f},
-std::array<float,2>{0.0944706276f, 0.966484725f},
-std::array<float,2>{0.855482519f, 0.34444204f},
-std::array<float,2>{0.969415069f, 0.796782672f},
-std::array<float,2>{0.184244215f, 0.448025882f},
-std::array<float,2>{0.338364422f, 0.699358642f},
-std::array<float,2>{0.537713051f, 0.152976543f},
-std::array<float,2>{0.796477497f, 0.681399524f},
-std::array<float,2>{0.0166896619f, 0.209373564f},
-std::array<float,2>{0.420542419f, 0.873247385f},
-std::array<float,2>{0.641852856f, 0.390181273f},
-std::array<float,2>{0.566970944f, 0.889181077f},
-std::array<float,2>{0.252342522f, 0.272631615f},
-std::array<float,2>{0.198329747f, 0.604025543f},
-std::array<float,2>{0.889454186f, 0.0581538975f},
-std::array<float,2>{0.635218024f, 0.651836812f},
-std::array<float,2>{0.430343151f, 0.225170732f},
-std::array<float,2>{0.0124088097f, 0.820553064f},
-std::array<float,2>{0.806509793f, 0.435998172f},
-std::array<float,2>{0.893215954f, 0.909214854f},
-std::array<float,2>{0.21166715f, 0.307096601f},
-std::array<float,2>{0.278704256f, 0.581259251f},
-std::array<float,2>{0.580136418f, 0.00169280928f},
-std::array<float,2>{0.860832036f, 0.525348604f},
-std::array<float,2>{0.124766789f, 0.0824867859f},
-std::array<float,2>{0.452901483f, 0.974856257f},
-std::array<float,2>{0.70547682f, 0.332112879f},
-std::array<float,2>{0.55037564f, 0.771936655f},
-std::array<float,2>{0.319042921f, 0.499045581f},
-std::array<float,2>{0.171393469f, 0.73860687f},
-std::array<float,2>{0.99449563f, 0.167238906f},
-std::array<float,2>{0.624798119f, 0.609694183f},
-std::array<float,2>{0.287519842f, 0.0355286486f},
-std::array<float,2>{0.227605358f, 0.905990541f},
-std::array<float,2>{0.929705858f, 0.263074547f},
-std::array<float,2>{0.7517156f, 0.849866688f},
-std::array<float,2>{0.0497763418f, 0.392830789f},
-std::array<float,2>{0.387963891f, 0.666312873f},
-std::array<float,2>{0.675979376f, 0.199362338f},
-std::array<float,2>{0.943208516f, 0.707117796f},
-std::array<float,2>{0.15536052f, 0.129192457f},
-std::array<float,2>{0.369916201f, 0.809632897f},
-std::array<float,2>{0.507092178f, 0.468301237f},
-std::array<float,2>{0.720476866f, 0.949265897f},
-std::array<float,2>{0.479786515f, 0.366913319f},
-std::array<float,2>{0.0659731776f, 0.545011699f},
-std::array<float,2>{0.817244589f, 0.105062976f},
-std::array<float,2>{0.597394228f, 0.713905334f},
-std::array<float,2>{0.297430962f, 0.134778857f},
-std::array<float,2>{0.243532419f, 0.804335475f},
-std::array<float,2>{0.907613099f, 0.459732473f},
-std::array<float,2>{0.777669907f, 0.940964639f},
-std::array<float,2>{0.0448196195f, 0.374054492f},
-std::array<float,2>{0.397015184f, 0.535798311f},
-std::array<float,2>{0.671416283f, 0.0991797596f},
-std::array<float,2>{0.963116944f, 0.619614005f},
-std::array<float,2>{0.127721384f, 0.0413718298f},
-std::array<float,2>{0.357354581f, 0.893149078f},
-std::array<float,2>{0.530993164f, 0.254347175f},
-std::array<float,2>{0.741887212f, 0.851794958f},
-std::array<float,2>{0.48671335f, 0.401799887f},
-std::array<float,2>{0.0916992649f, 0.657008708f},
-std::array<float,2>{0.829471171f, 0.191637605f},
-std::array<float,2>{0.645495355f, 0.519602656f},
-std::array<float,2>{0.41548273f, 0.0927860215f},
-std::array<float,2>{0.0219019763f, 0.982130527f},
-std::array<float,2>{0.791026294f, 0.335952103f},
-std::array<float,2>{0.886692464f, 0.777491033f},
-std::array<float,2>{0.200938508f, 0.488758445f},
-std::array<float,2>{0.255126417f, 0.745141625f},
-std::array<float,2>{0.565612853f, 0.162479118f},
-std::array<float,2>{0.853498697f, 0.644417703f},
-std::array<float,2>{0.0978353918f, 0.230461687f},
-std::array<float,2>{0.461366266f, 0.819137275f},
-std::array<float,2>{0.690152645f, 0.423335403f},
-std::array<float,2>{0.53455478f, 0.916913271f},
-std::array<float,2>{0.340390056f, 0.302642256f},
-std::array<float,2>{0.181074679f, 0.591662228f},
-std::array<float,2>{0.974226773f, 0.0118781663f},
-std::array<float,2>{0.709887564f, 0.672865212f},
-std::array<float,2>{0.447356015f, 0.215822458f},
-std::array<float,2>{0.120001592f, 0.867044687f},
-std::array<float,2>{0.864959419f, 0.380168617f},
-std::array<float,2>{0.996453702f, 0.879727364f},
-std::array<float,2>{0.165905386f, 0.278880417f},
-std::array<float,2>{0.314642787f, 0.60155499f},
-std::array<float,2>{0.551339209f, 0.0541252121f},
-std::array<float,2>{0.809160411f, 0.5614326f},
-std::array<float,2>{0.00999149587f, 0.113524981f},
-std::array<float,2>{0.435354441f, 0.958231628f},
-std::array<float,2>{0.638378561f, 0.358659476f},
-std::array<float,2>{0.582717478f, 0.787174881f},
-std::array<float,2>{0.27714324f, 0.438760281f},
-std::array<float,2>{0.21676223f, 0.691391587f},
-std::array<float,2>{0.896532834f, 0.141935647f},
-std::array<float,2>{0.501688063f, 0.568497539f},
-std::array<float,2>{0.374960035f, 0.0238890927f},
-std::array<float,2>{0.151357844f, 0.925635755f},
-std::array<float,2>{0.941287816f, 0.295244932f},
-std::array<float,2>{0.814946771f, 0.84254992f},
-std::array<float,2>{0.0676321983f, 0.418262303f},
-std::array<float,2>{0.483483464f, 0.640527666f},
-std::array<float,2>{0.725167871f, 0.240402251f},
-std::array<float,2>{0.933906376f, 0.719308496f},
-std::array<float,2>{0.234073579f, 0.177988276f},
-std::array<float,2>{0.281414777f, 0.750150442f},
-std::array<float,2>{0.61835134f, 0.470395386f},
-std::array<float,2>{0.675493598f, 0.986419439f},
-std::array<float,2>{0.383331954f, 0.324920088f},
-std::array<float,2>{0.0544835106f, 0.50659126f},
-std::array<float,2>{0.754142821f, 0.075784944f},
-std::array<float,2>{0.554851651f, 0.629223585f},
-std::array<float,2>{0.327217907f, 0.246251419f},
-std::array<float,2>{0.15667057f, 0.832160771f},
-std::array<float,2>{0.98471266f, 0.412138164f},
-std::array<float,2>{0.871523321f, 0.937011898f},
-std::array<float,2>{0.111109257f, 0.288218677f},
-std::array<float,2>{0.437990338f, 0.574102163f},
-std::array<float,2>{0.718173325f, 0.0221268944f},
-std::array<float,2>{0.905520439f, 0.51241523f},
-std::array<float,2>{0.204047829f, 0.067194052f},
-std::array<float,2>{0.270659357f, 0.996728897f},
-std::array<float,2>{0.590866923f, 0.319382429f},
-std::array<float,2>{0.626759589f, 0.7586537f},
-std::array<float,2>{0.423311979f, 0.480113924f},
-std::array<float,2>{0.00412375154f, 0.726987064f},
-std::array<float,2>{0.79716289f, 0.179953262f},
-std::array<float,2>{0.731368959f, 0.607760072f},
-std::array<float,2>{0.471482545f, 0.058642175f},
-std::array<float,2>{0.0749127418f, 0.885982215f},
-std::array<float,2>{0.82687819f, 0.265800625f},
-std::array<float,2>{0.95084995f, 0.870951951f},
-std::array<float,2>{0.147765398f, 0.383242995f},
-std::array<float,2>{0.360565692f, 0.684481263f},
-std::array<float,2>{0.513309538f, 0.20665057f},
-std::array<float,2>{0.763207018f, 0.695800781f},
-std::array<float,2>{0.057433404f, 0.151378065f},
-std::array<float,2>{0.375496447f, 0.792168617f},
-std::array<float,2>{0.685461283f, 0.450248063f},
-std::array<float,2>{0.615441144f, 0.961247385f},
-std::array<float,2>{0.292416215f, 0.348073959f},
-std::array<float,2>{0.225370154f, 0.548231483f},
-std::array<float,2>{0.929265738f, 0.124237604f},
-std::array<float,2>{0.66000104f, 0.735906184f},
-std::array<float,2>{0.40442878f, 0.169352978f},
-std::array<float,2>{0.0366414078f, 0.765747249f},
-std::array<float,2>{0.766433537f, 0.495647132f},
-std::array<float,2>{0.920928001f, 0.970487893f},
-std::array<float,2>{0.240328267f, 0.331712186f},
-std::array<float,2>{0.311711848f, 0.529125869f},
-std::array<float,2>{0.607918203f, 0.0814514235f},
-std::array<float,2>{0.839885771f, 0.582660139f},
-std::array<float,2>{0.0796571076f, 0.00582894078f},
-std::array<float,2>{0.496490657f, 0.910570681f},
-std::array<float,2>{0.745916128f, 0.312263012f},
-std::array<float,2>{0.521070123f, 0.827879786f},
-std::array<float,2>{0.346624702f, 0.433549672f},
-std::array<float,2>{0.135803416f, 0.655572593f},
-std::array<float,2>{0.958072722f, 0.222000718f},
-std::array<float,2>{0.573725462f, 0.54000026f},
-std::array<float,2>{0.264546871f, 0.108330823f},
-std::array<float,2>{0.193927675f, 0.948358834f},
-std::array<float,2>{0.881594777f, 0.362728298f},
-std::array<float,2>{0.785719752f, 0.806092322f},
-std::array<float,2>{0.0264357664f, 0.461777031f},
-std::array<float,2>{0.409216166f, 0.706756115f},
-std::array<float,2>{0.654414296f, 0.127197355f},
-std::array<float,2>{0.97970438f, 0.669224501f},
-std::array<float,2>{0.174746186f, 0.198135406f},
-std::array<float,2>{0.335669398f, 0.846992075f},
-std::array<float,2>{0.541691899f, 0.397959501f},
-std::array<float,2>{0.698702633f, 0.900011182f},
-std::array<float,2>{0.453974307f, 0.258366495f},
-std::array<float,2>{0.108814001f, 0.615057111f},
-std::array<float,2>{0.84793961f, 0.0349752754f},
-std::array<float,2>{0.611785173f, 0.644625902f},
-std::array<float,2>{0.296847582f, 0.231488422f},
-std::array<float,2>{0.221393734f, 0.814545453f},
-std::array<float,2>{0.92258954f, 0.428829372f},
-std::array<float,2>{0.760300517f, 0.919984937f},
-std::array<float,2>{0.0592511445f, 0.297135293f},
-std::array<float,2>{0.382215649f, 0.587666512f},
-std::array<float,2>{0.681577206f, 0.0101161748f},
-std::array<float,2>{0.948846519f, 0.516966224f},
-std::array<float,2>{0.142056033f, 0.0881364346f},
-std::array<float,2>{0.366238803f, 0.977056265f},
-std::array<float,2>{0.510212719f, 0.343724787f},
-std::array<float,2>{0.730427146f, 0.777044654f},
-std::array<float,2>{0.47479257f, 0.486760706f},
-std::array<float,2>{0.0703993812f, 0.749345005f},
-std::array<float,2>{0.823432088f, 0.158992916f},
-std::array<float,2>{0.629112899f, 0.622009933f},
-std::array<float,2>{0.429006428f, 0.0456023328f},
-std::array<float,2>{0.000372227543f, 0.897490859f},
-std::array<float,2>{0.803675532f, 0.252266109f},
-std::array<float,2>{0.90012908f, 0.857894957f},
-std::array<float,2>{0.210848212f, 0.402732223f},
-std::array<float,2>{0.266468138f, 0.661142349f},
-std::array<float,2>{0.586785734f, 0.191003531f},
-std::array<float,2>{0.868959308f, 0.716950357f},
-std::array<float,2>{0.11347001f, 0.140043721f},
-std::array<float,2>{0.444320858f, 0.797456503f},
-std::array<float,2>{0.712694287f, 0.453822881f},
-std::array<float,2>{0.560515642f, 0.944518685f},
-std::array<float,2>{0.322239816f, 0.368828803f},
-std::array<float,2>{0.163053542f, 0.533102512f},
-std::array<float,2>{0.989458859f, 0.0972095728f},
-std::array<float,2>{0.701371133f, 0.723956823f},
-std::array<float,2>{0.457115352f, 0.172411039f},
-std::array<float,2>{0.102077991f, 0.756890714f},
-std::array<float,2>{0.844085038f, 0.473714381f},
-std::array<float,2>{0.981656432f, 0.99132812f},
-std::array<float,2>{0.177429706f, 0.321394026f},
-std::array<float,2>{0.329229891f, 0.502590954f},
-std::array<float,2>{0.543028474f, 0.0734824613f},
-std::array<float,2>{0.784932733f, 0.566383243f},
-std::array<float,2>{0.0276591629f, 0.0291102659f},
-std::array<float,2>{0.411040753f, 0.928192914f},
-std::array<float,2>{0.652145982f, 0.292386144f},
-std::array<float,2>{0.57682091f, 0.837821484f},
-std::array<float,2>{0.26028052f, 0.417804986f},
-std::array<float,2>{0.187903881f, 0.633431435f},
-std::array<float,2>{0.875088811f, 0.235769704f},
-std::array<float,2>{0.516872823f, 0.555747628f},
-std::array<float,2>{0.348028094f, 0.111400209f},
-std::array<float,2>{0.139893353f, 0.956092834f},
-std::array<float,2>{0.955180883f, 0.351872504f},
-std::array<float,2>{0.835959017f, 0.782643497f},
-std::array<float,2>{0.0848917216f, 0.444874436f},
-std::array<float,2>{0.492729574f, 0.691449702f},
-std::array<float,2>{0.747997403f, 0.145902053f},
-std::array<float,2>{0.916776419f, 0.678231955f},
-std::array<float,2>{0.238092333f, 0.211010411f},
-std::array<float,2>{0.30614385f, 0.859537005f},
-std::array<float,2>{0.604132473f, 0.378533483f},
-std::array<float,2>{0.660177827f, 0.875638783f},
-std::array<float,2>{0.39985472f, 0.276308477f},
-std::array<float,2>{0.032604523f, 0.595289469f},
-std::array<float,2>{0.7731902f, 0.0482812636f},
-std::array<float,2>{0.536109567f, 0.70265013f},
-std::array<float,2>{0.337345779f, 0.1544016f},
-std::array<float,2>{0.186015785f, 0.793426871f},
-std::array<float,2>{0.972487986f, 0.445405632f},
-std::array<float,2>{0.858872414f, 0.968346179f},
-std::array<float,2>{0.0968273506f, 0.347532541f},
-std::array<float,2>{0.468682051f, 0.553574502f},
-std::array<float,2>{0.692053378f, 0.119345605f},
-std::array<float,2>{0.888134956f, 0.601662695f},
-std::array<float,2>{0.196824163f, 0.0548661761f},
-std::array<float,2>{0.251003325f, 0.887133479f},
-std::array<float,2>{0.569368005f, 0.271372378f},
-std::array<float,2>{0.642738044f, 0.871615112f},
-std::array<float,2>{0.418383896f, 0.386774987f},
-std::array<float,2>{0.0190465841f, 0.683134139f},
-std::array<float,2>{0.793677986f, 0.207942143f},
-std::array<float,2>{0.734717011f, 0.509155273f},
-std::array<float,2>{0.490152895f, 0.0630952492f},
-std::array<float,2>{0.0868560821f, 0.993114889f},
-std::array<float,2>{0.834433734f, 0.312739253f},
-std::array<float,2>{0.968645751f, 0.764643431f},
-std::array<float,2>{0.130741924f, 0.481640488f},
-std::array<float,2>{0.353258252f, 0.731852531f},
-std::array<float,2>{0.523590028f, 0.184267551f},
-std::array<float,2>{0.775864482f, 0.625813186f},
-std::array<float,2>{0.041437719f, 0.245184004f},
-std::array<float,2>{0.391044378f, 0.830391109f},
-std::array<float,2>{0.665779352f, 0.409419984f},
-std::array<float,2>{0.600870848f, 0.930393279f},
-std::array<float,2>{0.301235795f, 0.283738732f},
-std::array<float,2>{0.246969134f, 0.575110972f},
-std::array<float,2>{0.910489619f, 0.0182958841f},
-std::array<float,2>{0.679237366f, 0.665445268f},
-std::array<float,2>{0.38929072f, 0.201967373f},
-std::array<float,2>{0.0487636216f, 0.848985016f},
-std::array<float,2>{0.752088189f, 0.391430527f},
-std::array<float,2>{0.933366597f, 0.903380275f},
-std::array<float,2>{0.230243266f, 0.265619576f},
-std::array<float,2>{0.286553144f, 0.612292051f},
-std::array<float,2>{0.62250948f, 0.0382729471f},
-std::array<float,2>{0.819024146f, 0.543192983f},
-std::array<float,2>{0.064373672f, 0.103268743f},
-std::array<float,2>{0.476869494f, 0.952955723f},
-std::array<float,2>{0.722283423f, 0.363701016f},
-std::array<float,2>{0.505037129f, 0.811819673f},
-std::array<float,2>{0.367322445f, 0.466287166f},
-std::array<float,2>{0.153936222f, 0.709327638f},
-std::array<float,2>{0.943963706f, 0.13187401f},
-std::array<float,2>{0.578192532f, 0.579028189f},
-std::array<float,2>{0.280369788f, 0.00310527906f},
-std::array<float,2>{0.213042259f, 0.906922758f},
-std::array<float,2>{0.892465115f, 0.305545926f},
-std::array<float,2>{0.807697594f, 0.822806954f},
-std::array<float,2>{0.0140792113f, 0.434848726f},
-std::array<float,2>{0.432418376f, 0.648622751f},
-std::array<float,2>{0.633274972f, 0.224240735f},
-std::array<float,2>{0.992991388f, 0.741192043f},
-std::array<float,2>{0.168423906f, 0.164640561f},
-std::array<float,2>{0.318058252f, 0.770181417f},
-std::array<float,2>{0.5472489f, 0.496573478f},
-std::array<float,2>{0.704353034f, 0.974216998f},
-std::array<float,2>{0.450434297f, 0.334087431f},
-std::array<float,2>{0.122104891f, 0.52617842f},
-std::array<float,2>{0.861594141f, 0.0849168971f},
-std::array<float,2>{0.563472092f, 0.743991494f},
-std::array<float,2>{0.256246895f, 0.161435962f},
-std::array<float,2>{0.201892227f, 0.77993691f},
-std::array<float,2>{0.883654296f, 0.490975946f},
-std::array<float,2>{0.790380478f, 0.983752489f},
-std::array<float,2>{0.0206300858f, 0.339799821f},
-std::array<float,2>{0.417470008f, 0.521612644f},
-std::array<float,2>{0.648332536f, 0.0911224857f},
-std::array<float,2>{0.975739479f, 0.592996955f},
-std::array<float,2>{0.183062002f, 0.0149097042f},
-std::array<float,2>{0.341830105f, 0.914969444f},
-std::array<float,2>{0.531908095f, 0.30394429f},
-std::array<float,2>{0.688198388f, 0.81696564f},
-std::array<float,2>{0.463672906f, 0.42487365f},
-std::array<float,2>{0.101267286f, 0.642310083f},
-std::array<float,2>{0.853565395f, 0.226859108f},
-std::array<float,2>{0.669525146f, 0.538493216f},
-std::array<float,2>{0.394870907f, 0.10117922f},
-std::array<float,2>{0.0449933298f, 0.938079417f},
-std::array<float,2>{0.779877126f, 0.372625202f},
-std::array<float,2>{0.91013217f, 0.802709937f},
-std::array<float,2>{0.245106325f, 0.457653075f},
-std::array<float,2>{0.300237149f, 0.712838531f},
-std::array<float,2>{0.595023036f, 0.134032384f},
-std::array<float,2>{0.831342757f, 0.658725798f},
-std::array<float,2>{0.0925271288f, 0.194504738f},
-std::array<float,2>{0.484943151f, 0.853891969f},
-std::array<float,2>{0.7386415f, 0.399534404f},
-std::array<float,2>{0.527775645f, 0.891776204f},
-std::array<float,2>{0.357607603f, 0.256988704f},
-std::array<float,2>{0.126771703f, 0.619077682f},
-std::array<float,2>{0.962213039f, 0.039983429f},
-std::array<float,2>{0.723594427f, 0.636773527f},
-std::array<float,2>{0.480938405f, 0.240052715f},
-std::array<float,2>{0.0697100013f, 0.840103209f},
-std::array<float,2>{0.814255595f, 0.420199364f},
-std::array<float,2>{0.939085484f, 0.92315352f},
-std::array<float,2>{0.14938432f, 0.294691205f},
-std::array<float,2>{0.37139377f, 0.567127049f},
-std::array<float,2>{0.503707707f, 0.0254806466f},
-std::array<float,2>{0.755868256f, 0.505007565f},
-std::array<float,2>{0.0522676706f, 0.0778356269f},
-std::array<float,2>{0.385659844f, 0.98623538f},
-std::array<float,2>{0.672730148f, 0.326444596f},
-std::array<float,2>{0.619893849f, 0.752736807f},
-std::array<float,2>{0.283595532f, 0.470966011f},
-std::array<float,2>{0.231124207f, 0.722259283f},
-std::array<float,2>{0.937205911f, 0.176774547f},
-std::array<float,2>{0.553436875f, 0.5994519f},
-std::array<float,2>{0.31424883f, 0.0522837341f},
-std::array<float,2>{0.167869836f, 0.882729292f},
-std::array<float,2>{0.998477876f, 0.28086853f},
-std::array<float,2>{0.865480483f, 0.864679456f},
-std::array<float,2>{0.117991313f, 0.382549256f},
-std::array<float,2>{0.445352167f, 0.67528671f},
-std::array<float,2>{0.707390487f, 0.218140528f},
-std::array<float,2>{0.895775676f, 0.689133286f},
-std::array<float,2>{0.218230069f, 0.144528314f},
-std::array<float,2>{0.274999797f, 0.786915064f},
-std::array<float,2>{0.584522605f, 0.441203117f},
-std::array<float,2>{0.639520168f, 0.960175276f},
-std::array<float,2>{0.435777724f, 0.357046217f},
-std::array<float,2>{0.00942847319f, 0.558707416f},
-std::array<float,2>{0.811827779f, 0.115617685f},
-std::array<float,2>{0.515537798f, 0.6857934f},
-std::array<float,2>{0.362440944f, 0.203875482f},
-std::array<float,2>{0.146336243f, 0.868659616f},
-std::array<float,2>{0.95134443f, 0.384767354f},
-std::array<float,2>{0.824777961f, 0.883469582f},
-std::array<float,2>{0.0768761933f, 0.268039137f},
-std::array<float,2>{0.470511764f, 0.605735362f},
-std::array<float,2>{0.733576477f, 0.0612083972f},
-std::array<float,2>{0.926448226f, 0.550063968f},
-std::array<float,2>{0.222759113f, 0.122536324f},
-std::array<float,2>{0.290041983f, 0.964788854f},
-std::array<float,2>{0.615190685f, 0.350889951f},
-std::array<float,2>{0.687391698f, 0.790793598f},
-std::array<float,2>{0.377658784f, 0.452221245f},
-std::array<float,2>{0.055586271f, 0.697939634f},
-std::array<float,2>{0.765178144f, 0.148940012f},
-std::array<float,2>{0.716424465f, 0.572256982f},
-std::array<float,2>{0.440659672f, 0.021235764f},
-std::array<float,2>{0.111748084f, 0.934444964f},
-std::array<float,2>{0.874147475f, 0.286113441f},
-std::array<float,2>{0.986837685f, 0.834769964f},
-std::array<float,2>{0.159647763f, 0.411991179f},
-std::array<float,2>{0.324904025f, 0.632233918f},
-std::array<float,2>{0.557113945f, 0.249672174f},
-std::array<float,2>{0.799365044f, 0.730203032f},
-std::array<float,2>{0.00677628024f, 0.182018891f},
-std::array<float,2>{0.425212264f, 0.760986269f},
-std::array<float,2>{0.626967609f, 0.477848798f},
-std::array<float,2>{0.59281379f, 0.998383284f},
-std::array<float,2>{0.272025436f, 0.318067104f},
-std::array<float,2>{0.205210268f, 0.514693558f},
-std::array<float,2>{0.903456271f, 0.0703085884f},
-std::array<float,2>{0.652420878f, 0.703785658f},
-std::array<float,2>{0.406599581f, 0.125139356f},
-std::array<float,2>{0.024934303f, 0.808199644f},
-std::array<float,2>{0.78736186f, 0.464622408f},
-std::array<float,2>{0.87932992f, 0.946870446f},
-std::array<float,2>{0.192984223f, 0.360214084f},
-std::array<float,2>{0.262811154f, 0.542654991f},
-std::array<float,2>{0.571198225f, 0.106458426f},
-std::array<float,2>{0.851004183f, 0.616380632f},
-std::array<float,2>{0.106149435f, 0.0325313322f},
-std::array<float,2>{0.456169665f, 0.901855469f},
-std::array<float,2>{0.696036041f, 0.261679471f},
-std::array<float,2>{0.540922821f, 0.845258594f},
-std::array<float,2>{0.332315326f, 0.395095438f},
-std::array<float,2>{0.172167659f, 0.670378268f},
-std::array<float,2>{0.976994157f, 0.195891231f},
-std::array<float,2>{0.607088625f, 0.530151665f},
-std::array<float,2>{0.308923364f, 0.0786085054f},
-std::array<float,2>{0.239775017f, 0.972495794f},
-std::array<float,2>{0.919187188f, 0.329357862f},
-std::array<float,2>{0.769191563f, 0.769305348f},
-std::array<float,2>{0.0376608483f, 0.492852688f},
-std::array<float,2>{0.402916044f, 0.736922741f},
-std::array<float,2>{0.657005787f, 0.170949176f},
-std::array<float,2>{0.960523665f, 0.653573275f},
-std::array<float,2>{0.133640155f, 0.220393524f},
-std::array<float,2>{0.344979942f, 0.825441122f},
-std::array<float,2>{0.522707939f, 0.430079073f},
-std::array<float,2>{0.743015647f, 0.913605034f},
-std::array<float,2>{0.499849081f, 0.308901668f},
-std::array<float,2>{0.0804496258f, 0.584256291f},
-std::array<float,2>{0.842743337f, 0.0061035119f}}
\ No newline at end of file
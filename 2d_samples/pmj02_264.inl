@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.678514242f, 0.48916769f},
-std::array<float,2>{0.084021844f, 0.939404428f},
-std::array<float,2>{0.869244039f, 0.554584205f},
-std::array<float,2>{0.414122939f, 0.166716933f},
-std::array<float,2>{0.880235791f, 0.0379281603f},
-std::array<float,2>{0.361128539f, 0.654219151f},
-std::array<float,2>{0.522748709f, 0.754821241f},
-std::array<float,2>{0.181268901f, 0.309811145f},
-std::array<float,2>{0.79027003f, 0.354028821f},
-std::array<float,2>{0.445072174f, 0.856889725f},
-std::array<float,2>{0.700709283f, 0.745511651f},
-std::array<float,2>{0.00740992418f, 0.115045667f},
-std::array<float,2>{0.623650312f, 0.220328048f},
-std::array<float,2>{0.229058385f, 0.624541342f},
-std::array<float,2>{0.983438432f, 0.933881462f},
-std::array<float,2>{0.31072697f, 0.37923646f},
-std::array<float,2>{0.537001669f, 0.255660295f},
-std::array<float,2>{0.126765877f, 0.791052401f},
-std::array<float,2>{0.923243463f, 0.68257308f},
-std::array<float,2>{0.331258804f, 0.0172507279f},
-std::array<float,2>{0.83301723f, 0.127243325f},
-std::array<float,2>{0.402443796f, 0.525743961f},
-std::array<float,2>{0.643418431f, 0.978631318f},
-std::array<float,2>{0.119522586f, 0.448586047f},
-std::array<float,2>{0.947185934f, 0.417148471f},
-std::array<float,2>{0.268839091f, 0.877501249f},
-std::array<float,2>{0.564778984f, 0.572400749f},
-std::array<float,2>{0.203865021f, 0.201907218f},
-std::array<float,2>{0.749233007f, 0.074700892f},
-std::array<float,2>{0.0586582869f, 0.708239257f},
-std::array<float,2>{0.776534915f, 0.83184737f},
-std::array<float,2>{0.483098149f, 0.330127656f},
-std::array<float,2>{0.70412457f, 0.318819195f},
-std::array<float,2>{0.0190300308f, 0.823753774f},
-std::array<float,2>{0.812167645f, 0.702241302f},
-std::array<float,2>{0.459190369f, 0.0849186704f},
-std::array<float,2>{0.999141335f, 0.209617466f},
-std::array<float,2>{0.294171244f, 0.592846394f},
-std::array<float,2>{0.599153161f, 0.896177709f},
-std::array<float,2>{0.246379882f, 0.434872627f},
-std::array<float,2>{0.84708482f, 0.454151422f},
-std::array<float,2>{0.426881284f, 0.992446482f},
-std::array<float,2>{0.666451871f, 0.500206411f},
-std::array<float,2>{0.062824592f, 0.146184668f},
-std::array<float,2>{0.5151425f, 0.0111662569f},
-std::array<float,2>{0.163487613f, 0.658020258f},
-std::array<float,2>{0.903649151f, 0.805116653f},
-std::array<float,2>{0.358111799f, 0.271260828f},
-std::array<float,2>{0.582503796f, 0.39966926f},
-std::array<float,2>{0.188166276f, 0.917614579f},
-std::array<float,2>{0.967315793f, 0.601302803f},
-std::array<float,2>{0.250889063f, 0.234944016f},
-std::array<float,2>{0.764310658f, 0.103977911f},
-std::array<float,2>{0.487495303f, 0.72888273f},
-std::array<float,2>{0.726695895f, 0.86099565f},
-std::array<float,2>{0.0388388373f, 0.371499568f},
-std::array<float,2>{0.912979245f, 0.281816542f},
-std::array<float,2>{0.313590139f, 0.77679348f},
-std::array<float,2>{0.560904741f, 0.63297683f},
-std::array<float,2>{0.14666827f, 0.0527314544f},
-std::array<float,2>{0.625334561f, 0.184654057f},
-std::array<float,2>{0.0957167298f, 0.546699464f},
-std::array<float,2>{0.820518613f, 0.962524176f},
-std::array<float,2>{0.378573596f, 0.478080541f},
-std::array<float,2>{0.726139903f, 0.429036289f},
-std::array<float,2>{0.0410542637f, 0.904337883f},
-std::array<float,2>{0.751825869f, 0.582752407f},
-std::array<float,2>{0.492243767f, 0.217507482f},
-std::array<float,2>{0.95321691f, 0.0931114033f},
-std::array<float,2>{0.261938989f, 0.691876769f},
-std::array<float,2>{0.592450619f, 0.813813388f},
-std::array<float,2>{0.199250564f, 0.322757781f},
-std::array<float,2>{0.819016933f, 0.274132073f},
-std::array<float,2>{0.387135953f, 0.804385066f},
-std::array<float,2>{0.639871597f, 0.665284991f},
-std::array<float,2>{0.108633503f, 0.000540198642f},
-std::array<float,2>{0.552411616f, 0.153947368f},
-std::array<float,2>{0.149786115f, 0.513330817f},
-std::array<float,2>{0.918890476f, 0.987568855f},
-std::array<float,2>{0.324924886f, 0.467424124f},
-std::array<float,2>{0.601857662f, 0.364703268f},
-std::array<float,2>{0.237267599f, 0.872670531f},
-std::array<float,2>{0.9860906f, 0.720784426f},
-std::array<float,2>{0.288037211f, 0.0953715518f},
-std::array<float,2>{0.804446101f, 0.244264334f},
-std::array<float,2>{0.464175552f, 0.603635073f},
-std::array<float,2>{0.712205112f, 0.910017073f},
-std::array<float,2>{0.0302404054f, 0.39451763f},
-std::array<float,2>{0.894068062f, 0.476402909f},
-std::array<float,2>{0.347740054f, 0.960648954f},
-std::array<float,2>{0.50527364f, 0.535458446f},
-std::array<float,2>{0.170719385f, 0.173182264f},
-std::array<float,2>{0.662076294f, 0.0571456403f},
-std::array<float,2>{0.0769158676f, 0.632242382f},
-std::array<float,2>{0.85359031f, 0.767615139f},
-std::array<float,2>{0.436260015f, 0.291064918f},
-std::array<float,2>{0.651676297f, 0.29808718f},
-std::array<float,2>{0.113288485f, 0.758477509f},
-std::array<float,2>{0.839621663f, 0.648437023f},
-std::array<float,2>{0.391246378f, 0.0467030667f},
-std::array<float,2>{0.930360615f, 0.158121735f},
-std::array<float,2>{0.337944448f, 0.556428552f},
-std::array<float,2>{0.544233978f, 0.948078334f},
-std::array<float,2>{0.140103608f, 0.498007238f},
-std::array<float,2>{0.766095638f, 0.388880491f},
-std::array<float,2>{0.476557881f, 0.927295625f},
-std::array<float,2>{0.740472317f, 0.614343524f},
-std::array<float,2>{0.0508577041f, 0.230177015f},
-std::array<float,2>{0.57661593f, 0.118103072f},
-std::array<float,2>{0.212742642f, 0.739584088f},
-std::array<float,2>{0.944021225f, 0.848171532f},
-std::array<float,2>{0.275799662f, 0.346386075f},
-std::array<float,2>{0.528078675f, 0.437665582f},
-std::array<float,2>{0.179449216f, 0.973533809f},
-std::array<float,2>{0.885478795f, 0.522249162f},
-std::array<float,2>{0.3678146f, 0.139219135f},
-std::array<float,2>{0.86670202f, 0.0236430205f},
-std::array<float,2>{0.407784909f, 0.676012516f},
-std::array<float,2>{0.6856094f, 0.787396073f},
-std::array<float,2>{0.0868805498f, 0.263249815f},
-std::array<float,2>{0.973546982f, 0.338256985f},
-std::array<float,2>{0.298265368f, 0.836064517f},
-std::array<float,2>{0.611898363f, 0.714321017f},
-std::array<float,2>{0.226109684f, 0.0696174502f},
-std::array<float,2>{0.692313075f, 0.194564015f},
-std::array<float,2>{0.0119327577f, 0.563018799f},
-std::array<float,2>{0.784943938f, 0.889953315f},
-std::array<float,2>{0.452903271f, 0.406511873f},
-std::array<float,2>{0.634296119f, 0.378346503f},
-std::array<float,2>{0.103138596f, 0.932609439f},
-std::array<float,2>{0.813816667f, 0.617906153f},
-std::array<float,2>{0.385503531f, 0.224517882f},
-std::array<float,2>{0.914143562f, 0.11204312f},
-std::array<float,2>{0.32215327f, 0.74838841f},
-std::array<float,2>{0.548076272f, 0.852169394f},
-std::array<float,2>{0.154126912f, 0.355590701f},
-std::array<float,2>{0.755094051f, 0.305176705f},
-std::array<float,2>{0.496933132f, 0.750789165f},
-std::array<float,2>{0.720040917f, 0.651093185f},
-std::array<float,2>{0.0442012474f, 0.0328888111f},
-std::array<float,2>{0.588459373f, 0.168878183f},
-std::array<float,2>{0.198633224f, 0.548508823f},
-std::array<float,2>{0.958177626f, 0.943334818f},
-std::array<float,2>{0.260149717f, 0.485181034f},
-std::array<float,2>{0.502993166f, 0.335705727f},
-std::array<float,2>{0.164772958f, 0.832702577f},
-std::array<float,2>{0.895445287f, 0.706558108f},
-std::array<float,2>{0.346366882f, 0.0722473115f},
-std::array<float,2>{0.855769813f, 0.197962523f},
-std::array<float,2>{0.4324027f, 0.575328052f},
-std::array<float,2>{0.659404099f, 0.879641294f},
-std::array<float,2>{0.0712330416f, 0.418467224f},
-std::array<float,2>{0.988969862f, 0.449411333f},
-std::array<float,2>{0.28493014f, 0.982266188f},
-std::array<float,2>{0.605632126f, 0.527958274f},
-std::array<float,2>{0.239394039f, 0.12978898f},
-std::array<float,2>{0.717820287f, 0.023023434f},
-std::array<float,2>{0.0259717889f, 0.683836818f},
-std::array<float,2>{0.798691392f, 0.79673636f},
-std::array<float,2>{0.465112835f, 0.252727389f},
-std::array<float,2>{0.734609187f, 0.268075287f},
-std::array<float,2>{0.0501454808f, 0.812254667f},
-std::array<float,2>{0.771635115f, 0.660402119f},
-std::array<float,2>{0.469383925f, 0.0141161988f},
-std::array<float,2>{0.939313531f, 0.140904918f},
-std::array<float,2>{0.278770655f, 0.505533636f},
-std::array<float,2>{0.573084593f, 0.998653114f},
-std::array<float,2>{0.218723401f, 0.460093498f},
-std::array<float,2>{0.843262196f, 0.432903886f},
-std::array<float,2>{0.394755781f, 0.894265175f},
-std::array<float,2>{0.65298003f, 0.586871266f},
-std::array<float,2>{0.11241889f, 0.203479603f},
-std::array<float,2>{0.541249692f, 0.0790124312f},
-std::array<float,2>{0.135609284f, 0.698576093f},
-std::array<float,2>{0.937063396f, 0.825289905f},
-std::array<float,2>{0.341281623f, 0.315412998f},
-std::array<float,2>{0.614450037f, 0.482601941f},
-std::array<float,2>{0.22208105f, 0.966238618f},
-std::array<float,2>{0.97225982f, 0.541100681f},
-std::array<float,2>{0.301503718f, 0.179764763f},
-std::array<float,2>{0.785804868f, 0.0487630181f},
-std::array<float,2>{0.446945846f, 0.637109697f},
-std::array<float,2>{0.687819362f, 0.778048992f},
-std::array<float,2>{0.0113605307f, 0.28897804f},
-std::array<float,2>{0.887676179f, 0.369686663f},
-std::array<float,2>{0.372980624f, 0.8646487f},
-std::array<float,2>{0.523627698f, 0.731397271f},
-std::array<float,2>{0.172660723f, 0.108914256f},
-std::array<float,2>{0.681473017f, 0.241708726f},
-std::array<float,2>{0.0905317366f, 0.594654918f},
-std::array<float,2>{0.861678481f, 0.921206951f},
-std::array<float,2>{0.413046956f, 0.402470499f},
-std::array<float,2>{0.697535515f, 0.462896615f},
-std::array<float,2>{0.00359251793f, 0.991180599f},
-std::array<float,2>{0.795048475f, 0.508860052f},
-std::array<float,2>{0.437729657f, 0.149278238f},
-std::array<float,2>{0.978652239f, 0.00536249811f},
-std::array<float,2>{0.304842383f, 0.669167876f},
-std::array<float,2>{0.620769918f, 0.800775945f},
-std::array<float,2>{0.231824011f, 0.278092593f},
-std::array<float,2>{0.871335089f, 0.325045645f},
-std::array<float,2>{0.421057165f, 0.81924051f},
-std::array<float,2>{0.672804832f, 0.691158354f},
-std::array<float,2>{0.0791193992f, 0.0884661078f},
-std::array<float,2>{0.518981218f, 0.211105987f},
-std::array<float,2>{0.187046736f, 0.582019806f},
-std::array<float,2>{0.875679851f, 0.900708377f},
-std::array<float,2>{0.365319192f, 0.422935784f},
-std::array<float,2>{0.567681313f, 0.296396583f},
-std::array<float,2>{0.208752692f, 0.769571126f},
-std::array<float,2>{0.952608407f, 0.627415836f},
-std::array<float,2>{0.270430058f, 0.0605767742f},
-std::array<float,2>{0.779627383f, 0.179084077f},
-std::array<float,2>{0.480020523f, 0.531465888f},
-std::array<float,2>{0.744817138f, 0.956703961f},
-std::array<float,2>{0.0570401065f, 0.471006334f},
-std::array<float,2>{0.928918958f, 0.39674148f},
-std::array<float,2>{0.332969576f, 0.911860168f},
-std::array<float,2>{0.53218627f, 0.605498075f},
-std::array<float,2>{0.13201043f, 0.24690713f},
-std::array<float,2>{0.645079553f, 0.100122169f},
-std::array<float,2>{0.123509459f, 0.724788964f},
-std::array<float,2>{0.829826653f, 0.870765567f},
-std::array<float,2>{0.402131796f, 0.35987699f},
-std::array<float,2>{0.671474755f, 0.348053157f},
-std::array<float,2>{0.0699189603f, 0.843916416f},
-std::array<float,2>{0.850621641f, 0.737434804f},
-std::array<float,2>{0.425135285f, 0.124181852f},
-std::array<float,2>{0.902165592f, 0.233048007f},
-std::array<float,2>{0.352993846f, 0.610767484f},
-std::array<float,2>{0.50952965f, 0.924707592f},
-std::array<float,2>{0.156892598f, 0.384036064f},
-std::array<float,2>{0.806838691f, 0.49470669f},
-std::array<float,2>{0.455851525f, 0.94975245f},
-std::array<float,2>{0.709209025f, 0.561653972f},
-std::array<float,2>{0.021854179f, 0.163291603f},
-std::array<float,2>{0.595442295f, 0.0426946096f},
-std::array<float,2>{0.24601914f, 0.643684328f},
-std::array<float,2>{0.992821693f, 0.764077306f},
-std::array<float,2>{0.290142894f, 0.301285118f},
-std::array<float,2>{0.555934489f, 0.413086712f},
-std::array<float,2>{0.143053502f, 0.883786798f},
-std::array<float,2>{0.908465326f, 0.567520142f},
-std::array<float,2>{0.318144202f, 0.189632207f},
-std::array<float,2>{0.826742411f, 0.0631672665f},
-std::array<float,2>{0.382382184f, 0.716953576f},
-std::array<float,2>{0.631251752f, 0.842754662f},
-std::array<float,2>{0.0985854641f, 0.34012413f},
-std::array<float,2>{0.963277996f, 0.257967919f},
-std::array<float,2>{0.256554782f, 0.784635544f},
-std::array<float,2>{0.581913769f, 0.673436165f},
-std::array<float,2>{0.193240896f, 0.029668035f},
-std::array<float,2>{0.732674956f, 0.135095209f},
-std::array<float,2>{0.0313722454f, 0.517586768f},
-std::array<float,2>{0.761268854f, 0.969417691f},
-std::array<float,2>{0.490323305f, 0.443128169f},
-std::array<float,2>{0.640828013f, 0.44575721f},
-std::array<float,2>{0.117480099f, 0.977045536f},
-std::array<float,2>{0.8346138f, 0.524832428f},
-std::array<float,2>{0.405921578f, 0.126057982f},
-std::array<float,2>{0.92406106f, 0.0193788372f},
-std::array<float,2>{0.328261614f, 0.679980576f},
-std::array<float,2>{0.537761033f, 0.790197194f},
-std::array<float,2>{0.128312796f, 0.256537676f},
-std::array<float,2>{0.773448825f, 0.328716367f},
-std::array<float,2>{0.480641723f, 0.829668522f},
-std::array<float,2>{0.7477929f, 0.70996356f},
-std::array<float,2>{0.0620449334f, 0.0771076605f},
-std::array<float,2>{0.56418246f, 0.2006796f},
-std::array<float,2>{0.206559375f, 0.571926177f},
-std::array<float,2>{0.94792068f, 0.876467586f},
-std::array<float,2>{0.26643461f, 0.416013867f},
-std::array<float,2>{0.520580411f, 0.311379731f},
-std::array<float,2>{0.182922959f, 0.757075727f},
-std::array<float,2>{0.882031798f, 0.654376805f},
-std::array<float,2>{0.362512976f, 0.035172645f},
-std::array<float,2>{0.868940949f, 0.164515346f},
-std::array<float,2>{0.41621995f, 0.550928295f},
-std::array<float,2>{0.676824272f, 0.940358996f},
-std::array<float,2>{0.0835069194f, 0.49095422f},
-std::array<float,2>{0.981166303f, 0.381897956f},
-std::array<float,2>{0.309046894f, 0.937273383f},
-std::array<float,2>{0.621376276f, 0.622431159f},
-std::array<float,2>{0.227410302f, 0.221630752f},
-std::array<float,2>{0.702471673f, 0.115662292f},
-std::array<float,2>{0.0052786977f, 0.742809594f},
-std::array<float,2>{0.791412413f, 0.857965648f},
-std::array<float,2>{0.442380756f, 0.352782696f},
-std::array<float,2>{0.729100764f, 0.37337175f},
-std::array<float,2>{0.0363102667f, 0.862544656f},
-std::array<float,2>{0.762610197f, 0.728501201f},
-std::array<float,2>{0.485851645f, 0.102284916f},
-std::array<float,2>{0.966517746f, 0.237269282f},
-std::array<float,2>{0.252726734f, 0.599330127f},
-std::array<float,2>{0.585511446f, 0.914190948f},
-std::array<float,2>{0.189714715f, 0.401814073f},
-std::array<float,2>{0.823994875f, 0.479800612f},
-std::array<float,2>{0.376448154f, 0.963543594f},
-std::array<float,2>{0.627794325f, 0.543530285f},
-std::array<float,2>{0.0941311717f, 0.187477291f},
-std::array<float,2>{0.559153497f, 0.0544595905f},
-std::array<float,2>{0.146203518f, 0.636080384f},
-std::array<float,2>{0.911722124f, 0.774172783f},
-std::array<float,2>{0.315635771f, 0.284203023f},
-std::array<float,2>{0.599929988f, 0.43696475f},
-std::array<float,2>{0.249242201f, 0.89785403f},
-std::array<float,2>{0.997995496f, 0.59171325f},
-std::array<float,2>{0.296132058f, 0.208964184f},
-std::array<float,2>{0.810286522f, 0.0835964158f},
-std::array<float,2>{0.458681911f, 0.700834215f},
-std::array<float,2>{0.705743968f, 0.821717501f},
-std::array<float,2>{0.0163632706f, 0.317709118f},
-std::array<float,2>{0.906115055f, 0.272575289f},
-std::array<float,2>{0.356240064f, 0.806648552f},
-std::array<float,2>{0.5122962f, 0.65992862f},
-std::array<float,2>{0.161122516f, 0.00905292947f},
-std::array<float,2>{0.665270746f, 0.148318037f},
-std::array<float,2>{0.0661552101f, 0.503217876f},
-std::array<float,2>{0.844387174f, 0.995211303f},
-std::array<float,2>{0.429090321f, 0.455159724f},
-std::array<float,2>{0.714171529f, 0.390982211f},
-std::array<float,2>{0.0279484708f, 0.906920969f},
-std::array<float,2>{0.800900042f, 0.60260582f},
-std::array<float,2>{0.462100416f, 0.242365241f},
-std::array<float,2>{0.98795706f, 0.0970139876f},
-std::array<float,2>{0.285841286f, 0.718977451f},
-std::array<float,2>{0.603745043f, 0.874756455f},
-std::array<float,2>{0.23507379f, 0.366798967f},
-std::array<float,2>{0.852813959f, 0.290640891f},
-std::array<float,2>{0.433974683f, 0.767476678f},
-std::array<float,2>{0.663970709f, 0.630444944f},
-std::array<float,2>{0.0750917718f, 0.054976739f},
-std::array<float,2>{0.507013619f, 0.173948482f},
-std::array<float,2>{0.168838307f, 0.537716806f},
-std::array<float,2>{0.890720189f, 0.958593667f},
-std::array<float,2>{0.349854261f, 0.473553687f},
-std::array<float,2>{0.59111625f, 0.32171315f},
-std::array<float,2>{0.203031212f, 0.815035701f},
-std::array<float,2>{0.956834614f, 0.694164515f},
-std::array<float,2>{0.264242738f, 0.0905443877f},
-std::array<float,2>{0.751969457f, 0.21624811f},
-std::array<float,2>{0.494219601f, 0.585452139f},
-std::array<float,2>{0.723903477f, 0.903801978f},
-std::array<float,2>{0.0400600173f, 0.426202893f},
-std::array<float,2>{0.921255052f, 0.465237707f},
-std::array<float,2>{0.327263921f, 0.984497368f},
-std::array<float,2>{0.553757787f, 0.514811039f},
-std::array<float,2>{0.151197404f, 0.154546976f},
-std::array<float,2>{0.636877298f, 0.00276901689f},
-std::array<float,2>{0.105546184f, 0.667117894f},
-std::array<float,2>{0.817805648f, 0.802323401f},
-std::array<float,2>{0.388872713f, 0.276942521f},
-std::array<float,2>{0.683748126f, 0.265148342f},
-std::array<float,2>{0.089341715f, 0.786910176f},
-std::array<float,2>{0.864981413f, 0.677853346f},
-std::array<float,2>{0.410145253f, 0.0261006709f},
-std::array<float,2>{0.883379757f, 0.138216764f},
-std::array<float,2>{0.369667709f, 0.52137959f},
-std::array<float,2>{0.530421317f, 0.975486517f},
-std::array<float,2>{0.17646718f, 0.439853728f},
-std::array<float,2>{0.782605529f, 0.409135461f},
-std::array<float,2>{0.449378967f, 0.886986792f},
-std::array<float,2>{0.694599986f, 0.565308213f},
-std::array<float,2>{0.0152046271f, 0.192942634f},
-std::array<float,2>{0.611052155f, 0.0676357225f},
-std::array<float,2>{0.224515915f, 0.712494373f},
-std::array<float,2>{0.975233495f, 0.839359283f},
-std::array<float,2>{0.300080836f, 0.335987061f},
-std::array<float,2>{0.546422958f, 0.498678625f},
-std::array<float,2>{0.138402492f, 0.945777893f},
-std::array<float,2>{0.933356464f, 0.558592439f},
-std::array<float,2>{0.33689189f, 0.158805758f},
-std::array<float,2>{0.837737858f, 0.0444441587f},
-std::array<float,2>{0.394025117f, 0.645928204f},
-std::array<float,2>{0.65028131f, 0.761615992f},
-std::array<float,2>{0.11580167f, 0.300557286f},
-std::array<float,2>{0.942213297f, 0.344179869f},
-std::array<float,2>{0.27382195f, 0.850712538f},
-std::array<float,2>{0.574374318f, 0.740331531f},
-std::array<float,2>{0.213789389f, 0.119268909f},
-std::array<float,2>{0.739655375f, 0.227852836f},
-std::array<float,2>{0.0537241623f, 0.616178453f},
-std::array<float,2>{0.768850982f, 0.927938342f},
-std::array<float,2>{0.473655194f, 0.387077332f},
-std::array<float,2>{0.656422198f, 0.420609206f},
-std::array<float,2>{0.0732029825f, 0.881858289f},
-std::array<float,2>{0.85811007f, 0.577623367f},
-std::array<float,2>{0.430470109f, 0.196711227f},
-std::array<float,2>{0.896516621f, 0.0723661557f},
-std::array<float,2>{0.344855189f, 0.704629421f},
-std::array<float,2>{0.50000304f, 0.835263371f},
-std::array<float,2>{0.167296782f, 0.333675474f},
-std::array<float,2>{0.799465537f, 0.251632154f},
-std::array<float,2>{0.468699247f, 0.793582737f},
-std::array<float,2>{0.716700196f, 0.686280787f},
-std::array<float,2>{0.0236191768f, 0.020455353f},
-std::array<float,2>{0.608227015f, 0.131716385f},
-std::array<float,2>{0.240374148f, 0.529838264f},
-std::array<float,2>{0.991418242f, 0.982836843f},
-std::array<float,2>{0.28131181f, 0.452977717f},
-std::array<float,2>{0.550452054f, 0.357431233f},
-std::array<float,2>{0.156088874f, 0.853777766f},
-std::array<float,2>{0.916285336f, 0.746444762f},
-std::array<float,2>{0.322856247f, 0.11048723f},
-std::array<float,2>{0.815271914f, 0.224687621f},
-std::array<float,2>{0.384544045f, 0.619186938f},
-std::array<float,2>{0.635680377f, 0.930259228f},
-std::array<float,2>{0.103933871f, 0.375880122f},
-std::array<float,2>{0.9598158f, 0.487228364f},
-std::array<float,2>{0.258519769f, 0.944608629f},
-std::array<float,2>{0.586119592f, 0.548869848f},
-std::array<float,2>{0.195528924f, 0.170326665f},
-std::array<float,2>{0.721403241f, 0.0332842655f},
-std::array<float,2>{0.046827618f, 0.648651361f},
-std::array<float,2>{0.757166266f, 0.753112555f},
-std::array<float,2>{0.499056011f, 0.308141053f},
-std::array<float,2>{0.690402269f, 0.286534548f},
-std::array<float,2>{0.00950155873f, 0.78046453f},
-std::array<float,2>{0.788944006f, 0.638948202f},
-std::array<float,2>{0.448430598f, 0.0501113385f},
-std::array<float,2>{0.970146358f, 0.182527572f},
-std::array<float,2>{0.303415298f, 0.540280282f},
-std::array<float,2>{0.615683436f, 0.968153894f},
-std::array<float,2>{0.219244555f, 0.481010109f},
-std::array<float,2>{0.861218274f, 0.40605557f},
-std::array<float,2>{0.410302728f, 0.91939038f},
-std::array<float,2>{0.682637215f, 0.595842719f},
-std::array<float,2>{0.0918644965f, 0.239424035f},
-std::array<float,2>{0.52628839f, 0.105661467f},
-std::array<float,2>{0.175384387f, 0.73404628f},
-std::array<float,2>{0.888929069f, 0.865809143f},
-std::array<float,2>{0.373813242f, 0.367308408f},
-std::array<float,2>{0.571794748f, 0.458952069f},
-std::array<float,2>{0.214975879f, 0.996323764f},
-std::array<float,2>{0.939471722f, 0.507095933f},
-std::array<float,2>{0.27983582f, 0.143237859f},
-std::array<float,2>{0.770000815f, 0.0135853216f},
-std::array<float,2>{0.471195549f, 0.664021671f},
-std::array<float,2>{0.736702025f, 0.810427129f},
-std::array<float,2>{0.0483448543f, 0.266352624f},
-std::array<float,2>{0.934807897f, 0.314239353f},
-std::array<float,2>{0.343289584f, 0.826920152f},
-std::array<float,2>{0.540724933f, 0.697255731f},
-std::array<float,2>{0.133271545f, 0.0811511651f},
-std::array<float,2>{0.656054437f, 0.206989169f},
-std::array<float,2>{0.110279113f, 0.588400662f},
-std::array<float,2>{0.840518713f, 0.892386317f},
-std::array<float,2>{0.397512108f, 0.430326253f},
-std::array<float,2>{0.742460132f, 0.46957159f},
-std::array<float,2>{0.0552743562f, 0.953819454f},
-std::array<float,2>{0.777419686f, 0.533915043f},
-std::array<float,2>{0.476814151f, 0.176313609f},
-std::array<float,2>{0.949777484f, 0.0598059632f},
-std::array<float,2>{0.273314804f, 0.625722229f},
-std::array<float,2>{0.569167316f, 0.771963954f},
-std::array<float,2>{0.210628927f, 0.293739825f},
-std::array<float,2>{0.830614626f, 0.362391114f},
-std::array<float,2>{0.398893118f, 0.867336333f},
-std::array<float,2>{0.648198724f, 0.724279106f},
-std::array<float,2>{0.122321658f, 0.0985730067f},
-std::array<float,2>{0.534853637f, 0.249405146f},
-std::array<float,2>{0.129548207f, 0.609289527f},
-std::array<float,2>{0.926497579f, 0.912719965f},
-std::array<float,2>{0.334489644f, 0.395794988f},
-std::array<float,2>{0.617748797f, 0.280756861f},
-std::array<float,2>{0.233758852f, 0.798415601f},
-std::array<float,2>{0.976913989f, 0.671334445f},
-std::array<float,2>{0.307346612f, 0.0062460429f},
-std::array<float,2>{0.794043779f, 0.151670262f},
-std::array<float,2>{0.441380262f, 0.511162877f},
-std::array<float,2>{0.69639504f, 0.989448488f},
-std::array<float,2>{0.00193224079f, 0.461524397f},
-std::array<float,2>{0.878129959f, 0.425765485f},
-std::array<float,2>{0.363675684f, 0.90029645f},
-std::array<float,2>{0.517291665f, 0.578251302f},
-std::array<float,2>{0.185323372f, 0.212956011f},
-std::array<float,2>{0.674502552f, 0.0868816525f},
-std::array<float,2>{0.0819302872f, 0.689149559f},
-std::array<float,2>{0.873092353f, 0.81657654f},
-std::array<float,2>{0.419448853f, 0.327824235f},
-std::array<float,2>{0.630662203f, 0.342254668f},
-std::array<float,2>{0.100003876f, 0.841399014f},
-std::array<float,2>{0.825226009f, 0.715340912f},
-std::array<float,2>{0.380059451f, 0.0662181899f},
-std::array<float,2>{0.907185435f, 0.188549265f},
-std::array<float,2>{0.319853991f, 0.569159567f},
-std::array<float,2>{0.558534622f, 0.884817243f},
-std::array<float,2>{0.14128688f, 0.411309987f},
-std::array<float,2>{0.757876873f, 0.444569945f},
-std::array<float,2>{0.488506347f, 0.972024977f},
-std::array<float,2>{0.730737686f, 0.51577729f},
-std::array<float,2>{0.0345593728f, 0.134487286f},
-std::array<float,2>{0.579058945f, 0.0279297177f},
-std::array<float,2>{0.195107281f, 0.675324023f},
-std::array<float,2>{0.961163998f, 0.782829165f},
-std::array<float,2>{0.254873067f, 0.261552453f},
-std::array<float,2>{0.510709882f, 0.385810226f},
-std::array<float,2>{0.158441991f, 0.922624826f},
-std::array<float,2>{0.900061548f, 0.611682415f},
-std::array<float,2>{0.354354054f, 0.230721861f},
-std::array<float,2>{0.848279834f, 0.12130028f},
-std::array<float,2>{0.422561735f, 0.734471321f},
-std::array<float,2>{0.669294298f, 0.847336054f},
-std::array<float,2>{0.0665393323f, 0.350946188f},
-std::array<float,2>{0.99596411f, 0.304514527f},
-std::array<float,2>{0.291225076f, 0.763194621f},
-std::array<float,2>{0.596450925f, 0.641397715f},
-std::array<float,2>{0.242404193f, 0.0407380536f},
-std::array<float,2>{0.708354533f, 0.161209568f},
-std::array<float,2>{0.0201754998f, 0.559091032f},
-std::array<float,2>{0.804783225f, 0.953073561f},
-std::array<float,2>{0.454237193f, 0.493576199f},
-std::array<float,2>{0.66718787f, 0.456146508f},
-std::array<float,2>{0.0636757687f, 0.994939327f},
-std::array<float,2>{0.846540749f, 0.502486885f},
-std::array<float,2>{0.426615626f, 0.146692932f},
-std::array<float,2>{0.902757525f, 0.00817406364f},
-std::array<float,2>{0.35891965f, 0.658326745f},
-std::array<float,2>{0.513674855f, 0.80853498f},
-std::array<float,2>{0.163059011f, 0.271574795f},
-std::array<float,2>{0.811236501f, 0.316642165f},
-std::array<float,2>{0.460147321f, 0.820450664f},
-std::array<float,2>{0.703839064f, 0.699514806f},
-std::array<float,2>{0.017840758f, 0.0821351185f},
-std::array<float,2>{0.597869575f, 0.207224101f},
-std::array<float,2>{0.247638986f, 0.590195239f},
-std::array<float,2>{0.999008775f, 0.896640241f},
-std::array<float,2>{0.293649197f, 0.436126828f},
-std::array<float,2>{0.561950803f, 0.283242851f},
-std::array<float,2>{0.147918463f, 0.774831235f},
-std::array<float,2>{0.913270414f, 0.63534385f},
-std::array<float,2>{0.31293568f, 0.0529946573f},
-std::array<float,2>{0.822245121f, 0.185925916f},
-std::array<float,2>{0.377282798f, 0.54439497f},
-std::array<float,2>{0.626308978f, 0.964366913f},
-std::array<float,2>{0.0972013995f, 0.478760064f},
-std::array<float,2>{0.967908502f, 0.400696218f},
-std::array<float,2>{0.251521736f, 0.915708125f},
-std::array<float,2>{0.583860397f, 0.597791135f},
-std::array<float,2>{0.188527524f, 0.238261148f},
-std::array<float,2>{0.727568924f, 0.103106864f},
-std::array<float,2>{0.0376494527f, 0.726623237f},
-std::array<float,2>{0.764814317f, 0.862090886f},
-std::array<float,2>{0.486909419f, 0.374687761f},
-std::array<float,2>{0.699861765f, 0.352362871f},
-std::array<float,2>{0.00653376477f, 0.85851723f},
-std::array<float,2>{0.789170265f, 0.744099855f},
-std::array<float,2>{0.444232821f, 0.116709359f},
-std::array<float,2>{0.982683778f, 0.222454667f},
-std::array<float,2>{0.312416404f, 0.621665239f},
-std::array<float,2>{0.624552906f, 0.935901105f},
-std::array<float,2>{0.229725614f, 0.380958617f},
-std::array<float,2>{0.870433629f, 0.492035925f},
-std::array<float,2>{0.415758997f, 0.941108704f},
-std::array<float,2>{0.679360688f, 0.552453876f},
-std::array<float,2>{0.0856789127f, 0.165306658f},
-std::array<float,2>{0.522458494f, 0.0363249183f},
-std::array<float,2>{0.179838464f, 0.655967236f},
-std::array<float,2>{0.879453301f, 0.756003141f},
-std::array<float,2>{0.360048145f, 0.311603218f},
-std::array<float,2>{0.56635797f, 0.414886087f},
-std::array<float,2>{0.204451337f, 0.875586569f},
-std::array<float,2>{0.945641994f, 0.570627809f},
-std::array<float,2>{0.268453538f, 0.199313968f},
-std::array<float,2>{0.776121318f, 0.077255547f},
-std::array<float,2>{0.484183013f, 0.709929049f},
-std::array<float,2>{0.74840337f, 0.828923404f},
-std::array<float,2>{0.0601387136f, 0.329405308f},
-std::array<float,2>{0.922689676f, 0.256948739f},
-std::array<float,2>{0.331020474f, 0.789131045f},
-std::array<float,2>{0.535558701f, 0.681240559f},
-std::array<float,2>{0.12560311f, 0.0183757152f},
-std::array<float,2>{0.643636882f, 0.125215858f},
-std::array<float,2>{0.120311588f, 0.523988128f},
-std::array<float,2>{0.832552373f, 0.978155911f},
-std::array<float,2>{0.40342772f, 0.447111905f},
-std::array<float,2>{0.741480887f, 0.387799948f},
-std::array<float,2>{0.0524968579f, 0.929683447f},
-std::array<float,2>{0.766723096f, 0.616425276f},
-std::array<float,2>{0.474982738f, 0.22749868f},
-std::array<float,2>{0.944898546f, 0.120725669f},
-std::array<float,2>{0.276985079f, 0.742027462f},
-std::array<float,2>{0.577770174f, 0.850386202f},
-std::array<float,2>{0.211027652f, 0.345196962f},
-std::array<float,2>{0.838783741f, 0.299712807f},
-std::array<float,2>{0.3922171f, 0.759921372f},
-std::array<float,2>{0.650582373f, 0.645433009f},
-std::array<float,2>{0.114270598f, 0.0433955491f},
-std::array<float,2>{0.543060064f, 0.159493282f},
-std::array<float,2>{0.139027849f, 0.557134509f},
-std::array<float,2>{0.931323886f, 0.946636319f},
-std::array<float,2>{0.339773029f, 0.499758869f},
-std::array<float,2>{0.613044381f, 0.337264508f},
-std::array<float,2>{0.225248247f, 0.838357449f},
-std::array<float,2>{0.973938763f, 0.711302459f},
-std::array<float,2>{0.297321439f, 0.0668073744f},
-std::array<float,2>{0.783383787f, 0.191481799f},
-std::array<float,2>{0.451740742f, 0.565793216f},
-std::array<float,2>{0.693242073f, 0.888362169f},
-std::array<float,2>{0.013553354f, 0.409263819f},
-std::array<float,2>{0.88630712f, 0.441328377f},
-std::array<float,2>{0.368383259f, 0.976344764f},
-std::array<float,2>{0.529129505f, 0.519720674f},
-std::array<float,2>{0.178155765f, 0.136766151f},
-std::array<float,2>{0.687148571f, 0.0272569302f},
-std::array<float,2>{0.0874816552f, 0.678919137f},
-std::array<float,2>{0.865633488f, 0.785603523f},
-std::array<float,2>{0.406828612f, 0.264406234f},
-std::array<float,2>{0.639182985f, 0.275552958f},
-std::array<float,2>{0.108371064f, 0.80086875f},
-std::array<float,2>{0.819562078f, 0.666584194f},
-std::array<float,2>{0.388567805f, 0.00368368276f},
-std::array<float,2>{0.919420838f, 0.155389324f},
-std::array<float,2>{0.325487763f, 0.513690889f},
-std::array<float,2>{0.550801992f, 0.98629415f},
-std::array<float,2>{0.149378777f, 0.466187119f},
-std::array<float,2>{0.750156403f, 0.426782399f},
-std::array<float,2>{0.493870109f, 0.903180063f},
-std::array<float,2>{0.72520262f, 0.584181786f},
-std::array<float,2>{0.0423716418f, 0.215148762f},
-std::array<float,2>{0.592788577f, 0.0910721496f},
-std::array<float,2>{0.201094359f, 0.695058227f},
-std::array<float,2>{0.954535782f, 0.816202402f},
-std::array<float,2>{0.263224483f, 0.320404202f},
-std::array<float,2>{0.504752576f, 0.474511236f},
-std::array<float,2>{0.17162551f, 0.957492471f},
-std::array<float,2>{0.892867208f, 0.538411915f},
-std::array<float,2>{0.349324733f, 0.175018266f},
-std::array<float,2>{0.855063558f, 0.0558226034f},
-std::array<float,2>{0.437157899f, 0.629460216f},
-std::array<float,2>{0.660566568f, 0.76564461f},
-std::array<float,2>{0.0777440593f, 0.289664418f},
-std::array<float,2>{0.98448205f, 0.36620611f},
-std::array<float,2>{0.288467586f, 0.873393118f},
-std::array<float,2>{0.603161573f, 0.719741046f},
-std::array<float,2>{0.237918079f, 0.0960723013f},
-std::array<float,2>{0.711524487f, 0.24338007f},
-std::array<float,2>{0.0307289083f, 0.602420866f},
-std::array<float,2>{0.803053975f, 0.907411516f},
-std::array<float,2>{0.463045269f, 0.392072529f},
-std::array<float,2>{0.653697014f, 0.431106448f},
-std::array<float,2>{0.111690387f, 0.891166985f},
-std::array<float,2>{0.842265785f, 0.589182794f},
-std::array<float,2>{0.395989925f, 0.20541203f},
-std::array<float,2>{0.935647905f, 0.0801204666f},
-std::array<float,2>{0.340761513f, 0.695647895f},
-std::array<float,2>{0.54240936f, 0.827746511f},
-std::array<float,2>{0.136542439f, 0.313311517f},
-std::array<float,2>{0.773433506f, 0.267312229f},
-std::array<float,2>{0.470074475f, 0.809414387f},
-std::array<float,2>{0.73594135f, 0.662733376f},
-std::array<float,2>{0.0494449697f, 0.0123051023f},
-std::array<float,2>{0.57375437f, 0.144503623f},
-std::array<float,2>{0.217429802f, 0.506362736f},
-std::array<float,2>{0.938029051f, 0.997731447f},
-std::array<float,2>{0.278246611f, 0.457237035f},
-std::array<float,2>{0.525295079f, 0.368528903f},
-std::array<float,2>{0.173284024f, 0.86654067f},
-std::array<float,2>{0.888272524f, 0.732542515f},
-std::array<float,2>{0.371508181f, 0.10682907f},
-std::array<float,2>{0.862546742f, 0.239089578f},
-std::array<float,2>{0.413362026f, 0.597051024f},
-std::array<float,2>{0.680019915f, 0.918902576f},
-std::array<float,2>{0.0910207927f, 0.404829025f},
-std::array<float,2>{0.971388817f, 0.482090592f},
-std::array<float,2>{0.302580744f, 0.966991007f},
-std::array<float,2>{0.613923848f, 0.539864659f},
-std::array<float,2>{0.221270353f, 0.183536679f},
-std::array<float,2>{0.6893273f, 0.0495032258f},
-std::array<float,2>{0.0106910001f, 0.639738321f},
-std::array<float,2>{0.786656499f, 0.779743612f},
-std::array<float,2>{0.446029514f, 0.285886049f},
-std::array<float,2>{0.719214618f, 0.307282597f},
-std::array<float,2>{0.0436175056f, 0.752850115f},
-std::array<float,2>{0.754483938f, 0.65020299f},
-std::array<float,2>{0.497644663f, 0.0343133956f},
-std::array<float,2>{0.957749486f, 0.171379462f},
-std::array<float,2>{0.261373043f, 0.549974978f},
-std::array<float,2>{0.589084625f, 0.943413258f},
-std::array<float,2>{0.197364569f, 0.487575978f},
-std::array<float,2>{0.813394189f, 0.37618196f},
-std::array<float,2>{0.386296749f, 0.930808723f},
-std::array<float,2>{0.633581638f, 0.620410144f},
-std::array<float,2>{0.101778395f, 0.226480886f},
-std::array<float,2>{0.547663391f, 0.10970591f},
-std::array<float,2>{0.152684763f, 0.747854352f},
-std::array<float,2>{0.91539222f, 0.854794145f},
-std::array<float,2>{0.321118683f, 0.359094232f},
-std::array<float,2>{0.606982291f, 0.452079684f},
-std::array<float,2>{0.238599449f, 0.984037995f},
-std::array<float,2>{0.989915967f, 0.530279636f},
-std::array<float,2>{0.283220351f, 0.131880254f},
-std::array<float,2>{0.797413051f, 0.0205435175f},
-std::array<float,2>{0.466591269f, 0.687243104f},
-std::array<float,2>{0.717555165f, 0.794822276f},
-std::array<float,2>{0.0264954828f, 0.250561804f},
-std::array<float,2>{0.896382272f, 0.332654357f},
-std::array<float,2>{0.347619653f, 0.834516048f},
-std::array<float,2>{0.502871513f, 0.70343715f},
-std::array<float,2>{0.165354773f, 0.0741753802f},
-std::array<float,2>{0.658298731f, 0.195479691f},
-std::array<float,2>{0.0714843795f, 0.577138245f},
-std::array<float,2>{0.857369721f, 0.881509781f},
-std::array<float,2>{0.433494359f, 0.421111017f},
-std::array<float,2>{0.710045457f, 0.493118674f},
-std::array<float,2>{0.0229699723f, 0.951362908f},
-std::array<float,2>{0.807825029f, 0.560204268f},
-std::array<float,2>{0.45612219f, 0.160732791f},
-std::array<float,2>{0.993955374f, 0.0394716114f},
-std::array<float,2>{0.289071649f, 0.642081261f},
-std::array<float,2>{0.593815088f, 0.762250245f},
-std::array<float,2>{0.24478595f, 0.303255647f},
-std::array<float,2>{0.850542426f, 0.349714905f},
-std::array<float,2>{0.424643993f, 0.845808744f},
-std::array<float,2>{0.670117617f, 0.736164749f},
-std::array<float,2>{0.0692638159f, 0.122748829f},
-std::array<float,2>{0.508081555f, 0.232114092f},
-std::array<float,2>{0.157525986f, 0.61249727f},
-std::array<float,2>{0.900954306f, 0.92371279f},
-std::array<float,2>{0.351618111f, 0.385662138f},
-std::array<float,2>{0.580910146f, 0.260516852f},
-std::array<float,2>{0.191516191f, 0.781469882f},
-std::array<float,2>{0.963937223f, 0.674356341f},
-std::array<float,2>{0.257305741f, 0.0283687916f},
-std::array<float,2>{0.760262191f, 0.133447006f},
-std::array<float,2>{0.491336972f, 0.517400324f},
-std::array<float,2>{0.7338202f, 0.971678257f},
-std::array<float,2>{0.0326880142f, 0.443616122f},
-std::array<float,2>{0.909218252f, 0.410760373f},
-std::array<float,2>{0.316494435f, 0.885906875f},
-std::array<float,2>{0.554781556f, 0.569906175f},
-std::array<float,2>{0.144370601f, 0.188404828f},
-std::array<float,2>{0.632647097f, 0.0647272915f},
-std::array<float,2>{0.0995162576f, 0.715847015f},
-std::array<float,2>{0.827564597f, 0.840700805f},
-std::array<float,2>{0.381346405f, 0.342855662f},
-std::array<float,2>{0.673388064f, 0.326900184f},
-std::array<float,2>{0.0789267197f, 0.81748271f},
-std::array<float,2>{0.872206509f, 0.688262641f},
-std::array<float,2>{0.420552492f, 0.0878515095f},
-std::array<float,2>{0.876665056f, 0.2140131f},
-std::array<float,2>{0.366604477f, 0.579374313f},
-std::array<float,2>{0.517827272f, 0.89875412f},
-std::array<float,2>{0.186377212f, 0.424782068f},
-std::array<float,2>{0.796797037f, 0.462548137f},
-std::array<float,2>{0.438617557f, 0.988955915f},
-std::array<float,2>{0.699095666f, 0.5103091f},
-std::array<float,2>{0.00281513273f, 0.150601357f},
-std::array<float,2>{0.619247794f, 0.00719142612f},
-std::array<float,2>{0.231220081f, 0.670811474f},
-std::array<float,2>{0.980133474f, 0.797733843f},
-std::array<float,2>{0.306239218f, 0.279520869f},
-std::array<float,2>{0.533111274f, 0.395195127f},
-std::array<float,2>{0.131806314f, 0.913834274f},
-std::array<float,2>{0.928297758f, 0.607833445f},
-std::array<float,2>{0.333269417f, 0.24859941f},
-std::array<float,2>{0.828274727f, 0.0989214033f},
-std::array<float,2>{0.40043804f, 0.723362327f},
-std::array<float,2>{0.6459409f, 0.868675113f},
-std::array<float,2>{0.124880217f, 0.361608297f},
-std::array<float,2>{0.951717079f, 0.294511199f},
-std::array<float,2>{0.270666003f, 0.773203194f},
-std::array<float,2>{0.566480994f, 0.626474559f},
-std::array<float,2>{0.207253635f, 0.0593473576f},
-std::array<float,2>{0.745366633f, 0.177424684f},
-std::array<float,2>{0.0578940921f, 0.534653544f},
-std::array<float,2>{0.781198502f, 0.954852164f},
-std::array<float,2>{0.479127318f, 0.470338792f},
-std::array<float,2>{0.628629088f, 0.477252901f},
-std::array<float,2>{0.0948794335f, 0.961230874f},
-std::array<float,2>{0.822982192f, 0.54511559f},
-std::array<float,2>{0.375271827f, 0.184148088f},
-std::array<float,2>{0.910968482f, 0.0516547263f},
-std::array<float,2>{0.315090716f, 0.634563923f},
-std::array<float,2>{0.560269117f, 0.775468647f},
-std::array<float,2>{0.144663528f, 0.282548398f},
-std::array<float,2>{0.762716532f, 0.372339159f},
-std::array<float,2>{0.484655559f, 0.859548032f},
-std::array<float,2>{0.729562044f, 0.729901373f},
-std::array<float,2>{0.0354057178f, 0.105064481f},
-std::array<float,2>{0.584846556f, 0.235481411f},
-std::array<float,2>{0.190504223f, 0.600524127f},
-std::array<float,2>{0.964981437f, 0.916517556f},
-std::array<float,2>{0.253339916f, 0.398733705f},
-std::array<float,2>{0.512781978f, 0.270049453f},
-std::array<float,2>{0.161196232f, 0.80631417f},
-std::array<float,2>{0.905213654f, 0.656858861f},
-std::array<float,2>{0.357114851f, 0.00980101433f},
-std::array<float,2>{0.845441818f, 0.144574374f},
-std::array<float,2>{0.427854776f, 0.501866996f},
-std::array<float,2>{0.664821327f, 0.993398845f},
-std::array<float,2>{0.0650537089f, 0.454022467f},
-std::array<float,2>{0.996913612f, 0.434467226f},
-std::array<float,2>{0.29541862f, 0.894812584f},
-std::array<float,2>{0.600744069f, 0.59191674f},
-std::array<float,2>{0.248202458f, 0.210241422f},
-std::array<float,2>{0.706097245f, 0.0855362043f},
-std::array<float,2>{0.0169236455f, 0.702061713f},
-std::array<float,2>{0.80927968f, 0.82256031f},
-std::array<float,2>{0.457075f, 0.320114911f},
-std::array<float,2>{0.746975422f, 0.331290364f},
-std::array<float,2>{0.0609687902f, 0.8303321f},
-std::array<float,2>{0.774532437f, 0.707457781f},
-std::array<float,2>{0.481707215f, 0.0752954185f},
-std::array<float,2>{0.948592961f, 0.202942103f},
-std::array<float,2>{0.267023802f, 0.573766768f},
-std::array<float,2>{0.562703967f, 0.878105342f},
-std::array<float,2>{0.205891669f, 0.416209728f},
-std::array<float,2>{0.835723042f, 0.448166758f},
-std::array<float,2>{0.405054063f, 0.979663014f},
-std::array<float,2>{0.641799033f, 0.526772738f},
-std::array<float,2>{0.119081736f, 0.128888071f},
-std::array<float,2>{0.538086712f, 0.0158945844f},
-std::array<float,2>{0.127477944f, 0.683073819f},
-std::array<float,2>{0.925079882f, 0.792224705f},
-std::array<float,2>{0.329447031f, 0.253986388f},
-std::array<float,2>{0.622838795f, 0.380505681f},
-std::array<float,2>{0.22821255f, 0.934764802f},
-std::array<float,2>{0.981803834f, 0.623552918f},
-std::array<float,2>{0.309767574f, 0.219125643f},
-std::array<float,2>{0.79239291f, 0.113996103f},
-std::array<float,2>{0.442776859f, 0.744802117f},
-std::array<float,2>{0.702100515f, 0.855495036f},
-std::array<float,2>{0.00402157241f, 0.354583621f},
-std::array<float,2>{0.881360888f, 0.309167206f},
-std::array<float,2>{0.361933589f, 0.755446672f},
-std::array<float,2>{0.520017087f, 0.652504742f},
-std::array<float,2>{0.182274461f, 0.0387710035f},
-std::array<float,2>{0.676672578f, 0.16756545f},
-std::array<float,2>{0.0826785043f, 0.553366065f},
-std::array<float,2>{0.868076384f, 0.937984884f},
-std::array<float,2>{0.417130589f, 0.490038931f},
-std::array<float,2>{0.693931282f, 0.407401711f},
-std::array<float,2>{0.014044418f, 0.888950348f},
-std::array<float,2>{0.781952083f, 0.56431824f},
-std::array<float,2>{0.450976461f, 0.194004461f},
-std::array<float,2>{0.975793898f, 0.0686638728f},
-std::array<float,2>{0.299280137f, 0.713762462f},
-std::array<float,2>{0.610259652f, 0.837154984f},
-std::array<float,2>{0.222972929f, 0.339363813f},
-std::array<float,2>{0.863960922f, 0.262448788f},
-std::array<float,2>{0.408298969f, 0.788900495f},
-std::array<float,2>{0.684746325f, 0.67720753f},
-std::array<float,2>{0.0879158601f, 0.0245444868f},
-std::array<float,2>{0.529826343f, 0.140551135f},
-std::array<float,2>{0.176826239f, 0.523062587f},
-std::array<float,2>{0.88454926f, 0.973789871f},
-std::array<float,2>{0.370518267f, 0.438781768f},
-std::array<float,2>{0.575985074f, 0.347256631f},
-std::array<float,2>{0.213891312f, 0.84924078f},
-std::array<float,2>{0.942658722f, 0.739008844f},
-std::array<float,2>{0.275125444f, 0.119042464f},
-std::array<float,2>{0.767685473f, 0.228742644f},
-std::array<float,2>{0.473469585f, 0.613957524f},
-std::array<float,2>{0.738692164f, 0.926208079f},
-std::array<float,2>{0.0534553491f, 0.390236378f},
-std::array<float,2>{0.932286918f, 0.496124834f},
-std::array<float,2>{0.337531865f, 0.949179173f},
-std::array<float,2>{0.54498136f, 0.55521965f},
-std::array<float,2>{0.136808977f, 0.156347737f},
-std::array<float,2>{0.649072826f, 0.0458421521f},
-std::array<float,2>{0.116614297f, 0.647149146f},
-std::array<float,2>{0.83628422f, 0.75920403f},
-std::array<float,2>{0.393214464f, 0.297745705f},
-std::array<float,2>{0.66229409f, 0.292583704f},
-std::array<float,2>{0.0758778602f, 0.769275606f},
-std::array<float,2>{0.851852119f, 0.631279647f},
-std::array<float,2>{0.434579134f, 0.0583069846f},
-std::array<float,2>{0.892472565f, 0.172825649f},
-std::array<float,2>{0.350934058f, 0.536995173f},
-std::array<float,2>{0.506381094f, 0.959534049f},
-std::array<float,2>{0.169181779f, 0.475513071f},
-std::array<float,2>{0.801973641f, 0.393003762f},
-std::array<float,2>{0.461616874f, 0.908926845f},
-std::array<float,2>{0.713708162f, 0.604748487f},
-std::array<float,2>{0.028453229f, 0.245631978f},
-std::array<float,2>{0.605356395f, 0.0942879543f},
-std::array<float,2>{0.235581383f, 0.722167969f},
-std::array<float,2>{0.986738086f, 0.871225476f},
-std::array<float,2>{0.286968261f, 0.363724768f},
-std::array<float,2>{0.553381741f, 0.468158007f},
-std::array<float,2>{0.151491657f, 0.986505389f},
-std::array<float,2>{0.919982791f, 0.512438357f},
-std::array<float,2>{0.326573968f, 0.152888089f},
-std::array<float,2>{0.816989362f, 0.0019435765f},
-std::array<float,2>{0.390021056f, 0.664919555f},
-std::array<float,2>{0.638116896f, 0.803084433f},
-std::array<float,2>{0.107114516f, 0.275372744f},
-std::array<float,2>{0.955723763f, 0.324080676f},
-std::array<float,2>{0.2651546f, 0.812883973f},
-std::array<float,2>{0.590683997f, 0.692781746f},
-std::array<float,2>{0.202099502f, 0.0926752388f},
-std::array<float,2>{0.722928107f, 0.218147591f},
-std::array<float,2>{0.0394470543f, 0.583703995f},
-std::array<float,2>{0.753443599f, 0.905878663f},
-std::array<float,2>{0.495719463f, 0.427784294f},
-std::array<float,2>{0.682605624f, 0.403823107f},
-std::array<float,2>{0.0935586318f, 0.920663118f},
-std::array<float,2>{0.859430194f, 0.595354974f},
-std::array<float,2>{0.411618412f, 0.240804568f},
-std::array<float,2>{0.890187681f, 0.107669957f},
-std::array<float,2>{0.374465436f, 0.731796861f},
-std::array<float,2>{0.526492655f, 0.863836884f},
-std::array<float,2>{0.174725682f, 0.370661139f},
-std::array<float,2>{0.788025618f, 0.287621737f},
-std::array<float,2>{0.447270006f, 0.779026985f},
-std::array<float,2>{0.690678477f, 0.638197601f},
-std::array<float,2>{0.0085963672f, 0.0470271297f},
-std::array<float,2>{0.616622031f, 0.180682063f},
-std::array<float,2>{0.220120743f, 0.542759538f},
-std::array<float,2>{0.969712913f, 0.965572655f},
-std::array<float,2>{0.303932756f, 0.483628273f},
-std::array<float,2>{0.539497733f, 0.315730363f},
-std::array<float,2>{0.134493753f, 0.824735284f},
-std::array<float,2>{0.933972776f, 0.697800398f},
-std::array<float,2>{0.341836005f, 0.0792331323f},
-std::array<float,2>{0.841706514f, 0.204113007f},
-std::array<float,2>{0.397339135f, 0.587204635f},
-std::array<float,2>{0.655154586f, 0.892823637f},
-std::array<float,2>{0.110654391f, 0.432327181f},
-std::array<float,2>{0.940801322f, 0.459169745f},
-std::array<float,2>{0.281107813f, 0.999076009f},
-std::array<float,2>{0.570393503f, 0.504786432f},
-std::array<float,2>{0.216344073f, 0.142286941f},
-std::array<float,2>{0.737855494f, 0.0149122505f},
-std::array<float,2>{0.0469947122f, 0.661582053f},
-std::array<float,2>{0.771456301f, 0.810813069f},
-std::array<float,2>{0.472033978f, 0.269445479f},
-std::array<float,2>{0.715224564f, 0.253328115f},
-std::array<float,2>{0.0244271774f, 0.795627952f},
-std::array<float,2>{0.799871743f, 0.684737146f},
-std::array<float,2>{0.467280716f, 0.0219514817f},
-std::array<float,2>{0.990436375f, 0.130173787f},
-std::array<float,2>{0.283011675f, 0.529053271f},
-std::array<float,2>{0.609256208f, 0.98107183f},
-std::array<float,2>{0.241937235f, 0.450612992f},
-std::array<float,2>{0.859196126f, 0.41962114f},
-std::array<float,2>{0.431518972f, 0.880773485f},
-std::array<float,2>{0.657647431f, 0.574669838f},
-std::array<float,2>{0.0733766034f, 0.198901787f},
-std::array<float,2>{0.501863599f, 0.0708620325f},
-std::array<float,2>{0.166235298f, 0.705125809f},
-std::array<float,2>{0.89839536f, 0.83384639f},
-std::array<float,2>{0.344250053f, 0.334171951f},
-std::array<float,2>{0.58758837f, 0.486283451f},
-std::array<float,2>{0.197121039f, 0.942011118f},
-std::array<float,2>{0.960046113f, 0.546984315f},
-std::array<float,2>{0.259558469f, 0.169759557f},
-std::array<float,2>{0.756286919f, 0.0315495171f},
-std::array<float,2>{0.498951823f, 0.651636362f},
-std::array<float,2>{0.722551465f, 0.751828372f},
-std::array<float,2>{0.0458582714f, 0.305693477f},
-std::array<float,2>{0.917851031f, 0.357028663f},
-std::array<float,2>{0.323474944f, 0.853487492f},
-std::array<float,2>{0.549648404f, 0.749214232f},
-std::array<float,2>{0.154724151f, 0.112502865f},
-std::array<float,2>{0.635798395f, 0.223332867f},
-std::array<float,2>{0.105023809f, 0.61892283f},
-std::array<float,2>{0.815618157f, 0.933166921f},
-std::array<float,2>{0.383563906f, 0.377914369f},
-std::array<float,2>{0.732229233f, 0.44162944f},
-std::array<float,2>{0.0333132744f, 0.969948411f},
-std::array<float,2>{0.759527862f, 0.518654644f},
-std::array<float,2>{0.490052342f, 0.136028424f},
-std::array<float,2>{0.961931884f, 0.0302914288f},
-std::array<float,2>{0.255777389f, 0.672133923f},
-std::array<float,2>{0.579291582f, 0.783338368f},
-std::array<float,2>{0.194312245f, 0.258910954f},
-std::array<float,2>{0.824405551f, 0.341206014f},
-std::array<float,2>{0.379048347f, 0.84360677f},
-std::array<float,2>{0.629296899f, 0.718213975f},
-std::array<float,2>{0.101104952f, 0.0638649613f},
-std::array<float,2>{0.557308376f, 0.190536663f},
-std::array<float,2>{0.142347366f, 0.567171514f},
-std::array<float,2>{0.907988012f, 0.884031773f},
-std::array<float,2>{0.318769723f, 0.412953079f},
-std::array<float,2>{0.596884966f, 0.301862389f},
-std::array<float,2>{0.243627906f, 0.765307903f},
-std::array<float,2>{0.994821787f, 0.642579794f},
-std::array<float,2>{0.292938709f, 0.0418350287f},
-std::array<float,2>{0.806291044f, 0.162956551f},
-std::array<float,2>{0.454048872f, 0.560639024f},
-std::array<float,2>{0.707402408f, 0.950708151f},
-std::array<float,2>{0.0213726256f, 0.495283902f},
-std::array<float,2>{0.898635507f, 0.383524448f},
-std::array<float,2>{0.355225265f, 0.92514199f},
-std::array<float,2>{0.510770619f, 0.610100985f},
-std::array<float,2>{0.159762502f, 0.233646825f},
-std::array<float,2>{0.668330252f, 0.123434193f},
-std::array<float,2>{0.0678192154f, 0.736669242f},
-std::array<float,2>{0.848664165f, 0.8454988f},
-std::array<float,2>{0.423690081f, 0.348890275f},
-std::array<float,2>{0.647365212f, 0.360516578f},
-std::array<float,2>{0.121208452f, 0.870107174f},
-std::array<float,2>{0.831136763f, 0.726268351f},
-std::array<float,2>{0.400244117f, 0.100786261f},
-std::array<float,2>{0.927163839f, 0.247178778f},
-std::array<float,2>{0.335572213f, 0.606725037f},
-std::array<float,2>{0.533720016f, 0.910364211f},
-std::array<float,2>{0.130044386f, 0.398086101f},
-std::array<float,2>{0.778550327f, 0.472655535f},
-std::array<float,2>{0.478471637f, 0.955872655f},
-std::array<float,2>{0.743967652f, 0.532790065f},
-std::array<float,2>{0.0559222996f, 0.178648964f},
-std::array<float,2>{0.570287168f, 0.0617800318f},
-std::array<float,2>{0.209359869f, 0.628249645f},
-std::array<float,2>{0.950676441f, 0.771087885f},
-std::array<float,2>{0.272218049f, 0.295104146f},
-std::array<float,2>{0.515894949f, 0.422810197f},
-std::array<float,2>{0.18446748f, 0.901607633f},
-std::array<float,2>{0.877531528f, 0.580397785f},
-std::array<float,2>{0.364449829f, 0.212298021f},
-std::array<float,2>{0.874120831f, 0.0895908326f},
-std::array<float,2>{0.41879651f, 0.690270901f},
-std::array<float,2>{0.675077617f, 0.819455087f},
-std::array<float,2>{0.0805551484f, 0.325374663f},
-std::array<float,2>{0.977894187f, 0.278939575f},
-std::array<float,2>{0.308443516f, 0.799074411f},
-std::array<float,2>{0.618900001f, 0.668844104f},
-std::array<float,2>{0.233334407f, 0.00435138168f},
-std::array<float,2>{0.695508718f, 0.149840027f},
-std::array<float,2>{0.000249826291f, 0.507851958f},
-std::array<float,2>{0.793392837f, 0.991898596f},
-std::array<float,2>{0.440352231f, 0.464049339f},
-std::array<float,2>{0.660710573f, 0.475016326f},
-std::array<float,2>{0.0775613487f, 0.958985806f},
-std::array<float,2>{0.854904413f, 0.53634125f},
-std::array<float,2>{0.436955541f, 0.172263786f},
-std::array<float,2>{0.893406093f, 0.0578409359f},
-std::array<float,2>{0.348764777f, 0.631648004f},
-std::array<float,2>{0.503930449f, 0.76875633f},
-std::array<float,2>{0.171051249f, 0.292022705f},
-std::array<float,2>{0.803363025f, 0.36379692f},
-std::array<float,2>{0.463736713f, 0.87206459f},
-std::array<float,2>{0.711208522f, 0.722156405f},
-std::array<float,2>{0.0311821513f, 0.0938443616f},
-std::array<float,2>{0.602983117f, 0.245233521f},
-std::array<float,2>{0.237763107f, 0.605019391f},
-std::array<float,2>{0.985093296f, 0.908615172f},
-std::array<float,2>{0.288591564f, 0.39314425f},
-std::array<float,2>{0.551440716f, 0.274435073f},
-std::array<float,2>{0.148905233f, 0.8035689f},
-std::array<float,2>{0.919853389f, 0.664335132f},
-std::array<float,2>{0.325937271f, 0.00106775982f},
-std::array<float,2>{0.820239246f, 0.152705744f},
-std::array<float,2>{0.388133794f, 0.512187004f},
-std::array<float,2>{0.639080226f, 0.986820579f},
-std::array<float,2>{0.107481129f, 0.468313217f},
-std::array<float,2>{0.954639971f, 0.428348601f},
-std::array<float,2>{0.262723923f, 0.905646563f},
-std::array<float,2>{0.593594909f, 0.583444774f},
-std::array<float,2>{0.200666815f, 0.218612403f},
-std::array<float,2>{0.724991918f, 0.0918867812f},
-std::array<float,2>{0.0424885973f, 0.693333089f},
-std::array<float,2>{0.750772536f, 0.813430309f},
-std::array<float,2>{0.49363184f, 0.32327038f},
-std::array<float,2>{0.692625284f, 0.339254767f},
-std::array<float,2>{0.0131569644f, 0.837404191f},
-std::array<float,2>{0.784136713f, 0.713108361f},
-std::array<float,2>{0.451328427f, 0.0692924634f},
-std::array<float,2>{0.974298358f, 0.193640307f},
-std::array<float,2>{0.297632337f, 0.563861907f},
-std::array<float,2>{0.612436831f, 0.889206171f},
-std::array<float,2>{0.224890113f, 0.408153743f},
-std::array<float,2>{0.866095901f, 0.439412832f},
-std::array<float,2>{0.406558514f, 0.974368274f},
-std::array<float,2>{0.6865592f, 0.522493362f},
-std::array<float,2>{0.0871608406f, 0.14011392f},
-std::array<float,2>{0.528805852f, 0.0253172163f},
-std::array<float,2>{0.178244472f, 0.677568793f},
-std::array<float,2>{0.885994554f, 0.788475037f},
-std::array<float,2>{0.368912876f, 0.261946112f},
-std::array<float,2>{0.57757771f, 0.390064836f},
-std::array<float,2>{0.211856142f, 0.926450789f},
-std::array<float,2>{0.944774389f, 0.613462508f},
-std::array<float,2>{0.276590496f, 0.229310304f},
-std::array<float,2>{0.767526209f, 0.118434191f},
-std::array<float,2>{0.475427955f, 0.738493443f},
-std::array<float,2>{0.741972446f, 0.84865737f},
-std::array<float,2>{0.051960282f, 0.346972406f},
-std::array<float,2>{0.931139588f, 0.297269851f},
-std::array<float,2>{0.338927984f, 0.759481847f},
-std::array<float,2>{0.543828547f, 0.646618128f},
-std::array<float,2>{0.139251202f, 0.0450258814f},
-std::array<float,2>{0.651161551f, 0.157158688f},
-std::array<float,2>{0.114910379f, 0.554813445f},
-std::array<float,2>{0.838228881f, 0.948630691f},
-std::array<float,2>{0.391628295f, 0.496963173f},
-std::array<float,2>{0.748775065f, 0.416658491f},
-std::array<float,2>{0.0597510152f, 0.878590047f},
-std::array<float,2>{0.775455356f, 0.573542058f},
-std::array<float,2>{0.483751893f, 0.202418521f},
-std::array<float,2>{0.946102679f, 0.0758449435f},
-std::array<float,2>{0.267879784f, 0.707604587f},
-std::array<float,2>{0.565804422f, 0.830732346f},
-std::array<float,2>{0.204716325f, 0.331856459f},
-std::array<float,2>{0.832172334f, 0.25475207f},
-std::array<float,2>{0.404096216f, 0.792909324f},
-std::array<float,2>{0.644203782f, 0.683579564f},
-std::array<float,2>{0.120620668f, 0.0161835942f},
-std::array<float,2>{0.535828769f, 0.128238484f},
-std::array<float,2>{0.125015602f, 0.526946425f},
-std::array<float,2>{0.921939731f, 0.980428934f},
-std::array<float,2>{0.330414861f, 0.44761005f},
-std::array<float,2>{0.624393106f, 0.355271548f},
-std::array<float,2>{0.230104014f, 0.856037199f},
-std::array<float,2>{0.983251035f, 0.744562149f},
-std::array<float,2>{0.311928928f, 0.113750584f},
-std::array<float,2>{0.789973557f, 0.21965614f},
-std::array<float,2>{0.443730056f, 0.623364687f},
-std::array<float,2>{0.699301839f, 0.93521291f},
-std::array<float,2>{0.00627991976f, 0.380222499f},
-std::array<float,2>{0.878939509f, 0.489429355f},
-std::array<float,2>{0.359665275f, 0.937995613f},
-std::array<float,2>{0.521667838f, 0.552858829f},
-std::array<float,2>{0.180612624f, 0.167205691f},
-std::array<float,2>{0.678882897f, 0.0381595977f},
-std::array<float,2>{0.085004203f, 0.653309047f},
-std::array<float,2>{0.87065345f, 0.755124807f},
-std::array<float,2>{0.415196359f, 0.309058338f},
-std::array<float,2>{0.626843214f, 0.282973647f},
-std::array<float,2>{0.0971168503f, 0.776175499f},
-std::array<float,2>{0.821722209f, 0.63407129f},
-std::array<float,2>{0.377579212f, 0.051179599f},
-std::array<float,2>{0.913681507f, 0.183799833f},
-std::array<float,2>{0.313029021f, 0.54570657f},
-std::array<float,2>{0.562197745f, 0.96168232f},
-std::array<float,2>{0.148288086f, 0.476862848f},
-std::array<float,2>{0.765352547f, 0.399193287f},
-std::array<float,2>{0.486690402f, 0.916493475f},
-std::array<float,2>{0.728432536f, 0.599881768f},
-std::array<float,2>{0.0375151113f, 0.236171484f},
-std::array<float,2>{0.58338052f, 0.104593754f},
-std::array<float,2>{0.189332247f, 0.730344653f},
-std::array<float,2>{0.968596518f, 0.860132873f},
-std::array<float,2>{0.25114736f, 0.3729361f},
-std::array<float,2>{0.51426667f, 0.453341037f},
-std::array<float,2>{0.162187785f, 0.99402231f},
-std::array<float,2>{0.902972341f, 0.501087189f},
-std::array<float,2>{0.358592868f, 0.145445496f},
-std::array<float,2>{0.845862627f, 0.0102746896f},
-std::array<float,2>{0.426029533f, 0.656574547f},
-std::array<float,2>{0.667955399f, 0.805672169f},
-std::array<float,2>{0.0644313246f, 0.269840628f},
-std::array<float,2>{0.998058259f, 0.319400996f},
-std::array<float,2>{0.293286353f, 0.822812438f},
-std::array<float,2>{0.598172486f, 0.701432288f},
-std::array<float,2>{0.247128531f, 0.0851653889f},
-std::array<float,2>{0.703526855f, 0.210681111f},
-std::array<float,2>{0.0184455551f, 0.592330515f},
-std::array<float,2>{0.811011434f, 0.895227969f},
-std::array<float,2>{0.460556835f, 0.43389982f},
-std::array<float,2>{0.646133959f, 0.397558182f},
-std::array<float,2>{0.12417008f, 0.910688221f},
-std::array<float,2>{0.828980803f, 0.607043147f},
-std::array<float,2>{0.40125683f, 0.247831345f},
-std::array<float,2>{0.927911758f, 0.101548873f},
-std::array<float,2>{0.333632976f, 0.725690007f},
-std::array<float,2>{0.532640398f, 0.869152963f},
-std::array<float,2>{0.131008625f, 0.361154646f},
-std::array<float,2>{0.780493617f, 0.295894742f},
-std::array<float,2>{0.478884757f, 0.770919621f},
-std::array<float,2>{0.745920956f, 0.628757119f},
-std::array<float,2>{0.0582117774f, 0.0621765368f},
-std::array<float,2>{0.567042768f, 0.177981406f},
-std::array<float,2>{0.207550362f, 0.532263875f},
-std::array<float,2>{0.951315761f, 0.955259621f},
-std::array<float,2>{0.271166772f, 0.471718788f},
-std::array<float,2>{0.518277228f, 0.325930536f},
-std::array<float,2>{0.186017647f, 0.820175827f},
-std::array<float,2>{0.876448393f, 0.689548731f},
-std::array<float,2>{0.366937935f, 0.088871181f},
-std::array<float,2>{0.873022795f, 0.212864116f},
-std::array<float,2>{0.420004219f, 0.580796182f},
-std::array<float,2>{0.673277915f, 0.902061522f},
-std::array<float,2>{0.0784987435f, 0.421966255f},
-std::array<float,2>{0.979671717f, 0.464390516f},
-std::array<float,2>{0.30604586f, 0.991455257f},
-std::array<float,2>{0.61998409f, 0.508763313f},
-std::array<float,2>{0.230783388f, 0.150049716f},
-std::array<float,2>{0.698359847f, 0.00445275893f},
-std::array<float,2>{0.00217366614f, 0.668431222f},
-std::array<float,2>{0.796213627f, 0.799376309f},
-std::array<float,2>{0.439308435f, 0.27850315f},
-std::array<float,2>{0.734157503f, 0.259554178f},
-std::array<float,2>{0.0329486467f, 0.783815861f},
-std::array<float,2>{0.760015309f, 0.672691643f},
-std::array<float,2>{0.491900563f, 0.030906897f},
-std::array<float,2>{0.964458704f, 0.136356667f},
-std::array<float,2>{0.257712305f, 0.519277394f},
-std::array<float,2>{0.580428302f, 0.970308721f},
-std::array<float,2>{0.191946432f, 0.442260742f},
-std::array<float,2>{0.827852845f, 0.412245542f},
-std::array<float,2>{0.381516159f, 0.884500325f},
-std::array<float,2>{0.632061243f, 0.566443682f},
-std::array<float,2>{0.0988440812f, 0.191310927f},
-std::array<float,2>{0.555413961f, 0.0641902611f},
-std::array<float,2>{0.14376992f, 0.718486965f},
-std::array<float,2>{0.909950733f, 0.843196332f},
-std::array<float,2>{0.317217946f, 0.341699392f},
-std::array<float,2>{0.594306529f, 0.496064574f},
-std::array<float,2>{0.244566619f, 0.950615883f},
-std::array<float,2>{0.993393898f, 0.561154783f},
-std::array<float,2>{0.289808989f, 0.162258551f},
-std::array<float,2>{0.808418512f, 0.0410472527f},
-std::array<float,2>{0.456962079f, 0.643085003f},
-std::array<float,2>{0.71062851f, 0.76491338f},
-std::array<float,2>{0.0228866767f, 0.302534789f},
-std::array<float,2>{0.900545537f, 0.349262476f},
-std::array<float,2>{0.352334768f, 0.844999194f},
-std::array<float,2>{0.5083974f, 0.737219274f},
-std::array<float,2>{0.158133402f, 0.123762153f},
-std::array<float,2>{0.670735359f, 0.234219775f},
-std::array<float,2>{0.0684845001f, 0.609608412f},
-std::array<float,2>{0.849609435f, 0.92542696f},
-std::array<float,2>{0.424269766f, 0.383176833f},
-std::array<float,2>{0.716982365f, 0.451004207f},
-std::array<float,2>{0.027151553f, 0.980601251f},
-std::array<float,2>{0.796924591f, 0.528395414f},
-std::array<float,2>{0.466305375f, 0.130815953f},
-std::array<float,2>{0.989457369f, 0.0221665371f},
-std::array<float,2>{0.283696592f, 0.685273945f},
-std::array<float,2>{0.606818616f, 0.795268416f},
-std::array<float,2>{0.238812998f, 0.253841788f},
-std::array<float,2>{0.856629372f, 0.33477962f},
-std::array<float,2>{0.432792276f, 0.833111644f},
-std::array<float,2>{0.65917927f, 0.706040204f},
-std::array<float,2>{0.0717959478f, 0.07064794f},
-std::array<float,2>{0.502157569f, 0.198381215f},
-std::array<float,2>{0.165635601f, 0.575089693f},
-std::array<float,2>{0.895894349f, 0.880267918f},
-std::array<float,2>{0.346924961f, 0.419249207f},
-std::array<float,2>{0.589681268f, 0.30652222f},
-std::array<float,2>{0.198034123f, 0.75125885f},
-std::array<float,2>{0.957504511f, 0.651952207f},
-std::array<float,2>{0.260780901f, 0.0317758694f},
-std::array<float,2>{0.754376769f, 0.169228673f},
-std::array<float,2>{0.497496247f, 0.547572076f},
-std::array<float,2>{0.719496846f, 0.94176662f},
-std::array<float,2>{0.0433845893f, 0.485484242f},
-std::array<float,2>{0.915902197f, 0.377135485f},
-std::array<float,2>{0.320593208f, 0.933023453f},
-std::array<float,2>{0.546921134f, 0.618345678f},
-std::array<float,2>{0.153220743f, 0.222849563f},
-std::array<float,2>{0.633157969f, 0.113105804f},
-std::array<float,2>{0.102076329f, 0.749752879f},
-std::array<float,2>{0.812719226f, 0.852606833f},
-std::array<float,2>{0.386025459f, 0.356654167f},
-std::array<float,2>{0.680471718f, 0.370359242f},
-std::array<float,2>{0.0917944908f, 0.863574147f},
-std::array<float,2>{0.863004446f, 0.731953323f},
-std::array<float,2>{0.41404286f, 0.108254656f},
-std::array<float,2>{0.887810528f, 0.240427032f},
-std::array<float,2>{0.371621311f, 0.595009387f},
-std::array<float,2>{0.524859846f, 0.920280218f},
-std::array<float,2>{0.17339316f, 0.403567702f},
-std::array<float,2>{0.7865628f, 0.484360158f},
-std::array<float,2>{0.445521474f, 0.965291083f},
-std::array<float,2>{0.688641191f, 0.541992724f},
-std::array<float,2>{0.0101963924f, 0.181383565f},
-std::array<float,2>{0.613292396f, 0.0477718525f},
-std::array<float,2>{0.220734194f, 0.638075948f},
-std::array<float,2>{0.971056223f, 0.778525233f},
-std::array<float,2>{0.301867425f, 0.287569582f},
-std::array<float,2>{0.542767406f, 0.431883216f},
-std::array<float,2>{0.1358542f, 0.893073499f},
-std::array<float,2>{0.93626523f, 0.587800801f},
-std::array<float,2>{0.33985135f, 0.204969183f},
-std::array<float,2>{0.842387617f, 0.0800427943f},
-std::array<float,2>{0.396172494f, 0.697506428f},
-std::array<float,2>{0.653928101f, 0.824569643f},
-std::array<float,2>{0.112124965f, 0.316065073f},
-std::array<float,2>{0.937671721f, 0.268836051f},
-std::array<float,2>{0.277429938f, 0.811362624f},
-std::array<float,2>{0.573346555f, 0.661731601f},
-std::array<float,2>{0.217208564f, 0.0153928818f},
-std::array<float,2>{0.735569656f, 0.141628444f},
-std::array<float,2>{0.0490187295f, 0.504057825f},
-std::array<float,2>{0.772738814f, 0.999994934f},
-std::array<float,2>{0.47054249f, 0.459650695f},
-std::array<float,2>{0.638533175f, 0.466356158f},
-std::array<float,2>{0.10652674f, 0.985420108f},
-std::array<float,2>{0.816833675f, 0.514285803f},
-std::array<float,2>{0.39045465f, 0.15584895f},
-std::array<float,2>{0.920597374f, 0.00310552632f},
-std::array<float,2>{0.326661468f, 0.666286349f},
-std::array<float,2>{0.552957952f, 0.80130595f},
-std::array<float,2>{0.152292073f, 0.276160121f},
-std::array<float,2>{0.753371835f, 0.321039557f},
-std::array<float,2>{0.49536109f, 0.815460086f},
-std::array<float,2>{0.723156393f, 0.694586575f},
-std::array<float,2>{0.0398645736f, 0.0915855989f},
-std::array<float,2>{0.589982629f, 0.215517297f},
-std::array<float,2>{0.201191336f, 0.584649622f},
-std::array<float,2>{0.955328584f, 0.902579367f},
-std::array<float,2>{0.264827311f, 0.427377582f},
-std::array<float,2>{0.506004214f, 0.289363384f},
-std::array<float,2>{0.169605136f, 0.766327679f},
-std::array<float,2>{0.89204514f, 0.629231334f},
-std::array<float,2>{0.351448804f, 0.0561613962f},
-std::array<float,2>{0.85210371f, 0.17542012f},
-std::array<float,2>{0.435204506f, 0.538894951f},
-std::array<float,2>{0.662992716f, 0.95763278f},
-std::array<float,2>{0.0755407065f, 0.473756343f},
-std::array<float,2>{0.987168849f, 0.392424852f},
-std::array<float,2>{0.286298722f, 0.908142269f},
-std::array<float,2>{0.6048491f, 0.601839244f},
-std::array<float,2>{0.236193523f, 0.244131997f},
-std::array<float,2>{0.712998986f, 0.0966202095f},
-std::array<float,2>{0.029237587f, 0.72053653f},
-std::array<float,2>{0.802318752f, 0.873686612f},
-std::array<float,2>{0.460980386f, 0.365628988f},
-std::array<float,2>{0.738989055f, 0.345306307f},
-std::array<float,2>{0.0531732515f, 0.849843264f},
-std::array<float,2>{0.768406451f, 0.741317809f},
-std::array<float,2>{0.472949386f, 0.120214298f},
-std::array<float,2>{0.943225563f, 0.226702437f},
-std::array<float,2>{0.274425834f, 0.617143095f},
-std::array<float,2>{0.5752213f, 0.929119706f},
-std::array<float,2>{0.214633062f, 0.388332307f},
-std::array<float,2>{0.83655262f, 0.499216825f},
-std::array<float,2>{0.392854303f, 0.946988046f},
-std::array<float,2>{0.648494124f, 0.556946158f},
-std::array<float,2>{0.117071874f, 0.16000247f},
-std::array<float,2>{0.545837045f, 0.0436882861f},
-std::array<float,2>{0.13721101f, 0.644807279f},
-std::array<float,2>{0.931908846f, 0.760425687f},
-std::array<float,2>{0.336970717f, 0.299266815f},
-std::array<float,2>{0.609706819f, 0.410109758f},
-std::array<float,2>{0.223216087f, 0.887934089f},
-std::array<float,2>{0.976433992f, 0.566325426f},
-std::array<float,2>{0.299746156f, 0.192379266f},
-std::array<float,2>{0.781503201f, 0.067277424f},
-std::array<float,2>{0.450461894f, 0.711861908f},
-std::array<float,2>{0.693423569f, 0.838716626f},
-std::array<float,2>{0.0145548536f, 0.337655783f},
-std::array<float,2>{0.884220481f, 0.263952643f},
-std::array<float,2>{0.371047854f, 0.785815477f},
-std::array<float,2>{0.529410303f, 0.679212987f},
-std::array<float,2>{0.177566171f, 0.0267580897f},
-std::array<float,2>{0.68522644f, 0.137688801f},
-std::array<float,2>{0.0886466503f, 0.520457029f},
-std::array<float,2>{0.863437355f, 0.975740969f},
-std::array<float,2>{0.408844113f, 0.440781623f},
-std::array<float,2>{0.701595128f, 0.381437004f},
-std::array<float,2>{0.00464587379f, 0.936059058f},
-std::array<float,2>{0.79265815f, 0.621549904f},
-std::array<float,2>{0.443206012f, 0.222086683f},
-std::array<float,2>{0.982109964f, 0.11659506f},
-std::array<float,2>{0.310523093f, 0.743233025f},
-std::array<float,2>{0.622491598f, 0.859037817f},
-std::array<float,2>{0.227800578f, 0.351660132f},
-std::array<float,2>{0.86736995f, 0.312441021f},
-std::array<float,2>{0.417925596f, 0.756665289f},
-std::array<float,2>{0.676173449f, 0.655514061f},
-std::array<float,2>{0.0821117684f, 0.0366850197f},
-std::array<float,2>{0.520338178f, 0.165991649f},
-std::array<float,2>{0.181886435f, 0.551821232f},
-std::array<float,2>{0.881308496f, 0.940627873f},
-std::array<float,2>{0.361813009f, 0.491573393f},
-std::array<float,2>{0.56341356f, 0.3299447f},
-std::array<float,2>{0.205183148f, 0.828153372f},
-std::array<float,2>{0.948982954f, 0.709165275f},
-std::array<float,2>{0.267098278f, 0.0779477954f},
-std::array<float,2>{0.775352955f, 0.199813113f},
-std::array<float,2>{0.482329339f, 0.570828199f},
-std::array<float,2>{0.746440887f, 0.875291109f},
-std::array<float,2>{0.061481256f, 0.414408803f},
-std::array<float,2>{0.92577076f, 0.446408123f},
-std::array<float,2>{0.329917967f, 0.9776842f},
-std::array<float,2>{0.53897202f, 0.523661613f},
-std::array<float,2>{0.127344847f, 0.12580803f},
-std::array<float,2>{0.642420411f, 0.0176731758f},
-std::array<float,2>{0.118238732f, 0.680680275f},
-std::array<float,2>{0.835271776f, 0.789648354f},
-std::array<float,2>{0.404543489f, 0.257490128f},
-std::array<float,2>{0.66413635f, 0.272254527f},
-std::array<float,2>{0.0645807981f, 0.808103025f},
-std::array<float,2>{0.845167875f, 0.659015179f},
-std::array<float,2>{0.428233773f, 0.00856731553f},
-std::array<float,2>{0.904484928f, 0.147178024f},
-std::array<float,2>{0.356624961f, 0.502073586f},
-std::array<float,2>{0.51354605f, 0.99442935f},
-std::array<float,2>{0.161624596f, 0.456690282f},
-std::array<float,2>{0.808866203f, 0.435786188f},
-std::array<float,2>{0.457753718f, 0.896996796f},
-std::array<float,2>{0.706554949f, 0.590591908f},
-std::array<float,2>{0.0172794573f, 0.207904652f},
-std::array<float,2>{0.601347387f, 0.0825984627f},
-std::array<float,2>{0.248953477f, 0.700128973f},
-std::array<float,2>{0.996116936f, 0.821102619f},
-std::array<float,2>{0.29503113f, 0.317212492f},
-std::array<float,2>{0.559789598f, 0.479358017f},
-std::array<float,2>{0.145252973f, 0.963897705f},
-std::array<float,2>{0.910242081f, 0.544606507f},
-std::array<float,2>{0.314736813f, 0.186439663f},
-std::array<float,2>{0.822633862f, 0.0536321662f},
-std::array<float,2>{0.375857949f, 0.635011554f},
-std::array<float,2>{0.628284991f, 0.774930477f},
-std::array<float,2>{0.095635727f, 0.283825755f},
-std::array<float,2>{0.965629816f, 0.374048233f},
-std::array<float,2>{0.253610581f, 0.861762762f},
-std::array<float,2>{0.584132969f, 0.72707206f},
-std::array<float,2>{0.191390023f, 0.102664784f},
-std::array<float,2>{0.730235219f, 0.237549528f},
-std::array<float,2>{0.0360425673f, 0.598323584f},
-std::array<float,2>{0.763607621f, 0.915145457f},
-std::array<float,2>{0.485187024f, 0.400984943f},
-std::array<float,2>{0.675548613f, 0.424195349f},
-std::array<float,2>{0.0809372738f, 0.898926079f},
-std::array<float,2>{0.874671996f, 0.580025315f},
-std::array<float,2>{0.41827938f, 0.214528739f},
-std::array<float,2>{0.87707144f, 0.0870500132f},
-std::array<float,2>{0.365134329f, 0.687870502f},
-std::array<float,2>{0.516242266f, 0.81806916f},
-std::array<float,2>{0.183813915f, 0.326468527f},
-std::array<float,2>{0.793928266f, 0.280026734f},
-std::array<float,2>{0.439456761f, 0.796934068f},
-std::array<float,2>{0.695852399f, 0.67014116f},
-std::array<float,2>{0.000532458478f, 0.00759721687f},
-std::array<float,2>{0.618270278f, 0.150909081f},
-std::array<float,2>{0.232717246f, 0.509802222f},
-std::array<float,2>{0.978044212f, 0.988703012f},
-std::array<float,2>{0.307949007f, 0.46224153f},
-std::array<float,2>{0.53343904f, 0.362069607f},
-std::array<float,2>{0.130835518f, 0.868568897f},
-std::array<float,2>{0.92733705f, 0.722755373f},
-std::array<float,2>{0.335007429f, 0.0994339436f},
-std::array<float,2>{0.831558883f, 0.248415262f},
-std::array<float,2>{0.399500549f, 0.608277082f},
-std::array<float,2>{0.646699846f, 0.913438976f},
-std::array<float,2>{0.121622689f, 0.394947171f},
-std::array<float,2>{0.950773418f, 0.469859034f},
-std::array<float,2>{0.271789104f, 0.954352736f},
-std::array<float,2>{0.569701076f, 0.534898937f},
-std::array<float,2>{0.209675029f, 0.177190766f},
-std::array<float,2>{0.743336916f, 0.0590694286f},
-std::array<float,2>{0.0563695356f, 0.626030087f},
-std::array<float,2>{0.778831422f, 0.772890329f},
-std::array<float,2>{0.477830529f, 0.294026494f},
-std::array<float,2>{0.707626164f, 0.302790076f},
-std::array<float,2>{0.0206377916f, 0.762018919f},
-std::array<float,2>{0.806074858f, 0.642375052f},
-std::array<float,2>{0.453497589f, 0.0398483463f},
-std::array<float,2>{0.994310319f, 0.160302535f},
-std::array<float,2>{0.292145282f, 0.559984744f},
-std::array<float,2>{0.597209454f, 0.951898992f},
-std::array<float,2>{0.243667051f, 0.492525607f},
-std::array<float,2>{0.849442899f, 0.385001719f},
-std::array<float,2>{0.423220783f, 0.922891796f},
-std::array<float,2>{0.668808103f, 0.612951815f},
-std::array<float,2>{0.0680841953f, 0.231456921f},
-std::array<float,2>{0.511641085f, 0.122218437f},
-std::array<float,2>{0.159622192f, 0.735651791f},
-std::array<float,2>{0.899301231f, 0.846515894f},
-std::array<float,2>{0.354851782f, 0.350359827f},
-std::array<float,2>{0.5799824f, 0.444065988f},
-std::array<float,2>{0.193663374f, 0.970844269f},
-std::array<float,2>{0.962569594f, 0.51686132f},
-std::array<float,2>{0.255058795f, 0.133099899f},
-std::array<float,2>{0.759074748f, 0.0292065516f},
-std::array<float,2>{0.489705622f, 0.674259305f},
-std::array<float,2>{0.731877029f, 0.782090604f},
-std::array<float,2>{0.0341111682f, 0.259774625f},
-std::array<float,2>{0.907282174f, 0.34371379f},
-std::array<float,2>{0.319190949f, 0.83984524f},
-std::array<float,2>{0.556916535f, 0.716598392f},
-std::array<float,2>{0.142039776f, 0.065048106f},
-std::array<float,2>{0.62952441f, 0.187587008f},
-std::array<float,2>{0.100663006f, 0.5695467f},
-std::array<float,2>{0.82498008f, 0.886254609f},
-std::array<float,2>{0.379460752f, 0.410217494f},
-std::array<float,2>{0.721785843f, 0.48799336f},
-std::array<float,2>{0.0453601256f, 0.94385165f},
-std::array<float,2>{0.756381452f, 0.550529718f},
-std::array<float,2>{0.498192251f, 0.171629757f},
-std::array<float,2>{0.960760713f, 0.0346748792f},
-std::array<float,2>{0.258853018f, 0.6497069f},
-std::array<float,2>{0.587318599f, 0.752058387f},
-std::array<float,2>{0.196754619f, 0.306812197f},
-std::array<float,2>{0.816022754f, 0.358499229f},
-std::array<float,2>{0.38327837f, 0.855441034f},
-std::array<float,2>{0.636608422f, 0.747236907f},
-std::array<float,2>{0.104865648f, 0.110054225f},
-std::array<float,2>{0.549262285f, 0.22587426f},
-std::array<float,2>{0.154880315f, 0.620612144f},
-std::array<float,2>{0.917142928f, 0.931540191f},
-std::array<float,2>{0.323796481f, 0.376542926f},
-std::array<float,2>{0.608615279f, 0.250032991f},
-std::array<float,2>{0.241564348f, 0.794238389f},
-std::array<float,2>{0.990722775f, 0.686918676f},
-std::array<float,2>{0.282391548f, 0.0214133859f},
-std::array<float,2>{0.800777972f, 0.132737905f},
-std::array<float,2>{0.467334986f, 0.531243801f},
-std::array<float,2>{0.715405822f, 0.983665586f},
-std::array<float,2>{0.025169827f, 0.451586485f},
-std::array<float,2>{0.897754669f, 0.421858728f},
-std::array<float,2>{0.344064385f, 0.880886197f},
-std::array<float,2>{0.501436234f, 0.576371849f},
-std::array<float,2>{0.166935772f, 0.195932001f},
-std::array<float,2>{0.658023715f, 0.073654972f},
-std::array<float,2>{0.0738896206f, 0.703761041f},
-std::array<float,2>{0.858538032f, 0.834449172f},
-std::array<float,2>{0.431004643f, 0.332442284f},
-std::array<float,2>{0.654590786f, 0.312803477f},
-std::array<float,2>{0.111029968f, 0.827156484f},
-std::array<float,2>{0.840932488f, 0.696130097f},
-std::array<float,2>{0.396635026f, 0.0809981227f},
-std::array<float,2>{0.934375465f, 0.20603177f},
-std::array<float,2>{0.34243691f, 0.589562237f},
-std::array<float,2>{0.539894164f, 0.890892565f},
-std::array<float,2>{0.133981094f, 0.431370169f},
-std::array<float,2>{0.770878077f, 0.457919508f},
-std::array<float,2>{0.472387254f, 0.99712044f},
-std::array<float,2>{0.73742044f, 0.506320953f},
-std::array<float,2>{0.0475153551f, 0.143626824f},
-std::array<float,2>{0.571100831f, 0.0117698126f},
-std::array<float,2>{0.216308445f, 0.662138522f},
-std::array<float,2>{0.941048503f, 0.80902648f},
-std::array<float,2>{0.280721724f, 0.266745389f},
-std::array<float,2>{0.526907384f, 0.404372305f},
-std::array<float,2>{0.174267367f, 0.91817975f},
-std::array<float,2>{0.889777005f, 0.597481906f},
-std::array<float,2>{0.374694675f, 0.238528475f},
-std::array<float,2>{0.860127807f, 0.107342482f},
-std::array<float,2>{0.41199401f, 0.732966423f},
-std::array<float,2>{0.68200779f, 0.867184818f},
-std::array<float,2>{0.0928647146f, 0.368885368f},
-std::array<float,2>{0.9691872f, 0.285543352f},
-std::array<float,2>{0.304392815f, 0.780051947f},
-std::array<float,2>{0.616831422f, 0.640420258f},
-std::array<float,2>{0.22054784f, 0.0490289554f},
-std::array<float,2>{0.691180766f, 0.182733342f},
-std::array<float,2>{0.00783299003f, 0.539384365f},
-std::array<float,2>{0.787172914f, 0.967550397f},
-std::array<float,2>{0.447849214f, 0.48163119f},
-std::array<float,2>{0.68644774f, 0.440268397f},
-std::array<float,2>{0.0863446444f, 0.974895895f},
-std::array<float,2>{0.866261721f, 0.520961344f},
-std::array<float,2>{0.407256097f, 0.138154924f},
-std::array<float,2>{0.88494879f, 0.0258440003f},
-std::array<float,2>{0.36758092f, 0.678388238f},
-std::array<float,2>{0.527637303f, 0.786384106f},
-std::array<float,2>{0.179047242f, 0.264856666f},
-std::array<float,2>{0.784475148f, 0.336863339f},
-std::array<float,2>{0.452203095f, 0.839087427f},
-std::array<float,2>{0.691559434f, 0.712314129f},
-std::array<float,2>{0.012242551f, 0.068286486f},
-std::array<float,2>{0.611489177f, 0.192427769f},
-std::array<float,2>{0.225805953f, 0.564755976f},
-std::array<float,2>{0.97299397f, 0.887268066f},
-std::array<float,2>{0.298406988f, 0.408374131f},
-std::array<float,2>{0.544630289f, 0.300064743f},
-std::array<float,2>{0.140441388f, 0.761192381f},
-std::array<float,2>{0.929794908f, 0.646296918f},
-std::array<float,2>{0.338456571f, 0.0440982133f},
-std::array<float,2>{0.839112461f, 0.158248916f},
-std::array<float,2>{0.390797615f, 0.55810082f},
-std::array<float,2>{0.652032673f, 0.945812881f},
-std::array<float,2>{0.1137871f, 0.498215407f},
-std::array<float,2>{0.943844378f, 0.387533456f},
-std::array<float,2>{0.276063234f, 0.928293884f},
-std::array<float,2>{0.577000082f, 0.615539432f},
-std::array<float,2>{0.212275654f, 0.228222176f},
-std::array<float,2>{0.741047323f, 0.120087638f},
-std::array<float,2>{0.0513256527f, 0.741111457f},
-std::array<float,2>{0.766457021f, 0.851122975f},
-std::array<float,2>{0.475890815f, 0.344650239f},
-std::array<float,2>{0.712514758f, 0.366356969f},
-std::array<float,2>{0.0293729287f, 0.874485254f},
-std::array<float,2>{0.804028511f, 0.719647229f},
-std::array<float,2>{0.464366943f, 0.0974262804f},
-std::array<float,2>{0.985373199f, 0.242975891f},
-std::array<float,2>{0.287256658f, 0.603269935f},
-std::array<float,2>{0.602471888f, 0.906691134f},
-std::array<float,2>{0.236453608f, 0.391524345f},
-std::array<float,2>{0.854084432f, 0.47294116f},
-std::array<float,2>{0.435636878f, 0.958372176f},
-std::array<float,2>{0.661204278f, 0.537276089f},
-std::array<float,2>{0.0764145032f, 0.1743325f},
-std::array<float,2>{0.505461991f, 0.0554752797f},
-std::array<float,2>{0.16993539f, 0.630300045f},
-std::array<float,2>{0.893903196f, 0.766688645f},
-std::array<float,2>{0.348520994f, 0.290313363f},
-std::array<float,2>{0.591922402f, 0.426420122f},
-std::array<float,2>{0.200013489f, 0.904085636f},
-std::array<float,2>{0.953885198f, 0.585149646f},
-std::array<float,2>{0.262448311f, 0.216524452f},
-std::array<float,2>{0.751228809f, 0.0899966657f},
-std::array<float,2>{0.492805213f, 0.693731546f},
-std::array<float,2>{0.725686371f, 0.814801097f},
-std::array<float,2>{0.0417862236f, 0.322037071f},
-std::array<float,2>{0.91798538f, 0.276645809f},
-std::array<float,2>{0.324581474f, 0.80200839f},
-std::array<float,2>{0.551803052f, 0.667794764f},
-std::array<float,2>{0.150213256f, 0.00242739334f},
-std::array<float,2>{0.640227079f, 0.154995099f},
-std::array<float,2>{0.109266259f, 0.515296936f},
-std::array<float,2>{0.818684638f, 0.98508358f},
-std::array<float,2>{0.387579501f, 0.465597987f},
-std::array<float,2>{0.727371514f, 0.401879996f},
-std::array<float,2>{0.0382299088f, 0.914826632f},
-std::array<float,2>{0.76396507f, 0.598867536f},
-std::array<float,2>{0.488002449f, 0.236735448f},
-std::array<float,2>{0.96686697f, 0.101679355f},
-std::array<float,2>{0.250061214f, 0.727937162f},
-std::array<float,2>{0.582809091f, 0.863234997f},
-std::array<float,2>{0.187963247f, 0.373546392f},
-std::array<float,2>{0.820994318f, 0.285140336f},
-std::array<float,2>{0.378303558f, 0.773676276f},
-std::array<float,2>{0.625510812f, 0.63646996f},
-std::array<float,2>{0.0966559723f, 0.0537343994f},
-std::array<float,2>{0.561315954f, 0.186828643f},
-std::array<float,2>{0.147156417f, 0.542987883f},
-std::array<float,2>{0.91221869f, 0.962987304f},
-std::array<float,2>{0.313984722f, 0.48034969f},
-std::array<float,2>{0.59903264f, 0.318101555f},
-std::array<float,2>{0.246890768f, 0.822087049f},
-std::array<float,2>{0.999827921f, 0.700658619f},
-std::array<float,2>{0.294732958f, 0.0833903775f},
-std::array<float,2>{0.811986327f, 0.208440185f},
-std::array<float,2>{0.45984447f, 0.591133356f},
-std::array<float,2>{0.7046507f, 0.89819479f},
-std::array<float,2>{0.0192013979f, 0.43713066f},
-std::array<float,2>{0.904293418f, 0.455951959f},
-std::array<float,2>{0.357519567f, 0.995881796f},
-std::array<float,2>{0.514968932f, 0.503648639f},
-std::array<float,2>{0.163929969f, 0.147629991f},
-std::array<float,2>{0.666660368f, 0.00934026856f},
-std::array<float,2>{0.0632985905f, 0.659249961f},
-std::array<float,2>{0.847608566f, 0.807595015f},
-std::array<float,2>{0.42738691f, 0.273285389f},
-std::array<float,2>{0.64266026f, 0.255904287f},
-std::array<float,2>{0.119666561f, 0.790563464f},
-std::array<float,2>{0.833610296f, 0.68059212f},
-std::array<float,2>{0.403052896f, 0.0186660495f},
-std::array<float,2>{0.923353255f, 0.126625821f},
-std::array<float,2>{0.331958771f, 0.52495563f},
-std::array<float,2>{0.536346614f, 0.977430463f},
-std::array<float,2>{0.126129419f, 0.446059525f},
-std::array<float,2>{0.777067184f, 0.41509527f},
-std::array<float,2>{0.482708871f, 0.876256049f},
-std::array<float,2>{0.749904454f, 0.571393192f},
-std::array<float,2>{0.0592281967f, 0.201118842f},
-std::array<float,2>{0.56518364f, 0.0766009614f},
-std::array<float,2>{0.203308702f, 0.710464478f},
-std::array<float,2>{0.946655691f, 0.829357088f},
-std::array<float,2>{0.269359291f, 0.328357577f},
-std::array<float,2>{0.523302734f, 0.490495712f},
-std::array<float,2>{0.180826411f, 0.939694047f},
-std::array<float,2>{0.880506516f, 0.551608324f},
-std::array<float,2>{0.360371053f, 0.164682671f},
-std::array<float,2>{0.869971454f, 0.0356796645f},
-std::array<float,2>{0.414789051f, 0.654935837f},
-std::array<float,2>{0.677953601f, 0.757455409f},
-std::array<float,2>{0.0846169814f, 0.31071344f},
-std::array<float,2>{0.984211087f, 0.353151381f},
-std::array<float,2>{0.31133762f, 0.857893944f},
-std::array<float,2>{0.623360634f, 0.742308497f},
-std::array<float,2>{0.228878766f, 0.116106443f},
-std::array<float,2>{0.700680435f, 0.221067131f},
-std::array<float,2>{0.00729944557f, 0.622663856f},
-std::array<float,2>{0.790639222f, 0.936568558f},
-std::array<float,2>{0.444741786f, 0.382539421f},
-std::array<float,2>{0.631709099f, 0.411677986f},
-std::array<float,2>{0.0981341898f, 0.885349274f},
-std::array<float,2>{0.826414406f, 0.568801224f},
-std::array<float,2>{0.382242441f, 0.189135477f},
-std::array<float,2>{0.908738136f, 0.0654359534f},
-std::array<float,2>{0.317690611f, 0.714914143f},
-std::array<float,2>{0.556229889f, 0.841251493f},
-std::array<float,2>{0.143081367f, 0.342635214f},
-std::array<float,2>{0.761071146f, 0.261170924f},
-std::array<float,2>{0.491087675f, 0.78266567f},
-std::array<float,2>{0.733205557f, 0.67516166f},
-std::array<float,2>{0.0320956148f, 0.027651174f},
-std::array<float,2>{0.581349969f, 0.134123981f},
-std::array<float,2>{0.192728102f, 0.516203523f},
-std::array<float,2>{0.963801563f, 0.972175181f},
-std::array<float,2>{0.255871058f, 0.445174664f},
-std::array<float,2>{0.508867383f, 0.351192534f},
-std::array<float,2>{0.156708375f, 0.846734583f},
-std::array<float,2>{0.901440918f, 0.734966755f},
-std::array<float,2>{0.353078902f, 0.121624634f},
-std::array<float,2>{0.851144612f, 0.231136963f},
-std::array<float,2>{0.425506145f, 0.611892581f},
-std::array<float,2>{0.671087325f, 0.922165632f},
-std::array<float,2>{0.0696398467f, 0.386397958f},
-std::array<float,2>{0.992556512f, 0.494010627f},
-std::array<float,2>{0.290848821f, 0.952343345f},
-std::array<float,2>{0.594768226f, 0.558749259f},
-std::array<float,2>{0.245138407f, 0.16183567f},
-std::array<float,2>{0.709694445f, 0.0402072445f},
-std::array<float,2>{0.0220683385f, 0.640705407f},
-std::array<float,2>{0.80741626f, 0.762711585f},
-std::array<float,2>{0.455529958f, 0.304042667f},
-std::array<float,2>{0.744156897f, 0.292983145f},
-std::array<float,2>{0.0575202741f, 0.772130489f},
-std::array<float,2>{0.779900372f, 0.625337541f},
-std::array<float,2>{0.479684025f, 0.0604929924f},
-std::array<float,2>{0.952834904f, 0.176008672f},
-std::array<float,2>{0.269819975f, 0.533278644f},
-std::array<float,2>{0.568315566f, 0.953169048f},
-std::array<float,2>{0.20805116f, 0.469024062f},
-std::array<float,2>{0.829292595f, 0.396407753f},
-std::array<float,2>{0.40175128f, 0.912266791f},
-std::array<float,2>{0.644729853f, 0.608554304f},
-std::array<float,2>{0.124009475f, 0.249595538f},
-std::array<float,2>{0.531395853f, 0.0979434326f},
-std::array<float,2>{0.132354826f, 0.723910928f},
-std::array<float,2>{0.92939502f, 0.867906034f},
-std::array<float,2>{0.332477629f, 0.362827182f},
-std::array<float,2>{0.620269835f, 0.461092323f},
-std::array<float,2>{0.231963918f, 0.990107954f},
-std::array<float,2>{0.979335189f, 0.511461377f},
-std::array<float,2>{0.305213243f, 0.152147546f},
-std::array<float,2>{0.795563638f, 0.00647190679f},
-std::array<float,2>{0.43811667f, 0.671434045f},
-std::array<float,2>{0.698233068f, 0.798292875f},
-std::array<float,2>{0.00309750251f, 0.281222254f},
-std::array<float,2>{0.875219941f, 0.327158988f},
-std::array<float,2>{0.36585632f, 0.817259431f},
-std::array<float,2>{0.51927948f, 0.688703835f},
-std::array<float,2>{0.186587602f, 0.0862779319f},
-std::array<float,2>{0.672224343f, 0.2137907f},
-std::array<float,2>{0.0799718946f, 0.578772008f},
-std::array<float,2>{0.871839106f, 0.899674237f},
-std::array<float,2>{0.421653003f, 0.425174564f},
-std::array<float,2>{0.688231587f, 0.480814934f},
-std::array<float,2>{0.0108638322f, 0.968466341f},
-std::array<float,2>{0.785307705f, 0.540785789f},
-std::array<float,2>{0.446396172f, 0.181779519f},
-std::array<float,2>{0.971709907f, 0.0504034683f},
-std::array<float,2>{0.300996214f, 0.639200449f},
-std::array<float,2>{0.614893854f, 0.780999243f},
-std::array<float,2>{0.222625196f, 0.287082493f},
-std::array<float,2>{0.862043083f, 0.367890239f},
-std::array<float,2>{0.412474126f, 0.865284145f},
-std::array<float,2>{0.680675805f, 0.733460665f},
-std::array<float,2>{0.0900117233f, 0.106296584f},
-std::array<float,2>{0.524058163f, 0.239847928f},
-std::array<float,2>{0.171917185f, 0.596411288f},
-std::array<float,2>{0.886729956f, 0.919640541f},
-std::array<float,2>{0.37244761f, 0.405714124f},
-std::array<float,2>{0.572481811f, 0.265758365f},
-std::array<float,2>{0.217783093f, 0.80997479f},
-std::array<float,2>{0.938559175f, 0.663316727f},
-std::array<float,2>{0.279103011f, 0.0127198035f},
-std::array<float,2>{0.772053719f, 0.142613441f},
-std::array<float,2>{0.469085723f, 0.507485092f},
-std::array<float,2>{0.735122919f, 0.997042477f},
-std::array<float,2>{0.050347466f, 0.458038151f},
-std::array<float,2>{0.936957657f, 0.429787815f},
-std::array<float,2>{0.341454327f, 0.891803563f},
-std::array<float,2>{0.541784227f, 0.587971449f},
-std::array<float,2>{0.135116398f, 0.206487775f},
-std::array<float,2>{0.652357578f, 0.0818366855f},
-std::array<float,2>{0.112942785f, 0.696491778f},
-std::array<float,2>{0.842859745f, 0.826216698f},
-std::array<float,2>{0.395051986f, 0.31360063f},
-std::array<float,2>{0.659947634f, 0.333029538f},
-std::array<float,2>{0.070592925f, 0.835908949f},
-std::array<float,2>{0.856295168f, 0.704303086f},
-std::array<float,2>{0.432019472f, 0.0730047151f},
-std::array<float,2>{0.894750774f, 0.196920529f},
-std::array<float,2>{0.34602046f, 0.57784313f},
-std::array<float,2>{0.503858209f, 0.882499754f},
-std::array<float,2>{0.164526895f, 0.420389473f},
-std::array<float,2>{0.798216045f, 0.45232141f},
-std::array<float,2>{0.465368062f, 0.983244836f},
-std::array<float,2>{0.718617022f, 0.529426455f},
-std::array<float,2>{0.0257495809f, 0.131109729f},
-std::array<float,2>{0.605971634f, 0.0197148155f},
-std::array<float,2>{0.23996605f, 0.685870111f},
-std::array<float,2>{0.988420725f, 0.793138802f},
-std::array<float,2>{0.284193814f, 0.251260042f},
-std::array<float,2>{0.548624873f, 0.375215173f},
-std::array<float,2>{0.15373911f, 0.930047393f},
-std::array<float,2>{0.914758027f, 0.620080471f},
-std::array<float,2>{0.321439803f, 0.225445673f},
-std::array<float,2>{0.814158916f, 0.111305416f},
-std::array<float,2>{0.384839088f, 0.746852219f},
-std::array<float,2>{0.63401705f, 0.854152799f},
-std::array<float,2>{0.102994792f, 0.358053684f},
-std::array<float,2>{0.958505332f, 0.308015347f},
-std::array<float,2>{0.260515988f, 0.75369978f},
-std::array<float,2>{0.588173866f, 0.649002671f},
-std::array<float,2>{0.198885322f, 0.0339757986f},
-std::array<float,2>{0.720523119f, 0.170729682f},
-std::array<float,2>{0.0445320569f, 0.549470603f},
-std::array<float,2>{0.755574584f, 0.945167243f},
-std::array<float,2>{0.496418983f, 0.486563057f},
-std::array<float,2>{0.649900377f, 0.497392118f},
-std::array<float,2>{0.115607724f, 0.947375715f},
-std::array<float,2>{0.837360144f, 0.555858612f},
-std::array<float,2>{0.394371688f, 0.157667443f},
-std::array<float,2>{0.932784021f, 0.0461586006f},
-std::array<float,2>{0.336071789f, 0.647900105f},
-std::array<float,2>{0.546076417f, 0.758079886f},
-std::array<float,2>{0.137749627f, 0.298675627f},
-std::array<float,2>{0.76925993f, 0.34602645f},
-std::array<float,2>{0.474423379f, 0.847827494f},
-std::array<float,2>{0.739817142f, 0.740195513f},
-std::array<float,2>{0.054588262f, 0.117492117f},
-std::array<float,2>{0.575002968f, 0.229646936f},
-std::array<float,2>{0.213100106f, 0.61506319f},
-std::array<float,2>{0.941578567f, 0.92697233f},
-std::array<float,2>{0.274156153f, 0.38924399f},
-std::array<float,2>{0.530782163f, 0.263056695f},
-std::array<float,2>{0.175914273f, 0.787782788f},
-std::array<float,2>{0.88314265f, 0.676717579f},
-std::array<float,2>{0.369384915f, 0.0241060741f},
-std::array<float,2>{0.864504278f, 0.139120683f},
-std::array<float,2>{0.409555614f, 0.52165556f},
-std::array<float,2>{0.68429476f, 0.972744882f},
-std::array<float,2>{0.0896190852f, 0.438402772f},
-std::array<float,2>{0.974693716f, 0.4067972f},
-std::array<float,2>{0.300384849f, 0.890438139f},
-std::array<float,2>{0.61077106f, 0.562969446f},
-std::array<float,2>{0.223637462f, 0.194909945f},
-std::array<float,2>{0.695011675f, 0.0701554567f},
-std::array<float,2>{0.0149826854f, 0.71462357f},
-std::array<float,2>{0.782898307f, 0.836854696f},
-std::array<float,2>{0.449814558f, 0.338512063f},
-std::array<float,2>{0.72429651f, 0.322328955f},
-std::array<float,2>{0.0407349281f, 0.814068675f},
-std::array<float,2>{0.752871454f, 0.692099214f},
-std::array<float,2>{0.494722277f, 0.0933608785f},
-std::array<float,2>{0.956489921f, 0.216954932f},
-std::array<float,2>{0.263724416f, 0.582282722f},
-std::array<float,2>{0.591778338f, 0.905184746f},
-std::array<float,2>{0.202360153f, 0.429474324f},
-std::array<float,2>{0.81793648f, 0.466921598f},
-std::array<float,2>{0.389243782f, 0.987899661f},
-std::array<float,2>{0.637357712f, 0.513007224f},
-std::array<float,2>{0.106055863f, 0.153728828f},
-std::array<float,2>{0.554476619f, 0.000267016003f},
-std::array<float,2>{0.150779322f, 0.665540576f},
-std::array<float,2>{0.921545327f, 0.803884208f},
-std::array<float,2>{0.327920467f, 0.273820996f},
-std::array<float,2>{0.604372025f, 0.393868387f},
-std::array<float,2>{0.234666213f, 0.909357667f},
-std::array<float,2>{0.987792969f, 0.604269624f},
-std::array<float,2>{0.285523564f, 0.244848877f},
-std::array<float,2>{0.801686406f, 0.0947764665f},
-std::array<float,2>{0.462803483f, 0.721519291f},
-std::array<float,2>{0.714507937f, 0.87243247f},
-std::array<float,2>{0.0276017692f, 0.364844471f},
-std::array<float,2>{0.891318023f, 0.29192555f},
-std::array<float,2>{0.350577652f, 0.768297315f},
-std::array<float,2>{0.507396996f, 0.632782757f},
-std::array<float,2>{0.168082491f, 0.0567134023f},
-std::array<float,2>{0.66327107f, 0.173346341f},
-std::array<float,2>{0.0746190399f, 0.535646498f},
-std::array<float,2>{0.853295803f, 0.960443497f},
-std::array<float,2>{0.434147954f, 0.475927591f},
-std::array<float,2>{0.70528841f, 0.435182124f},
-std::array<float,2>{0.0156693049f, 0.895682454f},
-std::array<float,2>{0.809861302f, 0.593412161f},
-std::array<float,2>{0.458352923f, 0.209122136f},
-std::array<float,2>{0.997354984f, 0.0840433687f},
-std::array<float,2>{0.296475947f, 0.702985883f},
-std::array<float,2>{0.600371301f, 0.823490739f},
-std::array<float,2>{0.249923214f, 0.318883657f},
-std::array<float,2>{0.844205558f, 0.270748407f},
-std::array<float,2>{0.42928502f, 0.805607021f},
-std::array<float,2>{0.66569972f, 0.657453716f},
-std::array<float,2>{0.0657167733f, 0.0116782635f},
-std::array<float,2>{0.511937261f, 0.145936295f},
-std::array<float,2>{0.160422504f, 0.500885963f},
-std::array<float,2>{0.905528307f, 0.992877722f},
-std::array<float,2>{0.355934769f, 0.455010146f},
-std::array<float,2>{0.585013151f, 0.371752709f},
-std::array<float,2>{0.190252781f, 0.860697687f},
-std::array<float,2>{0.966003656f, 0.729174554f},
-std::array<float,2>{0.252307028f, 0.104406223f},
-std::array<float,2>{0.762003779f, 0.234641418f},
-std::array<float,2>{0.485401094f, 0.600607097f},
-std::array<float,2>{0.728978634f, 0.917251825f},
-std::array<float,2>{0.036661122f, 0.399948865f},
-std::array<float,2>{0.911582887f, 0.477666229f},
-std::array<float,2>{0.315981358f, 0.962008178f},
-std::array<float,2>{0.559003055f, 0.546137989f},
-std::array<float,2>{0.145622075f, 0.185269386f},
-std::array<float,2>{0.627076387f, 0.0521610416f},
-std::array<float,2>{0.0944992602f, 0.63376981f},
-std::array<float,2>{0.823407233f, 0.777169168f},
-std::array<float,2>{0.376724064f, 0.281576157f},
-std::array<float,2>{0.677582741f, 0.310444772f},
-std::array<float,2>{0.0832311809f, 0.753911078f},
-std::array<float,2>{0.868323326f, 0.65343684f},
-std::array<float,2>{0.416853398f, 0.0372488052f},
-std::array<float,2>{0.882353842f, 0.166325614f},
-std::array<float,2>{0.362805247f, 0.553763449f},
-std::array<float,2>{0.521356165f, 0.938757062f},
-std::array<float,2>{0.183536127f, 0.488323689f},
-std::array<float,2>{0.791805625f, 0.379868388f},
-std::array<float,2>{0.441420555f, 0.934523225f},
-std::array<float,2>{0.702959359f, 0.624270916f},
-std::array<float,2>{0.00578500889f, 0.220141545f},
-std::array<float,2>{0.621970356f, 0.114324011f},
-std::array<float,2>{0.226621032f, 0.745784223f},
-std::array<float,2>{0.98062259f, 0.857224584f},
-std::array<float,2>{0.309450686f, 0.35396868f},
-std::array<float,2>{0.537251472f, 0.448889196f},
-std::array<float,2>{0.128458068f, 0.979324102f},
-std::array<float,2>{0.92475903f, 0.525987208f},
-std::array<float,2>{0.328634471f, 0.127838627f},
-std::array<float,2>{0.833992481f, 0.0168171618f},
-std::array<float,2>{0.405582964f, 0.682007313f},
-std::array<float,2>{0.641240478f, 0.791968167f},
-std::array<float,2>{0.117824882f, 0.255334198f},
-std::array<float,2>{0.947586894f, 0.33079198f},
-std::array<float,2>{0.266079873f, 0.831278324f},
-std::array<float,2>{0.563610852f, 0.708968759f},
-std::array<float,2>{0.206209749f, 0.0747683644f},
-std::array<float,2>{0.747522354f, 0.201244757f},
-std::array<float,2>{0.0618102401f, 0.572965622f},
-std::array<float,2>{0.774154842f, 0.877040684f},
-std::array<float,2>{0.481398642f, 0.417682379f},
-std::array<float,2>{0.669851601f, 0.384754837f},
-std::array<float,2>{0.0671273023f, 0.924125671f},
-std::array<float,2>{0.847928166f, 0.611082911f},
-std::array<float,2>{0.421959996f, 0.232903436f},
-std::array<float,2>{0.899657607f, 0.124578327f},
-std::array<float,2>{0.353991807f, 0.737886965f},
-std::array<float,2>{0.509959936f, 0.84443295f},
-std::array<float,2>{0.158833042f, 0.348426253f},
-std::array<float,2>{0.805450499f, 0.301125944f},
-std::array<float,2>{0.454609096f, 0.764246702f},
-std::array<float,2>{0.708944917f, 0.644348025f},
-std::array<float,2>{0.0195338316f, 0.0424029231f},
-std::array<float,2>{0.595840096f, 0.163772076f},
-std::array<float,2>{0.243112773f, 0.562323809f},
-std::array<float,2>{0.995161116f, 0.949658573f},
-std::array<float,2>{0.291838318f, 0.494343996f},
-std::array<float,2>{0.557706654f, 0.340390205f},
-std::array<float,2>{0.140715718f, 0.842067957f},
-std::array<float,2>{0.906646848f, 0.717540562f},
-std::array<float,2>{0.319672793f, 0.0628508404f},
-std::array<float,2>{0.825931311f, 0.190382242f},
-std::array<float,2>{0.380501091f, 0.567952335f},
-std::array<float,2>{0.630044162f, 0.88329798f},
-std::array<float,2>{0.100219078f, 0.413955867f},
-std::array<float,2>{0.961595714f, 0.442499936f},
-std::array<float,2>{0.254378498f, 0.968974531f},
-std::array<float,2>{0.578284264f, 0.518342614f},
-std::array<float,2>{0.19477354f, 0.13569513f},
-std::array<float,2>{0.73133719f, 0.0300491247f},
-std::array<float,2>{0.0348980688f, 0.673104346f},
-std::array<float,2>{0.758434772f, 0.784899533f},
-std::array<float,2>{0.489084184f, 0.258644789f},
-std::array<float,2>{0.697162688f, 0.277409434f},
-std::array<float,2>{0.00136533263f, 0.79989481f},
-std::array<float,2>{0.794908524f, 0.669839799f},
-std::array<float,2>{0.440822065f, 0.00574032869f},
-std::array<float,2>{0.977509201f, 0.148599625f},
-std::array<float,2>{0.306727886f, 0.509535253f},
-std::array<float,2>{0.617428899f, 0.990649879f},
-std::array<float,2>{0.234224081f, 0.463724077f},
-std::array<float,2>{0.873797178f, 0.423796117f},
-std::array<float,2>{0.419105709f, 0.90091604f},
-std::array<float,2>{0.674096823f, 0.58153373f},
-std::array<float,2>{0.0814841762f, 0.211690962f},
-std::array<float,2>{0.516787052f, 0.0882964656f},
-std::array<float,2>{0.18466799f, 0.690449715f},
-std::array<float,2>{0.878509164f, 0.818715811f},
-std::array<float,2>{0.364218801f, 0.324275732f},
-std::array<float,2>{0.568767846f, 0.471419424f},
-std::array<float,2>{0.21034655f, 0.95607698f},
-std::array<float,2>{0.949535728f, 0.532004714f},
-std::array<float,2>{0.272655636f, 0.179434493f},
-std::array<float,2>{0.777995586f, 0.0612894036f},
-std::array<float,2>{0.477138519f, 0.627842546f},
-std::array<float,2>{0.742740571f, 0.770285308f},
-std::array<float,2>{0.054758206f, 0.295974076f},
-std::array<float,2>{0.926145196f, 0.359423161f},
-std::array<float,2>{0.334270418f, 0.870161414f},
-std::array<float,2>{0.534422874f, 0.725538433f},
-std::array<float,2>{0.129356623f, 0.100012109f},
-std::array<float,2>{0.647798538f, 0.246132031f},
-std::array<float,2>{0.122860484f, 0.606124043f},
-std::array<float,2>{0.830093503f, 0.911583364f},
-std::array<float,2>{0.399330974f, 0.397295505f},
-std::array<float,2>{0.7372244f, 0.460570365f},
-std::array<float,2>{0.0483348519f, 0.998524725f},
-std::array<float,2>{0.770034432f, 0.505066752f},
-std::array<float,2>{0.47080791f, 0.141495541f},
-std::array<float,2>{0.940127909f, 0.0142455585f},
-std::array<float,2>{0.279303819f, 0.661104023f},
-std::array<float,2>{0.57134074f, 0.81190151f},
-std::array<float,2>{0.215379775f, 0.267583519f},
-std::array<float,2>{0.839940369f, 0.31473574f},
-std::array<float,2>{0.398230851f, 0.82608223f},
-std::array<float,2>{0.655681968f, 0.699154973f},
-std::array<float,2>{0.109658375f, 0.0785916224f},
-std::array<float,2>{0.540062308f, 0.203957111f},
-std::array<float,2>{0.133464381f, 0.586270273f},
-std::array<float,2>{0.935253024f, 0.893600106f},
-std::array<float,2>{0.343146831f, 0.43313548f},
-std::array<float,2>{0.616024613f, 0.288174331f},
-std::array<float,2>{0.219140783f, 0.777639389f},
-std::array<float,2>{0.970512748f, 0.637219846f},
-std::array<float,2>{0.303036839f, 0.0480068699f},
-std::array<float,2>{0.788571715f, 0.180417165f},
-std::array<float,2>{0.449095637f, 0.541816115f},
-std::array<float,2>{0.689869523f, 0.96656996f},
-std::array<float,2>{0.00887808762f, 0.482929766f},
-std::array<float,2>{0.889376581f, 0.403079033f},
-std::array<float,2>{0.373154789f, 0.921511889f},
-std::array<float,2>{0.525782764f, 0.593780935f},
-std::array<float,2>{0.174928427f, 0.241226256f},
-std::array<float,2>{0.683561027f, 0.10871014f},
-std::array<float,2>{0.0925195068f, 0.730914235f},
-std::array<float,2>{0.860607803f, 0.864944339f},
-std::array<float,2>{0.41110912f, 0.369496405f},
-std::array<float,2>{0.634896576f, 0.356241077f},
-std::array<float,2>{0.104388043f, 0.851851642f},
-std::array<float,2>{0.814715326f, 0.748771489f},
-std::array<float,2>{0.384144902f, 0.111430392f},
-std::array<float,2>{0.916831434f, 0.223841697f},
-std::array<float,2>{0.322734207f, 0.617205322f},
-std::array<float,2>{0.549951196f, 0.931990862f},
-std::array<float,2>{0.15563333f, 0.37862128f},
-std::array<float,2>{0.75736922f, 0.484685838f},
-std::array<float,2>{0.499916315f, 0.942409039f},
-std::array<float,2>{0.720928609f, 0.548280299f},
-std::array<float,2>{0.0459234044f, 0.16815868f},
-std::array<float,2>{0.586447179f, 0.0325885117f},
-std::array<float,2>{0.196205392f, 0.650417447f},
-std::array<float,2>{0.95930922f, 0.750324667f},
-std::array<float,2>{0.257941484f, 0.304912806f},
-std::array<float,2>{0.500971377f, 0.418377191f},
-std::array<float,2>{0.167754143f, 0.879100978f},
-std::array<float,2>{0.897084832f, 0.576026022f},
-std::array<float,2>{0.345540643f, 0.197438106f},
-std::array<float,2>{0.857827544f, 0.0713480189f},
-std::array<float,2>{0.429691851f, 0.706366897f},
-std::array<float,2>{0.657001436f, 0.832133889f},
-std::array<float,2>{0.0723975077f, 0.335163742f},
-std::array<float,2>{0.992093265f, 0.252426565f},
-std::array<float,2>{0.281872064f, 0.796001673f},
-std::array<float,2>{0.607479274f, 0.684493303f},
-std::array<float,2>{0.240836218f, 0.0227025263f},
-std::array<float,2>{0.715932012f, 0.129168272f},
-std::array<float,2>{0.0242435802f, 0.527662575f},
-std::array<float,2>{0.799054325f, 0.981602073f},
-std::array<float,2>{0.468155295f, 0.449914068f},
-std::array<float,2>{0.67029649f, 0.494513422f},
-std::array<float,2>{0.0690887272f, 0.949226916f},
-std::array<float,2>{0.850168288f, 0.562040508f},
-std::array<float,2>{0.424531043f, 0.163924307f},
-std::array<float,2>{0.901173592f, 0.0422040485f},
-std::array<float,2>{0.35204497f, 0.644237578f},
-std::array<float,2>{0.507960498f, 0.764482021f},
-std::array<float,2>{0.157341316f, 0.300980389f},
-std::array<float,2>{0.808041811f, 0.34822917f},
-std::array<float,2>{0.456387669f, 0.844654679f},
-std::array<float,2>{0.710291147f, 0.738063097f},
-std::array<float,2>{0.023196537f, 0.124827325f},
-std::array<float,2>{0.594014943f, 0.232519194f},
-std::array<float,2>{0.244926929f, 0.611208797f},
-std::array<float,2>{0.993788064f, 0.92394346f},
-std::array<float,2>{0.289384961f, 0.384419769f},
-std::array<float,2>{0.555106401f, 0.258489072f},
-std::array<float,2>{0.144061163f, 0.784932673f},
-std::array<float,2>{0.909438252f, 0.673072338f},
-std::array<float,2>{0.316661417f, 0.0298530236f},
-std::array<float,2>{0.827337086f, 0.135463506f},
-std::array<float,2>{0.380870342f, 0.518168986f},
-std::array<float,2>{0.632501364f, 0.969007432f},
-std::array<float,2>{0.0993415564f, 0.442776501f},
-std::array<float,2>{0.964325786f, 0.413717955f},
-std::array<float,2>{0.256839305f, 0.882866561f},
-std::array<float,2>{0.580795527f, 0.56816572f},
-std::array<float,2>{0.191674799f, 0.19013907f},
-std::array<float,2>{0.733441353f, 0.0625477806f},
-std::array<float,2>{0.0322735533f, 0.717297256f},
-std::array<float,2>{0.760519207f, 0.841852486f},
-std::array<float,2>{0.49154833f, 0.34070611f},
-std::array<float,2>{0.69887805f, 0.324671477f},
-std::array<float,2>{0.00260192342f, 0.818582833f},
-std::array<float,2>{0.796457708f, 0.690827847f},
-std::array<float,2>{0.438821822f, 0.0879083723f},
-std::array<float,2>{0.980301976f, 0.211501822f},
-std::array<float,2>{0.306449622f, 0.581159353f},
-std::array<float,2>{0.619385719f, 0.901232839f},
-std::array<float,2>{0.231089696f, 0.423544526f},
-std::array<float,2>{0.872435331f, 0.463490546f},
-std::array<float,2>{0.420692265f, 0.990240455f},
-std::array<float,2>{0.673766315f, 0.509285808f},
-std::array<float,2>{0.0787942186f, 0.148843974f},
-std::array<float,2>{0.517643869f, 0.00549781183f},
-std::array<float,2>{0.186108157f, 0.669517457f},
-std::array<float,2>{0.876722991f, 0.800176561f},
-std::array<float,2>{0.366237313f, 0.277783066f},
-std::array<float,2>{0.566716611f, 0.397041529f},
-std::array<float,2>{0.207342923f, 0.911155879f},
-std::array<float,2>{0.951960027f, 0.606429815f},
-std::array<float,2>{0.270972967f, 0.246562287f},
-std::array<float,2>{0.780929744f, 0.0996320695f},
-std::array<float,2>{0.479425609f, 0.725334466f},
-std::array<float,2>{0.745321512f, 0.870509207f},
-std::array<float,2>{0.0576778762f, 0.359805495f},
-std::array<float,2>{0.928530157f, 0.296198934f},
-std::array<float,2>{0.333157361f, 0.770082653f},
-std::array<float,2>{0.53281194f, 0.627465189f},
-std::array<float,2>{0.131430462f, 0.0611642338f},
-std::array<float,2>{0.645643771f, 0.179593965f},
-std::array<float,2>{0.124603346f, 0.531794369f},
-std::array<float,2>{0.828370988f, 0.956444919f},
-std::array<float,2>{0.400829226f, 0.471630573f},
-std::array<float,2>{0.736320913f, 0.43337971f},
-std::array<float,2>{0.0497415252f, 0.893917441f},
-std::array<float,2>{0.773114502f, 0.586109817f},
-std::array<float,2>{0.469886899f, 0.203705952f},
-std::array<float,2>{0.938368201f, 0.0783414543f},
-std::array<float,2>{0.277947456f, 0.698849559f},
-std::array<float,2>{0.574118912f, 0.825695455f},
-std::array<float,2>{0.217733651f, 0.314454585f},
-std::array<float,2>{0.841812491f, 0.267876178f},
-std::array<float,2>{0.395654202f, 0.811607242f},
-std::array<float,2>{0.65335393f, 0.660653949f},
-std::array<float,2>{0.111451939f, 0.0144829405f},
-std::array<float,2>{0.54207021f, 0.141150162f},
-std::array<float,2>{0.136313736f, 0.505224824f},
-std::array<float,2>{0.935929f, 0.998127401f},
-std::array<float,2>{0.34051311f, 0.460806608f},
-std::array<float,2>{0.61408174f, 0.369168669f},
-std::array<float,2>{0.221620932f, 0.865177929f},
-std::array<float,2>{0.971552968f, 0.730642378f},
-std::array<float,2>{0.302282125f, 0.108629733f},
-std::array<float,2>{0.786892653f, 0.241625294f},
-std::array<float,2>{0.446050256f, 0.594210923f},
-std::array<float,2>{0.689033031f, 0.921727419f},
-std::array<float,2>{0.0103699677f, 0.402934283f},
-std::array<float,2>{0.888454854f, 0.483182043f},
-std::array<float,2>{0.371193886f, 0.966354191f},
-std::array<float,2>{0.525105178f, 0.541662812f},
-std::array<float,2>{0.172955319f, 0.180549011f},
-std::array<float,2>{0.679821968f, 0.0481472313f},
-std::array<float,2>{0.0910933316f, 0.637595892f},
-std::array<float,2>{0.862549961f, 0.777580738f},
-std::array<float,2>{0.413307101f, 0.288375318f},
-std::array<float,2>{0.633500218f, 0.304959357f},
-std::array<float,2>{0.101829596f, 0.750119567f},
-std::array<float,2>{0.813224733f, 0.65078932f},
-std::array<float,2>{0.386651427f, 0.0322875045f},
-std::array<float,2>{0.915151358f, 0.168413758f},
-std::array<float,2>{0.321013242f, 0.547881603f},
-std::array<float,2>{0.54757607f, 0.942629278f},
-std::array<float,2>{0.152512401f, 0.484385431f},
-std::array<float,2>{0.754850745f, 0.378857791f},
-std::array<float,2>{0.49782303f, 0.931697905f},
-std::array<float,2>{0.718928337f, 0.617559671f},
-std::array<float,2>{0.0439196937f, 0.224046513f},
-std::array<float,2>{0.589248598f, 0.11174342f},
-std::array<float,2>{0.197629079f, 0.748849273f},
-std::array<float,2>{0.957969844f, 0.851720631f},
-std::array<float,2>{0.261617005f, 0.355984807f},
-std::array<float,2>{0.502567768f, 0.450090498f},
-std::array<float,2>{0.165100589f, 0.981813312f},
-std::array<float,2>{0.896179497f, 0.527452171f},
-std::array<float,2>{0.347357452f, 0.129059389f},
-std::array<float,2>{0.857088387f, 0.0227616485f},
-std::array<float,2>{0.433279246f, 0.68413955f},
-std::array<float,2>{0.658462703f, 0.796326518f},
-std::array<float,2>{0.0716135502f, 0.252155542f},
-std::array<float,2>{0.990156412f, 0.335234433f},
-std::array<float,2>{0.283485353f, 0.83249861f},
-std::array<float,2>{0.607216001f, 0.706200063f},
-std::array<float,2>{0.238387078f, 0.0716915205f},
-std::array<float,2>{0.717396319f, 0.197555631f},
-std::array<float,2>{0.0266492814f, 0.575796008f},
-std::array<float,2>{0.797817588f, 0.879351079f},
-std::array<float,2>{0.466421515f, 0.417974591f},
-std::array<float,2>{0.650720954f, 0.389460832f},
-std::array<float,2>{0.114633009f, 0.927024484f},
-std::array<float,2>{0.838504434f, 0.61494416f},
-std::array<float,2>{0.392560929f, 0.229777679f},
-std::array<float,2>{0.931424141f, 0.117196143f},
-std::array<float,2>{0.339466631f, 0.739796221f},
-std::array<float,2>{0.543327034f, 0.847946465f},
-std::array<float,2>{0.138726741f, 0.345737845f},
-std::array<float,2>{0.767072082f, 0.298553497f},
-std::array<float,2>{0.474665195f, 0.757970393f},
-std::array<float,2>{0.741439879f, 0.647498906f},
-std::array<float,2>{0.0523577332f, 0.0460002311f},
-std::array<float,2>{0.578113258f, 0.157421947f},
-std::array<float,2>{0.211293459f, 0.556039929f},
-std::array<float,2>{0.945310056f, 0.947609723f},
-std::array<float,2>{0.277176112f, 0.497129351f},
-std::array<float,2>{0.528819382f, 0.338840395f},
-std::array<float,2>{0.17778483f, 0.83665961f},
-std::array<float,2>{0.886646926f, 0.714534342f},
-std::array<float,2>{0.368638545f, 0.0698366016f},
-std::array<float,2>{0.865252376f, 0.19508402f},
-std::array<float,2>{0.407001317f, 0.562713683f},
-std::array<float,2>{0.687274575f, 0.890356243f},
-std::array<float,2>{0.0878766403f, 0.407049924f},
-std::array<float,2>{0.973817289f, 0.438213527f},
-std::array<float,2>{0.297104627f, 0.973013341f},
-std::array<float,2>{0.612999558f, 0.521826744f},
-std::array<float,2>{0.225373954f, 0.138825223f},
-std::array<float,2>{0.693053067f, 0.0243244264f},
-std::array<float,2>{0.0133536234f, 0.67634654f},
-std::array<float,2>{0.783536792f, 0.787901282f},
-std::array<float,2>{0.451946557f, 0.262740105f},
-std::array<float,2>{0.725446343f, 0.2736184f},
-std::array<float,2>{0.042161949f, 0.804012477f},
-std::array<float,2>{0.750274658f, 0.665775299f},
-std::array<float,2>{0.494092733f, 1.72613218e-05f},
-std::array<float,2>{0.954207122f, 0.153564394f},
-std::array<float,2>{0.263501674f, 0.512893617f},
-std::array<float,2>{0.593243957f, 0.988154113f},
-std::array<float,2>{0.200839043f, 0.467182845f},
-std::array<float,2>{0.819771051f, 0.429263443f},
-std::array<float,2>{0.388210684f, 0.904959619f},
-std::array<float,2>{0.639607728f, 0.582207918f},
-std::array<float,2>{0.108120814f, 0.217217997f},
-std::array<float,2>{0.551169693f, 0.0937217176f},
-std::array<float,2>{0.149109453f, 0.692272484f},
-std::array<float,2>{0.919057071f, 0.814302683f},
-std::array<float,2>{0.325359792f, 0.322751373f},
-std::array<float,2>{0.603321075f, 0.475825459f},
-std::array<float,2>{0.238196492f, 0.960152745f},
-std::array<float,2>{0.984643996f, 0.535903513f},
-std::array<float,2>{0.288279802f, 0.173783481f},
-std::array<float,2>{0.802883863f, 0.0569497645f},
-std::array<float,2>{0.463238508f, 0.632555664f},
-std::array<float,2>{0.711840034f, 0.768408537f},
-std::array<float,2>{0.0304290019f, 0.291732579f},
-std::array<float,2>{0.892793834f, 0.365234286f},
-std::array<float,2>{0.349502504f, 0.872302532f},
-std::array<float,2>{0.504502356f, 0.721224904f},
-std::array<float,2>{0.171733543f, 0.095039472f},
-std::array<float,2>{0.66024965f, 0.244960845f},
-std::array<float,2>{0.0779411942f, 0.604186952f},
-std::array<float,2>{0.855346024f, 0.909551263f},
-std::array<float,2>{0.437479794f, 0.393670499f},
-std::array<float,2>{0.704014838f, 0.454718769f},
-std::array<float,2>{0.017679438f, 0.993048251f},
-std::array<float,2>{0.81140089f, 0.500677347f},
-std::array<float,2>{0.460212857f, 0.145525917f},
-std::array<float,2>{0.998776615f, 0.0112661757f},
-std::array<float,2>{0.293704629f, 0.657665968f},
-std::array<float,2>{0.598019361f, 0.805355489f},
-std::array<float,2>{0.247848034f, 0.270912856f},
-std::array<float,2>{0.846314549f, 0.319094449f},
-std::array<float,2>{0.426307946f, 0.823294222f},
-std::array<float,2>{0.667274654f, 0.702799678f},
-std::array<float,2>{0.0637480393f, 0.0842452198f},
-std::array<float,2>{0.513988197f, 0.209408388f},
-std::array<float,2>{0.162704185f, 0.593624771f},
-std::array<float,2>{0.902350485f, 0.89577955f},
-std::array<float,2>{0.359142363f, 0.435389519f},
-std::array<float,2>{0.583609283f, 0.281280428f},
-std::array<float,2>{0.188752204f, 0.777094483f},
-std::array<float,2>{0.968090296f, 0.633425057f},
-std::array<float,2>{0.251906574f, 0.0519766696f},
-std::array<float,2>{0.765039265f, 0.185419217f},
-std::array<float,2>{0.487187475f, 0.546144962f},
-std::array<float,2>{0.727921844f, 0.96230346f},
-std::array<float,2>{0.0378865004f, 0.477987319f},
-std::array<float,2>{0.91348964f, 0.400174648f},
-std::array<float,2>{0.312716156f, 0.917119801f},
-std::array<float,2>{0.561734259f, 0.60089612f},
-std::array<float,2>{0.147494808f, 0.234540194f},
-std::array<float,2>{0.62605828f, 0.104100786f},
-std::array<float,2>{0.0974316821f, 0.729352355f},
-std::array<float,2>{0.821799994f, 0.860398591f},
-std::array<float,2>{0.377014548f, 0.371971071f},
-std::array<float,2>{0.67944932f, 0.353559792f},
-std::array<float,2>{0.0857903212f, 0.85708487f},
-std::array<float,2>{0.87035799f, 0.745963335f},
-std::array<float,2>{0.415995628f, 0.114624232f},
-std::array<float,2>{0.879809797f, 0.219929695f},
-std::array<float,2>{0.36028266f, 0.624243081f},
-std::array<float,2>{0.521992266f, 0.934162676f},
-std::array<float,2>{0.180010244f, 0.379531533f},
-std::array<float,2>{0.789336145f, 0.488590449f},
-std::array<float,2>{0.443932146f, 0.938656032f},
-std::array<float,2>{0.699993312f, 0.554065824f},
-std::array<float,2>{0.00668386742f, 0.166035518f},
-std::array<float,2>{0.624785125f, 0.0375558101f},
-std::array<float,2>{0.229894251f, 0.653688431f},
-std::array<float,2>{0.982606888f, 0.754204571f},
-std::array<float,2>{0.312196821f, 0.31010285f},
-std::array<float,2>{0.53530103f, 0.417963535f},
-std::array<float,2>{0.12578994f, 0.877372205f},
-std::array<float,2>{0.922575355f, 0.573046327f},
-std::array<float,2>{0.330793649f, 0.201656222f},
-std::array<float,2>{0.832874179f, 0.0749769285f},
-std::array<float,2>{0.40366143f, 0.708595574f},
-std::array<float,2>{0.643864334f, 0.831411242f},
-std::array<float,2>{0.120402947f, 0.33085987f},
-std::array<float,2>{0.945408106f, 0.254944563f},
-std::array<float,2>{0.268264681f, 0.791691899f},
-std::array<float,2>{0.565932035f, 0.68167907f},
-std::array<float,2>{0.204309449f, 0.0168802142f},
-std::array<float,2>{0.748108923f, 0.127661914f},
-std::array<float,2>{0.0604609028f, 0.526186526f},
-std::array<float,2>{0.776188314f, 0.97922343f},
-std::array<float,2>{0.483898103f, 0.44905749f},
-std::array<float,2>{0.628975451f, 0.444907099f},
-std::array<float,2>{0.101365529f, 0.972457528f},
-std::array<float,2>{0.824699104f, 0.516463637f},
-std::array<float,2>{0.379297853f, 0.133943692f},
-std::array<float,2>{0.907926142f, 0.0274952631f},
-std::array<float,2>{0.318499535f, 0.674915552f},
-std::array<float,2>{0.557456553f, 0.782325447f},
-std::array<float,2>{0.142283008f, 0.260750979f},
-std::array<float,2>{0.759298384f, 0.342300981f},
-std::array<float,2>{0.489756316f, 0.840839148f},
-std::array<float,2>{0.732039511f, 0.715093791f},
-std::array<float,2>{0.0336747952f, 0.0658714995f},
-std::array<float,2>{0.579516351f, 0.189216256f},
-std::array<float,2>{0.194005132f, 0.568370938f},
-std::array<float,2>{0.962371171f, 0.885639191f},
-std::array<float,2>{0.255372316f, 0.41192922f},
-std::array<float,2>{0.511194944f, 0.303910226f},
-std::array<float,2>{0.159936473f, 0.763024211f},
-std::array<float,2>{0.898811221f, 0.640953422f},
-std::array<float,2>{0.355029047f, 0.0405012704f},
-std::array<float,2>{0.848987103f, 0.161996305f},
-std::array<float,2>{0.423409253f, 0.559013009f},
-std::array<float,2>{0.668031931f, 0.95241487f},
-std::array<float,2>{0.0676179156f, 0.493812829f},
-std::array<float,2>{0.99496913f, 0.386485338f},
-std::array<float,2>{0.29259342f, 0.922004223f},
-std::array<float,2>{0.597071767f, 0.612264931f},
-std::array<float,2>{0.243373916f, 0.231420085f},
-std::array<float,2>{0.707197607f, 0.121959604f},
-std::array<float,2>{0.0211350787f, 0.735304236f},
-std::array<float,2>{0.806439638f, 0.847059786f},
-std::array<float,2>{0.453804612f, 0.351431549f},
-std::array<float,2>{0.743682504f, 0.363171637f},
-std::array<float,2>{0.0557113364f, 0.868041754f},
-std::array<float,2>{0.778761804f, 0.723763168f},
-std::array<float,2>{0.478128523f, 0.09783227f},
-std::array<float,2>{0.950227559f, 0.249801368f},
-std::array<float,2>{0.272187203f, 0.608816206f},
-std::array<float,2>{0.569936633f, 0.912392795f},
-std::array<float,2>{0.209221587f, 0.396068931f},
-std::array<float,2>{0.831436276f, 0.468911409f},
-std::array<float,2>{0.400018275f, 0.953404605f},
-std::array<float,2>{0.647113323f, 0.533626139f},
-std::array<float,2>{0.121370934f, 0.176143736f},
-std::array<float,2>{0.534040391f, 0.0601528585f},
-std::array<float,2>{0.130272001f, 0.625146091f},
-std::array<float,2>{0.92692703f, 0.772239566f},
-std::array<float,2>{0.335785568f, 0.293410063f},
-std::array<float,2>{0.618682861f, 0.424844474f},
-std::array<float,2>{0.233021691f, 0.899613738f},
-std::array<float,2>{0.977648795f, 0.579022408f},
-std::array<float,2>{0.308154434f, 0.213477835f},
-std::array<float,2>{0.793121219f, 0.0860311165f},
-std::array<float,2>{0.440063387f, 0.688923538f},
-std::array<float,2>{0.695678592f, 0.81698215f},
-std::array<float,2>{0.000162863987f, 0.327495903f},
-std::array<float,2>{0.877895355f, 0.280807316f},
-std::array<float,2>{0.364666939f, 0.797865927f},
-std::array<float,2>{0.51563859f, 0.671852648f},
-std::array<float,2>{0.18413803f, 0.00670822524f},
-std::array<float,2>{0.674898505f, 0.151986882f},
-std::array<float,2>{0.0803055987f, 0.511512101f},
-std::array<float,2>{0.874317348f, 0.9898839f},
-std::array<float,2>{0.418477237f, 0.461378127f},
-std::array<float,2>{0.690670371f, 0.405462593f},
-std::array<float,2>{0.00841164123f, 0.919773161f},
-std::array<float,2>{0.787677348f, 0.59660393f},
-std::array<float,2>{0.447557092f, 0.240202367f},
-std::array<float,2>{0.96941638f, 0.106157511f},
-std::array<float,2>{0.304191291f, 0.733715057f},
-std::array<float,2>{0.616376936f, 0.865503371f},
-std::array<float,2>{0.219736278f, 0.368041873f},
-std::array<float,2>{0.859733164f, 0.286810905f},
-std::array<float,2>{0.411239177f, 0.781124949f},
-std::array<float,2>{0.682210684f, 0.639587581f},
-std::array<float,2>{0.0933474526f, 0.0506940186f},
-std::array<float,2>{0.526640058f, 0.181895956f},
-std::array<float,2>{0.17432557f, 0.540594161f},
-std::array<float,2>{0.890569627f, 0.968566f},
-std::array<float,2>{0.374179959f, 0.480691701f},
-std::array<float,2>{0.570575833f, 0.313952267f},
-std::array<float,2>{0.216658309f, 0.826504886f},
-std::array<float,2>{0.940631747f, 0.696630597f},
-std::array<float,2>{0.28095457f, 0.081550926f},
-std::array<float,2>{0.771013618f, 0.206230134f},
-std::array<float,2>{0.471709251f, 0.588176966f},
-std::array<float,2>{0.738237441f, 0.892040908f},
-std::array<float,2>{0.047257401f, 0.430116266f},
-std::array<float,2>{0.933676839f, 0.458467036f},
-std::array<float,2>{0.342192888f, 0.996798694f},
-std::array<float,2>{0.539299369f, 0.507787526f},
-std::array<float,2>{0.134739697f, 0.143019229f},
-std::array<float,2>{0.654817879f, 0.0130635984f},
-std::array<float,2>{0.110592179f, 0.66352123f},
-std::array<float,2>{0.841426194f, 0.809594452f},
-std::array<float,2>{0.397196233f, 0.26590547f},
-std::array<float,2>{0.657425344f, 0.251014978f},
-std::array<float,2>{0.0735208094f, 0.793397069f},
-std::array<float,2>{0.859001994f, 0.685609996f},
-std::array<float,2>{0.431295425f, 0.0199024715f},
-std::array<float,2>{0.897999883f, 0.130995885f},
-std::array<float,2>{0.344607145f, 0.529773176f},
-std::array<float,2>{0.501688898f, 0.983008265f},
-std::array<float,2>{0.166394845f, 0.452439159f},
-std::array<float,2>{0.800222993f, 0.41996026f},
-std::array<float,2>{0.46692729f, 0.882754683f},
-std::array<float,2>{0.71505779f, 0.578071654f},
-std::array<float,2>{0.0248119794f, 0.197094947f},
-std::array<float,2>{0.608969152f, 0.0729358792f},
-std::array<float,2>{0.241950199f, 0.704485118f},
-std::array<float,2>{0.990667224f, 0.835583627f},
-std::array<float,2>{0.282820821f, 0.333394974f},
-std::array<float,2>{0.549434066f, 0.486699432f},
-std::array<float,2>{0.154528722f, 0.94505471f},
-std::array<float,2>{0.917713284f, 0.549601376f},
-std::array<float,2>{0.323650241f, 0.170564204f},
-std::array<float,2>{0.815909028f, 0.0337648205f},
-std::array<float,2>{0.383523047f, 0.64938879f},
-std::array<float,2>{0.636064112f, 0.753471792f},
-std::array<float,2>{0.105236791f, 0.307742387f},
-std::array<float,2>{0.96022737f, 0.358188272f},
-std::array<float,2>{0.259398341f, 0.854364336f},
-std::array<float,2>{0.587687016f, 0.746621132f},
-std::array<float,2>{0.196991965f, 0.11091806f},
-std::array<float,2>{0.722341359f, 0.225283772f},
-std::array<float,2>{0.045485884f, 0.619689703f},
-std::array<float,2>{0.756055713f, 0.929781377f},
-std::array<float,2>{0.498551369f, 0.3752819f},
-std::array<float,2>{0.684849501f, 0.408628583f},
-std::array<float,2>{0.0881675929f, 0.88750267f},
-std::array<float,2>{0.864072621f, 0.56454581f},
-std::array<float,2>{0.408467442f, 0.192808926f},
-std::array<float,2>{0.884442806f, 0.0679708645f},
-std::array<float,2>{0.370154202f, 0.71213001f},
-std::array<float,2>{0.530196309f, 0.839174807f},
-std::array<float,2>{0.177225038f, 0.336476892f},
-std::array<float,2>{0.782201529f, 0.265106559f},
-std::array<float,2>{0.450709313f, 0.786315024f},
-std::array<float,2>{0.694194317f, 0.678589404f},
-std::array<float,2>{0.0139116021f, 0.0254740678f},
-std::array<float,2>{0.609888613f, 0.137754098f},
-std::array<float,2>{0.222799435f, 0.520685971f},
-std::array<float,2>{0.975989103f, 0.974802375f},
-std::array<float,2>{0.298835874f, 0.439987898f},
-std::array<float,2>{0.54520756f, 0.344457775f},
-std::array<float,2>{0.137172312f, 0.851330757f},
-std::array<float,2>{0.932571113f, 0.740896583f},
-std::array<float,2>{0.337821901f, 0.119684651f},
-std::array<float,2>{0.836049139f, 0.228499383f},
-std::array<float,2>{0.393415242f, 0.615244687f},
-std::array<float,2>{0.649374068f, 0.92857033f},
-std::array<float,2>{0.116357215f, 0.387407988f},
-std::array<float,2>{0.942462564f, 0.498443484f},
-std::array<float,2>{0.275280327f, 0.946219385f},
-std::array<float,2>{0.575742304f, 0.557777464f},
-std::array<float,2>{0.214115515f, 0.158656269f},
-std::array<float,2>{0.738505542f, 0.0442936383f},
-std::array<float,2>{0.0536800958f, 0.646200299f},
-std::array<float,2>{0.767865717f, 0.760809481f},
-std::array<float,2>{0.473302811f, 0.299806803f},
-std::array<float,2>{0.713613868f, 0.290130019f},
-std::array<float,2>{0.0287011247f, 0.766907573f},
-std::array<float,2>{0.802183509f, 0.630117714f},
-std::array<float,2>{0.461784512f, 0.0553966165f},
-std::array<float,2>{0.986414254f, 0.174637273f},
-std::array<float,2>{0.286734521f, 0.537419021f},
-std::array<float,2>{0.604991853f, 0.958045185f},
-std::array<float,2>{0.235806003f, 0.472744375f},
-std::array<float,2>{0.851662815f, 0.391165733f},
-std::array<float,2>{0.434991449f, 0.906261981f},
-std::array<float,2>{0.662442565f, 0.60349375f},
-std::array<float,2>{0.0759667084f, 0.242710739f},
-std::array<float,2>{0.506785691f, 0.0972727388f},
-std::array<float,2>{0.169241205f, 0.7192837f},
-std::array<float,2>{0.892276764f, 0.874235928f},
-std::array<float,2>{0.350785285f, 0.366574943f},
-std::array<float,2>{0.590501308f, 0.465533286f},
-std::array<float,2>{0.201818764f, 0.98533076f},
-std::array<float,2>{0.95596832f, 0.515543759f},
-std::array<float,2>{0.265532553f, 0.155180007f},
-std::array<float,2>{0.753815114f, 0.00214884779f},
-std::array<float,2>{0.495966315f, 0.667563736f},
-std::array<float,2>{0.722859383f, 0.80191952f},
-std::array<float,2>{0.0392529927f, 0.276494503f},
-std::array<float,2>{0.920178592f, 0.321883976f},
-std::array<float,2>{0.326298892f, 0.814682722f},
-std::array<float,2>{0.5535568f, 0.693469107f},
-std::array<float,2>{0.151803136f, 0.0902255699f},
-std::array<float,2>{0.637845516f, 0.216690853f},
-std::array<float,2>{0.107213683f, 0.585272074f},
-std::array<float,2>{0.817201316f, 0.903918624f},
-std::array<float,2>{0.389770687f, 0.42663309f},
-std::array<float,2>{0.729782164f, 0.480181396f},
-std::array<float,2>{0.0351785459f, 0.963146269f},
-std::array<float,2>{0.762960255f, 0.543385923f},
-std::array<float,2>{0.484606475f, 0.186530307f},
-std::array<float,2>{0.965209961f, 0.0540401004f},
-std::array<float,2>{0.25299412f, 0.636570096f},
-std::array<float,2>{0.584701538f, 0.773920834f},
-std::array<float,2>{0.190845653f, 0.284733891f},
-std::array<float,2>{0.823154747f, 0.37392652f},
-std::array<float,2>{0.375147402f, 0.862838209f},
-std::array<float,2>{0.628772318f, 0.727767944f},
-std::array<float,2>{0.0951070264f, 0.102033779f},
-std::array<float,2>{0.560526133f, 0.236521572f},
-std::array<float,2>{0.144899726f, 0.599024832f},
-std::array<float,2>{0.910648286f, 0.914787173f},
-std::array<float,2>{0.315232992f, 0.402116895f},
-std::array<float,2>{0.600932479f, 0.273054719f},
-std::array<float,2>{0.248321205f, 0.807236612f},
-std::array<float,2>{0.99658519f, 0.659456432f},
-std::array<float,2>{0.295801669f, 0.00965743139f},
-std::array<float,2>{0.809524775f, 0.147797048f},
-std::array<float,2>{0.457294554f, 0.503674746f},
-std::array<float,2>{0.706306517f, 0.995770216f},
-std::array<float,2>{0.0166622363f, 0.455672264f},
-std::array<float,2>{0.904931962f, 0.437498868f},
-std::array<float,2>{0.357307553f, 0.898014307f},
-std::array<float,2>{0.513061821f, 0.590857625f},
-std::array<float,2>{0.16155155f, 0.208164036f},
-std::array<float,2>{0.664758265f, 0.0830403045f},
-std::array<float,2>{0.0652623102f, 0.700383782f},
-std::array<float,2>{0.845519304f, 0.822015703f},
-std::array<float,2>{0.427988529f, 0.318193853f},
-std::array<float,2>{0.641975164f, 0.328548133f},
-std::array<float,2>{0.118886724f, 0.829141855f},
-std::array<float,2>{0.835656285f, 0.710866392f},
-std::array<float,2>{0.404985666f, 0.0762711614f},
-std::array<float,2>{0.924880028f, 0.200901121f},
-std::array<float,2>{0.329157054f, 0.571579337f},
-std::array<float,2>{0.538444757f, 0.876207173f},
-std::array<float,2>{0.127695069f, 0.415324926f},
-std::array<float,2>{0.77469945f, 0.445966065f},
-std::array<float,2>{0.481486678f, 0.977205932f},
-std::array<float,2>{0.746739984f, 0.525202036f},
-std::array<float,2>{0.0605661608f, 0.126724973f},
-std::array<float,2>{0.562984705f, 0.0189933106f},
-std::array<float,2>{0.20579499f, 0.680416346f},
-std::array<float,2>{0.948462665f, 0.790991247f},
-std::array<float,2>{0.266738027f, 0.256254554f},
-std::array<float,2>{0.519598544f, 0.382612169f},
-std::array<float,2>{0.182599202f, 0.936783314f},
-std::array<float,2>{0.881660223f, 0.622824669f},
-std::array<float,2>{0.362267017f, 0.220778629f},
-std::array<float,2>{0.867712617f, 0.115899436f},
-std::array<float,2>{0.417397052f, 0.7424739f},
-std::array<float,2>{0.676430881f, 0.857565165f},
-std::array<float,2>{0.0828859061f, 0.353388816f},
-std::array<float,2>{0.981619716f, 0.310862064f},
-std::array<float,2>{0.309928387f, 0.757612526f},
-std::array<float,2>{0.622668505f, 0.655225396f},
-std::array<float,2>{0.228453308f, 0.0360653885f},
-std::array<float,2>{0.701704085f, 0.164913133f},
-std::array<float,2>{0.00425532646f, 0.5514642f},
-std::array<float,2>{0.792229831f, 0.939761996f},
-std::array<float,2>{0.442389607f, 0.490390062f},
-std::array<float,2>{0.672376513f, 0.462035805f},
-std::array<float,2>{0.0793938339f, 0.988521814f},
-std::array<float,2>{0.871367574f, 0.510125756f},
-std::array<float,2>{0.421321601f, 0.151282743f},
-std::array<float,2>{0.875948668f, 0.00745539228f},
-std::array<float,2>{0.365558833f, 0.670351386f},
-std::array<float,2>{0.518789053f, 0.797267079f},
-std::array<float,2>{0.187487319f, 0.280108154f},
-std::array<float,2>{0.795234919f, 0.326207191f},
-std::array<float,2>{0.437753975f, 0.818217933f},
-std::array<float,2>{0.697450936f, 0.687543392f},
-std::array<float,2>{0.00385516207f, 0.0871735141f},
-std::array<float,2>{0.621053636f, 0.214677215f},
-std::array<float,2>{0.23145099f, 0.579723001f},
-std::array<float,2>{0.978890598f, 0.89935714f},
-std::array<float,2>{0.305174202f, 0.423930913f},
-std::array<float,2>{0.5318802f, 0.294322163f},
-std::array<float,2>{0.132092208f, 0.772461951f},
-std::array<float,2>{0.929071963f, 0.626279712f},
-std::array<float,2>{0.332752734f, 0.0586513244f},
-std::array<float,2>{0.829912007f, 0.176967129f},
-std::array<float,2>{0.40189746f, 0.535004616f},
-std::array<float,2>{0.645327032f, 0.95433414f},
-std::array<float,2>{0.12306314f, 0.470135272f},
-std::array<float,2>{0.95231235f, 0.394764006f},
-std::array<float,2>{0.270235538f, 0.913226664f},
-std::array<float,2>{0.567470551f, 0.608110011f},
-std::array<float,2>{0.2085049f, 0.248265743f},
-std::array<float,2>{0.744954228f, 0.0992510319f},
-std::array<float,2>{0.0566615313f, 0.72308296f},
-std::array<float,2>{0.779323637f, 0.868307233f},
-std::array<float,2>{0.48041746f, 0.361864746f},
-std::array<float,2>{0.709245265f, 0.350171119f},
-std::array<float,2>{0.0216864534f, 0.846228659f},
-std::array<float,2>{0.8069489f, 0.735571921f},
-std::array<float,2>{0.455689609f, 0.12244986f},
-std::array<float,2>{0.993057072f, 0.231822789f},
-std::array<float,2>{0.290361941f, 0.613103211f},
-std::array<float,2>{0.595640481f, 0.923228383f},
-std::array<float,2>{0.245683312f, 0.385243267f},
-std::array<float,2>{0.851054788f, 0.492346048f},
-std::array<float,2>{0.424835831f, 0.952127874f},
-std::array<float,2>{0.671834528f, 0.559715509f},
-std::array<float,2>{0.070167467f, 0.160563186f},
-std::array<float,2>{0.509397209f, 0.0397416987f},
-std::array<float,2>{0.157082051f, 0.642100871f},
-std::array<float,2>{0.901958764f, 0.76175046f},
-std::array<float,2>{0.352781236f, 0.303200573f},
-std::array<float,2>{0.581548035f, 0.410550326f},
-std::array<float,2>{0.19288899f, 0.8867082f},
-std::array<float,2>{0.963096738f, 0.569681048f},
-std::array<float,2>{0.256793678f, 0.187973067f},
-std::array<float,2>{0.761529207f, 0.0653388947f},
-std::array<float,2>{0.490721643f, 0.71636641f},
-std::array<float,2>{0.732437789f, 0.840273142f},
-std::array<float,2>{0.0317260325f, 0.343290955f},
-std::array<float,2>{0.908395112f, 0.260181308f},
-std::array<float,2>{0.317996919f, 0.781865358f},
-std::array<float,2>{0.555690706f, 0.674056828f},
-std::array<float,2>{0.142629549f, 0.0288648773f},
-std::array<float,2>{0.631048024f, 0.132975802f},
-std::array<float,2>{0.0981713831f, 0.516786933f},
-std::array<float,2>{0.82695055f, 0.971019745f},
-std::array<float,2>{0.382794082f, 0.444258511f},
-std::array<float,2>{0.71974349f, 0.376829952f},
-std::array<float,2>{0.0441059731f, 0.93137008f},
-std::array<float,2>{0.755360842f, 0.621068478f},
-std::array<float,2>{0.496731669f, 0.225765795f},
-std::array<float,2>{0.958296478f, 0.110176161f},
-std::array<float,2>{0.259850025f, 0.747496009f},
-std::array<float,2>{0.588796675f, 0.855172217f},
-std::array<float,2>{0.198284894f, 0.358708054f},
-std::array<float,2>{0.813537061f, 0.30701226f},
-std::array<float,2>{0.385388017f, 0.752268493f},
-std::array<float,2>{0.634718776f, 0.649550974f},
-std::array<float,2>{0.103476219f, 0.035125874f},
-std::array<float,2>{0.548151433f, 0.171811059f},
-std::array<float,2>{0.153890088f, 0.550625682f},
-std::array<float,2>{0.914496064f, 0.944251478f},
-std::array<float,2>{0.321839958f, 0.488270849f},
-std::array<float,2>{0.605888426f, 0.33220613f},
-std::array<float,2>{0.239531636f, 0.834136367f},
-std::array<float,2>{0.989094079f, 0.70386523f},
-std::array<float,2>{0.28470999f, 0.0732674301f},
-std::array<float,2>{0.79845655f, 0.196087763f},
-std::array<float,2>{0.46495083f, 0.576428771f},
-std::array<float,2>{0.718153954f, 0.881254971f},
-std::array<float,2>{0.0261570625f, 0.421447933f},
-std::array<float,2>{0.895124972f, 0.451262474f},
-std::array<float,2>{0.346449256f, 0.983623385f},
-std::array<float,2>{0.503391623f, 0.530997217f},
-std::array<float,2>{0.164897725f, 0.132479876f},
-std::array<float,2>{0.659552753f, 0.0210916176f},
-std::array<float,2>{0.070893541f, 0.686645865f},
-std::array<float,2>{0.855563462f, 0.794074655f},
-std::array<float,2>{0.432342917f, 0.250323266f},
-std::array<float,2>{0.653247714f, 0.266979545f},
-std::array<float,2>{0.112775721f, 0.808633149f},
-std::array<float,2>{0.843540549f, 0.662544549f},
-std::array<float,2>{0.394883245f, 0.0120399483f},
-std::array<float,2>{0.937404215f, 0.143982127f},
-std::array<float,2>{0.340911627f, 0.505890608f},
-std::array<float,2>{0.541325569f, 0.997325361f},
-std::array<float,2>{0.135430053f, 0.457688004f},
-std::array<float,2>{0.771814167f, 0.431422681f},
-std::array<float,2>{0.469639629f, 0.890743613f},
-std::array<float,2>{0.734741509f, 0.589684665f},
-std::array<float,2>{0.0499183945f, 0.205794409f},
-std::array<float,2>{0.572775424f, 0.0806836709f},
-std::array<float,2>{0.218428522f, 0.695877612f},
-std::array<float,2>{0.939050794f, 0.82750833f},
-std::array<float,2>{0.27854231f, 0.312608778f},
-std::array<float,2>{0.523771167f, 0.48178196f},
-std::array<float,2>{0.172497362f, 0.96748668f},
-std::array<float,2>{0.887290299f, 0.539297283f},
-std::array<float,2>{0.372636914f, 0.182941392f},
-std::array<float,2>{0.861543536f, 0.0491564907f},
-std::array<float,2>{0.412806332f, 0.640167654f},
-std::array<float,2>{0.6813761f, 0.77984035f},
-std::array<float,2>{0.0906309187f, 0.285248548f},
-std::array<float,2>{0.97246927f, 0.368941426f},
-std::array<float,2>{0.301522821f, 0.866707504f},
-std::array<float,2>{0.614697576f, 0.733257473f},
-std::array<float,2>{0.221826881f, 0.106998436f},
-std::array<float,2>{0.687507749f, 0.238513932f},
-std::array<float,2>{0.0115493285f, 0.597268879f},
-std::array<float,2>{0.786113858f, 0.91845566f},
-std::array<float,2>{0.447026789f, 0.404765368f},
-std::array<float,2>{0.640075862f, 0.427613348f},
-std::array<float,2>{0.108875833f, 0.902778447f},
-std::array<float,2>{0.819194555f, 0.584737003f},
-std::array<float,2>{0.386912614f, 0.21561785f},
-std::array<float,2>{0.918472469f, 0.0914948732f},
-std::array<float,2>{0.324953556f, 0.694578052f},
-std::array<float,2>{0.552557886f, 0.815878749f},
-std::array<float,2>{0.149464503f, 0.321267754f},
-std::array<float,2>{0.7517066f, 0.276000232f},
-std::array<float,2>{0.492613077f, 0.801610827f},
-std::array<float,2>{0.726519704f, 0.666207671f},
-std::array<float,2>{0.0413281694f, 0.00341556664f},
-std::array<float,2>{0.592750311f, 0.156127393f},
-std::array<float,2>{0.19966051f, 0.514453709f},
-std::array<float,2>{0.953475535f, 0.985617042f},
-std::array<float,2>{0.262132823f, 0.466703266f},
-std::array<float,2>{0.505006194f, 0.365235299f},
-std::array<float,2>{0.170454279f, 0.873943686f},
-std::array<float,2>{0.894441187f, 0.72022891f},
-std::array<float,2>{0.34812212f, 0.09623871f},
-std::array<float,2>{0.853924453f, 0.243843794f},
-std::array<float,2>{0.436423004f, 0.601666927f},
-std::array<float,2>{0.661855757f, 0.907769978f},
-std::array<float,2>{0.0766948164f, 0.392197996f},
-std::array<float,2>{0.985843301f, 0.473984748f},
-std::array<float,2>{0.28781113f, 0.957994699f},
-std::array<float,2>{0.60170871f, 0.538659513f},
-std::array<float,2>{0.236872137f, 0.175614521f},
-std::array<float,2>{0.712034822f, 0.0564336143f},
-std::array<float,2>{0.02979015f, 0.628998816f},
-std::array<float,2>{0.804296732f, 0.766423285f},
-std::array<float,2>{0.464091301f, 0.289134264f},
-std::array<float,2>{0.74060756f, 0.29890883f},
-std::array<float,2>{0.0511506684f, 0.760630727f},
-std::array<float,2>{0.765787721f, 0.644748807f},
-std::array<float,2>{0.476112962f, 0.0438495129f},
-std::array<float,2>{0.944239557f, 0.159793958f},
-std::array<float,2>{0.275546402f, 0.556748748f},
-std::array<float,2>{0.57624346f, 0.947034359f},
-std::array<float,2>{0.212525889f, 0.499300987f},
-std::array<float,2>{0.839368761f, 0.388513118f},
-std::array<float,2>{0.391584605f, 0.928858936f},
-std::array<float,2>{0.651465356f, 0.616836011f},
-std::array<float,2>{0.113561779f, 0.226973698f},
-std::array<float,2>{0.544141948f, 0.120566025f},
-std::array<float,2>{0.139696494f, 0.741547346f},
-std::array<float,2>{0.930586934f, 0.850088477f},
-std::array<float,2>{0.33830598f, 0.345687121f},
-std::array<float,2>{0.612108946f, 0.440443367f},
-std::array<float,2>{0.226461336f, 0.975977898f},
-std::array<float,2>{0.973277807f, 0.52008462f},
-std::array<float,2>{0.297982126f, 0.137244761f},
-std::array<float,2>{0.784899056f, 0.0263999272f},
-std::array<float,2>{0.452742219f, 0.679677725f},
-std::array<float,2>{0.69210434f, 0.786061466f},
-std::array<float,2>{0.0120870452f, 0.263812989f},
-std::array<float,2>{0.885659933f, 0.337538511f},
-std::array<float,2>{0.368130744f, 0.838562131f},
-std::array<float,2>{0.52797693f, 0.711657166f},
-std::array<float,2>{0.17935048f, 0.0669970065f},
-std::array<float,2>{0.685957372f, 0.192095518f},
-std::array<float,2>{0.086629957f, 0.566148639f},
-std::array<float,2>{0.867091775f, 0.88812989f},
-std::array<float,2>{0.408138424f, 0.409834921f},
-std::array<float,2>{0.701051354f, 0.491393626f},
-std::array<float,2>{0.00765918801f, 0.940850377f},
-std::array<float,2>{0.790318012f, 0.552118421f},
-std::array<float,2>{0.444910347f, 0.16565831f},
-std::array<float,2>{0.983685672f, 0.0369218849f},
-std::array<float,2>{0.310940683f, 0.655668855f},
-std::array<float,2>{0.624006331f, 0.756528795f},
-std::array<float,2>{0.22940436f, 0.312231839f},
-std::array<float,2>{0.869390607f, 0.352013797f},
-std::array<float,2>{0.414388299f, 0.85934639f},
-std::array<float,2>{0.678430557f, 0.743647993f},
-std::array<float,2>{0.0842462331f, 0.116227649f},
-std::array<float,2>{0.522692919f, 0.221876591f},
-std::array<float,2>{0.181628838f, 0.621279776f},
-std::array<float,2>{0.880034983f, 0.936424434f},
-std::array<float,2>{0.361058772f, 0.381653607f},
-std::array<float,2>{0.564572215f, 0.257649988f},
-std::array<float,2>{0.203648821f, 0.789807796f},
-std::array<float,2>{0.946833014f, 0.68101418f},
-std::array<float,2>{0.268783152f, 0.0178650282f},
-std::array<float,2>{0.776639283f, 0.125671148f},
-std::array<float,2>{0.483191729f, 0.523894191f},
-std::array<float,2>{0.749419153f, 0.977859855f},
-std::array<float,2>{0.058989387f, 0.44653976f},
-std::array<float,2>{0.92289716f, 0.414172381f},
-std::array<float,2>{0.331347913f, 0.875089347f},
-std::array<float,2>{0.53671205f, 0.571272969f},
-std::array<float,2>{0.126675084f, 0.200054869f},
-std::array<float,2>{0.643241346f, 0.0778450072f},
-std::array<float,2>{0.119188935f, 0.709427714f},
-std::array<float,2>{0.833264947f, 0.82848537f},
-std::array<float,2>{0.402608842f, 0.32967335f},
-std::array<float,2>{0.666057646f, 0.317034304f},
-std::array<float,2>{0.0627214462f, 0.820893884f},
-std::array<float,2>{0.84682107f, 0.699932635f},
-std::array<float,2>{0.427080363f, 0.0828993097f},
-std::array<float,2>{0.903367698f, 0.207755595f},
-std::array<float,2>{0.358289659f, 0.590473354f},
-std::array<float,2>{0.515436351f, 0.89726311f},
-std::array<float,2>{0.163325459f, 0.435867071f},
-std::array<float,2>{0.81229794f, 0.456921011f},
-std::array<float,2>{0.459345847f, 0.994311094f},
-std::array<float,2>{0.704429805f, 0.502197504f},
-std::array<float,2>{0.0187549535f, 0.147321492f},
-std::array<float,2>{0.599456847f, 0.00835578423f},
-std::array<float,2>{0.246172175f, 0.658867598f},
-std::array<float,2>{0.999473512f, 0.80765295f},
-std::array<float,2>{0.294198304f, 0.27202934f},
-std::array<float,2>{0.560683429f, 0.401131272f},
-std::array<float,2>{0.146835342f, 0.915506542f},
-std::array<float,2>{0.912658453f, 0.598484516f},
-std::array<float,2>{0.313814282f, 0.237348974f},
-std::array<float,2>{0.820643842f, 0.102835834f},
-std::array<float,2>{0.378868073f, 0.727485597f},
-std::array<float,2>{0.625027955f, 0.861513734f},
-std::array<float,2>{0.0961791575f, 0.374505013f},
-std::array<float,2>{0.96777153f, 0.284112632f},
-std::array<float,2>{0.250697434f, 0.775280356f},
-std::array<float,2>{0.582185745f, 0.634917974f},
-std::array<float,2>{0.188273951f, 0.0534391552f},
-std::array<float,2>{0.726862252f, 0.186142921f},
-std::array<float,2>{0.0386930406f, 0.544854403f},
-std::array<float,2>{0.764582455f, 0.964341879f},
-std::array<float,2>{0.487599522f, 0.479047388f},
-std::array<float,2>{0.648055851f, 0.471948147f},
-std::array<float,2>{0.12224301f, 0.955362439f},
-std::array<float,2>{0.831017315f, 0.532622039f},
-std::array<float,2>{0.398603261f, 0.177761793f},
-std::array<float,2>{0.92666769f, 0.0623152889f},
-std::array<float,2>{0.334812224f, 0.628512025f},
-std::array<float,2>{0.535143077f, 0.770665407f},
-std::array<float,2>{0.129650801f, 0.295651406f},
-std::array<float,2>{0.777665377f, 0.361001045f},
-std::array<float,2>{0.476690799f, 0.869561017f},
-std::array<float,2>{0.742379427f, 0.725969136f},
-std::array<float,2>{0.0555391423f, 0.101185076f},
-std::array<float,2>{0.568914413f, 0.247567788f},
-std::array<float,2>{0.210854381f, 0.607394516f},
-std::array<float,2>{0.950145423f, 0.911060333f},
-std::array<float,2>{0.273103118f, 0.397896647f},
-std::array<float,2>{0.517497182f, 0.278607517f},
-std::array<float,2>{0.18518129f, 0.799652934f},
-std::array<float,2>{0.878326893f, 0.6680848f},
-std::array<float,2>{0.363442421f, 0.00471559074f},
-std::array<float,2>{0.873500168f, 0.150315225f},
-std::array<float,2>{0.419821024f, 0.508410394f},
-std::array<float,2>{0.67471838f, 0.991404474f},
-std::array<float,2>{0.0816525221f, 0.464658022f},
-std::array<float,2>{0.976577699f, 0.422167569f},
-std::array<float,2>{0.307396233f, 0.902246475f},
-std::array<float,2>{0.617987514f, 0.580921531f},
-std::array<float,2>{0.233567581f, 0.212558061f},
-std::array<float,2>{0.696558416f, 0.0892288163f},
-std::array<float,2>{0.00152879197f, 0.6897856f},
-std::array<float,2>{0.794257104f, 0.819839001f},
-std::array<float,2>{0.441079825f, 0.325737625f},
-std::array<float,2>{0.730578959f, 0.341492176f},
-std::array<float,2>{0.03427241f, 0.842882574f},
-std::array<float,2>{0.758140504f, 0.718744755f},
-std::array<float,2>{0.488579154f, 0.0642810538f},
-std::array<float,2>{0.961261511f, 0.190945804f},
-std::array<float,2>{0.25445962f, 0.566772819f},
-std::array<float,2>{0.578810632f, 0.884700954f},
-std::array<float,2>{0.194885701f, 0.41250506f},
-std::array<float,2>{0.825641811f, 0.442010283f},
-std::array<float,2>{0.380288631f, 0.97050643f},
-std::array<float,2>{0.630541742f, 0.519360065f},
-std::array<float,2>{0.0997425243f, 0.136605009f},
-std::array<float,2>{0.558201492f, 0.0311776418f},
-std::array<float,2>{0.141526967f, 0.672418237f},
-std::array<float,2>{0.906909525f, 0.783958554f},
-std::array<float,2>{0.320272118f, 0.259501189f},
-std::array<float,2>{0.596227407f, 0.383008748f},
-std::array<float,2>{0.242467895f, 0.925763488f},
-std::array<float,2>{0.995798707f, 0.60986197f},
-std::array<float,2>{0.291499436f, 0.233905092f},
-std::array<float,2>{0.804974079f, 0.123951524f},
-std::array<float,2>{0.454415411f, 0.736982346f},
-std::array<float,2>{0.708034873f, 0.844801605f},
-std::array<float,2>{0.0204830188f, 0.349597871f},
-std::array<float,2>{0.900288522f, 0.302356541f},
-std::array<float,2>{0.354059428f, 0.764873028f},
-std::array<float,2>{0.510389686f, 0.643439054f},
-std::array<float,2>{0.158505172f, 0.0414707325f},
-std::array<float,2>{0.669060767f, 0.162393212f},
-std::array<float,2>{0.0667973459f, 0.56128633f},
-std::array<float,2>{0.848627031f, 0.950351834f},
-std::array<float,2>{0.422695518f, 0.495842457f},
-std::array<float,2>{0.716493666f, 0.419182956f},
-std::array<float,2>{0.0238357037f, 0.879947484f},
-std::array<float,2>{0.799745917f, 0.574779749f},
-std::array<float,2>{0.468502074f, 0.198630482f},
-std::array<float,2>{0.991544306f, 0.0704936534f},
-std::array<float,2>{0.281538159f, 0.705683053f},
-std::array<float,2>{0.608016372f, 0.833446503f},
-std::array<float,2>{0.240690038f, 0.334478915f},
-std::array<float,2>{0.858357251f, 0.253562748f},
-std::array<float,2>{0.430321187f, 0.795098245f},
-std::array<float,2>{0.656549633f, 0.685500205f},
-std::array<float,2>{0.0729097649f, 0.0223883409f},
-std::array<float,2>{0.50032866f, 0.130377725f},
-std::array<float,2>{0.167029262f, 0.528694868f},
-std::array<float,2>{0.896949649f, 0.980739295f},
-std::array<float,2>{0.345176786f, 0.450781405f},
-std::array<float,2>{0.586401522f, 0.35673663f},
-std::array<float,2>{0.195656613f, 0.852835894f},
-std::array<float,2>{0.959482312f, 0.74984026f},
-std::array<float,2>{0.258721828f, 0.112861611f},
-std::array<float,2>{0.756843269f, 0.222993404f},
-std::array<float,2>{0.499419451f, 0.618418634f},
-std::array<float,2>{0.721633315f, 0.932620943f},
-std::array<float,2>{0.0464505702f, 0.377292544f},
-std::array<float,2>{0.916137576f, 0.48574242f},
-std::array<float,2>{0.323095292f, 0.941576123f},
-std::array<float,2>{0.550763071f, 0.547802567f},
-std::array<float,2>{0.155825645f, 0.169132009f},
-std::array<float,2>{0.635373652f, 0.0321926884f},
-std::array<float,2>{0.103549451f, 0.652261734f},
-std::array<float,2>{0.815154135f, 0.75101012f},
-std::array<float,2>{0.384285688f, 0.306261599f},
-std::array<float,2>{0.683079004f, 0.287137479f},
-std::array<float,2>{0.0920659155f, 0.778667033f},
-std::array<float,2>{0.861073971f, 0.637799144f},
-std::array<float,2>{0.410462737f, 0.0475312732f},
-std::array<float,2>{0.888873219f, 0.181459874f},
-std::array<float,2>{0.373544484f, 0.542448103f},
-std::array<float,2>{0.52607131f, 0.964873493f},
-std::array<float,2>{0.175727457f, 0.483954698f},
-std::array<float,2>{0.788711131f, 0.403481066f},
-std::array<float,2>{0.448609143f, 0.920021594f},
-std::array<float,2>{0.690135598f, 0.594891489f},
-std::array<float,2>{0.00959183369f, 0.240535468f},
-std::array<float,2>{0.615294576f, 0.108003922f},
-std::array<float,2>{0.219663352f, 0.732359052f},
-std::array<float,2>{0.969850183f, 0.863337815f},
-std::array<float,2>{0.303514361f, 0.370508462f},
-std::array<float,2>{0.5409621f, 0.459768057f},
-std::array<float,2>{0.132969096f, 0.99969697f},
-std::array<float,2>{0.93487519f, 0.504311919f},
-std::array<float,2>{0.34363088f, 0.142048731f},
-std::array<float,2>{0.840772212f, 0.0152530521f},
-std::array<float,2>{0.397920817f, 0.662038505f},
-std::array<float,2>{0.655948758f, 0.8110376f},
-std::array<float,2>{0.110074773f, 0.268790036f},
-std::array<float,2>{0.939934373f, 0.316303581f},
-std::array<float,2>{0.280143231f, 0.824461579f},
-std::array<float,2>{0.572179079f, 0.697624862f},
-std::array<float,2>{0.215247393f, 0.0797516108f},
-std::array<float,2>{0.736395955f, 0.204634458f},
-std::array<float,2>{0.0486926846f, 0.587438226f},
-std::array<float,2>{0.769711912f, 0.893497407f},
-std::array<float,2>{0.471503466f, 0.4321087f},
-std::array<float,2>{0.663732767f, 0.393313408f},
-std::array<float,2>{0.0749011859f, 0.908212185f},
-std::array<float,2>{0.852762699f, 0.605255663f},
-std::array<float,2>{0.433829695f, 0.245573819f},
-std::array<float,2>{0.89111048f, 0.0941110775f},
-std::array<float,2>{0.34965533f, 0.721872509f},
-std::array<float,2>{0.507249534f, 0.871623039f},
-std::array<float,2>{0.16864261f, 0.364221245f},
-std::array<float,2>{0.801034033f, 0.292436749f},
-std::array<float,2>{0.462300897f, 0.769035161f},
-std::array<float,2>{0.714069486f, 0.631571233f},
-std::array<float,2>{0.0281364936f, 0.0579656139f},
-std::array<float,2>{0.603769064f, 0.17211622f},
-std::array<float,2>{0.235183463f, 0.536458731f},
-std::array<float,2>{0.988251567f, 0.959240556f},
-std::array<float,2>{0.286044687f, 0.474681616f},
-std::array<float,2>{0.554133415f, 0.323565602f},
-std::array<float,2>{0.150956661f, 0.813185573f},
-std::array<float,2>{0.920908391f, 0.692915559f},
-std::array<float,2>{0.327621937f, 0.0920517743f},
-std::array<float,2>{0.817495108f, 0.218377799f},
-std::array<float,2>{0.389105499f, 0.583123982f},
-std::array<float,2>{0.637014508f, 0.905393064f},
-std::array<float,2>{0.105897442f, 0.428557366f},
-std::array<float,2>{0.956593156f, 0.468589485f},
-std::array<float,2>{0.264406621f, 0.987061977f},
-std::array<float,2>{0.591009796f, 0.511933208f},
-std::array<float,2>{0.20266287f, 0.15253064f},
-std::array<float,2>{0.72376883f, 0.00134792982f},
-std::array<float,2>{0.0403278172f, 0.664130688f},
-std::array<float,2>{0.752318084f, 0.803404868f},
-std::array<float,2>{0.494446963f, 0.274676144f},
-std::array<float,2>{0.694547236f, 0.261967599f},
-std::array<float,2>{0.0153853511f, 0.788093746f},
-std::array<float,2>{0.782291353f, 0.677438021f},
-std::array<float,2>{0.449653089f, 0.0251216628f},
-std::array<float,2>{0.975507736f, 0.139855713f},
-std::array<float,2>{0.300025314f, 0.522864223f},
-std::array<float,2>{0.611256361f, 0.974292934f},
-std::array<float,2>{0.224321648f, 0.439063311f},
-std::array<float,2>{0.865079045f, 0.407736242f},
-std::array<float,2>{0.409693807f, 0.889478445f},
-std::array<float,2>{0.68389982f, 0.563630402f},
-std::array<float,2>{0.0891013592f, 0.193471849f},
-std::array<float,2>{0.530760467f, 0.0689378455f},
-std::array<float,2>{0.176724672f, 0.713237226f},
-std::array<float,2>{0.883562744f, 0.837684453f},
-std::array<float,2>{0.369957268f, 0.339086384f},
-std::array<float,2>{0.574546218f, 0.49681595f},
-std::array<float,2>{0.21347931f, 0.948392987f},
-std::array<float,2>{0.942044258f, 0.555087209f},
-std::array<float,2>{0.27359581f, 0.156860337f},
-std::array<float,2>{0.768602669f, 0.0451867282f},
-std::array<float,2>{0.473994941f, 0.646890283f},
-std::array<float,2>{0.739462972f, 0.759688258f},
-std::array<float,2>{0.0540185012f, 0.297094107f},
-std::array<float,2>{0.933261573f, 0.346909285f},
-std::array<float,2>{0.336654186f, 0.849053979f},
-std::array<float,2>{0.546639085f, 0.738754094f},
-std::array<float,2>{0.138653487f, 0.118226431f},
-std::array<float,2>{0.650134921f, 0.229205027f},
-std::array<float,2>{0.116091833f, 0.613717079f},
-std::array<float,2>{0.837584794f, 0.926690578f},
-std::array<float,2>{0.393717527f, 0.38980937f},
-std::array<float,2>{0.747865081f, 0.447474986f},
-std::array<float,2>{0.0623130202f, 0.980127633f},
-std::array<float,2>{0.773684442f, 0.527260363f},
-std::array<float,2>{0.480893433f, 0.128079593f},
-std::array<float,2>{0.948083937f, 0.0164088588f},
-std::array<float,2>{0.266245365f, 0.683228254f},
-std::array<float,2>{0.564366758f, 0.792611718f},
-std::array<float,2>{0.206793189f, 0.254583091f},
-std::array<float,2>{0.834872723f, 0.331626803f},
-std::array<float,2>{0.406110674f, 0.830946684f},
-std::array<float,2>{0.640948832f, 0.707923353f},
-std::array<float,2>{0.117231779f, 0.0761336014f},
-std::array<float,2>{0.537937105f, 0.202379659f},
-std::array<float,2>{0.127938539f, 0.57343787f},
-std::array<float,2>{0.924105525f, 0.87883544f},
-std::array<float,2>{0.328455269f, 0.416903883f},
-std::array<float,2>{0.621185064f, 0.308638871f},
-std::array<float,2>{0.227272898f, 0.755286336f},
-std::array<float,2>{0.9812482f, 0.652927697f},
-std::array<float,2>{0.308760703f, 0.0384267457f},
-std::array<float,2>{0.79117012f, 0.16735059f},
-std::array<float,2>{0.442055643f, 0.553131163f},
-std::array<float,2>{0.702309191f, 0.938255787f},
-std::array<float,2>{0.00493806042f, 0.489513248f},
-std::array<float,2>{0.882231176f, 0.380112857f},
-std::array<float,2>{0.362595707f, 0.93530339f},
-std::array<float,2>{0.520979643f, 0.623053312f},
-std::array<float,2>{0.182835326f, 0.219463825f},
-std::array<float,2>{0.6771155f, 0.113443635f},
-std::array<float,2>{0.0839449391f, 0.744187117f},
-std::array<float,2>{0.868880033f, 0.856206715f},
-std::array<float,2>{0.416493297f, 0.355149806f},
-std::array<float,2>{0.627576768f, 0.372657239f},
-std::array<float,2>{0.093951866f, 0.859989882f},
-std::array<float,2>{0.823835373f, 0.730022132f},
-std::array<float,2>{0.37605238f, 0.104809411f},
-std::array<float,2>{0.911956668f, 0.235893279f},
-std::array<float,2>{0.315684021f, 0.599812508f},
-std::array<float,2>{0.559567034f, 0.91625911f},
-std::array<float,2>{0.146328732f, 0.399050474f},
-std::array<float,2>{0.762331903f, 0.476714462f},
-std::array<float,2>{0.486258656f, 0.961598456f},
-std::array<float,2>{0.729406357f, 0.54558605f},
-std::array<float,2>{0.0364834033f, 0.183995813f},
-std::array<float,2>{0.585934818f, 0.0508267917f},
-std::array<float,2>{0.189648628f, 0.633888423f},
-std::array<float,2>{0.966662407f, 0.775934815f},
-std::array<float,2>{0.252527148f, 0.282857955f},
-std::array<float,2>{0.512512922f, 0.433615655f},
-std::array<float,2>{0.160873711f, 0.895444274f},
-std::array<float,2>{0.905965805f, 0.592605233f},
-std::array<float,2>{0.356169164f, 0.210699454f},
-std::array<float,2>{0.844588816f, 0.0853254125f},
-std::array<float,2>{0.428810894f, 0.701219857f},
-std::array<float,2>{0.665506661f, 0.823127151f},
-std::array<float,2>{0.0661752671f, 0.319758236f},
-std::array<float,2>{0.997561455f, 0.269601464f},
-std::array<float,2>{0.296361834f, 0.806096673f},
-std::array<float,2>{0.599671781f, 0.656318724f},
-std::array<float,2>{0.249446437f, 0.0105534047f},
-std::array<float,2>{0.705810785f, 0.145260498f},
-std::array<float,2>{0.0161555875f, 0.501344025f},
-std::array<float,2>{0.810377419f, 0.993835449f},
-std::array<float,2>{0.458965898f, 0.453398287f},
-std::array<float,2>{0.680977643f, 0.483832091f},
-std::array<float,2>{0.0902250931f, 0.965816617f},
-std::array<float,2>{0.862277448f, 0.542644024f},
-std::array<float,2>{0.412230849f, 0.180960044f},
-std::array<float,2>{0.887055576f, 0.0471361354f},
-std::array<float,2>{0.372243106f, 0.638645887f},
-std::array<float,2>{0.524318039f, 0.779210329f},
-std::array<float,2>{0.172266468f, 0.28785798f},
-std::array<float,2>{0.785498917f, 0.370870143f},
-std::array<float,2>{0.446676224f, 0.864213586f},
-std::array<float,2>{0.688269258f, 0.73148495f},
-std::array<float,2>{0.0110935643f, 0.107653029f},
-std::array<float,2>{0.615192115f, 0.241118997f},
-std::array<float,2>{0.222257152f, 0.595468581f},
-std::array<float,2>{0.972090364f, 0.920413792f},
-std::array<float,2>{0.301084369f, 0.40422523f},
-std::array<float,2>{0.541557431f, 0.269275874f},
-std::array<float,2>{0.13486509f, 0.810757577f},
-std::array<float,2>{0.936664999f, 0.661217809f},
-std::array<float,2>{0.341699272f, 0.0147016849f},
-std::array<float,2>{0.843038976f, 0.142455414f},
-std::array<float,2>{0.395485878f, 0.504494786f},
-std::array<float,2>{0.652690053f, 0.999385059f},
-std::array<float,2>{0.113041006f, 0.459340543f},
-std::array<float,2>{0.938856602f, 0.432399988f},
-std::array<float,2>{0.278848916f, 0.892683864f},
-std::array<float,2>{0.57263577f, 0.586916327f},
-std::array<float,2>{0.218091533f, 0.20444952f},
-std::array<float,2>{0.734952152f, 0.0795288458f},
-std::array<float,2>{0.0507053621f, 0.698208213f},
-std::array<float,2>{0.772247195f, 0.824978709f},
-std::array<float,2>{0.468962103f, 0.31553638f},
-std::array<float,2>{0.718273401f, 0.334450632f},
-std::array<float,2>{0.0254767574f, 0.833570957f},
-std::array<float,2>{0.797904432f, 0.705517352f},
-std::array<float,2>{0.465701431f, 0.0711161867f},
-std::array<float,2>{0.988747776f, 0.19898428f},
-std::array<float,2>{0.284618676f, 0.574253798f},
-std::array<float,2>{0.606393754f, 0.880513132f},
-std::array<float,2>{0.24020569f, 0.419795722f},
-std::array<float,2>{0.856055915f, 0.450325966f},
-std::array<float,2>{0.431817263f, 0.981218636f},
-std::array<float,2>{0.659831107f, 0.528985441f},
-std::array<float,2>{0.0703891888f, 0.129903689f},
-std::array<float,2>{0.503546655f, 0.0216932241f},
-std::array<float,2>{0.16412963f, 0.684958935f},
-std::array<float,2>{0.894895792f, 0.795748591f},
-std::array<float,2>{0.345872551f, 0.252949417f},
-std::array<float,2>{0.588040292f, 0.377444327f},
-std::array<float,2>{0.199162662f, 0.933374763f},
-std::array<float,2>{0.958791018f, 0.618736327f},
-std::array<float,2>{0.260307372f, 0.223435804f},
-std::array<float,2>{0.755784929f, 0.11275389f},
-std::array<float,2>{0.496276617f, 0.74949342f},
-std::array<float,2>{0.720267951f, 0.853218317f},
-std::array<float,2>{0.0447348878f, 0.357257754f},
-std::array<float,2>{0.91502744f, 0.306126326f},
-std::array<float,2>{0.321583271f, 0.751682997f},
-std::array<float,2>{0.54849124f, 0.651537955f},
-std::array<float,2>{0.153435588f, 0.0313519314f},
-std::array<float,2>{0.634053946f, 0.169439256f},
-std::array<float,2>{0.102623999f, 0.547294617f},
-std::array<float,2>{0.814387023f, 0.942277372f},
-std::array<float,2>{0.385157794f, 0.485899359f},
-std::array<float,2>{0.73292464f, 0.412746459f},
-std::array<float,2>{0.0318069384f, 0.884228408f},
-std::array<float,2>{0.760939717f, 0.566905439f},
-std::array<float,2>{0.490907311f, 0.190761939f},
-std::array<float,2>{0.963471651f, 0.0635372922f},
-std::array<float,2>{0.256294191f, 0.717925787f},
-std::array<float,2>{0.581088066f, 0.843309045f},
-std::array<float,2>{0.192414254f, 0.34082219f},
-std::array<float,2>{0.826462507f, 0.259115189f},
-std::array<float,2>{0.381961524f, 0.78358078f},
-std::array<float,2>{0.63145256f, 0.671909392f},
-std::array<float,2>{0.0977042168f, 0.0305794384f},
-std::array<float,2>{0.556478739f, 0.135826096f},
-std::array<float,2>{0.14355433f, 0.518940866f},
-std::array<float,2>{0.909086347f, 0.970159709f},
-std::array<float,2>{0.317537814f, 0.441702724f},
-std::array<float,2>{0.595086992f, 0.348833859f},
-std::array<float,2>{0.245571598f, 0.845330119f},
-std::array<float,2>{0.992239773f, 0.736464083f},
-std::array<float,2>{0.290583372f, 0.123050824f},
-std::array<float,2>{0.807222784f, 0.233537406f},
-std::array<float,2>{0.455257446f, 0.610261977f},
-std::array<float,2>{0.709910691f, 0.925034344f},
-std::array<float,2>{0.0224194098f, 0.38356933f},
-std::array<float,2>{0.901835203f, 0.495577723f},
-std::array<float,2>{0.353295267f, 0.950996697f},
-std::array<float,2>{0.509178936f, 0.560836792f},
-std::array<float,2>{0.156482443f, 0.162801161f},
-std::array<float,2>{0.671188295f, 0.0416408852f},
-std::array<float,2>{0.0695341676f, 0.642922223f},
-std::array<float,2>{0.851365089f, 0.765397966f},
-std::array<float,2>{0.425553739f, 0.30202654f},
-std::array<float,2>{0.64487499f, 0.295322925f},
-std::array<float,2>{0.123731539f, 0.771466851f},
-std::array<float,2>{0.829575777f, 0.628007114f},
-std::array<float,2>{0.401531845f, 0.0616526939f},
-std::array<float,2>{0.929505289f, 0.178329363f},
-std::array<float,2>{0.332176268f, 0.533072293f},
-std::array<float,2>{0.531568468f, 0.955623686f},
-std::array<float,2>{0.132726461f, 0.472309172f},
-std::array<float,2>{0.780169189f, 0.39830476f},
-std::array<float,2>{0.479928255f, 0.910519242f},
-std::array<float,2>{0.744473159f, 0.606645763f},
-std::array<float,2>{0.0571623109f, 0.247486189f},
-std::array<float,2>{0.5680812f, 0.101032965f},
-std::array<float,2>{0.208259955f, 0.72643131f},
-std::array<float,2>{0.952997148f, 0.869727015f},
-std::array<float,2>{0.269712955f, 0.360704273f},
-std::array<float,2>{0.519478023f, 0.464129448f},
-std::array<float,2>{0.18699649f, 0.992153347f},
-std::array<float,2>{0.875301182f, 0.508157134f},
-std::array<float,2>{0.366036505f, 0.149480224f},
-std::array<float,2>{0.871733427f, 0.00391043304f},
-std::array<float,2>{0.421526074f, 0.668506265f},
-std::array<float,2>{0.671895623f, 0.799048841f},
-std::array<float,2>{0.079724364f, 0.279071391f},
-std::array<float,2>{0.979234934f, 0.325598538f},
-std::array<float,2>{0.305532157f, 0.81966877f},
-std::array<float,2>{0.620413542f, 0.690066874f},
-std::array<float,2>{0.232287392f, 0.0897624716f},
-std::array<float,2>{0.697757065f, 0.211985245f},
-std::array<float,2>{0.00325898011f, 0.580279827f},
-std::array<float,2>{0.795709908f, 0.901785851f},
-std::array<float,2>{0.43825683f, 0.422567308f},
-std::array<float,2>{0.625844419f, 0.39847374f},
-std::array<float,2>{0.0962179005f, 0.91693902f},
-std::array<float,2>{0.821212709f, 0.600302339f},
-std::array<float,2>{0.377986163f, 0.235784605f},
-std::array<float,2>{0.912581801f, 0.105259262f},
-std::array<float,2>{0.314332902f, 0.729676247f},
-std::array<float,2>{0.56114918f, 0.859835804f},
-std::array<float,2>{0.147344813f, 0.372172654f},
-std::array<float,2>{0.763773918f, 0.282450616f},
-std::array<float,2>{0.488261223f, 0.775830388f},
-std::array<float,2>{0.72716552f, 0.634360671f},
-std::array<float,2>{0.038556423f, 0.0513602793f},
-std::array<float,2>{0.582718253f, 0.184568554f},
-std::array<float,2>{0.187618047f, 0.545396745f},
-std::array<float,2>{0.967250168f, 0.960943997f},
-std::array<float,2>{0.250391036f, 0.477460057f},
-std::array<float,2>{0.514750957f, 0.320000529f},
-std::array<float,2>{0.163684174f, 0.822505176f},
-std::array<float,2>{0.903976858f, 0.701767802f},
-std::array<float,2>{0.357882202f, 0.0858753026f},
-std::array<float,2>{0.847241998f, 0.210115463f},
-std::array<float,2>{0.427570939f, 0.592060328f},
-std::array<float,2>{0.666823924f, 0.894576848f},
-std::array<float,2>{0.0629899427f, 0.434085131f},
-std::array<float,2>{0.999729812f, 0.453768253f},
-std::array<float,2>{0.294458151f, 0.99360764f},
-std::array<float,2>{0.598674119f, 0.50162077f},
-std::array<float,2>{0.246640399f, 0.144876093f},
-std::array<float,2>{0.704998434f, 0.0101271607f},
-std::array<float,2>{0.0194699876f, 0.657220364f},
-std::array<float,2>{0.811642349f, 0.806608021f},
-std::array<float,2>{0.459612966f, 0.2704283f},
-std::array<float,2>{0.749714196f, 0.254211038f},
-std::array<float,2>{0.0595416836f, 0.792362154f},
-std::array<float,2>{0.777144074f, 0.682828724f},
-std::array<float,2>{0.482474446f, 0.0156879295f},
-std::array<float,2>{0.946406782f, 0.12862654f},
-std::array<float,2>{0.269192219f, 0.526578784f},
-std::array<float,2>{0.565233886f, 0.97996372f},
-std::array<float,2>{0.203580201f, 0.447992653f},
-std::array<float,2>{0.833772242f, 0.416400135f},
-std::array<float,2>{0.403082728f, 0.878392279f},
-std::array<float,2>{0.642917156f, 0.574066401f},
-std::array<float,2>{0.120048441f, 0.202841356f},
-std::array<float,2>{0.53639245f, 0.0756759346f},
-std::array<float,2>{0.126365125f, 0.707218289f},
-std::array<float,2>{0.923651338f, 0.830225289f},
-std::array<float,2>{0.331723869f, 0.33147639f},
-std::array<float,2>{0.623069823f, 0.489846438f},
-std::array<float,2>{0.228543445f, 0.937601686f},
-std::array<float,2>{0.984107852f, 0.553587437f},
-std::array<float,2>{0.31124419f, 0.1677448f},
-std::array<float,2>{0.790815055f, 0.0390449502f},
-std::array<float,2>{0.444451123f, 0.6525985f},
-std::array<float,2>{0.700235426f, 0.755840063f},
-std::array<float,2>{0.00704373466f, 0.309479564f},
-std::array<float,2>{0.880634427f, 0.354962617f},
-std::array<float,2>{0.360760927f, 0.855837703f},
-std::array<float,2>{0.523143709f, 0.745101035f},
-std::array<float,2>{0.181040093f, 0.114196673f},
-std::array<float,2>{0.678193629f, 0.218800128f},
-std::array<float,2>{0.0848709419f, 0.623877525f},
-std::array<float,2>{0.86975497f, 0.9349733f},
-std::array<float,2>{0.414980769f, 0.380760103f},
-std::array<float,2>{0.691862524f, 0.438701749f},
-std::array<float,2>{0.0126855997f, 0.974081397f},
-std::array<float,2>{0.784361005f, 0.523411155f},
-std::array<float,2>{0.452625394f, 0.140323028f},
-std::array<float,2>{0.972871065f, 0.0246945582f},
-std::array<float,2>{0.298796266f, 0.676851332f},
-std::array<float,2>{0.611658633f, 0.788767219f},
-std::array<float,2>{0.225963011f, 0.262489736f},
-std::array<float,2>{0.866605341f, 0.339708477f},
-std::array<float,2>{0.407671601f, 0.83722204f},
-std::array<float,2>{0.686202943f, 0.713457525f},
-std::array<float,2>{0.0859603956f, 0.0684407204f},
-std::array<float,2>{0.527370512f, 0.194209605f},
-std::array<float,2>{0.178730488f, 0.564032674f},
-std::array<float,2>{0.885127306f, 0.888831556f},
-std::array<float,2>{0.367409468f, 0.407689571f},
-std::array<float,2>{0.576771557f, 0.29745236f},
-std::array<float,2>{0.211949542f, 0.758862495f},
-std::array<float,2>{0.943495452f, 0.647382677f},
-std::array<float,2>{0.276268035f, 0.04543598f},
-std::array<float,2>{0.76621753f, 0.156595871f},
-std::array<float,2>{0.475804925f, 0.55562222f},
-std::array<float,2>{0.740822434f, 0.94892925f},
-std::array<float,2>{0.0516107343f, 0.496382445f},
-std::array<float,2>{0.929993987f, 0.390402496f},
-std::array<float,2>{0.338727713f, 0.925826728f},
-std::array<float,2>{0.544854701f, 0.614109457f},
-std::array<float,2>{0.140375838f, 0.228870645f},
-std::array<float,2>{0.652247787f, 0.118719935f},
-std::array<float,2>{0.114177383f, 0.739095211f},
-std::array<float,2>{0.838969588f, 0.849518239f},
-std::array<float,2>{0.391025275f, 0.347554833f},
-std::array<float,2>{0.66153264f, 0.363299489f},
-std::array<float,2>{0.0765994638f, 0.871572733f},
-std::array<float,2>{0.854371428f, 0.722550392f},
-std::array<float,2>{0.435803741f, 0.094631575f},
-std::array<float,2>{0.893688142f, 0.246003702f},
-std::array<float,2>{0.348307997f, 0.604670107f},
-std::array<float,2>{0.505723715f, 0.909061015f},
-std::array<float,2>{0.170408025f, 0.392789513f},
-std::array<float,2>{0.803841233f, 0.475188196f},
-std::array<float,2>{0.46473828f, 0.959850788f},
-std::array<float,2>{0.71283251f, 0.536716759f},
-std::array<float,2>{0.0297511984f, 0.172607422f},
-std::array<float,2>{0.602162063f, 0.0585086234f},
-std::array<float,2>{0.236788407f, 0.631082773f},
-std::array<float,2>{0.985764265f, 0.76948595f},
-std::array<float,2>{0.2875323f, 0.292938024f},
-std::array<float,2>{0.552065253f, 0.428110957f},
-std::array<float,2>{0.150131747f, 0.906177878f},
-std::array<float,2>{0.918304801f, 0.583960831f},
-std::array<float,2>{0.324324697f, 0.217985168f},
-std::array<float,2>{0.81857419f, 0.0924289376f},
-std::array<float,2>{0.38744688f, 0.692407191f},
-std::array<float,2>{0.640460372f, 0.812646687f},
-std::array<float,2>{0.109000653f, 0.323962122f},
-std::array<float,2>{0.953818679f, 0.275094688f},
-std::array<float,2>{0.262660682f, 0.802830458f},
-std::array<float,2>{0.592266798f, 0.664733529f},
-std::array<float,2>{0.199936822f, 0.00158995844f},
-std::array<float,2>{0.725851178f, 0.153238684f},
-std::array<float,2>{0.0417101867f, 0.512669683f},
-std::array<float,2>{0.75107497f, 0.986702859f},
-std::array<float,2>{0.493119001f, 0.467865676f},
-std::array<float,2>{0.655348837f, 0.457456887f},
-std::array<float,2>{0.109482951f, 0.997910619f},
-std::array<float,2>{0.840112627f, 0.506783962f},
-std::array<float,2>{0.398085713f, 0.144151196f},
-std::array<float,2>{0.935314298f, 0.0125109833f},
-std::array<float,2>{0.342818707f, 0.663077831f},
-std::array<float,2>{0.540461957f, 0.809236944f},
-std::array<float,2>{0.133754954f, 0.267351151f},
-std::array<float,2>{0.770485997f, 0.31309858f},
-std::array<float,2>{0.471041977f, 0.827978194f},
-std::array<float,2>{0.736855626f, 0.695482373f},
-std::array<float,2>{0.0478957184f, 0.0804729536f},
-std::array<float,2>{0.571588099f, 0.205287322f},
-std::array<float,2>{0.215606824f, 0.588927805f},
-std::array<float,2>{0.940370679f, 0.891361654f},
-std::array<float,2>{0.279621214f, 0.430722475f},
-std::array<float,2>{0.525407672f, 0.286056936f},
-std::array<float,2>{0.175085068f, 0.779317975f},
-std::array<float,2>{0.889447153f, 0.639896393f},
-std::array<float,2>{0.373470575f, 0.0496496819f},
-std::array<float,2>{0.860373735f, 0.183191657f},
-std::array<float,2>{0.41085273f, 0.539572895f},
-std::array<float,2>{0.683223784f, 0.967284381f},
-std::array<float,2>{0.0926816836f, 0.482356399f},
-std::array<float,2>{0.970375836f, 0.40527162f},
-std::array<float,2>{0.302928805f, 0.91854775f},
-std::array<float,2>{0.615765393f, 0.596880019f},
-std::array<float,2>{0.218756959f, 0.238879919f},
-std::array<float,2>{0.689545691f, 0.106684588f},
-std::array<float,2>{0.00922317617f, 0.732865155f},
-std::array<float,2>{0.788116157f, 0.866272688f},
-std::array<float,2>{0.448881f, 0.368245006f},
-std::array<float,2>{0.721040368f, 0.35919261f},
-std::array<float,2>{0.0461982302f, 0.854695976f},
-std::array<float,2>{0.757653832f, 0.747765362f},
-std::array<float,2>{0.499518067f, 0.109526135f},
-std::array<float,2>{0.95916748f, 0.226133764f},
-std::array<float,2>{0.258062601f, 0.620355248f},
-std::array<float,2>{0.586835682f, 0.930936456f},
-std::array<float,2>{0.195845783f, 0.376312762f},
-std::array<float,2>{0.814469576f, 0.48752597f},
-std::array<float,2>{0.383909702f, 0.943795323f},
-std::array<float,2>{0.635039806f, 0.550145984f},
-std::array<float,2>{0.104201257f, 0.17094925f},
-std::array<float,2>{0.550198615f, 0.0345037542f},
-std::array<float,2>{0.155377969f, 0.650088668f},
-std::array<float,2>{0.916675329f, 0.752479613f},
-std::array<float,2>{0.32240665f, 0.307437092f},
-std::array<float,2>{0.607717574f, 0.421160132f},
-std::array<float,2>{0.241150156f, 0.881650329f},
-std::array<float,2>{0.991723299f, 0.576758802f},
-std::array<float,2>{0.282110661f, 0.195797578f},
-std::array<float,2>{0.799191713f, 0.0738592818f},
-std::array<float,2>{0.467867762f, 0.703301311f},
-std::array<float,2>{0.716259122f, 0.834723115f},
-std::array<float,2>{0.0241593774f, 0.332928509f},
-std::array<float,2>{0.897221029f, 0.250854164f},
-std::array<float,2>{0.345230699f, 0.794496298f},
-std::array<float,2>{0.500621259f, 0.68734926f},
-std::array<float,2>{0.167633027f, 0.0207525585f},
-std::array<float,2>{0.656803608f, 0.132317886f},
-std::array<float,2>{0.0726581514f, 0.5307284f},
-std::array<float,2>{0.857642889f, 0.984273314f},
-std::array<float,2>{0.430142343f, 0.451689541f},
-std::array<float,2>{0.708674073f, 0.38542369f},
-std::array<float,2>{0.0198803805f, 0.923540711f},
-std::array<float,2>{0.805186808f, 0.612758279f},
-std::array<float,2>{0.454960972f, 0.232342243f},
-std::array<float,2>{0.995484591f, 0.122893363f},
-std::array<float,2>{0.291684002f, 0.735845923f},
-std::array<float,2>{0.596035123f, 0.846145749f},
-std::array<float,2>{0.242689207f, 0.349992782f},
-std::array<float,2>{0.847761631f, 0.303497106f},
-std::array<float,2>{0.422289968f, 0.762663782f},
-std::array<float,2>{0.669447184f, 0.641761124f},
-std::array<float,2>{0.0672323182f, 0.0392730162f},
-std::array<float,2>{0.510207176f, 0.160900638f},
-std::array<float,2>{0.159078777f, 0.56043458f},
-std::array<float,2>{0.899742782f, 0.951623678f},
-std::array<float,2>{0.353573173f, 0.492904723f},
-std::array<float,2>{0.578612983f, 0.343172967f},
-std::array<float,2>{0.194365308f, 0.840379655f},
-std::array<float,2>{0.961893141f, 0.716252029f},
-std::array<float,2>{0.254054874f, 0.0646432415f},
-std::array<float,2>{0.758607328f, 0.188105598f},
-std::array<float,2>{0.488921285f, 0.57014364f},
-std::array<float,2>{0.731100559f, 0.886161685f},
-std::array<float,2>{0.03493331f, 0.411124587f},
-std::array<float,2>{0.90639478f, 0.443579018f},
-std::array<float,2>{0.319365412f, 0.97124058f},
-std::array<float,2>{0.557943881f, 0.517296433f},
-std::array<float,2>{0.140911341f, 0.133774579f},
-std::array<float,2>{0.630301297f, 0.0286308415f},
-std::array<float,2>{0.100373611f, 0.674575567f},
-std::array<float,2>{0.825864136f, 0.78162533f},
-std::array<float,2>{0.380826354f, 0.260470629f},
-std::array<float,2>{0.673977613f, 0.279610515f},
-std::array<float,2>{0.0812132955f, 0.79753089f},
-std::array<float,2>{0.873743832f, 0.670636714f},
-std::array<float,2>{0.419404775f, 0.00688101957f},
-std::array<float,2>{0.878794849f, 0.150758505f},
-std::array<float,2>{0.363771468f, 0.510585427f},
-std::array<float,2>{0.517023563f, 0.989218771f},
-std::array<float,2>{0.18501465f, 0.462719411f},
-std::array<float,2>{0.794592261f, 0.424399018f},
-std::array<float,2>{0.440441281f, 0.898559272f},
-std::array<float,2>{0.696879566f, 0.579242766f},
-std::array<float,2>{0.00103120774f, 0.214257404f},
-std::array<float,2>{0.61757499f, 0.0875416175f},
-std::array<float,2>{0.234094173f, 0.688046157f},
-std::array<float,2>{0.977116942f, 0.817669332f},
-std::array<float,2>{0.30702439f, 0.327142209f},
-std::array<float,2>{0.534629643f, 0.470625579f},
-std::array<float,2>{0.129121676f, 0.954645932f},
-std::array<float,2>{0.925921082f, 0.53431803f},
-std::array<float,2>{0.33420223f, 0.177718863f},
-std::array<float,2>{0.830422342f, 0.0592284314f},
-std::array<float,2>{0.399166137f, 0.6267156f},
-std::array<float,2>{0.647586823f, 0.773003697f},
-std::array<float,2>{0.122781016f, 0.294738889f},
-std::array<float,2>{0.949431717f, 0.361519068f},
-std::array<float,2>{0.272717714f, 0.868901789f},
-std::array<float,2>{0.568432152f, 0.723609924f},
-std::array<float,2>{0.210134581f, 0.0988212377f},
-std::array<float,2>{0.74303025f, 0.248931691f},
-std::array<float,2>{0.0550890267f, 0.607540727f},
-std::array<float,2>{0.778120697f, 0.913632154f},
-std::array<float,2>{0.477360666f, 0.395333946f},
-std::array<float,2>{0.66584754f, 0.436416358f},
-std::array<float,2>{0.0655628592f, 0.896858633f},
-std::array<float,2>{0.843864143f, 0.590029836f},
-std::array<float,2>{0.429594636f, 0.207479864f},
-std::array<float,2>{0.905496776f, 0.082311064f},
-std::array<float,2>{0.355549216f, 0.699339867f},
-std::array<float,2>{0.512003601f, 0.820664883f},
-std::array<float,2>{0.160327986f, 0.316697776f},
-std::array<float,2>{0.809603631f, 0.271928549f},
-std::array<float,2>{0.45803079f, 0.808187962f},
-std::array<float,2>{0.705435038f, 0.658670962f},
-std::array<float,2>{0.0160035621f, 0.0078765424f},
-std::array<float,2>{0.600106537f, 0.146854565f},
-std::array<float,2>{0.249562189f, 0.502849102f},
-std::array<float,2>{0.997122765f, 0.994862676f},
-std::array<float,2>{0.296742409f, 0.456481338f},
-std::array<float,2>{0.558759868f, 0.374796242f},
-std::array<float,2>{0.145830244f, 0.862043977f},
-std::array<float,2>{0.911244571f, 0.726897538f},
-std::array<float,2>{0.316382587f, 0.103489511f},
-std::array<float,2>{0.823525846f, 0.237877458f},
-std::array<float,2>{0.376682073f, 0.597997546f},
-std::array<float,2>{0.627244413f, 0.915864408f},
-std::array<float,2>{0.0944207385f, 0.400566638f},
-std::array<float,2>{0.96623522f, 0.478747785f},
-std::array<float,2>{0.252108723f, 0.964679301f},
-std::array<float,2>{0.585256636f, 0.544076145f},
-std::array<float,2>{0.190089867f, 0.185594067f},
-std::array<float,2>{0.728623271f, 0.0529557802f},
-std::array<float,2>{0.0368932746f, 0.635505855f},
-std::array<float,2>{0.761860311f, 0.774428487f},
-std::array<float,2>{0.485706091f, 0.283510506f},
-std::array<float,2>{0.702671409f, 0.311789632f},
-std::array<float,2>{0.00545719638f, 0.756141841f},
-std::array<float,2>{0.791640937f, 0.656241536f},
-std::array<float,2>{0.441769809f, 0.036396455f},
-std::array<float,2>{0.980727732f, 0.165192738f},
-std::array<float,2>{0.309117347f, 0.552620113f},
-std::array<float,2>{0.621604919f, 0.941223323f},
-std::array<float,2>{0.226938173f, 0.491858989f},
-std::array<float,2>{0.86853677f, 0.381164461f},
-std::array<float,2>{0.416683644f, 0.93560642f},
-std::array<float,2>{0.677446127f, 0.621863008f},
-std::array<float,2>{0.0834453031f, 0.222196996f},
-std::array<float,2>{0.521063507f, 0.116963513f},
-std::array<float,2>{0.183119982f, 0.743718088f},
-std::array<float,2>{0.882708907f, 0.858669102f},
-std::array<float,2>{0.363134503f, 0.352058768f},
-std::array<float,2>{0.563854039f, 0.446805179f},
-std::array<float,2>{0.206540182f, 0.978463352f},
-std::array<float,2>{0.947436094f, 0.524173915f},
-std::array<float,2>{0.265734524f, 0.125251651f},
-std::array<float,2>{0.77420181f, 0.0180921163f},
-std::array<float,2>{0.480980009f, 0.681608081f},
-std::array<float,2>{0.747281253f, 0.789373457f},
-std::array<float,2>{0.0615538433f, 0.257286519f},
-std::array<float,2>{0.924446702f, 0.32923764f},
-std::array<float,2>{0.328880847f, 0.828775465f},
-std::array<float,2>{0.537434936f, 0.709590197f},
-std::array<float,2>{0.128826216f, 0.0774946362f},
-std::array<float,2>{0.641523004f, 0.199522644f},
-std::array<float,2>{0.118125029f, 0.5705024f},
-std::array<float,2>{0.834342003f, 0.875748158f},
-std::array<float,2>{0.405510128f, 0.414746404f},
-std::array<float,2>{0.74008882f, 0.499527425f},
-std::array<float,2>{0.0542119294f, 0.946299434f},
-std::array<float,2>{0.769454122f, 0.557497144f},
-std::array<float,2>{0.474351585f, 0.159233153f},
-std::array<float,2>{0.941707134f, 0.0430305526f},
-std::array<float,2>{0.274361312f, 0.645123422f},
-std::array<float,2>{0.574916661f, 0.760253727f},
-std::array<float,2>{0.213145599f, 0.299321532f},
-std::array<float,2>{0.83711797f, 0.34491381f},
-std::array<float,2>{0.394104302f, 0.850283384f},
-std::array<float,2>{0.649563491f, 0.741811991f},
-std::array<float,2>{0.115441434f, 0.121024169f},
-std::array<float,2>{0.546285093f, 0.227176383f},
-std::array<float,2>{0.13794893f, 0.616491914f},
-std::array<float,2>{0.932944179f, 0.92935133f},
-std::array<float,2>{0.33629027f, 0.387974679f},
-std::array<float,2>{0.610528409f, 0.264370471f},
-std::array<float,2>{0.223949462f, 0.785189569f},
-std::array<float,2>{0.974957585f, 0.679198146f},
-std::array<float,2>{0.300619632f, 0.0270141158f},
-std::array<float,2>{0.783073783f, 0.137161598f},
-std::array<float,2>{0.450043321f, 0.519945562f},
-std::array<float,2>{0.695126355f, 0.976266861f},
-std::array<float,2>{0.0148465782f, 0.441106886f},
-std::array<float,2>{0.882914007f, 0.409610361f},
-std::array<float,2>{0.36926949f, 0.888649821f},
-std::array<float,2>{0.531107724f, 0.565637112f},
-std::array<float,2>{0.176146582f, 0.191729307f},
-std::array<float,2>{0.684544384f, 0.0666346923f},
-std::array<float,2>{0.0895455405f, 0.711064637f},
-std::array<float,2>{0.864471495f, 0.837893963f},
-std::array<float,2>{0.409181297f, 0.336951375f},
-std::array<float,2>{0.637597263f, 0.320774257f},
-std::array<float,2>{0.106404394f, 0.816121936f},
-std::array<float,2>{0.818250597f, 0.695194066f},
-std::array<float,2>{0.38948068f, 0.090874292f},
-std::array<float,2>{0.921863556f, 0.215065598f},
-std::array<float,2>{0.327673763f, 0.584266841f},
-std::array<float,2>{0.554336131f, 0.903027296f},
-std::array<float,2>{0.150549278f, 0.427152634f},
-std::array<float,2>{0.752524972f, 0.466026366f},
-std::array<float,2>{0.494993627f, 0.985852122f},
-std::array<float,2>{0.724447429f, 0.513945937f},
-std::array<float,2>{0.0409382395f, 0.155668378f},
-std::array<float,2>{0.591334164f, 0.00360152987f},
-std::array<float,2>{0.202468917f, 0.666806102f},
-std::array<float,2>{0.956181645f, 0.801201165f},
-std::array<float,2>{0.264142007f, 0.27586177f},
-std::array<float,2>{0.507772744f, 0.391620308f},
-std::array<float,2>{0.16834113f, 0.907479703f},
-std::array<float,2>{0.891419053f, 0.602191091f},
-std::array<float,2>{0.350147069f, 0.243596494f},
-std::array<float,2>{0.853135049f, 0.0958470479f},
-std::array<float,2>{0.434503406f, 0.720023036f},
-std::array<float,2>{0.663351119f, 0.873281717f},
-std::array<float,2>{0.0744354799f, 0.36592266f},
-std::array<float,2>{0.987466216f, 0.289860785f},
-std::array<float,2>{0.285304457f, 0.765910387f},
-std::array<float,2>{0.604118466f, 0.629675388f},
-std::array<float,2>{0.234552026f, 0.0560399033f},
-std::array<float,2>{0.714644492f, 0.175123289f},
-std::array<float,2>{0.0273966268f, 0.538303792f},
-std::array<float,2>{0.8014189f, 0.957179487f},
-std::array<float,2>{0.462643623f, 0.474269778f},
-std::array<float,2>{0.658842087f, 0.452762038f},
-std::array<float,2>{0.0720255747f, 0.982541561f},
-std::array<float,2>{0.856809855f, 0.530061662f},
-std::array<float,2>{0.433076113f, 0.131480649f},
-std::array<float,2>{0.895727873f, 0.0200266019f},
-std::array<float,2>{0.346870303f, 0.686149776f},
-std::array<float,2>{0.502402127f, 0.79392606f},
-std::array<float,2>{0.16591838f, 0.251726538f},
-std::array<float,2>{0.797155261f, 0.333901346f},
-std::array<float,2>{0.465863556f, 0.835110486f},
-std::array<float,2>{0.717239201f, 0.705066979f},
-std::array<float,2>{0.0269052126f, 0.0727028623f},
-std::array<float,2>{0.606487393f, 0.196367636f},
-std::array<float,2>{0.239174709f, 0.577377617f},
-std::array<float,2>{0.989571929f, 0.882109523f},
-std::array<float,2>{0.284084499f, 0.420725673f},
-std::array<float,2>{0.547240198f, 0.308464468f},
-std::array<float,2>{0.152854487f, 0.75332725f},
-std::array<float,2>{0.915642023f, 0.648919642f},
-std::array<float,2>{0.320498526f, 0.0335460342f},
-std::array<float,2>{0.812986672f, 0.170110926f},
-std::array<float,2>{0.3857629f, 0.549238324f},
-std::array<float,2>{0.633035421f, 0.944412589f},
-std::array<float,2>{0.102312811f, 0.486867964f},
-std::array<float,2>{0.957046986f, 0.375504255f},
-std::array<float,2>{0.261126965f, 0.930479288f},
-std::array<float,2>{0.589409113f, 0.619604051f},
-std::array<float,2>{0.19783625f, 0.224976957f},
-std::array<float,2>{0.719307721f, 0.110818066f},
-std::array<float,2>{0.0431297608f, 0.746103168f},
-std::array<float,2>{0.754086375f, 0.853651345f},
-std::array<float,2>{0.497109383f, 0.357798308f},
-std::array<float,2>{0.688775897f, 0.367666304f},
-std::array<float,2>{0.00989931542f, 0.866076469f},
-std::array<float,2>{0.786135495f, 0.734333217f},
-std::array<float,2>{0.44567138f, 0.105785593f},
-std::array<float,2>{0.970775545f, 0.239647821f},
-std::array<float,2>{0.30216831f, 0.596133411f},
-std::array<float,2>{0.613625169f, 0.919139564f},
-std::array<float,2>{0.221135691f, 0.405957282f},
-std::array<float,2>{0.863143861f, 0.481380224f},
-std::array<float,2>{0.41374889f, 0.967910826f},
-std::array<float,2>{0.680286944f, 0.540321827f},
-std::array<float,2>{0.0914702863f, 0.182349786f},
-std::array<float,2>{0.524480641f, 0.0499602035f},
-std::array<float,2>{0.173640117f, 0.638880849f},
-std::array<float,2>{0.887972891f, 0.780599177f},
-std::array<float,2>{0.371998727f, 0.286284834f},
-std::array<float,2>{0.57364291f, 0.430524975f},
-std::array<float,2>{0.216826126f, 0.892137945f},
-std::array<float,2>{0.9377985f, 0.588840902f},
-std::array<float,2>{0.277774155f, 0.206632242f},
-std::array<float,2>{0.772587419f, 0.0814536437f},
-std::array<float,2>{0.470434189f, 0.69693172f},
-std::array<float,2>{0.735673368f, 0.826685488f},
-std::array<float,2>{0.0491119213f, 0.314148337f},
-std::array<float,2>{0.93647635f, 0.266557962f},
-std::array<float,2>{0.340268344f, 0.810286224f},
-std::array<float,2>{0.542483866f, 0.663630366f},
-std::array<float,2>{0.136124536f, 0.0134034129f},
-std::array<float,2>{0.654210806f, 0.143347979f},
-std::array<float,2>{0.111913018f, 0.506926835f},
-std::array<float,2>{0.842641473f, 0.996367693f},
-std::array<float,2>{0.396246314f, 0.458517164f},
-std::array<float,2>{0.745660067f, 0.395679235f},
-std::array<float,2>{0.0585327111f, 0.912842333f},
-std::array<float,2>{0.780759156f, 0.609094679f},
-std::array<float,2>{0.478550881f, 0.249033675f},
-std::array<float,2>{0.951651931f, 0.098239772f},
-std::array<float,2>{0.271452188f, 0.724496245f},
-std::array<float,2>{0.567157984f, 0.867553234f},
-std::array<float,2>{0.207943395f, 0.362658262f},
-std::array<float,2>{0.828779638f, 0.293488294f},
-std::array<float,2>{0.40108338f, 0.771496058f},
-std::array<float,2>{0.646443129f, 0.625930071f},
-std::array<float,2>{0.124492168f, 0.0598950982f},
-std::array<float,2>{0.532397568f, 0.17651467f},
-std::array<float,2>{0.131183177f, 0.533995032f},
-std::array<float,2>{0.928196192f, 0.953954041f},
-std::array<float,2>{0.333749264f, 0.469273895f},
-std::array<float,2>{0.61987108f, 0.328018129f},
-std::array<float,2>{0.230549812f, 0.816733241f},
-std::array<float,2>{0.979864597f, 0.689235806f},
-std::array<float,2>{0.305691421f, 0.0866118893f},
-std::array<float,2>{0.796008825f, 0.213332579f},
-std::array<float,2>{0.438995242f, 0.578517139f},
-std::array<float,2>{0.698506296f, 0.900011063f},
-std::array<float,2>{0.00238972972f, 0.425328493f},
-std::array<float,2>{0.876057327f, 0.461778551f},
-std::array<float,2>{0.367153078f, 0.989597917f},
-std::array<float,2>{0.518513083f, 0.510836124f},
-std::array<float,2>{0.185599521f, 0.151480108f},
-std::array<float,2>{0.672990739f, 0.00605675252f},
-std::array<float,2>{0.0783454403f, 0.670981765f},
-std::array<float,2>{0.872662485f, 0.798722804f},
-std::array<float,2>{0.42040363f, 0.280471444f},
-std::array<float,2>{0.632091165f, 0.261398554f},
-std::array<float,2>{0.099064298f, 0.783154249f},
-std::array<float,2>{0.828009546f, 0.675661922f},
-std::array<float,2>{0.381804287f, 0.028308155f},
-std::array<float,2>{0.909687757f, 0.134552419f},
-std::array<float,2>{0.316914856f, 0.515957057f},
-std::array<float,2>{0.555474341f, 0.971907139f},
-std::array<float,2>{0.143911585f, 0.444652438f},
-std::array<float,2>{0.759831965f, 0.41153267f},
-std::array<float,2>{0.492062479f, 0.885180056f},
-std::array<float,2>{0.734111547f, 0.568880796f},
-std::array<float,2>{0.033158388f, 0.188723132f},
-std::array<float,2>{0.580299795f, 0.0659484416f},
-std::array<float,2>{0.192351282f, 0.715794742f},
-std::array<float,2>{0.964677691f, 0.841784656f},
-std::array<float,2>{0.257535428f, 0.341910213f},
-std::array<float,2>{0.508787274f, 0.493228316f},
-std::array<float,2>{0.157749742f, 0.952650011f},
-std::array<float,2>{0.9008075f, 0.559415758f},
-std::array<float,2>{0.352190286f, 0.161477074f},
-std::array<float,2>{0.849983573f, 0.0409895852f},
-std::array<float,2>{0.424068689f, 0.64126879f},
-std::array<float,2>{0.670570552f, 0.763543069f},
-std::array<float,2>{0.0686816573f, 0.304203063f},
-std::array<float,2>{0.993443012f, 0.35076648f},
-std::array<float,2>{0.289606154f, 0.847600877f},
-std::array<float,2>{0.594603658f, 0.734795153f},
-std::array<float,2>{0.244278893f, 0.121544875f},
-std::array<float,2>{0.710902452f, 0.230695337f},
-std::array<float,2>{0.0225579701f, 0.611462772f},
-std::array<float,2>{0.808197796f, 0.92259109f},
-std::array<float,2>{0.456645459f, 0.386202395f},
-std::array<float,2>{0.644483864f, 0.415662676f},
-std::array<float,2>{0.121049754f, 0.876719296f},
-std::array<float,2>{0.832347572f, 0.572133183f},
-std::array<float,2>{0.403850585f, 0.200381458f},
-std::array<float,2>{0.922223628f, 0.0767394677f},
-std::array<float,2>{0.330177128f, 0.710268021f},
-std::array<float,2>{0.535977662f, 0.829962671f},
-std::array<float,2>{0.125384942f, 0.32889846f},
-std::array<float,2>{0.775647581f, 0.256679237f},
-std::array<float,2>{0.48347652f, 0.790284812f},
-std::array<float,2>{0.748990893f, 0.679696143f},
-std::array<float,2>{0.0599579997f, 0.0190883819f},
-std::array<float,2>{0.565590978f, 0.126322538f},
-std::array<float,2>{0.204922736f, 0.524594426f},
-std::array<float,2>{0.945829034f, 0.976700187f},
-std::array<float,2>{0.267726451f, 0.445380777f},
-std::array<float,2>{0.521772683f, 0.353020579f},
-std::array<float,2>{0.180239916f, 0.858212173f},
-std::array<float,2>{0.879188836f, 0.742945373f},
-std::array<float,2>{0.359557509f, 0.115254372f},
-std::array<float,2>{0.870864093f, 0.221191749f},
-std::array<float,2>{0.415501982f, 0.6220873f},
-std::array<float,2>{0.679156244f, 0.937012911f},
-std::array<float,2>{0.0853376687f, 0.382188141f},
-std::array<float,2>{0.982976735f, 0.491158456f},
-std::array<float,2>{0.31166181f, 0.940079093f},
-std::array<float,2>{0.624103904f, 0.551029682f},
-std::array<float,2>{0.230412647f, 0.164306477f},
-std::array<float,2>{0.6995942f, 0.0354257189f},
-std::array<float,2>{0.0059004426f, 0.654578567f},
-std::array<float,2>{0.789565504f, 0.757296264f},
-std::array<float,2>{0.443575442f, 0.311211973f},
-std::array<float,2>{0.728111267f, 0.284617662f},
-std::array<float,2>{0.0372058339f, 0.773968101f},
-std::array<float,2>{0.765431583f, 0.635844707f},
-std::array<float,2>{0.486385226f, 0.0544295423f},
-std::array<float,2>{0.968343079f, 0.187066555f},
-std::array<float,2>{0.251331508f, 0.54380101f},
-std::array<float,2>{0.583099186f, 0.963683426f},
-std::array<float,2>{0.189117596f, 0.479574084f},
-std::array<float,2>{0.821495652f, 0.401536345f},
-std::array<float,2>{0.377690703f, 0.914460957f},
-std::array<float,2>{0.626479626f, 0.59944576f},
-std::array<float,2>{0.0967403054f, 0.23693043f},
-std::array<float,2>{0.562365413f, 0.102371544f},
-std::array<float,2>{0.147958338f, 0.728134692f},
-std::array<float,2>{0.913922489f, 0.862614632f},
-std::array<float,2>{0.313447654f, 0.373131573f},
-std::array<float,2>{0.598603725f, 0.455515176f},
-std::array<float,2>{0.247506618f, 0.995415211f},
-std::array<float,2>{0.998371482f, 0.502952158f},
-std::array<float,2>{0.293170094f, 0.148102805f},
-std::array<float,2>{0.810645401f, 0.00890234578f},
-std::array<float,2>{0.460709155f, 0.659748077f},
-std::array<float,2>{0.703127444f, 0.807104409f},
-std::array<float,2>{0.0181318782f, 0.272851735f},
-std::array<float,2>{0.903159797f, 0.317547113f},
-std::array<float,2>{0.358726442f, 0.821422815f},
-std::array<float,2>{0.514571965f, 0.700953364f},
-std::array<float,2>{0.162353814f, 0.0839538798f},
-std::array<float,2>{0.667502046f, 0.208646655f},
-std::array<float,2>{0.0641290769f, 0.59148711f},
-std::array<float,2>{0.846126795f, 0.897545695f},
-std::array<float,2>{0.425947517f, 0.436754525f},
-std::array<float,2>{0.711084843f, 0.473227382f},
-std::array<float,2>{0.0309861917f, 0.95883882f},
-std::array<float,2>{0.803496778f, 0.538001835f},
-std::array<float,2>{0.463431448f, 0.174236372f},
-std::array<float,2>{0.985313654f, 0.0547791868f},
-std::array<float,2>{0.289058924f, 0.630661845f},
-std::array<float,2>{0.602613866f, 0.767327845f},
-std::array<float,2>{0.237425297f, 0.291011125f},
-std::array<float,2>{0.854528964f, 0.367130339f},
-std::array<float,2>{0.436718345f, 0.874539375f},
-std::array<float,2>{0.661038339f, 0.719170511f},
-std::array<float,2>{0.0771969482f, 0.0967972502f},
-std::array<float,2>{0.504345417f, 0.242559999f},
-std::array<float,2>{0.171301261f, 0.6028952f},
-std::array<float,2>{0.893233776f, 0.907029629f},
-std::array<float,2>{0.349097639f, 0.390678495f},
-std::array<float,2>{0.593409002f, 0.277149737f},
-std::array<float,2>{0.200423822f, 0.802714288f},
-std::array<float,2>{0.954957306f, 0.667260408f},
-std::array<float,2>{0.263150871f, 0.00268215616f},
-std::array<float,2>{0.750601113f, 0.154388666f},
-std::array<float,2>{0.49337703f, 0.515025079f},
-std::array<float,2>{0.724678516f, 0.984650254f},
-std::array<float,2>{0.0427834876f, 0.465025604f},
-std::array<float,2>{0.919450641f, 0.426001668f},
-std::array<float,2>{0.325721115f, 0.90352875f},
-std::array<float,2>{0.551600099f, 0.585817754f},
-std::array<float,2>{0.148573339f, 0.216048598f},
-std::array<float,2>{0.638689518f, 0.0906876251f},
-std::array<float,2>{0.10771285f, 0.693874478f},
-std::array<float,2>{0.819956839f, 0.81529659f},
-std::array<float,2>{0.387920052f, 0.321518809f},
-std::array<float,2>{0.686845124f, 0.336338282f},
-std::array<float,2>{0.086992912f, 0.839635074f},
-std::array<float,2>{0.865771413f, 0.712656081f},
-std::array<float,2>{0.406310171f, 0.0674664155f},
-std::array<float,2>{0.885803878f, 0.193303421f},
-std::array<float,2>{0.368825912f, 0.564955175f},
-std::array<float,2>{0.528398156f, 0.886738062f},
-std::array<float,2>{0.178649813f, 0.408914566f},
-std::array<float,2>{0.783693433f, 0.43960458f},
-std::array<float,2>{0.451472878f, 0.97526443f},
-std::array<float,2>{0.692766905f, 0.521082997f},
-std::array<float,2>{0.0128599489f, 0.138642892f},
-std::array<float,2>{0.61275059f, 0.0261899028f},
-std::array<float,2>{0.224685609f, 0.678180873f},
-std::array<float,2>{0.974440873f, 0.786705852f},
-std::array<float,2>{0.297389716f, 0.265506983f},
-std::array<float,2>{0.543564618f, 0.386811078f},
-std::array<float,2>{0.139505059f, 0.928141475f},
-std::array<float,2>{0.930736363f, 0.615916729f},
-std::array<float,2>{0.339304924f, 0.227767199f},
-std::array<float,2>{0.837985039f, 0.119612426f},
-std::array<float,2>{0.391883135f, 0.740571678f},
-std::array<float,2>{0.65102005f, 0.850844085f},
-std::array<float,2>{0.115182124f, 0.343931913f},
-std::array<float,2>{0.944427073f, 0.30050239f},
-std::array<float,2>{0.276613683f, 0.761246681f},
-std::array<float,2>{0.577219665f, 0.645693541f},
-std::array<float,2>{0.211443976f, 0.0447236747f},
-std::array<float,2>{0.741913795f, 0.159104243f},
-std::array<float,2>{0.0522151962f, 0.558322132f},
-std::array<float,2>{0.767332613f, 0.945505798f},
-std::array<float,2>{0.475222975f, 0.498885006f},
-std::array<float,2>{0.636337101f, 0.485048324f},
-std::array<float,2>{0.104710773f, 0.943022907f},
-std::array<float,2>{0.816206992f, 0.548661232f},
-std::array<float,2>{0.383012652f, 0.16867575f},
-std::array<float,2>{0.917346001f, 0.0331014022f},
-std::array<float,2>{0.324013561f, 0.651165545f},
-std::array<float,2>{0.549009144f, 0.750511885f},
-std::array<float,2>{0.155153647f, 0.30556035f},
-std::array<float,2>{0.756664395f, 0.355770379f},
-std::array<float,2>{0.498341888f, 0.852525473f},
-std::array<float,2>{0.722110927f, 0.748126805f},
-std::array<float,2>{0.0449456982f, 0.112222165f},
-std::array<float,2>{0.58703047f, 0.224238873f},
-std::array<float,2>{0.196347624f, 0.618118465f},
-std::array<float,2>{0.960679829f, 0.93228066f},
-std::array<float,2>{0.259041309f, 0.377935141f},
-std::array<float,2>{0.500998855f, 0.252468795f},
-std::array<float,2>{0.16671373f, 0.796398342f},
-std::array<float,2>{0.897580862f, 0.68392849f},
-std::array<float,2>{0.343819886f, 0.0233410206f},
-std::array<float,2>{0.858747125f, 0.129523501f},
-std::array<float,2>{0.430792809f, 0.528276086f},
-std::array<float,2>{0.657875597f, 0.98214829f},
-std::array<float,2>{0.0740248039f, 0.449526548f},
-std::array<float,2>{0.991004109f, 0.418879658f},
-std::array<float,2>{0.282571316f, 0.879410207f},
-std::array<float,2>{0.608709633f, 0.575655997f},
-std::array<float,2>{0.241402924f, 0.198194951f},
-std::array<float,2>{0.715741873f, 0.0719819367f},
-std::array<float,2>{0.0251323357f, 0.706937253f},
-std::array<float,2>{0.800377965f, 0.832945883f},
-std::array<float,2>{0.467760682f, 0.335555613f},
-std::array<float,2>{0.737747252f, 0.315143734f},
-std::array<float,2>{0.0476677679f, 0.825529635f},
-std::array<float,2>{0.770566046f, 0.698459089f},
-std::array<float,2>{0.472487509f, 0.0786317438f},
-std::array<float,2>{0.941377401f, 0.20318839f},
-std::array<float,2>{0.280351579f, 0.586489975f},
-std::array<float,2>{0.570867658f, 0.894422889f},
-std::array<float,2>{0.216001511f, 0.432663202f},
-std::array<float,2>{0.841226995f, 0.460254431f},
-std::array<float,2>{0.396904707f, 0.999006987f},
-std::array<float,2>{0.654415965f, 0.505736232f},
-std::array<float,2>{0.111266494f, 0.140727758f},
-std::array<float,2>{0.539573789f, 0.013840626f},
-std::array<float,2>{0.134246349f, 0.660335183f},
-std::array<float,2>{0.934228301f, 0.812426329f},
-std::array<float,2>{0.342610508f, 0.26846987f},
-std::array<float,2>{0.617146969f, 0.402663291f},
-std::array<float,2>{0.220418945f, 0.92094475f},
-std::array<float,2>{0.968865335f, 0.594355941f},
-std::array<float,2>{0.30446279f, 0.24197346f},
-std::array<float,2>{0.787557364f, 0.109244116f},
-std::array<float,2>{0.448204488f, 0.731166363f},
-std::array<float,2>{0.691155255f, 0.864384532f},
-std::array<float,2>{0.00807637349f, 0.370106012f},
-std::array<float,2>{0.890090823f, 0.288676143f},
-std::array<float,2>{0.374990106f, 0.778137445f},
-std::array<float,2>{0.527180731f, 0.636740863f},
-std::array<float,2>{0.173926368f, 0.0485651717f},
-std::array<float,2>{0.681818962f, 0.180157572f},
-std::array<float,2>{0.0932459086f, 0.541340113f},
-std::array<float,2>{0.859936595f, 0.96600461f},
-std::array<float,2>{0.41172713f, 0.48266685f},
-std::array<float,2>{0.696231425f, 0.423279822f},
-std::array<float,2>{0.000798280467f, 0.900614679f},
-std::array<float,2>{0.793650508f, 0.581718087f},
-std::array<float,2>{0.439819545f, 0.211276874f},
-std::array<float,2>{0.978427768f, 0.0886708722f},
-std::array<float,2>{0.307740778f, 0.69132477f},
-std::array<float,2>{0.618618846f, 0.819020629f},
-std::array<float,2>{0.232479304f, 0.324847519f},
-std::array<float,2>{0.874797463f, 0.278048217f},
-std::array<float,2>{0.418161929f, 0.80050683f},
-std::array<float,2>{0.675342679f, 0.669337988f},
-std::array<float,2>{0.0806727558f, 0.00502713583f},
-std::array<float,2>{0.516409159f, 0.149147123f},
-std::array<float,2>{0.184060097f, 0.509121597f},
-std::array<float,2>{0.877218723f, 0.990760684f},
-std::array<float,2>{0.364922971f, 0.463316619f},
-std::array<float,2>{0.569515884f, 0.360327691f},
-std::array<float,2>{0.209837317f, 0.871072292f},
-std::array<float,2>{0.951061666f, 0.724959552f},
-std::array<float,2>{0.271720529f, 0.100526929f},
-std::array<float,2>{0.779064953f, 0.246632695f},
-std::array<float,2>{0.477716982f, 0.605737686f},
-std::array<float,2>{0.743557096f, 0.912036836f},
-std::array<float,2>{0.0565235429f, 0.396513283f},
-std::array<float,2>{0.927708685f, 0.470913738f},
-std::array<float,2>{0.33522898f, 0.957024157f},
-std::array<float,2>{0.533515453f, 0.531696618f},
-std::array<float,2>{0.130492091f, 0.178815544f},
-std::array<float,2>{0.646882117f, 0.0609805323f},
-std::array<float,2>{0.12190216f, 0.627078295f},
-std::array<float,2>{0.831810296f, 0.769865155f},
-std::array<float,2>{0.399833828f, 0.296782494f},
-std::array<float,2>{0.668627024f, 0.301697046f},
-std::array<float,2>{0.0683540627f, 0.763848484f},
-std::array<float,2>{0.849321723f, 0.643820524f},
-std::array<float,2>{0.422854692f, 0.0427996367f},
-std::array<float,2>{0.899097502f, 0.163453639f},
-std::array<float,2>{0.354538918f, 0.561929703f},
-std::array<float,2>{0.511400938f, 0.949970663f},
-std::array<float,2>{0.159293026f, 0.495035112f},
-std::array<float,2>{0.805803478f, 0.383821547f},
-std::array<float,2>{0.453160495f, 0.924323499f},
-std::array<float,2>{0.707862318f, 0.610576987f},
-std::array<float,2>{0.0208344534f, 0.233331665f},
-std::array<float,2>{0.597629726f, 0.12440569f},
-std::array<float,2>{0.244078696f, 0.737663031f},
-std::array<float,2>{0.99443686f, 0.844130158f},
-std::array<float,2>{0.29241246f, 0.347762734f},
-std::array<float,2>{0.556661785f, 0.442875415f},
-std::array<float,2>{0.141710222f, 0.969543934f},
-std::array<float,2>{0.907657027f, 0.517932892f},
-std::array<float,2>{0.319000542f, 0.134896383f},
-std::array<float,2>{0.824841917f, 0.0293927304f},
-std::array<float,2>{0.379691124f, 0.673594356f},
-std::array<float,2>{0.62976414f, 0.784338832f},
-std::array<float,2>{0.100952327f, 0.258292824f},
-std::array<float,2>{0.96288687f, 0.339884549f},
-std::array<float,2>{0.255369216f, 0.842362344f},
-std::array<float,2>{0.579765141f, 0.717073619f},
-std::array<float,2>{0.193580836f, 0.0634015501f},
-std::array<float,2>{0.731523693f, 0.18990688f},
-std::array<float,2>{0.0337881222f, 0.567849696f},
-std::array<float,2>{0.758972585f, 0.883437157f},
-std::array<float,2>{0.489469022f, 0.413365543f},
-std::array<float,2>{0.675792813f, 0.378916085f},
-std::array<float,2>{0.0824973732f, 0.933695018f},
-std::array<float,2>{0.867613614f, 0.624925673f},
-std::array<float,2>{0.417683154f, 0.220560655f},
-std::array<float,2>{0.881035209f, 0.114827946f},
-std::array<float,2>{0.361439347f, 0.74520117f},
-std::array<float,2>{0.520040154f, 0.856667876f},
-std::array<float,2>{0.181766734f, 0.354268849f},
-std::array<float,2>{0.792772532f, 0.310039222f},
-std::array<float,2>{0.442932904f, 0.754454374f},
-std::array<float,2>{0.701206148f, 0.65398103f},
-std::array<float,2>{0.00439970195f, 0.0376413614f},
-std::array<float,2>{0.622237086f, 0.166952834f},
-std::array<float,2>{0.227611408f, 0.554235041f},
-std::array<float,2>{0.98240155f, 0.939206362f},
-std::array<float,2>{0.310059667f, 0.488811851f},
-std::array<float,2>{0.538803279f, 0.330450952f},
-std::array<float,2>{0.12698476f, 0.831719339f},
-std::array<float,2>{0.925315082f, 0.708283842f},
-std::array<float,2>{0.329785347f, 0.0743540227f},
-std::array<float,2>{0.835199952f, 0.201703697f},
-std::array<float,2>{0.404503405f, 0.572538674f},
-std::array<float,2>{0.642295122f, 0.877796412f},
-std::array<float,2>{0.118470095f, 0.417441458f},
-std::array<float,2>{0.948830783f, 0.448265225f},
-std::array<float,2>{0.26745525f, 0.978843331f},
-std::array<float,2>{0.563021779f, 0.525598049f},
-std::array<float,2>{0.205561757f, 0.127160475f},
-std::array<float,2>{0.746140838f, 0.0174241308f},
-std::array<float,2>{0.0611111969f, 0.682326794f},
-std::array<float,2>{0.774918318f, 0.79141444f},
-std::array<float,2>{0.48194769f, 0.255513638f},
-std::array<float,2>{0.706999719f, 0.271008044f},
-std::array<float,2>{0.0174974669f, 0.804716647f},
-std::array<float,2>{0.808775842f, 0.657718837f},
-std::array<float,2>{0.457823575f, 0.0109508177f},
-std::array<float,2>{0.996419907f, 0.146320239f},
-std::array<float,2>{0.295372963f, 0.500394881f},
-std::array<float,2>{0.601149678f, 0.992202282f},
-std::array<float,2>{0.248663023f, 0.454490572f},
-std::array<float,2>{0.844929099f, 0.434599578f},
-std::array<float,2>{0.42864877f, 0.896309376f},
-std::array<float,2>{0.664487839f, 0.593159974f},
-std::array<float,2>{0.0648749471f, 0.209866047f},
-std::array<float,2>{0.513279378f, 0.0846457407f},
-std::array<float,2>{0.162039459f, 0.702567518f},
-std::array<float,2>{0.904742956f, 0.82405597f},
-std::array<float,2>{0.356731474f, 0.318404406f},
-std::array<float,2>{0.584447861f, 0.478480607f},
-std::array<float,2>{0.190932095f, 0.962713361f},
-std::array<float,2>{0.965423048f, 0.546500742f},
-std::array<float,2>{0.253671169f, 0.184938028f},
-std::array<float,2>{0.76334995f, 0.0523605719f},
-std::array<float,2>{0.484958351f, 0.633134842f},
-std::array<float,2>{0.730039895f, 0.776609898f},
-std::array<float,2>{0.0357297361f, 0.282207578f},
-std::array<float,2>{0.910574257f, 0.371145844f},
-std::array<float,2>{0.314555258f, 0.861250281f},
-std::array<float,2>{0.559983909f, 0.728727281f},
-std::array<float,2>{0.145439938f, 0.103720814f},
-std::array<float,2>{0.627999306f, 0.235208809f},
-std::array<float,2>{0.095318459f, 0.601341844f},
-std::array<float,2>{0.822406888f, 0.917765975f},
-std::array<float,2>{0.375686228f, 0.399495751f},
-std::array<float,2>{0.723552704f, 0.467657894f},
-std::array<float,2>{0.0397870727f, 0.987546504f},
-std::array<float,2>{0.753036141f, 0.513529718f},
-std::array<float,2>{0.495547056f, 0.154261097f},
-std::array<float,2>{0.955155492f, 0.000825614145f},
-std::array<float,2>{0.264977545f, 0.665259361f},
-std::array<float,2>{0.590089858f, 0.804478467f},
-std::array<float,2>{0.201634467f, 0.274395406f},
-std::array<float,2>{0.816591501f, 0.323189616f},
-std::array<float,2>{0.390351295f, 0.813699901f},
-std::array<float,2>{0.638282776f, 0.691475689f},
-std::array<float,2>{0.106802888f, 0.0928321704f},
-std::array<float,2>{0.553190351f, 0.217771903f},
-std::array<float,2>{0.152014807f, 0.582973838f},
-std::array<float,2>{0.920710683f, 0.904647291f},
-std::array<float,2>{0.327047616f, 0.428829402f},
-std::array<float,2>{0.604511321f, 0.291443139f},
-std::array<float,2>{0.236035079f, 0.767988443f},
-std::array<float,2>{0.986882567f, 0.63196516f},
-std::array<float,2>{0.286404371f, 0.0574998744f},
-std::array<float,2>{0.802533984f, 0.172992766f},
-std::array<float,2>{0.461404026f, 0.535256207f},
-std::array<float,2>{0.713241398f, 0.960930228f},
-std::array<float,2>{0.0288228802f, 0.476212263f},
-std::array<float,2>{0.89166832f, 0.394277096f},
-std::array<float,2>{0.351289004f, 0.909776509f},
-std::array<float,2>{0.506192863f, 0.603938639f},
-std::array<float,2>{0.169755846f, 0.244393051f},
-std::array<float,2>{0.662665784f, 0.0956756547f},
-std::array<float,2>{0.0752005875f, 0.721013129f},
-std::array<float,2>{0.852338195f, 0.87299335f},
-std::array<float,2>{0.435406059f, 0.364445597f},
-std::array<float,2>{0.648869514f, 0.346495509f},
-std::array<float,2>{0.116856709f, 0.848483086f},
-std::array<float,2>{0.836808741f, 0.739309013f},
-std::array<float,2>{0.392664611f, 0.117761321f},
-std::array<float,2>{0.931702137f, 0.23027055f},
-std::array<float,2>{0.33729142f, 0.614727199f},
-std::array<float,2>{0.545612931f, 0.92758584f},
-std::array<float,2>{0.137577623f, 0.388978809f},
-std::array<float,2>{0.768291891f, 0.497705936f},
-std::array<float,2>{0.472749949f, 0.947952986f},
-std::array<float,2>{0.739208281f, 0.556331813f},
-std::array<float,2>{0.0529345162f, 0.157816932f},
-std::array<float,2>{0.575580478f, 0.0464656837f},
-std::array<float,2>{0.214380279f, 0.648121595f},
-std::array<float,2>{0.942957878f, 0.758703947f},
-std::array<float,2>{0.274695277f, 0.298136681f},
-std::array<float,2>{0.529664874f, 0.406366378f},
-std::array<float,2>{0.177309647f, 0.889666975f},
-std::array<float,2>{0.884006143f, 0.563238025f},
-std::array<float,2>{0.370708317f, 0.194634825f},
-std::array<float,2>{0.86373806f, 0.0695713758f},
-std::array<float,2>{0.409006745f, 0.714038968f},
-std::array<float,2>{0.685479581f, 0.836359322f},
-std::array<float,2>{0.0884298459f, 0.337925315f},
-std::array<float,2>{0.976229906f, 0.26343593f},
-std::array<float,2>{0.299435556f, 0.787157059f},
-std::array<float,2>{0.609513998f, 0.676223099f},
-std::array<float,2>{0.223466918f, 0.0238532424f},
-std::array<float,2>{0.693652987f, 0.139503121f},
-std::array<float,2>{0.0142750358f, 0.522064984f},
-std::array<float,2>{0.781376779f, 0.973296285f},
-std::array<float,2>{0.450328231f, 0.437889606f}}
\ No newline at end of file
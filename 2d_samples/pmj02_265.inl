@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.186346889f, 0.0812157542f},
-std::array<float,2>{0.862526357f, 0.994464934f},
-std::array<float,2>{0.556192398f, 0.369116783f},
-std::array<float,2>{0.450073719f, 0.539412796f},
-std::array<float,2>{0.362099439f, 0.388435781f},
-std::array<float,2>{0.660074472f, 0.655040562f},
-std::array<float,2>{0.991749525f, 0.236641735f},
-std::array<float,2>{0.0201139878f, 0.843534052f},
-std::array<float,2>{0.413593292f, 0.174428269f},
-std::array<float,2>{0.58777231f, 0.763247788f},
-std::array<float,2>{0.769146502f, 0.464536548f},
-std::array<float,2>{0.233678699f, 0.703719258f},
-std::array<float,2>{0.0770978257f, 0.290148139f},
-std::array<float,2>{0.882934213f, 0.584391296f},
-std::array<float,2>{0.694582939f, 0.0135953268f},
-std::array<float,2>{0.255899876f, 0.891119719f},
-std::array<float,2>{0.032188084f, 0.212181285f},
-std::array<float,2>{0.953141153f, 0.848716021f},
-std::array<float,2>{0.650743544f, 0.41720736f},
-std::array<float,2>{0.342397451f, 0.659852266f},
-std::array<float,2>{0.477631897f, 0.327853382f},
-std::array<float,2>{0.508314669f, 0.515030921f},
-std::array<float,2>{0.837119937f, 0.118665412f},
-std::array<float,2>{0.129178002f, 0.961289227f},
-std::array<float,2>{0.288849682f, 0.0589193627f},
-std::array<float,2>{0.749744773f, 0.908197999f},
-std::array<float,2>{0.93073386f, 0.277246654f},
-std::array<float,2>{0.0951671377f, 0.600601912f},
-std::array<float,2>{0.217621461f, 0.490607738f},
-std::array<float,2>{0.811921716f, 0.7261554f},
-std::array<float,2>{0.622391582f, 0.137176841f},
-std::array<float,2>{0.394957364f, 0.802882791f},
-std::array<float,2>{0.238416642f, 0.150920287f},
-std::array<float,2>{0.762539446f, 0.781530201f},
-std::array<float,2>{0.568607569f, 0.473772287f},
-std::array<float,2>{0.426988214f, 0.735450685f},
-std::array<float,2>{0.274783432f, 0.255608678f},
-std::array<float,2>{0.710318089f, 0.613433421f},
-std::array<float,2>{0.890819967f, 0.0317350551f},
-std::array<float,2>{0.0842440203f, 0.924344897f},
-std::array<float,2>{0.467561275f, 0.0997706279f},
-std::array<float,2>{0.538702309f, 0.952178299f},
-std::array<float,2>{0.844093144f, 0.33804059f},
-std::array<float,2>{0.167513371f, 0.524108946f},
-std::array<float,2>{0.00516347075f, 0.423822403f},
-std::array<float,2>{0.973086834f, 0.679544568f},
-std::array<float,2>{0.681697667f, 0.194482192f},
-std::array<float,2>{0.348436832f, 0.869223714f},
-std::array<float,2>{0.109779701f, 0.0223225672f},
-std::array<float,2>{0.916353941f, 0.888457f},
-std::array<float,2>{0.72916019f, 0.310083777f},
-std::array<float,2>{0.297512352f, 0.564061224f},
-std::array<float,2>{0.376971066f, 0.442519963f},
-std::array<float,2>{0.607069731f, 0.695723832f},
-std::array<float,2>{0.787839413f, 0.165235907f},
-std::array<float,2>{0.189970091f, 0.774277091f},
-std::array<float,2>{0.32641843f, 0.228907779f},
-std::array<float,2>{0.633601248f, 0.824387908f},
-std::array<float,2>{0.950609028f, 0.395682067f},
-std::array<float,2>{0.0495572425f, 0.630675137f},
-std::array<float,2>{0.146416768f, 0.356718689f},
-std::array<float,2>{0.816301286f, 0.559542656f},
-std::array<float,2>{0.52766192f, 0.066019915f},
-std::array<float,2>{0.490740508f, 0.983067095f},
-std::array<float,2>{0.201727793f, 0.0458587967f},
-std::array<float,2>{0.789146006f, 0.937028766f},
-std::array<float,2>{0.599389195f, 0.262222469f},
-std::array<float,2>{0.388046682f, 0.617986262f},
-std::array<float,2>{0.307670176f, 0.479841024f},
-std::array<float,2>{0.726478219f, 0.745275021f},
-std::array<float,2>{0.909256279f, 0.142497957f},
-std::array<float,2>{0.124948494f, 0.789462864f},
-std::array<float,2>{0.493078023f, 0.199526668f},
-std::array<float,2>{0.519028723f, 0.863462865f},
-std::array<float,2>{0.823544562f, 0.431510866f},
-std::array<float,2>{0.155807734f, 0.679904997f},
-std::array<float,2>{0.0572981089f, 0.330247104f},
-std::array<float,2>{0.942361891f, 0.517179728f},
-std::array<float,2>{0.626746833f, 0.103340879f},
-std::array<float,2>{0.316904247f, 0.937643826f},
-std::array<float,2>{0.0916213691f, 0.16250056f},
-std::array<float,2>{0.901158571f, 0.772676587f},
-std::array<float,2>{0.712522566f, 0.451225847f},
-std::array<float,2>{0.271408886f, 0.688559651f},
-std::array<float,2>{0.430905282f, 0.301970392f},
-std::array<float,2>{0.573797345f, 0.575956464f},
-std::array<float,2>{0.756759763f, 0.0310509298f},
-std::array<float,2>{0.244996712f, 0.876071274f},
-std::array<float,2>{0.354173928f, 0.0762987062f},
-std::array<float,2>{0.676209152f, 0.969678819f},
-std::array<float,2>{0.97831285f, 0.345580697f},
-std::array<float,2>{0.00981968176f, 0.551538885f},
-std::array<float,2>{0.162754953f, 0.405435413f},
-std::array<float,2>{0.85338366f, 0.639870882f},
-std::array<float,2>{0.545314252f, 0.225565672f},
-std::array<float,2>{0.457752913f, 0.814744473f},
-std::array<float,2>{0.133158818f, 0.242919058f},
-std::array<float,2>{0.832513809f, 0.829555988f},
-std::array<float,2>{0.505962968f, 0.376494974f},
-std::array<float,2>{0.470196396f, 0.641006947f},
-std::array<float,2>{0.329831898f, 0.364967585f},
-std::array<float,2>{0.646949053f, 0.537880898f},
-std::array<float,2>{0.965328753f, 0.0911834836f},
-std::array<float,2>{0.0435367674f, 0.99071759f},
-std::array<float,2>{0.404045135f, 0.00548047712f},
-std::array<float,2>{0.610493541f, 0.899072886f},
-std::array<float,2>{0.803385258f, 0.281698287f},
-std::array<float,2>{0.20883663f, 0.590116322f},
-std::array<float,2>{0.108453967f, 0.45977515f},
-std::array<float,2>{0.926226437f, 0.713840246f},
-std::array<float,2>{0.738840461f, 0.1854745f},
-std::array<float,2>{0.290252924f, 0.750384569f},
-std::array<float,2>{0.0288016684f, 0.111386366f},
-std::array<float,2>{0.996982098f, 0.958598614f},
-std::array<float,2>{0.668668985f, 0.314417958f},
-std::array<float,2>{0.374541402f, 0.503055036f},
-std::array<float,2>{0.441445738f, 0.410023272f},
-std::array<float,2>{0.553584039f, 0.670140088f},
-std::array<float,2>{0.868999958f, 0.204187319f},
-std::array<float,2>{0.177980751f, 0.854103863f},
-std::array<float,2>{0.265282482f, 0.126760155f},
-std::array<float,2>{0.698801219f, 0.808896422f},
-std::array<float,2>{0.880140841f, 0.494081706f},
-std::array<float,2>{0.0691876039f, 0.726584315f},
-std::array<float,2>{0.222235531f, 0.272726268f},
-std::array<float,2>{0.773583293f, 0.603089988f},
-std::array<float,2>{0.582234144f, 0.0533157848f},
-std::array<float,2>{0.421518117f, 0.918429554f},
-std::array<float,2>{0.230445281f, 0.107135989f},
-std::array<float,2>{0.770325601f, 0.942269444f},
-std::array<float,2>{0.593696356f, 0.334266752f},
-std::array<float,2>{0.407281935f, 0.523161948f},
-std::array<float,2>{0.250099957f, 0.437056482f},
-std::array<float,2>{0.689085901f, 0.685963631f},
-std::array<float,2>{0.889516056f, 0.196210593f},
-std::array<float,2>{0.0716681555f, 0.862264454f},
-std::array<float,2>{0.445372701f, 0.148127005f},
-std::array<float,2>{0.561403036f, 0.795034587f},
-std::array<float,2>{0.867028713f, 0.481359541f},
-std::array<float,2>{0.182794482f, 0.74798578f},
-std::array<float,2>{0.0156390071f, 0.258136868f},
-std::array<float,2>{0.986244619f, 0.624078929f},
-std::array<float,2>{0.662892103f, 0.0419405289f},
-std::array<float,2>{0.36429441f, 0.930608571f},
-std::array<float,2>{0.10102459f, 0.220197544f},
-std::array<float,2>{0.935062826f, 0.817447484f},
-std::array<float,2>{0.742466152f, 0.401085228f},
-std::array<float,2>{0.284736007f, 0.635099471f},
-std::array<float,2>{0.392899692f, 0.350312084f},
-std::array<float,2>{0.620532453f, 0.547694206f},
-std::array<float,2>{0.80741626f, 0.0729868039f},
-std::array<float,2>{0.212697655f, 0.973858058f},
-std::array<float,2>{0.337872356f, 0.0241905097f},
-std::array<float,2>{0.654920995f, 0.881741047f},
-std::array<float,2>{0.958132625f, 0.297251791f},
-std::array<float,2>{0.0365503579f, 0.572063625f},
-std::array<float,2>{0.126871571f, 0.447331011f},
-std::array<float,2>{0.842948556f, 0.691560864f},
-std::array<float,2>{0.514680624f, 0.15929611f},
-std::array<float,2>{0.483693391f, 0.76887089f},
-std::array<float,2>{0.170177579f, 0.182774514f},
-std::array<float,2>{0.848747969f, 0.75671649f},
-std::array<float,2>{0.53161931f, 0.454414189f},
-std::array<float,2>{0.464616448f, 0.718258083f},
-std::array<float,2>{0.344156563f, 0.288336575f},
-std::array<float,2>{0.686396122f, 0.587041974f},
-std::array<float,2>{0.969407439f, 0.00267640152f},
-std::array<float,2>{0.00198653038f, 0.905230582f},
-std::array<float,2>{0.423648864f, 0.0870895162f},
-std::array<float,2>{0.56567049f, 0.986714661f},
-std::array<float,2>{0.76117754f, 0.362566382f},
-std::array<float,2>{0.237293005f, 0.532635868f},
-std::array<float,2>{0.0790398791f, 0.382721841f},
-std::array<float,2>{0.894950211f, 0.646199226f},
-std::array<float,2>{0.705666542f, 0.24995105f},
-std::array<float,2>{0.280462295f, 0.833269835f},
-std::array<float,2>{0.0540304594f, 0.0476178527f},
-std::array<float,2>{0.949185073f, 0.91460073f},
-std::array<float,2>{0.636719704f, 0.265880525f},
-std::array<float,2>{0.323494762f, 0.608556092f},
-std::array<float,2>{0.486195087f, 0.49639672f},
-std::array<float,2>{0.525774419f, 0.733800888f},
-std::array<float,2>{0.819015026f, 0.129596338f},
-std::array<float,2>{0.142307818f, 0.806776404f},
-std::array<float,2>{0.304070771f, 0.210663572f},
-std::array<float,2>{0.733784735f, 0.859364092f},
-std::array<float,2>{0.921074629f, 0.41210708f},
-std::array<float,2>{0.11596822f, 0.666481018f},
-std::array<float,2>{0.19234699f, 0.320120841f},
-std::array<float,2>{0.782827556f, 0.505453229f},
-std::array<float,2>{0.603776157f, 0.115866549f},
-std::array<float,2>{0.381847411f, 0.954087317f},
-std::array<float,2>{0.151078805f, 0.00781257451f},
-std::array<float,2>{0.824634612f, 0.895666301f},
-std::array<float,2>{0.523089051f, 0.29345578f},
-std::array<float,2>{0.498143852f, 0.579877257f},
-std::array<float,2>{0.315958738f, 0.466782212f},
-std::array<float,2>{0.631395757f, 0.70971477f},
-std::array<float,2>{0.941224158f, 0.175991729f},
-std::array<float,2>{0.0604793355f, 0.761574507f},
-std::array<float,2>{0.384568065f, 0.240796909f},
-std::array<float,2>{0.593806803f, 0.83928746f},
-std::array<float,2>{0.79399085f, 0.385720521f},
-std::array<float,2>{0.195362613f, 0.651103973f},
-std::array<float,2>{0.117249437f, 0.374971867f},
-std::array<float,2>{0.912486613f, 0.54410702f},
-std::array<float,2>{0.719128907f, 0.0852846727f},
-std::array<float,2>{0.309404135f, 0.996185958f},
-std::array<float,2>{0.0133456904f, 0.13588433f},
-std::array<float,2>{0.982910812f, 0.800195336f},
-std::array<float,2>{0.674606204f, 0.486108184f},
-std::array<float,2>{0.358546704f, 0.721678793f},
-std::array<float,2>{0.456714153f, 0.279366821f},
-std::array<float,2>{0.540996313f, 0.594833791f},
-std::array<float,2>{0.858662486f, 0.0562842786f},
-std::array<float,2>{0.159457579f, 0.911952615f},
-std::array<float,2>{0.268701106f, 0.124244384f},
-std::array<float,2>{0.718176723f, 0.96820581f},
-std::array<float,2>{0.904104531f, 0.322508693f},
-std::array<float,2>{0.087977156f, 0.510726511f},
-std::array<float,2>{0.2495116f, 0.420296222f},
-std::array<float,2>{0.750833213f, 0.661758065f},
-std::array<float,2>{0.575689793f, 0.215338215f},
-std::array<float,2>{0.434460551f, 0.844660282f},
-std::array<float,2>{0.204896465f, 0.189663664f},
-std::array<float,2>{0.798486412f, 0.87395978f},
-std::array<float,2>{0.614538431f, 0.426013559f},
-std::array<float,2>{0.402301997f, 0.674395144f},
-std::array<float,2>{0.29636991f, 0.343265444f},
-std::array<float,2>{0.735739946f, 0.528941035f},
-std::array<float,2>{0.923530638f, 0.0950264782f},
-std::array<float,2>{0.102716543f, 0.948412001f},
-std::array<float,2>{0.475398272f, 0.0359398238f},
-std::array<float,2>{0.500365853f, 0.927391887f},
-std::array<float,2>{0.828863025f, 0.250073373f},
-std::array<float,2>{0.136971518f, 0.610892236f},
-std::array<float,2>{0.0428349525f, 0.47016418f},
-std::array<float,2>{0.962918758f, 0.741444588f},
-std::array<float,2>{0.64301753f, 0.155873865f},
-std::array<float,2>{0.335553586f, 0.787910283f},
-std::array<float,2>{0.0660786629f, 0.0692734942f},
-std::array<float,2>{0.876369357f, 0.97656256f},
-std::array<float,2>{0.702408314f, 0.352666467f},
-std::array<float,2>{0.258036256f, 0.55516839f},
-std::array<float,2>{0.414895684f, 0.394349635f},
-std::array<float,2>{0.57967627f, 0.626864254f},
-std::array<float,2>{0.779140055f, 0.230596468f},
-std::array<float,2>{0.224051803f, 0.823632717f},
-std::array<float,2>{0.368069261f, 0.168593168f},
-std::array<float,2>{0.667864561f, 0.777970016f},
-std::array<float,2>{0.992720425f, 0.437750667f},
-std::array<float,2>{0.0248601083f, 0.700383365f},
-std::array<float,2>{0.17426604f, 0.305045605f},
-std::array<float,2>{0.87244457f, 0.568929613f},
-std::array<float,2>{0.549135506f, 0.0169266257f},
-std::array<float,2>{0.44018805f, 0.883334935f},
-std::array<float,2>{0.132509023f, 0.119206563f},
-std::array<float,2>{0.839363635f, 0.964008987f},
-std::array<float,2>{0.511452019f, 0.325567037f},
-std::array<float,2>{0.480268717f, 0.513473392f},
-std::array<float,2>{0.340623438f, 0.415514112f},
-std::array<float,2>{0.649026036f, 0.656734824f},
-std::array<float,2>{0.956141412f, 0.213037118f},
-std::array<float,2>{0.0343128964f, 0.850225985f},
-std::array<float,2>{0.397513658f, 0.139758095f},
-std::array<float,2>{0.624835849f, 0.802538097f},
-std::array<float,2>{0.809202671f, 0.489459753f},
-std::array<float,2>{0.216752604f, 0.722698092f},
-std::array<float,2>{0.0961438715f, 0.275177479f},
-std::array<float,2>{0.931662381f, 0.599280655f},
-std::array<float,2>{0.747085631f, 0.061201334f},
-std::array<float,2>{0.285913825f, 0.909955442f},
-std::array<float,2>{0.0218427721f, 0.234836265f},
-std::array<float,2>{0.989508271f, 0.840303659f},
-std::array<float,2>{0.658177197f, 0.388834864f},
-std::array<float,2>{0.359835774f, 0.6528548f},
-std::array<float,2>{0.452249795f, 0.371047914f},
-std::array<float,2>{0.557404697f, 0.542008042f},
-std::array<float,2>{0.860521615f, 0.0787355304f},
-std::array<float,2>{0.18405287f, 0.992633641f},
-std::array<float,2>{0.255690128f, 0.0151014626f},
-std::array<float,2>{0.692599773f, 0.892827809f},
-std::array<float,2>{0.886623442f, 0.292436987f},
-std::array<float,2>{0.0753336325f, 0.58360076f},
-std::array<float,2>{0.231712446f, 0.461601585f},
-std::array<float,2>{0.765821755f, 0.706057429f},
-std::array<float,2>{0.587945998f, 0.173360184f},
-std::array<float,2>{0.411858737f, 0.764627159f},
-std::array<float,2>{0.189212382f, 0.167380869f},
-std::array<float,2>{0.785753429f, 0.777254403f},
-std::array<float,2>{0.608441234f, 0.443493187f},
-std::array<float,2>{0.375324398f, 0.697783589f},
-std::array<float,2>{0.29927507f, 0.312038422f},
-std::array<float,2>{0.7266078f, 0.565406024f},
-std::array<float,2>{0.915336668f, 0.0208273865f},
-std::array<float,2>{0.111936688f, 0.889769554f},
-std::array<float,2>{0.488857061f, 0.0628505573f},
-std::array<float,2>{0.530292392f, 0.980768323f},
-std::array<float,2>{0.813558996f, 0.357532889f},
-std::array<float,2>{0.147644088f, 0.562004268f},
-std::array<float,2>{0.0486779213f, 0.398228228f},
-std::array<float,2>{0.951942444f, 0.631338537f},
-std::array<float,2>{0.634943902f, 0.22697787f},
-std::array<float,2>{0.325798869f, 0.827965558f},
-std::array<float,2>{0.0837764367f, 0.0347983204f},
-std::array<float,2>{0.893205822f, 0.922979355f},
-std::array<float,2>{0.707692027f, 0.256613016f},
-std::array<float,2>{0.275987536f, 0.616908729f},
-std::array<float,2>{0.428830564f, 0.475188076f},
-std::array<float,2>{0.567513168f, 0.736757398f},
-std::array<float,2>{0.765022755f, 0.149827257f},
-std::array<float,2>{0.241395652f, 0.784440339f},
-std::array<float,2>{0.350223452f, 0.192339033f},
-std::array<float,2>{0.681120276f, 0.868739784f},
-std::array<float,2>{0.974828541f, 0.424145848f},
-std::array<float,2>{0.00756100472f, 0.675971091f},
-std::array<float,2>{0.164416298f, 0.336686552f},
-std::array<float,2>{0.847025037f, 0.525607765f},
-std::array<float,2>{0.536428452f, 0.0991458148f},
-std::array<float,2>{0.465175301f, 0.950807035f},
-std::array<float,2>{0.243575826f, 0.0274247602f},
-std::array<float,2>{0.754524171f, 0.877155662f},
-std::array<float,2>{0.57062149f, 0.304480851f},
-std::array<float,2>{0.433348f, 0.576535821f},
-std::array<float,2>{0.271677315f, 0.450112909f},
-std::array<float,2>{0.713296592f, 0.690854728f},
-std::array<float,2>{0.899979889f, 0.161619231f},
-std::array<float,2>{0.0918692052f, 0.769753575f},
-std::array<float,2>{0.460721433f, 0.222915053f},
-std::array<float,2>{0.544834077f, 0.812962174f},
-std::array<float,2>{0.85364151f, 0.404079348f},
-std::array<float,2>{0.160290688f, 0.638403952f},
-std::array<float,2>{0.00817165617f, 0.34742099f},
-std::array<float,2>{0.979074657f, 0.553356051f},
-std::array<float,2>{0.67868036f, 0.0743568018f},
-std::array<float,2>{0.352067232f, 0.971986651f},
-std::array<float,2>{0.121341169f, 0.143864229f},
-std::array<float,2>{0.907983184f, 0.791827142f},
-std::array<float,2>{0.722831845f, 0.477746993f},
-std::array<float,2>{0.306329906f, 0.743429005f},
-std::array<float,2>{0.389708668f, 0.263813168f},
-std::array<float,2>{0.600815475f, 0.620875001f},
-std::array<float,2>{0.791108847f, 0.0435864665f},
-std::array<float,2>{0.200123072f, 0.93510139f},
-std::array<float,2>{0.319088817f, 0.105140157f},
-std::array<float,2>{0.627727807f, 0.940234542f},
-std::array<float,2>{0.944033802f, 0.328523219f},
-std::array<float,2>{0.0563063584f, 0.517956913f},
-std::array<float,2>{0.153953299f, 0.432373852f},
-std::array<float,2>{0.820634484f, 0.682550371f},
-std::array<float,2>{0.515705645f, 0.201816022f},
-std::array<float,2>{0.495619118f, 0.866820514f},
-std::array<float,2>{0.176383853f, 0.20538491f},
-std::array<float,2>{0.869772613f, 0.851930618f},
-std::array<float,2>{0.551476479f, 0.408086121f},
-std::array<float,2>{0.44356066f, 0.668384969f},
-std::array<float,2>{0.372307986f, 0.314736754f},
-std::array<float,2>{0.669935107f, 0.500105619f},
-std::array<float,2>{0.998835027f, 0.111099027f},
-std::array<float,2>{0.0308092125f, 0.960790336f},
-std::array<float,2>{0.41950044f, 0.0520528965f},
-std::array<float,2>{0.584236145f, 0.921088934f},
-std::array<float,2>{0.775636673f, 0.27144441f},
-std::array<float,2>{0.220144138f, 0.603960872f},
-std::array<float,2>{0.0679567531f, 0.494461805f},
-std::array<float,2>{0.882538855f, 0.72910881f},
-std::array<float,2>{0.696525991f, 0.128550932f},
-std::array<float,2>{0.263064086f, 0.810643494f},
-std::array<float,2>{0.0464894362f, 0.0926976055f},
-std::array<float,2>{0.967226207f, 0.989828885f},
-std::array<float,2>{0.646098137f, 0.366338432f},
-std::array<float,2>{0.330292314f, 0.536819041f},
-std::array<float,2>{0.471056074f, 0.378884554f},
-std::array<float,2>{0.504614294f, 0.644206762f},
-std::array<float,2>{0.835373402f, 0.245314032f},
-std::array<float,2>{0.135809362f, 0.8318367f},
-std::array<float,2>{0.291142434f, 0.186547205f},
-std::array<float,2>{0.741892934f, 0.753423333f},
-std::array<float,2>{0.92874372f, 0.45718807f},
-std::array<float,2>{0.106706485f, 0.712414026f},
-std::array<float,2>{0.210893139f, 0.283744425f},
-std::array<float,2>{0.801765501f, 0.592519104f},
-std::array<float,2>{0.61304599f, 0.00599533087f},
-std::array<float,2>{0.404564291f, 0.901046038f},
-std::array<float,2>{0.213748544f, 0.0712220073f},
-std::array<float,2>{0.80504328f, 0.975356817f},
-std::array<float,2>{0.618831336f, 0.348024905f},
-std::array<float,2>{0.39141798f, 0.550239205f},
-std::array<float,2>{0.281772047f, 0.399004728f},
-std::array<float,2>{0.745922148f, 0.634693146f},
-std::array<float,2>{0.936047435f, 0.222477272f},
-std::array<float,2>{0.0977684483f, 0.818453789f},
-std::array<float,2>{0.48082298f, 0.15697521f},
-std::array<float,2>{0.513273954f, 0.765969813f},
-std::array<float,2>{0.841465592f, 0.44656691f},
-std::array<float,2>{0.128569588f, 0.694193959f},
-std::array<float,2>{0.0371430144f, 0.298972577f},
-std::array<float,2>{0.960245371f, 0.572585821f},
-std::array<float,2>{0.654018283f, 0.0257035699f},
-std::array<float,2>{0.339731783f, 0.879735351f},
-std::array<float,2>{0.0726004615f, 0.197526112f},
-std::array<float,2>{0.888621092f, 0.8608886f},
-std::array<float,2>{0.691283643f, 0.434401095f},
-std::array<float,2>{0.251971304f, 0.685180306f},
-std::array<float,2>{0.409795612f, 0.333029807f},
-std::array<float,2>{0.591023266f, 0.520807385f},
-std::array<float,2>{0.772927582f, 0.107586086f},
-std::array<float,2>{0.227122739f, 0.944134533f},
-std::array<float,2>{0.365787089f, 0.0404644758f},
-std::array<float,2>{0.660535693f, 0.933411717f},
-std::array<float,2>{0.986785114f, 0.260147333f},
-std::array<float,2>{0.0191380251f, 0.621177018f},
-std::array<float,2>{0.180313125f, 0.483704388f},
-std::array<float,2>{0.864901245f, 0.748240948f},
-std::array<float,2>{0.558824182f, 0.14562121f},
-std::array<float,2>{0.448910177f, 0.793636501f},
-std::array<float,2>{0.144269854f, 0.132395938f},
-std::array<float,2>{0.818068027f, 0.805238545f},
-std::array<float,2>{0.523812234f, 0.499824286f},
-std::array<float,2>{0.488258332f, 0.73211813f},
-std::array<float,2>{0.320854276f, 0.268271029f},
-std::array<float,2>{0.639662683f, 0.607202888f},
-std::array<float,2>{0.946869493f, 0.0505121276f},
-std::array<float,2>{0.0511954539f, 0.917503178f},
-std::array<float,2>{0.380642772f, 0.114329197f},
-std::array<float,2>{0.601806104f, 0.955970585f},
-std::array<float,2>{0.783832252f, 0.318337947f},
-std::array<float,2>{0.19391945f, 0.50701499f},
-std::array<float,2>{0.113757387f, 0.413894325f},
-std::array<float,2>{0.918882191f, 0.66431278f},
-std::array<float,2>{0.732164621f, 0.208833009f},
-std::array<float,2>{0.302189618f, 0.8572281f},
-std::array<float,2>{0.00147286733f, 0.00134362723f},
-std::array<float,2>{0.971778572f, 0.903560102f},
-std::array<float,2>{0.683660328f, 0.286836833f},
-std::array<float,2>{0.346516132f, 0.588949502f},
-std::array<float,2>{0.462576479f, 0.456516862f},
-std::array<float,2>{0.53328234f, 0.715024412f},
-std::array<float,2>{0.85058409f, 0.180356115f},
-std::array<float,2>{0.169469923f, 0.754600286f},
-std::array<float,2>{0.277894258f, 0.246749908f},
-std::array<float,2>{0.704488635f, 0.835562885f},
-std::array<float,2>{0.898148894f, 0.378924996f},
-std::array<float,2>{0.0805285349f, 0.647952318f},
-std::array<float,2>{0.234626532f, 0.361285776f},
-std::array<float,2>{0.759071767f, 0.533254027f},
-std::array<float,2>{0.563165903f, 0.0882017165f},
-std::array<float,2>{0.424700648f, 0.984548092f},
-std::array<float,2>{0.15668194f, 0.0583080873f},
-std::array<float,2>{0.855537176f, 0.912501872f},
-std::array<float,2>{0.541249514f, 0.279164821f},
-std::array<float,2>{0.453640074f, 0.596137643f},
-std::array<float,2>{0.357102752f, 0.488147616f},
-std::array<float,2>{0.672098637f, 0.720618486f},
-std::array<float,2>{0.98073566f, 0.134716004f},
-std::array<float,2>{0.0142225949f, 0.798049867f},
-std::array<float,2>{0.437460124f, 0.217726186f},
-std::array<float,2>{0.577793062f, 0.846152067f},
-std::array<float,2>{0.753154576f, 0.41824007f},
-std::array<float,2>{0.246919289f, 0.662139833f},
-std::array<float,2>{0.0868760943f, 0.321011752f},
-std::array<float,2>{0.905785561f, 0.508023024f},
-std::array<float,2>{0.716664851f, 0.122188583f},
-std::array<float,2>{0.266552418f, 0.965247691f},
-std::array<float,2>{0.0611573979f, 0.177856699f},
-std::array<float,2>{0.937595248f, 0.757822454f},
-std::array<float,2>{0.629760802f, 0.468452364f},
-std::array<float,2>{0.313312531f, 0.707975328f},
-std::array<float,2>{0.49764812f, 0.295421928f},
-std::array<float,2>{0.519792676f, 0.581274331f},
-std::array<float,2>{0.82672888f, 0.0113860434f},
-std::array<float,2>{0.148667589f, 0.896684468f},
-std::array<float,2>{0.311268538f, 0.0828990862f},
-std::array<float,2>{0.720883369f, 0.998157382f},
-std::array<float,2>{0.910289109f, 0.371693403f},
-std::array<float,2>{0.120548226f, 0.546378136f},
-std::array<float,2>{0.19732897f, 0.384506226f},
-std::array<float,2>{0.796614289f, 0.648852229f},
-std::array<float,2>{0.597101748f, 0.238391608f},
-std::array<float,2>{0.385050923f, 0.836183548f},
-std::array<float,2>{0.225049064f, 0.232437894f},
-std::array<float,2>{0.779431045f, 0.821738064f},
-std::array<float,2>{0.581848204f, 0.39157778f},
-std::array<float,2>{0.417879343f, 0.627514958f},
-std::array<float,2>{0.260897964f, 0.354738355f},
-std::array<float,2>{0.700854421f, 0.557576776f},
-std::array<float,2>{0.8788445f, 0.06774728f},
-std::array<float,2>{0.0628795996f, 0.980118334f},
-std::array<float,2>{0.438454479f, 0.019029934f},
-std::array<float,2>{0.547107399f, 0.886334419f},
-std::array<float,2>{0.87346971f, 0.306687772f},
-std::array<float,2>{0.172877684f, 0.567613423f},
-std::array<float,2>{0.0255175177f, 0.44128406f},
-std::array<float,2>{0.995551288f, 0.701367617f},
-std::array<float,2>{0.665393829f, 0.171719506f},
-std::array<float,2>{0.369286865f, 0.78039521f},
-std::array<float,2>{0.104190566f, 0.0966998413f},
-std::array<float,2>{0.924669981f, 0.947037101f},
-std::array<float,2>{0.736644328f, 0.340870589f},
-std::array<float,2>{0.293542266f, 0.530440032f},
-std::array<float,2>{0.39976269f, 0.428521186f},
-std::array<float,2>{0.616644502f, 0.67316848f},
-std::array<float,2>{0.799562216f, 0.189045832f},
-std::array<float,2>{0.206193864f, 0.871118188f},
-std::array<float,2>{0.33342734f, 0.152385905f},
-std::array<float,2>{0.642214119f, 0.785331249f},
-std::array<float,2>{0.962542892f, 0.471815974f},
-std::array<float,2>{0.0408723354f, 0.738654912f},
-std::array<float,2>{0.139719263f, 0.253328055f},
-std::array<float,2>{0.83076942f, 0.611713111f},
-std::array<float,2>{0.503628433f, 0.038467098f},
-std::array<float,2>{0.473675519f, 0.928473413f},
-std::array<float,2>{0.146999434f, 0.0648723468f},
-std::array<float,2>{0.812991381f, 0.984313667f},
-std::array<float,2>{0.529494166f, 0.356101811f},
-std::array<float,2>{0.489265025f, 0.560277283f},
-std::array<float,2>{0.324943423f, 0.395232141f},
-std::array<float,2>{0.635829806f, 0.629583001f},
-std::array<float,2>{0.95254451f, 0.229526266f},
-std::array<float,2>{0.0471331142f, 0.826166391f},
-std::array<float,2>{0.376366287f, 0.164519459f},
-std::array<float,2>{0.608380854f, 0.774594128f},
-std::array<float,2>{0.786423802f, 0.442146927f},
-std::array<float,2>{0.188166618f, 0.696778536f},
-std::array<float,2>{0.112706348f, 0.309406519f},
-std::array<float,2>{0.914538562f, 0.562504947f},
-std::array<float,2>{0.728156626f, 0.023192104f},
-std::array<float,2>{0.300565869f, 0.88682121f},
-std::array<float,2>{0.00647265464f, 0.194254443f},
-std::array<float,2>{0.976206422f, 0.870816886f},
-std::array<float,2>{0.680179f, 0.422678202f},
-std::array<float,2>{0.351424783f, 0.678700864f},
-std::array<float,2>{0.466602117f, 0.339336514f},
-std::array<float,2>{0.535590768f, 0.524528861f},
-std::array<float,2>{0.846623719f, 0.101048075f},
-std::array<float,2>{0.165555179f, 0.951374412f},
-std::array<float,2>{0.276875675f, 0.0331203565f},
-std::array<float,2>{0.708041191f, 0.925167561f},
-std::array<float,2>{0.894436061f, 0.254240125f},
-std::array<float,2>{0.0823559538f, 0.614584684f},
-std::array<float,2>{0.240237728f, 0.473043591f},
-std::array<float,2>{0.764413178f, 0.734891713f},
-std::array<float,2>{0.567019165f, 0.151435748f},
-std::array<float,2>{0.428209245f, 0.782750309f},
-std::array<float,2>{0.215211749f, 0.138318077f},
-std::array<float,2>{0.81036979f, 0.804477513f},
-std::array<float,2>{0.623907566f, 0.491384774f},
-std::array<float,2>{0.39740476f, 0.724963248f},
-std::array<float,2>{0.286156714f, 0.275461495f},
-std::array<float,2>{0.746951044f, 0.599633634f},
-std::array<float,2>{0.933519661f, 0.0595923923f},
-std::array<float,2>{0.0974176005f, 0.906372309f},
-std::array<float,2>{0.478838146f, 0.117224909f},
-std::array<float,2>{0.510577202f, 0.962293506f},
-std::array<float,2>{0.838455856f, 0.326853365f},
-std::array<float,2>{0.131411955f, 0.5140028f},
-std::array<float,2>{0.0334318578f, 0.416071385f},
-std::array<float,2>{0.95570451f, 0.659029961f},
-std::array<float,2>{0.650128186f, 0.21135664f},
-std::array<float,2>{0.340927422f, 0.848161221f},
-std::array<float,2>{0.0743817016f, 0.0120721599f},
-std::array<float,2>{0.885494053f, 0.891738772f},
-std::array<float,2>{0.691458762f, 0.289495766f},
-std::array<float,2>{0.254389793f, 0.585289001f},
-std::array<float,2>{0.410987824f, 0.463673502f},
-std::array<float,2>{0.589067936f, 0.704627812f},
-std::array<float,2>{0.767055571f, 0.175552234f},
-std::array<float,2>{0.231134444f, 0.761756241f},
-std::array<float,2>{0.361183912f, 0.237584159f},
-std::array<float,2>{0.656405032f, 0.842748761f},
-std::array<float,2>{0.988965452f, 0.386757731f},
-std::array<float,2>{0.0231235307f, 0.656207323f},
-std::array<float,2>{0.185035825f, 0.367732793f},
-std::array<float,2>{0.859779298f, 0.540259957f},
-std::array<float,2>{0.557953238f, 0.0805221722f},
-std::array<float,2>{0.451743573f, 0.99581778f},
-std::array<float,2>{0.219288871f, 0.0543480292f},
-std::array<float,2>{0.776686728f, 0.919476867f},
-std::array<float,2>{0.585066199f, 0.271749943f},
-std::array<float,2>{0.418022156f, 0.601835012f},
-std::array<float,2>{0.262496263f, 0.492608964f},
-std::array<float,2>{0.695710599f, 0.728026688f},
-std::array<float,2>{0.881628335f, 0.125617936f},
-std::array<float,2>{0.067128852f, 0.809662342f},
-std::array<float,2>{0.44443205f, 0.203154296f},
-std::array<float,2>{0.552374661f, 0.854999006f},
-std::array<float,2>{0.871036172f, 0.409108311f},
-std::array<float,2>{0.177028492f, 0.671365917f},
-std::array<float,2>{0.0301464759f, 0.313137591f},
-std::array<float,2>{0.99992317f, 0.502405524f},
-std::array<float,2>{0.671095073f, 0.112625845f},
-std::array<float,2>{0.372064263f, 0.9576599f},
-std::array<float,2>{0.105713338f, 0.184303403f},
-std::array<float,2>{0.92797488f, 0.751692057f},
-std::array<float,2>{0.740817785f, 0.460878432f},
-std::array<float,2>{0.292019755f, 0.714694023f},
-std::array<float,2>{0.405600518f, 0.282584459f},
-std::array<float,2>{0.612271726f, 0.591220438f},
-std::array<float,2>{0.801285744f, 0.00468228525f},
-std::array<float,2>{0.209894851f, 0.899435639f},
-std::array<float,2>{0.331574768f, 0.0899859294f},
-std::array<float,2>{0.644919336f, 0.992118537f},
-std::array<float,2>{0.968311787f, 0.36366266f},
-std::array<float,2>{0.0454070419f, 0.538758457f},
-std::array<float,2>{0.135072783f, 0.375739574f},
-std::array<float,2>{0.834370494f, 0.641912818f},
-std::array<float,2>{0.505481958f, 0.244139895f},
-std::array<float,2>{0.472178876f, 0.82868427f},
-std::array<float,2>{0.16210103f, 0.226029664f},
-std::array<float,2>{0.855151832f, 0.815640152f},
-std::array<float,2>{0.54376173f, 0.40501684f},
-std::array<float,2>{0.459356874f, 0.639290333f},
-std::array<float,2>{0.353066504f, 0.344720542f},
-std::array<float,2>{0.679619789f, 0.552319646f},
-std::array<float,2>{0.979557991f, 0.0772134811f},
-std::array<float,2>{0.00895065721f, 0.970421255f},
-std::array<float,2>{0.431714743f, 0.0295865498f},
-std::array<float,2>{0.57196945f, 0.875857174f},
-std::array<float,2>{0.755227625f, 0.301317066f},
-std::array<float,2>{0.242352054f, 0.574892879f},
-std::array<float,2>{0.0935107991f, 0.453020543f},
-std::array<float,2>{0.898796082f, 0.68822968f},
-std::array<float,2>{0.71419698f, 0.16347453f},
-std::array<float,2>{0.272538453f, 0.772347093f},
-std::array<float,2>{0.0548890792f, 0.101729505f},
-std::array<float,2>{0.945128798f, 0.938748777f},
-std::array<float,2>{0.628750801f, 0.33115834f},
-std::array<float,2>{0.319981515f, 0.516364634f},
-std::array<float,2>{0.495017946f, 0.430057228f},
-std::array<float,2>{0.516852319f, 0.680859804f},
-std::array<float,2>{0.821308374f, 0.200540915f},
-std::array<float,2>{0.152998284f, 0.864683807f},
-std::array<float,2>{0.304730177f, 0.140819952f},
-std::array<float,2>{0.724087358f, 0.790767252f},
-std::array<float,2>{0.906365275f, 0.479058027f},
-std::array<float,2>{0.122133665f, 0.744618118f},
-std::array<float,2>{0.200371295f, 0.262838513f},
-std::array<float,2>{0.792740941f, 0.618905246f},
-std::array<float,2>{0.600390434f, 0.046347633f},
-std::array<float,2>{0.388982505f, 0.935700297f},
-std::array<float,2>{0.194669947f, 0.116632424f},
-std::array<float,2>{0.784286976f, 0.955018818f},
-std::array<float,2>{0.602623522f, 0.318907648f},
-std::array<float,2>{0.379093856f, 0.504242301f},
-std::array<float,2>{0.301315099f, 0.411130905f},
-std::array<float,2>{0.731099069f, 0.667283595f},
-std::array<float,2>{0.919649601f, 0.20963259f},
-std::array<float,2>{0.114585273f, 0.857559204f},
-std::array<float,2>{0.487262875f, 0.130771399f},
-std::array<float,2>{0.525385797f, 0.807652771f},
-std::array<float,2>{0.816855133f, 0.497888505f},
-std::array<float,2>{0.143042043f, 0.732686341f},
-std::array<float,2>{0.051855199f, 0.267093658f},
-std::array<float,2>{0.945412695f, 0.607832193f},
-std::array<float,2>{0.639076471f, 0.048208531f},
-std::array<float,2>{0.321557045f, 0.915989697f},
-std::array<float,2>{0.081152074f, 0.248153403f},
-std::array<float,2>{0.897001266f, 0.832520962f},
-std::array<float,2>{0.703947306f, 0.381638736f},
-std::array<float,2>{0.278590977f, 0.645214677f},
-std::array<float,2>{0.425535887f, 0.36229974f},
-std::array<float,2>{0.563699126f, 0.531656206f},
-std::array<float,2>{0.758575618f, 0.0865183994f},
-std::array<float,2>{0.235547096f, 0.987402618f},
-std::array<float,2>{0.346878707f, 0.00324156485f},
-std::array<float,2>{0.685354829f, 0.906012535f},
-std::array<float,2>{0.971009016f, 0.287302911f},
-std::array<float,2>{0.000119517281f, 0.586380422f},
-std::array<float,2>{0.168907836f, 0.453903884f},
-std::array<float,2>{0.850782812f, 0.717028737f},
-std::array<float,2>{0.534307241f, 0.181857586f},
-std::array<float,2>{0.46163258f, 0.757044196f},
-std::array<float,2>{0.12739484f, 0.158317417f},
-std::array<float,2>{0.840299428f, 0.768412054f},
-std::array<float,2>{0.512636244f, 0.448814332f},
-std::array<float,2>{0.481741399f, 0.693291605f},
-std::array<float,2>{0.338695884f, 0.297893435f},
-std::array<float,2>{0.653229177f, 0.57077378f},
-std::array<float,2>{0.959136188f, 0.0247053672f},
-std::array<float,2>{0.0389575958f, 0.881881475f},
-std::array<float,2>{0.392145187f, 0.0737589672f},
-std::array<float,2>{0.617594421f, 0.972673237f},
-std::array<float,2>{0.806542158f, 0.351388574f},
-std::array<float,2>{0.214791596f, 0.548701048f},
-std::array<float,2>{0.0989448503f, 0.402218521f},
-std::array<float,2>{0.937436938f, 0.636177778f},
-std::array<float,2>{0.744457006f, 0.21898976f},
-std::array<float,2>{0.282736003f, 0.817037582f},
-std::array<float,2>{0.0183951855f, 0.0420682915f},
-std::array<float,2>{0.987817347f, 0.931621253f},
-std::array<float,2>{0.661454558f, 0.259394944f},
-std::array<float,2>{0.366947711f, 0.623450994f},
-std::array<float,2>{0.447936565f, 0.481654167f},
-std::array<float,2>{0.559834242f, 0.746095717f},
-std::array<float,2>{0.864146352f, 0.146986946f},
-std::array<float,2>{0.180685237f, 0.79684931f},
-std::array<float,2>{0.253482193f, 0.196379095f},
-std::array<float,2>{0.690272331f, 0.862372696f},
-std::array<float,2>{0.886908054f, 0.436111063f},
-std::array<float,2>{0.0734511912f, 0.687469304f},
-std::array<float,2>{0.227668226f, 0.335305125f},
-std::array<float,2>{0.771987557f, 0.522421181f},
-std::array<float,2>{0.590489388f, 0.106086947f},
-std::array<float,2>{0.40849328f, 0.942959905f},
-std::array<float,2>{0.172166899f, 0.0165388882f},
-std::array<float,2>{0.874624491f, 0.884738684f},
-std::array<float,2>{0.548220098f, 0.306230098f},
-std::array<float,2>{0.439326406f, 0.570224881f},
-std::array<float,2>{0.370593578f, 0.438941061f},
-std::array<float,2>{0.664928794f, 0.700086772f},
-std::array<float,2>{0.994787455f, 0.169853449f},
-std::array<float,2>{0.0272839721f, 0.77926904f},
-std::array<float,2>{0.416910708f, 0.231597617f},
-std::array<float,2>{0.580196142f, 0.822791815f},
-std::array<float,2>{0.780447781f, 0.393534809f},
-std::array<float,2>{0.22580789f, 0.625338197f},
-std::array<float,2>{0.0640038177f, 0.352006823f},
-std::array<float,2>{0.877057433f, 0.556483805f},
-std::array<float,2>{0.699509144f, 0.0699057877f},
-std::array<float,2>{0.260194689f, 0.977601588f},
-std::array<float,2>{0.0392136537f, 0.15509972f},
-std::array<float,2>{0.96108675f, 0.78879869f},
-std::array<float,2>{0.641530216f, 0.469324559f},
-std::array<float,2>{0.332192183f, 0.740575433f},
-std::array<float,2>{0.472863197f, 0.251529932f},
-std::array<float,2>{0.502755761f, 0.609685242f},
-std::array<float,2>{0.831414819f, 0.0361850113f},
-std::array<float,2>{0.139506713f, 0.926350117f},
-std::array<float,2>{0.294531733f, 0.0942498371f},
-std::array<float,2>{0.738167346f, 0.947540998f},
-std::array<float,2>{0.925674498f, 0.342359155f},
-std::array<float,2>{0.105170362f, 0.527917922f},
-std::array<float,2>{0.205642119f, 0.427691221f},
-std::array<float,2>{0.799943686f, 0.674857557f},
-std::array<float,2>{0.616100013f, 0.191285908f},
-std::array<float,2>{0.399164498f, 0.874485731f},
-std::array<float,2>{0.247850448f, 0.216168121f},
-std::array<float,2>{0.75219208f, 0.845551848f},
-std::array<float,2>{0.57633239f, 0.421138734f},
-std::array<float,2>{0.436217308f, 0.6605196f},
-std::array<float,2>{0.267294884f, 0.324099302f},
-std::array<float,2>{0.71490109f, 0.510876596f},
-std::array<float,2>{0.904643655f, 0.123912938f},
-std::array<float,2>{0.0870179012f, 0.967523515f},
-std::array<float,2>{0.454572678f, 0.0551341288f},
-std::array<float,2>{0.542905986f, 0.910990298f},
-std::array<float,2>{0.856725097f, 0.280657798f},
-std::array<float,2>{0.157886952f, 0.59380722f},
-std::array<float,2>{0.0151812909f, 0.484429717f},
-std::array<float,2>{0.981843352f, 0.722535372f},
-std::array<float,2>{0.67324692f, 0.135183632f},
-std::array<float,2>{0.355470777f, 0.79883337f},
-std::array<float,2>{0.119153619f, 0.0845875368f},
-std::array<float,2>{0.911748588f, 0.997204244f},
-std::array<float,2>{0.722479939f, 0.373752773f},
-std::array<float,2>{0.31181699f, 0.543647766f},
-std::array<float,2>{0.386223793f, 0.386706203f},
-std::array<float,2>{0.595817864f, 0.651858687f},
-std::array<float,2>{0.795252442f, 0.241356879f},
-std::array<float,2>{0.19843775f, 0.83799392f},
-std::array<float,2>{0.31366241f, 0.176789135f},
-std::array<float,2>{0.630113482f, 0.759960234f},
-std::array<float,2>{0.938696623f, 0.465490937f},
-std::array<float,2>{0.0617157854f, 0.710004687f},
-std::array<float,2>{0.14990598f, 0.294768393f},
-std::array<float,2>{0.827185392f, 0.578924298f},
-std::array<float,2>{0.520794332f, 0.00943490304f},
-std::array<float,2>{0.496435463f, 0.895139098f},
-std::array<float,2>{0.166362807f, 0.0986114219f},
-std::array<float,2>{0.844887614f, 0.949895382f},
-std::array<float,2>{0.537130356f, 0.337620646f},
-std::array<float,2>{0.467885435f, 0.52701509f},
-std::array<float,2>{0.349259824f, 0.425611228f},
-std::array<float,2>{0.683232009f, 0.677569032f},
-std::array<float,2>{0.974544466f, 0.193277434f},
-std::array<float,2>{0.00449163839f, 0.867931902f},
-std::array<float,2>{0.4261868f, 0.148911878f},
-std::array<float,2>{0.569777548f, 0.783689022f},
-std::array<float,2>{0.763648868f, 0.476268053f},
-std::array<float,2>{0.239978164f, 0.737480104f},
-std::array<float,2>{0.0856285393f, 0.257762164f},
-std::array<float,2>{0.891742229f, 0.616082966f},
-std::array<float,2>{0.709460199f, 0.0340847f},
-std::array<float,2>{0.273904413f, 0.922326505f},
-std::array<float,2>{0.0503376834f, 0.22839199f},
-std::array<float,2>{0.949784338f, 0.826754987f},
-std::array<float,2>{0.634305358f, 0.39711836f},
-std::array<float,2>{0.327983916f, 0.632527828f},
-std::array<float,2>{0.491767824f, 0.359368026f},
-std::array<float,2>{0.528885841f, 0.561218858f},
-std::array<float,2>{0.814603746f, 0.0642769933f},
-std::array<float,2>{0.145456091f, 0.982114613f},
-std::array<float,2>{0.298317581f, 0.0196182951f},
-std::array<float,2>{0.72957319f, 0.889381647f},
-std::array<float,2>{0.917529821f, 0.311026424f},
-std::array<float,2>{0.110983737f, 0.565627694f},
-std::array<float,2>{0.191406116f, 0.445102781f},
-std::array<float,2>{0.789038777f, 0.698437333f},
-std::array<float,2>{0.606001258f, 0.166130483f},
-std::array<float,2>{0.378482521f, 0.775736153f},
-std::array<float,2>{0.232881203f, 0.172444001f},
-std::array<float,2>{0.768251598f, 0.764684021f},
-std::array<float,2>{0.586662233f, 0.462320477f},
-std::array<float,2>{0.412176728f, 0.705441833f},
-std::array<float,2>{0.257665783f, 0.291144192f},
-std::array<float,2>{0.693915009f, 0.583005428f},
-std::array<float,2>{0.884204388f, 0.0144946398f},
-std::array<float,2>{0.0774536133f, 0.894315422f},
-std::array<float,2>{0.450807124f, 0.0796624273f},
-std::array<float,2>{0.555194974f, 0.993382275f},
-std::array<float,2>{0.861672461f, 0.369866878f},
-std::array<float,2>{0.186704785f, 0.541349173f},
-std::array<float,2>{0.021098027f, 0.390316099f},
-std::array<float,2>{0.990978599f, 0.653637469f},
-std::array<float,2>{0.659004986f, 0.235522628f},
-std::array<float,2>{0.362656385f, 0.840865135f},
-std::array<float,2>{0.0940688848f, 0.0616762564f},
-std::array<float,2>{0.929989219f, 0.908781767f},
-std::array<float,2>{0.748677254f, 0.273973405f},
-std::array<float,2>{0.287759215f, 0.597822011f},
-std::array<float,2>{0.395814687f, 0.488304019f},
-std::array<float,2>{0.621117353f, 0.723845899f},
-std::array<float,2>{0.811119616f, 0.139311582f},
-std::array<float,2>{0.218575895f, 0.801278293f},
-std::array<float,2>{0.343548536f, 0.214514107f},
-std::array<float,2>{0.652224541f, 0.850948691f},
-std::array<float,2>{0.954777002f, 0.414983064f},
-std::array<float,2>{0.0331175439f, 0.657240987f},
-std::array<float,2>{0.13041994f, 0.324565679f},
-std::array<float,2>{0.836214006f, 0.512561917f},
-std::array<float,2>{0.509521365f, 0.120148994f},
-std::array<float,2>{0.47684446f, 0.963276207f},
-std::array<float,2>{0.207073972f, 0.0070810914f},
-std::array<float,2>{0.803853631f, 0.901636124f},
-std::array<float,2>{0.609477341f, 0.284476966f},
-std::array<float,2>{0.402370185f, 0.593467534f},
-std::array<float,2>{0.289157033f, 0.458883971f},
-std::array<float,2>{0.739854038f, 0.711381078f},
-std::array<float,2>{0.926837265f, 0.18644613f},
-std::array<float,2>{0.107568659f, 0.75245136f},
-std::array<float,2>{0.469209433f, 0.245070755f},
-std::array<float,2>{0.507354856f, 0.830991328f},
-std::array<float,2>{0.833751321f, 0.377245694f},
-std::array<float,2>{0.134106681f, 0.642583907f},
-std::array<float,2>{0.0441887416f, 0.365290999f},
-std::array<float,2>{0.966676056f, 0.53562218f},
-std::array<float,2>{0.648396909f, 0.0936359838f},
-std::array<float,2>{0.328792512f, 0.988342524f},
-std::array<float,2>{0.0700823814f, 0.127568021f},
-std::array<float,2>{0.879792213f, 0.811700284f},
-std::array<float,2>{0.697392523f, 0.495696604f},
-std::array<float,2>{0.26390186f, 0.729982018f},
-std::array<float,2>{0.420324683f, 0.269801289f},
-std::array<float,2>{0.58311367f, 0.60449481f},
-std::array<float,2>{0.774940193f, 0.0514536984f},
-std::array<float,2>{0.221052364f, 0.920556962f},
-std::array<float,2>{0.373470575f, 0.109415568f},
-std::array<float,2>{0.669734478f, 0.959655583f},
-std::array<float,2>{0.997307897f, 0.315827489f},
-std::array<float,2>{0.0282183979f, 0.501447976f},
-std::array<float,2>{0.179257229f, 0.406297654f},
-std::array<float,2>{0.867948115f, 0.669732273f},
-std::array<float,2>{0.554394484f, 0.206615075f},
-std::array<float,2>{0.442807674f, 0.853423297f},
-std::array<float,2>{0.155018032f, 0.202381745f},
-std::array<float,2>{0.822676063f, 0.865728617f},
-std::array<float,2>{0.517783463f, 0.432846129f},
-std::array<float,2>{0.493288219f, 0.683038712f},
-std::array<float,2>{0.317409724f, 0.329831451f},
-std::array<float,2>{0.625861645f, 0.518794596f},
-std::array<float,2>{0.943237305f, 0.103996642f},
-std::array<float,2>{0.0578812957f, 0.941096604f},
-std::array<float,2>{0.38697058f, 0.0448824763f},
-std::array<float,2>{0.597881556f, 0.93363297f},
-std::array<float,2>{0.790533364f, 0.265527993f},
-std::array<float,2>{0.202503115f, 0.619309366f},
-std::array<float,2>{0.123536102f, 0.476906329f},
-std::array<float,2>{0.908737063f, 0.742643118f},
-std::array<float,2>{0.724621773f, 0.14325279f},
-std::array<float,2>{0.30685097f, 0.792391658f},
-std::array<float,2>{0.0112646548f, 0.0755045041f},
-std::array<float,2>{0.97686255f, 0.970933974f},
-std::array<float,2>{0.677600384f, 0.345712394f},
-std::array<float,2>{0.354741931f, 0.553748608f},
-std::array<float,2>{0.45849064f, 0.402541399f},
-std::array<float,2>{0.546822786f, 0.637601674f},
-std::array<float,2>{0.851829827f, 0.223701462f},
-std::array<float,2>{0.163237616f, 0.813855112f},
-std::array<float,2>{0.270139098f, 0.160166472f},
-std::array<float,2>{0.711284697f, 0.771229148f},
-std::array<float,2>{0.902093947f, 0.451117754f},
-std::array<float,2>{0.0899554193f, 0.689978778f},
-std::array<float,2>{0.245495364f, 0.303388298f},
-std::array<float,2>{0.757333934f, 0.57789588f},
-std::array<float,2>{0.572374046f, 0.0288073067f},
-std::array<float,2>{0.429909378f, 0.878318727f},
-std::array<float,2>{0.237335235f, 0.0894406736f},
-std::array<float,2>{0.760302901f, 0.985859275f},
-std::array<float,2>{0.564653218f, 0.36017099f},
-std::array<float,2>{0.422691345f, 0.534805596f},
-std::array<float,2>{0.280173033f, 0.380409926f},
-std::array<float,2>{0.706812859f, 0.647441387f},
-std::array<float,2>{0.89599508f, 0.247533232f},
-std::array<float,2>{0.0795582682f, 0.834160149f},
-std::array<float,2>{0.463185936f, 0.181472778f},
-std::array<float,2>{0.532423794f, 0.755746961f},
-std::array<float,2>{0.848020554f, 0.455834061f},
-std::array<float,2>{0.171704113f, 0.716384828f},
-std::array<float,2>{0.00349048618f, 0.285172492f},
-std::array<float,2>{0.970623851f, 0.588595986f},
-std::array<float,2>{0.687040091f, 0.000940381025f},
-std::array<float,2>{0.344933689f, 0.903226376f},
-std::array<float,2>{0.117154382f, 0.207326025f},
-std::array<float,2>{0.92079258f, 0.856367469f},
-std::array<float,2>{0.73272723f, 0.412154883f},
-std::array<float,2>{0.303067744f, 0.665729225f},
-std::array<float,2>{0.381784171f, 0.316824794f},
-std::array<float,2>{0.604848981f, 0.505959809f},
-std::array<float,2>{0.781505287f, 0.114171393f},
-std::array<float,2>{0.192547798f, 0.956765771f},
-std::array<float,2>{0.323039502f, 0.0488797985f},
-std::array<float,2>{0.638650537f, 0.916227341f},
-std::array<float,2>{0.947742701f, 0.269037426f},
-std::array<float,2>{0.0537101738f, 0.60602963f},
-std::array<float,2>{0.141504064f, 0.498929799f},
-std::array<float,2>{0.819533706f, 0.730944514f},
-std::array<float,2>{0.526717126f, 0.131824628f},
-std::array<float,2>{0.485177994f, 0.805949509f},
-std::array<float,2>{0.182547182f, 0.145350069f},
-std::array<float,2>{0.865412593f, 0.794181466f},
-std::array<float,2>{0.562254727f, 0.482664853f},
-std::array<float,2>{0.447027653f, 0.749544561f},
-std::array<float,2>{0.363422036f, 0.261004657f},
-std::array<float,2>{0.663893104f, 0.622992098f},
-std::array<float,2>{0.985126019f, 0.0400009081f},
-std::array<float,2>{0.0169032961f, 0.931922555f},
-std::array<float,2>{0.407008886f, 0.108582892f},
-std::array<float,2>{0.59249866f, 0.944601119f},
-std::array<float,2>{0.771011293f, 0.332156062f},
-std::array<float,2>{0.229432181f, 0.51953584f},
-std::array<float,2>{0.0706842393f, 0.434939295f},
-std::array<float,2>{0.890031517f, 0.684542835f},
-std::array<float,2>{0.688125312f, 0.198793739f},
-std::array<float,2>{0.251918226f, 0.859971762f},
-std::array<float,2>{0.0355625041f, 0.0266265795f},
-std::array<float,2>{0.957507551f, 0.880574763f},
-std::array<float,2>{0.655504704f, 0.300005972f},
-std::array<float,2>{0.336908042f, 0.574121356f},
-std::array<float,2>{0.482796967f, 0.446278363f},
-std::array<float,2>{0.514595747f, 0.694805145f},
-std::array<float,2>{0.842497945f, 0.157413423f},
-std::array<float,2>{0.12572448f, 0.767466486f},
-std::array<float,2>{0.283375055f, 0.220991448f},
-std::array<float,2>{0.743556917f, 0.819716811f},
-std::array<float,2>{0.93401444f, 0.399570733f},
-std::array<float,2>{0.100346662f, 0.633306682f},
-std::array<float,2>{0.211459979f, 0.348998934f},
-std::array<float,2>{0.807696223f, 0.549151003f},
-std::array<float,2>{0.619663298f, 0.0717698559f},
-std::array<float,2>{0.394315571f, 0.976264f},
-std::array<float,2>{0.137964785f, 0.0378335193f},
-std::array<float,2>{0.829571307f, 0.92895329f},
-std::array<float,2>{0.501863301f, 0.25243935f},
-std::array<float,2>{0.476262301f, 0.612978995f},
-std::array<float,2>{0.334289879f, 0.47157827f},
-std::array<float,2>{0.643893421f, 0.739355326f},
-std::array<float,2>{0.964679539f, 0.153778046f},
-std::array<float,2>{0.0410717167f, 0.786556482f},
-std::array<float,2>{0.400837064f, 0.187830389f},
-std::array<float,2>{0.613586962f, 0.872755349f},
-std::array<float,2>{0.797828853f, 0.429493934f},
-std::array<float,2>{0.204095781f, 0.672588885f},
-std::array<float,2>{0.102037437f, 0.339883953f},
-std::array<float,2>{0.922429442f, 0.529828191f},
-std::array<float,2>{0.735158145f, 0.0960930511f},
-std::array<float,2>{0.295138448f, 0.945807219f},
-std::array<float,2>{0.0235322211f, 0.170174092f},
-std::array<float,2>{0.993315876f, 0.77943784f},
-std::array<float,2>{0.666962981f, 0.439855039f},
-std::array<float,2>{0.368515402f, 0.702778995f},
-std::array<float,2>{0.440790623f, 0.308186501f},
-std::array<float,2>{0.550423682f, 0.566523969f},
-std::array<float,2>{0.87136507f, 0.0179701895f},
-std::array<float,2>{0.175226748f, 0.884916365f},
-std::array<float,2>{0.259740472f, 0.0666094944f},
-std::array<float,2>{0.701633692f, 0.979189813f},
-std::array<float,2>{0.875334263f, 0.354089051f},
-std::array<float,2>{0.065376997f, 0.557825506f},
-std::array<float,2>{0.223335519f, 0.391957551f},
-std::array<float,2>{0.777429104f, 0.628358364f},
-std::array<float,2>{0.578184783f, 0.234040469f},
-std::array<float,2>{0.415687501f, 0.82045877f},
-std::array<float,2>{0.197202206f, 0.23942025f},
-std::array<float,2>{0.793644965f, 0.83722055f},
-std::array<float,2>{0.594760001f, 0.382828593f},
-std::array<float,2>{0.383734494f, 0.649756074f},
-std::array<float,2>{0.310385317f, 0.372237474f},
-std::array<float,2>{0.720025182f, 0.545521259f},
-std::array<float,2>{0.913857281f, 0.083622016f},
-std::array<float,2>{0.118653066f, 0.999830902f},
-std::array<float,2>{0.499747604f, 0.0105142128f},
-std::array<float,2>{0.521885037f, 0.89747721f},
-std::array<float,2>{0.825214803f, 0.296686709f},
-std::array<float,2>{0.151913643f, 0.580393076f},
-std::array<float,2>{0.059170492f, 0.467162848f},
-std::array<float,2>{0.93948549f, 0.708760083f},
-std::array<float,2>{0.632034242f, 0.179077104f},
-std::array<float,2>{0.314896822f, 0.758826792f},
-std::array<float,2>{0.0896763876f, 0.121732965f},
-std::array<float,2>{0.90266186f, 0.966568649f},
-std::array<float,2>{0.717520952f, 0.321656734f},
-std::array<float,2>{0.268248111f, 0.509230912f},
-std::array<float,2>{0.435018539f, 0.419573843f},
-std::array<float,2>{0.574306607f, 0.663544893f},
-std::array<float,2>{0.751705348f, 0.218607068f},
-std::array<float,2>{0.24877426f, 0.846882463f},
-std::array<float,2>{0.358207881f, 0.133447155f},
-std::array<float,2>{0.675184488f, 0.797058463f},
-std::array<float,2>{0.983592808f, 0.486560792f},
-std::array<float,2>{0.0120301554f, 0.719258666f},
-std::array<float,2>{0.158883244f, 0.278316021f},
-std::array<float,2>{0.857582927f, 0.597259998f},
-std::array<float,2>{0.539499581f, 0.0568409935f},
-std::array<float,2>{0.455572426f, 0.913518369f},
-std::array<float,2>{0.163907439f, 0.0776583254f},
-std::array<float,2>{0.852343023f, 0.969986796f},
-std::array<float,2>{0.545900464f, 0.344147325f},
-std::array<float,2>{0.458654195f, 0.551880419f},
-std::array<float,2>{0.355318695f, 0.404352099f},
-std::array<float,2>{0.676858485f, 0.638771713f},
-std::array<float,2>{0.977426529f, 0.226300597f},
-std::array<float,2>{0.0110290963f, 0.816035986f},
-std::array<float,2>{0.43061015f, 0.163843378f},
-std::array<float,2>{0.573108792f, 0.771758199f},
-std::array<float,2>{0.757148325f, 0.452298433f},
-std::array<float,2>{0.245840073f, 0.687961459f},
-std::array<float,2>{0.0904929861f, 0.300837338f},
-std::array<float,2>{0.901521921f, 0.574245274f},
-std::array<float,2>{0.711634576f, 0.0301393773f},
-std::array<float,2>{0.269907415f, 0.875120997f},
-std::array<float,2>{0.0581360385f, 0.201097593f},
-std::array<float,2>{0.94256109f, 0.864921868f},
-std::array<float,2>{0.62501651f, 0.430209041f},
-std::array<float,2>{0.318347812f, 0.681563139f},
-std::array<float,2>{0.493783414f, 0.331640393f},
-std::array<float,2>{0.51851958f, 0.515639424f},
-std::array<float,2>{0.823190212f, 0.102126442f},
-std::array<float,2>{0.154694378f, 0.939165175f},
-std::array<float,2>{0.307360649f, 0.0465828218f},
-std::array<float,2>{0.725467563f, 0.936100543f},
-std::array<float,2>{0.908337533f, 0.263441354f},
-std::array<float,2>{0.123194382f, 0.618276179f},
-std::array<float,2>{0.202933386f, 0.47860533f},
-std::array<float,2>{0.790149271f, 0.74483192f},
-std::array<float,2>{0.598615944f, 0.141276896f},
-std::array<float,2>{0.387677073f, 0.790492952f},
-std::array<float,2>{0.221370175f, 0.12542063f},
-std::array<float,2>{0.774452686f, 0.810316324f},
-std::array<float,2>{0.583767116f, 0.493158221f},
-std::array<float,2>{0.420824111f, 0.728170514f},
-std::array<float,2>{0.264639229f, 0.272438705f},
-std::array<float,2>{0.698034108f, 0.60213685f},
-std::array<float,2>{0.878918469f, 0.0541355982f},
-std::array<float,2>{0.0696694925f, 0.918989658f},
-std::array<float,2>{0.442991376f, 0.113147289f},
-std::array<float,2>{0.553920686f, 0.957325101f},
-std::array<float,2>{0.867653251f, 0.312660038f},
-std::array<float,2>{0.178945437f, 0.502901912f},
-std::array<float,2>{0.0277339593f, 0.408552259f},
-std::array<float,2>{0.998001516f, 0.671527505f},
-std::array<float,2>{0.669190884f, 0.203919873f},
-std::array<float,2>{0.373558164f, 0.854769826f},
-std::array<float,2>{0.108358406f, 0.00424919743f},
-std::array<float,2>{0.927670658f, 0.899938583f},
-std::array<float,2>{0.739288747f, 0.283068746f},
-std::array<float,2>{0.289832532f, 0.591533661f},
-std::array<float,2>{0.402944714f, 0.460272878f},
-std::array<float,2>{0.610047638f, 0.714197099f},
-std::array<float,2>{0.80432725f, 0.183637157f},
-std::array<float,2>{0.208003551f, 0.751194894f},
-std::array<float,2>{0.328527331f, 0.24354212f},
-std::array<float,2>{0.647848547f, 0.828514397f},
-std::array<float,2>{0.966260374f, 0.375192821f},
-std::array<float,2>{0.0444713645f, 0.642428398f},
-std::array<float,2>{0.134319112f, 0.364243746f},
-std::array<float,2>{0.833387852f, 0.538503587f},
-std::array<float,2>{0.507242024f, 0.0905203745f},
-std::array<float,2>{0.469335556f, 0.991539419f},
-std::array<float,2>{0.217892155f, 0.0601681359f},
-std::array<float,2>{0.810972869f, 0.907026589f},
-std::array<float,2>{0.621991038f, 0.275907159f},
-std::array<float,2>{0.396110982f, 0.600410819f},
-std::array<float,2>{0.287446171f, 0.491768241f},
-std::array<float,2>{0.748498321f, 0.725471854f},
-std::array<float,2>{0.930262804f, 0.13790974f},
-std::array<float,2>{0.0945313647f, 0.804064274f},
-std::array<float,2>{0.477193475f, 0.211464003f},
-std::array<float,2>{0.50883764f, 0.848074317f},
-std::array<float,2>{0.836703897f, 0.416981131f},
-std::array<float,2>{0.13016367f, 0.658299804f},
-std::array<float,2>{0.0323491693f, 0.326183051f},
-std::array<float,2>{0.954336286f, 0.514326334f},
-std::array<float,2>{0.651414931f, 0.117991567f},
-std::array<float,2>{0.343132198f, 0.962809563f},
-std::array<float,2>{0.0780380368f, 0.175227866f},
-std::array<float,2>{0.884613514f, 0.762289822f},
-std::array<float,2>{0.693761289f, 0.463195026f},
-std::array<float,2>{0.256992549f, 0.704326093f},
-std::array<float,2>{0.412879527f, 0.289765716f},
-std::array<float,2>{0.586144209f, 0.585827589f},
-std::array<float,2>{0.767913103f, 0.0125281485f},
-std::array<float,2>{0.232942507f, 0.892352462f},
-std::array<float,2>{0.363147289f, 0.081028454f},
-std::array<float,2>{0.658442259f, 0.995192826f},
-std::array<float,2>{0.990530074f, 0.367316514f},
-std::array<float,2>{0.0207130462f, 0.540955961f},
-std::array<float,2>{0.187280744f, 0.387345403f},
-std::array<float,2>{0.862042129f, 0.655607402f},
-std::array<float,2>{0.555014193f, 0.238177881f},
-std::array<float,2>{0.450460643f, 0.842058361f},
-std::array<float,2>{0.144687057f, 0.230163351f},
-std::array<float,2>{0.815195382f, 0.825394511f},
-std::array<float,2>{0.528379977f, 0.394620001f},
-std::array<float,2>{0.491267532f, 0.629195929f},
-std::array<float,2>{0.327345967f, 0.355803758f},
-std::array<float,2>{0.633904934f, 0.559872329f},
-std::array<float,2>{0.949280918f, 0.065276362f},
-std::array<float,2>{0.0498720333f, 0.983602762f},
-std::array<float,2>{0.377970427f, 0.0227793101f},
-std::array<float,2>{0.605875075f, 0.887564957f},
-std::array<float,2>{0.788442612f, 0.308997989f},
-std::array<float,2>{0.190821692f, 0.563416541f},
-std::array<float,2>{0.110748746f, 0.44170922f},
-std::array<float,2>{0.917007387f, 0.696540534f},
-std::array<float,2>{0.730453491f, 0.164567843f},
-std::array<float,2>{0.298498541f, 0.77492547f},
-std::array<float,2>{0.00432202592f, 0.101435564f},
-std::array<float,2>{0.973960817f, 0.951853156f},
-std::array<float,2>{0.682913899f, 0.339395225f},
-std::array<float,2>{0.348767012f, 0.524944901f},
-std::array<float,2>{0.468346953f, 0.421907634f},
-std::array<float,2>{0.537618756f, 0.67793715f},
-std::array<float,2>{0.845685899f, 0.193438649f},
-std::array<float,2>{0.166881725f, 0.870335639f},
-std::array<float,2>{0.273930043f, 0.152112484f},
-std::array<float,2>{0.709562063f, 0.78237623f},
-std::array<float,2>{0.892472804f, 0.473479569f},
-std::array<float,2>{0.0853806138f, 0.734412551f},
-std::array<float,2>{0.239422128f, 0.254786193f},
-std::array<float,2>{0.762927771f, 0.615043879f},
-std::array<float,2>{0.569975138f, 0.0323322341f},
-std::array<float,2>{0.426556766f, 0.925308049f},
-std::array<float,2>{0.248224348f, 0.123075426f},
-std::array<float,2>{0.751460552f, 0.966964602f},
-std::array<float,2>{0.574736953f, 0.323346794f},
-std::array<float,2>{0.435511708f, 0.511662304f},
-std::array<float,2>{0.268050939f, 0.421683192f},
-std::array<float,2>{0.717153907f, 0.660792053f},
-std::array<float,2>{0.903113544f, 0.216713458f},
-std::array<float,2>{0.0893100724f, 0.845173895f},
-std::array<float,2>{0.455277503f, 0.135408834f},
-std::array<float,2>{0.539806902f, 0.799325049f},
-std::array<float,2>{0.858083904f, 0.484936327f},
-std::array<float,2>{0.158237293f, 0.721791208f},
-std::array<float,2>{0.0123267872f, 0.280843139f},
-std::array<float,2>{0.984006524f, 0.594342172f},
-std::array<float,2>{0.675467908f, 0.055282969f},
-std::array<float,2>{0.35790959f, 0.910372794f},
-std::array<float,2>{0.118419044f, 0.241904318f},
-std::array<float,2>{0.91316092f, 0.838667333f},
-std::array<float,2>{0.720236003f, 0.386073828f},
-std::array<float,2>{0.3098104f, 0.651784003f},
-std::array<float,2>{0.382861644f, 0.373142749f},
-std::array<float,2>{0.595406413f, 0.543195486f},
-std::array<float,2>{0.793228269f, 0.0842095017f},
-std::array<float,2>{0.196458295f, 0.997619212f},
-std::array<float,2>{0.315271974f, 0.00895581953f},
-std::array<float,2>{0.632509112f, 0.894665241f},
-std::array<float,2>{0.940151989f, 0.294279486f},
-std::array<float,2>{0.0590435341f, 0.578346848f},
-std::array<float,2>{0.151756883f, 0.464891344f},
-std::array<float,2>{0.82586956f, 0.710482836f},
-std::array<float,2>{0.522153676f, 0.1775143f},
-std::array<float,2>{0.499502957f, 0.76035893f},
-std::array<float,2>{0.17552045f, 0.168967143f},
-std::array<float,2>{0.871658087f, 0.778749406f},
-std::array<float,2>{0.550201714f, 0.439062029f},
-std::array<float,2>{0.441398472f, 0.699589789f},
-std::array<float,2>{0.368694752f, 0.305842996f},
-std::array<float,2>{0.666047037f, 0.569795251f},
-std::array<float,2>{0.994024813f, 0.0157135688f},
-std::array<float,2>{0.0242594946f, 0.883982539f},
-std::array<float,2>{0.415427327f, 0.0693653077f},
-std::array<float,2>{0.5786255f, 0.978180289f},
-std::array<float,2>{0.778314471f, 0.352528393f},
-std::array<float,2>{0.223032475f, 0.556072176f},
-std::array<float,2>{0.0648022369f, 0.392802238f},
-std::array<float,2>{0.875774324f, 0.625825107f},
-std::array<float,2>{0.701963186f, 0.232297853f},
-std::array<float,2>{0.258907616f, 0.822520673f},
-std::array<float,2>{0.0416695811f, 0.0370564647f},
-std::array<float,2>{0.963878691f, 0.925965071f},
-std::array<float,2>{0.644100904f, 0.251391888f},
-std::array<float,2>{0.334867984f, 0.609866083f},
-std::array<float,2>{0.47579363f, 0.468949616f},
-std::array<float,2>{0.501416326f, 0.740827084f},
-std::array<float,2>{0.83006376f, 0.154533193f},
-std::array<float,2>{0.13851884f, 0.788123071f},
-std::array<float,2>{0.295557201f, 0.190612942f},
-std::array<float,2>{0.734634101f, 0.87464571f},
-std::array<float,2>{0.922060847f, 0.427113891f},
-std::array<float,2>{0.102450863f, 0.675777137f},
-std::array<float,2>{0.203141198f, 0.341896147f},
-std::array<float,2>{0.796932161f, 0.527534306f},
-std::array<float,2>{0.614233971f, 0.0942364857f},
-std::array<float,2>{0.401181966f, 0.948232174f},
-std::array<float,2>{0.125343412f, 0.0251216702f},
-std::array<float,2>{0.842205584f, 0.882555842f},
-std::array<float,2>{0.513953149f, 0.298675388f},
-std::array<float,2>{0.483151525f, 0.570881307f},
-std::array<float,2>{0.33612594f, 0.448697299f},
-std::array<float,2>{0.65580982f, 0.692549527f},
-std::array<float,2>{0.957663357f, 0.159155712f},
-std::array<float,2>{0.035730157f, 0.767897904f},
-std::array<float,2>{0.393948942f, 0.2194511f},
-std::array<float,2>{0.619238138f, 0.816752255f},
-std::array<float,2>{0.808456898f, 0.401558667f},
-std::array<float,2>{0.210966632f, 0.636273205f},
-std::array<float,2>{0.0997638926f, 0.350736767f},
-std::array<float,2>{0.934234321f, 0.548042595f},
-std::array<float,2>{0.743781269f, 0.0735504255f},
-std::array<float,2>{0.283995777f, 0.973388374f},
-std::array<float,2>{0.0174315944f, 0.14675054f},
-std::array<float,2>{0.9844051f, 0.795977235f},
-std::array<float,2>{0.663157105f, 0.481935441f},
-std::array<float,2>{0.364046514f, 0.74684459f},
-std::array<float,2>{0.446475655f, 0.258813858f},
-std::array<float,2>{0.561576962f, 0.623627186f},
-std::array<float,2>{0.865904689f, 0.0425351225f},
-std::array<float,2>{0.181799576f, 0.931150377f},
-std::array<float,2>{0.251426369f, 0.105789341f},
-std::array<float,2>{0.687780797f, 0.942696095f},
-std::array<float,2>{0.890537143f, 0.335474908f},
-std::array<float,2>{0.071032986f, 0.521888137f},
-std::array<float,2>{0.228519216f, 0.435939789f},
-std::array<float,2>{0.770660043f, 0.686566412f},
-std::array<float,2>{0.59192121f, 0.197216079f},
-std::array<float,2>{0.406380177f, 0.863228261f},
-std::array<float,2>{0.193292394f, 0.20942311f},
-std::array<float,2>{0.782000244f, 0.858238161f},
-std::array<float,2>{0.605081856f, 0.410330981f},
-std::array<float,2>{0.38109988f, 0.667549312f},
-std::array<float,2>{0.303243577f, 0.318462193f},
-std::array<float,2>{0.733353257f, 0.504729569f},
-std::array<float,2>{0.920014381f, 0.116817832f},
-std::array<float,2>{0.116597958f, 0.954240382f},
-std::array<float,2>{0.484851032f, 0.048382096f},
-std::array<float,2>{0.527110696f, 0.915471494f},
-std::array<float,2>{0.819910228f, 0.266682357f},
-std::array<float,2>{0.140807658f, 0.608117104f},
-std::array<float,2>{0.052771084f, 0.497364908f},
-std::array<float,2>{0.947864413f, 0.733374894f},
-std::array<float,2>{0.63794893f, 0.129895791f},
-std::array<float,2>{0.322733343f, 0.808201671f},
-std::array<float,2>{0.0799655542f, 0.0859725773f},
-std::array<float,2>{0.896034122f, 0.987957656f},
-std::array<float,2>{0.70619005f, 0.361612648f},
-std::array<float,2>{0.279775828f, 0.531843841f},
-std::array<float,2>{0.421957403f, 0.381317824f},
-std::array<float,2>{0.565228701f, 0.645000219f},
-std::array<float,2>{0.759965599f, 0.248978689f},
-std::array<float,2>{0.238028005f, 0.832091272f},
-std::array<float,2>{0.345360368f, 0.182390928f},
-std::array<float,2>{0.686702788f, 0.757600367f},
-std::array<float,2>{0.969902337f, 0.45326519f},
-std::array<float,2>{0.00336390524f, 0.717630446f},
-std::array<float,2>{0.171168506f, 0.288004369f},
-std::array<float,2>{0.84842366f, 0.586508095f},
-std::array<float,2>{0.533130527f, 0.00349609577f},
-std::array<float,2>{0.463556737f, 0.90535152f},
-std::array<float,2>{0.152548432f, 0.104451545f},
-std::array<float,2>{0.821880341f, 0.940516412f},
-std::array<float,2>{0.517375648f, 0.329304576f},
-std::array<float,2>{0.494431913f, 0.519051433f},
-std::array<float,2>{0.319647372f, 0.433117718f},
-std::array<float,2>{0.628012419f, 0.683452487f},
-std::array<float,2>{0.944609702f, 0.202873304f},
-std::array<float,2>{0.0554368645f, 0.865583956f},
-std::array<float,2>{0.389572024f, 0.142685458f},
-std::array<float,2>{0.59982729f, 0.792833805f},
-std::array<float,2>{0.792262673f, 0.47725001f},
-std::array<float,2>{0.201129049f, 0.742987335f},
-std::array<float,2>{0.122577205f, 0.26504454f},
-std::array<float,2>{0.906795382f, 0.619632483f},
-std::array<float,2>{0.724189341f, 0.0443503372f},
-std::array<float,2>{0.305416226f, 0.934226513f},
-std::array<float,2>{0.00963704754f, 0.224426508f},
-std::array<float,2>{0.980105698f, 0.81419915f},
-std::array<float,2>{0.678924859f, 0.403005064f},
-std::array<float,2>{0.352782845f, 0.637030423f},
-std::array<float,2>{0.459475756f, 0.346641093f},
-std::array<float,2>{0.543382645f, 0.554570317f},
-std::array<float,2>{0.854790449f, 0.075754717f},
-std::array<float,2>{0.161355853f, 0.971392572f},
-std::array<float,2>{0.27329126f, 0.0288795829f},
-std::array<float,2>{0.714700401f, 0.878474832f},
-std::array<float,2>{0.899024308f, 0.303061754f},
-std::array<float,2>{0.093191117f, 0.577572405f},
-std::array<float,2>{0.242737636f, 0.450478286f},
-std::array<float,2>{0.755817235f, 0.689516842f},
-std::array<float,2>{0.571387291f, 0.160913557f},
-std::array<float,2>{0.432451934f, 0.770660281f},
-std::array<float,2>{0.209050491f, 0.185878053f},
-std::array<float,2>{0.800797224f, 0.752206802f},
-std::array<float,2>{0.611535668f, 0.458170503f},
-std::array<float,2>{0.405791402f, 0.711475313f},
-std::array<float,2>{0.292619735f, 0.285109937f},
-std::array<float,2>{0.740260661f, 0.592958272f},
-std::array<float,2>{0.928529501f, 0.00765491696f},
-std::array<float,2>{0.106197976f, 0.902141094f},
-std::array<float,2>{0.471738756f, 0.0929927155f},
-std::array<float,2>{0.505282402f, 0.988983274f},
-std::array<float,2>{0.834695578f, 0.365744919f},
-std::array<float,2>{0.135676429f, 0.536080003f},
-std::array<float,2>{0.0458576195f, 0.377793968f},
-std::array<float,2>{0.967992306f, 0.64345181f},
-std::array<float,2>{0.645076811f, 0.244252771f},
-std::array<float,2>{0.331531346f, 0.830199361f},
-std::array<float,2>{0.0667289868f, 0.0508285314f},
-std::array<float,2>{0.881302238f, 0.920008421f},
-std::array<float,2>{0.69590342f, 0.270031244f},
-std::array<float,2>{0.261746913f, 0.605110168f},
-std::array<float,2>{0.418526202f, 0.495508403f},
-std::array<float,2>{0.585451603f, 0.729533136f},
-std::array<float,2>{0.777310371f, 0.127136365f},
-std::array<float,2>{0.218882993f, 0.812020838f},
-std::array<float,2>{0.371287316f, 0.206542343f},
-std::array<float,2>{0.67172879f, 0.853011906f},
-std::array<float,2>{0.999505699f, 0.406908214f},
-std::array<float,2>{0.0294339024f, 0.669178724f},
-std::array<float,2>{0.177700505f, 0.316047072f},
-std::array<float,2>{0.870185912f, 0.501635611f},
-std::array<float,2>{0.55209583f, 0.109957643f},
-std::array<float,2>{0.445049614f, 0.958988011f},
-std::array<float,2>{0.230627656f, 0.0137175228f},
-std::array<float,2>{0.767193377f, 0.89404285f},
-std::array<float,2>{0.589568615f, 0.291551471f},
-std::array<float,2>{0.410421133f, 0.582254529f},
-std::array<float,2>{0.254400969f, 0.462851048f},
-std::array<float,2>{0.692223191f, 0.70592469f},
-std::array<float,2>{0.884889424f, 0.172147766f},
-std::array<float,2>{0.0750658736f, 0.765225112f},
-std::array<float,2>{0.4513309f, 0.236084834f},
-std::array<float,2>{0.558401525f, 0.841439962f},
-std::array<float,2>{0.860331476f, 0.389945477f},
-std::array<float,2>{0.185415685f, 0.653909206f},
-std::array<float,2>{0.0226590578f, 0.369216263f},
-std::array<float,2>{0.988414347f, 0.541990578f},
-std::array<float,2>{0.65703398f, 0.0791410953f},
-std::array<float,2>{0.360487521f, 0.994044363f},
-std::array<float,2>{0.0969005451f, 0.138699189f},
-std::array<float,2>{0.932913661f, 0.80106616f},
-std::array<float,2>{0.746452928f, 0.489017576f},
-std::array<float,2>{0.286877662f, 0.724223316f},
-std::array<float,2>{0.396740079f, 0.273690194f},
-std::array<float,2>{0.623274326f, 0.598365307f},
-std::array<float,2>{0.809848964f, 0.0624000318f},
-std::array<float,2>{0.215622678f, 0.908656776f},
-std::array<float,2>{0.341720551f, 0.120963864f},
-std::array<float,2>{0.649840474f, 0.96368444f},
-std::array<float,2>{0.955165148f, 0.324963242f},
-std::array<float,2>{0.0337308794f, 0.51186049f},
-std::array<float,2>{0.131140709f, 0.414204776f},
-std::array<float,2>{0.838269055f, 0.657994032f},
-std::array<float,2>{0.509890854f, 0.213892564f},
-std::array<float,2>{0.479349822f, 0.851447999f},
-std::array<float,2>{0.165094957f, 0.192610234f},
-std::array<float,2>{0.845795631f, 0.867338657f},
-std::array<float,2>{0.535803616f, 0.424909562f},
-std::array<float,2>{0.465973735f, 0.677152395f},
-std::array<float,2>{0.350736439f, 0.33734569f},
-std::array<float,2>{0.680051506f, 0.52643615f},
-std::array<float,2>{0.975594699f, 0.0978693068f},
-std::array<float,2>{0.0060975831f, 0.949520469f},
-std::array<float,2>{0.428639621f, 0.0335877612f},
-std::array<float,2>{0.566498041f, 0.922573626f},
-std::array<float,2>{0.763977706f, 0.257007837f},
-std::array<float,2>{0.240873605f, 0.615622997f},
-std::array<float,2>{0.0827500969f, 0.475880772f},
-std::array<float,2>{0.893597782f, 0.738189459f},
-std::array<float,2>{0.708517373f, 0.149302974f},
-std::array<float,2>{0.276610464f, 0.784050167f},
-std::array<float,2>{0.047390759f, 0.0639430955f},
-std::array<float,2>{0.952723205f, 0.981761873f},
-std::array<float,2>{0.636258781f, 0.358657271f},
-std::array<float,2>{0.324706882f, 0.560954511f},
-std::array<float,2>{0.490224868f, 0.396665096f},
-std::array<float,2>{0.529799104f, 0.632305026f},
-std::array<float,2>{0.812642097f, 0.227594331f},
-std::array<float,2>{0.146797702f, 0.82646966f},
-std::array<float,2>{0.300099552f, 0.166769683f},
-std::array<float,2>{0.727846086f, 0.776237309f},
-std::array<float,2>{0.914822876f, 0.444767445f},
-std::array<float,2>{0.113045558f, 0.698749542f},
-std::array<float,2>{0.187933087f, 0.311467648f},
-std::array<float,2>{0.786852896f, 0.566087008f},
-std::array<float,2>{0.607456088f, 0.0200691801f},
-std::array<float,2>{0.376868904f, 0.889015377f},
-std::array<float,2>{0.198875517f, 0.0831478313f},
-std::array<float,2>{0.795471728f, 0.999502957f},
-std::array<float,2>{0.596325815f, 0.373028874f},
-std::array<float,2>{0.386300117f, 0.545306087f},
-std::array<float,2>{0.31217581f, 0.383674443f},
-std::array<float,2>{0.721752286f, 0.650036037f},
-std::array<float,2>{0.911345601f, 0.23980312f},
-std::array<float,2>{0.11992979f, 0.837803185f},
-std::array<float,2>{0.496623009f, 0.179586887f},
-std::array<float,2>{0.521169424f, 0.759448647f},
-std::array<float,2>{0.828122079f, 0.467370868f},
-std::array<float,2>{0.14967379f, 0.708120286f},
-std::array<float,2>{0.0622738004f, 0.296042174f},
-std::array<float,2>{0.939100385f, 0.580829203f},
-std::array<float,2>{0.630563736f, 0.0102090687f},
-std::array<float,2>{0.314427495f, 0.898005009f},
-std::array<float,2>{0.0878806114f, 0.217829615f},
-std::array<float,2>{0.90512681f, 0.847168028f},
-std::array<float,2>{0.715508342f, 0.419297755f},
-std::array<float,2>{0.267066568f, 0.663796067f},
-std::array<float,2>{0.435884774f, 0.321842849f},
-std::array<float,2>{0.576730907f, 0.509422243f},
-std::array<float,2>{0.752649307f, 0.121501938f},
-std::array<float,2>{0.247479275f, 0.966129184f},
-std::array<float,2>{0.355965972f, 0.0575572997f},
-std::array<float,2>{0.673743606f, 0.913656712f},
-std::array<float,2>{0.982081831f, 0.277700186f},
-std::array<float,2>{0.0148060257f, 0.596728921f},
-std::array<float,2>{0.157228455f, 0.487123728f},
-std::array<float,2>{0.856974363f, 0.719118655f},
-std::array<float,2>{0.542374849f, 0.133205473f},
-std::array<float,2>{0.454807818f, 0.797727525f},
-std::array<float,2>{0.138928905f, 0.153812245f},
-std::array<float,2>{0.831981897f, 0.787028432f},
-std::array<float,2>{0.502423763f, 0.470907986f},
-std::array<float,2>{0.473455548f, 0.73993206f},
-std::array<float,2>{0.332938403f, 0.252567977f},
-std::array<float,2>{0.641065061f, 0.612644851f},
-std::array<float,2>{0.961471677f, 0.0372483097f},
-std::array<float,2>{0.0396432504f, 0.92921412f},
-std::array<float,2>{0.398798615f, 0.0962925479f},
-std::array<float,2>{0.615296245f, 0.945510983f},
-std::array<float,2>{0.800666928f, 0.340338856f},
-std::array<float,2>{0.205528051f, 0.529536724f},
-std::array<float,2>{0.104768336f, 0.428717583f},
-std::array<float,2>{0.925061405f, 0.672341287f},
-std::array<float,2>{0.737446785f, 0.188388705f},
-std::array<float,2>{0.294008344f, 0.872084439f},
-std::array<float,2>{0.0267734118f, 0.0183697343f},
-std::array<float,2>{0.994293869f, 0.885587394f},
-std::array<float,2>{0.664241254f, 0.30799824f},
-std::array<float,2>{0.371056288f, 0.567321658f},
-std::array<float,2>{0.438525289f, 0.440042138f},
-std::array<float,2>{0.548789918f, 0.702341199f},
-std::array<float,2>{0.874418497f, 0.170870259f},
-std::array<float,2>{0.172506943f, 0.780040383f},
-std::array<float,2>{0.26058948f, 0.233490869f},
-std::array<float,2>{0.69975096f, 0.820828736f},
-std::array<float,2>{0.877667904f, 0.392232865f},
-std::array<float,2>{0.0637695864f, 0.628581583f},
-std::array<float,2>{0.226371378f, 0.353903621f},
-std::array<float,2>{0.780874789f, 0.558367372f},
-std::array<float,2>{0.580921948f, 0.0669000223f},
-std::array<float,2>{0.416143f, 0.978853524f},
-std::array<float,2>{0.181164905f, 0.0391399823f},
-std::array<float,2>{0.863589168f, 0.932271659f},
-std::array<float,2>{0.560352564f, 0.261530221f},
-std::array<float,2>{0.447610289f, 0.622354686f},
-std::array<float,2>{0.366489232f, 0.483366281f},
-std::array<float,2>{0.661820352f, 0.749411345f},
-std::array<float,2>{0.987587929f, 0.144672081f},
-std::array<float,2>{0.0177857857f, 0.794751823f},
-std::array<float,2>{0.409172088f, 0.198279604f},
-std::array<float,2>{0.589893639f, 0.859418631f},
-std::array<float,2>{0.771484852f, 0.435175598f},
-std::array<float,2>{0.228216797f, 0.68406713f},
-std::array<float,2>{0.0738351345f, 0.332709402f},
-std::array<float,2>{0.887354493f, 0.520112693f},
-std::array<float,2>{0.689675689f, 0.109179169f},
-std::array<float,2>{0.253003567f, 0.94483918f},
-std::array<float,2>{0.0385553017f, 0.15802075f},
-std::array<float,2>{0.959802508f, 0.766691029f},
-std::array<float,2>{0.652829945f, 0.445611149f},
-std::array<float,2>{0.337913394f, 0.695265174f},
-std::array<float,2>{0.482278436f, 0.300395399f},
-std::array<float,2>{0.511949122f, 0.57363683f},
-std::array<float,2>{0.840619326f, 0.027314635f},
-std::array<float,2>{0.127574027f, 0.880086303f},
-std::array<float,2>{0.282521784f, 0.0721388161f},
-std::array<float,2>{0.744857907f, 0.975720525f},
-std::array<float,2>{0.936639905f, 0.349341512f},
-std::array<float,2>{0.0992393866f, 0.549664259f},
-std::array<float,2>{0.213934079f, 0.399913669f},
-std::array<float,2>{0.80610764f, 0.632912397f},
-std::array<float,2>{0.617933989f, 0.221204534f},
-std::array<float,2>{0.391639352f, 0.819861472f},
-std::array<float,2>{0.236071318f, 0.24766545f},
-std::array<float,2>{0.757992148f, 0.834852397f},
-std::array<float,2>{0.56425333f, 0.380051255f},
-std::array<float,2>{0.424956858f, 0.646509409f},
-std::array<float,2>{0.279145598f, 0.359401584f},
-std::array<float,2>{0.703550398f, 0.534621656f},
-std::array<float,2>{0.896878898f, 0.089250721f},
-std::array<float,2>{0.0816963688f, 0.985778809f},
-std::array<float,2>{0.4611848f, 0.000292898476f},
-std::array<float,2>{0.53477335f, 0.90237695f},
-std::array<float,2>{0.851511717f, 0.285698742f},
-std::array<float,2>{0.168267429f, 0.587994337f},
-std::array<float,2>{0.000811381207f, 0.455161989f},
-std::array<float,2>{0.971573532f, 0.715965331f},
-std::array<float,2>{0.685011148f, 0.180820748f},
-std::array<float,2>{0.34750393f, 0.755359948f},
-std::array<float,2>{0.11515227f, 0.113577791f},
-std::array<float,2>{0.9193753f, 0.956145883f},
-std::array<float,2>{0.730744064f, 0.317332983f},
-std::array<float,2>{0.301100314f, 0.506472111f},
-std::array<float,2>{0.37941581f, 0.412753522f},
-std::array<float,2>{0.60332489f, 0.665397525f},
-std::array<float,2>{0.784766912f, 0.207931563f},
-std::array<float,2>{0.195250735f, 0.855601132f},
-std::array<float,2>{0.322145253f, 0.13088955f},
-std::array<float,2>{0.639300704f, 0.806396663f},
-std::array<float,2>{0.945895076f, 0.498372167f},
-std::array<float,2>{0.052548945f, 0.731092453f},
-std::array<float,2>{0.143456921f, 0.269328713f},
-std::array<float,2>{0.816928625f, 0.605583131f},
-std::array<float,2>{0.524415255f, 0.0497637801f},
-std::array<float,2>{0.486770123f, 0.916950941f},
-std::array<float,2>{0.136556566f, 0.0916723013f},
-std::array<float,2>{0.835854769f, 0.990806997f},
-std::array<float,2>{0.50429666f, 0.364261329f},
-std::array<float,2>{0.471340537f, 0.537326455f},
-std::array<float,2>{0.330962598f, 0.376286834f},
-std::array<float,2>{0.645756125f, 0.641116917f},
-std::array<float,2>{0.967647374f, 0.242553875f},
-std::array<float,2>{0.0462826416f, 0.829942286f},
-std::array<float,2>{0.40488705f, 0.185052708f},
-std::array<float,2>{0.612694681f, 0.750740409f},
-std::array<float,2>{0.802381396f, 0.459398508f},
-std::array<float,2>{0.210228547f, 0.713038206f},
-std::array<float,2>{0.107175514f, 0.281966895f},
-std::array<float,2>{0.92936331f, 0.590399146f},
-std::array<float,2>{0.741458654f, 0.00523767341f},
-std::array<float,2>{0.291713327f, 0.898459077f},
-std::array<float,2>{0.0306653269f, 0.204919145f},
-std::array<float,2>{0.998451471f, 0.853775263f},
-std::array<float,2>{0.670637429f, 0.409247011f},
-std::array<float,2>{0.372783333f, 0.670575321f},
-std::array<float,2>{0.443853527f, 0.313633531f},
-std::array<float,2>{0.551079333f, 0.503901362f},
-std::array<float,2>{0.869422078f, 0.112227902f},
-std::array<float,2>{0.175981402f, 0.958411753f},
-std::array<float,2>{0.26344192f, 0.0529431663f},
-std::array<float,2>{0.696916759f, 0.918807685f},
-std::array<float,2>{0.88211453f, 0.273179799f},
-std::array<float,2>{0.067818962f, 0.602853119f},
-std::array<float,2>{0.220679775f, 0.49320662f},
-std::array<float,2>{0.776346564f, 0.727386594f},
-std::array<float,2>{0.584734082f, 0.12643598f},
-std::array<float,2>{0.419024795f, 0.80945158f},
-std::array<float,2>{0.199617267f, 0.141885564f},
-std::array<float,2>{0.791717172f, 0.789762855f},
-std::array<float,2>{0.601168513f, 0.480214059f},
-std::array<float,2>{0.390166312f, 0.745646119f},
-std::array<float,2>{0.305841863f, 0.262201726f},
-std::array<float,2>{0.723585367f, 0.617595732f},
-std::array<float,2>{0.907368958f, 0.0449373014f},
-std::array<float,2>{0.121933915f, 0.936673224f},
-std::array<float,2>{0.495338589f, 0.102801047f},
-std::array<float,2>{0.516519248f, 0.938165128f},
-std::array<float,2>{0.82111752f, 0.330757797f},
-std::array<float,2>{0.153631955f, 0.516871691f},
-std::array<float,2>{0.0560595281f, 0.430791855f},
-std::array<float,2>{0.943456113f, 0.680479586f},
-std::array<float,2>{0.627261221f, 0.199844405f},
-std::array<float,2>{0.318796098f, 0.864251971f},
-std::array<float,2>{0.0924759209f, 0.0304025393f},
-std::array<float,2>{0.899493158f, 0.87658602f},
-std::array<float,2>{0.713645399f, 0.302518368f},
-std::array<float,2>{0.272373587f, 0.575230598f},
-std::array<float,2>{0.432846874f, 0.452058554f},
-std::array<float,2>{0.571151555f, 0.689375997f},
-std::array<float,2>{0.754332125f, 0.163037136f},
-std::array<float,2>{0.243721455f, 0.773394763f},
-std::array<float,2>{0.351911873f, 0.224661157f},
-std::array<float,2>{0.678037703f, 0.815170228f},
-std::array<float,2>{0.979000986f, 0.406174004f},
-std::array<float,2>{0.00853962172f, 0.640282214f},
-std::array<float,2>{0.160676286f, 0.344885826f},
-std::array<float,2>{0.85428381f, 0.551014125f},
-std::array<float,2>{0.544313133f, 0.0770991147f},
-std::array<float,2>{0.460209042f, 0.968921363f},
-std::array<float,2>{0.24191606f, 0.0317934491f},
-std::array<float,2>{0.765239537f, 0.924198449f},
-std::array<float,2>{0.567930162f, 0.255266607f},
-std::array<float,2>{0.429320484f, 0.61417985f},
-std::array<float,2>{0.275550902f, 0.474229246f},
-std::array<float,2>{0.707366347f, 0.735910952f},
-std::array<float,2>{0.892803252f, 0.150731474f},
-std::array<float,2>{0.0833123028f, 0.78199476f},
-std::array<float,2>{0.465661764f, 0.195286155f},
-std::array<float,2>{0.536874413f, 0.869661212f},
-std::array<float,2>{0.847218812f, 0.423030674f},
-std::array<float,2>{0.164966062f, 0.679172575f},
-std::array<float,2>{0.00724210124f, 0.338759661f},
-std::array<float,2>{0.975423217f, 0.523673236f},
-std::array<float,2>{0.681390464f, 0.100171052f},
-std::array<float,2>{0.349621445f, 0.952886164f},
-std::array<float,2>{0.111368395f, 0.165766284f},
-std::array<float,2>{0.915534914f, 0.773900151f},
-std::array<float,2>{0.727224529f, 0.443282813f},
-std::array<float,2>{0.299476266f, 0.69584012f},
-std::array<float,2>{0.375806779f, 0.309984058f},
-std::array<float,2>{0.608919024f, 0.563802898f},
-std::array<float,2>{0.785614789f, 0.0216843151f},
-std::array<float,2>{0.188821793f, 0.887717724f},
-std::array<float,2>{0.325327575f, 0.0656511784f},
-std::array<float,2>{0.635402143f, 0.982798219f},
-std::array<float,2>{0.951608598f, 0.357096285f},
-std::array<float,2>{0.0481218472f, 0.558962166f},
-std::array<float,2>{0.148166627f, 0.396111608f},
-std::array<float,2>{0.814136505f, 0.630080044f},
-std::array<float,2>{0.531216741f, 0.229236558f},
-std::array<float,2>{0.488381594f, 0.825181484f},
-std::array<float,2>{0.184565812f, 0.236850113f},
-std::array<float,2>{0.861230016f, 0.842943728f},
-std::array<float,2>{0.556729734f, 0.388079584f},
-std::array<float,2>{0.452952862f, 0.654423594f},
-std::array<float,2>{0.360283524f, 0.368169934f},
-std::array<float,2>{0.657530546f, 0.539985359f},
-std::array<float,2>{0.990111589f, 0.0817421153f},
-std::array<float,2>{0.0222947299f, 0.994940162f},
-std::array<float,2>{0.411137849f, 0.0131709045f},
-std::array<float,2>{0.588730156f, 0.890765011f},
-std::array<float,2>{0.766203523f, 0.290738165f},
-std::array<float,2>{0.232145622f, 0.584708869f},
-std::array<float,2>{0.0760075822f, 0.463905215f},
-std::array<float,2>{0.885841429f, 0.703232825f},
-std::array<float,2>{0.693300903f, 0.17404066f},
-std::array<float,2>{0.255114704f, 0.763091207f},
-std::array<float,2>{0.0348909609f, 0.118581273f},
-std::array<float,2>{0.95674938f, 0.961785257f},
-std::array<float,2>{0.648665547f, 0.327560753f},
-std::array<float,2>{0.340015739f, 0.515388012f},
-std::array<float,2>{0.479935706f, 0.417584151f},
-std::array<float,2>{0.511035323f, 0.659264028f},
-std::array<float,2>{0.83892411f, 0.212628886f},
-std::array<float,2>{0.132244334f, 0.849185884f},
-std::array<float,2>{0.285291851f, 0.137617454f},
-std::array<float,2>{0.7477597f, 0.803341031f},
-std::array<float,2>{0.932605684f, 0.491124779f},
-std::array<float,2>{0.0965550765f, 0.725626469f},
-std::array<float,2>{0.216151819f, 0.276628673f},
-std::array<float,2>{0.808864832f, 0.601507366f},
-std::array<float,2>{0.6243909f, 0.0593776517f},
-std::array<float,2>{0.398072958f, 0.907608628f},
-std::array<float,2>{0.206877887f, 0.0956455767f},
-std::array<float,2>{0.798920631f, 0.949123323f},
-std::array<float,2>{0.616782308f, 0.342969537f},
-std::array<float,2>{0.39999193f, 0.52850157f},
-std::array<float,2>{0.293445975f, 0.426388234f},
-std::array<float,2>{0.737280667f, 0.674225748f},
-std::array<float,2>{0.923984408f, 0.190408573f},
-std::array<float,2>{0.103665486f, 0.873508811f},
-std::array<float,2>{0.474225968f, 0.155322403f},
-std::array<float,2>{0.503001034f, 0.787430942f},
-std::array<float,2>{0.830224454f, 0.470492065f},
-std::array<float,2>{0.140326887f, 0.741764784f},
-std::array<float,2>{0.0402964316f, 0.250611573f},
-std::array<float,2>{0.962217093f, 0.610786617f},
-std::array<float,2>{0.64178437f, 0.0352051295f},
-std::array<float,2>{0.333611846f, 0.927058816f},
-std::array<float,2>{0.0634731874f, 0.231180072f},
-std::array<float,2>{0.87793529f, 0.82421267f},
-std::array<float,2>{0.700238764f, 0.393881202f},
-std::array<float,2>{0.261403948f, 0.6262995f},
-std::array<float,2>{0.417347223f, 0.353484631f},
-std::array<float,2>{0.581171632f, 0.555530667f},
-std::array<float,2>{0.780051827f, 0.0686808228f},
-std::array<float,2>{0.225304484f, 0.97732842f},
-std::array<float,2>{0.369682312f, 0.0172912199f},
-std::array<float,2>{0.665706813f, 0.8829211f},
-std::array<float,2>{0.995692134f, 0.305542141f},
-std::array<float,2>{0.0261244886f, 0.568718672f},
-std::array<float,2>{0.173545301f, 0.43815738f},
-std::array<float,2>{0.873854816f, 0.700888276f},
-std::array<float,2>{0.547450721f, 0.168025509f},
-std::array<float,2>{0.437748343f, 0.777495623f},
-std::array<float,2>{0.14928174f, 0.176426411f},
-std::array<float,2>{0.826451182f, 0.760905147f},
-std::array<float,2>{0.520040393f, 0.466063529f},
-std::array<float,2>{0.497404575f, 0.709358156f},
-std::array<float,2>{0.312850654f, 0.293905556f},
-std::array<float,2>{0.629303157f, 0.579404414f},
-std::array<float,2>{0.938142598f, 0.00837986544f},
-std::array<float,2>{0.0610014684f, 0.896102011f},
-std::array<float,2>{0.385332048f, 0.0857139453f},
-std::array<float,2>{0.597213924f, 0.9969818f},
-std::array<float,2>{0.796107471f, 0.374294072f},
-std::array<float,2>{0.198227003f, 0.544757247f},
-std::array<float,2>{0.121068962f, 0.385221452f},
-std::array<float,2>{0.910705745f, 0.650775135f},
-std::array<float,2>{0.721554935f, 0.240402967f},
-std::array<float,2>{0.310773283f, 0.8395558f},
-std::array<float,2>{0.0137331747f, 0.0557710528f},
-std::array<float,2>{0.981256723f, 0.911303997f},
-std::array<float,2>{0.6727615f, 0.280117333f},
-std::array<float,2>{0.356716484f, 0.595220983f},
-std::array<float,2>{0.453507096f, 0.485553533f},
-std::array<float,2>{0.541867793f, 0.720710695f},
-std::array<float,2>{0.856398463f, 0.136549264f},
-std::array<float,2>{0.157118276f, 0.800421059f},
-std::array<float,2>{0.265659124f, 0.214903012f},
-std::array<float,2>{0.715945005f, 0.843917429f},
-std::array<float,2>{0.905749321f, 0.420811623f},
-std::array<float,2>{0.0859630555f, 0.661463797f},
-std::array<float,2>{0.246526673f, 0.322979987f},
-std::array<float,2>{0.75364989f, 0.509773016f},
-std::array<float,2>{0.577228963f, 0.124783091f},
-std::array<float,2>{0.436640084f, 0.968384326f},
-std::array<float,2>{0.169287622f, 0.00241584843f},
-std::array<float,2>{0.850063324f, 0.90437448f},
-std::array<float,2>{0.533736646f, 0.288734585f},
-std::array<float,2>{0.462100208f, 0.587700903f},
-std::array<float,2>{0.345913678f, 0.454900742f},
-std::array<float,2>{0.684413731f, 0.718543351f},
-std::array<float,2>{0.9722175f, 0.183593646f},
-std::array<float,2>{0.00130141631f, 0.755868018f},
-std::array<float,2>{0.4240264f, 0.249403104f},
-std::array<float,2>{0.562742591f, 0.833661437f},
-std::array<float,2>{0.75948745f, 0.381994963f},
-std::array<float,2>{0.235238388f, 0.645985246f},
-std::array<float,2>{0.0808535069f, 0.36291644f},
-std::array<float,2>{0.897820115f, 0.532878458f},
-std::array<float,2>{0.704742014f, 0.087657012f},
-std::array<float,2>{0.277677834f, 0.986821413f},
-std::array<float,2>{0.0514398701f, 0.128940657f},
-std::array<float,2>{0.946631193f, 0.807563424f},
-std::array<float,2>{0.640511632f, 0.49674055f},
-std::array<float,2>{0.320595354f, 0.734238803f},
-std::array<float,2>{0.487632811f, 0.266334385f},
-std::array<float,2>{0.524357319f, 0.609136522f},
-std::array<float,2>{0.817617893f, 0.0471195392f},
-std::array<float,2>{0.14400439f, 0.914329886f},
-std::array<float,2>{0.302700937f, 0.115537211f},
-std::array<float,2>{0.731746733f, 0.953492284f},
-std::array<float,2>{0.918425441f, 0.319804341f},
-std::array<float,2>{0.114154913f, 0.505049467f},
-std::array<float,2>{0.19376567f, 0.411167502f},
-std::array<float,2>{0.78353554f, 0.666894197f},
-std::array<float,2>{0.602361798f, 0.21033594f},
-std::array<float,2>{0.379989475f, 0.85878998f},
-std::array<float,2>{0.226949528f, 0.195595875f},
-std::array<float,2>{0.773022652f, 0.861779571f},
-std::array<float,2>{0.591448963f, 0.436837107f},
-std::array<float,2>{0.409442306f, 0.686239004f},
-std::array<float,2>{0.25274241f, 0.33491087f},
-std::array<float,2>{0.690861642f, 0.522920489f},
-std::array<float,2>{0.888167799f, 0.106686868f},
-std::array<float,2>{0.0729605332f, 0.941654801f},
-std::array<float,2>{0.448276103f, 0.0414639339f},
-std::array<float,2>{0.559564352f, 0.930144727f},
-std::array<float,2>{0.864694178f, 0.258430898f},
-std::array<float,2>{0.180100963f, 0.624791443f},
-std::array<float,2>{0.0190350711f, 0.48080799f},
-std::array<float,2>{0.987265646f, 0.747412443f},
-std::array<float,2>{0.661131144f, 0.147481993f},
-std::array<float,2>{0.365486532f, 0.795804799f},
-std::array<float,2>{0.0982279181f, 0.0727075711f},
-std::array<float,2>{0.93578577f, 0.974519491f},
-std::array<float,2>{0.745249093f, 0.349942178f},
-std::array<float,2>{0.281269729f, 0.547104478f},
-std::array<float,2>{0.390795946f, 0.40071255f},
-std::array<float,2>{0.618176758f, 0.63572228f},
-std::array<float,2>{0.805346489f, 0.22060442f},
-std::array<float,2>{0.21320568f, 0.81829524f},
-std::array<float,2>{0.33902356f, 0.159829438f},
-std::array<float,2>{0.653609514f, 0.769516349f},
-std::array<float,2>{0.96088922f, 0.44781673f},
-std::array<float,2>{0.0376891643f, 0.692247987f},
-std::array<float,2>{0.127936557f, 0.297652453f},
-std::array<float,2>{0.841203988f, 0.571445823f},
-std::array<float,2>{0.512901008f, 0.0238459967f},
-std::array<float,2>{0.481335133f, 0.881204426f},
-std::array<float,2>{0.178534731f, 0.110649355f},
-std::array<float,2>{0.868531168f, 0.960165918f},
-std::array<float,2>{0.552808642f, 0.315067798f},
-std::array<float,2>{0.441983372f, 0.500704706f},
-std::array<float,2>{0.374449164f, 0.407489538f},
-std::array<float,2>{0.668134987f, 0.668775976f},
-std::array<float,2>{0.996370494f, 0.205987811f},
-std::array<float,2>{0.0292929132f, 0.852380335f},
-std::array<float,2>{0.421253264f, 0.12801753f},
-std::array<float,2>{0.582823455f, 0.811424196f},
-std::array<float,2>{0.774189174f, 0.494795144f},
-std::array<float,2>{0.221995994f, 0.728536129f},
-std::array<float,2>{0.068664141f, 0.270644426f},
-std::array<float,2>{0.880394936f, 0.604273438f},
-std::array<float,2>{0.698508084f, 0.0523035154f},
-std::array<float,2>{0.26470235f, 0.921644509f},
-std::array<float,2>{0.0433388874f, 0.245719612f},
-std::array<float,2>{0.965405583f, 0.83131814f},
-std::array<float,2>{0.647202373f, 0.378140092f},
-std::array<float,2>{0.32926625f, 0.643789649f},
-std::array<float,2>{0.470454723f, 0.367141753f},
-std::array<float,2>{0.50646019f, 0.536297441f},
-std::array<float,2>{0.832641602f, 0.0920149237f},
-std::array<float,2>{0.133559823f, 0.989716768f},
-std::array<float,2>{0.290624499f, 0.00640792865f},
-std::array<float,2>{0.73843056f, 0.90067184f},
-std::array<float,2>{0.926523447f, 0.283484489f},
-std::array<float,2>{0.109137177f, 0.591981351f},
-std::array<float,2>{0.208254904f, 0.457548589f},
-std::array<float,2>{0.802737832f, 0.712279975f},
-std::array<float,2>{0.610860229f, 0.187298924f},
-std::array<float,2>{0.403717607f, 0.753320873f},
-std::array<float,2>{0.244600967f, 0.161731243f},
-std::array<float,2>{0.756264091f, 0.770339072f},
-std::array<float,2>{0.57331109f, 0.44922477f},
-std::array<float,2>{0.431545317f, 0.691256046f},
-std::array<float,2>{0.270680457f, 0.303922623f},
-std::array<float,2>{0.712048531f, 0.576959789f},
-std::array<float,2>{0.900633276f, 0.0280165281f},
-std::array<float,2>{0.0910852924f, 0.877484262f},
-std::array<float,2>{0.457294017f, 0.0748738348f},
-std::array<float,2>{0.545824409f, 0.972474933f},
-std::array<float,2>{0.853019595f, 0.347122908f},
-std::array<float,2>{0.162180752f, 0.552790523f},
-std::array<float,2>{0.0106504429f, 0.403321654f},
-std::array<float,2>{0.977993846f, 0.637723863f},
-std::array<float,2>{0.676334858f, 0.223387644f},
-std::array<float,2>{0.353973418f, 0.813259721f},
-std::array<float,2>{0.12439733f, 0.0434334725f},
-std::array<float,2>{0.909704149f, 0.934839666f},
-std::array<float,2>{0.725823164f, 0.264590293f},
-std::array<float,2>{0.30830586f, 0.620214939f},
-std::array<float,2>{0.388243586f, 0.478488863f},
-std::array<float,2>{0.59865576f, 0.743941545f},
-std::array<float,2>{0.790022433f, 0.144428626f},
-std::array<float,2>{0.201517791f, 0.791127026f},
-std::array<float,2>{0.316583365f, 0.201298773f},
-std::array<float,2>{0.626077294f, 0.866243839f},
-std::array<float,2>{0.941780865f, 0.431710958f},
-std::array<float,2>{0.0568285175f, 0.681965053f},
-std::array<float,2>{0.155681208f, 0.328700006f},
-std::array<float,2>{0.824046195f, 0.518290818f},
-std::array<float,2>{0.51907289f, 0.104647562f},
-std::array<float,2>{0.492283851f, 0.939618528f},
-std::array<float,2>{0.189741448f, 0.0211934224f},
-std::array<float,2>{0.787322998f, 0.890551686f},
-std::array<float,2>{0.606804073f, 0.311751217f},
-std::array<float,2>{0.377860785f, 0.564634323f},
-std::array<float,2>{0.297100008f, 0.444147825f},
-std::array<float,2>{0.728977323f, 0.697720349f},
-std::array<float,2>{0.916852593f, 0.167522416f},
-std::array<float,2>{0.109929904f, 0.77654314f},
-std::array<float,2>{0.490510881f, 0.227482811f},
-std::array<float,2>{0.528140664f, 0.827282608f},
-std::array<float,2>{0.815910518f, 0.397777468f},
-std::array<float,2>{0.145528689f, 0.631745756f},
-std::array<float,2>{0.0488512255f, 0.358261824f},
-std::array<float,2>{0.951000929f, 0.562330604f},
-std::array<float,2>{0.632990301f, 0.063455753f},
-std::array<float,2>{0.326833665f, 0.981115878f},
-std::array<float,2>{0.084865503f, 0.149986088f},
-std::array<float,2>{0.891137302f, 0.784709334f},
-std::array<float,2>{0.710596979f, 0.474990606f},
-std::array<float,2>{0.275085509f, 0.736988902f},
-std::array<float,2>{0.42724821f, 0.25625658f},
-std::array<float,2>{0.568902671f, 0.616576433f},
-std::array<float,2>{0.761963308f, 0.0341810584f},
-std::array<float,2>{0.239060774f, 0.923552394f},
-std::array<float,2>{0.34783414f, 0.098840408f},
-std::array<float,2>{0.682346106f, 0.950635195f},
-std::array<float,2>{0.973448277f, 0.336283714f},
-std::array<float,2>{0.00576856639f, 0.5262658f},
-std::array<float,2>{0.167140096f, 0.424498022f},
-std::array<float,2>{0.844427288f, 0.676394761f},
-std::array<float,2>{0.538302064f, 0.191689089f},
-std::array<float,2>{0.466981649f, 0.868649364f},
-std::array<float,2>{0.129802108f, 0.2138616f},
-std::array<float,2>{0.837428927f, 0.849812269f},
-std::array<float,2>{0.507995605f, 0.415570736f},
-std::array<float,2>{0.478098989f, 0.657063246f},
-std::array<float,2>{0.342202306f, 0.325940341f},
-std::array<float,2>{0.651205003f, 0.512726963f},
-std::array<float,2>{0.95378834f, 0.119966835f},
-std::array<float,2>{0.0316389948f, 0.964369655f},
-std::array<float,2>{0.395216107f, 0.0606098175f},
-std::array<float,2>{0.622622848f, 0.909495652f},
-std::array<float,2>{0.81249404f, 0.274792582f},
-std::array<float,2>{0.217047021f, 0.598885238f},
-std::array<float,2>{0.0952911675f, 0.489894688f},
-std::array<float,2>{0.931599915f, 0.723212242f},
-std::array<float,2>{0.749287248f, 0.140162587f},
-std::array<float,2>{0.288182914f, 0.801941216f},
-std::array<float,2>{0.0195997357f, 0.0785653368f},
-std::array<float,2>{0.991337776f, 0.992769539f},
-std::array<float,2>{0.659488797f, 0.37024796f},
-std::array<float,2>{0.361506581f, 0.542647481f},
-std::array<float,2>{0.449311018f, 0.389444619f},
-std::array<float,2>{0.55580759f, 0.652477741f},
-std::array<float,2>{0.862801373f, 0.235100359f},
-std::array<float,2>{0.185937166f, 0.840679288f},
-std::array<float,2>{0.25643447f, 0.173215508f},
-std::array<float,2>{0.695061982f, 0.763756812f},
-std::array<float,2>{0.883739769f, 0.461106986f},
-std::array<float,2>{0.0765621588f, 0.706944883f},
-std::array<float,2>{0.234213307f, 0.29286024f},
-std::array<float,2>{0.768856943f, 0.583492219f},
-std::array<float,2>{0.587313771f, 0.0153489951f},
-std::array<float,2>{0.413209051f, 0.893401742f},
-std::array<float,2>{0.224588364f, 0.067900531f},
-std::array<float,2>{0.778491497f, 0.979844093f},
-std::array<float,2>{0.579104304f, 0.355446905f},
-std::array<float,2>{0.414406031f, 0.556819499f},
-std::array<float,2>{0.258686811f, 0.390681416f},
-std::array<float,2>{0.702962279f, 0.627006292f},
-std::array<float,2>{0.876587451f, 0.232928395f},
-std::array<float,2>{0.06551034f, 0.822219133f},
-std::array<float,2>{0.439610094f, 0.171050102f},
-std::array<float,2>{0.549395561f, 0.780845642f},
-std::array<float,2>{0.872561634f, 0.440664321f},
-std::array<float,2>{0.174466312f, 0.701978266f},
-std::array<float,2>{0.0252555553f, 0.307168216f},
-std::array<float,2>{0.992572725f, 0.568112969f},
-std::array<float,2>{0.667306423f, 0.0190762691f},
-std::array<float,2>{0.367309541f, 0.886031866f},
-std::array<float,2>{0.103443794f, 0.188589081f},
-std::array<float,2>{0.922978759f, 0.871741056f},
-std::array<float,2>{0.736208141f, 0.427816778f},
-std::array<float,2>{0.296546757f, 0.673775256f},
-std::array<float,2>{0.401548088f, 0.341635525f},
-std::array<float,2>{0.6152336f, 0.5310781f},
-std::array<float,2>{0.79790765f, 0.0975919291f},
-std::array<float,2>{0.204197571f, 0.946342111f},
-std::array<float,2>{0.335179687f, 0.0388271436f},
-std::array<float,2>{0.643255115f, 0.927912295f},
-std::array<float,2>{0.963768244f, 0.253492743f},
-std::array<float,2>{0.0422895364f, 0.612027109f},
-std::array<float,2>{0.137376696f, 0.472287297f},
-std::array<float,2>{0.828602552f, 0.739093482f},
-std::array<float,2>{0.500867963f, 0.152835771f},
-std::array<float,2>{0.475072891f, 0.785933137f},
-std::array<float,2>{0.159738913f, 0.133988544f},
-std::array<float,2>{0.859351993f, 0.79869777f},
-std::array<float,2>{0.540140986f, 0.487673432f},
-std::array<float,2>{0.456286907f, 0.720189273f},
-std::array<float,2>{0.358984828f, 0.278468758f},
-std::array<float,2>{0.674013674f, 0.596208453f},
-std::array<float,2>{0.982757688f, 0.0576914698f},
-std::array<float,2>{0.0128362691f, 0.912955821f},
-std::array<float,2>{0.433597594f, 0.122996613f},
-std::array<float,2>{0.575286269f, 0.96581912f},
-std::array<float,2>{0.750156522f, 0.320631534f},
-std::array<float,2>{0.249606088f, 0.508603156f},
-std::array<float,2>{0.0887900293f, 0.418763518f},
-std::array<float,2>{0.903709114f, 0.662875831f},
-std::array<float,2>{0.71870786f, 0.217096061f},
-std::array<float,2>{0.269488752f, 0.846661806f},
-std::array<float,2>{0.0600106195f, 0.0111555187f},
-std::array<float,2>{0.940808952f, 0.897284448f},
-std::array<float,2>{0.631276965f, 0.295310467f},
-std::array<float,2>{0.315622598f, 0.581866384f},
-std::array<float,2>{0.498810083f, 0.468129456f},
-std::array<float,2>{0.522639573f, 0.707042992f},
-std::array<float,2>{0.824732006f, 0.178224728f},
-std::array<float,2>{0.150611058f, 0.75871557f},
-std::array<float,2>{0.308981568f, 0.239000872f},
-std::array<float,2>{0.719443619f, 0.836739123f},
-std::array<float,2>{0.912849784f, 0.384070188f},
-std::array<float,2>{0.11768949f, 0.649102032f},
-std::array<float,2>{0.196239159f, 0.371148467f},
-std::array<float,2>{0.794775605f, 0.546771586f},
-std::array<float,2>{0.594598353f, 0.0823140889f},
-std::array<float,2>{0.384176224f, 0.998673499f},
-std::array<float,2>{0.141961411f, 0.0502822399f},
-std::array<float,2>{0.818771422f, 0.917364597f},
-std::array<float,2>{0.52624464f, 0.267908871f},
-std::array<float,2>{0.48576346f, 0.606549561f},
-std::array<float,2>{0.323941886f, 0.499221176f},
-std::array<float,2>{0.637516618f, 0.731910586f},
-std::array<float,2>{0.948331475f, 0.13205792f},
-std::array<float,2>{0.0546085313f, 0.804710984f},
-std::array<float,2>{0.382361054f, 0.208058834f},
-std::array<float,2>{0.604481816f, 0.856490135f},
-std::array<float,2>{0.782668889f, 0.413111895f},
-std::array<float,2>{0.191560403f, 0.664552033f},
-std::array<float,2>{0.115601882f, 0.317548901f},
-std::array<float,2>{0.921644449f, 0.50771749f},
-std::array<float,2>{0.73436743f, 0.114761502f},
-std::array<float,2>{0.304259032f, 0.955425441f},
-std::array<float,2>{0.00260250783f, 0.179790273f},
-std::array<float,2>{0.969001412f, 0.754097342f},
-std::array<float,2>{0.685777366f, 0.456841737f},
-std::array<float,2>{0.344647616f, 0.715605676f},
-std::array<float,2>{0.463959008f, 0.286430746f},
-std::array<float,2>{0.531847596f, 0.589611113f},
-std::array<float,2>{0.849131703f, 0.00161958672f},
-std::array<float,2>{0.170788929f, 0.903881371f},
-std::array<float,2>{0.281185091f, 0.0886690542f},
-std::array<float,2>{0.705142319f, 0.984916747f},
-std::array<float,2>{0.895465791f, 0.360560954f},
-std::array<float,2>{0.0784713998f, 0.533728063f},
-std::array<float,2>{0.236404717f, 0.379635006f},
-std::array<float,2>{0.761405647f, 0.647841215f},
-std::array<float,2>{0.566024065f, 0.246155217f},
-std::array<float,2>{0.422911257f, 0.835010529f},
-std::array<float,2>{0.212105766f, 0.222072512f},
-std::array<float,2>{0.806758761f, 0.819166481f},
-std::array<float,2>{0.620896101f, 0.398489773f},
-std::array<float,2>{0.393139303f, 0.634047091f},
-std::array<float,2>{0.284184515f, 0.348166168f},
-std::array<float,2>{0.743150473f, 0.550677121f},
-std::array<float,2>{0.934728742f, 0.0703822151f},
-std::array<float,2>{0.101351202f, 0.974854708f},
-std::array<float,2>{0.484252244f, 0.0261262227f},
-std::array<float,2>{0.515556335f, 0.878978014f},
-std::array<float,2>{0.843704581f, 0.299734235f},
-std::array<float,2>{0.126343653f, 0.572798133f},
-std::array<float,2>{0.0369183086f, 0.44695431f},
-std::array<float,2>{0.958847404f, 0.693802476f},
-std::array<float,2>{0.65469569f, 0.156509846f},
-std::array<float,2>{0.337276071f, 0.766288459f},
-std::array<float,2>{0.0722371936f, 0.108260378f},
-std::array<float,2>{0.888688505f, 0.943438053f},
-std::array<float,2>{0.688906908f, 0.333594024f},
-std::array<float,2>{0.250771523f, 0.521360993f},
-std::array<float,2>{0.407784283f, 0.433825165f},
-std::array<float,2>{0.593211055f, 0.68472141f},
-std::array<float,2>{0.770018876f, 0.197761178f},
-std::array<float,2>{0.229803488f, 0.860803962f},
-std::array<float,2>{0.365195781f, 0.146138042f},
-std::array<float,2>{0.662518203f, 0.793056905f},
-std::array<float,2>{0.985459983f, 0.483899236f},
-std::array<float,2>{0.0163860209f, 0.748554826f},
-std::array<float,2>{0.183161288f, 0.260486305f},
-std::array<float,2>{0.866468191f, 0.621972024f},
-std::array<float,2>{0.560619771f, 0.0407477058f},
-std::array<float,2>{0.446283728f, 0.932711184f},
-std::array<float,2>{0.171434313f, 0.0874623209f},
-std::array<float,2>{0.847688913f, 0.98725909f},
-std::array<float,2>{0.532483459f, 0.363176584f},
-std::array<float,2>{0.46303007f, 0.533084095f},
-std::array<float,2>{0.345180094f, 0.382136434f},
-std::array<float,2>{0.687375009f, 0.645567417f},
-std::array<float,2>{0.970337749f, 0.24925895f},
-std::array<float,2>{0.00374232209f, 0.833760202f},
-std::array<float,2>{0.422385782f, 0.183227196f},
-std::array<float,2>{0.564915895f, 0.756174743f},
-std::array<float,2>{0.760582387f, 0.454819888f},
-std::array<float,2>{0.237780213f, 0.718292773f},
-std::array<float,2>{0.0791549087f, 0.289041042f},
-std::array<float,2>{0.895705879f, 0.587453902f},
-std::array<float,2>{0.706597149f, 0.00214847759f},
-std::array<float,2>{0.279809356f, 0.904558778f},
-std::array<float,2>{0.0534547828f, 0.210187033f},
-std::array<float,2>{0.947343171f, 0.858404815f},
-std::array<float,2>{0.638418853f, 0.411392033f},
-std::array<float,2>{0.322843671f, 0.66674298f},
-std::array<float,2>{0.484987199f, 0.319483578f},
-std::array<float,2>{0.526386976f, 0.505262256f},
-std::array<float,2>{0.819590151f, 0.115268752f},
-std::array<float,2>{0.141356006f, 0.953300059f},
-std::array<float,2>{0.302820593f, 0.0470097736f},
-std::array<float,2>{0.732537866f, 0.914146125f},
-std::array<float,2>{0.920579553f, 0.26637277f},
-std::array<float,2>{0.116706967f, 0.609077871f},
-std::array<float,2>{0.192838207f, 0.497033447f},
-std::array<float,2>{0.781327367f, 0.73395586f},
-std::array<float,2>{0.604554355f, 0.129251808f},
-std::array<float,2>{0.381492674f, 0.807237387f},
-std::array<float,2>{0.22917366f, 0.147900194f},
-std::array<float,2>{0.771264374f, 0.795428634f},
-std::array<float,2>{0.592656314f, 0.480491161f},
-std::array<float,2>{0.406764835f, 0.747280061f},
-std::array<float,2>{0.251509815f, 0.258577824f},
-std::array<float,2>{0.688324094f, 0.624623179f},
-std::array<float,2>{0.889827251f, 0.041063074f},
-std::array<float,2>{0.0703810453f, 0.92969358f},
-std::array<float,2>{0.446877956f, 0.106794171f},
-std::array<float,2>{0.56231457f, 0.94160074f},
-std::array<float,2>{0.865684986f, 0.334667057f},
-std::array<float,2>{0.182340354f, 0.52262032f},
-std::array<float,2>{0.0168048255f, 0.436667144f},
-std::array<float,2>{0.984964609f, 0.686337709f},
-std::array<float,2>{0.663792372f, 0.195341334f},
-std::array<float,2>{0.36360243f, 0.861361682f},
-std::array<float,2>{0.100253634f, 0.023648154f},
-std::array<float,2>{0.933770418f, 0.880884767f},
-std::array<float,2>{0.743240595f, 0.297586232f},
-std::array<float,2>{0.283614874f, 0.571625173f},
-std::array<float,2>{0.394116014f, 0.44819808f},
-std::array<float,2>{0.619885564f, 0.691896677f},
-std::array<float,2>{0.808103681f, 0.160071343f},
-std::array<float,2>{0.21175456f, 0.769055128f},
-std::array<float,2>{0.336500496f, 0.220413908f},
-std::array<float,2>{0.655629098f, 0.817952871f},
-std::array<float,2>{0.957070351f, 0.400470018f},
-std::array<float,2>{0.0352214985f, 0.635265112f},
-std::array<float,2>{0.125891253f, 0.349687219f},
-std::array<float,2>{0.842588305f, 0.54712081f},
-std::array<float,2>{0.514226258f, 0.0724911019f},
-std::array<float,2>{0.482641637f, 0.974347413f},
-std::array<float,2>{0.20372811f, 0.0355102904f},
-std::array<float,2>{0.797472656f, 0.926875234f},
-std::array<float,2>{0.613327086f, 0.250784397f},
-std::array<float,2>{0.400629431f, 0.610408127f},
-std::array<float,2>{0.29528147f, 0.470223993f},
-std::array<float,2>{0.734978318f, 0.742051244f},
-std::array<float,2>{0.922794282f, 0.155724317f},
-std::array<float,2>{0.101654299f, 0.787128091f},
-std::array<float,2>{0.476398826f, 0.189969644f},
-std::array<float,2>{0.501682162f, 0.873111129f},
-std::array<float,2>{0.82926482f, 0.426686198f},
-std::array<float,2>{0.137785375f, 0.67400074f},
-std::array<float,2>{0.041459769f, 0.343210608f},
-std::array<float,2>{0.964482725f, 0.528662622f},
-std::array<float,2>{0.643629193f, 0.0952195302f},
-std::array<float,2>{0.334183276f, 0.94887799f},
-std::array<float,2>{0.0649727136f, 0.168447271f},
-std::array<float,2>{0.875177503f, 0.77760452f},
-std::array<float,2>{0.701234221f, 0.438313901f},
-std::array<float,2>{0.259354502f, 0.70112139f},
-std::array<float,2>{0.415909648f, 0.305292398f},
-std::array<float,2>{0.578397214f, 0.568584561f},
-std::array<float,2>{0.777686477f, 0.0173745528f},
-std::array<float,2>{0.223541111f, 0.883245945f},
-std::array<float,2>{0.368183434f, 0.0683611706f},
-std::array<float,2>{0.666665554f, 0.977085352f},
-std::array<float,2>{0.993516684f, 0.35322684f},
-std::array<float,2>{0.0237774309f, 0.555213392f},
-std::array<float,2>{0.174811631f, 0.393653929f},
-std::array<float,2>{0.871176064f, 0.625980735f},
-std::array<float,2>{0.550555229f, 0.231331274f},
-std::array<float,2>{0.440468699f, 0.823881984f},
-std::array<float,2>{0.152248189f, 0.240591407f},
-std::array<float,2>{0.825514495f, 0.839833438f},
-std::array<float,2>{0.521695077f, 0.384807229f},
-std::array<float,2>{0.499768525f, 0.650458217f},
-std::array<float,2>{0.31452176f, 0.374028742f},
-std::array<float,2>{0.632196486f, 0.544607759f},
-std::array<float,2>{0.939853787f, 0.0855255052f},
-std::array<float,2>{0.0593667664f, 0.996590734f},
-std::array<float,2>{0.383449376f, 0.00854926649f},
-std::array<float,2>{0.595012009f, 0.896349788f},
-std::array<float,2>{0.793720484f, 0.293590426f},
-std::array<float,2>{0.196845189f, 0.579175949f},
-std::array<float,2>{0.119049378f, 0.466169327f},
-std::array<float,2>{0.913816154f, 0.709156156f},
-std::array<float,2>{0.719918191f, 0.17664963f},
-std::array<float,2>{0.310243636f, 0.761194348f},
-std::array<float,2>{0.011939412f, 0.124569535f},
-std::array<float,2>{0.983883321f, 0.968744457f},
-std::array<float,2>{0.674862504f, 0.323041797f},
-std::array<float,2>{0.358039349f, 0.510081589f},
-std::array<float,2>{0.455899656f, 0.420581698f},
-std::array<float,2>{0.539228261f, 0.661189556f},
-std::array<float,2>{0.85788548f, 0.215248689f},
-std::array<float,2>{0.159085944f, 0.844123781f},
-std::array<float,2>{0.268342912f, 0.136455014f},
-std::array<float,2>{0.717644095f, 0.800677001f},
-std::array<float,2>{0.902449071f, 0.485817224f},
-std::array<float,2>{0.0895974338f, 0.721043646f},
-std::array<float,2>{0.249014109f, 0.279929489f},
-std::array<float,2>{0.751880825f, 0.595579803f},
-std::array<float,2>{0.574529469f, 0.0560389794f},
-std::array<float,2>{0.434617013f, 0.911536038f},
-std::array<float,2>{0.240099236f, 0.100392759f},
-std::array<float,2>{0.763257682f, 0.952846169f},
-std::array<float,2>{0.569395423f, 0.338494152f},
-std::array<float,2>{0.425825596f, 0.523741543f},
-std::array<float,2>{0.273476303f, 0.423272371f},
-std::array<float,2>{0.709063649f, 0.678818643f},
-std::array<float,2>{0.892039418f, 0.194934547f},
-std::array<float,2>{0.0858529657f, 0.869911671f},
-std::array<float,2>{0.468063891f, 0.150501817f},
-std::array<float,2>{0.537398875f, 0.781966388f},
-std::array<float,2>{0.845156848f, 0.474394202f},
-std::array<float,2>{0.166257158f, 0.736325562f},
-std::array<float,2>{0.00464350637f, 0.255051643f},
-std::array<float,2>{0.974225283f, 0.613907695f},
-std::array<float,2>{0.683451891f, 0.031983763f},
-std::array<float,2>{0.349365592f, 0.923914671f},
-std::array<float,2>{0.111297257f, 0.229373902f},
-std::array<float,2>{0.917759478f, 0.824736059f},
-std::array<float,2>{0.729973078f, 0.396350831f},
-std::array<float,2>{0.297921836f, 0.630203128f},
-std::array<float,2>{0.378843606f, 0.357295215f},
-std::array<float,2>{0.606248558f, 0.558607757f},
-std::array<float,2>{0.788670838f, 0.0658924207f},
-std::array<float,2>{0.190946653f, 0.982583344f},
-std::array<float,2>{0.327690423f, 0.0217646826f},
-std::array<float,2>{0.634623528f, 0.888127267f},
-std::array<float,2>{0.950080097f, 0.309715807f},
-std::array<float,2>{0.050724294f, 0.563673198f},
-std::array<float,2>{0.145095035f, 0.442991883f},
-std::array<float,2>{0.814812958f, 0.696118772f},
-std::array<float,2>{0.529134691f, 0.165891394f},
-std::array<float,2>{0.492160946f, 0.773652554f},
-std::array<float,2>{0.186784014f, 0.17419754f},
-std::array<float,2>{0.861531675f, 0.762874603f},
-std::array<float,2>{0.555560648f, 0.464263469f},
-std::array<float,2>{0.450959772f, 0.703442395f},
-std::array<float,2>{0.362536758f, 0.290885925f},
-std::array<float,2>{0.65872103f, 0.584870696f},
-std::array<float,2>{0.990782738f, 0.0127271619f},
-std::array<float,2>{0.0213855803f, 0.891101062f},
-std::array<float,2>{0.41259554f, 0.081828773f},
-std::array<float,2>{0.586793005f, 0.994871974f},
-std::array<float,2>{0.768330991f, 0.368483454f},
-std::array<float,2>{0.23265028f, 0.53970778f},
-std::array<float,2>{0.0771861672f, 0.387852222f},
-std::array<float,2>{0.883974016f, 0.654750705f},
-std::array<float,2>{0.694232702f, 0.237265646f},
-std::array<float,2>{0.257372707f, 0.843180358f},
-std::array<float,2>{0.0329093263f, 0.0591061786f},
-std::array<float,2>{0.954844594f, 0.907316625f},
-std::array<float,2>{0.651882887f, 0.276484996f},
-std::array<float,2>{0.343336582f, 0.601146638f},
-std::array<float,2>{0.476651192f, 0.490852445f},
-std::array<float,2>{0.509637654f, 0.72606504f},
-std::array<float,2>{0.836057007f, 0.137349531f},
-std::array<float,2>{0.130618572f, 0.803571105f},
-std::array<float,2>{0.28795141f, 0.212652177f},
-std::array<float,2>{0.748781025f, 0.849387467f},
-std::array<float,2>{0.929727256f, 0.417807609f},
-std::array<float,2>{0.0937537327f, 0.659453869f},
-std::array<float,2>{0.218319371f, 0.327302665f},
-std::array<float,2>{0.81150353f, 0.515186012f},
-std::array<float,2>{0.621407807f, 0.11826846f},
-std::array<float,2>{0.395723999f, 0.961474001f},
-std::array<float,2>{0.133888468f, 0.00489172339f},
-std::array<float,2>{0.83351022f, 0.898690343f},
-std::array<float,2>{0.507603049f, 0.282150447f},
-std::array<float,2>{0.468840033f, 0.590612411f},
-std::array<float,2>{0.329010963f, 0.459075063f},
-std::array<float,2>{0.648068368f, 0.71336025f},
-std::array<float,2>{0.966473579f, 0.184684232f},
-std::array<float,2>{0.0442097671f, 0.750697315f},
-std::array<float,2>{0.402723908f, 0.242238656f},
-std::array<float,2>{0.609762251f, 0.829664171f},
-std::array<float,2>{0.804080427f, 0.376105785f},
-std::array<float,2>{0.20727773f, 0.64156419f},
-std::array<float,2>{0.107806832f, 0.364623278f},
-std::array<float,2>{0.927241981f, 0.537407994f},
-std::array<float,2>{0.740047991f, 0.0914404169f},
-std::array<float,2>{0.289448142f, 0.991027772f},
-std::array<float,2>{0.0279276744f, 0.126065403f},
-std::array<float,2>{0.997459412f, 0.809293091f},
-std::array<float,2>{0.669469118f, 0.493571609f},
-std::array<float,2>{0.373255938f, 0.727292478f},
-std::array<float,2>{0.44258967f, 0.273362219f},
-std::array<float,2>{0.554579139f, 0.602543294f},
-std::array<float,2>{0.867806792f, 0.0530424565f},
-std::array<float,2>{0.179507524f, 0.918690383f},
-std::array<float,2>{0.264027238f, 0.111861691f},
-std::array<float,2>{0.697569966f, 0.958121359f},
-std::array<float,2>{0.879408062f, 0.313790739f},
-std::array<float,2>{0.069906354f, 0.503499687f},
-std::array<float,2>{0.220810577f, 0.409525692f},
-std::array<float,2>{0.775316238f, 0.670799553f},
-std::array<float,2>{0.583408654f, 0.204704821f},
-std::array<float,2>{0.420065224f, 0.853719592f},
-std::array<float,2>{0.202333093f, 0.199988469f},
-std::array<float,2>{0.790920854f, 0.863868415f},
-std::array<float,2>{0.597955346f, 0.43109563f},
-std::array<float,2>{0.386925161f, 0.680380344f},
-std::array<float,2>{0.306993783f, 0.330824912f},
-std::array<float,2>{0.725036561f, 0.516741753f},
-std::array<float,2>{0.90901494f, 0.102770634f},
-std::array<float,2>{0.123932138f, 0.938294291f},
-std::array<float,2>{0.493629485f, 0.0452183299f},
-std::array<float,2>{0.518023968f, 0.936968327f},
-std::array<float,2>{0.822312117f, 0.261926383f},
-std::array<float,2>{0.155198947f, 0.617388904f},
-std::array<float,2>{0.0577510186f, 0.480344862f},
-std::array<float,2>{0.942876399f, 0.746037602f},
-std::array<float,2>{0.625545144f, 0.141608521f},
-std::array<float,2>{0.317713141f, 0.789943099f},
-std::array<float,2>{0.0903211012f, 0.0768349543f},
-std::array<float,2>{0.902272582f, 0.969130158f},
-std::array<float,2>{0.711156547f, 0.345203698f},
-std::array<float,2>{0.270468682f, 0.55109024f},
-std::array<float,2>{0.4300659f, 0.405821323f},
-std::array<float,2>{0.57273978f, 0.640438199f},
-std::array<float,2>{0.757721424f, 0.224944055f},
-std::array<float,2>{0.245238319f, 0.815247715f},
-std::array<float,2>{0.354516298f, 0.162686288f},
-std::array<float,2>{0.677403688f, 0.773026586f},
-std::array<float,2>{0.976754725f, 0.451784939f},
-std::array<float,2>{0.0115035288f, 0.689049244f},
-std::array<float,2>{0.163545579f, 0.302305102f},
-std::array<float,2>{0.851785362f, 0.575481176f},
-std::array<float,2>{0.54643172f, 0.0305630099f},
-std::array<float,2>{0.45819363f, 0.876826167f},
-std::array<float,2>{0.142785147f, 0.115047194f},
-std::array<float,2>{0.816490054f, 0.955298603f},
-std::array<float,2>{0.525073886f, 0.31770584f},
-std::array<float,2>{0.486929119f, 0.507503688f},
-std::array<float,2>{0.321307272f, 0.413463145f},
-std::array<float,2>{0.638858438f, 0.664856672f},
-std::array<float,2>{0.945572376f, 0.208289057f},
-std::array<float,2>{0.0521354489f, 0.85688144f},
-std::array<float,2>{0.379260808f, 0.132231399f},
-std::array<float,2>{0.602990627f, 0.805029511f},
-std::array<float,2>{0.784440458f, 0.499466032f},
-std::array<float,2>{0.194537148f, 0.73160696f},
-std::array<float,2>{0.114455454f, 0.267746031f},
-std::array<float,2>{0.919918716f, 0.606918395f},
-std::array<float,2>{0.731361091f, 0.0498155579f},
-std::array<float,2>{0.301592231f, 0.917124391f},
-std::array<float,2>{0.000405513973f, 0.246457979f},
-std::array<float,2>{0.970918298f, 0.835385501f},
-std::array<float,2>{0.685166717f, 0.379741251f},
-std::array<float,2>{0.34705162f, 0.647684276f},
-std::array<float,2>{0.461694837f, 0.360752463f},
-std::array<float,2>{0.53446722f, 0.534011662f},
-std::array<float,2>{0.850839794f, 0.0885047987f},
-std::array<float,2>{0.168552384f, 0.985126793f},
-std::array<float,2>{0.278553873f, 0.0019501705f},
-std::array<float,2>{0.703676164f, 0.904257894f},
-std::array<float,2>{0.897346377f, 0.286214054f},
-std::array<float,2>{0.0814657062f, 0.589542329f},
-std::array<float,2>{0.235720947f, 0.456644982f},
-std::array<float,2>{0.758446515f, 0.715430439f},
-std::array<float,2>{0.563752592f, 0.180118904f},
-std::array<float,2>{0.425562322f, 0.754258752f},
-std::array<float,2>{0.21438159f, 0.156408206f},
-std::array<float,2>{0.806373954f, 0.766373932f},
-std::array<float,2>{0.617253125f, 0.447131962f},
-std::array<float,2>{0.392351866f, 0.693378687f},
-std::array<float,2>{0.283077091f, 0.2994546f},
-std::array<float,2>{0.74431169f, 0.573095977f},
-std::array<float,2>{0.93713069f, 0.0260714646f},
-std::array<float,2>{0.0988369286f, 0.879254282f},
-std::array<float,2>{0.481505752f, 0.0707183853f},
-std::array<float,2>{0.512253046f, 0.974847972f},
-std::array<float,2>{0.840083063f, 0.348420858f},
-std::array<float,2>{0.127002642f, 0.550456226f},
-std::array<float,2>{0.0385844037f, 0.39877066f},
-std::array<float,2>{0.959357381f, 0.634005249f},
-std::array<float,2>{0.652883351f, 0.22171092f},
-std::array<float,2>{0.338466227f, 0.818895996f},
-std::array<float,2>{0.0736013278f, 0.0409834534f},
-std::array<float,2>{0.88713932f, 0.932867885f},
-std::array<float,2>{0.690183222f, 0.260650814f},
-std::array<float,2>{0.253876179f, 0.621774018f},
-std::array<float,2>{0.408326656f, 0.48420161f},
-std::array<float,2>{0.59064883f, 0.748935282f},
-std::array<float,2>{0.77224046f, 0.146335393f},
-std::array<float,2>{0.227852017f, 0.793335795f},
-std::array<float,2>{0.366863906f, 0.198137775f},
-std::array<float,2>{0.661149681f, 0.860566258f},
-std::array<float,2>{0.988236785f, 0.434062332f},
-std::array<float,2>{0.0182372313f, 0.684992433f},
-std::array<float,2>{0.181048274f, 0.33383131f},
-std::array<float,2>{0.863949239f, 0.521072447f},
-std::array<float,2>{0.559608281f, 0.10813956f},
-std::array<float,2>{0.448034048f, 0.943666279f},
-std::array<float,2>{0.225981131f, 0.0194673147f},
-std::array<float,2>{0.780653894f, 0.885788262f},
-std::array<float,2>{0.580520511f, 0.30742994f},
-std::array<float,2>{0.416672111f, 0.568154871f},
-std::array<float,2>{0.259865552f, 0.440814376f},
-std::array<float,2>{0.69943732f, 0.701835096f},
-std::array<float,2>{0.877286971f, 0.171193227f},
-std::array<float,2>{0.0642753169f, 0.781207025f},
-std::array<float,2>{0.439008415f, 0.233260155f},
-std::array<float,2>{0.547929466f, 0.821872711f},
-std::array<float,2>{0.874922216f, 0.391110659f},
-std::array<float,2>{0.172009721f, 0.627367079f},
-std::array<float,2>{0.0270140301f, 0.355195552f},
-std::array<float,2>{0.994894564f, 0.557033896f},
-std::array<float,2>{0.664605319f, 0.0682455152f},
-std::array<float,2>{0.370247662f, 0.979607463f},
-std::array<float,2>{0.105227932f, 0.153239414f},
-std::array<float,2>{0.925375462f, 0.785752892f},
-std::array<float,2>{0.737920642f, 0.472503722f},
-std::array<float,2>{0.294742197f, 0.738853991f},
-std::array<float,2>{0.399294078f, 0.253890127f},
-std::array<float,2>{0.61578095f, 0.612073541f},
-std::array<float,2>{0.800118208f, 0.0386743844f},
-std::array<float,2>{0.205852464f, 0.928169906f},
-std::array<float,2>{0.332457781f, 0.0973036364f},
-std::array<float,2>{0.641169548f, 0.946692705f},
-std::array<float,2>{0.961394548f, 0.341332883f},
-std::array<float,2>{0.0393108837f, 0.530770123f},
-std::array<float,2>{0.13929686f, 0.428022176f},
-std::array<float,2>{0.831251025f, 0.673510671f},
-std::array<float,2>{0.50260824f, 0.18883732f},
-std::array<float,2>{0.472905666f, 0.872011006f},
-std::array<float,2>{0.158060804f, 0.216805741f},
-std::array<float,2>{0.856560886f, 0.846245289f},
-std::array<float,2>{0.542618632f, 0.418493509f},
-std::array<float,2>{0.45429945f, 0.662818849f},
-std::array<float,2>{0.355714589f, 0.320527434f},
-std::array<float,2>{0.672979593f, 0.508435547f},
-std::array<float,2>{0.981584966f, 0.122711375f},
-std::array<float,2>{0.0153892869f, 0.9654845f},
-std::array<float,2>{0.4364748f, 0.0580834821f},
-std::array<float,2>{0.576461136f, 0.912693977f},
-std::array<float,2>{0.752198875f, 0.278633565f},
-std::array<float,2>{0.247613788f, 0.596669316f},
-std::array<float,2>{0.0872687101f, 0.487356871f},
-std::array<float,2>{0.904399097f, 0.719802201f},
-std::array<float,2>{0.715186298f, 0.134120435f},
-std::array<float,2>{0.267537087f, 0.798516572f},
-std::array<float,2>{0.0620097741f, 0.0821593255f},
-std::array<float,2>{0.938742459f, 0.999004126f},
-std::array<float,2>{0.630245686f, 0.371374667f},
-std::array<float,2>{0.313822716f, 0.546497285f},
-std::array<float,2>{0.496106267f, 0.384009421f},
-std::array<float,2>{0.520599008f, 0.649377644f},
-std::array<float,2>{0.827456295f, 0.23921001f},
-std::array<float,2>{0.150389969f, 0.836480141f},
-std::array<float,2>{0.311757118f, 0.178621009f},
-std::array<float,2>{0.722236753f, 0.7583884f},
-std::array<float,2>{0.911994576f, 0.467781931f},
-std::array<float,2>{0.119489491f, 0.707396507f},
-std::array<float,2>{0.198515117f, 0.295070529f},
-std::array<float,2>{0.794972956f, 0.581561446f},
-std::array<float,2>{0.596101165f, 0.0107634496f},
-std::array<float,2>{0.385767698f, 0.897143662f},
-std::array<float,2>{0.188383326f, 0.0629895255f},
-std::array<float,2>{0.786344111f, 0.981362939f},
-std::array<float,2>{0.608014822f, 0.358120561f},
-std::array<float,2>{0.376132518f, 0.562083781f},
-std::array<float,2>{0.300388217f, 0.397679329f},
-std::array<float,2>{0.728307486f, 0.631560028f},
-std::array<float,2>{0.914255619f, 0.227290288f},
-std::array<float,2>{0.112413779f, 0.827399611f},
-std::array<float,2>{0.489566922f, 0.167757452f},
-std::array<float,2>{0.529717028f, 0.776767969f},
-std::array<float,2>{0.813392043f, 0.443925261f},
-std::array<float,2>{0.147311941f, 0.697407186f},
-std::array<float,2>{0.0469323173f, 0.311798483f},
-std::array<float,2>{0.952364981f, 0.564872086f},
-std::array<float,2>{0.63605386f, 0.0213705748f},
-std::array<float,2>{0.325134367f, 0.890355945f},
-std::array<float,2>{0.0820824355f, 0.191567212f},
-std::array<float,2>{0.894044757f, 0.868305862f},
-std::array<float,2>{0.708256006f, 0.42458123f},
-std::array<float,2>{0.277343661f, 0.676611304f},
-std::array<float,2>{0.427797616f, 0.336152673f},
-std::array<float,2>{0.567229092f, 0.526044726f},
-std::array<float,2>{0.764390469f, 0.0990816802f},
-std::array<float,2>{0.240692183f, 0.950201988f},
-std::array<float,2>{0.35110727f, 0.0344373062f},
-std::array<float,2>{0.68042165f, 0.923745751f},
-std::array<float,2>{0.97648102f, 0.255995631f},
-std::array<float,2>{0.00663137622f, 0.616325796f},
-std::array<float,2>{0.165891573f, 0.474843055f},
-std::array<float,2>{0.846322656f, 0.737249076f},
-std::array<float,2>{0.535322189f, 0.150243476f},
-std::array<float,2>{0.466443717f, 0.785036623f},
-std::array<float,2>{0.131632343f, 0.14039208f},
-std::array<float,2>{0.838845432f, 0.802102983f},
-std::array<float,2>{0.510288179f, 0.490114212f},
-std::array<float,2>{0.47869736f, 0.723447978f},
-std::array<float,2>{0.341295987f, 0.274425417f},
-std::array<float,2>{0.650259018f, 0.598835468f},
-std::array<float,2>{0.955967844f, 0.0609386452f},
-std::array<float,2>{0.0336480066f, 0.909319937f},
-std::array<float,2>{0.397021353f, 0.119686656f},
-std::array<float,2>{0.62365061f, 0.964842796f},
-std::array<float,2>{0.810209274f, 0.325873405f},
-std::array<float,2>{0.214939892f, 0.513087571f},
-std::array<float,2>{0.0973098576f, 0.415975153f},
-std::array<float,2>{0.933338046f, 0.656939805f},
-std::array<float,2>{0.746769667f, 0.213423684f},
-std::array<float,2>{0.286566794f, 0.849996626f},
-std::array<float,2>{0.0234138221f, 0.015529138f},
-std::array<float,2>{0.989172339f, 0.893278062f},
-std::array<float,2>{0.656547904f, 0.292705417f},
-std::array<float,2>{0.361006171f, 0.583227336f},
-std::array<float,2>{0.452110022f, 0.461274177f},
-std::array<float,2>{0.557644129f, 0.706760406f},
-std::array<float,2>{0.859480321f, 0.173073485f},
-std::array<float,2>{0.184668481f, 0.764121234f},
-std::array<float,2>{0.254054695f, 0.235349998f},
-std::array<float,2>{0.691843033f, 0.840420306f},
-std::array<float,2>{0.885622919f, 0.3893224f},
-std::array<float,2>{0.0745784044f, 0.65263176f},
-std::array<float,2>{0.231441632f, 0.370563805f},
-std::array<float,2>{0.766781867f, 0.542817354f},
-std::array<float,2>{0.589137852f, 0.0783312917f},
-std::array<float,2>{0.410677284f, 0.993134201f},
-std::array<float,2>{0.17689836f, 0.0526678786f},
-std::array<float,2>{0.870699763f, 0.921420276f},
-std::array<float,2>{0.552673459f, 0.270853668f},
-std::array<float,2>{0.444654524f, 0.604005277f},
-std::array<float,2>{0.371695518f, 0.494921297f},
-std::array<float,2>{0.671350181f, 0.728793144f},
-std::array<float,2>{0.99969703f, 0.12834385f},
-std::array<float,2>{0.029971296f, 0.811212242f},
-std::array<float,2>{0.418231934f, 0.205743983f},
-std::array<float,2>{0.585274279f, 0.852226973f},
-std::array<float,2>{0.776399434f, 0.407448351f},
-std::array<float,2>{0.219612136f, 0.668599486f},
-std::array<float,2>{0.0672212765f, 0.315187812f},
-std::array<float,2>{0.881441474f, 0.50078398f},
-std::array<float,2>{0.695515335f, 0.110577129f},
-std::array<float,2>{0.262211889f, 0.96029079f},
-std::array<float,2>{0.0451485217f, 0.187176883f},
-std::array<float,2>{0.968557179f, 0.753109634f},
-std::array<float,2>{0.644626677f, 0.457985908f},
-std::array<float,2>{0.33180809f, 0.712078691f},
-std::array<float,2>{0.472614199f, 0.283299267f},
-std::array<float,2>{0.505653381f, 0.592270136f},
-std::array<float,2>{0.834024847f, 0.00677393423f},
-std::array<float,2>{0.134927064f, 0.900596857f},
-std::array<float,2>{0.292303473f, 0.0920501873f},
-std::array<float,2>{0.741095364f, 0.989317477f},
-std::array<float,2>{0.928110063f, 0.366915524f},
-std::array<float,2>{0.105572835f, 0.536421955f},
-std::array<float,2>{0.209670454f, 0.378382325f},
-std::array<float,2>{0.801684499f, 0.64394927f},
-std::array<float,2>{0.611895621f, 0.245969757f},
-std::array<float,2>{0.405452371f, 0.831241608f},
-std::array<float,2>{0.242441624f, 0.223565996f},
-std::array<float,2>{0.755120575f, 0.813005209f},
-std::array<float,2>{0.572242141f, 0.403590411f},
-std::array<float,2>{0.432004541f, 0.638168812f},
-std::array<float,2>{0.272809863f, 0.346865088f},
-std::array<float,2>{0.714104235f, 0.553054869f},
-std::array<float,2>{0.898578167f, 0.0750200301f},
-std::array<float,2>{0.0934201777f, 0.972276032f},
-std::array<float,2>{0.459193498f, 0.0282011982f},
-std::array<float,2>{0.543501794f, 0.877714574f},
-std::array<float,2>{0.855320513f, 0.304042161f},
-std::array<float,2>{0.161624551f, 0.576725245f},
-std::array<float,2>{0.00910385419f, 0.449590176f},
-std::array<float,2>{0.979763389f, 0.691046f},
-std::array<float,2>{0.679207504f, 0.1618772f},
-std::array<float,2>{0.353321493f, 0.77017647f},
-std::array<float,2>{0.122344896f, 0.104765154f},
-std::array<float,2>{0.906582534f, 0.939714968f},
-std::array<float,2>{0.723803341f, 0.329031587f},
-std::array<float,2>{0.305117726f, 0.518361807f},
-std::array<float,2>{0.388911217f, 0.432085991f},
-std::array<float,2>{0.60015285f, 0.68170315f},
-std::array<float,2>{0.792609513f, 0.201587543f},
-std::array<float,2>{0.200535059f, 0.866662741f},
-std::array<float,2>{0.320107102f, 0.144131094f},
-std::array<float,2>{0.628625214f, 0.791369915f},
-std::array<float,2>{0.945009649f, 0.478031337f},
-std::array<float,2>{0.0551404431f, 0.743692815f},
-std::array<float,2>{0.153232917f, 0.264388084f},
-std::array<float,2>{0.821702778f, 0.620430946f},
-std::array<float,2>{0.516802907f, 0.043134287f},
-std::array<float,2>{0.4948093f, 0.934634268f},
-std::array<float,2>{0.128841117f, 0.0733729899f},
-std::array<float,2>{0.841642559f, 0.973478734f},
-std::array<float,2>{0.513501644f, 0.350888938f},
-std::array<float,2>{0.480478555f, 0.548128963f},
-std::array<float,2>{0.339549363f, 0.401615322f},
-std::array<float,2>{0.654135466f, 0.636652172f},
-std::array<float,2>{0.960006177f, 0.219607964f},
-std::array<float,2>{0.0374895073f, 0.816479802f},
-std::array<float,2>{0.391236097f, 0.15871802f},
-std::array<float,2>{0.61895901f, 0.767812192f},
-std::array<float,2>{0.804839373f, 0.448391169f},
-std::array<float,2>{0.213606343f, 0.692859054f},
-std::array<float,2>{0.0981076583f, 0.298387796f},
-std::array<float,2>{0.936342061f, 0.571272552f},
-std::array<float,2>{0.745674849f, 0.0253284425f},
-std::array<float,2>{0.282034367f, 0.882788718f},
-std::array<float,2>{0.019419916f, 0.196856722f},
-std::array<float,2>{0.986564755f, 0.862836123f},
-std::array<float,2>{0.660355747f, 0.435592532f},
-std::array<float,2>{0.366066366f, 0.686967194f},
-std::array<float,2>{0.449069679f, 0.335779607f},
-std::array<float,2>{0.558942974f, 0.521519065f},
-std::array<float,2>{0.865202308f, 0.105663449f},
-std::array<float,2>{0.180552557f, 0.9426139f},
-std::array<float,2>{0.252316833f, 0.0429016687f},
-std::array<float,2>{0.691001415f, 0.930769503f},
-std::array<float,2>{0.88839525f, 0.259072006f},
-std::array<float,2>{0.0723484531f, 0.623920143f},
-std::array<float,2>{0.227372795f, 0.48222807f},
-std::array<float,2>{0.772656918f, 0.746693432f},
-std::array<float,2>{0.591251731f, 0.14663291f},
-std::array<float,2>{0.409930259f, 0.796263754f},
-std::array<float,2>{0.194216833f, 0.130259886f},
-std::array<float,2>{0.784160256f, 0.808350444f},
-std::array<float,2>{0.601926446f, 0.497208297f},
-std::array<float,2>{0.380610615f, 0.732973218f},
-std::array<float,2>{0.301813006f, 0.26697576f},
-std::array<float,2>{0.73240757f, 0.608321965f},
-std::array<float,2>{0.918605924f, 0.0486516729f},
-std::array<float,2>{0.113448903f, 0.915183961f},
-std::array<float,2>{0.487801373f, 0.116954051f},
-std::array<float,2>{0.523535311f, 0.954467177f},
-std::array<float,2>{0.818347096f, 0.318791449f},
-std::array<float,2>{0.144312605f, 0.504534066f},
-std::array<float,2>{0.050842572f, 0.410632908f},
-std::array<float,2>{0.947124243f, 0.667737603f},
-std::array<float,2>{0.640087545f, 0.209059432f},
-std::array<float,2>{0.32114321f, 0.857940495f},
-std::array<float,2>{0.0801459849f, 0.00382747548f},
-std::array<float,2>{0.898396313f, 0.905630827f},
-std::array<float,2>{0.704342365f, 0.287793815f},
-std::array<float,2>{0.278122604f, 0.586854339f},
-std::array<float,2>{0.424346447f, 0.453451276f},
-std::array<float,2>{0.563238204f, 0.717493534f},
-std::array<float,2>{0.758927405f, 0.182238325f},
-std::array<float,2>{0.234473586f, 0.757339478f},
-std::array<float,2>{0.346386701f, 0.248626396f},
-std::array<float,2>{0.683863699f, 0.832395136f},
-std::array<float,2>{0.972031772f, 0.381083012f},
-std::array<float,2>{0.00183509151f, 0.644738376f},
-std::array<float,2>{0.169897616f, 0.361369908f},
-std::array<float,2>{0.850142062f, 0.532147467f},
-std::array<float,2>{0.53354764f, 0.0862086639f},
-std::array<float,2>{0.46275565f, 0.988105059f},
-std::array<float,2>{0.246730164f, 0.055624865f},
-std::array<float,2>{0.753282428f, 0.910482585f},
-std::array<float,2>{0.577972412f, 0.281108171f},
-std::array<float,2>{0.437037259f, 0.594725072f},
-std::array<float,2>{0.266227037f, 0.485268056f},
-std::array<float,2>{0.716488838f, 0.722159863f},
-std::array<float,2>{0.90605253f, 0.135548174f},
-std::array<float,2>{0.0864694864f, 0.7997908f},
-std::array<float,2>{0.454045445f, 0.216380969f},
-std::array<float,2>{0.541263103f, 0.844916463f},
-std::array<float,2>{0.855813682f, 0.421557784f},
-std::array<float,2>{0.156347677f, 0.661062241f},
-std::array<float,2>{0.0144091966f, 0.323568583f},
-std::array<float,2>{0.980580032f, 0.511324704f},
-std::array<float,2>{0.672257066f, 0.123366795f},
-std::array<float,2>{0.35720247f, 0.967196345f},
-std::array<float,2>{0.120329097f, 0.177441761f},
-std::array<float,2>{0.910573065f, 0.760664761f},
-std::array<float,2>{0.721007168f, 0.465315282f},
-std::array<float,2>{0.31150189f, 0.710724354f},
-std::array<float,2>{0.384968907f, 0.294172108f},
-std::array<float,2>{0.59671241f, 0.57855165f},
-std::array<float,2>{0.796698689f, 0.00912478007f},
-std::array<float,2>{0.197704166f, 0.894917786f},
-std::array<float,2>{0.313117981f, 0.0842298493f},
-std::array<float,2>{0.629497111f, 0.998033106f},
-std::array<float,2>{0.93797946f, 0.373417109f},
-std::array<float,2>{0.0613068826f, 0.543308616f},
-std::array<float,2>{0.148879603f, 0.385971606f},
-std::array<float,2>{0.827134788f, 0.651476145f},
-std::array<float,2>{0.519646704f, 0.242174208f},
-std::array<float,2>{0.498011142f, 0.838592052f},
-std::array<float,2>{0.173180208f, 0.232170701f},
-std::array<float,2>{0.873143852f, 0.822339296f},
-std::array<float,2>{0.547187448f, 0.392852277f},
-std::array<float,2>{0.438171357f, 0.625515401f},
-std::array<float,2>{0.369554192f, 0.352281153f},
-std::array<float,2>{0.665055752f, 0.555864036f},
-std::array<float,2>{0.995181978f, 0.0696779341f},
-std::array<float,2>{0.0256607942f, 0.978485107f},
-std::array<float,2>{0.417525917f, 0.0160951074f},
-std::array<float,2>{0.581680417f, 0.8842116f},
-std::array<float,2>{0.779666126f, 0.306015998f},
-std::array<float,2>{0.224739611f, 0.569571972f},
-std::array<float,2>{0.0626583025f, 0.439396471f},
-std::array<float,2>{0.878493011f, 0.699306488f},
-std::array<float,2>{0.701106548f, 0.169366613f},
-std::array<float,2>{0.261000782f, 0.778436959f},
-std::array<float,2>{0.0406994447f, 0.0939665809f},
-std::array<float,2>{0.962797225f, 0.947908461f},
-std::array<float,2>{0.642406762f, 0.342252254f},
-std::array<float,2>{0.333120346f, 0.527816594f},
-std::array<float,2>{0.474071473f, 0.426769763f},
-std::array<float,2>{0.50388664f, 0.675324738f},
-std::array<float,2>{0.830946982f, 0.190756708f},
-std::array<float,2>{0.139894113f, 0.874988794f},
-std::array<float,2>{0.293820351f, 0.154615551f},
-std::array<float,2>{0.736420035f, 0.788342834f},
-std::array<float,2>{0.924440086f, 0.469092935f},
-std::array<float,2>{0.104282349f, 0.741069019f},
-std::array<float,2>{0.206469148f, 0.251097888f},
-std::array<float,2>{0.799414098f, 0.610154927f},
-std::array<float,2>{0.616331756f, 0.0366382785f},
-std::array<float,2>{0.399644583f, 0.926060259f},
-std::array<float,2>{0.216537997f, 0.117836311f},
-std::array<float,2>{0.80932802f, 0.962489247f},
-std::array<float,2>{0.624754608f, 0.326505899f},
-std::array<float,2>{0.397866398f, 0.514558852f},
-std::array<float,2>{0.285854489f, 0.416524202f},
-std::array<float,2>{0.747411966f, 0.658643246f},
-std::array<float,2>{0.932033539f, 0.211819902f},
-std::array<float,2>{0.0959098712f, 0.847798169f},
-std::array<float,2>{0.480031818f, 0.138121426f},
-std::array<float,2>{0.511671662f, 0.803763568f},
-std::array<float,2>{0.839782238f, 0.492149472f},
-std::array<float,2>{0.132610843f, 0.725135207f},
-std::array<float,2>{0.034481775f, 0.276274681f},
-std::array<float,2>{0.956368029f, 0.600109518f},
-std::array<float,2>{0.649261296f, 0.0603926703f},
-std::array<float,2>{0.340419173f, 0.906760991f},
-std::array<float,2>{0.0754568651f, 0.23800227f},
-std::array<float,2>{0.886353254f, 0.84196496f},
-std::array<float,2>{0.69276756f, 0.387544513f},
-std::array<float,2>{0.255411714f, 0.655348241f},
-std::array<float,2>{0.411913544f, 0.367625862f},
-std::array<float,2>{0.588250637f, 0.540688813f},
-std::array<float,2>{0.76587218f, 0.0806941167f},
-std::array<float,2>{0.231589526f, 0.995516241f},
-std::array<float,2>{0.359430343f, 0.0122566875f},
-std::array<float,2>{0.657740235f, 0.892319679f},
-std::array<float,2>{0.989344716f, 0.289849102f},
-std::array<float,2>{0.0216123275f, 0.585494637f},
-std::array<float,2>{0.183630615f, 0.463121772f},
-std::array<float,2>{0.860641122f, 0.704404354f},
-std::array<float,2>{0.55725646f, 0.17503801f},
-std::array<float,2>{0.45258221f, 0.762649238f},
-std::array<float,2>{0.147867128f, 0.164822042f},
-std::array<float,2>{0.813750505f, 0.775267839f},
-std::array<float,2>{0.530634105f, 0.441428274f},
-std::array<float,2>{0.489245027f, 0.696435034f},
-std::array<float,2>{0.32614848f, 0.308691889f},
-std::array<float,2>{0.635174632f, 0.562990189f},
-std::array<float,2>{0.951778412f, 0.0225417428f},
-std::array<float,2>{0.0484201647f, 0.887243569f},
-std::array<float,2>{0.375179976f, 0.0651043579f},
-std::array<float,2>{0.608647346f, 0.983725369f},
-std::array<float,2>{0.785963476f, 0.355590224f},
-std::array<float,2>{0.189044937f, 0.55980438f},
-std::array<float,2>{0.112096369f, 0.394833446f},
-std::array<float,2>{0.91511637f, 0.629135847f},
-std::array<float,2>{0.726883173f, 0.230462253f},
-std::array<float,2>{0.298929095f, 0.825632274f},
-std::array<float,2>{0.00779298879f, 0.0326732099f},
-std::array<float,2>{0.975026071f, 0.925690114f},
-std::array<float,2>{0.680899858f, 0.254513294f},
-std::array<float,2>{0.350516766f, 0.614756346f},
-std::array<float,2>{0.46494928f, 0.473325372f},
-std::array<float,2>{0.536224127f, 0.734683752f},
-std::array<float,2>{0.846782684f, 0.152084723f},
-std::array<float,2>{0.164102361f, 0.782547474f},
-std::array<float,2>{0.276297867f, 0.193637282f},
-std::array<float,2>{0.707813859f, 0.870504677f},
-std::array<float,2>{0.893468082f, 0.422279954f},
-std::array<float,2>{0.0836187452f, 0.678007483f},
-std::array<float,2>{0.241655543f, 0.339811563f},
-std::array<float,2>{0.764757156f, 0.525227666f},
-std::array<float,2>{0.567664266f, 0.101241343f},
-std::array<float,2>{0.429199159f, 0.952139735f},
-std::array<float,2>{0.160419717f, 0.0299127717f},
-std::array<float,2>{0.853781521f, 0.875457168f},
-std::array<float,2>{0.544638395f, 0.301035881f},
-std::array<float,2>{0.460541278f, 0.574486375f},
-std::array<float,2>{0.352439702f, 0.452603072f},
-std::array<float,2>{0.678275645f, 0.687642634f},
-std::array<float,2>{0.979455948f, 0.163601577f},
-std::array<float,2>{0.00797370262f, 0.771623254f},
-std::array<float,2>{0.433432847f, 0.226443768f},
-std::array<float,2>{0.570377946f, 0.816310525f},
-std::array<float,2>{0.754880548f, 0.404551327f},
-std::array<float,2>{0.243313551f, 0.639059544f},
-std::array<float,2>{0.0921146646f, 0.3437953f},
-std::array<float,2>{0.900278151f, 0.552040637f},
-std::array<float,2>{0.71295619f, 0.0779790878f},
-std::array<float,2>{0.271748126f, 0.96977818f},
-std::array<float,2>{0.0565583594f, 0.141404048f},
-std::array<float,2>{0.944315016f, 0.790265977f},
-std::array<float,2>{0.627581f, 0.478814483f},
-std::array<float,2>{0.319226742f, 0.745091617f},
-std::array<float,2>{0.495966673f, 0.26325506f},
-std::array<float,2>{0.516103268f, 0.61858052f},
-std::array<float,2>{0.820550382f, 0.0467310399f},
-std::array<float,2>{0.15425466f, 0.936356306f},
-std::array<float,2>{0.306455761f, 0.102492586f},
-std::array<float,2>{0.723106325f, 0.93936193f},
-std::array<float,2>{0.907776535f, 0.331869662f},
-std::array<float,2>{0.121152915f, 0.516108274f},
-std::array<float,2>{0.199747041f, 0.430533499f},
-std::array<float,2>{0.791432619f, 0.681288719f},
-std::array<float,2>{0.600986779f, 0.200917289f},
-std::array<float,2>{0.389959723f, 0.865056753f},
-std::array<float,2>{0.219909742f, 0.203733459f},
-std::array<float,2>{0.775460124f, 0.854660928f},
-std::array<float,2>{0.584158242f, 0.408418477f},
-std::array<float,2>{0.419743538f, 0.671780169f},
-std::array<float,2>{0.262801021f, 0.312934607f},
-std::array<float,2>{0.696642756f, 0.502623796f},
-std::array<float,2>{0.88272965f, 0.112923741f},
-std::array<float,2>{0.0682949275f, 0.957262516f},
-std::array<float,2>{0.443615317f, 0.0539409742f},
-std::array<float,2>{0.551566064f, 0.91928339f},
-std::array<float,2>{0.8699494f, 0.272029996f},
-std::array<float,2>{0.17661649f, 0.60244441f},
-std::array<float,2>{0.0310335085f, 0.492713243f},
-std::array<float,2>{0.998675823f, 0.72838378f},
-std::array<float,2>{0.670235693f, 0.125176266f},
-std::array<float,2>{0.372414559f, 0.810273886f},
-std::array<float,2>{0.106482051f, 0.0905907303f},
-std::array<float,2>{0.929053545f, 0.991451621f},
-std::array<float,2>{0.742123663f, 0.363779813f},
-std::array<float,2>{0.291281223f, 0.538253665f},
-std::array<float,2>{0.404442161f, 0.375398427f},
-std::array<float,2>{0.612829924f, 0.642131507f},
-std::array<float,2>{0.802222848f, 0.24339211f},
-std::array<float,2>{0.210620731f, 0.828208625f},
-std::array<float,2>{0.330449194f, 0.184077337f},
-std::array<float,2>{0.646285534f, 0.751379132f},
-std::array<float,2>{0.966982782f, 0.460025251f},
-std::array<float,2>{0.046759814f, 0.713925958f},
-std::array<float,2>{0.135990113f, 0.282865018f},
-std::array<float,2>{0.834964037f, 0.591570973f},
-std::array<float,2>{0.504730403f, 0.00398493465f},
-std::array<float,2>{0.470939934f, 0.9001984f},
-std::array<float,2>{0.182991236f, 0.109013699f},
-std::array<float,2>{0.86674732f, 0.945164025f},
-std::array<float,2>{0.561216593f, 0.332873493f},
-std::array<float,2>{0.445749938f, 0.520380378f},
-std::array<float,2>{0.364634007f, 0.435473144f},
-std::array<float,2>{0.66260612f, 0.683624387f},
-std::array<float,2>{0.985892117f, 0.198547035f},
-std::array<float,2>{0.0158736985f, 0.859667003f},
-std::array<float,2>{0.407515347f, 0.144812256f},
-std::array<float,2>{0.593306005f, 0.79445225f},
-std::array<float,2>{0.770022929f, 0.483002961f},
-std::array<float,2>{0.229993626f, 0.749173045f},
-std::array<float,2>{0.0712905601f, 0.261286467f},
-std::array<float,2>{0.88938725f, 0.622138977f},
-std::array<float,2>{0.689319253f, 0.0394162945f},
-std::array<float,2>{0.250351042f, 0.932568371f},
-std::array<float,2>{0.0363423191f, 0.221580818f},
-std::array<float,2>{0.958431721f, 0.820225298f},
-std::array<float,2>{0.655104458f, 0.400152296f},
-std::array<float,2>{0.337499231f, 0.633060277f},
-std::array<float,2>{0.483531713f, 0.349496812f},
-std::array<float,2>{0.51490587f, 0.549400926f},
-std::array<float,2>{0.843189359f, 0.0718330443f},
-std::array<float,2>{0.126633435f, 0.975865781f},
-std::array<float,2>{0.284921914f, 0.0269965213f},
-std::array<float,2>{0.742387712f, 0.880273581f},
-std::array<float,2>{0.93538481f, 0.300617725f},
-std::array<float,2>{0.100690335f, 0.573405921f},
-std::array<float,2>{0.212517276f, 0.445531934f},
-std::array<float,2>{0.807258964f, 0.694871485f},
-std::array<float,2>{0.620141149f, 0.157852188f},
-std::array<float,2>{0.392715842f, 0.766864479f},
-std::array<float,2>{0.236873418f, 0.181129947f},
-std::array<float,2>{0.760935426f, 0.754938662f},
-std::array<float,2>{0.565828145f, 0.455350161f},
-std::array<float,2>{0.423505515f, 0.716193676f},
-std::array<float,2>{0.280755073f, 0.286112815f},
-std::array<float,2>{0.706009209f, 0.588164568f},
-std::array<float,2>{0.894647419f, 1.82836302e-05f},
-std::array<float,2>{0.0787194297f, 0.902772546f},
-std::array<float,2>{0.464432776f, 0.0890934393f},
-std::array<float,2>{0.531345606f, 0.985592484f},
-std::array<float,2>{0.849002182f, 0.35978967f},
-std::array<float,2>{0.170024857f, 0.534243703f},
-std::array<float,2>{0.00242238771f, 0.380356789f},
-std::array<float,2>{0.969696462f, 0.646830559f},
-std::array<float,2>{0.68607074f, 0.247808382f},
-std::array<float,2>{0.34390372f, 0.834597886f},
-std::array<float,2>{0.115953386f, 0.0495601818f},
-std::array<float,2>{0.921347916f, 0.91670996f},
-std::array<float,2>{0.733524203f, 0.269239545f},
-std::array<float,2>{0.303929955f, 0.605929971f},
-std::array<float,2>{0.382196039f, 0.498053908f},
-std::array<float,2>{0.60365504f, 0.731303155f},
-std::array<float,2>{0.782981575f, 0.131260708f},
-std::array<float,2>{0.191999406f, 0.806193829f},
-std::array<float,2>{0.323482335f, 0.207687095f},
-std::array<float,2>{0.637006283f, 0.85584116f},
-std::array<float,2>{0.948745787f, 0.413044333f},
-std::array<float,2>{0.0539538898f, 0.665200651f},
-std::array<float,2>{0.142524973f, 0.316992611f},
-std::array<float,2>{0.819194078f, 0.506647587f},
-std::array<float,2>{0.525533795f, 0.113439493f},
-std::array<float,2>{0.486010164f, 0.956440628f},
-std::array<float,2>{0.195729375f, 0.0099108899f},
-std::array<float,2>{0.794199526f, 0.89841181f},
-std::array<float,2>{0.594029665f, 0.296188891f},
-std::array<float,2>{0.38449499f, 0.580771029f},
-std::array<float,2>{0.309150189f, 0.46767357f},
-std::array<float,2>{0.718811393f, 0.708455205f},
-std::array<float,2>{0.912350178f, 0.179241627f},
-std::array<float,2>{0.117672868f, 0.759574294f},
-std::array<float,2>{0.498460084f, 0.240061343f},
-std::array<float,2>{0.523324668f, 0.837612748f},
-std::array<float,2>{0.824333012f, 0.383360595f},
-std::array<float,2>{0.151219413f, 0.650294542f},
-std::array<float,2>{0.0601988174f, 0.372573465f},
-std::array<float,2>{0.941062033f, 0.545118511f},
-std::array<float,2>{0.631791055f, 0.0833775252f},
-std::array<float,2>{0.316318095f, 0.999174416f},
-std::array<float,2>{0.0882465914f, 0.132990837f},
-std::array<float,2>{0.904015362f, 0.797404289f},
-std::array<float,2>{0.717813849f, 0.486964524f},
-std::array<float,2>{0.268881649f, 0.718938112f},
-std::array<float,2>{0.434234053f, 0.277397037f},
-std::array<float,2>{0.576078415f, 0.597063899f},
-std::array<float,2>{0.750546098f, 0.057368312f},
-std::array<float,2>{0.249242246f, 0.914009213f},
-std::array<float,2>{0.358651876f, 0.121270441f},
-std::array<float,2>{0.674361646f, 0.965925157f},
-std::array<float,2>{0.98339355f, 0.322154015f},
-std::array<float,2>{0.0134726223f, 0.509708166f},
-std::array<float,2>{0.159201205f, 0.419124424f},
-std::array<float,2>{0.85856396f, 0.664039016f},
-std::array<float,2>{0.540529788f, 0.218206644f},
-std::array<float,2>{0.456841052f, 0.847444236f},
-std::array<float,2>{0.136747465f, 0.18808955f},
-std::array<float,2>{0.828707159f, 0.872456193f},
-std::array<float,2>{0.500170588f, 0.429129362f},
-std::array<float,2>{0.475112945f, 0.671893179f},
-std::array<float,2>{0.335918397f, 0.340598494f},
-std::array<float,2>{0.642804623f, 0.529665112f},
-std::array<float,2>{0.963207603f, 0.0964427441f},
-std::array<float,2>{0.0425835177f, 0.945730269f},
-std::array<float,2>{0.401901215f, 0.0375191942f},
-std::array<float,2>{0.614324212f, 0.929591775f},
-std::array<float,2>{0.79866457f, 0.252744645f},
-std::array<float,2>{0.204808369f, 0.612502217f},
-std::array<float,2>{0.10296765f, 0.471145779f},
-std::array<float,2>{0.923808098f, 0.7402246f},
-std::array<float,2>{0.735486984f, 0.154118478f},
-std::array<float,2>{0.295929193f, 0.78674835f},
-std::array<float,2>{0.0245500654f, 0.0673054382f},
-std::array<float,2>{0.993125558f, 0.978694201f},
-std::array<float,2>{0.66761601f, 0.353585452f},
-std::array<float,2>{0.367680877f, 0.558287442f},
-std::array<float,2>{0.440033138f, 0.392517954f},
-std::array<float,2>{0.548913479f, 0.628902435f},
-std::array<float,2>{0.872280359f, 0.23386997f},
-std::array<float,2>{0.173973233f, 0.821196675f},
-std::array<float,2>{0.258178502f, 0.170459017f},
-std::array<float,2>{0.702225924f, 0.779927075f},
-std::array<float,2>{0.876172662f, 0.440315843f},
-std::array<float,2>{0.0663526282f, 0.702581227f},
-std::array<float,2>{0.223679319f, 0.307745963f},
-std::array<float,2>{0.779024243f, 0.567030787f},
-std::array<float,2>{0.579860508f, 0.0182975475f},
-std::array<float,2>{0.414567173f, 0.885449827f},
-std::array<float,2>{0.233571425f, 0.0794240236f},
-std::array<float,2>{0.769472837f, 0.993857205f},
-std::array<float,2>{0.587419033f, 0.369547814f},
-std::array<float,2>{0.414048821f, 0.541548073f},
-std::array<float,2>{0.256297529f, 0.389702529f},
-std::array<float,2>{0.694555461f, 0.654114783f},
-std::array<float,2>{0.883243978f, 0.236040577f},
-std::array<float,2>{0.0766787902f, 0.841627359f},
-std::array<float,2>{0.449859649f, 0.171953529f},
-std::array<float,2>{0.556527138f, 0.765435338f},
-std::array<float,2>{0.862635374f, 0.462589502f},
-std::array<float,2>{0.186174914f, 0.705723524f},
-std::array<float,2>{0.0202669408f, 0.291914344f},
-std::array<float,2>{0.991960227f, 0.582443714f},
-std::array<float,2>{0.659862876f, 0.0140409824f},
-std::array<float,2>{0.36195296f, 0.893730938f},
-std::array<float,2>{0.0948489681f, 0.214173034f},
-std::array<float,2>{0.930913508f, 0.851290762f},
-std::array<float,2>{0.749924898f, 0.414396882f},
-std::array<float,2>{0.288637698f, 0.657761872f},
-std::array<float,2>{0.394590348f, 0.324818254f},
-std::array<float,2>{0.622107506f, 0.512100637f},
-std::array<float,2>{0.811538339f, 0.120697521f},
-std::array<float,2>{0.217331797f, 0.963412464f},
-std::array<float,2>{0.342598587f, 0.0620934628f},
-std::array<float,2>{0.65059644f, 0.908247352f},
-std::array<float,2>{0.953604341f, 0.273625016f},
-std::array<float,2>{0.0318284295f, 0.598390698f},
-std::array<float,2>{0.129021198f, 0.488916844f},
-std::array<float,2>{0.837207913f, 0.724593997f},
-std::array<float,2>{0.508626878f, 0.139154807f},
-std::array<float,2>{0.477886081f, 0.800822675f},
-std::array<float,2>{0.167873934f, 0.148970023f},
-std::array<float,2>{0.843991995f, 0.7838673f},
-std::array<float,2>{0.538819611f, 0.475800633f},
-std::array<float,2>{0.467397898f, 0.73799783f},
-std::array<float,2>{0.348158747f, 0.257221937f},
-std::array<float,2>{0.681893885f, 0.615415275f},
-std::array<float,2>{0.97275579f, 0.0334253013f},
-std::array<float,2>{0.00510282861f, 0.922764301f},
-std::array<float,2>{0.42707333f, 0.0980188921f},
-std::array<float,2>{0.568559229f, 0.949343026f},
-std::array<float,2>{0.76233238f, 0.336970747f},
-std::array<float,2>{0.238606155f, 0.526635885f},
-std::array<float,2>{0.084126614f, 0.425061107f},
-std::array<float,2>{0.891059101f, 0.676816404f},
-std::array<float,2>{0.710004091f, 0.192849189f},
-std::array<float,2>{0.274610013f, 0.867636502f},
-std::array<float,2>{0.0496436842f, 0.0203847028f},
-std::array<float,2>{0.950267076f, 0.888712466f},
-std::array<float,2>{0.633512676f, 0.311076701f},
-std::array<float,2>{0.3264153f, 0.566348433f},
-std::array<float,2>{0.491017669f, 0.44450745f},
-std::array<float,2>{0.527354598f, 0.699009418f},
-std::array<float,2>{0.816053152f, 0.166613862f},
-std::array<float,2>{0.146100372f, 0.775959551f},
-std::array<float,2>{0.297760576f, 0.228011623f},
-std::array<float,2>{0.729381442f, 0.82631892f},
-std::array<float,2>{0.91614151f, 0.396959484f},
-std::array<float,2>{0.109606296f, 0.631854653f},
-std::array<float,2>{0.190238357f, 0.358631998f},
-std::array<float,2>{0.787956119f, 0.56065309f},
-std::array<float,2>{0.607397199f, 0.0636657178f},
-std::array<float,2>{0.377285451f, 0.981551051f},
-std::array<float,2>{0.156044111f, 0.0440009832f},
-std::array<float,2>{0.823383808f, 0.934358776f},
-std::array<float,2>{0.518744051f, 0.264778316f},
-std::array<float,2>{0.492753178f, 0.620067835f},
-std::array<float,2>{0.317171752f, 0.477434576f},
-std::array<float,2>{0.626634777f, 0.742719412f},
-std::array<float,2>{0.942046583f, 0.142988235f},
-std::array<float,2>{0.0575949885f, 0.792711973f},
-std::array<float,2>{0.387810469f, 0.202900574f},
-std::array<float,2>{0.59925282f, 0.86532408f},
-std::array<float,2>{0.789478302f, 0.433482945f},
-std::array<float,2>{0.201923549f, 0.683117628f},
-std::array<float,2>{0.124604262f, 0.329378486f},
-std::array<float,2>{0.909520626f, 0.519461453f},
-std::array<float,2>{0.726113021f, 0.104153261f},
-std::array<float,2>{0.308048755f, 0.940878272f},
-std::array<float,2>{0.0100345695f, 0.16068998f},
-std::array<float,2>{0.978201449f, 0.770992994f},
-std::array<float,2>{0.675897598f, 0.450295329f},
-std::array<float,2>{0.354446292f, 0.689879596f},
-std::array<float,2>{0.457778931f, 0.302900761f},
-std::array<float,2>{0.545124471f, 0.57733798f},
-std::array<float,2>{0.853087246f, 0.0291067027f},
-std::array<float,2>{0.163008153f, 0.878740072f},
-std::array<float,2>{0.271033376f, 0.0760927871f},
-std::array<float,2>{0.712721229f, 0.971606314f},
-std::array<float,2>{0.901116252f, 0.346369982f},
-std::array<float,2>{0.0915156603f, 0.554348886f},
-std::array<float,2>{0.244704932f, 0.403268665f},
-std::array<float,2>{0.756433904f, 0.636799991f},
-std::array<float,2>{0.574165761f, 0.224361271f},
-std::array<float,2>{0.430932432f, 0.8143906f},
-std::array<float,2>{0.208544075f, 0.244478643f},
-std::array<float,2>{0.803685308f, 0.83055824f},
-std::array<float,2>{0.610800505f, 0.377503663f},
-std::array<float,2>{0.404117882f, 0.643264115f},
-std::array<float,2>{0.290451556f, 0.366144329f},
-std::array<float,2>{0.739042103f, 0.535712481f},
-std::array<float,2>{0.925781429f, 0.0930894315f},
-std::array<float,2>{0.108646862f, 0.98902148f},
-std::array<float,2>{0.469915658f, 0.00753588742f},
-std::array<float,2>{0.506155849f, 0.901946306f},
-std::array<float,2>{0.832063258f, 0.284830153f},
-std::array<float,2>{0.132878914f, 0.59304142f},
-std::array<float,2>{0.043833293f, 0.458305776f},
-std::array<float,2>{0.964978456f, 0.711782992f},
-std::array<float,2>{0.646540225f, 0.185666889f},
-std::array<float,2>{0.329921514f, 0.752007365f},
-std::array<float,2>{0.0689684525f, 0.110227823f},
-std::array<float,2>{0.879883945f, 0.959389269f},
-std::array<float,2>{0.699187696f, 0.316312641f},
-std::array<float,2>{0.265403062f, 0.501783192f},
-std::array<float,2>{0.421833664f, 0.407038838f},
-std::array<float,2>{0.582472384f, 0.669348478f},
-std::array<float,2>{0.773787737f, 0.206078425f},
-std::array<float,2>{0.222463757f, 0.852745175f},
-std::array<float,2>{0.374784023f, 0.127240404f},
-std::array<float,2>{0.66884613f, 0.812310934f},
-std::array<float,2>{0.996669829f, 0.495330632f},
-std::array<float,2>{0.0284004249f, 0.72986567f},
-std::array<float,2>{0.177950099f, 0.270299941f},
-std::array<float,2>{0.868820429f, 0.605437338f},
-std::array<float,2>{0.553443849f, 0.0512409769f},
-std::array<float,2>{0.441883385f, 0.920367837f},
-std::array<float,2>{0.174726844f, 0.0701468438f},
-std::array<float,2>{0.872815549f, 0.977925718f},
-std::array<float,2>{0.549704432f, 0.35176599f},
-std::array<float,2>{0.439834416f, 0.556364f},
-std::array<float,2>{0.367660791f, 0.393152386f},
-std::array<float,2>{0.667148948f, 0.625028849f},
-std::array<float,2>{0.992250025f, 0.231726125f},
-std::array<float,2>{0.0249430947f, 0.823012471f},
-std::array<float,2>{0.414162934f, 0.169474304f},
-std::array<float,2>{0.579356372f, 0.778931975f},
-std::array<float,2>{0.77869904f, 0.438614964f},
-std::array<float,2>{0.22423923f, 0.699794292f},
-std::array<float,2>{0.065825142f, 0.306554496f},
-std::array<float,2>{0.876807213f, 0.569957793f},
-std::array<float,2>{0.702661216f, 0.0163362995f},
-std::array<float,2>{0.258509696f, 0.884377301f},
-std::array<float,2>{0.0421042219f, 0.191053078f},
-std::array<float,2>{0.963506341f, 0.874117076f},
-std::array<float,2>{0.643517852f, 0.427285016f},
-std::array<float,2>{0.335367829f, 0.675103903f},
-std::array<float,2>{0.474689156f, 0.342626035f},
-std::array<float,2>{0.500523627f, 0.528243899f},
-std::array<float,2>{0.828339994f, 0.0946951061f},
-std::array<float,2>{0.137547851f, 0.947359681f},
-std::array<float,2>{0.296713263f, 0.036582455f},
-std::array<float,2>{0.736012101f, 0.926547766f},
-std::array<float,2>{0.923135698f, 0.251795411f},
-std::array<float,2>{0.103029825f, 0.609517097f},
-std::array<float,2>{0.204477534f, 0.469722092f},
-std::array<float,2>{0.798168004f, 0.740320027f},
-std::array<float,2>{0.614891946f, 0.154826775f},
-std::array<float,2>{0.401654959f, 0.788851321f},
-std::array<float,2>{0.249845415f, 0.134908527f},
-std::array<float,2>{0.750469744f, 0.799232364f},
-std::array<float,2>{0.575529814f, 0.484757781f},
-std::array<float,2>{0.434032142f, 0.722243309f},
-std::array<float,2>{0.269112855f, 0.280468941f},
-std::array<float,2>{0.718361259f, 0.59420687f},
-std::array<float,2>{0.903414011f, 0.0547766685f},
-std::array<float,2>{0.088535592f, 0.910653174f},
-std::array<float,2>{0.456517518f, 0.123555064f},
-std::array<float,2>{0.540498137f, 0.967649281f},
-std::array<float,2>{0.859001875f, 0.323952526f},
-std::array<float,2>{0.160076886f, 0.511055529f},
-std::array<float,2>{0.0130376313f, 0.421347052f},
-std::array<float,2>{0.982607484f, 0.660179913f},
-std::array<float,2>{0.674112856f, 0.216010809f},
-std::array<float,2>{0.359342813f, 0.845409453f},
-std::array<float,2>{0.118031681f, 0.00962603651f},
-std::array<float,2>{0.912719429f, 0.895348787f},
-std::array<float,2>{0.719658136f, 0.294664681f},
-std::array<float,2>{0.308691591f, 0.578643501f},
-std::array<float,2>{0.384003103f, 0.465797424f},
-std::array<float,2>{0.594406724f, 0.710411131f},
-std::array<float,2>{0.794582963f, 0.177148089f},
-std::array<float,2>{0.195911512f, 0.76003927f},
-std::array<float,2>{0.315814942f, 0.24148117f},
-std::array<float,2>{0.630946994f, 0.83832866f},
-std::array<float,2>{0.940549076f, 0.386377454f},
-std::array<float,2>{0.0596324876f, 0.65211308f},
-std::array<float,2>{0.150867477f, 0.373888671f},
-std::array<float,2>{0.8250646f, 0.543759942f},
-std::array<float,2>{0.522866488f, 0.0847358406f},
-std::array<float,2>{0.498570442f, 0.997358561f},
-std::array<float,2>{0.191869006f, 0.047919929f},
-std::array<float,2>{0.782413125f, 0.915579796f},
-std::array<float,2>{0.604245186f, 0.267354369f},
-std::array<float,2>{0.382760286f, 0.607626021f},
-std::array<float,2>{0.304576576f, 0.497684747f},
-std::array<float,2>{0.73402065f, 0.732440293f},
-std::array<float,2>{0.921446264f, 0.130430833f},
-std::array<float,2>{0.115476146f, 0.807946503f},
-std::array<float,2>{0.485500336f, 0.209902808f},
-std::array<float,2>{0.525972009f, 0.85766679f},
-std::array<float,2>{0.818379462f, 0.410832822f},
-std::array<float,2>{0.141829446f, 0.667197585f},
-std::array<float,2>{0.0543031879f, 0.319107443f},
-std::array<float,2>{0.948603392f, 0.504107773f},
-std::array<float,2>{0.637446344f, 0.116391577f},
-std::array<float,2>{0.324053466f, 0.954708278f},
-std::array<float,2>{0.0781663656f, 0.182104722f},
-std::array<float,2>{0.895163298f, 0.757130921f},
-std::array<float,2>{0.705520213f, 0.453856736f},
-std::array<float,2>{0.280987382f, 0.717187226f},
-std::array<float,2>{0.42319867f, 0.28748098f},
-std::array<float,2>{0.56620419f, 0.586112142f},
-std::array<float,2>{0.761486053f, 0.00308039458f},
-std::array<float,2>{0.236589849f, 0.905933678f},
-std::array<float,2>{0.344401062f, 0.0867467597f},
-std::array<float,2>{0.685863018f, 0.987677097f},
-std::array<float,2>{0.968883157f, 0.36205408f},
-std::array<float,2>{0.00270582899f, 0.531407177f},
-std::array<float,2>{0.170628846f, 0.381515563f},
-std::array<float,2>{0.849579155f, 0.645276368f},
-std::array<float,2>{0.532150567f, 0.248408064f},
-std::array<float,2>{0.46424365f, 0.832964897f},
-std::array<float,2>{0.126008049f, 0.219009176f},
-std::array<float,2>{0.84338671f, 0.81738019f},
-std::array<float,2>{0.515230477f, 0.4020046f},
-std::array<float,2>{0.48392573f, 0.635768056f},
-std::array<float,2>{0.337012202f, 0.351152748f},
-std::array<float,2>{0.65444994f, 0.54839921f},
-std::array<float,2>{0.958502114f, 0.0741091445f},
-std::array<float,2>{0.0367956199f, 0.973128557f},
-std::array<float,2>{0.393323869f, 0.0246491581f},
-std::array<float,2>{0.620834053f, 0.88220191f},
-std::array<float,2>{0.806887686f, 0.29819122f},
-std::array<float,2>{0.212357298f, 0.570405126f},
-std::array<float,2>{0.101254269f, 0.449154198f},
-std::array<float,2>{0.9349401f, 0.693098903f},
-std::array<float,2>{0.742722511f, 0.158568755f},
-std::array<float,2>{0.284662604f, 0.768275559f},
-std::array<float,2>{0.0161244478f, 0.106218062f},
-std::array<float,2>{0.985761583f, 0.943345904f},
-std::array<float,2>{0.662125349f, 0.334991276f},
-std::array<float,2>{0.364870936f, 0.522042453f},
-std::array<float,2>{0.445886642f, 0.436458319f},
-std::array<float,2>{0.560929716f, 0.687152922f},
-std::array<float,2>{0.866253972f, 0.196641788f},
-std::array<float,2>{0.183498099f, 0.862684608f},
-std::array<float,2>{0.250649631f, 0.147261947f},
-std::array<float,2>{0.688506007f, 0.79646033f},
-std::array<float,2>{0.889037728f, 0.481777877f},
-std::array<float,2>{0.0719080344f, 0.746560156f},
-std::array<float,2>{0.229692087f, 0.259529531f},
-std::array<float,2>{0.769663572f, 0.623240709f},
-std::array<float,2>{0.592947006f, 0.0423114039f},
-std::array<float,2>{0.408147991f, 0.931168556f},
-std::array<float,2>{0.221720874f, 0.112331748f},
-std::array<float,2>{0.773955762f, 0.957837522f},
-std::array<float,2>{0.582572937f, 0.31330952f},
-std::array<float,2>{0.42100364f, 0.501956344f},
-std::array<float,2>{0.264997125f, 0.408844918f},
-std::array<float,2>{0.698435009f, 0.671079695f},
-std::array<float,2>{0.880702674f, 0.20339939f},
-std::array<float,2>{0.06839481f, 0.855324388f},
-std::array<float,2>{0.442350805f, 0.125910521f},
-std::array<float,2>{0.553107798f, 0.809852421f},
-std::array<float,2>{0.868209422f, 0.492278636f},
-std::array<float,2>{0.178461909f, 0.727657735f},
-std::array<float,2>{0.029028371f, 0.271635413f},
-std::array<float,2>{0.996314108f, 0.601631403f},
-std::array<float,2>{0.668278158f, 0.0546262413f},
-std::array<float,2>{0.374132872f, 0.919891298f},
-std::array<float,2>{0.109128438f, 0.243710309f},
-std::array<float,2>{0.926291883f, 0.829089999f},
-std::array<float,2>{0.738655388f, 0.375557035f},
-std::array<float,2>{0.290810883f, 0.64166373f},
-std::array<float,2>{0.403413534f, 0.363472015f},
-std::array<float,2>{0.611293972f, 0.539044619f},
-std::array<float,2>{0.80299896f, 0.0901603922f},
-std::array<float,2>{0.208167464f, 0.991917551f},
-std::array<float,2>{0.329453945f, 0.00459052809f},
-std::array<float,2>{0.647403121f, 0.899752796f},
-std::array<float,2>{0.965649605f, 0.282256186f},
-std::array<float,2>{0.0431831442f, 0.590963721f},
-std::array<float,2>{0.13332741f, 0.460640728f},
-std::array<float,2>{0.832850397f, 0.714507937f},
-std::array<float,2>{0.506719768f, 0.184339732f},
-std::array<float,2>{0.470695376f, 0.751943767f},
-std::array<float,2>{0.162518516f, 0.16323711f},
-std::array<float,2>{0.852751076f, 0.772012115f},
-std::array<float,2>{0.545603991f, 0.452766478f},
-std::array<float,2>{0.457268745f, 0.688323796f},
-std::array<float,2>{0.353537112f, 0.301616251f},
-std::array<float,2>{0.676727831f, 0.575048566f},
-std::array<float,2>{0.977756441f, 0.029500749f},
-std::array<float,2>{0.0103091104f, 0.875535548f},
-std::array<float,2>{0.431253135f, 0.0774008632f},
-std::array<float,2>{0.573524773f, 0.970681489f},
-std::array<float,2>{0.75589478f, 0.344407141f},
-std::array<float,2>{0.244178072f, 0.552713931f},
-std::array<float,2>{0.0909015015f, 0.4051947f},
-std::array<float,2>{0.900781453f, 0.639507353f},
-std::array<float,2>{0.712217212f, 0.225598425f},
-std::array<float,2>{0.270806402f, 0.815871537f},
-std::array<float,2>{0.0569802076f, 0.046113316f},
-std::array<float,2>{0.941470265f, 0.935952604f},
-std::array<float,2>{0.626290143f, 0.263118863f},
-std::array<float,2>{0.316766173f, 0.618840456f},
-std::array<float,2>{0.492446303f, 0.479311496f},
-std::array<float,2>{0.519488752f, 0.74424243f},
-std::array<float,2>{0.823773801f, 0.140905589f},
-std::array<float,2>{0.155339003f, 0.790938139f},
-std::array<float,2>{0.308539361f, 0.200390667f},
-std::array<float,2>{0.725965679f, 0.864435494f},
-std::array<float,2>{0.910117149f, 0.42978856f},
-std::array<float,2>{0.124234609f, 0.681073308f},
-std::array<float,2>{0.201234519f, 0.331539452f},
-std::array<float,2>{0.789783061f, 0.516176403f},
-std::array<float,2>{0.599007308f, 0.101816125f},
-std::array<float,2>{0.388507754f, 0.938710809f},
-std::array<float,2>{0.145882368f, 0.0232019871f},
-std::array<float,2>{0.815561891f, 0.886974394f},
-std::array<float,2>{0.528024256f, 0.309197098f},
-std::array<float,2>{0.490391791f, 0.56290257f},
-std::array<float,2>{0.327014178f, 0.441927224f},
-std::array<float,2>{0.63310343f, 0.697119117f},
-std::array<float,2>{0.950719178f, 0.164162979f},
-std::array<float,2>{0.0491378568f, 0.774808526f},
-std::array<float,2>{0.377548397f, 0.229916945f},
-std::array<float,2>{0.606478631f, 0.825822353f},
-std::array<float,2>{0.787511528f, 0.395426512f},
-std::array<float,2>{0.189496726f, 0.629881203f},
-std::array<float,2>{0.110215925f, 0.356406003f},
-std::array<float,2>{0.916580021f, 0.560365319f},
-std::array<float,2>{0.728638828f, 0.0646362677f},
-std::array<float,2>{0.297292084f, 0.983917236f},
-std::array<float,2>{0.00540793035f, 0.151828483f},
-std::array<float,2>{0.973334551f, 0.783094049f},
-std::array<float,2>{0.682590246f, 0.4728297f},
-std::array<float,2>{0.347961992f, 0.735305667f},
-std::array<float,2>{0.467049628f, 0.254124314f},
-std::array<float,2>{0.538568377f, 0.614334106f},
-std::array<float,2>{0.844541013f, 0.0329504795f},
-std::array<float,2>{0.16732733f, 0.924980879f},
-std::array<float,2>{0.275160998f, 0.100694388f},
-std::array<float,2>{0.710876822f, 0.951521397f},
-std::array<float,2>{0.89143616f, 0.338950515f},
-std::array<float,2>{0.0846688896f, 0.524833083f},
-std::array<float,2>{0.238845527f, 0.422450989f},
-std::array<float,2>{0.761844873f, 0.678224266f},
-std::array<float,2>{0.569202185f, 0.193959057f},
-std::array<float,2>{0.427580386f, 0.870975494f},
-std::array<float,2>{0.216822192f, 0.211008474f},
-std::array<float,2>{0.812200248f, 0.8485865f},
-std::array<float,2>{0.622879088f, 0.416390955f},
-std::array<float,2>{0.39541477f, 0.658928514f},
-std::array<float,2>{0.288483113f, 0.327075899f},
-std::array<float,2>{0.749252915f, 0.513867617f},
-std::array<float,2>{0.931340158f, 0.117598332f},
-std::array<float,2>{0.0954819992f, 0.961932361f},
-std::array<float,2>{0.478310823f, 0.059828911f},
-std::array<float,2>{0.508227885f, 0.906651735f},
-std::array<float,2>{0.837857723f, 0.275746405f},
-std::array<float,2>{0.12939702f, 0.599963605f},
-std::array<float,2>{0.0313456506f, 0.491539717f},
-std::array<float,2>{0.954031587f, 0.724672198f},
-std::array<float,2>{0.650915325f, 0.138537079f},
-std::array<float,2>{0.342009664f, 0.804421246f},
-std::array<float,2>{0.0762894452f, 0.0802286267f},
-std::array<float,2>{0.883466661f, 0.995949566f},
-std::array<float,2>{0.695238769f, 0.368063241f},
-std::array<float,2>{0.256703556f, 0.540415704f},
-std::array<float,2>{0.413544208f, 0.386987388f},
-std::array<float,2>{0.587104261f, 0.655851364f},
-std::array<float,2>{0.768727422f, 0.237405211f},
-std::array<float,2>{0.233980387f, 0.842454851f},
-std::array<float,2>{0.361572266f, 0.175357342f},
-std::array<float,2>{0.659244776f, 0.762058735f},
-std::array<float,2>{0.991605222f, 0.463416219f},
-std::array<float,2>{0.0198314469f, 0.704988956f},
-std::array<float,2>{0.185620472f, 0.289188445f},
-std::array<float,2>{0.863206804f, 0.584975123f},
-std::array<float,2>{0.556107223f, 0.0118319057f},
-std::array<float,2>{0.44964692f, 0.891926527f},
-std::array<float,2>{0.140424892f, 0.095804207f},
-std::array<float,2>{0.83044517f, 0.946085811f},
-std::array<float,2>{0.503199577f, 0.340233803f},
-std::array<float,2>{0.474382281f, 0.530030549f},
-std::array<float,2>{0.333807737f, 0.429416686f},
-std::array<float,2>{0.641966283f, 0.672691405f},
-std::array<float,2>{0.961930096f, 0.187637776f},
-std::array<float,2>{0.0402141623f, 0.872853577f},
-std::array<float,2>{0.400349557f, 0.153437674f},
-std::array<float,2>{0.616956234f, 0.786340356f},
-std::array<float,2>{0.799234509f, 0.471271604f},
-std::array<float,2>{0.20677647f, 0.739515841f},
-std::array<float,2>{0.103953063f, 0.252002031f},
-std::array<float,2>{0.924266875f, 0.613134742f},
-std::array<float,2>{0.736970067f, 0.0379977375f},
-std::array<float,2>{0.293138832f, 0.928966641f},
-std::array<float,2>{0.0258886609f, 0.234338716f},
-std::array<float,2>{0.995992839f, 0.820581734f},
-std::array<float,2>{0.665918291f, 0.39181754f},
-std::array<float,2>{0.369967163f, 0.627991021f},
-std::array<float,2>{0.437554628f, 0.354419708f},
-std::array<float,2>{0.547685444f, 0.557950974f},
-std::array<float,2>{0.873650372f, 0.0666632652f},
-std::array<float,2>{0.173650578f, 0.979371011f},
-std::array<float,2>{0.261675954f, 0.0175975375f},
-std::array<float,2>{0.700585663f, 0.885187864f},
-std::array<float,2>{0.878227115f, 0.308431596f},
-std::array<float,2>{0.0630506203f, 0.566816568f},
-std::array<float,2>{0.225493386f, 0.439474016f},
-std::array<float,2>{0.779830635f, 0.703008115f},
-std::array<float,2>{0.581328034f, 0.170018226f},
-std::array<float,2>{0.417130977f, 0.779663086f},
-std::array<float,2>{0.197971404f, 0.178890601f},
-std::array<float,2>{0.796152472f, 0.759134591f},
-std::array<float,2>{0.597569644f, 0.467025816f},
-std::array<float,2>{0.385591716f, 0.708650529f},
-std::array<float,2>{0.311005831f, 0.296625942f},
-std::array<float,2>{0.72140801f, 0.580211401f},
-std::array<float,2>{0.911035895f, 0.0103005292f},
-std::array<float,2>{0.1206237f, 0.897740245f},
-std::array<float,2>{0.49709323f, 0.0839594081f},
-std::array<float,2>{0.520406842f, 0.999656558f},
-std::array<float,2>{0.826365769f, 0.372412682f},
-std::array<float,2>{0.14903836f, 0.54572165f},
-std::array<float,2>{0.0607188419f, 0.383108288f},
-std::array<float,2>{0.938457608f, 0.649610817f},
-std::array<float,2>{0.62897706f, 0.23954083f},
-std::array<float,2>{0.312679321f, 0.837098539f},
-std::array<float,2>{0.0863424093f, 0.056957636f},
-std::array<float,2>{0.905410886f, 0.913325667f},
-std::array<float,2>{0.716143847f, 0.277993739f},
-std::array<float,2>{0.266021669f, 0.597544134f},
-std::array<float,2>{0.436819702f, 0.486786842f},
-std::array<float,2>{0.577461362f, 0.719672143f},
-std::array<float,2>{0.753875256f, 0.13359271f},
-std::array<float,2>{0.246265128f, 0.797249198f},
-std::array<float,2>{0.356507748f, 0.218327776f},
-std::array<float,2>{0.672598302f, 0.847137034f},
-std::array<float,2>{0.981173038f, 0.419678181f},
-std::array<float,2>{0.0139683578f, 0.663265049f},
-std::array<float,2>{0.156758159f, 0.321431726f},
-std::array<float,2>{0.856080294f, 0.50899595f},
-std::array<float,2>{0.541624367f, 0.121910475f},
-std::array<float,2>{0.453281879f, 0.966452241f},
-std::array<float,2>{0.234925672f, 0.000608559756f},
-std::array<float,2>{0.759564579f, 0.902895212f},
-std::array<float,2>{0.562946856f, 0.28560999f},
-std::array<float,2>{0.424198717f, 0.588772833f},
-std::array<float,2>{0.277529269f, 0.455663502f},
-std::array<float,2>{0.704960048f, 0.716570139f},
-std::array<float,2>{0.89759016f, 0.181365833f},
-std::array<float,2>{0.0808091238f, 0.755418122f},
-std::array<float,2>{0.462400854f, 0.247200549f},
-std::array<float,2>{0.533969641f, 0.834390104f},
-std::array<float,2>{0.849622369f, 0.380626649f},
-std::array<float,2>{0.16912879f, 0.647051573f},
-std::array<float,2>{0.0011996571f, 0.359985054f},
-std::array<float,2>{0.972577155f, 0.534985185f},
-std::array<float,2>{0.684256852f, 0.0896748453f},
-std::array<float,2>{0.346090972f, 0.986093521f},
-std::array<float,2>{0.113914788f, 0.131496578f},
-std::array<float,2>{0.918143749f, 0.805866539f},
-std::array<float,2>{0.731463671f, 0.498768389f},
-std::array<float,2>{0.302447647f, 0.73059988f},
-std::array<float,2>{0.380247325f, 0.268754303f},
-std::array<float,2>{0.602109551f, 0.606215835f},
-std::array<float,2>{0.783313453f, 0.0490767993f},
-std::array<float,2>{0.193480268f, 0.916383743f},
-std::array<float,2>{0.320548773f, 0.113974534f},
-std::array<float,2>{0.640288413f, 0.95680964f},
-std::array<float,2>{0.94633919f, 0.316426724f},
-std::array<float,2>{0.0517097414f, 0.506218374f},
-std::array<float,2>{0.143643633f, 0.412412047f},
-std::array<float,2>{0.817630589f, 0.665849805f},
-std::array<float,2>{0.52396667f, 0.207186684f},
-std::array<float,2>{0.487461776f, 0.855977774f},
-std::array<float,2>{0.179836333f, 0.199121848f},
-std::array<float,2>{0.864361644f, 0.860170782f},
-std::array<float,2>{0.559310853f, 0.434765577f},
-std::array<float,2>{0.448492706f, 0.684318066f},
-std::array<float,2>{0.365349174f, 0.332455993f},
-std::array<float,2>{0.66069448f, 0.519956589f},
-std::array<float,2>{0.986871779f, 0.10883265f},
-std::array<float,2>{0.0185897686f, 0.944490314f},
-std::array<float,2>{0.409288704f, 0.039566718f},
-std::array<float,2>{0.591696024f, 0.931751728f},
-std::array<float,2>{0.77330178f, 0.260984749f},
-std::array<float,2>{0.226570174f, 0.622723818f},
-std::array<float,2>{0.0730429217f, 0.482744187f},
-std::array<float,2>{0.887800336f, 0.74984628f},
-std::array<float,2>{0.690526128f, 0.145199537f},
-std::array<float,2>{0.252620131f, 0.794387698f},
-std::array<float,2>{0.0378799997f, 0.0714787468f},
-std::array<float,2>{0.960577369f, 0.976432979f},
-std::array<float,2>{0.653477907f, 0.348658919f},
-std::array<float,2>{0.339253396f, 0.548943639f},
-std::array<float,2>{0.481118441f, 0.399819493f},
-std::array<float,2>{0.512995362f, 0.633610547f},
-std::array<float,2>{0.841008306f, 0.220723823f},
-std::array<float,2>{0.128396496f, 0.819494069f},
-std::array<float,2>{0.28173086f, 0.157515794f},
-std::array<float,2>{0.745581806f, 0.767314792f},
-std::array<float,2>{0.935988247f, 0.445941687f},
-std::array<float,2>{0.0985230505f, 0.694521666f},
-std::array<float,2>{0.212988928f, 0.300192207f},
-std::array<float,2>{0.805580735f, 0.57381767f},
-std::array<float,2>{0.618626118f, 0.0265543833f},
-std::array<float,2>{0.390936017f, 0.880740941f},
-std::array<float,2>{0.210074648f, 0.0933814943f},
-std::array<float,2>{0.802599788f, 0.988589883f},
-std::array<float,2>{0.612544775f, 0.365594059f},
-std::array<float,2>{0.405132622f, 0.535385907f},
-std::array<float,2>{0.291897565f, 0.376966208f},
-std::array<float,2>{0.741227508f, 0.642862022f},
-std::array<float,2>{0.929479599f, 0.244793385f},
-std::array<float,2>{0.107350655f, 0.830765426f},
-std::array<float,2>{0.471670121f, 0.18621704f},
-std::array<float,2>{0.503979027f, 0.752888501f},
-std::array<float,2>{0.835627794f, 0.45851025f},
-std::array<float,2>{0.13641189f, 0.711050451f},
-std::array<float,2>{0.0460208803f, 0.284261048f},
-std::array<float,2>{0.967439294f, 0.593741596f},
-std::array<float,2>{0.645716608f, 0.00699706189f},
-std::array<float,2>{0.330597848f, 0.9013744f},
-std::array<float,2>{0.0675439164f, 0.207003072f},
-std::array<float,2>{0.881958842f, 0.853183508f},
-std::array<float,2>{0.69703424f, 0.406735033f},
-std::array<float,2>{0.263379544f, 0.669588447f},
-std::array<float,2>{0.419198573f, 0.315505266f},
-std::array<float,2>{0.584560156f, 0.501156628f},
-std::array<float,2>{0.775951266f, 0.109648123f},
-std::array<float,2>{0.220411196f, 0.959786832f},
-std::array<float,2>{0.372814626f, 0.0515586324f},
-std::array<float,2>{0.670664847f, 0.920771003f},
-std::array<float,2>{0.998054802f, 0.269700229f},
-std::array<float,2>{0.0304120332f, 0.60475868f},
-std::array<float,2>{0.176091373f, 0.495997071f},
-std::array<float,2>{0.869281948f, 0.730296671f},
-std::array<float,2>{0.550908148f, 0.127839655f},
-std::array<float,2>{0.444326729f, 0.811834276f},
-std::array<float,2>{0.153518885f, 0.143379822f},
-std::array<float,2>{0.821011007f, 0.792120457f},
-std::array<float,2>{0.516141534f, 0.476658136f},
-std::array<float,2>{0.49545753f, 0.742297173f},
-std::array<float,2>{0.318499297f, 0.265149266f},
-std::array<float,2>{0.627120554f, 0.619585931f},
-std::array<float,2>{0.943650126f, 0.0445220359f},
-std::array<float,2>{0.0558764562f, 0.933858991f},
-std::array<float,2>{0.390394479f, 0.103532426f},
-std::array<float,2>{0.601419032f, 0.941356897f},
-std::array<float,2>{0.791975617f, 0.329905182f},
-std::array<float,2>{0.199427649f, 0.518926561f},
-std::array<float,2>{0.121825039f, 0.432944059f},
-std::array<float,2>{0.907647491f, 0.682748854f},
-std::array<float,2>{0.723372817f, 0.202488974f},
-std::array<float,2>{0.305911243f, 0.866021395f},
-std::array<float,2>{0.00864457339f, 0.0283851456f},
-std::array<float,2>{0.978647351f, 0.87814796f},
-std::array<float,2>{0.677972555f, 0.303537488f},
-std::array<float,2>{0.351726502f, 0.577663422f},
-std::array<float,2>{0.460175812f, 0.450801909f},
-std::array<float,2>{0.544010758f, 0.690330267f},
-std::array<float,2>{0.854017258f, 0.160528243f},
-std::array<float,2>{0.160955533f, 0.771259546f},
-std::array<float,2>{0.272083163f, 0.223994628f},
-std::array<float,2>{0.713487864f, 0.813590467f},
-std::array<float,2>{0.899820924f, 0.402803719f},
-std::array<float,2>{0.0925354436f, 0.637351453f},
-std::array<float,2>{0.24413985f, 0.345958889f},
-std::array<float,2>{0.753970921f, 0.55405575f},
-std::array<float,2>{0.571026564f, 0.0752501637f},
-std::array<float,2>{0.43309921f, 0.971140742f},
-std::array<float,2>{0.164749563f, 0.0337066688f},
-std::array<float,2>{0.847641647f, 0.921952367f},
-std::array<float,2>{0.536766112f, 0.257383198f},
-std::array<float,2>{0.465540051f, 0.615924418f},
-std::array<float,2>{0.35006544f, 0.476332545f},
-std::array<float,2>{0.681605101f, 0.737734973f},
-std::array<float,2>{0.975322127f, 0.148663104f},
-std::array<float,2>{0.00690988824f, 0.78334409f},
-std::array<float,2>{0.429454952f, 0.19302927f},
-std::array<float,2>{0.568259001f, 0.867897451f},
-std::array<float,2>{0.765545964f, 0.42548719f},
-std::array<float,2>{0.24197726f, 0.677261233f},
-std::array<float,2>{0.0831956267f, 0.337680817f},
-std::array<float,2>{0.892984629f, 0.527181923f},
-std::array<float,2>{0.707231998f, 0.0983681381f},
-std::array<float,2>{0.275864542f, 0.950102806f},
-std::array<float,2>{0.0480693877f, 0.166362762f},
-std::array<float,2>{0.951216042f, 0.775463164f},
-std::array<float,2>{0.63567692f, 0.444901496f},
-std::array<float,2>{0.325604051f, 0.698600411f},
-std::array<float,2>{0.488753587f, 0.310709983f},
-std::array<float,2>{0.530798078f, 0.565709949f},
-std::array<float,2>{0.814380229f, 0.0199533217f},
-std::array<float,2>{0.148230061f, 0.889609039f},
-std::array<float,2>{0.299744457f, 0.0641339943f},
-std::array<float,2>{0.727307141f, 0.982248127f},
-std::array<float,2>{0.915801346f, 0.358895034f},
-std::array<float,2>{0.111810021f, 0.56140095f},
-std::array<float,2>{0.18849057f, 0.397269249f},
-std::array<float,2>{0.785295665f, 0.632595122f},
-std::array<float,2>{0.609325647f, 0.228227586f},
-std::array<float,2>{0.375622213f, 0.826941371f},
-std::array<float,2>{0.232212096f, 0.235731304f},
-std::array<float,2>{0.766400516f, 0.841100335f},
-std::array<float,2>{0.5885759f, 0.39060697f},
-std::array<float,2>{0.411450028f, 0.653353274f},
-std::array<float,2>{0.255271912f, 0.369974613f},
-std::array<float,2>{0.693045378f, 0.541129827f},
-std::array<float,2>{0.88620019f, 0.0800426081f},
-std::array<float,2>{0.075717628f, 0.993631303f},
-std::array<float,2>{0.452873826f, 0.0142799243f},
-std::array<float,2>{0.557001293f, 0.894159019f},
-std::array<float,2>{0.860854447f, 0.291336805f},
-std::array<float,2>{0.184320286f, 0.582531333f},
-std::array<float,2>{0.0221435633f, 0.461997688f},
-std::array<float,2>{0.989932835f, 0.705271304f},
-std::array<float,2>{0.657389939f, 0.172840536f},
-std::array<float,2>{0.360029906f, 0.765124142f},
-std::array<float,2>{0.096392639f, 0.120577782f},
-std::array<float,2>{0.932344913f, 0.963089764f},
-std::array<float,2>{0.748044789f, 0.324242622f},
-std::array<float,2>{0.285546035f, 0.512370408f},
-std::array<float,2>{0.398289502f, 0.414788544f},
-std::array<float,2>{0.624145508f, 0.657479167f},
-std::array<float,2>{0.808715522f, 0.214810863f},
-std::array<float,2>{0.215909153f, 0.850654662f},
-std::array<float,2>{0.34032777f, 0.139567167f},
-std::array<float,2>{0.648700595f, 0.801548481f},
-std::array<float,2>{0.95690614f, 0.488604337f},
-std::array<float,2>{0.0350756533f, 0.72398293f},
-std::array<float,2>{0.131981522f, 0.27417773f},
-std::array<float,2>{0.839196384f, 0.598010838f},
-std::array<float,2>{0.510975361f, 0.0619475842f},
-std::array<float,2>{0.479492486f, 0.909161448f},
-std::array<float,2>{0.149453163f, 0.0852019265f},
-std::array<float,2>{0.827718258f, 0.99651742f},
-std::array<float,2>{0.521374345f, 0.374622345f},
-std::array<float,2>{0.496967167f, 0.544194818f},
-std::array<float,2>{0.314186662f, 0.385447145f},
-std::array<float,2>{0.630800128f, 0.651151955f},
-std::array<float,2>{0.939356089f, 0.241066545f},
-std::array<float,2>{0.0621360429f, 0.838976383f},
-std::array<float,2>{0.386615843f, 0.176065624f},
-std::array<float,2>{0.59653163f, 0.761255145f},
-std::array<float,2>{0.795661151f, 0.466362715f},
-std::array<float,2>{0.199199229f, 0.709799826f},
-std::array<float,2>{0.119736142f, 0.293008953f},
-std::array<float,2>{0.911443293f, 0.579781711f},
-std::array<float,2>{0.722109079f, 0.00826034416f},
-std::array<float,2>{0.312391073f, 0.895842671f},
-std::array<float,2>{0.0151023129f, 0.215650275f},
-std::array<float,2>{0.982310653f, 0.844388723f},
-std::array<float,2>{0.673543394f, 0.420153052f},
-std::array<float,2>{0.356247306f, 0.661922514f},
-std::array<float,2>{0.454837561f, 0.322541535f},
-std::array<float,2>{0.542113125f, 0.510408223f},
-std::array<float,2>{0.857355416f, 0.124366246f},
-std::array<float,2>{0.157628685f, 0.967954516f},
-std::array<float,2>{0.26664865f, 0.0564035699f},
-std::array<float,2>{0.715727329f, 0.911633551f},
-std::array<float,2>{0.90501374f, 0.279737025f},
-std::array<float,2>{0.0876109153f, 0.595187545f},
-std::array<float,2>{0.247119218f, 0.486063182f},
-std::array<float,2>{0.75281322f, 0.721320391f},
-std::array<float,2>{0.576943159f, 0.136105791f},
-std::array<float,2>{0.435675055f, 0.799985707f},
-std::array<float,2>{0.205128059f, 0.156035483f},
-std::array<float,2>{0.800450087f, 0.787741303f},
-std::array<float,2>{0.615640461f, 0.469770432f},
-std::array<float,2>{0.398547024f, 0.741531372f},
-std::array<float,2>{0.294340163f, 0.250430584f},
-std::array<float,2>{0.737668395f, 0.61109674f},
-std::array<float,2>{0.925000012f, 0.0358630903f},
-std::array<float,2>{0.104668736f, 0.927673221f},
-std::array<float,2>{0.473375052f, 0.094759278f},
-std::array<float,2>{0.501973331f, 0.948493421f},
-std::array<float,2>{0.831579268f, 0.343688905f},
-std::array<float,2>{0.138890699f, 0.529280066f},
-std::array<float,2>{0.0398017243f, 0.426241785f},
-std::array<float,2>{0.961763918f, 0.674651563f},
-std::array<float,2>{0.640740633f, 0.189850897f},
-std::array<float,2>{0.332642138f, 0.873634338f},
-std::array<float,2>{0.0637064427f, 0.0167183038f},
-std::array<float,2>{0.877924502f, 0.883563697f},
-std::array<float,2>{0.699972868f, 0.304834723f},
-std::array<float,2>{0.260265499f, 0.569285572f},
-std::array<float,2>{0.41637674f, 0.437553704f},
-std::array<float,2>{0.580600202f, 0.700515747f},
-std::array<float,2>{0.781144381f, 0.168924674f},
-std::array<float,2>{0.226114154f, 0.778308809f},
-std::array<float,2>{0.37061733f, 0.230850697f},
-std::array<float,2>{0.664538443f, 0.823362589f},
-std::array<float,2>{0.994412601f, 0.394194543f},
-std::array<float,2>{0.0265816208f, 0.626519442f},
-std::array<float,2>{0.172811568f, 0.352792382f},
-std::array<float,2>{0.87409687f, 0.554926634f},
-std::array<float,2>{0.548529029f, 0.0690749064f},
-std::array<float,2>{0.438798517f, 0.976924121f},
-std::array<float,2>{0.228424698f, 0.0416956916f},
-std::array<float,2>{0.771765471f, 0.930199087f},
-std::array<float,2>{0.590250254f, 0.258009583f},
-std::array<float,2>{0.408929467f, 0.624425888f},
-std::array<float,2>{0.25329268f, 0.480998874f},
-std::array<float,2>{0.689787149f, 0.747580528f},
-std::array<float,2>{0.887489676f, 0.148308292f},
-std::array<float,2>{0.0740244314f, 0.795339704f},
-std::array<float,2>{0.447507858f, 0.195837289f},
-std::array<float,2>{0.560235441f, 0.861982465f},
-std::array<float,2>{0.863402247f, 0.43733415f},
-std::array<float,2>{0.181462124f, 0.685746014f},
-std::array<float,2>{0.0179562643f, 0.333994269f},
-std::array<float,2>{0.987318397f, 0.52332139f},
-std::array<float,2>{0.662054479f, 0.107352227f},
-std::array<float,2>{0.366249532f, 0.941924512f},
-std::array<float,2>{0.0995115787f, 0.159538254f},
-std::array<float,2>{0.93691045f, 0.768647313f},
-std::array<float,2>{0.744874477f, 0.447578609f},
-std::array<float,2>{0.282279998f, 0.691698968f},
-std::array<float,2>{0.391937852f, 0.297074258f},
-std::array<float,2>{0.617680728f, 0.571983099f},
-std::array<float,2>{0.805721104f, 0.0240035001f},
-std::array<float,2>{0.214297771f, 0.881384492f},
-std::array<float,2>{0.338210672f, 0.073150143f},
-std::array<float,2>{0.652412176f, 0.973955095f},
-std::array<float,2>{0.959621072f, 0.350348741f},
-std::array<float,2>{0.0382255018f, 0.547536433f},
-std::array<float,2>{0.127835497f, 0.401275933f},
-std::array<float,2>{0.840508223f, 0.634960532f},
-std::array<float,2>{0.512079775f, 0.21973446f},
-std::array<float,2>{0.481997371f, 0.817764878f},
-std::array<float,2>{0.168211862f, 0.249645948f},
-std::array<float,2>{0.851276875f, 0.833112121f},
-std::array<float,2>{0.534983337f, 0.382380813f},
-std::array<float,2>{0.461173743f, 0.646322489f},
-std::array<float,2>{0.347210974f, 0.362504333f},
-std::array<float,2>{0.684637606f, 0.532272875f},
-std::array<float,2>{0.971369922f, 0.0873177722f},
-std::array<float,2>{0.000492475927f, 0.986490726f},
-std::array<float,2>{0.425115764f, 0.0028807607f},
-std::array<float,2>{0.564167917f, 0.904857218f},
-std::array<float,2>{0.758193612f, 0.288190484f},
-std::array<float,2>{0.236108989f, 0.587317467f},
-std::array<float,2>{0.0819089189f, 0.454324126f},
-std::array<float,2>{0.896610558f, 0.717981935f},
-std::array<float,2>{0.703333199f, 0.182998583f},
-std::array<float,2>{0.278844923f, 0.756364286f},
-std::array<float,2>{0.0524515882f, 0.116011314f},
-std::array<float,2>{0.946221471f, 0.953614056f},
-std::array<float,2>{0.639421642f, 0.320000678f},
-std::array<float,2>{0.321799785f, 0.505813181f},
-std::array<float,2>{0.486338496f, 0.41176039f},
-std::array<float,2>{0.524675667f, 0.666136384f},
-std::array<float,2>{0.817378998f, 0.210708156f},
-std::array<float,2>{0.143295988f, 0.859038651f},
-std::array<float,2>{0.300995588f, 0.129800364f},
-std::array<float,2>{0.730612874f, 0.80689317f},
-std::array<float,2>{0.919128418f, 0.496121287f},
-std::array<float,2>{0.114901938f, 0.733413219f},
-std::array<float,2>{0.194870055f, 0.265627116f},
-std::array<float,2>{0.784942627f, 0.608754039f},
-std::array<float,2>{0.603089929f, 0.047472205f},
-std::array<float,2>{0.379684716f, 0.914946616f},
-std::array<float,2>{0.200914726f, 0.103151761f},
-std::array<float,2>{0.792012811f, 0.937776804f},
-std::array<float,2>{0.599978149f, 0.330474526f},
-std::array<float,2>{0.389246315f, 0.517557561f},
-std::array<float,2>{0.305472314f, 0.431254417f},
-std::array<float,2>{0.724432468f, 0.68015641f},
-std::array<float,2>{0.906984031f, 0.199394226f},
-std::array<float,2>{0.122950196f, 0.863741994f},
-std::array<float,2>{0.494298041f, 0.142321587f},
-std::array<float,2>{0.517120719f, 0.789141417f},
-std::array<float,2>{0.822164536f, 0.479735881f},
-std::array<float,2>{0.152729735f, 0.745420158f},
-std::array<float,2>{0.0554072522f, 0.262648672f},
-std::array<float,2>{0.944467485f, 0.617760301f},
-std::array<float,2>{0.628261685f, 0.0455871113f},
-std::array<float,2>{0.319388658f, 0.937339008f},
-std::array<float,2>{0.092907317f, 0.225143641f},
-std::array<float,2>{0.899270833f, 0.814660966f},
-std::array<float,2>{0.714542568f, 0.405551791f},
-std::array<float,2>{0.272990286f, 0.639903784f},
-std::array<float,2>{0.432132065f, 0.345453531f},
-std::array<float,2>{0.571635723f, 0.551281989f},
-std::array<float,2>{0.755422175f, 0.0764497221f},
-std::array<float,2>{0.2429827f, 0.969337881f},
-std::array<float,2>{0.352785289f, 0.0309679136f},
-std::array<float,2>{0.67916584f, 0.876405835f},
-std::array<float,2>{0.980451405f, 0.302059561f},
-std::array<float,2>{0.00930893794f, 0.575728476f},
-std::array<float,2>{0.161540002f, 0.451425254f},
-std::array<float,2>{0.854660928f, 0.688940346f},
-std::array<float,2>{0.543144882f, 0.162330687f},
-std::array<float,2>{0.459847242f, 0.772795558f},
-std::array<float,2>{0.135295063f, 0.185168132f},
-std::array<float,2>{0.83493036f, 0.750199497f},
-std::array<float,2>{0.504992306f, 0.459524959f},
-std::array<float,2>{0.472160339f, 0.713459373f},
-std::array<float,2>{0.331231534f, 0.281404525f},
-std::array<float,2>{0.645284951f, 0.589866459f},
-std::array<float,2>{0.968089223f, 0.00578833884f},
-std::array<float,2>{0.0454213209f, 0.899361074f},
-std::array<float,2>{0.406247884f, 0.0908619836f},
-std::array<float,2>{0.611660957f, 0.990393341f},
-std::array<float,2>{0.801058412f, 0.365008682f},
-std::array<float,2>{0.209380135f, 0.537736952f},
-std::array<float,2>{0.106345706f, 0.376844347f},
-std::array<float,2>{0.928406537f, 0.640648484f},
-std::array<float,2>{0.740608454f, 0.243091822f},
-std::array<float,2>{0.292833418f, 0.829186261f},
-std::array<float,2>{0.0296767745f, 0.053575635f},
-std::array<float,2>{0.999028265f, 0.918024063f},
-std::array<float,2>{0.671421289f, 0.272549659f},
-std::array<float,2>{0.371564716f, 0.603432953f},
-std::array<float,2>{0.445099145f, 0.493704826f},
-std::array<float,2>{0.551769614f, 0.726827443f},
-std::array<float,2>{0.870533705f, 0.126606926f},
-std::array<float,2>{0.177307829f, 0.808665693f},
-std::array<float,2>{0.262067109f, 0.204483762f},
-std::array<float,2>{0.696142912f, 0.854367018f},
-std::array<float,2>{0.880868375f, 0.409849316f},
-std::array<float,2>{0.0665509552f, 0.670251548f},
-std::array<float,2>{0.219199181f, 0.313970268f},
-std::array<float,2>{0.77709502f, 0.503360152f},
-std::array<float,2>{0.58592099f, 0.111737825f},
-std::array<float,2>{0.418769091f, 0.958968759f},
-std::array<float,2>{0.18516992f, 0.0132576823f},
-std::array<float,2>{0.86005652f, 0.891429663f},
-std::array<float,2>{0.558225513f, 0.290471673f},
-std::array<float,2>{0.451543301f, 0.584199429f},
-std::array<float,2>{0.360711277f, 0.46466589f},
-std::array<float,2>{0.656883299f, 0.703877449f},
-std::array<float,2>{0.988530815f, 0.174800128f},
-std::array<float,2>{0.0227243751f, 0.76351589f},
-std::array<float,2>{0.410381556f, 0.236449659f},
-std::array<float,2>{0.589736462f, 0.843296409f},
-std::array<float,2>{0.76736176f, 0.388424218f},
-std::array<float,2>{0.230809003f, 0.654954612f},
-std::array<float,2>{0.0748815984f, 0.36882636f},
-std::array<float,2>{0.885125816f, 0.539278507f},
-std::array<float,2>{0.69199568f, 0.0814398229f},
-std::array<float,2>{0.254831463f, 0.994334102f},
-std::array<float,2>{0.0341286846f, 0.136858314f},
-std::array<float,2>{0.955380201f, 0.803117752f},
-std::array<float,2>{0.649561405f, 0.490298331f},
-std::array<float,2>{0.341384917f, 0.726384103f},
-std::array<float,2>{0.479052454f, 0.276974469f},
-std::array<float,2>{0.510214567f, 0.600981772f},
-std::array<float,2>{0.837960601f, 0.0587932914f},
-std::array<float,2>{0.130961001f, 0.907911539f},
-std::array<float,2>{0.286670536f, 0.118940063f},
-std::array<float,2>{0.746318936f, 0.961172581f},
-std::array<float,2>{0.932802975f, 0.327992052f},
-std::array<float,2>{0.0969801992f, 0.514811158f},
-std::array<float,2>{0.215506643f, 0.417385697f},
-std::array<float,2>{0.80970186f, 0.660149872f},
-std::array<float,2>{0.623475254f, 0.212107018f},
-std::array<float,2>{0.396602809f, 0.848892093f},
-std::array<float,2>{0.241083652f, 0.19463636f},
-std::array<float,2>{0.763701916f, 0.869422555f},
-std::array<float,2>{0.566748619f, 0.423389882f},
-std::array<float,2>{0.428384334f, 0.679326713f},
-std::array<float,2>{0.276775599f, 0.338344336f},
-std::array<float,2>{0.708981156f, 0.524254441f},
-std::array<float,2>{0.893809557f, 0.100079864f},
-std::array<float,2>{0.0828398764f, 0.952396929f},
-std::array<float,2>{0.466143459f, 0.0314094983f},
-std::array<float,2>{0.535950541f, 0.924637854f},
-std::array<float,2>{0.846168637f, 0.255852908f},
-std::array<float,2>{0.165356264f, 0.613551736f},
-std::array<float,2>{0.00628023641f, 0.473983735f},
-std::array<float,2>{0.975972295f, 0.735719979f},
-std::array<float,2>{0.679786682f, 0.151266113f},
-std::array<float,2>{0.350837946f, 0.7812621f},
-std::array<float,2>{0.113005616f, 0.0663889423f},
-std::array<float,2>{0.914646804f, 0.9832142f},
-std::array<float,2>{0.727689624f, 0.356489986f},
-std::array<float,2>{0.299948871f, 0.559152901f},
-std::array<float,2>{0.376600981f, 0.395882219f},
-std::array<float,2>{0.607794881f, 0.630430162f},
-std::array<float,2>{0.787074506f, 0.228650659f},
-std::array<float,2>{0.187599704f, 0.824673474f},
-std::array<float,2>{0.324431777f, 0.165453151f},
-std::array<float,2>{0.636536658f, 0.774124861f},
-std::array<float,2>{0.952888906f, 0.442740291f},
-std::array<float,2>{0.0478166677f, 0.695374787f},
-std::array<float,2>{0.1465763f, 0.310459137f},
-std::array<float,2>{0.812773347f, 0.564256132f},
-std::array<float,2>{0.530043125f, 0.022150185f},
-std::array<float,2>{0.489878088f, 0.88838917f},
-std::array<float,2>{0.158600569f, 0.122485824f},
-std::array<float,2>{0.858161569f, 0.964869678f},
-std::array<float,2>{0.539583802f, 0.321254283f},
-std::array<float,2>{0.455541581f, 0.508194089f},
-std::array<float,2>{0.357436597f, 0.417986959f},
-std::array<float,2>{0.675713539f, 0.662498176f},
-std::array<float,2>{0.984298825f, 0.217330083f},
-std::array<float,2>{0.0125822667f, 0.845705271f},
-std::array<float,2>{0.435100555f, 0.134326965f},
-std::array<float,2>{0.575005889f, 0.798152089f},
-std::array<float,2>{0.751017153f, 0.488024473f},
-std::array<float,2>{0.248516649f, 0.720411897f},
-std::array<float,2>{0.0889747292f, 0.27894941f},
-std::array<float,2>{0.903056145f, 0.595890343f},
-std::array<float,2>{0.717030227f, 0.0585260503f},
-std::array<float,2>{0.26781708f, 0.912162244f},
-std::array<float,2>{0.0587069392f, 0.238595873f},
-std::array<float,2>{0.94031179f, 0.836035669f},
-std::array<float,2>{0.63273412f, 0.38470304f},
-std::array<float,2>{0.314966619f, 0.648653269f},
-std::array<float,2>{0.499150187f, 0.37197274f},
-std::array<float,2>{0.522266209f, 0.546003878f},
-std::array<float,2>{0.826129079f, 0.0825761855f},
-std::array<float,2>{0.151514634f, 0.998506367f},
-std::array<float,2>{0.309874117f, 0.011601395f},
-std::array<float,2>{0.720699191f, 0.896840096f},
-std::array<float,2>{0.913510442f, 0.295794785f},
-std::array<float,2>{0.118183598f, 0.581483781f},
-std::array<float,2>{0.196667045f, 0.468557984f},
-std::array<float,2>{0.793167651f, 0.707585931f},
-std::array<float,2>{0.59560442f, 0.178207189f},
-std::array<float,2>{0.38305667f, 0.7582165f},
-std::array<float,2>{0.222895116f, 0.17156741f},
-std::array<float,2>{0.777919531f, 0.78059274f},
-std::array<float,2>{0.579046071f, 0.441131234f},
-std::array<float,2>{0.415095776f, 0.701424658f},
-std::array<float,2>{0.25926441f, 0.307085425f},
-std::array<float,2>{0.70181483f, 0.567800999f},
-std::array<float,2>{0.875726759f, 0.0186023377f},
-std::array<float,2>{0.0646118149f, 0.886515379f},
-std::array<float,2>{0.441134691f, 0.0676046535f},
-std::array<float,2>{0.549864888f, 0.980263591f},
-std::array<float,2>{0.871827543f, 0.354565918f},
-std::array<float,2>{0.175719768f, 0.557216823f},
-std::array<float,2>{0.0240964219f, 0.39125073f},
-std::array<float,2>{0.993778646f, 0.627753437f},
-std::array<float,2>{0.666349828f, 0.232844904f},
-std::array<float,2>{0.36903432f, 0.821407557f},
-std::array<float,2>{0.102119207f, 0.0383098871f},
-std::array<float,2>{0.922328353f, 0.928424537f},
-std::array<float,2>{0.734416723f, 0.253084838f},
-std::array<float,2>{0.295821697f, 0.611427426f},
-std::array<float,2>{0.400995553f, 0.472107172f},
-std::array<float,2>{0.613795698f, 0.738443315f},
-std::array<float,2>{0.797251225f, 0.152676851f},
-std::array<float,2>{0.203554004f, 0.785452485f},
-std::array<float,2>{0.334560186f, 0.1893958f},
-std::array<float,2>{0.644354761f, 0.871510506f},
-std::array<float,2>{0.964136243f, 0.428432137f},
-std::array<float,2>{0.0419007614f, 0.673033655f},
-std::array<float,2>{0.13830483f, 0.341145515f},
-std::array<float,2>{0.829617202f, 0.530646324f},
-std::array<float,2>{0.501162469f, 0.097008802f},
-std::array<float,2>{0.475868762f, 0.946905434f},
-std::array<float,2>{0.211256504f, 0.0254612248f},
-std::array<float,2>{0.808217585f, 0.879511476f},
-std::array<float,2>{0.619541049f, 0.299129277f},
-std::array<float,2>{0.393730193f, 0.572385848f},
-std::array<float,2>{0.283908218f, 0.446401656f},
-std::array<float,2>{0.743940949f, 0.693881094f},
-std::array<float,2>{0.934436381f, 0.157112107f},
-std::array<float,2>{0.0999919996f, 0.765755296f},
-std::array<float,2>{0.483356535f, 0.222182557f},
-std::array<float,2>{0.513720989f, 0.818623304f},
-std::array<float,2>{0.841866374f, 0.399170667f},
-std::array<float,2>{0.125085115f, 0.634380579f},
-std::array<float,2>{0.0360059626f, 0.347778261f},
-std::array<float,2>{0.957818866f, 0.55003804f},
-std::array<float,2>{0.656118274f, 0.0710346401f},
-std::array<float,2>{0.336391389f, 0.97529906f},
-std::array<float,2>{0.071238108f, 0.145925283f},
-std::array<float,2>{0.89023006f, 0.79384917f},
-std::array<float,2>{0.687572777f, 0.483504653f},
-std::array<float,2>{0.251111776f, 0.748436272f},
-std::array<float,2>{0.406736016f, 0.259779662f},
-std::array<float,2>{0.592127502f, 0.621395588f},
-std::array<float,2>{0.770927668f, 0.0400713123f},
-std::array<float,2>{0.228953958f, 0.93325454f},
-std::array<float,2>{0.363886416f, 0.107861631f},
-std::array<float,2>{0.6635378f, 0.944058537f},
-std::array<float,2>{0.98484987f, 0.33344686f},
-std::array<float,2>{0.0173296351f, 0.520636082f},
-std::array<float,2>{0.181926757f, 0.434123874f},
-std::array<float,2>{0.866190135f, 0.68551892f},
-std::array<float,2>{0.561836243f, 0.197305992f},
-std::array<float,2>{0.446564376f, 0.861189067f},
-std::array<float,2>{0.141009361f, 0.20859544f},
-std::array<float,2>{0.820204973f, 0.856974781f},
-std::array<float,2>{0.52688086f, 0.413718343f},
-std::array<float,2>{0.484535128f, 0.664265037f},
-std::array<float,2>{0.322355986f, 0.317958087f},
-std::array<float,2>{0.637787521f, 0.507148921f},
-std::array<float,2>{0.948190153f, 0.114674233f},
-std::array<float,2>{0.0531093925f, 0.955785394f},
-std::array<float,2>{0.381217629f, 0.0505886823f},
-std::array<float,2>{0.605461895f, 0.917848587f},
-std::array<float,2>{0.781883061f, 0.268353403f},
-std::array<float,2>{0.192940921f, 0.607168198f},
-std::array<float,2>{0.116429098f, 0.499578059f},
-std::array<float,2>{0.920169294f, 0.732288241f},
-std::array<float,2>{0.733073652f, 0.132663846f},
-std::array<float,2>{0.303684175f, 0.805559158f},
-std::array<float,2>{0.00309382426f, 0.0881094411f},
-std::array<float,2>{0.970116913f, 0.984685659f},
-std::array<float,2>{0.687001109f, 0.360901952f},
-std::array<float,2>{0.345622897f, 0.533536434f},
-std::array<float,2>{0.463645428f, 0.379301965f},
-std::array<float,2>{0.532761276f, 0.648255885f},
-std::array<float,2>{0.848177433f, 0.24686189f},
-std::array<float,2>{0.171021387f, 0.835879624f},
-std::array<float,2>{0.279299408f, 0.180491507f},
-std::array<float,2>{0.706535459f, 0.754663944f},
-std::array<float,2>{0.896438479f, 0.456099242f},
-std::array<float,2>{0.0797930956f, 0.715100706f},
-std::array<float,2>{0.238245428f, 0.286865979f},
-std::array<float,2>{0.760046184f, 0.589283109f},
-std::array<float,2>{0.565046847f, 0.00121168199f},
-std::array<float,2>{0.422348678f, 0.903657973f},
-std::array<float,2>{0.245898783f, 0.0745122358f},
-std::array<float,2>{0.756995857f, 0.971846461f},
-std::array<float,2>{0.572788775f, 0.347272843f},
-std::array<float,2>{0.430185974f, 0.553498447f},
-std::array<float,2>{0.269739926f, 0.404045403f},
-std::array<float,2>{0.711833596f, 0.638460755f},
-std::array<float,2>{0.901754677f, 0.222872525f},
-std::array<float,2>{0.0906547382f, 0.812618673f},
-std::array<float,2>{0.458923012f, 0.161160037f},
-std::array<float,2>{0.546339333f, 0.769795537f},
-std::array<float,2>{0.852254272f, 0.449909836f},
-std::array<float,2>{0.16363731f, 0.69062674f},
-std::array<float,2>{0.0109051159f, 0.304201841f},
-std::array<float,2>{0.977178931f, 0.576356828f},
-std::array<float,2>{0.677157938f, 0.027599372f},
-std::array<float,2>{0.355071515f, 0.877396584f},
-std::array<float,2>{0.123313829f, 0.202068955f},
-std::array<float,2>{0.908476353f, 0.867151678f},
-std::array<float,2>{0.725275576f, 0.432338953f},
-std::array<float,2>{0.307407141f, 0.682244122f},
-std::array<float,2>{0.387229294f, 0.328308523f},
-std::array<float,2>{0.598209679f, 0.517596662f},
-std::array<float,2>{0.790379405f, 0.105266452f},
-std::array<float,2>{0.202847824f, 0.940148056f},
-std::array<float,2>{0.317903519f, 0.0438268483f},
-std::array<float,2>{0.625410914f, 0.93550992f},
-std::array<float,2>{0.942688286f, 0.263991863f},
-std::array<float,2>{0.0585675389f, 0.620755076f},
-std::array<float,2>{0.154478431f, 0.477861583f},
-std::array<float,2>{0.822778404f, 0.743188083f},
-std::array<float,2>{0.518212318f, 0.143627688f},
-std::array<float,2>{0.493966252f, 0.791693032f},
-std::array<float,2>{0.179148659f, 0.128823757f},
-std::array<float,2>{0.867349684f, 0.810926378f},
-std::array<float,2>{0.554038107f, 0.494250804f},
-std::array<float,2>{0.443290621f, 0.729336202f},
-std::array<float,2>{0.37389189f, 0.271047205f},
-std::array<float,2>{0.668963552f, 0.603572249f},
-std::array<float,2>{0.997635782f, 0.0518473387f},
-std::array<float,2>{0.027459003f, 0.921309233f},
-std::array<float,2>{0.420411199f, 0.111080222f},
-std::array<float,2>{0.583563566f, 0.960465848f},
-std::array<float,2>{0.774688721f, 0.314517885f},
-std::array<float,2>{0.221569553f, 0.500336111f},
-std::array<float,2>{0.0695512742f, 0.407773495f},
-std::array<float,2>{0.87932092f, 0.668124795f},
-std::array<float,2>{0.697844028f, 0.205205575f},
-std::array<float,2>{0.264279068f, 0.851779461f},
-std::array<float,2>{0.0449101441f, 0.00628919946f},
-std::array<float,2>{0.965877771f, 0.90113616f},
-std::array<float,2>{0.647643328f, 0.284056813f},
-std::array<float,2>{0.3281762f, 0.59258306f},
-std::array<float,2>{0.469538599f, 0.457441181f},
-std::array<float,2>{0.506853163f, 0.71272105f},
-std::array<float,2>{0.83308816f, 0.186893925f},
-std::array<float,2>{0.134537727f, 0.75380826f},
-std::array<float,2>{0.289733499f, 0.245509937f},
-std::array<float,2>{0.739723325f, 0.831671119f},
-std::array<float,2>{0.927481651f, 0.378623426f},
-std::array<float,2>{0.108081952f, 0.644307375f},
-std::array<float,2>{0.207561269f, 0.366664261f},
-std::array<float,2>{0.804629624f, 0.536915421f},
-std::array<float,2>{0.610202312f, 0.0924550965f},
-std::array<float,2>{0.403211564f, 0.990184367f},
-std::array<float,2>{0.129934743f, 0.0614946149f},
-std::array<float,2>{0.836571038f, 0.90975225f},
-std::array<float,2>{0.509263337f, 0.275097489f},
-std::array<float,2>{0.477485031f, 0.599430859f},
-std::array<float,2>{0.342777967f, 0.489630371f},
-std::array<float,2>{0.651781082f, 0.723032475f},
-std::array<float,2>{0.954461694f, 0.140103757f},
-std::array<float,2>{0.0325521529f, 0.802322388f},
-std::array<float,2>{0.396453977f, 0.213160709f},
-std::array<float,2>{0.621643245f, 0.850453138f},
-std::array<float,2>{0.810603261f, 0.415058076f},
-std::array<float,2>{0.218185559f, 0.656310737f},
-std::array<float,2>{0.094404608f, 0.325355291f},
-std::array<float,2>{0.930526435f, 0.513310194f},
-std::array<float,2>{0.748273253f, 0.119506627f},
-std::array<float,2>{0.287142605f, 0.96412003f},
-std::array<float,2>{0.0209431611f, 0.173795611f},
-std::array<float,2>{0.990264833f, 0.764172196f},
-std::array<float,2>{0.658600867f, 0.461725414f},
-std::array<float,2>{0.362882435f, 0.706341982f},
-std::array<float,2>{0.450250328f, 0.292185724f},
-std::array<float,2>{0.554798424f, 0.583971143f},
-std::array<float,2>{0.862102211f, 0.0148101756f},
-std::array<float,2>{0.187120378f, 0.892732739f},
-std::array<float,2>{0.257244825f, 0.0790243745f},
-std::array<float,2>{0.693361759f, 0.992335916f},
-std::array<float,2>{0.884327531f, 0.370703667f},
-std::array<float,2>{0.0778388456f, 0.54226321f},
-std::array<float,2>{0.233299196f, 0.388927937f},
-std::array<float,2>{0.767820477f, 0.653308809f},
-std::array<float,2>{0.586315274f, 0.234541029f},
-std::array<float,2>{0.412813246f, 0.839937985f},
-std::array<float,2>{0.190593362f, 0.226750061f},
-std::array<float,2>{0.788289011f, 0.827648699f},
-std::array<float,2>{0.605597496f, 0.398012996f},
-std::array<float,2>{0.378176451f, 0.630905986f},
-std::array<float,2>{0.29875645f, 0.357786506f},
-std::array<float,2>{0.73000735f, 0.561582625f},
-std::array<float,2>{0.917367399f, 0.0626576394f},
-std::array<float,2>{0.1104021f, 0.980680048f},
-std::array<float,2>{0.491665035f, 0.0205079019f},
-std::array<float,2>{0.528710783f, 0.889902234f},
-std::array<float,2>{0.815123141f, 0.312334895f},
-std::array<float,2>{0.144829825f, 0.565163732f},
-std::array<float,2>{0.0502330847f, 0.443682969f},
-std::array<float,2>{0.94961077f, 0.698026776f},
-std::array<float,2>{0.634227216f, 0.167144135f},
-std::array<float,2>{0.327566952f, 0.777022302f},
-std::array<float,2>{0.0851186216f, 0.0994769186f},
-std::array<float,2>{0.892304063f, 0.951027155f},
-std::array<float,2>{0.709926188f, 0.336513311f},
-std::array<float,2>{0.274362236f, 0.525693178f},
-std::array<float,2>{0.426400989f, 0.424029976f},
-std::array<float,2>{0.570148766f, 0.676103711f},
-std::array<float,2>{0.76311028f, 0.192006335f},
-std::array<float,2>{0.239664882f, 0.869129837f},
-std::array<float,2>{0.348986715f, 0.149626717f},
-std::array<float,2>{0.682627797f, 0.784219146f},
-std::array<float,2>{0.97374171f, 0.475346208f},
-std::array<float,2>{0.00405922765f, 0.73638624f},
-std::array<float,2>{0.16654855f, 0.256563455f},
-std::array<float,2>{0.845268786f, 0.616965711f},
-std::array<float,2>{0.537955821f, 0.0350432396f},
-std::array<float,2>{0.468561023f, 0.923196495f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.755787909f, 0.47100094f},
-std::array<float,2>{0.0905462652f, 0.609408081f},
-std::array<float,2>{0.307002276f, 0.225833148f},
-std::array<float,2>{0.743236542f, 0.956409276f},
-std::array<float,2>{0.514614522f, 0.0241429023f},
-std::array<float,2>{0.497992337f, 0.873010337f},
-std::array<float,2>{0.236042023f, 0.29730019f},
-std::array<float,2>{0.922798872f, 0.657470763f},
-std::array<float,2>{0.64400667f, 0.314291418f},
-std::array<float,2>{0.344399601f, 0.749939561f},
-std::array<float,2>{0.0619450025f, 0.0866693929f},
-std::array<float,2>{0.824885845f, 0.75159502f},
-std::array<float,2>{0.974069118f, 0.150767639f},
-std::array<float,2>{0.142274037f, 0.909247041f},
-std::array<float,2>{0.420288831f, 0.413144767f},
-std::array<float,2>{0.577139735f, 0.529753685f},
-std::array<float,2>{0.891621709f, 0.261047781f},
-std::array<float,2>{0.208858863f, 0.627634406f},
-std::array<float,2>{0.463524431f, 0.0479780324f},
-std::array<float,2>{0.538618445f, 0.826407075f},
-std::array<float,2>{0.696374357f, 0.189490542f},
-std::array<float,2>{0.257256508f, 0.973615408f},
-std::array<float,2>{0.101291113f, 0.440623611f},
-std::array<float,2>{0.794400752f, 0.569417894f},
-std::array<float,2>{0.599261284f, 0.392877907f},
-std::array<float,2>{0.390991032f, 0.544035494f},
-std::array<float,2>{0.18355836f, 0.162163869f},
-std::array<float,2>{0.966097951f, 0.878281116f},
-std::array<float,2>{0.866773367f, 0.12193194f},
-std::array<float,2>{0.0279260818f, 0.81019789f},
-std::array<float,2>{0.33095932f, 0.360928565f},
-std::array<float,2>{0.667738438f, 0.714692295f},
-std::array<float,2>{0.938568592f, 0.43033585f},
-std::array<float,2>{0.159449443f, 0.50500679f},
-std::array<float,2>{0.389871866f, 0.136650831f},
-std::array<float,2>{0.609847188f, 0.935810447f},
-std::array<float,2>{0.673428357f, 0.0725082755f},
-std::array<float,2>{0.319911242f, 0.769937396f},
-std::array<float,2>{0.0148743307f, 0.340438545f},
-std::array<float,2>{0.854965866f, 0.719745874f},
-std::array<float,2>{0.553502798f, 0.288407415f},
-std::array<float,2>{0.437838137f, 0.676263154f},
-std::array<float,2>{0.189571202f, 0.0103076715f},
-std::array<float,2>{0.888479352f, 0.852583885f},
-std::array<float,2>{0.806079268f, 0.239543542f},
-std::array<float,2>{0.118973441f, 0.941949308f},
-std::array<float,2>{0.280255347f, 0.484441936f},
-std::array<float,2>{0.704236031f, 0.596173704f},
-std::array<float,2>{0.838739336f, 0.345291704f},
-std::array<float,2>{0.0318109095f, 0.70153445f},
-std::array<float,2>{0.361694425f, 0.101010464f},
-std::array<float,2>{0.627359211f, 0.793115258f},
-std::array<float,2>{0.580209613f, 0.184784338f},
-std::array<float,2>{0.430256486f, 0.895421743f},
-std::array<float,2>{0.135113358f, 0.387822419f},
-std::array<float,2>{0.992900908f, 0.559745491f},
-std::array<float,2>{0.719658852f, 0.459630102f},
-std::array<float,2>{0.28601867f, 0.578813612f},
-std::array<float,2>{0.064013809f, 0.218071923f},
-std::array<float,2>{0.779491127f, 0.991508484f},
-std::array<float,2>{0.921613812f, 0.0327120014f},
-std::array<float,2>{0.226828337f, 0.842142224f},
-std::array<float,2>{0.469834834f, 0.275743932f},
-std::array<float,2>{0.516145051f, 0.646123707f},
-std::array<float,2>{0.849261403f, 0.375409126f},
-std::array<float,2>{0.00202043424f, 0.550973475f},
-std::array<float,2>{0.321138054f, 0.177513465f},
-std::array<float,2>{0.683661342f, 0.900005102f},
-std::array<float,2>{0.623978078f, 0.105213776f},
-std::array<float,2>{0.379442662f, 0.787835598f},
-std::array<float,2>{0.170425057f, 0.356494695f},
-std::array<float,2>{0.95152092f, 0.695163369f},
-std::array<float,2>{0.71418494f, 0.266122133f},
-std::array<float,2>{0.270278484f, 0.654664397f},
-std::array<float,2>{0.114983067f, 0.0413208529f},
-std::array<float,2>{0.799403906f, 0.828168333f},
-std::array<float,2>{0.878568411f, 0.20794706f},
-std::array<float,2>{0.197579145f, 0.996039331f},
-std::array<float,2>{0.452467382f, 0.464875609f},
-std::array<float,2>{0.56203419f, 0.586936116f},
-std::array<float,2>{0.988563955f, 0.333127856f},
-std::array<float,2>{0.125199884f, 0.730557263f},
-std::array<float,2>{0.422813237f, 0.0692860782f},
-std::array<float,2>{0.590361178f, 0.773662627f},
-std::array<float,2>{0.634575248f, 0.130757391f},
-std::array<float,2>{0.371046007f, 0.926321924f},
-std::array<float,2>{0.0423698984f, 0.422845066f},
-std::array<float,2>{0.832370758f, 0.511588454f},
-std::array<float,2>{0.525049746f, 0.49895519f},
-std::array<float,2>{0.483858466f, 0.60916996f},
-std::array<float,2>{0.219843373f, 0.243910521f},
-std::array<float,2>{0.912389338f, 0.947964072f},
-std::array<float,2>{0.766303301f, 0.00723824231f},
-std::array<float,2>{0.0749248341f, 0.844895303f},
-std::array<float,2>{0.291876525f, 0.290731579f},
-std::array<float,2>{0.733130395f, 0.681084514f},
-std::array<float,2>{0.935021996f, 0.450623155f},
-std::array<float,2>{0.244387746f, 0.574368775f},
-std::array<float,2>{0.490074158f, 0.19633536f},
-std::array<float,2>{0.500127971f, 0.978211522f},
-std::array<float,2>{0.738426507f, 0.0588085838f},
-std::array<float,2>{0.301715046f, 0.81587708f},
-std::array<float,2>{0.0830715224f, 0.255370378f},
-std::array<float,2>{0.76005733f, 0.633359492f},
-std::array<float,2>{0.568542659f, 0.368418962f},
-std::array<float,2>{0.412754565f, 0.705500543f},
-std::array<float,2>{0.15367794f, 0.114815965f},
-std::array<float,2>{0.981385767f, 0.802900612f},
-std::array<float,2>{0.816681445f, 0.16668202f},
-std::array<float,2>{0.049041491f, 0.890000999f},
-std::array<float,2>{0.352126926f, 0.402816802f},
-std::array<float,2>{0.651663065f, 0.535465598f},
-std::array<float,2>{0.781498551f, 0.31166327f},
-std::array<float,2>{0.106332697f, 0.6660133f},
-std::array<float,2>{0.260901302f, 0.0186037533f},
-std::array<float,2>{0.694575846f, 0.86711967f},
-std::array<float,2>{0.540933609f, 0.234262377f},
-std::array<float,2>{0.457759887f, 0.965087891f},
-std::array<float,2>{0.211515695f, 0.482491434f},
-std::array<float,2>{0.901204765f, 0.622233927f},
-std::array<float,2>{0.659792006f, 0.414310068f},
-std::array<float,2>{0.340941995f, 0.51918596f},
-std::array<float,2>{0.0208232254f, 0.146700189f},
-std::array<float,2>{0.869514227f, 0.915817201f},
-std::array<float,2>{0.958245337f, 0.0809830353f},
-std::array<float,2>{0.17239964f, 0.762112796f},
-std::array<float,2>{0.402646154f, 0.32730189f},
-std::array<float,2>{0.605146468f, 0.737226009f},
-std::array<float,2>{0.803932369f, 0.41010049f},
-std::array<float,2>{0.110023357f, 0.524468005f},
-std::array<float,2>{0.267752856f, 0.156036511f},
-std::array<float,2>{0.717248976f, 0.913649499f},
-std::array<float,2>{0.558385551f, 0.0934028029f},
-std::array<float,2>{0.446128011f, 0.756364942f},
-std::array<float,2>{0.199842021f, 0.319779962f},
-std::array<float,2>{0.879407763f, 0.742873907f},
-std::array<float,2>{0.680697739f, 0.302756697f},
-std::array<float,2>{0.325748175f, 0.663085222f},
-std::array<float,2>{0.00518516777f, 0.0305293873f},
-std::array<float,2>{0.846061766f, 0.86974895f},
-std::array<float,2>{0.947249234f, 0.218839601f},
-std::array<float,2>{0.167831257f, 0.960908234f},
-std::array<float,2>{0.376645952f, 0.474505782f},
-std::array<float,2>{0.620180428f, 0.61658287f},
-std::array<float,2>{0.910078883f, 0.367153138f},
-std::array<float,2>{0.224339128f, 0.715672314f},
-std::array<float,2>{0.477077544f, 0.117910244f},
-std::array<float,2>{0.527552366f, 0.807276011f},
-std::array<float,2>{0.728168726f, 0.157309771f},
-std::array<float,2>{0.295653999f, 0.882132888f},
-std::array<float,2>{0.0707696229f, 0.395660549f},
-std::array<float,2>{0.772099495f, 0.542389333f},
-std::array<float,2>{0.58706522f, 0.444590241f},
-std::array<float,2>{0.429485321f, 0.563632011f},
-std::array<float,2>{0.131000653f, 0.192765996f},
-std::array<float,2>{0.985073209f, 0.97054255f},
-std::array<float,2>{0.829704225f, 0.0539084487f},
-std::array<float,2>{0.0435473025f, 0.821368039f},
-std::array<float,2>{0.372160822f, 0.264714986f},
-std::array<float,2>{0.639418542f, 0.631251752f},
-std::array<float,2>{0.980234206f, 0.488986939f},
-std::array<float,2>{0.150419965f, 0.601133108f},
-std::array<float,2>{0.408236533f, 0.235047802f},
-std::array<float,2>{0.565624356f, 0.939184964f},
-std::array<float,2>{0.654984891f, 0.0142789893f},
-std::array<float,2>{0.355989844f, 0.859033942f},
-std::array<float,2>{0.0532597378f, 0.282724947f},
-std::array<float,2>{0.815835476f, 0.673945069f},
-std::array<float,2>{0.504303753f, 0.338252276f},
-std::array<float,2>{0.487903178f, 0.725495219f},
-std::array<float,2>{0.249455601f, 0.0749931931f},
-std::array<float,2>{0.93066901f, 0.768688738f},
-std::array<float,2>{0.76187098f, 0.136949435f},
-std::array<float,2>{0.0790526718f, 0.930385828f},
-std::array<float,2>{0.297158092f, 0.437372446f},
-std::array<float,2>{0.73638773f, 0.501686215f},
-std::array<float,2>{0.87491411f, 0.278521031f},
-std::array<float,2>{0.0167571045f, 0.643418789f},
-std::array<float,2>{0.336924911f, 0.0378418006f},
-std::array<float,2>{0.66175139f, 0.836439073f},
-std::array<float,2>{0.606052458f, 0.21386154f},
-std::array<float,2>{0.398775697f, 0.984876633f},
-std::array<float,2>{0.177419513f, 0.455308944f},
-std::array<float,2>{0.955826402f, 0.583345652f},
-std::array<float,2>{0.68918699f, 0.385520458f},
-std::array<float,2>{0.264401287f, 0.556329548f},
-std::array<float,2>{0.105163403f, 0.1797674f},
-std::array<float,2>{0.788958013f, 0.893027723f},
-std::array<float,2>{0.905716062f, 0.0943710059f},
-std::array<float,2>{0.218182281f, 0.790692687f},
-std::array<float,2>{0.45680654f, 0.350957364f},
-std::array<float,2>{0.543109953f, 0.697124004f},
-std::array<float,2>{0.82174325f, 0.463917494f},
-std::array<float,2>{0.0547005385f, 0.592138946f},
-std::array<float,2>{0.349871993f, 0.204598606f},
-std::array<float,2>{0.647082388f, 0.996143639f},
-std::array<float,2>{0.572269678f, 0.0450390242f},
-std::array<float,2>{0.417702198f, 0.834567964f},
-std::array<float,2>{0.147200197f, 0.272663563f},
-std::array<float,2>{0.969925582f, 0.652159512f},
-std::array<float,2>{0.748203993f, 0.351683915f},
-std::array<float,2>{0.312490851f, 0.689782798f},
-std::array<float,2>{0.0889343247f, 0.105831794f},
-std::array<float,2>{0.751013875f, 0.78491962f},
-std::array<float,2>{0.927466631f, 0.174745202f},
-std::array<float,2>{0.241163895f, 0.905798614f},
-std::array<float,2>{0.4953821f, 0.379150569f},
-std::array<float,2>{0.511106074f, 0.549923539f},
-std::array<float,2>{0.962358952f, 0.29475224f},
-std::array<float,2>{0.186827615f, 0.685120225f},
-std::array<float,2>{0.395615578f, 0.00220171153f},
-std::array<float,2>{0.597014964f, 0.85115093f},
-std::array<float,2>{0.667994022f, 0.248367101f},
-std::array<float,2>{0.333434314f, 0.951847494f},
-std::array<float,2>{0.0249531213f, 0.493948787f},
-std::array<float,2>{0.861183226f, 0.603355646f},
-std::array<float,2>{0.533368349f, 0.42854014f},
-std::array<float,2>{0.467975646f, 0.514753997f},
-std::array<float,2>{0.206559211f, 0.128278404f},
-std::array<float,2>{0.895027936f, 0.923294485f},
-std::array<float,2>{0.792555749f, 0.0625088662f},
-std::array<float,2>{0.096932888f, 0.779414952f},
-std::array<float,2>{0.252631694f, 0.329359353f},
-std::array<float,2>{0.702418864f, 0.72887665f},
-std::array<float,2>{0.886556864f, 0.398623347f},
-std::array<float,2>{0.192272648f, 0.534835637f},
-std::array<float,2>{0.443813562f, 0.169914082f},
-std::array<float,2>{0.547078133f, 0.885915577f},
-std::array<float,2>{0.708723068f, 0.112812325f},
-std::array<float,2>{0.275130212f, 0.800210118f},
-std::array<float,2>{0.123764038f, 0.373329699f},
-std::array<float,2>{0.809533954f, 0.709480166f},
-std::array<float,2>{0.614901245f, 0.250802428f},
-std::array<float,2>{0.384672493f, 0.638305664f},
-std::array<float,2>{0.163539097f, 0.0558058061f},
-std::array<float,2>{0.944770098f, 0.818772435f},
-std::array<float,2>{0.858678877f, 0.201248527f},
-std::array<float,2>{0.0110299503f, 0.982254446f},
-std::array<float,2>{0.314352989f, 0.446743757f},
-std::array<float,2>{0.676814318f, 0.570501566f},
-std::array<float,2>{0.774531841f, 0.322872996f},
-std::array<float,2>{0.0698698163f, 0.73983705f},
-std::array<float,2>{0.284436613f, 0.082090795f},
-std::array<float,2>{0.723593712f, 0.760425985f},
-std::array<float,2>{0.520679176f, 0.144269094f},
-std::array<float,2>{0.474850237f, 0.919550776f},
-std::array<float,2>{0.232117385f, 0.420538545f},
-std::array<float,2>{0.915004134f, 0.522120774f},
-std::array<float,2>{0.631767631f, 0.478892207f},
-std::array<float,2>{0.365607083f, 0.619212747f},
-std::array<float,2>{0.0381307527f, 0.230366066f},
-std::array<float,2>{0.841463745f, 0.963404834f},
-std::array<float,2>{0.999989927f, 0.0224052165f},
-std::array<float,2>{0.13929987f, 0.86286211f},
-std::array<float,2>{0.434352458f, 0.308049589f},
-std::array<float,2>{0.583003223f, 0.6703192f},
-std::array<float,2>{0.79653424f, 0.43919903f},
-std::array<float,2>{0.0978609771f, 0.566798866f},
-std::array<float,2>{0.253984421f, 0.188844517f},
-std::array<float,2>{0.697844863f, 0.975029886f},
-std::array<float,2>{0.535815001f, 0.0501314662f},
-std::array<float,2>{0.462367922f, 0.826122284f},
-std::array<float,2>{0.210614756f, 0.25860256f},
-std::array<float,2>{0.893808603f, 0.62658453f},
-std::array<float,2>{0.665008605f, 0.363059342f},
-std::array<float,2>{0.329564333f, 0.711636245f},
-std::array<float,2>{0.0293243229f, 0.124899425f},
-std::array<float,2>{0.864770889f, 0.811444938f},
-std::array<float,2>{0.967777908f, 0.160791233f},
-std::array<float,2>{0.181291118f, 0.876793563f},
-std::array<float,2>{0.393312514f, 0.391548067f},
-std::array<float,2>{0.59994626f, 0.545688331f},
-std::array<float,2>{0.924287617f, 0.299512923f},
-std::array<float,2>{0.237563625f, 0.658512771f},
-std::array<float,2>{0.49943769f, 0.0260685552f},
-std::array<float,2>{0.513223946f, 0.874643803f},
-std::array<float,2>{0.746002376f, 0.223057762f},
-std::array<float,2>{0.305070519f, 0.954288483f},
-std::array<float,2>{0.0920531079f, 0.469358265f},
-std::array<float,2>{0.757370472f, 0.611951947f},
-std::array<float,2>{0.575679719f, 0.411070347f},
-std::array<float,2>{0.419452071f, 0.52812922f},
-std::array<float,2>{0.143092141f, 0.148696408f},
-std::array<float,2>{0.975605547f, 0.908085883f},
-std::array<float,2>{0.826998234f, 0.0890221819f},
-std::array<float,2>{0.0594053529f, 0.752948046f},
-std::array<float,2>{0.346345782f, 0.315719187f},
-std::array<float,2>{0.64229095f, 0.746900976f},
-std::array<float,2>{0.996045232f, 0.390419155f},
-std::array<float,2>{0.134043947f, 0.560946882f},
-std::array<float,2>{0.433010012f, 0.186550647f},
-std::array<float,2>{0.578619778f, 0.897589445f},
-std::array<float,2>{0.625532806f, 0.099215135f},
-std::array<float,2>{0.36066404f, 0.795929193f},
-std::array<float,2>{0.0344806127f, 0.345752209f},
-std::array<float,2>{0.836043417f, 0.699346542f},
-std::array<float,2>{0.519300997f, 0.274075896f},
-std::array<float,2>{0.472586751f, 0.647829413f},
-std::array<float,2>{0.229438886f, 0.0350658074f},
-std::array<float,2>{0.919724345f, 0.840092957f},
-std::array<float,2>{0.778050423f, 0.215857357f},
-std::array<float,2>{0.0644969717f, 0.989129186f},
-std::array<float,2>{0.288811475f, 0.457696617f},
-std::array<float,2>{0.722599626f, 0.580798745f},
-std::array<float,2>{0.852647781f, 0.343202829f},
-std::array<float,2>{0.0119811455f, 0.722356319f},
-std::array<float,2>{0.316592187f, 0.0711269528f},
-std::array<float,2>{0.673978686f, 0.772340238f},
-std::array<float,2>{0.611656487f, 0.133869708f},
-std::array<float,2>{0.388436198f, 0.934175551f},
-std::array<float,2>{0.157029748f, 0.431900412f},
-std::array<float,2>{0.939760566f, 0.507724404f},
-std::array<float,2>{0.705517173f, 0.486589164f},
-std::array<float,2>{0.277499646f, 0.594402909f},
-std::array<float,2>{0.120882921f, 0.24109678f},
-std::array<float,2>{0.80737406f, 0.943890989f},
-std::array<float,2>{0.889935136f, 0.00926869363f},
-std::array<float,2>{0.189429194f, 0.854018629f},
-std::array<float,2>{0.440432638f, 0.286892623f},
-std::array<float,2>{0.552424669f, 0.678632677f},
-std::array<float,2>{0.834868789f, 0.424996972f},
-std::array<float,2>{0.0406424403f, 0.509572566f},
-std::array<float,2>{0.367333263f, 0.131182984f},
-std::array<float,2>{0.636209905f, 0.9294613f},
-std::array<float,2>{0.592531919f, 0.0665934905f},
-std::array<float,2>{0.425275087f, 0.775406837f},
-std::array<float,2>{0.128886014f, 0.334597737f},
-std::array<float,2>{0.991879404f, 0.733461261f},
-std::array<float,2>{0.73093468f, 0.292602807f},
-std::array<float,2>{0.290074587f, 0.683123529f},
-std::array<float,2>{0.0775713027f, 0.00423168438f},
-std::array<float,2>{0.768030286f, 0.845897317f},
-std::array<float,2>{0.910630524f, 0.245035753f},
-std::array<float,2>{0.221541792f, 0.946363747f},
-std::array<float,2>{0.480743855f, 0.497814417f},
-std::array<float,2>{0.525578558f, 0.606936872f},
-std::array<float,2>{0.949900806f, 0.357545167f},
-std::array<float,2>{0.168967202f, 0.692000926f},
-std::array<float,2>{0.3813999f, 0.102246776f},
-std::array<float,2>{0.622479737f, 0.786108494f},
-std::array<float,2>{0.686568797f, 0.177845329f},
-std::array<float,2>{0.322622567f, 0.900881112f},
-std::array<float,2>{0.00137382001f, 0.378038108f},
-std::array<float,2>{0.850586832f, 0.55384928f},
-std::array<float,2>{0.559264362f, 0.467671365f},
-std::array<float,2>{0.449384898f, 0.588577509f},
-std::array<float,2>{0.195873663f, 0.210797757f},
-std::array<float,2>{0.875474989f, 0.993852496f},
-std::array<float,2>{0.796975791f, 0.039835386f},
-std::array<float,2>{0.115237132f, 0.830757678f},
-std::array<float,2>{0.271675169f, 0.268731624f},
-std::array<float,2>{0.711793542f, 0.653542876f},
-std::array<float,2>{0.899584353f, 0.482070625f},
-std::array<float,2>{0.214475304f, 0.623891175f},
-std::array<float,2>{0.459852457f, 0.231559947f},
-std::array<float,2>{0.541218042f, 0.967105269f},
-std::array<float,2>{0.692794263f, 0.01644939f},
-std::array<float,2>{0.257834345f, 0.864429533f},
-std::array<float,2>{0.10856694f, 0.309053749f},
-std::array<float,2>{0.784865499f, 0.667716026f},
-std::array<float,2>{0.602309465f, 0.325517744f},
-std::array<float,2>{0.40441224f, 0.735264122f},
-std::array<float,2>{0.174173877f, 0.0790680721f},
-std::array<float,2>{0.959077239f, 0.763926983f},
-std::array<float,2>{0.86781019f, 0.145723179f},
-std::array<float,2>{0.0220075492f, 0.916149139f},
-std::array<float,2>{0.342947483f, 0.416957766f},
-std::array<float,2>{0.657140374f, 0.516047239f},
-std::array<float,2>{0.759724319f, 0.257395357f},
-std::array<float,2>{0.0847697929f, 0.636299431f},
-std::array<float,2>{0.304273933f, 0.0623693243f},
-std::array<float,2>{0.741266727f, 0.813630223f},
-std::array<float,2>{0.502344549f, 0.199039415f},
-std::array<float,2>{0.491582453f, 0.979028463f},
-std::array<float,2>{0.242549866f, 0.45185858f},
-std::array<float,2>{0.935777068f, 0.577364266f},
-std::array<float,2>{0.649192393f, 0.406194031f},
-std::array<float,2>{0.355117261f, 0.537733734f},
-std::array<float,2>{0.0474861264f, 0.164090037f},
-std::array<float,2>{0.818421602f, 0.887702823f},
-std::array<float,2>{0.984043121f, 0.115350351f},
-std::array<float,2>{0.154353037f, 0.802260876f},
-std::array<float,2>{0.41111654f, 0.370270014f},
-std::array<float,2>{0.568087399f, 0.704142451f},
-std::array<float,2>{0.770859182f, 0.39812541f},
-std::array<float,2>{0.0740967989f, 0.540875793f},
-std::array<float,2>{0.294907123f, 0.158715278f},
-std::array<float,2>{0.730366945f, 0.880046844f},
-std::array<float,2>{0.530527711f, 0.120250791f},
-std::array<float,2>{0.479754448f, 0.805808067f},
-std::array<float,2>{0.224730492f, 0.365082532f},
-std::array<float,2>{0.907375813f, 0.717456758f},
-std::array<float,2>{0.637697399f, 0.262686849f},
-std::array<float,2>{0.373312384f, 0.62957412f},
-std::array<float,2>{0.0465587117f, 0.0511359833f},
-std::array<float,2>{0.830706537f, 0.822468936f},
-std::array<float,2>{0.987204671f, 0.193968043f},
-std::array<float,2>{0.130490422f, 0.972219467f},
-std::array<float,2>{0.426129967f, 0.441461414f},
-std::array<float,2>{0.589556456f, 0.56480056f},
-std::array<float,2>{0.882231534f, 0.318123162f},
-std::array<float,2>{0.202785328f, 0.74490422f},
-std::array<float,2>{0.448427796f, 0.0917206332f},
-std::array<float,2>{0.55474484f, 0.754679441f},
-std::array<float,2>{0.715904236f, 0.152736664f},
-std::array<float,2>{0.266408235f, 0.910205781f},
-std::array<float,2>{0.11285907f, 0.406846017f},
-std::array<float,2>{0.802673936f, 0.52579689f},
-std::array<float,2>{0.618508458f, 0.474846989f},
-std::array<float,2>{0.378074348f, 0.614771724f},
-std::array<float,2>{0.165814579f, 0.221677721f},
-std::array<float,2>{0.949067652f, 0.95736891f},
-std::array<float,2>{0.844451427f, 0.0289457142f},
-std::array<float,2>{0.00627524219f, 0.868957639f},
-std::array<float,2>{0.327790797f, 0.302150995f},
-std::array<float,2>{0.681699157f, 0.660965145f},
-std::array<float,2>{0.954575717f, 0.454558402f},
-std::array<float,2>{0.177884266f, 0.584725797f},
-std::array<float,2>{0.401967824f, 0.211704642f},
-std::array<float,2>{0.60845691f, 0.986546397f},
-std::array<float,2>{0.662661672f, 0.0354306214f},
-std::array<float,2>{0.338361472f, 0.839072824f},
-std::array<float,2>{0.0179547612f, 0.281073481f},
-std::array<float,2>{0.872287989f, 0.642171562f},
-std::array<float,2>{0.54620105f, 0.349296212f},
-std::array<float,2>{0.453831971f, 0.698996127f},
-std::array<float,2>{0.216269806f, 0.0959609672f},
-std::array<float,2>{0.902784705f, 0.791543424f},
-std::array<float,2>{0.787024915f, 0.183003619f},
-std::array<float,2>{0.102256529f, 0.892113864f},
-std::array<float,2>{0.262043387f, 0.382892251f},
-std::array<float,2>{0.690752327f, 0.556701541f},
-std::array<float,2>{0.813698888f, 0.28355965f},
-std::array<float,2>{0.0522390157f, 0.673318207f},
-std::array<float,2>{0.357991517f, 0.0130520267f},
-std::array<float,2>{0.653040707f, 0.856335998f},
-std::array<float,2>{0.564040422f, 0.238106713f},
-std::array<float,2>{0.407011658f, 0.940514386f},
-std::array<float,2>{0.148613095f, 0.490710288f},
-std::array<float,2>{0.97844702f, 0.599168181f},
-std::array<float,2>{0.73481077f, 0.435420066f},
-std::array<float,2>{0.300544173f, 0.503544927f},
-std::array<float,2>{0.0809605792f, 0.140176058f},
-std::array<float,2>{0.764561594f, 0.932442129f},
-std::array<float,2>{0.931856394f, 0.0762927905f},
-std::array<float,2>{0.246887043f, 0.767303646f},
-std::array<float,2>{0.486219376f, 0.336936623f},
-std::array<float,2>{0.506308258f, 0.723874092f},
-std::array<float,2>{0.862624586f, 0.494513154f},
-std::array<float,2>{0.0261556022f, 0.603576899f},
-std::array<float,2>{0.334301442f, 0.24708128f},
-std::array<float,2>{0.671544373f, 0.950939536f},
-std::array<float,2>{0.594941318f, 0.000326378038f},
-std::array<float,2>{0.397480518f, 0.849526286f},
-std::array<float,2>{0.184143797f, 0.29670006f},
-std::array<float,2>{0.963932931f, 0.687106013f},
-std::array<float,2>{0.700341582f, 0.330546439f},
-std::array<float,2>{0.250703126f, 0.727733135f},
-std::array<float,2>{0.0938134789f, 0.0647309199f},
-std::array<float,2>{0.790078759f, 0.778525293f},
-std::array<float,2>{0.896754146f, 0.125203878f},
-std::array<float,2>{0.20444338f, 0.925032675f},
-std::array<float,2>{0.464854836f, 0.427269638f},
-std::array<float,2>{0.532530487f, 0.511792302f},
-std::array<float,2>{0.971763194f, 0.270872772f},
-std::array<float,2>{0.145219967f, 0.649897099f},
-std::array<float,2>{0.414095044f, 0.0438178927f},
-std::array<float,2>{0.571730316f, 0.833644807f},
-std::array<float,2>{0.644931197f, 0.206961945f},
-std::array<float,2>{0.348321646f, 0.998353183f},
-std::array<float,2>{0.0581193902f, 0.461044222f},
-std::array<float,2>{0.823264897f, 0.59007144f},
-std::array<float,2>{0.509740174f, 0.381974697f},
-std::array<float,2>{0.494081646f, 0.547589481f},
-std::array<float,2>{0.23978661f, 0.172254339f},
-std::array<float,2>{0.928160787f, 0.902867377f},
-std::array<float,2>{0.753173053f, 0.107618079f},
-std::array<float,2>{0.087612994f, 0.782051086f},
-std::array<float,2>{0.308640987f, 0.354413331f},
-std::array<float,2>{0.747659445f, 0.689346671f},
-std::array<float,2>{0.917205572f, 0.419602901f},
-std::array<float,2>{0.232558519f, 0.519637942f},
-std::array<float,2>{0.473981291f, 0.14063102f},
-std::array<float,2>{0.522748232f, 0.921189785f},
-std::array<float,2>{0.725095451f, 0.0854156464f},
-std::array<float,2>{0.28260985f, 0.758877873f},
-std::array<float,2>{0.0668799952f, 0.321627021f},
-std::array<float,2>{0.776550114f, 0.742014408f},
-std::array<float,2>{0.584291816f, 0.306384653f},
-std::array<float,2>{0.436165094f, 0.668311119f},
-std::array<float,2>{0.138437837f, 0.0212231036f},
-std::array<float,2>{0.997013211f, 0.860547483f},
-std::array<float,2>{0.843471885f, 0.227465376f},
-std::array<float,2>{0.0353365242f, 0.962474525f},
-std::array<float,2>{0.363306791f, 0.478127301f},
-std::array<float,2>{0.628994823f, 0.618274212f},
-std::array<float,2>{0.810972214f, 0.372391194f},
-std::array<float,2>{0.121195816f, 0.707036734f},
-std::array<float,2>{0.27619803f, 0.111100383f},
-std::array<float,2>{0.709493995f, 0.796896458f},
-std::array<float,2>{0.549563706f, 0.171171635f},
-std::array<float,2>{0.44271487f, 0.884117186f},
-std::array<float,2>{0.193419874f, 0.402252525f},
-std::array<float,2>{0.883820176f, 0.531755269f},
-std::array<float,2>{0.677801728f, 0.449050933f},
-std::array<float,2>{0.316092551f, 0.573722064f},
-std::array<float,2>{0.00940280687f, 0.200173736f},
-std::array<float,2>{0.855596185f, 0.983351171f},
-std::array<float,2>{0.941612124f, 0.0576425418f},
-std::array<float,2>{0.160654306f, 0.818295181f},
-std::array<float,2>{0.384860635f, 0.252993464f},
-std::array<float,2>{0.616630852f, 0.640470624f},
-std::array<float,2>{0.780881941f, 0.458093762f},
-std::array<float,2>{0.063316755f, 0.581057727f},
-std::array<float,2>{0.28688851f, 0.215151772f},
-std::array<float,2>{0.719959855f, 0.989900291f},
-std::array<float,2>{0.516822159f, 0.034055829f},
-std::array<float,2>{0.469454318f, 0.841079295f},
-std::array<float,2>{0.228237659f, 0.274424732f},
-std::array<float,2>{0.920826375f, 0.646662474f},
-std::array<float,2>{0.628854632f, 0.34673968f},
-std::array<float,2>{0.363012135f, 0.700925469f},
-std::array<float,2>{0.0330599882f, 0.098199673f},
-std::array<float,2>{0.839582324f, 0.795680821f},
-std::array<float,2>{0.993959308f, 0.186420977f},
-std::array<float,2>{0.136120275f, 0.896833658f},
-std::array<float,2>{0.431258798f, 0.388863862f},
-std::array<float,2>{0.581773698f, 0.561690032f},
-std::array<float,2>{0.887251914f, 0.285424262f},
-std::array<float,2>{0.190716773f, 0.678841174f},
-std::array<float,2>{0.438849241f, 0.00858055428f},
-std::array<float,2>{0.553861499f, 0.854818344f},
-std::array<float,2>{0.703851223f, 0.242168948f},
-std::array<float,2>{0.28092593f, 0.944958448f},
-std::array<float,2>{0.117363788f, 0.487367541f},
-std::array<float,2>{0.80491823f, 0.595099926f},
-std::array<float,2>{0.610516727f, 0.432779819f},
-std::array<float,2>{0.389047533f, 0.506194651f},
-std::array<float,2>{0.158941075f, 0.133521006f},
-std::array<float,2>{0.937779784f, 0.934950173f},
-std::array<float,2>{0.853617787f, 0.071937032f},
-std::array<float,2>{0.0146281719f, 0.772728026f},
-std::array<float,2>{0.319115907f, 0.342729211f},
-std::array<float,2>{0.672211349f, 0.72110045f},
-std::array<float,2>{0.965717793f, 0.392522901f},
-std::array<float,2>{0.182077944f, 0.546380997f},
-std::array<float,2>{0.39224124f, 0.161302119f},
-std::array<float,2>{0.597670436f, 0.875564694f},
-std::array<float,2>{0.666683733f, 0.123126402f},
-std::array<float,2>{0.331467301f, 0.811554849f},
-std::array<float,2>{0.0285213441f, 0.361387104f},
-std::array<float,2>{0.866123796f, 0.712111175f},
-std::array<float,2>{0.537624955f, 0.25952512f},
-std::array<float,2>{0.463957757f, 0.625975847f},
-std::array<float,2>{0.207952932f, 0.0496601611f},
-std::array<float,2>{0.89136523f, 0.824433208f},
-std::array<float,2>{0.793157279f, 0.188088208f},
-std::array<float,2>{0.100083545f, 0.976148307f},
-std::array<float,2>{0.256141901f, 0.437751383f},
-std::array<float,2>{0.695745111f, 0.567860067f},
-std::array<float,2>{0.825936139f, 0.314519048f},
-std::array<float,2>{0.0610418059f, 0.747687876f},
-std::array<float,2>{0.344935387f, 0.0887454599f},
-std::array<float,2>{0.643354893f, 0.752804637f},
-std::array<float,2>{0.577964842f, 0.149719417f},
-std::array<float,2>{0.421842903f, 0.906658053f},
-std::array<float,2>{0.141391218f, 0.411227107f},
-std::array<float,2>{0.973232627f, 0.529175639f},
-std::array<float,2>{0.742527366f, 0.470231235f},
-std::array<float,2>{0.308590561f, 0.612504721f},
-std::array<float,2>{0.0913495794f, 0.224451736f},
-std::array<float,2>{0.754395187f, 0.953684866f},
-std::array<float,2>{0.923279464f, 0.0272014625f},
-std::array<float,2>{0.23526074f, 0.873790443f},
-std::array<float,2>{0.496619165f, 0.300370038f},
-std::array<float,2>{0.515313804f, 0.659912586f},
-std::array<float,2>{0.870624006f, 0.417608082f},
-std::array<float,2>{0.0201760512f, 0.517447174f},
-std::array<float,2>{0.339940131f, 0.145275846f},
-std::array<float,2>{0.658303797f, 0.91765964f},
-std::array<float,2>{0.603733897f, 0.0797459409f},
-std::array<float,2>{0.403958052f, 0.76535964f},
-std::array<float,2>{0.172949463f, 0.324724495f},
-std::array<float,2>{0.957676113f, 0.735714316f},
-std::array<float,2>{0.694158852f, 0.31013903f},
-std::array<float,2>{0.260396481f, 0.666761816f},
-std::array<float,2>{0.10730505f, 0.0174351744f},
-std::array<float,2>{0.78238529f, 0.863548815f},
-std::array<float,2>{0.901485264f, 0.230553627f},
-std::array<float,2>{0.211918399f, 0.968042374f},
-std::array<float,2>{0.458484709f, 0.480564833f},
-std::array<float,2>{0.539993525f, 0.624243677f},
-std::array<float,2>{0.982232094f, 0.370035976f},
-std::array<float,2>{0.152708322f, 0.703982055f},
-std::array<float,2>{0.413174212f, 0.116534539f},
-std::array<float,2>{0.569537103f, 0.801217675f},
-std::array<float,2>{0.650991142f, 0.165335655f},
-std::array<float,2>{0.353403777f, 0.886897922f},
-std::array<float,2>{0.0505751371f, 0.405176401f},
-std::array<float,2>{0.817993701f, 0.53848207f},
-std::array<float,2>{0.501245856f, 0.452541053f},
-std::array<float,2>{0.488621473f, 0.577031434f},
-std::array<float,2>{0.245161936f, 0.197659656f},
-std::array<float,2>{0.934391618f, 0.979741573f},
-std::array<float,2>{0.761618793f, 0.0605712533f},
-std::array<float,2>{0.0827563405f, 0.812811434f},
-std::array<float,2>{0.302298993f, 0.256301433f},
-std::array<float,2>{0.739987433f, 0.635713458f},
-std::array<float,2>{0.913838148f, 0.496329248f},
-std::array<float,2>{0.219399795f, 0.606002808f},
-std::array<float,2>{0.482927561f, 0.245216221f},
-std::array<float,2>{0.524000645f, 0.946001589f},
-std::array<float,2>{0.733951509f, 0.00516072242f},
-std::array<float,2>{0.292377174f, 0.846909285f},
-std::array<float,2>{0.0759905875f, 0.291902453f},
-std::array<float,2>{0.766614616f, 0.681733429f},
-std::array<float,2>{0.591517031f, 0.335867107f},
-std::array<float,2>{0.423369914f, 0.733181834f},
-std::array<float,2>{0.12599647f, 0.0679576397f},
-std::array<float,2>{0.989387691f, 0.776973367f},
-std::array<float,2>{0.833767712f, 0.132040083f},
-std::array<float,2>{0.0411662683f, 0.928304374f},
-std::array<float,2>{0.369553924f, 0.424415529f},
-std::array<float,2>{0.633057952f, 0.508294761f},
-std::array<float,2>{0.800604761f, 0.268023133f},
-std::array<float,2>{0.113475002f, 0.65292412f},
-std::array<float,2>{0.271104932f, 0.0408052206f},
-std::array<float,2>{0.71332711f, 0.831968904f},
-std::array<float,2>{0.560603559f, 0.209664032f},
-std::array<float,2>{0.451491803f, 0.992929399f},
-std::array<float,2>{0.198570147f, 0.46863988f},
-std::array<float,2>{0.877132714f, 0.589561582f},
-std::array<float,2>{0.685448766f, 0.377784818f},
-std::array<float,2>{0.321822435f, 0.553172171f},
-std::array<float,2>{0.00331061124f, 0.178944275f},
-std::array<float,2>{0.847657263f, 0.901653826f},
-std::array<float,2>{0.952445209f, 0.102895096f},
-std::array<float,2>{0.17117016f, 0.78683269f},
-std::array<float,2>{0.38043493f, 0.358874887f},
-std::array<float,2>{0.62460202f, 0.693344235f},
-std::array<float,2>{0.787880182f, 0.38428542f},
-std::array<float,2>{0.103599302f, 0.558532596f},
-std::array<float,2>{0.264756799f, 0.182328209f},
-std::array<float,2>{0.68806541f, 0.891080618f},
-std::array<float,2>{0.544269562f, 0.0976182893f},
-std::array<float,2>{0.455740094f, 0.7927531f},
-std::array<float,2>{0.217169613f, 0.348000407f},
-std::array<float,2>{0.904604077f, 0.697633982f},
-std::array<float,2>{0.660324216f, 0.279917687f},
-std::array<float,2>{0.336024761f, 0.64098078f},
-std::array<float,2>{0.015915975f, 0.0370710157f},
-std::array<float,2>{0.873203099f, 0.838793039f},
-std::array<float,2>{0.956869185f, 0.212108001f},
-std::array<float,2>{0.176459536f, 0.987936318f},
-std::array<float,2>{0.399972767f, 0.453638732f},
-std::array<float,2>{0.606662393f, 0.585070193f},
-std::array<float,2>{0.930488348f, 0.336428583f},
-std::array<float,2>{0.248568535f, 0.723122478f},
-std::array<float,2>{0.486977041f, 0.0775622278f},
-std::array<float,2>{0.505836725f, 0.766056299f},
-std::array<float,2>{0.73801136f, 0.139550626f},
-std::array<float,2>{0.298055589f, 0.93265754f},
-std::array<float,2>{0.0796748325f, 0.434108078f},
-std::array<float,2>{0.762827218f, 0.502540886f},
-std::array<float,2>{0.564675272f, 0.491950303f},
-std::array<float,2>{0.409831226f, 0.597931564f},
-std::array<float,2>{0.151985824f, 0.23679243f},
-std::array<float,2>{0.978797138f, 0.939708471f},
-std::array<float,2>{0.815256119f, 0.0121651292f},
-std::array<float,2>{0.0538654737f, 0.856667697f},
-std::array<float,2>{0.356856197f, 0.284903884f},
-std::array<float,2>{0.655530751f, 0.672156811f},
-std::array<float,2>{0.986167669f, 0.442819834f},
-std::array<float,2>{0.131890208f, 0.565665126f},
-std::array<float,2>{0.42806977f, 0.194499865f},
-std::array<float,2>{0.58618784f, 0.971308947f},
-std::array<float,2>{0.639917552f, 0.0522427224f},
-std::array<float,2>{0.371362865f, 0.82343936f},
-std::array<float,2>{0.0441774391f, 0.263261139f},
-std::array<float,2>{0.828248322f, 0.630319834f},
-std::array<float,2>{0.528993249f, 0.363484025f},
-std::array<float,2>{0.478435725f, 0.718648136f},
-std::array<float,2>{0.223229975f, 0.119813725f},
-std::array<float,2>{0.908477306f, 0.805009305f},
-std::array<float,2>{0.772701144f, 0.159608126f},
-std::array<float,2>{0.0715426803f, 0.879069626f},
-std::array<float,2>{0.296327025f, 0.397090077f},
-std::array<float,2>{0.726832032f, 0.539855361f},
-std::array<float,2>{0.84690696f, 0.300876707f},
-std::array<float,2>{0.0039599766f, 0.662056386f},
-std::array<float,2>{0.324334592f, 0.0278372169f},
-std::array<float,2>{0.680185616f, 0.868066967f},
-std::array<float,2>{0.619771123f, 0.221710682f},
-std::array<float,2>{0.375502467f, 0.958926141f},
-std::array<float,2>{0.166968748f, 0.476168156f},
-std::array<float,2>{0.945361257f, 0.613497972f},
-std::array<float,2>{0.71872735f, 0.408134431f},
-std::array<float,2>{0.26886788f, 0.526719332f},
-std::array<float,2>{0.110810317f, 0.153704211f},
-std::array<float,2>{0.802841663f, 0.911309242f},
-std::array<float,2>{0.880284965f, 0.0905452222f},
-std::array<float,2>{0.200410992f, 0.755502284f},
-std::array<float,2>{0.446412086f, 0.316471964f},
-std::array<float,2>{0.556746066f, 0.745512843f},
-std::array<float,2>{0.839871585f, 0.477363288f},
-std::array<float,2>{0.0377537049f, 0.617188454f},
-std::array<float,2>{0.366875291f, 0.228186473f},
-std::array<float,2>{0.632269502f, 0.96132201f},
-std::array<float,2>{0.583390951f, 0.0204741992f},
-std::array<float,2>{0.435440868f, 0.859642744f},
-std::array<float,2>{0.139851898f, 0.30526951f},
-std::array<float,2>{0.998608112f, 0.668974996f},
-std::array<float,2>{0.723646104f, 0.320496708f},
-std::array<float,2>{0.283364475f, 0.740964234f},
-std::array<float,2>{0.069168292f, 0.0848447233f},
-std::array<float,2>{0.7739802f, 0.758537233f},
-std::array<float,2>{0.91569382f, 0.142294496f},
-std::array<float,2>{0.231024384f, 0.920514703f},
-std::array<float,2>{0.476098388f, 0.418928981f},
-std::array<float,2>{0.520233214f, 0.521112323f},
-std::array<float,2>{0.943645298f, 0.252922803f},
-std::array<float,2>{0.162938833f, 0.639532864f},
-std::array<float,2>{0.383473605f, 0.0568528213f},
-std::array<float,2>{0.613838136f, 0.817075491f},
-std::array<float,2>{0.676046848f, 0.200855628f},
-std::array<float,2>{0.313395828f, 0.983662307f},
-std::array<float,2>{0.0106461858f, 0.447870404f},
-std::array<float,2>{0.857851207f, 0.573141396f},
-std::array<float,2>{0.548357964f, 0.401006609f},
-std::array<float,2>{0.445190549f, 0.532433689f},
-std::array<float,2>{0.192430943f, 0.170559675f},
-std::array<float,2>{0.88494426f, 0.883252203f},
-std::array<float,2>{0.810084939f, 0.110304393f},
-std::array<float,2>{0.124239244f, 0.798748136f},
-std::array<float,2>{0.273925692f, 0.371556073f},
-std::array<float,2>{0.70790267f, 0.708662629f},
-std::array<float,2>{0.895581782f, 0.426094323f},
-std::array<float,2>{0.205263168f, 0.512712717f},
-std::array<float,2>{0.46761784f, 0.126936346f},
-std::array<float,2>{0.535111666f, 0.924362779f},
-std::array<float,2>{0.701772273f, 0.0655937716f},
-std::array<float,2>{0.253284872f, 0.778051257f},
-std::array<float,2>{0.0962410346f, 0.33198601f},
-std::array<float,2>{0.791159511f, 0.727518857f},
-std::array<float,2>{0.596282184f, 0.295766801f},
-std::array<float,2>{0.395080775f, 0.685716212f},
-std::array<float,2>{0.185939103f, 0.00121064647f},
-std::array<float,2>{0.961723208f, 0.847939432f},
-std::array<float,2>{0.85949862f, 0.246862516f},
-std::array<float,2>{0.0237930007f, 0.949657142f},
-std::array<float,2>{0.332111895f, 0.495229363f},
-std::array<float,2>{0.669443429f, 0.604706705f},
-std::array<float,2>{0.750633299f, 0.35485059f},
-std::array<float,2>{0.0882851332f, 0.687831879f},
-std::array<float,2>{0.311026245f, 0.108457491f},
-std::array<float,2>{0.749701142f, 0.782410502f},
-std::array<float,2>{0.51041913f, 0.17310968f},
-std::array<float,2>{0.494953573f, 0.903835297f},
-std::array<float,2>{0.241284221f, 0.381774753f},
-std::array<float,2>{0.926264822f, 0.5483585f},
-std::array<float,2>{0.64822042f, 0.462655127f},
-std::array<float,2>{0.351530313f, 0.591551423f},
-std::array<float,2>{0.0563594103f, 0.205863535f},
-std::array<float,2>{0.82104528f, 0.999340177f},
-std::array<float,2>{0.969674826f, 0.0449143238f},
-std::array<float,2>{0.148273855f, 0.832293332f},
-std::array<float,2>{0.41623199f, 0.269578815f},
-std::array<float,2>{0.573312461f, 0.64924562f},
-std::array<float,2>{0.808458745f, 0.485477835f},
-std::array<float,2>{0.120101146f, 0.597540259f},
-std::array<float,2>{0.278713852f, 0.23901324f},
-std::array<float,2>{0.706542969f, 0.942862213f},
-std::array<float,2>{0.551286697f, 0.0110715544f},
-std::array<float,2>{0.439873457f, 0.852053761f},
-std::array<float,2>{0.188303307f, 0.287796736f},
-std::array<float,2>{0.888967872f, 0.677626967f},
-std::array<float,2>{0.675167918f, 0.341678649f},
-std::array<float,2>{0.317800045f, 0.719382107f},
-std::array<float,2>{0.0130558237f, 0.073632881f},
-std::array<float,2>{0.851590335f, 0.771139264f},
-std::array<float,2>{0.940679908f, 0.134961858f},
-std::array<float,2>{0.158040822f, 0.937416375f},
-std::array<float,2>{0.386906445f, 0.430746585f},
-std::array<float,2>{0.612495303f, 0.504452765f},
-std::array<float,2>{0.918030322f, 0.276830226f},
-std::array<float,2>{0.230238497f, 0.644738019f},
-std::array<float,2>{0.471365213f, 0.0318238772f},
-std::array<float,2>{0.517664671f, 0.843638599f},
-std::array<float,2>{0.721104443f, 0.217268869f},
-std::array<float,2>{0.287229359f, 0.990596592f},
-std::array<float,2>{0.0659971759f, 0.460933387f},
-std::array<float,2>{0.779111207f, 0.580069542f},
-std::array<float,2>{0.579597712f, 0.386783004f},
-std::array<float,2>{0.432233125f, 0.559089005f},
-std::array<float,2>{0.133002356f, 0.184460893f},
-std::array<float,2>{0.994373262f, 0.89602983f},
-std::array<float,2>{0.837617695f, 0.0997972041f},
-std::array<float,2>{0.0336074196f, 0.794629276f},
-std::array<float,2>{0.359991729f, 0.343850464f},
-std::array<float,2>{0.626229942f, 0.702533364f},
-std::array<float,2>{0.974979043f, 0.412658662f},
-std::array<float,2>{0.144248903f, 0.531180322f},
-std::array<float,2>{0.418705374f, 0.151533306f},
-std::array<float,2>{0.575056195f, 0.908738673f},
-std::array<float,2>{0.64146018f, 0.0876813233f},
-std::array<float,2>{0.346795917f, 0.750126243f},
-std::array<float,2>{0.0597206987f, 0.312532008f},
-std::array<float,2>{0.827845514f, 0.748466909f},
-std::array<float,2>{0.512521267f, 0.298749536f},
-std::array<float,2>{0.498524189f, 0.656721175f},
-std::array<float,2>{0.236663759f, 0.0252394099f},
-std::array<float,2>{0.925721347f, 0.871291399f},
-std::array<float,2>{0.755864024f, 0.225309268f},
-std::array<float,2>{0.0931169316f, 0.955166459f},
-std::array<float,2>{0.30623588f, 0.471816748f},
-std::array<float,2>{0.744842291f, 0.610537887f},
-std::array<float,2>{0.864006698f, 0.36004445f},
-std::array<float,2>{0.0302970316f, 0.713768959f},
-std::array<float,2>{0.328763962f, 0.122425392f},
-std::array<float,2>{0.665887713f, 0.808643281f},
-std::array<float,2>{0.601404428f, 0.163615659f},
-std::array<float,2>{0.394391865f, 0.877642989f},
-std::array<float,2>{0.180483624f, 0.393946588f},
-std::array<float,2>{0.967269599f, 0.54331851f},
-std::array<float,2>{0.698491514f, 0.440023005f},
-std::array<float,2>{0.255316973f, 0.568550467f},
-std::array<float,2>{0.0988767147f, 0.190877065f},
-std::array<float,2>{0.795873523f, 0.973907113f},
-std::array<float,2>{0.892846942f, 0.0475110672f},
-std::array<float,2>{0.209599316f, 0.828056455f},
-std::array<float,2>{0.461270243f, 0.259848148f},
-std::array<float,2>{0.537040353f, 0.628880799f},
-std::array<float,2>{0.819909453f, 0.403379947f},
-std::array<float,2>{0.0482257791f, 0.536341071f},
-std::array<float,2>{0.354471833f, 0.167591602f},
-std::array<float,2>{0.649439692f, 0.889026105f},
-std::array<float,2>{0.567202508f, 0.11359778f},
-std::array<float,2>{0.411740392f, 0.803987563f},
-std::array<float,2>{0.155947015f, 0.36755529f},
-std::array<float,2>{0.983121693f, 0.706787527f},
-std::array<float,2>{0.741004169f, 0.254620999f},
-std::array<float,2>{0.303658396f, 0.634393871f},
-std::array<float,2>{0.0851027742f, 0.0602142811f},
-std::array<float,2>{0.758064926f, 0.814622819f},
-std::array<float,2>{0.937353849f, 0.195685416f},
-std::array<float,2>{0.243167251f, 0.977198422f},
-std::array<float,2>{0.490803152f, 0.449340373f},
-std::array<float,2>{0.503320336f, 0.576149464f},
-std::array<float,2>{0.96024245f, 0.326215565f},
-std::array<float,2>{0.175479695f, 0.738230288f},
-std::array<float,2>{0.405487299f, 0.0815113708f},
-std::array<float,2>{0.603318036f, 0.762848794f},
-std::array<float,2>{0.657265544f, 0.147959456f},
-std::array<float,2>{0.342213809f, 0.914327621f},
-std::array<float,2>{0.0224808138f, 0.415225923f},
-std::array<float,2>{0.868313015f, 0.517703533f},
-std::array<float,2>{0.542753696f, 0.483883411f},
-std::array<float,2>{0.460220635f, 0.621210635f},
-std::array<float,2>{0.213484898f, 0.23320289f},
-std::array<float,2>{0.899239361f, 0.9661479f},
-std::array<float,2>{0.784133315f, 0.0180359967f},
-std::array<float,2>{0.107850261f, 0.865650594f},
-std::array<float,2>{0.258954763f, 0.311159968f},
-std::array<float,2>{0.691800833f, 0.66431576f},
-std::array<float,2>{0.876351655f, 0.465991348f},
-std::array<float,2>{0.196579322f, 0.58634299f},
-std::array<float,2>{0.450745583f, 0.20822385f},
-std::array<float,2>{0.55998534f, 0.995046318f},
-std::array<float,2>{0.712687492f, 0.0426921397f},
-std::array<float,2>{0.272746205f, 0.829173863f},
-std::array<float,2>{0.116335019f, 0.267261118f},
-std::array<float,2>{0.798412681f, 0.656203568f},
-std::array<float,2>{0.62110728f, 0.356318146f},
-std::array<float,2>{0.382309377f, 0.693787456f},
-std::array<float,2>{0.168410048f, 0.104243025f},
-std::array<float,2>{0.950923562f, 0.788736701f},
-std::array<float,2>{0.850034773f, 0.176084369f},
-std::array<float,2>{0.000394659408f, 0.899129152f},
-std::array<float,2>{0.324073792f, 0.376184464f},
-std::array<float,2>{0.685600758f, 0.552126884f},
-std::array<float,2>{0.768637836f, 0.289358407f},
-std::array<float,2>{0.0762244761f, 0.680212915f},
-std::array<float,2>{0.289953113f, 0.00675741583f},
-std::array<float,2>{0.73196131f, 0.84405601f},
-std::array<float,2>{0.52663219f, 0.243138f},
-std::array<float,2>{0.481978595f, 0.948680401f},
-std::array<float,2>{0.22264573f, 0.499466002f},
-std::array<float,2>{0.911691785f, 0.607471824f},
-std::array<float,2>{0.635132313f, 0.423786938f},
-std::array<float,2>{0.368723035f, 0.509915352f},
-std::array<float,2>{0.0396910273f, 0.129838243f},
-std::array<float,2>{0.835748017f, 0.926882505f},
-std::array<float,2>{0.990689099f, 0.0702621937f},
-std::array<float,2>{0.127414912f, 0.77531594f},
-std::array<float,2>{0.424697757f, 0.33238405f},
-std::array<float,2>{0.593634486f, 0.731617272f},
-std::array<float,2>{0.764656305f, 0.435788333f},
-std::array<float,2>{0.0816232264f, 0.500805259f},
-std::array<float,2>{0.29935804f, 0.138524532f},
-std::array<float,2>{0.735599995f, 0.930728257f},
-std::array<float,2>{0.5074898f, 0.0756039545f},
-std::array<float,2>{0.484743297f, 0.767880738f},
-std::array<float,2>{0.247852907f, 0.339552253f},
-std::array<float,2>{0.932758749f, 0.726541042f},
-std::array<float,2>{0.653845489f, 0.282070041f},
-std::array<float,2>{0.358951509f, 0.675477803f},
-std::array<float,2>{0.0511179492f, 0.0149916029f},
-std::array<float,2>{0.812703013f, 0.858200133f},
-std::array<float,2>{0.977239609f, 0.236067712f},
-std::array<float,2>{0.150306672f, 0.938357353f},
-std::array<float,2>{0.407532781f, 0.489968598f},
-std::array<float,2>{0.562901676f, 0.600433528f},
-std::array<float,2>{0.903770268f, 0.34989053f},
-std::array<float,2>{0.215556532f, 0.695527375f},
-std::array<float,2>{0.454241991f, 0.0947292149f},
-std::array<float,2>{0.545586646f, 0.78931886f},
-std::array<float,2>{0.690106809f, 0.181070358f},
-std::array<float,2>{0.263121665f, 0.893618166f},
-std::array<float,2>{0.103420086f, 0.386493444f},
-std::array<float,2>{0.785624325f, 0.555272162f},
-std::array<float,2>{0.607581317f, 0.45674783f},
-std::array<float,2>{0.40109089f, 0.582469523f},
-std::array<float,2>{0.179388136f, 0.214267164f},
-std::array<float,2>{0.953504145f, 0.985408247f},
-std::array<float,2>{0.871762216f, 0.0390314199f},
-std::array<float,2>{0.0190856792f, 0.837250769f},
-std::array<float,2>{0.339470059f, 0.277880013f},
-std::array<float,2>{0.664040208f, 0.644187033f},
-std::array<float,2>{0.948183894f, 0.47350347f},
-std::array<float,2>{0.164379701f, 0.616018891f},
-std::array<float,2>{0.377408803f, 0.21999003f},
-std::array<float,2>{0.617845178f, 0.959836662f},
-std::array<float,2>{0.683385968f, 0.0293451548f},
-std::array<float,2>{0.32688874f, 0.870753288f},
-std::array<float,2>{0.00764933042f, 0.303972483f},
-std::array<float,2>{0.845674992f, 0.663820207f},
-std::array<float,2>{0.555700302f, 0.318528414f},
-std::array<float,2>{0.447492391f, 0.743853569f},
-std::array<float,2>{0.201578781f, 0.0926337019f},
-std::array<float,2>{0.881300926f, 0.757186115f},
-std::array<float,2>{0.801687658f, 0.155019671f},
-std::array<float,2>{0.112081505f, 0.912306011f},
-std::array<float,2>{0.266795695f, 0.408964485f},
-std::array<float,2>{0.715224802f, 0.523712873f},
-std::array<float,2>{0.831482351f, 0.263781071f},
-std::array<float,2>{0.0455769002f, 0.632395864f},
-std::array<float,2>{0.374754041f, 0.0536531731f},
-std::array<float,2>{0.637133777f, 0.821249604f},
-std::array<float,2>{0.588213682f, 0.192268416f},
-std::array<float,2>{0.426935554f, 0.968928635f},
-std::array<float,2>{0.128970847f, 0.444296718f},
-std::array<float,2>{0.987878084f, 0.562644243f},
-std::array<float,2>{0.729088724f, 0.395053834f},
-std::array<float,2>{0.293243885f, 0.541384995f},
-std::array<float,2>{0.0731320232f, 0.156754076f},
-std::array<float,2>{0.77037406f, 0.881009579f},
-std::array<float,2>{0.906981409f, 0.118757628f},
-std::array<float,2>{0.226540893f, 0.808227956f},
-std::array<float,2>{0.479320884f, 0.36595422f},
-std::array<float,2>{0.52999109f, 0.716586649f},
-std::array<float,2>{0.856980801f, 0.445833892f},
-std::array<float,2>{0.00784628559f, 0.571495414f},
-std::array<float,2>{0.315109819f, 0.20278661f},
-std::array<float,2>{0.679424942f, 0.980872214f},
-std::array<float,2>{0.616069734f, 0.0554005839f},
-std::array<float,2>{0.385965705f, 0.820225298f},
-std::array<float,2>{0.161767617f, 0.251340032f},
-std::array<float,2>{0.942487717f, 0.637672842f},
-std::array<float,2>{0.710152447f, 0.37407437f},
-std::array<float,2>{0.276905388f, 0.710377455f},
-std::array<float,2>{0.122559175f, 0.111689173f},
-std::array<float,2>{0.811578631f, 0.799687743f},
-std::array<float,2>{0.88339293f, 0.168824688f},
-std::array<float,2>{0.194354668f, 0.885576725f},
-std::array<float,2>{0.441713661f, 0.399502277f},
-std::array<float,2>{0.550036311f, 0.533602059f},
-std::array<float,2>{0.997178674f, 0.306657434f},
-std::array<float,2>{0.137463406f, 0.671215594f},
-std::array<float,2>{0.437266171f, 0.0234283078f},
-std::array<float,2>{0.585285425f, 0.861945987f},
-std::array<float,2>{0.630695105f, 0.229161009f},
-std::array<float,2>{0.364325374f, 0.963934362f},
-std::array<float,2>{0.0368121527f, 0.479837269f},
-std::array<float,2>{0.842063785f, 0.620889008f},
-std::array<float,2>{0.521741688f, 0.421052039f},
-std::array<float,2>{0.4730694f, 0.523226917f},
-std::array<float,2>{0.233700171f, 0.143269345f},
-std::array<float,2>{0.91602236f, 0.91845417f},
-std::array<float,2>{0.775608957f, 0.0831559375f},
-std::array<float,2>{0.0677932799f, 0.760823786f},
-std::array<float,2>{0.281284481f, 0.323473781f},
-std::array<float,2>{0.726374507f, 0.738869846f},
-std::array<float,2>{0.929338753f, 0.380693167f},
-std::array<float,2>{0.239184678f, 0.5497576f},
-std::array<float,2>{0.492769927f, 0.175532207f},
-std::array<float,2>{0.508646131f, 0.905083239f},
-std::array<float,2>{0.746336281f, 0.106617838f},
-std::array<float,2>{0.30997467f, 0.783545077f},
-std::array<float,2>{0.0865510255f, 0.353127748f},
-std::array<float,2>{0.752502084f, 0.691165149f},
-std::array<float,2>{0.571071744f, 0.271711618f},
-std::array<float,2>{0.415265232f, 0.650871038f},
-std::array<float,2>{0.146376491f, 0.0467139147f},
-std::array<float,2>{0.971455097f, 0.835431516f},
-std::array<float,2>{0.822272658f, 0.203731984f},
-std::array<float,2>{0.0569867864f, 0.997819304f},
-std::array<float,2>{0.348723292f, 0.463237405f},
-std::array<float,2>{0.646234393f, 0.593564391f},
-std::array<float,2>{0.789172888f, 0.328758031f},
-std::array<float,2>{0.0948355049f, 0.729919672f},
-std::array<float,2>{0.251578003f, 0.0637369901f},
-std::array<float,2>{0.699848652f, 0.780323386f},
-std::array<float,2>{0.531687379f, 0.127778634f},
-std::array<float,2>{0.466593355f, 0.922170103f},
-std::array<float,2>{0.203790471f, 0.429115325f},
-std::array<float,2>{0.898374498f, 0.514462531f},
-std::array<float,2>{0.670694232f, 0.493029714f},
-std::array<float,2>{0.33544606f, 0.60239619f},
-std::array<float,2>{0.0265418626f, 0.249466836f},
-std::array<float,2>{0.861384213f, 0.952884376f},
-std::array<float,2>{0.963095129f, 0.00324220257f},
-std::array<float,2>{0.184809148f, 0.850090027f},
-std::array<float,2>{0.396888852f, 0.293442756f},
-std::array<float,2>{0.594059706f, 0.683884263f},
-std::array<float,2>{0.767466903f, 0.499888927f},
-std::array<float,2>{0.0753453672f, 0.608160555f},
-std::array<float,2>{0.292868674f, 0.242657259f},
-std::array<float,2>{0.733534932f, 0.949191391f},
-std::array<float,2>{0.52356559f, 0.00623909198f},
-std::array<float,2>{0.48279348f, 0.844681621f},
-std::array<float,2>{0.218917921f, 0.28968361f},
-std::array<float,2>{0.913218498f, 0.680129826f},
-std::array<float,2>{0.6336146f, 0.332705855f},
-std::array<float,2>{0.369706184f, 0.732251048f},
-std::array<float,2>{0.0415301658f, 0.0697027445f},
-std::array<float,2>{0.833483517f, 0.774441481f},
-std::array<float,2>{0.989959657f, 0.129354149f},
-std::array<float,2>{0.126875401f, 0.927597642f},
-std::array<float,2>{0.423215836f, 0.422856629f},
-std::array<float,2>{0.591103852f, 0.51046139f},
-std::array<float,2>{0.877681136f, 0.266845047f},
-std::array<float,2>{0.19913885f, 0.655725241f},
-std::array<float,2>{0.452128679f, 0.0422470756f},
-std::array<float,2>{0.561465681f, 0.829667926f},
-std::array<float,2>{0.713725567f, 0.208520934f},
-std::array<float,2>{0.270828128f, 0.994590759f},
-std::array<float,2>{0.113978885f, 0.466374099f},
-std::array<float,2>{0.800140142f, 0.586746693f},
-std::array<float,2>{0.624405265f, 0.376857936f},
-std::array<float,2>{0.380331129f, 0.552394986f},
-std::array<float,2>{0.171700507f, 0.176751062f},
-std::array<float,2>{0.952646792f, 0.898791313f},
-std::array<float,2>{0.848178387f, 0.103779316f},
-std::array<float,2>{0.00373581052f, 0.788198054f},
-std::array<float,2>{0.321470499f, 0.355754048f},
-std::array<float,2>{0.684676051f, 0.694113791f},
-std::array<float,2>{0.957286239f, 0.415808111f},
-std::array<float,2>{0.173570946f, 0.518553138f},
-std::array<float,2>{0.403652579f, 0.147526324f},
-std::array<float,2>{0.604400992f, 0.915032804f},
-std::array<float,2>{0.658789158f, 0.0816324577f},
-std::array<float,2>{0.340712667f, 0.763486326f},
-std::array<float,2>{0.0198896043f, 0.326796204f},
-std::array<float,2>{0.870408595f, 0.737729311f},
-std::array<float,2>{0.539343357f, 0.310702413f},
-std::array<float,2>{0.45867005f, 0.665005803f},
-std::array<float,2>{0.212493166f, 0.0181920454f},
-std::array<float,2>{0.902327478f, 0.86607039f},
-std::array<float,2>{0.783180416f, 0.232465878f},
-std::array<float,2>{0.10665746f, 0.966687381f},
-std::array<float,2>{0.259911746f, 0.484193265f},
-std::array<float,2>{0.69371444f, 0.621669233f},
-std::array<float,2>{0.817719042f, 0.367883176f},
-std::array<float,2>{0.0498154908f, 0.706417143f},
-std::array<float,2>{0.352596045f, 0.114005104f},
-std::array<float,2>{0.650702477f, 0.804608166f},
-std::array<float,2>{0.570112407f, 0.167318985f},
-std::array<float,2>{0.413922489f, 0.889293671f},
-std::array<float,2>{0.153295398f, 0.40384087f},
-std::array<float,2>{0.981531799f, 0.536719859f},
-std::array<float,2>{0.739663363f, 0.450112402f},
-std::array<float,2>{0.302097589f, 0.575656593f},
-std::array<float,2>{0.0821768939f, 0.196105927f},
-std::array<float,2>{0.761222064f, 0.976613522f},
-std::array<float,2>{0.933933318f, 0.0598540269f},
-std::array<float,2>{0.245782927f, 0.814952254f},
-std::array<float,2>{0.488965303f, 0.25414744f},
-std::array<float,2>{0.501628757f, 0.63400954f},
-std::array<float,2>{0.86542964f, 0.394354165f},
-std::array<float,2>{0.0289103966f, 0.543611646f},
-std::array<float,2>{0.33159557f, 0.16314432f},
-std::array<float,2>{0.666190326f, 0.877228618f},
-std::array<float,2>{0.598594904f, 0.122626707f},
-std::array<float,2>{0.391887277f, 0.80938369f},
-std::array<float,2>{0.182136819f, 0.359535068f},
-std::array<float,2>{0.965041399f, 0.71319896f},
-std::array<float,2>{0.696203053f, 0.260527104f},
-std::array<float,2>{0.256639421f, 0.628070831f},
-std::array<float,2>{0.100145318f, 0.0473370813f},
-std::array<float,2>{0.793483198f, 0.827603638f},
-std::array<float,2>{0.890777469f, 0.191162705f},
-std::array<float,2>{0.207096353f, 0.974414706f},
-std::array<float,2>{0.464653611f, 0.439877093f},
-std::array<float,2>{0.537201464f, 0.569162309f},
-std::array<float,2>{0.972974062f, 0.313090295f},
-std::array<float,2>{0.140960395f, 0.748844028f},
-std::array<float,2>{0.421071291f, 0.0872106403f},
-std::array<float,2>{0.577330053f, 0.750783682f},
-std::array<float,2>{0.642973483f, 0.152318537f},
-std::array<float,2>{0.345681846f, 0.908577085f},
-std::array<float,2>{0.0609635599f, 0.412318617f},
-std::array<float,2>{0.825401962f, 0.530612409f},
-std::array<float,2>{0.514774024f, 0.472476482f},
-std::array<float,2>{0.496508688f, 0.611115694f},
-std::array<float,2>{0.234462455f, 0.224688515f},
-std::array<float,2>{0.923561394f, 0.955731928f},
-std::array<float,2>{0.754137039f, 0.0248158574f},
-std::array<float,2>{0.0909373537f, 0.87199235f},
-std::array<float,2>{0.307670563f, 0.297959358f},
-std::array<float,2>{0.742843091f, 0.657044768f},
-std::array<float,2>{0.920017838f, 0.459998399f},
-std::array<float,2>{0.227935597f, 0.579305112f},
-std::array<float,2>{0.469011903f, 0.21751678f},
-std::array<float,2>{0.517364144f, 0.99108547f},
-std::array<float,2>{0.720534623f, 0.0312938392f},
-std::array<float,2>{0.286307931f, 0.842844784f},
-std::array<float,2>{0.0626438037f, 0.276961625f},
-std::array<float,2>{0.780294478f, 0.645245492f},
-std::array<float,2>{0.581204772f, 0.34463805f},
-std::array<float,2>{0.430756539f, 0.702688754f},
-std::array<float,2>{0.136470124f, 0.100439876f},
-std::array<float,2>{0.993646204f, 0.794178843f},
-std::array<float,2>{0.838921189f, 0.184006184f},
-std::array<float,2>{0.0326727405f, 0.895710647f},
-std::array<float,2>{0.362471879f, 0.387210697f},
-std::array<float,2>{0.628001034f, 0.558908165f},
-std::array<float,2>{0.805493176f, 0.287212282f},
-std::array<float,2>{0.117834449f, 0.67704314f},
-std::array<float,2>{0.28068614f, 0.0116967009f},
-std::array<float,2>{0.70313257f, 0.851804137f},
-std::array<float,2>{0.554448903f, 0.238767192f},
-std::array<float,2>{0.43915385f, 0.942905426f},
-std::array<float,2>{0.191001371f, 0.485855937f},
-std::array<float,2>{0.886751413f, 0.597000241f},
-std::array<float,2>{0.672579706f, 0.431263983f},
-std::array<float,2>{0.318457067f, 0.504324198f},
-std::array<float,2>{0.0137619628f, 0.135518402f},
-std::array<float,2>{0.854190111f, 0.936669528f},
-std::array<float,2>{0.938189268f, 0.0741627067f},
-std::array<float,2>{0.158656031f, 0.770513713f},
-std::array<float,2>{0.389213234f, 0.341279238f},
-std::array<float,2>{0.610842168f, 0.719099581f},
-std::array<float,2>{0.791860402f, 0.429617703f},
-std::array<float,2>{0.0958061069f, 0.514062643f},
-std::array<float,2>{0.253468663f, 0.127193555f},
-std::array<float,2>{0.701614141f, 0.922775924f},
-std::array<float,2>{0.534423411f, 0.0640861839f},
-std::array<float,2>{0.466977566f, 0.7807917f},
-std::array<float,2>{0.206033379f, 0.328399807f},
-std::array<float,2>{0.896211565f, 0.730387568f},
-std::array<float,2>{0.669255435f, 0.293518335f},
-std::array<float,2>{0.332649916f, 0.684305191f},
-std::array<float,2>{0.024163235f, 0.00364016602f},
-std::array<float,2>{0.859958231f, 0.850212932f},
-std::array<float,2>{0.96099031f, 0.24979341f},
-std::array<float,2>{0.186366245f, 0.952406943f},
-std::array<float,2>{0.394799143f, 0.492354363f},
-std::array<float,2>{0.595798433f, 0.601645648f},
-std::array<float,2>{0.926502049f, 0.352669984f},
-std::array<float,2>{0.24200429f, 0.690472066f},
-std::array<float,2>{0.494430095f, 0.107313737f},
-std::array<float,2>{0.510162175f, 0.78386867f},
-std::array<float,2>{0.749341607f, 0.175021037f},
-std::array<float,2>{0.311473846f, 0.90466249f},
-std::array<float,2>{0.0887045786f, 0.380290717f},
-std::array<float,2>{0.750440955f, 0.549182057f},
-std::array<float,2>{0.574212253f, 0.463509619f},
-std::array<float,2>{0.416912526f, 0.593237042f},
-std::array<float,2>{0.14755787f, 0.203310013f},
-std::array<float,2>{0.969144285f, 0.997434378f},
-std::array<float,2>{0.820769668f, 0.0461210646f},
-std::array<float,2>{0.0561299957f, 0.835489571f},
-std::array<float,2>{0.351073742f, 0.27220723f},
-std::array<float,2>{0.647684097f, 0.651088476f},
-std::array<float,2>{0.998292089f, 0.48004666f},
-std::array<float,2>{0.140407875f, 0.620494366f},
-std::array<float,2>{0.434776843f, 0.22888869f},
-std::array<float,2>{0.583506286f, 0.964738309f},
-std::array<float,2>{0.632646203f, 0.0226957072f},
-std::array<float,2>{0.366476357f, 0.861457348f},
-std::array<float,2>{0.0375520922f, 0.307522476f},
-std::array<float,2>{0.840528488f, 0.671744287f},
-std::array<float,2>{0.519551218f, 0.323857427f},
-std::array<float,2>{0.475725949f, 0.738585472f},
-std::array<float,2>{0.230760232f, 0.0838365331f},
-std::array<float,2>{0.915430963f, 0.761640429f},
-std::array<float,2>{0.773636103f, 0.143029481f},
-std::array<float,2>{0.0684010535f, 0.918554783f},
-std::array<float,2>{0.283900857f, 0.42149508f},
-std::array<float,2>{0.724199712f, 0.522513986f},
-std::array<float,2>{0.858029246f, 0.251570582f},
-std::array<float,2>{0.00989928655f, 0.637173593f},
-std::array<float,2>{0.31261903f, 0.054709129f},
-std::array<float,2>{0.676344097f, 0.819541454f},
-std::array<float,2>{0.613501489f, 0.202635303f},
-std::array<float,2>{0.383239299f, 0.981367767f},
-std::array<float,2>{0.162581354f, 0.445530146f},
-std::array<float,2>{0.94415617f, 0.572265327f},
-std::array<float,2>{0.707517266f, 0.400047868f},
-std::array<float,2>{0.274329454f, 0.533849001f},
-std::array<float,2>{0.124905698f, 0.168110132f},
-std::array<float,2>{0.809931457f, 0.884767234f},
-std::array<float,2>{0.885407031f, 0.111912593f},
-std::array<float,2>{0.193251386f, 0.798873901f},
-std::array<float,2>{0.444427103f, 0.374814212f},
-std::array<float,2>{0.548080921f, 0.710627317f},
-std::array<float,2>{0.828807354f, 0.44359991f},
-std::array<float,2>{0.0446768552f, 0.563400626f},
-std::array<float,2>{0.371936649f, 0.191746652f},
-std::array<float,2>{0.640221477f, 0.969676673f},
-std::array<float,2>{0.586499751f, 0.0529635064f},
-std::array<float,2>{0.428497285f, 0.820370555f},
-std::array<float,2>{0.132461935f, 0.264174581f},
-std::array<float,2>{0.985383868f, 0.632037401f},
-std::array<float,2>{0.727145374f, 0.365584075f},
-std::array<float,2>{0.296688706f, 0.71607995f},
-std::array<float,2>{0.071851708f, 0.118649729f},
-std::array<float,2>{0.77313596f, 0.807760417f},
-std::array<float,2>{0.909149706f, 0.156317934f},
-std::array<float,2>{0.222814605f, 0.881423593f},
-std::array<float,2>{0.477545023f, 0.394747972f},
-std::array<float,2>{0.528799713f, 0.54163605f},
-std::array<float,2>{0.946058333f, 0.304241121f},
-std::array<float,2>{0.166169629f, 0.663106501f},
-std::array<float,2>{0.375363976f, 0.0298436172f},
-std::array<float,2>{0.619176149f, 0.870277643f},
-std::array<float,2>{0.680020273f, 0.220457897f},
-std::array<float,2>{0.32471171f, 0.959250867f},
-std::array<float,2>{0.00467474898f, 0.47293964f},
-std::array<float,2>{0.847209692f, 0.615720212f},
-std::array<float,2>{0.557170987f, 0.408376813f},
-std::array<float,2>{0.447113901f, 0.523961067f},
-std::array<float,2>{0.20087333f, 0.154718518f},
-std::array<float,2>{0.880438805f, 0.912655354f},
-std::array<float,2>{0.803514779f, 0.0919240862f},
-std::array<float,2>{0.111321382f, 0.757345617f},
-std::array<float,2>{0.269504845f, 0.319114864f},
-std::array<float,2>{0.71810025f, 0.743371964f},
-std::array<float,2>{0.90501684f, 0.385967374f},
-std::array<float,2>{0.217368543f, 0.555110157f},
-std::array<float,2>{0.45555684f, 0.181164965f},
-std::array<float,2>{0.544914603f, 0.894236505f},
-std::array<float,2>{0.687651217f, 0.0952203274f},
-std::array<float,2>{0.265601337f, 0.789704978f},
-std::array<float,2>{0.104052946f, 0.350343078f},
-std::array<float,2>{0.787123263f, 0.696088612f},
-std::array<float,2>{0.607247055f, 0.277635872f},
-std::array<float,2>{0.399752378f, 0.644037604f},
-std::array<float,2>{0.175943494f, 0.0385399684f},
-std::array<float,2>{0.956417918f, 0.837437153f},
-std::array<float,2>{0.873938859f, 0.21465911f},
-std::array<float,2>{0.0163639747f, 0.985958099f},
-std::array<float,2>{0.336610198f, 0.456395924f},
-std::array<float,2>{0.660976648f, 0.582755923f},
-std::array<float,2>{0.763452947f, 0.33914718f},
-std::array<float,2>{0.0791212693f, 0.725742579f},
-std::array<float,2>{0.298451364f, 0.0758565217f},
-std::array<float,2>{0.737649858f, 0.768125415f},
-std::array<float,2>{0.505280256f, 0.137961626f},
-std::array<float,2>{0.486721754f, 0.93157357f},
-std::array<float,2>{0.248191148f, 0.436414152f},
-std::array<float,2>{0.929860651f, 0.500185132f},
-std::array<float,2>{0.656190038f, 0.48970443f},
-std::array<float,2>{0.357282549f, 0.599843621f},
-std::array<float,2>{0.0546040721f, 0.235548958f},
-std::array<float,2>{0.814517498f, 0.937845051f},
-std::array<float,2>{0.979322612f, 0.0153755881f},
-std::array<float,2>{0.151754707f, 0.857586503f},
-std::array<float,2>{0.409660578f, 0.281501651f},
-std::array<float,2>{0.565138936f, 0.674917936f},
-std::array<float,2>{0.798328936f, 0.468064219f},
-std::array<float,2>{0.116742544f, 0.589076877f},
-std::array<float,2>{0.273357987f, 0.209029436f},
-std::array<float,2>{0.711995363f, 0.992630184f},
-std::array<float,2>{0.560523212f, 0.040507745f},
-std::array<float,2>{0.450533181f, 0.831103563f},
-std::array<float,2>{0.197173625f, 0.26835373f},
-std::array<float,2>{0.876784861f, 0.652629197f},
-std::array<float,2>{0.686205864f, 0.359350502f},
-std::array<float,2>{0.323406905f, 0.692436993f},
-std::array<float,2>{0.000887236034f, 0.103090361f},
-std::array<float,2>{0.850525618f, 0.786420763f},
-std::array<float,2>{0.950346351f, 0.179352686f},
-std::array<float,2>{0.16884388f, 0.902001083f},
-std::array<float,2>{0.382408977f, 0.377080649f},
-std::array<float,2>{0.621817231f, 0.553452671f},
-std::array<float,2>{0.91115284f, 0.291473329f},
-std::array<float,2>{0.22170113f, 0.682606637f},
-std::array<float,2>{0.481794387f, 0.00571407471f},
-std::array<float,2>{0.526939511f, 0.847518265f},
-std::array<float,2>{0.731473029f, 0.245796591f},
-std::array<float,2>{0.289353698f, 0.945703626f},
-std::array<float,2>{0.0769333094f, 0.496644169f},
-std::array<float,2>{0.769066095f, 0.605829895f},
-std::array<float,2>{0.592884779f, 0.424195826f},
-std::array<float,2>{0.424303681f, 0.508595526f},
-std::array<float,2>{0.127859637f, 0.132483348f},
-std::array<float,2>{0.991053641f, 0.927745402f},
-std::array<float,2>{0.835265934f, 0.0677975193f},
-std::array<float,2>{0.0394267365f, 0.776832879f},
-std::array<float,2>{0.368461818f, 0.335122913f},
-std::array<float,2>{0.635548294f, 0.732834935f},
-std::array<float,2>{0.982583046f, 0.404764622f},
-std::array<float,2>{0.155373037f, 0.538946927f},
-std::array<float,2>{0.411616176f, 0.165683016f},
-std::array<float,2>{0.566744268f, 0.887528419f},
-std::array<float,2>{0.650213122f, 0.116866954f},
-std::array<float,2>{0.353795856f, 0.801501572f},
-std::array<float,2>{0.0487228483f, 0.369366258f},
-std::array<float,2>{0.819628835f, 0.70315063f},
-std::array<float,2>{0.503724277f, 0.256613463f},
-std::array<float,2>{0.490596741f, 0.635222137f},
-std::array<float,2>{0.244119674f, 0.0614830703f},
-std::array<float,2>{0.936575174f, 0.812990665f},
-std::array<float,2>{0.758693039f, 0.197874382f},
-std::array<float,2>{0.0857329741f, 0.980233133f},
-std::array<float,2>{0.302757889f, 0.452998251f},
-std::array<float,2>{0.740458786f, 0.57664746f},
-std::array<float,2>{0.869132638f, 0.324594736f},
-std::array<float,2>{0.0232399143f, 0.736226737f},
-std::array<float,2>{0.342700332f, 0.0794025511f},
-std::array<float,2>{0.657958746f, 0.764836907f},
-std::array<float,2>{0.602732539f, 0.144559264f},
-std::array<float,2>{0.405782372f, 0.91743803f},
-std::array<float,2>{0.175210401f, 0.417116642f},
-std::array<float,2>{0.960742295f, 0.516935706f},
-std::array<float,2>{0.692053318f, 0.481091708f},
-std::array<float,2>{0.259484023f, 0.624820411f},
-std::array<float,2>{0.108213805f, 0.231428906f},
-std::array<float,2>{0.783373356f, 0.96858865f},
-std::array<float,2>{0.898535907f, 0.0168317072f},
-std::array<float,2>{0.213013709f, 0.863869667f},
-std::array<float,2>{0.460883111f, 0.309647113f},
-std::array<float,2>{0.542169571f, 0.666239738f},
-std::array<float,2>{0.827499032f, 0.411710143f},
-std::array<float,2>{0.0603402704f, 0.528720498f},
-std::array<float,2>{0.347248554f, 0.1502918f},
-std::array<float,2>{0.640819073f, 0.906766653f},
-std::array<float,2>{0.574439049f, 0.0880023912f},
-std::array<float,2>{0.418320984f, 0.751963794f},
-std::array<float,2>{0.143776938f, 0.315357983f},
-std::array<float,2>{0.975469649f, 0.747353792f},
-std::array<float,2>{0.744515896f, 0.29988721f},
-std::array<float,2>{0.306060344f, 0.65934217f},
-std::array<float,2>{0.0936437473f, 0.0266007259f},
-std::array<float,2>{0.756637514f, 0.87323457f},
-std::array<float,2>{0.925249457f, 0.223696783f},
-std::array<float,2>{0.236842722f, 0.953560531f},
-std::array<float,2>{0.498951286f, 0.470043898f},
-std::array<float,2>{0.511785388f, 0.612898171f},
-std::array<float,2>{0.967716813f, 0.362292409f},
-std::array<float,2>{0.179945409f, 0.712762475f},
-std::array<float,2>{0.393798828f, 0.12362428f},
-std::array<float,2>{0.600995958f, 0.812159598f},
-std::array<float,2>{0.665043235f, 0.16201593f},
-std::array<float,2>{0.328505903f, 0.875336349f},
-std::array<float,2>{0.031080585f, 0.39180693f},
-std::array<float,2>{0.863593161f, 0.546554804f},
-std::array<float,2>{0.536377311f, 0.438156515f},
-std::array<float,2>{0.461517692f, 0.56799078f},
-std::array<float,2>{0.209250376f, 0.187892422f},
-std::array<float,2>{0.893407166f, 0.975958586f},
-std::array<float,2>{0.795156062f, 0.0490326807f},
-std::array<float,2>{0.099287875f, 0.824757934f},
-std::array<float,2>{0.255630672f, 0.259099633f},
-std::array<float,2>{0.699108183f, 0.625265539f},
-std::array<float,2>{0.88939631f, 0.488236696f},
-std::array<float,2>{0.187752813f, 0.595348477f},
-std::array<float,2>{0.440312058f, 0.241295055f},
-std::array<float,2>{0.551158965f, 0.944761693f},
-std::array<float,2>{0.706882656f, 0.00810806546f},
-std::array<float,2>{0.278857291f, 0.855315328f},
-std::array<float,2>{0.119414456f, 0.285919219f},
-std::array<float,2>{0.80800724f, 0.679229915f},
-std::array<float,2>{0.613128841f, 0.342269957f},
-std::array<float,2>{0.387554139f, 0.721585929f},
-std::array<float,2>{0.157270312f, 0.0716440156f},
-std::array<float,2>{0.940975189f, 0.77318424f},
-std::array<float,2>{0.852147698f, 0.133021742f},
-std::array<float,2>{0.0134513453f, 0.935436308f},
-std::array<float,2>{0.31833443f, 0.433555931f},
-std::array<float,2>{0.675319791f, 0.506611943f},
-std::array<float,2>{0.778430343f, 0.27520296f},
-std::array<float,2>{0.0654682517f, 0.647318423f},
-std::array<float,2>{0.287721813f, 0.0334662385f},
-std::array<float,2>{0.721404374f, 0.841607392f},
-std::array<float,2>{0.518259525f, 0.215433598f},
-std::array<float,2>{0.471083999f, 0.989275634f},
-std::array<float,2>{0.229751572f, 0.458946198f},
-std::array<float,2>{0.918701291f, 0.581723154f},
-std::array<float,2>{0.626515448f, 0.389294922f},
-std::array<float,2>{0.359428465f, 0.562266588f},
-std::array<float,2>{0.0341636911f, 0.185940474f},
-std::array<float,2>{0.837368369f, 0.897032261f},
-std::array<float,2>{0.994776011f, 0.0981338695f},
-std::array<float,2>{0.13336952f, 0.795253932f},
-std::array<float,2>{0.432039976f, 0.347412318f},
-std::array<float,2>{0.579587042f, 0.700616181f},
-std::array<float,2>{0.752075911f, 0.381086648f},
-std::array<float,2>{0.086235106f, 0.54832077f},
-std::array<float,2>{0.310083359f, 0.173455909f},
-std::array<float,2>{0.747011721f, 0.903633296f},
-std::array<float,2>{0.508059025f, 0.109177671f},
-std::array<float,2>{0.492270261f, 0.783015072f},
-std::array<float,2>{0.238598481f, 0.355089426f},
-std::array<float,2>{0.929159641f, 0.688148975f},
-std::array<float,2>{0.645962298f, 0.270331651f},
-std::array<float,2>{0.349348843f, 0.648826241f},
-std::array<float,2>{0.0575390086f, 0.0441792607f},
-std::array<float,2>{0.823042393f, 0.833003163f},
-std::array<float,2>{0.971028447f, 0.205551609f},
-std::array<float,2>{0.145860091f, 0.999646485f},
-std::array<float,2>{0.415829092f, 0.462049961f},
-std::array<float,2>{0.570580304f, 0.590912879f},
-std::array<float,2>{0.897693455f, 0.331198096f},
-std::array<float,2>{0.203140065f, 0.727041006f},
-std::array<float,2>{0.466210604f, 0.0659515709f},
-std::array<float,2>{0.531827271f, 0.777457595f},
-std::array<float,2>{0.699697256f, 0.1261352f},
-std::array<float,2>{0.251253486f, 0.92426461f},
-std::array<float,2>{0.0953836069f, 0.426451355f},
-std::array<float,2>{0.78965646f, 0.513394535f},
-std::array<float,2>{0.594310939f, 0.495666414f},
-std::array<float,2>{0.397246718f, 0.60506779f},
-std::array<float,2>{0.185414135f, 0.246287733f},
-std::array<float,2>{0.963718653f, 0.949850261f},
-std::array<float,2>{0.862227678f, 0.00178455655f},
-std::array<float,2>{0.0272951107f, 0.848625124f},
-std::array<float,2>{0.335544527f, 0.295314938f},
-std::array<float,2>{0.67017746f, 0.686246276f},
-std::array<float,2>{0.943171263f, 0.447603524f},
-std::array<float,2>{0.161558613f, 0.572532415f},
-std::array<float,2>{0.386591136f, 0.200466126f},
-std::array<float,2>{0.615513146f, 0.98406142f},
-std::array<float,2>{0.679098248f, 0.0574328043f},
-std::array<float,2>{0.314806819f, 0.816608727f},
-std::array<float,2>{0.00833683554f, 0.252047986f},
-std::array<float,2>{0.856462836f, 0.638880074f},
-std::array<float,2>{0.55034858f, 0.371693552f},
-std::array<float,2>{0.442373186f, 0.708374083f},
-std::array<float,2>{0.195123345f, 0.109782889f},
-std::array<float,2>{0.88308239f, 0.798262775f},
-std::array<float,2>{0.812261462f, 0.169922322f},
-std::array<float,2>{0.122334644f, 0.883672774f},
-std::array<float,2>{0.276611656f, 0.400487185f},
-std::array<float,2>{0.710856795f, 0.53300339f},
-std::array<float,2>{0.842325509f, 0.304818273f},
-std::array<float,2>{0.0366083682f, 0.669495881f},
-std::array<float,2>{0.365229845f, 0.0195991453f},
-std::array<float,2>{0.629957914f, 0.86000222f},
-std::array<float,2>{0.585508347f, 0.227661133f},
-std::array<float,2>{0.436689019f, 0.961593688f},
-std::array<float,2>{0.136780873f, 0.476999134f},
-std::array<float,2>{0.9976331f, 0.618038893f},
-std::array<float,2>{0.725769997f, 0.418388516f},
-std::array<float,2>{0.28174156f, 0.520602226f},
-std::array<float,2>{0.0683390871f, 0.14196068f},
-std::array<float,2>{0.776121497f, 0.920306087f},
-std::array<float,2>{0.916524649f, 0.0842675567f},
-std::array<float,2>{0.234225988f, 0.758022726f},
-std::array<float,2>{0.473446369f, 0.320841461f},
-std::array<float,2>{0.522315562f, 0.740466356f},
-std::array<float,2>{0.845014274f, 0.476045996f},
-std::array<float,2>{0.0071766586f, 0.613878191f},
-std::array<float,2>{0.326659322f, 0.222481281f},
-std::array<float,2>{0.683047295f, 0.958462358f},
-std::array<float,2>{0.617236793f, 0.0276685096f},
-std::array<float,2>{0.377855659f, 0.867350042f},
-std::array<float,2>{0.164590821f, 0.30141589f},
-std::array<float,2>{0.947448432f, 0.661199093f},
-std::array<float,2>{0.715630352f, 0.317190021f},
-std::array<float,2>{0.267312735f, 0.745875001f},
-std::array<float,2>{0.111390382f, 0.0901155919f},
-std::array<float,2>{0.800927699f, 0.755102694f},
-std::array<float,2>{0.88155669f, 0.154003754f},
-std::array<float,2>{0.202003077f, 0.911989212f},
-std::array<float,2>{0.448155582f, 0.40738833f},
-std::array<float,2>{0.556327343f, 0.526930809f},
-std::array<float,2>{0.987347841f, 0.262878567f},
-std::array<float,2>{0.129480407f, 0.630738199f},
-std::array<float,2>{0.427270979f, 0.0525167212f},
-std::array<float,2>{0.588757753f, 0.823930562f},
-std::array<float,2>{0.637538075f, 0.195083618f},
-std::array<float,2>{0.374489814f, 0.970787168f},
-std::array<float,2>{0.0452618189f, 0.443196028f},
-std::array<float,2>{0.831817925f, 0.566329241f},
-std::array<float,2>{0.529494286f, 0.396611184f},
-std::array<float,2>{0.47856164f, 0.539075851f},
-std::array<float,2>{0.22582832f, 0.159796074f},
-std::array<float,2>{0.90647763f, 0.879778564f},
-std::array<float,2>{0.769991398f, 0.119405113f},
-std::array<float,2>{0.0725475475f, 0.805206656f},
-std::array<float,2>{0.293562323f, 0.364241898f},
-std::array<float,2>{0.728848398f, 0.71793282f},
-std::array<float,2>{0.933277428f, 0.433722287f},
-std::array<float,2>{0.247301936f, 0.502253652f},
-std::array<float,2>{0.485042095f, 0.139084458f},
-std::array<float,2>{0.507068813f, 0.93340981f},
-std::array<float,2>{0.736293316f, 0.0776552036f},
-std::array<float,2>{0.299102485f, 0.766273677f},
-std::array<float,2>{0.081418857f, 0.336409062f},
-std::array<float,2>{0.765249252f, 0.723561227f},
-std::array<float,2>{0.563186109f, 0.284391463f},
-std::array<float,2>{0.40809679f, 0.672699273f},
-std::array<float,2>{0.149722308f, 0.0124235936f},
-std::array<float,2>{0.976792574f, 0.85697937f},
-std::array<float,2>{0.813404202f, 0.237009257f},
-std::array<float,2>{0.0514796115f, 0.940082133f},
-std::array<float,2>{0.358484834f, 0.491468579f},
-std::array<float,2>{0.653664827f, 0.598268509f},
-std::array<float,2>{0.786066115f, 0.348390192f},
-std::array<float,2>{0.103009827f, 0.698023856f},
-std::array<float,2>{0.263419658f, 0.0968723521f},
-std::array<float,2>{0.689818025f, 0.792402804f},
-std::array<float,2>{0.544985414f, 0.182122424f},
-std::array<float,2>{0.454926372f, 0.891424358f},
-std::array<float,2>{0.215063959f, 0.38397035f},
-std::array<float,2>{0.904028296f, 0.557986081f},
-std::array<float,2>{0.66327095f, 0.453260154f},
-std::array<float,2>{0.339147657f, 0.585505664f},
-std::array<float,2>{0.0189826954f, 0.212511197f},
-std::array<float,2>{0.871125519f, 0.987786651f},
-std::array<float,2>{0.954052448f, 0.0365549475f},
-std::array<float,2>{0.178812116f, 0.838082612f},
-std::array<float,2>{0.400709808f, 0.279338002f},
-std::array<float,2>{0.608174384f, 0.641572952f},
-std::array<float,2>{0.760428488f, 0.451609641f},
-std::array<float,2>{0.0839222148f, 0.577920437f},
-std::array<float,2>{0.300787181f, 0.198643267f},
-std::array<float,2>{0.738885939f, 0.978928685f},
-std::array<float,2>{0.500776649f, 0.061731305f},
-std::array<float,2>{0.48967275f, 0.814048827f},
-std::array<float,2>{0.245000631f, 0.257257253f},
-std::array<float,2>{0.935152709f, 0.635777116f},
-std::array<float,2>{0.652316749f, 0.370788097f},
-std::array<float,2>{0.351779133f, 0.704753816f},
-std::array<float,2>{0.0497817323f, 0.115806527f},
-std::array<float,2>{0.817350149f, 0.801780045f},
-std::array<float,2>{0.980763853f, 0.165008679f},
-std::array<float,2>{0.154092297f, 0.888346434f},
-std::array<float,2>{0.412553579f, 0.405591697f},
-std::array<float,2>{0.569281161f, 0.537568629f},
-std::array<float,2>{0.900419235f, 0.309423089f},
-std::array<float,2>{0.211258098f, 0.667286158f},
-std::array<float,2>{0.457181513f, 0.0158839505f},
-std::array<float,2>{0.540320039f, 0.865020514f},
-std::array<float,2>{0.695284903f, 0.232290521f},
-std::array<float,2>{0.261234671f, 0.96729964f},
-std::array<float,2>{0.105883002f, 0.481584817f},
-std::array<float,2>{0.782097101f, 0.623060644f},
-std::array<float,2>{0.604889452f, 0.416293532f},
-std::array<float,2>{0.402895838f, 0.516180754f},
-std::array<float,2>{0.171969116f, 0.146203339f},
-std::array<float,2>{0.958506227f, 0.916561961f},
-std::array<float,2>{0.869820058f, 0.0783156678f},
-std::array<float,2>{0.0213875882f, 0.764167786f},
-std::array<float,2>{0.34141174f, 0.325751871f},
-std::array<float,2>{0.659394264f, 0.73483026f},
-std::array<float,2>{0.95191288f, 0.378827751f},
-std::array<float,2>{0.170039088f, 0.554610014f},
-std::array<float,2>{0.379252911f, 0.178686321f},
-std::array<float,2>{0.623157024f, 0.90046984f},
-std::array<float,2>{0.684375167f, 0.101846203f},
-std::array<float,2>{0.320484191f, 0.785190761f},
-std::array<float,2>{0.00273307622f, 0.358005494f},
-std::array<float,2>{0.848935187f, 0.691590965f},
-std::array<float,2>{0.561767936f, 0.269239843f},
-std::array<float,2>{0.45288071f, 0.654100358f},
-std::array<float,2>{0.19793658f, 0.0393085852f},
-std::array<float,2>{0.878061533f, 0.830186367f},
-std::array<float,2>{0.799196422f, 0.210043177f},
-std::array<float,2>{0.114574783f, 0.993305206f},
-std::array<float,2>{0.269660711f, 0.466904044f},
-std::array<float,2>{0.714665651f, 0.588267982f},
-std::array<float,2>{0.83254844f, 0.33426252f},
-std::array<float,2>{0.0426850915f, 0.734133482f},
-std::array<float,2>{0.370265454f, 0.0670049563f},
-std::array<float,2>{0.633940101f, 0.775936723f},
-std::array<float,2>{0.590171695f, 0.131701559f},
-std::array<float,2>{0.422204763f, 0.928915441f},
-std::array<float,2>{0.125937462f, 0.42558372f},
-std::array<float,2>{0.988773346f, 0.509119689f},
-std::array<float,2>{0.732731581f, 0.497187614f},
-std::array<float,2>{0.291381449f, 0.606893122f},
-std::array<float,2>{0.0746427774f, 0.244471177f},
-std::array<float,2>{0.765991211f, 0.946932971f},
-std::array<float,2>{0.912937164f, 0.00462889438f},
-std::array<float,2>{0.220629424f, 0.846317828f},
-std::array<float,2>{0.484322846f, 0.292158723f},
-std::array<float,2>{0.524760962f, 0.682759047f},
-std::array<float,2>{0.855466008f, 0.432231247f},
-std::array<float,2>{0.0153465644f, 0.507311404f},
-std::array<float,2>{0.319424182f, 0.134602815f},
-std::array<float,2>{0.673249781f, 0.933814764f},
-std::array<float,2>{0.610189199f, 0.0703521743f},
-std::array<float,2>{0.390140653f, 0.771899283f},
-std::array<float,2>{0.159750938f, 0.343364805f},
-std::array<float,2>{0.939051092f, 0.721698165f},
-std::array<float,2>{0.705022573f, 0.286538541f},
-std::array<float,2>{0.279465318f, 0.677869499f},
-std::array<float,2>{0.118370503f, 0.00961728022f},
-std::array<float,2>{0.806557715f, 0.853898406f},
-std::array<float,2>{0.887777328f, 0.240523368f},
-std::array<float,2>{0.190102383f, 0.94348824f},
-std::array<float,2>{0.438211054f, 0.487258852f},
-std::array<float,2>{0.552818775f, 0.594068646f},
-std::array<float,2>{0.992339253f, 0.346359432f},
-std::array<float,2>{0.135293782f, 0.699774563f},
-std::array<float,2>{0.429739475f, 0.0987356603f},
-std::array<float,2>{0.58067733f, 0.796394467f},
-std::array<float,2>{0.627880096f, 0.187022984f},
-std::array<float,2>{0.362073869f, 0.898088992f},
-std::array<float,2>{0.0315437242f, 0.390071541f},
-std::array<float,2>{0.838042498f, 0.561496615f},
-std::array<float,2>{0.515887082f, 0.457426876f},
-std::array<float,2>{0.470666856f, 0.580442011f},
-std::array<float,2>{0.227146789f, 0.216654748f},
-std::array<float,2>{0.921065629f, 0.988294363f},
-std::array<float,2>{0.780054808f, 0.0341970921f},
-std::array<float,2>{0.0639213547f, 0.84047401f},
-std::array<float,2>{0.285271585f, 0.273666948f},
-std::array<float,2>{0.718981922f, 0.648317039f},
-std::array<float,2>{0.92200017f, 0.469223142f},
-std::array<float,2>{0.235835671f, 0.611442685f},
-std::array<float,2>{0.497335047f, 0.223460883f},
-std::array<float,2>{0.513831735f, 0.955038249f},
-std::array<float,2>{0.743911088f, 0.0258351117f},
-std::array<float,2>{0.307244867f, 0.874363363f},
-std::array<float,2>{0.0900477171f, 0.299279362f},
-std::array<float,2>{0.754885614f, 0.658695042f},
-std::array<float,2>{0.576213479f, 0.316170812f},
-std::array<float,2>{0.420745105f, 0.746531725f},
-std::array<float,2>{0.141862929f, 0.0895072296f},
-std::array<float,2>{0.974495232f, 0.753657401f},
-std::array<float,2>{0.824332714f, 0.149115145f},
-std::array<float,2>{0.0624111742f, 0.907335103f},
-std::array<float,2>{0.343900353f, 0.410556018f},
-std::array<float,2>{0.644174814f, 0.527418077f},
-std::array<float,2>{0.794484735f, 0.258097559f},
-std::array<float,2>{0.100620717f, 0.626319528f},
-std::array<float,2>{0.257428676f, 0.0506642498f},
-std::array<float,2>{0.697092772f, 0.825291872f},
-std::array<float,2>{0.538504064f, 0.189242214f},
-std::array<float,2>{0.46337837f, 0.975303531f},
-std::array<float,2>{0.208369106f, 0.438876241f},
-std::array<float,2>{0.892513275f, 0.567235947f},
-std::array<float,2>{0.667244375f, 0.390940428f},
-std::array<float,2>{0.330116928f, 0.54508388f},
-std::array<float,2>{0.0273736399f, 0.160242841f},
-std::array<float,2>{0.866222799f, 0.876093209f},
-std::array<float,2>{0.966318488f, 0.124216728f},
-std::array<float,2>{0.182858735f, 0.810669661f},
-std::array<float,2>{0.391272694f, 0.362735868f},
-std::array<float,2>{0.598787606f, 0.711355686f},
-std::array<float,2>{0.808622718f, 0.401415259f},
-std::array<float,2>{0.12345662f, 0.531394124f},
-std::array<float,2>{0.274900943f, 0.171856284f},
-std::array<float,2>{0.708044648f, 0.884595096f},
-std::array<float,2>{0.547617912f, 0.110524885f},
-std::array<float,2>{0.443939537f, 0.797584951f},
-std::array<float,2>{0.191871032f, 0.37276727f},
-std::array<float,2>{0.885768831f, 0.707543135f},
-std::array<float,2>{0.67743665f, 0.253572851f},
-std::array<float,2>{0.31349647f, 0.639735401f},
-std::array<float,2>{0.0113348681f, 0.0582738109f},
-std::array<float,2>{0.858985662f, 0.817774296f},
-std::array<float,2>{0.9448722f, 0.199341759f},
-std::array<float,2>{0.164058f, 0.982843816f},
-std::array<float,2>{0.384267837f, 0.448693126f},
-std::array<float,2>{0.614694059f, 0.574083626f},
-std::array<float,2>{0.914340973f, 0.322026551f},
-std::array<float,2>{0.231795728f, 0.741566956f},
-std::array<float,2>{0.475164324f, 0.0857984647f},
-std::array<float,2>{0.521347046f, 0.759641826f},
-std::array<float,2>{0.722680926f, 0.141113564f},
-std::array<float,2>{0.284802437f, 0.921719968f},
-std::array<float,2>{0.0697729066f, 0.418949455f},
-std::array<float,2>{0.774905205f, 0.520424604f},
-std::array<float,2>{0.582113147f, 0.477751523f},
-std::array<float,2>{0.434047312f, 0.618713737f},
-std::array<float,2>{0.138771117f, 0.226988748f},
-std::array<float,2>{0.999224305f, 0.961931646f},
-std::array<float,2>{0.840907097f, 0.0206554905f},
-std::array<float,2>{0.0389602073f, 0.861127198f},
-std::array<float,2>{0.365951419f, 0.305857211f},
-std::array<float,2>{0.63091892f, 0.668512166f},
-std::array<float,2>{0.970289767f, 0.461878687f},
-std::array<float,2>{0.146517411f, 0.590734124f},
-std::array<float,2>{0.417264521f, 0.206197947f},
-std::array<float,2>{0.572976053f, 0.998917103f},
-std::array<float,2>{0.646908283f, 0.0433387086f},
-std::array<float,2>{0.350124419f, 0.833386302f},
-std::array<float,2>{0.0551772229f, 0.271084964f},
-std::array<float,2>{0.822049737f, 0.65015614f},
-std::array<float,2>{0.511711597f, 0.353833377f},
-std::array<float,2>{0.49570325f, 0.688884377f},
-std::array<float,2>{0.240411893f, 0.108330391f},
-std::array<float,2>{0.927107155f, 0.781267762f},
-std::array<float,2>{0.751926303f, 0.172429383f},
-std::array<float,2>{0.0894339755f, 0.902749717f},
-std::array<float,2>{0.311601907f, 0.382367492f},
-std::array<float,2>{0.74895221f, 0.547237575f},
-std::array<float,2>{0.860752344f, 0.296009153f},
-std::array<float,2>{0.0245454721f, 0.686884284f},
-std::array<float,2>{0.333612412f, 0.000508301135f},
-std::array<float,2>{0.668760598f, 0.849013627f},
-std::array<float,2>{0.597347021f, 0.247690946f},
-std::array<float,2>{0.396333426f, 0.950335324f},
-std::array<float,2>{0.187479451f, 0.495058537f},
-std::array<float,2>{0.96265471f, 0.604484141f},
-std::array<float,2>{0.702825844f, 0.427033871f},
-std::array<float,2>{0.251967311f, 0.512657583f},
-std::array<float,2>{0.0974627212f, 0.125746071f},
-std::array<float,2>{0.792308152f, 0.925504923f},
-std::array<float,2>{0.894866824f, 0.0652149469f},
-std::array<float,2>{0.206434533f, 0.779057205f},
-std::array<float,2>{0.468273371f, 0.330991983f},
-std::array<float,2>{0.533863008f, 0.728337348f},
-std::array<float,2>{0.816284955f, 0.49085921f},
-std::array<float,2>{0.0531349778f, 0.598749757f},
-std::array<float,2>{0.355847389f, 0.237615466f},
-std::array<float,2>{0.654729426f, 0.94108659f},
-std::array<float,2>{0.566070616f, 0.0134322159f},
-std::array<float,2>{0.40897271f, 0.855802596f},
-std::array<float,2>{0.151362091f, 0.284151167f},
-std::array<float,2>{0.979753971f, 0.673746705f},
-std::array<float,2>{0.737222075f, 0.337445259f},
-std::array<float,2>{0.297403425f, 0.724506795f},
-std::array<float,2>{0.0784819946f, 0.0771147907f},
-std::array<float,2>{0.762496591f, 0.767082751f},
-std::array<float,2>{0.931534469f, 0.139923826f},
-std::array<float,2>{0.249752626f, 0.931653619f},
-std::array<float,2>{0.48778069f, 0.43472901f},
-std::array<float,2>{0.504622459f, 0.503161311f},
-std::array<float,2>{0.955131352f, 0.280315965f},
-std::array<float,2>{0.177019268f, 0.641814828f},
-std::array<float,2>{0.399224371f, 0.0358966179f},
-std::array<float,2>{0.605628431f, 0.83957988f},
-std::array<float,2>{0.661611259f, 0.211081758f},
-std::array<float,2>{0.337810606f, 0.986845076f},
-std::array<float,2>{0.0175043624f, 0.454674631f},
-std::array<float,2>{0.87420547f, 0.584016621f},
-std::array<float,2>{0.543666363f, 0.383785486f},
-std::array<float,2>{0.45620656f, 0.557379782f},
-std::array<float,2>{0.218712732f, 0.183288157f},
-std::array<float,2>{0.906168878f, 0.891712666f},
-std::array<float,2>{0.788177073f, 0.0964714885f},
-std::array<float,2>{0.10475672f, 0.791502774f},
-std::array<float,2>{0.263860732f, 0.34864074f},
-std::array<float,2>{0.688755572f, 0.698503077f},
-std::array<float,2>{0.878935099f, 0.40669325f},
-std::array<float,2>{0.199489474f, 0.525935769f},
-std::array<float,2>{0.445687383f, 0.153254226f},
-std::array<float,2>{0.557768941f, 0.911116302f},
-std::array<float,2>{0.717479169f, 0.0909039676f},
-std::array<float,2>{0.268128783f, 0.754206896f},
-std::array<float,2>{0.109837405f, 0.31775406f},
-std::array<float,2>{0.804224372f, 0.744406581f},
-std::array<float,2>{0.621086895f, 0.302320451f},
-std::array<float,2>{0.376087397f, 0.660633147f},
-std::array<float,2>{0.167055443f, 0.0287068877f},
-std::array<float,2>{0.946661115f, 0.868648112f},
-std::array<float,2>{0.846316874f, 0.220738932f},
-std::array<float,2>{0.00574666541f, 0.957581222f},
-std::array<float,2>{0.325534135f, 0.475382179f},
-std::array<float,2>{0.681573808f, 0.61465621f},
-std::array<float,2>{0.771788359f, 0.364354819f},
-std::array<float,2>{0.070968166f, 0.716955304f},
-std::array<float,2>{0.294968516f, 0.120993942f},
-std::array<float,2>{0.727552235f, 0.806182683f},
-std::array<float,2>{0.528285682f, 0.158344477f},
-std::array<float,2>{0.476619035f, 0.880744755f},
-std::array<float,2>{0.223846063f, 0.397812754f},
-std::array<float,2>{0.909655154f, 0.540318489f},
-std::array<float,2>{0.638954043f, 0.442104548f},
-std::array<float,2>{0.372577339f, 0.56495738f},
-std::array<float,2>{0.0430252142f, 0.193451822f},
-std::array<float,2>{0.829542577f, 0.97178185f},
-std::array<float,2>{0.98446095f, 0.0514844507f},
-std::array<float,2>{0.131449267f, 0.823234141f},
-std::array<float,2>{0.429077208f, 0.262160689f},
-std::array<float,2>{0.587799549f, 0.629320145f},
-std::array<float,2>{0.784619749f, 0.482930839f},
-std::array<float,2>{0.108928323f, 0.623009682f},
-std::array<float,2>{0.25847435f, 0.233417526f},
-std::array<float,2>{0.693113029f, 0.965774953f},
-std::array<float,2>{0.54194212f, 0.0194929186f},
-std::array<float,2>{0.459041059f, 0.866449356f},
-std::array<float,2>{0.214107201f, 0.312434018f},
-std::array<float,2>{0.899966061f, 0.665509105f},
-std::array<float,2>{0.656507432f, 0.328116298f},
-std::array<float,2>{0.343447447f, 0.736761749f},
-std::array<float,2>{0.0218932331f, 0.0803598464f},
-std::array<float,2>{0.867327034f, 0.76258713f},
-std::array<float,2>{0.959624588f, 0.147315726f},
-std::array<float,2>{0.17455487f, 0.915477633f},
-std::array<float,2>{0.405214041f, 0.414992034f},
-std::array<float,2>{0.601773381f, 0.518653214f},
-std::array<float,2>{0.936288595f, 0.255451679f},
-std::array<float,2>{0.242798537f, 0.632872224f},
-std::array<float,2>{0.491778165f, 0.0593869761f},
-std::array<float,2>{0.502497017f, 0.816259503f},
-std::array<float,2>{0.741861045f, 0.197222292f},
-std::array<float,2>{0.303857893f, 0.977978885f},
-std::array<float,2>{0.0840683728f, 0.451023787f},
-std::array<float,2>{0.758826435f, 0.574730396f},
-std::array<float,2>{0.567465484f, 0.40287587f},
-std::array<float,2>{0.410276145f, 0.535725713f},
-std::array<float,2>{0.155262172f, 0.166251749f},
-std::array<float,2>{0.983497977f, 0.890338302f},
-std::array<float,2>{0.818896711f, 0.114516057f},
-std::array<float,2>{0.0473607145f, 0.803593755f},
-std::array<float,2>{0.354887009f, 0.368988484f},
-std::array<float,2>{0.648757279f, 0.705940962f},
-std::array<float,2>{0.991551101f, 0.422082931f},
-std::array<float,2>{0.128238529f, 0.510860205f},
-std::array<float,2>{0.425622761f, 0.130114138f},
-std::array<float,2>{0.591986001f, 0.92623204f},
-std::array<float,2>{0.636442721f, 0.0683855787f},
-std::array<float,2>{0.368045509f, 0.774173617f},
-std::array<float,2>{0.0404217392f, 0.33367008f},
-std::array<float,2>{0.834396005f, 0.731365383f},
-std::array<float,2>{0.525975108f, 0.290188432f},
-std::array<float,2>{0.481250554f, 0.681612015f},
-std::array<float,2>{0.220769241f, 0.00773440581f},
-std::array<float,2>{0.910763085f, 0.8453632f},
-std::array<float,2>{0.768404126f, 0.243498757f},
-std::array<float,2>{0.0778037757f, 0.947343111f},
-std::array<float,2>{0.290578902f, 0.498054147f},
-std::array<float,2>{0.731027603f, 0.60868144f},
-std::array<float,2>{0.85115397f, 0.357194483f},
-std::array<float,2>{0.00155917555f, 0.694395721f},
-std::array<float,2>{0.322943419f, 0.104755074f},
-std::array<float,2>{0.687342107f, 0.787408054f},
-std::array<float,2>{0.622701287f, 0.177012518f},
-std::array<float,2>{0.380861014f, 0.899463058f},
-std::array<float,2>{0.169645205f, 0.375614643f},
-std::array<float,2>{0.94941026f, 0.55160141f},
-std::array<float,2>{0.711071074f, 0.46565339f},
-std::array<float,2>{0.272338659f, 0.587402642f},
-std::array<float,2>{0.115963861f, 0.207283631f},
-std::array<float,2>{0.797424614f, 0.995593846f},
-std::array<float,2>{0.875648081f, 0.0416511744f},
-std::array<float,2>{0.195618972f, 0.828729808f},
-std::array<float,2>{0.45001936f, 0.265790343f},
-std::array<float,2>{0.558863103f, 0.654860198f},
-std::array<float,2>{0.83646208f, 0.38832894f},
-std::array<float,2>{0.0351378955f, 0.560187578f},
-std::array<float,2>{0.361272573f, 0.185301334f},
-std::array<float,2>{0.625370502f, 0.894551516f},
-std::array<float,2>{0.578477442f, 0.101200096f},
-std::array<float,2>{0.433553934f, 0.793824434f},
-std::array<float,2>{0.134746f, 0.345098972f},
-std::array<float,2>{0.995379686f, 0.702121317f},
-std::array<float,2>{0.722130835f, 0.276223511f},
-std::array<float,2>{0.288509995f, 0.645850182f},
-std::array<float,2>{0.065309763f, 0.0331318863f},
-std::array<float,2>{0.777723551f, 0.842660546f},
-std::array<float,2>{0.919272721f, 0.218660206f},
-std::array<float,2>{0.228908688f, 0.991781831f},
-std::array<float,2>{0.471976608f, 0.459021091f},
-std::array<float,2>{0.518605471f, 0.578441799f},
-std::array<float,2>{0.940071583f, 0.340047598f},
-std::array<float,2>{0.156505153f, 0.720512986f},
-std::array<float,2>{0.387980312f, 0.0731098279f},
-std::array<float,2>{0.611995339f, 0.770466864f},
-std::array<float,2>{0.674594283f, 0.136183143f},
-std::array<float,2>{0.317014992f, 0.936242223f},
-std::array<float,2>{0.0123230787f, 0.429855704f},
-std::array<float,2>{0.853240073f, 0.505852222f},
-std::array<float,2>{0.552110851f, 0.484924912f},
-std::array<float,2>{0.440987766f, 0.596552491f},
-std::array<float,2>{0.188602686f, 0.239757165f},
-std::array<float,2>{0.890424967f, 0.941463888f},
-std::array<float,2>{0.806692302f, 0.0100282962f},
-std::array<float,2>{0.120272562f, 0.853146374f},
-std::array<float,2>{0.278029919f, 0.288718134f},
-std::array<float,2>{0.705643177f, 0.6765306f},
-std::array<float,2>{0.894480944f, 0.44105956f},
-std::array<float,2>{0.2101845f, 0.570037484f},
-std::array<float,2>{0.462571621f, 0.190319926f},
-std::array<float,2>{0.535522223f, 0.972761333f},
-std::array<float,2>{0.69737643f, 0.0486594811f},
-std::array<float,2>{0.254622966f, 0.827113688f},
-std::array<float,2>{0.0983065143f, 0.261524379f},
-std::array<float,2>{0.796108067f, 0.626979053f},
-std::array<float,2>{0.600465178f, 0.360544086f},
-std::array<float,2>{0.393012196f, 0.713934958f},
-std::array<float,2>{0.180854663f, 0.121437028f},
-std::array<float,2>{0.968328297f, 0.810047865f},
-std::array<float,2>{0.864491045f, 0.162898347f},
-std::array<float,2>{0.0299270917f, 0.878689528f},
-std::array<float,2>{0.329913795f, 0.393209815f},
-std::array<float,2>{0.664511502f, 0.544634998f},
-std::array<float,2>{0.757301331f, 0.297624737f},
-std::array<float,2>{0.0926849544f, 0.658130944f},
-std::array<float,2>{0.305501044f, 0.0234679915f},
-std::array<float,2>{0.745310783f, 0.872523904f},
-std::array<float,2>{0.512808383f, 0.226287395f},
-std::array<float,2>{0.499685496f, 0.956581354f},
-std::array<float,2>{0.238062352f, 0.471226305f},
-std::array<float,2>{0.924474239f, 0.610010922f},
-std::array<float,2>{0.641677737f, 0.414053798f},
-std::array<float,2>{0.345743477f, 0.530118048f},
-std::array<float,2>{0.0586268231f, 0.150895476f},
-std::array<float,2>{0.82642436f, 0.909957469f},
-std::array<float,2>{0.976122856f, 0.086311467f},
-std::array<float,2>{0.142794207f, 0.751094937f},
-std::array<float,2>{0.419109434f, 0.313680351f},
-std::array<float,2>{0.576000571f, 0.749217033f},
-std::array<float,2>{0.777066112f, 0.420087099f},
-std::array<float,2>{0.0673528463f, 0.521562397f},
-std::array<float,2>{0.282826781f, 0.143964931f},
-std::array<float,2>{0.725272119f, 0.91909498f},
-std::array<float,2>{0.523309648f, 0.0828099623f},
-std::array<float,2>{0.474372685f, 0.759806871f},
-std::array<float,2>{0.233273029f, 0.322416782f},
-std::array<float,2>{0.917813063f, 0.739728034f},
-std::array<float,2>{0.6293962f, 0.308566064f},
-std::array<float,2>{0.363858849f, 0.670693994f},
-std::array<float,2>{0.0356794149f, 0.0218541753f},
-std::array<float,2>{0.842815936f, 0.862473845f},
-std::array<float,2>{0.996522725f, 0.229643673f},
-std::array<float,2>{0.137913048f, 0.963136435f},
-std::array<float,2>{0.435596794f, 0.479269356f},
-std::array<float,2>{0.584651649f, 0.619824052f},
-std::array<float,2>{0.884382725f, 0.37370351f},
-std::array<float,2>{0.193888694f, 0.709349155f},
-std::array<float,2>{0.442969829f, 0.112698548f},
-std::array<float,2>{0.549113989f, 0.800662935f},
-std::array<float,2>{0.709074497f, 0.169425517f},
-std::array<float,2>{0.275419712f, 0.88653481f},
-std::array<float,2>{0.122047029f, 0.399206698f},
-std::array<float,2>{0.811289072f, 0.53463912f},
-std::array<float,2>{0.617010236f, 0.446864635f},
-std::array<float,2>{0.385712922f, 0.570981741f},
-std::array<float,2>{0.160407051f, 0.201894686f},
-std::array<float,2>{0.942223966f, 0.981901646f},
-std::array<float,2>{0.856250763f, 0.0563245974f},
-std::array<float,2>{0.00922326371f, 0.819043636f},
-std::array<float,2>{0.315909535f, 0.250122458f},
-std::array<float,2>{0.678495824f, 0.637696147f},
-std::array<float,2>{0.964747131f, 0.493505538f},
-std::array<float,2>{0.183638796f, 0.60281539f},
-std::array<float,2>{0.398150295f, 0.248739585f},
-std::array<float,2>{0.595304549f, 0.951281786f},
-std::array<float,2>{0.671158433f, 0.00287983939f},
-std::array<float,2>{0.33461529f, 0.850643635f},
-std::array<float,2>{0.0255693551f, 0.294312298f},
-std::array<float,2>{0.863183975f, 0.684737086f},
-std::array<float,2>{0.533055067f, 0.329671025f},
-std::array<float,2>{0.465667099f, 0.729089737f},
-std::array<float,2>{0.204690173f, 0.0631455258f},
-std::array<float,2>{0.897281766f, 0.780025244f},
-std::array<float,2>{0.790559351f, 0.128824294f},
-std::array<float,2>{0.0946596712f, 0.923676908f},
-std::array<float,2>{0.250117272f, 0.428055495f},
-std::array<float,2>{0.700691998f, 0.51547122f},
-std::array<float,2>{0.824066937f, 0.273210913f},
-std::array<float,2>{0.0579540096f, 0.651428938f},
-std::array<float,2>{0.347756147f, 0.0455328822f},
-std::array<float,2>{0.645444453f, 0.833989978f},
-std::array<float,2>{0.572081625f, 0.204457626f},
-std::array<float,2>{0.414963096f, 0.996939421f},
-std::array<float,2>{0.144579172f, 0.464439988f},
-std::array<float,2>{0.972410738f, 0.592639148f},
-std::array<float,2>{0.747359812f, 0.379553527f},
-std::array<float,2>{0.309184641f, 0.550493002f},
-std::array<float,2>{0.087287724f, 0.174000904f},
-std::array<float,2>{0.753430724f, 0.905480921f},
-std::array<float,2>{0.928530812f, 0.105963916f},
-std::array<float,2>{0.239554718f, 0.784188867f},
-std::array<float,2>{0.493293732f, 0.352266222f},
-std::array<float,2>{0.508995593f, 0.690092623f},
-std::array<float,2>{0.872979701f, 0.455774128f},
-std::array<float,2>{0.0180825442f, 0.583910704f},
-std::array<float,2>{0.338512391f, 0.213236913f},
-std::array<float,2>{0.662407219f, 0.984771371f},
-std::array<float,2>{0.608906448f, 0.0373321474f},
-std::array<float,2>{0.401797861f, 0.836404145f},
-std::array<float,2>{0.178254128f, 0.279278725f},
-std::array<float,2>{0.954753041f, 0.642645359f},
-std::array<float,2>{0.690922737f, 0.351447135f},
-std::array<float,2>{0.262330264f, 0.696432114f},
-std::array<float,2>{0.102019347f, 0.0942187533f},
-std::array<float,2>{0.786540329f, 0.790168643f},
-std::array<float,2>{0.902896464f, 0.180321977f},
-std::array<float,2>{0.216323748f, 0.893387198f},
-std::array<float,2>{0.45337078f, 0.385218203f},
-std::array<float,2>{0.546772301f, 0.555852473f},
-std::array<float,2>{0.977927327f, 0.282569498f},
-std::array<float,2>{0.149303585f, 0.674484372f},
-std::array<float,2>{0.406619757f, 0.0139042633f},
-std::array<float,2>{0.563583493f, 0.858488619f},
-std::array<float,2>{0.652647913f, 0.234839365f},
-std::array<float,2>{0.357805073f, 0.938909888f},
-std::array<float,2>{0.0522709899f, 0.488404453f},
-std::array<float,2>{0.814277411f, 0.600952268f},
-std::array<float,2>{0.506593704f, 0.436607331f},
-std::array<float,2>{0.485555857f, 0.501092315f},
-std::array<float,2>{0.246434271f, 0.137424618f},
-std::array<float,2>{0.932525158f, 0.92973578f},
-std::array<float,2>{0.763979375f, 0.0742830336f},
-std::array<float,2>{0.0800860748f, 0.769095123f},
-std::array<float,2>{0.300158471f, 0.338743329f},
-std::array<float,2>{0.734922588f, 0.724901974f},
-std::array<float,2>{0.908146799f, 0.396429807f},
-std::array<float,2>{0.225271732f, 0.542749465f},
-std::array<float,2>{0.48046118f, 0.158143878f},
-std::array<float,2>{0.531143665f, 0.882561982f},
-std::array<float,2>{0.729591429f, 0.117502831f},
-std::array<float,2>{0.294110715f, 0.8067981f},
-std::array<float,2>{0.0732446834f, 0.366492838f},
-std::array<float,2>{0.77107358f, 0.71488601f},
-std::array<float,2>{0.589199424f, 0.265411496f},
-std::array<float,2>{0.426713377f, 0.631827772f},
-std::array<float,2>{0.130187854f, 0.0544890091f},
-std::array<float,2>{0.986618876f, 0.822210908f},
-std::array<float,2>{0.830277741f, 0.192941904f},
-std::array<float,2>{0.0460359603f, 0.969905496f},
-std::array<float,2>{0.373594105f, 0.444896996f},
-std::array<float,2>{0.638317227f, 0.56414187f},
-std::array<float,2>{0.80210942f, 0.320246756f},
-std::array<float,2>{0.112669945f, 0.742455959f},
-std::array<float,2>{0.266055018f, 0.0931177437f},
-std::array<float,2>{0.716694832f, 0.756048203f},
-std::array<float,2>{0.555288374f, 0.155647859f},
-std::array<float,2>{0.449179441f, 0.913348258f},
-std::array<float,2>{0.202582747f, 0.409372538f},
-std::array<float,2>{0.882752597f, 0.525145471f},
-std::array<float,2>{0.682381809f, 0.473992378f},
-std::array<float,2>{0.327167213f, 0.616860449f},
-std::array<float,2>{0.00644089282f, 0.219708696f},
-std::array<float,2>{0.843951464f, 0.960242808f},
-std::array<float,2>{0.94865793f, 0.0310089719f},
-std::array<float,2>{0.165243119f, 0.869328201f},
-std::array<float,2>{0.378719777f, 0.303309977f},
-std::array<float,2>{0.618680596f, 0.662564337f},
-std::array<float,2>{0.762212634f, 0.490019947f},
-std::array<float,2>{0.0781632066f, 0.600149274f},
-std::array<float,2>{0.297625542f, 0.236179829f},
-std::array<float,2>{0.736992896f, 0.938045859f},
-std::array<float,2>{0.504833877f, 0.0148105575f},
-std::array<float,2>{0.487373173f, 0.857916832f},
-std::array<float,2>{0.24985674f, 0.281947851f},
-std::array<float,2>{0.931193233f, 0.675571799f},
-std::array<float,2>{0.654298365f, 0.339763492f},
-std::array<float,2>{0.355586022f, 0.726149023f},
-std::array<float,2>{0.0528885983f, 0.0752012953f},
-std::array<float,2>{0.816029906f, 0.767714977f},
-std::array<float,2>{0.97967869f, 0.138360113f},
-std::array<float,2>{0.151104867f, 0.930990338f},
-std::array<float,2>{0.408761382f, 0.43587482f},
-std::array<float,2>{0.566219449f, 0.500560164f},
-std::array<float,2>{0.905839264f, 0.278227657f},
-std::array<float,2>{0.218423963f, 0.644307852f},
-std::array<float,2>{0.456386864f, 0.0388040915f},
-std::array<float,2>{0.543904662f, 0.836951613f},
-std::array<float,2>{0.688698053f, 0.214005724f},
-std::array<float,2>{0.264059305f, 0.985675752f},
-std::array<float,2>{0.104531743f, 0.456913233f},
-std::array<float,2>{0.788564742f, 0.58213526f},
-std::array<float,2>{0.605826139f, 0.38629061f},
-std::array<float,2>{0.398956418f, 0.5555439f},
-std::array<float,2>{0.176907226f, 0.180850402f},
-std::array<float,2>{0.955562413f, 0.893925071f},
-std::array<float,2>{0.874395967f, 0.095040895f},
-std::array<float,2>{0.0170985013f, 0.78909117f},
-std::array<float,2>{0.33750841f, 0.349775225f},
-std::array<float,2>{0.661193073f, 0.695624709f},
-std::array<float,2>{0.946347177f, 0.408913374f},
-std::array<float,2>{0.167396814f, 0.523475468f},
-std::array<float,2>{0.376414955f, 0.155081034f},
-std::array<float,2>{0.620793641f, 0.91258955f},
-std::array<float,2>{0.681189001f, 0.0923265815f},
-std::array<float,2>{0.325341105f, 0.75690496f},
-std::array<float,2>{0.00542584574f, 0.318652511f},
-std::array<float,2>{0.846605361f, 0.744038761f},
-std::array<float,2>{0.55795145f, 0.303734183f},
-std::array<float,2>{0.445540726f, 0.663628876f},
-std::array<float,2>{0.199272022f, 0.0296136979f},
-std::array<float,2>{0.879235983f, 0.870955765f},
-std::array<float,2>{0.804569364f, 0.219882339f},
-std::array<float,2>{0.109522842f, 0.959688902f},
-std::array<float,2>{0.268379331f, 0.473332644f},
-std::array<float,2>{0.717627287f, 0.615724444f},
-std::array<float,2>{0.829140425f, 0.366101682f},
-std::array<float,2>{0.0434006751f, 0.716446817f},
-std::array<float,2>{0.372810334f, 0.119082466f},
-std::array<float,2>{0.638859689f, 0.80844605f},
-std::array<float,2>{0.587618411f, 0.157223836f},
-std::array<float,2>{0.428850442f, 0.881157517f},
-std::array<float,2>{0.131820634f, 0.395481288f},
-std::array<float,2>{0.984676182f, 0.541184247f},
-std::array<float,2>{0.727880895f, 0.443957299f},
-std::array<float,2>{0.295273989f, 0.56280154f},
-std::array<float,2>{0.0711976215f, 0.191972792f},
-std::array<float,2>{0.771625817f, 0.969162405f},
-std::array<float,2>{0.909244537f, 0.053264726f},
-std::array<float,2>{0.223886326f, 0.821032107f},
-std::array<float,2>{0.476901501f, 0.264159799f},
-std::array<float,2>{0.527859688f, 0.632624805f},
-std::array<float,2>{0.859169245f, 0.399801999f},
-std::array<float,2>{0.0116892355f, 0.533230841f},
-std::array<float,2>{0.313797176f, 0.168651968f},
-std::array<float,2>{0.677532017f, 0.885284185f},
-std::array<float,2>{0.614270031f, 0.111559153f},
-std::array<float,2>{0.384008855f, 0.79947418f},
-std::array<float,2>{0.163774788f, 0.374274552f},
-std::array<float,2>{0.945179999f, 0.710135877f},
-std::array<float,2>{0.708432198f, 0.251220375f},
-std::array<float,2>{0.274624467f, 0.637332499f},
-std::array<float,2>{0.12309286f, 0.055651132f},
-std::array<float,2>{0.809021294f, 0.820006549f},
-std::array<float,2>{0.886119843f, 0.202963233f},
-std::array<float,2>{0.19144462f, 0.980511725f},
-std::array<float,2>{0.44412446f, 0.446061522f},
-std::array<float,2>{0.547461033f, 0.571653724f},
-std::array<float,2>{0.999321163f, 0.323597491f},
-std::array<float,2>{0.139087364f, 0.739255488f},
-std::array<float,2>{0.433734149f, 0.0833583847f},
-std::array<float,2>{0.582456291f, 0.761101425f},
-std::array<float,2>{0.631162763f, 0.143452317f},
-std::array<float,2>{0.366024464f, 0.918160081f},
-std::array<float,2>{0.0386275053f, 0.421143353f},
-std::array<float,2>{0.841296792f, 0.523128629f},
-std::array<float,2>{0.521233797f, 0.479577303f},
-std::array<float,2>{0.475402266f, 0.620658994f},
-std::array<float,2>{0.231597722f, 0.229350597f},
-std::array<float,2>{0.914151013f, 0.964145243f},
-std::array<float,2>{0.775349498f, 0.0231377184f},
-std::array<float,2>{0.0695380047f, 0.862116694f},
-std::array<float,2>{0.285113603f, 0.307065934f},
-std::array<float,2>{0.723082781f, 0.670949161f},
-std::array<float,2>{0.92691797f, 0.46289131f},
-std::array<float,2>{0.240595445f, 0.593392551f},
-std::array<float,2>{0.495860934f, 0.20395115f},
-std::array<float,2>{0.511328876f, 0.997636437f},
-std::array<float,2>{0.748751879f, 0.0465815179f},
-std::array<float,2>{0.31185323f, 0.835075557f},
-std::array<float,2>{0.0896544307f, 0.271968722f},
-std::array<float,2>{0.75163722f, 0.650436878f},
-std::array<float,2>{0.573184788f, 0.353441089f},
-std::array<float,2>{0.417029858f, 0.690919578f},
-std::array<float,2>{0.146757409f, 0.106765218f},
-std::array<float,2>{0.970532596f, 0.783313334f},
-std::array<float,2>{0.821837842f, 0.175618201f},
-std::array<float,2>{0.055534374f, 0.904983878f},
-std::array<float,2>{0.350572914f, 0.380389869f},
-std::array<float,2>{0.646486163f, 0.549465895f},
-std::array<float,2>{0.792112708f, 0.293075532f},
-std::array<float,2>{0.0972273797f, 0.683687091f},
-std::array<float,2>{0.252352357f, 0.00302893389f},
-std::array<float,2>{0.703046501f, 0.84972775f},
-std::array<float,2>{0.533999383f, 0.249089167f},
-std::array<float,2>{0.468578398f, 0.952856362f},
-std::array<float,2>{0.206177011f, 0.492776185f},
-std::array<float,2>{0.894584954f, 0.602206886f},
-std::array<float,2>{0.668505371f, 0.428759426f},
-std::array<float,2>{0.333865315f, 0.514382362f},
-std::array<float,2>{0.0247510821f, 0.127592593f},
-std::array<float,2>{0.860583603f, 0.922096491f},
-std::array<float,2>{0.962582827f, 0.063695766f},
-std::array<float,2>{0.187229559f, 0.780746698f},
-std::array<float,2>{0.396030873f, 0.328930646f},
-std::array<float,2>{0.597596943f, 0.729630351f},
-std::array<float,2>{0.806342185f, 0.430952996f},
-std::array<float,2>{0.118651822f, 0.504698277f},
-std::array<float,2>{0.279620737f, 0.135086864f},
-std::array<float,2>{0.704762399f, 0.937116861f},
-std::array<float,2>{0.553069711f, 0.0732625797f},
-std::array<float,2>{0.438440681f, 0.771244168f},
-std::array<float,2>{0.190278992f, 0.341336429f},
-std::array<float,2>{0.887942255f, 0.719516516f},
-std::array<float,2>{0.672918618f, 0.288055182f},
-std::array<float,2>{0.319660038f, 0.677285671f},
-std::array<float,2>{0.0155708184f, 0.0109290779f},
-std::array<float,2>{0.855160952f, 0.852497518f},
-std::array<float,2>{0.939369619f, 0.239142776f},
-std::array<float,2>{0.160073936f, 0.942617059f},
-std::array<float,2>{0.390509099f, 0.485746711f},
-std::array<float,2>{0.610035658f, 0.597251415f},
-std::array<float,2>{0.921186507f, 0.344197959f},
-std::array<float,2>{0.227401838f, 0.702336431f},
-std::array<float,2>{0.470226526f, 0.0999511182f},
-std::array<float,2>{0.515665829f, 0.794733584f},
-std::array<float,2>{0.719213009f, 0.184095368f},
-std::array<float,2>{0.285593808f, 0.896291196f},
-std::array<float,2>{0.0635557249f, 0.387046665f},
-std::array<float,2>{0.780009627f, 0.559545457f},
-std::array<float,2>{0.581023932f, 0.460639507f},
-std::array<float,2>{0.430015713f, 0.579763591f},
-std::array<float,2>{0.135598525f, 0.216866538f},
-std::array<float,2>{0.992437601f, 0.990273118f},
-std::array<float,2>{0.838219166f, 0.0321087502f},
-std::array<float,2>{0.0312887877f, 0.843418121f},
-std::array<float,2>{0.362051934f, 0.276430219f},
-std::array<float,2>{0.627490282f, 0.645006776f},
-std::array<float,2>{0.97435987f, 0.4720577f},
-std::array<float,2>{0.141748443f, 0.610738456f},
-std::array<float,2>{0.420584559f, 0.225444391f},
-std::array<float,2>{0.576635718f, 0.955483913f},
-std::array<float,2>{0.644454718f, 0.0250113718f},
-std::array<float,2>{0.344222665f, 0.871418417f},
-std::array<float,2>{0.0621533431f, 0.298339993f},
-std::array<float,2>{0.824603856f, 0.656379104f},
-std::array<float,2>{0.514042735f, 0.312856376f},
-std::array<float,2>{0.497197896f, 0.748146772f},
-std::array<float,2>{0.235360473f, 0.0876129791f},
-std::array<float,2>{0.922159135f, 0.750450373f},
-std::array<float,2>{0.755162835f, 0.15173389f},
-std::array<float,2>{0.0901541561f, 0.908941269f},
-std::array<float,2>{0.307508826f, 0.413080394f},
-std::array<float,2>{0.743784904f, 0.530970097f},
-std::array<float,2>{0.866479397f, 0.260185361f},
-std::array<float,2>{0.0277564488f, 0.628529191f},
-std::array<float,2>{0.330540687f, 0.0477940999f},
-std::array<float,2>{0.667115808f, 0.827850997f},
-std::array<float,2>{0.599068105f, 0.190440133f},
-std::array<float,2>{0.391554505f, 0.973663151f},
-std::array<float,2>{0.182993412f, 0.440187067f},
-std::array<float,2>{0.966781616f, 0.568727553f},
-std::array<float,2>{0.696841717f, 0.393743992f},
-std::array<float,2>{0.257730842f, 0.543178201f},
-std::array<float,2>{0.100980543f, 0.163946912f},
-std::array<float,2>{0.794775128f, 0.877878368f},
-std::array<float,2>{0.892277956f, 0.12223848f},
-std::array<float,2>{0.208010033f, 0.808855474f},
-std::array<float,2>{0.462961435f, 0.360289931f},
-std::array<float,2>{0.53825891f, 0.71353066f},
-std::array<float,2>{0.816895902f, 0.449649543f},
-std::array<float,2>{0.0493961796f, 0.575867593f},
-std::array<float,2>{0.351913929f, 0.195363358f},
-std::array<float,2>{0.652067363f, 0.977353156f},
-std::array<float,2>{0.568951547f, 0.0603062361f},
-std::array<float,2>{0.412145287f, 0.814728498f},
-std::array<float,2>{0.153844073f, 0.254800439f},
-std::array<float,2>{0.980622828f, 0.634618461f},
-std::array<float,2>{0.739098847f, 0.367431462f},
-std::array<float,2>{0.301193565f, 0.706730962f},
-std::array<float,2>{0.0835865289f, 0.113466263f},
-std::array<float,2>{0.760674596f, 0.803779721f},
-std::array<float,2>{0.935377181f, 0.167968184f},
-std::array<float,2>{0.244737744f, 0.88886863f},
-std::array<float,2>{0.48935464f, 0.403796792f},
-std::array<float,2>{0.500524223f, 0.536539733f},
-std::array<float,2>{0.958889604f, 0.31131956f},
-std::array<float,2>{0.17229709f, 0.664185345f},
-std::array<float,2>{0.40322867f, 0.0176312849f},
-std::array<float,2>{0.604643941f, 0.865346551f},
-std::array<float,2>{0.659577966f, 0.232932821f},
-std::array<float,2>{0.341616333f, 0.966048539f},
-std::array<float,2>{0.0211721547f, 0.483501941f},
-std::array<float,2>{0.87004137f, 0.621383488f},
-std::array<float,2>{0.540085614f, 0.415357888f},
-std::array<float,2>{0.457305491f, 0.517926574f},
-std::array<float,2>{0.211093888f, 0.148366153f},
-std::array<float,2>{0.90076232f, 0.914099395f},
-std::array<float,2>{0.781812072f, 0.0812743977f},
-std::array<float,2>{0.105479151f, 0.762949109f},
-std::array<float,2>{0.261559218f, 0.326519668f},
-std::array<float,2>{0.695042789f, 0.737919569f},
-std::array<float,2>{0.87826705f, 0.376448691f},
-std::array<float,2>{0.198156625f, 0.551992536f},
-std::array<float,2>{0.453069478f, 0.175894246f},
-std::array<float,2>{0.561712563f, 0.899318576f},
-std::array<float,2>{0.71452558f, 0.104320891f},
-std::array<float,2>{0.269954473f, 0.788819313f},
-std::array<float,2>{0.114406176f, 0.356049031f},
-std::array<float,2>{0.798972368f, 0.693460047f},
-std::array<float,2>{0.623451173f, 0.267448694f},
-std::array<float,2>{0.37895003f, 0.65594995f},
-std::array<float,2>{0.170377463f, 0.0428615212f},
-std::array<float,2>{0.951815903f, 0.829574883f},
-std::array<float,2>{0.848763227f, 0.208282471f},
-std::array<float,2>{0.00247123628f, 0.99467957f},
-std::array<float,2>{0.320735812f, 0.466250151f},
-std::array<float,2>{0.684128284f, 0.585989654f},
-std::array<float,2>{0.765806913f, 0.332166195f},
-std::array<float,2>{0.0743218139f, 0.731764793f},
-std::array<float,2>{0.291090012f, 0.0699058995f},
-std::array<float,2>{0.732605398f, 0.775058389f},
-std::array<float,2>{0.52450186f, 0.129603669f},
-std::array<float,2>{0.483918518f, 0.92709893f},
-std::array<float,2>{0.220266789f, 0.423494786f},
-std::array<float,2>{0.912661374f, 0.510093331f},
-std::array<float,2>{0.634123802f, 0.499157131f},
-std::array<float,2>{0.370363355f, 0.607733727f},
-std::array<float,2>{0.0429001786f, 0.242865086f},
-std::array<float,2>{0.832782388f, 0.948332608f},
-std::array<float,2>{0.989039242f, 0.00636437163f},
-std::array<float,2>{0.12557666f, 0.843846858f},
-std::array<float,2>{0.421930969f, 0.289063931f},
-std::array<float,2>{0.590031326f, 0.680533051f},
-std::array<float,2>{0.786227107f, 0.454000145f},
-std::array<float,2>{0.101668052f, 0.585232973f},
-std::array<float,2>{0.262453973f, 0.212198108f},
-std::array<float,2>{0.691335499f, 0.988229334f},
-std::array<float,2>{0.546594858f, 0.0368408263f},
-std::array<float,2>{0.453192204f, 0.838495433f},
-std::array<float,2>{0.216669127f, 0.280147284f},
-std::array<float,2>{0.90318656f, 0.64085561f},
-std::array<float,2>{0.662293673f, 0.347764969f},
-std::array<float,2>{0.338796675f, 0.697279096f},
-std::array<float,2>{0.0185452495f, 0.0971719995f},
-std::array<float,2>{0.872633576f, 0.792584836f},
-std::array<float,2>{0.955015063f, 0.182593122f},
-std::array<float,2>{0.178520009f, 0.890850186f},
-std::array<float,2>{0.401383907f, 0.384653389f},
-std::array<float,2>{0.609161317f, 0.558158517f},
-std::array<float,2>{0.932361901f, 0.285127074f},
-std::array<float,2>{0.246254489f, 0.672039211f},
-std::array<float,2>{0.485725284f, 0.011829026f},
-std::array<float,2>{0.506561399f, 0.856914341f},
-std::array<float,2>{0.735229313f, 0.23644501f},
-std::array<float,2>{0.30001995f, 0.939564347f},
-std::array<float,2>{0.0805372745f, 0.491800874f},
-std::array<float,2>{0.763682544f, 0.59770143f},
-std::array<float,2>{0.563782275f, 0.434356689f},
-std::array<float,2>{0.406388283f, 0.502688348f},
-std::array<float,2>{0.149136007f, 0.139222309f},
-std::array<float,2>{0.977671981f, 0.932872653f},
-std::array<float,2>{0.814015687f, 0.077243343f},
-std::array<float,2>{0.0527120493f, 0.765763164f},
-std::array<float,2>{0.357503295f, 0.336701632f},
-std::array<float,2>{0.652584195f, 0.722680569f},
-std::array<float,2>{0.986468136f, 0.39721927f},
-std::array<float,2>{0.130013034f, 0.539720595f},
-std::array<float,2>{0.426485062f, 0.159349412f},
-std::array<float,2>{0.589103878f, 0.879187107f},
-std::array<float,2>{0.638655961f, 0.119877942f},
-std::array<float,2>{0.374004036f, 0.80476737f},
-std::array<float,2>{0.0463176891f, 0.363561898f},
-std::array<float,2>{0.830392361f, 0.718375027f},
-std::array<float,2>{0.530874014f, 0.263438344f},
-std::array<float,2>{0.480097592f, 0.63011831f},
-std::array<float,2>{0.22549735f, 0.0517647937f},
-std::array<float,2>{0.907921016f, 0.823510587f},
-std::array<float,2>{0.771481037f, 0.194798708f},
-std::array<float,2>{0.0735684037f, 0.971556365f},
-std::array<float,2>{0.294232666f, 0.442389756f},
-std::array<float,2>{0.729861975f, 0.565888047f},
-std::array<float,2>{0.844064295f, 0.316791058f},
-std::array<float,2>{0.00678868592f, 0.74533391f},
-std::array<float,2>{0.327613443f, 0.0907641128f},
-std::array<float,2>{0.682317436f, 0.755626559f},
-std::array<float,2>{0.619100749f, 0.153471991f},
-std::array<float,2>{0.378624201f, 0.911515236f},
-std::array<float,2>{0.165500626f, 0.407952636f},
-std::array<float,2>{0.948313475f, 0.526537716f},
-std::array<float,2>{0.71650517f, 0.476343006f},
-std::array<float,2>{0.265783012f, 0.613750994f},
-std::array<float,2>{0.11232391f, 0.222061306f},
-std::array<float,2>{0.801982224f, 0.958496928f},
-std::array<float,2>{0.882347524f, 0.0283017289f},
-std::array<float,2>{0.202220857f, 0.867754519f},
-std::array<float,2>{0.448774874f, 0.30115515f},
-std::array<float,2>{0.555641949f, 0.661676109f},
-std::array<float,2>{0.843219697f, 0.41859898f},
-std::array<float,2>{0.0360645317f, 0.521422744f},
-std::array<float,2>{0.364195973f, 0.142394885f},
-std::array<float,2>{0.629840434f, 0.92078501f},
-std::array<float,2>{0.584825456f, 0.0846870393f},
-std::array<float,2>{0.435911059f, 0.758577287f},
-std::array<float,2>{0.138087764f, 0.32075575f},
-std::array<float,2>{0.996104956f, 0.741009176f},
-std::array<float,2>{0.72553277f, 0.305431932f},
-std::array<float,2>{0.283058852f, 0.669412136f},
-std::array<float,2>{0.0669995323f, 0.020172691f},
-std::array<float,2>{0.777199686f, 0.859567523f},
-std::array<float,2>{0.917625308f, 0.228478089f},
-std::array<float,2>{0.232969135f, 0.961038589f},
-std::array<float,2>{0.474228114f, 0.477166206f},
-std::array<float,2>{0.523010552f, 0.617490828f},
-std::array<float,2>{0.941939116f, 0.371257931f},
-std::array<float,2>{0.160377949f, 0.708845317f},
-std::array<float,2>{0.385344356f, 0.109969147f},
-std::array<float,2>{0.616795719f, 0.798382759f},
-std::array<float,2>{0.678309321f, 0.170796037f},
-std::array<float,2>{0.315586239f, 0.88294816f},
-std::array<float,2>{0.00887069665f, 0.401308417f},
-std::array<float,2>{0.856116056f, 0.532668293f},
-std::array<float,2>{0.548904717f, 0.448035985f},
-std::array<float,2>{0.443186134f, 0.572783649f},
-std::array<float,2>{0.194187313f, 0.2010362f},
-std::array<float,2>{0.884666383f, 0.983603835f},
-std::array<float,2>{0.811124623f, 0.0569327921f},
-std::array<float,2>{0.121793233f, 0.817311049f},
-std::array<float,2>{0.275808215f, 0.252616853f},
-std::array<float,2>{0.709285855f, 0.639263272f},
-std::array<float,2>{0.896978259f, 0.495574713f},
-std::array<float,2>{0.204957306f, 0.604903102f},
-std::array<float,2>{0.46553424f, 0.246789187f},
-std::array<float,2>{0.532839298f, 0.949413061f},
-std::array<float,2>{0.701008558f, 0.00138019631f},
-std::array<float,2>{0.250388801f, 0.847879648f},
-std::array<float,2>{0.0944627598f, 0.295456737f},
-std::array<float,2>{0.790777683f, 0.685894966f},
-std::array<float,2>{0.59556973f, 0.331760466f},
-std::array<float,2>{0.398258239f, 0.727280557f},
-std::array<float,2>{0.183941767f, 0.0656884983f},
-std::array<float,2>{0.964424253f, 0.778176486f},
-std::array<float,2>{0.862955093f, 0.126664832f},
-std::array<float,2>{0.0258528795f, 0.92477119f},
-std::array<float,2>{0.334921658f, 0.425795674f},
-std::array<float,2>{0.670995593f, 0.512992859f},
-std::array<float,2>{0.753849506f, 0.269825906f},
-std::array<float,2>{0.0870850235f, 0.649034917f},
-std::array<float,2>{0.309510082f, 0.0445068143f},
-std::array<float,2>{0.747148335f, 0.832259893f},
-std::array<float,2>{0.50917089f, 0.205802709f},
-std::array<float,2>{0.493540436f, 0.999233902f},
-std::array<float,2>{0.23936896f, 0.462541372f},
-std::array<float,2>{0.928241134f, 0.591554582f},
-std::array<float,2>{0.645112336f, 0.381388754f},
-std::array<float,2>{0.34793067f, 0.548655331f},
-std::array<float,2>{0.0576726496f, 0.17301558f},
-std::array<float,2>{0.823918879f, 0.904108047f},
-std::array<float,2>{0.972473979f, 0.108816311f},
-std::array<float,2>{0.144811913f, 0.782542229f},
-std::array<float,2>{0.414586872f, 0.354684561f},
-std::array<float,2>{0.571975589f, 0.687665939f},
-std::array<float,2>{0.777575016f, 0.388964295f},
-std::array<float,2>{0.0651006103f, 0.561846256f},
-std::array<float,2>{0.288117439f, 0.186236769f},
-std::array<float,2>{0.721732736f, 0.896689475f},
-std::array<float,2>{0.518913448f, 0.0984565467f},
-std::array<float,2>{0.471868813f, 0.795433402f},
-std::array<float,2>{0.228617102f, 0.346948028f},
-std::array<float,2>{0.918976545f, 0.701093018f},
-std::array<float,2>{0.62513572f, 0.274830461f},
-std::array<float,2>{0.361025125f, 0.646848381f},
-std::array<float,2>{0.0347681195f, 0.0338797718f},
-std::array<float,2>{0.836690426f, 0.840891123f},
-std::array<float,2>{0.995334864f, 0.215042695f},
-std::array<float,2>{0.134319991f, 0.989995122f},
-std::array<float,2>{0.433197051f, 0.45840627f},
-std::array<float,2>{0.578174412f, 0.581325531f},
-std::array<float,2>{0.890361488f, 0.342407942f},
-std::array<float,2>{0.188862622f, 0.720714986f},
-std::array<float,2>{0.441291898f, 0.072189264f},
-std::array<float,2>{0.551972926f, 0.772637248f},
-std::array<float,2>{0.70592308f, 0.133609086f},
-std::array<float,2>{0.278179109f, 0.934571505f},
-std::array<float,2>{0.120562159f, 0.432896346f},
-std::array<float,2>{0.80698514f, 0.505892158f},
-std::array<float,2>{0.612296522f, 0.487596542f},
-std::array<float,2>{0.387893349f, 0.594769776f},
-std::array<float,2>{0.156306624f, 0.24185124f},
-std::array<float,2>{0.940266967f, 0.945285738f},
-std::array<float,2>{0.853363931f, 0.00850241911f},
-std::array<float,2>{0.0125349509f, 0.854495525f},
-std::array<float,2>{0.317369491f, 0.285250932f},
-std::array<float,2>{0.674317837f, 0.679175377f},
-std::array<float,2>{0.968628585f, 0.437572241f},
-std::array<float,2>{0.180982143f, 0.567414224f},
-std::array<float,2>{0.392784268f, 0.188388243f},
-std::array<float,2>{0.600340545f, 0.976412416f},
-std::array<float,2>{0.66407299f, 0.0494780093f},
-std::array<float,2>{0.329647362f, 0.824632525f},
-std::array<float,2>{0.0301804878f, 0.259370595f},
-std::array<float,2>{0.864605546f, 0.62568754f},
-std::array<float,2>{0.535262764f, 0.361722112f},
-std::array<float,2>{0.462674588f, 0.712396681f},
-std::array<float,2>{0.210271418f, 0.123387195f},
-std::array<float,2>{0.894235015f, 0.811848342f},
-std::array<float,2>{0.796354115f, 0.161385268f},
-std::array<float,2>{0.0985404849f, 0.875926018f},
-std::array<float,2>{0.254800528f, 0.392161816f},
-std::array<float,2>{0.697696507f, 0.545945823f},
-std::array<float,2>{0.826198101f, 0.300562412f},
-std::array<float,2>{0.0590297356f, 0.659722567f},
-std::array<float,2>{0.346154392f, 0.0270797648f},
-std::array<float,2>{0.6419245f, 0.873711467f},
-std::array<float,2>{0.575689375f, 0.22422196f},
-std::array<float,2>{0.419264793f, 0.954052746f},
-std::array<float,2>{0.143017545f, 0.47060293f},
-std::array<float,2>{0.976388931f, 0.612767696f},
-std::array<float,2>{0.745540798f, 0.41144833f},
-std::array<float,2>{0.305261195f, 0.52889359f},
-std::array<float,2>{0.0925243869f, 0.149484411f},
-std::array<float,2>{0.756863475f, 0.906473696f},
-std::array<float,2>{0.924607277f, 0.0884640068f},
-std::array<float,2>{0.237906381f, 0.752684593f},
-std::array<float,2>{0.499899566f, 0.314893335f},
-std::array<float,2>{0.51299119f, 0.748015285f},
-std::array<float,2>{0.867538929f, 0.480826825f},
-std::array<float,2>{0.0215151031f, 0.624452293f},
-std::array<float,2>{0.343514651f, 0.230890781f},
-std::array<float,2>{0.656362712f, 0.967812955f},
-std::array<float,2>{0.601985574f, 0.0171745382f},
-std::array<float,2>{0.404855251f, 0.863484979f},
-std::array<float,2>{0.174687013f, 0.310498774f},
-std::array<float,2>{0.959902644f, 0.666629732f},
-std::array<float,2>{0.6931898f, 0.325034171f},
-std::array<float,2>{0.258738458f, 0.735482097f},
-std::array<float,2>{0.109336987f, 0.0800340027f},
-std::array<float,2>{0.784207284f, 0.765620887f},
-std::array<float,2>{0.900378346f, 0.145137802f},
-std::array<float,2>{0.214273274f, 0.917757928f},
-std::array<float,2>{0.459355086f, 0.417826384f},
-std::array<float,2>{0.541618228f, 0.51731348f},
-std::array<float,2>{0.98376888f, 0.255924553f},
-std::array<float,2>{0.154938862f, 0.635463238f},
-std::array<float,2>{0.410438359f, 0.0609790422f},
-std::array<float,2>{0.567708194f, 0.812632143f},
-std::array<float,2>{0.648567617f, 0.197332621f},
-std::array<float,2>{0.354590863f, 0.979657292f},
-std::array<float,2>{0.0471073426f, 0.452385098f},
-std::array<float,2>{0.819271088f, 0.576687336f},
-std::array<float,2>{0.502740562f, 0.404929698f},
-std::array<float,2>{0.491981119f, 0.538160205f},
-std::array<float,2>{0.24307394f, 0.165183663f},
-std::array<float,2>{0.936208606f, 0.887195468f},
-std::array<float,2>{0.759260118f, 0.11639563f},
-std::array<float,2>{0.0842795819f, 0.800833225f},
-std::array<float,2>{0.30407092f, 0.369754791f},
-std::array<float,2>{0.742171049f, 0.703846753f},
-std::array<float,2>{0.91097492f, 0.424673468f},
-std::array<float,2>{0.220996931f, 0.507907987f},
-std::array<float,2>{0.481026918f, 0.132273465f},
-std::array<float,2>{0.526347935f, 0.928566396f},
-std::array<float,2>{0.731317937f, 0.06819278f},
-std::array<float,2>{0.290771544f, 0.777240813f},
-std::array<float,2>{0.0781181082f, 0.335558742f},
-std::array<float,2>{0.768218815f, 0.733059287f},
-std::array<float,2>{0.592171907f, 0.291669816f},
-std::array<float,2>{0.425398707f, 0.682075083f},
-std::array<float,2>{0.128115535f, 0.00511292554f},
-std::array<float,2>{0.991388261f, 0.847106457f},
-std::array<float,2>{0.834008873f, 0.245401829f},
-std::array<float,2>{0.0402712151f, 0.946269453f},
-std::array<float,2>{0.367823213f, 0.496540248f},
-std::array<float,2>{0.636489332f, 0.606255889f},
-std::array<float,2>{0.797738254f, 0.358503848f},
-std::array<float,2>{0.116062813f, 0.693030715f},
-std::array<float,2>{0.27208066f, 0.102706939f},
-std::array<float,2>{0.711373806f, 0.78706944f},
-std::array<float,2>{0.558828712f, 0.179054126f},
-std::array<float,2>{0.449865669f, 0.901481092f},
-std::array<float,2>{0.195386514f, 0.377455145f},
-std::array<float,2>{0.875733376f, 0.552859366f},
-std::array<float,2>{0.687129557f, 0.468313456f},
-std::array<float,2>{0.323168099f, 0.589697301f},
-std::array<float,2>{0.00178345642f, 0.209952474f},
-std::array<float,2>{0.851468861f, 0.992858589f},
-std::array<float,2>{0.949653506f, 0.0405371152f},
-std::array<float,2>{0.169752598f, 0.831623852f},
-std::array<float,2>{0.381209105f, 0.267595023f},
-std::array<float,2>{0.622879386f, 0.653164089f},
-std::array<float,2>{0.77334702f, 0.441720456f},
-std::array<float,2>{0.0722345039f, 0.56448096f},
-std::array<float,2>{0.296493828f, 0.194147453f},
-std::array<float,2>{0.727465749f, 0.972556949f},
-std::array<float,2>{0.528353393f, 0.0507890247f},
-std::array<float,2>{0.47790134f, 0.822730005f},
-std::array<float,2>{0.223072052f, 0.262314498f},
-std::array<float,2>{0.908912361f, 0.629684269f},
-std::array<float,2>{0.640535951f, 0.364802837f},
-std::array<float,2>{0.371786684f, 0.717551529f},
-std::array<float,2>{0.0448413938f, 0.12058793f},
-std::array<float,2>{0.828864038f, 0.806044519f},
-std::array<float,2>{0.985700905f, 0.159068868f},
-std::array<float,2>{0.132601857f, 0.88024801f},
-std::array<float,2>{0.428353101f, 0.398213387f},
-std::array<float,2>{0.586684644f, 0.540568769f},
-std::array<float,2>{0.8807289f, 0.301762134f},
-std::array<float,2>{0.200970426f, 0.660708547f},
-std::array<float,2>{0.446790487f, 0.0290895086f},
-std::array<float,2>{0.55753988f, 0.868779123f},
-std::array<float,2>{0.717958093f, 0.22127068f},
-std::array<float,2>{0.269105703f, 0.957153141f},
-std::array<float,2>{0.111076355f, 0.47490263f},
-std::array<float,2>{0.80331111f, 0.615003109f},
-std::array<float,2>{0.619389474f, 0.407221019f},
-std::array<float,2>{0.375049233f, 0.525492191f},
-std::array<float,2>{0.166301861f, 0.152522355f},
-std::array<float,2>{0.945949554f, 0.910605907f},
-std::array<float,2>{0.847451687f, 0.0913200602f},
-std::array<float,2>{0.00455780234f, 0.754633248f},
-std::array<float,2>{0.32509473f, 0.317914307f},
-std::array<float,2>{0.679785907f, 0.744636476f},
-std::array<float,2>{0.956185937f, 0.383146316f},
-std::array<float,2>{0.176223814f, 0.55698216f},
-std::array<float,2>{0.399449676f, 0.182655647f},
-std::array<float,2>{0.607058585f, 0.892415643f},
-std::array<float,2>{0.660681307f, 0.0959302559f},
-std::array<float,2>{0.336708903f, 0.791933417f},
-std::array<float,2>{0.0161810275f, 0.349378347f},
-std::array<float,2>{0.87365514f, 0.698740184f},
-std::array<float,2>{0.544584572f, 0.280872226f},
-std::array<float,2>{0.455091566f, 0.642340362f},
-std::array<float,2>{0.217597231f, 0.0351636857f},
-std::array<float,2>{0.905074596f, 0.839340806f},
-std::array<float,2>{0.787540436f, 0.211573839f},
-std::array<float,2>{0.104360804f, 0.986668408f},
-std::array<float,2>{0.265236497f, 0.454273701f},
-std::array<float,2>{0.687773407f, 0.584653139f},
-std::array<float,2>{0.814775944f, 0.337381989f},
-std::array<float,2>{0.0542166345f, 0.724044204f},
-std::array<float,2>{0.357088208f, 0.0764830485f},
-std::array<float,2>{0.65592432f, 0.767478943f},
-std::array<float,2>{0.565373361f, 0.140411019f},
-std::array<float,2>{0.409355164f, 0.932167649f},
-std::array<float,2>{0.151432186f, 0.435118884f},
-std::array<float,2>{0.979232252f, 0.503773868f},
-std::array<float,2>{0.737369657f, 0.490274549f},
-std::array<float,2>{0.29863736f, 0.599556684f},
-std::array<float,2>{0.0795716718f, 0.238020763f},
-std::array<float,2>{0.763402462f, 0.940762162f},
-std::array<float,2>{0.929939747f, 0.012888669f},
-std::array<float,2>{0.248478919f, 0.856166661f},
-std::array<float,2>{0.486426651f, 0.283425897f},
-std::array<float,2>{0.505065322f, 0.673004448f},
-std::array<float,2>{0.860320628f, 0.427561939f},
-std::array<float,2>{0.0243793167f, 0.512152195f},
-std::array<float,2>{0.332991302f, 0.12527208f},
-std::array<float,2>{0.669052005f, 0.925234795f},
-std::array<float,2>{0.596138656f, 0.0646551028f},
-std::array<float,2>{0.394765943f, 0.778617859f},
-std::array<float,2>{0.186234191f, 0.330158323f},
-std::array<float,2>{0.961394429f, 0.727914512f},
-std::array<float,2>{0.701278448f, 0.296620935f},
-std::array<float,2>{0.253883958f, 0.687483132f},
-std::array<float,2>{0.0960010216f, 0.000131112218f},
-std::array<float,2>{0.791553557f, 0.849233508f},
-std::array<float,2>{0.896419227f, 0.24736096f},
-std::array<float,2>{0.205674559f, 0.950722277f},
-std::array<float,2>{0.467267603f, 0.494205683f},
-std::array<float,2>{0.534630239f, 0.603878856f},
-std::array<float,2>{0.968795717f, 0.354210645f},
-std::array<float,2>{0.147710964f, 0.689152122f},
-std::array<float,2>{0.416710049f, 0.107892916f},
-std::array<float,2>{0.573897004f, 0.781969309f},
-std::array<float,2>{0.64776051f, 0.171917111f},
-std::array<float,2>{0.350827694f, 0.90330863f},
-std::array<float,2>{0.0557230301f, 0.382153571f},
-std::array<float,2>{0.820539236f, 0.547679007f},
-std::array<float,2>{0.509896517f, 0.46120587f},
-std::array<float,2>{0.494363785f, 0.590125978f},
-std::array<float,2>{0.24186708f, 0.20669046f},
-std::array<float,2>{0.926706195f, 0.998149872f},
-std::array<float,2>{0.750079393f, 0.0434875786f},
-std::array<float,2>{0.0885458589f, 0.83397603f},
-std::array<float,2>{0.311071396f, 0.270518899f},
-std::array<float,2>{0.749119222f, 0.649510503f},
-std::array<float,2>{0.915112436f, 0.478287637f},
-std::array<float,2>{0.230677575f, 0.618519247f},
-std::array<float,2>{0.475854278f, 0.227075621f},
-std::array<float,2>{0.519819081f, 0.962819934f},
-std::array<float,2>{0.724564612f, 0.0212698728f},
-std::array<float,2>{0.284058601f, 0.860758126f},
-std::array<float,2>{0.0686459616f, 0.306425482f},
-std::array<float,2>{0.773862302f, 0.668165565f},
-std::array<float,2>{0.58394444f, 0.321370214f},
-std::array<float,2>{0.434869319f, 0.741917014f},
-std::array<float,2>{0.140353113f, 0.0850390345f},
-std::array<float,2>{0.998286784f, 0.759044528f},
-std::array<float,2>{0.840780795f, 0.140959218f},
-std::array<float,2>{0.0372814983f, 0.920899212f},
-std::array<float,2>{0.366418868f, 0.419900239f},
-std::array<float,2>{0.632351995f, 0.519884229f},
-std::array<float,2>{0.80958575f, 0.253196329f},
-std::array<float,2>{0.124670446f, 0.640337646f},
-std::array<float,2>{0.274096608f, 0.0578994565f},
-std::array<float,2>{0.707167506f, 0.817882001f},
-std::array<float,2>{0.548225284f, 0.199936002f},
-std::array<float,2>{0.444771469f, 0.983148634f},
-std::array<float,2>{0.193034425f, 0.448927432f},
-std::array<float,2>{0.885601699f, 0.573423624f},
-std::array<float,2>{0.676628947f, 0.402058631f},
-std::array<float,2>{0.312951446f, 0.532000303f},
-std::array<float,2>{0.010028231f, 0.171126723f},
-std::array<float,2>{0.858293414f, 0.883943915f},
-std::array<float,2>{0.944000483f, 0.110919319f},
-std::array<float,2>{0.162262738f, 0.797157705f},
-std::array<float,2>{0.383047163f, 0.372255653f},
-std::array<float,2>{0.613580406f, 0.707318425f},
-std::array<float,2>{0.793872654f, 0.391285747f},
-std::array<float,2>{0.100352459f, 0.545639277f},
-std::array<float,2>{0.25645262f, 0.161008045f},
-std::array<float,2>{0.695832074f, 0.876498401f},
-std::array<float,2>{0.537451744f, 0.124581158f},
-std::array<float,2>{0.464458019f, 0.811196566f},
-std::array<float,2>{0.20746164f, 0.36289531f},
-std::array<float,2>{0.891072869f, 0.711896777f},
-std::array<float,2>{0.666430116f, 0.258334726f},
-std::array<float,2>{0.331847131f, 0.626748085f},
-std::array<float,2>{0.0291075036f, 0.0498899631f},
-std::array<float,2>{0.86564678f, 0.825834334f},
-std::array<float,2>{0.965280533f, 0.188548833f},
-std::array<float,2>{0.182525009f, 0.974850237f},
-std::array<float,2>{0.391677678f, 0.439301908f},
-std::array<float,2>{0.598231733f, 0.566561162f},
-std::array<float,2>{0.923718035f, 0.315587968f},
-std::array<float,2>{0.234725773f, 0.74674505f},
-std::array<float,2>{0.496112406f, 0.0891905203f},
-std::array<float,2>{0.514916241f, 0.753278136f},
-std::array<float,2>{0.742950201f, 0.148477629f},
-std::array<float,2>{0.308043629f, 0.907901943f},
-std::array<float,2>{0.091200918f, 0.410757005f},
-std::array<float,2>{0.754245639f, 0.52794224f},
-std::array<float,2>{0.577455223f, 0.46961841f},
-std::array<float,2>{0.421193451f, 0.6122756f},
-std::array<float,2>{0.140780389f, 0.2226803f},
-std::array<float,2>{0.972891629f, 0.954547822f},
-std::array<float,2>{0.825534225f, 0.02636672f},
-std::array<float,2>{0.0606345236f, 0.874776304f},
-std::array<float,2>{0.345282376f, 0.299615949f},
-std::array<float,2>{0.642747641f, 0.65843612f},
-std::array<float,2>{0.993260324f, 0.457981259f},
-std::array<float,2>{0.136503786f, 0.58086741f},
-std::array<float,2>{0.43093434f, 0.216215611f},
-std::array<float,2>{0.581479847f, 0.988800049f},
-std::array<float,2>{0.628388047f, 0.034902595f},
-std::array<float,2>{0.362748951f, 0.840066731f},
-std::array<float,2>{0.0322898179f, 0.274170905f},
-std::array<float,2>{0.839221418f, 0.647470832f},
-std::array<float,2>{0.517262459f, 0.346143007f},
-std::array<float,2>{0.468787938f, 0.699588001f},
-std::array<float,2>{0.227614239f, 0.0995261371f},
-std::array<float,2>{0.920220792f, 0.796188831f},
-std::array<float,2>{0.780756474f, 0.186979756f},
-std::array<float,2>{0.0628739595f, 0.897796929f},
-std::array<float,2>{0.286618739f, 0.390376985f},
-std::array<float,2>{0.72034514f, 0.560787499f},
-std::array<float,2>{0.854267776f, 0.286633521f},
-std::array<float,2>{0.0140605038f, 0.678290844f},
-std::array<float,2>{0.318696499f, 0.00888491794f},
-std::array<float,2>{0.67260915f, 0.85427767f},
-std::array<float,2>{0.611217201f, 0.24072285f},
-std::array<float,2>{0.389624149f, 0.944303811f},
-std::array<float,2>{0.158310995f, 0.486436516f},
-std::array<float,2>{0.938377798f, 0.594588995f},
-std::array<float,2>{0.703378081f, 0.431846023f},
-std::array<float,2>{0.280315012f, 0.507498145f},
-std::array<float,2>{0.117970474f, 0.134038851f},
-std::array<float,2>{0.805276096f, 0.934458554f},
-std::array<float,2>{0.887173235f, 0.0708567649f},
-std::array<float,2>{0.191316605f, 0.772189319f},
-std::array<float,2>{0.439419866f, 0.342999995f},
-std::array<float,2>{0.554402649f, 0.722460747f},
-std::array<float,2>{0.833168447f, 0.497770518f},
-std::array<float,2>{0.041791562f, 0.607343972f},
-std::array<float,2>{0.370043129f, 0.244824961f},
-std::array<float,2>{0.633359671f, 0.946702242f},
-std::array<float,2>{0.590903401f, 0.00406096363f},
-std::array<float,2>{0.42299071f, 0.846087217f},
-std::array<float,2>{0.126536965f, 0.292751789f},
-std::array<float,2>{0.990173876f, 0.683583975f},
-std::array<float,2>{0.733876884f, 0.334944904f},
-std::array<float,2>{0.29257223f, 0.733676076f},
-std::array<float,2>{0.075488627f, 0.0667906255f},
-std::array<float,2>{0.767199695f, 0.775847793f},
-std::array<float,2>{0.913488507f, 0.130948022f},
-std::array<float,2>{0.219166547f, 0.929210544f},
-std::array<float,2>{0.482560724f, 0.425049692f},
-std::array<float,2>{0.523702502f, 0.50943774f},
-std::array<float,2>{0.95288384f, 0.268969893f},
-std::array<float,2>{0.171542883f, 0.653802216f},
-std::array<float,2>{0.379982889f, 0.0397476107f},
-std::array<float,2>{0.624075711f, 0.831029773f},
-std::array<float,2>{0.684924543f, 0.210617498f},
-std::array<float,2>{0.321551085f, 0.994107962f},
-std::array<float,2>{0.00348006142f, 0.467332453f},
-std::array<float,2>{0.848588765f, 0.588799953f},
-std::array<float,2>{0.561246634f, 0.378219813f},
-std::array<float,2>{0.451844603f, 0.554182291f},
-std::array<float,2>{0.198743105f, 0.178048968f},
-std::array<float,2>{0.877788484f, 0.901220143f},
-std::array<float,2>{0.799994588f, 0.102500848f},
-std::array<float,2>{0.114159495f, 0.785652518f},
-std::array<float,2>{0.270508587f, 0.357782781f},
-std::array<float,2>{0.713426948f, 0.692316532f},
-std::array<float,2>{0.901907146f, 0.416724503f},
-std::array<float,2>{0.212788418f, 0.515758812f},
-std::array<float,2>{0.458881229f, 0.145993605f},
-std::array<float,2>{0.539076388f, 0.916399598f},
-std::array<float,2>{0.693498552f, 0.0786647201f},
-std::array<float,2>{0.260195076f, 0.763900578f},
-std::array<float,2>{0.10685803f, 0.325222462f},
-std::array<float,2>{0.782877564f, 0.734972239f},
-std::array<float,2>{0.604147553f, 0.308616132f},
-std::array<float,2>{0.403505951f, 0.667902768f},
-std::array<float,2>{0.173613325f, 0.0161261074f},
-std::array<float,2>{0.957116127f, 0.864689827f},
-std::array<float,2>{0.870316982f, 0.231800959f},
-std::array<float,2>{0.0195880104f, 0.967006683f},
-std::array<float,2>{0.340369701f, 0.482392728f},
-std::array<float,2>{0.659052908f, 0.623772383f},
-std::array<float,2>{0.760767281f, 0.370406955f},
-std::array<float,2>{0.0825072452f, 0.704518855f},
-std::array<float,2>{0.301837087f, 0.115612052f},
-std::array<float,2>{0.739456296f, 0.802527666f},
-std::array<float,2>{0.501824915f, 0.164448857f},
-std::array<float,2>{0.489053428f, 0.888136566f},
-std::array<float,2>{0.245998725f, 0.405969203f},
-std::array<float,2>{0.933809817f, 0.537940264f},
-std::array<float,2>{0.650549889f, 0.45191738f},
-std::array<float,2>{0.352884382f, 0.577575743f},
-std::array<float,2>{0.0502228811f, 0.198874354f},
-std::array<float,2>{0.817603707f, 0.979315519f},
-std::array<float,2>{0.981800079f, 0.0622316748f},
-std::array<float,2>{0.152906939f, 0.813785851f},
-std::array<float,2>{0.413646966f, 0.257665068f},
-std::array<float,2>{0.56988889f, 0.636599004f},
-std::array<float,2>{0.801202774f, 0.474174827f},
-std::array<float,2>{0.111695737f, 0.616321564f},
-std::array<float,2>{0.267521501f, 0.219128653f},
-std::array<float,2>{0.715538502f, 0.960558414f},
-std::array<float,2>{0.556526721f, 0.0303109977f},
-std::array<float,2>{0.447892666f, 0.869945407f},
-std::array<float,2>{0.201720923f, 0.303091615f},
-std::array<float,2>{0.881595671f, 0.662825704f},
-std::array<float,2>{0.682854593f, 0.319552302f},
-std::array<float,2>{0.326408744f, 0.743001401f},
-std::array<float,2>{0.00701437704f, 0.0935980827f},
-std::array<float,2>{0.844808519f, 0.756810546f},
-std::array<float,2>{0.947748661f, 0.155911162f},
-std::array<float,2>{0.165028661f, 0.914011419f},
-std::array<float,2>{0.377464324f, 0.409863293f},
-std::array<float,2>{0.617592931f, 0.524672091f},
-std::array<float,2>{0.90669328f, 0.265124023f},
-std::array<float,2>{0.225926131f, 0.631089568f},
-std::array<float,2>{0.47893849f, 0.0541412756f},
-std::array<float,2>{0.529557526f, 0.821680427f},
-std::array<float,2>{0.728604078f, 0.192389295f},
-std::array<float,2>{0.29385516f, 0.970403612f},
-std::array<float,2>{0.0723119304f, 0.44448927f},
-std::array<float,2>{0.769596457f, 0.56390053f},
-std::array<float,2>{0.588514984f, 0.395771742f},
-std::array<float,2>{0.427553773f, 0.542136014f},
-std::array<float,2>{0.129805878f, 0.157646f},
-std::array<float,2>{0.987659991f, 0.881966889f},
-std::array<float,2>{0.831695437f, 0.118094973f},
-std::array<float,2>{0.0450170003f, 0.807596862f},
-std::array<float,2>{0.374186724f, 0.36676234f},
-std::array<float,2>{0.63725847f, 0.71551162f},
-std::array<float,2>{0.977009714f, 0.437117368f},
-std::array<float,2>{0.149651811f, 0.501825869f},
-std::array<float,2>{0.407833964f, 0.137075067f},
-std::array<float,2>{0.563368738f, 0.930472255f},
-std::array<float,2>{0.653327405f, 0.0748918951f},
-std::array<float,2>{0.358841181f, 0.769009113f},
-std::array<float,2>{0.051623214f, 0.337923437f},
-std::array<float,2>{0.813130021f, 0.725247204f},
-std::array<float,2>{0.507241845f, 0.283198506f},
-std::array<float,2>{0.485325336f, 0.67428565f},
-std::array<float,2>{0.247476697f, 0.0144277606f},
-std::array<float,2>{0.93352139f, 0.859288633f},
-std::array<float,2>{0.765614986f, 0.235237777f},
-std::array<float,2>{0.0812803805f, 0.939411461f},
-std::array<float,2>{0.298990309f, 0.48908031f},
-std::array<float,2>{0.736032128f, 0.60137248f},
-std::array<float,2>{0.871524155f, 0.350763649f},
-std::array<float,2>{0.0186777301f, 0.696900547f},
-std::array<float,2>{0.338919818f, 0.0945180207f},
-std::array<float,2>{0.66353029f, 0.790987551f},
-std::array<float,2>{0.608036339f, 0.180080414f},
-std::array<float,2>{0.400443524f, 0.892583907f},
-std::array<float,2>{0.179133117f, 0.385440469f},
-std::array<float,2>{0.953824162f, 0.556501985f},
-std::array<float,2>{0.689466357f, 0.455527484f},
-std::array<float,2>{0.263531089f, 0.583032846f},
-std::array<float,2>{0.102716297f, 0.213571444f},
-std::array<float,2>{0.785660982f, 0.985302091f},
-std::array<float,2>{0.904149771f, 0.0376593694f},
-std::array<float,2>{0.215177685f, 0.836701632f},
-std::array<float,2>{0.454666346f, 0.278742254f},
-std::array<float,2>{0.545363128f, 0.643307149f},
-std::array<float,2>{0.822822928f, 0.378941834f},
-std::array<float,2>{0.0573574565f, 0.550208867f},
-std::array<float,2>{0.349490523f, 0.174419522f},
-std::array<float,2>{0.64553082f, 0.906228125f},
-std::array<float,2>{0.570312858f, 0.105670899f},
-std::array<float,2>{0.415699899f, 0.784673691f},
-std::array<float,2>{0.145665511f, 0.351834565f},
-std::array<float,2>{0.970891953f, 0.689572096f},
-std::array<float,2>{0.746733069f, 0.272937626f},
-std::array<float,2>{0.310405016f, 0.652036011f},
-std::array<float,2>{0.0861381143f, 0.0452238694f},
-std::array<float,2>{0.752197564f, 0.834956944f},
-std::array<float,2>{0.928723872f, 0.204870537f},
-std::array<float,2>{0.238299996f, 0.996464372f},
-std::array<float,2>{0.492589921f, 0.464280337f},
-std::array<float,2>{0.507827878f, 0.591982424f},
-std::array<float,2>{0.963532209f, 0.329232842f},
-std::array<float,2>{0.185177699f, 0.728615046f},
-std::array<float,2>{0.397100747f, 0.0627951324f},
-std::array<float,2>{0.594551623f, 0.779773414f},
-std::array<float,2>{0.670131564f, 0.128060177f},
-std::array<float,2>{0.335717678f, 0.922947109f},
-std::array<float,2>{0.0269249622f, 0.428411812f},
-std::array<float,2>{0.861837268f, 0.515101016f},
-std::array<float,2>{0.532074153f, 0.493868023f},
-std::array<float,2>{0.465980321f, 0.60324955f},
-std::array<float,2>{0.20353052f, 0.248073697f},
-std::array<float,2>{0.897709429f, 0.952069223f},
-std::array<float,2>{0.790029526f, 0.00198248425f},
-std::array<float,2>{0.0955435857f, 0.851361215f},
-std::array<float,2>{0.251139134f, 0.294508994f},
-std::array<float,2>{0.699345112f, 0.685526073f},
-std::array<float,2>{0.882885635f, 0.446484625f},
-std::array<float,2>{0.19486925f, 0.570651829f},
-std::array<float,2>{0.441943467f, 0.201554313f},
-std::array<float,2>{0.550736427f, 0.982147992f},
-std::array<float,2>{0.710550487f, 0.0560166985f},
-std::array<float,2>{0.276604474f, 0.818592787f},
-std::array<float,2>{0.122222498f, 0.250667423f},
-std::array<float,2>{0.812159657f, 0.638493061f},
-std::array<float,2>{0.61526686f, 0.373211443f},
-std::array<float,2>{0.386471897f, 0.709778547f},
-std::array<float,2>{0.161342174f, 0.1130457f},
-std::array<float,2>{0.942882359f, 0.799871445f},
-std::array<float,2>{0.856716454f, 0.169573322f},
-std::array<float,2>{0.00857666042f, 0.886006176f},
-std::array<float,2>{0.314481109f, 0.398812741f},
-std::array<float,2>{0.678775251f, 0.534950435f},
-std::array<float,2>{0.776251018f, 0.307726771f},
-std::array<float,2>{0.0680471659f, 0.670003116f},
-std::array<float,2>{0.281991571f, 0.0220380407f},
-std::array<float,2>{0.726036072f, 0.863257527f},
-std::array<float,2>{0.522201896f, 0.230122253f},
-std::array<float,2>{0.473367929f, 0.963784337f},
-std::array<float,2>{0.23402746f, 0.478572041f},
-std::array<float,2>{0.916879416f, 0.61945951f},
-std::array<float,2>{0.630325615f, 0.420762002f},
-std::array<float,2>{0.364764035f, 0.522225976f},
-std::array<float,2>{0.036184527f, 0.144405112f},
-std::array<float,2>{0.842682838f, 0.919768155f},
-std::array<float,2>{0.997985184f, 0.0824271962f},
-std::array<float,2>{0.137019247f, 0.760699809f},
-std::array<float,2>{0.436985612f, 0.323138297f},
-std::array<float,2>{0.585697353f, 0.740031719f},
-std::array<float,2>{0.756561577f, 0.413391441f},
-std::array<float,2>{0.0932942107f, 0.529386222f},
-std::array<float,2>{0.305837899f, 0.15060097f},
-std::array<float,2>{0.744164109f, 0.909465194f},
-std::array<float,2>{0.512078106f, 0.0868246555f},
-std::array<float,2>{0.498552263f, 0.751911521f},
-std::array<float,2>{0.237126067f, 0.314133078f},
-std::array<float,2>{0.924862146f, 0.749553561f},
-std::array<float,2>{0.64089936f, 0.29698807f},
-std::array<float,2>{0.347425729f, 0.657451034f},
-std::array<float,2>{0.0601306818f, 0.0241962671f},
-std::array<float,2>{0.82733357f, 0.87264663f},
-std::array<float,2>{0.975175381f, 0.22572346f},
-std::array<float,2>{0.143949136f, 0.9561252f},
-std::array<float,2>{0.418085933f, 0.470767587f},
-std::array<float,2>{0.574597538f, 0.609747529f},
-std::array<float,2>{0.89321506f, 0.361129969f},
-std::array<float,2>{0.209169075f, 0.714502335f},
-std::array<float,2>{0.46176675f, 0.121609062f},
-std::array<float,2>{0.536236763f, 0.810409307f},
-std::array<float,2>{0.698796332f, 0.162451074f},
-std::array<float,2>{0.255454361f, 0.878116727f},
-std::array<float,2>{0.0996067673f, 0.392604828f},
-std::array<float,2>{0.795269549f, 0.544428408f},
-std::array<float,2>{0.600640476f, 0.440783828f},
-std::array<float,2>{0.39364782f, 0.569602251f},
-std::array<float,2>{0.179839283f, 0.18991898f},
-std::array<float,2>{0.967349052f, 0.97329998f},
-std::array<float,2>{0.863412678f, 0.048126515f},
-std::array<float,2>{0.030898504f, 0.826590419f},
-std::array<float,2>{0.328252047f, 0.260772973f},
-std::array<float,2>{0.665481448f, 0.627892256f},
-std::array<float,2>{0.941214442f, 0.484834284f},
-std::array<float,2>{0.157484502f, 0.595818341f},
-std::array<float,2>{0.387290448f, 0.239434376f},
-std::array<float,2>{0.612996101f, 0.942304492f},
-std::array<float,2>{0.675773561f, 0.0106710764f},
-std::array<float,2>{0.318107516f, 0.853018343f},
-std::array<float,2>{0.013396278f, 0.288317174f},
-std::array<float,2>{0.852338254f, 0.675914645f},
-std::array<float,2>{0.550847471f, 0.340658337f},
-std::array<float,2>{0.440026134f, 0.72009486f},
-std::array<float,2>{0.187609062f, 0.0725898966f},
-std::array<float,2>{0.889476061f, 0.769642591f},
-std::array<float,2>{0.807810605f, 0.136330575f},
-std::array<float,2>{0.119368456f, 0.935559332f},
-std::array<float,2>{0.279108822f, 0.430559844f},
-std::array<float,2>{0.706685305f, 0.505277932f},
-std::array<float,2>{0.837134123f, 0.275559038f},
-std::array<float,2>{0.0337099284f, 0.646360695f},
-std::array<float,2>{0.359837025f, 0.0322465301f},
-std::array<float,2>{0.6268242f, 0.84198302f},
-std::array<float,2>{0.579239249f, 0.217901364f},
-std::array<float,2>{0.431883305f, 0.991265297f},
-std::array<float,2>{0.133702487f, 0.459949195f},
-std::array<float,2>{0.995029509f, 0.579026103f},
-std::array<float,2>{0.72165066f, 0.388049871f},
-std::array<float,2>{0.288045168f, 0.559913456f},
-std::array<float,2>{0.0658537298f, 0.184917182f},
-std::array<float,2>{0.778796256f, 0.895129383f},
-std::array<float,2>{0.918638647f, 0.10062141f},
-std::array<float,2>{0.229603946f, 0.793356776f},
-std::array<float,2>{0.470926613f, 0.345505685f},
-std::array<float,2>{0.518374681f, 0.701267719f},
-std::array<float,2>{0.850214243f, 0.465177685f},
-std::array<float,2>{0.000638786179f, 0.587188244f},
-std::array<float,2>{0.323711157f, 0.207544848f},
-std::array<float,2>{0.686498821f, 0.995659113f},
-std::array<float,2>{0.621865511f, 0.0412035212f},
-std::array<float,2>{0.382569909f, 0.828452229f},
-std::array<float,2>{0.168515772f, 0.266462833f},
-std::array<float,2>{0.950651228f, 0.654502153f},
-std::array<float,2>{0.712211668f, 0.35682255f},
-std::array<float,2>{0.273169607f, 0.69503659f},
-std::array<float,2>{0.117086068f, 0.105295002f},
-std::array<float,2>{0.797990263f, 0.788042843f},
-std::array<float,2>{0.876496434f, 0.17739816f},
-std::array<float,2>{0.196779549f, 0.90016824f},
-std::array<float,2>{0.450394899f, 0.375179738f},
-std::array<float,2>{0.560102046f, 0.551116467f},
-std::array<float,2>{0.990854025f, 0.290944517f},
-std::array<float,2>{0.127481326f, 0.680908084f},
-std::array<float,2>{0.424026787f, 0.00690494152f},
-std::array<float,2>{0.59318161f, 0.845050633f},
-std::array<float,2>{0.63531822f, 0.24382107f},
-std::array<float,2>{0.368224412f, 0.948204994f},
-std::array<float,2>{0.0392831154f, 0.498557091f},
-std::array<float,2>{0.834982991f, 0.608996511f},
-std::array<float,2>{0.527214944f, 0.422489882f},
-std::array<float,2>{0.481630415f, 0.511367977f},
-std::array<float,2>{0.222149312f, 0.130433723f},
-std::array<float,2>{0.911605895f, 0.926585138f},
-std::array<float,2>{0.769417703f, 0.0689442083f},
-std::array<float,2>{0.0767179653f, 0.773736835f},
-std::array<float,2>{0.289079577f, 0.333386242f},
-std::array<float,2>{0.731726825f, 0.730900407f},
-std::array<float,2>{0.936886787f, 0.402417839f},
-std::array<float,2>{0.243717059f, 0.535333991f},
-std::array<float,2>{0.490448445f, 0.166899309f},
-std::array<float,2>{0.503650665f, 0.889694333f},
-std::array<float,2>{0.740611434f, 0.115034267f},
-std::array<float,2>{0.303105772f, 0.803150058f},
-std::array<float,2>{0.0856599882f, 0.368379682f},
-std::array<float,2>{0.758316398f, 0.705212951f},
-std::array<float,2>{0.566599667f, 0.255083531f},
-std::array<float,2>{0.411227256f, 0.633685768f},
-std::array<float,2>{0.1557125f, 0.0589262731f},
-std::array<float,2>{0.982804f, 0.815667093f},
-std::array<float,2>{0.819486797f, 0.196747854f},
-std::array<float,2>{0.0484018549f, 0.978317082f},
-std::array<float,2>{0.353708923f, 0.450429648f},
-std::array<float,2>{0.649988711f, 0.574652076f},
-std::array<float,2>{0.783615053f, 0.327462077f},
-std::array<float,2>{0.108126462f, 0.7370556f},
-std::array<float,2>{0.259634137f, 0.0806209967f},
-std::array<float,2>{0.692302644f, 0.761957347f},
-std::array<float,2>{0.542373896f, 0.146759689f},
-std::array<float,2>{0.460660011f, 0.915558398f},
-std::array<float,2>{0.213365853f, 0.414237052f},
-std::array<float,2>{0.898856878f, 0.519504607f},
-std::array<float,2>{0.658131838f, 0.482778966f},
-std::array<float,2>{0.342311889f, 0.622392535f},
-std::array<float,2>{0.0230753068f, 0.233918905f},
-std::array<float,2>{0.868838608f, 0.965132356f},
-std::array<float,2>{0.960539877f, 0.018819984f},
-std::array<float,2>{0.174907908f, 0.866921663f},
-std::array<float,2>{0.406231642f, 0.311948746f},
-std::array<float,2>{0.602994621f, 0.665613294f},
-std::array<float,2>{0.774184287f, 0.479152083f},
-std::array<float,2>{0.0690499544f, 0.619939864f},
-std::array<float,2>{0.283599019f, 0.229783773f},
-std::array<float,2>{0.724070072f, 0.963045418f},
-std::array<float,2>{0.520305812f, 0.0215367265f},
-std::array<float,2>{0.476404548f, 0.862636983f},
-std::array<float,2>{0.231378898f, 0.308243334f},
-std::array<float,2>{0.915866613f, 0.67055589f},
-std::array<float,2>{0.632025361f, 0.322737396f},
-std::array<float,2>{0.367024094f, 0.739431739f},
-std::array<float,2>{0.0378612913f, 0.0826847702f},
-std::array<float,2>{0.840109408f, 0.760210931f},
-std::array<float,2>{0.998827577f, 0.143790424f},
-std::array<float,2>{0.140081465f, 0.919216275f},
-std::array<float,2>{0.435127676f, 0.420379549f},
-std::array<float,2>{0.583133578f, 0.521916687f},
-std::array<float,2>{0.885073185f, 0.250359535f},
-std::array<float,2>{0.192628041f, 0.638117671f},
-std::array<float,2>{0.445046663f, 0.0565149114f},
-std::array<float,2>{0.54876554f, 0.819164336f},
-std::array<float,2>{0.70775491f, 0.202006951f},
-std::array<float,2>{0.273534119f, 0.981473386f},
-std::array<float,2>{0.124370672f, 0.447034061f},
-std::array<float,2>{0.810390711f, 0.571159601f},
-std::array<float,2>{0.614159048f, 0.399160117f},
-std::array<float,2>{0.383616626f, 0.534324944f},
-std::array<float,2>{0.162826329f, 0.169075176f},
-std::array<float,2>{0.943474889f, 0.886397362f},
-std::array<float,2>{0.857539773f, 0.11244452f},
-std::array<float,2>{0.0104289828f, 0.800451517f},
-std::array<float,2>{0.312990993f, 0.373897344f},
-std::array<float,2>{0.675792873f, 0.709052861f},
-std::array<float,2>{0.961593747f, 0.427768558f},
-std::array<float,2>{0.185607836f, 0.515358388f},
-std::array<float,2>{0.395461947f, 0.128529146f},
-std::array<float,2>{0.596563697f, 0.923509657f},
-std::array<float,2>{0.669893682f, 0.0633088648f},
-std::array<float,2>{0.332471073f, 0.780180871f},
-std::array<float,2>{0.0235694405f, 0.329931706f},
-std::array<float,2>{0.859671295f, 0.729375064f},
-std::array<float,2>{0.534902275f, 0.294138789f},
-std::array<float,2>{0.467325926f, 0.684870481f},
-std::array<float,2>{0.2053992f, 0.0024941382f},
-std::array<float,2>{0.895853877f, 0.850988507f},
-std::array<float,2>{0.791277707f, 0.248995066f},
-std::array<float,2>{0.0966385901f, 0.951592207f},
-std::array<float,2>{0.253108948f, 0.493313432f},
-std::array<float,2>{0.702086747f, 0.602608085f},
-std::array<float,2>{0.821024895f, 0.35236606f},
-std::array<float,2>{0.0565863959f, 0.6902408f},
-std::array<float,2>{0.351094335f, 0.106281668f},
-std::array<float,2>{0.648159146f, 0.784452677f},
-std::array<float,2>{0.573727608f, 0.174112797f},
-std::array<float,2>{0.41637814f, 0.905536473f},
-std::array<float,2>{0.148136377f, 0.379784197f},
-std::array<float,2>{0.969385207f, 0.550538719f},
-std::array<float,2>{0.749798775f, 0.464782715f},
-std::array<float,2>{0.310723394f, 0.592368364f},
-std::array<float,2>{0.0879937187f, 0.20421876f},
-std::array<float,2>{0.750819027f, 0.996812522f},
-std::array<float,2>{0.925873041f, 0.0456930473f},
-std::array<float,2>{0.241586626f, 0.834258616f},
-std::array<float,2>{0.494650334f, 0.273067325f},
-std::array<float,2>{0.51066637f, 0.651629448f},
-std::array<float,2>{0.873507798f, 0.384985238f},
-std::array<float,2>{0.0156611279f, 0.556042612f},
-std::array<float,2>{0.33624208f, 0.180496916f},
-std::array<float,2>{0.660407305f, 0.893251598f},
-std::array<float,2>{0.606875062f, 0.0937902331f},
-std::array<float,2>{0.400206774f, 0.790506363f},
-std::array<float,2>{0.17654258f, 0.351250857f},
-std::array<float,2>{0.956632972f, 0.696716785f},
-std::array<float,2>{0.688302517f, 0.278997421f},
-std::array<float,2>{0.265038401f, 0.642962992f},
-std::array<float,2>{0.103794634f, 0.0375725999f},
-std::array<float,2>{0.787720919f, 0.836139679f},
-std::array<float,2>{0.904465556f, 0.213081777f},
-std::array<float,2>{0.216820881f, 0.984417319f},
-std::array<float,2>{0.455911636f, 0.455930889f},
-std::array<float,2>{0.544018626f, 0.583704352f},
-std::array<float,2>{0.978625119f, 0.338410705f},
-std::array<float,2>{0.152125373f, 0.724667609f},
-std::array<float,2>{0.4101322f, 0.0745700598f},
-std::array<float,2>{0.564835966f, 0.769470692f},
-std::array<float,2>{0.65549022f, 0.137617767f},
-std::array<float,2>{0.35659346f, 0.929979503f},
-std::array<float,2>{0.0541549921f, 0.436862558f},
-std::array<float,2>{0.81510359f, 0.501438558f},
-std::array<float,2>{0.50558728f, 0.488753885f},
-std::array<float,2>{0.487093121f, 0.600742877f},
-std::array<float,2>{0.249005735f, 0.234379321f},
-std::array<float,2>{0.930255949f, 0.938553929f},
-std::array<float,2>{0.762988567f, 0.0139806625f},
-std::array<float,2>{0.079896234f, 0.85869801f},
-std::array<float,2>{0.298176289f, 0.282390237f},
-std::array<float,2>{0.738106847f, 0.674671352f},
-std::array<float,2>{0.908403158f, 0.445153087f},
-std::array<float,2>{0.223411486f, 0.564356089f},
-std::array<float,2>{0.478259832f, 0.193317533f},
-std::array<float,2>{0.529170811f, 0.970011294f},
-std::array<float,2>{0.726780832f, 0.0542347319f},
-std::array<float,2>{0.296136796f, 0.821780741f},
-std::array<float,2>{0.0714314878f, 0.265271425f},
-std::array<float,2>{0.772749007f, 0.631387174f},
-std::array<float,2>{0.585947573f, 0.36628598f},
-std::array<float,2>{0.427808702f, 0.715104222f},
-std::array<float,2>{0.132280454f, 0.117310368f},
-std::array<float,2>{0.986060023f, 0.807024002f},
-std::array<float,2>{0.828429103f, 0.157795176f},
-std::array<float,2>{0.044309523f, 0.882743955f},
-std::array<float,2>{0.371117085f, 0.396109045f},
-std::array<float,2>{0.639735818f, 0.542590857f},
-std::array<float,2>{0.803019345f, 0.303702325f},
-std::array<float,2>{0.110591404f, 0.66221267f},
-std::array<float,2>{0.268670052f, 0.0309910588f},
-std::array<float,2>{0.718263388f, 0.869598627f},
-std::array<float,2>{0.556944191f, 0.219249994f},
-std::array<float,2>{0.446711779f, 0.960118651f},
-std::array<float,2>{0.200513422f, 0.473816872f},
-std::array<float,2>{0.880104303f, 0.617136061f},
-std::array<float,2>{0.680644512f, 0.409621656f},
-std::array<float,2>{0.324619025f, 0.525183201f},
-std::array<float,2>{0.00428816164f, 0.155412093f},
-std::array<float,2>{0.847100377f, 0.913194954f},
-std::array<float,2>{0.9455688f, 0.0929541588f},
-std::array<float,2>{0.166587979f, 0.756317675f},
-std::array<float,2>{0.375769764f, 0.319834381f},
-std::array<float,2>{0.619969785f, 0.742196262f},
-std::array<float,2>{0.782512665f, 0.414692014f},
-std::array<float,2>{0.10703449f, 0.519023418f},
-std::array<float,2>{0.260510087f, 0.147078052f},
-std::array<float,2>{0.693850875f, 0.915120006f},
-std::array<float,2>{0.539746404f, 0.0801105499f},
-std::array<float,2>{0.458123893f, 0.762439847f},
-std::array<float,2>{0.212242693f, 0.32782355f},
-std::array<float,2>{0.901713729f, 0.736422122f},
-std::array<float,2>{0.658559382f, 0.312134176f},
-std::array<float,2>{0.340090156f, 0.665249288f},
-std::array<float,2>{0.0203175582f, 0.0191918835f},
-std::array<float,2>{0.870918989f, 0.866492271f},
-std::array<float,2>{0.957971692f, 0.233711287f},
-std::array<float,2>{0.173159301f, 0.965533197f},
-std::array<float,2>{0.40409404f, 0.483190984f},
-std::array<float,2>{0.603907824f, 0.622558892f},
-std::array<float,2>{0.934162199f, 0.368741512f},
-std::array<float,2>{0.245526493f, 0.705728531f},
-std::array<float,2>{0.488512427f, 0.114262097f},
-std::array<float,2>{0.501025021f, 0.803368151f},
-std::array<float,2>{0.740038693f, 0.166422814f},
-std::array<float,2>{0.302708536f, 0.890563667f},
-std::array<float,2>{0.0828777552f, 0.403154969f},
-std::array<float,2>{0.761349857f, 0.536021948f},
-std::array<float,2>{0.569593549f, 0.450871617f},
-std::array<float,2>{0.413495779f, 0.574995756f},
-std::array<float,2>{0.152559564f, 0.19693093f},
-std::array<float,2>{0.981988251f, 0.977578044f},
-std::array<float,2>{0.818199039f, 0.0591581352f},
-std::array<float,2>{0.0505164564f, 0.816105485f},
-std::array<float,2>{0.353186309f, 0.255810916f},
-std::array<float,2>{0.651223898f, 0.633287668f},
-std::array<float,2>{0.989554107f, 0.498333335f},
-std::array<float,2>{0.126242861f, 0.60848403f},
-std::array<float,2>{0.423673391f, 0.243195459f},
-std::array<float,2>{0.591680825f, 0.947548687f},
-std::array<float,2>{0.632920265f, 0.00738758454f},
-std::array<float,2>{0.369246602f, 0.845567107f},
-std::array<float,2>{0.0414961465f, 0.290322721f},
-std::array<float,2>{0.833603084f, 0.681369245f},
-std::array<float,2>{0.524400592f, 0.333759218f},
-std::array<float,2>{0.483335912f, 0.73097086f},
-std::array<float,2>{0.219483808f, 0.0687115118f},
-std::array<float,2>{0.913767874f, 0.773972034f},
-std::array<float,2>{0.766936004f, 0.130354896f},
-std::array<float,2>{0.0758330375f, 0.925875664f},
-std::array<float,2>{0.291999906f, 0.422215134f},
-std::array<float,2>{0.734152377f, 0.511143804f},
-std::array<float,2>{0.848016918f, 0.266077518f},
-std::array<float,2>{0.00311784586f, 0.655036926f},
-std::array<float,2>{0.322072715f, 0.0417650305f},
-std::array<float,2>{0.685121417f, 0.828942418f},
-std::array<float,2>{0.624959409f, 0.207099169f},
-std::array<float,2>{0.380800813f, 0.995199561f},
-std::array<float,2>{0.170927972f, 0.46555534f},
-std::array<float,2>{0.952322245f, 0.587876558f},
-std::array<float,2>{0.7129004f, 0.375866324f},
-std::array<float,2>{0.27132538f, 0.551313043f},
-std::array<float,2>{0.113734923f, 0.176919937f},
-std::array<float,2>{0.800408721f, 0.899892688f},
-std::array<float,2>{0.877201438f, 0.104505382f},
-std::array<float,2>{0.198357418f, 0.787278652f},
-std::array<float,2>{0.451278031f, 0.357064605f},
-std::array<float,2>{0.560996115f, 0.694782317f},
-std::array<float,2>{0.839819849f, 0.459252685f},
-std::array<float,2>{0.032896854f, 0.578220963f},
-std::array<float,2>{0.363137841f, 0.218313128f},
-std::array<float,2>{0.628519893f, 0.992169023f},
-std::array<float,2>{0.581970155f, 0.0327869989f},
-std::array<float,2>{0.431410402f, 0.842371047f},
-std::array<float,2>{0.135939017f, 0.2759296f},
-std::array<float,2>{0.993669629f, 0.645615339f},
-std::array<float,2>{0.720203042f, 0.344917864f},
-std::array<float,2>{0.286739528f, 0.70180279f},
-std::array<float,2>{0.0631633699f, 0.101522714f},
-std::array<float,2>{0.781080663f, 0.79361558f},
-std::array<float,2>{0.920488119f, 0.185409322f},
-std::array<float,2>{0.228507504f, 0.894919455f},
-std::array<float,2>{0.469539732f, 0.388561845f},
-std::array<float,2>{0.51685226f, 0.56045413f},
-std::array<float,2>{0.937681615f, 0.288863599f},
-std::array<float,2>{0.158722013f, 0.676300764f},
-std::array<float,2>{0.388868898f, 0.0098594185f},
-std::array<float,2>{0.610803902f, 0.853451192f},
-std::array<float,2>{0.672002435f, 0.240050644f},
-std::array<float,2>{0.318899602f, 0.941710711f},
-std::array<float,2>{0.014283089f, 0.485323697f},
-std::array<float,2>{0.853825986f, 0.596357167f},
-std::array<float,2>{0.554008186f, 0.430153042f},
-std::array<float,2>{0.438645124f, 0.505381227f},
-std::array<float,2>{0.190554157f, 0.13576211f},
-std::array<float,2>{0.887588084f, 0.936415434f},
-std::array<float,2>{0.805095673f, 0.0729646236f},
-std::array<float,2>{0.117563069f, 0.770234406f},
-std::array<float,2>{0.28101182f, 0.340146452f},
-std::array<float,2>{0.703944325f, 0.720266342f},
-std::array<float,2>{0.891240358f, 0.393379539f},
-std::array<float,2>{0.20766066f, 0.544871032f},
-std::array<float,2>{0.464196831f, 0.162821248f},
-std::array<float,2>{0.537957191f, 0.87845701f},
-std::array<float,2>{0.695322275f, 0.121193349f},
-std::array<float,2>{0.256087452f, 0.809803545f},
-std::array<float,2>{0.09976089f, 0.360806108f},
-std::array<float,2>{0.793322802f, 0.714151919f},
-std::array<float,2>{0.597950816f, 0.261470318f},
-std::array<float,2>{0.392354667f, 0.627230048f},
-std::array<float,2>{0.181877375f, 0.0484045111f},
-std::array<float,2>{0.965420485f, 0.826798797f},
-std::array<float,2>{0.865844667f, 0.189998493f},
-std::array<float,2>{0.0287031941f, 0.973137558f},
-std::array<float,2>{0.331161022f, 0.441370338f},
-std::array<float,2>{0.666868746f, 0.570190966f},
-std::array<float,2>{0.754850924f, 0.313895881f},
-std::array<float,2>{0.091595225f, 0.749373376f},
-std::array<float,2>{0.308333486f, 0.0860235691f},
-std::array<float,2>{0.742417991f, 0.751464605f},
-std::array<float,2>{0.515566349f, 0.151338905f},
-std::array<float,2>{0.497008443f, 0.909761131f},
-std::array<float,2>{0.23506479f, 0.41365692f},
-std::array<float,2>{0.923025846f, 0.529925287f},
-std::array<float,2>{0.643172204f, 0.471634299f},
-std::array<float,2>{0.344999373f, 0.610243082f},
-std::array<float,2>{0.0615217574f, 0.226475909f},
-std::array<float,2>{0.825780094f, 0.956933916f},
-std::array<float,2>{0.973621905f, 0.023789335f},
-std::array<float,2>{0.141293511f, 0.872135818f},
-std::array<float,2>{0.42148903f, 0.297443181f},
-std::array<float,2>{0.577865303f, 0.657858849f},
-std::array<float,2>{0.811783433f, 0.448265642f},
-std::array<float,2>{0.122947f, 0.573736548f},
-std::array<float,2>{0.277307153f, 0.199704304f},
-std::array<float,2>{0.710436046f, 0.982554555f},
-std::array<float,2>{0.550063252f, 0.0585818291f},
-std::array<float,2>{0.441535324f, 0.817457795f},
-std::array<float,2>{0.194726124f, 0.253717631f},
-std::array<float,2>{0.883682966f, 0.639976978f},
-std::array<float,2>{0.679680049f, 0.372925341f},
-std::array<float,2>{0.3154203f, 0.707797825f},
-std::array<float,2>{0.00819774717f, 0.110787816f},
-std::array<float,2>{0.857227921f, 0.797648787f},
-std::array<float,2>{0.942845941f, 0.171626613f},
-std::array<float,2>{0.16195038f, 0.884520471f},
-std::array<float,2>{0.385991395f, 0.401649088f},
-std::array<float,2>{0.615797698f, 0.531583726f},
-std::array<float,2>{0.91647315f, 0.305950224f},
-std::array<float,2>{0.233425334f, 0.668739438f},
-std::array<float,2>{0.472857028f, 0.0208810996f},
-std::array<float,2>{0.52159822f, 0.860957682f},
-std::array<float,2>{0.726149321f, 0.226741165f},
-std::array<float,2>{0.281515449f, 0.962239981f},
-std::array<float,2>{0.0674545243f, 0.477935761f},
-std::array<float,2>{0.775737584f, 0.619077861f},
-std::array<float,2>{0.585074186f, 0.419218123f},
-std::array<float,2>{0.437251776f, 0.520215631f},
-std::array<float,2>{0.137401119f, 0.14159818f},
-std::array<float,2>{0.997548282f, 0.921535552f},
-std::array<float,2>{0.841814756f, 0.0854547992f},
-std::array<float,2>{0.0369647183f, 0.759296596f},
-std::array<float,2>{0.364733487f, 0.321845591f},
-std::array<float,2>{0.630423903f, 0.741309941f},
-std::array<float,2>{0.971382201f, 0.382644296f},
-std::array<float,2>{0.14617534f, 0.546938479f},
-std::array<float,2>{0.415355891f, 0.172666937f},
-std::array<float,2>{0.570977032f, 0.902360976f},
-std::array<float,2>{0.646260262f, 0.107993647f},
-std::array<float,2>{0.348877996f, 0.781541765f},
-std::array<float,2>{0.0567089804f, 0.353677452f},
-std::array<float,2>{0.822619915f, 0.688663065f},
-std::array<float,2>{0.508399725f, 0.271351457f},
-std::array<float,2>{0.493057847f, 0.64994514f},
-std::array<float,2>{0.238918692f, 0.0430660322f},
-std::array<float,2>{0.929507375f, 0.833196878f},
-std::array<float,2>{0.752696455f, 0.206364244f},
-std::array<float,2>{0.0867058933f, 0.998662651f},
-std::array<float,2>{0.309669465f, 0.461561769f},
-std::array<float,2>{0.746427596f, 0.59048903f},
-std::array<float,2>{0.861612737f, 0.330752999f},
-std::array<float,2>{0.0266383588f, 0.728254676f},
-std::array<float,2>{0.334975719f, 0.0650381818f},
-std::array<float,2>{0.670501888f, 0.778842568f},
-std::array<float,2>{0.593989849f, 0.125561371f},
-std::array<float,2>{0.396571338f, 0.925725102f},
-std::array<float,2>{0.185040802f, 0.426895171f},
-std::array<float,2>{0.963347971f, 0.512435913f},
-std::array<float,2>{0.700046837f, 0.494664609f},
-std::array<float,2>{0.251892835f, 0.604105771f},
-std::array<float,2>{0.0950102136f, 0.247949868f},
-std::array<float,2>{0.789384425f, 0.950480103f},
-std::array<float,2>{0.898135722f, 0.000937117438f},
-std::array<float,2>{0.204044789f, 0.848710001f},
-std::array<float,2>{0.46631816f, 0.296349198f},
-std::array<float,2>{0.531274676f, 0.686526358f},
-std::array<float,2>{0.812914968f, 0.434870154f},
-std::array<float,2>{0.0508926958f, 0.503250003f},
-std::array<float,2>{0.35916993f, 0.139733464f},
-std::array<float,2>{0.654152095f, 0.932058096f},
-std::array<float,2>{0.562592626f, 0.0768302679f},
-std::array<float,2>{0.407235175f, 0.766786873f},
-std::array<float,2>{0.150072709f, 0.337696761f},
-std::array<float,2>{0.977403462f, 0.72430706f},
-std::array<float,2>{0.735446274f, 0.283774316f},
-std::array<float,2>{0.299763501f, 0.673569202f},
-std::array<float,2>{0.0819564164f, 0.0132426368f},
-std::array<float,2>{0.764918923f, 0.855611742f},
-std::array<float,2>{0.933048666f, 0.2373171f},
-std::array<float,2>{0.247750089f, 0.941388488f},
-std::array<float,2>{0.484467387f, 0.491020024f},
-std::array<float,2>{0.50771302f, 0.599021256f},
-std::array<float,2>{0.953218818f, 0.348946065f},
-std::array<float,2>{0.179656729f, 0.698306859f},
-std::array<float,2>{0.401135147f, 0.0963959694f},
-std::array<float,2>{0.607812464f, 0.791046679f},
-std::array<float,2>{0.663613737f, 0.183427706f},
-std::array<float,2>{0.339626223f, 0.892029524f},
-std::array<float,2>{0.0193724837f, 0.383325547f},
-std::array<float,2>{0.871983886f, 0.55719161f},
-std::array<float,2>{0.545673788f, 0.454879731f},
-std::array<float,2>{0.454515874f, 0.584394157f},
-std::array<float,2>{0.21564652f, 0.211195722f},
-std::array<float,2>{0.90337944f, 0.987066925f},
-std::array<float,2>{0.785215199f, 0.0357300788f},
-std::array<float,2>{0.103035823f, 0.839630842f},
-std::array<float,2>{0.262800694f, 0.280656099f},
-std::array<float,2>{0.690348983f, 0.642013252f},
-std::array<float,2>{0.880976379f, 0.475191057f},
-std::array<float,2>{0.201225966f, 0.614362061f},
-std::array<float,2>{0.447532117f, 0.221158788f},
-std::array<float,2>{0.556137979f, 0.957789421f},
-std::array<float,2>{0.715017378f, 0.0284251105f},
-std::array<float,2>{0.266991973f, 0.868352711f},
-std::array<float,2>{0.112018354f, 0.302700788f},
-std::array<float,2>{0.801506639f, 0.660267472f},
-std::array<float,2>{0.6180861f, 0.317486525f},
-std::array<float,2>{0.377023816f, 0.744151711f},
-std::array<float,2>{0.164109513f, 0.0912069082f},
-std::array<float,2>{0.947979629f, 0.753932714f},
-std::array<float,2>{0.845447004f, 0.152870908f},
-std::array<float,2>{0.00755826524f, 0.910645962f},
-std::array<float,2>{0.327003807f, 0.406484842f},
-std::array<float,2>{0.683164656f, 0.526206672f},
-std::array<float,2>{0.770084202f, 0.261848688f},
-std::array<float,2>{0.0729676038f, 0.628934205f},
-std::array<float,2>{0.29309696f, 0.0516712889f},
-std::array<float,2>{0.729384303f, 0.822970748f},
-std::array<float,2>{0.530076146f, 0.193760142f},
-std::array<float,2>{0.479159862f, 0.972057462f},
-std::array<float,2>{0.226121679f, 0.442292035f},
-std::array<float,2>{0.907195628f, 0.565253675f},
-std::array<float,2>{0.636758745f, 0.397491008f},
-std::array<float,2>{0.374801368f, 0.540051162f},
-std::array<float,2>{0.0457697921f, 0.158659682f},
-std::array<float,2>{0.831244469f, 0.88040483f},
-std::array<float,2>{0.988240242f, 0.12074443f},
-std::array<float,2>{0.129381269f, 0.8064816f},
-std::array<float,2>{0.427110583f, 0.364561468f},
-std::array<float,2>{0.587970078f, 0.717253804f},
-std::array<float,2>{0.757833421f, 0.405379176f},
-std::array<float,2>{0.0853191465f, 0.537144423f},
-std::array<float,2>{0.303289771f, 0.164665699f},
-std::array<float,2>{0.740863502f, 0.888669193f},
-std::array<float,2>{0.503134489f, 0.116008028f},
-std::array<float,2>{0.491097331f, 0.802072525f},
-std::array<float,2>{0.243479222f, 0.371012986f},
-std::array<float,2>{0.937016428f, 0.704882145f},
-std::array<float,2>{0.649757147f, 0.256870508f},
-std::array<float,2>{0.354223788f, 0.636090875f},
-std::array<float,2>{0.0480361991f, 0.0618314296f},
-std::array<float,2>{0.820143461f, 0.814280987f},
-std::array<float,2>{0.983232439f, 0.198292792f},
-std::array<float,2>{0.156218767f, 0.978745699f},
-std::array<float,2>{0.412022293f, 0.451336235f},
-std::array<float,2>{0.566900313f, 0.577648699f},
-std::array<float,2>{0.89893651f, 0.326052785f},
-std::array<float,2>{0.213781536f, 0.734529376f},
-std::array<float,2>{0.459962904f, 0.0783842802f},
-std::array<float,2>{0.542588651f, 0.764409482f},
-std::array<float,2>{0.691530108f, 0.146397188f},
-std::array<float,2>{0.25909403f, 0.916761875f},
-std::array<float,2>{0.107647374f, 0.416235656f},
-std::array<float,2>{0.783919692f, 0.516358852f},
-std::array<float,2>{0.603114128f, 0.481864482f},
-std::array<float,2>{0.405580342f, 0.623498321f},
-std::array<float,2>{0.175707787f, 0.232020721f},
-std::array<float,2>{0.960146487f, 0.96776855f},
-std::array<float,2>{0.868584931f, 0.0156494062f},
-std::array<float,2>{0.0228745416f, 0.864803851f},
-std::array<float,2>{0.342019469f, 0.309298128f},
-std::array<float,2>{0.657581568f, 0.667059302f},
-std::array<float,2>{0.951072931f, 0.467188656f},
-std::array<float,2>{0.168003917f, 0.588087261f},
-std::array<float,2>{0.382053316f, 0.210317239f},
-std::array<float,2>{0.621368289f, 0.993494153f},
-std::array<float,2>{0.686027288f, 0.0392896868f},
-std::array<float,2>{0.323932737f, 0.830556333f},
-std::array<float,2>{0.000220558068f, 0.269337624f},
-std::array<float,2>{0.849731624f, 0.654051483f},
-std::array<float,2>{0.559780121f, 0.358305246f},
-std::array<float,2>{0.451049984f, 0.691838086f},
-std::array<float,2>{0.196466282f, 0.101724461f},
-std::array<float,2>{0.876068652f, 0.785565495f},
-std::array<float,2>{0.798620939f, 0.178297937f},
-std::array<float,2>{0.116600402f, 0.900865257f},
-std::array<float,2>{0.272591054f, 0.3786062f},
-std::array<float,2>{0.712518096f, 0.55439043f},
-std::array<float,2>{0.835484326f, 0.292266577f},
-std::array<float,2>{0.0399482846f, 0.68286705f},
-std::array<float,2>{0.369122297f, 0.00480019907f},
-std::array<float,2>{0.634958625f, 0.846638262f},
-std::array<float,2>{0.593277037f, 0.244181484f},
-std::array<float,2>{0.424560159f, 0.947088182f},
-std::array<float,2>{0.127171665f, 0.497450888f},
-std::array<float,2>{0.990438998f, 0.606675148f},
-std::array<float,2>{0.732394457f, 0.425431401f},
-std::array<float,2>{0.289557844f, 0.508876622f},
-std::array<float,2>{0.0765471086f, 0.131411731f},
-std::array<float,2>{0.768901944f, 0.929071188f},
-std::array<float,2>{0.911974728f, 0.0671924204f},
-std::array<float,2>{0.222322732f, 0.776280463f},
-std::array<float,2>{0.482241839f, 0.334112674f},
-std::array<float,2>{0.5264557f, 0.733992338f},
-std::array<float,2>{0.851910114f, 0.486962616f},
-std::array<float,2>{0.0127845146f, 0.593855381f},
-std::array<float,2>{0.317620099f, 0.240245029f},
-std::array<float,2>{0.674951971f, 0.943685651f},
-std::array<float,2>{0.612768352f, 0.00950026885f},
-std::array<float,2>{0.387074679f, 0.853624105f},
-std::array<float,2>{0.157890096f, 0.286143154f},
-std::array<float,2>{0.940626264f, 0.678032279f},
-std::array<float,2>{0.706173599f, 0.343555778f},
-std::array<float,2>{0.278433412f, 0.722120106f},
-std::array<float,2>{0.119764604f, 0.0706874207f},
-std::array<float,2>{0.808105707f, 0.771547556f},
-std::array<float,2>{0.888760269f, 0.13436386f},
-std::array<float,2>{0.18808943f, 0.933912754f},
-std::array<float,2>{0.439567715f, 0.432533711f},
-std::array<float,2>{0.551707745f, 0.507008374f},
-std::array<float,2>{0.994431257f, 0.27388531f},
-std::array<float,2>{0.13317281f, 0.647981226f},
-std::array<float,2>{0.432485998f, 0.0344772674f},
-std::array<float,2>{0.580062389f, 0.840744495f},
-std::array<float,2>{0.626134336f, 0.216340527f},
-std::array<float,2>{0.360226333f, 0.988748848f},
-std::array<float,2>{0.033341337f, 0.45704487f},
-std::array<float,2>{0.837841809f, 0.580157161f},
-std::array<float,2>{0.517837107f, 0.389832646f},
-std::array<float,2>{0.471613616f, 0.561133265f},
-std::array<float,2>{0.230039984f, 0.187290013f},
-std::array<float,2>{0.91821444f, 0.898304582f},
-std::array<float,2>{0.778834045f, 0.0990448371f},
-std::array<float,2>{0.0662837327f, 0.796698332f},
-std::array<float,2>{0.287554741f, 0.34661904f},
-std::array<float,2>{0.720738173f, 0.700040698f},
-std::array<float,2>{0.925340772f, 0.410370052f},
-std::array<float,2>{0.236405373f, 0.527711153f},
-std::array<float,2>{0.49806422f, 0.149170294f},
-std::array<float,2>{0.512362778f, 0.907532334f},
-std::array<float,2>{0.744873166f, 0.0896731094f},
-std::array<float,2>{0.306412578f, 0.753763556f},
-std::array<float,2>{0.0927942917f, 0.315923423f},
-std::array<float,2>{0.756159544f, 0.746231556f},
-std::array<float,2>{0.574905694f, 0.299025565f},
-std::array<float,2>{0.418461621f, 0.659176409f},
-std::array<float,2>{0.144290358f, 0.0256224275f},
-std::array<float,2>{0.974731863f, 0.874076843f},
-std::array<float,2>{0.827923357f, 0.22331816f},
-std::array<float,2>{0.0600476377f, 0.954738855f},
-std::array<float,2>{0.347117782f, 0.468776166f},
-std::array<float,2>{0.641155303f, 0.611715078f},
-std::array<float,2>{0.795452058f, 0.362377495f},
-std::array<float,2>{0.0989569128f, 0.711144507f},
-std::array<float,2>{0.254978269f, 0.124296993f},
-std::array<float,2>{0.698266029f, 0.810968757f},
-std::array<float,2>{0.53663522f, 0.160542011f},
-std::array<float,2>{0.461054891f, 0.876295745f},
-std::array<float,2>{0.209767148f, 0.390842408f},
-std::array<float,2>{0.892768443f, 0.54534477f},
-std::array<float,2>{0.665565073f, 0.438506991f},
-std::array<float,2>{0.328863263f, 0.566975832f},
-std::array<float,2>{0.0306336824f, 0.188972324f},
-std::array<float,2>{0.864035487f, 0.975502312f},
-std::array<float,2>{0.966945291f, 0.0503797531f},
-std::array<float,2>{0.180389583f, 0.825442135f},
-std::array<float,2>{0.394176662f, 0.257993013f},
-std::array<float,2>{0.601255298f, 0.625997186f},
-std::array<float,2>{0.751264393f, 0.462179452f},
-std::array<float,2>{0.0893528163f, 0.591275394f},
-std::array<float,2>{0.312040418f, 0.205150485f},
-std::array<float,2>{0.74843806f, 0.999849677f},
-std::array<float,2>{0.510866344f, 0.0443739519f},
-std::array<float,2>{0.495179385f, 0.832679749f},
-std::array<float,2>{0.240732968f, 0.270151764f},
-std::array<float,2>{0.927493751f, 0.648595452f},
-std::array<float,2>{0.647326112f, 0.355323374f},
-std::array<float,2>{0.349722147f, 0.688437223f},
-std::array<float,2>{0.0551157668f, 0.109099828f},
-std::array<float,2>{0.821371377f, 0.782884121f},
-std::array<float,2>{0.970028281f, 0.173745185f},
-std::array<float,2>{0.147273734f, 0.903335512f},
-std::array<float,2>{0.417928874f, 0.381292939f},
-std::array<float,2>{0.572670341f, 0.547870636f},
-std::array<float,2>{0.895451963f, 0.295054883f},
-std::array<float,2>{0.206992209f, 0.68629688f},
-std::array<float,2>{0.468040228f, 0.00167038175f},
-std::array<float,2>{0.533591688f, 0.848331749f},
-std::array<float,2>{0.702172875f, 0.246343359f},
-std::array<float,2>{0.252727479f, 0.950171769f},
-std::array<float,2>{0.0967553779f, 0.496000886f},
-std::array<float,2>{0.792747855f, 0.605449855f},
-std::array<float,2>{0.596781731f, 0.42669639f},
-std::array<float,2>{0.395791173f, 0.513503909f},
-std::array<float,2>{0.186608091f, 0.126360804f},
-std::array<float,2>{0.961929083f, 0.923829257f},
-std::array<float,2>{0.860858321f, 0.0662477314f},
-std::array<float,2>{0.0253250077f, 0.777699113f},
-std::array<float,2>{0.333201647f, 0.331326425f},
-std::array<float,2>{0.668394387f, 0.726787925f},
-std::array<float,2>{0.944534898f, 0.400665641f},
-std::array<float,2>{0.163211077f, 0.532815397f},
-std::array<float,2>{0.384447575f, 0.17035304f},
-std::array<float,2>{0.615173101f, 0.883441806f},
-std::array<float,2>{0.677105248f, 0.10943757f},
-std::array<float,2>{0.314108968f, 0.797955453f},
-std::array<float,2>{0.010965649f, 0.372035533f},
-std::array<float,2>{0.858551681f, 0.708068073f},
-std::array<float,2>{0.547351003f, 0.252321064f},
-std::array<float,2>{0.443463027f, 0.638966024f},
-std::array<float,2>{0.192102462f, 0.0571351722f},
-std::array<float,2>{0.886245191f, 0.816669047f},
-std::array<float,2>{0.809266329f, 0.200296432f},
-std::array<float,2>{0.123895757f, 0.984213889f},
-std::array<float,2>{0.275316566f, 0.447413355f},
-std::array<float,2>{0.708824277f, 0.57226783f},
-std::array<float,2>{0.841572583f, 0.321240515f},
-std::array<float,2>{0.0385078378f, 0.740671575f},
-std::array<float,2>{0.365369707f, 0.0842079297f},
-std::array<float,2>{0.631420851f, 0.7581442f},
-std::array<float,2>{0.582563639f, 0.141628444f},
-std::array<float,2>{0.434214562f, 0.920013011f},
-std::array<float,2>{0.139413312f, 0.41818583f},
-std::array<float,2>{0.999569535f, 0.520977497f},
-std::array<float,2>{0.723264039f, 0.476767063f},
-std::array<float,2>{0.284260333f, 0.617707133f},
-std::array<float,2>{0.0701818839f, 0.227794498f},
-std::array<float,2>{0.774666965f, 0.961874902f},
-std::array<float,2>{0.914713144f, 0.0198740289f},
-std::array<float,2>{0.232415199f, 0.860227764f},
-std::array<float,2>{0.475090653f, 0.304993331f},
-std::array<float,2>{0.520756364f, 0.669800997f},
-std::array<float,2>{0.845704377f, 0.407554984f},
-std::array<float,2>{0.00509006623f, 0.527174473f},
-std::array<float,2>{0.325956315f, 0.154244721f},
-std::array<float,2>{0.680978417f, 0.911678731f},
-std::array<float,2>{0.620469034f, 0.0900316089f},
-std::array<float,2>{0.376814902f, 0.755153716f},
-std::array<float,2>{0.167546809f, 0.31690231f},
-std::array<float,2>{0.946785748f, 0.745607972f},
-std::array<float,2>{0.716798365f, 0.301682264f},
-std::array<float,2>{0.268065602f, 0.661514819f},
-std::array<float,2>{0.110140085f, 0.0273601245f},
-std::array<float,2>{0.804119349f, 0.867461681f},
-std::array<float,2>{0.879652262f, 0.22241129f},
-std::array<float,2>{0.200077698f, 0.958071351f},
-std::array<float,2>{0.445985049f, 0.475762963f},
-std::array<float,2>{0.558341503f, 0.614119887f},
-std::array<float,2>{0.985342681f, 0.363782585f},
-std::array<float,2>{0.131156355f, 0.718161047f},
-std::array<float,2>{0.429370731f, 0.119369715f},
-std::array<float,2>{0.587374747f, 0.80551511f},
-std::array<float,2>{0.639274061f, 0.159924939f},
-std::array<float,2>{0.372442394f, 0.879412532f},
-std::array<float,2>{0.0438224301f, 0.396862984f},
-std::array<float,2>{0.829907715f, 0.539454818f},
-std::array<float,2>{0.527769804f, 0.443039685f},
-std::array<float,2>{0.477348268f, 0.566029191f},
-std::array<float,2>{0.224590898f, 0.195039451f},
-std::array<float,2>{0.909735084f, 0.971062899f},
-std::array<float,2>{0.772290289f, 0.0522954389f},
-std::array<float,2>{0.0703725815f, 0.824107111f},
-std::array<float,2>{0.295801848f, 0.263007969f},
-std::array<float,2>{0.728306413f, 0.630435944f},
-std::array<float,2>{0.931039989f, 0.491454214f},
-std::array<float,2>{0.249139085f, 0.598630965f},
-std::array<float,2>{0.488184392f, 0.237176105f},
-std::array<float,2>{0.503932834f, 0.940193892f},
-std::array<float,2>{0.73678273f, 0.012638025f},
-std::array<float,2>{0.296965778f, 0.85723114f},
-std::array<float,2>{0.0787326619f, 0.284654051f},
-std::array<float,2>{0.762166262f, 0.672381878f},
-std::array<float,2>{0.565825403f, 0.335951835f},
-std::array<float,2>{0.408489019f, 0.723286808f},
-std::array<float,2>{0.150853127f, 0.0779530853f},
-std::array<float,2>{0.980172396f, 0.766569018f},
-std::array<float,2>{0.815615714f, 0.138873935f},
-std::array<float,2>{0.0535047017f, 0.933303654f},
-std::array<float,2>{0.35636279f, 0.434045553f},
-std::array<float,2>{0.655167818f, 0.501953483f},
-std::array<float,2>{0.788679898f, 0.279782355f},
-std::array<float,2>{0.105390407f, 0.641159713f},
-std::array<float,2>{0.264475405f, 0.0363185853f},
-std::array<float,2>{0.689335585f, 0.838249326f},
-std::array<float,2>{0.543247283f, 0.212852582f},
-std::array<float,2>{0.456746072f, 0.987527966f},
-std::array<float,2>{0.217935428f, 0.453554124f},
-std::array<float,2>{0.905424356f, 0.58580929f},
-std::array<float,2>{0.662090003f, 0.384208262f},
-std::array<float,2>{0.337179959f, 0.557856679f},
-std::array<float,2>{0.0168491937f, 0.181694627f},
-std::array<float,2>{0.874692678f, 0.891212642f},
-std::array<float,2>{0.955706954f, 0.0969257131f},
-std::array<float,2>{0.177514806f, 0.792058825f},
-std::array<float,2>{0.398454338f, 0.348154843f},
-std::array<float,2>{0.606258631f, 0.697835445f},
-std::array<float,2>{0.799789548f, 0.377425343f},
-std::array<float,2>{0.115056336f, 0.55359453f},
-std::array<float,2>{0.270065069f, 0.179448172f},
-std::array<float,2>{0.713924766f, 0.902105987f},
-std::array<float,2>{0.562308967f, 0.103300579f},
-std::array<float,2>{0.452265382f, 0.786154926f},
-std::array<float,2>{0.197313026f, 0.358965248f},
-std::array<float,2>{0.878766954f, 0.692744374f},
-std::array<float,2>{0.683886886f, 0.26813823f},
-std::array<float,2>{0.320892811f, 0.65255034f},
-std::array<float,2>{0.00233845599f, 0.0400805101f},
-std::array<float,2>{0.849495411f, 0.831383467f},
-std::array<float,2>{0.951358736f, 0.209333077f},
-std::array<float,2>{0.170739532f, 0.992385805f},
-std::array<float,2>{0.379666179f, 0.467934132f},
-std::array<float,2>{0.623566151f, 0.589303315f},
-std::array<float,2>{0.912260652f, 0.335279137f},
-std::array<float,2>{0.22018531f, 0.73259145f},
-std::array<float,2>{0.483605891f, 0.0676123723f},
-std::array<float,2>{0.525197625f, 0.776385248f},
-std::array<float,2>{0.733219862f, 0.132675201f},
-std::array<float,2>{0.291742742f, 0.928169847f},
-std::array<float,2>{0.0749700367f, 0.423992276f},
-std::array<float,2>{0.766422927f, 0.508333445f},
-std::array<float,2>{0.590788901f, 0.496917188f},
-std::array<float,2>{0.422567189f, 0.605623424f},
-std::array<float,2>{0.12532486f, 0.246031597f},
-std::array<float,2>{0.988457143f, 0.94536674f},
-std::array<float,2>{0.832239687f, 0.00554943457f},
-std::array<float,2>{0.0420526192f, 0.847401917f},
-std::array<float,2>{0.370657653f, 0.291109145f},
-std::array<float,2>{0.63434428f, 0.682191193f},
-std::array<float,2>{0.981131256f, 0.452708691f},
-std::array<float,2>{0.153539836f, 0.576336622f},
-std::array<float,2>{0.413042486f, 0.198069617f},
-std::array<float,2>{0.568832278f, 0.979983449f},
-std::array<float,2>{0.651501477f, 0.0610601045f},
-std::array<float,2>{0.35236752f, 0.813348711f},
-std::array<float,2>{0.0492971241f, 0.256364703f},
-std::array<float,2>{0.816467166f, 0.634915829f},
-std::array<float,2>{0.500325859f, 0.369614065f},
-std::array<float,2>{0.489781231f, 0.703484535f},
-std::array<float,2>{0.244349435f, 0.11700955f},
-std::array<float,2>{0.934593081f, 0.801733077f},
-std::array<float,2>{0.75992471f, 0.165825665f},
-std::array<float,2>{0.0834320411f, 0.887410164f},
-std::array<float,2>{0.301457554f, 0.404383302f},
-std::array<float,2>{0.738630414f, 0.538736999f},
-std::array<float,2>{0.869354188f, 0.309883654f},
-std::array<float,2>{0.0205559023f, 0.666410267f},
-std::array<float,2>{0.341232985f, 0.0169137716f},
-std::array<float,2>{0.660018384f, 0.864141464f},
-std::array<float,2>{0.605446935f, 0.230994701f},
-std::array<float,2>{0.402461946f, 0.968370914f},
-std::array<float,2>{0.172682375f, 0.481403917f},
-std::array<float,2>{0.958454907f, 0.624516249f},
-std::array<float,2>{0.694696784f, 0.417274833f},
-std::array<float,2>{0.261209607f, 0.516613722f},
-std::array<float,2>{0.106107429f, 0.144790724f},
-std::array<float,2>{0.781381071f, 0.917074084f},
-std::array<float,2>{0.901022911f, 0.0791540742f},
-std::array<float,2>{0.211708322f, 0.764913857f},
-std::array<float,2>{0.457997888f, 0.324440658f},
-std::array<float,2>{0.540572405f, 0.735983968f},
-std::array<float,2>{0.825182021f, 0.469769239f},
-std::array<float,2>{0.0615624413f, 0.613224864f},
-std::array<float,2>{0.344634771f, 0.224065721f},
-std::array<float,2>{0.643702507f, 0.953147233f},
-std::array<float,2>{0.576730847f, 0.0267143827f},
-std::array<float,2>{0.419922888f, 0.873351753f},
-std::array<float,2>{0.142360121f, 0.300190866f},
-std::array<float,2>{0.97374481f, 0.659667552f},
-std::array<float,2>{0.743613422f, 0.315165281f},
-std::array<float,2>{0.306669354f, 0.747222602f},
-std::array<float,2>{0.0905856639f, 0.0882743075f},
-std::array<float,2>{0.755489826f, 0.752298295f},
-std::array<float,2>{0.922392726f, 0.150079206f},
-std::array<float,2>{0.23631528f, 0.907098472f},
-std::array<float,2>{0.497690707f, 0.412006885f},
-std::array<float,2>{0.514313519f, 0.52843076f},
-std::array<float,2>{0.965831876f, 0.258888274f},
-std::array<float,2>{0.183220267f, 0.62516284f},
-std::array<float,2>{0.390663028f, 0.0491175316f},
-std::array<float,2>{0.599583745f, 0.824987352f},
-std::array<float,2>{0.667512119f, 0.187574282f},
-std::array<float,2>{0.330675691f, 0.975793064f},
-std::array<float,2>{0.0282010026f, 0.438452154f},
-std::array<float,2>{0.867173672f, 0.568330228f},
-std::array<float,2>{0.538820088f, 0.391969889f},
-std::array<float,2>{0.463667899f, 0.546753705f},
-std::array<float,2>{0.20855391f, 0.161712274f},
-std::array<float,2>{0.891941667f, 0.875142455f},
-std::array<float,2>{0.793979406f, 0.123930678f},
-std::array<float,2>{0.101499222f, 0.812381029f},
-std::array<float,2>{0.257020742f, 0.361952662f},
-std::array<float,2>{0.696621537f, 0.712581873f},
-std::array<float,2>{0.888322115f, 0.433266759f},
-std::array<float,2>{0.189824313f, 0.506475687f},
-std::array<float,2>{0.437629163f, 0.133279175f},
-std::array<float,2>{0.553272843f, 0.935153782f},
-std::array<float,2>{0.704443574f, 0.0714288875f},
-std::array<float,2>{0.279789656f, 0.773427665f},
-std::array<float,2>{0.118864611f, 0.341998696f},
-std::array<float,2>{0.805718362f, 0.721421301f},
-std::array<float,2>{0.60951066f, 0.285708487f},
-std::array<float,2>{0.389995813f, 0.679501951f},
-std::array<float,2>{0.159298226f, 0.00789251737f},
-std::array<float,2>{0.938848376f, 0.855075717f},
-std::array<float,2>{0.854633451f, 0.241574332f},
-std::array<float,2>{0.0150644723f, 0.944504201f},
-std::array<float,2>{0.320071608f, 0.487799615f},
-std::array<float,2>{0.673692286f, 0.595562756f},
-std::array<float,2>{0.779589534f, 0.347231537f},
-std::array<float,2>{0.0643991381f, 0.700428128f},
-std::array<float,2>{0.285815835f, 0.0977075323f},
-std::array<float,2>{0.719366968f, 0.794972539f},
-std::array<float,2>{0.516443908f, 0.185625747f},
-std::array<float,2>{0.470207006f, 0.897371829f},
-std::array<float,2>{0.226677924f, 0.389637113f},
-std::array<float,2>{0.921847105f, 0.562059641f},
-std::array<float,2>{0.626972854f, 0.458578527f},
-std::array<float,2>{0.361331999f, 0.58200264f},
-std::array<float,2>{0.0320192687f, 0.215579107f},
-std::array<float,2>{0.83838743f, 0.989587963f},
-std::array<float,2>{0.993030787f, 0.0332235508f},
-std::array<float,2>{0.134974748f, 0.841322541f},
-std::array<float,2>{0.430451721f, 0.274940014f},
-std::array<float,2>{0.580476284f, 0.647019982f},
-std::array<float,2>{0.790407419f, 0.492462665f},
-std::array<float,2>{0.0940653756f, 0.602022171f},
-std::array<float,2>{0.250822872f, 0.249709427f},
-std::array<float,2>{0.700622082f, 0.952169299f},
-std::array<float,2>{0.532280624f, 0.00377573562f},
-std::array<float,2>{0.465119123f, 0.85039711f},
-std::array<float,2>{0.204273447f, 0.29393819f},
-std::array<float,2>{0.896633267f, 0.684460938f},
-std::array<float,2>{0.671650529f, 0.328264952f},
-std::array<float,2>{0.334091246f, 0.730116963f},
-std::array<float,2>{0.025888551f, 0.0642901659f},
-std::array<float,2>{0.862417936f, 0.781063557f},
-std::array<float,2>{0.964233875f, 0.127371714f},
-std::array<float,2>{0.184508383f, 0.922400892f},
-std::array<float,2>{0.397871464f, 0.429369032f},
-std::array<float,2>{0.595193148f, 0.513877988f},
-std::array<float,2>{0.927973211f, 0.272294998f},
-std::array<float,2>{0.240216151f, 0.651140153f},
-std::array<float,2>{0.49372232f, 0.046266418f},
-std::array<float,2>{0.50950247f, 0.835926056f},
-std::array<float,2>{0.747808099f, 0.203469008f},
-std::array<float,2>{0.308982462f, 0.997085094f},
-std::array<float,2>{0.0877890363f, 0.463751405f},
-std::array<float,2>{0.753232777f, 0.592870355f},
-std::array<float,2>{0.571340263f, 0.380086422f},
-std::array<float,2>{0.414407164f, 0.549067676f},
-std::array<float,2>{0.145268515f, 0.175065786f},
-std::array<float,2>{0.972069263f, 0.904368639f},
-std::array<float,2>{0.823497057f, 0.107169271f},
-std::array<float,2>{0.0585390478f, 0.784158289f},
-std::array<float,2>{0.348576754f, 0.35282895f},
-std::array<float,2>{0.644618571f, 0.690819442f},
-std::array<float,2>{0.99665916f, 0.421715319f},
-std::array<float,2>{0.138276696f, 0.522848308f},
-std::array<float,2>{0.436436176f, 0.142638534f},
-std::array<float,2>{0.584080935f, 0.918892264f},
-std::array<float,2>{0.62929976f, 0.0835407525f},
-std::array<float,2>{0.363646299f, 0.761321187f},
-std::array<float,2>{0.0354393423f, 0.324028105f},
-std::array<float,2>{0.843532503f, 0.738326788f},
-std::array<float,2>{0.522597611f, 0.307190359f},
-std::array<float,2>{0.473787189f, 0.671542466f},
-std::array<float,2>{0.232870981f, 0.022734249f},
-std::array<float,2>{0.91727674f, 0.86159265f},
-std::array<float,2>{0.776687324f, 0.228747979f},
-std::array<float,2>{0.0664471835f, 0.964516938f},
-std::array<float,2>{0.28228265f, 0.480267018f},
-std::array<float,2>{0.724738896f, 0.620269656f},
-std::array<float,2>{0.855853915f, 0.374563873f},
-std::array<float,2>{0.00970310811f, 0.710725427f},
-std::array<float,2>{0.31639725f, 0.112094007f},
-std::array<float,2>{0.678149104f, 0.799259901f},
-std::array<float,2>{0.616447747f, 0.16845268f},
-std::array<float,2>{0.385161191f, 0.885071874f},
-std::array<float,2>{0.161132559f, 0.400350749f},
-std::array<float,2>{0.941699266f, 0.533939898f},
-std::array<float,2>{0.709747672f, 0.445667535f},
-std::array<float,2>{0.276055962f, 0.571882606f},
-std::array<float,2>{0.121419586f, 0.202391773f},
-std::array<float,2>{0.810577154f, 0.981109679f},
-std::array<float,2>{0.884229541f, 0.0551386103f},
-std::array<float,2>{0.193704098f, 0.819761038f},
-std::array<float,2>{0.442468852f, 0.251920909f},
-std::array<float,2>{0.549417078f, 0.63677603f},
-std::array<float,2>{0.830848873f, 0.394908667f},
-std::array<float,2>{0.0468689315f, 0.541767836f},
-std::array<float,2>{0.373224169f, 0.156570658f},
-std::array<float,2>{0.63799113f, 0.881699562f},
-std::array<float,2>{0.58967793f, 0.118302166f},
-std::array<float,2>{0.425831228f, 0.808032334f},
-std::array<float,2>{0.130716071f, 0.365407288f},
-std::array<float,2>{0.986929476f, 0.715952277f},
-std::array<float,2>{0.730205953f, 0.264514297f},
-std::array<float,2>{0.294631302f, 0.632090092f},
-std::array<float,2>{0.0737826228f, 0.0529786423f},
-std::array<float,2>{0.770695031f, 0.820751071f},
-std::array<float,2>{0.907540441f, 0.191567093f},
-std::array<float,2>{0.224879056f, 0.969262898f},
-std::array<float,2>{0.479714215f, 0.443818122f},
-std::array<float,2>{0.530335665f, 0.563083172f},
-std::array<float,2>{0.94890523f, 0.318849295f},
-std::array<float,2>{0.165688455f, 0.743445456f},
-std::array<float,2>{0.378213078f, 0.0921672359f},
-std::array<float,2>{0.618177652f, 0.75757283f},
-std::array<float,2>{0.682080746f, 0.154338211f},
-std::array<float,2>{0.327908635f, 0.912858903f},
-std::array<float,2>{0.00610176474f, 0.408597291f},
-std::array<float,2>{0.844630301f, 0.524182916f},
-std::array<float,2>{0.555089414f, 0.472716391f},
-std::array<float,2>{0.448729932f, 0.615362406f},
-std::array<float,2>{0.202931747f, 0.220591873f},
-std::array<float,2>{0.881891847f, 0.959158957f},
-std::array<float,2>{0.802464783f, 0.030086536f},
-std::array<float,2>{0.113064058f, 0.870568693f},
-std::array<float,2>{0.266200483f, 0.304568291f},
-std::array<float,2>{0.716198266f, 0.663494945f},
-std::array<float,2>{0.902394295f, 0.456151605f},
-std::array<float,2>{0.215841785f, 0.582793236f},
-std::array<float,2>{0.454024911f, 0.214522794f},
-std::array<float,2>{0.546046436f, 0.98627311f},
-std::array<float,2>{0.690518856f, 0.0382334068f},
-std::array<float,2>{0.261862844f, 0.83773458f},
-std::array<float,2>{0.102448769f, 0.277555287f},
-std::array<float,2>{0.786722362f, 0.643725336f},
-std::array<float,2>{0.608870089f, 0.350138336f},
-std::array<float,2>{0.402317435f, 0.695807934f},
-std::array<float,2>{0.178219795f, 0.0955086201f},
-std::array<float,2>{0.954182386f, 0.789909124f},
-std::array<float,2>{0.872385442f, 0.181551233f},
-std::array<float,2>{0.0177797247f, 0.894344032f},
-std::array<float,2>{0.337994784f, 0.386202782f},
-std::array<float,2>{0.662935317f, 0.554744363f},
-std::array<float,2>{0.764172375f, 0.281471014f},
-std::array<float,2>{0.0807433799f, 0.675191522f},
-std::array<float,2>{0.30042854f, 0.0154390791f},
-std::array<float,2>{0.734381258f, 0.85775131f},
-std::array<float,2>{0.50596112f, 0.235597432f},
-std::array<float,2>{0.485966206f, 0.937509179f},
-std::array<float,2>{0.246689841f, 0.489286721f},
-std::array<float,2>{0.931973279f, 0.600071609f},
-std::array<float,2>{0.653199077f, 0.436240762f},
-std::array<float,2>{0.358347148f, 0.500417054f},
-std::array<float,2>{0.0519866534f, 0.137841001f},
-std::array<float,2>{0.813817978f, 0.931214452f},
-std::array<float,2>{0.978111565f, 0.0759652033f},
-std::array<float,2>{0.148829684f, 0.768433988f},
-std::array<float,2>{0.406982094f, 0.339031816f},
-std::array<float,2>{0.564266562f, 0.725851119f},
-std::array<float,2>{0.767817199f, 0.423276335f},
-std::array<float,2>{0.0772117004f, 0.510550439f},
-std::array<float,2>{0.290428519f, 0.129145443f},
-std::array<float,2>{0.73070842f, 0.927376211f},
-std::array<float,2>{0.525714397f, 0.069497928f},
-std::array<float,2>{0.480603844f, 0.774824798f},
-std::array<float,2>{0.221225902f, 0.3329373f},
-std::array<float,2>{0.910380006f, 0.731996477f},
-std::array<float,2>{0.635947824f, 0.28981328f},
-std::array<float,2>{0.36753571f, 0.679784894f},
-std::array<float,2>{0.0409492366f, 0.0060135196f},
-std::array<float,2>{0.834636688f, 0.844315529f},
-std::array<float,2>{0.992169261f, 0.242299527f},
-std::array<float,2>{0.128539711f, 0.948965192f},
-std::array<float,2>{0.42490837f, 0.499533504f},
-std::array<float,2>{0.592376888f, 0.608062506f},
-std::array<float,2>{0.875140965f, 0.355640084f},
-std::array<float,2>{0.196062401f, 0.693863034f},
-std::array<float,2>{0.449516952f, 0.103534676f},
-std::array<float,2>{0.559343517f, 0.788460553f},
-std::array<float,2>{0.711494386f, 0.176403403f},
-std::array<float,2>{0.271773785f, 0.898484647f},
-std::array<float,2>{0.115660876f, 0.376557201f},
-std::array<float,2>{0.797154665f, 0.552599907f},
-std::array<float,2>{0.622180104f, 0.466599673f},
-std::array<float,2>{0.381682038f, 0.586449027f},
-std::array<float,2>{0.169322237f, 0.208847642f},
-std::array<float,2>{0.950065076f, 0.99438405f},
-std::array<float,2>{0.851061225f, 0.0422138348f},
-std::array<float,2>{0.00104739773f, 0.830002189f},
-std::array<float,2>{0.322412133f, 0.266929001f},
-std::array<float,2>{0.686993599f, 0.655508816f},
-std::array<float,2>{0.959379852f, 0.483997256f},
-std::array<float,2>{0.17384997f, 0.621942341f},
-std::array<float,2>{0.404595971f, 0.232878938f},
-std::array<float,2>{0.602190733f, 0.966348171f},
-std::array<float,2>{0.656907141f, 0.0184035059f},
-std::array<float,2>{0.343069613f, 0.865879595f},
-std::array<float,2>{0.0222693067f, 0.311019093f},
-std::array<float,2>{0.868079007f, 0.664651394f},
-std::array<float,2>{0.54129082f, 0.327030957f},
-std::array<float,2>{0.45951429f, 0.737513721f},
-std::array<float,2>{0.214769408f, 0.0818163604f},
-std::array<float,2>{0.899784505f, 0.76329875f},
-std::array<float,2>{0.784961283f, 0.147900641f},
-std::array<float,2>{0.108815178f, 0.91466862f},
-std::array<float,2>{0.258185178f, 0.415572733f},
-std::array<float,2>{0.692414641f, 0.518212557f},
-std::array<float,2>{0.818758965f, 0.254322022f},
-std::array<float,2>{0.0478372946f, 0.634099066f},
-std::array<float,2>{0.355342656f, 0.0597461537f},
-std::array<float,2>{0.649072528f, 0.815398991f},
-std::array<float,2>{0.568142772f, 0.195965856f},
-std::array<float,2>{0.410859406f, 0.976983309f},
-std::array<float,2>{0.154754296f, 0.449737161f},
-std::array<float,2>{0.984218776f, 0.575407743f},
-std::array<float,2>{0.741469145f, 0.404240847f},
-std::array<float,2>{0.304600894f, 0.537050843f},
-std::array<float,2>{0.0845423788f, 0.167113513f},
-std::array<float,2>{0.759320438f, 0.889621854f},
-std::array<float,2>{0.935847878f, 0.114027202f},
-std::array<float,2>{0.242399022f, 0.804229379f},
-std::array<float,2>{0.4914065f, 0.368023574f},
-std::array<float,2>{0.502015531f, 0.706223607f},
-std::array<float,2>{0.86513114f, 0.439632773f},
-std::array<float,2>{0.0295440257f, 0.568956196f},
-std::array<float,2>{0.329215616f, 0.191107109f},
-std::array<float,2>{0.664574921f, 0.974145651f},
-std::array<float,2>{0.599759221f, 0.0471095331f},
-std::array<float,2>{0.39318344f, 0.827350557f},
-std::array<float,2>{0.181487754f, 0.260375053f},
-std::array<float,2>{0.968206763f, 0.628267884f},
-std::array<float,2>{0.698190868f, 0.359837025f},
-std::array<float,2>{0.254284978f, 0.712943375f},
-std::array<float,2>{0.0979799777f, 0.123007379f},
-std::array<float,2>{0.796818316f, 0.809312105f},
-std::array<float,2>{0.893719733f, 0.163568735f},
-std::array<float,2>{0.210852996f, 0.877086282f},
-std::array<float,2>{0.462017328f, 0.394157916f},
-std::array<float,2>{0.535913825f, 0.543903887f},
-std::array<float,2>{0.976019323f, 0.2983118f},
-std::array<float,2>{0.14331691f, 0.656785429f},
-std::array<float,2>{0.419782072f, 0.0245047007f},
-std::array<float,2>{0.575398922f, 0.871670187f},
-std::array<float,2>{0.642386019f, 0.225030765f},
-std::array<float,2>{0.346489906f, 0.95589751f},
-std::array<float,2>{0.0593139417f, 0.472175956f},
-std::array<float,2>{0.826877594f, 0.611074448f},
-std::array<float,2>{0.513460279f, 0.412368447f},
-std::array<float,2>{0.499173403f, 0.530446649f},
-std::array<float,2>{0.237452671f, 0.151958585f},
-std::array<float,2>{0.923890293f, 0.908327401f},
-std::array<float,2>{0.757742941f, 0.0871041492f},
-std::array<float,2>{0.0919374749f, 0.750720441f},
-std::array<float,2>{0.304800034f, 0.313366801f},
-std::array<float,2>{0.745676577f, 0.748633802f},
-std::array<float,2>{0.919474185f, 0.38762033f},
-std::array<float,2>{0.229182065f, 0.558667779f},
-std::array<float,2>{0.47236079f, 0.183706403f},
-std::array<float,2>{0.519251645f, 0.895913601f},
-std::array<float,2>{0.722228587f, 0.100289129f},
-std::array<float,2>{0.288997114f, 0.794404328f},
-std::array<float,2>{0.064803496f, 0.344355911f},
-std::array<float,2>{0.778243721f, 0.702960134f},
-std::array<float,2>{0.578896344f, 0.27725789f},
-std::array<float,2>{0.432630628f, 0.645412087f},
-std::array<float,2>{0.133971035f, 0.0316442028f},
-std::array<float,2>{0.995638967f, 0.843078196f},
-std::array<float,2>{0.836189747f, 0.217769995f},
-std::array<float,2>{0.0342492424f, 0.990785897f},
-std::array<float,2>{0.360376775f, 0.460254818f},
-std::array<float,2>{0.625754714f, 0.579446971f},
-std::array<float,2>{0.807344019f, 0.341056794f},
-std::array<float,2>{0.120655254f, 0.718874633f},
-std::array<float,2>{0.277667433f, 0.0737760216f},
-std::array<float,2>{0.705319762f, 0.770955026f},
-std::array<float,2>{0.552679181f, 0.135414436f},
-std::array<float,2>{0.440847844f, 0.936774433f},
-std::array<float,2>{0.189197853f, 0.431558847f},
-std::array<float,2>{0.889762402f, 0.504103422f},
-std::array<float,2>{0.674153805f, 0.486178607f},
-std::array<float,2>{0.316790462f, 0.596711695f},
-std::array<float,2>{0.0117340172f, 0.238318488f},
-std::array<float,2>{0.852965117f, 0.943136454f},
-std::array<float,2>{0.93948096f, 0.0113144219f},
-std::array<float,2>{0.156759426f, 0.851991713f},
-std::array<float,2>{0.388312757f, 0.287543535f},
-std::array<float,2>{0.611403108f, 0.67688179f}}
\ No newline at end of file
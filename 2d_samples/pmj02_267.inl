@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.608154595f, 0.124347724f},
-std::array<float,2>{0.232919216f, 0.597723663f},
-std::array<float,2>{0.76285547f, 0.773480833f},
-std::array<float,2>{0.457510382f, 0.427353323f},
-std::array<float,2>{0.9222278f, 0.373778999f},
-std::array<float,2>{0.328494459f, 0.917950153f},
-std::array<float,2>{0.680987954f, 0.71000886f},
-std::array<float,2>{0.118625261f, 0.235183641f},
-std::array<float,2>{0.744487166f, 0.474564493f},
-std::array<float,2>{0.0611108616f, 0.83672297f},
-std::array<float,2>{0.989504337f, 0.50595516f},
-std::array<float,2>{0.261435956f, 0.00169514155f},
-std::array<float,2>{0.85292697f, 0.162699297f},
-std::array<float,2>{0.408798307f, 0.63830477f},
-std::array<float,2>{0.529670835f, 0.995659828f},
-std::array<float,2>{0.1661129f, 0.254347116f},
-std::array<float,2>{0.639684081f, 0.210031256f},
-std::array<float,2>{0.0801371038f, 0.742873132f},
-std::array<float,2>{0.876491249f, 0.876607299f},
-std::array<float,2>{0.363490909f, 0.328598917f},
-std::array<float,2>{0.78483212f, 0.389027268f},
-std::array<float,2>{0.478153408f, 0.788861394f},
-std::array<float,2>{0.575795949f, 0.572052717f},
-std::array<float,2>{0.214409307f, 0.0761720687f},
-std::array<float,2>{0.549527049f, 0.299982578f},
-std::array<float,2>{0.145717248f, 0.950153291f},
-std::array<float,2>{0.818528652f, 0.685213149f},
-std::array<float,2>{0.398221344f, 0.140488133f},
-std::array<float,2>{0.954194844f, 0.0412392095f},
-std::array<float,2>{0.28838551f, 0.542604864f},
-std::array<float,2>{0.690658092f, 0.847557068f},
-std::array<float,2>{0.00426436774f, 0.447048813f},
-std::array<float,2>{0.71023494f, 0.0259094685f},
-std::array<float,2>{0.0215920247f, 0.520453513f},
-std::array<float,2>{0.948675334f, 0.827605069f},
-std::array<float,2>{0.303749681f, 0.49592033f},
-std::array<float,2>{0.832656026f, 0.269649923f},
-std::array<float,2>{0.388970673f, 0.979678869f},
-std::array<float,2>{0.536337972f, 0.648578942f},
-std::array<float,2>{0.125744164f, 0.184950069f},
-std::array<float,2>{0.578533471f, 0.420386583f},
-std::array<float,2>{0.199165523f, 0.757561088f},
-std::array<float,2>{0.802191973f, 0.622136772f},
-std::array<float,2>{0.495081246f, 0.107806928f},
-std::array<float,2>{0.892793536f, 0.233007893f},
-std::array<float,2>{0.348907232f, 0.692347407f},
-std::array<float,2>{0.651115894f, 0.92509675f},
-std::array<float,2>{0.0756884888f, 0.347106695f},
-std::array<float,2>{0.514576852f, 0.146173254f},
-std::array<float,2>{0.184345081f, 0.670718491f},
-std::array<float,2>{0.872188032f, 0.966181695f},
-std::array<float,2>{0.430283368f, 0.285968035f},
-std::array<float,2>{0.973363817f, 0.46161449f},
-std::array<float,2>{0.265899539f, 0.861055255f},
-std::array<float,2>{0.720834494f, 0.547847033f},
-std::array<float,2>{0.0314362757f, 0.0525969602f},
-std::array<float,2>{0.667806804f, 0.313392431f},
-std::array<float,2>{0.106143065f, 0.903995097f},
-std::array<float,2>{0.911403656f, 0.725240827f},
-std::array<float,2>{0.327687442f, 0.200834036f},
-std::array<float,2>{0.77557826f, 0.0852273852f},
-std::array<float,2>{0.448919177f, 0.581805944f},
-std::array<float,2>{0.619748712f, 0.804739118f},
-std::array<float,2>{0.239437848f, 0.403457761f},
-std::array<float,2>{0.540386081f, 0.0605753027f},
-std::array<float,2>{0.135371178f, 0.554815888f},
-std::array<float,2>{0.843218267f, 0.873037457f},
-std::array<float,2>{0.382488728f, 0.459592134f},
-std::array<float,2>{0.941495121f, 0.291167647f},
-std::array<float,2>{0.30992353f, 0.956565499f},
-std::array<float,2>{0.714124024f, 0.663561285f},
-std::array<float,2>{0.0281143952f, 0.149986193f},
-std::array<float,2>{0.645401001f, 0.396135777f},
-std::array<float,2>{0.0673299134f, 0.802540064f},
-std::array<float,2>{0.902889073f, 0.591538191f},
-std::array<float,2>{0.353100479f, 0.0871378779f},
-std::array<float,2>{0.806107104f, 0.188953385f},
-std::array<float,2>{0.489894122f, 0.727885425f},
-std::array<float,2>{0.588399649f, 0.897827208f},
-std::array<float,2>{0.190364778f, 0.32775259f},
-std::array<float,2>{0.733695209f, 0.173100874f},
-std::array<float,2>{0.0463120304f, 0.647649109f},
-std::array<float,2>{0.977705836f, 0.969801903f},
-std::array<float,2>{0.276799351f, 0.27865988f},
-std::array<float,2>{0.86539644f, 0.487310976f},
-std::array<float,2>{0.423303992f, 0.815995812f},
-std::array<float,2>{0.504169583f, 0.524182379f},
-std::array<float,2>{0.175816864f, 0.0171628408f},
-std::array<float,2>{0.613623857f, 0.353446543f},
-std::array<float,2>{0.24886778f, 0.936522543f},
-std::array<float,2>{0.771911561f, 0.701546431f},
-std::array<float,2>{0.439620048f, 0.224431843f},
-std::array<float,2>{0.919994235f, 0.0997126922f},
-std::array<float,2>{0.317463249f, 0.61205405f},
-std::array<float,2>{0.661431313f, 0.763574183f},
-std::array<float,2>{0.09777008f, 0.408632755f},
-std::array<float,2>{0.6758582f, 0.0655065998f},
-std::array<float,2>{0.115168855f, 0.563381791f},
-std::array<float,2>{0.935033023f, 0.796669483f},
-std::array<float,2>{0.341416359f, 0.382767648f},
-std::array<float,2>{0.750098288f, 0.339303136f},
-std::array<float,2>{0.468368411f, 0.890094995f},
-std::array<float,2>{0.599197567f, 0.740694761f},
-std::array<float,2>{0.225361407f, 0.216475323f},
-std::array<float,2>{0.519874692f, 0.43887952f},
-std::array<float,2>{0.161051214f, 0.852068484f},
-std::array<float,2>{0.851300597f, 0.53772378f},
-std::array<float,2>{0.420309812f, 0.0361592621f},
-std::array<float,2>{0.995384693f, 0.12681143f},
-std::array<float,2>{0.25559175f, 0.67406565f},
-std::array<float,2>{0.740739107f, 0.940363944f},
-std::array<float,2>{0.0531669259f, 0.31030336f},
-std::array<float,2>{0.566214263f, 0.245491803f},
-std::array<float,2>{0.206599027f, 0.713841975f},
-std::array<float,2>{0.795594752f, 0.909135699f},
-std::array<float,2>{0.471192241f, 0.362543851f},
-std::array<float,2>{0.883420706f, 0.430873066f},
-std::array<float,2>{0.369435281f, 0.769285023f},
-std::array<float,2>{0.62883842f, 0.609326541f},
-std::array<float,2>{0.0875812247f, 0.11671707f},
-std::array<float,2>{0.699556351f, 0.25853169f},
-std::array<float,2>{0.0144945951f, 0.989924967f},
-std::array<float,2>{0.968187213f, 0.632131994f},
-std::array<float,2>{0.291041881f, 0.170007214f},
-std::array<float,2>{0.827819586f, 0.0117755169f},
-std::array<float,2>{0.405199349f, 0.512573838f},
-std::array<float,2>{0.56196779f, 0.832139492f},
-std::array<float,2>{0.155416906f, 0.480242789f},
-std::array<float,2>{0.526506186f, 0.0919983387f},
-std::array<float,2>{0.170542717f, 0.586275101f},
-std::array<float,2>{0.857620835f, 0.797820449f},
-std::array<float,2>{0.410519242f, 0.393673718f},
-std::array<float,2>{0.988061607f, 0.323879212f},
-std::array<float,2>{0.262667447f, 0.892951071f},
-std::array<float,2>{0.749967813f, 0.731553674f},
-std::array<float,2>{0.054968901f, 0.194030404f},
-std::array<float,2>{0.684384644f, 0.4533768f},
-std::array<float,2>{0.123289146f, 0.869590342f},
-std::array<float,2>{0.927186728f, 0.561366081f},
-std::array<float,2>{0.333863467f, 0.0554344952f},
-std::array<float,2>{0.758952439f, 0.153402016f},
-std::array<float,2>{0.456621021f, 0.658044159f},
-std::array<float,2>{0.602797389f, 0.958726883f},
-std::array<float,2>{0.230232671f, 0.296480864f},
-std::array<float,2>{0.691467106f, 0.222050786f},
-std::array<float,2>{0.00226947851f, 0.699032307f},
-std::array<float,2>{0.958349407f, 0.930555999f},
-std::array<float,2>{0.281472355f, 0.355832726f},
-std::array<float,2>{0.814793527f, 0.412603468f},
-std::array<float,2>{0.390903652f, 0.760483682f},
-std::array<float,2>{0.551238358f, 0.614980698f},
-std::array<float,2>{0.141232952f, 0.0965720341f},
-std::array<float,2>{0.573904037f, 0.276722699f},
-std::array<float,2>{0.215549663f, 0.975289226f},
-std::array<float,2>{0.786573231f, 0.641240001f},
-std::array<float,2>{0.482515693f, 0.177719995f},
-std::array<float,2>{0.881219566f, 0.0201547015f},
-std::array<float,2>{0.359717548f, 0.530247688f},
-std::array<float,2>{0.636086881f, 0.817681015f},
-std::array<float,2>{0.0836489797f, 0.491748184f},
-std::array<float,2>{0.654311001f, 0.0331730247f},
-std::array<float,2>{0.0732841864f, 0.53204143f},
-std::array<float,2>{0.898085058f, 0.856169105f},
-std::array<float,2>{0.34501636f, 0.444494814f},
-std::array<float,2>{0.798156917f, 0.305558652f},
-std::array<float,2>{0.499294311f, 0.944320381f},
-std::array<float,2>{0.585816979f, 0.677405f},
-std::array<float,2>{0.201366872f, 0.129863188f},
-std::array<float,2>{0.533934951f, 0.375593007f},
-std::array<float,2>{0.12975423f, 0.792649508f},
-std::array<float,2>{0.830798984f, 0.569643855f},
-std::array<float,2>{0.383199006f, 0.0678064451f},
-std::array<float,2>{0.949750006f, 0.213474452f},
-std::array<float,2>{0.296961159f, 0.735920727f},
-std::array<float,2>{0.703267276f, 0.884803474f},
-std::array<float,2>{0.0163455997f, 0.340426803f},
-std::array<float,2>{0.622914314f, 0.164706901f},
-std::array<float,2>{0.2361525f, 0.627569556f},
-std::array<float,2>{0.779058099f, 0.987024546f},
-std::array<float,2>{0.450960666f, 0.262018412f},
-std::array<float,2>{0.906986535f, 0.484045327f},
-std::array<float,2>{0.322299272f, 0.830920935f},
-std::array<float,2>{0.668541431f, 0.510359049f},
-std::array<float,2>{0.102288194f, 0.00976066384f},
-std::array<float,2>{0.723485112f, 0.365605205f},
-std::array<float,2>{0.0381054394f, 0.912595391f},
-std::array<float,2>{0.97053951f, 0.718420863f},
-std::array<float,2>{0.27038908f, 0.248130172f},
-std::array<float,2>{0.869756103f, 0.11321409f},
-std::array<float,2>{0.434457868f, 0.602861166f},
-std::array<float,2>{0.508569241f, 0.77095896f},
-std::array<float,2>{0.181158751f, 0.433629066f},
-std::array<float,2>{0.592270195f, 0.00660167262f},
-std::array<float,2>{0.192837164f, 0.500583351f},
-std::array<float,2>{0.809652865f, 0.843566716f},
-std::array<float,2>{0.4859837f, 0.47187829f},
-std::array<float,2>{0.901840627f, 0.253323823f},
-std::array<float,2>{0.356302619f, 0.999171019f},
-std::array<float,2>{0.641191125f, 0.633192122f},
-std::array<float,2>{0.0659369305f, 0.157920584f},
-std::array<float,2>{0.714935422f, 0.423374236f},
-std::array<float,2>{0.0253143776f, 0.777460873f},
-std::array<float,2>{0.938839614f, 0.596131742f},
-std::array<float,2>{0.30526948f, 0.11876902f},
-std::array<float,2>{0.836224914f, 0.238335043f},
-std::array<float,2>{0.377671152f, 0.704101801f},
-std::array<float,2>{0.544097185f, 0.920933127f},
-std::array<float,2>{0.140436962f, 0.367487669f},
-std::array<float,2>{0.65629375f, 0.136650339f},
-std::array<float,2>{0.0955600962f, 0.67970705f},
-std::array<float,2>{0.917546213f, 0.948825419f},
-std::array<float,2>{0.312545568f, 0.301639706f},
-std::array<float,2>{0.766306341f, 0.453071296f},
-std::array<float,2>{0.445251316f, 0.850269079f},
-std::array<float,2>{0.609407008f, 0.545642674f},
-std::array<float,2>{0.243829101f, 0.0468593426f},
-std::array<float,2>{0.503519654f, 0.333878368f},
-std::array<float,2>{0.174185812f, 0.880780399f},
-std::array<float,2>{0.862238169f, 0.749172926f},
-std::array<float,2>{0.426298589f, 0.204665005f},
-std::array<float,2>{0.980588615f, 0.0725215673f},
-std::array<float,2>{0.278926432f, 0.575382948f},
-std::array<float,2>{0.729353309f, 0.783250213f},
-std::array<float,2>{0.0403606221f, 0.385122746f},
-std::array<float,2>{0.736234069f, 0.103806943f},
-std::array<float,2>{0.0481179617f, 0.61890018f},
-std::array<float,2>{0.998694301f, 0.7523911f},
-std::array<float,2>{0.251746625f, 0.415521085f},
-std::array<float,2>{0.845426202f, 0.35020712f},
-std::array<float,2>{0.415882289f, 0.926199973f},
-std::array<float,2>{0.516341805f, 0.690792203f},
-std::array<float,2>{0.157724768f, 0.22723417f},
-std::array<float,2>{0.596475363f, 0.499564439f},
-std::array<float,2>{0.221717492f, 0.822916389f},
-std::array<float,2>{0.756392717f, 0.517208099f},
-std::array<float,2>{0.464215875f, 0.0307082534f},
-std::array<float,2>{0.929787934f, 0.183056235f},
-std::array<float,2>{0.337438971f, 0.653947115f},
-std::array<float,2>{0.675393105f, 0.98404628f},
-std::array<float,2>{0.112440765f, 0.269476831f},
-std::array<float,2>{0.557438552f, 0.195933953f},
-std::array<float,2>{0.151494786f, 0.721340954f},
-std::array<float,2>{0.823262453f, 0.899356663f},
-std::array<float,2>{0.399261653f, 0.317956179f},
-std::array<float,2>{0.96221149f, 0.401112765f},
-std::array<float,2>{0.293039292f, 0.811557353f},
-std::array<float,2>{0.698254883f, 0.583242655f},
-std::array<float,2>{0.00781571958f, 0.0814144388f},
-std::array<float,2>{0.629239976f, 0.282565564f},
-std::array<float,2>{0.0913917795f, 0.962799251f},
-std::array<float,2>{0.890518844f, 0.667912662f},
-std::array<float,2>{0.371143192f, 0.142895058f},
-std::array<float,2>{0.792465568f, 0.0494199432f},
-std::array<float,2>{0.473113179f, 0.550965846f},
-std::array<float,2>{0.566893458f, 0.863421679f},
-std::array<float,2>{0.210260525f, 0.46560511f},
-std::array<float,2>{0.576619744f, 0.0750957727f},
-std::array<float,2>{0.212044105f, 0.573156834f},
-std::array<float,2>{0.781550646f, 0.786740184f},
-std::array<float,2>{0.48036027f, 0.387131631f},
-std::array<float,2>{0.878576875f, 0.330623984f},
-std::array<float,2>{0.366030574f, 0.877494991f},
-std::array<float,2>{0.636943579f, 0.744822443f},
-std::array<float,2>{0.0795112252f, 0.207490861f},
-std::array<float,2>{0.688112795f, 0.44912231f},
-std::array<float,2>{0.00653235195f, 0.844080865f},
-std::array<float,2>{0.955328047f, 0.539829671f},
-std::array<float,2>{0.286079466f, 0.0394897535f},
-std::array<float,2>{0.816722572f, 0.137706071f},
-std::array<float,2>{0.396461546f, 0.685548127f},
-std::array<float,2>{0.548043132f, 0.951877713f},
-std::array<float,2>{0.147072732f, 0.298005432f},
-std::array<float,2>{0.682544649f, 0.237462297f},
-std::array<float,2>{0.120897196f, 0.707864523f},
-std::array<float,2>{0.925495148f, 0.914307296f},
-std::array<float,2>{0.331464618f, 0.371560633f},
-std::array<float,2>{0.763980865f, 0.429416001f},
-std::array<float,2>{0.45984447f, 0.776477993f},
-std::array<float,2>{0.607111931f, 0.600061238f},
-std::array<float,2>{0.231432498f, 0.122813024f},
-std::array<float,2>{0.527680874f, 0.257316709f},
-std::array<float,2>{0.16432786f, 0.992970467f},
-std::array<float,2>{0.854891598f, 0.639556766f},
-std::array<float,2>{0.40632996f, 0.160248175f},
-std::array<float,2>{0.991817474f, 0.00345572387f},
-std::array<float,2>{0.259723186f, 0.505213976f},
-std::array<float,2>{0.742769778f, 0.838154018f},
-std::array<float,2>{0.0601178594f, 0.475528687f},
-std::array<float,2>{0.71999234f, 0.0540589765f},
-std::array<float,2>{0.0344188511f, 0.549377561f},
-std::array<float,2>{0.974802196f, 0.862875462f},
-std::array<float,2>{0.268122941f, 0.464006335f},
-std::array<float,2>{0.873767257f, 0.287380368f},
-std::array<float,2>{0.433560759f, 0.967610121f},
-std::array<float,2>{0.511817992f, 0.668590844f},
-std::array<float,2>{0.186270863f, 0.147477776f},
-std::array<float,2>{0.618806779f, 0.40463376f},
-std::array<float,2>{0.240240008f, 0.808275402f},
-std::array<float,2>{0.773959517f, 0.579329252f},
-std::array<float,2>{0.445380181f, 0.0832250342f},
-std::array<float,2>{0.912278593f, 0.202085793f},
-std::array<float,2>{0.325021058f, 0.724017203f},
-std::array<float,2>{0.665843844f, 0.904560149f},
-std::array<float,2>{0.108845644f, 0.315251142f},
-std::array<float,2>{0.538591385f, 0.187211096f},
-std::array<float,2>{0.128601834f, 0.651999414f},
-std::array<float,2>{0.834657907f, 0.977912486f},
-std::array<float,2>{0.387246192f, 0.273395389f},
-std::array<float,2>{0.946973801f, 0.493111074f},
-std::array<float,2>{0.302285999f, 0.826049924f},
-std::array<float,2>{0.707048774f, 0.522384822f},
-std::array<float,2>{0.0198233183f, 0.0242979378f},
-std::array<float,2>{0.650226176f, 0.345457286f},
-std::array<float,2>{0.0770453364f, 0.92346096f},
-std::array<float,2>{0.891965687f, 0.694783092f},
-std::array<float,2>{0.350340784f, 0.232072428f},
-std::array<float,2>{0.802879155f, 0.106276758f},
-std::array<float,2>{0.492260665f, 0.624765456f},
-std::array<float,2>{0.581915319f, 0.755135536f},
-std::array<float,2>{0.196315929f, 0.419894189f},
-std::array<float,2>{0.506389678f, 0.0194464363f},
-std::array<float,2>{0.178949788f, 0.525956094f},
-std::array<float,2>{0.863743067f, 0.81321615f},
-std::array<float,2>{0.424042255f, 0.486313999f},
-std::array<float,2>{0.979086459f, 0.279500574f},
-std::array<float,2>{0.273548514f, 0.972314f},
-std::array<float,2>{0.732240796f, 0.645956933f},
-std::array<float,2>{0.0434857607f, 0.173964381f},
-std::array<float,2>{0.663230062f, 0.407802612f},
-std::array<float,2>{0.100656718f, 0.764761865f},
-std::array<float,2>{0.919605792f, 0.610897899f},
-std::array<float,2>{0.319923371f, 0.0987900868f},
-std::array<float,2>{0.770087063f, 0.224902824f},
-std::array<float,2>{0.438604057f, 0.700065553f},
-std::array<float,2>{0.61715728f, 0.933925092f},
-std::array<float,2>{0.247355044f, 0.354463965f},
-std::array<float,2>{0.711305559f, 0.151496783f},
-std::array<float,2>{0.0301122665f, 0.660820365f},
-std::array<float,2>{0.944433153f, 0.953425109f},
-std::array<float,2>{0.310743719f, 0.290856034f},
-std::array<float,2>{0.841282666f, 0.458787411f},
-std::array<float,2>{0.379408807f, 0.873863101f},
-std::array<float,2>{0.542681992f, 0.556918383f},
-std::array<float,2>{0.133980468f, 0.0594127104f},
-std::array<float,2>{0.586650789f, 0.325598776f},
-std::array<float,2>{0.18872942f, 0.895077944f},
-std::array<float,2>{0.808171988f, 0.728837132f},
-std::array<float,2>{0.491988838f, 0.190237254f},
-std::array<float,2>{0.904563665f, 0.088772893f},
-std::array<float,2>{0.354941398f, 0.592185855f},
-std::array<float,2>{0.647605002f, 0.803774595f},
-std::array<float,2>{0.0687589422f, 0.396864712f},
-std::array<float,2>{0.626602232f, 0.114092968f},
-std::array<float,2>{0.0896374136f, 0.606342971f},
-std::array<float,2>{0.885372102f, 0.765879452f},
-std::array<float,2>{0.367893934f, 0.433405578f},
-std::array<float,2>{0.794108808f, 0.361254245f},
-std::array<float,2>{0.469736993f, 0.907398939f},
-std::array<float,2>{0.564336658f, 0.711620033f},
-std::array<float,2>{0.204340562f, 0.243439913f},
-std::array<float,2>{0.560088694f, 0.478113234f},
-std::array<float,2>{0.153983906f, 0.835754097f},
-std::array<float,2>{0.824765086f, 0.514199972f},
-std::array<float,2>{0.404094696f, 0.0152759785f},
-std::array<float,2>{0.965207696f, 0.168598011f},
-std::array<float,2>{0.290493757f, 0.630118251f},
-std::array<float,2>{0.701277733f, 0.990669012f},
-std::array<float,2>{0.0126492875f, 0.260587782f},
-std::array<float,2>{0.601529479f, 0.218248844f},
-std::array<float,2>{0.22429511f, 0.739248931f},
-std::array<float,2>{0.752455413f, 0.88852191f},
-std::array<float,2>{0.464998364f, 0.336158991f},
-std::array<float,2>{0.93744576f, 0.380339682f},
-std::array<float,2>{0.343733013f, 0.793055117f},
-std::array<float,2>{0.678255498f, 0.565540969f},
-std::array<float,2>{0.11644575f, 0.0629343688f},
-std::array<float,2>{0.738870442f, 0.312069178f},
-std::array<float,2>{0.0526088104f, 0.938647926f},
-std::array<float,2>{0.993883073f, 0.672370255f},
-std::array<float,2>{0.257754266f, 0.128639057f},
-std::array<float,2>{0.847735763f, 0.0376420133f},
-std::array<float,2>{0.418606311f, 0.535531044f},
-std::array<float,2>{0.522886097f, 0.855056226f},
-std::array<float,2>{0.162632972f, 0.440933377f},
-std::array<float,2>{0.553763628f, 0.0952720568f},
-std::array<float,2>{0.142782271f, 0.615278661f},
-std::array<float,2>{0.814164877f, 0.758463979f},
-std::array<float,2>{0.393773258f, 0.410904974f},
-std::array<float,2>{0.959083438f, 0.358838081f},
-std::array<float,2>{0.284624398f, 0.932529926f},
-std::array<float,2>{0.69477272f, 0.696399212f},
-std::array<float,2>{0.00150347943f, 0.218846738f},
-std::array<float,2>{0.633295715f, 0.489725709f},
-std::array<float,2>{0.0846070945f, 0.819940686f},
-std::array<float,2>{0.879222155f, 0.528559744f},
-std::array<float,2>{0.3624084f, 0.0228658933f},
-std::array<float,2>{0.788882196f, 0.179567695f},
-std::array<float,2>{0.481697083f, 0.642686486f},
-std::array<float,2>{0.57095474f, 0.974132121f},
-std::array<float,2>{0.218665987f, 0.275009006f},
-std::array<float,2>{0.747026443f, 0.192606106f},
-std::array<float,2>{0.0571282543f, 0.733183444f},
-std::array<float,2>{0.98491627f, 0.891379595f},
-std::array<float,2>{0.26372543f, 0.322028369f},
-std::array<float,2>{0.856723607f, 0.39095512f},
-std::array<float,2>{0.412262142f, 0.800661266f},
-std::array<float,2>{0.523939431f, 0.589026213f},
-std::array<float,2>{0.169289216f, 0.0913807675f},
-std::array<float,2>{0.603868067f, 0.294693947f},
-std::array<float,2>{0.228134647f, 0.960636675f},
-std::array<float,2>{0.760296226f, 0.659144044f},
-std::array<float,2>{0.454665184f, 0.154427558f},
-std::array<float,2>{0.92826128f, 0.0570282452f},
-std::array<float,2>{0.334425151f, 0.558634937f},
-std::array<float,2>{0.685848176f, 0.867454767f},
-std::array<float,2>{0.122034572f, 0.455758542f},
-std::array<float,2>{0.671402156f, 0.0105269318f},
-std::array<float,2>{0.103953242f, 0.508161962f},
-std::array<float,2>{0.909830868f, 0.82950592f},
-std::array<float,2>{0.321983457f, 0.481343478f},
-std::array<float,2>{0.780961335f, 0.264182419f},
-std::array<float,2>{0.451687038f, 0.98547405f},
-std::array<float,2>{0.624871612f, 0.625124395f},
-std::array<float,2>{0.237023428f, 0.166914001f},
-std::array<float,2>{0.510825634f, 0.436895877f},
-std::array<float,2>{0.18211101f, 0.771615505f},
-std::array<float,2>{0.867384136f, 0.604049921f},
-std::array<float,2>{0.436439991f, 0.110568963f},
-std::array<float,2>{0.972356558f, 0.24720268f},
-std::array<float,2>{0.273320168f, 0.716263771f},
-std::array<float,2>{0.724732816f, 0.910321712f},
-std::array<float,2>{0.035296496f, 0.364754766f},
-std::array<float,2>{0.582895696f, 0.131655291f},
-std::array<float,2>{0.200583145f, 0.679086387f},
-std::array<float,2>{0.800648272f, 0.942268014f},
-std::array<float,2>{0.497640967f, 0.306953728f},
-std::array<float,2>{0.894966662f, 0.443266749f},
-std::array<float,2>{0.347537786f, 0.858294189f},
-std::array<float,2>{0.654165745f, 0.53482765f},
-std::array<float,2>{0.0703880414f, 0.0348921083f},
-std::array<float,2>{0.706994116f, 0.342895418f},
-std::array<float,2>{0.0190880317f, 0.883779883f},
-std::array<float,2>{0.953112125f, 0.736396432f},
-std::array<float,2>{0.300335467f, 0.211030945f},
-std::array<float,2>{0.829742193f, 0.0685657337f},
-std::array<float,2>{0.384800345f, 0.568211675f},
-std::array<float,2>{0.533152997f, 0.789700031f},
-std::array<float,2>{0.131211549f, 0.377174854f},
-std::array<float,2>{0.611608982f, 0.0444536358f},
-std::array<float,2>{0.245039925f, 0.544222891f},
-std::array<float,2>{0.768111348f, 0.847672403f},
-std::array<float,2>{0.441566348f, 0.450083673f},
-std::array<float,2>{0.915693641f, 0.30440408f},
-std::array<float,2>{0.316101193f, 0.946083724f},
-std::array<float,2>{0.659083664f, 0.681855261f},
-std::array<float,2>{0.0967092738f, 0.133354425f},
-std::array<float,2>{0.726773381f, 0.383633584f},
-std::array<float,2>{0.0423405766f, 0.781317174f},
-std::array<float,2>{0.984289229f, 0.576439977f},
-std::array<float,2>{0.281059057f, 0.0721275955f},
-std::array<float,2>{0.861235619f, 0.206939951f},
-std::array<float,2>{0.428135097f, 0.747420788f},
-std::array<float,2>{0.50000447f, 0.882618427f},
-std::array<float,2>{0.173336402f, 0.335783273f},
-std::array<float,2>{0.644378662f, 0.159494519f},
-std::array<float,2>{0.063615717f, 0.635739923f},
-std::array<float,2>{0.899801195f, 0.997754753f},
-std::array<float,2>{0.358148515f, 0.250395805f},
-std::array<float,2>{0.811832786f, 0.47040391f},
-std::array<float,2>{0.487930387f, 0.840846121f},
-std::array<float,2>{0.590352535f, 0.502831519f},
-std::array<float,2>{0.193855524f, 0.00475509092f},
-std::array<float,2>{0.546175003f, 0.370986432f},
-std::array<float,2>{0.137117386f, 0.918577135f},
-std::array<float,2>{0.839389622f, 0.706230402f},
-std::array<float,2>{0.376601189f, 0.240334928f},
-std::array<float,2>{0.939518929f, 0.120849498f},
-std::array<float,2>{0.307016313f, 0.595029294f},
-std::array<float,2>{0.717756391f, 0.779584587f},
-std::array<float,2>{0.0258558188f, 0.425720215f},
-std::array<float,2>{0.696492732f, 0.0789928064f},
-std::array<float,2>{0.011068658f, 0.585079372f},
-std::array<float,2>{0.963852286f, 0.810488403f},
-std::array<float,2>{0.295983791f, 0.399981916f},
-std::array<float,2>{0.821720958f, 0.31946373f},
-std::array<float,2>{0.400518596f, 0.901035845f},
-std::array<float,2>{0.554782867f, 0.720189154f},
-std::array<float,2>{0.148842752f, 0.198251113f},
-std::array<float,2>{0.568548024f, 0.467031926f},
-std::array<float,2>{0.207033813f, 0.866949141f},
-std::array<float,2>{0.79098618f, 0.553562045f},
-std::array<float,2>{0.474848002f, 0.0483103767f},
-std::array<float,2>{0.888005912f, 0.14082256f},
-std::array<float,2>{0.374135673f, 0.665912032f},
-std::array<float,2>{0.631125748f, 0.96414876f},
-std::array<float,2>{0.0933829248f, 0.285140902f},
-std::array<float,2>{0.517686963f, 0.229346454f},
-std::array<float,2>{0.159101814f, 0.689414859f},
-std::array<float,2>{0.84755832f, 0.92914319f},
-std::array<float,2>{0.416917235f, 0.347810835f},
-std::array<float,2>{0.996788263f, 0.416998208f},
-std::array<float,2>{0.253829658f, 0.750596046f},
-std::array<float,2>{0.736526549f, 0.621087372f},
-std::array<float,2>{0.0503391698f, 0.10295219f},
-std::array<float,2>{0.673427999f, 0.267079651f},
-std::array<float,2>{0.111006737f, 0.981493413f},
-std::array<float,2>{0.93319118f, 0.655532062f},
-std::array<float,2>{0.33924517f, 0.180014491f},
-std::array<float,2>{0.75470823f, 0.0277142879f},
-std::array<float,2>{0.462058336f, 0.517710567f},
-std::array<float,2>{0.594410777f, 0.820667803f},
-std::array<float,2>{0.219564989f, 0.49802503f},
-std::array<float,2>{0.62063235f, 0.0820965618f},
-std::array<float,2>{0.238975942f, 0.579039693f},
-std::array<float,2>{0.777153671f, 0.80732137f},
-std::array<float,2>{0.447361708f, 0.405462921f},
-std::array<float,2>{0.910420597f, 0.315578997f},
-std::array<float,2>{0.326671749f, 0.905621767f},
-std::array<float,2>{0.666199744f, 0.722866535f},
-std::array<float,2>{0.106457822f, 0.202479929f},
-std::array<float,2>{0.722617388f, 0.462985873f},
-std::array<float,2>{0.0327061825f, 0.861566663f},
-std::array<float,2>{0.97435981f, 0.550363541f},
-std::array<float,2>{0.267159373f, 0.0530579835f},
-std::array<float,2>{0.871540487f, 0.146541193f},
-std::array<float,2>{0.431631953f, 0.669817328f},
-std::array<float,2>{0.514827013f, 0.968487203f},
-std::array<float,2>{0.18508178f, 0.288592964f},
-std::array<float,2>{0.651720226f, 0.231112003f},
-std::array<float,2>{0.0750618875f, 0.69390887f},
-std::array<float,2>{0.893725276f, 0.921970904f},
-std::array<float,2>{0.347785532f, 0.343804955f},
-std::array<float,2>{0.8015908f, 0.418454468f},
-std::array<float,2>{0.49578914f, 0.754051268f},
-std::array<float,2>{0.579519391f, 0.623958766f},
-std::array<float,2>{0.197818056f, 0.107042506f},
-std::array<float,2>{0.535410404f, 0.271735847f},
-std::array<float,2>{0.126427412f, 0.97730577f},
-std::array<float,2>{0.83349508f, 0.65110153f},
-std::array<float,2>{0.389962763f, 0.185822144f},
-std::array<float,2>{0.947503507f, 0.024884969f},
-std::array<float,2>{0.303456336f, 0.522917271f},
-std::array<float,2>{0.709438384f, 0.825083137f},
-std::array<float,2>{0.0230524652f, 0.493339568f},
-std::array<float,2>{0.689597487f, 0.0407354645f},
-std::array<float,2>{0.00549344998f, 0.540088058f},
-std::array<float,2>{0.953838289f, 0.845074296f},
-std::array<float,2>{0.287278801f, 0.447278649f},
-std::array<float,2>{0.820073307f, 0.297152191f},
-std::array<float,2>{0.397180647f, 0.952680409f},
-std::array<float,2>{0.550071537f, 0.687403858f},
-std::array<float,2>{0.144691065f, 0.137142897f},
-std::array<float,2>{0.5750857f, 0.388215423f},
-std::array<float,2>{0.213501245f, 0.785637021f},
-std::array<float,2>{0.783714056f, 0.573372424f},
-std::array<float,2>{0.47718668f, 0.0752891824f},
-std::array<float,2>{0.87590313f, 0.208499566f},
-std::array<float,2>{0.364732146f, 0.745143354f},
-std::array<float,2>{0.639270544f, 0.878592849f},
-std::array<float,2>{0.0812394097f, 0.331247628f},
-std::array<float,2>{0.530386627f, 0.162095279f},
-std::array<float,2>{0.167368859f, 0.640030861f},
-std::array<float,2>{0.852298379f, 0.993450701f},
-std::array<float,2>{0.409801751f, 0.255959809f},
-std::array<float,2>{0.988340855f, 0.476038843f},
-std::array<float,2>{0.260727882f, 0.839216173f},
-std::array<float,2>{0.745138764f, 0.504475474f},
-std::array<float,2>{0.0622727126f, 0.00260632997f},
-std::array<float,2>{0.679730475f, 0.372716457f},
-std::array<float,2>{0.117596455f, 0.915099621f},
-std::array<float,2>{0.923559785f, 0.708086312f},
-std::array<float,2>{0.329424471f, 0.237063959f},
-std::array<float,2>{0.762208641f, 0.121420294f},
-std::array<float,2>{0.458397418f, 0.601466596f},
-std::array<float,2>{0.608641148f, 0.776161909f},
-std::array<float,2>{0.234238535f, 0.428426623f},
-std::array<float,2>{0.56074512f, 0.0139490608f},
-std::array<float,2>{0.154727355f, 0.514801264f},
-std::array<float,2>{0.826521158f, 0.834013999f},
-std::array<float,2>{0.406207919f, 0.477388561f},
-std::array<float,2>{0.967137456f, 0.261659801f},
-std::array<float,2>{0.292338133f, 0.991850913f},
-std::array<float,2>{0.700989008f, 0.629712164f},
-std::array<float,2>{0.0154334288f, 0.169044957f},
-std::array<float,2>{0.627737463f, 0.431962579f},
-std::array<float,2>{0.0859999433f, 0.767199755f},
-std::array<float,2>{0.884248495f, 0.606762588f},
-std::array<float,2>{0.370293856f, 0.114418738f},
-std::array<float,2>{0.796068072f, 0.242278486f},
-std::array<float,2>{0.472340852f, 0.712458849f},
-std::array<float,2>{0.565372348f, 0.906296372f},
-std::array<float,2>{0.20557265f, 0.360309541f},
-std::array<float,2>{0.741683602f, 0.127774224f},
-std::array<float,2>{0.054324232f, 0.672902405f},
-std::array<float,2>{0.994495988f, 0.937589109f},
-std::array<float,2>{0.254149973f, 0.310985893f},
-std::array<float,2>{0.850266278f, 0.440011084f},
-std::array<float,2>{0.421197534f, 0.853796661f},
-std::array<float,2>{0.520820975f, 0.536613166f},
-std::array<float,2>{0.161719099f, 0.0385562219f},
-std::array<float,2>{0.597916305f, 0.337095022f},
-std::array<float,2>{0.226421297f, 0.887301803f},
-std::array<float,2>{0.751316428f, 0.739819646f},
-std::array<float,2>{0.467084646f, 0.217519596f},
-std::array<float,2>{0.933981478f, 0.0637636781f},
-std::array<float,2>{0.340627164f, 0.565266609f},
-std::array<float,2>{0.676964581f, 0.794847608f},
-std::array<float,2>{0.11386808f, 0.379603863f},
-std::array<float,2>{0.660458088f, 0.0983615518f},
-std::array<float,2>{0.0987447053f, 0.610221148f},
-std::array<float,2>{0.921561718f, 0.764297187f},
-std::array<float,2>{0.316717982f, 0.407161504f},
-std::array<float,2>{0.772918403f, 0.355291218f},
-std::array<float,2>{0.441205651f, 0.935354054f},
-std::array<float,2>{0.614648819f, 0.700491011f},
-std::array<float,2>{0.249954328f, 0.226166785f},
-std::array<float,2>{0.505161345f, 0.484481752f},
-std::array<float,2>{0.177093014f, 0.814345777f},
-std::array<float,2>{0.866560459f, 0.526635528f},
-std::array<float,2>{0.422123164f, 0.0180359744f},
-std::array<float,2>{0.977450192f, 0.174884826f},
-std::array<float,2>{0.275795609f, 0.644643843f},
-std::array<float,2>{0.732650757f, 0.970888376f},
-std::array<float,2>{0.0451566726f, 0.280894279f},
-std::array<float,2>{0.589802682f, 0.190439254f},
-std::array<float,2>{0.191065446f, 0.729576826f},
-std::array<float,2>{0.805207193f, 0.89574331f},
-std::array<float,2>{0.48840493f, 0.324715823f},
-std::array<float,2>{0.90390867f, 0.398190171f},
-std::array<float,2>{0.351581186f, 0.803665102f},
-std::array<float,2>{0.645945072f, 0.592974365f},
-std::array<float,2>{0.0679553673f, 0.0894280449f},
-std::array<float,2>{0.713028789f, 0.289439946f},
-std::array<float,2>{0.0289983414f, 0.954522371f},
-std::array<float,2>{0.942822099f, 0.661318719f},
-std::array<float,2>{0.309229016f, 0.150597781f},
-std::array<float,2>{0.842524886f, 0.0597129576f},
-std::array<float,2>{0.381323546f, 0.557847142f},
-std::array<float,2>{0.539415061f, 0.87460357f},
-std::array<float,2>{0.13618131f, 0.457409263f},
-std::array<float,2>{0.509675443f, 0.109738477f},
-std::array<float,2>{0.17995964f, 0.605371118f},
-std::array<float,2>{0.87098974f, 0.773300469f},
-std::array<float,2>{0.434961885f, 0.435693413f},
-std::array<float,2>{0.968782187f, 0.363493592f},
-std::array<float,2>{0.270825237f, 0.911770105f},
-std::array<float,2>{0.724055171f, 0.715803623f},
-std::array<float,2>{0.0371309891f, 0.246391803f},
-std::array<float,2>{0.669136226f, 0.481522381f},
-std::array<float,2>{0.103503466f, 0.82884872f},
-std::array<float,2>{0.90770632f, 0.509741962f},
-std::array<float,2>{0.324209094f, 0.0115119386f},
-std::array<float,2>{0.777411282f, 0.167964607f},
-std::array<float,2>{0.450082779f, 0.626050949f},
-std::array<float,2>{0.621924043f, 0.984544635f},
-std::array<float,2>{0.235215247f, 0.264674991f},
-std::array<float,2>{0.70500797f, 0.212697461f},
-std::array<float,2>{0.0172398128f, 0.737644792f},
-std::array<float,2>{0.950622737f, 0.883814752f},
-std::array<float,2>{0.298096776f, 0.341872156f},
-std::array<float,2>{0.831235647f, 0.378129333f},
-std::array<float,2>{0.384285361f, 0.790417075f},
-std::array<float,2>{0.534828544f, 0.567073464f},
-std::array<float,2>{0.130543232f, 0.0693613142f},
-std::array<float,2>{0.584429622f, 0.308301091f},
-std::array<float,2>{0.202226415f, 0.942742646f},
-std::array<float,2>{0.797275782f, 0.678505361f},
-std::array<float,2>{0.49880448f, 0.132100686f},
-std::array<float,2>{0.897198439f, 0.0332956314f},
-std::array<float,2>{0.3443681f, 0.533598781f},
-std::array<float,2>{0.656037152f, 0.858629048f},
-std::array<float,2>{0.0725909621f, 0.441572219f},
-std::array<float,2>{0.635569811f, 0.0220458526f},
-std::array<float,2>{0.0824486837f, 0.52797085f},
-std::array<float,2>{0.882016897f, 0.819198608f},
-std::array<float,2>{0.360947043f, 0.489184588f},
-std::array<float,2>{0.785688579f, 0.273569167f},
-std::array<float,2>{0.484139353f, 0.972781181f},
-std::array<float,2>{0.572334826f, 0.644081354f},
-std::array<float,2>{0.216127694f, 0.178375795f},
-std::array<float,2>{0.551888108f, 0.411407202f},
-std::array<float,2>{0.14219448f, 0.759588182f},
-std::array<float,2>{0.816245794f, 0.61628145f},
-std::array<float,2>{0.391656101f, 0.0945382565f},
-std::array<float,2>{0.957261443f, 0.22005789f},
-std::array<float,2>{0.282970756f, 0.695365965f},
-std::array<float,2>{0.69271332f, 0.932888269f},
-std::array<float,2>{0.0036807952f, 0.358009458f},
-std::array<float,2>{0.602310717f, 0.156081945f},
-std::array<float,2>{0.229163632f, 0.659812272f},
-std::array<float,2>{0.758712471f, 0.959945858f},
-std::array<float,2>{0.455731422f, 0.293009073f},
-std::array<float,2>{0.926482737f, 0.456339478f},
-std::array<float,2>{0.332255691f, 0.869071007f},
-std::array<float,2>{0.685439527f, 0.56005764f},
-std::array<float,2>{0.124486513f, 0.0580854528f},
-std::array<float,2>{0.74852699f, 0.321061999f},
-std::array<float,2>{0.0563592464f, 0.891803145f},
-std::array<float,2>{0.987303019f, 0.73386246f},
-std::array<float,2>{0.263037175f, 0.1923462f},
-std::array<float,2>{0.858845413f, 0.0905521289f},
-std::array<float,2>{0.411671549f, 0.587991714f},
-std::array<float,2>{0.525806367f, 0.799543142f},
-std::array<float,2>{0.171418905f, 0.391684502f},
-std::array<float,2>{0.567913711f, 0.0477568246f},
-std::array<float,2>{0.209092796f, 0.554622471f},
-std::array<float,2>{0.791782677f, 0.865745723f},
-std::array<float,2>{0.474548638f, 0.467825919f},
-std::array<float,2>{0.888711035f, 0.283805728f},
-std::array<float,2>{0.372916013f, 0.963775098f},
-std::array<float,2>{0.630716026f, 0.664241254f},
-std::array<float,2>{0.090237312f, 0.141910166f},
-std::array<float,2>{0.697928011f, 0.399353594f},
-std::array<float,2>{0.00937887002f, 0.809245169f},
-std::array<float,2>{0.961324751f, 0.584025979f},
-std::array<float,2>{0.29396829f, 0.0791485831f},
-std::array<float,2>{0.82313776f, 0.197594568f},
-std::array<float,2>{0.399661511f, 0.719090581f},
-std::array<float,2>{0.557961881f, 0.902167737f},
-std::array<float,2>{0.150756016f, 0.318694443f},
-std::array<float,2>{0.674184263f, 0.181531817f},
-std::array<float,2>{0.111438423f, 0.654798448f},
-std::array<float,2>{0.930999935f, 0.980564177f},
-std::array<float,2>{0.336715698f, 0.265824884f},
-std::array<float,2>{0.757448852f, 0.496196687f},
-std::array<float,2>{0.463678777f, 0.821316302f},
-std::array<float,2>{0.597001672f, 0.519414485f},
-std::array<float,2>{0.221074373f, 0.02915412f},
-std::array<float,2>{0.517235279f, 0.349553347f},
-std::array<float,2>{0.157144442f, 0.928323686f},
-std::array<float,2>{0.844601393f, 0.688219965f},
-std::array<float,2>{0.414110035f, 0.230297491f},
-std::array<float,2>{0.999976337f, 0.102236897f},
-std::array<float,2>{0.250042081f, 0.619252801f},
-std::array<float,2>{0.735086322f, 0.7515167f},
-std::array<float,2>{0.047510758f, 0.416636437f},
-std::array<float,2>{0.730001509f, 0.0710526407f},
-std::array<float,2>{0.0394250192f, 0.577795327f},
-std::array<float,2>{0.981849134f, 0.782874465f},
-std::array<float,2>{0.278053671f, 0.384458959f},
-std::array<float,2>{0.863207817f, 0.334038854f},
-std::array<float,2>{0.427357405f, 0.88107127f},
-std::array<float,2>{0.502831578f, 0.746367216f},
-std::array<float,2>{0.175594777f, 0.205742314f},
-std::array<float,2>{0.611119628f, 0.450900048f},
-std::array<float,2>{0.243035659f, 0.849038243f},
-std::array<float,2>{0.767440915f, 0.543129206f},
-std::array<float,2>{0.44391349f, 0.0435700081f},
-std::array<float,2>{0.916952133f, 0.13422896f},
-std::array<float,2>{0.313722074f, 0.683336139f},
-std::array<float,2>{0.657755673f, 0.946663737f},
-std::array<float,2>{0.0944017395f, 0.303179473f},
-std::array<float,2>{0.543422997f, 0.241750926f},
-std::array<float,2>{0.139398143f, 0.705398917f},
-std::array<float,2>{0.836995959f, 0.919472158f},
-std::array<float,2>{0.378874153f, 0.36984396f},
-std::array<float,2>{0.937839806f, 0.423972517f},
-std::array<float,2>{0.306328088f, 0.780752182f},
-std::array<float,2>{0.716436028f, 0.594314039f},
-std::array<float,2>{0.0242447928f, 0.119296826f},
-std::array<float,2>{0.642299652f, 0.251926929f},
-std::array<float,2>{0.0648305789f, 0.99679184f},
-std::array<float,2>{0.900647998f, 0.635877073f},
-std::array<float,2>{0.35651806f, 0.158696279f},
-std::array<float,2>{0.809281111f, 0.00526132109f},
-std::array<float,2>{0.485008091f, 0.503324628f},
-std::array<float,2>{0.59325844f, 0.840162158f},
-std::array<float,2>{0.19146426f, 0.469126999f},
-std::array<float,2>{0.580602765f, 0.109249689f},
-std::array<float,2>{0.195981652f, 0.621101975f},
-std::array<float,2>{0.803777456f, 0.756203473f},
-std::array<float,2>{0.494025022f, 0.42179653f},
-std::array<float,2>{0.891186297f, 0.346546471f},
-std::array<float,2>{0.351431638f, 0.92427671f},
-std::array<float,2>{0.648949564f, 0.693321586f},
-std::array<float,2>{0.0775929615f, 0.233607888f},
-std::array<float,2>{0.708423197f, 0.494583368f},
-std::array<float,2>{0.0205412731f, 0.82704711f},
-std::array<float,2>{0.945637226f, 0.520902634f},
-std::array<float,2>{0.301371783f, 0.0273014065f},
-std::array<float,2>{0.835159659f, 0.184332997f},
-std::array<float,2>{0.388342381f, 0.649697423f},
-std::array<float,2>{0.537495136f, 0.97872442f},
-std::array<float,2>{0.127158731f, 0.270537496f},
-std::array<float,2>{0.664283335f, 0.199724108f},
-std::array<float,2>{0.107784018f, 0.726426542f},
-std::array<float,2>{0.913913608f, 0.903157532f},
-std::array<float,2>{0.325933993f, 0.314071298f},
-std::array<float,2>{0.774694622f, 0.402681917f},
-std::array<float,2>{0.446569353f, 0.80656296f},
-std::array<float,2>{0.617939174f, 0.580363333f},
-std::array<float,2>{0.242153734f, 0.0840354934f},
-std::array<float,2>{0.513322771f, 0.286878645f},
-std::array<float,2>{0.186540306f, 0.964939952f},
-std::array<float,2>{0.874404728f, 0.671038866f},
-std::array<float,2>{0.431790024f, 0.145022288f},
-std::array<float,2>{0.975990474f, 0.0510690697f},
-std::array<float,2>{0.26925832f, 0.548669577f},
-std::array<float,2>{0.719367087f, 0.859378695f},
-std::array<float,2>{0.0333655477f, 0.462827802f},
-std::array<float,2>{0.743580043f, 0.000332109368f},
-std::array<float,2>{0.0588235706f, 0.507307589f},
-std::array<float,2>{0.991182923f, 0.837547779f},
-std::array<float,2>{0.258033991f, 0.472980052f},
-std::array<float,2>{0.853669941f, 0.254964888f},
-std::array<float,2>{0.407491803f, 0.994576395f},
-std::array<float,2>{0.529013455f, 0.637289345f},
-std::array<float,2>{0.165700734f, 0.163880199f},
-std::array<float,2>{0.60547781f, 0.426557928f},
-std::array<float,2>{0.232001424f, 0.774620712f},
-std::array<float,2>{0.764679134f, 0.598991275f},
-std::array<float,2>{0.460776716f, 0.123324797f},
-std::array<float,2>{0.92438978f, 0.235671178f},
-std::array<float,2>{0.330974191f, 0.709149003f},
-std::array<float,2>{0.683086336f, 0.916103482f},
-std::array<float,2>{0.120021209f, 0.374178082f},
-std::array<float,2>{0.547050357f, 0.139286265f},
-std::array<float,2>{0.148055971f, 0.6840958f},
-std::array<float,2>{0.817686915f, 0.950473785f},
-std::array<float,2>{0.395263135f, 0.299130619f},
-std::array<float,2>{0.956295907f, 0.445490152f},
-std::array<float,2>{0.286296874f, 0.845744193f},
-std::array<float,2>{0.688675106f, 0.541283906f},
-std::array<float,2>{0.00730802631f, 0.0427515507f},
-std::array<float,2>{0.637931049f, 0.329433411f},
-std::array<float,2>{0.0789215341f, 0.875941575f},
-std::array<float,2>{0.877688766f, 0.744122028f},
-std::array<float,2>{0.366959006f, 0.209247053f},
-std::array<float,2>{0.782684028f, 0.0778866708f},
-std::array<float,2>{0.479015023f, 0.570324719f},
-std::array<float,2>{0.577637792f, 0.787331462f},
-std::array<float,2>{0.211546734f, 0.39006272f},
-std::array<float,2>{0.522391021f, 0.0354393683f},
-std::array<float,2>{0.163705319f, 0.538997948f},
-std::array<float,2>{0.849017799f, 0.853120327f},
-std::array<float,2>{0.419884354f, 0.438419342f},
-std::array<float,2>{0.992938101f, 0.30952245f},
-std::array<float,2>{0.256234795f, 0.941129744f},
-std::array<float,2>{0.740053833f, 0.675558507f},
-std::array<float,2>{0.0514909886f, 0.125851229f},
-std::array<float,2>{0.679173231f, 0.381658703f},
-std::array<float,2>{0.11566934f, 0.795435488f},
-std::array<float,2>{0.935919583f, 0.564378321f},
-std::array<float,2>{0.342212409f, 0.0647429749f},
-std::array<float,2>{0.753179312f, 0.215728119f},
-std::array<float,2>{0.466415018f, 0.741456866f},
-std::array<float,2>{0.600044847f, 0.889028013f},
-std::array<float,2>{0.223208219f, 0.337983221f},
-std::array<float,2>{0.702443361f, 0.171106055f},
-std::array<float,2>{0.0131860478f, 0.631082535f},
-std::array<float,2>{0.966407835f, 0.988634765f},
-std::array<float,2>{0.289430022f, 0.259382755f},
-std::array<float,2>{0.825989723f, 0.479441613f},
-std::array<float,2>{0.402348757f, 0.833080828f},
-std::array<float,2>{0.558994353f, 0.513522387f},
-std::array<float,2>{0.15329662f, 0.012959796f},
-std::array<float,2>{0.562958181f, 0.361848444f},
-std::array<float,2>{0.203411922f, 0.910111547f},
-std::array<float,2>{0.792994499f, 0.714337111f},
-std::array<float,2>{0.4687832f, 0.244391441f},
-std::array<float,2>{0.88605988f, 0.115476109f},
-std::array<float,2>{0.369116873f, 0.608259797f},
-std::array<float,2>{0.625552237f, 0.768160224f},
-std::array<float,2>{0.0878966972f, 0.430007786f},
-std::array<float,2>{0.647222161f, 0.0868127793f},
-std::array<float,2>{0.0702570528f, 0.590750396f},
-std::array<float,2>{0.90554601f, 0.801736891f},
-std::array<float,2>{0.354388982f, 0.3953197f},
-std::array<float,2>{0.807323933f, 0.326340318f},
-std::array<float,2>{0.490700752f, 0.897087097f},
-std::array<float,2>{0.587499857f, 0.727142811f},
-std::array<float,2>{0.188449666f, 0.187911466f},
-std::array<float,2>{0.541181564f, 0.460832238f},
-std::array<float,2>{0.133679241f, 0.871482909f},
-std::array<float,2>{0.840775967f, 0.555721641f},
-std::array<float,2>{0.380080968f, 0.0618899725f},
-std::array<float,2>{0.943549156f, 0.14902088f},
-std::array<float,2>{0.311863691f, 0.662739038f},
-std::array<float,2>{0.712609172f, 0.955499887f},
-std::array<float,2>{0.0308575444f, 0.292872429f},
-std::array<float,2>{0.615985096f, 0.223321781f},
-std::array<float,2>{0.246794447f, 0.703049541f},
-std::array<float,2>{0.771014869f, 0.936748087f},
-std::array<float,2>{0.437865227f, 0.352043837f},
-std::array<float,2>{0.91850394f, 0.409186691f},
-std::array<float,2>{0.318435758f, 0.76218611f},
-std::array<float,2>{0.662541449f, 0.612411559f},
-std::array<float,2>{0.0999419317f, 0.101172186f},
-std::array<float,2>{0.731354833f, 0.278217375f},
-std::array<float,2>{0.0443552323f, 0.969419718f},
-std::array<float,2>{0.979905546f, 0.646982074f},
-std::array<float,2>{0.275153756f, 0.172469258f},
-std::array<float,2>{0.864858806f, 0.0163940433f},
-std::array<float,2>{0.425579458f, 0.525093079f},
-std::array<float,2>{0.507543743f, 0.815377653f},
-std::array<float,2>{0.178000167f, 0.486783028f},
-std::array<float,2>{0.531282902f, 0.0669095367f},
-std::array<float,2>{0.131867498f, 0.568894207f},
-std::array<float,2>{0.828795731f, 0.791695595f},
-std::array<float,2>{0.385840476f, 0.376559734f},
-std::array<float,2>{0.951663077f, 0.341099054f},
-std::array<float,2>{0.299779803f, 0.886591673f},
-std::array<float,2>{0.705382228f, 0.734586298f},
-std::array<float,2>{0.0178869721f, 0.214439377f},
-std::array<float,2>{0.653253198f, 0.443615943f},
-std::array<float,2>{0.0718055144f, 0.856699944f},
-std::array<float,2>{0.896252871f, 0.532430232f},
-std::array<float,2>{0.34651491f, 0.0314650461f},
-std::array<float,2>{0.798891425f, 0.130570188f},
-std::array<float,2>{0.496731907f, 0.676492989f},
-std::array<float,2>{0.583322287f, 0.94508338f},
-std::array<float,2>{0.199662507f, 0.305735677f},
-std::array<float,2>{0.726325214f, 0.249851182f},
-std::array<float,2>{0.0363431908f, 0.717706501f},
-std::array<float,2>{0.971256673f, 0.913093209f},
-std::array<float,2>{0.272443771f, 0.366260588f},
-std::array<float,2>{0.868597925f, 0.434654057f},
-std::array<float,2>{0.437243491f, 0.770347714f},
-std::array<float,2>{0.510709167f, 0.601782858f},
-std::array<float,2>{0.18356733f, 0.111653805f},
-std::array<float,2>{0.623289227f, 0.263003945f},
-std::array<float,2>{0.23770009f, 0.987356961f},
-std::array<float,2>{0.779463291f, 0.628327787f},
-std::array<float,2>{0.452181995f, 0.165134534f},
-std::array<float,2>{0.908722758f, 0.0078224875f},
-std::array<float,2>{0.320655048f, 0.510854721f},
-std::array<float,2>{0.670874715f, 0.831963241f},
-std::array<float,2>{0.104738764f, 0.482746363f},
-std::array<float,2>{0.687482476f, 0.0558114164f},
-std::array<float,2>{0.12211404f, 0.561700881f},
-std::array<float,2>{0.929073572f, 0.870695472f},
-std::array<float,2>{0.334979653f, 0.454147995f},
-std::array<float,2>{0.760988474f, 0.295522779f},
-std::array<float,2>{0.454052001f, 0.957685411f},
-std::array<float,2>{0.604887843f, 0.657224238f},
-std::array<float,2>{0.227425545f, 0.152501076f},
-std::array<float,2>{0.524428964f, 0.393081844f},
-std::array<float,2>{0.168413535f, 0.798314571f},
-std::array<float,2>{0.856030345f, 0.587379873f},
-std::array<float,2>{0.414010763f, 0.0927844122f},
-std::array<float,2>{0.985562742f, 0.194961846f},
-std::array<float,2>{0.265311658f, 0.731002271f},
-std::array<float,2>{0.747500181f, 0.89414835f},
-std::array<float,2>{0.0585434884f, 0.322777301f},
-std::array<float,2>{0.572048426f, 0.175948113f},
-std::array<float,2>{0.217590213f, 0.642412066f},
-std::array<float,2>{0.787518322f, 0.975606263f},
-std::array<float,2>{0.481117666f, 0.275879085f},
-std::array<float,2>{0.880323112f, 0.491048068f},
-std::array<float,2>{0.36169073f, 0.817320883f},
-std::array<float,2>{0.633983374f, 0.530606627f},
-std::array<float,2>{0.0849967599f, 0.0205493569f},
-std::array<float,2>{0.694292665f, 0.357171714f},
-std::array<float,2>{1.14629484e-05f, 0.93083173f},
-std::array<float,2>{0.960652292f, 0.698036015f},
-std::array<float,2>{0.283321738f, 0.220914036f},
-std::array<float,2>{0.812902629f, 0.097329475f},
-std::array<float,2>{0.393114448f, 0.613775373f},
-std::array<float,2>{0.553378344f, 0.760765433f},
-std::array<float,2>{0.143873036f, 0.413553149f},
-std::array<float,2>{0.594730675f, 0.0293023754f},
-std::array<float,2>{0.219877988f, 0.516466379f},
-std::array<float,2>{0.75531888f, 0.823523402f},
-std::array<float,2>{0.46149233f, 0.498944789f},
-std::array<float,2>{0.932179272f, 0.267962664f},
-std::array<float,2>{0.338404685f, 0.982682705f},
-std::array<float,2>{0.672365069f, 0.652704477f},
-std::array<float,2>{0.109794125f, 0.182131246f},
-std::array<float,2>{0.737769067f, 0.414286911f},
-std::array<float,2>{0.0493362769f, 0.7536394f},
-std::array<float,2>{0.997855306f, 0.617332041f},
-std::array<float,2>{0.252511919f, 0.105390586f},
-std::array<float,2>{0.845709562f, 0.228226691f},
-std::array<float,2>{0.417787105f, 0.689522922f},
-std::array<float,2>{0.518872142f, 0.926982582f},
-std::array<float,2>{0.159564659f, 0.351172566f},
-std::array<float,2>{0.632030249f, 0.144399464f},
-std::array<float,2>{0.0921788365f, 0.666590393f},
-std::array<float,2>{0.887611389f, 0.961846471f},
-std::array<float,2>{0.373158455f, 0.282154799f},
-std::array<float,2>{0.78967303f, 0.465946496f},
-std::array<float,2>{0.475920558f, 0.864919901f},
-std::array<float,2>{0.570251942f, 0.552585721f},
-std::array<float,2>{0.20874007f, 0.0503255241f},
-std::array<float,2>{0.556094944f, 0.316942513f},
-std::array<float,2>{0.149875239f, 0.899797797f},
-std::array<float,2>{0.821195543f, 0.721867919f},
-std::array<float,2>{0.4015944f, 0.196712494f},
-std::array<float,2>{0.963909686f, 0.0803535432f},
-std::array<float,2>{0.295770109f, 0.582612276f},
-std::array<float,2>{0.696068883f, 0.811387837f},
-std::array<float,2>{0.0106977019f, 0.401786327f},
-std::array<float,2>{0.71846211f, 0.117621437f},
-std::array<float,2>{0.0265618358f, 0.597440064f},
-std::array<float,2>{0.941112459f, 0.778966844f},
-std::array<float,2>{0.30781877f, 0.421895564f},
-std::array<float,2>{0.838172734f, 0.368626088f},
-std::array<float,2>{0.375614792f, 0.920754552f},
-std::array<float,2>{0.545036018f, 0.703281939f},
-std::array<float,2>{0.138228774f, 0.239728928f},
-std::array<float,2>{0.591221333f, 0.471576631f},
-std::array<float,2>{0.194798738f, 0.842525482f},
-std::array<float,2>{0.811413467f, 0.501816392f},
-std::array<float,2>{0.486477643f, 0.00717015378f},
-std::array<float,2>{0.89866817f, 0.156713545f},
-std::array<float,2>{0.358409464f, 0.633842945f},
-std::array<float,2>{0.6435256f, 0.998607516f},
-std::array<float,2>{0.0631003603f, 0.252410501f},
-std::array<float,2>{0.50121361f, 0.203222722f},
-std::array<float,2>{0.171876326f, 0.748425901f},
-std::array<float,2>{0.859554708f, 0.879217684f},
-std::array<float,2>{0.429117709f, 0.332738549f},
-std::array<float,2>{0.983057201f, 0.386116415f},
-std::array<float,2>{0.279927045f, 0.784495413f},
-std::array<float,2>{0.72815311f, 0.574337423f},
-std::array<float,2>{0.0416888371f, 0.0734713748f},
-std::array<float,2>{0.659201443f, 0.302060694f},
-std::array<float,2>{0.0965517387f, 0.948126495f},
-std::array<float,2>{0.914932847f, 0.68144381f},
-std::array<float,2>{0.315389574f, 0.135043174f},
-std::array<float,2>{0.768901348f, 0.0449953377f},
-std::array<float,2>{0.442697614f, 0.546268523f},
-std::array<float,2>{0.612745941f, 0.851081431f},
-std::array<float,2>{0.245569259f, 0.452139646f},
-std::array<float,2>{0.614948034f, 0.100750215f},
-std::array<float,2>{0.24909243f, 0.613132477f},
-std::array<float,2>{0.772995353f, 0.762440145f},
-std::array<float,2>{0.440900981f, 0.410051912f},
-std::array<float,2>{0.920934737f, 0.352074653f},
-std::array<float,2>{0.316929817f, 0.937429607f},
-std::array<float,2>{0.66092509f, 0.70249176f},
-std::array<float,2>{0.0994094163f, 0.223055914f},
-std::array<float,2>{0.732989073f, 0.486979604f},
-std::array<float,2>{0.0455239303f, 0.814458787f},
-std::array<float,2>{0.976636589f, 0.524652481f},
-std::array<float,2>{0.276248783f, 0.01562896f},
-std::array<float,2>{0.866870582f, 0.172362924f},
-std::array<float,2>{0.42254281f, 0.646742642f},
-std::array<float,2>{0.505575299f, 0.968982518f},
-std::array<float,2>{0.177595988f, 0.277668476f},
-std::array<float,2>{0.646174252f, 0.188179627f},
-std::array<float,2>{0.0676878467f, 0.726612568f},
-std::array<float,2>{0.903690577f, 0.896528006f},
-std::array<float,2>{0.352389574f, 0.327012092f},
-std::array<float,2>{0.805136383f, 0.394714773f},
-std::array<float,2>{0.488896936f, 0.800917149f},
-std::array<float,2>{0.589236259f, 0.590241551f},
-std::array<float,2>{0.19057782f, 0.0861466974f},
-std::array<float,2>{0.539713025f, 0.292174071f},
-std::array<float,2>{0.136456043f, 0.956021845f},
-std::array<float,2>{0.841863036f, 0.662356436f},
-std::array<float,2>{0.381801635f, 0.148652971f},
-std::array<float,2>{0.943238199f, 0.0622256957f},
-std::array<float,2>{0.308618635f, 0.556158721f},
-std::array<float,2>{0.71375066f, 0.872065187f},
-std::array<float,2>{0.0284207426f, 0.459984303f},
-std::array<float,2>{0.700426698f, 0.0135209905f},
-std::array<float,2>{0.0150084281f, 0.512793064f},
-std::array<float,2>{0.967367649f, 0.833824158f},
-std::array<float,2>{0.292488217f, 0.47885114f},
-std::array<float,2>{0.826778471f, 0.259137034f},
-std::array<float,2>{0.405329704f, 0.989134371f},
-std::array<float,2>{0.561049879f, 0.631480515f},
-std::array<float,2>{0.155170813f, 0.171649396f},
-std::array<float,2>{0.564559877f, 0.430267155f},
-std::array<float,2>{0.205397785f, 0.767997324f},
-std::array<float,2>{0.796591341f, 0.607667446f},
-std::array<float,2>{0.471788436f, 0.115977786f},
-std::array<float,2>{0.884352982f, 0.244637221f},
-std::array<float,2>{0.371072084f, 0.714804947f},
-std::array<float,2>{0.627206504f, 0.90944916f},
-std::array<float,2>{0.0867889896f, 0.36172244f},
-std::array<float,2>{0.521080315f, 0.125196934f},
-std::array<float,2>{0.161236495f, 0.67505151f},
-std::array<float,2>{0.850073397f, 0.940862954f},
-std::array<float,2>{0.421518803f, 0.309043556f},
-std::array<float,2>{0.994921207f, 0.437795311f},
-std::array<float,2>{0.254463017f, 0.852715015f},
-std::array<float,2>{0.742119968f, 0.538415611f},
-std::array<float,2>{0.0541633852f, 0.0356662273f},
-std::array<float,2>{0.677451491f, 0.33853966f},
-std::array<float,2>{0.113672137f, 0.88948971f},
-std::array<float,2>{0.934445679f, 0.741824985f},
-std::array<float,2>{0.340105981f, 0.215006456f},
-std::array<float,2>{0.751857579f, 0.0653824657f},
-std::array<float,2>{0.467562199f, 0.563847303f},
-std::array<float,2>{0.598343253f, 0.794968545f},
-std::array<float,2>{0.225798339f, 0.38131392f},
-std::array<float,2>{0.550327003f, 0.0421674438f},
-std::array<float,2>{0.14513576f, 0.541509449f},
-std::array<float,2>{0.819476008f, 0.846247673f},
-std::array<float,2>{0.396559268f, 0.445999682f},
-std::array<float,2>{0.953504622f, 0.299333453f},
-std::array<float,2>{0.287834138f, 0.950857043f},
-std::array<float,2>{0.690140545f, 0.683873355f},
-std::array<float,2>{0.00513435667f, 0.13900286f},
-std::array<float,2>{0.639096856f, 0.390253007f},
-std::array<float,2>{0.081904158f, 0.788027644f},
-std::array<float,2>{0.875227928f, 0.570989132f},
-std::array<float,2>{0.364976525f, 0.0772951469f},
-std::array<float,2>{0.783585608f, 0.20980829f},
-std::array<float,2>{0.476622224f, 0.743354976f},
-std::array<float,2>{0.574461699f, 0.875047505f},
-std::array<float,2>{0.212951317f, 0.329715997f},
-std::array<float,2>{0.746063888f, 0.163100719f},
-std::array<float,2>{0.0615574196f, 0.637020171f},
-std::array<float,2>{0.989050567f, 0.995077074f},
-std::array<float,2>{0.259976298f, 0.255625963f},
-std::array<float,2>{0.85193336f, 0.473497599f},
-std::array<float,2>{0.409241468f, 0.83719784f},
-std::array<float,2>{0.531171679f, 0.507778049f},
-std::array<float,2>{0.167728424f, 0.000744608347f},
-std::array<float,2>{0.609369338f, 0.374623597f},
-std::array<float,2>{0.233664036f, 0.916632056f},
-std::array<float,2>{0.76218909f, 0.709711373f},
-std::array<float,2>{0.45856005f, 0.235911459f},
-std::array<float,2>{0.923063099f, 0.12362203f},
-std::array<float,2>{0.329870731f, 0.599581182f},
-std::array<float,2>{0.680506706f, 0.774920821f},
-std::array<float,2>{0.118037678f, 0.425972819f},
-std::array<float,2>{0.666781783f, 0.0846204981f},
-std::array<float,2>{0.106961519f, 0.580766201f},
-std::array<float,2>{0.910742521f, 0.806134343f},
-std::array<float,2>{0.326378167f, 0.403078198f},
-std::array<float,2>{0.776596487f, 0.313589633f},
-std::array<float,2>{0.447945774f, 0.902575016f},
-std::array<float,2>{0.620570004f, 0.725588381f},
-std::array<float,2>{0.238497183f, 0.199286267f},
-std::array<float,2>{0.515437722f, 0.462169766f},
-std::array<float,2>{0.184983641f, 0.860002458f},
-std::array<float,2>{0.871929824f, 0.548281789f},
-std::array<float,2>{0.430922538f, 0.0513649955f},
-std::array<float,2>{0.973965526f, 0.144630671f},
-std::array<float,2>{0.26685673f, 0.671441853f},
-std::array<float,2>{0.722119331f, 0.965745807f},
-std::array<float,2>{0.0330583863f, 0.286186159f},
-std::array<float,2>{0.579848111f, 0.234171286f},
-std::array<float,2>{0.197298691f, 0.692736089f},
-std::array<float,2>{0.800919235f, 0.924460888f},
-std::array<float,2>{0.495461911f, 0.346163422f},
-std::array<float,2>{0.894268632f, 0.42091167f},
-std::array<float,2>{0.348399252f, 0.756646276f},
-std::array<float,2>{0.652294636f, 0.62191546f},
-std::array<float,2>{0.0746124387f, 0.108631559f},
-std::array<float,2>{0.709585786f, 0.271036714f},
-std::array<float,2>{0.0226642359f, 0.97904861f},
-std::array<float,2>{0.948178053f, 0.650302351f},
-std::array<float,2>{0.302985668f, 0.18404153f},
-std::array<float,2>{0.833915055f, 0.0264687818f},
-std::array<float,2>{0.390234023f, 0.521375299f},
-std::array<float,2>{0.536094844f, 0.826497316f},
-std::array<float,2>{0.126832157f, 0.495101243f},
-std::array<float,2>{0.502316833f, 0.0741790384f},
-std::array<float,2>{0.174873576f, 0.574983418f},
-std::array<float,2>{0.862498283f, 0.784708142f},
-std::array<float,2>{0.427183479f, 0.386542767f},
-std::array<float,2>{0.982290447f, 0.332444876f},
-std::array<float,2>{0.277424663f, 0.879758298f},
-std::array<float,2>{0.729872763f, 0.748687804f},
-std::array<float,2>{0.0396427959f, 0.203662798f},
-std::array<float,2>{0.657596648f, 0.451290488f},
-std::array<float,2>{0.094069764f, 0.850784659f},
-std::array<float,2>{0.916032314f, 0.546461701f},
-std::array<float,2>{0.314220548f, 0.0457766727f},
-std::array<float,2>{0.766845047f, 0.135735929f},
-std::array<float,2>{0.44343397f, 0.680724084f},
-std::array<float,2>{0.610547841f, 0.947321415f},
-std::array<float,2>{0.242377058f, 0.30239895f},
-std::array<float,2>{0.7158342f, 0.239824682f},
-std::array<float,2>{0.0237988718f, 0.703830004f},
-std::array<float,2>{0.938343406f, 0.920246065f},
-std::array<float,2>{0.305852234f, 0.368766934f},
-std::array<float,2>{0.837438881f, 0.422514707f},
-std::array<float,2>{0.378049701f, 0.778508246f},
-std::array<float,2>{0.543525755f, 0.59702158f},
-std::array<float,2>{0.138977289f, 0.117867507f},
-std::array<float,2>{0.593333662f, 0.25261575f},
-std::array<float,2>{0.191978186f, 0.998386323f},
-std::array<float,2>{0.808961034f, 0.63459456f},
-std::array<float,2>{0.484430104f, 0.156964481f},
-std::array<float,2>{0.901205242f, 0.00776265236f},
-std::array<float,2>{0.357138127f, 0.501238167f},
-std::array<float,2>{0.641964734f, 0.841852367f},
-std::array<float,2>{0.0650180802f, 0.470976591f},
-std::array<float,2>{0.629963875f, 0.050137911f},
-std::array<float,2>{0.0905637518f, 0.551891983f},
-std::array<float,2>{0.889586151f, 0.864536464f},
-std::array<float,2>{0.372272253f, 0.466436595f},
-std::array<float,2>{0.79117012f, 0.28168273f},
-std::array<float,2>{0.473746866f, 0.961153924f},
-std::array<float,2>{0.567485988f, 0.666269541f},
-std::array<float,2>{0.209605038f, 0.143583983f},
-std::array<float,2>{0.558546662f, 0.401878178f},
-std::array<float,2>{0.151133418f, 0.810855269f},
-std::array<float,2>{0.822633982f, 0.582435668f},
-std::array<float,2>{0.400247186f, 0.0806661919f},
-std::array<float,2>{0.96173811f, 0.196902901f},
-std::array<float,2>{0.2944718f, 0.72264421f},
-std::array<float,2>{0.697726846f, 0.90001142f},
-std::array<float,2>{0.00907896273f, 0.31685406f},
-std::array<float,2>{0.597434103f, 0.181750387f},
-std::array<float,2>{0.221391514f, 0.653050065f},
-std::array<float,2>{0.756963253f, 0.983255029f},
-std::array<float,2>{0.462966204f, 0.268514842f},
-std::array<float,2>{0.931284785f, 0.49836427f},
-std::array<float,2>{0.336414039f, 0.82387948f},
-std::array<float,2>{0.674422443f, 0.515967488f},
-std::array<float,2>{0.11215762f, 0.0299214758f},
-std::array<float,2>{0.734498739f, 0.350946426f},
-std::array<float,2>{0.0472781211f, 0.927456021f},
-std::array<float,2>{0.99942404f, 0.690264523f},
-std::array<float,2>{0.250689745f, 0.227722436f},
-std::array<float,2>{0.843773723f, 0.104959346f},
-std::array<float,2>{0.414867431f, 0.61798048f},
-std::array<float,2>{0.516621172f, 0.753304243f},
-std::array<float,2>{0.156491727f, 0.414965004f},
-std::array<float,2>{0.573170722f, 0.0212671645f},
-std::array<float,2>{0.216560572f, 0.531222999f},
-std::array<float,2>{0.785162926f, 0.816750348f},
-std::array<float,2>{0.483739763f, 0.490409434f},
-std::array<float,2>{0.882781863f, 0.27581808f},
-std::array<float,2>{0.360797584f, 0.976236582f},
-std::array<float,2>{0.635206282f, 0.64187032f},
-std::array<float,2>{0.0826784298f, 0.176456973f},
-std::array<float,2>{0.693075538f, 0.413902193f},
-std::array<float,2>{0.00302474527f, 0.761474848f},
-std::array<float,2>{0.958006263f, 0.613324523f},
-std::array<float,2>{0.282402784f, 0.0967215747f},
-std::array<float,2>{0.81575048f, 0.221348837f},
-std::array<float,2>{0.392145634f, 0.697694302f},
-std::array<float,2>{0.552428782f, 0.931246161f},
-std::array<float,2>{0.141887307f, 0.356765807f},
-std::array<float,2>{0.684770465f, 0.153282002f},
-std::array<float,2>{0.124921806f, 0.656676888f},
-std::array<float,2>{0.925865769f, 0.95708555f},
-std::array<float,2>{0.332552493f, 0.295348972f},
-std::array<float,2>{0.75829649f, 0.454812467f},
-std::array<float,2>{0.45508337f, 0.87017405f},
-std::array<float,2>{0.601895988f, 0.562122881f},
-std::array<float,2>{0.228830591f, 0.0562577061f},
-std::array<float,2>{0.526326001f, 0.32251665f},
-std::array<float,2>{0.171356693f, 0.893952966f},
-std::array<float,2>{0.859280765f, 0.730787039f},
-std::array<float,2>{0.411386162f, 0.194803819f},
-std::array<float,2>{0.986387968f, 0.0932765082f},
-std::array<float,2>{0.263645142f, 0.587753773f},
-std::array<float,2>{0.74888587f, 0.798440874f},
-std::array<float,2>{0.0560493842f, 0.393017322f},
-std::array<float,2>{0.724303782f, 0.112050749f},
-std::array<float,2>{0.0379016399f, 0.60206753f},
-std::array<float,2>{0.969555974f, 0.769625664f},
-std::array<float,2>{0.271003008f, 0.435309231f},
-std::array<float,2>{0.87039119f, 0.367102116f},
-std::array<float,2>{0.435226023f, 0.913860381f},
-std::array<float,2>{0.509266317f, 0.717106342f},
-std::array<float,2>{0.180185124f, 0.249342009f},
-std::array<float,2>{0.621489644f, 0.483319879f},
-std::array<float,2>{0.234617382f, 0.831541717f},
-std::array<float,2>{0.778051734f, 0.511665046f},
-std::array<float,2>{0.449244887f, 0.00850157719f},
-std::array<float,2>{0.908147037f, 0.16564469f},
-std::array<float,2>{0.323404104f, 0.628753901f},
-std::array<float,2>{0.669649959f, 0.987921238f},
-std::array<float,2>{0.102562666f, 0.263631612f},
-std::array<float,2>{0.534480035f, 0.214045197f},
-std::array<float,2>{0.129936963f, 0.734879017f},
-std::array<float,2>{0.831671f, 0.885794401f},
-std::array<float,2>{0.384075254f, 0.341549456f},
-std::array<float,2>{0.951026976f, 0.376109868f},
-std::array<float,2>{0.298806429f, 0.79104346f},
-std::array<float,2>{0.704280674f, 0.568775594f},
-std::array<float,2>{0.0169883482f, 0.0665629879f},
-std::array<float,2>{0.655323148f, 0.306414574f},
-std::array<float,2>{0.0729127973f, 0.944665611f},
-std::array<float,2>{0.896953523f, 0.675914526f},
-std::array<float,2>{0.343889266f, 0.130308151f},
-std::array<float,2>{0.79757756f, 0.0322174244f},
-std::array<float,2>{0.498516232f, 0.533183932f},
-std::array<float,2>{0.584656537f, 0.8573035f},
-std::array<float,2>{0.202790484f, 0.444094837f},
-std::array<float,2>{0.587304533f, 0.0892933682f},
-std::array<float,2>{0.187958658f, 0.593571007f},
-std::array<float,2>{0.806809664f, 0.802961767f},
-std::array<float,2>{0.490831912f, 0.397502273f},
-std::array<float,2>{0.906001508f, 0.324224085f},
-std::array<float,2>{0.353942454f, 0.896317244f},
-std::array<float,2>{0.646882713f, 0.730062902f},
-std::array<float,2>{0.0696797445f, 0.191130057f},
-std::array<float,2>{0.712337792f, 0.457661778f},
-std::array<float,2>{0.0306892525f, 0.874178946f},
-std::array<float,2>{0.944314361f, 0.558110774f},
-std::array<float,2>{0.312419921f, 0.0602672882f},
-std::array<float,2>{0.840064168f, 0.151028633f},
-std::array<float,2>{0.380680263f, 0.661931634f},
-std::array<float,2>{0.541731358f, 0.95468545f},
-std::array<float,2>{0.133221775f, 0.289636731f},
-std::array<float,2>{0.662869096f, 0.225590825f},
-std::array<float,2>{0.10019125f, 0.701102376f},
-std::array<float,2>{0.918344319f, 0.934723377f},
-std::array<float,2>{0.318949521f, 0.354852766f},
-std::array<float,2>{0.770845771f, 0.406370699f},
-std::array<float,2>{0.438331693f, 0.763860643f},
-std::array<float,2>{0.615706921f, 0.60957098f},
-std::array<float,2>{0.246282414f, 0.0976736322f},
-std::array<float,2>{0.506884754f, 0.280738503f},
-std::array<float,2>{0.178445101f, 0.971193671f},
-std::array<float,2>{0.864378572f, 0.645476341f},
-std::array<float,2>{0.424911499f, 0.175666213f},
-std::array<float,2>{0.98021692f, 0.0182990488f},
-std::array<float,2>{0.27453357f, 0.527139366f},
-std::array<float,2>{0.730877101f, 0.813914776f},
-std::array<float,2>{0.0447544567f, 0.485194862f},
-std::array<float,2>{0.739481211f, 0.0387950949f},
-std::array<float,2>{0.0512482077f, 0.536814153f},
-std::array<float,2>{0.992360711f, 0.854103148f},
-std::array<float,2>{0.256434083f, 0.439596325f},
-std::array<float,2>{0.849304974f, 0.311334103f},
-std::array<float,2>{0.419069022f, 0.938100159f},
-std::array<float,2>{0.521930456f, 0.67355442f},
-std::array<float,2>{0.163439959f, 0.127090394f},
-std::array<float,2>{0.600289285f, 0.378962666f},
-std::array<float,2>{0.22272113f, 0.794136167f},
-std::array<float,2>{0.753673196f, 0.56464076f},
-std::array<float,2>{0.466059536f, 0.0642003939f},
-std::array<float,2>{0.936152637f, 0.217240393f},
-std::array<float,2>{0.342286348f, 0.739515781f},
-std::array<float,2>{0.679337919f, 0.886824608f},
-std::array<float,2>{0.116129272f, 0.337733716f},
-std::array<float,2>{0.559121072f, 0.169560924f},
-std::array<float,2>{0.152710438f, 0.629195988f},
-std::array<float,2>{0.825532377f, 0.991330683f},
-std::array<float,2>{0.402860582f, 0.260870606f},
-std::array<float,2>{0.96600771f, 0.476580977f},
-std::array<float,2>{0.289803892f, 0.834856689f},
-std::array<float,2>{0.703080356f, 0.515276253f},
-std::array<float,2>{0.0127845285f, 0.0142861931f},
-std::array<float,2>{0.625074863f, 0.359603465f},
-std::array<float,2>{0.0884594843f, 0.907040238f},
-std::array<float,2>{0.886274874f, 0.712237895f},
-std::array<float,2>{0.368241102f, 0.242956087f},
-std::array<float,2>{0.793741822f, 0.11483153f},
-std::array<float,2>{0.469542861f, 0.607091129f},
-std::array<float,2>{0.563082755f, 0.76705879f},
-std::array<float,2>{0.203814596f, 0.432260573f},
-std::array<float,2>{0.528624415f, 0.00200749421f},
-std::array<float,2>{0.165199429f, 0.504101574f},
-std::array<float,2>{0.854168117f, 0.839404166f},
-std::array<float,2>{0.407822579f, 0.476513147f},
-std::array<float,2>{0.990430415f, 0.256656975f},
-std::array<float,2>{0.258344889f, 0.993856609f},
-std::array<float,2>{0.744046211f, 0.640469968f},
-std::array<float,2>{0.0591435246f, 0.161158711f},
-std::array<float,2>{0.683340192f, 0.427767247f},
-std::array<float,2>{0.119515263f, 0.775806844f},
-std::array<float,2>{0.924082518f, 0.600980699f},
-std::array<float,2>{0.330379933f, 0.121909514f},
-std::array<float,2>{0.765150249f, 0.236559212f},
-std::array<float,2>{0.460260302f, 0.70877856f},
-std::array<float,2>{0.606106162f, 0.915965855f},
-std::array<float,2>{0.231578782f, 0.372552454f},
-std::array<float,2>{0.68914628f, 0.137458012f},
-std::array<float,2>{0.00737492694f, 0.686825216f},
-std::array<float,2>{0.95700407f, 0.952621877f},
-std::array<float,2>{0.286682963f, 0.297732174f},
-std::array<float,2>{0.818162441f, 0.447798371f},
-std::array<float,2>{0.394924939f, 0.84540689f},
-std::array<float,2>{0.547605753f, 0.540669382f},
-std::array<float,2>{0.147926897f, 0.0400450155f},
-std::array<float,2>{0.577598393f, 0.331858695f},
-std::array<float,2>{0.211294755f, 0.877930284f},
-std::array<float,2>{0.782795489f, 0.745889664f},
-std::array<float,2>{0.478921592f, 0.20815365f},
-std::array<float,2>{0.877367735f, 0.0760558397f},
-std::array<float,2>{0.366322488f, 0.574026644f},
-std::array<float,2>{0.638491511f, 0.786039352f},
-std::array<float,2>{0.0782731026f, 0.387850642f},
-std::array<float,2>{0.6484465f, 0.106560379f},
-std::array<float,2>{0.0778903365f, 0.623216391f},
-std::array<float,2>{0.890832186f, 0.75475198f},
-std::array<float,2>{0.351020813f, 0.418494344f},
-std::array<float,2>{0.804408312f, 0.344508052f},
-std::array<float,2>{0.493612975f, 0.922451317f},
-std::array<float,2>{0.580286682f, 0.693726599f},
-std::array<float,2>{0.195422307f, 0.230954424f},
-std::array<float,2>{0.537682056f, 0.493948311f},
-std::array<float,2>{0.127718568f, 0.824589491f},
-std::array<float,2>{0.835678279f, 0.523351133f},
-std::array<float,2>{0.387810558f, 0.0251943823f},
-std::array<float,2>{0.946103752f, 0.186252102f},
-std::array<float,2>{0.301074326f, 0.65084964f},
-std::array<float,2>{0.708958626f, 0.976646066f},
-std::array<float,2>{0.0214793086f, 0.271973878f},
-std::array<float,2>{0.617397845f, 0.202732876f},
-std::array<float,2>{0.241644144f, 0.72331214f},
-std::array<float,2>{0.775326908f, 0.905858815f},
-std::array<float,2>{0.446968704f, 0.315930396f},
-std::array<float,2>{0.913313985f, 0.406053692f},
-std::array<float,2>{0.32533133f, 0.807022452f},
-std::array<float,2>{0.66483748f, 0.578163922f},
-std::array<float,2>{0.108037055f, 0.0829129368f},
-std::array<float,2>{0.719231963f, 0.288166046f},
-std::array<float,2>{0.0338657424f, 0.968132615f},
-std::array<float,2>{0.976225317f, 0.669004679f},
-std::array<float,2>{0.26869902f, 0.146994591f},
-std::array<float,2>{0.874539554f, 0.0533666052f},
-std::array<float,2>{0.432366729f, 0.549858987f},
-std::array<float,2>{0.513086438f, 0.861926317f},
-std::array<float,2>{0.187495828f, 0.463853747f},
-std::array<float,2>{0.545732379f, 0.120093904f},
-std::array<float,2>{0.137745813f, 0.594112158f},
-std::array<float,2>{0.838431716f, 0.780953109f},
-std::array<float,2>{0.375465482f, 0.424463183f},
-std::array<float,2>{0.940651774f, 0.369211733f},
-std::array<float,2>{0.308430225f, 0.918988347f},
-std::array<float,2>{0.717802882f, 0.705960155f},
-std::array<float,2>{0.0273390152f, 0.241670862f},
-std::array<float,2>{0.642722547f, 0.469417632f},
-std::array<float,2>{0.0626188219f, 0.840568542f},
-std::array<float,2>{0.899313092f, 0.503679991f},
-std::array<float,2>{0.359214246f, 0.00561360642f},
-std::array<float,2>{0.810927987f, 0.158489391f},
-std::array<float,2>{0.486963838f, 0.636338055f},
-std::array<float,2>{0.591588914f, 0.996276557f},
-std::array<float,2>{0.195137128f, 0.251342624f},
-std::array<float,2>{0.72789973f, 0.205332875f},
-std::array<float,2>{0.0413687639f, 0.746587455f},
-std::array<float,2>{0.982825279f, 0.881822348f},
-std::array<float,2>{0.279333472f, 0.334775001f},
-std::array<float,2>{0.859878063f, 0.383935243f},
-std::array<float,2>{0.429334432f, 0.782306254f},
-std::array<float,2>{0.501484871f, 0.577175736f},
-std::array<float,2>{0.172590211f, 0.0704158321f},
-std::array<float,2>{0.61317426f, 0.303437233f},
-std::array<float,2>{0.245993853f, 0.946807444f},
-std::array<float,2>{0.769174337f, 0.682886481f},
-std::array<float,2>{0.442931592f, 0.13466078f},
-std::array<float,2>{0.91432029f, 0.0432263091f},
-std::array<float,2>{0.314917147f, 0.543868363f},
-std::array<float,2>{0.660151958f, 0.849327087f},
-std::array<float,2>{0.0961480141f, 0.450663209f},
-std::array<float,2>{0.672055364f, 0.0283916742f},
-std::array<float,2>{0.109879829f, 0.518596649f},
-std::array<float,2>{0.931669891f, 0.82196182f},
-std::array<float,2>{0.338010758f, 0.497024953f},
-std::array<float,2>{0.755526543f, 0.266228735f},
-std::array<float,2>{0.460980296f, 0.981157482f},
-std::array<float,2>{0.595363975f, 0.654514492f},
-std::array<float,2>{0.220437229f, 0.181097656f},
-std::array<float,2>{0.519378185f, 0.416469693f},
-std::array<float,2>{0.160107225f, 0.751246989f},
-std::array<float,2>{0.846272886f, 0.620100617f},
-std::array<float,2>{0.417080343f, 0.101964481f},
-std::array<float,2>{0.997145355f, 0.229969487f},
-std::array<float,2>{0.252161175f, 0.687687337f},
-std::array<float,2>{0.738259077f, 0.92809248f},
-std::array<float,2>{0.0489063039f, 0.349107802f},
-std::array<float,2>{0.569399297f, 0.142244428f},
-std::array<float,2>{0.20841153f, 0.664671302f},
-std::array<float,2>{0.789378047f, 0.963229418f},
-std::array<float,2>{0.47622779f, 0.28340587f},
-std::array<float,2>{0.886734426f, 0.468603849f},
-std::array<float,2>{0.373935312f, 0.865348339f},
-std::array<float,2>{0.632486641f, 0.553884149f},
-std::array<float,2>{0.0926833898f, 0.047316432f},
-std::array<float,2>{0.695340514f, 0.319302529f},
-std::array<float,2>{0.0100320661f, 0.901656449f},
-std::array<float,2>{0.964398623f, 0.719326615f},
-std::array<float,2>{0.295029044f, 0.197823539f},
-std::array<float,2>{0.820537746f, 0.0799624547f},
-std::array<float,2>{0.402058512f, 0.584617436f},
-std::array<float,2>{0.556317329f, 0.808809161f},
-std::array<float,2>{0.150182605f, 0.398835003f},
-std::array<float,2>{0.605092287f, 0.0581736714f},
-std::array<float,2>{0.226969957f, 0.560203016f},
-std::array<float,2>{0.761524975f, 0.868432939f},
-std::array<float,2>{0.453261375f, 0.456754088f},
-std::array<float,2>{0.929332554f, 0.293909788f},
-std::array<float,2>{0.335581064f, 0.959085107f},
-std::array<float,2>{0.686561406f, 0.659280002f},
-std::array<float,2>{0.122606255f, 0.155628175f},
-std::array<float,2>{0.747932613f, 0.392188936f},
-std::array<float,2>{0.0580590069f, 0.798928142f},
-std::array<float,2>{0.986180007f, 0.58867538f},
-std::array<float,2>{0.264767736f, 0.0902356133f},
-std::array<float,2>{0.855496883f, 0.191893905f},
-std::array<float,2>{0.413370013f, 0.734166801f},
-std::array<float,2>{0.525110006f, 0.892092764f},
-std::array<float,2>{0.168607503f, 0.320753634f},
-std::array<float,2>{0.634738505f, 0.178091556f},
-std::array<float,2>{0.0854869932f, 0.643932045f},
-std::array<float,2>{0.880761504f, 0.973486602f},
-std::array<float,2>{0.362246156f, 0.274396777f},
-std::array<float,2>{0.787920475f, 0.488292068f},
-std::array<float,2>{0.480581999f, 0.818819821f},
-std::array<float,2>{0.571576297f, 0.52736181f},
-std::array<float,2>{0.217096984f, 0.0218050107f},
-std::array<float,2>{0.55313468f, 0.357818544f},
-std::array<float,2>{0.144239113f, 0.933396339f},
-std::array<float,2>{0.813296795f, 0.696231604f},
-std::array<float,2>{0.392788172f, 0.220559373f},
-std::array<float,2>{0.960363209f, 0.0940829962f},
-std::array<float,2>{0.283796489f, 0.616779983f},
-std::array<float,2>{0.693404853f, 0.759022057f},
-std::array<float,2>{0.000770682469f, 0.411915958f},
-std::array<float,2>{0.705709875f, 0.0702152401f},
-std::array<float,2>{0.0183087457f, 0.566476882f},
-std::array<float,2>{0.951611459f, 0.790747523f},
-std::array<float,2>{0.298835129f, 0.378540546f},
-std::array<float,2>{0.828213632f, 0.34244284f},
-std::array<float,2>{0.386662543f, 0.884729803f},
-std::array<float,2>{0.531893969f, 0.738236904f},
-std::array<float,2>{0.132688105f, 0.211956084f},
-std::array<float,2>{0.583943188f, 0.442341506f},
-std::array<float,2>{0.200167909f, 0.859005272f},
-std::array<float,2>{0.799504817f, 0.533980429f},
-std::array<float,2>{0.496444762f, 0.0340012982f},
-std::array<float,2>{0.895733774f, 0.132772893f},
-std::array<float,2>{0.346130997f, 0.67780602f},
-std::array<float,2>{0.652804136f, 0.943087161f},
-std::array<float,2>{0.071480535f, 0.307700515f},
-std::array<float,2>{0.509834647f, 0.247038469f},
-std::array<float,2>{0.182701066f, 0.715183139f},
-std::array<float,2>{0.869076014f, 0.911573589f},
-std::array<float,2>{0.436956018f, 0.363994211f},
-std::array<float,2>{0.970946133f, 0.43611446f},
-std::array<float,2>{0.271533936f, 0.77278769f},
-std::array<float,2>{0.725698948f, 0.604625463f},
-std::array<float,2>{0.0369732864f, 0.109878697f},
-std::array<float,2>{0.670246422f, 0.265171826f},
-std::array<float,2>{0.105315484f, 0.98495096f},
-std::array<float,2>{0.908493936f, 0.626495957f},
-std::array<float,2>{0.320847839f, 0.167344093f},
-std::array<float,2>{0.779800773f, 0.0107988929f},
-std::array<float,2>{0.453102499f, 0.508994281f},
-std::array<float,2>{0.623804688f, 0.828443587f},
-std::array<float,2>{0.237983122f, 0.482066333f},
-std::array<float,2>{0.599076569f, 0.0634468421f},
-std::array<float,2>{0.224905059f, 0.566095889f},
-std::array<float,2>{0.750565588f, 0.793632984f},
-std::array<float,2>{0.467806667f, 0.380642235f},
-std::array<float,2>{0.935363114f, 0.336537093f},
-std::array<float,2>{0.341012329f, 0.887820423f},
-std::array<float,2>{0.676514328f, 0.738290012f},
-std::array<float,2>{0.114303373f, 0.218332663f},
-std::array<float,2>{0.740633667f, 0.440563738f},
-std::array<float,2>{0.0536493063f, 0.854901612f},
-std::array<float,2>{0.995805085f, 0.535915136f},
-std::array<float,2>{0.254903167f, 0.037186157f},
-std::array<float,2>{0.851069033f, 0.128336966f},
-std::array<float,2>{0.420506597f, 0.67193383f},
-std::array<float,2>{0.5202564f, 0.938999653f},
-std::array<float,2>{0.160184667f, 0.311893046f},
-std::array<float,2>{0.628305018f, 0.244006887f},
-std::array<float,2>{0.0869855061f, 0.7109918f},
-std::array<float,2>{0.883179903f, 0.908134937f},
-std::array<float,2>{0.369722515f, 0.36070165f},
-std::array<float,2>{0.794959247f, 0.432736903f},
-std::array<float,2>{0.471109748f, 0.766236007f},
-std::array<float,2>{0.565678477f, 0.605618238f},
-std::array<float,2>{0.206379831f, 0.113472633f},
-std::array<float,2>{0.562498391f, 0.259846777f},
-std::array<float,2>{0.156232059f, 0.991018176f},
-std::array<float,2>{0.827361166f, 0.630655825f},
-std::array<float,2>{0.40453729f, 0.168279409f},
-std::array<float,2>{0.968492627f, 0.0150363715f},
-std::array<float,2>{0.291686416f, 0.514043987f},
-std::array<float,2>{0.700029075f, 0.83544749f},
-std::array<float,2>{0.0140580926f, 0.477887809f},
-std::array<float,2>{0.714717567f, 0.0590046793f},
-std::array<float,2>{0.0276332069f, 0.557576537f},
-std::array<float,2>{0.942277789f, 0.873439968f},
-std::array<float,2>{0.310207039f, 0.458489507f},
-std::array<float,2>{0.843401253f, 0.290191472f},
-std::array<float,2>{0.3820481f, 0.953614056f},
-std::array<float,2>{0.540725648f, 0.660563529f},
-std::array<float,2>{0.135056406f, 0.152268037f},
-std::array<float,2>{0.588371992f, 0.39698711f},
-std::array<float,2>{0.189737469f, 0.804426789f},
-std::array<float,2>{0.806242943f, 0.592661679f},
-std::array<float,2>{0.489597589f, 0.0883408189f},
-std::array<float,2>{0.902477086f, 0.189655289f},
-std::array<float,2>{0.352626383f, 0.72906214f},
-std::array<float,2>{0.644765258f, 0.894589782f},
-std::array<float,2>{0.06649445f, 0.32616356f},
-std::array<float,2>{0.504522026f, 0.174698308f},
-std::array<float,2>{0.176591828f, 0.64633894f},
-std::array<float,2>{0.866103947f, 0.971922636f},
-std::array<float,2>{0.423811197f, 0.279944569f},
-std::array<float,2>{0.978137195f, 0.485531956f},
-std::array<float,2>{0.277137458f, 0.812771142f},
-std::array<float,2>{0.734158158f, 0.525719762f},
-std::array<float,2>{0.04669239f, 0.0187698044f},
-std::array<float,2>{0.661893427f, 0.353996605f},
-std::array<float,2>{0.0982185528f, 0.934395671f},
-std::array<float,2>{0.920825958f, 0.699446142f},
-std::array<float,2>{0.317970484f, 0.225285843f},
-std::array<float,2>{0.772334278f, 0.099331513f},
-std::array<float,2>{0.440012962f, 0.610780716f},
-std::array<float,2>{0.613790214f, 0.765238702f},
-std::array<float,2>{0.248219922f, 0.407343209f},
-std::array<float,2>{0.536872447f, 0.0236412864f},
-std::array<float,2>{0.125293419f, 0.52168113f},
-std::array<float,2>{0.832437336f, 0.825593591f},
-std::array<float,2>{0.389259517f, 0.492651135f},
-std::array<float,2>{0.948735118f, 0.272947758f},
-std::array<float,2>{0.304557741f, 0.978325248f},
-std::array<float,2>{0.710751116f, 0.651568234f},
-std::array<float,2>{0.0223935358f, 0.18672736f},
-std::array<float,2>{0.650676608f, 0.419019341f},
-std::array<float,2>{0.0755611137f, 0.755726874f},
-std::array<float,2>{0.89319551f, 0.624184728f},
-std::array<float,2>{0.349316925f, 0.105772145f},
-std::array<float,2>{0.802590907f, 0.231698707f},
-std::array<float,2>{0.494547427f, 0.695272386f},
-std::array<float,2>{0.578853846f, 0.923134089f},
-std::array<float,2>{0.198347479f, 0.345003963f},
-std::array<float,2>{0.721520185f, 0.148255691f},
-std::array<float,2>{0.0320849568f, 0.668116212f},
-std::array<float,2>{0.972863495f, 0.96721071f},
-std::array<float,2>{0.266522706f, 0.28769201f},
-std::array<float,2>{0.873032212f, 0.464440525f},
-std::array<float,2>{0.429860592f, 0.862758696f},
-std::array<float,2>{0.514058828f, 0.548940599f},
-std::array<float,2>{0.183723524f, 0.0544957109f},
-std::array<float,2>{0.619612813f, 0.314569265f},
-std::array<float,2>{0.2398673f, 0.90479672f},
-std::array<float,2>{0.775908351f, 0.724271774f},
-std::array<float,2>{0.44849962f, 0.201559201f},
-std::array<float,2>{0.91167742f, 0.0837331116f},
-std::array<float,2>{0.327543616f, 0.579842925f},
-std::array<float,2>{0.667450309f, 0.808001041f},
-std::array<float,2>{0.105673552f, 0.404954821f},
-std::array<float,2>{0.681165397f, 0.122474775f},
-std::array<float,2>{0.118747465f, 0.600218177f},
-std::array<float,2>{0.922818244f, 0.777022302f},
-std::array<float,2>{0.328837693f, 0.429154187f},
-std::array<float,2>{0.763208032f, 0.372040838f},
-std::array<float,2>{0.457773775f, 0.914986253f},
-std::array<float,2>{0.607617378f, 0.707450569f},
-std::array<float,2>{0.232424304f, 0.237889647f},
-std::array<float,2>{0.53003329f, 0.474964112f},
-std::array<float,2>{0.166847721f, 0.838791788f},
-std::array<float,2>{0.853042126f, 0.505460501f},
-std::array<float,2>{0.408578724f, 0.00324941054f},
-std::array<float,2>{0.989859521f, 0.160985261f},
-std::array<float,2>{0.261084855f, 0.638770342f},
-std::array<float,2>{0.744707108f, 0.992528498f},
-std::array<float,2>{0.0606504865f, 0.257636249f},
-std::array<float,2>{0.575276315f, 0.207719192f},
-std::array<float,2>{0.21388343f, 0.744565904f},
-std::array<float,2>{0.784420133f, 0.877408564f},
-std::array<float,2>{0.47758916f, 0.330455512f},
-std::array<float,2>{0.87612766f, 0.387304753f},
-std::array<float,2>{0.363791138f, 0.78619355f},
-std::array<float,2>{0.6401788f, 0.572720528f},
-std::array<float,2>{0.0808213055f, 0.0746187344f},
-std::array<float,2>{0.691166699f, 0.298608214f},
-std::array<float,2>{0.00446396135f, 0.951442003f},
-std::array<float,2>{0.954683363f, 0.686449766f},
-std::array<float,2>{0.288580954f, 0.138284519f},
-std::array<float,2>{0.819332898f, 0.0397185311f},
-std::array<float,2>{0.397541165f, 0.53933084f},
-std::array<float,2>{0.54911828f, 0.844509065f},
-std::array<float,2>{0.146465436f, 0.448631436f},
-std::array<float,2>{0.515918553f, 0.103206031f},
-std::array<float,2>{0.15746063f, 0.620251f},
-std::array<float,2>{0.845140636f, 0.750330865f},
-std::array<float,2>{0.415437669f, 0.417786479f},
-std::array<float,2>{0.998220444f, 0.348506868f},
-std::array<float,2>{0.25104636f, 0.929214299f},
-std::array<float,2>{0.735436976f, 0.688729703f},
-std::array<float,2>{0.0483818576f, 0.228950754f},
-std::array<float,2>{0.675165534f, 0.497097611f},
-std::array<float,2>{0.112942517f, 0.82120949f},
-std::array<float,2>{0.930393934f, 0.518370986f},
-std::array<float,2>{0.337080747f, 0.0278436262f},
-std::array<float,2>{0.756180525f, 0.180434227f},
-std::array<float,2>{0.464573711f, 0.656158924f},
-std::array<float,2>{0.596057892f, 0.981993973f},
-std::array<float,2>{0.222350717f, 0.267383516f},
-std::array<float,2>{0.69894439f, 0.19904919f},
-std::array<float,2>{0.00868498255f, 0.720480382f},
-std::array<float,2>{0.962561488f, 0.90044564f},
-std::array<float,2>{0.293555081f, 0.320243627f},
-std::array<float,2>{0.824067712f, 0.399634063f},
-std::array<float,2>{0.398814708f, 0.80960238f},
-std::array<float,2>{0.556735992f, 0.585820258f},
-std::array<float,2>{0.152030632f, 0.0783274546f},
-std::array<float,2>{0.567047715f, 0.284626603f},
-std::array<float,2>{0.21064572f, 0.964502811f},
-std::array<float,2>{0.792496204f, 0.665232599f},
-std::array<float,2>{0.473553032f, 0.141318485f},
-std::array<float,2>{0.889873445f, 0.048371017f},
-std::array<float,2>{0.371796668f, 0.553084791f},
-std::array<float,2>{0.629749715f, 0.8664428f},
-std::array<float,2>{0.0912770256f, 0.467379063f},
-std::array<float,2>{0.64082855f, 0.00415226351f},
-std::array<float,2>{0.0655770302f, 0.502307713f},
-std::array<float,2>{0.901994586f, 0.841779232f},
-std::array<float,2>{0.355904907f, 0.469734162f},
-std::array<float,2>{0.810253501f, 0.250551999f},
-std::array<float,2>{0.485504836f, 0.997385263f},
-std::array<float,2>{0.59242475f, 0.635245383f},
-std::array<float,2>{0.193218097f, 0.159707353f},
-std::array<float,2>{0.544657707f, 0.425028384f},
-std::array<float,2>{0.140108436f, 0.780012012f},
-std::array<float,2>{0.836856425f, 0.59536618f},
-std::array<float,2>{0.377181232f, 0.120259926f},
-std::array<float,2>{0.938973248f, 0.240922257f},
-std::array<float,2>{0.304743022f, 0.706997693f},
-std::array<float,2>{0.715646923f, 0.918229878f},
-std::array<float,2>{0.0247182976f, 0.370340586f},
-std::array<float,2>{0.609991968f, 0.13302809f},
-std::array<float,2>{0.243241355f, 0.682190061f},
-std::array<float,2>{0.765994191f, 0.945662618f},
-std::array<float,2>{0.44458729f, 0.303902745f},
-std::array<float,2>{0.917257488f, 0.44939962f},
-std::array<float,2>{0.313104808f, 0.848473787f},
-std::array<float,2>{0.657142341f, 0.544869125f},
-std::array<float,2>{0.0950460434f, 0.044019483f},
-std::array<float,2>{0.728875577f, 0.335121185f},
-std::array<float,2>{0.04071334f, 0.882236242f},
-std::array<float,2>{0.981256247f, 0.747641206f},
-std::array<float,2>{0.278556257f, 0.206240088f},
-std::array<float,2>{0.86162287f, 0.0715992153f},
-std::array<float,2>{0.426219195f, 0.576987684f},
-std::array<float,2>{0.503406525f, 0.781974316f},
-std::array<float,2>{0.174791887f, 0.383157462f},
-std::array<float,2>{0.585157454f, 0.0342477299f},
-std::array<float,2>{0.201947317f, 0.534279585f},
-std::array<float,2>{0.798770308f, 0.857574105f},
-std::array<float,2>{0.499884129f, 0.442619532f},
-std::array<float,2>{0.897895694f, 0.307526559f},
-std::array<float,2>{0.345395267f, 0.941666722f},
-std::array<float,2>{0.654883385f, 0.679458082f},
-std::array<float,2>{0.0739342421f, 0.131262839f},
-std::array<float,2>{0.703729331f, 0.377729803f},
-std::array<float,2>{0.0156712476f, 0.789188385f},
-std::array<float,2>{0.949418724f, 0.567473292f},
-std::array<float,2>{0.297726691f, 0.0691075325f},
-std::array<float,2>{0.830213487f, 0.211872995f},
-std::array<float,2>{0.383586168f, 0.73688513f},
-std::array<float,2>{0.533234477f, 0.883242011f},
-std::array<float,2>{0.12937735f, 0.343685061f},
-std::array<float,2>{0.668405294f, 0.166434854f},
-std::array<float,2>{0.101582147f, 0.625551462f},
-std::array<float,2>{0.906506419f, 0.985846758f},
-std::array<float,2>{0.323170096f, 0.263956815f},
-std::array<float,2>{0.778466821f, 0.480625063f},
-std::array<float,2>{0.45057112f, 0.830007553f},
-std::array<float,2>{0.622253358f, 0.50835228f},
-std::array<float,2>{0.235813916f, 0.00983451772f},
-std::array<float,2>{0.50799197f, 0.364455551f},
-std::array<float,2>{0.180936009f, 0.91076529f},
-std::array<float,2>{0.869276643f, 0.716499329f},
-std::array<float,2>{0.433763027f, 0.247888684f},
-std::array<float,2>{0.969818592f, 0.111216232f},
-std::array<float,2>{0.269857198f, 0.603529751f},
-std::array<float,2>{0.723132193f, 0.772329032f},
-std::array<float,2>{0.0386316851f, 0.437240899f},
-std::array<float,2>{0.749260783f, 0.090995349f},
-std::array<float,2>{0.0553308837f, 0.589569867f},
-std::array<float,2>{0.987659454f, 0.800124049f},
-std::array<float,2>{0.262063861f, 0.391295373f},
-std::array<float,2>{0.858136714f, 0.321346372f},
-std::array<float,2>{0.410941988f, 0.891012907f},
-std::array<float,2>{0.52689606f, 0.732737899f},
-std::array<float,2>{0.169936776f, 0.193179518f},
-std::array<float,2>{0.603254914f, 0.455398321f},
-std::array<float,2>{0.22986488f, 0.867871165f},
-std::array<float,2>{0.759680629f, 0.55919075f},
-std::array<float,2>{0.456070244f, 0.0572123453f},
-std::array<float,2>{0.92753756f, 0.154931635f},
-std::array<float,2>{0.333050042f, 0.658386409f},
-std::array<float,2>{0.683873236f, 0.960279226f},
-std::array<float,2>{0.123576753f, 0.294279486f},
-std::array<float,2>{0.55143553f, 0.219562188f},
-std::array<float,2>{0.14096716f, 0.696969926f},
-std::array<float,2>{0.815123379f, 0.932103634f},
-std::array<float,2>{0.3912462f, 0.3592574f},
-std::array<float,2>{0.958958685f, 0.410517365f},
-std::array<float,2>{0.281965166f, 0.75795871f},
-std::array<float,2>{0.692124128f, 0.615782619f},
-std::array<float,2>{0.00288145267f, 0.0949352086f},
-std::array<float,2>{0.636703372f, 0.274703264f},
-std::array<float,2>{0.0834028646f, 0.973870337f},
-std::array<float,2>{0.881789863f, 0.64337343f},
-std::array<float,2>{0.360152662f, 0.178739712f},
-std::array<float,2>{0.78691262f, 0.02326978f},
-std::array<float,2>{0.483014494f, 0.529270709f},
-std::array<float,2>{0.573302805f, 0.819713891f},
-std::array<float,2>{0.215323642f, 0.490001053f},
-std::array<float,2>{0.563702047f, 0.116547622f},
-std::array<float,2>{0.204900697f, 0.608543575f},
-std::array<float,2>{0.794663131f, 0.768895924f},
-std::array<float,2>{0.470426917f, 0.431178153f},
-std::array<float,2>{0.884801209f, 0.363115698f},
-std::array<float,2>{0.367634177f, 0.90834254f},
-std::array<float,2>{0.626178384f, 0.713088393f},
-std::array<float,2>{0.0889732242f, 0.245696038f},
-std::array<float,2>{0.702020526f, 0.479501665f},
-std::array<float,2>{0.0117938966f, 0.832587302f},
-std::array<float,2>{0.965588987f, 0.511879861f},
-std::array<float,2>{0.290742904f, 0.012500152f},
-std::array<float,2>{0.824639797f, 0.170425653f},
-std::array<float,2>{0.403400958f, 0.632392108f},
-std::array<float,2>{0.559713602f, 0.989552915f},
-std::array<float,2>{0.153707668f, 0.257877022f},
-std::array<float,2>{0.678159356f, 0.216217101f},
-std::array<float,2>{0.117118008f, 0.740884364f},
-std::array<float,2>{0.936754346f, 0.890238345f},
-std::array<float,2>{0.343143702f, 0.339642465f},
-std::array<float,2>{0.752135396f, 0.382192492f},
-std::array<float,2>{0.465508819f, 0.796350241f},
-std::array<float,2>{0.600638151f, 0.562950313f},
-std::array<float,2>{0.223710775f, 0.0659541413f},
-std::array<float,2>{0.523000658f, 0.309580982f},
-std::array<float,2>{0.162270293f, 0.939735413f},
-std::array<float,2>{0.848618507f, 0.674354732f},
-std::array<float,2>{0.418353826f, 0.126338974f},
-std::array<float,2>{0.993630171f, 0.0367023088f},
-std::array<float,2>{0.256994605f, 0.537206531f},
-std::array<float,2>{0.738679826f, 0.85179168f},
-std::array<float,2>{0.0518732518f, 0.439121693f},
-std::array<float,2>{0.731566608f, 0.0170605667f},
-std::array<float,2>{0.0433429554f, 0.523791671f},
-std::array<float,2>{0.978981972f, 0.815534055f},
-std::array<float,2>{0.274015933f, 0.488104165f},
-std::array<float,2>{0.86394465f, 0.278817177f},
-std::array<float,2>{0.424453288f, 0.970597267f},
-std::array<float,2>{0.505920589f, 0.648107052f},
-std::array<float,2>{0.179262444f, 0.173535526f},
-std::array<float,2>{0.616446316f, 0.409064919f},
-std::array<float,2>{0.24798879f, 0.762703717f},
-std::array<float,2>{0.769875944f, 0.611649632f},
-std::array<float,2>{0.43909812f, 0.10029456f},
-std::array<float,2>{0.919011414f, 0.223880559f},
-std::array<float,2>{0.319779575f, 0.702089846f},
-std::array<float,2>{0.663738847f, 0.935878098f},
-std::array<float,2>{0.101265714f, 0.352764457f},
-std::array<float,2>{0.542338729f, 0.149622664f},
-std::array<float,2>{0.134416923f, 0.664016366f},
-std::array<float,2>{0.841331482f, 0.956336319f},
-std::array<float,2>{0.379299015f, 0.291591853f},
-std::array<float,2>{0.945223272f, 0.459100187f},
-std::array<float,2>{0.311086535f, 0.872213602f},
-std::array<float,2>{0.71174103f, 0.555641949f},
-std::array<float,2>{0.0293228943f, 0.0613392778f},
-std::array<float,2>{0.648133576f, 0.327223867f},
-std::array<float,2>{0.0691046938f, 0.898195624f},
-std::array<float,2>{0.904953182f, 0.728310049f},
-std::array<float,2>{0.355217934f, 0.18927069f},
-std::array<float,2>{0.807874084f, 0.0876632854f},
-std::array<float,2>{0.491518199f, 0.591094613f},
-std::array<float,2>{0.586174965f, 0.802217185f},
-std::array<float,2>{0.18927303f, 0.395803094f},
-std::array<float,2>{0.512539387f, 0.0518237203f},
-std::array<float,2>{0.185641229f, 0.546922565f},
-std::array<float,2>{0.873489976f, 0.860707641f},
-std::array<float,2>{0.432770103f, 0.460997432f},
-std::array<float,2>{0.975180089f, 0.285464317f},
-std::array<float,2>{0.26771307f, 0.966540992f},
-std::array<float,2>{0.720603347f, 0.670344353f},
-std::array<float,2>{0.0351063088f, 0.145896286f},
-std::array<float,2>{0.665477276f, 0.403918445f},
-std::array<float,2>{0.108922146f, 0.805459559f},
-std::array<float,2>{0.912875772f, 0.581155598f},
-std::array<float,2>{0.324684143f, 0.085487105f},
-std::array<float,2>{0.77368778f, 0.200497165f},
-std::array<float,2>{0.445883214f, 0.724924684f},
-std::array<float,2>{0.618186057f, 0.903760433f},
-std::array<float,2>{0.241176948f, 0.312849194f},
-std::array<float,2>{0.707595229f, 0.185388982f},
-std::array<float,2>{0.0201203004f, 0.649326265f},
-std::array<float,2>{0.946347952f, 0.980023563f},
-std::array<float,2>{0.302009642f, 0.270319343f},
-std::array<float,2>{0.834062636f, 0.495604873f},
-std::array<float,2>{0.386982918f, 0.827914119f},
-std::array<float,2>{0.538136542f, 0.519577324f},
-std::array<float,2>{0.128329426f, 0.0256214142f},
-std::array<float,2>{0.58143872f, 0.347542733f},
-std::array<float,2>{0.196830437f, 0.925756454f},
-std::array<float,2>{0.80345422f, 0.691589832f},
-std::array<float,2>{0.492741495f, 0.232649311f},
-std::array<float,2>{0.892408073f, 0.107924528f},
-std::array<float,2>{0.349869132f, 0.622732162f},
-std::array<float,2>{0.649449587f, 0.756959915f},
-std::array<float,2>{0.0764652491f, 0.420412689f},
-std::array<float,2>{0.637491167f, 0.0770619139f},
-std::array<float,2>{0.0799141452f, 0.57143718f},
-std::array<float,2>{0.878268898f, 0.78824389f},
-std::array<float,2>{0.365640074f, 0.389377832f},
-std::array<float,2>{0.781976461f, 0.329062939f},
-std::array<float,2>{0.479924142f, 0.876421273f},
-std::array<float,2>{0.577016473f, 0.74263072f},
-std::array<float,2>{0.21286051f, 0.210859418f},
-std::array<float,2>{0.548785388f, 0.446691066f},
-std::array<float,2>{0.146753922f, 0.846872509f},
-std::array<float,2>{0.817016959f, 0.542324007f},
-std::array<float,2>{0.395800918f, 0.0415582247f},
-std::array<float,2>{0.955764949f, 0.140079409f},
-std::array<float,2>{0.285243273f, 0.684589148f},
-std::array<float,2>{0.687767029f, 0.949281871f},
-std::array<float,2>{0.00625570444f, 0.300471604f},
-std::array<float,2>{0.606652021f, 0.23481901f},
-std::array<float,2>{0.23049441f, 0.710622311f},
-std::array<float,2>{0.764269948f, 0.91736871f},
-std::array<float,2>{0.459118426f, 0.373299092f},
-std::array<float,2>{0.92505914f, 0.426877677f},
-std::array<float,2>{0.331638634f, 0.774191141f},
-std::array<float,2>{0.681969821f, 0.598389089f},
-std::array<float,2>{0.120505966f, 0.124848321f},
-std::array<float,2>{0.742344737f, 0.254701793f},
-std::array<float,2>{0.0596491918f, 0.995454967f},
-std::array<float,2>{0.991503179f, 0.637976944f},
-std::array<float,2>{0.258826047f, 0.162498474f},
-std::array<float,2>{0.855149567f, 0.0014557488f},
-std::array<float,2>{0.407121032f, 0.506634295f},
-std::array<float,2>{0.528136432f, 0.836350203f},
-std::array<float,2>{0.165023938f, 0.473647267f},
-std::array<float,2>{0.555354476f, 0.0819602981f},
-std::array<float,2>{0.148955315f, 0.583911538f},
-std::array<float,2>{0.822053134f, 0.812488198f},
-std::array<float,2>{0.401033193f, 0.400488824f},
-std::array<float,2>{0.963202f, 0.317734748f},
-std::array<float,2>{0.296447426f, 0.89852047f},
-std::array<float,2>{0.697210848f, 0.7209602f},
-std::array<float,2>{0.0115272654f, 0.195529401f},
-std::array<float,2>{0.631421566f, 0.465251178f},
-std::array<float,2>{0.0928591564f, 0.863900185f},
-std::array<float,2>{0.888206124f, 0.551335812f},
-std::array<float,2>{0.374678344f, 0.0488572828f},
-std::array<float,2>{0.790263116f, 0.143078148f},
-std::array<float,2>{0.475162476f, 0.667041063f},
-std::array<float,2>{0.569005966f, 0.961997628f},
-std::array<float,2>{0.207829967f, 0.28308937f},
-std::array<float,2>{0.736940682f, 0.226839364f},
-std::array<float,2>{0.0498106889f, 0.69119662f},
-std::array<float,2>{0.996340752f, 0.926638961f},
-std::array<float,2>{0.253397614f, 0.349704087f},
-std::array<float,2>{0.846865475f, 0.415995598f},
-std::array<float,2>{0.416129321f, 0.752842665f},
-std::array<float,2>{0.518251419f, 0.618438661f},
-std::array<float,2>{0.158376366f, 0.104175866f},
-std::array<float,2>{0.593829095f, 0.269034863f},
-std::array<float,2>{0.218847245f, 0.983428657f},
-std::array<float,2>{0.754008114f, 0.653346837f},
-std::array<float,2>{0.462826639f, 0.183575094f},
-std::array<float,2>{0.93303138f, 0.0308287647f},
-std::array<float,2>{0.339637786f, 0.516839445f},
-std::array<float,2>{0.673278213f, 0.822333813f},
-std::array<float,2>{0.110412881f, 0.499104828f},
-std::array<float,2>{0.658641279f, 0.0459047332f},
-std::array<float,2>{0.0974182934f, 0.545205653f},
-std::array<float,2>{0.915284872f, 0.849690199f},
-std::array<float,2>{0.315770984f, 0.452523053f},
-std::array<float,2>{0.767855883f, 0.301030308f},
-std::array<float,2>{0.441987097f, 0.948396742f},
-std::array<float,2>{0.612165213f, 0.680259347f},
-std::array<float,2>{0.244416177f, 0.135896251f},
-std::array<float,2>{0.500504434f, 0.385404736f},
-std::array<float,2>{0.173348233f, 0.783758461f},
-std::array<float,2>{0.860355854f, 0.575711548f},
-std::array<float,2>{0.428590924f, 0.0728030726f},
-std::array<float,2>{0.983712852f, 0.2044992f},
-std::array<float,2>{0.280320764f, 0.74958086f},
-std::array<float,2>{0.727188408f, 0.879924774f},
-std::array<float,2>{0.0426530764f, 0.33320421f},
-std::array<float,2>{0.589911103f, 0.157689467f},
-std::array<float,2>{0.193603158f, 0.633634746f},
-std::array<float,2>{0.812310636f, 0.999583781f},
-std::array<float,2>{0.487323523f, 0.25343582f},
-std::array<float,2>{0.89994961f, 0.472516954f},
-std::array<float,2>{0.35766381f, 0.843254566f},
-std::array<float,2>{0.643784046f, 0.500344694f},
-std::array<float,2>{0.0640198067f, 0.00592220249f},
-std::array<float,2>{0.71712029f, 0.368087918f},
-std::array<float,2>{0.0258852057f, 0.921614528f},
-std::array<float,2>{0.940083325f, 0.704882443f},
-std::array<float,2>{0.307468146f, 0.239186376f},
-std::array<float,2>{0.839101911f, 0.118596293f},
-std::array<float,2>{0.376443505f, 0.596236169f},
-std::array<float,2>{0.546684384f, 0.778145075f},
-std::array<float,2>{0.137574419f, 0.423114717f},
-std::array<float,2>{0.624456823f, 0.00925056823f},
-std::array<float,2>{0.236596838f, 0.510165691f},
-std::array<float,2>{0.780759633f, 0.830385089f},
-std::array<float,2>{0.451359868f, 0.483653575f},
-std::array<float,2>{0.909225464f, 0.262387663f},
-std::array<float,2>{0.321618021f, 0.986543417f},
-std::array<float,2>{0.671280384f, 0.627051055f},
-std::array<float,2>{0.104136899f, 0.164120927f},
-std::array<float,2>{0.72526896f, 0.434249043f},
-std::array<float,2>{0.0358788557f, 0.771439314f},
-std::array<float,2>{0.97195363f, 0.603305578f},
-std::array<float,2>{0.272731274f, 0.112526812f},
-std::array<float,2>{0.867890239f, 0.248628438f},
-std::array<float,2>{0.435624331f, 0.718050838f},
-std::array<float,2>{0.511421621f, 0.912710965f},
-std::array<float,2>{0.18223834f, 0.366146326f},
-std::array<float,2>{0.653545856f, 0.129364043f},
-std::array<float,2>{0.0711590275f, 0.677074969f},
-std::array<float,2>{0.895386457f, 0.94367677f},
-std::array<float,2>{0.347002953f, 0.304741174f},
-std::array<float,2>{0.799967349f, 0.44484508f},
-std::array<float,2>{0.497274488f, 0.855615258f},
-std::array<float,2>{0.582439005f, 0.531370938f},
-std::array<float,2>{0.200759575f, 0.0324985832f},
-std::array<float,2>{0.532677054f, 0.339970052f},
-std::array<float,2>{0.131579161f, 0.885592937f},
-std::array<float,2>{0.82955116f, 0.735378146f},
-std::array<float,2>{0.385539889f, 0.213231385f},
-std::array<float,2>{0.952329457f, 0.0681125298f},
-std::array<float,2>{0.299993813f, 0.570000052f},
-std::array<float,2>{0.706086397f, 0.792324483f},
-std::array<float,2>{0.0190376285f, 0.37536031f},
-std::array<float,2>{0.695174456f, 0.0958747119f},
-std::array<float,2>{0.00127866678f, 0.614291906f},
-std::array<float,2>{0.959744751f, 0.760099351f},
-std::array<float,2>{0.285075217f, 0.412242502f},
-std::array<float,2>{0.813794613f, 0.356249213f},
-std::array<float,2>{0.394312739f, 0.929909825f},
-std::array<float,2>{0.5542081f, 0.698507905f},
-std::array<float,2>{0.14313671f, 0.222585946f},
-std::array<float,2>{0.570739329f, 0.491258204f},
-std::array<float,2>{0.218093112f, 0.818316579f},
-std::array<float,2>{0.788455963f, 0.529695868f},
-std::array<float,2>{0.482336551f, 0.0198298637f},
-std::array<float,2>{0.879700065f, 0.176844999f},
-std::array<float,2>{0.363066614f, 0.641075253f},
-std::array<float,2>{0.633714795f, 0.974869311f},
-std::array<float,2>{0.0844064951f, 0.277016759f},
-std::array<float,2>{0.523445964f, 0.193460763f},
-std::array<float,2>{0.169906095f, 0.73227942f},
-std::array<float,2>{0.856983721f, 0.8932091f},
-std::array<float,2>{0.412924528f, 0.323453099f},
-std::array<float,2>{0.984813273f, 0.394417793f},
-std::array<float,2>{0.264330238f, 0.797314703f},
-std::array<float,2>{0.746538401f, 0.58668083f},
-std::array<float,2>{0.0575842448f, 0.0925033465f},
-std::array<float,2>{0.686087012f, 0.296093822f},
-std::array<float,2>{0.121097341f, 0.958315074f},
-std::array<float,2>{0.928134084f, 0.657343566f},
-std::array<float,2>{0.33479324f, 0.153953835f},
-std::array<float,2>{0.760042191f, 0.0550978407f},
-std::array<float,2>{0.454282761f, 0.560578704f},
-std::array<float,2>{0.604320586f, 0.869990349f},
-std::array<float,2>{0.227578521f, 0.453643173f},
-std::array<float,2>{0.621809125f, 0.11264962f},
-std::array<float,2>{0.234889314f, 0.603266239f},
-std::array<float,2>{0.777777553f, 0.771185875f},
-std::array<float,2>{0.449726552f, 0.434345126f},
-std::array<float,2>{0.907435417f, 0.365750551f},
-std::array<float,2>{0.323885739f, 0.912916362f},
-std::array<float,2>{0.669390321f, 0.717924654f},
-std::array<float,2>{0.103079982f, 0.248868421f},
-std::array<float,2>{0.723651409f, 0.483494431f},
-std::array<float,2>{0.0374247879f, 0.830318809f},
-std::array<float,2>{0.969198704f, 0.509767175f},
-std::array<float,2>{0.270632535f, 0.00896048453f},
-std::array<float,2>{0.870779991f, 0.164536357f},
-std::array<float,2>{0.434800863f, 0.627343297f},
-std::array<float,2>{0.509433746f, 0.986754596f},
-std::array<float,2>{0.179728478f, 0.26262179f},
-std::array<float,2>{0.655969739f, 0.213131741f},
-std::array<float,2>{0.0724642351f, 0.735829294f},
-std::array<float,2>{0.897393882f, 0.885275483f},
-std::array<float,2>{0.344671041f, 0.340103626f},
-std::array<float,2>{0.79699564f, 0.375068516f},
-std::array<float,2>{0.498588473f, 0.792186499f},
-std::array<float,2>{0.584196091f, 0.570304275f},
-std::array<float,2>{0.20261237f, 0.0682216659f},
-std::array<float,2>{0.53512162f, 0.305175692f},
-std::array<float,2>{0.130703285f, 0.943576455f},
-std::array<float,2>{0.831403732f, 0.676969945f},
-std::array<float,2>{0.384741634f, 0.128971457f},
-std::array<float,2>{0.950302541f, 0.0323897265f},
-std::array<float,2>{0.29806751f, 0.531496823f},
-std::array<float,2>{0.704620123f, 0.855950594f},
-std::array<float,2>{0.0175189152f, 0.445307523f},
-std::array<float,2>{0.692601085f, 0.0195647702f},
-std::array<float,2>{0.00361059769f, 0.529481828f},
-std::array<float,2>{0.957407057f, 0.818012953f},
-std::array<float,2>{0.282824248f, 0.491458684f},
-std::array<float,2>{0.816051066f, 0.277330965f},
-std::array<float,2>{0.391856909f, 0.974707305f},
-std::array<float,2>{0.552082717f, 0.64066875f},
-std::array<float,2>{0.142488018f, 0.177063257f},
-std::array<float,2>{0.572710872f, 0.412474155f},
-std::array<float,2>{0.21584706f, 0.759827733f},
-std::array<float,2>{0.786034346f, 0.614740193f},
-std::array<float,2>{0.484105051f, 0.095974803f},
-std::array<float,2>{0.882258892f, 0.22228919f},
-std::array<float,2>{0.361165255f, 0.69838053f},
-std::array<float,2>{0.635400474f, 0.929993212f},
-std::array<float,2>{0.0822146609f, 0.356153548f},
-std::array<float,2>{0.52548933f, 0.15418689f},
-std::array<float,2>{0.171829969f, 0.657518327f},
-std::array<float,2>{0.858565211f, 0.958166659f},
-std::array<float,2>{0.412017137f, 0.29626447f},
-std::array<float,2>{0.986952186f, 0.453857541f},
-std::array<float,2>{0.262758821f, 0.869747102f},
-std::array<float,2>{0.748286903f, 0.560888529f},
-std::array<float,2>{0.0565284453f, 0.0549293868f},
-std::array<float,2>{0.685213447f, 0.323677331f},
-std::array<float,2>{0.12403255f, 0.893414259f},
-std::array<float,2>{0.926651716f, 0.732061565f},
-std::array<float,2>{0.332502902f, 0.193755656f},
-std::array<float,2>{0.758380175f, 0.0925478265f},
-std::array<float,2>{0.456053764f, 0.586531997f},
-std::array<float,2>{0.602208555f, 0.796980321f},
-std::array<float,2>{0.229454622f, 0.394149601f},
-std::array<float,2>{0.557743609f, 0.049303662f},
-std::array<float,2>{0.150471866f, 0.551678002f},
-std::array<float,2>{0.822869837f, 0.864221454f},
-std::array<float,2>{0.399587512f, 0.465008736f},
-std::array<float,2>{0.961085141f, 0.282838225f},
-std::array<float,2>{0.294219285f, 0.962214351f},
-std::array<float,2>{0.698234975f, 0.667358994f},
-std::array<float,2>{0.00967940222f, 0.143502519f},
-std::array<float,2>{0.630443096f, 0.400747508f},
-std::array<float,2>{0.0900603607f, 0.812151909f},
-std::array<float,2>{0.888992906f, 0.583738625f},
-std::array<float,2>{0.372630626f, 0.0817759633f},
-std::array<float,2>{0.791583121f, 0.195602417f},
-std::array<float,2>{0.474306196f, 0.720803559f},
-std::array<float,2>{0.568133056f, 0.898711681f},
-std::array<float,2>{0.209244654f, 0.317425042f},
-std::array<float,2>{0.735334814f, 0.183315188f},
-std::array<float,2>{0.0476284362f, 0.653727472f},
-std::array<float,2>{0.999693394f, 0.983866453f},
-std::array<float,2>{0.250486523f, 0.268702537f},
-std::array<float,2>{0.844272733f, 0.499478936f},
-std::array<float,2>{0.414457679f, 0.822541833f},
-std::array<float,2>{0.51735723f, 0.516981542f},
-std::array<float,2>{0.156773239f, 0.0312013067f},
-std::array<float,2>{0.596873105f, 0.34990105f},
-std::array<float,2>{0.220925063f, 0.926337719f},
-std::array<float,2>{0.757626116f, 0.690958977f},
-std::array<float,2>{0.463592052f, 0.226721406f},
-std::array<float,2>{0.9307248f, 0.104360431f},
-std::array<float,2>{0.336546212f, 0.618197262f},
-std::array<float,2>{0.673885465f, 0.752495527f},
-std::array<float,2>{0.111810006f, 0.415663481f},
-std::array<float,2>{0.658071697f, 0.0731797963f},
-std::array<float,2>{0.0945915654f, 0.575993657f},
-std::array<float,2>{0.916554749f, 0.783955216f},
-std::array<float,2>{0.313527584f, 0.385560393f},
-std::array<float,2>{0.76709801f, 0.333374739f},
-std::array<float,2>{0.444141448f, 0.880272388f},
-std::array<float,2>{0.610855639f, 0.749914944f},
-std::array<float,2>{0.242915243f, 0.204297021f},
-std::array<float,2>{0.502443194f, 0.452177167f},
-std::array<float,2>{0.175395608f, 0.849895716f},
-std::array<float,2>{0.862864852f, 0.544956744f},
-std::array<float,2>{0.427643448f, 0.0463270582f},
-std::array<float,2>{0.981447935f, 0.136059791f},
-std::array<float,2>{0.278167069f, 0.680543423f},
-std::array<float,2>{0.730384409f, 0.948644578f},
-std::array<float,2>{0.0392812788f, 0.301010698f},
-std::array<float,2>{0.59279567f, 0.238902569f},
-std::array<float,2>{0.191664711f, 0.704735219f},
-std::array<float,2>{0.80948329f, 0.921771049f},
-std::array<float,2>{0.485150725f, 0.367693365f},
-std::array<float,2>{0.900593042f, 0.423008054f},
-std::array<float,2>{0.356703371f, 0.77790308f},
-std::array<float,2>{0.642522156f, 0.596557498f},
-std::array<float,2>{0.0644692183f, 0.118396588f},
-std::array<float,2>{0.716760278f, 0.2537359f},
-std::array<float,2>{0.0239896886f, 0.999853909f},
-std::array<float,2>{0.937704802f, 0.633413613f},
-std::array<float,2>{0.306583315f, 0.157298714f},
-std::array<float,2>{0.837273598f, 0.00611904124f},
-std::array<float,2>{0.378525674f, 0.500111401f},
-std::array<float,2>{0.543137372f, 0.842948556f},
-std::array<float,2>{0.139601588f, 0.472376049f},
-std::array<float,2>{0.515037179f, 0.0859045535f},
-std::array<float,2>{0.185352564f, 0.581367791f},
-std::array<float,2>{0.871252358f, 0.805339813f},
-std::array<float,2>{0.431289554f, 0.404277056f},
-std::array<float,2>{0.974559665f, 0.312731564f},
-std::array<float,2>{0.267345756f, 0.903562188f},
-std::array<float,2>{0.72231704f, 0.724705994f},
-std::array<float,2>{0.0323414765f, 0.200276583f},
-std::array<float,2>{0.66650337f, 0.461244136f},
-std::array<float,2>{0.106754035f, 0.860474944f},
-std::array<float,2>{0.910388589f, 0.547296047f},
-std::array<float,2>{0.327082127f, 0.0520736203f},
-std::array<float,2>{0.776988745f, 0.145701423f},
-std::array<float,2>{0.447749913f, 0.669975936f},
-std::array<float,2>{0.620857835f, 0.966715634f},
-std::array<float,2>{0.239140958f, 0.285331547f},
-std::array<float,2>{0.709090352f, 0.232811242f},
-std::array<float,2>{0.0233201869f, 0.691664994f},
-std::array<float,2>{0.947750628f, 0.925403833f},
-std::array<float,2>{0.303690076f, 0.347320735f},
-std::array<float,2>{0.833151758f, 0.420691937f},
-std::array<float,2>{0.389796406f, 0.757142127f},
-std::array<float,2>{0.53537786f, 0.622979105f},
-std::array<float,2>{0.126053005f, 0.108340792f},
-std::array<float,2>{0.579343617f, 0.27022323f},
-std::array<float,2>{0.198065788f, 0.980352163f},
-std::array<float,2>{0.801316738f, 0.64907676f},
-std::array<float,2>{0.495976567f, 0.185184479f},
-std::array<float,2>{0.893905818f, 0.0258415751f},
-std::array<float,2>{0.347948432f, 0.519909739f},
-std::array<float,2>{0.651406586f, 0.827865064f},
-std::array<float,2>{0.0748973936f, 0.495173812f},
-std::array<float,2>{0.63950181f, 0.0419359691f},
-std::array<float,2>{0.081420213f, 0.54205066f},
-std::array<float,2>{0.875663042f, 0.847043753f},
-std::array<float,2>{0.364422053f, 0.44628948f},
-std::array<float,2>{0.783944786f, 0.300556064f},
-std::array<float,2>{0.477299601f, 0.949496329f},
-std::array<float,2>{0.57473284f, 0.684878588f},
-std::array<float,2>{0.213858306f, 0.139669597f},
-std::array<float,2>{0.549879491f, 0.3895998f},
-std::array<float,2>{0.144839376f, 0.788338006f},
-std::array<float,2>{0.819927096f, 0.571776628f},
-std::array<float,2>{0.397362381f, 0.076892145f},
-std::array<float,2>{0.954042017f, 0.210499421f},
-std::array<float,2>{0.287537873f, 0.742276132f},
-std::array<float,2>{0.689711213f, 0.876219451f},
-std::array<float,2>{0.00564334961f, 0.328739196f},
-std::array<float,2>{0.608837903f, 0.162289545f},
-std::array<float,2>{0.234128937f, 0.637705147f},
-std::array<float,2>{0.762555897f, 0.995285749f},
-std::array<float,2>{0.458041042f, 0.254409164f},
-std::array<float,2>{0.923805356f, 0.473991841f},
-std::array<float,2>{0.329169273f, 0.836093366f},
-std::array<float,2>{0.679938018f, 0.50643748f},
-std::array<float,2>{0.117427252f, 0.00102636148f},
-std::array<float,2>{0.74543649f, 0.373286039f},
-std::array<float,2>{0.0621728748f, 0.917052329f},
-std::array<float,2>{0.988621175f, 0.710840702f},
-std::array<float,2>{0.260466486f, 0.234422877f},
-std::array<float,2>{0.852229476f, 0.1247482f},
-std::array<float,2>{0.409992009f, 0.598195493f},
-std::array<float,2>{0.530537069f, 0.773953378f},
-std::array<float,2>{0.166992247f, 0.427042991f},
-std::array<float,2>{0.56513375f, 0.0122407591f},
-std::array<float,2>{0.205825225f, 0.512189507f},
-std::array<float,2>{0.79615742f, 0.832879007f},
-std::array<float,2>{0.472561568f, 0.479804575f},
-std::array<float,2>{0.883833706f, 0.258251846f},
-std::array<float,2>{0.370473444f, 0.989392221f},
-std::array<float,2>{0.627624452f, 0.632576048f},
-std::array<float,2>{0.0861820355f, 0.170773983f},
-std::array<float,2>{0.700889826f, 0.431553304f},
-std::array<float,2>{0.015179392f, 0.768616557f},
-std::array<float,2>{0.967024565f, 0.608763158f},
-std::array<float,2>{0.292153448f, 0.116326459f},
-std::array<float,2>{0.826359808f, 0.246078953f},
-std::array<float,2>{0.405981064f, 0.713259161f},
-std::array<float,2>{0.560918868f, 0.90845865f},
-std::array<float,2>{0.154404521f, 0.362832248f},
-std::array<float,2>{0.677039564f, 0.12616539f},
-std::array<float,2>{0.114050537f, 0.674673021f},
-std::array<float,2>{0.933736801f, 0.939577103f},
-std::array<float,2>{0.3403804f, 0.3099567f},
-std::array<float,2>{0.751075208f, 0.439225078f},
-std::array<float,2>{0.466845572f, 0.851863146f},
-std::array<float,2>{0.597791255f, 0.537499428f},
-std::array<float,2>{0.226237565f, 0.0369708017f},
-std::array<float,2>{0.520582736f, 0.339560866f},
-std::array<float,2>{0.161975384f, 0.890610278f},
-std::array<float,2>{0.850371957f, 0.741091132f},
-std::array<float,2>{0.420903921f, 0.215867952f},
-std::array<float,2>{0.994251847f, 0.0661779568f},
-std::array<float,2>{0.254258037f, 0.562665403f},
-std::array<float,2>{0.741300404f, 0.796139479f},
-std::array<float,2>{0.0545325242f, 0.382056952f},
-std::array<float,2>{0.732740939f, 0.100579426f},
-std::array<float,2>{0.0452846214f, 0.611504436f},
-std::array<float,2>{0.977279782f, 0.763048351f},
-std::array<float,2>{0.27544868f, 0.408743113f},
-std::array<float,2>{0.866236806f, 0.352960289f},
-std::array<float,2>{0.421996802f, 0.935780406f},
-std::array<float,2>{0.505066395f, 0.701674342f},
-std::array<float,2>{0.176967457f, 0.223802194f},
-std::array<float,2>{0.6144135f, 0.487960994f},
-std::array<float,2>{0.249577135f, 0.815790653f},
-std::array<float,2>{0.772539914f, 0.523468018f},
-std::array<float,2>{0.440973163f, 0.0167751871f},
-std::array<float,2>{0.921867609f, 0.173676521f},
-std::array<float,2>{0.316536427f, 0.648354709f},
-std::array<float,2>{0.660187006f, 0.970294118f},
-std::array<float,2>{0.0990565047f, 0.279171854f},
-std::array<float,2>{0.539168775f, 0.189173996f},
-std::array<float,2>{0.135763466f, 0.728132367f},
-std::array<float,2>{0.842624247f, 0.898140311f},
-std::array<float,2>{0.381040484f, 0.32744813f},
-std::array<float,2>{0.942424059f, 0.395690471f},
-std::array<float,2>{0.309385538f, 0.801903605f},
-std::array<float,2>{0.713171959f, 0.590917528f},
-std::array<float,2>{0.0291069131f, 0.0876324847f},
-std::array<float,2>{0.64573586f, 0.291950494f},
-std::array<float,2>{0.0682023913f, 0.956184566f},
-std::array<float,2>{0.904287875f, 0.663632989f},
-std::array<float,2>{0.352010608f, 0.149740592f},
-std::array<float,2>{0.805553615f, 0.0610923357f},
-std::array<float,2>{0.488642663f, 0.555180669f},
-std::array<float,2>{0.589587927f, 0.87245971f},
-std::array<float,2>{0.191248402f, 0.459433258f},
-std::array<float,2>{0.583037198f, 0.0689575821f},
-std::array<float,2>{0.199300051f, 0.567806244f},
-std::array<float,2>{0.799119592f, 0.789468467f},
-std::array<float,2>{0.496987075f, 0.37758413f},
-std::array<float,2>{0.896077156f, 0.34345746f},
-std::array<float,2>{0.346347928f, 0.88281697f},
-std::array<float,2>{0.652852654f, 0.737298667f},
-std::array<float,2>{0.0720330849f, 0.211659491f},
-std::array<float,2>{0.705319822f, 0.442769408f},
-std::array<float,2>{0.0177759044f, 0.857691586f},
-std::array<float,2>{0.952058315f, 0.534463465f},
-std::array<float,2>{0.299453318f, 0.0345987156f},
-std::array<float,2>{0.82887435f, 0.131065413f},
-std::array<float,2>{0.385994792f, 0.679401517f},
-std::array<float,2>{0.531658173f, 0.94143492f},
-std::array<float,2>{0.132207274f, 0.307162642f},
-std::array<float,2>{0.670546412f, 0.247703865f},
-std::array<float,2>{0.104493499f, 0.716779888f},
-std::array<float,2>{0.908969343f, 0.911051691f},
-std::array<float,2>{0.320325822f, 0.364737153f},
-std::array<float,2>{0.779782534f, 0.437499106f},
-std::array<float,2>{0.452520162f, 0.772032142f},
-std::array<float,2>{0.623381317f, 0.603974581f},
-std::array<float,2>{0.237348855f, 0.111023575f},
-std::array<float,2>{0.510403812f, 0.263776928f},
-std::array<float,2>{0.183183387f, 0.986242771f},
-std::array<float,2>{0.86825937f, 0.625893891f},
-std::array<float,2>{0.437452734f, 0.166234657f},
-std::array<float,2>{0.971449435f, 0.0101957712f},
-std::array<float,2>{0.272151828f, 0.508776605f},
-std::array<float,2>{0.726165712f, 0.829680324f},
-std::array<float,2>{0.0363787562f, 0.480794132f},
-std::array<float,2>{0.747299314f, 0.0573853441f},
-std::array<float,2>{0.0582351647f, 0.559488356f},
-std::array<float,2>{0.985733449f, 0.868155062f},
-std::array<float,2>{0.265588701f, 0.455147564f},
-std::array<float,2>{0.856326163f, 0.294079691f},
-std::array<float,2>{0.413606256f, 0.959997594f},
-std::array<float,2>{0.524755001f, 0.658520341f},
-std::array<float,2>{0.168093145f, 0.155039862f},
-std::array<float,2>{0.604596317f, 0.391477317f},
-std::array<float,2>{0.227188021f, 0.799826562f},
-std::array<float,2>{0.760941148f, 0.589681804f},
-std::array<float,2>{0.453623086f, 0.0912085697f},
-std::array<float,2>{0.92894882f, 0.193030015f},
-std::array<float,2>{0.335411012f, 0.732493043f},
-std::array<float,2>{0.687059164f, 0.890761375f},
-std::array<float,2>{0.122488387f, 0.321578324f},
-std::array<float,2>{0.553633869f, 0.179137036f},
-std::array<float,2>{0.143643469f, 0.643197715f},
-std::array<float,2>{0.812551856f, 0.973899662f},
-std::array<float,2>{0.393396258f, 0.274546981f},
-std::array<float,2>{0.96078527f, 0.489845216f},
-std::array<float,2>{0.283633739f, 0.819559813f},
-std::array<float,2>{0.69396925f, 0.529043794f},
-std::array<float,2>{0.000475801062f, 0.0230300091f},
-std::array<float,2>{0.634244919f, 0.358942568f},
-std::array<float,2>{0.0853143632f, 0.9318645f},
-std::array<float,2>{0.879934847f, 0.697114587f},
-std::array<float,2>{0.361541748f, 0.219258711f},
-std::array<float,2>{0.787174881f, 0.0951863229f},
-std::array<float,2>{0.481208146f, 0.616068602f},
-std::array<float,2>{0.572012186f, 0.758163869f},
-std::array<float,2>{0.217421457f, 0.410365075f},
-std::array<float,2>{0.51868403f, 0.0282485168f},
-std::array<float,2>{0.159347698f, 0.518254817f},
-std::array<float,2>{0.846110761f, 0.820994616f},
-std::array<float,2>{0.417567164f, 0.497428656f},
-std::array<float,2>{0.997566104f, 0.267235726f},
-std::array<float,2>{0.252905339f, 0.982191086f},
-std::array<float,2>{0.73745513f, 0.655803084f},
-std::array<float,2>{0.0496224128f, 0.180402651f},
-std::array<float,2>{0.672819197f, 0.417682648f},
-std::array<float,2>{0.109448873f, 0.750189006f},
-std::array<float,2>{0.932447314f, 0.620586455f},
-std::array<float,2>{0.338727713f, 0.103417605f},
-std::array<float,2>{0.755085588f, 0.228704169f},
-std::array<float,2>{0.461767137f, 0.68854171f},
-std::array<float,2>{0.59513551f, 0.929627895f},
-std::array<float,2>{0.220024735f, 0.348343134f},
-std::array<float,2>{0.696002305f, 0.141522169f},
-std::array<float,2>{0.0104051055f, 0.665448785f},
-std::array<float,2>{0.964328766f, 0.964704812f},
-std::array<float,2>{0.295561552f, 0.284237504f},
-std::array<float,2>{0.820957601f, 0.467755705f},
-std::array<float,2>{0.401724011f, 0.866484165f},
-std::array<float,2>{0.555692315f, 0.552822649f},
-std::array<float,2>{0.149576977f, 0.0486747697f},
-std::array<float,2>{0.570065916f, 0.319866598f},
-std::array<float,2>{0.208813548f, 0.90082562f},
-std::array<float,2>{0.789801478f, 0.720220387f},
-std::array<float,2>{0.475695908f, 0.198752865f},
-std::array<float,2>{0.887413263f, 0.0785367787f},
-std::array<float,2>{0.373401701f, 0.585451543f},
-std::array<float,2>{0.632249773f, 0.809934258f},
-std::array<float,2>{0.0919500068f, 0.399675578f},
-std::array<float,2>{0.643289387f, 0.120364733f},
-std::array<float,2>{0.0632660389f, 0.595544934f},
-std::array<float,2>{0.898822367f, 0.78017199f},
-std::array<float,2>{0.358655959f, 0.425140202f},
-std::array<float,2>{0.811269104f, 0.370588928f},
-std::array<float,2>{0.486736953f, 0.918105125f},
-std::array<float,2>{0.590830445f, 0.70669961f},
-std::array<float,2>{0.194536462f, 0.24115549f},
-std::array<float,2>{0.545384884f, 0.470160484f},
-std::array<float,2>{0.138570875f, 0.841349781f},
-std::array<float,2>{0.837909102f, 0.501971185f},
-std::array<float,2>{0.375842452f, 0.00402822206f},
-std::array<float,2>{0.94125694f, 0.160069585f},
-std::array<float,2>{0.307988614f, 0.634888709f},
-std::array<float,2>{0.718733072f, 0.997131228f},
-std::array<float,2>{0.0267872307f, 0.250965804f},
-std::array<float,2>{0.612402499f, 0.206392333f},
-std::array<float,2>{0.245210513f, 0.747961164f},
-std::array<float,2>{0.768789828f, 0.881972492f},
-std::array<float,2>{0.442532659f, 0.335291266f},
-std::array<float,2>{0.914616942f, 0.382880479f},
-std::array<float,2>{0.31496945f, 0.782108486f},
-std::array<float,2>{0.659592211f, 0.576866031f},
-std::array<float,2>{0.0962620601f, 0.0714357197f},
-std::array<float,2>{0.728369653f, 0.304036796f},
-std::array<float,2>{0.0418938138f, 0.945409417f},
-std::array<float,2>{0.983356178f, 0.682474315f},
-std::array<float,2>{0.280197561f, 0.1332452f},
-std::array<float,2>{0.859623134f, 0.0442827977f},
-std::array<float,2>{0.428819478f, 0.544572175f},
-std::array<float,2>{0.501302481f, 0.848310769f},
-std::array<float,2>{0.172357097f, 0.449568063f},
-std::array<float,2>{0.537182868f, 0.105627514f},
-std::array<float,2>{0.127345428f, 0.624438584f},
-std::array<float,2>{0.835363269f, 0.755487025f},
-std::array<float,2>{0.388498962f, 0.419360191f},
-std::array<float,2>{0.945434868f, 0.344780743f},
-std::array<float,2>{0.30168879f, 0.923092186f},
-std::array<float,2>{0.708184302f, 0.694971502f},
-std::array<float,2>{0.0208197758f, 0.231542647f},
-std::array<float,2>{0.649380326f, 0.492240518f},
-std::array<float,2>{0.0773428828f, 0.825255871f},
-std::array<float,2>{0.891534269f, 0.521807253f},
-std::array<float,2>{0.351262987f, 0.0237811282f},
-std::array<float,2>{0.804044425f, 0.1868148f},
-std::array<float,2>{0.493841231f, 0.651681125f},
-std::array<float,2>{0.580911934f, 0.978150129f},
-std::array<float,2>{0.196268111f, 0.272656411f},
-std::array<float,2>{0.719623864f, 0.201187983f},
-std::array<float,2>{0.0335725583f, 0.72453326f},
-std::array<float,2>{0.975595832f, 0.905118048f},
-std::array<float,2>{0.269314051f, 0.314759135f},
-std::array<float,2>{0.87406832f, 0.405050516f},
-std::array<float,2>{0.432005435f, 0.8078053f},
-std::array<float,2>{0.513616502f, 0.579636395f},
-std::array<float,2>{0.186821729f, 0.0839240029f},
-std::array<float,2>{0.617810905f, 0.287925899f},
-std::array<float,2>{0.241891041f, 0.96688652f},
-std::array<float,2>{0.774650872f, 0.668382347f},
-std::array<float,2>{0.446346343f, 0.14816241f},
-std::array<float,2>{0.913666129f, 0.0541997701f},
-std::array<float,2>{0.325823218f, 0.549202859f},
-std::array<float,2>{0.664469957f, 0.862516344f},
-std::array<float,2>{0.107599601f, 0.464713305f},
-std::array<float,2>{0.682658195f, 0.00316259963f},
-std::array<float,2>{0.119816683f, 0.505745053f},
-std::array<float,2>{0.924565256f, 0.838488996f},
-std::array<float,2>{0.330784589f, 0.474778712f},
-std::array<float,2>{0.764900863f, 0.257429451f},
-std::array<float,2>{0.460653007f, 0.992225647f},
-std::array<float,2>{0.605749488f, 0.638976574f},
-std::array<float,2>{0.232339412f, 0.160707667f},
-std::array<float,2>{0.529128313f, 0.428812653f},
-std::array<float,2>{0.165797114f, 0.777215719f},
-std::array<float,2>{0.853950679f, 0.600540519f},
-std::array<float,2>{0.407434046f, 0.12224286f},
-std::array<float,2>{0.990939975f, 0.238129258f},
-std::array<float,2>{0.258157372f, 0.707068145f},
-std::array<float,2>{0.743165135f, 0.914597809f},
-std::array<float,2>{0.0588488169f, 0.37177676f},
-std::array<float,2>{0.577972174f, 0.138472944f},
-std::array<float,2>{0.211695343f, 0.686127961f},
-std::array<float,2>{0.782310784f, 0.95130378f},
-std::array<float,2>{0.479447454f, 0.298490256f},
-std::array<float,2>{0.877543747f, 0.44846788f},
-std::array<float,2>{0.366806984f, 0.844262719f},
-std::array<float,2>{0.638108492f, 0.539108455f},
-std::array<float,2>{0.0787456483f, 0.0399157181f},
-std::array<float,2>{0.688737929f, 0.33027634f},
-std::array<float,2>{0.00693093101f, 0.877168417f},
-std::array<float,2>{0.956320107f, 0.744275928f},
-std::array<float,2>{0.28647244f, 0.207850635f},
-std::array<float,2>{0.817414165f, 0.0743980929f},
-std::array<float,2>{0.395386159f, 0.572396576f},
-std::array<float,2>{0.547178209f, 0.786381125f},
-std::array<float,2>{0.148253769f, 0.387505144f},
-std::array<float,2>{0.599850118f, 0.0373704918f},
-std::array<float,2>{0.223507985f, 0.535658062f},
-std::array<float,2>{0.753020585f, 0.854517758f},
-std::array<float,2>{0.466656476f, 0.44085905f},
-std::array<float,2>{0.935640335f, 0.311579823f},
-std::array<float,2>{0.341931313f, 0.939421237f},
-std::array<float,2>{0.678885639f, 0.672156274f},
-std::array<float,2>{0.115455568f, 0.12797451f},
-std::array<float,2>{0.739986241f, 0.380526006f},
-std::array<float,2>{0.0516607463f, 0.793796241f},
-std::array<float,2>{0.992905259f, 0.56629622f},
-std::array<float,2>{0.256054133f, 0.0631972849f},
-std::array<float,2>{0.848673046f, 0.218507558f},
-std::array<float,2>{0.419481575f, 0.738548458f},
-std::array<float,2>{0.522016048f, 0.888068378f},
-std::array<float,2>{0.163843796f, 0.336843401f},
-std::array<float,2>{0.625938714f, 0.168149903f},
-std::array<float,2>{0.0883189887f, 0.63058424f},
-std::array<float,2>{0.885873199f, 0.990947664f},
-std::array<float,2>{0.368707657f, 0.260200113f},
-std::array<float,2>{0.793366313f, 0.477593362f},
-std::array<float,2>{0.469204873f, 0.835092604f},
-std::array<float,2>{0.562719107f, 0.513683498f},
-std::array<float,2>{0.203252062f, 0.0146881416f},
-std::array<float,2>{0.558820069f, 0.360357195f},
-std::array<float,2>{0.153031245f, 0.907880843f},
-std::array<float,2>{0.825836599f, 0.711418569f},
-std::array<float,2>{0.402801305f, 0.243870988f},
-std::array<float,2>{0.966624141f, 0.113692842f},
-std::array<float,2>{0.28910768f, 0.605833352f},
-std::array<float,2>{0.702392519f, 0.766571522f},
-std::array<float,2>{0.0135777732f, 0.432900161f},
-std::array<float,2>{0.712683022f, 0.0881011263f},
-std::array<float,2>{0.0310106836f, 0.592522025f},
-std::array<float,2>{0.943749607f, 0.804471016f},
-std::array<float,2>{0.311760664f, 0.397298217f},
-std::array<float,2>{0.840528488f, 0.325842291f},
-std::array<float,2>{0.380270272f, 0.894960701f},
-std::array<float,2>{0.541286588f, 0.729288876f},
-std::array<float,2>{0.133525878f, 0.189877599f},
-std::array<float,2>{0.587739527f, 0.45818004f},
-std::array<float,2>{0.188079014f, 0.873271048f},
-std::array<float,2>{0.807522893f, 0.55722928f},
-std::array<float,2>{0.490268856f, 0.0586967729f},
-std::array<float,2>{0.90528667f, 0.152030468f},
-std::array<float,2>{0.354063869f, 0.660394847f},
-std::array<float,2>{0.647029221f, 0.954085708f},
-std::array<float,2>{0.0699889436f, 0.290502101f},
-std::array<float,2>{0.507631063f, 0.225470409f},
-std::array<float,2>{0.177859545f, 0.69950372f},
-std::array<float,2>{0.865101039f, 0.934217393f},
-std::array<float,2>{0.425501496f, 0.353717864f},
-std::array<float,2>{0.979713142f, 0.407622755f},
-std::array<float,2>{0.274968177f, 0.76553154f},
-std::array<float,2>{0.731197178f, 0.610508382f},
-std::array<float,2>{0.0439604446f, 0.0994255468f},
-std::array<float,2>{0.662196934f, 0.280171961f},
-std::array<float,2>{0.0997612104f, 0.972068846f},
-std::array<float,2>{0.918936372f, 0.646110356f},
-std::array<float,2>{0.318836212f, 0.174345151f},
-std::array<float,2>{0.771432757f, 0.0189456381f},
-std::array<float,2>{0.437725157f, 0.52549094f},
-std::array<float,2>{0.615894318f, 0.812603354f},
-std::array<float,2>{0.246872038f, 0.485825986f},
-std::array<float,2>{0.60263443f, 0.0900454149f},
-std::array<float,2>{0.230154037f, 0.588424802f},
-std::array<float,2>{0.759133279f, 0.799156487f},
-std::array<float,2>{0.456933975f, 0.392553091f},
-std::array<float,2>{0.926930726f, 0.320353091f},
-std::array<float,2>{0.333574533f, 0.892443955f},
-std::array<float,2>{0.684132338f, 0.733977675f},
-std::array<float,2>{0.12330541f, 0.191439912f},
-std::array<float,2>{0.749593198f, 0.456908345f},
-std::array<float,2>{0.0549124517f, 0.868377686f},
-std::array<float,2>{0.987794816f, 0.560453117f},
-std::array<float,2>{0.262416422f, 0.0584267974f},
-std::array<float,2>{0.857701361f, 0.155334085f},
-std::array<float,2>{0.410299897f, 0.659567297f},
-std::array<float,2>{0.526691437f, 0.959364653f},
-std::array<float,2>{0.170825526f, 0.293513298f},
-std::array<float,2>{0.635856032f, 0.220267087f},
-std::array<float,2>{0.0837805942f, 0.695858419f},
-std::array<float,2>{0.880909622f, 0.933191419f},
-std::array<float,2>{0.35943827f, 0.357621759f},
-std::array<float,2>{0.786228359f, 0.411773831f},
-std::array<float,2>{0.482716262f, 0.759103477f},
-std::array<float,2>{0.574082494f, 0.617135048f},
-std::array<float,2>{0.215655163f, 0.0937509537f},
-std::array<float,2>{0.55089885f, 0.273931205f},
-std::array<float,2>{0.141470581f, 0.973152637f},
-std::array<float,2>{0.814464033f, 0.643567681f},
-std::array<float,2>{0.390842319f, 0.177964732f},
-std::array<float,2>{0.958222985f, 0.0216386188f},
-std::array<float,2>{0.281636924f, 0.527768254f},
-std::array<float,2>{0.691741228f, 0.818461776f},
-std::array<float,2>{0.00215776335f, 0.488590449f},
-std::array<float,2>{0.703512311f, 0.0338612385f},
-std::array<float,2>{0.0163974166f, 0.533916175f},
-std::array<float,2>{0.950033844f, 0.859243572f},
-std::array<float,2>{0.297142833f, 0.442125291f},
-std::array<float,2>{0.830838144f, 0.307987392f},
-std::array<float,2>{0.382857263f, 0.943280816f},
-std::array<float,2>{0.534004867f, 0.678103507f},
-std::array<float,2>{0.129458651f, 0.132498533f},
-std::array<float,2>{0.58558625f, 0.378761381f},
-std::array<float,2>{0.201577216f, 0.790923774f},
-std::array<float,2>{0.797888637f, 0.566741228f},
-std::array<float,2>{0.499194264f, 0.0698372051f},
-std::array<float,2>{0.898200572f, 0.212376028f},
-std::array<float,2>{0.34481287f, 0.737983644f},
-std::array<float,2>{0.654606402f, 0.884450853f},
-std::array<float,2>{0.0734989345f, 0.342580318f},
-std::array<float,2>{0.508345425f, 0.167075545f},
-std::array<float,2>{0.181591853f, 0.626879454f},
-std::array<float,2>{0.870050192f, 0.985142827f},
-std::array<float,2>{0.434130341f, 0.265460521f},
-std::array<float,2>{0.97021842f, 0.482200146f},
-std::array<float,2>{0.270134658f, 0.828202546f},
-std::array<float,2>{0.723279476f, 0.50919348f},
-std::array<float,2>{0.0384499244f, 0.0111139892f},
-std::array<float,2>{0.668860137f, 0.364063919f},
-std::array<float,2>{0.102360062f, 0.9111709f},
-std::array<float,2>{0.906764746f, 0.715028882f},
-std::array<float,2>{0.322558165f, 0.246714339f},
-std::array<float,2>{0.77893126f, 0.11013671f},
-std::array<float,2>{0.450834811f, 0.604805291f},
-std::array<float,2>{0.62269187f, 0.772639751f},
-std::array<float,2>{0.236058518f, 0.436464638f},
-std::array<float,2>{0.544297695f, 0.00585369766f},
-std::array<float,2>{0.140300095f, 0.503504038f},
-std::array<float,2>{0.836047769f, 0.840798318f},
-std::array<float,2>{0.377726853f, 0.469485253f},
-std::array<float,2>{0.938583851f, 0.251179636f},
-std::array<float,2>{0.305547774f, 0.99650228f},
-std::array<float,2>{0.715126038f, 0.636689603f},
-std::array<float,2>{0.0249982402f, 0.158299536f},
-std::array<float,2>{0.641580522f, 0.424563408f},
-std::array<float,2>{0.0662977919f, 0.781249523f},
-std::array<float,2>{0.901471972f, 0.593803704f},
-std::array<float,2>{0.356111288f, 0.119718283f},
-std::array<float,2>{0.810037553f, 0.241367444f},
-std::array<float,2>{0.486118436f, 0.705755949f},
-std::array<float,2>{0.592007399f, 0.919291735f},
-std::array<float,2>{0.192392841f, 0.369609565f},
-std::array<float,2>{0.729135334f, 0.134307414f},
-std::array<float,2>{0.0401258469f, 0.682731867f},
-std::array<float,2>{0.980937183f, 0.94707787f},
-std::array<float,2>{0.279292524f, 0.303515136f},
-std::array<float,2>{0.862058401f, 0.450365216f},
-std::array<float,2>{0.426749289f, 0.849461317f},
-std::array<float,2>{0.503734112f, 0.543649077f},
-std::array<float,2>{0.173995882f, 0.0430584252f},
-std::array<float,2>{0.609829605f, 0.334516674f},
-std::array<float,2>{0.243927568f, 0.881573319f},
-std::array<float,2>{0.766508639f, 0.746925831f},
-std::array<float,2>{0.445054084f, 0.205128118f},
-std::array<float,2>{0.917847216f, 0.070698224f},
-std::array<float,2>{0.312953234f, 0.577584922f},
-std::array<float,2>{0.656671584f, 0.782621264f},
-std::array<float,2>{0.095242247f, 0.384268761f},
-std::array<float,2>{0.675663114f, 0.101660557f},
-std::array<float,2>{0.112678438f, 0.619778395f},
-std::array<float,2>{0.9300825f, 0.751166105f},
-std::array<float,2>{0.337666571f, 0.416108906f},
-std::array<float,2>{0.756736636f, 0.348661333f},
-std::array<float,2>{0.463873088f, 0.927805245f},
-std::array<float,2>{0.596259177f, 0.687773585f},
-std::array<float,2>{0.221984759f, 0.229535088f},
-std::array<float,2>{0.516556919f, 0.496726781f},
-std::array<float,2>{0.15819943f, 0.822177708f},
-std::array<float,2>{0.845589519f, 0.518817306f},
-std::array<float,2>{0.415591657f, 0.0287451353f},
-std::array<float,2>{0.998845041f, 0.180836737f},
-std::array<float,2>{0.251606792f, 0.654647291f},
-std::array<float,2>{0.735908151f, 0.981221735f},
-std::array<float,2>{0.0480762273f, 0.266520232f},
-std::array<float,2>{0.566513479f, 0.198183179f},
-std::array<float,2>{0.21008423f, 0.719690323f},
-std::array<float,2>{0.792140305f, 0.901579738f},
-std::array<float,2>{0.472799331f, 0.319054186f},
-std::array<float,2>{0.890168786f, 0.398655564f},
-std::array<float,2>{0.371461242f, 0.809065342f},
-std::array<float,2>{0.629117131f, 0.584769666f},
-std::array<float,2>{0.09177614f, 0.0797680169f},
-std::array<float,2>{0.698684573f, 0.283506125f},
-std::array<float,2>{0.0080992803f, 0.963106155f},
-std::array<float,2>{0.962009251f, 0.665032566f},
-std::array<float,2>{0.293391764f, 0.142470047f},
-std::array<float,2>{0.823634565f, 0.0469545126f},
-std::array<float,2>{0.399145573f, 0.554170072f},
-std::array<float,2>{0.55737108f, 0.865668774f},
-std::array<float,2>{0.151780441f, 0.468425125f},
-std::array<float,2>{0.529411495f, 0.121629871f},
-std::array<float,2>{0.166474074f, 0.600648105f},
-std::array<float,2>{0.852739811f, 0.775540471f},
-std::array<float,2>{0.409118116f, 0.42818585f},
-std::array<float,2>{0.989273012f, 0.372144192f},
-std::array<float,2>{0.261496991f, 0.915666282f},
-std::array<float,2>{0.744343519f, 0.708526313f},
-std::array<float,2>{0.0612897053f, 0.236803517f},
-std::array<float,2>{0.680707574f, 0.47623682f},
-std::array<float,2>{0.118173361f, 0.839659214f},
-std::array<float,2>{0.921959877f, 0.504346907f},
-std::array<float,2>{0.328219265f, 0.00230218656f},
-std::array<float,2>{0.763164818f, 0.161487609f},
-std::array<float,2>{0.45717752f, 0.640149891f},
-std::array<float,2>{0.608103991f, 0.994066179f},
-std::array<float,2>{0.233234748f, 0.256488293f},
-std::array<float,2>{0.690878153f, 0.208431393f},
-std::array<float,2>{0.00399304461f, 0.745696962f},
-std::array<float,2>{0.95440042f, 0.878376603f},
-std::array<float,2>{0.288239449f, 0.331659794f},
-std::array<float,2>{0.818723261f, 0.388133079f},
-std::array<float,2>{0.398079604f, 0.785882592f},
-std::array<float,2>{0.549592674f, 0.57380414f},
-std::array<float,2>{0.145900697f, 0.0757244527f},
-std::array<float,2>{0.57614547f, 0.297488034f},
-std::array<float,2>{0.214780912f, 0.952245235f},
-std::array<float,2>{0.785141885f, 0.686704099f},
-std::array<float,2>{0.478486806f, 0.137274683f},
-std::array<float,2>{0.876905382f, 0.0404260792f},
-std::array<float,2>{0.363691419f, 0.540895045f},
-std::array<float,2>{0.63990742f, 0.845654845f},
-std::array<float,2>{0.0804603472f, 0.448003203f},
-std::array<float,2>{0.651155949f, 0.0250247996f},
-std::array<float,2>{0.0759900585f, 0.52315402f},
-std::array<float,2>{0.892822266f, 0.824408352f},
-std::array<float,2>{0.348713696f, 0.4938308f},
-std::array<float,2>{0.801991761f, 0.272415102f},
-std::array<float,2>{0.494841129f, 0.976960003f},
-std::array<float,2>{0.578267694f, 0.650617242f},
-std::array<float,2>{0.198825747f, 0.186355501f},
-std::array<float,2>{0.536539793f, 0.418822467f},
-std::array<float,2>{0.125568017f, 0.754615426f},
-std::array<float,2>{0.832918167f, 0.623322606f},
-std::array<float,2>{0.388871819f, 0.106879182f},
-std::array<float,2>{0.94827652f, 0.230595037f},
-std::array<float,2>{0.30403325f, 0.693585396f},
-std::array<float,2>{0.710164905f, 0.922811866f},
-std::array<float,2>{0.0219079014f, 0.344418615f},
-std::array<float,2>{0.620077252f, 0.14738512f},
-std::array<float,2>{0.239725545f, 0.669332027f},
-std::array<float,2>{0.775673091f, 0.967778862f},
-std::array<float,2>{0.449204683f, 0.288522869f},
-std::array<float,2>{0.911351144f, 0.463443071f},
-std::array<float,2>{0.327950686f, 0.862251043f},
-std::array<float,2>{0.667541862f, 0.550070822f},
-std::array<float,2>{0.106239215f, 0.0535263754f},
-std::array<float,2>{0.720948219f, 0.31623885f},
-std::array<float,2>{0.0317145586f, 0.906046927f},
-std::array<float,2>{0.973490834f, 0.723583162f},
-std::array<float,2>{0.265781701f, 0.203121066f},
-std::array<float,2>{0.872378826f, 0.0826323628f},
-std::array<float,2>{0.430595756f, 0.578409374f},
-std::array<float,2>{0.514352977f, 0.806780815f},
-std::array<float,2>{0.184233248f, 0.405952603f},
-std::array<float,2>{0.588770747f, 0.060538657f},
-std::array<float,2>{0.190027446f, 0.558542728f},
-std::array<float,2>{0.805800557f, 0.874383807f},
-std::array<float,2>{0.490167767f, 0.457913309f},
-std::array<float,2>{0.903138578f, 0.290013313f},
-std::array<float,2>{0.353399873f, 0.95506835f},
-std::array<float,2>{0.645102262f, 0.661747336f},
-std::array<float,2>{0.0670014396f, 0.15124236f},
-std::array<float,2>{0.713986993f, 0.397840559f},
-std::array<float,2>{0.0278482586f, 0.803146541f},
-std::array<float,2>{0.941880167f, 0.593275726f},
-std::array<float,2>{0.309686005f, 0.0889078975f},
-std::array<float,2>{0.84278506f, 0.191304252f},
-std::array<float,2>{0.382595181f, 0.730249941f},
-std::array<float,2>{0.540152788f, 0.896152318f},
-std::array<float,2>{0.135736331f, 0.32466495f},
-std::array<float,2>{0.661159217f, 0.175304621f},
-std::array<float,2>{0.0980042741f, 0.645229757f},
-std::array<float,2>{0.920293093f, 0.971616745f},
-std::array<float,2>{0.317808747f, 0.280307412f},
-std::array<float,2>{0.771554589f, 0.485088497f},
-std::array<float,2>{0.439793438f, 0.813639879f},
-std::array<float,2>{0.613347173f, 0.52707094f},
-std::array<float,2>{0.248695701f, 0.01846602f},
-std::array<float,2>{0.504044056f, 0.354497552f},
-std::array<float,2>{0.176075011f, 0.93483603f},
-std::array<float,2>{0.865543008f, 0.700924158f},
-std::array<float,2>{0.422977358f, 0.225880131f},
-std::array<float,2>{0.97782582f, 0.0979219824f},
-std::array<float,2>{0.276527852f, 0.609844685f},
-std::array<float,2>{0.733410001f, 0.764012456f},
-std::array<float,2>{0.0460715219f, 0.406654805f},
-std::array<float,2>{0.741122246f, 0.0644412562f},
-std::array<float,2>{0.0528975762f, 0.564774036f},
-std::array<float,2>{0.995127797f, 0.794360161f},
-std::array<float,2>{0.255837828f, 0.379374981f},
-std::array<float,2>{0.85145694f, 0.337428629f},
-std::array<float,2>{0.4199498f, 0.887089193f},
-std::array<float,2>{0.519669414f, 0.739282906f},
-std::array<float,2>{0.160681367f, 0.216904059f},
-std::array<float,2>{0.599458098f, 0.439722031f},
-std::array<float,2>{0.225263625f, 0.854459584f},
-std::array<float,2>{0.750343204f, 0.536992371f},
-std::array<float,2>{0.468637317f, 0.0389996432f},
-std::array<float,2>{0.934605718f, 0.127407432f},
-std::array<float,2>{0.341661066f, 0.673630655f},
-std::array<float,2>{0.676082909f, 0.938273609f},
-std::array<float,2>{0.114984557f, 0.311115921f},
-std::array<float,2>{0.56155026f, 0.242867261f},
-std::array<float,2>{0.155522004f, 0.711975574f},
-std::array<float,2>{0.82798779f, 0.906774402f},
-std::array<float,2>{0.404811203f, 0.359682947f},
-std::array<float,2>{0.967907965f, 0.432428241f},
-std::array<float,2>{0.29134959f, 0.766829967f},
-std::array<float,2>{0.699225366f, 0.607276678f},
-std::array<float,2>{0.0142059037f, 0.115080819f},
-std::array<float,2>{0.62848568f, 0.261144698f},
-std::array<float,2>{0.0877418518f, 0.991575062f},
-std::array<float,2>{0.883729041f, 0.629133344f},
-std::array<float,2>{0.369268566f, 0.169863686f},
-std::array<float,2>{0.795823455f, 0.0146281691f},
-std::array<float,2>{0.47165224f, 0.515395522f},
-std::array<float,2>{0.566005945f, 0.834641695f},
-std::array<float,2>{0.2068903f, 0.47684285f},
-std::array<float,2>{0.571086824f, 0.097065717f},
-std::array<float,2>{0.218288705f, 0.613647103f},
-std::array<float,2>{0.788698256f, 0.761307597f},
-std::array<float,2>{0.481577545f, 0.41380015f},
-std::array<float,2>{0.879065216f, 0.356535554f},
-std::array<float,2>{0.362736493f, 0.931467056f},
-std::array<float,2>{0.632932007f, 0.697445273f},
-std::array<float,2>{0.0847815573f, 0.221485317f},
-std::array<float,2>{0.694575429f, 0.490715742f},
-std::array<float,2>{0.00172830618f, 0.816407025f},
-std::array<float,2>{0.959453821f, 0.530914366f},
-std::array<float,2>{0.284231603f, 0.0212154705f},
-std::array<float,2>{0.814317346f, 0.176692203f},
-std::array<float,2>{0.393873721f, 0.641626179f},
-std::array<float,2>{0.554186523f, 0.976400852f},
-std::array<float,2>{0.143017486f, 0.275506228f},
-std::array<float,2>{0.685618222f, 0.194338873f},
-std::array<float,2>{0.121614948f, 0.730630398f},
-std::array<float,2>{0.928489864f, 0.893736184f},
-std::array<float,2>{0.334191889f, 0.322362691f},
-std::array<float,2>{0.760516465f, 0.392790675f},
-std::array<float,2>{0.454898089f, 0.798701525f},
-std::array<float,2>{0.603721082f, 0.587593198f},
-std::array<float,2>{0.228419781f, 0.0936721563f},
-std::array<float,2>{0.524362683f, 0.295005649f},
-std::array<float,2>{0.169156462f, 0.95746541f},
-std::array<float,2>{0.856485188f, 0.656254649f},
-std::array<float,2>{0.412368327f, 0.152834907f},
-std::array<float,2>{0.985149264f, 0.0566306263f},
-std::array<float,2>{0.263995975f, 0.562345088f},
-std::array<float,2>{0.746721983f, 0.870500743f},
-std::array<float,2>{0.056657277f, 0.454852313f},
-std::array<float,2>{0.725060463f, 0.00868843775f},
-std::array<float,2>{0.035565231f, 0.511269629f},
-std::array<float,2>{0.972653151f, 0.831097603f},
-std::array<float,2>{0.273018152f, 0.483124882f},
-std::array<float,2>{0.867667675f, 0.263256252f},
-std::array<float,2>{0.436256766f, 0.988122821f},
-std::array<float,2>{0.511184037f, 0.628441036f},
-std::array<float,2>{0.181843162f, 0.165873259f},
-std::array<float,2>{0.624653935f, 0.435283303f},
-std::array<float,2>{0.237087652f, 0.769861102f},
-std::array<float,2>{0.781067431f, 0.602419615f},
-std::array<float,2>{0.451951802f, 0.11223422f},
-std::array<float,2>{0.909963727f, 0.249068826f},
-std::array<float,2>{0.322236091f, 0.71696651f},
-std::array<float,2>{0.6716609f, 0.913615823f},
-std::array<float,2>{0.103565052f, 0.36690712f},
-std::array<float,2>{0.532819629f, 0.129954129f},
-std::array<float,2>{0.131041452f, 0.676208735f},
-std::array<float,2>{0.830048919f, 0.944352806f},
-std::array<float,2>{0.385100603f, 0.306291789f},
-std::array<float,2>{0.952743471f, 0.443921685f},
-std::array<float,2>{0.300677478f, 0.857069492f},
-std::array<float,2>{0.706759214f, 0.532729566f},
-std::array<float,2>{0.0194053203f, 0.0317640007f},
-std::array<float,2>{0.653903544f, 0.34158954f},
-std::array<float,2>{0.0706492364f, 0.886131942f},
-std::array<float,2>{0.894543469f, 0.73532939f},
-std::array<float,2>{0.347351015f, 0.214238122f},
-std::array<float,2>{0.800326109f, 0.066764161f},
-std::array<float,2>{0.497885108f, 0.568496525f},
-std::array<float,2>{0.582749605f, 0.791282713f},
-std::array<float,2>{0.200199798f, 0.376295447f},
-std::array<float,2>{0.500439346f, 0.0454997942f},
-std::array<float,2>{0.172901824f, 0.546874106f},
-std::array<float,2>{0.861042202f, 0.850864291f},
-std::array<float,2>{0.427806705f, 0.451584995f},
-std::array<float,2>{0.984004021f, 0.302681953f},
-std::array<float,2>{0.280820251f, 0.947718978f},
-std::array<float,2>{0.726930976f, 0.681109548f},
-std::array<float,2>{0.0421401486f, 0.135450482f},
-std::array<float,2>{0.658726811f, 0.38627407f},
-std::array<float,2>{0.0970908105f, 0.784934342f},
-std::array<float,2>{0.915910661f, 0.574806929f},
-std::array<float,2>{0.316167563f, 0.0737440586f},
-std::array<float,2>{0.768420637f, 0.20401822f},
-std::array<float,2>{0.441706836f, 0.748917043f},
-std::array<float,2>{0.611415923f, 0.879588962f},
-std::array<float,2>{0.244709194f, 0.332054824f},
-std::array<float,2>{0.717504025f, 0.157202885f},
-std::array<float,2>{0.0255312808f, 0.634370744f},
-std::array<float,2>{0.939911246f, 0.998085558f},
-std::array<float,2>{0.306737572f, 0.252842426f},
-std::array<float,2>{0.839691758f, 0.470758438f},
-std::array<float,2>{0.376838356f, 0.842074513f},
-std::array<float,2>{0.545990229f, 0.501216054f},
-std::array<float,2>{0.136755407f, 0.0073478464f},
-std::array<float,2>{0.590736926f, 0.369041115f},
-std::array<float,2>{0.19412443f, 0.920051932f},
-std::array<float,2>{0.811763823f, 0.704084873f},
-std::array<float,2>{0.488045007f, 0.240076527f},
-std::array<float,2>{0.899465561f, 0.117948867f},
-std::array<float,2>{0.358326495f, 0.596759558f},
-std::array<float,2>{0.644263446f, 0.77876693f},
-std::array<float,2>{0.0637220219f, 0.422697395f},
-std::array<float,2>{0.630981743f, 0.0808441564f},
-std::array<float,2>{0.0937078595f, 0.582066894f},
-std::array<float,2>{0.887852728f, 0.810786903f},
-std::array<float,2>{0.374385148f, 0.402174681f},
-std::array<float,2>{0.790584624f, 0.316450685f},
-std::array<float,2>{0.475050747f, 0.900247216f},
-std::array<float,2>{0.568722606f, 0.722281396f},
-std::array<float,2>{0.20736526f, 0.197203711f},
-std::array<float,2>{0.555111289f, 0.466586858f},
-std::array<float,2>{0.148583353f, 0.864489675f},
-std::array<float,2>{0.821512878f, 0.552137136f},
-std::array<float,2>{0.400648892f, 0.0499216355f},
-std::array<float,2>{0.963481545f, 0.144000724f},
-std::array<float,2>{0.296298265f, 0.666218877f},
-std::array<float,2>{0.696688771f, 0.961298466f},
-std::array<float,2>{0.0109614786f, 0.281317681f},
-std::array<float,2>{0.594547451f, 0.227788284f},
-std::array<float,2>{0.219351307f, 0.690084755f},
-std::array<float,2>{0.754463673f, 0.9277125f},
-std::array<float,2>{0.462335587f, 0.350619882f},
-std::array<float,2>{0.933568478f, 0.414649099f},
-std::array<float,2>{0.338883549f, 0.753109813f},
-std::array<float,2>{0.673755109f, 0.617746413f},
-std::array<float,2>{0.111326322f, 0.10471499f},
-std::array<float,2>{0.736803055f, 0.268268317f},
-std::array<float,2>{0.0507465526f, 0.983051062f},
-std::array<float,2>{0.997030616f, 0.653286159f},
-std::array<float,2>{0.253483117f, 0.181884825f},
-std::array<float,2>{0.84725076f, 0.0302311815f},
-std::array<float,2>{0.416634619f, 0.515701532f},
-std::array<float,2>{0.517860413f, 0.824073017f},
-std::array<float,2>{0.158917591f, 0.498170793f},
-std::array<float,2>{0.548332095f, 0.0774453804f},
-std::array<float,2>{0.147307694f, 0.571184814f},
-std::array<float,2>{0.816494167f, 0.787632823f},
-std::array<float,2>{0.396195352f, 0.390579551f},
-std::array<float,2>{0.955079675f, 0.329987079f},
-std::array<float,2>{0.285833776f, 0.875436366f},
-std::array<float,2>{0.688372076f, 0.743526936f},
-std::array<float,2>{0.00679054903f, 0.209497184f},
-std::array<float,2>{0.637024879f, 0.44623512f},
-std::array<float,2>{0.0792407393f, 0.846470237f},
-std::array<float,2>{0.878687918f, 0.54186523f},
-std::array<float,2>{0.365940511f, 0.0423015319f},
-std::array<float,2>{0.781352818f, 0.138747782f},
-std::array<float,2>{0.480181634f, 0.683612108f},
-std::array<float,2>{0.57627064f, 0.950994372f},
-std::array<float,2>{0.212394446f, 0.299592763f},
-std::array<float,2>{0.74292767f, 0.236183703f},
-std::array<float,2>{0.0604023822f, 0.709752381f},
-std::array<float,2>{0.992124796f, 0.916788518f},
-std::array<float,2>{0.259362191f, 0.37497896f},
-std::array<float,2>{0.854617417f, 0.426160872f},
-std::array<float,2>{0.40666315f, 0.775373042f},
-std::array<float,2>{0.527549207f, 0.599189818f},
-std::array<float,2>{0.164238289f, 0.123852067f},
-std::array<float,2>{0.607287586f, 0.255442172f},
-std::array<float,2>{0.231152102f, 0.994732797f},
-std::array<float,2>{0.763780594f, 0.636876881f},
-std::array<float,2>{0.459629297f, 0.16350311f},
-std::array<float,2>{0.925663352f, 0.000699217373f},
-std::array<float,2>{0.331247538f, 0.507368088f},
-std::array<float,2>{0.682299435f, 0.837061286f},
-std::array<float,2>{0.120746136f, 0.473263234f},
-std::array<float,2>{0.665699482f, 0.0515844226f},
-std::array<float,2>{0.108599268f, 0.547852337f},
-std::array<float,2>{0.912434399f, 0.860131204f},
-std::array<float,2>{0.32474032f, 0.462087601f},
-std::array<float,2>{0.77440691f, 0.286383778f},
-std::array<float,2>{0.445798308f, 0.965513825f},
-std::array<float,2>{0.618909776f, 0.671717167f},
-std::array<float,2>{0.240510613f, 0.145014346f},
-std::array<float,2>{0.512154222f, 0.402880311f},
-std::array<float,2>{0.186470896f, 0.805824399f},
-std::array<float,2>{0.873841166f, 0.580952764f},
-std::array<float,2>{0.43313846f, 0.0847171098f},
-std::array<float,2>{0.975097239f, 0.199478045f},
-std::array<float,2>{0.268333495f, 0.725901604f},
-std::array<float,2>{0.719808698f, 0.902756989f},
-std::array<float,2>{0.034446422f, 0.313727945f},
-std::array<float,2>{0.581686199f, 0.183819771f},
-std::array<float,2>{0.196694806f, 0.650023818f},
-std::array<float,2>{0.803049028f, 0.979265213f},
-std::array<float,2>{0.492536336f, 0.271264076f},
-std::array<float,2>{0.891657472f, 0.494832993f},
-std::array<float,2>{0.35055396f, 0.826172113f},
-std::array<float,2>{0.650072336f, 0.521208823f},
-std::array<float,2>{0.0767051205f, 0.0267116986f},
-std::array<float,2>{0.707335472f, 0.345841616f},
-std::array<float,2>{0.0196895506f, 0.924681664f},
-std::array<float,2>{0.947207451f, 0.69242239f},
-std::array<float,2>{0.30264774f, 0.234095514f},
-std::array<float,2>{0.834796786f, 0.108681075f},
-std::array<float,2>{0.387692064f, 0.621709764f},
-std::array<float,2>{0.538912058f, 0.756393015f},
-std::array<float,2>{0.128828824f, 0.42136246f},
-std::array<float,2>{0.616713583f, 0.0159520023f},
-std::array<float,2>{0.247166038f, 0.524871171f},
-std::array<float,2>{0.77026993f, 0.814877331f},
-std::array<float,2>{0.438769817f, 0.487077504f},
-std::array<float,2>{0.919703245f, 0.277568072f},
-std::array<float,2>{0.320080489f, 0.969044864f},
-std::array<float,2>{0.663456202f, 0.646679461f},
-std::array<float,2>{0.10096921f, 0.172116295f},
-std::array<float,2>{0.732094407f, 0.40975967f},
-std::array<float,2>{0.0437137038f, 0.76267916f},
-std::array<float,2>{0.979460955f, 0.612937987f},
-std::array<float,2>{0.273849994f, 0.100990139f},
-std::array<float,2>{0.863488376f, 0.222800136f},
-std::array<float,2>{0.4241561f, 0.702386498f},
-std::array<float,2>{0.506772876f, 0.937239945f},
-std::array<float,2>{0.178964689f, 0.35238719f},
-std::array<float,2>{0.647707999f, 0.148767248f},
-std::array<float,2>{0.06836842f, 0.662165821f},
-std::array<float,2>{0.904462814f, 0.95579356f},
-std::array<float,2>{0.354691744f, 0.292308629f},
-std::array<float,2>{0.808545053f, 0.460358441f},
-std::array<float,2>{0.491797477f, 0.871693969f},
-std::array<float,2>{0.58675617f, 0.556460083f},
-std::array<float,2>{0.188687086f, 0.0624261498f},
-std::array<float,2>{0.54288739f, 0.32684353f},
-std::array<float,2>{0.134040639f, 0.896861851f},
-std::array<float,2>{0.840976954f, 0.726970851f},
-std::array<float,2>{0.379829437f, 0.188245788f},
-std::array<float,2>{0.944817007f, 0.086249277f},
-std::array<float,2>{0.311000466f, 0.590085685f},
-std::array<float,2>{0.711131454f, 0.801062346f},
-std::array<float,2>{0.0298576076f, 0.394791365f},
-std::array<float,2>{0.701588035f, 0.115937732f},
-std::array<float,2>{0.0124446293f, 0.607622623f},
-std::array<float,2>{0.964905143f, 0.767768145f},
-std::array<float,2>{0.29013586f, 0.430613101f},
-std::array<float,2>{0.825186551f, 0.361412555f},
-std::array<float,2>{0.40382424f, 0.909280181f},
-std::array<float,2>{0.560499251f, 0.714388072f},
-std::array<float,2>{0.15425612f, 0.244981274f},
-std::array<float,2>{0.564204156f, 0.478692621f},
-std::array<float,2>{0.204512239f, 0.833611488f},
-std::array<float,2>{0.794360876f, 0.512964368f},
-std::array<float,2>{0.470126778f, 0.0133906547f},
-std::array<float,2>{0.88558203f, 0.171426192f},
-std::array<float,2>{0.368150532f, 0.6317963f},
-std::array<float,2>{0.626811326f, 0.988919556f},
-std::array<float,2>{0.0894629955f, 0.258868366f},
-std::array<float,2>{0.522532761f, 0.215101987f},
-std::array<float,2>{0.16301626f, 0.74198091f},
-std::array<float,2>{0.84795028f, 0.88926959f},
-std::array<float,2>{0.418757051f, 0.338792324f},
-std::array<float,2>{0.994091868f, 0.38102892f},
-std::array<float,2>{0.257527649f, 0.795189381f},
-std::array<float,2>{0.73917526f, 0.56363368f},
-std::array<float,2>{0.0523801297f, 0.065102905f},
-std::array<float,2>{0.678503633f, 0.308620572f},
-std::array<float,2>{0.116662733f, 0.940435112f},
-std::array<float,2>{0.937058508f, 0.674945176f},
-std::array<float,2>{0.343413383f, 0.125418276f},
-std::array<float,2>{0.752793074f, 0.0359199233f},
-std::array<float,2>{0.465120494f, 0.538317144f},
-std::array<float,2>{0.601183653f, 0.852811873f},
-std::array<float,2>{0.224565089f, 0.43757382f},
-std::array<float,2>{0.595788538f, 0.105208166f},
-std::array<float,2>{0.222645313f, 0.617451668f},
-std::array<float,2>{0.75596714f, 0.753788471f},
-std::array<float,2>{0.464759916f, 0.414309174f},
-std::array<float,2>{0.930540681f, 0.351345807f},
-std::array<float,2>{0.337207735f, 0.927066863f},
-std::array<float,2>{0.674870312f, 0.689704478f},
-std::array<float,2>{0.113041274f, 0.22834298f},
-std::array<float,2>{0.735596299f, 0.498645216f},
-std::array<float,2>{0.0486697815f, 0.823266149f},
-std::array<float,2>{0.998371661f, 0.516242802f},
-std::array<float,2>{0.251414239f, 0.0296560694f},
-std::array<float,2>{0.844889164f, 0.182511166f},
-std::array<float,2>{0.415245622f, 0.65253669f},
-std::array<float,2>{0.515831292f, 0.982607663f},
-std::array<float,2>{0.157642096f, 0.26770246f},
-std::array<float,2>{0.629512012f, 0.196389928f},
-std::array<float,2>{0.0908487886f, 0.722045124f},
-std::array<float,2>{0.89007467f, 0.899492502f},
-std::array<float,2>{0.371912241f, 0.317161739f},
-std::array<float,2>{0.792809606f, 0.401483357f},
-std::array<float,2>{0.473291397f, 0.811107397f},
-std::array<float,2>{0.567257464f, 0.582809329f},
-std::array<float,2>{0.210870847f, 0.080200009f},
-std::array<float,2>{0.557024717f, 0.281802654f},
-std::array<float,2>{0.152230635f, 0.961572468f},
-std::array<float,2>{0.823895574f, 0.66681385f},
-std::array<float,2>{0.398508191f, 0.144066215f},
-std::array<float,2>{0.962877631f, 0.0506417528f},
-std::array<float,2>{0.293923676f, 0.552446246f},
-std::array<float,2>{0.699053288f, 0.865189612f},
-std::array<float,2>{0.00846827775f, 0.466264904f},
-std::array<float,2>{0.715489089f, 0.00695131766f},
-std::array<float,2>{0.0246476978f, 0.501510262f},
-std::array<float,2>{0.939349174f, 0.842647672f},
-std::array<float,2>{0.304995894f, 0.471242636f},
-std::array<float,2>{0.836554348f, 0.251968324f},
-std::array<float,2>{0.377344877f, 0.998859167f},
-std::array<float,2>{0.544920087f, 0.634246409f},
-std::array<float,2>{0.139803424f, 0.15637055f},
-std::array<float,2>{0.59257251f, 0.42218858f},
-std::array<float,2>{0.193108827f, 0.779117823f},
-std::array<float,2>{0.810384214f, 0.597343206f},
-std::array<float,2>{0.485668421f, 0.117409535f},
-std::array<float,2>{0.902158558f, 0.239285856f},
-std::array<float,2>{0.3556979f, 0.703475535f},
-std::array<float,2>{0.640898764f, 0.920465589f},
-std::array<float,2>{0.0657108203f, 0.368296087f},
-std::array<float,2>{0.503163636f, 0.134819597f},
-std::array<float,2>{0.174464583f, 0.681249976f},
-std::array<float,2>{0.861486793f, 0.947761416f},
-std::array<float,2>{0.425969481f, 0.30199337f},
-std::array<float,2>{0.981174111f, 0.451733142f},
-std::array<float,2>{0.278610826f, 0.851544797f},
-std::array<float,2>{0.728625476f, 0.546140432f},
-std::array<float,2>{0.0410004668f, 0.0452768244f},
-std::array<float,2>{0.656897664f, 0.332980543f},
-std::array<float,2>{0.0947631523f, 0.878950655f},
-std::array<float,2>{0.917181909f, 0.748157442f},
-std::array<float,2>{0.313322365f, 0.203582749f},
-std::array<float,2>{0.765788913f, 0.0737200007f},
-std::array<float,2>{0.444425732f, 0.574590743f},
-std::array<float,2>{0.610188246f, 0.784420133f},
-std::array<float,2>{0.243546098f, 0.385903597f},
-std::array<float,2>{0.533614814f, 0.0316904373f},
-std::array<float,2>{0.1290797f, 0.532497883f},
-std::array<float,2>{0.830413878f, 0.856631339f},
-std::array<float,2>{0.383505613f, 0.443486363f},
-std::array<float,2>{0.949496627f, 0.306062579f},
-std::array<float,2>{0.297406733f, 0.945014954f},
-std::array<float,2>{0.704042971f, 0.67660743f},
-std::array<float,2>{0.0160262417f, 0.130830273f},
-std::array<float,2>{0.655065596f, 0.376774669f},
-std::array<float,2>{0.0739844143f, 0.791786969f},
-std::array<float,2>{0.89766866f, 0.569201291f},
-std::array<float,2>{0.345648229f, 0.0672931001f},
-std::array<float,2>{0.798392832f, 0.214840546f},
-std::array<float,2>{0.499590933f, 0.734733462f},
-std::array<float,2>{0.585430384f, 0.886464298f},
-std::array<float,2>{0.201687157f, 0.340963393f},
-std::array<float,2>{0.722725928f, 0.165461972f},
-std::array<float,2>{0.0390084572f, 0.628109038f},
-std::array<float,2>{0.970062137f, 0.987702549f},
-std::array<float,2>{0.269617587f, 0.262796104f},
-std::array<float,2>{0.869494617f, 0.482499361f},
-std::array<float,2>{0.43400535f, 0.831593692f},
-std::array<float,2>{0.508075655f, 0.510997415f},
-std::array<float,2>{0.180740222f, 0.00810668152f},
-std::array<float,2>{0.622343719f, 0.366576672f},
-std::array<float,2>{0.235590637f, 0.913382113f},
-std::array<float,2>{0.778714895f, 0.7173599f},
-std::array<float,2>{0.450207323f, 0.249599963f},
-std::array<float,2>{0.906255782f, 0.111377545f},
-std::array<float,2>{0.322935909f, 0.601970494f},
-std::array<float,2>{0.6680758f, 0.770249248f},
-std::array<float,2>{0.101964086f, 0.434942901f},
-std::array<float,2>{0.683764756f, 0.0930804834f},
-std::array<float,2>{0.123985581f, 0.587008715f},
-std::array<float,2>{0.927255511f, 0.797999322f},
-std::array<float,2>{0.333462596f, 0.39350301f},
-std::array<float,2>{0.759510279f, 0.323187828f},
-std::array<float,2>{0.456457317f, 0.894406378f},
-std::array<float,2>{0.603310287f, 0.731390059f},
-std::array<float,2>{0.229638472f, 0.195311964f},
-std::array<float,2>{0.527224362f, 0.45441702f},
-std::array<float,2>{0.170182884f, 0.871038675f},
-std::array<float,2>{0.858210564f, 0.56181556f},
-std::array<float,2>{0.410761237f, 0.0561498702f},
-std::array<float,2>{0.987456203f, 0.152773544f},
-std::array<float,2>{0.261895657f, 0.656958163f},
-std::array<float,2>{0.749391317f, 0.957939267f},
-std::array<float,2>{0.0556273721f, 0.295704126f},
-std::array<float,2>{0.573525131f, 0.221142277f},
-std::array<float,2>{0.214951396f, 0.697969794f},
-std::array<float,2>{0.786695659f, 0.931137383f},
-std::array<float,2>{0.483181924f, 0.357200086f},
-std::array<float,2>{0.88155371f, 0.413295746f},
-std::array<float,2>{0.360064447f, 0.760997415f},
-std::array<float,2>{0.636263669f, 0.614029586f},
-std::array<float,2>{0.0830096155f, 0.0976023525f},
-std::array<float,2>{0.692237139f, 0.27633962f},
-std::array<float,2>{0.00267957151f, 0.975867808f},
-std::array<float,2>{0.95859313f, 0.642303467f},
-std::array<float,2>{0.282056838f, 0.176156938f},
-std::array<float,2>{0.815302134f, 0.0209685173f},
-std::array<float,2>{0.391504377f, 0.530385792f},
-std::array<float,2>{0.551603794f, 0.816978633f},
-std::array<float,2>{0.140861854f, 0.490860224f},
-std::array<float,2>{0.52030319f, 0.0646373257f},
-std::array<float,2>{0.160426676f, 0.564048767f},
-std::array<float,2>{0.850639939f, 0.79575634f},
-std::array<float,2>{0.420739293f, 0.381362855f},
-std::array<float,2>{0.99594456f, 0.338178337f},
-std::array<float,2>{0.255156666f, 0.888676643f},
-std::array<float,2>{0.740416467f, 0.741309404f},
-std::array<float,2>{0.0533329174f, 0.21538955f},
-std::array<float,2>{0.676343858f, 0.438167483f},
-std::array<float,2>{0.114579849f, 0.853512287f},
-std::array<float,2>{0.935142457f, 0.538794994f},
-std::array<float,2>{0.341236293f, 0.0353538506f},
-std::array<float,2>{0.750808537f, 0.12549676f},
-std::array<float,2>{0.468184292f, 0.67548275f},
-std::array<float,2>{0.598665118f, 0.941231072f},
-std::array<float,2>{0.224687353f, 0.309277385f},
-std::array<float,2>{0.699900031f, 0.244276091f},
-std::array<float,2>{0.013717954f, 0.713884354f},
-std::array<float,2>{0.96864146f, 0.90985781f},
-std::array<float,2>{0.291866213f, 0.362156391f},
-std::array<float,2>{0.827541649f, 0.429791301f},
-std::array<float,2>{0.404620349f, 0.768546343f},
-std::array<float,2>{0.562015772f, 0.608056307f},
-std::array<float,2>{0.155863717f, 0.115502901f},
-std::array<float,2>{0.565442979f, 0.259682745f},
-std::array<float,2>{0.206119746f, 0.988385022f},
-std::array<float,2>{0.795273364f, 0.631248713f},
-std::array<float,2>{0.470874041f, 0.171298608f},
-std::array<float,2>{0.882847607f, 0.0128317419f},
-std::array<float,2>{0.369974405f, 0.513231874f},
-std::array<float,2>{0.628039479f, 0.833331823f},
-std::array<float,2>{0.087376684f, 0.479135901f},
-std::array<float,2>{0.644850791f, 0.0616652556f},
-std::array<float,2>{0.0668639839f, 0.556018591f},
-std::array<float,2>{0.90274024f, 0.871224284f},
-std::array<float,2>{0.35291779f, 0.460604459f},
-std::array<float,2>{0.806424677f, 0.292611808f},
-std::array<float,2>{0.489389569f, 0.95521456f},
-std::array<float,2>{0.588112473f, 0.662889063f},
-std::array<float,2>{0.189454615f, 0.149179861f},
-std::array<float,2>{0.540867209f, 0.395143032f},
-std::array<float,2>{0.134927392f, 0.801318169f},
-std::array<float,2>{0.843620598f, 0.590557158f},
-std::array<float,2>{0.382105112f, 0.08653225f},
-std::array<float,2>{0.941997409f, 0.187691703f},
-std::array<float,2>{0.310493499f, 0.727297306f},
-std::array<float,2>{0.714367211f, 0.897247493f},
-std::array<float,2>{0.0273801982f, 0.32657671f},
-std::array<float,2>{0.614064932f, 0.172782883f},
-std::array<float,2>{0.248456225f, 0.647438943f},
-std::array<float,2>{0.772080839f, 0.969680667f},
-std::array<float,2>{0.440387309f, 0.278052598f},
-std::array<float,2>{0.920460522f, 0.486555308f},
-std::array<float,2>{0.318258852f, 0.815063715f},
-std::array<float,2>{0.661789f, 0.525296271f},
-std::array<float,2>{0.0984356776f, 0.0162100606f},
-std::array<float,2>{0.734097481f, 0.351647913f},
-std::array<float,2>{0.0464764945f, 0.936952949f},
-std::array<float,2>{0.978295088f, 0.702655673f},
-std::array<float,2>{0.276892424f, 0.223416492f},
-std::array<float,2>{0.865794659f, 0.10154254f},
-std::array<float,2>{0.423399746f, 0.612755716f},
-std::array<float,2>{0.504866779f, 0.761826158f},
-std::array<float,2>{0.176346838f, 0.409650534f},
-std::array<float,2>{0.578998446f, 0.0268760622f},
-std::array<float,2>{0.198616073f, 0.520573378f},
-std::array<float,2>{0.802466452f, 0.826777875f},
-std::array<float,2>{0.494232804f, 0.494180709f},
-std::array<float,2>{0.893475235f, 0.270939291f},
-std::array<float,2>{0.349573731f, 0.978915453f},
-std::array<float,2>{0.650461555f, 0.649592459f},
-std::array<float,2>{0.0751977339f, 0.184251979f},
-std::array<float,2>{0.71058929f, 0.421526819f},
-std::array<float,2>{0.0221514553f, 0.756100893f},
-std::array<float,2>{0.949199259f, 0.621487319f},
-std::array<float,2>{0.304324746f, 0.108960904f},
-std::array<float,2>{0.832124114f, 0.233789027f},
-std::array<float,2>{0.389533877f, 0.693041623f},
-std::array<float,2>{0.536744177f, 0.923968017f},
-std::array<float,2>{0.125173435f, 0.346399933f},
-std::array<float,2>{0.666995049f, 0.145464271f},
-std::array<float,2>{0.105933279f, 0.671352506f},
-std::array<float,2>{0.911947012f, 0.965210915f},
-std::array<float,2>{0.327249587f, 0.286756188f},
-std::array<float,2>{0.776307285f, 0.462592572f},
-std::array<float,2>{0.448242515f, 0.85962224f},
-std::array<float,2>{0.61923939f, 0.548490703f},
-std::array<float,2>{0.240183413f, 0.0509816147f},
-std::array<float,2>{0.51385802f, 0.314250916f},
-std::array<float,2>{0.183845773f, 0.902845323f},
-std::array<float,2>{0.872760296f, 0.726176918f},
-std::array<float,2>{0.429978937f, 0.200138643f},
-std::array<float,2>{0.973074555f, 0.0843838006f},
-std::array<float,2>{0.266132921f, 0.580262125f},
-std::array<float,2>{0.721391559f, 0.806260228f},
-std::array<float,2>{0.0317834839f, 0.40257448f},
-std::array<float,2>{0.745111227f, 0.123049326f},
-std::array<float,2>{0.0608990639f, 0.598749518f},
-std::array<float,2>{0.990022719f, 0.774871588f},
-std::array<float,2>{0.260897517f, 0.426314205f},
-std::array<float,2>{0.853348553f, 0.374388486f},
-std::array<float,2>{0.408240885f, 0.916469812f},
-std::array<float,2>{0.529814065f, 0.709239781f},
-std::array<float,2>{0.166687757f, 0.235476702f},
-std::array<float,2>{0.607789159f, 0.472687453f},
-std::array<float,2>{0.232683152f, 0.837662578f},
-std::array<float,2>{0.763578236f, 0.50688988f},
-std::array<float,2>{0.457605869f, 0.000102590326f},
-std::array<float,2>{0.922443271f, 0.163725972f},
-std::array<float,2>{0.328922391f, 0.637575746f},
-std::array<float,2>{0.681535959f, 0.994234979f},
-std::array<float,2>{0.118949182f, 0.25516665f},
-std::array<float,2>{0.549032509f, 0.209017485f},
-std::array<float,2>{0.146111116f, 0.743822455f},
-std::array<float,2>{0.818971097f, 0.875539601f},
-std::array<float,2>{0.397913992f, 0.329226255f},
-std::array<float,2>{0.954924285f, 0.389732569f},
-std::array<float,2>{0.288951397f, 0.787465274f},
-std::array<float,2>{0.691148579f, 0.570655107f},
-std::array<float,2>{0.00469291443f, 0.0777402669f},
-std::array<float,2>{0.640428841f, 0.29897517f},
-std::array<float,2>{0.0806310624f, 0.950282156f},
-std::array<float,2>{0.876426697f, 0.684390903f},
-std::array<float,2>{0.364219993f, 0.139447555f},
-std::array<float,2>{0.78442502f, 0.0425825492f},
-std::array<float,2>{0.477910817f, 0.541035891f},
-std::array<float,2>{0.575524986f, 0.846179366f},
-std::array<float,2>{0.214317963f, 0.445627779f},
-std::array<float,2>{0.569158137f, 0.0795695335f},
-std::array<float,2>{0.20764406f, 0.584364176f},
-std::array<float,2>{0.79050976f, 0.809443355f},
-std::array<float,2>{0.475481719f, 0.398997962f},
-std::array<float,2>{0.888652563f, 0.31853503f},
-std::array<float,2>{0.374987841f, 0.902059913f},
-std::array<float,2>{0.631684482f, 0.718862534f},
-std::array<float,2>{0.0930457041f, 0.197388813f},
-std::array<float,2>{0.696823359f, 0.468084872f},
-std::array<float,2>{0.0112916529f, 0.866058707f},
-std::array<float,2>{0.963083386f, 0.554403186f},
-std::array<float,2>{0.29679057f, 0.0474284962f},
-std::array<float,2>{0.821828187f, 0.141664356f},
-std::array<float,2>{0.401241928f, 0.664477706f},
-std::array<float,2>{0.555604935f, 0.963442147f},
-std::array<float,2>{0.149261668f, 0.284063101f},
-std::array<float,2>{0.672973394f, 0.23018004f},
-std::array<float,2>{0.110802002f, 0.688313007f},
-std::array<float,2>{0.932747602f, 0.928469598f},
-std::array<float,2>{0.339534014f, 0.349179476f},
-std::array<float,2>{0.754359663f, 0.416828871f},
-std::array<float,2>{0.462635815f, 0.7517851f},
-std::array<float,2>{0.594073415f, 0.619570851f},
-std::array<float,2>{0.219012573f, 0.102316961f},
-std::array<float,2>{0.518327653f, 0.265884995f},
-std::array<float,2>{0.15862982f, 0.980864346f},
-std::array<float,2>{0.847057641f, 0.65519172f},
-std::array<float,2>{0.41639781f, 0.181194186f},
-std::array<float,2>{0.996118844f, 0.0288964398f},
-std::array<float,2>{0.252957791f, 0.519133925f},
-std::array<float,2>{0.737068057f, 0.821703017f},
-std::array<float,2>{0.0502719432f, 0.496410102f},
-std::array<float,2>{0.727359474f, 0.0438452847f},
-std::array<float,2>{0.0428762548f, 0.54340893f},
-std::array<float,2>{0.983609021f, 0.848757744f},
-std::array<float,2>{0.280520529f, 0.451135576f},
-std::array<float,2>{0.86069572f, 0.302763313f},
-std::array<float,2>{0.42836684f, 0.946532547f},
-std::array<float,2>{0.500776768f, 0.68348819f},
-std::array<float,2>{0.173645616f, 0.133961812f},
-std::array<float,2>{0.611846328f, 0.384748369f},
-std::array<float,2>{0.244165272f, 0.783018291f},
-std::array<float,2>{0.767622113f, 0.577937007f},
-std::array<float,2>{0.442265332f, 0.0708873793f},
-std::array<float,2>{0.915225387f, 0.206049353f},
-std::array<float,2>{0.315543413f, 0.746229827f},
-std::array<float,2>{0.6583547f, 0.881132126f},
-std::array<float,2>{0.0973856971f, 0.334237605f},
-std::array<float,2>{0.546457052f, 0.159060672f},
-std::array<float,2>{0.137279108f, 0.636228263f},
-std::array<float,2>{0.839112222f, 0.996951461f},
-std::array<float,2>{0.376108438f, 0.25153017f},
-std::array<float,2>{0.940290332f, 0.468800247f},
-std::array<float,2>{0.307228953f, 0.839941621f},
-std::array<float,2>{0.716983676f, 0.503014147f},
-std::array<float,2>{0.0261731055f, 0.0050303475f},
-std::array<float,2>{0.643820405f, 0.370058119f},
-std::array<float,2>{0.064355284f, 0.919728279f},
-std::array<float,2>{0.900341749f, 0.705222309f},
-std::array<float,2>{0.357734531f, 0.242043301f},
-std::array<float,2>{0.81210196f, 0.119415902f},
-std::array<float,2>{0.487587303f, 0.594575047f},
-std::array<float,2>{0.590269864f, 0.780490994f},
-std::array<float,2>{0.19364728f, 0.424116611f},
-std::array<float,2>{0.51162231f, 0.0114234127f},
-std::array<float,2>{0.182395473f, 0.509488285f},
-std::array<float,2>{0.868115067f, 0.828938305f},
-std::array<float,2>{0.435995013f, 0.481897265f},
-std::array<float,2>{0.971710026f, 0.265094072f},
-std::array<float,2>{0.272619724f, 0.984648526f},
-std::array<float,2>{0.725382686f, 0.626283467f},
-std::array<float,2>{0.0360332541f, 0.167716697f},
-std::array<float,2>{0.671061099f, 0.43582049f},
-std::array<float,2>{0.104331568f, 0.773127794f},
-std::array<float,2>{0.909485579f, 0.605099022f},
-std::array<float,2>{0.321403623f, 0.109582387f},
-std::array<float,2>{0.780414283f, 0.246255666f},
-std::array<float,2>{0.451462984f, 0.715560794f},
-std::array<float,2>{0.624207377f, 0.911949039f},
-std::array<float,2>{0.236498892f, 0.363619506f},
-std::array<float,2>{0.706347704f, 0.131852224f},
-std::array<float,2>{0.0186188724f, 0.678444743f},
-std::array<float,2>{0.952416062f, 0.942525148f},
-std::array<float,2>{0.300185889f, 0.308582366f},
-std::array<float,2>{0.829324365f, 0.441858739f},
-std::array<float,2>{0.385483384f, 0.858778477f},
-std::array<float,2>{0.532464504f, 0.533299744f},
-std::array<float,2>{0.131608441f, 0.0336580575f},
-std::array<float,2>{0.582110286f, 0.342144579f},
-std::array<float,2>{0.201022118f, 0.88426435f},
-std::array<float,2>{0.800182343f, 0.737346053f},
-std::array<float,2>{0.497407883f, 0.212611109f},
-std::array<float,2>{0.895031273f, 0.0696739778f},
-std::array<float,2>{0.346828669f, 0.567192376f},
-std::array<float,2>{0.653590918f, 0.790247917f},
-std::array<float,2>{0.070833154f, 0.378277063f},
-std::array<float,2>{0.633319914f, 0.0943177491f},
-std::array<float,2>{0.0840867832f, 0.616590083f},
-std::array<float,2>{0.879554808f, 0.759458423f},
-std::array<float,2>{0.362947702f, 0.411207408f},
-std::array<float,2>{0.788139224f, 0.358336896f},
-std::array<float,2>{0.482144356f, 0.932707071f},
-std::array<float,2>{0.570339918f, 0.695642531f},
-std::array<float,2>{0.217957392f, 0.219762325f},
-std::array<float,2>{0.554663062f, 0.488855481f},
-std::array<float,2>{0.143399611f, 0.818893552f},
-std::array<float,2>{0.81367135f, 0.528122604f},
-std::array<float,2>{0.394068301f, 0.0224269331f},
-std::array<float,2>{0.959576309f, 0.178467482f},
-std::array<float,2>{0.284800231f, 0.644456983f},
-std::array<float,2>{0.695029616f, 0.972990453f},
-std::array<float,2>{0.00101064867f, 0.273826897f},
-std::array<float,2>{0.604082406f, 0.192055553f},
-std::array<float,2>{0.22798048f, 0.733547211f},
-std::array<float,2>{0.759829402f, 0.892000794f},
-std::array<float,2>{0.454502314f, 0.320864856f},
-std::array<float,2>{0.927780211f, 0.392030388f},
-std::array<float,2>{0.334508985f, 0.799564123f},
-std::array<float,2>{0.686323643f, 0.588249683f},
-std::array<float,2>{0.121393032f, 0.0906650722f},
-std::array<float,2>{0.74632901f, 0.293319434f},
-std::array<float,2>{0.0572614074f, 0.959498942f},
-std::array<float,2>{0.984494925f, 0.659959376f},
-std::array<float,2>{0.264427543f, 0.155826092f},
-std::array<float,2>{0.857230663f, 0.0577398241f},
-std::array<float,2>{0.412673533f, 0.559777319f},
-std::array<float,2>{0.523842573f, 0.868718326f},
-std::array<float,2>{0.169584721f, 0.456096828f},
-std::array<float,2>{0.559917271f, 0.114730529f},
-std::array<float,2>{0.153460339f, 0.606515586f},
-std::array<float,2>{0.824301481f, 0.767538011f},
-std::array<float,2>{0.403661132f, 0.431832433f},
-std::array<float,2>{0.965520918f, 0.360056043f},
-std::array<float,2>{0.290892392f, 0.906724215f},
-std::array<float,2>{0.701782107f, 0.712699294f},
-std::array<float,2>{0.0120294318f, 0.242464006f},
-std::array<float,2>{0.626322746f, 0.477155983f},
-std::array<float,2>{0.0891705304f, 0.834363401f},
-std::array<float,2>{0.885212839f, 0.515022755f},
-std::array<float,2>{0.36729902f, 0.0136769516f},
-std::array<float,2>{0.794766426f, 0.169358507f},
-std::array<float,2>{0.470548838f, 0.629483402f},
-std::array<float,2>{0.563928187f, 0.991957307f},
-std::array<float,2>{0.204666078f, 0.26124689f},
-std::array<float,2>{0.738329291f, 0.217702508f},
-std::array<float,2>{0.0520211682f, 0.740171373f},
-std::array<float,2>{0.993240595f, 0.887511134f},
-std::array<float,2>{0.257281959f, 0.337392271f},
-std::array<float,2>{0.848192096f, 0.379819661f},
-std::array<float,2>{0.418001056f, 0.794466138f},
-std::array<float,2>{0.523286819f, 0.564974308f},
-std::array<float,2>{0.162378296f, 0.0635898486f},
-std::array<float,2>{0.600891054f, 0.310665071f},
-std::array<float,2>{0.224043086f, 0.937781453f},
-std::array<float,2>{0.752375484f, 0.673131168f},
-std::array<float,2>{0.465683013f, 0.127540201f},
-std::array<float,2>{0.936928272f, 0.0383159034f},
-std::array<float,2>{0.343005598f, 0.536319435f},
-std::array<float,2>{0.677840233f, 0.853542924f},
-std::array<float,2>{0.116935737f, 0.440369427f},
-std::array<float,2>{0.663882136f, 0.0176533461f},
-std::array<float,2>{0.101561137f, 0.526444256f},
-std::array<float,2>{0.919419706f, 0.814120591f},
-std::array<float,2>{0.319452435f, 0.484812856f},
-std::array<float,2>{0.769666851f, 0.281009108f},
-std::array<float,2>{0.439253896f, 0.971170425f},
-std::array<float,2>{0.616610706f, 0.644880474f},
-std::array<float,2>{0.247781411f, 0.175292268f},
-std::array<float,2>{0.506174624f, 0.406775534f},
-std::array<float,2>{0.179660931f, 0.764617383f},
-std::array<float,2>{0.864151239f, 0.609951258f},
-std::array<float,2>{0.424739629f, 0.0984337106f},
-std::array<float,2>{0.978630424f, 0.226389453f},
-std::array<float,2>{0.274397224f, 0.700328588f},
-std::array<float,2>{0.731915951f, 0.935278535f},
-std::array<float,2>{0.0430886224f, 0.355010569f},
-std::array<float,2>{0.586382687f, 0.150771454f},
-std::array<float,2>{0.189104214f, 0.661501944f},
-std::array<float,2>{0.807710171f, 0.954112053f},
-std::array<float,2>{0.491223723f, 0.289185375f},
-std::array<float,2>{0.905081451f, 0.457105696f},
-std::array<float,2>{0.355433524f, 0.87493813f},
-std::array<float,2>{0.648424447f, 0.557878017f},
-std::array<float,2>{0.0688597336f, 0.0598923936f},
-std::array<float,2>{0.711480141f, 0.325001508f},
-std::array<float,2>{0.0295688752f, 0.895794511f},
-std::array<float,2>{0.9449175f, 0.729958177f},
-std::array<float,2>{0.311446458f, 0.190741494f},
-std::array<float,2>{0.841664076f, 0.0897637606f},
-std::array<float,2>{0.379009038f, 0.593033016f},
-std::array<float,2>{0.542163253f, 0.803425729f},
-std::array<float,2>{0.134545833f, 0.398310959f},
-std::array<float,2>{0.618408918f, 0.0528060086f},
-std::array<float,2>{0.240833372f, 0.550581455f},
-std::array<float,2>{0.773511946f, 0.861692309f},
-std::array<float,2>{0.446171463f, 0.463214636f},
-std::array<float,2>{0.912700295f, 0.288950443f},
-std::array<float,2>{0.324304342f, 0.968677104f},
-std::array<float,2>{0.665184379f, 0.669637263f},
-std::array<float,2>{0.109372728f, 0.146836519f},
-std::array<float,2>{0.720250249f, 0.405660391f},
-std::array<float,2>{0.0347554348f, 0.807545364f},
-std::array<float,2>{0.975563347f, 0.578735113f},
-std::array<float,2>{0.267991185f, 0.0824580193f},
-std::array<float,2>{0.873216927f, 0.20236288f},
-std::array<float,2>{0.43301636f, 0.722923577f},
-std::array<float,2>{0.51227957f, 0.905454576f},
-std::array<float,2>{0.186016619f, 0.315675408f},
-std::array<float,2>{0.649754822f, 0.185568139f},
-std::array<float,2>{0.0762442201f, 0.651252925f},
-std::array<float,2>{0.892194927f, 0.9771083f},
-std::array<float,2>{0.349714309f, 0.271658182f},
-std::array<float,2>{0.803636611f, 0.493624181f},
-std::array<float,2>{0.493115246f, 0.824770749f},
-std::array<float,2>{0.581293941f, 0.522532582f},
-std::array<float,2>{0.19718127f, 0.0245547686f},
-std::array<float,2>{0.538568258f, 0.344118863f},
-std::array<float,2>{0.128147021f, 0.922152936f},
-std::array<float,2>{0.834334135f, 0.694269001f},
-std::array<float,2>{0.386790514f, 0.231309518f},
-std::array<float,2>{0.94655019f, 0.107295111f},
-std::array<float,2>{0.301951557f, 0.623581171f},
-std::array<float,2>{0.707993865f, 0.754261732f},
-std::array<float,2>{0.0204714965f, 0.418132901f},
-std::array<float,2>{0.687566876f, 0.0755843818f},
-std::array<float,2>{0.00608269591f, 0.573595881f},
-std::array<float,2>{0.9559232f, 0.785225511f},
-std::array<float,2>{0.285429835f, 0.388560861f},
-std::array<float,2>{0.817149937f, 0.331409395f},
-std::array<float,2>{0.395595729f, 0.878808081f},
-std::array<float,2>{0.548508942f, 0.745514214f},
-std::array<float,2>{0.146607444f, 0.208790824f},
-std::array<float,2>{0.576874077f, 0.447565764f},
-std::array<float,2>{0.212607428f, 0.844760895f},
-std::array<float,2>{0.78203547f, 0.540342391f},
-std::array<float,2>{0.479507267f, 0.0409499817f},
-std::array<float,2>{0.878068566f, 0.136782557f},
-std::array<float,2>{0.36535272f, 0.687117577f},
-std::array<float,2>{0.637384295f, 0.952926815f},
-std::array<float,2>{0.0796524882f, 0.296974212f},
-std::array<float,2>{0.527885139f, 0.236845165f},
-std::array<float,2>{0.164619148f, 0.708476305f},
-std::array<float,2>{0.855255485f, 0.91532141f},
-std::array<float,2>{0.406856f, 0.372968346f},
-std::array<float,2>{0.991437554f, 0.428688049f},
-std::array<float,2>{0.259177983f, 0.775900662f},
-std::array<float,2>{0.742438853f, 0.601318181f},
-std::array<float,2>{0.0598906912f, 0.121152602f},
-std::array<float,2>{0.681674302f, 0.256290942f},
-std::array<float,2>{0.12013723f, 0.993336916f},
-std::array<float,2>{0.924954593f, 0.639735758f},
-std::array<float,2>{0.331913382f, 0.161761507f},
-std::array<float,2>{0.764598668f, 0.00277886214f},
-std::array<float,2>{0.459393501f, 0.504803061f},
-std::array<float,2>{0.606836855f, 0.838990152f},
-std::array<float,2>{0.230935469f, 0.47571826f},
-std::array<float,2>{0.610818803f, 0.0719283819f},
-std::array<float,2>{0.242637411f, 0.576218903f},
-std::array<float,2>{0.766918242f, 0.781553328f},
-std::array<float,2>{0.443653405f, 0.383440852f},
-std::array<float,2>{0.916379809f, 0.335517615f},
-std::array<float,2>{0.314053297f, 0.882561088f},
-std::array<float,2>{0.657324255f, 0.747100711f},
-std::array<float,2>{0.0938756615f, 0.206550062f},
-std::array<float,2>{0.729592502f, 0.449727118f},
-std::array<float,2>{0.0399021395f, 0.847948849f},
-std::array<float,2>{0.981965005f, 0.543992221f},
-std::array<float,2>{0.277779967f, 0.0447774529f},
-std::array<float,2>{0.862552643f, 0.133555174f},
-std::array<float,2>{0.426964819f, 0.681905746f},
-std::array<float,2>{0.501974165f, 0.945908427f},
-std::array<float,2>{0.175116122f, 0.304667622f},
-std::array<float,2>{0.64165771f, 0.240627185f},
-std::array<float,2>{0.0653913841f, 0.706517816f},
-std::array<float,2>{0.900967956f, 0.918711483f},
-std::array<float,2>{0.357279956f, 0.370700151f},
-std::array<float,2>{0.80872637f, 0.4253259f},
-std::array<float,2>{0.484806538f, 0.779346168f},
-std::array<float,2>{0.593608141f, 0.594747484f},
-std::array<float,2>{0.192304939f, 0.121028744f},
-std::array<float,2>{0.543712854f, 0.250023723f},
-std::array<float,2>{0.138859078f, 0.997969627f},
-std::array<float,2>{0.837726235f, 0.635417223f},
-std::array<float,2>{0.378375798f, 0.15926674f},
-std::array<float,2>{0.938158274f, 0.00456950255f},
-std::array<float,2>{0.305968732f, 0.502466202f},
-std::array<float,2>{0.716270268f, 0.841272593f},
-std::array<float,2>{0.0236305185f, 0.470677286f},
-std::array<float,2>{0.697288036f, 0.0480023362f},
-std::array<float,2>{0.00888986327f, 0.553355932f},
-std::array<float,2>{0.96147877f, 0.866923809f},
-std::array<float,2>{0.29489243f, 0.467107177f},
-std::array<float,2>{0.822440147f, 0.284833938f},
-std::array<float,2>{0.399987578f, 0.96406424f},
-std::array<float,2>{0.558255792f, 0.665571034f},
-std::array<float,2>{0.151054069f, 0.140918598f},
-std::array<float,2>{0.567807674f, 0.400244743f},
-std::array<float,2>{0.209769815f, 0.81016016f},
-std::array<float,2>{0.791433513f, 0.585236073f},
-std::array<float,2>{0.473989218f, 0.0786859617f},
-std::array<float,2>{0.88924706f, 0.1985351f},
-std::array<float,2>{0.372482479f, 0.719775796f},
-std::array<float,2>{0.630288303f, 0.901157081f},
-std::array<float,2>{0.0907813758f, 0.319594502f},
-std::array<float,2>{0.517062008f, 0.179703549f},
-std::array<float,2>{0.156728595f, 0.655292988f},
-std::array<float,2>{0.844069064f, 0.981916249f},
-std::array<float,2>{0.414562494f, 0.266675591f},
-std::array<float,2>{0.999124587f, 0.497558862f},
-std::array<float,2>{0.250835866f, 0.820410788f},
-std::array<float,2>{0.734779954f, 0.517962754f},
-std::array<float,2>{0.0469197594f, 0.027496336f},
-std::array<float,2>{0.674798965f, 0.348002672f},
-std::array<float,2>{0.11188779f, 0.928843975f},
-std::array<float,2>{0.931617677f, 0.689027488f},
-std::array<float,2>{0.336093783f, 0.229187012f},
-std::array<float,2>{0.757105172f, 0.102668136f},
-std::array<float,2>{0.463319838f, 0.620705128f},
-std::array<float,2>{0.597223878f, 0.750749528f},
-std::array<float,2>{0.221484885f, 0.417327166f},
-std::array<float,2>{0.552675366f, 0.0227024332f},
-std::array<float,2>{0.141838104f, 0.528605878f},
-std::array<float,2>{0.815596521f, 0.820138037f},
-std::array<float,2>{0.392359883f, 0.48932755f},
-std::array<float,2>{0.957703173f, 0.275311351f},
-std::array<float,2>{0.282539427f, 0.974600255f},
-std::array<float,2>{0.693276227f, 0.64288038f},
-std::array<float,2>{0.0032817584f, 0.179408029f},
-std::array<float,2>{0.6348508f, 0.41067186f},
-std::array<float,2>{0.0827839598f, 0.758721888f},
-std::array<float,2>{0.882513225f, 0.615571618f},
-std::array<float,2>{0.360567987f, 0.0955108777f},
-std::array<float,2>{0.785576165f, 0.219208553f},
-std::array<float,2>{0.483463824f, 0.696597755f},
-std::array<float,2>{0.572876573f, 0.932191014f},
-std::array<float,2>{0.21649234f, 0.358475327f},
-std::array<float,2>{0.748764932f, 0.154750794f},
-std::array<float,2>{0.0558671542f, 0.65879488f},
-std::array<float,2>{0.986677289f, 0.960885882f},
-std::array<float,2>{0.2633349f, 0.294608295f},
-std::array<float,2>{0.859040082f, 0.455960006f},
-std::array<float,2>{0.411372751f, 0.867310226f},
-std::array<float,2>{0.525965631f, 0.558940232f},
-std::array<float,2>{0.170994192f, 0.0568443686f},
-std::array<float,2>{0.601673961f, 0.321887016f},
-std::array<float,2>{0.228732958f, 0.891129553f},
-std::array<float,2>{0.757869899f, 0.732964635f},
-std::array<float,2>{0.455405623f, 0.192744032f},
-std::array<float,2>{0.926223874f, 0.0917380229f},
-std::array<float,2>{0.332953662f, 0.589315772f},
-std::array<float,2>{0.68496263f, 0.800444067f},
-std::array<float,2>{0.124653295f, 0.390788347f},
-std::array<float,2>{0.66974473f, 0.110668361f},
-std::array<float,2>{0.102865048f, 0.604466677f},
-std::array<float,2>{0.907877028f, 0.771739423f},
-std::array<float,2>{0.323571354f, 0.436575919f},
-std::array<float,2>{0.778285503f, 0.365161508f},
-std::array<float,2>{0.449611634f, 0.910570979f},
-std::array<float,2>{0.62121433f, 0.715976715f},
-std::array<float,2>{0.234751269f, 0.247407481f},
-std::array<float,2>{0.50896734f, 0.480998248f},
-std::array<float,2>{0.180574059f, 0.829183996f},
-std::array<float,2>{0.870186567f, 0.507885575f},
-std::array<float,2>{0.435504615f, 0.0103300065f},
-std::array<float,2>{0.96944958f, 0.166531652f},
-std::array<float,2>{0.271476507f, 0.625369966f},
-std::array<float,2>{0.724372268f, 0.985829592f},
-std::array<float,2>{0.0376199707f, 0.26445967f},
-std::array<float,2>{0.584743738f, 0.21124807f},
-std::array<float,2>{0.203021571f, 0.736768603f},
-std::array<float,2>{0.797741473f, 0.88330549f},
-std::array<float,2>{0.4982602f, 0.343239427f},
-std::array<float,2>{0.896593451f, 0.377370089f},
-std::array<float,2>{0.344050497f, 0.790033579f},
-std::array<float,2>{0.655527949f, 0.567892134f},
-std::array<float,2>{0.0732371062f, 0.0686663091f},
-std::array<float,2>{0.704485655f, 0.306837797f},
-std::array<float,2>{0.0167688504f, 0.941948712f},
-std::array<float,2>{0.950882196f, 0.678883493f},
-std::array<float,2>{0.298349917f, 0.13156274f},
-std::array<float,2>{0.831910551f, 0.0351020023f},
-std::array<float,2>{0.383930922f, 0.534979403f},
-std::array<float,2>{0.534344196f, 0.858109295f},
-std::array<float,2>{0.13021785f, 0.44303593f},
-std::array<float,2>{0.505757809f, 0.0990833715f},
-std::array<float,2>{0.177335992f, 0.611150682f},
-std::array<float,2>{0.867076755f, 0.764899194f},
-std::array<float,2>{0.422617286f, 0.408029824f},
-std::array<float,2>{0.976984978f, 0.354090393f},
-std::array<float,2>{0.275928557f, 0.933818161f},
-std::array<float,2>{0.733341575f, 0.699901104f},
-std::array<float,2>{0.0456797183f, 0.22461763f},
-std::array<float,2>{0.660757601f, 0.485845804f},
-std::array<float,2>{0.099357143f, 0.813457072f},
-std::array<float,2>{0.921182215f, 0.526192725f},
-std::array<float,2>{0.317296982f, 0.0191761851f},
-std::array<float,2>{0.773209631f, 0.174155161f},
-std::array<float,2>{0.44063431f, 0.645600379f},
-std::array<float,2>{0.615042567f, 0.972461045f},
-std::array<float,2>{0.249273479f, 0.279715329f},
-std::array<float,2>{0.713471353f, 0.190172166f},
-std::array<float,2>{0.0286467932f, 0.728626907f},
-std::array<float,2>{0.942932785f, 0.8952896f},
-std::array<float,2>{0.308893472f, 0.3253676f},
-std::array<float,2>{0.842156172f, 0.396581769f},
-std::array<float,2>{0.381588459f, 0.803992927f},
-std::array<float,2>{0.539815545f, 0.592038453f},
-std::array<float,2>{0.136654317f, 0.0884402394f},
-std::array<float,2>{0.589029729f, 0.290549606f},
-std::array<float,2>{0.190911055f, 0.953146458f},
-std::array<float,2>{0.80480808f, 0.660981655f},
-std::array<float,2>{0.489082575f, 0.151675403f},
-std::array<float,2>{0.903555334f, 0.0591353364f},
-std::array<float,2>{0.352288246f, 0.556816101f},
-std::array<float,2>{0.646266818f, 0.873763919f},
-std::array<float,2>{0.0675277561f, 0.458603829f},
-std::array<float,2>{0.627029717f, 0.0154651823f},
-std::array<float,2>{0.0865013748f, 0.514561415f},
-std::array<float,2>{0.884726167f, 0.835543931f},
-std::array<float,2>{0.370703608f, 0.478348166f},
-std::array<float,2>{0.796704113f, 0.260320127f},
-std::array<float,2>{0.472082645f, 0.990249276f},
-std::array<float,2>{0.564877152f, 0.630365968f},
-std::array<float,2>{0.205190644f, 0.168794155f},
-std::array<float,2>{0.561518133f, 0.43313235f},
-std::array<float,2>{0.154897481f, 0.765776217f},
-std::array<float,2>{0.827102184f, 0.606027722f},
-std::array<float,2>{0.405609995f, 0.113848753f},
-std::array<float,2>{0.967678905f, 0.243172735f},
-std::array<float,2>{0.292756468f, 0.711757183f},
-std::array<float,2>{0.700598419f, 0.907527626f},
-std::array<float,2>{0.0146871964f, 0.36090529f},
-std::array<float,2>{0.598474085f, 0.128719717f},
-std::array<float,2>{0.226061255f, 0.672672868f},
-std::array<float,2>{0.751555622f, 0.938729644f},
-std::array<float,2>{0.467404515f, 0.312454373f},
-std::array<float,2>{0.934287071f, 0.441239595f},
-std::array<float,2>{0.339947373f, 0.855374873f},
-std::array<float,2>{0.677584946f, 0.535173059f},
-std::array<float,2>{0.113393098f, 0.0378821492f},
-std::array<float,2>{0.741801441f, 0.336208552f},
-std::array<float,2>{0.0537222549f, 0.888261259f},
-std::array<float,2>{0.994653285f, 0.738785744f},
-std::array<float,2>{0.254830301f, 0.218014821f},
-std::array<float,2>{0.849669933f, 0.0625848845f},
-std::array<float,2>{0.421803027f, 0.565721929f},
-std::array<float,2>{0.521295547f, 0.793421149f},
-std::array<float,2>{0.161513284f, 0.380021483f},
-std::array<float,2>{0.574549913f, 0.0391738527f},
-std::array<float,2>{0.213348642f, 0.539736569f},
-std::array<float,2>{0.78337872f, 0.843833923f},
-std::array<float,2>{0.476994038f, 0.448922098f},
-std::array<float,2>{0.875361681f, 0.298098624f},
-std::array<float,2>{0.365230471f, 0.952036738f},
-std::array<float,2>{0.638718963f, 0.685887098f},
-std::array<float,2>{0.0815695077f, 0.138072371f},
-std::array<float,2>{0.690416634f, 0.38676241f},
-std::array<float,2>{0.00495109707f, 0.786947846f},
-std::array<float,2>{0.95316875f, 0.572816312f},
-std::array<float,2>{0.288037002f, 0.0747122541f},
-std::array<float,2>{0.81981957f, 0.207228273f},
-std::array<float,2>{0.396778852f, 0.745107889f},
-std::array<float,2>{0.550699115f, 0.877792776f},
-std::array<float,2>{0.145479605f, 0.33096686f},
-std::array<float,2>{0.680315495f, 0.160461724f},
-std::array<float,2>{0.117675945f, 0.63933742f},
-std::array<float,2>{0.92320776f, 0.992826462f},
-std::array<float,2>{0.329772741f, 0.256934792f},
-std::array<float,2>{0.761761367f, 0.475185812f},
-std::array<float,2>{0.458884686f, 0.838086963f},
-std::array<float,2>{0.608899593f, 0.504989147f},
-std::array<float,2>{0.233441994f, 0.00369230355f},
-std::array<float,2>{0.530851305f, 0.371222049f},
-std::array<float,2>{0.167507291f, 0.914131105f},
-std::array<float,2>{0.851563573f, 0.707578421f},
-std::array<float,2>{0.409581095f, 0.237735912f},
-std::array<float,2>{0.989007473f, 0.122618772f},
-std::array<float,2>{0.260207564f, 0.599811733f},
-std::array<float,2>{0.745654643f, 0.776674926f},
-std::array<float,2>{0.0618981272f, 0.429666609f},
-std::array<float,2>{0.721827269f, 0.0832595453f},
-std::array<float,2>{0.0327475592f, 0.579545259f},
-std::array<float,2>{0.973784029f, 0.808442295f},
-std::array<float,2>{0.266712368f, 0.404507995f},
-std::array<float,2>{0.871634841f, 0.315072864f},
-std::array<float,2>{0.430899948f, 0.90441829f},
-std::array<float,2>{0.515272915f, 0.72371906f},
-std::array<float,2>{0.184726566f, 0.20171088f},
-std::array<float,2>{0.620332062f, 0.464283824f},
-std::array<float,2>{0.238751799f, 0.863267839f},
-std::array<float,2>{0.776807606f, 0.549609661f},
-std::array<float,2>{0.448010713f, 0.053859137f},
-std::array<float,2>{0.910893321f, 0.147827864f},
-std::array<float,2>{0.326494932f, 0.668941438f},
-std::array<float,2>{0.666594088f, 0.967409134f},
-std::array<float,2>{0.107288927f, 0.287341267f},
-std::array<float,2>{0.535880089f, 0.232238159f},
-std::array<float,2>{0.126567841f, 0.694369018f},
-std::array<float,2>{0.833729982f, 0.923797727f},
-std::array<float,2>{0.390423447f, 0.345586747f},
-std::array<float,2>{0.947786212f, 0.41944465f},
-std::array<float,2>{0.30280146f, 0.754946709f},
-std::array<float,2>{0.709938705f, 0.624555886f},
-std::array<float,2>{0.0227238573f, 0.106011741f},
-std::array<float,2>{0.651905715f, 0.273056716f},
-std::array<float,2>{0.0744053125f, 0.977686882f},
-std::array<float,2>{0.894480526f, 0.652317762f},
-std::array<float,2>{0.348172098f, 0.187323838f},
-std::array<float,2>{0.801232159f, 0.0240771119f},
-std::array<float,2>{0.495131373f, 0.522124529f},
-std::array<float,2>{0.57963413f, 0.825818658f},
-std::array<float,2>{0.197651431f, 0.49274978f},
-std::array<float,2>{0.591502249f, 0.118974559f},
-std::array<float,2>{0.194861338f, 0.595742524f},
-std::array<float,2>{0.810584724f, 0.777647078f},
-std::array<float,2>{0.487177998f, 0.423696101f},
-std::array<float,2>{0.898984909f, 0.36732161f},
-std::array<float,2>{0.359124571f, 0.921304464f},
-std::array<float,2>{0.642973244f, 0.704583704f},
-std::array<float,2>{0.0629686117f, 0.23867768f},
-std::array<float,2>{0.718200624f, 0.471969247f},
-std::array<float,2>{0.026898263f, 0.843308985f},
-std::array<float,2>{0.940786898f, 0.500807405f},
-std::array<float,2>{0.308198124f, 0.00644674757f},
-std::array<float,2>{0.838702679f, 0.158184096f},
-std::array<float,2>{0.375155121f, 0.632998765f},
-std::array<float,2>{0.545642316f, 0.999271333f},
-std::array<float,2>{0.138160884f, 0.253059417f},
-std::array<float,2>{0.659791827f, 0.204858929f},
-std::array<float,2>{0.0958605334f, 0.749385178f},
-std::array<float,2>{0.914292157f, 0.880513728f},
-std::array<float,2>{0.31450069f, 0.333692968f},
-std::array<float,2>{0.769298792f, 0.384937108f},
-std::array<float,2>{0.443253785f, 0.783636153f},
-std::array<float,2>{0.612906814f, 0.57554698f},
-std::array<float,2>{0.245790333f, 0.0722804591f},
-std::array<float,2>{0.501941502f, 0.301506251f},
-std::array<float,2>{0.17275165f, 0.949144244f},
-std::array<float,2>{0.860328317f, 0.680104077f},
-std::array<float,2>{0.429662645f, 0.136359677f},
-std::array<float,2>{0.982600451f, 0.0466194078f},
-std::array<float,2>{0.279696316f, 0.545842648f},
-std::array<float,2>{0.727654815f, 0.850369871f},
-std::array<float,2>{0.0411226377f, 0.452639252f},
-std::array<float,2>{0.737845361f, 0.0304776821f},
-std::array<float,2>{0.0490847118f, 0.517355561f},
-std::array<float,2>{0.997397542f, 0.823222101f},
-std::array<float,2>{0.252315849f, 0.499991953f},
-std::array<float,2>{0.846603692f, 0.26914987f},
-std::array<float,2>{0.417378515f, 0.984352648f},
-std::array<float,2>{0.519204438f, 0.654239833f},
-std::array<float,2>{0.159768596f, 0.182705611f},
-std::array<float,2>{0.595655322f, 0.415234685f},
-std::array<float,2>{0.220572904f, 0.752162039f},
-std::array<float,2>{0.755707324f, 0.618842781f},
-std::array<float,2>{0.461231619f, 0.103701003f},
-std::array<float,2>{0.931930423f, 0.227456003f},
-std::array<float,2>{0.338224441f, 0.69057852f},
-std::array<float,2>{0.672360122f, 0.925799549f},
-std::array<float,2>{0.110228248f, 0.350523323f},
-std::array<float,2>{0.556566894f, 0.142810911f},
-std::array<float,2>{0.150063962f, 0.667554736f},
-std::array<float,2>{0.820688605f, 0.962613046f},
-std::array<float,2>{0.40214783f, 0.282296449f},
-std::array<float,2>{0.964798033f, 0.465358973f},
-std::array<float,2>{0.295341849f, 0.86357677f},
-std::array<float,2>{0.695717752f, 0.551227808f},
-std::array<float,2>{0.0100034922f, 0.0496822298f},
-std::array<float,2>{0.632807434f, 0.318233311f},
-std::array<float,2>{0.0923136771f, 0.899074137f},
-std::array<float,2>{0.887035728f, 0.721552908f},
-std::array<float,2>{0.373566628f, 0.196128815f},
-std::array<float,2>{0.789178312f, 0.0810703039f},
-std::array<float,2>{0.476520717f, 0.583352089f},
-std::array<float,2>{0.569789529f, 0.811790109f},
-std::array<float,2>{0.208230495f, 0.401332617f},
-std::array<float,2>{0.525348604f, 0.0553759187f},
-std::array<float,2>{0.168734252f, 0.561103582f},
-std::array<float,2>{0.855798721f, 0.869211733f},
-std::array<float,2>{0.413137555f, 0.453284144f},
-std::array<float,2>{0.985969245f, 0.296705246f},
-std::array<float,2>{0.265051901f, 0.958923876f},
-std::array<float,2>{0.747577369f, 0.657872915f},
-std::array<float,2>{0.0577167235f, 0.153575078f},
-std::array<float,2>{0.686906934f, 0.393907964f},
-std::array<float,2>{0.123045474f, 0.797492683f},
-std::array<float,2>{0.929491043f, 0.586119175f},
-std::array<float,2>{0.335845947f, 0.0920959562f},
-std::array<float,2>{0.761425674f, 0.194252044f},
-std::array<float,2>{0.453519195f, 0.731723607f},
-std::array<float,2>{0.605268478f, 0.89262861f},
-std::array<float,2>{0.226628855f, 0.324193448f},
-std::array<float,2>{0.693643808f, 0.177317157f},
-std::array<float,2>{0.000564296555f, 0.641560256f},
-std::array<float,2>{0.960173011f, 0.975564122f},
-std::array<float,2>{0.283951551f, 0.27640909f},
-std::array<float,2>{0.813181758f, 0.492184132f},
-std::array<float,2>{0.392908424f, 0.817590892f},
-std::array<float,2>{0.55274111f, 0.530020118f},
-std::array<float,2>{0.144330934f, 0.0203589275f},
-std::array<float,2>{0.571442723f, 0.355490476f},
-std::array<float,2>{0.216943592f, 0.930306673f},
-std::array<float,2>{0.787786722f, 0.698972881f},
-std::array<float,2>{0.480875641f, 0.221724927f},
-std::array<float,2>{0.880372763f, 0.0962201878f},
-std::array<float,2>{0.361989677f, 0.615089536f},
-std::array<float,2>{0.634506941f, 0.760682404f},
-std::array<float,2>{0.0858732611f, 0.413052797f},
-std::array<float,2>{0.652547777f, 0.067418851f},
-std::array<float,2>{0.0715774894f, 0.56941849f},
-std::array<float,2>{0.895817876f, 0.792780042f},
-std::array<float,2>{0.345888168f, 0.375864744f},
-std::array<float,2>{0.799759507f, 0.340760946f},
-std::array<float,2>{0.496317893f, 0.8852247f},
-std::array<float,2>{0.583522737f, 0.736156583f},
-std::array<float,2>{0.199863315f, 0.213792935f},
-std::array<float,2>{0.532067835f, 0.444736302f},
-std::array<float,2>{0.132376477f, 0.856276631f},
-std::array<float,2>{0.828438222f, 0.531977952f},
-std::array<float,2>{0.386295736f, 0.032791771f},
-std::array<float,2>{0.951323688f, 0.129601926f},
-std::array<float,2>{0.299243003f, 0.677508175f},
-std::array<float,2>{0.705937326f, 0.943903983f},
-std::array<float,2>{0.0184010137f, 0.305299461f},
-std::array<float,2>{0.623540282f, 0.248489544f},
-std::array<float,2>{0.238073289f, 0.718615651f},
-std::array<float,2>{0.780138612f, 0.912114143f},
-std::array<float,2>{0.452847928f, 0.365322322f},
-std::array<float,2>{0.908211946f, 0.434048235f},
-std::array<float,2>{0.321244657f, 0.770521581f},
-std::array<float,2>{0.670142949f, 0.602540612f},
-std::array<float,2>{0.105034016f, 0.113016002f},
-std::array<float,2>{0.726054668f, 0.261838764f},
-std::array<float,2>{0.0368508548f, 0.987160444f},
-std::array<float,2>{0.970963955f, 0.627753794f},
-std::array<float,2>{0.271885782f, 0.165009663f},
-std::array<float,2>{0.8688609f, 0.00944954716f},
-std::array<float,2>{0.436715156f, 0.51061213f},
-std::array<float,2>{0.510171652f, 0.830593228f},
-std::array<float,2>{0.183028221f, 0.484253675f},
-std::array<float,2>{0.541925728f, 0.0873186812f},
-std::array<float,2>{0.13289386f, 0.591554582f},
-std::array<float,2>{0.840089202f, 0.802337527f},
-std::array<float,2>{0.380556762f, 0.396287769f},
-std::array<float,2>{0.94398433f, 0.32795471f},
-std::array<float,2>{0.312122434f, 0.897620797f},
-std::array<float,2>{0.712046623f, 0.727664709f},
-std::array<float,2>{0.0304936785f, 0.188576385f},
-std::array<float,2>{0.646700859f, 0.459869891f},
-std::array<float,2>{0.0693520829f, 0.872683108f},
-std::array<float,2>{0.906077981f, 0.555100143f},
-std::array<float,2>{0.35361281f, 0.0608877167f},
-std::array<float,2>{0.807017565f, 0.150167927f},
-std::array<float,2>{0.491034448f, 0.663183451f},
-std::array<float,2>{0.586970389f, 0.956957221f},
-std::array<float,2>{0.187550843f, 0.29129371f},
-std::array<float,2>{0.730631173f, 0.22428754f},
-std::array<float,2>{0.0444978625f, 0.701240122f},
-std::array<float,2>{0.980425835f, 0.936223507f},
-std::array<float,2>{0.274799973f, 0.353050262f},
-std::array<float,2>{0.864598572f, 0.4084014f},
-std::array<float,2>{0.425239056f, 0.763367772f},
-std::array<float,2>{0.507203341f, 0.612201333f},
-std::array<float,2>{0.178584278f, 0.100011826f},
-std::array<float,2>{0.615429342f, 0.278470308f},
-std::array<float,2>{0.24636589f, 0.970129728f},
-std::array<float,2>{0.770604372f, 0.647781491f},
-std::array<float,2>{0.438119918f, 0.172993615f},
-std::array<float,2>{0.918068528f, 0.0173739679f},
-std::array<float,2>{0.319282055f, 0.524035454f},
-std::array<float,2>{0.6627388f, 0.816257238f},
-std::array<float,2>{0.100443147f, 0.487748444f},
-std::array<float,2>{0.679533005f, 0.0366182998f},
-std::array<float,2>{0.115800574f, 0.537875533f},
-std::array<float,2>{0.936379433f, 0.852304995f},
-std::array<float,2>{0.342677236f, 0.438479066f},
-std::array<float,2>{0.753610134f, 0.31012702f},
-std::array<float,2>{0.466181368f, 0.940107763f},
-std::array<float,2>{0.600356221f, 0.67425549f},
-std::array<float,2>{0.223013282f, 0.126545414f},
-std::array<float,2>{0.521685004f, 0.382388562f},
-std::array<float,2>{0.163194224f, 0.796526074f},
-std::array<float,2>{0.849430859f, 0.563196719f},
-std::array<float,2>{0.419384927f, 0.0658352003f},
-std::array<float,2>{0.992657304f, 0.216753215f},
-std::array<float,2>{0.256772906f, 0.740461528f},
-std::array<float,2>{0.73964864f, 0.889832556f},
-std::array<float,2>{0.0508260429f, 0.338910282f},
-std::array<float,2>{0.563358009f, 0.170346543f},
-std::array<float,2>{0.204005063f, 0.631869972f},
-std::array<float,2>{0.793502629f, 0.990010619f},
-std::array<float,2>{0.469276071f, 0.258693844f},
-std::array<float,2>{0.886570036f, 0.480085284f},
-std::array<float,2>{0.368529767f, 0.832464457f},
-std::array<float,2>{0.625384092f, 0.512250006f},
-std::array<float,2>{0.0888439119f, 0.0119980583f},
-std::array<float,2>{0.702766836f, 0.362695366f},
-std::array<float,2>{0.0131539917f, 0.908740222f},
-std::array<float,2>{0.966158152f, 0.713464141f},
-std::array<float,2>{0.289730459f, 0.245185569f},
-std::array<float,2>{0.825390875f, 0.117106952f},
-std::array<float,2>{0.403311133f, 0.608946741f},
-std::array<float,2>{0.559441388f, 0.769410133f},
-std::array<float,2>{0.152545348f, 0.43111819f},
-std::array<float,2>{0.606416583f, 0.00172140822f},
-std::array<float,2>{0.231893256f, 0.506325185f},
-std::array<float,2>{0.765493929f, 0.836613595f},
-std::array<float,2>{0.46004197f, 0.474353224f},
-std::array<float,2>{0.92396158f, 0.253984392f},
-std::array<float,2>{0.330169201f, 0.996028423f},
-std::array<float,2>{0.683523238f, 0.638549984f},
-std::array<float,2>{0.11918553f, 0.162901327f},
-std::array<float,2>{0.743709445f, 0.42769143f},
-std::array<float,2>{0.0595423914f, 0.773775756f},
-std::array<float,2>{0.990698457f, 0.598061383f},
-std::array<float,2>{0.25877288f, 0.124068394f},
-std::array<float,2>{0.85431838f, 0.234864116f},
-std::array<float,2>{0.408158958f, 0.71041286f},
-std::array<float,2>{0.528497994f, 0.917498827f},
-std::array<float,2>{0.165462404f, 0.373882681f},
-std::array<float,2>{0.638355076f, 0.140279412f},
-std::array<float,2>{0.0785915479f, 0.685468912f},
-std::array<float,2>{0.877029419f, 0.949929059f},
-std::array<float,2>{0.366610795f, 0.300228745f},
-std::array<float,2>{0.783050299f, 0.44686076f},
-std::array<float,2>{0.478681773f, 0.847185135f},
-std::array<float,2>{0.577320695f, 0.5429492f},
-std::array<float,2>{0.211093336f, 0.0413440503f},
-std::array<float,2>{0.547776878f, 0.328191429f},
-std::array<float,2>{0.147581145f, 0.876901746f},
-std::array<float,2>{0.817975044f, 0.7429322f},
-std::array<float,2>{0.394542515f, 0.21028547f},
-std::array<float,2>{0.956586421f, 0.0766253546f},
-std::array<float,2>{0.286878228f, 0.571988583f},
-std::array<float,2>{0.689236641f, 0.788577616f},
-std::array<float,2>{0.00763583416f, 0.388805538f},
-std::array<float,2>{0.708545983f, 0.107641295f},
-std::array<float,2>{0.0211190395f, 0.622399271f},
-std::array<float,2>{0.945919871f, 0.75766474f},
-std::array<float,2>{0.30087164f, 0.419960558f},
-std::array<float,2>{0.835882843f, 0.346921533f},
-std::array<float,2>{0.387961954f, 0.92496258f},
-std::array<float,2>{0.538051248f, 0.691920221f},
-std::array<float,2>{0.127473906f, 0.23320879f},
-std::array<float,2>{0.580522418f, 0.495819956f},
-std::array<float,2>{0.195734233f, 0.827360153f},
-std::array<float,2>{0.804574668f, 0.520086408f},
-std::array<float,2>{0.493182629f, 0.0263507031f},
-std::array<float,2>{0.891085446f, 0.184783384f},
-std::array<float,2>{0.350620508f, 0.648849189f},
-std::array<float,2>{0.648772061f, 0.979922593f},
-std::array<float,2>{0.0777862296f, 0.269824743f},
-std::array<float,2>{0.512828529f, 0.200945482f},
-std::array<float,2>{0.187139004f, 0.725384772f},
-std::array<float,2>{0.874908745f, 0.904109597f},
-std::array<float,2>{0.432452053f, 0.313151896f},
-std::array<float,2>{0.976391792f, 0.403603405f},
-std::array<float,2>{0.269012421f, 0.804996908f},
-std::array<float,2>{0.718831956f, 0.58155328f},
-std::array<float,2>{0.0341724269f, 0.085069783f},
-std::array<float,2>{0.664566278f, 0.285771251f},
-std::array<float,2>{0.108177029f, 0.965916216f},
-std::array<float,2>{0.913471401f, 0.670601428f},
-std::array<float,2>{0.325602472f, 0.146308973f},
-std::array<float,2>{0.775063753f, 0.0522519276f},
-std::array<float,2>{0.44711709f, 0.547434568f},
-std::array<float,2>{0.617517471f, 0.861128151f},
-std::array<float,2>{0.241410688f, 0.461700797f}}
\ No newline at end of file
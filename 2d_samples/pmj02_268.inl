@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.757038057f, 0.631645918f},
-std::array<float,2>{0.181262657f, 0.0623988099f},
-std::array<float,2>{0.379630566f, 0.850916445f},
-std::array<float,2>{0.64555335f, 0.44141221f},
-std::array<float,2>{0.549269795f, 0.875372589f},
-std::array<float,2>{0.368127674f, 0.324256629f},
-std::array<float,2>{0.0518531837f, 0.521081626f},
-std::array<float,2>{0.913038552f, 0.23612757f},
-std::array<float,2>{0.990916252f, 0.806527495f},
-std::array<float,2>{0.100581698f, 0.42182079f},
-std::array<float,2>{0.254807442f, 0.720033705f},
-std::array<float,2>{0.569013238f, 0.0735138655f},
-std::array<float,2>{0.707231164f, 0.582962096f},
-std::array<float,2>{0.487457186f, 0.16342102f},
-std::array<float,2>{0.238287315f, 0.958980322f},
-std::array<float,2>{0.85626328f, 0.256612241f},
-std::array<float,2>{0.905103505f, 0.559081435f},
-std::array<float,2>{0.0239576437f, 0.192245796f},
-std::array<float,2>{0.343246937f, 0.912786067f},
-std::array<float,2>{0.503822863f, 0.351707697f},
-std::array<float,2>{0.687285662f, 0.822733521f},
-std::array<float,2>{0.408770502f, 0.494179487f},
-std::array<float,2>{0.15391849f, 0.671221793f},
-std::array<float,2>{0.801973939f, 0.00629757717f},
-std::array<float,2>{0.829894066f, 0.996816754f},
-std::array<float,2>{0.20256497f, 0.301103145f},
-std::array<float,2>{0.466491401f, 0.619508862f},
-std::array<float,2>{0.741844893f, 0.152700797f},
-std::array<float,2>{0.594927967f, 0.713696718f},
-std::array<float,2>{0.294436514f, 0.0957869664f},
-std::array<float,2>{0.0845104754f, 0.768875003f},
-std::array<float,2>{0.957752466f, 0.396416128f},
-std::array<float,2>{0.948933423f, 0.735351205f},
-std::array<float,2>{0.0645403564f, 0.0935856923f},
-std::array<float,2>{0.309758484f, 0.788987398f},
-std::array<float,2>{0.612433553f, 0.429931223f},
-std::array<float,2>{0.726759613f, 0.937537789f},
-std::array<float,2>{0.442507535f, 0.26897493f},
-std::array<float,2>{0.216918856f, 0.563221812f},
-std::array<float,2>{0.819106996f, 0.1728331f},
-std::array<float,2>{0.786737621f, 0.867163777f},
-std::array<float,2>{0.137662113f, 0.466997147f},
-std::array<float,2>{0.430790454f, 0.651957929f},
-std::array<float,2>{0.656560123f, 0.0371031426f},
-std::array<float,2>{0.527022779f, 0.504413903f},
-std::array<float,2>{0.317366898f, 0.22718285f},
-std::array<float,2>{0.0126090972f, 0.895953059f},
-std::array<float,2>{0.877646983f, 0.333158374f},
-std::array<float,2>{0.861105502f, 0.605482936f},
-std::array<float,2>{0.220679983f, 0.133845508f},
-std::array<float,2>{0.482480705f, 0.981355011f},
-std::array<float,2>{0.702455759f, 0.294496685f},
-std::array<float,2>{0.588217795f, 0.760548651f},
-std::array<float,2>{0.265634596f, 0.37992093f},
-std::array<float,2>{0.111322835f, 0.687769473f},
-std::array<float,2>{0.97628969f, 0.117224433f},
-std::array<float,2>{0.926687121f, 0.930609643f},
-std::array<float,2>{0.0387849547f, 0.374647677f},
-std::array<float,2>{0.343896896f, 0.543021739f},
-std::array<float,2>{0.541190386f, 0.20604834f},
-std::array<float,2>{0.634176731f, 0.68611902f},
-std::array<float,2>{0.398012519f, 0.0224848576f},
-std::array<float,2>{0.161148906f, 0.833794832f},
-std::array<float,2>{0.778504968f, 0.477470577f},
-std::array<float,2>{0.822332561f, 0.699565828f},
-std::array<float,2>{0.206781104f, 0.114653312f},
-std::array<float,2>{0.447810858f, 0.752750754f},
-std::array<float,2>{0.719050884f, 0.388496548f},
-std::array<float,2>{0.622658253f, 0.972749174f},
-std::array<float,2>{0.302646726f, 0.282575548f},
-std::array<float,2>{0.0743444711f, 0.600522161f},
-std::array<float,2>{0.942843676f, 0.130252421f},
-std::array<float,2>{0.890533447f, 0.837699294f},
-std::array<float,2>{0.00715326425f, 0.471527278f},
-std::array<float,2>{0.327327788f, 0.673302591f},
-std::array<float,2>{0.517887592f, 0.0235720631f},
-std::array<float,2>{0.66451335f, 0.537984252f},
-std::array<float,2>{0.423167825f, 0.215131447f},
-std::array<float,2>{0.129007176f, 0.921914279f},
-std::array<float,2>{0.791552305f, 0.363841206f},
-std::array<float,2>{0.979982734f, 0.576080382f},
-std::array<float,2>{0.122196361f, 0.181512013f},
-std::array<float,2>{0.278347671f, 0.950009704f},
-std::array<float,2>{0.58234036f, 0.280507267f},
-std::array<float,2>{0.689093411f, 0.793289602f},
-std::array<float,2>{0.475565255f, 0.422631323f},
-std::array<float,2>{0.229063243f, 0.74574703f},
-std::array<float,2>{0.867978752f, 0.0804265812f},
-std::array<float,2>{0.767779529f, 0.899264574f},
-std::array<float,2>{0.17057468f, 0.337818861f},
-std::array<float,2>{0.404128462f, 0.511106491f},
-std::array<float,2>{0.627137721f, 0.219263867f},
-std::array<float,2>{0.536152005f, 0.643765867f},
-std::array<float,2>{0.351908207f, 0.0443701893f},
-std::array<float,2>{0.0448487662f, 0.873154521f},
-std::array<float,2>{0.932068825f, 0.459883809f},
-std::array<float,2>{0.918717563f, 0.662546337f},
-std::array<float,2>{0.0623459928f, 0.00918718241f},
-std::array<float,2>{0.36709559f, 0.815217316f},
-std::array<float,2>{0.554859638f, 0.49001798f},
-std::array<float,2>{0.656186044f, 0.921268046f},
-std::array<float,2>{0.383147597f, 0.348721385f},
-std::array<float,2>{0.177873269f, 0.55437237f},
-std::array<float,2>{0.760195732f, 0.199125007f},
-std::array<float,2>{0.849744081f, 0.777407169f},
-std::array<float,2>{0.246298671f, 0.399644613f},
-std::array<float,2>{0.495809376f, 0.710867465f},
-std::array<float,2>{0.715764582f, 0.102075711f},
-std::array<float,2>{0.577895761f, 0.615512729f},
-std::array<float,2>{0.263687223f, 0.145136997f},
-std::array<float,2>{0.103373125f, 0.991070449f},
-std::array<float,2>{0.998219132f, 0.308693349f},
-std::array<float,2>{0.80888027f, 0.531241238f},
-std::array<float,2>{0.144005656f, 0.243413135f},
-std::array<float,2>{0.418634862f, 0.887696683f},
-std::array<float,2>{0.672148645f, 0.319235653f},
-std::array<float,2>{0.512709141f, 0.853360772f},
-std::array<float,2>{0.335122436f, 0.450159073f},
-std::array<float,2>{0.0222229157f, 0.638173103f},
-std::array<float,2>{0.894507051f, 0.05126293f},
-std::array<float,2>{0.964464903f, 0.963716984f},
-std::array<float,2>{0.0867590904f, 0.258195847f},
-std::array<float,2>{0.28617844f, 0.592126966f},
-std::array<float,2>{0.607628942f, 0.164629817f},
-std::array<float,2>{0.745891511f, 0.727609456f},
-std::array<float,2>{0.459304631f, 0.0626497716f},
-std::array<float,2>{0.189622521f, 0.796879947f},
-std::array<float,2>{0.837060452f, 0.412704408f},
-std::array<float,2>{0.794327855f, 0.726219237f},
-std::array<float,2>{0.127846718f, 0.0776251778f},
-std::array<float,2>{0.428596556f, 0.809819162f},
-std::array<float,2>{0.669364512f, 0.416921496f},
-std::array<float,2>{0.521231234f, 0.955096126f},
-std::array<float,2>{0.323746711f, 0.252009809f},
-std::array<float,2>{0.00336034223f, 0.579515219f},
-std::array<float,2>{0.883308768f, 0.15835543f},
-std::array<float,2>{0.939425886f, 0.844147801f},
-std::array<float,2>{0.0723002702f, 0.438228369f},
-std::array<float,2>{0.299526483f, 0.627935946f},
-std::array<float,2>{0.619193852f, 0.0583791547f},
-std::array<float,2>{0.724288106f, 0.516208947f},
-std::array<float,2>{0.45110321f, 0.240764409f},
-std::array<float,2>{0.210866019f, 0.879269361f},
-std::array<float,2>{0.826703608f, 0.323695093f},
-std::array<float,2>{0.934063494f, 0.623568594f},
-std::array<float,2>{0.040728841f, 0.151502371f},
-std::array<float,2>{0.35608986f, 0.994263709f},
-std::array<float,2>{0.533195198f, 0.298616737f},
-std::array<float,2>{0.629628539f, 0.770251572f},
-std::array<float,2>{0.399570256f, 0.393498451f},
-std::array<float,2>{0.167449728f, 0.716723382f},
-std::array<float,2>{0.769638717f, 0.0983917564f},
-std::array<float,2>{0.871111095f, 0.906335056f},
-std::array<float,2>{0.234013692f, 0.356353968f},
-std::array<float,2>{0.468770087f, 0.556050599f},
-std::array<float,2>{0.693081796f, 0.188238144f},
-std::array<float,2>{0.578315914f, 0.666928828f},
-std::array<float,2>{0.273878157f, 0.000493685307f},
-std::array<float,2>{0.120063141f, 0.824952304f},
-std::array<float,2>{0.982322454f, 0.49963361f},
-std::array<float,2>{0.993842959f, 0.655131102f},
-std::array<float,2>{0.106963418f, 0.0316644944f},
-std::array<float,2>{0.260157615f, 0.86057353f},
-std::array<float,2>{0.574177682f, 0.461710334f},
-std::array<float,2>{0.712967038f, 0.89321655f},
-std::array<float,2>{0.496327549f, 0.328914523f},
-std::array<float,2>{0.243561566f, 0.50162369f},
-std::array<float,2>{0.843983829f, 0.233619794f},
-std::array<float,2>{0.765308499f, 0.785093844f},
-std::array<float,2>{0.172672898f, 0.437052459f},
-std::array<float,2>{0.389437795f, 0.74146086f},
-std::array<float,2>{0.650438428f, 0.0886566415f},
-std::array<float,2>{0.560348928f, 0.569851756f},
-std::array<float,2>{0.360296071f, 0.177924097f},
-std::array<float,2>{0.0562800989f, 0.944144785f},
-std::array<float,2>{0.916128516f, 0.270415395f},
-std::array<float,2>{0.840214372f, 0.54028964f},
-std::array<float,2>{0.193959177f, 0.209574893f},
-std::array<float,2>{0.454662055f, 0.935062826f},
-std::array<float,2>{0.747672021f, 0.370191395f},
-std::array<float,2>{0.602358878f, 0.830871761f},
-std::array<float,2>{0.284411639f, 0.482454807f},
-std::array<float,2>{0.0930682644f, 0.68209666f},
-std::array<float,2>{0.967820704f, 0.0174457747f},
-std::array<float,2>{0.895438612f, 0.978171408f},
-std::array<float,2>{0.0159018748f, 0.29161793f},
-std::array<float,2>{0.329767168f, 0.605162561f},
-std::array<float,2>{0.508300185f, 0.138961479f},
-std::array<float,2>{0.677958548f, 0.694796324f},
-std::array<float,2>{0.415075421f, 0.122689374f},
-std::array<float,2>{0.145274669f, 0.764274418f},
-std::array<float,2>{0.808237433f, 0.377266496f},
-std::array<float,2>{0.852443635f, 0.677271783f},
-std::array<float,2>{0.234778404f, 0.0295728538f},
-std::array<float,2>{0.491658092f, 0.842962027f},
-std::array<float,2>{0.703522921f, 0.473758817f},
-std::array<float,2>{0.566197813f, 0.926855326f},
-std::array<float,2>{0.252364278f, 0.359609038f},
-std::array<float,2>{0.0954284519f, 0.534047008f},
-std::array<float,2>{0.986138225f, 0.211626217f},
-std::array<float,2>{0.906528592f, 0.754457593f},
-std::array<float,2>{0.0484584048f, 0.383847892f},
-std::array<float,2>{0.374980032f, 0.697125256f},
-std::array<float,2>{0.55361712f, 0.10959357f},
-std::array<float,2>{0.642181277f, 0.59745121f},
-std::array<float,2>{0.378504932f, 0.127556339f},
-std::array<float,2>{0.18614389f, 0.969960451f},
-std::array<float,2>{0.750698984f, 0.287127554f},
-std::array<float,2>{0.955231845f, 0.51550436f},
-std::array<float,2>{0.0795321539f, 0.224571198f},
-std::array<float,2>{0.292185664f, 0.905781269f},
-std::array<float,2>{0.601413548f, 0.339888453f},
-std::array<float,2>{0.735651553f, 0.870486915f},
-std::array<float,2>{0.46392867f, 0.453684241f},
-std::array<float,2>{0.197797671f, 0.647115052f},
-std::array<float,2>{0.834760427f, 0.0395394713f},
-std::array<float,2>{0.798226297f, 0.948069215f},
-std::array<float,2>{0.151625857f, 0.275440872f},
-std::array<float,2>{0.41127184f, 0.57142663f},
-std::array<float,2>{0.681513906f, 0.183936998f},
-std::array<float,2>{0.505134642f, 0.746461332f},
-std::array<float,2>{0.339177459f, 0.0837918818f},
-std::array<float,2>{0.0310048014f, 0.789136469f},
-std::array<float,2>{0.898696303f, 0.427623361f},
-std::array<float,2>{0.879745841f, 0.703261852f},
-std::array<float,2>{0.0115378695f, 0.105530001f},
-std::array<float,2>{0.31391871f, 0.774886429f},
-std::array<float,2>{0.528882384f, 0.403538406f},
-std::array<float,2>{0.661538839f, 0.986153662f},
-std::array<float,2>{0.434063822f, 0.307923526f},
-std::array<float,2>{0.1338972f, 0.61328119f},
-std::array<float,2>{0.784705043f, 0.143960372f},
-std::array<float,2>{0.812864244f, 0.816966116f},
-std::array<float,2>{0.211819932f, 0.487963587f},
-std::array<float,2>{0.437693536f, 0.658329308f},
-std::array<float,2>{0.732271016f, 0.014320991f},
-std::array<float,2>{0.615302324f, 0.547858715f},
-std::array<float,2>{0.306795418f, 0.199464634f},
-std::array<float,2>{0.0687018484f, 0.917372525f},
-std::array<float,2>{0.949854076f, 0.344585806f},
-std::array<float,2>{0.774050474f, 0.586584806f},
-std::array<float,2>{0.159615099f, 0.16944766f},
-std::array<float,2>{0.393554598f, 0.967099667f},
-std::array<float,2>{0.636865497f, 0.265074313f},
-std::array<float,2>{0.544416547f, 0.801403403f},
-std::array<float,2>{0.347803175f, 0.409836173f},
-std::array<float,2>{0.0329003446f, 0.734203637f},
-std::array<float,2>{0.922187686f, 0.0690316856f},
-std::array<float,2>{0.971268713f, 0.885654926f},
-std::array<float,2>{0.117156237f, 0.313663006f},
-std::array<float,2>{0.272315174f, 0.524830818f},
-std::array<float,2>{0.593144953f, 0.249860361f},
-std::array<float,2>{0.695914805f, 0.635428965f},
-std::array<float,2>{0.478511155f, 0.0494255982f},
-std::array<float,2>{0.225213677f, 0.857893527f},
-std::array<float,2>{0.866532266f, 0.445778996f},
-std::array<float,2>{0.80371201f, 0.66894716f},
-std::array<float,2>{0.155703232f, 0.00537953479f},
-std::array<float,2>{0.407286376f, 0.821493924f},
-std::array<float,2>{0.685494721f, 0.492677331f},
-std::array<float,2>{0.501117468f, 0.910395265f},
-std::array<float,2>{0.340720177f, 0.353581578f},
-std::array<float,2>{0.0261411481f, 0.561055303f},
-std::array<float,2>{0.903364301f, 0.19371897f},
-std::array<float,2>{0.960886776f, 0.767205119f},
-std::array<float,2>{0.0824389532f, 0.39703086f},
-std::array<float,2>{0.296234131f, 0.711835921f},
-std::array<float,2>{0.595735133f, 0.0952267051f},
-std::array<float,2>{0.739654958f, 0.618832588f},
-std::array<float,2>{0.468293071f, 0.154849872f},
-std::array<float,2>{0.200661495f, 0.999503613f},
-std::array<float,2>{0.831628323f, 0.304035723f},
-std::array<float,2>{0.911041796f, 0.522731543f},
-std::array<float,2>{0.0536684655f, 0.238247395f},
-std::array<float,2>{0.370584667f, 0.878149629f},
-std::array<float,2>{0.547628284f, 0.327768892f},
-std::array<float,2>{0.647545576f, 0.84839946f},
-std::array<float,2>{0.380952477f, 0.44529894f},
-std::array<float,2>{0.181672797f, 0.629515707f},
-std::array<float,2>{0.755501688f, 0.0591549315f},
-std::array<float,2>{0.857610881f, 0.959968746f},
-std::array<float,2>{0.240989074f, 0.254178315f},
-std::array<float,2>{0.484467953f, 0.584281504f},
-std::array<float,2>{0.710842431f, 0.161455661f},
-std::array<float,2>{0.567923486f, 0.721464217f},
-std::array<float,2>{0.256892771f, 0.0713612437f},
-std::array<float,2>{0.0981716067f, 0.808448672f},
-std::array<float,2>{0.988634229f, 0.41814518f},
-std::array<float,2>{0.973861098f, 0.689757526f},
-std::array<float,2>{0.112770937f, 0.120593585f},
-std::array<float,2>{0.268643916f, 0.759232342f},
-std::array<float,2>{0.586576402f, 0.381767064f},
-std::array<float,2>{0.700606644f, 0.983056009f},
-std::array<float,2>{0.481840402f, 0.29650858f},
-std::array<float,2>{0.221885234f, 0.608647525f},
-std::array<float,2>{0.863007545f, 0.136669219f},
-std::array<float,2>{0.78102392f, 0.835815191f},
-std::array<float,2>{0.164060876f, 0.478544861f},
-std::array<float,2>{0.395348817f, 0.685255468f},
-std::array<float,2>{0.635778129f, 0.0206176769f},
-std::array<float,2>{0.539107859f, 0.546423197f},
-std::array<float,2>{0.346171498f, 0.203377172f},
-std::array<float,2>{0.0368901268f, 0.933176219f},
-std::array<float,2>{0.929143488f, 0.372271746f},
-std::array<float,2>{0.818017602f, 0.565712869f},
-std::array<float,2>{0.215862468f, 0.174846902f},
-std::array<float,2>{0.443749011f, 0.940339744f},
-std::array<float,2>{0.730057776f, 0.267359763f},
-std::array<float,2>{0.609592617f, 0.786982477f},
-std::array<float,2>{0.311362356f, 0.43256557f},
-std::array<float,2>{0.0633849576f, 0.737320721f},
-std::array<float,2>{0.945819139f, 0.0901031494f},
-std::array<float,2>{0.876933932f, 0.897826612f},
-std::array<float,2>{0.0140510239f, 0.334064156f},
-std::array<float,2>{0.319608271f, 0.507478952f},
-std::array<float,2>{0.524547696f, 0.228972048f},
-std::array<float,2>{0.658884645f, 0.650219321f},
-std::array<float,2>{0.431872874f, 0.0371336862f},
-std::array<float,2>{0.139778525f, 0.863825321f},
-std::array<float,2>{0.78738153f, 0.466393083f},
-std::array<float,2>{0.869584203f, 0.743474603f},
-std::array<float,2>{0.226958722f, 0.0795232728f},
-std::array<float,2>{0.472873807f, 0.796243429f},
-std::array<float,2>{0.690710366f, 0.425450653f},
-std::array<float,2>{0.585538328f, 0.95135814f},
-std::array<float,2>{0.279639035f, 0.278816044f},
-std::array<float,2>{0.124359041f, 0.577822626f},
-std::array<float,2>{0.97760582f, 0.183070347f},
-std::array<float,2>{0.930821836f, 0.871532738f},
-std::array<float,2>{0.0454247631f, 0.457589358f},
-std::array<float,2>{0.353687346f, 0.642361164f},
-std::array<float,2>{0.538644493f, 0.0466664992f},
-std::array<float,2>{0.62558651f, 0.50894165f},
-std::array<float,2>{0.406142026f, 0.221034899f},
-std::array<float,2>{0.168269992f, 0.902000368f},
-std::array<float,2>{0.766061604f, 0.339012265f},
-std::array<float,2>{0.943696141f, 0.597971916f},
-std::array<float,2>{0.0777661875f, 0.131454691f},
-std::array<float,2>{0.304657698f, 0.975890458f},
-std::array<float,2>{0.623304486f, 0.284194767f},
-std::array<float,2>{0.721704602f, 0.750383973f},
-std::array<float,2>{0.44534573f, 0.389474124f},
-std::array<float,2>{0.204011321f, 0.701767027f},
-std::array<float,2>{0.822056472f, 0.11624781f},
-std::array<float,2>{0.789892495f, 0.924416482f},
-std::array<float,2>{0.130863369f, 0.365392774f},
-std::array<float,2>{0.425578982f, 0.535652101f},
-std::array<float,2>{0.667208612f, 0.216999829f},
-std::array<float,2>{0.516027808f, 0.675233483f},
-std::array<float,2>{0.325807989f, 0.0273122061f},
-std::array<float,2>{0.00476812711f, 0.839435697f},
-std::array<float,2>{0.88803637f, 0.469940096f},
-std::array<float,2>{0.891880035f, 0.640479386f},
-std::array<float,2>{0.0196140539f, 0.053209234f},
-std::array<float,2>{0.33208406f, 0.854977489f},
-std::array<float,2>{0.515308201f, 0.452917457f},
-std::array<float,2>{0.674356341f, 0.888717353f},
-std::array<float,2>{0.420977563f, 0.317834854f},
-std::array<float,2>{0.140824497f, 0.527912199f},
-std::array<float,2>{0.811540544f, 0.244693667f},
-std::array<float,2>{0.838449657f, 0.798866391f},
-std::array<float,2>{0.18924363f, 0.411048979f},
-std::array<float,2>{0.457497358f, 0.729331672f},
-std::array<float,2>{0.743362188f, 0.0650580525f},
-std::array<float,2>{0.605741382f, 0.59087944f},
-std::array<float,2>{0.287731349f, 0.1664906f},
-std::array<float,2>{0.0882523656f, 0.962090254f},
-std::array<float,2>{0.961203814f, 0.25993523f},
-std::array<float,2>{0.757841527f, 0.551981509f},
-std::array<float,2>{0.175802425f, 0.196629703f},
-std::array<float,2>{0.385489792f, 0.918909967f},
-std::array<float,2>{0.653073788f, 0.350886941f},
-std::array<float,2>{0.557629108f, 0.81435883f},
-std::array<float,2>{0.364329606f, 0.492035866f},
-std::array<float,2>{0.0586681738f, 0.660456479f},
-std::array<float,2>{0.920842946f, 0.0103141218f},
-std::array<float,2>{0.996751249f, 0.989929974f},
-std::array<float,2>{0.10534893f, 0.311672479f},
-std::array<float,2>{0.263231158f, 0.614482939f},
-std::array<float,2>{0.57615459f, 0.147305235f},
-std::array<float,2>{0.718470812f, 0.708712041f},
-std::array<float,2>{0.493558705f, 0.103627793f},
-std::array<float,2>{0.248310924f, 0.779298246f},
-std::array<float,2>{0.847712398f, 0.40172413f},
-std::array<float,2>{0.772596538f, 0.718704581f},
-std::array<float,2>{0.165640235f, 0.0998422652f},
-std::array<float,2>{0.400565356f, 0.772420704f},
-std::array<float,2>{0.631424487f, 0.391854763f},
-std::array<float,2>{0.534098029f, 0.992990077f},
-std::array<float,2>{0.358881056f, 0.300636768f},
-std::array<float,2>{0.0425339602f, 0.622858047f},
-std::array<float,2>{0.936038733f, 0.150115639f},
-std::array<float,2>{0.984207332f, 0.826744378f},
-std::array<float,2>{0.117650047f, 0.4968988f},
-std::array<float,2>{0.27624765f, 0.664123714f},
-std::array<float,2>{0.580907941f, 0.00368466135f},
-std::array<float,2>{0.693703294f, 0.557010114f},
-std::array<float,2>{0.470822155f, 0.190300658f},
-std::array<float,2>{0.231412575f, 0.909374416f},
-std::array<float,2>{0.874228656f, 0.357539713f},
-std::array<float,2>{0.885277629f, 0.581239402f},
-std::array<float,2>{0.00153545977f, 0.156328738f},
-std::array<float,2>{0.3217884f, 0.95437485f},
-std::array<float,2>{0.522937655f, 0.251915097f},
-std::array<float,2>{0.67131424f, 0.812200665f},
-std::array<float,2>{0.425814122f, 0.414296836f},
-std::array<float,2>{0.125988901f, 0.72324723f},
-std::array<float,2>{0.795368016f, 0.0761690736f},
-std::array<float,2>{0.824328899f, 0.882244825f},
-std::array<float,2>{0.207493052f, 0.321654081f},
-std::array<float,2>{0.452098757f, 0.517589629f},
-std::array<float,2>{0.726112187f, 0.240034267f},
-std::array<float,2>{0.618821383f, 0.625586808f},
-std::array<float,2>{0.296925008f, 0.0554940104f},
-std::array<float,2>{0.070786044f, 0.846678734f},
-std::array<float,2>{0.940408826f, 0.440130711f},
-std::array<float,2>{0.966082156f, 0.681004405f},
-std::array<float,2>{0.0912079588f, 0.0192471929f},
-std::array<float,2>{0.283179671f, 0.829924345f},
-std::array<float,2>{0.60423398f, 0.481682539f},
-std::array<float,2>{0.748943865f, 0.936928689f},
-std::array<float,2>{0.456249267f, 0.36904636f},
-std::array<float,2>{0.192100018f, 0.542280078f},
-std::array<float,2>{0.843411863f, 0.207472607f},
-std::array<float,2>{0.805111408f, 0.762828469f},
-std::array<float,2>{0.148021117f, 0.376132846f},
-std::array<float,2>{0.41698736f, 0.692915142f},
-std::array<float,2>{0.677421451f, 0.124422349f},
-std::array<float,2>{0.511221468f, 0.602496624f},
-std::array<float,2>{0.331529289f, 0.137392581f},
-std::array<float,2>{0.0180287566f, 0.979499578f},
-std::array<float,2>{0.897606432f, 0.289814502f},
-std::array<float,2>{0.846404135f, 0.502467036f},
-std::array<float,2>{0.244969219f, 0.232119024f},
-std::array<float,2>{0.49984321f, 0.891063213f},
-std::array<float,2>{0.712791085f, 0.330419004f},
-std::array<float,2>{0.571148098f, 0.861405134f},
-std::array<float,2>{0.258353025f, 0.464823395f},
-std::array<float,2>{0.107882634f, 0.653763652f},
-std::array<float,2>{0.994657278f, 0.0343180113f},
-std::array<float,2>{0.91561836f, 0.94161582f},
-std::array<float,2>{0.0570472889f, 0.272612691f},
-std::array<float,2>{0.363069415f, 0.567175567f},
-std::array<float,2>{0.562053382f, 0.177070171f},
-std::array<float,2>{0.649295568f, 0.738866687f},
-std::array<float,2>{0.387811601f, 0.0875732973f},
-std::array<float,2>{0.174430594f, 0.781299055f},
-std::array<float,2>{0.762920201f, 0.434132963f},
-std::array<float,2>{0.833619356f, 0.644622803f},
-std::array<float,2>{0.195435122f, 0.0421535894f},
-std::array<float,2>{0.461481512f, 0.867784262f},
-std::array<float,2>{0.738089025f, 0.455195248f},
-std::array<float,2>{0.59958744f, 0.902971745f},
-std::array<float,2>{0.290120482f, 0.34369126f},
-std::array<float,2>{0.0811551139f, 0.512475848f},
-std::array<float,2>{0.953842402f, 0.224810585f},
-std::array<float,2>{0.901943207f, 0.792403936f},
-std::array<float,2>{0.0275840368f, 0.428333342f},
-std::array<float,2>{0.33686161f, 0.748186052f},
-std::array<float,2>{0.505891025f, 0.0850915089f},
-std::array<float,2>{0.683364213f, 0.573728681f},
-std::array<float,2>{0.413010985f, 0.187216297f},
-std::array<float,2>{0.148581162f, 0.946210086f},
-std::array<float,2>{0.799703777f, 0.274345756f},
-std::array<float,2>{0.987938583f, 0.531673253f},
-std::array<float,2>{0.0974194631f, 0.212907448f},
-std::array<float,2>{0.25169149f, 0.928778172f},
-std::array<float,2>{0.56289959f, 0.36240992f},
-std::array<float,2>{0.705366135f, 0.841325462f},
-std::array<float,2>{0.489591241f, 0.476506025f},
-std::array<float,2>{0.237304077f, 0.678428948f},
-std::array<float,2>{0.854186833f, 0.0292887557f},
-std::array<float,2>{0.753673255f, 0.970810831f},
-std::array<float,2>{0.184637591f, 0.28608191f},
-std::array<float,2>{0.376775891f, 0.595459402f},
-std::array<float,2>{0.643809736f, 0.125412598f},
-std::array<float,2>{0.550981402f, 0.698328733f},
-std::array<float,2>{0.37217316f, 0.11263328f},
-std::array<float,2>{0.0497346036f, 0.757433057f},
-std::array<float,2>{0.909665465f, 0.386088073f},
-std::array<float,2>{0.925060868f, 0.730573714f},
-std::array<float,2>{0.0335179344f, 0.0666096583f},
-std::array<float,2>{0.350062847f, 0.803205967f},
-std::array<float,2>{0.54577297f, 0.406957924f},
-std::array<float,2>{0.639966071f, 0.964964747f},
-std::array<float,2>{0.391064048f, 0.263379842f},
-std::array<float,2>{0.15744935f, 0.588577032f},
-std::array<float,2>{0.775815845f, 0.171781823f},
-std::array<float,2>{0.864910424f, 0.856551945f},
-std::array<float,2>{0.22327964f, 0.447368681f},
-std::array<float,2>{0.480116159f, 0.634000301f},
-std::array<float,2>{0.697423279f, 0.0485051237f},
-std::array<float,2>{0.591422975f, 0.527124345f},
-std::array<float,2>{0.269785196f, 0.246350721f},
-std::array<float,2>{0.114402421f, 0.884244919f},
-std::array<float,2>{0.969943464f, 0.315907776f},
-std::array<float,2>{0.782297075f, 0.610803664f},
-std::array<float,2>{0.136183545f, 0.141513675f},
-std::array<float,2>{0.436719418f, 0.987559676f},
-std::array<float,2>{0.663606763f, 0.304910988f},
-std::array<float,2>{0.529358566f, 0.776722074f},
-std::array<float,2>{0.316033155f, 0.404488593f},
-std::array<float,2>{0.00820374861f, 0.705212891f},
-std::array<float,2>{0.882512748f, 0.108997278f},
-std::array<float,2>{0.951204121f, 0.91445601f},
-std::array<float,2>{0.0664855614f, 0.346779794f},
-std::array<float,2>{0.304842442f, 0.549901366f},
-std::array<float,2>{0.613640428f, 0.201561332f},
-std::array<float,2>{0.733589888f, 0.657879353f},
-std::array<float,2>{0.440333992f, 0.0117410682f},
-std::array<float,2>{0.21383521f, 0.819594622f},
-std::array<float,2>{0.81601876f, 0.485008866f},
-std::array<float,2>{0.777683616f, 0.684128523f},
-std::array<float,2>{0.160161898f, 0.020228792f},
-std::array<float,2>{0.39740932f, 0.83479625f},
-std::array<float,2>{0.633124232f, 0.479859769f},
-std::array<float,2>{0.542394161f, 0.932504952f},
-std::array<float,2>{0.345666796f, 0.371196628f},
-std::array<float,2>{0.038048014f, 0.545036435f},
-std::array<float,2>{0.926771879f, 0.204495803f},
-std::array<float,2>{0.974697292f, 0.7582286f},
-std::array<float,2>{0.110003881f, 0.382219195f},
-std::array<float,2>{0.266616344f, 0.690632105f},
-std::array<float,2>{0.589552999f, 0.119903043f},
-std::array<float,2>{0.701241434f, 0.608333945f},
-std::array<float,2>{0.48373732f, 0.135116637f},
-std::array<float,2>{0.219222099f, 0.984291196f},
-std::array<float,2>{0.859716356f, 0.295838892f},
-std::array<float,2>{0.878492117f, 0.505931437f},
-std::array<float,2>{0.0135122566f, 0.229900286f},
-std::array<float,2>{0.318287104f, 0.896559834f},
-std::array<float,2>{0.525728583f, 0.33547017f},
-std::array<float,2>{0.65774262f, 0.865003467f},
-std::array<float,2>{0.430302411f, 0.465571374f},
-std::array<float,2>{0.1379098f, 0.649106562f},
-std::array<float,2>{0.785695374f, 0.0385183841f},
-std::array<float,2>{0.819459975f, 0.941274107f},
-std::array<float,2>{0.218477368f, 0.265765667f},
-std::array<float,2>{0.441604882f, 0.564662933f},
-std::array<float,2>{0.728317261f, 0.174624905f},
-std::array<float,2>{0.611858726f, 0.736390948f},
-std::array<float,2>{0.309543014f, 0.0917411298f},
-std::array<float,2>{0.0657067671f, 0.785338163f},
-std::array<float,2>{0.94749707f, 0.433566719f},
-std::array<float,2>{0.958232105f, 0.712061584f},
-std::array<float,2>{0.0858197808f, 0.0941623747f},
-std::array<float,2>{0.293442905f, 0.766179085f},
-std::array<float,2>{0.594194293f, 0.39809376f},
-std::array<float,2>{0.740612745f, 0.998500884f},
-std::array<float,2>{0.465042055f, 0.303452671f},
-std::array<float,2>{0.20157896f, 0.617470324f},
-std::array<float,2>{0.828306317f, 0.155614585f},
-std::array<float,2>{0.801699519f, 0.821150005f},
-std::array<float,2>{0.153286323f, 0.493312895f},
-std::array<float,2>{0.409249574f, 0.668005109f},
-std::array<float,2>{0.686519146f, 0.00424991734f},
-std::array<float,2>{0.502067924f, 0.562009811f},
-std::array<float,2>{0.342743367f, 0.194417283f},
-std::array<float,2>{0.0248616133f, 0.91169256f},
-std::array<float,2>{0.905877531f, 0.355129033f},
-std::array<float,2>{0.856851876f, 0.58562541f},
-std::array<float,2>{0.239409834f, 0.160737455f},
-std::array<float,2>{0.486709863f, 0.959734619f},
-std::array<float,2>{0.708072424f, 0.255015314f},
-std::array<float,2>{0.569358766f, 0.807252645f},
-std::array<float,2>{0.25532639f, 0.418970942f},
-std::array<float,2>{0.100813828f, 0.721926391f},
-std::array<float,2>{0.991367519f, 0.0711830109f},
-std::array<float,2>{0.913572669f, 0.877082884f},
-std::array<float,2>{0.0507965758f, 0.327065259f},
-std::array<float,2>{0.368381172f, 0.521560609f},
-std::array<float,2>{0.549815834f, 0.236446649f},
-std::array<float,2>{0.645156026f, 0.630138814f},
-std::array<float,2>{0.380096465f, 0.0605393983f},
-std::array<float,2>{0.179754302f, 0.849176764f},
-std::array<float,2>{0.756397307f, 0.444027424f},
-std::array<float,2>{0.83669889f, 0.729903042f},
-std::array<float,2>{0.191035375f, 0.0662863329f},
-std::array<float,2>{0.460784853f, 0.800569475f},
-std::array<float,2>{0.744903564f, 0.412001312f},
-std::array<float,2>{0.608557403f, 0.960999846f},
-std::array<float,2>{0.28538397f, 0.261330724f},
-std::array<float,2>{0.0875811502f, 0.590195239f},
-std::array<float,2>{0.962891936f, 0.167239055f},
-std::array<float,2>{0.893414676f, 0.854089141f},
-std::array<float,2>{0.0227838345f, 0.452076107f},
-std::array<float,2>{0.334282577f, 0.638844788f},
-std::array<float,2>{0.512450218f, 0.0539481081f},
-std::array<float,2>{0.673461556f, 0.52918911f},
-std::array<float,2>{0.41902256f, 0.245276868f},
-std::array<float,2>{0.142896205f, 0.890423119f},
-std::array<float,2>{0.810106993f, 0.316907585f},
-std::array<float,2>{0.99971658f, 0.614069998f},
-std::array<float,2>{0.102189235f, 0.147923991f},
-std::array<float,2>{0.265249521f, 0.989020169f},
-std::array<float,2>{0.5770154f, 0.311107695f},
-std::array<float,2>{0.716653943f, 0.780904651f},
-std::array<float,2>{0.494868457f, 0.401313037f},
-std::array<float,2>{0.247872829f, 0.707369745f},
-std::array<float,2>{0.85124594f, 0.104824796f},
-std::array<float,2>{0.760932207f, 0.919244707f},
-std::array<float,2>{0.178875476f, 0.350341588f},
-std::array<float,2>{0.384443849f, 0.551691592f},
-std::array<float,2>{0.654438376f, 0.195994943f},
-std::array<float,2>{0.556171656f, 0.661827087f},
-std::array<float,2>{0.365245253f, 0.0109266089f},
-std::array<float,2>{0.060861852f, 0.813194036f},
-std::array<float,2>{0.919798851f, 0.491022378f},
-std::array<float,2>{0.933317244f, 0.64146024f},
-std::array<float,2>{0.0437963195f, 0.0451994613f},
-std::array<float,2>{0.353059858f, 0.872599781f},
-std::array<float,2>{0.535728574f, 0.458030254f},
-std::array<float,2>{0.628514826f, 0.900830865f},
-std::array<float,2>{0.402574867f, 0.338797927f},
-std::array<float,2>{0.171065405f, 0.50788182f},
-std::array<float,2>{0.769215286f, 0.222066641f},
-std::array<float,2>{0.868825257f, 0.795865357f},
-std::array<float,2>{0.230352759f, 0.423972696f},
-std::array<float,2>{0.475972831f, 0.742489755f},
-std::array<float,2>{0.688404262f, 0.0781592429f},
-std::array<float,2>{0.583096385f, 0.576520026f},
-std::array<float,2>{0.277602166f, 0.181746393f},
-std::array<float,2>{0.121900663f, 0.952303171f},
-std::array<float,2>{0.97883749f, 0.277836591f},
-std::array<float,2>{0.792586863f, 0.536730111f},
-std::array<float,2>{0.130788684f, 0.218483135f},
-std::array<float,2>{0.422359437f, 0.925470829f},
-std::array<float,2>{0.66564101f, 0.366872877f},
-std::array<float,2>{0.518995821f, 0.838136971f},
-std::array<float,2>{0.326627463f, 0.468807042f},
-std::array<float,2>{0.00651740655f, 0.673974693f},
-std::array<float,2>{0.889337182f, 0.0261799227f},
-std::array<float,2>{0.941476345f, 0.974852443f},
-std::array<float,2>{0.0760988519f, 0.283958882f},
-std::array<float,2>{0.300988138f, 0.599070191f},
-std::array<float,2>{0.621949553f, 0.132575884f},
-std::array<float,2>{0.720143378f, 0.702422202f},
-std::array<float,2>{0.4484272f, 0.116198152f},
-std::array<float,2>{0.205679193f, 0.751435459f},
-std::array<float,2>{0.823748767f, 0.39011094f},
-std::array<float,2>{0.807543278f, 0.692046702f},
-std::array<float,2>{0.146235347f, 0.12338683f},
-std::array<float,2>{0.414935678f, 0.762475073f},
-std::array<float,2>{0.679435015f, 0.375071794f},
-std::array<float,2>{0.509351552f, 0.97943455f},
-std::array<float,2>{0.328499347f, 0.290502161f},
-std::array<float,2>{0.0170764811f, 0.603222728f},
-std::array<float,2>{0.895880282f, 0.138636902f},
-std::array<float,2>{0.96773994f, 0.828398108f},
-std::array<float,2>{0.0924917087f, 0.481087536f},
-std::array<float,2>{0.283624291f, 0.67972976f},
-std::array<float,2>{0.603078187f, 0.0182111152f},
-std::array<float,2>{0.746135592f, 0.541095912f},
-std::array<float,2>{0.453322202f, 0.208569616f},
-std::array<float,2>{0.194450244f, 0.935603857f},
-std::array<float,2>{0.841586888f, 0.367586583f},
-std::array<float,2>{0.917377949f, 0.567657351f},
-std::array<float,2>{0.0548331849f, 0.175967515f},
-std::array<float,2>{0.361239851f, 0.942869127f},
-std::array<float,2>{0.559471726f, 0.272312939f},
-std::array<float,2>{0.651961565f, 0.782523453f},
-std::array<float,2>{0.389965326f, 0.434997231f},
-std::array<float,2>{0.172852963f, 0.739546478f},
-std::array<float,2>{0.763811886f, 0.0868880823f},
-std::array<float,2>{0.844947994f, 0.892090917f},
-std::array<float,2>{0.243090138f, 0.331811666f},
-std::array<float,2>{0.497288823f, 0.503467858f},
-std::array<float,2>{0.714695036f, 0.231306404f},
-std::array<float,2>{0.572712362f, 0.652518928f},
-std::array<float,2>{0.261322975f, 0.0334349647f},
-std::array<float,2>{0.106191933f, 0.86312902f},
-std::array<float,2>{0.9928689f, 0.462943941f},
-std::array<float,2>{0.980502665f, 0.665968359f},
-std::array<float,2>{0.120813593f, 0.00259396248f},
-std::array<float,2>{0.275371253f, 0.827226639f},
-std::array<float,2>{0.57919383f, 0.497800142f},
-std::array<float,2>{0.691542208f, 0.908555269f},
-std::array<float,2>{0.470527202f, 0.358923942f},
-std::array<float,2>{0.23287344f, 0.558244228f},
-std::array<float,2>{0.872160792f, 0.190538794f},
-std::array<float,2>{0.770584166f, 0.772845566f},
-std::array<float,2>{0.166155249f, 0.390928149f},
-std::array<float,2>{0.398892879f, 0.717653632f},
-std::array<float,2>{0.630502164f, 0.100751072f},
-std::array<float,2>{0.532150328f, 0.62163198f},
-std::array<float,2>{0.356843412f, 0.149213061f},
-std::array<float,2>{0.0392835811f, 0.994041443f},
-std::array<float,2>{0.935070097f, 0.29888165f},
-std::array<float,2>{0.827152431f, 0.519184947f},
-std::array<float,2>{0.208996058f, 0.238825887f},
-std::array<float,2>{0.449358642f, 0.881128728f},
-std::array<float,2>{0.723272741f, 0.321069896f},
-std::array<float,2>{0.621041059f, 0.846684277f},
-std::array<float,2>{0.30070594f, 0.440476835f},
-std::array<float,2>{0.0733931512f, 0.626063347f},
-std::array<float,2>{0.937726319f, 0.0557033122f},
-std::array<float,2>{0.884393334f, 0.953204632f},
-std::array<float,2>{0.0026993698f, 0.250504196f},
-std::array<float,2>{0.32264474f, 0.580970526f},
-std::array<float,2>{0.520402789f, 0.157274559f},
-std::array<float,2>{0.668389082f, 0.724054098f},
-std::array<float,2>{0.429071844f, 0.0745850354f},
-std::array<float,2>{0.127945036f, 0.811350942f},
-std::array<float,2>{0.793456554f, 0.415151566f},
-std::array<float,2>{0.86594522f, 0.633571327f},
-std::array<float,2>{0.226461202f, 0.0469447561f},
-std::array<float,2>{0.477412015f, 0.8560974f},
-std::array<float,2>{0.696588337f, 0.449066043f},
-std::array<float,2>{0.59248358f, 0.883379102f},
-std::array<float,2>{0.272695601f, 0.314501703f},
-std::array<float,2>{0.116016008f, 0.526190877f},
-std::array<float,2>{0.971967161f, 0.247345656f},
-std::array<float,2>{0.923433959f, 0.804028869f},
-std::array<float,2>{0.0316825956f, 0.407799631f},
-std::array<float,2>{0.34918502f, 0.731828928f},
-std::array<float,2>{0.543600559f, 0.0677471384f},
-std::array<float,2>{0.637935638f, 0.589447081f},
-std::array<float,2>{0.394499481f, 0.170200348f},
-std::array<float,2>{0.15864788f, 0.966525614f},
-std::array<float,2>{0.774471998f, 0.262470305f},
-std::array<float,2>{0.95041126f, 0.549299657f},
-std::array<float,2>{0.0697048306f, 0.202370301f},
-std::array<float,2>{0.307877898f, 0.915648282f},
-std::array<float,2>{0.616722465f, 0.346013576f},
-std::array<float,2>{0.731048942f, 0.818417609f},
-std::array<float,2>{0.438650638f, 0.485904664f},
-std::array<float,2>{0.212057039f, 0.656584978f},
-std::array<float,2>{0.814290047f, 0.0133841224f},
-std::array<float,2>{0.783636391f, 0.98655349f},
-std::array<float,2>{0.133612663f, 0.306378841f},
-std::array<float,2>{0.435205638f, 0.609766722f},
-std::array<float,2>{0.660287201f, 0.141828477f},
-std::array<float,2>{0.528045714f, 0.706544518f},
-std::array<float,2>{0.312775642f, 0.107873231f},
-std::array<float,2>{0.0102583179f, 0.776266813f},
-std::array<float,2>{0.880209744f, 0.405394137f},
-std::array<float,2>{0.900305331f, 0.749159515f},
-std::array<float,2>{0.0296864305f, 0.0843709633f},
-std::array<float,2>{0.338247359f, 0.791607678f},
-std::array<float,2>{0.504458606f, 0.42950514f},
-std::array<float,2>{0.68035996f, 0.947180271f},
-std::array<float,2>{0.41096279f, 0.274530023f},
-std::array<float,2>{0.151255578f, 0.572767913f},
-std::array<float,2>{0.797360301f, 0.186178625f},
-std::array<float,2>{0.835634649f, 0.868218839f},
-std::array<float,2>{0.199020207f, 0.456853777f},
-std::array<float,2>{0.463301986f, 0.646187484f},
-std::array<float,2>{0.734743118f, 0.0411567017f},
-std::array<float,2>{0.599740624f, 0.513508558f},
-std::array<float,2>{0.291473359f, 0.226388931f},
-std::array<float,2>{0.0788485482f, 0.903438032f},
-std::array<float,2>{0.956868649f, 0.342739224f},
-std::array<float,2>{0.751466155f, 0.594551086f},
-std::array<float,2>{0.187119558f, 0.126012355f},
-std::array<float,2>{0.377441436f, 0.972121119f},
-std::array<float,2>{0.641120195f, 0.287092477f},
-std::array<float,2>{0.554685295f, 0.756263673f},
-std::array<float,2>{0.373434484f, 0.385463893f},
-std::array<float,2>{0.0472256057f, 0.697835147f},
-std::array<float,2>{0.907894135f, 0.111920692f},
-std::array<float,2>{0.984668911f, 0.928674281f},
-std::array<float,2>{0.094163917f, 0.361587524f},
-std::array<float,2>{0.253265172f, 0.532424986f},
-std::array<float,2>{0.56512022f, 0.2141103f},
-std::array<float,2>{0.704118848f, 0.67954874f},
-std::array<float,2>{0.490630805f, 0.027639458f},
-std::array<float,2>{0.236316919f, 0.840053201f},
-std::array<float,2>{0.852879643f, 0.474681735f},
-std::array<float,2>{0.788604677f, 0.650485635f},
-std::array<float,2>{0.138863355f, 0.0355504006f},
-std::array<float,2>{0.433357418f, 0.865931034f},
-std::array<float,2>{0.659581065f, 0.467854738f},
-std::array<float,2>{0.524026453f, 0.894829333f},
-std::array<float,2>{0.319145977f, 0.332672805f},
-std::array<float,2>{0.0150863072f, 0.505080163f},
-std::array<float,2>{0.875786483f, 0.227586627f},
-std::array<float,2>{0.947193921f, 0.787946165f},
-std::array<float,2>{0.0637928918f, 0.431269646f},
-std::array<float,2>{0.311653405f, 0.735850871f},
-std::array<float,2>{0.610676944f, 0.0924539194f},
-std::array<float,2>{0.728532493f, 0.564211786f},
-std::array<float,2>{0.444798917f, 0.173122808f},
-std::array<float,2>{0.215210557f, 0.938749373f},
-std::array<float,2>{0.817335725f, 0.268148512f},
-std::array<float,2>{0.927980363f, 0.544168651f},
-std::array<float,2>{0.035352055f, 0.206432685f},
-std::array<float,2>{0.347336769f, 0.931630313f},
-std::array<float,2>{0.540665507f, 0.373064667f},
-std::array<float,2>{0.634913325f, 0.83234179f},
-std::array<float,2>{0.396478325f, 0.478058428f},
-std::array<float,2>{0.162635908f, 0.68746227f},
-std::array<float,2>{0.779913783f, 0.0224506315f},
-std::array<float,2>{0.861398101f, 0.981931388f},
-std::array<float,2>{0.220948547f, 0.293000758f},
-std::array<float,2>{0.480803758f, 0.606625497f},
-std::array<float,2>{0.699471414f, 0.133199707f},
-std::array<float,2>{0.587085724f, 0.688621521f},
-std::array<float,2>{0.268068254f, 0.118405506f},
-std::array<float,2>{0.111837164f, 0.76132077f},
-std::array<float,2>{0.973619044f, 0.379377604f},
-std::array<float,2>{0.989877164f, 0.719700038f},
-std::array<float,2>{0.0991787612f, 0.0723744482f},
-std::array<float,2>{0.256168932f, 0.80518353f},
-std::array<float,2>{0.567167401f, 0.420127898f},
-std::array<float,2>{0.709367335f, 0.957804501f},
-std::array<float,2>{0.485470265f, 0.256873548f},
-std::array<float,2>{0.242051393f, 0.583137274f},
-std::array<float,2>{0.858984411f, 0.162486285f},
-std::array<float,2>{0.754674137f, 0.849876583f},
-std::array<float,2>{0.182832748f, 0.442560464f},
-std::array<float,2>{0.38221395f, 0.632295489f},
-std::array<float,2>{0.646741748f, 0.0609863512f},
-std::array<float,2>{0.548683465f, 0.519912302f},
-std::array<float,2>{0.369983584f, 0.234871373f},
-std::array<float,2>{0.0544490516f, 0.876613736f},
-std::array<float,2>{0.911201954f, 0.325805604f},
-std::array<float,2>{0.830334365f, 0.620544732f},
-std::array<float,2>{0.19984135f, 0.154072568f},
-std::array<float,2>{0.467550993f, 0.998039424f},
-std::array<float,2>{0.738664329f, 0.301812291f},
-std::array<float,2>{0.59682256f, 0.76799041f},
-std::array<float,2>{0.295034081f, 0.394949079f},
-std::array<float,2>{0.0834809765f, 0.714040756f},
-std::array<float,2>{0.959868073f, 0.0976075977f},
-std::array<float,2>{0.902727306f, 0.914043128f},
-std::array<float,2>{0.0266381633f, 0.352904856f},
-std::array<float,2>{0.341304183f, 0.560383737f},
-std::array<float,2>{0.500875473f, 0.193041697f},
-std::array<float,2>{0.684037268f, 0.66996485f},
-std::array<float,2>{0.406653881f, 0.00765468925f},
-std::array<float,2>{0.154692262f, 0.823551357f},
-std::array<float,2>{0.803633869f, 0.495916098f},
-std::array<float,2>{0.848994732f, 0.70992744f},
-std::array<float,2>{0.249464735f, 0.102862559f},
-std::array<float,2>{0.492204875f, 0.778622985f},
-std::array<float,2>{0.71749723f, 0.398933411f},
-std::array<float,2>{0.575114489f, 0.992104173f},
-std::array<float,2>{0.26248011f, 0.309939712f},
-std::array<float,2>{0.104000688f, 0.617045641f},
-std::array<float,2>{0.997753203f, 0.145530254f},
-std::array<float,2>{0.920917869f, 0.815887392f},
-std::array<float,2>{0.0603452139f, 0.488523066f},
-std::array<float,2>{0.363731802f, 0.663653791f},
-std::array<float,2>{0.557051301f, 0.00843662396f},
-std::array<float,2>{0.654025018f, 0.552906454f},
-std::array<float,2>{0.386636585f, 0.19788295f},
-std::array<float,2>{0.177547768f, 0.920649409f},
-std::array<float,2>{0.75891453f, 0.347708583f},
-std::array<float,2>{0.962256551f, 0.593355238f},
-std::array<float,2>{0.089747943f, 0.16504167f},
-std::array<float,2>{0.288516879f, 0.963927388f},
-std::array<float,2>{0.606784225f, 0.259393692f},
-std::array<float,2>{0.742422462f, 0.798448145f},
-std::array<float,2>{0.458728105f, 0.413573563f},
-std::array<float,2>{0.188476115f, 0.726751804f},
-std::array<float,2>{0.839416683f, 0.0641147867f},
-std::array<float,2>{0.810983002f, 0.887229562f},
-std::array<float,2>{0.142413899f, 0.320051789f},
-std::array<float,2>{0.420436531f, 0.530146599f},
-std::array<float,2>{0.675156295f, 0.243079841f},
-std::array<float,2>{0.514339864f, 0.637514949f},
-std::array<float,2>{0.333326012f, 0.0519012138f},
-std::array<float,2>{0.0211193673f, 0.851563811f},
-std::array<float,2>{0.891193986f, 0.450695515f},
-std::array<float,2>{0.887006521f, 0.672787309f},
-std::array<float,2>{0.0054470757f, 0.0247710999f},
-std::array<float,2>{0.324537426f, 0.836321294f},
-std::array<float,2>{0.517492235f, 0.471715271f},
-std::array<float,2>{0.666937351f, 0.923202455f},
-std::array<float,2>{0.424313337f, 0.364300758f},
-std::array<float,2>{0.132373869f, 0.538666248f},
-std::array<float,2>{0.790069818f, 0.215983555f},
-std::array<float,2>{0.820771515f, 0.753837049f},
-std::array<float,2>{0.204792216f, 0.387105376f},
-std::array<float,2>{0.446974576f, 0.700560331f},
-std::array<float,2>{0.721072435f, 0.11342179f},
-std::array<float,2>{0.624966025f, 0.60104233f},
-std::array<float,2>{0.303458005f, 0.129017845f},
-std::array<float,2>{0.0766202435f, 0.974188387f},
-std::array<float,2>{0.944482982f, 0.281452745f},
-std::array<float,2>{0.767539442f, 0.510182321f},
-std::array<float,2>{0.169349238f, 0.220361724f},
-std::array<float,2>{0.405036449f, 0.899822116f},
-std::array<float,2>{0.626773179f, 0.336187094f},
-std::array<float,2>{0.537991822f, 0.874049604f},
-std::array<float,2>{0.355193824f, 0.460167885f},
-std::array<float,2>{0.0468539f, 0.643385589f},
-std::array<float,2>{0.930004537f, 0.0431990772f},
-std::array<float,2>{0.97740227f, 0.950866938f},
-std::array<float,2>{0.123775773f, 0.279920042f},
-std::array<float,2>{0.28053838f, 0.574968815f},
-std::array<float,2>{0.58400178f, 0.17974329f},
-std::array<float,2>{0.689642847f, 0.744732201f},
-std::array<float,2>{0.474469304f, 0.0814299881f},
-std::array<float,2>{0.228023142f, 0.794347703f},
-std::array<float,2>{0.871072888f, 0.423678845f},
-std::array<float,2>{0.762257218f, 0.740433156f},
-std::array<float,2>{0.175579056f, 0.0890271664f},
-std::array<float,2>{0.387112856f, 0.783920586f},
-std::array<float,2>{0.650374949f, 0.436347008f},
-std::array<float,2>{0.560884476f, 0.945250392f},
-std::array<float,2>{0.36215502f, 0.271446526f},
-std::array<float,2>{0.0584577098f, 0.568434536f},
-std::array<float,2>{0.914376795f, 0.179155946f},
-std::array<float,2>{0.995998919f, 0.860318065f},
-std::array<float,2>{0.108547352f, 0.462797523f},
-std::array<float,2>{0.259641171f, 0.65547365f},
-std::array<float,2>{0.571670294f, 0.032488592f},
-std::array<float,2>{0.710998833f, 0.500599384f},
-std::array<float,2>{0.498259306f, 0.232924119f},
-std::array<float,2>{0.245405316f, 0.894298196f},
-std::array<float,2>{0.84673059f, 0.329488814f},
-std::array<float,2>{0.897046864f, 0.603724539f},
-std::array<float,2>{0.0189635884f, 0.140392944f},
-std::array<float,2>{0.330887556f, 0.976577699f},
-std::array<float,2>{0.510435164f, 0.292789757f},
-std::array<float,2>{0.675781488f, 0.764765263f},
-std::array<float,2>{0.417284191f, 0.378829688f},
-std::array<float,2>{0.146869108f, 0.694231331f},
-std::array<float,2>{0.806564271f, 0.121433727f},
-std::array<float,2>{0.841990411f, 0.933970451f},
-std::array<float,2>{0.1928657f, 0.369302809f},
-std::array<float,2>{0.455198169f, 0.539443552f},
-std::array<float,2>{0.749789774f, 0.210157454f},
-std::array<float,2>{0.604506433f, 0.682846725f},
-std::array<float,2>{0.282048851f, 0.0160556976f},
-std::array<float,2>{0.0899338722f, 0.831679642f},
-std::array<float,2>{0.965281248f, 0.484139323f},
-std::array<float,2>{0.941111386f, 0.62778002f},
-std::array<float,2>{0.0718946084f, 0.0572383963f},
-std::array<float,2>{0.298220277f, 0.845052004f},
-std::array<float,2>{0.617583275f, 0.438972533f},
-std::array<float,2>{0.725314319f, 0.880838692f},
-std::array<float,2>{0.453006536f, 0.322605073f},
-std::array<float,2>{0.208521858f, 0.516923547f},
-std::array<float,2>{0.825953484f, 0.24200666f},
-std::array<float,2>{0.796612561f, 0.809400976f},
-std::array<float,2>{0.125070825f, 0.41744414f},
-std::array<float,2>{0.427479446f, 0.725571871f},
-std::array<float,2>{0.670536578f, 0.0769146904f},
-std::array<float,2>{0.522156715f, 0.579063416f},
-std::array<float,2>{0.320516437f, 0.159373298f},
-std::array<float,2>{0.000744748744f, 0.956475616f},
-std::array<float,2>{0.885807693f, 0.25365153f},
-std::array<float,2>{0.873164654f, 0.554765105f},
-std::array<float,2>{0.231675908f, 0.188541248f},
-std::array<float,2>{0.472424567f, 0.907843053f},
-std::array<float,2>{0.694565415f, 0.356705666f},
-std::array<float,2>{0.58105725f, 0.825909972f},
-std::array<float,2>{0.2770046f, 0.498300225f},
-std::array<float,2>{0.119008221f, 0.667365432f},
-std::array<float,2>{0.983000219f, 0.00142357557f},
-std::array<float,2>{0.936911106f, 0.996020436f},
-std::array<float,2>{0.0410508327f, 0.297315091f},
-std::array<float,2>{0.357916325f, 0.624487758f},
-std::array<float,2>{0.534611523f, 0.151060909f},
-std::array<float,2>{0.632710874f, 0.715055346f},
-std::array<float,2>{0.401712358f, 0.0986997113f},
-std::array<float,2>{0.164399028f, 0.771397769f},
-std::array<float,2>{0.772067249f, 0.394044936f},
-std::array<float,2>{0.814551711f, 0.659485698f},
-std::array<float,2>{0.214088798f, 0.0152204968f},
-std::array<float,2>{0.44095403f, 0.817883432f},
-std::array<float,2>{0.732508481f, 0.486461341f},
-std::array<float,2>{0.614540279f, 0.916423857f},
-std::array<float,2>{0.306193411f, 0.345513791f},
-std::array<float,2>{0.0679951981f, 0.547090888f},
-std::array<float,2>{0.952286005f, 0.200613007f},
-std::array<float,2>{0.881625473f, 0.774249911f},
-std::array<float,2>{0.00972361583f, 0.402529538f},
-std::array<float,2>{0.314453244f, 0.704162896f},
-std::array<float,2>{0.530765772f, 0.106705166f},
-std::array<float,2>{0.662409008f, 0.611963093f},
-std::array<float,2>{0.436269164f, 0.142715722f},
-std::array<float,2>{0.135122091f, 0.984652638f},
-std::array<float,2>{0.78128922f, 0.307304412f},
-std::array<float,2>{0.968810081f, 0.524266064f},
-std::array<float,2>{0.113588452f, 0.248904601f},
-std::array<float,2>{0.271457434f, 0.886635363f},
-std::array<float,2>{0.590738237f, 0.313170105f},
-std::array<float,2>{0.698640525f, 0.858747959f},
-std::array<float,2>{0.478948236f, 0.447010547f},
-std::array<float,2>{0.224585459f, 0.635801196f},
-std::array<float,2>{0.863821924f, 0.050432384f},
-std::array<float,2>{0.776989579f, 0.968185544f},
-std::array<float,2>{0.15670903f, 0.264592856f},
-std::array<float,2>{0.391966581f, 0.587457418f},
-std::array<float,2>{0.638933301f, 0.168322846f},
-std::array<float,2>{0.546153009f, 0.73307544f},
-std::array<float,2>{0.35065043f, 0.0699543655f},
-std::array<float,2>{0.0348566175f, 0.802432775f},
-std::array<float,2>{0.923967659f, 0.408777565f},
-std::array<float,2>{0.908205926f, 0.695677817f},
-std::array<float,2>{0.0506232046f, 0.111242399f},
-std::array<float,2>{0.37191388f, 0.755810201f},
-std::array<float,2>{0.552522302f, 0.383317679f},
-std::array<float,2>{0.64263165f, 0.968812466f},
-std::array<float,2>{0.375212252f, 0.288670033f},
-std::array<float,2>{0.184332401f, 0.596130669f},
-std::array<float,2>{0.752761662f, 0.128549665f},
-std::array<float,2>{0.85458827f, 0.842660606f},
-std::array<float,2>{0.237943009f, 0.47300759f},
-std::array<float,2>{0.488321215f, 0.675810277f},
-std::array<float,2>{0.706141293f, 0.0303254835f},
-std::array<float,2>{0.563824832f, 0.534931064f},
-std::array<float,2>{0.250617772f, 0.212861896f},
-std::array<float,2>{0.0958564878f, 0.926531434f},
-std::array<float,2>{0.986797154f, 0.360477448f},
-std::array<float,2>{0.800570786f, 0.570410013f},
-std::array<float,2>{0.150336698f, 0.185221642f},
-std::array<float,2>{0.413796037f, 0.949201107f},
-std::array<float,2>{0.682044387f, 0.277180016f},
-std::array<float,2>{0.507196665f, 0.790855587f},
-std::array<float,2>{0.337333679f, 0.426139593f},
-std::array<float,2>{0.0289435145f, 0.747700989f},
-std::array<float,2>{0.900988996f, 0.0823512748f},
-std::array<float,2>{0.954569519f, 0.905109048f},
-std::array<float,2>{0.0808069259f, 0.341495454f},
-std::array<float,2>{0.289855421f, 0.514185011f},
-std::array<float,2>{0.598390102f, 0.222981066f},
-std::array<float,2>{0.736779571f, 0.648106813f},
-std::array<float,2>{0.462813795f, 0.0405633748f},
-std::array<float,2>{0.196469158f, 0.869308293f},
-std::array<float,2>{0.833005548f, 0.454504788f},
-std::array<float,2>{0.76893729f, 0.643037379f},
-std::array<float,2>{0.171820477f, 0.0439115353f},
-std::array<float,2>{0.403094351f, 0.874608636f},
-std::array<float,2>{0.628330767f, 0.460610986f},
-std::array<float,2>{0.535207272f, 0.900265217f},
-std::array<float,2>{0.352561384f, 0.336784989f},
-std::array<float,2>{0.0433154963f, 0.510483563f},
-std::array<float,2>{0.932794034f, 0.219986424f},
-std::array<float,2>{0.979333997f, 0.794771254f},
-std::array<float,2>{0.121395372f, 0.423156857f},
-std::array<float,2>{0.278110772f, 0.744151175f},
-std::array<float,2>{0.583893061f, 0.0819067359f},
-std::array<float,2>{0.687928855f, 0.574224949f},
-std::array<float,2>{0.476209819f, 0.180431545f},
-std::array<float,2>{0.229533508f, 0.950311661f},
-std::array<float,2>{0.868227005f, 0.279713303f},
-std::array<float,2>{0.889034808f, 0.538282394f},
-std::array<float,2>{0.00630034273f, 0.216359645f},
-std::array<float,2>{0.326691628f, 0.923405111f},
-std::array<float,2>{0.519060314f, 0.365165085f},
-std::array<float,2>{0.665311992f, 0.836746752f},
-std::array<float,2>{0.4227117f, 0.472201347f},
-std::array<float,2>{0.129903764f, 0.672276378f},
-std::array<float,2>{0.792437255f, 0.0250173621f},
-std::array<float,2>{0.823592484f, 0.973724544f},
-std::array<float,2>{0.205229849f, 0.28211835f},
-std::array<float,2>{0.449040562f, 0.601460457f},
-std::array<float,2>{0.720525384f, 0.129484087f},
-std::array<float,2>{0.621181071f, 0.701099515f},
-std::array<float,2>{0.301365525f, 0.114255048f},
-std::array<float,2>{0.0755928829f, 0.753388703f},
-std::array<float,2>{0.942379057f, 0.387617767f},
-std::array<float,2>{0.963806093f, 0.727452815f},
-std::array<float,2>{0.0871182159f, 0.0635368749f},
-std::array<float,2>{0.286084235f, 0.798014224f},
-std::array<float,2>{0.609099507f, 0.413998932f},
-std::array<float,2>{0.744465768f, 0.964801967f},
-std::array<float,2>{0.46032545f, 0.258926928f},
-std::array<float,2>{0.190453231f, 0.593208492f},
-std::array<float,2>{0.835998118f, 0.165950805f},
-std::array<float,2>{0.809603691f, 0.852493107f},
-std::array<float,2>{0.143192425f, 0.450233161f},
-std::array<float,2>{0.419652849f, 0.636775136f},
-std::array<float,2>{0.673328876f, 0.0523821265f},
-std::array<float,2>{0.511771977f, 0.529631555f},
-std::array<float,2>{0.334690571f, 0.242204249f},
-std::array<float,2>{0.0233471449f, 0.8869403f},
-std::array<float,2>{0.892852128f, 0.319769293f},
-std::array<float,2>{0.85073036f, 0.616590202f},
-std::array<float,2>{0.247145087f, 0.146397293f},
-std::array<float,2>{0.494355142f, 0.991597533f},
-std::array<float,2>{0.715908945f, 0.310172439f},
-std::array<float,2>{0.57624501f, 0.779103756f},
-std::array<float,2>{0.264868021f, 0.398507088f},
-std::array<float,2>{0.101862982f, 0.709106505f},
-std::array<float,2>{0.999295413f, 0.103383034f},
-std::array<float,2>{0.918991864f, 0.920087695f},
-std::array<float,2>{0.061142236f, 0.348189801f},
-std::array<float,2>{0.36574927f, 0.553309679f},
-std::array<float,2>{0.556096435f, 0.197508648f},
-std::array<float,2>{0.655086219f, 0.66309154f},
-std::array<float,2>{0.383902341f, 0.00798708107f},
-std::array<float,2>{0.179242164f, 0.815946817f},
-std::array<float,2>{0.761317611f, 0.488980919f},
-std::array<float,2>{0.8289904f, 0.714809775f},
-std::array<float,2>{0.201999798f, 0.0968917236f},
-std::array<float,2>{0.465444624f, 0.768548131f},
-std::array<float,2>{0.740778565f, 0.395481765f},
-std::array<float,2>{0.5944736f, 0.997469485f},
-std::array<float,2>{0.29346472f, 0.30256781f},
-std::array<float,2>{0.0851572827f, 0.620904088f},
-std::array<float,2>{0.958756924f, 0.153721765f},
-std::array<float,2>{0.90538466f, 0.824127853f},
-std::array<float,2>{0.0253884029f, 0.495414466f},
-std::array<float,2>{0.341891497f, 0.670656919f},
-std::array<float,2>{0.502561033f, 0.00715705287f},
-std::array<float,2>{0.685823321f, 0.55957073f},
-std::array<float,2>{0.40983057f, 0.192813352f},
-std::array<float,2>{0.152503595f, 0.913301528f},
-std::array<float,2>{0.801206291f, 0.353409082f},
-std::array<float,2>{0.992182553f, 0.583521426f},
-std::array<float,2>{0.101420656f, 0.16284737f},
-std::array<float,2>{0.255624145f, 0.957277536f},
-std::array<float,2>{0.570186973f, 0.257392079f},
-std::array<float,2>{0.708978713f, 0.80496043f},
-std::array<float,2>{0.487104446f, 0.420568258f},
-std::array<float,2>{0.240102619f, 0.71878159f},
-std::array<float,2>{0.857043624f, 0.0728848055f},
-std::array<float,2>{0.755940199f, 0.876032054f},
-std::array<float,2>{0.180439606f, 0.325359702f},
-std::array<float,2>{0.380773187f, 0.520504236f},
-std::array<float,2>{0.6445871f, 0.234551877f},
-std::array<float,2>{0.550744355f, 0.632540047f},
-std::array<float,2>{0.368841469f, 0.0614492334f},
-std::array<float,2>{0.0517002717f, 0.850524485f},
-std::array<float,2>{0.913931787f, 0.442878276f},
-std::array<float,2>{0.927659273f, 0.686699033f},
-std::array<float,2>{0.0372165628f, 0.0215510409f},
-std::array<float,2>{0.344850719f, 0.832744181f},
-std::array<float,2>{0.542611718f, 0.477706373f},
-std::array<float,2>{0.633437335f, 0.930983305f},
-std::array<float,2>{0.396617085f, 0.373588473f},
-std::array<float,2>{0.160660863f, 0.544719696f},
-std::array<float,2>{0.778203845f, 0.206713736f},
-std::array<float,2>{0.860141098f, 0.760783494f},
-std::array<float,2>{0.219365045f, 0.379701227f},
-std::array<float,2>{0.484023571f, 0.689305723f},
-std::array<float,2>{0.701708257f, 0.11865779f},
-std::array<float,2>{0.589024961f, 0.607326865f},
-std::array<float,2>{0.267365962f, 0.133436441f},
-std::array<float,2>{0.109602772f, 0.982097208f},
-std::array<float,2>{0.975520492f, 0.293708771f},
-std::array<float,2>{0.785509646f, 0.505491376f},
-std::array<float,2>{0.138539866f, 0.22826165f},
-std::array<float,2>{0.42969045f, 0.895051241f},
-std::array<float,2>{0.657456756f, 0.332428932f},
-std::array<float,2>{0.525944233f, 0.86536777f},
-std::array<float,2>{0.317668349f, 0.468490541f},
-std::array<float,2>{0.0128498645f, 0.650962114f},
-std::array<float,2>{0.878045797f, 0.0358532183f},
-std::array<float,2>{0.948226392f, 0.939392865f},
-std::array<float,2>{0.0662428662f, 0.267674088f},
-std::array<float,2>{0.308793217f, 0.563703299f},
-std::array<float,2>{0.611372113f, 0.17380172f},
-std::array<float,2>{0.727732599f, 0.735802114f},
-std::array<float,2>{0.442349464f, 0.0922500044f},
-std::array<float,2>{0.218115509f, 0.787200928f},
-std::array<float,2>{0.820278823f, 0.43105635f},
-std::array<float,2>{0.797733545f, 0.747097492f},
-std::array<float,2>{0.150706738f, 0.0825487003f},
-std::array<float,2>{0.410213023f, 0.790110767f},
-std::array<float,2>{0.679787219f, 0.42658636f},
-std::array<float,2>{0.504073977f, 0.948581696f},
-std::array<float,2>{0.338725716f, 0.276375562f},
-std::array<float,2>{0.0302594788f, 0.570854366f},
-std::array<float,2>{0.899630427f, 0.184662983f},
-std::array<float,2>{0.956093252f, 0.86999476f},
-std::array<float,2>{0.0785240829f, 0.454798162f},
-std::array<float,2>{0.291693628f, 0.647942305f},
-std::array<float,2>{0.600109816f, 0.0404062718f},
-std::array<float,2>{0.734965682f, 0.513708532f},
-std::array<float,2>{0.463444024f, 0.223295301f},
-std::array<float,2>{0.198404282f, 0.904636085f},
-std::array<float,2>{0.835012317f, 0.341053456f},
-std::array<float,2>{0.907594204f, 0.596523225f},
-std::array<float,2>{0.0474729054f, 0.128087282f},
-std::array<float,2>{0.373548418f, 0.969327807f},
-std::array<float,2>{0.554093778f, 0.288442701f},
-std::array<float,2>{0.640896678f, 0.754949749f},
-std::array<float,2>{0.377193511f, 0.383131236f},
-std::array<float,2>{0.186841846f, 0.696181536f},
-std::array<float,2>{0.751201928f, 0.110815935f},
-std::array<float,2>{0.853387713f, 0.925828516f},
-std::array<float,2>{0.235624105f, 0.360882342f},
-std::array<float,2>{0.49091503f, 0.534502804f},
-std::array<float,2>{0.704695523f, 0.211982816f},
-std::array<float,2>{0.56458807f, 0.676720798f},
-std::array<float,2>{0.253782749f, 0.0312113222f},
-std::array<float,2>{0.0944223627f, 0.842028022f},
-std::array<float,2>{0.984916687f, 0.473629385f},
-std::array<float,2>{0.972200692f, 0.636655509f},
-std::array<float,2>{0.115593672f, 0.0502582714f},
-std::array<float,2>{0.272968233f, 0.859099507f},
-std::array<float,2>{0.592139006f, 0.446685731f},
-std::array<float,2>{0.69697845f, 0.885937989f},
-std::array<float,2>{0.476975113f, 0.312865317f},
-std::array<float,2>{0.226031855f, 0.523511469f},
-std::array<float,2>{0.865503013f, 0.248299167f},
-std::array<float,2>{0.775033534f, 0.80191797f},
-std::array<float,2>{0.159106553f, 0.408217609f},
-std::array<float,2>{0.393891454f, 0.732658327f},
-std::array<float,2>{0.638651252f, 0.0696496591f},
-std::array<float,2>{0.543203354f, 0.587355375f},
-std::array<float,2>{0.348832875f, 0.168886304f},
-std::array<float,2>{0.03192655f, 0.968440771f},
-std::array<float,2>{0.923150241f, 0.26386717f},
-std::array<float,2>{0.813541472f, 0.54774189f},
-std::array<float,2>{0.212819919f, 0.201105043f},
-std::array<float,2>{0.439211726f, 0.916763186f},
-std::array<float,2>{0.730759501f, 0.344861239f},
-std::array<float,2>{0.61644721f, 0.817444682f},
-std::array<float,2>{0.308132768f, 0.487073988f},
-std::array<float,2>{0.0699971393f, 0.660140693f},
-std::array<float,2>{0.950913846f, 0.0148226153f},
-std::array<float,2>{0.880545139f, 0.984909892f},
-std::array<float,2>{0.0099684475f, 0.307095617f},
-std::array<float,2>{0.31335032f, 0.611347318f},
-std::array<float,2>{0.527533174f, 0.143160358f},
-std::array<float,2>{0.660989583f, 0.704766989f},
-std::array<float,2>{0.434722215f, 0.107120201f},
-std::array<float,2>{0.13316521f, 0.773555636f},
-std::array<float,2>{0.784053087f, 0.402969599f},
-std::array<float,2>{0.872648299f, 0.667651653f},
-std::array<float,2>{0.233296514f, 0.00183363177f},
-std::array<float,2>{0.4699229f, 0.825463891f},
-std::array<float,2>{0.691991568f, 0.498601258f},
-std::array<float,2>{0.580065787f, 0.907286227f},
-std::array<float,2>{0.274636626f, 0.35718888f},
-std::array<float,2>{0.120596342f, 0.555345297f},
-std::array<float,2>{0.980963767f, 0.18927604f},
-std::array<float,2>{0.934988976f, 0.770572841f},
-std::array<float,2>{0.0396552719f, 0.393884778f},
-std::array<float,2>{0.357266456f, 0.715561807f},
-std::array<float,2>{0.531290472f, 0.0992315635f},
-std::array<float,2>{0.629967391f, 0.624994457f},
-std::array<float,2>{0.399214417f, 0.15050222f},
-std::array<float,2>{0.166815147f, 0.995225191f},
-std::array<float,2>{0.771027565f, 0.297443628f},
-std::array<float,2>{0.938010037f, 0.517269313f},
-std::array<float,2>{0.0742012337f, 0.241528362f},
-std::array<float,2>{0.300064504f, 0.88030833f},
-std::array<float,2>{0.620125175f, 0.323170304f},
-std::array<float,2>{0.723128617f, 0.845497787f},
-std::array<float,2>{0.449775636f, 0.43883121f},
-std::array<float,2>{0.209787011f, 0.627163827f},
-std::array<float,2>{0.827737331f, 0.0569269396f},
-std::array<float,2>{0.793759584f, 0.956889629f},
-std::array<float,2>{0.12846446f, 0.253074557f},
-std::array<float,2>{0.429587811f, 0.578169703f},
-std::array<float,2>{0.668780267f, 0.15977259f},
-std::array<float,2>{0.519866347f, 0.724839985f},
-std::array<float,2>{0.32287991f, 0.0762790963f},
-std::array<float,2>{0.00200552656f, 0.808931172f},
-std::array<float,2>{0.884110212f, 0.417883068f},
-std::array<float,2>{0.896301925f, 0.693615079f},
-std::array<float,2>{0.0174372625f, 0.121649429f},
-std::array<float,2>{0.329067409f, 0.765395403f},
-std::array<float,2>{0.509011567f, 0.378206819f},
-std::array<float,2>{0.67907685f, 0.97721529f},
-std::array<float,2>{0.41445294f, 0.292232752f},
-std::array<float,2>{0.145926163f, 0.604147851f},
-std::array<float,2>{0.80701679f, 0.139679372f},
-std::array<float,2>{0.84097898f, 0.831320822f},
-std::array<float,2>{0.194932655f, 0.483676195f},
-std::array<float,2>{0.453631461f, 0.683302402f},
-std::array<float,2>{0.746945024f, 0.016217934f},
-std::array<float,2>{0.602855325f, 0.539866686f},
-std::array<float,2>{0.284077406f, 0.210479692f},
-std::array<float,2>{0.0921702161f, 0.934271634f},
-std::array<float,2>{0.966988862f, 0.369892955f},
-std::array<float,2>{0.764508069f, 0.569226205f},
-std::array<float,2>{0.173627704f, 0.179574385f},
-std::array<float,2>{0.390179515f, 0.944597244f},
-std::array<float,2>{0.651418567f, 0.270844787f},
-std::array<float,2>{0.558602333f, 0.783273935f},
-std::array<float,2>{0.36081931f, 0.435633123f},
-std::array<float,2>{0.0554969758f, 0.740952849f},
-std::array<float,2>{0.917590141f, 0.0897434652f},
-std::array<float,2>{0.99227798f, 0.893605053f},
-std::array<float,2>{0.105551898f, 0.330052346f},
-std::array<float,2>{0.261060029f, 0.500001848f},
-std::array<float,2>{0.573065996f, 0.232554942f},
-std::array<float,2>{0.714235067f, 0.655898988f},
-std::array<float,2>{0.497761846f, 0.033005584f},
-std::array<float,2>{0.242334381f, 0.859859049f},
-std::array<float,2>{0.84567064f, 0.462274939f},
-std::array<float,2>{0.790888369f, 0.674689233f},
-std::array<float,2>{0.132252172f, 0.0258775298f},
-std::array<float,2>{0.424779743f, 0.838463783f},
-std::array<float,2>{0.666331708f, 0.469252557f},
-std::array<float,2>{0.517008841f, 0.92493391f},
-std::array<float,2>{0.324725538f, 0.366437972f},
-std::array<float,2>{0.00532442471f, 0.536135912f},
-std::array<float,2>{0.887633264f, 0.217862606f},
-std::array<float,2>{0.944854617f, 0.751942456f},
-std::array<float,2>{0.0767466202f, 0.390280426f},
-std::array<float,2>{0.303172588f, 0.702669382f},
-std::array<float,2>{0.624467313f, 0.11523816f},
-std::array<float,2>{0.721563339f, 0.599128127f},
-std::array<float,2>{0.446641803f, 0.132188305f},
-std::array<float,2>{0.20413889f, 0.975334167f},
-std::array<float,2>{0.820995331f, 0.283239037f},
-std::array<float,2>{0.930574715f, 0.508578062f},
-std::array<float,2>{0.0461142473f, 0.22221835f},
-std::array<float,2>{0.354672909f, 0.901327908f},
-std::array<float,2>{0.537397027f, 0.338263631f},
-std::array<float,2>{0.626064599f, 0.872145534f},
-std::array<float,2>{0.404435188f, 0.458977401f},
-std::array<float,2>{0.169897065f, 0.640920401f},
-std::array<float,2>{0.767036557f, 0.0454451665f},
-std::array<float,2>{0.870292664f, 0.952808022f},
-std::array<float,2>{0.228085399f, 0.277790487f},
-std::array<float,2>{0.473904967f, 0.576965034f},
-std::array<float,2>{0.69002676f, 0.182520837f},
-std::array<float,2>{0.584537923f, 0.742870629f},
-std::array<float,2>{0.281147599f, 0.0790041164f},
-std::array<float,2>{0.12326882f, 0.795055032f},
-std::array<float,2>{0.976949275f, 0.424625039f},
-std::array<float,2>{0.997471273f, 0.707740486f},
-std::array<float,2>{0.104295485f, 0.105200045f},
-std::array<float,2>{0.26219511f, 0.780644238f},
-std::array<float,2>{0.574244618f, 0.400407106f},
-std::array<float,2>{0.717193425f, 0.988597393f},
-std::array<float,2>{0.49307552f, 0.310988843f},
-std::array<float,2>{0.249859944f, 0.613699615f},
-std::array<float,2>{0.849440813f, 0.148194283f},
-std::array<float,2>{0.75963521f, 0.812638462f},
-std::array<float,2>{0.176918536f, 0.490387619f},
-std::array<float,2>{0.386100382f, 0.66139406f},
-std::array<float,2>{0.653448522f, 0.0113018127f},
-std::array<float,2>{0.557455182f, 0.551105022f},
-std::array<float,2>{0.363993764f, 0.195522606f},
-std::array<float,2>{0.0597991198f, 0.919768035f},
-std::array<float,2>{0.921628594f, 0.349689066f},
-std::array<float,2>{0.839185417f, 0.590730846f},
-std::array<float,2>{0.187516421f, 0.167646438f},
-std::array<float,2>{0.458438754f, 0.961538136f},
-std::array<float,2>{0.742721379f, 0.260822296f},
-std::array<float,2>{0.607088029f, 0.79986757f},
-std::array<float,2>{0.288924724f, 0.411233395f},
-std::array<float,2>{0.0889054313f, 0.730129004f},
-std::array<float,2>{0.962524354f, 0.0659096316f},
-std::array<float,2>{0.891072094f, 0.890064836f},
-std::array<float,2>{0.0207271054f, 0.316437721f},
-std::array<float,2>{0.333789706f, 0.528487623f},
-std::array<float,2>{0.513923705f, 0.24562867f},
-std::array<float,2>{0.675742269f, 0.639506757f},
-std::array<float,2>{0.420091271f, 0.0545091145f},
-std::array<float,2>{0.142016932f, 0.853572726f},
-std::array<float,2>{0.811052799f, 0.451440841f},
-std::array<float,2>{0.858502805f, 0.722402334f},
-std::array<float,2>{0.241334021f, 0.0706485063f},
-std::array<float,2>{0.485862255f, 0.806819081f},
-std::array<float,2>{0.709559143f, 0.419884413f},
-std::array<float,2>{0.566723585f, 0.959023893f},
-std::array<float,2>{0.256500959f, 0.25550738f},
-std::array<float,2>{0.098741509f, 0.585167468f},
-std::array<float,2>{0.989368916f, 0.160223171f},
-std::array<float,2>{0.912058175f, 0.848916113f},
-std::array<float,2>{0.0538588613f, 0.443368018f},
-std::array<float,2>{0.369384587f, 0.630452096f},
-std::array<float,2>{0.547906816f, 0.0600308888f},
-std::array<float,2>{0.64735359f, 0.522228539f},
-std::array<float,2>{0.382515818f, 0.237086579f},
-std::array<float,2>{0.183443993f, 0.877721906f},
-std::array<float,2>{0.754382133f, 0.326615959f},
-std::array<float,2>{0.95908612f, 0.618026435f},
-std::array<float,2>{0.0839749947f, 0.156014889f},
-std::array<float,2>{0.295470655f, 0.998801529f},
-std::array<float,2>{0.597566545f, 0.302735597f},
-std::array<float,2>{0.73907423f, 0.766011178f},
-std::array<float,2>{0.466844887f, 0.397817194f},
-std::array<float,2>{0.199624822f, 0.712717772f},
-std::array<float,2>{0.830728114f, 0.0942975432f},
-std::array<float,2>{0.802865267f, 0.911510468f},
-std::array<float,2>{0.154798523f, 0.354640901f},
-std::array<float,2>{0.407155812f, 0.562097251f},
-std::array<float,2>{0.684095502f, 0.195112333f},
-std::array<float,2>{0.50020498f, 0.668600619f},
-std::array<float,2>{0.341785043f, 0.00455705868f},
-std::array<float,2>{0.0273174252f, 0.820462525f},
-std::array<float,2>{0.90303725f, 0.493910313f},
-std::array<float,2>{0.875334263f, 0.648562372f},
-std::array<float,2>{0.0153775178f, 0.0385830104f},
-std::array<float,2>{0.318451345f, 0.864675045f},
-std::array<float,2>{0.523853242f, 0.465207964f},
-std::array<float,2>{0.659817219f, 0.897141993f},
-std::array<float,2>{0.432981133f, 0.335273594f},
-std::array<float,2>{0.139294341f, 0.506535172f},
-std::array<float,2>{0.788390458f, 0.230465025f},
-std::array<float,2>{0.816422224f, 0.785906255f},
-std::array<float,2>{0.215345308f, 0.432733238f},
-std::array<float,2>{0.445159733f, 0.736841619f},
-std::array<float,2>{0.729282737f, 0.0912450552f},
-std::array<float,2>{0.610981047f, 0.565120697f},
-std::array<float,2>{0.312486231f, 0.173828214f},
-std::array<float,2>{0.0640201494f, 0.94043988f},
-std::array<float,2>{0.946299732f, 0.266529202f},
-std::array<float,2>{0.779508531f, 0.545761645f},
-std::array<float,2>{0.162311926f, 0.204860196f},
-std::array<float,2>{0.395980179f, 0.932043254f},
-std::array<float,2>{0.635725796f, 0.37176615f},
-std::array<float,2>{0.540073454f, 0.834461331f},
-std::array<float,2>{0.346835405f, 0.480109423f},
-std::array<float,2>{0.0359451585f, 0.683775902f},
-std::array<float,2>{0.928585887f, 0.019586198f},
-std::array<float,2>{0.972822964f, 0.983635247f},
-std::array<float,2>{0.111490421f, 0.295047492f},
-std::array<float,2>{0.268061966f, 0.607423723f},
-std::array<float,2>{0.587416708f, 0.135559097f},
-std::array<float,2>{0.70009017f, 0.691089571f},
-std::array<float,2>{0.481376618f, 0.119284861f},
-std::array<float,2>{0.221267417f, 0.75870645f},
-std::array<float,2>{0.862213492f, 0.382485479f},
-std::array<float,2>{0.752269566f, 0.697519362f},
-std::array<float,2>{0.183943555f, 0.11140544f},
-std::array<float,2>{0.375626206f, 0.756351769f},
-std::array<float,2>{0.643457413f, 0.385041356f},
-std::array<float,2>{0.552037418f, 0.972283542f},
-std::array<float,2>{0.37154758f, 0.286185175f},
-std::array<float,2>{0.0502615497f, 0.593992472f},
-std::array<float,2>{0.909009755f, 0.126555234f},
-std::array<float,2>{0.987032712f, 0.840528667f},
-std::array<float,2>{0.0962258503f, 0.475508809f},
-std::array<float,2>{0.250385553f, 0.678754568f},
-std::array<float,2>{0.564159513f, 0.0280216206f},
-std::array<float,2>{0.7068367f, 0.532720864f},
-std::array<float,2>{0.48925063f, 0.214479253f},
-std::array<float,2>{0.237777546f, 0.927854598f},
-std::array<float,2>{0.855215967f, 0.362250775f},
-std::array<float,2>{0.900852323f, 0.572351336f},
-std::array<float,2>{0.0283814538f, 0.185751468f},
-std::array<float,2>{0.337742478f, 0.946408987f},
-std::array<float,2>{0.507519484f, 0.27491188f},
-std::array<float,2>{0.682428718f, 0.791195214f},
-std::array<float,2>{0.413182855f, 0.42894569f},
-std::array<float,2>{0.149569169f, 0.749878466f},
-std::array<float,2>{0.800063729f, 0.0846132115f},
-std::array<float,2>{0.832090497f, 0.904257774f},
-std::array<float,2>{0.197191775f, 0.341853321f},
-std::array<float,2>{0.462111831f, 0.512745023f},
-std::array<float,2>{0.737224519f, 0.226048633f},
-std::array<float,2>{0.597751319f, 0.645803988f},
-std::array<float,2>{0.28918907f, 0.0417685695f},
-std::array<float,2>{0.0803065225f, 0.868660927f},
-std::array<float,2>{0.95497036f, 0.456119984f},
-std::array<float,2>{0.952835083f, 0.656810284f},
-std::array<float,2>{0.0676988289f, 0.0129690832f},
-std::array<float,2>{0.305808067f, 0.818927765f},
-std::array<float,2>{0.614841163f, 0.485426515f},
-std::array<float,2>{0.732966244f, 0.915388346f},
-std::array<float,2>{0.440566033f, 0.346583754f},
-std::array<float,2>{0.214775354f, 0.549665332f},
-std::array<float,2>{0.815145433f, 0.202714831f},
-std::array<float,2>{0.782128215f, 0.775749266f},
-std::array<float,2>{0.135556787f, 0.405986547f},
-std::array<float,2>{0.435955107f, 0.706254303f},
-std::array<float,2>{0.662633061f, 0.108108707f},
-std::array<float,2>{0.530543268f, 0.610171914f},
-std::array<float,2>{0.315251946f, 0.142420232f},
-std::array<float,2>{0.0088449223f, 0.987256169f},
-std::array<float,2>{0.881099701f, 0.305961251f},
-std::array<float,2>{0.863719404f, 0.52567327f},
-std::array<float,2>{0.223724812f, 0.247980177f},
-std::array<float,2>{0.479143232f, 0.883034825f},
-std::array<float,2>{0.699036062f, 0.315035045f},
-std::array<float,2>{0.590154529f, 0.85557276f},
-std::array<float,2>{0.270722419f, 0.44849351f},
-std::array<float,2>{0.113968641f, 0.632910132f},
-std::array<float,2>{0.969708145f, 0.0476061888f},
-std::array<float,2>{0.924670398f, 0.965899467f},
-std::array<float,2>{0.0343849324f, 0.262112767f},
-std::array<float,2>{0.351531088f, 0.588960707f},
-std::array<float,2>{0.5466699f, 0.170428932f},
-std::array<float,2>{0.639298439f, 0.732144535f},
-std::array<float,2>{0.392249197f, 0.0682867765f},
-std::array<float,2>{0.157212958f, 0.804459035f},
-std::array<float,2>{0.776674032f, 0.407263011f},
-std::array<float,2>{0.825570822f, 0.626749694f},
-std::array<float,2>{0.208491445f, 0.0565779209f},
-std::array<float,2>{0.452444494f, 0.847287714f},
-std::array<float,2>{0.725047588f, 0.44126159f},
-std::array<float,2>{0.618124068f, 0.881741822f},
-std::array<float,2>{0.298747927f, 0.320518076f},
-std::array<float,2>{0.0713584796f, 0.518901527f},
-std::array<float,2>{0.940652132f, 0.238449156f},
-std::array<float,2>{0.886381209f, 0.810729504f},
-std::array<float,2>{0.000220193324f, 0.415944368f},
-std::array<float,2>{0.321062744f, 0.724570274f},
-std::array<float,2>{0.521609366f, 0.0750975981f},
-std::array<float,2>{0.670384347f, 0.580405235f},
-std::array<float,2>{0.427241355f, 0.157900885f},
-std::array<float,2>{0.125637993f, 0.954013228f},
-std::array<float,2>{0.796213865f, 0.250211626f},
-std::array<float,2>{0.982588172f, 0.55809176f},
-std::array<float,2>{0.11850024f, 0.191117853f},
-std::array<float,2>{0.276718646f, 0.909076214f},
-std::array<float,2>{0.581678212f, 0.358524829f},
-std::array<float,2>{0.694856763f, 0.828026772f},
-std::array<float,2>{0.471907705f, 0.497299016f},
-std::array<float,2>{0.232419401f, 0.665522277f},
-std::array<float,2>{0.873972952f, 0.00215828372f},
-std::array<float,2>{0.771540761f, 0.993266344f},
-std::array<float,2>{0.16469118f, 0.299461186f},
-std::array<float,2>{0.401902944f, 0.621147692f},
-std::array<float,2>{0.632156491f, 0.148780003f},
-std::array<float,2>{0.534982443f, 0.717102826f},
-std::array<float,2>{0.357669443f, 0.101247691f},
-std::array<float,2>{0.0419103131f, 0.773087561f},
-std::array<float,2>{0.937226176f, 0.391238362f},
-std::array<float,2>{0.914700866f, 0.740137458f},
-std::array<float,2>{0.0577830933f, 0.0864147916f},
-std::array<float,2>{0.361426622f, 0.783080816f},
-std::array<float,2>{0.561042011f, 0.435445786f},
-std::array<float,2>{0.649729192f, 0.943057895f},
-std::array<float,2>{0.387543738f, 0.271543145f},
-std::array<float,2>{0.175078526f, 0.568030417f},
-std::array<float,2>{0.761971176f, 0.176751956f},
-std::array<float,2>{0.847569644f, 0.862417519f},
-std::array<float,2>{0.245992318f, 0.463564456f},
-std::array<float,2>{0.498984516f, 0.653158963f},
-std::array<float,2>{0.711720884f, 0.0338490643f},
-std::array<float,2>{0.572055876f, 0.502997518f},
-std::array<float,2>{0.258863568f, 0.230575129f},
-std::array<float,2>{0.109310046f, 0.891940475f},
-std::array<float,2>{0.99547708f, 0.33139959f},
-std::array<float,2>{0.805852771f, 0.602615118f},
-std::array<float,2>{0.146984696f, 0.138103947f},
-std::array<float,2>{0.417810619f, 0.978555381f},
-std::array<float,2>{0.676522434f, 0.290833563f},
-std::array<float,2>{0.510221064f, 0.762009382f},
-std::array<float,2>{0.33037436f, 0.375662893f},
-std::array<float,2>{0.0193579383f, 0.691499531f},
-std::array<float,2>{0.896486104f, 0.12375059f},
-std::array<float,2>{0.965546489f, 0.936432719f},
-std::array<float,2>{0.0906951949f, 0.368144095f},
-std::array<float,2>{0.281340599f, 0.541580677f},
-std::array<float,2>{0.60542506f, 0.208393708f},
-std::array<float,2>{0.749319911f, 0.680656791f},
-std::array<float,2>{0.455977768f, 0.0178012718f},
-std::array<float,2>{0.19323647f, 0.828789413f},
-std::array<float,2>{0.842428923f, 0.480924547f},
-std::array<float,2>{0.760414958f, 0.660769165f},
-std::array<float,2>{0.178696424f, 0.00992596615f},
-std::array<float,2>{0.38376978f, 0.813802958f},
-std::array<float,2>{0.655729175f, 0.491472036f},
-std::array<float,2>{0.555633962f, 0.918387055f},
-std::array<float,2>{0.366468787f, 0.351340324f},
-std::array<float,2>{0.061597988f, 0.552534163f},
-std::array<float,2>{0.918362916f, 0.197189003f},
-std::array<float,2>{0.998699605f, 0.780165911f},
-std::array<float,2>{0.102716625f, 0.402069062f},
-std::array<float,2>{0.264531493f, 0.70845443f},
-std::array<float,2>{0.57757622f, 0.104318894f},
-std::array<float,2>{0.715254962f, 0.614892185f},
-std::array<float,2>{0.495421886f, 0.146768332f},
-std::array<float,2>{0.246742919f, 0.989397168f},
-std::array<float,2>{0.850155771f, 0.312281966f},
-std::array<float,2>{0.893894434f, 0.527431846f},
-std::array<float,2>{0.0219717547f, 0.244212151f},
-std::array<float,2>{0.335453868f, 0.889213741f},
-std::array<float,2>{0.513321877f, 0.318170041f},
-std::array<float,2>{0.672674775f, 0.855261803f},
-std::array<float,2>{0.418395668f, 0.452278763f},
-std::array<float,2>{0.144455537f, 0.639722407f},
-std::array<float,2>{0.809505343f, 0.0534163415f},
-std::array<float,2>{0.83751899f, 0.962408721f},
-std::array<float,2>{0.19010672f, 0.26026684f},
-std::array<float,2>{0.459541947f, 0.591751099f},
-std::array<float,2>{0.745604575f, 0.166535631f},
-std::array<float,2>{0.60837847f, 0.72893095f},
-std::array<float,2>{0.286959052f, 0.0645992383f},
-std::array<float,2>{0.0861702636f, 0.799362123f},
-std::array<float,2>{0.963867784f, 0.410454363f},
-std::array<float,2>{0.942962348f, 0.701200843f},
-std::array<float,2>{0.0749033913f, 0.116727069f},
-std::array<float,2>{0.302189708f, 0.750714123f},
-std::array<float,2>{0.62247169f, 0.388799608f},
-std::array<float,2>{0.719456673f, 0.976373911f},
-std::array<float,2>{0.447616518f, 0.284668922f},
-std::array<float,2>{0.206141889f, 0.598167598f},
-std::array<float,2>{0.823082507f, 0.130999416f},
-std::array<float,2>{0.791344225f, 0.839054108f},
-std::array<float,2>{0.129722834f, 0.470329404f},
-std::array<float,2>{0.423657775f, 0.675611079f},
-std::array<float,2>{0.664613247f, 0.0265723616f},
-std::array<float,2>{0.518511295f, 0.535612106f},
-std::array<float,2>{0.327713639f, 0.217749968f},
-std::array<float,2>{0.00757722137f, 0.924056232f},
-std::array<float,2>{0.889696717f, 0.365746617f},
-std::array<float,2>{0.867591381f, 0.577291965f},
-std::array<float,2>{0.228859022f, 0.183574304f},
-std::array<float,2>{0.475020885f, 0.951778591f},
-std::array<float,2>{0.688903809f, 0.278693467f},
-std::array<float,2>{0.582859874f, 0.79678309f},
-std::array<float,2>{0.278942883f, 0.425063521f},
-std::array<float,2>{0.122747421f, 0.744031727f},
-std::array<float,2>{0.979746401f, 0.0796217695f},
-std::array<float,2>{0.932330012f, 0.901473463f},
-std::array<float,2>{0.0439550951f, 0.339577854f},
-std::array<float,2>{0.352326155f, 0.509553969f},
-std::array<float,2>{0.536783993f, 0.221312836f},
-std::array<float,2>{0.62784189f, 0.641988873f},
-std::array<float,2>{0.403454214f, 0.0462991931f},
-std::array<float,2>{0.170359254f, 0.871881843f},
-std::array<float,2>{0.7681669f, 0.457159191f},
-std::array<float,2>{0.818838954f, 0.73804152f},
-std::array<float,2>{0.217731103f, 0.0907214954f},
-std::array<float,2>{0.443014175f, 0.786134899f},
-std::array<float,2>{0.72749567f, 0.432023078f},
-std::array<float,2>{0.613085449f, 0.939548671f},
-std::array<float,2>{0.310167313f, 0.266821235f},
-std::array<float,2>{0.0649438426f, 0.566306591f},
-std::array<float,2>{0.948345482f, 0.175617814f},
-std::array<float,2>{0.877184749f, 0.863502443f},
-std::array<float,2>{0.0117796352f, 0.466230214f},
-std::array<float,2>{0.316688508f, 0.649585485f},
-std::array<float,2>{0.526773393f, 0.0380708575f},
-std::array<float,2>{0.656814873f, 0.506880343f},
-std::array<float,2>{0.431335509f, 0.229310408f},
-std::array<float,2>{0.136971027f, 0.898007035f},
-std::array<float,2>{0.786455631f, 0.334918946f},
-std::array<float,2>{0.976030827f, 0.609279811f},
-std::array<float,2>{0.110415198f, 0.136028454f},
-std::array<float,2>{0.266269237f, 0.982493281f},
-std::array<float,2>{0.588825345f, 0.295937359f},
-std::array<float,2>{0.702831686f, 0.759581864f},
-std::array<float,2>{0.482987046f, 0.380986214f},
-std::array<float,2>{0.219951048f, 0.690325499f},
-std::array<float,2>{0.860722423f, 0.120866016f},
-std::array<float,2>{0.779274285f, 0.932930171f},
-std::array<float,2>{0.161813885f, 0.372635812f},
-std::array<float,2>{0.397909403f, 0.546092391f},
-std::array<float,2>{0.634607017f, 0.204053298f},
-std::array<float,2>{0.541878879f, 0.684930325f},
-std::array<float,2>{0.344263285f, 0.0212581474f},
-std::array<float,2>{0.0383749716f, 0.835439563f},
-std::array<float,2>{0.926110744f, 0.479162961f},
-std::array<float,2>{0.912139833f, 0.629145205f},
-std::array<float,2>{0.0524624512f, 0.058770109f},
-std::array<float,2>{0.367631018f, 0.848017573f},
-std::array<float,2>{0.549446225f, 0.444803596f},
-std::array<float,2>{0.646336734f, 0.878540516f},
-std::array<float,2>{0.379334807f, 0.327410698f},
-std::array<float,2>{0.18081294f, 0.523144543f},
-std::array<float,2>{0.757775009f, 0.23768428f},
-std::array<float,2>{0.855861545f, 0.807738245f},
-std::array<float,2>{0.239216298f, 0.418472528f},
-std::array<float,2>{0.487836152f, 0.720822811f},
-std::array<float,2>{0.707664669f, 0.0720091909f},
-std::array<float,2>{0.568477094f, 0.584951639f},
-std::array<float,2>{0.254049808f, 0.162043646f},
-std::array<float,2>{0.0997866914f, 0.960855305f},
-std::array<float,2>{0.990585923f, 0.254465222f},
-std::array<float,2>{0.802647889f, 0.560556412f},
-std::array<float,2>{0.153664589f, 0.194257051f},
-std::array<float,2>{0.408612251f, 0.910901129f},
-std::array<float,2>{0.686965883f, 0.354017168f},
-std::array<float,2>{0.503135085f, 0.822149158f},
-std::array<float,2>{0.343367219f, 0.492311865f},
-std::array<float,2>{0.0236275215f, 0.669442892f},
-std::array<float,2>{0.904308617f, 0.00497473171f},
-std::array<float,2>{0.957386434f, 0.999779999f},
-std::array<float,2>{0.0841922835f, 0.30452767f},
-std::array<float,2>{0.293995202f, 0.61855799f},
-std::array<float,2>{0.595416188f, 0.154451311f},
-std::array<float,2>{0.741417587f, 0.711388052f},
-std::array<float,2>{0.466261417f, 0.094927527f},
-std::array<float,2>{0.202878624f, 0.767020345f},
-std::array<float,2>{0.829565167f, 0.396529347f},
-std::array<float,2>{0.784620106f, 0.705702126f},
-std::array<float,2>{0.134663731f, 0.108693101f},
-std::array<float,2>{0.434228867f, 0.776955962f},
-std::array<float,2>{0.661688268f, 0.405185848f},
-std::array<float,2>{0.528688371f, 0.98820132f},
-std::array<float,2>{0.314004183f, 0.305371612f},
-std::array<float,2>{0.0108882636f, 0.611084878f},
-std::array<float,2>{0.879306912f, 0.140720993f},
-std::array<float,2>{0.949306905f, 0.820221066f},
-std::array<float,2>{0.0692566112f, 0.484804034f},
-std::array<float,2>{0.307513446f, 0.65723449f},
-std::array<float,2>{0.616091132f, 0.0123000313f},
-std::array<float,2>{0.731546819f, 0.550390482f},
-std::array<float,2>{0.437990099f, 0.201889217f},
-std::array<float,2>{0.211108342f, 0.914600492f},
-std::array<float,2>{0.813002825f, 0.347284675f},
-std::array<float,2>{0.922366798f, 0.588374496f},
-std::array<float,2>{0.0324339345f, 0.171317115f},
-std::array<float,2>{0.348387808f, 0.965747654f},
-std::array<float,2>{0.544470072f, 0.262738138f},
-std::array<float,2>{0.637301803f, 0.803581059f},
-std::array<float,2>{0.392738461f, 0.406711519f},
-std::array<float,2>{0.159722328f, 0.731165409f},
-std::array<float,2>{0.773490965f, 0.0669774786f},
-std::array<float,2>{0.866848707f, 0.884462357f},
-std::array<float,2>{0.225023985f, 0.316273093f},
-std::array<float,2>{0.477896303f, 0.526697934f},
-std::array<float,2>{0.69574064f, 0.246658146f},
-std::array<float,2>{0.593465686f, 0.63451618f},
-std::array<float,2>{0.271644741f, 0.0482489057f},
-std::array<float,2>{0.116263904f, 0.85730046f},
-std::array<float,2>{0.971006155f, 0.447859585f},
-std::array<float,2>{0.985434771f, 0.677744687f},
-std::array<float,2>{0.0950019285f, 0.0285868999f},
-std::array<float,2>{0.252749681f, 0.841186702f},
-std::array<float,2>{0.565689147f, 0.475960374f},
-std::array<float,2>{0.703671455f, 0.929202557f},
-std::array<float,2>{0.49172467f, 0.362930238f},
-std::array<float,2>{0.235236913f, 0.532030225f},
-std::array<float,2>{0.851595044f, 0.213668421f},
-std::array<float,2>{0.750116289f, 0.757002294f},
-std::array<float,2>{0.186027646f, 0.386315107f},
-std::array<float,2>{0.378192633f, 0.698935807f},
-std::array<float,2>{0.64180553f, 0.112945557f},
-std::array<float,2>{0.552806199f, 0.59493053f},
-std::array<float,2>{0.374341279f, 0.125836328f},
-std::array<float,2>{0.0480861999f, 0.971566319f},
-std::array<float,2>{0.907176316f, 0.285473883f},
-std::array<float,2>{0.834198236f, 0.511833191f},
-std::array<float,2>{0.197329074f, 0.225370452f},
-std::array<float,2>{0.464535624f, 0.902417183f},
-std::array<float,2>{0.736147702f, 0.343122572f},
-std::array<float,2>{0.600864232f, 0.867582858f},
-std::array<float,2>{0.29288283f, 0.455892414f},
-std::array<float,2>{0.0797632411f, 0.645043433f},
-std::array<float,2>{0.955938339f, 0.0427083597f},
-std::array<float,2>{0.898970187f, 0.945387363f},
-std::array<float,2>{0.0307459086f, 0.273867637f},
-std::array<float,2>{0.339413047f, 0.573985934f},
-std::array<float,2>{0.505812824f, 0.186985761f},
-std::array<float,2>{0.680736065f, 0.748673856f},
-std::array<float,2>{0.411988795f, 0.0858129337f},
-std::array<float,2>{0.152272344f, 0.792767406f},
-std::array<float,2>{0.798422754f, 0.427954018f},
-std::array<float,2>{0.844493032f, 0.65394032f},
-std::array<float,2>{0.243886471f, 0.0349518098f},
-std::array<float,2>{0.497058004f, 0.862141192f},
-std::array<float,2>{0.713656545f, 0.464031219f},
-std::array<float,2>{0.573634028f, 0.891325295f},
-std::array<float,2>{0.260583848f, 0.330955982f},
-std::array<float,2>{0.10656698f, 0.502239525f},
-std::array<float,2>{0.993433118f, 0.231602326f},
-std::array<float,2>{0.916796982f, 0.782028437f},
-std::array<float,2>{0.0559264608f, 0.433760852f},
-std::array<float,2>{0.359734803f, 0.738318622f},
-std::array<float,2>{0.55966872f, 0.087049596f},
-std::array<float,2>{0.651038587f, 0.566805124f},
-std::array<float,2>{0.389126569f, 0.177385777f},
-std::array<float,2>{0.172274768f, 0.942068934f},
-std::array<float,2>{0.76511842f, 0.273056686f},
-std::array<float,2>{0.968493998f, 0.542772651f},
-std::array<float,2>{0.0936898962f, 0.207592651f},
-std::array<float,2>{0.285016149f, 0.93725282f},
-std::array<float,2>{0.601686537f, 0.368317187f},
-std::array<float,2>{0.747338474f, 0.829155326f},
-std::array<float,2>{0.454369158f, 0.482416749f},
-std::array<float,2>{0.193537623f, 0.681204677f},
-std::array<float,2>{0.840536118f, 0.0190236866f},
-std::array<float,2>{0.807816088f, 0.980162919f},
-std::array<float,2>{0.144737408f, 0.289429992f},
-std::array<float,2>{0.415599287f, 0.601796925f},
-std::array<float,2>{0.678433955f, 0.137190804f},
-std::array<float,2>{0.508639574f, 0.692635059f},
-std::array<float,2>{0.329226255f, 0.124985203f},
-std::array<float,2>{0.0161749478f, 0.763319492f},
-std::array<float,2>{0.894923806f, 0.376614004f},
-std::array<float,2>{0.882874787f, 0.72269392f},
-std::array<float,2>{0.00362017169f, 0.0755864829f},
-std::array<float,2>{0.323584288f, 0.811976492f},
-std::array<float,2>{0.520715475f, 0.414650083f},
-std::array<float,2>{0.669557273f, 0.954957962f},
-std::array<float,2>{0.427785814f, 0.251140893f},
-std::array<float,2>{0.127146125f, 0.581946194f},
-std::array<float,2>{0.79478395f, 0.157046109f},
-std::array<float,2>{0.82653898f, 0.845979512f},
-std::array<float,2>{0.21005477f, 0.439510375f},
-std::array<float,2>{0.450401157f, 0.625258982f},
-std::array<float,2>{0.724066079f, 0.0548684709f},
-std::array<float,2>{0.619794428f, 0.518201947f},
-std::array<float,2>{0.299212903f, 0.239651129f},
-std::array<float,2>{0.0728868544f, 0.882376552f},
-std::array<float,2>{0.938701391f, 0.321989238f},
-std::array<float,2>{0.770236015f, 0.622227907f},
-std::array<float,2>{0.167684779f, 0.149893925f},
-std::array<float,2>{0.400027871f, 0.992217243f},
-std::array<float,2>{0.629189432f, 0.300228745f},
-std::array<float,2>{0.532239974f, 0.771732092f},
-std::array<float,2>{0.355640024f, 0.392523348f},
-std::array<float,2>{0.0404304676f, 0.718112767f},
-std::array<float,2>{0.93429482f, 0.100290932f},
-std::array<float,2>{0.981825948f, 0.910112023f},
-std::array<float,2>{0.119498469f, 0.35812223f},
-std::array<float,2>{0.274262667f, 0.557302892f},
-std::array<float,2>{0.578784108f, 0.189555511f},
-std::array<float,2>{0.692526042f, 0.664624155f},
-std::array<float,2>{0.469483703f, 0.00329361483f},
-std::array<float,2>{0.233609021f, 0.826280475f},
-std::array<float,2>{0.87171948f, 0.496563613f},
-std::array<float,2>{0.812438905f, 0.6384269f},
-std::array<float,2>{0.141380608f, 0.0514094755f},
-std::array<float,2>{0.421590149f, 0.852639079f},
-std::array<float,2>{0.673849702f, 0.44949007f},
-std::array<float,2>{0.515013456f, 0.888375163f},
-std::array<float,2>{0.332884431f, 0.318699062f},
-std::array<float,2>{0.0202810466f, 0.530724645f},
-std::array<float,2>{0.892101228f, 0.243886694f},
-std::array<float,2>{0.961780369f, 0.797596395f},
-std::array<float,2>{0.088557668f, 0.412262857f},
-std::array<float,2>{0.287229091f, 0.728335202f},
-std::array<float,2>{0.606260657f, 0.0630540401f},
-std::array<float,2>{0.743899465f, 0.592383444f},
-std::array<float,2>{0.457923979f, 0.164468348f},
-std::array<float,2>{0.188594669f, 0.96306777f},
-std::array<float,2>{0.838207245f, 0.258714855f},
-std::array<float,2>{0.920122027f, 0.554032207f},
-std::array<float,2>{0.0592995286f, 0.19827567f},
-std::array<float,2>{0.365180999f, 0.921829641f},
-std::array<float,2>{0.558364272f, 0.349472135f},
-std::array<float,2>{0.652757704f, 0.814541221f},
-std::array<float,2>{0.384886324f, 0.48941046f},
-std::array<float,2>{0.176720798f, 0.66272676f},
-std::array<float,2>{0.758503973f, 0.00945021026f},
-std::array<float,2>{0.848369002f, 0.990580916f},
-std::array<float,2>{0.248954028f, 0.309448391f},
-std::array<float,2>{0.493842959f, 0.615893185f},
-std::array<float,2>{0.718095243f, 0.144888967f},
-std::array<float,2>{0.575506687f, 0.710032284f},
-std::array<float,2>{0.262906909f, 0.101742223f},
-std::array<float,2>{0.104918145f, 0.77798301f},
-std::array<float,2>{0.996222198f, 0.400227726f},
-std::array<float,2>{0.97837323f, 0.745123148f},
-std::array<float,2>{0.124867976f, 0.0807130784f},
-std::array<float,2>{0.279993266f, 0.793671846f},
-std::array<float,2>{0.585051298f, 0.422061592f},
-std::array<float,2>{0.691325724f, 0.949497938f},
-std::array<float,2>{0.473625928f, 0.281235784f},
-std::array<float,2>{0.227512255f, 0.575258553f},
-std::array<float,2>{0.870008647f, 0.180708349f},
-std::array<float,2>{0.766217113f, 0.873889029f},
-std::array<float,2>{0.168687358f, 0.459079623f},
-std::array<float,2>{0.405564517f, 0.644465148f},
-std::array<float,2>{0.62531054f, 0.0448391587f},
-std::array<float,2>{0.538187921f, 0.511349618f},
-std::array<float,2>{0.354022503f, 0.218778476f},
-std::array<float,2>{0.0451827832f, 0.898500144f},
-std::array<float,2>{0.931492865f, 0.337215513f},
-std::array<float,2>{0.821430027f, 0.599713981f},
-std::array<float,2>{0.203357622f, 0.130782589f},
-std::array<float,2>{0.446131468f, 0.973560452f},
-std::array<float,2>{0.722525656f, 0.282820731f},
-std::array<float,2>{0.62370199f, 0.75205797f},
-std::array<float,2>{0.30408293f, 0.388015181f},
-std::array<float,2>{0.0775049776f, 0.69999665f},
-std::array<float,2>{0.943930149f, 0.115115114f},
-std::array<float,2>{0.888240516f, 0.922447205f},
-std::array<float,2>{0.00404322613f, 0.363699645f},
-std::array<float,2>{0.325674385f, 0.537421227f},
-std::array<float,2>{0.516191006f, 0.215421006f},
-std::array<float,2>{0.667954743f, 0.673391283f},
-std::array<float,2>{0.425030142f, 0.024319822f},
-std::array<float,2>{0.131472155f, 0.83710295f},
-std::array<float,2>{0.789542735f, 0.470796913f},
-std::array<float,2>{0.862588108f, 0.688319027f},
-std::array<float,2>{0.222247496f, 0.117775425f},
-std::array<float,2>{0.482299536f, 0.759949148f},
-std::array<float,2>{0.700696409f, 0.380786479f},
-std::array<float,2>{0.586093724f, 0.980695844f},
-std::array<float,2>{0.269076198f, 0.294317037f},
-std::array<float,2>{0.113239422f, 0.606053412f},
-std::array<float,2>{0.974370718f, 0.134607553f},
-std::array<float,2>{0.929270625f, 0.833230257f},
-std::array<float,2>{0.036314778f, 0.476865113f},
-std::array<float,2>{0.346650898f, 0.686032295f},
-std::array<float,2>{0.539694965f, 0.0229626186f},
-std::array<float,2>{0.636273146f, 0.543616116f},
-std::array<float,2>{0.39489314f, 0.205435932f},
-std::array<float,2>{0.163439453f, 0.930010498f},
-std::array<float,2>{0.780400991f, 0.374320686f},
-std::array<float,2>{0.94574976f, 0.562902689f},
-std::array<float,2>{0.0627458692f, 0.172163755f},
-std::array<float,2>{0.310934067f, 0.938276708f},
-std::array<float,2>{0.609932244f, 0.269494623f},
-std::array<float,2>{0.729512155f, 0.788131475f},
-std::array<float,2>{0.443892002f, 0.430600196f},
-std::array<float,2>{0.216710255f, 0.734644711f},
-std::array<float,2>{0.817584574f, 0.0932294801f},
-std::array<float,2>{0.787693322f, 0.896356463f},
-std::array<float,2>{0.14017579f, 0.333875954f},
-std::array<float,2>{0.432216704f, 0.504232407f},
-std::array<float,2>{0.658284545f, 0.226736903f},
-std::array<float,2>{0.524995863f, 0.651565611f},
-std::array<float,2>{0.319931805f, 0.0364679322f},
-std::array<float,2>{0.0144545939f, 0.866509259f},
-std::array<float,2>{0.876069546f, 0.467633665f},
-std::array<float,2>{0.903875649f, 0.671659112f},
-std::array<float,2>{0.0258759819f, 0.00644311681f},
-std::array<float,2>{0.34006533f, 0.823104739f},
-std::array<float,2>{0.501651883f, 0.494919837f},
-std::array<float,2>{0.684684932f, 0.912153363f},
-std::array<float,2>{0.40814358f, 0.35238117f},
-std::array<float,2>{0.15598847f, 0.559498906f},
-std::array<float,2>{0.804564953f, 0.191616982f},
-std::array<float,2>{0.831377208f, 0.769217491f},
-std::array<float,2>{0.201072097f, 0.395976424f},
-std::array<float,2>{0.468161464f, 0.713146985f},
-std::array<float,2>{0.739782929f, 0.0962862819f},
-std::array<float,2>{0.596501231f, 0.619641364f},
-std::array<float,2>{0.296504438f, 0.152894244f},
-std::array<float,2>{0.0825946778f, 0.996365547f},
-std::array<float,2>{0.960131764f, 0.301594287f},
-std::array<float,2>{0.755213439f, 0.520786941f},
-std::array<float,2>{0.182236433f, 0.23553808f},
-std::array<float,2>{0.381536126f, 0.875665009f},
-std::array<float,2>{0.648031592f, 0.324799538f},
-std::array<float,2>{0.54717803f, 0.851157725f},
-std::array<float,2>{0.37063387f, 0.442264408f},
-std::array<float,2>{0.053148631f, 0.631333947f},
-std::array<float,2>{0.910601616f, 0.0617138445f},
-std::array<float,2>{0.989054739f, 0.958061993f},
-std::array<float,2>{0.0980746076f, 0.256221861f},
-std::array<float,2>{0.257678539f, 0.58251518f},
-std::array<float,2>{0.567394793f, 0.163808748f},
-std::array<float,2>{0.710267544f, 0.720221281f},
-std::array<float,2>{0.485257298f, 0.0737958476f},
-std::array<float,2>{0.240265027f, 0.805855393f},
-std::array<float,2>{0.858137608f, 0.42130968f},
-std::array<float,2>{0.776235759f, 0.733501017f},
-std::array<float,2>{0.158191323f, 0.068376638f},
-std::array<float,2>{0.391370773f, 0.800782382f},
-std::array<float,2>{0.640579283f, 0.409224302f},
-std::array<float,2>{0.544967532f, 0.967581511f},
-std::array<float,2>{0.350379258f, 0.265558332f},
-std::array<float,2>{0.0338519216f, 0.586042404f},
-std::array<float,2>{0.925557435f, 0.169237599f},
-std::array<float,2>{0.970496356f, 0.858344018f},
-std::array<float,2>{0.115156293f, 0.446045905f},
-std::array<float,2>{0.270318508f, 0.634940267f},
-std::array<float,2>{0.591167688f, 0.0489133634f},
-std::array<float,2>{0.697982192f, 0.525263488f},
-std::array<float,2>{0.479932904f, 0.249054745f},
-std::array<float,2>{0.222784668f, 0.884791195f},
-std::array<float,2>{0.864267409f, 0.314418823f},
-std::array<float,2>{0.881997406f, 0.61259234f},
-std::array<float,2>{0.00836046133f, 0.144167975f},
-std::array<float,2>{0.315729976f, 0.985555768f},
-std::array<float,2>{0.530120611f, 0.308466882f},
-std::array<float,2>{0.663125098f, 0.77497375f},
-std::array<float,2>{0.437208891f, 0.403908879f},
-std::array<float,2>{0.136245832f, 0.703690469f},
-std::array<float,2>{0.782728076f, 0.105965711f},
-std::array<float,2>{0.81570214f, 0.917584658f},
-std::array<float,2>{0.213153496f, 0.344186932f},
-std::array<float,2>{0.439536989f, 0.548481107f},
-std::array<float,2>{0.734056592f, 0.199857011f},
-std::array<float,2>{0.614112854f, 0.658903301f},
-std::array<float,2>{0.305641323f, 0.0140184984f},
-std::array<float,2>{0.067296423f, 0.816592276f},
-std::array<float,2>{0.951853335f, 0.487473398f},
-std::array<float,2>{0.953150451f, 0.64684695f},
-std::array<float,2>{0.0820157677f, 0.0397931077f},
-std::array<float,2>{0.290647089f, 0.870898247f},
-std::array<float,2>{0.5986588f, 0.453169435f},
-std::array<float,2>{0.737336814f, 0.905301988f},
-std::array<float,2>{0.461045891f, 0.340691596f},
-std::array<float,2>{0.196248308f, 0.514761925f},
-std::array<float,2>{0.833007872f, 0.223780751f},
-std::array<float,2>{0.799286425f, 0.78988719f},
-std::array<float,2>{0.149130851f, 0.427083343f},
-std::array<float,2>{0.412245005f, 0.746729612f},
-std::array<float,2>{0.683057547f, 0.0830996558f},
-std::array<float,2>{0.50640732f, 0.572193623f},
-std::array<float,2>{0.33642149f, 0.184514955f},
-std::array<float,2>{0.0278460626f, 0.947298706f},
-std::array<float,2>{0.901687205f, 0.276284933f},
-std::array<float,2>{0.853670716f, 0.53339988f},
-std::array<float,2>{0.236377448f, 0.211284801f},
-std::array<float,2>{0.489808917f, 0.927457392f},
-std::array<float,2>{0.706018686f, 0.35995242f},
-std::array<float,2>{0.563227296f, 0.843718171f},
-std::array<float,2>{0.250989556f, 0.474547118f},
-std::array<float,2>{0.0971193388f, 0.677076042f},
-std::array<float,2>{0.98763907f, 0.0302458201f},
-std::array<float,2>{0.909847617f, 0.970222294f},
-std::array<float,2>{0.0489944629f, 0.287712276f},
-std::array<float,2>{0.37282902f, 0.596826851f},
-std::array<float,2>{0.551485598f, 0.127209887f},
-std::array<float,2>{0.644286156f, 0.696557343f},
-std::array<float,2>{0.376394093f, 0.110070586f},
-std::array<float,2>{0.18522501f, 0.75428462f},
-std::array<float,2>{0.753174722f, 0.384490073f},
-std::array<float,2>{0.84320879f, 0.682318866f},
-std::array<float,2>{0.191834986f, 0.0166065227f},
-std::array<float,2>{0.456907481f, 0.830264091f},
-std::array<float,2>{0.748412967f, 0.483311713f},
-std::array<float,2>{0.603711009f, 0.934638262f},
-std::array<float,2>{0.282390535f, 0.370707303f},
-std::array<float,2>{0.0913726017f, 0.540593207f},
-std::array<float,2>{0.966526806f, 0.209454924f},
-std::array<float,2>{0.898045301f, 0.763813257f},
-std::array<float,2>{0.0182161946f, 0.377728879f},
-std::array<float,2>{0.332015574f, 0.695174694f},
-std::array<float,2>{0.511523008f, 0.12235669f},
-std::array<float,2>{0.67676878f, 0.60475117f},
-std::array<float,2>{0.416445196f, 0.139352739f},
-std::array<float,2>{0.1478412f, 0.977599263f},
-std::array<float,2>{0.805324674f, 0.291208446f},
-std::array<float,2>{0.994608998f, 0.501017511f},
-std::array<float,2>{0.107995525f, 0.234076098f},
-std::array<float,2>{0.258079082f, 0.892906427f},
-std::array<float,2>{0.570584357f, 0.328153193f},
-std::array<float,2>{0.712012649f, 0.861139655f},
-std::array<float,2>{0.499255627f, 0.46121037f},
-std::array<float,2>{0.244320095f, 0.65452826f},
-std::array<float,2>{0.846061826f, 0.0318091027f},
-std::array<float,2>{0.763310194f, 0.943460643f},
-std::array<float,2>{0.174008831f, 0.269734085f},
-std::array<float,2>{0.388644964f, 0.569491088f},
-std::array<float,2>{0.648526788f, 0.178268924f},
-std::array<float,2>{0.561652362f, 0.741878033f},
-std::array<float,2>{0.36246562f, 0.0882047936f},
-std::array<float,2>{0.0573077053f, 0.784567058f},
-std::array<float,2>{0.915270805f, 0.436933011f},
-std::array<float,2>{0.935945094f, 0.715894818f},
-std::array<float,2>{0.0421986505f, 0.09766265f},
-std::array<float,2>{0.35936588f, 0.769702315f},
-std::array<float,2>{0.53330785f, 0.392652601f},
-std::array<float,2>{0.630862832f, 0.994718969f},
-std::array<float,2>{0.401030093f, 0.298183501f},
-std::array<float,2>{0.16514945f, 0.623071909f},
-std::array<float,2>{0.772984087f, 0.15197292f},
-std::array<float,2>{0.874622405f, 0.824222684f},
-std::array<float,2>{0.230598718f, 0.499358326f},
-std::array<float,2>{0.471373588f, 0.666288137f},
-std::array<float,2>{0.694169641f, 0.000350902701f},
-std::array<float,2>{0.580423594f, 0.556508303f},
-std::array<float,2>{0.275434703f, 0.18753238f},
-std::array<float,2>{0.117983267f, 0.906801999f},
-std::array<float,2>{0.983885586f, 0.355937362f},
-std::array<float,2>{0.795479238f, 0.579795599f},
-std::array<float,2>{0.126842007f, 0.158774629f},
-std::array<float,2>{0.426326632f, 0.956018388f},
-std::array<float,2>{0.671417356f, 0.252842635f},
-std::array<float,2>{0.523264706f, 0.810330391f},
-std::array<float,2>{0.321434647f, 0.416207373f},
-std::array<float,2>{0.00105552841f, 0.725983918f},
-std::array<float,2>{0.884878099f, 0.0776433051f},
-std::array<float,2>{0.939927042f, 0.879503131f},
-std::array<float,2>{0.0712626129f, 0.323959023f},
-std::array<float,2>{0.297827512f, 0.515664637f},
-std::array<float,2>{0.618275166f, 0.24045147f},
-std::array<float,2>{0.725753486f, 0.628875315f},
-std::array<float,2>{0.451410294f, 0.0580076948f},
-std::array<float,2>{0.207939193f, 0.844386876f},
-std::array<float,2>{0.825055301f, 0.437609285f},
-std::array<float,2>{0.764741838f, 0.655680358f},
-std::array<float,2>{0.172111377f, 0.0323435031f},
-std::array<float,2>{0.388780266f, 0.859984159f},
-std::array<float,2>{0.651342213f, 0.462524056f},
-std::array<float,2>{0.559840977f, 0.894192457f},
-std::array<float,2>{0.359579384f, 0.329143524f},
-std::array<float,2>{0.0556790642f, 0.500865817f},
-std::array<float,2>{0.916560352f, 0.233391806f},
-std::array<float,2>{0.993257761f, 0.78412056f},
-std::array<float,2>{0.106721111f, 0.436190248f},
-std::array<float,2>{0.260295004f, 0.740634859f},
-std::array<float,2>{0.573282063f, 0.0892745182f},
-std::array<float,2>{0.713429391f, 0.56865257f},
-std::array<float,2>{0.496586859f, 0.178784609f},
-std::array<float,2>{0.244085252f, 0.944835365f},
-std::array<float,2>{0.844432294f, 0.271187276f},
-std::array<float,2>{0.894553542f, 0.53926909f},
-std::array<float,2>{0.0165167507f, 0.210277304f},
-std::array<float,2>{0.329509377f, 0.933679104f},
-std::array<float,2>{0.508460701f, 0.36944288f},
-std::array<float,2>{0.678596914f, 0.831844151f},
-std::array<float,2>{0.415932745f, 0.484066308f},
-std::array<float,2>{0.14478834f, 0.682929218f},
-std::array<float,2>{0.808052421f, 0.0157506857f},
-std::array<float,2>{0.840677261f, 0.977036238f},
-std::array<float,2>{0.193685189f, 0.29254961f},
-std::array<float,2>{0.454342902f, 0.603929281f},
-std::array<float,2>{0.74720192f, 0.140214145f},
-std::array<float,2>{0.601965845f, 0.694013715f},
-std::array<float,2>{0.284889936f, 0.121301591f},
-std::array<float,2>{0.0934511498f, 0.764946878f},
-std::array<float,2>{0.968700528f, 0.378619522f},
-std::array<float,2>{0.938798368f, 0.725119531f},
-std::array<float,2>{0.0730362758f, 0.0768529698f},
-std::array<float,2>{0.29899627f, 0.809230387f},
-std::array<float,2>{0.620037854f, 0.417106777f},
-std::array<float,2>{0.723848939f, 0.956278026f},
-std::array<float,2>{0.450616509f, 0.253667444f},
-std::array<float,2>{0.210422724f, 0.578854501f},
-std::array<float,2>{0.826173067f, 0.159566119f},
-std::array<float,2>{0.794560254f, 0.844951749f},
-std::array<float,2>{0.127229467f, 0.4392775f},
-std::array<float,2>{0.428096741f, 0.627631426f},
-std::array<float,2>{0.669806123f, 0.0574220195f},
-std::array<float,2>{0.520777345f, 0.51669842f},
-std::array<float,2>{0.323365837f, 0.241938248f},
-std::array<float,2>{0.00377887394f, 0.880545974f},
-std::array<float,2>{0.883176982f, 0.322309762f},
-std::array<float,2>{0.871833146f, 0.624069452f},
-std::array<float,2>{0.233795971f, 0.151296929f},
-std::array<float,2>{0.469289571f, 0.995693684f},
-std::array<float,2>{0.692789018f, 0.29711017f},
-std::array<float,2>{0.578868687f, 0.771233737f},
-std::array<float,2>{0.274094224f, 0.394303352f},
-std::array<float,2>{0.119214445f, 0.715129852f},
-std::array<float,2>{0.98164916f, 0.0990523323f},
-std::array<float,2>{0.934368074f, 0.908116758f},
-std::array<float,2>{0.0401636213f, 0.356675535f},
-std::array<float,2>{0.355870575f, 0.554994226f},
-std::array<float,2>{0.532504082f, 0.188856617f},
-std::array<float,2>{0.629010677f, 0.667184651f},
-std::array<float,2>{0.400155455f, 0.00103377923f},
-std::array<float,2>{0.167837098f, 0.82604599f},
-std::array<float,2>{0.770384252f, 0.498120815f},
-std::array<float,2>{0.813450873f, 0.704374433f},
-std::array<float,2>{0.211327195f, 0.106524773f},
-std::array<float,2>{0.438329667f, 0.774024844f},
-std::array<float,2>{0.731736004f, 0.402786702f},
-std::array<float,2>{0.615747273f, 0.984407127f},
-std::array<float,2>{0.307144493f, 0.307604879f},
-std::array<float,2>{0.0688534155f, 0.612188816f},
-std::array<float,2>{0.9496032f, 0.142940551f},
-std::array<float,2>{0.878980517f, 0.818255723f},
-std::array<float,2>{0.0111338617f, 0.486654699f},
-std::array<float,2>{0.314307749f, 0.659240663f},
-std::array<float,2>{0.528357863f, 0.0154911811f},
-std::array<float,2>{0.662080407f, 0.547121763f},
-std::array<float,2>{0.434454501f, 0.200227648f},
-std::array<float,2>{0.134483069f, 0.916101754f},
-std::array<float,2>{0.784198821f, 0.345251203f},
-std::array<float,2>{0.970875263f, 0.587737143f},
-std::array<float,2>{0.116557404f, 0.168207869f},
-std::array<float,2>{0.271968573f, 0.967850447f},
-std::array<float,2>{0.59370476f, 0.264230043f},
-std::array<float,2>{0.695482075f, 0.802515626f},
-std::array<float,2>{0.477692068f, 0.409132332f},
-std::array<float,2>{0.224757031f, 0.73332119f},
-std::array<float,2>{0.867126405f, 0.0701086f},
-std::array<float,2>{0.7739079f, 0.886259973f},
-std::array<float,2>{0.160127342f, 0.313425153f},
-std::array<float,2>{0.392863095f, 0.524055243f},
-std::array<float,2>{0.637628973f, 0.248536631f},
-std::array<float,2>{0.544742703f, 0.636113405f},
-std::array<float,2>{0.348556876f, 0.0505440719f},
-std::array<float,2>{0.0325317867f, 0.858529687f},
-std::array<float,2>{0.922648907f, 0.447220057f},
-std::array<float,2>{0.90697217f, 0.676125169f},
-std::array<float,2>{0.0482781678f, 0.0306441523f},
-std::array<float,2>{0.374098033f, 0.84244287f},
-std::array<float,2>{0.553027451f, 0.472777396f},
-std::array<float,2>{0.641852975f, 0.926469982f},
-std::array<float,2>{0.377956241f, 0.360811174f},
-std::array<float,2>{0.185742259f, 0.534692645f},
-std::array<float,2>{0.750450909f, 0.212527245f},
-std::array<float,2>{0.851941347f, 0.755605161f},
-std::array<float,2>{0.234960958f, 0.38361606f},
-std::array<float,2>{0.492046982f, 0.695429385f},
-std::array<float,2>{0.70389235f, 0.111048505f},
-std::array<float,2>{0.565478861f, 0.595865965f},
-std::array<float,2>{0.252625734f, 0.128722191f},
-std::array<float,2>{0.0947272107f, 0.969000518f},
-std::array<float,2>{0.985673964f, 0.288965493f},
-std::array<float,2>{0.798758745f, 0.514408946f},
-std::array<float,2>{0.152059674f, 0.222745329f},
-std::array<float,2>{0.411679566f, 0.904900968f},
-std::array<float,2>{0.681109726f, 0.341563135f},
-std::array<float,2>{0.505538046f, 0.869554579f},
-std::array<float,2>{0.339785755f, 0.454149693f},
-std::array<float,2>{0.0302901193f, 0.648356557f},
-std::array<float,2>{0.899358571f, 0.0408241786f},
-std::array<float,2>{0.955656946f, 0.948804975f},
-std::array<float,2>{0.0798616558f, 0.277039886f},
-std::array<float,2>{0.292531222f, 0.57062602f},
-std::array<float,2>{0.60067606f, 0.185507655f},
-std::array<float,2>{0.736031234f, 0.747869194f},
-std::array<float,2>{0.464678705f, 0.0820428506f},
-std::array<float,2>{0.197696641f, 0.790602505f},
-std::array<float,2>{0.834356904f, 0.425897926f},
-std::array<float,2>{0.786376357f, 0.736149848f},
-std::array<float,2>{0.136755586f, 0.092654556f},
-std::array<float,2>{0.431471318f, 0.787738025f},
-std::array<float,2>{0.657215059f, 0.431524813f},
-std::array<float,2>{0.52641362f, 0.938612759f},
-std::array<float,2>{0.316641092f, 0.268428355f},
-std::array<float,2>{0.0121660801f, 0.564005733f},
-std::array<float,2>{0.877289236f, 0.173019066f},
-std::array<float,2>{0.948691547f, 0.866158962f},
-std::array<float,2>{0.0652654693f, 0.468246371f},
-std::array<float,2>{0.310447246f, 0.65064162f},
-std::array<float,2>{0.612931788f, 0.0351702906f},
-std::array<float,2>{0.727199495f, 0.505276084f},
-std::array<float,2>{0.443174958f, 0.227914378f},
-std::array<float,2>{0.217457756f, 0.894727051f},
-std::array<float,2>{0.81859833f, 0.332809806f},
-std::array<float,2>{0.925979912f, 0.606734753f},
-std::array<float,2>{0.0382412896f, 0.133003384f},
-std::array<float,2>{0.344549656f, 0.981655419f},
-std::array<float,2>{0.541605592f, 0.293409735f},
-std::array<float,2>{0.634319544f, 0.761555016f},
-std::array<float,2>{0.397664458f, 0.379005432f},
-std::array<float,2>{0.162064895f, 0.688799739f},
-std::array<float,2>{0.779002726f, 0.118632644f},
-std::array<float,2>{0.860441327f, 0.931234896f},
-std::array<float,2>{0.220084146f, 0.373454213f},
-std::array<float,2>{0.483300149f, 0.54433167f},
-std::array<float,2>{0.702890038f, 0.206062838f},
-std::array<float,2>{0.588390589f, 0.687023163f},
-std::array<float,2>{0.266383976f, 0.0219801031f},
-std::array<float,2>{0.110687256f, 0.832052886f},
-std::array<float,2>{0.975817442f, 0.478322417f},
-std::array<float,2>{0.990289569f, 0.631966174f},
-std::array<float,2>{0.100049011f, 0.060595613f},
-std::array<float,2>{0.254368454f, 0.849763453f},
-std::array<float,2>{0.568826258f, 0.44274658f},
-std::array<float,2>{0.707855344f, 0.876738012f},
-std::array<float,2>{0.488121569f, 0.326011688f},
-std::array<float,2>{0.238809928f, 0.519705594f},
-std::array<float,2>{0.855485618f, 0.235144779f},
-std::array<float,2>{0.75742507f, 0.805566192f},
-std::array<float,2>{0.180983678f, 0.420356661f},
-std::array<float,2>{0.378956497f, 0.719356894f},
-std::array<float,2>{0.646002471f, 0.0726112425f},
-std::array<float,2>{0.549630165f, 0.583261192f},
-std::array<float,2>{0.367289811f, 0.16226013f},
-std::array<float,2>{0.0525875092f, 0.957540989f},
-std::array<float,2>{0.91239208f, 0.257226944f},
-std::array<float,2>{0.829262972f, 0.560229063f},
-std::array<float,2>{0.203096136f, 0.193280026f},
-std::array<float,2>{0.465836614f, 0.913726509f},
-std::array<float,2>{0.741652131f, 0.352605015f},
-std::array<float,2>{0.595487833f, 0.823334873f},
-std::array<float,2>{0.294289261f, 0.495645225f},
-std::array<float,2>{0.0843563676f, 0.67035985f},
-std::array<float,2>{0.957146704f, 0.00736765703f},
-std::array<float,2>{0.904781044f, 0.997677207f},
-std::array<float,2>{0.023841951f, 0.302122474f},
-std::array<float,2>{0.343740344f, 0.620274365f},
-std::array<float,2>{0.503384352f, 0.153975829f},
-std::array<float,2>{0.686614037f, 0.714226186f},
-std::array<float,2>{0.408418328f, 0.0972384214f},
-std::array<float,2>{0.153392658f, 0.76759398f},
-std::array<float,2>{0.802294075f, 0.394611657f},
-std::array<float,2>{0.850375235f, 0.664000928f},
-std::array<float,2>{0.246993676f, 0.00856342912f},
-std::array<float,2>{0.495176435f, 0.815549672f},
-std::array<float,2>{0.714962959f, 0.488620013f},
-std::array<float,2>{0.577221632f, 0.920810878f},
-std::array<float,2>{0.264246911f, 0.347977608f},
-std::array<float,2>{0.102978028f, 0.553221762f},
-std::array<float,2>{0.998880088f, 0.198219821f},
-std::array<float,2>{0.918119431f, 0.778409421f},
-std::array<float,2>{0.0618012697f, 0.399363875f},
-std::array<float,2>{0.366379797f, 0.709567368f},
-std::array<float,2>{0.555183947f, 0.102714919f},
-std::array<float,2>{0.655476749f, 0.616831183f},
-std::array<float,2>{0.383509874f, 0.145900354f},
-std::array<float,2>{0.178444564f, 0.991907954f},
-std::array<float,2>{0.760665417f, 0.309797972f},
-std::array<float,2>{0.964127541f, 0.529915392f},
-std::array<float,2>{0.0863096789f, 0.242850661f},
-std::array<float,2>{0.286835074f, 0.887678444f},
-std::array<float,2>{0.60801506f, 0.320147216f},
-std::array<float,2>{0.745133996f, 0.852043509f},
-std::array<float,2>{0.459878623f, 0.450940222f},
-std::array<float,2>{0.19040212f, 0.637330055f},
-std::array<float,2>{0.837782919f, 0.0521309935f},
-std::array<float,2>{0.809082687f, 0.964257598f},
-std::array<float,2>{0.144262746f, 0.259541065f},
-std::array<float,2>{0.417993546f, 0.593616009f},
-std::array<float,2>{0.672605932f, 0.165505841f},
-std::array<float,2>{0.513556957f, 0.727045894f},
-std::array<float,2>{0.335789174f, 0.0643354505f},
-std::array<float,2>{0.0216484778f, 0.798633814f},
-std::array<float,2>{0.893563986f, 0.413155317f},
-std::array<float,2>{0.890025556f, 0.70026499f},
-std::array<float,2>{0.00739716552f, 0.113663591f},
-std::array<float,2>{0.328015983f, 0.753501177f},
-std::array<float,2>{0.518280208f, 0.386907041f},
-std::array<float,2>{0.664796829f, 0.97459048f},
-std::array<float,2>{0.423526436f, 0.28164041f},
-std::array<float,2>{0.129608393f, 0.600710392f},
-std::array<float,2>{0.791053057f, 0.129297972f},
-std::array<float,2>{0.822854996f, 0.83607471f},
-std::array<float,2>{0.206494063f, 0.471925139f},
-std::array<float,2>{0.447401255f, 0.672383606f},
-std::array<float,2>{0.719557047f, 0.0244315136f},
-std::array<float,2>{0.622193813f, 0.539026022f},
-std::array<float,2>{0.301820219f, 0.216265485f},
-std::array<float,2>{0.0750228986f, 0.922877729f},
-std::array<float,2>{0.943227351f, 0.364508152f},
-std::array<float,2>{0.768548727f, 0.574876785f},
-std::array<float,2>{0.17011711f, 0.179968163f},
-std::array<float,2>{0.403790236f, 0.95094806f},
-std::array<float,2>{0.627656341f, 0.280083895f},
-std::array<float,2>{0.53699857f, 0.793984473f},
-std::array<float,2>{0.352233648f, 0.423347563f},
-std::array<float,2>{0.0442001149f, 0.744960129f},
-std::array<float,2>{0.93238765f, 0.0812597051f},
-std::array<float,2>{0.979525566f, 0.899563015f},
-std::array<float,2>{0.122908019f, 0.33594501f},
-std::array<float,2>{0.279184222f, 0.509995639f},
-std::array<float,2>{0.582637727f, 0.220545262f},
-std::array<float,2>{0.688659549f, 0.643251896f},
-std::array<float,2>{0.474716276f, 0.0434230082f},
-std::array<float,2>{0.228671357f, 0.874418855f},
-std::array<float,2>{0.867230058f, 0.460312933f},
-std::array<float,2>{0.805481911f, 0.68005234f},
-std::array<float,2>{0.147468895f, 0.0184362475f},
-std::array<float,2>{0.416098058f, 0.828323603f},
-std::array<float,2>{0.677111208f, 0.481352627f},
-std::array<float,2>{0.51144594f, 0.935946941f},
-std::array<float,2>{0.331607074f, 0.367236197f},
-std::array<float,2>{0.0184368808f, 0.541441381f},
-std::array<float,2>{0.898202717f, 0.208901539f},
-std::array<float,2>{0.966774106f, 0.762276053f},
-std::array<float,2>{0.0917205885f, 0.375452131f},
-std::array<float,2>{0.282611489f, 0.692276657f},
-std::array<float,2>{0.603776276f, 0.123061024f},
-std::array<float,2>{0.748163402f, 0.603474855f},
-std::array<float,2>{0.456665188f, 0.13831538f},
-std::array<float,2>{0.19164598f, 0.979054093f},
-std::array<float,2>{0.842980027f, 0.29027161f},
-std::array<float,2>{0.915351689f, 0.503817499f},
-std::array<float,2>{0.0575003289f, 0.231040969f},
-std::array<float,2>{0.362590581f, 0.892513037f},
-std::array<float,2>{0.561866343f, 0.331549674f},
-std::array<float,2>{0.648913145f, 0.862921178f},
-std::array<float,2>{0.388388544f, 0.463340253f},
-std::array<float,2>{0.174240813f, 0.652720392f},
-std::array<float,2>{0.76355511f, 0.0336300731f},
-std::array<float,2>{0.845769703f, 0.942395806f},
-std::array<float,2>{0.244544804f, 0.27213791f},
-std::array<float,2>{0.499269336f, 0.567403436f},
-std::array<float,2>{0.712398946f, 0.176185951f},
-std::array<float,2>{0.570396423f, 0.739466071f},
-std::array<float,2>{0.257970989f, 0.0864919052f},
-std::array<float,2>{0.108303972f, 0.782457709f},
-std::array<float,2>{0.99433434f, 0.434711367f},
-std::array<float,2>{0.983547032f, 0.717325389f},
-std::array<float,2>{0.117878757f, 0.100934133f},
-std::array<float,2>{0.27572915f, 0.772469997f},
-std::array<float,2>{0.580120146f, 0.390742779f},
-std::array<float,2>{0.693906844f, 0.993712306f},
-std::array<float,2>{0.471536845f, 0.299197316f},
-std::array<float,2>{0.23076427f, 0.621849418f},
-std::array<float,2>{0.874891341f, 0.14914991f},
-std::array<float,2>{0.773333013f, 0.827602565f},
-std::array<float,2>{0.165498868f, 0.497832119f},
-std::array<float,2>{0.401345164f, 0.665704668f},
-std::array<float,2>{0.631283998f, 0.0028071797f},
-std::array<float,2>{0.533489943f, 0.558388412f},
-std::array<float,2>{0.359054625f, 0.190824851f},
-std::array<float,2>{0.0423175395f, 0.908331931f},
-std::array<float,2>{0.935618579f, 0.359282225f},
-std::array<float,2>{0.824721873f, 0.580780983f},
-std::array<float,2>{0.207654014f, 0.157695875f},
-std::array<float,2>{0.451583028f, 0.953449607f},
-std::array<float,2>{0.725834191f, 0.250779092f},
-std::array<float,2>{0.618584275f, 0.811155856f},
-std::array<float,2>{0.297454923f, 0.41539678f},
-std::array<float,2>{0.0709906816f, 0.723707616f},
-std::array<float,2>{0.939582109f, 0.0742575675f},
-std::array<float,2>{0.885150731f, 0.880988777f},
-std::array<float,2>{0.00140028587f, 0.320844233f},
-std::array<float,2>{0.321537256f, 0.519448996f},
-std::array<float,2>{0.523190618f, 0.239138022f},
-std::array<float,2>{0.671781301f, 0.626347005f},
-std::array<float,2>{0.426671714f, 0.0560437553f},
-std::array<float,2>{0.126654267f, 0.847058475f},
-std::array<float,2>{0.795819163f, 0.440686226f},
-std::array<float,2>{0.864735425f, 0.731532395f},
-std::array<float,2>{0.223109141f, 0.0674981624f},
-std::array<float,2>{0.479724765f, 0.803938448f},
-std::array<float,2>{0.698109984f, 0.407965958f},
-std::array<float,2>{0.591015637f, 0.966741443f},
-std::array<float,2>{0.270207763f, 0.26233992f},
-std::array<float,2>{0.114934824f, 0.589812458f},
-std::array<float,2>{0.970438123f, 0.170088127f},
-std::array<float,2>{0.925415576f, 0.856303751f},
-std::array<float,2>{0.0340270586f, 0.448968351f},
-std::array<float,2>{0.350288361f, 0.633535028f},
-std::array<float,2>{0.545253575f, 0.0471735559f},
-std::array<float,2>{0.640162051f, 0.526045144f},
-std::array<float,2>{0.39130652f, 0.247285321f},
-std::array<float,2>{0.157896698f, 0.883645296f},
-std::array<float,2>{0.776120126f, 0.314738065f},
-std::array<float,2>{0.951928079f, 0.60939461f},
-std::array<float,2>{0.0671022236f, 0.141875342f},
-std::array<float,2>{0.305229515f, 0.986601532f},
-std::array<float,2>{0.613792479f, 0.306562155f},
-std::array<float,2>{0.734298646f, 0.775984585f},
-std::array<float,2>{0.439940929f, 0.405600518f},
-std::array<float,2>{0.212897062f, 0.706805348f},
-std::array<float,2>{0.815461576f, 0.107594565f},
-std::array<float,2>{0.783124149f, 0.915989995f},
-std::array<float,2>{0.136579007f, 0.345924109f},
-std::array<float,2>{0.437488765f, 0.548999548f},
-std::array<float,2>{0.663346052f, 0.202623338f},
-std::array<float,2>{0.529964268f, 0.656481266f},
-std::array<float,2>{0.315523982f, 0.0136617133f},
-std::array<float,2>{0.00859532878f, 0.818756819f},
-std::array<float,2>{0.882274449f, 0.486181796f},
-std::array<float,2>{0.901606441f, 0.646435559f},
-std::array<float,2>{0.0281483345f, 0.0414361767f},
-std::array<float,2>{0.336046904f, 0.868425727f},
-std::array<float,2>{0.506673694f, 0.456784159f},
-std::array<float,2>{0.682858348f, 0.903744221f},
-std::array<float,2>{0.412479222f, 0.342308074f},
-std::array<float,2>{0.149171054f, 0.513280451f},
-std::array<float,2>{0.798949599f, 0.226245403f},
-std::array<float,2>{0.83332926f, 0.791766286f},
-std::array<float,2>{0.195909753f, 0.429228574f},
-std::array<float,2>{0.461209804f, 0.749475896f},
-std::array<float,2>{0.737693429f, 0.0841910988f},
-std::array<float,2>{0.599099874f, 0.573019326f},
-std::array<float,2>{0.290829778f, 0.18643418f},
-std::array<float,2>{0.0815508291f, 0.947006941f},
-std::array<float,2>{0.953392386f, 0.274879843f},
-std::array<float,2>{0.753134608f, 0.532583892f},
-std::array<float,2>{0.185423434f, 0.214155391f},
-std::array<float,2>{0.376208037f, 0.928295672f},
-std::array<float,2>{0.6445207f, 0.361351967f},
-std::array<float,2>{0.551698327f, 0.840245426f},
-std::array<float,2>{0.372696519f, 0.474888474f},
-std::array<float,2>{0.0492468774f, 0.679415166f},
-std::array<float,2>{0.910008132f, 0.0274296347f},
-std::array<float,2>{0.987529099f, 0.97172904f},
-std::array<float,2>{0.0969059914f, 0.286839157f},
-std::array<float,2>{0.251276314f, 0.594310045f},
-std::array<float,2>{0.563364923f, 0.12626949f},
-std::array<float,2>{0.705638111f, 0.698096216f},
-std::array<float,2>{0.49002552f, 0.112277046f},
-std::array<float,2>{0.236765608f, 0.756089747f},
-std::array<float,2>{0.85383904f, 0.385552227f},
-std::array<float,2>{0.780534744f, 0.690851927f},
-std::array<float,2>{0.163246706f, 0.119752303f},
-std::array<float,2>{0.394550562f, 0.757816017f},
-std::array<float,2>{0.636605084f, 0.381857306f},
-std::array<float,2>{0.540027857f, 0.984024048f},
-std::array<float,2>{0.346211761f, 0.295553327f},
-std::array<float,2>{0.0365695171f, 0.608128309f},
-std::array<float,2>{0.929601192f, 0.134900212f},
-std::array<float,2>{0.974265158f, 0.834572971f},
-std::array<float,2>{0.112929776f, 0.479521692f},
-std::array<float,2>{0.269468039f, 0.684410036f},
-std::array<float,2>{0.586402178f, 0.0204847269f},
-std::array<float,2>{0.701090097f, 0.545242667f},
-std::array<float,2>{0.482161492f, 0.204214513f},
-std::array<float,2>{0.222510234f, 0.932235956f},
-std::array<float,2>{0.862479568f, 0.371440232f},
-std::array<float,2>{0.876459539f, 0.564838409f},
-std::array<float,2>{0.0142931184f, 0.174485847f},
-std::array<float,2>{0.320261121f, 0.941127002f},
-std::array<float,2>{0.525361598f, 0.265891641f},
-std::array<float,2>{0.658538342f, 0.785478413f},
-std::array<float,2>{0.432540089f, 0.433292478f},
-std::array<float,2>{0.140472203f, 0.736687899f},
-std::array<float,2>{0.788001299f, 0.0913112164f},
-std::array<float,2>{0.817727625f, 0.896790326f},
-std::array<float,2>{0.216446951f, 0.335918933f},
-std::array<float,2>{0.444278061f, 0.506190181f},
-std::array<float,2>{0.729874909f, 0.229547814f},
-std::array<float,2>{0.610311508f, 0.649250448f},
-std::array<float,2>{0.310555905f, 0.0381542593f},
-std::array<float,2>{0.0626357868f, 0.864983618f},
-std::array<float,2>{0.945353925f, 0.46579963f},
-std::array<float,2>{0.960238636f, 0.668439746f},
-std::array<float,2>{0.082989417f, 0.00400375109f},
-std::array<float,2>{0.296703964f, 0.820997179f},
-std::array<float,2>{0.596260607f, 0.493494838f},
-std::array<float,2>{0.740049958f, 0.91209209f},
-std::array<float,2>{0.467924178f, 0.355337799f},
-std::array<float,2>{0.200819924f, 0.561748683f},
-std::array<float,2>{0.83124125f, 0.194643095f},
-std::array<float,2>{0.804427743f, 0.766485751f},
-std::array<float,2>{0.156094089f, 0.398381978f},
-std::array<float,2>{0.407842547f, 0.712193847f},
-std::array<float,2>{0.685033977f, 0.0938471258f},
-std::array<float,2>{0.501837909f, 0.617314458f},
-std::array<float,2>{0.340223968f, 0.155346498f},
-std::array<float,2>{0.0254046246f, 0.998165131f},
-std::array<float,2>{0.904275417f, 0.303691298f},
-std::array<float,2>{0.858280122f, 0.521821737f},
-std::array<float,2>{0.240720317f, 0.236765608f},
-std::array<float,2>{0.484994978f, 0.877416372f},
-std::array<float,2>{0.710026562f, 0.326690555f},
-std::array<float,2>{0.567782283f, 0.849373639f},
-std::array<float,2>{0.257391125f, 0.444170326f},
-std::array<float,2>{0.0977281779f, 0.629971683f},
-std::array<float,2>{0.988935232f, 0.0602274537f},
-std::array<float,2>{0.910244048f, 0.959688306f},
-std::array<float,2>{0.0529312193f, 0.255257398f},
-std::array<float,2>{0.371065736f, 0.585817516f},
-std::array<float,2>{0.547085404f, 0.16089797f},
-std::array<float,2>{0.648308694f, 0.721754551f},
-std::array<float,2>{0.381592929f, 0.0709421411f},
-std::array<float,2>{0.182526916f, 0.807548046f},
-std::array<float,2>{0.754969358f, 0.41928184f},
-std::array<float,2>{0.838009953f, 0.639000416f},
-std::array<float,2>{0.188745961f, 0.0540151596f},
-std::array<float,2>{0.457721472f, 0.854397297f},
-std::array<float,2>{0.743735194f, 0.451695561f},
-std::array<float,2>{0.606144369f, 0.890320897f},
-std::array<float,2>{0.287496775f, 0.317372024f},
-std::array<float,2>{0.0887460411f, 0.529038668f},
-std::array<float,2>{0.96165812f, 0.245576501f},
-std::array<float,2>{0.89242667f, 0.800477743f},
-std::array<float,2>{0.0200916212f, 0.411854923f},
-std::array<float,2>{0.332543582f, 0.729721665f},
-std::array<float,2>{0.514797509f, 0.0661428347f},
-std::array<float,2>{0.67419219f, 0.589908421f},
-std::array<float,2>{0.421690464f, 0.16720809f},
-std::array<float,2>{0.141309544f, 0.961308956f},
-std::array<float,2>{0.812014461f, 0.261562943f},
-std::array<float,2>{0.996506512f, 0.551406264f},
-std::array<float,2>{0.104647517f, 0.196238205f},
-std::array<float,2>{0.263041735f, 0.91906935f},
-std::array<float,2>{0.575386047f, 0.350575626f},
-std::array<float,2>{0.718012393f, 0.813266873f},
-std::array<float,2>{0.494105965f, 0.490872055f},
-std::array<float,2>{0.248774856f, 0.661879063f},
-std::array<float,2>{0.848434329f, 0.011046527f},
-std::array<float,2>{0.758553803f, 0.988810301f},
-std::array<float,2>{0.176385999f, 0.31134212f},
-std::array<float,2>{0.385190994f, 0.613935649f},
-std::array<float,2>{0.652479649f, 0.147519782f},
-std::array<float,2>{0.558318436f, 0.707241058f},
-std::array<float,2>{0.364797056f, 0.104639336f},
-std::array<float,2>{0.0595055968f, 0.781206846f},
-std::array<float,2>{0.920248747f, 0.401015759f},
-std::array<float,2>{0.93128407f, 0.742237985f},
-std::array<float,2>{0.0449940115f, 0.0785901919f},
-std::array<float,2>{0.354337156f, 0.795639932f},
-std::array<float,2>{0.538470387f, 0.424266785f},
-std::array<float,2>{0.625170529f, 0.95244664f},
-std::array<float,2>{0.405459285f, 0.278150558f},
-std::array<float,2>{0.168844849f, 0.576400161f},
-std::array<float,2>{0.766406715f, 0.181999981f},
-std::array<float,2>{0.869843543f, 0.873004198f},
-std::array<float,2>{0.227244899f, 0.458381742f},
-std::array<float,2>{0.473267615f, 0.641295135f},
-std::array<float,2>{0.691058517f, 0.0450881794f},
-std::array<float,2>{0.585263133f, 0.508100629f},
-std::array<float,2>{0.280035526f, 0.221784413f},
-std::array<float,2>{0.124568336f, 0.900481582f},
-std::array<float,2>{0.978166521f, 0.338450819f},
-std::array<float,2>{0.789203525f, 0.598839581f},
-std::array<float,2>{0.131625623f, 0.132501662f},
-std::array<float,2>{0.425204933f, 0.974986792f},
-std::array<float,2>{0.667678654f, 0.283807158f},
-std::array<float,2>{0.516419768f, 0.751112521f},
-std::array<float,2>{0.325295925f, 0.389794052f},
-std::array<float,2>{0.00422158372f, 0.702229977f},
-std::array<float,2>{0.888537943f, 0.115832791f},
-std::array<float,2>{0.944274127f, 0.925734818f},
-std::array<float,2>{0.0773207098f, 0.367003292f},
-std::array<float,2>{0.303775102f, 0.536973596f},
-std::array<float,2>{0.623868465f, 0.218676507f},
-std::array<float,2>{0.722364426f, 0.674222529f},
-std::array<float,2>{0.44591859f, 0.0259102099f},
-std::array<float,2>{0.203471512f, 0.838035166f},
-std::array<float,2>{0.821721792f, 0.469078988f},
-std::array<float,2>{0.771279871f, 0.664416432f},
-std::array<float,2>{0.16673556f, 0.00344759645f},
-std::array<float,2>{0.398928195f, 0.826951683f},
-std::array<float,2>{0.630217791f, 0.496775985f},
-std::array<float,2>{0.531497419f, 0.909485459f},
-std::array<float,2>{0.357129335f, 0.357878596f},
-std::array<float,2>{0.0399702489f, 0.556786835f},
-std::array<float,2>{0.934672236f, 0.190182254f},
-std::array<float,2>{0.981289923f, 0.772139907f},
-std::array<float,2>{0.120283201f, 0.391678393f},
-std::array<float,2>{0.274669141f, 0.718361676f},
-std::array<float,2>{0.579690814f, 0.100020774f},
-std::array<float,2>{0.692313552f, 0.62258029f},
-std::array<float,2>{0.470071465f, 0.150315151f},
-std::array<float,2>{0.233090922f, 0.992688715f},
-std::array<float,2>{0.873026192f, 0.300396353f},
-std::array<float,2>{0.883939505f, 0.517964303f},
-std::array<float,2>{0.00220437208f, 0.239891499f},
-std::array<float,2>{0.323060513f, 0.882035375f},
-std::array<float,2>{0.519708395f, 0.321501315f},
-std::array<float,2>{0.66861558f, 0.846271396f},
-std::array<float,2>{0.429310709f, 0.440310717f},
-std::array<float,2>{0.128834799f, 0.625791669f},
-std::array<float,2>{0.793474436f, 0.0552388951f},
-std::array<float,2>{0.828009188f, 0.954291165f},
-std::array<float,2>{0.209689364f, 0.251549691f},
-std::array<float,2>{0.449977338f, 0.581342578f},
-std::array<float,2>{0.722885132f, 0.156644866f},
-std::array<float,2>{0.620469868f, 0.723429978f},
-std::array<float,2>{0.29988569f, 0.0757598132f},
-std::array<float,2>{0.0739602745f, 0.812390029f},
-std::array<float,2>{0.938312888f, 0.414334089f},
-std::array<float,2>{0.967125416f, 0.693196177f},
-std::array<float,2>{0.0919973552f, 0.124151148f},
-std::array<float,2>{0.283714205f, 0.763054967f},
-std::array<float,2>{0.602731347f, 0.376246303f},
-std::array<float,2>{0.746792793f, 0.979933262f},
-std::array<float,2>{0.453936875f, 0.289583176f},
-std::array<float,2>{0.195307761f, 0.602135122f},
-std::array<float,2>{0.84118861f, 0.137531474f},
-std::array<float,2>{0.806792736f, 0.829737067f},
-std::array<float,2>{0.145696893f, 0.481783777f},
-std::array<float,2>{0.414267153f, 0.680846214f},
-std::array<float,2>{0.678822041f, 0.0194540918f},
-std::array<float,2>{0.509071887f, 0.542081892f},
-std::array<float,2>{0.328826874f, 0.207230374f},
-std::array<float,2>{0.0171550661f, 0.936667323f},
-std::array<float,2>{0.896076024f, 0.368714124f},
-std::array<float,2>{0.845405698f, 0.5670591f},
-std::array<float,2>{0.242674455f, 0.176999405f},
-std::array<float,2>{0.497857958f, 0.941710949f},
-std::array<float,2>{0.713977695f, 0.272941887f},
-std::array<float,2>{0.572917163f, 0.781502187f},
-std::array<float,2>{0.260869652f, 0.434529632f},
-std::array<float,2>{0.105799995f, 0.739165127f},
-std::array<float,2>{0.992647946f, 0.0877553001f},
-std::array<float,2>{0.917953253f, 0.890721619f},
-std::array<float,2>{0.055273436f, 0.330114543f},
-std::array<float,2>{0.360379338f, 0.502725482f},
-std::array<float,2>{0.559062362f, 0.232231796f},
-std::array<float,2>{0.651692867f, 0.653334081f},
-std::array<float,2>{0.390594542f, 0.0345461406f},
-std::array<float,2>{0.173579603f, 0.86166507f},
-std::array<float,2>{0.764278471f, 0.464575946f},
-std::array<float,2>{0.835385859f, 0.748484135f},
-std::array<float,2>{0.198729038f, 0.0853981748f},
-std::array<float,2>{0.463813752f, 0.792101443f},
-std::array<float,2>{0.735138595f, 0.428562462f},
-std::array<float,2>{0.600516021f, 0.945946991f},
-std::array<float,2>{0.291968822f, 0.274084389f},
-std::array<float,2>{0.0781897604f, 0.573383808f},
-std::array<float,2>{0.956376016f, 0.187337622f},
-std::array<float,2>{0.899784982f, 0.868115067f},
-std::array<float,2>{0.0298839658f, 0.455432594f},
-std::array<float,2>{0.338477135f, 0.644976974f},
-std::array<float,2>{0.50431788f, 0.0422797836f},
-std::array<float,2>{0.679960489f, 0.51224637f},
-std::array<float,2>{0.410448521f, 0.225050598f},
-std::array<float,2>{0.150552198f, 0.903202891f},
-std::array<float,2>{0.79752785f, 0.343446791f},
-std::array<float,2>{0.985231161f, 0.595215857f},
-std::array<float,2>{0.0944876894f, 0.12503387f},
-std::array<float,2>{0.253503591f, 0.971045017f},
-std::array<float,2>{0.56493336f, 0.285842776f},
-std::array<float,2>{0.704955578f, 0.757718921f},
-std::array<float,2>{0.491012186f, 0.385748565f},
-std::array<float,2>{0.235560462f, 0.698546529f},
-std::array<float,2>{0.853082538f, 0.112522595f},
-std::array<float,2>{0.751274526f, 0.929165661f},
-std::array<float,2>{0.186641723f, 0.362555742f},
-std::array<float,2>{0.377294868f, 0.531383932f},
-std::array<float,2>{0.64082998f, 0.21323286f},
-std::array<float,2>{0.553778887f, 0.678610981f},
-std::array<float,2>{0.373834699f, 0.0289025195f},
-std::array<float,2>{0.047782395f, 0.841619551f},
-std::array<float,2>{0.90725702f, 0.476287574f},
-std::array<float,2>{0.922911763f, 0.634065211f},
-std::array<float,2>{0.0321540199f, 0.0487308726f},
-std::array<float,2>{0.348899454f, 0.856705606f},
-std::array<float,2>{0.543311834f, 0.447738945f},
-std::array<float,2>{0.638259888f, 0.883885682f},
-std::array<float,2>{0.393595517f, 0.315498739f},
-std::array<float,2>{0.158933908f, 0.526943326f},
-std::array<float,2>{0.775154829f, 0.246201217f},
-std::array<float,2>{0.865344226f, 0.802895904f},
-std::array<float,2>{0.22566928f, 0.406997144f},
-std::array<float,2>{0.476728469f, 0.730834961f},
-std::array<float,2>{0.697153389f, 0.06681519f},
-std::array<float,2>{0.591976225f, 0.588657618f},
-std::array<float,2>{0.273350596f, 0.171443343f},
-std::array<float,2>{0.115377374f, 0.96515882f},
-std::array<float,2>{0.972438991f, 0.263608307f},
-std::array<float,2>{0.783820271f, 0.550075054f},
-std::array<float,2>{0.133005455f, 0.201410532f},
-std::array<float,2>{0.434879452f, 0.91412276f},
-std::array<float,2>{0.660698593f, 0.347109824f},
-std::array<float,2>{0.527663171f, 0.819467068f},
-std::array<float,2>{0.313194752f, 0.485161453f},
-std::array<float,2>{0.0101342769f, 0.657974958f},
-std::array<float,2>{0.880782723f, 0.0120034581f},
-std::array<float,2>{0.951166391f, 0.987496376f},
-std::array<float,2>{0.0702870935f, 0.305096924f},
-std::array<float,2>{0.308521926f, 0.610546529f},
-std::array<float,2>{0.616659462f, 0.141190276f},
-std::array<float,2>{0.730693042f, 0.70539391f},
-std::array<float,2>{0.439203918f, 0.109297827f},
-std::array<float,2>{0.212609485f, 0.776464522f},
-std::array<float,2>{0.813883603f, 0.40457198f},
-std::array<float,2>{0.800797701f, 0.711541414f},
-std::array<float,2>{0.152736023f, 0.0955857038f},
-std::array<float,2>{0.410127312f, 0.767545581f},
-std::array<float,2>{0.68561852f, 0.397371441f},
-std::array<float,2>{0.502797306f, 0.99918288f},
-std::array<float,2>{0.342256427f, 0.303934067f},
-std::array<float,2>{0.0251162425f, 0.619140148f},
-std::array<float,2>{0.905578256f, 0.15518637f},
-std::array<float,2>{0.958568215f, 0.821661055f},
-std::array<float,2>{0.0852264315f, 0.492959112f},
-std::array<float,2>{0.293794721f, 0.669207275f},
-std::array<float,2>{0.594625592f, 0.00574321114f},
-std::array<float,2>{0.741186202f, 0.561298668f},
-std::array<float,2>{0.465593398f, 0.193600535f},
-std::array<float,2>{0.201800272f, 0.910464883f},
-std::array<float,2>{0.828630745f, 0.353951842f},
-std::array<float,2>{0.913686812f, 0.584187925f},
-std::array<float,2>{0.0513662808f, 0.161180481f},
-std::array<float,2>{0.368921638f, 0.960226595f},
-std::array<float,2>{0.550442994f, 0.253965318f},
-std::array<float,2>{0.644778192f, 0.808219492f},
-std::array<float,2>{0.380613387f, 0.418423951f},
-std::array<float,2>{0.180300057f, 0.721245587f},
-std::array<float,2>{0.756105721f, 0.0716139898f},
-std::array<float,2>{0.857419133f, 0.878317595f},
-std::array<float,2>{0.239871994f, 0.328069359f},
-std::array<float,2>{0.486834079f, 0.522577047f},
-std::array<float,2>{0.708609819f, 0.237915456f},
-std::array<float,2>{0.569934785f, 0.629651725f},
-std::array<float,2>{0.255432039f, 0.0594950765f},
-std::array<float,2>{0.101201892f, 0.848367274f},
-std::array<float,2>{0.991807282f, 0.444873154f},
-std::array<float,2>{0.975215375f, 0.685493469f},
-std::array<float,2>{0.109799571f, 0.0209066216f},
-std::array<float,2>{0.26717785f, 0.835638344f},
-std::array<float,2>{0.589218378f, 0.478773773f},
-std::array<float,2>{0.702108204f, 0.933439136f},
-std::array<float,2>{0.484147042f, 0.37253654f},
-std::array<float,2>{0.21965462f, 0.546854973f},
-std::array<float,2>{0.859959483f, 0.203185931f},
-std::array<float,2>{0.777911723f, 0.75900358f},
-std::array<float,2>{0.160936236f, 0.381379217f},
-std::array<float,2>{0.396798551f, 0.68957603f},
-std::array<float,2>{0.633713603f, 0.120358452f},
-std::array<float,2>{0.542877614f, 0.608536363f},
-std::array<float,2>{0.345021725f, 0.136313543f},
-std::array<float,2>{0.0373574421f, 0.983281195f},
-std::array<float,2>{0.927326202f, 0.296795905f},
-std::array<float,2>{0.819994926f, 0.507701337f},
-std::array<float,2>{0.218016043f, 0.228561953f},
-std::array<float,2>{0.44203639f, 0.897635698f},
-std::array<float,2>{0.728015125f, 0.334447294f},
-std::array<float,2>{0.611595631f, 0.864086986f},
-std::array<float,2>{0.308926672f, 0.466751456f},
-std::array<float,2>{0.0660887212f, 0.64992851f},
-std::array<float,2>{0.947761953f, 0.0373794399f},
-std::array<float,2>{0.87826997f, 0.939944267f},
-std::array<float,2>{0.0130779417f, 0.267309844f},
-std::array<float,2>{0.317487895f, 0.565546393f},
-std::array<float,2>{0.526366711f, 0.175165579f},
-std::array<float,2>{0.657529712f, 0.737614453f},
-std::array<float,2>{0.42994839f, 0.0900288448f},
-std::array<float,2>{0.138235614f, 0.786845088f},
-std::array<float,2>{0.785171449f, 0.432232767f},
-std::array<float,2>{0.868556559f, 0.642308414f},
-std::array<float,2>{0.229912356f, 0.0466225892f},
-std::array<float,2>{0.476384968f, 0.871142745f},
-std::array<float,2>{0.687685251f, 0.457974434f},
-std::array<float,2>{0.583546102f, 0.902117968f},
-std::array<float,2>{0.278050959f, 0.339150399f},
-std::array<float,2>{0.121165074f, 0.509053767f},
-std::array<float,2>{0.979030252f, 0.220874593f},
-std::array<float,2>{0.932888806f, 0.796127617f},
-std::array<float,2>{0.043155849f, 0.425566465f},
-std::array<float,2>{0.352804691f, 0.743326843f},
-std::array<float,2>{0.535593748f, 0.0791881979f},
-std::array<float,2>{0.627964735f, 0.578023195f},
-std::array<float,2>{0.403072089f, 0.182860553f},
-std::array<float,2>{0.171391428f, 0.951564908f},
-std::array<float,2>{0.768612862f, 0.279061168f},
-std::array<float,2>{0.941955924f, 0.535916328f},
-std::array<float,2>{0.0753095374f, 0.217163622f},
-std::array<float,2>{0.301702887f, 0.924639106f},
-std::array<float,2>{0.621472239f, 0.36564523f},
-std::array<float,2>{0.720427215f, 0.839717507f},
-std::array<float,2>{0.448778927f, 0.470049858f},
-std::array<float,2>{0.205323637f, 0.674826443f},
-std::array<float,2>{0.823323667f, 0.0269404612f},
-std::array<float,2>{0.792038083f, 0.975619853f},
-std::array<float,2>{0.130200103f, 0.28442654f},
-std::array<float,2>{0.422442377f, 0.597865343f},
-std::array<float,2>{0.665063024f, 0.131788105f},
-std::array<float,2>{0.519396722f, 0.702091813f},
-std::array<float,2>{0.326976895f, 0.116540156f},
-std::array<float,2>{0.00589806587f, 0.750143945f},
-std::array<float,2>{0.888780892f, 0.389238417f},
-std::array<float,2>{0.892719328f, 0.72922039f},
-std::array<float,2>{0.023033537f, 0.0652365983f},
-std::array<float,2>{0.334772766f, 0.799224555f},
-std::array<float,2>{0.512198865f, 0.41070351f},
-std::array<float,2>{0.672854483f, 0.962375104f},
-std::array<float,2>{0.419810116f, 0.260208279f},
-std::array<float,2>{0.143348843f, 0.591163993f},
-std::array<float,2>{0.80982244f, 0.166072071f},
-std::array<float,2>{0.836203098f, 0.854730606f},
-std::array<float,2>{0.190813437f, 0.452789515f},
-std::array<float,2>{0.460125268f, 0.640298188f},
-std::array<float,2>{0.744305789f, 0.0529025532f},
-std::array<float,2>{0.609130919f, 0.528154433f},
-std::array<float,2>{0.285727412f, 0.245091155f},
-std::array<float,2>{0.0873633474f, 0.888935626f},
-std::array<float,2>{0.963518202f, 0.317624301f},
-std::array<float,2>{0.761562824f, 0.614633918f},
-std::array<float,2>{0.179622337f, 0.147026464f},
-std::array<float,2>{0.384236962f, 0.990030229f},
-std::array<float,2>{0.654885411f, 0.311953872f},
-std::array<float,2>{0.555855334f, 0.779599071f},
-std::array<float,2>{0.365967423f, 0.401523888f},
-std::array<float,2>{0.0614398755f, 0.708868265f},
-std::array<float,2>{0.919427872f, 0.103780009f},
-std::array<float,2>{0.99916321f, 0.918692887f},
-std::array<float,2>{0.10175097f, 0.350695968f},
-std::array<float,2>{0.265136242f, 0.552095413f},
-std::array<float,2>{0.576464474f, 0.196528107f},
-std::array<float,2>{0.716220737f, 0.660256982f},
-std::array<float,2>{0.494627506f, 0.0106258569f},
-std::array<float,2>{0.247505113f, 0.814155877f},
-std::array<float,2>{0.850840986f, 0.491929024f},
-std::array<float,2>{0.796045363f, 0.62819761f},
-std::array<float,2>{0.125929028f, 0.0582641214f},
-std::array<float,2>{0.426822901f, 0.843789399f},
-std::array<float,2>{0.669937372f, 0.438286483f},
-std::array<float,2>{0.521859705f, 0.879049659f},
-std::array<float,2>{0.321014434f, 0.323460519f},
-std::array<float,2>{0.000300857908f, 0.516493678f},
-std::array<float,2>{0.886494219f, 0.240975231f},
-std::array<float,2>{0.940906465f, 0.809750676f},
-std::array<float,2>{0.0715646669f, 0.416506588f},
-std::array<float,2>{0.298499852f, 0.726532996f},
-std::array<float,2>{0.617877901f, 0.0771577433f},
-std::array<float,2>{0.724710345f, 0.579124212f},
-std::array<float,2>{0.452262342f, 0.15846613f},
-std::array<float,2>{0.208079949f, 0.955518126f},
-std::array<float,2>{0.825206935f, 0.252275288f},
-std::array<float,2>{0.937268257f, 0.555719554f},
-std::array<float,2>{0.0416298807f, 0.188086748f},
-std::array<float,2>{0.357525915f, 0.90672195f},
-std::array<float,2>{0.534721017f, 0.356074274f},
-std::array<float,2>{0.631933033f, 0.824927688f},
-std::array<float,2>{0.402124375f, 0.499777317f},
-std::array<float,2>{0.164868683f, 0.666735113f},
-std::array<float,2>{0.771954715f, 0.000962043239f},
-std::array<float,2>{0.873644054f, 0.994505644f},
-std::array<float,2>{0.232020572f, 0.298467904f},
-std::array<float,2>{0.472088367f, 0.62387836f},
-std::array<float,2>{0.695123136f, 0.151660398f},
-std::array<float,2>{0.581981778f, 0.71655035f},
-std::array<float,2>{0.276539683f, 0.0982348695f},
-std::array<float,2>{0.118351936f, 0.770412803f},
-std::array<float,2>{0.982793629f, 0.393203974f},
-std::array<float,2>{0.995238483f, 0.741395533f},
-std::array<float,2>{0.109013088f, 0.0886098072f},
-std::array<float,2>{0.25909248f, 0.784848452f},
-std::array<float,2>{0.571784675f, 0.437484175f},
-std::array<float,2>{0.711669445f, 0.943917632f},
-std::array<float,2>{0.498664439f, 0.270196944f},
-std::array<float,2>{0.24569948f, 0.570284009f},
-std::array<float,2>{0.847272098f, 0.178170413f},
-std::array<float,2>{0.761958957f, 0.860765219f},
-std::array<float,2>{0.175013155f, 0.461492211f},
-std::array<float,2>{0.387257099f, 0.654787421f},
-std::array<float,2>{0.649647295f, 0.0314346775f},
-std::array<float,2>{0.561280966f, 0.501845598f},
-std::array<float,2>{0.361683071f, 0.233716294f},
-std::array<float,2>{0.0578713156f, 0.893528521f},
-std::array<float,2>{0.914880455f, 0.328827173f},
-std::array<float,2>{0.842681766f, 0.605363429f},
-std::array<float,2>{0.192920476f, 0.138891041f},
-std::array<float,2>{0.455571741f, 0.978407919f},
-std::array<float,2>{0.749070883f, 0.291838109f},
-std::array<float,2>{0.605135679f, 0.764503956f},
-std::array<float,2>{0.281692684f, 0.377106458f},
-std::array<float,2>{0.0904645324f, 0.694394767f},
-std::array<float,2>{0.965644419f, 0.122853771f},
-std::array<float,2>{0.896883667f, 0.935308099f},
-std::array<float,2>{0.0191964805f, 0.370447278f},
-std::array<float,2>{0.330132455f, 0.540253043f},
-std::array<float,2>{0.509854317f, 0.209867954f},
-std::array<float,2>{0.676388264f, 0.681651115f},
-std::array<float,2>{0.417600095f, 0.0172117315f},
-std::array<float,2>{0.14730221f, 0.830711186f},
-std::array<float,2>{0.805927336f, 0.482769996f},
-std::array<float,2>{0.855372906f, 0.69692117f},
-std::array<float,2>{0.237466007f, 0.109683752f},
-std::array<float,2>{0.488902301f, 0.754665911f},
-std::array<float,2>{0.70664382f, 0.384079963f},
-std::array<float,2>{0.564389527f, 0.9701702f},
-std::array<float,2>{0.250197202f, 0.287405968f},
-std::array<float,2>{0.0965130106f, 0.597295642f},
-std::array<float,2>{0.987220347f, 0.127846465f},
-std::array<float,2>{0.908693731f, 0.843218744f},
-std::array<float,2>{0.0498564094f, 0.474023193f},
-std::array<float,2>{0.371321619f, 0.677722037f},
-std::array<float,2>{0.551898122f, 0.0294174179f},
-std::array<float,2>{0.643210053f, 0.533864737f},
-std::array<float,2>{0.375899792f, 0.211702943f},
-std::array<float,2>{0.183834195f, 0.927042305f},
-std::array<float,2>{0.752157509f, 0.359761357f},
-std::array<float,2>{0.954614222f, 0.57175225f},
-std::array<float,2>{0.0804935768f, 0.183719575f},
-std::array<float,2>{0.289440066f, 0.947900414f},
-std::array<float,2>{0.598127127f, 0.275656998f},
-std::array<float,2>{0.737051189f, 0.78948766f},
-std::array<float,2>{0.462287843f, 0.42724821f},
-std::array<float,2>{0.196822271f, 0.746298015f},
-std::array<float,2>{0.832496941f, 0.0836176947f},
-std::array<float,2>{0.799918592f, 0.90617317f},
-std::array<float,2>{0.149805978f, 0.340301096f},
-std::array<float,2>{0.413562119f, 0.515261471f},
-std::array<float,2>{0.682301402f, 0.224245325f},
-std::array<float,2>{0.507700264f, 0.64736563f},
-std::array<float,2>{0.337413073f, 0.0392872319f},
-std::array<float,2>{0.0285856575f, 0.870221019f},
-std::array<float,2>{0.900592089f, 0.454092026f},
-std::array<float,2>{0.881197751f, 0.658464193f},
-std::array<float,2>{0.00921394676f, 0.0145188961f},
-std::array<float,2>{0.315126866f, 0.817244649f},
-std::array<float,2>{0.530413389f, 0.488098025f},
-std::array<float,2>{0.663032651f, 0.917199671f},
-std::array<float,2>{0.435729414f, 0.344299495f},
-std::array<float,2>{0.135459706f, 0.548188925f},
-std::array<float,2>{0.781748712f, 0.199383974f},
-std::array<float,2>{0.815289736f, 0.774451554f},
-std::array<float,2>{0.214501798f, 0.403791428f},
-std::array<float,2>{0.440826416f, 0.70359236f},
-std::array<float,2>{0.733259916f, 0.105828531f},
-std::array<float,2>{0.615033329f, 0.612981379f},
-std::array<float,2>{0.305994421f, 0.143605784f},
-std::array<float,2>{0.0674444363f, 0.985891521f},
-std::array<float,2>{0.953031421f, 0.30784747f},
-std::array<float,2>{0.776520371f, 0.52457732f},
-std::array<float,2>{0.156823337f, 0.249566287f},
-std::array<float,2>{0.392517954f, 0.885291219f},
-std::array<float,2>{0.639592886f, 0.313800365f},
-std::array<float,2>{0.546468794f, 0.85752207f},
-std::array<float,2>{0.351126164f, 0.445386052f},
-std::array<float,2>{0.034604758f, 0.635628819f},
-std::array<float,2>{0.924429119f, 0.0495954975f},
-std::array<float,2>{0.969398856f, 0.966869533f},
-std::array<float,2>{0.114178456f, 0.264719695f},
-std::array<float,2>{0.270830095f, 0.586807847f},
-std::array<float,2>{0.590039492f, 0.169838116f},
-std::array<float,2>{0.698912978f, 0.733896255f},
-std::array<float,2>{0.479345322f, 0.0692398623f},
-std::array<float,2>{0.223947302f, 0.80155158f},
-std::array<float,2>{0.86334908f, 0.410016835f},
-std::array<float,2>{0.754018843f, 0.7199139f},
-std::array<float,2>{0.183204457f, 0.0732759237f},
-std::array<float,2>{0.382584453f, 0.806272268f},
-std::array<float,2>{0.647186518f, 0.42146942f},
-std::array<float,2>{0.548192084f, 0.958656609f},
-std::array<float,2>{0.369605035f, 0.256585002f},
-std::array<float,2>{0.0539672524f, 0.582540154f},
-std::array<float,2>{0.911700726f, 0.163232356f},
-std::array<float,2>{0.98950845f, 0.850717723f},
-std::array<float,2>{0.0990721211f, 0.441868216f},
-std::array<float,2>{0.256614685f, 0.631358087f},
-std::array<float,2>{0.56641376f, 0.0620663203f},
-std::array<float,2>{0.709958375f, 0.521466255f},
-std::array<float,2>{0.486165762f, 0.235972553f},
-std::array<float,2>{0.24155356f, 0.875119448f},
-std::array<float,2>{0.858774602f, 0.324590325f},
-std::array<float,2>{0.903131902f, 0.619258165f},
-std::array<float,2>{0.0269515254f, 0.152392313f},
-std::array<float,2>{0.341457516f, 0.996909559f},
-std::array<float,2>{0.500293136f, 0.300942898f},
-std::array<float,2>{0.684406042f, 0.768620074f},
-std::array<float,2>{0.406923056f, 0.396027744f},
-std::array<float,2>{0.155259818f, 0.713490248f},
-std::array<float,2>{0.803113997f, 0.0961027667f},
-std::array<float,2>{0.831006765f, 0.912960052f},
-std::array<float,2>{0.199250296f, 0.352048934f},
-std::array<float,2>{0.46719256f, 0.558662415f},
-std::array<float,2>{0.738803387f, 0.191950694f},
-std::array<float,2>{0.597174704f, 0.671008587f},
-std::array<float,2>{0.29565689f, 0.00592244696f},
-std::array<float,2>{0.0836373791f, 0.822313726f},
-std::array<float,2>{0.95936048f, 0.494558573f},
-std::array<float,2>{0.94672358f, 0.652320027f},
-std::array<float,2>{0.0644353405f, 0.0368170999f},
-std::array<float,2>{0.312174022f, 0.866872191f},
-std::array<float,2>{0.611202121f, 0.467157334f},
-std::array<float,2>{0.729120493f, 0.89559567f},
-std::array<float,2>{0.445045501f, 0.33348152f},
-std::array<float,2>{0.215577587f, 0.504867435f},
-std::array<float,2>{0.816826522f, 0.227387682f},
-std::array<float,2>{0.78831017f, 0.788597763f},
-std::array<float,2>{0.139543727f, 0.430009782f},
-std::array<float,2>{0.432728976f, 0.73507911f},
-std::array<float,2>{0.66012454f, 0.0934037343f},
-std::array<float,2>{0.523457348f, 0.563245058f},
-std::array<float,2>{0.318640828f, 0.172443405f},
-std::array<float,2>{0.0155585064f, 0.937822163f},
-std::array<float,2>{0.875030994f, 0.268633813f},
-std::array<float,2>{0.861851275f, 0.543290436f},
-std::array<float,2>{0.221551701f, 0.205645487f},
-std::array<float,2>{0.481038541f, 0.930265307f},
-std::array<float,2>{0.699818671f, 0.374770075f},
-std::array<float,2>{0.587849677f, 0.833524466f},
-std::array<float,2>{0.267606169f, 0.477135271f},
-std::array<float,2>{0.111801863f, 0.686512589f},
-std::array<float,2>{0.973105073f, 0.0229332764f},
-std::array<float,2>{0.928336143f, 0.981027544f},
-std::array<float,2>{0.0357209258f, 0.294873238f},
-std::array<float,2>{0.347004533f, 0.605821431f},
-std::array<float,2>{0.540369093f, 0.13418287f},
-std::array<float,2>{0.635346651f, 0.687606812f},
-std::array<float,2>{0.395551324f, 0.117445074f},
-std::array<float,2>{0.162592143f, 0.760305464f},
-std::array<float,2>{0.779732049f, 0.380325526f},
-std::array<float,2>{0.821138501f, 0.672950804f},
-std::array<float,2>{0.204547092f, 0.0238383505f},
-std::array<float,2>{0.446511507f, 0.837406874f},
-std::array<float,2>{0.721384823f, 0.471392304f},
-std::array<float,2>{0.624143839f, 0.922258615f},
-std::array<float,2>{0.302934438f, 0.364030033f},
-std::array<float,2>{0.0770688653f, 0.53783524f},
-std::array<float,2>{0.945191622f, 0.215066671f},
-std::array<float,2>{0.887317598f, 0.752485633f},
-std::array<float,2>{0.00489439117f, 0.388248354f},
-std::array<float,2>{0.324994743f, 0.699312568f},
-std::array<float,2>{0.516652465f, 0.114487454f},
-std::array<float,2>{0.666172028f, 0.600247502f},
-std::array<float,2>{0.424511284f, 0.130095944f},
-std::array<float,2>{0.131933212f, 0.972936213f},
-std::array<float,2>{0.790740907f, 0.282306284f},
-std::array<float,2>{0.976709664f, 0.510759532f},
-std::array<float,2>{0.123451315f, 0.219520032f},
-std::array<float,2>{0.280915469f, 0.89909786f},
-std::array<float,2>{0.584738553f, 0.337563872f},
-std::array<float,2>{0.690403402f, 0.873490632f},
-std::array<float,2>{0.473823637f, 0.459645391f},
-std::array<float,2>{0.228389949f, 0.644033194f},
-std::array<float,2>{0.870545149f, 0.0439715125f},
-std::array<float,2>{0.766648352f, 0.949781597f},
-std::array<float,2>{0.169586763f, 0.280592322f},
-std::array<float,2>{0.404772431f, 0.575901508f},
-std::array<float,2>{0.626416445f, 0.181290478f},
-std::array<float,2>{0.537239134f, 0.746086597f},
-std::array<float,2>{0.354949027f, 0.0801137686f},
-std::array<float,2>{0.0462202094f, 0.793145657f},
-std::array<float,2>{0.930356741f, 0.422442973f},
-std::array<float,2>{0.921665549f, 0.710538745f},
-std::array<float,2>{0.0599948503f, 0.102390759f},
-std::array<float,2>{0.364141673f, 0.777823627f},
-std::array<float,2>{0.557309568f, 0.399795473f},
-std::array<float,2>{0.653570414f, 0.99077481f},
-std::array<float,2>{0.385799795f, 0.309024513f},
-std::array<float,2>{0.177032307f, 0.615424395f},
-std::array<float,2>{0.759349346f, 0.14535889f},
-std::array<float,2>{0.849292696f, 0.814942122f},
-std::array<float,2>{0.249668851f, 0.489797473f},
-std::array<float,2>{0.492686749f, 0.662300766f},
-std::array<float,2>{0.716804087f, 0.0088293748f},
-std::array<float,2>{0.574550331f, 0.554587662f},
-std::array<float,2>{0.261939257f, 0.198915064f},
-std::array<float,2>{0.104087994f, 0.921061099f},
-std::array<float,2>{0.997147679f, 0.349015683f},
-std::array<float,2>{0.811458766f, 0.591961265f},
-std::array<float,2>{0.14175567f, 0.164795145f},
-std::array<float,2>{0.420261621f, 0.96344465f},
-std::array<float,2>{0.67539525f, 0.257883251f},
-std::array<float,2>{0.513874352f, 0.797122836f},
-std::array<float,2>{0.333529204f, 0.412939101f},
-std::array<float,2>{0.0209836289f, 0.72799021f},
-std::array<float,2>{0.89081341f, 0.0629546866f},
-std::array<float,2>{0.962827504f, 0.887953222f},
-std::array<float,2>{0.0892499834f, 0.319072455f},
-std::array<float,2>{0.288749874f, 0.530810952f},
-std::array<float,2>{0.607225001f, 0.243188143f},
-std::array<float,2>{0.742962301f, 0.637726903f},
-std::array<float,2>{0.458012819f, 0.0510073118f},
-std::array<float,2>{0.187970996f, 0.8531394f},
-std::array<float,2>{0.838904083f, 0.44973138f},
-std::array<float,2>{0.774828613f, 0.635051906f},
-std::array<float,2>{0.158446789f, 0.0490933955f},
-std::array<float,2>{0.3941755f, 0.858153105f},
-std::array<float,2>{0.638030827f, 0.44584918f},
-std::array<float,2>{0.543734491f, 0.885073602f},
-std::array<float,2>{0.349596739f, 0.313982248f},
-std::array<float,2>{0.0313335098f, 0.525033951f},
-std::array<float,2>{0.923765421f, 0.249334112f},
-std::array<float,2>{0.97182864f, 0.801080227f},
-std::array<float,2>{0.115930572f, 0.40944168f},
-std::array<float,2>{0.272791654f, 0.733815491f},
-std::array<float,2>{0.592538357f, 0.068777971f},
-std::array<float,2>{0.696519256f, 0.586248934f},
-std::array<float,2>{0.47715345f, 0.169159934f},
-std::array<float,2>{0.226147816f, 0.967421532f},
-std::array<float,2>{0.865996778f, 0.265329242f},
-std::array<float,2>{0.880043864f, 0.548650205f},
-std::array<float,2>{0.0106658209f, 0.199951544f},
-std::array<float,2>{0.312553138f, 0.917922497f},
-std::array<float,2>{0.528254628f, 0.343969256f},
-std::array<float,2>{0.660529494f, 0.816833377f},
-std::array<float,2>{0.435325116f, 0.487736613f},
-std::array<float,2>{0.133473635f, 0.659149051f},
-std::array<float,2>{0.783326507f, 0.0138509115f},
-std::array<float,2>{0.814069629f, 0.985634983f},
-std::array<float,2>{0.212205157f, 0.308286935f},
-std::array<float,2>{0.438765943f, 0.612378716f},
-std::array<float,2>{0.731377184f, 0.144489273f},
-std::array<float,2>{0.617148936f, 0.704039633f},
-std::array<float,2>{0.307791829f, 0.10629423f},
-std::array<float,2>{0.0694825202f, 0.77538079f},
-std::array<float,2>{0.950512946f, 0.404250205f},
-std::array<float,2>{0.956705332f, 0.747040987f},
-std::array<float,2>{0.0790018737f, 0.0833003521f},
-std::array<float,2>{0.291200608f, 0.789706886f},
-std::array<float,2>{0.600009382f, 0.427001923f},
-std::array<float,2>{0.734586477f, 0.947753072f},
-std::array<float,2>{0.462909669f, 0.276024431f},
-std::array<float,2>{0.19885923f, 0.571906149f},
-std::array<float,2>{0.835786343f, 0.18415682f},
-std::array<float,2>{0.796943128f, 0.870686054f},
-std::array<float,2>{0.151025131f, 0.453561187f},
-std::array<float,2>{0.410775751f, 0.646589935f},
-std::array<float,2>{0.680548131f, 0.0400136523f},
-std::array<float,2>{0.504780591f, 0.515111506f},
-std::array<float,2>{0.337893397f, 0.22391434f},
-std::array<float,2>{0.0294759143f, 0.905637205f},
-std::array<float,2>{0.900089562f, 0.340516984f},
-std::array<float,2>{0.852601826f, 0.597136676f},
-std::array<float,2>{0.235974699f, 0.127162978f},
-std::array<float,2>{0.490286827f, 0.970556378f},
-std::array<float,2>{0.704431176f, 0.287950724f},
-std::array<float,2>{0.565340161f, 0.753960788f},
-std::array<float,2>{0.253104717f, 0.384596288f},
-std::array<float,2>{0.0937906802f, 0.696311235f},
-std::array<float,2>{0.984407783f, 0.110191323f},
-std::array<float,2>{0.908189714f, 0.927648544f},
-std::array<float,2>{0.046879556f, 0.360169441f},
-std::array<float,2>{0.373290002f, 0.533463836f},
-std::array<float,2>{0.554237902f, 0.211079255f},
-std::array<float,2>{0.641426027f, 0.676847816f},
-std::array<float,2>{0.377898961f, 0.0298646502f},
-std::array<float,2>{0.187274545f, 0.843317807f},
-std::array<float,2>{0.751823485f, 0.474204361f},
-std::array<float,2>{0.84137094f, 0.694956601f},
-std::array<float,2>{0.194597438f, 0.122207701f},
-std::array<float,2>{0.453386843f, 0.764096439f},
-std::array<float,2>{0.746567309f, 0.377611279f},
-std::array<float,2>{0.603337169f, 0.978015125f},
-std::array<float,2>{0.283222347f, 0.291291386f},
-std::array<float,2>{0.0926337615f, 0.604504347f},
-std::array<float,2>{0.96750623f, 0.139438748f},
-std::array<float,2>{0.895549774f, 0.830540359f},
-std::array<float,2>{0.0166916195f, 0.482983679f},
-std::array<float,2>{0.328260481f, 0.682378232f},
-std::array<float,2>{0.509685874f, 0.0169624574f},
-std::array<float,2>{0.679535329f, 0.540920079f},
-std::array<float,2>{0.414604545f, 0.209188327f},
-std::array<float,2>{0.146345004f, 0.934942424f},
-std::array<float,2>{0.807359636f, 0.371039689f},
-std::array<float,2>{0.993044257f, 0.569780111f},
-std::array<float,2>{0.106305256f, 0.178709447f},
-std::array<float,2>{0.261518151f, 0.943676949f},
-std::array<float,2>{0.57243824f, 0.269938976f},
-std::array<float,2>{0.714397907f, 0.784235179f},
-std::array<float,2>{0.497315407f, 0.436663747f},
-std::array<float,2>{0.242813379f, 0.742107689f},
-std::array<float,2>{0.845159054f, 0.087945722f},
-std::array<float,2>{0.764055967f, 0.892723262f},
-std::array<float,2>{0.173274562f, 0.328385234f},
-std::array<float,2>{0.389758885f, 0.50122112f},
-std::array<float,2>{0.652224362f, 0.234170899f},
-std::array<float,2>{0.559127688f, 0.654624045f},
-std::array<float,2>{0.361001909f, 0.0321138613f},
-std::array<float,2>{0.0551470332f, 0.86101234f},
-std::array<float,2>{0.917074621f, 0.461168587f},
-std::array<float,2>{0.935360312f, 0.666170895f},
-std::array<float,2>{0.0394098945f, 9.69063403e-05f},
-std::array<float,2>{0.35661003f, 0.824474931f},
-std::array<float,2>{0.531843066f, 0.499211997f},
-std::array<float,2>{0.630796492f, 0.906984806f},
-std::array<float,2>{0.398626506f, 0.355506182f},
-std::array<float,2>{0.166444406f, 0.556253672f},
-std::array<float,2>{0.770838141f, 0.187956646f},
-std::array<float,2>{0.872511566f, 0.769933641f},
-std::array<float,2>{0.23259002f, 0.392977655f},
-std::array<float,2>{0.470309496f, 0.716068089f},
-std::array<float,2>{0.691657841f, 0.0979919285f},
-std::array<float,2>{0.579531193f, 0.623517513f},
-std::array<float,2>{0.275084823f, 0.152177975f},
-std::array<float,2>{0.121072046f, 0.99490422f},
-std::array<float,2>{0.980772913f, 0.298023373f},
-std::array<float,2>{0.793024242f, 0.515906572f},
-std::array<float,2>{0.128296122f, 0.240558684f},
-std::array<float,2>{0.428878903f, 0.87982136f},
-std::array<float,2>{0.668031156f, 0.324005932f},
-std::array<float,2>{0.520079732f, 0.844527662f},
-std::array<float,2>{0.322399586f, 0.437914073f},
-std::array<float,2>{0.00247665774f, 0.628443003f},
-std::array<float,2>{0.884744465f, 0.0577411652f},
-std::array<float,2>{0.937868655f, 0.955809236f},
-std::array<float,2>{0.0736368969f, 0.252634585f},
-std::array<float,2>{0.300331086f, 0.579844952f},
-std::array<float,2>{0.620612144f, 0.159036532f},
-std::array<float,2>{0.723471522f, 0.725716352f},
-std::array<float,2>{0.449577391f, 0.0779888034f},
-std::array<float,2>{0.209256038f, 0.810290694f},
-std::array<float,2>{0.827609897f, 0.416435778f},
-std::array<float,2>{0.810388088f, 0.728231251f},
-std::array<float,2>{0.142644361f, 0.0633608773f},
-std::array<float,2>{0.419277817f, 0.797715724f},
-std::array<float,2>{0.673635244f, 0.412559003f},
-std::array<float,2>{0.512653291f, 0.963211715f},
-std::array<float,2>{0.334019423f, 0.258475691f},
-std::array<float,2>{0.022623511f, 0.59270817f},
-std::array<float,2>{0.893066943f, 0.164266571f},
-std::array<float,2>{0.963286519f, 0.852983654f},
-std::array<float,2>{0.0876668915f, 0.449324876f},
-std::array<float,2>{0.285613447f, 0.638445973f},
-std::array<float,2>{0.608864367f, 0.0515252911f},
-std::array<float,2>{0.744684935f, 0.530380607f},
-std::array<float,2>{0.460676253f, 0.24407509f},
-std::array<float,2>{0.191163883f, 0.888432741f},
-std::array<float,2>{0.836580992f, 0.318564087f},
-std::array<float,2>{0.91955471f, 0.616090715f},
-std::array<float,2>{0.0606480613f, 0.144644439f},
-std::array<float,2>{0.365601718f, 0.990259707f},
-std::array<float,2>{0.5565117f, 0.309246719f},
-std::array<float,2>{0.654549062f, 0.778254807f},
-std::array<float,2>{0.384585679f, 0.399945915f},
-std::array<float,2>{0.179019809f, 0.710407078f},
-std::array<float,2>{0.761156797f, 0.101895154f},
-std::array<float,2>{0.851373136f, 0.921486735f},
-std::array<float,2>{0.247605324f, 0.349287719f},
-std::array<float,2>{0.49506402f, 0.55382663f},
-std::array<float,2>{0.716473043f, 0.198720142f},
-std::array<float,2>{0.576782525f, 0.662917197f},
-std::array<float,2>{0.265440166f, 0.00963085331f},
-std::array<float,2>{0.102501258f, 0.814835846f},
-std::array<float,2>{0.999897361f, 0.489573538f},
-std::array<float,2>{0.978646994f, 0.644107163f},
-std::array<float,2>{0.121770784f, 0.0446273051f},
-std::array<float,2>{0.277585447f, 0.873575151f},
-std::array<float,2>{0.583416045f, 0.459319681f},
-std::array<float,2>{0.687992156f, 0.898805261f},
-std::array<float,2>{0.475622624f, 0.337152749f},
-std::array<float,2>{0.230168566f, 0.511544764f},
-std::array<float,2>{0.869046807f, 0.219221964f},
-std::array<float,2>{0.769368112f, 0.793740273f},
-std::array<float,2>{0.171153963f, 0.422148675f},
-std::array<float,2>{0.402777463f, 0.745477974f},
-std::array<float,2>{0.628774464f, 0.0808595866f},
-std::array<float,2>{0.535954297f, 0.575603426f},
-std::array<float,2>{0.353393883f, 0.18098034f},
-std::array<float,2>{0.0436054245f, 0.949342906f},
-std::array<float,2>{0.933572173f, 0.280883491f},
-std::array<float,2>{0.824099779f, 0.537299633f},
-std::array<float,2>{0.205815867f, 0.215631053f},
-std::array<float,2>{0.448510975f, 0.922693729f},
-std::array<float,2>{0.719844997f, 0.363286704f},
-std::array<float,2>{0.621792972f, 0.837204397f},
-std::array<float,2>{0.301206529f, 0.471146107f},
-std::array<float,2>{0.0757731497f, 0.673672259f},
-std::array<float,2>{0.941665292f, 0.0240867734f},
-std::array<float,2>{0.889447272f, 0.973201036f},
-std::array<float,2>{0.00672168285f, 0.283133924f},
-std::array<float,2>{0.326192439f, 0.599920094f},
-std::array<float,2>{0.518558681f, 0.130544111f},
-std::array<float,2>{0.665775597f, 0.699894845f},
-std::array<float,2>{0.422034293f, 0.114866108f},
-std::array<float,2>{0.130389839f, 0.752280593f},
-std::array<float,2>{0.792847216f, 0.387790382f},
-std::array<float,2>{0.859486759f, 0.685766339f},
-std::array<float,2>{0.218871489f, 0.0233830381f},
-std::array<float,2>{0.483538657f, 0.833399773f},
-std::array<float,2>{0.701619089f, 0.476682007f},
-std::array<float,2>{0.589768887f, 0.929803491f},
-std::array<float,2>{0.266966075f, 0.374231845f},
-std::array<float,2>{0.11015211f, 0.543892801f},
-std::array<float,2>{0.975043774f, 0.205224931f},
-std::array<float,2>{0.927165866f, 0.76007688f},
-std::array<float,2>{0.0377373993f, 0.380479693f},
-std::array<float,2>{0.34524408f, 0.688228607f},
-std::array<float,2>{0.542074442f, 0.117932312f},
-std::array<float,2>{0.633028924f, 0.606386244f},
-std::array<float,2>{0.39717111f, 0.134427816f},
-std::array<float,2>{0.160528436f, 0.980930507f},
-std::array<float,2>{0.777371585f, 0.293968678f},
-std::array<float,2>{0.947622359f, 0.503963709f},
-std::array<float,2>{0.0655793995f, 0.226809248f},
-std::array<float,2>{0.309220493f, 0.896045387f},
-std::array<float,2>{0.612228572f, 0.333577871f},
-std::array<float,2>{0.728158593f, 0.86639291f},
-std::array<float,2>{0.441832006f, 0.467492044f},
-std::array<float,2>{0.218716383f, 0.65163666f},
-std::array<float,2>{0.819745004f, 0.0363023542f},
-std::array<float,2>{0.786021292f, 0.938077986f},
-std::array<float,2>{0.138172463f, 0.269053042f},
-std::array<float,2>{0.430588841f, 0.562574327f},
-std::array<float,2>{0.658089042f, 0.171929017f},
-std::array<float,2>{0.525574327f, 0.734443605f},
-std::array<float,2>{0.318015188f, 0.0929210037f},
-std::array<float,2>{0.0133386953f, 0.788350523f},
-std::array<float,2>{0.878890991f, 0.430239737f},
-std::array<float,2>{0.906191111f, 0.713052869f},
-std::array<float,2>{0.024634216f, 0.0965029895f},
-std::array<float,2>{0.342431664f, 0.769288361f},
-std::array<float,2>{0.502305567f, 0.395670116f},
-std::array<float,2>{0.686131477f, 0.99625504f},
-std::array<float,2>{0.409438044f, 0.301344365f},
-std::array<float,2>{0.153033376f, 0.620009065f},
-std::array<float,2>{0.801483333f, 0.153164551f},
-std::array<float,2>{0.828464031f, 0.822870195f},
-std::array<float,2>{0.201377943f, 0.494664699f},
-std::array<float,2>{0.465153009f, 0.671587944f},
-std::array<float,2>{0.740466475f, 0.00671063922f},
-std::array<float,2>{0.593776405f, 0.559110761f},
-std::array<float,2>{0.293202341f, 0.191679776f},
-std::array<float,2>{0.0856819227f, 0.912519217f},
-std::array<float,2>{0.958257914f, 0.352204829f},
-std::array<float,2>{0.75665462f, 0.582229793f},
-std::array<float,2>{0.179941207f, 0.163840905f},
-std::array<float,2>{0.380301744f, 0.958493471f},
-std::array<float,2>{0.64543575f, 0.256047934f},
-std::array<float,2>{0.550238192f, 0.806032836f},
-std::array<float,2>{0.368597984f, 0.421130002f},
-std::array<float,2>{0.0510583147f, 0.72050488f},
-std::array<float,2>{0.913163662f, 0.0741222352f},
-std::array<float,2>{0.991473973f, 0.875857472f},
-std::array<float,2>{0.10083501f, 0.324954361f},
-std::array<float,2>{0.254919499f, 0.520580828f},
-std::array<float,2>{0.56968224f, 0.235711843f},
-std::array<float,2>{0.708456993f, 0.6309793f},
-std::array<float,2>{0.48641324f, 0.0617707297f},
-std::array<float,2>{0.239662677f, 0.851320744f},
-std::array<float,2>{0.856449723f, 0.44191426f},
-std::array<float,2>{0.781667411f, 0.657664418f},
-std::array<float,2>{0.134914294f, 0.0126655316f},
-std::array<float,2>{0.436413229f, 0.819837153f},
-std::array<float,2>{0.662172437f, 0.484549254f},
-std::array<float,2>{0.531182289f, 0.915032089f},
-std::array<float,2>{0.314862549f, 0.347559154f},
-std::array<float,2>{0.00931174401f, 0.550610602f},
-std::array<float,2>{0.881452203f, 0.201983586f},
-std::array<float,2>{0.952495873f, 0.777296007f},
-std::array<float,2>{0.0683082938f, 0.404935509f},
-std::array<float,2>{0.306538463f, 0.705813468f},
-std::array<float,2>{0.614314556f, 0.108555347f},
-std::array<float,2>{0.732674897f, 0.610913754f},
-std::array<float,2>{0.441362888f, 0.140965059f},
-std::array<float,2>{0.214230031f, 0.98783052f},
-std::array<float,2>{0.814806283f, 0.305483341f},
-std::array<float,2>{0.924280286f, 0.52646184f},
-std::array<float,2>{0.035126783f, 0.247006759f},
-std::array<float,2>{0.350967199f, 0.884602606f},
-std::array<float,2>{0.546057403f, 0.316149026f},
-std::array<float,2>{0.638683438f, 0.857108772f},
-std::array<float,2>{0.391815752f, 0.448099434f},
-std::array<float,2>{0.156451017f, 0.634576321f},
-std::array<float,2>{0.777165413f, 0.0478746817f},
-std::array<float,2>{0.86422652f, 0.965497375f},
-std::array<float,2>{0.224160045f, 0.263104647f},
-std::array<float,2>{0.478569716f, 0.588031948f},
-std::array<float,2>{0.698388219f, 0.171040848f},
-std::array<float,2>{0.590360045f, 0.731223822f},
-std::array<float,2>{0.271028996f, 0.0673182905f},
-std::array<float,2>{0.113345347f, 0.803277791f},
-std::array<float,2>{0.969112217f, 0.406473249f},
-std::array<float,2>{0.986378193f, 0.699157894f},
-std::array<float,2>{0.0961593688f, 0.113051966f},
-std::array<float,2>{0.250745118f, 0.757165015f},
-std::array<float,2>{0.563590169f, 0.386654198f},
-std::array<float,2>{0.706522584f, 0.971413553f},
-std::array<float,2>{0.488611132f, 0.285281777f},
-std::array<float,2>{0.238173231f, 0.595189095f},
-std::array<float,2>{0.854750693f, 0.12554422f},
-std::array<float,2>{0.752460539f, 0.840999842f},
-std::array<float,2>{0.184102327f, 0.475623041f},
-std::array<float,2>{0.375363767f, 0.678050637f},
-std::array<float,2>{0.64283818f, 0.0284555443f},
-std::array<float,2>{0.552423358f, 0.5318169f},
-std::array<float,2>{0.371676028f, 0.213614836f},
-std::array<float,2>{0.0503505059f, 0.929626703f},
-std::array<float,2>{0.908612788f, 0.363115847f},
-std::array<float,2>{0.832702696f, 0.573937774f},
-std::array<float,2>{0.196704701f, 0.18656081f},
-std::array<float,2>{0.462643981f, 0.945753634f},
-std::array<float,2>{0.736344874f, 0.27355966f},
-std::array<float,2>{0.598320723f, 0.792653024f},
-std::array<float,2>{0.289606124f, 0.428009659f},
-std::array<float,2>{0.081044063f, 0.748846948f},
-std::array<float,2>{0.954153299f, 0.0856482387f},
-std::array<float,2>{0.901183903f, 0.90264672f},
-std::array<float,2>{0.0292754341f, 0.342874765f},
-std::array<float,2>{0.336979449f, 0.512205064f},
-std::array<float,2>{0.507072687f, 0.225129664f},
-std::array<float,2>{0.681815088f, 0.645273328f},
-std::array<float,2>{0.413983434f, 0.0427543335f},
-std::array<float,2>{0.150129527f, 0.867242515f},
-std::array<float,2>{0.800337553f, 0.455749333f},
-std::array<float,2>{0.84713012f, 0.738600314f},
-std::array<float,2>{0.245309159f, 0.0873786062f},
-std::array<float,2>{0.498325348f, 0.781808853f},
-std::array<float,2>{0.711424708f, 0.433935732f},
-std::array<float,2>{0.571366251f, 0.942304909f},
-std::array<float,2>{0.259311825f, 0.273413628f},
-std::array<float,2>{0.108700186f, 0.566556454f},
-std::array<float,2>{0.995793283f, 0.177687734f},
-std::array<float,2>{0.914114356f, 0.861925125f},
-std::array<float,2>{0.0582408346f, 0.46431762f},
-std::array<float,2>{0.362001926f, 0.654278696f},
-std::array<float,2>{0.560639739f, 0.0347444341f},
-std::array<float,2>{0.650076807f, 0.502112746f},
-std::array<float,2>{0.386939108f, 0.231802329f},
-std::array<float,2>{0.175411716f, 0.891395032f},
-std::array<float,2>{0.762581885f, 0.330746084f},
-std::array<float,2>{0.965065479f, 0.601924121f},
-std::array<float,2>{0.0902606025f, 0.136859193f},
-std::array<float,2>{0.281773835f, 0.980290413f},
-std::array<float,2>{0.604946613f, 0.289123774f},
-std::array<float,2>{0.749743104f, 0.763522685f},
-std::array<float,2>{0.455380082f, 0.376826078f},
-std::array<float,2>{0.192530915f, 0.692413747f},
-std::array<float,2>{0.842143476f, 0.124543354f},
-std::array<float,2>{0.80629462f, 0.937362611f},
-std::array<float,2>{0.146530241f, 0.368549496f},
-std::array<float,2>{0.417135805f, 0.542548776f},
-std::array<float,2>{0.676123857f, 0.207766905f},
-std::array<float,2>{0.510517657f, 0.681569278f},
-std::array<float,2>{0.330765754f, 0.0186562203f},
-std::array<float,2>{0.0185772646f, 0.829497099f},
-std::array<float,2>{0.897336781f, 0.481949002f},
-std::array<float,2>{0.886155427f, 0.625105321f},
-std::array<float,2>{0.000712264911f, 0.0549365021f},
-std::array<float,2>{0.320633501f, 0.845787823f},
-std::array<float,2>{0.522249281f, 0.439792812f},
-std::array<float,2>{0.670874536f, 0.882751763f},
-std::array<float,2>{0.427556664f, 0.322113901f},
-std::array<float,2>{0.125480995f, 0.51850462f},
-std::array<float,2>{0.79681474f, 0.239347145f},
-std::array<float,2>{0.825765669f, 0.81176734f},
-std::array<float,2>{0.208967611f, 0.41487819f},
-std::array<float,2>{0.452820599f, 0.723119974f},
-std::array<float,2>{0.72549063f, 0.0754083917f},
-std::array<float,2>{0.617209017f, 0.581622124f},
-std::array<float,2>{0.298042297f, 0.156859845f},
-std::array<float,2>{0.0721789077f, 0.954760909f},
-std::array<float,2>{0.941337109f, 0.25145179f},
-std::array<float,2>{0.772331238f, 0.557550132f},
-std::array<float,2>{0.1641047f, 0.189862102f},
-std::array<float,2>{0.401552439f, 0.909783721f},
-std::array<float,2>{0.632427812f, 0.358370304f},
-std::array<float,2>{0.534309089f, 0.826546967f},
-std::array<float,2>{0.358368665f, 0.496257573f},
-std::array<float,2>{0.0414378047f, 0.664852977f},
-std::array<float,2>{0.936572075f, 0.00299015711f},
-std::array<float,2>{0.983308077f, 0.992502391f},
-std::array<float,2>{0.118829645f, 0.299873799f},
-std::array<float,2>{0.277169555f, 0.622535944f},
-std::array<float,2>{0.581331372f, 0.149583861f},
-std::array<float,2>{0.694812536f, 0.717967033f},
-std::array<float,2>{0.47235924f, 0.100416869f},
-std::array<float,2>{0.23172833f, 0.771485984f},
-std::array<float,2>{0.873458326f, 0.392104119f},
-std::array<float,2>{0.759049118f, 0.708239615f},
-std::array<float,2>{0.177283764f, 0.104037732f},
-std::array<float,2>{0.386253744f, 0.780024469f},
-std::array<float,2>{0.654165149f, 0.402253062f},
-std::array<float,2>{0.556862891f, 0.989637673f},
-std::array<float,2>{0.36333409f, 0.312134176f},
-std::array<float,2>{0.0600890256f, 0.615131676f},
-std::array<float,2>{0.921242893f, 0.146681949f},
-std::array<float,2>{0.998035729f, 0.81353575f},
-std::array<float,2>{0.103757873f, 0.491379172f},
-std::array<float,2>{0.262450635f, 0.661118507f},
-std::array<float,2>{0.57477814f, 0.0101507772f},
-std::array<float,2>{0.717534125f, 0.552257419f},
-std::array<float,2>{0.492447108f, 0.196851313f},
-std::array<float,2>{0.249216393f, 0.917976737f},
-std::array<float,2>{0.848760366f, 0.351084858f},
-std::array<float,2>{0.891600311f, 0.591443062f},
-std::array<float,2>{0.0212640185f, 0.166835114f},
-std::array<float,2>{0.333153814f, 0.962752521f},
-std::array<float,2>{0.514554203f, 0.260565877f},
-std::array<float,2>{0.674869478f, 0.799703956f},
-std::array<float,2>{0.420785517f, 0.41016981f},
-std::array<float,2>{0.142284542f, 0.728572786f},
-std::array<float,2>{0.810565889f, 0.0647029057f},
-std::array<float,2>{0.839793324f, 0.889621198f},
-std::array<float,2>{0.188005954f, 0.317967921f},
-std::array<float,2>{0.458871186f, 0.527712882f},
-std::array<float,2>{0.742491603f, 0.24450998f},
-std::array<float,2>{0.606531322f, 0.64012754f},
-std::array<float,2>{0.288215131f, 0.0536648519f},
-std::array<float,2>{0.0893857777f, 0.855072439f},
-std::array<float,2>{0.962128699f, 0.452449203f},
-std::array<float,2>{0.944809854f, 0.675496399f},
-std::array<float,2>{0.0762789547f, 0.0267589651f},
-std::array<float,2>{0.303533435f, 0.839134097f},
-std::array<float,2>{0.624686539f, 0.470563471f},
-std::array<float,2>{0.720731616f, 0.924290895f},
-std::array<float,2>{0.447094828f, 0.366153657f},
-std::array<float,2>{0.204960242f, 0.535263181f},
-std::array<float,2>{0.820468545f, 0.217288882f},
-std::array<float,2>{0.790492415f, 0.750867963f},
-std::array<float,2>{0.132739291f, 0.388967633f},
-std::array<float,2>{0.424069107f, 0.701494455f},
-std::array<float,2>{0.666513622f, 0.117045924f},
-std::array<float,2>{0.517258584f, 0.598439038f},
-std::array<float,2>{0.324273944f, 0.131292671f},
-std::array<float,2>{0.00566859171f, 0.976239324f},
-std::array<float,2>{0.886898637f, 0.285106212f},
-std::array<float,2>{0.87079829f, 0.509373128f},
-std::array<float,2>{0.227617204f, 0.221537203f},
-std::array<float,2>{0.474191546f, 0.901770949f},
-std::array<float,2>{0.68982476f, 0.339687347f},
-std::array<float,2>{0.584343493f, 0.87170434f},
-std::array<float,2>{0.280411512f, 0.45743683f},
-std::array<float,2>{0.123984911f, 0.641725719f},
-std::array<float,2>{0.977149963f, 0.0461042225f},
-std::array<float,2>{0.929691494f, 0.952056348f},
-std::array<float,2>{0.0463928394f, 0.27848956f},
-std::array<float,2>{0.355338603f, 0.577511549f},
-std::array<float,2>{0.537751377f, 0.183245406f},
-std::array<float,2>{0.626597643f, 0.743679881f},
-std::array<float,2>{0.404809862f, 0.0800144821f},
-std::array<float,2>{0.169091523f, 0.796448886f},
-std::array<float,2>{0.767150283f, 0.424954206f},
-std::array<float,2>{0.816918671f, 0.649672866f},
-std::array<float,2>{0.215061679f, 0.0376072191f},
-std::array<float,2>{0.444429666f, 0.863700926f},
-std::array<float,2>{0.728995442f, 0.465821475f},
-std::array<float,2>{0.610475183f, 0.898226857f},
-std::array<float,2>{0.311869264f, 0.334486306f},
-std::array<float,2>{0.0637157634f, 0.507196546f},
-std::array<float,2>{0.946872771f, 0.229065016f},
-std::array<float,2>{0.875610471f, 0.78652066f},
-std::array<float,2>{0.0148483077f, 0.431772381f},
-std::array<float,2>{0.318896681f, 0.73791182f},
-std::array<float,2>{0.524318755f, 0.0905657038f},
-std::array<float,2>{0.659234464f, 0.566103458f},
-std::array<float,2>{0.433326095f, 0.175392076f},
-std::array<float,2>{0.138930753f, 0.939757943f},
-std::array<float,2>{0.788845062f, 0.266989529f},
-std::array<float,2>{0.973152637f, 0.546263099f},
-std::array<float,2>{0.11220412f, 0.20363532f},
-std::array<float,2>{0.268523753f, 0.932822108f},
-std::array<float,2>{0.587393403f, 0.372939259f},
-std::array<float,2>{0.699408352f, 0.835170746f},
-std::array<float,2>{0.480661839f, 0.479371846f},
-std::array<float,2>{0.220808685f, 0.684747338f},
-std::array<float,2>{0.861789942f, 0.0210380387f},
-std::array<float,2>{0.780222356f, 0.982895195f},
-std::array<float,2>{0.162904531f, 0.296276718f},
-std::array<float,2>{0.396208167f, 0.609097481f},
-std::array<float,2>{0.635174453f, 0.135861963f},
-std::array<float,2>{0.54083091f, 0.690177798f},
-std::array<float,2>{0.347620755f, 0.120712556f},
-std::array<float,2>{0.0354352444f, 0.759495437f},
-std::array<float,2>{0.927852571f, 0.381255567f},
-std::array<float,2>{0.911514223f, 0.721044719f},
-std::array<float,2>{0.0543263704f, 0.0721694231f},
-std::array<float,2>{0.369767427f, 0.807863951f},
-std::array<float,2>{0.548560143f, 0.418859512f},
-std::array<float,2>{0.64650476f, 0.960644245f},
-std::array<float,2>{0.382014662f, 0.254880399f},
-std::array<float,2>{0.18309246f, 0.584553778f},
-std::array<float,2>{0.754469693f, 0.161682859f},
-std::array<float,2>{0.859358788f, 0.847820163f},
-std::array<float,2>{0.241912931f, 0.444462657f},
-std::array<float,2>{0.485675275f, 0.629202962f},
-std::array<float,2>{0.709026873f, 0.0588883683f},
-std::array<float,2>{0.56696409f, 0.523266912f},
-std::array<float,2>{0.255916774f, 0.237471953f},
-std::array<float,2>{0.0993993133f, 0.878872752f},
-std::array<float,2>{0.990017295f, 0.327314317f},
-std::array<float,2>{0.803449929f, 0.618294895f},
-std::array<float,2>{0.154370934f, 0.154623091f},
-std::array<float,2>{0.406308293f, 0.999606252f},
-std::array<float,2>{0.683836281f, 0.304307461f},
-std::array<float,2>{0.500584662f, 0.766690969f},
-std::array<float,2>{0.341056734f, 0.396927625f},
-std::array<float,2>{0.0265676696f, 0.711007357f},
-std::array<float,2>{0.902576208f, 0.0951868594f},
-std::array<float,2>{0.959628701f, 0.91064775f},
-std::array<float,2>{0.0831833631f, 0.354365766f},
-std::array<float,2>{0.295365006f, 0.560791075f},
-std::array<float,2>{0.597051382f, 0.193930775f},
-std::array<float,2>{0.738443553f, 0.669700921f},
-std::array<float,2>{0.467349261f, 0.00524067879f},
-std::array<float,2>{0.200080708f, 0.821902156f},
-std::array<float,2>{0.830232441f, 0.492476434f},
-std::array<float,2>{0.750783503f, 0.678966224f},
-std::array<float,2>{0.186396599f, 0.0281261727f},
-std::array<float,2>{0.378732771f, 0.840819776f},
-std::array<float,2>{0.642519832f, 0.475207746f},
-std::array<float,2>{0.553333163f, 0.92806536f},
-std::array<float,2>{0.374668121f, 0.361852825f},
-std::array<float,2>{0.0487232506f, 0.533177972f},
-std::array<float,2>{0.906462669f, 0.214721382f},
-std::array<float,2>{0.985910118f, 0.756672978f},
-std::array<float,2>{0.0956786275f, 0.3848297f},
-std::array<float,2>{0.252056181f, 0.697309256f},
-std::array<float,2>{0.565926194f, 0.111722752f},
-std::array<float,2>{0.703151941f, 0.59413445f},
-std::array<float,2>{0.491377354f, 0.126914799f},
-std::array<float,2>{0.234435484f, 0.972581744f},
-std::array<float,2>{0.85228008f, 0.286478847f},
-std::array<float,2>{0.898547053f, 0.513056159f},
-std::array<float,2>{0.0310741402f, 0.225590155f},
-std::array<float,2>{0.338872254f, 0.903882027f},
-std::array<float,2>{0.505028963f, 0.342119604f},
-std::array<float,2>{0.68139565f, 0.869022906f},
-std::array<float,2>{0.411378682f, 0.456393003f},
-std::array<float,2>{0.151568875f, 0.645524383f},
-std::array<float,2>{0.798027694f, 0.0417120308f},
-std::array<float,2>{0.834590375f, 0.946593344f},
-std::array<float,2>{0.198071659f, 0.275340736f},
-std::array<float,2>{0.46418339f, 0.572690487f},
-std::array<float,2>{0.735402524f, 0.185961023f},
-std::array<float,2>{0.601100326f, 0.749601722f},
-std::array<float,2>{0.292336196f, 0.084938325f},
-std::array<float,2>{0.0792283118f, 0.791364968f},
-std::array<float,2>{0.955393255f, 0.429145753f},
-std::array<float,2>{0.950141311f, 0.706539869f},
-std::array<float,2>{0.0683968067f, 0.108213775f},
-std::array<float,2>{0.306992799f, 0.775417268f},
-std::array<float,2>{0.615628302f, 0.406243414f},
-std::array<float,2>{0.732096791f, 0.986837327f},
-std::array<float,2>{0.437753975f, 0.305803627f},
-std::array<float,2>{0.211495891f, 0.609939814f},
-std::array<float,2>{0.812649131f, 0.142186582f},
-std::array<float,2>{0.785023987f, 0.819127083f},
-std::array<float,2>{0.134189919f, 0.48577258f},
-std::array<float,2>{0.43360889f, 0.657121658f},
-std::array<float,2>{0.66135627f, 0.0129176481f},
-std::array<float,2>{0.529155195f, 0.549341023f},
-std::array<float,2>{0.313614845f, 0.202890903f},
-std::array<float,2>{0.0113706272f, 0.915199578f},
-std::array<float,2>{0.879619539f, 0.346214086f},
-std::array<float,2>{0.86640209f, 0.589175642f},
-std::array<float,2>{0.225504905f, 0.170669496f},
-std::array<float,2>{0.478073627f, 0.966133714f},
-std::array<float,2>{0.696282387f, 0.261953443f},
-std::array<float,2>{0.592867792f, 0.804390609f},
-std::array<float,2>{0.272205204f, 0.40760386f},
-std::array<float,2>{0.116932839f, 0.732205331f},
-std::array<float,2>{0.971557319f, 0.0679149255f},
-std::array<float,2>{0.922040105f, 0.883094072f},
-std::array<float,2>{0.0330164582f, 0.315425783f},
-std::array<float,2>{0.347994149f, 0.52541548f},
-std::array<float,2>{0.544034958f, 0.247575581f},
-std::array<float,2>{0.636979997f, 0.633130968f},
-std::array<float,2>{0.393175393f, 0.0476596653f},
-std::array<float,2>{0.159324542f, 0.855843604f},
-std::array<float,2>{0.77428019f, 0.448318422f},
-std::array<float,2>{0.827017009f, 0.724204957f},
-std::array<float,2>{0.210502282f, 0.0747999176f},
-std::array<float,2>{0.450853288f, 0.810881793f},
-std::array<float,2>{0.724528491f, 0.415668875f},
-std::array<float,2>{0.619553328f, 0.953627765f},
-std::array<float,2>{0.299674243f, 0.250294209f},
-std::array<float,2>{0.0727223903f, 0.580130339f},
-std::array<float,2>{0.939148962f, 0.158093035f},
-std::array<float,2>{0.8837623f, 0.84750396f},
-std::array<float,2>{0.00303890556f, 0.441047221f},
-std::array<float,2>{0.324070632f, 0.626513064f},
-std::array<float,2>{0.521478057f, 0.0562861003f},
-std::array<float,2>{0.669171572f, 0.518658996f},
-std::array<float,2>{0.428378344f, 0.238709569f},
-std::array<float,2>{0.127620712f, 0.881370783f},
-std::array<float,2>{0.793988764f, 0.320739567f},
-std::array<float,2>{0.981979132f, 0.621340454f},
-std::array<float,2>{0.119774029f, 0.148598149f},
-std::array<float,2>{0.273550779f, 0.993638754f},
-std::array<float,2>{0.578478575f, 0.299742788f},
-std::array<float,2>{0.693242788f, 0.773292482f},
-std::array<float,2>{0.469220698f, 0.391548246f},
-std::array<float,2>{0.234164029f, 0.716944337f},
-std::array<float,2>{0.871358752f, 0.101485357f},
-std::array<float,2>{0.769879997f, 0.908760309f},
-std::array<float,2>{0.167120427f, 0.358862668f},
-std::array<float,2>{0.399819493f, 0.557816148f},
-std::array<float,2>{0.629871249f, 0.191292226f},
-std::array<float,2>{0.532765567f, 0.665145278f},
-std::array<float,2>{0.356226563f, 0.00241471594f},
-std::array<float,2>{0.0407988355f, 0.827706516f},
-std::array<float,2>{0.933662593f, 0.497321665f},
-std::array<float,2>{0.91631031f, 0.653016865f},
-std::array<float,2>{0.0564312078f, 0.0341671854f},
-std::array<float,2>{0.36009106f, 0.86269629f},
-std::array<float,2>{0.560233116f, 0.463643283f},
-std::array<float,2>{0.650729239f, 0.891615212f},
-std::array<float,2>{0.389400303f, 0.331121862f},
-std::array<float,2>{0.172382131f, 0.503289878f},
-std::array<float,2>{0.76544255f, 0.230736569f},
-std::array<float,2>{0.843995452f, 0.782815635f},
-std::array<float,2>{0.243285671f, 0.435108632f},
-std::array<float,2>{0.496507049f, 0.739911497f},
-std::array<float,2>{0.713374674f, 0.0860440433f},
-std::array<float,2>{0.573852599f, 0.568165421f},
-std::array<float,2>{0.259879142f, 0.176391467f},
-std::array<float,2>{0.107365824f, 0.943280876f},
-std::array<float,2>{0.994041979f, 0.271737844f},
-std::array<float,2>{0.80851835f, 0.541894257f},
-std::array<float,2>{0.145071313f, 0.208240449f},
-std::array<float,2>{0.415310502f, 0.936241448f},
-std::array<float,2>{0.678170145f, 0.367791295f},
-std::array<float,2>{0.507831037f, 0.82899344f},
-std::array<float,2>{0.330066472f, 0.480471194f},
-std::array<float,2>{0.0157699101f, 0.680250287f},
-std::array<float,2>{0.895238578f, 0.0178906918f},
-std::array<float,2>{0.968246043f, 0.978800118f},
-std::array<float,2>{0.0928039476f, 0.290619493f},
-std::array<float,2>{0.284428269f, 0.602815688f},
-std::array<float,2>{0.602083981f, 0.137726039f},
-std::array<float,2>{0.748017371f, 0.691708505f},
-std::array<float,2>{0.455069155f, 0.123900518f},
-std::array<float,2>{0.194325134f, 0.761916757f},
-std::array<float,2>{0.8400231f, 0.375784755f},
-std::array<float,2>{0.791761279f, 0.703064382f},
-std::array<float,2>{0.129160583f, 0.115513191f},
-std::array<float,2>{0.422926933f, 0.751499414f},
-std::array<float,2>{0.664109886f, 0.390555173f},
-std::array<float,2>{0.517639577f, 0.975441813f},
-std::array<float,2>{0.327551037f, 0.283589929f},
-std::array<float,2>{0.0069099837f, 0.599536002f},
-std::array<float,2>{0.890375555f, 0.131955832f},
-std::array<float,2>{0.942391694f, 0.838813066f},
-std::array<float,2>{0.0744857267f, 0.469721854f},
-std::array<float,2>{0.302388698f, 0.674326539f},
-std::array<float,2>{0.623016834f, 0.0255269501f},
-std::array<float,2>{0.718853533f, 0.536503136f},
-std::array<float,2>{0.448013693f, 0.218259275f},
-std::array<float,2>{0.206946462f, 0.925051928f},
-std::array<float,2>{0.822643697f, 0.36664629f},
-std::array<float,2>{0.931806326f, 0.576875269f},
-std::array<float,2>{0.0444754399f, 0.182311058f},
-std::array<float,2>{0.351762742f, 0.95291698f},
-std::array<float,2>{0.536512196f, 0.27739495f},
-std::array<float,2>{0.627267659f, 0.795246005f},
-std::array<float,2>{0.403940469f, 0.424357861f},
-std::array<float,2>{0.170872971f, 0.742946923f},
-std::array<float,2>{0.7678864f, 0.0787201226f},
-std::array<float,2>{0.867893934f, 0.900996625f},
-std::array<float,2>{0.229443461f, 0.337929279f},
-std::array<float,2>{0.475164056f, 0.508482695f},
-std::array<float,2>{0.689358115f, 0.22248356f},
-std::array<float,2>{0.582258165f, 0.640657842f},
-std::array<float,2>{0.278621286f, 0.0458938628f},
-std::array<float,2>{0.122315876f, 0.87239635f},
-std::array<float,2>{0.980320871f, 0.458532572f},
-std::array<float,2>{0.998346746f, 0.661154866f},
-std::array<float,2>{0.103181995f, 0.0116764596f},
-std::array<float,2>{0.264094979f, 0.81294626f},
-std::array<float,2>{0.5777933f, 0.490523517f},
-std::array<float,2>{0.7154091f, 0.919641316f},
-std::array<float,2>{0.495882779f, 0.35003829f},
-std::array<float,2>{0.246365473f, 0.550990164f},
-std::array<float,2>{0.849916458f, 0.195568368f},
-std::array<float,2>{0.759960234f, 0.78046459f},
-std::array<float,2>{0.178057015f, 0.400807798f},
-std::array<float,2>{0.382884055f, 0.707996547f},
-std::array<float,2>{0.655934334f, 0.105325431f},
-std::array<float,2>{0.555074811f, 0.6134547f},
-std::array<float,2>{0.36690101f, 0.148000285f},
-std::array<float,2>{0.0621787496f, 0.988328338f},
-std::array<float,2>{0.918648839f, 0.310740769f},
-std::array<float,2>{0.837265313f, 0.528623283f},
-std::array<float,2>{0.189937115f, 0.246044874f},
-std::array<float,2>{0.459041834f, 0.889817953f},
-std::array<float,2>{0.745694041f, 0.316876709f},
-std::array<float,2>{0.607780993f, 0.853759885f},
-std::array<float,2>{0.286560625f, 0.451247126f},
-std::array<float,2>{0.0866617113f, 0.639304638f},
-std::array<float,2>{0.964802206f, 0.0544099323f},
-std::array<float,2>{0.894266725f, 0.961826921f},
-std::array<float,2>{0.0221917443f, 0.261089742f},
-std::array<float,2>{0.335392386f, 0.590560436f},
-std::array<float,2>{0.512940466f, 0.167917311f},
-std::array<float,2>{0.672054112f, 0.730302393f},
-std::array<float,2>{0.418704361f, 0.0655057356f},
-std::array<float,2>{0.143697217f, 0.800110579f},
-std::array<float,2>{0.808609545f, 0.41159147f},
-std::array<float,2>{0.856012046f, 0.630669534f},
-std::array<float,2>{0.238654554f, 0.0596701689f},
-std::array<float,2>{0.487705588f, 0.848825693f},
-std::array<float,2>{0.707355022f, 0.44361043f},
-std::array<float,2>{0.569134533f, 0.877484322f},
-std::array<float,2>{0.254517257f, 0.326310694f},
-std::array<float,2>{0.10032326f, 0.522178292f},
-std::array<float,2>{0.991026759f, 0.237046778f},
-std::array<float,2>{0.912798822f, 0.806960702f},
-std::array<float,2>{0.0521844327f, 0.419542611f},
-std::array<float,2>{0.367679566f, 0.722613156f},
-std::array<float,2>{0.548933864f, 0.0704732016f},
-std::array<float,2>{0.645867884f, 0.585269988f},
-std::array<float,2>{0.379787892f, 0.160483643f},
-std::array<float,2>{0.181598857f, 0.959255457f},
-std::array<float,2>{0.757212698f, 0.255791873f},
-std::array<float,2>{0.957976997f, 0.56227237f},
-std::array<float,2>{0.0847453997f, 0.19483231f},
-std::array<float,2>{0.294684291f, 0.911289096f},
-std::array<float,2>{0.595113933f, 0.354778022f},
-std::array<float,2>{0.741975307f, 0.820752025f},
-std::array<float,2>{0.466732532f, 0.493725985f},
-std::array<float,2>{0.202235177f, 0.668943822f},
-std::array<float,2>{0.829594076f, 0.00465458585f},
-std::array<float,2>{0.802224696f, 0.998588622f},
-std::array<float,2>{0.154104978f, 0.303164393f},
-std::array<float,2>{0.40903753f, 0.617886543f},
-std::array<float,2>{0.687183022f, 0.155893981f},
-std::array<float,2>{0.503531396f, 0.712584496f},
-std::array<float,2>{0.34300828f, 0.094683215f},
-std::array<float,2>{0.0243914723f, 0.765693426f},
-std::array<float,2>{0.904984117f, 0.397609115f},
-std::array<float,2>{0.877857327f, 0.737157762f},
-std::array<float,2>{0.012388506f, 0.0910641775f},
-std::array<float,2>{0.31695953f, 0.785801172f},
-std::array<float,2>{0.527130187f, 0.432929665f},
-std::array<float,2>{0.656397521f, 0.940916002f},
-std::array<float,2>{0.431091845f, 0.266241759f},
-std::array<float,2>{0.13741383f, 0.565333247f},
-std::array<float,2>{0.786875725f, 0.174218953f},
-std::array<float,2>{0.818848193f, 0.86435926f},
-std::array<float,2>{0.217212781f, 0.465079367f},
-std::array<float,2>{0.442802548f, 0.648710251f},
-std::array<float,2>{0.726935565f, 0.0389944687f},
-std::array<float,2>{0.612556159f, 0.506659627f},
-std::array<float,2>{0.309952289f, 0.230184093f},
-std::array<float,2>{0.0647716746f, 0.897455752f},
-std::array<float,2>{0.94921118f, 0.335016549f},
-std::array<float,2>{0.778669596f, 0.607792139f},
-std::array<float,2>{0.161429837f, 0.135352969f},
-std::array<float,2>{0.398257434f, 0.983698308f},
-std::array<float,2>{0.633940876f, 0.295372218f},
-std::array<float,2>{0.541338325f, 0.758434713f},
-std::array<float,2>{0.344207406f, 0.382570922f},
-std::array<float,2>{0.0388990603f, 0.691366315f},
-std::array<float,2>{0.926475525f, 0.119405515f},
-std::array<float,2>{0.976531446f, 0.931702554f},
-std::array<float,2>{0.110999852f, 0.372047931f},
-std::array<float,2>{0.265988231f, 0.545640588f},
-std::array<float,2>{0.587959051f, 0.204659864f},
-std::array<float,2>{0.702267289f, 0.683948159f},
-std::array<float,2>{0.482815325f, 0.019844126f},
-std::array<float,2>{0.220411181f, 0.834222734f},
-std::array<float,2>{0.861062229f, 0.480453223f},
-std::array<float,2>{0.799540222f, 0.647551894f},
-std::array<float,2>{0.148702294f, 0.0402722247f},
-std::array<float,2>{0.412820816f, 0.869648635f},
-std::array<float,2>{0.68316859f, 0.454860389f},
-std::array<float,2>{0.50634259f, 0.904330194f},
-std::array<float,2>{0.336660504f, 0.341065496f},
-std::array<float,2>{0.0276424754f, 0.514018774f},
-std::array<float,2>{0.902141392f, 0.22360383f},
-std::array<float,2>{0.953859985f, 0.79037571f},
-std::array<float,2>{0.0814087242f, 0.426405221f},
-std::array<float,2>{0.290475875f, 0.74742651f},
-std::array<float,2>{0.599309623f, 0.0828650892f},
-std::array<float,2>{0.737871289f, 0.571149647f},
-std::array<float,2>{0.461904287f, 0.184933156f},
-std::array<float,2>{0.195594802f, 0.948293447f},
-std::array<float,2>{0.83393544f, 0.276776433f},
-std::array<float,2>{0.909394503f, 0.534218431f},
-std::array<float,2>{0.0493238755f, 0.212299109f},
-std::array<float,2>{0.372349769f, 0.926032901f},
-std::array<float,2>{0.551112115f, 0.361282587f},
-std::array<float,2>{0.64375484f, 0.842269599f},
-std::array<float,2>{0.376636595f, 0.473215431f},
-std::array<float,2>{0.184822932f, 0.676271141f},
-std::array<float,2>{0.753579259f, 0.0307934042f},
-std::array<float,2>{0.854469776f, 0.969705582f},
-std::array<float,2>{0.236990586f, 0.288091958f},
-std::array<float,2>{0.489444375f, 0.596200526f},
-std::array<float,2>{0.705245972f, 0.128359795f},
-std::array<float,2>{0.562506497f, 0.696023226f},
-std::array<float,2>{0.251779795f, 0.110477537f},
-std::array<float,2>{0.0973310396f, 0.755210519f},
-std::array<float,2>{0.988277137f, 0.383037567f},
-std::array<float,2>{0.97000289f, 0.732718706f},
-std::array<float,2>{0.114586063f, 0.0695182607f},
-std::array<float,2>{0.269630492f, 0.802195489f},
-std::array<float,2>{0.591650128f, 0.408550084f},
-std::array<float,2>{0.697752953f, 0.968712807f},
-std::array<float,2>{0.480322212f, 0.26414451f},
-std::array<float,2>{0.223550543f, 0.587018907f},
-std::array<float,2>{0.865219176f, 0.168678388f},
-std::array<float,2>{0.775400043f, 0.859335482f},
-std::array<float,2>{0.157472119f, 0.446335435f},
-std::array<float,2>{0.390814811f, 0.636246979f},
-std::array<float,2>{0.639833748f, 0.0498902909f},
-std::array<float,2>{0.545499384f, 0.52388376f},
-std::array<float,2>{0.349635303f, 0.248286813f},
-std::array<float,2>{0.0332179815f, 0.886072636f},
-std::array<float,2>{0.924876094f, 0.312673539f},
-std::array<float,2>{0.816291273f, 0.611740112f},
-std::array<float,2>{0.213590488f, 0.143549114f},
-std::array<float,2>{0.439979911f, 0.985259414f},
-std::array<float,2>{0.733884931f, 0.30664137f},
-std::array<float,2>{0.613465786f, 0.773844123f},
-std::array<float,2>{0.304941624f, 0.403266311f},
-std::array<float,2>{0.0666661933f, 0.704907596f},
-std::array<float,2>{0.951565385f, 0.107326165f},
-std::array<float,2>{0.882747531f, 0.9166044f},
-std::array<float,2>{0.0080323657f, 0.345001012f},
-std::array<float,2>{0.31627664f, 0.547537088f},
-std::array<float,2>{0.529607952f, 0.200800598f},
-std::array<float,2>{0.663830101f, 0.659690499f},
-std::array<float,2>{0.437011003f, 0.0150677646f},
-std::array<float,2>{0.135949567f, 0.817860723f},
-std::array<float,2>{0.782615066f, 0.486869454f},
-std::array<float,2>{0.874499738f, 0.715816796f},
-std::array<float,2>{0.231185094f, 0.0995399356f},
-std::array<float,2>{0.470974505f, 0.770879686f},
-std::array<float,2>{0.693403304f, 0.393786907f},
-std::array<float,2>{0.580789804f, 0.995556772f},
-std::array<float,2>{0.275915354f, 0.297726512f},
-std::array<float,2>{0.117411792f, 0.624717653f},
-std::array<float,2>{0.98403734f, 0.150679365f},
-std::array<float,2>{0.936455786f, 0.825273037f},
-std::array<float,2>{0.0428150296f, 0.49889946f},
-std::array<float,2>{0.358602047f, 0.66773814f},
-std::array<float,2>{0.53373009f, 0.0015304205f},
-std::array<float,2>{0.63165462f, 0.555636644f},
-std::array<float,2>{0.40079844f, 0.189188763f},
-std::array<float,2>{0.165856853f, 0.907598853f},
-std::array<float,2>{0.772736728f, 0.35703972f},
-std::array<float,2>{0.940057755f, 0.578505278f},
-std::array<float,2>{0.07050585f, 0.159938246f},
-std::array<float,2>{0.297186583f, 0.956555426f},
-std::array<float,2>{0.61906904f, 0.253264546f},
-std::array<float,2>{0.726546407f, 0.808706224f},
-std::array<float,2>{0.451690555f, 0.41764605f},
-std::array<float,2>{0.207266256f, 0.724893987f},
-std::array<float,2>{0.824704945f, 0.0765300617f},
-std::array<float,2>{0.795153558f, 0.879964471f},
-std::array<float,2>{0.126315802f, 0.322997719f},
-std::array<float,2>{0.426202089f, 0.517359495f},
-std::array<float,2>{0.671016991f, 0.241327852f},
-std::array<float,2>{0.522526205f, 0.627326429f},
-std::array<float,2>{0.322126269f, 0.05686111f},
-std::array<float,2>{0.00175746228f, 0.84526974f},
-std::array<float,2>{0.885565698f, 0.438611269f},
-std::array<float,2>{0.897844434f, 0.683365166f},
-std::array<float,2>{0.0176033191f, 0.0163860898f},
-std::array<float,2>{0.331128269f, 0.831245601f},
-std::array<float,2>{0.510944009f, 0.483435243f},
-std::array<float,2>{0.677625477f, 0.934481561f},
-std::array<float,2>{0.416705936f, 0.369643807f},
-std::array<float,2>{0.148435771f, 0.539660931f},
-std::array<float,2>{0.804876387f, 0.210736841f},
-std::array<float,2>{0.843694627f, 0.765372932f},
-std::array<float,2>{0.192275792f, 0.378124982f},
-std::array<float,2>{0.4564569f, 0.693464518f},
-std::array<float,2>{0.748697102f, 0.121888228f},
-std::array<float,2>{0.604447246f, 0.604490936f},
-std::array<float,2>{0.28290537f, 0.140117854f},
-std::array<float,2>{0.0908912867f, 0.977396011f},
-std::array<float,2>{0.965956032f, 0.292248636f},
-std::array<float,2>{0.763048172f, 0.500409901f},
-std::array<float,2>{0.174792737f, 0.232686192f},
-std::array<float,2>{0.388150305f, 0.893829107f},
-std::array<float,2>{0.649001539f, 0.329647183f},
-std::array<float,2>{0.562363684f, 0.859609544f},
-std::array<float,2>{0.362954706f, 0.462082654f},
-std::array<float,2>{0.0566789657f, 0.656041443f},
-std::array<float,2>{0.915912747f, 0.032913357f},
-std::array<float,2>{0.994988501f, 0.944364846f},
-std::array<float,2>{0.107460909f, 0.270722806f},
-std::array<float,2>{0.258545071f, 0.568933666f},
-std::array<float,2>{0.570999146f, 0.179325342f},
-std::array<float,2>{0.712556601f, 0.741020262f},
-std::array<float,2>{0.499563634f, 0.0895676911f},
-std::array<float,2>{0.244870767f, 0.783628285f},
-std::array<float,2>{0.846667051f, 0.435934275f},
-std::array<float,2>{0.765689254f, 0.744413793f},
-std::array<float,2>{0.168043554f, 0.0816075206f},
-std::array<float,2>{0.405914426f, 0.794439197f},
-std::array<float,2>{0.625802815f, 0.423046261f},
-std::array<float,2>{0.538920701f, 0.950631499f},
-std::array<float,2>{0.353944123f, 0.279496998f},
-std::array<float,2>{0.0457309633f, 0.574610293f},
-std::array<float,2>{0.930986822f, 0.18025814f},
-std::array<float,2>{0.977976322f, 0.874985695f},
-std::array<float,2>{0.12417607f, 0.460738778f},
-std::array<float,2>{0.279463768f, 0.642590463f},
-std::array<float,2>{0.58571434f, 0.043700099f},
-std::array<float,2>{0.69053936f, 0.510701537f},
-std::array<float,2>{0.472930938f, 0.219743714f},
-std::array<float,2>{0.226783544f, 0.900109529f},
-std::array<float,2>{0.869153142f, 0.336602777f},
-std::array<float,2>{0.887931347f, 0.601169944f},
-std::array<float,2>{0.00456840778f, 0.12982437f},
-std::array<float,2>{0.325969934f, 0.973923326f},
-std::array<float,2>{0.515647769f, 0.281745136f},
-std::array<float,2>{0.667424798f, 0.753088534f},
-std::array<float,2>{0.425458103f, 0.387372226f},
-std::array<float,2>{0.131117448f, 0.700872242f},
-std::array<float,2>{0.789556682f, 0.11377985f},
-std::array<float,2>{0.821944177f, 0.923818767f},
-std::array<float,2>{0.203792527f, 0.364927143f},
-std::array<float,2>{0.44564271f, 0.538410544f},
-std::array<float,2>{0.722103298f, 0.216574043f},
-std::array<float,2>{0.623071074f, 0.672098637f},
-std::array<float,2>{0.304352999f, 0.025161637f},
-std::array<float,2>{0.0779521018f, 0.836608648f},
-std::array<float,2>{0.943544388f, 0.472503573f},
-std::array<float,2>{0.961127162f, 0.636999726f},
-std::array<float,2>{0.0880354792f, 0.052589599f},
-std::array<float,2>{0.287899137f, 0.852219641f},
-std::array<float,2>{0.60558778f, 0.450529188f},
-std::array<float,2>{0.743515193f, 0.887073278f},
-std::array<float,2>{0.457237244f, 0.319424927f},
-std::array<float,2>{0.188982338f, 0.529368341f},
-std::array<float,2>{0.838717937f, 0.24250792f},
-std::array<float,2>{0.811858535f, 0.798243582f},
-std::array<float,2>{0.141088754f, 0.413587242f},
-std::array<float,2>{0.421296656f, 0.727190614f},
-std::array<float,2>{0.674743593f, 0.0638495386f},
-std::array<float,2>{0.515496075f, 0.592894852f},
-std::array<float,2>{0.33246395f, 0.165765539f},
-std::array<float,2>{0.0199543219f, 0.964581192f},
-std::array<float,2>{0.89173764f, 0.259222567f},
-std::array<float,2>{0.848032296f, 0.553544343f},
-std::array<float,2>{0.248077884f, 0.197648287f},
-std::array<float,2>{0.493251801f, 0.920182109f},
-std::array<float,2>{0.718665004f, 0.348504454f},
-std::array<float,2>{0.575804293f, 0.816238403f},
-std::array<float,2>{0.263610631f, 0.489143401f},
-std::array<float,2>{0.105057299f, 0.663541198f},
-std::array<float,2>{0.996849358f, 0.00808324385f},
-std::array<float,2>{0.920505404f, 0.991253257f},
-std::array<float,2>{0.0589491576f, 0.310310572f},
-std::array<float,2>{0.364707142f, 0.616381288f},
-std::array<float,2>{0.558064044f, 0.146179646f},
-std::array<float,2>{0.653286934f, 0.70943886f},
-std::array<float,2>{0.385642052f, 0.10312216f},
-std::array<float,2>{0.176186025f, 0.779009283f},
-std::array<float,2>{0.75824368f, 0.39878872f},
-std::array<float,2>{0.831966043f, 0.670416296f},
-std::array<float,2>{0.200215861f, 0.00701347599f},
-std::array<float,2>{0.468604475f, 0.823731005f},
-std::array<float,2>{0.739490867f, 0.495279193f},
-std::array<float,2>{0.596142888f, 0.91340512f},
-std::array<float,2>{0.29607892f, 0.353029728f},
-std::array<float,2>{0.0821291432f, 0.559940755f},
-std::array<float,2>{0.960620344f, 0.192433327f},
-std::array<float,2>{0.903730869f, 0.768187821f},
-std::array<float,2>{0.025979111f, 0.395100474f},
-std::array<float,2>{0.340332657f, 0.714556336f},
-std::array<float,2>{0.501224041f, 0.0970219225f},
-std::array<float,2>{0.685251951f, 0.62082988f},
-std::array<float,2>{0.407619894f, 0.153468221f},
-std::array<float,2>{0.155316189f, 0.997246206f},
-std::array<float,2>{0.804067969f, 0.302411586f},
-std::array<float,2>{0.988332808f, 0.520086527f},
-std::array<float,2>{0.0984391272f, 0.234713539f},
-std::array<float,2>{0.257237107f, 0.876425207f},
-std::array<float,2>{0.568357766f, 0.325473547f},
-std::array<float,2>{0.710588455f, 0.850199163f},
-std::array<float,2>{0.484621555f, 0.443205297f},
-std::array<float,2>{0.240732551f, 0.632650733f},
-std::array<float,2>{0.857785046f, 0.0611849651f},
-std::array<float,2>{0.755620599f, 0.957047284f},
-std::array<float,2>{0.18199417f, 0.257708728f},
-std::array<float,2>{0.381131709f, 0.583849788f},
-std::array<float,2>{0.647784352f, 0.162829176f},
-std::array<float,2>{0.547551274f, 0.719129801f},
-std::array<float,2>{0.370341837f, 0.0730380118f},
-std::array<float,2>{0.0533072837f, 0.804747283f},
-std::array<float,2>{0.910857081f, 0.420859575f},
-std::array<float,2>{0.928820074f, 0.689018905f},
-std::array<float,2>{0.0368321128f, 0.119125493f},
-std::array<float,2>{0.345933408f, 0.761058748f},
-std::array<float,2>{0.539536893f, 0.379417986f},
-std::array<float,2>{0.635993838f, 0.982274115f},
-std::array<float,2>{0.395137608f, 0.293663293f},
-std::array<float,2>{0.163740903f, 0.607102931f},
-std::array<float,2>{0.780826449f, 0.133657679f},
-std::array<float,2>{0.863048017f, 0.832949817f},
-std::array<float,2>{0.222055048f, 0.477922082f},
-std::array<float,2>{0.481470793f, 0.686874747f},
-std::array<float,2>{0.70019865f, 0.0217593759f},
-std::array<float,2>{0.586747646f, 0.544602931f},
-std::array<float,2>{0.268906713f, 0.206985295f},
-std::array<float,2>{0.112476669f, 0.930819035f},
-std::array<float,2>{0.973946035f, 0.373824686f},
-std::array<float,2>{0.787149549f, 0.563814819f},
-std::array<float,2>{0.140019476f, 0.173573196f},
-std::array<float,2>{0.431949228f, 0.939084053f},
-std::array<float,2>{0.659116149f, 0.268032461f},
-std::array<float,2>{0.52488488f, 0.787596226f},
-std::array<float,2>{0.319545865f, 0.430844486f},
-std::array<float,2>{0.013742662f, 0.735514402f},
-std::array<float,2>{0.876481533f, 0.0918127f},
-std::array<float,2>{0.946078062f, 0.895313501f},
-std::array<float,2>{0.0630972907f, 0.332158566f},
-std::array<float,2>{0.31106475f, 0.505655766f},
-std::array<float,2>{0.609830141f, 0.228479058f},
-std::array<float,2>{0.730316699f, 0.651223421f},
-std::array<float,2>{0.443447143f, 0.0361021161f},
-std::array<float,2>{0.216220915f, 0.865620732f},
-std::array<float,2>{0.818159401f, 0.468737125f}}
\ No newline at end of file
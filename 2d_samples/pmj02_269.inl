@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.633437514f, 0.0857099146f},
-std::array<float,2>{0.262331933f, 0.937315822f},
-std::array<float,2>{0.818055987f, 0.654243708f},
-std::array<float,2>{0.0105930101f, 0.420621812f},
-std::array<float,2>{0.880847156f, 0.300285518f},
-std::array<float,2>{0.133687705f, 0.522532821f},
-std::array<float,2>{0.511278987f, 0.795609653f},
-std::array<float,2>{0.450000405f, 0.171011955f},
-std::array<float,2>{0.590336382f, 0.439152032f},
-std::array<float,2>{0.377534121f, 0.694671631f},
-std::array<float,2>{0.961164534f, 0.983513772f},
-std::array<float,2>{0.202938795f, 0.0383910574f},
-std::array<float,2>{0.790331662f, 0.216475368f},
-std::array<float,2>{0.122218229f, 0.852491438f},
-std::array<float,2>{0.70358187f, 0.56690985f},
-std::array<float,2>{0.359130293f, 0.347717315f},
-std::array<float,2>{0.551775575f, 0.147449598f},
-std::array<float,2>{0.4819915f, 0.765104651f},
-std::array<float,2>{0.913936794f, 0.546636581f},
-std::array<float,2>{0.180452436f, 0.278725922f},
-std::array<float,2>{0.870073557f, 0.378728271f},
-std::array<float,2>{0.0334641933f, 0.679172933f},
-std::array<float,2>{0.679998219f, 0.898641169f},
-std::array<float,2>{0.306921005f, 0.102528751f},
-std::array<float,2>{0.724863887f, 0.339969009f},
-std::array<float,2>{0.340758681f, 0.623761117f},
-std::array<float,2>{0.75667417f, 0.830408096f},
-std::array<float,2>{0.0833598077f, 0.243298307f},
-std::array<float,2>{0.996018052f, 0.0180446729f},
-std::array<float,2>{0.238585532f, 0.941418648f},
-std::array<float,2>{0.605087101f, 0.741712332f},
-std::array<float,2>{0.417708546f, 0.470176935f},
-std::array<float,2>{0.694053292f, 0.232886389f},
-std::array<float,2>{0.369838953f, 0.813192368f},
-std::array<float,2>{0.801827788f, 0.601880848f},
-std::array<float,2>{0.100563169f, 0.321390301f},
-std::array<float,2>{0.952688098f, 0.487607151f},
-std::array<float,2>{0.209178761f, 0.719884634f},
-std::array<float,2>{0.567687392f, 0.967132449f},
-std::array<float,2>{0.392840743f, 0.00901862979f},
-std::array<float,2>{0.530922234f, 0.259524286f},
-std::array<float,2>{0.463738054f, 0.551365495f},
-std::array<float,2>{0.897112072f, 0.779637039f},
-std::array<float,2>{0.154212877f, 0.130151749f},
-std::array<float,2>{0.836495638f, 0.110527024f},
-std::array<float,2>{0.0213423502f, 0.879079819f},
-std::array<float,2>{0.647699058f, 0.670167506f},
-std::array<float,2>{0.270498842f, 0.399017215f},
-std::array<float,2>{0.610820353f, 0.0484589823f},
-std::array<float,2>{0.437152743f, 0.990824223f},
-std::array<float,2>{0.9818995f, 0.718133986f},
-std::array<float,2>{0.232410893f, 0.459312946f},
-std::array<float,2>{0.774166286f, 0.365474582f},
-std::array<float,2>{0.0737361237f, 0.583183825f},
-std::array<float,2>{0.735194087f, 0.862695158f},
-std::array<float,2>{0.31473875f, 0.193604067f},
-std::array<float,2>{0.661912203f, 0.424153656f},
-std::array<float,2>{0.289567411f, 0.638990998f},
-std::array<float,2>{0.854404688f, 0.913633525f},
-std::array<float,2>{0.0498514958f, 0.0735445023f},
-std::array<float,2>{0.922568083f, 0.187396958f},
-std::array<float,2>{0.161068156f, 0.804088295f},
-std::array<float,2>{0.545196414f, 0.504444361f},
-std::array<float,2>{0.492469549f, 0.293863147f},
-std::array<float,2>{0.746437788f, 0.00344824698f},
-std::array<float,2>{0.32441628f, 0.958671153f},
-std::array<float,2>{0.771557152f, 0.733624518f},
-std::array<float,2>{0.0639612302f, 0.492708802f},
-std::array<float,2>{0.969457984f, 0.320250422f},
-std::array<float,2>{0.221740693f, 0.595107138f},
-std::array<float,2>{0.624880493f, 0.822587967f},
-std::array<float,2>{0.427407533f, 0.223324418f},
-std::array<float,2>{0.531736791f, 0.392719656f},
-std::array<float,2>{0.489161372f, 0.656592131f},
-std::array<float,2>{0.93543148f, 0.883954406f},
-std::array<float,2>{0.169546664f, 0.124460161f},
-std::array<float,2>{0.848216176f, 0.13821955f},
-std::array<float,2>{0.0569801629f, 0.769947827f},
-std::array<float,2>{0.670004368f, 0.560367346f},
-std::array<float,2>{0.283450663f, 0.251902848f},
-std::array<float,2>{0.572244704f, 0.199915737f},
-std::array<float,2>{0.403996348f, 0.868304908f},
-std::array<float,2>{0.937808454f, 0.587367415f},
-std::array<float,2>{0.212336093f, 0.371621758f},
-std::array<float,2>{0.80805546f, 0.46141538f},
-std::array<float,2>{0.104321942f, 0.708783329f},
-std::array<float,2>{0.701070189f, 0.993731081f},
-std::array<float,2>{0.362774789f, 0.0573647134f},
-std::array<float,2>{0.65331918f, 0.284648299f},
-std::array<float,2>{0.280563951f, 0.511630177f},
-std::array<float,2>{0.832528472f, 0.811621964f},
-std::array<float,2>{0.0255546011f, 0.177336589f},
-std::array<float,2>{0.899624705f, 0.0659427643f},
-std::array<float,2>{0.141596496f, 0.917662263f},
-std::array<float,2>{0.517261505f, 0.629198372f},
-std::array<float,2>{0.460813999f, 0.432058364f},
-std::array<float,2>{0.675367892f, 0.159407601f},
-std::array<float,2>{0.301158369f, 0.781475842f},
-std::array<float,2>{0.860251963f, 0.523925424f},
-std::array<float,2>{0.041446086f, 0.307210654f},
-std::array<float,2>{0.914164305f, 0.411545545f},
-std::array<float,2>{0.172698155f, 0.64595443f},
-std::array<float,2>{0.55602181f, 0.924588621f},
-std::array<float,2>{0.473019391f, 0.090791367f},
-std::array<float,2>{0.600779712f, 0.353158921f},
-std::array<float,2>{0.407017738f, 0.575296104f},
-std::array<float,2>{0.991004109f, 0.846754372f},
-std::array<float,2>{0.244810075f, 0.204538241f},
-std::array<float,2>{0.760707855f, 0.0412467234f},
-std::array<float,2>{0.090871729f, 0.97122997f},
-std::array<float,2>{0.728328884f, 0.695952594f},
-std::array<float,2>{0.329511672f, 0.450664133f},
-std::array<float,2>{0.504625738f, 0.099858731f},
-std::array<float,2>{0.440477818f, 0.89542675f},
-std::array<float,2>{0.885062754f, 0.685432792f},
-std::array<float,2>{0.126023591f, 0.386684179f},
-std::array<float,2>{0.820447206f, 0.271668047f},
-std::array<float,2>{0.005643968f, 0.535102725f},
-std::array<float,2>{0.630666614f, 0.751647055f},
-std::array<float,2>{0.254874617f, 0.152272269f},
-std::array<float,2>{0.718329966f, 0.484228939f},
-std::array<float,2>{0.348593146f, 0.74234736f},
-std::array<float,2>{0.786515534f, 0.952312469f},
-std::array<float,2>{0.113911547f, 0.0243018419f},
-std::array<float,2>{0.953798294f, 0.236774012f},
-std::array<float,2>{0.193504393f, 0.841676533f},
-std::array<float,2>{0.580896795f, 0.615073562f},
-std::array<float,2>{0.386873782f, 0.329868108f},
-std::array<float,2>{0.707135797f, 0.117998481f},
-std::array<float,2>{0.355293006f, 0.889014065f},
-std::array<float,2>{0.794750214f, 0.663897574f},
-std::array<float,2>{0.118661754f, 0.39741239f},
-std::array<float,2>{0.967917681f, 0.253914773f},
-std::array<float,2>{0.197492108f, 0.555924118f},
-std::array<float,2>{0.586853266f, 0.76617372f},
-std::array<float,2>{0.381065428f, 0.133222625f},
-std::array<float,2>{0.5134992f, 0.497639388f},
-std::array<float,2>{0.445721805f, 0.727064252f},
-std::array<float,2>{0.877927005f, 0.953604579f},
-std::array<float,2>{0.139078513f, 0.00674762251f},
-std::array<float,2>{0.816321015f, 0.220687926f},
-std::array<float,2>{0.0138699114f, 0.827805996f},
-std::array<float,2>{0.637640297f, 0.59995991f},
-std::array<float,2>{0.258611172f, 0.313042551f},
-std::array<float,2>{0.609133005f, 0.174883455f},
-std::array<float,2>{0.420316637f, 0.806293607f},
-std::array<float,2>{0.999642313f, 0.512968063f},
-std::array<float,2>{0.2355977f, 0.288649797f},
-std::array<float,2>{0.750680268f, 0.436794907f},
-std::array<float,2>{0.0812014788f, 0.625560462f},
-std::array<float,2>{0.722059608f, 0.919580519f},
-std::array<float,2>{0.337901711f, 0.069513455f},
-std::array<float,2>{0.684097767f, 0.369468838f},
-std::array<float,2>{0.309495896f, 0.592294037f},
-std::array<float,2>{0.874069154f, 0.873540938f},
-std::array<float,2>{0.0384253226f, 0.199198514f},
-std::array<float,2>{0.906552374f, 0.0624150261f},
-std::array<float,2>{0.186561212f, 0.996927202f},
-std::array<float,2>{0.547042012f, 0.706682861f},
-std::array<float,2>{0.47990948f, 0.466639608f},
-std::array<float,2>{0.643053353f, 0.210268199f},
-std::array<float,2>{0.268383265f, 0.850775361f},
-std::array<float,2>{0.843012989f, 0.571633875f},
-std::array<float,2>{0.0158205628f, 0.35935244f},
-std::array<float,2>{0.891523838f, 0.446205437f},
-std::array<float,2>{0.149171621f, 0.699581027f},
-std::array<float,2>{0.525284827f, 0.973861396f},
-std::array<float,2>{0.467677891f, 0.0429887958f},
-std::array<float,2>{0.563288391f, 0.309627503f},
-std::array<float,2>{0.396101713f, 0.530194223f},
-std::array<float,2>{0.946081877f, 0.785407603f},
-std::array<float,2>{0.205681518f, 0.161751851f},
-std::array<float,2>{0.800639689f, 0.0890474245f},
-std::array<float,2>{0.0960505456f, 0.927753747f},
-std::array<float,2>{0.68865484f, 0.644147158f},
-std::array<float,2>{0.372888774f, 0.410002172f},
-std::array<float,2>{0.542022586f, 0.0309871025f},
-std::array<float,2>{0.496977717f, 0.946249485f},
-std::array<float,2>{0.928593993f, 0.749094248f},
-std::array<float,2>{0.159962401f, 0.477671415f},
-std::array<float,2>{0.858598828f, 0.335501403f},
-std::array<float,2>{0.0530128516f, 0.611497581f},
-std::array<float,2>{0.656264961f, 0.836878896f},
-std::array<float,2>{0.293292969f, 0.240973145f},
-std::array<float,2>{0.738931298f, 0.390009493f},
-std::array<float,2>{0.320181042f, 0.683388591f},
-std::array<float,2>{0.78018415f, 0.893578291f},
-std::array<float,2>{0.0751236528f, 0.0970811769f},
-std::array<float,2>{0.97700125f, 0.153846398f},
-std::array<float,2>{0.22984004f, 0.756924808f},
-std::array<float,2>{0.616311729f, 0.535218716f},
-std::array<float,2>{0.432129323f, 0.266333818f},
-std::array<float,2>{0.665411174f, 0.0324992016f},
-std::array<float,2>{0.286261708f, 0.977810264f},
-std::array<float,2>{0.845425606f, 0.690693259f},
-std::array<float,2>{0.0590206124f, 0.442687184f},
-std::array<float,2>{0.931398749f, 0.346495271f},
-std::array<float,2>{0.166262358f, 0.564540565f},
-std::array<float,2>{0.536808074f, 0.85680902f},
-std::array<float,2>{0.487700164f, 0.214742422f},
-std::array<float,2>{0.617892087f, 0.415305853f},
-std::array<float,2>{0.424911529f, 0.65056926f},
-std::array<float,2>{0.973123431f, 0.93343097f},
-std::array<float,2>{0.225599974f, 0.078480266f},
-std::array<float,2>{0.766643822f, 0.165408f},
-std::array<float,2>{0.0666035041f, 0.791884542f},
-std::array<float,2>{0.745347321f, 0.517525196f},
-std::array<float,2>{0.323057234f, 0.302955866f},
-std::array<float,2>{0.522824824f, 0.246715382f},
-std::array<float,2>{0.455983043f, 0.833979666f},
-std::array<float,2>{0.903472424f, 0.620818019f},
-std::array<float,2>{0.146325216f, 0.339670062f},
-std::array<float,2>{0.82852143f, 0.475745887f},
-std::array<float,2>{0.0275608655f, 0.735186338f},
-std::array<float,2>{0.652317107f, 0.94006294f},
-std::array<float,2>{0.277284533f, 0.0231646504f},
-std::array<float,2>{0.697605312f, 0.275726914f},
-std::array<float,2>{0.36366719f, 0.541662812f},
-std::array<float,2>{0.809135556f, 0.758076429f},
-std::array<float,2>{0.108849503f, 0.143883139f},
-std::array<float,2>{0.94392854f, 0.108119264f},
-std::array<float,2>{0.217865095f, 0.903945506f},
-std::array<float,2>{0.577723145f, 0.673188865f},
-std::array<float,2>{0.398861468f, 0.381647497f},
-std::array<float,2>{0.731031895f, 0.125846088f},
-std::array<float,2>{0.333287835f, 0.777322233f},
-std::array<float,2>{0.763091385f, 0.547014058f},
-std::array<float,2>{0.086448282f, 0.265071362f},
-std::array<float,2>{0.987810016f, 0.405984968f},
-std::array<float,2>{0.247510046f, 0.665320456f},
-std::array<float,2>{0.597381115f, 0.876709163f},
-std::array<float,2>{0.413820744f, 0.11330422f},
-std::array<float,2>{0.561181188f, 0.327718019f},
-std::array<float,2>{0.4689821f, 0.607602417f},
-std::array<float,2>{0.918302417f, 0.820310414f},
-std::array<float,2>{0.176233754f, 0.229543656f},
-std::array<float,2>{0.865807831f, 0.0148185482f},
-std::array<float,2>{0.0439006016f, 0.962254763f},
-std::array<float,2>{0.675887525f, 0.723922968f},
-std::array<float,2>{0.3001149f, 0.489911795f},
-std::array<float,2>{0.583825111f, 0.0745865256f},
-std::array<float,2>{0.383309752f, 0.909102142f},
-std::array<float,2>{0.957884669f, 0.635170341f},
-std::array<float,2>{0.191152126f, 0.42859301f},
-std::array<float,2>{0.782014787f, 0.289505035f},
-std::array<float,2>{0.110114992f, 0.50075233f},
-std::array<float,2>{0.714200914f, 0.79842025f},
-std::array<float,2>{0.346484512f, 0.183407858f},
-std::array<float,2>{0.625038981f, 0.45605132f},
-std::array<float,2>{0.25156644f, 0.712973297f},
-std::array<float,2>{0.82500577f, 0.987112403f},
-std::array<float,2>{0.000310351432f, 0.0537201427f},
-std::array<float,2>{0.890406132f, 0.191172123f},
-std::array<float,2>{0.131000206f, 0.864762008f},
-std::array<float,2>{0.501387358f, 0.578364849f},
-std::array<float,2>{0.441457629f, 0.361141264f},
-std::array<float,2>{0.682731211f, 0.105265267f},
-std::array<float,2>{0.30474776f, 0.902137697f},
-std::array<float,2>{0.867775559f, 0.677647591f},
-std::array<float,2>{0.032172028f, 0.376819104f},
-std::array<float,2>{0.910741448f, 0.280791909f},
-std::array<float,2>{0.183008656f, 0.544013083f},
-std::array<float,2>{0.553702831f, 0.762712479f},
-std::array<float,2>{0.483197987f, 0.145765126f},
-std::array<float,2>{0.6026209f, 0.471069723f},
-std::array<float,2>{0.415131241f, 0.739781499f},
-std::array<float,2>{0.993476987f, 0.944871306f},
-std::array<float,2>{0.241105318f, 0.0158209428f},
-std::array<float,2>{0.755529761f, 0.245372042f},
-std::array<float,2>{0.0844437033f, 0.828510106f},
-std::array<float,2>{0.723131478f, 0.621418893f},
-std::array<float,2>{0.34282586f, 0.343308121f},
-std::array<float,2>{0.50932461f, 0.16971378f},
-std::array<float,2>{0.452581316f, 0.794450581f},
-std::array<float,2>{0.881874919f, 0.520876467f},
-std::array<float,2>{0.135720551f, 0.296930909f},
-std::array<float,2>{0.819367826f, 0.41958791f},
-std::array<float,2>{0.00968949683f, 0.654508054f},
-std::array<float,2>{0.635640442f, 0.935173213f},
-std::array<float,2>{0.265088499f, 0.082101956f},
-std::array<float,2>{0.706848979f, 0.349682808f},
-std::array<float,2>{0.356729478f, 0.568745553f},
-std::array<float,2>{0.791249096f, 0.855349481f},
-std::array<float,2>{0.12320888f, 0.218107671f},
-std::array<float,2>{0.964523494f, 0.0367664583f},
-std::array<float,2>{0.199709073f, 0.982204497f},
-std::array<float,2>{0.59268266f, 0.692274928f},
-std::array<float,2>{0.375960648f, 0.440700144f},
-std::array<float,2>{0.737045944f, 0.191799298f},
-std::array<float,2>{0.314098328f, 0.861182272f},
-std::array<float,2>{0.777318299f, 0.584359348f},
-std::array<float,2>{0.0715652257f, 0.363566875f},
-std::array<float,2>{0.983621359f, 0.458353251f},
-std::array<float,2>{0.233946145f, 0.715251982f},
-std::array<float,2>{0.612104714f, 0.989019156f},
-std::array<float,2>{0.434266955f, 0.0496890955f},
-std::array<float,2>{0.543544292f, 0.295134157f},
-std::array<float,2>{0.495060802f, 0.506360412f},
-std::array<float,2>{0.92466408f, 0.801926911f},
-std::array<float,2>{0.163547859f, 0.185308695f},
-std::array<float,2>{0.852455616f, 0.0707840472f},
-std::array<float,2>{0.0482012033f, 0.911493957f},
-std::array<float,2>{0.66277802f, 0.638405263f},
-std::array<float,2>{0.292765498f, 0.42326659f},
-std::array<float,2>{0.568643808f, 0.0104661426f},
-std::array<float,2>{0.392304987f, 0.966519773f},
-std::array<float,2>{0.949327588f, 0.722550213f},
-std::array<float,2>{0.207911432f, 0.48563987f},
-std::array<float,2>{0.802747786f, 0.32234779f},
-std::array<float,2>{0.0988494307f, 0.604790568f},
-std::array<float,2>{0.692623138f, 0.815958381f},
-std::array<float,2>{0.368637055f, 0.232042745f},
-std::array<float,2>{0.645425797f, 0.402079582f},
-std::array<float,2>{0.272089928f, 0.669754028f},
-std::array<float,2>{0.839045048f, 0.881948471f},
-std::array<float,2>{0.0232822914f, 0.112927698f},
-std::array<float,2>{0.896122873f, 0.131062835f},
-std::array<float,2>{0.156143978f, 0.777481973f},
-std::array<float,2>{0.528352141f, 0.553331852f},
-std::array<float,2>{0.461503863f, 0.261010319f},
-std::array<float,2>{0.703070045f, 0.0557919182f},
-std::array<float,2>{0.360399097f, 0.994956434f},
-std::array<float,2>{0.805484533f, 0.709209383f},
-std::array<float,2>{0.103383102f, 0.463334888f},
-std::array<float,2>{0.941119611f, 0.374706954f},
-std::array<float,2>{0.213471904f, 0.589784503f},
-std::array<float,2>{0.573053777f, 0.870326459f},
-std::array<float,2>{0.406235337f, 0.201682866f},
-std::array<float,2>{0.518482327f, 0.43157351f},
-std::array<float,2>{0.458500057f, 0.632064641f},
-std::array<float,2>{0.901562274f, 0.914653599f},
-std::array<float,2>{0.142790407f, 0.0636043027f},
-std::array<float,2>{0.83584553f, 0.178486913f},
-std::array<float,2>{0.0239623934f, 0.80939877f},
-std::array<float,2>{0.655285835f, 0.508435965f},
-std::array<float,2>{0.2779513f, 0.283075392f},
-std::array<float,2>{0.622807026f, 0.224962249f},
-std::array<float,2>{0.428286105f, 0.820915878f},
-std::array<float,2>{0.970861077f, 0.596842587f},
-std::array<float,2>{0.220085129f, 0.317382485f},
-std::array<float,2>{0.770380139f, 0.495746642f},
-std::array<float,2>{0.0651731119f, 0.730629861f},
-std::array<float,2>{0.749240935f, 0.960034013f},
-std::array<float,2>{0.327605635f, 0.000827034819f},
-std::array<float,2>{0.669796944f, 0.252215922f},
-std::array<float,2>{0.281968147f, 0.562207878f},
-std::array<float,2>{0.849979103f, 0.772387564f},
-std::array<float,2>{0.0555917509f, 0.1393888f},
-std::array<float,2>{0.936897397f, 0.122017622f},
-std::array<float,2>{0.171130851f, 0.886318564f},
-std::array<float,2>{0.533765018f, 0.658513367f},
-std::array<float,2>{0.490298301f, 0.390804231f},
-std::array<float,2>{0.631082356f, 0.150261953f},
-std::array<float,2>{0.257348895f, 0.753605962f},
-std::array<float,2>{0.824104667f, 0.532252192f},
-std::array<float,2>{0.00648697466f, 0.271180809f},
-std::array<float,2>{0.884609342f, 0.384332627f},
-std::array<float,2>{0.127632648f, 0.686233521f},
-std::array<float,2>{0.506065249f, 0.898190975f},
-std::array<float,2>{0.439319015f, 0.0994413495f},
-std::array<float,2>{0.578835011f, 0.33174789f},
-std::array<float,2>{0.390043885f, 0.616357565f},
-std::array<float,2>{0.955579937f, 0.842317641f},
-std::array<float,2>{0.19330354f, 0.235579416f},
-std::array<float,2>{0.788797736f, 0.0263454709f},
-std::array<float,2>{0.116723329f, 0.950095057f},
-std::array<float,2>{0.716641843f, 0.745252609f},
-std::array<float,2>{0.350390971f, 0.4812451f},
-std::array<float,2>{0.557069778f, 0.0931989029f},
-std::array<float,2>{0.474667519f, 0.92287159f},
-std::array<float,2>{0.917644858f, 0.646522939f},
-std::array<float,2>{0.17417419f, 0.413294375f},
-std::array<float,2>{0.861950397f, 0.305365771f},
-std::array<float,2>{0.0390908532f, 0.526297987f},
-std::array<float,2>{0.672826052f, 0.783393145f},
-std::array<float,2>{0.304244041f, 0.156448126f},
-std::array<float,2>{0.729104578f, 0.452661216f},
-std::array<float,2>{0.331235915f, 0.697955191f},
-std::array<float,2>{0.758467555f, 0.969113469f},
-std::array<float,2>{0.0933010653f, 0.0408945456f},
-std::array<float,2>{0.98903805f, 0.205188736f},
-std::array<float,2>{0.243252262f, 0.844159544f},
-std::array<float,2>{0.597885311f, 0.577081621f},
-std::array<float,2>{0.409446657f, 0.355365574f},
-std::array<float,2>{0.719498634f, 0.0665641949f},
-std::array<float,2>{0.337404251f, 0.921631992f},
-std::array<float,2>{0.752824247f, 0.627742708f},
-std::array<float,2>{0.0800686404f, 0.434340328f},
-std::array<float,2>{0.99755156f, 0.286853373f},
-std::array<float,2>{0.236729696f, 0.51377517f},
-std::array<float,2>{0.605506361f, 0.807021141f},
-std::array<float,2>{0.41851595f, 0.17215386f},
-std::array<float,2>{0.548954546f, 0.468382627f},
-std::array<float,2>{0.478043348f, 0.704811037f},
-std::array<float,2>{0.909666955f, 0.998310447f},
-std::array<float,2>{0.18530798f, 0.060301993f},
-std::array<float,2>{0.871127248f, 0.19577089f},
-std::array<float,2>{0.0363611802f, 0.871227145f},
-std::array<float,2>{0.685660958f, 0.590356588f},
-std::array<float,2>{0.311072052f, 0.368552446f},
-std::array<float,2>{0.589648604f, 0.135410771f},
-std::array<float,2>{0.37903744f, 0.768256724f},
-std::array<float,2>{0.965151787f, 0.557936907f},
-std::array<float,2>{0.195451483f, 0.256113052f},
-std::array<float,2>{0.795042932f, 0.395848662f},
-std::array<float,2>{0.11948435f, 0.660196245f},
-std::array<float,2>{0.709852874f, 0.88700521f},
-std::array<float,2>{0.35261783f, 0.12041273f},
-std::array<float,2>{0.639832258f, 0.315887153f},
-std::array<float,2>{0.261699378f, 0.598055005f},
-std::array<float,2>{0.814429879f, 0.826020122f},
-std::array<float,2>{0.0136694601f, 0.222544134f},
-std::array<float,2>{0.875695705f, 0.00478237774f},
-std::array<float,2>{0.138185143f, 0.955476284f},
-std::array<float,2>{0.513700426f, 0.729615331f},
-std::array<float,2>{0.448950648f, 0.498133868f},
-std::array<float,2>{0.659122169f, 0.239049152f},
-std::array<float,2>{0.2962071f, 0.838528156f},
-std::array<float,2>{0.857302964f, 0.61121285f},
-std::array<float,2>{0.0508947819f, 0.333914965f},
-std::array<float,2>{0.927499473f, 0.478990585f},
-std::array<float,2>{0.157177716f, 0.746972799f},
-std::array<float,2>{0.539881468f, 0.948887169f},
-std::array<float,2>{0.499369115f, 0.027844511f},
-std::array<float,2>{0.614373147f, 0.26906991f},
-std::array<float,2>{0.431301534f, 0.538735688f},
-std::array<float,2>{0.97969538f, 0.755410254f},
-std::array<float,2>{0.228490278f, 0.154369056f},
-std::array<float,2>{0.777946472f, 0.095329456f},
-std::array<float,2>{0.0775313303f, 0.890704691f},
-std::array<float,2>{0.741117835f, 0.680711091f},
-std::array<float,2>{0.317534208f, 0.386840373f},
-std::array<float,2>{0.525432467f, 0.045446068f},
-std::array<float,2>{0.466778994f, 0.97588855f},
-std::array<float,2>{0.894420207f, 0.702581704f},
-std::array<float,2>{0.151493892f, 0.447943062f},
-std::array<float,2>{0.84045428f, 0.357375383f},
-std::array<float,2>{0.0176624693f, 0.57276237f},
-std::array<float,2>{0.640714586f, 0.847679853f},
-std::array<float,2>{0.265933931f, 0.208100989f},
-std::array<float,2>{0.690298557f, 0.406515986f},
-std::array<float,2>{0.373464346f, 0.641820133f},
-std::array<float,2>{0.797193587f, 0.927318037f},
-std::array<float,2>{0.0950096101f, 0.08612293f},
-std::array<float,2>{0.948864758f, 0.16223444f},
-std::array<float,2>{0.203392997f, 0.788254499f},
-std::array<float,2>{0.56524682f, 0.529055715f},
-std::array<float,2>{0.397768855f, 0.312326849f},
-std::array<float,2>{0.649835467f, 0.0200187657f},
-std::array<float,2>{0.274064273f, 0.937687814f},
-std::array<float,2>{0.831550419f, 0.737033427f},
-std::array<float,2>{0.0296144262f, 0.473276347f},
-std::array<float,2>{0.905120015f, 0.336225718f},
-std::array<float,2>{0.146692589f, 0.618519187f},
-std::array<float,2>{0.521324217f, 0.835671961f},
-std::array<float,2>{0.454751581f, 0.248783335f},
-std::array<float,2>{0.575375378f, 0.380323857f},
-std::array<float,2>{0.402294934f, 0.674636543f},
-std::array<float,2>{0.942393363f, 0.905839622f},
-std::array<float,2>{0.215263337f, 0.10689187f},
-std::array<float,2>{0.812025726f, 0.141767412f},
-std::array<float,2>{0.107091919f, 0.761634111f},
-std::array<float,2>{0.69674176f, 0.540731072f},
-std::array<float,2>{0.366768658f, 0.273564398f},
-std::array<float,2>{0.538686275f, 0.211718902f},
-std::array<float,2>{0.484593719f, 0.857468784f},
-std::array<float,2>{0.932223737f, 0.563807547f},
-std::array<float,2>{0.165177375f, 0.345616132f},
-std::array<float,2>{0.847050607f, 0.444647849f},
-std::array<float,2>{0.0606024936f, 0.688393295f},
-std::array<float,2>{0.666471004f, 0.980092168f},
-std::array<float,2>{0.287434548f, 0.0345961004f},
-std::array<float,2>{0.742558181f, 0.302608162f},
-std::array<float,2>{0.32126227f, 0.517663836f},
-std::array<float,2>{0.76782155f, 0.790359557f},
-std::array<float,2>{0.0683700666f, 0.166239023f},
-std::array<float,2>{0.97597611f, 0.0813976899f},
-std::array<float,2>{0.222978443f, 0.931168139f},
-std::array<float,2>{0.619378626f, 0.650258422f},
-std::array<float,2>{0.423690438f, 0.416113317f},
-std::array<float,2>{0.712116063f, 0.180602819f},
-std::array<float,2>{0.343947738f, 0.80036813f},
-std::array<float,2>{0.784133017f, 0.502031565f},
-std::array<float,2>{0.112353258f, 0.292737216f},
-std::array<float,2>{0.959452808f, 0.427690029f},
-std::array<float,2>{0.187693447f, 0.633778572f},
-std::array<float,2>{0.585854888f, 0.906420171f},
-std::array<float,2>{0.385758549f, 0.0772391036f},
-std::array<float,2>{0.503813446f, 0.3623842f},
-std::array<float,2>{0.44503212f, 0.581370592f},
-std::array<float,2>{0.887899518f, 0.866244256f},
-std::array<float,2>{0.129427552f, 0.188154876f},
-std::array<float,2>{0.827585101f, 0.0517116971f},
-std::array<float,2>{0.00261141756f, 0.984671235f},
-std::array<float,2>{0.628536642f, 0.711931884f},
-std::array<float,2>{0.253082424f, 0.453806847f},
-std::array<float,2>{0.594434619f, 0.115948133f},
-std::array<float,2>{0.41067791f, 0.878536701f},
-std::array<float,2>{0.986317873f, 0.666140974f},
-std::array<float,2>{0.248896465f, 0.4024207f},
-std::array<float,2>{0.764142513f, 0.263296306f},
-std::array<float,2>{0.0881841481f, 0.549762249f},
-std::array<float,2>{0.73346746f, 0.774640143f},
-std::array<float,2>{0.334683746f, 0.127912536f},
-std::array<float,2>{0.679476619f, 0.491993934f},
-std::array<float,2>{0.297004253f, 0.725006223f},
-std::array<float,2>{0.864326298f, 0.963161111f},
-std::array<float,2>{0.045209121f, 0.0125031695f},
-std::array<float,2>{0.921523333f, 0.227989838f},
-std::array<float,2>{0.179247066f, 0.816682577f},
-std::array<float,2>{0.559126258f, 0.606238365f},
-std::array<float,2>{0.472149193f, 0.325654089f},
-std::array<float,2>{0.647453904f, 0.111757182f},
-std::array<float,2>{0.271280378f, 0.881648004f},
-std::array<float,2>{0.837063849f, 0.668061793f},
-std::array<float,2>{0.0201765783f, 0.400730908f},
-std::array<float,2>{0.898215175f, 0.259774923f},
-std::array<float,2>{0.152459636f, 0.554088831f},
-std::array<float,2>{0.53018868f, 0.778544545f},
-std::array<float,2>{0.464627564f, 0.132699862f},
-std::array<float,2>{0.566960156f, 0.485191464f},
-std::array<float,2>{0.394376159f, 0.72146368f},
-std::array<float,2>{0.951254785f, 0.965705931f},
-std::array<float,2>{0.210011616f, 0.0114047797f},
-std::array<float,2>{0.801629305f, 0.23047097f},
-std::array<float,2>{0.101458944f, 0.814829826f},
-std::array<float,2>{0.694503963f, 0.603892326f},
-std::array<float,2>{0.370509058f, 0.323659748f},
-std::array<float,2>{0.546463907f, 0.184404582f},
-std::array<float,2>{0.493664861f, 0.801048756f},
-std::array<float,2>{0.923448026f, 0.507435441f},
-std::array<float,2>{0.161227286f, 0.29618296f},
-std::array<float,2>{0.854748607f, 0.421892852f},
-std::array<float,2>{0.0490845516f, 0.637237132f},
-std::array<float,2>{0.660776496f, 0.910595179f},
-std::array<float,2>{0.2909168f, 0.0716932863f},
-std::array<float,2>{0.736234963f, 0.364583403f},
-std::array<float,2>{0.316045851f, 0.585710227f},
-std::array<float,2>{0.775326967f, 0.859556794f},
-std::array<float,2>{0.0729294792f, 0.19285883f},
-std::array<float,2>{0.981198192f, 0.0504901819f},
-std::array<float,2>{0.231111497f, 0.989587605f},
-std::array<float,2>{0.610154152f, 0.716572762f},
-std::array<float,2>{0.435772121f, 0.457073361f},
-std::array<float,2>{0.704752684f, 0.217627048f},
-std::array<float,2>{0.35769856f, 0.854055524f},
-std::array<float,2>{0.789110124f, 0.569733262f},
-std::array<float,2>{0.121453404f, 0.350936443f},
-std::array<float,2>{0.962732315f, 0.43967253f},
-std::array<float,2>{0.201408669f, 0.693273365f},
-std::array<float,2>{0.590894043f, 0.981209397f},
-std::array<float,2>{0.378171116f, 0.0351641066f},
-std::array<float,2>{0.510279953f, 0.298819244f},
-std::array<float,2>{0.45108366f, 0.52049762f},
-std::array<float,2>{0.879242778f, 0.793895543f},
-std::array<float,2>{0.134196565f, 0.168834925f},
-std::array<float,2>{0.8166942f, 0.0835691243f},
-std::array<float,2>{0.0116970018f, 0.934256077f},
-std::array<float,2>{0.634033501f, 0.65542531f},
-std::array<float,2>{0.26350221f, 0.418558598f},
-std::array<float,2>{0.604467809f, 0.0172374975f},
-std::array<float,2>{0.416088253f, 0.944110751f},
-std::array<float,2>{0.994413078f, 0.738354623f},
-std::array<float,2>{0.239889771f, 0.471713871f},
-std::array<float,2>{0.75700444f, 0.342601985f},
-std::array<float,2>{0.0826280564f, 0.622314811f},
-std::array<float,2>{0.726309299f, 0.829406619f},
-std::array<float,2>{0.341714144f, 0.245020077f},
-std::array<float,2>{0.681397974f, 0.375123739f},
-std::array<float,2>{0.307935447f, 0.676614821f},
-std::array<float,2>{0.870826185f, 0.900970995f},
-std::array<float,2>{0.0343013331f, 0.103520788f},
-std::array<float,2>{0.91287303f, 0.145221204f},
-std::array<float,2>{0.180935919f, 0.761929035f},
-std::array<float,2>{0.551244557f, 0.54327929f},
-std::array<float,2>{0.480507761f, 0.280136675f},
-std::array<float,2>{0.727322221f, 0.0391212218f},
-std::array<float,2>{0.328745961f, 0.969943583f},
-std::array<float,2>{0.760866702f, 0.698598266f},
-std::array<float,2>{0.0903530642f, 0.451640338f},
-std::array<float,2>{0.992141664f, 0.353995115f},
-std::array<float,2>{0.245463625f, 0.577705562f},
-std::array<float,2>{0.600176215f, 0.844975293f},
-std::array<float,2>{0.407782435f, 0.206071362f},
-std::array<float,2>{0.555022597f, 0.412724167f},
-std::array<float,2>{0.473797172f, 0.648157954f},
-std::array<float,2>{0.915598989f, 0.922031105f},
-std::array<float,2>{0.173048213f, 0.0923584998f},
-std::array<float,2>{0.86083442f, 0.15725106f},
-std::array<float,2>{0.0425412431f, 0.784633219f},
-std::array<float,2>{0.674344063f, 0.526962042f},
-std::array<float,2>{0.302611202f, 0.306113273f},
-std::array<float,2>{0.581349015f, 0.235166654f},
-std::array<float,2>{0.387981027f, 0.842983127f},
-std::array<float,2>{0.955040693f, 0.615962267f},
-std::array<float,2>{0.195291772f, 0.330920577f},
-std::array<float,2>{0.785452306f, 0.482251465f},
-std::array<float,2>{0.114674345f, 0.744702101f},
-std::array<float,2>{0.717246294f, 0.950574219f},
-std::array<float,2>{0.34941116f, 0.0269967318f},
-std::array<float,2>{0.629203796f, 0.270480037f},
-std::array<float,2>{0.255819529f, 0.5321244f},
-std::array<float,2>{0.821326017f, 0.752202749f},
-std::array<float,2>{0.00431367243f, 0.148682788f},
-std::array<float,2>{0.885798037f, 0.0981984288f},
-std::array<float,2>{0.125054479f, 0.896661997f},
-std::array<float,2>{0.504914224f, 0.687347472f},
-std::array<float,2>{0.44032082f, 0.383200407f},
-std::array<float,2>{0.67131573f, 0.14034839f},
-std::array<float,2>{0.285037041f, 0.77308619f},
-std::array<float,2>{0.849275351f, 0.56054759f},
-std::array<float,2>{0.0585868396f, 0.25350365f},
-std::array<float,2>{0.933848143f, 0.391993433f},
-std::array<float,2>{0.16835016f, 0.659495652f},
-std::array<float,2>{0.532783508f, 0.885260999f},
-std::array<float,2>{0.490111232f, 0.122619055f},
-std::array<float,2>{0.623990059f, 0.318337679f},
-std::array<float,2>{0.426571816f, 0.59621495f},
-std::array<float,2>{0.970423758f, 0.822122812f},
-std::array<float,2>{0.221574351f, 0.225845709f},
-std::array<float,2>{0.773309827f, 0.00145749422f},
-std::array<float,2>{0.0632497072f, 0.959924936f},
-std::array<float,2>{0.747344673f, 0.732085109f},
-std::array<float,2>{0.325477749f, 0.494850576f},
-std::array<float,2>{0.515642166f, 0.0629996434f},
-std::array<float,2>{0.459203631f, 0.915689051f},
-std::array<float,2>{0.898556769f, 0.631739497f},
-std::array<float,2>{0.141790986f, 0.430467814f},
-std::array<float,2>{0.833645225f, 0.281963408f},
-std::array<float,2>{0.0265305284f, 0.509295523f},
-std::array<float,2>{0.65346396f, 0.809730828f},
-std::array<float,2>{0.279296935f, 0.179238603f},
-std::array<float,2>{0.699727178f, 0.464453042f},
-std::array<float,2>{0.362075359f, 0.710150957f},
-std::array<float,2>{0.806810915f, 0.99541384f},
-std::array<float,2>{0.105433464f, 0.0550629795f},
-std::array<float,2>{0.93939209f, 0.202407569f},
-std::array<float,2>{0.21098423f, 0.869892776f},
-std::array<float,2>{0.570717216f, 0.58823967f},
-std::array<float,2>{0.402597547f, 0.373239189f},
-std::array<float,2>{0.688272715f, 0.087725997f},
-std::array<float,2>{0.37198782f, 0.926527679f},
-std::array<float,2>{0.798975468f, 0.640813887f},
-std::array<float,2>{0.0973716602f, 0.407963753f},
-std::array<float,2>{0.947211087f, 0.31075424f},
-std::array<float,2>{0.206384629f, 0.527485847f},
-std::array<float,2>{0.564162612f, 0.787777483f},
-std::array<float,2>{0.394691914f, 0.163506284f},
-std::array<float,2>{0.524067163f, 0.448528826f},
-std::array<float,2>{0.467801571f, 0.701813817f},
-std::array<float,2>{0.892505407f, 0.975394547f},
-std::array<float,2>{0.150090456f, 0.0466945879f},
-std::array<float,2>{0.841902792f, 0.207432821f},
-std::array<float,2>{0.0170478337f, 0.849133909f},
-std::array<float,2>{0.643915236f, 0.573310852f},
-std::array<float,2>{0.268688321f, 0.356198102f},
-std::array<float,2>{0.615636766f, 0.155373648f},
-std::array<float,2>{0.432934195f, 0.753968835f},
-std::array<float,2>{0.978050292f, 0.538004696f},
-std::array<float,2>{0.229343981f, 0.267734021f},
-std::array<float,2>{0.781176567f, 0.387788564f},
-std::array<float,2>{0.0757542327f, 0.680346549f},
-std::array<float,2>{0.740213394f, 0.892336726f},
-std::array<float,2>{0.318383247f, 0.0944858342f},
-std::array<float,2>{0.658080995f, 0.332704693f},
-std::array<float,2>{0.293979168f, 0.609983563f},
-std::array<float,2>{0.857656956f, 0.839512646f},
-std::array<float,2>{0.0543811023f, 0.239327997f},
-std::array<float,2>{0.928846419f, 0.028372962f},
-std::array<float,2>{0.158268616f, 0.947784305f},
-std::array<float,2>{0.541953683f, 0.747846365f},
-std::array<float,2>{0.497899324f, 0.480194032f},
-std::array<float,2>{0.637964368f, 0.221490368f},
-std::array<float,2>{0.259751052f, 0.82452625f},
-std::array<float,2>{0.814964473f, 0.599394679f},
-std::array<float,2>{0.0151605643f, 0.314885467f},
-std::array<float,2>{0.878737628f, 0.499969006f},
-std::array<float,2>{0.140508905f, 0.728687763f},
-std::array<float,2>{0.512650311f, 0.956982613f},
-std::array<float,2>{0.446507394f, 0.00524207437f},
-std::array<float,2>{0.587632954f, 0.257202268f},
-std::array<float,2>{0.382199943f, 0.556795359f},
-std::array<float,2>{0.96727246f, 0.769418716f},
-std::array<float,2>{0.199147508f, 0.136548519f},
-std::array<float,2>{0.793608129f, 0.119947366f},
-std::array<float,2>{0.117612697f, 0.887972891f},
-std::array<float,2>{0.70867604f, 0.661263108f},
-std::array<float,2>{0.354227841f, 0.394932121f},
-std::array<float,2>{0.548547447f, 0.0586492047f},
-std::array<float,2>{0.478990078f, 0.999428213f},
-std::array<float,2>{0.907950222f, 0.703418553f},
-std::array<float,2>{0.185783342f, 0.467407018f},
-std::array<float,2>{0.873402119f, 0.367515892f},
-std::array<float,2>{0.0372298472f, 0.591053963f},
-std::array<float,2>{0.685097158f, 0.872472465f},
-std::array<float,2>{0.309737593f, 0.196833208f},
-std::array<float,2>{0.721305192f, 0.435255229f},
-std::array<float,2>{0.339785665f, 0.62860471f},
-std::array<float,2>{0.751917601f, 0.92004478f},
-std::array<float,2>{0.0805170611f, 0.0674227625f},
-std::array<float,2>{0.998768806f, 0.173502356f},
-std::array<float,2>{0.235052034f, 0.808367312f},
-std::array<float,2>{0.608149767f, 0.514781237f},
-std::array<float,2>{0.421135753f, 0.285265535f},
-std::array<float,2>{0.677675962f, 0.0130363218f},
-std::array<float,2>{0.299624622f, 0.964589655f},
-std::array<float,2>{0.866503239f, 0.725809753f},
-std::array<float,2>{0.0448287129f, 0.491076797f},
-std::array<float,2>{0.919532657f, 0.325059474f},
-std::array<float,2>{0.177121952f, 0.606696248f},
-std::array<float,2>{0.56175524f, 0.818092346f},
-std::array<float,2>{0.469755679f, 0.227070183f},
-std::array<float,2>{0.595900834f, 0.403335243f},
-std::array<float,2>{0.412274867f, 0.667568862f},
-std::array<float,2>{0.987039864f, 0.877739906f},
-std::array<float,2>{0.246896878f, 0.116773911f},
-std::array<float,2>{0.761850715f, 0.127938375f},
-std::array<float,2>{0.0878857151f, 0.773862004f},
-std::array<float,2>{0.73217231f, 0.550679266f},
-std::array<float,2>{0.332427084f, 0.262321502f},
-std::array<float,2>{0.500683784f, 0.18865864f},
-std::array<float,2>{0.442860156f, 0.86617744f},
-std::array<float,2>{0.888916075f, 0.580900788f},
-std::array<float,2>{0.132385626f, 0.36178869f},
-std::array<float,2>{0.825507045f, 0.454947084f},
-std::array<float,2>{0.00182058511f, 0.711901009f},
-std::array<float,2>{0.626256645f, 0.985891998f},
-std::array<float,2>{0.25050348f, 0.0527259856f},
-std::array<float,2>{0.713727534f, 0.291166127f},
-std::array<float,2>{0.347534806f, 0.503607929f},
-std::array<float,2>{0.782799065f, 0.799106538f},
-std::array<float,2>{0.111037172f, 0.181411132f},
-std::array<float,2>{0.958629251f, 0.0762638673f},
-std::array<float,2>{0.189905122f, 0.907803595f},
-std::array<float,2>{0.582095027f, 0.633880138f},
-std::array<float,2>{0.383809924f, 0.426620305f},
-std::array<float,2>{0.744198143f, 0.167144433f},
-std::array<float,2>{0.323950708f, 0.789522111f},
-std::array<float,2>{0.765674949f, 0.519017577f},
-std::array<float,2>{0.0676796064f, 0.301482081f},
-std::array<float,2>{0.974021852f, 0.417731166f},
-std::array<float,2>{0.224799484f, 0.648493707f},
-std::array<float,2>{0.618870437f, 0.930100083f},
-std::array<float,2>{0.424286187f, 0.0809526742f},
-std::array<float,2>{0.535338938f, 0.344215482f},
-std::array<float,2>{0.486393601f, 0.563128591f},
-std::array<float,2>{0.930189133f, 0.858912349f},
-std::array<float,2>{0.167305231f, 0.212623954f},
-std::array<float,2>{0.843771517f, 0.0334965624f},
-std::array<float,2>{0.060471788f, 0.979413509f},
-std::array<float,2>{0.664789379f, 0.688977003f},
-std::array<float,2>{0.285636812f, 0.443401188f},
-std::array<float,2>{0.576401055f, 0.105691426f},
-std::array<float,2>{0.40008539f, 0.905034184f},
-std::array<float,2>{0.944692433f, 0.675373197f},
-std::array<float,2>{0.217069075f, 0.379704535f},
-std::array<float,2>{0.809885323f, 0.274444878f},
-std::array<float,2>{0.108249471f, 0.53918165f},
-std::array<float,2>{0.698523104f, 0.760553956f},
-std::array<float,2>{0.364487499f, 0.141510665f},
-std::array<float,2>{0.651140749f, 0.474352509f},
-std::array<float,2>{0.275539875f, 0.737389505f},
-std::array<float,2>{0.829782665f, 0.939129651f},
-std::array<float,2>{0.029267f, 0.0212343596f},
-std::array<float,2>{0.90279609f, 0.249601305f},
-std::array<float,2>{0.145155713f, 0.834056139f},
-std::array<float,2>{0.52211827f, 0.618132293f},
-std::array<float,2>{0.456235766f, 0.337802768f},
-std::array<float,2>{0.663128257f, 0.0723788291f},
-std::array<float,2>{0.291564852f, 0.913033426f},
-std::array<float,2>{0.852829516f, 0.639918566f},
-std::array<float,2>{0.047400482f, 0.424968511f},
-std::array<float,2>{0.925737619f, 0.294526428f},
-std::array<float,2>{0.162220955f, 0.505176246f},
-std::array<float,2>{0.54478693f, 0.802970827f},
-std::array<float,2>{0.495314658f, 0.185824245f},
-std::array<float,2>{0.61298728f, 0.459986806f},
-std::array<float,2>{0.435159355f, 0.717098534f},
-std::array<float,2>{0.983194113f, 0.992101371f},
-std::array<float,2>{0.232902959f, 0.0476777367f},
-std::array<float,2>{0.776204288f, 0.195273027f},
-std::array<float,2>{0.0708104223f, 0.861920536f},
-std::array<float,2>{0.737635732f, 0.582639933f},
-std::array<float,2>{0.31281805f, 0.36625737f},
-std::array<float,2>{0.527531743f, 0.128988594f},
-std::array<float,2>{0.462888211f, 0.781127214f},
-std::array<float,2>{0.895356834f, 0.55235225f},
-std::array<float,2>{0.154712036f, 0.258438885f},
-std::array<float,2>{0.838646352f, 0.399637759f},
-std::array<float,2>{0.0220308006f, 0.671657264f},
-std::array<float,2>{0.645611227f, 0.879962206f},
-std::array<float,2>{0.273084402f, 0.110073924f},
-std::array<float,2>{0.692050457f, 0.321007609f},
-std::array<float,2>{0.368123859f, 0.602994859f},
-std::array<float,2>{0.804488122f, 0.8139925f},
-std::array<float,2>{0.0981566235f, 0.233958989f},
-std::array<float,2>{0.950586498f, 0.00842539873f},
-std::array<float,2>{0.20878683f, 0.968328953f},
-std::array<float,2>{0.569538176f, 0.719604313f},
-std::array<float,2>{0.391329706f, 0.486427248f},
-std::array<float,2>{0.724448442f, 0.242323801f},
-std::array<float,2>{0.342169195f, 0.831076205f},
-std::array<float,2>{0.754119873f, 0.624781847f},
-std::array<float,2>{0.085898459f, 0.341722876f},
-std::array<float,2>{0.992819011f, 0.468840569f},
-std::array<float,2>{0.241445109f, 0.741123259f},
-std::array<float,2>{0.602385879f, 0.943033576f},
-std::array<float,2>{0.414874554f, 0.0189458337f},
-std::array<float,2>{0.553786755f, 0.277420789f},
-std::array<float,2>{0.484302551f, 0.54587239f},
-std::array<float,2>{0.911297679f, 0.764161289f},
-std::array<float,2>{0.181667939f, 0.148219615f},
-std::array<float,2>{0.8690992f, 0.102913164f},
-std::array<float,2>{0.0329715908f, 0.900280416f},
-std::array<float,2>{0.682185411f, 0.678639114f},
-std::array<float,2>{0.30590409f, 0.377488464f},
-std::array<float,2>{0.593581855f, 0.037599057f},
-std::array<float,2>{0.376072317f, 0.983002841f},
-std::array<float,2>{0.963412881f, 0.693714976f},
-std::array<float,2>{0.200674832f, 0.437613219f},
-std::array<float,2>{0.792197645f, 0.348910004f},
-std::array<float,2>{0.124174349f, 0.568017066f},
-std::array<float,2>{0.705835581f, 0.853173852f},
-std::array<float,2>{0.356322438f, 0.215614125f},
-std::array<float,2>{0.636197567f, 0.421007276f},
-std::array<float,2>{0.264022857f, 0.653302133f},
-std::array<float,2>{0.819155633f, 0.935703278f},
-std::array<float,2>{0.00819177553f, 0.0840057656f},
-std::array<float,2>{0.881085277f, 0.170526728f},
-std::array<float,2>{0.135749876f, 0.795931935f},
-std::array<float,2>{0.508724272f, 0.521852314f},
-std::array<float,2>{0.452032894f, 0.299015373f},
-std::array<float,2>{0.715718806f, 0.024998527f},
-std::array<float,2>{0.350604415f, 0.951719642f},
-std::array<float,2>{0.788003504f, 0.743439734f},
-std::array<float,2>{0.115401f, 0.482444704f},
-std::array<float,2>{0.956887186f, 0.329039872f},
-std::array<float,2>{0.192070737f, 0.613924623f},
-std::array<float,2>{0.579209864f, 0.839864552f},
-std::array<float,2>{0.389316112f, 0.238131449f},
-std::array<float,2>{0.507493734f, 0.384928644f},
-std::array<float,2>{0.437828213f, 0.68391031f},
-std::array<float,2>{0.883315742f, 0.896472752f},
-std::array<float,2>{0.128419518f, 0.101163611f},
-std::array<float,2>{0.822373033f, 0.150490552f},
-std::array<float,2>{0.00746233249f, 0.75035423f},
-std::array<float,2>{0.632142007f, 0.533266604f},
-std::array<float,2>{0.256203175f, 0.27331087f},
-std::array<float,2>{0.59916091f, 0.20331198f},
-std::array<float,2>{0.408260107f, 0.846561491f},
-std::array<float,2>{0.989432931f, 0.575028718f},
-std::array<float,2>{0.242579952f, 0.351929218f},
-std::array<float,2>{0.759181321f, 0.449617147f},
-std::array<float,2>{0.0922331437f, 0.696858168f},
-std::array<float,2>{0.729882538f, 0.972179711f},
-std::array<float,2>{0.330906361f, 0.0428799354f},
-std::array<float,2>{0.673722804f, 0.308592886f},
-std::array<float,2>{0.302959383f, 0.525158346f},
-std::array<float,2>{0.862643957f, 0.782476962f},
-std::array<float,2>{0.040654093f, 0.158739179f},
-std::array<float,2>{0.916973054f, 0.0917275846f},
-std::array<float,2>{0.175465688f, 0.92516011f},
-std::array<float,2>{0.557864964f, 0.644583106f},
-std::array<float,2>{0.476332426f, 0.410191387f},
-std::array<float,2>{0.65457654f, 0.176064014f},
-std::array<float,2>{0.278902352f, 0.811497331f},
-std::array<float,2>{0.83398962f, 0.510596156f},
-std::array<float,2>{0.024445286f, 0.28382802f},
-std::array<float,2>{0.901259422f, 0.433375537f},
-std::array<float,2>{0.143968523f, 0.6307832f},
-std::array<float,2>{0.518572927f, 0.916804016f},
-std::array<float,2>{0.457067102f, 0.064714998f},
-std::array<float,2>{0.573475242f, 0.37244904f},
-std::array<float,2>{0.404961944f, 0.586179733f},
-std::array<float,2>{0.939774573f, 0.867337704f},
-std::array<float,2>{0.214457124f, 0.200778291f},
-std::array<float,2>{0.806561112f, 0.0579187647f},
-std::array<float,2>{0.102112122f, 0.992618442f},
-std::array<float,2>{0.702042699f, 0.707054734f},
-std::array<float,2>{0.359965056f, 0.462561309f},
-std::array<float,2>{0.534702182f, 0.123534866f},
-std::array<float,2>{0.491851866f, 0.88292259f},
-std::array<float,2>{0.93570596f, 0.658184171f},
-std::array<float,2>{0.170615554f, 0.394474417f},
-std::array<float,2>{0.850616515f, 0.250101864f},
-std::array<float,2>{0.0563790724f, 0.558704138f},
-std::array<float,2>{0.668890297f, 0.771070123f},
-std::array<float,2>{0.282310158f, 0.137382716f},
-std::array<float,2>{0.748230398f, 0.493388206f},
-std::array<float,2>{0.326765239f, 0.733062804f},
-std::array<float,2>{0.771231532f, 0.957559526f},
-std::array<float,2>{0.0659788623f, 0.00239429693f},
-std::array<float,2>{0.972445011f, 0.224166453f},
-std::array<float,2>{0.219359666f, 0.823318839f},
-std::array<float,2>{0.621811986f, 0.593980312f},
-std::array<float,2>{0.429490745f, 0.318570465f},
-std::array<float,2>{0.741762757f, 0.0963670462f},
-std::array<float,2>{0.316999942f, 0.893030405f},
-std::array<float,2>{0.779088318f, 0.681937158f},
-std::array<float,2>{0.076675877f, 0.388695151f},
-std::array<float,2>{0.978804648f, 0.266907215f},
-std::array<float,2>{0.226985544f, 0.536493123f},
-std::array<float,2>{0.613561332f, 0.756583154f},
-std::array<float,2>{0.430113494f, 0.152600423f},
-std::array<float,2>{0.540745616f, 0.47744897f},
-std::array<float,2>{0.498987466f, 0.748553932f},
-std::array<float,2>{0.925960481f, 0.946492374f},
-std::array<float,2>{0.157807425f, 0.0293318331f},
-std::array<float,2>{0.856320024f, 0.241917193f},
-std::array<float,2>{0.0521178134f, 0.837741196f},
-std::array<float,2>{0.659605265f, 0.612750888f},
-std::array<float,2>{0.295790941f, 0.334365934f},
-std::array<float,2>{0.565553129f, 0.160846964f},
-std::array<float,2>{0.396567553f, 0.786940396f},
-std::array<float,2>{0.948120475f, 0.530564845f},
-std::array<float,2>{0.204189971f, 0.30896759f},
-std::array<float,2>{0.797969103f, 0.408717483f},
-std::array<float,2>{0.0938070565f, 0.642795503f},
-std::array<float,2>{0.691137135f, 0.929646671f},
-std::array<float,2>{0.37454173f, 0.0881653205f},
-std::array<float,2>{0.642369866f, 0.357648641f},
-std::array<float,2>{0.267085671f, 0.570886433f},
-std::array<float,2>{0.841565251f, 0.850070417f},
-std::array<float,2>{0.0191100556f, 0.209639519f},
-std::array<float,2>{0.893221259f, 0.0448371731f},
-std::array<float,2>{0.151213586f, 0.9734568f},
-std::array<float,2>{0.526749492f, 0.700628579f},
-std::array<float,2>{0.465363264f, 0.446316302f},
-std::array<float,2>{0.687226653f, 0.197334155f},
-std::array<float,2>{0.31181854f, 0.874948144f},
-std::array<float,2>{0.872076035f, 0.593094647f},
-std::array<float,2>{0.0361132324f, 0.370300412f},
-std::array<float,2>{0.908835828f, 0.465631276f},
-std::array<float,2>{0.184019059f, 0.70533967f},
-std::array<float,2>{0.550706744f, 0.997400224f},
-std::array<float,2>{0.477273703f, 0.0606825836f},
-std::array<float,2>{0.606550157f, 0.287281126f},
-std::array<float,2>{0.419441462f, 0.511770546f},
-std::array<float,2>{0.996754587f, 0.805585027f},
-std::array<float,2>{0.237911716f, 0.174507216f},
-std::array<float,2>{0.75372237f, 0.0689901561f},
-std::array<float,2>{0.0785954148f, 0.918419242f},
-std::array<float,2>{0.719793975f, 0.626086354f},
-std::array<float,2>{0.3362647f, 0.43586877f},
-std::array<float,2>{0.514877796f, 0.00718582748f},
-std::array<float,2>{0.447862059f, 0.954309583f},
-std::array<float,2>{0.876513422f, 0.728255808f},
-std::array<float,2>{0.137018234f, 0.496682942f},
-std::array<float,2>{0.81330049f, 0.313843071f},
-std::array<float,2>{0.0117446687f, 0.601473868f},
-std::array<float,2>{0.638712466f, 0.8268466f},
-std::array<float,2>{0.26059407f, 0.21885252f},
-std::array<float,2>{0.710890055f, 0.398062915f},
-std::array<float,2>{0.351869315f, 0.662172198f},
-std::array<float,2>{0.796764076f, 0.889981985f},
-std::array<float,2>{0.120959021f, 0.118733302f},
-std::array<float,2>{0.965903223f, 0.133829623f},
-std::array<float,2>{0.19680506f, 0.766759753f},
-std::array<float,2>{0.588091254f, 0.555253506f},
-std::array<float,2>{0.380438596f, 0.255759507f},
-std::array<float,2>{0.627263606f, 0.0535388365f},
-std::array<float,2>{0.252402902f, 0.98795104f},
-std::array<float,2>{0.826246321f, 0.714173555f},
-std::array<float,2>{0.00346804969f, 0.456550568f},
-std::array<float,2>{0.887188256f, 0.35983479f},
-std::array<float,2>{0.130277455f, 0.579409659f},
-std::array<float,2>{0.502402663f, 0.86392796f},
-std::array<float,2>{0.443407714f, 0.189977288f},
-std::array<float,2>{0.584799349f, 0.429301143f},
-std::array<float,2>{0.385233939f, 0.635783136f},
-std::array<float,2>{0.96025914f, 0.909296095f},
-std::array<float,2>{0.188655064f, 0.075983867f},
-std::array<float,2>{0.784556031f, 0.182360113f},
-std::array<float,2>{0.112007149f, 0.797147751f},
-std::array<float,2>{0.710987568f, 0.501014829f},
-std::array<float,2>{0.345441997f, 0.290684581f},
-std::array<float,2>{0.559776247f, 0.22862193f},
-std::array<float,2>{0.471384883f, 0.818758786f},
-std::array<float,2>{0.920255542f, 0.608401656f},
-std::array<float,2>{0.178238064f, 0.326500654f},
-std::array<float,2>{0.863847494f, 0.488343954f},
-std::array<float,2>{0.0467649885f, 0.723531604f},
-std::array<float,2>{0.67816776f, 0.961006343f},
-std::array<float,2>{0.298774779f, 0.0142773138f},
-std::array<float,2>{0.733048379f, 0.264322519f},
-std::array<float,2>{0.335590273f, 0.547902763f},
-std::array<float,2>{0.765464067f, 0.775990784f},
-std::array<float,2>{0.089408882f, 0.126886413f},
-std::array<float,2>{0.984796286f, 0.114485666f},
-std::array<float,2>{0.249306306f, 0.875469625f},
-std::array<float,2>{0.595305741f, 0.664610088f},
-std::array<float,2>{0.411505222f, 0.405179113f},
-std::array<float,2>{0.696216464f, 0.1435121f},
-std::array<float,2>{0.365782678f, 0.759021878f},
-std::array<float,2>{0.810870409f, 0.542255342f},
-std::array<float,2>{0.106317751f, 0.276864916f},
-std::array<float,2>{0.941781223f, 0.382253796f},
-std::array<float,2>{0.216608047f, 0.672363341f},
-std::array<float,2>{0.574853361f, 0.902838588f},
-std::array<float,2>{0.400818616f, 0.109077029f},
-std::array<float,2>{0.52032119f, 0.337934077f},
-std::array<float,2>{0.453931987f, 0.61978668f},
-std::array<float,2>{0.905655742f, 0.832558692f},
-std::array<float,2>{0.147984505f, 0.247414246f},
-std::array<float,2>{0.830152214f, 0.022442108f},
-std::array<float,2>{0.0305833109f, 0.94138366f},
-std::array<float,2>{0.648585856f, 0.736290693f},
-std::array<float,2>{0.275348365f, 0.474701405f},
-std::array<float,2>{0.620237887f, 0.0792218819f},
-std::array<float,2>{0.422221005f, 0.932548463f},
-std::array<float,2>{0.975464463f, 0.651818812f},
-std::array<float,2>{0.224178195f, 0.414140582f},
-std::array<float,2>{0.769266427f, 0.304216146f},
-std::array<float,2>{0.0702226087f, 0.515760839f},
-std::array<float,2>{0.743344605f, 0.792279899f},
-std::array<float,2>{0.321865499f, 0.164116502f},
-std::array<float,2>{0.667808056f, 0.442208916f},
-std::array<float,2>{0.288543046f, 0.6901986f},
-std::array<float,2>{0.846232831f, 0.977252722f},
-std::array<float,2>{0.0621264316f, 0.0321098156f},
-std::array<float,2>{0.932787359f, 0.213614821f},
-std::array<float,2>{0.164389402f, 0.855774581f},
-std::array<float,2>{0.537709236f, 0.565562248f},
-std::array<float,2>{0.485519111f, 0.346725672f},
-std::array<float,2>{0.654165506f, 0.0652492493f},
-std::array<float,2>{0.279946357f, 0.916322112f},
-std::array<float,2>{0.833205342f, 0.630042017f},
-std::array<float,2>{0.0272114202f, 0.432865202f},
-std::array<float,2>{0.899385333f, 0.283531457f},
-std::array<float,2>{0.142356589f, 0.509864748f},
-std::array<float,2>{0.516558886f, 0.810849547f},
-std::array<float,2>{0.459676564f, 0.176654309f},
-std::array<float,2>{0.570980966f, 0.462016314f},
-std::array<float,2>{0.40294376f, 0.7075755f},
-std::array<float,2>{0.938655496f, 0.992935717f},
-std::array<float,2>{0.211829811f, 0.058193136f},
-std::array<float,2>{0.807567596f, 0.200412855f},
-std::array<float,2>{0.104729556f, 0.867812574f},
-std::array<float,2>{0.699653685f, 0.586725712f},
-std::array<float,2>{0.361730367f, 0.372633576f},
-std::array<float,2>{0.532640934f, 0.137089133f},
-std::array<float,2>{0.489552468f, 0.770828903f},
-std::array<float,2>{0.934390008f, 0.559189081f},
-std::array<float,2>{0.168783218f, 0.250751376f},
-std::array<float,2>{0.849004149f, 0.393956006f},
-std::array<float,2>{0.0580357462f, 0.657507658f},
-std::array<float,2>{0.67164582f, 0.883304954f},
-std::array<float,2>{0.284490585f, 0.123760954f},
-std::array<float,2>{0.747932971f, 0.319044143f},
-std::array<float,2>{0.325760424f, 0.594555676f},
-std::array<float,2>{0.772662461f, 0.823925734f},
-std::array<float,2>{0.0629583523f, 0.224070415f},
-std::array<float,2>{0.96974504f, 0.00249343272f},
-std::array<float,2>{0.221105635f, 0.957032323f},
-std::array<float,2>{0.623079121f, 0.732713223f},
-std::array<float,2>{0.425926059f, 0.494055599f},
-std::array<float,2>{0.717599809f, 0.237463027f},
-std::array<float,2>{0.349025249f, 0.840688944f},
-std::array<float,2>{0.785732746f, 0.613556325f},
-std::array<float,2>{0.114926942f, 0.328329057f},
-std::array<float,2>{0.954334021f, 0.483135074f},
-std::array<float,2>{0.194588736f, 0.74390167f},
-std::array<float,2>{0.582027793f, 0.951210916f},
-std::array<float,2>{0.388543487f, 0.024822874f},
-std::array<float,2>{0.505438566f, 0.272833467f},
-std::array<float,2>{0.439498127f, 0.533695757f},
-std::array<float,2>{0.88654995f, 0.750840366f},
-std::array<float,2>{0.125817895f, 0.150918797f},
-std::array<float,2>{0.822132349f, 0.10092821f},
-std::array<float,2>{0.00471593766f, 0.895697296f},
-std::array<float,2>{0.629832149f, 0.68451637f},
-std::array<float,2>{0.254954726f, 0.385485023f},
-std::array<float,2>{0.59997952f, 0.0423370562f},
-std::array<float,2>{0.407422632f, 0.971990526f},
-std::array<float,2>{0.991652071f, 0.696341574f},
-std::array<float,2>{0.245737359f, 0.449780196f},
-std::array<float,2>{0.761242092f, 0.352480531f},
-std::array<float,2>{0.090291433f, 0.574512243f},
-std::array<float,2>{0.726805627f, 0.846170008f},
-std::array<float,2>{0.328364044f, 0.203774795f},
-std::array<float,2>{0.674160302f, 0.411025465f},
-std::array<float,2>{0.301837653f, 0.645091712f},
-std::array<float,2>{0.860995114f, 0.925333917f},
-std::array<float,2>{0.0420255065f, 0.0911472067f},
-std::array<float,2>{0.915487587f, 0.158637822f},
-std::array<float,2>{0.173793003f, 0.783016562f},
-std::array<float,2>{0.555422962f, 0.524442255f},
-std::array<float,2>{0.474139124f, 0.307937145f},
-std::array<float,2>{0.725612104f, 0.0190914236f},
-std::array<float,2>{0.340920329f, 0.942524493f},
-std::array<float,2>{0.757388949f, 0.740404487f},
-std::array<float,2>{0.0823398679f, 0.469306827f},
-std::array<float,2>{0.99483186f, 0.341193885f},
-std::array<float,2>{0.239662096f, 0.624387562f},
-std::array<float,2>{0.60395366f, 0.831855297f},
-std::array<float,2>{0.41673553f, 0.243113622f},
-std::array<float,2>{0.551653564f, 0.376989633f},
-std::array<float,2>{0.480996668f, 0.678112805f},
-std::array<float,2>{0.912257671f, 0.899710774f},
-std::array<float,2>{0.181638926f, 0.103460364f},
-std::array<float,2>{0.870176196f, 0.147474766f},
-std::array<float,2>{0.0351504423f, 0.763881445f},
-std::array<float,2>{0.680922925f, 0.544974685f},
-std::array<float,2>{0.308242559f, 0.277885973f},
-std::array<float,2>{0.591385305f, 0.214855298f},
-std::array<float,2>{0.37875405f, 0.852758646f},
-std::array<float,2>{0.962113976f, 0.567607462f},
-std::array<float,2>{0.201796174f, 0.34959504f},
-std::array<float,2>{0.79000771f, 0.438281357f},
-std::array<float,2>{0.121715747f, 0.694043279f},
-std::array<float,2>{0.704277515f, 0.982462466f},
-std::array<float,2>{0.358246595f, 0.0373815522f},
-std::array<float,2>{0.634557247f, 0.299508035f},
-std::array<float,2>{0.263136327f, 0.52234751f},
-std::array<float,2>{0.817103386f, 0.796784878f},
-std::array<float,2>{0.0110623408f, 0.169922903f},
-std::array<float,2>{0.879591107f, 0.084593825f},
-std::array<float,2>{0.134446263f, 0.936436534f},
-std::array<float,2>{0.510145247f, 0.652548075f},
-std::array<float,2>{0.450361401f, 0.421716124f},
-std::array<float,2>{0.660375655f, 0.186209723f},
-std::array<float,2>{0.290187478f, 0.803254068f},
-std::array<float,2>{0.85534966f, 0.505707502f},
-std::array<float,2>{0.0493621826f, 0.294124603f},
-std::array<float,2>{0.923214018f, 0.425501138f},
-std::array<float,2>{0.161705822f, 0.64017725f},
-std::array<float,2>{0.546192944f, 0.912268221f},
-std::array<float,2>{0.493601143f, 0.0728143975f},
-std::array<float,2>{0.609468579f, 0.366809517f},
-std::array<float,2>{0.436336994f, 0.582065701f},
-std::array<float,2>{0.980944753f, 0.861363947f},
-std::array<float,2>{0.230504185f, 0.194622025f},
-std::array<float,2>{0.774840176f, 0.0472871773f},
-std::array<float,2>{0.0727068409f, 0.991492331f},
-std::array<float,2>{0.735607028f, 0.717747271f},
-std::array<float,2>{0.315832406f, 0.460849166f},
-std::array<float,2>{0.529335618f, 0.109597132f},
-std::array<float,2>{0.464114845f, 0.880470157f},
-std::array<float,2>{0.897901654f, 0.671284139f},
-std::array<float,2>{0.153073832f, 0.40035218f},
-std::array<float,2>{0.837468803f, 0.258135706f},
-std::array<float,2>{0.0196799729f, 0.55212152f},
-std::array<float,2>{0.646925986f, 0.78055948f},
-std::array<float,2>{0.270763248f, 0.129494891f},
-std::array<float,2>{0.694985509f, 0.487090707f},
-std::array<float,2>{0.370777667f, 0.718833148f},
-std::array<float,2>{0.801029861f, 0.968240857f},
-std::array<float,2>{0.100937486f, 0.00827515591f},
-std::array<float,2>{0.951675832f, 0.233559921f},
-std::array<float,2>{0.210677236f, 0.81382364f},
-std::array<float,2>{0.56645757f, 0.603390455f},
-std::array<float,2>{0.39357996f, 0.320735067f},
-std::array<float,2>{0.698812008f, 0.108473912f},
-std::array<float,2>{0.365084261f, 0.902703047f},
-std::array<float,2>{0.81024456f, 0.67229718f},
-std::array<float,2>{0.107607871f, 0.382401854f},
-std::array<float,2>{0.944955587f, 0.276481956f},
-std::array<float,2>{0.217579588f, 0.542869508f},
-std::array<float,2>{0.576881468f, 0.759305716f},
-std::array<float,2>{0.399716765f, 0.142850488f},
-std::array<float,2>{0.521539569f, 0.475121647f},
-std::array<float,2>{0.456673056f, 0.735622048f},
-std::array<float,2>{0.903193533f, 0.940522671f},
-std::array<float,2>{0.144966722f, 0.021844482f},
-std::array<float,2>{0.829340219f, 0.247745469f},
-std::array<float,2>{0.0286183823f, 0.832439065f},
-std::array<float,2>{0.650780559f, 0.619347751f},
-std::array<float,2>{0.27606526f, 0.338590771f},
-std::array<float,2>{0.618647695f, 0.164913014f},
-std::array<float,2>{0.424491167f, 0.7927472f},
-std::array<float,2>{0.974150062f, 0.516221464f},
-std::array<float,2>{0.225480124f, 0.304149777f},
-std::array<float,2>{0.766355515f, 0.414610565f},
-std::array<float,2>{0.0680251047f, 0.652186215f},
-std::array<float,2>{0.744977474f, 0.931952477f},
-std::array<float,2>{0.323463708f, 0.0800250396f},
-std::array<float,2>{0.664293528f, 0.347460926f},
-std::array<float,2>{0.28606382f, 0.566108406f},
-std::array<float,2>{0.844443977f, 0.856046081f},
-std::array<float,2>{0.0596539229f, 0.213185638f},
-std::array<float,2>{0.929985762f, 0.0314230695f},
-std::array<float,2>{0.167956263f, 0.976947188f},
-std::array<float,2>{0.536128759f, 0.689676046f},
-std::array<float,2>{0.48690635f, 0.441571921f},
-std::array<float,2>{0.626632631f, 0.189731777f},
-std::array<float,2>{0.250276923f, 0.863399327f},
-std::array<float,2>{0.825881183f, 0.579972565f},
-std::array<float,2>{0.00110149616f, 0.360039324f},
-std::array<float,2>{0.889460027f, 0.456092596f},
-std::array<float,2>{0.132210881f, 0.714468837f},
-std::array<float,2>{0.500155509f, 0.987618506f},
-std::array<float,2>{0.443359286f, 0.0528831333f},
-std::array<float,2>{0.582788765f, 0.290307313f},
-std::array<float,2>{0.384636641f, 0.501844943f},
-std::array<float,2>{0.95822078f, 0.797550976f},
-std::array<float,2>{0.190294757f, 0.181777433f},
-std::array<float,2>{0.782244146f, 0.075465709f},
-std::array<float,2>{0.110755779f, 0.910071552f},
-std::array<float,2>{0.713094771f, 0.636279106f},
-std::array<float,2>{0.347076416f, 0.429042906f},
-std::array<float,2>{0.562191069f, 0.013693708f},
-std::array<float,2>{0.470614582f, 0.961635888f},
-std::array<float,2>{0.919137895f, 0.723138452f},
-std::array<float,2>{0.17741622f, 0.489211529f},
-std::array<float,2>{0.866743445f, 0.326836914f},
-std::array<float,2>{0.0441214889f, 0.609278202f},
-std::array<float,2>{0.677151918f, 0.819091737f},
-std::array<float,2>{0.298965186f, 0.229491621f},
-std::array<float,2>{0.731721163f, 0.404456437f},
-std::array<float,2>{0.332589805f, 0.664065719f},
-std::array<float,2>{0.762431264f, 0.875782073f},
-std::array<float,2>{0.0870143697f, 0.114919849f},
-std::array<float,2>{0.986391068f, 0.12637721f},
-std::array<float,2>{0.246417254f, 0.77551204f},
-std::array<float,2>{0.596388817f, 0.548796058f},
-std::array<float,2>{0.412764847f, 0.263867915f},
-std::array<float,2>{0.684985816f, 0.0614491105f},
-std::array<float,2>{0.310112327f, 0.997601032f},
-std::array<float,2>{0.873937607f, 0.705593407f},
-std::array<float,2>{0.0379948355f, 0.464975506f},
-std::array<float,2>{0.907489419f, 0.370987028f},
-std::array<float,2>{0.186156213f, 0.593523085f},
-std::array<float,2>{0.548189163f, 0.874098599f},
-std::array<float,2>{0.479472399f, 0.198237598f},
-std::array<float,2>{0.60761863f, 0.436439574f},
-std::array<float,2>{0.421598464f, 0.626567423f},
-std::array<float,2>{0.998133183f, 0.918809414f},
-std::array<float,2>{0.234405234f, 0.0687878355f},
-std::array<float,2>{0.751218319f, 0.174028128f},
-std::array<float,2>{0.0809201673f, 0.80506742f},
-std::array<float,2>{0.721175849f, 0.512375772f},
-std::array<float,2>{0.339206517f, 0.287745237f},
-std::array<float,2>{0.512041867f, 0.21961008f},
-std::array<float,2>{0.446992338f, 0.826218486f},
-std::array<float,2>{0.878400385f, 0.600740731f},
-std::array<float,2>{0.140084624f, 0.314381719f},
-std::array<float,2>{0.814584196f, 0.496452421f},
-std::array<float,2>{0.0149323f, 0.728020072f},
-std::array<float,2>{0.638328195f, 0.954690933f},
-std::array<float,2>{0.259107322f, 0.00773089705f},
-std::array<float,2>{0.708040833f, 0.255075157f},
-std::array<float,2>{0.3536807f, 0.55505681f},
-std::array<float,2>{0.793253481f, 0.767372191f},
-std::array<float,2>{0.118134052f, 0.134592384f},
-std::array<float,2>{0.967438042f, 0.118452318f},
-std::array<float,2>{0.198438868f, 0.890329421f},
-std::array<float,2>{0.587305188f, 0.662610531f},
-std::array<float,2>{0.382492691f, 0.397774816f},
-std::array<float,2>{0.739432931f, 0.153187722f},
-std::array<float,2>{0.319013208f, 0.756220579f},
-std::array<float,2>{0.780609369f, 0.536912262f},
-std::array<float,2>{0.075638406f, 0.267237544f},
-std::array<float,2>{0.977757692f, 0.389413774f},
-std::array<float,2>{0.228732571f, 0.682278216f},
-std::array<float,2>{0.615831733f, 0.893077254f},
-std::array<float,2>{0.433582902f, 0.0959543288f},
-std::array<float,2>{0.541150808f, 0.334566802f},
-std::array<float,2>{0.497109264f, 0.613009214f},
-std::array<float,2>{0.929404438f, 0.837030411f},
-std::array<float,2>{0.158821613f, 0.241236761f},
-std::array<float,2>{0.857950032f, 0.0297985729f},
-std::array<float,2>{0.0539063737f, 0.947155893f},
-std::array<float,2>{0.657334685f, 0.748219132f},
-std::array<float,2>{0.294653893f, 0.476958603f},
-std::array<float,2>{0.563484788f, 0.0887476504f},
-std::array<float,2>{0.395161003f, 0.928799748f},
-std::array<float,2>{0.94676733f, 0.643463731f},
-std::array<float,2>{0.206665799f, 0.408273995f},
-std::array<float,2>{0.799375653f, 0.309155256f},
-std::array<float,2>{0.0967047513f, 0.530908465f},
-std::array<float,2>{0.687886059f, 0.786590278f},
-std::array<float,2>{0.371095687f, 0.160209537f},
-std::array<float,2>{0.644484282f, 0.447128236f},
-std::array<float,2>{0.2693578f, 0.701119483f},
-std::array<float,2>{0.842757046f, 0.973076642f},
-std::array<float,2>{0.0173906218f, 0.0443134867f},
-std::array<float,2>{0.891964853f, 0.209454149f},
-std::array<float,2>{0.149682432f, 0.850129128f},
-std::array<float,2>{0.523571014f, 0.570377767f},
-std::array<float,2>{0.468400568f, 0.358322769f},
-std::array<float,2>{0.668149054f, 0.122420676f},
-std::array<float,2>{0.283162087f, 0.885218799f},
-std::array<float,2>{0.851105392f, 0.660142362f},
-std::array<float,2>{0.0558726452f, 0.392335385f},
-std::array<float,2>{0.936037183f, 0.252992988f},
-std::array<float,2>{0.170364156f, 0.561200321f},
-std::array<float,2>{0.53464359f, 0.77272284f},
-std::array<float,2>{0.491220355f, 0.139800191f},
-std::array<float,2>{0.621359944f, 0.494579673f},
-std::array<float,2>{0.428997874f, 0.731768847f},
-std::array<float,2>{0.971861303f, 0.959186494f},
-std::array<float,2>{0.218995765f, 0.00171976048f},
-std::array<float,2>{0.770659328f, 0.226178437f},
-std::array<float,2>{0.0654656664f, 0.821744919f},
-std::array<float,2>{0.748690128f, 0.596098244f},
-std::array<float,2>{0.326223254f, 0.317402095f},
-std::array<float,2>{0.519285321f, 0.178880259f},
-std::array<float,2>{0.457637191f, 0.810184896f},
-std::array<float,2>{0.900849938f, 0.508900702f},
-std::array<float,2>{0.144437656f, 0.28151238f},
-std::array<float,2>{0.834932089f, 0.429795086f},
-std::array<float,2>{0.0253223311f, 0.63096571f},
-std::array<float,2>{0.655217469f, 0.915260613f},
-std::array<float,2>{0.278579801f, 0.0626030862f},
-std::array<float,2>{0.701286733f, 0.373721898f},
-std::array<float,2>{0.359729558f, 0.588567555f},
-std::array<float,2>{0.80579102f, 0.869195461f},
-std::array<float,2>{0.102030873f, 0.20270142f},
-std::array<float,2>{0.940407574f, 0.0553618483f},
-std::array<float,2>{0.214175433f, 0.99588567f},
-std::array<float,2>{0.57415098f, 0.710879087f},
-std::array<float,2>{0.404571921f, 0.464238048f},
-std::array<float,2>{0.730314255f, 0.206975147f},
-std::array<float,2>{0.330450833f, 0.845424354f},
-std::array<float,2>{0.759357512f, 0.577574968f},
-std::array<float,2>{0.0926621556f, 0.354115516f},
-std::array<float,2>{0.989961147f, 0.451943666f},
-std::array<float,2>{0.242946655f, 0.699213862f},
-std::array<float,2>{0.598709345f, 0.970362723f},
-std::array<float,2>{0.409096003f, 0.039846167f},
-std::array<float,2>{0.558154404f, 0.306629568f},
-std::array<float,2>{0.475626171f, 0.526633263f},
-std::array<float,2>{0.91606009f, 0.785005629f},
-std::array<float,2>{0.174894035f, 0.157868594f},
-std::array<float,2>{0.863180816f, 0.09221071f},
-std::array<float,2>{0.0400501564f, 0.922581613f},
-std::array<float,2>{0.673316419f, 0.647581398f},
-std::array<float,2>{0.303568304f, 0.412235677f},
-std::array<float,2>{0.579637289f, 0.0267978646f},
-std::array<float,2>{0.38893488f, 0.950728595f},
-std::array<float,2>{0.956363797f, 0.744213998f},
-std::array<float,2>{0.191527829f, 0.481774539f},
-std::array<float,2>{0.787136137f, 0.330312252f},
-std::array<float,2>{0.115909591f, 0.615307033f},
-std::array<float,2>{0.715027511f, 0.843295455f},
-std::array<float,2>{0.351404905f, 0.234397128f},
-std::array<float,2>{0.632632315f, 0.383718967f},
-std::array<float,2>{0.256369025f, 0.686845541f},
-std::array<float,2>{0.822768092f, 0.896975935f},
-std::array<float,2>{0.00696479157f, 0.0979233235f},
-std::array<float,2>{0.883164287f, 0.149281383f},
-std::array<float,2>{0.128096119f, 0.752804399f},
-std::array<float,2>{0.506962299f, 0.53150332f},
-std::array<float,2>{0.438377887f, 0.269843757f},
-std::array<float,2>{0.705391943f, 0.0359791853f},
-std::array<float,2>{0.355490357f, 0.980740547f},
-std::array<float,2>{0.792688847f, 0.692743242f},
-std::array<float,2>{0.124891467f, 0.44032988f},
-std::array<float,2>{0.963233888f, 0.351276994f},
-std::array<float,2>{0.201056227f, 0.569967389f},
-std::array<float,2>{0.592837453f, 0.853957474f},
-std::array<float,2>{0.376773596f, 0.217036322f},
-std::array<float,2>{0.507905602f, 0.41801843f},
-std::array<float,2>{0.45146507f, 0.655884445f},
-std::array<float,2>{0.881419778f, 0.933595657f},
-std::array<float,2>{0.136303261f, 0.0831843987f},
-std::array<float,2>{0.818588734f, 0.168451235f},
-std::array<float,2>{0.00869459938f, 0.793186486f},
-std::array<float,2>{0.636470377f, 0.519706845f},
-std::array<float,2>{0.264203429f, 0.298271328f},
-std::array<float,2>{0.601756036f, 0.244281292f},
-std::array<float,2>{0.414464235f, 0.830040038f},
-std::array<float,2>{0.992481887f, 0.623036444f},
-std::array<float,2>{0.241877452f, 0.34208867f},
-std::array<float,2>{0.754516721f, 0.472307891f},
-std::array<float,2>{0.0853248537f, 0.738918066f},
-std::array<float,2>{0.723753035f, 0.943594754f},
-std::array<float,2>{0.34259972f, 0.0167146288f},
-std::array<float,2>{0.681748211f, 0.279602736f},
-std::array<float,2>{0.30663842f, 0.543531179f},
-std::array<float,2>{0.868326724f, 0.762239814f},
-std::array<float,2>{0.0323834904f, 0.144614741f},
-std::array<float,2>{0.911867857f, 0.104449011f},
-std::array<float,2>{0.182591036f, 0.900558352f},
-std::array<float,2>{0.554303765f, 0.675945163f},
-std::array<float,2>{0.483814955f, 0.375967652f},
-std::array<float,2>{0.646069586f, 0.131870225f},
-std::array<float,2>{0.272780031f, 0.779059231f},
-std::array<float,2>{0.838289738f, 0.554668963f},
-std::array<float,2>{0.0216146521f, 0.26032567f},
-std::array<float,2>{0.894671321f, 0.400987715f},
-std::array<float,2>{0.15487884f, 0.668512285f},
-std::array<float,2>{0.528033912f, 0.881040335f},
-std::array<float,2>{0.46208325f, 0.111867569f},
-std::array<float,2>{0.570070326f, 0.32403034f},
-std::array<float,2>{0.391055286f, 0.604150712f},
-std::array<float,2>{0.950748384f, 0.815285385f},
-std::array<float,2>{0.208171919f, 0.231413454f},
-std::array<float,2>{0.803807139f, 0.0110056661f},
-std::array<float,2>{0.0981338248f, 0.96521014f},
-std::array<float,2>{0.691722274f, 0.721135974f},
-std::array<float,2>{0.367563248f, 0.484710813f},
-std::array<float,2>{0.544251442f, 0.0720376596f},
-std::array<float,2>{0.495662272f, 0.911076188f},
-std::array<float,2>{0.925222039f, 0.637149215f},
-std::array<float,2>{0.162923664f, 0.422683626f},
-std::array<float,2>{0.853153825f, 0.296421677f},
-std::array<float,2>{0.0473212078f, 0.507149339f},
-std::array<float,2>{0.663854122f, 0.801638067f},
-std::array<float,2>{0.29124105f, 0.183644533f},
-std::array<float,2>{0.737822771f, 0.457841933f},
-std::array<float,2>{0.313453078f, 0.716126204f},
-std::array<float,2>{0.775795579f, 0.990006924f},
-std::array<float,2>{0.0704511926f, 0.0499229059f},
-std::array<float,2>{0.982869685f, 0.193025976f},
-std::array<float,2>{0.232988313f, 0.860065758f},
-std::array<float,2>{0.612765729f, 0.58514154f},
-std::array<float,2>{0.43465367f, 0.364874125f},
-std::array<float,2>{0.743923306f, 0.0802746341f},
-std::array<float,2>{0.321750969f, 0.930559754f},
-std::array<float,2>{0.768648088f, 0.649335206f},
-std::array<float,2>{0.0697235614f, 0.417124718f},
-std::array<float,2>{0.975062907f, 0.301088959f},
-std::array<float,2>{0.223990589f, 0.519451916f},
-std::array<float,2>{0.620616376f, 0.789660931f},
-std::array<float,2>{0.42280066f, 0.167945504f},
-std::array<float,2>{0.53725034f, 0.443905801f},
-std::array<float,2>{0.486260176f, 0.688937962f},
-std::array<float,2>{0.933185756f, 0.97888732f},
-std::array<float,2>{0.164677471f, 0.0341545306f},
-std::array<float,2>{0.846138477f, 0.212063983f},
-std::array<float,2>{0.0618262403f, 0.858443439f},
-std::array<float,2>{0.667344809f, 0.56286031f},
-std::array<float,2>{0.288793445f, 0.344515771f},
-std::array<float,2>{0.574228525f, 0.14096567f},
-std::array<float,2>{0.401347816f, 0.760070622f},
-std::array<float,2>{0.942153752f, 0.539583266f},
-std::array<float,2>{0.216063917f, 0.274987996f},
-std::array<float,2>{0.811163902f, 0.379097849f},
-std::array<float,2>{0.105941787f, 0.674888968f},
-std::array<float,2>{0.695739508f, 0.904644907f},
-std::array<float,2>{0.36559251f, 0.106413968f},
-std::array<float,2>{0.649077833f, 0.336975276f},
-std::array<float,2>{0.274415761f, 0.617416143f},
-std::array<float,2>{0.830633402f, 0.834513962f},
-std::array<float,2>{0.0310186855f, 0.249195233f},
-std::array<float,2>{0.905793607f, 0.0206595343f},
-std::array<float,2>{0.147838891f, 0.938770473f},
-std::array<float,2>{0.519713283f, 0.737918019f},
-std::array<float,2>{0.45359537f, 0.474000692f},
-std::array<float,2>{0.678277254f, 0.226607665f},
-std::array<float,2>{0.297967643f, 0.817648709f},
-std::array<float,2>{0.863631725f, 0.606986642f},
-std::array<float,2>{0.046044074f, 0.324504316f},
-std::array<float,2>{0.920701504f, 0.490358829f},
-std::array<float,2>{0.17807655f, 0.726490855f},
-std::array<float,2>{0.560255051f, 0.964269102f},
-std::array<float,2>{0.470938176f, 0.0135696968f},
-std::array<float,2>{0.595091939f, 0.262134969f},
-std::array<float,2>{0.412064165f, 0.549866736f},
-std::array<float,2>{0.985030413f, 0.774168491f},
-std::array<float,2>{0.249771655f, 0.128558844f},
-std::array<float,2>{0.765000522f, 0.116283111f},
-std::array<float,2>{0.0891573802f, 0.877308607f},
-std::array<float,2>{0.73273772f, 0.667076111f},
-std::array<float,2>{0.334979415f, 0.404122651f},
-std::array<float,2>{0.502746165f, 0.0519410931f},
-std::array<float,2>{0.444311947f, 0.985650063f},
-std::array<float,2>{0.887368798f, 0.711019039f},
-std::array<float,2>{0.130737662f, 0.454200298f},
-std::array<float,2>{0.827000082f, 0.36202991f},
-std::array<float,2>{0.00294504128f, 0.580330014f},
-std::array<float,2>{0.627775252f, 0.86540997f},
-std::array<float,2>{0.252881438f, 0.189154387f},
-std::array<float,2>{0.711568594f, 0.426057845f},
-std::array<float,2>{0.344996125f, 0.634340227f},
-std::array<float,2>{0.784728169f, 0.907380939f},
-std::array<float,2>{0.111481175f, 0.0770420358f},
-std::array<float,2>{0.960482001f, 0.181053579f},
-std::array<float,2>{0.18898654f, 0.799612284f},
-std::array<float,2>{0.584169567f, 0.503018916f},
-std::array<float,2>{0.385320842f, 0.291949779f},
-std::array<float,2>{0.639356136f, 0.00584432855f},
-std::array<float,2>{0.259791166f, 0.956057668f},
-std::array<float,2>{0.812647104f, 0.729172766f},
-std::array<float,2>{0.0122622866f, 0.499152064f},
-std::array<float,2>{0.876253843f, 0.315164208f},
-std::array<float,2>{0.137406364f, 0.598685443f},
-std::array<float,2>{0.515468955f, 0.825153589f},
-std::array<float,2>{0.447539628f, 0.220804915f},
-std::array<float,2>{0.588807166f, 0.395337254f},
-std::array<float,2>{0.380318612f, 0.661759019f},
-std::array<float,2>{0.96661675f, 0.888645172f},
-std::array<float,2>{0.196703434f, 0.119348213f},
-std::array<float,2>{0.796229601f, 0.135975778f},
-std::array<float,2>{0.120414466f, 0.768624127f},
-std::array<float,2>{0.710016966f, 0.557391882f},
-std::array<float,2>{0.352259845f, 0.257327557f},
-std::array<float,2>{0.549866259f, 0.196564227f},
-std::array<float,2>{0.476653814f, 0.872921169f},
-std::array<float,2>{0.908452749f, 0.591693938f},
-std::array<float,2>{0.18435055f, 0.367918968f},
-std::array<float,2>{0.872704387f, 0.467111439f},
-std::array<float,2>{0.0354691148f, 0.703846991f},
-std::array<float,2>{0.686783493f, 0.999991775f},
-std::array<float,2>{0.312216938f, 0.059546873f},
-std::array<float,2>{0.72061348f, 0.285917133f},
-std::array<float,2>{0.336566448f, 0.515414119f},
-std::array<float,2>{0.75323981f, 0.807989717f},
-std::array<float,2>{0.0790989622f, 0.173059016f},
-std::array<float,2>{0.99653089f, 0.0683509707f},
-std::array<float,2>{0.237561211f, 0.920433998f},
-std::array<float,2>{0.607063353f, 0.628136396f},
-std::array<float,2>{0.419203788f, 0.435016453f},
-std::array<float,2>{0.690602243f, 0.163787246f},
-std::array<float,2>{0.374268323f, 0.78723073f},
-std::array<float,2>{0.798478305f, 0.527901351f},
-std::array<float,2>{0.0946520716f, 0.311317444f},
-std::array<float,2>{0.947675526f, 0.407258213f},
-std::array<float,2>{0.204629675f, 0.641529441f},
-std::array<float,2>{0.565975904f, 0.925935149f},
-std::array<float,2>{0.397220939f, 0.0873659551f},
-std::array<float,2>{0.527160525f, 0.355555058f},
-std::array<float,2>{0.465190917f, 0.57388258f},
-std::array<float,2>{0.892686665f, 0.849026442f},
-std::array<float,2>{0.150869697f, 0.207599193f},
-std::array<float,2>{0.841262698f, 0.0459115095f},
-std::array<float,2>{0.019039521f, 0.974789917f},
-std::array<float,2>{0.64174825f, 0.701660037f},
-std::array<float,2>{0.26740402f, 0.449166685f},
-std::array<float,2>{0.613863766f, 0.0939711854f},
-std::array<float,2>{0.4303253f, 0.89167887f},
-std::array<float,2>{0.979157448f, 0.680009365f},
-std::array<float,2>{0.227223992f, 0.388400078f},
-std::array<float,2>{0.778328478f, 0.268109709f},
-std::array<float,2>{0.0764658898f, 0.537256479f},
-std::array<float,2>{0.741696358f, 0.75459528f},
-std::array<float,2>{0.316766918f, 0.156091139f},
-std::array<float,2>{0.660049558f, 0.479814798f},
-std::array<float,2>{0.29509899f, 0.747074306f},
-std::array<float,2>{0.85564363f, 0.947703123f},
-std::array<float,2>{0.0525349937f, 0.0292022657f},
-std::array<float,2>{0.926401377f, 0.240184024f},
-std::array<float,2>{0.157518297f, 0.838880539f},
-std::array<float,2>{0.540099204f, 0.609759927f},
-std::array<float,2>{0.498167187f, 0.332259864f},
-std::array<float,2>{0.629947424f, 0.0986906514f},
-std::array<float,2>{0.254038393f, 0.897548139f},
-std::array<float,2>{0.821270585f, 0.685813069f},
-std::array<float,2>{0.00492017949f, 0.383799106f},
-std::array<float,2>{0.885578573f, 0.27090022f},
-std::array<float,2>{0.126801863f, 0.532847822f},
-std::array<float,2>{0.50411433f, 0.753385782f},
-std::array<float,2>{0.441134125f, 0.149679229f},
-std::array<float,2>{0.580316842f, 0.480912477f},
-std::array<float,2>{0.387590796f, 0.745933592f},
-std::array<float,2>{0.953560889f, 0.949306607f},
-std::array<float,2>{0.193999141f, 0.0255553089f},
-std::array<float,2>{0.78701067f, 0.236162975f},
-std::array<float,2>{0.11355748f, 0.84210515f},
-std::array<float,2>{0.717909753f, 0.617031574f},
-std::array<float,2>{0.347787201f, 0.331466645f},
-std::array<float,2>{0.556519806f, 0.156936318f},
-std::array<float,2>{0.473509192f, 0.783787549f},
-std::array<float,2>{0.91463685f, 0.525710285f},
-std::array<float,2>{0.172068045f, 0.304829091f},
-std::array<float,2>{0.859728873f, 0.413582087f},
-std::array<float,2>{0.0417797081f, 0.647315681f},
-std::array<float,2>{0.675113618f, 0.923724771f},
-std::array<float,2>{0.301707566f, 0.0933717564f},
-std::array<float,2>{0.727767706f, 0.354901195f},
-std::array<float,2>{0.329930723f, 0.576172352f},
-std::array<float,2>{0.760202825f, 0.844660997f},
-std::array<float,2>{0.0913581029f, 0.205901667f},
-std::array<float,2>{0.990676045f, 0.0400774553f},
-std::array<float,2>{0.244392663f, 0.969487011f},
-std::array<float,2>{0.601098597f, 0.697436333f},
-std::array<float,2>{0.406468928f, 0.452457607f},
-std::array<float,2>{0.700539351f, 0.2015571f},
-std::array<float,2>{0.362822533f, 0.870970249f},
-std::array<float,2>{0.808574736f, 0.588961244f},
-std::array<float,2>{0.103768647f, 0.374351978f},
-std::array<float,2>{0.938128948f, 0.463621438f},
-std::array<float,2>{0.212549433f, 0.709718108f},
-std::array<float,2>{0.571668744f, 0.994462013f},
-std::array<float,2>{0.403612435f, 0.0565441549f},
-std::array<float,2>{0.516860247f, 0.282410949f},
-std::array<float,2>{0.46043843f, 0.508055151f},
-std::array<float,2>{0.900130391f, 0.808970749f},
-std::array<float,2>{0.141009971f, 0.178015798f},
-std::array<float,2>{0.832253277f, 0.0642252415f},
-std::array<float,2>{0.0261819754f, 0.914119005f},
-std::array<float,2>{0.65237844f, 0.632619083f},
-std::array<float,2>{0.280949324f, 0.430922925f},
-std::array<float,2>{0.624027967f, 0.000396053074f},
-std::array<float,2>{0.426766127f, 0.960496604f},
-std::array<float,2>{0.96899575f, 0.73108077f},
-std::array<float,2>{0.222654313f, 0.495121807f},
-std::array<float,2>{0.772384405f, 0.316594005f},
-std::array<float,2>{0.0643032119f, 0.597601593f},
-std::array<float,2>{0.746988177f, 0.820737064f},
-std::array<float,2>{0.325148284f, 0.225208417f},
-std::array<float,2>{0.670769632f, 0.391263247f},
-std::array<float,2>{0.283881664f, 0.659104288f},
-std::array<float,2>{0.848090947f, 0.886134267f},
-std::array<float,2>{0.0574105121f, 0.121228121f},
-std::array<float,2>{0.934857607f, 0.139110863f},
-std::array<float,2>{0.169263348f, 0.771632016f},
-std::array<float,2>{0.532075047f, 0.561850607f},
-std::array<float,2>{0.488550246f, 0.252727628f},
-std::array<float,2>{0.734710276f, 0.0492144935f},
-std::array<float,2>{0.315155208f, 0.988654315f},
-std::array<float,2>{0.773527503f, 0.715638459f},
-std::array<float,2>{0.0732542723f, 0.45866394f},
-std::array<float,2>{0.982301772f, 0.364184469f},
-std::array<float,2>{0.231541336f, 0.584598482f},
-std::array<float,2>{0.610898554f, 0.860427439f},
-std::array<float,2>{0.436968595f, 0.191901982f},
-std::array<float,2>{0.545824349f, 0.423726052f},
-std::array<float,2>{0.493046016f, 0.638092339f},
-std::array<float,2>{0.921939254f, 0.91164428f},
-std::array<float,2>{0.160232157f, 0.0712722242f},
-std::array<float,2>{0.853850603f, 0.184587792f},
-std::array<float,2>{0.0507176146f, 0.802526057f},
-std::array<float,2>{0.661511004f, 0.506270111f},
-std::array<float,2>{0.289231122f, 0.295895427f},
-std::array<float,2>{0.567947447f, 0.231905103f},
-std::array<float,2>{0.393137991f, 0.815631866f},
-std::array<float,2>{0.952159047f, 0.604997277f},
-std::array<float,2>{0.209486634f, 0.322917312f},
-std::array<float,2>{0.802503705f, 0.485950261f},
-std::array<float,2>{0.0998541415f, 0.721785128f},
-std::array<float,2>{0.693537533f, 0.966173351f},
-std::array<float,2>{0.369376004f, 0.0100144409f},
-std::array<float,2>{0.648392022f, 0.261350781f},
-std::array<float,2>{0.269793779f, 0.552962959f},
-std::array<float,2>{0.836335897f, 0.778150678f},
-std::array<float,2>{0.0208749883f, 0.13160117f},
-std::array<float,2>{0.896662891f, 0.112520978f},
-std::array<float,2>{0.153459281f, 0.882400453f},
-std::array<float,2>{0.530622542f, 0.669194281f},
-std::array<float,2>{0.462973207f, 0.401575744f},
-std::array<float,2>{0.680378616f, 0.146058366f},
-std::array<float,2>{0.307308823f, 0.76350081f},
-std::array<float,2>{0.869341254f, 0.544595838f},
-std::array<float,2>{0.0339364223f, 0.280287981f},
-std::array<float,2>{0.913209379f, 0.376330554f},
-std::array<float,2>{0.17999272f, 0.677091777f},
-std::array<float,2>{0.552552104f, 0.90153563f},
-std::array<float,2>{0.481820107f, 0.10465581f},
-std::array<float,2>{0.604677379f, 0.343168676f},
-std::array<float,2>{0.41727069f, 0.621610463f},
-std::array<float,2>{0.995141566f, 0.82864356f},
-std::array<float,2>{0.239219829f, 0.245978922f},
-std::array<float,2>{0.756037831f, 0.0162638426f},
-std::array<float,2>{0.0838172957f, 0.944414377f},
-std::array<float,2>{0.725510001f, 0.739590108f},
-std::array<float,2>{0.34007141f, 0.471461773f},
-std::array<float,2>{0.510906816f, 0.0827140212f},
-std::array<float,2>{0.449663579f, 0.935053945f},
-std::array<float,2>{0.879958332f, 0.655228496f},
-std::array<float,2>{0.133285239f, 0.419180959f},
-std::array<float,2>{0.81768471f, 0.297421455f},
-std::array<float,2>{0.00977724418f, 0.521342695f},
-std::array<float,2>{0.633040607f, 0.794352889f},
-std::array<float,2>{0.261749715f, 0.169388458f},
-std::array<float,2>{0.703833044f, 0.441367656f},
-std::array<float,2>{0.358633667f, 0.691892624f},
-std::array<float,2>{0.790561616f, 0.981549799f},
-std::array<float,2>{0.122991934f, 0.0363075733f},
-std::array<float,2>{0.961907506f, 0.218582034f},
-std::array<float,2>{0.202329025f, 0.854939044f},
-std::array<float,2>{0.590284348f, 0.568848431f},
-std::array<float,2>{0.377213925f, 0.350311607f},
-std::array<float,2>{0.714397013f, 0.0778550878f},
-std::array<float,2>{0.346184909f, 0.907129645f},
-std::array<float,2>{0.781725466f, 0.632844508f},
-std::array<float,2>{0.109419234f, 0.42703113f},
-std::array<float,2>{0.957419634f, 0.292424679f},
-std::array<float,2>{0.190913737f, 0.502911925f},
-std::array<float,2>{0.583316028f, 0.800105214f},
-std::array<float,2>{0.383249819f, 0.179965496f},
-std::array<float,2>{0.501669765f, 0.45353511f},
-std::array<float,2>{0.441932023f, 0.7126472f},
-std::array<float,2>{0.889963448f, 0.984933913f},
-std::array<float,2>{0.131726608f, 0.051260341f},
-std::array<float,2>{0.82464534f, 0.18759647f},
-std::array<float,2>{0.000802287483f, 0.867036939f},
-std::array<float,2>{0.625639558f, 0.581905961f},
-std::array<float,2>{0.251277447f, 0.363075614f},
-std::array<float,2>{0.597127318f, 0.127280653f},
-std::array<float,2>{0.413315028f, 0.775290787f},
-std::array<float,2>{0.987399399f, 0.548854411f},
-std::array<float,2>{0.248002097f, 0.262857854f},
-std::array<float,2>{0.763183892f, 0.403119028f},
-std::array<float,2>{0.086275883f, 0.666548371f},
-std::array<float,2>{0.730764151f, 0.878194153f},
-std::array<float,2>{0.333555996f, 0.115699731f},
-std::array<float,2>{0.676585436f, 0.326127201f},
-std::array<float,2>{0.300605327f, 0.605954051f},
-std::array<float,2>{0.865519106f, 0.817085445f},
-std::array<float,2>{0.0434293337f, 0.228250921f},
-std::array<float,2>{0.918598473f, 0.0120302783f},
-std::array<float,2>{0.176543906f, 0.963647127f},
-std::array<float,2>{0.560940027f, 0.725273728f},
-std::array<float,2>{0.469474256f, 0.491271198f},
-std::array<float,2>{0.651517332f, 0.248414218f},
-std::array<float,2>{0.276548088f, 0.835330963f},
-std::array<float,2>{0.829005182f, 0.618979633f},
-std::array<float,2>{0.0282416586f, 0.336762756f},
-std::array<float,2>{0.904168665f, 0.472699106f},
-std::array<float,2>{0.145585045f, 0.73672539f},
-std::array<float,2>{0.523362517f, 0.938380718f},
-std::array<float,2>{0.455343127f, 0.0201726481f},
-std::array<float,2>{0.577211797f, 0.274076611f},
-std::array<float,2>{0.399103105f, 0.540361285f},
-std::array<float,2>{0.943738103f, 0.761140108f},
-std::array<float,2>{0.218630925f, 0.142105564f},
-std::array<float,2>{0.808864534f, 0.107243657f},
-std::array<float,2>{0.109355509f, 0.905344725f},
-std::array<float,2>{0.698109746f, 0.674005926f},
-std::array<float,2>{0.364027172f, 0.380541503f},
-std::array<float,2>{0.536537409f, 0.0346966796f},
-std::array<float,2>{0.488215953f, 0.979510486f},
-std::array<float,2>{0.930979311f, 0.687548339f},
-std::array<float,2>{0.166809127f, 0.445219219f},
-std::array<float,2>{0.844730675f, 0.34479633f},
-std::array<float,2>{0.0591640882f, 0.564123333f},
-std::array<float,2>{0.666006625f, 0.858131289f},
-std::array<float,2>{0.28673017f, 0.211171523f},
-std::array<float,2>{0.745677292f, 0.416638672f},
-std::array<float,2>{0.322288007f, 0.649723828f},
-std::array<float,2>{0.767241597f, 0.930700421f},
-std::array<float,2>{0.067350693f, 0.0816956311f},
-std::array<float,2>{0.973445415f, 0.166575983f},
-std::array<float,2>{0.226129994f, 0.79100579f},
-std::array<float,2>{0.61748153f, 0.518370569f},
-std::array<float,2>{0.42558068f, 0.302226365f},
-std::array<float,2>{0.657072306f, 0.0278157406f},
-std::array<float,2>{0.293839812f, 0.948721528f},
-std::array<float,2>{0.859098911f, 0.746114969f},
-std::array<float,2>{0.053442385f, 0.479302138f},
-std::array<float,2>{0.92821002f, 0.333167166f},
-std::array<float,2>{0.159626693f, 0.610449076f},
-std::array<float,2>{0.542620361f, 0.838016033f},
-std::array<float,2>{0.496244252f, 0.23830393f},
-std::array<float,2>{0.617073596f, 0.387409091f},
-std::array<float,2>{0.431852698f, 0.681534946f},
-std::array<float,2>{0.977528632f, 0.891275585f},
-std::array<float,2>{0.230436996f, 0.0947632119f},
-std::array<float,2>{0.779714346f, 0.155209661f},
-std::array<float,2>{0.0743965954f, 0.755274534f},
-std::array<float,2>{0.738720417f, 0.538178682f},
-std::array<float,2>{0.319513798f, 0.268745899f},
-std::array<float,2>{0.52461499f, 0.208579749f},
-std::array<float,2>{0.466845691f, 0.848467529f},
-std::array<float,2>{0.890998065f, 0.572614431f},
-std::array<float,2>{0.148735866f, 0.35672909f},
-std::array<float,2>{0.843618155f, 0.447686464f},
-std::array<float,2>{0.0162027348f, 0.703101933f},
-std::array<float,2>{0.643377602f, 0.976093829f},
-std::array<float,2>{0.267940998f, 0.0451633781f},
-std::array<float,2>{0.689154446f, 0.311838508f},
-std::array<float,2>{0.372397989f, 0.528345048f},
-std::array<float,2>{0.800150514f, 0.788974345f},
-std::array<float,2>{0.0963415056f, 0.163054004f},
-std::array<float,2>{0.945314944f, 0.0865210816f},
-std::array<float,2>{0.205185488f, 0.926935554f},
-std::array<float,2>{0.562556922f, 0.642292142f},
-std::array<float,2>{0.395593047f, 0.407034844f},
-std::array<float,2>{0.722219586f, 0.172364667f},
-std::array<float,2>{0.338544309f, 0.807333112f},
-std::array<float,2>{0.750356972f, 0.514257312f},
-std::array<float,2>{0.0816135332f, 0.286487252f},
-std::array<float,2>{0.999510109f, 0.433826655f},
-std::array<float,2>{0.236291334f, 0.62721169f},
-std::array<float,2>{0.608431697f, 0.921003461f},
-std::array<float,2>{0.420826286f, 0.0673660859f},
-std::array<float,2>{0.54757005f, 0.369041294f},
-std::array<float,2>{0.480112433f, 0.590179682f},
-std::array<float,2>{0.90695399f, 0.871826351f},
-std::array<float,2>{0.187328815f, 0.196172714f},
-std::array<float,2>{0.874617815f, 0.0600423701f},
-std::array<float,2>{0.0387882367f, 0.99900353f},
-std::array<float,2>{0.683897614f, 0.704539657f},
-std::array<float,2>{0.308802336f, 0.467953801f},
-std::array<float,2>{0.586397648f, 0.121037118f},
-std::array<float,2>{0.38152951f, 0.887598872f},
-std::array<float,2>{0.968445957f, 0.661050797f},
-std::array<float,2>{0.197919935f, 0.396149963f},
-std::array<float,2>{0.79396385f, 0.256422609f},
-std::array<float,2>{0.118465103f, 0.55827868f},
-std::array<float,2>{0.707879424f, 0.768027604f},
-std::array<float,2>{0.35497427f, 0.134909034f},
-std::array<float,2>{0.636726379f, 0.498685628f},
-std::array<float,2>{0.257860571f, 0.730101109f},
-std::array<float,2>{0.815866828f, 0.956012607f},
-std::array<float,2>{0.0146117155f, 0.0040194951f},
-std::array<float,2>{0.877317548f, 0.22209242f},
-std::array<float,2>{0.139305905f, 0.825346649f},
-std::array<float,2>{0.512758195f, 0.598278046f},
-std::array<float,2>{0.445944965f, 0.316249996f},
-std::array<float,2>{0.672362268f, 0.0899871439f},
-std::array<float,2>{0.303821385f, 0.923887014f},
-std::array<float,2>{0.861712575f, 0.6461339f},
-std::array<float,2>{0.0395789221f, 0.411672741f},
-std::array<float,2>{0.917286336f, 0.30706808f},
-std::array<float,2>{0.174513325f, 0.524251282f},
-std::array<float,2>{0.55743432f, 0.7821486f},
-std::array<float,2>{0.475565046f, 0.159826711f},
-std::array<float,2>{0.598523974f, 0.450923115f},
-std::array<float,2>{0.410080761f, 0.695668519f},
-std::array<float,2>{0.988701522f, 0.9707762f},
-std::array<float,2>{0.243751362f, 0.0415202938f},
-std::array<float,2>{0.757977426f, 0.205016464f},
-std::array<float,2>{0.0929251686f, 0.847540438f},
-std::array<float,2>{0.728665352f, 0.576159179f},
-std::array<float,2>{0.33165738f, 0.352830589f},
-std::array<float,2>{0.506637514f, 0.151714057f},
-std::array<float,2>{0.438785315f, 0.751043081f},
-std::array<float,2>{0.883898377f, 0.53448385f},
-std::array<float,2>{0.127313033f, 0.272423267f},
-std::array<float,2>{0.823368013f, 0.385865331f},
-std::array<float,2>{0.00632092217f, 0.684601724f},
-std::array<float,2>{0.631547451f, 0.894536197f},
-std::array<float,2>{0.257068008f, 0.100155219f},
-std::array<float,2>{0.71589458f, 0.329397678f},
-std::array<float,2>{0.349853814f, 0.614458084f},
-std::array<float,2>{0.788426876f, 0.841022134f},
-std::array<float,2>{0.116286971f, 0.236959472f},
-std::array<float,2>{0.955144584f, 0.0234571565f},
-std::array<float,2>{0.192784101f, 0.952869236f},
-std::array<float,2>{0.578569889f, 0.742728591f},
-std::array<float,2>{0.390503734f, 0.483694971f},
-std::array<float,2>{0.749656558f, 0.222708434f},
-std::array<float,2>{0.327778101f, 0.823194385f},
-std::array<float,2>{0.769548655f, 0.595564008f},
-std::array<float,2>{0.0645312667f, 0.319716752f},
-std::array<float,2>{0.97147876f, 0.492618322f},
-std::array<float,2>{0.220378608f, 0.734229505f},
-std::array<float,2>{0.622121811f, 0.958052874f},
-std::array<float,2>{0.428169996f, 0.00295830751f},
-std::array<float,2>{0.533220589f, 0.251433074f},
-std::array<float,2>{0.491154283f, 0.559690237f},
-std::array<float,2>{0.937260151f, 0.770109773f},
-std::array<float,2>{0.171508864f, 0.138066113f},
-std::array<float,2>{0.850313067f, 0.124733344f},
-std::array<float,2>{0.054847572f, 0.884491682f},
-std::array<float,2>{0.668976367f, 0.656846821f},
-std::array<float,2>{0.281730115f, 0.393197626f},
-std::array<float,2>{0.572335005f, 0.0570741631f},
-std::array<float,2>{0.405657709f, 0.993234277f},
-std::array<float,2>{0.940808356f, 0.70828563f},
-std::array<float,2>{0.213241205f, 0.461547881f},
-std::array<float,2>{0.804842651f, 0.371223718f},
-std::array<float,2>{0.102621756f, 0.587615013f},
-std::array<float,2>{0.702569664f, 0.869041383f},
-std::array<float,2>{0.361050367f, 0.199293524f},
-std::array<float,2>{0.655777633f, 0.432194829f},
-std::array<float,2>{0.277472705f, 0.629725039f},
-std::array<float,2>{0.835303128f, 0.917263448f},
-std::array<float,2>{0.0235626251f, 0.0654322505f},
-std::array<float,2>{0.901872694f, 0.176992878f},
-std::array<float,2>{0.143317223f, 0.812227488f},
-std::array<float,2>{0.517614365f, 0.510949731f},
-std::array<float,2>{0.45832926f, 0.284877926f},
-std::array<float,2>{0.692970932f, 0.00961636286f},
-std::array<float,2>{0.36898917f, 0.967477858f},
-std::array<float,2>{0.803503811f, 0.720617473f},
-std::array<float,2>{0.0995270759f, 0.488120407f},
-std::array<float,2>{0.950193405f, 0.322181165f},
-std::array<float,2>{0.207195535f, 0.602226615f},
-std::array<float,2>{0.569308221f, 0.812619865f},
-std::array<float,2>{0.392022491f, 0.233235478f},
-std::array<float,2>{0.528959215f, 0.398665458f},
-std::array<float,2>{0.461355984f, 0.670831919f},
-std::array<float,2>{0.895918429f, 0.879751384f},
-std::array<float,2>{0.155359909f, 0.111058705f},
-std::array<float,2>{0.839764416f, 0.130492479f},
-std::array<float,2>{0.0227208082f, 0.780263662f},
-std::array<float,2>{0.644928515f, 0.550924182f},
-std::array<float,2>{0.271566272f, 0.259134531f},
-std::array<float,2>{0.611553609f, 0.193969205f},
-std::array<float,2>{0.433711618f, 0.862865388f},
-std::array<float,2>{0.984216988f, 0.583873808f},
-std::array<float,2>{0.233437061f, 0.365967304f},
-std::array<float,2>{0.776385725f, 0.459779233f},
-std::array<float,2>{0.0718961135f, 0.718654394f},
-std::array<float,2>{0.736798704f, 0.990635872f},
-std::array<float,2>{0.313962728f, 0.0479205661f},
-std::array<float,2>{0.662317932f, 0.293379784f},
-std::array<float,2>{0.292301625f, 0.504124463f},
-std::array<float,2>{0.851938605f, 0.804359913f},
-std::array<float,2>{0.0485949405f, 0.18662551f},
-std::array<float,2>{0.924082339f, 0.0738229454f},
-std::array<float,2>{0.163638622f, 0.913191557f},
-std::array<float,2>{0.543367386f, 0.639371932f},
-std::array<float,2>{0.494142443f, 0.424591154f},
-std::array<float,2>{0.634974003f, 0.171455532f},
-std::array<float,2>{0.265248477f, 0.795349538f},
-std::array<float,2>{0.819866836f, 0.523374856f},
-std::array<float,2>{0.00917669572f, 0.300721049f},
-std::array<float,2>{0.882465601f, 0.419990331f},
-std::array<float,2>{0.135058954f, 0.653721929f},
-std::array<float,2>{0.508791029f, 0.936947703f},
-std::array<float,2>{0.452775568f, 0.085281305f},
-std::array<float,2>{0.592237115f, 0.348207325f},
-std::array<float,2>{0.375406146f, 0.566422403f},
-std::array<float,2>{0.963923335f, 0.851791501f},
-std::array<float,2>{0.199409857f, 0.216055647f},
-std::array<float,2>{0.791775048f, 0.0387971215f},
-std::array<float,2>{0.12363378f, 0.984255016f},
-std::array<float,2>{0.706149578f, 0.6950773f},
-std::array<float,2>{0.35730806f, 0.438867658f},
-std::array<float,2>{0.553053975f, 0.101986103f},
-std::array<float,2>{0.482722074f, 0.898948789f},
-std::array<float,2>{0.910615742f, 0.679340959f},
-std::array<float,2>{0.18318902f, 0.378293067f},
-std::array<float,2>{0.867595553f, 0.279035777f},
-std::array<float,2>{0.031350147f, 0.546068788f},
-std::array<float,2>{0.683535516f, 0.765294373f},
-std::array<float,2>{0.305501759f, 0.146928862f},
-std::array<float,2>{0.723500967f, 0.470671028f},
-std::array<float,2>{0.343678027f, 0.741280437f},
-std::array<float,2>{0.754974127f, 0.942272604f},
-std::array<float,2>{0.0844861716f, 0.0185235143f},
-std::array<float,2>{0.993963122f, 0.243664309f},
-std::array<float,2>{0.24057354f, 0.830968559f},
-std::array<float,2>{0.603081286f, 0.62317872f},
-std::array<float,2>{0.41584897f, 0.340558648f},
-std::array<float,2>{0.733958244f, 0.11412739f},
-std::array<float,2>{0.333991855f, 0.87611419f},
-std::array<float,2>{0.764353395f, 0.665690005f},
-std::array<float,2>{0.088625975f, 0.405340165f},
-std::array<float,2>{0.985509217f, 0.265189081f},
-std::array<float,2>{0.248313695f, 0.547797859f},
-std::array<float,2>{0.593761981f, 0.776442111f},
-std::array<float,2>{0.410426527f, 0.125259832f},
-std::array<float,2>{0.559022605f, 0.489427149f},
-std::array<float,2>{0.472258568f, 0.724127829f},
-std::array<float,2>{0.921343744f, 0.962799311f},
-std::array<float,2>{0.178817123f, 0.0156142367f},
-std::array<float,2>{0.865136385f, 0.230027512f},
-std::array<float,2>{0.0458337292f, 0.819545686f},
-std::array<float,2>{0.679059207f, 0.607969999f},
-std::array<float,2>{0.297841966f, 0.327375352f},
-std::array<float,2>{0.585152447f, 0.182626337f},
-std::array<float,2>{0.386716664f, 0.797995746f},
-std::array<float,2>{0.959682167f, 0.500422478f},
-std::array<float,2>{0.18816632f, 0.289561898f},
-std::array<float,2>{0.783256352f, 0.427756548f},
-std::array<float,2>{0.113061197f, 0.635631025f},
-std::array<float,2>{0.712836266f, 0.908591151f},
-std::array<float,2>{0.344702214f, 0.0747472644f},
-std::array<float,2>{0.628016829f, 0.360584706f},
-std::array<float,2>{0.253707677f, 0.578886688f},
-std::array<float,2>{0.828007877f, 0.864529192f},
-std::array<float,2>{0.00207243068f, 0.190761641f},
-std::array<float,2>{0.888286531f, 0.0542907491f},
-std::array<float,2>{0.12904045f, 0.986709118f},
-std::array<float,2>{0.502940416f, 0.713414967f},
-std::array<float,2>{0.444805086f, 0.455532074f},
-std::array<float,2>{0.666525662f, 0.214031324f},
-std::array<float,2>{0.287941158f, 0.857024729f},
-std::array<float,2>{0.847173929f, 0.564957857f},
-std::array<float,2>{0.0614141449f, 0.346037149f},
-std::array<float,2>{0.931682229f, 0.443100929f},
-std::array<float,2>{0.165576652f, 0.691086888f},
-std::array<float,2>{0.538118005f, 0.978384078f},
-std::array<float,2>{0.485192865f, 0.0331178196f},
-std::array<float,2>{0.619856298f, 0.303235143f},
-std::array<float,2>{0.42299366f, 0.516889155f},
-std::array<float,2>{0.976302683f, 0.791072607f},
-std::array<float,2>{0.223433435f, 0.165856779f},
-std::array<float,2>{0.768480718f, 0.0786287785f},
-std::array<float,2>{0.0688583329f, 0.932693601f},
-std::array<float,2>{0.742926836f, 0.650982022f},
-std::array<float,2>{0.320396423f, 0.415661871f},
-std::array<float,2>{0.520724595f, 0.0228285659f},
-std::array<float,2>{0.454551786f, 0.939694762f},
-std::array<float,2>{0.90465039f, 0.734684527f},
-std::array<float,2>{0.147460371f, 0.476236135f},
-std::array<float,2>{0.831396878f, 0.339252084f},
-std::array<float,2>{0.0299305581f, 0.620549321f},
-std::array<float,2>{0.650007129f, 0.833281398f},
-std::array<float,2>{0.273463279f, 0.246369436f},
-std::array<float,2>{0.697146952f, 0.381135106f},
-std::array<float,2>{0.366551191f, 0.673490644f},
-std::array<float,2>{0.81182313f, 0.903443396f},
-std::array<float,2>{0.106653638f, 0.107813284f},
-std::array<float,2>{0.943152726f, 0.144306362f},
-std::array<float,2>{0.215536848f, 0.758446515f},
-std::array<float,2>{0.576014817f, 0.541063905f},
-std::array<float,2>{0.401486993f, 0.276297748f},
-std::array<float,2>{0.641390204f, 0.043613743f},
-std::array<float,2>{0.266457319f, 0.974579453f},
-std::array<float,2>{0.840047002f, 0.699931502f},
-std::array<float,2>{0.0185393486f, 0.44569689f},
-std::array<float,2>{0.893784463f, 0.35861671f},
-std::array<float,2>{0.152273417f, 0.571921945f},
-std::array<float,2>{0.526168525f, 0.851463616f},
-std::array<float,2>{0.465925038f, 0.21047543f},
-std::array<float,2>{0.564903319f, 0.409256101f},
-std::array<float,2>{0.398339599f, 0.643880844f},
-std::array<float,2>{0.948483825f, 0.928328633f},
-std::array<float,2>{0.203988731f, 0.0897172242f},
-std::array<float,2>{0.797399342f, 0.161285862f},
-std::array<float,2>{0.0956812203f, 0.785691023f},
-std::array<float,2>{0.68946892f, 0.529375792f},
-std::array<float,2>{0.373978764f, 0.310334146f},
-std::array<float,2>{0.539198935f, 0.240250111f},
-std::array<float,2>{0.499666721f, 0.835942805f},
-std::array<float,2>{0.927087307f, 0.612267971f},
-std::array<float,2>{0.156495243f, 0.334961176f},
-std::array<float,2>{0.856545985f, 0.478400826f},
-std::array<float,2>{0.0514935851f, 0.749527872f},
-std::array<float,2>{0.658660471f, 0.945355892f},
-std::array<float,2>{0.2968283f, 0.0305230655f},
-std::array<float,2>{0.740585923f, 0.265953362f},
-std::array<float,2>{0.318040818f, 0.535869181f},
-std::array<float,2>{0.777508616f, 0.757516086f},
-std::array<float,2>{0.0779124722f, 0.153739065f},
-std::array<float,2>{0.980161488f, 0.0974113569f},
-std::array<float,2>{0.227991968f, 0.894303679f},
-std::array<float,2>{0.615233898f, 0.682882369f},
-std::array<float,2>{0.431057841f, 0.3904531f},
-std::array<float,2>{0.70907861f, 0.133420318f},
-std::array<float,2>{0.35324502f, 0.766110778f},
-std::array<float,2>{0.79587096f, 0.556605935f},
-std::array<float,2>{0.120002575f, 0.254518628f},
-std::array<float,2>{0.96574825f, 0.396947861f},
-std::array<float,2>{0.196057722f, 0.663274407f},
-std::array<float,2>{0.589244485f, 0.889173746f},
-std::array<float,2>{0.379519641f, 0.11728134f},
-std::array<float,2>{0.514544845f, 0.312947601f},
-std::array<float,2>{0.448364943f, 0.600530684f},
-std::array<float,2>{0.87537396f, 0.82754451f},
-std::array<float,2>{0.138079718f, 0.22008872f},
-std::array<float,2>{0.813923657f, 0.00592276827f},
-std::array<float,2>{0.0130343679f, 0.954065979f},
-std::array<float,2>{0.640212059f, 0.726871729f},
-std::array<float,2>{0.261097699f, 0.49745062f},
-std::array<float,2>{0.606173992f, 0.069832921f},
-std::array<float,2>{0.418313444f, 0.919188738f},
-std::array<float,2>{0.99767381f, 0.625383317f},
-std::array<float,2>{0.237112507f, 0.437277287f},
-std::array<float,2>{0.752002656f, 0.288325846f},
-std::array<float,2>{0.0792244747f, 0.513409555f},
-std::array<float,2>{0.718829632f, 0.805953681f},
-std::array<float,2>{0.337295741f, 0.175560847f},
-std::array<float,2>{0.686508358f, 0.466209233f},
-std::array<float,2>{0.310976356f, 0.70650506f},
-std::array<float,2>{0.871695578f, 0.996333838f},
-std::array<float,2>{0.0368844122f, 0.0617827103f},
-std::array<float,2>{0.909864664f, 0.19843407f},
-std::array<float,2>{0.184638247f, 0.873227477f},
-std::array<float,2>{0.549565017f, 0.591818988f},
-std::array<float,2>{0.477859378f, 0.369683772f},
-std::array<float,2>{0.625744045f, 0.0757390186f},
-std::array<float,2>{0.251185536f, 0.909599662f},
-std::array<float,2>{0.824317276f, 0.63615787f},
-std::array<float,2>{0.000516294327f, 0.429456502f},
-std::array<float,2>{0.889827192f, 0.291000962f},
-std::array<float,2>{0.131591424f, 0.501378298f},
-std::array<float,2>{0.501919448f, 0.796986401f},
-std::array<float,2>{0.442307919f, 0.182480752f},
-std::array<float,2>{0.583042502f, 0.45693329f},
-std::array<float,2>{0.383053333f, 0.713975787f},
-std::array<float,2>{0.957101226f, 0.988055348f},
-std::array<float,2>{0.190627545f, 0.0532773659f},
-std::array<float,2>{0.78145653f, 0.190212116f},
-std::array<float,2>{0.109799087f, 0.864132464f},
-std::array<float,2>{0.714703441f, 0.579173923f},
-std::array<float,2>{0.345920146f, 0.359517634f},
-std::array<float,2>{0.560648084f, 0.126580447f},
-std::array<float,2>{0.469594479f, 0.776216328f},
-std::array<float,2>{0.91888535f, 0.548152983f},
-std::array<float,2>{0.176393613f, 0.264460951f},
-std::array<float,2>{0.865391672f, 0.404882431f},
-std::array<float,2>{0.0429823212f, 0.664840996f},
-std::array<float,2>{0.676277399f, 0.875049472f},
-std::array<float,2>{0.300309062f, 0.114549264f},
-std::array<float,2>{0.73057282f, 0.32633549f},
-std::array<float,2>{0.333857477f, 0.608859122f},
-std::array<float,2>{0.763436437f, 0.81842792f},
-std::array<float,2>{0.0860479251f, 0.228995517f},
-std::array<float,2>{0.987582088f, 0.0145097906f},
-std::array<float,2>{0.247753575f, 0.961326897f},
-std::array<float,2>{0.596861243f, 0.72323072f},
-std::array<float,2>{0.41357106f, 0.488625586f},
-std::array<float,2>{0.697909534f, 0.247164086f},
-std::array<float,2>{0.363803416f, 0.832991779f},
-std::array<float,2>{0.808830917f, 0.620011508f},
-std::array<float,2>{0.108889006f, 0.338345945f},
-std::array<float,2>{0.943373144f, 0.474896401f},
-std::array<float,2>{0.218452796f, 0.736032367f},
-std::array<float,2>{0.577595949f, 0.940962493f},
-std::array<float,2>{0.39920485f, 0.0221984982f},
-std::array<float,2>{0.523021638f, 0.277111173f},
-std::array<float,2>{0.455299497f, 0.542178452f},
-std::array<float,2>{0.903892696f, 0.759136617f},
-std::array<float,2>{0.145806745f, 0.143154532f},
-std::array<float,2>{0.828614831f, 0.109208189f},
-std::array<float,2>{0.0279747192f, 0.903295815f},
-std::array<float,2>{0.651651978f, 0.672635376f},
-std::array<float,2>{0.276819259f, 0.382039011f},
-std::array<float,2>{0.617202282f, 0.031961672f},
-std::array<float,2>{0.425392777f, 0.977479994f},
-std::array<float,2>{0.973300576f, 0.690002203f},
-std::array<float,2>{0.226474404f, 0.442074388f},
-std::array<float,2>{0.767413139f, 0.347150981f},
-std::array<float,2>{0.0670694336f, 0.565851033f},
-std::array<float,2>{0.745913863f, 0.85561502f},
-std::array<float,2>{0.322617114f, 0.213656783f},
-std::array<float,2>{0.665531218f, 0.414427698f},
-std::array<float,2>{0.286926955f, 0.651383936f},
-std::array<float,2>{0.845024049f, 0.93233335f},
-std::array<float,2>{0.0595432259f, 0.0794945285f},
-std::array<float,2>{0.930705309f, 0.164403915f},
-std::array<float,2>{0.166628093f, 0.792166054f},
-std::array<float,2>{0.536206663f, 0.516022265f},
-std::array<float,2>{0.48798418f, 0.304486066f},
-std::array<float,2>{0.738467515f, 0.0296396073f},
-std::array<float,2>{0.319705784f, 0.946609914f},
-std::array<float,2>{0.779327393f, 0.748996615f},
-std::array<float,2>{0.0746906996f, 0.477276623f},
-std::array<float,2>{0.977222085f, 0.334036887f},
-std::array<float,2>{0.230207995f, 0.612366378f},
-std::array<float,2>{0.616855979f, 0.837425947f},
-std::array<float,2>{0.432083309f, 0.242028818f},
-std::array<float,2>{0.542830348f, 0.38901189f},
-std::array<float,2>{0.496354043f, 0.68165797f},
-std::array<float,2>{0.927895308f, 0.89261061f},
-std::array<float,2>{0.159277469f, 0.0966429561f},
-std::array<float,2>{0.859176755f, 0.15241158f},
-std::array<float,2>{0.0536247864f, 0.756641865f},
-std::array<float,2>{0.656888008f, 0.536227703f},
-std::array<float,2>{0.29350993f, 0.266836286f},
-std::array<float,2>{0.562868118f, 0.209915981f},
-std::array<float,2>{0.395769566f, 0.849843919f},
-std::array<float,2>{0.945559502f, 0.571071267f},
-std::array<float,2>{0.205480501f, 0.357876122f},
-std::array<float,2>{0.800048769f, 0.446697563f},
-std::array<float,2>{0.0964548364f, 0.70041728f},
-std::array<float,2>{0.689357281f, 0.973282039f},
-std::array<float,2>{0.372114211f, 0.0445796326f},
-std::array<float,2>{0.64329803f, 0.308602631f},
-std::array<float,2>{0.267761081f, 0.5303545f},
-std::array<float,2>{0.843288302f, 0.786628246f},
-std::array<float,2>{0.0164111722f, 0.160940498f},
-std::array<float,2>{0.89076221f, 0.0880269706f},
-std::array<float,2>{0.148574412f, 0.929278493f},
-std::array<float,2>{0.524885237f, 0.642847836f},
-std::array<float,2>{0.467132688f, 0.409037739f},
-std::array<float,2>{0.68368727f, 0.174744442f},
-std::array<float,2>{0.309023172f, 0.80539149f},
-std::array<float,2>{0.874971926f, 0.512070298f},
-std::array<float,2>{0.0388368145f, 0.287516475f},
-std::array<float,2>{0.907023489f, 0.435654402f},
-std::array<float,2>{0.187057942f, 0.626460612f},
-std::array<float,2>{0.547798812f, 0.918123424f},
-std::array<float,2>{0.480339885f, 0.0692581236f},
-std::array<float,2>{0.608807981f, 0.370458961f},
-std::array<float,2>{0.4205423f, 0.592981398f},
-std::array<float,2>{0.999235749f, 0.874741614f},
-std::array<float,2>{0.235945925f, 0.197565719f},
-std::array<float,2>{0.750007272f, 0.0609710179f},
-std::array<float,2>{0.0818374231f, 0.997306883f},
-std::array<float,2>{0.722576439f, 0.705294371f},
-std::array<float,2>{0.338765651f, 0.465536594f},
-std::array<float,2>{0.512965739f, 0.119081631f},
-std::array<float,2>{0.446148753f, 0.88966018f},
-std::array<float,2>{0.877037942f, 0.66236937f},
-std::array<float,2>{0.139447719f, 0.398267955f},
-std::array<float,2>{0.815431833f, 0.255529881f},
-std::array<float,2>{0.0141710024f, 0.555550635f},
-std::array<float,2>{0.63701719f, 0.767080188f},
-std::array<float,2>{0.258270919f, 0.134226739f},
-std::array<float,2>{0.70770818f, 0.496858835f},
-std::array<float,2>{0.354630589f, 0.728435099f},
-std::array<float,2>{0.794196308f, 0.954396307f},
-std::array<float,2>{0.118259259f, 0.00706477277f},
-std::array<float,2>{0.968539596f, 0.219232976f},
-std::array<float,2>{0.198102891f, 0.827079892f},
-std::array<float,2>{0.586093307f, 0.601315558f},
-std::array<float,2>{0.381726921f, 0.313692361f},
-std::array<float,2>{0.718253493f, 0.101421528f},
-std::array<float,2>{0.347963244f, 0.895999432f},
-std::array<float,2>{0.786724389f, 0.683745921f},
-std::array<float,2>{0.113434665f, 0.385186225f},
-std::array<float,2>{0.953367472f, 0.273113906f},
-std::array<float,2>{0.194219396f, 0.533595443f},
-std::array<float,2>{0.580501854f, 0.750238001f},
-std::array<float,2>{0.387332022f, 0.150817499f},
-std::array<float,2>{0.504244506f, 0.482682347f},
-std::array<float,2>{0.441242129f, 0.743288398f},
-std::array<float,2>{0.885449648f, 0.951966465f},
-std::array<float,2>{0.126502916f, 0.0252616554f},
-std::array<float,2>{0.82087338f, 0.237915978f},
-std::array<float,2>{0.00524487812f, 0.840202212f},
-std::array<float,2>{0.630239367f, 0.614079356f},
-std::array<float,2>{0.254257381f, 0.328682035f},
-std::array<float,2>{0.601515591f, 0.159012541f},
-std::array<float,2>{0.406578809f, 0.782389641f},
-std::array<float,2>{0.990303755f, 0.52511251f},
-std::array<float,2>{0.244287178f, 0.308279753f},
-std::array<float,2>{0.75992775f, 0.410563916f},
-std::array<float,2>{0.091574356f, 0.64485836f},
-std::array<float,2>{0.727849007f, 0.92501545f},
-std::array<float,2>{0.329712152f, 0.0915036127f},
-std::array<float,2>{0.674905598f, 0.351793587f},
-std::array<float,2>{0.301298201f, 0.574709415f},
-std::array<float,2>{0.859501243f, 0.846361458f},
-std::array<float,2>{0.0416498668f, 0.203441843f},
-std::array<float,2>{0.914830148f, 0.0426551551f},
-std::array<float,2>{0.172212139f, 0.972474813f},
-std::array<float,2>{0.556218147f, 0.697154462f},
-std::array<float,2>{0.47338143f, 0.449227601f},
-std::array<float,2>{0.652786732f, 0.201020628f},
-std::array<float,2>{0.281224191f, 0.867654502f},
-std::array<float,2>{0.832491815f, 0.586208403f},
-std::array<float,2>{0.0259449743f, 0.372098178f},
-std::array<float,2>{0.900298953f, 0.462841809f},
-std::array<float,2>{0.14069289f, 0.707341313f},
-std::array<float,2>{0.51682049f, 0.992328882f},
-std::array<float,2>{0.460058272f, 0.0577623174f},
-std::array<float,2>{0.571311176f, 0.284042627f},
-std::array<float,2>{0.403493047f, 0.510416508f},
-std::array<float,2>{0.938349724f, 0.811169207f},
-std::array<float,2>{0.212701887f, 0.175885051f},
-std::array<float,2>{0.808338165f, 0.0645591468f},
-std::array<float,2>{0.103655711f, 0.916654766f},
-std::array<float,2>{0.700234592f, 0.630449295f},
-std::array<float,2>{0.363262117f, 0.433265656f},
-std::array<float,2>{0.531931579f, 0.00208965153f},
-std::array<float,2>{0.488282531f, 0.9579283f},
-std::array<float,2>{0.934652209f, 0.73336482f},
-std::array<float,2>{0.169021055f, 0.493576497f},
-std::array<float,2>{0.847733915f, 0.31878528f},
-std::array<float,2>{0.0572994649f, 0.594187856f},
-std::array<float,2>{0.670540571f, 0.823708296f},
-std::array<float,2>{0.284172267f, 0.224433511f},
-std::array<float,2>{0.746618211f, 0.394202709f},
-std::array<float,2>{0.324796766f, 0.657741487f},
-std::array<float,2>{0.772110939f, 0.883068562f},
-std::array<float,2>{0.0639999434f, 0.123139985f},
-std::array<float,2>{0.968891978f, 0.137473226f},
-std::array<float,2>{0.222390205f, 0.771405876f},
-std::array<float,2>{0.62429899f, 0.559081614f},
-std::array<float,2>{0.427074701f, 0.250428885f},
-std::array<float,2>{0.661272287f, 0.0474064797f},
-std::array<float,2>{0.289497435f, 0.991710722f},
-std::array<float,2>{0.853588879f, 0.716985941f},
-std::array<float,2>{0.0504099317f, 0.460310578f},
-std::array<float,2>{0.922339022f, 0.366604775f},
-std::array<float,2>{0.160643652f, 0.582941711f},
-std::array<float,2>{0.545594513f, 0.862091303f},
-std::array<float,2>{0.492762655f, 0.1950652f},
-std::array<float,2>{0.611142159f, 0.425100267f},
-std::array<float,2>{0.436670929f, 0.639764249f},
-std::array<float,2>{0.982018888f, 0.912709236f},
-std::array<float,2>{0.231860548f, 0.072575517f},
-std::array<float,2>{0.77377516f, 0.185691282f},
-std::array<float,2>{0.0736579895f, 0.803042173f},
-std::array<float,2>{0.734507143f, 0.505020797f},
-std::array<float,2>{0.315278172f, 0.294892877f},
-std::array<float,2>{0.530373871f, 0.234154955f},
-std::array<float,2>{0.463309765f, 0.814398468f},
-std::array<float,2>{0.89679116f, 0.602625191f},
-std::array<float,2>{0.153797299f, 0.321185738f},
-std::array<float,2>{0.835953653f, 0.48672241f},
-std::array<float,2>{0.0207395107f, 0.719478607f},
-std::array<float,2>{0.647993028f, 0.968648136f},
-std::array<float,2>{0.269657761f, 0.00873617455f},
-std::array<float,2>{0.693737566f, 0.258787543f},
-std::array<float,2>{0.369620383f, 0.552690923f},
-std::array<float,2>{0.802361906f, 0.780981541f},
-std::array<float,2>{0.099633202f, 0.129226997f},
-std::array<float,2>{0.952564418f, 0.110198997f},
-std::array<float,2>{0.209776014f, 0.880189776f},
-std::array<float,2>{0.568141222f, 0.671412587f},
-std::array<float,2>{0.393410891f, 0.399682939f},
-std::array<float,2>{0.725168586f, 0.148113072f},
-std::array<float,2>{0.340209901f, 0.764411509f},
-std::array<float,2>{0.756325305f, 0.545482099f},
-std::array<float,2>{0.0836799145f, 0.277758002f},
-std::array<float,2>{0.99542886f, 0.377841324f},
-std::array<float,2>{0.238860458f, 0.678459704f},
-std::array<float,2>{0.604823947f, 0.900128484f},
-std::array<float,2>{0.417032659f, 0.102603741f},
-std::array<float,2>{0.552417874f, 0.341443151f},
-std::array<float,2>{0.481556147f, 0.62460649f},
-std::array<float,2>{0.913414598f, 0.831485569f},
-std::array<float,2>{0.179872647f, 0.242511973f},
-std::array<float,2>{0.869575202f, 0.0185889322f},
-std::array<float,2>{0.0338503011f, 0.943317831f},
-std::array<float,2>{0.680504143f, 0.740868151f},
-std::array<float,2>{0.307427526f, 0.469200492f},
-std::array<float,2>{0.590005696f, 0.0843132511f},
-std::array<float,2>{0.376973033f, 0.935924292f},
-std::array<float,2>{0.961628318f, 0.652969897f},
-std::array<float,2>{0.202431977f, 0.421298206f},
-std::array<float,2>{0.790933669f, 0.299290061f},
-std::array<float,2>{0.122719854f, 0.521662712f},
-std::array<float,2>{0.703924298f, 0.796197295f},
-std::array<float,2>{0.35883376f, 0.17075251f},
-std::array<float,2>{0.633213222f, 0.43780455f},
-std::array<float,2>{0.262150168f, 0.693475842f},
-std::array<float,2>{0.817422867f, 0.983188689f},
-std::array<float,2>{0.0102144051f, 0.0379552878f},
-std::array<float,2>{0.880147219f, 0.215448931f},
-std::array<float,2>{0.132980376f, 0.853411734f},
-std::array<float,2>{0.511112332f, 0.568233609f},
-std::array<float,2>{0.449441642f, 0.348859519f},
-std::array<float,2>{0.678789377f, 0.11713852f},
-std::array<float,2>{0.297372311f, 0.877551138f},
-std::array<float,2>{0.864976525f, 0.667734385f},
-std::array<float,2>{0.04547479f, 0.40375337f},
-std::array<float,2>{0.920983851f, 0.262678772f},
-std::array<float,2>{0.179110855f, 0.550400972f},
-std::array<float,2>{0.558706105f, 0.773507953f},
-std::array<float,2>{0.472528815f, 0.128224924f},
-std::array<float,2>{0.594020009f, 0.490772337f},
-std::array<float,2>{0.410354286f, 0.725961804f},
-std::array<float,2>{0.985597312f, 0.964834571f},
-std::array<float,2>{0.248290315f, 0.0128946044f},
-std::array<float,2>{0.764537811f, 0.227333829f},
-std::array<float,2>{0.0884802788f, 0.818272769f},
-std::array<float,2>{0.734249115f, 0.606602371f},
-std::array<float,2>{0.334259868f, 0.324748129f},
-std::array<float,2>{0.503175437f, 0.181227311f},
-std::array<float,2>{0.44443509f, 0.798839092f},
-std::array<float,2>{0.888584673f, 0.503869414f},
-std::array<float,2>{0.129223689f, 0.291498959f},
-std::array<float,2>{0.827748239f, 0.426389515f},
-std::array<float,2>{0.00231675943f, 0.634191394f},
-std::array<float,2>{0.628221929f, 0.907961607f},
-std::array<float,2>{0.253497243f, 0.0764883384f},
-std::array<float,2>{0.712448776f, 0.361339033f},
-std::array<float,2>{0.344333649f, 0.580627382f},
-std::array<float,2>{0.783626139f, 0.865875006f},
-std::array<float,2>{0.113028258f, 0.188948408f},
-std::array<float,2>{0.95989877f, 0.0522775352f},
-std::array<float,2>{0.18827866f, 0.986174345f},
-std::array<float,2>{0.585341573f, 0.71158123f},
-std::array<float,2>{0.386474162f, 0.45474574f},
-std::array<float,2>{0.742791295f, 0.212796465f},
-std::array<float,2>{0.320739716f, 0.85934335f},
-std::array<float,2>{0.768103838f, 0.563360929f},
-std::array<float,2>{0.0693198591f, 0.343773812f},
-std::array<float,2>{0.976469278f, 0.443661779f},
-std::array<float,2>{0.223311275f, 0.689437807f},
-std::array<float,2>{0.620094121f, 0.979189038f},
-std::array<float,2>{0.423187912f, 0.0332976729f},
-std::array<float,2>{0.538567781f, 0.301670581f},
-std::array<float,2>{0.484943628f, 0.518650889f},
-std::array<float,2>{0.932004929f, 0.789164305f},
-std::array<float,2>{0.16583927f, 0.167323411f},
-std::array<float,2>{0.847490191f, 0.0807769448f},
-std::array<float,2>{0.0612297766f, 0.929725826f},
-std::array<float,2>{0.666755319f, 0.648840666f},
-std::array<float,2>{0.287724137f, 0.417661965f},
-std::array<float,2>{0.575916946f, 0.0213238988f},
-std::array<float,2>{0.401799053f, 0.939294636f},
-std::array<float,2>{0.943094194f, 0.737768233f},
-std::array<float,2>{0.215716437f, 0.474606663f},
-std::array<float,2>{0.811608553f, 0.337620437f},
-std::array<float,2>{0.106903195f, 0.617699862f},
-std::array<float,2>{0.696866274f, 0.834460437f},
-std::array<float,2>{0.366411507f, 0.249862731f},
-std::array<float,2>{0.650371671f, 0.379394859f},
-std::array<float,2>{0.273861259f, 0.675774813f},
-std::array<float,2>{0.831270993f, 0.905011773f},
-std::array<float,2>{0.0301091783f, 0.105785318f},
-std::array<float,2>{0.904403985f, 0.141161382f},
-std::array<float,2>{0.147066012f, 0.76041168f},
-std::array<float,2>{0.520893097f, 0.539342701f},
-std::array<float,2>{0.454286903f, 0.274708033f},
-std::array<float,2>{0.689790726f, 0.0464415252f},
-std::array<float,2>{0.373606086f, 0.975114524f},
-std::array<float,2>{0.797621608f, 0.701988697f},
-std::array<float,2>{0.0952864215f, 0.448460907f},
-std::array<float,2>{0.948544443f, 0.356423974f},
-std::array<float,2>{0.203688338f, 0.573569f},
-std::array<float,2>{0.564633608f, 0.849475265f},
-std::array<float,2>{0.39803496f, 0.207174152f},
-std::array<float,2>{0.525972784f, 0.407806337f},
-std::array<float,2>{0.466266215f, 0.640880942f},
-std::array<float,2>{0.893881321f, 0.926393628f},
-std::array<float,2>{0.151974142f, 0.087457478f},
-std::array<float,2>{0.840248346f, 0.163255349f},
-std::array<float,2>{0.0180872604f, 0.787971973f},
-std::array<float,2>{0.64114809f, 0.52759105f},
-std::array<float,2>{0.266185939f, 0.310793906f},
-std::array<float,2>{0.614971519f, 0.239697322f},
-std::array<float,2>{0.430766672f, 0.839686751f},
-std::array<float,2>{0.980262339f, 0.610229611f},
-std::array<float,2>{0.227628857f, 0.332773626f},
-std::array<float,2>{0.77771312f, 0.480365723f},
-std::array<float,2>{0.0777108297f, 0.747661591f},
-std::array<float,2>{0.74046284f, 0.948203862f},
-std::array<float,2>{0.318115532f, 0.0287600495f},
-std::array<float,2>{0.658253491f, 0.267929286f},
-std::array<float,2>{0.296406507f, 0.537741005f},
-std::array<float,2>{0.856746316f, 0.754371107f},
-std::array<float,2>{0.051674623f, 0.155639544f},
-std::array<float,2>{0.926802337f, 0.0943792835f},
-std::array<float,2>{0.156251445f, 0.892173469f},
-std::array<float,2>{0.539336503f, 0.680641413f},
-std::array<float,2>{0.499763429f, 0.388140291f},
-std::array<float,2>{0.640512645f, 0.136276677f},
-std::array<float,2>{0.260750145f, 0.769280553f},
-std::array<float,2>{0.813603759f, 0.556910872f},
-std::array<float,2>{0.0128550613f, 0.256953001f},
-std::array<float,2>{0.875113368f, 0.394630492f},
-std::array<float,2>{0.137715995f, 0.661445439f},
-std::array<float,2>{0.514252961f, 0.887765706f},
-std::array<float,2>{0.448621869f, 0.119681098f},
-std::array<float,2>{0.589104593f, 0.31446439f},
-std::array<float,2>{0.379705995f, 0.599294305f},
-std::array<float,2>{0.965545833f, 0.824371338f},
-std::array<float,2>{0.195987582f, 0.221405745f},
-std::array<float,2>{0.795524538f, 0.00504775718f},
-std::array<float,2>{0.119692199f, 0.956583858f},
-std::array<float,2>{0.709231138f, 0.728836536f},
-std::array<float,2>{0.353321642f, 0.499515682f},
-std::array<float,2>{0.549438238f, 0.0677846447f},
-std::array<float,2>{0.477677315f, 0.920329928f},
-std::array<float,2>{0.909983397f, 0.628733635f},
-std::array<float,2>{0.18504335f, 0.435390502f},
-std::array<float,2>{0.871902943f, 0.285625398f},
-std::array<float,2>{0.0367725752f, 0.514950097f},
-std::array<float,2>{0.686151087f, 0.80810678f},
-std::array<float,2>{0.310665905f, 0.173669726f},
-std::array<float,2>{0.719166934f, 0.467590064f},
-std::array<float,2>{0.337123185f, 0.703198135f},
-std::array<float,2>{0.752249479f, 0.999062419f},
-std::array<float,2>{0.0794752538f, 0.0588898547f},
-std::array<float,2>{0.997871876f, 0.197100088f},
-std::array<float,2>{0.236932382f, 0.872146904f},
-std::array<float,2>{0.606226683f, 0.591141462f},
-std::array<float,2>{0.418068498f, 0.367301434f},
-std::array<float,2>{0.728794038f, 0.0925711766f},
-std::array<float,2>{0.331993043f, 0.9223032f},
-std::array<float,2>{0.75821197f, 0.648275614f},
-std::array<float,2>{0.0932510942f, 0.412949562f},
-std::array<float,2>{0.988392234f, 0.305732071f},
-std::array<float,2>{0.244027495f, 0.527181625f},
-std::array<float,2>{0.598362625f, 0.784188807f},
-std::array<float,2>{0.409708053f, 0.157488063f},
-std::array<float,2>{0.557340682f, 0.451296687f},
-std::array<float,2>{0.47511521f, 0.698442221f},
-std::array<float,2>{0.917168856f, 0.970134079f},
-std::array<float,2>{0.174672753f, 0.0394033603f},
-std::array<float,2>{0.861380756f, 0.206332162f},
-std::array<float,2>{0.0399525575f, 0.844905078f},
-std::array<float,2>{0.672115088f, 0.578054368f},
-std::array<float,2>{0.304119974f, 0.353549302f},
-std::array<float,2>{0.578351378f, 0.148622423f},
-std::array<float,2>{0.390214682f, 0.752143681f},
-std::array<float,2>{0.955323517f, 0.531932652f},
-std::array<float,2>{0.192418382f, 0.270042479f},
-std::array<float,2>{0.788309216f, 0.382813841f},
-std::array<float,2>{0.116480388f, 0.687196434f},
-std::array<float,2>{0.716141999f, 0.896769762f},
-std::array<float,2>{0.349791557f, 0.0984043255f},
-std::array<float,2>{0.631637812f, 0.330659777f},
-std::array<float,2>{0.257178396f, 0.616195083f},
-std::array<float,2>{0.823533595f, 0.843097568f},
-std::array<float,2>{0.00604234543f, 0.235039711f},
-std::array<float,2>{0.884267867f, 0.0273105018f},
-std::array<float,2>{0.127119228f, 0.950198591f},
-std::array<float,2>{0.506562352f, 0.745092928f},
-std::array<float,2>{0.438513339f, 0.482121319f},
-std::array<float,2>{0.66924715f, 0.225591347f},
-std::array<float,2>{0.281488806f, 0.821954072f},
-std::array<float,2>{0.850498378f, 0.596444309f},
-std::array<float,2>{0.0549479052f, 0.318112791f},
-std::array<float,2>{0.937104762f, 0.494983763f},
-std::array<float,2>{0.171828523f, 0.732190192f},
-std::array<float,2>{0.533564508f, 0.959581494f},
-std::array<float,2>{0.490882248f, 0.000998939038f},
-std::array<float,2>{0.622412384f, 0.253832757f},
-std::array<float,2>{0.427859277f, 0.560817957f},
-std::array<float,2>{0.971279621f, 0.773212492f},
-std::array<float,2>{0.220638692f, 0.140501603f},
-std::array<float,2>{0.769833744f, 0.122848496f},
-std::array<float,2>{0.0647282079f, 0.885632753f},
-std::array<float,2>{0.749961138f, 0.659206092f},
-std::array<float,2>{0.328071713f, 0.391642928f},
-std::array<float,2>{0.517834604f, 0.0548253693f},
-std::array<float,2>{0.458247215f, 0.995357633f},
-std::array<float,2>{0.902342677f, 0.710387111f},
-std::array<float,2>{0.143081039f, 0.464622974f},
-std::array<float,2>{0.835118294f, 0.373513103f},
-std::array<float,2>{0.0237559583f, 0.588035822f},
-std::array<float,2>{0.656081617f, 0.869836569f},
-std::array<float,2>{0.277754366f, 0.202379718f},
-std::array<float,2>{0.702383518f, 0.430413425f},
-std::array<float,2>{0.361229628f, 0.63149935f},
-std::array<float,2>{0.804973006f, 0.915928423f},
-std::array<float,2>{0.102839254f, 0.0632386804f},
-std::array<float,2>{0.940622091f, 0.179603994f},
-std::array<float,2>{0.213032037f, 0.810008347f},
-std::array<float,2>{0.572561979f, 0.509542644f},
-std::array<float,2>{0.405517012f, 0.282173067f},
-std::array<float,2>{0.644774973f, 0.0115698632f},
-std::array<float,2>{0.271784872f, 0.965412736f},
-std::array<float,2>{0.839559674f, 0.721253932f},
-std::array<float,2>{0.0225431602f, 0.485054493f},
-std::array<float,2>{0.895636976f, 0.323451996f},
-std::array<float,2>{0.15553166f, 0.603708088f},
-std::array<float,2>{0.529287636f, 0.814687788f},
-std::array<float,2>{0.460943997f, 0.230788782f},
-std::array<float,2>{0.568891466f, 0.400391519f},
-std::array<float,2>{0.391716719f, 0.668356895f},
-std::array<float,2>{0.949950576f, 0.881366014f},
-std::array<float,2>{0.207485184f, 0.11153122f},
-std::array<float,2>{0.803373098f, 0.132422507f},
-std::array<float,2>{0.0991566032f, 0.778593719f},
-std::array<float,2>{0.693237543f, 0.553936362f},
-std::array<float,2>{0.368846387f, 0.260226309f},
-std::array<float,2>{0.543038607f, 0.192483649f},
-std::array<float,2>{0.494526207f, 0.859709799f},
-std::array<float,2>{0.923912942f, 0.585584819f},
-std::array<float,2>{0.163889587f, 0.364336073f},
-std::array<float,2>{0.851621985f, 0.457286656f},
-std::array<float,2>{0.0484612733f, 0.716408551f},
-std::array<float,2>{0.662559628f, 0.989474714f},
-std::array<float,2>{0.292156786f, 0.0507757477f},
-std::array<float,2>{0.736368299f, 0.295908481f},
-std::array<float,2>{0.313513279f, 0.50766778f},
-std::array<float,2>{0.776783288f, 0.800880373f},
-std::array<float,2>{0.0720553324f, 0.184284195f},
-std::array<float,2>{0.984106004f, 0.0714069754f},
-std::array<float,2>{0.233882934f, 0.91028434f},
-std::array<float,2>{0.611636937f, 0.637616158f},
-std::array<float,2>{0.433870524f, 0.422242403f},
-std::array<float,2>{0.706526756f, 0.168502286f},
-std::array<float,2>{0.357053488f, 0.793677866f},
-std::array<float,2>{0.791586637f, 0.520229459f},
-std::array<float,2>{0.123879224f, 0.298467517f},
-std::array<float,2>{0.964278638f, 0.418802738f},
-std::array<float,2>{0.199606702f, 0.655616641f},
-std::array<float,2>{0.591907442f, 0.934513748f},
-std::array<float,2>{0.375000805f, 0.0839525759f},
-std::array<float,2>{0.509188414f, 0.350729734f},
-std::array<float,2>{0.453097463f, 0.56956321f},
-std::array<float,2>{0.882755876f, 0.854381919f},
-std::array<float,2>{0.134869426f, 0.217298985f},
-std::array<float,2>{0.820100844f, 0.0355869122f},
-std::array<float,2>{0.00888834521f, 0.981178463f},
-std::array<float,2>{0.635079145f, 0.692894459f},
-std::array<float,2>{0.265447587f, 0.439850926f},
-std::array<float,2>{0.603321254f, 0.103921518f},
-std::array<float,2>{0.415737063f, 0.901282251f},
-std::array<float,2>{0.993754566f, 0.676329434f},
-std::array<float,2>{0.240350321f, 0.375418484f},
-std::array<float,2>{0.755272925f, 0.279904723f},
-std::array<float,2>{0.0847560242f, 0.543204486f},
-std::array<float,2>{0.723331213f, 0.76200664f},
-std::array<float,2>{0.343317419f, 0.145489752f},
-std::array<float,2>{0.683280408f, 0.472008705f},
-std::array<float,2>{0.305181623f, 0.738699496f},
-std::array<float,2>{0.867326975f, 0.94392103f},
-std::array<float,2>{0.0317251235f, 0.0173928589f},
-std::array<float,2>{0.910281599f, 0.244737908f},
-std::array<float,2>{0.183560848f, 0.829292357f},
-std::array<float,2>{0.552812636f, 0.622072875f},
-std::array<float,2>{0.482645363f, 0.342449963f},
-std::array<float,2>{0.650515914f, 0.106607333f},
-std::array<float,2>{0.276130706f, 0.906092703f},
-std::array<float,2>{0.829504609f, 0.674431384f},
-std::array<float,2>{0.0285215303f, 0.379948378f},
-std::array<float,2>{0.902885616f, 0.273882538f},
-std::array<float,2>{0.144566745f, 0.540897906f},
-std::array<float,2>{0.521971941f, 0.76135546f},
-std::array<float,2>{0.456879526f, 0.142046094f},
-std::array<float,2>{0.57695806f, 0.473521322f},
-std::array<float,2>{0.399474561f, 0.737095475f},
-std::array<float,2>{0.945081472f, 0.937983215f},
-std::array<float,2>{0.217394501f, 0.0196251292f},
-std::array<float,2>{0.810500264f, 0.248777837f},
-std::array<float,2>{0.107719027f, 0.835917652f},
-std::array<float,2>{0.699039698f, 0.618257344f},
-std::array<float,2>{0.364974946f, 0.335959673f},
-std::array<float,2>{0.535758495f, 0.166271061f},
-std::array<float,2>{0.487284392f, 0.790258586f},
-std::array<float,2>{0.929705977f, 0.518040836f},
-std::array<float,2>{0.167554528f, 0.302426487f},
-std::array<float,2>{0.844578803f, 0.416494459f},
-std::array<float,2>{0.0599381365f, 0.649948657f},
-std::array<float,2>{0.664435029f, 0.931544483f},
-std::array<float,2>{0.285766751f, 0.0811021701f},
-std::array<float,2>{0.744669676f, 0.345425129f},
-std::array<float,2>{0.323660374f, 0.56370616f},
-std::array<float,2>{0.766452312f, 0.857828438f},
-std::array<float,2>{0.0682559982f, 0.211584345f},
-std::array<float,2>{0.974416018f, 0.0342340767f},
-std::array<float,2>{0.225110292f, 0.980367422f},
-std::array<float,2>{0.618322849f, 0.688167214f},
-std::array<float,2>{0.424573511f, 0.444446474f},
-std::array<float,2>{0.713260114f, 0.188424125f},
-std::array<float,2>{0.346847892f, 0.866691589f},
-std::array<float,2>{0.782496512f, 0.581192315f},
-std::array<float,2>{0.110371277f, 0.362695098f},
-std::array<float,2>{0.95847106f, 0.454061329f},
-std::array<float,2>{0.190051213f, 0.712289751f},
-std::array<float,2>{0.582678854f, 0.984437108f},
-std::array<float,2>{0.384290576f, 0.0515050143f},
-std::array<float,2>{0.500291049f, 0.2924833f},
-std::array<float,2>{0.442956299f, 0.502243459f},
-std::array<float,2>{0.889352381f, 0.800703168f},
-std::array<float,2>{0.131921753f, 0.180271953f},
-std::array<float,2>{0.826128721f, 0.0774014816f},
-std::array<float,2>{0.00122073269f, 0.906722248f},
-std::array<float,2>{0.626936138f, 0.633373439f},
-std::array<float,2>{0.250086397f, 0.42733416f},
-std::array<float,2>{0.596624494f, 0.0123123089f},
-std::array<float,2>{0.412916481f, 0.963096499f},
-std::array<float,2>{0.986776829f, 0.724803448f},
-std::array<float,2>{0.246272415f, 0.49184525f},
-std::array<float,2>{0.762642682f, 0.325363338f},
-std::array<float,2>{0.0871953443f, 0.606005192f},
-std::array<float,2>{0.731649816f, 0.816541612f},
-std::array<float,2>{0.332956523f, 0.227663428f},
-std::array<float,2>{0.676886797f, 0.40274924f},
-std::array<float,2>{0.29914856f, 0.666499197f},
-std::array<float,2>{0.867169797f, 0.878833532f},
-std::array<float,2>{0.0444115438f, 0.116111666f},
-std::array<float,2>{0.919359267f, 0.127601698f},
-std::array<float,2>{0.177563339f, 0.77473098f},
-std::array<float,2>{0.562416971f, 0.549493849f},
-std::array<float,2>{0.470394731f, 0.263666958f},
-std::array<float,2>{0.720813692f, 0.060493011f},
-std::array<float,2>{0.338941962f, 0.998049021f},
-std::array<float,2>{0.751350522f, 0.704906762f},
-std::array<float,2>{0.0806534663f, 0.468565345f},
-std::array<float,2>{0.998320937f, 0.368360609f},
-std::array<float,2>{0.234835774f, 0.590644836f},
-std::array<float,2>{0.607887805f, 0.871472001f},
-std::array<float,2>{0.421707094f, 0.195349112f},
-std::array<float,2>{0.547992766f, 0.434123158f},
-std::array<float,2>{0.479138255f, 0.627484977f},
-std::array<float,2>{0.907404304f, 0.921470761f},
-std::array<float,2>{0.186346129f, 0.0668258294f},
-std::array<float,2>{0.87365371f, 0.172025353f},
-std::array<float,2>{0.0378280915f, 0.806851685f},
-std::array<float,2>{0.684583426f, 0.514038146f},
-std::array<float,2>{0.31038624f, 0.287075162f},
-std::array<float,2>{0.587116897f, 0.222212762f},
-std::array<float,2>{0.382781774f, 0.825923562f},
-std::array<float,2>{0.967596829f, 0.597660661f},
-std::array<float,2>{0.198713452f, 0.315669596f},
-std::array<float,2>{0.792983055f, 0.498362392f},
-std::array<float,2>{0.117681235f, 0.729871392f},
-std::array<float,2>{0.708300769f, 0.955105364f},
-std::array<float,2>{0.353870571f, 0.00459438004f},
-std::array<float,2>{0.638530433f, 0.255908102f},
-std::array<float,2>{0.258976609f, 0.557856321f},
-std::array<float,2>{0.814926088f, 0.7685197f},
-std::array<float,2>{0.0147153735f, 0.13553074f},
-std::array<float,2>{0.87795651f, 0.120349199f},
-std::array<float,2>{0.139731809f, 0.886855841f},
-std::array<float,2>{0.511876941f, 0.660585403f},
-std::array<float,2>{0.447085917f, 0.395683408f},
-std::array<float,2>{0.657641649f, 0.154543132f},
-std::array<float,2>{0.294797808f, 0.755735993f},
-std::array<float,2>{0.858388424f, 0.538910806f},
-std::array<float,2>{0.0541843735f, 0.269470692f},
-std::array<float,2>{0.929492891f, 0.387097061f},
-std::array<float,2>{0.158962265f, 0.681094825f},
-std::array<float,2>{0.541339934f, 0.891057372f},
-std::array<float,2>{0.497381657f, 0.0956451222f},
-std::array<float,2>{0.616203666f, 0.333660305f},
-std::array<float,2>{0.433293521f, 0.611006498f},
-std::array<float,2>{0.977894962f, 0.838737011f},
-std::array<float,2>{0.228943288f, 0.238915488f},
-std::array<float,2>{0.780323803f, 0.028309714f},
-std::array<float,2>{0.0753016397f, 0.949121892f},
-std::array<float,2>{0.739693403f, 0.746680617f},
-std::array<float,2>{0.319233149f, 0.478659928f},
-std::array<float,2>{0.523809552f, 0.0863395408f},
-std::array<float,2>{0.468523294f, 0.92761898f},
-std::array<float,2>{0.891808867f, 0.641862392f},
-std::array<float,2>{0.14957042f, 0.406322688f},
-std::array<float,2>{0.842350602f, 0.312171429f},
-std::array<float,2>{0.017097963f, 0.529019177f},
-std::array<float,2>{0.644176722f, 0.788441658f},
-std::array<float,2>{0.269239694f, 0.162545547f},
-std::array<float,2>{0.68761009f, 0.448044717f},
-std::array<float,2>{0.371409237f, 0.702223301f},
-std::array<float,2>{0.799732924f, 0.97581929f},
-std::array<float,2>{0.0970896035f, 0.0458160229f},
-std::array<float,2>{0.946304142f, 0.20845373f},
-std::array<float,2>{0.206971943f, 0.848052919f},
-std::array<float,2>{0.563797295f, 0.573206902f},
-std::array<float,2>{0.395506203f, 0.357006758f},
-std::array<float,2>{0.699408948f, 0.0639019236f},
-std::array<float,2>{0.361544877f, 0.915014327f},
-std::array<float,2>{0.807235718f, 0.632285416f},
-std::array<float,2>{0.104935698f, 0.431367636f},
-std::array<float,2>{0.938863695f, 0.28276971f},
-std::array<float,2>{0.211508647f, 0.508639455f},
-std::array<float,2>{0.571169853f, 0.809316039f},
-std::array<float,2>{0.403304219f, 0.178405717f},
-std::array<float,2>{0.516136825f, 0.462939382f},
-std::array<float,2>{0.459742963f, 0.709268272f},
-std::array<float,2>{0.898980677f, 0.994863451f},
-std::array<float,2>{0.142305583f, 0.0559553429f},
-std::array<float,2>{0.833368838f, 0.2019099f},
-std::array<float,2>{0.0269197561f, 0.870540619f},
-std::array<float,2>{0.654042184f, 0.589385927f},
-std::array<float,2>{0.280243367f, 0.374987602f},
-std::array<float,2>{0.623338103f, 0.139461324f},
-std::array<float,2>{0.426156819f, 0.772034883f},
-std::array<float,2>{0.970201254f, 0.562360346f},
-std::array<float,2>{0.220873535f, 0.252138853f},
-std::array<float,2>{0.772749722f, 0.391015023f},
-std::array<float,2>{0.0627075285f, 0.658443689f},
-std::array<float,2>{0.747609258f, 0.886662662f},
-std::array<float,2>{0.326111466f, 0.121748656f},
-std::array<float,2>{0.671480536f, 0.31701678f},
-std::array<float,2>{0.28431657f, 0.597030342f},
-std::array<float,2>{0.848829031f, 0.821164668f},
-std::array<float,2>{0.0578165799f, 0.224689201f},
-std::array<float,2>{0.934316933f, 0.000672922528f},
-std::array<float,2>{0.168690711f, 0.960369825f},
-std::array<float,2>{0.532397628f, 0.730894744f},
-std::array<float,2>{0.489447504f, 0.495871931f},
-std::array<float,2>{0.629548311f, 0.235651597f},
-std::array<float,2>{0.255131096f, 0.842637897f},
-std::array<float,2>{0.821912467f, 0.616568089f},
-std::array<float,2>{0.00444495026f, 0.331933677f},
-std::array<float,2>{0.88623929f, 0.481062263f},
-std::array<float,2>{0.125697717f, 0.745414436f},
-std::array<float,2>{0.505759001f, 0.949746668f},
-std::array<float,2>{0.439721555f, 0.0260056928f},
-std::array<float,2>{0.581698596f, 0.271305472f},
-std::array<float,2>{0.388337612f, 0.532609522f},
-std::array<float,2>{0.954573035f, 0.753814161f},
-std::array<float,2>{0.194508389f, 0.150118738f},
-std::array<float,2>{0.78601861f, 0.0991872847f},
-std::array<float,2>{0.115051188f, 0.898378134f},
-std::array<float,2>{0.717399657f, 0.686513543f},
-std::array<float,2>{0.34871456f, 0.384548217f},
-std::array<float,2>{0.555385351f, 0.0405646637f},
-std::array<float,2>{0.474401146f, 0.968950987f},
-std::array<float,2>{0.915108621f, 0.698218822f},
-std::array<float,2>{0.173426867f, 0.453027427f},
-std::array<float,2>{0.861200809f, 0.35508427f},
-std::array<float,2>{0.0422503017f, 0.576807201f},
-std::array<float,2>{0.673930824f, 0.84375f},
-std::array<float,2>{0.302006662f, 0.205444112f},
-std::array<float,2>{0.726897836f, 0.413502961f},
-std::array<float,2>{0.32858178f, 0.646759987f},
-std::array<float,2>{0.761645794f, 0.923187077f},
-std::array<float,2>{0.089971222f, 0.0928754807f},
-std::array<float,2>{0.991337299f, 0.156723529f},
-std::array<float,2>{0.245980874f, 0.783656776f},
-std::array<float,2>{0.59967339f, 0.525969625f},
-std::array<float,2>{0.40751335f, 0.305663556f},
-std::array<float,2>{0.680829167f, 0.0159053896f},
-std::array<float,2>{0.308569849f, 0.945252478f},
-std::array<float,2>{0.870463789f, 0.740087032f},
-std::array<float,2>{0.0348167308f, 0.470945686f},
-std::array<float,2>{0.912425339f, 0.343718112f},
-std::array<float,2>{0.181259081f, 0.621231139f},
-std::array<float,2>{0.551469862f, 0.82833451f},
-std::array<float,2>{0.481366903f, 0.245304197f},
-std::array<float,2>{0.603728592f, 0.376593113f},
-std::array<float,2>{0.416763455f, 0.677449524f},
-std::array<float,2>{0.995116889f, 0.901912808f},
-std::array<float,2>{0.239413917f, 0.105038419f},
-std::array<float,2>{0.757807493f, 0.145575702f},
-std::array<float,2>{0.08225362f, 0.76303345f},
-std::array<float,2>{0.726021588f, 0.544265211f},
-std::array<float,2>{0.341205537f, 0.281029433f},
-std::array<float,2>{0.509790063f, 0.217998534f},
-std::array<float,2>{0.450637877f, 0.855207741f},
-std::array<float,2>{0.879722476f, 0.56851989f},
-std::array<float,2>{0.134551555f, 0.349925905f},
-std::array<float,2>{0.817270756f, 0.440662771f},
-std::array<float,2>{0.0108166672f, 0.691895247f},
-std::array<float,2>{0.63437748f, 0.98202765f},
-std::array<float,2>{0.262870967f, 0.0370789096f},
-std::array<float,2>{0.7045362f, 0.29728359f},
-std::array<float,2>{0.35813579f, 0.520679593f},
-std::array<float,2>{0.789673269f, 0.794819117f},
-std::array<float,2>{0.12188749f, 0.16954194f},
-std::array<float,2>{0.962328792f, 0.0823180899f},
-std::array<float,2>{0.202077702f, 0.935343742f},
-std::array<float,2>{0.591678977f, 0.654734373f},
-std::array<float,2>{0.378586292f, 0.419827163f},
-std::array<float,2>{0.735523999f, 0.185161084f},
-std::array<float,2>{0.31558004f, 0.802219272f},
-std::array<float,2>{0.7745682f, 0.506612599f},
-std::array<float,2>{0.0724859312f, 0.295312285f},
-std::array<float,2>{0.980699837f, 0.422998101f},
-std::array<float,2>{0.230819359f, 0.638473749f},
-std::array<float,2>{0.609842718f, 0.911318243f},
-std::array<float,2>{0.436239064f, 0.0704370588f},
-std::array<float,2>{0.545940042f, 0.363315016f},
-std::array<float,2>{0.493210673f, 0.584223688f},
-std::array<float,2>{0.923032701f, 0.861082733f},
-std::array<float,2>{0.161965296f, 0.191486552f},
-std::array<float,2>{0.855065286f, 0.0493433848f},
-std::array<float,2>{0.0497485735f, 0.988944113f},
-std::array<float,2>{0.660455465f, 0.715010285f},
-std::array<float,2>{0.290346622f, 0.458228946f},
-std::array<float,2>{0.56683594f, 0.113245614f},
-std::array<float,2>{0.393806964f, 0.882109702f},
-std::array<float,2>{0.951957166f, 0.669605911f},
-std::array<float,2>{0.210839629f, 0.402277976f},
-std::array<float,2>{0.800969303f, 0.260779858f},
-std::array<float,2>{0.100662f, 0.553660333f},
-std::array<float,2>{0.695250094f, 0.777759612f},
-std::array<float,2>{0.371060729f, 0.131329611f},
-std::array<float,2>{0.646517038f, 0.48542273f},
-std::array<float,2>{0.270691454f, 0.722407341f},
-std::array<float,2>{0.837771475f, 0.966552854f},
-std::array<float,2>{0.0198227428f, 0.0106274318f},
-std::array<float,2>{0.897584379f, 0.23236382f},
-std::array<float,2>{0.153298035f, 0.816172361f},
-std::array<float,2>{0.529681206f, 0.604515851f},
-std::array<float,2>{0.464015454f, 0.322583884f},
-std::array<float,2>{0.667122185f, 0.0783403665f},
-std::array<float,2>{0.288844854f, 0.933197021f},
-std::array<float,2>{0.845792174f, 0.650693774f},
-std::array<float,2>{0.0615879409f, 0.415263057f},
-std::array<float,2>{0.933440864f, 0.302978754f},
-std::array<float,2>{0.164844528f, 0.517257154f},
-std::array<float,2>{0.537594855f, 0.791615486f},
-std::array<float,2>{0.485898107f, 0.165062293f},
-std::array<float,2>{0.620899379f, 0.442533582f},
-std::array<float,2>{0.422519892f, 0.690672517f},
-std::array<float,2>{0.974814177f, 0.977588475f},
-std::array<float,2>{0.223874733f, 0.0324555449f},
-std::array<float,2>{0.768884659f, 0.21447219f},
-std::array<float,2>{0.0694034994f, 0.856479406f},
-std::array<float,2>{0.743790329f, 0.564831138f},
-std::array<float,2>{0.32134974f, 0.346270889f},
-std::array<float,2>{0.519778311f, 0.143579111f},
-std::array<float,2>{0.453236818f, 0.757942438f},
-std::array<float,2>{0.906148314f, 0.541760027f},
-std::array<float,2>{0.147559866f, 0.275405109f},
-std::array<float,2>{0.830999672f, 0.381507009f},
-std::array<float,2>{0.0309695788f, 0.672976971f},
-std::array<float,2>{0.649181843f, 0.90410322f},
-std::array<float,2>{0.274770677f, 0.108186066f},
-std::array<float,2>{0.695475578f, 0.339396596f},
-std::array<float,2>{0.365473598f, 0.620854974f},
-std::array<float,2>{0.811284363f, 0.833653808f},
-std::array<float,2>{0.105653577f, 0.246874228f},
-std::array<float,2>{0.941927373f, 0.0233395845f},
-std::array<float,2>{0.216263354f, 0.940414906f},
-std::array<float,2>{0.574579477f, 0.734989345f},
-std::array<float,2>{0.401043952f, 0.476008028f},
-std::array<float,2>{0.732641697f, 0.22991994f},
-std::array<float,2>{0.335353494f, 0.819840252f},
-std::array<float,2>{0.764774144f, 0.607674479f},
-std::array<float,2>{0.0888912529f, 0.327989548f},
-std::array<float,2>{0.98516655f, 0.490026981f},
-std::array<float,2>{0.249675557f, 0.723709822f},
-std::array<float,2>{0.594808817f, 0.962131321f},
-std::array<float,2>{0.411745608f, 0.0150100579f},
-std::array<float,2>{0.560424626f, 0.264853865f},
-std::array<float,2>{0.471190333f, 0.547264755f},
-std::array<float,2>{0.920433879f, 0.77699399f},
-std::array<float,2>{0.177830443f, 0.125599638f},
-std::array<float,2>{0.8633672f, 0.113746546f},
-std::array<float,2>{0.0463852882f, 0.876603663f},
-std::array<float,2>{0.678480387f, 0.665201783f},
-std::array<float,2>{0.298238993f, 0.406171978f},
-std::array<float,2>{0.584319949f, 0.0539597385f},
-std::array<float,2>{0.385540485f, 0.986885548f},
-std::array<float,2>{0.960779488f, 0.713268757f},
-std::array<float,2>{0.189302683f, 0.455791563f},
-std::array<float,2>{0.785009503f, 0.361046672f},
-std::array<float,2>{0.111745864f, 0.578408539f},
-std::array<float,2>{0.711772859f, 0.865000248f},
-std::array<float,2>{0.344805896f, 0.190988362f},
-std::array<float,2>{0.62755543f, 0.428449839f},
-std::array<float,2>{0.252488911f, 0.634985805f},
-std::array<float,2>{0.826794028f, 0.908748269f},
-std::array<float,2>{0.00317397411f, 0.0744460225f},
-std::array<float,2>{0.887542486f, 0.183127865f},
-std::array<float,2>{0.130445614f, 0.798629463f},
-std::array<float,2>{0.502510726f, 0.500631928f},
-std::array<float,2>{0.444066286f, 0.289277941f},
-std::array<float,2>{0.71027267f, 0.00654985849f},
-std::array<float,2>{0.352351964f, 0.953243971f},
-std::array<float,2>{0.795928836f, 0.727444351f},
-std::array<float,2>{0.120341532f, 0.497917235f},
-std::array<float,2>{0.96647352f, 0.313379943f},
-std::array<float,2>{0.19633691f, 0.599829018f},
-std::array<float,2>{0.588435769f, 0.827962816f},
-std::array<float,2>{0.380000949f, 0.220293924f},
-std::array<float,2>{0.515175641f, 0.397038341f},
-std::array<float,2>{0.447482824f, 0.66379261f},
-std::array<float,2>{0.876003087f, 0.888751447f},
-std::array<float,2>{0.137455285f, 0.117772944f},
-std::array<float,2>{0.812746108f, 0.132956997f},
-std::array<float,2>{0.0125178695f, 0.766510665f},
-std::array<float,2>{0.639460146f, 0.555680573f},
-std::array<float,2>{0.260017663f, 0.254197329f},
-std::array<float,2>{0.607311428f, 0.198924407f},
-std::array<float,2>{0.419048995f, 0.873908639f},
-std::array<float,2>{0.996323943f, 0.592646778f},
-std::array<float,2>{0.237480447f, 0.369187772f},
-std::array<float,2>{0.752933741f, 0.466486812f},
-std::array<float,2>{0.0787353665f, 0.706827044f},
-std::array<float,2>{0.720233738f, 0.996656835f},
-std::array<float,2>{0.336839318f, 0.0620275103f},
-std::array<float,2>{0.68664223f, 0.288974136f},
-std::array<float,2>{0.31237787f, 0.512866914f},
-std::array<float,2>{0.872905314f, 0.806420028f},
-std::array<float,2>{0.0351842418f, 0.175167471f},
-std::array<float,2>{0.908316553f, 0.0696537867f},
-std::array<float,2>{0.184177801f, 0.919689834f},
-std::array<float,2>{0.550289929f, 0.625767529f},
-std::array<float,2>{0.476831377f, 0.436726779f},
-std::array<float,2>{0.641953707f, 0.162018895f},
-std::array<float,2>{0.267256618f, 0.785191119f},
-std::array<float,2>{0.840958536f, 0.529793799f},
-std::array<float,2>{0.0186077133f, 0.310004771f},
-std::array<float,2>{0.892953038f, 0.40969038f},
-std::array<float,2>{0.150491655f, 0.644486964f},
-std::array<float,2>{0.527071416f, 0.928065777f},
-std::array<float,2>{0.464948386f, 0.0892111436f},
-std::array<float,2>{0.566197753f, 0.358993351f},
-std::array<float,2>{0.397060156f, 0.571445525f},
-std::array<float,2>{0.947277844f, 0.851056695f},
-std::array<float,2>{0.205042988f, 0.210188568f},
-std::array<float,2>{0.798620224f, 0.0432964675f},
-std::array<float,2>{0.0944362432f, 0.974082649f},
-std::array<float,2>{0.690816104f, 0.699442565f},
-std::array<float,2>{0.37424472f, 0.445833713f},
-std::array<float,2>{0.540310562f, 0.0967023596f},
-std::array<float,2>{0.498312652f, 0.893979788f},
-std::array<float,2>{0.92672497f, 0.683151484f},
-std::array<float,2>{0.157352403f, 0.389702737f},
-std::array<float,2>{0.855878055f, 0.266591132f},
-std::array<float,2>{0.052365873f, 0.535635352f},
-std::array<float,2>{0.659758508f, 0.757288218f},
-std::array<float,2>{0.295358598f, 0.154238671f},
-std::array<float,2>{0.741398036f, 0.477982521f},
-std::array<float,2>{0.316501826f, 0.749271274f},
-std::array<float,2>{0.778611898f, 0.945806384f},
-std::array<float,2>{0.076400131f, 0.0312017594f},
-std::array<float,2>{0.979282498f, 0.240926743f},
-std::array<float,2>{0.227331087f, 0.836577892f},
-std::array<float,2>{0.614202142f, 0.611677527f},
-std::array<float,2>{0.430463284f, 0.335795015f},
-std::array<float,2>{0.749022484f, 0.124240465f},
-std::array<float,2>{0.326477975f, 0.884179771f},
-std::array<float,2>{0.770760417f, 0.656413496f},
-std::array<float,2>{0.0658526719f, 0.392858654f},
-std::array<float,2>{0.972025335f, 0.251496196f},
-std::array<float,2>{0.218781143f, 0.560124397f},
-std::array<float,2>{0.621256948f, 0.769577146f},
-std::array<float,2>{0.428765833f, 0.138537675f},
-std::array<float,2>{0.534310222f, 0.493103385f},
-std::array<float,2>{0.491554439f, 0.733755708f},
-std::array<float,2>{0.936446488f, 0.958855927f},
-std::array<float,2>{0.169986472f, 0.00389066269f},
-std::array<float,2>{0.851451874f, 0.223573431f},
-std::array<float,2>{0.0559477806f, 0.822298884f},
-std::array<float,2>{0.668215573f, 0.594754815f},
-std::array<float,2>{0.282885939f, 0.320020169f},
-std::array<float,2>{0.573860526f, 0.177681074f},
-std::array<float,2>{0.404454201f, 0.811776519f},
-std::array<float,2>{0.940184474f, 0.511300743f},
-std::array<float,2>{0.213928565f, 0.28431496f},
-std::array<float,2>{0.805926442f, 0.431650221f},
-std::array<float,2>{0.101673305f, 0.629009008f},
-std::array<float,2>{0.701606274f, 0.917883635f},
-std::array<float,2>{0.359397173f, 0.0663832054f},
-std::array<float,2>{0.654953718f, 0.371914417f},
-std::array<float,2>{0.278462827f, 0.586991727f},
-std::array<float,2>{0.834623694f, 0.868526518f},
-std::array<float,2>{0.0249721892f, 0.2001075f},
-std::array<float,2>{0.900563776f, 0.05744908f},
-std::array<float,2>{0.144160762f, 0.994134963f},
-std::array<float,2>{0.519338906f, 0.708732426f},
-std::array<float,2>{0.457801253f, 0.46105969f},
-std::array<float,2>{0.673074365f, 0.20412612f},
-std::array<float,2>{0.303343236f, 0.846995234f},
-std::array<float,2>{0.862799942f, 0.575579166f},
-std::array<float,2>{0.0403917916f, 0.353322506f},
-std::array<float,2>{0.916491032f, 0.45022583f},
-std::array<float,2>{0.175221905f, 0.696049035f},
-std::array<float,2>{0.558567643f, 0.971496761f},
-std::array<float,2>{0.475954115f, 0.0414786786f},
-std::array<float,2>{0.599041343f, 0.307514727f},
-std::array<float,2>{0.408757418f, 0.523611009f},
-std::array<float,2>{0.990002096f, 0.781593561f},
-std::array<float,2>{0.242690414f, 0.159641847f},
-std::array<float,2>{0.759576201f, 0.0905410349f},
-std::array<float,2>{0.0924346521f, 0.924399018f},
-std::array<float,2>{0.730188429f, 0.645601988f},
-std::array<float,2>{0.330312699f, 0.411286175f},
-std::array<float,2>{0.507268667f, 0.0241501294f},
-std::array<float,2>{0.438052893f, 0.952398658f},
-std::array<float,2>{0.882918775f, 0.742587924f},
-std::array<float,2>{0.128368452f, 0.483921885f},
-std::array<float,2>{0.823091269f, 0.329745561f},
-std::array<float,2>{0.00721079763f, 0.614765525f},
-std::array<float,2>{0.632427335f, 0.841368675f},
-std::array<float,2>{0.256698191f, 0.236364111f},
-std::array<float,2>{0.715150237f, 0.386242926f},
-std::array<float,2>{0.351130188f, 0.685129762f},
-std::array<float,2>{0.787592888f, 0.895219982f},
-std::array<float,2>{0.115976371f, 0.0997177511f},
-std::array<float,2>{0.956066012f, 0.15208979f},
-std::array<float,2>{0.191853181f, 0.751878202f},
-std::array<float,2>{0.580052733f, 0.534866035f},
-std::array<float,2>{0.388708919f, 0.271944314f},
-std::array<float,2>{0.636603892f, 0.0381447934f},
-std::array<float,2>{0.264589667f, 0.983678102f},
-std::array<float,2>{0.818792045f, 0.694491327f},
-std::array<float,2>{0.00833448861f, 0.439407945f},
-std::array<float,2>{0.881799817f, 0.348119795f},
-std::array<float,2>{0.136648804f, 0.567305982f},
-std::array<float,2>{0.508106649f, 0.852272093f},
-std::array<float,2>{0.4513008f, 0.216583416f},
-std::array<float,2>{0.593133152f, 0.420804203f},
-std::array<float,2>{0.37658897f, 0.653997898f},
-std::array<float,2>{0.963121891f, 0.93706286f},
-std::array<float,2>{0.200824469f, 0.0855909511f},
-std::array<float,2>{0.792747319f, 0.171371669f},
-std::array<float,2>{0.124649741f, 0.795776069f},
-std::array<float,2>{0.705186009f, 0.522882402f},
-std::array<float,2>{0.355820179f, 0.299850076f},
-std::array<float,2>{0.554525435f, 0.243650034f},
-std::array<float,2>{0.483422101f, 0.83025676f},
-std::array<float,2>{0.911791384f, 0.623993039f},
-std::array<float,2>{0.182142094f, 0.340219915f},
-std::array<float,2>{0.868651867f, 0.469966203f},
-std::array<float,2>{0.0326545537f, 0.742180645f},
-std::array<float,2>{0.682077587f, 0.941817939f},
-std::array<float,2>{0.306358904f, 0.0177700669f},
-std::array<float,2>{0.724016905f, 0.278404444f},
-std::array<float,2>{0.342378855f, 0.546613872f},
-std::array<float,2>{0.754708529f, 0.764671981f},
-std::array<float,2>{0.0849720165f, 0.147082835f},
-std::array<float,2>{0.992429614f, 0.102271631f},
-std::array<float,2>{0.242176458f, 0.898799956f},
-std::array<float,2>{0.601964116f, 0.678795099f},
-std::array<float,2>{0.414286286f, 0.378659308f},
-std::array<float,2>{0.691434026f, 0.129955232f},
-std::array<float,2>{0.367249608f, 0.779501915f},
-std::array<float,2>{0.8041085f, 0.551704943f},
-std::array<float,2>{0.0976729766f, 0.259299576f},
-std::array<float,2>{0.951055944f, 0.399213791f},
-std::array<float,2>{0.208458275f, 0.670028448f},
-std::array<float,2>{0.569959641f, 0.879261732f},
-std::array<float,2>{0.390741587f, 0.110672228f},
-std::array<float,2>{0.528231025f, 0.321606278f},
-std::array<float,2>{0.462174177f, 0.601743639f},
-std::array<float,2>{0.89479363f, 0.813445091f},
-std::array<float,2>{0.155239373f, 0.232431278f},
-std::array<float,2>{0.837971926f, 0.00911835954f},
-std::array<float,2>{0.0219450518f, 0.966877937f},
-std::array<float,2>{0.646421313f, 0.720147967f},
-std::array<float,2>{0.272683144f, 0.487451047f},
-std::array<float,2>{0.612498462f, 0.0734253675f},
-std::array<float,2>{0.434884071f, 0.913935542f},
-std::array<float,2>{0.982472479f, 0.638862193f},
-std::array<float,2>{0.233329803f, 0.423892438f},
-std::array<float,2>{0.775471091f, 0.293586105f},
-std::array<float,2>{0.0707945302f, 0.504693449f},
-std::array<float,2>{0.738144755f, 0.803753197f},
-std::array<float,2>{0.313046426f, 0.187174276f},
-std::array<float,2>{0.663675487f, 0.459117293f},
-std::array<float,2>{0.291273803f, 0.717944026f},
-std::array<float,2>{0.853417277f, 0.99119103f},
-std::array<float,2>{0.046976883f, 0.048593577f},
-std::array<float,2>{0.924863935f, 0.193481594f},
-std::array<float,2>{0.162607729f, 0.86234504f},
-std::array<float,2>{0.544113815f, 0.58344394f},
-std::array<float,2>{0.496050298f, 0.365593821f},
-std::array<float,2>{0.643717408f, 0.0894351006f},
-std::array<float,2>{0.26889208f, 0.928593338f},
-std::array<float,2>{0.842197955f, 0.643600523f},
-std::array<float,2>{0.016655419f, 0.409476638f},
-std::array<float,2>{0.89221406f, 0.310244679f},
-std::array<float,2>{0.150314242f, 0.529553354f},
-std::array<float,2>{0.52435106f, 0.786127329f},
-std::array<float,2>{0.468135089f, 0.161547169f},
-std::array<float,2>{0.564262092f, 0.445441961f},
-std::array<float,2>{0.394963175f, 0.700047731f},
-std::array<float,2>{0.946967602f, 0.974294245f},
-std::array<float,2>{0.206058085f, 0.0438693687f},
-std::array<float,2>{0.799294055f, 0.210895523f},
-std::array<float,2>{0.097449705f, 0.851314366f},
-std::array<float,2>{0.688012958f, 0.572185695f},
-std::array<float,2>{0.371754974f, 0.358664662f},
-std::array<float,2>{0.541561544f, 0.153445706f},
-std::array<float,2>{0.497769266f, 0.757722855f},
-std::array<float,2>{0.929036856f, 0.535956621f},
-std::array<float,2>{0.158558875f, 0.265843153f},
-std::array<float,2>{0.857828081f, 0.390303433f},
-std::array<float,2>{0.0545144267f, 0.682711542f},
-std::array<float,2>{0.657824337f, 0.894215405f},
-std::array<float,2>{0.294326186f, 0.0974724293f},
-std::array<float,2>{0.739955664f, 0.335435122f},
-std::array<float,2>{0.318825752f, 0.611954153f},
-std::array<float,2>{0.780809402f, 0.836254716f},
-std::array<float,2>{0.0761443749f, 0.240628913f},
-std::array<float,2>{0.978454828f, 0.0303249843f},
-std::array<float,2>{0.229127198f, 0.945782959f},
-std::array<float,2>{0.615344286f, 0.749957681f},
-std::array<float,2>{0.432624519f, 0.478077412f},
-std::array<float,2>{0.708797395f, 0.21987021f},
-std::array<float,2>{0.354266614f, 0.827364028f},
-std::array<float,2>{0.793780804f, 0.600282013f},
-std::array<float,2>{0.117262416f, 0.3125301f},
-std::array<float,2>{0.966829121f, 0.497149795f},
-std::array<float,2>{0.198894411f, 0.726768434f},
-std::array<float,2>{0.587668836f, 0.953622282f},
-std::array<float,2>{0.382041186f, 0.00620732363f},
-std::array<float,2>{0.512361526f, 0.254816622f},
-std::array<float,2>{0.446627766f, 0.556260884f},
-std::array<float,2>{0.878539085f, 0.765776873f},
-std::array<float,2>{0.140376642f, 0.133631825f},
-std::array<float,2>{0.815193474f, 0.117490947f},
-std::array<float,2>{0.0155364554f, 0.889543176f},
-std::array<float,2>{0.637876987f, 0.6633811f},
-std::array<float,2>{0.259351045f, 0.396581978f},
-std::array<float,2>{0.608325183f, 0.0616983324f},
-std::array<float,2>{0.421383798f, 0.996359169f},
-std::array<float,2>{0.998914659f, 0.706131816f},
-std::array<float,2>{0.235149622f, 0.466046989f},
-std::array<float,2>{0.751507938f, 0.370112866f},
-std::array<float,2>{0.0802296549f, 0.592272043f},
-std::array<float,2>{0.721447587f, 0.873312175f},
-std::array<float,2>{0.339379191f, 0.198565155f},
-std::array<float,2>{0.68536514f, 0.437132746f},
-std::array<float,2>{0.309949487f, 0.625051677f},
-std::array<float,2>{0.87323755f, 0.919267535f},
-std::array<float,2>{0.0375824496f, 0.0701604784f},
-std::array<float,2>{0.908014297f, 0.175448149f},
-std::array<float,2>{0.18602109f, 0.805771589f},
-std::array<float,2>{0.548715591f, 0.513609529f},
-std::array<float,2>{0.478569001f, 0.288551122f},
-std::array<float,2>{0.732310116f, 0.0151877254f},
-std::array<float,2>{0.332210749f, 0.962562561f},
-std::array<float,2>{0.762015104f, 0.724579751f},
-std::array<float,2>{0.0874422416f, 0.489619195f},
-std::array<float,2>{0.9871068f, 0.327398121f},
-std::array<float,2>{0.246741831f, 0.608213902f},
-std::array<float,2>{0.595974922f, 0.819769025f},
-std::array<float,2>{0.41238597f, 0.23044467f},
-std::array<float,2>{0.561892211f, 0.405700296f},
-std::array<float,2>{0.470002651f, 0.665987372f},
-std::array<float,2>{0.919897079f, 0.876401961f},
-std::array<float,2>{0.176955074f, 0.113935143f},
-std::array<float,2>{0.86643213f, 0.125182435f},
-std::array<float,2>{0.0446392521f, 0.776698112f},
-std::array<float,2>{0.677417159f, 0.547596276f},
-std::array<float,2>{0.299505621f, 0.265495718f},
-std::array<float,2>{0.582435071f, 0.190572277f},
-std::array<float,2>{0.384162843f, 0.864415586f},
-std::array<float,2>{0.958786428f, 0.578799844f},
-std::array<float,2>{0.189638972f, 0.360753685f},
-std::array<float,2>{0.783127964f, 0.45532167f},
-std::array<float,2>{0.111135043f, 0.713694215f},
-std::array<float,2>{0.7135517f, 0.986415029f},
-std::array<float,2>{0.347316444f, 0.0546772704f},
-std::array<float,2>{0.626192033f, 0.289910376f},
-std::array<float,2>{0.250967175f, 0.500221908f},
-std::array<float,2>{0.825222313f, 0.798270643f},
-std::array<float,2>{0.0015684386f, 0.182936504f},
-std::array<float,2>{0.888745248f, 0.0751718953f},
-std::array<float,2>{0.132570893f, 0.908319652f},
-std::array<float,2>{0.500907063f, 0.63543725f},
-std::array<float,2>{0.442517638f, 0.428155452f},
-std::array<float,2>{0.664932013f, 0.165687189f},
-std::array<float,2>{0.285211027f, 0.791306257f},
-std::array<float,2>{0.844153583f, 0.516747952f},
-std::array<float,2>{0.0601603687f, 0.303605646f},
-std::array<float,2>{0.930458844f, 0.415816158f},
-std::array<float,2>{0.167190924f, 0.651328862f},
-std::array<float,2>{0.535572588f, 0.932909906f},
-std::array<float,2>{0.486573219f, 0.0790366754f},
-std::array<float,2>{0.619068801f, 0.345870405f},
-std::array<float,2>{0.423868299f, 0.565346181f},
-std::array<float,2>{0.973668218f, 0.857275128f},
-std::array<float,2>{0.224882126f, 0.214266956f},
-std::array<float,2>{0.76594311f, 0.0328202397f},
-std::array<float,2>{0.0674589425f, 0.978120923f},
-std::array<float,2>{0.744566083f, 0.69138962f},
-std::array<float,2>{0.323998272f, 0.443325371f},
-std::array<float,2>{0.522360563f, 0.10751202f},
-std::array<float,2>{0.456465185f, 0.903594434f},
-std::array<float,2>{0.902442992f, 0.673618138f},
-std::array<float,2>{0.145503253f, 0.381023735f},
-std::array<float,2>{0.829849005f, 0.276004016f},
-std::array<float,2>{0.0288816094f, 0.541481376f},
-std::array<float,2>{0.650945783f, 0.758626759f},
-std::array<float,2>{0.275661677f, 0.144123033f},
-std::array<float,2>{0.698265791f, 0.476465017f},
-std::array<float,2>{0.364508063f, 0.734563231f},
-std::array<float,2>{0.809772253f, 0.93994087f},
-std::array<float,2>{0.107921787f, 0.0226992927f},
-std::array<float,2>{0.944476783f, 0.246100605f},
-std::array<float,2>{0.216801062f, 0.833130419f},
-std::array<float,2>{0.576627016f, 0.620141745f},
-std::array<float,2>{0.400286198f, 0.33889842f},
-std::array<float,2>{0.694709003f, 0.11131642f},
-std::array<float,2>{0.37019664f, 0.879550815f},
-std::array<float,2>{0.801512897f, 0.670441747f},
-std::array<float,2>{0.101150215f, 0.398911655f},
-std::array<float,2>{0.951431572f, 0.258958459f},
-std::array<float,2>{0.210303083f, 0.551179171f},
-std::array<float,2>{0.567140758f, 0.779813051f},
-std::array<float,2>{0.394163907f, 0.130699441f},
-std::array<float,2>{0.52980119f, 0.487955064f},
-std::array<float,2>{0.464535296f, 0.720342338f},
-std::array<float,2>{0.897952616f, 0.967683434f},
-std::array<float,2>{0.152661845f, 0.00941650849f},
-std::array<float,2>{0.837307215f, 0.23310779f},
-std::array<float,2>{0.0205013212f, 0.812855363f},
-std::array<float,2>{0.647069156f, 0.602334619f},
-std::array<float,2>{0.271211684f, 0.321778536f},
-std::array<float,2>{0.609975457f, 0.186841279f},
-std::array<float,2>{0.435821503f, 0.804546595f},
-std::array<float,2>{0.981259882f, 0.504214644f},
-std::array<float,2>{0.231223807f, 0.293130487f},
-std::array<float,2>{0.775122404f, 0.42438364f},
-std::array<float,2>{0.0731378049f, 0.639557481f},
-std::array<float,2>{0.735979021f, 0.913458288f},
-std::array<float,2>{0.31617409f, 0.074132517f},
-std::array<float,2>{0.66097945f, 0.365828156f},
-std::array<float,2>{0.290764153f, 0.583561838f},
-std::array<float,2>{0.854694545f, 0.863182962f},
-std::array<float,2>{0.0489901304f, 0.194097832f},
-std::array<float,2>{0.923623145f, 0.0481337532f},
-std::array<float,2>{0.161395013f, 0.990406752f},
-std::array<float,2>{0.546803653f, 0.718410373f},
-std::array<float,2>{0.493936092f, 0.459527314f},
-std::array<float,2>{0.633872986f, 0.216146708f},
-std::array<float,2>{0.26331079f, 0.852030754f},
-std::array<float,2>{0.816481888f, 0.566818476f},
-std::array<float,2>{0.0114507861f, 0.348548651f},
-std::array<float,2>{0.879015028f, 0.438478172f},
-std::array<float,2>{0.13396655f, 0.694841623f},
-std::array<float,2>{0.510594308f, 0.983888447f},
-std::array<float,2>{0.450770974f, 0.0388771109f},
-std::array<float,2>{0.591155946f, 0.300303608f},
-std::array<float,2>{0.378192842f, 0.52317518f},
-std::array<float,2>{0.96250236f, 0.795004785f},
-std::array<float,2>{0.201587558f, 0.171631739f},
-std::array<float,2>{0.789368093f, 0.0851139277f},
-std::array<float,2>{0.121202454f, 0.936738074f},
-std::array<float,2>{0.704925179f, 0.653482616f},
-std::array<float,2>{0.357591331f, 0.420349538f},
-std::array<float,2>{0.550980151f, 0.0181091614f},
-std::array<float,2>{0.480875522f, 0.942023516f},
-std::array<float,2>{0.912793279f, 0.741685331f},
-std::array<float,2>{0.180839017f, 0.47039324f},
-std::array<float,2>{0.87099874f, 0.340678155f},
-std::array<float,2>{0.0346105956f, 0.623343587f},
-std::array<float,2>{0.681292117f, 0.83058244f},
-std::array<float,2>{0.30763942f, 0.244112805f},
-std::array<float,2>{0.726366341f, 0.377966493f},
-std::array<float,2>{0.341393173f, 0.679525137f},
-std::array<float,2>{0.757243991f, 0.899342239f},
-std::array<float,2>{0.0828648284f, 0.101796478f},
-std::array<float,2>{0.994211733f, 0.146527886f},
-std::array<float,2>{0.240157545f, 0.765497506f},
-std::array<float,2>{0.604040384f, 0.546215355f},
-std::array<float,2>{0.41639781f, 0.279267281f},
-std::array<float,2>{0.674728394f, 0.0418874919f},
-std::array<float,2>{0.302376777f, 0.971146703f},
-std::array<float,2>{0.860486448f, 0.695492864f},
-std::array<float,2>{0.0428632274f, 0.451050371f},
-std::array<float,2>{0.915780306f, 0.352653295f},
-std::array<float,2>{0.173335299f, 0.575856924f},
-std::array<float,2>{0.554767132f, 0.847225368f},
-std::array<float,2>{0.474042505f, 0.204657376f},
-std::array<float,2>{0.600446999f, 0.412063539f},
-std::array<float,2>{0.408019274f, 0.646316528f},
-std::array<float,2>{0.991795659f, 0.924151003f},
-std::array<float,2>{0.245213598f, 0.0901881307f},
-std::array<float,2>{0.761088729f, 0.159952596f},
-std::array<float,2>{0.0907289684f, 0.781961083f},
-std::array<float,2>{0.72723943f, 0.523985803f},
-std::array<float,2>{0.329054445f, 0.306760669f},
-std::array<float,2>{0.505363941f, 0.237263292f},
-std::array<float,2>{0.440110356f, 0.841131747f},
-std::array<float,2>{0.886075795f, 0.614569962f},
-std::array<float,2>{0.125332341f, 0.329294294f},
-std::array<float,2>{0.821615398f, 0.483505577f},
-std::array<float,2>{0.00400651246f, 0.743047297f},
-std::array<float,2>{0.629074156f, 0.95310092f},
-std::array<float,2>{0.255609989f, 0.0238470826f},
-std::array<float,2>{0.716850817f, 0.272061288f},
-std::array<float,2>{0.349282324f, 0.534180045f},
-std::array<float,2>{0.785273373f, 0.751434803f},
-std::array<float,2>{0.114353694f, 0.151464313f},
-std::array<float,2>{0.954684377f, 0.100345172f},
-std::array<float,2>{0.195013016f, 0.894818544f},
-std::array<float,2>{0.58126992f, 0.684927285f},
-std::array<float,2>{0.387758642f, 0.386083812f},
-std::array<float,2>{0.747089386f, 0.137750968f},
-std::array<float,2>{0.325238407f, 0.770348787f},
-std::array<float,2>{0.773006618f, 0.559956372f},
-std::array<float,2>{0.0631502718f, 0.251096845f},
-std::array<float,2>{0.970698357f, 0.393359959f},
-std::array<float,2>{0.221408442f, 0.657185793f},
-std::array<float,2>{0.623613834f, 0.884626091f},
-std::array<float,2>{0.426317573f, 0.124820501f},
-std::array<float,2>{0.533185422f, 0.319409519f},
-std::array<float,2>{0.489806741f, 0.595322311f},
-std::array<float,2>{0.933605075f, 0.822860181f},
-std::array<float,2>{0.168168783f, 0.223100722f},
-std::array<float,2>{0.849538684f, 0.0031999338f},
-std::array<float,2>{0.0582092032f, 0.95843333f},
-std::array<float,2>{0.670999885f, 0.734006643f},
-std::array<float,2>{0.28480956f, 0.492295027f},
-std::array<float,2>{0.570324957f, 0.0657805353f},
-std::array<float,2>{0.40239948f, 0.917081058f},
-std::array<float,2>{0.93898958f, 0.629633605f},
-std::array<float,2>{0.211271539f, 0.432590812f},
-std::array<float,2>{0.806940794f, 0.285015583f},
-std::array<float,2>{0.105113387f, 0.511119485f},
-std::array<float,2>{0.700164795f, 0.812335014f},
-std::array<float,2>{0.361890167f, 0.177128971f},
-std::array<float,2>{0.653738558f, 0.461716592f},
-std::array<float,2>{0.27968055f, 0.708055139f},
-std::array<float,2>{0.833835244f, 0.993456006f},
-std::array<float,2>{0.0267798156f, 0.0567249209f},
-std::array<float,2>{0.898884594f, 0.199695542f},
-std::array<float,2>{0.141860381f, 0.868755758f},
-std::array<float,2>{0.515972972f, 0.587737024f},
-std::array<float,2>{0.459280282f, 0.371575058f},
-std::array<float,2>{0.659398437f, 0.0949994102f},
-std::array<float,2>{0.295648873f, 0.89139396f},
-std::array<float,2>{0.855983555f, 0.681175947f},
-std::array<float,2>{0.0519932359f, 0.387601763f},
-std::array<float,2>{0.926179588f, 0.269021779f},
-std::array<float,2>{0.158015639f, 0.538431048f},
-std::array<float,2>{0.54077822f, 0.755110145f},
-std::array<float,2>{0.498641163f, 0.154825613f},
-std::array<float,2>{0.61339432f, 0.479220271f},
-std::array<float,2>{0.429899037f, 0.746353805f},
-std::array<float,2>{0.978721321f, 0.948410809f},
-std::array<float,2>{0.226795241f, 0.0274563916f},
-std::array<float,2>{0.778920233f, 0.238626406f},
-std::array<float,2>{0.0769693926f, 0.838262737f},
-std::array<float,2>{0.742104948f, 0.610625863f},
-std::array<float,2>{0.317236334f, 0.333277166f},
-std::array<float,2>{0.526542783f, 0.162711844f},
-std::array<float,2>{0.465669423f, 0.788704157f},
-std::array<float,2>{0.893354893f, 0.528792739f},
-std::array<float,2>{0.150907919f, 0.311561018f},
-std::array<float,2>{0.841328919f, 0.40692544f},
-std::array<float,2>{0.0195180774f, 0.642445505f},
-std::array<float,2>{0.64224261f, 0.927199364f},
-std::array<float,2>{0.266655624f, 0.0867228359f},
-std::array<float,2>{0.691307306f, 0.356485873f},
-std::array<float,2>{0.374846518f, 0.572385371f},
-std::array<float,2>{0.798249066f, 0.848171532f},
-std::array<float,2>{0.0941719264f, 0.208760604f},
-std::array<float,2>{0.947841227f, 0.0452675857f},
-std::array<float,2>{0.204409003f, 0.97645545f},
-std::array<float,2>{0.565703332f, 0.702854216f},
-std::array<float,2>{0.396918416f, 0.44740358f},
-std::array<float,2>{0.720019758f, 0.195834324f},
-std::array<float,2>{0.336138338f, 0.871659636f},
-std::array<float,2>{0.753610611f, 0.590035677f},
-std::array<float,2>{0.0782994851f, 0.368836403f},
-std::array<float,2>{0.996857882f, 0.468095928f},
-std::array<float,2>{0.238231242f, 0.704272032f},
-std::array<float,2>{0.606735647f, 0.99874872f},
-std::array<float,2>{0.419712305f, 0.0595943294f},
-std::array<float,2>{0.550322175f, 0.28629896f},
-std::array<float,2>{0.477476925f, 0.514590979f},
-std::array<float,2>{0.909104347f, 0.80747503f},
-std::array<float,2>{0.183751196f, 0.172747299f},
-std::array<float,2>{0.872339964f, 0.0671138912f},
-std::array<float,2>{0.0356778614f, 0.921158254f},
-std::array<float,2>{0.687321186f, 0.627013862f},
-std::array<float,2>{0.311607718f, 0.433929205f},
-std::array<float,2>{0.588211298f, 0.00419133855f},
-std::array<float,2>{0.380717248f, 0.955697715f},
-std::array<float,2>{0.966296375f, 0.730448246f},
-std::array<float,2>{0.197221473f, 0.49886024f},
-std::array<float,2>{0.796534598f, 0.31594798f},
-std::array<float,2>{0.120798171f, 0.598582506f},
-std::array<float,2>{0.710461676f, 0.825638056f},
-std::array<float,2>{0.351568937f, 0.221731469f},
-std::array<float,2>{0.638991594f, 0.396290958f},
-std::array<float,2>{0.260401696f, 0.660774469f},
-std::array<float,2>{0.813137293f, 0.887366951f},
-std::array<float,2>{0.0121193556f, 0.120843582f},
-std::array<float,2>{0.876882076f, 0.135037348f},
-std::array<float,2>{0.136741966f, 0.767648578f},
-std::array<float,2>{0.515025139f, 0.558386207f},
-std::array<float,2>{0.44818151f, 0.256801605f},
-std::array<float,2>{0.711229861f, 0.0509984754f},
-std::array<float,2>{0.345527917f, 0.985114515f},
-std::array<float,2>{0.784287333f, 0.712484241f},
-std::array<float,2>{0.112075306f, 0.453270465f},
-std::array<float,2>{0.960091233f, 0.362996995f},
-std::array<float,2>{0.188822523f, 0.58176291f},
-std::array<float,2>{0.584578156f, 0.866892934f},
-std::array<float,2>{0.384893119f, 0.187920809f},
-std::array<float,2>{0.501975715f, 0.426791251f},
-std::array<float,2>{0.44377321f, 0.633284271f},
-std::array<float,2>{0.886794329f, 0.90676868f},
-std::array<float,2>{0.13010402f, 0.0780146122f},
-std::array<float,2>{0.826529384f, 0.179913551f},
-std::array<float,2>{0.00385341165f, 0.799909174f},
-std::array<float,2>{0.626975834f, 0.502464116f},
-std::array<float,2>{0.252132535f, 0.292107612f},
-std::array<float,2>{0.59560746f, 0.228405133f},
-std::array<float,2>{0.411354989f, 0.817307949f},
-std::array<float,2>{0.984387398f, 0.605667472f},
-std::array<float,2>{0.249259993f, 0.325917274f},
-std::array<float,2>{0.765352964f, 0.491463423f},
-std::array<float,2>{0.0897443369f, 0.72551465f},
-std::array<float,2>{0.733303487f, 0.963585377f},
-std::array<float,2>{0.335866898f, 0.0119159427f},
-std::array<float,2>{0.677975535f, 0.263017416f},
-std::array<float,2>{0.298530251f, 0.549122691f},
-std::array<float,2>{0.864102483f, 0.774912477f},
-std::array<float,2>{0.0464462675f, 0.127077088f},
-std::array<float,2>{0.920117855f, 0.115381166f},
-std::array<float,2>{0.17847982f, 0.877986729f},
-std::array<float,2>{0.559958041f, 0.666934133f},
-std::array<float,2>{0.471516311f, 0.402964711f},
-std::array<float,2>{0.648842216f, 0.142397359f},
-std::array<float,2>{0.274918407f, 0.760849059f},
-std::array<float,2>{0.830512583f, 0.54025656f},
-std::array<float,2>{0.0303673316f, 0.274172932f},
-std::array<float,2>{0.905350745f, 0.380767226f},
-std::array<float,2>{0.148323089f, 0.674093187f},
-std::array<float,2>{0.52013427f, 0.905636728f},
-std::array<float,2>{0.453635603f, 0.107093953f},
-std::array<float,2>{0.574998558f, 0.336654603f},
-std::array<float,2>{0.400604665f, 0.618718088f},
-std::array<float,2>{0.941577792f, 0.835039198f},
-std::array<float,2>{0.216410145f, 0.248077288f},
-std::array<float,2>{0.810735524f, 0.0204153117f},
-std::array<float,2>{0.105971105f, 0.9380216f},
-std::array<float,2>{0.695866227f, 0.736536622f},
-std::array<float,2>{0.366163045f, 0.473044574f},
-std::array<float,2>{0.537970781f, 0.0818019658f},
-std::array<float,2>{0.48565039f, 0.931055129f},
-std::array<float,2>{0.933066726f, 0.649528444f},
-std::array<float,2>{0.164112106f, 0.416797936f},
-std::array<float,2>{0.846480787f, 0.301837206f},
-std::array<float,2>{0.0623389408f, 0.518291831f},
-std::array<float,2>{0.667629004f, 0.790627241f},
-std::array<float,2>{0.28831169f, 0.166798249f},
-std::array<float,2>{0.74360615f, 0.444861501f},
-std::array<float,2>{0.322226346f, 0.687863708f},
-std::array<float,2>{0.769330621f, 0.979953766f},
-std::array<float,2>{0.07002718f, 0.035106726f},
-std::array<float,2>{0.975283682f, 0.211288139f},
-std::array<float,2>{0.224471346f, 0.858218372f},
-std::array<float,2>{0.620383143f, 0.564296424f},
-std::array<float,2>{0.422058523f, 0.345179796f},
-std::array<float,2>{0.737417042f, 0.0709827244f},
-std::array<float,2>{0.312645048f, 0.911980867f},
-std::array<float,2>{0.775967896f, 0.637888789f},
-std::array<float,2>{0.0711639971f, 0.423503578f},
-std::array<float,2>{0.982928991f, 0.295415014f},
-std::array<float,2>{0.23248224f, 0.505960405f},
-std::array<float,2>{0.613147378f, 0.802480221f},
-std::array<float,2>{0.435352743f, 0.184982494f},
-std::array<float,2>{0.544455945f, 0.458843291f},
-std::array<float,2>{0.495601535f, 0.715455711f},
-std::array<float,2>{0.925318658f, 0.988454342f},
-std::array<float,2>{0.162521362f, 0.0490287542f},
-std::array<float,2>{0.852650821f, 0.192150086f},
-std::array<float,2>{0.0477668792f, 0.860763907f},
-std::array<float,2>{0.663548768f, 0.584795356f},
-std::array<float,2>{0.291935712f, 0.363817692f},
-std::array<float,2>{0.56970799f, 0.131352752f},
-std::array<float,2>{0.391527355f, 0.777917981f},
-std::array<float,2>{0.95021683f, 0.553057075f},
-std::array<float,2>{0.208706856f, 0.261547983f},
-std::array<float,2>{0.804201782f, 0.401813447f},
-std::array<float,2>{0.0984663814f, 0.669031024f},
-std::array<float,2>{0.692264199f, 0.882614017f},
-std::array<float,2>{0.367797405f, 0.112603813f},
-std::array<float,2>{0.645941973f, 0.323099375f},
-std::array<float,2>{0.273260206f, 0.605375111f},
-std::array<float,2>{0.838520229f, 0.815815985f},
-std::array<float,2>{0.0224205256f, 0.231472477f},
-std::array<float,2>{0.895121157f, 0.00990723912f},
-std::array<float,2>{0.154380456f, 0.965931058f},
-std::array<float,2>{0.527781188f, 0.722081959f},
-std::array<float,2>{0.462487131f, 0.486317128f},
-std::array<float,2>{0.682425916f, 0.245825559f},
-std::array<float,2>{0.306127906f, 0.828972459f},
-std::array<float,2>{0.868779659f, 0.621887326f},
-std::array<float,2>{0.0329422876f, 0.342791408f},
-std::array<float,2>{0.91146946f, 0.471246451f},
-std::array<float,2>{0.182083681f, 0.739278138f},
-std::array<float,2>{0.553967059f, 0.94478637f},
-std::array<float,2>{0.483905077f, 0.0163893998f},
-std::array<float,2>{0.602051258f, 0.280664861f},
-std::array<float,2>{0.414634198f, 0.544867218f},
-std::array<float,2>{0.992993712f, 0.763251603f},
-std::array<float,2>{0.24156706f, 0.146266237f},
-std::array<float,2>{0.754380167f, 0.104814954f},
-std::array<float,2>{0.0854719654f, 0.901647806f},
-std::array<float,2>{0.724298835f, 0.676935494f},
-std::array<float,2>{0.341813415f, 0.376024455f},
-std::array<float,2>{0.508403122f, 0.0365715474f},
-std::array<float,2>{0.451768994f, 0.981887937f},
-std::array<float,2>{0.881190836f, 0.691497445f},
-std::array<float,2>{0.136160478f, 0.44104141f},
-std::array<float,2>{0.818879664f, 0.350447476f},
-std::array<float,2>{0.00783033669f, 0.569318235f},
-std::array<float,2>{0.635777354f, 0.854505956f},
-std::array<float,2>{0.263681024f, 0.218263924f},
-std::array<float,2>{0.705661952f, 0.419349939f},
-std::array<float,2>{0.356000066f, 0.654960394f},
-std::array<float,2>{0.792350471f, 0.934669554f},
-std::array<float,2>{0.124317005f, 0.082785733f},
-std::array<float,2>{0.963647604f, 0.169041499f},
-std::array<float,2>{0.200344428f, 0.79407835f},
-std::array<float,2>{0.593429029f, 0.521202028f},
-std::array<float,2>{0.376422137f, 0.297615141f},
-std::array<float,2>{0.631924391f, 0.0256929956f},
-std::array<float,2>{0.255872428f, 0.949529409f},
-std::array<float,2>{0.822525918f, 0.745658398f},
-std::array<float,2>{0.00773361558f, 0.480706096f},
-std::array<float,2>{0.883749247f, 0.331141204f},
-std::array<float,2>{0.12882331f, 0.616700351f},
-std::array<float,2>{0.507593453f, 0.841900766f},
-std::array<float,2>{0.437594652f, 0.235875696f},
-std::array<float,2>{0.579449773f, 0.384090483f},
-std::array<float,2>{0.389405578f, 0.685552299f},
-std::array<float,2>{0.956758618f, 0.897891641f},
-std::array<float,2>{0.192248076f, 0.0990787596f},
-std::array<float,2>{0.787600577f, 0.149571478f},
-std::array<float,2>{0.115633242f, 0.753087163f},
-std::array<float,2>{0.715552032f, 0.533096313f},
-std::array<float,2>{0.350888252f, 0.27055946f},
-std::array<float,2>{0.5576756f, 0.205694571f},
-std::array<float,2>{0.476244688f, 0.844248533f},
-std::array<float,2>{0.916647017f, 0.576456666f},
-std::array<float,2>{0.175713211f, 0.354519486f},
-std::array<float,2>{0.862510204f, 0.452183515f},
-std::array<float,2>{0.0409638248f, 0.697584867f},
-std::array<float,2>{0.673515737f, 0.96935606f},
-std::array<float,2>{0.303033113f, 0.0403951705f},
-std::array<float,2>{0.729536414f, 0.305058867f},
-std::array<float,2>{0.33080557f, 0.525462687f},
-std::array<float,2>{0.758983314f, 0.784083784f},
-std::array<float,2>{0.0920229778f, 0.157089606f},
-std::array<float,2>{0.989638865f, 0.0936205089f},
-std::array<float,2>{0.242413402f, 0.92357254f},
-std::array<float,2>{0.599479973f, 0.647172391f},
-std::array<float,2>{0.408456117f, 0.413831472f},
-std::array<float,2>{0.701794147f, 0.177951187f},
-std::array<float,2>{0.360337019f, 0.808745086f},
-std::array<float,2>{0.806351244f, 0.508179963f},
-std::array<float,2>{0.102505438f, 0.282476038f},
-std::array<float,2>{0.939462602f, 0.430701286f},
-std::array<float,2>{0.214761198f, 0.632440984f},
-std::array<float,2>{0.573664129f, 0.914432824f},
-std::array<float,2>{0.40508917f, 0.0640966967f},
-std::array<float,2>{0.518977702f, 0.374189258f},
-std::array<float,2>{0.457318276f, 0.589217365f},
-std::array<float,2>{0.901083291f, 0.870703816f},
-std::array<float,2>{0.14372474f, 0.201317281f},
-std::array<float,2>{0.834450603f, 0.0562882349f},
-std::array<float,2>{0.0248622876f, 0.994215429f},
-std::array<float,2>{0.654304862f, 0.709619582f},
-std::array<float,2>{0.279224962f, 0.463689059f},
-std::array<float,2>{0.622043073f, 0.121417671f},
-std::array<float,2>{0.42923075f, 0.885806739f},
-std::array<float,2>{0.972406447f, 0.658746004f},
-std::array<float,2>{0.219592482f, 0.3914662f},
-std::array<float,2>{0.771280348f, 0.252639741f},
-std::array<float,2>{0.0662366375f, 0.561592996f},
-std::array<float,2>{0.748476863f, 0.771742523f},
-std::array<float,2>{0.326962173f, 0.138765976f},
-std::array<float,2>{0.668506861f, 0.495393455f},
-std::array<float,2>{0.282496035f, 0.731442809f},
-std::array<float,2>{0.850907147f, 0.960814595f},
-std::array<float,2>{0.0564377606f, 6.78453507e-05f},
-std::array<float,2>{0.935851932f, 0.225470498f},
-std::array<float,2>{0.170744121f, 0.82038486f},
-std::array<float,2>{0.535056949f, 0.597286582f},
-std::array<float,2>{0.492007077f, 0.316828817f},
-std::array<float,2>{0.637441874f, 0.11953754f},
-std::array<float,2>{0.258390605f, 0.888344705f},
-std::array<float,2>{0.816161692f, 0.661928892f},
-std::array<float,2>{0.0139473649f, 0.39510116f},
-std::array<float,2>{0.877445579f, 0.257706046f},
-std::array<float,2>{0.138749704f, 0.557337821f},
-std::array<float,2>{0.513402224f, 0.768828034f},
-std::array<float,2>{0.445469558f, 0.136138052f},
-std::array<float,2>{0.58648479f, 0.499511093f},
-std::array<float,2>{0.381204396f, 0.729382753f},
-std::array<float,2>{0.96804595f, 0.956462622f},
-std::array<float,2>{0.197648346f, 0.00546799088f},
-std::array<float,2>{0.794465542f, 0.221000925f},
-std::array<float,2>{0.118917294f, 0.824872613f},
-std::array<float,2>{0.707502544f, 0.598919451f},
-std::array<float,2>{0.355101913f, 0.315333068f},
-std::array<float,2>{0.547293186f, 0.17325452f},
-std::array<float,2>{0.47969383f, 0.807712018f},
-std::array<float,2>{0.906436682f, 0.515278935f},
-std::array<float,2>{0.186858237f, 0.285748571f},
-std::array<float,2>{0.874311626f, 0.434692115f},
-std::array<float,2>{0.0382540375f, 0.628264308f},
-std::array<float,2>{0.684396088f, 0.920779884f},
-std::array<float,2>{0.309156656f, 0.0679708272f},
-std::array<float,2>{0.721785545f, 0.3681508f},
-std::array<float,2>{0.338148117f, 0.59144181f},
-std::array<float,2>{0.750882745f, 0.872611046f},
-std::array<float,2>{0.0814878196f, 0.196416855f},
-std::array<float,2>{0.999941587f, 0.0592752844f},
-std::array<float,2>{0.235456675f, 0.9996351f},
-std::array<float,2>{0.609047174f, 0.704055607f},
-std::array<float,2>{0.420022726f, 0.466968656f},
-std::array<float,2>{0.688835144f, 0.20781891f},
-std::array<float,2>{0.372758418f, 0.848854184f},
-std::array<float,2>{0.800529659f, 0.574036896f},
-std::array<float,2>{0.0958703682f, 0.355801612f},
-std::array<float,2>{0.946037292f, 0.448787034f},
-std::array<float,2>{0.20598726f, 0.701250851f},
-std::array<float,2>{0.563163996f, 0.975061893f},
-std::array<float,2>{0.396467865f, 0.0462369695f},
-std::array<float,2>{0.525090635f, 0.311139673f},
-std::array<float,2>{0.467338353f, 0.528103113f},
-std::array<float,2>{0.89120096f, 0.787375748f},
-std::array<float,2>{0.148987114f, 0.16393213f},
-std::array<float,2>{0.843074918f, 0.0869233459f},
-std::array<float,2>{0.0159140695f, 0.926112831f},
-std::array<float,2>{0.642813683f, 0.641195536f},
-std::array<float,2>{0.268125027f, 0.407639086f},
-std::array<float,2>{0.616484344f, 0.0288366303f},
-std::array<float,2>{0.43238917f, 0.947421551f},
-std::array<float,2>{0.976599336f, 0.74739933f},
-std::array<float,2>{0.229552701f, 0.479528993f},
-std::array<float,2>{0.779819012f, 0.332505405f},
-std::array<float,2>{0.0748196617f, 0.609379172f},
-std::array<float,2>{0.739121556f, 0.839137375f},
-std::array<float,2>{0.319977552f, 0.239907578f},
-std::array<float,2>{0.656665325f, 0.388552606f},
-std::array<float,2>{0.293106586f, 0.679761529f},
-std::array<float,2>{0.85887444f, 0.891891599f},
-std::array<float,2>{0.0527685508f, 0.094038263f},
-std::array<float,2>{0.92823863f, 0.155801028f},
-std::array<float,2>{0.159891725f, 0.754752815f},
-std::array<float,2>{0.542477012f, 0.537419736f},
-std::array<float,2>{0.496771425f, 0.268427849f},
-std::array<float,2>{0.745384455f, 0.0337320119f},
-std::array<float,2>{0.322810829f, 0.978717089f},
-std::array<float,2>{0.766898155f, 0.688514769f},
-std::array<float,2>{0.0667272657f, 0.444205433f},
-std::array<float,2>{0.972867906f, 0.344375759f},
-std::array<float,2>{0.22606416f, 0.562585592f},
-std::array<float,2>{0.617935479f, 0.858778715f},
-std::array<float,2>{0.425236642f, 0.212267354f},
-std::array<float,2>{0.536937833f, 0.417387307f},
-std::array<float,2>{0.487347186f, 0.64899236f},
-std::array<float,2>{0.9313519f, 0.93029505f},
-std::array<float,2>{0.166174144f, 0.08050704f},
-std::array<float,2>{0.845488489f, 0.167540282f},
-std::array<float,2>{0.0588369146f, 0.789829254f},
-std::array<float,2>{0.665270329f, 0.519219816f},
-std::array<float,2>{0.286522001f, 0.300895125f},
-std::array<float,2>{0.578124523f, 0.249511227f},
-std::array<float,2>{0.39863503f, 0.834755719f},
-std::array<float,2>{0.944178522f, 0.617610157f},
-std::array<float,2>{0.218167692f, 0.337318867f},
-std::array<float,2>{0.809560001f, 0.473855853f},
-std::array<float,2>{0.108581126f, 0.738106489f},
-std::array<float,2>{0.697465897f, 0.938608885f},
-std::array<float,2>{0.363447815f, 0.0208053011f},
-std::array<float,2>{0.652094781f, 0.275153458f},
-std::array<float,2>{0.276980191f, 0.539832175f},
-std::array<float,2>{0.828152478f, 0.759861529f},
-std::array<float,2>{0.0276255123f, 0.140732929f},
-std::array<float,2>{0.903683424f, 0.105966322f},
-std::array<float,2>{0.146158367f, 0.90450424f},
-std::array<float,2>{0.522627711f, 0.675156057f},
-std::array<float,2>{0.455715299f, 0.379328847f},
-std::array<float,2>{0.676235974f, 0.128818691f},
-std::array<float,2>{0.300013483f, 0.774213314f},
-std::array<float,2>{0.865999877f, 0.550275385f},
-std::array<float,2>{0.0435846597f, 0.261934847f},
-std::array<float,2>{0.918025672f, 0.403939128f},
-std::array<float,2>{0.175806835f, 0.667366683f},
-std::array<float,2>{0.561480403f, 0.877143562f},
-std::array<float,2>{0.46910277f, 0.116555154f},
-std::array<float,2>{0.597600579f, 0.324457765f},
-std::array<float,2>{0.413773954f, 0.607223332f},
-std::array<float,2>{0.988265157f, 0.817585468f},
-std::array<float,2>{0.247267261f, 0.226820558f},
-std::array<float,2>{0.762936711f, 0.0131871495f},
-std::array<float,2>{0.0868799388f, 0.964092016f},
-std::array<float,2>{0.731235623f, 0.726079583f},
-std::array<float,2>{0.333171576f, 0.49057138f},
-std::array<float,2>{0.50104326f, 0.0768954083f},
-std::array<float,2>{0.441695929f, 0.907696724f},
-std::array<float,2>{0.890155077f, 0.634524345f},
-std::array<float,2>{0.131298989f, 0.425869077f},
-std::array<float,2>{0.824910402f, 0.291580617f},
-std::array<float,2>{0.000117449206f, 0.503337979f},
-std::array<float,2>{0.625460505f, 0.799409628f},
-std::array<float,2>{0.251828581f, 0.180764914f},
-std::array<float,2>{0.714106143f, 0.454382241f},
-std::array<float,2>{0.346218407f, 0.71130991f},
-std::array<float,2>{0.781843424f, 0.985579669f},
-std::array<float,2>{0.110095657f, 0.0520386845f},
-std::array<float,2>{0.957552493f, 0.189250439f},
-std::array<float,2>{0.191263601f, 0.865480185f},
-std::array<float,2>{0.583676636f, 0.580123425f},
-std::array<float,2>{0.383597732f, 0.362184137f},
-std::array<float,2>{0.703153968f, 0.0832538605f},
-std::array<float,2>{0.359331697f, 0.933908582f},
-std::array<float,2>{0.790168643f, 0.656098902f},
-std::array<float,2>{0.122495174f, 0.418450922f},
-std::array<float,2>{0.961210489f, 0.297922581f},
-std::array<float,2>{0.202878907f, 0.519802034f},
-std::array<float,2>{0.590638161f, 0.79344964f},
-std::array<float,2>{0.377829581f, 0.168068066f},
-std::array<float,2>{0.511591256f, 0.439959377f},
-std::array<float,2>{0.449830294f, 0.692469716f},
-std::array<float,2>{0.88038063f, 0.980688512f},
-std::array<float,2>{0.133358568f, 0.0357066058f},
-std::array<float,2>{0.818250179f, 0.21714294f},
-std::array<float,2>{0.0102690253f, 0.853592694f},
-std::array<float,2>{0.633750021f, 0.570149601f},
-std::array<float,2>{0.262468517f, 0.351531237f},
-std::array<float,2>{0.605375707f, 0.14489463f},
-std::array<float,2>{0.417840332f, 0.76247108f},
-std::array<float,2>{0.995803177f, 0.543888569f},
-std::array<float,2>{0.238308504f, 0.27939406f},
-std::array<float,2>{0.756577015f, 0.37558192f},
-std::array<float,2>{0.0830459446f, 0.676051557f},
-std::array<float,2>{0.724640012f, 0.900772452f},
-std::array<float,2>{0.340480685f, 0.104214333f},
-std::array<float,2>{0.679736793f, 0.342027903f},
-std::array<float,2>{0.306764007f, 0.622653544f},
-std::array<float,2>{0.869709134f, 0.829680145f},
-std::array<float,2>{0.03326381f, 0.244615465f},
-std::array<float,2>{0.913624644f, 0.0170565397f},
-std::array<float,2>{0.180199072f, 0.943643749f},
-std::array<float,2>{0.552011609f, 0.739023507f},
-std::array<float,2>{0.482343495f, 0.472418398f},
-std::array<float,2>{0.647923291f, 0.231018111f},
-std::array<float,2>{0.270169705f, 0.815144897f},
-std::array<float,2>{0.836745739f, 0.604322076f},
-std::array<float,2>{0.0210183691f, 0.323905319f},
-std::array<float,2>{0.897331595f, 0.484416038f},
-std::array<float,2>{0.153904319f, 0.720780015f},
-std::array<float,2>{0.531138003f, 0.964944482f},
-std::array<float,2>{0.463489681f, 0.0107708108f},
-std::array<float,2>{0.567607284f, 0.260646403f},
-std::array<float,2>{0.392646432f, 0.554267943f},
-std::array<float,2>{0.953100622f, 0.77898556f},
-std::array<float,2>{0.209413886f, 0.13219659f},
-std::array<float,2>{0.802140713f, 0.112291224f},
-std::array<float,2>{0.100123011f, 0.881107926f},
-std::array<float,2>{0.694143832f, 0.668902397f},
-std::array<float,2>{0.370047033f, 0.401342601f},
-std::array<float,2>{0.545005023f, 0.0500807613f},
-std::array<float,2>{0.492256939f, 0.989952862f},
-std::array<float,2>{0.922807693f, 0.715998292f},
-std::array<float,2>{0.160837829f, 0.457519948f},
-std::array<float,2>{0.854174018f, 0.36518243f},
-std::array<float,2>{0.0501437895f, 0.58528322f},
-std::array<float,2>{0.661730826f, 0.860141158f},
-std::array<float,2>{0.28990981f, 0.1932313f},
-std::array<float,2>{0.73499018f, 0.422381312f},
-std::array<float,2>{0.314619154f, 0.636779547f},
-std::array<float,2>{0.774274588f, 0.910669982f},
-std::array<float,2>{0.0739778802f, 0.0717961714f},
-std::array<float,2>{0.981618464f, 0.184028283f},
-std::array<float,2>{0.231954873f, 0.801455855f},
-std::array<float,2>{0.61057663f, 0.506997943f},
-std::array<float,2>{0.437426865f, 0.296686321f},
-std::array<float,2>{0.670406759f, 0.0015406633f},
-std::array<float,2>{0.283228576f, 0.959288597f},
-std::array<float,2>{0.848607242f, 0.731594563f},
-std::array<float,2>{0.0567298718f, 0.494362801f},
-std::array<float,2>{0.935085118f, 0.317645192f},
-std::array<float,2>{0.169860899f, 0.595921397f},
-std::array<float,2>{0.531488657f, 0.821514428f},
-std::array<float,2>{0.488824517f, 0.226467192f},
-std::array<float,2>{0.624537408f, 0.392106801f},
-std::array<float,2>{0.427702785f, 0.659836769f},
-std::array<float,2>{0.969724238f, 0.884943843f},
-std::array<float,2>{0.22195749f, 0.122261219f},
-std::array<float,2>{0.771783233f, 0.139990002f},
-std::array<float,2>{0.0636073202f, 0.772679865f},
-std::array<float,2>{0.746312916f, 0.561478972f},
-std::array<float,2>{0.324469715f, 0.253376424f},
-std::array<float,2>{0.517514825f, 0.202889442f},
-std::array<float,2>{0.460583627f, 0.86940521f},
-std::array<float,2>{0.899764419f, 0.588738441f},
-std::array<float,2>{0.141180158f, 0.373996913f},
-std::array<float,2>{0.83293879f, 0.464046866f},
-std::array<float,2>{0.0258552004f, 0.71057719f},
-std::array<float,2>{0.65293932f, 0.995696604f},
-std::array<float,2>{0.280315578f, 0.0555178188f},
-std::array<float,2>{0.700696409f, 0.281323045f},
-std::array<float,2>{0.362537891f, 0.509071589f},
-std::array<float,2>{0.807745814f, 0.810420573f},
-std::array<float,2>{0.104116522f, 0.179010525f},
-std::array<float,2>{0.937730134f, 0.062902987f},
-std::array<float,2>{0.212147593f, 0.915297031f},
-std::array<float,2>{0.571839452f, 0.631305635f},
-std::array<float,2>{0.404134184f, 0.429991663f},
-std::array<float,2>{0.728233516f, 0.158077016f},
-std::array<float,2>{0.329341799f, 0.784713924f},
-std::array<float,2>{0.760484517f, 0.526422262f},
-std::array<float,2>{0.0911495164f, 0.306335658f},
-std::array<float,2>{0.990827084f, 0.412422478f},
-std::array<float,2>{0.245105177f, 0.647916138f},
-std::array<float,2>{0.6008569f, 0.922791123f},
-std::array<float,2>{0.406830579f, 0.0918997526f},
-std::array<float,2>{0.555697203f, 0.354349166f},
-std::array<float,2>{0.472689718f, 0.577198744f},
-std::array<float,2>{0.914530814f, 0.845527232f},
-std::array<float,2>{0.172430724f, 0.206731677f},
-std::array<float,2>{0.859948814f, 0.0395610258f},
-std::array<float,2>{0.0412556417f, 0.970696151f},
-std::array<float,2>{0.67560178f, 0.69889766f},
-std::array<float,2>{0.300827295f, 0.451832175f},
-std::array<float,2>{0.580738127f, 0.0978321582f},
-std::array<float,2>{0.387009978f, 0.897353351f},
-std::array<float,2>{0.954017699f, 0.686600685f},
-std::array<float,2>{0.193625733f, 0.383436859f},
-std::array<float,2>{0.786322534f, 0.269725442f},
-std::array<float,2>{0.114094555f, 0.53139478f},
-std::array<float,2>{0.718684077f, 0.752574265f},
-std::array<float,2>{0.348359853f, 0.14916563f},
-std::array<float,2>{0.630513072f, 0.481524169f},
-std::array<float,2>{0.254623711f, 0.744537771f},
-std::array<float,2>{0.820563257f, 0.951146483f},
-std::array<float,2>{0.00557385804f, 0.026447257f},
-std::array<float,2>{0.884895861f, 0.234860331f},
-std::array<float,2>{0.126436502f, 0.843727827f},
-std::array<float,2>{0.504787087f, 0.615648389f},
-std::array<float,2>{0.440902859f, 0.330334425f},
-std::array<float,2>{0.686019659f, 0.0683753043f},
-std::array<float,2>{0.311313003f, 0.918484569f},
-std::array<float,2>{0.871527791f, 0.626949131f},
-std::array<float,2>{0.0365422778f, 0.436052173f},
-std::array<float,2>{0.909383178f, 0.288076878f},
-std::array<float,2>{0.185067669f, 0.512665391f},
-std::array<float,2>{0.549183011f, 0.804878354f},
-std::array<float,2>{0.478481561f, 0.174093008f},
-std::array<float,2>{0.605914235f, 0.465292215f},
-std::array<float,2>{0.418851674f, 0.705905437f},
-std::array<float,2>{0.997248709f, 0.998032629f},
-std::array<float,2>{0.236453041f, 0.0610977821f},
-std::array<float,2>{0.752455533f, 0.197853014f},
-std::array<float,2>{0.0798269138f, 0.874392807f},
-std::array<float,2>{0.719321012f, 0.593368411f},
-std::array<float,2>{0.337748706f, 0.370708555f},
-std::array<float,2>{0.513933241f, 0.13444452f},
-std::array<float,2>{0.449217975f, 0.767221272f},
-std::array<float,2>{0.875921845f, 0.554770768f},
-std::array<float,2>{0.138517573f, 0.255274743f},
-std::array<float,2>{0.814004302f, 0.397557825f},
-std::array<float,2>{0.0132731283f, 0.662869275f},
-std::array<float,2>{0.64001596f, 0.89052242f},
-std::array<float,2>{0.261240244f, 0.118205272f},
-std::array<float,2>{0.709474385f, 0.314006329f},
-std::array<float,2>{0.352829307f, 0.600922585f},
-std::array<float,2>{0.795285523f, 0.826509058f},
-std::array<float,2>{0.119181126f, 0.219443202f},
-std::array<float,2>{0.964861572f, 0.00734823151f},
-std::array<float,2>{0.1956404f, 0.954948545f},
-std::array<float,2>{0.589480996f, 0.727648675f},
-std::array<float,2>{0.379236698f, 0.496163696f},
-std::array<float,2>{0.740735769f, 0.241479948f},
-std::array<float,2>{0.317664623f, 0.83733815f},
-std::array<float,2>{0.778286338f, 0.613188028f},
-std::array<float,2>{0.0772876218f, 0.334820807f},
-std::array<float,2>{0.979939461f, 0.476713628f},
-std::array<float,2>{0.228151962f, 0.748520195f},
-std::array<float,2>{0.61466229f, 0.946850657f},
-std::array<float,2>{0.431421399f, 0.0301684793f},
-std::array<float,2>{0.53964591f, 0.267556429f},
-std::array<float,2>{0.499182522f, 0.536637664f},
-std::array<float,2>{0.927263319f, 0.755865037f},
-std::array<float,2>{0.156960011f, 0.152971923f},
-std::array<float,2>{0.857177436f, 0.0957700908f},
-std::array<float,2>{0.051096987f, 0.893335283f},
-std::array<float,2>{0.658853769f, 0.682529211f},
-std::array<float,2>{0.29606694f, 0.389297128f},
-std::array<float,2>{0.565044999f, 0.0440299548f},
-std::array<float,2>{0.397610039f, 0.972748995f},
-std::array<float,2>{0.949086785f, 0.700728476f},
-std::array<float,2>{0.203134492f, 0.446869075f},
-std::array<float,2>{0.797017097f, 0.35811615f},
-std::array<float,2>{0.0948859602f, 0.570791781f},
-std::array<float,2>{0.690004289f, 0.850417137f},
-std::array<float,2>{0.373084277f, 0.209146872f},
-std::array<float,2>{0.641069174f, 0.408581436f},
-std::array<float,2>{0.265640706f, 0.643307686f},
-std::array<float,2>{0.840783775f, 0.929174185f},
-std::array<float,2>{0.0179339368f, 0.0883829445f},
-std::array<float,2>{0.89426893f, 0.16060552f},
-std::array<float,2>{0.151837409f, 0.786210179f},
-std::array<float,2>{0.525843561f, 0.531215847f},
-std::array<float,2>{0.466503561f, 0.309565127f},
-std::array<float,2>{0.696513951f, 0.0217107125f},
-std::array<float,2>{0.366981208f, 0.940754771f},
-std::array<float,2>{0.812403083f, 0.735562563f},
-std::array<float,2>{0.107390739f, 0.475402832f},
-std::array<float,2>{0.942748487f, 0.338637561f},
-std::array<float,2>{0.214941725f, 0.619554222f},
-std::array<float,2>{0.575536728f, 0.832181036f},
-std::array<float,2>{0.402070135f, 0.247875482f},
-std::array<float,2>{0.521138728f, 0.382757008f},
-std::array<float,2>{0.455026209f, 0.672046483f},
-std::array<float,2>{0.904985666f, 0.902539074f},
-std::array<float,2>{0.146739259f, 0.108817257f},
-std::array<float,2>{0.831826866f, 0.142760947f},
-std::array<float,2>{0.0294043329f, 0.759727061f},
-std::array<float,2>{0.649415076f, 0.542708874f},
-std::array<float,2>{0.274266273f, 0.276774257f},
-std::array<float,2>{0.619556248f, 0.212912336f},
-std::array<float,2>{0.42343989f, 0.856241941f},
-std::array<float,2>{0.975638747f, 0.566364467f},
-std::array<float,2>{0.222740307f, 0.347410083f},
-std::array<float,2>{0.768059492f, 0.441713661f},
-std::array<float,2>{0.0687061325f, 0.689772129f},
-std::array<float,2>{0.742356181f, 0.976702809f},
-std::array<float,2>{0.320939541f, 0.0316428542f},
-std::array<float,2>{0.666202843f, 0.303869694f},
-std::array<float,2>{0.287260741f, 0.516527057f},
-std::array<float,2>{0.84674561f, 0.792582035f},
-std::array<float,2>{0.0608118176f, 0.164714903f},
-std::array<float,2>{0.932530284f, 0.0797076896f},
-std::array<float,2>{0.165482521f, 0.931874514f},
-std::array<float,2>{0.538906991f, 0.651997387f},
-std::array<float,2>{0.484805226f, 0.414995521f},
-std::array<float,2>{0.628874421f, 0.182102516f},
-std::array<float,2>{0.253263533f, 0.797688305f},
-std::array<float,2>{0.82733041f, 0.501520276f},
-std::array<float,2>{0.00291268108f, 0.290069371f},
-std::array<float,2>{0.887973487f, 0.428937942f},
-std::array<float,2>{0.129640967f, 0.636541486f},
-std::array<float,2>{0.503511906f, 0.90987438f},
-std::array<float,2>{0.44513762f, 0.075286828f},
-std::array<float,2>{0.58551687f, 0.360148817f},
-std::array<float,2>{0.386083543f, 0.579782963f},
-std::array<float,2>{0.959004521f, 0.863720477f},
-std::array<float,2>{0.187912643f, 0.189661369f},
-std::array<float,2>{0.783809185f, 0.0532055758f},
-std::array<float,2>{0.112788074f, 0.98731333f},
-std::array<float,2>{0.712209761f, 0.714694858f},
-std::array<float,2>{0.344060928f, 0.456438452f},
-std::array<float,2>{0.559388459f, 0.11517565f},
-std::array<float,2>{0.471680671f, 0.875603676f},
-std::array<float,2>{0.921786964f, 0.66432935f},
-std::array<float,2>{0.179500923f, 0.404634684f},
-std::array<float,2>{0.864729226f, 0.264118731f},
-std::array<float,2>{0.0450568758f, 0.548431456f},
-std::array<float,2>{0.67936933f, 0.77567631f},
-std::array<float,2>{0.297126085f, 0.126166657f},
-std::array<float,2>{0.733698368f, 0.488831967f},
-std::array<float,2>{0.334923655f, 0.722701192f},
-std::array<float,2>{0.763881028f, 0.961673737f},
-std::array<float,2>{0.0880086496f, 0.0139871305f},
-std::array<float,2>{0.985952318f, 0.229174137f},
-std::array<float,2>{0.248611689f, 0.819259644f},
-std::array<float,2>{0.594608963f, 0.608938992f},
-std::array<float,2>{0.410892665f, 0.327053905f},
-std::array<float,2>{0.722834826f, 0.103177123f},
-std::array<float,2>{0.343171775f, 0.899585485f},
-std::array<float,2>{0.755852699f, 0.677767456f},
-std::array<float,2>{0.0840172395f, 0.377378821f},
-std::array<float,2>{0.993267119f, 0.278094798f},
-std::array<float,2>{0.240769684f, 0.545231581f},
-std::array<float,2>{0.602994978f, 0.763966143f},
-std::array<float,2>{0.415478826f, 0.147792578f},
-std::array<float,2>{0.553400338f, 0.469511628f},
-std::array<float,2>{0.482985377f, 0.74061805f},
-std::array<float,2>{0.910895824f, 0.942713559f},
-std::array<float,2>{0.182627276f, 0.019352898f},
-std::array<float,2>{0.868130624f, 0.242722556f},
-std::array<float,2>{0.0317815542f, 0.831677616f},
-std::array<float,2>{0.682944417f, 0.624120057f},
-std::array<float,2>{0.305024236f, 0.340908289f},
-std::array<float,2>{0.592494249f, 0.170269713f},
-std::array<float,2>{0.37554872f, 0.796584845f},
-std::array<float,2>{0.964790344f, 0.52202785f},
-std::array<float,2>{0.200188339f, 0.299582601f},
-std::array<float,2>{0.791494608f, 0.421392769f},
-std::array<float,2>{0.123395853f, 0.652803719f},
-std::array<float,2>{0.706692517f, 0.936169863f},
-std::array<float,2>{0.356556833f, 0.0847854763f},
-std::array<float,2>{0.635465145f, 0.349223733f},
-std::array<float,2>{0.26480785f, 0.567726612f},
-std::array<float,2>{0.819628358f, 0.852808595f},
-std::array<float,2>{0.00934033655f, 0.215319112f},
-std::array<float,2>{0.882209539f, 0.0371759497f},
-std::array<float,2>{0.135482922f, 0.98267436f},
-std::array<float,2>{0.509540856f, 0.694138706f},
-std::array<float,2>{0.452248186f, 0.438146114f},
-std::array<float,2>{0.662943423f, 0.194566846f},
-std::array<float,2>{0.292641968f, 0.861749291f},
-std::array<float,2>{0.85212481f, 0.582460284f},
-std::array<float,2>{0.0480446704f, 0.367070854f},
-std::array<float,2>{0.924394548f, 0.460502654f},
-std::array<float,2>{0.163109541f, 0.717363715f},
-std::array<float,2>{0.543853462f, 0.991309345f},
-std::array<float,2>{0.49469474f, 0.046958901f},
-std::array<float,2>{0.611841261f, 0.294378102f},
-std::array<float,2>{0.434501231f, 0.505556464f},
-std::array<float,2>{0.983846545f, 0.803561211f},
-std::array<float,2>{0.234366909f, 0.186281115f},
-std::array<float,2>{0.776944995f, 0.0730835721f},
-std::array<float,2>{0.0715029538f, 0.912587881f},
-std::array<float,2>{0.737239182f, 0.640407503f},
-std::array<float,2>{0.314348131f, 0.425713748f},
-std::array<float,2>{0.528800905f, 0.0078977393f},
-std::array<float,2>{0.461775929f, 0.967980266f},
-std::array<float,2>{0.89632684f, 0.719032526f},
-std::array<float,2>{0.155789256f, 0.486864477f},
-std::array<float,2>{0.839248717f, 0.320510387f},
-std::array<float,2>{0.0229517203f, 0.603061318f},
-std::array<float,2>{0.645054519f, 0.813602924f},
-std::array<float,2>{0.272432119f, 0.233646631f},
-std::array<float,2>{0.692826629f, 0.399925828f},
-std::array<float,2>{0.36834687f, 0.670922101f},
-std::array<float,2>{0.803031862f, 0.880725801f},
-std::array<float,2>{0.0990161225f, 0.109850556f},
-std::array<float,2>{0.949494004f, 0.129783884f},
-std::array<float,2>{0.207623154f, 0.780406117f},
-std::array<float,2>{0.568438053f, 0.551930845f},
-std::array<float,2>{0.392486602f, 0.257835954f},
-std::array<float,2>{0.655567348f, 0.0584849827f},
-std::array<float,2>{0.278210878f, 0.992756665f},
-std::array<float,2>{0.835677505f, 0.707773328f},
-std::array<float,2>{0.0242798645f, 0.462256491f},
-std::array<float,2>{0.901658595f, 0.372909427f},
-std::array<float,2>{0.143010736f, 0.586480796f},
-std::array<float,2>{0.518128097f, 0.868163288f},
-std::array<float,2>{0.458907723f, 0.200468794f},
-std::array<float,2>{0.572770417f, 0.43282482f},
-std::array<float,2>{0.405762881f, 0.630213082f},
-std::array<float,2>{0.941173792f, 0.916254818f},
-std::array<float,2>{0.213654876f, 0.0649808943f},
-std::array<float,2>{0.805345178f, 0.176275238f},
-std::array<float,2>{0.103127994f, 0.810605645f},
-std::array<float,2>{0.702794373f, 0.510141075f},
-std::array<float,2>{0.360600382f, 0.283325195f},
-std::array<float,2>{0.534036517f, 0.223692745f},
-std::array<float,2>{0.490634501f, 0.824053407f},
-std::array<float,2>{0.936651647f, 0.594395638f},
-std::array<float,2>{0.171232402f, 0.31931603f},
-std::array<float,2>{0.849842072f, 0.493851066f},
-std::array<float,2>{0.0554110967f, 0.732580781f},
-std::array<float,2>{0.669668853f, 0.957510829f},
-std::array<float,2>{0.282207638f, 0.00280137034f},
-std::array<float,2>{0.749444187f, 0.250652224f},
-std::array<float,2>{0.327337265f, 0.559540629f},
-std::array<float,2>{0.770126939f, 0.770576358f},
-std::array<float,2>{0.0653589889f, 0.13691248f},
-std::array<float,2>{0.971045852f, 0.123902649f},
-std::array<float,2>{0.219925195f, 0.883697987f},
-std::array<float,2>{0.622797608f, 0.657262743f},
-std::array<float,2>{0.428472221f, 0.393580556f},
-std::array<float,2>{0.716381252f, 0.151317194f},
-std::array<float,2>{0.350237191f, 0.750652432f},
-std::array<float,2>{0.788892865f, 0.534084022f},
-std::array<float,2>{0.117104806f, 0.272684216f},
-std::array<float,2>{0.955820203f, 0.38573271f},
-std::array<float,2>{0.193047568f, 0.684152186f},
-std::array<float,2>{0.578962743f, 0.895821154f},
-std::array<float,2>{0.389755994f, 0.100672357f},
-std::array<float,2>{0.506126761f, 0.328416407f},
-std::array<float,2>{0.439019293f, 0.613438427f},
-std::array<float,2>{0.884473443f, 0.840464473f},
-std::array<float,2>{0.127902374f, 0.237698302f},
-std::array<float,2>{0.823788822f, 0.0244943332f},
-std::array<float,2>{0.00673811836f, 0.95159781f},
-std::array<float,2>{0.631339371f, 0.743714988f},
-std::array<float,2>{0.257787704f, 0.483331323f},
-std::array<float,2>{0.59806335f, 0.0910089239f},
-std::array<float,2>{0.409227937f, 0.925764084f},
-std::array<float,2>{0.988941312f, 0.645500898f},
-std::array<float,2>{0.243478507f, 0.410703272f},
-std::array<float,2>{0.758552551f, 0.307735026f},
-std::array<float,2>{0.0937043652f, 0.524684548f},
-std::array<float,2>{0.729354858f, 0.782737315f},
-std::array<float,2>{0.331502944f, 0.158207625f},
-std::array<float,2>{0.672408462f, 0.450068057f},
-std::array<float,2>{0.304501921f, 0.696692765f},
-std::array<float,2>{0.862135947f, 0.97183758f},
-std::array<float,2>{0.039346844f, 0.0422088616f},
-std::array<float,2>{0.91790837f, 0.203881592f},
-std::array<float,2>{0.173921719f, 0.84583956f},
-std::array<float,2>{0.556673288f, 0.574376225f},
-std::array<float,2>{0.474952519f, 0.352212757f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.0944373161f, 0.249843195f},
-std::array<float,2>{0.65529424f, 0.759688258f},
-std::array<float,2>{0.89782691f, 0.415392965f},
-std::array<float,2>{0.489250392f, 0.623701572f},
-std::array<float,2>{0.295867234f, 0.357279867f},
-std::array<float,2>{0.78791672f, 0.670058489f},
-std::array<float,2>{0.551314652f, 0.00195660675f},
-std::array<float,2>{0.159963444f, 0.923888803f},
-std::array<float,2>{0.234122038f, 0.46857208f},
-std::array<float,2>{0.608778238f, 0.53430146f},
-std::array<float,2>{0.817626953f, 0.163007393f},
-std::array<float,2>{0.346058011f, 0.870693803f},
-std::array<float,2>{0.417451501f, 0.104035728f},
-std::array<float,2>{0.999579549f, 0.991837263f},
-std::array<float,2>{0.739206314f, 0.263724029f},
-std::array<float,2>{0.0441784374f, 0.708034456f},
-std::array<float,2>{0.135191813f, 0.0533001609f},
-std::array<float,2>{0.524851024f, 0.875945568f},
-std::array<float,2>{0.763464153f, 0.316297293f},
-std::array<float,2>{0.264042258f, 0.645166516f},
-std::array<float,2>{0.444724321f, 0.392993629f},
-std::array<float,2>{0.929864585f, 0.59369719f},
-std::array<float,2>{0.686405241f, 0.197786972f},
-std::array<float,2>{0.0771328211f, 0.802038252f},
-std::array<float,2>{0.00303166802f, 0.292018414f},
-std::array<float,2>{0.706296206f, 0.730027139f},
-std::array<float,2>{0.947707295f, 0.0655332059f},
-std::array<float,2>{0.400933057f, 0.946553051f},
-std::array<float,2>{0.324396044f, 0.143852144f},
-std::array<float,2>{0.873794734f, 0.841249466f},
-std::array<float,2>{0.573493183f, 0.469177604f},
-std::array<float,2>{0.194145799f, 0.512912691f},
-std::array<float,2>{0.215296552f, 0.1850878f},
-std::array<float,2>{0.580569446f, 0.853278995f},
-std::array<float,2>{0.84585464f, 0.452938378f},
-std::array<float,2>{0.339356363f, 0.559585333f},
-std::array<float,2>{0.375931501f, 0.27105251f},
-std::array<float,2>{0.963497102f, 0.687779605f},
-std::array<float,2>{0.694411099f, 0.115182117f},
-std::array<float,2>{0.0232309084f, 0.97559762f},
-std::array<float,2>{0.087529704f, 0.428869575f},
-std::array<float,2>{0.663525283f, 0.601639092f},
-std::array<float,2>{0.916446745f, 0.231205478f},
-std::array<float,2>{0.453323781f, 0.775250554f},
-std::array<float,2>{0.267039746f, 0.0253319759f},
-std::array<float,2>{0.772279143f, 0.90747869f},
-std::array<float,2>{0.501804709f, 0.3650828f},
-std::array<float,2>{0.141725793f, 0.672577739f},
-std::array<float,2>{0.0583477169f, 0.0872491598f},
-std::array<float,2>{0.72302115f, 0.962768435f},
-std::array<float,2>{0.981846392f, 0.298143774f},
-std::array<float,2>{0.432786673f, 0.735987723f},
-std::array<float,2>{0.364346951f, 0.498587579f},
-std::array<float,2>{0.842983902f, 0.51878041f},
-std::array<float,2>{0.618371367f, 0.140489593f},
-std::array<float,2>{0.234802514f, 0.819133341f},
-std::array<float,2>{0.18391417f, 0.343311608f},
-std::array<float,2>{0.542590559f, 0.629153192f},
-std::array<float,2>{0.799281657f, 0.0379983522f},
-std::array<float,2>{0.310428083f, 0.892007709f},
-std::array<float,2>{0.47746411f, 0.203448698f},
-std::array<float,2>{0.888301909f, 0.790862501f},
-std::array<float,2>{0.638957679f, 0.383453578f},
-std::array<float,2>{0.112976789f, 0.573333979f},
-std::array<float,2>{0.0271742996f, 0.130327925f},
-std::array<float,2>{0.699175656f, 0.825680435f},
-std::array<float,2>{0.954118788f, 0.49009347f},
-std::array<float,2>{0.383185834f, 0.526197076f},
-std::array<float,2>{0.335738897f, 0.312313974f},
-std::array<float,2>{0.85539192f, 0.74649936f},
-std::array<float,2>{0.589352548f, 0.0857929587f},
-std::array<float,2>{0.203342035f, 0.954274535f},
-std::array<float,2>{0.151409805f, 0.37549755f},
-std::array<float,2>{0.509639859f, 0.565437376f},
-std::array<float,2>{0.77825737f, 0.216108322f},
-std::array<float,2>{0.281085014f, 0.783401489f},
-std::array<float,2>{0.467337996f, 0.0463773236f},
-std::array<float,2>{0.906468511f, 0.903260767f},
-std::array<float,2>{0.668228745f, 0.334345937f},
-std::array<float,2>{0.084215194f, 0.640048146f},
-std::array<float,2>{0.242914006f, 0.11976473f},
-std::array<float,2>{0.616840839f, 0.980070472f},
-std::array<float,2>{0.830396235f, 0.276025921f},
-std::array<float,2>{0.369890064f, 0.697653115f},
-std::array<float,2>{0.424396813f, 0.443816394f},
-std::array<float,2>{0.969736993f, 0.547647774f},
-std::array<float,2>{0.731722236f, 0.175131381f},
-std::array<float,2>{0.0496418998f, 0.848835528f},
-std::array<float,2>{0.121823967f, 0.368460447f},
-std::array<float,2>{0.625555396f, 0.685358584f},
-std::array<float,2>{0.877800643f, 0.0226337053f},
-std::array<float,2>{0.474624217f, 0.914603829f},
-std::array<float,2>{0.298345059f, 0.223292321f},
-std::array<float,2>{0.810851753f, 0.772057891f},
-std::array<float,2>{0.531363726f, 0.433918834f},
-std::array<float,2>{0.178905249f, 0.596798241f},
-std::array<float,2>{0.165921301f, 0.188940331f},
-std::array<float,2>{0.561006844f, 0.806567311f},
-std::array<float,2>{0.790195465f, 0.404735059f},
-std::array<float,2>{0.28750518f, 0.580557823f},
-std::array<float,2>{0.497664571f, 0.323793739f},
-std::array<float,2>{0.904639363f, 0.655865431f},
-std::array<float,2>{0.64791888f, 0.0549926087f},
-std::array<float,2>{0.103778847f, 0.890258014f},
-std::array<float,2>{0.0382466242f, 0.477452576f},
-std::array<float,2>{0.748454452f, 0.506784499f},
-std::array<float,2>{0.991425693f, 0.153866276f},
-std::array<float,2>{0.412606955f, 0.831657469f},
-std::array<float,2>{0.352059513f, 0.0712802783f},
-std::array<float,2>{0.82664454f, 0.940574288f},
-std::array<float,2>{0.595265329f, 0.285124511f},
-std::array<float,2>{0.22106114f, 0.724512398f},
-std::array<float,2>{0.0652648732f, 0.015609405f},
-std::array<float,2>{0.677031934f, 0.931954443f},
-std::array<float,2>{0.922573864f, 0.349157631f},
-std::array<float,2>{0.44912529f, 0.660342872f},
-std::array<float,2>{0.254936904f, 0.41263482f},
-std::array<float,2>{0.752787113f, 0.610399842f},
-std::array<float,2>{0.523105681f, 0.240509018f},
-std::array<float,2>{0.131211728f, 0.75718981f},
-std::array<float,2>{0.200185493f, 0.256867588f},
-std::array<float,2>{0.564555883f, 0.718309164f},
-std::array<float,2>{0.861666501f, 0.0981400982f},
-std::array<float,2>{0.31662944f, 0.999058247f},
-std::array<float,2>{0.391283184f, 0.169971332f},
-std::array<float,2>{0.941545308f, 0.860864937f},
-std::array<float,2>{0.716878831f, 0.460565746f},
-std::array<float,2>{0.0101905484f, 0.543663323f},
-std::array<float,2>{0.0783963427f, 0.157688782f},
-std::array<float,2>{0.664862573f, 0.872960865f},
-std::array<float,2>{0.913771391f, 0.461745411f},
-std::array<float,2>{0.464183927f, 0.538448334f},
-std::array<float,2>{0.274200469f, 0.258081347f},
-std::array<float,2>{0.775716126f, 0.706676662f},
-std::array<float,2>{0.514536917f, 0.1061121f},
-std::array<float,2>{0.155336589f, 0.984476209f},
-std::array<float,2>{0.207879648f, 0.421094418f},
-std::array<float,2>{0.590531409f, 0.620110452f},
-std::array<float,2>{0.857792854f, 0.243130133f},
-std::array<float,2>{0.331065565f, 0.76458317f},
-std::array<float,2>{0.389416218f, 0.00454793172f},
-std::array<float,2>{0.959390044f, 0.926797152f},
-std::array<float,2>{0.700385571f, 0.354553461f},
-std::array<float,2>{0.0282132961f, 0.666199267f},
-std::array<float,2>{0.172703236f, 0.0670462772f},
-std::array<float,2>{0.538497508f, 0.95311892f},
-std::array<float,2>{0.807151794f, 0.296726644f},
-std::array<float,2>{0.302025199f, 0.731646121f},
-std::array<float,2>{0.470671266f, 0.474492371f},
-std::array<float,2>{0.881205738f, 0.508958757f},
-std::array<float,2>{0.629096687f, 0.147702336f},
-std::array<float,2>{0.120791249f, 0.837127388f},
-std::array<float,2>{0.054484617f, 0.319446981f},
-std::array<float,2>{0.730438471f, 0.642328084f},
-std::array<float,2>{0.972772002f, 0.0472692922f},
-std::array<float,2>{0.429252863f, 0.881654382f},
-std::array<float,2>{0.374942601f, 0.199650884f},
-std::array<float,2>{0.834118128f, 0.797951519f},
-std::array<float,2>{0.611346483f, 0.396586537f},
-std::array<float,2>{0.246986285f, 0.587374151f},
-std::array<float,2>{0.226403385f, 0.229323223f},
-std::array<float,2>{0.599368393f, 0.77939111f},
-std::array<float,2>{0.821146786f, 0.423676312f},
-std::array<float,2>{0.355727881f, 0.608932376f},
-std::array<float,2>{0.408200115f, 0.362487227f},
-std::array<float,2>{0.985984683f, 0.677190065f},
-std::array<float,2>{0.743155837f, 0.0288908128f},
-std::array<float,2>{0.0340885557f, 0.911380589f},
-std::array<float,2>{0.109294064f, 0.447455198f},
-std::array<float,2>{0.644311965f, 0.556977808f},
-std::array<float,2>{0.898906648f, 0.180038199f},
-std::array<float,2>{0.495818883f, 0.855983734f},
-std::array<float,2>{0.281947702f, 0.109588176f},
-std::array<float,2>{0.795188427f, 0.969287336f},
-std::array<float,2>{0.557341874f, 0.268648922f},
-std::array<float,2>{0.168634862f, 0.693045259f},
-std::array<float,2>{0.0145895351f, 0.0347406566f},
-std::array<float,2>{0.713131666f, 0.89591372f},
-std::array<float,2>{0.938900769f, 0.338963687f},
-std::array<float,2>{0.398223221f, 0.628217936f},
-std::array<float,2>{0.312932611f, 0.388512641f},
-std::array<float,2>{0.866927803f, 0.577501118f},
-std::array<float,2>{0.567929983f, 0.208031863f},
-std::array<float,2>{0.195950568f, 0.794825494f},
-std::array<float,2>{0.128478199f, 0.301229149f},
-std::array<float,2>{0.516234457f, 0.740583062f},
-std::array<float,2>{0.757174909f, 0.0901984647f},
-std::array<float,2>{0.250608385f, 0.96614325f},
-std::array<float,2>{0.451480955f, 0.133824617f},
-std::array<float,2>{0.927918792f, 0.813726366f},
-std::array<float,2>{0.674300313f, 0.494077861f},
-std::array<float,2>{0.0698820204f, 0.522534072f},
-std::array<float,2>{0.0395959243f, 0.213509604f},
-std::array<float,2>{0.736883879f, 0.786726594f},
-std::array<float,2>{0.992447078f, 0.380049646f},
-std::array<float,2>{0.419782192f, 0.567697823f},
-std::array<float,2>{0.351315409f, 0.330978662f},
-std::array<float,2>{0.814619899f, 0.636008203f},
-std::array<float,2>{0.601625681f, 0.0414898247f},
-std::array<float,2>{0.230284899f, 0.899074852f},
-std::array<float,2>{0.162812576f, 0.485337317f},
-std::array<float,2>{0.548680127f, 0.531236529f},
-std::array<float,2>{0.783407152f, 0.12805514f},
-std::array<float,2>{0.289181352f, 0.821475565f},
-std::array<float,2>{0.485435903f, 0.0819371641f},
-std::array<float,2>{0.891407967f, 0.958552718f},
-std::array<float,2>{0.651743293f, 0.304737926f},
-std::array<float,2>{0.100042313f, 0.746067643f},
-std::array<float,2>{0.188146666f, 0.0193569865f},
-std::array<float,2>{0.576688647f, 0.920270979f},
-std::array<float,2>{0.868556976f, 0.374620885f},
-std::array<float,2>{0.322263181f, 0.679875791f},
-std::array<float,2>{0.403016806f, 0.432919711f},
-std::array<float,2>{0.952162921f, 0.600654006f},
-std::array<float,2>{0.709145904f, 0.220860288f},
-std::array<float,2>{0.00466496451f, 0.767437577f},
-std::array<float,2>{0.0727049485f, 0.278841019f},
-std::array<float,2>{0.682644129f, 0.702641368f},
-std::array<float,2>{0.937251568f, 0.124749161f},
-std::array<float,2>{0.439906836f, 0.981075227f},
-std::array<float,2>{0.259708643f, 0.176745787f},
-std::array<float,2>{0.760381997f, 0.846203029f},
-std::array<float,2>{0.530661464f, 0.439489692f},
-std::array<float,2>{0.139372811f, 0.554069102f},
-std::array<float,2>{0.144562513f, 0.152013615f},
-std::array<float,2>{0.50393033f, 0.833004475f},
-std::array<float,2>{0.765856564f, 0.48269856f},
-std::array<float,2>{0.271482259f, 0.501930535f},
-std::array<float,2>{0.460915983f, 0.28576082f},
-std::array<float,2>{0.921660721f, 0.722598016f},
-std::array<float,2>{0.656331778f, 0.0752534568f},
-std::array<float,2>{0.093562007f, 0.94526875f},
-std::array<float,2>{0.0165373627f, 0.401206046f},
-std::array<float,2>{0.69138509f, 0.584411919f},
-std::array<float,2>{0.967297912f, 0.194025159f},
-std::array<float,2>{0.380950004f, 0.812236726f},
-std::array<float,2>{0.340875894f, 0.0617015213f},
-std::array<float,2>{0.848839283f, 0.885096729f},
-std::array<float,2>{0.582787335f, 0.326990366f},
-std::array<float,2>{0.214003608f, 0.650368869f},
-std::array<float,2>{0.116375156f, 0.0966011658f},
-std::array<float,2>{0.634559333f, 0.995576501f},
-std::array<float,2>{0.884997487f, 0.251119703f},
-std::array<float,2>{0.48103705f, 0.712720573f},
-std::array<float,2>{0.308358252f, 0.45574373f},
-std::array<float,2>{0.801811635f, 0.542242229f},
-std::array<float,2>{0.546247721f, 0.166423395f},
-std::array<float,2>{0.180711836f, 0.86682725f},
-std::array<float,2>{0.239867359f, 0.34623006f},
-std::array<float,2>{0.623816788f, 0.658888757f},
-std::array<float,2>{0.839361608f, 0.0113175754f},
-std::array<float,2>{0.359891862f, 0.935355544f},
-std::array<float,2>{0.433890879f, 0.236508682f},
-std::array<float,2>{0.980424523f, 0.75262624f},
-std::array<float,2>{0.719727099f, 0.409458011f},
-std::array<float,2>{0.0609741732f, 0.616816282f},
-std::array<float,2>{0.0754079968f, 0.195425913f},
-std::array<float,2>{0.684671044f, 0.803622246f},
-std::array<float,2>{0.932255983f, 0.391589314f},
-std::array<float,2>{0.442908019f, 0.590832055f},
-std::array<float,2>{0.26298359f, 0.314217508f},
-std::array<float,2>{0.763970852f, 0.647370517f},
-std::array<float,2>{0.525674343f, 0.0526439585f},
-std::array<float,2>{0.133408263f, 0.877228439f},
-std::array<float,2>{0.192497984f, 0.471220553f},
-std::array<float,2>{0.570650041f, 0.51529032f},
-std::array<float,2>{0.872053742f, 0.142572343f},
-std::array<float,2>{0.327371299f, 0.842826188f},
-std::array<float,2>{0.399301499f, 0.0625840873f},
-std::array<float,2>{0.946906865f, 0.94896853f},
-std::array<float,2>{0.703900456f, 0.290059626f},
-std::array<float,2>{0.00177098915f, 0.727722108f},
-std::array<float,2>{0.157999441f, 0.000503534277f},
-std::array<float,2>{0.55458349f, 0.922946393f},
-std::array<float,2>{0.785763621f, 0.358382493f},
-std::array<float,2>{0.294870377f, 0.669519246f},
-std::array<float,2>{0.491504908f, 0.417214423f},
-std::array<float,2>{0.896101534f, 0.621231318f},
-std::array<float,2>{0.653446615f, 0.246148437f},
-std::array<float,2>{0.0959288329f, 0.761271298f},
-std::array<float,2>{0.0453774594f, 0.262290299f},
-std::array<float,2>{0.742066562f, 0.709563255f},
-std::array<float,2>{0.997326553f, 0.102125518f},
-std::array<float,2>{0.415837556f, 0.99010855f},
-std::array<float,2>{0.345564276f, 0.161001682f},
-std::array<float,2>{0.820233524f, 0.868545532f},
-std::array<float,2>{0.605879784f, 0.465208381f},
-std::array<float,2>{0.230796367f, 0.531278133f},
-std::array<float,2>{0.237528011f, 0.137191162f},
-std::array<float,2>{0.61977303f, 0.817644536f},
-std::array<float,2>{0.841008961f, 0.49726522f},
-std::array<float,2>{0.36552617f, 0.51711297f},
-std::array<float,2>{0.429754823f, 0.299063474f},
-std::array<float,2>{0.983691871f, 0.737161577f},
-std::array<float,2>{0.725904167f, 0.0879643485f},
-std::array<float,2>{0.0561605357f, 0.964594185f},
-std::array<float,2>{0.110738263f, 0.386549503f},
-std::array<float,2>{0.637568057f, 0.570764601f},
-std::array<float,2>{0.889870584f, 0.206093758f},
-std::array<float,2>{0.480116546f, 0.792286932f},
-std::array<float,2>{0.311359793f, 0.0354123227f},
-std::array<float,2>{0.797912955f, 0.894307017f},
-std::array<float,2>{0.539119482f, 0.341047347f},
-std::array<float,2>{0.187323868f, 0.631426752f},
-std::array<float,2>{0.0212517697f, 0.116283119f},
-std::array<float,2>{0.692945778f, 0.974418759f},
-std::array<float,2>{0.961366892f, 0.273335814f},
-std::array<float,2>{0.378474265f, 0.690035164f},
-std::array<float,2>{0.337839663f, 0.450827181f},
-std::array<float,2>{0.843997061f, 0.561540246f},
-std::array<float,2>{0.579412162f, 0.185996547f},
-std::array<float,2>{0.216907322f, 0.855467856f},
-std::array<float,2>{0.144399047f, 0.366669923f},
-std::array<float,2>{0.50200063f, 0.675158679f},
-std::array<float,2>{0.77093035f, 0.0256325267f},
-std::array<float,2>{0.268932432f, 0.909407496f},
-std::array<float,2>{0.455983877f, 0.233641669f},
-std::array<float,2>{0.915876746f, 0.776451707f},
-std::array<float,2>{0.661447167f, 0.427066684f},
-std::array<float,2>{0.0895296261f, 0.604211211f},
-std::array<float,2>{0.0470249914f, 0.173759729f},
-std::array<float,2>{0.733909726f, 0.850886106f},
-std::array<float,2>{0.972471237f, 0.442246765f},
-std::array<float,2>{0.423463106f, 0.550643682f},
-std::array<float,2>{0.36737591f, 0.274115384f},
-std::array<float,2>{0.82932657f, 0.696945429f},
-std::array<float,2>{0.61492461f, 0.118281916f},
-std::array<float,2>{0.245571852f, 0.976696432f},
-std::array<float,2>{0.177607179f, 0.436004549f},
-std::array<float,2>{0.533240139f, 0.594057679f},
-std::array<float,2>{0.809835196f, 0.22493583f},
-std::array<float,2>{0.299238741f, 0.770475268f},
-std::array<float,2>{0.473842829f, 0.021195678f},
-std::array<float,2>{0.875159144f, 0.917893589f},
-std::array<float,2>{0.628612816f, 0.369444549f},
-std::array<float,2>{0.124389857f, 0.685798466f},
-std::array<float,2>{0.205470666f, 0.0838626921f},
-std::array<float,2>{0.586271822f, 0.956363916f},
-std::array<float,2>{0.853279591f, 0.309535623f},
-std::array<float,2>{0.333734334f, 0.749066412f},
-std::array<float,2>{0.385631382f, 0.490708143f},
-std::array<float,2>{0.955213368f, 0.523833513f},
-std::array<float,2>{0.696887493f, 0.131575719f},
-std::array<float,2>{0.025127288f, 0.826825857f},
-std::array<float,2>{0.0833135918f, 0.333431393f},
-std::array<float,2>{0.671615124f, 0.637094438f},
-std::array<float,2>{0.909790456f, 0.044700142f},
-std::array<float,2>{0.465063751f, 0.904375434f},
-std::array<float,2>{0.278908014f, 0.217959151f},
-std::array<float,2>{0.779934287f, 0.783102334f},
-std::array<float,2>{0.51066643f, 0.377880275f},
-std::array<float,2>{0.150121897f, 0.564329028f},
-std::array<float,2>{0.130504951f, 0.240008727f},
-std::array<float,2>{0.519706786f, 0.755588293f},
-std::array<float,2>{0.750403523f, 0.410360277f},
-std::array<float,2>{0.257041812f, 0.611531198f},
-std::array<float,2>{0.446223587f, 0.350569725f},
-std::array<float,2>{0.924442708f, 0.663657486f},
-std::array<float,2>{0.678548694f, 0.0128413169f},
-std::array<float,2>{0.0629751608f, 0.931031346f},
-std::array<float,2>{0.00866972562f, 0.45830667f},
-std::array<float,2>{0.715730608f, 0.546402395f},
-std::array<float,2>{0.945163012f, 0.169209793f},
-std::array<float,2>{0.393776566f, 0.862836838f},
-std::array<float,2>{0.318648845f, 0.101221755f},
-std::array<float,2>{0.860009015f, 0.997095466f},
-std::array<float,2>{0.56383276f, 0.255139232f},
-std::array<float,2>{0.2026577f, 0.715170741f},
-std::array<float,2>{0.102102034f, 0.0578808486f},
-std::array<float,2>{0.644675553f, 0.888182044f},
-std::array<float,2>{0.904027939f, 0.322200775f},
-std::array<float,2>{0.498526603f, 0.653985441f},
-std::array<float,2>{0.286438763f, 0.402581125f},
-std::array<float,2>{0.79237169f, 0.579122543f},
-std::array<float,2>{0.559929788f, 0.1906863f},
-std::array<float,2>{0.166958854f, 0.807519734f},
-std::array<float,2>{0.219958887f, 0.282698005f},
-std::array<float,2>{0.597307086f, 0.725452304f},
-std::array<float,2>{0.825708449f, 0.0741240084f},
-std::array<float,2>{0.354170889f, 0.93799144f},
-std::array<float,2>{0.410773098f, 0.154463083f},
-std::array<float,2>{0.98934418f, 0.829661906f},
-std::array<float,2>{0.7465958f, 0.480121076f},
-std::array<float,2>{0.036328163f, 0.504772127f},
-std::array<float,2>{0.117806658f, 0.146012589f},
-std::array<float,2>{0.631593108f, 0.839005828f},
-std::array<float,2>{0.879338264f, 0.475973248f},
-std::array<float,2>{0.471239388f, 0.510686874f},
-std::array<float,2>{0.30329293f, 0.293049514f},
-std::array<float,2>{0.80505842f, 0.733226299f},
-std::array<float,2>{0.535518348f, 0.070079647f},
-std::array<float,2>{0.174550802f, 0.949986577f},
-std::array<float,2>{0.249456033f, 0.395522177f},
-std::array<float,2>{0.609387755f, 0.589264572f},
-std::array<float,2>{0.833439052f, 0.20118846f},
-std::array<float,2>{0.372236371f, 0.800208092f},
-std::array<float,2>{0.426351219f, 0.0491236895f},
-std::array<float,2>{0.974673331f, 0.87921834f},
-std::array<float,2>{0.726813197f, 0.317599267f},
-std::array<float,2>{0.052265387f, 0.643089175f},
-std::array<float,2>{0.153451845f, 0.107629515f},
-std::array<float,2>{0.511853039f, 0.98776561f},
-std::array<float,2>{0.773504436f, 0.260328382f},
-std::array<float,2>{0.275899589f, 0.704321504f},
-std::array<float,2>{0.462129802f, 0.464412272f},
-std::array<float,2>{0.910466254f, 0.536471605f},
-std::array<float,2>{0.666293621f, 0.158825293f},
-std::array<float,2>{0.0804639608f, 0.873870969f},
-std::array<float,2>{0.0298293587f, 0.352983505f},
-std::array<float,2>{0.702833176f, 0.665144145f},
-std::array<float,2>{0.958693981f, 0.00745587284f},
-std::array<float,2>{0.386866242f, 0.928628445f},
-std::array<float,2>{0.329652548f, 0.244823501f},
-std::array<float,2>{0.85700351f, 0.763633192f},
-std::array<float,2>{0.593374968f, 0.419156432f},
-std::array<float,2>{0.210834935f, 0.619105279f},
-std::array<float,2>{0.197631314f, 0.209428534f},
-std::array<float,2>{0.570193708f, 0.796844244f},
-std::array<float,2>{0.86475575f, 0.38905409f},
-std::array<float,2>{0.314971268f, 0.576141834f},
-std::array<float,2>{0.396161795f, 0.336581975f},
-std::array<float,2>{0.940518022f, 0.626150846f},
-std::array<float,2>{0.712118745f, 0.0318741016f},
-std::array<float,2>{0.0119005041f, 0.897335351f},
-std::array<float,2>{0.0682511404f, 0.495453775f},
-std::array<float,2>{0.672665238f, 0.520479739f},
-std::array<float,2>{0.926382065f, 0.135266349f},
-std::array<float,2>{0.450873584f, 0.814669669f},
-std::array<float,2>{0.2531178f, 0.0919350833f},
-std::array<float,2>{0.754426539f, 0.967748284f},
-std::array<float,2>{0.518696904f, 0.304594874f},
-std::array<float,2>{0.125251383f, 0.738439143f},
-std::array<float,2>{0.0324651189f, 0.0294986367f},
-std::array<float,2>{0.74489665f, 0.913776934f},
-std::array<float,2>{0.987584829f, 0.360064566f},
-std::array<float,2>{0.409851998f, 0.678830743f},
-std::array<float,2>{0.359160155f, 0.424863249f},
-std::array<float,2>{0.823691487f, 0.606387556f},
-std::array<float,2>{0.600848615f, 0.226780236f},
-std::array<float,2>{0.223464414f, 0.777566135f},
-std::array<float,2>{0.170932591f, 0.26653254f},
-std::array<float,2>{0.555975199f, 0.694247127f},
-std::array<float,2>{0.794767022f, 0.112548441f},
-std::array<float,2>{0.284657568f, 0.972235858f},
-std::array<float,2>{0.492883086f, 0.182689071f},
-std::array<float,2>{0.901138783f, 0.858433485f},
-std::array<float,2>{0.641386151f, 0.446911484f},
-std::array<float,2>{0.107057877f, 0.556462049f},
-std::array<float,2>{0.00768961105f, 0.219992578f},
-std::array<float,2>{0.708561122f, 0.768506229f},
-std::array<float,2>{0.950627565f, 0.430015326f},
-std::array<float,2>{0.405272216f, 0.598517537f},
-std::array<float,2>{0.323151201f, 0.372093052f},
-std::array<float,2>{0.870152712f, 0.682902575f},
-std::array<float,2>{0.575173676f, 0.0167222861f},
-std::array<float,2>{0.189661145f, 0.918915927f},
-std::array<float,2>{0.13841249f, 0.438933492f},
-std::array<float,2>{0.527567387f, 0.551249444f},
-std::array<float,2>{0.75829196f, 0.178924829f},
-std::array<float,2>{0.261674583f, 0.845267713f},
-std::array<float,2>{0.438153356f, 0.121898398f},
-std::array<float,2>{0.935448945f, 0.983376682f},
-std::array<float,2>{0.680035353f, 0.279668987f},
-std::array<float,2>{0.0719055459f, 0.700325429f},
-std::array<float,2>{0.226712093f, 0.0397254303f},
-std::array<float,2>{0.603976727f, 0.900425315f},
-std::array<float,2>{0.812914133f, 0.329244077f},
-std::array<float,2>{0.348556817f, 0.63403827f},
-std::array<float,2>{0.421048373f, 0.381190598f},
-std::array<float,2>{0.995424092f, 0.569898665f},
-std::array<float,2>{0.734752357f, 0.212710753f},
-std::array<float,2>{0.0415638946f, 0.788097858f},
-std::array<float,2>{0.0994711667f, 0.30714184f},
-std::array<float,2>{0.648626089f, 0.743351579f},
-std::array<float,2>{0.8941679f, 0.0792336762f},
-std::array<float,2>{0.48827821f, 0.959588408f},
-std::array<float,2>{0.291154861f, 0.126628608f},
-std::array<float,2>{0.782465756f, 0.823621273f},
-std::array<float,2>{0.550665259f, 0.488060892f},
-std::array<float,2>{0.161052316f, 0.528503537f},
-std::array<float,2>{0.182329834f, 0.164620548f},
-std::array<float,2>{0.543930292f, 0.863608122f},
-std::array<float,2>{0.802957535f, 0.454583317f},
-std::array<float,2>{0.305618763f, 0.54056251f},
-std::array<float,2>{0.482797265f, 0.253433734f},
-std::array<float,2>{0.883943498f, 0.714742839f},
-std::array<float,2>{0.636244774f, 0.0941642523f},
-std::array<float,2>{0.114539325f, 0.992880046f},
-std::array<float,2>{0.0602652654f, 0.408021033f},
-std::array<float,2>{0.721970737f, 0.613979995f},
-std::array<float,2>{0.977349222f, 0.235452041f},
-std::array<float,2>{0.436301589f, 0.751793921f},
-std::array<float,2>{0.362372488f, 0.00851567183f},
-std::array<float,2>{0.836821556f, 0.936257601f},
-std::array<float,2>{0.622374296f, 0.345334798f},
-std::array<float,2>{0.241351992f, 0.656715274f},
-std::array<float,2>{0.0913066119f, 0.0778971687f},
-std::array<float,2>{0.659686923f, 0.941969573f},
-std::array<float,2>{0.918253601f, 0.287934691f},
-std::array<float,2>{0.457202643f, 0.720244467f},
-std::array<float,2>{0.27162981f, 0.480880439f},
-std::array<float,2>{0.768827558f, 0.503659844f},
-std::array<float,2>{0.506862104f, 0.149282485f},
-std::array<float,2>{0.147113845f, 0.834579468f},
-std::array<float,2>{0.212832764f, 0.324666113f},
-std::array<float,2>{0.585169196f, 0.650440633f},
-std::array<float,2>{0.85073328f, 0.0598685332f},
-std::array<float,2>{0.341884285f, 0.883711755f},
-std::array<float,2>{0.380698264f, 0.191472694f},
-std::array<float,2>{0.96675235f, 0.81011337f},
-std::array<float,2>{0.687981784f, 0.399485022f},
-std::array<float,2>{0.0176765546f, 0.583264887f},
-std::array<float,2>{0.112245947f, 0.205080897f},
-std::array<float,2>{0.639948726f, 0.791354418f},
-std::array<float,2>{0.887175739f, 0.385555446f},
-std::array<float,2>{0.477842569f, 0.571830034f},
-std::array<float,2>{0.309213936f, 0.340158373f},
-std::array<float,2>{0.800501645f, 0.632687449f},
-std::array<float,2>{0.541791737f, 0.036976479f},
-std::array<float,2>{0.184772834f, 0.893378079f},
-std::array<float,2>{0.235909805f, 0.496552736f},
-std::array<float,2>{0.617492735f, 0.51654917f},
-std::array<float,2>{0.842661023f, 0.138587087f},
-std::array<float,2>{0.363600403f, 0.817013562f},
-std::array<float,2>{0.43245399f, 0.0895541608f},
-std::array<float,2>{0.98111552f, 0.963496149f},
-std::array<float,2>{0.723847568f, 0.300557464f},
-std::array<float,2>{0.056746453f, 0.737845898f},
-std::array<float,2>{0.140806898f, 0.0273338314f},
-std::array<float,2>{0.500212789f, 0.908343554f},
-std::array<float,2>{0.773196816f, 0.366111398f},
-std::array<float,2>{0.265824437f, 0.674483597f},
-std::array<float,2>{0.454302192f, 0.426311076f},
-std::array<float,2>{0.917736769f, 0.604675114f},
-std::array<float,2>{0.662431717f, 0.232806206f},
-std::array<float,2>{0.0864458159f, 0.776110291f},
-std::array<float,2>{0.0222339425f, 0.271986425f},
-std::array<float,2>{0.693727672f, 0.691290081f},
-std::array<float,2>{0.963885069f, 0.115974747f},
-std::array<float,2>{0.375993967f, 0.973014235f},
-std::array<float,2>{0.338502228f, 0.18726486f},
-std::array<float,2>{0.847360909f, 0.854456782f},
-std::array<float,2>{0.582030296f, 0.450105131f},
-std::array<float,2>{0.216475248f, 0.560581982f},
-std::array<float,2>{0.194930017f, 0.140647724f},
-std::array<float,2>{0.572326601f, 0.841865301f},
-std::array<float,2>{0.874326527f, 0.472644567f},
-std::array<float,2>{0.325550497f, 0.514297903f},
-std::array<float,2>{0.402009308f, 0.289187223f},
-std::array<float,2>{0.948771834f, 0.726723671f},
-std::array<float,2>{0.705924511f, 0.0642042756f},
-std::array<float,2>{0.00287190545f, 0.947312772f},
-std::array<float,2>{0.0780640766f, 0.39176175f},
-std::array<float,2>{0.687203944f, 0.590233326f},
-std::array<float,2>{0.930781186f, 0.19677408f},
-std::array<float,2>{0.443570465f, 0.804582119f},
-std::array<float,2>{0.265008003f, 0.0508628897f},
-std::array<float,2>{0.762027264f, 0.878881395f},
-std::array<float,2>{0.524355352f, 0.313241303f},
-std::array<float,2>{0.136316955f, 0.647884429f},
-std::array<float,2>{0.0439330228f, 0.103143029f},
-std::array<float,2>{0.739366293f, 0.988762856f},
-std::array<float,2>{0.998251975f, 0.262898088f},
-std::array<float,2>{0.416885942f, 0.710815132f},
-std::array<float,2>{0.347291619f, 0.466464937f},
-std::array<float,2>{0.816630721f, 0.532822967f},
-std::array<float,2>{0.608048141f, 0.161408976f},
-std::array<float,2>{0.23242566f, 0.868129909f},
-std::array<float,2>{0.158630461f, 0.359163851f},
-std::array<float,2>{0.551865101f, 0.668905675f},
-std::array<float,2>{0.788700879f, 0.00139214925f},
-std::array<float,2>{0.296075404f, 0.922264934f},
-std::array<float,2>{0.489822596f, 0.247343332f},
-std::array<float,2>{0.896545291f, 0.760492086f},
-std::array<float,2>{0.655091166f, 0.416450351f},
-std::array<float,2>{0.0948517472f, 0.622733414f},
-std::array<float,2>{0.0108525064f, 0.168802679f},
-std::array<float,2>{0.718187451f, 0.861995339f},
-std::array<float,2>{0.942980587f, 0.457636029f},
-std::array<float,2>{0.391629815f, 0.545876622f},
-std::array<float,2>{0.317955077f, 0.254110336f},
-std::array<float,2>{0.863021731f, 0.716193438f},
-std::array<float,2>{0.565480232f, 0.100466602f},
-std::array<float,2>{0.201154411f, 0.996487975f},
-std::array<float,2>{0.132467866f, 0.411593914f},
-std::array<float,2>{0.522427738f, 0.613100529f},
-std::array<float,2>{0.753510475f, 0.23856993f},
-std::array<float,2>{0.254425615f, 0.754379809f},
-std::array<float,2>{0.448043406f, 0.0123302331f},
-std::array<float,2>{0.923401296f, 0.930128157f},
-std::array<float,2>{0.676440001f, 0.351054549f},
-std::array<float,2>{0.0656554475f, 0.66281265f},
-std::array<float,2>{0.222348049f, 0.0727855265f},
-std::array<float,2>{0.594311297f, 0.939093113f},
-std::array<float,2>{0.827437818f, 0.281510293f},
-std::array<float,2>{0.353459179f, 0.726222992f},
-std::array<float,2>{0.414007694f, 0.479308158f},
-std::array<float,2>{0.991186917f, 0.505216837f},
-std::array<float,2>{0.749690652f, 0.156204343f},
-std::array<float,2>{0.0371622443f, 0.828411937f},
-std::array<float,2>{0.104706779f, 0.321077436f},
-std::array<float,2>{0.647231042f, 0.652369559f},
-std::array<float,2>{0.905344546f, 0.056974031f},
-std::array<float,2>{0.496308357f, 0.887236774f},
-std::array<float,2>{0.28851983f, 0.189756542f},
-std::array<float,2>{0.789129257f, 0.808249295f},
-std::array<float,2>{0.562048018f, 0.40339306f},
-std::array<float,2>{0.164131179f, 0.579071105f},
-std::array<float,2>{0.178620785f, 0.226007074f},
-std::array<float,2>{0.532549322f, 0.771188378f},
-std::array<float,2>{0.812437415f, 0.437122792f},
-std::array<float,2>{0.297483653f, 0.595626593f},
-std::array<float,2>{0.476508707f, 0.370940477f},
-std::array<float,2>{0.878313422f, 0.686798453f},
-std::array<float,2>{0.626255453f, 0.0201654863f},
-std::array<float,2>{0.122523077f, 0.91661948f},
-std::array<float,2>{0.0506340191f, 0.44313243f},
-std::array<float,2>{0.730945349f, 0.549503922f},
-std::array<float,2>{0.969555318f, 0.172306865f},
-std::array<float,2>{0.425621063f, 0.850262165f},
-std::array<float,2>{0.371051669f, 0.11780338f},
-std::array<float,2>{0.831948102f, 0.977714956f},
-std::array<float,2>{0.615335345f, 0.275068521f},
-std::array<float,2>{0.24404484f, 0.695844412f},
-std::array<float,2>{0.0853550881f, 0.0435402095f},
-std::array<float,2>{0.669400096f, 0.905748248f},
-std::array<float,2>{0.907726049f, 0.332203746f},
-std::array<float,2>{0.468594581f, 0.638306439f},
-std::array<float,2>{0.280148f, 0.378222764f},
-std::array<float,2>{0.778521538f, 0.562537134f},
-std::array<float,2>{0.508273542f, 0.216952622f},
-std::array<float,2>{0.151081771f, 0.781648755f},
-std::array<float,2>{0.204302326f, 0.30979237f},
-std::array<float,2>{0.588003099f, 0.748312533f},
-std::array<float,2>{0.853943408f, 0.0821998492f},
-std::array<float,2>{0.334463388f, 0.955238104f},
-std::array<float,2>{0.38419506f, 0.132237405f},
-std::array<float,2>{0.954022348f, 0.827518761f},
-std::array<float,2>{0.697938979f, 0.491280407f},
-std::array<float,2>{0.0255245417f, 0.525329947f},
-std::array<float,2>{0.0688335001f, 0.136474937f},
-std::array<float,2>{0.675684154f, 0.815989912f},
-std::array<float,2>{0.929643095f, 0.49429065f},
-std::array<float,2>{0.452822328f, 0.520622075f},
-std::array<float,2>{0.2510885f, 0.303698063f},
-std::array<float,2>{0.756552279f, 0.740015686f},
-std::array<float,2>{0.517222404f, 0.0928372219f},
-std::array<float,2>{0.12699607f, 0.968646824f},
-std::array<float,2>{0.196983621f, 0.389797509f},
-std::array<float,2>{0.56649822f, 0.574564815f},
-std::array<float,2>{0.865710258f, 0.210571855f},
-std::array<float,2>{0.313875854f, 0.794958293f},
-std::array<float,2>{0.397259504f, 0.033196155f},
-std::array<float,2>{0.938174665f, 0.898072124f},
-std::array<float,2>{0.714772344f, 0.337889075f},
-std::array<float,2>{0.0155605804f, 0.625194728f},
-std::array<float,2>{0.169083327f, 0.111499593f},
-std::array<float,2>{0.558162332f, 0.971631467f},
-std::array<float,2>{0.795975685f, 0.266744912f},
-std::array<float,2>{0.283152312f, 0.694678843f},
-std::array<float,2>{0.49497816f, 0.44563669f},
-std::array<float,2>{0.900160313f, 0.555509925f},
-std::array<float,2>{0.642977834f, 0.181680009f},
-std::array<float,2>{0.107498839f, 0.857809961f},
-std::array<float,2>{0.0343877487f, 0.360683918f},
-std::array<float,2>{0.743726969f, 0.677953124f},
-std::array<float,2>{0.984843671f, 0.0312003903f},
-std::array<float,2>{0.406530589f, 0.912911355f},
-std::array<float,2>{0.356697112f, 0.228167847f},
-std::array<float,2>{0.822193503f, 0.779211462f},
-std::array<float,2>{0.598333716f, 0.423924565f},
-std::array<float,2>{0.225043818f, 0.606998086f},
-std::array<float,2>{0.247237906f, 0.202625349f},
-std::array<float,2>{0.612746775f, 0.799322784f},
-std::array<float,2>{0.835573554f, 0.394709796f},
-std::array<float,2>{0.373510659f, 0.588117957f},
-std::array<float,2>{0.428686321f, 0.316919029f},
-std::array<float,2>{0.974135995f, 0.643601239f},
-std::array<float,2>{0.728737772f, 0.0501717441f},
-std::array<float,2>{0.0528442413f, 0.880272508f},
-std::array<float,2>{0.119364053f, 0.475309402f},
-std::array<float,2>{0.63068521f, 0.510774732f},
-std::array<float,2>{0.882243156f, 0.145335332f},
-std::array<float,2>{0.469418019f, 0.838309169f},
-std::array<float,2>{0.301715434f, 0.068612799f},
-std::array<float,2>{0.807751596f, 0.950553119f},
-std::array<float,2>{0.537884593f, 0.294857979f},
-std::array<float,2>{0.172908604f, 0.734142423f},
-std::array<float,2>{0.0291954577f, 0.00665201852f},
-std::array<float,2>{0.700184703f, 0.928968191f},
-std::array<float,2>{0.960647404f, 0.351636648f},
-std::array<float,2>{0.390337706f, 0.664633095f},
-std::array<float,2>{0.330420852f, 0.41861245f},
-std::array<float,2>{0.858705282f, 0.617863297f},
-std::array<float,2>{0.591658413f, 0.245593667f},
-std::array<float,2>{0.208586469f, 0.762249053f},
-std::array<float,2>{0.155085638f, 0.260956317f},
-std::array<float,2>{0.515400231f, 0.703954637f},
-std::array<float,2>{0.776514292f, 0.108536772f},
-std::array<float,2>{0.274479359f, 0.986486375f},
-std::array<float,2>{0.463445812f, 0.159590915f},
-std::array<float,2>{0.912944734f, 0.874618292f},
-std::array<float,2>{0.665082037f, 0.463628918f},
-std::array<float,2>{0.0792763904f, 0.535328507f},
-std::array<float,2>{0.0619205907f, 0.235020444f},
-std::array<float,2>{0.719054937f, 0.750752509f},
-std::array<float,2>{0.97879827f, 0.407003492f},
-std::array<float,2>{0.4352521f, 0.614924312f},
-std::array<float,2>{0.360384703f, 0.344353527f},
-std::array<float,2>{0.837974072f, 0.657392204f},
-std::array<float,2>{0.624519825f, 0.0090848282f},
-std::array<float,2>{0.238397315f, 0.936665833f},
-std::array<float,2>{0.180653721f, 0.453712493f},
-std::array<float,2>{0.545023024f, 0.539537787f},
-std::array<float,2>{0.801484764f, 0.165810317f},
-std::array<float,2>{0.307391316f, 0.864990294f},
-std::array<float,2>{0.481764436f, 0.0948088393f},
-std::array<float,2>{0.886363149f, 0.99371022f},
-std::array<float,2>{0.633141816f, 0.251986563f},
-std::array<float,2>{0.116123825f, 0.713604093f},
-std::array<float,2>{0.213054568f, 0.0589752533f},
-std::array<float,2>{0.583569705f, 0.88437134f},
-std::array<float,2>{0.847707093f, 0.325284362f},
-std::array<float,2>{0.339991421f, 0.651805401f},
-std::array<float,2>{0.382550746f, 0.398751736f},
-std::array<float,2>{0.968391001f, 0.582898915f},
-std::array<float,2>{0.689784348f, 0.192802966f},
-std::array<float,2>{0.017312102f, 0.808859825f},
-std::array<float,2>{0.0922186226f, 0.288971335f},
-std::array<float,2>{0.657648563f, 0.719506621f},
-std::array<float,2>{0.920001447f, 0.077130653f},
-std::array<float,2>{0.459867328f, 0.942899704f},
-std::array<float,2>{0.270096064f, 0.150366381f},
-std::array<float,2>{0.766605675f, 0.835226357f},
-std::array<float,2>{0.505722284f, 0.481743872f},
-std::array<float,2>{0.145697966f, 0.502788901f},
-std::array<float,2>{0.140332252f, 0.177871019f},
-std::array<float,2>{0.529509008f, 0.843955517f},
-std::array<float,2>{0.760745108f, 0.438194156f},
-std::array<float,2>{0.257988423f, 0.552353621f},
-std::array<float,2>{0.440470517f, 0.280428767f},
-std::array<float,2>{0.935843468f, 0.699443817f},
-std::array<float,2>{0.682203948f, 0.122856721f},
-std::array<float,2>{0.0737674609f, 0.983847439f},
-std::array<float,2>{0.0050158645f, 0.430752456f},
-std::array<float,2>{0.710266054f, 0.598668337f},
-std::array<float,2>{0.951815665f, 0.218778893f},
-std::array<float,2>{0.40335834f, 0.769465506f},
-std::array<float,2>{0.321272045f, 0.0158139318f},
-std::array<float,2>{0.867365837f, 0.919719577f},
-std::array<float,2>{0.578004479f, 0.371801019f},
-std::array<float,2>{0.189042225f, 0.682579994f},
-std::array<float,2>{0.101253793f, 0.0789197981f},
-std::array<float,2>{0.651064515f, 0.96030581f},
-std::array<float,2>{0.891945601f, 0.308365732f},
-std::array<float,2>{0.485247254f, 0.74316293f},
-std::array<float,2>{0.290304989f, 0.48720631f},
-std::array<float,2>{0.78497231f, 0.527987003f},
-std::array<float,2>{0.547810316f, 0.12574847f},
-std::array<float,2>{0.163772181f, 0.822470844f},
-std::array<float,2>{0.228787735f, 0.328428835f},
-std::array<float,2>{0.602855861f, 0.633309603f},
-std::array<float,2>{0.816342354f, 0.0407911912f},
-std::array<float,2>{0.350519419f, 0.901853204f},
-std::array<float,2>{0.418550104f, 0.211205766f},
-std::array<float,2>{0.993373036f, 0.787971616f},
-std::array<float,2>{0.737880707f, 0.382757813f},
-std::array<float,2>{0.0401597321f, 0.568498552f},
-std::array<float,2>{0.0885729641f, 0.231913596f},
-std::array<float,2>{0.660184324f, 0.774354339f},
-std::array<float,2>{0.914241135f, 0.428249538f},
-std::array<float,2>{0.456813365f, 0.6032601f},
-std::array<float,2>{0.26774022f, 0.364035517f},
-std::array<float,2>{0.770204842f, 0.673576951f},
-std::array<float,2>{0.503166735f, 0.0242137928f},
-std::array<float,2>{0.142616719f, 0.906355381f},
-std::array<float,2>{0.218032673f, 0.451475292f},
-std::array<float,2>{0.579077542f, 0.55899477f},
-std::array<float,2>{0.845210075f, 0.18388772f},
-std::array<float,2>{0.33615914f, 0.852011085f},
-std::array<float,2>{0.377719015f, 0.114096612f},
-std::array<float,2>{0.962179184f, 0.975015223f},
-std::array<float,2>{0.69155246f, 0.27036804f},
-std::array<float,2>{0.0198955014f, 0.689399004f},
-std::array<float,2>{0.18594864f, 0.0390228517f},
-std::array<float,2>{0.54053247f, 0.891068399f},
-std::array<float,2>{0.797401011f, 0.342343122f},
-std::array<float,2>{0.312120408f, 0.630107939f},
-std::array<float,2>{0.478717715f, 0.384312451f},
-std::array<float,2>{0.88910985f, 0.572506309f},
-std::array<float,2>{0.637945592f, 0.204491153f},
-std::array<float,2>{0.110089138f, 0.78953445f},
-std::array<float,2>{0.0548287295f, 0.297832608f},
-std::array<float,2>{0.724903286f, 0.735341489f},
-std::array<float,2>{0.982992947f, 0.085958004f},
-std::array<float,2>{0.4315373f, 0.960965157f},
-std::array<float,2>{0.366521657f, 0.138882682f},
-std::array<float,2>{0.839914262f, 0.82028687f},
-std::array<float,2>{0.62014246f, 0.499567419f},
-std::array<float,2>{0.236457005f, 0.517811835f},
-std::array<float,2>{0.231695458f, 0.163188428f},
-std::array<float,2>{0.606877267f, 0.869747519f},
-std::array<float,2>{0.81873244f, 0.466969222f},
-std::array<float,2>{0.344260037f, 0.533517301f},
-std::array<float,2>{0.414758086f, 0.265583873f},
-std::array<float,2>{0.996561885f, 0.707034647f},
-std::array<float,2>{0.740603745f, 0.10532631f},
-std::array<float,2>{0.046166569f, 0.990993679f},
-std::array<float,2>{0.0969351381f, 0.415035278f},
-std::array<float,2>{0.652650893f, 0.62426883f},
-std::array<float,2>{0.894958258f, 0.24840036f},
-std::array<float,2>{0.49114275f, 0.758123636f},
-std::array<float,2>{0.293655545f, 0.00313686649f},
-std::array<float,2>{0.786205471f, 0.925303221f},
-std::array<float,2>{0.553012431f, 0.356291026f},
-std::array<float,2>{0.156518996f, 0.67100668f},
-std::array<float,2>{0.000920033548f, 0.0645728037f},
-std::array<float,2>{0.704165161f, 0.945600212f},
-std::array<float,2>{0.945729733f, 0.291499138f},
-std::array<float,2>{0.400019377f, 0.729424894f},
-std::array<float,2>{0.326727718f, 0.469874889f},
-std::array<float,2>{0.872737646f, 0.512143731f},
-std::array<float,2>{0.571585357f, 0.142682746f},
-std::array<float,2>{0.191782296f, 0.840770185f},
-std::array<float,2>{0.134682268f, 0.315254599f},
-std::array<float,2>{0.526840687f, 0.646156967f},
-std::array<float,2>{0.764661193f, 0.0538002849f},
-std::array<float,2>{0.262485325f, 0.875990212f},
-std::array<float,2>{0.442144275f, 0.199014768f},
-std::array<float,2>{0.932633936f, 0.800952852f},
-std::array<float,2>{0.684464157f, 0.393692702f},
-std::array<float,2>{0.0744996667f, 0.592336118f},
-std::array<float,2>{0.0353726707f, 0.152649894f},
-std::array<float,2>{0.747358799f, 0.830591202f},
-std::array<float,2>{0.989210963f, 0.477542341f},
-std::array<float,2>{0.411401689f, 0.507330954f},
-std::array<float,2>{0.355361819f, 0.283838451f},
-std::array<float,2>{0.824713051f, 0.723083258f},
-std::array<float,2>{0.596382797f, 0.07161282f},
-std::array<float,2>{0.218911782f, 0.939541459f},
-std::array<float,2>{0.167082027f, 0.405614465f},
-std::array<float,2>{0.558837116f, 0.581699073f},
-std::array<float,2>{0.791162729f, 0.187566251f},
-std::array<float,2>{0.285517544f, 0.805296242f},
-std::array<float,2>{0.499616027f, 0.055687923f},
-std::array<float,2>{0.90327096f, 0.889484823f},
-std::array<float,2>{0.646471083f, 0.322939634f},
-std::array<float,2>{0.102566965f, 0.655001819f},
-std::array<float,2>{0.201716587f, 0.0987983644f},
-std::array<float,2>{0.563153267f, 0.99825412f},
-std::array<float,2>{0.860851705f, 0.256183445f},
-std::array<float,2>{0.319916099f, 0.717476606f},
-std::array<float,2>{0.393212378f, 0.459089488f},
-std::array<float,2>{0.943421423f, 0.544464946f},
-std::array<float,2>{0.716019511f, 0.171768829f},
-std::array<float,2>{0.0091109518f, 0.860234201f},
-std::array<float,2>{0.0644107684f, 0.347843289f},
-std::array<float,2>{0.678891838f, 0.66165185f},
-std::array<float,2>{0.92568785f, 0.0137918424f},
-std::array<float,2>{0.446991682f, 0.933209598f},
-std::array<float,2>{0.256572574f, 0.241696998f},
-std::array<float,2>{0.751814067f, 0.756439865f},
-std::array<float,2>{0.521255374f, 0.413677901f},
-std::array<float,2>{0.129593194f, 0.609879851f},
-std::array<float,2>{0.148511752f, 0.215331152f},
-std::array<float,2>{0.510938525f, 0.785092711f},
-std::array<float,2>{0.780980825f, 0.376371831f},
-std::array<float,2>{0.278239101f, 0.565165639f},
-std::array<float,2>{0.466501057f, 0.334990323f},
-std::array<float,2>{0.908239543f, 0.638884604f},
-std::array<float,2>{0.67036587f, 0.0457661301f},
-std::array<float,2>{0.082846649f, 0.904170573f},
-std::array<float,2>{0.0236312728f, 0.488354266f},
-std::array<float,2>{0.695717216f, 0.526424825f},
-std::array<float,2>{0.956165612f, 0.129415691f},
-std::array<float,2>{0.385852903f, 0.825132549f},
-std::array<float,2>{0.332168788f, 0.0843604729f},
-std::array<float,2>{0.851966977f, 0.953445256f},
-std::array<float,2>{0.586987197f, 0.310623825f},
-std::array<float,2>{0.20640175f, 0.747595549f},
-std::array<float,2>{0.123622142f, 0.0219640583f},
-std::array<float,2>{0.627228081f, 0.915508747f},
-std::array<float,2>{0.876403511f, 0.367245167f},
-std::array<float,2>{0.472876251f, 0.683769226f},
-std::array<float,2>{0.300527364f, 0.435268849f},
-std::array<float,2>{0.809251368f, 0.596446455f},
-std::array<float,2>{0.53438288f, 0.223910153f},
-std::array<float,2>{0.176240921f, 0.772841394f},
-std::array<float,2>{0.245009094f, 0.277305424f},
-std::array<float,2>{0.613885343f, 0.698696971f},
-std::array<float,2>{0.828287423f, 0.120517708f},
-std::array<float,2>{0.368869454f, 0.978701413f},
-std::array<float,2>{0.422596097f, 0.174313724f},
-std::array<float,2>{0.970771968f, 0.848110676f},
-std::array<float,2>{0.73305881f, 0.444765508f},
-std::array<float,2>{0.0484742746f, 0.548764408f},
-std::array<float,2>{0.105647199f, 0.181088373f},
-std::array<float,2>{0.642164767f, 0.857297778f},
-std::array<float,2>{0.902327359f, 0.448744655f},
-std::array<float,2>{0.493726641f, 0.558549702f},
-std::array<float,2>{0.283802688f, 0.268343866f},
-std::array<float,2>{0.793195724f, 0.692135036f},
-std::array<float,2>{0.554736257f, 0.110423557f},
-std::array<float,2>{0.170779124f, 0.970215857f},
-std::array<float,2>{0.223668665f, 0.422549754f},
-std::array<float,2>{0.599626303f, 0.607631326f},
-std::array<float,2>{0.822966039f, 0.230216756f},
-std::array<float,2>{0.358187169f, 0.781208158f},
-std::array<float,2>{0.408510566f, 0.0276204702f},
-std::array<float,2>{0.986382782f, 0.910939693f},
-std::array<float,2>{0.745163381f, 0.361507207f},
-std::array<float,2>{0.0314434208f, 0.676197112f},
-std::array<float,2>{0.126590967f, 0.0917177647f},
-std::array<float,2>{0.517807245f, 0.965682983f},
-std::array<float,2>{0.755726814f, 0.30176115f},
-std::array<float,2>{0.252860308f, 0.741234064f},
-std::array<float,2>{0.449581504f, 0.492785901f},
-std::array<float,2>{0.927432418f, 0.521550655f},
-std::array<float,2>{0.673665881f, 0.133175373f},
-std::array<float,2>{0.0664969906f, 0.812586427f},
-std::array<float,2>{0.0130354259f, 0.338591248f},
-std::array<float,2>{0.711593509f, 0.627453506f},
-std::array<float,2>{0.940306306f, 0.0336311124f},
-std::array<float,2>{0.395463496f, 0.894701183f},
-std::array<float,2>{0.315559089f, 0.207228944f},
-std::array<float,2>{0.863657057f, 0.793438017f},
-std::array<float,2>{0.569311142f, 0.387631118f},
-std::array<float,2>{0.198450238f, 0.576280177f},
-std::array<float,2>{0.209272534f, 0.243548542f},
-std::array<float,2>{0.592270911f, 0.764718294f},
-std::array<float,2>{0.856085598f, 0.420892626f},
-std::array<float,2>{0.328585327f, 0.620297372f},
-std::array<float,2>{0.388153076f, 0.353758931f},
-std::array<float,2>{0.957408249f, 0.667959988f},
-std::array<float,2>{0.701245606f, 0.00523934746f},
-std::array<float,2>{0.0311994199f, 0.926679552f},
-std::array<float,2>{0.0811564475f, 0.462340951f},
-std::array<float,2>{0.667399645f, 0.537261128f},
-std::array<float,2>{0.911473453f, 0.15671888f},
-std::array<float,2>{0.461422086f, 0.871710181f},
-std::array<float,2>{0.277071029f, 0.107200667f},
-std::array<float,2>{0.774465621f, 0.985483825f},
-std::array<float,2>{0.513379395f, 0.259171098f},
-std::array<float,2>{0.152906999f, 0.705976427f},
-std::array<float,2>{0.0513102002f, 0.0481611229f},
-std::array<float,2>{0.728310943f, 0.881942272f},
-std::array<float,2>{0.976003826f, 0.319041967f},
-std::array<float,2>{0.42751798f, 0.640722752f},
-std::array<float,2>{0.371120393f, 0.397908658f},
-std::array<float,2>{0.832669914f, 0.586061239f},
-std::array<float,2>{0.610360265f, 0.200455204f},
-std::array<float,2>{0.248919144f, 0.797707617f},
-std::array<float,2>{0.174880788f, 0.29578051f},
-std::array<float,2>{0.536766887f, 0.730560601f},
-std::array<float,2>{0.806012928f, 0.0680304915f},
-std::array<float,2>{0.304336429f, 0.951970398f},
-std::array<float,2>{0.472108692f, 0.146849826f},
-std::array<float,2>{0.879918456f, 0.836426437f},
-std::array<float,2>{0.631854951f, 0.472737432f},
-std::array<float,2>{0.11860846f, 0.508464158f},
-std::array<float,2>{0.0189943854f, 0.194654182f},
-std::array<float,2>{0.688925087f, 0.811276138f},
-std::array<float,2>{0.965246439f, 0.401945859f},
-std::array<float,2>{0.379012406f, 0.585345566f},
-std::array<float,2>{0.34295851f, 0.328091562f},
-std::array<float,2>{0.849980414f, 0.648758352f},
-std::array<float,2>{0.584197521f, 0.0606808066f},
-std::array<float,2>{0.2116393f, 0.886066139f},
-std::array<float,2>{0.148308232f, 0.48414132f},
-std::array<float,2>{0.506309509f, 0.500536025f},
-std::array<float,2>{0.768145442f, 0.151096523f},
-std::array<float,2>{0.272653252f, 0.833727062f},
-std::array<float,2>{0.458018422f, 0.074656345f},
-std::array<float,2>{0.91918546f, 0.944210589f},
-std::array<float,2>{0.659030676f, 0.286438167f},
-std::array<float,2>{0.0904922187f, 0.721224844f},
-std::array<float,2>{0.241106465f, 0.0104987239f},
-std::array<float,2>{0.621389627f, 0.934531152f},
-std::array<float,2>{0.837107241f, 0.347420573f},
-std::array<float,2>{0.361365139f, 0.659404635f},
-std::array<float,2>{0.436801285f, 0.408777356f},
-std::array<float,2>{0.978362978f, 0.6152758f},
-std::array<float,2>{0.721529603f, 0.237467036f},
-std::array<float,2>{0.0590539463f, 0.753837109f},
-std::array<float,2>{0.113303632f, 0.250633597f},
-std::array<float,2>{0.635598063f, 0.711540163f},
-std::array<float,2>{0.882940233f, 0.0975228399f},
-std::array<float,2>{0.483628482f, 0.994205892f},
-std::array<float,2>{0.306468308f, 0.167649686f},
-std::array<float,2>{0.804193974f, 0.865494251f},
-std::array<float,2>{0.54398191f, 0.456246257f},
-std::array<float,2>{0.183394566f, 0.541940093f},
-std::array<float,2>{0.161878958f, 0.127135336f},
-std::array<float,2>{0.549067616f, 0.821208417f},
-std::array<float,2>{0.781411469f, 0.486027569f},
-std::array<float,2>{0.292030901f, 0.529476821f},
-std::array<float,2>{0.487007558f, 0.305950016f},
-std::array<float,2>{0.893198073f, 0.745113194f},
-std::array<float,2>{0.649870276f, 0.0807170421f},
-std::array<float,2>{0.0977105275f, 0.957063913f},
-std::array<float,2>{0.0420081094f, 0.379538417f},
-std::array<float,2>{0.736227751f, 0.566601872f},
-std::array<float,2>{0.994860053f, 0.214665622f},
-std::array<float,2>{0.420063496f, 0.785465717f},
-std::array<float,2>{0.348783553f, 0.0422124341f},
-std::array<float,2>{0.813622952f, 0.899901152f},
-std::array<float,2>{0.605381429f, 0.331516325f},
-std::array<float,2>{0.228504583f, 0.635104358f},
-std::array<float,2>{0.0706484541f, 0.123079836f},
-std::array<float,2>{0.680704355f, 0.981457949f},
-std::array<float,2>{0.934245706f, 0.277429104f},
-std::array<float,2>{0.438837647f, 0.701367259f},
-std::array<float,2>{0.260676771f, 0.441119045f},
-std::array<float,2>{0.758871198f, 0.553460836f},
-std::array<float,2>{0.528352201f, 0.177397668f},
-std::array<float,2>{0.137535453f, 0.846718788f},
-std::array<float,2>{0.190785542f, 0.37306872f},
-std::array<float,2>{0.575387001f, 0.680670857f},
-std::array<float,2>{0.869427741f, 0.0176650081f},
-std::array<float,2>{0.323617786f, 0.921600759f},
-std::array<float,2>{0.405555308f, 0.222463325f},
-std::array<float,2>{0.949615061f, 0.766140282f},
-std::array<float,2>{0.707665503f, 0.432362646f},
-std::array<float,2>{0.00678719813f, 0.600338757f},
-std::array<float,2>{0.122692257f, 0.224177957f},
-std::array<float,2>{0.626494646f, 0.773238719f},
-std::array<float,2>{0.878448069f, 0.434809953f},
-std::array<float,2>{0.475722343f, 0.59614867f},
-std::array<float,2>{0.297251999f, 0.367916793f},
-std::array<float,2>{0.811638892f, 0.684445381f},
-std::array<float,2>{0.533184111f, 0.0220681056f},
-std::array<float,2>{0.177852973f, 0.915904105f},
-std::array<float,2>{0.243353799f, 0.445280343f},
-std::array<float,2>{0.61603272f, 0.547920704f},
-std::array<float,2>{0.831255019f, 0.174612299f},
-std::array<float,2>{0.370506078f, 0.848543286f},
-std::array<float,2>{0.42502892f, 0.120621286f},
-std::array<float,2>{0.969155908f, 0.979426742f},
-std::array<float,2>{0.731088817f, 0.276822865f},
-std::array<float,2>{0.0498725846f, 0.699202418f},
-std::array<float,2>{0.150401369f, 0.0449847095f},
-std::array<float,2>{0.508542061f, 0.903724909f},
-std::array<float,2>{0.778823793f, 0.33552742f},
-std::array<float,2>{0.279710621f, 0.639422357f},
-std::array<float,2>{0.467923403f, 0.376784712f},
-std::array<float,2>{0.907634974f, 0.564818561f},
-std::array<float,2>{0.669678032f, 0.215413302f},
-std::array<float,2>{0.0859273896f, 0.784423828f},
-std::array<float,2>{0.0262085814f, 0.311085284f},
-std::array<float,2>{0.697722852f, 0.74754858f},
-std::array<float,2>{0.953318715f, 0.0846492723f},
-std::array<float,2>{0.384320647f, 0.953667462f},
-std::array<float,2>{0.334757596f, 0.129103273f},
-std::array<float,2>{0.854159713f, 0.82465744f},
-std::array<float,2>{0.588554323f, 0.489118606f},
-std::array<float,2>{0.204944789f, 0.527213693f},
-std::array<float,2>{0.200543314f, 0.171216071f},
-std::array<float,2>{0.566099346f, 0.859482348f},
-std::array<float,2>{0.862369239f, 0.459679753f},
-std::array<float,2>{0.31768772f, 0.54437089f},
-std::array<float,2>{0.392212182f, 0.256624699f},
-std::array<float,2>{0.942866087f, 0.716857731f},
-std::array<float,2>{0.718511224f, 0.0994633213f},
-std::array<float,2>{0.0114351027f, 0.998886764f},
-std::array<float,2>{0.066215612f, 0.413435191f},
-std::array<float,2>{0.67610395f, 0.609602511f},
-std::array<float,2>{0.923210204f, 0.241950989f},
-std::array<float,2>{0.447426766f, 0.755865574f},
-std::array<float,2>{0.254023045f, 0.0142012537f},
-std::array<float,2>{0.753103435f, 0.932877421f},
-std::array<float,2>{0.521519125f, 0.348392308f},
-std::array<float,2>{0.13202171f, 0.661177516f},
-std::array<float,2>{0.0377669707f, 0.0722480863f},
-std::array<float,2>{0.749153256f, 0.940290272f},
-std::array<float,2>{0.990301669f, 0.283677697f},
-std::array<float,2>{0.41342622f, 0.723299801f},
-std::array<float,2>{0.352650672f, 0.478452951f},
-std::array<float,2>{0.828088284f, 0.507104635f},
-std::array<float,2>{0.59391129f, 0.152897179f},
-std::array<float,2>{0.222104251f, 0.830178499f},
-std::array<float,2>{0.164858535f, 0.322533995f},
-std::array<float,2>{0.56164372f, 0.654527187f},
-std::array<float,2>{0.789625227f, 0.0564359277f},
-std::array<float,2>{0.288805693f, 0.88911736f},
-std::array<float,2>{0.496941149f, 0.188230634f},
-std::array<float,2>{0.905878484f, 0.80516994f},
-std::array<float,2>{0.646696985f, 0.405851513f},
-std::array<float,2>{0.105436087f, 0.581405997f},
-std::array<float,2>{0.00240784092f, 0.143533811f},
-std::array<float,2>{0.705344021f, 0.840313196f},
-std::array<float,2>{0.948262274f, 0.470516592f},
-std::array<float,2>{0.401780784f, 0.512598336f},
-std::array<float,2>{0.325862527f, 0.291610301f},
-std::array<float,2>{0.874896646f, 0.728847921f},
-std::array<float,2>{0.572952509f, 0.0650975555f},
-std::array<float,2>{0.194726646f, 0.945901632f},
-std::array<float,2>{0.136169329f, 0.394371003f},
-std::array<float,2>{0.523572683f, 0.591831446f},
-std::array<float,2>{0.762617946f, 0.198698044f},
-std::array<float,2>{0.265237778f, 0.801564276f},
-std::array<float,2>{0.44407782f, 0.0543299615f},
-std::array<float,2>{0.931567788f, 0.876740992f},
-std::array<float,2>{0.686567068f, 0.31445998f},
-std::array<float,2>{0.0771632046f, 0.645718992f},
-std::array<float,2>{0.233055979f, 0.104903854f},
-std::array<float,2>{0.607590258f, 0.990683854f},
-std::array<float,2>{0.817133605f, 0.265120566f},
-std::array<float,2>{0.347039729f, 0.707884192f},
-std::array<float,2>{0.416083634f, 0.467444718f},
-std::array<float,2>{0.998639584f, 0.533858836f},
-std::array<float,2>{0.740050852f, 0.163702697f},
-std::array<float,2>{0.0430899709f, 0.869233727f},
-std::array<float,2>{0.0953681245f, 0.355554163f},
-std::array<float,2>{0.654764354f, 0.671727538f},
-std::array<float,2>{0.89700067f, 0.00350779272f},
-std::array<float,2>{0.489708483f, 0.925135493f},
-std::array<float,2>{0.296788841f, 0.249016121f},
-std::array<float,2>{0.78840363f, 0.75867933f},
-std::array<float,2>{0.552272379f, 0.414337486f},
-std::array<float,2>{0.159096181f, 0.624738812f},
-std::array<float,2>{0.185256198f, 0.204984605f},
-std::array<float,2>{0.541441858f, 0.790003538f},
-std::array<float,2>{0.799923003f, 0.383969247f},
-std::array<float,2>{0.309048623f, 0.573037863f},
-std::array<float,2>{0.478039801f, 0.342083663f},
-std::array<float,2>{0.887494802f, 0.630755663f},
-std::array<float,2>{0.640545309f, 0.0383651741f},
-std::array<float,2>{0.111658886f, 0.89149195f},
-std::array<float,2>{0.0574123934f, 0.499495f},
-std::array<float,2>{0.72437191f, 0.518250883f},
-std::array<float,2>{0.980572581f, 0.139207199f},
-std::array<float,2>{0.432084501f, 0.819479167f},
-std::array<float,2>{0.363866329f, 0.086833261f},
-std::array<float,2>{0.841948211f, 0.961596549f},
-std::array<float,2>{0.617690802f, 0.297035724f},
-std::array<float,2>{0.235459164f, 0.734452188f},
-std::array<float,2>{0.0863327608f, 0.0237087104f},
-std::array<float,2>{0.662944436f, 0.906879425f},
-std::array<float,2>{0.917113304f, 0.36360535f},
-std::array<float,2>{0.454697907f, 0.673199654f},
-std::array<float,2>{0.266564548f, 0.428139001f},
-std::array<float,2>{0.772632062f, 0.602827787f},
-std::array<float,2>{0.500913918f, 0.232280031f},
-std::array<float,2>{0.141499251f, 0.773572683f},
-std::array<float,2>{0.215934113f, 0.269774407f},
-std::array<float,2>{0.581333756f, 0.688502669f},
-std::array<float,2>{0.847084403f, 0.113343418f},
-std::array<float,2>{0.33821556f, 0.975263476f},
-std::array<float,2>{0.376577497f, 0.184153631f},
-std::array<float,2>{0.964573741f, 0.852517903f},
-std::array<float,2>{0.694128573f, 0.45193097f},
-std::array<float,2>{0.0219660755f, 0.559100807f},
-std::array<float,2>{0.0736788958f, 0.176774785f},
-std::array<float,2>{0.68167156f, 0.847491562f},
-std::array<float,2>{0.936069071f, 0.440531522f},
-std::array<float,2>{0.441111833f, 0.553122401f},
-std::array<float,2>{0.258646458f, 0.278079033f},
-std::array<float,2>{0.761671126f, 0.702009082f},
-std::array<float,2>{0.530017436f, 0.123792656f},
-std::array<float,2>{0.140083581f, 0.982369483f},
-std::array<float,2>{0.188905075f, 0.431782067f},
-std::array<float,2>{0.577349186f, 0.600086451f},
-std::array<float,2>{0.867980123f, 0.221832156f},
-std::array<float,2>{0.320792049f, 0.765779972f},
-std::array<float,2>{0.404044479f, 0.0184718408f},
-std::array<float,2>{0.951269388f, 0.921219766f},
-std::array<float,2>{0.710457802f, 0.373751819f},
-std::array<float,2>{0.00557929697f, 0.68163687f},
-std::array<float,2>{0.163161799f, 0.0803549662f},
-std::array<float,2>{0.547089934f, 0.957966268f},
-std::array<float,2>{0.784448504f, 0.306242526f},
-std::array<float,2>{0.290846616f, 0.744552732f},
-std::array<float,2>{0.484481066f, 0.485483766f},
-std::array<float,2>{0.892177224f, 0.530227542f},
-std::array<float,2>{0.650830865f, 0.127804786f},
-std::array<float,2>{0.101034172f, 0.82067579f},
-std::array<float,2>{0.0406181552f, 0.331707954f},
-std::array<float,2>{0.737553656f, 0.635416925f},
-std::array<float,2>{0.994073808f, 0.042904973f},
-std::array<float,2>{0.417977661f, 0.900333047f},
-std::array<float,2>{0.349939466f, 0.214122787f},
-std::array<float,2>{0.815583408f, 0.785709858f},
-std::array<float,2>{0.603442609f, 0.37916106f},
-std::array<float,2>{0.229253203f, 0.567003131f},
-std::array<float,2>{0.238816693f, 0.237928599f},
-std::array<float,2>{0.624241292f, 0.753067851f},
-std::array<float,2>{0.838602483f, 0.408444703f},
-std::array<float,2>{0.361055523f, 0.615852892f},
-std::array<float,2>{0.434724927f, 0.346800774f},
-std::array<float,2>{0.979192853f, 0.659880519f},
-std::array<float,2>{0.719332874f, 0.00984832924f},
-std::array<float,2>{0.0620550103f, 0.933761001f},
-std::array<float,2>{0.11568322f, 0.456635177f},
-std::array<float,2>{0.633404672f, 0.541235924f},
-std::array<float,2>{0.885963738f, 0.167283267f},
-std::array<float,2>{0.482152373f, 0.865747809f},
-std::array<float,2>{0.307029545f, 0.0970963016f},
-std::array<float,2>{0.80100131f, 0.994885325f},
-std::array<float,2>{0.545516253f, 0.250223368f},
-std::array<float,2>{0.179817602f, 0.71120888f},
-std::array<float,2>{0.0168497562f, 0.0615156181f},
-std::array<float,2>{0.690193832f, 0.886452019f},
-std::array<float,2>{0.968144715f, 0.327163488f},
-std::array<float,2>{0.381863832f, 0.649120033f},
-std::array<float,2>{0.34066692f, 0.401635796f},
-std::array<float,2>{0.848607361f, 0.585721612f},
-std::array<float,2>{0.583428919f, 0.195241541f},
-std::array<float,2>{0.213413984f, 0.810779333f},
-std::array<float,2>{0.146468356f, 0.286625713f},
-std::array<float,2>{0.505213499f, 0.721144021f},
-std::array<float,2>{0.767332375f, 0.0751291439f},
-std::array<float,2>{0.269684762f, 0.943603516f},
-std::array<float,2>{0.459350497f, 0.150783062f},
-std::array<float,2>{0.920452714f, 0.833403468f},
-std::array<float,2>{0.658112764f, 0.483716846f},
-std::array<float,2>{0.0924424753f, 0.500341177f},
-std::array<float,2>{0.0537028685f, 0.20110862f},
-std::array<float,2>{0.729110718f, 0.797262311f},
-std::array<float,2>{0.974111736f, 0.397958219f},
-std::array<float,2>{0.42791f, 0.586894691f},
-std::array<float,2>{0.374022931f, 0.31840542f},
-std::array<float,2>{0.835384667f, 0.641438663f},
-std::array<float,2>{0.613165498f, 0.048418954f},
-std::array<float,2>{0.247900635f, 0.882719457f},
-std::array<float,2>{0.173713967f, 0.473537534f},
-std::array<float,2>{0.53739512f, 0.508271277f},
-std::array<float,2>{0.808401942f, 0.147044361f},
-std::array<float,2>{0.301219851f, 0.835976422f},
-std::array<float,2>{0.468794972f, 0.0674977899f},
-std::array<float,2>{0.88280791f, 0.951523244f},
-std::array<float,2>{0.629925072f, 0.295213342f},
-std::array<float,2>{0.119845137f, 0.731218278f},
-std::array<float,2>{0.208246008f, 0.0058346577f},
-std::array<float,2>{0.591040909f, 0.92609334f},
-std::array<float,2>{0.859155059f, 0.354317188f},
-std::array<float,2>{0.330625117f, 0.667193592f},
-std::array<float,2>{0.390060037f, 0.420385122f},
-std::array<float,2>{0.960314274f, 0.620746553f},
-std::array<float,2>{0.699617922f, 0.243907899f},
-std::array<float,2>{0.0286155641f, 0.765421987f},
-std::array<float,2>{0.0800581947f, 0.259716749f},
-std::array<float,2>{0.665704429f, 0.705160737f},
-std::array<float,2>{0.912229419f, 0.106778547f},
-std::array<float,2>{0.463284552f, 0.986021638f},
-std::array<float,2>{0.275180876f, 0.156857595f},
-std::array<float,2>{0.77728802f, 0.871463716f},
-std::array<float,2>{0.514850676f, 0.462480307f},
-std::array<float,2>{0.154561937f, 0.537916243f},
-std::array<float,2>{0.127599373f, 0.133679464f},
-std::array<float,2>{0.516800821f, 0.813334048f},
-std::array<float,2>{0.755924821f, 0.492222607f},
-std::array<float,2>{0.251498401f, 0.522444427f},
-std::array<float,2>{0.452399582f, 0.302457333f},
-std::array<float,2>{0.928755403f, 0.741732955f},
-std::array<float,2>{0.675133467f, 0.0910352618f},
-std::array<float,2>{0.0690010041f, 0.965018213f},
-std::array<float,2>{0.014860292f, 0.386782259f},
-std::array<float,2>{0.714254498f, 0.576962829f},
-std::array<float,2>{0.93757093f, 0.207584411f},
-std::array<float,2>{0.396630287f, 0.793692946f},
-std::array<float,2>{0.314235806f, 0.0337504819f},
-std::array<float,2>{0.865921199f, 0.89525789f},
-std::array<float,2>{0.567146897f, 0.338079482f},
-std::array<float,2>{0.196700841f, 0.627010822f},
-std::array<float,2>{0.108296089f, 0.11126601f},
-std::array<float,2>{0.643150687f, 0.969908535f},
-std::array<float,2>{0.899496317f, 0.267963171f},
-std::array<float,2>{0.494329065f, 0.691787422f},
-std::array<float,2>{0.282571495f, 0.448280185f},
-std::array<float,2>{0.79640913f, 0.557791173f},
-std::array<float,2>{0.557777822f, 0.181464523f},
-std::array<float,2>{0.169623211f, 0.856555581f},
-std::array<float,2>{0.225560412f, 0.362197071f},
-std::array<float,2>{0.598011672f, 0.676385224f},
-std::array<float,2>{0.821599603f, 0.0282080937f},
-std::array<float,2>{0.357332379f, 0.910178363f},
-std::array<float,2>{0.406877995f, 0.229903817f},
-std::array<float,2>{0.985247195f, 0.780680776f},
-std::array<float,2>{0.743247032f, 0.421955228f},
-std::array<float,2>{0.0350365564f, 0.608325422f},
-std::array<float,2>{0.0821134523f, 0.217317253f},
-std::array<float,2>{0.670464516f, 0.782123625f},
-std::array<float,2>{0.909062743f, 0.378821284f},
-std::array<float,2>{0.466188669f, 0.563035905f},
-std::array<float,2>{0.277560353f, 0.332609832f},
-std::array<float,2>{0.780586183f, 0.637770474f},
-std::array<float,2>{0.511450291f, 0.0433250256f},
-std::array<float,2>{0.149213746f, 0.905846059f},
-std::array<float,2>{0.206946805f, 0.491771907f},
-std::array<float,2>{0.58755213f, 0.524642885f},
-std::array<float,2>{0.852093637f, 0.132331178f},
-std::array<float,2>{0.332887381f, 0.827679753f},
-std::array<float,2>{0.386375904f, 0.0825587809f},
-std::array<float,2>{0.956712902f, 0.955667853f},
-std::array<float,2>{0.696093857f, 0.310059577f},
-std::array<float,2>{0.024309203f, 0.748546362f},
-std::array<float,2>{0.176536635f, 0.0198897459f},
-std::array<float,2>{0.534672678f, 0.916209936f},
-std::array<float,2>{0.808707476f, 0.370186925f},
-std::array<float,2>{0.30001989f, 0.687240183f},
-std::array<float,2>{0.473285466f, 0.436686546f},
-std::array<float,2>{0.876520455f, 0.59511435f},
-std::array<float,2>{0.627557278f, 0.22648567f},
-std::array<float,2>{0.123197213f, 0.7706092f},
-std::array<float,2>{0.0478546843f, 0.274437159f},
-std::array<float,2>{0.732807517f, 0.695650637f},
-std::array<float,2>{0.971290648f, 0.117442086f},
-std::array<float,2>{0.421968281f, 0.978482425f},
-std::array<float,2>{0.368307173f, 0.172531262f},
-std::array<float,2>{0.829088509f, 0.850080431f},
-std::array<float,2>{0.613650501f, 0.442839473f},
-std::array<float,2>{0.244179219f, 0.549076915f},
-std::array<float,2>{0.219580278f, 0.155531764f},
-std::array<float,2>{0.596166909f, 0.828741133f},
-std::array<float,2>{0.82467258f, 0.478534788f},
-std::array<float,2>{0.35490334f, 0.505581796f},
-std::array<float,2>{0.411680043f, 0.281776041f},
-std::array<float,2>{0.988537908f, 0.725843608f},
-std::array<float,2>{0.747832775f, 0.0723088905f},
-std::array<float,2>{0.0361211039f, 0.938692689f},
-std::array<float,2>{0.103298403f, 0.404286414f},
-std::array<float,2>{0.64584744f, 0.578272045f},
-std::array<float,2>{0.902353227f, 0.189966723f},
-std::array<float,2>{0.499040782f, 0.807825685f},
-std::array<float,2>{0.286065608f, 0.0571793765f},
-std::array<float,2>{0.791814327f, 0.886725783f},
-std::array<float,2>{0.559085488f, 0.320683479f},
-std::array<float,2>{0.167807892f, 0.653193235f},
-std::array<float,2>{0.00964339729f, 0.100081727f},
-std::array<float,2>{0.716331601f, 0.997048736f},
-std::array<float,2>{0.944134355f, 0.25467205f},
-std::array<float,2>{0.392874151f, 0.716754317f},
-std::array<float,2>{0.319477558f, 0.457474202f},
-std::array<float,2>{0.860743403f, 0.545219243f},
-std::array<float,2>{0.562629521f, 0.168377966f},
-std::array<float,2>{0.201602757f, 0.861483812f},
-std::array<float,2>{0.129269317f, 0.351504952f},
-std::array<float,2>{0.520678401f, 0.662138402f},
-std::array<float,2>{0.751080871f, 0.012149713f},
-std::array<float,2>{0.25616619f, 0.930661678f},
-std::array<float,2>{0.446309298f, 0.238787487f},
-std::array<float,2>{0.925251186f, 0.754647195f},
-std::array<float,2>{0.679446399f, 0.411821306f},
-std::array<float,2>{0.06365408f, 0.612672687f},
-std::array<float,2>{0.0468551368f, 0.161993489f},
-std::array<float,2>{0.740786672f, 0.867634118f},
-std::array<float,2>{0.996939301f, 0.466231763f},
-std::array<float,2>{0.41448912f, 0.532587051f},
-std::array<float,2>{0.343810707f, 0.263412565f},
-std::array<float,2>{0.819223881f, 0.710408568f},
-std::array<float,2>{0.606956422f, 0.102807507f},
-std::array<float,2>{0.232344717f, 0.989199996f},
-std::array<float,2>{0.157163456f, 0.416701406f},
-std::array<float,2>{0.553387344f, 0.622163951f},
-std::array<float,2>{0.786648631f, 0.247998044f},
-std::array<float,2>{0.293123871f, 0.760208845f},
-std::array<float,2>{0.490361929f, 0.00153300678f},
-std::array<float,2>{0.895217121f, 0.922742665f},
-std::array<float,2>{0.652956724f, 0.358455032f},
-std::array<float,2>{0.0975310132f, 0.668074965f},
-std::array<float,2>{0.192141086f, 0.0637848601f},
-std::array<float,2>{0.572234154f, 0.947775781f},
-std::array<float,2>{0.872531474f, 0.289946079f},
-std::array<float,2>{0.326284647f, 0.727230251f},
-std::array<float,2>{0.399760485f, 0.471886545f},
-std::array<float,2>{0.94608283f, 0.514025629f},
-std::array<float,2>{0.704958081f, 0.141364619f},
-std::array<float,2>{0.000198888607f, 0.842344403f},
-std::array<float,2>{0.0751462802f, 0.312845707f},
-std::array<float,2>{0.683749259f, 0.648210943f},
-std::array<float,2>{0.933441818f, 0.0517427996f},
-std::array<float,2>{0.441444963f, 0.87825799f},
-std::array<float,2>{0.261746705f, 0.197148085f},
-std::array<float,2>{0.76521498f, 0.803737223f},
-std::array<float,2>{0.526919723f, 0.392428577f},
-std::array<float,2>{0.133814782f, 0.5906322f},
-std::array<float,2>{0.143189058f, 0.23338306f},
-std::array<float,2>{0.50351733f, 0.775395751f},
-std::array<float,2>{0.769712508f, 0.426062018f},
-std::array<float,2>{0.268071651f, 0.60504961f},
-std::array<float,2>{0.456491739f, 0.365370721f},
-std::array<float,2>{0.91474247f, 0.674033701f},
-std::array<float,2>{0.660848081f, 0.0267634597f},
-std::array<float,2>{0.0880180523f, 0.908980608f},
-std::array<float,2>{0.0202011336f, 0.44948104f},
-std::array<float,2>{0.691906512f, 0.561136007f},
-std::array<float,2>{0.962534487f, 0.186822727f},
-std::array<float,2>{0.377004951f, 0.853562415f},
-std::array<float,2>{0.336446106f, 0.115467265f},
-std::array<float,2>{0.845546782f, 0.973620117f},
-std::array<float,2>{0.578135431f, 0.271634519f},
-std::array<float,2>{0.218572155f, 0.690584481f},
-std::array<float,2>{0.109765455f, 0.0364970528f},
-std::array<float,2>{0.638218641f, 0.892879248f},
-std::array<float,2>{0.889604807f, 0.340472966f},
-std::array<float,2>{0.47912249f, 0.632121682f},
-std::array<float,2>{0.311668456f, 0.385036588f},
-std::array<float,2>{0.797156394f, 0.571317375f},
-std::array<float,2>{0.540076733f, 0.205689058f},
-std::array<float,2>{0.186300427f, 0.791757345f},
-std::array<float,2>{0.237211451f, 0.300246179f},
-std::array<float,2>{0.620612979f, 0.73743552f},
-std::array<float,2>{0.840757072f, 0.0890638679f},
-std::array<float,2>{0.366983414f, 0.963107407f},
-std::array<float,2>{0.430673301f, 0.13784261f},
-std::array<float,2>{0.982806981f, 0.81648612f},
-std::array<float,2>{0.725466013f, 0.496852696f},
-std::array<float,2>{0.0555546246f, 0.515846074f},
-std::array<float,2>{0.0985983983f, 0.125402421f},
-std::array<float,2>{0.650390029f, 0.8230322f},
-std::array<float,2>{0.892727315f, 0.48660928f},
-std::array<float,2>{0.486659169f, 0.527627707f},
-std::array<float,2>{0.292575359f, 0.307927549f},
-std::array<float,2>{0.782012343f, 0.742347777f},
-std::array<float,2>{0.549789488f, 0.0785013884f},
-std::array<float,2>{0.161174342f, 0.96066004f},
-std::array<float,2>{0.228004575f, 0.382075489f},
-std::array<float,2>{0.604708612f, 0.568940103f},
-std::array<float,2>{0.814162612f, 0.211797744f},
-std::array<float,2>{0.349539667f, 0.787540972f},
-std::array<float,2>{0.42042163f, 0.040236f},
-std::array<float,2>{0.994349897f, 0.902055323f},
-std::array<float,2>{0.735455394f, 0.328980029f},
-std::array<float,2>{0.0428921953f, 0.633172929f},
-std::array<float,2>{0.1371461f, 0.122376606f},
-std::array<float,2>{0.529199541f, 0.984193921f},
-std::array<float,2>{0.759697974f, 0.280796617f},
-std::array<float,2>{0.260205626f, 0.699919581f},
-std::array<float,2>{0.439171672f, 0.437907517f},
-std::array<float,2>{0.933633983f, 0.552057683f},
-std::array<float,2>{0.681509614f, 0.178258851f},
-std::array<float,2>{0.0712558031f, 0.844513714f},
-std::array<float,2>{0.00613918994f, 0.371289223f},
-std::array<float,2>{0.707504988f, 0.681786299f},
-std::array<float,2>{0.949864149f, 0.0162576977f},
-std::array<float,2>{0.405771375f, 0.919249713f},
-std::array<float,2>{0.324146926f, 0.219411671f},
-std::array<float,2>{0.869817615f, 0.768769562f},
-std::array<float,2>{0.575970709f, 0.431381613f},
-std::array<float,2>{0.191296011f, 0.599377215f},
-std::array<float,2>{0.211150378f, 0.193070263f},
-std::array<float,2>{0.584477067f, 0.809453785f},
-std::array<float,2>{0.850141764f, 0.39924705f},
-std::array<float,2>{0.343493223f, 0.582476676f},
-std::array<float,2>{0.379770875f, 0.325971454f},
-std::array<float,2>{0.965376735f, 0.651936293f},
-std::array<float,2>{0.689182162f, 0.0595076568f},
-std::array<float,2>{0.0191860348f, 0.883929968f},
-std::array<float,2>{0.0900216475f, 0.482201874f},
-std::array<float,2>{0.658425748f, 0.502283335f},
-std::array<float,2>{0.919842601f, 0.14968437f},
-std::array<float,2>{0.458700776f, 0.835686982f},
-std::array<float,2>{0.273116916f, 0.0764237642f},
-std::array<float,2>{0.767732143f, 0.942398369f},
-std::array<float,2>{0.506501496f, 0.288293451f},
-std::array<float,2>{0.147822723f, 0.718825579f},
-std::array<float,2>{0.059298981f, 0.00958629046f},
-std::array<float,2>{0.721053004f, 0.937350094f},
-std::array<float,2>{0.978024006f, 0.343856931f},
-std::array<float,2>{0.437318027f, 0.658100724f},
-std::array<float,2>{0.362022936f, 0.406486064f},
-std::array<float,2>{0.837657094f, 0.614701629f},
-std::array<float,2>{0.621799946f, 0.234514907f},
-std::array<float,2>{0.240566894f, 0.750014186f},
-std::array<float,2>{0.182809904f, 0.25288105f},
-std::array<float,2>{0.544900119f, 0.713064909f},
-std::array<float,2>{0.804430783f, 0.0954198241f},
-std::array<float,2>{0.305971235f, 0.993343771f},
-std::array<float,2>{0.483990669f, 0.165293425f},
-std::array<float,2>{0.883706331f, 0.864596605f},
-std::array<float,2>{0.635233462f, 0.453374296f},
-std::array<float,2>{0.11400938f, 0.539586902f},
-std::array<float,2>{0.0304475296f, 0.245921761f},
-std::array<float,2>{0.701779485f, 0.762151599f},
-std::array<float,2>{0.957863629f, 0.41801089f},
-std::array<float,2>{0.388366282f, 0.617522657f},
-std::array<float,2>{0.328648627f, 0.352362245f},
-std::array<float,2>{0.855502188f, 0.664347947f},
-std::array<float,2>{0.592667222f, 0.00609532651f},
-std::array<float,2>{0.209603086f, 0.929290533f},
-std::array<float,2>{0.152741492f, 0.462982595f},
-std::array<float,2>{0.512950003f, 0.535742402f},
-std::array<float,2>{0.775008321f, 0.160125434f},
-std::array<float,2>{0.276557475f, 0.874315798f},
-std::array<float,2>{0.46164608f, 0.109084986f},
-std::array<float,2>{0.911689937f, 0.987087309f},
-std::array<float,2>{0.667506397f, 0.261470586f},
-std::array<float,2>{0.081568785f, 0.703220665f},
-std::array<float,2>{0.248266369f, 0.0507508852f},
-std::array<float,2>{0.610990047f, 0.88059026f},
-std::array<float,2>{0.832263768f, 0.316597849f},
-std::array<float,2>{0.371838719f, 0.644529164f},
-std::array<float,2>{0.427034736f, 0.395342082f},
-std::array<float,2>{0.976130009f, 0.588564694f},
-std::array<float,2>{0.727553785f, 0.202691361f},
-std::array<float,2>{0.051013153f, 0.798864484f},
-std::array<float,2>{0.118921608f, 0.294208378f},
-std::array<float,2>{0.632660508f, 0.733556092f},
-std::array<float,2>{0.880423248f, 0.0690255016f},
-std::array<float,2>{0.472368211f, 0.951161146f},
-std::array<float,2>{0.303842217f, 0.145009682f},
-std::array<float,2>{0.806373179f, 0.838721991f},
-std::array<float,2>{0.536518991f, 0.474801868f},
-std::array<float,2>{0.175573617f, 0.511425555f},
-std::array<float,2>{0.169934854f, 0.182154521f},
-std::array<float,2>{0.555472791f, 0.858177304f},
-std::array<float,2>{0.793882012f, 0.445807278f},
-std::array<float,2>{0.283454418f, 0.554788291f},
-std::array<float,2>{0.493498564f, 0.26740995f},
-std::array<float,2>{0.901827872f, 0.695164621f},
-std::array<float,2>{0.641653836f, 0.11203254f},
-std::array<float,2>{0.106174663f, 0.970768154f},
-std::array<float,2>{0.0320931785f, 0.42437312f},
-std::array<float,2>{0.745919168f, 0.60651499f},
-std::array<float,2>{0.987131298f, 0.227809384f},
-std::array<float,2>{0.409116298f, 0.778425276f},
-std::array<float,2>{0.357531548f, 0.0305421986f},
-std::array<float,2>{0.822727621f, 0.912342966f},
-std::array<float,2>{0.60056597f, 0.361146569f},
-std::array<float,2>{0.22431992f, 0.678703189f},
-std::array<float,2>{0.0673344135f, 0.0933750644f},
-std::array<float,2>{0.673278511f, 0.968134344f},
-std::array<float,2>{0.926808894f, 0.303024024f},
-std::array<float,2>{0.450145096f, 0.739660442f},
-std::array<float,2>{0.252394557f, 0.49493131f},
-std::array<float,2>{0.754887342f, 0.521269917f},
-std::array<float,2>{0.518413901f, 0.135993019f},
-std::array<float,2>{0.126022205f, 0.815533757f},
-std::array<float,2>{0.198734596f, 0.337048173f},
-std::array<float,2>{0.568537712f, 0.625843465f},
-std::array<float,2>{0.864073634f, 0.0324975252f},
-std::array<float,2>{0.316158265f, 0.897488832f},
-std::array<float,2>{0.394638062f, 0.210407123f},
-std::array<float,2>{0.939906061f, 0.795427859f},
-std::array<float,2>{0.711274505f, 0.390408248f},
-std::array<float,2>{0.0134515055f, 0.574825943f},
-std::array<float,2>{0.104171939f, 0.191186443f},
-std::array<float,2>{0.648268819f, 0.806646705f},
-std::array<float,2>{0.904936731f, 0.403210074f},
-std::array<float,2>{0.497079641f, 0.579625189f},
-std::array<float,2>{0.288050056f, 0.321488649f},
-std::array<float,2>{0.790790975f, 0.653641403f},
-std::array<float,2>{0.561453879f, 0.0583458766f},
-std::array<float,2>{0.165387228f, 0.888538718f},
-std::array<float,2>{0.221585467f, 0.479765743f},
-std::array<float,2>{0.595147431f, 0.504182935f},
-std::array<float,2>{0.826854885f, 0.154850319f},
-std::array<float,2>{0.351671278f, 0.82940042f},
-std::array<float,2>{0.412416846f, 0.0732619688f},
-std::array<float,2>{0.991754353f, 0.937544525f},
-std::array<float,2>{0.748776734f, 0.28275618f},
-std::array<float,2>{0.0386013985f, 0.724783182f},
-std::array<float,2>{0.131422833f, 0.0136360023f},
-std::array<float,2>{0.522644818f, 0.931251705f},
-std::array<float,2>{0.752112389f, 0.349708319f},
-std::array<float,2>{0.255406737f, 0.663418889f},
-std::array<float,2>{0.44860822f, 0.410971433f},
-std::array<float,2>{0.922239602f, 0.612293124f},
-std::array<float,2>{0.677352726f, 0.239639446f},
-std::array<float,2>{0.0648371801f, 0.754995763f},
-std::array<float,2>{0.0104458844f, 0.255584478f},
-std::array<float,2>{0.717529535f, 0.715599358f},
-std::array<float,2>{0.94234854f, 0.100911982f},
-std::array<float,2>{0.39095214f, 0.997623444f},
-std::array<float,2>{0.316928297f, 0.16976288f},
-std::array<float,2>{0.861947238f, 0.862427592f},
-std::array<float,2>{0.56495434f, 0.45895955f},
-std::array<float,2>{0.19927685f, 0.546004474f},
-std::array<float,2>{0.20410037f, 0.131287977f},
-std::array<float,2>{0.589717925f, 0.82630527f},
-std::array<float,2>{0.854544103f, 0.490835637f},
-std::array<float,2>{0.335076958f, 0.524390519f},
-std::array<float,2>{0.383466572f, 0.309053123f},
-std::array<float,2>{0.954877198f, 0.749997616f},
-std::array<float,2>{0.698628843f, 0.0831954777f},
-std::array<float,2>{0.0265186485f, 0.956729949f},
-std::array<float,2>{0.0847686827f, 0.376989603f},
-std::array<float,2>{0.668853939f, 0.563839912f},
-std::array<float,2>{0.906917214f, 0.218632817f},
-std::array<float,2>{0.467017084f, 0.782266974f},
-std::array<float,2>{0.280521959f, 0.0442233831f},
-std::array<float,2>{0.777428389f, 0.904851675f},
-std::array<float,2>{0.509224832f, 0.33397758f},
-std::array<float,2>{0.152219653f, 0.637275755f},
-std::array<float,2>{0.0491103791f, 0.119084306f},
-std::array<float,2>{0.732264519f, 0.977201462f},
-std::array<float,2>{0.970522285f, 0.273635536f},
-std::array<float,2>{0.423924595f, 0.696322918f},
-std::array<float,2>{0.369445473f, 0.441589087f},
-std::array<float,2>{0.830966055f, 0.550172865f},
-std::array<float,2>{0.616576314f, 0.172900006f},
-std::array<float,2>{0.242494404f, 0.851122439f},
-std::array<float,2>{0.179379016f, 0.36999324f},
-std::array<float,2>{0.53220731f, 0.686273396f},
-std::array<float,2>{0.811145067f, 0.0208896138f},
-std::array<float,2>{0.298105955f, 0.917090058f},
-std::array<float,2>{0.475508451f, 0.225285709f},
-std::array<float,2>{0.877394855f, 0.769534051f},
-std::array<float,2>{0.625228465f, 0.436444551f},
-std::array<float,2>{0.121294618f, 0.594620466f},
-std::array<float,2>{0.022801945f, 0.186500236f},
-std::array<float,2>{0.695061684f, 0.854943037f},
-std::array<float,2>{0.963214099f, 0.450394154f},
-std::array<float,2>{0.375156879f, 0.562443197f},
-std::array<float,2>{0.339181811f, 0.272865593f},
-std::array<float,2>{0.846551955f, 0.689486384f},
-std::array<float,2>{0.580519497f, 0.116906948f},
-std::array<float,2>{0.215474099f, 0.973675966f},
-std::array<float,2>{0.142218009f, 0.427403629f},
-std::array<float,2>{0.501408398f, 0.603645802f},
-std::array<float,2>{0.771521449f, 0.234171256f},
-std::array<float,2>{0.267262787f, 0.776940346f},
-std::array<float,2>{0.453783244f, 0.0262459051f},
-std::array<float,2>{0.9167642f, 0.909914732f},
-std::array<float,2>{0.663859963f, 0.366915286f},
-std::array<float,2>{0.0872513726f, 0.675516784f},
-std::array<float,2>{0.235206887f, 0.0887464806f},
-std::array<float,2>{0.619130552f, 0.964344919f},
-std::array<float,2>{0.843589187f, 0.2997576f},
-std::array<float,2>{0.364961684f, 0.736445844f},
-std::array<float,2>{0.433543295f, 0.497876853f},
-std::array<float,2>{0.982184052f, 0.517010093f},
-std::array<float,2>{0.723285615f, 0.137428194f},
-std::array<float,2>{0.0578508452f, 0.818080902f},
-std::array<float,2>{0.112773046f, 0.341599971f},
-std::array<float,2>{0.639507115f, 0.631186545f},
-std::array<float,2>{0.887969434f, 0.0358651318f},
-std::array<float,2>{0.476767629f, 0.893630207f},
-std::array<float,2>{0.309586763f, 0.20680657f},
-std::array<float,2>{0.799429059f, 0.792931974f},
-std::array<float,2>{0.542103648f, 0.38577649f},
-std::array<float,2>{0.184468284f, 0.571155787f},
-std::array<float,2>{0.159385115f, 0.246688843f},
-std::array<float,2>{0.551257789f, 0.761188626f},
-std::array<float,2>{0.787399352f, 0.41794154f},
-std::array<float,2>{0.295077294f, 0.621657312f},
-std::array<float,2>{0.488415211f, 0.357757688f},
-std::array<float,2>{0.898290038f, 0.669187725f},
-std::array<float,2>{0.655811071f, 0.000482072122f},
-std::array<float,2>{0.094059214f, 0.923825026f},
-std::array<float,2>{0.0444504172f, 0.465738773f},
-std::array<float,2>{0.738531113f, 0.531925976f},
-std::array<float,2>{0.999028325f, 0.160225093f},
-std::array<float,2>{0.41774869f, 0.868878126f},
-std::array<float,2>{0.346528172f, 0.101781353f},
-std::array<float,2>{0.818183959f, 0.989269018f},
-std::array<float,2>{0.609251797f, 0.262167305f},
-std::array<float,2>{0.233419091f, 0.709221959f},
-std::array<float,2>{0.076363869f, 0.0517789386f},
-std::array<float,2>{0.685933292f, 0.877741277f},
-std::array<float,2>{0.930184543f, 0.313939333f},
-std::array<float,2>{0.445037395f, 0.6464926f},
-std::array<float,2>{0.264366299f, 0.390993506f},
-std::array<float,2>{0.763008893f, 0.591748476f},
-std::array<float,2>{0.525047243f, 0.196040928f},
-std::array<float,2>{0.135422289f, 0.802870572f},
-std::array<float,2>{0.19376865f, 0.290883124f},
-std::array<float,2>{0.57380867f, 0.728328407f},
-std::array<float,2>{0.873304367f, 0.0630236194f},
-std::array<float,2>{0.324780732f, 0.948320687f},
-std::array<float,2>{0.400776774f, 0.141654015f},
-std::array<float,2>{0.94822526f, 0.843393922f},
-std::array<float,2>{0.706998646f, 0.471006811f},
-std::array<float,2>{0.00376944849f, 0.51464963f},
-std::array<float,2>{0.0928794295f, 0.148534194f},
-std::array<float,2>{0.657036304f, 0.834226131f},
-std::array<float,2>{0.920933068f, 0.48123607f},
-std::array<float,2>{0.460156292f, 0.503137589f},
-std::array<float,2>{0.270887434f, 0.287284434f},
-std::array<float,2>{0.766273141f, 0.720138192f},
-std::array<float,2>{0.504628718f, 0.0771671832f},
-std::array<float,2>{0.145158842f, 0.941726983f},
-std::array<float,2>{0.214833662f, 0.399938285f},
-std::array<float,2>{0.582330108f, 0.58387965f},
-std::array<float,2>{0.849381208f, 0.192046747f},
-std::array<float,2>{0.341445684f, 0.809892058f},
-std::array<float,2>{0.38158679f, 0.0601630025f},
-std::array<float,2>{0.967141449f, 0.882854342f},
-std::array<float,2>{0.690720797f, 0.325190753f},
-std::array<float,2>{0.0160104875f, 0.651022494f},
-std::array<float,2>{0.181374341f, 0.0943394452f},
-std::array<float,2>{0.546438515f, 0.992200315f},
-std::array<float,2>{0.802445948f, 0.253199786f},
-std::array<float,2>{0.308024824f, 0.714068592f},
-std::array<float,2>{0.480815887f, 0.454611719f},
-std::array<float,2>{0.885276318f, 0.540368676f},
-std::array<float,2>{0.634099483f, 0.164465487f},
-std::array<float,2>{0.117063567f, 0.863811791f},
-std::array<float,2>{0.0610813238f, 0.344982862f},
-std::array<float,2>{0.720281422f, 0.657041132f},
-std::array<float,2>{0.979899526f, 0.0079127783f},
-std::array<float,2>{0.434193581f, 0.935821652f},
-std::array<float,2>{0.359822243f, 0.235924512f},
-std::array<float,2>{0.838994026f, 0.751416802f},
-std::array<float,2>{0.623102427f, 0.407491773f},
-std::array<float,2>{0.239409164f, 0.613349676f},
-std::array<float,2>{0.229897529f, 0.212287009f},
-std::array<float,2>{0.602119207f, 0.789046288f},
-std::array<float,2>{0.815280378f, 0.381759673f},
-std::array<float,2>{0.351040155f, 0.569493294f},
-std::array<float,2>{0.419290125f, 0.32959649f},
-std::array<float,2>{0.992941856f, 0.634384334f},
-std::array<float,2>{0.736483097f, 0.0393538848f},
-std::array<float,2>{0.0390813835f, 0.900949776f},
-std::array<float,2>{0.100426629f, 0.487510651f},
-std::array<float,2>{0.651959658f, 0.528900564f},
-std::array<float,2>{0.890715241f, 0.12640354f},
-std::array<float,2>{0.486028373f, 0.824167609f},
-std::array<float,2>{0.289760232f, 0.0796542168f},
-std::array<float,2>{0.783933759f, 0.959459424f},
-std::array<float,2>{0.547890425f, 0.307033569f},
-std::array<float,2>{0.162189007f, 0.743882358f},
-std::array<float,2>{0.00420156866f, 0.0175758731f},
-std::array<float,2>{0.709555805f, 0.918311536f},
-std::array<float,2>{0.952688992f, 0.373011619f},
-std::array<float,2>{0.40273571f, 0.68323046f},
-std::array<float,2>{0.321549594f, 0.43036887f},
-std::array<float,2>{0.868811488f, 0.5978809f},
-std::array<float,2>{0.576337218f, 0.220661983f},
-std::array<float,2>{0.187665552f, 0.767783999f},
-std::array<float,2>{0.139026091f, 0.28011924f},
-std::array<float,2>{0.530995727f, 0.700761974f},
-std::array<float,2>{0.759775817f, 0.121568784f},
-std::array<float,2>{0.258997411f, 0.982515156f},
-std::array<float,2>{0.44025594f, 0.179578617f},
-std::array<float,2>{0.936891258f, 0.845187724f},
-std::array<float,2>{0.683361173f, 0.439240873f},
-std::array<float,2>{0.0731898025f, 0.551742911f},
-std::array<float,2>{0.0336412862f, 0.227363542f},
-std::array<float,2>{0.742630541f, 0.778147817f},
-std::array<float,2>{0.9857288f, 0.425726056f},
-std::array<float,2>{0.407533795f, 0.605863988f},
-std::array<float,2>{0.356092989f, 0.359772235f},
-std::array<float,2>{0.820715666f, 0.679385424f},
-std::array<float,2>{0.598734498f, 0.0301012434f},
-std::array<float,2>{0.225695446f, 0.913181841f},
-std::array<float,2>{0.168261662f, 0.446583986f},
-std::array<float,2>{0.557056606f, 0.556116402f},
-std::array<float,2>{0.795441329f, 0.183431253f},
-std::array<float,2>{0.281283855f, 0.859330773f},
-std::array<float,2>{0.495133728f, 0.112975009f},
-std::array<float,2>{0.8989622f, 0.97210896f},
-std::array<float,2>{0.643775225f, 0.265629947f},
-std::array<float,2>{0.108598381f, 0.693750799f},
-std::array<float,2>{0.19532676f, 0.0315221176f},
-std::array<float,2>{0.567472756f, 0.896661878f},
-std::array<float,2>{0.866264701f, 0.336341083f},
-std::array<float,2>{0.313350081f, 0.626717269f},
-std::array<float,2>{0.397761315f, 0.389229983f},
-std::array<float,2>{0.939288914f, 0.575661123f},
-std::array<float,2>{0.71342361f, 0.209798202f},
-std::array<float,2>{0.0141337095f, 0.795912743f},
-std::array<float,2>{0.0693863183f, 0.304195791f},
-std::array<float,2>{0.674597919f, 0.738921165f},
-std::array<float,2>{0.92854166f, 0.0926165879f},
-std::array<float,2>{0.451941401f, 0.966982007f},
-std::array<float,2>{0.250181347f, 0.134789795f},
-std::array<float,2>{0.757741213f, 0.815175951f},
-std::array<float,2>{0.516037881f, 0.495764464f},
-std::array<float,2>{0.128191873f, 0.519836485f},
-std::array<float,2>{0.155885845f, 0.158223644f},
-std::array<float,2>{0.513708353f, 0.873458207f},
-std::array<float,2>{0.775923193f, 0.463927627f},
-std::array<float,2>{0.27366057f, 0.537001312f},
-std::array<float,2>{0.464406103f, 0.259887397f},
-std::array<float,2>{0.913411736f, 0.705046356f},
-std::array<float,2>{0.664429426f, 0.107960038f},
-std::array<float,2>{0.0787141323f, 0.988271117f},
-std::array<float,2>{0.0273560658f, 0.419848263f},
-std::array<float,2>{0.700909078f, 0.618412971f},
-std::array<float,2>{0.959885359f, 0.244279265f},
-std::array<float,2>{0.388817668f, 0.762740552f},
-std::array<float,2>{0.331670821f, 0.00729241129f},
-std::array<float,2>{0.858050883f, 0.92811209f},
-std::array<float,2>{0.590196788f, 0.353363663f},
-std::array<float,2>{0.207433969f, 0.665733516f},
-std::array<float,2>{0.120311901f, 0.0697955638f},
-std::array<float,2>{0.629764199f, 0.949557722f},
-std::array<float,2>{0.881568372f, 0.293911427f},
-std::array<float,2>{0.470053554f, 0.732468307f},
-std::array<float,2>{0.302274793f, 0.476146877f},
-std::array<float,2>{0.806936324f, 0.509898365f},
-std::array<float,2>{0.538777828f, 0.145630062f},
-std::array<float,2>{0.171973363f, 0.839788079f},
-std::array<float,2>{0.246353105f, 0.318168193f},
-std::array<float,2>{0.61195147f, 0.643039584f},
-std::array<float,2>{0.834690273f, 0.0495973788f},
-std::array<float,2>{0.374466389f, 0.879745781f},
-std::array<float,2>{0.429098785f, 0.20205532f},
-std::array<float,2>{0.973150611f, 0.800756812f},
-std::array<float,2>{0.729858994f, 0.396359384f},
-std::array<float,2>{0.0541124344f, 0.589471936f},
-std::array<float,2>{0.0630159304f, 0.241083309f},
-std::array<float,2>{0.678125024f, 0.757533669f},
-std::array<float,2>{0.924202919f, 0.412375867f},
-std::array<float,2>{0.445322901f, 0.611055195f},
-std::array<float,2>{0.257701367f, 0.348796785f},
-std::array<float,2>{0.750840664f, 0.660677195f},
-std::array<float,2>{0.520477533f, 0.0147999441f},
-std::array<float,2>{0.130318403f, 0.932221889f},
-std::array<float,2>{0.202475026f, 0.460052907f},
-std::array<float,2>{0.564133167f, 0.54311043f},
-std::array<float,2>{0.859859169f, 0.170497343f},
-std::array<float,2>{0.319096953f, 0.860518396f},
-std::array<float,2>{0.394506782f, 0.0983277932f},
-std::array<float,2>{0.944728971f, 0.999887049f},
-std::array<float,2>{0.715022027f, 0.257434517f},
-std::array<float,2>{0.00822666474f, 0.717910886f},
-std::array<float,2>{0.166501805f, 0.0554256365f},
-std::array<float,2>{0.560342729f, 0.88996613f},
-std::array<float,2>{0.792569399f, 0.32359153f},
-std::array<float,2>{0.286851108f, 0.655331433f},
-std::array<float,2>{0.49884358f, 0.404999822f},
-std::array<float,2>{0.903377354f, 0.580728054f},
-std::array<float,2>{0.645475686f, 0.189163551f},
-std::array<float,2>{0.101922579f, 0.805829763f},
-std::array<float,2>{0.0367317237f, 0.284530252f},
-std::array<float,2>{0.746340036f, 0.723665297f},
-std::array<float,2>{0.98987484f, 0.0705250204f},
-std::array<float,2>{0.410493881f, 0.941117823f},
-std::array<float,2>{0.353803873f, 0.153432921f},
-std::array<float,2>{0.825471938f, 0.831518412f},
-std::array<float,2>{0.59715569f, 0.476747155f},
-std::array<float,2>{0.220631614f, 0.506326139f},
-std::array<float,2>{0.245904893f, 0.175756156f},
-std::array<float,2>{0.61449337f, 0.84954524f},
-std::array<float,2>{0.82978183f, 0.44397071f},
-std::array<float,2>{0.367712557f, 0.547089815f},
-std::array<float,2>{0.423267782f, 0.275434107f},
-std::array<float,2>{0.971698046f, 0.698089182f},
-std::array<float,2>{0.733759224f, 0.119152755f},
-std::array<float,2>{0.0473811068f, 0.979562104f},
-std::array<float,2>{0.124822423f, 0.434556305f},
-std::array<float,2>{0.627980888f, 0.597299814f},
-std::array<float,2>{0.875906587f, 0.222904652f},
-std::array<float,2>{0.474534392f, 0.771911383f},
-std::array<float,2>{0.299531311f, 0.023427831f},
-std::array<float,2>{0.810352623f, 0.914298356f},
-std::array<float,2>{0.534004807f, 0.369047016f},
-std::array<float,2>{0.177196458f, 0.684583485f},
-std::array<float,2>{0.0247996077f, 0.0852612033f},
-std::array<float,2>{0.696483135f, 0.954611421f},
-std::array<float,2>{0.956039846f, 0.311869174f},
-std::array<float,2>{0.38514924f, 0.746963203f},
-std::array<float,2>{0.333090425f, 0.489743263f},
-std::array<float,2>{0.852844298f, 0.525779247f},
-std::array<float,2>{0.586468279f, 0.130810246f},
-std::array<float,2>{0.205660388f, 0.826114833f},
-std::array<float,2>{0.149554402f, 0.334717691f},
-std::array<float,2>{0.509825587f, 0.640287459f},
-std::array<float,2>{0.779631615f, 0.0464021787f},
-std::array<float,2>{0.27861169f, 0.902587771f},
-std::array<float,2>{0.465515882f, 0.216343686f},
-std::array<float,2>{0.909354568f, 0.784050167f},
-std::array<float,2>{0.67126137f, 0.375411332f},
-std::array<float,2>{0.0836716071f, 0.566089869f},
-std::array<float,2>{0.0556840077f, 0.139654666f},
-std::array<float,2>{0.72650075f, 0.818472505f},
-std::array<float,2>{0.984126627f, 0.498414636f},
-std::array<float,2>{0.430537313f, 0.519319534f},
-std::array<float,2>{0.365891516f, 0.298492074f},
-std::array<float,2>{0.841683328f, 0.735787332f},
-std::array<float,2>{0.619202971f, 0.0875374377f},
-std::array<float,2>{0.238177985f, 0.962103009f},
-std::array<float,2>{0.18694289f, 0.383141547f},
-std::array<float,2>{0.539861917f, 0.5740152f},
-std::array<float,2>{0.798473775f, 0.203911975f},
-std::array<float,2>{0.310841262f, 0.790325344f},
-std::array<float,2>{0.479756981f, 0.0374917872f},
-std::array<float,2>{0.890189826f, 0.892545342f},
-std::array<float,2>{0.636989713f, 0.343165785f},
-std::array<float,2>{0.110871859f, 0.62978977f},
-std::array<float,2>{0.217511371f, 0.114543386f},
-std::array<float,2>{0.579605043f, 0.976206064f},
-std::array<float,2>{0.844536066f, 0.270800084f},
-std::array<float,2>{0.336971939f, 0.68836838f},
-std::array<float,2>{0.378041089f, 0.452402741f},
-std::array<float,2>{0.961692095f, 0.560371637f},
-std::array<float,2>{0.692830145f, 0.184723169f},
-std::array<float,2>{0.0208715927f, 0.852704823f},
-std::array<float,2>{0.0891200528f, 0.364344478f},
-std::array<float,2>{0.661658704f, 0.672357619f},
-std::array<float,2>{0.915155053f, 0.0244927891f},
-std::array<float,2>{0.455137432f, 0.907869339f},
-std::array<float,2>{0.269327223f, 0.230600119f},
-std::array<float,2>{0.771207988f, 0.774842083f},
-std::array<float,2>{0.502588212f, 0.429364532f},
-std::array<float,2>{0.143828183f, 0.602190554f},
-std::array<float,2>{0.133049905f, 0.197726265f},
-std::array<float,2>{0.525895417f, 0.80252105f},
-std::array<float,2>{0.764629602f, 0.393248349f},
-std::array<float,2>{0.263225645f, 0.593259394f},
-std::array<float,2>{0.442828029f, 0.315654784f},
-std::array<float,2>{0.931963623f, 0.644978642f},
-std::array<float,2>{0.685117483f, 0.0530728698f},
-std::array<float,2>{0.0758489892f, 0.875422776f},
-std::array<float,2>{0.00140202546f, 0.469612479f},
-std::array<float,2>{0.703356445f, 0.51338315f},
-std::array<float,2>{0.946776927f, 0.14432992f},
-std::array<float,2>{0.398759037f, 0.841621757f},
-std::array<float,2>{0.327958077f, 0.0662597269f},
-std::array<float,2>{0.87145263f, 0.947134197f},
-std::array<float,2>{0.571152866f, 0.292546004f},
-std::array<float,2>{0.193304881f, 0.729855895f},
-std::array<float,2>{0.0965706334f, 0.00252040662f},
-std::array<float,2>{0.654009521f, 0.924699724f},
-std::array<float,2>{0.895744443f, 0.356462777f},
-std::array<float,2>{0.49192518f, 0.670594752f},
-std::array<float,2>{0.294308096f, 0.415778995f},
-std::array<float,2>{0.785464883f, 0.62316674f},
-std::array<float,2>{0.554138422f, 0.249059975f},
-std::array<float,2>{0.157413185f, 0.759000897f},
-std::array<float,2>{0.231221855f, 0.264517218f},
-std::array<float,2>{0.606271446f, 0.708764255f},
-std::array<float,2>{0.819515049f, 0.103783853f},
-std::array<float,2>{0.344939083f, 0.991371095f},
-std::array<float,2>{0.415179878f, 0.162117407f},
-std::array<float,2>{0.997967958f, 0.870508313f},
-std::array<float,2>{0.741235435f, 0.467980832f},
-std::array<float,2>{0.0455335192f, 0.535056174f},
-std::array<float,2>{0.114895321f, 0.166798815f},
-std::array<float,2>{0.635812342f, 0.866595805f},
-std::array<float,2>{0.884458125f, 0.455155373f},
-std::array<float,2>{0.482994378f, 0.542559147f},
-std::array<float,2>{0.304870874f, 0.251944155f},
-std::array<float,2>{0.803607464f, 0.712021291f},
-std::array<float,2>{0.543154061f, 0.0961087272f},
-std::array<float,2>{0.182109907f, 0.995670259f},
-std::array<float,2>{0.242021352f, 0.409669399f},
-std::array<float,2>{0.622676313f, 0.616530776f},
-std::array<float,2>{0.83636117f, 0.23699528f},
-std::array<float,2>{0.36282441f, 0.752349079f},
-std::array<float,2>{0.435905576f, 0.0108472863f},
-std::array<float,2>{0.976722598f, 0.934980035f},
-std::array<float,2>{0.722298086f, 0.345950127f},
-std::array<float,2>{0.0595749356f, 0.6586743f},
-std::array<float,2>{0.146906748f, 0.0760960132f},
-std::array<float,2>{0.507326543f, 0.944538713f},
-std::array<float,2>{0.769049644f, 0.28520605f},
-std::array<float,2>{0.272259295f, 0.721938968f},
-std::array<float,2>{0.457578421f, 0.483258843f},
-std::array<float,2>{0.9187029f, 0.501446962f},
-std::array<float,2>{0.659294486f, 0.151446074f},
-std::array<float,2>{0.091367349f, 0.832221031f},
-std::array<float,2>{0.0181900021f, 0.326598465f},
-std::array<float,2>{0.688122928f, 0.649450004f},
-std::array<float,2>{0.966179311f, 0.0622756258f},
-std::array<float,2>{0.38027513f, 0.885333359f},
-std::array<float,2>{0.342552125f, 0.193598464f},
-std::array<float,2>{0.851202607f, 0.81157577f},
-std::array<float,2>{0.585878313f, 0.400787562f},
-std::array<float,2>{0.212351367f, 0.584664643f},
-std::array<float,2>{0.190027878f, 0.221359938f},
-std::array<float,2>{0.574431956f, 0.766850114f},
-std::array<float,2>{0.870616376f, 0.433532387f},
-std::array<float,2>{0.322561175f, 0.601341665f},
-std::array<float,2>{0.404488444f, 0.374447912f},
-std::array<float,2>{0.95082438f, 0.680465341f},
-std::array<float,2>{0.708258271f, 0.0188057292f},
-std::array<float,2>{0.0068496475f, 0.920593679f},
-std::array<float,2>{0.0715219453f, 0.440079421f},
-std::array<float,2>{0.680205047f, 0.554679334f},
-std::array<float,2>{0.934765637f, 0.176026061f},
-std::array<float,2>{0.437831163f, 0.845967472f},
-std::array<float,2>{0.261100531f, 0.124462195f},
-std::array<float,2>{0.75872618f, 0.980897963f},
-std::array<float,2>{0.528309762f, 0.278432578f},
-std::array<float,2>{0.138009757f, 0.702233195f},
-std::array<float,2>{0.0410765633f, 0.0416255295f},
-std::array<float,2>{0.73522222f, 0.89846462f},
-std::array<float,2>{0.996049285f, 0.330390155f},
-std::array<float,2>{0.421784639f, 0.636513293f},
-std::array<float,2>{0.34769085f, 0.380837798f},
-std::array<float,2>{0.813279033f, 0.568068266f},
-std::array<float,2>{0.604298532f, 0.213356853f},
-std::array<float,2>{0.227459893f, 0.786199152f},
-std::array<float,2>{0.160301164f, 0.305567384f},
-std::array<float,2>{0.55003804f, 0.745143592f},
-std::array<float,2>{0.78300184f, 0.0812209398f},
-std::array<float,2>{0.291782141f, 0.958052933f},
-std::array<float,2>{0.487704068f, 0.128888488f},
-std::array<float,2>{0.893765748f, 0.822152495f},
-std::array<float,2>{0.649060249f, 0.484601825f},
-std::array<float,2>{0.0987234935f, 0.530672789f},
-std::array<float,2>{0.0124259861f, 0.208786383f},
-std::array<float,2>{0.712601483f, 0.794008911f},
-std::array<float,2>{0.941203952f, 0.387834728f},
-std::array<float,2>{0.395951271f, 0.578011036f},
-std::array<float,2>{0.31493637f, 0.339469552f},
-std::array<float,2>{0.864653468f, 0.628623068f},
-std::array<float,2>{0.569448531f, 0.0345823132f},
-std::array<float,2>{0.1980986f, 0.896340549f},
-std::array<float,2>{0.125786692f, 0.493394941f},
-std::array<float,2>{0.51946646f, 0.523308754f},
-std::array<float,2>{0.753963113f, 0.134492531f},
-std::array<float,2>{0.253690988f, 0.814004838f},
-std::array<float,2>{0.450520396f, 0.0907943845f},
-std::array<float,2>{0.926030278f, 0.966683686f},
-std::array<float,2>{0.671925902f, 0.301442891f},
-std::array<float,2>{0.0678435639f, 0.740781069f},
-std::array<float,2>{0.223138347f, 0.0287204683f},
-std::array<float,2>{0.601361036f, 0.911775172f},
-std::array<float,2>{0.823962867f, 0.362957895f},
-std::array<float,2>{0.358766615f, 0.677700877f},
-std::array<float,2>{0.409657508f, 0.423222333f},
-std::array<float,2>{0.98783958f, 0.60848856f},
-std::array<float,2>{0.744360626f, 0.228957295f},
-std::array<float,2>{0.0328695402f, 0.780077875f},
-std::array<float,2>{0.106612973f, 0.269236803f},
-std::array<float,2>{0.640921712f, 0.692749679f},
-std::array<float,2>{0.900528193f, 0.110188276f},
-std::array<float,2>{0.492522687f, 0.969119728f},
-std::array<float,2>{0.285138339f, 0.180578887f},
-std::array<float,2>{0.794322371f, 0.855507851f},
-std::array<float,2>{0.5566203f, 0.448213488f},
-std::array<float,2>{0.171743095f, 0.557443321f},
-std::array<float,2>{0.17407456f, 0.148066476f},
-std::array<float,2>{0.536028862f, 0.83743906f},
-std::array<float,2>{0.8056615f, 0.473918438f},
-std::array<float,2>{0.303196132f, 0.509481549f},
-std::array<float,2>{0.470717102f, 0.296024024f},
-std::array<float,2>{0.879562259f, 0.731938839f},
-std::array<float,2>{0.630915999f, 0.0668013841f},
-std::array<float,2>{0.117283225f, 0.95241046f},
-std::array<float,2>{0.0519492552f, 0.397249669f},
-std::array<float,2>{0.727064788f, 0.587580144f},
-std::array<float,2>{0.975307643f, 0.200138584f},
-std::array<float,2>{0.426100403f, 0.798787773f},
-std::array<float,2>{0.372819513f, 0.0476350598f},
-std::array<float,2>{0.833820879f, 0.881026864f},
-std::array<float,2>{0.610260785f, 0.320306093f},
-std::array<float,2>{0.249728665f, 0.641904712f},
-std::array<float,2>{0.0808626264f, 0.105856992f},
-std::array<float,2>{0.666698813f, 0.985038519f},
-std::array<float,2>{0.91097784f, 0.258527935f},
-std::array<float,2>{0.462639898f, 0.70637399f},
-std::array<float,2>{0.275676876f, 0.461187035f},
-std::array<float,2>{0.774150908f, 0.538977206f},
-std::array<float,2>{0.512380242f, 0.158097818f},
-std::array<float,2>{0.154221699f, 0.872226894f},
-std::array<float,2>{0.210185304f, 0.355032802f},
-std::array<float,2>{0.592928708f, 0.666749358f},
-std::array<float,2>{0.856541276f, 0.00412881561f},
-std::array<float,2>{0.329482168f, 0.927519083f},
-std::array<float,2>{0.387335002f, 0.242594793f},
-std::array<float,2>{0.958046436f, 0.763855278f},
-std::array<float,2>{0.702634394f, 0.421764642f},
-std::array<float,2>{0.0293767899f, 0.619361997f},
-std::array<float,2>{0.108678624f, 0.230467469f},
-std::array<float,2>{0.643971264f, 0.78087163f},
-std::array<float,2>{0.899248183f, 0.422804117f},
-std::array<float,2>{0.495518297f, 0.60790211f},
-std::array<float,2>{0.281563699f, 0.361695558f},
-std::array<float,2>{0.795769393f, 0.675952017f},
-std::array<float,2>{0.556728184f, 0.0274921246f},
-std::array<float,2>{0.168046147f, 0.910659909f},
-std::array<float,2>{0.225897327f, 0.449011713f},
-std::array<float,2>{0.599072337f, 0.558231533f},
-std::array<float,2>{0.820529461f, 0.180756509f},
-std::array<float,2>{0.356434643f, 0.857026994f},
-std::array<float,2>{0.407391518f, 0.110797368f},
-std::array<float,2>{0.985545397f, 0.970531225f},
-std::array<float,2>{0.742326081f, 0.26818189f},
-std::array<float,2>{0.0332614966f, 0.692153692f},
-std::array<float,2>{0.128155515f, 0.033218693f},
-std::array<float,2>{0.515737712f, 0.894967318f},
-std::array<float,2>{0.757494509f, 0.338858008f},
-std::array<float,2>{0.250267357f, 0.627744675f},
-std::array<float,2>{0.451775879f, 0.387348831f},
-std::array<float,2>{0.928359509f, 0.576553702f},
-std::array<float,2>{0.674418032f, 0.207406864f},
-std::array<float,2>{0.0696164593f, 0.79320991f},
-std::array<float,2>{0.0138836624f, 0.302046537f},
-std::array<float,2>{0.713713586f, 0.741644263f},
-std::array<float,2>{0.93916297f, 0.0914213657f},
-std::array<float,2>{0.397678047f, 0.965353966f},
-std::array<float,2>{0.313124537f, 0.133052751f},
-std::array<float,2>{0.866681397f, 0.812829792f},
-std::array<float,2>{0.567662776f, 0.49306339f},
-std::array<float,2>{0.195568144f, 0.521752f},
-std::array<float,2>{0.207204893f, 0.156469837f},
-std::array<float,2>{0.589872539f, 0.872048974f},
-std::array<float,2>{0.858255029f, 0.46207279f},
-std::array<float,2>{0.331896037f, 0.537543952f},
-std::array<float,2>{0.389113903f, 0.259013593f},
-std::array<float,2>{0.959509075f, 0.705712855f},
-std::array<float,2>{0.701149285f, 0.107072338f},
-std::array<float,2>{0.0277530141f, 0.985729277f},
-std::array<float,2>{0.0788924247f, 0.420473605f},
-std::array<float,2>{0.664207399f, 0.620575666f},
-std::array<float,2>{0.913264632f, 0.243334532f},
-std::array<float,2>{0.46483472f, 0.765047967f},
-std::array<float,2>{0.273836464f, 0.00496069528f},
-std::array<float,2>{0.776174605f, 0.926466465f},
-std::array<float,2>{0.513955593f, 0.353974074f},
-std::array<float,2>{0.156224072f, 0.667710483f},
-std::array<float,2>{0.0537203737f, 0.0681935847f},
-std::array<float,2>{0.729622245f, 0.951860368f},
-std::array<float,2>{0.973539889f, 0.295517743f},
-std::array<float,2>{0.428794891f, 0.730862617f},
-std::array<float,2>{0.374054551f, 0.473116815f},
-std::array<float,2>{0.834901214f, 0.508694768f},
-std::array<float,2>{0.612245917f, 0.146604463f},
-std::array<float,2>{0.246272802f, 0.836801946f},
-std::array<float,2>{0.172246575f, 0.319141388f},
-std::array<float,2>{0.538916171f, 0.641069233f},
-std::array<float,2>{0.806706071f, 0.04787644f},
-std::array<float,2>{0.302619636f, 0.882297873f},
-std::array<float,2>{0.469766349f, 0.200290531f},
-std::array<float,2>{0.881770194f, 0.797370911f},
-std::array<float,2>{0.6295439f, 0.397555053f},
-std::array<float,2>{0.120559074f, 0.586224139f},
-std::array<float,2>{0.015809482f, 0.151225671f},
-std::array<float,2>{0.690493882f, 0.833805382f},
-std::array<float,2>{0.966816008f, 0.483899325f},
-std::array<float,2>{0.38165313f, 0.500859857f},
-std::array<float,2>{0.341561943f, 0.286204845f},
-std::array<float,2>{0.849351406f, 0.72160697f},
-std::array<float,2>{0.582049608f, 0.0744300857f},
-std::array<float,2>{0.2144842f, 0.944052041f},
-std::array<float,2>{0.145466313f, 0.402129054f},
-std::array<float,2>{0.504846931f, 0.585189164f},
-std::array<float,2>{0.766563237f, 0.194452807f},
-std::array<float,2>{0.270661354f, 0.811414659f},
-std::array<float,2>{0.460356683f, 0.0609854907f},
-std::array<float,2>{0.921373367f, 0.88582921f},
-std::array<float,2>{0.656900823f, 0.327648997f},
-std::array<float,2>{0.0931271315f, 0.64862448f},
-std::array<float,2>{0.239690185f, 0.0973335281f},
-std::array<float,2>{0.623340011f, 0.994547725f},
-std::array<float,2>{0.839173794f, 0.250944346f},
-std::array<float,2>{0.359505355f, 0.711868227f},
-std::array<float,2>{0.43440032f, 0.456330031f},
-std::array<float,2>{0.979669631f, 0.541566253f},
-std::array<float,2>{0.72057271f, 0.167908445f},
-std::array<float,2>{0.0615193807f, 0.865405202f},
-std::array<float,2>{0.116882496f, 0.347347945f},
-std::array<float,2>{0.633836687f, 0.659480274f},
-std::array<float,2>{0.885622859f, 0.010276f},
-std::array<float,2>{0.480697334f, 0.934206843f},
-std::array<float,2>{0.3077223f, 0.237698346f},
-std::array<float,2>{0.802552462f, 0.753465414f},
-std::array<float,2>{0.546838939f, 0.40908277f},
-std::array<float,2>{0.181537718f, 0.615551472f},
-std::array<float,2>{0.162442148f, 0.214571387f},
-std::array<float,2>{0.548334539f, 0.785270989f},
-std::array<float,2>{0.784114897f, 0.3796826f},
-std::array<float,2>{0.289926767f, 0.566682935f},
-std::array<float,2>{0.486106783f, 0.331295639f},
-std::array<float,2>{0.891103148f, 0.634872437f},
-std::array<float,2>{0.652155161f, 0.0422780924f},
-std::array<float,2>{0.100115754f, 0.899444997f},
-std::array<float,2>{0.0393433943f, 0.486277252f},
-std::array<float,2>{0.736670494f, 0.52968204f},
-std::array<float,2>{0.992854118f, 0.127427146f},
-std::array<float,2>{0.418987274f, 0.820939779f},
-std::array<float,2>{0.350784153f, 0.0808392093f},
-std::array<float,2>{0.815069675f, 0.957501948f},
-std::array<float,2>{0.602424383f, 0.305892676f},
-std::array<float,2>{0.229700252f, 0.74484998f},
-std::array<float,2>{0.0727874264f, 0.0180016812f},
-std::array<float,2>{0.683180571f, 0.921775222f},
-std::array<float,2>{0.936587512f, 0.37334922f},
-std::array<float,2>{0.439967066f, 0.680951953f},
-std::array<float,2>{0.259260833f, 0.432614386f},
-std::array<float,2>{0.760040283f, 0.600441217f},
-std::array<float,2>{0.531045735f, 0.2223005f},
-std::array<float,2>{0.13881202f, 0.76643914f},
-std::array<float,2>{0.187792435f, 0.277717501f},
-std::array<float,2>{0.576419234f, 0.701583028f},
-std::array<float,2>{0.868899763f, 0.123446122f},
-std::array<float,2>{0.321457028f, 0.9818874f},
-std::array<float,2>{0.402401149f, 0.177506745f},
-std::array<float,2>{0.953046322f, 0.847119033f},
-std::array<float,2>{0.709776878f, 0.441305071f},
-std::array<float,2>{0.00408613496f, 0.553590119f},
-std::array<float,2>{0.0869424939f, 0.183682486f},
-std::array<float,2>{0.66371429f, 0.851641476f},
-std::array<float,2>{0.916719913f, 0.451301903f},
-std::array<float,2>{0.453908265f, 0.558702886f},
-std::array<float,2>{0.267451078f, 0.270135224f},
-std::array<float,2>{0.771960378f, 0.689154387f},
-std::array<float,2>{0.501197994f, 0.113829374f},
-std::array<float,2>{0.142385483f, 0.974825084f},
-std::array<float,2>{0.215595856f, 0.428573281f},
-std::array<float,2>{0.58019942f, 0.603319228f},
-std::array<float,2>{0.846252739f, 0.231517434f},
-std::array<float,2>{0.338972718f, 0.774085283f},
-std::array<float,2>{0.37529847f, 0.0241307579f},
-std::array<float,2>{0.963006139f, 0.9066872f},
-std::array<float,2>{0.69519347f, 0.363788217f},
-std::array<float,2>{0.0225888826f, 0.673742056f},
-std::array<float,2>{0.184228733f, 0.0862614065f},
-std::array<float,2>{0.542261243f, 0.961327672f},
-std::array<float,2>{0.799614489f, 0.297561109f},
-std::array<float,2>{0.309913009f, 0.73502326f},
-std::array<float,2>{0.476953268f, 0.499896228f},
-std::array<float,2>{0.887856662f, 0.518012226f},
-std::array<float,2>{0.639206648f, 0.138916865f},
-std::array<float,2>{0.112449877f, 0.819966674f},
-std::array<float,2>{0.0580346696f, 0.342579901f},
-std::array<float,2>{0.723629296f, 0.630158842f},
-std::array<float,2>{0.98194623f, 0.0386139192f},
-std::array<float,2>{0.433258086f, 0.890693843f},
-std::array<float,2>{0.365114987f, 0.204148933f},
-std::array<float,2>{0.84343648f, 0.78926909f},
-std::array<float,2>{0.618734419f, 0.384640425f},
-std::array<float,2>{0.23502554f, 0.572639406f},
-std::array<float,2>{0.233842105f, 0.248187587f},
-std::array<float,2>{0.608996272f, 0.757887363f},
-std::array<float,2>{0.817985356f, 0.414690703f},
-std::array<float,2>{0.346435189f, 0.624233007f},
-std::array<float,2>{0.417552352f, 0.356176913f},
-std::array<float,2>{0.999346614f, 0.67114681f},
-std::array<float,2>{0.738434672f, 0.00326095824f},
-std::array<float,2>{0.044919882f, 0.9257707f},
-std::array<float,2>{0.093785964f, 0.467106223f},
-std::array<float,2>{0.656117797f, 0.533333719f},
-std::array<float,2>{0.898060203f, 0.163544685f},
-std::array<float,2>{0.488766104f, 0.87005949f},
-std::array<float,2>{0.295397699f, 0.105212741f},
-std::array<float,2>{0.787125826f, 0.990773439f},
-std::array<float,2>{0.550875783f, 0.265305966f},
-std::array<float,2>{0.159426615f, 0.707336426f},
-std::array<float,2>{0.00346578495f, 0.0541220717f},
-std::array<float,2>{0.706724942f, 0.87626785f},
-std::array<float,2>{0.947761059f, 0.315044641f},
-std::array<float,2>{0.400495619f, 0.646445513f},
-std::array<float,2>{0.325015992f, 0.393801123f},
-std::array<float,2>{0.873289585f, 0.59271729f},
-std::array<float,2>{0.574090719f, 0.198731795f},
-std::array<float,2>{0.193558455f, 0.801211953f},
-std::array<float,2>{0.135681808f, 0.29114908f},
-std::array<float,2>{0.525167882f, 0.72907114f},
-std::array<float,2>{0.76285243f, 0.0647913218f},
-std::array<float,2>{0.264451653f, 0.9454f},
-std::array<float,2>{0.445238769f, 0.142833859f},
-std::array<float,2>{0.930502534f, 0.840440273f},
-std::array<float,2>{0.685547888f, 0.470049053f},
-std::array<float,2>{0.0765657276f, 0.51181829f},
-std::array<float,2>{0.0388810039f, 0.187968135f},
-std::array<float,2>{0.748844624f, 0.805464149f},
-std::array<float,2>{0.992006958f, 0.40539819f},
-std::array<float,2>{0.412258595f, 0.581884146f},
-std::array<float,2>{0.351995319f, 0.323137015f},
-std::array<float,2>{0.827022135f, 0.655245721f},
-std::array<float,2>{0.594931304f, 0.0560638122f},
-std::array<float,2>{0.221403912f, 0.889265656f},
-std::array<float,2>{0.165207833f, 0.477787435f},
-std::array<float,2>{0.561201036f, 0.507735133f},
-std::array<float,2>{0.790599048f, 0.152380973f},
-std::array<float,2>{0.287783325f, 0.830971241f},
-std::array<float,2>{0.497503221f, 0.0714992136f},
-std::array<float,2>{0.905236721f, 0.939897835f},
-std::array<float,2>{0.648074925f, 0.284112543f},
-std::array<float,2>{0.104374111f, 0.722866118f},
-std::array<float,2>{0.199690044f, 0.014144904f},
-std::array<float,2>{0.565262914f, 0.933396935f},
-std::array<float,2>{0.862124026f, 0.34803167f},
-std::array<float,2>{0.317367643f, 0.66204375f},
-std::array<float,2>{0.390677631f, 0.413885832f},
-std::array<float,2>{0.94198662f, 0.610294163f},
-std::array<float,2>{0.717390656f, 0.241365433f},
-std::array<float,2>{0.0105131222f, 0.756699979f},
-std::array<float,2>{0.0644774809f, 0.256045491f},
-std::array<float,2>{0.677704215f, 0.717544675f},
-std::array<float,2>{0.921892524f, 0.0990669802f},
-std::array<float,2>{0.448329747f, 0.998377085f},
-std::array<float,2>{0.255717307f, 0.171618924f},
-std::array<float,2>{0.752243459f, 0.860061109f},
-std::array<float,2>{0.52292496f, 0.459326774f},
-std::array<float,2>{0.13173537f, 0.544835865f},
-std::array<float,2>{0.151857853f, 0.129643142f},
-std::array<float,2>{0.508925974f, 0.824837685f},
-std::array<float,2>{0.777599514f, 0.488597482f},
-std::array<float,2>{0.280369848f, 0.526787996f},
-std::array<float,2>{0.467108577f, 0.310828656f},
-std::array<float,2>{0.907173514f, 0.748022079f},
-std::array<float,2>{0.668518603f, 0.0841584951f},
-std::array<float,2>{0.0847045481f, 0.953364134f},
-std::array<float,2>{0.0267999303f, 0.376034439f},
-std::array<float,2>{0.698301971f, 0.565303564f},
-std::array<float,2>{0.954660594f, 0.21505633f},
-std::array<float,2>{0.383600801f, 0.784798443f},
-std::array<float,2>{0.33534652f, 0.0454192087f},
-std::array<float,2>{0.854939222f, 0.903960168f},
-std::array<float,2>{0.589502573f, 0.335247457f},
-std::array<float,2>{0.203634545f, 0.639097333f},
-std::array<float,2>{0.121393658f, 0.120206825f},
-std::array<float,2>{0.625302911f, 0.978891194f},
-std::array<float,2>{0.876978397f, 0.276953846f},
-std::array<float,2>{0.475171506f, 0.698397696f},
-std::array<float,2>{0.297921836f, 0.44455561f},
-std::array<float,2>{0.811415613f, 0.548513889f},
-std::array<float,2>{0.53179723f, 0.173962981f},
-std::array<float,2>{0.179452166f, 0.847689092f},
-std::array<float,2>{0.242384091f, 0.367509723f},
-std::array<float,2>{0.616238952f, 0.684073031f},
-std::array<float,2>{0.830690265f, 0.021613026f},
-std::array<float,2>{0.36935401f, 0.91514498f},
-std::array<float,2>{0.424111217f, 0.22365433f},
-std::array<float,2>{0.970219314f, 0.772650898f},
-std::array<float,2>{0.732163012f, 0.43551141f},
-std::array<float,2>{0.0489434898f, 0.596206248f},
-std::array<float,2>{0.0675426349f, 0.210819244f},
-std::array<float,2>{0.672236919f, 0.795331061f},
-std::array<float,2>{0.925827026f, 0.390081882f},
-std::array<float,2>{0.45028758f, 0.57430172f},
-std::array<float,2>{0.253423631f, 0.337506711f},
-std::array<float,2>{0.754332244f, 0.625299275f},
-std::array<float,2>{0.519093275f, 0.0328885987f},
-std::array<float,2>{0.12549828f, 0.898239255f},
-std::array<float,2>{0.1977617f, 0.494602978f},
-std::array<float,2>{0.569746614f, 0.520760894f},
-std::array<float,2>{0.864320576f, 0.136467859f},
-std::array<float,2>{0.314518839f, 0.816394448f},
-std::array<float,2>{0.395641357f, 0.0932133049f},
-std::array<float,2>{0.940926909f, 0.968298018f},
-std::array<float,2>{0.712714672f, 0.303260088f},
-std::array<float,2>{0.0125813056f, 0.739903271f},
-std::array<float,2>{0.171594977f, 0.0308570955f},
-std::array<float,2>{0.556204677f, 0.912771404f},
-std::array<float,2>{0.794187129f, 0.360512584f},
-std::array<float,2>{0.284759045f, 0.677978754f},
-std::array<float,2>{0.492381901f, 0.424260199f},
-std::array<float,2>{0.900659919f, 0.607307255f},
-std::array<float,2>{0.640864253f, 0.228389844f},
-std::array<float,2>{0.106883116f, 0.779023707f},
-std::array<float,2>{0.0331925154f, 0.267072082f},
-std::array<float,2>{0.744471252f, 0.694368184f},
-std::array<float,2>{0.988251269f, 0.111651935f},
-std::array<float,2>{0.409219682f, 0.971293688f},
-std::array<float,2>{0.358572751f, 0.18207103f},
-std::array<float,2>{0.82417959f, 0.857531011f},
-std::array<float,2>{0.601266384f, 0.445534796f},
-std::array<float,2>{0.222880647f, 0.555263042f},
-std::array<float,2>{0.249909714f, 0.14511618f},
-std::array<float,2>{0.609887481f, 0.838009894f},
-std::array<float,2>{0.833576143f, 0.475552976f},
-std::array<float,2>{0.372759432f, 0.511189282f},
-std::array<float,2>{0.425948888f, 0.294650614f},
-std::array<float,2>{0.975362837f, 0.733969927f},
-std::array<float,2>{0.727470219f, 0.0684718192f},
-std::array<float,2>{0.0520502068f, 0.950238585f},
-std::array<float,2>{0.117500007f, 0.394952834f},
-std::array<float,2>{0.63113898f, 0.588378847f},
-std::array<float,2>{0.879870832f, 0.202376306f},
-std::array<float,2>{0.471186399f, 0.799612463f},
-std::array<float,2>{0.30278483f, 0.0498893373f},
-std::array<float,2>{0.805237591f, 0.879945993f},
-std::array<float,2>{0.535777986f, 0.317277372f},
-std::array<float,2>{0.174041733f, 0.643938422f},
-std::array<float,2>{0.0296414811f, 0.108657464f},
-std::array<float,2>{0.70223397f, 0.986736834f},
-std::array<float,2>{0.95825237f, 0.261031777f},
-std::array<float,2>{0.387618601f, 0.703708827f},
-std::array<float,2>{0.329224139f, 0.463513792f},
-std::array<float,2>{0.856746256f, 0.535534024f},
-std::array<float,2>{0.593117177f, 0.159267396f},
-std::array<float,2>{0.210381314f, 0.87480092f},
-std::array<float,2>{0.153874651f, 0.352046251f},
-std::array<float,2>{0.512465f, 0.664886415f},
-std::array<float,2>{0.77428025f, 0.00635330519f},
-std::array<float,2>{0.275544643f, 0.928723693f},
-std::array<float,2>{0.462820917f, 0.245283097f},
-std::array<float,2>{0.910654306f, 0.762597203f},
-std::array<float,2>{0.666766822f, 0.418740362f},
-std::array<float,2>{0.0806355476f, 0.617923081f},
-std::array<float,2>{0.0600176193f, 0.165653095f},
-std::array<float,2>{0.722486138f, 0.864797831f},
-std::array<float,2>{0.977010608f, 0.453899086f},
-std::array<float,2>{0.435777962f, 0.539088786f},
-std::array<float,2>{0.363182038f, 0.252246708f},
-std::array<float,2>{0.836025417f, 0.713786364f},
-std::array<float,2>{0.623011351f, 0.0950490385f},
-std::array<float,2>{0.241733521f, 0.994096994f},
-std::array<float,2>{0.18165119f, 0.406817853f},
-std::array<float,2>{0.543380976f, 0.61513567f},
-std::array<float,2>{0.803276539f, 0.235173166f},
-std::array<float,2>{0.305151373f, 0.75069797f},
-std::array<float,2>{0.483236492f, 0.00898908079f},
-std::array<float,2>{0.884689271f, 0.936939001f},
-std::array<float,2>{0.636162698f, 0.344577342f},
-std::array<float,2>{0.115172431f, 0.657663584f},
-std::array<float,2>{0.212035134f, 0.0768823922f},
-std::array<float,2>{0.585596025f, 0.943241179f},
-std::array<float,2>{0.851495326f, 0.288603544f},
-std::array<float,2>{0.342435151f, 0.71931392f},
-std::array<float,2>{0.379996508f, 0.48162201f},
-std::array<float,2>{0.965884089f, 0.502457619f},
-std::array<float,2>{0.688252687f, 0.150116205f},
-std::array<float,2>{0.018462861f, 0.835149288f},
-std::array<float,2>{0.0917560831f, 0.325606048f},
-std::array<float,2>{0.659550607f, 0.651562154f},
-std::array<float,2>{0.918636322f, 0.0586689897f},
-std::array<float,2>{0.457812726f, 0.884536922f},
-std::array<float,2>{0.272165775f, 0.192527607f},
-std::array<float,2>{0.769389689f, 0.808611274f},
-std::array<float,2>{0.507721007f, 0.398518622f},
-std::array<float,2>{0.146607384f, 0.582534611f},
-std::array<float,2>{0.137826279f, 0.219048172f},
-std::array<float,2>{0.527861953f, 0.769277036f},
-std::array<float,2>{0.758442402f, 0.430931568f},
-std::array<float,2>{0.260766745f, 0.598903f},
-std::array<float,2>{0.437552929f, 0.371991307f},
-std::array<float,2>{0.934984744f, 0.682335079f},
-std::array<float,2>{0.680420995f, 0.0160107147f},
-std::array<float,2>{0.0716968179f, 0.919495642f},
-std::array<float,2>{0.00711000897f, 0.438372165f},
-std::array<float,2>{0.708084166f, 0.552640617f},
-std::array<float,2>{0.951159477f, 0.178160787f},
-std::array<float,2>{0.40460515f, 0.844112754f},
-std::array<float,2>{0.322452545f, 0.122787558f},
-std::array<float,2>{0.87096411f, 0.983483195f},
-std::array<float,2>{0.574544609f, 0.280623108f},
-std::array<float,2>{0.19032f, 0.699576497f},
-std::array<float,2>{0.0990778804f, 0.0405286923f},
-std::array<float,2>{0.649267554f, 0.901523709f},
-std::array<float,2>{0.893895566f, 0.328310013f},
-std::array<float,2>{0.4873555f, 0.63368547f},
-std::array<float,2>{0.291744858f, 0.382564783f},
-std::array<float,2>{0.782873452f, 0.568738997f},
-std::array<float,2>{0.550192237f, 0.210992277f},
-std::array<float,2>{0.16045633f, 0.787790835f},
-std::array<float,2>{0.22717765f, 0.308154523f},
-std::array<float,2>{0.604247332f, 0.74290365f},
-std::array<float,2>{0.813148975f, 0.078727752f},
-std::array<float,2>{0.348017335f, 0.960007608f},
-std::array<float,2>{0.421531528f, 0.125698298f},
-std::array<float,2>{0.995758235f, 0.822537661f},
-std::array<float,2>{0.735039234f, 0.487028658f},
-std::array<float,2>{0.0414982475f, 0.528156281f},
-std::array<float,2>{0.111229792f, 0.13841784f},
-std::array<float,2>{0.636839867f, 0.817151308f},
-std::array<float,2>{0.890439928f, 0.496233672f},
-std::array<float,2>{0.479599714f, 0.516126573f},
-std::array<float,2>{0.310754597f, 0.300532907f},
-std::array<float,2>{0.798688471f, 0.738215506f},
-std::array<float,2>{0.539645433f, 0.0897101089f},
-std::array<float,2>{0.186675325f, 0.963848233f},
-std::array<float,2>{0.237942457f, 0.385445952f},
-std::array<float,2>{0.619565725f, 0.572167814f},
-std::array<float,2>{0.841389716f, 0.205493718f},
-std::array<float,2>{0.366137087f, 0.791076422f},
-std::array<float,2>{0.430341214f, 0.0368009359f},
-std::array<float,2>{0.984281957f, 0.893193722f},
-std::array<float,2>{0.726295829f, 0.340017349f},
-std::array<float,2>{0.0559246056f, 0.632566929f},
-std::array<float,2>{0.143756345f, 0.115780123f},
-std::array<float,2>{0.502821445f, 0.972750604f},
-std::array<float,2>{0.771254241f, 0.272416979f},
-std::array<float,2>{0.269118726f, 0.690977395f},
-std::array<float,2>{0.455449939f, 0.449719608f},
-std::array<float,2>{0.915394485f, 0.560807049f},
-std::array<float,2>{0.662010729f, 0.187153846f},
-std::array<float,2>{0.0889195055f, 0.854031861f},
-std::array<float,2>{0.0206920058f, 0.365916163f},
-std::array<float,2>{0.692396224f, 0.674623072f},
-std::array<float,2>{0.961604357f, 0.0269874558f},
-std::array<float,2>{0.378190309f, 0.908668578f},
-std::array<float,2>{0.337228358f, 0.232634276f},
-std::array<float,2>{0.844388425f, 0.776298344f},
-std::array<float,2>{0.579949439f, 0.426526576f},
-std::array<float,2>{0.217722327f, 0.604750216f},
-std::array<float,2>{0.192953631f, 0.196312398f},
-std::array<float,2>{0.570968926f, 0.804275334f},
-std::array<float,2>{0.87130183f, 0.391906708f},
-std::array<float,2>{0.32779479f, 0.589997053f},
-std::array<float,2>{0.398636639f, 0.313209504f},
-std::array<float,2>{0.946332514f, 0.647544801f},
-std::array<float,2>{0.703539491f, 0.0512154698f},
-std::array<float,2>{0.00117484946f, 0.878653646f},
-std::array<float,2>{0.0759753883f, 0.472298443f},
-std::array<float,2>{0.685510457f, 0.514507473f},
-std::array<float,2>{0.931644678f, 0.140870735f},
-std::array<float,2>{0.442425996f, 0.842111886f},
-std::array<float,2>{0.263614774f, 0.0642356649f},
-std::array<float,2>{0.764366686f, 0.947655797f},
-std::array<float,2>{0.526273727f, 0.289336562f},
-std::array<float,2>{0.133162364f, 0.726907492f},
-std::array<float,2>{0.0458127372f, 0.00112676097f},
-std::array<float,2>{0.741500139f, 0.922069311f},
-std::array<float,2>{0.997733414f, 0.358992338f},
-std::array<float,2>{0.415416777f, 0.668471754f},
-std::array<float,2>{0.345025629f, 0.416077107f},
-std::array<float,2>{0.819719613f, 0.622958899f},
-std::array<float,2>{0.606044054f, 0.247216061f},
-std::array<float,2>{0.231025875f, 0.760654151f},
-std::array<float,2>{0.157558486f, 0.263035893f},
-std::array<float,2>{0.553725362f, 0.7106058f},
-std::array<float,2>{0.785193801f, 0.10339918f},
-std::array<float,2>{0.294064432f, 0.988466322f},
-std::array<float,2>{0.492141277f, 0.161139339f},
-std::array<float,2>{0.89587307f, 0.867864132f},
-std::array<float,2>{0.65409112f, 0.466619283f},
-std::array<float,2>{0.0962325856f, 0.533171475f},
-std::array<float,2>{0.00792562682f, 0.238445848f},
-std::array<float,2>{0.715147972f, 0.754121244f},
-std::array<float,2>{0.944518626f, 0.41119054f},
-std::array<float,2>{0.394092858f, 0.612953007f},
-std::array<float,2>{0.318914473f, 0.350776821f},
-std::array<float,2>{0.859457374f, 0.663085818f},
-std::array<float,2>{0.564438224f, 0.0124545386f},
-std::array<float,2>{0.202388495f, 0.929892004f},
-std::array<float,2>{0.130125985f, 0.457926303f},
-std::array<float,2>{0.520242989f, 0.545630455f},
-std::array<float,2>{0.750550568f, 0.168674842f},
-std::array<float,2>{0.257516384f, 0.862092257f},
-std::array<float,2>{0.445583344f, 0.100169487f},
-std::array<float,2>{0.924034536f, 0.996173024f},
-std::array<float,2>{0.677905083f, 0.254245192f},
-std::array<float,2>{0.0634397194f, 0.715971887f},
-std::array<float,2>{0.220358431f, 0.0567468256f},
-std::array<float,2>{0.596828222f, 0.887680113f},
-std::array<float,2>{0.825276077f, 0.320872188f},
-std::array<float,2>{0.35371992f, 0.652729452f},
-std::array<float,2>{0.410173476f, 0.403607428f},
-std::array<float,2>{0.990172386f, 0.578732848f},
-std::array<float,2>{0.746106625f, 0.189547196f},
-std::array<float,2>{0.0371021219f, 0.808355451f},
-std::array<float,2>{0.101782791f, 0.281297922f},
-std::array<float,2>{0.645258665f, 0.726414859f},
-std::array<float,2>{0.903565645f, 0.0730062276f},
-std::array<float,2>{0.498563319f, 0.939411879f},
-std::array<float,2>{0.287096173f, 0.155790329f},
-std::array<float,2>{0.792772949f, 0.828353167f},
-std::array<float,2>{0.560177743f, 0.479104549f},
-std::array<float,2>{0.166215688f, 0.504977405f},
-std::array<float,2>{0.176838368f, 0.172061279f},
-std::array<float,2>{0.533789337f, 0.85048157f},
-std::array<float,2>{0.810155749f, 0.442957848f},
-std::array<float,2>{0.299588174f, 0.549609363f},
-std::array<float,2>{0.474286109f, 0.275270224f},
-std::array<float,2>{0.875533104f, 0.696115077f},
-std::array<float,2>{0.62822336f, 0.1180733f},
-std::array<float,2>{0.124556705f, 0.977957487f},
-std::array<float,2>{0.0477610417f, 0.437366068f},
-std::array<float,2>{0.733516932f, 0.595423996f},
-std::array<float,2>{0.972164571f, 0.225785613f},
-std::array<float,2>{0.423064888f, 0.771374106f},
-std::array<float,2>{0.368154347f, 0.020476887f},
-std::array<float,2>{0.83005929f, 0.916966975f},
-std::array<float,2>{0.614548326f, 0.370693266f},
-std::array<float,2>{0.245768309f, 0.686551332f},
-std::array<float,2>{0.0839790255f, 0.0823298097f},
-std::array<float,2>{0.670965016f, 0.955536664f},
-std::array<float,2>{0.909572184f, 0.310001671f},
-std::array<float,2>{0.465759546f, 0.748248816f},
-std::array<float,2>{0.278329223f, 0.491595745f},
-std::array<float,2>{0.779507577f, 0.52491194f},
-std::array<float,2>{0.51022929f, 0.131842405f},
-std::array<float,2>{0.149793252f, 0.827153563f},
-std::array<float,2>{0.205817908f, 0.33244586f},
-std::array<float,2>{0.586883485f, 0.638459742f},
-std::array<float,2>{0.852661252f, 0.043893408f},
-std::array<float,2>{0.333376378f, 0.905285716f},
-std::array<float,2>{0.384979695f, 0.217111632f},
-std::array<float,2>{0.955790997f, 0.781298995f},
-std::array<float,2>{0.696735024f, 0.377978414f},
-std::array<float,2>{0.0246321876f, 0.562784135f},
-std::array<float,2>{0.120104477f, 0.201443508f},
-std::array<float,2>{0.630147755f, 0.799942791f},
-std::array<float,2>{0.88244313f, 0.395855278f},
-std::array<float,2>{0.469134212f, 0.588988066f},
-std::array<float,2>{0.300782591f, 0.317672312f},
-std::array<float,2>{0.808293283f, 0.643532217f},
-std::array<float,2>{0.537162662f, 0.0488488264f},
-std::array<float,2>{0.173469394f, 0.878946424f},
-std::array<float,2>{0.247607276f, 0.475702643f},
-std::array<float,2>{0.613017917f, 0.510486066f},
-std::array<float,2>{0.835002005f, 0.146291897f},
-std::array<float,2>{0.373604208f, 0.839332104f},
-std::array<float,2>{0.428082585f, 0.0700060427f},
-std::array<float,2>{0.973766565f, 0.949816406f},
-std::array<float,2>{0.729292572f, 0.293413639f},
-std::array<float,2>{0.0533094294f, 0.733078897f},
-std::array<float,2>{0.154493749f, 0.00775757199f},
-std::array<float,2>{0.514921367f, 0.928341806f},
-std::array<float,2>{0.777061462f, 0.352751017f},
-std::array<float,2>{0.274954408f, 0.665423334f},
-std::array<float,2>{0.462910533f, 0.419270456f},
-std::array<float,2>{0.912439585f, 0.618679285f},
-std::array<float,2>{0.665865719f, 0.244964242f},
-std::array<float,2>{0.0797889978f, 0.763330638f},
-std::array<float,2>{0.028429294f, 0.260644227f},
-std::array<float,2>{0.699279189f, 0.704411387f},
-std::array<float,2>{0.960105896f, 0.107787386f},
-std::array<float,2>{0.389890939f, 0.987501085f},
-std::array<float,2>{0.330944031f, 0.159141526f},
-std::array<float,2>{0.859042764f, 0.873703182f},
-std::array<float,2>{0.591139317f, 0.464760184f},
-std::array<float,2>{0.208428308f, 0.5363307f},
-std::array<float,2>{0.196374014f, 0.13563928f},
-std::array<float,2>{0.567034781f, 0.814882338f},
-std::array<float,2>{0.866061389f, 0.49535501f},
-std::array<float,2>{0.314190805f, 0.520134568f},
-std::array<float,2>{0.396908432f, 0.304202974f},
-std::array<float,2>{0.937893331f, 0.738684177f},
-std::array<float,2>{0.713972747f, 0.0920620933f},
-std::array<float,2>{0.0149023114f, 0.967481852f},
-std::array<float,2>{0.0692634135f, 0.388679415f},
-std::array<float,2>{0.674871147f, 0.575909019f},
-std::array<float,2>{0.929135919f, 0.209115013f},
-std::array<float,2>{0.452382386f, 0.796437204f},
-std::array<float,2>{0.251944989f, 0.0320143066f},
-std::array<float,2>{0.756129801f, 0.897187948f},
-std::array<float,2>{0.51699841f, 0.336723864f},
-std::array<float,2>{0.12771152f, 0.626459479f},
-std::array<float,2>{0.0348724686f, 0.112790592f},
-std::array<float,2>{0.743547201f, 0.972648442f},
-std::array<float,2>{0.984881401f, 0.266183734f},
-std::array<float,2>{0.407166213f, 0.693851829f},
-std::array<float,2>{0.357055753f, 0.447124273f},
-std::array<float,2>{0.821339846f, 0.556266606f},
-std::array<float,2>{0.597792983f, 0.183027849f},
-std::array<float,2>{0.225327387f, 0.858766735f},
-std::array<float,2>{0.169921726f, 0.360108227f},
-std::array<float,2>{0.557974458f, 0.678955138f},
-std::array<float,2>{0.796762824f, 0.0295989141f},
-std::array<float,2>{0.28245306f, 0.913906813f},
-std::array<float,2>{0.494420797f, 0.226908907f},
-std::array<float,2>{0.899718761f, 0.777733862f},
-std::array<float,2>{0.643458188f, 0.425176293f},
-std::array<float,2>{0.108112961f, 0.605995417f},
-std::array<float,2>{0.00563459937f, 0.17911005f},
-std::array<float,2>{0.71088028f, 0.845564067f},
-std::array<float,2>{0.951487839f, 0.438640684f},
-std::array<float,2>{0.40409112f, 0.550902784f},
-std::array<float,2>{0.32050553f, 0.279408753f},
-std::array<float,2>{0.867786527f, 0.700534463f},
-std::array<float,2>{0.577516794f, 0.121634357f},
-std::array<float,2>{0.188563302f, 0.983057439f},
-std::array<float,2>{0.139807045f, 0.429929584f},
-std::array<float,2>{0.530053377f, 0.598335624f},
-std::array<float,2>{0.761325896f, 0.219902709f},
-std::array<float,2>{0.25851506f, 0.768215954f},
-std::array<float,2>{0.441178948f, 0.0170820002f},
-std::array<float,2>{0.936482728f, 0.918565452f},
-std::array<float,2>{0.682035089f, 0.372475892f},
-std::array<float,2>{0.0734190196f, 0.682646751f},
-std::array<float,2>{0.229211792f, 0.0795036182f},
-std::array<float,2>{0.603212416f, 0.959892511f},
-std::array<float,2>{0.815712988f, 0.307436407f},
-std::array<float,2>{0.34962216f, 0.743501902f},
-std::array<float,2>{0.418435246f, 0.487924725f},
-std::array<float,2>{0.993824005f, 0.528582335f},
-std::array<float,2>{0.737440109f, 0.126885399f},
-std::array<float,2>{0.0410041809f, 0.823408246f},
-std::array<float,2>{0.100659892f, 0.329392344f},
-std::array<float,2>{0.650600374f, 0.633952796f},
-std::array<float,2>{0.892401874f, 0.0398381054f},
-std::array<float,2>{0.484802216f, 0.900693178f},
-std::array<float,2>{0.290573239f, 0.212565005f},
-std::array<float,2>{0.784242034f, 0.788532674f},
-std::array<float,2>{0.547216594f, 0.381069332f},
-std::array<float,2>{0.163452312f, 0.570139349f},
-std::array<float,2>{0.180112153f, 0.235611454f},
-std::array<float,2>{0.545825422f, 0.751648486f},
-std::array<float,2>{0.801250994f, 0.407940567f},
-std::array<float,2>{0.30669257f, 0.614243746f},
-std::array<float,2>{0.482339054f, 0.345623553f},
-std::array<float,2>{0.886089563f, 0.656487048f},
-std::array<float,2>{0.633630812f, 0.00858804118f},
-std::array<float,2>{0.115292661f, 0.93631798f},
-std::array<float,2>{0.0623233654f, 0.454252899f},
-std::array<float,2>{0.719680786f, 0.54080379f},
-std::array<float,2>{0.979403973f, 0.16492708f},
-std::array<float,2>{0.434997469f, 0.863292396f},
-std::array<float,2>{0.361283571f, 0.0938260332f},
-std::array<float,2>{0.838743806f, 0.992953539f},
-std::array<float,2>{0.624360383f, 0.253688931f},
-std::array<float,2>{0.239222944f, 0.714384973f},
-std::array<float,2>{0.0927179232f, 0.0597045906f},
-std::array<float,2>{0.657896876f, 0.883303165f},
-std::array<float,2>{0.920693576f, 0.324366778f},
-std::array<float,2>{0.459176242f, 0.65084666f},
-std::array<float,2>{0.269847393f, 0.399766177f},
-std::array<float,2>{0.767506182f, 0.583165228f},
-std::array<float,2>{0.505124152f, 0.191816911f},
-std::array<float,2>{0.146172851f, 0.810319364f},
-std::array<float,2>{0.213793367f, 0.287828088f},
-std::array<float,2>{0.583086908f, 0.720678985f},
-std::array<float,2>{0.848281741f, 0.0776576474f},
-std::array<float,2>{0.340462565f, 0.94227922f},
-std::array<float,2>{0.382110506f, 0.148989335f},
-std::array<float,2>{0.967784882f, 0.834813654f},
-std::array<float,2>{0.6900962f, 0.48063612f},
-std::array<float,2>{0.0167374928f, 0.503857017f},
-std::array<float,2>{0.0775066465f, 0.142318457f},
-std::array<float,2>{0.686985075f, 0.843159437f},
-std::array<float,2>{0.931271255f, 0.471547604f},
-std::array<float,2>{0.444226414f, 0.515457332f},
-std::array<float,2>{0.265426129f, 0.290514141f},
-std::array<float,2>{0.762440205f, 0.727871776f},
-std::array<float,2>{0.523726225f, 0.0628073439f},
-std::array<float,2>{0.135855034f, 0.949132979f},
-std::array<float,2>{0.19439508f, 0.391152263f},
-std::array<float,2>{0.573193669f, 0.591107011f},
-std::array<float,2>{0.874557793f, 0.195623457f},
-std::array<float,2>{0.326115549f, 0.803411305f},
-std::array<float,2>{0.401586831f, 0.0523816347f},
-std::array<float,2>{0.948553145f, 0.877124906f},
-std::array<float,2>{0.70510906f, 0.314008325f},
-std::array<float,2>{0.00196942594f, 0.647117794f},
-std::array<float,2>{0.158934832f, 0.10252253f},
-std::array<float,2>{0.55268085f, 0.98988086f},
-std::array<float,2>{0.788217187f, 0.262490809f},
-std::array<float,2>{0.296587557f, 0.709753692f},
-std::array<float,2>{0.489306897f, 0.464988053f},
-std::array<float,2>{0.897243381f, 0.53152293f},
-std::array<float,2>{0.654429793f, 0.160875529f},
-std::array<float,2>{0.0954630598f, 0.868288338f},
-std::array<float,2>{0.0432484373f, 0.357974291f},
-std::array<float,2>{0.73997885f, 0.669757366f},
-std::array<float,2>{0.998997033f, 0.000830723788f},
-std::array<float,2>{0.416326195f, 0.92326957f},
-std::array<float,2>{0.346852005f, 0.246513486f},
-std::array<float,2>{0.817382753f, 0.761667013f},
-std::array<float,2>{0.607737958f, 0.417246193f},
-std::array<float,2>{0.233359411f, 0.621537864f},
-std::array<float,2>{0.235701457f, 0.206378132f},
-std::array<float,2>{0.617928326f, 0.792199135f},
-std::array<float,2>{0.842098594f, 0.38638401f},
-std::array<float,2>{0.364201665f, 0.570413232f},
-std::array<float,2>{0.431704253f, 0.341089338f},
-std::array<float,2>{0.980912209f, 0.63168925f},
-std::array<float,2>{0.724303007f, 0.0353443101f},
-std::array<float,2>{0.0573274791f, 0.894064546f},
-std::array<float,2>{0.111448817f, 0.497366607f},
-std::array<float,2>{0.640333235f, 0.517540991f},
-std::array<float,2>{0.887390852f, 0.136739612f},
-std::array<float,2>{0.478437096f, 0.81746757f},
-std::array<float,2>{0.308752477f, 0.0883207992f},
-std::array<float,2>{0.80012387f, 0.964624047f},
-std::array<float,2>{0.541155875f, 0.299131632f},
-std::array<float,2>{0.185361952f, 0.736981213f},
-std::array<float,2>{0.0215705317f, 0.0257227346f},
-std::array<float,2>{0.693892896f, 0.909627438f},
-std::array<float,2>{0.964808524f, 0.366427213f},
-std::array<float,2>{0.376755059f, 0.675016701f},
-std::array<float,2>{0.338006496f, 0.426851243f},
-std::array<float,2>{0.846820414f, 0.604479432f},
-std::array<float,2>{0.581268013f, 0.23385413f},
-std::array<float,2>{0.216195121f, 0.776845574f},
-std::array<float,2>{0.141275615f, 0.273060262f},
-std::array<float,2>{0.500590563f, 0.690363646f},
-std::array<float,2>{0.772845805f, 0.116499498f},
-std::array<float,2>{0.266186386f, 0.974257171f},
-std::array<float,2>{0.454934627f, 0.18577908f},
-std::array<float,2>{0.917418897f, 0.854991853f},
-std::array<float,2>{0.662680209f, 0.451083541f},
-std::array<float,2>{0.0861009285f, 0.561798096f},
-std::array<float,2>{0.0501274802f, 0.224818245f},
-std::array<float,2>{0.731378734f, 0.770179093f},
-std::array<float,2>{0.968941212f, 0.435749948f},
-std::array<float,2>{0.42514503f, 0.593889177f},
-std::array<float,2>{0.370219409f, 0.36923945f},
-std::array<float,2>{0.83144635f, 0.685740948f},
-std::array<float,2>{0.615896046f, 0.0214210786f},
-std::array<float,2>{0.243585452f, 0.917533875f},
-std::array<float,2>{0.178083166f, 0.441997588f},
-std::array<float,2>{0.532749653f, 0.55037576f},
-std::array<float,2>{0.811869144f, 0.173567086f},
-std::array<float,2>{0.296948671f, 0.850711882f},
-std::array<float,2>{0.475839704f, 0.11849615f},
-std::array<float,2>{0.878712475f, 0.976967633f},
-std::array<float,2>{0.626757264f, 0.274220854f},
-std::array<float,2>{0.122912161f, 0.697233975f},
-std::array<float,2>{0.204797417f, 0.0446688384f},
-std::array<float,2>{0.588841021f, 0.90460664f},
-std::array<float,2>{0.854340732f, 0.333039761f},
-std::array<float,2>{0.334621817f, 0.636858761f},
-std::array<float,2>{0.384716511f, 0.377484083f},
-std::array<float,2>{0.953466594f, 0.564144075f},
-std::array<float,2>{0.697345078f, 0.218152151f},
-std::array<float,2>{0.0260291286f, 0.782756031f},
-std::array<float,2>{0.0856675059f, 0.309154123f},
-std::array<float,2>{0.669480085f, 0.749416649f},
-std::array<float,2>{0.907289028f, 0.0836881846f},
-std::array<float,2>{0.468088329f, 0.956193566f},
-std::array<float,2>{0.279415369f, 0.13166897f},
-std::array<float,2>{0.779110491f, 0.826945543f},
-std::array<float,2>{0.508664668f, 0.490272164f},
-std::array<float,2>{0.150676593f, 0.523671031f},
-std::array<float,2>{0.132171348f, 0.168991506f},
-std::array<float,2>{0.521824479f, 0.863148749f},
-std::array<float,2>{0.753270507f, 0.458043039f},
-std::array<float,2>{0.254334122f, 0.54666245f},
-std::array<float,2>{0.447727025f, 0.25510332f},
-std::array<float,2>{0.922908843f, 0.714989722f},
-std::array<float,2>{0.675826371f, 0.101404175f},
-std::array<float,2>{0.0661603957f, 0.997380316f},
-std::array<float,2>{0.0114968633f, 0.410540402f},
-std::array<float,2>{0.718372643f, 0.611694694f},
-std::array<float,2>{0.942580044f, 0.239942729f},
-std::array<float,2>{0.39234215f, 0.755658388f},
-std::array<float,2>{0.317455202f, 0.0129553322f},
-std::array<float,2>{0.862688363f, 0.930690825f},
-std::array<float,2>{0.566219568f, 0.35014984f},
-std::array<float,2>{0.200229838f, 0.663903475f},
-std::array<float,2>{0.105080798f, 0.0738674402f},
-std::array<float,2>{0.646847606f, 0.938353658f},
-std::array<float,2>{0.906041086f, 0.282301337f},
-std::array<float,2>{0.496787369f, 0.725146234f},
-std::array<float,2>{0.289034039f, 0.480416179f},
-std::array<float,2>{0.789954245f, 0.504548967f},
-std::array<float,2>{0.561858773f, 0.154571474f},
-std::array<float,2>{0.164621085f, 0.829981685f},
-std::array<float,2>{0.221917585f, 0.321868479f},
-std::array<float,2>{0.594011009f, 0.65417856f},
-std::array<float,2>{0.827656686f, 0.0578129217f},
-std::array<float,2>{0.352828026f, 0.8878389f},
-std::array<float,2>{0.413282484f, 0.190621927f},
-std::array<float,2>{0.990506589f, 0.80717206f},
-std::array<float,2>{0.749408007f, 0.402809471f},
-std::array<float,2>{0.037975274f, 0.579506457f},
-std::array<float,2>{0.0819812641f, 0.242771208f},
-std::array<float,2>{0.667759359f, 0.764199615f},
-std::array<float,2>{0.912015796f, 0.421177983f},
-std::array<float,2>{0.461725652f, 0.61985296f},
-std::array<float,2>{0.276795626f, 0.354787797f},
-std::array<float,2>{0.775389194f, 0.666431069f},
-std::array<float,2>{0.512932599f, 0.00466191163f},
-std::array<float,2>{0.152537793f, 0.92712158f},
-std::array<float,2>{0.209739834f, 0.46152094f},
-std::array<float,2>{0.592511594f, 0.538103342f},
-std::array<float,2>{0.855743468f, 0.15738368f},
-std::array<float,2>{0.328904957f, 0.87263f},
-std::array<float,2>{0.388657928f, 0.106430866f},
-std::array<float,2>{0.957705796f, 0.984828353f},
-std::array<float,2>{0.702084601f, 0.257941723f},
-std::array<float,2>{0.0307245161f, 0.706981599f},
-std::array<float,2>{0.17532815f, 0.04702783f},
-std::array<float,2>{0.536243081f, 0.881363451f},
-std::array<float,2>{0.806513667f, 0.319632739f},
-std::array<float,2>{0.304015517f, 0.642565668f},
-std::array<float,2>{0.472551942f, 0.396948367f},
-std::array<float,2>{0.880667508f, 0.58694911f},
-std::array<float,2>{0.632555366f, 0.199364766f},
-std::array<float,2>{0.118654303f, 0.798122644f},
-std::array<float,2>{0.0512690619f, 0.296584219f},
-std::array<float,2>{0.727962196f, 0.73172015f},
-std::array<float,2>{0.976418257f, 0.0672031194f},
-std::array<float,2>{0.426903814f, 0.952875316f},
-std::array<float,2>{0.371755153f, 0.147837982f},
-std::array<float,2>{0.832436562f, 0.837301254f},
-std::array<float,2>{0.611131489f, 0.474211961f},
-std::array<float,2>{0.248293281f, 0.50913161f},
-std::array<float,2>{0.224535748f, 0.179778442f},
-std::array<float,2>{0.600282311f, 0.856360972f},
-std::array<float,2>{0.822419107f, 0.447642773f},
-std::array<float,2>{0.357742667f, 0.556825459f},
-std::array<float,2>{0.408781141f, 0.26902172f},
-std::array<float,2>{0.986884356f, 0.693208635f},
-std::array<float,2>{0.745713353f, 0.109834023f},
-std::array<float,2>{0.031842757f, 0.969578147f},
-std::array<float,2>{0.106223837f, 0.423418343f},
-std::array<float,2>{0.641885996f, 0.609191656f},
-std::array<float,2>{0.901421726f, 0.229189202f},
-std::array<float,2>{0.493361443f, 0.779764235f},
-std::array<float,2>{0.283411592f, 0.0291522145f},
-std::array<float,2>{0.793624699f, 0.911353171f},
-std::array<float,2>{0.5554111f, 0.362556696f},
-std::array<float,2>{0.170394808f, 0.676766813f},
-std::array<float,2>{0.0132846311f, 0.0898804814f},
-std::array<float,2>{0.711099386f, 0.9658494f},
-std::array<float,2>{0.939689457f, 0.300909042f},
-std::array<float,2>{0.394898027f, 0.740360975f},
-std::array<float,2>{0.316205472f, 0.49379155f},
-std::array<float,2>{0.863884091f, 0.522914112f},
-std::array<float,2>{0.568763852f, 0.134105533f},
-std::array<float,2>{0.199120358f, 0.81359607f},
-std::array<float,2>{0.126295909f, 0.339166522f},
-std::array<float,2>{0.51827246f, 0.628136098f},
-std::array<float,2>{0.755360067f, 0.0350826941f},
-std::array<float,2>{0.252078652f, 0.895566463f},
-std::array<float,2>{0.449834853f, 0.208433494f},
-std::array<float,2>{0.927040637f, 0.794447124f},
-std::array<float,2>{0.672860384f, 0.388421476f},
-std::array<float,2>{0.0670638159f, 0.577375114f},
-std::array<float,2>{0.0425285436f, 0.128226191f},
-std::array<float,2>{0.735695004f, 0.821569562f},
-std::array<float,2>{0.994503558f, 0.484939486f},
-std::array<float,2>{0.420657158f, 0.530850112f},
-std::array<float,2>{0.349124402f, 0.305046886f},
-std::array<float,2>{0.81441468f, 0.745634377f},
-std::array<float,2>{0.60483104f, 0.0816757977f},
-std::array<float,2>{0.22777608f, 0.958954155f},
-std::array<float,2>{0.161421865f, 0.380320311f},
-std::array<float,2>{0.549452543f, 0.567581117f},
-std::array<float,2>{0.781756341f, 0.213789985f},
-std::array<float,2>{0.292923629f, 0.786934495f},
-std::array<float,2>{0.486426473f, 0.0412069373f},
-std::array<float,2>{0.893059969f, 0.899330556f},
-std::array<float,2>{0.650034904f, 0.330751389f},
-std::array<float,2>{0.0983810499f, 0.635891259f},
-std::array<float,2>{0.190987676f, 0.124806456f},
-std::array<float,2>{0.575839758f, 0.981317699f},
-std::array<float,2>{0.870113015f, 0.279138476f},
-std::array<float,2>{0.323740929f, 0.702985764f},
-std::array<float,2>{0.406096399f, 0.439940393f},
-std::array<float,2>{0.949991703f, 0.55379957f},
-std::array<float,2>{0.707034469f, 0.176286578f},
-std::array<float,2>{0.00594728207f, 0.84659332f},
-std::array<float,2>{0.070835337f, 0.374823481f},
-std::array<float,2>{0.681382f, 0.680071115f},
-std::array<float,2>{0.933952034f, 0.0191417579f},
-std::array<float,2>{0.439338654f, 0.920006394f},
-std::array<float,2>{0.259946883f, 0.221043795f},
-std::array<float,2>{0.759368062f, 0.767181396f},
-std::array<float,2>{0.528906107f, 0.432635784f},
-std::array<float,2>{0.13688381f, 0.600860238f},
-std::array<float,2>{0.147661537f, 0.194291189f},
-std::array<float,2>{0.506672382f, 0.812404633f},
-std::array<float,2>{0.767926335f, 0.400923699f},
-std::array<float,2>{0.273343652f, 0.584050119f},
-std::array<float,2>{0.458817303f, 0.326875329f},
-std::array<float,2>{0.919592619f, 0.649976373f},
-std::array<float,2>{0.658457696f, 0.0618031919f},
-std::array<float,2>{0.0901634842f, 0.884922445f},
-std::array<float,2>{0.0194528773f, 0.482640713f},
-std::array<float,2>{0.689421475f, 0.501649559f},
-std::array<float,2>{0.965731561f, 0.152287632f},
-std::array<float,2>{0.379472703f, 0.832522035f},
-std::array<float,2>{0.343612939f, 0.0755584016f},
-std::array<float,2>{0.850360692f, 0.945049524f},
-std::array<float,2>{0.584897816f, 0.286058605f},
-std::array<float,2>{0.211225107f, 0.722201049f},
-std::array<float,2>{0.114179336f, 0.0116792507f},
-std::array<float,2>{0.63485682f, 0.935266197f},
-std::array<float,2>{0.883306265f, 0.346626371f},
-std::array<float,2>{0.484170794f, 0.659072042f},
-std::array<float,2>{0.305796415f, 0.409379244f},
-std::array<float,2>{0.804466248f, 0.617092133f},
-std::array<float,2>{0.544551253f, 0.236575976f},
-std::array<float,2>{0.182952985f, 0.752922297f},
-std::array<float,2>{0.240282625f, 0.251291543f},
-std::array<float,2>{0.621970534f, 0.712512076f},
-std::array<float,2>{0.837464929f, 0.0962281078f},
-std::array<float,2>{0.362146556f, 0.995259881f},
-std::array<float,2>{0.437191069f, 0.166254342f},
-std::array<float,2>{0.977759838f, 0.867143393f},
-std::array<float,2>{0.720775366f, 0.455883622f},
-std::array<float,2>{0.0594316833f, 0.542206943f},
-std::array<float,2>{0.0973011404f, 0.162602782f},
-std::array<float,2>{0.653298438f, 0.87086457f},
-std::array<float,2>{0.895497501f, 0.468435496f},
-std::array<float,2>{0.490686655f, 0.534552991f},
-std::array<float,2>{0.293345392f, 0.264122188f},
-std::array<float,2>{0.786997557f, 0.708331585f},
-std::array<float,2>{0.553504586f, 0.104346514f},
-std::array<float,2>{0.1568432f, 0.992020547f},
-std::array<float,2>{0.23197715f, 0.415183604f},
-std::array<float,2>{0.6071859f, 0.623816788f},
-std::array<float,2>{0.819074035f, 0.249653384f},
-std::array<float,2>{0.344198704f, 0.759376407f},
-std::array<float,2>{0.414135575f, 0.00233245641f},
-std::array<float,2>{0.996720672f, 0.92408222f},
-std::array<float,2>{0.741126001f, 0.357094526f},
-std::array<float,2>{0.0465392768f, 0.670361221f},
-std::array<float,2>{0.134191573f, 0.0657870099f},
-std::array<float,2>{0.527175665f, 0.946439147f},
-std::array<float,2>{0.76552242f, 0.292298198f},
-std::array<float,2>{0.262128085f, 0.730405271f},
-std::array<float,2>{0.441810161f, 0.468774855f},
-std::array<float,2>{0.933122814f, 0.512992203f},
-std::array<float,2>{0.6839661f, 0.143689439f},
-std::array<float,2>{0.0747718439f, 0.840998828f},
-std::array<float,2>{0.000404180522f, 0.31615895f},
-std::array<float,2>{0.704821944f, 0.645411372f},
-std::array<float,2>{0.946035326f, 0.0536168478f},
-std::array<float,2>{0.399452806f, 0.875578582f},
-std::array<float,2>{0.32654205f, 0.198199451f},
-std::array<float,2>{0.872276187f, 0.801994026f},
-std::array<float,2>{0.571865022f, 0.392735332f},
-std::array<float,2>{0.192102373f, 0.593345463f},
-std::array<float,2>{0.218290642f, 0.231056869f},
-std::array<float,2>{0.578572214f, 0.775039136f},
-std::array<float,2>{0.845426798f, 0.428979814f},
-std::array<float,2>{0.336770117f, 0.601965129f},
-std::array<float,2>{0.377284318f, 0.364851773f},
-std::array<float,2>{0.96273154f, 0.672701418f},
-std::array<float,2>{0.692287803f, 0.0249801371f},
-std::array<float,2>{0.0203887057f, 0.907277524f},
-std::array<float,2>{0.088175118f, 0.452717632f},
-std::array<float,2>{0.661011755f, 0.559956491f},
-std::array<float,2>{0.914875329f, 0.185352325f},
-std::array<float,2>{0.4562895f, 0.853128433f},
-std::array<float,2>{0.268405855f, 0.114770249f},
-std::array<float,2>{0.769888639f, 0.975833893f},
-std::array<float,2>{0.50377661f, 0.271256894f},
-std::array<float,2>{0.143493354f, 0.687575758f},
-std::array<float,2>{0.0551895611f, 0.0376287177f},
-std::array<float,2>{0.725230634f, 0.891792715f},
-std::array<float,2>{0.982508957f, 0.343589395f},
-std::array<float,2>{0.431059957f, 0.629040599f},
-std::array<float,2>{0.366725355f, 0.383719921f},
-std::array<float,2>{0.840472281f, 0.573569715f},
-std::array<float,2>{0.620859683f, 0.203257233f},
-std::array<float,2>{0.236960232f, 0.790628254f},
-std::array<float,2>{0.186218083f, 0.297915608f},
-std::array<float,2>{0.540446818f, 0.736105919f},
-std::array<float,2>{0.797022045f, 0.0869505629f},
-std::array<float,2>{0.311909288f, 0.962621987f},
-std::array<float,2>{0.479265928f, 0.140289217f},
-std::array<float,2>{0.889384806f, 0.819051504f},
-std::array<float,2>{0.638662577f, 0.49880293f},
-std::array<float,2>{0.109378554f, 0.518850744f},
-std::array<float,2>{0.0239871014f, 0.215844691f},
-std::array<float,2>{0.696023285f, 0.783491135f},
-std::array<float,2>{0.957028568f, 0.375932217f},
-std::array<float,2>{0.38653487f, 0.565711915f},
-std::array<float,2>{0.332654804f, 0.334131896f},
-std::array<float,2>{0.852507412f, 0.63979274f},
-std::array<float,2>{0.587819755f, 0.0460176915f},
-std::array<float,2>{0.206695646f, 0.90291059f},
-std::array<float,2>{0.149109319f, 0.489773512f},
-std::array<float,2>{0.511493683f, 0.526101351f},
-std::array<float,2>{0.78044641f, 0.129882827f},
-std::array<float,2>{0.277695119f, 0.82528758f},
-std::array<float,2>{0.46590516f, 0.0856298134f},
-std::array<float,2>{0.908848166f, 0.954512477f},
-std::array<float,2>{0.670750439f, 0.312089086f},
-std::array<float,2>{0.0824121609f, 0.746226847f},
-std::array<float,2>{0.244567737f, 0.0229052138f},
-std::array<float,2>{0.613455713f, 0.914998651f},
-std::array<float,2>{0.828632414f, 0.368241012f},
-std::array<float,2>{0.3686077f, 0.685095251f},
-std::array<float,2>{0.422357351f, 0.433594167f},
-std::array<float,2>{0.971632481f, 0.597003281f},
-std::array<float,2>{0.732588291f, 0.223594368f},
-std::array<float,2>{0.0483271107f, 0.772391677f},
-std::array<float,2>{0.123459712f, 0.276175171f},
-std::array<float,2>{0.627688169f, 0.697478831f},
-std::array<float,2>{0.876779914f, 0.119883209f},
-std::array<float,2>{0.47355175f, 0.980384648f},
-std::array<float,2>{0.30015406f, 0.175002009f},
-std::array<float,2>{0.809014738f, 0.849044263f},
-std::array<float,2>{0.535128653f, 0.443493307f},
-std::array<float,2>{0.176411703f, 0.547447383f},
-std::array<float,2>{0.167510629f, 0.154188707f},
-std::array<float,2>{0.559451997f, 0.83185637f},
-std::array<float,2>{0.791587412f, 0.477138102f},
-std::array<float,2>{0.285833508f, 0.506464362f},
-std::array<float,2>{0.499403238f, 0.284746677f},
-std::array<float,2>{0.902638376f, 0.724363744f},
-std::array<float,2>{0.645599484f, 0.0710377693f},
-std::array<float,2>{0.103076942f, 0.940797329f},
-std::array<float,2>{0.0358626172f, 0.404441655f},
-std::array<float,2>{0.747704744f, 0.58008492f},
-std::array<float,2>{0.988378763f, 0.188529924f},
-std::array<float,2>{0.411887795f, 0.806320846f},
-std::array<float,2>{0.354526669f, 0.0548108183f},
-std::array<float,2>{0.824341357f, 0.89052844f},
-std::array<float,2>{0.595827341f, 0.324083924f},
-std::array<float,2>{0.219288945f, 0.656026721f},
-std::array<float,2>{0.0637904108f, 0.0976567194f},
-std::array<float,2>{0.679341555f, 0.999491036f},
-std::array<float,2>{0.924939811f, 0.257247895f},
-std::array<float,2>{0.446732134f, 0.718631268f},
-std::array<float,2>{0.256059647f, 0.46077022f},
-std::array<float,2>{0.751296341f, 0.543794811f},
-std::array<float,2>{0.520945072f, 0.170333505f},
-std::array<float,2>{0.129145831f, 0.861087561f},
-std::array<float,2>{0.201230228f, 0.349547774f},
-std::array<float,2>{0.562875509f, 0.660467803f},
-std::array<float,2>{0.860364199f, 0.015202783f},
-std::array<float,2>{0.319735795f, 0.931880474f},
-std::array<float,2>{0.392777532f, 0.240418285f},
-std::array<float,2>{0.943873227f, 0.756948709f},
-std::array<float,2>{0.716771185f, 0.41285032f},
-std::array<float,2>{0.00930381007f, 0.610773802f},
-std::array<float,2>{0.115756236f, 0.237268195f},
-std::array<float,2>{0.632863045f, 0.752120018f},
-std::array<float,2>{0.886638403f, 0.410034508f},
-std::array<float,2>{0.481573254f, 0.616379321f},
-std::array<float,2>{0.307181954f, 0.345842063f},
-std::array<float,2>{0.801708221f, 0.65830344f},
-std::array<float,2>{0.545396686f, 0.011187369f},
-std::array<float,2>{0.180219814f, 0.934783757f},
-std::array<float,2>{0.238586903f, 0.455338895f},
-std::array<float,2>{0.624970973f, 0.542806804f},
-std::array<float,2>{0.838213384f, 0.166726291f},
-std::array<float,2>{0.360693663f, 0.866423011f},
-std::array<float,2>{0.435365379f, 0.0958035141f},
-std::array<float,2>{0.978546977f, 0.995926321f},
-std::array<float,2>{0.718847454f, 0.251691043f},
-std::array<float,2>{0.0617531538f, 0.712162018f},
-std::array<float,2>{0.145891219f, 0.0622189455f},
-std::array<float,2>{0.505596697f, 0.88556391f},
-std::array<float,2>{0.76690203f, 0.326259404f},
-std::array<float,2>{0.270396382f, 0.649801254f},
-std::array<float,2>{0.459516615f, 0.400415003f},
-std::array<float,2>{0.920220077f, 0.584933579f},
-std::array<float,2>{0.657438099f, 0.193722501f},
-std::array<float,2>{0.0919215605f, 0.811961293f},
-std::array<float,2>{0.0174600985f, 0.285499603f},
-std::array<float,2>{0.689469874f, 0.721819162f},
-std::array<float,2>{0.968606412f, 0.0758232325f},
-std::array<float,2>{0.382689863f, 0.944716334f},
-std::array<float,2>{0.340243101f, 0.15176335f},
-std::array<float,2>{0.848078847f, 0.832374394f},
-std::array<float,2>{0.583865941f, 0.483139932f},
-std::array<float,2>{0.21334973f, 0.501019478f},
-std::array<float,2>{0.189306974f, 0.175834388f},
-std::array<float,2>{0.577639759f, 0.845877707f},
-std::array<float,2>{0.867584109f, 0.440290838f},
-std::array<float,2>{0.320809722f, 0.554251611f},
-std::array<float,2>{0.403580904f, 0.278605133f},
-std::array<float,2>{0.9519732f, 0.702592254f},
-std::array<float,2>{0.710070848f, 0.124222361f},
-std::array<float,2>{0.00531823514f, 0.980637729f},
-std::array<float,2>{0.0740097165f, 0.433188379f},
-std::array<float,2>{0.682507575f, 0.601106167f},
-std::array<float,2>{0.935670376f, 0.221543431f},
-std::array<float,2>{0.440788507f, 0.766608179f},
-std::array<float,2>{0.258079827f, 0.0187123399f},
-std::array<float,2>{0.761001527f, 0.920686901f},
-std::array<float,2>{0.529705346f, 0.374266475f},
-std::array<float,2>{0.140519351f, 0.680302262f},
-std::array<float,2>{0.040306326f, 0.0815112665f},
-std::array<float,2>{0.738204896f, 0.958452642f},
-std::array<float,2>{0.993529499f, 0.305381119f},
-std::array<float,2>{0.418822289f, 0.745418251f},
-std::array<float,2>{0.350321203f, 0.48485738f},
-std::array<float,2>{0.816145122f, 0.530318141f},
-std::array<float,2>{0.602620125f, 0.128435329f},
-std::array<float,2>{0.2285157f, 0.821841002f},
-std::array<float,2>{0.164043337f, 0.330246389f},
-std::array<float,2>{0.547548354f, 0.636252105f},
-std::array<float,2>{0.784753263f, 0.041885037f},
-std::array<float,2>{0.290111423f, 0.89882654f},
-std::array<float,2>{0.484930903f, 0.21299611f},
-std::array<float,2>{0.891744256f, 0.786424518f},
-std::array<float,2>{0.651124656f, 0.380376786f},
-std::array<float,2>{0.101387687f, 0.568266869f},
-std::array<float,2>{0.0152428327f, 0.134742647f},
-std::array<float,2>{0.714452803f, 0.814336777f},
-std::array<float,2>{0.938406467f, 0.493588984f},
-std::array<float,2>{0.39698258f, 0.523186207f},
-std::array<float,2>{0.313584387f, 0.301695138f},
-std::array<float,2>{0.865413427f, 0.741119266f},
-std::array<float,2>{0.566735566f, 0.0904717147f},
-std::array<float,2>{0.197205245f, 0.966338575f},
-std::array<float,2>{0.127370402f, 0.388059437f},
-std::array<float,2>{0.517361045f, 0.577754855f},
-std::array<float,2>{0.756802678f, 0.208580449f},
-std::array<float,2>{0.251222879f, 0.794289529f},
-std::array<float,2>{0.453001827f, 0.0343406722f},
-std::array<float,2>{0.92924422f, 0.896130681f},
-std::array<float,2>{0.675479054f, 0.339682728f},
-std::array<float,2>{0.0686014518f, 0.628903031f},
-std::array<float,2>{0.224629f, 0.109954692f},
-std::array<float,2>{0.598597765f, 0.968757153f},
-std::array<float,2>{0.821999848f, 0.269391894f},
-std::array<float,2>{0.356492311f, 0.692388296f},
-std::array<float,2>{0.406440645f, 0.447851211f},
-std::array<float,2>{0.984480202f, 0.557282925f},
-std::array<float,2>{0.744121313f, 0.180217296f},
-std::array<float,2>{0.0345121212f, 0.855738878f},
-std::array<float,2>{0.107803613f, 0.363171399f},
-std::array<float,2>{0.642634869f, 0.677488923f},
-std::array<float,2>{0.899947882f, 0.0283462238f},
-std::array<float,2>{0.49479866f, 0.911879897f},
-std::array<float,2>{0.282848686f, 0.228527725f},
-std::array<float,2>{0.796196222f, 0.780013025f},
-std::array<float,2>{0.558522046f, 0.422856897f},
-std::array<float,2>{0.169279963f, 0.608767629f},
-std::array<float,2>{0.173153609f, 0.199791625f},
-std::array<float,2>{0.537740648f, 0.79839313f},
-std::array<float,2>{0.807983994f, 0.397068322f},
-std::array<float,2>{0.301290542f, 0.587884963f},
-std::array<float,2>{0.469675958f, 0.320061982f},
-std::array<float,2>{0.881982327f, 0.641710222f},
-std::array<float,2>{0.630415201f, 0.0475658663f},
-std::array<float,2>{0.119599909f, 0.881317794f},
-std::array<float,2>{0.0532219522f, 0.473762155f},
-std::array<float,2>{0.728838146f, 0.509552538f},
-std::array<float,2>{0.974501014f, 0.148426473f},
-std::array<float,2>{0.4282372f, 0.837800324f},
-std::array<float,2>{0.37326771f, 0.0666004196f},
-std::array<float,2>{0.835756123f, 0.952256382f},
-std::array<float,2>{0.612520456f, 0.296274513f},
-std::array<float,2>{0.247373655f, 0.73219502f},
-std::array<float,2>{0.079394497f, 0.00423987256f},
-std::array<float,2>{0.665523052f, 0.927432954f},
-std::array<float,2>{0.91273284f, 0.355464548f},
-std::array<float,2>{0.463674486f, 0.666531503f},
-std::array<float,2>{0.274787337f, 0.421502411f},
-std::array<float,2>{0.776611745f, 0.619547963f},
-std::array<float,2>{0.515193999f, 0.242260173f},
-std::array<float,2>{0.154839441f, 0.764125526f},
-std::array<float,2>{0.208876088f, 0.258617908f},
-std::array<float,2>{0.591315567f, 0.706129611f},
-std::array<float,2>{0.858444929f, 0.10551165f},
-std::array<float,2>{0.330302209f, 0.985203743f},
-std::array<float,2>{0.390592217f, 0.157721505f},
-std::array<float,2>{0.960840225f, 0.872454345f},
-std::array<float,2>{0.699926674f, 0.460944444f},
-std::array<float,2>{0.0288518053f, 0.538699269f},
-std::array<float,2>{0.0658304393f, 0.170767814f},
-std::array<float,2>{0.676666439f, 0.860682786f},
-std::array<float,2>{0.923649192f, 0.460292876f},
-std::array<float,2>{0.447911352f, 0.543403208f},
-std::array<float,2>{0.254669636f, 0.257804632f},
-std::array<float,2>{0.7538746f, 0.718209684f},
-std::array<float,2>{0.522175372f, 0.0984037742f},
-std::array<float,2>{0.132598534f, 0.999551773f},
-std::array<float,2>{0.200760156f, 0.412350565f},
-std::array<float,2>{0.565701067f, 0.611125827f},
-std::array<float,2>{0.863065958f, 0.240902886f},
-std::array<float,2>{0.318214089f, 0.757608235f},
-std::array<float,2>{0.392004728f, 0.0150830541f},
-std::array<float,2>{0.943346918f, 0.932557583f},
-std::array<float,2>{0.71784544f, 0.3490327f},
-std::array<float,2>{0.0110523868f, 0.660989583f},
-std::array<float,2>{0.164527267f, 0.0706099272f},
-std::array<float,2>{0.562312543f, 0.941234648f},
-std::array<float,2>{0.789320767f, 0.284352839f},
-std::array<float,2>{0.288145483f, 0.72399956f},
-std::array<float,2>{0.496453345f, 0.476893991f},
-std::array<float,2>{0.905667901f, 0.506035686f},
-std::array<float,2>{0.647158265f, 0.15373902f},
-std::array<float,2>{0.104870506f, 0.831103086f},
-std::array<float,2>{0.0373837687f, 0.323449314f},
-std::array<float,2>{0.749795973f, 0.655711293f},
-std::array<float,2>{0.990871191f, 0.0554135703f},
-std::array<float,2>{0.413650602f, 0.889818728f},
-std::array<float,2>{0.353198349f, 0.189397022f},
-std::array<float,2>{0.827277958f, 0.805967987f},
-std::array<float,2>{0.594554007f, 0.405134737f},
-std::array<float,2>{0.222421154f, 0.580943048f},
-std::array<float,2>{0.243717581f, 0.222827956f},
-std::array<float,2>{0.615715265f, 0.771527231f},
-std::array<float,2>{0.831731737f, 0.434313625f},
-std::array<float,2>{0.370764017f, 0.597474873f},
-std::array<float,2>{0.42542851f, 0.368680805f},
-std::array<float,2>{0.969429433f, 0.684869349f},
-std::array<float,2>{0.730482996f, 0.0230627656f},
-std::array<float,2>{0.0504697412f, 0.914541006f},
-std::array<float,2>{0.122253746f, 0.444262832f},
-std::array<float,2>{0.626042783f, 0.54732734f},
-std::array<float,2>{0.878041506f, 0.175341949f},
-std::array<float,2>{0.476078361f, 0.849258125f},
-std::array<float,2>{0.297715873f, 0.119429231f},
-std::array<float,2>{0.812147498f, 0.97989136f},
-std::array<float,2>{0.532470405f, 0.275714159f},
-std::array<float,2>{0.178253785f, 0.697766006f},
-std::array<float,2>{0.0257933345f, 0.0466836765f},
-std::array<float,2>{0.698103845f, 0.902694762f},
-std::array<float,2>{0.953789175f, 0.334558278f},
-std::array<float,2>{0.383897752f, 0.640440822f},
-std::array<float,2>{0.33413738f, 0.375082135f},
-std::array<float,2>{0.853560567f, 0.566390753f},
-std::array<float,2>{0.588260114f, 0.216792166f},
-std::array<float,2>{0.204500094f, 0.783807516f},
-std::array<float,2>{0.151168093f, 0.31159243f},
-std::array<float,2>{0.507873595f, 0.746692181f},
-std::array<float,2>{0.778697133f, 0.0851006582f},
-std::array<float,2>{0.279813677f, 0.955049574f},
-std::array<float,2>{0.468427479f, 0.130493313f},
-std::array<float,2>{0.908151805f, 0.825732529f},
-std::array<float,2>{0.669038773f, 0.489421129f},
-std::array<float,2>{0.0851429477f, 0.525478601f},
-std::array<float,2>{0.0570291542f, 0.203762785f},
-std::array<float,2>{0.724049211f, 0.790210068f},
-std::array<float,2>{0.98129338f, 0.382873595f},
-std::array<float,2>{0.432186335f, 0.573844135f},
-std::array<float,2>{0.363426983f, 0.342820585f},
-std::array<float,2>{0.842300236f, 0.629478574f},
-std::array<float,2>{0.61722225f, 0.037145365f},
-std::array<float,2>{0.236092225f, 0.892114818f},
-std::array<float,2>{0.184972778f, 0.498160422f},
-std::array<float,2>{0.541723192f, 0.519192457f},
-std::array<float,2>{0.800618589f, 0.139893159f},
-std::array<float,2>{0.309526831f, 0.818779171f},
-std::array<float,2>{0.477547646f, 0.0877775103f},
-std::array<float,2>{0.886746287f, 0.962373972f},
-std::array<float,2>{0.63968724f, 0.298637569f},
-std::array<float,2>{0.111840643f, 0.735396624f},
-std::array<float,2>{0.21676825f, 0.024733888f},
-std::array<float,2>{0.581569314f, 0.908143997f},
-std::array<float,2>{0.847499907f, 0.364625305f},
-std::array<float,2>{0.338683903f, 0.671898067f},
-std::array<float,2>{0.376435727f, 0.42966339f},
-std::array<float,2>{0.964264035f, 0.60245508f},
-std::array<float,2>{0.693526983f, 0.230770662f},
-std::array<float,2>{0.0221811887f, 0.774652243f},
-std::array<float,2>{0.0867525116f, 0.270635456f},
-std::array<float,2>{0.662230849f, 0.688093662f},
-std::array<float,2>{0.917612135f, 0.114386834f},
-std::array<float,2>{0.454398423f, 0.976453185f},
-std::array<float,2>{0.265916884f, 0.18485105f},
-std::array<float,2>{0.773003936f, 0.852834225f},
-std::array<float,2>{0.500370204f, 0.45223999f},
-std::array<float,2>{0.140979126f, 0.560271978f},
-std::array<float,2>{0.136528239f, 0.144130126f},
-std::array<float,2>{0.524122775f, 0.841543138f},
-std::array<float,2>{0.761905551f, 0.469416231f},
-std::array<float,2>{0.264748186f, 0.513479531f},
-std::array<float,2>{0.443615228f, 0.292952359f},
-std::array<float,2>{0.931094229f, 0.729614258f},
-std::array<float,2>{0.687487304f, 0.0660614744f},
-std::array<float,2>{0.0777482986f, 0.947004914f},
-std::array<float,2>{0.0025155833f, 0.393523514f},
-std::array<float,2>{0.705754519f, 0.592997313f},
-std::array<float,2>{0.949076474f, 0.197440147f},
-std::array<float,2>{0.402293742f, 0.802353561f},
-std::array<float,2>{0.325275362f, 0.0528283045f},
-std::array<float,2>{0.874034703f, 0.875074565f},
-std::array<float,2>{0.572577f, 0.315851957f},
-std::array<float,2>{0.195143551f, 0.644739091f},
-std::array<float,2>{0.0950015783f, 0.103721581f},
-std::array<float,2>{0.654948473f, 0.991695583f},
-std::array<float,2>{0.896839082f, 0.264266461f},
-std::array<float,2>{0.490086824f, 0.708548784f},
-std::array<float,2>{0.296212971f, 0.468213975f},
-std::array<float,2>{0.789007962f, 0.534760535f},
-std::array<float,2>{0.552149594f, 0.162596077f},
-std::array<float,2>{0.158389494f, 0.870357871f},
-std::array<float,2>{0.232888862f, 0.356779575f},
-std::array<float,2>{0.608264565f, 0.670662701f},
-std::array<float,2>{0.816888034f, 0.00289825932f},
-std::array<float,2>{0.347447962f, 0.924559593f},
-std::array<float,2>{0.416697592f, 0.249319449f},
-std::array<float,2>{0.99838227f, 0.759217322f},
-std::array<float,2>{0.739558399f, 0.4156501f},
-std::array<float,2>{0.0436457172f, 0.623294175f},
-std::array<float,2>{0.0906232595f, 0.192174405f},
-std::array<float,2>{0.658807456f, 0.809672892f},
-std::array<float,2>{0.919276953f, 0.400222123f},
-std::array<float,2>{0.458401233f, 0.583669662f},
-std::array<float,2>{0.272899002f, 0.324876159f},
-std::array<float,2>{0.768500447f, 0.651321828f},
-std::array<float,2>{0.506031156f, 0.0604436249f},
-std::array<float,2>{0.148115203f, 0.883084595f},
-std::array<float,2>{0.211743087f, 0.481152654f},
-std::array<float,2>{0.584245682f, 0.503367662f},
-std::array<float,2>{0.849733233f, 0.14886722f},
-std::array<float,2>{0.343207806f, 0.834364235f},
-std::array<float,2>{0.379168481f, 0.0774815977f},
-std::array<float,2>{0.964969993f, 0.941514194f},
-std::array<float,2>{0.688633323f, 0.287518084f},
-std::array<float,2>{0.0186912213f, 0.719934106f},
-std::array<float,2>{0.183172092f, 0.00828489661f},
-std::array<float,2>{0.544349074f, 0.935673594f},
-std::array<float,2>{0.80388701f, 0.344806731f},
-std::array<float,2>{0.306176811f, 0.656782269f},
-std::array<float,2>{0.483813792f, 0.407240093f},
-std::array<float,2>{0.883151174f, 0.613754928f},
-std::array<float,2>{0.635378063f, 0.236241475f},
-std::array<float,2>{0.113764822f, 0.751032174f},
-std::array<float,2>{0.0586175285f, 0.252939641f},
-std::array<float,2>{0.721267343f, 0.714319646f},
-std::array<float,2>{0.978082955f, 0.0946202651f},
-std::array<float,2>{0.436609328f, 0.992632985f},
-std::array<float,2>{0.361667007f, 0.164178789f},
-std::array<float,2>{0.837260723f, 0.864152908f},
-std::array<float,2>{0.621252f, 0.455047011f},
-std::array<float,2>{0.240954891f, 0.540205061f},
-std::array<float,2>{0.228100166f, 0.126085907f},
-std::array<float,2>{0.605037332f, 0.823967814f},
-std::array<float,2>{0.813811958f, 0.487562239f},
-std::array<float,2>{0.348916799f, 0.529144406f},
-std::array<float,2>{0.420345187f, 0.30671382f},
-std::array<float,2>{0.995064437f, 0.744137287f},
-std::array<float,2>{0.736021042f, 0.0799062923f},
-std::array<float,2>{0.0423695669f, 0.958988488f},
-std::array<float,2>{0.0981403589f, 0.381578863f},
-std::array<float,2>{0.649421573f, 0.569660366f},
-std::array<float,2>{0.893335283f, 0.211935967f},
-std::array<float,2>{0.48724103f, 0.788636565f},
-std::array<float,2>{0.2922692f, 0.0392347984f},
-std::array<float,2>{0.781626999f, 0.901236475f},
-std::array<float,2>{0.549081087f, 0.329909831f},
-std::array<float,2>{0.161823228f, 0.634757698f},
-std::array<float,2>{0.00658341823f, 0.12111669f},
-std::array<float,2>{0.707956016f, 0.982688129f},
-std::array<float,2>{0.949341178f, 0.279850692f},
-std::array<float,2>{0.405423522f, 0.701106489f},
-std::array<float,2>{0.32330519f, 0.439061522f},
-std::array<float,2>{0.869319677f, 0.551338434f},
-std::array<float,2>{0.575569332f, 0.179335177f},
-std::array<float,2>{0.190603703f, 0.844806075f},
-std::array<float,2>{0.137283146f, 0.372561961f},
-std::array<float,2>{0.528702736f, 0.683521628f},
-std::array<float,2>{0.759253442f, 0.017149888f},
-std::array<float,2>{0.26042217f, 0.917983234f},
-std::array<float,2>{0.438627213f, 0.220255494f},
-std::array<float,2>{0.934555829f, 0.767882526f},
-std::array<float,2>{0.681028068f, 0.430490255f},
-std::array<float,2>{0.0704320893f, 0.59806776f},
-std::array<float,2>{0.0315727517f, 0.18310985f},
-std::array<float,2>{0.745452523f, 0.858922362f},
-std::array<float,2>{0.986596942f, 0.446463138f},
-std::array<float,2>{0.408307999f, 0.555666983f},
-std::array<float,2>{0.35799107f, 0.266021132f},
-std::array<float,2>{0.823064327f, 0.693389773f},
-std::array<float,2>{0.600000858f, 0.11316558f},
-std::array<float,2>{0.224079698f, 0.971857965f},
-std::array<float,2>{0.1704676f, 0.425395936f},
-std::array<float,2>{0.554986835f, 0.605706632f},
-std::array<float,2>{0.793387711f, 0.227065429f},
-std::array<float,2>{0.284037471f, 0.777999282f},
-std::array<float,2>{0.49397254f, 0.0297853127f},
-std::array<float,2>{0.902032137f, 0.913349092f},
-std::array<float,2>{0.642352045f, 0.359465331f},
-std::array<float,2>{0.10589812f, 0.679466605f},
-std::array<float,2>{0.198661312f, 0.0923231244f},
-std::array<float,2>{0.569048584f, 0.967214167f},
-std::array<float,2>{0.863342464f, 0.303880423f},
-std::array<float,2>{0.315833777f, 0.73921895f},
-std::array<float,2>{0.395162016f, 0.495875269f},
-std::array<float,2>{0.939956725f, 0.519618332f},
-std::array<float,2>{0.711777389f, 0.135218933f},
-std::array<float,2>{0.0128537975f, 0.81535095f},
-std::array<float,2>{0.0667270347f, 0.336013168f},
-std::array<float,2>{0.673434079f, 0.626487792f},
-std::array<float,2>{0.927625835f, 0.0313982628f},
-std::array<float,2>{0.449291676f, 0.896888256f},
-std::array<float,2>{0.252524436f, 0.209672019f},
-std::array<float,2>{0.755413473f, 0.796265721f},
-std::array<float,2>{0.517955065f, 0.389418393f},
-std::array<float,2>{0.126780882f, 0.575344265f},
-std::array<float,2>{0.153227389f, 0.244544193f},
-std::array<float,2>{0.513657987f, 0.763038933f},
-std::array<float,2>{0.774667144f, 0.41954875f},
-std::array<float,2>{0.277106762f, 0.618305206f},
-std::array<float,2>{0.46114862f, 0.353170365f},
-std::array<float,2>{0.911259949f, 0.665996194f},
-std::array<float,2>{0.667030513f, 0.00704150321f},
-std::array<float,2>{0.0814453289f, 0.927877605f},
-std::array<float,2>{0.0308312606f, 0.464174271f},
-std::array<float,2>{0.701430202f, 0.536696315f},
-std::array<float,2>{0.957093f, 0.158609301f},
-std::array<float,2>{0.38775754f, 0.873239696f},
-std::array<float,2>{0.328177363f, 0.108285993f},
-std::array<float,2>{0.856318951f, 0.987843931f},
-std::array<float,2>{0.591940284f, 0.260115564f},
-std::array<float,2>{0.209126905f, 0.704751194f},
-std::array<float,2>{0.118235081f, 0.0493855923f},
-std::array<float,2>{0.632118523f, 0.879625857f},
-std::array<float,2>{0.880272985f, 0.317880958f},
-std::array<float,2>{0.471847951f, 0.642633498f},
-std::array<float,2>{0.304447323f, 0.396203578f},
-std::array<float,2>{0.805834055f, 0.589813948f},
-std::array<float,2>{0.536935031f, 0.201738328f},
-std::array<float,2>{0.175177962f, 0.800305724f},
-std::array<float,2>{0.248765126f, 0.293668866f},
-std::array<float,2>{0.610782444f, 0.732790828f},
-std::array<float,2>{0.832817197f, 0.0695428476f},
-std::array<float,2>{0.371466756f, 0.949405015f},
-std::array<float,2>{0.427437007f, 0.145875588f},
-std::array<float,2>{0.975619495f, 0.839434147f},
-std::array<float,2>{0.728159428f, 0.476356298f},
-std::array<float,2>{0.0515538752f, 0.510025501f},
-std::array<float,2>{0.102948874f, 0.155192614f},
-std::array<float,2>{0.646119595f, 0.829222381f},
-std::array<float,2>{0.902992666f, 0.479504824f},
-std::array<float,2>{0.499998778f, 0.504031956f},
-std::array<float,2>{0.28519091f, 0.28312993f},
-std::array<float,2>{0.791501343f, 0.72501713f},
-std::array<float,2>{0.558943152f, 0.0737205073f},
-std::array<float,2>{0.167465851f, 0.937903762f},
-std::array<float,2>{0.219019279f, 0.402867883f},
-std::array<float,2>{0.596573353f, 0.579988062f},
-std::array<float,2>{0.825126112f, 0.191148981f},
-std::array<float,2>{0.355073243f, 0.806945562f},
-std::array<float,2>{0.411161274f, 0.0584916361f},
-std::array<float,2>{0.988996744f, 0.88833952f},
-std::array<float,2>{0.747275472f, 0.321764559f},
-std::array<float,2>{0.0354785137f, 0.653376877f},
-std::array<float,2>{0.129877418f, 0.100829966f},
-std::array<float,2>{0.521086395f, 0.997845054f},
-std::array<float,2>{0.75156635f, 0.255699635f},
-std::array<float,2>{0.25670889f, 0.715394258f},
-std::array<float,2>{0.44702521f, 0.458623797f},
-std::array<float,2>{0.925355971f, 0.54614383f},
-std::array<float,2>{0.679142237f, 0.169676393f},
-std::array<float,2>{0.0640007108f, 0.86263746f},
-std::array<float,2>{0.00898875576f, 0.350022584f},
-std::array<float,2>{0.71618104f, 0.663165629f},
-std::array<float,2>{0.94381237f, 0.0133457258f},
-std::array<float,2>{0.393324584f, 0.931591988f},
-std::array<float,2>{0.32023114f, 0.239369631f},
-std::array<float,2>{0.861095369f, 0.755132139f},
-std::array<float,2>{0.563280642f, 0.410798222f},
-std::array<float,2>{0.201963589f, 0.612036169f},
-std::array<float,2>{0.206111044f, 0.218422875f},
-std::array<float,2>{0.587207973f, 0.782645226f},
-std::array<float,2>{0.851806223f, 0.377419174f},
-std::array<float,2>{0.332338899f, 0.563502371f},
-std::array<float,2>{0.386165619f, 0.333599985f},
-std::array<float,2>{0.956335366f, 0.637634814f},
-std::array<float,2>{0.695319355f, 0.0441830605f},
-std::array<float,2>{0.0237977151f, 0.905206919f},
-std::array<float,2>{0.0826907605f, 0.49104023f},
-std::array<float,2>{0.670018077f, 0.52404815f},
-std::array<float,2>{0.908474922f, 0.130882323f},
-std::array<float,2>{0.466786116f, 0.826642275f},
-std::array<float,2>{0.277924508f, 0.0833692402f},
-std::array<float,2>{0.781037033f, 0.957009792f},
-std::array<float,2>{0.51119262f, 0.308742791f},
-std::array<float,2>{0.148903742f, 0.74956131f},
-std::array<float,2>{0.0487619638f, 0.0205630027f},
-std::array<float,2>{0.73318994f, 0.91740495f},
-std::array<float,2>{0.971021771f, 0.369644165f},
-std::array<float,2>{0.422804236f, 0.686390638f},
-std::array<float,2>{0.369065344f, 0.436120123f},
-std::array<float,2>{0.828545511f, 0.594395518f},
-std::array<float,2>{0.614069045f, 0.225487739f},
-std::array<float,2>{0.244674981f, 0.769872606f},
-std::array<float,2>{0.175852418f, 0.273695737f},
-std::array<float,2>{0.534427941f, 0.696579814f},
-std::array<float,2>{0.809484959f, 0.118762374f},
-std::array<float,2>{0.300644189f, 0.977422833f},
-std::array<float,2>{0.472953737f, 0.173330575f},
-std::array<float,2>{0.876197457f, 0.851527691f},
-std::array<float,2>{0.627139032f, 0.441830248f},
-std::array<float,2>{0.123938501f, 0.549967706f},
-std::array<float,2>{0.0197036229f, 0.234104127f},
-std::array<float,2>{0.691758275f, 0.777304351f},
-std::array<float,2>{0.962097287f, 0.427502722f},
-std::array<float,2>{0.377494007f, 0.603895247f},
-std::array<float,2>{0.336415589f, 0.367044479f},
-std::array<float,2>{0.844860673f, 0.675653636f},
-std::array<float,2>{0.578809023f, 0.0259776395f},
-std::array<float,2>{0.217963904f, 0.909897923f},
-std::array<float,2>{0.143047094f, 0.450532794f},
-std::array<float,2>{0.503187954f, 0.562215745f},
-std::array<float,2>{0.770369351f, 0.186258867f},
-std::array<float,2>{0.268018305f, 0.85451287f},
-std::array<float,2>{0.456599981f, 0.117027983f},
-std::array<float,2>{0.914526045f, 0.974089921f},
-std::array<float,2>{0.660417438f, 0.272508442f},
-std::array<float,2>{0.0887984037f, 0.689813018f},
-std::array<float,2>{0.236632764f, 0.0360016264f},
-std::array<float,2>{0.620493531f, 0.894026577f},
-std::array<float,2>{0.840140522f, 0.341488123f},
-std::array<float,2>{0.366298407f, 0.631037474f},
-std::array<float,2>{0.431351185f, 0.386045426f},
-std::array<float,2>{0.983296454f, 0.570964217f},
-std::array<float,2>{0.724775732f, 0.206626251f},
-std::array<float,2>{0.0551029593f, 0.792630196f},
-std::array<float,2>{0.110309854f, 0.299434692f},
-std::array<float,2>{0.637911677f, 0.736782014f},
-std::array<float,2>{0.888724566f, 0.0885878727f},
-std::array<float,2>{0.478933364f, 0.964084804f},
-std::array<float,2>{0.312413096f, 0.13760677f},
-std::array<float,2>{0.797818065f, 0.818147957f},
-std::array<float,2>{0.540773213f, 0.497621685f},
-std::array<float,2>{0.185772225f, 0.51662612f},
-std::array<float,2>{0.156299263f, 0.160622969f},
-std::array<float,2>{0.552966654f, 0.868918538f},
-std::array<float,2>{0.786583006f, 0.465480268f},
-std::array<float,2>{0.293851197f, 0.532211721f},
-std::array<float,2>{0.490795404f, 0.261958867f},
-std::array<float,2>{0.894636691f, 0.709379017f},
-std::array<float,2>{0.652435482f, 0.101937264f},
-std::array<float,2>{0.0968735665f, 0.989553809f},
-std::array<float,2>{0.0459718443f, 0.41760838f},
-std::array<float,2>{0.740384638f, 0.622063398f},
-std::array<float,2>{0.996224523f, 0.246975914f},
-std::array<float,2>{0.414798141f, 0.760899723f},
-std::array<float,2>{0.3445476f, 0.000103300343f},
-std::array<float,2>{0.818536639f, 0.923363805f},
-std::array<float,2>{0.60655117f, 0.35751456f},
-std::array<float,2>{0.231610999f, 0.66928339f},
-std::array<float,2>{0.0744263008f, 0.063364841f},
-std::array<float,2>{0.684263885f, 0.948665738f},
-std::array<float,2>{0.933051467f, 0.290747285f},
-std::array<float,2>{0.442037016f, 0.728111207f},
-std::array<float,2>{0.262419552f, 0.470755935f},
-std::array<float,2>{0.765031695f, 0.515003204f},
-std::array<float,2>{0.526487827f, 0.142067984f},
-std::array<float,2>{0.134459749f, 0.843527973f},
-std::array<float,2>{0.191470414f, 0.31350553f},
-std::array<float,2>{0.571490467f, 0.646841168f},
-std::array<float,2>{0.872813582f, 0.0520934574f},
-std::array<float,2>{0.326904327f, 0.877647758f},
-std::array<float,2>{0.400265396f, 0.196165845f},
-std::array<float,2>{0.945514917f, 0.803005397f},
-std::array<float,2>{0.704495549f, 0.390847147f},
-std::array<float,2>{0.000629565562f, 0.591411769f},
-std::array<float,2>{0.0996426716f, 0.211525545f},
-std::array<float,2>{0.651549459f, 0.787299335f},
-std::array<float,2>{0.891223848f, 0.382166773f},
-std::array<float,2>{0.485828519f, 0.569148004f},
-std::array<float,2>{0.289387047f, 0.328655511f},
-std::array<float,2>{0.783569217f, 0.632901549f},
-std::array<float,2>{0.548576951f, 0.0404446237f},
-std::array<float,2>{0.163077772f, 0.902324617f},
-std::array<float,2>{0.229987919f, 0.486565381f},
-std::array<float,2>{0.601879716f, 0.52752924f},
-std::array<float,2>{0.814902544f, 0.125113174f},
-std::array<float,2>{0.351402313f, 0.822995722f},
-std::array<float,2>{0.419498295f, 0.0782210156f},
-std::array<float,2>{0.992370129f, 0.960852921f},
-std::array<float,2>{0.737235904f, 0.307626545f},
-std::array<float,2>{0.0398060419f, 0.742452383f},
-std::array<float,2>{0.139515862f, 0.0164901949f},
-std::array<float,2>{0.530412078f, 0.919149101f},
-std::array<float,2>{0.760575473f, 0.371434212f},
-std::array<float,2>{0.259478837f, 0.682095826f},
-std::array<float,2>{0.439629316f, 0.431501955f},
-std::array<float,2>{0.937409818f, 0.599327981f},
-std::array<float,2>{0.68290776f, 0.219723895f},
-std::array<float,2>{0.0723231509f, 0.768827498f},
-std::array<float,2>{0.00448520295f, 0.281118184f},
-std::array<float,2>{0.709278584f, 0.700166941f},
-std::array<float,2>{0.952542365f, 0.122233145f},
-std::array<float,2>{0.403223664f, 0.984046578f},
-std::array<float,2>{0.321987152f, 0.178622738f},
-std::array<float,2>{0.868214667f, 0.844481587f},
-std::array<float,2>{0.577018261f, 0.437630266f},
-std::array<float,2>{0.188297465f, 0.551790833f},
-std::array<float,2>{0.214275852f, 0.149474099f},
-std::array<float,2>{0.582553387f, 0.835857511f},
-std::array<float,2>{0.848984778f, 0.482081175f},
-std::array<float,2>{0.341215611f, 0.501976252f},
-std::array<float,2>{0.381304443f, 0.288365811f},
-std::array<float,2>{0.967589557f, 0.71920681f},
-std::array<float,2>{0.691087663f, 0.0763482377f},
-std::array<float,2>{0.0163515601f, 0.942819297f},
-std::array<float,2>{0.0932831988f, 0.39910841f},
-std::array<float,2>{0.656552434f, 0.582222819f},
-std::array<float,2>{0.921391129f, 0.193171605f},
-std::array<float,2>{0.460467458f, 0.80922699f},
-std::array<float,2>{0.271029979f, 0.0592953302f},
-std::array<float,2>{0.76587832f, 0.884126186f},
-std::array<float,2>{0.50430876f, 0.325827271f},
-std::array<float,2>{0.14490366f, 0.652205527f},
-std::array<float,2>{0.060567189f, 0.0955860764f},
-std::array<float,2>{0.720074058f, 0.993631244f},
-std::array<float,2>{0.980161726f, 0.252459675f},
-std::array<float,2>{0.433822364f, 0.713184536f},
-std::array<float,2>{0.360273153f, 0.453223944f},
-std::array<float,2>{0.839746356f, 0.540027142f},
-std::array<float,2>{0.623745263f, 0.16508387f},
-std::array<float,2>{0.240042493f, 0.864404619f},
-std::array<float,2>{0.180978596f, 0.344220042f},
-std::array<float,2>{0.545985818f, 0.657886803f},
-std::array<float,2>{0.802089632f, 0.00940535031f},
-std::array<float,2>{0.30820173f, 0.937113345f},
-std::array<float,2>{0.481211692f, 0.234682187f},
-std::array<float,2>{0.885218441f, 0.750474513f},
-std::array<float,2>{0.634450257f, 0.406663597f},
-std::array<float,2>{0.116668113f, 0.614413977f},
-std::array<float,2>{0.027854979f, 0.159754187f},
-std::array<float,2>{0.700454831f, 0.874077201f},
-std::array<float,2>{0.958989263f, 0.463373125f},
-std::array<float,2>{0.389398932f, 0.536107421f},
-std::array<float,2>{0.331507415f, 0.261714011f},
-std::array<float,2>{0.857661366f, 0.703576028f},
-std::array<float,2>{0.590745628f, 0.109184317f},
-std::array<float,2>{0.207762569f, 0.986924231f},
-std::array<float,2>{0.155683666f, 0.418268114f},
-std::array<float,2>{0.514354527f, 0.617241263f},
-std::array<float,2>{0.775569856f, 0.245763332f},
-std::array<float,2>{0.274158478f, 0.761825025f},
-std::array<float,2>{0.463928878f, 0.00612253929f},
-std::array<float,2>{0.913939953f, 0.929530442f},
-std::array<float,2>{0.664752185f, 0.352172822f},
-std::array<float,2>{0.0783083513f, 0.664067686f},
-std::array<float,2>{0.24676089f, 0.0693082884f},
-std::array<float,2>{0.611753106f, 0.950740814f},
-std::array<float,2>{0.834254205f, 0.294149548f},
-std::array<float,2>{0.374718338f, 0.733757973f},
-std::array<float,2>{0.429576218f, 0.47501865f},
-std::array<float,2>{0.972983301f, 0.511683524f},
-std::array<float,2>{0.730210185f, 0.144578308f},
-std::array<float,2>{0.054330077f, 0.838403046f},
-std::array<float,2>{0.120991945f, 0.316849023f},
-std::array<float,2>{0.629159868f, 0.644059241f},
-std::array<float,2>{0.880877733f, 0.0504820608f},
-std::array<float,2>{0.470374733f, 0.880660415f},
-std::array<float,2>{0.301758021f, 0.203074336f},
-std::array<float,2>{0.807388306f, 0.799251497f},
-std::array<float,2>{0.538279653f, 0.395137042f},
-std::array<float,2>{0.172602326f, 0.588802457f},
-std::array<float,2>{0.168916196f, 0.227763221f},
-std::array<float,2>{0.557510436f, 0.778718829f},
-std::array<float,2>{0.795022905f, 0.424699217f},
-std::array<float,2>{0.28212586f, 0.606746316f},
-std::array<float,2>{0.496074855f, 0.360853583f},
-std::array<float,2>{0.898590505f, 0.67846489f},
-std::array<float,2>{0.644101083f, 0.030320568f},
-std::array<float,2>{0.108932026f, 0.912530124f},
-std::array<float,2>{0.0338141471f, 0.446278006f},
-std::array<float,2>{0.742774189f, 0.555111945f},
-std::array<float,2>{0.98626554f, 0.182606116f},
-std::array<float,2>{0.407806545f, 0.85805589f},
-std::array<float,2>{0.355649948f, 0.11228773f},
-std::array<float,2>{0.82082504f, 0.971000552f},
-std::array<float,2>{0.599242508f, 0.267297328f},
-std::array<float,2>{0.226206854f, 0.69504106f},
-std::array<float,2>{0.0702969432f, 0.0323154069f},
-std::array<float,2>{0.673865139f, 0.897918463f},
-std::array<float,2>{0.928210378f, 0.337367505f},
-std::array<float,2>{0.451387167f, 0.625729501f},
-std::array<float,2>{0.250851601f, 0.390322655f},
-std::array<float,2>{0.756871164f, 0.575027645f},
-std::array<float,2>{0.516451061f, 0.210066199f},
-std::array<float,2>{0.128750727f, 0.795826674f},
-std::array<float,2>{0.196215466f, 0.302900672f},
-std::array<float,2>{0.568341851f, 0.739389122f},
-std::array<float,2>{0.866996884f, 0.0935071409f},
-std::array<float,2>{0.312594563f, 0.9679268f},
-std::array<float,2>{0.398166418f, 0.135901123f},
-std::array<float,2>{0.938524425f, 0.815778434f},
-std::array<float,2>{0.713210225f, 0.494801968f},
-std::array<float,2>{0.0142772011f, 0.521222413f},
-std::array<float,2>{0.0844105929f, 0.132707879f},
-std::array<float,2>{0.668030322f, 0.82798326f},
-std::array<float,2>{0.906726599f, 0.492133796f},
-std::array<float,2>{0.467559189f, 0.524746716f},
-std::array<float,2>{0.280980378f, 0.310342133f},
-std::array<float,2>{0.777867496f, 0.748879552f},
-std::array<float,2>{0.509280145f, 0.0828656182f},
-std::array<float,2>{0.151748002f, 0.955877483f},
-std::array<float,2>{0.20352748f, 0.378575861f},
-std::array<float,2>{0.589066029f, 0.5634197f},
-std::array<float,2>{0.855007172f, 0.217685163f},
-std::array<float,2>{0.335559666f, 0.781803489f},
-std::array<float,2>{0.382928312f, 0.0430714302f},
-std::array<float,2>{0.954540312f, 0.906055748f},
-std::array<float,2>{0.698813856f, 0.332966208f},
-std::array<float,2>{0.0269107502f, 0.637971818f},
-std::array<float,2>{0.179059207f, 0.117217273f},
-std::array<float,2>{0.531658411f, 0.978249311f},
-std::array<float,2>{0.810690284f, 0.274839938f},
-std::array<float,2>{0.298723578f, 0.69539398f},
-std::array<float,2>{0.474897116f, 0.442466229f},
-std::array<float,2>{0.87763536f, 0.548834741f},
-std::array<float,2>{0.625920534f, 0.172619864f},
-std::array<float,2>{0.12185923f, 0.849707365f},
-std::array<float,2>{0.0495269373f, 0.370466322f},
-std::array<float,2>{0.73150897f, 0.687457919f},
-std::array<float,2>{0.970005333f, 0.0196189899f},
-std::array<float,2>{0.424575955f, 0.916382611f},
-std::array<float,2>{0.369778723f, 0.226165101f},
-std::array<float,2>{0.830156207f, 0.770858526f},
-std::array<float,2>{0.61711514f, 0.436821073f},
-std::array<float,2>{0.242956698f, 0.594799757f},
-std::array<float,2>{0.220930338f, 0.190335482f},
-std::array<float,2>{0.595546842f, 0.808104455f},
-std::array<float,2>{0.82621783f, 0.403888941f},
-std::array<float,2>{0.352391243f, 0.578388095f},
-std::array<float,2>{0.412975192f, 0.320486397f},
-std::array<float,2>{0.991632819f, 0.652969003f},
-std::array<float,2>{0.748106956f, 0.0574831665f},
-std::array<float,2>{0.0384171903f, 0.887204885f},
-std::array<float,2>{0.103755772f, 0.478975892f},
-std::array<float,2>{0.647645056f, 0.505750597f},
-std::array<float,2>{0.904382885f, 0.155459493f},
-std::array<float,2>{0.497803777f, 0.829085886f},
-std::array<float,2>{0.287173629f, 0.0726100132f},
-std::array<float,2>{0.790350616f, 0.938783526f},
-std::array<float,2>{0.560701132f, 0.282140762f},
-std::array<float,2>{0.165643573f, 0.725785136f},
-std::array<float,2>{0.00997330807f, 0.0118156243f},
-std::array<float,2>{0.717259765f, 0.930333495f},
-std::array<float,2>{0.941803217f, 0.351134151f},
-std::array<float,2>{0.3914783f, 0.662446618f},
-std::array<float,2>{0.316782445f, 0.411900908f},
-std::array<float,2>{0.861421525f, 0.612390518f},
-std::array<float,2>{0.564935744f, 0.239077508f},
-std::array<float,2>{0.199746266f, 0.754413664f},
-std::array<float,2>{0.130962834f, 0.254406214f},
-std::array<float,2>{0.523312747f, 0.716321528f},
-std::array<float,2>{0.752449214f, 0.0998227447f},
-std::array<float,2>{0.255357713f, 0.996627986f},
-std::array<float,2>{0.448740453f, 0.168070912f},
-std::array<float,2>{0.92282927f, 0.861588418f},
-std::array<float,2>{0.676764548f, 0.457132429f},
-std::array<float,2>{0.0651343763f, 0.545096815f},
-std::array<float,2>{0.0443297066f, 0.247657835f},
-std::array<float,2>{0.738996506f, 0.759881914f},
-std::array<float,2>{0.999957383f, 0.416885406f},
-std::array<float,2>{0.41713205f, 0.622519791f},
-std::array<float,2>{0.345745951f, 0.358717442f},
-std::array<float,2>{0.817540765f, 0.668335557f},
-std::array<float,2>{0.608524501f, 0.00184786902f},
-std::array<float,2>{0.234297782f, 0.922534108f},
-std::array<float,2>{0.159748346f, 0.465849519f},
-std::array<float,2>{0.551576555f, 0.532460272f},
-std::array<float,2>{0.787809372f, 0.161834985f},
-std::array<float,2>{0.295426816f, 0.867238045f},
-std::array<float,2>{0.488889188f, 0.102765866f},
-std::array<float,2>{0.897621632f, 0.98891753f},
-std::array<float,2>{0.655519187f, 0.263604313f},
-std::array<float,2>{0.0945715681f, 0.710092068f},
-std::array<float,2>{0.194088459f, 0.0513639301f},
-std::array<float,2>{0.573328614f, 0.877979398f},
-std::array<float,2>{0.873552263f, 0.312587023f},
-std::array<float,2>{0.324643373f, 0.648166358f},
-std::array<float,2>{0.401228637f, 0.392144412f},
-std::array<float,2>{0.947385788f, 0.590497732f},
-std::array<float,2>{0.706394732f, 0.196987107f},
-std::array<float,2>{0.00319223688f, 0.804091573f},
-std::array<float,2>{0.0767313316f, 0.28970018f},
-std::array<float,2>{0.686146259f, 0.727334559f},
-std::array<float,2>{0.929973364f, 0.0636789873f},
-std::array<float,2>{0.444363534f, 0.948023081f},
-std::array<float,2>{0.263795853f, 0.141131788f},
-std::array<float,2>{0.763220429f, 0.84275198f},
-std::array<float,2>{0.524542511f, 0.472120255f},
-std::array<float,2>{0.134826317f, 0.513689995f},
-std::array<float,2>{0.141985789f, 0.186712325f},
-std::array<float,2>{0.501653314f, 0.853847802f},
-std::array<float,2>{0.772023857f, 0.449356288f},
-std::array<float,2>{0.266801447f, 0.561367154f},
-std::array<float,2>{0.453602493f, 0.271747172f},
-std::array<float,2>{0.916062534f, 0.690751851f},
-std::array<float,2>{0.663289309f, 0.115571775f},
-std::array<float,2>{0.0878296718f, 0.973215163f},
-std::array<float,2>{0.0230774079f, 0.425985396f},
-std::array<float,2>{0.694694161f, 0.605322421f},
-std::array<float,2>{0.963776708f, 0.232961208f},
-std::array<float,2>{0.375655293f, 0.775710881f},
-std::array<float,2>{0.339689851f, 0.0264626555f},
-std::array<float,2>{0.84600991f, 0.908885002f},
-std::array<float,2>{0.580923617f, 0.365557015f},
-std::array<float,2>{0.214978784f, 0.674156845f},
-std::array<float,2>{0.113120481f, 0.0893208683f},
-std::array<float,2>{0.638807416f, 0.963304639f},
-std::array<float,2>{0.888585091f, 0.299994767f},
-std::array<float,2>{0.477289975f, 0.737704158f},
-std::array<float,2>{0.310115546f, 0.496651292f},
-std::array<float,2>{0.79898566f, 0.516068637f},
-std::array<float,2>{0.542957187f, 0.138119981f},
-std::array<float,2>{0.183739305f, 0.816670597f},
-std::array<float,2>{0.234401211f, 0.340757251f},
-std::array<float,2>{0.618617594f, 0.631949544f},
-std::array<float,2>{0.843063235f, 0.036173135f},
-std::array<float,2>{0.364593148f, 0.892757237f},
-std::array<float,2>{0.433001012f, 0.205939487f},
-std::array<float,2>{0.981635451f, 0.79159534f},
-std::array<float,2>{0.722849548f, 0.384919822f},
-std::array<float,2>{0.0584648624f, 0.571698666f},
-std::array<float,2>{0.0722238496f, 0.222109407f},
-std::array<float,2>{0.679930031f, 0.766020656f},
-std::array<float,2>{0.93516165f, 0.431996584f},
-std::array<float,2>{0.438411862f, 0.599844456f},
-std::array<float,2>{0.261454135f, 0.373884857f},
-std::array<float,2>{0.757828474f, 0.681311369f},
-std::array<float,2>{0.527611494f, 0.0182957575f},
-std::array<float,2>{0.138543397f, 0.920941889f},
-std::array<float,2>{0.189822704f, 0.440694541f},
-std::array<float,2>{0.574891984f, 0.552887619f},
-std::array<float,2>{0.870554924f, 0.177033707f},
-std::array<float,2>{0.32286036f, 0.847308695f},
-std::array<float,2>{0.404790431f, 0.123588681f},
-std::array<float,2>{0.95027262f, 0.982163429f},
-std::array<float,2>{0.708841622f, 0.27791813f},
-std::array<float,2>{0.0073948442f, 0.701803565f},
-std::array<float,2>{0.160652071f, 0.0426117443f},
-std::array<float,2>{0.550325751f, 0.900074363f},
-std::array<float,2>{0.782564461f, 0.331836343f},
-std::array<float,2>{0.291288614f, 0.635650933f},
-std::array<float,2>{0.487948328f, 0.378948092f},
-std::array<float,2>{0.894305229f, 0.56722182f},
-std::array<float,2>{0.648714483f, 0.213908359f},
-std::array<float,2>{0.0992177352f, 0.785938084f},
-std::array<float,2>{0.0417667069f, 0.306560069f},
-std::array<float,2>{0.734393358f, 0.744173586f},
-std::array<float,2>{0.995119452f, 0.0803201869f},
-std::array<float,2>{0.421263665f, 0.957742929f},
-std::array<float,2>{0.348293245f, 0.127599403f},
-std::array<float,2>{0.812696338f, 0.820534408f},
-std::array<float,2>{0.60369271f, 0.485667616f},
-std::array<float,2>{0.226927608f, 0.52979511f},
-std::array<float,2>{0.241619393f, 0.167202875f},
-std::array<float,2>{0.622218549f, 0.866125882f},
-std::array<float,2>{0.836532533f, 0.456819326f},
-std::array<float,2>{0.362603843f, 0.541461408f},
-std::array<float,2>{0.436094999f, 0.250469565f},
-std::array<float,2>{0.977150202f, 0.710986972f},
-std::array<float,2>{0.721764147f, 0.0967412144f},
-std::array<float,2>{0.060424719f, 0.994658351f},
-std::array<float,2>{0.114383869f, 0.408671528f},
-std::array<float,2>{0.636576712f, 0.61610961f},
-std::array<float,2>{0.884076893f, 0.238254517f},
-std::array<float,2>{0.482591867f, 0.753350854f},
-std::array<float,2>{0.305185199f, 0.0100833671f},
-std::array<float,2>{0.803200781f, 0.933941603f},
-std::array<float,2>{0.54353714f, 0.346992046f},
-std::array<float,2>{0.182509929f, 0.659916639f},
-std::array<float,2>{0.0180303883f, 0.0748882741f},
-std::array<float,2>{0.687723041f, 0.943433702f},
-std::array<float,2>{0.966380954f, 0.287081301f},
-std::array<float,2>{0.380589455f, 0.720872104f},
-std::array<float,2>{0.34222585f, 0.483499497f},
-std::array<float,2>{0.850831568f, 0.500134945f},
-std::array<float,2>{0.585441172f, 0.15057455f},
-std::array<float,2>{0.212585613f, 0.833108783f},
-std::array<float,2>{0.147347882f, 0.327486098f},
-std::array<float,2>{0.507097006f, 0.649260819f},
-std::array<float,2>{0.768740892f, 0.0610836148f},
-std::array<float,2>{0.271798283f, 0.886513233f},
-std::array<float,2>{0.457434893f, 0.194969907f},
-std::array<float,2>{0.918176532f, 0.810851276f},
-std::array<float,2>{0.659943104f, 0.401398987f},
-std::array<float,2>{0.0908358395f, 0.585636675f},
-std::array<float,2>{0.0526356623f, 0.147454903f},
-std::array<float,2>{0.726612389f, 0.836424232f},
-std::array<float,2>{0.975009322f, 0.47322458f},
-std::array<float,2>{0.426541269f, 0.508032382f},
-std::array<float,2>{0.372514457f, 0.294951677f},
-std::array<float,2>{0.833026052f, 0.731190979f},
-std::array<float,2>{0.609859705f, 0.0678015277f},
-std::array<float,2>{0.249029934f, 0.95118916f},
-std::array<float,2>{0.174624115f, 0.398393512f},
-std::array<float,2>{0.535330117f, 0.586476684f},
-std::array<float,2>{0.804923117f, 0.200832844f},
-std::array<float,2>{0.303533375f, 0.79705435f},
-std::array<float,2>{0.471645623f, 0.0488003343f},
-std::array<float,2>{0.878965914f, 0.882343411f},
-std::array<float,2>{0.631561279f, 0.318753004f},
-std::array<float,2>{0.118160971f, 0.641118824f},
-std::array<float,2>{0.210535139f, 0.106602289f},
-std::array<float,2>{0.593529701f, 0.986160338f},
-std::array<float,2>{0.857405365f, 0.25942266f},
-std::array<float,2>{0.329856068f, 0.705407023f},
-std::array<float,2>{0.387183815f, 0.46275124f},
-std::array<float,2>{0.958976984f, 0.53770721f},
-std::array<float,2>{0.703107357f, 0.157056928f},
-std::array<float,2>{0.0300444812f, 0.871306777f},
-std::array<float,2>{0.0801843107f, 0.354138792f},
-std::array<float,2>{0.666142881f, 0.667300761f},
-std::array<float,2>{0.910359085f, 0.00540901395f},
-std::array<float,2>{0.462349355f, 0.925945044f},
-std::array<float,2>{0.276246548f, 0.243871555f},
-std::array<float,2>{0.773806214f, 0.765325963f},
-std::array<float,2>{0.511972606f, 0.42011717f},
-std::array<float,2>{0.15372099f, 0.621010542f},
-std::array<float,2>{0.125184894f, 0.207918018f},
-std::array<float,2>{0.518865049f, 0.793807089f},
-std::array<float,2>{0.754834235f, 0.387050331f},
-std::array<float,2>{0.253376007f, 0.576663256f},
-std::array<float,2>{0.451009214f, 0.338151723f},
-std::array<float,2>{0.926643491f, 0.627400041f},
-std::array<float,2>{0.672387779f, 0.0340132192f},
-std::array<float,2>{0.0678775534f, 0.895326793f},
-std::array<float,2>{0.0120446514f, 0.492521286f},
-std::array<float,2>{0.712355494f, 0.522064447f},
-std::array<float,2>{0.940765083f, 0.133315355f},
-std::array<float,2>{0.396277636f, 0.81300652f},
-std::array<float,2>{0.315354913f, 0.0912930369f},
-std::array<float,2>{0.86514312f, 0.965205014f},
-std::array<float,2>{0.570022285f, 0.302728862f},
-std::array<float,2>{0.197403148f, 0.74201715f},
-std::array<float,2>{0.107346296f, 0.0279690512f},
-std::array<float,2>{0.641307414f, 0.910497427f},
-std::array<float,2>{0.90094167f, 0.361816913f},
-std::array<float,2>{0.492964f, 0.676711798f},
-std::array<float,2>{0.284308702f, 0.422324359f},
-std::array<float,2>{0.794550419f, 0.608127117f},
-std::array<float,2>{0.555787146f, 0.229665697f},
-std::array<float,2>{0.171209335f, 0.780355632f},
-std::array<float,2>{0.223356426f, 0.26764217f},
-std::array<float,2>{0.600784421f, 0.691598833f},
-std::array<float,2>{0.823298812f, 0.110979132f},
-std::array<float,2>{0.359104097f, 0.970161796f},
-std::array<float,2>{0.409928918f, 0.181275457f},
-std::array<float,2>{0.987415016f, 0.856694639f},
-std::array<float,2>{0.744782507f, 0.448659331f},
-std::array<float,2>{0.0326251499f, 0.558055043f},
-std::array<float,2>{0.124241166f, 0.174413323f},
-std::array<float,2>{0.628858685f, 0.848380804f},
-std::array<float,2>{0.875263333f, 0.445008695f},
-std::array<float,2>{0.473956913f, 0.548258364f},
-std::array<float,2>{0.29903546f, 0.276577234f},
-std::array<float,2>{0.809747875f, 0.698851168f},
-std::array<float,2>{0.533598304f, 0.121010214f},
-std::array<float,2>{0.177350923f, 0.979038537f},
-std::array<float,2>{0.245323196f, 0.434927702f},
-std::array<float,2>{0.615131915f, 0.595943093f},
-std::array<float,2>{0.829434216f, 0.224544778f},
-std::array<float,2>{0.367459744f, 0.773173988f},
-std::array<float,2>{0.423670501f, 0.0223837085f},
-std::array<float,2>{0.972192943f, 0.915672421f},
-std::array<float,2>{0.73417449f, 0.367972314f},
-std::array<float,2>{0.0471411832f, 0.684180319f},
-std::array<float,2>{0.150280312f, 0.0847573504f},
-std::array<float,2>{0.510433614f, 0.954042494f},
-std::array<float,2>{0.780188143f, 0.311438948f},
-std::array<float,2>{0.279087424f, 0.747260988f},
-std::array<float,2>{0.465116978f, 0.488881946f},
-std::array<float,2>{0.909991324f, 0.526947796f},
-std::array<float,2>{0.671839118f, 0.129260123f},
-std::array<float,2>{0.0832114294f, 0.824341238f},
-std::array<float,2>{0.0253838003f, 0.335754722f},
-std::array<float,2>{0.697229385f, 0.639246643f},
-std::array<float,2>{0.955424249f, 0.0453379527f},
-std::array<float,2>{0.385490507f, 0.903439701f},
-std::array<float,2>{0.33395201f, 0.215677872f},
-std::array<float,2>{0.853239f, 0.784338951f},
-std::array<float,2>{0.586033583f, 0.376662195f},
-std::array<float,2>{0.205320179f, 0.564467013f},
-std::array<float,2>{0.20292902f, 0.241706744f},
-std::array<float,2>{0.563692927f, 0.756220341f},
-std::array<float,2>{0.860349655f, 0.413162977f},
-std::array<float,2>{0.318592548f, 0.609782696f},
-std::array<float,2>{0.394016296f, 0.34815836f},
-std::array<float,2>{0.944855392f, 0.66148448f},
-std::array<float,2>{0.715384781f, 0.014558726f},
-std::array<float,2>{0.00843376108f, 0.932844222f},
-std::array<float,2>{0.0626647621f, 0.459937304f},
-std::array<float,2>{0.678279102f, 0.544167161f},
-std::array<float,2>{0.924761117f, 0.171060696f},
-std::array<float,2>{0.445972532f, 0.859631956f},
-std::array<float,2>{0.257274389f, 0.0993088558f},
-std::array<float,2>{0.750021577f, 0.998555779f},
-std::array<float,2>{0.519869924f, 0.256476223f},
-std::array<float,2>{0.130726188f, 0.717143238f},
-std::array<float,2>{0.036618799f, 0.0562454909f},
-std::array<float,2>{0.746932507f, 0.888882101f},
-std::array<float,2>{0.989729464f, 0.322313964f},
-std::array<float,2>{0.411063612f, 0.65472573f},
-std::array<float,2>{0.354491025f, 0.406014383f},
-std::array<float,2>{0.825950503f, 0.581194639f},
-std::array<float,2>{0.59746182f, 0.188341513f},
-std::array<float,2>{0.220107585f, 0.804902017f},
-std::array<float,2>{0.166515127f, 0.28343153f},
-std::array<float,2>{0.559588909f, 0.723534465f},
-std::array<float,2>{0.792142749f, 0.0719215348f},
-std::array<float,2>{0.286235273f, 0.940132141f},
-std::array<float,2>{0.49811551f, 0.153143018f},
-std::array<float,2>{0.904263377f, 0.830357134f},
-std::array<float,2>{0.645013094f, 0.478239208f},
-std::array<float,2>{0.10237544f, 0.506983876f},
-std::array<float,2>{0.00154771109f, 0.19833456f},
-std::array<float,2>{0.703727007f, 0.801504076f},
-std::array<float,2>{0.947263956f, 0.394177794f},
-std::array<float,2>{0.399088651f, 0.592151165f},
-std::array<float,2>{0.327595532f, 0.314802319f},
-std::array<float,2>{0.871673882f, 0.64596647f},
-std::array<float,2>{0.570532262f, 0.0545733832f},
-std::array<float,2>{0.192759886f, 0.876652896f},
-std::array<float,2>{0.133686647f, 0.470222175f},
-std::array<float,2>{0.525458574f, 0.512395382f},
-std::array<float,2>{0.763672292f, 0.14317672f},
-std::array<float,2>{0.26284638f, 0.839850426f},
-std::array<float,2>{0.443270683f, 0.0653644949f},
-std::array<float,2>{0.932480276f, 0.946145535f},
-std::array<float,2>{0.68499887f, 0.291829944f},
-std::array<float,2>{0.0754657984f, 0.728675783f},
-std::array<float,2>{0.230691209f, 0.00374549627f},
-std::array<float,2>{0.605654955f, 0.925016224f},
-std::array<float,2>{0.819824338f, 0.355835468f},
-std::array<float,2>{0.345302075f, 0.67153281f},
-std::array<float,2>{0.415703475f, 0.414161354f},
-std::array<float,2>{0.99719137f, 0.624988973f},
-std::array<float,2>{0.741748393f, 0.248663753f},
-std::array<float,2>{0.0450717248f, 0.758362591f},
-std::array<float,2>{0.0961323157f, 0.264648795f},
-std::array<float,2>{0.653676093f, 0.707681417f},
-std::array<float,2>{0.896404505f, 0.104715466f},
-std::array<float,2>{0.491272509f, 0.990283787f},
-std::array<float,2>{0.294647992f, 0.163974613f},
-std::array<float,2>{0.786111772f, 0.869558752f},
-std::array<float,2>{0.554204404f, 0.467713296f},
-std::array<float,2>{0.157749087f, 0.53395766f},
-std::array<float,2>{0.187220484f, 0.139451668f},
-std::array<float,2>{0.539400578f, 0.819632351f},
-std::array<float,2>{0.798247576f, 0.499112666f},
-std::array<float,2>{0.311051458f, 0.518399179f},
-std::array<float,2>{0.480422646f, 0.297288418f},
-std::array<float,2>{0.890054822f, 0.734758139f},
-std::array<float,2>{0.637214363f, 0.086489208f},
-std::array<float,2>{0.110523872f, 0.961827517f},
-std::array<float,2>{0.0566296093f, 0.384058475f},
-std::array<float,2>{0.725630641f, 0.572916865f},
-std::array<float,2>{0.983403385f, 0.204630673f},
-std::array<float,2>{0.429982781f, 0.789684832f},
-std::array<float,2>{0.365261644f, 0.0382685363f},
-std::array<float,2>{0.841178536f, 0.89119947f},
-std::array<float,2>{0.619994581f, 0.341845185f},
-std::array<float,2>{0.237604648f, 0.630414188f},
-std::array<float,2>{0.0898332894f, 0.113529518f},
-std::array<float,2>{0.661365688f, 0.975463033f},
-std::array<float,2>{0.91560787f, 0.269993842f},
-std::array<float,2>{0.455689818f, 0.688908637f},
-std::array<float,2>{0.268684298f, 0.451787114f},
-std::array<float,2>{0.770707905f, 0.559398711f},
-std::array<float,2>{0.50231564f, 0.184473336f},
-std::array<float,2>{0.14422664f, 0.852129042f},
-std::array<float,2>{0.21720922f, 0.363408446f},
-std::array<float,2>{0.579338253f, 0.673028708f},
-std::array<float,2>{0.843799651f, 0.0236230846f},
-std::array<float,2>{0.337555945f, 0.907072663f},
-std::array<float,2>{0.37875846f, 0.231941327f},
-std::array<float,2>{0.960977852f, 0.77388519f},
-std::array<float,2>{0.693155468f, 0.427762896f},
-std::array<float,2>{0.0210850406f, 0.602668107f}}
\ No newline at end of file
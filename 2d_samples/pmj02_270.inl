@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.343488723f, 0.06140811f},
-std::array<float,2>{0.930939913f, 0.583556712f},
-std::array<float,2>{0.520831466f, 0.498239636f},
-std::array<float,2>{0.0639692023f, 0.92667377f},
-std::array<float,2>{0.222767502f, 0.36220935f},
-std::array<float,2>{0.707499146f, 0.78757602f},
-std::array<float,2>{0.77531749f, 0.214872554f},
-std::array<float,2>{0.422142595f, 0.748948574f},
-std::array<float,2>{0.0126535473f, 0.152453899f},
-std::array<float,2>{0.61795491f, 0.635991335f},
-std::array<float,2>{0.98838371f, 0.308254659f},
-std::array<float,2>{0.270889282f, 0.845425844f},
-std::array<float,2>{0.490751684f, 0.424742907f},
-std::array<float,2>{0.857921839f, 0.970023751f},
-std::array<float,2>{0.664781749f, 0.113189153f},
-std::array<float,2>{0.174681559f, 0.519219041f},
-std::array<float,2>{0.375877142f, 0.244725972f},
-std::array<float,2>{0.78570956f, 0.696211457f},
-std::array<float,2>{0.730243146f, 0.317144036f},
-std::array<float,2>{0.195240304f, 0.763531983f},
-std::array<float,2>{0.108472519f, 0.446759194f},
-std::array<float,2>{0.536440909f, 0.884735882f},
-std::array<float,2>{0.885407925f, 0.0133067677f},
-std::array<float,2>{0.345829815f, 0.623769999f},
-std::array<float,2>{0.138855204f, 0.0844573304f},
-std::array<float,2>{0.650149047f, 0.536627412f},
-std::array<float,2>{0.821913958f, 0.403890729f},
-std::array<float,2>{0.440958172f, 0.959036946f},
-std::array<float,2>{0.283150345f, 0.261446625f},
-std::array<float,2>{0.9591766f, 0.820084751f},
-std::array<float,2>{0.586687803f, 0.156253412f},
-std::array<float,2>{0.0473987944f, 0.686542451f},
-std::array<float,2>{0.466674894f, 0.10621506f},
-std::array<float,2>{0.83910495f, 0.505287647f},
-std::array<float,2>{0.625028431f, 0.421385467f},
-std::array<float,2>{0.15348424f, 0.996598899f},
-std::array<float,2>{0.0460468568f, 0.28890264f},
-std::array<float,2>{0.573308945f, 0.868556619f},
-std::array<float,2>{0.948209703f, 0.129150242f},
-std::array<float,2>{0.303690076f, 0.654810607f},
-std::array<float,2>{0.218174383f, 0.195112705f},
-std::array<float,2>{0.740252376f, 0.723196328f},
-std::array<float,2>{0.798265696f, 0.35379833f},
-std::array<float,2>{0.39547351f, 0.810085714f},
-std::array<float,2>{0.374242932f, 0.481309861f},
-std::array<float,2>{0.902968228f, 0.910674751f},
-std::array<float,2>{0.54850477f, 0.0439842865f},
-std::array<float,2>{0.116610125f, 0.5638358f},
-std::array<float,2>{0.257058173f, 0.176501542f},
-std::array<float,2>{0.983765244f, 0.671261549f},
-std::array<float,2>{0.59742099f, 0.275649637f},
-std::array<float,2>{0.0309357643f, 0.830415547f},
-std::array<float,2>{0.171205118f, 0.3829f},
-std::array<float,2>{0.68461895f, 0.950666726f},
-std::array<float,2>{0.874787867f, 0.0667634457f},
-std::array<float,2>{0.475884527f, 0.552199602f},
-std::array<float,2>{0.0849509612f, 0.0162985772f},
-std::array<float,2>{0.51144886f, 0.597305477f},
-std::array<float,2>{0.909376085f, 0.456045926f},
-std::array<float,2>{0.323477626f, 0.892927349f},
-std::array<float,2>{0.421517551f, 0.331739396f},
-std::array<float,2>{0.751152694f, 0.77648586f},
-std::array<float,2>{0.699941456f, 0.220930487f},
-std::array<float,2>{0.245483935f, 0.716861188f},
-std::array<float,2>{0.308924556f, 0.071862042f},
-std::array<float,2>{0.938849807f, 0.562200904f},
-std::array<float,2>{0.566647112f, 0.376746297f},
-std::array<float,2>{0.0339386761f, 0.941253304f},
-std::array<float,2>{0.144312501f, 0.27064231f},
-std::array<float,2>{0.640255451f, 0.839560747f},
-std::array<float,2>{0.831698656f, 0.180248082f},
-std::array<float,2>{0.459430814f, 0.662050962f},
-std::array<float,2>{0.119486362f, 0.232058451f},
-std::array<float,2>{0.55822736f, 0.703550339f},
-std::array<float,2>{0.891899049f, 0.339635909f},
-std::array<float,2>{0.364869952f, 0.767544091f},
-std::array<float,2>{0.404303819f, 0.46790722f},
-std::array<float,2>{0.811155498f, 0.902936459f},
-std::array<float,2>{0.743273973f, 0.0266208015f},
-std::array<float,2>{0.20645456f, 0.605308592f},
-std::array<float,2>{0.477475733f, 0.133526549f},
-std::array<float,2>{0.864522099f, 0.64545536f},
-std::array<float,2>{0.679094136f, 0.291359752f},
-std::array<float,2>{0.162592188f, 0.860069931f},
-std::array<float,2>{0.0187047198f, 0.406641364f},
-std::array<float,2>{0.605703413f, 0.9855088f},
-std::array<float,2>{0.975659251f, 0.0996006578f},
-std::array<float,2>{0.260902613f, 0.512141287f},
-std::array<float,2>{0.240335867f, 0.0329447314f},
-std::array<float,2>{0.693698227f, 0.572208464f},
-std::array<float,2>{0.763967693f, 0.474835098f},
-std::array<float,2>{0.410288036f, 0.918607354f},
-std::array<float,2>{0.314484f, 0.350529402f},
-std::array<float,2>{0.918367147f, 0.799571455f},
-std::array<float,2>{0.504341245f, 0.198139042f},
-std::array<float,2>{0.0903232098f, 0.731424987f},
-std::array<float,2>{0.435452908f, 0.00608184282f},
-std::array<float,2>{0.768349648f, 0.614792407f},
-std::array<float,2>{0.712719917f, 0.438816309f},
-std::array<float,2>{0.233641505f, 0.878827691f},
-std::array<float,2>{0.0758831054f, 0.326959759f},
-std::array<float,2>{0.530581295f, 0.754121482f},
-std::array<float,2>{0.922754943f, 0.238612607f},
-std::array<float,2>{0.332002223f, 0.690136611f},
-std::array<float,2>{0.183754414f, 0.167092204f},
-std::array<float,2>{0.658957005f, 0.675193608f},
-std::array<float,2>{0.849608898f, 0.254365504f},
-std::array<float,2>{0.494438887f, 0.8265149f},
-std::array<float,2>{0.276069552f, 0.395286739f},
-std::array<float,2>{0.998051822f, 0.964208364f},
-std::array<float,2>{0.617107391f, 0.0903679281f},
-std::array<float,2>{0.00622949144f, 0.542508721f},
-std::array<float,2>{0.354376316f, 0.207072809f},
-std::array<float,2>{0.879265904f, 0.735497355f},
-std::array<float,2>{0.543164968f, 0.373948216f},
-std::array<float,2>{0.0982903168f, 0.793666363f},
-std::array<float,2>{0.198712975f, 0.488265127f},
-std::array<float,2>{0.720212877f, 0.934321642f},
-std::array<float,2>{0.795586109f, 0.0503965802f},
-std::array<float,2>{0.383080661f, 0.589691103f},
-std::array<float,2>{0.0565430075f, 0.117500409f},
-std::array<float,2>{0.583513677f, 0.528751612f},
-std::array<float,2>{0.963854969f, 0.435328335f},
-std::array<float,2>{0.295701712f, 0.980127096f},
-std::array<float,2>{0.45211789f, 0.297642618f},
-std::array<float,2>{0.812851548f, 0.855337679f},
-std::array<float,2>{0.645655453f, 0.14761813f},
-std::array<float,2>{0.126181588f, 0.62713176f},
-std::array<float,2>{0.361939311f, 0.115291409f},
-std::array<float,2>{0.896723032f, 0.521843731f},
-std::array<float,2>{0.558771968f, 0.425870478f},
-std::array<float,2>{0.121997923f, 0.976039529f},
-std::array<float,2>{0.208297715f, 0.31062153f},
-std::array<float,2>{0.748205245f, 0.847722054f},
-std::array<float,2>{0.806137979f, 0.148507908f},
-std::array<float,2>{0.401923925f, 0.63770473f},
-std::array<float,2>{0.0376908258f, 0.211100757f},
-std::array<float,2>{0.566134751f, 0.743925691f},
-std::array<float,2>{0.944050789f, 0.364821225f},
-std::array<float,2>{0.307658732f, 0.782356739f},
-std::array<float,2>{0.4553065f, 0.492391527f},
-std::array<float,2>{0.833319485f, 0.924316764f},
-std::array<float,2>{0.633659422f, 0.0574762486f},
-std::array<float,2>{0.146089032f, 0.578753591f},
-std::array<float,2>{0.406750709f, 0.162270695f},
-std::array<float,2>{0.761115074f, 0.682668686f},
-std::array<float,2>{0.688016355f, 0.261781782f},
-std::array<float,2>{0.237755358f, 0.815161049f},
-std::array<float,2>{0.0880420506f, 0.398900509f},
-std::array<float,2>{0.501602232f, 0.956842661f},
-std::array<float,2>{0.915366113f, 0.0788008198f},
-std::array<float,2>{0.319086552f, 0.534945488f},
-std::array<float,2>{0.156657472f, 0.0103862304f},
-std::array<float,2>{0.675357163f, 0.620577872f},
-std::array<float,2>{0.861203551f, 0.450820744f},
-std::array<float,2>{0.483116269f, 0.88864392f},
-std::array<float,2>{0.262980878f, 0.314114153f},
-std::array<float,2>{0.971324801f, 0.759162307f},
-std::array<float,2>{0.602886438f, 0.247832641f},
-std::array<float,2>{0.02206924f, 0.699562669f},
-std::array<float,2>{0.496495157f, 0.0394807719f},
-std::array<float,2>{0.846666217f, 0.568875253f},
-std::array<float,2>{0.663643777f, 0.479072541f},
-std::array<float,2>{0.180527583f, 0.908596218f},
-std::array<float,2>{0.00316426205f, 0.356839001f},
-std::array<float,2>{0.609731853f, 0.808507919f},
-std::array<float,2>{0.994699538f, 0.190558389f},
-std::array<float,2>{0.280482143f, 0.721763313f},
-std::array<float,2>{0.228860557f, 0.127580687f},
-std::array<float,2>{0.717897415f, 0.650785327f},
-std::array<float,2>{0.771297812f, 0.283085614f},
-std::array<float,2>{0.431324065f, 0.874668658f},
-std::array<float,2>{0.334655523f, 0.415754646f},
-std::array<float,2>{0.928040147f, 0.995697498f},
-std::array<float,2>{0.527107477f, 0.105399258f},
-std::array<float,2>{0.0733449236f, 0.503067791f},
-std::array<float,2>{0.289615154f, 0.223521948f},
-std::array<float,2>{0.965693653f, 0.713125646f},
-std::array<float,2>{0.579976082f, 0.333356947f},
-std::array<float,2>{0.0595799871f, 0.777609468f},
-std::array<float,2>{0.129376367f, 0.458099604f},
-std::array<float,2>{0.641837776f, 0.894980848f},
-std::array<float,2>{0.81954807f, 0.0195668861f},
-std::array<float,2>{0.445712477f, 0.600389242f},
-std::array<float,2>{0.0960221514f, 0.0631057099f},
-std::array<float,2>{0.542632043f, 0.550705254f},
-std::array<float,2>{0.876737714f, 0.387035131f},
-std::array<float,2>{0.358151853f, 0.949032843f},
-std::array<float,2>{0.390541047f, 0.278031409f},
-std::array<float,2>{0.791547f, 0.833376884f},
-std::array<float,2>{0.726325095f, 0.172308683f},
-std::array<float,2>{0.200927794f, 0.666299701f},
-std::array<float,2>{0.265901566f, 0.0289612431f},
-std::array<float,2>{0.9852314f, 0.606105804f},
-std::array<float,2>{0.624121606f, 0.463531256f},
-std::array<float,2>{0.0102810971f, 0.900828063f},
-std::array<float,2>{0.178777739f, 0.342904419f},
-std::array<float,2>{0.670891047f, 0.771084249f},
-std::array<float,2>{0.851783097f, 0.22837092f},
-std::array<float,2>{0.488058478f, 0.707449198f},
-std::array<float,2>{0.0678291172f, 0.18363966f},
-std::array<float,2>{0.515964508f, 0.659468114f},
-std::array<float,2>{0.934232652f, 0.267193735f},
-std::array<float,2>{0.337969363f, 0.841139138f},
-std::array<float,2>{0.426403552f, 0.380077183f},
-std::array<float,2>{0.778788626f, 0.94276464f},
-std::array<float,2>{0.70385164f, 0.075932771f},
-std::array<float,2>{0.2189807f, 0.555877388f},
-std::array<float,2>{0.443476915f, 0.199750841f},
-std::array<float,2>{0.82573849f, 0.726888359f},
-std::array<float,2>{0.654925227f, 0.344409972f},
-std::array<float,2>{0.136128962f, 0.804116309f},
-std::array<float,2>{0.0540144444f, 0.472210169f},
-std::array<float,2>{0.592572927f, 0.9177562f},
-std::array<float,2>{0.954973102f, 0.0376287773f},
-std::array<float,2>{0.28595373f, 0.575895548f},
-std::array<float,2>{0.188733548f, 0.0952300355f},
-std::array<float,2>{0.731724799f, 0.508802354f},
-std::array<float,2>{0.782908976f, 0.413169473f},
-std::array<float,2>{0.380246639f, 0.989888012f},
-std::array<float,2>{0.348193079f, 0.294017255f},
-std::array<float,2>{0.890193284f, 0.86636132f},
-std::array<float,2>{0.532284021f, 0.137408435f},
-std::array<float,2>{0.102747671f, 0.641875267f},
-std::array<float,2>{0.390996039f, 0.0873144045f},
-std::array<float,2>{0.804648519f, 0.543040097f},
-std::array<float,2>{0.7377581f, 0.39422828f},
-std::array<float,2>{0.212752596f, 0.965528309f},
-std::array<float,2>{0.111529954f, 0.252606481f},
-std::array<float,2>{0.552736998f, 0.822095931f},
-std::array<float,2>{0.901022136f, 0.170824111f},
-std::array<float,2>{0.368166596f, 0.677863896f},
-std::array<float,2>{0.150830686f, 0.23440212f},
-std::array<float,2>{0.631845713f, 0.69530493f},
-std::array<float,2>{0.84341079f, 0.320666671f},
-std::array<float,2>{0.462138802f, 0.750027835f},
-std::array<float,2>{0.297118753f, 0.44178313f},
-std::array<float,2>{0.949800432f, 0.881818593f},
-std::array<float,2>{0.577589452f, 0.00265609636f},
-std::array<float,2>{0.0402798727f, 0.61087811f},
-std::array<float,2>{0.32447198f, 0.144146174f},
-std::array<float,2>{0.912839651f, 0.629569113f},
-std::array<float,2>{0.515022933f, 0.302345157f},
-std::array<float,2>{0.0794391036f, 0.856697202f},
-std::array<float,2>{0.247961864f, 0.431106955f},
-std::array<float,2>{0.697732687f, 0.982899487f},
-std::array<float,2>{0.754441381f, 0.1248831f},
-std::array<float,2>{0.415550172f, 0.524916589f},
-std::array<float,2>{0.0237347595f, 0.0544249788f},
-std::array<float,2>{0.600843787f, 0.592078269f},
-std::array<float,2>{0.977069736f, 0.489823669f},
-std::array<float,2>{0.252403319f, 0.929823399f},
-std::array<float,2>{0.471379757f, 0.368810147f},
-std::array<float,2>{0.868583083f, 0.789466739f},
-std::array<float,2>{0.681874096f, 0.205273986f},
-std::array<float,2>{0.164780617f, 0.740959585f},
-std::array<float,2>{0.344980001f, 0.0150150405f},
-std::array<float,2>{0.883091569f, 0.622037709f},
-std::array<float,2>{0.537766099f, 0.44755587f},
-std::array<float,2>{0.106983922f, 0.885828257f},
-std::array<float,2>{0.193084151f, 0.319731861f},
-std::array<float,2>{0.72810632f, 0.764832795f},
-std::array<float,2>{0.787860394f, 0.243988007f},
-std::array<float,2>{0.378612876f, 0.697657287f},
-std::array<float,2>{0.0489186421f, 0.15823549f},
-std::array<float,2>{0.588715732f, 0.684134126f},
-std::array<float,2>{0.957487702f, 0.258113921f},
-std::array<float,2>{0.284118205f, 0.818229377f},
-std::array<float,2>{0.438355505f, 0.404932708f},
-std::array<float,2>{0.823337317f, 0.958619952f},
-std::array<float,2>{0.652250528f, 0.0829044878f},
-std::array<float,2>{0.137113318f, 0.538390636f},
-std::array<float,2>{0.424318016f, 0.217925772f},
-std::array<float,2>{0.775645018f, 0.74740535f},
-std::array<float,2>{0.709066331f, 0.360784858f},
-std::array<float,2>{0.225701153f, 0.785449862f},
-std::array<float,2>{0.065273419f, 0.496449858f},
-std::array<float,2>{0.521537185f, 0.928073823f},
-std::array<float,2>{0.931867421f, 0.0597925819f},
-std::array<float,2>{0.340913504f, 0.585031092f},
-std::array<float,2>{0.172234967f, 0.110465601f},
-std::array<float,2>{0.667497337f, 0.517296195f},
-std::array<float,2>{0.856270015f, 0.42188105f},
-std::array<float,2>{0.489470989f, 0.971348047f},
-std::array<float,2>{0.272579223f, 0.304731429f},
-std::array<float,2>{0.991921604f, 0.847382963f},
-std::array<float,2>{0.620155871f, 0.154857531f},
-std::array<float,2>{0.0143310688f, 0.634567738f},
-std::array<float,2>{0.474450618f, 0.0685531721f},
-std::array<float,2>{0.872352004f, 0.553614497f},
-std::array<float,2>{0.686331272f, 0.385471284f},
-std::array<float,2>{0.168714628f, 0.952623546f},
-std::array<float,2>{0.0286343768f, 0.273555696f},
-std::array<float,2>{0.595314205f, 0.828521192f},
-std::array<float,2>{0.9813236f, 0.178833425f},
-std::array<float,2>{0.255390465f, 0.669284284f},
-std::array<float,2>{0.243458927f, 0.219439089f},
-std::array<float,2>{0.701909184f, 0.714901924f},
-std::array<float,2>{0.753561139f, 0.328729451f},
-std::array<float,2>{0.418064445f, 0.773514688f},
-std::array<float,2>{0.320795447f, 0.454800725f},
-std::array<float,2>{0.908064008f, 0.891429722f},
-std::array<float,2>{0.508417428f, 0.0194356311f},
-std::array<float,2>{0.083021529f, 0.594458997f},
-std::array<float,2>{0.302271575f, 0.131024748f},
-std::array<float,2>{0.946347594f, 0.653146982f},
-std::array<float,2>{0.571006238f, 0.28641209f},
-std::array<float,2>{0.0443106107f, 0.871000171f},
-std::array<float,2>{0.154332623f, 0.419696152f},
-std::array<float,2>{0.628190994f, 0.998885274f},
-std::array<float,2>{0.837787151f, 0.107600182f},
-std::array<float,2>{0.467298448f, 0.50605005f},
-std::array<float,2>{0.113836676f, 0.0454796813f},
-std::array<float,2>{0.550751507f, 0.565623581f},
-std::array<float,2>{0.904672027f, 0.483941972f},
-std::array<float,2>{0.371142983f, 0.913823187f},
-std::array<float,2>{0.39801991f, 0.352511972f},
-std::array<float,2>{0.79956907f, 0.811543763f},
-std::array<float,2>{0.738928318f, 0.191808134f},
-std::array<float,2>{0.215479165f, 0.725988626f},
-std::array<float,2>{0.258416325f, 0.100749396f},
-std::array<float,2>{0.973131001f, 0.513845503f},
-std::array<float,2>{0.608279347f, 0.409613103f},
-std::array<float,2>{0.0175050069f, 0.986603141f},
-std::array<float,2>{0.160783544f, 0.289849967f},
-std::array<float,2>{0.677363753f, 0.861700237f},
-std::array<float,2>{0.866545558f, 0.135056704f},
-std::array<float,2>{0.479635179f, 0.646763563f},
-std::array<float,2>{0.093352817f, 0.19628635f},
-std::array<float,2>{0.507527292f, 0.73311317f},
-std::array<float,2>{0.920069039f, 0.347854078f},
-std::array<float,2>{0.313073218f, 0.798467934f},
-std::array<float,2>{0.412323892f, 0.473900348f},
-std::array<float,2>{0.763136208f, 0.921282053f},
-std::array<float,2>{0.691715896f, 0.0343086496f},
-std::array<float,2>{0.239971772f, 0.573139668f},
-std::array<float,2>{0.458905488f, 0.181658253f},
-std::array<float,2>{0.829170883f, 0.662368178f},
-std::array<float,2>{0.637636244f, 0.273293555f},
-std::array<float,2>{0.141381517f, 0.837468565f},
-std::array<float,2>{0.0312901698f, 0.37801832f},
-std::array<float,2>{0.570279419f, 0.939214885f},
-std::array<float,2>{0.941093743f, 0.073241733f},
-std::array<float,2>{0.312186688f, 0.558772564f},
-std::array<float,2>{0.204510242f, 0.0253216159f},
-std::array<float,2>{0.745425165f, 0.603183985f},
-std::array<float,2>{0.808775306f, 0.465590149f},
-std::array<float,2>{0.403604478f, 0.904371381f},
-std::array<float,2>{0.365895122f, 0.335945725f},
-std::array<float,2>{0.892813802f, 0.76835233f},
-std::array<float,2>{0.555048227f, 0.233293831f},
-std::array<float,2>{0.118658379f, 0.705772877f},
-std::array<float,2>{0.385373235f, 0.0481969863f},
-std::array<float,2>{0.794359207f, 0.587577701f},
-std::array<float,2>{0.722106755f, 0.48448199f},
-std::array<float,2>{0.196493626f, 0.936233222f},
-std::array<float,2>{0.100550257f, 0.371425003f},
-std::array<float,2>{0.545632243f, 0.795210183f},
-std::array<float,2>{0.881821752f, 0.20926562f},
-std::array<float,2>{0.353389293f, 0.736891031f},
-std::array<float,2>{0.128720701f, 0.14618361f},
-std::array<float,2>{0.647224367f, 0.625687242f},
-std::array<float,2>{0.816387177f, 0.300156415f},
-std::array<float,2>{0.450009584f, 0.852201402f},
-std::array<float,2>{0.29379335f, 0.436633974f},
-std::array<float,2>{0.96218586f, 0.976720154f},
-std::array<float,2>{0.584469438f, 0.120196439f},
-std::array<float,2>{0.0584651567f, 0.530203581f},
-std::array<float,2>{0.328347385f, 0.241528392f},
-std::array<float,2>{0.924724221f, 0.688729644f},
-std::array<float,2>{0.52881515f, 0.324263841f},
-std::array<float,2>{0.0765838772f, 0.757204652f},
-std::array<float,2>{0.231459886f, 0.439582199f},
-std::array<float,2>{0.714667022f, 0.87608999f},
-std::array<float,2>{0.767216265f, 0.00536136376f},
-std::array<float,2>{0.436754197f, 0.616878927f},
-std::array<float,2>{0.00399735756f, 0.0932009891f},
-std::array<float,2>{0.614915609f, 0.540555656f},
-std::array<float,2>{0.996502519f, 0.396722734f},
-std::array<float,2>{0.274511158f, 0.961151481f},
-std::array<float,2>{0.49319911f, 0.256690562f},
-std::array<float,2>{0.851196527f, 0.824956477f},
-std::array<float,2>{0.657020688f, 0.165803552f},
-std::array<float,2>{0.185868204f, 0.67246002f},
-std::array<float,2>{0.316748321f, 0.0805880949f},
-std::array<float,2>{0.917092741f, 0.531277418f},
-std::array<float,2>{0.503594518f, 0.402258784f},
-std::array<float,2>{0.0867992491f, 0.954860151f},
-std::array<float,2>{0.234376431f, 0.263761193f},
-std::array<float,2>{0.690149546f, 0.813591123f},
-std::array<float,2>{0.759325087f, 0.160811558f},
-std::array<float,2>{0.410008937f, 0.680487216f},
-std::array<float,2>{0.0213605314f, 0.248857319f},
-std::array<float,2>{0.603756845f, 0.70157975f},
-std::array<float,2>{0.970346212f, 0.316307902f},
-std::array<float,2>{0.265104204f, 0.760911763f},
-std::array<float,2>{0.48091647f, 0.453030527f},
-std::array<float,2>{0.861788392f, 0.889272392f},
-std::array<float,2>{0.672509074f, 0.0086142309f},
-std::array<float,2>{0.158383921f, 0.617929697f},
-std::array<float,2>{0.399220198f, 0.15050146f},
-std::array<float,2>{0.807182431f, 0.639740646f},
-std::array<float,2>{0.747185707f, 0.308766723f},
-std::array<float,2>{0.209502369f, 0.85068047f},
-std::array<float,2>{0.124453604f, 0.429295927f},
-std::array<float,2>{0.562302232f, 0.973789811f},
-std::array<float,2>{0.89593178f, 0.115216419f},
-std::array<float,2>{0.359709233f, 0.51986748f},
-std::array<float,2>{0.148164988f, 0.055781614f},
-std::array<float,2>{0.635666192f, 0.580530345f},
-std::array<float,2>{0.835150898f, 0.494683176f},
-std::array<float,2>{0.454718024f, 0.9224841f},
-std::array<float,2>{0.305955261f, 0.365290642f},
-std::array<float,2>{0.941511273f, 0.78395009f},
-std::array<float,2>{0.562648833f, 0.213928372f},
-std::array<float,2>{0.0363526866f, 0.745261252f},
-std::array<float,2>{0.448515803f, 0.0225115996f},
-std::array<float,2>{0.817992389f, 0.597930789f},
-std::array<float,2>{0.643844366f, 0.460580021f},
-std::array<float,2>{0.131288126f, 0.897172928f},
-std::array<float,2>{0.060876973f, 0.334196448f},
-std::array<float,2>{0.581925333f, 0.780147016f},
-std::array<float,2>{0.967755139f, 0.225703776f},
-std::array<float,2>{0.292864323f, 0.71167624f},
-std::array<float,2>{0.20291315f, 0.174448848f},
-std::array<float,2>{0.723736405f, 0.665921509f},
-std::array<float,2>{0.789762437f, 0.281155825f},
-std::array<float,2>{0.388135344f, 0.835055351f},
-std::array<float,2>{0.356340468f, 0.389046699f},
-std::array<float,2>{0.87867409f, 0.94577086f},
-std::array<float,2>{0.539408147f, 0.0658441484f},
-std::array<float,2>{0.0950974971f, 0.546949744f},
-std::array<float,2>{0.278797299f, 0.188760772f},
-std::array<float,2>{0.993836224f, 0.719378948f},
-std::array<float,2>{0.611840129f, 0.359336346f},
-std::array<float,2>{0.00121381017f, 0.805745184f},
-std::array<float,2>{0.182241306f, 0.477177441f},
-std::array<float,2>{0.661480844f, 0.907093227f},
-std::array<float,2>{0.844201624f, 0.0415038243f},
-std::array<float,2>{0.498200119f, 0.566969395f},
-std::array<float,2>{0.071243234f, 0.101783797f},
-std::array<float,2>{0.525127828f, 0.501926363f},
-std::array<float,2>{0.926518381f, 0.417189211f},
-std::array<float,2>{0.333606511f, 0.993781328f},
-std::array<float,2>{0.432549179f, 0.28370741f},
-std::array<float,2>{0.772380888f, 0.871532202f},
-std::array<float,2>{0.715302229f, 0.125110045f},
-std::array<float,2>{0.227825299f, 0.649171829f},
-std::array<float,2>{0.287170589f, 0.0368695483f},
-std::array<float,2>{0.955265343f, 0.576437056f},
-std::array<float,2>{0.590398252f, 0.47042352f},
-std::array<float,2>{0.0526013635f, 0.914533436f},
-std::array<float,2>{0.133533582f, 0.347055703f},
-std::array<float,2>{0.653709531f, 0.801291704f},
-std::array<float,2>{0.826506019f, 0.202849552f},
-std::array<float,2>{0.44321847f, 0.730298579f},
-std::array<float,2>{0.103949696f, 0.139447555f},
-std::array<float,2>{0.534297645f, 0.642917335f},
-std::array<float,2>{0.887871265f, 0.296028823f},
-std::array<float,2>{0.350099176f, 0.864354491f},
-std::array<float,2>{0.381959289f, 0.411998272f},
-std::array<float,2>{0.783636868f, 0.992164016f},
-std::array<float,2>{0.73315835f, 0.0968319252f},
-std::array<float,2>{0.190409198f, 0.509876847f},
-std::array<float,2>{0.486045897f, 0.229062051f},
-std::array<float,2>{0.854588568f, 0.7104882f},
-std::array<float,2>{0.669029951f, 0.339966714f},
-std::array<float,2>{0.17701523f, 0.772541225f},
-std::array<float,2>{0.00893403869f, 0.462353617f},
-std::array<float,2>{0.622482777f, 0.899316132f},
-std::array<float,2>{0.987527549f, 0.0299290419f},
-std::array<float,2>{0.268385679f, 0.608764648f},
-std::array<float,2>{0.220762938f, 0.0770642534f},
-std::array<float,2>{0.705723584f, 0.558395565f},
-std::array<float,2>{0.779431939f, 0.382349044f},
-std::array<float,2>{0.427961558f, 0.944471061f},
-std::array<float,2>{0.336781383f, 0.268136621f},
-std::array<float,2>{0.937386394f, 0.843340456f},
-std::array<float,2>{0.517791688f, 0.186457768f},
-std::array<float,2>{0.0692742765f, 0.656752288f},
-std::array<float,2>{0.417717427f, 0.122706309f},
-std::array<float,2>{0.756568015f, 0.526756465f},
-std::array<float,2>{0.696331203f, 0.43186149f},
-std::array<float,2>{0.249147162f, 0.980867445f},
-std::array<float,2>{0.080797255f, 0.30468145f},
-std::array<float,2>{0.512307405f, 0.857464492f},
-std::array<float,2>{0.911560953f, 0.141769558f},
-std::array<float,2>{0.32628569f, 0.63201499f},
-std::array<float,2>{0.167153701f, 0.204637989f},
-std::array<float,2>{0.680386305f, 0.739336014f},
-std::array<float,2>{0.871054113f, 0.370011598f},
-std::array<float,2>{0.469942153f, 0.792837203f},
-std::array<float,2>{0.250940651f, 0.490641713f},
-std::array<float,2>{0.978661299f, 0.932384491f},
-std::array<float,2>{0.599431574f, 0.0519836992f},
-std::array<float,2>{0.0262953844f, 0.591095746f},
-std::array<float,2>{0.370631784f, 0.168633997f},
-std::array<float,2>{0.899734676f, 0.676929116f},
-std::array<float,2>{0.551190913f, 0.251819313f},
-std::array<float,2>{0.110928766f, 0.823300958f},
-std::array<float,2>{0.213651523f, 0.391528338f},
-std::array<float,2>{0.736094594f, 0.967147052f},
-std::array<float,2>{0.802430212f, 0.0890608504f},
-std::array<float,2>{0.394051999f, 0.545332313f},
-std::array<float,2>{0.0421981402f, 0.000482116768f},
-std::array<float,2>{0.575522184f, 0.612886727f},
-std::array<float,2>{0.952204704f, 0.443456471f},
-std::array<float,2>{0.299846321f, 0.879837811f},
-std::array<float,2>{0.463602781f, 0.322502851f},
-std::array<float,2>{0.839955926f, 0.752848268f},
-std::array<float,2>{0.630005896f, 0.237100601f},
-std::array<float,2>{0.148514703f, 0.691800117f},
-std::array<float,2>{0.372166485f, 0.043910142f},
-std::array<float,2>{0.905736029f, 0.562720895f},
-std::array<float,2>{0.549738228f, 0.481696904f},
-std::array<float,2>{0.114733465f, 0.911837637f},
-std::array<float,2>{0.216184139f, 0.355380952f},
-std::array<float,2>{0.739479184f, 0.808758557f},
-std::array<float,2>{0.800677776f, 0.193417385f},
-std::array<float,2>{0.397040516f, 0.72421056f},
-std::array<float,2>{0.0430369116f, 0.130283594f},
-std::array<float,2>{0.572001576f, 0.655441344f},
-std::array<float,2>{0.945499778f, 0.287375867f},
-std::array<float,2>{0.301547736f, 0.867497683f},
-std::array<float,2>{0.467823327f, 0.420702755f},
-std::array<float,2>{0.836869717f, 0.997733414f},
-std::array<float,2>{0.627569914f, 0.106978849f},
-std::array<float,2>{0.155781478f, 0.504869401f},
-std::array<float,2>{0.41916135f, 0.221833691f},
-std::array<float,2>{0.752650678f, 0.717960715f},
-std::array<float,2>{0.70310998f, 0.330311686f},
-std::array<float,2>{0.242902055f, 0.776178241f},
-std::array<float,2>{0.0823039785f, 0.456210166f},
-std::array<float,2>{0.50971365f, 0.894396842f},
-std::array<float,2>{0.906746387f, 0.0166255943f},
-std::array<float,2>{0.321882993f, 0.596342325f},
-std::array<float,2>{0.169058248f, 0.0680027977f},
-std::array<float,2>{0.68716681f, 0.550998211f},
-std::array<float,2>{0.871955812f, 0.384336352f},
-std::array<float,2>{0.473498583f, 0.949227571f},
-std::array<float,2>{0.254456282f, 0.277083039f},
-std::array<float,2>{0.982149899f, 0.831488252f},
-std::array<float,2>{0.593797445f, 0.176936328f},
-std::array<float,2>{0.0282581411f, 0.670645118f},
-std::array<float,2>{0.48836568f, 0.111657448f},
-std::array<float,2>{0.857084572f, 0.518041551f},
-std::array<float,2>{0.666698515f, 0.424858838f},
-std::array<float,2>{0.173586577f, 0.969215274f},
-std::array<float,2>{0.0147874383f, 0.307071894f},
-std::array<float,2>{0.61940372f, 0.844178379f},
-std::array<float,2>{0.990663171f, 0.154237852f},
-std::array<float,2>{0.271873444f, 0.634864569f},
-std::array<float,2>{0.225474298f, 0.216660872f},
-std::array<float,2>{0.710360765f, 0.749649286f},
-std::array<float,2>{0.776608407f, 0.362326235f},
-std::array<float,2>{0.424868256f, 0.788918555f},
-std::array<float,2>{0.339955688f, 0.499866843f},
-std::array<float,2>{0.933257103f, 0.927056611f},
-std::array<float,2>{0.523335516f, 0.0624433905f},
-std::array<float,2>{0.0659189224f, 0.582217455f},
-std::array<float,2>{0.285016418f, 0.157611161f},
-std::array<float,2>{0.958473444f, 0.686003268f},
-std::array<float,2>{0.589822292f, 0.260068923f},
-std::array<float,2>{0.0498318635f, 0.818489015f},
-std::array<float,2>{0.137962088f, 0.402910203f},
-std::array<float,2>{0.65085113f, 0.960889459f},
-std::array<float,2>{0.823224664f, 0.0854096487f},
-std::array<float,2>{0.438795269f, 0.535200775f},
-std::array<float,2>{0.10596662f, 0.0126480274f},
-std::array<float,2>{0.538214326f, 0.624949574f},
-std::array<float,2>{0.884429514f, 0.445778579f},
-std::array<float,2>{0.344278485f, 0.883740604f},
-std::array<float,2>{0.377343148f, 0.317543745f},
-std::array<float,2>{0.788438976f, 0.762631714f},
-std::array<float,2>{0.727253199f, 0.246020377f},
-std::array<float,2>{0.192222148f, 0.697239935f},
-std::array<float,2>{0.273765832f, 0.0912533253f},
-std::array<float,2>{0.99789083f, 0.541909337f},
-std::array<float,2>{0.613501728f, 0.395762533f},
-std::array<float,2>{0.00537589053f, 0.963461399f},
-std::array<float,2>{0.186891705f, 0.255119413f},
-std::array<float,2>{0.657939613f, 0.827788651f},
-std::array<float,2>{0.850016594f, 0.166457653f},
-std::array<float,2>{0.492347091f, 0.673896313f},
-std::array<float,2>{0.0777346641f, 0.239589542f},
-std::array<float,2>{0.528298855f, 0.691297948f},
-std::array<float,2>{0.925229609f, 0.327681839f},
-std::array<float,2>{0.329124719f, 0.75495106f},
-std::array<float,2>{0.436482221f, 0.437889427f},
-std::array<float,2>{0.766428947f, 0.877766013f},
-std::array<float,2>{0.712926686f, 0.00712159881f},
-std::array<float,2>{0.230930358f, 0.614007652f},
-std::array<float,2>{0.450945586f, 0.147327095f},
-std::array<float,2>{0.814739466f, 0.628534138f},
-std::array<float,2>{0.648107708f, 0.298291564f},
-std::array<float,2>{0.126983166f, 0.853672385f},
-std::array<float,2>{0.0572437346f, 0.434265673f},
-std::array<float,2>{0.585782111f, 0.979347587f},
-std::array<float,2>{0.961884618f, 0.118322082f},
-std::array<float,2>{0.294411302f, 0.528274596f},
-std::array<float,2>{0.195348531f, 0.0496355221f},
-std::array<float,2>{0.720829844f, 0.588448763f},
-std::array<float,2>{0.793350577f, 0.486496598f},
-std::array<float,2>{0.386059612f, 0.935271382f},
-std::array<float,2>{0.351592392f, 0.374886811f},
-std::array<float,2>{0.882582366f, 0.79417783f},
-std::array<float,2>{0.546540797f, 0.20856972f},
-std::array<float,2>{0.100810081f, 0.734590769f},
-std::array<float,2>{0.402972221f, 0.0258400105f},
-std::array<float,2>{0.81053561f, 0.604049563f},
-std::array<float,2>{0.744222105f, 0.467185527f},
-std::array<float,2>{0.203731477f, 0.903596938f},
-std::array<float,2>{0.117978893f, 0.338730514f},
-std::array<float,2>{0.555741251f, 0.766126215f},
-std::array<float,2>{0.89405638f, 0.23054263f},
-std::array<float,2>{0.366840959f, 0.704409778f},
-std::array<float,2>{0.141960263f, 0.181479588f},
-std::array<float,2>{0.637872696f, 0.660281897f},
-std::array<float,2>{0.82890743f, 0.270302743f},
-std::array<float,2>{0.457768589f, 0.838017881f},
-std::array<float,2>{0.310880244f, 0.375096947f},
-std::array<float,2>{0.939955354f, 0.939860284f},
-std::array<float,2>{0.568527341f, 0.0706582367f},
-std::array<float,2>{0.0330430903f, 0.560908437f},
-std::array<float,2>{0.314126611f, 0.199103013f},
-std::array<float,2>{0.921715379f, 0.731648445f},
-std::array<float,2>{0.506132901f, 0.351146072f},
-std::array<float,2>{0.0926990956f, 0.800767958f},
-std::array<float,2>{0.238928348f, 0.475666344f},
-std::array<float,2>{0.6932019f, 0.91968596f},
-std::array<float,2>{0.762246013f, 0.0315896608f},
-std::array<float,2>{0.413875669f, 0.570877016f},
-std::array<float,2>{0.0164789706f, 0.0979507416f},
-std::array<float,2>{0.608620405f, 0.513308108f},
-std::array<float,2>{0.974312305f, 0.407867849f},
-std::array<float,2>{0.259323329f, 0.98491329f},
-std::array<float,2>{0.479281425f, 0.292192549f},
-std::array<float,2>{0.865379214f, 0.860721827f},
-std::array<float,2>{0.676328003f, 0.134219289f},
-std::array<float,2>{0.162026301f, 0.64608115f},
-std::array<float,2>{0.332318127f, 0.103776284f},
-std::array<float,2>{0.927263498f, 0.502851188f},
-std::array<float,2>{0.52381146f, 0.414640009f},
-std::array<float,2>{0.0716267601f, 0.994167149f},
-std::array<float,2>{0.227411076f, 0.281433582f},
-std::array<float,2>{0.716727436f, 0.873488665f},
-std::array<float,2>{0.772874057f, 0.128235996f},
-std::array<float,2>{0.433040828f, 0.652307689f},
-std::array<float,2>{0.00035905512f, 0.189497426f},
-std::array<float,2>{0.612662315f, 0.721349597f},
-std::array<float,2>{0.992936373f, 0.356122613f},
-std::array<float,2>{0.277536839f, 0.807528496f},
-std::array<float,2>{0.499205738f, 0.480467618f},
-std::array<float,2>{0.845041394f, 0.909204423f},
-std::array<float,2>{0.660875678f, 0.0409985706f},
-std::array<float,2>{0.183314696f, 0.56983155f},
-std::array<float,2>{0.387641877f, 0.173779607f},
-std::array<float,2>{0.790865421f, 0.667457104f},
-std::array<float,2>{0.722673595f, 0.278843641f},
-std::array<float,2>{0.201942265f, 0.832637608f},
-std::array<float,2>{0.094661206f, 0.388089448f},
-std::array<float,2>{0.540104687f, 0.947554052f},
-std::array<float,2>{0.87763381f, 0.0634858012f},
-std::array<float,2>{0.356772482f, 0.549530804f},
-std::array<float,2>{0.131997868f, 0.0213263575f},
-std::array<float,2>{0.643242061f, 0.60064131f},
-std::array<float,2>{0.816752732f, 0.457755715f},
-std::array<float,2>{0.448216677f, 0.895893395f},
-std::array<float,2>{0.291209072f, 0.332622617f},
-std::array<float,2>{0.968201399f, 0.778787911f},
-std::array<float,2>{0.580891013f, 0.224174038f},
-std::array<float,2>{0.0615640469f, 0.714809835f},
-std::array<float,2>{0.453997672f, 0.057808198f},
-std::array<float,2>{0.834257603f, 0.579595327f},
-std::array<float,2>{0.635971725f, 0.493562609f},
-std::array<float,2>{0.147021964f, 0.925374568f},
-std::array<float,2>{0.0359960087f, 0.363531768f},
-std::array<float,2>{0.564002514f, 0.781811118f},
-std::array<float,2>{0.942667842f, 0.212815359f},
-std::array<float,2>{0.304893017f, 0.743107796f},
-std::array<float,2>{0.210626766f, 0.150300846f},
-std::array<float,2>{0.746743619f, 0.637276947f},
-std::array<float,2>{0.807809293f, 0.312021494f},
-std::array<float,2>{0.399719298f, 0.849219441f},
-std::array<float,2>{0.360368073f, 0.426827937f},
-std::array<float,2>{0.895198166f, 0.97534889f},
-std::array<float,2>{0.56092447f, 0.11643742f},
-std::array<float,2>{0.123314537f, 0.523348391f},
-std::array<float,2>{0.263825774f, 0.246838912f},
-std::array<float,2>{0.969362974f, 0.70113188f},
-std::array<float,2>{0.604957044f, 0.312883615f},
-std::array<float,2>{0.0201864168f, 0.758717775f},
-std::array<float,2>{0.159374341f, 0.449534506f},
-std::array<float,2>{0.673538089f, 0.886783779f},
-std::array<float,2>{0.862475574f, 0.0116877127f},
-std::array<float,2>{0.481964856f, 0.61963886f},
-std::array<float,2>{0.087744683f, 0.0797581971f},
-std::array<float,2>{0.50256747f, 0.533592403f},
-std::array<float,2>{0.916133285f, 0.399910688f},
-std::array<float,2>{0.317960709f, 0.955542266f},
-std::array<float,2>{0.408404261f, 0.263256013f},
-std::array<float,2>{0.758731306f, 0.815615416f},
-std::array<float,2>{0.691351414f, 0.163950726f},
-std::array<float,2>{0.235866189f, 0.682540119f},
-std::array<float,2>{0.299366444f, 0.00313473959f},
-std::array<float,2>{0.951804101f, 0.610064149f},
-std::array<float,2>{0.574468195f, 0.443168908f},
-std::array<float,2>{0.0411426686f, 0.882264793f},
-std::array<float,2>{0.149435982f, 0.322241753f},
-std::array<float,2>{0.629384458f, 0.751553059f},
-std::array<float,2>{0.840976477f, 0.235856771f},
-std::array<float,2>{0.463971317f, 0.693444133f},
-std::array<float,2>{0.110201977f, 0.171586201f},
-std::array<float,2>{0.552097797f, 0.679036438f},
-std::array<float,2>{0.898958206f, 0.253784388f},
-std::array<float,2>{0.369450092f, 0.820776165f},
-std::array<float,2>{0.393035918f, 0.392948478f},
-std::array<float,2>{0.801422775f, 0.966512918f},
-std::array<float,2>{0.735075057f, 0.0863570347f},
-std::array<float,2>{0.214478612f, 0.544856846f},
-std::array<float,2>{0.469713598f, 0.206190914f},
-std::array<float,2>{0.86981523f, 0.741574943f},
-std::array<float,2>{0.680821598f, 0.36752376f},
-std::array<float,2>{0.166589499f, 0.790196896f},
-std::array<float,2>{0.0270587858f, 0.489013731f},
-std::array<float,2>{0.597825348f, 0.931239247f},
-std::array<float,2>{0.980254531f, 0.0529721901f},
-std::array<float,2>{0.251635134f, 0.593361855f},
-std::array<float,2>{0.248122633f, 0.123677433f},
-std::array<float,2>{0.695603549f, 0.523693562f},
-std::array<float,2>{0.757533312f, 0.430582047f},
-std::array<float,2>{0.416858435f, 0.984266698f},
-std::array<float,2>{0.327309042f, 0.301594287f},
-std::array<float,2>{0.910602272f, 0.856048584f},
-std::array<float,2>{0.513293147f, 0.143247008f},
-std::array<float,2>{0.0813835636f, 0.630708218f},
-std::array<float,2>{0.429525435f, 0.0751225799f},
-std::array<float,2>{0.781089067f, 0.555465162f},
-std::array<float,2>{0.70608449f, 0.37951234f},
-std::array<float,2>{0.221916169f, 0.941425204f},
-std::array<float,2>{0.0700272396f, 0.265937656f},
-std::array<float,2>{0.518929899f, 0.840375185f},
-std::array<float,2>{0.936189651f, 0.184985355f},
-std::array<float,2>{0.337066859f, 0.659176886f},
-std::array<float,2>{0.176153332f, 0.227475479f},
-std::array<float,2>{0.668864191f, 0.708877802f},
-std::array<float,2>{0.853592634f, 0.342446566f},
-std::array<float,2>{0.484786212f, 0.770068347f},
-std::array<float,2>{0.269322127f, 0.463933706f},
-std::array<float,2>{0.987300217f, 0.902216375f},
-std::array<float,2>{0.621751904f, 0.0282786861f},
-std::array<float,2>{0.0084488662f, 0.607196629f},
-std::array<float,2>{0.350757062f, 0.138240978f},
-std::array<float,2>{0.887128949f, 0.641476929f},
-std::array<float,2>{0.534024954f, 0.293598115f},
-std::array<float,2>{0.105254941f, 0.866014898f},
-std::array<float,2>{0.190808252f, 0.412281156f},
-std::array<float,2>{0.733529747f, 0.988442242f},
-std::array<float,2>{0.784184933f, 0.0943115577f},
-std::array<float,2>{0.381757617f, 0.508181214f},
-std::array<float,2>{0.0516061299f, 0.0382847935f},
-std::array<float,2>{0.590954781f, 0.575107694f},
-std::array<float,2>{0.956549287f, 0.471391648f},
-std::array<float,2>{0.288453102f, 0.916266084f},
-std::array<float,2>{0.44182989f, 0.344903946f},
-std::array<float,2>{0.827499211f, 0.803386748f},
-std::array<float,2>{0.65307188f, 0.200207084f},
-std::array<float,2>{0.134726331f, 0.72825712f},
-std::array<float,2>{0.322607517f, 0.0180083346f},
-std::array<float,2>{0.908318341f, 0.595170319f},
-std::array<float,2>{0.510699332f, 0.454085946f},
-std::array<float,2>{0.0854278952f, 0.892314255f},
-std::array<float,2>{0.244734555f, 0.32936132f},
-std::array<float,2>{0.700647593f, 0.775112271f},
-std::array<float,2>{0.75018692f, 0.219957039f},
-std::array<float,2>{0.420231104f, 0.716442466f},
-std::array<float,2>{0.0295208246f, 0.178190857f},
-std::array<float,2>{0.596355498f, 0.66835624f},
-std::array<float,2>{0.983192921f, 0.274603099f},
-std::array<float,2>{0.256718338f, 0.829327106f},
-std::array<float,2>{0.474715739f, 0.38670215f},
-std::array<float,2>{0.873598993f, 0.951384664f},
-std::array<float,2>{0.683898926f, 0.0696027726f},
-std::array<float,2>{0.170170397f, 0.554590166f},
-std::array<float,2>{0.395631462f, 0.192499086f},
-std::array<float,2>{0.797470391f, 0.725024402f},
-std::array<float,2>{0.742033422f, 0.353032887f},
-std::array<float,2>{0.217144385f, 0.811288953f},
-std::array<float,2>{0.115563959f, 0.482622385f},
-std::array<float,2>{0.547637045f, 0.912417471f},
-std::array<float,2>{0.903620541f, 0.0459668636f},
-std::array<float,2>{0.373199552f, 0.564930737f},
-std::array<float,2>{0.15283671f, 0.109133169f},
-std::array<float,2>{0.626110971f, 0.507676125f},
-std::array<float,2>{0.838035583f, 0.417998552f},
-std::array<float,2>{0.465500444f, 0.999882758f},
-std::array<float,2>{0.304680318f, 0.285779744f},
-std::array<float,2>{0.949099839f, 0.869590223f},
-std::array<float,2>{0.572901607f, 0.132573709f},
-std::array<float,2>{0.0450952128f, 0.653347135f},
-std::array<float,2>{0.440179795f, 0.083856523f},
-std::array<float,2>{0.82082206f, 0.537883818f},
-std::array<float,2>{0.648567319f, 0.405767113f},
-std::array<float,2>{0.139672458f, 0.957831681f},
-std::array<float,2>{0.0485983677f, 0.258897066f},
-std::array<float,2>{0.587032318f, 0.816476703f},
-std::array<float,2>{0.960617721f, 0.159640685f},
-std::array<float,2>{0.281796694f, 0.684880912f},
-std::array<float,2>{0.193787217f, 0.242241398f},
-std::array<float,2>{0.728756547f, 0.699188173f},
-std::array<float,2>{0.786433101f, 0.31867215f},
-std::array<float,2>{0.376917869f, 0.764042974f},
-std::array<float,2>{0.347643793f, 0.448482752f},
-std::array<float,2>{0.886351883f, 0.885489643f},
-std::array<float,2>{0.535992265f, 0.0138335424f},
-std::array<float,2>{0.107551694f, 0.622903109f},
-std::array<float,2>{0.2697846f, 0.156065837f},
-std::array<float,2>{0.989622414f, 0.633655012f},
-std::array<float,2>{0.618525803f, 0.306461245f},
-std::array<float,2>{0.0135722561f, 0.8457219f},
-std::array<float,2>{0.175427526f, 0.423153579f},
-std::array<float,2>{0.665466487f, 0.972497225f},
-std::array<float,2>{0.859167576f, 0.109587453f},
-std::array<float,2>{0.491751075f, 0.515774667f},
-std::array<float,2>{0.0627866611f, 0.0591109805f},
-std::array<float,2>{0.519831479f, 0.584245086f},
-std::array<float,2>{0.93001008f, 0.497477591f},
-std::array<float,2>{0.342524707f, 0.92874372f},
-std::array<float,2>{0.423626989f, 0.359575301f},
-std::array<float,2>{0.773953736f, 0.786592901f},
-std::array<float,2>{0.708135962f, 0.217504233f},
-std::array<float,2>{0.22397171f, 0.746735156f},
-std::array<float,2>{0.296203077f, 0.119342558f},
-std::array<float,2>{0.963985503f, 0.531206906f},
-std::array<float,2>{0.582390487f, 0.435581714f},
-std::array<float,2>{0.0551763885f, 0.978378654f},
-std::array<float,2>{0.125527859f, 0.29902631f},
-std::array<float,2>{0.645068944f, 0.852777839f},
-std::array<float,2>{0.813856542f, 0.145230561f},
-std::array<float,2>{0.452873081f, 0.626922429f},
-std::array<float,2>{0.0989285186f, 0.210755751f},
-std::array<float,2>{0.544172108f, 0.738074005f},
-std::array<float,2>{0.880364954f, 0.372914732f},
-std::array<float,2>{0.354783714f, 0.795993984f},
-std::array<float,2>{0.384147137f, 0.486301661f},
-std::array<float,2>{0.796744347f, 0.937369287f},
-std::array<float,2>{0.719146967f, 0.0469926707f},
-std::array<float,2>{0.198163033f, 0.586619079f},
-std::array<float,2>{0.495603979f, 0.164613992f},
-std::array<float,2>{0.848210573f, 0.673097849f},
-std::array<float,2>{0.659308016f, 0.2574628f},
-std::array<float,2>{0.185096383f, 0.825620055f},
-std::array<float,2>{0.00736624701f, 0.397684067f},
-std::array<float,2>{0.615262628f, 0.962885857f},
-std::array<float,2>{0.999565125f, 0.0921938494f},
-std::array<float,2>{0.276458621f, 0.539681077f},
-std::array<float,2>{0.233008444f, 0.00404924853f},
-std::array<float,2>{0.711085141f, 0.615297675f},
-std::array<float,2>{0.768609703f, 0.44059521f},
-std::array<float,2>{0.434417784f, 0.875349045f},
-std::array<float,2>{0.330672503f, 0.325633675f},
-std::array<float,2>{0.923284173f, 0.755940914f},
-std::array<float,2>{0.52990061f, 0.241053715f},
-std::array<float,2>{0.0743225291f, 0.687990606f},
-std::array<float,2>{0.411522537f, 0.0335052647f},
-std::array<float,2>{0.764909804f, 0.573653698f},
-std::array<float,2>{0.694386959f, 0.472819775f},
-std::array<float,2>{0.241598159f, 0.92069453f},
-std::array<float,2>{0.0915639326f, 0.348788589f},
-std::array<float,2>{0.504890561f, 0.797436833f},
-std::array<float,2>{0.919144154f, 0.196897611f},
-std::array<float,2>{0.316102505f, 0.734157801f},
-std::array<float,2>{0.164055616f, 0.13586092f},
-std::array<float,2>{0.678380668f, 0.647993624f},
-std::array<float,2>{0.863717377f, 0.290961266f},
-std::array<float,2>{0.477974892f, 0.86288631f},
-std::array<float,2>{0.260404944f, 0.408508569f},
-std::array<float,2>{0.975207746f, 0.988237083f},
-std::array<float,2>{0.607130468f, 0.0999331772f},
-std::array<float,2>{0.0180026256f, 0.514902532f},
-std::array<float,2>{0.363879114f, 0.233870953f},
-std::array<float,2>{0.890931547f, 0.706464887f},
-std::array<float,2>{0.557435513f, 0.337721467f},
-std::array<float,2>{0.120303936f, 0.769530475f},
-std::array<float,2>{0.205124214f, 0.466553181f},
-std::array<float,2>{0.742890656f, 0.905528545f},
-std::array<float,2>{0.812453032f, 0.0243202839f},
-std::array<float,2>{0.405914664f, 0.602490425f},
-std::array<float,2>{0.0348392911f, 0.0735010654f},
-std::array<float,2>{0.567832351f, 0.560005248f},
-std::array<float,2>{0.938065529f, 0.37717393f},
-std::array<float,2>{0.309904873f, 0.938104749f},
-std::array<float,2>{0.460619986f, 0.271992207f},
-std::array<float,2>{0.830130816f, 0.836124837f},
-std::array<float,2>{0.639536381f, 0.182939216f},
-std::array<float,2>{0.142849609f, 0.663614333f},
-std::array<float,2>{0.359341562f, 0.0650555044f},
-std::array<float,2>{0.875499845f, 0.548048079f},
-std::array<float,2>{0.541265786f, 0.390407979f},
-std::array<float,2>{0.0974903107f, 0.947150648f},
-std::array<float,2>{0.199508294f, 0.279464751f},
-std::array<float,2>{0.725191712f, 0.834121943f},
-std::array<float,2>{0.792641938f, 0.17550607f},
-std::array<float,2>{0.388860196f, 0.664971232f},
-std::array<float,2>{0.0586938001f, 0.225350857f},
-std::array<float,2>{0.578408539f, 0.712186038f},
-std::array<float,2>{0.965999365f, 0.335207105f},
-std::array<float,2>{0.290323675f, 0.780506492f},
-std::array<float,2>{0.447066158f, 0.459948719f},
-std::array<float,2>{0.818363845f, 0.897507966f},
-std::array<float,2>{0.641293585f, 0.0215117931f},
-std::array<float,2>{0.12997058f, 0.599460661f},
-std::array<float,2>{0.42974633f, 0.126616746f},
-std::array<float,2>{0.77028352f, 0.649652243f},
-std::array<float,2>{0.717410088f, 0.285083234f},
-std::array<float,2>{0.230006844f, 0.872609913f},
-std::array<float,2>{0.0727747381f, 0.41654554f},
-std::array<float,2>{0.526077271f, 0.992643654f},
-std::array<float,2>{0.928723335f, 0.102973573f},
-std::array<float,2>{0.335620493f, 0.500200212f},
-std::array<float,2>{0.181561291f, 0.0425367132f},
-std::array<float,2>{0.662384272f, 0.567409217f},
-std::array<float,2>{0.84721446f, 0.47784701f},
-std::array<float,2>{0.497506469f, 0.907634974f},
-std::array<float,2>{0.27991432f, 0.358126879f},
-std::array<float,2>{0.995785892f, 0.805447459f},
-std::array<float,2>{0.611200035f, 0.187622398f},
-std::array<float,2>{0.00250140345f, 0.720509112f},
-std::array<float,2>{0.483996779f, 0.00884004589f},
-std::array<float,2>{0.859643042f, 0.618407667f},
-std::array<float,2>{0.674693704f, 0.4514108f},
-std::array<float,2>{0.157448843f, 0.890313089f},
-std::array<float,2>{0.0232004095f, 0.314491957f},
-std::array<float,2>{0.601724803f, 0.760250032f},
-std::array<float,2>{0.971761882f, 0.249556467f},
-std::array<float,2>{0.261898369f, 0.703121722f},
-std::array<float,2>{0.237022117f, 0.16168578f},
-std::array<float,2>{0.689002752f, 0.681131721f},
-std::array<float,2>{0.760288715f, 0.265340775f},
-std::array<float,2>{0.407432348f, 0.812594175f},
-std::array<float,2>{0.319939673f, 0.400630891f},
-std::array<float,2>{0.914579988f, 0.953870535f},
-std::array<float,2>{0.500760198f, 0.0818268284f},
-std::array<float,2>{0.0897067115f, 0.532551885f},
-std::array<float,2>{0.307594687f, 0.213854715f},
-std::array<float,2>{0.944720447f, 0.744842529f},
-std::array<float,2>{0.565358281f, 0.367096692f},
-std::array<float,2>{0.039053686f, 0.784671545f},
-std::array<float,2>{0.144897819f, 0.496002197f},
-std::array<float,2>{0.633992791f, 0.923247755f},
-std::array<float,2>{0.832427919f, 0.0555156022f},
-std::array<float,2>{0.456525683f, 0.581775725f},
-std::array<float,2>{0.122103497f, 0.114202552f},
-std::array<float,2>{0.559639633f, 0.520845234f},
-std::array<float,2>{0.898057044f, 0.428600907f},
-std::array<float,2>{0.362648219f, 0.97304523f},
-std::array<float,2>{0.401301533f, 0.310271531f},
-std::array<float,2>{0.804868102f, 0.85001111f},
-std::array<float,2>{0.74935168f, 0.152051359f},
-std::array<float,2>{0.207797423f, 0.639433622f},
-std::array<float,2>{0.253302783f, 0.0516993403f},
-std::array<float,2>{0.978096485f, 0.590670049f},
-std::array<float,2>{0.600166738f, 0.49131605f},
-std::array<float,2>{0.0248729698f, 0.933209658f},
-std::array<float,2>{0.165229514f, 0.370334148f},
-std::array<float,2>{0.683415473f, 0.791961133f},
-std::array<float,2>{0.86777091f, 0.20325543f},
-std::array<float,2>{0.472313941f, 0.738656282f},
-std::array<float,2>{0.0789295882f, 0.14138326f},
-std::array<float,2>{0.514530063f, 0.631084502f},
-std::array<float,2>{0.913581669f, 0.303066492f},
-std::array<float,2>{0.325710505f, 0.858537793f},
-std::array<float,2>{0.414961636f, 0.43304956f},
-std::array<float,2>{0.754938781f, 0.98213625f},
-std::array<float,2>{0.698886871f, 0.121657133f},
-std::array<float,2>{0.246182665f, 0.525646627f},
-std::array<float,2>{0.461340547f, 0.237739801f},
-std::array<float,2>{0.842496514f, 0.693194449f},
-std::array<float,2>{0.631423593f, 0.324169248f},
-std::array<float,2>{0.152246341f, 0.753599942f},
-std::array<float,2>{0.0394026972f, 0.444553375f},
-std::array<float,2>{0.576562941f, 0.880543888f},
-std::array<float,2>{0.950208783f, 0.00124028011f},
-std::array<float,2>{0.298187345f, 0.611626327f},
-std::array<float,2>{0.211699381f, 0.0881920978f},
-std::array<float,2>{0.736610234f, 0.546282291f},
-std::array<float,2>{0.802896619f, 0.392067164f},
-std::array<float,2>{0.39255178f, 0.968418181f},
-std::array<float,2>{0.367963105f, 0.250611961f},
-std::array<float,2>{0.90204978f, 0.822289228f},
-std::array<float,2>{0.55423373f, 0.169469446f},
-std::array<float,2>{0.113200553f, 0.676749885f},
-std::array<float,2>{0.379671097f, 0.0962589383f},
-std::array<float,2>{0.781637967f, 0.511153579f},
-std::array<float,2>{0.730732262f, 0.410972118f},
-std::array<float,2>{0.18809092f, 0.99119693f},
-std::array<float,2>{0.101739742f, 0.295021504f},
-std::array<float,2>{0.531600118f, 0.863591135f},
-std::array<float,2>{0.889497995f, 0.140002832f},
-std::array<float,2>{0.348977953f, 0.643856466f},
-std::array<float,2>{0.135212556f, 0.202086717f},
-std::array<float,2>{0.656069636f, 0.729461491f},
-std::array<float,2>{0.824221075f, 0.346044749f},
-std::array<float,2>{0.44513613f, 0.802527547f},
-std::array<float,2>{0.286519974f, 0.469032109f},
-std::array<float,2>{0.953283906f, 0.915494502f},
-std::array<float,2>{0.592852235f, 0.0359897502f},
-std::array<float,2>{0.0530769303f, 0.577296197f},
-std::array<float,2>{0.339806944f, 0.187451676f},
-std::array<float,2>{0.934825718f, 0.657646477f},
-std::array<float,2>{0.51703155f, 0.26905489f},
-std::array<float,2>{0.0664561167f, 0.841874778f},
-std::array<float,2>{0.219859466f, 0.380887538f},
-std::array<float,2>{0.704267859f, 0.943796992f},
-std::array<float,2>{0.77826184f, 0.0779034942f},
-std::array<float,2>{0.427308738f, 0.557424963f},
-std::array<float,2>{0.0108318888f, 0.0308844913f},
-std::array<float,2>{0.623464704f, 0.607625186f},
-std::array<float,2>{0.985565245f, 0.461192399f},
-std::array<float,2>{0.267341048f, 0.900054216f},
-std::array<float,2>{0.486510247f, 0.341441065f},
-std::array<float,2>{0.853120506f, 0.77242887f},
-std::array<float,2>{0.671173215f, 0.230239779f},
-std::array<float,2>{0.178474739f, 0.709762692f},
-std::array<float,2>{0.315561265f, 0.0320809223f},
-std::array<float,2>{0.919457495f, 0.570315182f},
-std::array<float,2>{0.505755007f, 0.476433933f},
-std::array<float,2>{0.0910600498f, 0.918998778f},
-std::array<float,2>{0.241950169f, 0.350950837f},
-std::array<float,2>{0.695304692f, 0.800213397f},
-std::array<float,2>{0.765471041f, 0.198388189f},
-std::array<float,2>{0.411698878f, 0.732310176f},
-std::array<float,2>{0.0184895825f, 0.134436458f},
-std::array<float,2>{0.606542885f, 0.645620406f},
-std::array<float,2>{0.974868715f, 0.292721033f},
-std::array<float,2>{0.259775668f, 0.861030579f},
-std::array<float,2>{0.478394389f, 0.407256991f},
-std::array<float,2>{0.864045858f, 0.984411657f},
-std::array<float,2>{0.677774489f, 0.0982158855f},
-std::array<float,2>{0.163287595f, 0.512970567f},
-std::array<float,2>{0.405665487f, 0.231330052f},
-std::array<float,2>{0.811977386f, 0.704800904f},
-std::array<float,2>{0.742482483f, 0.337906718f},
-std::array<float,2>{0.205943808f, 0.765888989f},
-std::array<float,2>{0.120848313f, 0.46770215f},
-std::array<float,2>{0.55694598f, 0.903832793f},
-std::array<float,2>{0.891347289f, 0.0260194298f},
-std::array<float,2>{0.363648444f, 0.603628874f},
-std::array<float,2>{0.143358141f, 0.0710770041f},
-std::array<float,2>{0.638957441f, 0.561434567f},
-std::array<float,2>{0.831038654f, 0.375527501f},
-std::array<float,2>{0.460385621f, 0.939978361f},
-std::array<float,2>{0.310468912f, 0.269896835f},
-std::array<float,2>{0.937740564f, 0.838863194f},
-std::array<float,2>{0.568114638f, 0.181089833f},
-std::array<float,2>{0.034542527f, 0.660717785f},
-std::array<float,2>{0.452495307f, 0.119030021f},
-std::array<float,2>{0.814094722f, 0.527350426f},
-std::array<float,2>{0.644988716f, 0.433713078f},
-std::array<float,2>{0.125073209f, 0.978948832f},
-std::array<float,2>{0.0551237389f, 0.298824191f},
-std::array<float,2>{0.582607269f, 0.854111612f},
-std::array<float,2>{0.964755535f, 0.146966979f},
-std::array<float,2>{0.296709269f, 0.628408134f},
-std::array<float,2>{0.197567567f, 0.20838517f},
-std::array<float,2>{0.719367981f, 0.735291779f},
-std::array<float,2>{0.79630506f, 0.374192506f},
-std::array<float,2>{0.384462953f, 0.794504106f},
-std::array<float,2>{0.355381042f, 0.487070978f},
-std::array<float,2>{0.880772233f, 0.934975147f},
-std::array<float,2>{0.544588208f, 0.0491605997f},
-std::array<float,2>{0.099138923f, 0.588096917f},
-std::array<float,2>{0.277112603f, 0.166839391f},
-std::array<float,2>{0.999508083f, 0.674667597f},
-std::array<float,2>{0.616001487f, 0.255677968f},
-std::array<float,2>{0.00700115925f, 0.827199638f},
-std::array<float,2>{0.184740335f, 0.39605099f},
-std::array<float,2>{0.66002208f, 0.963172376f},
-std::array<float,2>{0.848118663f, 0.0915348381f},
-std::array<float,2>{0.495824218f, 0.541239023f},
-std::array<float,2>{0.0747430846f, 0.00759479078f},
-std::array<float,2>{0.529579818f, 0.613588989f},
-std::array<float,2>{0.92341429f, 0.438193053f},
-std::array<float,2>{0.330362052f, 0.877272129f},
-std::array<float,2>{0.433663756f, 0.327361584f},
-std::array<float,2>{0.769238472f, 0.755556345f},
-std::array<float,2>{0.711808681f, 0.239909336f},
-std::array<float,2>{0.232867092f, 0.690654218f},
-std::array<float,2>{0.281503767f, 0.0859235078f},
-std::array<float,2>{0.959968448f, 0.535754144f},
-std::array<float,2>{0.587734401f, 0.402445614f},
-std::array<float,2>{0.0482036583f, 0.959960938f},
-std::array<float,2>{0.140572414f, 0.260357946f},
-std::array<float,2>{0.649204731f, 0.819085538f},
-std::array<float,2>{0.820468605f, 0.157810077f},
-std::array<float,2>{0.43953231f, 0.686063886f},
-std::array<float,2>{0.107954785f, 0.24557054f},
-std::array<float,2>{0.535390317f, 0.696697176f},
-std::array<float,2>{0.885865271f, 0.318136483f},
-std::array<float,2>{0.34681648f, 0.761883616f},
-std::array<float,2>{0.37601921f, 0.446215719f},
-std::array<float,2>{0.786689162f, 0.883148551f},
-std::array<float,2>{0.729331374f, 0.0118652172f},
-std::array<float,2>{0.194034025f, 0.624174953f},
-std::array<float,2>{0.491422713f, 0.153372452f},
-std::array<float,2>{0.858551443f, 0.635440886f},
-std::array<float,2>{0.665760338f, 0.307325661f},
-std::array<float,2>{0.175193176f, 0.844481707f},
-std::array<float,2>{0.0129583441f, 0.425774783f},
-std::array<float,2>{0.618954182f, 0.969688237f},
-std::array<float,2>{0.990139127f, 0.112179466f},
-std::array<float,2>{0.270322293f, 0.518256187f},
-std::array<float,2>{0.22427775f, 0.0616955794f},
-std::array<float,2>{0.708976567f, 0.582848012f},
-std::array<float,2>{0.773500621f, 0.499405742f},
-std::array<float,2>{0.423132032f, 0.927674651f},
-std::array<float,2>{0.342275918f, 0.363044977f},
-std::array<float,2>{0.930418611f, 0.788091123f},
-std::array<float,2>{0.520163238f, 0.215849385f},
-std::array<float,2>{0.0633080378f, 0.749287724f},
-std::array<float,2>{0.420835853f, 0.0174776576f},
-std::array<float,2>{0.750661314f, 0.595753908f},
-std::array<float,2>{0.700816035f, 0.456865728f},
-std::array<float,2>{0.244498432f, 0.893909752f},
-std::array<float,2>{0.0854747966f, 0.33081308f},
-std::array<float,2>{0.510083556f, 0.775634348f},
-std::array<float,2>{0.909061193f, 0.222448841f},
-std::array<float,2>{0.322904736f, 0.71859628f},
-std::array<float,2>{0.170659229f, 0.17746903f},
-std::array<float,2>{0.684108496f, 0.670401812f},
-std::array<float,2>{0.873396695f, 0.276792616f},
-std::array<float,2>{0.475353181f, 0.83170563f},
-std::array<float,2>{0.256313503f, 0.384064496f},
-std::array<float,2>{0.98246938f, 0.950055361f},
-std::array<float,2>{0.596031189f, 0.0676170439f},
-std::array<float,2>{0.0298797451f, 0.551303864f},
-std::array<float,2>{0.373967052f, 0.193967864f},
-std::array<float,2>{0.903974056f, 0.724061012f},
-std::array<float,2>{0.547317445f, 0.354508579f},
-std::array<float,2>{0.115941122f, 0.809520185f},
-std::array<float,2>{0.217338964f, 0.482399762f},
-std::array<float,2>{0.741401017f, 0.911328793f},
-std::array<float,2>{0.797229052f, 0.0432769842f},
-std::array<float,2>{0.396182954f, 0.563322365f},
-std::array<float,2>{0.0456783511f, 0.106860623f},
-std::array<float,2>{0.572322845f, 0.503985703f},
-std::array<float,2>{0.948363602f, 0.420210183f},
-std::array<float,2>{0.303793669f, 0.997180998f},
-std::array<float,2>{0.465326428f, 0.288065761f},
-std::array<float,2>{0.838796079f, 0.867964745f},
-std::array<float,2>{0.626773596f, 0.130751103f},
-std::array<float,2>{0.152683124f, 0.656100631f},
-std::array<float,2>{0.349151045f, 0.0941402987f},
-std::array<float,2>{0.889068127f, 0.508350313f},
-std::array<float,2>{0.531936944f, 0.413078398f},
-std::array<float,2>{0.102393672f, 0.989134252f},
-std::array<float,2>{0.187894836f, 0.293100357f},
-std::array<float,2>{0.731207728f, 0.865258455f},
-std::array<float,2>{0.782009184f, 0.137976408f},
-std::array<float,2>{0.379048765f, 0.640856504f},
-std::array<float,2>{0.0534091629f, 0.201087534f},
-std::array<float,2>{0.593502402f, 0.727923751f},
-std::array<float,2>{0.953722239f, 0.345245749f},
-std::array<float,2>{0.286953717f, 0.803154767f},
-std::array<float,2>{0.444572449f, 0.471062422f},
-std::array<float,2>{0.825077951f, 0.916704953f},
-std::array<float,2>{0.655581951f, 0.0385809727f},
-std::array<float,2>{0.135349408f, 0.574700832f},
-std::array<float,2>{0.426805347f, 0.185393155f},
-std::array<float,2>{0.777345717f, 0.658677995f},
-std::array<float,2>{0.704909623f, 0.266491681f},
-std::array<float,2>{0.220671892f, 0.840112507f},
-std::array<float,2>{0.0671722144f, 0.379077941f},
-std::array<float,2>{0.51752615f, 0.942313254f},
-std::array<float,2>{0.935479462f, 0.0744306818f},
-std::array<float,2>{0.339105219f, 0.554774106f},
-std::array<float,2>{0.177925766f, 0.0274883732f},
-std::array<float,2>{0.671605468f, 0.606899917f},
-std::array<float,2>{0.852891624f, 0.464561671f},
-std::array<float,2>{0.48703739f, 0.901795983f},
-std::array<float,2>{0.266777217f, 0.342181265f},
-std::array<float,2>{0.986302793f, 0.769976914f},
-std::array<float,2>{0.6238029f, 0.226751819f},
-std::array<float,2>{0.0117008826f, 0.708490789f},
-std::array<float,2>{0.471695453f, 0.0533362702f},
-std::array<float,2>{0.867402494f, 0.593036294f},
-std::array<float,2>{0.682703018f, 0.488350332f},
-std::array<float,2>{0.16585812f, 0.930879056f},
-std::array<float,2>{0.0251228157f, 0.36774531f},
-std::array<float,2>{0.599632323f, 0.790840805f},
-std::array<float,2>{0.97762394f, 0.20655866f},
-std::array<float,2>{0.25387755f, 0.742173374f},
-std::array<float,2>{0.24704732f, 0.142664537f},
-std::array<float,2>{0.698389828f, 0.629937351f},
-std::array<float,2>{0.755540192f, 0.301010936f},
-std::array<float,2>{0.414137065f, 0.85581708f},
-std::array<float,2>{0.325551569f, 0.429770857f},
-std::array<float,2>{0.913553476f, 0.983402371f},
-std::array<float,2>{0.514094055f, 0.123522975f},
-std::array<float,2>{0.0781709775f, 0.52407676f},
-std::array<float,2>{0.29849717f, 0.235704154f},
-std::array<float,2>{0.950886011f, 0.693943858f},
-std::array<float,2>{0.576689482f, 0.321338296f},
-std::array<float,2>{0.0396502987f, 0.751033425f},
-std::array<float,2>{0.151618585f, 0.442795753f},
-std::array<float,2>{0.631220996f, 0.882732868f},
-std::array<float,2>{0.842141569f, 0.00349344267f},
-std::array<float,2>{0.461797506f, 0.609786451f},
-std::array<float,2>{0.112393819f, 0.0869106278f},
-std::array<float,2>{0.554070055f, 0.543966115f},
-std::array<float,2>{0.90181762f, 0.393357307f},
-std::array<float,2>{0.367512792f, 0.966219425f},
-std::array<float,2>{0.39203307f, 0.253035456f},
-std::array<float,2>{0.803611159f, 0.82116878f},
-std::array<float,2>{0.737017334f, 0.171013534f},
-std::array<float,2>{0.211007044f, 0.679638922f},
-std::array<float,2>{0.262544543f, 0.0111107118f},
-std::array<float,2>{0.972402155f, 0.619366348f},
-std::array<float,2>{0.602243781f, 0.450040728f},
-std::array<float,2>{0.0228984654f, 0.887544572f},
-std::array<float,2>{0.157871038f, 0.313088417f},
-std::array<float,2>{0.674227178f, 0.757862091f},
-std::array<float,2>{0.859888136f, 0.246550098f},
-std::array<float,2>{0.483555138f, 0.700365007f},
-std::array<float,2>{0.0890276507f, 0.163233623f},
-std::array<float,2>{0.500168562f, 0.682069242f},
-std::array<float,2>{0.914245903f, 0.262724876f},
-std::array<float,2>{0.319617569f, 0.816340268f},
-std::array<float,2>{0.408026516f, 0.399481744f},
-std::array<float,2>{0.760031223f, 0.955952048f},
-std::array<float,2>{0.688521028f, 0.0791092664f},
-std::array<float,2>{0.236599207f, 0.534041166f},
-std::array<float,2>{0.45675084f, 0.212294728f},
-std::array<float,2>{0.832572877f, 0.742329776f},
-std::array<float,2>{0.634480476f, 0.36412698f},
-std::array<float,2>{0.145248964f, 0.7815727f},
-std::array<float,2>{0.038288556f, 0.49381119f},
-std::array<float,2>{0.564737082f, 0.924972415f},
-std::array<float,2>{0.944840252f, 0.0584377199f},
-std::array<float,2>{0.306862324f, 0.579272389f},
-std::array<float,2>{0.207479298f, 0.11716973f},
-std::array<float,2>{0.749591827f, 0.522935748f},
-std::array<float,2>{0.805510402f, 0.427513808f},
-std::array<float,2>{0.400684357f, 0.97462225f},
-std::array<float,2>{0.363132805f, 0.31186974f},
-std::array<float,2>{0.897566199f, 0.848999023f},
-std::array<float,2>{0.560374439f, 0.149418458f},
-std::array<float,2>{0.122777395f, 0.637028515f},
-std::array<float,2>{0.389327943f, 0.0642288029f},
-std::array<float,2>{0.792187452f, 0.549169302f},
-std::array<float,2>{0.725027621f, 0.388211012f},
-std::array<float,2>{0.20002839f, 0.948051751f},
-std::array<float,2>{0.0970712081f, 0.27872926f},
-std::array<float,2>{0.541963339f, 0.832245409f},
-std::array<float,2>{0.875075877f, 0.173189059f},
-std::array<float,2>{0.358756453f, 0.66760987f},
-std::array<float,2>{0.13054505f, 0.223905221f},
-std::array<float,2>{0.640699208f, 0.714028656f},
-std::array<float,2>{0.818927407f, 0.332491398f},
-std::array<float,2>{0.446676672f, 0.779014468f},
-std::array<float,2>{0.290881455f, 0.457356393f},
-std::array<float,2>{0.966766059f, 0.896420121f},
-std::array<float,2>{0.578968287f, 0.0208382625f},
-std::array<float,2>{0.0590895005f, 0.601472557f},
-std::array<float,2>{0.33541891f, 0.128819227f},
-std::array<float,2>{0.929448485f, 0.651850581f},
-std::array<float,2>{0.525641322f, 0.281869054f},
-std::array<float,2>{0.0727000758f, 0.873891175f},
-std::array<float,2>{0.229822233f, 0.414498538f},
-std::array<float,2>{0.717036426f, 0.994861126f},
-std::array<float,2>{0.76970309f, 0.104039595f},
-std::array<float,2>{0.430247128f, 0.502385139f},
-std::array<float,2>{0.00213883724f, 0.0404701456f},
-std::array<float,2>{0.610466003f, 0.569805086f},
-std::array<float,2>{0.995159745f, 0.479529232f},
-std::array<float,2>{0.279718101f, 0.910043776f},
-std::array<float,2>{0.497970343f, 0.355834544f},
-std::array<float,2>{0.846919537f, 0.806984782f},
-std::array<float,2>{0.66293329f, 0.190039262f},
-std::array<float,2>{0.180907845f, 0.720810115f},
-std::array<float,2>{0.366622329f, 0.0235273577f},
-std::array<float,2>{0.893995345f, 0.60172236f},
-std::array<float,2>{0.556507349f, 0.465953588f},
-std::array<float,2>{0.117490433f, 0.905938327f},
-std::array<float,2>{0.203300416f, 0.337317139f},
-std::array<float,2>{0.744836032f, 0.769026875f},
-std::array<float,2>{0.810004592f, 0.234363347f},
-std::array<float,2>{0.40261054f, 0.706799507f},
-std::array<float,2>{0.0325199254f, 0.183218405f},
-std::array<float,2>{0.568897963f, 0.663380682f},
-std::array<float,2>{0.93968451f, 0.271962792f},
-std::array<float,2>{0.311263174f, 0.836843371f},
-std::array<float,2>{0.457383335f, 0.377551258f},
-std::array<float,2>{0.828302801f, 0.937680066f},
-std::array<float,2>{0.63822788f, 0.0740080774f},
-std::array<float,2>{0.142447069f, 0.56049937f},
-std::array<float,2>{0.413273513f, 0.196417093f},
-std::array<float,2>{0.76172924f, 0.733561695f},
-std::array<float,2>{0.692524433f, 0.349207968f},
-std::array<float,2>{0.238571256f, 0.797210574f},
-std::array<float,2>{0.0922526717f, 0.473546654f},
-std::array<float,2>{0.50642246f, 0.919999242f},
-std::array<float,2>{0.921103418f, 0.0339484997f},
-std::array<float,2>{0.313603163f, 0.573838592f},
-std::array<float,2>{0.161370143f, 0.100216627f},
-std::array<float,2>{0.675929964f, 0.515377998f},
-std::array<float,2>{0.865991294f, 0.408805996f},
-std::array<float,2>{0.478542387f, 0.987381101f},
-std::array<float,2>{0.259044141f, 0.290513515f},
-std::array<float,2>{0.973686576f, 0.862353981f},
-std::array<float,2>{0.609102726f, 0.136323795f},
-std::array<float,2>{0.0157449506f, 0.647900343f},
-std::array<float,2>{0.4928734f, 0.0923181847f},
-std::array<float,2>{0.850228667f, 0.539454877f},
-std::array<float,2>{0.657360554f, 0.398008734f},
-std::array<float,2>{0.187319577f, 0.962235749f},
-std::array<float,2>{0.00497116009f, 0.256967723f},
-std::array<float,2>{0.614147604f, 0.826048553f},
-std::array<float,2>{0.997158051f, 0.164296135f},
-std::array<float,2>{0.274365723f, 0.673443079f},
-std::array<float,2>{0.231073454f, 0.240575075f},
-std::array<float,2>{0.713412464f, 0.687538028f},
-std::array<float,2>{0.765638232f, 0.326045454f},
-std::array<float,2>{0.435596406f, 0.756747961f},
-std::array<float,2>{0.329751939f, 0.440926194f},
-std::array<float,2>{0.925598443f, 0.875542045f},
-std::array<float,2>{0.527608097f, 0.00477190595f},
-std::array<float,2>{0.0773796961f, 0.616026938f},
-std::array<float,2>{0.294775605f, 0.144763634f},
-std::array<float,2>{0.961380303f, 0.626072705f},
-std::array<float,2>{0.585021019f, 0.299467832f},
-std::array<float,2>{0.0566772074f, 0.85313946f},
-std::array<float,2>{0.127844855f, 0.436253309f},
-std::array<float,2>{0.647679031f, 0.977601767f},
-std::array<float,2>{0.815241933f, 0.119708106f},
-std::array<float,2>{0.450651199f, 0.530574381f},
-std::array<float,2>{0.10134238f, 0.047569111f},
-std::array<float,2>{0.546162546f, 0.586003423f},
-std::array<float,2>{0.882143438f, 0.485673398f},
-std::array<float,2>{0.352340549f, 0.936670661f},
-std::array<float,2>{0.386690706f, 0.372316152f},
-std::array<float,2>{0.793749332f, 0.796784937f},
-std::array<float,2>{0.721244395f, 0.210381761f},
-std::array<float,2>{0.195964575f, 0.73779124f},
-std::array<float,2>{0.272350281f, 0.110075921f},
-std::array<float,2>{0.991085768f, 0.516452849f},
-std::array<float,2>{0.61976558f, 0.423750997f},
-std::array<float,2>{0.0154914614f, 0.972067893f},
-std::array<float,2>{0.172997147f, 0.306043327f},
-std::array<float,2>{0.66622442f, 0.846669674f},
-std::array<float,2>{0.856817067f, 0.155744463f},
-std::array<float,2>{0.489013791f, 0.633247375f},
-std::array<float,2>{0.0656654239f, 0.216977373f},
-std::array<float,2>{0.522465587f, 0.746417344f},
-std::array<float,2>{0.932938755f, 0.359932274f},
-std::array<float,2>{0.340768516f, 0.786677122f},
-std::array<float,2>{0.425741047f, 0.49796024f},
-std::array<float,2>{0.777326584f, 0.929203928f},
-std::array<float,2>{0.710719228f, 0.0586803034f},
-std::array<float,2>{0.224924564f, 0.584631443f},
-std::array<float,2>{0.439378202f, 0.159896746f},
-std::array<float,2>{0.822657108f, 0.68515718f},
-std::array<float,2>{0.650899708f, 0.25938493f},
-std::array<float,2>{0.138567463f, 0.817099512f},
-std::array<float,2>{0.050633166f, 0.405708432f},
-std::array<float,2>{0.589085102f, 0.957275569f},
-std::array<float,2>{0.958736837f, 0.0833485797f},
-std::array<float,2>{0.284198791f, 0.537577689f},
-std::array<float,2>{0.191753611f, 0.0146339303f},
-std::array<float,2>{0.726627886f, 0.622525752f},
-std::array<float,2>{0.788814306f, 0.449195147f},
-std::array<float,2>{0.377548963f, 0.885046065f},
-std::array<float,2>{0.344155222f, 0.318849504f},
-std::array<float,2>{0.884017646f, 0.764339268f},
-std::array<float,2>{0.538732827f, 0.2430069f},
-std::array<float,2>{0.105779052f, 0.698634863f},
-std::array<float,2>{0.396718323f, 0.0467264168f},
-std::array<float,2>{0.80014658f, 0.565327823f},
-std::array<float,2>{0.739937127f, 0.483206004f},
-std::array<float,2>{0.216550365f, 0.912745297f},
-std::array<float,2>{0.115130588f, 0.352829129f},
-std::array<float,2>{0.549304783f, 0.810654879f},
-std::array<float,2>{0.905958712f, 0.193013757f},
-std::array<float,2>{0.372602224f, 0.725407481f},
-std::array<float,2>{0.15553844f, 0.132118553f},
-std::array<float,2>{0.627364397f, 0.653981745f},
-std::array<float,2>{0.836320102f, 0.285316944f},
-std::array<float,2>{0.468669891f, 0.869803131f},
-std::array<float,2>{0.301208884f, 0.418893933f},
-std::array<float,2>{0.945940971f, 0.9993155f},
-std::array<float,2>{0.571466744f, 0.108467318f},
-std::array<float,2>{0.043732129f, 0.507240653f},
-std::array<float,2>{0.321628273f, 0.220426202f},
-std::array<float,2>{0.906477213f, 0.715936005f},
-std::array<float,2>{0.508984327f, 0.329788387f},
-std::array<float,2>{0.082728751f, 0.774508536f},
-std::array<float,2>{0.242201656f, 0.453349292f},
-std::array<float,2>{0.702566862f, 0.891747236f},
-std::array<float,2>{0.752332926f, 0.0183007792f},
-std::array<float,2>{0.419892967f, 0.595293462f},
-std::array<float,2>{0.0274672285f, 0.0701250657f},
-std::array<float,2>{0.59436512f, 0.553903043f},
-std::array<float,2>{0.981570065f, 0.386129379f},
-std::array<float,2>{0.254223734f, 0.951788068f},
-std::array<float,2>{0.472738564f, 0.275205255f},
-std::array<float,2>{0.87126565f, 0.830045164f},
-std::array<float,2>{0.686667562f, 0.178674489f},
-std::array<float,2>{0.169741094f, 0.66849339f},
-std::array<float,2>{0.337759942f, 0.0771989822f},
-std::array<float,2>{0.9356969f, 0.55698657f},
-std::array<float,2>{0.519126296f, 0.381579995f},
-std::array<float,2>{0.0695407316f, 0.944250643f},
-std::array<float,2>{0.222253829f, 0.268578023f},
-std::array<float,2>{0.706883609f, 0.842449307f},
-std::array<float,2>{0.780377269f, 0.186663419f},
-std::array<float,2>{0.428839535f, 0.658147871f},
-std::array<float,2>{0.00817679614f, 0.229570016f},
-std::array<float,2>{0.621369958f, 0.709040523f},
-std::array<float,2>{0.98648119f, 0.341283351f},
-std::array<float,2>{0.268941224f, 0.771850824f},
-std::array<float,2>{0.485310018f, 0.461447448f},
-std::array<float,2>{0.85400629f, 0.89942193f},
-std::array<float,2>{0.668406129f, 0.0304797459f},
-std::array<float,2>{0.176463336f, 0.608237684f},
-std::array<float,2>{0.380874842f, 0.140584275f},
-std::array<float,2>{0.784714043f, 0.644134641f},
-std::array<float,2>{0.733913064f, 0.295643508f},
-std::array<float,2>{0.191122621f, 0.86422962f},
-std::array<float,2>{0.104520261f, 0.410418272f},
-std::array<float,2>{0.533572614f, 0.990505874f},
-std::array<float,2>{0.887294352f, 0.0959940404f},
-std::array<float,2>{0.351374149f, 0.511624694f},
-std::array<float,2>{0.133909002f, 0.0354758911f},
-std::array<float,2>{0.652437091f, 0.577925265f},
-std::array<float,2>{0.827712655f, 0.469567627f},
-std::array<float,2>{0.44236511f, 0.915657938f},
-std::array<float,2>{0.288831145f, 0.346654713f},
-std::array<float,2>{0.956188679f, 0.802023172f},
-std::array<float,2>{0.591378808f, 0.201590315f},
-std::array<float,2>{0.0512189418f, 0.728558421f},
-std::array<float,2>{0.464842021f, 0.00147344603f},
-std::array<float,2>{0.841590345f, 0.611935318f},
-std::array<float,2>{0.62963438f, 0.445228308f},
-std::array<float,2>{0.150070652f, 0.880252361f},
-std::array<float,2>{0.0415190458f, 0.32341674f},
-std::array<float,2>{0.575025022f, 0.753006458f},
-std::array<float,2>{0.951575279f, 0.238263696f},
-std::array<float,2>{0.29910928f, 0.692422688f},
-std::array<float,2>{0.213904023f, 0.169266f},
-std::array<float,2>{0.734457493f, 0.675841689f},
-std::array<float,2>{0.800927818f, 0.250125885f},
-std::array<float,2>{0.393175036f, 0.823204637f},
-std::array<float,2>{0.36963129f, 0.392409027f},
-std::array<float,2>{0.898922563f, 0.968100488f},
-std::array<float,2>{0.552278161f, 0.0887175649f},
-std::array<float,2>{0.109646283f, 0.546417058f},
-std::array<float,2>{0.251064628f, 0.204002231f},
-std::array<float,2>{0.979710221f, 0.739002287f},
-std::array<float,2>{0.598316908f, 0.370691568f},
-std::array<float,2>{0.0264055021f, 0.791501403f},
-std::array<float,2>{0.166200101f, 0.491821021f},
-std::array<float,2>{0.681544483f, 0.93285495f},
-std::array<float,2>{0.869627714f, 0.0510292761f},
-std::array<float,2>{0.468770415f, 0.590139031f},
-std::array<float,2>{0.0818988904f, 0.121408239f},
-std::array<float,2>{0.512968659f, 0.525897503f},
-std::array<float,2>{0.910782814f, 0.433327138f},
-std::array<float,2>{0.328107059f, 0.981686115f},
-std::array<float,2>{0.416096121f, 0.303361118f},
-std::array<float,2>{0.757247388f, 0.859249532f},
-std::array<float,2>{0.695878625f, 0.140654773f},
-std::array<float,2>{0.248654783f, 0.631762028f},
-std::array<float,2>{0.305212468f, 0.0549870282f},
-std::array<float,2>{0.942888319f, 0.581186712f},
-std::array<float,2>{0.563822448f, 0.495335311f},
-std::array<float,2>{0.0352150798f, 0.923502207f},
-std::array<float,2>{0.146547362f, 0.366331846f},
-std::array<float,2>{0.636271179f, 0.78450042f},
-std::array<float,2>{0.834820271f, 0.213166818f},
-std::array<float,2>{0.453344256f, 0.74438566f},
-std::array<float,2>{0.123702116f, 0.151705757f},
-std::array<float,2>{0.561142862f, 0.639075518f},
-std::array<float,2>{0.894871473f, 0.309741557f},
-std::array<float,2>{0.361175895f, 0.850345075f},
-std::array<float,2>{0.400152594f, 0.428004444f},
-std::array<float,2>{0.808358312f, 0.973195672f},
-std::array<float,2>{0.746105552f, 0.11362417f},
-std::array<float,2>{0.210182473f, 0.521331549f},
-std::array<float,2>{0.481627554f, 0.249191046f},
-std::array<float,2>{0.86323458f, 0.702366948f},
-std::array<float,2>{0.672976255f, 0.315067083f},
-std::array<float,2>{0.160061881f, 0.760404468f},
-std::array<float,2>{0.0195633732f, 0.451788813f},
-std::array<float,2>{0.605036855f, 0.89010489f},
-std::array<float,2>{0.969040215f, 0.00931703392f},
-std::array<float,2>{0.264341176f, 0.61867255f},
-std::array<float,2>{0.235538945f, 0.0814833343f},
-std::array<float,2>{0.690832436f, 0.5330562f},
-std::array<float,2>{0.758000076f, 0.40106988f},
-std::array<float,2>{0.408833683f, 0.953345776f},
-std::array<float,2>{0.317760974f, 0.264651477f},
-std::array<float,2>{0.916956842f, 0.813044846f},
-std::array<float,2>{0.502064586f, 0.161546782f},
-std::array<float,2>{0.0873288661f, 0.68161267f},
-std::array<float,2>{0.433520287f, 0.103235438f},
-std::array<float,2>{0.773322701f, 0.500793695f},
-std::array<float,2>{0.715926766f, 0.416128993f},
-std::array<float,2>{0.226955548f, 0.99281621f},
-std::array<float,2>{0.0719527602f, 0.284622937f},
-std::array<float,2>{0.524362147f, 0.872203827f},
-std::array<float,2>{0.927147925f, 0.126363724f},
-std::array<float,2>{0.332871586f, 0.649998069f},
-std::array<float,2>{0.182698637f, 0.188018739f},
-std::array<float,2>{0.660302222f, 0.720089555f},
-std::array<float,2>{0.845313787f, 0.357760936f},
-std::array<float,2>{0.499745339f, 0.805046797f},
-std::array<float,2>{0.278047591f, 0.47824508f},
-std::array<float,2>{0.992476404f, 0.90790689f},
-std::array<float,2>{0.613079369f, 0.0423305817f},
-std::array<float,2>{0.000875164929f, 0.568030357f},
-std::array<float,2>{0.357157409f, 0.175076917f},
-std::array<float,2>{0.877187371f, 0.664106429f},
-std::array<float,2>{0.540913045f, 0.280150861f},
-std::array<float,2>{0.09383066f, 0.83467412f},
-std::array<float,2>{0.201294005f, 0.389769167f},
-std::array<float,2>{0.723401845f, 0.946486831f},
-std::array<float,2>{0.790374517f, 0.0649411529f},
-std::array<float,2>{0.387116641f, 0.548742056f},
-std::array<float,2>{0.0624944083f, 0.0220621563f},
-std::array<float,2>{0.580523431f, 0.598717272f},
-std::array<float,2>{0.968364418f, 0.459399223f},
-std::array<float,2>{0.29181239f, 0.898181081f},
-std::array<float,2>{0.447731137f, 0.335911781f},
-std::array<float,2>{0.817350566f, 0.780931711f},
-std::array<float,2>{0.642611623f, 0.22497721f},
-std::array<float,2>{0.132678226f, 0.71271503f},
-std::array<float,2>{0.352774262f, 0.0498921387f},
-std::array<float,2>{0.880859673f, 0.589306951f},
-std::array<float,2>{0.544971168f, 0.487505645f},
-std::array<float,2>{0.10008198f, 0.933759689f},
-std::array<float,2>{0.196834654f, 0.373440325f},
-std::array<float,2>{0.722216785f, 0.79334563f},
-std::array<float,2>{0.794531703f, 0.207836479f},
-std::array<float,2>{0.384802669f, 0.735991538f},
-std::array<float,2>{0.0579838194f, 0.148371205f},
-std::array<float,2>{0.584768057f, 0.627500653f},
-std::array<float,2>{0.962523878f, 0.297066569f},
-std::array<float,2>{0.293439537f, 0.854543924f},
-std::array<float,2>{0.449500591f, 0.434684873f},
-std::array<float,2>{0.815481603f, 0.979938626f},
-std::array<float,2>{0.646750271f, 0.117869973f},
-std::array<float,2>{0.128263727f, 0.528964281f},
-std::array<float,2>{0.437074304f, 0.239075556f},
-std::array<float,2>{0.76697582f, 0.689841628f},
-std::array<float,2>{0.714053214f, 0.326210558f},
-std::array<float,2>{0.232301354f, 0.754445851f},
-std::array<float,2>{0.0770867467f, 0.439010561f},
-std::array<float,2>{0.528784633f, 0.878085017f},
-std::array<float,2>{0.923900843f, 0.00643811515f},
-std::array<float,2>{0.328956276f, 0.614339173f},
-std::array<float,2>{0.186176971f, 0.0900475904f},
-std::array<float,2>{0.656653523f, 0.542401314f},
-std::array<float,2>{0.850656867f, 0.394797087f},
-std::array<float,2>{0.493690401f, 0.964421749f},
-std::array<float,2>{0.275131941f, 0.254542798f},
-std::array<float,2>{0.996952891f, 0.826959133f},
-std::array<float,2>{0.614676118f, 0.167911217f},
-std::array<float,2>{0.0045638578f, 0.675426006f},
-std::array<float,2>{0.480243444f, 0.0988165885f},
-std::array<float,2>{0.86691761f, 0.512692273f},
-std::array<float,2>{0.677019894f, 0.406890839f},
-std::array<float,2>{0.160444528f, 0.985844553f},
-std::array<float,2>{0.0169353485f, 0.291932732f},
-std::array<float,2>{0.607527494f, 0.859659016f},
-std::array<float,2>{0.973407865f, 0.13283439f},
-std::array<float,2>{0.258167982f, 0.644964576f},
-std::array<float,2>{0.239465907f, 0.197369024f},
-std::array<float,2>{0.692306101f, 0.730620384f},
-std::array<float,2>{0.763617992f, 0.349768877f},
-std::array<float,2>{0.412786901f, 0.798970044f},
-std::array<float,2>{0.312580466f, 0.47547397f},
-std::array<float,2>{0.920856833f, 0.917978346f},
-std::array<float,2>{0.506988525f, 0.032612469f},
-std::array<float,2>{0.092864044f, 0.571427047f},
-std::array<float,2>{0.311853379f, 0.180021822f},
-std::array<float,2>{0.940547764f, 0.661481738f},
-std::array<float,2>{0.569779515f, 0.271304727f},
-std::array<float,2>{0.0321439318f, 0.838976562f},
-std::array<float,2>{0.140891865f, 0.376461893f},
-std::array<float,2>{0.636985004f, 0.940773726f},
-std::array<float,2>{0.829618514f, 0.0715760067f},
-std::array<float,2>{0.458235413f, 0.561665714f},
-std::array<float,2>{0.118334427f, 0.0271317065f},
-std::array<float,2>{0.555614173f, 0.604831636f},
-std::array<float,2>{0.893146455f, 0.46843636f},
-std::array<float,2>{0.365576535f, 0.902449548f},
-std::array<float,2>{0.404007018f, 0.339333564f},
-std::array<float,2>{0.809418142f, 0.766877711f},
-std::array<float,2>{0.745769143f, 0.231647998f},
-std::array<float,2>{0.204711348f, 0.70390445f},
-std::array<float,2>{0.255062431f, 0.0669987202f},
-std::array<float,2>{0.980956972f, 0.552557826f},
-std::array<float,2>{0.595168114f, 0.383359522f},
-std::array<float,2>{0.029137399f, 0.950737536f},
-std::array<float,2>{0.168327704f, 0.276128083f},
-std::array<float,2>{0.685980082f, 0.830971897f},
-std::array<float,2>{0.872650564f, 0.176248536f},
-std::array<float,2>{0.473770887f, 0.671438515f},
-std::array<float,2>{0.0836381614f, 0.221257895f},
-std::array<float,2>{0.508019984f, 0.717681587f},
-std::array<float,2>{0.90724957f, 0.331382781f},
-std::array<float,2>{0.321044832f, 0.777027428f},
-std::array<float,2>{0.418729156f, 0.455118924f},
-std::array<float,2>{0.752995074f, 0.893306255f},
-std::array<float,2>{0.701483309f, 0.0156619735f},
-std::array<float,2>{0.243931592f, 0.596942306f},
-std::array<float,2>{0.46688354f, 0.12986441f},
-std::array<float,2>{0.837303698f, 0.654698253f},
-std::array<float,2>{0.62872541f, 0.288517535f},
-std::array<float,2>{0.155154616f, 0.86871773f},
-std::array<float,2>{0.0447346605f, 0.421694309f},
-std::array<float,2>{0.570722818f, 0.996572733f},
-std::array<float,2>{0.946876585f, 0.105727099f},
-std::array<float,2>{0.301772118f, 0.505573034f},
-std::array<float,2>{0.215121523f, 0.044738926f},
-std::array<float,2>{0.738634229f, 0.564439952f},
-std::array<float,2>{0.799131513f, 0.480819941f},
-std::array<float,2>{0.397588044f, 0.910395861f},
-std::array<float,2>{0.371722549f, 0.354189664f},
-std::array<float,2>{0.905064881f, 0.809753716f},
-std::array<float,2>{0.550191939f, 0.194488108f},
-std::array<float,2>{0.113752529f, 0.723042428f},
-std::array<float,2>{0.378322423f, 0.0128588863f},
-std::array<float,2>{0.787115872f, 0.623515487f},
-std::array<float,2>{0.727796316f, 0.447041422f},
-std::array<float,2>{0.192574888f, 0.883892775f},
-std::array<float,2>{0.106928542f, 0.316628307f},
-std::array<float,2>{0.537499607f, 0.763002217f},
-std::array<float,2>{0.88368082f, 0.244501829f},
-std::array<float,2>{0.345502466f, 0.695629179f},
-std::array<float,2>{0.137441203f, 0.156935781f},
-std::array<float,2>{0.651451409f, 0.687391996f},
-std::array<float,2>{0.824053466f, 0.261038661f},
-std::array<float,2>{0.437915951f, 0.819777071f},
-std::array<float,2>{0.283324927f, 0.403369844f},
-std::array<float,2>{0.957629681f, 0.959691465f},
-std::array<float,2>{0.588323891f, 0.0848203078f},
-std::array<float,2>{0.049508512f, 0.536481917f},
-std::array<float,2>{0.341555119f, 0.215346709f},
-std::array<float,2>{0.932490468f, 0.748444378f},
-std::array<float,2>{0.522268295f, 0.361467123f},
-std::array<float,2>{0.0648805648f, 0.787602007f},
-std::array<float,2>{0.22627385f, 0.498972148f},
-std::array<float,2>{0.709702134f, 0.926145554f},
-std::array<float,2>{0.775969863f, 0.060943f},
-std::array<float,2>{0.423853964f, 0.583416283f},
-std::array<float,2>{0.0138348043f, 0.112366058f},
-std::array<float,2>{0.620695651f, 0.518805087f},
-std::array<float,2>{0.991514027f, 0.424128354f},
-std::array<float,2>{0.273352563f, 0.970278203f},
-std::array<float,2>{0.489814818f, 0.307868391f},
-std::array<float,2>{0.855934024f, 0.844756126f},
-std::array<float,2>{0.667190969f, 0.153211549f},
-std::array<float,2>{0.172779053f, 0.636488497f},
-std::array<float,2>{0.326753855f, 0.124280639f},
-std::array<float,2>{0.911621392f, 0.524600863f},
-std::array<float,2>{0.511775613f, 0.431481838f},
-std::array<float,2>{0.0804084539f, 0.98307389f},
-std::array<float,2>{0.249702469f, 0.30178079f},
-std::array<float,2>{0.697112679f, 0.857160687f},
-std::array<float,2>{0.756189883f, 0.143593162f},
-std::array<float,2>{0.417225659f, 0.629047394f},
-std::array<float,2>{0.02580861f, 0.205942005f},
-std::array<float,2>{0.598969996f, 0.740466833f},
-std::array<float,2>{0.979321182f, 0.368604869f},
-std::array<float,2>{0.250036091f, 0.78963387f},
-std::array<float,2>{0.470679939f, 0.489447445f},
-std::array<float,2>{0.87021029f, 0.930327475f},
-std::array<float,2>{0.679751575f, 0.0539836846f},
-std::array<float,2>{0.167831957f, 0.592527568f},
-std::array<float,2>{0.393864006f, 0.169988185f},
-std::array<float,2>{0.801919997f, 0.678328574f},
-std::array<float,2>{0.735573411f, 0.252361447f},
-std::array<float,2>{0.2133158f, 0.821386814f},
-std::array<float,2>{0.110697538f, 0.393983811f},
-std::array<float,2>{0.551647604f, 0.964881599f},
-std::array<float,2>{0.900085628f, 0.0874444917f},
-std::array<float,2>{0.370334625f, 0.543631494f},
-std::array<float,2>{0.149374828f, 0.00234267255f},
-std::array<float,2>{0.630568981f, 0.610754848f},
-std::array<float,2>{0.840737224f, 0.442309856f},
-std::array<float,2>{0.463086218f, 0.881166756f},
-std::array<float,2>{0.300422847f, 0.3209185f},
-std::array<float,2>{0.953035057f, 0.750963688f},
-std::array<float,2>{0.575730205f, 0.234918773f},
-std::array<float,2>{0.0425763316f, 0.694770515f},
-std::array<float,2>{0.44280538f, 0.0371638611f},
-std::array<float,2>{0.827088952f, 0.575423419f},
-std::array<float,2>{0.653943956f, 0.471731246f},
-std::array<float,2>{0.133126467f, 0.917229056f},
-std::array<float,2>{0.0521561541f, 0.344162405f},
-std::array<float,2>{0.590096176f, 0.80452764f},
-std::array<float,2>{0.95598942f, 0.199270889f},
-std::array<float,2>{0.287774175f, 0.727119446f},
-std::array<float,2>{0.189675793f, 0.137161478f},
-std::array<float,2>{0.732590139f, 0.642252147f},
-std::array<float,2>{0.783788204f, 0.294645071f},
-std::array<float,2>{0.38278693f, 0.866979837f},
-std::array<float,2>{0.349840343f, 0.413611025f},
-std::array<float,2>{0.888590753f, 0.989599764f},
-std::array<float,2>{0.534795642f, 0.0948403403f},
-std::array<float,2>{0.104088768f, 0.509406447f},
-std::array<float,2>{0.268064231f, 0.227990627f},
-std::array<float,2>{0.987881541f, 0.707935035f},
-std::array<float,2>{0.622708976f, 0.343660623f},
-std::array<float,2>{0.00969042629f, 0.770886302f},
-std::array<float,2>{0.177332729f, 0.463378876f},
-std::array<float,2>{0.669911861f, 0.901017725f},
-std::array<float,2>{0.855104744f, 0.0284682214f},
-std::array<float,2>{0.485560566f, 0.605787516f},
-std::array<float,2>{0.0684651062f, 0.0753472969f},
-std::array<float,2>{0.51820606f, 0.556206286f},
-std::array<float,2>{0.93696779f, 0.380460411f},
-std::array<float,2>{0.336166173f, 0.94327265f},
-std::array<float,2>{0.42843771f, 0.266712755f},
-std::array<float,2>{0.779995322f, 0.841416299f},
-std::array<float,2>{0.705114961f, 0.184516311f},
-std::array<float,2>{0.221661925f, 0.659922838f},
-std::array<float,2>{0.292354345f, 0.0205007046f},
-std::array<float,2>{0.967225671f, 0.600069046f},
-std::array<float,2>{0.581123948f, 0.458903611f},
-std::array<float,2>{0.0614152513f, 0.895215094f},
-std::array<float,2>{0.131560117f, 0.33393079f},
-std::array<float,2>{0.644254088f, 0.778047383f},
-std::array<float,2>{0.817784131f, 0.222901449f},
-std::array<float,2>{0.448812574f, 0.713475645f},
-std::array<float,2>{0.0952664614f, 0.172840491f},
-std::array<float,2>{0.539982438f, 0.666804016f},
-std::array<float,2>{0.878270447f, 0.277581245f},
-std::array<float,2>{0.355710059f, 0.833969295f},
-std::array<float,2>{0.388577759f, 0.38737613f},
-std::array<float,2>{0.789164662f, 0.948515832f},
-std::array<float,2>{0.724372864f, 0.0627553985f},
-std::array<float,2>{0.2023018f, 0.549907088f},
-std::array<float,2>{0.498668849f, 0.191212282f},
-std::array<float,2>{0.844397724f, 0.722654521f},
-std::array<float,2>{0.661723733f, 0.356998295f},
-std::array<float,2>{0.181644902f, 0.808096468f},
-std::array<float,2>{0.00174386555f, 0.478683174f},
-std::array<float,2>{0.611644149f, 0.908803821f},
-std::array<float,2>{0.993560731f, 0.0397992767f},
-std::array<float,2>{0.279142171f, 0.568840444f},
-std::array<float,2>{0.228028491f, 0.104766585f},
-std::array<float,2>{0.715661108f, 0.503617465f},
-std::array<float,2>{0.771797121f, 0.41551587f},
-std::array<float,2>{0.431666225f, 0.995348036f},
-std::array<float,2>{0.333432615f, 0.282454461f},
-std::array<float,2>{0.925915539f, 0.874034405f},
-std::array<float,2>{0.524650693f, 0.127240703f},
-std::array<float,2>{0.0705132484f, 0.651005149f},
-std::array<float,2>{0.40918377f, 0.0783441588f},
-std::array<float,2>{0.759147406f, 0.534322083f},
-std::array<float,2>{0.689867437f, 0.399273664f},
-std::array<float,2>{0.234997272f, 0.956370771f},
-std::array<float,2>{0.0864060596f, 0.262653381f},
-std::array<float,2>{0.503062844f, 0.814869702f},
-std::array<float,2>{0.917716742f, 0.162746921f},
-std::array<float,2>{0.317073494f, 0.683423758f},
-std::array<float,2>{0.158739984f, 0.247298256f},
-std::array<float,2>{0.672042906f, 0.700121403f},
-std::array<float,2>{0.862239599f, 0.313589185f},
-std::array<float,2>{0.480999291f, 0.75958997f},
-std::array<float,2>{0.265181094f, 0.45061323f},
-std::array<float,2>{0.969749331f, 0.887826443f},
-std::array<float,2>{0.604263365f, 0.0100744693f},
-std::array<float,2>{0.0209055021f, 0.620679557f},
-std::array<float,2>{0.359863907f, 0.149243921f},
-std::array<float,2>{0.896241784f, 0.638410926f},
-std::array<float,2>{0.561824679f, 0.311074108f},
-std::array<float,2>{0.124819599f, 0.848585069f},
-std::array<float,2>{0.209329084f, 0.426436275f},
-std::array<float,2>{0.747947216f, 0.976490557f},
-std::array<float,2>{0.806889892f, 0.116194621f},
-std::array<float,2>{0.398593813f, 0.522080421f},
-std::array<float,2>{0.0370884165f, 0.0568531305f},
-std::array<float,2>{0.563019454f, 0.578609884f},
-std::array<float,2>{0.942304432f, 0.493078619f},
-std::array<float,2>{0.306167275f, 0.924084961f},
-std::array<float,2>{0.454218566f, 0.364276707f},
-std::array<float,2>{0.835661113f, 0.782859206f},
-std::array<float,2>{0.635018289f, 0.211775035f},
-std::array<float,2>{0.147843748f, 0.743645012f},
-std::array<float,2>{0.331242353f, 0.00554088783f},
-std::array<float,2>{0.922075212f, 0.616438925f},
-std::array<float,2>{0.530982554f, 0.440224975f},
-std::array<float,2>{0.0753102005f, 0.876570821f},
-std::array<float,2>{0.234335348f, 0.324735761f},
-std::array<float,2>{0.712074578f, 0.757708728f},
-std::array<float,2>{0.767632782f, 0.242181867f},
-std::array<float,2>{0.434785128f, 0.689413905f},
-std::array<float,2>{0.00657277741f, 0.165280908f},
-std::array<float,2>{0.6162498f, 0.672259808f},
-std::array<float,2>{0.99891001f, 0.256094903f},
-std::array<float,2>{0.275628239f, 0.824572921f},
-std::array<float,2>{0.494736254f, 0.397408545f},
-std::array<float,2>{0.848971963f, 0.961528063f},
-std::array<float,2>{0.658471406f, 0.0935550183f},
-std::array<float,2>{0.184534773f, 0.540431678f},
-std::array<float,2>{0.383374214f, 0.209506765f},
-std::array<float,2>{0.795062125f, 0.736366034f},
-std::array<float,2>{0.72036922f, 0.37170276f},
-std::array<float,2>{0.198996037f, 0.795806527f},
-std::array<float,2>{0.0977816209f, 0.485211819f},
-std::array<float,2>{0.543494046f, 0.935716629f},
-std::array<float,2>{0.879597783f, 0.048508022f},
-std::array<float,2>{0.353980005f, 0.587038815f},
-std::array<float,2>{0.126762912f, 0.120897189f},
-std::array<float,2>{0.646450043f, 0.529524446f},
-std::array<float,2>{0.813022077f, 0.437443227f},
-std::array<float,2>{0.451495439f, 0.977386236f},
-std::array<float,2>{0.294935197f, 0.300636142f},
-std::array<float,2>{0.963294506f, 0.851650536f},
-std::array<float,2>{0.583330274f, 0.145575032f},
-std::array<float,2>{0.0557206646f, 0.625385404f},
-std::array<float,2>{0.459744066f, 0.0726257339f},
-std::array<float,2>{0.831270874f, 0.559438944f},
-std::array<float,2>{0.639990509f, 0.37888518f},
-std::array<float,2>{0.143589675f, 0.938619077f},
-std::array<float,2>{0.0332742333f, 0.272804201f},
-std::array<float,2>{0.567312002f, 0.837164104f},
-std::array<float,2>{0.939067483f, 0.182434261f},
-std::array<float,2>{0.309502214f, 0.662624598f},
-std::array<float,2>{0.206860006f, 0.232829541f},
-std::array<float,2>{0.743732631f, 0.705553353f},
-std::array<float,2>{0.810871422f, 0.336865753f},
-std::array<float,2>{0.40495199f, 0.767972231f},
-std::array<float,2>{0.364270121f, 0.465080023f},
-std::array<float,2>{0.892491043f, 0.905139983f},
-std::array<float,2>{0.557681859f, 0.0247499794f},
-std::array<float,2>{0.119864359f, 0.602562428f},
-std::array<float,2>{0.261716038f, 0.135384426f},
-std::array<float,2>{0.976341128f, 0.647334635f},
-std::array<float,2>{0.606262743f, 0.289371073f},
-std::array<float,2>{0.0193919018f, 0.862169087f},
-std::array<float,2>{0.16272071f, 0.409770966f},
-std::array<float,2>{0.679484546f, 0.987280607f},
-std::array<float,2>{0.865043283f, 0.101377748f},
-std::array<float,2>{0.476564825f, 0.514608026f},
-std::array<float,2>{0.0906287208f, 0.0348254591f},
-std::array<float,2>{0.504461527f, 0.572636247f},
-std::array<float,2>{0.918669522f, 0.474572599f},
-std::array<float,2>{0.315364838f, 0.921714425f},
-std::array<float,2>{0.410759896f, 0.348615646f},
-std::array<float,2>{0.764270902f, 0.798154473f},
-std::array<float,2>{0.69399929f, 0.195633933f},
-std::array<float,2>{0.240899593f, 0.732793272f},
-std::array<float,2>{0.302864015f, 0.107973829f},
-std::array<float,2>{0.947751045f, 0.506486893f},
-std::array<float,2>{0.573885083f, 0.419166803f},
-std::array<float,2>{0.0468357727f, 0.998248875f},
-std::array<float,2>{0.154136926f, 0.286839336f},
-std::array<float,2>{0.625526726f, 0.870421469f},
-std::array<float,2>{0.839541674f, 0.131593123f},
-std::array<float,2>{0.46623984f, 0.652553976f},
-std::array<float,2>{0.117089808f, 0.19206278f},
-std::array<float,2>{0.548168242f, 0.726450801f},
-std::array<float,2>{0.902652204f, 0.351835072f},
-std::array<float,2>{0.374559373f, 0.812492311f},
-std::array<float,2>{0.39488703f, 0.48357302f},
-std::array<float,2>{0.798541248f, 0.91339004f},
-std::array<float,2>{0.741001666f, 0.0450824648f},
-std::array<float,2>{0.21840921f, 0.566146016f},
-std::array<float,2>{0.476143211f, 0.179233432f},
-std::array<float,2>{0.874237001f, 0.66971916f},
-std::array<float,2>{0.685471594f, 0.273973346f},
-std::array<float,2>{0.17184779f, 0.828724742f},
-std::array<float,2>{0.030670112f, 0.3850905f},
-std::array<float,2>{0.596739709f, 0.952666163f},
-std::array<float,2>{0.984309793f, 0.069117628f},
-std::array<float,2>{0.257771075f, 0.553081274f},
-std::array<float,2>{0.245620877f, 0.0189651307f},
-std::array<float,2>{0.699317336f, 0.593976498f},
-std::array<float,2>{0.751734078f, 0.454155296f},
-std::array<float,2>{0.421140581f, 0.890816271f},
-std::array<float,2>{0.32408303f, 0.3282094f},
-std::array<float,2>{0.909813344f, 0.774211168f},
-std::array<float,2>{0.511060774f, 0.219222113f},
-std::array<float,2>{0.0841560662f, 0.715709388f},
-std::array<float,2>{0.422538459f, 0.0600866713f},
-std::array<float,2>{0.774588943f, 0.585544527f},
-std::array<float,2>{0.707992136f, 0.496659905f},
-std::array<float,2>{0.223234579f, 0.928566873f},
-std::array<float,2>{0.0635033622f, 0.360978156f},
-std::array<float,2>{0.521440387f, 0.786055982f},
-std::array<float,2>{0.93117404f, 0.218662277f},
-std::array<float,2>{0.343226165f, 0.747891009f},
-std::array<float,2>{0.174242854f, 0.154354632f},
-std::array<float,2>{0.664457679f, 0.634083569f},
-std::array<float,2>{0.857856333f, 0.305390269f},
-std::array<float,2>{0.490304559f, 0.846725702f},
-std::array<float,2>{0.271184534f, 0.422694683f},
-std::array<float,2>{0.989026666f, 0.97103107f},
-std::array<float,2>{0.617273092f, 0.111040935f},
-std::array<float,2>{0.0117534678f, 0.517008483f},
-std::array<float,2>{0.346447617f, 0.243171856f},
-std::array<float,2>{0.884792626f, 0.697976649f},
-std::array<float,2>{0.536795974f, 0.3202402f},
-std::array<float,2>{0.109241806f, 0.765441656f},
-std::array<float,2>{0.194555193f, 0.448198378f},
-std::array<float,2>{0.729543865f, 0.886404395f},
-std::array<float,2>{0.785307348f, 0.0155122811f},
-std::array<float,2>{0.375397801f, 0.621477008f},
-std::array<float,2>{0.0469865873f, 0.082106404f},
-std::array<float,2>{0.58641392f, 0.538679421f},
-std::array<float,2>{0.959540129f, 0.404766947f},
-std::array<float,2>{0.282290846f, 0.958193421f},
-std::array<float,2>{0.440890491f, 0.258629054f},
-std::array<float,2>{0.82176739f, 0.817450106f},
-std::array<float,2>{0.649561763f, 0.158778116f},
-std::array<float,2>{0.139316246f, 0.68359828f},
-std::array<float,2>{0.368762255f, 0.0896965861f},
-std::array<float,2>{0.900482059f, 0.545853853f},
-std::array<float,2>{0.553355157f, 0.390976995f},
-std::array<float,2>{0.112288177f, 0.967371762f},
-std::array<float,2>{0.212010667f, 0.25137344f},
-std::array<float,2>{0.7380566f, 0.824173927f},
-std::array<float,2>{0.804022849f, 0.168209016f},
-std::array<float,2>{0.391197264f, 0.677432299f},
-std::array<float,2>{0.0407991f, 0.236650303f},
-std::array<float,2>{0.577759504f, 0.692312777f},
-std::array<float,2>{0.94934541f, 0.322981745f},
-std::array<float,2>{0.297698468f, 0.75233835f},
-std::array<float,2>{0.462468892f, 0.444063336f},
-std::array<float,2>{0.843190551f, 0.879168808f},
-std::array<float,2>{0.632538378f, 0.000750954787f},
-std::array<float,2>{0.151119605f, 0.612637401f},
-std::array<float,2>{0.415351182f, 0.142263263f},
-std::array<float,2>{0.754124999f, 0.632711351f},
-std::array<float,2>{0.697844386f, 0.304116637f},
-std::array<float,2>{0.24737297f, 0.858045638f},
-std::array<float,2>{0.0796809271f, 0.432441264f},
-std::array<float,2>{0.515317082f, 0.981294513f},
-std::array<float,2>{0.912437618f, 0.122459956f},
-std::array<float,2>{0.324927866f, 0.526982427f},
-std::array<float,2>{0.164341033f, 0.0523560643f},
-std::array<float,2>{0.68222332f, 0.591338813f},
-std::array<float,2>{0.868706584f, 0.491067916f},
-std::array<float,2>{0.470705301f, 0.931801677f},
-std::array<float,2>{0.252494812f, 0.369553059f},
-std::array<float,2>{0.976746976f, 0.792201936f},
-std::array<float,2>{0.601420641f, 0.20451133f},
-std::array<float,2>{0.0243102293f, 0.740024567f},
-std::array<float,2>{0.487331837f, 0.029619636f},
-std::array<float,2>{0.852313817f, 0.608948231f},
-std::array<float,2>{0.670328975f, 0.462877393f},
-std::array<float,2>{0.179675192f, 0.898623407f},
-std::array<float,2>{0.0101057747f, 0.340517581f},
-std::array<float,2>{0.624931097f, 0.772966921f},
-std::array<float,2>{0.984661877f, 0.228747472f},
-std::array<float,2>{0.266135544f, 0.710392654f},
-std::array<float,2>{0.219644099f, 0.185562685f},
-std::array<float,2>{0.703494191f, 0.656601906f},
-std::array<float,2>{0.779007614f, 0.267738223f},
-std::array<float,2>{0.426158518f, 0.84283036f},
-std::array<float,2>{0.33885166f, 0.382203162f},
-std::array<float,2>{0.934047222f, 0.945044458f},
-std::array<float,2>{0.516129911f, 0.0761725903f},
-std::array<float,2>{0.0683093369f, 0.55765605f},
-std::array<float,2>{0.285430461f, 0.202459142f},
-std::array<float,2>{0.954535961f, 0.729778171f},
-std::array<float,2>{0.591920972f, 0.34722203f},
-std::array<float,2>{0.0546235405f, 0.801095545f},
-std::array<float,2>{0.136639327f, 0.469824493f},
-std::array<float,2>{0.654304981f, 0.915032446f},
-std::array<float,2>{0.825405598f, 0.0363056771f},
-std::array<float,2>{0.443861097f, 0.576735497f},
-std::array<float,2>{0.103490733f, 0.0972454995f},
-std::array<float,2>{0.532849312f, 0.510576248f},
-std::array<float,2>{0.889978528f, 0.411529899f},
-std::array<float,2>{0.348132223f, 0.991379678f},
-std::array<float,2>{0.380675107f, 0.296567351f},
-std::array<float,2>{0.782540858f, 0.864816785f},
-std::array<float,2>{0.732377648f, 0.138921052f},
-std::array<float,2>{0.189367086f, 0.643104613f},
-std::array<float,2>{0.280815989f, 0.0419625789f},
-std::array<float,2>{0.994603813f, 0.566609919f},
-std::array<float,2>{0.609910488f, 0.476834029f},
-std::array<float,2>{0.00345722842f, 0.906473577f},
-std::array<float,2>{0.179954663f, 0.358725041f},
-std::array<float,2>{0.663310647f, 0.806351125f},
-std::array<float,2>{0.845858157f, 0.189273566f},
-std::array<float,2>{0.496708363f, 0.719168901f},
-std::array<float,2>{0.0741736814f, 0.125538617f},
-std::array<float,2>{0.526371241f, 0.648502827f},
-std::array<float,2>{0.928277731f, 0.28331992f},
-std::array<float,2>{0.334237546f, 0.871999145f},
-std::array<float,2>{0.430789858f, 0.417566895f},
-std::array<float,2>{0.770531714f, 0.993392766f},
-std::array<float,2>{0.718596935f, 0.102238692f},
-std::array<float,2>{0.229178682f, 0.501411676f},
-std::array<float,2>{0.445820987f, 0.226465583f},
-std::array<float,2>{0.820258081f, 0.711417675f},
-std::array<float,2>{0.64230442f, 0.334935248f},
-std::array<float,2>{0.1294633f, 0.779445827f},
-std::array<float,2>{0.0601958409f, 0.460230172f},
-std::array<float,2>{0.579421222f, 0.896711826f},
-std::array<float,2>{0.96509403f, 0.0232975036f},
-std::array<float,2>{0.289484084f, 0.598167121f},
-std::array<float,2>{0.200389937f, 0.0662210733f},
-std::array<float,2>{0.725796402f, 0.547665f},
-std::array<float,2>{0.791301787f, 0.389206588f},
-std::array<float,2>{0.38982898f, 0.945949614f},
-std::array<float,2>{0.357518792f, 0.280414194f},
-std::array<float,2>{0.876213908f, 0.835587561f},
-std::array<float,2>{0.542258263f, 0.174085274f},
-std::array<float,2>{0.0962984785f, 0.665154338f},
-std::array<float,2>{0.401446849f, 0.114268564f},
-std::array<float,2>{0.806404531f, 0.520247757f},
-std::array<float,2>{0.749005258f, 0.428734958f},
-std::array<float,2>{0.208874419f, 0.97449404f},
-std::array<float,2>{0.121103972f, 0.309238136f},
-std::array<float,2>{0.55933392f, 0.851252854f},
-std::array<float,2>{0.897425473f, 0.151270926f},
-std::array<float,2>{0.36140129f, 0.640310109f},
-std::array<float,2>{0.145909995f, 0.214797333f},
-std::array<float,2>{0.632927716f, 0.745756745f},
-std::array<float,2>{0.833855867f, 0.365959436f},
-std::array<float,2>{0.455740809f, 0.783445239f},
-std::array<float,2>{0.308375984f, 0.494231969f},
-std::array<float,2>{0.943838418f, 0.922139645f},
-std::array<float,2>{0.565501034f, 0.0564726219f},
-std::array<float,2>{0.0374934338f, 0.58098495f},
-std::array<float,2>{0.318444431f, 0.160581395f},
-std::array<float,2>{0.915560126f, 0.679702163f},
-std::array<float,2>{0.50106132f, 0.264322698f},
-std::array<float,2>{0.0888655111f, 0.814278185f},
-std::array<float,2>{0.238005951f, 0.401663959f},
-std::array<float,2>{0.687599242f, 0.954189479f},
-std::array<float,2>{0.761716723f, 0.0801514462f},
-std::array<float,2>{0.406556547f, 0.532171309f},
-std::array<float,2>{0.0215774104f, 0.0079030674f},
-std::array<float,2>{0.603051126f, 0.617673993f},
-std::array<float,2>{0.971016884f, 0.45217815f},
-std::array<float,2>{0.26350826f, 0.888906658f},
-std::array<float,2>{0.482902378f, 0.315555125f},
-std::array<float,2>{0.860391855f, 0.761446953f},
-std::array<float,2>{0.675191879f, 0.248515636f},
-std::array<float,2>{0.15681994f, 0.702011883f},
-std::array<float,2>{0.325945884f, 0.0537303649f},
-std::array<float,2>{0.913953364f, 0.592576861f},
-std::array<float,2>{0.514244437f, 0.489716679f},
-std::array<float,2>{0.0788322017f, 0.930510879f},
-std::array<float,2>{0.246451244f, 0.36822018f},
-std::array<float,2>{0.698981106f, 0.789961517f},
-std::array<float,2>{0.755235553f, 0.205662519f},
-std::array<float,2>{0.414727747f, 0.740721107f},
-std::array<float,2>{0.0244339723f, 0.143915817f},
-std::array<float,2>{0.600448668f, 0.629361451f},
-std::array<float,2>{0.978384733f, 0.30205369f},
-std::array<float,2>{0.253041357f, 0.857327521f},
-std::array<float,2>{0.472518146f, 0.431199759f},
-std::array<float,2>{0.867996156f, 0.98320055f},
-std::array<float,2>{0.683173001f, 0.124103442f},
-std::array<float,2>{0.165507153f, 0.524671674f},
-std::array<float,2>{0.392282575f, 0.235135362f},
-std::array<float,2>{0.803055465f, 0.69434768f},
-std::array<float,2>{0.736519694f, 0.321153283f},
-std::array<float,2>{0.211504593f, 0.750625014f},
-std::array<float,2>{0.113008805f, 0.442093551f},
-std::array<float,2>{0.55462575f, 0.881055355f},
-std::array<float,2>{0.902230918f, 0.00217475137f},
-std::array<float,2>{0.367721766f, 0.610577345f},
-std::array<float,2>{0.151980132f, 0.087713778f},
-std::array<float,2>{0.631747484f, 0.543926001f},
-std::array<float,2>{0.842742443f, 0.39370653f},
-std::array<float,2>{0.461179167f, 0.96513617f},
-std::array<float,2>{0.297921658f, 0.252141267f},
-std::array<float,2>{0.950606227f, 0.821587563f},
-std::array<float,2>{0.576237082f, 0.170362562f},
-std::array<float,2>{0.0392032415f, 0.678523004f},
-std::array<float,2>{0.444979131f, 0.0950923115f},
-std::array<float,2>{0.824670136f, 0.509661257f},
-std::array<float,2>{0.655899823f, 0.413951933f},
-std::array<float,2>{0.134880155f, 0.989285946f},
-std::array<float,2>{0.0528362729f, 0.294916809f},
-std::array<float,2>{0.593142569f, 0.866758704f},
-std::array<float,2>{0.953530669f, 0.136810288f},
-std::array<float,2>{0.286270678f, 0.642375767f},
-std::array<float,2>{0.188464567f, 0.199556798f},
-std::array<float,2>{0.730681479f, 0.727413297f},
-std::array<float,2>{0.78128022f, 0.343867093f},
-std::array<float,2>{0.379493803f, 0.804376781f},
-std::array<float,2>{0.34864226f, 0.472119033f},
-std::array<float,2>{0.889199853f, 0.917463005f},
-std::array<float,2>{0.531383872f, 0.0375091322f},
-std::array<float,2>{0.102032475f, 0.575484455f},
-std::array<float,2>{0.267140061f, 0.184232861f},
-std::array<float,2>{0.985832989f, 0.65984422f},
-std::array<float,2>{0.623057485f, 0.267060816f},
-std::array<float,2>{0.0111831659f, 0.841747701f},
-std::array<float,2>{0.178336173f, 0.380813271f},
-std::array<float,2>{0.670899868f, 0.943011701f},
-std::array<float,2>{0.853307247f, 0.0754632726f},
-std::array<float,2>{0.48657611f, 0.556493938f},
-std::array<float,2>{0.0668003634f, 0.0286710877f},
-std::array<float,2>{0.516708732f, 0.605710864f},
-std::array<float,2>{0.934763849f, 0.462963521f},
-std::array<float,2>{0.339445502f, 0.901308596f},
-std::array<float,2>{0.427495271f, 0.34344402f},
-std::array<float,2>{0.778003454f, 0.77061826f},
-std::array<float,2>{0.704441309f, 0.227572575f},
-std::array<float,2>{0.220178619f, 0.707667887f},
-std::array<float,2>{0.290265679f, 0.0626020432f},
-std::array<float,2>{0.966228962f, 0.550167918f},
-std::array<float,2>{0.578356683f, 0.387560457f},
-std::array<float,2>{0.0589229874f, 0.948448718f},
-std::array<float,2>{0.130183786f, 0.277694136f},
-std::array<float,2>{0.641415715f, 0.833644986f},
-std::array<float,2>{0.818646908f, 0.17260249f},
-std::array<float,2>{0.446838796f, 0.666666567f},
-std::array<float,2>{0.097248219f, 0.222793877f},
-std::array<float,2>{0.541031241f, 0.713709056f},
-std::array<float,2>{0.875882804f, 0.33370015f},
-std::array<float,2>{0.359033406f, 0.778134048f},
-std::array<float,2>{0.389139056f, 0.458710611f},
-std::array<float,2>{0.792750418f, 0.895266652f},
-std::array<float,2>{0.725355208f, 0.0201561693f},
-std::array<float,2>{0.199431941f, 0.599648178f},
-std::array<float,2>{0.497184753f, 0.126967624f},
-std::array<float,2>{0.847649038f, 0.651196003f},
-std::array<float,2>{0.662193596f, 0.282491803f},
-std::array<float,2>{0.181203529f, 0.874348819f},
-std::array<float,2>{0.00291115162f, 0.41522342f},
-std::array<float,2>{0.610959649f, 0.995494723f},
-std::array<float,2>{0.995944858f, 0.104512744f},
-std::array<float,2>{0.280167729f, 0.503733277f},
-std::array<float,2>{0.230462298f, 0.0395760611f},
-std::array<float,2>{0.717753768f, 0.568423092f},
-std::array<float,2>{0.770050049f, 0.478862584f},
-std::array<float,2>{0.430114865f, 0.909012437f},
-std::array<float,2>{0.335841238f, 0.357331812f},
-std::array<float,2>{0.929147661f, 0.807806253f},
-std::array<float,2>{0.526209116f, 0.191159174f},
-std::array<float,2>{0.073063083f, 0.722186327f},
-std::array<float,2>{0.407578349f, 0.00993199181f},
-std::array<float,2>{0.760665655f, 0.620954156f},
-std::array<float,2>{0.689408422f, 0.450401068f},
-std::array<float,2>{0.237187073f, 0.888068676f},
-std::array<float,2>{0.0895111114f, 0.313883126f},
-std::array<float,2>{0.500503302f, 0.7593925f},
-std::array<float,2>{0.914953232f, 0.247356609f},
-std::array<float,2>{0.320284069f, 0.69984889f},
-std::array<float,2>{0.157646686f, 0.162893549f},
-std::array<float,2>{0.674450219f, 0.683225334f},
-std::array<float,2>{0.859501421f, 0.262236029f},
-std::array<float,2>{0.484149963f, 0.81462127f},
-std::array<float,2>{0.262135148f, 0.398989171f},
-std::array<float,2>{0.972034574f, 0.956065714f},
-std::array<float,2>{0.601834357f, 0.0785303637f},
-std::array<float,2>{0.0230628438f, 0.534605682f},
-std::array<float,2>{0.362445176f, 0.211627126f},
-std::array<float,2>{0.898322999f, 0.743353963f},
-std::array<float,2>{0.559959233f, 0.364522129f},
-std::array<float,2>{0.122536771f, 0.783063769f},
-std::array<float,2>{0.207591906f, 0.492854208f},
-std::array<float,2>{0.749048769f, 0.923876882f},
-std::array<float,2>{0.80509758f, 0.0569886565f},
-std::array<float,2>{0.400879174f, 0.57819438f},
-std::array<float,2>{0.038628526f, 0.11582429f},
-std::array<float,2>{0.565003216f, 0.522401214f},
-std::array<float,2>{0.944479108f, 0.426533908f},
-std::array<float,2>{0.3071419f, 0.976201057f},
-std::array<float,2>{0.456190884f, 0.311334282f},
-std::array<float,2>{0.832258284f, 0.848262131f},
-std::array<float,2>{0.63419497f, 0.149075821f},
-std::array<float,2>{0.144756243f, 0.638617396f},
-std::array<float,2>{0.354678869f, 0.118027329f},
-std::array<float,2>{0.880101979f, 0.52920723f},
-std::array<float,2>{0.544408798f, 0.434842318f},
-std::array<float,2>{0.0986883938f, 0.979548335f},
-std::array<float,2>{0.197773874f, 0.297272563f},
-std::array<float,2>{0.718874872f, 0.854743838f},
-std::array<float,2>{0.796470404f, 0.148133546f},
-std::array<float,2>{0.383847862f, 0.627752483f},
-std::array<float,2>{0.055657614f, 0.207679138f},
-std::array<float,2>{0.582188845f, 0.736169457f},
-std::array<float,2>{0.964199841f, 0.373137414f},
-std::array<float,2>{0.295902759f, 0.793180764f},
-std::array<float,2>{0.452923745f, 0.487743855f},
-std::array<float,2>{0.813689709f, 0.933987617f},
-std::array<float,2>{0.645451069f, 0.0502628684f},
-std::array<float,2>{0.125940457f, 0.588891447f},
-std::array<float,2>{0.434244543f, 0.167496756f},
-std::array<float,2>{0.768869221f, 0.675552726f},
-std::array<float,2>{0.711331248f, 0.254779905f},
-std::array<float,2>{0.233357772f, 0.8267048f},
-std::array<float,2>{0.074515298f, 0.394712001f},
-std::array<float,2>{0.530180633f, 0.964627802f},
-std::array<float,2>{0.923094273f, 0.0901860297f},
-std::array<float,2>{0.33093971f, 0.542096555f},
-std::array<float,2>{0.185399324f, 0.00673451321f},
-std::array<float,2>{0.659622014f, 0.614608109f},
-std::array<float,2>{0.848436594f, 0.439287156f},
-std::array<float,2>{0.495267153f, 0.878311098f},
-std::array<float,2>{0.276686907f, 0.326449573f},
-std::array<float,2>{0.999883652f, 0.754658997f},
-std::array<float,2>{0.615659118f, 0.238847584f},
-std::array<float,2>{0.00764298905f, 0.689484715f},
-std::array<float,2>{0.477667391f, 0.0323933773f},
-std::array<float,2>{0.86346209f, 0.571535051f},
-std::array<float,2>{0.678685665f, 0.47515896f},
-std::array<float,2>{0.163599178f, 0.918214977f},
-std::array<float,2>{0.0176113732f, 0.349942207f},
-std::array<float,2>{0.607263625f, 0.799085438f},
-std::array<float,2>{0.975452602f, 0.197555885f},
-std::array<float,2>{0.260516912f, 0.730817914f},
-std::array<float,2>{0.241380841f, 0.133212417f},
-std::array<float,2>{0.694793224f, 0.644566655f},
-std::array<float,2>{0.764851689f, 0.291623831f},
-std::array<float,2>{0.411235064f, 0.859501123f},
-std::array<float,2>{0.31621334f, 0.407057822f},
-std::array<float,2>{0.919245303f, 0.98618865f},
-std::array<float,2>{0.5053581f, 0.0989443287f},
-std::array<float,2>{0.091309309f, 0.51238203f},
-std::array<float,2>{0.30970782f, 0.23177509f},
-std::array<float,2>{0.938474059f, 0.703740954f},
-std::array<float,2>{0.567550302f, 0.339057118f},
-std::array<float,2>{0.0351077765f, 0.766642451f},
-std::array<float,2>{0.142619878f, 0.468595743f},
-std::array<float,2>{0.639200628f, 0.902804554f},
-std::array<float,2>{0.830541015f, 0.0270405114f},
-std::array<float,2>{0.460813373f, 0.604534268f},
-std::array<float,2>{0.120369241f, 0.0714360476f},
-std::array<float,2>{0.557287991f, 0.561977327f},
-std::array<float,2>{0.890679479f, 0.376204491f},
-std::array<float,2>{0.364156902f, 0.940536559f},
-std::array<float,2>{0.406219661f, 0.271159112f},
-std::array<float,2>{0.812242627f, 0.839142323f},
-std::array<float,2>{0.74306041f, 0.179719761f},
-std::array<float,2>{0.20539777f, 0.661311924f},
-std::array<float,2>{0.256470263f, 0.0160527788f},
-std::array<float,2>{0.982954025f, 0.596825898f},
-std::array<float,2>{0.596651018f, 0.455428898f},
-std::array<float,2>{0.0297187958f, 0.893410027f},
-std::array<float,2>{0.170010746f, 0.331119984f},
-std::array<float,2>{0.683613956f, 0.777305245f},
-std::array<float,2>{0.873962045f, 0.221447095f},
-std::array<float,2>{0.475095749f, 0.717503071f},
-std::array<float,2>{0.0850889683f, 0.176022768f},
-std::array<float,2>{0.510254979f, 0.671762407f},
-std::array<float,2>{0.908590615f, 0.276003957f},
-std::array<float,2>{0.322429508f, 0.830726564f},
-std::array<float,2>{0.419965684f, 0.38356486f},
-std::array<float,2>{0.750270963f, 0.951158583f},
-std::array<float,2>{0.700330496f, 0.0671784803f},
-std::array<float,2>{0.244885534f, 0.552464366f},
-std::array<float,2>{0.465761483f, 0.194601715f},
-std::array<float,2>{0.838377595f, 0.722812951f},
-std::array<float,2>{0.626412094f, 0.354393899f},
-std::array<float,2>{0.153176442f, 0.810031235f},
-std::array<float,2>{0.0452343114f, 0.480595022f},
-std::array<float,2>{0.573190808f, 0.910522759f},
-std::array<float,2>{0.9488675f, 0.0444671512f},
-std::array<float,2>{0.304382563f, 0.56419313f},
-std::array<float,2>{0.216992661f, 0.105690733f},
-std::array<float,2>{0.741879344f, 0.505660117f},
-std::array<float,2>{0.797641754f, 0.421604067f},
-std::array<float,2>{0.395943731f, 0.996156931f},
-std::array<float,2>{0.373423547f, 0.288216144f},
-std::array<float,2>{0.903392136f, 0.868955135f},
-std::array<float,2>{0.547423899f, 0.129592866f},
-std::array<float,2>{0.115454748f, 0.654438615f},
-std::array<float,2>{0.376645476f, 0.0845444947f},
-std::array<float,2>{0.786229908f, 0.536331594f},
-std::array<float,2>{0.728989184f, 0.403565139f},
-std::array<float,2>{0.193392485f, 0.959872723f},
-std::array<float,2>{0.107695065f, 0.260801405f},
-std::array<float,2>{0.535820544f, 0.819443107f},
-std::array<float,2>{0.886570156f, 0.15704824f},
-std::array<float,2>{0.347260505f, 0.687153637f},
-std::array<float,2>{0.140095592f, 0.244367748f},
-std::array<float,2>{0.648712873f, 0.695414603f},
-std::array<float,2>{0.821076572f, 0.316729218f},
-std::array<float,2>{0.440321803f, 0.762937248f},
-std::array<float,2>{0.282220691f, 0.446928769f},
-std::array<float,2>{0.960730195f, 0.884230137f},
-std::array<float,2>{0.587237835f, 0.0131679988f},
-std::array<float,2>{0.0483824611f, 0.623143554f},
-std::array<float,2>{0.342661738f, 0.152836069f},
-std::array<float,2>{0.929869533f, 0.636275172f},
-std::array<float,2>{0.519664764f, 0.307827085f},
-std::array<float,2>{0.0625503287f, 0.845099568f},
-std::array<float,2>{0.22376512f, 0.424049705f},
-std::array<float,2>{0.708428383f, 0.970646083f},
-std::array<float,2>{0.774194419f, 0.112594247f},
-std::array<float,2>{0.4233917f, 0.518577814f},
-std::array<float,2>{0.0133535396f, 0.060649123f},
-std::array<float,2>{0.618277073f, 0.583095968f},
-std::array<float,2>{0.989459932f, 0.498706251f},
-std::array<float,2>{0.269647598f, 0.926003456f},
-std::array<float,2>{0.491978794f, 0.361805171f},
-std::array<float,2>{0.858993471f, 0.787876189f},
-std::array<float,2>{0.665261269f, 0.215758383f},
-std::array<float,2>{0.175721422f, 0.748282075f},
-std::array<float,2>{0.369364232f, 0.000616390666f},
-std::array<float,2>{0.899349391f, 0.612535655f},
-std::array<float,2>{0.551914096f, 0.444223762f},
-std::array<float,2>{0.109980203f, 0.878944933f},
-std::array<float,2>{0.214708447f, 0.323093772f},
-std::array<float,2>{0.735264182f, 0.752159834f},
-std::array<float,2>{0.801555991f, 0.236435041f},
-std::array<float,2>{0.392785102f, 0.692046165f},
-std::array<float,2>{0.0413660258f, 0.168374017f},
-std::array<float,2>{0.574344814f, 0.677599132f},
-std::array<float,2>{0.951946259f, 0.251001716f},
-std::array<float,2>{0.299778134f, 0.823760033f},
-std::array<float,2>{0.464297295f, 0.390710175f},
-std::array<float,2>{0.841300189f, 0.967598498f},
-std::array<float,2>{0.628907382f, 0.0894629657f},
-std::array<float,2>{0.149886325f, 0.545530081f},
-std::array<float,2>{0.416558117f, 0.204298452f},
-std::array<float,2>{0.757615328f, 0.739908636f},
-std::array<float,2>{0.695336401f, 0.369174093f},
-std::array<float,2>{0.24843815f, 0.792270243f},
-std::array<float,2>{0.0812269598f, 0.490731984f},
-std::array<float,2>{0.513619661f, 0.931941926f},
-std::array<float,2>{0.910268664f, 0.0525622927f},
-std::array<float,2>{0.327446043f, 0.591778994f},
-std::array<float,2>{0.166907057f, 0.122215435f},
-std::array<float,2>{0.681017637f, 0.527131855f},
-std::array<float,2>{0.870093703f, 0.432281315f},
-std::array<float,2>{0.469370276f, 0.981045365f},
-std::array<float,2>{0.251852304f, 0.303747058f},
-std::array<float,2>{0.980091453f, 0.858278036f},
-std::array<float,2>{0.598014891f, 0.142436445f},
-std::array<float,2>{0.0272414871f, 0.632495761f},
-std::array<float,2>{0.48451212f, 0.0765230209f},
-std::array<float,2>{0.853979528f, 0.558003604f},
-std::array<float,2>{0.66850096f, 0.381934643f},
-std::array<float,2>{0.175959215f, 0.945075154f},
-std::array<float,2>{0.00869486388f, 0.268021077f},
-std::array<float,2>{0.622052968f, 0.843074083f},
-std::array<float,2>{0.986967564f, 0.185972869f},
-std::array<float,2>{0.269168913f, 0.656444192f},
-std::array<float,2>{0.221943617f, 0.228947431f},
-std::array<float,2>{0.7064116f, 0.709988177f},
-std::array<float,2>{0.780940533f, 0.340804309f},
-std::array<float,2>{0.429374337f, 0.773269653f},
-std::array<float,2>{0.337219536f, 0.462492019f},
-std::array<float,2>{0.936314821f, 0.898750126f},
-std::array<float,2>{0.518608868f, 0.0294195302f},
-std::array<float,2>{0.0701903105f, 0.60934025f},
-std::array<float,2>{0.288149118f, 0.138814792f},
-std::array<float,2>{0.95699805f, 0.64339745f},
-std::array<float,2>{0.59125042f, 0.296662778f},
-std::array<float,2>{0.0513525978f, 0.865013778f},
-std::array<float,2>{0.134308189f, 0.411329329f},
-std::array<float,2>{0.65318954f, 0.991640747f},
-std::array<float,2>{0.827172816f, 0.0976035446f},
-std::array<float,2>{0.441498309f, 0.510492086f},
-std::array<float,2>{0.105093092f, 0.0364269093f},
-std::array<float,2>{0.533754051f, 0.576963127f},
-std::array<float,2>{0.886890948f, 0.470043063f},
-std::array<float,2>{0.350883752f, 0.914625049f},
-std::array<float,2>{0.381391287f, 0.347499013f},
-std::array<float,2>{0.784568727f, 0.800799131f},
-std::array<float,2>{0.733735502f, 0.202291191f},
-std::array<float,2>{0.190640643f, 0.729665279f},
-std::array<float,2>{0.277628928f, 0.102410868f},
-std::array<float,2>{0.992678642f, 0.50098604f},
-std::array<float,2>{0.612520576f, 0.417890638f},
-std::array<float,2>{0.000177880807f, 0.993476629f},
-std::array<float,2>{0.183591455f, 0.283478469f},
-std::array<float,2>{0.660956442f, 0.87180382f},
-std::array<float,2>{0.844854057f, 0.125752598f},
-std::array<float,2>{0.499401212f, 0.648899674f},
-std::array<float,2>{0.071322985f, 0.189088613f},
-std::array<float,2>{0.523634434f, 0.71896261f},
-std::array<float,2>{0.927668452f, 0.35849601f},
-std::array<float,2>{0.332233816f, 0.806583166f},
-std::array<float,2>{0.432801843f, 0.476761103f},
-std::array<float,2>{0.772592008f, 0.906530619f},
-std::array<float,2>{0.716313183f, 0.0416096635f},
-std::array<float,2>{0.227178365f, 0.566698194f},
-std::array<float,2>{0.447981983f, 0.173867285f},
-std::array<float,2>{0.816412389f, 0.66542232f},
-std::array<float,2>{0.643317759f, 0.280714452f},
-std::array<float,2>{0.132165179f, 0.835882187f},
-std::array<float,2>{0.0619632006f, 0.389532477f},
-std::array<float,2>{0.580712378f, 0.946262062f},
-std::array<float,2>{0.967896521f, 0.0660977215f},
-std::array<float,2>{0.291383684f, 0.547490656f},
-std::array<float,2>{0.201837271f, 0.0231900346f},
-std::array<float,2>{0.72304523f, 0.598521471f},
-std::array<float,2>{0.790604651f, 0.46005854f},
-std::array<float,2>{0.387261838f, 0.896884084f},
-std::array<float,2>{0.356636792f, 0.334498942f},
-std::array<float,2>{0.877852917f, 0.779621005f},
-std::array<float,2>{0.540368497f, 0.226176411f},
-std::array<float,2>{0.0943854004f, 0.710953951f},
-std::array<float,2>{0.399539173f, 0.0561822131f},
-std::array<float,2>{0.80798769f, 0.580737293f},
-std::array<float,2>{0.746942878f, 0.494430453f},
-std::array<float,2>{0.210885242f, 0.921958923f},
-std::array<float,2>{0.123136692f, 0.36607191f},
-std::array<float,2>{0.560652077f, 0.783478141f},
-std::array<float,2>{0.895286083f, 0.214376017f},
-std::array<float,2>{0.360774994f, 0.745922744f},
-std::array<float,2>{0.147448212f, 0.150943369f},
-std::array<float,2>{0.636144698f, 0.640540004f},
-std::array<float,2>{0.834079921f, 0.309453249f},
-std::array<float,2>{0.453795403f, 0.851557195f},
-std::array<float,2>{0.305148333f, 0.428978801f},
-std::array<float,2>{0.942548394f, 0.974343836f},
-std::array<float,2>{0.564285219f, 0.114592202f},
-std::array<float,2>{0.0358601697f, 0.520400047f},
-std::array<float,2>{0.318283856f, 0.248168975f},
-std::array<float,2>{0.916480839f, 0.70179075f},
-std::array<float,2>{0.502695143f, 0.315849036f},
-std::array<float,2>{0.0875623748f, 0.761558175f},
-std::array<float,2>{0.236110255f, 0.452405602f},
-std::array<float,2>{0.690933287f, 0.889104128f},
-std::array<float,2>{0.75847739f, 0.00806102902f},
-std::array<float,2>{0.408679366f, 0.617379427f},
-std::array<float,2>{0.0204722732f, 0.0805054158f},
-std::array<float,2>{0.604524195f, 0.531841695f},
-std::array<float,2>{0.969629765f, 0.401432455f},
-std::array<float,2>{0.264096558f, 0.954455018f},
-std::array<float,2>{0.482323408f, 0.264594704f},
-std::array<float,2>{0.862784028f, 0.814158738f},
-std::array<float,2>{0.673586249f, 0.160231695f},
-std::array<float,2>{0.159513131f, 0.680090308f},
-std::array<float,2>{0.329587549f, 0.093342036f},
-std::array<float,2>{0.924900591f, 0.540198565f},
-std::array<float,2>{0.527919292f, 0.396986127f},
-std::array<float,2>{0.0780003816f, 0.961797714f},
-std::array<float,2>{0.230616301f, 0.256242126f},
-std::array<float,2>{0.713370144f, 0.824409842f},
-std::array<float,2>{0.766239822f, 0.165429875f},
-std::array<float,2>{0.436092734f, 0.672107816f},
-std::array<float,2>{0.00572326826f, 0.241864815f},
-std::array<float,2>{0.613728881f, 0.689038396f},
-std::array<float,2>{0.997706234f, 0.325072169f},
-std::array<float,2>{0.273676425f, 0.757466435f},
-std::array<float,2>{0.49257955f, 0.440027088f},
-std::array<float,2>{0.849814653f, 0.876946926f},
-std::array<float,2>{0.658025026f, 0.00567774288f},
-std::array<float,2>{0.186700016f, 0.616660476f},
-std::array<float,2>{0.385967582f, 0.145914555f},
-std::array<float,2>{0.793121696f, 0.625030637f},
-std::array<float,2>{0.72102344f, 0.300439119f},
-std::array<float,2>{0.195706367f, 0.851883173f},
-std::array<float,2>{0.100965336f, 0.437235206f},
-std::array<float,2>{0.546689868f, 0.977138758f},
-std::array<float,2>{0.882527232f, 0.120675474f},
-std::array<float,2>{0.351983935f, 0.529768825f},
-std::array<float,2>{0.127283573f, 0.048721958f},
-std::array<float,2>{0.648359239f, 0.587385774f},
-std::array<float,2>{0.814610898f, 0.484902352f},
-std::array<float,2>{0.450719446f, 0.935991466f},
-std::array<float,2>{0.294050962f, 0.371887147f},
-std::array<float,2>{0.961626053f, 0.795580566f},
-std::array<float,2>{0.585541248f, 0.209773913f},
-std::array<float,2>{0.0574917085f, 0.736586511f},
-std::array<float,2>{0.457544863f, 0.0246213246f},
-std::array<float,2>{0.828712642f, 0.602886915f},
-std::array<float,2>{0.638125658f, 0.465261132f},
-std::array<float,2>{0.141649157f, 0.904999256f},
-std::array<float,2>{0.0328821428f, 0.336659193f},
-std::array<float,2>{0.568608701f, 0.767679513f},
-std::array<float,2>{0.940394342f, 0.232649669f},
-std::array<float,2>{0.310696661f, 0.705318689f},
-std::array<float,2>{0.204051837f, 0.182223529f},
-std::array<float,2>{0.744456112f, 0.662867844f},
-std::array<float,2>{0.810248196f, 0.272571057f},
-std::array<float,2>{0.40323016f, 0.837078512f},
-std::array<float,2>{0.366958052f, 0.378527224f},
-std::array<float,2>{0.894493043f, 0.938872874f},
-std::array<float,2>{0.555909216f, 0.0724326223f},
-std::array<float,2>{0.117835082f, 0.559236526f},
-std::array<float,2>{0.259598643f, 0.195524842f},
-std::array<float,2>{0.974576175f, 0.732527256f},
-std::array<float,2>{0.60887742f, 0.348278582f},
-std::array<float,2>{0.0161303412f, 0.79802388f},
-std::array<float,2>{0.161658108f, 0.474275917f},
-std::array<float,2>{0.676626563f, 0.921580732f},
-std::array<float,2>{0.865598142f, 0.0350843035f},
-std::array<float,2>{0.479232341f, 0.572282374f},
-std::array<float,2>{0.0923016816f, 0.101209953f},
-std::array<float,2>{0.505896449f, 0.514250517f},
-std::array<float,2>{0.921525002f, 0.410057485f},
-std::array<float,2>{0.314279705f, 0.986960053f},
-std::array<float,2>{0.413790792f, 0.28908512f},
-std::array<float,2>{0.762537181f, 0.861899793f},
-std::array<float,2>{0.69296962f, 0.135680631f},
-std::array<float,2>{0.239097074f, 0.647167742f},
-std::array<float,2>{0.3014732f, 0.0452597477f},
-std::array<float,2>{0.94556129f, 0.56640029f},
-std::array<float,2>{0.572248697f, 0.483775228f},
-std::array<float,2>{0.0432343856f, 0.913192093f},
-std::array<float,2>{0.156081721f, 0.351746202f},
-std::array<float,2>{0.62791127f, 0.812085927f},
-std::array<float,2>{0.836434543f, 0.1923296f},
-std::array<float,2>{0.468108565f, 0.726094842f},
-std::array<float,2>{0.11436028f, 0.131391853f},
-std::array<float,2>{0.549319386f, 0.652800381f},
-std::array<float,2>{0.905344665f, 0.286882132f},
-std::array<float,2>{0.37247774f, 0.870142758f},
-std::array<float,2>{0.397293657f, 0.419396788f},
-std::array<float,2>{0.800510287f, 0.998529196f},
-std::array<float,2>{0.739551783f, 0.10834825f},
-std::array<float,2>{0.215928778f, 0.506778955f},
-std::array<float,2>{0.47325179f, 0.218992844f},
-std::array<float,2>{0.871632218f, 0.715360403f},
-std::array<float,2>{0.687392235f, 0.328497499f},
-std::array<float,2>{0.169428214f, 0.774046183f},
-std::array<float,2>{0.027854003f, 0.454580545f},
-std::array<float,2>{0.594142079f, 0.890998244f},
-std::array<float,2>{0.982298553f, 0.0187501684f},
-std::array<float,2>{0.254699796f, 0.594168544f},
-std::array<float,2>{0.243089646f, 0.0690004602f},
-std::array<float,2>{0.702664435f, 0.552875876f},
-std::array<float,2>{0.752701938f, 0.384813756f},
-std::array<float,2>{0.419205606f, 0.952910602f},
-std::array<float,2>{0.322264612f, 0.274264872f},
-std::array<float,2>{0.907094121f, 0.829072237f},
-std::array<float,2>{0.509382367f, 0.179516792f},
-std::array<float,2>{0.082073465f, 0.669601321f},
-std::array<float,2>{0.425253421f, 0.111302249f},
-std::array<float,2>{0.776687264f, 0.516717494f},
-std::array<float,2>{0.710074067f, 0.422477067f},
-std::array<float,2>{0.225320816f, 0.970919788f},
-std::array<float,2>{0.0661650896f, 0.305498719f},
-std::array<float,2>{0.522980273f, 0.84709847f},
-std::array<float,2>{0.933540106f, 0.154730842f},
-std::array<float,2>{0.340215772f, 0.633973956f},
-std::array<float,2>{0.173546776f, 0.218326047f},
-std::array<float,2>{0.666959643f, 0.747564137f},
-std::array<float,2>{0.857383549f, 0.36114198f},
-std::array<float,2>{0.488700628f, 0.785881877f},
-std::array<float,2>{0.271614641f, 0.496952266f},
-std::array<float,2>{0.990439713f, 0.92827493f},
-std::array<float,2>{0.619270802f, 0.0605466291f},
-std::array<float,2>{0.0151242614f, 0.585881054f},
-std::array<float,2>{0.344627768f, 0.159031034f},
-std::array<float,2>{0.884715974f, 0.683878064f},
-std::array<float,2>{0.538522303f, 0.25832206f},
-std::array<float,2>{0.106245108f, 0.817661583f},
-std::array<float,2>{0.1920463f, 0.40432784f},
-std::array<float,2>{0.727424502f, 0.958305418f},
-std::array<float,2>{0.78817451f, 0.082299225f},
-std::array<float,2>{0.377111316f, 0.538886666f},
-std::array<float,2>{0.0500778668f, 0.0151926819f},
-std::array<float,2>{0.589514017f, 0.621280074f},
-std::array<float,2>{0.958238542f, 0.447801411f},
-std::array<float,2>{0.284871578f, 0.886475623f},
-std::array<float,2>{0.438561052f, 0.319969803f},
-std::array<float,2>{0.822790802f, 0.765196204f},
-std::array<float,2>{0.650553286f, 0.243537456f},
-std::array<float,2>{0.13791804f, 0.698098123f},
-std::array<float,2>{0.350369781f, 0.0390452594f},
-std::array<float,2>{0.888002515f, 0.574384689f},
-std::array<float,2>{0.534427464f, 0.470793128f},
-std::array<float,2>{0.103638068f, 0.916979611f},
-std::array<float,2>{0.190054148f, 0.345701426f},
-std::array<float,2>{0.732997894f, 0.802939475f},
-std::array<float,2>{0.783225417f, 0.200896174f},
-std::array<float,2>{0.382172912f, 0.727689147f},
-std::array<float,2>{0.0523029901f, 0.137858123f},
-std::array<float,2>{0.590670347f, 0.641091764f},
-std::array<float,2>{0.95548892f, 0.293214023f},
-std::array<float,2>{0.287421763f, 0.865694225f},
-std::array<float,2>{0.44291687f, 0.412657946f},
-std::array<float,2>{0.826282203f, 0.988866866f},
-std::array<float,2>{0.653441966f, 0.093861796f},
-std::array<float,2>{0.133547246f, 0.508679092f},
-std::array<float,2>{0.428034276f, 0.226892129f},
-std::array<float,2>{0.779715002f, 0.708169937f},
-std::array<float,2>{0.706040204f, 0.341940403f},
-std::array<float,2>{0.221070766f, 0.769542336f},
-std::array<float,2>{0.0690113381f, 0.46467346f},
-std::array<float,2>{0.517945886f, 0.901470542f},
-std::array<float,2>{0.937152445f, 0.0277489163f},
-std::array<float,2>{0.336437345f, 0.606477976f},
-std::array<float,2>{0.17681998f, 0.0745145604f},
-std::array<float,2>{0.669326246f, 0.555082083f},
-std::array<float,2>{0.854866326f, 0.379367799f},
-std::array<float,2>{0.486204565f, 0.941943944f},
-std::array<float,2>{0.268144488f, 0.266147822f},
-std::array<float,2>{0.987695098f, 0.839912653f},
-std::array<float,2>{0.622205675f, 0.185075819f},
-std::array<float,2>{0.00919637177f, 0.658367932f},
-std::array<float,2>{0.47012803f, 0.123287871f},
-std::array<float,2>{0.870640755f, 0.524266005f},
-std::array<float,2>{0.680663466f, 0.429962158f},
-std::array<float,2>{0.167400122f, 0.983863175f},
-std::array<float,2>{0.0260169897f, 0.301223248f},
-std::array<float,2>{0.599317729f, 0.855693996f},
-std::array<float,2>{0.978845358f, 0.142910153f},
-std::array<float,2>{0.250545084f, 0.63036114f},
-std::array<float,2>{0.249297291f, 0.206866801f},
-std::array<float,2>{0.696721375f, 0.741939247f},
-std::array<float,2>{0.756803334f, 0.368083507f},
-std::array<float,2>{0.417948425f, 0.79053694f},
-std::array<float,2>{0.326549649f, 0.488644421f},
-std::array<float,2>{0.911199152f, 0.931067169f},
-std::array<float,2>{0.512492001f, 0.0536943488f},
-std::array<float,2>{0.0809413493f, 0.592949092f},
-std::array<float,2>{0.3000893f, 0.171171367f},
-std::array<float,2>{0.952594221f, 0.67931056f},
-std::array<float,2>{0.575392902f, 0.253388643f},
-std::array<float,2>{0.0424424f, 0.820928991f},
-std::array<float,2>{0.148749396f, 0.393193007f},
-std::array<float,2>{0.630232632f, 0.96599406f},
-std::array<float,2>{0.840113163f, 0.0866035223f},
-std::array<float,2>{0.463626623f, 0.544331729f},
-std::array<float,2>{0.111180902f, 0.00383464294f},
-std::array<float,2>{0.550935209f, 0.609402061f},
-std::array<float,2>{0.899515927f, 0.442554116f},
-std::array<float,2>{0.37092635f, 0.882485986f},
-std::array<float,2>{0.394364536f, 0.321726888f},
-std::array<float,2>{0.80262804f, 0.751236022f},
-std::array<float,2>{0.736040711f, 0.235463768f},
-std::array<float,2>{0.213440895f, 0.69419086f},
-std::array<float,2>{0.264802068f, 0.079413645f},
-std::array<float,2>{0.970469296f, 0.533748507f},
-std::array<float,2>{0.603963614f, 0.399669915f},
-std::array<float,2>{0.0212105103f, 0.955787659f},
-std::array<float,2>{0.158624113f, 0.263011158f},
-std::array<float,2>{0.672743797f, 0.816025436f},
-std::array<float,2>{0.861533523f, 0.163413852f},
-std::array<float,2>{0.480591774f, 0.681855738f},
-std::array<float,2>{0.0864527151f, 0.2461043f},
-std::array<float,2>{0.503734231f, 0.700642407f},
-std::array<float,2>{0.917428315f, 0.313410133f},
-std::array<float,2>{0.316591352f, 0.758068919f},
-std::array<float,2>{0.409805626f, 0.449807614f},
-std::array<float,2>{0.759698033f, 0.887432456f},
-std::array<float,2>{0.690428615f, 0.0107565029f},
-std::array<float,2>{0.234699085f, 0.619618535f},
-std::array<float,2>{0.455017656f, 0.149789765f},
-std::array<float,2>{0.835265756f, 0.636724234f},
-std::array<float,2>{0.635493457f, 0.311761945f},
-std::array<float,2>{0.148417071f, 0.848646283f},
-std::array<float,2>{0.0364432558f, 0.427383065f},
-std::array<float,2>{0.562939942f, 0.974861324f},
-std::array<float,2>{0.941819966f, 0.116909571f},
-std::array<float,2>{0.305832237f, 0.522618651f},
-std::array<float,2>{0.2098369f, 0.0583173893f},
-std::array<float,2>{0.747449279f, 0.579585493f},
-std::array<float,2>{0.807506323f, 0.493917316f},
-std::array<float,2>{0.399074763f, 0.925180912f},
-std::array<float,2>{0.359440178f, 0.363967359f},
-std::array<float,2>{0.895589173f, 0.781279862f},
-std::array<float,2>{0.562026978f, 0.212064102f},
-std::array<float,2>{0.124174431f, 0.742463171f},
-std::array<float,2>{0.387815893f, 0.0205353815f},
-std::array<float,2>{0.789989412f, 0.601096988f},
-std::array<float,2>{0.723952234f, 0.457215071f},
-std::array<float,2>{0.202774018f, 0.89606899f},
-std::array<float,2>{0.0947939679f, 0.332087159f},
-std::array<float,2>{0.539134264f, 0.77926147f},
-std::array<float,2>{0.878654182f, 0.223716915f},
-std::array<float,2>{0.356090665f, 0.714132071f},
-std::array<float,2>{0.130940259f, 0.172899112f},
-std::array<float,2>{0.643796682f, 0.66777426f},
-std::array<float,2>{0.818118274f, 0.278452426f},
-std::array<float,2>{0.448363841f, 0.832454443f},
-std::array<float,2>{0.292578936f, 0.388550013f},
-std::array<float,2>{0.967326701f, 0.947848678f},
-std::array<float,2>{0.581696212f, 0.0641651079f},
-std::array<float,2>{0.0606879778f, 0.549039721f},
-std::array<float,2>{0.33378306f, 0.190327704f},
-std::array<float,2>{0.926407576f, 0.721137822f},
-std::array<float,2>{0.525228024f, 0.355625749f},
-std::array<float,2>{0.0709572509f, 0.806666851f},
-std::array<float,2>{0.227719486f, 0.479804724f},
-std::array<float,2>{0.715030372f, 0.909745634f},
-std::array<float,2>{0.772158265f, 0.0402524211f},
-std::array<float,2>{0.43235901f, 0.569473624f},
-std::array<float,2>{0.00133666885f, 0.104465201f},
-std::array<float,2>{0.61225915f, 0.502045572f},
-std::array<float,2>{0.993973136f, 0.414293319f},
-std::array<float,2>{0.278459489f, 0.995051444f},
-std::array<float,2>{0.498357803f, 0.282028228f},
-std::array<float,2>{0.843920469f, 0.873734951f},
-std::array<float,2>{0.661145985f, 0.128577918f},
-std::array<float,2>{0.182603568f, 0.651544511f},
-std::array<float,2>{0.313415885f, 0.0984449163f},
-std::array<float,2>{0.920252085f, 0.512831032f},
-std::array<float,2>{0.507583618f, 0.407686472f},
-std::array<float,2>{0.093672283f, 0.984642029f},
-std::array<float,2>{0.240008116f, 0.292966276f},
-std::array<float,2>{0.691425681f, 0.861227155f},
-std::array<float,2>{0.762812555f, 0.134563401f},
-std::array<float,2>{0.412370801f, 0.645898521f},
-std::array<float,2>{0.0171258785f, 0.198529944f},
-std::array<float,2>{0.607930183f, 0.732161283f},
-std::array<float,2>{0.972682536f, 0.350778639f},
-std::array<float,2>{0.25876829f, 0.799948514f},
-std::array<float,2>{0.479967535f, 0.476215541f},
-std::array<float,2>{0.866395652f, 0.919376433f},
-std::array<float,2>{0.677576482f, 0.0318041779f},
-std::array<float,2>{0.16105251f, 0.570595443f},
-std::array<float,2>{0.403472602f, 0.180806845f},
-std::array<float,2>{0.808997273f, 0.661062658f},
-std::array<float,2>{0.745141029f, 0.269698501f},
-std::array<float,2>{0.204305932f, 0.838565707f},
-std::array<float,2>{0.118931755f, 0.375776291f},
-std::array<float,2>{0.554836035f, 0.940277219f},
-std::array<float,2>{0.89296025f, 0.0709487721f},
-std::array<float,2>{0.365970939f, 0.561050177f},
-std::array<float,2>{0.141263187f, 0.026129311f},
-std::array<float,2>{0.637250721f, 0.603827953f},
-std::array<float,2>{0.829399765f, 0.467313886f},
-std::array<float,2>{0.458625913f, 0.904125929f},
-std::array<float,2>{0.312361509f, 0.338250667f},
-std::array<float,2>{0.941381812f, 0.765725732f},
-std::array<float,2>{0.569840074f, 0.231158242f},
-std::array<float,2>{0.0316654891f, 0.704906464f},
-std::array<float,2>{0.449892104f, 0.048840221f},
-std::array<float,2>{0.815990925f, 0.588291228f},
-std::array<float,2>{0.647127509f, 0.487019867f},
-std::array<float,2>{0.128492042f, 0.934690952f},
-std::array<float,2>{0.0583294816f, 0.374316305f},
-std::array<float,2>{0.584022224f, 0.794743776f},
-std::array<float,2>{0.96194613f, 0.208110303f},
-std::array<float,2>{0.293543637f, 0.735047817f},
-std::array<float,2>{0.196757302f, 0.146610081f},
-std::array<float,2>{0.721730649f, 0.627982378f},
-std::array<float,2>{0.793997943f, 0.298462838f},
-std::array<float,2>{0.385590702f, 0.854319334f},
-std::array<float,2>{0.353247017f, 0.433838636f},
-std::array<float,2>{0.881512284f, 0.978654683f},
-std::array<float,2>{0.545695305f, 0.118763939f},
-std::array<float,2>{0.10015215f, 0.527589917f},
-std::array<float,2>{0.274848104f, 0.240156889f},
-std::array<float,2>{0.996151865f, 0.690775573f},
-std::array<float,2>{0.61509347f, 0.327570468f},
-std::array<float,2>{0.00425015669f, 0.755769074f},
-std::array<float,2>{0.185691908f, 0.438307703f},
-std::array<float,2>{0.656873226f, 0.877160609f},
-std::array<float,2>{0.851418734f, 0.00743126869f},
-std::array<float,2>{0.493464738f, 0.613423645f},
-std::array<float,2>{0.0762385428f, 0.0917960331f},
-std::array<float,2>{0.529175043f, 0.541406512f},
-std::array<float,2>{0.924455345f, 0.396453798f},
-std::array<float,2>{0.328534067f, 0.96312654f},
-std::array<float,2>{0.437003374f, 0.255558282f},
-std::array<float,2>{0.767460823f, 0.827580035f},
-std::array<float,2>{0.714383245f, 0.16660063f},
-std::array<float,2>{0.231901497f, 0.674507141f},
-std::array<float,2>{0.283861905f, 0.0120267402f},
-std::array<float,2>{0.957059622f, 0.624460578f},
-std::array<float,2>{0.588423491f, 0.445881158f},
-std::array<float,2>{0.0492889844f, 0.882965863f},
-std::array<float,2>{0.136747435f, 0.31800878f},
-std::array<float,2>{0.651868224f, 0.762110054f},
-std::array<float,2>{0.823505521f, 0.245228857f},
-std::array<float,2>{0.438016415f, 0.696391523f},
-std::array<float,2>{0.107327059f, 0.158085227f},
-std::array<float,2>{0.538069189f, 0.686287165f},
-std::array<float,2>{0.882964253f, 0.260647029f},
-std::array<float,2>{0.344899923f, 0.819228649f},
-std::array<float,2>{0.378732085f, 0.40260762f},
-std::array<float,2>{0.787807345f, 0.960360348f},
-std::array<float,2>{0.728422463f, 0.0856302157f},
-std::array<float,2>{0.193231478f, 0.535976052f},
-std::array<float,2>{0.489742398f, 0.21621792f},
-std::array<float,2>{0.856045783f, 0.749042809f},
-std::array<float,2>{0.667843461f, 0.363019079f},
-std::array<float,2>{0.172080576f, 0.78846693f},
-std::array<float,2>{0.0145868044f, 0.499155998f},
-std::array<float,2>{0.620602787f, 0.927409589f},
-std::array<float,2>{0.991963327f, 0.061840497f},
-std::array<float,2>{0.272821933f, 0.582739413f},
-std::array<float,2>{0.226039261f, 0.111904442f},
-std::array<float,2>{0.709265888f, 0.518482447f},
-std::array<float,2>{0.775625408f, 0.425304353f},
-std::array<float,2>{0.424711049f, 0.969475687f},
-std::array<float,2>{0.341142118f, 0.307385802f},
-std::array<float,2>{0.932109892f, 0.844650269f},
-std::array<float,2>{0.521920204f, 0.153789639f},
-std::array<float,2>{0.0651828945f, 0.635600328f},
-std::array<float,2>{0.418394893f, 0.0677197054f},
-std::array<float,2>{0.753693819f, 0.551514626f},
-std::array<float,2>{0.701737702f, 0.383852988f},
-std::array<float,2>{0.243376732f, 0.949773073f},
-std::array<float,2>{0.0833225548f, 0.276560456f},
-std::array<float,2>{0.508778989f, 0.83180815f},
-std::array<float,2>{0.907895386f, 0.177510008f},
-std::array<float,2>{0.320546895f, 0.669924676f},
-std::array<float,2>{0.168515384f, 0.222380221f},
-std::array<float,2>{0.686241925f, 0.718499005f},
-std::array<float,2>{0.872307122f, 0.330629915f},
-std::array<float,2>{0.474231511f, 0.775669694f},
-std::array<float,2>{0.255802572f, 0.456629217f},
-std::array<float,2>{0.981025815f, 0.893654168f},
-std::array<float,2>{0.595680773f, 0.0171838161f},
-std::array<float,2>{0.0285287797f, 0.596086144f},
-std::array<float,2>{0.371570766f, 0.130384773f},
-std::array<float,2>{0.904531538f, 0.655882478f},
-std::array<float,2>{0.550529063f, 0.287663788f},
-std::array<float,2>{0.114124231f, 0.867851198f},
-std::array<float,2>{0.215577722f, 0.419988424f},
-std::array<float,2>{0.739102304f, 0.997404814f},
-std::array<float,2>{0.799405932f, 0.106644072f},
-std::array<float,2>{0.398235738f, 0.504242957f},
-std::array<float,2>{0.0439548269f, 0.0430815555f},
-std::array<float,2>{0.5711357f, 0.563104689f},
-std::array<float,2>{0.946705878f, 0.482124299f},
-std::array<float,2>{0.302711785f, 0.911421537f},
-std::array<float,2>{0.467688352f, 0.354929477f},
-std::array<float,2>{0.837601602f, 0.809309065f},
-std::array<float,2>{0.627945483f, 0.194205999f},
-std::array<float,2>{0.154733881f, 0.723866701f},
-std::array<float,2>{0.338342339f, 0.0307328012f},
-std::array<float,2>{0.934508085f, 0.607963204f},
-std::array<float,2>{0.515770614f, 0.461779863f},
-std::array<float,2>{0.0675324947f, 0.89990145f},
-std::array<float,2>{0.219013855f, 0.340871215f},
-std::array<float,2>{0.703949094f, 0.771630824f},
-std::array<float,2>{0.778494418f, 0.229888946f},
-std::array<float,2>{0.426573306f, 0.709458828f},
-std::array<float,2>{0.0106080296f, 0.186998472f},
-std::array<float,2>{0.624497354f, 0.657823086f},
-std::array<float,2>{0.985036671f, 0.268874794f},
-std::array<float,2>{0.265688479f, 0.842550278f},
-std::array<float,2>{0.487918079f, 0.38181895f},
-std::array<float,2>{0.851951599f, 0.94403559f},
-std::array<float,2>{0.670632124f, 0.0774263889f},
-std::array<float,2>{0.178985775f, 0.556834877f},
-std::array<float,2>{0.379908144f, 0.201247513f},
-std::array<float,2>{0.783168137f, 0.728991032f},
-std::array<float,2>{0.731554508f, 0.346308887f},
-std::array<float,2>{0.188562825f, 0.801944077f},
-std::array<float,2>{0.102882966f, 0.4693937f},
-std::array<float,2>{0.532472789f, 0.915837467f},
-std::array<float,2>{0.890413344f, 0.0351888947f},
-std::array<float,2>{0.348537356f, 0.577880204f},
-std::array<float,2>{0.135752156f, 0.0957209989f},
-std::array<float,2>{0.655074775f, 0.511240721f},
-std::array<float,2>{0.826100886f, 0.410223663f},
-std::array<float,2>{0.443651587f, 0.990375638f},
-std::array<float,2>{0.28567183f, 0.295874715f},
-std::array<float,2>{0.954736829f, 0.863798678f},
-std::array<float,2>{0.592408419f, 0.140357658f},
-std::array<float,2>{0.0539437495f, 0.644444227f},
-std::array<float,2>{0.462180793f, 0.088530913f},
-std::array<float,2>{0.843523085f, 0.546715081f},
-std::array<float,2>{0.632194221f, 0.392124623f},
-std::array<float,2>{0.1504879f, 0.96785289f},
-std::array<float,2>{0.0402885973f, 0.250265419f},
-std::array<float,2>{0.577294052f, 0.822938144f},
-std::array<float,2>{0.950115085f, 0.169059694f},
-std::array<float,2>{0.297127575f, 0.676110327f},
-std::array<float,2>{0.212477788f, 0.237896279f},
-std::array<float,2>{0.737335443f, 0.692709744f},
-std::array<float,2>{0.804309309f, 0.323587924f},
-std::array<float,2>{0.390639573f, 0.753382385f},
-std::array<float,2>{0.368601084f, 0.445022196f},
-std::array<float,2>{0.901185155f, 0.879970968f},
-std::array<float,2>{0.553147078f, 0.00176696538f},
-std::array<float,2>{0.111813314f, 0.612061262f},
-std::array<float,2>{0.251962394f, 0.141043395f},
-std::array<float,2>{0.977397501f, 0.631474674f},
-std::array<float,2>{0.600776196f, 0.303606987f},
-std::array<float,2>{0.0234470982f, 0.859027326f},
-std::array<float,2>{0.164880276f, 0.43347159f},
-std::array<float,2>{0.681948483f, 0.981912553f},
-std::array<float,2>{0.868343174f, 0.121196613f},
-std::array<float,2>{0.471486002f, 0.526218772f},
-std::array<float,2>{0.0792627931f, 0.0507882051f},
-std::array<float,2>{0.514681041f, 0.59005183f},
-std::array<float,2>{0.912962317f, 0.492010653f},
-std::array<float,2>{0.324459195f, 0.93300128f},
-std::array<float,2>{0.415828913f, 0.371019393f},
-std::array<float,2>{0.754731655f, 0.79106164f},
-std::array<float,2>{0.697353661f, 0.203677207f},
-std::array<float,2>{0.247763008f, 0.739035547f},
-std::array<float,2>{0.308094114f, 0.113330841f},
-std::array<float,2>{0.944200695f, 0.521088183f},
-std::array<float,2>{0.566258252f, 0.427773714f},
-std::array<float,2>{0.0378981568f, 0.973435998f},
-std::array<float,2>{0.146327704f, 0.309906662f},
-std::array<float,2>{0.633378088f, 0.850141227f},
-std::array<float,2>{0.833069503f, 0.151389077f},
-std::array<float,2>{0.455558926f, 0.638725042f},
-std::array<float,2>{0.121714644f, 0.213032484f},
-std::array<float,2>{0.559052825f, 0.744243205f},
-std::array<float,2>{0.896810591f, 0.366480947f},
-std::array<float,2>{0.362075686f, 0.784304023f},
-std::array<float,2>{0.402337015f, 0.495488882f},
-std::array<float,2>{0.80572021f, 0.923702836f},
-std::array<float,2>{0.74847728f, 0.0547834486f},
-std::array<float,2>{0.208211154f, 0.581461251f},
-std::array<float,2>{0.483319968f, 0.161345571f},
-std::array<float,2>{0.86090678f, 0.681321859f},
-std::array<float,2>{0.67565918f, 0.264961988f},
-std::array<float,2>{0.15633972f, 0.813441157f},
-std::array<float,2>{0.0222238898f, 0.401301086f},
-std::array<float,2>{0.602771461f, 0.953459442f},
-std::array<float,2>{0.971602201f, 0.0811377838f},
-std::array<float,2>{0.262769371f, 0.532791257f},
-std::array<float,2>{0.237497553f, 0.00964697171f},
-std::array<float,2>{0.688409626f, 0.618907988f},
-std::array<float,2>{0.760782957f, 0.45200792f},
-std::array<float,2>{0.407137036f, 0.889806092f},
-std::array<float,2>{0.319180429f, 0.315245986f},
-std::array<float,2>{0.915077746f, 0.760507762f},
-std::array<float,2>{0.501890242f, 0.249356642f},
-std::array<float,2>{0.0882448629f, 0.70250392f},
-std::array<float,2>{0.431483716f, 0.0420198627f},
-std::array<float,2>{0.771099031f, 0.568239391f},
-std::array<float,2>{0.718176663f, 0.478362292f},
-std::array<float,2>{0.228712589f, 0.90804559f},
-std::array<float,2>{0.0734966472f, 0.357547015f},
-std::array<float,2>{0.526975453f, 0.804774523f},
-std::array<float,2>{0.92775327f, 0.188378751f},
-std::array<float,2>{0.334722161f, 0.719944298f},
-std::array<float,2>{0.18025434f, 0.126190692f},
-std::array<float,2>{0.663936079f, 0.650325954f},
-std::array<float,2>{0.846295834f, 0.284221172f},
-std::array<float,2>{0.496121973f, 0.872450769f},
-std::array<float,2>{0.28052932f, 0.416312397f},
-std::array<float,2>{0.995053351f, 0.992952883f},
-std::array<float,2>{0.609446347f, 0.103340313f},
-std::array<float,2>{0.00322994101f, 0.500667393f},
-std::array<float,2>{0.358398259f, 0.224756747f},
-std::array<float,2>{0.8765167f, 0.712536514f},
-std::array<float,2>{0.542874157f, 0.335636824f},
-std::array<float,2>{0.0958810076f, 0.781038821f},
-std::array<float,2>{0.200867429f, 0.459085226f},
-std::array<float,2>{0.726218402f, 0.898209214f},
-std::array<float,2>{0.791988254f, 0.0224536862f},
-std::array<float,2>{0.390300602f, 0.599093199f},
-std::array<float,2>{0.0599635206f, 0.0645650551f},
-std::array<float,2>{0.579805136f, 0.548435867f},
-std::array<float,2>{0.965526462f, 0.390129119f},
-std::array<float,2>{0.289902806f, 0.946573675f},
-std::array<float,2>{0.445325702f, 0.27989918f},
-std::array<float,2>{0.8196913f, 0.834864378f},
-std::array<float,2>{0.642020047f, 0.174817547f},
-std::array<float,2>{0.129020721f, 0.664350748f},
-std::array<float,2>{0.365198255f, 0.0738497227f},
-std::array<float,2>{0.891611576f, 0.560274541f},
-std::array<float,2>{0.558482051f, 0.377689272f},
-std::array<float,2>{0.119341835f, 0.937981248f},
-std::array<float,2>{0.206280276f, 0.271561503f},
-std::array<float,2>{0.743445694f, 0.836480618f},
-std::array<float,2>{0.811454058f, 0.183371961f},
-std::array<float,2>{0.404747248f, 0.663200676f},
-std::array<float,2>{0.0338497423f, 0.233977094f},
-std::array<float,2>{0.566657126f, 0.706731975f},
-std::array<float,2>{0.938520312f, 0.337127179f},
-std::array<float,2>{0.308837175f, 0.768568516f},
-std::array<float,2>{0.459150791f, 0.466176987f},
-std::array<float,2>{0.8319121f, 0.906016707f},
-std::array<float,2>{0.640411317f, 0.0237228088f},
-std::array<float,2>{0.14418447f, 0.60187006f},
-std::array<float,2>{0.410567731f, 0.136582911f},
-std::array<float,2>{0.7637766f, 0.647619545f},
-std::array<float,2>{0.693555236f, 0.290065199f},
-std::array<float,2>{0.24054338f, 0.862636507f},
-std::array<float,2>{0.0899723023f, 0.409022152f},
-std::array<float,2>{0.504141212f, 0.987549722f},
-std::array<float,2>{0.918192565f, 0.100505129f},
-std::array<float,2>{0.314834088f, 0.515541375f},
-std::array<float,2>{0.162260816f, 0.0337170437f},
-std::array<float,2>{0.678789616f, 0.574124157f},
-std::array<float,2>{0.864499867f, 0.473373264f},
-std::array<float,2>{0.477246433f, 0.920215487f},
-std::array<float,2>{0.261228919f, 0.349433988f},
-std::array<float,2>{0.975951612f, 0.797002017f},
-std::array<float,2>{0.605881989f, 0.196612701f},
-std::array<float,2>{0.0189717393f, 0.733658135f},
-std::array<float,2>{0.494316041f, 0.00445988262f},
-std::array<float,2>{0.849259079f, 0.615742266f},
-std::array<float,2>{0.65870446f, 0.441283882f},
-std::array<float,2>{0.183861911f, 0.87585628f},
-std::array<float,2>{0.0059541692f, 0.325790972f},
-std::array<float,2>{0.616792142f, 0.756576836f},
-std::array<float,2>{0.998491704f, 0.240475059f},
-std::array<float,2>{0.276172489f, 0.687857866f},
-std::array<float,2>{0.233796194f, 0.164522484f},
-std::array<float,2>{0.712413669f, 0.673645854f},
-std::array<float,2>{0.768299758f, 0.257154703f},
-std::array<float,2>{0.435110748f, 0.82586354f},
-std::array<float,2>{0.331740439f, 0.398370862f},
-std::array<float,2>{0.922489285f, 0.962026596f},
-std::array<float,2>{0.530284464f, 0.0925313234f},
-std::array<float,2>{0.0761072561f, 0.539282024f},
-std::array<float,2>{0.295604438f, 0.21003896f},
-std::array<float,2>{0.963602483f, 0.737474501f},
-std::array<float,2>{0.583805859f, 0.372238159f},
-std::array<float,2>{0.0562237054f, 0.796560466f},
-std::array<float,2>{0.126241297f, 0.485464811f},
-std::array<float,2>{0.645993233f, 0.936964393f},
-std::array<float,2>{0.812618971f, 0.0477515794f},
-std::array<float,2>{0.451852739f, 0.586257339f},
-std::array<float,2>{0.098515071f, 0.119920969f},
-std::array<float,2>{0.543333888f, 0.530412197f},
-std::array<float,2>{0.879114807f, 0.436467975f},
-std::array<float,2>{0.354061335f, 0.977816701f},
-std::array<float,2>{0.382873088f, 0.299775749f},
-std::array<float,2>{0.795894384f, 0.853404164f},
-std::array<float,2>{0.719912231f, 0.144855931f},
-std::array<float,2>{0.198272645f, 0.62632513f},
-std::array<float,2>{0.27069208f, 0.0589363389f},
-std::array<float,2>{0.98858279f, 0.584783077f},
-std::array<float,2>{0.617803156f, 0.49764961f},
-std::array<float,2>{0.0123617295f, 0.92964828f},
-std::array<float,2>{0.174498767f, 0.360209852f},
-std::array<float,2>{0.665013075f, 0.787103653f},
-std::array<float,2>{0.858162165f, 0.217117608f},
-std::array<float,2>{0.491112202f, 0.746168375f},
-std::array<float,2>{0.0644379258f, 0.155483335f},
-std::array<float,2>{0.520590663f, 0.632981241f},
-std::array<float,2>{0.930869877f, 0.305860192f},
-std::array<float,2>{0.343664289f, 0.846211016f},
-std::array<float,2>{0.422033817f, 0.423561662f},
-std::array<float,2>{0.774996042f, 0.971845865f},
-std::array<float,2>{0.707100809f, 0.110161416f},
-std::array<float,2>{0.222982362f, 0.516225219f},
-std::array<float,2>{0.441205114f, 0.242778227f},
-std::array<float,2>{0.82205683f, 0.698341787f},
-std::array<float,2>{0.649909735f, 0.319267869f},
-std::array<float,2>{0.139096141f, 0.764552534f},
-std::array<float,2>{0.0476491749f, 0.448894292f},
-std::array<float,2>{0.586654425f, 0.884911537f},
-std::array<float,2>{0.959330797f, 0.0143316146f},
-std::array<float,2>{0.282937884f, 0.622071445f},
-std::array<float,2>{0.194914415f, 0.0830913559f},
-std::array<float,2>{0.730112791f, 0.537227869f},
-std::array<float,2>{0.785948336f, 0.405469716f},
-std::array<float,2>{0.375489682f, 0.957265496f},
-std::array<float,2>{0.346059531f, 0.259654194f},
-std::array<float,2>{0.885682404f, 0.817153156f},
-std::array<float,2>{0.536219716f, 0.16008985f},
-std::array<float,2>{0.108733423f, 0.685370207f},
-std::array<float,2>{0.395164341f, 0.108804926f},
-std::array<float,2>{0.798020184f, 0.507061422f},
-std::array<float,2>{0.740668297f, 0.418560654f},
-std::array<float,2>{0.217972577f, 0.999202907f},
-std::array<float,2>{0.116262779f, 0.285545677f},
-std::array<float,2>{0.54882437f, 0.869981706f},
-std::array<float,2>{0.903189182f, 0.131894961f},
-std::array<float,2>{0.374356002f, 0.654157519f},
-std::array<float,2>{0.153760731f, 0.193117246f},
-std::array<float,2>{0.625350535f, 0.725195229f},
-std::array<float,2>{0.839145243f, 0.352581292f},
-std::array<float,2>{0.466427982f, 0.810887039f},
-std::array<float,2>{0.303380102f, 0.482969999f},
-std::array<float,2>{0.947885811f, 0.912921488f},
-std::array<float,2>{0.573718905f, 0.0465898886f},
-std::array<float,2>{0.046342209f, 0.565024018f},
-std::array<float,2>{0.323602319f, 0.178434715f},
-std::array<float,2>{0.909532785f, 0.668724298f},
-std::array<float,2>{0.511692822f, 0.275076628f},
-std::array<float,2>{0.0845513567f, 0.829648554f},
-std::array<float,2>{0.24533093f, 0.385799795f},
-std::array<float,2>{0.69997412f, 0.952095389f},
-std::array<float,2>{0.751454234f, 0.0700408593f},
-std::array<float,2>{0.421782285f, 0.553988457f},
-std::array<float,2>{0.0311847385f, 0.0184624959f},
-std::array<float,2>{0.597238481f, 0.595543146f},
-std::array<float,2>{0.98355186f, 0.453454554f},
-std::array<float,2>{0.257197291f, 0.891895175f},
-std::array<float,2>{0.47567749f, 0.329984337f},
-std::array<float,2>{0.874615192f, 0.774873376f},
-std::array<float,2>{0.685009778f, 0.220478311f},
-std::array<float,2>{0.171071112f, 0.716229618f},
-std::array<float,2>{0.334129214f, 0.0406958051f},
-std::array<float,2>{0.928570032f, 0.570270836f},
-std::array<float,2>{0.52661711f, 0.48002246f},
-std::array<float,2>{0.0739308298f, 0.909429371f},
-std::array<float,2>{0.229478627f, 0.356233925f},
-std::array<float,2>{0.718421936f, 0.807193875f},
-std::array<float,2>{0.770959795f, 0.189748093f},
-std::array<float,2>{0.430961609f, 0.721452415f},
-std::array<float,2>{0.00382361026f, 0.127933845f},
-std::array<float,2>{0.610173047f, 0.651860535f},
-std::array<float,2>{0.994224906f, 0.281568348f},
-std::array<float,2>{0.281194746f, 0.873191416f},
-std::array<float,2>{0.497033536f, 0.414874852f},
-std::array<float,2>{0.846108794f, 0.994425058f},
-std::array<float,2>{0.663473725f, 0.103532247f},
-std::array<float,2>{0.179884031f, 0.502676308f},
-std::array<float,2>{0.389916062f, 0.224553794f},
-std::array<float,2>{0.791100264f, 0.714371979f},
-std::array<float,2>{0.725993931f, 0.332773656f},
-std::array<float,2>{0.200520366f, 0.77844429f},
-std::array<float,2>{0.0964793488f, 0.457928896f},
-std::array<float,2>{0.542135358f, 0.895624518f},
-std::array<float,2>{0.876257539f, 0.021210786f},
-std::array<float,2>{0.357742369f, 0.601016939f},
-std::array<float,2>{0.12981087f, 0.0638083965f},
-std::array<float,2>{0.642335355f, 0.549623847f},
-std::array<float,2>{0.81991756f, 0.387810379f},
-std::array<float,2>{0.446279824f, 0.947353244f},
-std::array<float,2>{0.28927508f, 0.279063851f},
-std::array<float,2>{0.965066671f, 0.832986772f},
-std::array<float,2>{0.579179645f, 0.173485205f},
-std::array<float,2>{0.0605058782f, 0.667128086f},
-std::array<float,2>{0.45589301f, 0.116675027f},
-std::array<float,2>{0.833665013f, 0.523010492f},
-std::array<float,2>{0.63313961f, 0.427178711f},
-std::array<float,2>{0.145623893f, 0.975321829f},
-std::array<float,2>{0.0373467207f, 0.312445432f},
-std::array<float,2>{0.56590724f, 0.849435985f},
-std::array<float,2>{0.943443179f, 0.150129974f},
-std::array<float,2>{0.308300376f, 0.637470543f},
-std::array<float,2>{0.208532199f, 0.212615147f},
-std::array<float,2>{0.748610556f, 0.742757618f},
-std::array<float,2>{0.806218028f, 0.363446534f},
-std::array<float,2>{0.401720732f, 0.782062531f},
-std::array<float,2>{0.361695409f, 0.493247926f},
-std::array<float,2>{0.897104502f, 0.925698638f},
-std::array<float,2>{0.559239507f, 0.0578695014f},
-std::array<float,2>{0.121356972f, 0.579835117f},
-std::array<float,2>{0.263372034f, 0.163628444f},
-std::array<float,2>{0.97086525f, 0.682316899f},
-std::array<float,2>{0.60330981f, 0.263530672f},
-std::array<float,2>{0.021853067f, 0.815679371f},
-std::array<float,2>{0.157121971f, 0.400237799f},
-std::array<float,2>{0.674834907f, 0.955283165f},
-std::array<float,2>{0.860627651f, 0.0800394118f},
-std::array<float,2>{0.482484192f, 0.533421457f},
-std::array<float,2>{0.0885317922f, 0.0114386985f},
-std::array<float,2>{0.501309693f, 0.619876742f},
-std::array<float,2>{0.916001081f, 0.449454248f},
-std::array<float,2>{0.318737775f, 0.887110233f},
-std::array<float,2>{0.406306118f, 0.312684357f},
-std::array<float,2>{0.761254609f, 0.758513927f},
-std::array<float,2>{0.687974036f, 0.246617943f},
-std::array<float,2>{0.238047361f, 0.700752318f},
-std::array<float,2>{0.297462493f, 0.0861214772f},
-std::array<float,2>{0.949685574f, 0.544620275f},
-std::array<float,2>{0.57808131f, 0.392597973f},
-std::array<float,2>{0.0407588221f, 0.966780961f},
-std::array<float,2>{0.151129574f, 0.253451765f},
-std::array<float,2>{0.632759154f, 0.820414901f},
-std::array<float,2>{0.842999816f, 0.171871305f},
-std::array<float,2>{0.462668002f, 0.678867996f},
-std::array<float,2>{0.111989573f, 0.236098617f},
-std::array<float,2>{0.553502321f, 0.693680406f},
-std::array<float,2>{0.900863826f, 0.321880221f},
-std::array<float,2>{0.369094402f, 0.751900792f},
-std::array<float,2>{0.391588479f, 0.442908287f},
-std::array<float,2>{0.803758264f, 0.881888092f},
-std::array<float,2>{0.737853765f, 0.00336959166f},
-std::array<float,2>{0.212401852f, 0.610110462f},
-std::array<float,2>{0.470979512f, 0.14349626f},
-std::array<float,2>{0.869007528f, 0.630413592f},
-std::array<float,2>{0.682582438f, 0.301494658f},
-std::array<float,2>{0.164178476f, 0.856234789f},
-std::array<float,2>{0.0241652783f, 0.430392832f},
-std::array<float,2>{0.601278961f, 0.984075785f},
-std::array<float,2>{0.97682935f, 0.123897597f},
-std::array<float,2>{0.252777457f, 0.523564339f},
-std::array<float,2>{0.247153327f, 0.0530788489f},
-std::array<float,2>{0.698168457f, 0.593555629f},
-std::array<float,2>{0.754160821f, 0.488902956f},
-std::array<float,2>{0.41504693f, 0.931580007f},
-std::array<float,2>{0.325132459f, 0.367348105f},
-std::array<float,2>{0.912200511f, 0.790289223f},
-std::array<float,2>{0.515475333f, 0.2064493f},
-std::array<float,2>{0.080062829f, 0.741424024f},
-std::array<float,2>{0.425925344f, 0.0280182119f},
-std::array<float,2>{0.779090762f, 0.606934845f},
-std::array<float,2>{0.703301787f, 0.464298785f},
-std::array<float,2>{0.219281241f, 0.90205127f},
-std::array<float,2>{0.0680043101f, 0.34273532f},
-std::array<float,2>{0.516595662f, 0.770306408f},
-std::array<float,2>{0.933764517f, 0.227173269f},
-std::array<float,2>{0.338456988f, 0.708706915f},
-std::array<float,2>{0.179368198f, 0.184721768f},
-std::array<float,2>{0.670018852f, 0.658879101f},
-std::array<float,2>{0.852122426f, 0.26569736f},
-std::array<float,2>{0.487685621f, 0.840612888f},
-std::array<float,2>{0.266381145f, 0.379735917f},
-std::array<float,2>{0.984448671f, 0.941806197f},
-std::array<float,2>{0.624524772f, 0.0748064443f},
-std::array<float,2>{0.00988410134f, 0.555303991f},
-std::array<float,2>{0.347815603f, 0.200682253f},
-std::array<float,2>{0.889813542f, 0.728461325f},
-std::array<float,2>{0.53304553f, 0.345156521f},
-std::array<float,2>{0.10305538f, 0.803707778f},
-std::array<float,2>{0.189186633f, 0.471464515f},
-std::array<float,2>{0.732161462f, 0.916045249f},
-std::array<float,2>{0.782269299f, 0.0384294465f},
-std::array<float,2>{0.380604774f, 0.574844956f},
-std::array<float,2>{0.0543594174f, 0.0945089385f},
-std::array<float,2>{0.592132688f, 0.507919788f},
-std::array<float,2>{0.954185843f, 0.41251573f},
-std::array<float,2>{0.285172492f, 0.988633394f},
-std::array<float,2>{0.444318861f, 0.293923259f},
-std::array<float,2>{0.825484753f, 0.865792871f},
-std::array<float,2>{0.654735863f, 0.138493493f},
-std::array<float,2>{0.13629055f, 0.64133203f},
-std::array<float,2>{0.374901563f, 0.107399337f},
-std::array<float,2>{0.90236938f, 0.504585981f},
-std::array<float,2>{0.547940135f, 0.420633167f},
-std::array<float,2>{0.116775259f, 0.99795413f},
-std::array<float,2>{0.218661204f, 0.287174523f},
-std::array<float,2>{0.74075228f, 0.867303193f},
-std::array<float,2>{0.798662543f, 0.129954696f},
-std::array<float,2>{0.394551933f, 0.655662656f},
-std::array<float,2>{0.0464491732f, 0.193741798f},
-std::array<float,2>{0.573990047f, 0.724594295f},
-std::array<float,2>{0.947329283f, 0.355218142f},
-std::array<float,2>{0.303047538f, 0.809081197f},
-std::array<float,2>{0.465825588f, 0.481482387f},
-std::array<float,2>{0.839696169f, 0.911945224f},
-std::array<float,2>{0.625770986f, 0.0435695387f},
-std::array<float,2>{0.153995574f, 0.562852442f},
-std::array<float,2>{0.42125237f, 0.177087784f},
-std::array<float,2>{0.751533866f, 0.670696437f},
-std::array<float,2>{0.699615657f, 0.277248472f},
-std::array<float,2>{0.245888665f, 0.831186771f},
-std::array<float,2>{0.0844642147f, 0.38471806f},
-std::array<float,2>{0.51088959f, 0.949528039f},
-std::array<float,2>{0.909989476f, 0.0682512f},
-std::array<float,2>{0.323857307f, 0.551146448f},
-std::array<float,2>{0.171503857f, 0.0169942733f},
-std::array<float,2>{0.685160697f, 0.5966506f},
-std::array<float,2>{0.874365926f, 0.456482708f},
-std::array<float,2>{0.476463497f, 0.894248247f},
-std::array<float,2>{0.257425904f, 0.330515802f},
-std::array<float,2>{0.983943641f, 0.776073277f},
-std::array<float,2>{0.597047508f, 0.221979067f},
-std::array<float,2>{0.0303502865f, 0.71824038f},
-std::array<float,2>{0.490681261f, 0.0622435585f},
-std::array<float,2>{0.857559144f, 0.582513094f},
-std::array<float,2>{0.664291501f, 0.499583006f},
-std::array<float,2>{0.174047023f, 0.926852286f},
-std::array<float,2>{0.0121636894f, 0.362774521f},
-std::array<float,2>{0.617670536f, 0.788648129f},
-std::array<float,2>{0.988939762f, 0.216392934f},
-std::array<float,2>{0.27138719f, 0.749947965f},
-std::array<float,2>{0.223571122f, 0.153973684f},
-std::array<float,2>{0.707609177f, 0.635207951f},
-std::array<float,2>{0.774822056f, 0.306741595f},
-std::array<float,2>{0.422711372f, 0.843942881f},
-std::array<float,2>{0.342832148f, 0.425232053f},
-std::array<float,2>{0.931500137f, 0.96883595f},
-std::array<float,2>{0.521013975f, 0.11145933f},
-std::array<float,2>{0.0638190955f, 0.517753243f},
-std::array<float,2>{0.282577366f, 0.245821238f},
-std::array<float,2>{0.959825456f, 0.696839809f},
-std::array<float,2>{0.586111605f, 0.317777038f},
-std::array<float,2>{0.0473188423f, 0.762445807f},
-std::array<float,2>{0.139543623f, 0.445462823f},
-std::array<float,2>{0.649765193f, 0.883355319f},
-std::array<float,2>{0.821312487f, 0.0122223953f},
-std::array<float,2>{0.440620631f, 0.624704242f},
-std::array<float,2>{0.108898319f, 0.0851178989f},
-std::array<float,2>{0.536962986f, 0.535584033f},
-std::array<float,2>{0.885037184f, 0.403116852f},
-std::array<float,2>{0.346296281f, 0.96062094f},
-std::array<float,2>{0.37505731f, 0.25986287f},
-std::array<float,2>{0.785586655f, 0.818728626f},
-std::array<float,2>{0.729757726f, 0.157297805f},
-std::array<float,2>{0.19467555f, 0.685607791f},
-std::array<float,2>{0.275857925f, 0.00694542564f},
-std::array<float,2>{0.998607576f, 0.614105701f},
-std::array<float,2>{0.616600513f, 0.437616289f},
-std::array<float,2>{0.00662412215f, 0.877608836f},
-std::array<float,2>{0.184114337f, 0.328051984f},
-std::array<float,2>{0.658332705f, 0.755326807f},
-std::array<float,2>{0.848863304f, 0.239427835f},
-std::array<float,2>{0.494942516f, 0.691056132f},
-std::array<float,2>{0.0756318495f, 0.166067094f},
-std::array<float,2>{0.531144261f, 0.67419368f},
-std::array<float,2>{0.922310472f, 0.255137086f},
-std::array<float,2>{0.331504673f, 0.8279199f},
-std::array<float,2>{0.434816867f, 0.395556986f},
-std::array<float,2>{0.767983139f, 0.963672042f},
-std::array<float,2>{0.712196827f, 0.0908377245f},
-std::array<float,2>{0.233943343f, 0.541718125f},
-std::array<float,2>{0.451315671f, 0.208860531f},
-std::array<float,2>{0.813284159f, 0.734837651f},
-std::array<float,2>{0.646213174f, 0.374741316f},
-std::array<float,2>{0.126599193f, 0.794284463f},
-std::array<float,2>{0.0560566336f, 0.486634612f},
-std::array<float,2>{0.58310169f, 0.935305178f},
-std::array<float,2>{0.963078201f, 0.0495162942f},
-std::array<float,2>{0.295279205f, 0.588780463f},
-std::array<float,2>{0.198730588f, 0.11854928f},
-std::array<float,2>{0.720528483f, 0.527961373f},
-std::array<float,2>{0.795259535f, 0.434542656f},
-std::array<float,2>{0.383585095f, 0.979137123f},
-std::array<float,2>{0.353543997f, 0.297877997f},
-std::array<float,2>{0.879840851f, 0.853906691f},
-std::array<float,2>{0.54378289f, 0.1471048f},
-std::array<float,2>{0.0979897007f, 0.628737628f},
-std::array<float,2>{0.405195653f, 0.0705099106f},
-std::array<float,2>{0.810611844f, 0.560785234f},
-std::array<float,2>{0.743915379f, 0.375469357f},
-std::array<float,2>{0.20662716f, 0.939616203f},
-std::array<float,2>{0.120034881f, 0.270071805f},
-std::array<float,2>{0.557912171f, 0.838319123f},
-std::array<float,2>{0.892144382f, 0.18117176f},
-std::array<float,2>{0.364729345f, 0.660624623f},
-std::array<float,2>{0.144035742f, 0.23079668f},
-std::array<float,2>{0.639678061f, 0.704232216f},
-std::array<float,2>{0.831518412f, 0.338592738f},
-std::array<float,2>{0.459568292f, 0.766407907f},
-std::array<float,2>{0.309180796f, 0.466831774f},
-std::array<float,2>{0.939267397f, 0.903390408f},
-std::array<float,2>{0.56706363f, 0.0255050641f},
-std::array<float,2>{0.0336370245f, 0.604303598f},
-std::array<float,2>{0.31513992f, 0.133942798f},
-std::array<float,2>{0.918854356f, 0.646439612f},
-std::array<float,2>{0.504798353f, 0.292374969f},
-std::array<float,2>{0.0904652476f, 0.860474229f},
-std::array<float,2>{0.241103619f, 0.408120185f},
-std::array<float,2>{0.694226503f, 0.985136628f},
-std::array<float,2>{0.764631569f, 0.0978344679f},
-std::array<float,2>{0.411049962f, 0.51360625f},
-std::array<float,2>{0.019105725f, 0.0313527137f},
-std::array<float,2>{0.606025875f, 0.571280122f},
-std::array<float,2>{0.976181805f, 0.475834876f},
-std::array<float,2>{0.26129669f, 0.919606268f},
-std::array<float,2>{0.476824909f, 0.351481646f},
-std::array<float,2>{0.864747167f, 0.800535083f},
-std::array<float,2>{0.679212153f, 0.198910207f},
-std::array<float,2>{0.16302599f, 0.731791973f},
-std::array<float,2>{0.355892479f, 0.0218812898f},
-std::array<float,2>{0.877940118f, 0.599276006f},
-std::array<float,2>{0.539703369f, 0.459566861f},
-std::array<float,2>{0.0956009328f, 0.897779763f},
-std::array<float,2>{0.202402443f, 0.335104316f},
-std::array<float,2>{0.724343538f, 0.780645072f},
-std::array<float,2>{0.789447486f, 0.225282267f},
-std::array<float,2>{0.388234168f, 0.711981654f},
-std::array<float,2>{0.0611848198f, 0.17573002f},
-std::array<float,2>{0.581531405f, 0.664760649f},
-std::array<float,2>{0.966817439f, 0.279625267f},
-std::array<float,2>{0.2920219f, 0.834411323f},
-std::array<float,2>{0.449068874f, 0.390245676f},
-std::array<float,2>{0.817419708f, 0.946862519f},
-std::array<float,2>{0.644412518f, 0.0653479323f},
-std::array<float,2>{0.13162908f, 0.548262179f},
-std::array<float,2>{0.432118595f, 0.187792391f},
-std::array<float,2>{0.771615207f, 0.72030741f},
-std::array<float,2>{0.71554023f, 0.358338326f},
-std::array<float,2>{0.228501096f, 0.805419564f},
-std::array<float,2>{0.0705711097f, 0.477722049f},
-std::array<float,2>{0.524853826f, 0.907328248f},
-std::array<float,2>{0.926247776f, 0.0428017341f},
-std::array<float,2>{0.33314085f, 0.567766309f},
-std::array<float,2>{0.182004243f, 0.102704138f},
-std::array<float,2>{0.662058055f, 0.500425935f},
-std::array<float,2>{0.844598353f, 0.416944951f},
-std::array<float,2>{0.498985678f, 0.992370844f},
-std::array<float,2>{0.279018223f, 0.284880102f},
-std::array<float,2>{0.993365824f, 0.873032868f},
-std::array<float,2>{0.61144352f, 0.126945451f},
-std::array<float,2>{0.00160832063f, 0.649726272f},
-std::array<float,2>{0.481266916f, 0.081692636f},
-std::array<float,2>{0.861993194f, 0.532320797f},
-std::array<float,2>{0.672274947f, 0.400811195f},
-std::array<float,2>{0.159092322f, 0.953741252f},
-std::array<float,2>{0.0206811428f, 0.265423477f},
-std::array<float,2>{0.604196787f, 0.812899888f},
-std::array<float,2>{0.970198929f, 0.161996141f},
-std::array<float,2>{0.265395939f, 0.680813372f},
-std::array<float,2>{0.235181019f, 0.24989973f},
-std::array<float,2>{0.689498186f, 0.70286566f},
-std::array<float,2>{0.758872986f, 0.314826697f},
-std::array<float,2>{0.409550816f, 0.759847701f},
-std::array<float,2>{0.317317128f, 0.45158565f},
-std::array<float,2>{0.917953193f, 0.890412688f},
-std::array<float,2>{0.503373742f, 0.00912116189f},
-std::array<float,2>{0.085966669f, 0.618487716f},
-std::array<float,2>{0.306552052f, 0.152147979f},
-std::array<float,2>{0.942127585f, 0.639210641f},
-std::array<float,2>{0.563387811f, 0.310335129f},
-std::array<float,2>{0.0367807522f, 0.849853098f},
-std::array<float,2>{0.147569373f, 0.428344637f},
-std::array<float,2>{0.634953439f, 0.972876132f},
-std::array<float,2>{0.835787296f, 0.113788053f},
-std::array<float,2>{0.45449996f, 0.520599842f},
-std::array<float,2>{0.124752946f, 0.0553542376f},
-std::array<float,2>{0.561625779f, 0.581856966f},
-std::array<float,2>{0.896171153f, 0.495634437f},
-std::array<float,2>{0.360305309f, 0.923060179f},
-std::array<float,2>{0.398716152f, 0.366872787f},
-std::array<float,2>{0.806862235f, 0.78492564f},
-std::array<float,2>{0.747561812f, 0.213559002f},
-std::array<float,2>{0.209021911f, 0.744993329f},
-std::array<float,2>{0.250411689f, 0.122047707f},
-std::array<float,2>{0.979208648f, 0.525479496f},
-std::array<float,2>{0.598832309f, 0.432797849f},
-std::array<float,2>{0.0255592596f, 0.982184291f},
-std::array<float,2>{0.167683199f, 0.302738786f},
-std::array<float,2>{0.679974496f, 0.858853638f},
-std::array<float,2>{0.870485008f, 0.141226828f},
-std::array<float,2>{0.470359862f, 0.631243527f},
-std::array<float,2>{0.0802890733f, 0.203430772f},
-std::array<float,2>{0.512004673f, 0.738349378f},
-std::array<float,2>{0.912066281f, 0.370544344f},
-std::array<float,2>{0.327095538f, 0.791536212f},
-std::array<float,2>{0.417324662f, 0.491558075f},
-std::array<float,2>{0.756085336f, 0.933577299f},
-std::array<float,2>{0.696891844f, 0.0515063442f},
-std::array<float,2>{0.249784559f, 0.590463161f},
-std::array<float,2>{0.463140607f, 0.169856712f},
-std::array<float,2>{0.840471804f, 0.676312804f},
-std::array<float,2>{0.630694926f, 0.250789791f},
-std::array<float,2>{0.149111822f, 0.822578192f},
-std::array<float,2>{0.0427515246f, 0.391702145f},
-std::array<float,2>{0.576058805f, 0.968722403f},
-std::array<float,2>{0.952787101f, 0.0879248828f},
-std::array<float,2>{0.300750673f, 0.546100318f},
-std::array<float,2>{0.212940544f, 0.000985298655f},
-std::array<float,2>{0.735753715f, 0.611547112f},
-std::array<float,2>{0.802083135f, 0.444645524f},
-std::array<float,2>{0.393555492f, 0.880676746f},
-std::array<float,2>{0.370410055f, 0.323860168f},
-std::array<float,2>{0.900232613f, 0.753811836f},
-std::array<float,2>{0.551281035f, 0.237463772f},
-std::array<float,2>{0.110540964f, 0.693012118f},
-std::array<float,2>{0.382419497f, 0.0356749743f},
-std::array<float,2>{0.783994138f, 0.577438533f},
-std::array<float,2>{0.732894421f, 0.468958408f},
-std::array<float,2>{0.189773425f, 0.915164411f},
-std::array<float,2>{0.104324497f, 0.345891476f},
-std::array<float,2>{0.535096347f, 0.802378535f},
-std::array<float,2>{0.888223767f, 0.201664746f},
-std::array<float,2>{0.350012094f, 0.729159534f},
-std::array<float,2>{0.13283278f, 0.139744505f},
-std::array<float,2>{0.6542238f, 0.643791676f},
-std::array<float,2>{0.826832891f, 0.295403868f},
-std::array<float,2>{0.442383826f, 0.863384187f},
-std::array<float,2>{0.288019061f, 0.410801291f},
-std::array<float,2>{0.955666661f, 0.990766168f},
-std::array<float,2>{0.589882851f, 0.0965134799f},
-std::array<float,2>{0.0518251844f, 0.510952294f},
-std::array<float,2>{0.336386889f, 0.230073899f},
-std::array<float,2>{0.936716676f, 0.709541261f},
-std::array<float,2>{0.518513918f, 0.341604739f},
-std::array<float,2>{0.068756789f, 0.772215188f},
-std::array<float,2>{0.221318126f, 0.460953981f},
-std::array<float,2>{0.705553472f, 0.900381327f},
-std::array<float,2>{0.780108869f, 0.0312314164f},
-std::array<float,2>{0.428496301f, 0.60768944f},
-std::array<float,2>{0.00934878364f, 0.0776707605f},
-std::array<float,2>{0.62280798f, 0.557309568f},
-std::array<float,2>{0.988102496f, 0.381295383f},
-std::array<float,2>{0.267619103f, 0.943518579f},
-std::array<float,2>{0.485765338f, 0.269489318f},
-std::array<float,2>{0.855287969f, 0.842195213f},
-std::array<float,2>{0.669526279f, 0.187145725f},
-std::array<float,2>{0.177694336f, 0.657333374f},
-std::array<float,2>{0.321139693f, 0.0693453103f},
-std::array<float,2>{0.90759021f, 0.554225445f},
-std::array<float,2>{0.508285224f, 0.386438519f},
-std::array<float,2>{0.083749935f, 0.951443255f},
-std::array<float,2>{0.243806109f, 0.274676591f},
-std::array<float,2>{0.701311052f, 0.829428792f},
-std::array<float,2>{0.753347754f, 0.17776604f},
-std::array<float,2>{0.418617517f, 0.6681844f},
-std::array<float,2>{0.0290287416f, 0.219973475f},
-std::array<float,2>{0.594800234f, 0.71668309f},
-std::array<float,2>{0.980704248f, 0.329102933f},
-std::array<float,2>{0.255324543f, 0.77515763f},
-std::array<float,2>{0.473942548f, 0.453735203f},
-std::array<float,2>{0.873022437f, 0.892517924f},
-std::array<float,2>{0.68569839f, 0.0178076923f},
-std::array<float,2>{0.168181881f, 0.594790459f},
-std::array<float,2>{0.397865534f, 0.132480264f},
-std::array<float,2>{0.798879087f, 0.653589725f},
-std::array<float,2>{0.738318205f, 0.285917968f},
-std::array<float,2>{0.21490185f, 0.869159877f},
-std::array<float,2>{0.113506295f, 0.418316633f},
-std::array<float,2>{0.549894631f, 0.999737918f},
-std::array<float,2>{0.904949665f, 0.109067768f},
-std::array<float,2>{0.371943623f, 0.507424057f},
-std::array<float,2>{0.154899895f, 0.0462158732f},
-std::array<float,2>{0.628498375f, 0.564520597f},
-std::array<float,2>{0.837085485f, 0.482789278f},
-std::array<float,2>{0.46706751f, 0.912197471f},
-std::array<float,2>{0.30220893f, 0.353459537f},
-std::array<float,2>{0.947081089f, 0.811257899f},
-std::array<float,2>{0.570443869f, 0.192745492f},
-std::array<float,2>{0.0446296409f, 0.724650443f},
-std::array<float,2>{0.437725633f, 0.0141568072f},
-std::array<float,2>{0.823839664f, 0.622766197f},
-std::array<float,2>{0.651658893f, 0.448682696f},
-std::array<float,2>{0.137499034f, 0.885725975f},
-std::array<float,2>{0.0497374609f, 0.318587631f},
-std::array<float,2>{0.588044167f, 0.763890743f},
-std::array<float,2>{0.957999647f, 0.242643565f},
-std::array<float,2>{0.283523709f, 0.698738694f},
-std::array<float,2>{0.192831933f, 0.15928331f},
-std::array<float,2>{0.727647603f, 0.684578061f},
-std::array<float,2>{0.787517726f, 0.259195805f},
-std::array<float,2>{0.378054529f, 0.816761434f},
-std::array<float,2>{0.34537372f, 0.406091958f},
-std::array<float,2>{0.883317471f, 0.957719922f},
-std::array<float,2>{0.537178874f, 0.0835671499f},
-std::array<float,2>{0.106595397f, 0.53780514f},
-std::array<float,2>{0.273032069f, 0.21776624f},
-std::array<float,2>{0.991214573f, 0.746876955f},
-std::array<float,2>{0.620955467f, 0.35986203f},
-std::array<float,2>{0.0141586373f, 0.786175072f},
-std::array<float,2>{0.17236346f, 0.497091651f},
-std::array<float,2>{0.667285621f, 0.929169536f},
-std::array<float,2>{0.855602741f, 0.0595274679f},
-std::array<float,2>{0.490231216f, 0.584158778f},
-std::array<float,2>{0.0644959658f, 0.109654456f},
-std::array<float,2>{0.52206099f, 0.51609987f},
-std::array<float,2>{0.932339132f, 0.422956914f},
-std::array<float,2>{0.341335177f, 0.972327411f},
-std::array<float,2>{0.424122721f, 0.306177676f},
-std::array<float,2>{0.776183665f, 0.84616667f},
-std::array<float,2>{0.709779263f, 0.155906156f},
-std::array<float,2>{0.226461947f, 0.633311152f},
-std::array<float,2>{0.293043345f, 0.0473577902f},
-std::array<float,2>{0.96281451f, 0.586787403f},
-std::array<float,2>{0.584509313f, 0.485856771f},
-std::array<float,2>{0.0576903298f, 0.937076628f},
-std::array<float,2>{0.128093764f, 0.372748733f},
-std::array<float,2>{0.646666586f, 0.796324968f},
-std::array<float,2>{0.815745413f, 0.210578069f},
-std::array<float,2>{0.449312598f, 0.737924874f},
-std::array<float,2>{0.0997060165f, 0.145287201f},
-std::array<float,2>{0.545254052f, 0.626664877f},
-std::array<float,2>{0.881279886f, 0.299114227f},
-std::array<float,2>{0.352946311f, 0.853007913f},
-std::array<float,2>{0.385213733f, 0.435892671f},
-std::array<float,2>{0.794920027f, 0.978140354f},
-std::array<float,2>{0.722422183f, 0.119432516f},
-std::array<float,2>{0.197108209f, 0.530767083f},
-std::array<float,2>{0.493969113f, 0.240904868f},
-std::array<float,2>{0.851016879f, 0.688459575f},
-std::array<float,2>{0.656485498f, 0.325263768f},
-std::array<float,2>{0.186298743f, 0.756186903f},
-std::array<float,2>{0.00475012045f, 0.440870911f},
-std::array<float,2>{0.61449343f, 0.875173926f},
-std::array<float,2>{0.996819258f, 0.00421188446f},
-std::array<float,2>{0.275220901f, 0.615655065f},
-std::array<float,2>{0.231982917f, 0.091859974f},
-std::array<float,2>{0.714224637f, 0.539812028f},
-std::array<float,2>{0.766689241f, 0.397816867f},
-std::array<float,2>{0.437373668f, 0.962612748f},
-std::array<float,2>{0.32881999f, 0.257639229f},
-std::array<float,2>{0.924107373f, 0.82536006f},
-std::array<float,2>{0.528337955f, 0.164891437f},
-std::array<float,2>{0.0768564492f, 0.673014879f},
-std::array<float,2>{0.413013846f, 0.0997462124f},
-std::array<float,2>{0.763337493f, 0.514885485f},
-std::array<float,2>{0.691978991f, 0.408442616f},
-std::array<float,2>{0.239653274f, 0.987903297f},
-std::array<float,2>{0.0931360126f, 0.290747851f},
-std::array<float,2>{0.507222533f, 0.863173187f},
-std::array<float,2>{0.920580864f, 0.136147499f},
-std::array<float,2>{0.312806129f, 0.648308992f},
-std::array<float,2>{0.160333738f, 0.197039276f},
-std::array<float,2>{0.676764011f, 0.733932018f},
-std::array<float,2>{0.867062151f, 0.349015653f},
-std::array<float,2>{0.479996592f, 0.797671974f},
-std::array<float,2>{0.257968962f, 0.472901523f},
-std::array<float,2>{0.973241031f, 0.920597494f},
-std::array<float,2>{0.607719004f, 0.0334250294f},
-std::array<float,2>{0.016806772f, 0.573309183f},
-std::array<float,2>{0.365305007f, 0.18270196f},
-std::array<float,2>{0.893433571f, 0.664012432f},
-std::array<float,2>{0.555226147f, 0.272415608f},
-std::array<float,2>{0.118541904f, 0.836232185f},
-std::array<float,2>{0.204858214f, 0.377327085f},
-std::array<float,2>{0.746074021f, 0.938438714f},
-std::array<float,2>{0.809109449f, 0.0733685568f},
-std::array<float,2>{0.404233813f, 0.55966413f},
-std::array<float,2>{0.0317405686f, 0.0240675453f},
-std::array<float,2>{0.569354117f, 0.602137029f},
-std::array<float,2>{0.9408198f, 0.46641311f},
-std::array<float,2>{0.311631292f, 0.905317962f},
-std::array<float,2>{0.458319694f, 0.337584853f},
-std::array<float,2>{0.82988888f, 0.769118249f},
-std::array<float,2>{0.636736929f, 0.233580828f},
-std::array<float,2>{0.140780687f, 0.706261337f},
-std::array<float,2>{0.361028016f, 0.0573372357f},
-std::array<float,2>{0.894698262f, 0.578989804f},
-std::array<float,2>{0.561435163f, 0.492432773f},
-std::array<float,2>{0.123885155f, 0.924722195f},
-std::array<float,2>{0.210252061f, 0.365120798f},
-std::array<float,2>{0.74644196f, 0.782667041f},
-std::array<float,2>{0.808291614f, 0.211358115f},
-std::array<float,2>{0.399971485f, 0.743732393f},
-std::array<float,2>{0.0354421996f, 0.148924023f},
-std::array<float,2>{0.563487113f, 0.638071656f},
-std::array<float,2>{0.943349481f, 0.310998291f},
-std::array<float,2>{0.305652261f, 0.847906709f},
-std::array<float,2>{0.453489602f, 0.426252604f},
-std::array<float,2>{0.83460325f, 0.975587785f},
-std::array<float,2>{0.636602342f, 0.115529187f},
-std::array<float,2>{0.146831036f, 0.521633327f},
-std::array<float,2>{0.408960998f, 0.247564167f},
-std::array<float,2>{0.75829041f, 0.699389398f},
-std::array<float,2>{0.690433264f, 0.314300537f},
-std::array<float,2>{0.235618055f, 0.758901894f},
-std::array<float,2>{0.086950615f, 0.451079905f},
-std::array<float,2>{0.502348006f, 0.888308525f},
-std::array<float,2>{0.916514277f, 0.0106608067f},
-std::array<float,2>{0.317395806f, 0.620312452f},
-std::array<float,2>{0.159799024f, 0.0789523274f},
-std::array<float,2>{0.673196375f, 0.534801543f},
-std::array<float,2>{0.86291045f, 0.398655087f},
-std::array<float,2>{0.481718838f, 0.956727684f},
-std::array<float,2>{0.264442146f, 0.262028933f},
-std::array<float,2>{0.968828321f, 0.815350235f},
-std::array<float,2>{0.605256319f, 0.162453815f},
-std::array<float,2>{0.0199005418f, 0.682977021f},
-std::array<float,2>{0.499910235f, 0.105115436f},
-std::array<float,2>{0.845524073f, 0.503195882f},
-std::array<float,2>{0.660473228f, 0.41591382f},
-std::array<float,2>{0.183075577f, 0.995940328f},
-std::array<float,2>{0.000708586536f, 0.282851428f},
-std::array<float,2>{0.612893283f, 0.87477088f},
-std::array<float,2>{0.992406189f, 0.127801985f},
-std::array<float,2>{0.278297812f, 0.650525033f},
-std::array<float,2>{0.226614982f, 0.190712452f},
-std::array<float,2>{0.716234207f, 0.722029567f},
-std::array<float,2>{0.773145974f, 0.356615096f},
-std::array<float,2>{0.433113396f, 0.808306158f},
-std::array<float,2>{0.33261773f, 0.479265958f},
-std::array<float,2>{0.926855147f, 0.908364832f},
-std::array<float,2>{0.52411586f, 0.0391224101f},
-std::array<float,2>{0.072127223f, 0.569101036f},
-std::array<float,2>{0.291731268f, 0.172059566f},
-std::array<float,2>{0.968668699f, 0.666136682f},
-std::array<float,2>{0.580106139f, 0.278237104f},
-std::array<float,2>{0.0621376298f, 0.833097935f},
-std::array<float,2>{0.132423118f, 0.386814415f},
-std::array<float,2>{0.642834783f, 0.948965847f},
-std::array<float,2>{0.817028821f, 0.0634181798f},
-std::array<float,2>{0.447374493f, 0.550320089f},
-std::array<float,2>{0.0942269713f, 0.0199572798f},
-std::array<float,2>{0.540685177f, 0.60011375f},
-std::array<float,2>{0.87722522f, 0.458277702f},
-std::array<float,2>{0.357269704f, 0.89467895f},
-std::array<float,2>{0.386900932f, 0.333029807f},
-std::array<float,2>{0.790109038f, 0.777513564f},
-std::array<float,2>{0.723312676f, 0.223369196f},
-std::array<float,2>{0.201464236f, 0.713201046f},
-std::array<float,2>{0.26870963f, 0.0758259073f},
-std::array<float,2>{0.986577392f, 0.556114316f},
-std::array<float,2>{0.621207476f, 0.380195886f},
-std::array<float,2>{0.00798301492f, 0.942618906f},
-std::array<float,2>{0.176722139f, 0.267506242f},
-std::array<float,2>{0.668002188f, 0.840924919f},
-std::array<float,2>{0.854274929f, 0.1839329f},
-std::array<float,2>{0.484947205f, 0.659349859f},
-std::array<float,2>{0.0698034614f, 0.228132993f},
-std::array<float,2>{0.519483089f, 0.707249939f},
-std::array<float,2>{0.935902536f, 0.34315151f},
-std::array<float,2>{0.337469637f, 0.771474361f},
-std::array<float,2>{0.429122746f, 0.463745683f},
-std::array<float,2>{0.780706644f, 0.900528789f},
-std::array<float,2>{0.706759095f, 0.0291956831f},
-std::array<float,2>{0.222646862f, 0.606297016f},
-std::array<float,2>{0.442125618f, 0.137579903f},
-std::array<float,2>{0.827964723f, 0.641655803f},
-std::array<float,2>{0.652733326f, 0.294354916f},
-std::array<float,2>{0.134229288f, 0.866512537f},
-std::array<float,2>{0.0509156473f, 0.413569242f},
-std::array<float,2>{0.591681302f, 0.990013599f},
-std::array<float,2>{0.956319034f, 0.0955205262f},
-std::array<float,2>{0.28880167f, 0.509183288f},
-std::array<float,2>{0.191316232f, 0.0380676761f},
-std::array<float,2>{0.734178662f, 0.576069415f},
-std::array<float,2>{0.784946561f, 0.47254011f},
-std::array<float,2>{0.381234884f, 0.917683363f},
-std::array<float,2>{0.351273537f, 0.344719052f},
-std::array<float,2>{0.88761276f, 0.803952873f},
-std::array<float,2>{0.533253491f, 0.200118825f},
-std::array<float,2>{0.104884014f, 0.726699173f},
-std::array<float,2>{0.393321127f, 0.00292561087f},
-std::array<float,2>{0.801050961f, 0.611178577f},
-std::array<float,2>{0.734793067f, 0.441648453f},
-std::array<float,2>{0.214251772f, 0.881425261f},
-std::array<float,2>{0.109602824f, 0.320350409f},
-std::array<float,2>{0.552591681f, 0.750466228f},
-std::array<float,2>{0.898491025f, 0.234833747f},
-std::array<float,2>{0.370015085f, 0.694900095f},
-std::array<float,2>{0.150340274f, 0.170572266f},
-std::array<float,2>{0.629648983f, 0.678060412f},
-std::array<float,2>{0.841455162f, 0.252928197f},
-std::array<float,2>{0.464383334f, 0.821967065f},
-std::array<float,2>{0.298887491f, 0.394415379f},
-std::array<float,2>{0.951247931f, 0.965635598f},
-std::array<float,2>{0.574767649f, 0.0869853869f},
-std::array<float,2>{0.0419589393f, 0.543429911f},
-std::array<float,2>{0.327770829f, 0.205472335f},
-std::array<float,2>{0.910945356f, 0.740967155f},
-std::array<float,2>{0.512839854f, 0.369100988f},
-std::array<float,2>{0.0817834735f, 0.789191663f},
-std::array<float,2>{0.248962358f, 0.489995956f},
-std::array<float,2>{0.696071863f, 0.930056512f},
-std::array<float,2>{0.756850183f, 0.0545675084f},
-std::array<float,2>{0.416472346f, 0.591978669f},
-std::array<float,2>{0.0267636888f, 0.124680914f},
-std::array<float,2>{0.598481417f, 0.525389314f},
-std::array<float,2>{0.97974962f, 0.430892408f},
-std::array<float,2>{0.251431406f, 0.982566178f},
-std::array<float,2>{0.469213694f, 0.302721262f},
-std::array<float,2>{0.869370222f, 0.856685638f},
-std::array<float,2>{0.681348145f, 0.144455835f},
-std::array<float,2>{0.16645503f, 0.629869163f},
-std::array<float,2>{0.340567648f, 0.11290434f},
-std::array<float,2>{0.932717562f, 0.519370317f},
-std::array<float,2>{0.522855103f, 0.424406797f},
-std::array<float,2>{0.0657079741f, 0.969847918f},
-std::array<float,2>{0.224756703f, 0.308547467f},
-std::array<float,2>{0.710626006f, 0.845693886f},
-std::array<float,2>{0.776869416f, 0.152771547f},
-std::array<float,2>{0.425305992f, 0.635934174f},
-std::array<float,2>{0.0153267672f, 0.215246946f},
-std::array<float,2>{0.620106637f, 0.748616815f},
-std::array<float,2>{0.990748167f, 0.361852735f},
-std::array<float,2>{0.272026747f, 0.787332714f},
-std::array<float,2>{0.488817126f, 0.498379916f},
-std::array<float,2>{0.856622696f, 0.926453769f},
-std::array<float,2>{0.666373849f, 0.061248675f},
-std::array<float,2>{0.173287183f, 0.583977461f},
-std::array<float,2>{0.377762139f, 0.156602427f},
-std::array<float,2>{0.788903892f, 0.686894238f},
-std::array<float,2>{0.726912916f, 0.261547476f},
-std::array<float,2>{0.191482171f, 0.819967151f},
-std::array<float,2>{0.105541326f, 0.404129535f},
-std::array<float,2>{0.538961768f, 0.959375441f},
-std::array<float,2>{0.884220541f, 0.0839979276f},
-std::array<float,2>{0.343867093f, 0.536866665f},
-std::array<float,2>{0.138222739f, 0.0134785082f},
-std::array<float,2>{0.651318133f, 0.623874128f},
-std::array<float,2>{0.822414041f, 0.446401179f},
-std::array<float,2>{0.439195931f, 0.88427943f},
-std::array<float,2>{0.284561902f, 0.317027301f},
-std::array<float,2>{0.958882034f, 0.763370812f},
-std::array<float,2>{0.589324176f, 0.245034993f},
-std::array<float,2>{0.0503068008f, 0.695991158f},
-std::array<float,2>{0.468296617f, 0.0443319976f},
-std::array<float,2>{0.835995495f, 0.563719392f},
-std::array<float,2>{0.626964033f, 0.481111079f},
-std::array<float,2>{0.155487806f, 0.910992205f},
-std::array<float,2>{0.0436084159f, 0.353650957f},
-std::array<float,2>{0.571726978f, 0.810388505f},
-std::array<float,2>{0.946225524f, 0.194889218f},
-std::array<float,2>{0.30086261f, 0.723449886f},
-std::array<float,2>{0.216656327f, 0.129225835f},
-std::array<float,2>{0.740232646f, 0.655073583f},
-std::array<float,2>{0.799883246f, 0.28875941f},
-std::array<float,2>{0.396945655f, 0.868357778f},
-std::array<float,2>{0.372805834f, 0.421110034f},
-std::array<float,2>{0.906226218f, 0.996850312f},
-std::array<float,2>{0.548972666f, 0.105957717f},
-std::array<float,2>{0.114960067f, 0.5050928f},
-std::array<float,2>{0.253994256f, 0.221178725f},
-std::array<float,2>{0.981749833f, 0.717097163f},
-std::array<float,2>{0.594676316f, 0.331979424f},
-std::array<float,2>{0.0277150311f, 0.7766698f},
-std::array<float,2>{0.169480145f, 0.455726385f},
-std::array<float,2>{0.686815619f, 0.89264071f},
-std::array<float,2>{0.871535897f, 0.0163860638f},
-std::array<float,2>{0.473047525f, 0.597628832f},
-std::array<float,2>{0.0829096362f, 0.066482231f},
-std::array<float,2>{0.509234309f, 0.551989734f},
-std::array<float,2>{0.906737268f, 0.383261889f},
-std::array<float,2>{0.321440101f, 0.950354636f},
-std::array<float,2>{0.419650435f, 0.2754803f},
-std::array<float,2>{0.752136946f, 0.830167234f},
-std::array<float,2>{0.702250659f, 0.176632807f},
-std::array<float,2>{0.242504627f, 0.670938432f},
-std::array<float,2>{0.311452836f, 0.0265045296f},
-std::array<float,2>{0.939840138f, 0.605096102f},
-std::array<float,2>{0.569234669f, 0.468136281f},
-std::array<float,2>{0.0324029215f, 0.903289974f},
-std::array<float,2>{0.142211094f, 0.339553684f},
-std::array<float,2>{0.638555348f, 0.767212749f},
-std::array<float,2>{0.82845825f, 0.232386723f},
-std::array<float,2>{0.457147866f, 0.703204751f},
-std::array<float,2>{0.117345862f, 0.180602625f},
-std::array<float,2>{0.556286454f, 0.661650538f},
-std::array<float,2>{0.893635571f, 0.270825863f},
-std::array<float,2>{0.366265565f, 0.839782894f},
-std::array<float,2>{0.402369976f, 0.376699686f},
-std::array<float,2>{0.809626341f, 0.940931559f},
-std::array<float,2>{0.744996428f, 0.0721795931f},
-std::array<float,2>{0.203525424f, 0.562322021f},
-std::array<float,2>{0.478775114f, 0.19789435f},
-std::array<float,2>{0.865805566f, 0.730968118f},
-std::array<float,2>{0.676246822f, 0.350150704f},
-std::array<float,2>{0.161492333f, 0.799362779f},
-std::array<float,2>{0.0160734486f, 0.475045413f},
-std::array<float,2>{0.609260023f, 0.918731511f},
-std::array<float,2>{0.9740628f, 0.0331133083f},
-std::array<float,2>{0.258924216f, 0.57184881f},
-std::array<float,2>{0.238480091f, 0.0993521512f},
-std::array<float,2>{0.692689776f, 0.5117535f},
-std::array<float,2>{0.76205349f, 0.406396598f},
-std::array<float,2>{0.413401663f, 0.985681474f},
-std::array<float,2>{0.313937038f, 0.291104019f},
-std::array<float,2>{0.921188712f, 0.860208809f},
-std::array<float,2>{0.506733894f, 0.133676365f},
-std::array<float,2>{0.0920322612f, 0.645033121f},
-std::array<float,2>{0.435815454f, 0.0906962082f},
-std::array<float,2>{0.765950322f, 0.542782664f},
-std::array<float,2>{0.713751912f, 0.395085722f},
-std::array<float,2>{0.231323093f, 0.96408987f},
-std::array<float,2>{0.0775997937f, 0.254142553f},
-std::array<float,2>{0.527560532f, 0.826227188f},
-std::array<float,2>{0.925388217f, 0.167238861f},
-std::array<float,2>{0.329851836f, 0.675006092f},
-std::array<float,2>{0.187197596f, 0.238429368f},
-std::array<float,2>{0.65768528f, 0.690342307f},
-std::array<float,2>{0.85058403f, 0.326751053f},
-std::array<float,2>{0.492984593f, 0.754316092f},
-std::array<float,2>{0.274081588f, 0.438689172f},
-std::array<float,2>{0.9974491f, 0.878588319f},
-std::array<float,2>{0.613822937f, 0.00614973251f},
-std::array<float,2>{0.00528506655f, 0.615199566f},
-std::array<float,2>{0.352271438f, 0.147860795f},
-std::array<float,2>{0.881991863f, 0.627389193f},
-std::array<float,2>{0.54596889f, 0.2975218f},
-std::array<float,2>{0.101141818f, 0.855184138f},
-std::array<float,2>{0.196087942f, 0.43524465f},
-std::array<float,2>{0.721461833f, 0.980255365f},
-std::array<float,2>{0.793478787f, 0.117262729f},
-std::array<float,2>{0.386291981f, 0.528336406f},
-std::array<float,2>{0.0569877066f, 0.0505393445f},
-std::array<float,2>{0.585280836f, 0.589492977f},
-std::array<float,2>{0.96112299f, 0.487986863f},
-std::array<float,2>{0.294441819f, 0.934380174f},
-std::array<float,2>{0.450324148f, 0.373673856f},
-std::array<float,2>{0.815084755f, 0.793914676f},
-std::array<float,2>{0.647879422f, 0.207487181f},
-std::array<float,2>{0.127628386f, 0.735651374f},
-std::array<float,2>{0.319491327f, 0.0083556911f},
-std::array<float,2>{0.914367616f, 0.61774689f},
-std::array<float,2>{0.500484705f, 0.452744782f},
-std::array<float,2>{0.0891135484f, 0.889449835f},
-std::array<float,2>{0.236468703f, 0.315961778f},
-std::array<float,2>{0.68895334f, 0.761027455f},
-std::array<float,2>{0.759769082f, 0.248588696f},
-std::array<float,2>{0.407800674f, 0.701257765f},
-std::array<float,2>{0.0224888436f, 0.161004469f},
-std::array<float,2>{0.602414668f, 0.68023622f},
-std::array<float,2>{0.972633839f, 0.264026195f},
-std::array<float,2>{0.262230277f, 0.813952923f},
-std::array<float,2>{0.483761549f, 0.402046978f},
-std::array<float,2>{0.860120416f, 0.954711795f},
-std::array<float,2>{0.67383492f, 0.0808819607f},
-std::array<float,2>{0.158013135f, 0.531642556f},
-std::array<float,2>{0.400546283f, 0.214327246f},
-std::array<float,2>{0.805230737f, 0.745522439f},
-std::array<float,2>{0.749904454f, 0.365643382f},
-std::array<float,2>{0.207081646f, 0.783869803f},
-std::array<float,2>{0.122807711f, 0.495107263f},
-std::array<float,2>{0.560245037f, 0.922813952f},
-std::array<float,2>{0.89779681f, 0.0559305064f},
-std::array<float,2>{0.36294359f, 0.58025831f},
-std::array<float,2>{0.145372063f, 0.114859618f},
-std::array<float,2>{0.634677231f, 0.519686401f},
-std::array<float,2>{0.832945704f, 0.429446012f},
-std::array<float,2>{0.457016885f, 0.974020541f},
-std::array<float,2>{0.307072014f, 0.308866113f},
-std::array<float,2>{0.945256114f, 0.850836337f},
-std::array<float,2>{0.56449914f, 0.150639996f},
-std::array<float,2>{0.038375102f, 0.639892697f},
-std::array<float,2>{0.446354926f, 0.0656601489f},
-std::array<float,2>{0.819330812f, 0.547270656f},
-std::array<float,2>{0.640905738f, 0.388770819f},
-std::array<float,2>{0.130666077f, 0.945392609f},
-std::array<float,2>{0.0593737215f, 0.280789196f},
-std::array<float,2>{0.578724384f, 0.835395098f},
-std::array<float,2>{0.966323197f, 0.174734369f},
-std::array<float,2>{0.290575713f, 0.665696383f},
-std::array<float,2>{0.199909002f, 0.225909695f},
-std::array<float,2>{0.724721253f, 0.711457431f},
-std::array<float,2>{0.792422652f, 0.334334135f},
-std::array<float,2>{0.389571786f, 0.779970169f},
-std::array<float,2>{0.358485073f, 0.460779428f},
-std::array<float,2>{0.875353694f, 0.897224247f},
-std::array<float,2>{0.541544557f, 0.0227256492f},
-std::array<float,2>{0.0968359113f, 0.597682536f},
-std::array<float,2>{0.279330462f, 0.12539278f},
-std::array<float,2>{0.995426059f, 0.649112761f},
-std::array<float,2>{0.610753059f, 0.284024596f},
-std::array<float,2>{0.00240925397f, 0.871138453f},
-std::array<float,2>{0.180976734f, 0.417417288f},
-std::array<float,2>{0.662767291f, 0.994016588f},
-std::array<float,2>{0.847034037f, 0.101919554f},
-std::array<float,2>{0.497774094f, 0.501638949f},
-std::array<float,2>{0.0724193752f, 0.0412309468f},
-std::array<float,2>{0.525556803f, 0.56735909f},
-std::array<float,2>{0.92940414f, 0.477300376f},
-std::array<float,2>{0.335122675f, 0.906845212f},
-std::array<float,2>{0.430519968f, 0.359077513f},
-std::array<float,2>{0.769917846f, 0.806033671f},
-std::array<float,2>{0.717248201f, 0.18851392f},
-std::array<float,2>{0.229648188f, 0.719560087f},
-std::array<float,2>{0.286632329f, 0.0970628113f},
-std::array<float,2>{0.954007924f, 0.51001215f},
-std::array<float,2>{0.593656838f, 0.411798239f},
-std::array<float,2>{0.0535609126f, 0.99189949f},
-std::array<float,2>{0.13561815f, 0.296156228f},
-std::array<float,2>{0.655368507f, 0.864535093f},
-std::array<float,2>{0.824811161f, 0.139234081f},
-std::array<float,2>{0.44474411f, 0.642685235f},
-std::array<float,2>{0.102154285f, 0.202945992f},
-std::array<float,2>{0.532085896f, 0.730027378f},
-std::array<float,2>{0.888763189f, 0.34672305f},
-std::array<float,2>{0.349524796f, 0.801690578f},
-std::array<float,2>{0.379334778f, 0.470664769f},
-std::array<float,2>{0.781803012f, 0.91425401f},
-std::array<float,2>{0.731118739f, 0.0366668366f},
-std::array<float,2>{0.187626451f, 0.576179087f},
-std::array<float,2>{0.487106949f, 0.186238736f},
-std::array<float,2>{0.852668941f, 0.657160401f},
-std::array<float,2>{0.671827853f, 0.26835984f},
-std::array<float,2>{0.178016603f, 0.843645334f},
-std::array<float,2>{0.0113046318f, 0.382784784f},
-std::array<float,2>{0.623628974f, 0.94468689f},
-std::array<float,2>{0.986011744f, 0.0767669752f},
-std::array<float,2>{0.267007649f, 0.558211386f},
-std::array<float,2>{0.220431849f, 0.0301994998f},
-std::array<float,2>{0.704797089f, 0.608641148f},
-std::array<float,2>{0.777610362f, 0.462079257f},
-std::array<float,2>{0.427115619f, 0.898953676f},
-std::array<float,2>{0.339269072f, 0.340283424f},
-std::array<float,2>{0.935212374f, 0.772787452f},
-std::array<float,2>{0.517135739f, 0.229249969f},
-std::array<float,2>{0.0670830905f, 0.710904896f},
-std::array<float,2>{0.414353251f, 0.0521126464f},
-std::array<float,2>{0.755727589f, 0.590860248f},
-std::array<float,2>{0.698558271f, 0.490446359f},
-std::array<float,2>{0.246657655f, 0.932179272f},
-std::array<float,2>{0.0783877f, 0.369814754f},
-std::array<float,2>{0.513871789f, 0.792627573f},
-std::array<float,2>{0.913277447f, 0.20486851f},
-std::array<float,2>{0.325305283f, 0.739575148f},
-std::array<float,2>{0.165589735f, 0.141890243f},
-std::array<float,2>{0.682868719f, 0.632214904f},
-std::array<float,2>{0.867626905f, 0.304215163f},
-std::array<float,2>{0.471948653f, 0.857809126f},
-std::array<float,2>{0.253600746f, 0.431928188f},
-std::array<float,2>{0.977856219f, 0.980577886f},
-std::array<float,2>{0.600083828f, 0.123017848f},
-std::array<float,2>{0.0252675805f, 0.526576281f},
-std::array<float,2>{0.367312938f, 0.236889213f},
-std::array<float,2>{0.901368499f, 0.691476941f},
-std::array<float,2>{0.553717077f, 0.322642833f},
-std::array<float,2>{0.112760268f, 0.752596855f},
-std::array<float,2>{0.211417556f, 0.443728864f},
-std::array<float,2>{0.73726964f, 0.879500866f},
-std::array<float,2>{0.803286016f, 4.24510836e-05f},
-std::array<float,2>{0.391664565f, 0.613053918f},
-std::array<float,2>{0.0398621559f, 0.0892833918f},
-std::array<float,2>{0.576994419f, 0.544929147f},
-std::array<float,2>{0.951018512f, 0.391214818f},
-std::array<float,2>{0.298664182f, 0.966929257f},
-std::array<float,2>{0.461645007f, 0.25161767f},
-std::array<float,2>{0.841951609f, 0.82366389f},
-std::array<float,2>{0.63107574f, 0.168943718f},
-std::array<float,2>{0.151414722f, 0.677179396f},
-std::array<float,2>{0.346968621f, 0.0826515481f},
-std::array<float,2>{0.886229277f, 0.538093507f},
-std::array<float,2>{0.535592258f, 0.405072719f},
-std::array<float,2>{0.108237207f, 0.958893359f},
-std::array<float,2>{0.194114253f, 0.257867843f},
-std::array<float,2>{0.729207575f, 0.818107843f},
-std::array<float,2>{0.786916852f, 0.158538416f},
-std::array<float,2>{0.37632969f, 0.684438944f},
-std::array<float,2>{0.0480394028f, 0.243747696f},
-std::array<float,2>{0.587542415f, 0.69748348f},
-std::array<float,2>{0.960380137f, 0.319344431f},
-std::array<float,2>{0.281361908f, 0.764959216f},
-std::array<float,2>{0.439750999f, 0.447340846f},
-std::array<float,2>{0.820595741f, 0.886173606f},
-std::array<float,2>{0.649140418f, 0.0148713104f},
-std::array<float,2>{0.140365794f, 0.621703625f},
-std::array<float,2>{0.422985643f, 0.155079409f},
-std::array<float,2>{0.773866713f, 0.634430945f},
-std::array<float,2>{0.708513737f, 0.305044323f},
-std::array<float,2>{0.224468857f, 0.847549081f},
-std::array<float,2>{0.0631808117f, 0.422265291f},
-std::array<float,2>{0.520486295f, 0.971653759f},
-std::array<float,2>{0.930481851f, 0.11076095f},
-std::array<float,2>{0.34191677f, 0.517459631f},
-std::array<float,2>{0.175037593f, 0.0598381646f},
-std::array<float,2>{0.665869415f, 0.585347772f},
-std::array<float,2>{0.858739555f, 0.496216059f},
-std::array<float,2>{0.491643697f, 0.92774266f},
-std::array<float,2>{0.270032585f, 0.360475451f},
-std::array<float,2>{0.989911437f, 0.78522718f},
-std::array<float,2>{0.618678927f, 0.218105778f},
-std::array<float,2>{0.012773551f, 0.747126162f},
-std::array<float,2>{0.475153297f, 0.0192405619f},
-std::array<float,2>{0.873069823f, 0.594604552f},
-std::array<float,2>{0.684471905f, 0.455053449f},
-std::array<float,2>{0.17064622f, 0.891199291f},
-std::array<float,2>{0.0301026143f, 0.329078496f},
-std::array<float,2>{0.595910132f, 0.77384907f},
-std::array<float,2>{0.982826889f, 0.219652101f},
-std::array<float,2>{0.255936265f, 0.715198636f},
-std::array<float,2>{0.24418135f, 0.179114491f},
-std::array<float,2>{0.701079726f, 0.668962538f},
-std::array<float,2>{0.750810564f, 0.273814827f},
-std::array<float,2>{0.420551866f, 0.828345895f},
-std::array<float,2>{0.323026538f, 0.385670543f},
-std::array<float,2>{0.908711851f, 0.95224303f},
-std::array<float,2>{0.509917617f, 0.0687837079f},
-std::array<float,2>{0.0857684985f, 0.553286672f},
-std::array<float,2>{0.303966254f, 0.191430077f},
-std::array<float,2>{0.948634684f, 0.725769162f},
-std::array<float,2>{0.572587013f, 0.352054596f},
-std::array<float,2>{0.0455600284f, 0.811837077f},
-std::array<float,2>{0.152384967f, 0.484349877f},
-std::array<float,2>{0.626574218f, 0.913607061f},
-std::array<float,2>{0.838565409f, 0.045827467f},
-std::array<float,2>{0.464970529f, 0.5657897f},
-std::array<float,2>{0.116072491f, 0.107898094f},
-std::array<float,2>{0.54699862f, 0.506121159f},
-std::array<float,2>{0.904117107f, 0.419456333f},
-std::array<float,2>{0.373676628f, 0.998751938f},
-std::array<float,2>{0.396406054f, 0.286309421f},
-std::array<float,2>{0.796940804f, 0.87063688f},
-std::array<float,2>{0.741651416f, 0.131284773f},
-std::array<float,2>{0.217595086f, 0.65285629f},
-std::array<float,2>{0.260068595f, 0.0346401632f},
-std::array<float,2>{0.974772871f, 0.572906017f},
-std::array<float,2>{0.606751263f, 0.473874509f},
-std::array<float,2>{0.0181920119f, 0.921127617f},
-std::array<float,2>{0.163387358f, 0.348034978f},
-std::array<float,2>{0.678144515f, 0.798811495f},
-std::array<float,2>{0.86400938f, 0.19580853f},
-std::array<float,2>{0.478050709f, 0.733351171f},
-std::array<float,2>{0.0910967365f, 0.134891555f},
-std::array<float,2>{0.50551945f, 0.64651686f},
-std::array<float,2>{0.919737816f, 0.289674759f},
-std::array<float,2>{0.315890461f, 0.861479163f},
-std::array<float,2>{0.412086636f, 0.409347653f},
-std::array<float,2>{0.765148461f, 0.986526668f},
-std::array<float,2>{0.694936454f, 0.100981519f},
-std::array<float,2>{0.241818517f, 0.514154792f},
-std::array<float,2>{0.460041285f, 0.232967257f},
-std::array<float,2>{0.830807626f, 0.70595324f},
-std::array<float,2>{0.638800919f, 0.336210191f},
-std::array<float,2>{0.143072069f, 0.768070102f},
-std::array<float,2>{0.0343852267f, 0.465339929f},
-std::array<float,2>{0.568321168f, 0.904720545f},
-std::array<float,2>{0.937884331f, 0.0249558408f},
-std::array<float,2>{0.310211271f, 0.603291035f},
-std::array<float,2>{0.205630675f, 0.0728983879f},
-std::array<float,2>{0.742260158f, 0.559034646f},
-std::array<float,2>{0.811589718f, 0.378357768f},
-std::array<float,2>{0.405486166f, 0.939155102f},
-std::array<float,2>{0.363425046f, 0.273104608f},
-std::array<float,2>{0.891406715f, 0.83777535f},
-std::array<float,2>{0.556807041f, 0.181932703f},
-std::array<float,2>{0.121059835f, 0.66230768f},
-std::array<float,2>{0.384607077f, 0.120514147f},
-std::array<float,2>{0.795918524f, 0.529901683f},
-std::array<float,2>{0.719548404f, 0.437004566f},
-std::array<float,2>{0.197497904f, 0.977031529f},
-std::array<float,2>{0.0995540693f, 0.299848527f},
-std::array<float,2>{0.544799924f, 0.852370501f},
-std::array<float,2>{0.880435526f, 0.146431044f},
-std::array<float,2>{0.355006605f, 0.625850201f},
-std::array<float,2>{0.125392258f, 0.209174141f},
-std::array<float,2>{0.644741714f, 0.737164378f},
-std::array<float,2>{0.814321101f, 0.371271074f},
-std::array<float,2>{0.452362657f, 0.794967592f},
-std::array<float,2>{0.296392471f, 0.484625578f},
-std::array<float,2>{0.964508355f, 0.936517179f},
-std::array<float,2>{0.582841933f, 0.0478741154f},
-std::array<float,2>{0.0547685064f, 0.58776468f},
-std::array<float,2>{0.330300808f, 0.165680647f},
-std::array<float,2>{0.923743069f, 0.67273581f},
-std::array<float,2>{0.529485703f, 0.256417245f},
-std::array<float,2>{0.075175941f, 0.824929476f},
-std::array<float,2>{0.232622176f, 0.396822453f},
-std::array<float,2>{0.711607516f, 0.961326599f},
-std::array<float,2>{0.7695207f, 0.0929943621f},
-std::array<float,2>{0.43389371f, 0.540778399f},
-std::array<float,2>{0.00709173037f, 0.00508866413f},
-std::array<float,2>{0.615831316f, 0.617060959f},
-std::array<float,2>{0.999138713f, 0.439862072f},
-std::array<float,2>{0.27698642f, 0.876383841f},
-std::array<float,2>{0.496082485f, 0.324547231f},
-std::array<float,2>{0.847859502f, 0.756893873f},
-std::array<float,2>{0.659763813f, 0.241383404f},
-std::array<float,2>{0.185038999f, 0.688498199f}}
\ No newline at end of file
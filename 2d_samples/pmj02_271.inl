@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.424955785f, 0.0268595479f},
-std::array<float,2>{0.97837621f, 0.995243549f},
-std::array<float,2>{0.0911667421f, 0.62809515f},
-std::array<float,2>{0.690040708f, 0.400953233f},
-std::array<float,2>{0.184690252f, 0.276612967f},
-std::array<float,2>{0.538779497f, 0.566749632f},
-std::array<float,2>{0.282250881f, 0.861735165f},
-std::array<float,2>{0.856050789f, 0.160635516f},
-std::array<float,2>{0.34141013f, 0.495607167f},
-std::array<float,2>{0.776039124f, 0.729969084f},
-std::array<float,2>{0.190899312f, 0.881355822f},
-std::array<float,2>{0.575526595f, 0.064630948f},
-std::array<float,2>{0.0137116509f, 0.192181185f},
-std::array<float,2>{0.648536682f, 0.806248784f},
-std::array<float,2>{0.482098937f, 0.532888889f},
-std::array<float,2>{0.918310106f, 0.34202987f},
-std::array<float,2>{0.253336579f, 0.149519518f},
-std::array<float,2>{0.820269763f, 0.826422036f},
-std::array<float,2>{0.128099591f, 0.61265552f},
-std::array<float,2>{0.515787363f, 0.305439502f},
-std::array<float,2>{0.122114852f, 0.415684789f},
-std::array<float,2>{0.735639215f, 0.683362544f},
-std::array<float,2>{0.397524983f, 0.95802182f},
-std::array<float,2>{0.945174813f, 0.0479402617f},
-std::array<float,2>{0.448028862f, 0.371652842f},
-std::array<float,2>{0.894999504f, 0.529768765f},
-std::array<float,2>{0.0535091609f, 0.779731691f},
-std::array<float,2>{0.672874272f, 0.226750791f},
-std::array<float,2>{0.219315395f, 0.120205566f},
-std::array<float,2>{0.611441314f, 0.927408576f},
-std::array<float,2>{0.35381633f, 0.700471759f},
-std::array<float,2>{0.792456388f, 0.445418924f},
-std::array<float,2>{0.48957482f, 0.249785945f},
-std::array<float,2>{0.933882475f, 0.75899756f},
-std::array<float,2>{0.0215650257f, 0.510433674f},
-std::array<float,2>{0.633783519f, 0.344312429f},
-std::array<float,2>{0.206785873f, 0.453336686f},
-std::array<float,2>{0.579326689f, 0.713182569f},
-std::array<float,2>{0.314975858f, 0.916348875f},
-std::array<float,2>{0.750873148f, 0.100791857f},
-std::array<float,2>{0.302223623f, 0.286224872f},
-std::array<float,2>{0.869796932f, 0.595351636f},
-std::array<float,2>{0.161212534f, 0.843637824f},
-std::array<float,2>{0.554258883f, 0.128212333f},
-std::array<float,2>{0.0648078024f, 0.0321319476f},
-std::array<float,2>{0.711007297f, 0.947218478f},
-std::array<float,2>{0.411588162f, 0.670776248f},
-std::array<float,2>{0.999030113f, 0.435412765f},
-std::array<float,2>{0.370130271f, 0.0932433307f},
-std::array<float,2>{0.805576622f, 0.90161097f},
-std::array<float,2>{0.235779911f, 0.73755914f},
-std::array<float,2>{0.609061718f, 0.477619618f},
-std::array<float,2>{0.0451387465f, 0.313063562f},
-std::array<float,2>{0.662280619f, 0.562366664f},
-std::array<float,2>{0.455339223f, 0.7936517f},
-std::array<float,2>{0.886557758f, 0.218027309f},
-std::array<float,2>{0.385395378f, 0.382638723f},
-std::array<float,2>{0.962205768f, 0.648452044f},
-std::array<float,2>{0.099754177f, 0.98428309f},
-std::array<float,2>{0.73008579f, 0.0065641012f},
-std::array<float,2>{0.147044271f, 0.177615166f},
-std::array<float,2>{0.512162626f, 0.847283244f},
-std::array<float,2>{0.273815185f, 0.585198581f},
-std::array<float,2>{0.842257917f, 0.252480149f},
-std::array<float,2>{0.46869278f, 0.10794273f},
-std::array<float,2>{0.878709137f, 0.90649581f},
-std::array<float,2>{0.0328672826f, 0.703439891f},
-std::array<float,2>{0.66513139f, 0.468654931f},
-std::array<float,2>{0.249493554f, 0.359165907f},
-std::array<float,2>{0.594004154f, 0.505444586f},
-std::array<float,2>{0.360670865f, 0.751836717f},
-std::array<float,2>{0.797592878f, 0.24072507f},
-std::array<float,2>{0.269445568f, 0.429427683f},
-std::array<float,2>{0.834390759f, 0.661413074f},
-std::array<float,2>{0.153274283f, 0.942061067f},
-std::array<float,2>{0.503459036f, 0.0428404324f},
-std::array<float,2>{0.105802819f, 0.135871395f},
-std::array<float,2>{0.721101403f, 0.831642449f},
-std::array<float,2>{0.380462646f, 0.605247259f},
-std::array<float,2>{0.956859112f, 0.292333543f},
-std::array<float,2>{0.320540279f, 0.209447563f},
-std::array<float,2>{0.7613011f, 0.782105863f},
-std::array<float,2>{0.212711558f, 0.548237979f},
-std::array<float,2>{0.588521838f, 0.321963906f},
-std::array<float,2>{0.024865713f, 0.471473694f},
-std::array<float,2>{0.632770896f, 0.74831593f},
-std::array<float,2>{0.492619097f, 0.89132899f},
-std::array<float,2>{0.92445159f, 0.0820298493f},
-std::array<float,2>{0.4172135f, 0.264022559f},
-std::array<float,2>{0.989302099f, 0.586504817f},
-std::array<float,2>{0.0706716925f, 0.852555335f},
-std::array<float,2>{0.708457291f, 0.179705024f},
-std::array<float,2>{0.168054283f, 0.0105216512f},
-std::array<float,2>{0.559666216f, 0.975631535f},
-std::array<float,2>{0.307625949f, 0.641675174f},
-std::array<float,2>{0.862245798f, 0.385785908f},
-std::array<float,2>{0.402303487f, 0.168746814f},
-std::array<float,2>{0.949533105f, 0.869858921f},
-std::array<float,2>{0.116973013f, 0.57285881f},
-std::array<float,2>{0.745108426f, 0.273202032f},
-std::array<float,2>{0.139766023f, 0.39427942f},
-std::array<float,2>{0.530337274f, 0.636067867f},
-std::array<float,2>{0.259750664f, 0.984705269f},
-std::array<float,2>{0.824706972f, 0.0156760924f},
-std::array<float,2>{0.344765663f, 0.335477024f},
-std::array<float,2>{0.78324157f, 0.540883005f},
-std::array<float,2>{0.233716652f, 0.801541805f},
-std::array<float,2>{0.619452238f, 0.200421706f},
-std::array<float,2>{0.0609621406f, 0.0734752193f},
-std::array<float,2>{0.683298111f, 0.887737632f},
-std::array<float,2>{0.44197306f, 0.721409261f},
-std::array<float,2>{0.902603924f, 0.49133116f},
-std::array<float,2>{0.294792712f, 0.0548816361f},
-std::array<float,2>{0.843762815f, 0.964134336f},
-std::array<float,2>{0.17395404f, 0.67242229f},
-std::array<float,2>{0.540475607f, 0.411798984f},
-std::array<float,2>{0.0843685567f, 0.302586883f},
-std::array<float,2>{0.695470393f, 0.623789549f},
-std::array<float,2>{0.435930878f, 0.818616927f},
-std::array<float,2>{0.97315973f, 0.145446435f},
-std::array<float,2>{0.472822279f, 0.443199784f},
-std::array<float,2>{0.910050213f, 0.69047159f},
-std::array<float,2>{0.00357555225f, 0.930937231f},
-std::array<float,2>{0.643581688f, 0.117080264f},
-std::array<float,2>{0.20272015f, 0.222519085f},
-std::array<float,2>{0.567540765f, 0.771682918f},
-std::array<float,2>{0.332884699f, 0.522198617f},
-std::array<float,2>{0.767196238f, 0.367061555f},
-std::array<float,2>{0.378654838f, 0.0692874044f},
-std::array<float,2>{0.960399806f, 0.875011802f},
-std::array<float,2>{0.104896635f, 0.731393456f},
-std::array<float,2>{0.725814521f, 0.499894351f},
-std::array<float,2>{0.149324745f, 0.338287801f},
-std::array<float,2>{0.506343126f, 0.53596282f},
-std::array<float,2>{0.272745907f, 0.812221587f},
-std::array<float,2>{0.831224203f, 0.188921303f},
-std::array<float,2>{0.366032034f, 0.403031617f},
-std::array<float,2>{0.802234232f, 0.630834818f},
-std::array<float,2>{0.243485704f, 0.99840039f},
-std::array<float,2>{0.597774863f, 0.0303862076f},
-std::array<float,2>{0.0380644798f, 0.158235967f},
-std::array<float,2>{0.669434071f, 0.865913391f},
-std::array<float,2>{0.463017583f, 0.563242972f},
-std::array<float,2>{0.880240381f, 0.278737664f},
-std::array<float,2>{0.309132993f, 0.23303099f},
-std::array<float,2>{0.866485178f, 0.775821805f},
-std::array<float,2>{0.167161494f, 0.526569784f},
-std::array<float,2>{0.556547582f, 0.370109051f},
-std::array<float,2>{0.0769888237f, 0.449971795f},
-std::array<float,2>{0.706736505f, 0.696261108f},
-std::array<float,2>{0.421704561f, 0.924916923f},
-std::array<float,2>{0.987055957f, 0.121412471f},
-std::array<float,2>{0.496233821f, 0.309006363f},
-std::array<float,2>{0.927293837f, 0.614823401f},
-std::array<float,2>{0.0279184971f, 0.820896387f},
-std::array<float,2>{0.625422597f, 0.153582111f},
-std::array<float,2>{0.218217492f, 0.0531486273f},
-std::array<float,2>{0.590617716f, 0.953457355f},
-std::array<float,2>{0.326105148f, 0.687128365f},
-std::array<float,2>{0.764171362f, 0.419573784f},
-std::array<float,2>{0.441023052f, 0.129216567f},
-std::array<float,2>{0.902289331f, 0.837878942f},
-std::array<float,2>{0.0583260693f, 0.599988699f},
-std::array<float,2>{0.686679363f, 0.282246083f},
-std::array<float,2>{0.229728848f, 0.430924416f},
-std::array<float,2>{0.623578489f, 0.664566875f},
-std::array<float,2>{0.349337637f, 0.951477528f},
-std::array<float,2>{0.788273215f, 0.0382911637f},
-std::array<float,2>{0.265103668f, 0.348219693f},
-std::array<float,2>{0.822331548f, 0.514609873f},
-std::array<float,2>{0.134839356f, 0.765480459f},
-std::array<float,2>{0.523448527f, 0.245111823f},
-std::array<float,2>{0.11076989f, 0.095536083f},
-std::array<float,2>{0.748130262f, 0.920588851f},
-std::array<float,2>{0.406159848f, 0.716628373f},
-std::array<float,2>{0.948114812f, 0.459104389f},
-std::array<float,2>{0.328918517f, 0.00121092948f},
-std::array<float,2>{0.773393691f, 0.976652741f},
-std::array<float,2>{0.195823982f, 0.653385043f},
-std::array<float,2>{0.565271974f, 0.375203162f},
-std::array<float,2>{0.00665790401f, 0.256935865f},
-std::array<float,2>{0.645829976f, 0.580477297f},
-std::array<float,2>{0.470778793f, 0.8483845f},
-std::array<float,2>{0.913628519f, 0.174524546f},
-std::array<float,2>{0.431676537f, 0.484049588f},
-std::array<float,2>{0.969984651f, 0.74099201f},
-std::array<float,2>{0.0796071291f, 0.905968428f},
-std::array<float,2>{0.702972472f, 0.0886687711f},
-std::array<float,2>{0.176179841f, 0.213251755f},
-std::array<float,2>{0.546086192f, 0.79047364f},
-std::array<float,2>{0.290851444f, 0.555494606f},
-std::array<float,2>{0.848478198f, 0.316590607f},
-std::array<float,2>{0.478972465f, 0.0464495048f},
-std::array<float,2>{0.915405333f, 0.938373148f},
-std::array<float,2>{0.0109365257f, 0.657617986f},
-std::array<float,2>{0.655115128f, 0.423326015f},
-std::array<float,2>{0.194375217f, 0.295790166f},
-std::array<float,2>{0.570465446f, 0.608557165f},
-std::array<float,2>{0.337205946f, 0.833998561f},
-std::array<float,2>{0.778108239f, 0.137931362f},
-std::array<float,2>{0.28759104f, 0.463021368f},
-std::array<float,2>{0.851932108f, 0.707849264f},
-std::array<float,2>{0.180650011f, 0.913878441f},
-std::array<float,2>{0.533814371f, 0.103425957f},
-std::array<float,2>{0.0861299336f, 0.236446634f},
-std::array<float,2>{0.694129527f, 0.75670439f},
-std::array<float,2>{0.428323805f, 0.501234233f},
-std::array<float,2>{0.983352304f, 0.353173554f},
-std::array<float,2>{0.355621696f, 0.185695738f},
-std::array<float,2>{0.795705676f, 0.859129488f},
-std::array<float,2>{0.225479826f, 0.590449572f},
-std::array<float,2>{0.61448735f, 0.260923624f},
-std::array<float,2>{0.0506104268f, 0.388479203f},
-std::array<float,2>{0.678046107f, 0.647016704f},
-std::array<float,2>{0.451366633f, 0.971674681f},
-std::array<float,2>{0.894102931f, 0.0132386852f},
-std::array<float,2>{0.391892582f, 0.326084971f},
-std::array<float,2>{0.94018507f, 0.551265121f},
-std::array<float,2>{0.118696362f, 0.788690865f},
-std::array<float,2>{0.740725636f, 0.204315841f},
-std::array<float,2>{0.132160097f, 0.0838047937f},
-std::array<float,2>{0.520171821f, 0.897638798f},
-std::array<float,2>{0.255890489f, 0.745631456f},
-std::array<float,2>{0.814828217f, 0.475904763f},
-std::array<float,2>{0.407383353f, 0.198850274f},
-std::array<float,2>{0.994613469f, 0.800718665f},
-std::array<float,2>{0.068842724f, 0.545943916f},
-std::array<float,2>{0.718515277f, 0.32953158f},
-std::array<float,2>{0.158793166f, 0.487416834f},
-std::array<float,2>{0.547976434f, 0.724993825f},
-std::array<float,2>{0.299298733f, 0.883084118f},
-std::array<float,2>{0.87228781f, 0.0775677711f},
-std::array<float,2>{0.317188323f, 0.266480178f},
-std::array<float,2>{0.75443691f, 0.574461699f},
-std::array<float,2>{0.210043147f, 0.872207344f},
-std::array<float,2>{0.584796846f, 0.166386604f},
-std::array<float,2>{0.0179930665f, 0.0227171835f},
-std::array<float,2>{0.639502227f, 0.989742517f},
-std::array<float,2>{0.485177755f, 0.639520228f},
-std::array<float,2>{0.932233036f, 0.395893872f},
-std::array<float,2>{0.281170934f, 0.112278566f},
-std::array<float,2>{0.838323534f, 0.937240243f},
-std::array<float,2>{0.142977402f, 0.69449836f},
-std::array<float,2>{0.509595513f, 0.439288169f},
-std::array<float,2>{0.0969400853f, 0.359805137f},
-std::array<float,2>{0.732079685f, 0.515848696f},
-std::array<float,2>{0.390356272f, 0.769520462f},
-std::array<float,2>{0.967204511f, 0.226332352f},
-std::array<float,2>{0.460015923f, 0.407429785f},
-std::array<float,2>{0.889192045f, 0.678180933f},
-std::array<float,2>{0.042885635f, 0.965235949f},
-std::array<float,2>{0.657902241f, 0.0624791309f},
-std::array<float,2>{0.24190858f, 0.141875997f},
-std::array<float,2>{0.603146851f, 0.813250899f},
-std::array<float,2>{0.372469634f, 0.617388427f},
-std::array<float,2>{0.812082589f, 0.297754556f},
-std::array<float,2>{0.394756079f, 0.0506540053f},
-std::array<float,2>{0.942866802f, 0.959905207f},
-std::array<float,2>{0.124818049f, 0.680452764f},
-std::array<float,2>{0.737189054f, 0.41768381f},
-std::array<float,2>{0.12563917f, 0.308134139f},
-std::array<float,2>{0.518841803f, 0.611240745f},
-std::array<float,2>{0.251126617f, 0.825039685f},
-std::array<float,2>{0.817684591f, 0.151936069f},
-std::array<float,2>{0.352895796f, 0.448521733f},
-std::array<float,2>{0.790824592f, 0.701786697f},
-std::array<float,2>{0.222585961f, 0.929476917f},
-std::array<float,2>{0.610464871f, 0.118680492f},
-std::array<float,2>{0.0512899645f, 0.228734255f},
-std::array<float,2>{0.674197257f, 0.779260755f},
-std::array<float,2>{0.446134776f, 0.527703643f},
-std::array<float,2>{0.897456706f, 0.373360276f},
-std::array<float,2>{0.284930855f, 0.162292287f},
-std::array<float,2>{0.858409584f, 0.860220253f},
-std::array<float,2>{0.185994253f, 0.569172382f},
-std::array<float,2>{0.535759091f, 0.273898482f},
-std::array<float,2>{0.0922575742f, 0.399448007f},
-std::array<float,2>{0.689121425f, 0.62588948f},
-std::array<float,2>{0.422382057f, 0.993644595f},
-std::array<float,2>{0.978937805f, 0.0240489654f},
-std::array<float,2>{0.482981324f, 0.341400206f},
-std::array<float,2>{0.92170316f, 0.534918904f},
-std::array<float,2>{0.0133291576f, 0.806799054f},
-std::array<float,2>{0.651114225f, 0.194075733f},
-std::array<float,2>{0.188676149f, 0.0641256869f},
-std::array<float,2>{0.578119218f, 0.879543722f},
-std::array<float,2>{0.343683243f, 0.728323519f},
-std::array<float,2>{0.774411619f, 0.493156582f},
-std::array<float,2>{0.454722613f, 0.216078088f},
-std::array<float,2>{0.884296179f, 0.795202374f},
-std::array<float,2>{0.0439942107f, 0.559509099f},
-std::array<float,2>{0.660934269f, 0.315953314f},
-std::array<float,2>{0.237524405f, 0.479561657f},
-std::array<float,2>{0.605932951f, 0.735522687f},
-std::array<float,2>{0.368710548f, 0.89872402f},
-std::array<float,2>{0.807747424f, 0.0904837996f},
-std::array<float,2>{0.276584655f, 0.250402927f},
-std::array<float,2>{0.840609491f, 0.5825302f},
-std::array<float,2>{0.144806966f, 0.844946265f},
-std::array<float,2>{0.513729632f, 0.179298118f},
-std::array<float,2>{0.0981309265f, 0.00584424008f},
-std::array<float,2>{0.727144897f, 0.981997192f},
-std::array<float,2>{0.383027941f, 0.652034223f},
-std::array<float,2>{0.964308083f, 0.380753756f},
-std::array<float,2>{0.31402427f, 0.0978011116f},
-std::array<float,2>{0.753501952f, 0.915125132f},
-std::array<float,2>{0.203214154f, 0.71212399f},
-std::array<float,2>{0.58123982f, 0.45580402f},
-std::array<float,2>{0.0195940807f, 0.347202599f},
-std::array<float,2>{0.635678887f, 0.508794546f},
-std::array<float,2>{0.490801096f, 0.760805666f},
-std::array<float,2>{0.936410904f, 0.247735873f},
-std::array<float,2>{0.413382262f, 0.436526924f},
-std::array<float,2>{0.99662441f, 0.669810534f},
-std::array<float,2>{0.0636798218f, 0.947537839f},
-std::array<float,2>{0.714379191f, 0.0344166197f},
-std::array<float,2>{0.163755849f, 0.126161531f},
-std::array<float,2>{0.551029682f, 0.841748238f},
-std::array<float,2>{0.304506421f, 0.597175002f},
-std::array<float,2>{0.867523074f, 0.288696766f},
-std::array<float,2>{0.49504742f, 0.0795240551f},
-std::array<float,2>{0.922892869f, 0.892618835f},
-std::array<float,2>{0.0271580387f, 0.74667573f},
-std::array<float,2>{0.629556119f, 0.469381243f},
-std::array<float,2>{0.213372514f, 0.322271526f},
-std::array<float,2>{0.586690128f, 0.549223483f},
-std::array<float,2>{0.323045492f, 0.784236252f},
-std::array<float,2>{0.759491086f, 0.208764032f},
-std::array<float,2>{0.30590114f, 0.384743243f},
-std::array<float,2>{0.860799134f, 0.643972278f},
-std::array<float,2>{0.171235844f, 0.9745965f},
-std::array<float,2>{0.561176836f, 0.00886053499f},
-std::array<float,2>{0.0723316446f, 0.182447568f},
-std::array<float,2>{0.709229827f, 0.854519963f},
-std::array<float,2>{0.415190339f, 0.589732468f},
-std::array<float,2>{0.991139114f, 0.26304096f},
-std::array<float,2>{0.362311065f, 0.239998609f},
-std::array<float,2>{0.800655246f, 0.752605796f},
-std::array<float,2>{0.247626141f, 0.506227434f},
-std::array<float,2>{0.596203268f, 0.356385618f},
-std::array<float,2>{0.0349626355f, 0.466310829f},
-std::array<float,2>{0.667952478f, 0.70550561f},
-std::array<float,2>{0.466156691f, 0.909626901f},
-std::array<float,2>{0.875019789f, 0.106121503f},
-std::array<float,2>{0.38169089f, 0.290954083f},
-std::array<float,2>{0.953675449f, 0.602293432f},
-std::array<float,2>{0.108650379f, 0.829915941f},
-std::array<float,2>{0.719763935f, 0.134413853f},
-std::array<float,2>{0.155907333f, 0.0400192477f},
-std::array<float,2>{0.500796378f, 0.94386667f},
-std::array<float,2>{0.266960889f, 0.663188219f},
-std::array<float,2>{0.832569361f, 0.426982582f},
-std::array<float,2>{0.434128016f, 0.1474922f},
-std::array<float,2>{0.976103723f, 0.817490578f},
-std::array<float,2>{0.0830900148f, 0.622904897f},
-std::array<float,2>{0.698111892f, 0.304202765f},
-std::array<float,2>{0.173349157f, 0.412846088f},
-std::array<float,2>{0.542109013f, 0.675542176f},
-std::array<float,2>{0.296434224f, 0.961228192f},
-std::array<float,2>{0.84733808f, 0.0581244379f},
-std::array<float,2>{0.334628761f, 0.36362341f},
-std::array<float,2>{0.768602431f, 0.520506084f},
-std::array<float,2>{0.199693114f, 0.770032585f},
-std::array<float,2>{0.568722785f, 0.219771117f},
-std::array<float,2>{0.000794078747f, 0.113810346f},
-std::array<float,2>{0.641222656f, 0.932874382f},
-std::array<float,2>{0.474879473f, 0.687654853f},
-std::array<float,2>{0.906905413f, 0.443433255f},
-std::array<float,2>{0.260320276f, 0.018689787f},
-std::array<float,2>{0.826387942f, 0.988020897f},
-std::array<float,2>{0.137029171f, 0.633792698f},
-std::array<float,2>{0.528119087f, 0.391272187f},
-std::array<float,2>{0.114117786f, 0.270489395f},
-std::array<float,2>{0.742682338f, 0.570384383f},
-std::array<float,2>{0.398864686f, 0.86833328f},
-std::array<float,2>{0.951632679f, 0.171696618f},
-std::array<float,2>{0.443497449f, 0.48995918f},
-std::array<float,2>{0.904943407f, 0.720275164f},
-std::array<float,2>{0.059639927f, 0.889547229f},
-std::array<float,2>{0.680993617f, 0.0718802288f},
-std::array<float,2>{0.23067148f, 0.20220834f},
-std::array<float,2>{0.618425846f, 0.804233491f},
-std::array<float,2>{0.345917583f, 0.541450262f},
-std::array<float,2>{0.781958401f, 0.332596511f},
-std::array<float,2>{0.418146908f, 0.12339551f},
-std::array<float,2>{0.985338509f, 0.923353016f},
-std::array<float,2>{0.0752919242f, 0.698543191f},
-std::array<float,2>{0.70476222f, 0.452590913f},
-std::array<float,2>{0.165697783f, 0.368953049f},
-std::array<float,2>{0.556664586f, 0.52365917f},
-std::array<float,2>{0.310722351f, 0.774440467f},
-std::array<float,2>{0.86416328f, 0.231252179f},
-std::array<float,2>{0.326691598f, 0.420357615f},
-std::array<float,2>{0.762056947f, 0.685134053f},
-std::array<float,2>{0.216359362f, 0.955702305f},
-std::array<float,2>{0.592348337f, 0.0508570522f},
-std::array<float,2>{0.0294924024f, 0.15450719f},
-std::array<float,2>{0.627874851f, 0.82313633f},
-std::array<float,2>{0.498260379f, 0.617172897f},
-std::array<float,2>{0.928070962f, 0.31106323f},
-std::array<float,2>{0.270703167f, 0.190229952f},
-std::array<float,2>{0.829694748f, 0.810257137f},
-std::array<float,2>{0.152343184f, 0.537437916f},
-std::array<float,2>{0.503971636f, 0.337817222f},
-std::array<float,2>{0.102964722f, 0.496267468f},
-std::array<float,2>{0.72295326f, 0.733660936f},
-std::array<float,2>{0.376593888f, 0.877313614f},
-std::array<float,2>{0.957819164f, 0.0669965222f},
-std::array<float,2>{0.462726533f, 0.28027302f},
-std::array<float,2>{0.881167769f, 0.56462425f},
-std::array<float,2>{0.0351750888f, 0.863933325f},
-std::array<float,2>{0.67055279f, 0.157791883f},
-std::array<float,2>{0.245230421f, 0.0292429812f},
-std::array<float,2>{0.600129306f, 0.996552944f},
-std::array<float,2>{0.364557564f, 0.632522643f},
-std::array<float,2>{0.803365529f, 0.40573886f},
-std::array<float,2>{0.470086068f, 0.172547072f},
-std::array<float,2>{0.911612272f, 0.849708796f},
-std::array<float,2>{0.00512975221f, 0.579440117f},
-std::array<float,2>{0.646650016f, 0.254682064f},
-std::array<float,2>{0.197976276f, 0.377369434f},
-std::array<float,2>{0.56330657f, 0.65465945f},
-std::array<float,2>{0.331049263f, 0.979337692f},
-std::array<float,2>{0.771109581f, 0.00211641379f},
-std::array<float,2>{0.291502625f, 0.318452626f},
-std::array<float,2>{0.851547658f, 0.557393014f},
-std::array<float,2>{0.178478077f, 0.792339981f},
-std::array<float,2>{0.543413103f, 0.212769508f},
-std::array<float,2>{0.0802786425f, 0.0870073363f},
-std::array<float,2>{0.701138556f, 0.902351677f},
-std::array<float,2>{0.430895537f, 0.73863858f},
-std::array<float,2>{0.972630799f, 0.481618732f},
-std::array<float,2>{0.350238144f, 0.0364450328f},
-std::array<float,2>{0.785867691f, 0.949581146f},
-std::array<float,2>{0.227013469f, 0.66614908f},
-std::array<float,2>{0.621529579f, 0.432038903f},
-std::array<float,2>{0.0555118583f, 0.285066217f},
-std::array<float,2>{0.685534656f, 0.598792613f},
-std::array<float,2>{0.439372212f, 0.839046836f},
-std::array<float,2>{0.899901748f, 0.132629126f},
-std::array<float,2>{0.40338999f, 0.458655059f},
-std::array<float,2>{0.946353972f, 0.717708409f},
-std::array<float,2>{0.112778403f, 0.918099165f},
-std::array<float,2>{0.74639678f, 0.0958820805f},
-std::array<float,2>{0.133073747f, 0.242644399f},
-std::array<float,2>{0.52656275f, 0.761952221f},
-std::array<float,2>{0.262136817f, 0.513393939f},
-std::array<float,2>{0.820869625f, 0.350727677f},
-std::array<float,2>{0.450314581f, 0.0137959896f},
-std::array<float,2>{0.892381489f, 0.9694314f},
-std::array<float,2>{0.0473129302f, 0.646428943f},
-std::array<float,2>{0.67770052f, 0.389626205f},
-std::array<float,2>{0.223122701f, 0.259189636f},
-std::array<float,2>{0.615897059f, 0.592958391f},
-std::array<float,2>{0.359033972f, 0.856761396f},
-std::array<float,2>{0.793591619f, 0.185400382f},
-std::array<float,2>{0.254618526f, 0.473983943f},
-std::array<float,2>{0.813938558f, 0.742906213f},
-std::array<float,2>{0.130262688f, 0.894692719f},
-std::array<float,2>{0.523237467f, 0.0853548422f},
-std::array<float,2>{0.120759606f, 0.206337273f},
-std::array<float,2>{0.739799678f, 0.786390603f},
-std::array<float,2>{0.394448847f, 0.553937495f},
-std::array<float,2>{0.939338923f, 0.326694608f},
-std::array<float,2>{0.339701056f, 0.139565632f},
-std::array<float,2>{0.780525863f, 0.833487451f},
-std::array<float,2>{0.191747814f, 0.606398106f},
-std::array<float,2>{0.573663533f, 0.293724984f},
-std::array<float,2>{0.00948625896f, 0.42567277f},
-std::array<float,2>{0.6536358f, 0.658812523f},
-std::array<float,2>{0.477600932f, 0.941110969f},
-std::array<float,2>{0.91663307f, 0.0446377397f},
-std::array<float,2>{0.426475167f, 0.354389518f},
-std::array<float,2>{0.98106885f, 0.503337681f},
-std::array<float,2>{0.0887235329f, 0.754217446f},
-std::array<float,2>{0.693332255f, 0.23537907f},
-std::array<float,2>{0.182288393f, 0.103629723f},
-std::array<float,2>{0.531806946f, 0.910192966f},
-std::array<float,2>{0.285740793f, 0.709740758f},
-std::array<float,2>{0.854319334f, 0.462825775f},
-std::array<float,2>{0.387527287f, 0.222894371f},
-std::array<float,2>{0.965858161f, 0.766006887f},
-std::array<float,2>{0.0944923982f, 0.518777966f},
-std::array<float,2>{0.733968556f, 0.362222612f},
-std::array<float,2>{0.141593531f, 0.440257907f},
-std::array<float,2>{0.511067033f, 0.692734659f},
-std::array<float,2>{0.279193908f, 0.934508383f},
-std::array<float,2>{0.836235583f, 0.11059358f},
-std::array<float,2>{0.373785198f, 0.300674021f},
-std::array<float,2>{0.809223652f, 0.621057391f},
-std::array<float,2>{0.238668859f, 0.815763175f},
-std::array<float,2>{0.603837729f, 0.143680751f},
-std::array<float,2>{0.0402902961f, 0.0598932505f},
-std::array<float,2>{0.658866763f, 0.967339158f},
-std::array<float,2>{0.45808357f, 0.676049888f},
-std::array<float,2>{0.888390183f, 0.408527553f},
-std::array<float,2>{0.298630953f, 0.0747545734f},
-std::array<float,2>{0.873713255f, 0.885086715f},
-std::array<float,2>{0.15775913f, 0.723888755f},
-std::array<float,2>{0.550133228f, 0.486325026f},
-std::array<float,2>{0.0680717304f, 0.330628425f},
-std::array<float,2>{0.715037525f, 0.544649959f},
-std::array<float,2>{0.409028202f, 0.797217965f},
-std::array<float,2>{0.992861688f, 0.196059063f},
-std::array<float,2>{0.48681432f, 0.397346884f},
-std::array<float,2>{0.931417167f, 0.637083411f},
-std::array<float,2>{0.0166720171f, 0.990270734f},
-std::array<float,2>{0.637752652f, 0.0203622468f},
-std::array<float,2>{0.207329273f, 0.164347917f},
-std::array<float,2>{0.583054841f, 0.873499572f},
-std::array<float,2>{0.319708705f, 0.577347994f},
-std::array<float,2>{0.757455349f, 0.267713219f},
-std::array<float,2>{0.410587639f, 0.0335825458f},
-std::array<float,2>{0.998244703f, 0.948266149f},
-std::array<float,2>{0.0661783665f, 0.668616712f},
-std::array<float,2>{0.712696075f, 0.436001569f},
-std::array<float,2>{0.160713971f, 0.287428319f},
-std::array<float,2>{0.55313015f, 0.596319914f},
-std::array<float,2>{0.301006168f, 0.840419233f},
-std::array<float,2>{0.870888472f, 0.125148535f},
-std::array<float,2>{0.315519869f, 0.456942618f},
-std::array<float,2>{0.751644135f, 0.711247444f},
-std::array<float,2>{0.20539023f, 0.914407551f},
-std::array<float,2>{0.578864276f, 0.0994800851f},
-std::array<float,2>{0.0230211057f, 0.24624601f},
-std::array<float,2>{0.634693325f, 0.760073304f},
-std::array<float,2>{0.488689035f, 0.508462846f},
-std::array<float,2>{0.935446322f, 0.345849633f},
-std::array<float,2>{0.274959803f, 0.178037286f},
-std::array<float,2>{0.84345156f, 0.843939722f},
-std::array<float,2>{0.148214281f, 0.583093286f},
-std::array<float,2>{0.512959123f, 0.25151661f},
-std::array<float,2>{0.100934155f, 0.379526436f},
-std::array<float,2>{0.728667974f, 0.650788367f},
-std::array<float,2>{0.386481702f, 0.981027782f},
-std::array<float,2>{0.96155113f, 0.00476717809f},
-std::array<float,2>{0.456143618f, 0.314974695f},
-std::array<float,2>{0.884768128f, 0.560486317f},
-std::array<float,2>{0.0463723466f, 0.796109855f},
-std::array<float,2>{0.663663387f, 0.215687051f},
-std::array<float,2>{0.234394699f, 0.0911553651f},
-std::array<float,2>{0.60825032f, 0.899623513f},
-std::array<float,2>{0.369175106f, 0.734448552f},
-std::array<float,2>{0.805683851f, 0.479235917f},
-std::array<float,2>{0.481362253f, 0.194569156f},
-std::array<float,2>{0.919776559f, 0.808358312f},
-std::array<float,2>{0.0148868933f, 0.533448398f},
-std::array<float,2>{0.649857283f, 0.339948177f},
-std::array<float,2>{0.190146193f, 0.493683159f},
-std::array<float,2>{0.574339509f, 0.726656377f},
-std::array<float,2>{0.340364367f, 0.880723953f},
-std::array<float,2>{0.776924729f, 0.0634041876f},
-std::array<float,2>{0.281610429f, 0.275095731f},
-std::array<float,2>{0.856916726f, 0.570216835f},
-std::array<float,2>{0.18442817f, 0.860743821f},
-std::array<float,2>{0.538061142f, 0.16330047f},
-std::array<float,2>{0.0902071372f, 0.0253627431f},
-std::array<float,2>{0.690857053f, 0.992578566f},
-std::array<float,2>{0.424360335f, 0.626383483f},
-std::array<float,2>{0.976569712f, 0.398932457f},
-std::array<float,2>{0.355036974f, 0.117882051f},
-std::array<float,2>{0.79164058f, 0.927812874f},
-std::array<float,2>{0.21994926f, 0.703076303f},
-std::array<float,2>{0.612888038f, 0.447460324f},
-std::array<float,2>{0.0545809977f, 0.37479946f},
-std::array<float,2>{0.672674716f, 0.529279292f},
-std::array<float,2>{0.448920637f, 0.778236628f},
-std::array<float,2>{0.895942748f, 0.230028838f},
-std::array<float,2>{0.396508127f, 0.41663897f},
-std::array<float,2>{0.94350791f, 0.681424022f},
-std::array<float,2>{0.121437863f, 0.960371196f},
-std::array<float,2>{0.735302746f, 0.0493426174f},
-std::array<float,2>{0.126960859f, 0.151038289f},
-std::array<float,2>{0.517120957f, 0.825419068f},
-std::array<float,2>{0.252308458f, 0.610337496f},
-std::array<float,2>{0.819113135f, 0.307359219f},
-std::array<float,2>{0.44283244f, 0.0705158487f},
-std::array<float,2>{0.90343374f, 0.890023053f},
-std::array<float,2>{0.0615894869f, 0.719132245f},
-std::array<float,2>{0.681986153f, 0.48838079f},
-std::array<float,2>{0.233101279f, 0.333197773f},
-std::array<float,2>{0.620366156f, 0.54230392f},
-std::array<float,2>{0.344060153f, 0.803240895f},
-std::array<float,2>{0.785121977f, 0.201977074f},
-std::array<float,2>{0.25878045f, 0.392045647f},
-std::array<float,2>{0.825265229f, 0.633161843f},
-std::array<float,2>{0.139290929f, 0.98690927f},
-std::array<float,2>{0.529870808f, 0.0176453199f},
-std::array<float,2>{0.116122596f, 0.170325682f},
-std::array<float,2>{0.745453179f, 0.867405593f},
-std::array<float,2>{0.400780767f, 0.571756423f},
-std::array<float,2>{0.950620711f, 0.271161884f},
-std::array<float,2>{0.333808243f, 0.219376653f},
-std::array<float,2>{0.766592681f, 0.771256149f},
-std::array<float,2>{0.201961383f, 0.521280706f},
-std::array<float,2>{0.567256212f, 0.365215987f},
-std::array<float,2>{0.00281573669f, 0.445039481f},
-std::array<float,2>{0.643535376f, 0.689133644f},
-std::array<float,2>{0.474322349f, 0.932206511f},
-std::array<float,2>{0.908801138f, 0.114313245f},
-std::array<float,2>{0.4367553f, 0.30304119f},
-std::array<float,2>{0.974509358f, 0.621475935f},
-std::array<float,2>{0.0854770467f, 0.817164421f},
-std::array<float,2>{0.697093844f, 0.146837205f},
-std::array<float,2>{0.175738677f, 0.0569508523f},
-std::array<float,2>{0.539908886f, 0.962187171f},
-std::array<float,2>{0.293058097f, 0.674647391f},
-std::array<float,2>{0.844761431f, 0.413257927f},
-std::array<float,2>{0.379390061f, 0.133502513f},
-std::array<float,2>{0.95564425f, 0.82895273f},
-std::array<float,2>{0.106891215f, 0.602798641f},
-std::array<float,2>{0.722156286f, 0.289739281f},
-std::array<float,2>{0.153734893f, 0.426171482f},
-std::array<float,2>{0.502277732f, 0.662183523f},
-std::array<float,2>{0.268391252f, 0.945156336f},
-std::array<float,2>{0.835833132f, 0.0401673727f},
-std::array<float,2>{0.360165119f, 0.357383579f},
-std::array<float,2>{0.798083305f, 0.507394612f},
-std::array<float,2>{0.248972848f, 0.753174424f},
-std::array<float,2>{0.595415831f, 0.238438144f},
-std::array<float,2>{0.0322255753f, 0.10705439f},
-std::array<float,2>{0.664098501f, 0.90841496f},
-std::array<float,2>{0.467583239f, 0.706274688f},
-std::array<float,2>{0.877075374f, 0.465736151f},
-std::array<float,2>{0.307142973f, 0.00848032907f},
-std::array<float,2>{0.862318218f, 0.972808957f},
-std::array<float,2>{0.168951049f, 0.643531978f},
-std::array<float,2>{0.55877167f, 0.382954508f},
-std::array<float,2>{0.0713575035f, 0.261741132f},
-std::array<float,2>{0.7073102f, 0.588417709f},
-std::array<float,2>{0.416773438f, 0.853837967f},
-std::array<float,2>{0.988697827f, 0.183036506f},
-std::array<float,2>{0.493544668f, 0.470614225f},
-std::array<float,2>{0.924884737f, 0.747923553f},
-std::array<float,2>{0.0242362414f, 0.894250929f},
-std::array<float,2>{0.631800532f, 0.0789270774f},
-std::array<float,2>{0.211048618f, 0.207626238f},
-std::array<float,2>{0.589199781f, 0.784087539f},
-std::array<float,2>{0.322133839f, 0.550239623f},
-std::array<float,2>{0.760631204f, 0.324072421f},
-std::array<float,2>{0.404424071f, 0.0968537182f},
-std::array<float,2>{0.948470771f, 0.919029355f},
-std::array<float,2>{0.110284053f, 0.718346894f},
-std::array<float,2>{0.749653041f, 0.457094312f},
-std::array<float,2>{0.136399284f, 0.350499213f},
-std::array<float,2>{0.525169969f, 0.512429297f},
-std::array<float,2>{0.263948798f, 0.763640106f},
-std::array<float,2>{0.824143946f, 0.243368328f},
-std::array<float,2>{0.347686082f, 0.433204263f},
-std::array<float,2>{0.787349343f, 0.667593181f},
-std::array<float,2>{0.22920379f, 0.950996101f},
-std::array<float,2>{0.624681413f, 0.036105182f},
-std::array<float,2>{0.0573985539f, 0.131751806f},
-std::array<float,2>{0.686201692f, 0.837899506f},
-std::array<float,2>{0.440230161f, 0.597921133f},
-std::array<float,2>{0.901263118f, 0.283991754f},
-std::array<float,2>{0.289188862f, 0.211782187f},
-std::array<float,2>{0.849002719f, 0.791404724f},
-std::array<float,2>{0.177499563f, 0.55774194f},
-std::array<float,2>{0.545487642f, 0.319340855f},
-std::array<float,2>{0.0784236491f, 0.480734259f},
-std::array<float,2>{0.701842606f, 0.739560068f},
-std::array<float,2>{0.433026046f, 0.903962016f},
-std::array<float,2>{0.969450176f, 0.0867692754f},
-std::array<float,2>{0.471954405f, 0.254985213f},
-std::array<float,2>{0.912372053f, 0.57900703f},
-std::array<float,2>{0.0071245376f, 0.851541936f},
-std::array<float,2>{0.645103395f, 0.172913656f},
-std::array<float,2>{0.196764931f, 0.00349570066f},
-std::array<float,2>{0.56625241f, 0.980110645f},
-std::array<float,2>{0.329987556f, 0.6559937f},
-std::array<float,2>{0.77241075f, 0.378310144f},
-std::array<float,2>{0.464772284f, 0.156834722f},
-std::array<float,2>{0.879590571f, 0.86454612f},
-std::array<float,2>{0.0387106016f, 0.566206694f},
-std::array<float,2>{0.668324172f, 0.280827492f},
-std::array<float,2>{0.243031666f, 0.404712409f},
-std::array<float,2>{0.598639667f, 0.630970955f},
-std::array<float,2>{0.366398782f, 0.997204781f},
-std::array<float,2>{0.801272392f, 0.0278695785f},
-std::array<float,2>{0.272193938f, 0.336627692f},
-std::array<float,2>{0.830745637f, 0.538094997f},
-std::array<float,2>{0.149881601f, 0.809387326f},
-std::array<float,2>{0.507632017f, 0.191352069f},
-std::array<float,2>{0.103724264f, 0.0682931244f},
-std::array<float,2>{0.724681735f, 0.878434539f},
-std::array<float,2>{0.37713176f, 0.733196616f},
-std::array<float,2>{0.959097207f, 0.497688055f},
-std::array<float,2>{0.324322551f, 0.0524306372f},
-std::array<float,2>{0.765002906f, 0.956323743f},
-std::array<float,2>{0.217440248f, 0.684036911f},
-std::array<float,2>{0.59089613f, 0.420899689f},
-std::array<float,2>{0.0291091129f, 0.311844915f},
-std::array<float,2>{0.626311719f, 0.615763605f},
-std::array<float,2>{0.497929811f, 0.823899925f},
-std::array<float,2>{0.925906241f, 0.155881777f},
-std::array<float,2>{0.420869529f, 0.452060401f},
-std::array<float,2>{0.987713575f, 0.697315097f},
-std::array<float,2>{0.0772031695f, 0.922368824f},
-std::array<float,2>{0.705989599f, 0.124345474f},
-std::array<float,2>{0.166317701f, 0.232115597f},
-std::array<float,2>{0.554701328f, 0.773570418f},
-std::array<float,2>{0.310224891f, 0.525195122f},
-std::array<float,2>{0.865320146f, 0.368063837f},
-std::array<float,2>{0.48623237f, 0.0206949487f},
-std::array<float,2>{0.93286401f, 0.991276443f},
-std::array<float,2>{0.0186808407f, 0.638326645f},
-std::array<float,2>{0.640008986f, 0.397796333f},
-std::array<float,2>{0.209238872f, 0.269165426f},
-std::array<float,2>{0.585075796f, 0.576609373f},
-std::array<float,2>{0.317571193f, 0.874125779f},
-std::array<float,2>{0.755235732f, 0.165373787f},
-std::array<float,2>{0.300750196f, 0.484899461f},
-std::array<float,2>{0.871998668f, 0.723449886f},
-std::array<float,2>{0.15932703f, 0.885854602f},
-std::array<float,2>{0.547330678f, 0.0757517144f},
-std::array<float,2>{0.0699914917f, 0.196737677f},
-std::array<float,2>{0.716871321f, 0.798044503f},
-std::array<float,2>{0.407037258f, 0.543560147f},
-std::array<float,2>{0.995563149f, 0.331213444f},
-std::array<float,2>{0.371381134f, 0.14331539f},
-std::array<float,2>{0.810660303f, 0.814489841f},
-std::array<float,2>{0.240941048f, 0.619271159f},
-std::array<float,2>{0.60220778f, 0.299437016f},
-std::array<float,2>{0.0414917208f, 0.409529477f},
-std::array<float,2>{0.657182813f, 0.677709997f},
-std::array<float,2>{0.459438413f, 0.968272328f},
-std::array<float,2>{0.890000165f, 0.0594382472f},
-std::array<float,2>{0.38912037f, 0.363056153f},
-std::array<float,2>{0.968351424f, 0.518520653f},
-std::array<float,2>{0.0965188816f, 0.767437994f},
-std::array<float,2>{0.731436312f, 0.224314585f},
-std::array<float,2>{0.144166455f, 0.109507717f},
-std::array<float,2>{0.508765757f, 0.935393929f},
-std::array<float,2>{0.279689252f, 0.692048132f},
-std::array<float,2>{0.839519501f, 0.440755367f},
-std::array<float,2>{0.429062515f, 0.235198587f},
-std::array<float,2>{0.984111071f, 0.755644023f},
-std::array<float,2>{0.0870338529f, 0.502795577f},
-std::array<float,2>{0.694920778f, 0.355152577f},
-std::array<float,2>{0.180899739f, 0.461759835f},
-std::array<float,2>{0.534188211f, 0.710350573f},
-std::array<float,2>{0.288940281f, 0.91207689f},
-std::array<float,2>{0.852687716f, 0.104563281f},
-std::array<float,2>{0.336060792f, 0.294824511f},
-std::array<float,2>{0.778897226f, 0.606720984f},
-std::array<float,2>{0.194161132f, 0.832619429f},
-std::array<float,2>{0.571638346f, 0.140282333f},
-std::array<float,2>{0.010158415f, 0.0439091995f},
-std::array<float,2>{0.656195402f, 0.939629912f},
-std::array<float,2>{0.480359048f, 0.65959686f},
-std::array<float,2>{0.914460361f, 0.424015164f},
-std::array<float,2>{0.257157832f, 0.0842801332f},
-std::array<float,2>{0.815760732f, 0.896335602f},
-std::array<float,2>{0.131775469f, 0.743838251f},
-std::array<float,2>{0.520926356f, 0.473449171f},
-std::array<float,2>{0.117366947f, 0.327817887f},
-std::array<float,2>{0.741920292f, 0.553454101f},
-std::array<float,2>{0.391025215f, 0.785352468f},
-std::array<float,2>{0.9407897f, 0.205690295f},
-std::array<float,2>{0.45306313f, 0.38997981f},
-std::array<float,2>{0.893161416f, 0.645430207f},
-std::array<float,2>{0.0496249422f, 0.970016181f},
-std::array<float,2>{0.679231465f, 0.0150112575f},
-std::array<float,2>{0.226488203f, 0.183688387f},
-std::array<float,2>{0.614153147f, 0.855567694f},
-std::array<float,2>{0.357221991f, 0.592585742f},
-std::array<float,2>{0.796118498f, 0.258002758f},
-std::array<float,2>{0.384187043f, 0.00730107352f},
-std::array<float,2>{0.96327728f, 0.983384967f},
-std::array<float,2>{0.0990574434f, 0.649799049f},
-std::array<float,2>{0.727694631f, 0.381087482f},
-std::array<float,2>{0.1459167f, 0.25387767f},
-std::array<float,2>{0.5153175f, 0.584423482f},
-std::array<float,2>{0.27598089f, 0.846389651f},
-std::array<float,2>{0.841655791f, 0.17642948f},
-std::array<float,2>{0.367953658f, 0.477008253f},
-std::array<float,2>{0.806999087f, 0.737054706f},
-std::array<float,2>{0.236474693f, 0.901185691f},
-std::array<float,2>{0.606651068f, 0.0918101072f},
-std::array<float,2>{0.0430833623f, 0.21749863f},
-std::array<float,2>{0.662097752f, 0.79397136f},
-std::array<float,2>{0.453894794f, 0.560652912f},
-std::array<float,2>{0.883504927f, 0.313842028f},
-std::array<float,2>{0.303223729f, 0.127646968f},
-std::array<float,2>{0.868638694f, 0.841920197f},
-std::array<float,2>{0.162960112f, 0.593793154f},
-std::array<float,2>{0.552408814f, 0.285633773f},
-std::array<float,2>{0.062993288f, 0.433787525f},
-std::array<float,2>{0.713277936f, 0.671689212f},
-std::array<float,2>{0.412642658f, 0.945622921f},
-std::array<float,2>{0.997943521f, 0.0325344764f},
-std::array<float,2>{0.491699427f, 0.345517874f},
-std::array<float,2>{0.936993718f, 0.511460543f},
-std::array<float,2>{0.0211999007f, 0.75873512f},
-std::array<float,2>{0.636579812f, 0.248518303f},
-std::array<float,2>{0.204774439f, 0.0996426195f},
-std::array<float,2>{0.580279291f, 0.917746425f},
-std::array<float,2>{0.313374579f, 0.714829803f},
-std::array<float,2>{0.752791762f, 0.454568326f},
-std::array<float,2>{0.447188944f, 0.228024006f},
-std::array<float,2>{0.897651494f, 0.780642986f},
-std::array<float,2>{0.0527145304f, 0.530355215f},
-std::array<float,2>{0.67482096f, 0.372561693f},
-std::array<float,2>{0.221675649f, 0.446471006f},
-std::array<float,2>{0.610125721f, 0.699285865f},
-std::array<float,2>{0.351681888f, 0.926524103f},
-std::array<float,2>{0.789152443f, 0.11975462f},
-std::array<float,2>{0.250695795f, 0.306374013f},
-std::array<float,2>{0.816452861f, 0.612218738f},
-std::array<float,2>{0.126115948f, 0.827376604f},
-std::array<float,2>{0.5185076f, 0.148470908f},
-std::array<float,2>{0.12310911f, 0.0472633839f},
-std::array<float,2>{0.737421811f, 0.957670748f},
-std::array<float,2>{0.395951688f, 0.681873798f},
-std::array<float,2>{0.941957772f, 0.414121896f},
-std::array<float,2>{0.342617273f, 0.0657420084f},
-std::array<float,2>{0.77507633f, 0.882616162f},
-std::array<float,2>{0.187771305f, 0.729358792f},
-std::array<float,2>{0.576457143f, 0.494511157f},
-std::array<float,2>{0.0120897302f, 0.343488574f},
-std::array<float,2>{0.652258158f, 0.532057464f},
-std::array<float,2>{0.484004319f, 0.805548668f},
-std::array<float,2>{0.920495749f, 0.193136916f},
-std::array<float,2>{0.423232317f, 0.401661694f},
-std::array<float,2>{0.980126619f, 0.627683401f},
-std::array<float,2>{0.0930838361f, 0.994167686f},
-std::array<float,2>{0.688283682f, 0.0262964014f},
-std::array<float,2>{0.186905369f, 0.161243975f},
-std::array<float,2>{0.536193669f, 0.8625741f},
-std::array<float,2>{0.283230513f, 0.567974687f},
-std::array<float,2>{0.857883155f, 0.27604118f},
-std::array<float,2>{0.475824326f, 0.115307376f},
-std::array<float,2>{0.908172548f, 0.930527508f},
-std::array<float,2>{0.00174197659f, 0.689484179f},
-std::array<float,2>{0.641945004f, 0.441764146f},
-std::array<float,2>{0.200679079f, 0.365306437f},
-std::array<float,2>{0.570252955f, 0.522962689f},
-std::array<float,2>{0.335905969f, 0.772612929f},
-std::array<float,2>{0.767866969f, 0.22119078f},
-std::array<float,2>{0.295192957f, 0.410528272f},
-std::array<float,2>{0.846596181f, 0.673251927f},
-std::array<float,2>{0.172482446f, 0.963736176f},
-std::array<float,2>{0.541650712f, 0.0565384999f},
-std::array<float,2>{0.0826975033f, 0.145785391f},
-std::array<float,2>{0.698338389f, 0.819962204f},
-std::array<float,2>{0.435530961f, 0.62423265f},
-std::array<float,2>{0.975213766f, 0.301609457f},
-std::array<float,2>{0.347372353f, 0.200046673f},
-std::array<float,2>{0.782906413f, 0.801823437f},
-std::array<float,2>{0.232233047f, 0.539459348f},
-std::array<float,2>{0.617308199f, 0.334765375f},
-std::array<float,2>{0.0590285882f, 0.491084516f},
-std::array<float,2>{0.679925919f, 0.72221595f},
-std::array<float,2>{0.445085257f, 0.886736214f},
-std::array<float,2>{0.905624509f, 0.0727536157f},
-std::array<float,2>{0.400341809f, 0.271805793f},
-std::array<float,2>{0.952295423f, 0.573886752f},
-std::array<float,2>{0.115047805f, 0.870121241f},
-std::array<float,2>{0.743951082f, 0.169438034f},
-std::array<float,2>{0.1386455f, 0.0174583141f},
-std::array<float,2>{0.528802514f, 0.986203253f},
-std::array<float,2>{0.261232734f, 0.635031104f},
-std::array<float,2>{0.827361941f, 0.392889738f},
-std::array<float,2>{0.414584547f, 0.181243598f},
-std::array<float,2>{0.991814077f, 0.852440298f},
-std::array<float,2>{0.0738172904f, 0.587520063f},
-std::array<float,2>{0.710899472f, 0.265193433f},
-std::array<float,2>{0.170622885f, 0.385732502f},
-std::array<float,2>{0.561558485f, 0.640861988f},
-std::array<float,2>{0.305571675f, 0.97542882f},
-std::array<float,2>{0.859762549f, 0.0111575313f},
-std::array<float,2>{0.324152738f, 0.320347399f},
-std::array<float,2>{0.758471489f, 0.547719777f},
-std::array<float,2>{0.214629382f, 0.783150017f},
-std::array<float,2>{0.587554336f, 0.210265577f},
-std::array<float,2>{0.0259820912f, 0.0803946108f},
-std::array<float,2>{0.629987538f, 0.892309785f},
-std::array<float,2>{0.496037424f, 0.749631226f},
-std::array<float,2>{0.922431529f, 0.472024083f},
-std::array<float,2>{0.266522646f, 0.0419279486f},
-std::array<float,2>{0.833740294f, 0.942429066f},
-std::array<float,2>{0.154705927f, 0.660921276f},
-std::array<float,2>{0.501272142f, 0.428048939f},
-std::array<float,2>{0.10799621f, 0.291240603f},
-std::array<float,2>{0.718828976f, 0.603798151f},
-std::array<float,2>{0.382286102f, 0.83017087f},
-std::array<float,2>{0.95500493f, 0.135282427f},
-std::array<float,2>{0.465698212f, 0.466938406f},
-std::array<float,2>{0.876738131f, 0.704109073f},
-std::array<float,2>{0.0332837068f, 0.907733142f},
-std::array<float,2>{0.666821837f, 0.108677089f},
-std::array<float,2>{0.24677068f, 0.241866052f},
-std::array<float,2>{0.596873641f, 0.750079095f},
-std::array<float,2>{0.361673146f, 0.504384935f},
-std::array<float,2>{0.799158216f, 0.357671082f},
-std::array<float,2>{0.430481851f, 0.0896263048f},
-std::array<float,2>{0.971503079f, 0.904876411f},
-std::array<float,2>{0.0812642276f, 0.741785586f},
-std::array<float,2>{0.699238539f, 0.482610404f},
-std::array<float,2>{0.1790158f, 0.31784901f},
-std::array<float,2>{0.544475675f, 0.556289554f},
-std::array<float,2>{0.292450666f, 0.789638221f},
-std::array<float,2>{0.850431919f, 0.213880867f},
-std::array<float,2>{0.33112216f, 0.376402527f},
-std::array<float,2>{0.770114124f, 0.652350783f},
-std::array<float,2>{0.19862625f, 0.978263199f},
-std::array<float,2>{0.56431073f, 0.000401786645f},
-std::array<float,2>{0.00434380583f, 0.175371826f},
-std::array<float,2>{0.648209989f, 0.849557459f},
-std::array<float,2>{0.469617873f, 0.581636667f},
-std::array<float,2>{0.910912991f, 0.256539613f},
-std::array<float,2>{0.263231754f, 0.245482132f},
-std::array<float,2>{0.821340442f, 0.76431793f},
-std::array<float,2>{0.134656891f, 0.514915705f},
-std::array<float,2>{0.52564311f, 0.349407613f},
-std::array<float,2>{0.111535929f, 0.460082293f},
-std::array<float,2>{0.74759537f, 0.71484977f},
-std::array<float,2>{0.403216928f, 0.921470404f},
-std::array<float,2>{0.945545495f, 0.0941321775f},
-std::array<float,2>{0.438124299f, 0.282098234f},
-std::array<float,2>{0.898852468f, 0.600863278f},
-std::array<float,2>{0.0557525791f, 0.836045146f},
-std::array<float,2>{0.684081614f, 0.130565286f},
-std::array<float,2>{0.227881417f, 0.0380671136f},
-std::array<float,2>{0.62222594f, 0.952812493f},
-std::array<float,2>{0.351178467f, 0.66586715f},
-std::array<float,2>{0.786801279f, 0.429998606f},
-std::array<float,2>{0.499553621f, 0.152456447f},
-std::array<float,2>{0.929553449f, 0.821627319f},
-std::array<float,2>{0.0310977548f, 0.613605678f},
-std::array<float,2>{0.628653109f, 0.310253471f},
-std::array<float,2>{0.214928448f, 0.41804117f},
-std::array<float,2>{0.593321204f, 0.68595612f},
-std::array<float,2>{0.327198893f, 0.954279482f},
-std::array<float,2>{0.762872159f, 0.0539260507f},
-std::array<float,2>{0.312059879f, 0.370941609f},
-std::array<float,2>{0.864466727f, 0.526084423f},
-std::array<float,2>{0.164619148f, 0.776462734f},
-std::array<float,2>{0.558342814f, 0.234101817f},
-std::array<float,2>{0.0746588707f, 0.122725211f},
-std::array<float,2>{0.703285754f, 0.923963487f},
-std::array<float,2>{0.419393867f, 0.696467638f},
-std::array<float,2>{0.986020863f, 0.450209081f},
-std::array<float,2>{0.363408118f, 0.0300039519f},
-std::array<float,2>{0.804098129f, 0.999229193f},
-std::array<float,2>{0.244183943f, 0.62984854f},
-std::array<float,2>{0.600608706f, 0.403621018f},
-std::array<float,2>{0.0367801338f, 0.277421147f},
-std::array<float,2>{0.671122193f, 0.563502908f},
-std::array<float,2>{0.461444527f, 0.867034853f},
-std::array<float,2>{0.881875277f, 0.159722775f},
-std::array<float,2>{0.375140339f, 0.498179734f},
-std::array<float,2>{0.958827257f, 0.731989682f},
-std::array<float,2>{0.10202112f, 0.876630366f},
-std::array<float,2>{0.723673582f, 0.0695776716f},
-std::array<float,2>{0.151115552f, 0.188047096f},
-std::array<float,2>{0.505590558f, 0.811095893f},
-std::array<float,2>{0.269687414f, 0.53683579f},
-std::array<float,2>{0.828613698f, 0.33924982f},
-std::array<float,2>{0.457308233f, 0.0610686839f},
-std::array<float,2>{0.887235761f, 0.965867281f},
-std::array<float,2>{0.0390943103f, 0.678892493f},
-std::array<float,2>{0.660114765f, 0.406524062f},
-std::array<float,2>{0.239977315f, 0.298730046f},
-std::array<float,2>{0.60516113f, 0.618954718f},
-std::array<float,2>{0.374774277f, 0.81386441f},
-std::array<float,2>{0.809906006f, 0.14115721f},
-std::array<float,2>{0.277535468f, 0.437931478f},
-std::array<float,2>{0.836963594f, 0.694014668f},
-std::array<float,2>{0.142475948f, 0.935720801f},
-std::array<float,2>{0.510396183f, 0.113051601f},
-std::array<float,2>{0.0952463374f, 0.22527276f},
-std::array<float,2>{0.732960045f, 0.768379509f},
-std::array<float,2>{0.388166994f, 0.517122149f},
-std::array<float,2>{0.965782583f, 0.360720456f},
-std::array<float,2>{0.319324553f, 0.167819336f},
-std::array<float,2>{0.756282806f, 0.871794343f},
-std::array<float,2>{0.208734065f, 0.576013446f},
-std::array<float,2>{0.582100332f, 0.266897649f},
-std::array<float,2>{0.0160656478f, 0.395396382f},
-std::array<float,2>{0.637364864f, 0.640036285f},
-std::array<float,2>{0.488181412f, 0.989220917f},
-std::array<float,2>{0.930346787f, 0.0221434794f},
-std::array<float,2>{0.40962261f, 0.328976691f},
-std::array<float,2>{0.993896127f, 0.545449555f},
-std::array<float,2>{0.0665577725f, 0.799417853f},
-std::array<float,2>{0.716413558f, 0.198063463f},
-std::array<float,2>{0.156519562f, 0.0768642202f},
-std::array<float,2>{0.549072742f, 0.884324193f},
-std::array<float,2>{0.297492027f, 0.72632575f},
-std::array<float,2>{0.874398112f, 0.48728478f},
-std::array<float,2>{0.393089861f, 0.203196928f},
-std::array<float,2>{0.937558949f, 0.78790468f},
-std::array<float,2>{0.119911291f, 0.552344501f},
-std::array<float,2>{0.73854214f, 0.324831367f},
-std::array<float,2>{0.129149586f, 0.47476548f},
-std::array<float,2>{0.522089541f, 0.744284093f},
-std::array<float,2>{0.255191475f, 0.897286654f},
-std::array<float,2>{0.812952518f, 0.0828178301f},
-std::array<float,2>{0.358065099f, 0.260296613f},
-std::array<float,2>{0.794428706f, 0.591572046f},
-std::array<float,2>{0.224161088f, 0.857740462f},
-std::array<float,2>{0.616510212f, 0.1867681f},
-std::array<float,2>{0.0480397716f, 0.0121215852f},
-std::array<float,2>{0.675956368f, 0.972635329f},
-std::array<float,2>{0.449622512f, 0.648256063f},
-std::array<float,2>{0.891093254f, 0.386995971f},
-std::array<float,2>{0.286796153f, 0.101716921f},
-std::array<float,2>{0.855055451f, 0.912151217f},
-std::array<float,2>{0.183125988f, 0.708021343f},
-std::array<float,2>{0.532365084f, 0.464303792f},
-std::array<float,2>{0.0895287767f, 0.351966143f},
-std::array<float,2>{0.691729188f, 0.500930429f},
-std::array<float,2>{0.427466661f, 0.757312477f},
-std::array<float,2>{0.981529891f, 0.237318575f},
-std::array<float,2>{0.477157772f, 0.422405779f},
-std::array<float,2>{0.917476952f, 0.656643808f},
-std::array<float,2>{0.00799347274f, 0.939065754f},
-std::array<float,2>{0.652903795f, 0.0453662798f},
-std::array<float,2>{0.192419276f, 0.137455538f},
-std::array<float,2>{0.57272923f, 0.835908771f},
-std::array<float,2>{0.338088125f, 0.608213127f},
-std::array<float,2>{0.780116439f, 0.29665041f},
-std::array<float,2>{0.416428119f, 0.0116636613f},
-std::array<float,2>{0.989116073f, 0.974671602f},
-std::array<float,2>{0.0722363666f, 0.641197741f},
-std::array<float,2>{0.707816362f, 0.384986579f},
-std::array<float,2>{0.169833168f, 0.264819711f},
-std::array<float,2>{0.559095442f, 0.587222934f},
-std::array<float,2>{0.306645483f, 0.851877511f},
-std::array<float,2>{0.863108873f, 0.180813357f},
-std::array<float,2>{0.321744591f, 0.472431093f},
-std::array<float,2>{0.760194719f, 0.749463975f},
-std::array<float,2>{0.211785153f, 0.891654909f},
-std::array<float,2>{0.58980006f, 0.0808499083f},
-std::array<float,2>{0.0235992391f, 0.210820705f},
-std::array<float,2>{0.631191492f, 0.782430172f},
-std::array<float,2>{0.493689209f, 0.54688096f},
-std::array<float,2>{0.92550379f, 0.321147084f},
-std::array<float,2>{0.267671645f, 0.13502562f},
-std::array<float,2>{0.835134864f, 0.830860913f},
-std::array<float,2>{0.154014945f, 0.604240894f},
-std::array<float,2>{0.502565265f, 0.291912973f},
-std::array<float,2>{0.107340015f, 0.428563625f},
-std::array<float,2>{0.722370565f, 0.6604954f},
-std::array<float,2>{0.379843891f, 0.942964613f},
-std::array<float,2>{0.955104649f, 0.0412403941f},
-std::array<float,2>{0.466995656f, 0.358018041f},
-std::array<float,2>{0.87763828f, 0.504832685f},
-std::array<float,2>{0.0314715691f, 0.750970781f},
-std::array<float,2>{0.664633512f, 0.241378963f},
-std::array<float,2>{0.248190492f, 0.109372824f},
-std::array<float,2>{0.594760895f, 0.907366335f},
-std::array<float,2>{0.359801829f, 0.704695046f},
-std::array<float,2>{0.798817813f, 0.467332184f},
-std::array<float,2>{0.473904759f, 0.221599907f},
-std::array<float,2>{0.908406317f, 0.773182392f},
-std::array<float,2>{0.0022837976f, 0.522726297f},
-std::array<float,2>{0.642748892f, 0.366058886f},
-std::array<float,2>{0.201558068f, 0.442007005f},
-std::array<float,2>{0.566708446f, 0.690421641f},
-std::array<float,2>{0.333352715f, 0.930166066f},
-std::array<float,2>{0.765653491f, 0.116200231f},
-std::array<float,2>{0.293575525f, 0.301065087f},
-std::array<float,2>{0.845231354f, 0.624733806f},
-std::array<float,2>{0.174996987f, 0.819703758f},
-std::array<float,2>{0.539497316f, 0.146090463f},
-std::array<float,2>{0.085318923f, 0.0560772866f},
-std::array<float,2>{0.696391761f, 0.963000476f},
-std::array<float,2>{0.437433988f, 0.673619688f},
-std::array<float,2>{0.974035442f, 0.411075324f},
-std::array<float,2>{0.344258279f, 0.0731539577f},
-std::array<float,2>{0.784204245f, 0.887329638f},
-std::array<float,2>{0.232847288f, 0.721756279f},
-std::array<float,2>{0.62062043f, 0.490650117f},
-std::array<float,2>{0.0624486543f, 0.334284812f},
-std::array<float,2>{0.682525635f, 0.540035486f},
-std::array<float,2>{0.443281829f, 0.802703381f},
-std::array<float,2>{0.904170573f, 0.199548885f},
-std::array<float,2>{0.401079148f, 0.393517226f},
-std::array<float,2>{0.950713754f, 0.635718107f},
-std::array<float,2>{0.115594447f, 0.985801876f},
-std::array<float,2>{0.746006846f, 0.016811505f},
-std::array<float,2>{0.138958573f, 0.169237748f},
-std::array<float,2>{0.529745638f, 0.870738804f},
-std::array<float,2>{0.25789237f, 0.573418498f},
-std::array<float,2>{0.825807095f, 0.272311091f},
-std::array<float,2>{0.448243707f, 0.11928013f},
-std::array<float,2>{0.896212995f, 0.926154017f},
-std::array<float,2>{0.053743504f, 0.700083613f},
-std::array<float,2>{0.67222017f, 0.447020888f},
-std::array<float,2>{0.220641062f, 0.372269005f},
-std::array<float,2>{0.612397432f, 0.531181633f},
-std::array<float,2>{0.354866624f, 0.781082511f},
-std::array<float,2>{0.791303396f, 0.228308499f},
-std::array<float,2>{0.252802879f, 0.415011019f},
-std::array<float,2>{0.818394899f, 0.68224138f},
-std::array<float,2>{0.127610236f, 0.957088053f},
-std::array<float,2>{0.516865969f, 0.0478150435f},
-std::array<float,2>{0.121955708f, 0.149397224f},
-std::array<float,2>{0.734600544f, 0.82768333f},
-std::array<float,2>{0.39722985f, 0.611356378f},
-std::array<float,2>{0.944143593f, 0.305802554f},
-std::array<float,2>{0.340056479f, 0.19261992f},
-std::array<float,2>{0.776396632f, 0.804718196f},
-std::array<float,2>{0.18992658f, 0.531270802f},
-std::array<float,2>{0.574742615f, 0.343084812f},
-std::array<float,2>{0.0155169712f, 0.494856f},
-std::array<float,2>{0.650118768f, 0.72890991f},
-std::array<float,2>{0.480905175f, 0.882046402f},
-std::array<float,2>{0.919047356f, 0.066401571f},
-std::array<float,2>{0.423845112f, 0.275465369f},
-std::array<float,2>{0.977412462f, 0.567653298f},
-std::array<float,2>{0.0905162469f, 0.863121331f},
-std::array<float,2>{0.691053092f, 0.162014484f},
-std::array<float,2>{0.183830813f, 0.0255615711f},
-std::array<float,2>{0.537144661f, 0.994719088f},
-std::array<float,2>{0.281901091f, 0.62737298f},
-std::array<float,2>{0.857010901f, 0.402239054f},
-std::array<float,2>{0.385881126f, 0.175992936f},
-std::array<float,2>{0.961324811f, 0.845770001f},
-std::array<float,2>{0.101440512f, 0.584787726f},
-std::array<float,2>{0.72928524f, 0.252932191f},
-std::array<float,2>{0.147466809f, 0.381359577f},
-std::array<float,2>{0.513264418f, 0.650290012f},
-std::array<float,2>{0.274433076f, 0.982698202f},
-std::array<float,2>{0.842813313f, 0.00751808519f},
-std::array<float,2>{0.369772673f, 0.314173847f},
-std::array<float,2>{0.806555688f, 0.561249435f},
-std::array<float,2>{0.235086814f, 0.794594228f},
-std::array<float,2>{0.607507646f, 0.21688661f},
-std::array<float,2>{0.0464204438f, 0.0924485177f},
-std::array<float,2>{0.663339138f, 0.900450647f},
-std::array<float,2>{0.456624359f, 0.736332238f},
-std::array<float,2>{0.885335445f, 0.477219224f},
-std::array<float,2>{0.301322401f, 0.0328542143f},
-std::array<float,2>{0.870284736f, 0.946157038f},
-std::array<float,2>{0.160478294f, 0.671247423f},
-std::array<float,2>{0.553394914f, 0.434121341f},
-std::array<float,2>{0.0656637624f, 0.285651743f},
-std::array<float,2>{0.712242603f, 0.594499171f},
-std::array<float,2>{0.410774767f, 0.842675209f},
-std::array<float,2>{0.998663425f, 0.126962319f},
-std::array<float,2>{0.488921672f, 0.454735637f},
-std::array<float,2>{0.934908986f, 0.714090884f},
-std::array<float,2>{0.0228120815f, 0.917123675f},
-std::array<float,2>{0.634115815f, 0.100461766f},
-std::array<float,2>{0.205872789f, 0.248632953f},
-std::array<float,2>{0.578158915f, 0.758018315f},
-std::array<float,2>{0.316221803f, 0.510955811f},
-std::array<float,2>{0.751043439f, 0.344891816f},
-std::array<float,2>{0.391498744f, 0.0823583752f},
-std::array<float,2>{0.941346467f, 0.896688342f},
-std::array<float,2>{0.118156321f, 0.744727731f},
-std::array<float,2>{0.741528869f, 0.475562483f},
-std::array<float,2>{0.130929515f, 0.324419349f},
-std::array<float,2>{0.521415055f, 0.552127361f},
-std::array<float,2>{0.25770241f, 0.787460327f},
-std::array<float,2>{0.816028059f, 0.204008713f},
-std::array<float,2>{0.356488407f, 0.387674421f},
-std::array<float,2>{0.796446621f, 0.647752047f},
-std::array<float,2>{0.225981712f, 0.971805096f},
-std::array<float,2>{0.613415718f, 0.0122810565f},
-std::array<float,2>{0.048979871f, 0.187149853f},
-std::array<float,2>{0.679133475f, 0.858164072f},
-std::array<float,2>{0.452599466f, 0.5912202f},
-std::array<float,2>{0.892706513f, 0.260016233f},
-std::array<float,2>{0.288276285f, 0.237824157f},
-std::array<float,2>{0.853262246f, 0.757650495f},
-std::array<float,2>{0.181635261f, 0.500419974f},
-std::array<float,2>{0.53494966f, 0.352166384f},
-std::array<float,2>{0.0878783539f, 0.464579195f},
-std::array<float,2>{0.694544494f, 0.708592892f},
-std::array<float,2>{0.429686695f, 0.912798643f},
-std::array<float,2>{0.983660877f, 0.102246821f},
-std::array<float,2>{0.479866683f, 0.296190143f},
-std::array<float,2>{0.914729357f, 0.607470274f},
-std::array<float,2>{0.0106496112f, 0.835009515f},
-std::array<float,2>{0.655754089f, 0.136729747f},
-std::array<float,2>{0.193392202f, 0.0457157642f},
-std::array<float,2>{0.572200596f, 0.938775301f},
-std::array<float,2>{0.336693913f, 0.656781733f},
-std::array<float,2>{0.778502882f, 0.422267675f},
-std::array<float,2>{0.459706545f, 0.140776798f},
-std::array<float,2>{0.890251577f, 0.814173281f},
-std::array<float,2>{0.0416655168f, 0.618170142f},
-std::array<float,2>{0.656393647f, 0.297926128f},
-std::array<float,2>{0.240283698f, 0.406795263f},
-std::array<float,2>{0.601760626f, 0.679334164f},
-std::array<float,2>{0.371984065f, 0.966651022f},
-std::array<float,2>{0.811467052f, 0.0610000044f},
-std::array<float,2>{0.279999048f, 0.361233711f},
-std::array<float,2>{0.839153171f, 0.516843379f},
-std::array<float,2>{0.143704757f, 0.76796329f},
-std::array<float,2>{0.508141696f, 0.224813223f},
-std::array<float,2>{0.0960902423f, 0.112791479f},
-std::array<float,2>{0.730701029f, 0.936451435f},
-std::array<float,2>{0.389224708f, 0.693796277f},
-std::array<float,2>{0.967927039f, 0.438465118f},
-std::array<float,2>{0.317997962f, 0.0216169357f},
-std::array<float,2>{0.755493462f, 0.98874414f},
-std::array<float,2>{0.209570467f, 0.640494943f},
-std::array<float,2>{0.585930645f, 0.394892961f},
-std::array<float,2>{0.0191239156f, 0.267455757f},
-std::array<float,2>{0.640441477f, 0.575234532f},
-std::array<float,2>{0.485603511f, 0.871130407f},
-std::array<float,2>{0.933111012f, 0.1670167f},
-std::array<float,2>{0.406532824f, 0.486441374f},
-std::array<float,2>{0.996091127f, 0.725587487f},
-std::array<float,2>{0.0697910562f, 0.883901954f},
-std::array<float,2>{0.717442751f, 0.0766504258f},
-std::array<float,2>{0.159811988f, 0.197700694f},
-std::array<float,2>{0.547686338f, 0.798912585f},
-std::array<float,2>{0.300217241f, 0.54533869f},
-std::array<float,2>{0.871325254f, 0.328172505f},
-std::array<float,2>{0.497097194f, 0.0543713644f},
-std::array<float,2>{0.926377237f, 0.954839647f},
-std::array<float,2>{0.0286928546f, 0.686155021f},
-std::array<float,2>{0.626494527f, 0.418871969f},
-std::array<float,2>{0.217085615f, 0.310007513f},
-std::array<float,2>{0.591699719f, 0.614022553f},
-std::array<float,2>{0.324755281f, 0.821865678f},
-std::array<float,2>{0.765292704f, 0.152931079f},
-std::array<float,2>{0.309675604f, 0.451060653f},
-std::array<float,2>{0.86572808f, 0.696857393f},
-std::array<float,2>{0.166783646f, 0.92444253f},
-std::array<float,2>{0.555274129f, 0.122544244f},
-std::array<float,2>{0.077981934f, 0.233751878f},
-std::array<float,2>{0.705534875f, 0.777080417f},
-std::array<float,2>{0.419992715f, 0.525598168f},
-std::array<float,2>{0.987911046f, 0.370458543f},
-std::array<float,2>{0.367111534f, 0.159591377f},
-std::array<float,2>{0.801070809f, 0.866248846f},
-std::array<float,2>{0.242602304f, 0.564355791f},
-std::array<float,2>{0.599466145f, 0.277875811f},
-std::array<float,2>{0.0382999256f, 0.40415749f},
-std::array<float,2>{0.668557823f, 0.628950953f},
-std::array<float,2>{0.464106441f, 0.999995351f},
-std::array<float,2>{0.879184783f, 0.0295351893f},
-std::array<float,2>{0.377454877f, 0.339643627f},
-std::array<float,2>{0.959684253f, 0.536187112f},
-std::array<float,2>{0.104467794f, 0.810828984f},
-std::array<float,2>{0.725203454f, 0.187747076f},
-std::array<float,2>{0.150352284f, 0.0699258745f},
-std::array<float,2>{0.506981611f, 0.876214683f},
-std::array<float,2>{0.271706849f, 0.731669009f},
-std::array<float,2>{0.830379248f, 0.499007642f},
-std::array<float,2>{0.433235735f, 0.214549392f},
-std::array<float,2>{0.969017565f, 0.789312005f},
-std::array<float,2>{0.0790625885f, 0.555975795f},
-std::array<float,2>{0.70122999f, 0.318120778f},
-std::array<float,2>{0.176964253f, 0.483139098f},
-std::array<float,2>{0.545072317f, 0.741407514f},
-std::array<float,2>{0.289649099f, 0.904628515f},
-std::array<float,2>{0.849225223f, 0.0889390931f},
-std::array<float,2>{0.329579264f, 0.256078541f},
-std::array<float,2>{0.771835625f, 0.581431389f},
-std::array<float,2>{0.197129861f, 0.848985255f},
-std::array<float,2>{0.565670848f, 0.174812958f},
-std::array<float,2>{0.00752206566f, 0.000879120547f},
-std::array<float,2>{0.644774497f, 0.977951586f},
-std::array<float,2>{0.472602308f, 0.652861714f},
-std::array<float,2>{0.913049459f, 0.376812875f},
-std::array<float,2>{0.264164567f, 0.0945540592f},
-std::array<float,2>{0.823568285f, 0.921196759f},
-std::array<float,2>{0.136100248f, 0.715808809f},
-std::array<float,2>{0.524502873f, 0.460794717f},
-std::array<float,2>{0.109464362f, 0.348673701f},
-std::array<float,2>{0.749447584f, 0.51557976f},
-std::array<float,2>{0.405087173f, 0.763701499f},
-std::array<float,2>{0.94902271f, 0.245921522f},
-std::array<float,2>{0.439764589f, 0.430366993f},
-std::array<float,2>{0.90074122f, 0.665417135f},
-std::array<float,2>{0.0569410101f, 0.952364743f},
-std::array<float,2>{0.685740769f, 0.0373596251f},
-std::array<float,2>{0.228621379f, 0.130065858f},
-std::array<float,2>{0.624086797f, 0.836443007f},
-std::array<float,2>{0.348145157f, 0.601388931f},
-std::array<float,2>{0.788051605f, 0.281674564f},
-std::array<float,2>{0.382683992f, 0.0409300663f},
-std::array<float,2>{0.954252541f, 0.944731891f},
-std::array<float,2>{0.10765139f, 0.663068414f},
-std::array<float,2>{0.71949923f, 0.426720947f},
-std::array<float,2>{0.154872775f, 0.28950879f},
-std::array<float,2>{0.501549304f, 0.603029311f},
-std::array<float,2>{0.265938133f, 0.828278601f},
-std::array<float,2>{0.83310914f, 0.132841423f},
-std::array<float,2>{0.361927122f, 0.465093493f},
-std::array<float,2>{0.799610078f, 0.707007468f},
-std::array<float,2>{0.246236935f, 0.9087286f},
-std::array<float,2>{0.597640753f, 0.106849201f},
-std::array<float,2>{0.033836063f, 0.239253372f},
-std::array<float,2>{0.666225076f, 0.75378263f},
-std::array<float,2>{0.464960217f, 0.50703609f},
-std::array<float,2>{0.876084387f, 0.35691157f},
-std::array<float,2>{0.304961741f, 0.183166116f},
-std::array<float,2>{0.860118091f, 0.854072094f},
-std::array<float,2>{0.170101315f, 0.588203073f},
-std::array<float,2>{0.562207758f, 0.26268819f},
-std::array<float,2>{0.0734736174f, 0.383733422f},
-std::array<float,2>{0.710177243f, 0.642800689f},
-std::array<float,2>{0.414453477f, 0.973561645f},
-std::array<float,2>{0.991356671f, 0.00782212708f},
-std::array<float,2>{0.495244831f, 0.323438883f},
-std::array<float,2>{0.921918869f, 0.550538063f},
-std::array<float,2>{0.0257447138f, 0.783495963f},
-std::array<float,2>{0.630813658f, 0.207081556f},
-std::array<float,2>{0.214205176f, 0.0786109343f},
-std::array<float,2>{0.587045431f, 0.894009948f},
-std::array<float,2>{0.323487222f, 0.747308254f},
-std::array<float,2>{0.757913411f, 0.46983701f},
-std::array<float,2>{0.444476902f, 0.201510862f},
-std::array<float,2>{0.90614742f, 0.803165853f},
-std::array<float,2>{0.0592384785f, 0.542762995f},
-std::array<float,2>{0.680544555f, 0.333932161f},
-std::array<float,2>{0.231807679f, 0.489027083f},
-std::array<float,2>{0.617888749f, 0.719660103f},
-std::array<float,2>{0.346940726f, 0.890212953f},
-std::array<float,2>{0.782409549f, 0.0709182546f},
-std::array<float,2>{0.26113838f, 0.270697147f},
-std::array<float,2>{0.827971339f, 0.572153747f},
-std::array<float,2>{0.137766987f, 0.867988288f},
-std::array<float,2>{0.529288948f, 0.170491591f},
-std::array<float,2>{0.114500262f, 0.0185178649f},
-std::array<float,2>{0.743543029f, 0.986383617f},
-std::array<float,2>{0.399814546f, 0.633421302f},
-std::array<float,2>{0.952796102f, 0.392180145f},
-std::array<float,2>{0.335205615f, 0.115010098f},
-std::array<float,2>{0.768245578f, 0.93203938f},
-std::array<float,2>{0.200875029f, 0.688705742f},
-std::array<float,2>{0.56937325f, 0.444374591f},
-std::array<float,2>{0.00107237266f, 0.364259392f},
-std::array<float,2>{0.642240584f, 0.520915091f},
-std::array<float,2>{0.476240426f, 0.770556271f},
-std::array<float,2>{0.907353878f, 0.219185337f},
-std::array<float,2>{0.434971958f, 0.413954049f},
-std::array<float,2>{0.97491914f, 0.674187601f},
-std::array<float,2>{0.0824011117f, 0.962505221f},
-std::array<float,2>{0.698932827f, 0.0574731156f},
-std::array<float,2>{0.171914458f, 0.147202894f},
-std::array<float,2>{0.541352689f, 0.816484272f},
-std::array<float,2>{0.295522392f, 0.621850789f},
-std::array<float,2>{0.846166968f, 0.303636998f},
-std::array<float,2>{0.483851939f, 0.0625956282f},
-std::array<float,2>{0.919949055f, 0.880127549f},
-std::array<float,2>{0.0123424456f, 0.727072954f},
-std::array<float,2>{0.651548028f, 0.493281513f},
-std::array<float,2>{0.188392282f, 0.340816826f},
-std::array<float,2>{0.576957166f, 0.533989012f},
-std::array<float,2>{0.342198849f, 0.807716846f},
-std::array<float,2>{0.774751127f, 0.195016712f},
-std::array<float,2>{0.283742815f, 0.398825616f},
-std::array<float,2>{0.858063519f, 0.626509368f},
-std::array<float,2>{0.187383041f, 0.99270004f},
-std::array<float,2>{0.536838591f, 0.0246023554f},
-std::array<float,2>{0.0934026763f, 0.16404058f},
-std::array<float,2>{0.687653482f, 0.861147881f},
-std::array<float,2>{0.42353934f, 0.569436133f},
-std::array<float,2>{0.979807794f, 0.274436057f},
-std::array<float,2>{0.352163494f, 0.229888231f},
-std::array<float,2>{0.78965652f, 0.77764231f},
-std::array<float,2>{0.22093004f, 0.528616905f},
-std::array<float,2>{0.609559059f, 0.374138057f},
-std::array<float,2>{0.0519544668f, 0.448143512f},
-std::array<float,2>{0.675463617f, 0.702587426f},
-std::array<float,2>{0.446738929f, 0.928450525f},
-std::array<float,2>{0.898059547f, 0.117385924f},
-std::array<float,2>{0.396163344f, 0.306779742f},
-std::array<float,2>{0.941417038f, 0.609848797f},
-std::array<float,2>{0.123959094f, 0.826003909f},
-std::array<float,2>{0.737865448f, 0.150683165f},
-std::array<float,2>{0.126526043f, 0.0488355011f},
-std::array<float,2>{0.517803013f, 0.960726738f},
-std::array<float,2>{0.25043419f, 0.680863321f},
-std::array<float,2>{0.816948712f, 0.416459203f},
-std::array<float,2>{0.412157029f, 0.125934094f},
-std::array<float,2>{0.997252405f, 0.84024471f},
-std::array<float,2>{0.062654838f, 0.596154094f},
-std::array<float,2>{0.713640392f, 0.28791973f},
-std::array<float,2>{0.162328005f, 0.43647787f},
-std::array<float,2>{0.551774442f, 0.668351233f},
-std::array<float,2>{0.302942485f, 0.948812723f},
-std::array<float,2>{0.869098067f, 0.033894036f},
-std::array<float,2>{0.312861651f, 0.346425205f},
-std::array<float,2>{0.752155781f, 0.508059204f},
-std::array<float,2>{0.204587042f, 0.760611713f},
-std::array<float,2>{0.580735922f, 0.246601701f},
-std::array<float,2>{0.0208501797f, 0.0987292752f},
-std::array<float,2>{0.636052668f, 0.914808631f},
-std::array<float,2>{0.491665602f, 0.711724162f},
-std::array<float,2>{0.937156856f, 0.456422329f},
-std::array<float,2>{0.275690913f, 0.00432478264f},
-std::array<float,2>{0.841148078f, 0.980685234f},
-std::array<float,2>{0.146107227f, 0.65120554f},
-std::array<float,2>{0.514977455f, 0.379341066f},
-std::array<float,2>{0.0995251462f, 0.251006961f},
-std::array<float,2>{0.728230834f, 0.583970189f},
-std::array<float,2>{0.384506434f, 0.844323993f},
-std::array<float,2>{0.963537514f, 0.178426266f},
-std::array<float,2>{0.45342654f, 0.47856155f},
-std::array<float,2>{0.883259535f, 0.735042274f},
-std::array<float,2>{0.0434777439f, 0.900112629f},
-std::array<float,2>{0.661528826f, 0.0915062875f},
-std::array<float,2>{0.236917883f, 0.214970022f},
-std::array<float,2>{0.607313275f, 0.796592116f},
-std::array<float,2>{0.367311567f, 0.559653759f},
-std::array<float,2>{0.807174444f, 0.314874768f},
-std::array<float,2>{0.42709583f, 0.10531909f},
-std::array<float,2>{0.98237741f, 0.911528528f},
-std::array<float,2>{0.0890592486f, 0.710624576f},
-std::array<float,2>{0.692055523f, 0.461080015f},
-std::array<float,2>{0.182757348f, 0.354941159f},
-std::array<float,2>{0.532827973f, 0.502039313f},
-std::array<float,2>{0.286414415f, 0.755004168f},
-std::array<float,2>{0.854518414f, 0.234859496f},
-std::array<float,2>{0.338681906f, 0.424670249f},
-std::array<float,2>{0.779622793f, 0.660006821f},
-std::array<float,2>{0.193258226f, 0.940071642f},
-std::array<float,2>{0.5729357f, 0.043196924f},
-std::array<float,2>{0.0085121328f, 0.140020818f},
-std::array<float,2>{0.652739286f, 0.832159817f},
-std::array<float,2>{0.476724416f, 0.606986463f},
-std::array<float,2>{0.917886853f, 0.2939758f},
-std::array<float,2>{0.255412489f, 0.205251545f},
-std::array<float,2>{0.813077807f, 0.786045611f},
-std::array<float,2>{0.129657164f, 0.552888393f},
-std::array<float,2>{0.521966457f, 0.32755056f},
-std::array<float,2>{0.119248137f, 0.473051399f},
-std::array<float,2>{0.738879383f, 0.743200243f},
-std::array<float,2>{0.393002778f, 0.895837247f},
-std::array<float,2>{0.938445508f, 0.0848844498f},
-std::array<float,2>{0.449979424f, 0.258429289f},
-std::array<float,2>{0.891537786f, 0.592253447f},
-std::array<float,2>{0.048792351f, 0.856042981f},
-std::array<float,2>{0.676390529f, 0.184303075f},
-std::array<float,2>{0.223721594f, 0.0152743533f},
-std::array<float,2>{0.617099822f, 0.970460296f},
-std::array<float,2>{0.357754111f, 0.644633114f},
-std::array<float,2>{0.794504285f, 0.390473962f},
-std::array<float,2>{0.48770386f, 0.165576831f},
-std::array<float,2>{0.929837286f, 0.874827385f},
-std::array<float,2>{0.0162837561f, 0.576910853f},
-std::array<float,2>{0.636820495f, 0.269038975f},
-std::array<float,2>{0.20840317f, 0.398314595f},
-std::array<float,2>{0.582612336f, 0.638069987f},
-std::array<float,2>{0.318518102f, 0.992025614f},
-std::array<float,2>{0.756708622f, 0.0212519132f},
-std::array<float,2>{0.297141373f, 0.332011253f},
-std::array<float,2>{0.874532104f, 0.543325901f},
-std::array<float,2>{0.157076731f, 0.798686564f},
-std::array<float,2>{0.549444437f, 0.197232768f},
-std::array<float,2>{0.067039296f, 0.0754061267f},
-std::array<float,2>{0.715975702f, 0.886593938f},
-std::array<float,2>{0.409766048f, 0.722705603f},
-std::array<float,2>{0.993460417f, 0.484552175f},
-std::array<float,2>{0.37425229f, 0.0588017106f},
-std::array<float,2>{0.81024313f, 0.967837989f},
-std::array<float,2>{0.239627838f, 0.677123427f},
-std::array<float,2>{0.604733169f, 0.409867942f},
-std::array<float,2>{0.0400166027f, 0.299057961f},
-std::array<float,2>{0.659419954f, 0.620058775f},
-std::array<float,2>{0.457974285f, 0.815127313f},
-std::array<float,2>{0.887051225f, 0.143007383f},
-std::array<float,2>{0.388662755f, 0.440954804f},
-std::array<float,2>{0.964986384f, 0.691407442f},
-std::array<float,2>{0.0951997861f, 0.934986711f},
-std::array<float,2>{0.732499242f, 0.110154197f},
-std::array<float,2>{0.14162159f, 0.223852307f},
-std::array<float,2>{0.509966612f, 0.766808808f},
-std::array<float,2>{0.278125763f, 0.517662704f},
-std::array<float,2>{0.837714732f, 0.362488121f},
-std::array<float,2>{0.4611426f, 0.0276884455f},
-std::array<float,2>{0.882407188f, 0.99772048f},
-std::array<float,2>{0.0362252593f, 0.631653786f},
-std::array<float,2>{0.671765864f, 0.405212015f},
-std::array<float,2>{0.245076016f, 0.280521989f},
-std::array<float,2>{0.601152062f, 0.56580162f},
-std::array<float,2>{0.364163756f, 0.865009427f},
-std::array<float,2>{0.804563642f, 0.156379491f},
-std::array<float,2>{0.270290583f, 0.497179717f},
-std::array<float,2>{0.828183889f, 0.732502997f},
-std::array<float,2>{0.150399089f, 0.878102839f},
-std::array<float,2>{0.50499022f, 0.0677236393f},
-std::array<float,2>{0.102125265f, 0.19052884f},
-std::array<float,2>{0.724298179f, 0.808738649f},
-std::array<float,2>{0.37586239f, 0.538718939f},
-std::array<float,2>{0.958016276f, 0.336046398f},
-std::array<float,2>{0.327852309f, 0.155510217f},
-std::array<float,2>{0.763475597f, 0.823251188f},
-std::array<float,2>{0.215609014f, 0.615692496f},
-std::array<float,2>{0.59300971f, 0.312338799f},
-std::array<float,2>{0.0306267813f, 0.421513528f},
-std::array<float,2>{0.627961516f, 0.684227467f},
-std::array<float,2>{0.499474138f, 0.956795156f},
-std::array<float,2>{0.929023743f, 0.0520958938f},
-std::array<float,2>{0.419709176f, 0.367431223f},
-std::array<float,2>{0.985768497f, 0.524839938f},
-std::array<float,2>{0.0751535445f, 0.774354696f},
-std::array<float,2>{0.70385313f, 0.231777415f},
-std::array<float,2>{0.164318308f, 0.124526784f},
-std::array<float,2>{0.557674289f, 0.922343314f},
-std::array<float,2>{0.31196177f, 0.69780004f},
-std::array<float,2>{0.865021467f, 0.451470613f},
-std::array<float,2>{0.402578652f, 0.243948027f},
-std::array<float,2>{0.945990384f, 0.762961268f},
-std::array<float,2>{0.111817911f, 0.512143016f},
-std::array<float,2>{0.747169375f, 0.350019038f},
-std::array<float,2>{0.134229109f, 0.457577467f},
-std::array<float,2>{0.525986314f, 0.718024433f},
-std::array<float,2>{0.262915254f, 0.919849038f},
-std::array<float,2>{0.8219257f, 0.0972995237f},
-std::array<float,2>{0.350741804f, 0.283343762f},
-std::array<float,2>{0.786156237f, 0.598304927f},
-std::array<float,2>{0.228126779f, 0.838444114f},
-std::array<float,2>{0.622867465f, 0.131272748f},
-std::array<float,2>{0.0566173643f, 0.0351604149f},
-std::array<float,2>{0.684100389f, 0.950578928f},
-std::array<float,2>{0.437915266f, 0.667383492f},
-std::array<float,2>{0.899317324f, 0.432901025f},
-std::array<float,2>{0.292795271f, 0.0862088501f},
-std::array<float,2>{0.849916518f, 0.903700292f},
-std::array<float,2>{0.179472297f, 0.73996675f},
-std::array<float,2>{0.544053435f, 0.481221437f},
-std::array<float,2>{0.0817807615f, 0.319960475f},
-std::array<float,2>{0.700065136f, 0.558374703f},
-std::array<float,2>{0.430057943f, 0.791949987f},
-std::array<float,2>{0.970949888f, 0.211179033f},
-std::array<float,2>{0.468836069f, 0.378595203f},
-std::array<float,2>{0.910508156f, 0.655665636f},
-std::array<float,2>{0.00468248175f, 0.979541302f},
-std::array<float,2>{0.647596061f, 0.00294320751f},
-std::array<float,2>{0.199134484f, 0.173356667f},
-std::array<float,2>{0.563661516f, 0.850662172f},
-std::array<float,2>{0.331644982f, 0.578568339f},
-std::array<float,2>{0.769755542f, 0.255717665f},
-std::array<float,2>{0.43605566f, 0.0579191856f},
-std::array<float,2>{0.972965717f, 0.96189934f},
-std::array<float,2>{0.0848278925f, 0.67485553f},
-std::array<float,2>{0.69582063f, 0.412512124f},
-std::array<float,2>{0.174486682f, 0.303830594f},
-std::array<float,2>{0.540632308f, 0.622202694f},
-std::array<float,2>{0.294101119f, 0.817972898f},
-std::array<float,2>{0.844342947f, 0.14826411f},
-std::array<float,2>{0.332196444f, 0.444170266f},
-std::array<float,2>{0.767072082f, 0.68846643f},
-std::array<float,2>{0.202360973f, 0.93319726f},
-std::array<float,2>{0.568276286f, 0.113454878f},
-std::array<float,2>{0.00300341332f, 0.220249057f},
-std::array<float,2>{0.644181788f, 0.769533873f},
-std::array<float,2>{0.473605484f, 0.519821286f},
-std::array<float,2>{0.909473538f, 0.363822788f},
-std::array<float,2>{0.259238183f, 0.170977965f},
-std::array<float,2>{0.824709892f, 0.869105875f},
-std::array<float,2>{0.140139759f, 0.571210444f},
-std::array<float,2>{0.531217337f, 0.269713253f},
-std::array<float,2>{0.116499566f, 0.390904069f},
-std::array<float,2>{0.744175673f, 0.634638906f},
-std::array<float,2>{0.40138036f, 0.987528265f},
-std::array<float,2>{0.949864507f, 0.019481685f},
-std::array<float,2>{0.4417319f, 0.332356095f},
-std::array<float,2>{0.903279245f, 0.54177624f},
-std::array<float,2>{0.0613413453f, 0.803998053f},
-std::array<float,2>{0.682758093f, 0.202981263f},
-std::array<float,2>{0.234087095f, 0.0715566278f},
-std::array<float,2>{0.620063961f, 0.888955057f},
-std::array<float,2>{0.345540673f, 0.720046163f},
-std::array<float,2>{0.783821225f, 0.489279419f},
-std::array<float,2>{0.493148267f, 0.208022386f},
-std::array<float,2>{0.924039721f, 0.785064757f},
-std::array<float,2>{0.0251225214f, 0.549455047f},
-std::array<float,2>{0.631841779f, 0.322822481f},
-std::array<float,2>{0.212253168f, 0.469088197f},
-std::array<float,2>{0.587906539f, 0.746480942f},
-std::array<float,2>{0.320956796f, 0.893187761f},
-std::array<float,2>{0.76122725f, 0.0799351186f},
-std::array<float,2>{0.308374494f, 0.263186842f},
-std::array<float,2>{0.861644924f, 0.589327335f},
-std::array<float,2>{0.1686932f, 0.855271757f},
-std::array<float,2>{0.560454547f, 0.181921348f},
-std::array<float,2>{0.0709495917f, 0.00947580207f},
-std::array<float,2>{0.708830655f, 0.974120796f},
-std::array<float,2>{0.417891264f, 0.644259989f},
-std::array<float,2>{0.990118623f, 0.384188622f},
-std::array<float,2>{0.360978067f, 0.105514511f},
-std::array<float,2>{0.797023833f, 0.910131991f},
-std::array<float,2>{0.249759749f, 0.705877125f},
-std::array<float,2>{0.594433665f, 0.466260493f},
-std::array<float,2>{0.0325212926f, 0.355891287f},
-std::array<float,2>{0.665681243f, 0.506823003f},
-std::array<float,2>{0.468114942f, 0.752117276f},
-std::array<float,2>{0.878295839f, 0.239711776f},
-std::array<float,2>{0.380359441f, 0.427366078f},
-std::array<float,2>{0.956492603f, 0.663659811f},
-std::array<float,2>{0.10620214f, 0.943710208f},
-std::array<float,2>{0.721256196f, 0.0390879698f},
-std::array<float,2>{0.152532324f, 0.133859485f},
-std::array<float,2>{0.503128648f, 0.82916528f},
-std::array<float,2>{0.268638164f, 0.601951599f},
-std::array<float,2>{0.834869146f, 0.290144473f},
-std::array<float,2>{0.455823541f, 0.0903225765f},
-std::array<float,2>{0.886143923f, 0.899328887f},
-std::array<float,2>{0.0454186983f, 0.73625201f},
-std::array<float,2>{0.662644506f, 0.480275631f},
-std::array<float,2>{0.236185759f, 0.315662056f},
-std::array<float,2>{0.608588159f, 0.558927119f},
-std::array<float,2>{0.371024191f, 0.795416951f},
-std::array<float,2>{0.804771304f, 0.216410831f},
-std::array<float,2>{0.274043471f, 0.380074948f},
-std::array<float,2>{0.84269774f, 0.651456833f},
-std::array<float,2>{0.146544814f, 0.981927752f},
-std::array<float,2>{0.512470007f, 0.00517252553f},
-std::array<float,2>{0.100285493f, 0.178964257f},
-std::array<float,2>{0.729613721f, 0.845495045f},
-std::array<float,2>{0.38519755f, 0.582514703f},
-std::array<float,2>{0.962795317f, 0.250837177f},
-std::array<float,2>{0.31468311f, 0.247122511f},
-std::array<float,2>{0.750323474f, 0.761663198f},
-std::array<float,2>{0.206284821f, 0.509620845f},
-std::array<float,2>{0.579738259f, 0.346754998f},
-std::array<float,2>{0.0221501552f, 0.455370158f},
-std::array<float,2>{0.632956803f, 0.712442696f},
-std::array<float,2>{0.490021586f, 0.915889323f},
-std::array<float,2>{0.934419096f, 0.0983937085f},
-std::array<float,2>{0.411808282f, 0.288321614f},
-std::array<float,2>{0.999569356f, 0.596739888f},
-std::array<float,2>{0.0651273504f, 0.840894401f},
-std::array<float,2>{0.711874962f, 0.126514331f},
-std::array<float,2>{0.161942065f, 0.0348196626f},
-std::array<float,2>{0.553941548f, 0.948225558f},
-std::array<float,2>{0.302434981f, 0.669304371f},
-std::array<float,2>{0.869461954f, 0.437053055f},
-std::array<float,2>{0.398390889f, 0.151710644f},
-std::array<float,2>{0.944441795f, 0.82468462f},
-std::array<float,2>{0.12301062f, 0.610792756f},
-std::array<float,2>{0.735867321f, 0.30782792f},
-std::array<float,2>{0.12875092f, 0.417362183f},
-std::array<float,2>{0.516187072f, 0.679741502f},
-std::array<float,2>{0.253702492f, 0.95898813f},
-std::array<float,2>{0.819580436f, 0.0502644405f},
-std::array<float,2>{0.354395986f, 0.373894602f},
-std::array<float,2>{0.792832136f, 0.528220117f},
-std::array<float,2>{0.219086006f, 0.778448582f},
-std::array<float,2>{0.612100363f, 0.229182541f},
-std::array<float,2>{0.0529584028f, 0.118494697f},
-std::array<float,2>{0.67367512f, 0.928992927f},
-std::array<float,2>{0.447295994f, 0.701577902f},
-std::array<float,2>{0.89504528f, 0.449011236f},
-std::array<float,2>{0.283079505f, 0.0238250028f},
-std::array<float,2>{0.855499864f, 0.993961215f},
-std::array<float,2>{0.185370445f, 0.625199616f},
-std::array<float,2>{0.538120866f, 0.400270492f},
-std::array<float,2>{0.0916748568f, 0.273975551f},
-std::array<float,2>{0.689905107f, 0.568815351f},
-std::array<float,2>{0.425309569f, 0.859726489f},
-std::array<float,2>{0.97776109f, 0.163003221f},
-std::array<float,2>{0.481520534f, 0.492628008f},
-std::array<float,2>{0.918931365f, 0.727983713f},
-std::array<float,2>{0.0142952064f, 0.878978789f},
-std::array<float,2>{0.648948789f, 0.0636702403f},
-std::array<float,2>{0.190922365f, 0.193586811f},
-std::array<float,2>{0.576003551f, 0.80725801f},
-std::array<float,2>{0.341270745f, 0.53428179f},
-std::array<float,2>{0.775419474f, 0.341137946f},
-std::array<float,2>{0.389885962f, 0.111117184f},
-std::array<float,2>{0.967478514f, 0.934071302f},
-std::array<float,2>{0.0974957049f, 0.69327569f},
-std::array<float,2>{0.731465101f, 0.439526856f},
-std::array<float,2>{0.143272698f, 0.361808121f},
-std::array<float,2>{0.508895755f, 0.519242346f},
-std::array<float,2>{0.280464917f, 0.766587079f},
-std::array<float,2>{0.838419914f, 0.22322242f},
-std::array<float,2>{0.372668117f, 0.408724964f},
-std::array<float,2>{0.811532319f, 0.676286161f},
-std::array<float,2>{0.241321728f, 0.96705842f},
-std::array<float,2>{0.602622032f, 0.0603691973f},
-std::array<float,2>{0.0422637351f, 0.144249216f},
-std::array<float,2>{0.657507658f, 0.816390932f},
-std::array<float,2>{0.460458666f, 0.620544195f},
-std::array<float,2>{0.889013469f, 0.299810529f},
-std::array<float,2>{0.299438655f, 0.195312992f},
-std::array<float,2>{0.872739553f, 0.797522426f},
-std::array<float,2>{0.158577383f, 0.54416877f},
-std::array<float,2>{0.548816741f, 0.330480844f},
-std::array<float,2>{0.0693261251f, 0.485409796f},
-std::array<float,2>{0.718254745f, 0.724123597f},
-std::array<float,2>{0.407734454f, 0.885582268f},
-std::array<float,2>{0.995090842f, 0.0743480697f},
-std::array<float,2>{0.484778136f, 0.268340826f},
-std::array<float,2>{0.932064533f, 0.577820063f},
-std::array<float,2>{0.0183145143f, 0.873776257f},
-std::array<float,2>{0.638803899f, 0.164807007f},
-std::array<float,2>{0.210458741f, 0.0198305771f},
-std::array<float,2>{0.584001005f, 0.990753412f},
-std::array<float,2>{0.31688574f, 0.637478232f},
-std::array<float,2>{0.754211366f, 0.396549255f},
-std::array<float,2>{0.452056497f, 0.185020655f},
-std::array<float,2>{0.893672884f, 0.857278109f},
-std::array<float,2>{0.0501679145f, 0.593482256f},
-std::array<float,2>{0.678473175f, 0.259663016f},
-std::array<float,2>{0.225002825f, 0.388822973f},
-std::array<float,2>{0.614915133f, 0.64556849f},
-std::array<float,2>{0.356300145f, 0.968905568f},
-std::array<float,2>{0.795042634f, 0.0144402469f},
-std::array<float,2>{0.256435752f, 0.326240093f},
-std::array<float,2>{0.815225422f, 0.554570496f},
-std::array<float,2>{0.132808834f, 0.787068307f},
-std::array<float,2>{0.519884109f, 0.206805333f},
-std::array<float,2>{0.118542776f, 0.0858416334f},
-std::array<float,2>{0.74045974f, 0.895191431f},
-std::array<float,2>{0.392364502f, 0.742487192f},
-std::array<float,2>{0.939921379f, 0.474181294f},
-std::array<float,2>{0.337759614f, 0.0441000126f},
-std::array<float,2>{0.777476192f, 0.940553129f},
-std::array<float,2>{0.194843575f, 0.658255935f},
-std::array<float,2>{0.571240366f, 0.425050735f},
-std::array<float,2>{0.0112756453f, 0.293168575f},
-std::array<float,2>{0.654707193f, 0.605580807f},
-std::array<float,2>{0.479326963f, 0.83389461f},
-std::array<float,2>{0.916002572f, 0.138724968f},
-std::array<float,2>{0.427859992f, 0.461951941f},
-std::array<float,2>{0.982799411f, 0.709256232f},
-std::array<float,2>{0.0868079811f, 0.910646856f},
-std::array<float,2>{0.693830013f, 0.104411304f},
-std::array<float,2>{0.18010281f, 0.235888094f},
-std::array<float,2>{0.533388436f, 0.754718244f},
-std::array<float,2>{0.287708342f, 0.503602266f},
-std::array<float,2>{0.852443099f, 0.353999346f},
-std::array<float,2>{0.471679091f, 0.00260275509f},
-std::array<float,2>{0.913320124f, 0.978737772f},
-std::array<float,2>{0.00618091272f, 0.655138552f},
-std::array<float,2>{0.646125138f, 0.377744764f},
-std::array<float,2>{0.195381343f, 0.254363418f},
-std::array<float,2>{0.564685524f, 0.579703212f},
-std::array<float,2>{0.328290105f, 0.850126743f},
-std::array<float,2>{0.772887766f, 0.172363237f},
-std::array<float,2>{0.29013291f, 0.482284337f},
-std::array<float,2>{0.848036706f, 0.738955855f},
-std::array<float,2>{0.176295415f, 0.902861655f},
-std::array<float,2>{0.546751976f, 0.0874987394f},
-std::array<float,2>{0.0793505237f, 0.212066188f},
-std::array<float,2>{0.702247977f, 0.792582214f},
-std::array<float,2>{0.432139784f, 0.556908309f},
-std::array<float,2>{0.970663428f, 0.319213867f},
-std::array<float,2>{0.348819137f, 0.13195917f},
-std::array<float,2>{0.788646996f, 0.839531422f},
-std::array<float,2>{0.230454594f, 0.599460542f},
-std::array<float,2>{0.623399556f, 0.284503609f},
-std::array<float,2>{0.0579327121f, 0.432578593f},
-std::array<float,2>{0.687368453f, 0.66682595f},
-std::array<float,2>{0.440531939f, 0.949948549f},
-std::array<float,2>{0.901546419f, 0.0367763788f},
-std::array<float,2>{0.405677408f, 0.351533949f},
-std::array<float,2>{0.94727546f, 0.512890399f},
-std::array<float,2>{0.111157924f, 0.762367606f},
-std::array<float,2>{0.748548031f, 0.242678553f},
-std::array<float,2>{0.135581419f, 0.0963061228f},
-std::array<float,2>{0.523977399f, 0.918725371f},
-std::array<float,2>{0.265386343f, 0.716979325f},
-std::array<float,2>{0.822896421f, 0.45831424f},
-std::array<float,2>{0.42132017f, 0.230536699f},
-std::array<float,2>{0.986568928f, 0.775017023f},
-std::array<float,2>{0.0764247626f, 0.524326503f},
-std::array<float,2>{0.706247509f, 0.368407428f},
-std::array<float,2>{0.167869076f, 0.453025609f},
-std::array<float,2>{0.555876076f, 0.698964596f},
-std::array<float,2>{0.308871031f, 0.922900021f},
-std::array<float,2>{0.867034197f, 0.123560578f},
-std::array<float,2>{0.325199842f, 0.310975879f},
-std::array<float,2>{0.763831079f, 0.616417229f},
-std::array<float,2>{0.218330055f, 0.822652638f},
-std::array<float,2>{0.590322912f, 0.155262381f},
-std::array<float,2>{0.0274967141f, 0.0517425984f},
-std::array<float,2>{0.625722647f, 0.955344677f},
-std::array<float,2>{0.496843845f, 0.684942544f},
-std::array<float,2>{0.927063167f, 0.42089051f},
-std::array<float,2>{0.273172647f, 0.0667599291f},
-std::array<float,2>{0.83180964f, 0.87787497f},
-std::array<float,2>{0.148497865f, 0.734174132f},
-std::array<float,2>{0.506440699f, 0.496683359f},
-std::array<float,2>{0.105222911f, 0.337045401f},
-std::array<float,2>{0.726442039f, 0.537705541f},
-std::array<float,2>{0.378197491f, 0.809979379f},
-std::array<float,2>{0.96080637f, 0.18981868f},
-std::array<float,2>{0.463849396f, 0.40578565f},
-std::array<float,2>{0.880470634f, 0.632246614f},
-std::array<float,2>{0.0373427719f, 0.996700346f},
-std::array<float,2>{0.669325054f, 0.0283752717f},
-std::array<float,2>{0.244129553f, 0.157607257f},
-std::array<float,2>{0.598306596f, 0.863768458f},
-std::array<float,2>{0.365292132f, 0.564967752f},
-std::array<float,2>{0.802670062f, 0.279330015f},
-std::array<float,2>{0.399185419f, 0.0165854078f},
-std::array<float,2>{0.951880157f, 0.985315561f},
-std::array<float,2>{0.113353215f, 0.636340618f},
-std::array<float,2>{0.742560208f, 0.393870711f},
-std::array<float,2>{0.137280673f, 0.272472501f},
-std::array<float,2>{0.527721941f, 0.57230711f},
-std::array<float,2>{0.259811997f, 0.869328678f},
-std::array<float,2>{0.826828182f, 0.168165073f},
-std::array<float,2>{0.346366107f, 0.492124081f},
-std::array<float,2>{0.781419575f, 0.721075237f},
-std::array<float,2>{0.23120296f, 0.888498425f},
-std::array<float,2>{0.619019926f, 0.0739373118f},
-std::array<float,2>{0.060378328f, 0.200772181f},
-std::array<float,2>{0.681174934f, 0.800788879f},
-std::array<float,2>{0.444201946f, 0.540226698f},
-std::array<float,2>{0.904676259f, 0.33543247f},
-std::array<float,2>{0.296043128f, 0.144823402f},
-std::array<float,2>{0.846932709f, 0.818958879f},
-std::array<float,2>{0.173060164f, 0.623090744f},
-std::array<float,2>{0.542837083f, 0.302203894f},
-std::array<float,2>{0.0836710483f, 0.41123873f},
-std::array<float,2>{0.697502971f, 0.672177076f},
-std::array<float,2>{0.433593839f, 0.964462876f},
-std::array<float,2>{0.976053536f, 0.0551834442f},
-std::array<float,2>{0.475281775f, 0.366441578f},
-std::array<float,2>{0.906636477f, 0.521782398f},
-std::array<float,2>{7.85257434e-05f, 0.772456884f},
-std::array<float,2>{0.640992701f, 0.221929491f},
-std::array<float,2>{0.200178832f, 0.11621692f},
-std::array<float,2>{0.569180429f, 0.931280315f},
-std::array<float,2>{0.333997905f, 0.691137493f},
-std::array<float,2>{0.76951021f, 0.442405462f},
-std::array<float,2>{0.466603816f, 0.240318239f},
-std::array<float,2>{0.875930667f, 0.751110375f},
-std::array<float,2>{0.034438163f, 0.505155802f},
-std::array<float,2>{0.667445421f, 0.358441234f},
-std::array<float,2>{0.247077763f, 0.467966378f},
-std::array<float,2>{0.596013904f, 0.704037726f},
-std::array<float,2>{0.363238275f, 0.907193601f},
-std::array<float,2>{0.800149024f, 0.107608862f},
-std::array<float,2>{0.267373979f, 0.292732984f},
-std::array<float,2>{0.832449198f, 0.604707837f},
-std::array<float,2>{0.155651271f, 0.831124485f},
-std::array<float,2>{0.500083387f, 0.136614799f},
-std::array<float,2>{0.109234303f, 0.0420371704f},
-std::array<float,2>{0.720438004f, 0.941512287f},
-std::array<float,2>{0.381235749f, 0.66177398f},
-std::array<float,2>{0.953531981f, 0.428822637f},
-std::array<float,2>{0.322677195f, 0.0815361887f},
-std::array<float,2>{0.759088933f, 0.891100824f},
-std::array<float,2>{0.213390186f, 0.74857235f},
-std::array<float,2>{0.585991502f, 0.470900744f},
-std::array<float,2>{0.0266658794f, 0.321449965f},
-std::array<float,2>{0.629047215f, 0.548635721f},
-std::array<float,2>{0.494576782f, 0.781514406f},
-std::array<float,2>{0.923721373f, 0.209903792f},
-std::array<float,2>{0.415974706f, 0.386269927f},
-std::array<float,2>{0.990502894f, 0.64210999f},
-std::array<float,2>{0.0729203671f, 0.976206541f},
-std::array<float,2>{0.709842265f, 0.00986855291f},
-std::array<float,2>{0.171472311f, 0.180550888f},
-std::array<float,2>{0.560591936f, 0.853157878f},
-std::array<float,2>{0.306292593f, 0.585946977f},
-std::array<float,2>{0.86102736f, 0.264288068f},
-std::array<float,2>{0.490476936f, 0.101077951f},
-std::array<float,2>{0.935749054f, 0.916573167f},
-std::array<float,2>{0.0202889461f, 0.713591695f},
-std::array<float,2>{0.634844184f, 0.454073131f},
-std::array<float,2>{0.203767613f, 0.343913287f},
-std::array<float,2>{0.581749022f, 0.509768963f},
-std::array<float,2>{0.313580424f, 0.75931859f},
-std::array<float,2>{0.753205955f, 0.24938044f},
-std::array<float,2>{0.304121524f, 0.434994191f},
-std::array<float,2>{0.868043244f, 0.669980049f},
-std::array<float,2>{0.163110226f, 0.946396828f},
-std::array<float,2>{0.551584482f, 0.0316621512f},
-std::array<float,2>{0.0643295497f, 0.128502622f},
-std::array<float,2>{0.714332223f, 0.842836678f},
-std::array<float,2>{0.413943082f, 0.595081031f},
-std::array<float,2>{0.996143222f, 0.286973119f},
-std::array<float,2>{0.36817047f, 0.218475983f},
-std::array<float,2>{0.808427155f, 0.793422043f},
-std::array<float,2>{0.23824878f, 0.561711729f},
-std::array<float,2>{0.606125951f, 0.312740952f},
-std::array<float,2>{0.0445459895f, 0.478344738f},
-std::array<float,2>{0.660477281f, 0.738223314f},
-std::array<float,2>{0.454199284f, 0.902184963f},
-std::array<float,2>{0.884242952f, 0.0934222341f},
-std::array<float,2>{0.383778363f, 0.2519961f},
-std::array<float,2>{0.964552522f, 0.585457206f},
-std::array<float,2>{0.0982151777f, 0.846920669f},
-std::array<float,2>{0.726642072f, 0.176827073f},
-std::array<float,2>{0.145445243f, 0.00627154345f},
-std::array<float,2>{0.514615536f, 0.983648121f},
-std::array<float,2>{0.277078718f, 0.649395704f},
-std::array<float,2>{0.840224624f, 0.382140875f},
-std::array<float,2>{0.422293633f, 0.160968304f},
-std::array<float,2>{0.979223251f, 0.862136304f},
-std::array<float,2>{0.0925368592f, 0.567171752f},
-std::array<float,2>{0.68851012f, 0.27704215f},
-std::array<float,2>{0.186076835f, 0.400494725f},
-std::array<float,2>{0.535183191f, 0.628886342f},
-std::array<float,2>{0.284309298f, 0.996015608f},
-std::array<float,2>{0.858905494f, 0.0267695971f},
-std::array<float,2>{0.343138754f, 0.342405111f},
-std::array<float,2>{0.773477912f, 0.532486141f},
-std::array<float,2>{0.18923302f, 0.806075931f},
-std::array<float,2>{0.577368736f, 0.191526756f},
-std::array<float,2>{0.0129656447f, 0.0651668534f},
-std::array<float,2>{0.650659084f, 0.881006896f},
-std::array<float,2>{0.482553959f, 0.730171263f},
-std::array<float,2>{0.921365976f, 0.495366216f},
-std::array<float,2>{0.251596212f, 0.0487991981f},
-std::array<float,2>{0.818295479f, 0.958926976f},
-std::array<float,2>{0.125020549f, 0.683092654f},
-std::array<float,2>{0.51921618f, 0.415316254f},
-std::array<float,2>{0.124028355f, 0.304842532f},
-std::array<float,2>{0.736519217f, 0.612820864f},
-std::array<float,2>{0.395309836f, 0.826787949f},
-std::array<float,2>{0.943163633f, 0.150163114f},
-std::array<float,2>{0.445797503f, 0.445869148f},
-std::array<float,2>{0.89662087f, 0.700926006f},
-std::array<float,2>{0.0511828139f, 0.926801264f},
-std::array<float,2>{0.674519122f, 0.120902181f},
-std::array<float,2>{0.221896335f, 0.227307305f},
-std::array<float,2>{0.61106056f, 0.780264616f},
-std::array<float,2>{0.35334453f, 0.530205309f},
-std::array<float,2>{0.790219069f, 0.371314317f},
-std::array<float,2>{0.408301502f, 0.0778721124f},
-std::array<float,2>{0.992499292f, 0.883526325f},
-std::array<float,2>{0.0677591115f, 0.725294173f},
-std::array<float,2>{0.715751231f, 0.488134146f},
-std::array<float,2>{0.157477021f, 0.330032051f},
-std::array<float,2>{0.550703704f, 0.546506464f},
-std::array<float,2>{0.298273653f, 0.800121546f},
-std::array<float,2>{0.873131752f, 0.198711634f},
-std::array<float,2>{0.3202416f, 0.396452785f},
-std::array<float,2>{0.757030547f, 0.638872743f},
-std::array<float,2>{0.207857877f, 0.990064383f},
-std::array<float,2>{0.583779633f, 0.0230823234f},
-std::array<float,2>{0.0174539629f, 0.166874602f},
-std::array<float,2>{0.638588369f, 0.872692585f},
-std::array<float,2>{0.486875415f, 0.574903011f},
-std::array<float,2>{0.930678785f, 0.266092449f},
-std::array<float,2>{0.278323114f, 0.226064086f},
-std::array<float,2>{0.836605787f, 0.768603683f},
-std::array<float,2>{0.140781447f, 0.5162009f},
-std::array<float,2>{0.511380136f, 0.360219002f},
-std::array<float,2>{0.0938159376f, 0.438826263f},
-std::array<float,2>{0.733483374f, 0.695013523f},
-std::array<float,2>{0.386893958f, 0.936818302f},
-std::array<float,2>{0.966533363f, 0.1118128f},
-std::array<float,2>{0.45863536f, 0.297221839f},
-std::array<float,2>{0.887992382f, 0.617881536f},
-std::array<float,2>{0.0408733748f, 0.812544405f},
-std::array<float,2>{0.658381283f, 0.14236109f},
-std::array<float,2>{0.238842174f, 0.0617175251f},
-std::array<float,2>{0.604351044f, 0.965362728f},
-std::array<float,2>{0.373419881f, 0.678476095f},
-std::array<float,2>{0.808611929f, 0.407943338f},
-std::array<float,2>{0.478133619f, 0.138464123f},
-std::array<float,2>{0.916475892f, 0.83485651f},
-std::array<float,2>{0.00885694474f, 0.609235466f},
-std::array<float,2>{0.65426749f, 0.295190334f},
-std::array<float,2>{0.19220224f, 0.423698545f},
-std::array<float,2>{0.573974371f, 0.658140123f},
-std::array<float,2>{0.339297324f, 0.937789679f},
-std::array<float,2>{0.781013906f, 0.0460173599f},
-std::array<float,2>{0.285557717f, 0.3525846f},
-std::array<float,2>{0.853581965f, 0.501858413f},
-std::array<float,2>{0.182061762f, 0.755970776f},
-std::array<float,2>{0.53167367f, 0.23694621f},
-std::array<float,2>{0.0881982967f, 0.102626547f},
-std::array<float,2>{0.692717731f, 0.913283527f},
-std::array<float,2>{0.426171094f, 0.707312584f},
-std::array<float,2>{0.980618477f, 0.463600993f},
-std::array<float,2>{0.358670652f, 0.0129800159f},
-std::array<float,2>{0.793452561f, 0.97091043f},
-std::array<float,2>{0.223501757f, 0.646647871f},
-std::array<float,2>{0.615405381f, 0.387780368f},
-std::array<float,2>{0.0477890521f, 0.261673987f},
-std::array<float,2>{0.676900566f, 0.590048015f},
-std::array<float,2>{0.451087475f, 0.858744621f},
-std::array<float,2>{0.891870737f, 0.186516374f},
-std::array<float,2>{0.393939555f, 0.476358086f},
-std::array<float,2>{0.93861407f, 0.745471716f},
-std::array<float,2>{0.120146729f, 0.898204863f},
-std::array<float,2>{0.739548683f, 0.0834417045f},
-std::array<float,2>{0.130493909f, 0.20502089f},
-std::array<float,2>{0.522717416f, 0.788456321f},
-std::array<float,2>{0.254330844f, 0.551511943f},
-std::array<float,2>{0.814451218f, 0.325613171f},
-std::array<float,2>{0.438625097f, 0.0389872864f},
-std::array<float,2>{0.900258899f, 0.952023745f},
-std::array<float,2>{0.0548087992f, 0.664534509f},
-std::array<float,2>{0.684603453f, 0.431624889f},
-std::array<float,2>{0.227159411f, 0.283049375f},
-std::array<float,2>{0.621872127f, 0.600443304f},
-std::array<float,2>{0.349644601f, 0.836942494f},
-std::array<float,2>{0.785622537f, 0.129487768f},
-std::array<float,2>{0.2622329f, 0.459669769f},
-std::array<float,2>{0.820347726f, 0.716235459f},
-std::array<float,2>{0.133413687f, 0.920235574f},
-std::array<float,2>{0.52694273f, 0.0947569683f},
-std::array<float,2>{0.112823747f, 0.244183734f},
-std::array<float,2>{0.747046232f, 0.765130162f},
-std::array<float,2>{0.40381071f, 0.514084578f},
-std::array<float,2>{0.94721359f, 0.348107249f},
-std::array<float,2>{0.330444992f, 0.174301401f},
-std::array<float,2>{0.7709378f, 0.847931087f},
-std::array<float,2>{0.197538927f, 0.580790937f},
-std::array<float,2>{0.562764168f, 0.257727534f},
-std::array<float,2>{0.00553895067f, 0.375590056f},
-std::array<float,2>{0.647349238f, 0.654058516f},
-std::array<float,2>{0.470486343f, 0.977533638f},
-std::array<float,2>{0.911920249f, 0.00155544328f},
-std::array<float,2>{0.431378901f, 0.31733796f},
-std::array<float,2>{0.971722245f, 0.555093586f},
-std::array<float,2>{0.0806192383f, 0.79096967f},
-std::array<float,2>{0.700331271f, 0.213767126f},
-std::array<float,2>{0.178096592f, 0.0883728042f},
-std::array<float,2>{0.543944776f, 0.905445993f},
-std::array<float,2>{0.291647434f, 0.740244448f},
-std::array<float,2>{0.850831211f, 0.483488768f},
-std::array<float,2>{0.376177162f, 0.189102575f},
-std::array<float,2>{0.957432687f, 0.811572492f},
-std::array<float,2>{0.103233799f, 0.535259843f},
-std::array<float,2>{0.723147988f, 0.338401914f},
-std::array<float,2>{0.151512638f, 0.499156505f},
-std::array<float,2>{0.504639149f, 0.730504334f},
-std::array<float,2>{0.271230698f, 0.875641167f},
-std::array<float,2>{0.829259753f, 0.0687654242f},
-std::array<float,2>{0.364832491f, 0.27906698f},
-std::array<float,2>{0.802793264f, 0.562709451f},
-std::array<float,2>{0.246075034f, 0.865600288f},
-std::array<float,2>{0.599991918f, 0.158722982f},
-std::array<float,2>{0.0358404294f, 0.0308242515f},
-std::array<float,2>{0.669986367f, 0.998746693f},
-std::array<float,2>{0.462237149f, 0.630138993f},
-std::array<float,2>{0.881637752f, 0.402350485f},
-std::array<float,2>{0.311370462f, 0.122038879f},
-std::array<float,2>{0.863597989f, 0.925719142f},
-std::array<float,2>{0.165226698f, 0.695536315f},
-std::array<float,2>{0.557493031f, 0.449578702f},
-std::array<float,2>{0.0759301037f, 0.369475216f},
-std::array<float,2>{0.704211712f, 0.527074516f},
-std::array<float,2>{0.418808728f, 0.776111484f},
-std::array<float,2>{0.984580815f, 0.232735574f},
-std::array<float,2>{0.498756468f, 0.419031382f},
-std::array<float,2>{0.928642511f, 0.686953545f},
-std::array<float,2>{0.0297856797f, 0.954044163f},
-std::array<float,2>{0.626966417f, 0.0536508262f},
-std::array<float,2>{0.216146186f, 0.154088885f},
-std::array<float,2>{0.59191972f, 0.820546269f},
-std::array<float,2>{0.326360285f, 0.61432153f},
-std::array<float,2>{0.762512624f, 0.309376299f},
-std::array<float,2>{0.406951845f, 0.0232388098f},
-std::array<float,2>{0.995135128f, 0.98983556f},
-std::array<float,2>{0.0700762868f, 0.639033675f},
-std::array<float,2>{0.717115343f, 0.39622587f},
-std::array<float,2>{0.159462199f, 0.265663832f},
-std::array<float,2>{0.546965957f, 0.575080395f},
-std::array<float,2>{0.300408751f, 0.872942448f},
-std::array<float,2>{0.871779859f, 0.16673784f},
-std::array<float,2>{0.317636669f, 0.487820923f},
-std::array<float,2>{0.755098462f, 0.725398004f},
-std::array<float,2>{0.209228143f, 0.883705497f},
-std::array<float,2>{0.585405886f, 0.0780432448f},
-std::array<float,2>{0.0189798716f, 0.198319703f},
-std::array<float,2>{0.639658153f, 0.800027788f},
-std::array<float,2>{0.485894114f, 0.546783626f},
-std::array<float,2>{0.932698846f, 0.32967931f},
-std::array<float,2>{0.279517382f, 0.142312184f},
-std::array<float,2>{0.839679956f, 0.81274426f},
-std::array<float,2>{0.144495457f, 0.618076622f},
-std::array<float,2>{0.508449495f, 0.297000587f},
-std::array<float,2>{0.0962845981f, 0.408067197f},
-std::array<float,2>{0.731199443f, 0.678268433f},
-std::array<float,2>{0.388804257f, 0.965790689f},
-std::array<float,2>{0.968508482f, 0.06200983f},
-std::array<float,2>{0.459067792f, 0.36007151f},
-std::array<float,2>{0.889820755f, 0.516475499f},
-std::array<float,2>{0.0411136076f, 0.768991292f},
-std::array<float,2>{0.656960905f, 0.225646079f},
-std::array<float,2>{0.241167739f, 0.111456864f},
-std::array<float,2>{0.602461517f, 0.936690748f},
-std::array<float,2>{0.371100932f, 0.695112526f},
-std::array<float,2>{0.811002731f, 0.438582212f},
-std::array<float,2>{0.48017323f, 0.237105146f},
-std::array<float,2>{0.914191425f, 0.756147861f},
-std::array<float,2>{0.00985987764f, 0.501672804f},
-std::array<float,2>{0.655960858f, 0.352787703f},
-std::array<float,2>{0.193871289f, 0.463810474f},
-std::array<float,2>{0.571471095f, 0.707239211f},
-std::array<float,2>{0.336298227f, 0.913373709f},
-std::array<float,2>{0.779169738f, 0.102815755f},
-std::array<float,2>{0.288711011f, 0.294945359f},
-std::array<float,2>{0.852993071f, 0.609069467f},
-std::array<float,2>{0.180935383f, 0.834515154f},
-std::array<float,2>{0.534573555f, 0.138187602f},
-std::array<float,2>{0.0872804523f, 0.0462096632f},
-std::array<float,2>{0.695274055f, 0.937624812f},
-std::array<float,2>{0.428817213f, 0.657880425f},
-std::array<float,2>{0.984198868f, 0.423482686f},
-std::array<float,2>{0.356995791f, 0.0830714479f},
-std::array<float,2>{0.796299994f, 0.89799881f},
-std::array<float,2>{0.226077005f, 0.745337665f},
-std::array<float,2>{0.613826752f, 0.476299375f},
-std::array<float,2>{0.0493480749f, 0.325248659f},
-std::array<float,2>{0.679672956f, 0.551643848f},
-std::array<float,2>{0.452874035f, 0.788149595f},
-std::array<float,2>{0.893552363f, 0.204691142f},
-std::array<float,2>{0.39064905f, 0.388043344f},
-std::array<float,2>{0.940551937f, 0.646896243f},
-std::array<float,2>{0.117507212f, 0.971155822f},
-std::array<float,2>{0.742182195f, 0.0128691318f},
-std::array<float,2>{0.131477371f, 0.186068863f},
-std::array<float,2>{0.520623207f, 0.858430147f},
-std::array<float,2>{0.256942511f, 0.590119243f},
-std::array<float,2>{0.815642893f, 0.26128453f},
-std::array<float,2>{0.440074414f, 0.0949824229f},
-std::array<float,2>{0.901042104f, 0.920075774f},
-std::array<float,2>{0.0571471825f, 0.715931177f},
-std::array<float,2>{0.686514378f, 0.459846348f},
-std::array<float,2>{0.229459316f, 0.347858548f},
-std::array<float,2>{0.62489742f, 0.51381284f},
-std::array<float,2>{0.348097324f, 0.764715612f},
-std::array<float,2>{0.787522793f, 0.2445288f},
-std::array<float,2>{0.263738394f, 0.431213021f},
-std::array<float,2>{0.823950887f, 0.664070904f},
-std::array<float,2>{0.136610001f, 0.951724768f},
-std::array<float,2>{0.525094628f, 0.0387672372f},
-std::array<float,2>{0.110047385f, 0.129640356f},
-std::array<float,2>{0.749956548f, 0.837332904f},
-std::array<float,2>{0.404672712f, 0.600230396f},
-std::array<float,2>{0.948621452f, 0.282861263f},
-std::array<float,2>{0.329806566f, 0.213513419f},
-std::array<float,2>{0.772169352f, 0.790755749f},
-std::array<float,2>{0.196533084f, 0.554722846f},
-std::array<float,2>{0.566064894f, 0.317077667f},
-std::array<float,2>{0.00688068662f, 0.483817846f},
-std::array<float,2>{0.645426035f, 0.740695536f},
-std::array<float,2>{0.471894592f, 0.905749023f},
-std::array<float,2>{0.912349641f, 0.0879747197f},
-std::array<float,2>{0.432670116f, 0.257374913f},
-std::array<float,2>{0.969484568f, 0.580830812f},
-std::array<float,2>{0.0781438351f, 0.847842216f},
-std::array<float,2>{0.702040434f, 0.173982397f},
-std::array<float,2>{0.177418262f, 0.00188777654f},
-std::array<float,2>{0.545886338f, 0.977258861f},
-std::array<float,2>{0.289525807f, 0.653945625f},
-std::array<float,2>{0.848816812f, 0.375786871f},
-std::array<float,2>{0.377219826f, 0.158948913f},
-std::array<float,2>{0.959256709f, 0.865419805f},
-std::array<float,2>{0.103798546f, 0.562828481f},
-std::array<float,2>{0.724958122f, 0.27885744f},
-std::array<float,2>{0.149471745f, 0.402739197f},
-std::array<float,2>{0.507381797f, 0.630087495f},
-std::array<float,2>{0.272308648f, 0.998836935f},
-std::array<float,2>{0.83084631f, 0.0310130231f},
-std::array<float,2>{0.366552323f, 0.338813186f},
-std::array<float,2>{0.80165863f, 0.535502911f},
-std::array<float,2>{0.242677569f, 0.811806679f},
-std::array<float,2>{0.598894596f, 0.189298317f},
-std::array<float,2>{0.0388362817f, 0.0685350448f},
-std::array<float,2>{0.66818881f, 0.875836253f},
-std::array<float,2>{0.464367896f, 0.730774462f},
-std::array<float,2>{0.879737914f, 0.499316454f},
-std::array<float,2>{0.310314268f, 0.0532231331f},
-std::array<float,2>{0.865610778f, 0.953780293f},
-std::array<float,2>{0.166228563f, 0.686722517f},
-std::array<float,2>{0.55505228f, 0.419425666f},
-std::array<float,2>{0.077561371f, 0.309181362f},
-std::array<float,2>{0.705672383f, 0.614713848f},
-std::array<float,2>{0.420490742f, 0.820800722f},
-std::array<float,2>{0.987475932f, 0.154037401f},
-std::array<float,2>{0.497708589f, 0.449421793f},
-std::array<float,2>{0.926230669f, 0.695578098f},
-std::array<float,2>{0.0289817713f, 0.92538166f},
-std::array<float,2>{0.625986397f, 0.121720247f},
-std::array<float,2>{0.217751116f, 0.232460827f},
-std::array<float,2>{0.591149032f, 0.776235998f},
-std::array<float,2>{0.324548364f, 0.527151108f},
-std::array<float,2>{0.764892519f, 0.369172454f},
-std::array<float,2>{0.400508195f, 0.0740563944f},
-std::array<float,2>{0.950229466f, 0.888210773f},
-std::array<float,2>{0.115728416f, 0.720736146f},
-std::array<float,2>{0.745240986f, 0.491794318f},
-std::array<float,2>{0.139584631f, 0.335044682f},
-std::array<float,2>{0.530082762f, 0.540503502f},
-std::array<float,2>{0.258509189f, 0.801263392f},
-std::array<float,2>{0.825652778f, 0.201055497f},
-std::array<float,2>{0.343851984f, 0.393608987f},
-std::array<float,2>{0.784778237f, 0.636670887f},
-std::array<float,2>{0.233344615f, 0.984870851f},
-std::array<float,2>{0.620204687f, 0.0163359921f},
-std::array<float,2>{0.0618548803f, 0.168454215f},
-std::array<float,2>{0.681836665f, 0.869434297f},
-std::array<float,2>{0.442560762f, 0.572630763f},
-std::array<float,2>{0.903594136f, 0.272902369f},
-std::array<float,2>{0.293321908f, 0.221816242f},
-std::array<float,2>{0.84505105f, 0.772064686f},
-std::array<float,2>{0.175474703f, 0.521654189f},
-std::array<float,2>{0.539630294f, 0.366621137f},
-std::array<float,2>{0.0857375935f, 0.44276467f},
-std::array<float,2>{0.696932673f, 0.691396654f},
-std::array<float,2>{0.436999917f, 0.931561887f},
-std::array<float,2>{0.974301279f, 0.116545387f},
-std::array<float,2>{0.474600583f, 0.301889718f},
-std::array<float,2>{0.90910393f, 0.623421848f},
-std::array<float,2>{0.00268009538f, 0.8193295f},
-std::array<float,2>{0.643071234f, 0.144745573f},
-std::array<float,2>{0.201795295f, 0.0554293022f},
-std::array<float,2>{0.566975117f, 0.964664698f},
-std::array<float,2>{0.333580166f, 0.671971917f},
-std::array<float,2>{0.766232073f, 0.411470264f},
-std::array<float,2>{0.46734035f, 0.13643536f},
-std::array<float,2>{0.877367437f, 0.831485808f},
-std::array<float,2>{0.0318563916f, 0.604926288f},
-std::array<float,2>{0.664519668f, 0.292648762f},
-std::array<float,2>{0.248577669f, 0.428999633f},
-std::array<float,2>{0.595612407f, 0.662087858f},
-std::array<float,2>{0.359937131f, 0.941741347f},
-std::array<float,2>{0.798152387f, 0.0422804393f},
-std::array<float,2>{0.268155545f, 0.358779579f},
-std::array<float,2>{0.835645854f, 0.50497967f},
-std::array<float,2>{0.153347999f, 0.75138706f},
-std::array<float,2>{0.501960635f, 0.240624949f},
-std::array<float,2>{0.106666572f, 0.10790652f},
-std::array<float,2>{0.721772909f, 0.906856894f},
-std::array<float,2>{0.379071295f, 0.703794956f},
-std::array<float,2>{0.955986738f, 0.468210191f},
-std::array<float,2>{0.321914017f, 0.0101817884f},
-std::array<float,2>{0.760269225f, 0.976505995f},
-std::array<float,2>{0.211198777f, 0.642506361f},
-std::array<float,2>{0.589040995f, 0.386704057f},
-std::array<float,2>{0.024141632f, 0.264421791f},
-std::array<float,2>{0.631544352f, 0.586252928f},
-std::array<float,2>{0.493371278f, 0.853484035f},
-std::array<float,2>{0.925052583f, 0.180221528f},
-std::array<float,2>{0.416729033f, 0.471047014f},
-std::array<float,2>{0.988417983f, 0.74902153f},
-std::array<float,2>{0.0715899616f, 0.890667677f},
-std::array<float,2>{0.70706147f, 0.0812833011f},
-std::array<float,2>{0.169236422f, 0.209568441f},
-std::array<float,2>{0.558977902f, 0.781372368f},
-std::array<float,2>{0.307600111f, 0.548346758f},
-std::array<float,2>{0.862703323f, 0.321599007f},
-std::array<float,2>{0.488310426f, 0.0313556306f},
-std::array<float,2>{0.935094357f, 0.946775019f},
-std::array<float,2>{0.02320089f, 0.670184672f},
-std::array<float,2>{0.634321809f, 0.434574485f},
-std::array<float,2>{0.20517461f, 0.286716312f},
-std::array<float,2>{0.578837991f, 0.59487921f},
-std::array<float,2>{0.315864205f, 0.843225002f},
-std::array<float,2>{0.751891375f, 0.128719985f},
-std::array<float,2>{0.301188648f, 0.453741938f},
-std::array<float,2>{0.870818496f, 0.713671863f},
-std::array<float,2>{0.161015347f, 0.916966438f},
-std::array<float,2>{0.552794993f, 0.101471551f},
-std::array<float,2>{0.0659537986f, 0.249264672f},
-std::array<float,2>{0.712462246f, 0.759708166f},
-std::array<float,2>{0.410300821f, 0.51017803f},
-std::array<float,2>{0.998496771f, 0.344134957f},
-std::array<float,2>{0.369426489f, 0.177237764f},
-std::array<float,2>{0.80612886f, 0.846932054f},
-std::array<float,2>{0.234820649f, 0.585810363f},
-std::array<float,2>{0.607991099f, 0.252409458f},
-std::array<float,2>{0.0460011065f, 0.381961942f},
-std::array<float,2>{0.663819969f, 0.64904964f},
-std::array<float,2>{0.456476659f, 0.983577609f},
-std::array<float,2>{0.885119021f, 0.00609836541f},
-std::array<float,2>{0.38630417f, 0.312852561f},
-std::array<float,2>{0.961821795f, 0.561770141f},
-std::array<float,2>{0.100699417f, 0.79317224f},
-std::array<float,2>{0.728905976f, 0.218696311f},
-std::array<float,2>{0.148166344f, 0.0937305838f},
-std::array<float,2>{0.512814462f, 0.901963413f},
-std::array<float,2>{0.275270164f, 0.737984598f},
-std::array<float,2>{0.843597889f, 0.47803542f},
-std::array<float,2>{0.424683303f, 0.191726863f},
-std::array<float,2>{0.976957977f, 0.805751443f},
-std::array<float,2>{0.089855209f, 0.532453418f},
-std::array<float,2>{0.690605879f, 0.342572391f},
-std::array<float,2>{0.184120744f, 0.495210975f},
-std::array<float,2>{0.537620783f, 0.730286241f},
-std::array<float,2>{0.2813178f, 0.881228745f},
-std::array<float,2>{0.85649848f, 0.0654174313f},
-std::array<float,2>{0.340588987f, 0.277120739f},
-std::array<float,2>{0.777218759f, 0.567017913f},
-std::array<float,2>{0.190365523f, 0.862009883f},
-std::array<float,2>{0.574518859f, 0.160749197f},
-std::array<float,2>{0.0149799511f, 0.0265920237f},
-std::array<float,2>{0.649497151f, 0.99572438f},
-std::array<float,2>{0.481092811f, 0.628565967f},
-std::array<float,2>{0.919452965f, 0.400845706f},
-std::array<float,2>{0.252068847f, 0.120827489f},
-std::array<float,2>{0.818915844f, 0.927039802f},
-std::array<float,2>{0.127381474f, 0.701131463f},
-std::array<float,2>{0.517510772f, 0.446078658f},
-std::array<float,2>{0.121265821f, 0.371489167f},
-std::array<float,2>{0.735060036f, 0.529895365f},
-std::array<float,2>{0.396875948f, 0.78001523f},
-std::array<float,2>{0.943705022f, 0.22707504f},
-std::array<float,2>{0.449111372f, 0.415206015f},
-std::array<float,2>{0.895658433f, 0.682829082f},
-std::array<float,2>{0.0543219894f, 0.958718061f},
-std::array<float,2>{0.672534347f, 0.0484528095f},
-std::array<float,2>{0.220040441f, 0.150136828f},
-std::array<float,2>{0.613246381f, 0.827038467f},
-std::array<float,2>{0.355357081f, 0.613174319f},
-std::array<float,2>{0.791892529f, 0.305038989f},
-std::array<float,2>{0.387711376f, 0.0600916632f},
-std::array<float,2>{0.965560079f, 0.966861546f},
-std::array<float,2>{0.0956310183f, 0.676725924f},
-std::array<float,2>{0.733188748f, 0.409123421f},
-std::array<float,2>{0.14228414f, 0.300196052f},
-std::array<float,2>{0.510647118f, 0.620266914f},
-std::array<float,2>{0.277650028f, 0.816025257f},
-std::array<float,2>{0.83733207f, 0.144455507f},
-std::array<float,2>{0.374701589f, 0.43990013f},
-std::array<float,2>{0.80973959f, 0.692946196f},
-std::array<float,2>{0.240232512f, 0.93375206f},
-std::array<float,2>{0.605415881f, 0.11106997f},
-std::array<float,2>{0.0394076779f, 0.223591238f},
-std::array<float,2>{0.659694433f, 0.766355872f},
-std::array<float,2>{0.457149386f, 0.519406497f},
-std::array<float,2>{0.8875947f, 0.361356258f},
-std::array<float,2>{0.297786176f, 0.164645195f},
-std::array<float,2>{0.874143183f, 0.873835683f},
-std::array<float,2>{0.156387106f, 0.577971876f},
-std::array<float,2>{0.549024343f, 0.268091649f},
-std::array<float,2>{0.0668499023f, 0.39693886f},
-std::array<float,2>{0.716675222f, 0.637214363f},
-std::array<float,2>{0.409380198f, 0.99107939f},
-std::array<float,2>{0.994015932f, 0.0195731167f},
-std::array<float,2>{0.487960666f, 0.330210686f},
-std::array<float,2>{0.930459261f, 0.544228196f},
-std::array<float,2>{0.0158215109f, 0.797842562f},
-std::array<float,2>{0.637628615f, 0.195607364f},
-std::array<float,2>{0.208874583f, 0.0746448189f},
-std::array<float,2>{0.582411706f, 0.885411501f},
-std::array<float,2>{0.318898976f, 0.724382877f},
-std::array<float,2>{0.755990624f, 0.485664129f},
-std::array<float,2>{0.449457705f, 0.206664786f},
-std::array<float,2>{0.890837729f, 0.786694765f},
-std::array<float,2>{0.0481698997f, 0.554332316f},
-std::array<float,2>{0.676056564f, 0.326586843f},
-std::array<float,2>{0.224517688f, 0.474472702f},
-std::array<float,2>{0.616420329f, 0.7423985f},
-std::array<float,2>{0.358247161f, 0.89539355f},
-std::array<float,2>{0.793971479f, 0.0856737569f},
-std::array<float,2>{0.255112916f, 0.259433866f},
-std::array<float,2>{0.812536061f, 0.593651175f},
-std::array<float,2>{0.129222959f, 0.857176304f},
-std::array<float,2>{0.522390425f, 0.184589639f},
-std::array<float,2>{0.119723782f, 0.0142751606f},
-std::array<float,2>{0.738507926f, 0.969110787f},
-std::array<float,2>{0.393498689f, 0.64583081f},
-std::array<float,2>{0.937890112f, 0.389005482f},
-std::array<float,2>{0.338295162f, 0.104205996f},
-std::array<float,2>{0.779841423f, 0.911100686f},
-std::array<float,2>{0.192675874f, 0.709132731f},
-std::array<float,2>{0.572307706f, 0.462393641f},
-std::array<float,2>{0.00809714012f, 0.353533864f},
-std::array<float,2>{0.653076589f, 0.5038324f},
-std::array<float,2>{0.477404684f, 0.754431307f},
-std::array<float,2>{0.917099714f, 0.236272424f},
-std::array<float,2>{0.427512258f, 0.424890429f},
-std::array<float,2>{0.981717348f, 0.658476055f},
-std::array<float,2>{0.0897184759f, 0.940761805f},
-std::array<float,2>{0.691545904f, 0.0443204455f},
-std::array<float,2>{0.183537915f, 0.139157534f},
-std::array<float,2>{0.532599807f, 0.833719075f},
-std::array<float,2>{0.28688547f, 0.60578084f},
-std::array<float,2>{0.855439603f, 0.293243259f},
-std::array<float,2>{0.469254136f, 0.0878882185f},
-std::array<float,2>{0.910746336f, 0.90311569f},
-std::array<float,2>{0.00393219246f, 0.739034891f},
-std::array<float,2>{0.648043931f, 0.482158303f},
-std::array<float,2>{0.198381454f, 0.318912983f},
-std::array<float,2>{0.564157248f, 0.55664748f},
-std::array<float,2>{0.331525296f, 0.792868018f},
-std::array<float,2>{0.77050525f, 0.2123667f},
-std::array<float,2>{0.291998863f, 0.377483994f},
-std::array<float,2>{0.850148857f, 0.654922485f},
-std::array<float,2>{0.178950444f, 0.978789806f},
-std::array<float,2>{0.544812202f, 0.00284551107f},
-std::array<float,2>{0.0814710706f, 0.172097698f},
-std::array<float,2>{0.699548483f, 0.850389659f},
-std::array<float,2>{0.43032822f, 0.580030084f},
-std::array<float,2>{0.971254408f, 0.25394696f},
-std::array<float,2>{0.351530939f, 0.243076608f},
-std::array<float,2>{0.787017643f, 0.762596846f},
-std::array<float,2>{0.227668554f, 0.513114691f},
-std::array<float,2>{0.622391284f, 0.351212353f},
-std::array<float,2>{0.0560783818f, 0.458124906f},
-std::array<float,2>{0.683739662f, 0.717146695f},
-std::array<float,2>{0.438295752f, 0.918527186f},
-std::array<float,2>{0.898485124f, 0.0966197178f},
-std::array<float,2>{0.402884036f, 0.284189284f},
-std::array<float,2>{0.945585847f, 0.599127054f},
-std::array<float,2>{0.111729242f, 0.839752495f},
-std::array<float,2>{0.747962415f, 0.132258281f},
-std::array<float,2>{0.13433063f, 0.037081562f},
-std::array<float,2>{0.525610805f, 0.950044274f},
-std::array<float,2>{0.263506919f, 0.666587591f},
-std::array<float,2>{0.821572721f, 0.432322472f},
-std::array<float,2>{0.41917187f, 0.154956162f},
-std::array<float,2>{0.9863168f, 0.822314978f},
-std::array<float,2>{0.0743102878f, 0.616571307f},
-std::array<float,2>{0.703424156f, 0.310701549f},
-std::array<float,2>{0.164827019f, 0.42062521f},
-std::array<float,2>{0.558552563f, 0.684793174f},
-std::array<float,2>{0.312390357f, 0.955267608f},
-std::array<float,2>{0.864723742f, 0.051391419f},
-std::array<float,2>{0.327622354f, 0.368541002f},
-std::array<float,2>{0.763084471f, 0.524074852f},
-std::array<float,2>{0.215112925f, 0.775166988f},
-std::array<float,2>{0.593634427f, 0.230910152f},
-std::array<float,2>{0.0308211334f, 0.123888008f},
-std::array<float,2>{0.628809035f, 0.923162043f},
-std::array<float,2>{0.499770522f, 0.699097633f},
-std::array<float,2>{0.929319441f, 0.452777386f},
-std::array<float,2>{0.269793093f, 0.0285978857f},
-std::array<float,2>{0.829032719f, 0.997035921f},
-std::array<float,2>{0.151231214f, 0.63193661f},
-std::array<float,2>{0.505836368f, 0.406018555f},
-std::array<float,2>{0.101562992f, 0.27962631f},
-std::array<float,2>{0.72394979f, 0.565260053f},
-std::array<float,2>{0.375312299f, 0.863289356f},
-std::array<float,2>{0.958640277f, 0.157278478f},
-std::array<float,2>{0.461720258f, 0.496881127f},
-std::array<float,2>{0.882309318f, 0.733929753f},
-std::array<float,2>{0.0368888192f, 0.877574265f},
-std::array<float,2>{0.671272993f, 0.0666073412f},
-std::array<float,2>{0.244492263f, 0.189649075f},
-std::array<float,2>{0.600839257f, 0.809574902f},
-std::array<float,2>{0.363625914f, 0.537965536f},
-std::array<float,2>{0.803715467f, 0.337335318f},
-std::array<float,2>{0.435293883f, 0.113767043f},
-std::array<float,2>{0.97554791f, 0.933469832f},
-std::array<float,2>{0.0830021203f, 0.688149512f},
-std::array<float,2>{0.698709309f, 0.443870515f},
-std::array<float,2>{0.172729313f, 0.364091873f},
-std::array<float,2>{0.541841567f, 0.519729018f},
-std::array<float,2>{0.295159221f, 0.769981205f},
-std::array<float,2>{0.846280634f, 0.22059001f},
-std::array<float,2>{0.335563242f, 0.412218392f},
-std::array<float,2>{0.767580569f, 0.675098121f},
-std::array<float,2>{0.200330585f, 0.96159482f},
-std::array<float,2>{0.57006526f, 0.057779789f},
-std::array<float,2>{0.00164335058f, 0.147975847f},
-std::array<float,2>{0.641618788f, 0.818234384f},
-std::array<float,2>{0.475895524f, 0.622448444f},
-std::array<float,2>{0.907929003f, 0.304053605f},
-std::array<float,2>{0.261587441f, 0.202692896f},
-std::array<float,2>{0.827586055f, 0.803949237f},
-std::array<float,2>{0.138194755f, 0.541737139f},
-std::array<float,2>{0.528373539f, 0.33225891f},
-std::array<float,2>{0.114807621f, 0.489685923f},
-std::array<float,2>{0.743827879f, 0.719736278f},
-std::array<float,2>{0.399977565f, 0.888828456f},
-std::array<float,2>{0.952491641f, 0.0714274198f},
-std::array<float,2>{0.445033699f, 0.269937754f},
-std::array<float,2>{0.905345142f, 0.570987523f},
-std::array<float,2>{0.0586676188f, 0.868731201f},
-std::array<float,2>{0.680100083f, 0.171291396f},
-std::array<float,2>{0.23216714f, 0.0190641973f},
-std::array<float,2>{0.617571235f, 0.987744927f},
-std::array<float,2>{0.347498149f, 0.634425581f},
-std::array<float,2>{0.78303057f, 0.390834987f},
-std::array<float,2>{0.495649725f, 0.181785092f},
-std::array<float,2>{0.922677398f, 0.855212271f},
-std::array<float,2>{0.0262514092f, 0.588955402f},
-std::array<float,2>{0.630226016f, 0.263647556f},
-std::array<float,2>{0.214460745f, 0.384025604f},
-std::array<float,2>{0.587820709f, 0.644292474f},
-std::array<float,2>{0.323781163f, 0.973828912f},
-std::array<float,2>{0.758588254f, 0.00954836514f},
-std::array<float,2>{0.305374205f, 0.323093176f},
-std::array<float,2>{0.859375656f, 0.549650252f},
-std::array<float,2>{0.170746863f, 0.784855843f},
-std::array<float,2>{0.561983585f, 0.208273277f},
-std::array<float,2>{0.073984094f, 0.0797648579f},
-std::array<float,2>{0.710464656f, 0.893537581f},
-std::array<float,2>{0.414882898f, 0.746287346f},
-std::array<float,2>{0.992106318f, 0.46887821f},
-std::array<float,2>{0.361436784f, 0.0394865535f},
-std::array<float,2>{0.798839211f, 0.943555355f},
-std::array<float,2>{0.246836975f, 0.663825631f},
-std::array<float,2>{0.597153902f, 0.427666187f},
-std::array<float,2>{0.0335953124f, 0.290404946f},
-std::array<float,2>{0.666519582f, 0.601562738f},
-std::array<float,2>{0.465557843f, 0.829510152f},
-std::array<float,2>{0.87664485f, 0.134087399f},
-std::array<float,2>{0.381869286f, 0.466015339f},
-std::array<float,2>{0.954742551f, 0.705661535f},
-std::array<float,2>{0.108308047f, 0.909682572f},
-std::array<float,2>{0.7190606f, 0.105713226f},
-std::array<float,2>{0.154301256f, 0.2394564f},
-std::array<float,2>{0.500996947f, 0.752230763f},
-std::array<float,2>{0.266171366f, 0.506534755f},
-std::array<float,2>{0.833584964f, 0.355598032f},
-std::array<float,2>{0.45380041f, 0.00490259379f},
-std::array<float,2>{0.883634806f, 0.981501818f},
-std::array<float,2>{0.043346379f, 0.651744545f},
-std::array<float,2>{0.661704898f, 0.380205989f},
-std::array<float,2>{0.236592531f, 0.250678301f},
-std::array<float,2>{0.606909394f, 0.582134128f},
-std::array<float,2>{0.367898077f, 0.84523052f},
-std::array<float,2>{0.806653559f, 0.178949162f},
-std::array<float,2>{0.276344299f, 0.480108649f},
-std::array<float,2>{0.841390014f, 0.735953033f},
-std::array<float,2>{0.145723566f, 0.899020433f},
-std::array<float,2>{0.515520453f, 0.0899041146f},
-std::array<float,2>{0.0987181291f, 0.216775969f},
-std::array<float,2>{0.728002191f, 0.79581672f},
-std::array<float,2>{0.383813649f, 0.558721423f},
-std::array<float,2>{0.963006675f, 0.315744638f},
-std::array<float,2>{0.313002288f, 0.126952961f},
-std::array<float,2>{0.752674818f, 0.841171801f},
-std::array<float,2>{0.204924062f, 0.59715122f},
-std::array<float,2>{0.58051157f, 0.288537592f},
-std::array<float,2>{0.0213513635f, 0.437319815f},
-std::array<float,2>{0.636394382f, 0.668960094f},
-std::array<float,2>{0.491988003f, 0.947958469f},
-std::array<float,2>{0.936714411f, 0.0349366516f},
-std::array<float,2>{0.412902385f, 0.347005129f},
-std::array<float,2>{0.997751832f, 0.509447694f},
-std::array<float,2>{0.0634012148f, 0.761456668f},
-std::array<float,2>{0.712952256f, 0.247551173f},
-std::array<float,2>{0.16279453f, 0.0981855541f},
-std::array<float,2>{0.552666187f, 0.915631592f},
-std::array<float,2>{0.303646147f, 0.712862134f},
-std::array<float,2>{0.868246496f, 0.455246389f},
-std::array<float,2>{0.3957133f, 0.22930114f},
-std::array<float,2>{0.94232899f, 0.778678358f},
-std::array<float,2>{0.12350098f, 0.52796036f},
-std::array<float,2>{0.737735629f, 0.373762518f},
-std::array<float,2>{0.126241311f, 0.44875291f},
-std::array<float,2>{0.518084705f, 0.701243043f},
-std::array<float,2>{0.250936538f, 0.928712606f},
-std::array<float,2>{0.816736579f, 0.118268117f},
-std::array<float,2>{0.351998091f, 0.307978094f},
-std::array<float,2>{0.789434314f, 0.610465944f},
-std::array<float,2>{0.221302509f, 0.824458241f},
-std::array<float,2>{0.609961152f, 0.151459277f},
-std::array<float,2>{0.0523330458f, 0.0498672351f},
-std::array<float,2>{0.675291538f, 0.959352851f},
-std::array<float,2>{0.446879327f, 0.68007493f},
-std::array<float,2>{0.897767127f, 0.417077661f},
-std::array<float,2>{0.283468544f, 0.0637709126f},
-std::array<float,2>{0.8575899f, 0.879284561f},
-std::array<float,2>{0.186558276f, 0.727653801f},
-std::array<float,2>{0.536479175f, 0.492370307f},
-std::array<float,2>{0.09290988f, 0.341035903f},
-std::array<float,2>{0.688143313f, 0.534606755f},
-std::array<float,2>{0.42299512f, 0.80753839f},
-std::array<float,2>{0.980309606f, 0.193732068f},
-std::array<float,2>{0.484260947f, 0.399946094f},
-std::array<float,2>{0.920759559f, 0.625377119f},
-std::array<float,2>{0.0119059226f, 0.993774831f},
-std::array<float,2>{0.652053416f, 0.0235386156f},
-std::array<float,2>{0.187692136f, 0.16281721f},
-std::array<float,2>{0.576350093f, 0.859601676f},
-std::array<float,2>{0.342464358f, 0.568464279f},
-std::array<float,2>{0.775244832f, 0.274377555f},
-std::array<float,2>{0.428597033f, 0.0432951376f},
-std::array<float,2>{0.982943773f, 0.940406621f},
-std::array<float,2>{0.0861893222f, 0.659755707f},
-std::array<float,2>{0.693866372f, 0.424363166f},
-std::array<float,2>{0.180379227f, 0.294369727f},
-std::array<float,2>{0.534047782f, 0.607285678f},
-std::array<float,2>{0.287201345f, 0.832316399f},
-std::array<float,2>{0.85166496f, 0.139725089f},
-std::array<float,2>{0.337041765f, 0.46140781f},
-std::array<float,2>{0.777926564f, 0.710743725f},
-std::array<float,2>{0.194625527f, 0.911243856f},
-std::array<float,2>{0.570747137f, 0.105055153f},
-std::array<float,2>{0.0111543452f, 0.234585837f},
-std::array<float,2>{0.655023038f, 0.755202711f},
-std::array<float,2>{0.478632092f, 0.502330244f},
-std::array<float,2>{0.915064752f, 0.354537368f},
-std::array<float,2>{0.256138653f, 0.184547514f},
-std::array<float,2>{0.814555049f, 0.856266677f},
-std::array<float,2>{0.131889641f, 0.591948926f},
-std::array<float,2>{0.520345628f, 0.25878796f},
-std::array<float,2>{0.118938953f, 0.390225559f},
-std::array<float,2>{0.741196394f, 0.644861162f},
-std::array<float,2>{0.3917647f, 0.97028321f},
-std::array<float,2>{0.940314651f, 0.0154284714f},
-std::array<float,2>{0.451481968f, 0.327319652f},
-std::array<float,2>{0.894519866f, 0.553163111f},
-std::array<float,2>{0.0503826514f, 0.785796702f},
-std::array<float,2>{0.677907825f, 0.205469921f},
-std::array<float,2>{0.22529085f, 0.0846783146f},
-std::array<float,2>{0.614582241f, 0.895667851f},
-std::array<float,2>{0.355952501f, 0.74363488f},
-std::array<float,2>{0.79559207f, 0.472752005f},
-std::array<float,2>{0.485044271f, 0.196849436f},
-std::array<float,2>{0.932575583f, 0.798348367f},
-std::array<float,2>{0.0176579244f, 0.543070257f},
-std::array<float,2>{0.639354885f, 0.331679702f},
-std::array<float,2>{0.210419714f, 0.484692991f},
-std::array<float,2>{0.584519207f, 0.722992003f},
-std::array<float,2>{0.317019761f, 0.886376679f},
-std::array<float,2>{0.754687428f, 0.0756254494f},
-std::array<float,2>{0.298995048f, 0.268787712f},
-std::array<float,2>{0.872320592f, 0.576705992f},
-std::array<float,2>{0.158949196f, 0.874725699f},
-std::array<float,2>{0.54824841f, 0.165896237f},
-std::array<float,2>{0.0684378147f, 0.0210226681f},
-std::array<float,2>{0.718383729f, 0.991719007f},
-std::array<float,2>{0.407590836f, 0.637912452f},
-std::array<float,2>{0.994330943f, 0.398111492f},
-std::array<float,2>{0.372300416f, 0.11004252f},
-std::array<float,2>{0.812340736f, 0.934710681f},
-std::array<float,2>{0.242135435f, 0.691696405f},
-std::array<float,2>{0.603408396f, 0.441215724f},
-std::array<float,2>{0.0425382778f, 0.362580717f},
-std::array<float,2>{0.657973111f, 0.517974675f},
-std::array<float,2>{0.460235626f, 0.767030299f},
-std::array<float,2>{0.889537334f, 0.224109411f},
-std::array<float,2>{0.390543222f, 0.40992415f},
-std::array<float,2>{0.966954112f, 0.676805079f},
-std::array<float,2>{0.0968632698f, 0.968046069f},
-std::array<float,2>{0.732276261f, 0.0590113513f},
-std::array<float,2>{0.142634392f, 0.142698944f},
-std::array<float,2>{0.50938791f, 0.815391243f},
-std::array<float,2>{0.280918658f, 0.619666338f},
-std::array<float,2>{0.837932944f, 0.29927057f},
-std::array<float,2>{0.463325322f, 0.0675984696f},
-std::array<float,2>{0.880084574f, 0.878370345f},
-std::array<float,2>{0.0377552472f, 0.732749879f},
-std::array<float,2>{0.669741392f, 0.497427195f},
-std::array<float,2>{0.243343458f, 0.33627522f},
-std::array<float,2>{0.598115742f, 0.538922668f},
-std::array<float,2>{0.365935028f, 0.808902383f},
-std::array<float,2>{0.801805079f, 0.190889746f},
-std::array<float,2>{0.272620112f, 0.404905796f},
-std::array<float,2>{0.831511259f, 0.631368041f},
-std::array<float,2>{0.149056271f, 0.998029232f},
-std::array<float,2>{0.506043613f, 0.027422782f},
-std::array<float,2>{0.104669861f, 0.156605899f},
-std::array<float,2>{0.726056695f, 0.864976466f},
-std::array<float,2>{0.378696203f, 0.565517128f},
-std::array<float,2>{0.960092068f, 0.280375898f},
-std::array<float,2>{0.32583946f, 0.231648326f},
-std::array<float,2>{0.764478385f, 0.773948252f},
-std::array<float,2>{0.217856184f, 0.52455169f},
-std::array<float,2>{0.590413809f, 0.367516935f},
-std::array<float,2>{0.0281574074f, 0.451241225f},
-std::array<float,2>{0.625063002f, 0.69822377f},
-std::array<float,2>{0.496540755f, 0.921886206f},
-std::array<float,2>{0.92766422f, 0.12476296f},
-std::array<float,2>{0.421575695f, 0.312126338f},
-std::array<float,2>{0.987244248f, 0.615253091f},
-std::array<float,2>{0.0767948478f, 0.823560476f},
-std::array<float,2>{0.706810415f, 0.15568395f},
-std::array<float,2>{0.167430252f, 0.0517889224f},
-std::array<float,2>{0.556200027f, 0.956688225f},
-std::array<float,2>{0.30948773f, 0.684524179f},
-std::array<float,2>{0.866419733f, 0.421664864f},
-std::array<float,2>{0.405858964f, 0.131055549f},
-std::array<float,2>{0.947774172f, 0.838763058f},
-std::array<float,2>{0.110587895f, 0.598486423f},
-std::array<float,2>{0.748517632f, 0.283494681f},
-std::array<float,2>{0.135238901f, 0.432838023f},
-std::array<float,2>{0.523784757f, 0.667031825f},
-std::array<float,2>{0.264744312f, 0.950384498f},
-std::array<float,2>{0.822722852f, 0.0355631374f},
-std::array<float,2>{0.349588871f, 0.349656492f},
-std::array<float,2>{0.788514256f, 0.511934519f},
-std::array<float,2>{0.229916394f, 0.762854755f},
-std::array<float,2>{0.623971045f, 0.243704557f},
-std::array<float,2>{0.0584138483f, 0.0974483043f},
-std::array<float,2>{0.686990559f, 0.919563055f},
-std::array<float,2>{0.441214234f, 0.718005538f},
-std::array<float,2>{0.901927292f, 0.457919955f},
-std::array<float,2>{0.290575087f, 0.00327452715f},
-std::array<float,2>{0.848232925f, 0.979879916f},
-std::array<float,2>{0.175856203f, 0.655332088f},
-std::array<float,2>{0.546149433f, 0.378760517f},
-std::array<float,2>{0.0798562914f, 0.255477339f},
-std::array<float,2>{0.702845812f, 0.57832998f},
-std::array<float,2>{0.431946754f, 0.851007819f},
-std::array<float,2>{0.969751298f, 0.173800364f},
-std::array<float,2>{0.471117496f, 0.481193453f},
-std::array<float,2>{0.913834929f, 0.740016937f},
-std::array<float,2>{0.00646267645f, 0.903393865f},
-std::array<float,2>{0.645624518f, 0.0859743804f},
-std::array<float,2>{0.1960724f, 0.211245626f},
-std::array<float,2>{0.56502676f, 0.79155153f},
-std::array<float,2>{0.328647733f, 0.558251917f},
-std::array<float,2>{0.77311331f, 0.320233941f},
-std::array<float,2>{0.380856037f, 0.106477313f},
-std::array<float,2>{0.95670557f, 0.909115493f},
-std::array<float,2>{0.105699196f, 0.706674457f},
-std::array<float,2>{0.720925152f, 0.464984357f},
-std::array<float,2>{0.15298669f, 0.356535077f},
-std::array<float,2>{0.503842413f, 0.507091343f},
-std::array<float,2>{0.269112468f, 0.753498554f},
-std::array<float,2>{0.834112406f, 0.238873452f},
-std::array<float,2>{0.360364527f, 0.426391155f},
-std::array<float,2>{0.79777199f, 0.662615597f},
-std::array<float,2>{0.249154791f, 0.944556057f},
-std::array<float,2>{0.593955338f, 0.0405671708f},
-std::array<float,2>{0.0329854451f, 0.133093923f},
-std::array<float,2>{0.665412307f, 0.828542113f},
-std::array<float,2>{0.468454331f, 0.603315413f},
-std::array<float,2>{0.878532112f, 0.289086103f},
-std::array<float,2>{0.307868659f, 0.207395613f},
-std::array<float,2>{0.861827791f, 0.783388853f},
-std::array<float,2>{0.168324545f, 0.550472736f},
-std::array<float,2>{0.559901357f, 0.323676437f},
-std::array<float,2>{0.0703144222f, 0.47015816f},
-std::array<float,2>{0.708245456f, 0.747375309f},
-std::array<float,2>{0.4173747f, 0.893782973f},
-std::array<float,2>{0.989650428f, 0.0782146901f},
-std::array<float,2>{0.49237445f, 0.262222081f},
-std::array<float,2>{0.924646556f, 0.58807081f},
-std::array<float,2>{0.0244980864f, 0.854419589f},
-std::array<float,2>{0.632463872f, 0.183427155f},
-std::array<float,2>{0.212621719f, 0.00819766894f},
-std::array<float,2>{0.588864207f, 0.973212123f},
-std::array<float,2>{0.320782572f, 0.643024266f},
-std::array<float,2>{0.761603653f, 0.383454263f},
-std::array<float,2>{0.442228734f, 0.170734346f},
-std::array<float,2>{0.902494788f, 0.867916048f},
-std::array<float,2>{0.0605546832f, 0.572005808f},
-std::array<float,2>{0.683392406f, 0.270869404f},
-std::array<float,2>{0.233503342f, 0.392490566f},
-std::array<float,2>{0.619307458f, 0.633724749f},
-std::array<float,2>{0.345200449f, 0.986625195f},
-std::array<float,2>{0.783544898f, 0.0181092285f},
-std::array<float,2>{0.259377539f, 0.333723962f},
-std::array<float,2>{0.824416459f, 0.542529047f},
-std::array<float,2>{0.139942676f, 0.802945733f},
-std::array<float,2>{0.530572712f, 0.201274976f},
-std::array<float,2>{0.116925374f, 0.0712645724f},
-std::array<float,2>{0.744701445f, 0.890425324f},
-std::array<float,2>{0.40193975f, 0.719277501f},
-std::array<float,2>{0.949345648f, 0.488962084f},
-std::array<float,2>{0.332549959f, 0.0571820848f},
-std::array<float,2>{0.7673347f, 0.96283263f},
-std::array<float,2>{0.202886626f, 0.673978925f},
-std::array<float,2>{0.567648232f, 0.413735241f},
-std::array<float,2>{0.00387193495f, 0.303462446f},
-std::array<float,2>{0.643998623f, 0.621752143f},
-std::array<float,2>{0.472938299f, 0.816866934f},
-std::array<float,2>{0.90983218f, 0.147227153f},
-std::array<float,2>{0.435786933f, 0.444685787f},
-std::array<float,2>{0.973532081f, 0.688851953f},
-std::array<float,2>{0.0840162635f, 0.931658864f},
-std::array<float,2>{0.695644021f, 0.114917397f},
-std::array<float,2>{0.174257427f, 0.218992874f},
-std::array<float,2>{0.540088534f, 0.770812869f},
-std::array<float,2>{0.294567168f, 0.520542622f},
-std::array<float,2>{0.844034612f, 0.3646245f},
-std::array<float,2>{0.482215136f, 0.0247989614f},
-std::array<float,2>{0.918152988f, 0.993010581f},
-std::array<float,2>{0.0140128369f, 0.626949251f},
-std::array<float,2>{0.648831904f, 0.398595333f},
-std::array<float,2>{0.190624207f, 0.274882555f},
-std::array<float,2>{0.575353682f, 0.569680691f},
-std::array<float,2>{0.341776729f, 0.860906959f},
-std::array<float,2>{0.776203215f, 0.163803816f},
-std::array<float,2>{0.282618552f, 0.493555397f},
-std::array<float,2>{0.856226265f, 0.72749877f},
-std::array<float,2>{0.184983939f, 0.880014777f},
-std::array<float,2>{0.53883034f, 0.0629610047f},
-std::array<float,2>{0.090993695f, 0.195195407f},
-std::array<float,2>{0.690253854f, 0.808042228f},
-std::array<float,2>{0.425150096f, 0.533744633f},
-std::array<float,2>{0.978234053f, 0.340444356f},
-std::array<float,2>{0.353614181f, 0.150470912f},
-std::array<float,2>{0.792114258f, 0.825733066f},
-std::array<float,2>{0.219655454f, 0.609411895f},
-std::array<float,2>{0.611712933f, 0.307090789f},
-std::array<float,2>{0.0533991084f, 0.416188747f},
-std::array<float,2>{0.673241377f, 0.6809901f},
-std::array<float,2>{0.447755396f, 0.960496962f},
-std::array<float,2>{0.894629717f, 0.0492159911f},
-std::array<float,2>{0.397815973f, 0.374438256f},
-std::array<float,2>{0.944975853f, 0.528445661f},
-std::array<float,2>{0.122332714f, 0.777560234f},
-std::array<float,2>{0.735491335f, 0.229724616f},
-std::array<float,2>{0.128410339f, 0.117596477f},
-std::array<float,2>{0.516097605f, 0.928468049f},
-std::array<float,2>{0.253109276f, 0.702154934f},
-std::array<float,2>{0.819984257f, 0.44794023f},
-std::array<float,2>{0.411167115f, 0.24688679f},
-std::array<float,2>{0.999278665f, 0.760386825f},
-std::array<float,2>{0.0646751374f, 0.507888079f},
-std::array<float,2>{0.711390138f, 0.346472234f},
-std::array<float,2>{0.161523819f, 0.456223905f},
-std::array<float,2>{0.554653108f, 0.711455166f},
-std::array<float,2>{0.301893741f, 0.914722383f},
-std::array<float,2>{0.870033622f, 0.0989250168f},
-std::array<float,2>{0.315409929f, 0.28769663f},
-std::array<float,2>{0.750523686f, 0.595853984f},
-std::array<float,2>{0.206810415f, 0.839917064f},
-std::array<float,2>{0.579575181f, 0.125518367f},
-std::array<float,2>{0.0219175238f, 0.0339890085f},
-std::array<float,2>{0.63337338f, 0.949205756f},
-std::array<float,2>{0.489346772f, 0.668138027f},
-std::array<float,2>{0.933720946f, 0.436271489f},
-std::array<float,2>{0.273611337f, 0.0917134136f},
-std::array<float,2>{0.84186703f, 0.900279999f},
-std::array<float,2>{0.147257999f, 0.735142529f},
-std::array<float,2>{0.511867583f, 0.47889939f},
-std::array<float,2>{0.100037806f, 0.314650476f},
-std::array<float,2>{0.730263591f, 0.559907794f},
-std::array<float,2>{0.385640919f, 0.796749294f},
-std::array<float,2>{0.962119281f, 0.215171784f},
-std::array<float,2>{0.455178231f, 0.379120052f},
-std::array<float,2>{0.886414528f, 0.651001394f},
-std::array<float,2>{0.0452834517f, 0.98080492f},
-std::array<float,2>{0.662374377f, 0.0039784559f},
-std::array<float,2>{0.235439971f, 0.178624272f},
-std::array<float,2>{0.609215915f, 0.844602466f},
-std::array<float,2>{0.37040028f, 0.583724022f},
-std::array<float,2>{0.805393755f, 0.251244962f},
-std::array<float,2>{0.394154012f, 0.01258511f},
-std::array<float,2>{0.939034224f, 0.97195977f},
-std::array<float,2>{0.120933004f, 0.647701442f},
-std::array<float,2>{0.740204275f, 0.387450039f},
-std::array<float,2>{0.129887462f, 0.259777963f},
-std::array<float,2>{0.52305752f, 0.590830743f},
-std::array<float,2>{0.254779458f, 0.857988298f},
-std::array<float,2>{0.813712001f, 0.187365159f},
-std::array<float,2>{0.359278738f, 0.475260377f},
-std::array<float,2>{0.793821514f, 0.74496156f},
-std::array<float,2>{0.222788006f, 0.896965504f},
-std::array<float,2>{0.616037965f, 0.0821962357f},
-std::array<float,2>{0.0470307507f, 0.203830168f},
-std::array<float,2>{0.677445054f, 0.78723526f},
-std::array<float,2>{0.450624019f, 0.551779091f},
-std::array<float,2>{0.892292976f, 0.324663609f},
-std::array<float,2>{0.286112905f, 0.137159199f},
-std::array<float,2>{0.854246318f, 0.835211217f},
-std::array<float,2>{0.182460457f, 0.607690394f},
-std::array<float,2>{0.532000601f, 0.296000093f},
-std::array<float,2>{0.0885091349f, 0.422101945f},
-std::array<float,2>{0.692974389f, 0.657194316f},
-std::array<float,2>{0.426570535f, 0.938479424f},
-std::array<float,2>{0.981279075f, 0.0455520973f},
-std::array<float,2>{0.478017867f, 0.352457762f},
-std::array<float,2>{0.91697818f, 0.500200629f},
-std::array<float,2>{0.0095585715f, 0.757476985f},
-std::array<float,2>{0.653557718f, 0.23815611f},
-std::array<float,2>{0.191607803f, 0.102509126f},
-std::array<float,2>{0.573443353f, 0.912991703f},
-std::array<float,2>{0.339415431f, 0.70890373f},
-std::array<float,2>{0.780388355f, 0.464755893f},
-std::array<float,2>{0.458373696f, 0.224915087f},
-std::array<float,2>{0.888605595f, 0.767713308f},
-std::array<float,2>{0.040118631f, 0.516942084f},
-std::array<float,2>{0.659147501f, 0.360944241f},
-std::array<float,2>{0.238345787f, 0.438120097f},
-std::array<float,2>{0.60365504f, 0.693532407f},
-std::array<float,2>{0.373554528f, 0.936142623f},
-std::array<float,2>{0.809554935f, 0.112361878f},
-std::array<float,2>{0.278899431f, 0.298323333f},
-std::array<float,2>{0.83596313f, 0.618629277f},
-std::array<float,2>{0.141184717f, 0.814240158f},
-std::array<float,2>{0.510776579f, 0.141058818f},
-std::array<float,2>{0.0944788307f, 0.06059286f},
-std::array<float,2>{0.734155715f, 0.966452003f},
-std::array<float,2>{0.38723734f, 0.67960763f},
-std::array<float,2>{0.966274679f, 0.407003343f},
-std::array<float,2>{0.319452822f, 0.0761941671f},
-std::array<float,2>{0.757683456f, 0.884094954f},
-std::array<float,2>{0.207132056f, 0.725982726f},
-std::array<float,2>{0.583342671f, 0.486600369f},
-std::array<float,2>{0.017076686f, 0.328425348f},
-std::array<float,2>{0.638124108f, 0.544927835f},
-std::array<float,2>{0.486335456f, 0.799310982f},
-std::array<float,2>{0.931242287f, 0.197458625f},
-std::array<float,2>{0.4087919f, 0.394735873f},
-std::array<float,2>{0.992927194f, 0.640236437f},
-std::array<float,2>{0.0681986585f, 0.988418162f},
-std::array<float,2>{0.715090156f, 0.0219393391f},
-std::array<float,2>{0.157997146f, 0.16732274f},
-std::array<float,2>{0.549888849f, 0.871365666f},
-std::array<float,2>{0.29840222f, 0.575615466f},
-std::array<float,2>{0.873875737f, 0.267247766f},
-std::array<float,2>{0.498427838f, 0.122289129f},
-std::array<float,2>{0.927866817f, 0.92466253f},
-std::array<float,2>{0.0296330433f, 0.69716835f},
-std::array<float,2>{0.627542436f, 0.450796098f},
-std::array<float,2>{0.216669664f, 0.370172441f},
-std::array<float,2>{0.592596412f, 0.525739551f},
-std::array<float,2>{0.326906592f, 0.777225196f},
-std::array<float,2>{0.761768222f, 0.233487487f},
-std::array<float,2>{0.310945064f, 0.418489099f},
-std::array<float,2>{0.8638376f, 0.68648988f},
-std::array<float,2>{0.165860459f, 0.954623342f},
-std::array<float,2>{0.556962788f, 0.0546431504f},
-std::array<float,2>{0.0756131932f, 0.153191119f},
-std::array<float,2>{0.704916894f, 0.822171032f},
-std::array<float,2>{0.418430716f, 0.613872886f},
-std::array<float,2>{0.984925985f, 0.309734076f},
-std::array<float,2>{0.364325732f, 0.187582463f},
-std::array<float,2>{0.803542912f, 0.810557008f},
-std::array<float,2>{0.245562643f, 0.536438525f},
-std::array<float,2>{0.600499213f, 0.339462519f},
-std::array<float,2>{0.0354396552f, 0.498564661f},
-std::array<float,2>{0.67078042f, 0.731834054f},
-std::array<float,2>{0.462628454f, 0.876353264f},
-std::array<float,2>{0.881050289f, 0.070287928f},
-std::array<float,2>{0.376810044f, 0.278171688f},
-std::array<float,2>{0.957558632f, 0.563995779f},
-std::array<float,2>{0.102566905f, 0.866648793f},
-std::array<float,2>{0.722688317f, 0.159358889f},
-std::array<float,2>{0.152094766f, 0.0296792388f},
-std::array<float,2>{0.504189789f, 0.999681175f},
-std::array<float,2>{0.270918846f, 0.629152834f},
-std::array<float,2>{0.83000052f, 0.403989762f},
-std::array<float,2>{0.431102663f, 0.175153971f},
-std::array<float,2>{0.972319126f, 0.848647118f},
-std::array<float,2>{0.0805425644f, 0.581224918f},
-std::array<float,2>{0.700878322f, 0.256157428f},
-std::array<float,2>{0.178285584f, 0.376573265f},
-std::array<float,2>{0.543024898f, 0.653093755f},
-std::array<float,2>{0.291115463f, 0.977591872f},
-std::array<float,2>{0.851087928f, 0.000510878803f},
-std::array<float,2>{0.330640316f, 0.318058044f},
-std::array<float,2>{0.771431386f, 0.555725396f},
-std::array<float,2>{0.198086873f, 0.789169192f},
-std::array<float,2>{0.563096523f, 0.214666769f},
-std::array<float,2>{0.0051013045f, 0.0892129242f},
-std::array<float,2>{0.646890521f, 0.904418468f},
-std::array<float,2>{0.469784051f, 0.741619289f},
-std::array<float,2>{0.911361754f, 0.483290821f},
-std::array<float,2>{0.261927903f, 0.0372280851f},
-std::array<float,2>{0.821209908f, 0.952564418f},
-std::array<float,2>{0.132944942f, 0.665247798f},
-std::array<float,2>{0.52662921f, 0.430580318f},
-std::array<float,2>{0.112411425f, 0.281426996f},
-std::array<float,2>{0.746331453f, 0.601140916f},
-std::array<float,2>{0.403616875f, 0.836671948f},
-std::array<float,2>{0.946632087f, 0.130226076f},
-std::array<float,2>{0.439127147f, 0.460567594f},
-std::array<float,2>{0.899618447f, 0.715450108f},
-std::array<float,2>{0.0552524664f, 0.920924008f},
-std::array<float,2>{0.68518424f, 0.0942523032f},
-std::array<float,2>{0.226672158f, 0.245789677f},
-std::array<float,2>{0.621321082f, 0.763928831f},
-std::array<float,2>{0.350472242f, 0.515348613f},
-std::array<float,2>{0.785953581f, 0.348888516f},
-std::array<float,2>{0.415343583f, 0.0805780515f},
-std::array<float,2>{0.99082607f, 0.891965985f},
-std::array<float,2>{0.0726499557f, 0.749248564f},
-std::array<float,2>{0.709115505f, 0.472224563f},
-std::array<float,2>{0.171070486f, 0.320954263f},
-std::array<float,2>{0.561317325f, 0.547157526f},
-std::array<float,2>{0.305967957f, 0.782516539f},
-std::array<float,2>{0.860355735f, 0.210473061f},
-std::array<float,2>{0.32287696f, 0.385253072f},
-std::array<float,2>{0.759746373f, 0.641518354f},
-std::array<float,2>{0.213048667f, 0.974853694f},
-std::array<float,2>{0.58651787f, 0.0113287913f},
-std::array<float,2>{0.0269675851f, 0.18107754f},
-std::array<float,2>{0.62964493f, 0.85158962f},
-std::array<float,2>{0.494776487f, 0.58704406f},
-std::array<float,2>{0.92315495f, 0.265022904f},
-std::array<float,2>{0.266747624f, 0.241599813f},
-std::array<float,2>{0.832878411f, 0.750526547f},
-std::array<float,2>{0.156212419f, 0.5045259f},
-std::array<float,2>{0.500650942f, 0.358186722f},
-std::array<float,2>{0.10853786f, 0.467699617f},
-std::array<float,2>{0.720194638f, 0.704991639f},
-std::array<float,2>{0.381589204f, 0.907655716f},
-std::array<float,2>{0.95391041f, 0.109055623f},
-std::array<float,2>{0.465896696f, 0.291683853f},
-std::array<float,2>{0.875447989f, 0.604410589f},
-std::array<float,2>{0.0347682014f, 0.830597579f},
-std::array<float,2>{0.667683721f, 0.1348304f},
-std::array<float,2>{0.247814417f, 0.0413007438f},
-std::array<float,2>{0.596648157f, 0.943180203f},
-std::array<float,2>{0.36262387f, 0.660283983f},
-std::array<float,2>{0.800400734f, 0.428383857f},
-std::array<float,2>{0.474766046f, 0.146288812f},
-std::array<float,2>{0.90707314f, 0.819421828f},
-std::array<float,2>{0.000659025682f, 0.624781787f},
-std::array<float,2>{0.641485751f, 0.300895661f},
-std::array<float,2>{0.199392661f, 0.410761237f},
-std::array<float,2>{0.568601012f, 0.673467994f},
-std::array<float,2>{0.334944874f, 0.963309884f},
-std::array<float,2>{0.769025326f, 0.0557473786f},
-std::array<float,2>{0.296860039f, 0.365729034f},
-std::array<float,2>{0.847461581f, 0.522628844f},
-std::array<float,2>{0.173749134f, 0.773424804f},
-std::array<float,2>{0.542279065f, 0.22133258f},
-std::array<float,2>{0.0832997635f, 0.115883239f},
-std::array<float,2>{0.697917223f, 0.929725647f},
-std::array<float,2>{0.434477866f, 0.690031767f},
-std::array<float,2>{0.976358652f, 0.442232817f},
-std::array<float,2>{0.346005619f, 0.0168550629f},
-std::array<float,2>{0.782166421f, 0.985388219f},
-std::array<float,2>{0.230868876f, 0.635256648f},
-std::array<float,2>{0.618253112f, 0.393193394f},
-std::array<float,2>{0.0598648004f, 0.272129923f},
-std::array<float,2>{0.68088913f, 0.573487043f},
-std::array<float,2>{0.443814397f, 0.870867431f},
-std::array<float,2>{0.905164897f, 0.169110119f},
-std::array<float,2>{0.398679525f, 0.490253031f},
-std::array<float,2>{0.951223373f, 0.721947193f},
-std::array<float,2>{0.113921508f, 0.887452126f},
-std::array<float,2>{0.743028164f, 0.0727745146f},
-std::array<float,2>{0.136776492f, 0.19924669f},
-std::array<float,2>{0.527933478f, 0.802276731f},
-std::array<float,2>{0.260695249f, 0.539711356f},
-std::array<float,2>{0.826656997f, 0.334072202f},
-std::array<float,2>{0.446003348f, 0.0474083051f},
-std::array<float,2>{0.897072673f, 0.957466781f},
-std::array<float,2>{0.0516371019f, 0.682480633f},
-std::array<float,2>{0.674056411f, 0.414763063f},
-std::array<float,2>{0.222356379f, 0.306044608f},
-std::array<float,2>{0.610761583f, 0.611746132f},
-std::array<float,2>{0.352635264f, 0.828008771f},
-std::array<float,2>{0.790671885f, 0.149097204f},
-std::array<float,2>{0.251222104f, 0.447251797f},
-std::array<float,2>{0.817581534f, 0.699756205f},
-std::array<float,2>{0.125898212f, 0.925825298f},
-std::array<float,2>{0.518634796f, 0.11941845f},
-std::array<float,2>{0.124667645f, 0.228065938f},
-std::array<float,2>{0.737044275f, 0.780860901f},
-std::array<float,2>{0.394851625f, 0.530794442f},
-std::array<float,2>{0.94262445f, 0.372327358f},
-std::array<float,2>{0.343368322f, 0.161864281f},
-std::array<float,2>{0.77416718f, 0.863012612f},
-std::array<float,2>{0.188882455f, 0.567436993f},
-std::array<float,2>{0.577643573f, 0.275859028f},
-std::array<float,2>{0.0135952979f, 0.401890874f},
-std::array<float,2>{0.651159227f, 0.627145469f},
-std::array<float,2>{0.483177334f, 0.99490726f},
-std::array<float,2>{0.921443045f, 0.0258276239f},
-std::array<float,2>{0.422804952f, 0.342959464f},
-std::array<float,2>{0.978714645f, 0.531666219f},
-std::array<float,2>{0.091938816f, 0.805125892f},
-std::array<float,2>{0.689277768f, 0.192665502f},
-std::array<float,2>{0.185688898f, 0.0660114512f},
-std::array<float,2>{0.5360834f, 0.882124603f},
-std::array<float,2>{0.284855306f, 0.728711188f},
-std::array<float,2>{0.858771503f, 0.494900316f},
-std::array<float,2>{0.383063287f, 0.217086524f},
-std::array<float,2>{0.963971019f, 0.794851482f},
-std::array<float,2>{0.0978200585f, 0.561288655f},
-std::array<float,2>{0.727490306f, 0.314298064f},
-std::array<float,2>{0.144737452f, 0.477358639f},
-std::array<float,2>{0.514125347f, 0.736758828f},
-std::array<float,2>{0.276792824f, 0.900802135f},
-std::array<float,2>{0.840464056f, 0.0927235484f},
-std::array<float,2>{0.368917912f, 0.253220022f},
-std::array<float,2>{0.807902038f, 0.584641278f},
-std::array<float,2>{0.237580612f, 0.846045613f},
-std::array<float,2>{0.605521619f, 0.176027402f},
-std::array<float,2>{0.0442936718f, 0.00776611036f},
-std::array<float,2>{0.660650373f, 0.982472837f},
-std::array<float,2>{0.454951704f, 0.650098085f},
-std::array<float,2>{0.884594738f, 0.381811917f},
-std::array<float,2>{0.304201066f, 0.100220911f},
-std::array<float,2>{0.867191195f, 0.917273283f},
-std::array<float,2>{0.163900331f, 0.714174807f},
-std::array<float,2>{0.550982594f, 0.454979509f},
-std::array<float,2>{0.0638951883f, 0.345188975f},
-std::array<float,2>{0.714640021f, 0.511001647f},
-std::array<float,2>{0.413316369f, 0.758219719f},
-std::array<float,2>{0.997008741f, 0.248884231f},
-std::array<float,2>{0.491206557f, 0.434493065f},
-std::array<float,2>{0.936067462f, 0.671062648f},
-std::array<float,2>{0.020012971f, 0.945844233f},
-std::array<float,2>{0.635411739f, 0.0330477469f},
-std::array<float,2>{0.203525171f, 0.127330884f},
-std::array<float,2>{0.581464827f, 0.842324376f},
-std::array<float,2>{0.314430237f, 0.594426513f},
-std::array<float,2>{0.753707588f, 0.286064565f},
-std::array<float,2>{0.432567716f, 0.000230817299f},
-std::array<float,2>{0.970337391f, 0.978428662f},
-std::array<float,2>{0.0792164952f, 0.652770817f},
-std::array<float,2>{0.702403605f, 0.376059234f},
-std::array<float,2>{0.176750749f, 0.256609589f},
-std::array<float,2>{0.546525776f, 0.581820488f},
-std::array<float,2>{0.290318578f, 0.849302828f},
-std::array<float,2>{0.847736359f, 0.175567344f},
-std::array<float,2>{0.328432202f, 0.482739657f},
-std::array<float,2>{0.772561014f, 0.74213624f},
-std::array<float,2>{0.195570514f, 0.905040503f},
-std::array<float,2>{0.564812839f, 0.0893601626f},
-std::array<float,2>{0.0059262421f, 0.214165926f},
-std::array<float,2>{0.64630115f, 0.790008187f},
-std::array<float,2>{0.47142005f, 0.556609809f},
-std::array<float,2>{0.913440526f, 0.317460775f},
-std::array<float,2>{0.265222073f, 0.130745873f},
-std::array<float,2>{0.823039055f, 0.836349666f},
-std::array<float,2>{0.135492414f, 0.600644588f},
-std::array<float,2>{0.524373293f, 0.281861067f},
-std::array<float,2>{0.110840231f, 0.429907501f},
-std::array<float,2>{0.748840094f, 0.665659904f},
-std::array<float,2>{0.405384064f, 0.952990055f},
-std::array<float,2>{0.947645068f, 0.0376035236f},
-std::array<float,2>{0.44084695f, 0.349142283f},
-std::array<float,2>{0.901611686f, 0.514792681f},
-std::array<float,2>{0.0577153824f, 0.76442188f},
-std::array<float,2>{0.687193751f, 0.245167926f},
-std::array<float,2>{0.230168894f, 0.0939905718f},
-std::array<float,2>{0.62304759f, 0.921710908f},
-std::array<float,2>{0.349001348f, 0.715280235f},
-std::array<float,2>{0.789028823f, 0.460377932f},
-std::array<float,2>{0.496741116f, 0.234247819f},
-std::array<float,2>{0.926894248f, 0.776830852f},
-std::array<float,2>{0.0276865959f, 0.526340187f},
-std::array<float,2>{0.6257779f, 0.370776355f},
-std::array<float,2>{0.218673274f, 0.450523704f},
-std::array<float,2>{0.590002179f, 0.696557939f},
-std::array<float,2>{0.32553196f, 0.924138129f},
-std::array<float,2>{0.763973296f, 0.122819737f},
-std::array<float,2>{0.308704406f, 0.310336381f},
-std::array<float,2>{0.866850674f, 0.613390803f},
-std::array<float,2>{0.167599782f, 0.821317673f},
-std::array<float,2>{0.555972457f, 0.15273349f},
-std::array<float,2>{0.0762356147f, 0.0541397519f},
-std::array<float,2>{0.706537127f, 0.954580963f},
-std::array<float,2>{0.421004951f, 0.685674429f},
-std::array<float,2>{0.986678839f, 0.41828841f},
-std::array<float,2>{0.365642011f, 0.0697179139f},
-std::array<float,2>{0.802325487f, 0.876888216f},
-std::array<float,2>{0.243876785f, 0.73241663f},
-std::array<float,2>{0.598419487f, 0.498443455f},
-std::array<float,2>{0.03755733f, 0.339019716f},
-std::array<float,2>{0.669147909f, 0.537034512f},
-std::array<float,2>{0.463489711f, 0.811475277f},
-std::array<float,2>{0.880716205f, 0.188422829f},
-std::array<float,2>{0.377993464f, 0.403550535f},
-std::array<float,2>{0.960690618f, 0.629599631f},
-std::array<float,2>{0.10538432f, 0.999506116f},
-std::array<float,2>{0.726255357f, 0.0300365482f},
-std::array<float,2>{0.14891161f, 0.15999791f},
-std::array<float,2>{0.506824613f, 0.866928875f},
-std::array<float,2>{0.273355782f, 0.563777268f},
-std::array<float,2>{0.831610203f, 0.277752191f},
-std::array<float,2>{0.460718691f, 0.112815857f},
-std::array<float,2>{0.888787806f, 0.935811639f},
-std::array<float,2>{0.0421264693f, 0.694119215f},
-std::array<float,2>{0.657385945f, 0.437597126f},
-std::array<float,2>{0.241666034f, 0.3604635f},
-std::array<float,2>{0.60283035f, 0.517453849f},
-std::array<float,2>{0.372882217f, 0.768282712f},
-std::array<float,2>{0.811964333f, 0.225580215f},
-std::array<float,2>{0.280575365f, 0.406261832f},
-std::array<float,2>{0.838861346f, 0.678990185f},
-std::array<float,2>{0.143530697f, 0.966192186f},
-std::array<float,2>{0.509171903f, 0.0613911413f},
-std::array<float,2>{0.0972185731f, 0.141422153f},
-std::array<float,2>{0.73186183f, 0.813712001f},
-std::array<float,2>{0.389918983f, 0.618871868f},
-std::array<float,2>{0.967530489f, 0.298383236f},
-std::array<float,2>{0.316433102f, 0.19798249f},
-std::array<float,2>{0.753934443f, 0.799772203f},
-std::array<float,2>{0.210704878f, 0.545805395f},
-std::array<float,2>{0.584373415f, 0.32883355f},
-std::array<float,2>{0.0181268267f, 0.486997843f},
-std::array<float,2>{0.639147282f, 0.726249158f},
-std::array<float,2>{0.484430432f, 0.88474822f},
-std::array<float,2>{0.931736946f, 0.0771085918f},
-std::array<float,2>{0.408028126f, 0.26666373f},
-std::array<float,2>{0.994638324f, 0.575796127f},
-std::array<float,2>{0.0689681694f, 0.872018695f},
-std::array<float,2>{0.717866063f, 0.167633116f},
-std::array<float,2>{0.158351779f, 0.0222604536f},
-std::array<float,2>{0.548502386f, 0.988907576f},
-std::array<float,2>{0.299767911f, 0.639831126f},
-std::array<float,2>{0.873025f, 0.395136178f},
-std::array<float,2>{0.392311543f, 0.186733276f},
-std::array<float,2>{0.939599335f, 0.857498884f},
-std::array<float,2>{0.118375055f, 0.591340542f},
-std::array<float,2>{0.740482688f, 0.260652006f},
-std::array<float,2>{0.132451445f, 0.386792272f},
-std::array<float,2>{0.519730926f, 0.648166537f},
-std::array<float,2>{0.256654173f, 0.972397745f},
-std::array<float,2>{0.814952195f, 0.0117667597f},
-std::array<float,2>{0.356036067f, 0.324951172f},
-std::array<float,2>{0.795337915f, 0.552601218f},
-std::array<float,2>{0.224686027f, 0.787651479f},
-std::array<float,2>{0.615205169f, 0.203513801f},
-std::array<float,2>{0.049973391f, 0.0825602189f},
-std::array<float,2>{0.678298712f, 0.89714998f},
-std::array<float,2>{0.451691359f, 0.744544685f},
-std::array<float,2>{0.893930554f, 0.475016654f},
-std::array<float,2>{0.287920535f, 0.0450112708f},
-std::array<float,2>{0.852232039f, 0.939340293f},
-std::array<float,2>{0.179703578f, 0.656442106f},
-std::array<float,2>{0.533656538f, 0.422717154f},
-std::array<float,2>{0.0864275247f, 0.296451598f},
-std::array<float,2>{0.693391323f, 0.60791117f},
-std::array<float,2>{0.428101987f, 0.835474074f},
-std::array<float,2>{0.982508302f, 0.137319982f},
-std::array<float,2>{0.479183078f, 0.464108944f},
-std::array<float,2>{0.915621877f, 0.708478034f},
-std::array<float,2>{0.011658621f, 0.912571847f},
-std::array<float,2>{0.654309571f, 0.10185767f},
-std::array<float,2>{0.195227236f, 0.237628728f},
-std::array<float,2>{0.570900142f, 0.756860673f},
-std::array<float,2>{0.33758378f, 0.500707626f},
-std::array<float,2>{0.777741432f, 0.351791441f},
-std::array<float,2>{0.384845465f, 0.0921800509f},
-std::array<float,2>{0.962453485f, 0.901018381f},
-std::array<float,2>{0.100553632f, 0.737172425f},
-std::array<float,2>{0.729914606f, 0.476661265f},
-std::array<float,2>{0.1467987f, 0.313586324f},
-std::array<float,2>{0.512285829f, 0.560999334f},
-std::array<float,2>{0.274266779f, 0.794286191f},
-std::array<float,2>{0.842411816f, 0.217706501f},
-std::array<float,2>{0.370813608f, 0.381337613f},
-std::array<float,2>{0.805024326f, 0.649420917f},
-std::array<float,2>{0.235865399f, 0.983017564f},
-std::array<float,2>{0.60874629f, 0.00698251417f},
-std::array<float,2>{0.0457583331f, 0.176653624f},
-std::array<float,2>{0.66290307f, 0.846522748f},
-std::array<float,2>{0.455766708f, 0.584216654f},
-std::array<float,2>{0.885813653f, 0.25349614f},
-std::array<float,2>{0.302564263f, 0.248225048f},
-std::array<float,2>{0.869235337f, 0.758520663f},
-std::array<float,2>{0.161664307f, 0.511706531f},
-std::array<float,2>{0.554095805f, 0.345347434f},
-std::array<float,2>{0.06530343f, 0.454171002f},
-std::array<float,2>{0.711468935f, 0.714409351f},
-std::array<float,2>{0.412053883f, 0.917506874f},
-std::array<float,2>{0.999895036f, 0.100068107f},
-std::array<float,2>{0.489840358f, 0.285262048f},
-std::array<float,2>{0.934315562f, 0.594173014f},
-std::array<float,2>{0.0224064682f, 0.842048943f},
-std::array<float,2>{0.633261263f, 0.127891839f},
-std::array<float,2>{0.206541315f, 0.032281097f},
-std::array<float,2>{0.579887986f, 0.945397258f},
-std::array<float,2>{0.314834207f, 0.671450675f},
-std::array<float,2>{0.750038505f, 0.434073925f},
-std::array<float,2>{0.447545409f, 0.148815453f},
-std::array<float,2>{0.89533329f, 0.827555299f},
-std::array<float,2>{0.0531665161f, 0.61184144f},
-std::array<float,2>{0.673449636f, 0.306510538f},
-std::array<float,2>{0.21896641f, 0.414547622f},
-std::array<float,2>{0.612005889f, 0.681893468f},
-std::array<float,2>{0.354040831f, 0.957864523f},
-std::array<float,2>{0.792495847f, 0.0470768809f},
-std::array<float,2>{0.253490686f, 0.37282306f},
-std::array<float,2>{0.819414973f, 0.53064394f},
-std::array<float,2>{0.128635347f, 0.78042835f},
-std::array<float,2>{0.516537249f, 0.227639481f},
-std::array<float,2>{0.122657314f, 0.119932942f},
-std::array<float,2>{0.736221731f, 0.926422f},
-std::array<float,2>{0.397996932f, 0.699481428f},
-std::array<float,2>{0.944732368f, 0.446708888f},
-std::array<float,2>{0.341020912f, 0.0260488037f},
-std::array<float,2>{0.775775611f, 0.994525313f},
-std::array<float,2>{0.191240951f, 0.627706647f},
-std::array<float,2>{0.575779974f, 0.401543915f},
-std::array<float,2>{0.0146342218f, 0.276352465f},
-std::array<float,2>{0.649393022f, 0.568140507f},
-std::array<float,2>{0.481773645f, 0.862399757f},
-std::array<float,2>{0.918580174f, 0.161522999f},
-std::array<float,2>{0.425765723f, 0.49428919f},
-std::array<float,2>{0.977887392f, 0.729085743f},
-std::array<float,2>{0.0915377215f, 0.882325113f},
-std::array<float,2>{0.689682424f, 0.0655057579f},
-std::array<float,2>{0.185124651f, 0.193087325f},
-std::array<float,2>{0.538350582f, 0.805242062f},
-std::array<float,2>{0.282892674f, 0.531746209f},
-std::array<float,2>{0.855818212f, 0.343514085f},
-std::array<float,2>{0.473181903f, 0.056194976f},
-std::array<float,2>{0.909263492f, 0.963581145f},
-std::array<float,2>{0.00336432923f, 0.673027754f},
-std::array<float,2>{0.644386888f, 0.41023761f},
-std::array<float,2>{0.202510789f, 0.301314503f},
-std::array<float,2>{0.567899406f, 0.624500573f},
-std::array<float,2>{0.332404852f, 0.820141792f},
-std::array<float,2>{0.766686022f, 0.14553915f},
-std::array<float,2>{0.294335812f, 0.441639334f},
-std::array<float,2>{0.844596446f, 0.689864874f},
-std::array<float,2>{0.174785212f, 0.930220664f},
-std::array<float,2>{0.5408898f, 0.115658298f},
-std::array<float,2>{0.0846550986f, 0.220757693f},
-std::array<float,2>{0.696112275f, 0.772822857f},
-std::array<float,2>{0.436521739f, 0.523206055f},
-std::array<float,2>{0.972671151f, 0.365691215f},
-std::array<float,2>{0.345384628f, 0.169868156f},
-std::array<float,2>{0.784100413f, 0.870366931f},
-std::array<float,2>{0.234259397f, 0.574215472f},
-std::array<float,2>{0.619740427f, 0.271674126f},
-std::array<float,2>{0.0610730425f, 0.392676502f},
-std::array<float,2>{0.682884753f, 0.634985685f},
-std::array<float,2>{0.441444725f, 0.985937834f},
-std::array<float,2>{0.902924299f, 0.0172859915f},
-std::array<float,2>{0.401835918f, 0.334494472f},
-std::array<float,2>{0.949971914f, 0.539261162f},
-std::array<float,2>{0.116407081f, 0.8021819f},
-std::array<float,2>{0.744616926f, 0.199766666f},
-std::array<float,2>{0.14045684f, 0.0723393783f},
-std::array<float,2>{0.530955136f, 0.88709408f},
-std::array<float,2>{0.258806169f, 0.722550869f},
-std::array<float,2>{0.825001538f, 0.490889609f},
-std::array<float,2>{0.417722255f, 0.210040852f},
-std::array<float,2>{0.989791036f, 0.782838941f},
-std::array<float,2>{0.0710629821f, 0.547467172f},
-std::array<float,2>{0.708677173f, 0.32068345f},
-std::array<float,2>{0.168879136f, 0.471863627f},
-std::array<float,2>{0.560300708f, 0.749912798f},
-std::array<float,2>{0.308139443f, 0.892359257f},
-std::array<float,2>{0.861549258f, 0.0801429525f},
-std::array<float,2>{0.321123064f, 0.265422225f},
-std::array<float,2>{0.760931194f, 0.587792456f},
-std::array<float,2>{0.21191515f, 0.852243781f},
-std::array<float,2>{0.588227093f, 0.181508049f},
-std::array<float,2>{0.0253623817f, 0.0108148139f},
-std::array<float,2>{0.632081449f, 0.975269496f},
-std::array<float,2>{0.492730796f, 0.640984893f},
-std::array<float,2>{0.924285889f, 0.385320514f},
-std::array<float,2>{0.268980712f, 0.108563028f},
-std::array<float,2>{0.834702551f, 0.908117592f},
-std::array<float,2>{0.152632594f, 0.70455277f},
-std::array<float,2>{0.503329039f, 0.467187524f},
-std::array<float,2>{0.106155239f, 0.357502848f},
-std::array<float,2>{0.721557677f, 0.503924429f},
-std::array<float,2>{0.379939735f, 0.750426412f},
-std::array<float,2>{0.956103921f, 0.241955295f},
-std::array<float,2>{0.46780315f, 0.427829266f},
-std::array<float,2>{0.878160119f, 0.660865903f},
-std::array<float,2>{0.0323546529f, 0.942818105f},
-std::array<float,2>{0.666001737f, 0.0416339599f},
-std::array<float,2>{0.249570847f, 0.13570112f},
-std::array<float,2>{0.594635963f, 0.83036077f},
-std::array<float,2>{0.361118883f, 0.603630185f},
-std::array<float,2>{0.797180533f, 0.291426778f},
-std::array<float,2>{0.404252112f, 0.035815753f},
-std::array<float,2>{0.946964681f, 0.950831413f},
-std::array<float,2>{0.113203324f, 0.667912185f},
-std::array<float,2>{0.746709466f, 0.433379292f},
-std::array<float,2>{0.133550793f, 0.283859998f},
-std::array<float,2>{0.527198553f, 0.597838223f},
-std::array<float,2>{0.262498468f, 0.838140488f},
-std::array<float,2>{0.820796549f, 0.131570548f},
-std::array<float,2>{0.349882782f, 0.457435071f},
-std::array<float,2>{0.785199285f, 0.718636751f},
-std::array<float,2>{0.227342471f, 0.919382215f},
-std::array<float,2>{0.621616483f, 0.0969736427f},
-std::array<float,2>{0.0550653636f, 0.243582144f},
-std::array<float,2>{0.684996188f, 0.763324797f},
-std::array<float,2>{0.438738585f, 0.512485445f},
-std::array<float,2>{0.900018454f, 0.350273937f},
-std::array<float,2>{0.29197973f, 0.173101515f},
-std::array<float,2>{0.850613117f, 0.851145566f},
-std::array<float,2>{0.177817851f, 0.578815877f},
-std::array<float,2>{0.543575943f, 0.25520432f},
-std::array<float,2>{0.0810136199f, 0.378120512f},
-std::array<float,2>{0.700461626f, 0.656215787f},
-std::array<float,2>{0.431497782f, 0.980403841f},
-std::array<float,2>{0.97195226f, 0.0038888969f},
-std::array<float,2>{0.470225096f, 0.319811225f},
-std::array<float,2>{0.911678076f, 0.557981551f},
-std::array<float,2>{0.00585830724f, 0.791040063f},
-std::array<float,2>{0.646982491f, 0.211521417f},
-std::array<float,2>{0.197383359f, 0.0865436941f},
-std::array<float,2>{0.562613547f, 0.904185832f},
-std::array<float,2>{0.33008182f, 0.739459872f},
-std::array<float,2>{0.770594716f, 0.480507135f},
-std::array<float,2>{0.461976707f, 0.191099018f},
-std::array<float,2>{0.881436586f, 0.809201121f},
-std::array<float,2>{0.0359308943f, 0.538511634f},
-std::array<float,2>{0.6702075f, 0.336685687f},
-std::array<float,2>{0.245759249f, 0.497872323f},
-std::array<float,2>{0.599826694f, 0.733120084f},
-std::array<float,2>{0.365126014f, 0.878829241f},
-std::array<float,2>{0.803128004f, 0.0680727065f},
-std::array<float,2>{0.271280766f, 0.281134903f},
-std::array<float,2>{0.829518139f, 0.566113651f},
-std::array<float,2>{0.151757389f, 0.864297986f},
-std::array<float,2>{0.50462687f, 0.157006562f},
-std::array<float,2>{0.103299491f, 0.0283088293f},
-std::array<float,2>{0.723433316f, 0.997551084f},
-std::array<float,2>{0.376301646f, 0.631195962f},
-std::array<float,2>{0.957151175f, 0.404359162f},
-std::array<float,2>{0.326588988f, 0.124217704f},
-std::array<float,2>{0.762355447f, 0.922821999f},
-std::array<float,2>{0.215822563f, 0.697529495f},
-std::array<float,2>{0.592065096f, 0.451745957f},
-std::array<float,2>{0.0301352236f, 0.367887914f},
-std::array<float,2>{0.627218723f, 0.525137305f},
-std::array<float,2>{0.498993933f, 0.773828745f},
-std::array<float,2>{0.928355813f, 0.232253373f},
-std::array<float,2>{0.418647677f, 0.42115742f},
-std::array<float,2>{0.984731019f, 0.683715224f},
-std::array<float,2>{0.0758093894f, 0.956123769f},
-std::array<float,2>{0.704578519f, 0.0526827723f},
-std::array<float,2>{0.165322945f, 0.156065494f},
-std::array<float,2>{0.55726409f, 0.824103892f},
-std::array<float,2>{0.311136305f, 0.616072357f},
-std::array<float,2>{0.863400936f, 0.311581045f},
-std::array<float,2>{0.487303793f, 0.0759581402f},
-std::array<float,2>{0.931008816f, 0.885991216f},
-std::array<float,2>{0.0171254519f, 0.723309875f},
-std::array<float,2>{0.638379276f, 0.485200167f},
-std::array<float,2>{0.207592517f, 0.331352204f},
-std::array<float,2>{0.583594382f, 0.543787241f},
-std::array<float,2>{0.320055246f, 0.798246801f},
-std::array<float,2>{0.75709188f, 0.196472839f},
-std::array<float,2>{0.298037052f, 0.397673309f},
-std::array<float,2>{0.873358846f, 0.638655961f},
-std::array<float,2>{0.157455772f, 0.991624117f},
-std::array<float,2>{0.55051136f, 0.0208246391f},
-std::array<float,2>{0.0674105659f, 0.165086553f},
-std::array<float,2>{0.715435088f, 0.874436975f},
-std::array<float,2>{0.408499658f, 0.576355398f},
-std::array<float,2>{0.992299914f, 0.269412279f},
-std::array<float,2>{0.373058349f, 0.224445403f},
-std::array<float,2>{0.808849394f, 0.767222464f},
-std::array<float,2>{0.239073098f, 0.518078983f},
-std::array<float,2>{0.60401541f, 0.362915069f},
-std::array<float,2>{0.0405446552f, 0.440493494f},
-std::array<float,2>{0.658653378f, 0.692317188f},
-std::array<float,2>{0.458859682f, 0.935299158f},
-std::array<float,2>{0.887868702f, 0.109741896f},
-std::array<float,2>{0.387138873f, 0.299690247f},
-std::array<float,2>{0.966629148f, 0.61951822f},
-std::array<float,2>{0.0941158608f, 0.814820468f},
-std::array<float,2>{0.733882368f, 0.143299565f},
-std::array<float,2>{0.141075581f, 0.0593240708f},
-std::array<float,2>{0.511651754f, 0.968550861f},
-std::array<float,2>{0.27873382f, 0.677291274f},
-std::array<float,2>{0.836674452f, 0.409227431f},
-std::array<float,2>{0.425828993f, 0.140435815f},
-std::array<float,2>{0.980769217f, 0.832927585f},
-std::array<float,2>{0.0880079046f, 0.606680334f},
-std::array<float,2>{0.692595422f, 0.294623524f},
-std::array<float,2>{0.181882903f, 0.424227804f},
-std::array<float,2>{0.531438172f, 0.659384072f},
-std::array<float,2>{0.285159141f, 0.93977958f},
-std::array<float,2>{0.853759825f, 0.0436433256f},
-std::array<float,2>{0.338963002f, 0.35546124f},
-std::array<float,2>{0.78076607f, 0.502626777f},
-std::array<float,2>{0.192112878f, 0.755496085f},
-std::array<float,2>{0.574018836f, 0.235024661f},
-std::array<float,2>{0.00926269311f, 0.104828574f},
-std::array<float,2>{0.654019117f, 0.911798894f},
-std::array<float,2>{0.478497803f, 0.710048139f},
-std::array<float,2>{0.916093409f, 0.46162048f},
-std::array<float,2>{0.253989667f, 0.0148614682f},
-std::array<float,2>{0.814150393f, 0.969726562f},
-std::array<float,2>{0.130629957f, 0.645031333f},
-std::array<float,2>{0.522503674f, 0.389797777f},
-std::array<float,2>{0.120509744f, 0.258059412f},
-std::array<float,2>{0.739269614f, 0.592395008f},
-std::array<float,2>{0.393700391f, 0.855888307f},
-std::array<float,2>{0.938946128f, 0.183959797f},
-std::array<float,2>{0.450761914f, 0.473239988f},
-std::array<float,2>{0.8918432f, 0.744031906f},
-std::array<float,2>{0.047408428f, 0.896088481f},
-std::array<float,2>{0.677114725f, 0.0841321349f},
-std::array<float,2>{0.223281786f, 0.205982327f},
-std::array<float,2>{0.615589678f, 0.785496712f},
-std::array<float,2>{0.358473033f, 0.55369699f},
-std::array<float,2>{0.793032765f, 0.328026325f},
-std::array<float,2>{0.413655549f, 0.0992084593f},
-std::array<float,2>{0.996575534f, 0.914253235f},
-std::array<float,2>{0.0641126484f, 0.711098194f},
-std::array<float,2>{0.713904142f, 0.456773549f},
-std::array<float,2>{0.16346994f, 0.34607479f},
-std::array<float,2>{0.551507473f, 0.508607805f},
-std::array<float,2>{0.303730041f, 0.759951293f},
-std::array<float,2>{0.867904842f, 0.246546775f},
-std::array<float,2>{0.313783824f, 0.435592532f},
-std::array<float,2>{0.753022432f, 0.668718278f},
-std::array<float,2>{0.20406267f, 0.948648632f},
-std::array<float,2>{0.581871212f, 0.0332651101f},
-std::array<float,2>{0.02019375f, 0.125365227f},
-std::array<float,2>{0.635104775f, 0.840652883f},
-std::array<float,2>{0.490493715f, 0.596598685f},
-std::array<float,2>{0.935808241f, 0.287174731f},
-std::array<float,2>{0.277198017f, 0.215547189f},
-std::array<float,2>{0.840033352f, 0.796211481f},
-std::array<float,2>{0.145188674f, 0.560090721f},
-std::array<float,2>{0.514402032f, 0.315274119f},
-std::array<float,2>{0.0985487849f, 0.479297757f},
-std::array<float,2>{0.727022529f, 0.734723806f},
-std::array<float,2>{0.383467346f, 0.899782538f},
-std::array<float,2>{0.964707673f, 0.0909140557f},
-std::array<float,2>{0.45454973f, 0.251768678f},
-std::array<float,2>{0.883965552f, 0.583260477f},
-std::array<float,2>{0.0446995459f, 0.844065309f},
-std::array<float,2>{0.660292447f, 0.177911952f},
-std::array<float,2>{0.237957418f, 0.00445524277f},
-std::array<float,2>{0.606442928f, 0.981301963f},
-std::array<float,2>{0.36860913f, 0.650626481f},
-std::array<float,2>{0.808284342f, 0.379873008f},
-std::array<float,2>{0.482845843f, 0.163367003f},
-std::array<float,2>{0.920937061f, 0.860400558f},
-std::array<float,2>{0.0129018379f, 0.569889903f},
-std::array<float,2>{0.6503914f, 0.2751562f},
-std::array<float,2>{0.189029694f, 0.399297476f},
-std::array<float,2>{0.577532887f, 0.626033545f},
-std::array<float,2>{0.342984796f, 0.992276192f},
-std::array<float,2>{0.773736537f, 0.0249273721f},
-std::array<float,2>{0.284611017f, 0.340116382f},
-std::array<float,2>{0.859322906f, 0.533301055f},
-std::array<float,2>{0.186373278f, 0.808158994f},
-std::array<float,2>{0.535401702f, 0.19461292f},
-std::array<float,2>{0.09240143f, 0.0630381033f},
-std::array<float,2>{0.688944697f, 0.880595624f},
-std::array<float,2>{0.422062069f, 0.726835787f},
-std::array<float,2>{0.979343534f, 0.49408555f},
-std::array<float,2>{0.353109211f, 0.0496011302f},
-std::array<float,2>{0.79052037f, 0.960021436f},
-std::array<float,2>{0.22193931f, 0.681371808f},
-std::array<float,2>{0.611303151f, 0.416964412f},
-std::array<float,2>{0.0507852435f, 0.307495356f},
-std::array<float,2>{0.674660087f, 0.61002785f},
-std::array<float,2>{0.445484161f, 0.825572014f},
-std::array<float,2>{0.896885991f, 0.151335508f},
-std::array<float,2>{0.395133287f, 0.447748214f},
-std::array<float,2>{0.94303906f, 0.702833235f},
-std::array<float,2>{0.124406748f, 0.928162158f},
-std::array<float,2>{0.7366063f, 0.118141353f},
-std::array<float,2>{0.125481144f, 0.230284646f},
-std::array<float,2>{0.519435167f, 0.777982235f},
-std::array<float,2>{0.251903534f, 0.528983116f},
-std::array<float,2>{0.818015873f, 0.374621689f},
-std::array<float,2>{0.444005042f, 0.018029144f},
-std::array<float,2>{0.904405415f, 0.98720938f},
-std::array<float,2>{0.0602155253f, 0.632959008f},
-std::array<float,2>{0.68159765f, 0.391672045f},
-std::array<float,2>{0.231165722f, 0.271269828f},
-std::array<float,2>{0.618714869f, 0.571382642f},
-std::array<float,2>{0.346450955f, 0.867670715f},
-std::array<float,2>{0.781615496f, 0.169947684f},
-std::array<float,2>{0.260075718f, 0.488589674f},
-std::array<float,2>{0.826956034f, 0.718911707f},
-std::array<float,2>{0.137631208f, 0.889695883f},
-std::array<float,2>{0.52737546f, 0.0706415251f},
-std::array<float,2>{0.113712355f, 0.201771393f},
-std::array<float,2>{0.742197216f, 0.803563297f},
-std::array<float,2>{0.399018019f, 0.542111874f},
-std::array<float,2>{0.951920509f, 0.333482593f},
-std::array<float,2>{0.334396183f, 0.14663285f},
-std::array<float,2>{0.769236863f, 0.816959798f},
-std::array<float,2>{0.199879467f, 0.621096194f},
-std::array<float,2>{0.569075823f, 0.302916139f},
-std::array<float,2>{0.00033484833f, 0.413438171f},
-std::array<float,2>{0.640738785f, 0.674440205f},
-std::array<float,2>{0.475404978f, 0.962095141f},
-std::array<float,2>{0.90629828f, 0.05671243f},
-std::array<float,2>{0.434042186f, 0.364746839f},
-std::array<float,2>{0.975588977f, 0.52108556f},
-std::array<float,2>{0.0838706493f, 0.771191061f},
-std::array<float,2>{0.697598815f, 0.219571799f},
-std::array<float,2>{0.173287705f, 0.114551373f},
-std::array<float,2>{0.542600334f, 0.932528496f},
-std::array<float,2>{0.296284139f, 0.689314544f},
-std::array<float,2>{0.846753061f, 0.445264369f},
-std::array<float,2>{0.380954683f, 0.238638371f},
-std::array<float,2>{0.953152299f, 0.753062248f},
-std::array<float,2>{0.109038614f, 0.507612109f},
-std::array<float,2>{0.720691741f, 0.357106417f},
-std::array<float,2>{0.155486882f, 0.465497375f},
-std::array<float,2>{0.500388801f, 0.706475973f},
-std::array<float,2>{0.267314017f, 0.908465087f},
-std::array<float,2>{0.832088947f, 0.107216075f},
-std::array<float,2>{0.362839401f, 0.289851218f},
-std::array<float,2>{0.799906135f, 0.602615833f},
-std::array<float,2>{0.247389272f, 0.828762293f},
-std::array<float,2>{0.595818341f, 0.133688539f},
-std::array<float,2>{0.034192875f, 0.0404613279f},
-std::array<float,2>{0.667023063f, 0.945012033f},
-std::array<float,2>{0.466378063f, 0.662510216f},
-std::array<float,2>{0.875624239f, 0.425842583f},
-std::array<float,2>{0.306604981f, 0.0787738636f},
-std::array<float,2>{0.861116529f, 0.89446193f},
-std::array<float,2>{0.171634629f, 0.747648597f},
-std::array<float,2>{0.560913861f, 0.470334828f},
-std::array<float,2>{0.0730554014f, 0.323790789f},
-std::array<float,2>{0.709574103f, 0.549909651f},
-std::array<float,2>{0.415579557f, 0.7837587f},
-std::array<float,2>{0.990256548f, 0.207879722f},
-std::array<float,2>{0.494305968f, 0.383272141f},
-std::array<float,2>{0.923581123f, 0.64311713f},
-std::array<float,2>{0.0264854673f, 0.973036826f},
-std::array<float,2>{0.62926358f, 0.00868224818f},
-std::array<float,2>{0.213683933f, 0.182759419f},
-std::array<float,2>{0.586298406f, 0.853576124f},
-std::array<float,2>{0.322407126f, 0.588640451f},
-std::array<float,2>{0.758904696f, 0.262094259f},
-std::array<float,2>{0.42038855f, 0.0511336327f},
-std::array<float,2>{0.988039374f, 0.955960751f},
-std::array<float,2>{0.0778362751f, 0.68530786f},
-std::array<float,2>{0.705118239f, 0.420112848f},
-std::array<float,2>{0.166603178f, 0.311401218f},
-std::array<float,2>{0.555622339f, 0.616849005f},
-std::array<float,2>{0.309878349f, 0.822809637f},
-std::array<float,2>{0.866161227f, 0.154721528f},
-std::array<float,2>{0.325036526f, 0.452320427f},
-std::array<float,2>{0.76541537f, 0.698286355f},
-std::array<float,2>{0.216828749f, 0.92360568f},
-std::array<float,2>{0.59144789f, 0.12318828f},
-std::array<float,2>{0.0284143072f, 0.231174022f},
-std::array<float,2>{0.626856029f, 0.774870098f},
-std::array<float,2>{0.497436196f, 0.523859441f},
-std::array<float,2>{0.926537275f, 0.368664086f},
-std::array<float,2>{0.271953762f, 0.15810214f},
-std::array<float,2>{0.830290735f, 0.864055932f},
-std::array<float,2>{0.150122285f, 0.564850509f},
-std::array<float,2>{0.507188439f, 0.279976994f},
-std::array<float,2>{0.104115389f, 0.405493945f},
-std::array<float,2>{0.725512803f, 0.632671356f},
-std::array<float,2>{0.3778027f, 0.996165097f},
-std::array<float,2>{0.959755242f, 0.0288552474f},
-std::array<float,2>{0.464121103f, 0.337617159f},
-std::array<float,2>{0.879008353f, 0.537319183f},
-std::array<float,2>{0.0384729542f, 0.810317039f},
-std::array<float,2>{0.668812394f, 0.190129846f},
-std::array<float,2>{0.242402345f, 0.0671561807f},
-std::array<float,2>{0.599233687f, 0.877125323f},
-std::array<float,2>{0.366707563f, 0.733548582f},
-std::array<float,2>{0.800789893f, 0.496575266f},
-std::array<float,2>{0.472295582f, 0.212633982f},
-std::array<float,2>{0.912631392f, 0.792093635f},
-std::array<float,2>{0.00771741476f, 0.557259679f},
-std::array<float,2>{0.644850552f, 0.318754315f},
-std::array<float,2>{0.196909755f, 0.481746376f},
-std::array<float,2>{0.56590718f, 0.738328874f},
-std::array<float,2>{0.329181343f, 0.902648628f},
-std::array<float,2>{0.771693587f, 0.0873404592f},
-std::array<float,2>{0.289977163f, 0.254442513f},
-std::array<float,2>{0.849402606f, 0.579312503f},
-std::array<float,2>{0.177052125f, 0.849995255f},
-std::array<float,2>{0.545325577f, 0.172757834f},
-std::array<float,2>{0.0787257627f, 0.00234282855f},
-std::array<float,2>{0.701618791f, 0.979046285f},
-std::array<float,2>{0.433375061f, 0.654408813f},
-std::array<float,2>{0.968977213f, 0.376987785f},
-std::array<float,2>{0.348580956f, 0.0960696787f},
-std::array<float,2>{0.787807763f, 0.918237925f},
-std::array<float,2>{0.22896117f, 0.717354476f},
-std::array<float,2>{0.624284565f, 0.458749294f},
-std::array<float,2>{0.0568405837f, 0.35104993f},
-std::array<float,2>{0.685825765f, 0.513484716f},
-std::array<float,2>{0.439569086f, 0.76216954f},
-std::array<float,2>{0.900543928f, 0.242347881f},
-std::array<float,2>{0.404987782f, 0.431883574f},
-std::array<float,2>{0.948970139f, 0.666480303f},
-std::array<float,2>{0.109721467f, 0.949372709f},
-std::array<float,2>{0.749266088f, 0.0362176038f},
-std::array<float,2>{0.135877728f, 0.132339552f},
-std::array<float,2>{0.524766624f, 0.839333653f},
-std::array<float,2>{0.264515549f, 0.598968744f},
-std::array<float,2>{0.823303998f, 0.284862876f},
-std::array<float,2>{0.4521842f, 0.0851316005f},
-std::array<float,2>{0.89305234f, 0.894988358f},
-std::array<float,2>{0.0491546467f, 0.743085384f},
-std::array<float,2>{0.678752959f, 0.473817647f},
-std::array<float,2>{0.225754112f, 0.327143401f},
-std::array<float,2>{0.613623917f, 0.554011226f},
-std::array<float,2>{0.356835902f, 0.786331654f},
-std::array<float,2>{0.796833158f, 0.206271201f},
-std::array<float,2>{0.257431984f, 0.389325231f},
-std::array<float,2>{0.816255987f, 0.646140277f},
-std::array<float,2>{0.131277964f, 0.969713926f},
-std::array<float,2>{0.521181583f, 0.0139586478f},
-std::array<float,2>{0.117778279f, 0.185151905f},
-std::array<float,2>{0.741237879f, 0.856678367f},
-std::array<float,2>{0.391209424f, 0.593021631f},
-std::array<float,2>{0.941130459f, 0.25892055f},
-std::array<float,2>{0.336518764f, 0.235834166f},
-std::array<float,2>{0.778566539f, 0.754103124f},
-std::array<float,2>{0.193822667f, 0.503037572f},
-std::array<float,2>{0.571802437f, 0.354080021f},
-std::array<float,2>{0.0104467515f, 0.462501287f},
-std::array<float,2>{0.655471087f, 0.709604144f},
-std::array<float,2>{0.479711056f, 0.910643637f},
-std::array<float,2>{0.914974749f, 0.103891537f},
-std::array<float,2>{0.429214269f, 0.293538004f},
-std::array<float,2>{0.983521223f, 0.606066942f},
-std::array<float,2>{0.0874479562f, 0.833181739f},
-std::array<float,2>{0.694610178f, 0.13931334f},
-std::array<float,2>{0.181354031f, 0.0448686033f},
-std::array<float,2>{0.534870803f, 0.941379905f},
-std::array<float,2>{0.288506776f, 0.65916431f},
-std::array<float,2>{0.853350639f, 0.425311297f},
-std::array<float,2>{0.389506906f, 0.144021437f},
-std::array<float,2>{0.968077481f, 0.815446556f},
-std::array<float,2>{0.0958651081f, 0.620628119f},
-std::array<float,2>{0.730731845f, 0.300512105f},
-std::array<float,2>{0.143825918f, 0.408286244f},
-std::array<float,2>{0.50782156f, 0.675799906f},
-std::array<float,2>{0.280265659f, 0.967765808f},
-std::array<float,2>{0.838877499f, 0.0596713237f},
-std::array<float,2>{0.371715605f, 0.361980677f},
-std::array<float,2>{0.811161101f, 0.51899904f},
-std::array<float,2>{0.240626276f, 0.76565671f},
-std::array<float,2>{0.601948678f, 0.223014072f},
-std::array<float,2>{0.041829519f, 0.110791758f},
-std::array<float,2>{0.656533599f, 0.934256673f},
-std::array<float,2>{0.459845662f, 0.692500412f},
-std::array<float,2>{0.890512168f, 0.440115809f},
-std::array<float,2>{0.299886256f, 0.0201612599f},
-std::array<float,2>{0.871457517f, 0.990562916f},
-std::array<float,2>{0.160071388f, 0.636758626f},
-std::array<float,2>{0.547544181f, 0.39720729f},
-std::array<float,2>{0.0695079863f, 0.268010259f},
-std::array<float,2>{0.717549443f, 0.577547073f},
-std::array<float,2>{0.406325489f, 0.873152077f},
-std::array<float,2>{0.99575603f, 0.164199322f},
-std::array<float,2>{0.485417515f, 0.486031413f},
-std::array<float,2>{0.933388472f, 0.723787785f},
-std::array<float,2>{0.0193529688f, 0.884823322f},
-std::array<float,2>{0.640220046f, 0.0751738697f},
-std::array<float,2>{0.209770352f, 0.195827231f},
-std::array<float,2>{0.585481465f, 0.79706645f},
-std::array<float,2>{0.318139046f, 0.544894755f},
-std::array<float,2>{0.755757868f, 0.330909044f},
-std::array<float,2>{0.39711225f, 0.119055741f},
-std::array<float,2>{0.943926275f, 0.929239273f},
-std::array<float,2>{0.121679828f, 0.701922119f},
-std::array<float,2>{0.734633684f, 0.448393255f},
-std::array<float,2>{0.127792567f, 0.373118311f},
-std::array<float,2>{0.516750336f, 0.527567923f},
-std::array<float,2>{0.252577335f, 0.778820813f},
-std::array<float,2>{0.818794549f, 0.228838429f},
-std::array<float,2>{0.354562134f, 0.417772204f},
-std::array<float,2>{0.791037917f, 0.680343032f},
-std::array<float,2>{0.220375702f, 0.959563553f},
-std::array<float,2>{0.61271143f, 0.0504552573f},
-std::array<float,2>{0.0541469119f, 0.152309224f},
-std::array<float,2>{0.671938837f, 0.824861526f},
-std::array<float,2>{0.448515743f, 0.611078799f},
-std::array<float,2>{0.896426201f, 0.308561713f},
-std::array<float,2>{0.282100707f, 0.194128305f},
-std::array<float,2>{0.857216239f, 0.806898117f},
-std::array<float,2>{0.183916003f, 0.534910262f},
-std::array<float,2>{0.537362635f, 0.341649681f},
-std::array<float,2>{0.0908114761f, 0.49278459f},
-std::array<float,2>{0.69120717f, 0.728115678f},
-std::array<float,2>{0.424301237f, 0.879744112f},
-std::array<float,2>{0.97714597f, 0.0642713085f},
-std::array<float,2>{0.480632097f, 0.273625314f},
-std::array<float,2>{0.91930908f, 0.569033742f},
-std::array<float,2>{0.0152795808f, 0.860049903f},
-std::array<float,2>{0.650161386f, 0.162514344f},
-std::array<float,2>{0.189458355f, 0.0242217872f},
-std::array<float,2>{0.575043321f, 0.993323445f},
-std::array<float,2>{0.340322047f, 0.625496268f},
-std::array<float,2>{0.776623309f, 0.399847925f},
-std::array<float,2>{0.456896722f, 0.179483876f},
-std::array<float,2>{0.885591805f, 0.845174611f},
-std::array<float,2>{0.0466742776f, 0.5827654f},
-std::array<float,2>{0.663194299f, 0.250191748f},
-std::array<float,2>{0.235175759f, 0.380547464f},
-std::array<float,2>{0.607903898f, 0.652188003f},
-std::array<float,2>{0.369958907f, 0.982401371f},
-std::array<float,2>{0.806286871f, 0.00537577691f},
-std::array<float,2>{0.274896264f, 0.316333264f},
-std::array<float,2>{0.843100548f, 0.55911231f},
-std::array<float,2>{0.147745997f, 0.795062959f},
-std::array<float,2>{0.513620615f, 0.216002196f},
-std::array<float,2>{0.101116069f, 0.0907816142f},
-std::array<float,2>{0.729021013f, 0.898523748f},
-std::array<float,2>{0.386106133f, 0.735653162f},
-std::array<float,2>{0.961143196f, 0.479950428f},
-std::array<float,2>{0.316075265f, 0.0344441347f},
-std::array<float,2>{0.751354694f, 0.947444379f},
-std::array<float,2>{0.205662936f, 0.669470429f},
-std::array<float,2>{0.578390241f, 0.436778694f},
-std::array<float,2>{0.0226699989f, 0.288892597f},
-std::array<float,2>{0.633874178f, 0.597639799f},
-std::array<float,2>{0.489231169f, 0.841534615f},
-std::array<float,2>{0.934612751f, 0.126350775f},
-std::array<float,2>{0.41108045f, 0.455978453f},
-std::array<float,2>{0.998835266f, 0.712262571f},
-std::array<float,2>{0.0657114983f, 0.915315926f},
-std::array<float,2>{0.711945176f, 0.0980016217f},
-std::array<float,2>{0.160305321f, 0.247927487f},
-std::array<float,2>{0.553551614f, 0.761113346f},
-std::array<float,2>{0.301735729f, 0.509246349f},
-std::array<float,2>{0.870575249f, 0.347476363f},
-std::array<float,2>{0.494119406f, 0.00916751847f},
-std::array<float,2>{0.925604403f, 0.97434026f},
-std::array<float,2>{0.0237782244f, 0.643581748f},
-std::array<float,2>{0.630908966f, 0.384372383f},
-std::array<float,2>{0.211578995f, 0.262718141f},
-std::array<float,2>{0.589392245f, 0.589484215f},
-std::array<float,2>{0.321528703f, 0.854748964f},
-std::array<float,2>{0.759925365f, 0.182321399f},
-std::array<float,2>{0.306904584f, 0.469565958f},
-std::array<float,2>{0.862872064f, 0.746831357f},
-std::array<float,2>{0.169663072f, 0.892939866f},
-std::array<float,2>{0.559401333f, 0.0792530179f},
-std::array<float,2>{0.0718628317f, 0.208633825f},
-std::array<float,2>{0.707604706f, 0.784449518f},
-std::array<float,2>{0.416118741f, 0.548868954f},
-std::array<float,2>{0.988806009f, 0.322707444f},
-std::array<float,2>{0.359391898f, 0.134569511f},
-std::array<float,2>{0.798375368f, 0.829780459f},
-std::array<float,2>{0.248481184f, 0.602364779f},
-std::array<float,2>{0.594998837f, 0.290532798f},
-std::array<float,2>{0.0315955766f, 0.427223414f},
-std::array<float,2>{0.664940417f, 0.663403809f},
-std::array<float,2>{0.467071593f, 0.94411248f},
-std::array<float,2>{0.877693057f, 0.0397374369f},
-std::array<float,2>{0.37962237f, 0.356030852f},
-std::array<float,2>{0.955534816f, 0.505880296f},
-std::array<float,2>{0.107013009f, 0.752838433f},
-std::array<float,2>{0.72262609f, 0.239913538f},
-std::array<float,2>{0.154249609f, 0.106410757f},
-std::array<float,2>{0.502856076f, 0.909243524f},
-std::array<float,2>{0.267859221f, 0.705293894f},
-std::array<float,2>{0.835213661f, 0.466676414f},
-std::array<float,2>{0.437230796f, 0.220047861f},
-std::array<float,2>{0.97374934f, 0.770296156f},
-std::array<float,2>{0.0850794315f, 0.520067155f},
-std::array<float,2>{0.6967749f, 0.363323301f},
-std::array<float,2>{0.175271422f, 0.44369027f},
-std::array<float,2>{0.539107382f, 0.687793612f},
-std::array<float,2>{0.293922961f, 0.932697773f},
-std::array<float,2>{0.845495284f, 0.114248447f},
-std::array<float,2>{0.333158761f, 0.304605931f},
-std::array<float,2>{0.765924633f, 0.622565687f},
-std::array<float,2>{0.201276496f, 0.817772686f},
-std::array<float,2>{0.566420436f, 0.147793829f},
-std::array<float,2>{0.0021063739f, 0.0585066602f},
-std::array<float,2>{0.642921209f, 0.96113652f},
-std::array<float,2>{0.473709762f, 0.675364971f},
-std::array<float,2>{0.90848577f, 0.41266346f},
-std::array<float,2>{0.258105189f, 0.0722248405f},
-std::array<float,2>{0.826025009f, 0.889194191f},
-std::array<float,2>{0.138692632f, 0.720636487f},
-std::array<float,2>{0.529465914f, 0.490169674f},
-std::array<float,2>{0.115347482f, 0.332850009f},
-std::array<float,2>{0.745788217f, 0.541255355f},
-std::array<float,2>{0.40117839f, 0.804662645f},
-std::array<float,2>{0.951068997f, 0.202489629f},
-std::array<float,2>{0.443103135f, 0.391411126f},
-std::array<float,2>{0.903945565f, 0.634261608f},
-std::array<float,2>{0.06224728f, 0.98807627f},
-std::array<float,2>{0.682146549f, 0.0188258905f},
-std::array<float,2>{0.232577279f, 0.171465129f},
-std::array<float,2>{0.620897591f, 0.868503153f},
-std::array<float,2>{0.344574869f, 0.570717037f},
-std::array<float,2>{0.784603417f, 0.270036906f},
-std::array<float,2>{0.3756347f, 0.0305641219f},
-std::array<float,2>{0.958429515f, 0.998172283f},
-std::array<float,2>{0.10238494f, 0.630484879f},
-std::array<float,2>{0.724460006f, 0.403162628f},
-std::array<float,2>{0.150863007f, 0.278461784f},
-std::array<float,2>{0.505297184f, 0.563204765f},
-std::array<float,2>{0.27008608f, 0.866159797f},
-std::array<float,2>{0.828496516f, 0.158453912f},
-std::array<float,2>{0.363932759f, 0.499527097f},
-std::array<float,2>{0.804234087f, 0.731145918f},
-std::array<float,2>{0.244665712f, 0.875336766f},
-std::array<float,2>{0.601489842f, 0.0689589754f},
-std::array<float,2>{0.0364056304f, 0.188687727f},
-std::array<float,2>{0.671526015f, 0.812441051f},
-std::array<float,2>{0.461262226f, 0.535722792f},
-std::array<float,2>{0.88275671f, 0.337964237f},
-std::array<float,2>{0.311633825f, 0.153442666f},
-std::array<float,2>{0.864809811f, 0.821091056f},
-std::array<float,2>{0.164088145f, 0.615076542f},
-std::array<float,2>{0.557945609f, 0.308800757f},
-std::array<float,2>{0.0747149214f, 0.419697195f},
-std::array<float,2>{0.703913033f, 0.687433362f},
-std::array<float,2>{0.419608533f, 0.953278303f},
-std::array<float,2>{0.985549092f, 0.0529522449f},
-std::array<float,2>{0.499225229f, 0.369840682f},
-std::array<float,2>{0.928817332f, 0.526834428f},
-std::array<float,2>{0.0304223076f, 0.77550894f},
-std::array<float,2>{0.628198624f, 0.233389005f},
-std::array<float,2>{0.215535045f, 0.121299788f},
-std::array<float,2>{0.593188345f, 0.925231516f},
-std::array<float,2>{0.327929527f, 0.695978045f},
-std::array<float,2>{0.763206244f, 0.449753612f},
-std::array<float,2>{0.437535346f, 0.244844824f},
-std::array<float,2>{0.899057627f, 0.765210748f},
-std::array<float,2>{0.0562031195f, 0.514326513f},
-std::array<float,2>{0.684397519f, 0.348414302f},
-std::array<float,2>{0.228471607f, 0.459298939f},
-std::array<float,2>{0.622784078f, 0.716398001f},
-std::array<float,2>{0.350941867f, 0.920773387f},
-std::array<float,2>{0.786561012f, 0.09523312f},
-std::array<float,2>{0.263120949f, 0.282516271f},
-std::array<float,2>{0.822028458f, 0.59961468f},
-std::array<float,2>{0.133939683f, 0.83757621f},
-std::array<float,2>{0.526213944f, 0.129126102f},
-std::array<float,2>{0.112208761f, 0.0383487716f},
-std::array<float,2>{0.747319043f, 0.951371372f},
-std::array<float,2>{0.402655691f, 0.664974689f},
-std::array<float,2>{0.946107626f, 0.430757791f},
-std::array<float,2>{0.331798702f, 0.0885822549f},
-std::array<float,2>{0.769793868f, 0.906215191f},
-std::array<float,2>{0.198940814f, 0.740961432f},
-std::array<float,2>{0.563734889f, 0.484361857f},
-std::array<float,2>{0.00456084218f, 0.316740155f},
-std::array<float,2>{0.647919714f, 0.555245697f},
-std::array<float,2>{0.469039977f, 0.790206313f},
-std::array<float,2>{0.910268068f, 0.212989837f},
-std::array<float,2>{0.429928094f, 0.375339448f},
-std::array<float,2>{0.970884383f, 0.653662682f},
-std::array<float,2>{0.0819727033f, 0.976887524f},
-std::array<float,2>{0.699865639f, 0.00136318326f},
-std::array<float,2>{0.179297104f, 0.174694464f},
-std::array<float,2>{0.544212282f, 0.848587155f},
-std::array<float,2>{0.292558819f, 0.580134332f},
-std::array<float,2>{0.849778473f, 0.257242739f},
-std::array<float,2>{0.476905644f, 0.103099562f},
-std::array<float,2>{0.917535305f, 0.91371876f},
-std::array<float,2>{0.00861984212f, 0.707528591f},
-std::array<float,2>{0.652365029f, 0.463318408f},
-std::array<float,2>{0.193109229f, 0.353512377f},
-std::array<float,2>{0.573020041f, 0.501164138f},
-std::array<float,2>{0.338486105f, 0.756379783f},
-std::array<float,2>{0.779340029f, 0.236589834f},
-std::array<float,2>{0.286220878f, 0.423039407f},
-std::array<float,2>{0.854921162f, 0.657427788f},
-std::array<float,2>{0.182980761f, 0.938012362f},
-std::array<float,2>{0.533167541f, 0.0468725041f},
-std::array<float,2>{0.0893212631f, 0.138088241f},
-std::array<float,2>{0.692300498f, 0.834312499f},
-std::array<float,2>{0.426848918f, 0.608724713f},
-std::array<float,2>{0.981952012f, 0.295416355f},
-std::array<float,2>{0.35743174f, 0.204565421f},
-std::array<float,2>{0.794890046f, 0.788861096f},
-std::array<float,2>{0.223912582f, 0.550870836f},
-std::array<float,2>{0.616874278f, 0.32580933f},
-std::array<float,2>{0.0484316647f, 0.47559303f},
-std::array<float,2>{0.676580369f, 0.746035993f},
-std::array<float,2>{0.449833184f, 0.897943497f},
-std::array<float,2>{0.891311944f, 0.0837327465f},
-std::array<float,2>{0.392614514f, 0.261149347f},
-std::array<float,2>{0.938057184f, 0.590682745f},
-std::array<float,2>{0.119485155f, 0.859144688f},
-std::array<float,2>{0.739117622f, 0.185945332f},
-std::array<float,2>{0.129503638f, 0.0135391867f},
-std::array<float,2>{0.521698415f, 0.971351326f},
-std::array<float,2>{0.255623937f, 0.647342324f},
-std::array<float,2>{0.813450992f, 0.388268024f},
-std::array<float,2>{0.409962833f, 0.16624172f},
-std::array<float,2>{0.993248582f, 0.872329533f},
-std::array<float,2>{0.0673680156f, 0.574556351f},
-std::array<float,2>{0.716271222f, 0.266123205f},
-std::array<float,2>{0.156824946f, 0.395741999f},
-std::array<float,2>{0.549715459f, 0.639331877f},
-std::array<float,2>{0.296970278f, 0.989476442f},
-std::array<float,2>{0.87491256f, 0.0226015318f},
-std::array<float,2>{0.318650275f, 0.329182953f},
-std::array<float,2>{0.756352007f, 0.546351016f},
-std::array<float,2>{0.208018005f, 0.800431311f},
-std::array<float,2>{0.582972527f, 0.199160621f},
-std::array<float,2>{0.0165662635f, 0.077374056f},
-std::array<float,2>{0.637201607f, 0.883022726f},
-std::array<float,2>{0.487501591f, 0.724812806f},
-std::array<float,2>{0.93001169f, 0.487626642f},
-std::array<float,2>{0.277839154f, 0.0620989203f},
-std::array<float,2>{0.837454796f, 0.964915276f},
-std::array<float,2>{0.142048925f, 0.677775085f},
-std::array<float,2>{0.510056555f, 0.407516867f},
-std::array<float,2>{0.0949655399f, 0.297473937f},
-std::array<float,2>{0.732712567f, 0.617505372f},
-std::array<float,2>{0.388360411f, 0.813106298f},
-std::array<float,2>{0.965172887f, 0.141636044f},
-std::array<float,2>{0.457588762f, 0.439199418f},
-std::array<float,2>{0.886760175f, 0.694688976f},
-std::array<float,2>{0.039769914f, 0.93727839f},
-std::array<float,2>{0.659635305f, 0.111845449f},
-std::array<float,2>{0.239469618f, 0.226118341f},
-std::array<float,2>{0.604949176f, 0.769195497f},
-std::array<float,2>{0.374388576f, 0.51589185f},
-std::array<float,2>{0.810425818f, 0.359541595f},
-std::array<float,2>{0.423656374f, 0.0648487583f},
-std::array<float,2>{0.979685128f, 0.881823361f},
-std::array<float,2>{0.09361092f, 0.729712725f},
-std::array<float,2>{0.687879384f, 0.495888144f},
-std::array<float,2>{0.187247053f, 0.342139333f},
-std::array<float,2>{0.537013471f, 0.532979667f},
-std::array<float,2>{0.284012645f, 0.806409657f},
-std::array<float,2>{0.858366609f, 0.19204253f},
-std::array<float,2>{0.341803581f, 0.401259899f},
-std::array<float,2>{0.774517775f, 0.628251135f},
-std::array<float,2>{0.187990338f, 0.995546281f},
-std::array<float,2>{0.576776922f, 0.0272559598f},
-std::array<float,2>{0.0126355337f, 0.160279363f},
-std::array<float,2>{0.651646018f, 0.861416399f},
-std::array<float,2>{0.48353374f, 0.56642586f},
-std::array<float,2>{0.920341551f, 0.276395738f},
-std::array<float,2>{0.250122249f, 0.226855785f},
-std::array<float,2>{0.817233443f, 0.779473782f},
-std::array<float,2>{0.126894355f, 0.529489517f},
-std::array<float,2>{0.5179497f, 0.371891528f},
-std::array<float,2>{0.123550802f, 0.445690632f},
-std::array<float,2>{0.738194525f, 0.700398564f},
-std::array<float,2>{0.396291316f, 0.927699089f},
-std::array<float,2>{0.941889942f, 0.12049251f},
-std::array<float,2>{0.44637236f, 0.305321425f},
-std::array<float,2>{0.89830488f, 0.61254108f},
-std::array<float,2>{0.0522286445f, 0.826182544f},
-std::array<float,2>{0.675772011f, 0.149836436f},
-std::array<float,2>{0.221051455f, 0.0481823236f},
-std::array<float,2>{0.609705508f, 0.958397806f},
-std::array<float,2>{0.352302015f, 0.683283508f},
-std::array<float,2>{0.789905846f, 0.415936887f},
-std::array<float,2>{0.491395354f, 0.128123537f},
-std::array<float,2>{0.93745178f, 0.843373835f},
-std::array<float,2>{0.02051262f, 0.595701158f},
-std::array<float,2>{0.635770559f, 0.286544621f},
-std::array<float,2>{0.204124555f, 0.435250252f},
-std::array<float,2>{0.580918849f, 0.670589626f},
-std::array<float,2>{0.312566787f, 0.946786523f},
-std::array<float,2>{0.752241075f, 0.0319194458f},
-std::array<float,2>{0.303050429f, 0.344542384f},
-std::array<float,2>{0.868685126f, 0.510687172f},
-std::array<float,2>{0.162372589f, 0.759262383f},
-std::array<float,2>{0.552150726f, 0.249588415f},
-std::array<float,2>{0.0628685877f, 0.100877285f},
-std::array<float,2>{0.713468909f, 0.916106522f},
-std::array<float,2>{0.41248861f, 0.71296972f},
-std::array<float,2>{0.997337997f, 0.453564495f},
-std::array<float,2>{0.367666543f, 0.00679907715f},
-std::array<float,2>{0.807394087f, 0.98403579f},
-std::array<float,2>{0.237122431f, 0.648925304f},
-std::array<float,2>{0.606950045f, 0.382540911f},
-std::array<float,2>{0.0439098701f, 0.252828866f},
-std::array<float,2>{0.661213517f, 0.585399866f},
-std::array<float,2>{0.453326285f, 0.847506285f},
-std::array<float,2>{0.883018255f, 0.177347034f},
-std::array<float,2>{0.384642899f, 0.478022933f},
-std::array<float,2>{0.96372205f, 0.737323344f},
-std::array<float,2>{0.0992940739f, 0.901775181f},
-std::array<float,2>{0.728396773f, 0.0928047374f},
-std::array<float,2>{0.146380857f, 0.217801228f},
-std::array<float,2>{0.514874876f, 0.793887079f},
-std::array<float,2>{0.275402695f, 0.562034905f},
-std::array<float,2>{0.840919852f, 0.313324481f},
-std::array<float,2>{0.46528852f, 0.0426295027f},
-std::array<float,2>{0.87636584f, 0.942282021f},
-std::array<float,2>{0.03409658f, 0.66125077f},
-std::array<float,2>{0.666377962f, 0.429567754f},
-std::array<float,2>{0.246534646f, 0.292172432f},
-std::array<float,2>{0.597184539f, 0.605007708f},
-std::array<float,2>{0.362161964f, 0.831882298f},
-std::array<float,2>{0.799349606f, 0.13619718f},
-std::array<float,2>{0.265685618f, 0.468417734f},
-std::array<float,2>{0.833403885f, 0.703266203f},
-std::array<float,2>{0.155130759f, 0.906418324f},
-std::array<float,2>{0.501820207f, 0.108333342f},
-std::array<float,2>{0.107696585f, 0.241064608f},
-std::array<float,2>{0.719383597f, 0.75153935f},
-std::array<float,2>{0.382510811f, 0.505770743f},
-std::array<float,2>{0.954511404f, 0.358971715f},
-std::array<float,2>{0.323467016f, 0.180121392f},
-std::array<float,2>{0.758095682f, 0.852981091f},
-std::array<float,2>{0.213948518f, 0.586758733f},
-std::array<float,2>{0.587298989f, 0.263734102f},
-std::array<float,2>{0.0253993832f, 0.386217564f},
-std::array<float,2>{0.630405247f, 0.642052293f},
-std::array<float,2>{0.495391011f, 0.976033866f},
-std::array<float,2>{0.922195196f, 0.0102698877f},
-std::array<float,2>{0.414082915f, 0.322227091f},
-std::array<float,2>{0.991620064f, 0.548023164f},
-std::array<float,2>{0.0735034049f, 0.781842053f},
-std::array<float,2>{0.710339606f, 0.209042281f},
-std::array<float,2>{0.17031379f, 0.0816379413f},
-std::array<float,2>{0.562269688f, 0.891535699f},
-std::array<float,2>{0.304907173f, 0.748107493f},
-std::array<float,2>{0.859900475f, 0.471209586f},
-std::array<float,2>{0.399522632f, 0.200445816f},
-std::array<float,2>{0.952983916f, 0.801467538f},
-std::array<float,2>{0.114650361f, 0.540682554f},
-std::array<float,2>{0.743192017f, 0.335836738f},
-std::array<float,2>{0.137951359f, 0.491537482f},
-std::array<float,2>{0.528918505f, 0.72143966f},
-std::array<float,2>{0.260899425f, 0.888025939f},
-std::array<float,2>{0.827775598f, 0.0736961663f},
-std::array<float,2>{0.346846133f, 0.273031086f},
-std::array<float,2>{0.78270793f, 0.57311964f},
-std::array<float,2>{0.231474072f, 0.869939327f},
-std::array<float,2>{0.617948711f, 0.168635607f},
-std::array<float,2>{0.0594205074f, 0.0159878898f},
-std::array<float,2>{0.680337191f, 0.984562457f},
-std::array<float,2>{0.444681913f, 0.635904253f},
-std::array<float,2>{0.905994058f, 0.394385785f},
-std::array<float,2>{0.295854747f, 0.116798602f},
-std::array<float,2>{0.845890284f, 0.930877686f},
-std::array<float,2>{0.172157452f, 0.690832615f},
-std::array<float,2>{0.541250646f, 0.443070799f},
-std::array<float,2>{0.0822729468f, 0.366740257f},
-std::array<float,2>{0.699112594f, 0.522257268f},
-std::array<float,2>{0.43468672f, 0.771933258f},
-std::array<float,2>{0.974711895f, 0.22217384f},
-std::array<float,2>{0.476507604f, 0.411867678f},
-std::array<float,2>{0.907701492f, 0.672703028f},
-std::array<float,2>{0.00140451954f, 0.964109361f},
-std::array<float,2>{0.642564654f, 0.05513639f},
-std::array<float,2>{0.201039001f, 0.145066902f},
-std::array<float,2>{0.569615006f, 0.818555176f},
-std::array<float,2>{0.335183591f, 0.623773873f},
-std::array<float,2>{0.76841867f, 0.302429706f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.811066687f, 0.00364720193f},
-std::array<float,2>{0.319407463f, 0.78389591f},
-std::array<float,2>{0.621715605f, 0.595822275f},
-std::array<float,2>{0.139437214f, 0.481203079f},
-std::array<float,2>{0.658839047f, 0.369148701f},
-std::array<float,2>{0.000150330874f, 0.630201817f},
-std::array<float,2>{0.903369784f, 0.892998815f},
-std::array<float,2>{0.435570866f, 0.14747943f},
-std::array<float,2>{0.506710052f, 0.240448028f},
-std::array<float,2>{0.219460294f, 0.976047873f},
-std::array<float,2>{0.82501024f, 0.746143401f},
-std::array<float,2>{0.305481225f, 0.274876863f},
-std::array<float,2>{0.984222412f, 0.392867863f},
-std::array<float,2>{0.466435999f, 0.506804109f},
-std::array<float,2>{0.707422554f, 0.842081964f},
-std::array<float,2>{0.101372138f, 0.0756866559f},
-std::array<float,2>{0.927248597f, 0.161104172f},
-std::array<float,2>{0.385118663f, 0.936765552f},
-std::array<float,2>{0.63517946f, 0.680242896f},
-std::array<float,2>{0.0547303297f, 0.318092704f},
-std::array<float,2>{0.583497167f, 0.438318789f},
-std::array<float,2>{0.158613771f, 0.566713572f},
-std::array<float,2>{0.772483587f, 0.777250886f},
-std::array<float,2>{0.34864527f, 0.0387269706f},
-std::array<float,2>{0.726120412f, 0.121596321f},
-std::array<float,2>{0.0687082857f, 0.865964413f},
-std::array<float,2>{0.944956958f, 0.538973212f},
-std::array<float,2>{0.469348967f, 0.426806301f},
-std::array<float,2>{0.864392161f, 0.310523838f},
-std::array<float,2>{0.263524801f, 0.689099133f},
-std::array<float,2>{0.555678725f, 0.966477811f},
-std::array<float,2>{0.195137143f, 0.203715771f},
-std::array<float,2>{0.837300837f, 0.199201733f},
-std::array<float,2>{0.282038003f, 0.945676804f},
-std::array<float,2>{0.519323468f, 0.706045806f},
-std::array<float,2>{0.247891933f, 0.288563192f},
-std::array<float,2>{0.696377158f, 0.414536059f},
-std::array<float,2>{0.123898722f, 0.548352301f},
-std::array<float,2>{0.992726386f, 0.858823121f},
-std::array<float,2>{0.443860054f, 0.107382603f},
-std::array<float,2>{0.606138825f, 0.0532891452f},
-std::array<float,2>{0.145048901f, 0.759334266f},
-std::array<float,2>{0.787259758f, 0.584214389f},
-std::array<float,2>{0.329581112f, 0.453937113f},
-std::array<float,2>{0.876457751f, 0.343251556f},
-std::array<float,2>{0.414193064f, 0.665750861f},
-std::array<float,2>{0.679953635f, 0.908787251f},
-std::array<float,2>{0.0222014692f, 0.181498662f},
-std::array<float,2>{0.953480959f, 0.0916178823f},
-std::array<float,2>{0.497580886f, 0.815121174f},
-std::array<float,2>{0.742057443f, 0.521073043f},
-std::array<float,2>{0.0801563337f, 0.375357658f},
-std::array<float,2>{0.545179665f, 0.262109697f},
-std::array<float,2>{0.215581045f, 0.726353288f},
-std::array<float,2>{0.851814628f, 0.987163007f},
-std::array<float,2>{0.269528061f, 0.221393898f},
-std::array<float,2>{0.644724607f, 0.127693668f},
-std::array<float,2>{0.0335843936f, 0.877921343f},
-std::array<float,2>{0.910722375f, 0.642062068f},
-std::array<float,2>{0.401128769f, 0.3517676f},
-std::array<float,2>{0.750460684f, 0.486164033f},
-std::array<float,2>{0.362328023f, 0.616068184f},
-std::array<float,2>{0.563278019f, 0.802885294f},
-std::array<float,2>{0.182716638f, 0.0229024012f},
-std::array<float,2>{0.848245382f, 0.0951801986f},
-std::array<float,2>{0.273941785f, 0.845150054f},
-std::array<float,2>{0.53629607f, 0.560155392f},
-std::array<float,2>{0.210118562f, 0.412822157f},
-std::array<float,2>{0.743732214f, 0.2963278f},
-std::array<float,2>{0.0901641324f, 0.713681459f},
-std::array<float,2>{0.964541554f, 0.938089669f},
-std::array<float,2>{0.492013752f, 0.194697976f},
-std::array<float,2>{0.573373675f, 0.172895163f},
-std::array<float,2>{0.176669478f, 0.921634614f},
-std::array<float,2>{0.764391422f, 0.660997629f},
-std::array<float,2>{0.367687672f, 0.330753833f},
-std::array<float,2>{0.920645773f, 0.468485683f},
-std::array<float,2>{0.394926459f, 0.588831663f},
-std::array<float,2>{0.655014217f, 0.753243208f},
-std::array<float,2>{0.0414924882f, 0.0584814325f},
-std::array<float,2>{0.984410167f, 0.23258093f},
-std::array<float,2>{0.448532254f, 0.997450531f},
-std::array<float,2>{0.690285683f, 0.730320692f},
-std::array<float,2>{0.115363009f, 0.254357994f},
-std::array<float,2>{0.52609551f, 0.386037022f},
-std::array<float,2>{0.235092387f, 0.531161606f},
-std::array<float,2>{0.835593104f, 0.827529788f},
-std::array<float,2>{0.292004883f, 0.0814223662f},
-std::array<float,2>{0.676423013f, 0.0301047359f},
-std::array<float,2>{0.0282529928f, 0.808374524f},
-std::array<float,2>{0.889302254f, 0.622526884f},
-std::array<float,2>{0.411131263f, 0.498053789f},
-std::array<float,2>{0.789997399f, 0.349072576f},
-std::array<float,2>{0.339186132f, 0.655534387f},
-std::array<float,2>{0.600725472f, 0.884219706f},
-std::array<float,2>{0.152655005f, 0.134046033f},
-std::array<float,2>{0.77970767f, 0.156154811f},
-std::array<float,2>{0.357096314f, 0.902650476f},
-std::array<float,2>{0.589262068f, 0.638328791f},
-std::array<float,2>{0.167833671f, 0.366490424f},
-std::array<float,2>{0.630451202f, 0.470414758f},
-std::array<float,2>{0.0535875298f, 0.606101692f},
-std::array<float,2>{0.931250513f, 0.790700853f},
-std::array<float,2>{0.379447967f, 0.011462424f},
-std::array<float,2>{0.550049484f, 0.0694938675f},
-std::array<float,2>{0.202896059f, 0.830000937f},
-std::array<float,2>{0.8690359f, 0.514109612f},
-std::array<float,2>{0.251014084f, 0.402596146f},
-std::array<float,2>{0.947009683f, 0.269174457f},
-std::array<float,2>{0.477661312f, 0.740733027f},
-std::array<float,2>{0.732401311f, 0.982170522f},
-std::array<float,2>{0.0758970231f, 0.245619014f},
-std::array<float,2>{0.894673049f, 0.0418458879f},
-std::array<float,2>{0.429589123f, 0.767508686f},
-std::array<float,2>{0.669601679f, 0.577798426f},
-std::array<float,2>{0.00822880305f, 0.450998366f},
-std::array<float,2>{0.609719872f, 0.323280782f},
-std::array<float,2>{0.129600063f, 0.678694129f},
-std::array<float,2>{0.799412966f, 0.928327382f},
-std::array<float,2>{0.324052602f, 0.168353826f},
-std::array<float,2>{0.712471962f, 0.216223016f},
-std::array<float,2>{0.109350272f, 0.960619509f},
-std::array<float,2>{0.970283747f, 0.698140442f},
-std::array<float,2>{0.453411639f, 0.304397672f},
-std::array<float,2>{0.816760778f, 0.436446369f},
-std::array<float,2>{0.299830973f, 0.543153763f},
-std::array<float,2>{0.511799932f, 0.870573938f},
-std::array<float,2>{0.2332277f, 0.11220821f},
-std::array<float,2>{0.761536062f, 0.072747089f},
-std::array<float,2>{0.374181688f, 0.839827895f},
-std::array<float,2>{0.574435174f, 0.500079155f},
-std::array<float,2>{0.1728632f, 0.396129638f},
-std::array<float,2>{0.650793016f, 0.277409106f},
-std::array<float,2>{0.0433507301f, 0.742715955f},
-std::array<float,2>{0.914086938f, 0.96940589f},
-std::array<float,2>{0.393500507f, 0.237596393f},
-std::array<float,2>{0.534533143f, 0.140834332f},
-std::array<float,2>{0.204987302f, 0.896225989f},
-std::array<float,2>{0.84761256f, 0.628422737f},
-std::array<float,2>{0.278075069f, 0.373437852f},
-std::array<float,2>{0.966817081f, 0.476937741f},
-std::array<float,2>{0.485083312f, 0.599425972f},
-std::array<float,2>{0.74840337f, 0.787537634f},
-std::array<float,2>{0.0862755254f, 0.00723760622f},
-std::array<float,2>{0.884270132f, 0.210421816f},
-std::array<float,2>{0.407055974f, 0.961762011f},
-std::array<float,2>{0.672526598f, 0.69439286f},
-std::array<float,2>{0.0251364689f, 0.306641608f},
-std::array<float,2>{0.595104516f, 0.425444335f},
-std::array<float,2>{0.148971885f, 0.531708896f},
-std::array<float,2>{0.794976354f, 0.860435963f},
-std::array<float,2>{0.342164963f, 0.11744722f},
-std::array<float,2>{0.692226052f, 0.0319327004f},
-std::array<float,2>{0.11100623f, 0.779440224f},
-std::array<float,2>{0.989732027f, 0.563862741f},
-std::array<float,2>{0.451201707f, 0.444504321f},
-std::array<float,2>{0.828925371f, 0.315449208f},
-std::array<float,2>{0.296441883f, 0.685080349f},
-std::array<float,2>{0.529246747f, 0.932297468f},
-std::array<float,2>{0.241323337f, 0.15881063f},
-std::array<float,2>{0.874931753f, 0.183753073f},
-std::array<float,2>{0.254185796f, 0.912122667f},
-std::array<float,2>{0.551020801f, 0.669617474f},
-std::array<float,2>{0.196412787f, 0.336537093f},
-std::array<float,2>{0.728838742f, 0.45880273f},
-std::array<float,2>{0.072450459f, 0.580981374f},
-std::array<float,2>{0.952847004f, 0.764541626f},
-std::array<float,2>{0.482578427f, 0.048901096f},
-std::array<float,2>{0.591596246f, 0.102899849f},
-std::array<float,2>{0.168004945f, 0.854120851f},
-std::array<float,2>{0.776037574f, 0.553173423f},
-std::array<float,2>{0.351570785f, 0.419111103f},
-std::array<float,2>{0.934839666f, 0.284748793f},
-std::array<float,2>{0.375997752f, 0.707446814f},
-std::array<float,2>{0.625296831f, 0.953072071f},
-std::array<float,2>{0.0476154201f, 0.199584886f},
-std::array<float,2>{0.976139009f, 0.0179603472f},
-std::array<float,2>{0.460279733f, 0.797799349f},
-std::array<float,2>{0.718192697f, 0.611854315f},
-std::array<float,2>{0.103287674f, 0.490081847f},
-std::array<float,2>{0.510666847f, 0.359312087f},
-std::array<float,2>{0.229197338f, 0.644928277f},
-std::array<float,2>{0.81447953f, 0.879638255f},
-std::array<float,2>{0.302641302f, 0.129946738f},
-std::array<float,2>{0.666979492f, 0.224323258f},
-std::array<float,2>{0.0145563809f, 0.988671243f},
-std::array<float,2>{0.891552985f, 0.7188977f},
-std::array<float,2>{0.423995703f, 0.259395748f},
-std::array<float,2>{0.803356826f, 0.379582703f},
-std::array<float,2>{0.324659258f, 0.517847836f},
-std::array<float,2>{0.615055859f, 0.816598415f},
-std::array<float,2>{0.128059655f, 0.0890245065f},
-std::array<float,2>{0.823594332f, 0.0621589534f},
-std::array<float,2>{0.311549962f, 0.757208943f},
-std::array<float,2>{0.503793359f, 0.593108594f},
-std::array<float,2>{0.223434389f, 0.463335752f},
-std::array<float,2>{0.705800354f, 0.333556473f},
-std::array<float,2>{0.0949428529f, 0.658355296f},
-std::array<float,2>{0.978055179f, 0.915996015f},
-std::array<float,2>{0.462557942f, 0.179426327f},
-std::array<float,2>{0.617690325f, 0.190658137f},
-std::array<float,2>{0.13340275f, 0.944616914f},
-std::array<float,2>{0.806471407f, 0.715554893f},
-std::array<float,2>{0.315098703f, 0.289271384f},
-std::array<float,2>{0.90048641f, 0.409922689f},
-std::array<float,2>{0.432130128f, 0.555982232f},
-std::array<float,2>{0.66379118f, 0.850988269f},
-std::array<float,2>{0.00505965669f, 0.0985940471f},
-std::array<float,2>{0.939546824f, 0.138670132f},
-std::array<float,2>{0.475873351f, 0.88731575f},
-std::array<float,2>{0.722439766f, 0.648690283f},
-std::array<float,2>{0.066192627f, 0.346583486f},
-std::array<float,2>{0.561949193f, 0.492505193f},
-std::array<float,2>{0.18806532f, 0.620388448f},
-std::array<float,2>{0.862778604f, 0.809435964f},
-std::array<float,2>{0.260784417f, 0.0249749925f},
-std::array<float,2>{0.639886141f, 0.0829415247f},
-std::array<float,2>{0.0619449653f, 0.822931767f},
-std::array<float,2>{0.925410986f, 0.526161492f},
-std::array<float,2>{0.389206886f, 0.387888879f},
-std::array<float,2>{0.766197979f, 0.253130287f},
-std::array<float,2>{0.347120583f, 0.73284632f},
-std::array<float,2>{0.578571796f, 0.99507618f},
-std::array<float,2>{0.161500648f, 0.228607476f},
-std::array<float,2>{0.785040319f, 0.247721091f},
-std::array<float,2>{0.334898502f, 0.977393627f},
-std::array<float,2>{0.605273902f, 0.73471266f},
-std::array<float,2>{0.142452151f, 0.271251798f},
-std::array<float,2>{0.68491298f, 0.399326146f},
-std::array<float,2>{0.0193750244f, 0.510610998f},
-std::array<float,2>{0.88084203f, 0.832069874f},
-std::array<float,2>{0.42063117f, 0.0660162866f},
-std::array<float,2>{0.52198559f, 0.0146386633f},
-std::array<float,2>{0.244622663f, 0.793643653f},
-std::array<float,2>{0.841530383f, 0.601873994f},
-std::array<float,2>{0.288694531f, 0.476076126f},
-std::array<float,2>{0.999764323f, 0.359459937f},
-std::array<float,2>{0.441059083f, 0.635025978f},
-std::array<float,2>{0.702010572f, 0.89909339f},
-std::array<float,2>{0.117269859f, 0.148597866f},
-std::array<float,2>{0.907286286f, 0.114514962f},
-std::array<float,2>{0.40442884f, 0.874398053f},
-std::array<float,2>{0.641871154f, 0.540722847f},
-std::array<float,2>{0.0356614217f, 0.430276364f},
-std::array<float,2>{0.567371547f, 0.298201889f},
-std::array<float,2>{0.186385483f, 0.702557087f},
-std::array<float,2>{0.753959298f, 0.955548882f},
-std::array<float,2>{0.365772307f, 0.213657781f},
-std::array<float,2>{0.735169709f, 0.167001799f},
-std::array<float,2>{0.0851223618f, 0.92489779f},
-std::array<float,2>{0.960203946f, 0.675054252f},
-std::array<float,2>{0.494843155f, 0.326066077f},
-std::array<float,2>{0.855781734f, 0.447984695f},
-std::array<float,2>{0.272893339f, 0.573291123f},
-std::array<float,2>{0.540528178f, 0.770611167f},
-std::array<float,2>{0.211821198f, 0.0457568429f},
-std::array<float,2>{0.771025002f, 0.0364536196f},
-std::array<float,2>{0.350270927f, 0.774322629f},
-std::array<float,2>{0.584919631f, 0.569021821f},
-std::array<float,2>{0.156421885f, 0.440573573f},
-std::array<float,2>{0.633788586f, 0.318467438f},
-std::array<float,2>{0.0582796596f, 0.682646036f},
-std::array<float,2>{0.929365873f, 0.93363905f},
-std::array<float,2>{0.384158194f, 0.163593069f},
-std::array<float,2>{0.557565331f, 0.20651263f},
-std::array<float,2>{0.193094909f, 0.968545556f},
-std::array<float,2>{0.866879463f, 0.690081239f},
-std::array<float,2>{0.263795972f, 0.311319143f},
-std::array<float,2>{0.942453742f, 0.429214597f},
-std::array<float,2>{0.471746564f, 0.536367655f},
-std::array<float,2>{0.722823441f, 0.864185393f},
-std::array<float,2>{0.0677214488f, 0.124265045f},
-std::array<float,2>{0.90514487f, 0.144836336f},
-std::array<float,2>{0.434871703f, 0.891454995f},
-std::array<float,2>{0.65802598f, 0.631311297f},
-std::array<float,2>{0.00238271127f, 0.368211001f},
-std::array<float,2>{0.624018252f, 0.483298838f},
-std::array<float,2>{0.137502924f, 0.595123529f},
-std::array<float,2>{0.808774889f, 0.782463908f},
-std::array<float,2>{0.318186462f, 0.00144346827f},
-std::array<float,2>{0.710213661f, 0.0774384812f},
-std::array<float,2>{0.099607341f, 0.84076494f},
-std::array<float,2>{0.981391609f, 0.504663348f},
-std::array<float,2>{0.468702883f, 0.391558886f},
-std::array<float,2>{0.826462626f, 0.276981384f},
-std::array<float,2>{0.308492422f, 0.748550475f},
-std::array<float,2>{0.504838705f, 0.973296463f},
-std::array<float,2>{0.222246066f, 0.239858583f},
-std::array<float,2>{0.855393171f, 0.219777316f},
-std::array<float,2>{0.267042696f, 0.984985352f},
-std::array<float,2>{0.544127762f, 0.72298032f},
-std::array<float,2>{0.216819286f, 0.265512586f},
-std::array<float,2>{0.739836276f, 0.377641022f},
-std::array<float,2>{0.0794795975f, 0.522988141f},
-std::array<float,2>{0.956417203f, 0.813522518f},
-std::array<float,2>{0.49982512f, 0.0926909894f},
-std::array<float,2>{0.564581454f, 0.0210152213f},
-std::array<float,2>{0.180247158f, 0.80216074f},
-std::array<float,2>{0.752341449f, 0.614962399f},
-std::array<float,2>{0.359951317f, 0.487742484f},
-std::array<float,2>{0.9134835f, 0.354879946f},
-std::array<float,2>{0.400350064f, 0.643989027f},
-std::array<float,2>{0.647843182f, 0.875761092f},
-std::array<float,2>{0.0319302119f, 0.125783056f},
-std::array<float,2>{0.995381892f, 0.107978381f},
-std::array<float,2>{0.44227612f, 0.856120706f},
-std::array<float,2>{0.697497189f, 0.5492028f},
-std::array<float,2>{0.121687636f, 0.416060865f},
-std::array<float,2>{0.516433179f, 0.285976291f},
-std::array<float,2>{0.248666093f, 0.705042422f},
-std::array<float,2>{0.83981055f, 0.948992014f},
-std::array<float,2>{0.284860343f, 0.195988089f},
-std::array<float,2>{0.682387531f, 0.181744069f},
-std::array<float,2>{0.021289885f, 0.907982171f},
-std::array<float,2>{0.877919018f, 0.666941524f},
-std::array<float,2>{0.416805118f, 0.340618581f},
-std::array<float,2>{0.786506653f, 0.456981063f},
-std::array<float,2>{0.331224173f, 0.582357585f},
-std::array<float,2>{0.608043015f, 0.760038197f},
-std::array<float,2>{0.147918776f, 0.0513895564f},
-std::array<float,2>{0.83238554f, 0.0797764063f},
-std::array<float,2>{0.289957434f, 0.825623572f},
-std::array<float,2>{0.525214076f, 0.528752804f},
-std::array<float,2>{0.23797974f, 0.384692788f},
-std::array<float,2>{0.689040303f, 0.256204337f},
-std::array<float,2>{0.114480406f, 0.728429675f},
-std::array<float,2>{0.987585366f, 0.998614132f},
-std::array<float,2>{0.445970327f, 0.231127486f},
-std::array<float,2>{0.598667562f, 0.135083884f},
-std::array<float,2>{0.155828759f, 0.886678457f},
-std::array<float,2>{0.791312277f, 0.654150426f},
-std::array<float,2>{0.3371602f, 0.351172268f},
-std::array<float,2>{0.887079775f, 0.496692896f},
-std::array<float,2>{0.412453443f, 0.623768628f},
-std::array<float,2>{0.678669035f, 0.805265188f},
-std::array<float,2>{0.0296380296f, 0.0282290019f},
-std::array<float,2>{0.961700082f, 0.191736773f},
-std::array<float,2>{0.488951832f, 0.939996779f},
-std::array<float,2>{0.744694412f, 0.71204561f},
-std::array<float,2>{0.0927396044f, 0.294230759f},
-std::array<float,2>{0.537296176f, 0.411896944f},
-std::array<float,2>{0.208812118f, 0.561446607f},
-std::array<float,2>{0.851529121f, 0.846315742f},
-std::array<float,2>{0.275420517f, 0.0961780995f},
-std::array<float,2>{0.654248953f, 0.0566225797f},
-std::array<float,2>{0.0406556129f, 0.750913501f},
-std::array<float,2>{0.919328928f, 0.587510467f},
-std::array<float,2>{0.398153841f, 0.465421587f},
-std::array<float,2>{0.76285404f, 0.328897029f},
-std::array<float,2>{0.370180488f, 0.662639856f},
-std::array<float,2>{0.571877718f, 0.919371188f},
-std::array<float,2>{0.178307608f, 0.174776003f},
-std::array<float,2>{0.798668504f, 0.171403453f},
-std::array<float,2>{0.321549624f, 0.926551461f},
-std::array<float,2>{0.611741126f, 0.675998151f},
-std::array<float,2>{0.131265074f, 0.320906639f},
-std::array<float,2>{0.670429349f, 0.45305416f},
-std::array<float,2>{0.01021396f, 0.574687779f},
-std::array<float,2>{0.896495283f, 0.768665433f},
-std::array<float,2>{0.426890254f, 0.0392809696f},
-std::array<float,2>{0.515063822f, 0.110721558f},
-std::array<float,2>{0.23212707f, 0.868728101f},
-std::array<float,2>{0.819892526f, 0.546463728f},
-std::array<float,2>{0.297928959f, 0.434216529f},
-std::array<float,2>{0.97082901f, 0.302310765f},
-std::array<float,2>{0.456318885f, 0.696180284f},
-std::array<float,2>{0.714166284f, 0.957092583f},
-std::array<float,2>{0.106207334f, 0.216812804f},
-std::array<float,2>{0.932876885f, 0.00832653698f},
-std::array<float,2>{0.381402522f, 0.792621553f},
-std::array<float,2>{0.631983697f, 0.60762006f},
-std::array<float,2>{0.0525220782f, 0.470718533f},
-std::array<float,2>{0.586378694f, 0.363879949f},
-std::array<float,2>{0.165406808f, 0.640190721f},
-std::array<float,2>{0.778755307f, 0.905900598f},
-std::array<float,2>{0.357954562f, 0.152358726f},
-std::array<float,2>{0.733922124f, 0.243674338f},
-std::array<float,2>{0.0779675394f, 0.983091295f},
-std::array<float,2>{0.948967338f, 0.740124822f},
-std::array<float,2>{0.478867054f, 0.265826464f},
-std::array<float,2>{0.870841801f, 0.404658496f},
-std::array<float,2>{0.252181202f, 0.513012886f},
-std::array<float,2>{0.548490345f, 0.831571341f},
-std::array<float,2>{0.201113641f, 0.0669146106f},
-std::array<float,2>{0.794179857f, 0.119378649f},
-std::array<float,2>{0.341141313f, 0.861475885f},
-std::array<float,2>{0.595971763f, 0.534916639f},
-std::array<float,2>{0.151315108f, 0.42350167f},
-std::array<float,2>{0.673995435f, 0.306240618f},
-std::array<float,2>{0.027195042f, 0.691547513f},
-std::array<float,2>{0.885880649f, 0.962970138f},
-std::array<float,2>{0.408278048f, 0.207473591f},
-std::array<float,2>{0.531174302f, 0.156619221f},
-std::array<float,2>{0.238919169f, 0.930445313f},
-std::array<float,2>{0.830915928f, 0.686055005f},
-std::array<float,2>{0.293363184f, 0.312663794f},
-std::array<float,2>{0.990531206f, 0.443338513f},
-std::array<float,2>{0.449552238f, 0.565130472f},
-std::array<float,2>{0.693720222f, 0.778907835f},
-std::array<float,2>{0.112390324f, 0.0339783281f},
-std::array<float,2>{0.916745245f, 0.235537574f},
-std::array<float,2>{0.391167551f, 0.972326994f},
-std::array<float,2>{0.648437679f, 0.745497644f},
-std::array<float,2>{0.0453666039f, 0.281200469f},
-std::array<float,2>{0.577844977f, 0.397747517f},
-std::array<float,2>{0.174128085f, 0.503213406f},
-std::array<float,2>{0.758336186f, 0.836435378f},
-std::array<float,2>{0.372329772f, 0.0717239678f},
-std::array<float,2>{0.746238887f, 0.00391500071f},
-std::array<float,2>{0.0889841691f, 0.786229551f},
-std::array<float,2>{0.965538085f, 0.600657284f},
-std::array<float,2>{0.487787038f, 0.479819387f},
-std::array<float,2>{0.844126403f, 0.372323394f},
-std::array<float,2>{0.280617774f, 0.625073791f},
-std::array<float,2>{0.531563699f, 0.896924973f},
-std::array<float,2>{0.206174657f, 0.143664047f},
-std::array<float,2>{0.812797606f, 0.131042942f},
-std::array<float,2>{0.303562522f, 0.88236171f},
-std::array<float,2>{0.509164691f, 0.647042751f},
-std::array<float,2>{0.227690518f, 0.355491936f},
-std::array<float,2>{0.716010153f, 0.490557104f},
-std::array<float,2>{0.104483984f, 0.609852731f},
-std::array<float,2>{0.974493861f, 0.799076021f},
-std::array<float,2>{0.458828062f, 0.0171750505f},
-std::array<float,2>{0.615591407f, 0.0863391235f},
-std::array<float,2>{0.12506184f, 0.81983918f},
-std::array<float,2>{0.802245677f, 0.51727879f},
-std::array<float,2>{0.32780537f, 0.382413387f},
-std::array<float,2>{0.894113243f, 0.260930091f},
-std::array<float,2>{0.422719568f, 0.721607149f},
-std::array<float,2>{0.665759027f, 0.990491688f},
-std::array<float,2>{0.0129267843f, 0.225643545f},
-std::array<float,2>{0.950235903f, 0.0487475842f},
-std::array<float,2>{0.480511636f, 0.762459993f},
-std::array<float,2>{0.727943838f, 0.579979599f},
-std::array<float,2>{0.0719878376f, 0.460767657f},
-std::array<float,2>{0.552884281f, 0.338686198f},
-std::array<float,2>{0.197669029f, 0.670478523f},
-std::array<float,2>{0.871525526f, 0.911204934f},
-std::array<float,2>{0.255993843f, 0.186082348f},
-std::array<float,2>{0.628326476f, 0.20140484f},
-std::array<float,2>{0.0491851941f, 0.951110065f},
-std::array<float,2>{0.937397182f, 0.710037291f},
-std::array<float,2>{0.377601534f, 0.282939881f},
-std::array<float,2>{0.774298191f, 0.421187371f},
-std::array<float,2>{0.354480952f, 0.552581787f},
-std::array<float,2>{0.592239857f, 0.852364063f},
-std::array<float,2>{0.171650156f, 0.10524907f},
-std::array<float,2>{0.860200405f, 0.0256845783f},
-std::array<float,2>{0.257823765f, 0.812115908f},
-std::array<float,2>{0.55962348f, 0.617673278f},
-std::array<float,2>{0.190118432f, 0.494171381f},
-std::array<float,2>{0.719047368f, 0.34537819f},
-std::array<float,2>{0.0636204779f, 0.650409222f},
-std::array<float,2>{0.93860203f, 0.889066279f},
-std::array<float,2>{0.472756922f, 0.139536038f},
-std::array<float,2>{0.581454694f, 0.227000624f},
-std::array<float,2>{0.163500801f, 0.993791044f},
-std::array<float,2>{0.768165827f, 0.73094964f},
-std::array<float,2>{0.344481498f, 0.25169307f},
-std::array<float,2>{0.923625052f, 0.389929265f},
-std::array<float,2>{0.387224376f, 0.523901641f},
-std::array<float,2>{0.637301922f, 0.822085083f},
-std::array<float,2>{0.0589799397f, 0.085751459f},
-std::array<float,2>{0.979768813f, 0.17646949f},
-std::array<float,2>{0.46291253f, 0.917322397f},
-std::array<float,2>{0.703869164f, 0.657834411f},
-std::array<float,2>{0.0974131152f, 0.334950805f},
-std::array<float,2>{0.500757575f, 0.461205095f},
-std::array<float,2>{0.225282431f, 0.590681493f},
-std::array<float,2>{0.821774304f, 0.754832983f},
-std::array<float,2>{0.309305191f, 0.0593561009f},
-std::array<float,2>{0.660166562f, 0.0999966413f},
-std::array<float,2>{0.00748191355f, 0.849126399f},
-std::array<float,2>{0.898861587f, 0.556853294f},
-std::array<float,2>{0.431123257f, 0.407366514f},
-std::array<float,2>{0.806988955f, 0.291449368f},
-std::array<float,2>{0.313984126f, 0.717057943f},
-std::array<float,2>{0.620196044f, 0.942574263f},
-std::array<float,2>{0.134964392f, 0.187502861f},
-std::array<float,2>{0.756620884f, 0.211499035f},
-std::array<float,2>{0.364719391f, 0.953331649f},
-std::array<float,2>{0.568387568f, 0.700561762f},
-std::array<float,2>{0.183665171f, 0.299409837f},
-std::array<float,2>{0.64403224f, 0.43357262f},
-std::array<float,2>{0.0387826562f, 0.542091668f},
-std::array<float,2>{0.908797681f, 0.871534646f},
-std::array<float,2>{0.403828353f, 0.116155684f},
-std::array<float,2>{0.541029215f, 0.0441015624f},
-std::array<float,2>{0.214211106f, 0.772762656f},
-std::array<float,2>{0.85904032f, 0.571213782f},
-std::array<float,2>{0.26954931f, 0.446640909f},
-std::array<float,2>{0.958745599f, 0.327468723f},
-std::array<float,2>{0.493651628f, 0.672846913f},
-std::array<float,2>{0.737929881f, 0.922252238f},
-std::array<float,2>{0.0831599161f, 0.165787086f},
-std::array<float,2>{0.882111073f, 0.0642026067f},
-std::array<float,2>{0.419326782f, 0.834652483f},
-std::array<float,2>{0.685624301f, 0.508165061f},
-std::array<float,2>{0.0175635386f, 0.401587248f},
-std::array<float,2>{0.601915538f, 0.273251355f},
-std::array<float,2>{0.14322716f, 0.737374008f},
-std::array<float,2>{0.781988204f, 0.980100453f},
-std::array<float,2>{0.33337447f, 0.248797581f},
-std::array<float,2>{0.700499475f, 0.151835993f},
-std::array<float,2>{0.1201832f, 0.901112795f},
-std::array<float,2>{0.996281862f, 0.634551287f},
-std::array<float,2>{0.438723385f, 0.361521482f},
-std::array<float,2>{0.842884898f, 0.474529207f},
-std::array<float,2>{0.285351723f, 0.60509938f},
-std::array<float,2>{0.521339297f, 0.796064973f},
-std::array<float,2>{0.242499307f, 0.0118959164f},
-std::array<float,2>{0.752991557f, 0.0223276615f},
-std::array<float,2>{0.360983402f, 0.804390013f},
-std::array<float,2>{0.56550312f, 0.616747737f},
-std::array<float,2>{0.181251362f, 0.484700561f},
-std::array<float,2>{0.647338629f, 0.353090823f},
-std::array<float,2>{0.0330663919f, 0.641209364f},
-std::array<float,2>{0.912675977f, 0.878845632f},
-std::array<float,2>{0.399374515f, 0.128469199f},
-std::array<float,2>{0.543175995f, 0.221744806f},
-std::array<float,2>{0.217783004f, 0.987884343f},
-std::array<float,2>{0.853624284f, 0.72543937f},
-std::array<float,2>{0.265963405f, 0.263541341f},
-std::array<float,2>{0.956020772f, 0.376365095f},
-std::array<float,2>{0.498106182f, 0.519581616f},
-std::array<float,2>{0.738451123f, 0.816125095f},
-std::array<float,2>{0.0782108903f, 0.0901887268f},
-std::array<float,2>{0.87799871f, 0.179920346f},
-std::array<float,2>{0.417537361f, 0.909507811f},
-std::array<float,2>{0.682890654f, 0.664395094f},
-std::array<float,2>{0.019605482f, 0.341885716f},
-std::array<float,2>{0.609092295f, 0.45459196f},
-std::array<float,2>{0.147098139f, 0.585195065f},
-std::array<float,2>{0.786093354f, 0.757959008f},
-std::array<float,2>{0.330980718f, 0.0540528037f},
-std::array<float,2>{0.698610604f, 0.106398642f},
-std::array<float,2>{0.122986436f, 0.85785538f},
-std::array<float,2>{0.994427323f, 0.546995282f},
-std::array<float,2>{0.44282046f, 0.41505146f},
-std::array<float,2>{0.838245273f, 0.287675261f},
-std::array<float,2>{0.2836712f, 0.706713676f},
-std::array<float,2>{0.517172039f, 0.946879089f},
-std::array<float,2>{0.249857634f, 0.1978838f},
-std::array<float,2>{0.865360379f, 0.204305708f},
-std::array<float,2>{0.265033662f, 0.965387642f},
-std::array<float,2>{0.55801338f, 0.68809855f},
-std::array<float,2>{0.191601709f, 0.30918622f},
-std::array<float,2>{0.723872781f, 0.426026732f},
-std::array<float,2>{0.0670942292f, 0.537656307f},
-std::array<float,2>{0.94207716f, 0.866654634f},
-std::array<float,2>{0.471077472f, 0.122097164f},
-std::array<float,2>{0.585062802f, 0.0380675569f},
-std::array<float,2>{0.158128038f, 0.775400519f},
-std::array<float,2>{0.769685805f, 0.567670524f},
-std::array<float,2>{0.351267964f, 0.439302623f},
-std::array<float,2>{0.92799598f, 0.31729269f},
-std::array<float,2>{0.382817775f, 0.681058586f},
-std::array<float,2>{0.634707987f, 0.936228216f},
-std::array<float,2>{0.0574711859f, 0.161805406f},
-std::array<float,2>{0.982208729f, 0.0748391673f},
-std::array<float,2>{0.467727482f, 0.843038321f},
-std::array<float,2>{0.709368169f, 0.507641971f},
-std::array<float,2>{0.0983900726f, 0.394471169f},
-std::array<float,2>{0.504925311f, 0.274181336f},
-std::array<float,2>{0.221194848f, 0.747102797f},
-std::array<float,2>{0.827453434f, 0.974744081f},
-std::array<float,2>{0.307240158f, 0.241435826f},
-std::array<float,2>{0.656298876f, 0.146932051f},
-std::array<float,2>{0.0030235236f, 0.89392972f},
-std::array<float,2>{0.90562427f, 0.629817545f},
-std::array<float,2>{0.43392086f, 0.370370954f},
-std::array<float,2>{0.810408175f, 0.481699824f},
-std::array<float,2>{0.316504627f, 0.597415984f},
-std::array<float,2>{0.624858439f, 0.784680843f},
-std::array<float,2>{0.138086662f, 0.00242255954f},
-std::array<float,2>{0.819133401f, 0.113228805f},
-std::array<float,2>{0.29744944f, 0.869510472f},
-std::array<float,2>{0.513843477f, 0.54491061f},
-std::array<float,2>{0.230754882f, 0.437422633f},
-std::array<float,2>{0.713518858f, 0.302795649f},
-std::array<float,2>{0.107020341f, 0.699198246f},
-std::array<float,2>{0.971977651f, 0.959672451f},
-std::array<float,2>{0.456050187f, 0.215773851f},
-std::array<float,2>{0.61272043f, 0.169624746f},
-std::array<float,2>{0.132210076f, 0.929395616f},
-std::array<float,2>{0.797639549f, 0.679678023f},
-std::array<float,2>{0.321089119f, 0.322650999f},
-std::array<float,2>{0.898118854f, 0.449349105f},
-std::array<float,2>{0.426486164f, 0.576826274f},
-std::array<float,2>{0.671653509f, 0.766524851f},
-std::array<float,2>{0.0109266201f, 0.0423635803f},
-std::array<float,2>{0.948230565f, 0.244798928f},
-std::array<float,2>{0.479736418f, 0.981076062f},
-std::array<float,2>{0.733318508f, 0.741735399f},
-std::array<float,2>{0.0768565387f, 0.268231809f},
-std::array<float,2>{0.547559619f, 0.403557003f},
-std::array<float,2>{0.200008914f, 0.51551795f},
-std::array<float,2>{0.869950593f, 0.828260779f},
-std::array<float,2>{0.253417164f, 0.0692725554f},
-std::array<float,2>{0.631308258f, 0.0103280367f},
-std::array<float,2>{0.0510634892f, 0.789770007f},
-std::array<float,2>{0.932038486f, 0.607291102f},
-std::array<float,2>{0.38188374f, 0.469356269f},
-std::array<float,2>{0.777700901f, 0.365774542f},
-std::array<float,2>{0.359185129f, 0.636810958f},
-std::array<float,2>{0.587752998f, 0.904139817f},
-std::array<float,2>{0.164531097f, 0.15430063f},
-std::array<float,2>{0.792048931f, 0.132923841f},
-std::array<float,2>{0.336386502f, 0.883220792f},
-std::array<float,2>{0.598063409f, 0.655091345f},
-std::array<float,2>{0.154992223f, 0.34824571f},
-std::array<float,2>{0.678952813f, 0.499619871f},
-std::array<float,2>{0.0309156422f, 0.621115506f},
-std::array<float,2>{0.887922287f, 0.807060659f},
-std::array<float,2>{0.413624465f, 0.0303753968f},
-std::array<float,2>{0.524029732f, 0.0806777701f},
-std::array<float,2>{0.236571699f, 0.826671422f},
-std::array<float,2>{0.833673894f, 0.529536724f},
-std::array<float,2>{0.290546238f, 0.385275513f},
-std::array<float,2>{0.986548245f, 0.255039543f},
-std::array<float,2>{0.446688563f, 0.729475141f},
-std::array<float,2>{0.687982917f, 0.996610999f},
-std::array<float,2>{0.114115529f, 0.233432844f},
-std::array<float,2>{0.918870866f, 0.0574691631f},
-std::array<float,2>{0.396723568f, 0.752499402f},
-std::array<float,2>{0.652418137f, 0.589314163f},
-std::array<float,2>{0.0399826467f, 0.467562199f},
-std::array<float,2>{0.571224272f, 0.331597209f},
-std::array<float,2>{0.178890035f, 0.661244214f},
-std::array<float,2>{0.762512088f, 0.920663714f},
-std::array<float,2>{0.369744897f, 0.172018141f},
-std::array<float,2>{0.74549222f, 0.194036633f},
-std::array<float,2>{0.0927818567f, 0.939237595f},
-std::array<float,2>{0.962005556f, 0.713900924f},
-std::array<float,2>{0.489776492f, 0.295703471f},
-std::array<float,2>{0.849942625f, 0.413300574f},
-std::array<float,2>{0.277307481f, 0.559430301f},
-std::array<float,2>{0.538947165f, 0.844081938f},
-std::array<float,2>{0.207637593f, 0.0937678739f},
-std::array<float,2>{0.801358461f, 0.0887613371f},
-std::array<float,2>{0.32660234f, 0.817854524f},
-std::array<float,2>{0.617144644f, 0.518647492f},
-std::array<float,2>{0.126793355f, 0.379901588f},
-std::array<float,2>{0.664515674f, 0.258743078f},
-std::array<float,2>{0.0126918834f, 0.719777048f},
-std::array<float,2>{0.893101335f, 0.989313781f},
-std::array<float,2>{0.423687786f, 0.223316863f},
-std::array<float,2>{0.508438826f, 0.12970145f},
-std::array<float,2>{0.226879179f, 0.880278885f},
-std::array<float,2>{0.813807845f, 0.645803988f},
-std::array<float,2>{0.30397442f, 0.357659638f},
-std::array<float,2>{0.972904325f, 0.488583505f},
-std::array<float,2>{0.457668036f, 0.612879217f},
-std::array<float,2>{0.715463877f, 0.798645675f},
-std::array<float,2>{0.104844943f, 0.0189606026f},
-std::array<float,2>{0.936264157f, 0.200813755f},
-std::array<float,2>{0.378881782f, 0.952002764f},
-std::array<float,2>{0.626960814f, 0.708011448f},
-std::array<float,2>{0.0505656712f, 0.284089535f},
-std::array<float,2>{0.593147278f, 0.418026417f},
-std::array<float,2>{0.170668781f, 0.554131448f},
-std::array<float,2>{0.77443707f, 0.854966819f},
-std::array<float,2>{0.354565263f, 0.102437906f},
-std::array<float,2>{0.727390826f, 0.0504177138f},
-std::array<float,2>{0.0704551116f, 0.765415192f},
-std::array<float,2>{0.94926542f, 0.581670225f},
-std::array<float,2>{0.481505305f, 0.457956851f},
-std::array<float,2>{0.872723103f, 0.337422997f},
-std::array<float,2>{0.257158458f, 0.66874671f},
-std::array<float,2>{0.554501534f, 0.913166404f},
-std::array<float,2>{0.198260233f, 0.1854188f},
-std::array<float,2>{0.831658661f, 0.159717485f},
-std::array<float,2>{0.29446885f, 0.932975769f},
-std::array<float,2>{0.530117214f, 0.684366167f},
-std::array<float,2>{0.239557415f, 0.315351129f},
-std::array<float,2>{0.694737375f, 0.443896681f},
-std::array<float,2>{0.112115413f, 0.563216329f},
-std::array<float,2>{0.991592944f, 0.780616224f},
-std::array<float,2>{0.450631142f, 0.0328278542f},
-std::array<float,2>{0.597131133f, 0.118364275f},
-std::array<float,2>{0.152115047f, 0.859814346f},
-std::array<float,2>{0.793575644f, 0.532774746f},
-std::array<float,2>{0.34040758f, 0.424754798f},
-std::array<float,2>{0.885424197f, 0.308309972f},
-std::array<float,2>{0.409279585f, 0.69402045f},
-std::array<float,2>{0.675515592f, 0.962662756f},
-std::array<float,2>{0.0261382572f, 0.209470719f},
-std::array<float,2>{0.96636188f, 0.00594467018f},
-std::array<float,2>{0.487272531f, 0.788686097f},
-std::array<float,2>{0.747554421f, 0.598183215f},
-std::array<float,2>{0.0879517272f, 0.478246748f},
-std::array<float,2>{0.532469809f, 0.374070406f},
-std::array<float,2>{0.205259681f, 0.627286255f},
-std::array<float,2>{0.844869554f, 0.895214498f},
-std::array<float,2>{0.280109793f, 0.142444566f},
-std::array<float,2>{0.649734378f, 0.236622751f},
-std::array<float,2>{0.0462979749f, 0.969774127f},
-std::array<float,2>{0.917900741f, 0.743816078f},
-std::array<float,2>{0.391603112f, 0.278700531f},
-std::array<float,2>{0.75964129f, 0.395265996f},
-std::array<float,2>{0.372040272f, 0.501196504f},
-std::array<float,2>{0.576517999f, 0.838308811f},
-std::array<float,2>{0.175007328f, 0.0734489858f},
-std::array<float,2>{0.857953668f, 0.0465982966f},
-std::array<float,2>{0.271411031f, 0.770442963f},
-std::array<float,2>{0.542896748f, 0.572304606f},
-std::array<float,2>{0.213762045f, 0.448689371f},
-std::array<float,2>{0.736844778f, 0.324492574f},
-std::array<float,2>{0.0828767791f, 0.67444849f},
-std::array<float,2>{0.957340837f, 0.924709499f},
-std::array<float,2>{0.49278146f, 0.166949034f},
-std::array<float,2>{0.569628298f, 0.214318052f},
-std::array<float,2>{0.185287669f, 0.956400454f},
-std::array<float,2>{0.757710516f, 0.701919913f},
-std::array<float,2>{0.363318563f, 0.297815502f},
-std::array<float,2>{0.909896672f, 0.431129366f},
-std::array<float,2>{0.402585864f, 0.539885521f},
-std::array<float,2>{0.643050015f, 0.873952031f},
-std::array<float,2>{0.0379323922f, 0.114165068f},
-std::array<float,2>{0.997990727f, 0.149606153f},
-std::array<float,2>{0.438008726f, 0.899995923f},
-std::array<float,2>{0.699623883f, 0.635899663f},
-std::array<float,2>{0.119832769f, 0.360507399f},
-std::array<float,2>{0.519536376f, 0.474688262f},
-std::array<float,2>{0.243814394f, 0.602597952f},
-std::array<float,2>{0.842724204f, 0.794577122f},
-std::array<float,2>{0.28692165f, 0.014850405f},
-std::array<float,2>{0.686969757f, 0.0653398633f},
-std::array<float,2>{0.0158874281f, 0.833846629f},
-std::array<float,2>{0.881817222f, 0.511091769f},
-std::array<float,2>{0.418539435f, 0.400158614f},
-std::array<float,2>{0.783186376f, 0.270506769f},
-std::array<float,2>{0.332790673f, 0.735632122f},
-std::array<float,2>{0.603398025f, 0.978391171f},
-std::array<float,2>{0.143811107f, 0.246610254f},
-std::array<float,2>{0.768764794f, 0.230275244f},
-std::array<float,2>{0.345140189f, 0.995775342f},
-std::array<float,2>{0.580612361f, 0.733945668f},
-std::array<float,2>{0.162451431f, 0.252846122f},
-std::array<float,2>{0.638495803f, 0.38740769f},
-std::array<float,2>{0.0596026592f, 0.526511669f},
-std::array<float,2>{0.922367156f, 0.823481858f},
-std::array<float,2>{0.387889534f, 0.0838804245f},
-std::array<float,2>{0.559223711f, 0.0238071512f},
-std::array<float,2>{0.191155553f, 0.810353875f},
-std::array<float,2>{0.860476315f, 0.619789183f},
-std::array<float,2>{0.259735256f, 0.493908674f},
-std::array<float,2>{0.937985837f, 0.34697634f},
-std::array<float,2>{0.474253386f, 0.650212944f},
-std::array<float,2>{0.720479608f, 0.888634443f},
-std::array<float,2>{0.0633406043f, 0.137087598f},
-std::array<float,2>{0.899494648f, 0.0991269127f},
-std::array<float,2>{0.429890901f, 0.850341797f},
-std::array<float,2>{0.661540806f, 0.554958045f},
-std::array<float,2>{0.00652001332f, 0.408573896f},
-std::array<float,2>{0.620039701f, 0.290917963f},
-std::array<float,2>{0.136066541f, 0.716523767f},
-std::array<float,2>{0.808130026f, 0.943431318f},
-std::array<float,2>{0.313112259f, 0.189724848f},
-std::array<float,2>{0.704227805f, 0.177772626f},
-std::array<float,2>{0.0963254571f, 0.914156437f},
-std::array<float,2>{0.979242265f, 0.659494877f},
-std::array<float,2>{0.463924378f, 0.332927942f},
-std::array<float,2>{0.820688128f, 0.464645624f},
-std::array<float,2>{0.310234457f, 0.592457712f},
-std::array<float,2>{0.501195669f, 0.756117582f},
-std::array<float,2>{0.226521432f, 0.0612277612f},
-std::array<float,2>{0.788620293f, 0.052220922f},
-std::array<float,2>{0.328974038f, 0.761221111f},
-std::array<float,2>{0.606742203f, 0.583892643f},
-std::array<float,2>{0.146306112f, 0.455530941f},
-std::array<float,2>{0.681556225f, 0.340827495f},
-std::array<float,2>{0.022574082f, 0.667692482f},
-std::array<float,2>{0.875508606f, 0.907085299f},
-std::array<float,2>{0.415348589f, 0.183527246f},
-std::array<float,2>{0.518063724f, 0.197066724f},
-std::array<float,2>{0.246560052f, 0.948162317f},
-std::array<float,2>{0.836556077f, 0.704090655f},
-std::array<float,2>{0.282790542f, 0.287030846f},
-std::array<float,2>{0.993488073f, 0.417452812f},
-std::array<float,2>{0.444998384f, 0.549989343f},
-std::array<float,2>{0.695908487f, 0.857297063f},
-std::array<float,2>{0.124721661f, 0.108511075f},
-std::array<float,2>{0.91202879f, 0.126721799f},
-std::array<float,2>{0.402314067f, 0.876656592f},
-std::array<float,2>{0.646042943f, 0.643036842f},
-std::array<float,2>{0.0350661539f, 0.353596628f},
-std::array<float,2>{0.563840449f, 0.487255722f},
-std::array<float,2>{0.181942061f, 0.61358422f},
-std::array<float,2>{0.751160681f, 0.801503479f},
-std::array<float,2>{0.361678302f, 0.0200594384f},
-std::array<float,2>{0.740548253f, 0.0932942778f},
-std::array<float,2>{0.0818957835f, 0.812560081f},
-std::array<float,2>{0.954612792f, 0.521828175f},
-std::array<float,2>{0.496981472f, 0.378368944f},
-std::array<float,2>{0.852671623f, 0.264259756f},
-std::array<float,2>{0.267677188f, 0.724499047f},
-std::array<float,2>{0.546653211f, 0.985824943f},
-std::array<float,2>{0.21619311f, 0.219281524f},
-std::array<float,2>{0.825750709f, 0.239166796f},
-std::array<float,2>{0.306117624f, 0.974191248f},
-std::array<float,2>{0.50747925f, 0.749945045f},
-std::array<float,2>{0.220261857f, 0.275885582f},
-std::array<float,2>{0.708779037f, 0.392043293f},
-std::array<float,2>{0.100041524f, 0.505106091f},
-std::array<float,2>{0.983209193f, 0.841671765f},
-std::array<float,2>{0.465410084f, 0.0769496784f},
-std::array<float,2>{0.622196436f, 0.000234644103f},
-std::array<float,2>{0.140353024f, 0.781716228f},
-std::array<float,2>{0.8116979f, 0.594689131f},
-std::array<float,2>{0.319067776f, 0.483892381f},
-std::array<float,2>{0.902508736f, 0.368060082f},
-std::array<float,2>{0.437018842f, 0.631895065f},
-std::array<float,2>{0.659272015f, 0.892253757f},
-std::array<float,2>{0.00101322436f, 0.146294147f},
-std::array<float,2>{0.943390548f, 0.123872124f},
-std::array<float,2>{0.470151454f, 0.865067363f},
-std::array<float,2>{0.72553879f, 0.535932243f},
-std::array<float,2>{0.0698000267f, 0.428389251f},
-std::array<float,2>{0.554995954f, 0.312253147f},
-std::array<float,2>{0.194210291f, 0.691186488f},
-std::array<float,2>{0.864128768f, 0.967336297f},
-std::array<float,2>{0.261806428f, 0.205821782f},
-std::array<float,2>{0.635743916f, 0.162368134f},
-std::array<float,2>{0.0557616726f, 0.934709191f},
-std::array<float,2>{0.926128626f, 0.682087839f},
-std::array<float,2>{0.386351764f, 0.319901556f},
-std::array<float,2>{0.77192539f, 0.44009161f},
-std::array<float,2>{0.348353654f, 0.569679618f},
-std::array<float,2>{0.582856536f, 0.774935484f},
-std::array<float,2>{0.159928188f, 0.035445828f},
-std::array<float,2>{0.867674112f, 0.0675198287f},
-std::array<float,2>{0.250321478f, 0.830146074f},
-std::array<float,2>{0.549435735f, 0.512034416f},
-std::array<float,2>{0.201873869f, 0.406131119f},
-std::array<float,2>{0.731183946f, 0.266762108f},
-std::array<float,2>{0.0747685134f, 0.738427281f},
-std::array<float,2>{0.945955038f, 0.984266341f},
-std::array<float,2>{0.476686835f, 0.24283278f},
-std::array<float,2>{0.58859688f, 0.153496698f},
-std::array<float,2>{0.166288808f, 0.90489316f},
-std::array<float,2>{0.780986011f, 0.639575481f},
-std::array<float,2>{0.35572648f, 0.364634305f},
-std::array<float,2>{0.929932356f, 0.472059011f},
-std::array<float,2>{0.380163461f, 0.608832955f},
-std::array<float,2>{0.629519105f, 0.791772008f},
-std::array<float,2>{0.0543113388f, 0.00918589998f},
-std::array<float,2>{0.969054997f, 0.218680143f},
-std::array<float,2>{0.454715788f, 0.958772123f},
-std::array<float,2>{0.711237252f, 0.696567059f},
-std::array<float,2>{0.107996784f, 0.301498085f},
-std::array<float,2>{0.513128877f, 0.43550843f},
-std::array<float,2>{0.234097913f, 0.545146286f},
-std::array<float,2>{0.817678988f, 0.867510021f},
-std::array<float,2>{0.298854679f, 0.109833054f},
-std::array<float,2>{0.668653488f, 0.0406076573f},
-std::array<float,2>{0.0091194408f, 0.76785773f},
-std::array<float,2>{0.895709753f, 0.57534647f},
-std::array<float,2>{0.428559631f, 0.451614439f},
-std::array<float,2>{0.799828947f, 0.32150197f},
-std::array<float,2>{0.323226988f, 0.677117765f},
-std::array<float,2>{0.611209214f, 0.926853538f},
-std::array<float,2>{0.130644575f, 0.170279771f},
-std::array<float,2>{0.764889479f, 0.175179571f},
-std::array<float,2>{0.368694782f, 0.918024719f},
-std::array<float,2>{0.572547674f, 0.663443565f},
-std::array<float,2>{0.177593499f, 0.329133123f},
-std::array<float,2>{0.656129539f, 0.466651708f},
-std::array<float,2>{0.0421018973f, 0.586572111f},
-std::array<float,2>{0.921820045f, 0.751230061f},
-std::array<float,2>{0.395534754f, 0.0548597425f},
-std::array<float,2>{0.53601706f, 0.0968676731f},
-std::array<float,2>{0.209016174f, 0.846860528f},
-std::array<float,2>{0.848685443f, 0.561984897f},
-std::array<float,2>{0.275167912f, 0.41018635f},
-std::array<float,2>{0.963063776f, 0.293280423f},
-std::array<float,2>{0.490259945f, 0.710965812f},
-std::array<float,2>{0.742316544f, 0.940579951f},
-std::array<float,2>{0.0917587504f, 0.192445055f},
-std::array<float,2>{0.890118718f, 0.0285346173f},
-std::array<float,2>{0.41168654f, 0.806420684f},
-std::array<float,2>{0.677324474f, 0.624979973f},
-std::array<float,2>{0.0288353004f, 0.4979617f},
-std::array<float,2>{0.600138366f, 0.350521803f},
-std::array<float,2>{0.153493643f, 0.652733266f},
-std::array<float,2>{0.790921807f, 0.884773254f},
-std::array<float,2>{0.338553667f, 0.135880455f},
-std::array<float,2>{0.69132036f, 0.231958091f},
-std::array<float,2>{0.116601877f, 0.999348581f},
-std::array<float,2>{0.985391617f, 0.727294445f},
-std::array<float,2>{0.447557926f, 0.256977171f},
-std::array<float,2>{0.834618449f, 0.383162916f},
-std::array<float,2>{0.291414797f, 0.527981281f},
-std::array<float,2>{0.526740074f, 0.824341357f},
-std::array<float,2>{0.235489398f, 0.0789891556f},
-std::array<float,2>{0.776641011f, 0.103856564f},
-std::array<float,2>{0.353213847f, 0.853260756f},
-std::array<float,2>{0.590498269f, 0.551492155f},
-std::array<float,2>{0.169048786f, 0.420422286f},
-std::array<float,2>{0.626256526f, 0.281489283f},
-std::array<float,2>{0.048441384f, 0.709381759f},
-std::array<float,2>{0.934549212f, 0.949501753f},
-std::array<float,2>{0.375933975f, 0.202271968f},
-std::array<float,2>{0.551866174f, 0.186704695f},
-std::array<float,2>{0.19594872f, 0.910252929f},
-std::array<float,2>{0.873800159f, 0.670963466f},
-std::array<float,2>{0.25556612f, 0.33905974f},
-std::array<float,2>{0.951354623f, 0.459476382f},
-std::array<float,2>{0.483440369f, 0.578866601f},
-std::array<float,2>{0.729916394f, 0.763284981f},
-std::array<float,2>{0.0735928565f, 0.0469018109f},
-std::array<float,2>{0.891711354f, 0.224643663f},
-std::array<float,2>{0.425070673f, 0.992057025f},
-std::array<float,2>{0.667796016f, 0.722624481f},
-std::array<float,2>{0.0146896504f, 0.260628581f},
-std::array<float,2>{0.614002764f, 0.381193727f},
-std::array<float,2>{0.127609968f, 0.515945315f},
-std::array<float,2>{0.804258823f, 0.818831325f},
-std::array<float,2>{0.325992793f, 0.0873649269f},
-std::array<float,2>{0.717444777f, 0.016249327f},
-std::array<float,2>{0.102073349f, 0.800025105f},
-std::array<float,2>{0.97503227f, 0.611289203f},
-std::array<float,2>{0.459352404f, 0.491577625f},
-std::array<float,2>{0.815750599f, 0.356963396f},
-std::array<float,2>{0.301258624f, 0.647941947f},
-std::array<float,2>{0.511442184f, 0.881165266f},
-std::array<float,2>{0.229792923f, 0.132499874f},
-std::array<float,2>{0.84663409f, 0.143004224f},
-std::array<float,2>{0.278830647f, 0.897775054f},
-std::array<float,2>{0.53414458f, 0.626894832f},
-std::array<float,2>{0.2031793f, 0.371411681f},
-std::array<float,2>{0.749535024f, 0.479393005f},
-std::array<float,2>{0.0869729742f, 0.599651694f},
-std::array<float,2>{0.968723774f, 0.785779953f},
-std::array<float,2>{0.485419571f, 0.00501710596f},
-std::array<float,2>{0.57526201f, 0.0711841807f},
-std::array<float,2>{0.172422975f, 0.837203503f},
-std::array<float,2>{0.760163963f, 0.502385676f},
-std::array<float,2>{0.373655915f, 0.396803468f},
-std::array<float,2>{0.915050089f, 0.279365033f},
-std::array<float,2>{0.394327462f, 0.744876564f},
-std::array<float,2>{0.651694298f, 0.97121191f},
-std::array<float,2>{0.0441898927f, 0.23522f},
-std::array<float,2>{0.98834908f, 0.0346538685f},
-std::array<float,2>{0.452836037f, 0.777831197f},
-std::array<float,2>{0.692742825f, 0.565820396f},
-std::array<float,2>{0.109767348f, 0.442269444f},
-std::array<float,2>{0.527911603f, 0.313879758f},
-std::array<float,2>{0.240461856f, 0.687106788f},
-std::array<float,2>{0.82933408f, 0.93139559f},
-std::array<float,2>{0.295394629f, 0.158015728f},
-std::array<float,2>{0.673304141f, 0.208909303f},
-std::array<float,2>{0.0240697358f, 0.964646935f},
-std::array<float,2>{0.883751571f, 0.69318521f},
-std::array<float,2>{0.407367408f, 0.30559665f},
-std::array<float,2>{0.796001315f, 0.422761053f},
-std::array<float,2>{0.343014032f, 0.533527851f},
-std::array<float,2>{0.594514191f, 0.862663746f},
-std::array<float,2>{0.149786577f, 0.120896265f},
-std::array<float,2>{0.839915872f, 0.0129236942f},
-std::array<float,2>{0.287731767f, 0.795445621f},
-std::array<float,2>{0.522669852f, 0.603893936f},
-std::array<float,2>{0.245126203f, 0.472697377f},
-std::array<float,2>{0.702630103f, 0.362665534f},
-std::array<float,2>{0.118275002f, 0.63325429f},
-std::array<float,2>{0.998891532f, 0.902338147f},
-std::array<float,2>{0.439671218f, 0.151003063f},
-std::array<float,2>{0.604327619f, 0.24926205f},
-std::array<float,2>{0.141303837f, 0.978740692f},
-std::array<float,2>{0.783226669f, 0.736990929f},
-std::array<float,2>{0.335172147f, 0.271821022f},
-std::array<float,2>{0.879647553f, 0.400912493f},
-std::array<float,2>{0.4209086f, 0.509720206f},
-std::array<float,2>{0.683791518f, 0.835267365f},
-std::array<float,2>{0.0177921392f, 0.0627114102f},
-std::array<float,2>{0.95912081f, 0.165023148f},
-std::array<float,2>{0.49566865f, 0.92331779f},
-std::array<float,2>{0.736045897f, 0.67292881f},
-std::array<float,2>{0.0848539621f, 0.327043861f},
-std::array<float,2>{0.539362967f, 0.446160048f},
-std::array<float,2>{0.211919576f, 0.572091699f},
-std::array<float,2>{0.856491208f, 0.77196604f},
-std::array<float,2>{0.271845341f, 0.0432151183f},
-std::array<float,2>{0.640914679f, 0.116626091f},
-std::array<float,2>{0.0369726643f, 0.872434676f},
-std::array<float,2>{0.906867564f, 0.541372895f},
-std::array<float,2>{0.405655205f, 0.432477802f},
-std::array<float,2>{0.754920304f, 0.300775588f},
-std::array<float,2>{0.367066622f, 0.699958265f},
-std::array<float,2>{0.567764521f, 0.954535127f},
-std::array<float,2>{0.186925694f, 0.212069929f},
-std::array<float,2>{0.805470467f, 0.188638642f},
-std::array<float,2>{0.315893233f, 0.941787004f},
-std::array<float,2>{0.619007647f, 0.718007386f},
-std::array<float,2>{0.134484172f, 0.292723596f},
-std::array<float,2>{0.662333429f, 0.406849265f},
-std::array<float,2>{0.00421523396f, 0.558300555f},
-std::array<float,2>{0.902237356f, 0.848489404f},
-std::array<float,2>{0.43355763f, 0.10082157f},
-std::array<float,2>{0.50226599f, 0.0605037138f},
-std::array<float,2>{0.224048689f, 0.755064011f},
-std::array<float,2>{0.822768331f, 0.591104567f},
-std::array<float,2>{0.31143117f, 0.462843657f},
-std::array<float,2>{0.977516532f, 0.335733622f},
-std::array<float,2>{0.461281806f, 0.656771243f},
-std::array<float,2>{0.706994772f, 0.916754961f},
-std::array<float,2>{0.0944539234f, 0.177646354f},
-std::array<float,2>{0.923929334f, 0.0844804794f},
-std::array<float,2>{0.39013505f, 0.821098089f},
-std::array<float,2>{0.639034569f, 0.524620414f},
-std::array<float,2>{0.0611127168f, 0.389163733f},
-std::array<float,2>{0.579556406f, 0.250305593f},
-std::array<float,2>{0.160472646f, 0.731816471f},
-std::array<float,2>{0.766625822f, 0.993123412f},
-std::array<float,2>{0.3461833f, 0.228222623f},
-std::array<float,2>{0.721341968f, 0.14060317f},
-std::array<float,2>{0.0646919757f, 0.889838517f},
-std::array<float,2>{0.940670311f, 0.651749432f},
-std::array<float,2>{0.475578934f, 0.34380433f},
-std::array<float,2>{0.862107992f, 0.495969862f},
-std::array<float,2>{0.260366589f, 0.619064093f},
-std::array<float,2>{0.560831785f, 0.811069012f},
-std::array<float,2>{0.188479319f, 0.0264404956f},
-std::array<float,2>{0.790460467f, 0.0308603942f},
-std::array<float,2>{0.338176697f, 0.807602704f},
-std::array<float,2>{0.599997044f, 0.621893048f},
-std::array<float,2>{0.154237077f, 0.499383062f},
-std::array<float,2>{0.67689985f, 0.347845912f},
-std::array<float,2>{0.0283246785f, 0.654693663f},
-std::array<float,2>{0.890278578f, 0.883377016f},
-std::array<float,2>{0.411262929f, 0.133369207f},
-std::array<float,2>{0.527330458f, 0.23396191f},
-std::array<float,2>{0.23615098f, 0.99625355f},
-std::array<float,2>{0.83433497f, 0.728656054f},
-std::array<float,2>{0.291795045f, 0.255695075f},
-std::array<float,2>{0.9862082f, 0.385076016f},
-std::array<float,2>{0.448159426f, 0.530000687f},
-std::array<float,2>{0.690904558f, 0.826650858f},
-std::array<float,2>{0.117135815f, 0.0804187283f},
-std::array<float,2>{0.921317101f, 0.172771886f},
-std::array<float,2>{0.396210402f, 0.920282245f},
-std::array<float,2>{0.655591965f, 0.662056923f},
-std::array<float,2>{0.042668689f, 0.331412822f},
-std::array<float,2>{0.573171914f, 0.46715194f},
-std::array<float,2>{0.176770404f, 0.589457572f},
-std::array<float,2>{0.765537858f, 0.752310157f},
-std::array<float,2>{0.368326992f, 0.0570888184f},
-std::array<float,2>{0.742722392f, 0.094370991f},
-std::array<float,2>{0.0909034461f, 0.844340086f},
-std::array<float,2>{0.963817418f, 0.558910549f},
-std::array<float,2>{0.490973711f, 0.41399619f},
-std::array<float,2>{0.849262595f, 0.295362413f},
-std::array<float,2>{0.274590969f, 0.714585304f},
-std::array<float,2>{0.535217285f, 0.938909709f},
-std::array<float,2>{0.209486097f, 0.193806618f},
-std::array<float,2>{0.818077803f, 0.215270489f},
-std::array<float,2>{0.299675733f, 0.959273636f},
-std::array<float,2>{0.513537049f, 0.698423982f},
-std::array<float,2>{0.233616799f, 0.303267926f},
-std::array<float,2>{0.711636841f, 0.436565191f},
-std::array<float,2>{0.107580736f, 0.544124305f},
-std::array<float,2>{0.969638705f, 0.869996846f},
-std::array<float,2>{0.454148054f, 0.11266809f},
-std::array<float,2>{0.610664546f, 0.0425550826f},
-std::array<float,2>{0.129941508f, 0.765716314f},
-std::array<float,2>{0.800678253f, 0.576288879f},
-std::array<float,2>{0.322444201f, 0.449938983f},
-std::array<float,2>{0.896032631f, 0.32295844f},
-std::array<float,2>{0.427972585f, 0.679139376f},
-std::array<float,2>{0.668452024f, 0.928763866f},
-std::array<float,2>{0.00948887318f, 0.169061229f},
-std::array<float,2>{0.945788741f, 0.068721883f},
-std::array<float,2>{0.477100492f, 0.828786373f},
-std::array<float,2>{0.730672598f, 0.514652193f},
-std::array<float,2>{0.0744876191f, 0.404200047f},
-std::array<float,2>{0.549241722f, 0.267720878f},
-std::array<float,2>{0.201286256f, 0.741452396f},
-std::array<float,2>{0.867778599f, 0.980651796f},
-std::array<float,2>{0.250869364f, 0.244485185f},
-std::array<float,2>{0.629179895f, 0.15512228f},
-std::array<float,2>{0.0537329987f, 0.903580368f},
-std::array<float,2>{0.93054235f, 0.637451828f},
-std::array<float,2>{0.38058269f, 0.365658164f},
-std::array<float,2>{0.780457377f, 0.468985111f},
-std::array<float,2>{0.355987132f, 0.606465816f},
-std::array<float,2>{0.588171124f, 0.789297342f},
-std::array<float,2>{0.166893899f, 0.0100491447f},
-std::array<float,2>{0.863460898f, 0.122613169f},
-std::array<float,2>{0.262504309f, 0.867041707f},
-std::array<float,2>{0.55536145f, 0.537396669f},
-std::array<float,2>{0.19339931f, 0.426687807f},
-std::array<float,2>{0.724897087f, 0.30862996f},
-std::array<float,2>{0.069884859f, 0.687773526f},
-std::array<float,2>{0.944311976f, 0.96484679f},
-std::array<float,2>{0.470228612f, 0.204965487f},
-std::array<float,2>{0.582294166f, 0.161609903f},
-std::array<float,2>{0.159310102f, 0.935833395f},
-std::array<float,2>{0.772239089f, 0.681535661f},
-std::array<float,2>{0.348120421f, 0.316468149f},
-std::array<float,2>{0.926714957f, 0.438561469f},
-std::array<float,2>{0.385925174f, 0.568282247f},
-std::array<float,2>{0.636231363f, 0.775880456f},
-std::array<float,2>{0.056581594f, 0.0372990407f},
-std::array<float,2>{0.982668042f, 0.242044017f},
-std::array<float,2>{0.465246588f, 0.975458741f},
-std::array<float,2>{0.708410025f, 0.747863114f},
-std::array<float,2>{0.100336835f, 0.27348429f},
-std::array<float,2>{0.507106543f, 0.393727094f},
-std::array<float,2>{0.219761312f, 0.506927371f},
-std::array<float,2>{0.825484693f, 0.843339503f},
-std::array<float,2>{0.306313932f, 0.074418731f},
-std::array<float,2>{0.659804106f, 0.00262422371f},
-std::array<float,2>{0.00173404277f, 0.784508288f},
-std::array<float,2>{0.9028458f, 0.596867859f},
-std::array<float,2>{0.436678141f, 0.481986195f},
-std::array<float,2>{0.812215626f, 0.370679021f},
-std::array<float,2>{0.31850487f, 0.629253328f},
-std::array<float,2>{0.622956693f, 0.894295931f},
-std::array<float,2>{0.139706925f, 0.147039562f},
-std::array<float,2>{0.751935184f, 0.128212497f},
-std::array<float,2>{0.361843497f, 0.878269196f},
-std::array<float,2>{0.564265668f, 0.640684724f},
-std::array<float,2>{0.182410106f, 0.352567554f},
-std::array<float,2>{0.645792484f, 0.48504594f},
-std::array<float,2>{0.0346255265f, 0.616345704f},
-std::array<float,2>{0.911159337f, 0.803891301f},
-std::array<float,2>{0.401497215f, 0.0218806192f},
-std::array<float,2>{0.546366274f, 0.0904713869f},
-std::array<float,2>{0.216328666f, 0.815524578f},
-std::array<float,2>{0.853376627f, 0.520263135f},
-std::array<float,2>{0.268345475f, 0.376790881f},
-std::array<float,2>{0.954268277f, 0.263072282f},
-std::array<float,2>{0.496222407f, 0.724922299f},
-std::array<float,2>{0.740825474f, 0.98758328f},
-std::array<float,2>{0.0811009482f, 0.222296551f},
-std::array<float,2>{0.875139594f, 0.0542146154f},
-std::array<float,2>{0.415984303f, 0.758306742f},
-std::array<float,2>{0.681096852f, 0.585792661f},
-std::array<float,2>{0.023436036f, 0.454227f},
-std::array<float,2>{0.60705781f, 0.342517197f},
-std::array<float,2>{0.145904809f, 0.664700091f},
-std::array<float,2>{0.788320303f, 0.910026848f},
-std::array<float,2>{0.328217208f, 0.180659652f},
-std::array<float,2>{0.695478261f, 0.197571427f},
-std::array<float,2>{0.124024868f, 0.94672519f},
-std::array<float,2>{0.993919015f, 0.706196249f},
-std::array<float,2>{0.444747597f, 0.287387222f},
-std::array<float,2>{0.836405754f, 0.415703773f},
-std::array<float,2>{0.282524168f, 0.547596216f},
-std::array<float,2>{0.51826787f, 0.857978821f},
-std::array<float,2>{0.246894494f, 0.105502568f},
-std::array<float,2>{0.767223001f, 0.0830426216f},
-std::array<float,2>{0.346268475f, 0.823927283f},
-std::array<float,2>{0.579624772f, 0.527201891f},
-std::array<float,2>{0.161059439f, 0.386759728f},
-std::array<float,2>{0.639319897f, 0.252011657f},
-std::array<float,2>{0.0609026328f, 0.733762085f},
-std::array<float,2>{0.924607873f, 0.99547255f},
-std::array<float,2>{0.390459895f, 0.229884073f},
-std::array<float,2>{0.561051965f, 0.137376472f},
-std::array<float,2>{0.189119622f, 0.887707353f},
-std::array<float,2>{0.86171788f, 0.649629116f},
-std::array<float,2>{0.259950787f, 0.34752807f},
-std::array<float,2>{0.941168785f, 0.493603557f},
-std::array<float,2>{0.474631816f, 0.619301915f},
-std::array<float,2>{0.721181631f, 0.809626639f},
-std::array<float,2>{0.0653869957f, 0.0239480343f},
-std::array<float,2>{0.901526451f, 0.189983457f},
-std::array<float,2>{0.432919025f, 0.944244742f},
-std::array<float,2>{0.662704945f, 0.716102302f},
-std::array<float,2>{0.0048819338f, 0.29028222f},
-std::array<float,2>{0.618231177f, 0.409127891f},
-std::array<float,2>{0.133961394f, 0.555516064f},
-std::array<float,2>{0.804764152f, 0.849788427f},
-std::array<float,2>{0.31596902f, 0.0988948494f},
-std::array<float,2>{0.70617795f, 0.060840454f},
-std::array<float,2>{0.0938904732f, 0.756352663f},
-std::array<float,2>{0.976893544f, 0.592275262f},
-std::array<float,2>{0.461554408f, 0.464148313f},
-std::array<float,2>{0.822341025f, 0.332352042f},
-std::array<float,2>{0.311016321f, 0.65985924f},
-std::array<float,2>{0.502737582f, 0.915030718f},
-std::array<float,2>{0.224543869f, 0.178392291f},
-std::array<float,2>{0.857231438f, 0.166076154f},
-std::array<float,2>{0.272017151f, 0.924107194f},
-std::array<float,2>{0.53956753f, 0.674245059f},
-std::array<float,2>{0.212564752f, 0.324738979f},
-std::array<float,2>{0.735681534f, 0.448927641f},
-std::array<float,2>{0.0839921087f, 0.572857559f},
-std::array<float,2>{0.959695518f, 0.769838333f},
-std::array<float,2>{0.495404661f, 0.046325326f},
-std::array<float,2>{0.568309784f, 0.113716818f},
-std::array<float,2>{0.187476397f, 0.873103976f},
-std::array<float,2>{0.755534649f, 0.539113522f},
-std::array<float,2>{0.36653173f, 0.431184351f},
-std::array<float,2>{0.906397521f, 0.296881318f},
-std::array<float,2>{0.406039536f, 0.701657355f},
-std::array<float,2>{0.641162813f, 0.956801474f},
-std::array<float,2>{0.0364456251f, 0.214640573f},
-std::array<float,2>{0.998154879f, 0.0153037561f},
-std::array<float,2>{0.440230817f, 0.794355035f},
-std::array<float,2>{0.702673912f, 0.603155732f},
-std::array<float,2>{0.11867325f, 0.475363106f},
-std::array<float,2>{0.522985697f, 0.361266792f},
-std::array<float,2>{0.245884731f, 0.636317134f},
-std::array<float,2>{0.840669394f, 0.899476409f},
-std::array<float,2>{0.287348688f, 0.150264144f},
-std::array<float,2>{0.684461415f, 0.24617061f},
-std::array<float,2>{0.0182834454f, 0.978022933f},
-std::array<float,2>{0.878916681f, 0.735861897f},
-std::array<float,2>{0.421595573f, 0.269842386f},
-std::array<float,2>{0.784178376f, 0.399701774f},
-std::array<float,2>{0.335810095f, 0.511406064f},
-std::array<float,2>{0.603564322f, 0.8332147f},
-std::array<float,2>{0.140627339f, 0.0648129135f},
-std::array<float,2>{0.830003202f, 0.0326806381f},
-std::array<float,2>{0.295625567f, 0.781170249f},
-std::array<float,2>{0.527702153f, 0.562613845f},
-std::array<float,2>{0.240761429f, 0.443473339f},
-std::array<float,2>{0.693235934f, 0.314488232f},
-std::array<float,2>{0.110075392f, 0.683862746f},
-std::array<float,2>{0.989233673f, 0.933237255f},
-std::array<float,2>{0.452504843f, 0.159297377f},
-std::array<float,2>{0.594036341f, 0.209934339f},
-std::array<float,2>{0.149991542f, 0.962081313f},
-std::array<float,2>{0.796618402f, 0.693624496f},
-std::array<float,2>{0.343709707f, 0.30775097f},
-std::array<float,2>{0.882862806f, 0.424256653f},
-std::array<float,2>{0.407966018f, 0.532518506f},
-std::array<float,2>{0.673544109f, 0.859985709f},
-std::array<float,2>{0.0234881099f, 0.118802465f},
-std::array<float,2>{0.968098283f, 0.141841561f},
-std::array<float,2>{0.486014783f, 0.894704044f},
-std::array<float,2>{0.74905771f, 0.627751052f},
-std::array<float,2>{0.0877976492f, 0.374972314f},
-std::array<float,2>{0.533595145f, 0.477938205f},
-std::array<float,2>{0.203832313f, 0.598102331f},
-std::array<float,2>{0.845927477f, 0.78826946f},
-std::array<float,2>{0.278467745f, 0.00640005525f},
-std::array<float,2>{0.652198911f, 0.0737878233f},
-std::array<float,2>{0.0446751714f, 0.838598132f},
-std::array<float,2>{0.915795624f, 0.501747489f},
-std::array<float,2>{0.393855512f, 0.394602716f},
-std::array<float,2>{0.76051569f, 0.278954357f},
-std::array<float,2>{0.373527318f, 0.743236303f},
-std::array<float,2>{0.575904548f, 0.970331609f},
-std::array<float,2>{0.172150642f, 0.237258062f},
-std::array<float,2>{0.80414927f, 0.222681358f},
-std::array<float,2>{0.325218767f, 0.989888132f},
-std::array<float,2>{0.613414764f, 0.720589757f},
-std::array<float,2>{0.12738806f, 0.258147538f},
-std::array<float,2>{0.667071521f, 0.380803943f},
-std::array<float,2>{0.0153529411f, 0.519052207f},
-std::array<float,2>{0.892304003f, 0.817919552f},
-std::array<float,2>{0.425776005f, 0.0878953785f},
-std::array<float,2>{0.511077225f, 0.0192156024f},
-std::array<float,2>{0.230438471f, 0.798225105f},
-std::array<float,2>{0.816289186f, 0.612556398f},
-std::array<float,2>{0.301660687f, 0.489064276f},
-std::array<float,2>{0.975221515f, 0.358282894f},
-std::array<float,2>{0.459484875f, 0.646208882f},
-std::array<float,2>{0.7172755f, 0.880736828f},
-std::array<float,2>{0.101646081f, 0.129281774f},
-std::array<float,2>{0.933804214f, 0.101931632f},
-std::array<float,2>{0.375466317f, 0.855325997f},
-std::array<float,2>{0.626614034f, 0.554288685f},
-std::array<float,2>{0.0481034927f, 0.418928623f},
-std::array<float,2>{0.59008795f, 0.28323096f},
-std::array<float,2>{0.169525996f, 0.708930671f},
-std::array<float,2>{0.777226746f, 0.951635242f},
-std::array<float,2>{0.352546543f, 0.200431302f},
-std::array<float,2>{0.730318367f, 0.185052887f},
-std::array<float,2>{0.0739838928f, 0.913580537f},
-std::array<float,2>{0.951722443f, 0.668339252f},
-std::array<float,2>{0.484031856f, 0.337269217f},
-std::array<float,2>{0.873217642f, 0.457181841f},
-std::array<float,2>{0.255084604f, 0.581242979f},
-std::array<float,2>{0.552330077f, 0.765073776f},
-std::array<float,2>{0.195755869f, 0.049852021f},
-std::array<float,2>{0.761798441f, 0.0555076711f},
-std::array<float,2>{0.369523019f, 0.751743138f},
-std::array<float,2>{0.570756257f, 0.586322367f},
-std::array<float,2>{0.179396108f, 0.465924323f},
-std::array<float,2>{0.653279662f, 0.329593241f},
-std::array<float,2>{0.0392365791f, 0.663802385f},
-std::array<float,2>{0.918228388f, 0.918710172f},
-std::array<float,2>{0.397042066f, 0.175548211f},
-std::array<float,2>{0.538422465f, 0.192985386f},
-std::array<float,2>{0.207209468f, 0.940965712f},
-std::array<float,2>{0.850560844f, 0.711572528f},
-std::array<float,2>{0.276368588f, 0.293830514f},
-std::array<float,2>{0.962881505f, 0.410900146f},
-std::array<float,2>{0.489609003f, 0.56231302f},
-std::array<float,2>{0.745735288f, 0.847440422f},
-std::array<float,2>{0.0935508162f, 0.0975389928f},
-std::array<float,2>{0.888204813f, 0.136332199f},
-std::array<float,2>{0.413290262f, 0.885516465f},
-std::array<float,2>{0.679468036f, 0.653230309f},
-std::array<float,2>{0.03072845f, 0.349978954f},
-std::array<float,2>{0.598238945f, 0.49723497f},
-std::array<float,2>{0.154444486f, 0.624253988f},
-std::array<float,2>{0.792915106f, 0.805923641f},
-std::array<float,2>{0.336632371f, 0.0290482119f},
-std::array<float,2>{0.68841356f, 0.0781458095f},
-std::array<float,2>{0.113472603f, 0.825084329f},
-std::array<float,2>{0.987139702f, 0.527402937f},
-std::array<float,2>{0.447083861f, 0.38365376f},
-std::array<float,2>{0.833208144f, 0.257481128f},
-std::array<float,2>{0.290447354f, 0.726694524f},
-std::array<float,2>{0.523512065f, 0.999806821f},
-std::array<float,2>{0.236903787f, 0.231618568f},
-std::array<float,2>{0.869269073f, 0.242502421f},
-std::array<float,2>{0.253850937f, 0.983685553f},
-std::array<float,2>{0.54694277f, 0.738958836f},
-std::array<float,2>{0.199294686f, 0.267125964f},
-std::array<float,2>{0.732780337f, 0.405608743f},
-std::array<float,2>{0.0762986839f, 0.512644708f},
-std::array<float,2>{0.947613955f, 0.830621719f},
-std::array<float,2>{0.480062246f, 0.0680048689f},
-std::array<float,2>{0.587394059f, 0.0094439229f},
-std::array<float,2>{0.164862841f, 0.791251719f},
-std::array<float,2>{0.777975738f, 0.609007955f},
-std::array<float,2>{0.35849905f, 0.472289085f},
-std::array<float,2>{0.932588816f, 0.364856184f},
-std::array<float,2>{0.382484853f, 0.638932288f},
-std::array<float,2>{0.631712556f, 0.904369354f},
-std::array<float,2>{0.0517498776f, 0.154102281f},
-std::array<float,2>{0.972500145f, 0.109939083f},
-std::array<float,2>{0.455213606f, 0.867762506f},
-std::array<float,2>{0.71294868f, 0.545761108f},
-std::array<float,2>{0.106738158f, 0.434842378f},
-std::array<float,2>{0.51425612f, 0.300873518f},
-std::array<float,2>{0.231391251f, 0.697134793f},
-std::array<float,2>{0.818827569f, 0.958432078f},
-std::array<float,2>{0.29714179f, 0.218199477f},
-std::array<float,2>{0.671231151f, 0.170440152f},
-std::array<float,2>{0.0116157271f, 0.927674949f},
-std::array<float,2>{0.89752841f, 0.677467227f},
-std::array<float,2>{0.426088274f, 0.322087049f},
-std::array<float,2>{0.796963334f, 0.451768428f},
-std::array<float,2>{0.320486426f, 0.575964212f},
-std::array<float,2>{0.61301285f, 0.768254101f},
-std::array<float,2>{0.132481113f, 0.0402496941f},
-std::array<float,2>{0.827855349f, 0.0762233213f},
-std::array<float,2>{0.306736439f, 0.840936422f},
-std::array<float,2>{0.505749166f, 0.50541544f},
-std::array<float,2>{0.220921338f, 0.392461926f},
-std::array<float,2>{0.709908009f, 0.275601715f},
-std::array<float,2>{0.0978831723f, 0.749206543f},
-std::array<float,2>{0.981880307f, 0.973710835f},
-std::array<float,2>{0.467190713f, 0.238293558f},
-std::array<float,2>{0.624445319f, 0.145714357f},
-std::array<float,2>{0.138628781f, 0.89200294f},
-std::array<float,2>{0.809900939f, 0.632648647f},
-std::array<float,2>{0.317377061f, 0.367304951f},
-std::array<float,2>{0.906009674f, 0.483621836f},
-std::array<float,2>{0.434344947f, 0.594023049f},
-std::array<float,2>{0.657206476f, 0.781977892f},
-std::array<float,2>{0.00374197261f, 0.000707355153f},
-std::array<float,2>{0.941454291f, 0.205309629f},
-std::array<float,2>{0.471504748f, 0.967166781f},
-std::array<float,2>{0.724524319f, 0.690875709f},
-std::array<float,2>{0.066505447f, 0.311992735f},
-std::array<float,2>{0.558485985f, 0.427891612f},
-std::array<float,2>{0.192084447f, 0.535213947f},
-std::array<float,2>{0.866139293f, 0.864504099f},
-std::array<float,2>{0.265238941f, 0.123239934f},
-std::array<float,2>{0.633924425f, 0.0360437147f},
-std::array<float,2>{0.0570996664f, 0.774626911f},
-std::array<float,2>{0.928589225f, 0.569972694f},
-std::array<float,2>{0.383782208f, 0.439799726f},
-std::array<float,2>{0.770089447f, 0.319542378f},
-std::array<float,2>{0.350705385f, 0.682540357f},
-std::array<float,2>{0.585657656f, 0.935094357f},
-std::array<float,2>{0.157488659f, 0.162763476f},
-std::array<float,2>{0.785600424f, 0.182937533f},
-std::array<float,2>{0.330375463f, 0.90626204f},
-std::array<float,2>{0.608481765f, 0.667219162f},
-std::array<float,2>{0.146648601f, 0.341569066f},
-std::array<float,2>{0.683139086f, 0.455664217f},
-std::array<float,2>{0.0202980153f, 0.583364248f},
-std::array<float,2>{0.878614008f, 0.761537611f},
-std::array<float,2>{0.417396158f, 0.0524153411f},
-std::array<float,2>{0.516643405f, 0.109304123f},
-std::array<float,2>{0.249347284f, 0.85677433f},
-std::array<float,2>{0.838646352f, 0.550577283f},
-std::array<float,2>{0.284129083f, 0.417861044f},
-std::array<float,2>{0.995102823f, 0.286541611f},
-std::array<float,2>{0.442873657f, 0.703404725f},
-std::array<float,2>{0.698991537f, 0.947723329f},
-std::array<float,2>{0.122328423f, 0.196571082f},
-std::array<float,2>{0.912366033f, 0.0196179654f},
-std::array<float,2>{0.398830593f, 0.800815463f},
-std::array<float,2>{0.646492362f, 0.613844156f},
-std::array<float,2>{0.0326354615f, 0.486695856f},
-std::array<float,2>{0.566290081f, 0.35440585f},
-std::array<float,2>{0.180863291f, 0.643488705f},
-std::array<float,2>{0.753900349f, 0.876328826f},
-std::array<float,2>{0.360778481f, 0.126448855f},
-std::array<float,2>{0.738882124f, 0.219072938f},
-std::array<float,2>{0.0790098384f, 0.986322522f},
-std::array<float,2>{0.955385923f, 0.72392112f},
-std::array<float,2>{0.498605609f, 0.263952166f},
-std::array<float,2>{0.854479432f, 0.378783971f},
-std::array<float,2>{0.266118586f, 0.52235359f},
-std::array<float,2>{0.543755233f, 0.813435614f},
-std::array<float,2>{0.218592435f, 0.0927751586f},
-std::array<float,2>{0.807658851f, 0.101395451f},
-std::array<float,2>{0.312639534f, 0.848041058f},
-std::array<float,2>{0.619562685f, 0.557782114f},
-std::array<float,2>{0.136284471f, 0.406557351f},
-std::array<float,2>{0.662053287f, 0.292006075f},
-std::array<float,2>{0.00595895899f, 0.718601048f},
-std::array<float,2>{0.900116146f, 0.942081988f},
-std::array<float,2>{0.430438519f, 0.188977227f},
-std::array<float,2>{0.501934528f, 0.177220508f},
-std::array<float,2>{0.225748703f, 0.916197956f},
-std::array<float,2>{0.821238756f, 0.656304419f},
-std::array<float,2>{0.309857398f, 0.335271299f},
-std::array<float,2>{0.978905261f, 0.462262154f},
-std::array<float,2>{0.46466288f, 0.591504037f},
-std::array<float,2>{0.704720855f, 0.755655885f},
-std::array<float,2>{0.0957783014f, 0.0598770939f},
-std::array<float,2>{0.921970248f, 0.227751464f},
-std::array<float,2>{0.388572216f, 0.992250741f},
-std::array<float,2>{0.637836277f, 0.732233822f},
-std::array<float,2>{0.0603774376f, 0.25060305f},
-std::array<float,2>{0.580410123f, 0.389017612f},
-std::array<float,2>{0.1629484f, 0.525093853f},
-std::array<float,2>{0.769160748f, 0.820625663f},
-std::array<float,2>{0.345410198f, 0.0842521563f},
-std::array<float,2>{0.720115304f, 0.027284205f},
-std::array<float,2>{0.0629801229f, 0.810645759f},
-std::array<float,2>{0.93821919f, 0.618205845f},
-std::array<float,2>{0.474060684f, 0.495450824f},
-std::array<float,2>{0.860944271f, 0.344609141f},
-std::array<float,2>{0.259252489f, 0.65200454f},
-std::array<float,2>{0.558788955f, 0.89032197f},
-std::array<float,2>{0.190833345f, 0.139690697f},
-std::array<float,2>{0.842197359f, 0.150742561f},
-std::array<float,2>{0.286496907f, 0.901843548f},
-std::array<float,2>{0.520163357f, 0.633355677f},
-std::array<float,2>{0.243279159f, 0.363228887f},
-std::array<float,2>{0.699851811f, 0.473250985f},
-std::array<float,2>{0.119577236f, 0.604388356f},
-std::array<float,2>{0.997527301f, 0.795258641f},
-std::array<float,2>{0.437652707f, 0.0134636378f},
-std::array<float,2>{0.602879882f, 0.0631401837f},
-std::array<float,2>{0.144263104f, 0.835778475f},
-std::array<float,2>{0.782566547f, 0.509275496f},
-std::array<float,2>{0.332157075f, 0.400767297f},
-std::array<float,2>{0.881100774f, 0.272297502f},
-std::array<float,2>{0.418136984f, 0.736447632f},
-std::array<float,2>{0.687044978f, 0.979198396f},
-std::array<float,2>{0.0162029546f, 0.249656022f},
-std::array<float,2>{0.957664669f, 0.0437885374f},
-std::array<float,2>{0.492539078f, 0.772337556f},
-std::array<float,2>{0.736718118f, 0.571346581f},
-std::array<float,2>{0.0823820978f, 0.445641845f},
-std::array<float,2>{0.542447031f, 0.326227963f},
-std::array<float,2>{0.213120282f, 0.673478365f},
-std::array<float,2>{0.857618034f, 0.923473418f},
-std::array<float,2>{0.270600975f, 0.164374053f},
-std::array<float,2>{0.643152177f, 0.212551132f},
-std::array<float,2>{0.0375323929f, 0.954913735f},
-std::array<float,2>{0.909327865f, 0.69957757f},
-std::array<float,2>{0.403158963f, 0.299876839f},
-std::array<float,2>{0.757296145f, 0.431923628f},
-std::array<float,2>{0.363824248f, 0.54151845f},
-std::array<float,2>{0.569853842f, 0.873007774f},
-std::array<float,2>{0.184604138f, 0.117006406f},
-std::array<float,2>{0.845342636f, 0.00543213589f},
-std::array<float,2>{0.27934581f, 0.785397351f},
-std::array<float,2>{0.533187807f, 0.600531638f},
-std::array<float,2>{0.205582812f, 0.478560686f},
-std::array<float,2>{0.747914493f, 0.371774524f},
-std::array<float,2>{0.0887571797f, 0.626057744f},
-std::array<float,2>{0.966115236f, 0.898214102f},
-std::array<float,2>{0.486337721f, 0.143416628f},
-std::array<float,2>{0.576660216f, 0.234644696f},
-std::array<float,2>{0.175697774f, 0.971169233f},
-std::array<float,2>{0.759259462f, 0.744163632f},
-std::array<float,2>{0.371575266f, 0.280026376f},
-std::array<float,2>{0.917170703f, 0.397106975f},
-std::array<float,2>{0.392459661f, 0.502540231f},
-std::array<float,2>{0.649931729f, 0.837520182f},
-std::array<float,2>{0.0466437377f, 0.0707545578f},
-std::array<float,2>{0.992007256f, 0.157635614f},
-std::array<float,2>{0.451040179f, 0.930881441f},
-std::array<float,2>{0.695222139f, 0.686712325f},
-std::array<float,2>{0.111421369f, 0.314191103f},
-std::array<float,2>{0.529529512f, 0.441544831f},
-std::array<float,2>{0.24008064f, 0.565933585f},
-std::array<float,2>{0.831089795f, 0.777902663f},
-std::array<float,2>{0.293964386f, 0.034940742f},
-std::array<float,2>{0.67509377f, 0.120510064f},
-std::array<float,2>{0.0254363436f, 0.863170326f},
-std::array<float,2>{0.885153592f, 0.534141541f},
-std::array<float,2>{0.409884185f, 0.422250718f},
-std::array<float,2>{0.793161094f, 0.305015564f},
-std::array<float,2>{0.340099186f, 0.692456961f},
-std::array<float,2>{0.597359717f, 0.964302063f},
-std::array<float,2>{0.151567638f, 0.20845212f},
-std::array<float,2>{0.775149822f, 0.202720344f},
-std::array<float,2>{0.355334282f, 0.950035512f},
-std::array<float,2>{0.593542337f, 0.70971328f},
-std::array<float,2>{0.170114115f, 0.281799436f},
-std::array<float,2>{0.62758863f, 0.420117348f},
-std::array<float,2>{0.0499569215f, 0.551257968f},
-std::array<float,2>{0.935618699f, 0.853009105f},
-std::array<float,2>{0.378109694f, 0.104400977f},
-std::array<float,2>{0.5539096f, 0.0475305095f},
-std::array<float,2>{0.198980987f, 0.762817621f},
-std::array<float,2>{0.872106731f, 0.578575075f},
-std::array<float,2>{0.257740587f, 0.459468812f},
-std::array<float,2>{0.950194716f, 0.339444935f},
-std::array<float,2>{0.482268244f, 0.671619892f},
-std::array<float,2>{0.727050662f, 0.911011517f},
-std::array<float,2>{0.0711855441f, 0.187162414f},
-std::array<float,2>{0.89262718f, 0.0876916647f},
-std::array<float,2>{0.423306137f, 0.818849921f},
-std::array<float,2>{0.664899826f, 0.516124904f},
-std::array<float,2>{0.0119211189f, 0.381663799f},
-std::array<float,2>{0.616442978f, 0.259869874f},
-std::array<float,2>{0.126048133f, 0.722160995f},
-std::array<float,2>{0.800831199f, 0.991373718f},
-std::array<float,2>{0.326971114f, 0.225547269f},
-std::array<float,2>{0.715124965f, 0.132171437f},
-std::array<float,2>{0.105298974f, 0.881430805f},
-std::array<float,2>{0.973177433f, 0.648041964f},
-std::array<float,2>{0.457106352f, 0.356743276f},
-std::array<float,2>{0.814090014f, 0.492174029f},
-std::array<float,2>{0.304306f, 0.610594928f},
-std::array<float,2>{0.508274972f, 0.800354183f},
-std::array<float,2>{0.227392703f, 0.0159532875f},
-std::array<float,2>{0.778953075f, 0.0109860599f},
-std::array<float,2>{0.357800663f, 0.790507376f},
-std::array<float,2>{0.586687088f, 0.605478406f},
-std::array<float,2>{0.16571629f, 0.469905794f},
-std::array<float,2>{0.632422447f, 0.367074579f},
-std::array<float,2>{0.0522312671f, 0.638115108f},
-std::array<float,2>{0.933121324f, 0.902873337f},
-std::array<float,2>{0.381017625f, 0.155492634f},
-std::array<float,2>{0.547929108f, 0.245335266f},
-std::array<float,2>{0.200431764f, 0.981477201f},
-std::array<float,2>{0.870439231f, 0.74061054f},
-std::array<float,2>{0.252626926f, 0.268945217f},
-std::array<float,2>{0.948326707f, 0.402894348f},
-std::array<float,2>{0.479064256f, 0.514190495f},
-std::array<float,2>{0.733670235f, 0.82934618f},
-std::array<float,2>{0.0775290653f, 0.0703067705f},
-std::array<float,2>{0.897005677f, 0.168846041f},
-std::array<float,2>{0.427250743f, 0.928012431f},
-std::array<float,2>{0.670141518f, 0.678202927f},
-std::array<float,2>{0.0105348555f, 0.324015051f},
-std::array<float,2>{0.61220485f, 0.45057413f},
-std::array<float,2>{0.131384254f, 0.577454209f},
-std::array<float,2>{0.798139811f, 0.766639769f},
-std::array<float,2>{0.321866572f, 0.041100245f},
-std::array<float,2>{0.714400232f, 0.111791208f},
-std::array<float,2>{0.105566159f, 0.871049404f},
-std::array<float,2>{0.971400738f, 0.543523312f},
-std::array<float,2>{0.456623018f, 0.435876042f},
-std::array<float,2>{0.819818318f, 0.304030776f},
-std::array<float,2>{0.298351705f, 0.69738996f},
-std::array<float,2>{0.515206039f, 0.960106015f},
-std::array<float,2>{0.23163484f, 0.216385618f},
-std::array<float,2>{0.850867271f, 0.195248634f},
-std::array<float,2>{0.275907457f, 0.937716901f},
-std::array<float,2>{0.537870944f, 0.713255942f},
-std::array<float,2>{0.208047301f, 0.296566814f},
-std::array<float,2>{0.744574666f, 0.41236341f},
-std::array<float,2>{0.0922776684f, 0.559700131f},
-std::array<float,2>{0.96097523f, 0.845382929f},
-std::array<float,2>{0.488392651f, 0.0952858925f},
-std::array<float,2>{0.571600676f, 0.057874497f},
-std::array<float,2>{0.178038776f, 0.753592908f},
-std::array<float,2>{0.763451636f, 0.588187039f},
-std::array<float,2>{0.370636165f, 0.467846245f},
-std::array<float,2>{0.919534147f, 0.33034268f},
-std::array<float,2>{0.397850722f, 0.660251319f},
-std::array<float,2>{0.65348506f, 0.920952976f},
-std::array<float,2>{0.0402920358f, 0.173706487f},
-std::array<float,2>{0.988176286f, 0.0818467662f},
-std::array<float,2>{0.445417821f, 0.827780545f},
-std::array<float,2>{0.688667417f, 0.530273736f},
-std::array<float,2>{0.114940412f, 0.38625437f},
-std::array<float,2>{0.524754286f, 0.254844725f},
-std::array<float,2>{0.237477839f, 0.729605019f},
-std::array<float,2>{0.83260709f, 0.997621655f},
-std::array<float,2>{0.289106965f, 0.233222112f},
-std::array<float,2>{0.678147078f, 0.134570867f},
-std::array<float,2>{0.0299553797f, 0.884763002f},
-std::array<float,2>{0.887644589f, 0.656186819f},
-std::array<float,2>{0.413054198f, 0.349571913f},
-std::array<float,2>{0.791970789f, 0.498882473f},
-std::array<float,2>{0.33757776f, 0.622716725f},
-std::array<float,2>{0.599257648f, 0.807819486f},
-std::array<float,2>{0.155338436f, 0.0297536887f},
-std::array<float,2>{0.839217067f, 0.10689912f},
-std::array<float,2>{0.284632325f, 0.85895896f},
-std::array<float,2>{0.515792251f, 0.548120975f},
-std::array<float,2>{0.24825567f, 0.414568543f},
-std::array<float,2>{0.698010266f, 0.288699418f},
-std::array<float,2>{0.121184982f, 0.705468655f},
-std::array<float,2>{0.995795667f, 0.946061611f},
-std::array<float,2>{0.441485107f, 0.198632717f},
-std::array<float,2>{0.60780406f, 0.18071273f},
-std::array<float,2>{0.147967368f, 0.908622503f},
-std::array<float,2>{0.786650956f, 0.665070534f},
-std::array<float,2>{0.33193633f, 0.343669981f},
-std::array<float,2>{0.877306759f, 0.453183085f},
-std::array<float,2>{0.416206777f, 0.584684312f},
-std::array<float,2>{0.681666672f, 0.758939743f},
-std::array<float,2>{0.0206322502f, 0.0529968515f},
-std::array<float,2>{0.956566811f, 0.221114606f},
-std::array<float,2>{0.499332219f, 0.986610591f},
-std::array<float,2>{0.739272475f, 0.725692034f},
-std::array<float,2>{0.0796762854f, 0.26232937f},
-std::array<float,2>{0.544774473f, 0.375815779f},
-std::array<float,2>{0.217392147f, 0.52061832f},
-std::array<float,2>{0.854669273f, 0.814462662f},
-std::array<float,2>{0.267316043f, 0.0909771845f},
-std::array<float,2>{0.64834404f, 0.0230335034f},
-std::array<float,2>{0.0315802805f, 0.803691745f},
-std::array<float,2>{0.913657725f, 0.615594566f},
-std::array<float,2>{0.399574399f, 0.485496998f},
-std::array<float,2>{0.752498329f, 0.352113187f},
-std::array<float,2>{0.35943386f, 0.642228186f},
-std::array<float,2>{0.565232217f, 0.8773821f},
-std::array<float,2>{0.179933548f, 0.127207115f},
-std::array<float,2>{0.809448659f, 0.148378208f},
-std::array<float,2>{0.317739189f, 0.893140435f},
-std::array<float,2>{0.623260498f, 0.630813599f},
-std::array<float,2>{0.137013599f, 0.369703203f},
-std::array<float,2>{0.657426596f, 0.480834454f},
-std::array<float,2>{0.00250602118f, 0.596286654f},
-std::array<float,2>{0.90449059f, 0.783410251f},
-std::array<float,2>{0.435283124f, 0.00322543853f},
-std::array<float,2>{0.503980756f, 0.0754127353f},
-std::array<float,2>{0.22214286f, 0.842582881f},
-std::array<float,2>{0.827020824f, 0.506234884f},
-std::array<float,2>{0.307759166f, 0.393341869f},
-std::array<float,2>{0.980885983f, 0.275094569f},
-std::array<float,2>{0.468126088f, 0.746661961f},
-std::array<float,2>{0.710524857f, 0.976406276f},
-std::array<float,2>{0.0987367928f, 0.240949869f},
-std::array<float,2>{0.928881764f, 0.0383678041f},
-std::array<float,2>{0.384286404f, 0.776546061f},
-std::array<float,2>{0.633213699f, 0.567034423f},
-std::array<float,2>{0.0579579547f, 0.437849849f},
-std::array<float,2>{0.584171891f, 0.317432314f},
-std::array<float,2>{0.157175511f, 0.679874361f},
-std::array<float,2>{0.770738721f, 0.937272787f},
-std::array<float,2>{0.349813759f, 0.160397589f},
-std::array<float,2>{0.723320603f, 0.203372687f},
-std::array<float,2>{0.0682442486f, 0.966004133f},
-std::array<float,2>{0.943032622f, 0.68891412f},
-std::array<float,2>{0.472590566f, 0.309642047f},
-std::array<float,2>{0.866275907f, 0.427435309f},
-std::array<float,2>{0.264487505f, 0.53852576f},
-std::array<float,2>{0.556730211f, 0.86546433f},
-std::array<float,2>{0.192540526f, 0.121302292f},
-std::array<float,2>{0.781447589f, 0.0654339418f},
-std::array<float,2>{0.33386004f, 0.832550228f},
-std::array<float,2>{0.602324128f, 0.509886622f},
-std::array<float,2>{0.142668232f, 0.398820192f},
-std::array<float,2>{0.686386883f, 0.270571619f},
-std::array<float,2>{0.0169171877f, 0.73486656f},
-std::array<float,2>{0.88247931f, 0.976684034f},
-std::array<float,2>{0.419910103f, 0.247504845f},
-std::array<float,2>{0.520935357f, 0.149273947f},
-std::array<float,2>{0.242811501f, 0.898553669f},
-std::array<float,2>{0.843300819f, 0.635531127f},
-std::array<float,2>{0.285825491f, 0.360254258f},
-std::array<float,2>{0.997066796f, 0.475589395f},
-std::array<float,2>{0.439193398f, 0.602318168f},
-std::array<float,2>{0.700841784f, 0.793070138f},
-std::array<float,2>{0.120835952f, 0.0138313556f},
-std::array<float,2>{0.908364892f, 0.213161111f},
-std::array<float,2>{0.403757632f, 0.955872655f},
-std::array<float,2>{0.644165158f, 0.702784836f},
-std::array<float,2>{0.0383202992f, 0.298385888f},
-std::array<float,2>{0.569295466f, 0.430164605f},
-std::array<float,2>{0.184461057f, 0.540516853f},
-std::array<float,2>{0.756181896f, 0.874752939f},
-std::array<float,2>{0.364813238f, 0.114799291f},
-std::array<float,2>{0.73731035f, 0.0453146882f},
-std::array<float,2>{0.0835134238f, 0.771086037f},
-std::array<float,2>{0.958310366f, 0.573956966f},
-std::array<float,2>{0.493865311f, 0.447277457f},
-std::array<float,2>{0.858451843f, 0.325211197f},
-std::array<float,2>{0.270049125f, 0.675498784f},
-std::array<float,2>{0.541829765f, 0.925575733f},
-std::array<float,2>{0.214484334f, 0.167576641f},
-std::array<float,2>{0.821850061f, 0.178881526f},
-std::array<float,2>{0.308599174f, 0.915137291f},
-std::array<float,2>{0.500067174f, 0.659160078f},
-std::array<float,2>{0.225013942f, 0.333273083f},
-std::array<float,2>{0.703272462f, 0.463772267f},
-std::array<float,2>{0.0967095941f, 0.593467236f},
-std::array<float,2>{0.980369151f, 0.757710934f},
-std::array<float,2>{0.463759512f, 0.0619396158f},
-std::array<float,2>{0.620951593f, 0.0980683267f},
-std::array<float,2>{0.135396168f, 0.851489782f},
-std::array<float,2>{0.80727011f, 0.556514621f},
-std::array<float,2>{0.313522667f, 0.409362614f},
-std::array<float,2>{0.899175525f, 0.289749503f},
-std::array<float,2>{0.431291848f, 0.715174377f},
-std::array<float,2>{0.66105938f, 0.945106983f},
-std::array<float,2>{0.00696259178f, 0.190923527f},
-std::array<float,2>{0.939095497f, 0.0245480128f},
-std::array<float,2>{0.473421007f, 0.808900177f},
-std::array<float,2>{0.719672799f, 0.620952368f},
-std::array<float,2>{0.0640582964f, 0.493037939f},
-std::array<float,2>{0.560211957f, 0.345906496f},
-std::array<float,2>{0.189559162f, 0.649008453f},
-std::array<float,2>{0.859482288f, 0.886762798f},
-std::array<float,2>{0.258664697f, 0.13784723f},
-std::array<float,2>{0.637112439f, 0.229131281f},
-std::array<float,2>{0.05935058f, 0.994258642f},
-std::array<float,2>{0.922983885f, 0.733163536f},
-std::array<float,2>{0.387075305f, 0.253832728f},
-std::array<float,2>{0.768057108f, 0.388556331f},
-std::array<float,2>{0.344086885f, 0.525773168f},
-std::array<float,2>{0.581652462f, 0.822272956f},
-std::array<float,2>{0.163987726f, 0.0824281871f},
-std::array<float,2>{0.871986389f, 0.0493678562f},
-std::array<float,2>{0.256489694f, 0.763816953f},
-std::array<float,2>{0.553581774f, 0.580330849f},
-std::array<float,2>{0.198144943f, 0.458495766f},
-std::array<float,2>{0.728031099f, 0.336212903f},
-std::array<float,2>{0.0714422837f, 0.66915518f},
-std::array<float,2>{0.950740218f, 0.912776053f},
-std::array<float,2>{0.481411368f, 0.184312493f},
-std::array<float,2>{0.592369318f, 0.199940607f},
-std::array<float,2>{0.1711362f, 0.952558458f},
-std::array<float,2>{0.773846149f, 0.707859099f},
-std::array<float,2>{0.353539646f, 0.284556121f},
-std::array<float,2>{0.937009394f, 0.419619888f},
-std::array<float,2>{0.377196938f, 0.55348146f},
-std::array<float,2>{0.628533244f, 0.853571951f},
-std::array<float,2>{0.0496073216f, 0.103086784f},
-std::array<float,2>{0.974038482f, 0.130381182f},
-std::array<float,2>{0.458428472f, 0.878933012f},
-std::array<float,2>{0.716531992f, 0.645225525f},
-std::array<float,2>{0.103599563f, 0.358498871f},
-std::array<float,2>{0.509333909f, 0.489533991f},
-std::array<float,2>{0.228143945f, 0.611551821f},
-std::array<float,2>{0.813139439f, 0.797021389f},
-std::array<float,2>{0.303200185f, 0.0182899535f},
-std::array<float,2>{0.665390849f, 0.08944498f},
-std::array<float,2>{0.013541623f, 0.817143321f},
-std::array<float,2>{0.89383477f, 0.51850915f},
-std::array<float,2>{0.422111809f, 0.379256427f},
-std::array<float,2>{0.80257231f, 0.25902009f},
-std::array<float,2>{0.327477217f, 0.719518006f},
-std::array<float,2>{0.616105914f, 0.989183426f},
-std::array<float,2>{0.12563467f, 0.223923787f},
-std::array<float,2>{0.75818485f, 0.237803265f},
-std::array<float,2>{0.372992218f, 0.969190061f},
-std::array<float,2>{0.577604234f, 0.742622375f},
-std::array<float,2>{0.174462378f, 0.277890772f},
-std::array<float,2>{0.649074614f, 0.395630181f},
-std::array<float,2>{0.0455991104f, 0.500494123f},
-std::array<float,2>{0.91643101f, 0.839031219f},
-std::array<float,2>{0.390937626f, 0.0728539824f},
-std::array<float,2>{0.531805992f, 0.00773073034f},
-std::array<float,2>{0.206927344f, 0.787864208f},
-std::array<float,2>{0.844723403f, 0.598639309f},
-std::array<float,2>{0.281152517f, 0.477088481f},
-std::array<float,2>{0.965068221f, 0.373839259f},
-std::array<float,2>{0.4878712f, 0.62821275f},
-std::array<float,2>{0.747030795f, 0.89590764f},
-std::array<float,2>{0.0897301435f, 0.141466334f},
-std::array<float,2>{0.886581004f, 0.117699094f},
-std::array<float,2>{0.408750981f, 0.86109972f},
-std::array<float,2>{0.674630582f, 0.53199923f},
-std::array<float,2>{0.0265061129f, 0.424951017f},
-std::array<float,2>{0.59649241f, 0.307398587f},
-std::array<float,2>{0.150682911f, 0.695143163f},
-std::array<float,2>{0.794512749f, 0.961114526f},
-std::array<float,2>{0.341458857f, 0.210661277f},
-std::array<float,2>{0.694128931f, 0.158549905f},
-std::array<float,2>{0.113264054f, 0.931794047f},
-std::array<float,2>{0.990982294f, 0.684697747f},
-std::array<float,2>{0.44973889f, 0.316295058f},
-std::array<float,2>{0.830316603f, 0.444829047f},
-std::array<float,2>{0.293678194f, 0.563991189f},
-std::array<float,2>{0.530542016f, 0.780056775f},
-std::array<float,2>{0.238508031f, 0.0313377008f},
-std::array<float,2>{0.798898757f, 0.0397717841f},
-std::array<float,2>{0.323365241f, 0.769095778f},
-std::array<float,2>{0.610239029f, 0.574948251f},
-std::array<float,2>{0.129096299f, 0.452193499f},
-std::array<float,2>{0.669366002f, 0.320417017f},
-std::array<float,2>{0.00849892758f, 0.676558793f},
-std::array<float,2>{0.895071328f, 0.926051259f},
-std::array<float,2>{0.429110736f, 0.171287775f},
-std::array<float,2>{0.512508512f, 0.217736542f},
-std::array<float,2>{0.232449383f, 0.95774895f},
-std::array<float,2>{0.817178726f, 0.695502222f},
-std::array<float,2>{0.30034703f, 0.302075565f},
-std::array<float,2>{0.969807267f, 0.433764994f},
-std::array<float,2>{0.454042584f, 0.546196222f},
-std::array<float,2>{0.712006688f, 0.868627727f},
-std::array<float,2>{0.108690277f, 0.110965319f},
-std::array<float,2>{0.930829585f, 0.153287634f},
-std::array<float,2>{0.379089117f, 0.905743062f},
-std::array<float,2>{0.629898012f, 0.639897525f},
-std::array<float,2>{0.0530162491f, 0.363675296f},
-std::array<float,2>{0.589361072f, 0.471444666f},
-std::array<float,2>{0.167127356f, 0.608019352f},
-std::array<float,2>{0.779888868f, 0.792302728f},
-std::array<float,2>{0.35646531f, 0.00802656636f},
-std::array<float,2>{0.731767058f, 0.0667636096f},
-std::array<float,2>{0.0753018931f, 0.831158817f},
-std::array<float,2>{0.946494937f, 0.5135746f},
-std::array<float,2>{0.478317857f, 0.405016422f},
-std::array<float,2>{0.868549585f, 0.266181856f},
-std::array<float,2>{0.251705468f, 0.739623785f},
-std::array<float,2>{0.550588191f, 0.982481182f},
-std::array<float,2>{0.20245041f, 0.243547827f},
-std::array<float,2>{0.835220098f, 0.230731204f},
-std::array<float,2>{0.292727649f, 0.998496115f},
-std::array<float,2>{0.525514662f, 0.727697968f},
-std::array<float,2>{0.234574333f, 0.256736875f},
-std::array<float,2>{0.68991816f, 0.384108633f},
-std::array<float,2>{0.116060615f, 0.529141963f},
-std::array<float,2>{0.984926701f, 0.82579428f},
-std::array<float,2>{0.449212193f, 0.0793746114f},
-std::array<float,2>{0.601257026f, 0.0278005339f},
-std::array<float,2>{0.15290226f, 0.805098712f},
-std::array<float,2>{0.789185226f, 0.623215735f},
-std::array<float,2>{0.339393169f, 0.496276855f},
-std::array<float,2>{0.889108062f, 0.350702375f},
-std::array<float,2>{0.410324931f, 0.653509438f},
-std::array<float,2>{0.675909221f, 0.886196911f},
-std::array<float,2>{0.0273609515f, 0.135513976f},
-std::array<float,2>{0.964086592f, 0.0966367498f},
-std::array<float,2>{0.491554022f, 0.845807135f},
-std::array<float,2>{0.743638754f, 0.560569406f},
-std::array<float,2>{0.0903439447f, 0.411432058f},
-std::array<float,2>{0.537105858f, 0.294612527f},
-std::array<float,2>{0.210880652f, 0.712637246f},
-std::array<float,2>{0.84788245f, 0.9398247f},
-std::array<float,2>{0.2735475f, 0.192255914f},
-std::array<float,2>{0.654353797f, 0.173941448f},
-std::array<float,2>{0.0418579429f, 0.919828951f},
-std::array<float,2>{0.920077384f, 0.662137032f},
-std::array<float,2>{0.395340651f, 0.328300983f},
-std::array<float,2>{0.763797879f, 0.464873344f},
-std::array<float,2>{0.367415816f, 0.587326109f},
-std::array<float,2>{0.574008286f, 0.75021106f},
-std::array<float,2>{0.175826967f, 0.0560713634f},
-std::array<float,2>{0.852275491f, 0.0918984115f},
-std::array<float,2>{0.268759519f, 0.814135075f},
-std::array<float,2>{0.545821667f, 0.522846282f},
-std::array<float,2>{0.215196148f, 0.377312273f},
-std::array<float,2>{0.741542697f, 0.264775455f},
-std::array<float,2>{0.0806070268f, 0.723244429f},
-std::array<float,2>{0.953787386f, 0.984406948f},
-std::array<float,2>{0.497479886f, 0.220354825f},
-std::array<float,2>{0.562807143f, 0.12538825f},
-std::array<float,2>{0.183522195f, 0.875379026f},
-std::array<float,2>{0.750941098f, 0.644134104f},
-std::array<float,2>{0.362991601f, 0.35513556f},
-std::array<float,2>{0.910412908f, 0.488046169f},
-std::array<float,2>{0.400631458f, 0.61429286f},
-std::array<float,2>{0.64513278f, 0.802569628f},
-std::array<float,2>{0.0339759588f, 0.0205687974f},
-std::array<float,2>{0.99261564f, 0.195393011f},
-std::array<float,2>{0.44371289f, 0.948625743f},
-std::array<float,2>{0.697256446f, 0.704398215f},
-std::array<float,2>{0.123384647f, 0.285548359f},
-std::array<float,2>{0.519015253f, 0.416790754f},
-std::array<float,2>{0.247502953f, 0.549552262f},
-std::array<float,2>{0.837670863f, 0.855472505f},
-std::array<float,2>{0.281666964f, 0.107492276f},
-std::array<float,2>{0.680658638f, 0.050845623f},
-std::array<float,2>{0.0219269525f, 0.760464132f},
-std::array<float,2>{0.876480341f, 0.58264035f},
-std::array<float,2>{0.414690763f, 0.456449836f},
-std::array<float,2>{0.787632465f, 0.340053618f},
-std::array<float,2>{0.329672992f, 0.666022122f},
-std::array<float,2>{0.605663836f, 0.907321572f},
-std::array<float,2>{0.144572198f, 0.182336628f},
-std::array<float,2>{0.773245454f, 0.163267776f},
-std::array<float,2>{0.349583358f, 0.934278369f},
-std::array<float,2>{0.583456099f, 0.6831128f},
-std::array<float,2>{0.158792511f, 0.318963259f},
-std::array<float,2>{0.635343194f, 0.441233099f},
-std::array<float,2>{0.0553107671f, 0.568660617f},
-std::array<float,2>{0.927168429f, 0.773707032f},
-std::array<float,2>{0.385644794f, 0.0369885974f},
-std::array<float,2>{0.556412339f, 0.124659374f},
-std::array<float,2>{0.194647908f, 0.863478959f},
-std::array<float,2>{0.864767075f, 0.537097335f},
-std::array<float,2>{0.262895972f, 0.428756863f},
-std::array<float,2>{0.944406152f, 0.310900271f},
-std::array<float,2>{0.469047993f, 0.689638495f},
-std::array<float,2>{0.725844085f, 0.968121588f},
-std::array<float,2>{0.0691718608f, 0.206806675f},
-std::array<float,2>{0.904203653f, 0.00160009286f},
-std::array<float,2>{0.436050236f, 0.78273803f},
-std::array<float,2>{0.658247411f, 0.595628738f},
-std::array<float,2>{0.000680027239f, 0.482755661f},
-std::array<float,2>{0.621562719f, 0.36887154f},
-std::array<float,2>{0.139090464f, 0.631442249f},
-std::array<float,2>{0.810750067f, 0.890983462f},
-std::array<float,2>{0.320295483f, 0.145491913f},
-std::array<float,2>{0.707994282f, 0.239704043f},
-std::array<float,2>{0.100828402f, 0.97302407f},
-std::array<float,2>{0.983591914f, 0.748432934f},
-std::array<float,2>{0.465901166f, 0.276808232f},
-std::array<float,2>{0.824463844f, 0.390885979f},
-std::array<float,2>{0.304852605f, 0.504091859f},
-std::array<float,2>{0.506109536f, 0.839962482f},
-std::array<float,2>{0.219073385f, 0.0777778551f},
-std::array<float,2>{0.754745841f, 0.115581915f},
-std::array<float,2>{0.365692765f, 0.871929109f},
-std::array<float,2>{0.566664517f, 0.542492092f},
-std::array<float,2>{0.185805261f, 0.432764113f},
-std::array<float,2>{0.642513573f, 0.298952609f},
-std::array<float,2>{0.0354601219f, 0.700950325f},
-std::array<float,2>{0.908037603f, 0.953811407f},
-std::array<float,2>{0.404896766f, 0.211233795f},
-std::array<float,2>{0.54032141f, 0.165065691f},
-std::array<float,2>{0.21128802f, 0.922419667f},
-std::array<float,2>{0.856087923f, 0.672046602f},
-std::array<float,2>{0.273320407f, 0.328049242f},
-std::array<float,2>{0.960914195f, 0.446806103f},
-std::array<float,2>{0.49457261f, 0.570707023f},
-std::array<float,2>{0.734806716f, 0.773424327f},
-std::array<float,2>{0.0854548961f, 0.0444534309f},
-std::array<float,2>{0.880252838f, 0.248400837f},
-std::array<float,2>{0.420141459f, 0.979517341f},
-std::array<float,2>{0.685335457f, 0.737871349f},
-std::array<float,2>{0.0190072302f, 0.27294448f},
-std::array<float,2>{0.604971111f, 0.402040482f},
-std::array<float,2>{0.141722322f, 0.508514702f},
-std::array<float,2>{0.784651995f, 0.833986342f},
-std::array<float,2>{0.334076643f, 0.0638517439f},
-std::array<float,2>{0.701506138f, 0.0122225741f},
-std::array<float,2>{0.117757425f, 0.796648741f},
-std::array<float,2>{0.999133885f, 0.60453403f},
-std::array<float,2>{0.440836132f, 0.47379908f},
-std::array<float,2>{0.841265976f, 0.36206755f},
-std::array<float,2>{0.288329989f, 0.634030402f},
-std::array<float,2>{0.521916628f, 0.900419831f},
-std::array<float,2>{0.244673103f, 0.151928529f},
-std::array<float,2>{0.862913072f, 0.139102876f},
-std::array<float,2>{0.261646032f, 0.889265716f},
-std::array<float,2>{0.562127411f, 0.651215494f},
-std::array<float,2>{0.187855795f, 0.34476319f},
-std::array<float,2>{0.721851885f, 0.494997829f},
-std::array<float,2>{0.0658860207f, 0.617754877f},
-std::array<float,2>{0.940316141f, 0.811712027f},
-std::array<float,2>{0.476458043f, 0.0259879716f},
-std::array<float,2>{0.57903856f, 0.0854327381f},
-std::array<float,2>{0.161907956f, 0.821670771f},
-std::array<float,2>{0.765766978f, 0.524021983f},
-std::array<float,2>{0.347523689f, 0.39032802f},
-std::array<float,2>{0.925280571f, 0.251162171f},
-std::array<float,2>{0.389140606f, 0.731337547f},
-std::array<float,2>{0.640334249f, 0.993536532f},
-std::array<float,2>{0.0622107014f, 0.227128625f},
-std::array<float,2>{0.97768873f, 0.0587214381f},
-std::array<float,2>{0.462156266f, 0.754119754f},
-std::array<float,2>{0.705453455f, 0.590210438f},
-std::array<float,2>{0.0952865556f, 0.461803943f},
-std::array<float,2>{0.503229856f, 0.334419787f},
-std::array<float,2>{0.223056182f, 0.657518446f},
-std::array<float,2>{0.823834538f, 0.917789102f},
-std::array<float,2>{0.312293589f, 0.176064804f},
-std::array<float,2>{0.663518906f, 0.188431814f},
-std::array<float,2>{0.00573753472f, 0.943301916f},
-std::array<float,2>{0.901059747f, 0.717391849f},
-std::array<float,2>{0.431834579f, 0.291634142f},
-std::array<float,2>{0.80611515f, 0.407977581f},
-std::array<float,2>{0.314914316f, 0.557466328f},
-std::array<float,2>{0.617247522f, 0.848724127f},
-std::array<float,2>{0.133271888f, 0.100334637f},
-std::array<float,2>{0.815360725f, 0.0168787017f},
-std::array<float,2>{0.301927716f, 0.799558342f},
-std::array<float,2>{0.509872496f, 0.609956145f},
-std::array<float,2>{0.228974268f, 0.490906894f},
-std::array<float,2>{0.718382835f, 0.356032193f},
-std::array<float,2>{0.102836065f, 0.646533489f},
-std::array<float,2>{0.976035237f, 0.882038832f},
-std::array<float,2>{0.460656255f, 0.131519109f},
-std::array<float,2>{0.614432395f, 0.22628966f},
-std::array<float,2>{0.128632933f, 0.990844369f},
-std::array<float,2>{0.80296278f, 0.721075416f},
-std::array<float,2>{0.32470876f, 0.261630744f},
-std::array<float,2>{0.891036212f, 0.382299632f},
-std::array<float,2>{0.424344391f, 0.516931236f},
-std::array<float,2>{0.666199625f, 0.81945163f},
-std::array<float,2>{0.0139336446f, 0.0865506083f},
-std::array<float,2>{0.952192068f, 0.185646012f},
-std::array<float,2>{0.48309949f, 0.911696792f},
-std::array<float,2>{0.729073048f, 0.670300603f},
-std::array<float,2>{0.0732375905f, 0.338254899f},
-std::array<float,2>{0.551691055f, 0.460211247f},
-std::array<float,2>{0.197184697f, 0.57957536f},
-std::array<float,2>{0.874440968f, 0.762094021f},
-std::array<float,2>{0.25458622f, 0.0482412539f},
-std::array<float,2>{0.625677288f, 0.104602218f},
-std::array<float,2>{0.0468994416f, 0.852037728f},
-std::array<float,2>{0.9354195f, 0.551885307f},
-std::array<float,2>{0.376734614f, 0.421705991f},
-std::array<float,2>{0.775708735f, 0.28268674f},
-std::array<float,2>{0.352130979f, 0.710887909f},
-std::array<float,2>{0.591128826f, 0.95046258f},
-std::array<float,2>{0.168630004f, 0.201845422f},
-std::array<float,2>{0.795833826f, 0.207909465f},
-std::array<float,2>{0.342642009f, 0.963672638f},
-std::array<float,2>{0.595492542f, 0.691978395f},
-std::array<float,2>{0.148648649f, 0.305880666f},
-std::array<float,2>{0.672077179f, 0.423200876f},
-std::array<float,2>{0.0245235208f, 0.534223914f},
-std::array<float,2>{0.884567022f, 0.862223685f},
-std::array<float,2>{0.40640226f, 0.119962603f},
-std::array<float,2>{0.528367817f, 0.0336262435f},
-std::array<float,2>{0.241877392f, 0.778477788f},
-std::array<float,2>{0.828538775f, 0.564504325f},
-std::array<float,2>{0.296148896f, 0.44260323f},
-std::array<float,2>{0.989909589f, 0.313349932f},
-std::array<float,2>{0.451703221f, 0.685566902f},
-std::array<float,2>{0.691889524f, 0.929946721f},
-std::array<float,2>{0.110542998f, 0.156851172f},
-std::array<float,2>{0.914679945f, 0.0720166862f},
-std::array<float,2>{0.392878205f, 0.836212397f},
-std::array<float,2>{0.651235104f, 0.503884792f},
-std::array<float,2>{0.0435685292f, 0.398297876f},
-std::array<float,2>{0.574844301f, 0.280665398f},
-std::array<float,2>{0.173613206f, 0.745608628f},
-std::array<float,2>{0.760946691f, 0.971758366f},
-std::array<float,2>{0.374866575f, 0.236323476f},
-std::array<float,2>{0.748952568f, 0.144154847f},
-std::array<float,2>{0.0865268484f, 0.897090673f},
-std::array<float,2>{0.967412651f, 0.625944734f},
-std::array<float,2>{0.484667599f, 0.372696906f},
-std::array<float,2>{0.846800387f, 0.480094492f},
-std::array<float,2>{0.27767238f, 0.601083934f},
-std::array<float,2>{0.534708261f, 0.78695178f},
-std::array<float,2>{0.204289839f, 0.00482748868f},
-std::array<float,2>{0.783638775f, 0.0141529031f},
-std::array<float,2>{0.335332006f, 0.793370247f},
-std::array<float,2>{0.604100287f, 0.602057219f},
-std::array<float,2>{0.141526014f, 0.475956142f},
-std::array<float,2>{0.683917642f, 0.359992445f},
-std::array<float,2>{0.017941352f, 0.635440469f},
-std::array<float,2>{0.879413843f, 0.898751438f},
-std::array<float,2>{0.421156645f, 0.148990616f},
-std::array<float,2>{0.522763252f, 0.247277945f},
-std::array<float,2>{0.245427698f, 0.977002323f},
-std::array<float,2>{0.840323269f, 0.7353158f},
-std::array<float,2>{0.287947565f, 0.270950675f},
-std::array<float,2>{0.998567998f, 0.398490369f},
-std::array<float,2>{0.43987453f, 0.5101735f},
-std::array<float,2>{0.702181697f, 0.8329584f},
-std::array<float,2>{0.118494816f, 0.0657652318f},
-std::array<float,2>{0.907172143f, 0.167809859f},
-std::array<float,2>{0.405398846f, 0.925508022f},
-std::array<float,2>{0.640791953f, 0.675594211f},
-std::array<float,2>{0.0367188975f, 0.325573802f},
-std::array<float,2>{0.567452013f, 0.447693884f},
-std::array<float,2>{0.186547399f, 0.574116349f},
-std::array<float,2>{0.755284071f, 0.771456063f},
-std::array<float,2>{0.366884559f, 0.0451103374f},
-std::array<float,2>{0.73619324f, 0.115183242f},
-std::array<float,2>{0.0845086128f, 0.87494266f},
-std::array<float,2>{0.959244907f, 0.540161252f},
-std::array<float,2>{0.496084094f, 0.429806441f},
-std::array<float,2>{0.856756032f, 0.298599482f},
-std::array<float,2>{0.271662444f, 0.703102887f},
-std::array<float,2>{0.539075553f, 0.955568373f},
-std::array<float,2>{0.212231681f, 0.21298553f},
-std::array<float,2>{0.823049188f, 0.191314265f},
-std::array<float,2>{0.311108947f, 0.944885135f},
-std::array<float,2>{0.502173901f, 0.714954138f},
-std::array<float,2>{0.223674417f, 0.289839655f},
-std::array<float,2>{0.706635177f, 0.40946281f},
-std::array<float,2>{0.0946324468f, 0.556339741f},
-std::array<float,2>{0.977266252f, 0.851247549f},
-std::array<float,2>{0.461106718f, 0.097780548f},
-std::array<float,2>{0.618652701f, 0.0615791194f},
-std::array<float,2>{0.134611264f, 0.757402182f},
-std::array<float,2>{0.805191219f, 0.593688786f},
-std::array<float,2>{0.315603912f, 0.463622123f},
-std::array<float,2>{0.902017713f, 0.33310768f},
-std::array<float,2>{0.433296174f, 0.658781171f},
-std::array<float,2>{0.662499607f, 0.915391803f},
-std::array<float,2>{0.00390867889f, 0.179113969f},
-std::array<float,2>{0.940705836f, 0.0822048113f},
-std::array<float,2>{0.475169212f, 0.822638631f},
-std::array<float,2>{0.721506774f, 0.525444448f},
-std::array<float,2>{0.06483908f, 0.388237923f},
-std::array<float,2>{0.560562074f, 0.253658742f},
-std::array<float,2>{0.188779384f, 0.733149707f},
-std::array<float,2>{0.861824393f, 0.994571984f},
-std::array<float,2>{0.260694116f, 0.229402199f},
-std::array<float,2>{0.638748527f, 0.138151363f},
-std::array<float,2>{0.0613617525f, 0.887082696f},
-std::array<float,2>{0.924256563f, 0.649272978f},
-std::array<float,2>{0.389773756f, 0.346043169f},
-std::array<float,2>{0.767061353f, 0.492874831f},
-std::array<float,2>{0.345873296f, 0.620662868f},
-std::array<float,2>{0.579255641f, 0.808665752f},
-std::array<float,2>{0.160184592f, 0.0246816259f},
-std::array<float,2>{0.873610318f, 0.103509046f},
-std::array<float,2>{0.255751461f, 0.853869975f},
-std::array<float,2>{0.552103579f, 0.553236067f},
-std::array<float,2>{0.196121365f, 0.419720978f},
-std::array<float,2>{0.729723692f, 0.284245193f},
-std::array<float,2>{0.0732606426f, 0.707519829f},
-std::array<float,2>{0.951420605f, 0.952320278f},
-std::array<float,2>{0.48365581f, 0.200161383f},
-std::array<float,2>{0.590718687f, 0.184475899f},
-std::array<float,2>{0.169288561f, 0.913025796f},
-std::array<float,2>{0.776474535f, 0.669229388f},
-std::array<float,2>{0.353288352f, 0.336125642f},
-std::array<float,2>{0.934309661f, 0.458224833f},
-std::array<float,2>{0.37552157f, 0.5802176f},
-std::array<float,2>{0.626144648f, 0.764077663f},
-std::array<float,2>{0.0486658178f, 0.0495629795f},
-std::array<float,2>{0.974646628f, 0.223794669f},
-std::array<float,2>{0.459142774f, 0.988915622f},
-std::array<float,2>{0.717643321f, 0.719401002f},
-std::array<float,2>{0.102484897f, 0.259268254f},
-std::array<float,2>{0.511512697f, 0.379030734f},
-std::array<float,2>{0.229537129f, 0.518143892f},
-std::array<float,2>{0.815544069f, 0.817080975f},
-std::array<float,2>{0.300969839f, 0.0897004753f},
-std::array<float,2>{0.667557478f, 0.018376464f},
-std::array<float,2>{0.015034399f, 0.79719162f},
-std::array<float,2>{0.891909599f, 0.611740708f},
-std::array<float,2>{0.424928337f, 0.489359856f},
-std::array<float,2>{0.804682076f, 0.358803362f},
-std::array<float,2>{0.325926274f, 0.645346344f},
-std::array<float,2>{0.614210069f, 0.879289865f},
-std::array<float,2>{0.127776995f, 0.130718514f},
-std::array<float,2>{0.759991705f, 0.141350329f},
-std::array<float,2>{0.373926669f, 0.895732999f},
-std::array<float,2>{0.575664163f, 0.628021002f},
-std::array<float,2>{0.172610179f, 0.37376073f},
-std::array<float,2>{0.651449561f, 0.477338374f},
-std::array<float,2>{0.0440394841f, 0.598879397f},
-std::array<float,2>{0.915356457f, 0.787616014f},
-std::array<float,2>{0.394200325f, 0.00756083895f},
-std::array<float,2>{0.533843994f, 0.0729996189f},
-std::array<float,2>{0.203418046f, 0.839227259f},
-std::array<float,2>{0.846207678f, 0.500801027f},
-std::array<float,2>{0.279097378f, 0.395900935f},
-std::array<float,2>{0.968429446f, 0.278165966f},
-std::array<float,2>{0.485662162f, 0.742193699f},
-std::array<float,2>{0.749906421f, 0.968772113f},
-std::array<float,2>{0.0872461945f, 0.238205537f},
-std::array<float,2>{0.883445501f, 0.0316541828f},
-std::array<float,2>{0.407521218f, 0.779949963f},
-std::array<float,2>{0.672854483f, 0.564317346f},
-std::array<float,2>{0.0243105721f, 0.445071369f},
-std::array<float,2>{0.594414532f, 0.316003352f},
-std::array<float,2>{0.149621263f, 0.684905767f},
-std::array<float,2>{0.796307743f, 0.931991458f},
-std::array<float,2>{0.343120277f, 0.158424497f},
-std::array<float,2>{0.69257319f, 0.21089828f},
-std::array<float,2>{0.109459929f, 0.961402893f},
-std::array<float,2>{0.988705456f, 0.694991887f},
-std::array<float,2>{0.453103215f, 0.307221085f},
-std::array<float,2>{0.829567134f, 0.425050318f},
-std::array<float,2>{0.295165449f, 0.531932116f},
-std::array<float,2>{0.528224289f, 0.860981643f},
-std::array<float,2>{0.240700424f, 0.118157528f},
-std::array<float,2>{0.781158745f, 0.0698290914f},
-std::array<float,2>{0.355622858f, 0.829300046f},
-std::array<float,2>{0.588782132f, 0.514416695f},
-std::array<float,2>{0.166137338f, 0.40328455f},
-std::array<float,2>{0.629654288f, 0.268614024f},
-std::array<float,2>{0.0546679981f, 0.740256011f},
-std::array<float,2>{0.929754436f, 0.981741011f},
-std::array<float,2>{0.379967481f, 0.245557994f},
-std::array<float,2>{0.549561918f, 0.155574813f},
-std::array<float,2>{0.202107236f, 0.903192341f},
-std::array<float,2>{0.867405713f, 0.637821019f},
-std::array<float,2>{0.250177741f, 0.366889447f},
-std::array<float,2>{0.946158767f, 0.470007628f},
-std::array<float,2>{0.477005839f, 0.605717123f},
-std::array<float,2>{0.731326878f, 0.79009831f},
-std::array<float,2>{0.0750411898f, 0.0111319479f},
-std::array<float,2>{0.895964503f, 0.216665193f},
-std::array<float,2>{0.428335309f, 0.960404754f},
-std::array<float,2>{0.668761909f, 0.697587132f},
-std::array<float,2>{0.00887229666f, 0.303926408f},
-std::array<float,2>{0.610990167f, 0.435742319f},
-std::array<float,2>{0.130519912f, 0.543841124f},
-std::array<float,2>{0.800121486f, 0.870702267f},
-std::array<float,2>{0.322979838f, 0.111494087f},
-std::array<float,2>{0.711111426f, 0.0413862057f},
-std::array<float,2>{0.10830082f, 0.767049968f},
-std::array<float,2>{0.968960762f, 0.577200651f},
-std::array<float,2>{0.454889923f, 0.450327039f},
-std::array<float,2>{0.817593038f, 0.323799878f},
-std::array<float,2>{0.299217939f, 0.677795529f},
-std::array<float,2>{0.512729049f, 0.927895546f},
-std::array<float,2>{0.234293193f, 0.168549344f},
-std::array<float,2>{0.848906457f, 0.173529193f},
-std::array<float,2>{0.275080472f, 0.921278119f},
-std::array<float,2>{0.535799205f, 0.660404742f},
-std::array<float,2>{0.209444582f, 0.330100685f},
-std::array<float,2>{0.74252069f, 0.468080878f},
-std::array<float,2>{0.0914331898f, 0.587908804f},
-std::array<float,2>{0.963178217f, 0.753875434f},
-std::array<float,2>{0.490636438f, 0.0577279143f},
-std::array<float,2>{0.572413027f, 0.0956274495f},
-std::array<float,2>{0.177381322f, 0.845520854f},
-std::array<float,2>{0.764936209f, 0.5599401f},
-std::array<float,2>{0.369065285f, 0.412337124f},
-std::array<float,2>{0.921596825f, 0.296854407f},
-std::array<float,2>{0.395901829f, 0.713122725f},
-std::array<float,2>{0.655822158f, 0.937888145f},
-std::array<float,2>{0.0423941128f, 0.194901094f},
-std::array<float,2>{0.985694528f, 0.0293909591f},
-std::array<float,2>{0.447500527f, 0.807885945f},
-std::array<float,2>{0.691126704f, 0.622898877f},
-std::array<float,2>{0.116429441f, 0.498692214f},
-std::array<float,2>{0.526584566f, 0.349212229f},
-std::array<float,2>{0.235676497f, 0.655975401f},
-std::array<float,2>{0.834754586f, 0.884358466f},
-std::array<float,2>{0.291188598f, 0.134298623f},
-std::array<float,2>{0.677613974f, 0.233112291f},
-std::array<float,2>{0.0290719513f, 0.997989595f},
-std::array<float,2>{0.889825881f, 0.729742587f},
-std::array<float,2>{0.411924303f, 0.254437923f},
-std::array<float,2>{0.790628135f, 0.386717647f},
-std::array<float,2>{0.338649333f, 0.530696809f},
-std::array<float,2>{0.600441337f, 0.828022778f},
-std::array<float,2>{0.153804675f, 0.0816881657f},
-std::array<float,2>{0.836755335f, 0.0527824759f},
-std::array<float,2>{0.283050895f, 0.759153724f},
-std::array<float,2>{0.517629564f, 0.584896028f},
-std::array<float,2>{0.246096537f, 0.453585237f},
-std::array<float,2>{0.696231246f, 0.343398392f},
-std::array<float,2>{0.124869622f, 0.665509582f},
-std::array<float,2>{0.993250132f, 0.908239603f},
-std::array<float,2>{0.445231885f, 0.181142136f},
-std::array<float,2>{0.606504261f, 0.198356673f},
-std::array<float,2>{0.146004081f, 0.945908725f},
-std::array<float,2>{0.789052486f, 0.705210745f},
-std::array<float,2>{0.328634113f, 0.288858891f},
-std::array<float,2>{0.87578696f, 0.415021181f},
-std::array<float,2>{0.415053248f, 0.548073351f},
-std::array<float,2>{0.681167901f, 0.859144211f},
-std::array<float,2>{0.0228112061f, 0.106671065f},
-std::array<float,2>{0.954907775f, 0.12713629f},
-std::array<float,2>{0.496745437f, 0.877143681f},
-std::array<float,2>{0.740457237f, 0.642514944f},
-std::array<float,2>{0.0817719847f, 0.352514744f},
-std::array<float,2>{0.546541512f, 0.485803187f},
-std::array<float,2>{0.215976819f, 0.615324855f},
-std::array<float,2>{0.852875948f, 0.803395987f},
-std::array<float,2>{0.267957211f, 0.0232634582f},
-std::array<float,2>{0.646396697f, 0.0911048129f},
-std::array<float,2>{0.0348457284f, 0.814852238f},
-std::array<float,2>{0.911753476f, 0.520808697f},
-std::array<float,2>{0.40194127f, 0.375640273f},
-std::array<float,2>{0.751387954f, 0.262679189f},
-std::array<float,2>{0.361568093f, 0.725889802f},
-std::array<float,2>{0.563551962f, 0.986398757f},
-std::array<float,2>{0.18180342f, 0.220774919f},
-std::array<float,2>{0.811771452f, 0.2411699f},
-std::array<float,2>{0.319211066f, 0.976262689f},
-std::array<float,2>{0.622411966f, 0.746909618f},
-std::array<float,2>{0.140454337f, 0.275225103f},
-std::array<float,2>{0.659620166f, 0.393092245f},
-std::array<float,2>{0.00137461186f, 0.506000757f},
-std::array<float,2>{0.90269208f, 0.842523098f},
-std::array<float,2>{0.437364012f, 0.0756755397f},
-std::array<float,2>{0.50776422f, 0.00314771314f},
-std::array<float,2>{0.220494494f, 0.783509016f},
-std::array<float,2>{0.826105952f, 0.596534312f},
-std::array<float,2>{0.305737317f, 0.480589658f},
-std::array<float,2>{0.983132422f, 0.370110124f},
-std::array<float,2>{0.465610176f, 0.630444407f},
-std::array<float,2>{0.708608091f, 0.893482208f},
-std::array<float,2>{0.0996364728f, 0.148134872f},
-std::array<float,2>{0.925932586f, 0.12154796f},
-std::array<float,2>{0.386531204f, 0.86569953f},
-std::array<float,2>{0.636215627f, 0.538201809f},
-std::array<float,2>{0.0559268557f, 0.42770946f},
-std::array<float,2>{0.582615912f, 0.309860229f},
-std::array<float,2>{0.159704924f, 0.688636303f},
-std::array<float,2>{0.771618962f, 0.96618408f},
-std::array<float,2>{0.348595351f, 0.203272f},
-std::array<float,2>{0.725151479f, 0.160594597f},
-std::array<float,2>{0.0694713816f, 0.937028766f},
-std::array<float,2>{0.943736672f, 0.680152714f},
-std::array<float,2>{0.469869077f, 0.317705184f},
-std::array<float,2>{0.863905966f, 0.437706023f},
-std::array<float,2>{0.262083024f, 0.567262948f},
-std::array<float,2>{0.554714561f, 0.776621878f},
-std::array<float,2>{0.193866298f, 0.038270399f},
-std::array<float,2>{0.757417917f, 0.0449202731f},
-std::array<float,2>{0.363755912f, 0.773105085f},
-std::array<float,2>{0.569477916f, 0.570438325f},
-std::array<float,2>{0.18531552f, 0.447184861f},
-std::array<float,2>{0.642725289f, 0.327682078f},
-std::array<float,2>{0.0377503783f, 0.672315359f},
-std::array<float,2>{0.909942567f, 0.922756135f},
-std::array<float,2>{0.402699977f, 0.165352523f},
-std::array<float,2>{0.542585969f, 0.21110113f},
-std::array<float,2>{0.213382438f, 0.954066455f},
-std::array<float,2>{0.858180285f, 0.700923443f},
-std::array<float,2>{0.271223933f, 0.299308836f},
-std::array<float,2>{0.95705235f, 0.432894707f},
-std::array<float,2>{0.493150681f, 0.542930961f},
-std::array<float,2>{0.737280667f, 0.871680975f},
-std::array<float,2>{0.0827190354f, 0.115352273f},
-std::array<float,2>{0.881506205f, 0.152155012f},
-std::array<float,2>{0.418875456f, 0.900770903f},
-std::array<float,2>{0.686721981f, 0.63414973f},
-std::array<float,2>{0.0157156996f, 0.361927062f},
-std::array<float,2>{0.603134394f, 0.473923177f},
-std::array<float,2>{0.143603384f, 0.604974806f},
-std::array<float,2>{0.782768071f, 0.796534896f},
-std::array<float,2>{0.332593203f, 0.0126149561f},
-std::array<float,2>{0.69933331f, 0.0636310577f},
-std::array<float,2>{0.11989373f, 0.834247231f},
-std::array<float,2>{0.997759342f, 0.508549631f},
-std::array<float,2>{0.438283652f, 0.402180791f},
-std::array<float,2>{0.842429042f, 0.272599846f},
-std::array<float,2>{0.286641419f, 0.738092959f},
-std::array<float,2>{0.519825876f, 0.979843557f},
-std::array<float,2>{0.244140282f, 0.248070821f},
-std::array<float,2>{0.860806942f, 0.22731474f},
-std::array<float,2>{0.259448618f, 0.993368208f},
-std::array<float,2>{0.559376657f, 0.731195509f},
-std::array<float,2>{0.191286325f, 0.25126484f},
-std::array<float,2>{0.72025907f, 0.390510082f},
-std::array<float,2>{0.0630320162f, 0.52434361f},
-std::array<float,2>{0.937679231f, 0.821443439f},
-std::array<float,2>{0.474398524f, 0.0851666331f},
-std::array<float,2>{0.580863357f, 0.0262342468f},
-std::array<float,2>{0.162296027f, 0.811817706f},
-std::array<float,2>{0.768881679f, 0.617961586f},
-std::array<float,2>{0.344795793f, 0.494754434f},
-std::array<float,2>{0.922615826f, 0.345021635f},
-std::array<float,2>{0.387982637f, 0.650998414f},
-std::array<float,2>{0.638413608f, 0.889462471f},
-std::array<float,2>{0.0599121675f, 0.138757735f},
-std::array<float,2>{0.979482889f, 0.10049735f},
-std::array<float,2>{0.464352727f, 0.848928213f},
-std::array<float,2>{0.704409719f, 0.557208419f},
-std::array<float,2>{0.0965098888f, 0.40789631f},
-std::array<float,2>{0.501299202f, 0.291853487f},
-std::array<float,2>{0.226203099f, 0.717587113f},
-std::array<float,2>{0.820472479f, 0.943012714f},
-std::array<float,2>{0.310515165f, 0.188229695f},
-std::array<float,2>{0.661350727f, 0.175815105f},
-std::array<float,2>{0.0066451109f, 0.917576492f},
-std::array<float,2>{0.899784565f, 0.657326162f},
-std::array<float,2>{0.429970682f, 0.334030986f},
-std::array<float,2>{0.808446765f, 0.461463779f},
-std::array<float,2>{0.313409686f, 0.58998251f},
-std::array<float,2>{0.619855881f, 0.75430733f},
-std::array<float,2>{0.135798082f, 0.0588387959f},
-std::array<float,2>{0.813535631f, 0.0868635327f},
-std::array<float,2>{0.303815514f, 0.819741845f},
-std::array<float,2>{0.50860393f, 0.516763151f},
-std::array<float,2>{0.226798579f, 0.381857663f},
-std::array<float,2>{0.715739369f, 0.261402875f},
-std::array<float,2>{0.104577675f, 0.720832884f},
-std::array<float,2>{0.972845376f, 0.991208136f},
-std::array<float,2>{0.457873076f, 0.226390257f},
-std::array<float,2>{0.616860509f, 0.1318039f},
-std::array<float,2>{0.126658469f, 0.882145762f},
-std::array<float,2>{0.801559985f, 0.646951735f},
-std::array<float,2>{0.326369584f, 0.3563357f},
-std::array<float,2>{0.893351078f, 0.491067916f},
-std::array<float,2>{0.42341882f, 0.610213518f},
-std::array<float,2>{0.664158642f, 0.799764752f},
-std::array<float,2>{0.0123649091f, 0.0167281367f},
-std::array<float,2>{0.94949913f, 0.20195514f},
-std::array<float,2>{0.481711984f, 0.950261295f},
-std::array<float,2>{0.727251589f, 0.71066004f},
-std::array<float,2>{0.0707298219f, 0.282237411f},
-std::array<float,2>{0.554256797f, 0.421554625f},
-std::array<float,2>{0.198638499f, 0.552185655f},
-std::array<float,2>{0.872973323f, 0.851773322f},
-std::array<float,2>{0.25687778f, 0.104810908f},
-std::array<float,2>{0.627244055f, 0.0479333103f},
-std::array<float,2>{0.0505363569f, 0.761762261f},
-std::array<float,2>{0.936357498f, 0.579314053f},
-std::array<float,2>{0.378530413f, 0.460170388f},
-std::array<float,2>{0.774800897f, 0.3380647f},
-std::array<float,2>{0.354915947f, 0.670149922f},
-std::array<float,2>{0.592832148f, 0.911992967f},
-std::array<float,2>{0.170543373f, 0.185943037f},
-std::array<float,2>{0.793732405f, 0.157058358f},
-std::array<float,2>{0.34060061f, 0.929887474f},
-std::array<float,2>{0.596863091f, 0.686033368f},
-std::array<float,2>{0.151949763f, 0.313177973f},
-std::array<float,2>{0.675560653f, 0.442746341f},
-std::array<float,2>{0.0260725971f, 0.564762175f},
-std::array<float,2>{0.885503054f, 0.778722823f},
-std::array<float,2>{0.409607917f, 0.0334220976f},
-std::array<float,2>{0.529934049f, 0.119653441f},
-std::array<float,2>{0.239316612f, 0.861857772f},
-std::array<float,2>{0.83188796f, 0.534561813f},
-std::array<float,2>{0.294768631f, 0.42287612f},
-std::array<float,2>{0.991443038f, 0.30594629f},
-std::array<float,2>{0.450197369f, 0.692337871f},
-std::array<float,2>{0.694520116f, 0.963389218f},
-std::array<float,2>{0.111938529f, 0.207627147f},
-std::array<float,2>{0.917520642f, 0.00443448499f},
-std::array<float,2>{0.391983747f, 0.786644876f},
-std::array<float,2>{0.64957118f, 0.601342916f},
-std::array<float,2>{0.0459136069f, 0.480466187f},
-std::array<float,2>{0.576351523f, 0.372831255f},
-std::array<float,2>{0.175136775f, 0.625601709f},
-std::array<float,2>{0.759407759f, 0.89729768f},
-std::array<float,2>{0.371753871f, 0.144519955f},
-std::array<float,2>{0.747136533f, 0.235851273f},
-std::array<float,2>{0.0883788764f, 0.972009182f},
-std::array<float,2>{0.96679002f, 0.745917678f},
-std::array<float,2>{0.486832291f, 0.28044948f},
-std::array<float,2>{0.845162511f, 0.398026943f},
-std::array<float,2>{0.280003577f, 0.503493369f},
-std::array<float,2>{0.532613456f, 0.835985839f},
-std::array<float,2>{0.205544069f, 0.0720675439f},
-std::array<float,2>{0.7975595f, 0.111128397f},
-std::array<float,2>{0.320840001f, 0.868302882f},
-std::array<float,2>{0.612406909f, 0.546141207f},
-std::array<float,2>{0.131995514f, 0.43387419f},
-std::array<float,2>{0.671608746f, 0.301797986f},
-std::array<float,2>{0.0111970864f, 0.695780516f},
-std::array<float,2>{0.898352623f, 0.957812726f},
-std::array<float,2>{0.426563501f, 0.217312589f},
-std::array<float,2>{0.513971269f, 0.171058163f},
-std::array<float,2>{0.230562195f, 0.92585361f},
-std::array<float,2>{0.818856001f, 0.676340044f},
-std::array<float,2>{0.297624826f, 0.320609152f},
-std::array<float,2>{0.971696079f, 0.452566057f},
-std::array<float,2>{0.455591828f, 0.575118005f},
-std::array<float,2>{0.713774979f, 0.769322455f},
-std::array<float,2>{0.107201211f, 0.0399033986f},
-std::array<float,2>{0.931790709f, 0.243290231f},
-std::array<float,2>{0.382224232f, 0.982687116f},
-std::array<float,2>{0.630865693f, 0.739288926f},
-std::array<float,2>{0.0509630181f, 0.26653403f},
-std::array<float,2>{0.587521315f, 0.405072927f},
-std::array<float,2>{0.164222881f, 0.51319313f},
-std::array<float,2>{0.777362168f, 0.831431568f},
-std::array<float,2>{0.359055281f, 0.0664814413f},
-std::array<float,2>{0.733150721f, 0.00816607568f},
-std::array<float,2>{0.0769602805f, 0.79210186f},
-std::array<float,2>{0.947867513f, 0.608347595f},
-std::array<float,2>{0.479673266f, 0.471236825f},
-std::array<float,2>{0.869852006f, 0.363388836f},
-std::array<float,2>{0.252981216f, 0.639777422f},
-std::array<float,2>{0.547824442f, 0.905463934f},
-std::array<float,2>{0.199764505f, 0.153058007f},
-std::array<float,2>{0.833969891f, 0.135402098f},
-std::array<float,2>{0.290873647f, 0.88585794f},
-std::array<float,2>{0.524281204f, 0.653730452f},
-std::array<float,2>{0.236731187f, 0.350854546f},
-std::array<float,2>{0.687527955f, 0.496469885f},
-std::array<float,2>{0.113960288f, 0.623367131f},
-std::array<float,2>{0.986732185f, 0.804865479f},
-std::array<float,2>{0.4465321f, 0.027377367f},
-std::array<float,2>{0.597893178f, 0.079286471f},
-std::array<float,2>{0.155083999f, 0.826084793f},
-std::array<float,2>{0.792298555f, 0.528971493f},
-std::array<float,2>{0.336086422f, 0.3839342f},
-std::array<float,2>{0.88812691f, 0.256557465f},
-std::array<float,2>{0.413835257f, 0.727859616f},
-std::array<float,2>{0.679033875f, 0.998215318f},
-std::array<float,2>{0.0312167834f, 0.230653509f},
-std::array<float,2>{0.962394774f, 0.0556643233f},
-std::array<float,2>{0.490002483f, 0.75029856f},
-std::array<float,2>{0.745147347f, 0.587005734f},
-std::array<float,2>{0.0930821598f, 0.465283275f},
-std::array<float,2>{0.538669586f, 0.328610927f},
-std::array<float,2>{0.207885772f, 0.662415564f},
-std::array<float,2>{0.849719644f, 0.919533312f},
-std::array<float,2>{0.276944309f, 0.174135774f},
-std::array<float,2>{0.652645469f, 0.19189848f},
-std::array<float,2>{0.0397645198f, 0.939456761f},
-std::array<float,2>{0.918581605f, 0.712877631f},
-std::array<float,2>{0.396855742f, 0.29483515f},
-std::array<float,2>{0.76243645f, 0.411185086f},
-std::array<float,2>{0.36991027f, 0.56079644f},
-std::array<float,2>{0.57103467f, 0.846071541f},
-std::array<float,2>{0.178985342f, 0.096200645f},
-std::array<float,2>{0.853930295f, 0.0209220611f},
-std::array<float,2>{0.265668273f, 0.802482009f},
-std::array<float,2>{0.54323411f, 0.614721477f},
-std::array<float,2>{0.218183801f, 0.487912089f},
-std::array<float,2>{0.738694429f, 0.355382591f},
-std::array<float,2>{0.0783904269f, 0.644435704f},
-std::array<float,2>{0.95572108f, 0.875116825f},
-std::array<float,2>{0.498460859f, 0.125169039f},
-std::array<float,2>{0.56579107f, 0.220504984f},
-std::array<float,2>{0.181540385f, 0.984713614f},
-std::array<float,2>{0.753366232f, 0.723533332f},
-std::array<float,2>{0.36116752f, 0.265129507f},
-std::array<float,2>{0.913062155f, 0.377029151f},
-std::array<float,2>{0.399037123f, 0.522634506f},
-std::array<float,2>{0.647129595f, 0.814440608f},
-std::array<float,2>{0.0329069011f, 0.0921650901f},
-std::array<float,2>{0.994350374f, 0.182597265f},
-std::array<float,2>{0.442438751f, 0.907672465f},
-std::array<float,2>{0.698245227f, 0.666357577f},
-std::array<float,2>{0.122631557f, 0.340269119f},
-std::array<float,2>{0.517531633f, 0.456214041f},
-std::array<float,2>{0.249631405f, 0.582765758f},
-std::array<float,2>{0.838110626f, 0.760593712f},
-std::array<float,2>{0.283309609f, 0.0511993244f},
-std::array<float,2>{0.682854235f, 0.1076831f},
-std::array<float,2>{0.0198902451f, 0.855747879f},
-std::array<float,2>{0.878329873f, 0.549781382f},
-std::array<float,2>{0.417920709f, 0.416713744f},
-std::array<float,2>{0.785702586f, 0.285311431f},
-std::array<float,2>{0.330783635f, 0.704316854f},
-std::array<float,2>{0.609165967f, 0.948371649f},
-std::array<float,2>{0.147286341f, 0.195578977f},
-std::array<float,2>{0.769979477f, 0.20670481f},
-std::array<float,2>{0.351429462f, 0.967939198f},
-std::array<float,2>{0.58523643f, 0.6897223f},
-std::array<float,2>{0.157882228f, 0.310670912f},
-std::array<float,2>{0.634491503f, 0.42899093f},
-std::array<float,2>{0.057259582f, 0.536836803f},
-std::array<float,2>{0.927881062f, 0.86374712f},
-std::array<float,2>{0.383120298f, 0.124965563f},
-std::array<float,2>{0.557697058f, 0.0366611034f},
-std::array<float,2>{0.191772699f, 0.773557723f},
-std::array<float,2>{0.865550876f, 0.568580091f},
-std::array<float,2>{0.264677554f, 0.440988272f},
-std::array<float,2>{0.942174494f, 0.319220394f},
-std::array<float,2>{0.470896244f, 0.683537483f},
-std::array<float,2>{0.724006534f, 0.934429705f},
-std::array<float,2>{0.0671743304f, 0.163434952f},
-std::array<float,2>{0.905294061f, 0.0779214129f},
-std::array<float,2>{0.433639258f, 0.84015882f},
-std::array<float,2>{0.65659976f, 0.504266858f},
-std::array<float,2>{0.00341749936f, 0.390814751f},
-std::array<float,2>{0.624744236f, 0.276599288f},
-std::array<float,2>{0.137734041f, 0.748119533f},
-std::array<float,2>{0.810135186f, 0.972863734f},
-std::array<float,2>{0.316775829f, 0.239382252f},
-std::array<float,2>{0.709122121f, 0.145180866f},
-std::array<float,2>{0.0982600003f, 0.890838087f},
-std::array<float,2>{0.98194629f, 0.63175869f},
-std::array<float,2>{0.467393875f, 0.369080961f},
-std::array<float,2>{0.827278018f, 0.48259899f},
-std::array<float,2>{0.307521313f, 0.595267534f},
-std::array<float,2>{0.505274713f, 0.783183455f},
-std::array<float,2>{0.22145851f, 0.00195206783f},
-std::array<float,2>{0.768323839f, 0.0241706315f},
-std::array<float,2>{0.34450075f, 0.810054064f},
-std::array<float,2>{0.581195235f, 0.619556725f},
-std::array<float,2>{0.163239554f, 0.493365884f},
-std::array<float,2>{0.637531877f, 0.34719944f},
-std::array<float,2>{0.0586354993f, 0.64969945f},
-std::array<float,2>{0.923530996f, 0.888145208f},
-std::array<float,2>{0.387654692f, 0.137530312f},
-std::array<float,2>{0.560012519f, 0.229614854f},
-std::array<float,2>{0.190345168f, 0.995247781f},
-std::array<float,2>{0.860094845f, 0.733515859f},
-std::array<float,2>{0.258078545f, 0.252231836f},
-std::array<float,2>{0.938783169f, 0.387066901f},
-std::array<float,2>{0.472981304f, 0.526866972f},
-std::array<float,2>{0.71889168f, 0.824088156f},
-std::array<float,2>{0.0638076663f, 0.083428368f},
-std::array<float,2>{0.898668349f, 0.178706929f},
-std::array<float,2>{0.430881023f, 0.914657235f},
-std::array<float,2>{0.660603106f, 0.660009325f},
-std::array<float,2>{0.00777229108f, 0.33210057f},
-std::array<float,2>{0.620494068f, 0.463893116f},
-std::array<float,2>{0.135079414f, 0.591857553f},
-std::array<float,2>{0.806802928f, 0.75661099f},
-std::array<float,2>{0.314286381f, 0.0605543368f},
-std::array<float,2>{0.703832924f, 0.0987529755f},
-std::array<float,2>{0.0972730294f, 0.850008845f},
-std::array<float,2>{0.979557395f, 0.555249751f},
-std::array<float,2>{0.46317029f, 0.408817381f},
-std::array<float,2>{0.821436584f, 0.290404946f},
-std::array<float,2>{0.309534132f, 0.715959609f},
-std::array<float,2>{0.500586927f, 0.943888664f},
-std::array<float,2>{0.225578487f, 0.1903442f},
-std::array<float,2>{0.859171331f, 0.2145904f},
-std::array<float,2>{0.269952685f, 0.95676887f},
-std::array<float,2>{0.541363001f, 0.701358378f},
-std::array<float,2>{0.214010894f, 0.297308862f},
-std::array<float,2>{0.7381832f, 0.431474239f},
-std::array<float,2>{0.0834471807f, 0.53951329f},
-std::array<float,2>{0.958646536f, 0.873319089f},
-std::array<float,2>{0.493213028f, 0.113296337f},
-std::array<float,2>{0.568621933f, 0.0460266657f},
-std::array<float,2>{0.184062213f, 0.769551039f},
-std::array<float,2>{0.756440461f, 0.573215246f},
-std::array<float,2>{0.364487141f, 0.449173242f},
-std::array<float,2>{0.90903157f, 0.324990809f},
-std::array<float,2>{0.404287606f, 0.67392081f},
-std::array<float,2>{0.643754721f, 0.923862219f},
-std::array<float,2>{0.0388785154f, 0.166315377f},
-std::array<float,2>{0.996360898f, 0.0646645948f},
-std::array<float,2>{0.438584179f, 0.833373308f},
-std::array<float,2>{0.700281799f, 0.511596203f},
-std::array<float,2>{0.12055327f, 0.39959088f},
-std::array<float,2>{0.521172881f, 0.269747317f},
-std::array<float,2>{0.242356658f, 0.736174285f},
-std::array<float,2>{0.843118906f, 0.977569759f},
-std::array<float,2>{0.285535008f, 0.246352538f},
-std::array<float,2>{0.685855865f, 0.149934143f},
-std::array<float,2>{0.0172573142f, 0.89986515f},
-std::array<float,2>{0.881876111f, 0.636611879f},
-std::array<float,2>{0.418948591f, 0.360966504f},
-std::array<float,2>{0.781817794f, 0.475161642f},
-std::array<float,2>{0.3331348f, 0.603478849f},
-std::array<float,2>{0.601617992f, 0.793982983f},
-std::array<float,2>{0.143468559f, 0.0155977774f},
-std::array<float,2>{0.830795527f, 0.118926853f},
-std::array<float,2>{0.293191552f, 0.860126495f},
-std::array<float,2>{0.530970812f, 0.532448173f},
-std::array<float,2>{0.239236042f, 0.423869878f},
-std::array<float,2>{0.693463504f, 0.308087021f},
-std::array<float,2>{0.11276187f, 0.6933918f},
-std::array<float,2>{0.990436256f, 0.962210894f},
-std::array<float,2>{0.4492926f, 0.209716365f},
-std::array<float,2>{0.595825672f, 0.159449399f},
-std::array<float,2>{0.150886253f, 0.9334113f},
-std::array<float,2>{0.794257224f, 0.683596015f},
-std::array<float,2>{0.34086147f, 0.314938575f},
-std::array<float,2>{0.886028945f, 0.443833262f},
-std::array<float,2>{0.40864408f, 0.56294775f},
-std::array<float,2>{0.674251199f, 0.780923545f},
-std::array<float,2>{0.0270214844f, 0.0323614702f},
-std::array<float,2>{0.965745449f, 0.236971393f},
-std::array<float,2>{0.487364143f, 0.970534742f},
-std::array<float,2>{0.746444821f, 0.743600965f},
-std::array<float,2>{0.0892136842f, 0.279195309f},
-std::array<float,2>{0.531315625f, 0.394822955f},
-std::array<float,2>{0.206314027f, 0.501684546f},
-std::array<float,2>{0.843955696f, 0.838815749f},
-std::array<float,2>{0.280471116f, 0.0740820765f},
-std::array<float,2>{0.648766875f, 0.00664711464f},
-std::array<float,2>{0.0450154431f, 0.788512051f},
-std::array<float,2>{0.916840613f, 0.597729504f},
-std::array<float,2>{0.391526759f, 0.477578372f},
-std::array<float,2>{0.758741975f, 0.374721378f},
-std::array<float,2>{0.372292876f, 0.627488434f},
-std::array<float,2>{0.578078568f, 0.894851446f},
-std::array<float,2>{0.174063727f, 0.141970947f},
-std::array<float,2>{0.801808f, 0.128933281f},
-std::array<float,2>{0.327882886f, 0.880505204f},
-std::array<float,2>{0.615248561f, 0.646254122f},
-std::array<float,2>{0.125404283f, 0.358047009f},
-std::array<float,2>{0.665893734f, 0.488826483f},
-std::array<float,2>{0.013002295f, 0.612424314f},
-std::array<float,2>{0.894378126f, 0.798043311f},
-std::array<float,2>{0.422453642f, 0.0194295365f},
-std::array<float,2>{0.508804381f, 0.0881761461f},
-std::array<float,2>{0.227849945f, 0.818322003f},
-std::array<float,2>{0.812736809f, 0.519341409f},
-std::array<float,2>{0.303258598f, 0.380614519f},
-std::array<float,2>{0.974347413f, 0.257989973f},
-std::array<float,2>{0.458505064f, 0.720217884f},
-std::array<float,2>{0.716099918f, 0.990124166f},
-std::array<float,2>{0.104111955f, 0.223085374f},
-std::array<float,2>{0.937084138f, 0.0502489582f},
-std::array<float,2>{0.37781173f, 0.764748454f},
-std::array<float,2>{0.627976239f, 0.581413448f},
-std::array<float,2>{0.0489292033f, 0.457289487f},
-std::array<float,2>{0.591999471f, 0.337054431f},
-std::array<float,2>{0.171625927f, 0.667979479f},
-std::array<float,2>{0.774017453f, 0.913992465f},
-std::array<float,2>{0.354091704f, 0.184672773f},
-std::array<float,2>{0.727650344f, 0.200555474f},
-std::array<float,2>{0.072094582f, 0.951389015f},
-std::array<float,2>{0.95045054f, 0.708679974f},
-std::array<float,2>{0.480760187f, 0.283452421f},
-std::array<float,2>{0.871186972f, 0.418543726f},
-std::array<float,2>{0.25621745f, 0.554445922f},
-std::array<float,2>{0.553211987f, 0.855161548f},
-std::array<float,2>{0.197419122f, 0.101601623f},
-std::array<float,2>{0.791225195f, 0.0801953971f},
-std::array<float,2>{0.337116599f, 0.826347768f},
-std::array<float,2>{0.599026859f, 0.530221343f},
-std::array<float,2>{0.156146914f, 0.384882331f},
-std::array<float,2>{0.67831254f, 0.255521238f},
-std::array<float,2>{0.0294145606f, 0.728821635f},
-std::array<float,2>{0.886943042f, 0.996533453f},
-std::array<float,2>{0.41214928f, 0.234239891f},
-std::array<float,2>{0.525036156f, 0.133724198f},
-std::array<float,2>{0.238272414f, 0.883712828f},
-std::array<float,2>{0.83209455f, 0.654337168f},
-std::array<float,2>{0.289552897f, 0.347928077f},
-std::array<float,2>{0.987522423f, 0.499156207f},
-std::array<float,2>{0.446242809f, 0.62169826f},
-std::array<float,2>{0.689304411f, 0.807205856f},
-std::array<float,2>{0.114535511f, 0.0311100408f},
-std::array<float,2>{0.918987334f, 0.193464443f},
-std::array<float,2>{0.398228228f, 0.93863982f},
-std::array<float,2>{0.653835356f, 0.71466291f},
-std::array<float,2>{0.0408288315f, 0.295089185f},
-std::array<float,2>{0.572252333f, 0.413816571f},
-std::array<float,2>{0.178513274f, 0.55862236f},
-std::array<float,2>{0.763021946f, 0.844551921f},
-std::array<float,2>{0.370463967f, 0.094492957f},
-std::array<float,2>{0.744972408f, 0.0567678884f},
-std::array<float,2>{0.0923389718f, 0.752058387f},
-std::array<float,2>{0.961620271f, 0.589799523f},
-std::array<float,2>{0.489238083f, 0.466856867f},
-std::array<float,2>{0.851205111f, 0.331122339f},
-std::array<float,2>{0.275677592f, 0.661781073f},
-std::array<float,2>{0.537388325f, 0.920045853f},
-std::array<float,2>{0.208569437f, 0.172385216f},
-std::array<float,2>{0.820109189f, 0.169356599f},
-std::array<float,2>{0.298195481f, 0.929109395f},
-std::array<float,2>{0.514673412f, 0.678844333f},
-std::array<float,2>{0.232273176f, 0.323149383f},
-std::array<float,2>{0.713948429f, 0.450048745f},
-std::array<float,2>{0.10603407f, 0.57642138f},
-std::array<float,2>{0.971172035f, 0.766007483f},
-std::array<float,2>{0.456100255f, 0.0429219343f},
-std::array<float,2>{0.611333191f, 0.112322167f},
-std::array<float,2>{0.130973533f, 0.86985445f},
-std::array<float,2>{0.798455298f, 0.54425633f},
-std::array<float,2>{0.321338475f, 0.436812669f},
-std::array<float,2>{0.896832168f, 0.303655267f},
-std::array<float,2>{0.427192211f, 0.698515475f},
-std::array<float,2>{0.670700371f, 0.959179044f},
-std::array<float,2>{0.00992275961f, 0.214885995f},
-std::array<float,2>{0.949061751f, 0.00983509514f},
-std::array<float,2>{0.4787305f, 0.789416134f},
-std::array<float,2>{0.734241605f, 0.606758058f},
-std::array<float,2>{0.077733092f, 0.469236374f},
-std::array<float,2>{0.548682988f, 0.365437686f},
-std::array<float,2>{0.200852036f, 0.637362421f},
-std::array<float,2>{0.870853543f, 0.903398573f},
-std::array<float,2>{0.252314091f, 0.154886961f},
-std::array<float,2>{0.632181823f, 0.244344383f},
-std::array<float,2>{0.052447252f, 0.980727851f},
-std::array<float,2>{0.932698429f, 0.74163568f},
-std::array<float,2>{0.381662488f, 0.267937154f},
-std::array<float,2>{0.7785514f, 0.404019177f},
-std::array<float,2>{0.358158946f, 0.515050888f},
-std::array<float,2>{0.586136878f, 0.828950763f},
-std::array<float,2>{0.165191203f, 0.0683691353f},
-std::array<float,2>{0.866979897f, 0.0373713002f},
-std::array<float,2>{0.264020622f, 0.776351929f},
-std::array<float,2>{0.557137907f, 0.567940593f},
-std::array<float,2>{0.193122745f, 0.438826382f},
-std::array<float,2>{0.723089814f, 0.316874176f},
-std::array<float,2>{0.0674984977f, 0.68132931f},
-std::array<float,2>{0.942637622f, 0.935613811f},
-std::array<float,2>{0.472165704f, 0.161238641f},
-std::array<float,2>{0.584707618f, 0.204827204f},
-std::array<float,2>{0.156718999f, 0.965117037f},
-std::array<float,2>{0.771459401f, 0.687578917f},
-std::array<float,2>{0.350471765f, 0.308967769f},
-std::array<float,2>{0.929674387f, 0.426293492f},
-std::array<float,2>{0.383935422f, 0.537162066f},
-std::array<float,2>{0.633320272f, 0.86670506f},
-std::array<float,2>{0.0584402829f, 0.123007894f},
-std::array<float,2>{0.98118645f, 0.147235468f},
-std::array<float,2>{0.468271315f, 0.894065678f},
-std::array<float,2>{0.710104704f, 0.628984213f},
-std::array<float,2>{0.0993560329f, 0.370940179f},
-std::array<float,2>{0.504460931f, 0.482325613f},
-std::array<float,2>{0.222563371f, 0.597095609f},
-std::array<float,2>{0.826341271f, 0.784244716f},
-std::array<float,2>{0.308226705f, 0.00292703719f},
-std::array<float,2>{0.657829762f, 0.0745133534f},
-std::array<float,2>{0.0020990097f, 0.843581796f},
-std::array<float,2>{0.904853761f, 0.507126689f},
-std::array<float,2>{0.434570402f, 0.393958092f},
-std::array<float,2>{0.808912992f, 0.273903787f},
-std::array<float,2>{0.317908943f, 0.747766078f},
-std::array<float,2>{0.623662472f, 0.975104928f},
-std::array<float,2>{0.137354523f, 0.241896227f},
-std::array<float,2>{0.752002776f, 0.222591579f},
-std::array<float,2>{0.360242695f, 0.987504601f},
-std::array<float,2>{0.56490159f, 0.724677444f},
-std::array<float,2>{0.180544093f, 0.262844473f},
-std::array<float,2>{0.647584617f, 0.37650758f},
-std::array<float,2>{0.0320748612f, 0.52039963f},
-std::array<float,2>{0.913210154f, 0.815697789f},
-std::array<float,2>{0.40014264f, 0.0907495022f},
-std::array<float,2>{0.544271827f, 0.0214898027f},
-std::array<float,2>{0.217264637f, 0.804003954f},
-std::array<float,2>{0.85514009f, 0.616568327f},
-std::array<float,2>{0.266649425f, 0.485324293f},
-std::array<float,2>{0.956058979f, 0.352793932f},
-std::array<float,2>{0.499518007f, 0.641112089f},
-std::array<float,2>{0.740100086f, 0.878058612f},
-std::array<float,2>{0.0792612731f, 0.128102824f},
-std::array<float,2>{0.877576053f, 0.105802417f},
-std::array<float,2>{0.416542679f, 0.858299792f},
-std::array<float,2>{0.682237029f, 0.547818422f},
-std::array<float,2>{0.0211080667f, 0.415864289f},
-std::array<float,2>{0.608300328f, 0.287315339f},
-std::array<float,2>{0.14765878f, 0.706495345f},
-std::array<float,2>{0.786290765f, 0.946357131f},
-std::array<float,2>{0.331528187f, 0.197479635f},
-std::array<float,2>{0.697639644f, 0.180355459f},
-std::array<float,2>{0.121995278f, 0.909903526f},
-std::array<float,2>{0.995273471f, 0.664932013f},
-std::array<float,2>{0.441959351f, 0.342655689f},
-std::array<float,2>{0.839513123f, 0.454493314f},
-std::array<float,2>{0.285065234f, 0.585498929f},
-std::array<float,2>{0.516147852f, 0.758728564f},
-std::array<float,2>{0.248954564f, 0.0545191616f},
-std::array<float,2>{0.806249201f, 0.0596988201f},
-std::array<float,2>{0.31541273f, 0.755563617f},
-std::array<float,2>{0.618027925f, 0.5916152f},
-std::array<float,2>{0.13363573f, 0.461941928f},
-std::array<float,2>{0.663952589f, 0.335017234f},
-std::array<float,2>{0.00529854232f, 0.656635821f},
-std::array<float,2>{0.900704026f, 0.916399777f},
-std::array<float,2>{0.432396322f, 0.176808462f},
-std::array<float,2>{0.50342977f, 0.189350858f},
-std::array<float,2>{0.223251179f, 0.942362309f},
-std::array<float,2>{0.823328614f, 0.718432903f},
-std::array<float,2>{0.311978251f, 0.292289734f},
-std::array<float,2>{0.978503466f, 0.406395346f},
-std::array<float,2>{0.462771386f, 0.558001339f},
-std::array<float,2>{0.705945432f, 0.847779095f},
-std::array<float,2>{0.0949761271f, 0.101108991f},
-std::array<float,2>{0.92576462f, 0.140122071f},
-std::array<float,2>{0.389643252f, 0.890612781f},
-std::array<float,2>{0.639920712f, 0.652209342f},
-std::array<float,2>{0.0617243089f, 0.344359875f},
-std::array<float,2>{0.578351855f, 0.495285273f},
-std::array<float,2>{0.161367476f, 0.618648946f},
-std::array<float,2>{0.766362429f, 0.811018109f},
-std::array<float,2>{0.346784681f, 0.0270532668f},
-std::array<float,2>{0.722358584f, 0.0842141137f},
-std::array<float,2>{0.0661063716f, 0.820495605f},
-std::array<float,2>{0.939803481f, 0.525343359f},
-std::array<float,2>{0.475789547f, 0.388736278f},
-std::array<float,2>{0.862513781f, 0.250930578f},
-std::array<float,2>{0.26118198f, 0.73204416f},
-std::array<float,2>{0.561573863f, 0.992564738f},
-std::array<float,2>{0.188255057f, 0.227950901f},
-std::array<float,2>{0.841645956f, 0.249811321f},
-std::array<float,2>{0.288990259f, 0.979377508f},
-std::array<float,2>{0.522254229f, 0.736681461f},
-std::array<float,2>{0.244353637f, 0.271998972f},
-std::array<float,2>{0.701674759f, 0.400443554f},
-std::array<float,2>{0.117481336f, 0.508806944f},
-std::array<float,2>{0.99963069f, 0.835480809f},
-std::array<float,2>{0.44139114f, 0.0632677004f},
-std::array<float,2>{0.605022669f, 0.0133291017f},
-std::array<float,2>{0.142301932f, 0.794996858f},
-std::array<float,2>{0.784795284f, 0.604093134f},
-std::array<float,2>{0.334564596f, 0.473422796f},
-std::array<float,2>{0.880596459f, 0.362974524f},
-std::array<float,2>{0.420885414f, 0.633562088f},
-std::array<float,2>{0.684692502f, 0.901447892f},
-std::array<float,2>{0.0190669969f, 0.150458917f},
-std::array<float,2>{0.960387468f, 0.116940938f},
-std::array<float,2>{0.494957f, 0.872735858f},
-std::array<float,2>{0.734894991f, 0.541817844f},
-std::array<float,2>{0.0852101594f, 0.431838244f},
-std::array<float,2>{0.5410133f, 0.300195515f},
-std::array<float,2>{0.211513996f, 0.699406683f},
-std::array<float,2>{0.855708838f, 0.954757512f},
-std::array<float,2>{0.272565573f, 0.212819323f},
-std::array<float,2>{0.641794622f, 0.164196163f},
-std::array<float,2>{0.036105644f, 0.923762858f},
-std::array<float,2>{0.907502413f, 0.673773766f},
-std::array<float,2>{0.404552549f, 0.326619774f},
-std::array<float,2>{0.754155099f, 0.445362031f},
-std::array<float,2>{0.366111904f, 0.571543097f},
-std::array<float,2>{0.56698966f, 0.772145271f},
-std::array<float,2>{0.186101004f, 0.0435147323f},
-std::array<float,2>{0.847296417f, 0.0704472288f},
-std::array<float,2>{0.278283507f, 0.837855458f},
-std::array<float,2>{0.534357548f, 0.502795577f},
-std::array<float,2>{0.204604894f, 0.397282749f},
-std::array<float,2>{0.74825561f, 0.280202806f},
-std::array<float,2>{0.0860928744f, 0.744439006f},
-std::array<float,2>{0.967206895f, 0.970789552f},
-std::array<float,2>{0.485304564f, 0.234492853f},
-std::array<float,2>{0.574526489f, 0.14326629f},
-std::array<float,2>{0.173097342f, 0.8981933f},
-std::array<float,2>{0.761321485f, 0.626257002f},
-std::array<float,2>{0.374290079f, 0.371860504f},
-std::array<float,2>{0.91447252f, 0.478861243f},
-std::array<float,2>{0.39330256f, 0.600248396f},
-std::array<float,2>{0.650489688f, 0.785440385f},
-std::array<float,2>{0.0430874825f, 0.00585282873f},
-std::array<float,2>{0.989366055f, 0.208008036f},
-std::array<float,2>{0.451553583f, 0.963872433f},
-std::array<float,2>{0.691966057f, 0.69268465f},
-std::array<float,2>{0.111251839f, 0.304905206f},
-std::array<float,2>{0.528976858f, 0.421920121f},
-std::array<float,2>{0.241472036f, 0.533693433f},
-std::array<float,2>{0.828681111f, 0.862836301f},
-std::array<float,2>{0.296790212f, 0.120184526f},
-std::array<float,2>{0.672794461f, 0.0347675756f},
-std::array<float,2>{0.0252038687f, 0.778082371f},
-std::array<float,2>{0.883930802f, 0.566290438f},
-std::array<float,2>{0.406825423f, 0.441711813f},
-std::array<float,2>{0.795227706f, 0.314412773f},
-std::array<float,2>{0.342033416f, 0.686903238f},
-std::array<float,2>{0.594812393f, 0.931042671f},
-std::array<float,2>{0.149337426f, 0.157443374f},
-std::array<float,2>{0.776278019f, 0.187322453f},
-std::array<float,2>{0.352031052f, 0.910750151f},
-std::array<float,2>{0.591337085f, 0.671631873f},
-std::array<float,2>{0.168350637f, 0.339729995f},
-std::array<float,2>{0.625059664f, 0.459174484f},
-std::array<float,2>{0.0474086292f, 0.578210175f},
-std::array<float,2>{0.934703052f, 0.76314199f},
-std::array<float,2>{0.376330584f, 0.0476638265f},
-std::array<float,2>{0.551172197f, 0.104236871f},
-std::array<float,2>{0.196739644f, 0.852680922f},
-std::array<float,2>{0.874518216f, 0.550936282f},
-std::array<float,2>{0.254095703f, 0.420377791f},
-std::array<float,2>{0.952890038f, 0.282053411f},
-std::array<float,2>{0.482769638f, 0.70994103f},
-std::array<float,2>{0.728595257f, 0.949919939f},
-std::array<float,2>{0.0725548863f, 0.20306848f},
-std::array<float,2>{0.891218841f, 0.0158118028f},
-std::array<float,2>{0.424113184f, 0.800574958f},
-std::array<float,2>{0.666636825f, 0.610767543f},
-std::array<float,2>{0.0143835563f, 0.491716653f},
-std::array<float,2>{0.614776909f, 0.356467634f},
-std::array<float,2>{0.128396034f, 0.648349583f},
-std::array<float,2>{0.803649426f, 0.881673872f},
-std::array<float,2>{0.324253887f, 0.132005706f},
-std::array<float,2>{0.717829227f, 0.22514078f},
-std::array<float,2>{0.103035167f, 0.991647959f},
-std::array<float,2>{0.976401985f, 0.721748412f},
-std::array<float,2>{0.460113108f, 0.260225594f},
-std::array<float,2>{0.814894438f, 0.381512672f},
-std::array<float,2>{0.302355856f, 0.516449571f},
-std::array<float,2>{0.510472715f, 0.819268703f},
-std::array<float,2>{0.229312822f, 0.0874584913f},
-std::array<float,2>{0.764567792f, 0.0972125828f},
-std::array<float,2>{0.368115455f, 0.847283185f},
-std::array<float,2>{0.573728025f, 0.562232316f},
-std::array<float,2>{0.176301479f, 0.410845399f},
-std::array<float,2>{0.655133426f, 0.293564618f},
-std::array<float,2>{0.041029904f, 0.711815894f},
-std::array<float,2>{0.920846164f, 0.941219211f},
-std::array<float,2>{0.394713432f, 0.193289444f},
-std::array<float,2>{0.536515594f, 0.175350517f},
-std::array<float,2>{0.210208595f, 0.918550789f},
-std::array<float,2>{0.848450184f, 0.664041281f},
-std::array<float,2>{0.274173707f, 0.329886138f},
-std::array<float,2>{0.964751959f, 0.466198981f},
-std::array<float,2>{0.491836607f, 0.58609432f},
-std::array<float,2>{0.743971288f, 0.751465976f},
-std::array<float,2>{0.0900298879f, 0.0552219748f},
-std::array<float,2>{0.889431417f, 0.231718391f},
-std::array<float,2>{0.41074869f, 0.999666631f},
-std::array<float,2>{0.676524818f, 0.726980865f},
-std::array<float,2>{0.0279649403f, 0.257756919f},
-std::array<float,2>{0.601035535f, 0.383520693f},
-std::array<float,2>{0.152511105f, 0.527618825f},
-std::array<float,2>{0.789740205f, 0.824868441f},
-std::array<float,2>{0.338959098f, 0.0784072801f},
-std::array<float,2>{0.690027654f, 0.0292821936f},
-std::array<float,2>{0.11553321f, 0.805774987f},
-std::array<float,2>{0.984667122f, 0.624311626f},
-std::array<float,2>{0.448264182f, 0.497367144f},
-std::array<float,2>{0.835877895f, 0.349614859f},
-std::array<float,2>{0.292236447f, 0.652887762f},
-std::array<float,2>{0.526355267f, 0.885324121f},
-std::array<float,2>{0.235154763f, 0.136705205f},
-std::array<float,2>{0.868699789f, 0.15384604f},
-std::array<float,2>{0.251356065f, 0.904641032f},
-std::array<float,2>{0.550014019f, 0.638800442f},
-std::array<float,2>{0.202769563f, 0.365021497f},
-std::array<float,2>{0.732056797f, 0.47249949f},
-std::array<float,2>{0.0761354342f, 0.609156013f},
-std::array<float,2>{0.947229028f, 0.791362762f},
-std::array<float,2>{0.477988869f, 0.00952446926f},
-std::array<float,2>{0.588898838f, 0.0683154613f},
-std::array<float,2>{0.167557612f, 0.83100301f},
-std::array<float,2>{0.779491186f, 0.512359798f},
-std::array<float,2>{0.357408315f, 0.405309439f},
-std::array<float,2>{0.931617141f, 0.26742664f},
-std::array<float,2>{0.379662752f, 0.739182949f},
-std::array<float,2>{0.630636692f, 0.98349762f},
-std::array<float,2>{0.0532396063f, 0.242189512f},
-std::array<float,2>{0.970625758f, 0.0404175185f},
-std::array<float,2>{0.453311801f, 0.768542111f},
-std::array<float,2>{0.712882996f, 0.5757882f},
-std::array<float,2>{0.109014466f, 0.451991409f},
-std::array<float,2>{0.512098432f, 0.321956128f},
-std::array<float,2>{0.233007222f, 0.677516162f},
-std::array<float,2>{0.816592693f, 0.92728281f},
-std::array<float,2>{0.300135463f, 0.170669138f},
-std::array<float,2>{0.669855952f, 0.21783413f},
-std::array<float,2>{0.00789790694f, 0.958167434f},
-std::array<float,2>{0.894792438f, 0.696982145f},
-std::array<float,2>{0.429426432f, 0.301162601f},
-std::array<float,2>{0.799677849f, 0.434607387f},
-std::array<float,2>{0.323819697f, 0.545410454f},
-std::array<float,2>{0.609381139f, 0.867925227f},
-std::array<float,2>{0.129702389f, 0.110287413f},
-std::array<float,2>{0.82471925f, 0.000907635898f},
-std::array<float,2>{0.305340946f, 0.782202125f},
-std::array<float,2>{0.506352842f, 0.593855858f},
-std::array<float,2>{0.219636321f, 0.483643472f},
-std::array<float,2>{0.707269907f, 0.367510825f},
-std::array<float,2>{0.101210065f, 0.632329345f},
-std::array<float,2>{0.983950794f, 0.89184314f},
-std::array<float,2>{0.466792405f, 0.145777971f},
-std::array<float,2>{0.622035503f, 0.238546908f},
-std::array<float,2>{0.139244154f, 0.973945022f},
-std::array<float,2>{0.811415672f, 0.749350667f},
-std::array<float,2>{0.319640815f, 0.275800198f},
-std::array<float,2>{0.903640687f, 0.39217177f},
-std::array<float,2>{0.435986727f, 0.505818546f},
-std::array<float,2>{0.659056783f, 0.841203809f},
-std::array<float,2>{0.00038164272f, 0.0766348541f},
-std::array<float,2>{0.945103526f, 0.162894785f},
-std::array<float,2>{0.469569623f, 0.935533464f},
-std::array<float,2>{0.726424694f, 0.682324052f},
-std::array<float,2>{0.0685255006f, 0.319705755f},
-std::array<float,2>{0.555943072f, 0.439615369f},
-std::array<float,2>{0.195006207f, 0.570196092f},
-std::array<float,2>{0.864526808f, 0.774715006f},
-std::array<float,2>{0.263293982f, 0.0358502828f},
-std::array<float,2>{0.634921134f, 0.123506114f},
-std::array<float,2>{0.05516316f, 0.864432216f},
-std::array<float,2>{0.927731991f, 0.535558701f},
-std::array<float,2>{0.384771764f, 0.428172648f},
-std::array<float,2>{0.772908211f, 0.311625689f},
-std::array<float,2>{0.349078f, 0.690509915f},
-std::array<float,2>{0.583901942f, 0.966853678f},
-std::array<float,2>{0.158376366f, 0.205488682f},
-std::array<float,2>{0.787460804f, 0.19631356f},
-std::array<float,2>{0.329234093f, 0.947356224f},
-std::array<float,2>{0.606327057f, 0.703300714f},
-std::array<float,2>{0.145292401f, 0.286370248f},
-std::array<float,2>{0.679824471f, 0.417559892f},
-std::array<float,2>{0.0223451722f, 0.550381124f},
-std::array<float,2>{0.876191735f, 0.856557488f},
-std::array<float,2>{0.414367318f, 0.10912995f},
-std::array<float,2>{0.519271374f, 0.0525922775f},
-std::array<float,2>{0.24761124f, 0.761297047f},
-std::array<float,2>{0.836918473f, 0.583130181f},
-std::array<float,2>{0.281903297f, 0.455975085f},
-std::array<float,2>{0.992945969f, 0.341443956f},
-std::array<float,2>{0.444313794f, 0.667393923f},
-std::array<float,2>{0.696586192f, 0.906587183f},
-std::array<float,2>{0.123719908f, 0.182662413f},
-std::array<float,2>{0.910965562f, 0.0931900144f},
-std::array<float,2>{0.400940746f, 0.813188136f},
-std::array<float,2>{0.644816935f, 0.522117853f},
-std::array<float,2>{0.0332338437f, 0.378527492f},
-std::array<float,2>{0.563019812f, 0.263822436f},
-std::array<float,2>{0.183095708f, 0.723825991f},
-std::array<float,2>{0.75008589f, 0.985849619f},
-std::array<float,2>{0.362591505f, 0.218958586f},
-std::array<float,2>{0.741747499f, 0.125982732f},
-std::array<float,2>{0.0803250074f, 0.876047194f},
-std::array<float,2>{0.953339934f, 0.643072784f},
-std::array<float,2>{0.497836471f, 0.35420531f},
-std::array<float,2>{0.851762712f, 0.486570835f},
-std::array<float,2>{0.269279897f, 0.614133358f},
-std::array<float,2>{0.545154035f, 0.80117327f},
-std::array<float,2>{0.215432301f, 0.0197816137f},
-std::array<float,2>{0.803192794f, 0.0186052881f},
-std::array<float,2>{0.325147718f, 0.798353434f},
-std::array<float,2>{0.614555001f, 0.613063157f},
-std::array<float,2>{0.128717586f, 0.488334805f},
-std::array<float,2>{0.666267931f, 0.357791901f},
-std::array<float,2>{0.0136968317f, 0.645708025f},
-std::array<float,2>{0.890682876f, 0.880007446f},
-std::array<float,2>{0.424592733f, 0.129552379f},
-std::array<float,2>{0.51014775f, 0.22360459f},
-std::array<float,2>{0.22862187f, 0.989558816f},
-std::array<float,2>{0.815105677f, 0.719999671f},
-std::array<float,2>{0.302081436f, 0.258474231f},
-std::array<float,2>{0.975726843f, 0.38016513f},
-std::array<float,2>{0.46088931f, 0.519015491f},
-std::array<float,2>{0.718545854f, 0.817392826f},
-std::array<float,2>{0.10257218f, 0.0886066779f},
-std::array<float,2>{0.935217321f, 0.185295582f},
-std::array<float,2>{0.376483381f, 0.913497806f},
-std::array<float,2>{0.625745952f, 0.668640018f},
-std::array<float,2>{0.0472016297f, 0.337804526f},
-std::array<float,2>{0.590995908f, 0.457720667f},
-std::array<float,2>{0.168763041f, 0.58188957f},
-std::array<float,2>{0.775431335f, 0.765226662f},
-std::array<float,2>{0.352505028f, 0.0507766157f},
-std::array<float,2>{0.729398847f, 0.102077648f},
-std::array<float,2>{0.0729480758f, 0.854555428f},
-std::array<float,2>{0.952533007f, 0.553828001f},
-std::array<float,2>{0.483328998f, 0.418346643f},
-std::array<float,2>{0.874210536f, 0.283693105f},
-std::array<float,2>{0.25482294f, 0.708449841f},
-std::array<float,2>{0.551408947f, 0.951827466f},
-std::array<float,2>{0.196890429f, 0.201043457f},
-std::array<float,2>{0.828238666f, 0.209028095f},
-std::array<float,2>{0.296033323f, 0.962443352f},
-std::array<float,2>{0.528805077f, 0.694247782f},
-std::array<float,2>{0.242011786f, 0.308368623f},
-std::array<float,2>{0.691464365f, 0.424491942f},
-std::array<float,2>{0.110749416f, 0.53303653f},
-std::array<float,2>{0.99004221f, 0.85961771f},
-std::array<float,2>{0.452137232f, 0.11846564f},
-std::array<float,2>{0.595448077f, 0.0331353582f},
-std::array<float,2>{0.148841873f, 0.780319929f},
-std::array<float,2>{0.795642257f, 0.563238621f},
-std::array<float,2>{0.342483461f, 0.444095105f},
-std::array<float,2>{0.884343266f, 0.314984471f},
-std::array<float,2>{0.406634688f, 0.684191346f},
-std::array<float,2>{0.672285318f, 0.932666957f},
-std::array<float,2>{0.0247218888f, 0.159943521f},
-std::array<float,2>{0.967687249f, 0.0736287981f},
-std::array<float,2>{0.484383196f, 0.837935805f},
-std::array<float,2>{0.74859941f, 0.501392245f},
-std::array<float,2>{0.0867773071f, 0.395041972f},
-std::array<float,2>{0.534935772f, 0.278407991f},
-std::array<float,2>{0.20447576f, 0.743995786f},
-std::array<float,2>{0.846994162f, 0.969998121f},
-std::array<float,2>{0.277378082f, 0.236506835f},
-std::array<float,2>{0.650905967f, 0.142132774f},
-std::array<float,2>{0.0439046286f, 0.895397961f},
-std::array<float,2>{0.914866209f, 0.627156198f},
-std::array<float,2>{0.392710149f, 0.374383956f},
-std::array<float,2>{0.761208177f, 0.47837311f},
-std::array<float,2>{0.374628037f, 0.598603785f},
-std::array<float,2>{0.57502228f, 0.78886193f},
-std::array<float,2>{0.173498541f, 0.00619740458f},
-std::array<float,2>{0.856273711f, 0.113798976f},
-std::array<float,2>{0.273084939f, 0.873581767f},
-std::array<float,2>{0.540118992f, 0.539551318f},
-std::array<float,2>{0.210962445f, 0.430718899f},
-std::array<float,2>{0.734531522f, 0.297369123f},
-std::array<float,2>{0.0858816653f, 0.701798499f},
-std::array<float,2>{0.960562468f, 0.95624572f},
-std::array<float,2>{0.494141698f, 0.21396777f},
-std::array<float,2>{0.566601336f, 0.16671969f},
-std::array<float,2>{0.185734823f, 0.924358249f},
-std::array<float,2>{0.754514217f, 0.674771488f},
-std::array<float,2>{0.365399748f, 0.324304581f},
-std::array<float,2>{0.907948077f, 0.448413134f},
-std::array<float,2>{0.405088693f, 0.572540343f},
-std::array<float,2>{0.642333746f, 0.770258605f},
-std::array<float,2>{0.0353208631f, 0.0468010083f},
-std::array<float,2>{0.999292433f, 0.247046486f},
-std::array<float,2>{0.440539598f, 0.978080869f},
-std::array<float,2>{0.701249957f, 0.735408664f},
-std::array<float,2>{0.118065417f, 0.270072818f},
-std::array<float,2>{0.521668971f, 0.40010798f},
-std::array<float,2>{0.244964987f, 0.510824323f},
-std::array<float,2>{0.840928972f, 0.83369571f},
-std::array<float,2>{0.288412362f, 0.0650214106f},
-std::array<float,2>{0.685075879f, 0.0150269745f},
-std::array<float,2>{0.0187120717f, 0.794782758f},
-std::array<float,2>{0.880121589f, 0.602900326f},
-std::array<float,2>{0.420316845f, 0.474982619f},
-std::array<float,2>{0.784226716f, 0.360763788f},
-std::array<float,2>{0.334410489f, 0.636107326f},
-std::array<float,2>{0.604720712f, 0.900147676f},
-std::array<float,2>{0.141973749f, 0.14978613f},
-std::array<float,2>{0.76598233f, 0.136878148f},
-std::array<float,2>{0.347297549f, 0.888300598f},
-std::array<float,2>{0.578769565f, 0.650025845f},
-std::array<float,2>{0.161808267f, 0.346916229f},
-std::array<float,2>{0.640524089f, 0.493727565f},
-std::array<float,2>{0.0624240115f, 0.620098829f},
-std::array<float,2>{0.924932241f, 0.810103774f},
-std::array<float,2>{0.388785005f, 0.0234409682f},
-std::array<float,2>{0.562444031f, 0.0836575404f},
-std::array<float,2>{0.187739387f, 0.823570549f},
-std::array<float,2>{0.863171875f, 0.526826441f},
-std::array<float,2>{0.261323124f, 0.387565434f},
-std::array<float,2>{0.940003037f, 0.252530336f},
-std::array<float,2>{0.476209909f, 0.73425889f},
-std::array<float,2>{0.721946716f, 0.995948374f},
-std::array<float,2>{0.0654433668f, 0.230204329f},
-std::array<float,2>{0.901272237f, 0.0613917448f},
-std::array<float,2>{0.432026505f, 0.75601995f},
-std::array<float,2>{0.663280368f, 0.592656434f},
-std::array<float,2>{0.00548982201f, 0.464448392f},
-std::array<float,2>{0.617461622f, 0.33275035f},
-std::array<float,2>{0.132936895f, 0.659226418f},
-std::array<float,2>{0.805674016f, 0.914345384f},
-std::array<float,2>{0.314501882f, 0.178074747f},
-std::array<float,2>{0.705266893f, 0.189505115f},
-std::array<float,2>{0.0955524892f, 0.943807542f},
-std::array<float,2>{0.978009939f, 0.716569483f},
-std::array<float,2>{0.462348163f, 0.290683448f},
-std::array<float,2>{0.824060678f, 0.408374548f},
-std::array<float,2>{0.312170058f, 0.554799616f},
-std::array<float,2>{0.503169477f, 0.850362837f},
-std::array<float,2>{0.222804144f, 0.0995885655f},
-std::array<float,2>{0.750715077f, 0.0899976566f},
-std::array<float,2>{0.363203198f, 0.816182494f},
-std::array<float,2>{0.562606633f, 0.519780993f},
-std::array<float,2>{0.183140963f, 0.375993222f},
-std::array<float,2>{0.645392954f, 0.263334185f},
-std::array<float,2>{0.0337863378f, 0.725163996f},
-std::array<float,2>{0.910194933f, 0.988157451f},
-std::array<float,2>{0.400809407f, 0.222013906f},
-std::array<float,2>{0.545650363f, 0.128702968f},
-std::array<float,2>{0.215075865f, 0.878433824f},
-std::array<float,2>{0.852526128f, 0.641551495f},
-std::array<float,2>{0.269004673f, 0.353301436f},
-std::array<float,2>{0.953949988f, 0.484601736f},
-std::array<float,2>{0.497185558f, 0.616987407f},
-std::array<float,2>{0.741343319f, 0.804664671f},
-std::array<float,2>{0.0810170099f, 0.022152124f},
-std::array<float,2>{0.876917064f, 0.198051929f},
-std::array<float,2>{0.414967269f, 0.947029591f},
-std::array<float,2>{0.680188537f, 0.70684737f},
-std::array<float,2>{0.021613501f, 0.288043112f},
-std::array<float,2>{0.605775535f, 0.415313154f},
-std::array<float,2>{0.144786775f, 0.547310472f},
-std::array<float,2>{0.78790164f, 0.857556999f},
-std::array<float,2>{0.330064565f, 0.106155686f},
-std::array<float,2>{0.696991503f, 0.0538765639f},
-std::array<float,2>{0.123152539f, 0.758155465f},
-std::array<float,2>{0.992422819f, 0.585367799f},
-std::array<float,2>{0.44341144f, 0.454901993f},
-std::array<float,2>{0.837520361f, 0.342146456f},
-std::array<float,2>{0.281318575f, 0.664106131f},
-std::array<float,2>{0.51864177f, 0.909234822f},
-std::array<float,2>{0.247072458f, 0.180096731f},
-std::array<float,2>{0.865208924f, 0.16195485f},
-std::array<float,2>{0.263127625f, 0.936424434f},
-std::array<float,2>{0.556396067f, 0.680818498f},
-std::array<float,2>{0.194363326f, 0.316903174f},
-std::array<float,2>{0.725677073f, 0.43908751f},
-std::array<float,2>{0.0690365732f, 0.567410946f},
-std::array<float,2>{0.944665253f, 0.775873005f},
-std::array<float,2>{0.468867689f, 0.0378187746f},
-std::array<float,2>{0.583120942f, 0.122367926f},
-std::array<float,2>{0.159140766f, 0.866255641f},
-std::array<float,2>{0.772986472f, 0.538004696f},
-std::array<float,2>{0.349245787f, 0.425787836f},
-std::array<float,2>{0.926886618f, 0.309488624f},
-std::array<float,2>{0.385442466f, 0.688468397f},
-std::array<float,2>{0.63561511f, 0.965641618f},
-std::array<float,2>{0.0554646999f, 0.204406261f},
-std::array<float,2>{0.983879745f, 0.00214786525f},
-std::array<float,2>{0.466148466f, 0.784924269f},
-std::array<float,2>{0.707713187f, 0.597288132f},
-std::array<float,2>{0.100960195f, 0.481466055f},
-std::array<float,2>{0.50609535f, 0.370317906f},
-std::array<float,2>{0.218908608f, 0.629564106f},
-std::array<float,2>{0.824461162f, 0.893649399f},
-std::array<float,2>{0.305030763f, 0.146647871f},
-std::array<float,2>{0.658625722f, 0.241484329f},
-std::array<float,2>{0.000942926854f, 0.974882245f},
-std::array<float,2>{0.903872669f, 0.747428358f},
-std::array<float,2>{0.436419696f, 0.274087846f},
-std::array<float,2>{0.810924172f, 0.394112498f},
-std::array<float,2>{0.319831848f, 0.507472754f},
-std::array<float,2>{0.621285558f, 0.842934847f},
-std::array<float,2>{0.138795272f, 0.0749881715f},
-std::array<float,2>{0.816904664f, 0.0422277972f},
-std::array<float,2>{0.300726205f, 0.766144335f},
-std::array<float,2>{0.512258172f, 0.576954484f},
-std::array<float,2>{0.232827038f, 0.449664235f},
-std::array<float,2>{0.712364912f, 0.322359502f},
-std::array<float,2>{0.1085632f, 0.679407775f},
-std::array<float,2>{0.970078707f, 0.929617524f},
-std::array<float,2>{0.453834742f, 0.169781625f},
-std::array<float,2>{0.609894216f, 0.215411007f},
-std::array<float,2>{0.12924628f, 0.95993644f},
-std::array<float,2>{0.799083769f, 0.698927164f},
-std::array<float,2>{0.323701978f, 0.303186655f},
-std::array<float,2>{0.89531666f, 0.437196225f},
-std::array<float,2>{0.428926647f, 0.544504166f},
-std::array<float,2>{0.668985605f, 0.869369209f},
-std::array<float,2>{0.00860629044f, 0.112863533f},
-std::array<float,2>{0.946597934f, 0.154555321f},
-std::array<float,2>{0.478045225f, 0.904045522f},
-std::array<float,2>{0.731548488f, 0.637203038f},
-std::array<float,2>{0.0754466951f, 0.366185695f},
-std::array<float,2>{0.550425291f, 0.469718099f},
-std::array<float,2>{0.202220067f, 0.607133031f},
-std::array<float,2>{0.868282437f, 0.789855063f},
-std::array<float,2>{0.251854122f, 0.0105643505f},
-std::array<float,2>{0.630231917f, 0.0688790977f},
-std::array<float,2>{0.0527491234f, 0.828489423f},
-std::array<float,2>{0.93095237f, 0.515166223f},
-std::array<float,2>{0.379160315f, 0.403602034f},
-std::array<float,2>{0.780087888f, 0.268380731f},
-std::array<float,2>{0.356891423f, 0.742134511f},
-std::array<float,2>{0.589669943f, 0.981223166f},
-std::array<float,2>{0.167475447f, 0.245031536f},
-std::array<float,2>{0.789486229f, 0.233752862f},
-std::array<float,2>{0.339804918f, 0.996893942f},
-std::array<float,2>{0.601540387f, 0.729205012f},
-std::array<float,2>{0.153107136f, 0.255344391f},
-std::array<float,2>{0.67609942f, 0.385579199f},
-std::array<float,2>{0.0276959464f, 0.529663444f},
-std::array<float,2>{0.888679504f, 0.827005565f},
-std::array<float,2>{0.410570741f, 0.0809977576f},
-std::array<float,2>{0.52564162f, 0.0305302013f},
-std::array<float,2>{0.234662995f, 0.806800425f},
-std::array<float,2>{0.835160494f, 0.621542037f},
-std::array<float,2>{0.292628646f, 0.499913692f},
-std::array<float,2>{0.985233486f, 0.348623574f},
-std::array<float,2>{0.448947906f, 0.654871583f},
-std::array<float,2>{0.689606965f, 0.883023202f},
-std::array<float,2>{0.115897439f, 0.13320452f},
-std::array<float,2>{0.920205474f, 0.0941175818f},
-std::array<float,2>{0.39502725f, 0.843878031f},
-std::array<float,2>{0.654759049f, 0.559264958f},
-std::array<float,2>{0.0415173881f, 0.413544416f},
-std::array<float,2>{0.573804498f, 0.295451939f},
-std::array<float,2>{0.176223218f, 0.714243412f},
-std::array<float,2>{0.763952911f, 0.939197063f},
-std::array<float,2>{0.367434829f, 0.194204405f},
-std::array<float,2>{0.743267477f, 0.172324374f},
-std::array<float,2>{0.0905823782f, 0.920599282f},
-std::array<float,2>{0.964210987f, 0.661536038f},
-std::array<float,2>{0.491300315f, 0.331799477f},
-std::array<float,2>{0.848127484f, 0.467337221f},
-std::array<float,2>{0.273894876f, 0.589019299f},
-std::array<float,2>{0.536684632f, 0.752765477f},
-std::array<float,2>{0.210558206f, 0.0572308637f},
-std::array<float,2>{0.773480892f, 0.0472890288f},
-std::array<float,2>{0.353960097f, 0.7634359f},
-std::array<float,2>{0.592671335f, 0.578760266f},
-std::array<float,2>{0.171320319f, 0.459889263f},
-std::array<float,2>{0.628897488f, 0.339159518f},
-std::array<float,2>{0.0493745692f, 0.671229422f},
-std::array<float,2>{0.93659234f, 0.91056031f},
-std::array<float,2>{0.377197564f, 0.186804324f},
-std::array<float,2>{0.553332865f, 0.202414542f},
-std::array<float,2>{0.197975412f, 0.949340641f},
-std::array<float,2>{0.871738017f, 0.70901078f},
-std::array<float,2>{0.25669378f, 0.281643599f},
-std::array<float,2>{0.951079249f, 0.420791835f},
-std::array<float,2>{0.481141925f, 0.551730573f},
-std::array<float,2>{0.72846055f, 0.853300333f},
-std::array<float,2>{0.0716623068f, 0.103519216f},
-std::array<float,2>{0.893701553f, 0.132721812f},
-std::array<float,2>{0.422136754f, 0.881032109f},
-std::array<float,2>{0.665274501f, 0.647647679f},
-std::array<float,2>{0.0132824322f, 0.357265055f},
-std::array<float,2>{0.615951598f, 0.491236091f},
-std::array<float,2>{0.125871316f, 0.610930443f},
-std::array<float,2>{0.802319348f, 0.800081789f},
-std::array<float,2>{0.327347696f, 0.0164984372f},
-std::array<float,2>{0.716714561f, 0.0870874897f},
-std::array<float,2>{0.103955626f, 0.818468213f},
-std::array<float,2>{0.973722279f, 0.515776455f},
-std::array<float,2>{0.45802325f, 0.380973071f},
-std::array<float,2>{0.813417554f, 0.260444283f},
-std::array<float,2>{0.302970409f, 0.72218293f},
-std::array<float,2>{0.509572089f, 0.991720319f},
-std::array<float,2>{0.22848095f, 0.224960744f},
-std::array<float,2>{0.844345152f, 0.235051155f},
-std::array<float,2>{0.280914038f, 0.971643507f},
-std::array<float,2>{0.531984925f, 0.744813025f},
-std::array<float,2>{0.206694573f, 0.279767215f},
-std::array<float,2>{0.74679184f, 0.396661818f},
-std::array<float,2>{0.0894356072f, 0.502148688f},
-std::array<float,2>{0.965317428f, 0.837157726f},
-std::array<float,2>{0.488145947f, 0.0710319057f},
-std::array<float,2>{0.57736057f, 0.00519702863f},
-std::array<float,2>{0.174570441f, 0.785944581f},
-std::array<float,2>{0.757858515f, 0.600037038f},
-std::array<float,2>{0.372666568f, 0.47913757f},
-std::array<float,2>{0.916233361f, 0.371228874f},
-std::array<float,2>{0.390641779f, 0.626612604f},
-std::array<float,2>{0.649204552f, 0.897543073f},
-std::array<float,2>{0.0457140207f, 0.142628908f},
-std::array<float,2>{0.990800261f, 0.12062186f},
-std::array<float,2>{0.450058371f, 0.862336576f},
-std::array<float,2>{0.69393158f, 0.533313036f},
-std::array<float,2>{0.1128176f, 0.422425687f},
-std::array<float,2>{0.530339003f, 0.305348933f},
-std::array<float,2>{0.238639235f, 0.693083167f},
-std::array<float,2>{0.830446482f, 0.964546621f},
-std::array<float,2>{0.293810338f, 0.208657503f},
-std::array<float,2>{0.674484074f, 0.157901317f},
-std::array<float,2>{0.0266574807f, 0.931470692f},
-std::array<float,2>{0.886465788f, 0.687459946f},
-std::array<float,2>{0.408957422f, 0.313680708f},
-std::array<float,2>{0.794842958f, 0.442016423f},
-std::array<float,2>{0.341728985f, 0.565461218f},
-std::array<float,2>{0.596386433f, 0.777360082f},
-std::array<float,2>{0.150621593f, 0.0343183689f},
-std::array<float,2>{0.84351927f, 0.0627787933f},
-std::array<float,2>{0.285892099f, 0.835167229f},
-std::array<float,2>{0.5206756f, 0.509484172f},
-std::array<float,2>{0.243002698f, 0.401272774f},
-std::array<float,2>{0.701167881f, 0.271714658f},
-std::array<float,2>{0.12090423f, 0.737290144f},
-std::array<float,2>{0.996661246f, 0.978807926f},
-std::array<float,2>{0.439295828f, 0.24935104f},
-std::array<float,2>{0.602142751f, 0.151213244f},
-std::array<float,2>{0.142908916f, 0.902073205f},
-std::array<float,2>{0.78151983f, 0.632969975f},
-std::array<float,2>{0.333562315f, 0.362410009f},
-std::array<float,2>{0.882580638f, 0.47296235f},
-std::array<float,2>{0.41953063f, 0.603710651f},
-std::array<float,2>{0.686163783f, 0.795726657f},
-std::array<float,2>{0.0166897979f, 0.0130344378f},
-std::array<float,2>{0.958247066f, 0.212372884f},
-std::array<float,2>{0.493934333f, 0.954202056f},
-std::array<float,2>{0.737705946f, 0.699785411f},
-std::array<float,2>{0.0838568658f, 0.300534487f},
-std::array<float,2>{0.541514277f, 0.432141304f},
-std::array<float,2>{0.214757055f, 0.541247189f},
-std::array<float,2>{0.858800352f, 0.872148454f},
-std::array<float,2>{0.27047196f, 0.116443887f},
-std::array<float,2>{0.644420087f, 0.043032784f},
-std::array<float,2>{0.0384409651f, 0.771583974f},
-std::array<float,2>{0.908617139f, 0.571941674f},
-std::array<float,2>{0.403560013f, 0.445889294f},
-std::array<float,2>{0.75590986f, 0.326781392f},
-std::array<float,2>{0.36519593f, 0.673222959f},
-std::array<float,2>{0.568850338f, 0.922932744f},
-std::array<float,2>{0.184253931f, 0.164770231f},
-std::array<float,2>{0.807569504f, 0.177365854f},
-std::array<float,2>{0.313954979f, 0.916528344f},
-std::array<float,2>{0.620697558f, 0.657057226f},
-std::array<float,2>{0.135642514f, 0.335689545f},
-std::array<float,2>{0.660685122f, 0.4625462f},
-std::array<float,2>{0.00712149916f, 0.591047287f},
-std::array<float,2>{0.899165094f, 0.75522089f},
-std::array<float,2>{0.431524187f, 0.0601524785f},
-std::array<float,2>{0.500255406f, 0.100844406f},
-std::array<float,2>{0.224660739f, 0.848227918f},
-std::array<float,2>{0.822164059f, 0.558464289f},
-std::array<float,2>{0.308964461f, 0.407083541f},
-std::array<float,2>{0.980145931f, 0.292784631f},
-std::array<float,2>{0.463588148f, 0.718110859f},
-std::array<float,2>{0.703436255f, 0.941439271f},
-std::array<float,2>{0.0969878882f, 0.188877016f},
-std::array<float,2>{0.923107684f, 0.0267631635f},
-std::array<float,2>{0.386873841f, 0.811501741f},
-std::array<float,2>{0.636859953f, 0.618802369f},
-std::array<float,2>{0.0592835918f, 0.495609701f},
-std::array<float,2>{0.581902385f, 0.344123483f},
-std::array<float,2>{0.163747117f, 0.651380718f},
-std::array<float,2>{0.767781079f, 0.889897108f},
-std::array<float,2>{0.343806356f, 0.140329704f},
-std::array<float,2>{0.719356358f, 0.228426546f},
-std::array<float,2>{0.0643233955f, 0.992751718f},
-std::array<float,2>{0.939260364f, 0.731451571f},
-std::array<float,2>{0.473305345f, 0.25020799f},
-std::array<float,2>{0.859681726f, 0.389629424f},
-std::array<float,2>{0.258532405f, 0.524794161f},
-std::array<float,2>{0.560394228f, 0.82084775f},
-std::array<float,2>{0.189766377f, 0.0848018974f},
-std::array<float,2>{0.787039697f, 0.108816974f},
-std::array<float,2>{0.331607431f, 0.856978238f},
-std::array<float,2>{0.607551575f, 0.550073087f},
-std::array<float,2>{0.148259804f, 0.41714716f},
-std::array<float,2>{0.682015479f, 0.286699474f},
-std::array<float,2>{0.0208956916f, 0.703766167f},
-std::array<float,2>{0.877049923f, 0.947766781f},
-std::array<float,2>{0.416321129f, 0.196913227f},
-std::array<float,2>{0.515910327f, 0.183270112f},
-std::array<float,2>{0.248508111f, 0.906910062f},
-std::array<float,2>{0.838989735f, 0.667726278f},
-std::array<float,2>{0.28441596f, 0.341089159f},
-std::array<float,2>{0.99604553f, 0.455118686f},
-std::array<float,2>{0.441777468f, 0.583551764f},
-std::array<float,2>{0.697831631f, 0.760744274f},
-std::array<float,2>{0.121350087f, 0.0519855469f},
-std::array<float,2>{0.914002299f, 0.219558492f},
-std::array<float,2>{0.399729788f, 0.985377192f},
-std::array<float,2>{0.648035824f, 0.72424382f},
-std::array<float,2>{0.0312914923f, 0.264503747f},
-std::array<float,2>{0.565011859f, 0.377994776f},
-std::array<float,2>{0.17987968f, 0.521709502f},
-std::array<float,2>{0.752728105f, 0.812796593f},
-std::array<float,2>{0.359696746f, 0.0936025083f},
-std::array<float,2>{0.739588976f, 0.0203072485f},
-std::array<float,2>{0.0799038634f, 0.801693976f},
-std::array<float,2>{0.95691973f, 0.613347411f},
-std::array<float,2>{0.499162883f, 0.486867011f},
-std::array<float,2>{0.854928136f, 0.353780299f},
-std::array<float,2>{0.267414123f, 0.642644882f},
-std::array<float,2>{0.544618964f, 0.876946747f},
-std::array<float,2>{0.217654079f, 0.126592919f},
-std::array<float,2>{0.826738775f, 0.146041244f},
-std::array<float,2>{0.307876736f, 0.892544627f},
-std::array<float,2>{0.504236042f, 0.632216871f},
-std::array<float,2>{0.221822664f, 0.367706627f},
-std::array<float,2>{0.710848093f, 0.484308183f},
-std::array<float,2>{0.0990683064f, 0.594444036f},
-std::array<float,2>{0.98069638f, 0.781445861f},
-std::array<float,2>{0.467906415f, 0.000375391654f},
-std::array<float,2>{0.623292565f, 0.0767212957f},
-std::array<float,2>{0.13672176f, 0.841316521f},
-std::array<float,2>{0.809134781f, 0.505233169f},
-std::array<float,2>{0.317526013f, 0.391637683f},
-std::array<float,2>{0.904597938f, 0.276151568f},
-std::array<float,2>{0.435524106f, 0.749585986f},
-std::array<float,2>{0.657515347f, 0.974464417f},
-std::array<float,2>{0.00290424982f, 0.238875568f},
-std::array<float,2>{0.94315511f, 0.035165485f},
-std::array<float,2>{0.472319573f, 0.775319278f},
-std::array<float,2>{0.723418772f, 0.569563031f},
-std::array<float,2>{0.0679403692f, 0.440320671f},
-std::array<float,2>{0.556973398f, 0.320306182f},
-std::array<float,2>{0.192865565f, 0.681868792f},
-std::array<float,2>{0.866473258f, 0.93489331f},
-std::array<float,2>{0.26423192f, 0.162175268f},
-std::array<float,2>{0.632909477f, 0.205582485f},
-std::array<float,2>{0.0576414652f, 0.967668414f},
-std::array<float,2>{0.929084122f, 0.691060722f},
-std::array<float,2>{0.384605974f, 0.312318146f},
-std::array<float,2>{0.770855188f, 0.428631902f},
-std::array<float,2>{0.349907488f, 0.535729587f},
-std::array<float,2>{0.584379673f, 0.864767849f},
-std::array<float,2>{0.156805903f, 0.123754725f},
-std::array<float,2>{0.870307326f, 0.00885704998f},
-std::array<float,2>{0.252928495f, 0.791739762f},
-std::array<float,2>{0.548229873f, 0.60842216f},
-std::array<float,2>{0.200672209f, 0.471802145f},
-std::array<float,2>{0.733484983f, 0.364446521f},
-std::array<float,2>{0.0771882161f, 0.639170647f},
-std::array<float,2>{0.948582649f, 0.90512085f},
-std::array<float,2>{0.47939235f, 0.153566495f},
-std::array<float,2>{0.586555183f, 0.243080825f},
-std::array<float,2>{0.165993631f, 0.983916521f},
-std::array<float,2>{0.779215395f, 0.73871547f},
-std::array<float,2>{0.357470453f, 0.267052293f},
-std::array<float,2>{0.933579445f, 0.405919135f},
-std::array<float,2>{0.381322443f, 0.511959374f},
-std::array<float,2>{0.632745385f, 0.830337703f},
-std::array<float,2>{0.0518256873f, 0.0677618161f},
-std::array<float,2>{0.971548617f, 0.170039862f},
-std::array<float,2>{0.456923872f, 0.927016318f},
-std::array<float,2>{0.714809239f, 0.676833689f},
-std::array<float,2>{0.105950005f, 0.321678549f},
-std::array<float,2>{0.515512705f, 0.451384634f},
-std::array<float,2>{0.231788471f, 0.575444043f},
-std::array<float,2>{0.819552422f, 0.767678142f},
-std::array<float,2>{0.298813224f, 0.0409845933f},
-std::array<float,2>{0.670306742f, 0.109420814f},
-std::array<float,2>{0.0104904929f, 0.86730665f},
-std::array<float,2>{0.897240162f, 0.54534936f},
-std::array<float,2>{0.42749548f, 0.435224265f},
-std::array<float,2>{0.79807812f, 0.301631808f},
-std::array<float,2>{0.322209358f, 0.696302056f},
-std::array<float,2>{0.611854732f, 0.958605886f},
-std::array<float,2>{0.131735295f, 0.218388051f},
-std::array<float,2>{0.763273478f, 0.192687809f},
-std::array<float,2>{0.370916277f, 0.940880954f},
-std::array<float,2>{0.571447432f, 0.711341321f},
-std::array<float,2>{0.177739933f, 0.293104589f},
-std::array<float,2>{0.653590441f, 0.410618156f},
-std::array<float,2>{0.0400680937f, 0.561593473f},
-std::array<float,2>{0.91971308f, 0.846961617f},
-std::array<float,2>{0.397521377f, 0.0970230028f},
-std::array<float,2>{0.53775841f, 0.0550645143f},
-std::array<float,2>{0.208495393f, 0.750988543f},
-std::array<float,2>{0.850623071f, 0.586743832f},
-std::array<float,2>{0.276142985f, 0.466483891f},
-std::array<float,2>{0.961314797f, 0.329517245f},
-std::array<float,2>{0.488730907f, 0.663088858f},
-std::array<float,2>{0.744321406f, 0.91832304f},
-std::array<float,2>{0.0920060277f, 0.175036728f},
-std::array<float,2>{0.887339294f, 0.0788230821f},
-std::array<float,2>{0.41277191f, 0.824632704f},
-std::array<float,2>{0.67796272f, 0.528224707f},
-std::array<float,2>{0.0301683545f, 0.383051872f},
-std::array<float,2>{0.599578261f, 0.257266223f},
-std::array<float,2>{0.155680597f, 0.72748822f},
-std::array<float,2>{0.79165256f, 0.999224186f},
-std::array<float,2>{0.337842524f, 0.232183263f},
-std::array<float,2>{0.688833356f, 0.136002466f},
-std::array<float,2>{0.115210176f, 0.885153353f},
-std::array<float,2>{0.98791796f, 0.652362406f},
-std::array<float,2>{0.445711166f, 0.350306809f},
-std::array<float,2>{0.832949758f, 0.497582704f},
-std::array<float,2>{0.289456338f, 0.62459296f},
-std::array<float,2>{0.524546146f, 0.806208909f},
-std::array<float,2>{0.237725273f, 0.0286766514f},
-std::array<float,2>{0.758790433f, 0.00691051362f},
-std::array<float,2>{0.371285617f, 0.787199497f},
-std::array<float,2>{0.576984525f, 0.599215209f},
-std::array<float,2>{0.17536509f, 0.476580322f},
-std::array<float,2>{0.650320113f, 0.37328729f},
-std::array<float,2>{0.0463993214f, 0.628701568f},
-std::array<float,2>{0.917353213f, 0.896416485f},
-std::array<float,2>{0.392153412f, 0.141068816f},
-std::array<float,2>{0.532729208f, 0.237523556f},
-std::array<float,2>{0.205987886f, 0.969669163f},
-std::array<float,2>{0.845532835f, 0.742933631f},
-std::array<float,2>{0.279671669f, 0.277772099f},
-std::array<float,2>{0.96593982f, 0.396406651f},
-std::array<float,2>{0.486609101f, 0.500330091f},
-std::array<float,2>{0.747634947f, 0.839514494f},
-std::array<float,2>{0.0886105075f, 0.0724709034f},
-std::array<float,2>{0.884843946f, 0.158979118f},
-std::array<float,2>{0.410080642f, 0.932588339f},
-std::array<float,2>{0.674876034f, 0.68540293f},
-std::array<float,2>{0.0256556571f, 0.31574139f},
-std::array<float,2>{0.597544551f, 0.444683075f},
-std::array<float,2>{0.151628673f, 0.563489079f},
-std::array<float,2>{0.793353856f, 0.779721022f},
-std::array<float,2>{0.33999449f, 0.0321679972f},
-std::array<float,2>{0.694832504f, 0.11736802f},
-std::array<float,2>{0.111761965f, 0.860649109f},
-std::array<float,2>{0.991878808f, 0.5313434f},
-std::array<float,2>{0.450828344f, 0.42559129f},
-std::array<float,2>{0.831466138f, 0.306916296f},
-std::array<float,2>{0.294386744f, 0.694691062f},
-std::array<float,2>{0.529712915f, 0.961629689f},
-std::array<float,2>{0.239938721f, 0.210170284f},
-std::array<float,2>{0.872441232f, 0.199236423f},
-std::array<float,2>{0.257403761f, 0.952671945f},
-std::array<float,2>{0.553967714f, 0.707112968f},
-std::array<float,2>{0.198963106f, 0.285085052f},
-std::array<float,2>{0.726760745f, 0.419414401f},
-std::array<float,2>{0.070881322f, 0.552876294f},
-std::array<float,2>{0.949864089f, 0.854323447f},
-std::array<float,2>{0.482176989f, 0.102548957f},
-std::array<float,2>{0.59345752f, 0.0492110737f},
-std::array<float,2>{0.17040506f, 0.764403224f},
-std::array<float,2>{0.774956107f, 0.580572665f},
-std::array<float,2>{0.354985595f, 0.458620965f},
-std::array<float,2>{0.935963929f, 0.336683005f},
-std::array<float,2>{0.378201187f, 0.669710755f},
-std::array<float,2>{0.627791107f, 0.912474751f},
-std::array<float,2>{0.050169006f, 0.184051171f},
-std::array<float,2>{0.973604262f, 0.0893547833f},
-std::array<float,2>{0.457365721f, 0.816827059f},
-std::array<float,2>{0.715079665f, 0.517793715f},
-std::array<float,2>{0.105129242f, 0.379848152f},
-std::array<float,2>{0.5078668f, 0.259756804f},
-std::array<float,2>{0.22721833f, 0.719205737f},
-std::array<float,2>{0.814231217f, 0.988450646f},
-std::array<float,2>{0.304557264f, 0.224415243f},
-std::array<float,2>{0.664551973f, 0.130318642f},
-std::array<float,2>{0.012045918f, 0.879824638f},
-std::array<float,2>{0.892883956f, 0.644721508f},
-std::array<float,2>{0.423064232f, 0.359045386f},
-std::array<float,2>{0.801258028f, 0.489766389f},
-std::array<float,2>{0.326712936f, 0.612300932f},
-std::array<float,2>{0.616607666f, 0.797468901f},
-std::array<float,2>{0.126351595f, 0.017646214f},
-std::array<float,2>{0.82093215f, 0.0981631428f},
-std::array<float,2>{0.309730321f, 0.850720584f},
-std::array<float,2>{0.501555026f, 0.555839241f},
-std::array<float,2>{0.225909606f, 0.409891576f},
-std::array<float,2>{0.704912484f, 0.289441258f},
-std::array<float,2>{0.0961005911f, 0.715775371f},
-std::array<float,2>{0.978699148f, 0.944437742f},
-std::array<float,2>{0.464516789f, 0.190875083f},
-std::array<float,2>{0.619346857f, 0.179470733f},
-std::array<float,2>{0.136511445f, 0.91572392f},
-std::array<float,2>{0.80804497f, 0.658687532f},
-std::array<float,2>{0.312746167f, 0.333926976f},
-std::array<float,2>{0.900180638f, 0.463120371f},
-std::array<float,2>{0.430250227f, 0.592950583f},
-std::array<float,2>{0.661807477f, 0.757078528f},
-std::array<float,2>{0.00630195392f, 0.062424913f},
-std::array<float,2>{0.938436329f, 0.228984222f},
-std::array<float,2>{0.473635226f, 0.994706392f},
-std::array<float,2>{0.719871461f, 0.732509196f},
-std::array<float,2>{0.0627337471f, 0.253182262f},
-std::array<float,2>{0.559066534f, 0.38803634f},
-std::array<float,2>{0.190516785f, 0.52598989f},
-std::array<float,2>{0.86122781f, 0.823214054f},
-std::array<float,2>{0.259028733f, 0.0825713575f},
-std::array<float,2>{0.638066411f, 0.0252542756f},
-std::array<float,2>{0.0601040609f, 0.809177101f},
-std::array<float,2>{0.922203422f, 0.620339572f},
-std::array<float,2>{0.388297349f, 0.492226392f},
-std::array<float,2>{0.769489646f, 0.34619689f},
-std::array<float,2>{0.345565647f, 0.648533523f},
-std::array<float,2>{0.580189049f, 0.887460589f},
-std::array<float,2>{0.16259779f, 0.138272166f},
-std::array<float,2>{0.78239131f, 0.148762807f},
-std::array<float,2>{0.332356304f, 0.899289906f},
-std::array<float,2>{0.602766037f, 0.634888947f},
-std::array<float,2>{0.144480869f, 0.359847188f},
-std::array<float,2>{0.687268853f, 0.476416886f},
-std::array<float,2>{0.0165590383f, 0.601624608f},
-std::array<float,2>{0.881149113f, 0.793787777f},
-std::array<float,2>{0.418349445f, 0.0143079543f},
-std::array<float,2>{0.52033639f, 0.0662794933f},
-std::array<float,2>{0.243499711f, 0.832288504f},
-std::array<float,2>{0.841998398f, 0.51032424f},
-std::array<float,2>{0.286177754f, 0.398979396f},
-std::array<float,2>{0.997275949f, 0.271081179f},
-std::array<float,2>{0.437941968f, 0.734515667f},
-std::array<float,2>{0.699986696f, 0.977190673f},
-std::array<float,2>{0.119310111f, 0.247963935f},
-std::array<float,2>{0.909621596f, 0.0455379263f},
-std::array<float,2>{0.402950615f, 0.770927429f},
-std::array<float,2>{0.643415213f, 0.573634684f},
-std::array<float,2>{0.0371686295f, 0.448048234f},
-std::array<float,2>{0.570273459f, 0.325727344f},
-std::array<float,2>{0.185016394f, 0.675009668f},
-std::array<float,2>{0.756964684f, 0.925062239f},
-std::array<float,2>{0.364206582f, 0.167363808f},
-std::array<float,2>{0.736474633f, 0.213468f},
-std::array<float,2>{0.0820850581f, 0.955208242f},
-std::array<float,2>{0.957811654f, 0.702382326f},
-std::array<float,2>{0.492253959f, 0.297879666f},
-std::array<float,2>{0.857763708f, 0.430526674f},
-std::array<float,2>{0.270840585f, 0.540970564f},
-std::array<float,2>{0.542172551f, 0.874201775f},
-std::array<float,2>{0.213292509f, 0.114443243f},
-std::array<float,2>{0.8096264f, 0.0761611089f},
-std::array<float,2>{0.317078948f, 0.842007458f},
-std::array<float,2>{0.624135852f, 0.506477296f},
-std::array<float,2>{0.138418719f, 0.392759651f},
-std::array<float,2>{0.656826079f, 0.274442077f},
-std::array<float,2>{0.00349560706f, 0.746522784f},
-std::array<float,2>{0.90590328f, 0.975700974f},
-std::array<float,2>{0.434150457f, 0.24064438f},
-std::array<float,2>{0.505399406f, 0.147773862f},
-std::array<float,2>{0.221075684f, 0.892611444f},
-std::array<float,2>{0.828043401f, 0.630095899f},
-std::array<float,2>{0.307126254f, 0.369547635f},
-std::array<float,2>{0.981675684f, 0.481046975f},
-std::array<float,2>{0.466885179f, 0.595972419f},
-std::array<float,2>{0.709680676f, 0.784035861f},
-std::array<float,2>{0.0981138945f, 0.00371476123f},
-std::array<float,2>{0.928365111f, 0.204027638f},
-std::array<float,2>{0.383461952f, 0.966706216f},
-std::array<float,2>{0.634036601f, 0.689369678f},
-std::array<float,2>{0.0568828061f, 0.31021446f},
-std::array<float,2>{0.585830986f, 0.427213043f},
-std::array<float,2>{0.157368332f, 0.538745761f},
-std::array<float,2>{0.77031666f, 0.866027892f},
-std::array<float,2>{0.351029187f, 0.121905096f},
-std::array<float,2>{0.724236369f, 0.039033059f},
-std::array<float,2>{0.0668165311f, 0.776909232f},
-std::array<float,2>{0.941794336f, 0.56660229f},
-std::array<float,2>{0.471259862f, 0.438172907f},
-std::array<float,2>{0.865761399f, 0.318187326f},
-std::array<float,2>{0.265559345f, 0.680596769f},
-std::array<float,2>{0.558344722f, 0.936772048f},
-std::array<float,2>{0.192288339f, 0.160731882f},
-std::array<float,2>{0.838590682f, 0.18136698f},
-std::array<float,2>{0.283731312f, 0.909050584f},
-std::array<float,2>{0.516978502f, 0.665997326f},
-std::array<float,2>{0.24913308f, 0.342828482f},
-std::array<float,2>{0.698815525f, 0.453804851f},
-std::array<float,2>{0.122261316f, 0.584321558f},
-std::array<float,2>{0.994850099f, 0.75976193f},
-std::array<float,2>{0.443132997f, 0.0535343587f},
-std::array<float,2>{0.608676076f, 0.107110769f},
-std::array<float,2>{0.1467987f, 0.858544707f},
-std::array<float,2>{0.785315394f, 0.548783481f},
-std::array<float,2>{0.330114484f, 0.414200366f},
-std::array<float,2>{0.878709495f, 0.288269013f},
-std::array<float,2>{0.417040706f, 0.705749452f},
-std::array<float,2>{0.683379352f, 0.945330679f},
-std::array<float,2>{0.0201361459f, 0.198915809f},
-std::array<float,2>{0.955088496f, 0.0224736501f},
-std::array<float,2>{0.498856336f, 0.803210378f},
-std::array<float,2>{0.739033043f, 0.615885913f},
-std::array<float,2>{0.0786836222f, 0.485963821f},
-std::array<float,2>{0.543492794f, 0.351932377f},
-std::array<float,2>{0.218499944f, 0.641721666f},
-std::array<float,2>{0.85403192f, 0.877492785f},
-std::array<float,2>{0.266561776f, 0.12763685f},
-std::array<float,2>{0.646971107f, 0.221641034f},
-std::array<float,2>{0.0322743692f, 0.986922503f},
-std::array<float,2>{0.91226536f, 0.726299822f},
-std::array<float,2>{0.398548692f, 0.261953443f},
-std::array<float,2>{0.753625453f, 0.375229478f},
-std::array<float,2>{0.360389739f, 0.52138108f},
-std::array<float,2>{0.566103041f, 0.815328419f},
-std::array<float,2>{0.181011677f, 0.0913777724f},
-std::array<float,2>{0.85025239f, 0.0582654923f},
-std::array<float,2>{0.276652575f, 0.753085077f},
-std::array<float,2>{0.538267434f, 0.58843267f},
-std::array<float,2>{0.207378641f, 0.468708187f},
-std::array<float,2>{0.745988786f, 0.331034541f},
-std::array<float,2>{0.0933454707f, 0.660743415f},
-std::array<float,2>{0.962447643f, 0.921607852f},
-std::array<float,2>{0.489351571f, 0.173308983f},
-std::array<float,2>{0.570448756f, 0.194527254f},
-std::array<float,2>{0.179664195f, 0.938423634f},
-std::array<float,2>{0.76205045f, 0.713397264f},
-std::array<float,2>{0.369370908f, 0.295963824f},
-std::array<float,2>{0.918122947f, 0.412889093f},
-std::array<float,2>{0.397350013f, 0.560489058f},
-std::array<float,2>{0.653056026f, 0.844803274f},
-std::array<float,2>{0.0394131392f, 0.0947478935f},
-std::array<float,2>{0.986872613f, 0.133803576f},
-std::array<float,2>{0.446866482f, 0.884013236f},
-std::array<float,2>{0.688106298f, 0.655311823f},
-std::array<float,2>{0.113550544f, 0.348682225f},
-std::array<float,2>{0.523921847f, 0.498484284f},
-std::array<float,2>{0.23711957f, 0.622204661f},
-std::array<float,2>{0.83325851f, 0.80816555f},
-std::array<float,2>{0.290276915f, 0.0298551712f},
-std::array<float,2>{0.679317832f, 0.0812495127f},
-std::array<float,2>{0.0304041635f, 0.827310562f},
-std::array<float,2>{0.888639927f, 0.53097403f},
-std::array<float,2>{0.413361728f, 0.385969788f},
-std::array<float,2>{0.792531312f, 0.254019499f},
-std::array<float,2>{0.336813569f, 0.730047047f},
-std::array<float,2>{0.598469853f, 0.997219384f},
-std::array<float,2>{0.154776886f, 0.23290281f},
-std::array<float,2>{0.778139234f, 0.245878473f},
-std::array<float,2>{0.358854204f, 0.982195318f},
-std::array<float,2>{0.58698678f, 0.741208434f},
-std::array<float,2>{0.164587334f, 0.26941976f},
-std::array<float,2>{0.631526172f, 0.402396619f},
-std::array<float,2>{0.0513574183f, 0.5137707f},
-std::array<float,2>{0.932151794f, 0.829609275f},
-std::array<float,2>{0.382655501f, 0.0698004141f},
-std::array<float,2>{0.547310293f, 0.0116784647f},
-std::array<float,2>{0.199588597f, 0.790969491f},
-std::array<float,2>{0.869468033f, 0.606372058f},
-std::array<float,2>{0.253453165f, 0.470671237f},
-std::array<float,2>{0.947439551f, 0.366237342f},
-std::array<float,2>{0.480307013f, 0.638642848f},
-std::array<float,2>{0.732590377f, 0.902463078f},
-std::array<float,2>{0.0764809996f, 0.155924484f},
-std::array<float,2>{0.897940099f, 0.111923084f},
-std::array<float,2>{0.426012337f, 0.870311201f},
-std::array<float,2>{0.670913577f, 0.543261349f},
-std::array<float,2>{0.011421334f, 0.436197072f},
-std::array<float,2>{0.613106966f, 0.30458796f},
-std::array<float,2>{0.13269639f, 0.697949946f},
-std::array<float,2>{0.797245264f, 0.960934877f},
-std::array<float,2>{0.320616513f, 0.215843156f},
-std::array<float,2>{0.713234365f, 0.168014392f},
-std::array<float,2>{0.106611289f, 0.928509891f},
-std::array<float,2>{0.972245753f, 0.678360164f},
-std::array<float,2>{0.455518961f, 0.323591173f},
-std::array<float,2>{0.818590939f, 0.450923473f},
-std::array<float,2>{0.296975166f, 0.577913105f},
-std::array<float,2>{0.51460284f, 0.767303884f},
-std::array<float,2>{0.231075525f, 0.0416023619f},
-std::array<float,2>{0.796673954f, 0.0337416269f},
-std::array<float,2>{0.343397021f, 0.779084265f},
-std::array<float,2>{0.593981504f, 0.565375447f},
-std::array<float,2>{0.150239259f, 0.442941964f},
-std::array<float,2>{0.673627257f, 0.312783659f},
-std::array<float,2>{0.0238795206f, 0.686415732f},
-std::array<float,2>{0.883293629f, 0.930260122f},
-std::array<float,2>{0.407841802f, 0.156443447f},
-std::array<float,2>{0.527390063f, 0.207213581f},
-std::array<float,2>{0.241033778f, 0.963168561f},
-std::array<float,2>{0.829738081f, 0.691762149f},
-std::array<float,2>{0.295706153f, 0.306548476f},
-std::array<float,2>{0.988830924f, 0.423666358f},
-std::array<float,2>{0.452344418f, 0.534713268f},
-std::array<float,2>{0.693009317f, 0.861676812f},
-std::array<float,2>{0.110312924f, 0.119627573f},
-std::array<float,2>{0.91560173f, 0.143808424f},
-std::array<float,2>{0.393622369f, 0.89658761f},
-std::array<float,2>{0.651978374f, 0.625276446f},
-std::array<float,2>{0.0448425077f, 0.372100919f},
-std::array<float,2>{0.576066673f, 0.479703009f},
-std::array<float,2>{0.17204003f, 0.601023495f},
-std::array<float,2>{0.760460138f, 0.786488175f},
-std::array<float,2>{0.373148948f, 0.00417203363f},
-std::array<float,2>{0.749448955f, 0.0713391528f},
-std::array<float,2>{0.0874596313f, 0.836777866f},
-std::array<float,2>{0.96800828f, 0.50293529f},
-std::array<float,2>{0.486104578f, 0.397463322f},
-std::array<float,2>{0.846075714f, 0.280907422f},
-std::array<float,2>{0.278660297f, 0.745238662f},
-std::array<float,2>{0.533419609f, 0.972527742f},
-std::array<float,2>{0.203968912f, 0.235787392f},
-std::array<float,2>{0.816071272f, 0.225876942f},
-std::array<float,2>{0.301463723f, 0.990263104f},
-std::array<float,2>{0.510983467f, 0.721360028f},
-std::array<float,2>{0.230199516f, 0.261131108f},
-std::array<float,2>{0.716946423f, 0.38259992f},
-std::array<float,2>{0.10200125f, 0.517461658f},
-std::array<float,2>{0.975561321f, 0.820123672f},
-std::array<float,2>{0.459905744f, 0.0859834701f},
-std::array<float,2>{0.613572001f, 0.0174845401f},
-std::array<float,2>{0.127027765f, 0.799037099f},
-std::array<float,2>{0.803745627f, 0.609470665f},
-std::array<float,2>{0.325443476f, 0.490266025f},
-std::array<float,2>{0.892367721f, 0.355848312f},
-std::array<float,2>{0.425536633f, 0.647288918f},
-std::array<float,2>{0.667438149f, 0.88276881f},
-std::array<float,2>{0.0154318381f, 0.131186411f},
-std::array<float,2>{0.952084363f, 0.105207853f},
-std::array<float,2>{0.48419553f, 0.852134109f},
-std::array<float,2>{0.730160236f, 0.552436888f},
-std::array<float,2>{0.0737506598f, 0.42108205f},
-std::array<float,2>{0.552580595f, 0.283011645f},
-std::array<float,2>{0.195524946f, 0.710413396f},
-std::array<float,2>{0.873301029f, 0.950919449f},
-std::array<float,2>{0.255358845f, 0.201567963f},
-std::array<float,2>{0.626805246f, 0.186425239f},
-std::array<float,2>{0.0479178913f, 0.911518514f},
-std::array<float,2>{0.933895111f, 0.670731187f},
-std::array<float,2>{0.375239015f, 0.338569701f},
-std::array<float,2>{0.776937842f, 0.460525632f},
-std::array<float,2>{0.352890581f, 0.579714715f},
-std::array<float,2>{0.589939713f, 0.762230456f},
-std::array<float,2>{0.169880152f, 0.0484181717f},
-std::array<float,2>{0.861512184f, 0.0854784325f},
-std::array<float,2>{0.260107756f, 0.821853042f},
-std::array<float,2>{0.561419189f, 0.523660839f},
-std::array<float,2>{0.189285457f, 0.389696479f},
-std::array<float,2>{0.720768273f, 0.251907408f},
-std::array<float,2>{0.0651607662f, 0.730639935f},
-std::array<float,2>{0.940959513f, 0.993900716f},
-std::array<float,2>{0.474991411f, 0.226706102f},
-std::array<float,2>{0.580058455f, 0.139360845f},
-std::array<float,2>{0.160881072f, 0.888674259f},
-std::array<float,2>{0.767396033f, 0.65068996f},
-std::array<float,2>{0.346617609f, 0.345661849f},
-std::array<float,2>{0.924499273f, 0.494584352f},
-std::array<float,2>{0.390290111f, 0.617369235f},
-std::array<float,2>{0.639500022f, 0.812299669f},
-std::array<float,2>{0.060687229f, 0.0255757906f},
-std::array<float,2>{0.976757526f, 0.187860459f},
-std::array<float,2>{0.461790711f, 0.942829072f},
-std::array<float,2>{0.706364751f, 0.716855347f},
-std::array<float,2>{0.0941416323f, 0.291053444f},
-std::array<float,2>{0.502482951f, 0.407672554f},
-std::array<float,2>{0.224311188f, 0.557098031f},
-std::array<float,2>{0.822510779f, 0.849462509f},
-std::array<float,2>{0.310603797f, 0.0997250304f},
-std::array<float,2>{0.66295445f, 0.0591471866f},
-std::array<float,2>{0.00455331011f, 0.754585743f},
-std::array<float,2>{0.901742935f, 0.590429127f},
-std::array<float,2>{0.432645589f, 0.461132646f},
-std::array<float,2>{0.805170417f, 0.334473073f},
-std::array<float,2>{0.316243172f, 0.6581285f},
-std::array<float,2>{0.61845541f, 0.917043567f},
-std::array<float,2>{0.134249061f, 0.176543742f},
-std::array<float,2>{0.755675912f, 0.165659696f},
-std::array<float,2>{0.366437227f, 0.922022939f},
-std::array<float,2>{0.56796062f, 0.672414839f},
-std::array<float,2>{0.187093437f, 0.327374101f},
-std::array<float,2>{0.641597509f, 0.446409136f},
-std::array<float,2>{0.0362750031f, 0.571043313f},
-std::array<float,2>{0.906714797f, 0.7725088f},
-std::array<float,2>{0.405897379f, 0.0444275364f},
-std::array<float,2>{0.539875209f, 0.115808129f},
-std::array<float,2>{0.212828577f, 0.871223688f},
-std::array<float,2>{0.856967807f, 0.542368889f},
-std::array<float,2>{0.272430569f, 0.433222592f},
-std::array<float,2>{0.959747553f, 0.29971543f},
-std::array<float,2>{0.495221615f, 0.70042479f},
-std::array<float,2>{0.735592842f, 0.953377008f},
-std::array<float,2>{0.08441028f, 0.211725831f},
-std::array<float,2>{0.879181623f, 0.0121118538f},
-std::array<float,2>{0.421793431f, 0.796246886f},
-std::array<float,2>{0.684189618f, 0.605335832f},
-std::array<float,2>{0.0184175596f, 0.474363208f},
-std::array<float,2>{0.603834689f, 0.3617872f},
-std::array<float,2>{0.141026005f, 0.634327292f},
-std::array<float,2>{0.783870637f, 0.901245594f},
-std::array<float,2>{0.335525036f, 0.1514173f},
-std::array<float,2>{0.70304811f, 0.248571366f},
-std::array<float,2>{0.118969016f, 0.980271637f},
-std::array<float,2>{0.998428762f, 0.737628043f},
-std::array<float,2>{0.439989746f, 0.273040771f},
-std::array<float,2>{0.840338886f, 0.40176636f},
-std::array<float,2>{0.287356824f, 0.50790751f},
-std::array<float,2>{0.523372531f, 0.834724665f},
-std::array<float,2>{0.245770872f, 0.064281866f},
-std::array<float,2>{0.77201581f, 0.124429531f},
-std::array<float,2>{0.347802967f, 0.863973618f},
-std::array<float,2>{0.582060575f, 0.536554098f},
-std::array<float,2>{0.159449577f, 0.429518938f},
-std::array<float,2>{0.636717021f, 0.311266422f},
-std::array<float,2>{0.0562742986f, 0.690188289f},
-std::array<float,2>{0.926278234f, 0.968360186f},
-std::array<float,2>{0.386165887f, 0.206179991f},
-std::array<float,2>{0.555653334f, 0.163874894f},
-std::array<float,2>{0.193769559f, 0.933982015f},
-std::array<float,2>{0.863540113f, 0.68301332f},
-std::array<float,2>{0.262253821f, 0.318735451f},
-std::array<float,2>{0.944084466f, 0.44082576f},
-std::array<float,2>{0.470645487f, 0.569335401f},
-std::array<float,2>{0.724771202f, 0.77413255f},
-std::array<float,2>{0.0702379569f, 0.0363592282f},
-std::array<float,2>{0.903268933f, 0.240164101f},
-std::array<float,2>{0.436899066f, 0.97359401f},
-std::array<float,2>{0.659925222f, 0.748924255f},
-std::array<float,2>{0.00168973603f, 0.277150035f},
-std::array<float,2>{0.622583628f, 0.391180158f},
-std::array<float,2>{0.140003234f, 0.504396915f},
-std::array<float,2>{0.812469602f, 0.840457797f},
-std::array<float,2>{0.318630844f, 0.0773709491f},
-std::array<float,2>{0.708132744f, 0.00107124459f},
-std::array<float,2>{0.100498646f, 0.782660484f},
-std::array<float,2>{0.982438147f, 0.594876051f},
-std::array<float,2>{0.46490851f, 0.482964545f},
-std::array<float,2>{0.825365007f, 0.368638575f},
-std::array<float,2>{0.306460053f, 0.630954146f},
-std::array<float,2>{0.506884813f, 0.891219914f},
-std::array<float,2>{0.220040411f, 0.144706681f},
-std::array<float,2>{0.853098989f, 0.125578642f},
-std::array<float,2>{0.268232435f, 0.875636756f},
-std::array<float,2>{0.54604429f, 0.643690467f},
-std::array<float,2>{0.216654062f, 0.354560375f},
-std::array<float,2>{0.741108179f, 0.487326413f},
-std::array<float,2>{0.0813785866f, 0.615108013f},
-std::array<float,2>{0.954467237f, 0.801928163f},
-std::array<float,2>{0.49651584f, 0.0213914476f},
-std::array<float,2>{0.564038992f, 0.0924191102f},
-std::array<float,2>{0.182149872f, 0.813798845f},
-std::array<float,2>{0.751640677f, 0.523332596f},
-std::array<float,2>{0.362144619f, 0.377777696f},
-std::array<float,2>{0.911611676f, 0.265361816f},
-std::array<float,2>{0.401829809f, 0.722768366f},
-std::array<float,2>{0.645559132f, 0.985179961f},
-std::array<float,2>{0.0342163853f, 0.220161244f},
-std::array<float,2>{0.99376142f, 0.0517121553f},
-std::array<float,2>{0.444481879f, 0.759785593f},
-std::array<float,2>{0.695578218f, 0.582235575f},
-std::array<float,2>{0.124282748f, 0.456754923f},
-std::array<float,2>{0.51842773f, 0.340556234f},
-std::array<float,2>{0.246814564f, 0.666583896f},
-std::array<float,2>{0.836004436f, 0.907878637f},
-std::array<float,2>{0.282274574f, 0.181975275f},
-std::array<float,2>{0.680711329f, 0.196191043f},
-std::array<float,2>{0.0229770411f, 0.948767662f},
-std::array<float,2>{0.875400066f, 0.704649448f},
-std::array<float,2>{0.415529639f, 0.285728395f},
-std::array<float,2>{0.788429916f, 0.41633901f},
-std::array<float,2>{0.328434259f, 0.548916996f},
-std::array<float,2>{0.607304573f, 0.856263161f},
-std::array<float,2>{0.145697042f, 0.108174942f},
-std::array<float,2>{0.834132612f, 0.0280015972f},
-std::array<float,2>{0.291526824f, 0.805614591f},
-std::array<float,2>{0.526948571f, 0.623998106f},
-std::array<float,2>{0.235853761f, 0.497034729f},
-std::array<float,2>{0.690627515f, 0.351385087f},
-std::array<float,2>{0.116726168f, 0.654012382f},
-std::array<float,2>{0.985841632f, 0.886297822f},
-std::array<float,2>{0.447875977f, 0.134946972f},
-std::array<float,2>{0.59971267f, 0.231380701f},
-std::array<float,2>{0.153947368f, 0.998910427f},
-std::array<float,2>{0.790094256f, 0.728177905f},
-std::array<float,2>{0.338052481f, 0.256020963f},
-std::array<float,2>{0.890404701f, 0.384304613f},
-std::array<float,2>{0.411465615f, 0.528458834f},
-std::array<float,2>{0.677079141f, 0.825263619f},
-std::array<float,2>{0.0286815725f, 0.0800516605f},
-std::array<float,2>{0.963465571f, 0.174513564f},
-std::array<float,2>{0.490905553f, 0.919033825f},
-std::array<float,2>{0.74300772f, 0.663003385f},
-std::array<float,2>{0.0911359116f, 0.328857183f},
-std::array<float,2>{0.535513103f, 0.465712219f},
-std::array<float,2>{0.209945425f, 0.587852478f},
-std::array<float,2>{0.849568188f, 0.750608683f},
-std::array<float,2>{0.274868727f, 0.0563262999f},
-std::array<float,2>{0.655294776f, 0.095710583f},
-std::array<float,2>{0.0427283458f, 0.846538067f},
-std::array<float,2>{0.921138883f, 0.561200798f},
-std::array<float,2>{0.396465868f, 0.411850601f},
-std::array<float,2>{0.765196919f, 0.293979228f},
-std::array<float,2>{0.368624151f, 0.712308109f},
-std::array<float,2>{0.572844863f, 0.940287173f},
-std::array<float,2>{0.177019194f, 0.191535562f},
-std::array<float,2>{0.800508857f, 0.217268974f},
-std::array<float,2>{0.322592795f, 0.95742923f},
-std::array<float,2>{0.610509276f, 0.695867777f},
-std::array<float,2>{0.13028945f, 0.302497923f},
-std::array<float,2>{0.6681512f, 0.434531152f},
-std::array<float,2>{0.00956480857f, 0.546731174f},
-std::array<float,2>{0.896402776f, 0.869081974f},
-std::array<float,2>{0.428008556f, 0.110357776f},
-std::array<float,2>{0.513413727f, 0.0395446867f},
-std::array<float,2>{0.233684272f, 0.768909335f},
-std::array<float,2>{0.818165123f, 0.574341357f},
-std::array<float,2>{0.299405515f, 0.452837229f},
-std::array<float,2>{0.96932292f, 0.321276188f},
-std::array<float,2>{0.454517275f, 0.676207721f},
-std::array<float,2>{0.711699843f, 0.926508665f},
-std::array<float,2>{0.107883483f, 0.171640277f},
-std::array<float,2>{0.930237114f, 0.0673108771f},
-std::array<float,2>{0.380722612f, 0.831950366f},
-std::array<float,2>{0.629090309f, 0.512823641f},
-std::array<float,2>{0.0539756678f, 0.404362589f},
-std::array<float,2>{0.588014543f, 0.266053677f},
-std::array<float,2>{0.166678488f, 0.739947915f},
-std::array<float,2>{0.780676425f, 0.983299077f},
-std::array<float,2>{0.356246501f, 0.244037032f},
-std::array<float,2>{0.730946064f, 0.152734727f},
-std::array<float,2>{0.0742798671f, 0.906135559f},
-std::array<float,2>{0.945461571f, 0.6405707f},
-std::array<float,2>{0.477533519f, 0.364025503f},
-std::array<float,2>{0.868042171f, 0.471006364f},
-std::array<float,2>{0.250550538f, 0.607779086f},
-std::array<float,2>{0.548872113f, 0.792876959f},
-std::array<float,2>{0.201607227f, 0.0085675763f}}
\ No newline at end of file
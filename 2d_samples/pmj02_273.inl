@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.150878891f, 0.975537777f},
-std::array<float,2>{0.521786273f, 0.429742873f},
-std::array<float,2>{0.873062074f, 0.59755367f},
-std::array<float,2>{0.358674258f, 0.00308357249f},
-std::array<float,2>{0.392112136f, 0.674154162f},
-std::array<float,2>{0.983600497f, 0.160751447f},
-std::array<float,2>{0.740612686f, 0.768353581f},
-std::array<float,2>{0.0806432292f, 0.330715954f},
-std::array<float,2>{0.06206204f, 0.506700158f},
-std::array<float,2>{0.652776241f, 0.0747124478f},
-std::array<float,2>{0.90268749f, 0.909792364f},
-std::array<float,2>{0.469273388f, 0.482257247f},
-std::array<float,2>{0.271257222f, 0.850490749f},
-std::array<float,2>{0.809465349f, 0.282519698f},
-std::array<float,2>{0.613570273f, 0.720011771f},
-std::array<float,2>{0.248769119f, 0.211147711f},
-std::array<float,2>{0.12138436f, 0.811262667f},
-std::array<float,2>{0.704108179f, 0.343938708f},
-std::array<float,2>{0.958504915f, 0.649480164f},
-std::array<float,2>{0.430373996f, 0.138280571f},
-std::array<float,2>{0.33745873f, 0.575161457f},
-std::array<float,2>{0.828129828f, 0.0427793898f},
-std::array<float,2>{0.550173402f, 0.959308505f},
-std::array<float,2>{0.171525553f, 0.403502792f},
-std::array<float,2>{0.193821967f, 0.697027683f},
-std::array<float,2>{0.574360788f, 0.22652413f},
-std::array<float,2>{0.750432253f, 0.825084329f},
-std::array<float,2>{0.287714273f, 0.257399648f},
-std::array<float,2>{0.452421993f, 0.883304834f},
-std::array<float,2>{0.920447946f, 0.445732266f},
-std::array<float,2>{0.671141267f, 0.538999617f},
-std::array<float,2>{0.0201911181f, 0.101804234f},
-std::array<float,2>{0.231941342f, 0.838414609f},
-std::array<float,2>{0.598642886f, 0.27970928f},
-std::array<float,2>{0.787566602f, 0.716949284f},
-std::array<float,2>{0.260359257f, 0.239524677f},
-std::array<float,2>{0.48832497f, 0.561271012f},
-std::array<float,2>{0.875501871f, 0.115919441f},
-std::array<float,2>{0.631232798f, 0.892909944f},
-std::array<float,2>{0.039009545f, 0.462760031f},
-std::array<float,2>{0.0765697807f, 0.630710125f},
-std::array<float,2>{0.729987085f, 0.143903494f},
-std::array<float,2>{0.987825632f, 0.795638859f},
-std::array<float,2>{0.376091897f, 0.367576003f},
-std::array<float,2>{0.365263492f, 0.946359098f},
-std::array<float,2>{0.85250479f, 0.375640184f},
-std::array<float,2>{0.51528126f, 0.591347814f},
-std::array<float,2>{0.136611179f, 0.0591801703f},
-std::array<float,2>{0.000237767061f, 0.93472147f},
-std::array<float,2>{0.674003422f, 0.496564597f},
-std::array<float,2>{0.92281723f, 0.518635929f},
-std::array<float,2>{0.466240317f, 0.0799639374f},
-std::array<float,2>{0.297714949f, 0.748023152f},
-std::array<float,2>{0.781065166f, 0.18911168f},
-std::array<float,2>{0.589316964f, 0.871610999f},
-std::array<float,2>{0.20774743f, 0.304779142f},
-std::array<float,2>{0.187094331f, 0.623710454f},
-std::array<float,2>{0.532577395f, 0.0191009454f},
-std::array<float,2>{0.823639572f, 0.987763882f},
-std::array<float,2>{0.318206847f, 0.420517057f},
-std::array<float,2>{0.410654247f, 0.751091361f},
-std::array<float,2>{0.941532254f, 0.318626732f},
-std::array<float,2>{0.691686928f, 0.670026243f},
-std::array<float,2>{0.109167285f, 0.179364756f},
-std::array<float,2>{0.212413043f, 0.90160054f},
-std::array<float,2>{0.579204261f, 0.453332096f},
-std::array<float,2>{0.770766377f, 0.551851809f},
-std::array<float,2>{0.309314966f, 0.120529652f},
-std::array<float,2>{0.457331181f, 0.708633482f},
-std::array<float,2>{0.932292283f, 0.247483373f},
-std::array<float,2>{0.680303216f, 0.830212474f},
-std::array<float,2>{0.0137281101f, 0.273300499f},
-std::array<float,2>{0.0961338431f, 0.581343114f},
-std::array<float,2>{0.69691813f, 0.0489784516f},
-std::array<float,2>{0.948754966f, 0.943263113f},
-std::array<float,2>{0.419637263f, 0.383744091f},
-std::array<float,2>{0.320696026f, 0.784988523f},
-std::array<float,2>{0.814414024f, 0.362330854f},
-std::array<float,2>{0.539456844f, 0.634215891f},
-std::array<float,2>{0.17851904f, 0.154960647f},
-std::array<float,2>{0.0453453921f, 0.866774082f},
-std::array<float,2>{0.638799369f, 0.298982322f},
-std::array<float,2>{0.885965645f, 0.740730882f},
-std::array<float,2>{0.496640801f, 0.197486982f},
-std::array<float,2>{0.254282981f, 0.526625514f},
-std::array<float,2>{0.795533299f, 0.0867811367f},
-std::array<float,2>{0.602717638f, 0.925188661f},
-std::array<float,2>{0.223818526f, 0.491512269f},
-std::array<float,2>{0.128442377f, 0.65977937f},
-std::array<float,2>{0.507358193f, 0.181463256f},
-std::array<float,2>{0.846569598f, 0.761478543f},
-std::array<float,2>{0.373774827f, 0.322196484f},
-std::array<float,2>{0.389683247f, 0.9964872f},
-std::array<float,2>{0.992750347f, 0.411014676f},
-std::array<float,2>{0.722320676f, 0.613535523f},
-std::array<float,2>{0.0689030364f, 0.0293534528f},
-std::array<float,2>{0.15686886f, 0.776108503f},
-std::array<float,2>{0.559417188f, 0.34048599f},
-std::array<float,2>{0.838718176f, 0.680902958f},
-std::array<float,2>{0.328363866f, 0.171372026f},
-std::array<float,2>{0.424593151f, 0.608069062f},
-std::array<float,2>{0.966283739f, 0.0120568313f},
-std::array<float,2>{0.717931807f, 0.979038835f},
-std::array<float,2>{0.114208207f, 0.422376782f},
-std::array<float,2>{0.0266906973f, 0.732883334f},
-std::array<float,2>{0.659987807f, 0.205880314f},
-std::array<float,2>{0.907454073f, 0.858302414f},
-std::array<float,2>{0.440736264f, 0.289812326f},
-std::array<float,2>{0.295765728f, 0.918004155f},
-std::array<float,2>{0.760157943f, 0.47420916f},
-std::array<float,2>{0.566640735f, 0.50956738f},
-std::array<float,2>{0.198129803f, 0.0640532896f},
-std::array<float,2>{0.0905361623f, 0.966012597f},
-std::array<float,2>{0.749855876f, 0.39574483f},
-std::array<float,2>{0.97126621f, 0.564673007f},
-std::array<float,2>{0.404005438f, 0.0343440622f},
-std::array<float,2>{0.3463085f, 0.640669882f},
-std::array<float,2>{0.860812664f, 0.129131243f},
-std::array<float,2>{0.530877531f, 0.799699306f},
-std::array<float,2>{0.1471214f, 0.35902971f},
-std::array<float,2>{0.236000583f, 0.541620314f},
-std::array<float,2>{0.623107314f, 0.0986957476f},
-std::array<float,2>{0.797009408f, 0.875955462f},
-std::array<float,2>{0.279512733f, 0.437754363f},
-std::array<float,2>{0.480817199f, 0.819389105f},
-std::array<float,2>{0.897618949f, 0.263807476f},
-std::array<float,2>{0.643575191f, 0.69213599f},
-std::array<float,2>{0.0473211557f, 0.232896045f},
-std::array<float,2>{0.242462352f, 0.940022469f},
-std::array<float,2>{0.609577298f, 0.390114665f},
-std::array<float,2>{0.805506051f, 0.58451587f},
-std::array<float,2>{0.268356562f, 0.0509846099f},
-std::array<float,2>{0.475380242f, 0.640316129f},
-std::array<float,2>{0.898774981f, 0.150509104f},
-std::array<float,2>{0.650337517f, 0.78828007f},
-std::array<float,2>{0.0582680218f, 0.364855528f},
-std::array<float,2>{0.0827921703f, 0.5473786f},
-std::array<float,2>{0.737232327f, 0.123822793f},
-std::array<float,2>{0.976983547f, 0.905008018f},
-std::array<float,2>{0.396769524f, 0.460618287f},
-std::array<float,2>{0.353655964f, 0.835333645f},
-std::array<float,2>{0.86924392f, 0.267120451f},
-std::array<float,2>{0.516692281f, 0.703760743f},
-std::array<float,2>{0.154205963f, 0.244728833f},
-std::array<float,2>{0.0168847945f, 0.763952315f},
-std::array<float,2>{0.664776087f, 0.324986219f},
-std::array<float,2>{0.916912377f, 0.660901308f},
-std::array<float,2>{0.447457105f, 0.187097058f},
-std::array<float,2>{0.285106301f, 0.61089462f},
-std::array<float,2>{0.75446111f, 0.0266790837f},
-std::array<float,2>{0.573514163f, 0.99244231f},
-std::array<float,2>{0.190921366f, 0.408544481f},
-std::array<float,2>{0.16744417f, 0.738243461f},
-std::array<float,2>{0.552475989f, 0.202286229f},
-std::array<float,2>{0.833909512f, 0.861096442f},
-std::array<float,2>{0.341079444f, 0.301409274f},
-std::array<float,2>{0.435336888f, 0.928230226f},
-std::array<float,2>{0.956028938f, 0.484640658f},
-std::array<float,2>{0.710092485f, 0.528227627f},
-std::array<float,2>{0.118562005f, 0.091348514f},
-std::array<float,2>{0.137004897f, 0.852798402f},
-std::array<float,2>{0.509051144f, 0.295209646f},
-std::array<float,2>{0.859096885f, 0.727294803f},
-std::array<float,2>{0.36041221f, 0.207761839f},
-std::array<float,2>{0.382434607f, 0.513814688f},
-std::array<float,2>{0.988659859f, 0.0683698356f},
-std::array<float,2>{0.731011987f, 0.917746365f},
-std::array<float,2>{0.0736185908f, 0.471203834f},
-std::array<float,2>{0.0351084583f, 0.686029255f},
-std::array<float,2>{0.626655936f, 0.164469227f},
-std::array<float,2>{0.880375326f, 0.778011441f},
-std::array<float,2>{0.487118304f, 0.33751595f},
-std::array<float,2>{0.265177876f, 0.981483877f},
-std::array<float,2>{0.783017695f, 0.427918315f},
-std::array<float,2>{0.593939126f, 0.60194242f},
-std::array<float,2>{0.229923993f, 0.0103936493f},
-std::array<float,2>{0.102428101f, 0.881770253f},
-std::array<float,2>{0.691084445f, 0.441922158f},
-std::array<float,2>{0.939531624f, 0.54672271f},
-std::array<float,2>{0.409828901f, 0.097267732f},
-std::array<float,2>{0.31429106f, 0.687692523f},
-std::array<float,2>{0.827817082f, 0.228363574f},
-std::array<float,2>{0.535728753f, 0.814406574f},
-std::array<float,2>{0.18125549f, 0.261348277f},
-std::array<float,2>{0.205264211f, 0.566504717f},
-std::array<float,2>{0.591917813f, 0.0371990241f},
-std::array<float,2>{0.774583459f, 0.961660445f},
-std::array<float,2>{0.302327156f, 0.393926412f},
-std::array<float,2>{0.462767541f, 0.801602125f},
-std::array<float,2>{0.926160932f, 0.35509938f},
-std::array<float,2>{0.678950548f, 0.646592557f},
-std::array<float,2>{0.00429560896f, 0.125533462f},
-std::array<float,2>{0.172471389f, 0.913500011f},
-std::array<float,2>{0.544795334f, 0.480437726f},
-std::array<float,2>{0.817982435f, 0.503252923f},
-std::array<float,2>{0.325053453f, 0.0705617964f},
-std::array<float,2>{0.414158165f, 0.724368453f},
-std::array<float,2>{0.94955641f, 0.216969132f},
-std::array<float,2>{0.701175511f, 0.84416461f},
-std::array<float,2>{0.100125901f, 0.286593914f},
-std::array<float,2>{0.0116848079f, 0.599724114f},
-std::array<float,2>{0.687493622f, 0.00615007803f},
-std::array<float,2>{0.93684423f, 0.972281873f},
-std::array<float,2>{0.453813761f, 0.43641454f},
-std::array<float,2>{0.304754496f, 0.772141337f},
-std::array<float,2>{0.768198669f, 0.333414018f},
-std::array<float,2>{0.583806574f, 0.679132044f},
-std::array<float,2>{0.21839416f, 0.15825586f},
-std::array<float,2>{0.0625905842f, 0.823969662f},
-std::array<float,2>{0.723363042f, 0.253125221f},
-std::array<float,2>{0.997079015f, 0.70108813f},
-std::array<float,2>{0.383981317f, 0.219074428f},
-std::array<float,2>{0.367328227f, 0.534479558f},
-std::array<float,2>{0.847724736f, 0.10654828f},
-std::array<float,2>{0.502669275f, 0.890205085f},
-std::array<float,2>{0.131647766f, 0.45235768f},
-std::array<float,2>{0.220568568f, 0.654893696f},
-std::array<float,2>{0.605563462f, 0.135596603f},
-std::array<float,2>{0.790486753f, 0.806301951f},
-std::array<float,2>{0.253513485f, 0.34780544f},
-std::array<float,2>{0.495710075f, 0.956913531f},
-std::array<float,2>{0.890309989f, 0.401167989f},
-std::array<float,2>{0.636556089f, 0.574019849f},
-std::array<float,2>{0.0410240777f, 0.0451334231f},
-std::array<float,2>{0.200081065f, 0.789351225f},
-std::array<float,2>{0.564514458f, 0.371095508f},
-std::array<float,2>{0.764060736f, 0.62572974f},
-std::array<float,2>{0.28922388f, 0.146462485f},
-std::array<float,2>{0.44393599f, 0.587500215f},
-std::array<float,2>{0.914039493f, 0.0563742705f},
-std::array<float,2>{0.662721097f, 0.950354278f},
-std::array<float,2>{0.0289354976f, 0.381658822f},
-std::array<float,2>{0.109866023f, 0.714389622f},
-std::array<float,2>{0.711196899f, 0.235246986f},
-std::array<float,2>{0.964669824f, 0.840197206f},
-std::array<float,2>{0.426981539f, 0.274907887f},
-std::array<float,2>{0.335179627f, 0.896216094f},
-std::array<float,2>{0.842146456f, 0.465369046f},
-std::array<float,2>{0.557635009f, 0.558297336f},
-std::array<float,2>{0.16134721f, 0.11054185f},
-std::array<float,2>{0.0533253103f, 0.991831243f},
-std::array<float,2>{0.645900965f, 0.414125264f},
-std::array<float,2>{0.89413631f, 0.6185987f},
-std::array<float,2>{0.479087055f, 0.0195628311f},
-std::array<float,2>{0.276247025f, 0.666432858f},
-std::array<float,2>{0.801171362f, 0.17535682f},
-std::array<float,2>{0.618844688f, 0.754007816f},
-std::array<float,2>{0.240994141f, 0.313638687f},
-std::array<float,2>{0.143949792f, 0.523156881f},
-std::array<float,2>{0.527108312f, 0.0855409428f},
-std::array<float,2>{0.865114331f, 0.930744469f},
-std::array<float,2>{0.348782718f, 0.493987441f},
-std::array<float,2>{0.399532199f, 0.867815375f},
-std::array<float,2>{0.973838329f, 0.310586214f},
-std::array<float,2>{0.744759798f, 0.742376029f},
-std::array<float,2>{0.0887688771f, 0.193800956f},
-std::array<float,2>{0.168233216f, 0.958785772f},
-std::array<float,2>{0.547122359f, 0.404813468f},
-std::array<float,2>{0.831260383f, 0.5764274f},
-std::array<float,2>{0.338219911f, 0.0400225781f},
-std::array<float,2>{0.432713151f, 0.650447607f},
-std::array<float,2>{0.959044576f, 0.139400989f},
-std::array<float,2>{0.706612468f, 0.808797359f},
-std::array<float,2>{0.123647213f, 0.347633153f},
-std::array<float,2>{0.0225938875f, 0.537054181f},
-std::array<float,2>{0.669446886f, 0.10394904f},
-std::array<float,2>{0.919780493f, 0.885888755f},
-std::array<float,2>{0.450746566f, 0.447585493f},
-std::array<float,2>{0.285627604f, 0.828021288f},
-std::array<float,2>{0.752790153f, 0.254185528f},
-std::array<float,2>{0.57656163f, 0.699186742f},
-std::array<float,2>{0.191893667f, 0.223076925f},
-std::array<float,2>{0.0792439654f, 0.76731354f},
-std::array<float,2>{0.738296211f, 0.32866472f},
-std::array<float,2>{0.980759144f, 0.673122823f},
-std::array<float,2>{0.392983824f, 0.162192017f},
-std::array<float,2>{0.356344432f, 0.594359279f},
-std::array<float,2>{0.872934341f, 9.30616989e-06f},
-std::array<float,2>{0.519810855f, 0.973403573f},
-std::array<float,2>{0.150208876f, 0.431675315f},
-std::array<float,2>{0.247198537f, 0.722078681f},
-std::array<float,2>{0.616390347f, 0.213632196f},
-std::array<float,2>{0.8106848f, 0.849317372f},
-std::array<float,2>{0.272247404f, 0.283270389f},
-std::array<float,2>{0.472052395f, 0.906847119f},
-std::array<float,2>{0.905359983f, 0.483278722f},
-std::array<float,2>{0.654356658f, 0.504526258f},
-std::array<float,2>{0.0592906922f, 0.0778438151f},
-std::array<float,2>{0.209492072f, 0.874966979f},
-std::array<float,2>{0.586689174f, 0.307462811f},
-std::array<float,2>{0.777493715f, 0.748909533f},
-std::array<float,2>{0.300510854f, 0.189937457f},
-std::array<float,2>{0.467026949f, 0.517430842f},
-std::array<float,2>{0.925260901f, 0.0801769197f},
-std::array<float,2>{0.672328234f, 0.937012672f},
-std::array<float,2>{0.00266590249f, 0.498073846f},
-std::array<float,2>{0.10642761f, 0.66888243f},
-std::array<float,2>{0.695284665f, 0.176380679f},
-std::array<float,2>{0.945173919f, 0.753614366f},
-std::array<float,2>{0.41285637f, 0.316939503f},
-std::array<float,2>{0.31929487f, 0.985142291f},
-std::array<float,2>{0.820939779f, 0.419212162f},
-std::array<float,2>{0.533215463f, 0.621268034f},
-std::array<float,2>{0.183603734f, 0.0161948279f},
-std::array<float,2>{0.035620138f, 0.891612291f},
-std::array<float,2>{0.629778504f, 0.464003325f},
-std::array<float,2>{0.877852201f, 0.560226917f},
-std::array<float,2>{0.49170509f, 0.113897346f},
-std::array<float,2>{0.259627342f, 0.715931058f},
-std::array<float,2>{0.785486758f, 0.242101386f},
-std::array<float,2>{0.600569725f, 0.836915672f},
-std::array<float,2>{0.233132794f, 0.277837545f},
-std::array<float,2>{0.134760156f, 0.593036532f},
-std::array<float,2>{0.513406932f, 0.0616303086f},
-std::array<float,2>{0.853703737f, 0.947615445f},
-std::array<float,2>{0.364708275f, 0.378219962f},
-std::array<float,2>{0.377957731f, 0.794754863f},
-std::array<float,2>{0.985624194f, 0.369370878f},
-std::array<float,2>{0.726878643f, 0.631170869f},
-std::array<float,2>{0.0744098723f, 0.140898675f},
-std::array<float,2>{0.224904105f, 0.923660815f},
-std::array<float,2>{0.604124844f, 0.488285393f},
-std::array<float,2>{0.794007421f, 0.524346828f},
-std::array<float,2>{0.25662154f, 0.0883485004f},
-std::array<float,2>{0.498636872f, 0.739006162f},
-std::array<float,2>{0.884303331f, 0.1964733f},
-std::array<float,2>{0.637893558f, 0.86508137f},
-std::array<float,2>{0.0438351072f, 0.296988875f},
-std::array<float,2>{0.066591084f, 0.615999818f},
-std::array<float,2>{0.719025791f, 0.0286893267f},
-std::array<float,2>{0.995675147f, 0.99954474f},
-std::array<float,2>{0.38765797f, 0.41319859f},
-std::array<float,2>{0.371447682f, 0.759520531f},
-std::array<float,2>{0.844659388f, 0.323994368f},
-std::array<float,2>{0.504361093f, 0.657867432f},
-std::array<float,2>{0.126007497f, 0.18274352f},
-std::array<float,2>{0.0126761412f, 0.82815361f},
-std::array<float,2>{0.682549119f, 0.269614697f},
-std::array<float,2>{0.930785537f, 0.710898459f},
-std::array<float,2>{0.45940575f, 0.249294564f},
-std::array<float,2>{0.312461764f, 0.553285182f},
-std::array<float,2>{0.772343934f, 0.117296994f},
-std::array<float,2>{0.581843913f, 0.899041057f},
-std::array<float,2>{0.214275047f, 0.456430674f},
-std::array<float,2>{0.17726247f, 0.635240257f},
-std::array<float,2>{0.541195452f, 0.154130459f},
-std::array<float,2>{0.81627661f, 0.781809986f},
-std::array<float,2>{0.323300421f, 0.359587431f},
-std::array<float,2>{0.419978976f, 0.945284128f},
-std::array<float,2>{0.946899772f, 0.385327935f},
-std::array<float,2>{0.697427273f, 0.578855872f},
-std::array<float,2>{0.094779782f, 0.0475735292f},
-std::array<float,2>{0.145540565f, 0.79870522f},
-std::array<float,2>{0.52820611f, 0.35702011f},
-std::array<float,2>{0.862031996f, 0.644084454f},
-std::array<float,2>{0.344007641f, 0.131650656f},
-std::array<float,2>{0.406047642f, 0.562884271f},
-std::array<float,2>{0.969534695f, 0.0329567082f},
-std::array<float,2>{0.746440828f, 0.967708528f},
-std::array<float,2>{0.0921023786f, 0.398144066f},
-std::array<float,2>{0.04937144f, 0.694598079f},
-std::array<float,2>{0.641431153f, 0.232351065f},
-std::array<float,2>{0.895375729f, 0.817988992f},
-std::array<float,2>{0.482916445f, 0.26302737f},
-std::array<float,2>{0.27735278f, 0.878616691f},
-std::array<float,2>{0.799525499f, 0.440784335f},
-std::array<float,2>{0.622757196f, 0.540505648f},
-std::array<float,2>{0.237544626f, 0.100890294f},
-std::array<float,2>{0.11525517f, 0.977636516f},
-std::array<float,2>{0.715192318f, 0.425606519f},
-std::array<float,2>{0.967357397f, 0.607114017f},
-std::array<float,2>{0.423387796f, 0.0148211438f},
-std::array<float,2>{0.330918521f, 0.682911396f},
-std::array<float,2>{0.836453736f, 0.169765845f},
-std::array<float,2>{0.561848938f, 0.775348961f},
-std::array<float,2>{0.160031289f, 0.341843694f},
-std::array<float,2>{0.196957707f, 0.510400951f},
-std::array<float,2>{0.569065511f, 0.0658261552f},
-std::array<float,2>{0.759527326f, 0.920266747f},
-std::array<float,2>{0.293879777f, 0.476012617f},
-std::array<float,2>{0.438427746f, 0.856159151f},
-std::array<float,2>{0.908256948f, 0.292343676f},
-std::array<float,2>{0.657490313f, 0.731957078f},
-std::array<float,2>{0.0241134502f, 0.204213157f},
-std::array<float,2>{0.188617259f, 0.994439363f},
-std::array<float,2>{0.571034014f, 0.408110946f},
-std::array<float,2>{0.756692231f, 0.611763954f},
-std::array<float,2>{0.282767504f, 0.0249981675f},
-std::array<float,2>{0.445594132f, 0.662605166f},
-std::array<float,2>{0.915492356f, 0.184637368f},
-std::array<float,2>{0.666124761f, 0.761974216f},
-std::array<float,2>{0.0178527944f, 0.327478349f},
-std::array<float,2>{0.120979607f, 0.529539585f},
-std::array<float,2>{0.707803607f, 0.0931535214f},
-std::array<float,2>{0.954022765f, 0.92580986f},
-std::array<float,2>{0.436760187f, 0.487448573f},
-std::array<float,2>{0.343173325f, 0.862041056f},
-std::array<float,2>{0.834439516f, 0.30308798f},
-std::array<float,2>{0.553374588f, 0.734701514f},
-std::array<float,2>{0.165951803f, 0.200572014f},
-std::array<float,2>{0.0560347401f, 0.786300421f},
-std::array<float,2>{0.652139127f, 0.365590483f},
-std::array<float,2>{0.901872158f, 0.637508571f},
-std::array<float,2>{0.474184483f, 0.150143147f},
-std::array<float,2>{0.265943021f, 0.583151877f},
-std::array<float,2>{0.806701601f, 0.0544036105f},
-std::array<float,2>{0.611947298f, 0.938516796f},
-std::array<float,2>{0.245164871f, 0.387030035f},
-std::array<float,2>{0.154951259f, 0.705540597f},
-std::array<float,2>{0.519436598f, 0.242696777f},
-std::array<float,2>{0.867451727f, 0.83297348f},
-std::array<float,2>{0.352879435f, 0.268880099f},
-std::array<float,2>{0.394566715f, 0.903275669f},
-std::array<float,2>{0.98025012f, 0.457085431f},
-std::array<float,2>{0.73583585f, 0.549629271f},
-std::array<float,2>{0.0844217017f, 0.121962525f},
-std::array<float,2>{0.183068722f, 0.814940929f},
-std::array<float,2>{0.537378192f, 0.258693337f},
-std::array<float,2>{0.824314713f, 0.690309346f},
-std::array<float,2>{0.314943612f, 0.230409965f},
-std::array<float,2>{0.407982856f, 0.544810712f},
-std::array<float,2>{0.937666655f, 0.0939552858f},
-std::array<float,2>{0.68838352f, 0.879388034f},
-std::array<float,2>{0.103940055f, 0.445040166f},
-std::array<float,2>{0.00751989009f, 0.645550072f},
-std::array<float,2>{0.67761153f, 0.128877491f},
-std::array<float,2>{0.928503692f, 0.8043347f},
-std::array<float,2>{0.463132262f, 0.351845711f},
-std::array<float,2>{0.304344237f, 0.963601768f},
-std::array<float,2>{0.776480317f, 0.391833246f},
-std::array<float,2>{0.590712905f, 0.569479048f},
-std::array<float,2>{0.203350708f, 0.0356435105f},
-std::array<float,2>{0.0708710104f, 0.914687812f},
-std::array<float,2>{0.733214319f, 0.469246864f},
-std::array<float,2>{0.991054177f, 0.513132453f},
-std::array<float,2>{0.379795492f, 0.0669587329f},
-std::array<float,2>{0.362962008f, 0.728601098f},
-std::array<float,2>{0.855937421f, 0.209563524f},
-std::array<float,2>{0.511118412f, 0.854937255f},
-std::array<float,2>{0.139224157f, 0.294863701f},
-std::array<float,2>{0.22673139f, 0.604189634f},
-std::array<float,2>{0.59693259f, 0.0089278454f},
-std::array<float,2>{0.784124076f, 0.983838856f},
-std::array<float,2>{0.26188001f, 0.427562535f},
-std::array<float,2>{0.486115694f, 0.780682027f},
-std::array<float,2>{0.881547332f, 0.338121563f},
-std::array<float,2>{0.62710613f, 0.683612585f},
-std::array<float,2>{0.0318447128f, 0.167344213f},
-std::array<float,2>{0.130115792f, 0.887880385f},
-std::array<float,2>{0.500605762f, 0.450503409f},
-std::array<float,2>{0.850219786f, 0.531682372f},
-std::array<float,2>{0.370742887f, 0.109364688f},
-std::array<float,2>{0.386026829f, 0.701435447f},
-std::array<float,2>{0.999981999f, 0.221364975f},
-std::array<float,2>{0.725718498f, 0.82138747f},
-std::array<float,2>{0.0660462826f, 0.251179129f},
-std::array<float,2>{0.0406932756f, 0.570361733f},
-std::array<float,2>{0.632989228f, 0.0431429036f},
-std::array<float,2>{0.88698411f, 0.953630328f},
-std::array<float,2>{0.49353379f, 0.39947179f},
-std::array<float,2>{0.250745714f, 0.807006657f},
-std::array<float,2>{0.791224241f, 0.349901766f},
-std::array<float,2>{0.608408689f, 0.65260154f},
-std::array<float,2>{0.221831441f, 0.133712813f},
-std::array<float,2>{0.0993318856f, 0.846264184f},
-std::array<float,2>{0.700674951f, 0.288139045f},
-std::array<float,2>{0.951420009f, 0.724713624f},
-std::array<float,2>{0.41743356f, 0.215105101f},
-std::array<float,2>{0.326587319f, 0.501447082f},
-std::array<float,2>{0.818856299f, 0.072563298f},
-std::array<float,2>{0.545251429f, 0.910414398f},
-std::array<float,2>{0.174305022f, 0.478218585f},
-std::array<float,2>{0.21645695f, 0.677433372f},
-std::array<float,2>{0.58515507f, 0.156279862f},
-std::array<float,2>{0.767509282f, 0.769797623f},
-std::array<float,2>{0.308140874f, 0.334871441f},
-std::array<float,2>{0.45612812f, 0.969560444f},
-std::array<float,2>{0.934526205f, 0.433976024f},
-std::array<float,2>{0.684338331f, 0.597688496f},
-std::array<float,2>{0.00866190065f, 0.00439484231f},
-std::array<float,2>{0.239420623f, 0.756480515f},
-std::array<float,2>{0.619796574f, 0.314723581f},
-std::array<float,2>{0.803338528f, 0.665985644f},
-std::array<float,2>{0.274000466f, 0.172313362f},
-std::array<float,2>{0.476592988f, 0.620598972f},
-std::array<float,2>{0.890957773f, 0.0230420716f},
-std::array<float,2>{0.647423148f, 0.98987633f},
-std::array<float,2>{0.0526462123f, 0.41697067f},
-std::array<float,2>{0.0872295797f, 0.745743692f},
-std::array<float,2>{0.743346035f, 0.192438304f},
-std::array<float,2>{0.976478815f, 0.869568229f},
-std::array<float,2>{0.401215404f, 0.309994787f},
-std::array<float,2>{0.35141331f, 0.933444381f},
-std::array<float,2>{0.866093934f, 0.49512735f},
-std::array<float,2>{0.524275005f, 0.520651162f},
-std::array<float,2>{0.141463399f, 0.0827178955f},
-std::array<float,2>{0.0304076318f, 0.952090323f},
-std::array<float,2>{0.661803067f, 0.379193276f},
-std::array<float,2>{0.910656035f, 0.587990284f},
-std::array<float,2>{0.443138778f, 0.057457149f},
-std::array<float,2>{0.291124493f, 0.628794432f},
-std::array<float,2>{0.76350683f, 0.148053974f},
-std::array<float,2>{0.56383121f, 0.791522503f},
-std::array<float,2>{0.202874795f, 0.374946654f},
-std::array<float,2>{0.162917584f, 0.555000067f},
-std::array<float,2>{0.55584991f, 0.11206682f},
-std::array<float,2>{0.840717614f, 0.897462964f},
-std::array<float,2>{0.332879841f, 0.468581319f},
-std::array<float,2>{0.427765936f, 0.84255141f},
-std::array<float,2>{0.962525129f, 0.275455475f},
-std::array<float,2>{0.714687705f, 0.712846518f},
-std::array<float,2>{0.111722976f, 0.236769125f},
-std::array<float,2>{0.135245219f, 0.948782861f},
-std::array<float,2>{0.513998926f, 0.37755546f},
-std::array<float,2>{0.853307486f, 0.592023551f},
-std::array<float,2>{0.366484404f, 0.0610058643f},
-std::array<float,2>{0.375415623f, 0.632279754f},
-std::array<float,2>{0.987266362f, 0.142196506f},
-std::array<float,2>{0.729290962f, 0.793866158f},
-std::array<float,2>{0.0780463666f, 0.370312184f},
-std::array<float,2>{0.0373727791f, 0.559453309f},
-std::array<float,2>{0.632811189f, 0.114336789f},
-std::array<float,2>{0.876525581f, 0.891166925f},
-std::array<float,2>{0.489420503f, 0.463724256f},
-std::array<float,2>{0.260756463f, 0.835968673f},
-std::array<float,2>{0.788744986f, 0.278798431f},
-std::array<float,2>{0.598255277f, 0.715252519f},
-std::array<float,2>{0.230804905f, 0.241039589f},
-std::array<float,2>{0.107929356f, 0.752867162f},
-std::array<float,2>{0.692759752f, 0.317782789f},
-std::array<float,2>{0.943243861f, 0.668956041f},
-std::array<float,2>{0.412099004f, 0.177137569f},
-std::array<float,2>{0.31738025f, 0.622961164f},
-std::array<float,2>{0.822618783f, 0.0168527346f},
-std::array<float,2>{0.531696618f, 0.985720813f},
-std::array<float,2>{0.186160848f, 0.418352544f},
-std::array<float,2>{0.208718672f, 0.749659956f},
-std::array<float,2>{0.58853507f, 0.190657437f},
-std::array<float,2>{0.779846787f, 0.873822451f},
-std::array<float,2>{0.297867984f, 0.308168948f},
-std::array<float,2>{0.464914143f, 0.935745418f},
-std::array<float,2>{0.923757911f, 0.499880463f},
-std::array<float,2>{0.675367236f, 0.516413271f},
-std::array<float,2>{0.00168203586f, 0.0810686946f},
-std::array<float,2>{0.24939613f, 0.848053336f},
-std::array<float,2>{0.614977658f, 0.284830689f},
-std::array<float,2>{0.810539305f, 0.721530616f},
-std::array<float,2>{0.269654363f, 0.214278802f},
-std::array<float,2>{0.469967455f, 0.505461216f},
-std::array<float,2>{0.903555512f, 0.0768697262f},
-std::array<float,2>{0.653456688f, 0.908073962f},
-std::array<float,2>{0.0606716238f, 0.483410954f},
-std::array<float,2>{0.0818741322f, 0.67252171f},
-std::array<float,2>{0.741881669f, 0.163307816f},
-std::array<float,2>{0.982724845f, 0.766043127f},
-std::array<float,2>{0.390857756f, 0.329289585f},
-std::array<float,2>{0.357448518f, 0.974473298f},
-std::array<float,2>{0.874599218f, 0.432725132f},
-std::array<float,2>{0.523249865f, 0.595215917f},
-std::array<float,2>{0.152224749f, 0.00172823132f},
-std::array<float,2>{0.0208813734f, 0.884906709f},
-std::array<float,2>{0.670255482f, 0.448399156f},
-std::array<float,2>{0.92175895f, 0.535501182f},
-std::array<float,2>{0.451678514f, 0.104924597f},
-std::array<float,2>{0.288979739f, 0.697408617f},
-std::array<float,2>{0.751308441f, 0.223979831f},
-std::array<float,2>{0.575269163f, 0.827120543f},
-std::array<float,2>{0.195085928f, 0.254924566f},
-std::array<float,2>{0.170429841f, 0.57773149f},
-std::array<float,2>{0.549765825f, 0.0409529619f},
-std::array<float,2>{0.82925123f, 0.957077026f},
-std::array<float,2>{0.33672893f, 0.405438274f},
-std::array<float,2>{0.431623042f, 0.810305774f},
-std::array<float,2>{0.95780766f, 0.345887482f},
-std::array<float,2>{0.703937531f, 0.652291059f},
-std::array<float,2>{0.12275818f, 0.140013725f},
-std::array<float,2>{0.198582873f, 0.921338916f},
-std::array<float,2>{0.568182409f, 0.474784166f},
-std::array<float,2>{0.761160016f, 0.511221468f},
-std::array<float,2>{0.295925528f, 0.0653488785f},
-std::array<float,2>{0.439652771f, 0.731081367f},
-std::array<float,2>{0.906351149f, 0.20406945f},
-std::array<float,2>{0.658912122f, 0.85668993f},
-std::array<float,2>{0.0258706026f, 0.291183442f},
-std::array<float,2>{0.115218177f, 0.606283486f},
-std::array<float,2>{0.717376173f, 0.0145023586f},
-std::array<float,2>{0.965237021f, 0.976638973f},
-std::array<float,2>{0.425607473f, 0.42385307f},
-std::array<float,2>{0.329960227f, 0.77366668f},
-std::array<float,2>{0.839659452f, 0.343644232f},
-std::array<float,2>{0.560188293f, 0.681818426f},
-std::array<float,2>{0.158124298f, 0.168063596f},
-std::array<float,2>{0.048213765f, 0.81681633f},
-std::array<float,2>{0.642675698f, 0.262648195f},
-std::array<float,2>{0.896610439f, 0.693630278f},
-std::array<float,2>{0.482171744f, 0.230767146f},
-std::array<float,2>{0.280765295f, 0.539462388f},
-std::array<float,2>{0.798118532f, 0.100090168f},
-std::array<float,2>{0.624357641f, 0.877624452f},
-std::array<float,2>{0.234965503f, 0.439753294f},
-std::array<float,2>{0.148123696f, 0.64349997f},
-std::array<float,2>{0.530231595f, 0.132520661f},
-std::array<float,2>{0.859398365f, 0.797132194f},
-std::array<float,2>{0.347580671f, 0.355952442f},
-std::array<float,2>{0.403103918f, 0.968543351f},
-std::array<float,2>{0.972255111f, 0.396850228f},
-std::array<float,2>{0.748093128f, 0.563702166f},
-std::array<float,2>{0.0909013748f, 0.0321832187f},
-std::array<float,2>{0.179049715f, 0.782913029f},
-std::array<float,2>{0.540784895f, 0.360477686f},
-std::array<float,2>{0.813106596f, 0.636075497f},
-std::array<float,2>{0.322078943f, 0.152639002f},
-std::array<float,2>{0.418339103f, 0.579910576f},
-std::array<float,2>{0.94789207f, 0.0482207835f},
-std::array<float,2>{0.695517659f, 0.944102407f},
-std::array<float,2>{0.0970566645f, 0.386091679f},
-std::array<float,2>{0.0152793927f, 0.709533393f},
-std::array<float,2>{0.680774152f, 0.248434752f},
-std::array<float,2>{0.932857037f, 0.829776704f},
-std::array<float,2>{0.458547443f, 0.270862311f},
-std::array<float,2>{0.310353041f, 0.900157273f},
-std::array<float,2>{0.769680917f, 0.455295712f},
-std::array<float,2>{0.578929484f, 0.554422498f},
-std::array<float,2>{0.211240947f, 0.118635692f},
-std::array<float,2>{0.069862552f, 0.998240948f},
-std::array<float,2>{0.721325219f, 0.412798166f},
-std::array<float,2>{0.99379766f, 0.617041349f},
-std::array<float,2>{0.389276713f, 0.0278770775f},
-std::array<float,2>{0.374661952f, 0.656589985f},
-std::array<float,2>{0.847112f, 0.182155475f},
-std::array<float,2>{0.505946934f, 0.75785929f},
-std::array<float,2>{0.127390191f, 0.32240662f},
-std::array<float,2>{0.223386928f, 0.525092006f},
-std::array<float,2>{0.601682186f, 0.0890407115f},
-std::array<float,2>{0.796280801f, 0.92241329f},
-std::array<float,2>{0.255104542f, 0.489455998f},
-std::array<float,2>{0.497413486f, 0.863610387f},
-std::array<float,2>{0.885008395f, 0.297962755f},
-std::array<float,2>{0.640034616f, 0.739859879f},
-std::array<float,2>{0.0462445132f, 0.195746645f},
-std::array<float,2>{0.229340687f, 0.982626438f},
-std::array<float,2>{0.594749451f, 0.426605761f},
-std::array<float,2>{0.781465232f, 0.605064571f},
-std::array<float,2>{0.264181167f, 0.00839614309f},
-std::array<float,2>{0.487957746f, 0.684934556f},
-std::array<float,2>{0.87896502f, 0.166436777f},
-std::array<float,2>{0.625549972f, 0.780247688f},
-std::array<float,2>{0.033695519f, 0.339716911f},
-std::array<float,2>{0.072796315f, 0.512462735f},
-std::array<float,2>{0.732352138f, 0.0681111589f},
-std::array<float,2>{0.989934444f, 0.915150702f},
-std::array<float,2>{0.381307125f, 0.470607042f},
-std::array<float,2>{0.360165417f, 0.854451597f},
-std::array<float,2>{0.858216166f, 0.293186933f},
-std::array<float,2>{0.508283675f, 0.729632735f},
-std::array<float,2>{0.138025418f, 0.210372359f},
-std::array<float,2>{0.00577789266f, 0.803080142f},
-std::array<float,2>{0.678268313f, 0.35281074f},
-std::array<float,2>{0.927505434f, 0.645207167f},
-std::array<float,2>{0.461763114f, 0.126977921f},
-std::array<float,2>{0.301496476f, 0.568493187f},
-std::array<float,2>{0.773924887f, 0.0364542603f},
-std::array<float,2>{0.59283936f, 0.964692116f},
-std::array<float,2>{0.206824929f, 0.391425341f},
-std::array<float,2>{0.180283353f, 0.690636039f},
-std::array<float,2>{0.536206722f, 0.229286447f},
-std::array<float,2>{0.826633573f, 0.815826833f},
-std::array<float,2>{0.313140243f, 0.258914381f},
-std::array<float,2>{0.409047067f, 0.880028486f},
-std::array<float,2>{0.941156209f, 0.444020122f},
-std::array<float,2>{0.690187097f, 0.543243408f},
-std::array<float,2>{0.103087686f, 0.0950044021f},
-std::array<float,2>{0.152485713f, 0.833912492f},
-std::array<float,2>{0.516484499f, 0.26781565f},
-std::array<float,2>{0.870642245f, 0.706116557f},
-std::array<float,2>{0.355384409f, 0.243711859f},
-std::array<float,2>{0.397941291f, 0.55077076f},
-std::array<float,2>{0.978224456f, 0.122113049f},
-std::array<float,2>{0.737465262f, 0.903421581f},
-std::array<float,2>{0.0833020881f, 0.458173037f},
-std::array<float,2>{0.0574130304f, 0.638205945f},
-std::array<float,2>{0.648595631f, 0.148618355f},
-std::array<float,2>{0.900345445f, 0.785729349f},
-std::array<float,2>{0.476410717f, 0.366655886f},
-std::array<float,2>{0.268975317f, 0.93763119f},
-std::array<float,2>{0.805986941f, 0.3880108f},
-std::array<float,2>{0.611305892f, 0.582369208f},
-std::array<float,2>{0.24404484f, 0.0527347438f},
-std::array<float,2>{0.11752221f, 0.927550137f},
-std::array<float,2>{0.709732831f, 0.486747146f},
-std::array<float,2>{0.956562221f, 0.531213701f},
-std::array<float,2>{0.433985561f, 0.0921366289f},
-std::array<float,2>{0.339948177f, 0.735458791f},
-std::array<float,2>{0.832784832f, 0.199240446f},
-std::array<float,2>{0.550904691f, 0.863106012f},
-std::array<float,2>{0.166256681f, 0.304551333f},
-std::array<float,2>{0.189883441f, 0.612759113f},
-std::array<float,2>{0.572700322f, 0.0234610885f},
-std::array<float,2>{0.75505358f, 0.995745182f},
-std::array<float,2>{0.284050941f, 0.406825244f},
-std::array<float,2>{0.44909656f, 0.7629143f},
-std::array<float,2>{0.917551696f, 0.326406032f},
-std::array<float,2>{0.6650635f, 0.663336813f},
-std::array<float,2>{0.0162916463f, 0.184136882f},
-std::array<float,2>{0.160846487f, 0.896925569f},
-std::array<float,2>{0.557192743f, 0.467593163f},
-std::array<float,2>{0.842934906f, 0.556544065f},
-std::array<float,2>{0.33454138f, 0.112784728f},
-std::array<float,2>{0.426042885f, 0.711704433f},
-std::array<float,2>{0.963007092f, 0.238056719f},
-std::array<float,2>{0.712235868f, 0.843635798f},
-std::array<float,2>{0.111038409f, 0.276781023f},
-std::array<float,2>{0.0277302191f, 0.589343607f},
-std::array<float,2>{0.663590908f, 0.0578315482f},
-std::array<float,2>{0.912221313f, 0.952741206f},
-std::array<float,2>{0.445017278f, 0.380352825f},
-std::array<float,2>{0.291012436f, 0.792582214f},
-std::array<float,2>{0.765336454f, 0.373729467f},
-std::array<float,2>{0.565493762f, 0.626964927f},
-std::array<float,2>{0.200266764f, 0.147356749f},
-std::array<float,2>{0.0893538669f, 0.870294154f},
-std::array<float,2>{0.745764673f, 0.308615655f},
-std::array<float,2>{0.972913265f, 0.744565129f},
-std::array<float,2>{0.398896188f, 0.191564307f},
-std::array<float,2>{0.348433822f, 0.520047605f},
-std::array<float,2>{0.863894701f, 0.0836762488f},
-std::array<float,2>{0.525786579f, 0.931846499f},
-std::array<float,2>{0.142741323f, 0.49492389f},
-std::array<float,2>{0.241985664f, 0.664230227f},
-std::array<float,2>{0.61734283f, 0.173700988f},
-std::array<float,2>{0.802402675f, 0.757511139f},
-std::array<float,2>{0.276950687f, 0.315735042f},
-std::array<float,2>{0.480305463f, 0.989239335f},
-std::array<float,2>{0.89315927f, 0.417272866f},
-std::array<float,2>{0.645221949f, 0.619969726f},
-std::array<float,2>{0.0546449907f, 0.0215497166f},
-std::array<float,2>{0.217585877f, 0.770820737f},
-std::array<float,2>{0.582214475f, 0.335511267f},
-std::array<float,2>{0.768936932f, 0.676344693f},
-std::array<float,2>{0.30630827f, 0.158051535f},
-std::array<float,2>{0.454895645f, 0.598685086f},
-std::array<float,2>{0.936421812f, 0.00559980329f},
-std::array<float,2>{0.686470211f, 0.97022146f},
-std::array<float,2>{0.0103250016f, 0.435388923f},
-std::array<float,2>{0.101159595f, 0.726389468f},
-std::array<float,2>{0.70219034f, 0.216263533f},
-std::array<float,2>{0.950940311f, 0.847028494f},
-std::array<float,2>{0.415951818f, 0.287339479f},
-std::array<float,2>{0.325227112f, 0.911917686f},
-std::array<float,2>{0.816777468f, 0.477071524f},
-std::array<float,2>{0.543258786f, 0.500949383f},
-std::array<float,2>{0.172983602f, 0.0737379417f},
-std::array<float,2>{0.0428877696f, 0.954293191f},
-std::array<float,2>{0.635227442f, 0.399367571f},
-std::array<float,2>{0.88906306f, 0.571992636f},
-std::array<float,2>{0.495088786f, 0.0447264947f},
-std::array<float,2>{0.252384156f, 0.653948188f},
-std::array<float,2>{0.789349675f, 0.134269297f},
-std::array<float,2>{0.606896162f, 0.808389306f},
-std::array<float,2>{0.21968852f, 0.351484239f},
-std::array<float,2>{0.132333368f, 0.532356739f},
-std::array<float,2>{0.503125787f, 0.108015135f},
-std::array<float,2>{0.848900676f, 0.887109637f},
-std::array<float,2>{0.369106144f, 0.450026095f},
-std::array<float,2>{0.38335982f, 0.821057677f},
-std::array<float,2>{0.996710002f, 0.250590175f},
-std::array<float,2>{0.723939836f, 0.702831388f},
-std::array<float,2>{0.0641523674f, 0.222053304f},
-std::array<float,2>{0.184750557f, 0.986712992f},
-std::array<float,2>{0.534456074f, 0.421497792f},
-std::array<float,2>{0.821340501f, 0.624868631f},
-std::array<float,2>{0.319608659f, 0.0180172976f},
-std::array<float,2>{0.413476765f, 0.670913875f},
-std::array<float,2>{0.943363369f, 0.178495035f},
-std::array<float,2>{0.694283187f, 0.750381172f},
-std::array<float,2>{0.106454223f, 0.320078552f},
-std::array<float,2>{0.00380482827f, 0.518514574f},
-std::array<float,2>{0.673616588f, 0.0783601552f},
-std::array<float,2>{0.924181342f, 0.933640718f},
-std::array<float,2>{0.467951268f, 0.497946203f},
-std::array<float,2>{0.299210429f, 0.872073174f},
-std::array<float,2>{0.779159427f, 0.306562066f},
-std::array<float,2>{0.587384284f, 0.746605098f},
-std::array<float,2>{0.210011899f, 0.188374504f},
-std::array<float,2>{0.0757076591f, 0.796605527f},
-std::array<float,2>{0.727932036f, 0.368403733f},
-std::array<float,2>{0.984474003f, 0.629754841f},
-std::array<float,2>{0.377127022f, 0.143006504f},
-std::array<float,2>{0.363771975f, 0.589888215f},
-std::array<float,2>{0.854889572f, 0.0602024309f},
-std::array<float,2>{0.512694299f, 0.945424139f},
-std::array<float,2>{0.133734345f, 0.376285315f},
-std::array<float,2>{0.233917892f, 0.718692303f},
-std::array<float,2>{0.600822926f, 0.238898918f},
-std::array<float,2>{0.786438823f, 0.839200616f},
-std::array<float,2>{0.258515835f, 0.280931175f},
-std::array<float,2>{0.490609586f, 0.893593311f},
-std::array<float,2>{0.877969027f, 0.461787164f},
-std::array<float,2>{0.63006109f, 0.56228292f},
-std::array<float,2>{0.0362294652f, 0.11630547f},
-std::array<float,2>{0.192983866f, 0.825951517f},
-std::array<float,2>{0.577298939f, 0.255885303f},
-std::array<float,2>{0.753261149f, 0.695345759f},
-std::array<float,2>{0.286592782f, 0.224909037f},
-std::array<float,2>{0.450037807f, 0.537961483f},
-std::array<float,2>{0.918219984f, 0.102581576f},
-std::array<float,2>{0.668153226f, 0.884411633f},
-std::array<float,2>{0.0222878512f, 0.446834236f},
-std::array<float,2>{0.124861792f, 0.648830235f},
-std::array<float,2>{0.706000984f, 0.137469769f},
-std::array<float,2>{0.959973931f, 0.811924636f},
-std::array<float,2>{0.432389259f, 0.345663011f},
-std::array<float,2>{0.339316666f, 0.960274935f},
-std::array<float,2>{0.830133915f, 0.403123558f},
-std::array<float,2>{0.548298061f, 0.575751841f},
-std::array<float,2>{0.169763923f, 0.0417399146f},
-std::array<float,2>{0.0602007583f, 0.908212304f},
-std::array<float,2>{0.655940711f, 0.4810265f},
-std::array<float,2>{0.904913127f, 0.507515728f},
-std::array<float,2>{0.471389383f, 0.0755208731f},
-std::array<float,2>{0.273242116f, 0.719722271f},
-std::array<float,2>{0.811801493f, 0.212801322f},
-std::array<float,2>{0.616178751f, 0.851496398f},
-std::array<float,2>{0.24673447f, 0.281411558f},
-std::array<float,2>{0.148603395f, 0.59590745f},
-std::array<float,2>{0.521229565f, 0.00277701044f},
-std::array<float,2>{0.872055352f, 0.975588143f},
-std::array<float,2>{0.357404858f, 0.431308478f},
-std::array<float,2>{0.394494295f, 0.769100487f},
-std::array<float,2>{0.982420444f, 0.331061661f},
-std::array<float,2>{0.739810169f, 0.675678611f},
-std::array<float,2>{0.0783090591f, 0.161952704f},
-std::array<float,2>{0.236534074f, 0.876581311f},
-std::array<float,2>{0.621612966f, 0.439073771f},
-std::array<float,2>{0.79986316f, 0.542898178f},
-std::array<float,2>{0.27889502f, 0.0985349044f},
-std::array<float,2>{0.483712554f, 0.692818522f},
-std::array<float,2>{0.89637804f, 0.233820677f},
-std::array<float,2>{0.642036974f, 0.818526506f},
-std::array<float,2>{0.0501803905f, 0.265508384f},
-std::array<float,2>{0.0927829072f, 0.56566304f},
-std::array<float,2>{0.747404575f, 0.0332859196f},
-std::array<float,2>{0.969885051f, 0.965703607f},
-std::array<float,2>{0.404431999f, 0.395405442f},
-std::array<float,2>{0.345349669f, 0.800098419f},
-std::array<float,2>{0.862666428f, 0.357860506f},
-std::array<float,2>{0.528966665f, 0.641748905f},
-std::array<float,2>{0.145164937f, 0.130432874f},
-std::array<float,2>{0.0253316406f, 0.858651638f},
-std::array<float,2>{0.656559646f, 0.290078044f},
-std::array<float,2>{0.90943253f, 0.733677447f},
-std::array<float,2>{0.439056247f, 0.206330493f},
-std::array<float,2>{0.29434073f, 0.508647442f},
-std::array<float,2>{0.758702755f, 0.0633827597f},
-std::array<float,2>{0.569745362f, 0.919392347f},
-std::array<float,2>{0.196255475f, 0.472836852f},
-std::array<float,2>{0.158241153f, 0.680045426f},
-std::array<float,2>{0.560730219f, 0.170744926f},
-std::array<float,2>{0.837236762f, 0.776565492f},
-std::array<float,2>{0.331420094f, 0.341519862f},
-std::array<float,2>{0.422663838f, 0.97955066f},
-std::array<float,2>{0.968016505f, 0.42306f},
-std::array<float,2>{0.716699541f, 0.608850658f},
-std::array<float,2>{0.116767146f, 0.012780495f},
-std::array<float,2>{0.125114694f, 0.760279953f},
-std::array<float,2>{0.505449295f, 0.320528507f},
-std::array<float,2>{0.844986737f, 0.658943832f},
-std::array<float,2>{0.37286967f, 0.179854631f},
-std::array<float,2>{0.388640493f, 0.614987791f},
-std::array<float,2>{0.995034993f, 0.0310730021f},
-std::array<float,2>{0.71984005f, 0.997306585f},
-std::array<float,2>{0.0678948238f, 0.411284029f},
-std::array<float,2>{0.0442303121f, 0.741222858f},
-std::array<float,2>{0.636738002f, 0.198529914f},
-std::array<float,2>{0.882826865f, 0.866025329f},
-std::array<float,2>{0.499301404f, 0.300567001f},
-std::array<float,2>{0.257005244f, 0.923914433f},
-std::array<float,2>{0.793410659f, 0.490759045f},
-std::array<float,2>{0.604627192f, 0.525502086f},
-std::array<float,2>{0.225839272f, 0.0875153318f},
-std::array<float,2>{0.093777746f, 0.942213833f},
-std::array<float,2>{0.699158013f, 0.383989364f},
-std::array<float,2>{0.946285069f, 0.58021909f},
-std::array<float,2>{0.42148605f, 0.0502872579f},
-std::array<float,2>{0.322481871f, 0.632944703f},
-std::array<float,2>{0.815285921f, 0.155498236f},
-std::array<float,2>{0.542603254f, 0.783332527f},
-std::array<float,2>{0.176403418f, 0.361494333f},
-std::array<float,2>{0.213850096f, 0.551721931f},
-std::array<float,2>{0.580992043f, 0.119445957f},
-std::array<float,2>{0.773251474f, 0.900756001f},
-std::array<float,2>{0.310672909f, 0.454302996f},
-std::array<float,2>{0.460520655f, 0.831453979f},
-std::array<float,2>{0.929724872f, 0.271931499f},
-std::array<float,2>{0.683431625f, 0.70750922f},
-std::array<float,2>{0.0131367994f, 0.246590167f},
-std::array<float,2>{0.204851642f, 0.962234318f},
-std::array<float,2>{0.59153527f, 0.392673254f},
-std::array<float,2>{0.775763154f, 0.56758666f},
-std::array<float,2>{0.302956283f, 0.0389879644f},
-std::array<float,2>{0.464576155f, 0.647983491f},
-std::array<float,2>{0.928923905f, 0.126140714f},
-std::array<float,2>{0.676594973f, 0.801848054f},
-std::array<float,2>{0.00621947832f, 0.354305297f},
-std::array<float,2>{0.105062865f, 0.545641124f},
-std::array<float,2>{0.689215839f, 0.0959695578f},
-std::array<float,2>{0.939281344f, 0.882080913f},
-std::array<float,2>{0.406804442f, 0.442780823f},
-std::array<float,2>{0.315952539f, 0.813387692f},
-std::array<float,2>{0.82528013f, 0.259839565f},
-std::array<float,2>{0.538764119f, 0.689360499f},
-std::array<float,2>{0.181887686f, 0.22750324f},
-std::array<float,2>{0.0325893275f, 0.778893948f},
-std::array<float,2>{0.628263652f, 0.336329311f},
-std::array<float,2>{0.882411957f, 0.68728286f},
-std::array<float,2>{0.484386206f, 0.165394336f},
-std::array<float,2>{0.262834072f, 0.602985561f},
-std::array<float,2>{0.784380198f, 0.0116492156f},
-std::array<float,2>{0.596011698f, 0.981417239f},
-std::array<float,2>{0.228050321f, 0.42883414f},
-std::array<float,2>{0.139747784f, 0.727895319f},
-std::array<float,2>{0.510042787f, 0.20854789f},
-std::array<float,2>{0.857130885f, 0.852459133f},
-std::array<float,2>{0.361619383f, 0.296458244f},
-std::array<float,2>{0.380582035f, 0.916300654f},
-std::array<float,2>{0.991619408f, 0.471929461f},
-std::array<float,2>{0.733726799f, 0.515389204f},
-std::array<float,2>{0.0721784607f, 0.0699564442f},
-std::array<float,2>{0.164403975f, 0.859674335f},
-std::array<float,2>{0.553717196f, 0.302411616f},
-std::array<float,2>{0.835915744f, 0.736633301f},
-std::array<float,2>{0.342340857f, 0.20202665f},
-std::array<float,2>{0.436135828f, 0.528472185f},
-std::array<float,2>{0.954691529f, 0.0899472982f},
-std::array<float,2>{0.708362877f, 0.928793848f},
-std::array<float,2>{0.119568378f, 0.485884458f},
-std::array<float,2>{0.0189671759f, 0.661938965f},
-std::array<float,2>{0.667627037f, 0.185859099f},
-std::array<float,2>{0.914749742f, 0.765324175f},
-std::array<float,2>{0.446475297f, 0.325929463f},
-std::array<float,2>{0.281644046f, 0.993912995f},
-std::array<float,2>{0.757053852f, 0.41002357f},
-std::array<float,2>{0.571503043f, 0.609792888f},
-std::array<float,2>{0.188367233f, 0.0259860288f},
-std::array<float,2>{0.0857301801f, 0.905722678f},
-std::array<float,2>{0.734855235f, 0.459067106f},
-std::array<float,2>{0.979290009f, 0.548312724f},
-std::array<float,2>{0.395540148f, 0.124750473f},
-std::array<float,2>{0.351828426f, 0.704252899f},
-std::array<float,2>{0.868527293f, 0.245812804f},
-std::array<float,2>{0.517984688f, 0.834504902f},
-std::array<float,2>{0.155492932f, 0.265627682f},
-std::array<float,2>{0.244370759f, 0.585358739f},
-std::array<float,2>{0.612314045f, 0.0521443263f},
-std::array<float,2>{0.807713985f, 0.94121033f},
-std::array<float,2>{0.266609013f, 0.388769925f},
-std::array<float,2>{0.473201364f, 0.788084149f},
-std::array<float,2>{0.90079844f, 0.363353282f},
-std::array<float,2>{0.65128088f, 0.638834417f},
-std::array<float,2>{0.0552788824f, 0.152208433f},
-std::array<float,2>{0.142470419f, 0.93008703f},
-std::array<float,2>{0.525031924f, 0.492318958f},
-std::array<float,2>{0.866347551f, 0.522283852f},
-std::array<float,2>{0.350340903f, 0.0846592635f},
-std::array<float,2>{0.402222365f, 0.743229032f},
-std::array<float,2>{0.975170732f, 0.194783896f},
-std::array<float,2>{0.7426126f, 0.868356705f},
-std::array<float,2>{0.0865523964f, 0.312123954f},
-std::array<float,2>{0.0510538407f, 0.617740512f},
-std::array<float,2>{0.648080468f, 0.0207673833f},
-std::array<float,2>{0.891951442f, 0.99109602f},
-std::array<float,2>{0.478344113f, 0.415885776f},
-std::array<float,2>{0.275376409f, 0.755221307f},
-std::array<float,2>{0.804637074f, 0.312869847f},
-std::array<float,2>{0.620295525f, 0.667209446f},
-std::array<float,2>{0.2387238f, 0.174423113f},
-std::array<float,2>{0.112724558f, 0.841288686f},
-std::array<float,2>{0.713671863f, 0.274128675f},
-std::array<float,2>{0.961562037f, 0.71383965f},
-std::array<float,2>{0.429255575f, 0.23549971f},
-std::array<float,2>{0.333669782f, 0.557612836f},
-std::array<float,2>{0.841161668f, 0.109861396f},
-std::array<float,2>{0.555177808f, 0.894846022f},
-std::array<float,2>{0.16400148f, 0.465861976f},
-std::array<float,2>{0.201374516f, 0.62661165f},
-std::array<float,2>{0.562749445f, 0.144716591f},
-std::array<float,2>{0.761796296f, 0.790701985f},
-std::array<float,2>{0.292027116f, 0.372920394f},
-std::array<float,2>{0.442305595f, 0.949604452f},
-std::array<float,2>{0.911245644f, 0.382653207f},
-std::array<float,2>{0.660813689f, 0.586093843f},
-std::array<float,2>{0.0298216157f, 0.0551702641f},
-std::array<float,2>{0.221010029f, 0.805505157f},
-std::array<float,2>{0.607726455f, 0.348834097f},
-std::array<float,2>{0.792294919f, 0.655730069f},
-std::array<float,2>{0.25118947f, 0.135781944f},
-std::array<float,2>{0.492471904f, 0.572463334f},
-std::array<float,2>{0.887968659f, 0.0459232405f},
-std::array<float,2>{0.634740591f, 0.95508498f},
-std::array<float,2>{0.039244201f, 0.401487201f},
-std::array<float,2>{0.0652847439f, 0.699328125f},
-std::array<float,2>{0.725271404f, 0.219839275f},
-std::array<float,2>{0.998796046f, 0.822853863f},
-std::array<float,2>{0.385032207f, 0.252394259f},
-std::array<float,2>{0.369307399f, 0.888990939f},
-std::array<float,2>{0.850907087f, 0.452035099f},
-std::array<float,2>{0.501227856f, 0.533733368f},
-std::array<float,2>{0.129333496f, 0.105592154f},
-std::array<float,2>{0.00884245336f, 0.970942438f},
-std::array<float,2>{0.685125828f, 0.437363595f},
-std::array<float,2>{0.934986889f, 0.600943983f},
-std::array<float,2>{0.45592618f, 0.00779494364f},
-std::array<float,2>{0.306681812f, 0.67792803f},
-std::array<float,2>{0.765954614f, 0.159546524f},
-std::array<float,2>{0.584179103f, 0.773050547f},
-std::array<float,2>{0.21487765f, 0.332859963f},
-std::array<float,2>{0.174984798f, 0.502444983f},
-std::array<float,2>{0.546682477f, 0.0721906424f},
-std::array<float,2>{0.819900751f, 0.912579417f},
-std::array<float,2>{0.327658057f, 0.479260534f},
-std::array<float,2>{0.41658017f, 0.844859779f},
-std::array<float,2>{0.952920258f, 0.285652429f},
-std::array<float,2>{0.700165212f, 0.722835302f},
-std::array<float,2>{0.0978520289f, 0.218540132f},
-std::array<float,2>{0.127728358f, 0.997933507f},
-std::array<float,2>{0.506499946f, 0.412045658f},
-std::array<float,2>{0.847440779f, 0.61458385f},
-std::array<float,2>{0.374243975f, 0.0304271933f},
-std::array<float,2>{0.389078885f, 0.658605337f},
-std::array<float,2>{0.993550241f, 0.180345714f},
-std::array<float,2>{0.720984638f, 0.760192573f},
-std::array<float,2>{0.0697131082f, 0.321141779f},
-std::array<float,2>{0.0465752892f, 0.526142657f},
-std::array<float,2>{0.640312731f, 0.0870477259f},
-std::array<float,2>{0.885623634f, 0.924729884f},
-std::array<float,2>{0.497597128f, 0.490402728f},
-std::array<float,2>{0.255630791f, 0.865281165f},
-std::array<float,2>{0.79644829f, 0.299952298f},
-std::array<float,2>{0.602264404f, 0.74208498f},
-std::array<float,2>{0.22293146f, 0.199093685f},
-std::array<float,2>{0.0974191651f, 0.78404814f},
-std::array<float,2>{0.695860803f, 0.361958534f},
-std::array<float,2>{0.947473764f, 0.633761346f},
-std::array<float,2>{0.418706775f, 0.155979335f},
-std::array<float,2>{0.321741313f, 0.58093375f},
-std::array<float,2>{0.812510908f, 0.0503774807f},
-std::array<float,2>{0.540279329f, 0.941732168f},
-std::array<float,2>{0.179337531f, 0.384677112f},
-std::array<float,2>{0.211774036f, 0.707658827f},
-std::array<float,2>{0.578558087f, 0.246218592f},
-std::array<float,2>{0.770225644f, 0.831785202f},
-std::array<float,2>{0.309660763f, 0.271992296f},
-std::array<float,2>{0.458197594f, 0.901231229f},
-std::array<float,2>{0.933544517f, 0.454947412f},
-std::array<float,2>{0.681154668f, 0.551089883f},
-std::array<float,2>{0.0151084736f, 0.119836412f},
-std::array<float,2>{0.234604537f, 0.819069743f},
-std::array<float,2>{0.624581218f, 0.265033305f},
-std::array<float,2>{0.798624516f, 0.692908049f},
-std::array<float,2>{0.280594051f, 0.234245226f},
-std::array<float,2>{0.481511354f, 0.542241752f},
-std::array<float,2>{0.897064686f, 0.098025009f},
-std::array<float,2>{0.643339515f, 0.876437902f},
-std::array<float,2>{0.0483669713f, 0.438510001f},
-std::array<float,2>{0.0913762748f, 0.642422855f},
-std::array<float,2>{0.7486552f, 0.130102813f},
-std::array<float,2>{0.971890152f, 0.80030334f},
-std::array<float,2>{0.402562171f, 0.35792017f},
-std::array<float,2>{0.346798569f, 0.965296626f},
-std::array<float,2>{0.860336959f, 0.394606203f},
-std::array<float,2>{0.529441237f, 0.566391289f},
-std::array<float,2>{0.147567376f, 0.0341571197f},
-std::array<float,2>{0.0259708595f, 0.919755518f},
-std::array<float,2>{0.65854311f, 0.473546088f},
-std::array<float,2>{0.907167971f, 0.508289516f},
-std::array<float,2>{0.440418959f, 0.0628384352f},
-std::array<float,2>{0.296663016f, 0.733920634f},
-std::array<float,2>{0.761429906f, 0.206780344f},
-std::array<float,2>{0.567518353f, 0.859335959f},
-std::array<float,2>{0.199118733f, 0.290765017f},
-std::array<float,2>{0.157549426f, 0.609366119f},
-std::array<float,2>{0.559766173f, 0.0132034924f},
-std::array<float,2>{0.839328587f, 0.979994714f},
-std::array<float,2>{0.329183102f, 0.423406005f},
-std::array<float,2>{0.425131738f, 0.777070582f},
-std::array<float,2>{0.965504944f, 0.341076434f},
-std::array<float,2>{0.717252612f, 0.680568874f},
-std::array<float,2>{0.114291437f, 0.170350999f},
-std::array<float,2>{0.194588467f, 0.883871615f},
-std::array<float,2>{0.575715303f, 0.446483582f},
-std::array<float,2>{0.751761615f, 0.537340522f},
-std::array<float,2>{0.288176626f, 0.103337206f},
-std::array<float,2>{0.451390326f, 0.696222663f},
-std::array<float,2>{0.921024263f, 0.225163743f},
-std::array<float,2>{0.67043221f, 0.825321019f},
-std::array<float,2>{0.0212584827f, 0.256628186f},
-std::array<float,2>{0.122546971f, 0.575522482f},
-std::array<float,2>{0.703154325f, 0.0413569584f},
-std::array<float,2>{0.957484961f, 0.960541308f},
-std::array<float,2>{0.430856973f, 0.402818382f},
-std::array<float,2>{0.33599323f, 0.812476099f},
-std::array<float,2>{0.829725146f, 0.345167696f},
-std::array<float,2>{0.548891604f, 0.648966432f},
-std::array<float,2>{0.170335576f, 0.136834636f},
-std::array<float,2>{0.0610528402f, 0.850925684f},
-std::array<float,2>{0.654192448f, 0.281938076f},
-std::array<float,2>{0.904203117f, 0.718909383f},
-std::array<float,2>{0.470454901f, 0.212305441f},
-std::array<float,2>{0.270263046f, 0.506988227f},
-std::array<float,2>{0.809577346f, 0.0760536641f},
-std::array<float,2>{0.614285588f, 0.909133255f},
-std::array<float,2>{0.249759465f, 0.480820745f},
-std::array<float,2>{0.151809111f, 0.675272942f},
-std::array<float,2>{0.522903383f, 0.161170885f},
-std::array<float,2>{0.874087751f, 0.768999994f},
-std::array<float,2>{0.358241349f, 0.331878632f},
-std::array<float,2>{0.391514987f, 0.976400077f},
-std::array<float,2>{0.98336798f, 0.430853754f},
-std::array<float,2>{0.74134475f, 0.596654594f},
-std::array<float,2>{0.0813005641f, 0.00197600946f},
-std::array<float,2>{0.185738668f, 0.750495911f},
-std::array<float,2>{0.532172501f, 0.319649816f},
-std::array<float,2>{0.823177516f, 0.671846628f},
-std::array<float,2>{0.316710621f, 0.177950174f},
-std::array<float,2>{0.411215425f, 0.624052882f},
-std::array<float,2>{0.942825496f, 0.0184434801f},
-std::array<float,2>{0.693023264f, 0.987195313f},
-std::array<float,2>{0.107693493f, 0.421150416f},
-std::array<float,2>{0.00143946824f, 0.746288896f},
-std::array<float,2>{0.675186992f, 0.187639087f},
-std::array<float,2>{0.923312128f, 0.872990072f},
-std::array<float,2>{0.465344906f, 0.305775315f},
-std::array<float,2>{0.298565477f, 0.93436867f},
-std::array<float,2>{0.779397488f, 0.497416258f},
-std::array<float,2>{0.588316143f, 0.517595947f},
-std::array<float,2>{0.208145902f, 0.0786993131f},
-std::array<float,2>{0.0775692388f, 0.945837677f},
-std::array<float,2>{0.728707969f, 0.37663871f},
-std::array<float,2>{0.986626387f, 0.590559304f},
-std::array<float,2>{0.375689298f, 0.0598534867f},
-std::array<float,2>{0.36703527f, 0.629283369f},
-std::array<float,2>{0.852902889f, 0.143217951f},
-std::array<float,2>{0.51448679f, 0.796339214f},
-std::array<float,2>{0.135316625f, 0.368751496f},
-std::array<float,2>{0.231389925f, 0.561755598f},
-std::array<float,2>{0.597735524f, 0.11711482f},
-std::array<float,2>{0.788306594f, 0.894160628f},
-std::array<float,2>{0.261482507f, 0.461269766f},
-std::array<float,2>{0.489781708f, 0.839514017f},
-std::array<float,2>{0.876037121f, 0.28059718f},
-std::array<float,2>{0.632003188f, 0.718094707f},
-std::array<float,2>{0.0376053378f, 0.23851265f},
-std::array<float,2>{0.218852684f, 0.955648601f},
-std::array<float,2>{0.607041061f, 0.402026266f},
-std::array<float,2>{0.789652407f, 0.572887301f},
-std::array<float,2>{0.252787948f, 0.0465030037f},
-std::array<float,2>{0.494434625f, 0.655914605f},
-std::array<float,2>{0.889615297f, 0.136523783f},
-std::array<float,2>{0.6357342f, 0.805160403f},
-std::array<float,2>{0.0420586765f, 0.349546254f},
-std::array<float,2>{0.0635036752f, 0.533586502f},
-std::array<float,2>{0.724589348f, 0.105958655f},
-std::array<float,2>{0.996393383f, 0.889323175f},
-std::array<float,2>{0.383064836f, 0.451533616f},
-std::array<float,2>{0.368507892f, 0.822490275f},
-std::array<float,2>{0.849543214f, 0.252481699f},
-std::array<float,2>{0.50365901f, 0.699752152f},
-std::array<float,2>{0.132025912f, 0.220320001f},
-std::array<float,2>{0.00986199826f, 0.772643089f},
-std::array<float,2>{0.685567796f, 0.332119524f},
-std::array<float,2>{0.935682654f, 0.678418577f},
-std::array<float,2>{0.454491317f, 0.160025716f},
-std::array<float,2>{0.305783033f, 0.601238549f},
-std::array<float,2>{0.769363165f, 0.00686368579f},
-std::array<float,2>{0.582748473f, 0.971646845f},
-std::array<float,2>{0.216851741f, 0.43670398f},
-std::array<float,2>{0.173550695f, 0.723296106f},
-std::array<float,2>{0.543830693f, 0.217962444f},
-std::array<float,2>{0.817164242f, 0.845397651f},
-std::array<float,2>{0.326027125f, 0.28521207f},
-std::array<float,2>{0.415342152f, 0.912934303f},
-std::array<float,2>{0.950373411f, 0.478825569f},
-std::array<float,2>{0.703105211f, 0.502039135f},
-std::array<float,2>{0.10062483f, 0.0717235208f},
-std::array<float,2>{0.143371969f, 0.868961811f},
-std::array<float,2>{0.525991559f, 0.31178388f},
-std::array<float,2>{0.863428175f, 0.743947744f},
-std::array<float,2>{0.348003089f, 0.195094973f},
-std::array<float,2>{0.399057448f, 0.52193284f},
-std::array<float,2>{0.973232627f, 0.0841799676f},
-std::array<float,2>{0.745321631f, 0.930449367f},
-std::array<float,2>{0.0895400792f, 0.492842436f},
-std::array<float,2>{0.0539639294f, 0.66790849f},
-std::array<float,2>{0.644565642f, 0.173939526f},
-std::array<float,2>{0.892861843f, 0.755445659f},
-std::array<float,2>{0.479736745f, 0.313053995f},
-std::array<float,2>{0.276754707f, 0.99064362f},
-std::array<float,2>{0.801760495f, 0.415296465f},
-std::array<float,2>{0.61802423f, 0.617421269f},
-std::array<float,2>{0.2415497f, 0.0211654529f},
-std::array<float,2>{0.110691316f, 0.895114422f},
-std::array<float,2>{0.712735534f, 0.466725379f},
-std::array<float,2>{0.963379622f, 0.556732059f},
-std::array<float,2>{0.426352829f, 0.11034251f},
-std::array<float,2>{0.334432989f, 0.712903619f},
-std::array<float,2>{0.8435269f, 0.235908136f},
-std::array<float,2>{0.556877136f, 0.841566563f},
-std::array<float,2>{0.16045776f, 0.27369675f},
-std::array<float,2>{0.201124355f, 0.586592436f},
-std::array<float,2>{0.566041589f, 0.0556517057f},
-std::array<float,2>{0.765102983f, 0.949795604f},
-std::array<float,2>{0.290132493f, 0.382288069f},
-std::array<float,2>{0.444698781f, 0.79023242f},
-std::array<float,2>{0.912849009f, 0.372073025f},
-std::array<float,2>{0.663108468f, 0.626080394f},
-std::array<float,2>{0.0282474719f, 0.145215765f},
-std::array<float,2>{0.166597068f, 0.929601848f},
-std::array<float,2>{0.551597893f, 0.485379159f},
-std::array<float,2>{0.832049489f, 0.529013395f},
-std::array<float,2>{0.340741813f, 0.090385817f},
-std::array<float,2>{0.434185058f, 0.73719573f},
-std::array<float,2>{0.956331611f, 0.201618418f},
-std::array<float,2>{0.709457278f, 0.860098779f},
-std::array<float,2>{0.118150033f, 0.302131832f},
-std::array<float,2>{0.0156309865f, 0.610184014f},
-std::array<float,2>{0.66584146f, 0.0257079117f},
-std::array<float,2>{0.917221427f, 0.993615508f},
-std::array<float,2>{0.448574394f, 0.409209311f},
-std::array<float,2>{0.283260047f, 0.764797807f},
-std::array<float,2>{0.75560075f, 0.325377434f},
-std::array<float,2>{0.572955906f, 0.661529362f},
-std::array<float,2>{0.190224528f, 0.186218843f},
-std::array<float,2>{0.0836895332f, 0.833996117f},
-std::array<float,2>{0.738274992f, 0.266556352f},
-std::array<float,2>{0.977749288f, 0.704724014f},
-std::array<float,2>{0.398345321f, 0.245174468f},
-std::array<float,2>{0.354870409f, 0.548630774f},
-std::array<float,2>{0.870579481f, 0.124451853f},
-std::array<float,2>{0.515827f, 0.905793488f},
-std::array<float,2>{0.152948946f, 0.459908813f},
-std::array<float,2>{0.243629545f, 0.639620662f},
-std::array<float,2>{0.610767305f, 0.151514128f},
-std::array<float,2>{0.806558788f, 0.787483335f},
-std::array<float,2>{0.269463211f, 0.364079624f},
-std::array<float,2>{0.475612015f, 0.940487981f},
-std::array<float,2>{0.899716735f, 0.389577895f},
-std::array<float,2>{0.649297297f, 0.585590303f},
-std::array<float,2>{0.0566854626f, 0.0523698628f},
-std::array<float,2>{0.206157267f, 0.802294791f},
-std::array<float,2>{0.593346715f, 0.353792101f},
-std::array<float,2>{0.774358094f, 0.647887886f},
-std::array<float,2>{0.300783396f, 0.12694633f},
-std::array<float,2>{0.461176455f, 0.568331361f},
-std::array<float,2>{0.927177846f, 0.038446676f},
-std::array<float,2>{0.677749455f, 0.962414861f},
-std::array<float,2>{0.00509581529f, 0.393388301f},
-std::array<float,2>{0.102916874f, 0.688888371f},
-std::array<float,2>{0.689815164f, 0.227019861f},
-std::array<float,2>{0.940569818f, 0.812710702f},
-std::array<float,2>{0.408420444f, 0.260478973f},
-std::array<float,2>{0.312764019f, 0.882442296f},
-std::array<float,2>{0.827117205f, 0.443056315f},
-std::array<float,2>{0.537070453f, 0.545054257f},
-std::array<float,2>{0.179991692f, 0.096303761f},
-std::array<float,2>{0.033405859f, 0.980561674f},
-std::array<float,2>{0.62544924f, 0.429281712f},
-std::array<float,2>{0.879621387f, 0.60313195f},
-std::array<float,2>{0.487660915f, 0.0107982904f},
-std::array<float,2>{0.263738781f, 0.686623275f},
-std::array<float,2>{0.782069862f, 0.165792137f},
-std::array<float,2>{0.595692813f, 0.778777659f},
-std::array<float,2>{0.22893317f, 0.336567521f},
-std::array<float,2>{0.138665915f, 0.515085518f},
-std::array<float,2>{0.508455813f, 0.0695543438f},
-std::array<float,2>{0.857721388f, 0.916512489f},
-std::array<float,2>{0.359544814f, 0.472460628f},
-std::array<float,2>{0.381723553f, 0.85172534f},
-std::array<float,2>{0.989481628f, 0.296210647f},
-std::array<float,2>{0.731730103f, 0.728440583f},
-std::array<float,2>{0.0727009326f, 0.208454326f},
-std::array<float,2>{0.176211387f, 0.943552494f},
-std::array<float,2>{0.542268813f, 0.386679947f},
-std::array<float,2>{0.814591944f, 0.579587162f},
-std::array<float,2>{0.32289046f, 0.048579976f},
-std::array<float,2>{0.421182394f, 0.636317909f},
-std::array<float,2>{0.945442259f, 0.153210998f},
-std::array<float,2>{0.698722661f, 0.782364547f},
-std::array<float,2>{0.0943155661f, 0.361199856f},
-std::array<float,2>{0.0133182323f, 0.553888083f},
-std::array<float,2>{0.682923913f, 0.1189254f},
-std::array<float,2>{0.930228174f, 0.899673223f},
-std::array<float,2>{0.46032843f, 0.455736727f},
-std::array<float,2>{0.311141014f, 0.829323828f},
-std::array<float,2>{0.772923052f, 0.271443069f},
-std::array<float,2>{0.580256522f, 0.709315658f},
-std::array<float,2>{0.213084951f, 0.248783752f},
-std::array<float,2>{0.067753002f, 0.758728266f},
-std::array<float,2>{0.720423758f, 0.323129386f},
-std::array<float,2>{0.994304597f, 0.656846821f},
-std::array<float,2>{0.387706041f, 0.182010621f},
-std::array<float,2>{0.372532725f, 0.616563141f},
-std::array<float,2>{0.845419705f, 0.0277412608f},
-std::array<float,2>{0.505083263f, 0.998686314f},
-std::array<float,2>{0.125843108f, 0.412235498f},
-std::array<float,2>{0.226197258f, 0.739652276f},
-std::array<float,2>{0.605223835f, 0.196131453f},
-std::array<float,2>{0.793509424f, 0.863850892f},
-std::array<float,2>{0.257631242f, 0.298537731f},
-std::array<float,2>{0.499518842f, 0.922231674f},
-std::array<float,2>{0.883779228f, 0.489820898f},
-std::array<float,2>{0.637517571f, 0.524655998f},
-std::array<float,2>{0.044706963f, 0.0896320492f},
-std::array<float,2>{0.19534792f, 0.857314467f},
-std::array<float,2>{0.570308387f, 0.291539997f},
-std::array<float,2>{0.757968724f, 0.730728805f},
-std::array<float,2>{0.29489094f, 0.203428194f},
-std::array<float,2>{0.438762754f, 0.511663377f},
-std::array<float,2>{0.909806788f, 0.0649100915f},
-std::array<float,2>{0.657211065f, 0.921454787f},
-std::array<float,2>{0.0247813538f, 0.475331396f},
-std::array<float,2>{0.116549596f, 0.682283998f},
-std::array<float,2>{0.716166675f, 0.168717295f},
-std::array<float,2>{0.968677104f, 0.774195552f},
-std::array<float,2>{0.422139734f, 0.343153983f},
-std::array<float,2>{0.331917256f, 0.977211952f},
-std::array<float,2>{0.837661982f, 0.424741149f},
-std::array<float,2>{0.561450839f, 0.60552597f},
-std::array<float,2>{0.159019634f, 0.0138678132f},
-std::array<float,2>{0.0504935011f, 0.877279818f},
-std::array<float,2>{0.642279983f, 0.440214336f},
-std::array<float,2>{0.895909369f, 0.539929688f},
-std::array<float,2>{0.484081566f, 0.100509033f},
-std::array<float,2>{0.278427184f, 0.693923235f},
-std::array<float,2>{0.800483048f, 0.231421322f},
-std::array<float,2>{0.621574044f, 0.81721127f},
-std::array<float,2>{0.236898541f, 0.262095362f},
-std::array<float,2>{0.144915432f, 0.5644418f},
-std::array<float,2>{0.528766453f, 0.0313760154f},
-std::array<float,2>{0.863000989f, 0.968150854f},
-std::array<float,2>{0.344876796f, 0.397162765f},
-std::array<float,2>{0.405196697f, 0.797816336f},
-std::array<float,2>{0.970379949f, 0.356236666f},
-std::array<float,2>{0.747694373f, 0.642646313f},
-std::array<float,2>{0.0933047608f, 0.132130235f},
-std::array<float,2>{0.24638696f, 0.90737915f},
-std::array<float,2>{0.615412116f, 0.484190553f},
-std::array<float,2>{0.812173784f, 0.505250633f},
-std::array<float,2>{0.272672772f, 0.0764115006f},
-std::array<float,2>{0.470857054f, 0.720900953f},
-std::array<float,2>{0.904559314f, 0.214832857f},
-std::array<float,2>{0.655615807f, 0.848567426f},
-std::array<float,2>{0.0596340597f, 0.28466624f},
-std::array<float,2>{0.0788010657f, 0.594860375f},
-std::array<float,2>{0.739307404f, 0.0012332449f},
-std::array<float,2>{0.981720388f, 0.974069774f},
-std::array<float,2>{0.393581659f, 0.433550745f},
-std::array<float,2>{0.356704414f, 0.766475797f},
-std::array<float,2>{0.871480167f, 0.329918832f},
-std::array<float,2>{0.520542026f, 0.672168911f},
-std::array<float,2>{0.149272844f, 0.163748637f},
-std::array<float,2>{0.0215744991f, 0.826413572f},
-std::array<float,2>{0.668680489f, 0.255707979f},
-std::array<float,2>{0.918610573f, 0.698110282f},
-std::array<float,2>{0.449442774f, 0.224133655f},
-std::array<float,2>{0.287108064f, 0.536104977f},
-std::array<float,2>{0.753523648f, 0.105275877f},
-std::array<float,2>{0.578095615f, 0.885690153f},
-std::array<float,2>{0.192803785f, 0.449182093f},
-std::array<float,2>{0.169256702f, 0.651813686f},
-std::array<float,2>{0.548387527f, 0.140421256f},
-std::array<float,2>{0.831044316f, 0.809939682f},
-std::array<float,2>{0.339437783f, 0.346574783f},
-std::array<float,2>{0.432122648f, 0.957858562f},
-std::array<float,2>{0.960764527f, 0.405809402f},
-std::array<float,2>{0.705247581f, 0.577214241f},
-std::array<float,2>{0.124072246f, 0.0402093902f},
-std::array<float,2>{0.13290678f, 0.793402135f},
-std::array<float,2>{0.512074292f, 0.370876104f},
-std::array<float,2>{0.855184495f, 0.632715046f},
-std::array<float,2>{0.363539249f, 0.141973019f},
-std::array<float,2>{0.377721995f, 0.592308044f},
-std::array<float,2>{0.9850564f, 0.0612110384f},
-std::array<float,2>{0.728178263f, 0.948619425f},
-std::array<float,2>{0.0754434094f, 0.377193153f},
-std::array<float,2>{0.0368491262f, 0.715713203f},
-std::array<float,2>{0.63052249f, 0.240299329f},
-std::array<float,2>{0.878521919f, 0.836796045f},
-std::array<float,2>{0.490855366f, 0.278935701f},
-std::array<float,2>{0.257985771f, 0.89101845f},
-std::array<float,2>{0.786656916f, 0.462892145f},
-std::array<float,2>{0.601492226f, 0.558962822f},
-std::array<float,2>{0.233425468f, 0.115008146f},
-std::array<float,2>{0.107283369f, 0.986247003f},
-std::array<float,2>{0.693362772f, 0.418777466f},
-std::array<float,2>{0.944060683f, 0.622241318f},
-std::array<float,2>{0.413827389f, 0.0175150018f},
-std::array<float,2>{0.32013011f, 0.669637263f},
-std::array<float,2>{0.82222259f, 0.177398548f},
-std::array<float,2>{0.534843564f, 0.752169967f},
-std::array<float,2>{0.185326502f, 0.318164527f},
-std::array<float,2>{0.210812941f, 0.515726686f},
-std::array<float,2>{0.587612808f, 0.0817863643f},
-std::array<float,2>{0.778764069f, 0.936247706f},
-std::array<float,2>{0.299712837f, 0.499135315f},
-std::array<float,2>{0.468562156f, 0.873201728f},
-std::array<float,2>{0.92431742f, 0.308069259f},
-std::array<float,2>{0.67299968f, 0.749325037f},
-std::array<float,2>{0.00340856798f, 0.19134362f},
-std::array<float,2>{0.215685621f, 0.970083714f},
-std::array<float,2>{0.58493489f, 0.434584856f},
-std::array<float,2>{0.766235828f, 0.599237621f},
-std::array<float,2>{0.307308823f, 0.00505587179f},
-std::array<float,2>{0.455481559f, 0.675903141f},
-std::array<float,2>{0.935256124f, 0.157393992f},
-std::array<float,2>{0.684811711f, 0.771375f},
-std::array<float,2>{0.0094332397f, 0.33517462f},
-std::array<float,2>{0.0984813273f, 0.500168562f},
-std::array<float,2>{0.69934243f, 0.0732913315f},
-std::array<float,2>{0.95225203f, 0.911161065f},
-std::array<float,2>{0.416066736f, 0.477021664f},
-std::array<float,2>{0.327206522f, 0.847600043f},
-std::array<float,2>{0.819449067f, 0.28769049f},
-std::array<float,2>{0.546021461f, 0.725953937f},
-std::array<float,2>{0.175398737f, 0.216666147f},
-std::array<float,2>{0.03966574f, 0.8077088f},
-std::array<float,2>{0.634231746f, 0.350791246f},
-std::array<float,2>{0.888490438f, 0.653411686f},
-std::array<float,2>{0.493116915f, 0.134338483f},
-std::array<float,2>{0.251648158f, 0.571758986f},
-std::array<float,2>{0.79290998f, 0.04419934f},
-std::array<float,2>{0.607932627f, 0.954734862f},
-std::array<float,2>{0.221460298f, 0.398486793f},
-std::array<float,2>{0.129785329f, 0.702503145f},
-std::array<float,2>{0.501762688f, 0.222432271f},
-std::array<float,2>{0.851299047f, 0.820686638f},
-std::array<float,2>{0.369677246f, 0.250070304f},
-std::array<float,2>{0.385579854f, 0.887470603f},
-std::array<float,2>{0.998458862f, 0.4496499f},
-std::array<float,2>{0.725058675f, 0.532791793f},
-std::array<float,2>{0.064506121f, 0.107704125f},
-std::array<float,2>{0.163243636f, 0.843043685f},
-std::array<float,2>{0.554742754f, 0.277046502f},
-std::array<float,2>{0.84173882f, 0.71106869f},
-std::array<float,2>{0.333211631f, 0.237409607f},
-std::array<float,2>{0.429175764f, 0.555836082f},
-std::array<float,2>{0.961264551f, 0.113206849f},
-std::array<float,2>{0.713018775f, 0.897239566f},
-std::array<float,2>{0.113261253f, 0.467114896f},
-std::array<float,2>{0.0293726493f, 0.627486765f},
-std::array<float,2>{0.660396278f, 0.146573409f},
-std::array<float,2>{0.911980391f, 0.792319059f},
-std::array<float,2>{0.441769868f, 0.373156279f},
-std::array<float,2>{0.292519897f, 0.952482641f},
-std::array<float,2>{0.762570083f, 0.380417198f},
-std::array<float,2>{0.563139617f, 0.589754283f},
-std::array<float,2>{0.201780722f, 0.0584418401f},
-std::array<float,2>{0.0859799832f, 0.932145298f},
-std::array<float,2>{0.743073285f, 0.494394749f},
-std::array<float,2>{0.974652171f, 0.519909203f},
-std::array<float,2>{0.401378572f, 0.0831413418f},
-std::array<float,2>{0.349912226f, 0.744770646f},
-std::array<float,2>{0.867014766f, 0.191921607f},
-std::array<float,2>{0.524734676f, 0.871040344f},
-std::array<float,2>{0.141798377f, 0.309510738f},
-std::array<float,2>{0.239113137f, 0.619228482f},
-std::array<float,2>{0.620708287f, 0.0220369585f},
-std::array<float,2>{0.80381006f, 0.98871094f},
-std::array<float,2>{0.274879605f, 0.41766727f},
-std::array<float,2>{0.47800979f, 0.756914198f},
-std::array<float,2>{0.89236933f, 0.316401243f},
-std::array<float,2>{0.647579432f, 0.66477406f},
-std::array<float,2>{0.0514529198f, 0.172997028f},
-std::array<float,2>{0.156106085f, 0.903993487f},
-std::array<float,2>{0.518426538f, 0.458806217f},
-std::array<float,2>{0.868760586f, 0.550064206f},
-std::array<float,2>{0.352433771f, 0.123038627f},
-std::array<float,2>{0.396009296f, 0.706696033f},
-std::array<float,2>{0.978725135f, 0.24338752f},
-std::array<float,2>{0.735307455f, 0.833271742f},
-std::array<float,2>{0.085008502f, 0.26838094f},
-std::array<float,2>{0.0547567196f, 0.582934201f},
-std::array<float,2>{0.650575817f, 0.0536362939f},
-std::array<float,2>{0.901207447f, 0.937997043f},
-std::array<float,2>{0.473063499f, 0.388599664f},
-std::array<float,2>{0.267366201f, 0.785473347f},
-std::array<float,2>{0.80858618f, 0.366933078f},
-std::array<float,2>{0.612832963f, 0.637875199f},
-std::array<float,2>{0.244863957f, 0.149408981f},
-std::array<float,2>{0.119948722f, 0.862539411f},
-std::array<float,2>{0.708945572f, 0.30417338f},
-std::array<float,2>{0.954228818f, 0.736231565f},
-std::array<float,2>{0.436034858f, 0.200059935f},
-std::array<float,2>{0.342106432f, 0.530530214f},
-std::array<float,2>{0.835255682f, 0.092361033f},
-std::array<float,2>{0.554275393f, 0.926804423f},
-std::array<float,2>{0.164867938f, 0.486859351f},
-std::array<float,2>{0.187863976f, 0.66400069f},
-std::array<float,2>{0.571813643f, 0.183718175f},
-std::array<float,2>{0.757540226f, 0.763287961f},
-std::array<float,2>{0.281848967f, 0.327058375f},
-std::array<float,2>{0.447034717f, 0.995379806f},
-std::array<float,2>{0.914161384f, 0.406577498f},
-std::array<float,2>{0.667019308f, 0.613216877f},
-std::array<float,2>{0.0192890968f, 0.0243290905f},
-std::array<float,2>{0.227947742f, 0.779582798f},
-std::array<float,2>{0.596576631f, 0.338875473f},
-std::array<float,2>{0.784793198f, 0.685406208f},
-std::array<float,2>{0.263479799f, 0.166945308f},
-std::array<float,2>{0.485068828f, 0.604550123f},
-std::array<float,2>{0.881859958f, 0.00827558432f},
-std::array<float,2>{0.62875396f, 0.982980728f},
-std::array<float,2>{0.0327589139f, 0.426243246f},
-std::array<float,2>{0.0716248974f, 0.730266213f},
-std::array<float,2>{0.733908296f, 0.210868031f},
-std::array<float,2>{0.991762698f, 0.853776097f},
-std::array<float,2>{0.380204648f, 0.293655425f},
-std::array<float,2>{0.362283021f, 0.915997803f},
-std::array<float,2>{0.856722593f, 0.4700481f},
-std::array<float,2>{0.510610998f, 0.511898935f},
-std::array<float,2>{0.140224844f, 0.0677750856f},
-std::array<float,2>{0.00643705344f, 0.964149892f},
-std::array<float,2>{0.676148951f, 0.390947253f},
-std::array<float,2>{0.929549456f, 0.568991661f},
-std::array<float,2>{0.464265406f, 0.0370876193f},
-std::array<float,2>{0.303499073f, 0.644898951f},
-std::array<float,2>{0.775968492f, 0.127819955f},
-std::array<float,2>{0.59104526f, 0.803363085f},
-std::array<float,2>{0.204537332f, 0.353437781f},
-std::array<float,2>{0.182602763f, 0.543538988f},
-std::array<float,2>{0.5384444f, 0.0956170708f},
-std::array<float,2>{0.82572782f, 0.8805632f},
-std::array<float,2>{0.315556854f, 0.443451107f},
-std::array<float,2>{0.406687528f, 0.816005886f},
-std::array<float,2>{0.938769698f, 0.259639174f},
-std::array<float,2>{0.688750267f, 0.691111863f},
-std::array<float,2>{0.104724266f, 0.228869602f},
-std::array<float,2>{0.146492332f, 0.967227519f},
-std::array<float,2>{0.53067863f, 0.397788793f},
-std::array<float,2>{0.860870779f, 0.563357711f},
-std::array<float,2>{0.345832705f, 0.0323809385f},
-std::array<float,2>{0.403645664f, 0.643911839f},
-std::array<float,2>{0.970880628f, 0.131332994f},
-std::array<float,2>{0.749499738f, 0.798307121f},
-std::array<float,2>{0.0900644809f, 0.356552064f},
-std::array<float,2>{0.047613956f, 0.540766001f},
-std::array<float,2>{0.644078255f, 0.101524353f},
-std::array<float,2>{0.898169398f, 0.878079534f},
-std::array<float,2>{0.481300116f, 0.440928996f},
-std::array<float,2>{0.279942751f, 0.817844987f},
-std::array<float,2>{0.797658861f, 0.263465792f},
-std::array<float,2>{0.623944044f, 0.694950044f},
-std::array<float,2>{0.235827491f, 0.231448039f},
-std::array<float,2>{0.113412842f, 0.774615109f},
-std::array<float,2>{0.718294561f, 0.342548341f},
-std::array<float,2>{0.966741979f, 0.683472812f},
-std::array<float,2>{0.423916489f, 0.168990925f},
-std::array<float,2>{0.329029888f, 0.606762707f},
-std::array<float,2>{0.838102639f, 0.0151543338f},
-std::array<float,2>{0.559040546f, 0.97805953f},
-std::array<float,2>{0.156255841f, 0.42527619f},
-std::array<float,2>{0.197661057f, 0.731516719f},
-std::array<float,2>{0.567152381f, 0.204761043f},
-std::array<float,2>{0.76036495f, 0.855636954f},
-std::array<float,2>{0.295223683f, 0.29266873f},
-std::array<float,2>{0.441041112f, 0.920756459f},
-std::array<float,2>{0.908058941f, 0.476226419f},
-std::array<float,2>{0.659526169f, 0.509806871f},
-std::array<float,2>{0.0270151813f, 0.0663656816f},
-std::array<float,2>{0.224335983f, 0.864664912f},
-std::array<float,2>{0.603039265f, 0.297542244f},
-std::array<float,2>{0.79504168f, 0.738527179f},
-std::array<float,2>{0.25480181f, 0.196968809f},
-std::array<float,2>{0.496239215f, 0.523818433f},
-std::array<float,2>{0.886427283f, 0.0885063186f},
-std::array<float,2>{0.639448225f, 0.922910154f},
-std::array<float,2>{0.0457654074f, 0.489062667f},
-std::array<float,2>{0.0685854927f, 0.657564938f},
-std::array<float,2>{0.722087979f, 0.183243722f},
-std::array<float,2>{0.992197692f, 0.758960307f},
-std::array<float,2>{0.390451193f, 0.323702991f},
-std::array<float,2>{0.373243511f, 0.999070168f},
-std::array<float,2>{0.845968723f, 0.413936317f},
-std::array<float,2>{0.507080495f, 0.615300179f},
-std::array<float,2>{0.128162503f, 0.0288359281f},
-std::array<float,2>{0.0142852226f, 0.898869395f},
-std::array<float,2>{0.679724157f, 0.456858605f},
-std::array<float,2>{0.931742609f, 0.553027987f},
-std::array<float,2>{0.457643479f, 0.117713392f},
-std::array<float,2>{0.308926195f, 0.71038413f},
-std::array<float,2>{0.771337509f, 0.249810532f},
-std::array<float,2>{0.579647183f, 0.829096556f},
-std::array<float,2>{0.21235083f, 0.270236284f},
-std::array<float,2>{0.177770883f, 0.578393638f},
-std::array<float,2>{0.539951682f, 0.0469492972f},
-std::array<float,2>{0.813575387f, 0.944799483f},
-std::array<float,2>{0.321034253f, 0.385071486f},
-std::array<float,2>{0.419065714f, 0.781420469f},
-std::array<float,2>{0.948368073f, 0.360171199f},
-std::array<float,2>{0.696644008f, 0.635656118f},
-std::array<float,2>{0.096474573f, 0.153795183f},
-std::array<float,2>{0.207320273f, 0.936751902f},
-std::array<float,2>{0.589767635f, 0.498727918f},
-std::array<float,2>{0.780472398f, 0.516887784f},
-std::array<float,2>{0.296982527f, 0.0810007378f},
-std::array<float,2>{0.466481447f, 0.748106062f},
-std::array<float,2>{0.922284126f, 0.190158144f},
-std::array<float,2>{0.67433846f, 0.874034584f},
-std::array<float,2>{0.000783562253f, 0.30669114f},
-std::array<float,2>{0.108715579f, 0.621939003f},
-std::array<float,2>{0.692353368f, 0.0159667004f},
-std::array<float,2>{0.94209826f, 0.984708309f},
-std::array<float,2>{0.410244852f, 0.419678152f},
-std::array<float,2>{0.317406863f, 0.753169298f},
-std::array<float,2>{0.824127793f, 0.316421717f},
-std::array<float,2>{0.533183873f, 0.668275535f},
-std::array<float,2>{0.186921999f, 0.175941601f},
-std::array<float,2>{0.038209416f, 0.837634861f},
-std::array<float,2>{0.631568968f, 0.27763021f},
-std::array<float,2>{0.875204206f, 0.716350496f},
-std::array<float,2>{0.489243329f, 0.241683334f},
-std::array<float,2>{0.260104477f, 0.559916675f},
-std::array<float,2>{0.788025439f, 0.113668136f},
-std::array<float,2>{0.599195182f, 0.892341614f},
-std::array<float,2>{0.231756046f, 0.464447647f},
-std::array<float,2>{0.135894269f, 0.631492019f},
-std::array<float,2>{0.514702022f, 0.141456917f},
-std::array<float,2>{0.851839423f, 0.793976724f},
-std::array<float,2>{0.366040021f, 0.369716316f},
-std::array<float,2>{0.376736909f, 0.947920263f},
-std::array<float,2>{0.987732291f, 0.378500849f},
-std::array<float,2>{0.729852498f, 0.593710303f},
-std::array<float,2>{0.0766779706f, 0.0621529147f},
-std::array<float,2>{0.171009272f, 0.809161127f},
-std::array<float,2>{0.550561786f, 0.346762568f},
-std::array<float,2>{0.828802466f, 0.651233494f},
-std::array<float,2>{0.33698979f, 0.139098838f},
-std::array<float,2>{0.429892927f, 0.576743782f},
-std::array<float,2>{0.958409429f, 0.0393686481f},
-std::array<float,2>{0.704716861f, 0.958435774f},
-std::array<float,2>{0.121663511f, 0.404439032f},
-std::array<float,2>{0.0195864141f, 0.698487282f},
-std::array<float,2>{0.671750605f, 0.223490953f},
-std::array<float,2>{0.919972956f, 0.827214777f},
-std::array<float,2>{0.452858657f, 0.254801244f},
-std::array<float,2>{0.287178755f, 0.886425912f},
-std::array<float,2>{0.750789821f, 0.447790414f},
-std::array<float,2>{0.574917138f, 0.536363363f},
-std::array<float,2>{0.194307059f, 0.104356311f},
-std::array<float,2>{0.0805039555f, 0.973088384f},
-std::array<float,2>{0.741014242f, 0.432592481f},
-std::array<float,2>{0.98413825f, 0.593762159f},
-std::array<float,2>{0.391945362f, 0.000774801651f},
-std::array<float,2>{0.359222621f, 0.67373246f},
-std::array<float,2>{0.873656094f, 0.162966028f},
-std::array<float,2>{0.522015572f, 0.766660571f},
-std::array<float,2>{0.151362196f, 0.328386754f},
-std::array<float,2>{0.248083249f, 0.504021406f},
-std::array<float,2>{0.614256442f, 0.077580601f},
-std::array<float,2>{0.808766901f, 0.906629741f},
-std::array<float,2>{0.270574272f, 0.482894033f},
-std::array<float,2>{0.468903691f, 0.848657131f},
-std::array<float,2>{0.903299034f, 0.28415665f},
-std::array<float,2>{0.653310776f, 0.722538233f},
-std::array<float,2>{0.061799895f, 0.213155061f},
-std::array<float,2>{0.240302771f, 0.989571869f},
-std::array<float,2>{0.618342996f, 0.416306138f},
-std::array<float,2>{0.801373124f, 0.620845437f},
-std::array<float,2>{0.275606304f, 0.0228184536f},
-std::array<float,2>{0.478704214f, 0.665131927f},
-std::array<float,2>{0.893931329f, 0.172533318f},
-std::array<float,2>{0.64599669f, 0.755964816f},
-std::array<float,2>{0.0531996638f, 0.315401286f},
-std::array<float,2>{0.0880774111f, 0.521345019f},
-std::array<float,2>{0.744174242f, 0.082092993f},
-std::array<float,2>{0.974364698f, 0.932762086f},
-std::array<float,2>{0.399919271f, 0.496010721f},
-std::array<float,2>{0.349477619f, 0.870090187f},
-std::array<float,2>{0.864570439f, 0.310093105f},
-std::array<float,2>{0.526460409f, 0.745276093f},
-std::array<float,2>{0.144392237f, 0.192983434f},
-std::array<float,2>{0.0287685338f, 0.79133904f},
-std::array<float,2>{0.662382007f, 0.374510676f},
-std::array<float,2>{0.913309276f, 0.628311574f},
-std::array<float,2>{0.4438034f, 0.147583619f},
-std::array<float,2>{0.289850295f, 0.58878988f},
-std::array<float,2>{0.76450634f, 0.0570966974f},
-std::array<float,2>{0.565354645f, 0.951174855f},
-std::array<float,2>{0.199660853f, 0.379518956f},
-std::array<float,2>{0.161702171f, 0.712307334f},
-std::array<float,2>{0.558236778f, 0.236978531f},
-std::array<float,2>{0.842575133f, 0.841875613f},
-std::array<float,2>{0.335481733f, 0.276030302f},
-std::array<float,2>{0.427687734f, 0.89812386f},
-std::array<float,2>{0.964190185f, 0.467854232f},
-std::array<float,2>{0.711708665f, 0.555584848f},
-std::array<float,2>{0.109626196f, 0.111400098f},
-std::array<float,2>{0.130908117f, 0.821868837f},
-std::array<float,2>{0.502162039f, 0.251540929f},
-std::array<float,2>{0.848198354f, 0.701895595f},
-std::array<float,2>{0.367979974f, 0.220734969f},
-std::array<float,2>{0.384735584f, 0.531894267f},
-std::array<float,2>{0.998019576f, 0.10855367f},
-std::array<float,2>{0.722688735f, 0.888217866f},
-std::array<float,2>{0.063039273f, 0.450801909f},
-std::array<float,2>{0.0419786125f, 0.652873039f},
-std::array<float,2>{0.635801911f, 0.133279949f},
-std::array<float,2>{0.889956892f, 0.807250619f},
-std::array<float,2>{0.495375574f, 0.350133359f},
-std::array<float,2>{0.25323385f, 0.95360142f},
-std::array<float,2>{0.79095161f, 0.400228798f},
-std::array<float,2>{0.606396139f, 0.571201146f},
-std::array<float,2>{0.219869792f, 0.0437294841f},
-std::array<float,2>{0.0996488407f, 0.910656929f},
-std::array<float,2>{0.702131391f, 0.477913827f},
-std::array<float,2>{0.950194657f, 0.501520455f},
-std::array<float,2>{0.414925188f, 0.0728757903f},
-std::array<float,2>{0.324273735f, 0.725496829f},
-std::array<float,2>{0.817798078f, 0.21562928f},
-std::array<float,2>{0.544397533f, 0.846102655f},
-std::array<float,2>{0.172352374f, 0.288710713f},
-std::array<float,2>{0.217990682f, 0.598388851f},
-std::array<float,2>{0.583238304f, 0.00393816456f},
-std::array<float,2>{0.76761061f, 0.968926907f},
-std::array<float,2>{0.305465996f, 0.434544355f},
-std::array<float,2>{0.453471243f, 0.770428896f},
-std::array<float,2>{0.937184572f, 0.334440678f},
-std::array<float,2>{0.686707199f, 0.677141249f},
-std::array<float,2>{0.0110969665f, 0.156955138f},
-std::array<float,2>{0.180702388f, 0.879597604f},
-std::array<float,2>{0.535384774f, 0.444663584f},
-std::array<float,2>{0.827513754f, 0.544412613f},
-std::array<float,2>{0.313707083f, 0.0946997181f},
-std::array<float,2>{0.409212559f, 0.689741433f},
-std::array<float,2>{0.940272629f, 0.229564682f},
-std::array<float,2>{0.690629423f, 0.815334439f},
-std::array<float,2>{0.101620361f, 0.258080482f},
-std::array<float,2>{0.00440076599f, 0.569952011f},
-std::array<float,2>{0.67925328f, 0.0357475244f},
-std::array<float,2>{0.92640698f, 0.963168383f},
-std::array<float,2>{0.462020963f, 0.392120212f},
-std::array<float,2>{0.301829129f, 0.80391556f},
-std::array<float,2>{0.775262594f, 0.352338493f},
-std::array<float,2>{0.592695594f, 0.646314919f},
-std::array<float,2>{0.205674395f, 0.128192812f},
-std::array<float,2>{0.0738014504f, 0.855171382f},
-std::array<float,2>{0.730553627f, 0.294331253f},
-std::array<float,2>{0.989074528f, 0.729081452f},
-std::array<float,2>{0.382090539f, 0.209295869f},
-std::array<float,2>{0.361062229f, 0.5136621f},
-std::array<float,2>{0.858409166f, 0.0668575093f},
-std::array<float,2>{0.509633183f, 0.914502323f},
-std::array<float,2>{0.137330353f, 0.469213337f},
-std::array<float,2>{0.230139032f, 0.684222817f},
-std::array<float,2>{0.594534934f, 0.167670518f},
-std::array<float,2>{0.782446146f, 0.780796349f},
-std::array<float,2>{0.264940768f, 0.338700086f},
-std::array<float,2>{0.486710221f, 0.984212875f},
-std::array<float,2>{0.880225062f, 0.427069902f},
-std::array<float,2>{0.626215458f, 0.603768706f},
-std::array<float,2>{0.0346124321f, 0.0095626032f},
-std::array<float,2>{0.190764457f, 0.762278795f},
-std::array<float,2>{0.573976815f, 0.327661514f},
-std::array<float,2>{0.754242539f, 0.662120342f},
-std::array<float,2>{0.284299523f, 0.18531993f},
-std::array<float,2>{0.447942257f, 0.612125158f},
-std::array<float,2>{0.916131377f, 0.0246504452f},
-std::array<float,2>{0.664457381f, 0.994691432f},
-std::array<float,2>{0.0172946993f, 0.407461196f},
-std::array<float,2>{0.118792363f, 0.73519212f},
-std::array<float,2>{0.710498333f, 0.200775772f},
-std::array<float,2>{0.955484152f, 0.861788273f},
-std::array<float,2>{0.434912413f, 0.303613812f},
-std::array<float,2>{0.341548711f, 0.926569998f},
-std::array<float,2>{0.833133817f, 0.48785612f},
-std::array<float,2>{0.551808298f, 0.530153334f},
-std::array<float,2>{0.167939857f, 0.0933533683f},
-std::array<float,2>{0.057780318f, 0.939026237f},
-std::array<float,2>{0.649435878f, 0.387665927f},
-std::array<float,2>{0.898954511f, 0.583744764f},
-std::array<float,2>{0.474628717f, 0.0538829789f},
-std::array<float,2>{0.267646194f, 0.636781633f},
-std::array<float,2>{0.804835796f, 0.149769664f},
-std::array<float,2>{0.609904349f, 0.786742747f},
-std::array<float,2>{0.242871031f, 0.366140932f},
-std::array<float,2>{0.153736472f, 0.549145877f},
-std::array<float,2>{0.517367661f, 0.121132709f},
-std::array<float,2>{0.869715214f, 0.902697027f},
-std::array<float,2>{0.354400486f, 0.457580298f},
-std::array<float,2>{0.397311568f, 0.83204937f},
-std::array<float,2>{0.977534831f, 0.269327283f},
-std::array<float,2>{0.736442864f, 0.705870926f},
-std::array<float,2>{0.0824539065f, 0.242251977f},
-std::array<float,2>{0.159312636f, 0.978773415f},
-std::array<float,2>{0.562213838f, 0.421992421f},
-std::array<float,2>{0.836372972f, 0.607619226f},
-std::array<float,2>{0.330230802f, 0.0126916813f},
-std::array<float,2>{0.42304635f, 0.6814273f},
-std::array<float,2>{0.967103422f, 0.171716094f},
-std::array<float,2>{0.71573472f, 0.775417745f},
-std::array<float,2>{0.116163604f, 0.340096414f},
-std::array<float,2>{0.0239166282f, 0.508790016f},
-std::array<float,2>{0.658009827f, 0.0638016164f},
-std::array<float,2>{0.909099817f, 0.918844521f},
-std::array<float,2>{0.4377563f, 0.473987013f},
-std::array<float,2>{0.292981029f, 0.857474446f},
-std::array<float,2>{0.758835137f, 0.289512873f},
-std::array<float,2>{0.568779767f, 0.733105779f},
-std::array<float,2>{0.196681798f, 0.20544526f},
-std::array<float,2>{0.092400901f, 0.798992872f},
-std::array<float,2>{0.746711969f, 0.358449548f},
-std::array<float,2>{0.969177485f, 0.641285777f},
-std::array<float,2>{0.405386806f, 0.129749224f},
-std::array<float,2>{0.344711334f, 0.565392137f},
-std::array<float,2>{0.86146009f, 0.0350347981f},
-std::array<float,2>{0.527457178f, 0.966761708f},
-std::array<float,2>{0.146108493f, 0.396177143f},
-std::array<float,2>{0.237853572f, 0.691657007f},
-std::array<float,2>{0.622212589f, 0.233173475f},
-std::array<float,2>{0.799024224f, 0.820307791f},
-std::array<float,2>{0.278170854f, 0.264302462f},
-std::array<float,2>{0.482471108f, 0.87523526f},
-std::array<float,2>{0.894555449f, 0.438429207f},
-std::array<float,2>{0.640768886f, 0.541053534f},
-std::array<float,2>{0.0489116684f, 0.0995949283f},
-std::array<float,2>{0.214650214f, 0.83092165f},
-std::array<float,2>{0.58142215f, 0.272644818f},
-std::array<float,2>{0.771746278f, 0.708476067f},
-std::array<float,2>{0.311573982f, 0.247875094f},
-std::array<float,2>{0.459892482f, 0.552505016f},
-std::array<float,2>{0.931200445f, 0.120684139f},
-std::array<float,2>{0.681664467f, 0.902244806f},
-std::array<float,2>{0.012125439f, 0.453792751f},
-std::array<float,2>{0.0955136418f, 0.634493172f},
-std::array<float,2>{0.697930753f, 0.154334709f},
-std::array<float,2>{0.946561038f, 0.784255683f},
-std::array<float,2>{0.420554608f, 0.362800241f},
-std::array<float,2>{0.323752165f, 0.942772985f},
-std::array<float,2>{0.81570071f, 0.383263856f},
-std::array<float,2>{0.541529477f, 0.581734896f},
-std::array<float,2>{0.176769212f, 0.0497322716f},
-std::array<float,2>{0.0430315882f, 0.925472796f},
-std::array<float,2>{0.638578594f, 0.491782367f},
-std::array<float,2>{0.883873761f, 0.526908875f},
-std::array<float,2>{0.498469025f, 0.0859384984f},
-std::array<float,2>{0.256314933f, 0.740685582f},
-std::array<float,2>{0.794459581f, 0.197923526f},
-std::array<float,2>{0.603812873f, 0.866417408f},
-std::array<float,2>{0.225335017f, 0.299316704f},
-std::array<float,2>{0.126940355f, 0.613842726f},
-std::array<float,2>{0.504726946f, 0.0299209394f},
-std::array<float,2>{0.844168484f, 0.997015893f},
-std::array<float,2>{0.37201649f, 0.410360724f},
-std::array<float,2>{0.38680318f, 0.761151552f},
-std::array<float,2>{0.995352089f, 0.321469039f},
-std::array<float,2>{0.719604135f, 0.659308851f},
-std::array<float,2>{0.0673472658f, 0.180776894f},
-std::array<float,2>{0.232694179f, 0.893389106f},
-std::array<float,2>{0.599912405f, 0.46214065f},
-std::array<float,2>{0.785718799f, 0.560619533f},
-std::array<float,2>{0.259049654f, 0.115711689f},
-std::array<float,2>{0.491578937f, 0.717393398f},
-std::array<float,2>{0.877434552f, 0.239845201f},
-std::array<float,2>{0.629327536f, 0.838119209f},
-std::array<float,2>{0.035893444f, 0.279968679f},
-std::array<float,2>{0.0750185624f, 0.590821683f},
-std::array<float,2>{0.727093577f, 0.0586016774f},
-std::array<float,2>{0.986191094f, 0.946998477f},
-std::array<float,2>{0.378825188f, 0.37535426f},
-std::array<float,2>{0.364854842f, 0.794957876f},
-std::array<float,2>{0.854361176f, 0.367809802f},
-std::array<float,2>{0.513124585f, 0.630113721f},
-std::array<float,2>{0.133925453f, 0.144074291f},
-std::array<float,2>{0.00220536371f, 0.871333003f},
-std::array<float,2>{0.672518909f, 0.305539638f},
-std::array<float,2>{0.925779164f, 0.747412086f},
-std::array<float,2>{0.467485517f, 0.188700974f},
-std::array<float,2>{0.30003193f, 0.51913166f},
-std::array<float,2>{0.778222859f, 0.0791401193f},
-std::array<float,2>{0.586255074f, 0.935222447f},
-std::array<float,2>{0.209142581f, 0.496609956f},
-std::array<float,2>{0.184276432f, 0.670571983f},
-std::array<float,2>{0.534024537f, 0.179151207f},
-std::array<float,2>{0.820457041f, 0.751795113f},
-std::array<float,2>{0.318693578f, 0.319271564f},
-std::array<float,2>{0.41256091f, 0.988247395f},
-std::array<float,2>{0.944419205f, 0.420203775f},
-std::array<float,2>{0.69452703f, 0.62338227f},
-std::array<float,2>{0.105917916f, 0.0188470259f},
-std::array<float,2>{0.149683565f, 0.767931223f},
-std::array<float,2>{0.520404577f, 0.330254048f},
-std::array<float,2>{0.872441709f, 0.674562216f},
-std::array<float,2>{0.355527043f, 0.160161912f},
-std::array<float,2>{0.393422931f, 0.597020984f},
-std::array<float,2>{0.981354535f, 0.00369265722f},
-std::array<float,2>{0.739029586f, 0.974704027f},
-std::array<float,2>{0.0796203017f, 0.430460751f},
-std::array<float,2>{0.058602713f, 0.720623016f},
-std::array<float,2>{0.655253828f, 0.21170558f},
-std::array<float,2>{0.906079531f, 0.849759996f},
-std::array<float,2>{0.47242251f, 0.28286472f},
-std::array<float,2>{0.27192688f, 0.909184813f},
-std::array<float,2>{0.811047673f, 0.48176685f},
-std::array<float,2>{0.617085516f, 0.505882859f},
-std::array<float,2>{0.247901753f, 0.0746372715f},
-std::array<float,2>{0.123238392f, 0.959873617f},
-std::array<float,2>{0.706128836f, 0.40386194f},
-std::array<float,2>{0.959804893f, 0.574651003f},
-std::array<float,2>{0.433143228f, 0.0423537679f},
-std::array<float,2>{0.338775069f, 0.650325537f},
-std::array<float,2>{0.831638873f, 0.138021573f},
-std::array<float,2>{0.547479153f, 0.810607016f},
-std::array<float,2>{0.168715566f, 0.344298452f},
-std::array<float,2>{0.192272767f, 0.538388789f},
-std::array<float,2>{0.577030063f, 0.102259994f},
-std::array<float,2>{0.752084434f, 0.88323009f},
-std::array<float,2>{0.286001951f, 0.44621411f},
-std::array<float,2>{0.450567752f, 0.824623823f},
-std::array<float,2>{0.919235826f, 0.257048219f},
-std::array<float,2>{0.668959916f, 0.696775794f},
-std::array<float,2>{0.0230711997f, 0.226003662f},
-std::array<float,2>{0.202537358f, 0.951114297f},
-std::array<float,2>{0.564403772f, 0.380880117f},
-std::array<float,2>{0.762792349f, 0.587147295f},
-std::array<float,2>{0.291705549f, 0.0559148081f},
-std::array<float,2>{0.442694604f, 0.625036001f},
-std::array<float,2>{0.910377622f, 0.145778537f},
-std::array<float,2>{0.66137296f, 0.789596558f},
-std::array<float,2>{0.0309542585f, 0.371716172f},
-std::array<float,2>{0.11208839f, 0.557738423f},
-std::array<float,2>{0.714235961f, 0.11110846f},
-std::array<float,2>{0.962070763f, 0.895966649f},
-std::array<float,2>{0.428591073f, 0.465210855f},
-std::array<float,2>{0.332159817f, 0.84041822f},
-std::array<float,2>{0.840035379f, 0.274684578f},
-std::array<float,2>{0.556329906f, 0.714217901f},
-std::array<float,2>{0.162195325f, 0.234703064f},
-std::array<float,2>{0.0518082529f, 0.75454253f},
-std::array<float,2>{0.646815836f, 0.314261615f},
-std::array<float,2>{0.891452968f, 0.66651392f},
-std::array<float,2>{0.477526486f, 0.175029159f},
-std::array<float,2>{0.273809344f, 0.618812323f},
-std::array<float,2>{0.802970052f, 0.0203979388f},
-std::array<float,2>{0.619273961f, 0.991547406f},
-std::array<float,2>{0.240029946f, 0.414753497f},
-std::array<float,2>{0.140633956f, 0.743119657f},
-std::array<float,2>{0.523841798f, 0.193885177f},
-std::array<float,2>{0.865252197f, 0.867490947f},
-std::array<float,2>{0.350689977f, 0.31131956f},
-std::array<float,2>{0.40064615f, 0.931452274f},
-std::array<float,2>{0.976017237f, 0.493447006f},
-std::array<float,2>{0.743887365f, 0.52274847f},
-std::array<float,2>{0.087674506f, 0.0852495506f},
-std::array<float,2>{0.17468679f, 0.84458971f},
-std::array<float,2>{0.545557797f, 0.286748677f},
-std::array<float,2>{0.818398774f, 0.724026859f},
-std::array<float,2>{0.32666865f, 0.217555806f},
-std::array<float,2>{0.417777091f, 0.503523052f},
-std::array<float,2>{0.951949179f, 0.0708645135f},
-std::array<float,2>{0.700967431f, 0.913685501f},
-std::array<float,2>{0.0988807306f, 0.479727924f},
-std::array<float,2>{0.00803268049f, 0.679438233f},
-std::array<float,2>{0.683930635f, 0.158729732f},
-std::array<float,2>{0.933724105f, 0.771538138f},
-std::array<float,2>{0.456706673f, 0.333710194f},
-std::array<float,2>{0.308009565f, 0.971975803f},
-std::array<float,2>{0.766808927f, 0.435902506f},
-std::array<float,2>{0.585838139f, 0.600396633f},
-std::array<float,2>{0.215929016f, 0.00642608153f},
-std::array<float,2>{0.0656155124f, 0.889909506f},
-std::array<float,2>{0.726329923f, 0.452920407f},
-std::array<float,2>{0.999458432f, 0.534759343f},
-std::array<float,2>{0.386511385f, 0.107099324f},
-std::array<float,2>{0.370402008f, 0.700564921f},
-std::array<float,2>{0.849780679f, 0.219394401f},
-std::array<float,2>{0.500080049f, 0.823621809f},
-std::array<float,2>{0.130649284f, 0.253566802f},
-std::array<float,2>{0.222515687f, 0.573371112f},
-std::array<float,2>{0.60899049f, 0.0454411879f},
-std::array<float,2>{0.791723132f, 0.956431866f},
-std::array<float,2>{0.250447899f, 0.400765717f},
-std::array<float,2>{0.494071454f, 0.806020975f},
-std::array<float,2>{0.887253702f, 0.348379493f},
-std::array<float,2>{0.633651972f, 0.654690206f},
-std::array<float,2>{0.0404402167f, 0.1351953f},
-std::array<float,2>{0.13906616f, 0.917040229f},
-std::array<float,2>{0.511238456f, 0.471157342f},
-std::array<float,2>{0.856129885f, 0.514639258f},
-std::array<float,2>{0.362588882f, 0.0693209544f},
-std::array<float,2>{0.379108369f, 0.726625085f},
-std::array<float,2>{0.990449309f, 0.207126155f},
-std::array<float,2>{0.732658684f, 0.85312289f},
-std::array<float,2>{0.0704214349f, 0.295804799f},
-std::array<float,2>{0.0313543193f, 0.602531552f},
-std::array<float,2>{0.627476811f, 0.00997529086f},
-std::array<float,2>{0.880896449f, 0.98213923f},
-std::array<float,2>{0.485381126f, 0.428355306f},
-std::array<float,2>{0.262253672f, 0.777765214f},
-std::array<float,2>{0.783313453f, 0.337168545f},
-std::array<float,2>{0.597326458f, 0.686458051f},
-std::array<float,2>{0.227440417f, 0.164578199f},
-std::array<float,2>{0.104123428f, 0.813881695f},
-std::array<float,2>{0.687699676f, 0.26112324f},
-std::array<float,2>{0.938131988f, 0.688076437f},
-std::array<float,2>{0.407315999f, 0.227649778f},
-std::array<float,2>{0.31462279f, 0.545927167f},
-std::array<float,2>{0.825181067f, 0.0966809615f},
-std::array<float,2>{0.538018405f, 0.881199479f},
-std::array<float,2>{0.183586955f, 0.441771537f},
-std::array<float,2>{0.204062596f, 0.647097468f},
-std::array<float,2>{0.590176821f, 0.125116721f},
-std::array<float,2>{0.777197123f, 0.800872922f},
-std::array<float,2>{0.303971052f, 0.354591876f},
-std::array<float,2>{0.463383049f, 0.961134315f},
-std::array<float,2>{0.927928269f, 0.394388795f},
-std::array<float,2>{0.677229881f, 0.567276955f},
-std::array<float,2>{0.00716543151f, 0.0377534404f},
-std::array<float,2>{0.24565722f, 0.78883785f},
-std::array<float,2>{0.611452103f, 0.364265651f},
-std::array<float,2>{0.807581782f, 0.640006483f},
-std::array<float,2>{0.266252249f, 0.151197642f},
-std::array<float,2>{0.47407645f, 0.584131122f},
-std::array<float,2>{0.901648879f, 0.051654797f},
-std::array<float,2>{0.651798308f, 0.9399001f},
-std::array<float,2>{0.0562652089f, 0.390563548f},
-std::array<float,2>{0.0844785646f, 0.703388691f},
-std::array<float,2>{0.736271501f, 0.244232103f},
-std::array<float,2>{0.979758799f, 0.835801542f},
-std::array<float,2>{0.395261616f, 0.266936094f},
-std::array<float,2>{0.353313982f, 0.904534519f},
-std::array<float,2>{0.868116856f, 0.460407168f},
-std::array<float,2>{0.518630624f, 0.547122478f},
-std::array<float,2>{0.154439047f, 0.123219758f},
-std::array<float,2>{0.0184461065f, 0.992939591f},
-std::array<float,2>{0.666659653f, 0.409012079f},
-std::array<float,2>{0.915692031f, 0.610606968f},
-std::array<float,2>{0.446031868f, 0.0272662155f},
-std::array<float,2>{0.282471329f, 0.660261154f},
-std::array<float,2>{0.756295323f, 0.186610699f},
-std::array<float,2>{0.570631385f, 0.76423502f},
-std::array<float,2>{0.189130336f, 0.324491173f},
-std::array<float,2>{0.165235028f, 0.527478755f},
-std::array<float,2>{0.552821577f, 0.0908729285f},
-std::array<float,2>{0.83464855f, 0.928218544f},
-std::array<float,2>{0.34340632f, 0.485013753f},
-std::array<float,2>{0.437168002f, 0.860777378f},
-std::array<float,2>{0.953517973f, 0.301250398f},
-std::array<float,2>{0.707170129f, 0.737568855f},
-std::array<float,2>{0.120249867f, 0.202843145f},
-std::array<float,2>{0.144230321f, 0.990849078f},
-std::array<float,2>{0.526810408f, 0.415685385f},
-std::array<float,2>{0.864408016f, 0.618004382f},
-std::array<float,2>{0.349121213f, 0.0207250211f},
-std::array<float,2>{0.400341213f, 0.667330742f},
-std::array<float,2>{0.974457622f, 0.174699068f},
-std::array<float,2>{0.744478524f, 0.755089223f},
-std::array<float,2>{0.0883702859f, 0.312540025f},
-std::array<float,2>{0.052749306f, 0.522023797f},
-std::array<float,2>{0.646347523f, 0.0848929286f},
-std::array<float,2>{0.893724263f, 0.929760098f},
-std::array<float,2>{0.478969753f, 0.492592782f},
-std::array<float,2>{0.275677711f, 0.868633628f},
-std::array<float,2>{0.801739395f, 0.312460989f},
-std::array<float,2>{0.618629336f, 0.743519485f},
-std::array<float,2>{0.24054423f, 0.19443126f},
-std::array<float,2>{0.109426163f, 0.790832579f},
-std::array<float,2>{0.711439848f, 0.372689247f},
-std::array<float,2>{0.963958144f, 0.626890779f},
-std::array<float,2>{0.427363575f, 0.144942164f},
-std::array<float,2>{0.335710555f, 0.586264193f},
-std::array<float,2>{0.842287362f, 0.0549036823f},
-std::array<float,2>{0.558382988f, 0.949347317f},
-std::array<float,2>{0.161997586f, 0.382552296f},
-std::array<float,2>{0.199312866f, 0.713616192f},
-std::array<float,2>{0.56506151f, 0.235810176f},
-std::array<float,2>{0.76435709f, 0.840878725f},
-std::array<float,2>{0.289569527f, 0.274377227f},
-std::array<float,2>{0.443487138f, 0.894688964f},
-std::array<float,2>{0.913485765f, 0.466065913f},
-std::array<float,2>{0.662225723f, 0.557160437f},
-std::array<float,2>{0.0284580868f, 0.109611437f},
-std::array<float,2>{0.220149472f, 0.823180139f},
-std::array<float,2>{0.606164277f, 0.252182066f},
-std::array<float,2>{0.790707648f, 0.699519038f},
-std::array<float,2>{0.252995223f, 0.220061377f},
-std::array<float,2>{0.49523443f, 0.53415972f},
-std::array<float,2>{0.889679909f, 0.105871849f},
-std::array<float,2>{0.636173964f, 0.888707161f},
-std::array<float,2>{0.0416954942f, 0.451850146f},
-std::array<float,2>{0.0634513199f, 0.655421615f},
-std::array<float,2>{0.7229563f, 0.136162624f},
-std::array<float,2>{0.997669995f, 0.805395246f},
-std::array<float,2>{0.384450555f, 0.349102288f},
-std::array<float,2>{0.367839843f, 0.955334842f},
-std::array<float,2>{0.848404169f, 0.401788116f},
-std::array<float,2>{0.502327263f, 0.572585046f},
-std::array<float,2>{0.131181031f, 0.0462738052f},
-std::array<float,2>{0.0108777964f, 0.912136912f},
-std::array<float,2>{0.687001228f, 0.479158312f},
-std::array<float,2>{0.937445104f, 0.502757192f},
-std::array<float,2>{0.45325771f, 0.0718408599f},
-std::array<float,2>{0.305290967f, 0.722906768f},
-std::array<float,2>{0.767903388f, 0.218344346f},
-std::array<float,2>{0.583493233f, 0.845157683f},
-std::array<float,2>{0.218044445f, 0.285909534f},
-std::array<float,2>{0.171970561f, 0.600667417f},
-std::array<float,2>{0.544015884f, 0.0075524468f},
-std::array<float,2>{0.817557216f, 0.971051216f},
-std::array<float,2>{0.324499577f, 0.437137991f},
-std::array<float,2>{0.414694846f, 0.773258209f},
-std::array<float,2>{0.949822307f, 0.332542777f},
-std::array<float,2>{0.701806605f, 0.678096652f},
-std::array<float,2>{0.0999540761f, 0.159375727f},
-std::array<float,2>{0.205930084f, 0.88206917f},
-std::array<float,2>{0.592356682f, 0.44250983f},
-std::array<float,2>{0.774992585f, 0.545833826f},
-std::array<float,2>{0.30215475f, 0.0957865119f},
-std::array<float,2>{0.462163776f, 0.68906337f},
-std::array<float,2>{0.926551342f, 0.227143407f},
-std::array<float,2>{0.679534078f, 0.813078463f},
-std::array<float,2>{0.0047437977f, 0.260231942f},
-std::array<float,2>{0.101970091f, 0.567814887f},
-std::array<float,2>{0.690897048f, 0.0386220925f},
-std::array<float,2>{0.940047741f, 0.961987913f},
-std::array<float,2>{0.409570485f, 0.392928272f},
-std::array<float,2>{0.313900143f, 0.802013099f},
-std::array<float,2>{0.827160954f, 0.354103982f},
-std::array<float,2>{0.535595536f, 0.648373246f},
-std::array<float,2>{0.181061536f, 0.126448676f},
-std::array<float,2>{0.0342712104f, 0.852289855f},
-std::array<float,2>{0.62635529f, 0.296828926f},
-std::array<float,2>{0.880012035f, 0.727782667f},
-std::array<float,2>{0.486475527f, 0.208854392f},
-std::array<float,2>{0.264725894f, 0.515371799f},
-std::array<float,2>{0.782650471f, 0.0700713173f},
-std::array<float,2>{0.594380021f, 0.916088998f},
-std::array<float,2>{0.230434224f, 0.471764475f},
-std::array<float,2>{0.137567863f, 0.687091589f},
-std::array<float,2>{0.509345651f, 0.165062949f},
-std::array<float,2>{0.858864188f, 0.779135466f},
-std::array<float,2>{0.36113435f, 0.335994512f},
-std::array<float,2>{0.382021546f, 0.981165588f},
-std::array<float,2>{0.988982201f, 0.429049462f},
-std::array<float,2>{0.730733156f, 0.602686584f},
-std::array<float,2>{0.0741722882f, 0.0114298789f},
-std::array<float,2>{0.167512119f, 0.765509784f},
-std::array<float,2>{0.552042305f, 0.32589969f},
-std::array<float,2>{0.833401263f, 0.661644638f},
-std::array<float,2>{0.341771096f, 0.18557319f},
-std::array<float,2>{0.43461597f, 0.609617352f},
-std::array<float,2>{0.955271006f, 0.0262753796f},
-std::array<float,2>{0.710865378f, 0.993679702f},
-std::array<float,2>{0.118898667f, 0.409821481f},
-std::array<float,2>{0.0175529774f, 0.736359179f},
-std::array<float,2>{0.664075494f, 0.201676682f},
-std::array<float,2>{0.916429698f, 0.859542966f},
-std::array<float,2>{0.448192149f, 0.302726805f},
-std::array<float,2>{0.284598738f, 0.92918092f},
-std::array<float,2>{0.754063964f, 0.486241192f},
-std::array<float,2>{0.573853076f, 0.528704107f},
-std::array<float,2>{0.190599635f, 0.0901283771f},
-std::array<float,2>{0.0821854025f, 0.940951109f},
-std::array<float,2>{0.736797333f, 0.388968617f},
-std::array<float,2>{0.977056265f, 0.585058987f},
-std::array<float,2>{0.397094667f, 0.0518579707f},
-std::array<float,2>{0.35401687f, 0.638997197f},
-std::array<float,2>{0.870036185f, 0.15192607f},
-std::array<float,2>{0.51709044f, 0.78774035f},
-std::array<float,2>{0.153351218f, 0.363562942f},
-std::array<float,2>{0.242951244f, 0.548005462f},
-std::array<float,2>{0.610223234f, 0.124778062f},
-std::array<float,2>{0.805171013f, 0.905292451f},
-std::array<float,2>{0.26803863f, 0.459354579f},
-std::array<float,2>{0.474856138f, 0.834783077f},
-std::array<float,2>{0.899184585f, 0.266079187f},
-std::array<float,2>{0.649717927f, 0.704435229f},
-std::array<float,2>{0.0579897016f, 0.246043235f},
-std::array<float,2>{0.235390693f, 0.965435565f},
-std::array<float,2>{0.623631954f, 0.395109624f},
-std::array<float,2>{0.797568917f, 0.565880299f},
-std::array<float,2>{0.280091554f, 0.0335535072f},
-std::array<float,2>{0.481195003f, 0.642020583f},
-std::array<float,2>{0.898271322f, 0.130655855f},
-std::array<float,2>{0.644482672f, 0.799920559f},
-std::array<float,2>{0.0474592522f, 0.357604414f},
-std::array<float,2>{0.0901135057f, 0.542510688f},
-std::array<float,2>{0.749165833f, 0.098385267f},
-std::array<float,2>{0.9711532f, 0.876875222f},
-std::array<float,2>{0.403518528f, 0.439268202f},
-std::array<float,2>{0.34608376f, 0.818745077f},
-std::array<float,2>{0.8612746f, 0.265368551f},
-std::array<float,2>{0.530405402f, 0.692547321f},
-std::array<float,2>{0.146880925f, 0.233507335f},
-std::array<float,2>{0.0272540357f, 0.776650429f},
-std::array<float,2>{0.659293592f, 0.341631711f},
-std::array<float,2>{0.907817781f, 0.679758072f},
-std::array<float,2>{0.441395044f, 0.170570046f},
-std::array<float,2>{0.294956475f, 0.608515263f},
-std::array<float,2>{0.760596871f, 0.0129896104f},
-std::array<float,2>{0.56698668f, 0.979737103f},
-std::array<float,2>{0.197312385f, 0.423209876f},
-std::array<float,2>{0.156508297f, 0.733564615f},
-std::array<float,2>{0.558820486f, 0.206239313f},
-std::array<float,2>{0.838190734f, 0.858629405f},
-std::array<float,2>{0.328754753f, 0.290330589f},
-std::array<float,2>{0.424222529f, 0.919154167f},
-std::array<float,2>{0.966330469f, 0.473131537f},
-std::array<float,2>{0.718582094f, 0.508518279f},
-std::array<float,2>{0.113718487f, 0.0631960705f},
-std::array<float,2>{0.128341496f, 0.865950823f},
-std::array<float,2>{0.507039309f, 0.300487727f},
-std::array<float,2>{0.845837593f, 0.741463184f},
-std::array<float,2>{0.373355001f, 0.198355988f},
-std::array<float,2>{0.390298307f, 0.525815368f},
-std::array<float,2>{0.992577314f, 0.0877778083f},
-std::array<float,2>{0.721743941f, 0.924288452f},
-std::array<float,2>{0.0686874017f, 0.490974128f},
-std::array<float,2>{0.0454236269f, 0.658932269f},
-std::array<float,2>{0.639217973f, 0.180014759f},
-std::array<float,2>{0.886673331f, 0.760740817f},
-std::array<float,2>{0.496530414f, 0.32061857f},
-std::array<float,2>{0.254568785f, 0.997390211f},
-std::array<float,2>{0.795194805f, 0.411501735f},
-std::array<float,2>{0.60343647f, 0.615229607f},
-std::array<float,2>{0.224483222f, 0.0307919718f},
-std::array<float,2>{0.0962482616f, 0.900594831f},
-std::array<float,2>{0.696341217f, 0.454482198f},
-std::array<float,2>{0.948498368f, 0.551428139f},
-std::array<float,2>{0.41929695f, 0.119371928f},
-std::array<float,2>{0.321232527f, 0.707236111f},
-std::array<float,2>{0.813804269f, 0.246940061f},
-std::array<float,2>{0.539742112f, 0.831073642f},
-std::array<float,2>{0.177985311f, 0.271667778f},
-std::array<float,2>{0.212141067f, 0.580377936f},
-std::array<float,2>{0.580009818f, 0.0499950387f},
-std::array<float,2>{0.771203399f, 0.942060351f},
-std::array<float,2>{0.308643401f, 0.38418901f},
-std::array<float,2>{0.457984924f, 0.783471525f},
-std::array<float,2>{0.932015359f, 0.361580104f},
-std::array<float,2>{0.680145442f, 0.633238852f},
-std::array<float,2>{0.0146201421f, 0.155630231f},
-std::array<float,2>{0.186616153f, 0.933941364f},
-std::array<float,2>{0.532944083f, 0.497656375f},
-std::array<float,2>{0.823885262f, 0.518167436f},
-std::array<float,2>{0.317720115f, 0.0785562098f},
-std::array<float,2>{0.410481691f, 0.746978641f},
-std::array<float,2>{0.942289114f, 0.188047126f},
-std::array<float,2>{0.692011118f, 0.872365475f},
-std::array<float,2>{0.108529463f, 0.306322217f},
-std::array<float,2>{0.000625116751f, 0.624737501f},
-std::array<float,2>{0.67466265f, 0.0176927503f},
-std::array<float,2>{0.921885312f, 0.986398995f},
-std::array<float,2>{0.466739744f, 0.421771348f},
-std::array<float,2>{0.297250181f, 0.750216782f},
-std::array<float,2>{0.780684292f, 0.319900393f},
-std::array<float,2>{0.589499831f, 0.671267211f},
-std::array<float,2>{0.207170323f, 0.178394467f},
-std::array<float,2>{0.0770252272f, 0.839052081f},
-std::array<float,2>{0.729735196f, 0.281153828f},
-std::array<float,2>{0.987391233f, 0.718487561f},
-std::array<float,2>{0.376649886f, 0.239099205f},
-std::array<float,2>{0.365950018f, 0.562107503f},
-std::array<float,2>{0.851703823f, 0.116577871f},
-std::array<float,2>{0.515135944f, 0.893969297f},
-std::array<float,2>{0.136010483f, 0.461490095f},
-std::array<float,2>{0.231674597f, 0.629624367f},
-std::array<float,2>{0.599510729f, 0.142632484f},
-std::array<float,2>{0.787606597f, 0.796743333f},
-std::array<float,2>{0.259893507f, 0.368469924f},
-std::array<float,2>{0.488992304f, 0.945566535f},
-std::array<float,2>{0.875354052f, 0.376000285f},
-std::array<float,2>{0.631752551f, 0.590312421f},
-std::array<float,2>{0.0383668765f, 0.0604880005f},
-std::array<float,2>{0.193967089f, 0.811656535f},
-std::array<float,2>{0.575170159f, 0.345436364f},
-std::array<float,2>{0.750675201f, 0.648520112f},
-std::array<float,2>{0.287423998f, 0.137302637f},
-std::array<float,2>{0.452968359f, 0.576165736f},
-std::array<float,2>{0.920251489f, 0.0419578217f},
-std::array<float,2>{0.671512425f, 0.960204661f},
-std::array<float,2>{0.0198810939f, 0.403060704f},
-std::array<float,2>{0.121932261f, 0.695688307f},
-std::array<float,2>{0.704976976f, 0.224714771f},
-std::array<float,2>{0.958128512f, 0.8257671f},
-std::array<float,2>{0.430002481f, 0.25615868f},
-std::array<float,2>{0.337241918f, 0.884605706f},
-std::array<float,2>{0.828876913f, 0.447233558f},
-std::array<float,2>{0.550514162f, 0.537748337f},
-std::array<float,2>{0.171381146f, 0.103001833f},
-std::array<float,2>{0.0617346242f, 0.975982904f},
-std::array<float,2>{0.652969658f, 0.431426972f},
-std::array<float,2>{0.90303719f, 0.596085072f},
-std::array<float,2>{0.469216168f, 0.00264908536f},
-std::array<float,2>{0.270819902f, 0.675429285f},
-std::array<float,2>{0.808918834f, 0.161805764f},
-std::array<float,2>{0.613901675f, 0.769510388f},
-std::array<float,2>{0.248355299f, 0.33141005f},
-std::array<float,2>{0.151075885f, 0.507776678f},
-std::array<float,2>{0.52226615f, 0.0753304884f},
-std::array<float,2>{0.873810649f, 0.908551455f},
-std::array<float,2>{0.359053642f, 0.481421053f},
-std::array<float,2>{0.391796052f, 0.85125488f},
-std::array<float,2>{0.984056294f, 0.281677216f},
-std::array<float,2>{0.740834415f, 0.719244778f},
-std::array<float,2>{0.0801705346f, 0.212544546f},
-std::array<float,2>{0.162481099f, 0.953015208f},
-std::array<float,2>{0.556484222f, 0.380007088f},
-std::array<float,2>{0.840212762f, 0.588970482f},
-std::array<float,2>{0.332440585f, 0.0578806251f},
-std::array<float,2>{0.428292006f, 0.627299547f},
-std::array<float,2>{0.962386608f, 0.147023186f},
-std::array<float,2>{0.713891029f, 0.792779446f},
-std::array<float,2>{0.11200361f, 0.373928159f},
-std::array<float,2>{0.0310649984f, 0.556226611f},
-std::array<float,2>{0.661420763f, 0.112396494f},
-std::array<float,2>{0.910544991f, 0.896670759f},
-std::array<float,2>{0.44240284f, 0.467526555f},
-std::array<float,2>{0.291854203f, 0.84338069f},
-std::array<float,2>{0.763148606f, 0.276588291f},
-std::array<float,2>{0.56416887f, 0.711599469f},
-std::array<float,2>{0.20215714f, 0.23790133f},
-std::array<float,2>{0.0874567702f, 0.757784367f},
-std::array<float,2>{0.744041681f, 0.315471351f},
-std::array<float,2>{0.975637674f, 0.664435744f},
-std::array<float,2>{0.400513619f, 0.173398525f},
-std::array<float,2>{0.350890487f, 0.619688869f},
-std::array<float,2>{0.865625799f, 0.0218838658f},
-std::array<float,2>{0.523466051f, 0.988854229f},
-std::array<float,2>{0.141000003f, 0.417103052f},
-std::array<float,2>{0.239778325f, 0.744312286f},
-std::array<float,2>{0.619622171f, 0.19182469f},
-std::array<float,2>{0.803182662f, 0.870579064f},
-std::array<float,2>{0.273597926f, 0.308874309f},
-std::array<float,2>{0.47706309f, 0.932071507f},
-std::array<float,2>{0.891302168f, 0.494807631f},
-std::array<float,2>{0.646674573f, 0.520491242f},
-std::array<float,2>{0.052007135f, 0.0837441757f},
-std::array<float,2>{0.216205537f, 0.84682399f},
-std::array<float,2>{0.585610867f, 0.28751874f},
-std::array<float,2>{0.76705569f, 0.726166725f},
-std::array<float,2>{0.307758659f, 0.215882793f},
-std::array<float,2>{0.456913888f, 0.50055629f},
-std::array<float,2>{0.933888376f, 0.0740053505f},
-std::array<float,2>{0.683816433f, 0.911663771f},
-std::array<float,2>{0.00815357082f, 0.477498263f},
-std::array<float,2>{0.0987167135f, 0.676540136f},
-std::array<float,2>{0.700854063f, 0.157913774f},
-std::array<float,2>{0.951701641f, 0.770732939f},
-std::array<float,2>{0.417613268f, 0.335770935f},
-std::array<float,2>{0.32697615f, 0.970473409f},
-std::array<float,2>{0.818675101f, 0.435234576f},
-std::array<float,2>{0.545780241f, 0.599117875f},
-std::array<float,2>{0.174470127f, 0.00563020492f},
-std::array<float,2>{0.0402100794f, 0.886745095f},
-std::array<float,2>{0.633397758f, 0.449765891f},
-std::array<float,2>{0.887673199f, 0.532519579f},
-std::array<float,2>{0.493866235f, 0.10835655f},
-std::array<float,2>{0.250167191f, 0.702914715f},
-std::array<float,2>{0.79184556f, 0.221741974f},
-std::array<float,2>{0.609265327f, 0.820897758f},
-std::array<float,2>{0.222350433f, 0.250823438f},
-std::array<float,2>{0.130612373f, 0.572188854f},
-std::array<float,2>{0.50042671f, 0.0445249192f},
-std::array<float,2>{0.850014567f, 0.954457521f},
-std::array<float,2>{0.370255738f, 0.399133265f},
-std::array<float,2>{0.38638252f, 0.808180332f},
-std::array<float,2>{0.999201775f, 0.351270765f},
-std::array<float,2>{0.726196229f, 0.654253125f},
-std::array<float,2>{0.0658865497f, 0.134021103f},
-std::array<float,2>{0.227210969f, 0.915504575f},
-std::array<float,2>{0.597548604f, 0.470232576f},
-std::array<float,2>{0.783594131f, 0.512368023f},
-std::array<float,2>{0.262504369f, 0.0683183521f},
-std::array<float,2>{0.485807151f, 0.729772091f},
-std::array<float,2>{0.881299734f, 0.210104495f},
-std::array<float,2>{0.62787962f, 0.854154646f},
-std::array<float,2>{0.0316226296f, 0.293313801f},
-std::array<float,2>{0.0707458928f, 0.605442405f},
-std::array<float,2>{0.732771516f, 0.00871483795f},
-std::array<float,2>{0.990503848f, 0.982902169f},
-std::array<float,2>{0.379287958f, 0.426423341f},
-std::array<float,2>{0.362466991f, 0.779786766f},
-std::array<float,2>{0.856428206f, 0.339422137f},
-std::array<float,2>{0.511516571f, 0.684783459f},
-std::array<float,2>{0.138813213f, 0.166248888f},
-std::array<float,2>{0.00703812391f, 0.815579772f},
-std::array<float,2>{0.676942945f, 0.259055763f},
-std::array<float,2>{0.928079605f, 0.690723717f},
-std::array<float,2>{0.463836581f, 0.229225084f},
-std::array<float,2>{0.303856552f, 0.543121278f},
-std::array<float,2>{0.777082324f, 0.0949234664f},
-std::array<float,2>{0.590019763f, 0.880166829f},
-std::array<float,2>{0.203712761f, 0.444166511f},
-std::array<float,2>{0.183275118f, 0.645293772f},
-std::array<float,2>{0.537626326f, 0.127218515f},
-std::array<float,2>{0.824765205f, 0.802838624f},
-std::array<float,2>{0.314749748f, 0.352605492f},
-std::array<float,2>{0.4076069f, 0.964377046f},
-std::array<float,2>{0.938300729f, 0.391331732f},
-std::array<float,2>{0.687815785f, 0.568711817f},
-std::array<float,2>{0.104261555f, 0.0363506153f},
-std::array<float,2>{0.154646665f, 0.786088049f},
-std::array<float,2>{0.518834054f, 0.366445869f},
-std::array<float,2>{0.867868364f, 0.638498545f},
-std::array<float,2>{0.35310179f, 0.148909047f},
-std::array<float,2>{0.395319879f, 0.582129121f},
-std::array<float,2>{0.979670823f, 0.0531060807f},
-std::array<float,2>{0.736036181f, 0.937772691f},
-std::array<float,2>{0.0847684667f, 0.387804985f},
-std::array<float,2>{0.0564341769f, 0.706404269f},
-std::array<float,2>{0.651449025f, 0.243914634f},
-std::array<float,2>{0.901407301f, 0.833599627f},
-std::array<float,2>{0.473844945f, 0.267912239f},
-std::array<float,2>{0.266436607f, 0.903601646f},
-std::array<float,2>{0.807261467f, 0.458293736f},
-std::array<float,2>{0.611625016f, 0.550521374f},
-std::array<float,2>{0.246047243f, 0.122433774f},
-std::array<float,2>{0.120450817f, 0.995999396f},
-std::array<float,2>{0.707442403f, 0.407128185f},
-std::array<float,2>{0.953132451f, 0.612469077f},
-std::array<float,2>{0.437445909f, 0.0237280261f},
-std::array<float,2>{0.343690872f, 0.663126349f},
-std::array<float,2>{0.834809065f, 0.1845669f},
-std::array<float,2>{0.553012848f, 0.763137102f},
-std::array<float,2>{0.165476695f, 0.32643643f},
-std::array<float,2>{0.189244628f, 0.530884504f},
-std::array<float,2>{0.570547283f, 0.0920097455f},
-std::array<float,2>{0.755957305f, 0.92747587f},
-std::array<float,2>{0.28232342f, 0.486488968f},
-std::array<float,2>{0.446205288f, 0.862818599f},
-std::array<float,2>{0.915928543f, 0.304400444f},
-std::array<float,2>{0.666981697f, 0.735731721f},
-std::array<float,2>{0.0183047783f, 0.199589416f},
-std::array<float,2>{0.196404874f, 0.976923704f},
-std::array<float,2>{0.568582714f, 0.424212009f},
-std::array<float,2>{0.759263635f, 0.605964661f},
-std::array<float,2>{0.29332757f, 0.0144011378f},
-std::array<float,2>{0.43764621f, 0.68211174f},
-std::array<float,2>{0.908893168f, 0.168321118f},
-std::array<float,2>{0.657814682f, 0.773710787f},
-std::array<float,2>{0.0236781538f, 0.343344629f},
-std::array<float,2>{0.11576061f, 0.510942698f},
-std::array<float,2>{0.715382516f, 0.0649827868f},
-std::array<float,2>{0.966809988f, 0.921010435f},
-std::array<float,2>{0.423200965f, 0.475062132f},
-std::array<float,2>{0.330368668f, 0.85652113f},
-std::array<float,2>{0.835950851f, 0.291318953f},
-std::array<float,2>{0.562392056f, 0.731312811f},
-std::array<float,2>{0.159493133f, 0.203749195f},
-std::array<float,2>{0.049293831f, 0.797096133f},
-std::array<float,2>{0.641070545f, 0.355497599f},
-std::array<float,2>{0.894860804f, 0.643202364f},
-std::array<float,2>{0.482745498f, 0.132801697f},
-std::array<float,2>{0.277845472f, 0.563882113f},
-std::array<float,2>{0.799091637f, 0.0318496898f},
-std::array<float,2>{0.622403026f, 0.968467712f},
-std::array<float,2>{0.238272861f, 0.39670074f},
-std::array<float,2>{0.146368831f, 0.693393886f},
-std::array<float,2>{0.527759254f, 0.230540976f},
-std::array<float,2>{0.861595929f, 0.816439509f},
-std::array<float,2>{0.344332993f, 0.262376249f},
-std::array<float,2>{0.405697167f, 0.877889037f},
-std::array<float,2>{0.968877971f, 0.439530432f},
-std::array<float,2>{0.747047544f, 0.539131701f},
-std::array<float,2>{0.092701517f, 0.0996718556f},
-std::array<float,2>{0.177059233f, 0.829892635f},
-std::array<float,2>{0.541897595f, 0.270720363f},
-std::array<float,2>{0.815566599f, 0.709785402f},
-std::array<float,2>{0.324015379f, 0.248155475f},
-std::array<float,2>{0.420702755f, 0.554600418f},
-std::array<float,2>{0.946401894f, 0.11836464f},
-std::array<float,2>{0.698112547f, 0.900092542f},
-std::array<float,2>{0.0954398811f, 0.455532938f},
-std::array<float,2>{0.0117950002f, 0.635792613f},
-std::array<float,2>{0.681972623f, 0.152345419f},
-std::array<float,2>{0.931558371f, 0.783002019f},
-std::array<float,2>{0.45962882f, 0.360681802f},
-std::array<float,2>{0.311915457f, 0.943881869f},
-std::array<float,2>{0.771564007f, 0.385954648f},
-std::array<float,2>{0.581065118f, 0.579825699f},
-std::array<float,2>{0.214378744f, 0.0480249003f},
-std::array<float,2>{0.0671310574f, 0.922736585f},
-std::array<float,2>{0.719358027f, 0.489690959f},
-std::array<float,2>{0.995454967f, 0.525211632f},
-std::array<float,2>{0.387069702f, 0.0893336311f},
-std::array<float,2>{0.371790469f, 0.740061641f},
-std::array<float,2>{0.843957424f, 0.195408985f},
-std::array<float,2>{0.504538178f, 0.863286853f},
-std::array<float,2>{0.126613572f, 0.298237443f},
-std::array<float,2>{0.225438163f, 0.616860867f},
-std::array<float,2>{0.603662491f, 0.0282666758f},
-std::array<float,2>{0.794746995f, 0.998515189f},
-std::array<float,2>{0.255924523f, 0.412852108f},
-std::array<float,2>{0.498273671f, 0.758134902f},
-std::array<float,2>{0.884271204f, 0.322680652f},
-std::array<float,2>{0.638330817f, 0.656412601f},
-std::array<float,2>{0.0433304198f, 0.182548359f},
-std::array<float,2>{0.13405028f, 0.891469955f},
-std::array<float,2>{0.512824416f, 0.463392437f},
-std::array<float,2>{0.854195654f, 0.55911845f},
-std::array<float,2>{0.365049422f, 0.114547186f},
-std::array<float,2>{0.378628999f, 0.714946866f},
-std::array<float,2>{0.985860288f, 0.240859032f},
-std::array<float,2>{0.727413952f, 0.836354434f},
-std::array<float,2>{0.0747807771f, 0.278328687f},
-std::array<float,2>{0.0357979685f, 0.592211425f},
-std::array<float,2>{0.629052997f, 0.060658168f},
-std::array<float,2>{0.877080619f, 0.94901073f},
-std::array<float,2>{0.491253942f, 0.377752006f},
-std::array<float,2>{0.25893271f, 0.793630362f},
-std::array<float,2>{0.785957098f, 0.370547533f},
-std::array<float,2>{0.599822402f, 0.63195622f},
-std::array<float,2>{0.232576787f, 0.142471179f},
-std::array<float,2>{0.105666921f, 0.87367326f},
-std::array<float,2>{0.69475764f, 0.308424979f},
-std::array<float,2>{0.944703579f, 0.749937892f},
-std::array<float,2>{0.412211329f, 0.190863147f},
-std::array<float,2>{0.318499923f, 0.516170979f},
-std::array<float,2>{0.820593894f, 0.0813747197f},
-std::array<float,2>{0.533818424f, 0.935808361f},
-std::array<float,2>{0.184441492f, 0.499739289f},
-std::array<float,2>{0.209339604f, 0.669325173f},
-std::array<float,2>{0.585996449f, 0.176934943f},
-std::array<float,2>{0.77786845f, 0.752452016f},
-std::array<float,2>{0.300274849f, 0.317447692f},
-std::array<float,2>{0.467642844f, 0.985405624f},
-std::array<float,2>{0.925424218f, 0.417976677f},
-std::array<float,2>{0.672817469f, 0.622743249f},
-std::array<float,2>{0.00205205823f, 0.016719114f},
-std::array<float,2>{0.247705385f, 0.765782893f},
-std::array<float,2>{0.616891921f, 0.32953614f},
-std::array<float,2>{0.811518371f, 0.672675908f},
-std::array<float,2>{0.271569401f, 0.163464531f},
-std::array<float,2>{0.472222775f, 0.595620573f},
-std::array<float,2>{0.905814528f, 0.00147333404f},
-std::array<float,2>{0.654952109f, 0.974333882f},
-std::array<float,2>{0.0590616576f, 0.432886094f},
-std::array<float,2>{0.0799183398f, 0.721345425f},
-std::array<float,2>{0.738972485f, 0.213939965f},
-std::array<float,2>{0.981137276f, 0.847693563f},
-std::array<float,2>{0.393081605f, 0.285154849f},
-std::array<float,2>{0.355840683f, 0.907840669f},
-std::array<float,2>{0.872303963f, 0.483722746f},
-std::array<float,2>{0.520029068f, 0.505850077f},
-std::array<float,2>{0.149514049f, 0.0769825503f},
-std::array<float,2>{0.0234324075f, 0.957505882f},
-std::array<float,2>{0.669323266f, 0.405722767f},
-std::array<float,2>{0.91909945f, 0.578006268f},
-std::array<float,2>{0.450312108f, 0.040715199f},
-std::array<float,2>{0.285725981f, 0.652086258f},
-std::array<float,2>{0.752312481f, 0.139683798f},
-std::array<float,2>{0.576674342f, 0.810071111f},
-std::array<float,2>{0.191928968f, 0.346112639f},
-std::array<float,2>{0.168562829f, 0.535394132f},
-std::array<float,2>{0.547810793f, 0.104681775f},
-std::array<float,2>{0.831940293f, 0.88502413f},
-std::array<float,2>{0.33851704f, 0.448697507f},
-std::array<float,2>{0.433373183f, 0.826893389f},
-std::array<float,2>{0.95965451f, 0.255307645f},
-std::array<float,2>{0.706418812f, 0.697631299f},
-std::array<float,2>{0.123371646f, 0.223863512f},
-std::array<float,2>{0.132167473f, 0.953901052f},
-std::array<float,2>{0.503685653f, 0.399835438f},
-std::array<float,2>{0.849256754f, 0.570640624f},
-std::array<float,2>{0.368315071f, 0.0433179587f},
-std::array<float,2>{0.382985562f, 0.652417839f},
-std::array<float,2>{0.996160388f, 0.133437216f},
-std::array<float,2>{0.724266768f, 0.806640923f},
-std::array<float,2>{0.0638230443f, 0.349662393f},
-std::array<float,2>{0.042426087f, 0.53137219f},
-std::array<float,2>{0.63543421f, 0.108899266f},
-std::array<float,2>{0.889338076f, 0.887980878f},
-std::array<float,2>{0.494300604f, 0.450376779f},
-std::array<float,2>{0.252665579f, 0.821744978f},
-std::array<float,2>{0.789989293f, 0.251342416f},
-std::array<float,2>{0.607306242f, 0.701373756f},
-std::array<float,2>{0.219170839f, 0.221647248f},
-std::array<float,2>{0.100909762f, 0.769650161f},
-std::array<float,2>{0.702749193f, 0.334658831f},
-std::array<float,2>{0.950620115f, 0.677677274f},
-std::array<float,2>{0.415186703f, 0.156651482f},
-std::array<float,2>{0.325720906f, 0.598057091f},
-std::array<float,2>{0.817019105f, 0.00473437225f},
-std::array<float,2>{0.543488026f, 0.969265461f},
-std::array<float,2>{0.173796132f, 0.433780342f},
-std::array<float,2>{0.217094734f, 0.724870384f},
-std::array<float,2>{0.582804382f, 0.21497187f},
-std::array<float,2>{0.769090414f, 0.846659958f},
-std::array<float,2>{0.306077272f, 0.288569897f},
-std::array<float,2>{0.454215735f, 0.910285354f},
-std::array<float,2>{0.936031044f, 0.478386968f},
-std::array<float,2>{0.685941398f, 0.501013994f},
-std::array<float,2>{0.0101203779f, 0.0723694563f},
-std::array<float,2>{0.241423011f, 0.869255841f},
-std::array<float,2>{0.617844164f, 0.309793204f},
-std::array<float,2>{0.802125752f, 0.745858371f},
-std::array<float,2>{0.276403993f, 0.192711294f},
-std::array<float,2>{0.479600698f, 0.520851254f},
-std::array<float,2>{0.89268291f, 0.0828765035f},
-std::array<float,2>{0.644931674f, 0.933279395f},
-std::array<float,2>{0.0538895987f, 0.495559454f},
-std::array<float,2>{0.0896870047f, 0.665609002f},
-std::array<float,2>{0.745596409f, 0.172019601f},
-std::array<float,2>{0.973432243f, 0.756678104f},
-std::array<float,2>{0.399233729f, 0.314519763f},
-std::array<float,2>{0.347740054f, 0.99004513f},
-std::array<float,2>{0.863590419f, 0.416627884f},
-std::array<float,2>{0.526124656f, 0.620286465f},
-std::array<float,2>{0.143262118f, 0.0233943742f},
-std::array<float,2>{0.0278698429f, 0.897784173f},
-std::array<float,2>{0.66353178f, 0.46834445f},
-std::array<float,2>{0.912600398f, 0.554811716f},
-std::array<float,2>{0.444524169f, 0.112021886f},
-std::array<float,2>{0.290365517f, 0.712435663f},
-std::array<float,2>{0.764775991f, 0.236391082f},
-std::array<float,2>{0.566261232f, 0.842391074f},
-std::array<float,2>{0.200760067f, 0.275676996f},
-std::array<float,2>{0.160260156f, 0.588291228f},
-std::array<float,2>{0.557023346f, 0.0571844354f},
-std::array<float,2>{0.843312085f, 0.951815844f},
-std::array<float,2>{0.334169537f, 0.378967792f},
-std::array<float,2>{0.426629186f, 0.791988373f},
-std::array<float,2>{0.963861108f, 0.374723017f},
-std::array<float,2>{0.712501585f, 0.628454506f},
-std::array<float,2>{0.110511251f, 0.148257464f},
-std::array<float,2>{0.190050572f, 0.926173627f},
-std::array<float,2>{0.573033512f, 0.487613112f},
-std::array<float,2>{0.755744696f, 0.529633462f},
-std::array<float,2>{0.283665001f, 0.0928135291f},
-std::array<float,2>{0.448325366f, 0.734416246f},
-std::array<float,2>{0.917324364f, 0.200418815f},
-std::array<float,2>{0.665669203f, 0.862226367f},
-std::array<float,2>{0.016039636f, 0.302759945f},
-std::array<float,2>{0.117919371f, 0.611355662f},
-std::array<float,2>{0.70903641f, 0.0253633317f},
-std::array<float,2>{0.956123829f, 0.994250834f},
-std::array<float,2>{0.434489936f, 0.407812804f},
-std::array<float,2>{0.340362608f, 0.761720777f},
-std::array<float,2>{0.832337141f, 0.327275932f},
-std::array<float,2>{0.551469028f, 0.663038194f},
-std::array<float,2>{0.166808724f, 0.184937716f},
-std::array<float,2>{0.056911923f, 0.832688808f},
-std::array<float,2>{0.649060011f, 0.26866293f},
-std::array<float,2>{0.899443865f, 0.705100894f},
-std::array<float,2>{0.475984633f, 0.243156329f},
-std::array<float,2>{0.269183367f, 0.549417555f},
-std::array<float,2>{0.806233704f, 0.121768661f},
-std::array<float,2>{0.610439837f, 0.902854443f},
-std::array<float,2>{0.243383914f, 0.457367152f},
-std::array<float,2>{0.153123468f, 0.637255788f},
-std::array<float,2>{0.515926301f, 0.150295332f},
-std::array<float,2>{0.870261014f, 0.78661716f},
-std::array<float,2>{0.354509652f, 0.365408391f},
-std::array<float,2>{0.398048669f, 0.93895191f},
-std::array<float,2>{0.977894425f, 0.386837125f},
-std::array<float,2>{0.737795591f, 0.583381355f},
-std::array<float,2>{0.083825469f, 0.0546245761f},
-std::array<float,2>{0.179749936f, 0.804544628f},
-std::array<float,2>{0.536649346f, 0.351774842f},
-std::array<float,2>{0.826764882f, 0.645769715f},
-std::array<float,2>{0.31259343f, 0.128499582f},
-std::array<float,2>{0.408674181f, 0.569689214f},
-std::array<float,2>{0.940833509f, 0.0352201201f},
-std::array<float,2>{0.689480305f, 0.963816464f},
-std::array<float,2>{0.102568261f, 0.391902417f},
-std::array<float,2>{0.00519500021f, 0.690056145f},
-std::array<float,2>{0.678188145f, 0.230006084f},
-std::array<float,2>{0.926984191f, 0.814479351f},
-std::array<float,2>{0.461220652f, 0.258496732f},
-std::array<float,2>{0.301182598f, 0.87907362f},
-std::array<float,2>{0.773963213f, 0.445286572f},
-std::array<float,2>{0.593522727f, 0.544507146f},
-std::array<float,2>{0.206346393f, 0.0940819606f},
-std::array<float,2>{0.0723023564f, 0.983580172f},
-std::array<float,2>{0.731629789f, 0.427291185f},
-std::array<float,2>{0.989539385f, 0.604433f},
-std::array<float,2>{0.381541461f, 0.00914708152f},
-std::array<float,2>{0.359732091f, 0.683881283f},
-std::array<float,2>{0.85742569f, 0.167102963f},
-std::array<float,2>{0.508719504f, 0.78038162f},
-std::array<float,2>{0.138347462f, 0.3382788f},
-std::array<float,2>{0.228742346f, 0.512837768f},
-std::array<float,2>{0.595359504f, 0.0672214478f},
-std::array<float,2>{0.781787455f, 0.915020883f},
-std::array<float,2>{0.263987064f, 0.469631225f},
-std::array<float,2>{0.487488151f, 0.854596019f},
-std::array<float,2>{0.879832506f, 0.294624895f},
-std::array<float,2>{0.625129461f, 0.728912652f},
-std::array<float,2>{0.0334658474f, 0.209833533f},
-std::array<float,2>{0.222745761f, 0.999862492f},
-std::array<float,2>{0.602315485f, 0.413549066f},
-std::array<float,2>{0.796674728f, 0.615913332f},
-std::array<float,2>{0.255475849f, 0.0283616874f},
-std::array<float,2>{0.497918874f, 0.657991886f},
-std::array<float,2>{0.885337293f, 0.182971433f},
-std::array<float,2>{0.640502274f, 0.759552538f},
-std::array<float,2>{0.0468362421f, 0.323818892f},
-std::array<float,2>{0.0694107637f, 0.524034023f},
-std::array<float,2>{0.720862925f, 0.0880025178f},
-std::array<float,2>{0.993197441f, 0.923542738f},
-std::array<float,2>{0.388833612f, 0.488558084f},
-std::array<float,2>{0.374301821f, 0.864936173f},
-std::array<float,2>{0.847406328f, 0.297311276f},
-std::array<float,2>{0.506733775f, 0.739229023f},
-std::array<float,2>{0.127671853f, 0.196625471f},
-std::array<float,2>{0.0148849459f, 0.78201896f},
-std::array<float,2>{0.681430578f, 0.359749854f},
-std::array<float,2>{0.933208942f, 0.634806395f},
-std::array<float,2>{0.458363414f, 0.15399082f},
-std::array<float,2>{0.309834927f, 0.578897953f},
-std::array<float,2>{0.770480871f, 0.0476663709f},
-std::array<float,2>{0.578317404f, 0.944949448f},
-std::array<float,2>{0.211436123f, 0.38570407f},
-std::array<float,2>{0.179493114f, 0.710617542f},
-std::array<float,2>{0.540484726f, 0.249189466f},
-std::array<float,2>{0.812943637f, 0.828594208f},
-std::array<float,2>{0.3215276f, 0.269887924f},
-std::array<float,2>{0.418668419f, 0.89920634f},
-std::array<float,2>{0.947753668f, 0.456236541f},
-std::array<float,2>{0.696258366f, 0.553493977f},
-std::array<float,2>{0.0973680764f, 0.117555752f},
-std::array<float,2>{0.147748038f, 0.818115771f},
-std::array<float,2>{0.529544175f, 0.26284346f},
-std::array<float,2>{0.859907508f, 0.69442898f},
-std::array<float,2>{0.347106874f, 0.232100442f},
-std::array<float,2>{0.402765244f, 0.540057421f},
-std::array<float,2>{0.972113013f, 0.100740403f},
-std::array<float,2>{0.748983741f, 0.878806472f},
-std::array<float,2>{0.0915724561f, 0.440452904f},
-std::array<float,2>{0.0486985706f, 0.644382954f},
-std::array<float,2>{0.643184304f, 0.131484523f},
-std::array<float,2>{0.897340178f, 0.798423827f},
-std::array<float,2>{0.481708974f, 0.35726285f},
-std::array<float,2>{0.280338943f, 0.967423916f},
-std::array<float,2>{0.79844898f, 0.398204267f},
-std::array<float,2>{0.624796867f, 0.562546074f},
-std::array<float,2>{0.234820649f, 0.0331265777f},
-std::array<float,2>{0.114639021f, 0.920067668f},
-std::array<float,2>{0.716940343f, 0.475724787f},
-std::array<float,2>{0.965749264f, 0.510520518f},
-std::array<float,2>{0.424808085f, 0.0655051246f},
-std::array<float,2>{0.329386055f, 0.732248724f},
-std::array<float,2>{0.838899136f, 0.204542577f},
-std::array<float,2>{0.559908152f, 0.856218398f},
-std::array<float,2>{0.157340631f, 0.292186946f},
-std::array<float,2>{0.198800743f, 0.607314646f},
-std::array<float,2>{0.567837596f, 0.0150938379f},
-std::array<float,2>{0.761674106f, 0.977811038f},
-std::array<float,2>{0.296494812f, 0.425385445f},
-std::array<float,2>{0.439952046f, 0.774965584f},
-std::array<float,2>{0.906846285f, 0.342221916f},
-std::array<float,2>{0.658278883f, 0.682628691f},
-std::array<float,2>{0.0261889081f, 0.169578239f},
-std::array<float,2>{0.170144767f, 0.88615191f},
-std::array<float,2>{0.549118161f, 0.447491288f},
-std::array<float,2>{0.830072284f, 0.536859214f},
-std::array<float,2>{0.336314976f, 0.103618234f},
-std::array<float,2>{0.430915624f, 0.698771834f},
-std::array<float,2>{0.957181215f, 0.222873434f},
-std::array<float,2>{0.703432977f, 0.827774346f},
-std::array<float,2>{0.122279011f, 0.253998131f},
-std::array<float,2>{0.0210232735f, 0.576192737f},
-std::array<float,2>{0.670693636f, 0.0397630595f},
-std::array<float,2>{0.921235025f, 0.958562732f},
-std::array<float,2>{0.451647907f, 0.405042082f},
-std::array<float,2>{0.288469225f, 0.809008062f},
-std::array<float,2>{0.75163424f, 0.347376764f},
-std::array<float,2>{0.576030791f, 0.650830567f},
-std::array<float,2>{0.194390297f, 0.139608592f},
-std::array<float,2>{0.0812063068f, 0.849405468f},
-std::array<float,2>{0.741562009f, 0.283606321f},
-std::array<float,2>{0.982945919f, 0.721712649f},
-std::array<float,2>{0.391334653f, 0.213615865f},
-std::array<float,2>{0.358035445f, 0.504651606f},
-std::array<float,2>{0.8743186f, 0.0779930949f},
-std::array<float,2>{0.522516072f, 0.907001853f},
-std::array<float,2>{0.151604623f, 0.483010739f},
-std::array<float,2>{0.249640852f, 0.672951579f},
-std::array<float,2>{0.614703953f, 0.162423596f},
-std::array<float,2>{0.809860289f, 0.767422438f},
-std::array<float,2>{0.270339787f, 0.329055399f},
-std::array<float,2>{0.470549405f, 0.973172188f},
-std::array<float,2>{0.90384388f, 0.432069927f},
-std::array<float,2>{0.653948009f, 0.59462738f},
-std::array<float,2>{0.0614987276f, 0.0003423421f},
-std::array<float,2>{0.208387911f, 0.753700197f},
-std::array<float,2>{0.587921977f, 0.317356795f},
-std::array<float,2>{0.779633582f, 0.668618917f},
-std::array<float,2>{0.298642427f, 0.176616982f},
-std::array<float,2>{0.465671659f, 0.621364415f},
-std::array<float,2>{0.923032582f, 0.0164146405f},
-std::array<float,2>{0.674907088f, 0.984968841f},
-std::array<float,2>{0.00120041473f, 0.419073582f},
-std::array<float,2>{0.107545085f, 0.748645902f},
-std::array<float,2>{0.69318068f, 0.189551145f},
-std::array<float,2>{0.942624629f, 0.874537706f},
-std::array<float,2>{0.411618263f, 0.307222694f},
-std::array<float,2>{0.316410631f, 0.937458515f},
-std::array<float,2>{0.822881639f, 0.498393804f},
-std::array<float,2>{0.53174746f, 0.517224491f},
-std::array<float,2>{0.18593663f, 0.0805500299f},
-std::array<float,2>{0.0379835404f, 0.947288156f},
-std::array<float,2>{0.632296801f, 0.378035039f},
-std::array<float,2>{0.876262844f, 0.592912793f},
-std::array<float,2>{0.490020305f, 0.0619101897f},
-std::array<float,2>{0.261303902f, 0.630950451f},
-std::array<float,2>{0.788354695f, 0.140784502f},
-std::array<float,2>{0.598068774f, 0.794561684f},
-std::array<float,2>{0.23111847f, 0.369388998f},
-std::array<float,2>{0.135534555f, 0.560528338f},
-std::array<float,2>{0.514358759f, 0.114142276f},
-std::array<float,2>{0.852654815f, 0.891926289f},
-std::array<float,2>{0.366764784f, 0.464340955f},
-std::array<float,2>{0.375915229f, 0.837196469f},
-std::array<float,2>{0.98654592f, 0.278194159f},
-std::array<float,2>{0.729000747f, 0.716074705f},
-std::array<float,2>{0.0773838982f, 0.241715014f},
-std::array<float,2>{0.175579458f, 0.972414434f},
-std::array<float,2>{0.546366036f, 0.436276525f},
-std::array<float,2>{0.819766223f, 0.599869311f},
-std::array<float,2>{0.327528834f, 0.00594617333f},
-std::array<float,2>{0.41640681f, 0.678888857f},
-std::array<float,2>{0.952553153f, 0.15858674f},
-std::array<float,2>{0.699543953f, 0.7724154f},
-std::array<float,2>{0.098153621f, 0.333061606f},
-std::array<float,2>{0.00969741121f, 0.502980411f},
-std::array<float,2>{0.68496567f, 0.0704881623f},
-std::array<float,2>{0.935427487f, 0.913219094f},
-std::array<float,2>{0.455208749f, 0.480055451f},
-std::array<float,2>{0.30750984f, 0.843900621f},
-std::array<float,2>{0.7663607f, 0.2863231f},
-std::array<float,2>{0.584697306f, 0.724196732f},
-std::array<float,2>{0.215483397f, 0.217228398f},
-std::array<float,2>{0.0649105459f, 0.806404889f},
-std::array<float,2>{0.724627733f, 0.348134518f},
-std::array<float,2>{0.998268425f, 0.655234694f},
-std::array<float,2>{0.385450244f, 0.1352918f},
-std::array<float,2>{0.36994651f, 0.573840141f},
-std::array<float,2>{0.851366222f, 0.0453036092f},
-std::array<float,2>{0.501525521f, 0.956720889f},
-std::array<float,2>{0.129439905f, 0.40089798f},
-std::array<float,2>{0.221344993f, 0.700916409f},
-std::array<float,2>{0.608217657f, 0.218774825f},
-std::array<float,2>{0.792485595f, 0.824190974f},
-std::array<float,2>{0.25190106f, 0.253206253f},
-std::array<float,2>{0.492878109f, 0.890382409f},
-std::array<float,2>{0.888284743f, 0.45257026f},
-std::array<float,2>{0.633912742f, 0.534287095f},
-std::array<float,2>{0.0399075411f, 0.106911674f},
-std::array<float,2>{0.202063113f, 0.840024352f},
-std::array<float,2>{0.563467205f, 0.275210768f},
-std::array<float,2>{0.762271106f, 0.714803457f},
-std::array<float,2>{0.292948663f, 0.23495701f},
-std::array<float,2>{0.441598386f, 0.558428288f},
-std::array<float,2>{0.911664665f, 0.110633738f},
-std::array<float,2>{0.660411775f, 0.896249056f},
-std::array<float,2>{0.0297725033f, 0.465728164f},
-std::array<float,2>{0.112855978f, 0.625878394f},
-std::array<float,2>{0.713188291f, 0.146008253f},
-std::array<float,2>{0.961072266f, 0.789227128f},
-std::array<float,2>{0.428870171f, 0.371558815f},
-std::array<float,2>{0.333347082f, 0.950525343f},
-std::array<float,2>{0.841526508f, 0.381361067f},
-std::array<float,2>{0.555161536f, 0.587761462f},
-std::array<float,2>{0.16349569f, 0.0566048957f},
-std::array<float,2>{0.0517504923f, 0.93103987f},
-std::array<float,2>{0.647789717f, 0.493795961f},
-std::array<float,2>{0.89211601f, 0.523351192f},
-std::array<float,2>{0.47771737f, 0.0857353956f},
-std::array<float,2>{0.274433404f, 0.742485344f},
-std::array<float,2>{0.804166198f, 0.193546221f},
-std::array<float,2>{0.620866716f, 0.867936373f},
-std::array<float,2>{0.238949254f, 0.310792059f},
-std::array<float,2>{0.142062351f, 0.618382096f},
-std::array<float,2>{0.52465409f, 0.0198101588f},
-std::array<float,2>{0.86688894f, 0.991952181f},
-std::array<float,2>{0.349769503f, 0.41430828f},
-std::array<float,2>{0.401814878f, 0.754195452f},
-std::array<float,2>{0.975013971f, 0.313827008f},
-std::array<float,2>{0.742763638f, 0.666239023f},
-std::array<float,2>{0.0863326788f, 0.175771207f},
-std::array<float,2>{0.24492912f, 0.905242205f},
-std::array<float,2>{0.61320442f, 0.460902303f},
-std::array<float,2>{0.808137059f, 0.547767818f},
-std::array<float,2>{0.267116368f, 0.123595506f},
-std::array<float,2>{0.472688258f, 0.704057038f},
-std::array<float,2>{0.901071548f, 0.244995803f},
-std::array<float,2>{0.650730908f, 0.835167229f},
-std::array<float,2>{0.055140622f, 0.267555714f},
-std::array<float,2>{0.0852789134f, 0.584887207f},
-std::array<float,2>{0.734888434f, 0.0512390025f},
-std::array<float,2>{0.978779435f, 0.940252841f},
-std::array<float,2>{0.396420181f, 0.389814317f},
-std::array<float,2>{0.352279127f, 0.788419664f},
-std::array<float,2>{0.869135678f, 0.365184426f},
-std::array<float,2>{0.518232346f, 0.640388727f},
-std::array<float,2>{0.155810609f, 0.150823802f},
-std::array<float,2>{0.0191456564f, 0.860955179f},
-std::array<float,2>{0.667364657f, 0.301616758f},
-std::array<float,2>{0.914341211f, 0.73791194f},
-std::array<float,2>{0.446879774f, 0.202597499f},
-std::array<float,2>{0.282206476f, 0.528043747f},
-std::array<float,2>{0.7576527f, 0.0915950984f},
-std::array<float,2>{0.572180808f, 0.92857635f},
-std::array<float,2>{0.187609136f, 0.484450728f},
-std::array<float,2>{0.164622724f, 0.660842001f},
-std::array<float,2>{0.554489076f, 0.187345147f},
-std::array<float,2>{0.834984601f, 0.763687968f},
-std::array<float,2>{0.341805965f, 0.324825853f},
-std::array<float,2>{0.435607672f, 0.992239833f},
-std::array<float,2>{0.954484046f, 0.408417344f},
-std::array<float,2>{0.708573997f, 0.611085415f},
-std::array<float,2>{0.119696833f, 0.026481092f},
-std::array<float,2>{0.140527189f, 0.778248489f},
-std::array<float,2>{0.510433435f, 0.33768779f},
-std::array<float,2>{0.8566854f, 0.685720444f},
-std::array<float,2>{0.361971587f, 0.164167374f},
-std::array<float,2>{0.380109727f, 0.601726711f},
-std::array<float,2>{0.992019415f, 0.0106933964f},
-std::array<float,2>{0.734176219f, 0.981755674f},
-std::array<float,2>{0.0715166256f, 0.428032845f},
-std::array<float,2>{0.0329953805f, 0.72743392f},
-std::array<float,2>{0.628585637f, 0.207920462f},
-std::array<float,2>{0.882305801f, 0.852759659f},
-std::array<float,2>{0.485284954f, 0.29501012f},
-std::array<float,2>{0.263319612f, 0.917546272f},
-std::array<float,2>{0.784943342f, 0.471482486f},
-std::array<float,2>{0.596389413f, 0.514093816f},
-std::array<float,2>{0.22773549f, 0.0686403066f},
-std::array<float,2>{0.10493286f, 0.961816132f},
-std::array<float,2>{0.688575387f, 0.393723905f},
-std::array<float,2>{0.938583255f, 0.566672742f},
-std::array<float,2>{0.406491399f, 0.0375159942f},
-std::array<float,2>{0.315868199f, 0.646772325f},
-std::array<float,2>{0.826048076f, 0.12573573f},
-std::array<float,2>{0.538116992f, 0.801317751f},
-std::array<float,2>{0.182324231f, 0.355377823f},
-std::array<float,2>{0.204325244f, 0.546431422f},
-std::array<float,2>{0.591160953f, 0.0974410623f},
-std::array<float,2>{0.776131809f, 0.881465852f},
-std::array<float,2>{0.303313345f, 0.442221791f},
-std::array<float,2>{0.463958502f, 0.814196289f},
-std::array<float,2>{0.929400921f, 0.261517912f},
-std::array<float,2>{0.675952137f, 0.687758803f},
-std::array<float,2>{0.00661431672f, 0.228238374f},
-std::array<float,2>{0.213140905f, 0.942946374f},
-std::array<float,2>{0.580342233f, 0.383397698f},
-std::array<float,2>{0.772655427f, 0.581234276f},
-std::array<float,2>{0.311498702f, 0.0492901579f},
-std::array<float,2>{0.460194558f, 0.633905053f},
-std::array<float,2>{0.930518866f, 0.155190855f},
-std::array<float,2>{0.682729304f, 0.784905791f},
-std::array<float,2>{0.0135365352f, 0.362666875f},
-std::array<float,2>{0.0947209299f, 0.552025795f},
-std::array<float,2>{0.698261142f, 0.120150134f},
-std::array<float,2>{0.945588231f, 0.901852489f},
-std::array<float,2>{0.421117008f, 0.453518152f},
-std::array<float,2>{0.323081762f, 0.830330431f},
-std::array<float,2>{0.814715207f, 0.273170412f},
-std::array<float,2>{0.542155027f, 0.708940506f},
-std::array<float,2>{0.17591092f, 0.247157156f},
-std::array<float,2>{0.0446358994f, 0.761429727f},
-std::array<float,2>{0.637395918f, 0.32198f},
-std::array<float,2>{0.883524597f, 0.660093367f},
-std::array<float,2>{0.499897063f, 0.181325153f},
-std::array<float,2>{0.25751546f, 0.61352247f},
-std::array<float,2>{0.793847859f, 0.0297525842f},
-std::array<float,2>{0.605276525f, 0.996179879f},
-std::array<float,2>{0.22643961f, 0.410849273f},
-std::array<float,2>{0.125692666f, 0.74113214f},
-std::array<float,2>{0.505349934f, 0.197633967f},
-std::array<float,2>{0.845677137f, 0.867174923f},
-std::array<float,2>{0.372090489f, 0.299100995f},
-std::array<float,2>{0.387978494f, 0.924937785f},
-std::array<float,2>{0.994472742f, 0.491215676f},
-std::array<float,2>{0.720567465f, 0.526608765f},
-std::array<float,2>{0.0675833896f, 0.0864507183f},
-std::array<float,2>{0.15892905f, 0.857994378f},
-std::array<float,2>{0.561162591f, 0.289670795f},
-std::array<float,2>{0.837623417f, 0.732487619f},
-std::array<float,2>{0.331777483f, 0.205624089f},
-std::array<float,2>{0.422054172f, 0.509511352f},
-std::array<float,2>{0.968340933f, 0.0642520338f},
-std::array<float,2>{0.716043234f, 0.918310344f},
-std::array<float,2>{0.116424523f, 0.474435896f},
-std::array<float,2>{0.0245482773f, 0.681094944f},
-std::array<float,2>{0.65689069f, 0.171004906f},
-std::array<float,2>{0.909929276f, 0.776201904f},
-std::array<float,2>{0.438480288f, 0.34063834f},
-std::array<float,2>{0.294468343f, 0.979310989f},
-std::array<float,2>{0.758090913f, 0.422714293f},
-std::array<float,2>{0.569919348f, 0.60822928f},
-std::array<float,2>{0.19555904f, 0.0118612191f},
-std::array<float,2>{0.0936936736f, 0.875670314f},
-std::array<float,2>{0.747894943f, 0.43767637f},
-std::array<float,2>{0.970530331f, 0.541924059f},
-std::array<float,2>{0.404924572f, 0.0990685374f},
-std::array<float,2>{0.34500137f, 0.692246139f},
-std::array<float,2>{0.863200426f, 0.232425794f},
-std::array<float,2>{0.528470814f, 0.819606066f},
-std::array<float,2>{0.144707903f, 0.264083505f},
-std::array<float,2>{0.237229481f, 0.564911783f},
-std::array<float,2>{0.621292412f, 0.0344672874f},
-std::array<float,2>{0.800605118f, 0.966145515f},
-std::array<float,2>{0.278611839f, 0.39577648f},
-std::array<float,2>{0.484235138f, 0.799427569f},
-std::array<float,2>{0.895673513f, 0.359163612f},
-std::array<float,2>{0.642388463f, 0.6410411f},
-std::array<float,2>{0.0505880639f, 0.129286692f},
-std::array<float,2>{0.149075761f, 0.909929812f},
-std::array<float,2>{0.520814896f, 0.482134193f},
-std::array<float,2>{0.871247053f, 0.506561875f},
-std::array<float,2>{0.356473058f, 0.075159274f},
-std::array<float,2>{0.393840075f, 0.719956577f},
-std::array<float,2>{0.981606901f, 0.21141316f},
-std::array<float,2>{0.739644766f, 0.850334942f},
-std::array<float,2>{0.078987591f, 0.282288373f},
-std::array<float,2>{0.0600051321f, 0.597341061f},
-std::array<float,2>{0.655509055f, 0.00318582403f},
-std::array<float,2>{0.904377639f, 0.975246727f},
-std::array<float,2>{0.471005827f, 0.43016547f},
-std::array<float,2>{0.272818267f, 0.768107414f},
-std::array<float,2>{0.812349916f, 0.330992311f},
-std::array<float,2>{0.615653932f, 0.673925877f},
-std::array<float,2>{0.246327385f, 0.160905287f},
-std::array<float,2>{0.124286793f, 0.824788988f},
-std::array<float,2>{0.7053321f, 0.257635266f},
-std::array<float,2>{0.960485876f, 0.696947634f},
-std::array<float,2>{0.431883246f, 0.226177841f},
-std::array<float,2>{0.339720726f, 0.538730562f},
-std::array<float,2>{0.830774069f, 0.101988867f},
-std::array<float,2>{0.548635602f, 0.883656144f},
-std::array<float,2>{0.169115156f, 0.445321143f},
-std::array<float,2>{0.192430779f, 0.649727166f},
-std::array<float,2>{0.577671409f, 0.138478756f},
-std::array<float,2>{0.753896236f, 0.811502874f},
-std::array<float,2>{0.286853164f, 0.344119459f},
-std::array<float,2>{0.449700415f, 0.95916456f},
-std::array<float,2>{0.918705523f, 0.403691918f},
-std::array<float,2>{0.668852627f, 0.574716449f},
-std::array<float,2>{0.0219697338f, 0.0424864776f},
-std::array<float,2>{0.23387441f, 0.795720518f},
-std::array<float,2>{0.601110101f, 0.367362499f},
-std::array<float,2>{0.787028849f, 0.630546391f},
-std::array<float,2>{0.258158207f, 0.143618688f},
-std::array<float,2>{0.491007805f, 0.591583252f},
-std::array<float,2>{0.878666222f, 0.0595348813f},
-std::array<float,2>{0.630694032f, 0.946609616f},
-std::array<float,2>{0.036898423f, 0.375783503f},
-std::array<float,2>{0.0753838941f, 0.717056632f},
-std::array<float,2>{0.728410184f, 0.239333689f},
-std::array<float,2>{0.985273898f, 0.838850319f},
-std::array<float,2>{0.377528459f, 0.279379755f},
-std::array<float,2>{0.363407761f, 0.892780125f},
-std::array<float,2>{0.855261087f, 0.46241042f},
-std::array<float,2>{0.511795759f, 0.561384857f},
-std::array<float,2>{0.133140102f, 0.116032921f},
-std::array<float,2>{0.00316557777f, 0.987412333f},
-std::array<float,2>{0.673301578f, 0.420856774f},
-std::array<float,2>{0.924563468f, 0.623854339f},
-std::array<float,2>{0.468455523f, 0.0193840992f},
-std::array<float,2>{0.299448222f, 0.670219779f},
-std::array<float,2>{0.778485477f, 0.179608375f},
-std::array<float,2>{0.587657034f, 0.751244664f},
-std::array<float,2>{0.210648954f, 0.318410903f},
-std::array<float,2>{0.185271606f, 0.518992722f},
-std::array<float,2>{0.534992576f, 0.0798091665f},
-std::array<float,2>{0.821969986f, 0.934933782f},
-std::array<float,2>{0.31994915f, 0.496232122f},
-std::array<float,2>{0.413806915f, 0.872046292f},
-std::array<float,2>{0.944290042f, 0.304958761f},
-std::array<float,2>{0.693637073f, 0.747733057f},
-std::array<float,2>{0.106983706f, 0.189228222f},
-std::array<float,2>{0.137922734f, 0.982201338f},
-std::array<float,2>{0.50794673f, 0.428528666f},
-std::array<float,2>{0.858140647f, 0.602244794f},
-std::array<float,2>{0.3598921f, 0.0101659736f},
-std::array<float,2>{0.380904168f, 0.686127365f},
-std::array<float,2>{0.990204215f, 0.165030748f},
-std::array<float,2>{0.731976926f, 0.77745682f},
-std::array<float,2>{0.0730010495f, 0.337113798f},
-std::array<float,2>{0.0339760594f, 0.514313817f},
-std::array<float,2>{0.625928104f, 0.0689670965f},
-std::array<float,2>{0.879229963f, 0.917318523f},
-std::array<float,2>{0.48824206f, 0.470799088f},
-std::array<float,2>{0.264636278f, 0.853275895f},
-std::array<float,2>{0.781664073f, 0.29557091f},
-std::array<float,2>{0.595067024f, 0.726985633f},
-std::array<float,2>{0.229234219f, 0.207425237f},
-std::array<float,2>{0.103445195f, 0.80110085f},
-std::array<float,2>{0.690128922f, 0.354947567f},
-std::array<float,2>{0.941284537f, 0.647424281f},
-std::array<float,2>{0.408884495f, 0.125375882f},
-std::array<float,2>{0.313425452f, 0.567099214f},
-std::array<float,2>{0.826375842f, 0.0380769894f},
-std::array<float,2>{0.536476493f, 0.961223304f},
-std::array<float,2>{0.180636659f, 0.394075096f},
-std::array<float,2>{0.206597567f, 0.688450813f},
-std::array<float,2>{0.593178928f, 0.227992758f},
-std::array<float,2>{0.773561776f, 0.813551128f},
-std::array<float,2>{0.301596224f, 0.260744005f},
-std::array<float,2>{0.461526722f, 0.880943775f},
-std::array<float,2>{0.927357435f, 0.441481441f},
-std::array<float,2>{0.678682387f, 0.546275675f},
-std::array<float,2>{0.00550706312f, 0.0969474837f},
-std::array<float,2>{0.243813023f, 0.835642755f},
-std::array<float,2>{0.611070156f, 0.266615003f},
-std::array<float,2>{0.805861294f, 0.703144491f},
-std::array<float,2>{0.268669546f, 0.244585663f},
-std::array<float,2>{0.476260513f, 0.546968222f},
-std::array<float,2>{0.900005937f, 0.123358175f},
-std::array<float,2>{0.648849249f, 0.904567242f},
-std::array<float,2>{0.0572509766f, 0.460204333f},
-std::array<float,2>{0.0832379758f, 0.639772594f},
-std::array<float,2>{0.737630367f, 0.150991201f},
-std::array<float,2>{0.97830075f, 0.788701892f},
-std::array<float,2>{0.397482902f, 0.3646833f},
-std::array<float,2>{0.355156213f, 0.939526379f},
-std::array<float,2>{0.871088803f, 0.39036119f},
-std::array<float,2>{0.51631403f, 0.584244251f},
-std::array<float,2>{0.152793437f, 0.0513794795f},
-std::array<float,2>{0.0165536515f, 0.927901745f},
-std::array<float,2>{0.665358007f, 0.485248834f},
-std::array<float,2>{0.917862177f, 0.527797282f},
-std::array<float,2>{0.448820263f, 0.0911372751f},
-std::array<float,2>{0.283709615f, 0.737326503f},
-std::array<float,2>{0.755163789f, 0.202883542f},
-std::array<float,2>{0.572349191f, 0.860397756f},
-std::array<float,2>{0.189562872f, 0.300961643f},
-std::array<float,2>{0.166361958f, 0.610441208f},
-std::array<float,2>{0.551242471f, 0.02701688f},
-std::array<float,2>{0.83266896f, 0.992806256f},
-std::array<float,2>{0.340156257f, 0.408816129f},
-std::array<float,2>{0.433817834f, 0.764477134f},
-std::array<float,2>{0.957025528f, 0.324229002f},
-std::array<float,2>{0.709683597f, 0.660429358f},
-std::array<float,2>{0.117364705f, 0.186996296f},
-std::array<float,2>{0.200453103f, 0.895623505f},
-std::array<float,2>{0.565856159f, 0.465062588f},
-std::array<float,2>{0.765442669f, 0.558101535f},
-std::array<float,2>{0.290591627f, 0.110923f},
-std::array<float,2>{0.445167482f, 0.713887334f},
-std::array<float,2>{0.912436426f, 0.234509394f},
-std::array<float,2>{0.663886368f, 0.840584457f},
-std::array<float,2>{0.0274984986f, 0.274586916f},
-std::array<float,2>{0.111093663f, 0.587191403f},
-std::array<float,2>{0.712150633f, 0.0558585934f},
-std::array<float,2>{0.963149428f, 0.9509148f},
-std::array<float,2>{0.425956368f, 0.381184548f},
-std::array<float,2>{0.334750384f, 0.790015817f},
-std::array<float,2>{0.843239188f, 0.372025967f},
-std::array<float,2>{0.557526708f, 0.625341237f},
-std::array<float,2>{0.161064342f, 0.145726025f},
-std::array<float,2>{0.0542951338f, 0.86721772f},
-std::array<float,2>{0.645376325f, 0.311249375f},
-std::array<float,2>{0.893361449f, 0.742834747f},
-std::array<float,2>{0.480175823f, 0.194177046f},
-std::array<float,2>{0.27711907f, 0.522633672f},
-std::array<float,2>{0.802720428f, 0.0850028619f},
-std::array<float,2>{0.617597699f, 0.931269765f},
-std::array<float,2>{0.241700962f, 0.493320733f},
-std::array<float,2>{0.142869323f, 0.666781545f},
-std::array<float,2>{0.525623262f, 0.175078198f},
-std::array<float,2>{0.864178538f, 0.754744887f},
-std::array<float,2>{0.348182648f, 0.314196795f},
-std::array<float,2>{0.398639232f, 0.991449237f},
-std::array<float,2>{0.972768903f, 0.414921194f},
-std::array<float,2>{0.746029079f, 0.619079113f},
-std::array<float,2>{0.0890559703f, 0.0201292913f},
-std::array<float,2>{0.17315276f, 0.771858513f},
-std::array<float,2>{0.543054521f, 0.333827466f},
-std::array<float,2>{0.816411376f, 0.679666221f},
-std::array<float,2>{0.325609386f, 0.159163624f},
-std::array<float,2>{0.415591955f, 0.600338519f},
-std::array<float,2>{0.950836837f, 0.00667215744f},
-std::array<float,2>{0.702551901f, 0.971796334f},
-std::array<float,2>{0.101342157f, 0.435578138f},
-std::array<float,2>{0.0106540611f, 0.723779738f},
-std::array<float,2>{0.68619895f, 0.217330649f},
-std::array<float,2>{0.93617934f, 0.84435308f},
-std::array<float,2>{0.454658955f, 0.287103415f},
-std::array<float,2>{0.306430608f, 0.913916171f},
-std::array<float,2>{0.768556774f, 0.479879916f},
-std::array<float,2>{0.58250308f, 0.50380075f},
-std::array<float,2>{0.217524111f, 0.0711396188f},
-std::array<float,2>{0.0644224212f, 0.956076622f},
-std::array<float,2>{0.723847389f, 0.400394469f},
-std::array<float,2>{0.996951878f, 0.57367903f},
-std::array<float,2>{0.383585602f, 0.0458147973f},
-std::array<float,2>{0.368658751f, 0.654415727f},
-std::array<float,2>{0.848874331f, 0.134913519f},
-std::array<float,2>{0.503261149f, 0.805751085f},
-std::array<float,2>{0.132717863f, 0.348456979f},
-std::array<float,2>{0.219472408f, 0.534966528f},
-std::array<float,2>{0.606498539f, 0.107384101f},
-std::array<float,2>{0.789226949f, 0.889814377f},
-std::array<float,2>{0.252143413f, 0.452706695f},
-std::array<float,2>{0.494803667f, 0.8234604f},
-std::array<float,2>{0.888688147f, 0.253870904f},
-std::array<float,2>{0.634877861f, 0.700399816f},
-std::array<float,2>{0.0426663123f, 0.219622791f},
-std::array<float,2>{0.230503395f, 0.947235465f},
-std::array<float,2>{0.59856683f, 0.375209302f},
-std::array<float,2>{0.789062202f, 0.591185987f},
-std::array<float,2>{0.261001915f, 0.0590278134f},
-std::array<float,2>{0.489512712f, 0.630151927f},
-std::array<float,2>{0.876869023f, 0.144365177f},
-std::array<float,2>{0.632359445f, 0.795333087f},
-std::array<float,2>{0.0371988788f, 0.368014932f},
-std::array<float,2>{0.0778305978f, 0.561033845f},
-std::array<float,2>{0.72908926f, 0.115313582f},
-std::array<float,2>{0.986986697f, 0.893281043f},
-std::array<float,2>{0.375105113f, 0.46227181f},
-std::array<float,2>{0.366329879f, 0.838370502f},
-std::array<float,2>{0.853136897f, 0.280043215f},
-std::array<float,2>{0.513764501f, 0.717709064f},
-std::array<float,2>{0.134898499f, 0.240124285f},
-std::array<float,2>{0.0019489571f, 0.751584768f},
-std::array<float,2>{0.675579906f, 0.318901509f},
-std::array<float,2>{0.92353189f, 0.670821071f},
-std::array<float,2>{0.465272665f, 0.178807646f},
-std::array<float,2>{0.298099279f, 0.623156786f},
-std::array<float,2>{0.780056417f, 0.0187636968f},
-std::array<float,2>{0.588719428f, 0.987888813f},
-std::array<float,2>{0.208751068f, 0.420157939f},
-std::array<float,2>{0.186410099f, 0.747137547f},
-std::array<float,2>{0.531482697f, 0.188889906f},
-std::array<float,2>{0.822481692f, 0.871492445f},
-std::array<float,2>{0.316963375f, 0.305392355f},
-std::array<float,2>{0.411814123f, 0.935349226f},
-std::array<float,2>{0.943071961f, 0.49688974f},
-std::array<float,2>{0.692568541f, 0.519435763f},
-std::array<float,2>{0.108308688f, 0.0795455426f},
-std::array<float,2>{0.152049541f, 0.849911988f},
-std::array<float,2>{0.522952616f, 0.282996714f},
-std::array<float,2>{0.874791384f, 0.720425606f},
-std::array<float,2>{0.357847184f, 0.211561382f},
-std::array<float,2>{0.390991271f, 0.506235719f},
-std::array<float,2>{0.982509017f, 0.0744107589f},
-std::array<float,2>{0.742005229f, 0.909436166f},
-std::array<float,2>{0.0817451179f, 0.48157239f},
-std::array<float,2>{0.0609958917f, 0.67436552f},
-std::array<float,2>{0.653726697f, 0.160458744f},
-std::array<float,2>{0.903640032f, 0.767657518f},
-std::array<float,2>{0.470040411f, 0.330435455f},
-std::array<float,2>{0.269831896f, 0.975037098f},
-std::array<float,2>{0.810076654f, 0.43018499f},
-std::array<float,2>{0.615083098f, 0.596736729f},
-std::array<float,2>{0.249246225f, 0.00347163319f},
-std::array<float,2>{0.12283475f, 0.882906914f},
-std::array<float,2>{0.703700423f, 0.446039289f},
-std::array<float,2>{0.957636714f, 0.538142323f},
-std::array<float,2>{0.431325287f, 0.102488808f},
-std::array<float,2>{0.336617947f, 0.696397841f},
-std::array<float,2>{0.829371393f, 0.225610003f},
-std::array<float,2>{0.549514771f, 0.824260652f},
-std::array<float,2>{0.170763507f, 0.257190615f},
-std::array<float,2>{0.194836691f, 0.574450254f},
-std::array<float,2>{0.575548351f, 0.0420913473f},
-std::array<float,2>{0.751215518f, 0.959544301f},
-std::array<float,2>{0.288747251f, 0.404199898f},
-std::array<float,2>{0.451925069f, 0.810977221f},
-std::array<float,2>{0.921467423f, 0.344665974f},
-std::array<float,2>{0.669943988f, 0.650119305f},
-std::array<float,2>{0.0206915736f, 0.137817219f},
-std::array<float,2>{0.157754734f, 0.918682396f},
-std::array<float,2>{0.560454428f, 0.473774403f},
-std::array<float,2>{0.839580357f, 0.50921768f},
-std::array<float,2>{0.329810172f, 0.0636074021f},
-std::array<float,2>{0.425518215f, 0.733278394f},
-std::array<float,2>{0.964866161f, 0.205193609f},
-std::array<float,2>{0.717626035f, 0.857740998f},
-std::array<float,2>{0.11497499f, 0.289221495f},
-std::array<float,2>{0.025574049f, 0.607697487f},
-std::array<float,2>{0.659142315f, 0.0122405477f},
-std::array<float,2>{0.906531215f, 0.978633344f},
-std::array<float,2>{0.439889848f, 0.422331631f},
-std::array<float,2>{0.296339333f, 0.775664687f},
-std::array<float,2>{0.760787189f, 0.339987069f},
-std::array<float,2>{0.567968905f, 0.681239605f},
-std::array<float,2>{0.198393285f, 0.171514168f},
-std::array<float,2>{0.0910850838f, 0.820041955f},
-std::array<float,2>{0.748484671f, 0.26441747f},
-std::array<float,2>{0.972645044f, 0.69155556f},
-std::array<float,2>{0.402871877f, 0.233046472f},
-std::array<float,2>{0.347197831f, 0.541503608f},
-std::array<float,2>{0.859714031f, 0.0993600264f},
-std::array<float,2>{0.530014813f, 0.875374079f},
-std::array<float,2>{0.148222968f, 0.438010842f},
-std::array<float,2>{0.235181764f, 0.641555727f},
-std::array<float,2>{0.624171197f, 0.129508466f},
-std::array<float,2>{0.79792428f, 0.799114347f},
-std::array<float,2>{0.281066298f, 0.358728379f},
-std::array<float,2>{0.482326597f, 0.966407776f},
-std::array<float,2>{0.896888912f, 0.396384269f},
-std::array<float,2>{0.642944932f, 0.565003574f},
-std::array<float,2>{0.0480557755f, 0.0347388014f},
-std::array<float,2>{0.210976288f, 0.784663558f},
-std::array<float,2>{0.578710377f, 0.363115132f},
-std::array<float,2>{0.769964397f, 0.634623706f},
-std::array<float,2>{0.310149342f, 0.154669344f},
-std::array<float,2>{0.458938748f, 0.581972301f},
-std::array<float,2>{0.933000803f, 0.0493321307f},
-std::array<float,2>{0.681119859f, 0.942468882f},
-std::array<float,2>{0.0155528141f, 0.382945567f},
-std::array<float,2>{0.0968134552f, 0.708218694f},
-std::array<float,2>{0.695628762f, 0.247709692f},
-std::array<float,2>{0.948093235f, 0.830595672f},
-std::array<float,2>{0.418189764f, 0.27277863f},
-std::array<float,2>{0.321994931f, 0.902089298f},
-std::array<float,2>{0.813418448f, 0.45397827f},
-std::array<float,2>{0.540575087f, 0.552315056f},
-std::array<float,2>{0.178884923f, 0.120909646f},
-std::array<float,2>{0.0460958406f, 0.996808946f},
-std::array<float,2>{0.63975215f, 0.410429478f},
-std::array<float,2>{0.885044515f, 0.614113748f},
-std::array<float,2>{0.497108936f, 0.0301914718f},
-std::array<float,2>{0.25524044f, 0.659444749f},
-std::array<float,2>{0.795948505f, 0.181138322f},
-std::array<float,2>{0.60197854f, 0.760839999f},
-std::array<float,2>{0.223451599f, 0.321622729f},
-std::array<float,2>{0.127090186f, 0.527122974f},
-std::array<float,2>{0.506195605f, 0.086290203f},
-std::array<float,2>{0.846775591f, 0.925684512f},
-std::array<float,2>{0.374795645f, 0.492097169f},
-std::array<float,2>{0.389460713f, 0.866461277f},
-std::array<float,2>{0.993965983f, 0.299767941f},
-std::array<float,2>{0.721525669f, 0.740336537f},
-std::array<float,2>{0.0702033266f, 0.198121652f},
-std::array<float,2>{0.181745723f, 0.962974787f},
-std::array<float,2>{0.539056718f, 0.392528892f},
-std::array<float,2>{0.825668454f, 0.570167005f},
-std::array<float,2>{0.316172808f, 0.0358893722f},
-std::array<float,2>{0.407045096f, 0.646145046f},
-std::array<float,2>{0.939140201f, 0.127968818f},
-std::array<float,2>{0.68912667f, 0.80398047f},
-std::array<float,2>{0.105278499f, 0.352169991f},
-std::array<float,2>{0.00599426357f, 0.544076562f},
-std::array<float,2>{0.676366031f, 0.0943678468f},
-std::array<float,2>{0.929013312f, 0.879833758f},
-std::array<float,2>{0.464782834f, 0.444564044f},
-std::array<float,2>{0.30315882f, 0.815076351f},
-std::array<float,2>{0.775468349f, 0.258008629f},
-std::array<float,2>{0.59168011f, 0.689585268f},
-std::array<float,2>{0.204823852f, 0.229849651f},
-std::array<float,2>{0.0719183087f, 0.78111285f},
-std::array<float,2>{0.733514369f, 0.338612527f},
-std::array<float,2>{0.991351604f, 0.684350908f},
-std::array<float,2>{0.380663186f, 0.167850554f},
-std::array<float,2>{0.361517131f, 0.603749573f},
-std::array<float,2>{0.857205153f, 0.009277598f},
-std::array<float,2>{0.509967983f, 0.983957946f},
-std::array<float,2>{0.140090719f, 0.426941782f},
-std::array<float,2>{0.228332818f, 0.729375958f},
-std::array<float,2>{0.595799744f, 0.209008992f},
-std::array<float,2>{0.784499705f, 0.855429292f},
-std::array<float,2>{0.262975097f, 0.293994308f},
-std::array<float,2>{0.484674394f, 0.914089918f},
-std::array<float,2>{0.882803321f, 0.468935668f},
-std::array<float,2>{0.628057718f, 0.513301492f},
-std::array<float,2>{0.0323689841f, 0.0664299801f},
-std::array<float,2>{0.188021407f, 0.861425579f},
-std::array<float,2>{0.571559608f, 0.303340346f},
-std::array<float,2>{0.757097542f, 0.735066772f},
-std::array<float,2>{0.281461149f, 0.201071486f},
-std::array<float,2>{0.446776032f, 0.529982507f},
-std::array<float,2>{0.914811492f, 0.0935264528f},
-std::array<float,2>{0.667801797f, 0.92638582f},
-std::array<float,2>{0.0187238995f, 0.488193899f},
-std::array<float,2>{0.119360365f, 0.662380397f},
-std::array<float,2>{0.708044291f, 0.185068399f},
-std::array<float,2>{0.955024004f, 0.762518585f},
-std::array<float,2>{0.436349481f, 0.3280029f},
-std::array<float,2>{0.34270519f, 0.99492377f},
-std::array<float,2>{0.835604608f, 0.407563567f},
-std::array<float,2>{0.554014623f, 0.611955702f},
-std::array<float,2>{0.164129823f, 0.024781147f},
-std::array<float,2>{0.0556542128f, 0.902478039f},
-std::array<float,2>{0.650891662f, 0.457973719f},
-std::array<float,2>{0.900394201f, 0.549038887f},
-std::array<float,2>{0.473478436f, 0.121438317f},
-std::array<float,2>{0.266896784f, 0.705685675f},
-std::array<float,2>{0.808048725f, 0.242599651f},
-std::array<float,2>{0.612586796f, 0.832381129f},
-std::array<float,2>{0.244507268f, 0.269163936f},
-std::array<float,2>{0.155517817f, 0.583561957f},
-std::array<float,2>{0.517606139f, 0.0539665297f},
-std::array<float,2>{0.868358791f, 0.939274073f},
-std::array<float,2>{0.351730347f, 0.387263924f},
-std::array<float,2>{0.395903349f, 0.787094355f},
-std::array<float,2>{0.979143262f, 0.365728855f},
-std::array<float,2>{0.734417081f, 0.636964977f},
-std::array<float,2>{0.0856041163f, 0.149651259f},
-std::array<float,2>{0.238338068f, 0.93296206f},
-std::array<float,2>{0.620428503f, 0.495692164f},
-std::array<float,2>{0.804391682f, 0.521126628f},
-std::array<float,2>{0.274916589f, 0.0825184286f},
-std::array<float,2>{0.47825852f, 0.745544612f},
-std::array<float,2>{0.891657531f, 0.193180233f},
-std::array<float,2>{0.648206711f, 0.869646907f},
-std::array<float,2>{0.0508627556f, 0.310451955f},
-std::array<float,2>{0.0867120102f, 0.620873868f},
-std::array<float,2>{0.74221009f, 0.0224728845f},
-std::array<float,2>{0.975371242f, 0.98943615f},
-std::array<float,2>{0.401999593f, 0.416169167f},
-std::array<float,2>{0.350465775f, 0.756219923f},
-std::array<float,2>{0.86667496f, 0.315101504f},
-std::array<float,2>{0.525277913f, 0.665296853f},
-std::array<float,2>{0.142161325f, 0.172788113f},
-std::array<float,2>{0.0301089976f, 0.842280209f},
-std::array<float,2>{0.661039114f, 0.276290745f},
-std::array<float,2>{0.911446869f, 0.712089598f},
-std::array<float,2>{0.44207859f, 0.237223774f},
-std::array<float,2>{0.292424172f, 0.555285811f},
-std::array<float,2>{0.762127638f, 0.111649029f},
-std::array<float,2>{0.562512159f, 0.898287058f},
-std::array<float,2>{0.201426059f, 0.468229622f},
-std::array<float,2>{0.163769588f, 0.628054082f},
-std::array<float,2>{0.55546248f, 0.147812039f},
-std::array<float,2>{0.840851486f, 0.791234136f},
-std::array<float,2>{0.33374998f, 0.374185145f},
-std::array<float,2>{0.429686368f, 0.951618671f},
-std::array<float,2>{0.961743593f, 0.379829675f},
-std::array<float,2>{0.713589609f, 0.588591993f},
-std::array<float,2>{0.112310752f, 0.0567693561f},
-std::array<float,2>{0.129127249f, 0.807376087f},
-std::array<float,2>{0.501176178f, 0.350558162f},
-std::array<float,2>{0.850710869f, 0.653273821f},
-std::array<float,2>{0.369547695f, 0.132903025f},
-std::array<float,2>{0.384857655f, 0.57087034f},
-std::array<float,2>{0.998662829f, 0.0435041413f},
-std::array<float,2>{0.725377023f, 0.953188896f},
-std::array<float,2>{0.0651248991f, 0.400100529f},
-std::array<float,2>{0.0393561833f, 0.701996922f},
-std::array<float,2>{0.634281397f, 0.22103174f},
-std::array<float,2>{0.887908399f, 0.822030306f},
-std::array<float,2>{0.492290556f, 0.251741707f},
-std::array<float,2>{0.251459837f, 0.888506472f},
-std::array<float,2>{0.79206115f, 0.451012373f},
-std::array<float,2>{0.607435346f, 0.532042027f},
-std::array<float,2>{0.220729232f, 0.108685359f},
-std::array<float,2>{0.0980240479f, 0.969125569f},
-std::array<float,2>{0.69979614f, 0.434116751f},
-std::array<float,2>{0.95270735f, 0.598336041f},
-std::array<float,2>{0.4168863f, 0.00425507221f},
-std::array<float,2>{0.328002691f, 0.676808298f},
-std::array<float,2>{0.820123315f, 0.157133862f},
-std::array<float,2>{0.546427131f, 0.770130992f},
-std::array<float,2>{0.175166264f, 0.334202379f},
-std::array<float,2>{0.215163738f, 0.501851439f},
-std::array<float,2>{0.584381223f, 0.0731651634f},
-std::array<float,2>{0.765755832f, 0.911020458f},
-std::array<float,2>{0.306949288f, 0.477597207f},
-std::array<float,2>{0.455667287f, 0.845919728f},
-std::array<float,2>{0.934651792f, 0.288839072f},
-std::array<float,2>{0.685399711f, 0.725137413f},
-std::array<float,2>{0.00921237003f, 0.215447292f},
-std::array<float,2>{0.210414141f, 0.98451817f},
-std::array<float,2>{0.587086976f, 0.419658452f},
-std::array<float,2>{0.778941453f, 0.621755362f},
-std::array<float,2>{0.298976153f, 0.0156859364f},
-std::array<float,2>{0.468072832f, 0.668053389f},
-std::array<float,2>{0.923876643f, 0.176045492f},
-std::array<float,2>{0.673417807f, 0.753389478f},
-std::array<float,2>{0.00349991117f, 0.316742539f},
-std::array<float,2>{0.106790051f, 0.516680181f},
-std::array<float,2>{0.694049716f, 0.0805795267f},
-std::array<float,2>{0.943612397f, 0.936924934f},
-std::array<float,2>{0.413172066f, 0.498839527f},
-std::array<float,2>{0.319397509f, 0.874509811f},
-std::array<float,2>{0.821698427f, 0.306965709f},
-std::array<float,2>{0.534401476f, 0.748503745f},
-std::array<float,2>{0.184839293f, 0.190289512f},
-std::array<float,2>{0.0365420394f, 0.794338167f},
-std::array<float,2>{0.630294383f, 0.370048761f},
-std::array<float,2>{0.878316998f, 0.631795883f},
-std::array<float,2>{0.490270287f, 0.14133504f},
-std::array<float,2>{0.258765131f, 0.593317509f},
-std::array<float,2>{0.786353767f, 0.0624062158f},
-std::array<float,2>{0.600877523f, 0.948144317f},
-std::array<float,2>{0.234307662f, 0.378905565f},
-std::array<float,2>{0.133424208f, 0.71671313f},
-std::array<float,2>{0.51237148f, 0.241230547f},
-std::array<float,2>{0.854650319f, 0.837705374f},
-std::array<float,2>{0.364151955f, 0.27755338f},
-std::array<float,2>{0.377232999f, 0.892122984f},
-std::array<float,2>{0.98462218f, 0.464618951f},
-std::array<float,2>{0.727744341f, 0.559739888f},
-std::array<float,2>{0.0759408772f, 0.113479741f},
-std::array<float,2>{0.169514671f, 0.827578664f},
-std::array<float,2>{0.547972083f, 0.254441261f},
-std::array<float,2>{0.83054775f, 0.698464632f},
-std::array<float,2>{0.338989615f, 0.223284304f},
-std::array<float,2>{0.432192087f, 0.536530674f},
-std::array<float,2>{0.96027112f, 0.104132168f},
-std::array<float,2>{0.705613196f, 0.88651824f},
-std::array<float,2>{0.124661826f, 0.448050648f},
-std::array<float,2>{0.0219999943f, 0.651034951f},
-std::array<float,2>{0.66840142f, 0.138757065f},
-std::array<float,2>{0.917992234f, 0.809526801f},
-std::array<float,2>{0.449820817f, 0.347099483f},
-std::array<float,2>{0.286264896f, 0.958191812f},
-std::array<float,2>{0.753016949f, 0.404598802f},
-std::array<float,2>{0.577507854f, 0.576937258f},
-std::array<float,2>{0.193269774f, 0.0392370299f},
-std::array<float,2>{0.0785838887f, 0.906264842f},
-std::array<float,2>{0.740234017f, 0.482426286f},
-std::array<float,2>{0.982100487f, 0.504246652f},
-std::array<float,2>{0.394153953f, 0.0773439854f},
-std::array<float,2>{0.356954038f, 0.722232819f},
-std::array<float,2>{0.871807158f, 0.213009506f},
-std::array<float,2>{0.521301627f, 0.849083245f},
-std::array<float,2>{0.148754686f, 0.28371954f},
-std::array<float,2>{0.247038573f, 0.594115973f},
-std::array<float,2>{0.615912735f, 0.000511551683f},
-std::array<float,2>{0.811650872f, 0.972783327f},
-std::array<float,2>{0.273032367f, 0.432337701f},
-std::array<float,2>{0.471596926f, 0.766864061f},
-std::array<float,2>{0.905242622f, 0.328214049f},
-std::array<float,2>{0.656185091f, 0.673568726f},
-std::array<float,2>{0.060525693f, 0.162715584f},
-std::array<float,2>{0.145386919f, 0.878348649f},
-std::array<float,2>{0.529201448f, 0.441370249f},
-std::array<float,2>{0.862434208f, 0.540984273f},
-std::array<float,2>{0.345564276f, 0.101091519f},
-std::array<float,2>{0.404739857f, 0.695294261f},
-std::array<float,2>{0.970028698f, 0.231718421f},
-std::array<float,2>{0.747169852f, 0.817451596f},
-std::array<float,2>{0.093187362f, 0.26320526f},
-std::array<float,2>{0.0500179157f, 0.563176036f},
-std::array<float,2>{0.641767323f, 0.0326683782f},
-std::array<float,2>{0.896128714f, 0.966980278f},
-std::array<float,2>{0.483427346f, 0.397655845f},
-std::array<float,2>{0.27926895f, 0.798090994f},
-std::array<float,2>{0.800104439f, 0.356812149f},
-std::array<float,2>{0.622066677f, 0.643778503f},
-std::array<float,2>{0.236695021f, 0.13107048f},
-std::array<float,2>{0.116959177f, 0.855828345f},
-std::array<float,2>{0.716516376f, 0.29286781f},
-std::array<float,2>{0.968124986f, 0.731817067f},
-std::array<float,2>{0.422463506f, 0.205005452f},
-std::array<float,2>{0.331071675f, 0.510201216f},
-std::array<float,2>{0.836944401f, 0.0659888312f},
-std::array<float,2>{0.560969889f, 0.920443535f},
-std::array<float,2>{0.158594027f, 0.47650516f},
-std::array<float,2>{0.196012273f, 0.683251143f},
-std::array<float,2>{0.569420755f, 0.169405565f},
-std::array<float,2>{0.758494079f, 0.774820507f},
-std::array<float,2>{0.294177175f, 0.342460155f},
-std::array<float,2>{0.439227194f, 0.978378415f},
-std::array<float,2>{0.909356892f, 0.424903452f},
-std::array<float,2>{0.656411231f, 0.606543601f},
-std::array<float,2>{0.0249572042f, 0.0153822061f},
-std::array<float,2>{0.225649312f, 0.759214282f},
-std::array<float,2>{0.604842126f, 0.323336691f},
-std::array<float,2>{0.792985022f, 0.657330811f},
-std::array<float,2>{0.257310897f, 0.183473915f},
-std::array<float,2>{0.499141067f, 0.615682065f},
-std::array<float,2>{0.883152544f, 0.0291401222f},
-std::array<float,2>{0.637004137f, 0.999302506f},
-std::array<float,2>{0.0441102684f, 0.413616091f},
-std::array<float,2>{0.0683047101f, 0.738460243f},
-std::array<float,2>{0.720191598f, 0.197056636f},
-std::array<float,2>{0.994805336f, 0.864466608f},
-std::array<float,2>{0.388343245f, 0.297816128f},
-std::array<float,2>{0.372797519f, 0.923170865f},
-std::array<float,2>{0.844765484f, 0.488920212f},
-std::array<float,2>{0.505823255f, 0.523500144f},
-std::array<float,2>{0.125459298f, 0.0887541026f},
-std::array<float,2>{0.0128051238f, 0.944548965f},
-std::array<float,2>{0.683118582f, 0.384973139f},
-std::array<float,2>{0.929962218f, 0.578284979f},
-std::array<float,2>{0.460817218f, 0.0472111069f},
-std::array<float,2>{0.310935795f, 0.635409474f},
-std::array<float,2>{0.773024619f, 0.153489307f},
-std::array<float,2>{0.58076638f, 0.781500101f},
-std::array<float,2>{0.213566989f, 0.360058069f},
-std::array<float,2>{0.176550195f, 0.552737892f},
-std::array<float,2>{0.542732775f, 0.118033998f},
-std::array<float,2>{0.814995527f, 0.898449242f},
-std::array<float,2>{0.322615415f, 0.456554562f},
-std::array<float,2>{0.421645731f, 0.828784287f},
-std::array<float,2>{0.945889652f, 0.270346433f},
-std::array<float,2>{0.698824704f, 0.710113406f},
-std::array<float,2>{0.0940572247f, 0.249644503f},
-std::array<float,2>{0.153876409f, 0.938397884f},
-std::array<float,2>{0.51699698f, 0.388195157f},
-std::array<float,2>{0.86954093f, 0.582556784f},
-std::array<float,2>{0.353904426f, 0.0533838198f},
-std::array<float,2>{0.396499068f, 0.638124764f},
-std::array<float,2>{0.97667855f, 0.149094611f},
-std::array<float,2>{0.737020969f, 0.785175383f},
-std::array<float,2>{0.082741037f, 0.367076993f},
-std::array<float,2>{0.0585851297f, 0.550039351f},
-std::array<float,2>{0.649983466f, 0.122761846f},
-std::array<float,2>{0.898657739f, 0.904177308f},
-std::array<float,2>{0.47511375f, 0.458566934f},
-std::array<float,2>{0.268069237f, 0.833204269f},
-std::array<float,2>{0.805358708f, 0.268281281f},
-std::array<float,2>{0.609760106f, 0.706809402f},
-std::array<float,2>{0.242385015f, 0.243551537f},
-std::array<float,2>{0.118292227f, 0.763647497f},
-std::array<float,2>{0.710271299f, 0.326810807f},
-std::array<float,2>{0.955742896f, 0.66371727f},
-std::array<float,2>{0.435092211f, 0.183930337f},
-std::array<float,2>{0.341027051f, 0.612906039f},
-std::array<float,2>{0.833721101f, 0.0240507685f},
-std::array<float,2>{0.552512765f, 0.995351553f},
-std::array<float,2>{0.167164788f, 0.406404972f},
-std::array<float,2>{0.191256344f, 0.7359671f},
-std::array<float,2>{0.573445022f, 0.199720651f},
-std::array<float,2>{0.754763842f, 0.862584412f},
-std::array<float,2>{0.284700692f, 0.303845733f},
-std::array<float,2>{0.447666645f, 0.927076638f},
-std::array<float,2>{0.916716158f, 0.487245023f},
-std::array<float,2>{0.664860308f, 0.530285239f},
-std::array<float,2>{0.0166310575f, 0.0926248729f},
-std::array<float,2>{0.229701042f, 0.853746593f},
-std::array<float,2>{0.594052911f, 0.293821841f},
-std::array<float,2>{0.782784998f, 0.730040491f},
-std::array<float,2>{0.265530974f, 0.210451469f},
-std::array<float,2>{0.487014741f, 0.512077093f},
-std::array<float,2>{0.880816638f, 0.0675271824f},
-std::array<float,2>{0.626752615f, 0.91564405f},
-std::array<float,2>{0.0347033665f, 0.469853789f},
-std::array<float,2>{0.0733849183f, 0.685078502f},
-std::array<float,2>{0.731403291f, 0.166584194f},
-std::array<float,2>{0.988521874f, 0.7794016f},
-std::array<float,2>{0.38265118f, 0.339127958f},
-std::array<float,2>{0.360826343f, 0.983269989f},
-std::array<float,2>{0.85934186f, 0.425852776f},
-std::array<float,2>{0.508983314f, 0.604773223f},
-std::array<float,2>{0.13687788f, 0.00784690864f},
-std::array<float,2>{0.00394517602f, 0.880650759f},
-std::array<float,2>{0.679069698f, 0.443817019f},
-std::array<float,2>{0.925918102f, 0.543835759f},
-std::array<float,2>{0.462406009f, 0.0952164531f},
-std::array<float,2>{0.30271095f, 0.691326976f},
-std::array<float,2>{0.774711251f, 0.228562117f},
-std::array<float,2>{0.592183471f, 0.816291571f},
-std::array<float,2>{0.205421522f, 0.259463459f},
-std::array<float,2>{0.181539014f, 0.569275737f},
-std::array<float,2>{0.535900891f, 0.0368505642f},
-std::array<float,2>{0.82799077f, 0.964039445f},
-std::array<float,2>{0.314134628f, 0.390748024f},
-std::array<float,2>{0.410152763f, 0.803667605f},
-std::array<float,2>{0.939889729f, 0.353171021f},
-std::array<float,2>{0.691366673f, 0.644692659f},
-std::array<float,2>{0.102101468f, 0.127625316f},
-std::array<float,2>{0.218548894f, 0.911568224f},
-std::array<float,2>{0.583517611f, 0.476642311f},
-std::array<float,2>{0.768493116f, 0.50039202f},
-std::array<float,2>{0.304957509f, 0.0737293959f},
-std::array<float,2>{0.453954011f, 0.725690544f},
-std::array<float,2>{0.936592877f, 0.216433689f},
-std::array<float,2>{0.687230051f, 0.847399712f},
-std::array<float,2>{0.0113801369f, 0.288009882f},
-std::array<float,2>{0.100536972f, 0.599414587f},
-std::array<float,2>{0.701530457f, 0.00532883126f},
-std::array<float,2>{0.949253201f, 0.96989578f},
-std::array<float,2>{0.414488345f, 0.434874237f},
-std::array<float,2>{0.324904382f, 0.77106303f},
-std::array<float,2>{0.818165958f, 0.335292101f},
-std::array<float,2>{0.544665575f, 0.676132441f},
-std::array<float,2>{0.172844335f, 0.157709122f},
-std::array<float,2>{0.041270595f, 0.820385993f},
-std::array<float,2>{0.636281788f, 0.250268817f},
-std::array<float,2>{0.890385032f, 0.702187836f},
-std::array<float,2>{0.495937675f, 0.222376168f},
-std::array<float,2>{0.253733724f, 0.533032775f},
-std::array<float,2>{0.790067196f, 0.107568175f},
-std::array<float,2>{0.605809093f, 0.887287199f},
-std::array<float,2>{0.220281735f, 0.449292183f},
-std::array<float,2>{0.131474987f, 0.653765142f},
-std::array<float,2>{0.502796173f, 0.134698272f},
-std::array<float,2>{0.848057926f, 0.808038354f},
-std::array<float,2>{0.367514491f, 0.351049781f},
-std::array<float,2>{0.384186715f, 0.954846442f},
-std::array<float,2>{0.997525096f, 0.39883101f},
-std::array<float,2>{0.723507464f, 0.571307898f},
-std::array<float,2>{0.062780641f, 0.0439642109f},
-std::array<float,2>{0.161472619f, 0.79220897f},
-std::array<float,2>{0.558042347f, 0.373411804f},
-std::array<float,2>{0.84194231f, 0.627728522f},
-std::array<float,2>{0.335357279f, 0.146872431f},
-std::array<float,2>{0.427231848f, 0.589541435f},
-std::array<float,2>{0.964523256f, 0.0583036803f},
-std::array<float,2>{0.710949481f, 0.952294886f},
-std::array<float,2>{0.110287614f, 0.380852193f},
-std::array<float,2>{0.0292172004f, 0.711246789f},
-std::array<float,2>{0.662953436f, 0.237560019f},
-std::array<float,2>{0.913582742f, 0.842874408f},
-std::array<float,2>{0.444234997f, 0.277270138f},
-std::array<float,2>{0.289394557f, 0.897179961f},
-std::array<float,2>{0.763868272f, 0.466817051f},
-std::array<float,2>{0.564921498f, 0.55599004f},
-std::array<float,2>{0.199725375f, 0.112873271f},
-std::array<float,2>{0.0884080082f, 0.988285959f},
-std::array<float,2>{0.744893372f, 0.417854905f},
-std::array<float,2>{0.974060118f, 0.619486153f},
-std::array<float,2>{0.399786085f, 0.0222784001f},
-std::array<float,2>{0.348900676f, 0.664995849f},
-std::array<float,2>{0.86495322f, 0.173158795f},
-std::array<float,2>{0.527029991f, 0.757230759f},
-std::array<float,2>{0.143606275f, 0.316156417f},
-std::array<float,2>{0.240920439f, 0.519590735f},
-std::array<float,2>{0.61906755f, 0.0833488405f},
-std::array<float,2>{0.800880194f, 0.932526171f},
-std::array<float,2>{0.275950462f, 0.494263113f},
-std::array<float,2>{0.479406059f, 0.870679855f},
-std::array<float,2>{0.894419134f, 0.309147656f},
-std::array<float,2>{0.645575464f, 0.744946718f},
-std::array<float,2>{0.0536435097f, 0.192224145f},
-std::array<float,2>{0.248856515f, 0.973779857f},
-std::array<float,2>{0.613298595f, 0.433244139f},
-std::array<float,2>{0.809101641f, 0.59517628f},
-std::array<float,2>{0.271132231f, 0.000978340977f},
-std::array<float,2>{0.469642639f, 0.671937466f},
-std::array<float,2>{0.902400255f, 0.16388151f},
-std::array<float,2>{0.652371049f, 0.766171932f},
-std::array<float,2>{0.0624584034f, 0.329636961f},
-std::array<float,2>{0.0809453502f, 0.505085647f},
-std::array<float,2>{0.74040854f, 0.0765029192f},
-std::array<float,2>{0.983739436f, 0.907494247f},
-std::array<float,2>{0.392384857f, 0.483907819f},
-std::array<float,2>{0.358463407f, 0.848147452f},
-std::array<float,2>{0.873389423f, 0.284396142f},
-std::array<float,2>{0.521649122f, 0.721046031f},
-std::array<float,2>{0.150576815f, 0.214488342f},
-std::array<float,2>{0.0203463957f, 0.809726357f},
-std::array<float,2>{0.671368897f, 0.346242398f},
-std::array<float,2>{0.920872509f, 0.651461124f},
-std::array<float,2>{0.452265441f, 0.140191108f},
-std::array<float,2>{0.287938625f, 0.577412784f},
-std::array<float,2>{0.750034451f, 0.0403174348f},
-std::array<float,2>{0.574529231f, 0.957710147f},
-std::array<float,2>{0.193503946f, 0.406238884f},
-std::array<float,2>{0.171842784f, 0.697918713f},
-std::array<float,2>{0.550021648f, 0.224471167f},
-std::array<float,2>{0.828581214f, 0.82660228f},
-std::array<float,2>{0.337829888f, 0.255488932f},
-std::array<float,2>{0.430518359f, 0.885470033f},
-std::array<float,2>{0.958943546f, 0.448872268f},
-std::array<float,2>{0.704510212f, 0.535813689f},
-std::array<float,2>{0.121234849f, 0.105131328f},
-std::array<float,2>{0.136441022f, 0.836488008f},
-std::array<float,2>{0.515555441f, 0.279107749f},
-std::array<float,2>{0.852284729f, 0.715467691f},
-std::array<float,2>{0.365628064f, 0.240617186f},
-std::array<float,2>{0.376309246f, 0.558602691f},
-std::array<float,2>{0.988271475f, 0.114949189f},
-std::array<float,2>{0.730363965f, 0.890784681f},
-std::array<float,2>{0.0762201026f, 0.46325919f},
-std::array<float,2>{0.0386004038f, 0.632414699f},
-std::array<float,2>{0.630871594f, 0.141616061f},
-std::array<float,2>{0.875943244f, 0.793023169f},
-std::array<float,2>{0.488716453f, 0.37065506f},
-std::array<float,2>{0.260728717f, 0.94836247f},
-std::array<float,2>{0.787189305f, 0.377210438f},
-std::array<float,2>{0.599069118f, 0.592612624f},
-std::array<float,2>{0.23225382f, 0.0613288991f},
-std::array<float,2>{0.108888611f, 0.936377466f},
-std::array<float,2>{0.691641331f, 0.499341071f},
-std::array<float,2>{0.941870332f, 0.516059697f},
-std::array<float,2>{0.41097039f, 0.08187069f},
-std::array<float,2>{0.318063825f, 0.749091864f},
-std::array<float,2>{0.823337853f, 0.19113186f},
-std::array<float,2>{0.532289267f, 0.873462498f},
-std::array<float,2>{0.187401503f, 0.307840228f},
-std::array<float,2>{0.207882687f, 0.622470498f},
-std::array<float,2>{0.589017928f, 0.0171420351f},
-std::array<float,2>{0.780866683f, 0.985966802f},
-std::array<float,2>{0.297382891f, 0.418524832f},
-std::array<float,2>{0.465839028f, 0.752238095f},
-std::array<float,2>{0.922482908f, 0.317941278f},
-std::array<float,2>{0.674198687f, 0.669919848f},
-std::array<float,2>{0.000399829907f, 0.177568525f},
-std::array<float,2>{0.178286314f, 0.899581969f},
-std::array<float,2>{0.539163649f, 0.455824047f},
-std::array<float,2>{0.813981056f, 0.55405885f},
-std::array<float,2>{0.320547223f, 0.11882621f},
-std::array<float,2>{0.419879436f, 0.708993256f},
-std::array<float,2>{0.949035466f, 0.248535335f},
-std::array<float,2>{0.697040319f, 0.829403043f},
-std::array<float,2>{0.0957489163f, 0.271047443f},
-std::array<float,2>{0.0139714591f, 0.579160571f},
-std::array<float,2>{0.680505097f, 0.0487695672f},
-std::array<float,2>{0.932470739f, 0.943608761f},
-std::array<float,2>{0.457230121f, 0.386243641f},
-std::array<float,2>{0.309467256f, 0.782573938f},
-std::array<float,2>{0.770653605f, 0.360953331f},
-std::array<float,2>{0.579357505f, 0.636692584f},
-std::array<float,2>{0.212863266f, 0.153059408f},
-std::array<float,2>{0.0691507682f, 0.864203691f},
-std::array<float,2>{0.722606301f, 0.298603654f},
-std::array<float,2>{0.99297291f, 0.739275753f},
-std::array<float,2>{0.390078574f, 0.195883855f},
-std::array<float,2>{0.373945832f, 0.524875998f},
-std::array<float,2>{0.846398532f, 0.0894268751f},
-std::array<float,2>{0.507606983f, 0.921921849f},
-std::array<float,2>{0.128716514f, 0.490036756f},
-std::array<float,2>{0.2240237f, 0.657129705f},
-std::array<float,2>{0.602793872f, 0.181796476f},
-std::array<float,2>{0.795841575f, 0.758329272f},
-std::array<float,2>{0.254079133f, 0.322945386f},
-std::array<float,2>{0.496884167f, 0.998938978f},
-std::array<float,2>{0.886045337f, 0.412389547f},
-std::array<float,2>{0.638983369f, 0.616221845f},
-std::array<float,2>{0.0450618826f, 0.0273957513f},
-std::array<float,2>{0.197889999f, 0.774067044f},
-std::array<float,2>{0.566721559f, 0.342923939f},
-std::array<float,2>{0.759887159f, 0.682495415f},
-std::array<float,2>{0.295510143f, 0.168635681f},
-std::array<float,2>{0.440666407f, 0.605744004f},
-std::array<float,2>{0.907499254f, 0.0140650878f},
-std::array<float,2>{0.659745634f, 0.977315843f},
-std::array<float,2>{0.0263917428f, 0.424436301f},
-std::array<float,2>{0.11394231f, 0.730480075f},
-std::array<float,2>{0.718039036f, 0.203177318f},
-std::array<float,2>{0.965986013f, 0.857144415f},
-std::array<float,2>{0.424534708f, 0.291803062f},
-std::array<float,2>{0.328519374f, 0.921860754f},
-std::array<float,2>{0.838582754f, 0.475439161f},
-std::array<float,2>{0.559324205f, 0.511262238f},
-std::array<float,2>{0.157200873f, 0.0645711944f},
-std::array<float,2>{0.0468756929f, 0.967874944f},
-std::array<float,2>{0.644015193f, 0.397318929f},
-std::array<float,2>{0.897868752f, 0.564031959f},
-std::array<float,2>{0.480577797f, 0.0315753073f},
-std::array<float,2>{0.279647917f, 0.642934442f},
-std::array<float,2>{0.797227263f, 0.132064849f},
-std::array<float,2>{0.623491287f, 0.79757005f},
-std::array<float,2>{0.236196071f, 0.35616675f},
-std::array<float,2>{0.147282436f, 0.539621353f},
-std::array<float,2>{0.531092644f, 0.100292929f},
-std::array<float,2>{0.86042577f, 0.876976013f},
-std::array<float,2>{0.346509218f, 0.440185249f},
-std::array<float,2>{0.404117972f, 0.817078829f},
-std::array<float,2>{0.971612632f, 0.261835575f},
-std::array<float,2>{0.749548078f, 0.694209635f},
-std::array<float,2>{0.0907971412f, 0.231071293f},
-std::array<float,2>{0.16571629f, 0.99335283f},
-std::array<float,2>{0.553600013f, 0.409613669f},
-std::array<float,2>{0.834086061f, 0.609949529f},
-std::array<float,2>{0.342855632f, 0.0256201662f},
-std::array<float,2>{0.436962187f, 0.661153197f},
-std::array<float,2>{0.953809738f, 0.186474487f},
-std::array<float,2>{0.707557023f, 0.764921069f},
-std::array<float,2>{0.120624423f, 0.32550922f},
-std::array<float,2>{0.0178086143f, 0.529129207f},
-std::array<float,2>{0.666369796f, 0.0906689242f},
-std::array<float,2>{0.915248156f, 0.929429889f},
-std::array<float,2>{0.445326477f, 0.485734493f},
-std::array<float,2>{0.283120185f, 0.860264421f},
-std::array<float,2>{0.756410718f, 0.301914692f},
-std::array<float,2>{0.571275413f, 0.736942351f},
-std::array<float,2>{0.188731208f, 0.20120649f},
-std::array<float,2>{0.084203504f, 0.787296712f},
-std::array<float,2>{0.735377371f, 0.363805801f},
-std::array<float,2>{0.980133057f, 0.639163792f},
-std::array<float,2>{0.394966632f, 0.151852429f},
-std::array<float,2>{0.352597445f, 0.585704625f},
-std::array<float,2>{0.867396653f, 0.0526233874f},
-std::array<float,2>{0.519231439f, 0.940868139f},
-std::array<float,2>{0.15509434f, 0.389190465f},
-std::array<float,2>{0.245502368f, 0.704839528f},
-std::array<float,2>{0.612243831f, 0.245518446f},
-std::array<float,2>{0.806959867f, 0.834337652f},
-std::array<float,2>{0.265646338f, 0.266139776f},
-std::array<float,2>{0.474475324f, 0.906149745f},
-std::array<float,2>{0.902218044f, 0.45969978f},
-std::array<float,2>{0.651981115f, 0.548459947f},
-std::array<float,2>{0.0557239354f, 0.124062307f},
-std::array<float,2>{0.203551367f, 0.812874138f},
-std::array<float,2>{0.590487063f, 0.260537893f},
-std::array<float,2>{0.77671653f, 0.688567579f},
-std::array<float,2>{0.30461055f, 0.226754233f},
-std::array<float,2>{0.463344991f, 0.54538846f},
-std::array<float,2>{0.928351581f, 0.09667328f},
-std::array<float,2>{0.677345514f, 0.882656932f},
-std::array<float,2>{0.00764154503f, 0.443271011f},
-std::array<float,2>{0.103695303f, 0.647610188f},
-std::array<float,2>{0.688125432f, 0.126471639f},
-std::array<float,2>{0.937950194f, 0.802657545f},
-std::array<float,2>{0.407784015f, 0.353704363f},
-std::array<float,2>{0.315322608f, 0.962729871f},
-std::array<float,2>{0.824617982f, 0.393084466f},
-std::array<float,2>{0.537211657f, 0.568074763f},
-std::array<float,2>{0.182689399f, 0.0380974673f},
-std::array<float,2>{0.0321388096f, 0.916794896f},
-std::array<float,2>{0.627296746f, 0.472346097f},
-std::array<float,2>{0.881660163f, 0.514849365f},
-std::array<float,2>{0.485878468f, 0.069743298f},
-std::array<float,2>{0.262183577f, 0.7281726f},
-std::array<float,2>{0.783868849f, 0.208051801f},
-std::array<float,2>{0.596799552f, 0.851938486f},
-std::array<float,2>{0.226834282f, 0.296022683f},
-std::array<float,2>{0.139616653f, 0.603399277f},
-std::array<float,2>{0.510958016f, 0.0110514583f},
-std::array<float,2>{0.855604291f, 0.980946541f},
-std::array<float,2>{0.36315155f, 0.429566503f},
-std::array<float,2>{0.379471689f, 0.778434217f},
-std::array<float,2>{0.990859926f, 0.336679786f},
-std::array<float,2>{0.732940257f, 0.686786234f},
-std::array<float,2>{0.0710659102f, 0.165559649f},
-std::array<float,2>{0.222093254f, 0.88941592f},
-std::array<float,2>{0.6087358f, 0.451310694f},
-std::array<float,2>{0.791398704f, 0.533377111f},
-std::array<float,2>{0.250511467f, 0.106205285f},
-std::array<float,2>{0.493346214f, 0.700160146f},
-std::array<float,2>{0.886909485f, 0.220637292f},
-std::array<float,2>{0.633199334f, 0.822551966f},
-std::array<float,2>{0.0409079306f, 0.252868801f},
-std::array<float,2>{0.0662043914f, 0.57311058f},
-std::array<float,2>{0.725964606f, 0.0467648804f},
-std::array<float,2>{0.999670684f, 0.955818295f},
-std::array<float,2>{0.38594529f, 0.402132511f},
-std::array<float,2>{0.37100333f, 0.804709375f},
-std::array<float,2>{0.850373745f, 0.349175096f},
-std::array<float,2>{0.500908375f, 0.65614897f},
-std::array<float,2>{0.130251721f, 0.136314794f},
-std::array<float,2>{0.00852610078f, 0.845573783f},
-std::array<float,2>{0.684315145f, 0.285481989f},
-std::array<float,2>{0.934305251f, 0.723603606f},
-std::array<float,2>{0.456365258f, 0.218116477f},
-std::array<float,2>{0.308454603f, 0.502423942f},
-std::array<float,2>{0.767186344f, 0.0713277757f},
-std::array<float,2>{0.585220933f, 0.91283828f},
-std::array<float,2>{0.216647282f, 0.478699833f},
-std::array<float,2>{0.173864439f, 0.678556085f},
-std::array<float,2>{0.545053184f, 0.15977703f},
-std::array<float,2>{0.819258273f, 0.772720098f},
-std::array<float,2>{0.326307863f, 0.33248809f},
-std::array<float,2>{0.417103171f, 0.971322536f},
-std::array<float,2>{0.951369166f, 0.436931431f},
-std::array<float,2>{0.700312078f, 0.601561666f},
-std::array<float,2>{0.0995481759f, 0.00715426542f},
-std::array<float,2>{0.141346693f, 0.755828917f},
-std::array<float,2>{0.524009168f, 0.313351691f},
-std::array<float,2>{0.865931451f, 0.667703331f},
-std::array<float,2>{0.351308674f, 0.174134463f},
-std::array<float,2>{0.40101707f, 0.617521942f},
-std::array<float,2>{0.976307988f, 0.0212764014f},
-std::array<float,2>{0.743578553f, 0.990363896f},
-std::array<float,2>{0.0869596452f, 0.415147126f},
-std::array<float,2>{0.0523142852f, 0.743839562f},
-std::array<float,2>{0.646999717f, 0.194852665f},
-std::array<float,2>{0.890645921f, 0.868771851f},
-std::array<float,2>{0.476907015f, 0.311670542f},
-std::array<float,2>{0.274222285f, 0.930330515f},
-std::array<float,2>{0.80359906f, 0.493056327f},
-std::array<float,2>{0.620017588f, 0.521623015f},
-std::array<float,2>{0.239550576f, 0.0843912289f},
-std::array<float,2>{0.111421801f, 0.949995518f},
-std::array<float,2>{0.714399874f, 0.381970048f},
-std::array<float,2>{0.962751269f, 0.586791515f},
-std::array<float,2>{0.42805627f, 0.0552478135f},
-std::array<float,2>{0.332663238f, 0.626225054f},
-std::array<float,2>{0.840554178f, 0.14545919f},
-std::array<float,2>{0.556060135f, 0.790357769f},
-std::array<float,2>{0.162691593f, 0.372318506f},
-std::array<float,2>{0.202943936f, 0.556964159f},
-std::array<float,2>{0.563676536f, 0.110068507f},
-std::array<float,2>{0.763188481f, 0.89536643f},
-std::array<float,2>{0.291493475f, 0.466461986f},
-std::array<float,2>{0.44301033f, 0.841362238f},
-std::array<float,2>{0.910930574f, 0.273499966f},
-std::array<float,2>{0.662066817f, 0.713156044f},
-std::array<float,2>{0.0305377729f, 0.236127332f},
-std::array<float,2>{0.191571027f, 0.960860431f},
-std::array<float,2>{0.576270163f, 0.402537137f},
-std::array<float,2>{0.752676249f, 0.575327933f},
-std::array<float,2>{0.285358429f, 0.041063346f},
-std::array<float,2>{0.451134115f, 0.649308205f},
-std::array<float,2>{0.919594347f, 0.13719894f},
-std::array<float,2>{0.669826269f, 0.812202811f},
-std::array<float,2>{0.0229454581f, 0.344760209f},
-std::array<float,2>{0.124009855f, 0.537524164f},
-std::array<float,2>{0.706902325f, 0.103098705f},
-std::array<float,2>{0.959332287f, 0.884153903f},
-std::array<float,2>{0.43288964f, 0.446772695f},
-std::array<float,2>{0.338062495f, 0.825471222f},
-std::array<float,2>{0.831529737f, 0.256481558f},
-std::array<float,2>{0.547046125f, 0.695923924f},
-std::array<float,2>{0.168051407f, 0.225577995f},
-std::array<float,2>{0.0594546832f, 0.768761158f},
-std::array<float,2>{0.654655397f, 0.331620365f},
-std::array<float,2>{0.90557003f, 0.674839437f},
-std::array<float,2>{0.471862674f, 0.161613628f},
-std::array<float,2>{0.272146821f, 0.596240044f},
-std::array<float,2>{0.810817122f, 0.00234279828f},
-std::array<float,2>{0.616597474f, 0.976109087f},
-std::array<float,2>{0.247396439f, 0.430997908f},
-std::array<float,2>{0.15002279f, 0.718999624f},
-std::array<float,2>{0.519553423f, 0.212093413f},
-std::array<float,2>{0.872762382f, 0.850703001f},
-std::array<float,2>{0.35598433f, 0.282213628f},
-std::array<float,2>{0.392717898f, 0.908798337f},
-std::array<float,2>{0.980496883f, 0.480471253f},
-std::array<float,2>{0.738528848f, 0.507164776f},
-std::array<float,2>{0.0795628652f, 0.0758086517f},
-std::array<float,2>{0.184021279f, 0.872659624f},
-std::array<float,2>{0.533536673f, 0.305989265f},
-std::array<float,2>{0.821240306f, 0.746581197f},
-std::array<float,2>{0.319083214f, 0.187750444f},
-std::array<float,2>{0.412691414f, 0.517861128f},
-std::array<float,2>{0.944910049f, 0.0790897459f},
-std::array<float,2>{0.694939196f, 0.934259057f},
-std::array<float,2>{0.106078938f, 0.497241557f},
-std::array<float,2>{0.00292308931f, 0.671578646f},
-std::array<float,2>{0.671930969f, 0.178168714f},
-std::array<float,2>{0.925010204f, 0.750842929f},
-std::array<float,2>{0.4670977f, 0.319494456f},
-std::array<float,2>{0.300761074f, 0.986961246f},
-std::array<float,2>{0.777814806f, 0.421115577f},
-std::array<float,2>{0.586647868f, 0.62439549f},
-std::array<float,2>{0.209801063f, 0.0181414708f},
-std::array<float,2>{0.0744737908f, 0.8943519f},
-std::array<float,2>{0.726621687f, 0.461000085f},
-std::array<float,2>{0.985364437f, 0.561978936f},
-std::array<float,2>{0.378411978f, 0.116845451f},
-std::array<float,2>{0.364485294f, 0.717908859f},
-std::array<float,2>{0.853850603f, 0.238646939f},
-std::array<float,2>{0.51347208f, 0.839837253f},
-std::array<float,2>{0.134400204f, 0.280434549f},
-std::array<float,2>{0.233397499f, 0.590724647f},
-std::array<float,2>{0.600282907f, 0.059681315f},
-std::array<float,2>{0.785223007f, 0.946122825f},
-std::array<float,2>{0.259424835f, 0.37684536f},
-std::array<float,2>{0.492085576f, 0.796100438f},
-std::array<float,2>{0.877632678f, 0.369130492f},
-std::array<float,2>{0.629417777f, 0.628970981f},
-std::array<float,2>{0.0351652913f, 0.143322736f},
-std::array<float,2>{0.126347989f, 0.924503565f},
-std::array<float,2>{0.504072547f, 0.490674436f},
-std::array<float,2>{0.844439685f, 0.525936902f},
-std::array<float,2>{0.371284276f, 0.0873377174f},
-std::array<float,2>{0.387242615f, 0.741865277f},
-std::array<float,2>{0.996033907f, 0.198859349f},
-std::array<float,2>{0.718754292f, 0.865687251f},
-std::array<float,2>{0.0667360649f, 0.300196439f},
-std::array<float,2>{0.0434971564f, 0.614475012f},
-std::array<float,2>{0.637965262f, 0.0306161847f},
-std::array<float,2>{0.884744227f, 0.997735381f},
-std::array<float,2>{0.499009341f, 0.411630899f},
-std::array<float,2>{0.256558746f, 0.759919822f},
-std::array<float,2>{0.794391334f, 0.32080704f},
-std::array<float,2>{0.60432899f, 0.658325493f},
-std::array<float,2>{0.224655345f, 0.18054685f},
-std::array<float,2>{0.0950288028f, 0.831791699f},
-std::array<float,2>{0.697613358f, 0.272419989f},
-std::array<float,2>{0.947205126f, 0.707822859f},
-std::array<float,2>{0.420205265f, 0.246345639f},
-std::array<float,2>{0.323646098f, 0.550927758f},
-std::array<float,2>{0.81599474f, 0.119964607f},
-std::array<float,2>{0.541296005f, 0.900917649f},
-std::array<float,2>{0.177709341f, 0.45482406f},
-std::array<float,2>{0.214079738f, 0.633374512f},
-std::array<float,2>{0.581573665f, 0.156171575f},
-std::array<float,2>{0.772182703f, 0.783928752f},
-std::array<float,2>{0.312251031f, 0.36216867f},
-std::array<float,2>{0.458992273f, 0.94151628f},
-std::array<float,2>{0.931043625f, 0.384302139f},
-std::array<float,2>{0.682335377f, 0.580578387f},
-std::array<float,2>{0.0123632597f, 0.0507240556f},
-std::array<float,2>{0.237569064f, 0.800613761f},
-std::array<float,2>{0.622879982f, 0.35838744f},
-std::array<float,2>{0.799715817f, 0.642258048f},
-std::array<float,2>{0.277788043f, 0.130168229f},
-std::array<float,2>{0.483373731f, 0.566026866f},
-std::array<float,2>{0.895127773f, 0.0338133574f},
-std::array<float,2>{0.641240418f, 0.965057671f},
-std::array<float,2>{0.0497739017f, 0.394890279f},
-std::array<float,2>{0.0919659138f, 0.693281889f},
-std::array<float,2>{0.746171832f, 0.233976394f},
-std::array<float,2>{0.969349384f, 0.819159567f},
-std::array<float,2>{0.405818641f, 0.26478073f},
-std::array<float,2>{0.343834966f, 0.876106083f},
-std::array<float,2>{0.86229986f, 0.438756704f},
-std::array<float,2>{0.528041303f, 0.542106926f},
-std::array<float,2>{0.145757258f, 0.0978835672f},
-std::array<float,2>{0.0241757706f, 0.98041153f},
-std::array<float,2>{0.657300055f, 0.423695207f},
-std::array<float,2>{0.908501744f, 0.609029591f},
-std::array<float,2>{0.438192368f, 0.0135479225f},
-std::array<float,2>{0.293566883f, 0.680202127f},
-std::array<float,2>{0.759304345f, 0.170104444f},
-std::array<float,2>{0.569236457f, 0.777209878f},
-std::array<float,2>{0.197022811f, 0.341032237f},
-std::array<float,2>{0.159900472f, 0.508010924f},
-std::array<float,2>{0.56155163f, 0.062663354f},
-std::array<float,2>{0.836903453f, 0.919665873f},
-std::array<float,2>{0.330592602f, 0.473283887f},
-std::array<float,2>{0.42360273f, 0.858973801f},
-std::array<float,2>{0.967554629f, 0.290912896f},
-std::array<float,2>{0.714995265f, 0.734296024f},
-std::array<float,2>{0.115650222f, 0.206983447f}}
\ No newline at end of file